@@ -0,0 +1,197 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_1_UPPER[] = {
+  "А",
+  "Б",
+  "В",
+  "Г",
+  "Ӷ",
+  "Д",
+  "Е",
+  "Ж",
+  "З",
+  "Ӡ",
+  "И",
+  "К",
+  "Қ",
+  "Ҟ",
+  "Л",
+  "М",
+  "Н",
+  "О",
+  "П",
+  "Ԥ",
+  "Р",
+  "С",
+  "Т",
+  "Ҭ",
+  "У",
+  "Ф",
+  "Х",
+  "Ҳ",
+  "Ц",
+  "Ҵ",
+  "Ч",
+  "Ҷ",
+  "Ҽ",
+  "Ҿ",
+  "Џ",
+  "Ә",
+  "Ш",
+  "Ь",
+  "Ы",
+  "Ҩ",
+};
+const char *ALPHA_1_LOWER[] = {
+  "а",
+  "б",
+  "в",
+  "г",
+  "ӷ",
+  "д",
+  "е",
+  "ж",
+  "з",
+  "ӡ",
+  "и",
+  "к",
+  "қ",
+  "ҟ",
+  "л",
+  "м",
+  "н",
+  "о",
+  "п",
+  "ԥ",
+  "р",
+  "с",
+  "т",
+  "ҭ",
+  "у",
+  "ф",
+  "х",
+  "ҳ",
+  "ц",
+  "ҵ",
+  "ч",
+  "ҷ",
+  "ҽ",
+  "ҿ",
+  "џ",
+  "ә",
+  "ш",
+  "ь",
+  "ы",
+  "ҩ",
+};
+const char *ALPHA_1_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_1_UPPER_CPS[] = {
+  1039, 1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048, 1050, 1051, 1052, 1053, 1054, 1055,
+  1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1067, 1068, 1178, 1182, 1192, 1196, 1202,
+  1204, 1206, 1212, 1214, 1240, 1248, 1270, 1316,
+};
+const uint32_t ALPHA_1_LOWER_CPS[] = {
+  1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080, 1082, 1083, 1084, 1085, 1086, 1087, 1088,
+  1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 1099, 1100, 1119, 1179, 1183, 1193, 1197, 1203,
+  1205, 1207, 1213, 1215, 1241, 1249, 1271, 1317,
+};
+const uint32_t ALPHA_1_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_1_FREQ[] = {
+  { "а", 0.19420000 },
+  { "б", 0.01590000 },
+  { "в", 0.00670000 },
+  { "г", 0.01770000 },
+  { "ӷ", 0.00030000 },
+  { "д", 0.01640000 },
+  { "е", 0.03190000 },
+  { "ж", 0.00820000 },
+  { "з", 0.01870000 },
+  { "ӡ", 0.00640000 },
+  { "и", 0.07660000 },
+  { "к", 0.01870000 },
+  { "қ", 0.02270000 },
+  { "ҟ", 0.00850000 },
+  { "л", 0.03520000 },
+  { "м", 0.02010000 },
+  { "н", 0.04310000 },
+  { "о", 0.02930000 },
+  { "п", 0.01280000 },
+  { "ԥ", 0.00000000 },
+  { "р", 0.07150000 },
+  { "с", 0.02680000 },
+  { "т", 0.03680000 },
+  { "ҭ", 0.01690000 },
+  { "у", 0.03010000 },
+  { "ф", 0.00310000 },
+  { "х", 0.02610000 },
+  { "ҳ", 0.00740000 },
+  { "ц", 0.00950000 },
+  { "ҵ", 0.00630000 },
+  { "ч", 0.00270000 },
+  { "ҷ", 0.00180000 },
+  { "ҽ", 0.00060000 },
+  { "ҿ", 0.00390000 },
+  { "џ", 0.00160000 },
+  { "ә", 0.05610000 },
+  { "ш", 0.01980000 },
+  { "ь", 0.02370000 },
+  { "ы", 0.06450000 },
+  { "ҩ", 0.00770000 },
+};
+
+const wa_cp_freq ALPHA_1_FREQ_CPS[] = {
+  { 0x430u, 0.19420000 },
+  { 0x431u, 0.01590000 },
+  { 0x432u, 0.00670000 },
+  { 0x433u, 0.01770000 },
+  { 0x434u, 0.01640000 },
+  { 0x435u, 0.03190000 },
+  { 0x436u, 0.00820000 },
+  { 0x437u, 0.01870000 },
+  { 0x438u, 0.07660000 },
+  { 0x43Au, 0.01870000 },
+  { 0x43Bu, 0.03520000 },
+  { 0x43Cu, 0.02010000 },
+  { 0x43Du, 0.04310000 },
+  { 0x43Eu, 0.02930000 },
+  { 0x43Fu, 0.01280000 },
+  { 0x440u, 0.07150000 },
+  { 0x441u, 0.02680000 },
+  { 0x442u, 0.03680000 },
+  { 0x443u, 0.03010000 },
+  { 0x444u, 0.00310000 },
+  { 0x445u, 0.02610000 },
+  { 0x446u, 0.00950000 },
+  { 0x447u, 0.00270000 },
+  { 0x448u, 0.01980000 },
+  { 0x44Bu, 0.06450000 },
+  { 0x44Cu, 0.02370000 },
+  { 0x45Fu, 0.00160000 },
+  { 0x49Bu, 0.02270000 },
+  { 0x49Fu, 0.00850000 },
+  { 0x4A9u, 0.00770000 },
+  { 0x4ADu, 0.01690000 },
+  { 0x4B3u, 0.00740000 },
+  { 0x4B5u, 0.00630000 },
+  { 0x4B7u, 0.00180000 },
+  { 0x4BDu, 0.00060000 },
+  { 0x4BFu, 0.00390000 },
+  { 0x4D9u, 0.05610000 },
+  { 0x4E1u, 0.00640000 },
+  { 0x4F7u, 0.00030000 },
+  { 0x525u, 0.00000000 },
+};
+
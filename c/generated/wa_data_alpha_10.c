@@ -0,0 +1,203 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_10_UPPER[] = {
+  "অ",
+  "আ",
+  "ই",
+  "ঈ",
+  "উ",
+  "ঊ",
+  "ঋ",
+  "এ",
+  "ঐ",
+  "ও",
+  "ঔ",
+  "ক",
+  "খ",
+  "গ",
+  "ঘ",
+  "ঙ",
+  "চ",
+  "ছ",
+  "জ",
+  "ঝ",
+  "ঞ",
+  "ট",
+  "ঠ",
+  "ড",
+  "ঢ",
+  "ণ",
+  "ত",
+  "থ",
+  "দ",
+  "ধ",
+  "ন",
+  "প",
+  "ফ",
+  "ব",
+  "ভ",
+  "ম",
+  "য",
+  "ৰ",
+  "ল",
+  "ৱ",
+  "শ",
+  "ষ",
+  "স",
+  "হ",
+};
+const char *ALPHA_10_LOWER[] = {
+  "অ",
+  "আ",
+  "ই",
+  "ঈ",
+  "উ",
+  "ঊ",
+  "ঋ",
+  "এ",
+  "ঐ",
+  "ও",
+  "ঔ",
+  "ক",
+  "খ",
+  "গ",
+  "ঘ",
+  "ঙ",
+  "চ",
+  "ছ",
+  "জ",
+  "ঝ",
+  "ঞ",
+  "ট",
+  "ঠ",
+  "ড",
+  "ঢ",
+  "ণ",
+  "ত",
+  "থ",
+  "দ",
+  "ধ",
+  "ন",
+  "প",
+  "ফ",
+  "ব",
+  "ভ",
+  "ম",
+  "য",
+  "ৰ",
+  "ল",
+  "ৱ",
+  "শ",
+  "ষ",
+  "স",
+  "হ",
+};
+const char *ALPHA_10_DIGITS[] = {
+};
+const uint32_t ALPHA_10_UPPER_CPS[] = {
+  2437, 2438, 2439, 2440, 2441, 2442, 2443, 2447, 2448, 2451, 2452, 2453, 2454, 2455, 2456, 2457,
+  2458, 2459, 2460, 2461, 2462, 2463, 2464, 2465, 2466, 2467, 2468, 2469, 2470, 2471, 2472, 2474,
+  2475, 2476, 2477, 2478, 2479, 2482, 2486, 2487, 2488, 2489, 2544, 2545,
+};
+const uint32_t ALPHA_10_LOWER_CPS[] = {
+  2437, 2438, 2439, 2440, 2441, 2442, 2443, 2447, 2448, 2451, 2452, 2453, 2454, 2455, 2456, 2457,
+  2458, 2459, 2460, 2461, 2462, 2463, 2464, 2465, 2466, 2467, 2468, 2469, 2470, 2471, 2472, 2474,
+  2475, 2476, 2477, 2478, 2479, 2482, 2486, 2487, 2488, 2489, 2544, 2545,
+};
+const uint32_t ALPHA_10_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_10_FREQ[] = {
+  { "উ", 0.00720000 },
+  { "ম", 0.04420000 },
+  { "এ", 0.01170000 },
+  { "অ", 0.01280000 },
+  { "ণ", 0.01150000 },
+  { "ৱ", 0.01570000 },
+  { "শ", 0.01520000 },
+  { "ঠ", 0.00380000 },
+  { "ফ", 0.00420000 },
+  { "ঙ", 0.00220000 },
+  { "ও", 0.00720000 },
+  { "ল", 0.05020000 },
+  { "ঈ", 0.00000000 },
+  { "ঢ", 0.00120000 },
+  { "ঝ", 0.00010000 },
+  { "ৰ", 0.15070000 },
+  { "ঘ", 0.00240000 },
+  { "জ", 0.01990000 },
+  { "দ", 0.02660000 },
+  { "ঐ", 0.00010000 },
+  { "স", 0.03610000 },
+  { "য", 0.05070000 },
+  { "ঔ", 0.00010000 },
+  { "গ", 0.02140000 },
+  { "ঋ", 0.00010000 },
+  { "ঊ", 0.00010000 },
+  { "ব", 0.05200000 },
+  { "ট", 0.01920000 },
+  { "ন", 0.06770000 },
+  { "চ", 0.02170000 },
+  { "খ", 0.01140000 },
+  { "ভ", 0.01360000 },
+  { "ধ", 0.01030000 },
+  { "হ", 0.02940000 },
+  { "ই", 0.01970000 },
+  { "আ", 0.02030000 },
+  { "ক", 0.07080000 },
+  { "প", 0.04340000 },
+  { "ঞ", 0.00250000 },
+  { "ছ", 0.01700000 },
+  { "ড", 0.00650000 },
+  { "ত", 0.07530000 },
+  { "থ", 0.01040000 },
+  { "ষ", 0.01360000 },
+};
+
+const wa_cp_freq ALPHA_10_FREQ_CPS[] = {
+  { 0x985u, 0.01280000 },
+  { 0x986u, 0.02030000 },
+  { 0x987u, 0.01970000 },
+  { 0x988u, 0.00000000 },
+  { 0x989u, 0.00720000 },
+  { 0x98Au, 0.00010000 },
+  { 0x98Bu, 0.00010000 },
+  { 0x98Fu, 0.01170000 },
+  { 0x990u, 0.00010000 },
+  { 0x993u, 0.00720000 },
+  { 0x994u, 0.00010000 },
+  { 0x995u, 0.07080000 },
+  { 0x996u, 0.01140000 },
+  { 0x997u, 0.02140000 },
+  { 0x998u, 0.00240000 },
+  { 0x999u, 0.00220000 },
+  { 0x99Au, 0.02170000 },
+  { 0x99Bu, 0.01700000 },
+  { 0x99Cu, 0.01990000 },
+  { 0x99Du, 0.00010000 },
+  { 0x99Eu, 0.00250000 },
+  { 0x99Fu, 0.01920000 },
+  { 0x9A0u, 0.00380000 },
+  { 0x9A1u, 0.00650000 },
+  { 0x9A2u, 0.00120000 },
+  { 0x9A3u, 0.01150000 },
+  { 0x9A4u, 0.07530000 },
+  { 0x9A5u, 0.01040000 },
+  { 0x9A6u, 0.02660000 },
+  { 0x9A7u, 0.01030000 },
+  { 0x9A8u, 0.06770000 },
+  { 0x9AAu, 0.04340000 },
+  { 0x9ABu, 0.00420000 },
+  { 0x9ACu, 0.05200000 },
+  { 0x9ADu, 0.01360000 },
+  { 0x9AEu, 0.04420000 },
+  { 0x9AFu, 0.05070000 },
+  { 0x9B2u, 0.05020000 },
+  { 0x9B6u, 0.01520000 },
+  { 0x9B7u, 0.01360000 },
+  { 0x9B8u, 0.03610000 },
+  { 0x9B9u, 0.02940000 },
+  { 0x9F0u, 0.15070000 },
+  { 0x9F1u, 0.01570000 },
+};
+
@@ -0,0 +1,239 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_100_UPPER[] = {
+  "अ",
+  "आ",
+  "इ",
+  "ई",
+  "उ",
+  "ऊ",
+  "ऋ",
+  "ए",
+  "ऐ",
+  "ओ",
+  "औ",
+  "क",
+  "ख",
+  "ग",
+  "घ",
+  "ङ",
+  "च",
+  "छ",
+  "ज",
+  "झ",
+  "ञ",
+  "ट",
+  "ठ",
+  "ड",
+  "ढ",
+  "ण",
+  "त",
+  "थ",
+  "द",
+  "ध",
+  "न",
+  "प",
+  "फ",
+  "ब",
+  "भ",
+  "म",
+  "य",
+  "र",
+  "ल",
+  "व",
+  "श",
+  "ष",
+  "स",
+  "ह",
+  "ऌ",
+  "ऍ",
+  "ऑ",
+  "ळ",
+  "ऽ",
+  "ॐ",
+};
+const char *ALPHA_100_LOWER[] = {
+  "अ",
+  "आ",
+  "इ",
+  "ई",
+  "उ",
+  "ऊ",
+  "ऋ",
+  "ए",
+  "ऐ",
+  "ओ",
+  "औ",
+  "क",
+  "ख",
+  "ग",
+  "घ",
+  "ङ",
+  "च",
+  "छ",
+  "ज",
+  "झ",
+  "ञ",
+  "ट",
+  "ठ",
+  "ड",
+  "ढ",
+  "ण",
+  "त",
+  "थ",
+  "द",
+  "ध",
+  "न",
+  "प",
+  "फ",
+  "ब",
+  "भ",
+  "म",
+  "य",
+  "र",
+  "ल",
+  "व",
+  "श",
+  "ष",
+  "स",
+  "ह",
+  "ऌ",
+  "ऍ",
+  "ऑ",
+  "ळ",
+  "ऽ",
+  "ॐ",
+};
+const char *ALPHA_100_DIGITS[] = {
+  "०",
+  "१",
+  "२",
+  "३",
+  "४",
+  "५",
+  "६",
+  "७",
+  "८",
+  "९",
+};
+const uint32_t ALPHA_100_UPPER_CPS[] = {
+  2309, 2310, 2311, 2312, 2313, 2314, 2315, 2316, 2317, 2319, 2320, 2321, 2323, 2324, 2325, 2326,
+  2327, 2328, 2329, 2330, 2331, 2332, 2333, 2334, 2335, 2336, 2337, 2338, 2339, 2340, 2341, 2342,
+  2343, 2344, 2346, 2347, 2348, 2349, 2350, 2351, 2352, 2354, 2355, 2357, 2358, 2359, 2360, 2361,
+  2365, 2384,
+};
+const uint32_t ALPHA_100_LOWER_CPS[] = {
+  2309, 2310, 2311, 2312, 2313, 2314, 2315, 2316, 2317, 2319, 2320, 2321, 2323, 2324, 2325, 2326,
+  2327, 2328, 2329, 2330, 2331, 2332, 2333, 2334, 2335, 2336, 2337, 2338, 2339, 2340, 2341, 2342,
+  2343, 2344, 2346, 2347, 2348, 2349, 2350, 2351, 2352, 2354, 2355, 2357, 2358, 2359, 2360, 2361,
+  2365, 2384,
+};
+const uint32_t ALPHA_100_DIGITS_CPS[] = {
+  2406, 2407, 2408, 2409, 2410, 2411, 2412, 2413, 2414, 2415,
+};
+const wa_freq_entry ALPHA_100_FREQ[] = {
+  { "अ", 0.01490000 },
+  { "आ", 0.00770000 },
+  { "इ", 0.01060000 },
+  { "ई", 0.00650000 },
+  { "उ", 0.00880000 },
+  { "ऊ", 0.00060000 },
+  { "ऋ", 0.00010000 },
+  { "ए", 0.01420000 },
+  { "ऐ", 0.00080000 },
+  { "ओ", 0.00210000 },
+  { "औ", 0.00760000 },
+  { "क", 0.11610000 },
+  { "ख", 0.00650000 },
+  { "ग", 0.02180000 },
+  { "घ", 0.00170000 },
+  { "ङ", 0.00000000 },
+  { "च", 0.01140000 },
+  { "छ", 0.00240000 },
+  { "ज", 0.02830000 },
+  { "झ", 0.00060000 },
+  { "ञ", 0.00080000 },
+  { "ट", 0.01550000 },
+  { "ठ", 0.00150000 },
+  { "ड", 0.01180000 },
+  { "ढ", 0.00100000 },
+  { "ण", 0.00790000 },
+  { "त", 0.05920000 },
+  { "थ", 0.01230000 },
+  { "द", 0.02800000 },
+  { "ध", 0.01130000 },
+  { "न", 0.06510000 },
+  { "प", 0.04440000 },
+  { "फ", 0.00590000 },
+  { "ब", 0.02050000 },
+  { "भ", 0.01230000 },
+  { "म", 0.05350000 },
+  { "य", 0.04390000 },
+  { "र", 0.11160000 },
+  { "ल", 0.04060000 },
+  { "व", 0.04040000 },
+  { "श", 0.01730000 },
+  { "ष", 0.01080000 },
+  { "स", 0.06980000 },
+  { "ह", 0.05090000 },
+  { "ऌ", 0.00000000 },
+  { "ऍ", 0.00000000 },
+  { "ऑ", 0.00070000 },
+  { "ळ", 0.00000000 },
+  { "ऽ", 0.00000000 },
+  { "ॐ", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_100_FREQ_CPS[] = {
+  { 0x905u, 0.01490000 },
+  { 0x906u, 0.00770000 },
+  { 0x907u, 0.01060000 },
+  { 0x908u, 0.00650000 },
+  { 0x909u, 0.00880000 },
+  { 0x90Au, 0.00060000 },
+  { 0x90Bu, 0.00010000 },
+  { 0x90Cu, 0.00000000 },
+  { 0x90Du, 0.00000000 },
+  { 0x90Fu, 0.01420000 },
+  { 0x910u, 0.00080000 },
+  { 0x911u, 0.00070000 },
+  { 0x913u, 0.00210000 },
+  { 0x914u, 0.00760000 },
+  { 0x915u, 0.11610000 },
+  { 0x916u, 0.00650000 },
+  { 0x917u, 0.02180000 },
+  { 0x918u, 0.00170000 },
+  { 0x919u, 0.00000000 },
+  { 0x91Au, 0.01140000 },
+  { 0x91Bu, 0.00240000 },
+  { 0x91Cu, 0.02830000 },
+  { 0x91Du, 0.00060000 },
+  { 0x91Eu, 0.00080000 },
+  { 0x91Fu, 0.01550000 },
+  { 0x920u, 0.00150000 },
+  { 0x921u, 0.01180000 },
+  { 0x922u, 0.00100000 },
+  { 0x923u, 0.00790000 },
+  { 0x924u, 0.05920000 },
+  { 0x925u, 0.01230000 },
+  { 0x926u, 0.02800000 },
+  { 0x927u, 0.01130000 },
+  { 0x928u, 0.06510000 },
+  { 0x92Au, 0.04440000 },
+  { 0x92Bu, 0.00590000 },
+  { 0x92Cu, 0.02050000 },
+  { 0x92Du, 0.01230000 },
+  { 0x92Eu, 0.05350000 },
+  { 0x92Fu, 0.04390000 },
+  { 0x930u, 0.11160000 },
+  { 0x932u, 0.04060000 },
+  { 0x933u, 0.00000000 },
+  { 0x935u, 0.04040000 },
+  { 0x936u, 0.01730000 },
+  { 0x937u, 0.01080000 },
+  { 0x938u, 0.06980000 },
+  { 0x939u, 0.05090000 },
+  { 0x93Du, 0.00000000 },
+  { 0x950u, 0.00000000 },
+};
+
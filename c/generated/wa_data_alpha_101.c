@@ -0,0 +1,117 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_101_UPPER[] = {
+  "ᜠ",
+  "ᜡ",
+  "ᜢ",
+  "ᜣ",
+  "ᜤ",
+  "ᜥ",
+  "ᜦ",
+  "ᜧ",
+  "ᜨ",
+  "ᜩ",
+  "ᜪ",
+  "ᜫ",
+  "ᜬ",
+  "ᜭ",
+  "ᜮ",
+  "ᜯ",
+  "ᜰ",
+  "ᜱ",
+  "ᜲ",
+  "ᜳ",
+  "᜴",
+  "᜵",
+  "᜶",
+};
+const char *ALPHA_101_LOWER[] = {
+  "ᜠ",
+  "ᜡ",
+  "ᜢ",
+  "ᜣ",
+  "ᜤ",
+  "ᜥ",
+  "ᜦ",
+  "ᜧ",
+  "ᜨ",
+  "ᜩ",
+  "ᜪ",
+  "ᜫ",
+  "ᜬ",
+  "ᜭ",
+  "ᜮ",
+  "ᜯ",
+  "ᜰ",
+  "ᜱ",
+  "ᜲ",
+  "ᜳ",
+  "᜴",
+  "᜵",
+  "᜶",
+};
+const char *ALPHA_101_DIGITS[] = {
+};
+const uint32_t ALPHA_101_UPPER_CPS[] = {
+  5920, 5921, 5922, 5923, 5924, 5925, 5926, 5927, 5928, 5929, 5930, 5931, 5932, 5933, 5934, 5935,
+  5936, 5937, 5938, 5939, 5940, 5941, 5942,
+};
+const uint32_t ALPHA_101_LOWER_CPS[] = {
+  5920, 5921, 5922, 5923, 5924, 5925, 5926, 5927, 5928, 5929, 5930, 5931, 5932, 5933, 5934, 5935,
+  5936, 5937, 5938, 5939, 5940, 5941, 5942,
+};
+const uint32_t ALPHA_101_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_101_FREQ[] = {
+  { "ᜠ", 0.00000000 },
+  { "ᜡ", 0.00000000 },
+  { "ᜢ", 0.00000000 },
+  { "ᜣ", 0.00000000 },
+  { "ᜤ", 0.00000000 },
+  { "ᜥ", 0.00000000 },
+  { "ᜦ", 0.00000000 },
+  { "ᜧ", 0.00000000 },
+  { "ᜨ", 0.00000000 },
+  { "ᜩ", 0.00000000 },
+  { "ᜪ", 0.00000000 },
+  { "ᜫ", 0.00000000 },
+  { "ᜬ", 0.00000000 },
+  { "ᜭ", 0.00000000 },
+  { "ᜮ", 0.00000000 },
+  { "ᜯ", 0.00000000 },
+  { "ᜰ", 0.00000000 },
+  { "ᜱ", 0.00000000 },
+  { "ᜲ", 0.00000000 },
+  { "ᜳ", 0.00000000 },
+  { "᜴", 0.00000000 },
+  { "᜵", 0.00000000 },
+  { "᜶", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_101_FREQ_CPS[] = {
+  { 0x1720u, 0.00000000 },
+  { 0x1721u, 0.00000000 },
+  { 0x1722u, 0.00000000 },
+  { 0x1723u, 0.00000000 },
+  { 0x1724u, 0.00000000 },
+  { 0x1725u, 0.00000000 },
+  { 0x1726u, 0.00000000 },
+  { 0x1727u, 0.00000000 },
+  { 0x1728u, 0.00000000 },
+  { 0x1729u, 0.00000000 },
+  { 0x172Au, 0.00000000 },
+  { 0x172Bu, 0.00000000 },
+  { 0x172Cu, 0.00000000 },
+  { 0x172Du, 0.00000000 },
+  { 0x172Eu, 0.00000000 },
+  { 0x172Fu, 0.00000000 },
+  { 0x1730u, 0.00000000 },
+  { 0x1731u, 0.00000000 },
+  { 0x1732u, 0.00000000 },
+  { 0x1733u, 0.00000000 },
+  { 0x1734u, 0.00000000 },
+  { 0x1735u, 0.00000000 },
+  { 0x1736u, 0.00000000 },
+};
+
@@ -0,0 +1,163 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_102_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+  "Á",
+  "É",
+  "Ü",
+  "Ć",
+  "Č",
+  "Đ",
+  "Š",
+  "Ž",
+};
+const char *ALPHA_102_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+  "á",
+  "é",
+  "ü",
+  "ć",
+  "č",
+  "đ",
+  "š",
+  "ž",
+};
+const char *ALPHA_102_DIGITS[] = {
+};
+const uint32_t ALPHA_102_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 193, 201, 220, 262, 268, 272,
+  352, 381,
+};
+const uint32_t ALPHA_102_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 225, 233, 252, 263, 269, 273,
+  353, 382,
+};
+const uint32_t ALPHA_102_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_102_FREQ[] = {
+  { "g", 0.01870000 },
+  { "č", 0.00880000 },
+  { "a", 0.11350000 },
+  { "y", 0.00130000 },
+  { "d", 0.03210000 },
+  { "h", 0.00880000 },
+  { "đ", 0.00200000 },
+  { "r", 0.05340000 },
+  { "n", 0.06570000 },
+  { "z", 0.01740000 },
+  { "ć", 0.00450000 },
+  { "t", 0.04480000 },
+  { "š", 0.00710000 },
+  { "s", 0.05000000 },
+  { "e", 0.08670000 },
+  { "ü", 0.00010000 },
+  { "x", 0.00030000 },
+  { "p", 0.02880000 },
+  { "o", 0.08910000 },
+  { "c", 0.01140000 },
+  { "é", 0.00010000 },
+  { "ž", 0.00470000 },
+  { "w", 0.00100000 },
+  { "j", 0.05200000 },
+  { "á", 0.00010000 },
+  { "k", 0.03770000 },
+  { "q", 0.00020000 },
+  { "f", 0.00370000 },
+  { "m", 0.03070000 },
+  { "l", 0.03620000 },
+  { "i", 0.09740000 },
+  { "b", 0.01520000 },
+  { "u", 0.04320000 },
+  { "v", 0.03310000 },
+};
+
+const wa_cp_freq ALPHA_102_FREQ_CPS[] = {
+  { 0x61u, 0.11350000 },
+  { 0x62u, 0.01520000 },
+  { 0x63u, 0.01140000 },
+  { 0x64u, 0.03210000 },
+  { 0x65u, 0.08670000 },
+  { 0x66u, 0.00370000 },
+  { 0x67u, 0.01870000 },
+  { 0x68u, 0.00880000 },
+  { 0x69u, 0.09740000 },
+  { 0x6Au, 0.05200000 },
+  { 0x6Bu, 0.03770000 },
+  { 0x6Cu, 0.03620000 },
+  { 0x6Du, 0.03070000 },
+  { 0x6Eu, 0.06570000 },
+  { 0x6Fu, 0.08910000 },
+  { 0x70u, 0.02880000 },
+  { 0x71u, 0.00020000 },
+  { 0x72u, 0.05340000 },
+  { 0x73u, 0.05000000 },
+  { 0x74u, 0.04480000 },
+  { 0x75u, 0.04320000 },
+  { 0x76u, 0.03310000 },
+  { 0x77u, 0.00100000 },
+  { 0x78u, 0.00030000 },
+  { 0x79u, 0.00130000 },
+  { 0x7Au, 0.01740000 },
+  { 0xE1u, 0.00010000 },
+  { 0xE9u, 0.00010000 },
+  { 0xFCu, 0.00010000 },
+  { 0x107u, 0.00450000 },
+  { 0x10Du, 0.00880000 },
+  { 0x111u, 0.00200000 },
+  { 0x161u, 0.00710000 },
+  { 0x17Eu, 0.00470000 },
+};
+
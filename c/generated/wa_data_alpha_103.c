@@ -0,0 +1,181 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_103_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "Č",
+  "Ć",
+  "D",
+  "Ź",
+  "E",
+  "Ě",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "Ł",
+  "L",
+  "M",
+  "N",
+  "Ń",
+  "O",
+  "Ó",
+  "P",
+  "Q",
+  "R",
+  "Ř",
+  "S",
+  "Š",
+  "T",
+  "U",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+  "Ž",
+};
+const char *ALPHA_103_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "č",
+  "ć",
+  "d",
+  "ź",
+  "e",
+  "ě",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "ł",
+  "l",
+  "m",
+  "n",
+  "ń",
+  "o",
+  "ó",
+  "p",
+  "q",
+  "r",
+  "ř",
+  "s",
+  "š",
+  "t",
+  "u",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+  "ž",
+};
+const char *ALPHA_103_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_103_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 211, 262, 268, 282, 321, 323,
+  344, 352, 377, 381,
+};
+const uint32_t ALPHA_103_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 243, 263, 269, 283, 322, 324,
+  345, 353, 378, 382,
+};
+const uint32_t ALPHA_103_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_103_FREQ[] = {
+  { "a", 0.09510000 },
+  { "b", 0.01670000 },
+  { "c", 0.02720000 },
+  { "č", 0.00790000 },
+  { "ć", 0.01040000 },
+  { "d", 0.02780000 },
+  { "ź", 0.00520000 },
+  { "e", 0.08990000 },
+  { "ě", 0.01560000 },
+  { "f", 0.00330000 },
+  { "g", 0.00500000 },
+  { "h", 0.02680000 },
+  { "i", 0.04950000 },
+  { "j", 0.05300000 },
+  { "k", 0.03860000 },
+  { "ł", 0.01190000 },
+  { "l", 0.02820000 },
+  { "m", 0.02730000 },
+  { "n", 0.05830000 },
+  { "ń", 0.00070000 },
+  { "o", 0.08220000 },
+  { "ó", 0.00860000 },
+  { "p", 0.02530000 },
+  { "q", 0.00010000 },
+  { "r", 0.04750000 },
+  { "ř", 0.00420000 },
+  { "s", 0.05280000 },
+  { "š", 0.00990000 },
+  { "t", 0.04130000 },
+  { "u", 0.03070000 },
+  { "v", 0.00130000 },
+  { "w", 0.04930000 },
+  { "x", 0.00040000 },
+  { "y", 0.02200000 },
+  { "z", 0.01730000 },
+  { "ž", 0.00900000 },
+};
+
+const wa_cp_freq ALPHA_103_FREQ_CPS[] = {
+  { 0x61u, 0.09510000 },
+  { 0x62u, 0.01670000 },
+  { 0x63u, 0.02720000 },
+  { 0x64u, 0.02780000 },
+  { 0x65u, 0.08990000 },
+  { 0x66u, 0.00330000 },
+  { 0x67u, 0.00500000 },
+  { 0x68u, 0.02680000 },
+  { 0x69u, 0.04950000 },
+  { 0x6Au, 0.05300000 },
+  { 0x6Bu, 0.03860000 },
+  { 0x6Cu, 0.02820000 },
+  { 0x6Du, 0.02730000 },
+  { 0x6Eu, 0.05830000 },
+  { 0x6Fu, 0.08220000 },
+  { 0x70u, 0.02530000 },
+  { 0x71u, 0.00010000 },
+  { 0x72u, 0.04750000 },
+  { 0x73u, 0.05280000 },
+  { 0x74u, 0.04130000 },
+  { 0x75u, 0.03070000 },
+  { 0x76u, 0.00130000 },
+  { 0x77u, 0.04930000 },
+  { 0x78u, 0.00040000 },
+  { 0x79u, 0.02200000 },
+  { 0x7Au, 0.01730000 },
+  { 0xF3u, 0.00860000 },
+  { 0x107u, 0.01040000 },
+  { 0x10Du, 0.00790000 },
+  { 0x11Bu, 0.01560000 },
+  { 0x142u, 0.01190000 },
+  { 0x144u, 0.00070000 },
+  { 0x159u, 0.00420000 },
+  { 0x161u, 0.00990000 },
+  { 0x17Au, 0.00520000 },
+  { 0x17Eu, 0.00900000 },
+};
+
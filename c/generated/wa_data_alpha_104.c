@@ -0,0 +1,129 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_104_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "W",
+  "Y",
+  "Z",
+  "È",
+  "Ò",
+};
+const char *ALPHA_104_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "w",
+  "y",
+  "z",
+  "è",
+  "ò",
+};
+const char *ALPHA_104_DIGITS[] = {
+};
+const uint32_t ALPHA_104_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  82, 83, 84, 85, 86, 87, 89, 90, 200, 210,
+};
+const uint32_t ALPHA_104_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  114, 115, 116, 117, 118, 119, 121, 122, 232, 242,
+};
+const uint32_t ALPHA_104_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_104_FREQ[] = {
+  { "a", 0.12650000 },
+  { "b", 0.01130000 },
+  { "c", 0.00670000 },
+  { "d", 0.01330000 },
+  { "e", 0.09720000 },
+  { "f", 0.00630000 },
+  { "g", 0.01930000 },
+  { "h", 0.00500000 },
+  { "i", 0.08940000 },
+  { "j", 0.00510000 },
+  { "k", 0.03770000 },
+  { "l", 0.05350000 },
+  { "m", 0.02590000 },
+  { "n", 0.13230000 },
+  { "o", 0.06330000 },
+  { "p", 0.02310000 },
+  { "r", 0.02320000 },
+  { "s", 0.06490000 },
+  { "t", 0.05140000 },
+  { "u", 0.01820000 },
+  { "v", 0.01640000 },
+  { "w", 0.02150000 },
+  { "y", 0.06140000 },
+  { "z", 0.00820000 },
+  { "è", 0.01290000 },
+  { "ò", 0.00600000 },
+};
+
+const wa_cp_freq ALPHA_104_FREQ_CPS[] = {
+  { 0x61u, 0.12650000 },
+  { 0x62u, 0.01130000 },
+  { 0x63u, 0.00670000 },
+  { 0x64u, 0.01330000 },
+  { 0x65u, 0.09720000 },
+  { 0x66u, 0.00630000 },
+  { 0x67u, 0.01930000 },
+  { 0x68u, 0.00500000 },
+  { 0x69u, 0.08940000 },
+  { 0x6Au, 0.00510000 },
+  { 0x6Bu, 0.03770000 },
+  { 0x6Cu, 0.05350000 },
+  { 0x6Du, 0.02590000 },
+  { 0x6Eu, 0.13230000 },
+  { 0x6Fu, 0.06330000 },
+  { 0x70u, 0.02310000 },
+  { 0x72u, 0.02320000 },
+  { 0x73u, 0.06490000 },
+  { 0x74u, 0.05140000 },
+  { 0x75u, 0.01820000 },
+  { 0x76u, 0.01640000 },
+  { 0x77u, 0.02150000 },
+  { 0x79u, 0.06140000 },
+  { 0x7Au, 0.00820000 },
+  { 0xE8u, 0.01290000 },
+  { 0xF2u, 0.00600000 },
+};
+
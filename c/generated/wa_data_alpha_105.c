@@ -0,0 +1,153 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_105_UPPER[] = {
+  "A",
+  "Á",
+  "B",
+  "C",
+  "D",
+  "E",
+  "É",
+  "F",
+  "G",
+  "H",
+  "I",
+  "Í",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "Ó",
+  "Ö",
+  "Ő",
+  "P",
+  "R",
+  "T",
+  "U",
+  "Ú",
+  "Ü",
+  "Ű",
+  "V",
+  "Y",
+  "Z",
+  "S",
+};
+const char *ALPHA_105_LOWER[] = {
+  "a",
+  "á",
+  "b",
+  "c",
+  "d",
+  "e",
+  "é",
+  "f",
+  "g",
+  "h",
+  "i",
+  "í",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "ó",
+  "ö",
+  "ő",
+  "p",
+  "r",
+  "t",
+  "u",
+  "ú",
+  "ü",
+  "ű",
+  "v",
+  "y",
+  "z",
+  "s",
+};
+const char *ALPHA_105_DIGITS[] = {
+};
+const uint32_t ALPHA_105_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  82, 83, 84, 85, 86, 89, 90, 193, 201, 205, 211, 214, 218, 220, 336, 368,
+};
+const uint32_t ALPHA_105_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  114, 115, 116, 117, 118, 121, 122, 225, 233, 237, 243, 246, 250, 252, 337, 369,
+};
+const uint32_t ALPHA_105_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_105_FREQ[] = {
+  { "a", 0.09200000 },
+  { "á", 0.03550000 },
+  { "b", 0.02290000 },
+  { "c", 0.00960000 },
+  { "d", 0.01980000 },
+  { "e", 0.09970000 },
+  { "é", 0.03270000 },
+  { "f", 0.01040000 },
+  { "g", 0.03040000 },
+  { "h", 0.01430000 },
+  { "i", 0.04410000 },
+  { "í", 0.00620000 },
+  { "j", 0.01170000 },
+  { "k", 0.04690000 },
+  { "l", 0.06270000 },
+  { "m", 0.03040000 },
+  { "n", 0.05500000 },
+  { "o", 0.04170000 },
+  { "ó", 0.00960000 },
+  { "ö", 0.01060000 },
+  { "ő", 0.00920000 },
+  { "p", 0.01260000 },
+  { "r", 0.04640000 },
+  { "t", 0.08060000 },
+  { "u", 0.01260000 },
+  { "ú", 0.00300000 },
+  { "ü", 0.00500000 },
+  { "ű", 0.00230000 },
+  { "v", 0.01990000 },
+  { "y", 0.02020000 },
+  { "z", 0.04030000 },
+  { "s", 0.06170000 },
+};
+
+const wa_cp_freq ALPHA_105_FREQ_CPS[] = {
+  { 0x61u, 0.09200000 },
+  { 0x62u, 0.02290000 },
+  { 0x63u, 0.00960000 },
+  { 0x64u, 0.01980000 },
+  { 0x65u, 0.09970000 },
+  { 0x66u, 0.01040000 },
+  { 0x67u, 0.03040000 },
+  { 0x68u, 0.01430000 },
+  { 0x69u, 0.04410000 },
+  { 0x6Au, 0.01170000 },
+  { 0x6Bu, 0.04690000 },
+  { 0x6Cu, 0.06270000 },
+  { 0x6Du, 0.03040000 },
+  { 0x6Eu, 0.05500000 },
+  { 0x6Fu, 0.04170000 },
+  { 0x70u, 0.01260000 },
+  { 0x72u, 0.04640000 },
+  { 0x73u, 0.06170000 },
+  { 0x74u, 0.08060000 },
+  { 0x75u, 0.01260000 },
+  { 0x76u, 0.01990000 },
+  { 0x79u, 0.02020000 },
+  { 0x7Au, 0.04030000 },
+  { 0xE1u, 0.03550000 },
+  { 0xE9u, 0.03270000 },
+  { 0xEDu, 0.00620000 },
+  { 0xF3u, 0.00960000 },
+  { 0xF6u, 0.01060000 },
+  { 0xFAu, 0.00300000 },
+  { 0xFCu, 0.00500000 },
+  { 0x151u, 0.00920000 },
+  { 0x171u, 0.00230000 },
+};
+
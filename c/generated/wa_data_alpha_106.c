@@ -0,0 +1,179 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_106_UPPER[] = {
+  "Ա",
+  "Բ",
+  "Գ",
+  "Դ",
+  "Ե",
+  "Զ",
+  "Է",
+  "Ը",
+  "Թ",
+  "Ժ",
+  "Ի",
+  "Լ",
+  "Խ",
+  "Ծ",
+  "Կ",
+  "Հ",
+  "Ձ",
+  "Ղ",
+  "Ճ",
+  "Մ",
+  "Յ",
+  "Ն",
+  "Շ",
+  "Ո",
+  "Չ",
+  "Պ",
+  "Ջ",
+  "Ռ",
+  "Ս",
+  "Վ",
+  "Տ",
+  "Ր",
+  "Ց",
+  "Ւ",
+  "Փ",
+  "Ք",
+  "Օ",
+  "Ֆ",
+};
+const char *ALPHA_106_LOWER[] = {
+  "ա",
+  "բ",
+  "գ",
+  "դ",
+  "ե",
+  "զ",
+  "է",
+  "ը",
+  "թ",
+  "ժ",
+  "ի",
+  "լ",
+  "խ",
+  "ծ",
+  "կ",
+  "հ",
+  "ձ",
+  "ղ",
+  "ճ",
+  "մ",
+  "յ",
+  "ն",
+  "շ",
+  "ո",
+  "չ",
+  "պ",
+  "ջ",
+  "ռ",
+  "ս",
+  "վ",
+  "տ",
+  "ր",
+  "ց",
+  "ւ",
+  "փ",
+  "ք",
+  "օ",
+  "ֆ",
+};
+const char *ALPHA_106_DIGITS[] = {
+};
+const uint32_t ALPHA_106_UPPER_CPS[] = {
+  1329, 1330, 1331, 1332, 1333, 1334, 1335, 1336, 1337, 1338, 1339, 1340, 1341, 1342, 1343, 1344,
+  1345, 1346, 1347, 1348, 1349, 1350, 1351, 1352, 1353, 1354, 1355, 1356, 1357, 1358, 1359, 1360,
+  1361, 1362, 1363, 1364, 1365, 1366,
+};
+const uint32_t ALPHA_106_LOWER_CPS[] = {
+  1377, 1378, 1379, 1380, 1381, 1382, 1383, 1384, 1385, 1386, 1387, 1388, 1389, 1390, 1391, 1392,
+  1393, 1394, 1395, 1396, 1397, 1398, 1399, 1400, 1401, 1402, 1403, 1404, 1405, 1406, 1407, 1408,
+  1409, 1410, 1411, 1412, 1413, 1414,
+};
+const uint32_t ALPHA_106_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_106_FREQ[] = {
+  { "ա", 0.15960000 },
+  { "բ", 0.01210000 },
+  { "գ", 0.01520000 },
+  { "դ", 0.01470000 },
+  { "ե", 0.06180000 },
+  { "զ", 0.00680000 },
+  { "է", 0.01160000 },
+  { "ը", 0.01520000 },
+  { "թ", 0.01790000 },
+  { "ժ", 0.00280000 },
+  { "ի", 0.06000000 },
+  { "լ", 0.02080000 },
+  { "խ", 0.00630000 },
+  { "ծ", 0.00830000 },
+  { "կ", 0.03790000 },
+  { "հ", 0.02000000 },
+  { "ձ", 0.00250000 },
+  { "ղ", 0.01070000 },
+  { "ճ", 0.00180000 },
+  { "մ", 0.04150000 },
+  { "յ", 0.02920000 },
+  { "ն", 0.09690000 },
+  { "շ", 0.00810000 },
+  { "ո", 0.07600000 },
+  { "չ", 0.00500000 },
+  { "պ", 0.01120000 },
+  { "ջ", 0.00570000 },
+  { "ռ", 0.00660000 },
+  { "ս", 0.02540000 },
+  { "վ", 0.02640000 },
+  { "տ", 0.03120000 },
+  { "ր", 0.07760000 },
+  { "ց", 0.01460000 },
+  { "ւ", 0.04110000 },
+  { "փ", 0.00270000 },
+  { "ք", 0.01090000 },
+  { "օ", 0.00190000 },
+  { "ֆ", 0.00200000 },
+};
+
+const wa_cp_freq ALPHA_106_FREQ_CPS[] = {
+  { 0x561u, 0.15960000 },
+  { 0x562u, 0.01210000 },
+  { 0x563u, 0.01520000 },
+  { 0x564u, 0.01470000 },
+  { 0x565u, 0.06180000 },
+  { 0x566u, 0.00680000 },
+  { 0x567u, 0.01160000 },
+  { 0x568u, 0.01520000 },
+  { 0x569u, 0.01790000 },
+  { 0x56Au, 0.00280000 },
+  { 0x56Bu, 0.06000000 },
+  { 0x56Cu, 0.02080000 },
+  { 0x56Du, 0.00630000 },
+  { 0x56Eu, 0.00830000 },
+  { 0x56Fu, 0.03790000 },
+  { 0x570u, 0.02000000 },
+  { 0x571u, 0.00250000 },
+  { 0x572u, 0.01070000 },
+  { 0x573u, 0.00180000 },
+  { 0x574u, 0.04150000 },
+  { 0x575u, 0.02920000 },
+  { 0x576u, 0.09690000 },
+  { 0x577u, 0.00810000 },
+  { 0x578u, 0.07600000 },
+  { 0x579u, 0.00500000 },
+  { 0x57Au, 0.01120000 },
+  { 0x57Bu, 0.00570000 },
+  { 0x57Cu, 0.00660000 },
+  { 0x57Du, 0.02540000 },
+  { 0x57Eu, 0.02640000 },
+  { 0x57Fu, 0.03120000 },
+  { 0x580u, 0.07760000 },
+  { 0x581u, 0.01460000 },
+  { 0x582u, 0.04110000 },
+  { 0x583u, 0.00270000 },
+  { 0x584u, 0.01090000 },
+  { 0x585u, 0.00190000 },
+  { 0x586u, 0.00200000 },
+};
+
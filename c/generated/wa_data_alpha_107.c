@@ -0,0 +1,129 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_107_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+};
+const char *ALPHA_107_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+};
+const char *ALPHA_107_DIGITS[] = {
+};
+const uint32_t ALPHA_107_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90,
+};
+const uint32_t ALPHA_107_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122,
+};
+const uint32_t ALPHA_107_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_107_FREQ[] = {
+  { "a", 0.10200000 },
+  { "b", 0.01100000 },
+  { "c", 0.04120000 },
+  { "d", 0.03530000 },
+  { "e", 0.14770000 },
+  { "f", 0.00770000 },
+  { "g", 0.01260000 },
+  { "h", 0.00920000 },
+  { "i", 0.09220000 },
+  { "j", 0.00250000 },
+  { "k", 0.00160000 },
+  { "l", 0.06370000 },
+  { "m", 0.03050000 },
+  { "n", 0.07710000 },
+  { "o", 0.07380000 },
+  { "p", 0.03060000 },
+  { "q", 0.00690000 },
+  { "r", 0.05880000 },
+  { "s", 0.06310000 },
+  { "t", 0.06800000 },
+  { "u", 0.04100000 },
+  { "v", 0.01640000 },
+  { "w", 0.00100000 },
+  { "x", 0.00250000 },
+  { "y", 0.00240000 },
+  { "z", 0.00110000 },
+};
+
+const wa_cp_freq ALPHA_107_FREQ_CPS[] = {
+  { 0x61u, 0.10200000 },
+  { 0x62u, 0.01100000 },
+  { 0x63u, 0.04120000 },
+  { 0x64u, 0.03530000 },
+  { 0x65u, 0.14770000 },
+  { 0x66u, 0.00770000 },
+  { 0x67u, 0.01260000 },
+  { 0x68u, 0.00920000 },
+  { 0x69u, 0.09220000 },
+  { 0x6Au, 0.00250000 },
+  { 0x6Bu, 0.00160000 },
+  { 0x6Cu, 0.06370000 },
+  { 0x6Du, 0.03050000 },
+  { 0x6Eu, 0.07710000 },
+  { 0x6Fu, 0.07380000 },
+  { 0x70u, 0.03060000 },
+  { 0x71u, 0.00690000 },
+  { 0x72u, 0.05880000 },
+  { 0x73u, 0.06310000 },
+  { 0x74u, 0.06800000 },
+  { 0x75u, 0.04100000 },
+  { 0x76u, 0.01640000 },
+  { 0x77u, 0.00100000 },
+  { 0x78u, 0.00250000 },
+  { 0x79u, 0.00240000 },
+  { 0x7Au, 0.00110000 },
+};
+
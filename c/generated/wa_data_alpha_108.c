@@ -0,0 +1,129 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_108_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+};
+const char *ALPHA_108_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+};
+const char *ALPHA_108_DIGITS[] = {
+};
+const uint32_t ALPHA_108_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90,
+};
+const uint32_t ALPHA_108_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122,
+};
+const uint32_t ALPHA_108_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_108_FREQ[] = {
+  { "a", 0.18740000 },
+  { "b", 0.02650000 },
+  { "c", 0.00790000 },
+  { "d", 0.04480000 },
+  { "e", 0.08210000 },
+  { "f", 0.00410000 },
+  { "g", 0.03640000 },
+  { "h", 0.02440000 },
+  { "i", 0.08080000 },
+  { "j", 0.00910000 },
+  { "k", 0.04260000 },
+  { "l", 0.03650000 },
+  { "m", 0.04160000 },
+  { "n", 0.09760000 },
+  { "o", 0.02460000 },
+  { "p", 0.02920000 },
+  { "q", 0.00030000 },
+  { "r", 0.05390000 },
+  { "s", 0.04650000 },
+  { "t", 0.05030000 },
+  { "u", 0.04810000 },
+  { "v", 0.00260000 },
+  { "w", 0.00550000 },
+  { "x", 0.00040000 },
+  { "y", 0.01580000 },
+  { "z", 0.00090000 },
+};
+
+const wa_cp_freq ALPHA_108_FREQ_CPS[] = {
+  { 0x61u, 0.18740000 },
+  { 0x62u, 0.02650000 },
+  { 0x63u, 0.00790000 },
+  { 0x64u, 0.04480000 },
+  { 0x65u, 0.08210000 },
+  { 0x66u, 0.00410000 },
+  { 0x67u, 0.03640000 },
+  { 0x68u, 0.02440000 },
+  { 0x69u, 0.08080000 },
+  { 0x6Au, 0.00910000 },
+  { 0x6Bu, 0.04260000 },
+  { 0x6Cu, 0.03650000 },
+  { 0x6Du, 0.04160000 },
+  { 0x6Eu, 0.09760000 },
+  { 0x6Fu, 0.02460000 },
+  { 0x70u, 0.02920000 },
+  { 0x71u, 0.00030000 },
+  { 0x72u, 0.05390000 },
+  { 0x73u, 0.04650000 },
+  { 0x74u, 0.05030000 },
+  { 0x75u, 0.04810000 },
+  { 0x76u, 0.00260000 },
+  { 0x77u, 0.00550000 },
+  { 0x78u, 0.00040000 },
+  { 0x79u, 0.01580000 },
+  { 0x7Au, 0.00090000 },
+};
+
@@ -0,0 +1,149 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_109_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+  "Á",
+  "É",
+  "Í",
+  "Ó",
+  "Ú",
+};
+const char *ALPHA_109_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+  "á",
+  "é",
+  "í",
+  "ó",
+  "ú",
+};
+const char *ALPHA_109_DIGITS[] = {
+};
+const uint32_t ALPHA_109_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 193, 201, 205, 211, 218,
+};
+const uint32_t ALPHA_109_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 225, 233, 237, 243, 250,
+};
+const uint32_t ALPHA_109_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_109_FREQ[] = {
+  { "a", 0.10220000 },
+  { "b", 0.01190000 },
+  { "c", 0.03750000 },
+  { "d", 0.03820000 },
+  { "e", 0.12380000 },
+  { "f", 0.00900000 },
+  { "g", 0.01470000 },
+  { "h", 0.01460000 },
+  { "i", 0.11140000 },
+  { "j", 0.00260000 },
+  { "k", 0.00340000 },
+  { "l", 0.06610000 },
+  { "m", 0.02970000 },
+  { "n", 0.08010000 },
+  { "o", 0.04940000 },
+  { "p", 0.02500000 },
+  { "q", 0.00420000 },
+  { "r", 0.05630000 },
+  { "s", 0.06870000 },
+  { "t", 0.07380000 },
+  { "u", 0.04200000 },
+  { "v", 0.01390000 },
+  { "w", 0.00180000 },
+  { "x", 0.00290000 },
+  { "y", 0.00340000 },
+  { "z", 0.00240000 },
+  { "á", 0.00120000 },
+  { "é", 0.00680000 },
+  { "í", 0.00140000 },
+  { "ó", 0.00110000 },
+  { "ú", 0.00040000 },
+};
+
+const wa_cp_freq ALPHA_109_FREQ_CPS[] = {
+  { 0x61u, 0.10220000 },
+  { 0x62u, 0.01190000 },
+  { 0x63u, 0.03750000 },
+  { 0x64u, 0.03820000 },
+  { 0x65u, 0.12380000 },
+  { 0x66u, 0.00900000 },
+  { 0x67u, 0.01470000 },
+  { 0x68u, 0.01460000 },
+  { 0x69u, 0.11140000 },
+  { 0x6Au, 0.00260000 },
+  { 0x6Bu, 0.00340000 },
+  { 0x6Cu, 0.06610000 },
+  { 0x6Du, 0.02970000 },
+  { 0x6Eu, 0.08010000 },
+  { 0x6Fu, 0.04940000 },
+  { 0x70u, 0.02500000 },
+  { 0x71u, 0.00420000 },
+  { 0x72u, 0.05630000 },
+  { 0x73u, 0.06870000 },
+  { 0x74u, 0.07380000 },
+  { 0x75u, 0.04200000 },
+  { 0x76u, 0.01390000 },
+  { 0x77u, 0.00180000 },
+  { 0x78u, 0.00290000 },
+  { 0x79u, 0.00340000 },
+  { 0x7Au, 0.00240000 },
+  { 0xE1u, 0.00120000 },
+  { 0xE9u, 0.00680000 },
+  { 0xEDu, 0.00140000 },
+  { 0xF3u, 0.00110000 },
+  { 0xFAu, 0.00040000 },
+};
+
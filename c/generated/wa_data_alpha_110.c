@@ -0,0 +1,137 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_110_UPPER[] = {
+  "A",
+  "B",
+  "D",
+  "E",
+  "Ẹ",
+  "F",
+  "G",
+  "H",
+  "I",
+  "Ị",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "Ṅ",
+  "O",
+  "Ọ",
+  "P",
+  "R",
+  "S",
+  "T",
+  "U",
+  "Ụ",
+  "V",
+  "W",
+  "Y",
+  "Z",
+};
+const char *ALPHA_110_LOWER[] = {
+  "a",
+  "b",
+  "d",
+  "e",
+  "ẹ",
+  "f",
+  "g",
+  "h",
+  "i",
+  "ị",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "ṅ",
+  "o",
+  "ọ",
+  "p",
+  "r",
+  "s",
+  "t",
+  "u",
+  "ụ",
+  "v",
+  "w",
+  "y",
+  "z",
+};
+const char *ALPHA_110_DIGITS[] = {
+};
+const uint32_t ALPHA_110_UPPER_CPS[] = {
+  65, 66, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 82,
+  83, 84, 85, 86, 87, 89, 90, 7748, 7864, 7882, 7884, 7908,
+};
+const uint32_t ALPHA_110_LOWER_CPS[] = {
+  97, 98, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 114,
+  115, 116, 117, 118, 119, 121, 122, 7749, 7865, 7883, 7885, 7909,
+};
+const uint32_t ALPHA_110_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_110_FREQ[] = {
+  { "o", 0.07190000 },
+  { "t", 0.04910000 },
+  { "g", 0.02890000 },
+  { "u", 0.05220000 },
+  { "s", 0.03730000 },
+  { "k", 0.03020000 },
+  { "ṅ", 0.00000000 },
+  { "ị", 0.00200000 },
+  { "j", 0.00470000 },
+  { "ẹ", 0.00060000 },
+  { "w", 0.02310000 },
+  { "m", 0.03180000 },
+  { "a", 0.12570000 },
+  { "h", 0.03580000 },
+  { "r", 0.05840000 },
+  { "p", 0.01910000 },
+  { "d", 0.03200000 },
+  { "i", 0.08110000 },
+  { "ọ", 0.00420000 },
+  { "z", 0.00290000 },
+  { "e", 0.10250000 },
+  { "v", 0.00540000 },
+  { "y", 0.01890000 },
+  { "n", 0.09750000 },
+  { "b", 0.03460000 },
+  { "f", 0.01640000 },
+  { "l", 0.02950000 },
+  { "ụ", 0.00420000 },
+};
+
+const wa_cp_freq ALPHA_110_FREQ_CPS[] = {
+  { 0x61u, 0.12570000 },
+  { 0x62u, 0.03460000 },
+  { 0x64u, 0.03200000 },
+  { 0x65u, 0.10250000 },
+  { 0x66u, 0.01640000 },
+  { 0x67u, 0.02890000 },
+  { 0x68u, 0.03580000 },
+  { 0x69u, 0.08110000 },
+  { 0x6Au, 0.00470000 },
+  { 0x6Bu, 0.03020000 },
+  { 0x6Cu, 0.02950000 },
+  { 0x6Du, 0.03180000 },
+  { 0x6Eu, 0.09750000 },
+  { 0x6Fu, 0.07190000 },
+  { 0x70u, 0.01910000 },
+  { 0x72u, 0.05840000 },
+  { 0x73u, 0.03730000 },
+  { 0x74u, 0.04910000 },
+  { 0x75u, 0.05220000 },
+  { 0x76u, 0.00540000 },
+  { 0x77u, 0.02310000 },
+  { 0x79u, 0.01890000 },
+  { 0x7Au, 0.00290000 },
+  { 0x1E45u, 0.00000000 },
+  { 0x1EB9u, 0.00060000 },
+  { 0x1ECBu, 0.00200000 },
+  { 0x1ECDu, 0.00420000 },
+  { 0x1EE5u, 0.00420000 },
+};
+
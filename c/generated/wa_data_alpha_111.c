@@ -0,0 +1,4827 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_111_UPPER[] = {
+  "ꀀ",
+  "ꀁ",
+  "ꀂ",
+  "ꀃ",
+  "ꀄ",
+  "ꀅ",
+  "ꀆ",
+  "ꀇ",
+  "ꀈ",
+  "ꀉ",
+  "ꀊ",
+  "ꀋ",
+  "ꀌ",
+  "ꀍ",
+  "ꀎ",
+  "ꀏ",
+  "ꀐ",
+  "ꀑ",
+  "ꀒ",
+  "ꀓ",
+  "ꀔ",
+  "ꀕ",
+  "ꀖ",
+  "ꀗ",
+  "ꀘ",
+  "ꀙ",
+  "ꀚ",
+  "ꀛ",
+  "ꀜ",
+  "ꀝ",
+  "ꀞ",
+  "ꀟ",
+  "ꀠ",
+  "ꀡ",
+  "ꀢ",
+  "ꀣ",
+  "ꀤ",
+  "ꀥ",
+  "ꀦ",
+  "ꀧ",
+  "ꀨ",
+  "ꀩ",
+  "ꀪ",
+  "ꀫ",
+  "ꀬ",
+  "ꀭ",
+  "ꀮ",
+  "ꀯ",
+  "ꀰ",
+  "ꀱ",
+  "ꀲ",
+  "ꀳ",
+  "ꀴ",
+  "ꀵ",
+  "ꀶ",
+  "ꀷ",
+  "ꀸ",
+  "ꀹ",
+  "ꀺ",
+  "ꀻ",
+  "ꀼ",
+  "ꀽ",
+  "ꀾ",
+  "ꀿ",
+  "ꁀ",
+  "ꁁ",
+  "ꁂ",
+  "ꁃ",
+  "ꁄ",
+  "ꁅ",
+  "ꁆ",
+  "ꁇ",
+  "ꁈ",
+  "ꁉ",
+  "ꁊ",
+  "ꁋ",
+  "ꁌ",
+  "ꁍ",
+  "ꁎ",
+  "ꁏ",
+  "ꁐ",
+  "ꁑ",
+  "ꁒ",
+  "ꁓ",
+  "ꁔ",
+  "ꁕ",
+  "ꁖ",
+  "ꁗ",
+  "ꁘ",
+  "ꁙ",
+  "ꁚ",
+  "ꁛ",
+  "ꁜ",
+  "ꁝ",
+  "ꁞ",
+  "ꁟ",
+  "ꁠ",
+  "ꁡ",
+  "ꁢ",
+  "ꁣ",
+  "ꁤ",
+  "ꁥ",
+  "ꁦ",
+  "ꁧ",
+  "ꁨ",
+  "ꁩ",
+  "ꁪ",
+  "ꁫ",
+  "ꁬ",
+  "ꁭ",
+  "ꁮ",
+  "ꁯ",
+  "ꁰ",
+  "ꁱ",
+  "ꁲ",
+  "ꁳ",
+  "ꁴ",
+  "ꁵ",
+  "ꁶ",
+  "ꁷ",
+  "ꁸ",
+  "ꁹ",
+  "ꁺ",
+  "ꁻ",
+  "ꁼ",
+  "ꁽ",
+  "ꁾ",
+  "ꁿ",
+  "ꂀ",
+  "ꂁ",
+  "ꂂ",
+  "ꂃ",
+  "ꂄ",
+  "ꂅ",
+  "ꂆ",
+  "ꂇ",
+  "ꂈ",
+  "ꂉ",
+  "ꂊ",
+  "ꂋ",
+  "ꂌ",
+  "ꂍ",
+  "ꂎ",
+  "ꂏ",
+  "ꂐ",
+  "ꂑ",
+  "ꂒ",
+  "ꂓ",
+  "ꂔ",
+  "ꂕ",
+  "ꂖ",
+  "ꂗ",
+  "ꂘ",
+  "ꂙ",
+  "ꂚ",
+  "ꂛ",
+  "ꂜ",
+  "ꂝ",
+  "ꂞ",
+  "ꂟ",
+  "ꂠ",
+  "ꂡ",
+  "ꂢ",
+  "ꂣ",
+  "ꂤ",
+  "ꂥ",
+  "ꂦ",
+  "ꂧ",
+  "ꂨ",
+  "ꂩ",
+  "ꂪ",
+  "ꂫ",
+  "ꂬ",
+  "ꂭ",
+  "ꂮ",
+  "ꂯ",
+  "ꂰ",
+  "ꂱ",
+  "ꂲ",
+  "ꂳ",
+  "ꂴ",
+  "ꂵ",
+  "ꂶ",
+  "ꂷ",
+  "ꂸ",
+  "ꂹ",
+  "ꂺ",
+  "ꂻ",
+  "ꂼ",
+  "ꂽ",
+  "ꂾ",
+  "ꂿ",
+  "ꃀ",
+  "ꃁ",
+  "ꃂ",
+  "ꃃ",
+  "ꃄ",
+  "ꃅ",
+  "ꃆ",
+  "ꃇ",
+  "ꃈ",
+  "ꃉ",
+  "ꃊ",
+  "ꃋ",
+  "ꃌ",
+  "ꃍ",
+  "ꃎ",
+  "ꃏ",
+  "ꃐ",
+  "ꃑ",
+  "ꃒ",
+  "ꃓ",
+  "ꃔ",
+  "ꃕ",
+  "ꃖ",
+  "ꃗ",
+  "ꃘ",
+  "ꃙ",
+  "ꃚ",
+  "ꃛ",
+  "ꃜ",
+  "ꃝ",
+  "ꃞ",
+  "ꃟ",
+  "ꃠ",
+  "ꃡ",
+  "ꃢ",
+  "ꃣ",
+  "ꃤ",
+  "ꃥ",
+  "ꃦ",
+  "ꃧ",
+  "ꃨ",
+  "ꃩ",
+  "ꃪ",
+  "ꃫ",
+  "ꃬ",
+  "ꃭ",
+  "ꃮ",
+  "ꃯ",
+  "ꃰ",
+  "ꃱ",
+  "ꃲ",
+  "ꃳ",
+  "ꃴ",
+  "ꃵ",
+  "ꃶ",
+  "ꃷ",
+  "ꃸ",
+  "ꃹ",
+  "ꃺ",
+  "ꃻ",
+  "ꃼ",
+  "ꃽ",
+  "ꃾ",
+  "ꃿ",
+  "ꄀ",
+  "ꄁ",
+  "ꄂ",
+  "ꄃ",
+  "ꄄ",
+  "ꄅ",
+  "ꄆ",
+  "ꄇ",
+  "ꄈ",
+  "ꄉ",
+  "ꄊ",
+  "ꄋ",
+  "ꄌ",
+  "ꄍ",
+  "ꄎ",
+  "ꄏ",
+  "ꄐ",
+  "ꄑ",
+  "ꄒ",
+  "ꄓ",
+  "ꄔ",
+  "ꄕ",
+  "ꄖ",
+  "ꄗ",
+  "ꄘ",
+  "ꄙ",
+  "ꄚ",
+  "ꄛ",
+  "ꄜ",
+  "ꄝ",
+  "ꄞ",
+  "ꄟ",
+  "ꄠ",
+  "ꄡ",
+  "ꄢ",
+  "ꄣ",
+  "ꄤ",
+  "ꄥ",
+  "ꄦ",
+  "ꄧ",
+  "ꄨ",
+  "ꄩ",
+  "ꄪ",
+  "ꄫ",
+  "ꄬ",
+  "ꄭ",
+  "ꄮ",
+  "ꄯ",
+  "ꄰ",
+  "ꄱ",
+  "ꄲ",
+  "ꄳ",
+  "ꄴ",
+  "ꄵ",
+  "ꄶ",
+  "ꄷ",
+  "ꄸ",
+  "ꄹ",
+  "ꄺ",
+  "ꄻ",
+  "ꄼ",
+  "ꄽ",
+  "ꄾ",
+  "ꄿ",
+  "ꅀ",
+  "ꅁ",
+  "ꅂ",
+  "ꅃ",
+  "ꅄ",
+  "ꅅ",
+  "ꅆ",
+  "ꅇ",
+  "ꅈ",
+  "ꅉ",
+  "ꅊ",
+  "ꅋ",
+  "ꅌ",
+  "ꅍ",
+  "ꅎ",
+  "ꅏ",
+  "ꅐ",
+  "ꅑ",
+  "ꅒ",
+  "ꅓ",
+  "ꅔ",
+  "ꅕ",
+  "ꅖ",
+  "ꅗ",
+  "ꅘ",
+  "ꅙ",
+  "ꅚ",
+  "ꅛ",
+  "ꅜ",
+  "ꅝ",
+  "ꅞ",
+  "ꅟ",
+  "ꅠ",
+  "ꅡ",
+  "ꅢ",
+  "ꅣ",
+  "ꅤ",
+  "ꅥ",
+  "ꅦ",
+  "ꅧ",
+  "ꅨ",
+  "ꅩ",
+  "ꅪ",
+  "ꅫ",
+  "ꅬ",
+  "ꅭ",
+  "ꅮ",
+  "ꅯ",
+  "ꅰ",
+  "ꅱ",
+  "ꅲ",
+  "ꅳ",
+  "ꅴ",
+  "ꅵ",
+  "ꅶ",
+  "ꅷ",
+  "ꅸ",
+  "ꅹ",
+  "ꅺ",
+  "ꅻ",
+  "ꅼ",
+  "ꅽ",
+  "ꅾ",
+  "ꅿ",
+  "ꆀ",
+  "ꆁ",
+  "ꆂ",
+  "ꆃ",
+  "ꆄ",
+  "ꆅ",
+  "ꆆ",
+  "ꆇ",
+  "ꆈ",
+  "ꆉ",
+  "ꆊ",
+  "ꆋ",
+  "ꆌ",
+  "ꆍ",
+  "ꆎ",
+  "ꆏ",
+  "ꆐ",
+  "ꆑ",
+  "ꆒ",
+  "ꆓ",
+  "ꆔ",
+  "ꆕ",
+  "ꆖ",
+  "ꆗ",
+  "ꆘ",
+  "ꆙ",
+  "ꆚ",
+  "ꆛ",
+  "ꆜ",
+  "ꆝ",
+  "ꆞ",
+  "ꆟ",
+  "ꆠ",
+  "ꆡ",
+  "ꆢ",
+  "ꆣ",
+  "ꆤ",
+  "ꆥ",
+  "ꆦ",
+  "ꆧ",
+  "ꆨ",
+  "ꆩ",
+  "ꆪ",
+  "ꆫ",
+  "ꆬ",
+  "ꆭ",
+  "ꆮ",
+  "ꆯ",
+  "ꆰ",
+  "ꆱ",
+  "ꆲ",
+  "ꆳ",
+  "ꆴ",
+  "ꆵ",
+  "ꆶ",
+  "ꆷ",
+  "ꆸ",
+  "ꆹ",
+  "ꆺ",
+  "ꆻ",
+  "ꆼ",
+  "ꆽ",
+  "ꆾ",
+  "ꆿ",
+  "ꇀ",
+  "ꇁ",
+  "ꇂ",
+  "ꇃ",
+  "ꇄ",
+  "ꇅ",
+  "ꇆ",
+  "ꇇ",
+  "ꇈ",
+  "ꇉ",
+  "ꇊ",
+  "ꇋ",
+  "ꇌ",
+  "ꇍ",
+  "ꇎ",
+  "ꇏ",
+  "ꇐ",
+  "ꇑ",
+  "ꇒ",
+  "ꇓ",
+  "ꇔ",
+  "ꇕ",
+  "ꇖ",
+  "ꇗ",
+  "ꇘ",
+  "ꇙ",
+  "ꇚ",
+  "ꇛ",
+  "ꇜ",
+  "ꇝ",
+  "ꇞ",
+  "ꇟ",
+  "ꇠ",
+  "ꇡ",
+  "ꇢ",
+  "ꇣ",
+  "ꇤ",
+  "ꇥ",
+  "ꇦ",
+  "ꇧ",
+  "ꇨ",
+  "ꇩ",
+  "ꇪ",
+  "ꇫ",
+  "ꇬ",
+  "ꇭ",
+  "ꇮ",
+  "ꇯ",
+  "ꇰ",
+  "ꇱ",
+  "ꇲ",
+  "ꇳ",
+  "ꇴ",
+  "ꇵ",
+  "ꇶ",
+  "ꇷ",
+  "ꇸ",
+  "ꇹ",
+  "ꇺ",
+  "ꇻ",
+  "ꇼ",
+  "ꇽ",
+  "ꇾ",
+  "ꇿ",
+  "ꈀ",
+  "ꈁ",
+  "ꈂ",
+  "ꈃ",
+  "ꈄ",
+  "ꈅ",
+  "ꈆ",
+  "ꈇ",
+  "ꈈ",
+  "ꈉ",
+  "ꈊ",
+  "ꈋ",
+  "ꈌ",
+  "ꈍ",
+  "ꈎ",
+  "ꈏ",
+  "ꈐ",
+  "ꈑ",
+  "ꈒ",
+  "ꈓ",
+  "ꈔ",
+  "ꈕ",
+  "ꈖ",
+  "ꈗ",
+  "ꈘ",
+  "ꈙ",
+  "ꈚ",
+  "ꈛ",
+  "ꈜ",
+  "ꈝ",
+  "ꈞ",
+  "ꈟ",
+  "ꈠ",
+  "ꈡ",
+  "ꈢ",
+  "ꈣ",
+  "ꈤ",
+  "ꈥ",
+  "ꈦ",
+  "ꈧ",
+  "ꈨ",
+  "ꈩ",
+  "ꈪ",
+  "ꈫ",
+  "ꈬ",
+  "ꈭ",
+  "ꈮ",
+  "ꈯ",
+  "ꈰ",
+  "ꈱ",
+  "ꈲ",
+  "ꈳ",
+  "ꈴ",
+  "ꈵ",
+  "ꈶ",
+  "ꈷ",
+  "ꈸ",
+  "ꈹ",
+  "ꈺ",
+  "ꈻ",
+  "ꈼ",
+  "ꈽ",
+  "ꈾ",
+  "ꈿ",
+  "ꉀ",
+  "ꉁ",
+  "ꉂ",
+  "ꉃ",
+  "ꉄ",
+  "ꉅ",
+  "ꉆ",
+  "ꉇ",
+  "ꉈ",
+  "ꉉ",
+  "ꉊ",
+  "ꉋ",
+  "ꉌ",
+  "ꉍ",
+  "ꉎ",
+  "ꉏ",
+  "ꉐ",
+  "ꉑ",
+  "ꉒ",
+  "ꉓ",
+  "ꉔ",
+  "ꉕ",
+  "ꉖ",
+  "ꉗ",
+  "ꉘ",
+  "ꉙ",
+  "ꉚ",
+  "ꉛ",
+  "ꉜ",
+  "ꉝ",
+  "ꉞ",
+  "ꉟ",
+  "ꉠ",
+  "ꉡ",
+  "ꉢ",
+  "ꉣ",
+  "ꉤ",
+  "ꉥ",
+  "ꉦ",
+  "ꉧ",
+  "ꉨ",
+  "ꉩ",
+  "ꉪ",
+  "ꉫ",
+  "ꉬ",
+  "ꉭ",
+  "ꉮ",
+  "ꉯ",
+  "ꉰ",
+  "ꉱ",
+  "ꉲ",
+  "ꉳ",
+  "ꉴ",
+  "ꉵ",
+  "ꉶ",
+  "ꉷ",
+  "ꉸ",
+  "ꉹ",
+  "ꉺ",
+  "ꉻ",
+  "ꉼ",
+  "ꉽ",
+  "ꉾ",
+  "ꉿ",
+  "ꊀ",
+  "ꊁ",
+  "ꊂ",
+  "ꊃ",
+  "ꊄ",
+  "ꊅ",
+  "ꊆ",
+  "ꊇ",
+  "ꊈ",
+  "ꊉ",
+  "ꊊ",
+  "ꊋ",
+  "ꊌ",
+  "ꊍ",
+  "ꊎ",
+  "ꊏ",
+  "ꊐ",
+  "ꊑ",
+  "ꊒ",
+  "ꊓ",
+  "ꊔ",
+  "ꊕ",
+  "ꊖ",
+  "ꊗ",
+  "ꊘ",
+  "ꊙ",
+  "ꊚ",
+  "ꊛ",
+  "ꊜ",
+  "ꊝ",
+  "ꊞ",
+  "ꊟ",
+  "ꊠ",
+  "ꊡ",
+  "ꊢ",
+  "ꊣ",
+  "ꊤ",
+  "ꊥ",
+  "ꊦ",
+  "ꊧ",
+  "ꊨ",
+  "ꊩ",
+  "ꊪ",
+  "ꊫ",
+  "ꊬ",
+  "ꊭ",
+  "ꊮ",
+  "ꊯ",
+  "ꊰ",
+  "ꊱ",
+  "ꊲ",
+  "ꊳ",
+  "ꊴ",
+  "ꊵ",
+  "ꊶ",
+  "ꊷ",
+  "ꊸ",
+  "ꊹ",
+  "ꊺ",
+  "ꊻ",
+  "ꊼ",
+  "ꊽ",
+  "ꊾ",
+  "ꊿ",
+  "ꋀ",
+  "ꋁ",
+  "ꋂ",
+  "ꋃ",
+  "ꋄ",
+  "ꋅ",
+  "ꋆ",
+  "ꋇ",
+  "ꋈ",
+  "ꋉ",
+  "ꋊ",
+  "ꋋ",
+  "ꋌ",
+  "ꋍ",
+  "ꋎ",
+  "ꋏ",
+  "ꋐ",
+  "ꋑ",
+  "ꋒ",
+  "ꋓ",
+  "ꋔ",
+  "ꋕ",
+  "ꋖ",
+  "ꋗ",
+  "ꋘ",
+  "ꋙ",
+  "ꋚ",
+  "ꋛ",
+  "ꋜ",
+  "ꋝ",
+  "ꋞ",
+  "ꋟ",
+  "ꋠ",
+  "ꋡ",
+  "ꋢ",
+  "ꋣ",
+  "ꋤ",
+  "ꋥ",
+  "ꋦ",
+  "ꋧ",
+  "ꋨ",
+  "ꋩ",
+  "ꋪ",
+  "ꋫ",
+  "ꋬ",
+  "ꋭ",
+  "ꋮ",
+  "ꋯ",
+  "ꋰ",
+  "ꋱ",
+  "ꋲ",
+  "ꋳ",
+  "ꋴ",
+  "ꋵ",
+  "ꋶ",
+  "ꋷ",
+  "ꋸ",
+  "ꋹ",
+  "ꋺ",
+  "ꋻ",
+  "ꋼ",
+  "ꋽ",
+  "ꋾ",
+  "ꋿ",
+  "ꌀ",
+  "ꌁ",
+  "ꌂ",
+  "ꌃ",
+  "ꌄ",
+  "ꌅ",
+  "ꌆ",
+  "ꌇ",
+  "ꌈ",
+  "ꌉ",
+  "ꌊ",
+  "ꌋ",
+  "ꌌ",
+  "ꌍ",
+  "ꌎ",
+  "ꌏ",
+  "ꌐ",
+  "ꌑ",
+  "ꌒ",
+  "ꌓ",
+  "ꌔ",
+  "ꌕ",
+  "ꌖ",
+  "ꌗ",
+  "ꌘ",
+  "ꌙ",
+  "ꌚ",
+  "ꌛ",
+  "ꌜ",
+  "ꌝ",
+  "ꌞ",
+  "ꌟ",
+  "ꌠ",
+  "ꌡ",
+  "ꌢ",
+  "ꌣ",
+  "ꌤ",
+  "ꌥ",
+  "ꌦ",
+  "ꌧ",
+  "ꌨ",
+  "ꌩ",
+  "ꌪ",
+  "ꌫ",
+  "ꌬ",
+  "ꌭ",
+  "ꌮ",
+  "ꌯ",
+  "ꌰ",
+  "ꌱ",
+  "ꌲ",
+  "ꌳ",
+  "ꌴ",
+  "ꌵ",
+  "ꌶ",
+  "ꌷ",
+  "ꌸ",
+  "ꌹ",
+  "ꌺ",
+  "ꌻ",
+  "ꌼ",
+  "ꌽ",
+  "ꌾ",
+  "ꌿ",
+  "ꍀ",
+  "ꍁ",
+  "ꍂ",
+  "ꍃ",
+  "ꍄ",
+  "ꍅ",
+  "ꍆ",
+  "ꍇ",
+  "ꍈ",
+  "ꍉ",
+  "ꍊ",
+  "ꍋ",
+  "ꍌ",
+  "ꍍ",
+  "ꍎ",
+  "ꍏ",
+  "ꍐ",
+  "ꍑ",
+  "ꍒ",
+  "ꍓ",
+  "ꍔ",
+  "ꍕ",
+  "ꍖ",
+  "ꍗ",
+  "ꍘ",
+  "ꍙ",
+  "ꍚ",
+  "ꍛ",
+  "ꍜ",
+  "ꍝ",
+  "ꍞ",
+  "ꍟ",
+  "ꍠ",
+  "ꍡ",
+  "ꍢ",
+  "ꍣ",
+  "ꍤ",
+  "ꍥ",
+  "ꍦ",
+  "ꍧ",
+  "ꍨ",
+  "ꍩ",
+  "ꍪ",
+  "ꍫ",
+  "ꍬ",
+  "ꍭ",
+  "ꍮ",
+  "ꍯ",
+  "ꍰ",
+  "ꍱ",
+  "ꍲ",
+  "ꍳ",
+  "ꍴ",
+  "ꍵ",
+  "ꍶ",
+  "ꍷ",
+  "ꍸ",
+  "ꍹ",
+  "ꍺ",
+  "ꍻ",
+  "ꍼ",
+  "ꍽ",
+  "ꍾ",
+  "ꍿ",
+  "ꎀ",
+  "ꎁ",
+  "ꎂ",
+  "ꎃ",
+  "ꎄ",
+  "ꎅ",
+  "ꎆ",
+  "ꎇ",
+  "ꎈ",
+  "ꎉ",
+  "ꎊ",
+  "ꎋ",
+  "ꎌ",
+  "ꎍ",
+  "ꎎ",
+  "ꎏ",
+  "ꎐ",
+  "ꎑ",
+  "ꎒ",
+  "ꎓ",
+  "ꎔ",
+  "ꎕ",
+  "ꎖ",
+  "ꎗ",
+  "ꎘ",
+  "ꎙ",
+  "ꎚ",
+  "ꎛ",
+  "ꎜ",
+  "ꎝ",
+  "ꎞ",
+  "ꎟ",
+  "ꎠ",
+  "ꎡ",
+  "ꎢ",
+  "ꎣ",
+  "ꎤ",
+  "ꎥ",
+  "ꎦ",
+  "ꎧ",
+  "ꎨ",
+  "ꎩ",
+  "ꎪ",
+  "ꎫ",
+  "ꎬ",
+  "ꎭ",
+  "ꎮ",
+  "ꎯ",
+  "ꎰ",
+  "ꎱ",
+  "ꎲ",
+  "ꎳ",
+  "ꎴ",
+  "ꎵ",
+  "ꎶ",
+  "ꎷ",
+  "ꎸ",
+  "ꎹ",
+  "ꎺ",
+  "ꎻ",
+  "ꎼ",
+  "ꎽ",
+  "ꎾ",
+  "ꎿ",
+  "ꏀ",
+  "ꏁ",
+  "ꏂ",
+  "ꏃ",
+  "ꏄ",
+  "ꏅ",
+  "ꏆ",
+  "ꏇ",
+  "ꏈ",
+  "ꏉ",
+  "ꏊ",
+  "ꏋ",
+  "ꏌ",
+  "ꏍ",
+  "ꏎ",
+  "ꏏ",
+  "ꏐ",
+  "ꏑ",
+  "ꏒ",
+  "ꏓ",
+  "ꏔ",
+  "ꏕ",
+  "ꏖ",
+  "ꏗ",
+  "ꏘ",
+  "ꏙ",
+  "ꏚ",
+  "ꏛ",
+  "ꏜ",
+  "ꏝ",
+  "ꏞ",
+  "ꏟ",
+  "ꏠ",
+  "ꏡ",
+  "ꏢ",
+  "ꏣ",
+  "ꏤ",
+  "ꏥ",
+  "ꏦ",
+  "ꏧ",
+  "ꏨ",
+  "ꏩ",
+  "ꏪ",
+  "ꏫ",
+  "ꏬ",
+  "ꏭ",
+  "ꏮ",
+  "ꏯ",
+  "ꏰ",
+  "ꏱ",
+  "ꏲ",
+  "ꏳ",
+  "ꏴ",
+  "ꏵ",
+  "ꏶ",
+  "ꏷ",
+  "ꏸ",
+  "ꏹ",
+  "ꏺ",
+  "ꏻ",
+  "ꏼ",
+  "ꏽ",
+  "ꏾ",
+  "ꏿ",
+  "ꐀ",
+  "ꐁ",
+  "ꐂ",
+  "ꐃ",
+  "ꐄ",
+  "ꐅ",
+  "ꐆ",
+  "ꐇ",
+  "ꐈ",
+  "ꐉ",
+  "ꐊ",
+  "ꐋ",
+  "ꐌ",
+  "ꐍ",
+  "ꐎ",
+  "ꐏ",
+  "ꐐ",
+  "ꐑ",
+  "ꐒ",
+  "ꐓ",
+  "ꐔ",
+  "ꐕ",
+  "ꐖ",
+  "ꐗ",
+  "ꐘ",
+  "ꐙ",
+  "ꐚ",
+  "ꐛ",
+  "ꐜ",
+  "ꐝ",
+  "ꐞ",
+  "ꐟ",
+  "ꐠ",
+  "ꐡ",
+  "ꐢ",
+  "ꐣ",
+  "ꐤ",
+  "ꐥ",
+  "ꐦ",
+  "ꐧ",
+  "ꐨ",
+  "ꐩ",
+  "ꐪ",
+  "ꐫ",
+  "ꐬ",
+  "ꐭ",
+  "ꐮ",
+  "ꐯ",
+  "ꐰ",
+  "ꐱ",
+  "ꐲ",
+  "ꐳ",
+  "ꐴ",
+  "ꐵ",
+  "ꐶ",
+  "ꐷ",
+  "ꐸ",
+  "ꐹ",
+  "ꐺ",
+  "ꐻ",
+  "ꐼ",
+  "ꐽ",
+  "ꐾ",
+  "ꐿ",
+  "ꑀ",
+  "ꑁ",
+  "ꑂ",
+  "ꑃ",
+  "ꑄ",
+  "ꑅ",
+  "ꑆ",
+  "ꑇ",
+  "ꑈ",
+  "ꑉ",
+  "ꑊ",
+  "ꑋ",
+  "ꑌ",
+  "ꑍ",
+  "ꑎ",
+  "ꑏ",
+  "ꑐ",
+  "ꑑ",
+  "ꑒ",
+  "ꑓ",
+  "ꑔ",
+  "ꑕ",
+  "ꑖ",
+  "ꑗ",
+  "ꑘ",
+  "ꑙ",
+  "ꑚ",
+  "ꑛ",
+  "ꑜ",
+  "ꑝ",
+  "ꑞ",
+  "ꑟ",
+  "ꑠ",
+  "ꑡ",
+  "ꑢ",
+  "ꑣ",
+  "ꑤ",
+  "ꑥ",
+  "ꑦ",
+  "ꑧ",
+  "ꑨ",
+  "ꑩ",
+  "ꑪ",
+  "ꑫ",
+  "ꑬ",
+  "ꑭ",
+  "ꑮ",
+  "ꑯ",
+  "ꑰ",
+  "ꑱ",
+  "ꑲ",
+  "ꑳ",
+  "ꑴ",
+  "ꑵ",
+  "ꑶ",
+  "ꑷ",
+  "ꑸ",
+  "ꑹ",
+  "ꑺ",
+  "ꑻ",
+  "ꑼ",
+  "ꑽ",
+  "ꑾ",
+  "ꑿ",
+  "ꒀ",
+  "ꒁ",
+  "ꒂ",
+  "ꒃ",
+  "ꒄ",
+  "ꒅ",
+  "ꒆ",
+  "ꒇ",
+  "ꒈ",
+  "ꒉ",
+  "ꒊ",
+  "ꒋ",
+  "ꒌ",
+};
+const char *ALPHA_111_LOWER[] = {
+  "ꀀ",
+  "ꀁ",
+  "ꀂ",
+  "ꀃ",
+  "ꀄ",
+  "ꀅ",
+  "ꀆ",
+  "ꀇ",
+  "ꀈ",
+  "ꀉ",
+  "ꀊ",
+  "ꀋ",
+  "ꀌ",
+  "ꀍ",
+  "ꀎ",
+  "ꀏ",
+  "ꀐ",
+  "ꀑ",
+  "ꀒ",
+  "ꀓ",
+  "ꀔ",
+  "ꀕ",
+  "ꀖ",
+  "ꀗ",
+  "ꀘ",
+  "ꀙ",
+  "ꀚ",
+  "ꀛ",
+  "ꀜ",
+  "ꀝ",
+  "ꀞ",
+  "ꀟ",
+  "ꀠ",
+  "ꀡ",
+  "ꀢ",
+  "ꀣ",
+  "ꀤ",
+  "ꀥ",
+  "ꀦ",
+  "ꀧ",
+  "ꀨ",
+  "ꀩ",
+  "ꀪ",
+  "ꀫ",
+  "ꀬ",
+  "ꀭ",
+  "ꀮ",
+  "ꀯ",
+  "ꀰ",
+  "ꀱ",
+  "ꀲ",
+  "ꀳ",
+  "ꀴ",
+  "ꀵ",
+  "ꀶ",
+  "ꀷ",
+  "ꀸ",
+  "ꀹ",
+  "ꀺ",
+  "ꀻ",
+  "ꀼ",
+  "ꀽ",
+  "ꀾ",
+  "ꀿ",
+  "ꁀ",
+  "ꁁ",
+  "ꁂ",
+  "ꁃ",
+  "ꁄ",
+  "ꁅ",
+  "ꁆ",
+  "ꁇ",
+  "ꁈ",
+  "ꁉ",
+  "ꁊ",
+  "ꁋ",
+  "ꁌ",
+  "ꁍ",
+  "ꁎ",
+  "ꁏ",
+  "ꁐ",
+  "ꁑ",
+  "ꁒ",
+  "ꁓ",
+  "ꁔ",
+  "ꁕ",
+  "ꁖ",
+  "ꁗ",
+  "ꁘ",
+  "ꁙ",
+  "ꁚ",
+  "ꁛ",
+  "ꁜ",
+  "ꁝ",
+  "ꁞ",
+  "ꁟ",
+  "ꁠ",
+  "ꁡ",
+  "ꁢ",
+  "ꁣ",
+  "ꁤ",
+  "ꁥ",
+  "ꁦ",
+  "ꁧ",
+  "ꁨ",
+  "ꁩ",
+  "ꁪ",
+  "ꁫ",
+  "ꁬ",
+  "ꁭ",
+  "ꁮ",
+  "ꁯ",
+  "ꁰ",
+  "ꁱ",
+  "ꁲ",
+  "ꁳ",
+  "ꁴ",
+  "ꁵ",
+  "ꁶ",
+  "ꁷ",
+  "ꁸ",
+  "ꁹ",
+  "ꁺ",
+  "ꁻ",
+  "ꁼ",
+  "ꁽ",
+  "ꁾ",
+  "ꁿ",
+  "ꂀ",
+  "ꂁ",
+  "ꂂ",
+  "ꂃ",
+  "ꂄ",
+  "ꂅ",
+  "ꂆ",
+  "ꂇ",
+  "ꂈ",
+  "ꂉ",
+  "ꂊ",
+  "ꂋ",
+  "ꂌ",
+  "ꂍ",
+  "ꂎ",
+  "ꂏ",
+  "ꂐ",
+  "ꂑ",
+  "ꂒ",
+  "ꂓ",
+  "ꂔ",
+  "ꂕ",
+  "ꂖ",
+  "ꂗ",
+  "ꂘ",
+  "ꂙ",
+  "ꂚ",
+  "ꂛ",
+  "ꂜ",
+  "ꂝ",
+  "ꂞ",
+  "ꂟ",
+  "ꂠ",
+  "ꂡ",
+  "ꂢ",
+  "ꂣ",
+  "ꂤ",
+  "ꂥ",
+  "ꂦ",
+  "ꂧ",
+  "ꂨ",
+  "ꂩ",
+  "ꂪ",
+  "ꂫ",
+  "ꂬ",
+  "ꂭ",
+  "ꂮ",
+  "ꂯ",
+  "ꂰ",
+  "ꂱ",
+  "ꂲ",
+  "ꂳ",
+  "ꂴ",
+  "ꂵ",
+  "ꂶ",
+  "ꂷ",
+  "ꂸ",
+  "ꂹ",
+  "ꂺ",
+  "ꂻ",
+  "ꂼ",
+  "ꂽ",
+  "ꂾ",
+  "ꂿ",
+  "ꃀ",
+  "ꃁ",
+  "ꃂ",
+  "ꃃ",
+  "ꃄ",
+  "ꃅ",
+  "ꃆ",
+  "ꃇ",
+  "ꃈ",
+  "ꃉ",
+  "ꃊ",
+  "ꃋ",
+  "ꃌ",
+  "ꃍ",
+  "ꃎ",
+  "ꃏ",
+  "ꃐ",
+  "ꃑ",
+  "ꃒ",
+  "ꃓ",
+  "ꃔ",
+  "ꃕ",
+  "ꃖ",
+  "ꃗ",
+  "ꃘ",
+  "ꃙ",
+  "ꃚ",
+  "ꃛ",
+  "ꃜ",
+  "ꃝ",
+  "ꃞ",
+  "ꃟ",
+  "ꃠ",
+  "ꃡ",
+  "ꃢ",
+  "ꃣ",
+  "ꃤ",
+  "ꃥ",
+  "ꃦ",
+  "ꃧ",
+  "ꃨ",
+  "ꃩ",
+  "ꃪ",
+  "ꃫ",
+  "ꃬ",
+  "ꃭ",
+  "ꃮ",
+  "ꃯ",
+  "ꃰ",
+  "ꃱ",
+  "ꃲ",
+  "ꃳ",
+  "ꃴ",
+  "ꃵ",
+  "ꃶ",
+  "ꃷ",
+  "ꃸ",
+  "ꃹ",
+  "ꃺ",
+  "ꃻ",
+  "ꃼ",
+  "ꃽ",
+  "ꃾ",
+  "ꃿ",
+  "ꄀ",
+  "ꄁ",
+  "ꄂ",
+  "ꄃ",
+  "ꄄ",
+  "ꄅ",
+  "ꄆ",
+  "ꄇ",
+  "ꄈ",
+  "ꄉ",
+  "ꄊ",
+  "ꄋ",
+  "ꄌ",
+  "ꄍ",
+  "ꄎ",
+  "ꄏ",
+  "ꄐ",
+  "ꄑ",
+  "ꄒ",
+  "ꄓ",
+  "ꄔ",
+  "ꄕ",
+  "ꄖ",
+  "ꄗ",
+  "ꄘ",
+  "ꄙ",
+  "ꄚ",
+  "ꄛ",
+  "ꄜ",
+  "ꄝ",
+  "ꄞ",
+  "ꄟ",
+  "ꄠ",
+  "ꄡ",
+  "ꄢ",
+  "ꄣ",
+  "ꄤ",
+  "ꄥ",
+  "ꄦ",
+  "ꄧ",
+  "ꄨ",
+  "ꄩ",
+  "ꄪ",
+  "ꄫ",
+  "ꄬ",
+  "ꄭ",
+  "ꄮ",
+  "ꄯ",
+  "ꄰ",
+  "ꄱ",
+  "ꄲ",
+  "ꄳ",
+  "ꄴ",
+  "ꄵ",
+  "ꄶ",
+  "ꄷ",
+  "ꄸ",
+  "ꄹ",
+  "ꄺ",
+  "ꄻ",
+  "ꄼ",
+  "ꄽ",
+  "ꄾ",
+  "ꄿ",
+  "ꅀ",
+  "ꅁ",
+  "ꅂ",
+  "ꅃ",
+  "ꅄ",
+  "ꅅ",
+  "ꅆ",
+  "ꅇ",
+  "ꅈ",
+  "ꅉ",
+  "ꅊ",
+  "ꅋ",
+  "ꅌ",
+  "ꅍ",
+  "ꅎ",
+  "ꅏ",
+  "ꅐ",
+  "ꅑ",
+  "ꅒ",
+  "ꅓ",
+  "ꅔ",
+  "ꅕ",
+  "ꅖ",
+  "ꅗ",
+  "ꅘ",
+  "ꅙ",
+  "ꅚ",
+  "ꅛ",
+  "ꅜ",
+  "ꅝ",
+  "ꅞ",
+  "ꅟ",
+  "ꅠ",
+  "ꅡ",
+  "ꅢ",
+  "ꅣ",
+  "ꅤ",
+  "ꅥ",
+  "ꅦ",
+  "ꅧ",
+  "ꅨ",
+  "ꅩ",
+  "ꅪ",
+  "ꅫ",
+  "ꅬ",
+  "ꅭ",
+  "ꅮ",
+  "ꅯ",
+  "ꅰ",
+  "ꅱ",
+  "ꅲ",
+  "ꅳ",
+  "ꅴ",
+  "ꅵ",
+  "ꅶ",
+  "ꅷ",
+  "ꅸ",
+  "ꅹ",
+  "ꅺ",
+  "ꅻ",
+  "ꅼ",
+  "ꅽ",
+  "ꅾ",
+  "ꅿ",
+  "ꆀ",
+  "ꆁ",
+  "ꆂ",
+  "ꆃ",
+  "ꆄ",
+  "ꆅ",
+  "ꆆ",
+  "ꆇ",
+  "ꆈ",
+  "ꆉ",
+  "ꆊ",
+  "ꆋ",
+  "ꆌ",
+  "ꆍ",
+  "ꆎ",
+  "ꆏ",
+  "ꆐ",
+  "ꆑ",
+  "ꆒ",
+  "ꆓ",
+  "ꆔ",
+  "ꆕ",
+  "ꆖ",
+  "ꆗ",
+  "ꆘ",
+  "ꆙ",
+  "ꆚ",
+  "ꆛ",
+  "ꆜ",
+  "ꆝ",
+  "ꆞ",
+  "ꆟ",
+  "ꆠ",
+  "ꆡ",
+  "ꆢ",
+  "ꆣ",
+  "ꆤ",
+  "ꆥ",
+  "ꆦ",
+  "ꆧ",
+  "ꆨ",
+  "ꆩ",
+  "ꆪ",
+  "ꆫ",
+  "ꆬ",
+  "ꆭ",
+  "ꆮ",
+  "ꆯ",
+  "ꆰ",
+  "ꆱ",
+  "ꆲ",
+  "ꆳ",
+  "ꆴ",
+  "ꆵ",
+  "ꆶ",
+  "ꆷ",
+  "ꆸ",
+  "ꆹ",
+  "ꆺ",
+  "ꆻ",
+  "ꆼ",
+  "ꆽ",
+  "ꆾ",
+  "ꆿ",
+  "ꇀ",
+  "ꇁ",
+  "ꇂ",
+  "ꇃ",
+  "ꇄ",
+  "ꇅ",
+  "ꇆ",
+  "ꇇ",
+  "ꇈ",
+  "ꇉ",
+  "ꇊ",
+  "ꇋ",
+  "ꇌ",
+  "ꇍ",
+  "ꇎ",
+  "ꇏ",
+  "ꇐ",
+  "ꇑ",
+  "ꇒ",
+  "ꇓ",
+  "ꇔ",
+  "ꇕ",
+  "ꇖ",
+  "ꇗ",
+  "ꇘ",
+  "ꇙ",
+  "ꇚ",
+  "ꇛ",
+  "ꇜ",
+  "ꇝ",
+  "ꇞ",
+  "ꇟ",
+  "ꇠ",
+  "ꇡ",
+  "ꇢ",
+  "ꇣ",
+  "ꇤ",
+  "ꇥ",
+  "ꇦ",
+  "ꇧ",
+  "ꇨ",
+  "ꇩ",
+  "ꇪ",
+  "ꇫ",
+  "ꇬ",
+  "ꇭ",
+  "ꇮ",
+  "ꇯ",
+  "ꇰ",
+  "ꇱ",
+  "ꇲ",
+  "ꇳ",
+  "ꇴ",
+  "ꇵ",
+  "ꇶ",
+  "ꇷ",
+  "ꇸ",
+  "ꇹ",
+  "ꇺ",
+  "ꇻ",
+  "ꇼ",
+  "ꇽ",
+  "ꇾ",
+  "ꇿ",
+  "ꈀ",
+  "ꈁ",
+  "ꈂ",
+  "ꈃ",
+  "ꈄ",
+  "ꈅ",
+  "ꈆ",
+  "ꈇ",
+  "ꈈ",
+  "ꈉ",
+  "ꈊ",
+  "ꈋ",
+  "ꈌ",
+  "ꈍ",
+  "ꈎ",
+  "ꈏ",
+  "ꈐ",
+  "ꈑ",
+  "ꈒ",
+  "ꈓ",
+  "ꈔ",
+  "ꈕ",
+  "ꈖ",
+  "ꈗ",
+  "ꈘ",
+  "ꈙ",
+  "ꈚ",
+  "ꈛ",
+  "ꈜ",
+  "ꈝ",
+  "ꈞ",
+  "ꈟ",
+  "ꈠ",
+  "ꈡ",
+  "ꈢ",
+  "ꈣ",
+  "ꈤ",
+  "ꈥ",
+  "ꈦ",
+  "ꈧ",
+  "ꈨ",
+  "ꈩ",
+  "ꈪ",
+  "ꈫ",
+  "ꈬ",
+  "ꈭ",
+  "ꈮ",
+  "ꈯ",
+  "ꈰ",
+  "ꈱ",
+  "ꈲ",
+  "ꈳ",
+  "ꈴ",
+  "ꈵ",
+  "ꈶ",
+  "ꈷ",
+  "ꈸ",
+  "ꈹ",
+  "ꈺ",
+  "ꈻ",
+  "ꈼ",
+  "ꈽ",
+  "ꈾ",
+  "ꈿ",
+  "ꉀ",
+  "ꉁ",
+  "ꉂ",
+  "ꉃ",
+  "ꉄ",
+  "ꉅ",
+  "ꉆ",
+  "ꉇ",
+  "ꉈ",
+  "ꉉ",
+  "ꉊ",
+  "ꉋ",
+  "ꉌ",
+  "ꉍ",
+  "ꉎ",
+  "ꉏ",
+  "ꉐ",
+  "ꉑ",
+  "ꉒ",
+  "ꉓ",
+  "ꉔ",
+  "ꉕ",
+  "ꉖ",
+  "ꉗ",
+  "ꉘ",
+  "ꉙ",
+  "ꉚ",
+  "ꉛ",
+  "ꉜ",
+  "ꉝ",
+  "ꉞ",
+  "ꉟ",
+  "ꉠ",
+  "ꉡ",
+  "ꉢ",
+  "ꉣ",
+  "ꉤ",
+  "ꉥ",
+  "ꉦ",
+  "ꉧ",
+  "ꉨ",
+  "ꉩ",
+  "ꉪ",
+  "ꉫ",
+  "ꉬ",
+  "ꉭ",
+  "ꉮ",
+  "ꉯ",
+  "ꉰ",
+  "ꉱ",
+  "ꉲ",
+  "ꉳ",
+  "ꉴ",
+  "ꉵ",
+  "ꉶ",
+  "ꉷ",
+  "ꉸ",
+  "ꉹ",
+  "ꉺ",
+  "ꉻ",
+  "ꉼ",
+  "ꉽ",
+  "ꉾ",
+  "ꉿ",
+  "ꊀ",
+  "ꊁ",
+  "ꊂ",
+  "ꊃ",
+  "ꊄ",
+  "ꊅ",
+  "ꊆ",
+  "ꊇ",
+  "ꊈ",
+  "ꊉ",
+  "ꊊ",
+  "ꊋ",
+  "ꊌ",
+  "ꊍ",
+  "ꊎ",
+  "ꊏ",
+  "ꊐ",
+  "ꊑ",
+  "ꊒ",
+  "ꊓ",
+  "ꊔ",
+  "ꊕ",
+  "ꊖ",
+  "ꊗ",
+  "ꊘ",
+  "ꊙ",
+  "ꊚ",
+  "ꊛ",
+  "ꊜ",
+  "ꊝ",
+  "ꊞ",
+  "ꊟ",
+  "ꊠ",
+  "ꊡ",
+  "ꊢ",
+  "ꊣ",
+  "ꊤ",
+  "ꊥ",
+  "ꊦ",
+  "ꊧ",
+  "ꊨ",
+  "ꊩ",
+  "ꊪ",
+  "ꊫ",
+  "ꊬ",
+  "ꊭ",
+  "ꊮ",
+  "ꊯ",
+  "ꊰ",
+  "ꊱ",
+  "ꊲ",
+  "ꊳ",
+  "ꊴ",
+  "ꊵ",
+  "ꊶ",
+  "ꊷ",
+  "ꊸ",
+  "ꊹ",
+  "ꊺ",
+  "ꊻ",
+  "ꊼ",
+  "ꊽ",
+  "ꊾ",
+  "ꊿ",
+  "ꋀ",
+  "ꋁ",
+  "ꋂ",
+  "ꋃ",
+  "ꋄ",
+  "ꋅ",
+  "ꋆ",
+  "ꋇ",
+  "ꋈ",
+  "ꋉ",
+  "ꋊ",
+  "ꋋ",
+  "ꋌ",
+  "ꋍ",
+  "ꋎ",
+  "ꋏ",
+  "ꋐ",
+  "ꋑ",
+  "ꋒ",
+  "ꋓ",
+  "ꋔ",
+  "ꋕ",
+  "ꋖ",
+  "ꋗ",
+  "ꋘ",
+  "ꋙ",
+  "ꋚ",
+  "ꋛ",
+  "ꋜ",
+  "ꋝ",
+  "ꋞ",
+  "ꋟ",
+  "ꋠ",
+  "ꋡ",
+  "ꋢ",
+  "ꋣ",
+  "ꋤ",
+  "ꋥ",
+  "ꋦ",
+  "ꋧ",
+  "ꋨ",
+  "ꋩ",
+  "ꋪ",
+  "ꋫ",
+  "ꋬ",
+  "ꋭ",
+  "ꋮ",
+  "ꋯ",
+  "ꋰ",
+  "ꋱ",
+  "ꋲ",
+  "ꋳ",
+  "ꋴ",
+  "ꋵ",
+  "ꋶ",
+  "ꋷ",
+  "ꋸ",
+  "ꋹ",
+  "ꋺ",
+  "ꋻ",
+  "ꋼ",
+  "ꋽ",
+  "ꋾ",
+  "ꋿ",
+  "ꌀ",
+  "ꌁ",
+  "ꌂ",
+  "ꌃ",
+  "ꌄ",
+  "ꌅ",
+  "ꌆ",
+  "ꌇ",
+  "ꌈ",
+  "ꌉ",
+  "ꌊ",
+  "ꌋ",
+  "ꌌ",
+  "ꌍ",
+  "ꌎ",
+  "ꌏ",
+  "ꌐ",
+  "ꌑ",
+  "ꌒ",
+  "ꌓ",
+  "ꌔ",
+  "ꌕ",
+  "ꌖ",
+  "ꌗ",
+  "ꌘ",
+  "ꌙ",
+  "ꌚ",
+  "ꌛ",
+  "ꌜ",
+  "ꌝ",
+  "ꌞ",
+  "ꌟ",
+  "ꌠ",
+  "ꌡ",
+  "ꌢ",
+  "ꌣ",
+  "ꌤ",
+  "ꌥ",
+  "ꌦ",
+  "ꌧ",
+  "ꌨ",
+  "ꌩ",
+  "ꌪ",
+  "ꌫ",
+  "ꌬ",
+  "ꌭ",
+  "ꌮ",
+  "ꌯ",
+  "ꌰ",
+  "ꌱ",
+  "ꌲ",
+  "ꌳ",
+  "ꌴ",
+  "ꌵ",
+  "ꌶ",
+  "ꌷ",
+  "ꌸ",
+  "ꌹ",
+  "ꌺ",
+  "ꌻ",
+  "ꌼ",
+  "ꌽ",
+  "ꌾ",
+  "ꌿ",
+  "ꍀ",
+  "ꍁ",
+  "ꍂ",
+  "ꍃ",
+  "ꍄ",
+  "ꍅ",
+  "ꍆ",
+  "ꍇ",
+  "ꍈ",
+  "ꍉ",
+  "ꍊ",
+  "ꍋ",
+  "ꍌ",
+  "ꍍ",
+  "ꍎ",
+  "ꍏ",
+  "ꍐ",
+  "ꍑ",
+  "ꍒ",
+  "ꍓ",
+  "ꍔ",
+  "ꍕ",
+  "ꍖ",
+  "ꍗ",
+  "ꍘ",
+  "ꍙ",
+  "ꍚ",
+  "ꍛ",
+  "ꍜ",
+  "ꍝ",
+  "ꍞ",
+  "ꍟ",
+  "ꍠ",
+  "ꍡ",
+  "ꍢ",
+  "ꍣ",
+  "ꍤ",
+  "ꍥ",
+  "ꍦ",
+  "ꍧ",
+  "ꍨ",
+  "ꍩ",
+  "ꍪ",
+  "ꍫ",
+  "ꍬ",
+  "ꍭ",
+  "ꍮ",
+  "ꍯ",
+  "ꍰ",
+  "ꍱ",
+  "ꍲ",
+  "ꍳ",
+  "ꍴ",
+  "ꍵ",
+  "ꍶ",
+  "ꍷ",
+  "ꍸ",
+  "ꍹ",
+  "ꍺ",
+  "ꍻ",
+  "ꍼ",
+  "ꍽ",
+  "ꍾ",
+  "ꍿ",
+  "ꎀ",
+  "ꎁ",
+  "ꎂ",
+  "ꎃ",
+  "ꎄ",
+  "ꎅ",
+  "ꎆ",
+  "ꎇ",
+  "ꎈ",
+  "ꎉ",
+  "ꎊ",
+  "ꎋ",
+  "ꎌ",
+  "ꎍ",
+  "ꎎ",
+  "ꎏ",
+  "ꎐ",
+  "ꎑ",
+  "ꎒ",
+  "ꎓ",
+  "ꎔ",
+  "ꎕ",
+  "ꎖ",
+  "ꎗ",
+  "ꎘ",
+  "ꎙ",
+  "ꎚ",
+  "ꎛ",
+  "ꎜ",
+  "ꎝ",
+  "ꎞ",
+  "ꎟ",
+  "ꎠ",
+  "ꎡ",
+  "ꎢ",
+  "ꎣ",
+  "ꎤ",
+  "ꎥ",
+  "ꎦ",
+  "ꎧ",
+  "ꎨ",
+  "ꎩ",
+  "ꎪ",
+  "ꎫ",
+  "ꎬ",
+  "ꎭ",
+  "ꎮ",
+  "ꎯ",
+  "ꎰ",
+  "ꎱ",
+  "ꎲ",
+  "ꎳ",
+  "ꎴ",
+  "ꎵ",
+  "ꎶ",
+  "ꎷ",
+  "ꎸ",
+  "ꎹ",
+  "ꎺ",
+  "ꎻ",
+  "ꎼ",
+  "ꎽ",
+  "ꎾ",
+  "ꎿ",
+  "ꏀ",
+  "ꏁ",
+  "ꏂ",
+  "ꏃ",
+  "ꏄ",
+  "ꏅ",
+  "ꏆ",
+  "ꏇ",
+  "ꏈ",
+  "ꏉ",
+  "ꏊ",
+  "ꏋ",
+  "ꏌ",
+  "ꏍ",
+  "ꏎ",
+  "ꏏ",
+  "ꏐ",
+  "ꏑ",
+  "ꏒ",
+  "ꏓ",
+  "ꏔ",
+  "ꏕ",
+  "ꏖ",
+  "ꏗ",
+  "ꏘ",
+  "ꏙ",
+  "ꏚ",
+  "ꏛ",
+  "ꏜ",
+  "ꏝ",
+  "ꏞ",
+  "ꏟ",
+  "ꏠ",
+  "ꏡ",
+  "ꏢ",
+  "ꏣ",
+  "ꏤ",
+  "ꏥ",
+  "ꏦ",
+  "ꏧ",
+  "ꏨ",
+  "ꏩ",
+  "ꏪ",
+  "ꏫ",
+  "ꏬ",
+  "ꏭ",
+  "ꏮ",
+  "ꏯ",
+  "ꏰ",
+  "ꏱ",
+  "ꏲ",
+  "ꏳ",
+  "ꏴ",
+  "ꏵ",
+  "ꏶ",
+  "ꏷ",
+  "ꏸ",
+  "ꏹ",
+  "ꏺ",
+  "ꏻ",
+  "ꏼ",
+  "ꏽ",
+  "ꏾ",
+  "ꏿ",
+  "ꐀ",
+  "ꐁ",
+  "ꐂ",
+  "ꐃ",
+  "ꐄ",
+  "ꐅ",
+  "ꐆ",
+  "ꐇ",
+  "ꐈ",
+  "ꐉ",
+  "ꐊ",
+  "ꐋ",
+  "ꐌ",
+  "ꐍ",
+  "ꐎ",
+  "ꐏ",
+  "ꐐ",
+  "ꐑ",
+  "ꐒ",
+  "ꐓ",
+  "ꐔ",
+  "ꐕ",
+  "ꐖ",
+  "ꐗ",
+  "ꐘ",
+  "ꐙ",
+  "ꐚ",
+  "ꐛ",
+  "ꐜ",
+  "ꐝ",
+  "ꐞ",
+  "ꐟ",
+  "ꐠ",
+  "ꐡ",
+  "ꐢ",
+  "ꐣ",
+  "ꐤ",
+  "ꐥ",
+  "ꐦ",
+  "ꐧ",
+  "ꐨ",
+  "ꐩ",
+  "ꐪ",
+  "ꐫ",
+  "ꐬ",
+  "ꐭ",
+  "ꐮ",
+  "ꐯ",
+  "ꐰ",
+  "ꐱ",
+  "ꐲ",
+  "ꐳ",
+  "ꐴ",
+  "ꐵ",
+  "ꐶ",
+  "ꐷ",
+  "ꐸ",
+  "ꐹ",
+  "ꐺ",
+  "ꐻ",
+  "ꐼ",
+  "ꐽ",
+  "ꐾ",
+  "ꐿ",
+  "ꑀ",
+  "ꑁ",
+  "ꑂ",
+  "ꑃ",
+  "ꑄ",
+  "ꑅ",
+  "ꑆ",
+  "ꑇ",
+  "ꑈ",
+  "ꑉ",
+  "ꑊ",
+  "ꑋ",
+  "ꑌ",
+  "ꑍ",
+  "ꑎ",
+  "ꑏ",
+  "ꑐ",
+  "ꑑ",
+  "ꑒ",
+  "ꑓ",
+  "ꑔ",
+  "ꑕ",
+  "ꑖ",
+  "ꑗ",
+  "ꑘ",
+  "ꑙ",
+  "ꑚ",
+  "ꑛ",
+  "ꑜ",
+  "ꑝ",
+  "ꑞ",
+  "ꑟ",
+  "ꑠ",
+  "ꑡ",
+  "ꑢ",
+  "ꑣ",
+  "ꑤ",
+  "ꑥ",
+  "ꑦ",
+  "ꑧ",
+  "ꑨ",
+  "ꑩ",
+  "ꑪ",
+  "ꑫ",
+  "ꑬ",
+  "ꑭ",
+  "ꑮ",
+  "ꑯ",
+  "ꑰ",
+  "ꑱ",
+  "ꑲ",
+  "ꑳ",
+  "ꑴ",
+  "ꑵ",
+  "ꑶ",
+  "ꑷ",
+  "ꑸ",
+  "ꑹ",
+  "ꑺ",
+  "ꑻ",
+  "ꑼ",
+  "ꑽ",
+  "ꑾ",
+  "ꑿ",
+  "ꒀ",
+  "ꒁ",
+  "ꒂ",
+  "ꒃ",
+  "ꒄ",
+  "ꒅ",
+  "ꒆ",
+  "ꒇ",
+  "ꒈ",
+  "ꒉ",
+  "ꒊ",
+  "ꒋ",
+  "ꒌ",
+};
+const char *ALPHA_111_DIGITS[] = {
+};
+const uint32_t ALPHA_111_UPPER_CPS[] = {
+  40960, 40961, 40962, 40963, 40964, 40965, 40966, 40967, 40968, 40969, 40970, 40971, 40972, 40973, 40974, 40975,
+  40976, 40977, 40978, 40979, 40980, 40981, 40982, 40983, 40984, 40985, 40986, 40987, 40988, 40989, 40990, 40991,
+  40992, 40993, 40994, 40995, 40996, 40997, 40998, 40999, 41000, 41001, 41002, 41003, 41004, 41005, 41006, 41007,
+  41008, 41009, 41010, 41011, 41012, 41013, 41014, 41015, 41016, 41017, 41018, 41019, 41020, 41021, 41022, 41023,
+  41024, 41025, 41026, 41027, 41028, 41029, 41030, 41031, 41032, 41033, 41034, 41035, 41036, 41037, 41038, 41039,
+  41040, 41041, 41042, 41043, 41044, 41045, 41046, 41047, 41048, 41049, 41050, 41051, 41052, 41053, 41054, 41055,
+  41056, 41057, 41058, 41059, 41060, 41061, 41062, 41063, 41064, 41065, 41066, 41067, 41068, 41069, 41070, 41071,
+  41072, 41073, 41074, 41075, 41076, 41077, 41078, 41079, 41080, 41081, 41082, 41083, 41084, 41085, 41086, 41087,
+  41088, 41089, 41090, 41091, 41092, 41093, 41094, 41095, 41096, 41097, 41098, 41099, 41100, 41101, 41102, 41103,
+  41104, 41105, 41106, 41107, 41108, 41109, 41110, 41111, 41112, 41113, 41114, 41115, 41116, 41117, 41118, 41119,
+  41120, 41121, 41122, 41123, 41124, 41125, 41126, 41127, 41128, 41129, 41130, 41131, 41132, 41133, 41134, 41135,
+  41136, 41137, 41138, 41139, 41140, 41141, 41142, 41143, 41144, 41145, 41146, 41147, 41148, 41149, 41150, 41151,
+  41152, 41153, 41154, 41155, 41156, 41157, 41158, 41159, 41160, 41161, 41162, 41163, 41164, 41165, 41166, 41167,
+  41168, 41169, 41170, 41171, 41172, 41173, 41174, 41175, 41176, 41177, 41178, 41179, 41180, 41181, 41182, 41183,
+  41184, 41185, 41186, 41187, 41188, 41189, 41190, 41191, 41192, 41193, 41194, 41195, 41196, 41197, 41198, 41199,
+  41200, 41201, 41202, 41203, 41204, 41205, 41206, 41207, 41208, 41209, 41210, 41211, 41212, 41213, 41214, 41215,
+  41216, 41217, 41218, 41219, 41220, 41221, 41222, 41223, 41224, 41225, 41226, 41227, 41228, 41229, 41230, 41231,
+  41232, 41233, 41234, 41235, 41236, 41237, 41238, 41239, 41240, 41241, 41242, 41243, 41244, 41245, 41246, 41247,
+  41248, 41249, 41250, 41251, 41252, 41253, 41254, 41255, 41256, 41257, 41258, 41259, 41260, 41261, 41262, 41263,
+  41264, 41265, 41266, 41267, 41268, 41269, 41270, 41271, 41272, 41273, 41274, 41275, 41276, 41277, 41278, 41279,
+  41280, 41281, 41282, 41283, 41284, 41285, 41286, 41287, 41288, 41289, 41290, 41291, 41292, 41293, 41294, 41295,
+  41296, 41297, 41298, 41299, 41300, 41301, 41302, 41303, 41304, 41305, 41306, 41307, 41308, 41309, 41310, 41311,
+  41312, 41313, 41314, 41315, 41316, 41317, 41318, 41319, 41320, 41321, 41322, 41323, 41324, 41325, 41326, 41327,
+  41328, 41329, 41330, 41331, 41332, 41333, 41334, 41335, 41336, 41337, 41338, 41339, 41340, 41341, 41342, 41343,
+  41344, 41345, 41346, 41347, 41348, 41349, 41350, 41351, 41352, 41353, 41354, 41355, 41356, 41357, 41358, 41359,
+  41360, 41361, 41362, 41363, 41364, 41365, 41366, 41367, 41368, 41369, 41370, 41371, 41372, 41373, 41374, 41375,
+  41376, 41377, 41378, 41379, 41380, 41381, 41382, 41383, 41384, 41385, 41386, 41387, 41388, 41389, 41390, 41391,
+  41392, 41393, 41394, 41395, 41396, 41397, 41398, 41399, 41400, 41401, 41402, 41403, 41404, 41405, 41406, 41407,
+  41408, 41409, 41410, 41411, 41412, 41413, 41414, 41415, 41416, 41417, 41418, 41419, 41420, 41421, 41422, 41423,
+  41424, 41425, 41426, 41427, 41428, 41429, 41430, 41431, 41432, 41433, 41434, 41435, 41436, 41437, 41438, 41439,
+  41440, 41441, 41442, 41443, 41444, 41445, 41446, 41447, 41448, 41449, 41450, 41451, 41452, 41453, 41454, 41455,
+  41456, 41457, 41458, 41459, 41460, 41461, 41462, 41463, 41464, 41465, 41466, 41467, 41468, 41469, 41470, 41471,
+  41472, 41473, 41474, 41475, 41476, 41477, 41478, 41479, 41480, 41481, 41482, 41483, 41484, 41485, 41486, 41487,
+  41488, 41489, 41490, 41491, 41492, 41493, 41494, 41495, 41496, 41497, 41498, 41499, 41500, 41501, 41502, 41503,
+  41504, 41505, 41506, 41507, 41508, 41509, 41510, 41511, 41512, 41513, 41514, 41515, 41516, 41517, 41518, 41519,
+  41520, 41521, 41522, 41523, 41524, 41525, 41526, 41527, 41528, 41529, 41530, 41531, 41532, 41533, 41534, 41535,
+  41536, 41537, 41538, 41539, 41540, 41541, 41542, 41543, 41544, 41545, 41546, 41547, 41548, 41549, 41550, 41551,
+  41552, 41553, 41554, 41555, 41556, 41557, 41558, 41559, 41560, 41561, 41562, 41563, 41564, 41565, 41566, 41567,
+  41568, 41569, 41570, 41571, 41572, 41573, 41574, 41575, 41576, 41577, 41578, 41579, 41580, 41581, 41582, 41583,
+  41584, 41585, 41586, 41587, 41588, 41589, 41590, 41591, 41592, 41593, 41594, 41595, 41596, 41597, 41598, 41599,
+  41600, 41601, 41602, 41603, 41604, 41605, 41606, 41607, 41608, 41609, 41610, 41611, 41612, 41613, 41614, 41615,
+  41616, 41617, 41618, 41619, 41620, 41621, 41622, 41623, 41624, 41625, 41626, 41627, 41628, 41629, 41630, 41631,
+  41632, 41633, 41634, 41635, 41636, 41637, 41638, 41639, 41640, 41641, 41642, 41643, 41644, 41645, 41646, 41647,
+  41648, 41649, 41650, 41651, 41652, 41653, 41654, 41655, 41656, 41657, 41658, 41659, 41660, 41661, 41662, 41663,
+  41664, 41665, 41666, 41667, 41668, 41669, 41670, 41671, 41672, 41673, 41674, 41675, 41676, 41677, 41678, 41679,
+  41680, 41681, 41682, 41683, 41684, 41685, 41686, 41687, 41688, 41689, 41690, 41691, 41692, 41693, 41694, 41695,
+  41696, 41697, 41698, 41699, 41700, 41701, 41702, 41703, 41704, 41705, 41706, 41707, 41708, 41709, 41710, 41711,
+  41712, 41713, 41714, 41715, 41716, 41717, 41718, 41719, 41720, 41721, 41722, 41723, 41724, 41725, 41726, 41727,
+  41728, 41729, 41730, 41731, 41732, 41733, 41734, 41735, 41736, 41737, 41738, 41739, 41740, 41741, 41742, 41743,
+  41744, 41745, 41746, 41747, 41748, 41749, 41750, 41751, 41752, 41753, 41754, 41755, 41756, 41757, 41758, 41759,
+  41760, 41761, 41762, 41763, 41764, 41765, 41766, 41767, 41768, 41769, 41770, 41771, 41772, 41773, 41774, 41775,
+  41776, 41777, 41778, 41779, 41780, 41781, 41782, 41783, 41784, 41785, 41786, 41787, 41788, 41789, 41790, 41791,
+  41792, 41793, 41794, 41795, 41796, 41797, 41798, 41799, 41800, 41801, 41802, 41803, 41804, 41805, 41806, 41807,
+  41808, 41809, 41810, 41811, 41812, 41813, 41814, 41815, 41816, 41817, 41818, 41819, 41820, 41821, 41822, 41823,
+  41824, 41825, 41826, 41827, 41828, 41829, 41830, 41831, 41832, 41833, 41834, 41835, 41836, 41837, 41838, 41839,
+  41840, 41841, 41842, 41843, 41844, 41845, 41846, 41847, 41848, 41849, 41850, 41851, 41852, 41853, 41854, 41855,
+  41856, 41857, 41858, 41859, 41860, 41861, 41862, 41863, 41864, 41865, 41866, 41867, 41868, 41869, 41870, 41871,
+  41872, 41873, 41874, 41875, 41876, 41877, 41878, 41879, 41880, 41881, 41882, 41883, 41884, 41885, 41886, 41887,
+  41888, 41889, 41890, 41891, 41892, 41893, 41894, 41895, 41896, 41897, 41898, 41899, 41900, 41901, 41902, 41903,
+  41904, 41905, 41906, 41907, 41908, 41909, 41910, 41911, 41912, 41913, 41914, 41915, 41916, 41917, 41918, 41919,
+  41920, 41921, 41922, 41923, 41924, 41925, 41926, 41927, 41928, 41929, 41930, 41931, 41932, 41933, 41934, 41935,
+  41936, 41937, 41938, 41939, 41940, 41941, 41942, 41943, 41944, 41945, 41946, 41947, 41948, 41949, 41950, 41951,
+  41952, 41953, 41954, 41955, 41956, 41957, 41958, 41959, 41960, 41961, 41962, 41963, 41964, 41965, 41966, 41967,
+  41968, 41969, 41970, 41971, 41972, 41973, 41974, 41975, 41976, 41977, 41978, 41979, 41980, 41981, 41982, 41983,
+  41984, 41985, 41986, 41987, 41988, 41989, 41990, 41991, 41992, 41993, 41994, 41995, 41996, 41997, 41998, 41999,
+  42000, 42001, 42002, 42003, 42004, 42005, 42006, 42007, 42008, 42009, 42010, 42011, 42012, 42013, 42014, 42015,
+  42016, 42017, 42018, 42019, 42020, 42021, 42022, 42023, 42024, 42025, 42026, 42027, 42028, 42029, 42030, 42031,
+  42032, 42033, 42034, 42035, 42036, 42037, 42038, 42039, 42040, 42041, 42042, 42043, 42044, 42045, 42046, 42047,
+  42048, 42049, 42050, 42051, 42052, 42053, 42054, 42055, 42056, 42057, 42058, 42059, 42060, 42061, 42062, 42063,
+  42064, 42065, 42066, 42067, 42068, 42069, 42070, 42071, 42072, 42073, 42074, 42075, 42076, 42077, 42078, 42079,
+  42080, 42081, 42082, 42083, 42084, 42085, 42086, 42087, 42088, 42089, 42090, 42091, 42092, 42093, 42094, 42095,
+  42096, 42097, 42098, 42099, 42100, 42101, 42102, 42103, 42104, 42105, 42106, 42107, 42108, 42109, 42110, 42111,
+  42112, 42113, 42114, 42115, 42116, 42117, 42118, 42119, 42120, 42121, 42122, 42123, 42124,
+};
+const uint32_t ALPHA_111_LOWER_CPS[] = {
+  40960, 40961, 40962, 40963, 40964, 40965, 40966, 40967, 40968, 40969, 40970, 40971, 40972, 40973, 40974, 40975,
+  40976, 40977, 40978, 40979, 40980, 40981, 40982, 40983, 40984, 40985, 40986, 40987, 40988, 40989, 40990, 40991,
+  40992, 40993, 40994, 40995, 40996, 40997, 40998, 40999, 41000, 41001, 41002, 41003, 41004, 41005, 41006, 41007,
+  41008, 41009, 41010, 41011, 41012, 41013, 41014, 41015, 41016, 41017, 41018, 41019, 41020, 41021, 41022, 41023,
+  41024, 41025, 41026, 41027, 41028, 41029, 41030, 41031, 41032, 41033, 41034, 41035, 41036, 41037, 41038, 41039,
+  41040, 41041, 41042, 41043, 41044, 41045, 41046, 41047, 41048, 41049, 41050, 41051, 41052, 41053, 41054, 41055,
+  41056, 41057, 41058, 41059, 41060, 41061, 41062, 41063, 41064, 41065, 41066, 41067, 41068, 41069, 41070, 41071,
+  41072, 41073, 41074, 41075, 41076, 41077, 41078, 41079, 41080, 41081, 41082, 41083, 41084, 41085, 41086, 41087,
+  41088, 41089, 41090, 41091, 41092, 41093, 41094, 41095, 41096, 41097, 41098, 41099, 41100, 41101, 41102, 41103,
+  41104, 41105, 41106, 41107, 41108, 41109, 41110, 41111, 41112, 41113, 41114, 41115, 41116, 41117, 41118, 41119,
+  41120, 41121, 41122, 41123, 41124, 41125, 41126, 41127, 41128, 41129, 41130, 41131, 41132, 41133, 41134, 41135,
+  41136, 41137, 41138, 41139, 41140, 41141, 41142, 41143, 41144, 41145, 41146, 41147, 41148, 41149, 41150, 41151,
+  41152, 41153, 41154, 41155, 41156, 41157, 41158, 41159, 41160, 41161, 41162, 41163, 41164, 41165, 41166, 41167,
+  41168, 41169, 41170, 41171, 41172, 41173, 41174, 41175, 41176, 41177, 41178, 41179, 41180, 41181, 41182, 41183,
+  41184, 41185, 41186, 41187, 41188, 41189, 41190, 41191, 41192, 41193, 41194, 41195, 41196, 41197, 41198, 41199,
+  41200, 41201, 41202, 41203, 41204, 41205, 41206, 41207, 41208, 41209, 41210, 41211, 41212, 41213, 41214, 41215,
+  41216, 41217, 41218, 41219, 41220, 41221, 41222, 41223, 41224, 41225, 41226, 41227, 41228, 41229, 41230, 41231,
+  41232, 41233, 41234, 41235, 41236, 41237, 41238, 41239, 41240, 41241, 41242, 41243, 41244, 41245, 41246, 41247,
+  41248, 41249, 41250, 41251, 41252, 41253, 41254, 41255, 41256, 41257, 41258, 41259, 41260, 41261, 41262, 41263,
+  41264, 41265, 41266, 41267, 41268, 41269, 41270, 41271, 41272, 41273, 41274, 41275, 41276, 41277, 41278, 41279,
+  41280, 41281, 41282, 41283, 41284, 41285, 41286, 41287, 41288, 41289, 41290, 41291, 41292, 41293, 41294, 41295,
+  41296, 41297, 41298, 41299, 41300, 41301, 41302, 41303, 41304, 41305, 41306, 41307, 41308, 41309, 41310, 41311,
+  41312, 41313, 41314, 41315, 41316, 41317, 41318, 41319, 41320, 41321, 41322, 41323, 41324, 41325, 41326, 41327,
+  41328, 41329, 41330, 41331, 41332, 41333, 41334, 41335, 41336, 41337, 41338, 41339, 41340, 41341, 41342, 41343,
+  41344, 41345, 41346, 41347, 41348, 41349, 41350, 41351, 41352, 41353, 41354, 41355, 41356, 41357, 41358, 41359,
+  41360, 41361, 41362, 41363, 41364, 41365, 41366, 41367, 41368, 41369, 41370, 41371, 41372, 41373, 41374, 41375,
+  41376, 41377, 41378, 41379, 41380, 41381, 41382, 41383, 41384, 41385, 41386, 41387, 41388, 41389, 41390, 41391,
+  41392, 41393, 41394, 41395, 41396, 41397, 41398, 41399, 41400, 41401, 41402, 41403, 41404, 41405, 41406, 41407,
+  41408, 41409, 41410, 41411, 41412, 41413, 41414, 41415, 41416, 41417, 41418, 41419, 41420, 41421, 41422, 41423,
+  41424, 41425, 41426, 41427, 41428, 41429, 41430, 41431, 41432, 41433, 41434, 41435, 41436, 41437, 41438, 41439,
+  41440, 41441, 41442, 41443, 41444, 41445, 41446, 41447, 41448, 41449, 41450, 41451, 41452, 41453, 41454, 41455,
+  41456, 41457, 41458, 41459, 41460, 41461, 41462, 41463, 41464, 41465, 41466, 41467, 41468, 41469, 41470, 41471,
+  41472, 41473, 41474, 41475, 41476, 41477, 41478, 41479, 41480, 41481, 41482, 41483, 41484, 41485, 41486, 41487,
+  41488, 41489, 41490, 41491, 41492, 41493, 41494, 41495, 41496, 41497, 41498, 41499, 41500, 41501, 41502, 41503,
+  41504, 41505, 41506, 41507, 41508, 41509, 41510, 41511, 41512, 41513, 41514, 41515, 41516, 41517, 41518, 41519,
+  41520, 41521, 41522, 41523, 41524, 41525, 41526, 41527, 41528, 41529, 41530, 41531, 41532, 41533, 41534, 41535,
+  41536, 41537, 41538, 41539, 41540, 41541, 41542, 41543, 41544, 41545, 41546, 41547, 41548, 41549, 41550, 41551,
+  41552, 41553, 41554, 41555, 41556, 41557, 41558, 41559, 41560, 41561, 41562, 41563, 41564, 41565, 41566, 41567,
+  41568, 41569, 41570, 41571, 41572, 41573, 41574, 41575, 41576, 41577, 41578, 41579, 41580, 41581, 41582, 41583,
+  41584, 41585, 41586, 41587, 41588, 41589, 41590, 41591, 41592, 41593, 41594, 41595, 41596, 41597, 41598, 41599,
+  41600, 41601, 41602, 41603, 41604, 41605, 41606, 41607, 41608, 41609, 41610, 41611, 41612, 41613, 41614, 41615,
+  41616, 41617, 41618, 41619, 41620, 41621, 41622, 41623, 41624, 41625, 41626, 41627, 41628, 41629, 41630, 41631,
+  41632, 41633, 41634, 41635, 41636, 41637, 41638, 41639, 41640, 41641, 41642, 41643, 41644, 41645, 41646, 41647,
+  41648, 41649, 41650, 41651, 41652, 41653, 41654, 41655, 41656, 41657, 41658, 41659, 41660, 41661, 41662, 41663,
+  41664, 41665, 41666, 41667, 41668, 41669, 41670, 41671, 41672, 41673, 41674, 41675, 41676, 41677, 41678, 41679,
+  41680, 41681, 41682, 41683, 41684, 41685, 41686, 41687, 41688, 41689, 41690, 41691, 41692, 41693, 41694, 41695,
+  41696, 41697, 41698, 41699, 41700, 41701, 41702, 41703, 41704, 41705, 41706, 41707, 41708, 41709, 41710, 41711,
+  41712, 41713, 41714, 41715, 41716, 41717, 41718, 41719, 41720, 41721, 41722, 41723, 41724, 41725, 41726, 41727,
+  41728, 41729, 41730, 41731, 41732, 41733, 41734, 41735, 41736, 41737, 41738, 41739, 41740, 41741, 41742, 41743,
+  41744, 41745, 41746, 41747, 41748, 41749, 41750, 41751, 41752, 41753, 41754, 41755, 41756, 41757, 41758, 41759,
+  41760, 41761, 41762, 41763, 41764, 41765, 41766, 41767, 41768, 41769, 41770, 41771, 41772, 41773, 41774, 41775,
+  41776, 41777, 41778, 41779, 41780, 41781, 41782, 41783, 41784, 41785, 41786, 41787, 41788, 41789, 41790, 41791,
+  41792, 41793, 41794, 41795, 41796, 41797, 41798, 41799, 41800, 41801, 41802, 41803, 41804, 41805, 41806, 41807,
+  41808, 41809, 41810, 41811, 41812, 41813, 41814, 41815, 41816, 41817, 41818, 41819, 41820, 41821, 41822, 41823,
+  41824, 41825, 41826, 41827, 41828, 41829, 41830, 41831, 41832, 41833, 41834, 41835, 41836, 41837, 41838, 41839,
+  41840, 41841, 41842, 41843, 41844, 41845, 41846, 41847, 41848, 41849, 41850, 41851, 41852, 41853, 41854, 41855,
+  41856, 41857, 41858, 41859, 41860, 41861, 41862, 41863, 41864, 41865, 41866, 41867, 41868, 41869, 41870, 41871,
+  41872, 41873, 41874, 41875, 41876, 41877, 41878, 41879, 41880, 41881, 41882, 41883, 41884, 41885, 41886, 41887,
+  41888, 41889, 41890, 41891, 41892, 41893, 41894, 41895, 41896, 41897, 41898, 41899, 41900, 41901, 41902, 41903,
+  41904, 41905, 41906, 41907, 41908, 41909, 41910, 41911, 41912, 41913, 41914, 41915, 41916, 41917, 41918, 41919,
+  41920, 41921, 41922, 41923, 41924, 41925, 41926, 41927, 41928, 41929, 41930, 41931, 41932, 41933, 41934, 41935,
+  41936, 41937, 41938, 41939, 41940, 41941, 41942, 41943, 41944, 41945, 41946, 41947, 41948, 41949, 41950, 41951,
+  41952, 41953, 41954, 41955, 41956, 41957, 41958, 41959, 41960, 41961, 41962, 41963, 41964, 41965, 41966, 41967,
+  41968, 41969, 41970, 41971, 41972, 41973, 41974, 41975, 41976, 41977, 41978, 41979, 41980, 41981, 41982, 41983,
+  41984, 41985, 41986, 41987, 41988, 41989, 41990, 41991, 41992, 41993, 41994, 41995, 41996, 41997, 41998, 41999,
+  42000, 42001, 42002, 42003, 42004, 42005, 42006, 42007, 42008, 42009, 42010, 42011, 42012, 42013, 42014, 42015,
+  42016, 42017, 42018, 42019, 42020, 42021, 42022, 42023, 42024, 42025, 42026, 42027, 42028, 42029, 42030, 42031,
+  42032, 42033, 42034, 42035, 42036, 42037, 42038, 42039, 42040, 42041, 42042, 42043, 42044, 42045, 42046, 42047,
+  42048, 42049, 42050, 42051, 42052, 42053, 42054, 42055, 42056, 42057, 42058, 42059, 42060, 42061, 42062, 42063,
+  42064, 42065, 42066, 42067, 42068, 42069, 42070, 42071, 42072, 42073, 42074, 42075, 42076, 42077, 42078, 42079,
+  42080, 42081, 42082, 42083, 42084, 42085, 42086, 42087, 42088, 42089, 42090, 42091, 42092, 42093, 42094, 42095,
+  42096, 42097, 42098, 42099, 42100, 42101, 42102, 42103, 42104, 42105, 42106, 42107, 42108, 42109, 42110, 42111,
+  42112, 42113, 42114, 42115, 42116, 42117, 42118, 42119, 42120, 42121, 42122, 42123, 42124,
+};
+const uint32_t ALPHA_111_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_111_FREQ[] = {
+  { "ꀀ", 0.00000000 },
+  { "ꀁ", 0.00000000 },
+  { "ꀂ", 0.00000000 },
+  { "ꀃ", 0.00000000 },
+  { "ꀄ", 0.00000000 },
+  { "ꀅ", 0.00000000 },
+  { "ꀆ", 0.00000000 },
+  { "ꀇ", 0.00000000 },
+  { "ꀈ", 0.00000000 },
+  { "ꀉ", 0.00000000 },
+  { "ꀊ", 0.00000000 },
+  { "ꀋ", 0.00000000 },
+  { "ꀌ", 0.00000000 },
+  { "ꀍ", 0.00000000 },
+  { "ꀎ", 0.00000000 },
+  { "ꀏ", 0.00000000 },
+  { "ꀐ", 0.00000000 },
+  { "ꀑ", 0.00000000 },
+  { "ꀒ", 0.00000000 },
+  { "ꀓ", 0.00000000 },
+  { "ꀔ", 0.00000000 },
+  { "ꀕ", 0.00000000 },
+  { "ꀖ", 0.00000000 },
+  { "ꀗ", 0.00000000 },
+  { "ꀘ", 0.00000000 },
+  { "ꀙ", 0.00000000 },
+  { "ꀚ", 0.00000000 },
+  { "ꀛ", 0.00000000 },
+  { "ꀜ", 0.00000000 },
+  { "ꀝ", 0.00000000 },
+  { "ꀞ", 0.00000000 },
+  { "ꀟ", 0.00000000 },
+  { "ꀠ", 0.00000000 },
+  { "ꀡ", 0.00000000 },
+  { "ꀢ", 0.00000000 },
+  { "ꀣ", 0.00000000 },
+  { "ꀤ", 0.00000000 },
+  { "ꀥ", 0.00000000 },
+  { "ꀦ", 0.00000000 },
+  { "ꀧ", 0.00000000 },
+  { "ꀨ", 0.00000000 },
+  { "ꀩ", 0.00000000 },
+  { "ꀪ", 0.00000000 },
+  { "ꀫ", 0.00000000 },
+  { "ꀬ", 0.00000000 },
+  { "ꀭ", 0.00000000 },
+  { "ꀮ", 0.00000000 },
+  { "ꀯ", 0.00000000 },
+  { "ꀰ", 0.00000000 },
+  { "ꀱ", 0.00000000 },
+  { "ꀲ", 0.00000000 },
+  { "ꀳ", 0.00000000 },
+  { "ꀴ", 0.00000000 },
+  { "ꀵ", 0.00000000 },
+  { "ꀶ", 0.00000000 },
+  { "ꀷ", 0.00000000 },
+  { "ꀸ", 0.00000000 },
+  { "ꀹ", 0.00000000 },
+  { "ꀺ", 0.00000000 },
+  { "ꀻ", 0.00000000 },
+  { "ꀼ", 0.00000000 },
+  { "ꀽ", 0.00000000 },
+  { "ꀾ", 0.00000000 },
+  { "ꀿ", 0.00000000 },
+  { "ꁀ", 0.00000000 },
+  { "ꁁ", 0.00000000 },
+  { "ꁂ", 0.00000000 },
+  { "ꁃ", 0.00000000 },
+  { "ꁄ", 0.00000000 },
+  { "ꁅ", 0.00000000 },
+  { "ꁆ", 0.00000000 },
+  { "ꁇ", 0.00000000 },
+  { "ꁈ", 0.00000000 },
+  { "ꁉ", 0.00000000 },
+  { "ꁊ", 0.00000000 },
+  { "ꁋ", 0.00000000 },
+  { "ꁌ", 0.00000000 },
+  { "ꁍ", 0.00000000 },
+  { "ꁎ", 0.00000000 },
+  { "ꁏ", 0.00000000 },
+  { "ꁐ", 0.00000000 },
+  { "ꁑ", 0.00000000 },
+  { "ꁒ", 0.00000000 },
+  { "ꁓ", 0.00000000 },
+  { "ꁔ", 0.00000000 },
+  { "ꁕ", 0.00000000 },
+  { "ꁖ", 0.00000000 },
+  { "ꁗ", 0.00000000 },
+  { "ꁘ", 0.00000000 },
+  { "ꁙ", 0.00000000 },
+  { "ꁚ", 0.00000000 },
+  { "ꁛ", 0.00000000 },
+  { "ꁜ", 0.00000000 },
+  { "ꁝ", 0.00000000 },
+  { "ꁞ", 0.00000000 },
+  { "ꁟ", 0.00000000 },
+  { "ꁠ", 0.00000000 },
+  { "ꁡ", 0.00000000 },
+  { "ꁢ", 0.00000000 },
+  { "ꁣ", 0.00000000 },
+  { "ꁤ", 0.00000000 },
+  { "ꁥ", 0.00000000 },
+  { "ꁦ", 0.00000000 },
+  { "ꁧ", 0.00000000 },
+  { "ꁨ", 0.00000000 },
+  { "ꁩ", 0.00000000 },
+  { "ꁪ", 0.00000000 },
+  { "ꁫ", 0.00000000 },
+  { "ꁬ", 0.00000000 },
+  { "ꁭ", 0.00000000 },
+  { "ꁮ", 0.00000000 },
+  { "ꁯ", 0.00000000 },
+  { "ꁰ", 0.00000000 },
+  { "ꁱ", 0.00000000 },
+  { "ꁲ", 0.00000000 },
+  { "ꁳ", 0.00000000 },
+  { "ꁴ", 0.00000000 },
+  { "ꁵ", 0.00000000 },
+  { "ꁶ", 0.00000000 },
+  { "ꁷ", 0.00000000 },
+  { "ꁸ", 0.00000000 },
+  { "ꁹ", 0.00000000 },
+  { "ꁺ", 0.00000000 },
+  { "ꁻ", 0.00000000 },
+  { "ꁼ", 0.00000000 },
+  { "ꁽ", 0.00000000 },
+  { "ꁾ", 0.00000000 },
+  { "ꁿ", 0.00000000 },
+  { "ꂀ", 0.00000000 },
+  { "ꂁ", 0.00000000 },
+  { "ꂂ", 0.00000000 },
+  { "ꂃ", 0.00000000 },
+  { "ꂄ", 0.00000000 },
+  { "ꂅ", 0.00000000 },
+  { "ꂆ", 0.00000000 },
+  { "ꂇ", 0.00000000 },
+  { "ꂈ", 0.00000000 },
+  { "ꂉ", 0.00000000 },
+  { "ꂊ", 0.00000000 },
+  { "ꂋ", 0.00000000 },
+  { "ꂌ", 0.00000000 },
+  { "ꂍ", 0.00000000 },
+  { "ꂎ", 0.00000000 },
+  { "ꂏ", 0.00000000 },
+  { "ꂐ", 0.00000000 },
+  { "ꂑ", 0.00000000 },
+  { "ꂒ", 0.00000000 },
+  { "ꂓ", 0.00000000 },
+  { "ꂔ", 0.00000000 },
+  { "ꂕ", 0.00000000 },
+  { "ꂖ", 0.00000000 },
+  { "ꂗ", 0.00000000 },
+  { "ꂘ", 0.00000000 },
+  { "ꂙ", 0.00000000 },
+  { "ꂚ", 0.00000000 },
+  { "ꂛ", 0.00000000 },
+  { "ꂜ", 0.00000000 },
+  { "ꂝ", 0.00000000 },
+  { "ꂞ", 0.00000000 },
+  { "ꂟ", 0.00000000 },
+  { "ꂠ", 0.00000000 },
+  { "ꂡ", 0.00000000 },
+  { "ꂢ", 0.00000000 },
+  { "ꂣ", 0.00000000 },
+  { "ꂤ", 0.00000000 },
+  { "ꂥ", 0.00000000 },
+  { "ꂦ", 0.00000000 },
+  { "ꂧ", 0.00000000 },
+  { "ꂨ", 0.00000000 },
+  { "ꂩ", 0.00000000 },
+  { "ꂪ", 0.00000000 },
+  { "ꂫ", 0.00000000 },
+  { "ꂬ", 0.00000000 },
+  { "ꂭ", 0.00000000 },
+  { "ꂮ", 0.00000000 },
+  { "ꂯ", 0.00000000 },
+  { "ꂰ", 0.00000000 },
+  { "ꂱ", 0.00000000 },
+  { "ꂲ", 0.00000000 },
+  { "ꂳ", 0.00000000 },
+  { "ꂴ", 0.00000000 },
+  { "ꂵ", 0.00000000 },
+  { "ꂶ", 0.00000000 },
+  { "ꂷ", 0.00000000 },
+  { "ꂸ", 0.00000000 },
+  { "ꂹ", 0.00000000 },
+  { "ꂺ", 0.00000000 },
+  { "ꂻ", 0.00000000 },
+  { "ꂼ", 0.00000000 },
+  { "ꂽ", 0.00000000 },
+  { "ꂾ", 0.00000000 },
+  { "ꂿ", 0.00000000 },
+  { "ꃀ", 0.00000000 },
+  { "ꃁ", 0.00000000 },
+  { "ꃂ", 0.00000000 },
+  { "ꃃ", 0.00000000 },
+  { "ꃄ", 0.00000000 },
+  { "ꃅ", 0.00000000 },
+  { "ꃆ", 0.00000000 },
+  { "ꃇ", 0.00000000 },
+  { "ꃈ", 0.00000000 },
+  { "ꃉ", 0.00000000 },
+  { "ꃊ", 0.00000000 },
+  { "ꃋ", 0.00000000 },
+  { "ꃌ", 0.00000000 },
+  { "ꃍ", 0.00000000 },
+  { "ꃎ", 0.00000000 },
+  { "ꃏ", 0.00000000 },
+  { "ꃐ", 0.00000000 },
+  { "ꃑ", 0.00000000 },
+  { "ꃒ", 0.00000000 },
+  { "ꃓ", 0.00000000 },
+  { "ꃔ", 0.00000000 },
+  { "ꃕ", 0.00000000 },
+  { "ꃖ", 0.00000000 },
+  { "ꃗ", 0.00000000 },
+  { "ꃘ", 0.00000000 },
+  { "ꃙ", 0.00000000 },
+  { "ꃚ", 0.00000000 },
+  { "ꃛ", 0.00000000 },
+  { "ꃜ", 0.00000000 },
+  { "ꃝ", 0.00000000 },
+  { "ꃞ", 0.00000000 },
+  { "ꃟ", 0.00000000 },
+  { "ꃠ", 0.00000000 },
+  { "ꃡ", 0.00000000 },
+  { "ꃢ", 0.00000000 },
+  { "ꃣ", 0.00000000 },
+  { "ꃤ", 0.00000000 },
+  { "ꃥ", 0.00000000 },
+  { "ꃦ", 0.00000000 },
+  { "ꃧ", 0.00000000 },
+  { "ꃨ", 0.00000000 },
+  { "ꃩ", 0.00000000 },
+  { "ꃪ", 0.00000000 },
+  { "ꃫ", 0.00000000 },
+  { "ꃬ", 0.00000000 },
+  { "ꃭ", 0.00000000 },
+  { "ꃮ", 0.00000000 },
+  { "ꃯ", 0.00000000 },
+  { "ꃰ", 0.00000000 },
+  { "ꃱ", 0.00000000 },
+  { "ꃲ", 0.00000000 },
+  { "ꃳ", 0.00000000 },
+  { "ꃴ", 0.00000000 },
+  { "ꃵ", 0.00000000 },
+  { "ꃶ", 0.00000000 },
+  { "ꃷ", 0.00000000 },
+  { "ꃸ", 0.00000000 },
+  { "ꃹ", 0.00000000 },
+  { "ꃺ", 0.00000000 },
+  { "ꃻ", 0.00000000 },
+  { "ꃼ", 0.00000000 },
+  { "ꃽ", 0.00000000 },
+  { "ꃾ", 0.00000000 },
+  { "ꃿ", 0.00000000 },
+  { "ꄀ", 0.00000000 },
+  { "ꄁ", 0.00000000 },
+  { "ꄂ", 0.00000000 },
+  { "ꄃ", 0.00000000 },
+  { "ꄄ", 0.00000000 },
+  { "ꄅ", 0.00000000 },
+  { "ꄆ", 0.00000000 },
+  { "ꄇ", 0.00000000 },
+  { "ꄈ", 0.00000000 },
+  { "ꄉ", 0.00000000 },
+  { "ꄊ", 0.00000000 },
+  { "ꄋ", 0.00000000 },
+  { "ꄌ", 0.00000000 },
+  { "ꄍ", 0.00000000 },
+  { "ꄎ", 0.00000000 },
+  { "ꄏ", 0.00000000 },
+  { "ꄐ", 0.00000000 },
+  { "ꄑ", 0.00000000 },
+  { "ꄒ", 0.00000000 },
+  { "ꄓ", 0.00000000 },
+  { "ꄔ", 0.00000000 },
+  { "ꄕ", 0.00000000 },
+  { "ꄖ", 0.00000000 },
+  { "ꄗ", 0.00000000 },
+  { "ꄘ", 0.00000000 },
+  { "ꄙ", 0.00000000 },
+  { "ꄚ", 0.00000000 },
+  { "ꄛ", 0.00000000 },
+  { "ꄜ", 0.00000000 },
+  { "ꄝ", 0.00000000 },
+  { "ꄞ", 0.00000000 },
+  { "ꄟ", 0.00000000 },
+  { "ꄠ", 0.00000000 },
+  { "ꄡ", 0.00000000 },
+  { "ꄢ", 0.00000000 },
+  { "ꄣ", 0.00000000 },
+  { "ꄤ", 0.00000000 },
+  { "ꄥ", 0.00000000 },
+  { "ꄦ", 0.00000000 },
+  { "ꄧ", 0.00000000 },
+  { "ꄨ", 0.00000000 },
+  { "ꄩ", 0.00000000 },
+  { "ꄪ", 0.00000000 },
+  { "ꄫ", 0.00000000 },
+  { "ꄬ", 0.00000000 },
+  { "ꄭ", 0.00000000 },
+  { "ꄮ", 0.00000000 },
+  { "ꄯ", 0.00000000 },
+  { "ꄰ", 0.00000000 },
+  { "ꄱ", 0.00000000 },
+  { "ꄲ", 0.00000000 },
+  { "ꄳ", 0.00000000 },
+  { "ꄴ", 0.00000000 },
+  { "ꄵ", 0.00000000 },
+  { "ꄶ", 0.00000000 },
+  { "ꄷ", 0.00000000 },
+  { "ꄸ", 0.00000000 },
+  { "ꄹ", 0.00000000 },
+  { "ꄺ", 0.00000000 },
+  { "ꄻ", 0.00000000 },
+  { "ꄼ", 0.00000000 },
+  { "ꄽ", 0.00000000 },
+  { "ꄾ", 0.00000000 },
+  { "ꄿ", 0.00000000 },
+  { "ꅀ", 0.00000000 },
+  { "ꅁ", 0.00000000 },
+  { "ꅂ", 0.00000000 },
+  { "ꅃ", 0.00000000 },
+  { "ꅄ", 0.00000000 },
+  { "ꅅ", 0.00000000 },
+  { "ꅆ", 0.00000000 },
+  { "ꅇ", 0.00000000 },
+  { "ꅈ", 0.00000000 },
+  { "ꅉ", 0.00000000 },
+  { "ꅊ", 0.00000000 },
+  { "ꅋ", 0.00000000 },
+  { "ꅌ", 0.00000000 },
+  { "ꅍ", 0.00000000 },
+  { "ꅎ", 0.00000000 },
+  { "ꅏ", 0.00000000 },
+  { "ꅐ", 0.00000000 },
+  { "ꅑ", 0.00000000 },
+  { "ꅒ", 0.00000000 },
+  { "ꅓ", 0.00000000 },
+  { "ꅔ", 0.00000000 },
+  { "ꅕ", 0.00000000 },
+  { "ꅖ", 0.00000000 },
+  { "ꅗ", 0.00000000 },
+  { "ꅘ", 0.00000000 },
+  { "ꅙ", 0.00000000 },
+  { "ꅚ", 0.00000000 },
+  { "ꅛ", 0.00000000 },
+  { "ꅜ", 0.00000000 },
+  { "ꅝ", 0.00000000 },
+  { "ꅞ", 0.00000000 },
+  { "ꅟ", 0.00000000 },
+  { "ꅠ", 0.00000000 },
+  { "ꅡ", 0.00000000 },
+  { "ꅢ", 0.00000000 },
+  { "ꅣ", 0.00000000 },
+  { "ꅤ", 0.00000000 },
+  { "ꅥ", 0.00000000 },
+  { "ꅦ", 0.00000000 },
+  { "ꅧ", 0.00000000 },
+  { "ꅨ", 0.00000000 },
+  { "ꅩ", 0.00000000 },
+  { "ꅪ", 0.00000000 },
+  { "ꅫ", 0.00000000 },
+  { "ꅬ", 0.00000000 },
+  { "ꅭ", 0.00000000 },
+  { "ꅮ", 0.00000000 },
+  { "ꅯ", 0.00000000 },
+  { "ꅰ", 0.00000000 },
+  { "ꅱ", 0.00000000 },
+  { "ꅲ", 0.00000000 },
+  { "ꅳ", 0.00000000 },
+  { "ꅴ", 0.00000000 },
+  { "ꅵ", 0.00000000 },
+  { "ꅶ", 0.00000000 },
+  { "ꅷ", 0.00000000 },
+  { "ꅸ", 0.00000000 },
+  { "ꅹ", 0.00000000 },
+  { "ꅺ", 0.00000000 },
+  { "ꅻ", 0.00000000 },
+  { "ꅼ", 0.00000000 },
+  { "ꅽ", 0.00000000 },
+  { "ꅾ", 0.00000000 },
+  { "ꅿ", 0.00000000 },
+  { "ꆀ", 0.00000000 },
+  { "ꆁ", 0.00000000 },
+  { "ꆂ", 0.00000000 },
+  { "ꆃ", 0.00000000 },
+  { "ꆄ", 0.00000000 },
+  { "ꆅ", 0.00000000 },
+  { "ꆆ", 0.00000000 },
+  { "ꆇ", 0.00000000 },
+  { "ꆈ", 0.00000000 },
+  { "ꆉ", 0.00000000 },
+  { "ꆊ", 0.00000000 },
+  { "ꆋ", 0.00000000 },
+  { "ꆌ", 0.00000000 },
+  { "ꆍ", 0.00000000 },
+  { "ꆎ", 0.00000000 },
+  { "ꆏ", 0.00000000 },
+  { "ꆐ", 0.00000000 },
+  { "ꆑ", 0.00000000 },
+  { "ꆒ", 0.00000000 },
+  { "ꆓ", 0.00000000 },
+  { "ꆔ", 0.00000000 },
+  { "ꆕ", 0.00000000 },
+  { "ꆖ", 0.00000000 },
+  { "ꆗ", 0.00000000 },
+  { "ꆘ", 0.00000000 },
+  { "ꆙ", 0.00000000 },
+  { "ꆚ", 0.00000000 },
+  { "ꆛ", 0.00000000 },
+  { "ꆜ", 0.00000000 },
+  { "ꆝ", 0.00000000 },
+  { "ꆞ", 0.00000000 },
+  { "ꆟ", 0.00000000 },
+  { "ꆠ", 0.00000000 },
+  { "ꆡ", 0.00000000 },
+  { "ꆢ", 0.00000000 },
+  { "ꆣ", 0.00000000 },
+  { "ꆤ", 0.00000000 },
+  { "ꆥ", 0.00000000 },
+  { "ꆦ", 0.00000000 },
+  { "ꆧ", 0.00000000 },
+  { "ꆨ", 0.00000000 },
+  { "ꆩ", 0.00000000 },
+  { "ꆪ", 0.00000000 },
+  { "ꆫ", 0.00000000 },
+  { "ꆬ", 0.00000000 },
+  { "ꆭ", 0.00000000 },
+  { "ꆮ", 0.00000000 },
+  { "ꆯ", 0.00000000 },
+  { "ꆰ", 0.00000000 },
+  { "ꆱ", 0.00000000 },
+  { "ꆲ", 0.00000000 },
+  { "ꆳ", 0.00000000 },
+  { "ꆴ", 0.00000000 },
+  { "ꆵ", 0.00000000 },
+  { "ꆶ", 0.00000000 },
+  { "ꆷ", 0.00000000 },
+  { "ꆸ", 0.00000000 },
+  { "ꆹ", 0.00000000 },
+  { "ꆺ", 0.00000000 },
+  { "ꆻ", 0.00000000 },
+  { "ꆼ", 0.00000000 },
+  { "ꆽ", 0.00000000 },
+  { "ꆾ", 0.00000000 },
+  { "ꆿ", 0.00000000 },
+  { "ꇀ", 0.00000000 },
+  { "ꇁ", 0.00000000 },
+  { "ꇂ", 0.00000000 },
+  { "ꇃ", 0.00000000 },
+  { "ꇄ", 0.00000000 },
+  { "ꇅ", 0.00000000 },
+  { "ꇆ", 0.00000000 },
+  { "ꇇ", 0.00000000 },
+  { "ꇈ", 0.00000000 },
+  { "ꇉ", 0.00000000 },
+  { "ꇊ", 0.00000000 },
+  { "ꇋ", 0.00000000 },
+  { "ꇌ", 0.00000000 },
+  { "ꇍ", 0.00000000 },
+  { "ꇎ", 0.00000000 },
+  { "ꇏ", 0.00000000 },
+  { "ꇐ", 0.00000000 },
+  { "ꇑ", 0.00000000 },
+  { "ꇒ", 0.00000000 },
+  { "ꇓ", 0.00000000 },
+  { "ꇔ", 0.00000000 },
+  { "ꇕ", 0.00000000 },
+  { "ꇖ", 0.00000000 },
+  { "ꇗ", 0.00000000 },
+  { "ꇘ", 0.00000000 },
+  { "ꇙ", 0.00000000 },
+  { "ꇚ", 0.00000000 },
+  { "ꇛ", 0.00000000 },
+  { "ꇜ", 0.00000000 },
+  { "ꇝ", 0.00000000 },
+  { "ꇞ", 0.00000000 },
+  { "ꇟ", 0.00000000 },
+  { "ꇠ", 0.00000000 },
+  { "ꇡ", 0.00000000 },
+  { "ꇢ", 0.00000000 },
+  { "ꇣ", 0.00000000 },
+  { "ꇤ", 0.00000000 },
+  { "ꇥ", 0.00000000 },
+  { "ꇦ", 0.00000000 },
+  { "ꇧ", 0.00000000 },
+  { "ꇨ", 0.00000000 },
+  { "ꇩ", 0.00000000 },
+  { "ꇪ", 0.00000000 },
+  { "ꇫ", 0.00000000 },
+  { "ꇬ", 0.00000000 },
+  { "ꇭ", 0.00000000 },
+  { "ꇮ", 0.00000000 },
+  { "ꇯ", 0.00000000 },
+  { "ꇰ", 0.00000000 },
+  { "ꇱ", 0.00000000 },
+  { "ꇲ", 0.00000000 },
+  { "ꇳ", 0.00000000 },
+  { "ꇴ", 0.00000000 },
+  { "ꇵ", 0.00000000 },
+  { "ꇶ", 0.00000000 },
+  { "ꇷ", 0.00000000 },
+  { "ꇸ", 0.00000000 },
+  { "ꇹ", 0.00000000 },
+  { "ꇺ", 0.00000000 },
+  { "ꇻ", 0.00000000 },
+  { "ꇼ", 0.00000000 },
+  { "ꇽ", 0.00000000 },
+  { "ꇾ", 0.00000000 },
+  { "ꇿ", 0.00000000 },
+  { "ꈀ", 0.00000000 },
+  { "ꈁ", 0.00000000 },
+  { "ꈂ", 0.00000000 },
+  { "ꈃ", 0.00000000 },
+  { "ꈄ", 0.00000000 },
+  { "ꈅ", 0.00000000 },
+  { "ꈆ", 0.00000000 },
+  { "ꈇ", 0.00000000 },
+  { "ꈈ", 0.00000000 },
+  { "ꈉ", 0.00000000 },
+  { "ꈊ", 0.00000000 },
+  { "ꈋ", 0.00000000 },
+  { "ꈌ", 0.00000000 },
+  { "ꈍ", 0.00000000 },
+  { "ꈎ", 0.00000000 },
+  { "ꈏ", 0.00000000 },
+  { "ꈐ", 0.00000000 },
+  { "ꈑ", 0.00000000 },
+  { "ꈒ", 0.00000000 },
+  { "ꈓ", 0.00000000 },
+  { "ꈔ", 0.00000000 },
+  { "ꈕ", 0.00000000 },
+  { "ꈖ", 0.00000000 },
+  { "ꈗ", 0.00000000 },
+  { "ꈘ", 0.00000000 },
+  { "ꈙ", 0.00000000 },
+  { "ꈚ", 0.00000000 },
+  { "ꈛ", 0.00000000 },
+  { "ꈜ", 0.00000000 },
+  { "ꈝ", 0.00000000 },
+  { "ꈞ", 0.00000000 },
+  { "ꈟ", 0.00000000 },
+  { "ꈠ", 0.00000000 },
+  { "ꈡ", 0.00000000 },
+  { "ꈢ", 0.00000000 },
+  { "ꈣ", 0.00000000 },
+  { "ꈤ", 0.00000000 },
+  { "ꈥ", 0.00000000 },
+  { "ꈦ", 0.00000000 },
+  { "ꈧ", 0.00000000 },
+  { "ꈨ", 0.00000000 },
+  { "ꈩ", 0.00000000 },
+  { "ꈪ", 0.00000000 },
+  { "ꈫ", 0.00000000 },
+  { "ꈬ", 0.00000000 },
+  { "ꈭ", 0.00000000 },
+  { "ꈮ", 0.00000000 },
+  { "ꈯ", 0.00000000 },
+  { "ꈰ", 0.00000000 },
+  { "ꈱ", 0.00000000 },
+  { "ꈲ", 0.00000000 },
+  { "ꈳ", 0.00000000 },
+  { "ꈴ", 0.00000000 },
+  { "ꈵ", 0.00000000 },
+  { "ꈶ", 0.00000000 },
+  { "ꈷ", 0.00000000 },
+  { "ꈸ", 0.00000000 },
+  { "ꈹ", 0.00000000 },
+  { "ꈺ", 0.00000000 },
+  { "ꈻ", 0.00000000 },
+  { "ꈼ", 0.00000000 },
+  { "ꈽ", 0.00000000 },
+  { "ꈾ", 0.00000000 },
+  { "ꈿ", 0.00000000 },
+  { "ꉀ", 0.00000000 },
+  { "ꉁ", 0.00000000 },
+  { "ꉂ", 0.00000000 },
+  { "ꉃ", 0.00000000 },
+  { "ꉄ", 0.00000000 },
+  { "ꉅ", 0.00000000 },
+  { "ꉆ", 0.00000000 },
+  { "ꉇ", 0.00000000 },
+  { "ꉈ", 0.00000000 },
+  { "ꉉ", 0.00000000 },
+  { "ꉊ", 0.00000000 },
+  { "ꉋ", 0.00000000 },
+  { "ꉌ", 0.00000000 },
+  { "ꉍ", 0.00000000 },
+  { "ꉎ", 0.00000000 },
+  { "ꉏ", 0.00000000 },
+  { "ꉐ", 0.00000000 },
+  { "ꉑ", 0.00000000 },
+  { "ꉒ", 0.00000000 },
+  { "ꉓ", 0.00000000 },
+  { "ꉔ", 0.00000000 },
+  { "ꉕ", 0.00000000 },
+  { "ꉖ", 0.00000000 },
+  { "ꉗ", 0.00000000 },
+  { "ꉘ", 0.00000000 },
+  { "ꉙ", 0.00000000 },
+  { "ꉚ", 0.00000000 },
+  { "ꉛ", 0.00000000 },
+  { "ꉜ", 0.00000000 },
+  { "ꉝ", 0.00000000 },
+  { "ꉞ", 0.00000000 },
+  { "ꉟ", 0.00000000 },
+  { "ꉠ", 0.00000000 },
+  { "ꉡ", 0.00000000 },
+  { "ꉢ", 0.00000000 },
+  { "ꉣ", 0.00000000 },
+  { "ꉤ", 0.00000000 },
+  { "ꉥ", 0.00000000 },
+  { "ꉦ", 0.00000000 },
+  { "ꉧ", 0.00000000 },
+  { "ꉨ", 0.00000000 },
+  { "ꉩ", 0.00000000 },
+  { "ꉪ", 0.00000000 },
+  { "ꉫ", 0.00000000 },
+  { "ꉬ", 0.00000000 },
+  { "ꉭ", 0.00000000 },
+  { "ꉮ", 0.00000000 },
+  { "ꉯ", 0.00000000 },
+  { "ꉰ", 0.00000000 },
+  { "ꉱ", 0.00000000 },
+  { "ꉲ", 0.00000000 },
+  { "ꉳ", 0.00000000 },
+  { "ꉴ", 0.00000000 },
+  { "ꉵ", 0.00000000 },
+  { "ꉶ", 0.00000000 },
+  { "ꉷ", 0.00000000 },
+  { "ꉸ", 0.00000000 },
+  { "ꉹ", 0.00000000 },
+  { "ꉺ", 0.00000000 },
+  { "ꉻ", 0.00000000 },
+  { "ꉼ", 0.00000000 },
+  { "ꉽ", 0.00000000 },
+  { "ꉾ", 0.00000000 },
+  { "ꉿ", 0.00000000 },
+  { "ꊀ", 0.00000000 },
+  { "ꊁ", 0.00000000 },
+  { "ꊂ", 0.00000000 },
+  { "ꊃ", 0.00000000 },
+  { "ꊄ", 0.00000000 },
+  { "ꊅ", 0.00000000 },
+  { "ꊆ", 0.00000000 },
+  { "ꊇ", 0.00000000 },
+  { "ꊈ", 0.00000000 },
+  { "ꊉ", 0.00000000 },
+  { "ꊊ", 0.00000000 },
+  { "ꊋ", 0.00000000 },
+  { "ꊌ", 0.00000000 },
+  { "ꊍ", 0.00000000 },
+  { "ꊎ", 0.00000000 },
+  { "ꊏ", 0.00000000 },
+  { "ꊐ", 0.00000000 },
+  { "ꊑ", 0.00000000 },
+  { "ꊒ", 0.00000000 },
+  { "ꊓ", 0.00000000 },
+  { "ꊔ", 0.00000000 },
+  { "ꊕ", 0.00000000 },
+  { "ꊖ", 0.00000000 },
+  { "ꊗ", 0.00000000 },
+  { "ꊘ", 0.00000000 },
+  { "ꊙ", 0.00000000 },
+  { "ꊚ", 0.00000000 },
+  { "ꊛ", 0.00000000 },
+  { "ꊜ", 0.00000000 },
+  { "ꊝ", 0.00000000 },
+  { "ꊞ", 0.00000000 },
+  { "ꊟ", 0.00000000 },
+  { "ꊠ", 0.00000000 },
+  { "ꊡ", 0.00000000 },
+  { "ꊢ", 0.00000000 },
+  { "ꊣ", 0.00000000 },
+  { "ꊤ", 0.00000000 },
+  { "ꊥ", 0.00000000 },
+  { "ꊦ", 0.00000000 },
+  { "ꊧ", 0.00000000 },
+  { "ꊨ", 0.00000000 },
+  { "ꊩ", 0.00000000 },
+  { "ꊪ", 0.00000000 },
+  { "ꊫ", 0.00000000 },
+  { "ꊬ", 0.00000000 },
+  { "ꊭ", 0.00000000 },
+  { "ꊮ", 0.00000000 },
+  { "ꊯ", 0.00000000 },
+  { "ꊰ", 0.00000000 },
+  { "ꊱ", 0.00000000 },
+  { "ꊲ", 0.00000000 },
+  { "ꊳ", 0.00000000 },
+  { "ꊴ", 0.00000000 },
+  { "ꊵ", 0.00000000 },
+  { "ꊶ", 0.00000000 },
+  { "ꊷ", 0.00000000 },
+  { "ꊸ", 0.00000000 },
+  { "ꊹ", 0.00000000 },
+  { "ꊺ", 0.00000000 },
+  { "ꊻ", 0.00000000 },
+  { "ꊼ", 0.00000000 },
+  { "ꊽ", 0.00000000 },
+  { "ꊾ", 0.00000000 },
+  { "ꊿ", 0.00000000 },
+  { "ꋀ", 0.00000000 },
+  { "ꋁ", 0.00000000 },
+  { "ꋂ", 0.00000000 },
+  { "ꋃ", 0.00000000 },
+  { "ꋄ", 0.00000000 },
+  { "ꋅ", 0.00000000 },
+  { "ꋆ", 0.00000000 },
+  { "ꋇ", 0.00000000 },
+  { "ꋈ", 0.00000000 },
+  { "ꋉ", 0.00000000 },
+  { "ꋊ", 0.00000000 },
+  { "ꋋ", 0.00000000 },
+  { "ꋌ", 0.00000000 },
+  { "ꋍ", 0.00000000 },
+  { "ꋎ", 0.00000000 },
+  { "ꋏ", 0.00000000 },
+  { "ꋐ", 0.00000000 },
+  { "ꋑ", 0.00000000 },
+  { "ꋒ", 0.00000000 },
+  { "ꋓ", 0.00000000 },
+  { "ꋔ", 0.00000000 },
+  { "ꋕ", 0.00000000 },
+  { "ꋖ", 0.00000000 },
+  { "ꋗ", 0.00000000 },
+  { "ꋘ", 0.00000000 },
+  { "ꋙ", 0.00000000 },
+  { "ꋚ", 0.00000000 },
+  { "ꋛ", 0.00000000 },
+  { "ꋜ", 0.00000000 },
+  { "ꋝ", 0.00000000 },
+  { "ꋞ", 0.00000000 },
+  { "ꋟ", 0.00000000 },
+  { "ꋠ", 0.00000000 },
+  { "ꋡ", 0.00000000 },
+  { "ꋢ", 0.00000000 },
+  { "ꋣ", 0.00000000 },
+  { "ꋤ", 0.00000000 },
+  { "ꋥ", 0.00000000 },
+  { "ꋦ", 0.00000000 },
+  { "ꋧ", 0.00000000 },
+  { "ꋨ", 0.00000000 },
+  { "ꋩ", 0.00000000 },
+  { "ꋪ", 0.00000000 },
+  { "ꋫ", 0.00000000 },
+  { "ꋬ", 0.00000000 },
+  { "ꋭ", 0.00000000 },
+  { "ꋮ", 0.00000000 },
+  { "ꋯ", 0.00000000 },
+  { "ꋰ", 0.00000000 },
+  { "ꋱ", 0.00000000 },
+  { "ꋲ", 0.00000000 },
+  { "ꋳ", 0.00000000 },
+  { "ꋴ", 0.00000000 },
+  { "ꋵ", 0.00000000 },
+  { "ꋶ", 0.00000000 },
+  { "ꋷ", 0.00000000 },
+  { "ꋸ", 0.00000000 },
+  { "ꋹ", 0.00000000 },
+  { "ꋺ", 0.00000000 },
+  { "ꋻ", 0.00000000 },
+  { "ꋼ", 0.00000000 },
+  { "ꋽ", 0.00000000 },
+  { "ꋾ", 0.00000000 },
+  { "ꋿ", 0.00000000 },
+  { "ꌀ", 0.00000000 },
+  { "ꌁ", 0.00000000 },
+  { "ꌂ", 0.00000000 },
+  { "ꌃ", 0.00000000 },
+  { "ꌄ", 0.00000000 },
+  { "ꌅ", 0.00000000 },
+  { "ꌆ", 0.00000000 },
+  { "ꌇ", 0.00000000 },
+  { "ꌈ", 0.00000000 },
+  { "ꌉ", 0.00000000 },
+  { "ꌊ", 0.00000000 },
+  { "ꌋ", 0.00000000 },
+  { "ꌌ", 0.00000000 },
+  { "ꌍ", 0.00000000 },
+  { "ꌎ", 0.00000000 },
+  { "ꌏ", 0.00000000 },
+  { "ꌐ", 0.00000000 },
+  { "ꌑ", 0.00000000 },
+  { "ꌒ", 0.00000000 },
+  { "ꌓ", 0.00000000 },
+  { "ꌔ", 0.00000000 },
+  { "ꌕ", 0.00000000 },
+  { "ꌖ", 0.00000000 },
+  { "ꌗ", 0.00000000 },
+  { "ꌘ", 0.00000000 },
+  { "ꌙ", 0.00000000 },
+  { "ꌚ", 0.00000000 },
+  { "ꌛ", 0.00000000 },
+  { "ꌜ", 0.00000000 },
+  { "ꌝ", 0.00000000 },
+  { "ꌞ", 0.00000000 },
+  { "ꌟ", 0.00000000 },
+  { "ꌠ", 0.00000000 },
+  { "ꌡ", 0.00000000 },
+  { "ꌢ", 0.00000000 },
+  { "ꌣ", 0.00000000 },
+  { "ꌤ", 0.00000000 },
+  { "ꌥ", 0.00000000 },
+  { "ꌦ", 0.00000000 },
+  { "ꌧ", 0.00000000 },
+  { "ꌨ", 0.00000000 },
+  { "ꌩ", 0.00000000 },
+  { "ꌪ", 0.00000000 },
+  { "ꌫ", 0.00000000 },
+  { "ꌬ", 0.00000000 },
+  { "ꌭ", 0.00000000 },
+  { "ꌮ", 0.00000000 },
+  { "ꌯ", 0.00000000 },
+  { "ꌰ", 0.00000000 },
+  { "ꌱ", 0.00000000 },
+  { "ꌲ", 0.00000000 },
+  { "ꌳ", 0.00000000 },
+  { "ꌴ", 0.00000000 },
+  { "ꌵ", 0.00000000 },
+  { "ꌶ", 0.00000000 },
+  { "ꌷ", 0.00000000 },
+  { "ꌸ", 0.00000000 },
+  { "ꌹ", 0.00000000 },
+  { "ꌺ", 0.00000000 },
+  { "ꌻ", 0.00000000 },
+  { "ꌼ", 0.00000000 },
+  { "ꌽ", 0.00000000 },
+  { "ꌾ", 0.00000000 },
+  { "ꌿ", 0.00000000 },
+  { "ꍀ", 0.00000000 },
+  { "ꍁ", 0.00000000 },
+  { "ꍂ", 0.00000000 },
+  { "ꍃ", 0.00000000 },
+  { "ꍄ", 0.00000000 },
+  { "ꍅ", 0.00000000 },
+  { "ꍆ", 0.00000000 },
+  { "ꍇ", 0.00000000 },
+  { "ꍈ", 0.00000000 },
+  { "ꍉ", 0.00000000 },
+  { "ꍊ", 0.00000000 },
+  { "ꍋ", 0.00000000 },
+  { "ꍌ", 0.00000000 },
+  { "ꍍ", 0.00000000 },
+  { "ꍎ", 0.00000000 },
+  { "ꍏ", 0.00000000 },
+  { "ꍐ", 0.00000000 },
+  { "ꍑ", 0.00000000 },
+  { "ꍒ", 0.00000000 },
+  { "ꍓ", 0.00000000 },
+  { "ꍔ", 0.00000000 },
+  { "ꍕ", 0.00000000 },
+  { "ꍖ", 0.00000000 },
+  { "ꍗ", 0.00000000 },
+  { "ꍘ", 0.00000000 },
+  { "ꍙ", 0.00000000 },
+  { "ꍚ", 0.00000000 },
+  { "ꍛ", 0.00000000 },
+  { "ꍜ", 0.00000000 },
+  { "ꍝ", 0.00000000 },
+  { "ꍞ", 0.00000000 },
+  { "ꍟ", 0.00000000 },
+  { "ꍠ", 0.00000000 },
+  { "ꍡ", 0.00000000 },
+  { "ꍢ", 0.00000000 },
+  { "ꍣ", 0.00000000 },
+  { "ꍤ", 0.00000000 },
+  { "ꍥ", 0.00000000 },
+  { "ꍦ", 0.00000000 },
+  { "ꍧ", 0.00000000 },
+  { "ꍨ", 0.00000000 },
+  { "ꍩ", 0.00000000 },
+  { "ꍪ", 0.00000000 },
+  { "ꍫ", 0.00000000 },
+  { "ꍬ", 0.00000000 },
+  { "ꍭ", 0.00000000 },
+  { "ꍮ", 0.00000000 },
+  { "ꍯ", 0.00000000 },
+  { "ꍰ", 0.00000000 },
+  { "ꍱ", 0.00000000 },
+  { "ꍲ", 0.00000000 },
+  { "ꍳ", 0.00000000 },
+  { "ꍴ", 0.00000000 },
+  { "ꍵ", 0.00000000 },
+  { "ꍶ", 0.00000000 },
+  { "ꍷ", 0.00000000 },
+  { "ꍸ", 0.00000000 },
+  { "ꍹ", 0.00000000 },
+  { "ꍺ", 0.00000000 },
+  { "ꍻ", 0.00000000 },
+  { "ꍼ", 0.00000000 },
+  { "ꍽ", 0.00000000 },
+  { "ꍾ", 0.00000000 },
+  { "ꍿ", 0.00000000 },
+  { "ꎀ", 0.00000000 },
+  { "ꎁ", 0.00000000 },
+  { "ꎂ", 0.00000000 },
+  { "ꎃ", 0.00000000 },
+  { "ꎄ", 0.00000000 },
+  { "ꎅ", 0.00000000 },
+  { "ꎆ", 0.00000000 },
+  { "ꎇ", 0.00000000 },
+  { "ꎈ", 0.00000000 },
+  { "ꎉ", 0.00000000 },
+  { "ꎊ", 0.00000000 },
+  { "ꎋ", 0.00000000 },
+  { "ꎌ", 0.00000000 },
+  { "ꎍ", 0.00000000 },
+  { "ꎎ", 0.00000000 },
+  { "ꎏ", 0.00000000 },
+  { "ꎐ", 0.00000000 },
+  { "ꎑ", 0.00000000 },
+  { "ꎒ", 0.00000000 },
+  { "ꎓ", 0.00000000 },
+  { "ꎔ", 0.00000000 },
+  { "ꎕ", 0.00000000 },
+  { "ꎖ", 0.00000000 },
+  { "ꎗ", 0.00000000 },
+  { "ꎘ", 0.00000000 },
+  { "ꎙ", 0.00000000 },
+  { "ꎚ", 0.00000000 },
+  { "ꎛ", 0.00000000 },
+  { "ꎜ", 0.00000000 },
+  { "ꎝ", 0.00000000 },
+  { "ꎞ", 0.00000000 },
+  { "ꎟ", 0.00000000 },
+  { "ꎠ", 0.00000000 },
+  { "ꎡ", 0.00000000 },
+  { "ꎢ", 0.00000000 },
+  { "ꎣ", 0.00000000 },
+  { "ꎤ", 0.00000000 },
+  { "ꎥ", 0.00000000 },
+  { "ꎦ", 0.00000000 },
+  { "ꎧ", 0.00000000 },
+  { "ꎨ", 0.00000000 },
+  { "ꎩ", 0.00000000 },
+  { "ꎪ", 0.00000000 },
+  { "ꎫ", 0.00000000 },
+  { "ꎬ", 0.00000000 },
+  { "ꎭ", 0.00000000 },
+  { "ꎮ", 0.00000000 },
+  { "ꎯ", 0.00000000 },
+  { "ꎰ", 0.00000000 },
+  { "ꎱ", 0.00000000 },
+  { "ꎲ", 0.00000000 },
+  { "ꎳ", 0.00000000 },
+  { "ꎴ", 0.00000000 },
+  { "ꎵ", 0.00000000 },
+  { "ꎶ", 0.00000000 },
+  { "ꎷ", 0.00000000 },
+  { "ꎸ", 0.00000000 },
+  { "ꎹ", 0.00000000 },
+  { "ꎺ", 0.00000000 },
+  { "ꎻ", 0.00000000 },
+  { "ꎼ", 0.00000000 },
+  { "ꎽ", 0.00000000 },
+  { "ꎾ", 0.00000000 },
+  { "ꎿ", 0.00000000 },
+  { "ꏀ", 0.00000000 },
+  { "ꏁ", 0.00000000 },
+  { "ꏂ", 0.00000000 },
+  { "ꏃ", 0.00000000 },
+  { "ꏄ", 0.00000000 },
+  { "ꏅ", 0.00000000 },
+  { "ꏆ", 0.00000000 },
+  { "ꏇ", 0.00000000 },
+  { "ꏈ", 0.00000000 },
+  { "ꏉ", 0.00000000 },
+  { "ꏊ", 0.00000000 },
+  { "ꏋ", 0.00000000 },
+  { "ꏌ", 0.00000000 },
+  { "ꏍ", 0.00000000 },
+  { "ꏎ", 0.00000000 },
+  { "ꏏ", 0.00000000 },
+  { "ꏐ", 0.00000000 },
+  { "ꏑ", 0.00000000 },
+  { "ꏒ", 0.00000000 },
+  { "ꏓ", 0.00000000 },
+  { "ꏔ", 0.00000000 },
+  { "ꏕ", 0.00000000 },
+  { "ꏖ", 0.00000000 },
+  { "ꏗ", 0.00000000 },
+  { "ꏘ", 0.00000000 },
+  { "ꏙ", 0.00000000 },
+  { "ꏚ", 0.00000000 },
+  { "ꏛ", 0.00000000 },
+  { "ꏜ", 0.00000000 },
+  { "ꏝ", 0.00000000 },
+  { "ꏞ", 0.00000000 },
+  { "ꏟ", 0.00000000 },
+  { "ꏠ", 0.00000000 },
+  { "ꏡ", 0.00000000 },
+  { "ꏢ", 0.00000000 },
+  { "ꏣ", 0.00000000 },
+  { "ꏤ", 0.00000000 },
+  { "ꏥ", 0.00000000 },
+  { "ꏦ", 0.00000000 },
+  { "ꏧ", 0.00000000 },
+  { "ꏨ", 0.00000000 },
+  { "ꏩ", 0.00000000 },
+  { "ꏪ", 0.00000000 },
+  { "ꏫ", 0.00000000 },
+  { "ꏬ", 0.00000000 },
+  { "ꏭ", 0.00000000 },
+  { "ꏮ", 0.00000000 },
+  { "ꏯ", 0.00000000 },
+  { "ꏰ", 0.00000000 },
+  { "ꏱ", 0.00000000 },
+  { "ꏲ", 0.00000000 },
+  { "ꏳ", 0.00000000 },
+  { "ꏴ", 0.00000000 },
+  { "ꏵ", 0.00000000 },
+  { "ꏶ", 0.00000000 },
+  { "ꏷ", 0.00000000 },
+  { "ꏸ", 0.00000000 },
+  { "ꏹ", 0.00000000 },
+  { "ꏺ", 0.00000000 },
+  { "ꏻ", 0.00000000 },
+  { "ꏼ", 0.00000000 },
+  { "ꏽ", 0.00000000 },
+  { "ꏾ", 0.00000000 },
+  { "ꏿ", 0.00000000 },
+  { "ꐀ", 0.00000000 },
+  { "ꐁ", 0.00000000 },
+  { "ꐂ", 0.00000000 },
+  { "ꐃ", 0.00000000 },
+  { "ꐄ", 0.00000000 },
+  { "ꐅ", 0.00000000 },
+  { "ꐆ", 0.00000000 },
+  { "ꐇ", 0.00000000 },
+  { "ꐈ", 0.00000000 },
+  { "ꐉ", 0.00000000 },
+  { "ꐊ", 0.00000000 },
+  { "ꐋ", 0.00000000 },
+  { "ꐌ", 0.00000000 },
+  { "ꐍ", 0.00000000 },
+  { "ꐎ", 0.00000000 },
+  { "ꐏ", 0.00000000 },
+  { "ꐐ", 0.00000000 },
+  { "ꐑ", 0.00000000 },
+  { "ꐒ", 0.00000000 },
+  { "ꐓ", 0.00000000 },
+  { "ꐔ", 0.00000000 },
+  { "ꐕ", 0.00000000 },
+  { "ꐖ", 0.00000000 },
+  { "ꐗ", 0.00000000 },
+  { "ꐘ", 0.00000000 },
+  { "ꐙ", 0.00000000 },
+  { "ꐚ", 0.00000000 },
+  { "ꐛ", 0.00000000 },
+  { "ꐜ", 0.00000000 },
+  { "ꐝ", 0.00000000 },
+  { "ꐞ", 0.00000000 },
+  { "ꐟ", 0.00000000 },
+  { "ꐠ", 0.00000000 },
+  { "ꐡ", 0.00000000 },
+  { "ꐢ", 0.00000000 },
+  { "ꐣ", 0.00000000 },
+  { "ꐤ", 0.00000000 },
+  { "ꐥ", 0.00000000 },
+  { "ꐦ", 0.00000000 },
+  { "ꐧ", 0.00000000 },
+  { "ꐨ", 0.00000000 },
+  { "ꐩ", 0.00000000 },
+  { "ꐪ", 0.00000000 },
+  { "ꐫ", 0.00000000 },
+  { "ꐬ", 0.00000000 },
+  { "ꐭ", 0.00000000 },
+  { "ꐮ", 0.00000000 },
+  { "ꐯ", 0.00000000 },
+  { "ꐰ", 0.00000000 },
+  { "ꐱ", 0.00000000 },
+  { "ꐲ", 0.00000000 },
+  { "ꐳ", 0.00000000 },
+  { "ꐴ", 0.00000000 },
+  { "ꐵ", 0.00000000 },
+  { "ꐶ", 0.00000000 },
+  { "ꐷ", 0.00000000 },
+  { "ꐸ", 0.00000000 },
+  { "ꐹ", 0.00000000 },
+  { "ꐺ", 0.00000000 },
+  { "ꐻ", 0.00000000 },
+  { "ꐼ", 0.00000000 },
+  { "ꐽ", 0.00000000 },
+  { "ꐾ", 0.00000000 },
+  { "ꐿ", 0.00000000 },
+  { "ꑀ", 0.00000000 },
+  { "ꑁ", 0.00000000 },
+  { "ꑂ", 0.00000000 },
+  { "ꑃ", 0.00000000 },
+  { "ꑄ", 0.00000000 },
+  { "ꑅ", 0.00000000 },
+  { "ꑆ", 0.00000000 },
+  { "ꑇ", 0.00000000 },
+  { "ꑈ", 0.00000000 },
+  { "ꑉ", 0.00000000 },
+  { "ꑊ", 0.00000000 },
+  { "ꑋ", 0.00000000 },
+  { "ꑌ", 0.00000000 },
+  { "ꑍ", 0.00000000 },
+  { "ꑎ", 0.00000000 },
+  { "ꑏ", 0.00000000 },
+  { "ꑐ", 0.00000000 },
+  { "ꑑ", 0.00000000 },
+  { "ꑒ", 0.00000000 },
+  { "ꑓ", 0.00000000 },
+  { "ꑔ", 0.00000000 },
+  { "ꑕ", 0.00000000 },
+  { "ꑖ", 0.00000000 },
+  { "ꑗ", 0.00000000 },
+  { "ꑘ", 0.00000000 },
+  { "ꑙ", 0.00000000 },
+  { "ꑚ", 0.00000000 },
+  { "ꑛ", 0.00000000 },
+  { "ꑜ", 0.00000000 },
+  { "ꑝ", 0.00000000 },
+  { "ꑞ", 0.00000000 },
+  { "ꑟ", 0.00000000 },
+  { "ꑠ", 0.00000000 },
+  { "ꑡ", 0.00000000 },
+  { "ꑢ", 0.00000000 },
+  { "ꑣ", 0.00000000 },
+  { "ꑤ", 0.00000000 },
+  { "ꑥ", 0.00000000 },
+  { "ꑦ", 0.00000000 },
+  { "ꑧ", 0.00000000 },
+  { "ꑨ", 0.00000000 },
+  { "ꑩ", 0.00000000 },
+  { "ꑪ", 0.00000000 },
+  { "ꑫ", 0.00000000 },
+  { "ꑬ", 0.00000000 },
+  { "ꑭ", 0.00000000 },
+  { "ꑮ", 0.00000000 },
+  { "ꑯ", 0.00000000 },
+  { "ꑰ", 0.00000000 },
+  { "ꑱ", 0.00000000 },
+  { "ꑲ", 0.00000000 },
+  { "ꑳ", 0.00000000 },
+  { "ꑴ", 0.00000000 },
+  { "ꑵ", 0.00000000 },
+  { "ꑶ", 0.00000000 },
+  { "ꑷ", 0.00000000 },
+  { "ꑸ", 0.00000000 },
+  { "ꑹ", 0.00000000 },
+  { "ꑺ", 0.00000000 },
+  { "ꑻ", 0.00000000 },
+  { "ꑼ", 0.00000000 },
+  { "ꑽ", 0.00000000 },
+  { "ꑾ", 0.00000000 },
+  { "ꑿ", 0.00000000 },
+  { "ꒀ", 0.00000000 },
+  { "ꒁ", 0.00000000 },
+  { "ꒂ", 0.00000000 },
+  { "ꒃ", 0.00000000 },
+  { "ꒄ", 0.00000000 },
+  { "ꒅ", 0.00000000 },
+  { "ꒆ", 0.00000000 },
+  { "ꒇ", 0.00000000 },
+  { "ꒈ", 0.00000000 },
+  { "ꒉ", 0.00000000 },
+  { "ꒊ", 0.00000000 },
+  { "ꒋ", 0.00000000 },
+  { "ꒌ", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_111_FREQ_CPS[] = {
+  { 0xA000u, 0.00000000 },
+  { 0xA001u, 0.00000000 },
+  { 0xA002u, 0.00000000 },
+  { 0xA003u, 0.00000000 },
+  { 0xA004u, 0.00000000 },
+  { 0xA005u, 0.00000000 },
+  { 0xA006u, 0.00000000 },
+  { 0xA007u, 0.00000000 },
+  { 0xA008u, 0.00000000 },
+  { 0xA009u, 0.00000000 },
+  { 0xA00Au, 0.00000000 },
+  { 0xA00Bu, 0.00000000 },
+  { 0xA00Cu, 0.00000000 },
+  { 0xA00Du, 0.00000000 },
+  { 0xA00Eu, 0.00000000 },
+  { 0xA00Fu, 0.00000000 },
+  { 0xA010u, 0.00000000 },
+  { 0xA011u, 0.00000000 },
+  { 0xA012u, 0.00000000 },
+  { 0xA013u, 0.00000000 },
+  { 0xA014u, 0.00000000 },
+  { 0xA015u, 0.00000000 },
+  { 0xA016u, 0.00000000 },
+  { 0xA017u, 0.00000000 },
+  { 0xA018u, 0.00000000 },
+  { 0xA019u, 0.00000000 },
+  { 0xA01Au, 0.00000000 },
+  { 0xA01Bu, 0.00000000 },
+  { 0xA01Cu, 0.00000000 },
+  { 0xA01Du, 0.00000000 },
+  { 0xA01Eu, 0.00000000 },
+  { 0xA01Fu, 0.00000000 },
+  { 0xA020u, 0.00000000 },
+  { 0xA021u, 0.00000000 },
+  { 0xA022u, 0.00000000 },
+  { 0xA023u, 0.00000000 },
+  { 0xA024u, 0.00000000 },
+  { 0xA025u, 0.00000000 },
+  { 0xA026u, 0.00000000 },
+  { 0xA027u, 0.00000000 },
+  { 0xA028u, 0.00000000 },
+  { 0xA029u, 0.00000000 },
+  { 0xA02Au, 0.00000000 },
+  { 0xA02Bu, 0.00000000 },
+  { 0xA02Cu, 0.00000000 },
+  { 0xA02Du, 0.00000000 },
+  { 0xA02Eu, 0.00000000 },
+  { 0xA02Fu, 0.00000000 },
+  { 0xA030u, 0.00000000 },
+  { 0xA031u, 0.00000000 },
+  { 0xA032u, 0.00000000 },
+  { 0xA033u, 0.00000000 },
+  { 0xA034u, 0.00000000 },
+  { 0xA035u, 0.00000000 },
+  { 0xA036u, 0.00000000 },
+  { 0xA037u, 0.00000000 },
+  { 0xA038u, 0.00000000 },
+  { 0xA039u, 0.00000000 },
+  { 0xA03Au, 0.00000000 },
+  { 0xA03Bu, 0.00000000 },
+  { 0xA03Cu, 0.00000000 },
+  { 0xA03Du, 0.00000000 },
+  { 0xA03Eu, 0.00000000 },
+  { 0xA03Fu, 0.00000000 },
+  { 0xA040u, 0.00000000 },
+  { 0xA041u, 0.00000000 },
+  { 0xA042u, 0.00000000 },
+  { 0xA043u, 0.00000000 },
+  { 0xA044u, 0.00000000 },
+  { 0xA045u, 0.00000000 },
+  { 0xA046u, 0.00000000 },
+  { 0xA047u, 0.00000000 },
+  { 0xA048u, 0.00000000 },
+  { 0xA049u, 0.00000000 },
+  { 0xA04Au, 0.00000000 },
+  { 0xA04Bu, 0.00000000 },
+  { 0xA04Cu, 0.00000000 },
+  { 0xA04Du, 0.00000000 },
+  { 0xA04Eu, 0.00000000 },
+  { 0xA04Fu, 0.00000000 },
+  { 0xA050u, 0.00000000 },
+  { 0xA051u, 0.00000000 },
+  { 0xA052u, 0.00000000 },
+  { 0xA053u, 0.00000000 },
+  { 0xA054u, 0.00000000 },
+  { 0xA055u, 0.00000000 },
+  { 0xA056u, 0.00000000 },
+  { 0xA057u, 0.00000000 },
+  { 0xA058u, 0.00000000 },
+  { 0xA059u, 0.00000000 },
+  { 0xA05Au, 0.00000000 },
+  { 0xA05Bu, 0.00000000 },
+  { 0xA05Cu, 0.00000000 },
+  { 0xA05Du, 0.00000000 },
+  { 0xA05Eu, 0.00000000 },
+  { 0xA05Fu, 0.00000000 },
+  { 0xA060u, 0.00000000 },
+  { 0xA061u, 0.00000000 },
+  { 0xA062u, 0.00000000 },
+  { 0xA063u, 0.00000000 },
+  { 0xA064u, 0.00000000 },
+  { 0xA065u, 0.00000000 },
+  { 0xA066u, 0.00000000 },
+  { 0xA067u, 0.00000000 },
+  { 0xA068u, 0.00000000 },
+  { 0xA069u, 0.00000000 },
+  { 0xA06Au, 0.00000000 },
+  { 0xA06Bu, 0.00000000 },
+  { 0xA06Cu, 0.00000000 },
+  { 0xA06Du, 0.00000000 },
+  { 0xA06Eu, 0.00000000 },
+  { 0xA06Fu, 0.00000000 },
+  { 0xA070u, 0.00000000 },
+  { 0xA071u, 0.00000000 },
+  { 0xA072u, 0.00000000 },
+  { 0xA073u, 0.00000000 },
+  { 0xA074u, 0.00000000 },
+  { 0xA075u, 0.00000000 },
+  { 0xA076u, 0.00000000 },
+  { 0xA077u, 0.00000000 },
+  { 0xA078u, 0.00000000 },
+  { 0xA079u, 0.00000000 },
+  { 0xA07Au, 0.00000000 },
+  { 0xA07Bu, 0.00000000 },
+  { 0xA07Cu, 0.00000000 },
+  { 0xA07Du, 0.00000000 },
+  { 0xA07Eu, 0.00000000 },
+  { 0xA07Fu, 0.00000000 },
+  { 0xA080u, 0.00000000 },
+  { 0xA081u, 0.00000000 },
+  { 0xA082u, 0.00000000 },
+  { 0xA083u, 0.00000000 },
+  { 0xA084u, 0.00000000 },
+  { 0xA085u, 0.00000000 },
+  { 0xA086u, 0.00000000 },
+  { 0xA087u, 0.00000000 },
+  { 0xA088u, 0.00000000 },
+  { 0xA089u, 0.00000000 },
+  { 0xA08Au, 0.00000000 },
+  { 0xA08Bu, 0.00000000 },
+  { 0xA08Cu, 0.00000000 },
+  { 0xA08Du, 0.00000000 },
+  { 0xA08Eu, 0.00000000 },
+  { 0xA08Fu, 0.00000000 },
+  { 0xA090u, 0.00000000 },
+  { 0xA091u, 0.00000000 },
+  { 0xA092u, 0.00000000 },
+  { 0xA093u, 0.00000000 },
+  { 0xA094u, 0.00000000 },
+  { 0xA095u, 0.00000000 },
+  { 0xA096u, 0.00000000 },
+  { 0xA097u, 0.00000000 },
+  { 0xA098u, 0.00000000 },
+  { 0xA099u, 0.00000000 },
+  { 0xA09Au, 0.00000000 },
+  { 0xA09Bu, 0.00000000 },
+  { 0xA09Cu, 0.00000000 },
+  { 0xA09Du, 0.00000000 },
+  { 0xA09Eu, 0.00000000 },
+  { 0xA09Fu, 0.00000000 },
+  { 0xA0A0u, 0.00000000 },
+  { 0xA0A1u, 0.00000000 },
+  { 0xA0A2u, 0.00000000 },
+  { 0xA0A3u, 0.00000000 },
+  { 0xA0A4u, 0.00000000 },
+  { 0xA0A5u, 0.00000000 },
+  { 0xA0A6u, 0.00000000 },
+  { 0xA0A7u, 0.00000000 },
+  { 0xA0A8u, 0.00000000 },
+  { 0xA0A9u, 0.00000000 },
+  { 0xA0AAu, 0.00000000 },
+  { 0xA0ABu, 0.00000000 },
+  { 0xA0ACu, 0.00000000 },
+  { 0xA0ADu, 0.00000000 },
+  { 0xA0AEu, 0.00000000 },
+  { 0xA0AFu, 0.00000000 },
+  { 0xA0B0u, 0.00000000 },
+  { 0xA0B1u, 0.00000000 },
+  { 0xA0B2u, 0.00000000 },
+  { 0xA0B3u, 0.00000000 },
+  { 0xA0B4u, 0.00000000 },
+  { 0xA0B5u, 0.00000000 },
+  { 0xA0B6u, 0.00000000 },
+  { 0xA0B7u, 0.00000000 },
+  { 0xA0B8u, 0.00000000 },
+  { 0xA0B9u, 0.00000000 },
+  { 0xA0BAu, 0.00000000 },
+  { 0xA0BBu, 0.00000000 },
+  { 0xA0BCu, 0.00000000 },
+  { 0xA0BDu, 0.00000000 },
+  { 0xA0BEu, 0.00000000 },
+  { 0xA0BFu, 0.00000000 },
+  { 0xA0C0u, 0.00000000 },
+  { 0xA0C1u, 0.00000000 },
+  { 0xA0C2u, 0.00000000 },
+  { 0xA0C3u, 0.00000000 },
+  { 0xA0C4u, 0.00000000 },
+  { 0xA0C5u, 0.00000000 },
+  { 0xA0C6u, 0.00000000 },
+  { 0xA0C7u, 0.00000000 },
+  { 0xA0C8u, 0.00000000 },
+  { 0xA0C9u, 0.00000000 },
+  { 0xA0CAu, 0.00000000 },
+  { 0xA0CBu, 0.00000000 },
+  { 0xA0CCu, 0.00000000 },
+  { 0xA0CDu, 0.00000000 },
+  { 0xA0CEu, 0.00000000 },
+  { 0xA0CFu, 0.00000000 },
+  { 0xA0D0u, 0.00000000 },
+  { 0xA0D1u, 0.00000000 },
+  { 0xA0D2u, 0.00000000 },
+  { 0xA0D3u, 0.00000000 },
+  { 0xA0D4u, 0.00000000 },
+  { 0xA0D5u, 0.00000000 },
+  { 0xA0D6u, 0.00000000 },
+  { 0xA0D7u, 0.00000000 },
+  { 0xA0D8u, 0.00000000 },
+  { 0xA0D9u, 0.00000000 },
+  { 0xA0DAu, 0.00000000 },
+  { 0xA0DBu, 0.00000000 },
+  { 0xA0DCu, 0.00000000 },
+  { 0xA0DDu, 0.00000000 },
+  { 0xA0DEu, 0.00000000 },
+  { 0xA0DFu, 0.00000000 },
+  { 0xA0E0u, 0.00000000 },
+  { 0xA0E1u, 0.00000000 },
+  { 0xA0E2u, 0.00000000 },
+  { 0xA0E3u, 0.00000000 },
+  { 0xA0E4u, 0.00000000 },
+  { 0xA0E5u, 0.00000000 },
+  { 0xA0E6u, 0.00000000 },
+  { 0xA0E7u, 0.00000000 },
+  { 0xA0E8u, 0.00000000 },
+  { 0xA0E9u, 0.00000000 },
+  { 0xA0EAu, 0.00000000 },
+  { 0xA0EBu, 0.00000000 },
+  { 0xA0ECu, 0.00000000 },
+  { 0xA0EDu, 0.00000000 },
+  { 0xA0EEu, 0.00000000 },
+  { 0xA0EFu, 0.00000000 },
+  { 0xA0F0u, 0.00000000 },
+  { 0xA0F1u, 0.00000000 },
+  { 0xA0F2u, 0.00000000 },
+  { 0xA0F3u, 0.00000000 },
+  { 0xA0F4u, 0.00000000 },
+  { 0xA0F5u, 0.00000000 },
+  { 0xA0F6u, 0.00000000 },
+  { 0xA0F7u, 0.00000000 },
+  { 0xA0F8u, 0.00000000 },
+  { 0xA0F9u, 0.00000000 },
+  { 0xA0FAu, 0.00000000 },
+  { 0xA0FBu, 0.00000000 },
+  { 0xA0FCu, 0.00000000 },
+  { 0xA0FDu, 0.00000000 },
+  { 0xA0FEu, 0.00000000 },
+  { 0xA0FFu, 0.00000000 },
+  { 0xA100u, 0.00000000 },
+  { 0xA101u, 0.00000000 },
+  { 0xA102u, 0.00000000 },
+  { 0xA103u, 0.00000000 },
+  { 0xA104u, 0.00000000 },
+  { 0xA105u, 0.00000000 },
+  { 0xA106u, 0.00000000 },
+  { 0xA107u, 0.00000000 },
+  { 0xA108u, 0.00000000 },
+  { 0xA109u, 0.00000000 },
+  { 0xA10Au, 0.00000000 },
+  { 0xA10Bu, 0.00000000 },
+  { 0xA10Cu, 0.00000000 },
+  { 0xA10Du, 0.00000000 },
+  { 0xA10Eu, 0.00000000 },
+  { 0xA10Fu, 0.00000000 },
+  { 0xA110u, 0.00000000 },
+  { 0xA111u, 0.00000000 },
+  { 0xA112u, 0.00000000 },
+  { 0xA113u, 0.00000000 },
+  { 0xA114u, 0.00000000 },
+  { 0xA115u, 0.00000000 },
+  { 0xA116u, 0.00000000 },
+  { 0xA117u, 0.00000000 },
+  { 0xA118u, 0.00000000 },
+  { 0xA119u, 0.00000000 },
+  { 0xA11Au, 0.00000000 },
+  { 0xA11Bu, 0.00000000 },
+  { 0xA11Cu, 0.00000000 },
+  { 0xA11Du, 0.00000000 },
+  { 0xA11Eu, 0.00000000 },
+  { 0xA11Fu, 0.00000000 },
+  { 0xA120u, 0.00000000 },
+  { 0xA121u, 0.00000000 },
+  { 0xA122u, 0.00000000 },
+  { 0xA123u, 0.00000000 },
+  { 0xA124u, 0.00000000 },
+  { 0xA125u, 0.00000000 },
+  { 0xA126u, 0.00000000 },
+  { 0xA127u, 0.00000000 },
+  { 0xA128u, 0.00000000 },
+  { 0xA129u, 0.00000000 },
+  { 0xA12Au, 0.00000000 },
+  { 0xA12Bu, 0.00000000 },
+  { 0xA12Cu, 0.00000000 },
+  { 0xA12Du, 0.00000000 },
+  { 0xA12Eu, 0.00000000 },
+  { 0xA12Fu, 0.00000000 },
+  { 0xA130u, 0.00000000 },
+  { 0xA131u, 0.00000000 },
+  { 0xA132u, 0.00000000 },
+  { 0xA133u, 0.00000000 },
+  { 0xA134u, 0.00000000 },
+  { 0xA135u, 0.00000000 },
+  { 0xA136u, 0.00000000 },
+  { 0xA137u, 0.00000000 },
+  { 0xA138u, 0.00000000 },
+  { 0xA139u, 0.00000000 },
+  { 0xA13Au, 0.00000000 },
+  { 0xA13Bu, 0.00000000 },
+  { 0xA13Cu, 0.00000000 },
+  { 0xA13Du, 0.00000000 },
+  { 0xA13Eu, 0.00000000 },
+  { 0xA13Fu, 0.00000000 },
+  { 0xA140u, 0.00000000 },
+  { 0xA141u, 0.00000000 },
+  { 0xA142u, 0.00000000 },
+  { 0xA143u, 0.00000000 },
+  { 0xA144u, 0.00000000 },
+  { 0xA145u, 0.00000000 },
+  { 0xA146u, 0.00000000 },
+  { 0xA147u, 0.00000000 },
+  { 0xA148u, 0.00000000 },
+  { 0xA149u, 0.00000000 },
+  { 0xA14Au, 0.00000000 },
+  { 0xA14Bu, 0.00000000 },
+  { 0xA14Cu, 0.00000000 },
+  { 0xA14Du, 0.00000000 },
+  { 0xA14Eu, 0.00000000 },
+  { 0xA14Fu, 0.00000000 },
+  { 0xA150u, 0.00000000 },
+  { 0xA151u, 0.00000000 },
+  { 0xA152u, 0.00000000 },
+  { 0xA153u, 0.00000000 },
+  { 0xA154u, 0.00000000 },
+  { 0xA155u, 0.00000000 },
+  { 0xA156u, 0.00000000 },
+  { 0xA157u, 0.00000000 },
+  { 0xA158u, 0.00000000 },
+  { 0xA159u, 0.00000000 },
+  { 0xA15Au, 0.00000000 },
+  { 0xA15Bu, 0.00000000 },
+  { 0xA15Cu, 0.00000000 },
+  { 0xA15Du, 0.00000000 },
+  { 0xA15Eu, 0.00000000 },
+  { 0xA15Fu, 0.00000000 },
+  { 0xA160u, 0.00000000 },
+  { 0xA161u, 0.00000000 },
+  { 0xA162u, 0.00000000 },
+  { 0xA163u, 0.00000000 },
+  { 0xA164u, 0.00000000 },
+  { 0xA165u, 0.00000000 },
+  { 0xA166u, 0.00000000 },
+  { 0xA167u, 0.00000000 },
+  { 0xA168u, 0.00000000 },
+  { 0xA169u, 0.00000000 },
+  { 0xA16Au, 0.00000000 },
+  { 0xA16Bu, 0.00000000 },
+  { 0xA16Cu, 0.00000000 },
+  { 0xA16Du, 0.00000000 },
+  { 0xA16Eu, 0.00000000 },
+  { 0xA16Fu, 0.00000000 },
+  { 0xA170u, 0.00000000 },
+  { 0xA171u, 0.00000000 },
+  { 0xA172u, 0.00000000 },
+  { 0xA173u, 0.00000000 },
+  { 0xA174u, 0.00000000 },
+  { 0xA175u, 0.00000000 },
+  { 0xA176u, 0.00000000 },
+  { 0xA177u, 0.00000000 },
+  { 0xA178u, 0.00000000 },
+  { 0xA179u, 0.00000000 },
+  { 0xA17Au, 0.00000000 },
+  { 0xA17Bu, 0.00000000 },
+  { 0xA17Cu, 0.00000000 },
+  { 0xA17Du, 0.00000000 },
+  { 0xA17Eu, 0.00000000 },
+  { 0xA17Fu, 0.00000000 },
+  { 0xA180u, 0.00000000 },
+  { 0xA181u, 0.00000000 },
+  { 0xA182u, 0.00000000 },
+  { 0xA183u, 0.00000000 },
+  { 0xA184u, 0.00000000 },
+  { 0xA185u, 0.00000000 },
+  { 0xA186u, 0.00000000 },
+  { 0xA187u, 0.00000000 },
+  { 0xA188u, 0.00000000 },
+  { 0xA189u, 0.00000000 },
+  { 0xA18Au, 0.00000000 },
+  { 0xA18Bu, 0.00000000 },
+  { 0xA18Cu, 0.00000000 },
+  { 0xA18Du, 0.00000000 },
+  { 0xA18Eu, 0.00000000 },
+  { 0xA18Fu, 0.00000000 },
+  { 0xA190u, 0.00000000 },
+  { 0xA191u, 0.00000000 },
+  { 0xA192u, 0.00000000 },
+  { 0xA193u, 0.00000000 },
+  { 0xA194u, 0.00000000 },
+  { 0xA195u, 0.00000000 },
+  { 0xA196u, 0.00000000 },
+  { 0xA197u, 0.00000000 },
+  { 0xA198u, 0.00000000 },
+  { 0xA199u, 0.00000000 },
+  { 0xA19Au, 0.00000000 },
+  { 0xA19Bu, 0.00000000 },
+  { 0xA19Cu, 0.00000000 },
+  { 0xA19Du, 0.00000000 },
+  { 0xA19Eu, 0.00000000 },
+  { 0xA19Fu, 0.00000000 },
+  { 0xA1A0u, 0.00000000 },
+  { 0xA1A1u, 0.00000000 },
+  { 0xA1A2u, 0.00000000 },
+  { 0xA1A3u, 0.00000000 },
+  { 0xA1A4u, 0.00000000 },
+  { 0xA1A5u, 0.00000000 },
+  { 0xA1A6u, 0.00000000 },
+  { 0xA1A7u, 0.00000000 },
+  { 0xA1A8u, 0.00000000 },
+  { 0xA1A9u, 0.00000000 },
+  { 0xA1AAu, 0.00000000 },
+  { 0xA1ABu, 0.00000000 },
+  { 0xA1ACu, 0.00000000 },
+  { 0xA1ADu, 0.00000000 },
+  { 0xA1AEu, 0.00000000 },
+  { 0xA1AFu, 0.00000000 },
+  { 0xA1B0u, 0.00000000 },
+  { 0xA1B1u, 0.00000000 },
+  { 0xA1B2u, 0.00000000 },
+  { 0xA1B3u, 0.00000000 },
+  { 0xA1B4u, 0.00000000 },
+  { 0xA1B5u, 0.00000000 },
+  { 0xA1B6u, 0.00000000 },
+  { 0xA1B7u, 0.00000000 },
+  { 0xA1B8u, 0.00000000 },
+  { 0xA1B9u, 0.00000000 },
+  { 0xA1BAu, 0.00000000 },
+  { 0xA1BBu, 0.00000000 },
+  { 0xA1BCu, 0.00000000 },
+  { 0xA1BDu, 0.00000000 },
+  { 0xA1BEu, 0.00000000 },
+  { 0xA1BFu, 0.00000000 },
+  { 0xA1C0u, 0.00000000 },
+  { 0xA1C1u, 0.00000000 },
+  { 0xA1C2u, 0.00000000 },
+  { 0xA1C3u, 0.00000000 },
+  { 0xA1C4u, 0.00000000 },
+  { 0xA1C5u, 0.00000000 },
+  { 0xA1C6u, 0.00000000 },
+  { 0xA1C7u, 0.00000000 },
+  { 0xA1C8u, 0.00000000 },
+  { 0xA1C9u, 0.00000000 },
+  { 0xA1CAu, 0.00000000 },
+  { 0xA1CBu, 0.00000000 },
+  { 0xA1CCu, 0.00000000 },
+  { 0xA1CDu, 0.00000000 },
+  { 0xA1CEu, 0.00000000 },
+  { 0xA1CFu, 0.00000000 },
+  { 0xA1D0u, 0.00000000 },
+  { 0xA1D1u, 0.00000000 },
+  { 0xA1D2u, 0.00000000 },
+  { 0xA1D3u, 0.00000000 },
+  { 0xA1D4u, 0.00000000 },
+  { 0xA1D5u, 0.00000000 },
+  { 0xA1D6u, 0.00000000 },
+  { 0xA1D7u, 0.00000000 },
+  { 0xA1D8u, 0.00000000 },
+  { 0xA1D9u, 0.00000000 },
+  { 0xA1DAu, 0.00000000 },
+  { 0xA1DBu, 0.00000000 },
+  { 0xA1DCu, 0.00000000 },
+  { 0xA1DDu, 0.00000000 },
+  { 0xA1DEu, 0.00000000 },
+  { 0xA1DFu, 0.00000000 },
+  { 0xA1E0u, 0.00000000 },
+  { 0xA1E1u, 0.00000000 },
+  { 0xA1E2u, 0.00000000 },
+  { 0xA1E3u, 0.00000000 },
+  { 0xA1E4u, 0.00000000 },
+  { 0xA1E5u, 0.00000000 },
+  { 0xA1E6u, 0.00000000 },
+  { 0xA1E7u, 0.00000000 },
+  { 0xA1E8u, 0.00000000 },
+  { 0xA1E9u, 0.00000000 },
+  { 0xA1EAu, 0.00000000 },
+  { 0xA1EBu, 0.00000000 },
+  { 0xA1ECu, 0.00000000 },
+  { 0xA1EDu, 0.00000000 },
+  { 0xA1EEu, 0.00000000 },
+  { 0xA1EFu, 0.00000000 },
+  { 0xA1F0u, 0.00000000 },
+  { 0xA1F1u, 0.00000000 },
+  { 0xA1F2u, 0.00000000 },
+  { 0xA1F3u, 0.00000000 },
+  { 0xA1F4u, 0.00000000 },
+  { 0xA1F5u, 0.00000000 },
+  { 0xA1F6u, 0.00000000 },
+  { 0xA1F7u, 0.00000000 },
+  { 0xA1F8u, 0.00000000 },
+  { 0xA1F9u, 0.00000000 },
+  { 0xA1FAu, 0.00000000 },
+  { 0xA1FBu, 0.00000000 },
+  { 0xA1FCu, 0.00000000 },
+  { 0xA1FDu, 0.00000000 },
+  { 0xA1FEu, 0.00000000 },
+  { 0xA1FFu, 0.00000000 },
+  { 0xA200u, 0.00000000 },
+  { 0xA201u, 0.00000000 },
+  { 0xA202u, 0.00000000 },
+  { 0xA203u, 0.00000000 },
+  { 0xA204u, 0.00000000 },
+  { 0xA205u, 0.00000000 },
+  { 0xA206u, 0.00000000 },
+  { 0xA207u, 0.00000000 },
+  { 0xA208u, 0.00000000 },
+  { 0xA209u, 0.00000000 },
+  { 0xA20Au, 0.00000000 },
+  { 0xA20Bu, 0.00000000 },
+  { 0xA20Cu, 0.00000000 },
+  { 0xA20Du, 0.00000000 },
+  { 0xA20Eu, 0.00000000 },
+  { 0xA20Fu, 0.00000000 },
+  { 0xA210u, 0.00000000 },
+  { 0xA211u, 0.00000000 },
+  { 0xA212u, 0.00000000 },
+  { 0xA213u, 0.00000000 },
+  { 0xA214u, 0.00000000 },
+  { 0xA215u, 0.00000000 },
+  { 0xA216u, 0.00000000 },
+  { 0xA217u, 0.00000000 },
+  { 0xA218u, 0.00000000 },
+  { 0xA219u, 0.00000000 },
+  { 0xA21Au, 0.00000000 },
+  { 0xA21Bu, 0.00000000 },
+  { 0xA21Cu, 0.00000000 },
+  { 0xA21Du, 0.00000000 },
+  { 0xA21Eu, 0.00000000 },
+  { 0xA21Fu, 0.00000000 },
+  { 0xA220u, 0.00000000 },
+  { 0xA221u, 0.00000000 },
+  { 0xA222u, 0.00000000 },
+  { 0xA223u, 0.00000000 },
+  { 0xA224u, 0.00000000 },
+  { 0xA225u, 0.00000000 },
+  { 0xA226u, 0.00000000 },
+  { 0xA227u, 0.00000000 },
+  { 0xA228u, 0.00000000 },
+  { 0xA229u, 0.00000000 },
+  { 0xA22Au, 0.00000000 },
+  { 0xA22Bu, 0.00000000 },
+  { 0xA22Cu, 0.00000000 },
+  { 0xA22Du, 0.00000000 },
+  { 0xA22Eu, 0.00000000 },
+  { 0xA22Fu, 0.00000000 },
+  { 0xA230u, 0.00000000 },
+  { 0xA231u, 0.00000000 },
+  { 0xA232u, 0.00000000 },
+  { 0xA233u, 0.00000000 },
+  { 0xA234u, 0.00000000 },
+  { 0xA235u, 0.00000000 },
+  { 0xA236u, 0.00000000 },
+  { 0xA237u, 0.00000000 },
+  { 0xA238u, 0.00000000 },
+  { 0xA239u, 0.00000000 },
+  { 0xA23Au, 0.00000000 },
+  { 0xA23Bu, 0.00000000 },
+  { 0xA23Cu, 0.00000000 },
+  { 0xA23Du, 0.00000000 },
+  { 0xA23Eu, 0.00000000 },
+  { 0xA23Fu, 0.00000000 },
+  { 0xA240u, 0.00000000 },
+  { 0xA241u, 0.00000000 },
+  { 0xA242u, 0.00000000 },
+  { 0xA243u, 0.00000000 },
+  { 0xA244u, 0.00000000 },
+  { 0xA245u, 0.00000000 },
+  { 0xA246u, 0.00000000 },
+  { 0xA247u, 0.00000000 },
+  { 0xA248u, 0.00000000 },
+  { 0xA249u, 0.00000000 },
+  { 0xA24Au, 0.00000000 },
+  { 0xA24Bu, 0.00000000 },
+  { 0xA24Cu, 0.00000000 },
+  { 0xA24Du, 0.00000000 },
+  { 0xA24Eu, 0.00000000 },
+  { 0xA24Fu, 0.00000000 },
+  { 0xA250u, 0.00000000 },
+  { 0xA251u, 0.00000000 },
+  { 0xA252u, 0.00000000 },
+  { 0xA253u, 0.00000000 },
+  { 0xA254u, 0.00000000 },
+  { 0xA255u, 0.00000000 },
+  { 0xA256u, 0.00000000 },
+  { 0xA257u, 0.00000000 },
+  { 0xA258u, 0.00000000 },
+  { 0xA259u, 0.00000000 },
+  { 0xA25Au, 0.00000000 },
+  { 0xA25Bu, 0.00000000 },
+  { 0xA25Cu, 0.00000000 },
+  { 0xA25Du, 0.00000000 },
+  { 0xA25Eu, 0.00000000 },
+  { 0xA25Fu, 0.00000000 },
+  { 0xA260u, 0.00000000 },
+  { 0xA261u, 0.00000000 },
+  { 0xA262u, 0.00000000 },
+  { 0xA263u, 0.00000000 },
+  { 0xA264u, 0.00000000 },
+  { 0xA265u, 0.00000000 },
+  { 0xA266u, 0.00000000 },
+  { 0xA267u, 0.00000000 },
+  { 0xA268u, 0.00000000 },
+  { 0xA269u, 0.00000000 },
+  { 0xA26Au, 0.00000000 },
+  { 0xA26Bu, 0.00000000 },
+  { 0xA26Cu, 0.00000000 },
+  { 0xA26Du, 0.00000000 },
+  { 0xA26Eu, 0.00000000 },
+  { 0xA26Fu, 0.00000000 },
+  { 0xA270u, 0.00000000 },
+  { 0xA271u, 0.00000000 },
+  { 0xA272u, 0.00000000 },
+  { 0xA273u, 0.00000000 },
+  { 0xA274u, 0.00000000 },
+  { 0xA275u, 0.00000000 },
+  { 0xA276u, 0.00000000 },
+  { 0xA277u, 0.00000000 },
+  { 0xA278u, 0.00000000 },
+  { 0xA279u, 0.00000000 },
+  { 0xA27Au, 0.00000000 },
+  { 0xA27Bu, 0.00000000 },
+  { 0xA27Cu, 0.00000000 },
+  { 0xA27Du, 0.00000000 },
+  { 0xA27Eu, 0.00000000 },
+  { 0xA27Fu, 0.00000000 },
+  { 0xA280u, 0.00000000 },
+  { 0xA281u, 0.00000000 },
+  { 0xA282u, 0.00000000 },
+  { 0xA283u, 0.00000000 },
+  { 0xA284u, 0.00000000 },
+  { 0xA285u, 0.00000000 },
+  { 0xA286u, 0.00000000 },
+  { 0xA287u, 0.00000000 },
+  { 0xA288u, 0.00000000 },
+  { 0xA289u, 0.00000000 },
+  { 0xA28Au, 0.00000000 },
+  { 0xA28Bu, 0.00000000 },
+  { 0xA28Cu, 0.00000000 },
+  { 0xA28Du, 0.00000000 },
+  { 0xA28Eu, 0.00000000 },
+  { 0xA28Fu, 0.00000000 },
+  { 0xA290u, 0.00000000 },
+  { 0xA291u, 0.00000000 },
+  { 0xA292u, 0.00000000 },
+  { 0xA293u, 0.00000000 },
+  { 0xA294u, 0.00000000 },
+  { 0xA295u, 0.00000000 },
+  { 0xA296u, 0.00000000 },
+  { 0xA297u, 0.00000000 },
+  { 0xA298u, 0.00000000 },
+  { 0xA299u, 0.00000000 },
+  { 0xA29Au, 0.00000000 },
+  { 0xA29Bu, 0.00000000 },
+  { 0xA29Cu, 0.00000000 },
+  { 0xA29Du, 0.00000000 },
+  { 0xA29Eu, 0.00000000 },
+  { 0xA29Fu, 0.00000000 },
+  { 0xA2A0u, 0.00000000 },
+  { 0xA2A1u, 0.00000000 },
+  { 0xA2A2u, 0.00000000 },
+  { 0xA2A3u, 0.00000000 },
+  { 0xA2A4u, 0.00000000 },
+  { 0xA2A5u, 0.00000000 },
+  { 0xA2A6u, 0.00000000 },
+  { 0xA2A7u, 0.00000000 },
+  { 0xA2A8u, 0.00000000 },
+  { 0xA2A9u, 0.00000000 },
+  { 0xA2AAu, 0.00000000 },
+  { 0xA2ABu, 0.00000000 },
+  { 0xA2ACu, 0.00000000 },
+  { 0xA2ADu, 0.00000000 },
+  { 0xA2AEu, 0.00000000 },
+  { 0xA2AFu, 0.00000000 },
+  { 0xA2B0u, 0.00000000 },
+  { 0xA2B1u, 0.00000000 },
+  { 0xA2B2u, 0.00000000 },
+  { 0xA2B3u, 0.00000000 },
+  { 0xA2B4u, 0.00000000 },
+  { 0xA2B5u, 0.00000000 },
+  { 0xA2B6u, 0.00000000 },
+  { 0xA2B7u, 0.00000000 },
+  { 0xA2B8u, 0.00000000 },
+  { 0xA2B9u, 0.00000000 },
+  { 0xA2BAu, 0.00000000 },
+  { 0xA2BBu, 0.00000000 },
+  { 0xA2BCu, 0.00000000 },
+  { 0xA2BDu, 0.00000000 },
+  { 0xA2BEu, 0.00000000 },
+  { 0xA2BFu, 0.00000000 },
+  { 0xA2C0u, 0.00000000 },
+  { 0xA2C1u, 0.00000000 },
+  { 0xA2C2u, 0.00000000 },
+  { 0xA2C3u, 0.00000000 },
+  { 0xA2C4u, 0.00000000 },
+  { 0xA2C5u, 0.00000000 },
+  { 0xA2C6u, 0.00000000 },
+  { 0xA2C7u, 0.00000000 },
+  { 0xA2C8u, 0.00000000 },
+  { 0xA2C9u, 0.00000000 },
+  { 0xA2CAu, 0.00000000 },
+  { 0xA2CBu, 0.00000000 },
+  { 0xA2CCu, 0.00000000 },
+  { 0xA2CDu, 0.00000000 },
+  { 0xA2CEu, 0.00000000 },
+  { 0xA2CFu, 0.00000000 },
+  { 0xA2D0u, 0.00000000 },
+  { 0xA2D1u, 0.00000000 },
+  { 0xA2D2u, 0.00000000 },
+  { 0xA2D3u, 0.00000000 },
+  { 0xA2D4u, 0.00000000 },
+  { 0xA2D5u, 0.00000000 },
+  { 0xA2D6u, 0.00000000 },
+  { 0xA2D7u, 0.00000000 },
+  { 0xA2D8u, 0.00000000 },
+  { 0xA2D9u, 0.00000000 },
+  { 0xA2DAu, 0.00000000 },
+  { 0xA2DBu, 0.00000000 },
+  { 0xA2DCu, 0.00000000 },
+  { 0xA2DDu, 0.00000000 },
+  { 0xA2DEu, 0.00000000 },
+  { 0xA2DFu, 0.00000000 },
+  { 0xA2E0u, 0.00000000 },
+  { 0xA2E1u, 0.00000000 },
+  { 0xA2E2u, 0.00000000 },
+  { 0xA2E3u, 0.00000000 },
+  { 0xA2E4u, 0.00000000 },
+  { 0xA2E5u, 0.00000000 },
+  { 0xA2E6u, 0.00000000 },
+  { 0xA2E7u, 0.00000000 },
+  { 0xA2E8u, 0.00000000 },
+  { 0xA2E9u, 0.00000000 },
+  { 0xA2EAu, 0.00000000 },
+  { 0xA2EBu, 0.00000000 },
+  { 0xA2ECu, 0.00000000 },
+  { 0xA2EDu, 0.00000000 },
+  { 0xA2EEu, 0.00000000 },
+  { 0xA2EFu, 0.00000000 },
+  { 0xA2F0u, 0.00000000 },
+  { 0xA2F1u, 0.00000000 },
+  { 0xA2F2u, 0.00000000 },
+  { 0xA2F3u, 0.00000000 },
+  { 0xA2F4u, 0.00000000 },
+  { 0xA2F5u, 0.00000000 },
+  { 0xA2F6u, 0.00000000 },
+  { 0xA2F7u, 0.00000000 },
+  { 0xA2F8u, 0.00000000 },
+  { 0xA2F9u, 0.00000000 },
+  { 0xA2FAu, 0.00000000 },
+  { 0xA2FBu, 0.00000000 },
+  { 0xA2FCu, 0.00000000 },
+  { 0xA2FDu, 0.00000000 },
+  { 0xA2FEu, 0.00000000 },
+  { 0xA2FFu, 0.00000000 },
+  { 0xA300u, 0.00000000 },
+  { 0xA301u, 0.00000000 },
+  { 0xA302u, 0.00000000 },
+  { 0xA303u, 0.00000000 },
+  { 0xA304u, 0.00000000 },
+  { 0xA305u, 0.00000000 },
+  { 0xA306u, 0.00000000 },
+  { 0xA307u, 0.00000000 },
+  { 0xA308u, 0.00000000 },
+  { 0xA309u, 0.00000000 },
+  { 0xA30Au, 0.00000000 },
+  { 0xA30Bu, 0.00000000 },
+  { 0xA30Cu, 0.00000000 },
+  { 0xA30Du, 0.00000000 },
+  { 0xA30Eu, 0.00000000 },
+  { 0xA30Fu, 0.00000000 },
+  { 0xA310u, 0.00000000 },
+  { 0xA311u, 0.00000000 },
+  { 0xA312u, 0.00000000 },
+  { 0xA313u, 0.00000000 },
+  { 0xA314u, 0.00000000 },
+  { 0xA315u, 0.00000000 },
+  { 0xA316u, 0.00000000 },
+  { 0xA317u, 0.00000000 },
+  { 0xA318u, 0.00000000 },
+  { 0xA319u, 0.00000000 },
+  { 0xA31Au, 0.00000000 },
+  { 0xA31Bu, 0.00000000 },
+  { 0xA31Cu, 0.00000000 },
+  { 0xA31Du, 0.00000000 },
+  { 0xA31Eu, 0.00000000 },
+  { 0xA31Fu, 0.00000000 },
+  { 0xA320u, 0.00000000 },
+  { 0xA321u, 0.00000000 },
+  { 0xA322u, 0.00000000 },
+  { 0xA323u, 0.00000000 },
+  { 0xA324u, 0.00000000 },
+  { 0xA325u, 0.00000000 },
+  { 0xA326u, 0.00000000 },
+  { 0xA327u, 0.00000000 },
+  { 0xA328u, 0.00000000 },
+  { 0xA329u, 0.00000000 },
+  { 0xA32Au, 0.00000000 },
+  { 0xA32Bu, 0.00000000 },
+  { 0xA32Cu, 0.00000000 },
+  { 0xA32Du, 0.00000000 },
+  { 0xA32Eu, 0.00000000 },
+  { 0xA32Fu, 0.00000000 },
+  { 0xA330u, 0.00000000 },
+  { 0xA331u, 0.00000000 },
+  { 0xA332u, 0.00000000 },
+  { 0xA333u, 0.00000000 },
+  { 0xA334u, 0.00000000 },
+  { 0xA335u, 0.00000000 },
+  { 0xA336u, 0.00000000 },
+  { 0xA337u, 0.00000000 },
+  { 0xA338u, 0.00000000 },
+  { 0xA339u, 0.00000000 },
+  { 0xA33Au, 0.00000000 },
+  { 0xA33Bu, 0.00000000 },
+  { 0xA33Cu, 0.00000000 },
+  { 0xA33Du, 0.00000000 },
+  { 0xA33Eu, 0.00000000 },
+  { 0xA33Fu, 0.00000000 },
+  { 0xA340u, 0.00000000 },
+  { 0xA341u, 0.00000000 },
+  { 0xA342u, 0.00000000 },
+  { 0xA343u, 0.00000000 },
+  { 0xA344u, 0.00000000 },
+  { 0xA345u, 0.00000000 },
+  { 0xA346u, 0.00000000 },
+  { 0xA347u, 0.00000000 },
+  { 0xA348u, 0.00000000 },
+  { 0xA349u, 0.00000000 },
+  { 0xA34Au, 0.00000000 },
+  { 0xA34Bu, 0.00000000 },
+  { 0xA34Cu, 0.00000000 },
+  { 0xA34Du, 0.00000000 },
+  { 0xA34Eu, 0.00000000 },
+  { 0xA34Fu, 0.00000000 },
+  { 0xA350u, 0.00000000 },
+  { 0xA351u, 0.00000000 },
+  { 0xA352u, 0.00000000 },
+  { 0xA353u, 0.00000000 },
+  { 0xA354u, 0.00000000 },
+  { 0xA355u, 0.00000000 },
+  { 0xA356u, 0.00000000 },
+  { 0xA357u, 0.00000000 },
+  { 0xA358u, 0.00000000 },
+  { 0xA359u, 0.00000000 },
+  { 0xA35Au, 0.00000000 },
+  { 0xA35Bu, 0.00000000 },
+  { 0xA35Cu, 0.00000000 },
+  { 0xA35Du, 0.00000000 },
+  { 0xA35Eu, 0.00000000 },
+  { 0xA35Fu, 0.00000000 },
+  { 0xA360u, 0.00000000 },
+  { 0xA361u, 0.00000000 },
+  { 0xA362u, 0.00000000 },
+  { 0xA363u, 0.00000000 },
+  { 0xA364u, 0.00000000 },
+  { 0xA365u, 0.00000000 },
+  { 0xA366u, 0.00000000 },
+  { 0xA367u, 0.00000000 },
+  { 0xA368u, 0.00000000 },
+  { 0xA369u, 0.00000000 },
+  { 0xA36Au, 0.00000000 },
+  { 0xA36Bu, 0.00000000 },
+  { 0xA36Cu, 0.00000000 },
+  { 0xA36Du, 0.00000000 },
+  { 0xA36Eu, 0.00000000 },
+  { 0xA36Fu, 0.00000000 },
+  { 0xA370u, 0.00000000 },
+  { 0xA371u, 0.00000000 },
+  { 0xA372u, 0.00000000 },
+  { 0xA373u, 0.00000000 },
+  { 0xA374u, 0.00000000 },
+  { 0xA375u, 0.00000000 },
+  { 0xA376u, 0.00000000 },
+  { 0xA377u, 0.00000000 },
+  { 0xA378u, 0.00000000 },
+  { 0xA379u, 0.00000000 },
+  { 0xA37Au, 0.00000000 },
+  { 0xA37Bu, 0.00000000 },
+  { 0xA37Cu, 0.00000000 },
+  { 0xA37Du, 0.00000000 },
+  { 0xA37Eu, 0.00000000 },
+  { 0xA37Fu, 0.00000000 },
+  { 0xA380u, 0.00000000 },
+  { 0xA381u, 0.00000000 },
+  { 0xA382u, 0.00000000 },
+  { 0xA383u, 0.00000000 },
+  { 0xA384u, 0.00000000 },
+  { 0xA385u, 0.00000000 },
+  { 0xA386u, 0.00000000 },
+  { 0xA387u, 0.00000000 },
+  { 0xA388u, 0.00000000 },
+  { 0xA389u, 0.00000000 },
+  { 0xA38Au, 0.00000000 },
+  { 0xA38Bu, 0.00000000 },
+  { 0xA38Cu, 0.00000000 },
+  { 0xA38Du, 0.00000000 },
+  { 0xA38Eu, 0.00000000 },
+  { 0xA38Fu, 0.00000000 },
+  { 0xA390u, 0.00000000 },
+  { 0xA391u, 0.00000000 },
+  { 0xA392u, 0.00000000 },
+  { 0xA393u, 0.00000000 },
+  { 0xA394u, 0.00000000 },
+  { 0xA395u, 0.00000000 },
+  { 0xA396u, 0.00000000 },
+  { 0xA397u, 0.00000000 },
+  { 0xA398u, 0.00000000 },
+  { 0xA399u, 0.00000000 },
+  { 0xA39Au, 0.00000000 },
+  { 0xA39Bu, 0.00000000 },
+  { 0xA39Cu, 0.00000000 },
+  { 0xA39Du, 0.00000000 },
+  { 0xA39Eu, 0.00000000 },
+  { 0xA39Fu, 0.00000000 },
+  { 0xA3A0u, 0.00000000 },
+  { 0xA3A1u, 0.00000000 },
+  { 0xA3A2u, 0.00000000 },
+  { 0xA3A3u, 0.00000000 },
+  { 0xA3A4u, 0.00000000 },
+  { 0xA3A5u, 0.00000000 },
+  { 0xA3A6u, 0.00000000 },
+  { 0xA3A7u, 0.00000000 },
+  { 0xA3A8u, 0.00000000 },
+  { 0xA3A9u, 0.00000000 },
+  { 0xA3AAu, 0.00000000 },
+  { 0xA3ABu, 0.00000000 },
+  { 0xA3ACu, 0.00000000 },
+  { 0xA3ADu, 0.00000000 },
+  { 0xA3AEu, 0.00000000 },
+  { 0xA3AFu, 0.00000000 },
+  { 0xA3B0u, 0.00000000 },
+  { 0xA3B1u, 0.00000000 },
+  { 0xA3B2u, 0.00000000 },
+  { 0xA3B3u, 0.00000000 },
+  { 0xA3B4u, 0.00000000 },
+  { 0xA3B5u, 0.00000000 },
+  { 0xA3B6u, 0.00000000 },
+  { 0xA3B7u, 0.00000000 },
+  { 0xA3B8u, 0.00000000 },
+  { 0xA3B9u, 0.00000000 },
+  { 0xA3BAu, 0.00000000 },
+  { 0xA3BBu, 0.00000000 },
+  { 0xA3BCu, 0.00000000 },
+  { 0xA3BDu, 0.00000000 },
+  { 0xA3BEu, 0.00000000 },
+  { 0xA3BFu, 0.00000000 },
+  { 0xA3C0u, 0.00000000 },
+  { 0xA3C1u, 0.00000000 },
+  { 0xA3C2u, 0.00000000 },
+  { 0xA3C3u, 0.00000000 },
+  { 0xA3C4u, 0.00000000 },
+  { 0xA3C5u, 0.00000000 },
+  { 0xA3C6u, 0.00000000 },
+  { 0xA3C7u, 0.00000000 },
+  { 0xA3C8u, 0.00000000 },
+  { 0xA3C9u, 0.00000000 },
+  { 0xA3CAu, 0.00000000 },
+  { 0xA3CBu, 0.00000000 },
+  { 0xA3CCu, 0.00000000 },
+  { 0xA3CDu, 0.00000000 },
+  { 0xA3CEu, 0.00000000 },
+  { 0xA3CFu, 0.00000000 },
+  { 0xA3D0u, 0.00000000 },
+  { 0xA3D1u, 0.00000000 },
+  { 0xA3D2u, 0.00000000 },
+  { 0xA3D3u, 0.00000000 },
+  { 0xA3D4u, 0.00000000 },
+  { 0xA3D5u, 0.00000000 },
+  { 0xA3D6u, 0.00000000 },
+  { 0xA3D7u, 0.00000000 },
+  { 0xA3D8u, 0.00000000 },
+  { 0xA3D9u, 0.00000000 },
+  { 0xA3DAu, 0.00000000 },
+  { 0xA3DBu, 0.00000000 },
+  { 0xA3DCu, 0.00000000 },
+  { 0xA3DDu, 0.00000000 },
+  { 0xA3DEu, 0.00000000 },
+  { 0xA3DFu, 0.00000000 },
+  { 0xA3E0u, 0.00000000 },
+  { 0xA3E1u, 0.00000000 },
+  { 0xA3E2u, 0.00000000 },
+  { 0xA3E3u, 0.00000000 },
+  { 0xA3E4u, 0.00000000 },
+  { 0xA3E5u, 0.00000000 },
+  { 0xA3E6u, 0.00000000 },
+  { 0xA3E7u, 0.00000000 },
+  { 0xA3E8u, 0.00000000 },
+  { 0xA3E9u, 0.00000000 },
+  { 0xA3EAu, 0.00000000 },
+  { 0xA3EBu, 0.00000000 },
+  { 0xA3ECu, 0.00000000 },
+  { 0xA3EDu, 0.00000000 },
+  { 0xA3EEu, 0.00000000 },
+  { 0xA3EFu, 0.00000000 },
+  { 0xA3F0u, 0.00000000 },
+  { 0xA3F1u, 0.00000000 },
+  { 0xA3F2u, 0.00000000 },
+  { 0xA3F3u, 0.00000000 },
+  { 0xA3F4u, 0.00000000 },
+  { 0xA3F5u, 0.00000000 },
+  { 0xA3F6u, 0.00000000 },
+  { 0xA3F7u, 0.00000000 },
+  { 0xA3F8u, 0.00000000 },
+  { 0xA3F9u, 0.00000000 },
+  { 0xA3FAu, 0.00000000 },
+  { 0xA3FBu, 0.00000000 },
+  { 0xA3FCu, 0.00000000 },
+  { 0xA3FDu, 0.00000000 },
+  { 0xA3FEu, 0.00000000 },
+  { 0xA3FFu, 0.00000000 },
+  { 0xA400u, 0.00000000 },
+  { 0xA401u, 0.00000000 },
+  { 0xA402u, 0.00000000 },
+  { 0xA403u, 0.00000000 },
+  { 0xA404u, 0.00000000 },
+  { 0xA405u, 0.00000000 },
+  { 0xA406u, 0.00000000 },
+  { 0xA407u, 0.00000000 },
+  { 0xA408u, 0.00000000 },
+  { 0xA409u, 0.00000000 },
+  { 0xA40Au, 0.00000000 },
+  { 0xA40Bu, 0.00000000 },
+  { 0xA40Cu, 0.00000000 },
+  { 0xA40Du, 0.00000000 },
+  { 0xA40Eu, 0.00000000 },
+  { 0xA40Fu, 0.00000000 },
+  { 0xA410u, 0.00000000 },
+  { 0xA411u, 0.00000000 },
+  { 0xA412u, 0.00000000 },
+  { 0xA413u, 0.00000000 },
+  { 0xA414u, 0.00000000 },
+  { 0xA415u, 0.00000000 },
+  { 0xA416u, 0.00000000 },
+  { 0xA417u, 0.00000000 },
+  { 0xA418u, 0.00000000 },
+  { 0xA419u, 0.00000000 },
+  { 0xA41Au, 0.00000000 },
+  { 0xA41Bu, 0.00000000 },
+  { 0xA41Cu, 0.00000000 },
+  { 0xA41Du, 0.00000000 },
+  { 0xA41Eu, 0.00000000 },
+  { 0xA41Fu, 0.00000000 },
+  { 0xA420u, 0.00000000 },
+  { 0xA421u, 0.00000000 },
+  { 0xA422u, 0.00000000 },
+  { 0xA423u, 0.00000000 },
+  { 0xA424u, 0.00000000 },
+  { 0xA425u, 0.00000000 },
+  { 0xA426u, 0.00000000 },
+  { 0xA427u, 0.00000000 },
+  { 0xA428u, 0.00000000 },
+  { 0xA429u, 0.00000000 },
+  { 0xA42Au, 0.00000000 },
+  { 0xA42Bu, 0.00000000 },
+  { 0xA42Cu, 0.00000000 },
+  { 0xA42Du, 0.00000000 },
+  { 0xA42Eu, 0.00000000 },
+  { 0xA42Fu, 0.00000000 },
+  { 0xA430u, 0.00000000 },
+  { 0xA431u, 0.00000000 },
+  { 0xA432u, 0.00000000 },
+  { 0xA433u, 0.00000000 },
+  { 0xA434u, 0.00000000 },
+  { 0xA435u, 0.00000000 },
+  { 0xA436u, 0.00000000 },
+  { 0xA437u, 0.00000000 },
+  { 0xA438u, 0.00000000 },
+  { 0xA439u, 0.00000000 },
+  { 0xA43Au, 0.00000000 },
+  { 0xA43Bu, 0.00000000 },
+  { 0xA43Cu, 0.00000000 },
+  { 0xA43Du, 0.00000000 },
+  { 0xA43Eu, 0.00000000 },
+  { 0xA43Fu, 0.00000000 },
+  { 0xA440u, 0.00000000 },
+  { 0xA441u, 0.00000000 },
+  { 0xA442u, 0.00000000 },
+  { 0xA443u, 0.00000000 },
+  { 0xA444u, 0.00000000 },
+  { 0xA445u, 0.00000000 },
+  { 0xA446u, 0.00000000 },
+  { 0xA447u, 0.00000000 },
+  { 0xA448u, 0.00000000 },
+  { 0xA449u, 0.00000000 },
+  { 0xA44Au, 0.00000000 },
+  { 0xA44Bu, 0.00000000 },
+  { 0xA44Cu, 0.00000000 },
+  { 0xA44Du, 0.00000000 },
+  { 0xA44Eu, 0.00000000 },
+  { 0xA44Fu, 0.00000000 },
+  { 0xA450u, 0.00000000 },
+  { 0xA451u, 0.00000000 },
+  { 0xA452u, 0.00000000 },
+  { 0xA453u, 0.00000000 },
+  { 0xA454u, 0.00000000 },
+  { 0xA455u, 0.00000000 },
+  { 0xA456u, 0.00000000 },
+  { 0xA457u, 0.00000000 },
+  { 0xA458u, 0.00000000 },
+  { 0xA459u, 0.00000000 },
+  { 0xA45Au, 0.00000000 },
+  { 0xA45Bu, 0.00000000 },
+  { 0xA45Cu, 0.00000000 },
+  { 0xA45Du, 0.00000000 },
+  { 0xA45Eu, 0.00000000 },
+  { 0xA45Fu, 0.00000000 },
+  { 0xA460u, 0.00000000 },
+  { 0xA461u, 0.00000000 },
+  { 0xA462u, 0.00000000 },
+  { 0xA463u, 0.00000000 },
+  { 0xA464u, 0.00000000 },
+  { 0xA465u, 0.00000000 },
+  { 0xA466u, 0.00000000 },
+  { 0xA467u, 0.00000000 },
+  { 0xA468u, 0.00000000 },
+  { 0xA469u, 0.00000000 },
+  { 0xA46Au, 0.00000000 },
+  { 0xA46Bu, 0.00000000 },
+  { 0xA46Cu, 0.00000000 },
+  { 0xA46Du, 0.00000000 },
+  { 0xA46Eu, 0.00000000 },
+  { 0xA46Fu, 0.00000000 },
+  { 0xA470u, 0.00000000 },
+  { 0xA471u, 0.00000000 },
+  { 0xA472u, 0.00000000 },
+  { 0xA473u, 0.00000000 },
+  { 0xA474u, 0.00000000 },
+  { 0xA475u, 0.00000000 },
+  { 0xA476u, 0.00000000 },
+  { 0xA477u, 0.00000000 },
+  { 0xA478u, 0.00000000 },
+  { 0xA479u, 0.00000000 },
+  { 0xA47Au, 0.00000000 },
+  { 0xA47Bu, 0.00000000 },
+  { 0xA47Cu, 0.00000000 },
+  { 0xA47Du, 0.00000000 },
+  { 0xA47Eu, 0.00000000 },
+  { 0xA47Fu, 0.00000000 },
+  { 0xA480u, 0.00000000 },
+  { 0xA481u, 0.00000000 },
+  { 0xA482u, 0.00000000 },
+  { 0xA483u, 0.00000000 },
+  { 0xA484u, 0.00000000 },
+  { 0xA485u, 0.00000000 },
+  { 0xA486u, 0.00000000 },
+  { 0xA487u, 0.00000000 },
+  { 0xA488u, 0.00000000 },
+  { 0xA489u, 0.00000000 },
+  { 0xA48Au, 0.00000000 },
+  { 0xA48Bu, 0.00000000 },
+  { 0xA48Cu, 0.00000000 },
+};
+
@@ -0,0 +1,129 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_112_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+};
+const char *ALPHA_112_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+};
+const char *ALPHA_112_DIGITS[] = {
+};
+const uint32_t ALPHA_112_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90,
+};
+const uint32_t ALPHA_112_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122,
+};
+const uint32_t ALPHA_112_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_112_FREQ[] = {
+  { "a", 0.14670000 },
+  { "b", 0.01450000 },
+  { "c", 0.00870000 },
+  { "d", 0.04110000 },
+  { "e", 0.10070000 },
+  { "f", 0.01010000 },
+  { "g", 0.01160000 },
+  { "h", 0.01680000 },
+  { "i", 0.09810000 },
+  { "j", 0.00480000 },
+  { "k", 0.02210000 },
+  { "l", 0.06240000 },
+  { "m", 0.03830000 },
+  { "n", 0.05840000 },
+  { "o", 0.08960000 },
+  { "p", 0.02510000 },
+  { "q", 0.00710000 },
+  { "r", 0.05210000 },
+  { "s", 0.07750000 },
+  { "t", 0.03540000 },
+  { "u", 0.04470000 },
+  { "v", 0.01780000 },
+  { "w", 0.00090000 },
+  { "x", 0.00110000 },
+  { "y", 0.00530000 },
+  { "z", 0.00920000 },
+};
+
+const wa_cp_freq ALPHA_112_FREQ_CPS[] = {
+  { 0x61u, 0.14670000 },
+  { 0x62u, 0.01450000 },
+  { 0x63u, 0.00870000 },
+  { 0x64u, 0.04110000 },
+  { 0x65u, 0.10070000 },
+  { 0x66u, 0.01010000 },
+  { 0x67u, 0.01160000 },
+  { 0x68u, 0.01680000 },
+  { 0x69u, 0.09810000 },
+  { 0x6Au, 0.00480000 },
+  { 0x6Bu, 0.02210000 },
+  { 0x6Cu, 0.06240000 },
+  { 0x6Du, 0.03830000 },
+  { 0x6Eu, 0.05840000 },
+  { 0x6Fu, 0.08960000 },
+  { 0x70u, 0.02510000 },
+  { 0x71u, 0.00710000 },
+  { 0x72u, 0.05210000 },
+  { 0x73u, 0.07750000 },
+  { 0x74u, 0.03540000 },
+  { 0x75u, 0.04470000 },
+  { 0x76u, 0.01780000 },
+  { 0x77u, 0.00090000 },
+  { 0x78u, 0.00110000 },
+  { 0x79u, 0.00530000 },
+  { 0x7Au, 0.00920000 },
+};
+
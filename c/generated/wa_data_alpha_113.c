@@ -0,0 +1,153 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_113_UPPER[] = {
+  "A",
+  "Á",
+  "B",
+  "D",
+  "Ð",
+  "E",
+  "É",
+  "F",
+  "G",
+  "H",
+  "I",
+  "Í",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "Ó",
+  "P",
+  "R",
+  "S",
+  "T",
+  "U",
+  "Ú",
+  "V",
+  "X",
+  "Y",
+  "Ý",
+  "Þ",
+  "Æ",
+  "Ö",
+};
+const char *ALPHA_113_LOWER[] = {
+  "a",
+  "á",
+  "b",
+  "d",
+  "ð",
+  "e",
+  "é",
+  "f",
+  "g",
+  "h",
+  "i",
+  "í",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "ó",
+  "p",
+  "r",
+  "s",
+  "t",
+  "u",
+  "ú",
+  "v",
+  "x",
+  "y",
+  "ý",
+  "þ",
+  "æ",
+  "ö",
+};
+const char *ALPHA_113_DIGITS[] = {
+};
+const uint32_t ALPHA_113_UPPER_CPS[] = {
+  65, 66, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 82,
+  83, 84, 85, 86, 88, 89, 193, 198, 201, 205, 208, 211, 214, 218, 221, 222,
+};
+const uint32_t ALPHA_113_LOWER_CPS[] = {
+  97, 98, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 114,
+  115, 116, 117, 118, 120, 121, 225, 230, 233, 237, 240, 243, 246, 250, 253, 254,
+};
+const uint32_t ALPHA_113_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_113_FREQ[] = {
+  { "a", 0.09650000 },
+  { "á", 0.01680000 },
+  { "b", 0.01120000 },
+  { "d", 0.01970000 },
+  { "ð", 0.03680000 },
+  { "e", 0.06260000 },
+  { "é", 0.00300000 },
+  { "f", 0.02970000 },
+  { "g", 0.03730000 },
+  { "h", 0.02000000 },
+  { "i", 0.07490000 },
+  { "í", 0.01780000 },
+  { "j", 0.01170000 },
+  { "k", 0.03130000 },
+  { "l", 0.04680000 },
+  { "m", 0.03700000 },
+  { "n", 0.08320000 },
+  { "o", 0.02550000 },
+  { "ó", 0.01120000 },
+  { "p", 0.00950000 },
+  { "r", 0.09120000 },
+  { "s", 0.06180000 },
+  { "t", 0.05090000 },
+  { "u", 0.04690000 },
+  { "ú", 0.00590000 },
+  { "v", 0.02110000 },
+  { "x", 0.00070000 },
+  { "y", 0.00950000 },
+  { "ý", 0.00250000 },
+  { "þ", 0.01100000 },
+  { "æ", 0.00770000 },
+  { "ö", 0.00830000 },
+};
+
+const wa_cp_freq ALPHA_113_FREQ_CPS[] = {
+  { 0x61u, 0.09650000 },
+  { 0x62u, 0.01120000 },
+  { 0x64u, 0.01970000 },
+  { 0x65u, 0.06260000 },
+  { 0x66u, 0.02970000 },
+  { 0x67u, 0.03730000 },
+  { 0x68u, 0.02000000 },
+  { 0x69u, 0.07490000 },
+  { 0x6Au, 0.01170000 },
+  { 0x6Bu, 0.03130000 },
+  { 0x6Cu, 0.04680000 },
+  { 0x6Du, 0.03700000 },
+  { 0x6Eu, 0.08320000 },
+  { 0x6Fu, 0.02550000 },
+  { 0x70u, 0.00950000 },
+  { 0x72u, 0.09120000 },
+  { 0x73u, 0.06180000 },
+  { 0x74u, 0.05090000 },
+  { 0x75u, 0.04690000 },
+  { 0x76u, 0.02110000 },
+  { 0x78u, 0.00070000 },
+  { 0x79u, 0.00950000 },
+  { 0xE1u, 0.01680000 },
+  { 0xE6u, 0.00770000 },
+  { 0xE9u, 0.00300000 },
+  { 0xEDu, 0.01780000 },
+  { 0xF0u, 0.03680000 },
+  { 0xF3u, 0.01120000 },
+  { 0xF6u, 0.00830000 },
+  { 0xFAu, 0.00590000 },
+  { 0xFDu, 0.00250000 },
+  { 0xFEu, 0.01100000 },
+};
+
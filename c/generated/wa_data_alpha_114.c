@@ -0,0 +1,153 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_114_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+  "À",
+  "È",
+  "É",
+  "Ì",
+  "Ò",
+  "Ù",
+};
+const char *ALPHA_114_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+  "à",
+  "è",
+  "é",
+  "ì",
+  "ò",
+  "ù",
+};
+const char *ALPHA_114_DIGITS[] = {
+};
+const uint32_t ALPHA_114_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 192, 200, 201, 204, 210, 217,
+};
+const uint32_t ALPHA_114_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 224, 232, 233, 236, 242, 249,
+};
+const uint32_t ALPHA_114_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_114_FREQ[] = {
+  { "a", 0.11080000 },
+  { "b", 0.00960000 },
+  { "c", 0.04270000 },
+  { "d", 0.04030000 },
+  { "e", 0.11290000 },
+  { "f", 0.01140000 },
+  { "g", 0.01810000 },
+  { "h", 0.00910000 },
+  { "i", 0.11170000 },
+  { "j", 0.00060000 },
+  { "k", 0.00160000 },
+  { "l", 0.06840000 },
+  { "m", 0.02620000 },
+  { "n", 0.07320000 },
+  { "o", 0.08740000 },
+  { "p", 0.02740000 },
+  { "q", 0.00340000 },
+  { "r", 0.06430000 },
+  { "s", 0.04970000 },
+  { "t", 0.06660000 },
+  { "u", 0.03040000 },
+  { "v", 0.01500000 },
+  { "w", 0.00090000 },
+  { "x", 0.00060000 },
+  { "y", 0.00130000 },
+  { "z", 0.00940000 },
+  { "à", 0.00190000 },
+  { "è", 0.00240000 },
+  { "é", 0.00040000 },
+  { "ì", 0.00040000 },
+  { "ò", 0.00120000 },
+  { "ù", 0.00080000 },
+};
+
+const wa_cp_freq ALPHA_114_FREQ_CPS[] = {
+  { 0x61u, 0.11080000 },
+  { 0x62u, 0.00960000 },
+  { 0x63u, 0.04270000 },
+  { 0x64u, 0.04030000 },
+  { 0x65u, 0.11290000 },
+  { 0x66u, 0.01140000 },
+  { 0x67u, 0.01810000 },
+  { 0x68u, 0.00910000 },
+  { 0x69u, 0.11170000 },
+  { 0x6Au, 0.00060000 },
+  { 0x6Bu, 0.00160000 },
+  { 0x6Cu, 0.06840000 },
+  { 0x6Du, 0.02620000 },
+  { 0x6Eu, 0.07320000 },
+  { 0x6Fu, 0.08740000 },
+  { 0x70u, 0.02740000 },
+  { 0x71u, 0.00340000 },
+  { 0x72u, 0.06430000 },
+  { 0x73u, 0.04970000 },
+  { 0x74u, 0.06660000 },
+  { 0x75u, 0.03040000 },
+  { 0x76u, 0.01500000 },
+  { 0x77u, 0.00090000 },
+  { 0x78u, 0.00060000 },
+  { 0x79u, 0.00130000 },
+  { 0x7Au, 0.00940000 },
+  { 0xE0u, 0.00190000 },
+  { 0xE8u, 0.00240000 },
+  { 0xE9u, 0.00040000 },
+  { 0xECu, 0.00040000 },
+  { 0xF2u, 0.00120000 },
+  { 0xF9u, 0.00080000 },
+};
+
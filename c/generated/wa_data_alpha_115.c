@@ -0,0 +1,471 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_115_UPPER[] = {
+  "ᐃ",
+  "ᐄ",
+  "ᐅ",
+  "ᐆ",
+  "ᐊ",
+  "ᐋ",
+  "ᐱ",
+  "ᐲ",
+  "ᐳ",
+  "ᐴ",
+  "ᐸ",
+  "ᐹ",
+  "ᑉ",
+  "ᑎ",
+  "ᑏ",
+  "ᑐ",
+  "ᑑ",
+  "ᑕ",
+  "ᑖ",
+  "ᑦ",
+  "ᑭ",
+  "ᑮ",
+  "ᑯ",
+  "ᑰ",
+  "ᑲ",
+  "ᑳ",
+  "ᒃ",
+  "ᒋ",
+  "ᒌ",
+  "ᒍ",
+  "ᒎ",
+  "ᒐ",
+  "ᒑ",
+  "ᒡ",
+  "ᒥ",
+  "ᒦ",
+  "ᒧ",
+  "ᒨ",
+  "ᒪ",
+  "ᒫ",
+  "ᒻ",
+  "ᓂ",
+  "ᓃ",
+  "ᓄ",
+  "ᓅ",
+  "ᓇ",
+  "ᓈ",
+  "ᓐ",
+  "ᓕ",
+  "ᓖ",
+  "ᓗ",
+  "ᓘ",
+  "ᓚ",
+  "ᓛ",
+  "ᓪ",
+  "ᓯ",
+  "ᓰ",
+  "ᓱ",
+  "ᓲ",
+  "ᓴ",
+  "ᓵ",
+  "ᔅ",
+  "ᔨ",
+  "ᔩ",
+  "ᔪ",
+  "ᔫ",
+  "ᔭ",
+  "ᔮ",
+  "ᔾ",
+  "ᕆ",
+  "ᕇ",
+  "ᕈ",
+  "ᕉ",
+  "ᕋ",
+  "ᕌ",
+  "ᕐ",
+  "ᕕ",
+  "ᕖ",
+  "ᕗ",
+  "ᕘ",
+  "ᕙ",
+  "ᕚ",
+  "ᕝ",
+  "ᕿ",
+  "ᖀ",
+  "ᖁ",
+  "ᖂ",
+  "ᖃ",
+  "ᖅ",
+  "ᖏ",
+  "ᖑ",
+  "ᖒ",
+  "ᖓ",
+  "ᖔ",
+  "ᖕ",
+  "ᖖ",
+  "ᖠ",
+  "ᖡ",
+  "ᖢ",
+  "ᖣ",
+  "ᖤ",
+  "ᖥ",
+  "ᖦ",
+  "ᙱ",
+  "ᙲ",
+  "ᙳ",
+  "ᙴ",
+  "ᙵ",
+  "ᙶ",
+};
+const char *ALPHA_115_LOWER[] = {
+  "ᐃ",
+  "ᐄ",
+  "ᐅ",
+  "ᐆ",
+  "ᐊ",
+  "ᐋ",
+  "ᐱ",
+  "ᐲ",
+  "ᐳ",
+  "ᐴ",
+  "ᐸ",
+  "ᐹ",
+  "ᑉ",
+  "ᑎ",
+  "ᑏ",
+  "ᑐ",
+  "ᑑ",
+  "ᑕ",
+  "ᑖ",
+  "ᑦ",
+  "ᑭ",
+  "ᑮ",
+  "ᑯ",
+  "ᑰ",
+  "ᑲ",
+  "ᑳ",
+  "ᒃ",
+  "ᒋ",
+  "ᒌ",
+  "ᒍ",
+  "ᒎ",
+  "ᒐ",
+  "ᒑ",
+  "ᒡ",
+  "ᒥ",
+  "ᒦ",
+  "ᒧ",
+  "ᒨ",
+  "ᒪ",
+  "ᒫ",
+  "ᒻ",
+  "ᓂ",
+  "ᓃ",
+  "ᓄ",
+  "ᓅ",
+  "ᓇ",
+  "ᓈ",
+  "ᓐ",
+  "ᓕ",
+  "ᓖ",
+  "ᓗ",
+  "ᓘ",
+  "ᓚ",
+  "ᓛ",
+  "ᓪ",
+  "ᓯ",
+  "ᓰ",
+  "ᓱ",
+  "ᓲ",
+  "ᓴ",
+  "ᓵ",
+  "ᔅ",
+  "ᔨ",
+  "ᔩ",
+  "ᔪ",
+  "ᔫ",
+  "ᔭ",
+  "ᔮ",
+  "ᔾ",
+  "ᕆ",
+  "ᕇ",
+  "ᕈ",
+  "ᕉ",
+  "ᕋ",
+  "ᕌ",
+  "ᕐ",
+  "ᕕ",
+  "ᕖ",
+  "ᕗ",
+  "ᕘ",
+  "ᕙ",
+  "ᕚ",
+  "ᕝ",
+  "ᕿ",
+  "ᖀ",
+  "ᖁ",
+  "ᖂ",
+  "ᖃ",
+  "ᖅ",
+  "ᖏ",
+  "ᖑ",
+  "ᖒ",
+  "ᖓ",
+  "ᖔ",
+  "ᖕ",
+  "ᖖ",
+  "ᖠ",
+  "ᖡ",
+  "ᖢ",
+  "ᖣ",
+  "ᖤ",
+  "ᖥ",
+  "ᖦ",
+  "ᙱ",
+  "ᙲ",
+  "ᙳ",
+  "ᙴ",
+  "ᙵ",
+  "ᙶ",
+};
+const char *ALPHA_115_DIGITS[] = {
+};
+const uint32_t ALPHA_115_UPPER_CPS[] = {
+  5123, 5124, 5125, 5126, 5130, 5131, 5169, 5170, 5171, 5172, 5176, 5177, 5193, 5198, 5199, 5200,
+  5201, 5205, 5206, 5222, 5229, 5230, 5231, 5232, 5234, 5235, 5251, 5259, 5260, 5261, 5262, 5264,
+  5265, 5281, 5285, 5286, 5287, 5288, 5290, 5291, 5307, 5314, 5315, 5316, 5317, 5319, 5320, 5328,
+  5333, 5334, 5335, 5336, 5338, 5339, 5354, 5359, 5360, 5361, 5362, 5364, 5365, 5381, 5416, 5417,
+  5418, 5419, 5421, 5422, 5438, 5446, 5447, 5448, 5449, 5451, 5452, 5456, 5461, 5462, 5463, 5464,
+  5465, 5466, 5469, 5503, 5504, 5505, 5506, 5507, 5509, 5519, 5521, 5522, 5523, 5524, 5525, 5526,
+  5536, 5537, 5538, 5539, 5540, 5541, 5542, 5745, 5746, 5747, 5748, 5749, 5750,
+};
+const uint32_t ALPHA_115_LOWER_CPS[] = {
+  5123, 5124, 5125, 5126, 5130, 5131, 5169, 5170, 5171, 5172, 5176, 5177, 5193, 5198, 5199, 5200,
+  5201, 5205, 5206, 5222, 5229, 5230, 5231, 5232, 5234, 5235, 5251, 5259, 5260, 5261, 5262, 5264,
+  5265, 5281, 5285, 5286, 5287, 5288, 5290, 5291, 5307, 5314, 5315, 5316, 5317, 5319, 5320, 5328,
+  5333, 5334, 5335, 5336, 5338, 5339, 5354, 5359, 5360, 5361, 5362, 5364, 5365, 5381, 5416, 5417,
+  5418, 5419, 5421, 5422, 5438, 5446, 5447, 5448, 5449, 5451, 5452, 5456, 5461, 5462, 5463, 5464,
+  5465, 5466, 5469, 5503, 5504, 5505, 5506, 5507, 5509, 5519, 5521, 5522, 5523, 5524, 5525, 5526,
+  5536, 5537, 5538, 5539, 5540, 5541, 5542, 5745, 5746, 5747, 5748, 5749, 5750,
+};
+const uint32_t ALPHA_115_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_115_FREQ[] = {
+  { "ᐃ", 0.05060000 },
+  { "ᐄ", 0.00200000 },
+  { "ᐅ", 0.04800000 },
+  { "ᐆ", 0.00260000 },
+  { "ᐊ", 0.05500000 },
+  { "ᐋ", 0.00420000 },
+  { "ᐱ", 0.01040000 },
+  { "ᐲ", 0.00070000 },
+  { "ᐳ", 0.00680000 },
+  { "ᐴ", 0.00040000 },
+  { "ᐸ", 0.00440000 },
+  { "ᐹ", 0.00700000 },
+  { "ᑉ", 0.00570000 },
+  { "ᑎ", 0.04100000 },
+  { "ᑏ", 0.00130000 },
+  { "ᑐ", 0.03500000 },
+  { "ᑑ", 0.00190000 },
+  { "ᑕ", 0.01900000 },
+  { "ᑖ", 0.00370000 },
+  { "ᑦ", 0.06070000 },
+  { "ᑭ", 0.01080000 },
+  { "ᑮ", 0.00030000 },
+  { "ᑯ", 0.00720000 },
+  { "ᑰ", 0.00180000 },
+  { "ᑲ", 0.01120000 },
+  { "ᑳ", 0.00160000 },
+  { "ᒃ", 0.02960000 },
+  { "ᒋ", 0.00450000 },
+  { "ᒌ", 0.00150000 },
+  { "ᒍ", 0.00470000 },
+  { "ᒎ", 0.00070000 },
+  { "ᒐ", 0.00570000 },
+  { "ᒑ", 0.00010000 },
+  { "ᒡ", 0.00310000 },
+  { "ᒥ", 0.01680000 },
+  { "ᒦ", 0.00140000 },
+  { "ᒧ", 0.00200000 },
+  { "ᒨ", 0.00010000 },
+  { "ᒪ", 0.02060000 },
+  { "ᒫ", 0.00200000 },
+  { "ᒻ", 0.00920000 },
+  { "ᓂ", 0.03210000 },
+  { "ᓃ", 0.00150000 },
+  { "ᓄ", 0.02200000 },
+  { "ᓅ", 0.00150000 },
+  { "ᓇ", 0.02260000 },
+  { "ᓈ", 0.01060000 },
+  { "ᓐ", 0.01450000 },
+  { "ᓕ", 0.02350000 },
+  { "ᓖ", 0.00540000 },
+  { "ᓗ", 0.02340000 },
+  { "ᓘ", 0.00090000 },
+  { "ᓚ", 0.00950000 },
+  { "ᓛ", 0.00310000 },
+  { "ᓪ", 0.01660000 },
+  { "ᓯ", 0.02390000 },
+  { "ᓰ", 0.00180000 },
+  { "ᓱ", 0.01050000 },
+  { "ᓲ", 0.00190000 },
+  { "ᓴ", 0.01020000 },
+  { "ᓵ", 0.00170000 },
+  { "ᔅ", 0.00780000 },
+  { "ᔨ", 0.00480000 },
+  { "ᔩ", 0.00240000 },
+  { "ᔪ", 0.02110000 },
+  { "ᔫ", 0.00050000 },
+  { "ᔭ", 0.00670000 },
+  { "ᔮ", 0.00150000 },
+  { "ᔾ", 0.00140000 },
+  { "ᕆ", 0.00960000 },
+  { "ᕇ", 0.00160000 },
+  { "ᕈ", 0.00500000 },
+  { "ᕉ", 0.00090000 },
+  { "ᕋ", 0.00380000 },
+  { "ᕌ", 0.00130000 },
+  { "ᕐ", 0.02240000 },
+  { "ᕕ", 0.00990000 },
+  { "ᕖ", 0.00070000 },
+  { "ᕗ", 0.01150000 },
+  { "ᕘ", 0.00030000 },
+  { "ᕙ", 0.00580000 },
+  { "ᕚ", 0.00390000 },
+  { "ᕝ", 0.00250000 },
+  { "ᕿ", 0.00490000 },
+  { "ᖀ", 0.00010000 },
+  { "ᖁ", 0.00580000 },
+  { "ᖂ", 0.00060000 },
+  { "ᖃ", 0.02640000 },
+  { "ᖅ", 0.08010000 },
+  { "ᖏ", 0.00530000 },
+  { "ᖑ", 0.00360000 },
+  { "ᖒ", 0.00000000 },
+  { "ᖓ", 0.00830000 },
+  { "ᖔ", 0.00030000 },
+  { "ᖕ", 0.00200000 },
+  { "ᖖ", 0.00000000 },
+  { "ᖠ", 0.00000000 },
+  { "ᖡ", 0.00000000 },
+  { "ᖢ", 0.00110000 },
+  { "ᖣ", 0.00000000 },
+  { "ᖤ", 0.00000000 },
+  { "ᖥ", 0.00000000 },
+  { "ᖦ", 0.00010000 },
+  { "ᙱ", 0.00150000 },
+  { "ᙲ", 0.00000000 },
+  { "ᙳ", 0.00110000 },
+  { "ᙴ", 0.00030000 },
+  { "ᙵ", 0.00070000 },
+  { "ᙶ", 0.00020000 },
+};
+
+const wa_cp_freq ALPHA_115_FREQ_CPS[] = {
+  { 0x1403u, 0.05060000 },
+  { 0x1404u, 0.00200000 },
+  { 0x1405u, 0.04800000 },
+  { 0x1406u, 0.00260000 },
+  { 0x140Au, 0.05500000 },
+  { 0x140Bu, 0.00420000 },
+  { 0x1431u, 0.01040000 },
+  { 0x1432u, 0.00070000 },
+  { 0x1433u, 0.00680000 },
+  { 0x1434u, 0.00040000 },
+  { 0x1438u, 0.00440000 },
+  { 0x1439u, 0.00700000 },
+  { 0x1449u, 0.00570000 },
+  { 0x144Eu, 0.04100000 },
+  { 0x144Fu, 0.00130000 },
+  { 0x1450u, 0.03500000 },
+  { 0x1451u, 0.00190000 },
+  { 0x1455u, 0.01900000 },
+  { 0x1456u, 0.00370000 },
+  { 0x1466u, 0.06070000 },
+  { 0x146Du, 0.01080000 },
+  { 0x146Eu, 0.00030000 },
+  { 0x146Fu, 0.00720000 },
+  { 0x1470u, 0.00180000 },
+  { 0x1472u, 0.01120000 },
+  { 0x1473u, 0.00160000 },
+  { 0x1483u, 0.02960000 },
+  { 0x148Bu, 0.00450000 },
+  { 0x148Cu, 0.00150000 },
+  { 0x148Du, 0.00470000 },
+  { 0x148Eu, 0.00070000 },
+  { 0x1490u, 0.00570000 },
+  { 0x1491u, 0.00010000 },
+  { 0x14A1u, 0.00310000 },
+  { 0x14A5u, 0.01680000 },
+  { 0x14A6u, 0.00140000 },
+  { 0x14A7u, 0.00200000 },
+  { 0x14A8u, 0.00010000 },
+  { 0x14AAu, 0.02060000 },
+  { 0x14ABu, 0.00200000 },
+  { 0x14BBu, 0.00920000 },
+  { 0x14C2u, 0.03210000 },
+  { 0x14C3u, 0.00150000 },
+  { 0x14C4u, 0.02200000 },
+  { 0x14C5u, 0.00150000 },
+  { 0x14C7u, 0.02260000 },
+  { 0x14C8u, 0.01060000 },
+  { 0x14D0u, 0.01450000 },
+  { 0x14D5u, 0.02350000 },
+  { 0x14D6u, 0.00540000 },
+  { 0x14D7u, 0.02340000 },
+  { 0x14D8u, 0.00090000 },
+  { 0x14DAu, 0.00950000 },
+  { 0x14DBu, 0.00310000 },
+  { 0x14EAu, 0.01660000 },
+  { 0x14EFu, 0.02390000 },
+  { 0x14F0u, 0.00180000 },
+  { 0x14F1u, 0.01050000 },
+  { 0x14F2u, 0.00190000 },
+  { 0x14F4u, 0.01020000 },
+  { 0x14F5u, 0.00170000 },
+  { 0x1505u, 0.00780000 },
+  { 0x1528u, 0.00480000 },
+  { 0x1529u, 0.00240000 },
+  { 0x152Au, 0.02110000 },
+  { 0x152Bu, 0.00050000 },
+  { 0x152Du, 0.00670000 },
+  { 0x152Eu, 0.00150000 },
+  { 0x153Eu, 0.00140000 },
+  { 0x1546u, 0.00960000 },
+  { 0x1547u, 0.00160000 },
+  { 0x1548u, 0.00500000 },
+  { 0x1549u, 0.00090000 },
+  { 0x154Bu, 0.00380000 },
+  { 0x154Cu, 0.00130000 },
+  { 0x1550u, 0.02240000 },
+  { 0x1555u, 0.00990000 },
+  { 0x1556u, 0.00070000 },
+  { 0x1557u, 0.01150000 },
+  { 0x1558u, 0.00030000 },
+  { 0x1559u, 0.00580000 },
+  { 0x155Au, 0.00390000 },
+  { 0x155Du, 0.00250000 },
+  { 0x157Fu, 0.00490000 },
+  { 0x1580u, 0.00010000 },
+  { 0x1581u, 0.00580000 },
+  { 0x1582u, 0.00060000 },
+  { 0x1583u, 0.02640000 },
+  { 0x1585u, 0.08010000 },
+  { 0x158Fu, 0.00530000 },
+  { 0x1591u, 0.00360000 },
+  { 0x1592u, 0.00000000 },
+  { 0x1593u, 0.00830000 },
+  { 0x1594u, 0.00030000 },
+  { 0x1595u, 0.00200000 },
+  { 0x1596u, 0.00000000 },
+  { 0x15A0u, 0.00000000 },
+  { 0x15A1u, 0.00000000 },
+  { 0x15A2u, 0.00110000 },
+  { 0x15A3u, 0.00000000 },
+  { 0x15A4u, 0.00000000 },
+  { 0x15A5u, 0.00000000 },
+  { 0x15A6u, 0.00010000 },
+  { 0x1671u, 0.00150000 },
+  { 0x1672u, 0.00000000 },
+  { 0x1673u, 0.00110000 },
+  { 0x1674u, 0.00030000 },
+  { 0x1675u, 0.00070000 },
+  { 0x1676u, 0.00020000 },
+};
+
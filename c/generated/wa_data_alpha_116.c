@@ -0,0 +1,87 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_116_UPPER[] = {
+  "A",
+  "G",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "Ł",
+};
+const char *ALPHA_116_LOWER[] = {
+  "a",
+  "g",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "ł",
+};
+const char *ALPHA_116_DIGITS[] = {
+};
+const uint32_t ALPHA_116_UPPER_CPS[] = {
+  65, 71, 73, 74, 75, 76, 77, 78, 80, 81, 82, 83, 84, 85, 86, 321,
+};
+const uint32_t ALPHA_116_LOWER_CPS[] = {
+  97, 103, 105, 106, 107, 108, 109, 110, 112, 113, 114, 115, 116, 117, 118, 322,
+};
+const uint32_t ALPHA_116_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_116_FREQ[] = {
+  { "a", 0.15630000 },
+  { "g", 0.02650000 },
+  { "i", 0.15700000 },
+  { "j", 0.01520000 },
+  { "k", 0.03450000 },
+  { "l", 0.05960000 },
+  { "m", 0.03960000 },
+  { "n", 0.09600000 },
+  { "p", 0.02920000 },
+  { "q", 0.04530000 },
+  { "r", 0.05210000 },
+  { "s", 0.06130000 },
+  { "t", 0.09910000 },
+  { "u", 0.11340000 },
+  { "v", 0.01400000 },
+  { "ł", 0.00100000 },
+};
+
+const wa_cp_freq ALPHA_116_FREQ_CPS[] = {
+  { 0x61u, 0.15630000 },
+  { 0x67u, 0.02650000 },
+  { 0x69u, 0.15700000 },
+  { 0x6Au, 0.01520000 },
+  { 0x6Bu, 0.03450000 },
+  { 0x6Cu, 0.05960000 },
+  { 0x6Du, 0.03960000 },
+  { 0x6Eu, 0.09600000 },
+  { 0x70u, 0.02920000 },
+  { 0x71u, 0.04530000 },
+  { 0x72u, 0.05210000 },
+  { 0x73u, 0.06130000 },
+  { 0x74u, 0.09910000 },
+  { 0x75u, 0.11340000 },
+  { 0x76u, 0.01400000 },
+  { 0x142u, 0.00100000 },
+};
+
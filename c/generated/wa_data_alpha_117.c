@@ -0,0 +1,211 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_117_UPPER[] = {
+  "あ",
+  "い",
+  "う",
+  "え",
+  "お",
+  "か",
+  "き",
+  "く",
+  "け",
+  "こ",
+  "さ",
+  "し",
+  "す",
+  "せ",
+  "そ",
+  "た",
+  "ち",
+  "つ",
+  "て",
+  "と",
+  "な",
+  "に",
+  "ぬ",
+  "ね",
+  "の",
+  "は",
+  "ひ",
+  "ふ",
+  "へ",
+  "ほ",
+  "ま",
+  "み",
+  "む",
+  "め",
+  "も",
+  "や",
+  "ゆ",
+  "よ",
+  "ら",
+  "り",
+  "る",
+  "れ",
+  "ろ",
+  "わ",
+  "を",
+  "ん",
+};
+const char *ALPHA_117_LOWER[] = {
+  "あ",
+  "い",
+  "う",
+  "え",
+  "お",
+  "か",
+  "き",
+  "く",
+  "け",
+  "こ",
+  "さ",
+  "し",
+  "す",
+  "せ",
+  "そ",
+  "た",
+  "ち",
+  "つ",
+  "て",
+  "と",
+  "な",
+  "に",
+  "ぬ",
+  "ね",
+  "の",
+  "は",
+  "ひ",
+  "ふ",
+  "へ",
+  "ほ",
+  "ま",
+  "み",
+  "む",
+  "め",
+  "も",
+  "や",
+  "ゆ",
+  "よ",
+  "ら",
+  "り",
+  "る",
+  "れ",
+  "ろ",
+  "わ",
+  "を",
+  "ん",
+};
+const char *ALPHA_117_DIGITS[] = {
+};
+const uint32_t ALPHA_117_UPPER_CPS[] = {
+  12354, 12356, 12358, 12360, 12362, 12363, 12365, 12367, 12369, 12371, 12373, 12375, 12377, 12379, 12381, 12383,
+  12385, 12388, 12390, 12392, 12394, 12395, 12396, 12397, 12398, 12399, 12402, 12405, 12408, 12411, 12414, 12415,
+  12416, 12417, 12418, 12420, 12422, 12424, 12425, 12426, 12427, 12428, 12429, 12431, 12434, 12435,
+};
+const uint32_t ALPHA_117_LOWER_CPS[] = {
+  12354, 12356, 12358, 12360, 12362, 12363, 12365, 12367, 12369, 12371, 12373, 12375, 12377, 12379, 12381, 12383,
+  12385, 12388, 12390, 12392, 12394, 12395, 12396, 12397, 12398, 12399, 12402, 12405, 12408, 12411, 12414, 12415,
+  12416, 12417, 12418, 12420, 12422, 12424, 12425, 12426, 12427, 12428, 12429, 12431, 12434, 12435,
+};
+const uint32_t ALPHA_117_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_117_FREQ[] = {
+  { "あ", 0.02200000 },
+  { "い", 0.04500000 },
+  { "う", 0.01330000 },
+  { "え", 0.00600000 },
+  { "お", 0.00740000 },
+  { "か", 0.02200000 },
+  { "き", 0.00880000 },
+  { "く", 0.01010000 },
+  { "け", 0.00800000 },
+  { "こ", 0.01830000 },
+  { "さ", 0.02110000 },
+  { "し", 0.05000000 },
+  { "す", 0.01720000 },
+  { "せ", 0.00350000 },
+  { "そ", 0.00860000 },
+  { "た", 0.06200000 },
+  { "ち", 0.00420000 },
+  { "つ", 0.00690000 },
+  { "て", 0.04710000 },
+  { "と", 0.05410000 },
+  { "な", 0.03490000 },
+  { "に", 0.07780000 },
+  { "ぬ", 0.00010000 },
+  { "ね", 0.00060000 },
+  { "の", 0.11390000 },
+  { "は", 0.05940000 },
+  { "ひ", 0.00080000 },
+  { "ふ", 0.00040000 },
+  { "へ", 0.00280000 },
+  { "ほ", 0.00200000 },
+  { "ま", 0.01280000 },
+  { "み", 0.00370000 },
+  { "む", 0.00120000 },
+  { "め", 0.00980000 },
+  { "も", 0.02000000 },
+  { "や", 0.00710000 },
+  { "ゆ", 0.00060000 },
+  { "よ", 0.01230000 },
+  { "ら", 0.02200000 },
+  { "り", 0.01930000 },
+  { "る", 0.06360000 },
+  { "れ", 0.03690000 },
+  { "ろ", 0.00140000 },
+  { "わ", 0.00640000 },
+  { "を", 0.04970000 },
+  { "ん", 0.00500000 },
+};
+
+const wa_cp_freq ALPHA_117_FREQ_CPS[] = {
+  { 0x3042u, 0.02200000 },
+  { 0x3044u, 0.04500000 },
+  { 0x3046u, 0.01330000 },
+  { 0x3048u, 0.00600000 },
+  { 0x304Au, 0.00740000 },
+  { 0x304Bu, 0.02200000 },
+  { 0x304Du, 0.00880000 },
+  { 0x304Fu, 0.01010000 },
+  { 0x3051u, 0.00800000 },
+  { 0x3053u, 0.01830000 },
+  { 0x3055u, 0.02110000 },
+  { 0x3057u, 0.05000000 },
+  { 0x3059u, 0.01720000 },
+  { 0x305Bu, 0.00350000 },
+  { 0x305Du, 0.00860000 },
+  { 0x305Fu, 0.06200000 },
+  { 0x3061u, 0.00420000 },
+  { 0x3064u, 0.00690000 },
+  { 0x3066u, 0.04710000 },
+  { 0x3068u, 0.05410000 },
+  { 0x306Au, 0.03490000 },
+  { 0x306Bu, 0.07780000 },
+  { 0x306Cu, 0.00010000 },
+  { 0x306Du, 0.00060000 },
+  { 0x306Eu, 0.11390000 },
+  { 0x306Fu, 0.05940000 },
+  { 0x3072u, 0.00080000 },
+  { 0x3075u, 0.00040000 },
+  { 0x3078u, 0.00280000 },
+  { 0x307Bu, 0.00200000 },
+  { 0x307Eu, 0.01280000 },
+  { 0x307Fu, 0.00370000 },
+  { 0x3080u, 0.00120000 },
+  { 0x3081u, 0.00980000 },
+  { 0x3082u, 0.02000000 },
+  { 0x3084u, 0.00710000 },
+  { 0x3086u, 0.00060000 },
+  { 0x3088u, 0.01230000 },
+  { 0x3089u, 0.02200000 },
+  { 0x308Au, 0.01930000 },
+  { 0x308Bu, 0.06360000 },
+  { 0x308Cu, 0.03690000 },
+  { 0x308Du, 0.00140000 },
+  { 0x308Fu, 0.00640000 },
+  { 0x3092u, 0.04970000 },
+  { 0x3093u, 0.00500000 },
+};
+
@@ -0,0 +1,9555 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_118_UPPER[] = {
+  "々",
+  "ゝ",
+  "ヽ",
+  "ゞ",
+  "ヾ",
+  "ー",
+  "ぁ",
+  "ァ",
+  "ア",
+  "あ",
+  "ぃ",
+  "ィ",
+  "イ",
+  "い",
+  "ぅ",
+  "ゥ",
+  "ウ",
+  "う",
+  "ヴ",
+  "ぇ",
+  "ェ",
+  "エ",
+  "え",
+  "ぉ",
+  "ォ",
+  "オ",
+  "お",
+  "ヵ",
+  "か",
+  "カ",
+  "が",
+  "ガ",
+  "き",
+  "キ",
+  "ぎ",
+  "ギ",
+  "ク",
+  "く",
+  "ぐ",
+  "グ",
+  "ヶ",
+  "ケ",
+  "け",
+  "げ",
+  "ゲ",
+  "こ",
+  "コ",
+  "ゴ",
+  "ご",
+  "さ",
+  "サ",
+  "ざ",
+  "ザ",
+  "シ",
+  "し",
+  "ジ",
+  "じ",
+  "ス",
+  "す",
+  "ず",
+  "ズ",
+  "セ",
+  "せ",
+  "ゼ",
+  "ぜ",
+  "そ",
+  "ソ",
+  "ゾ",
+  "ぞ",
+  "タ",
+  "た",
+  "だ",
+  "ダ",
+  "ち",
+  "チ",
+  "ぢ",
+  "ヂ",
+  "っ",
+  "ッ",
+  "つ",
+  "ツ",
+  "づ",
+  "ヅ",
+  "テ",
+  "て",
+  "で",
+  "デ",
+  "ト",
+  "と",
+  "ど",
+  "ド",
+  "な",
+  "ナ",
+  "ニ",
+  "に",
+  "ぬ",
+  "ヌ",
+  "ね",
+  "ネ",
+  "ノ",
+  "の",
+  "は",
+  "ハ",
+  "ば",
+  "バ",
+  "パ",
+  "ぱ",
+  "ヒ",
+  "ひ",
+  "び",
+  "ビ",
+  "ピ",
+  "ぴ",
+  "ふ",
+  "フ",
+  "ブ",
+  "ぶ",
+  "プ",
+  "ぷ",
+  "へ",
+  "ヘ",
+  "べ",
+  "ベ",
+  "ぺ",
+  "ペ",
+  "ほ",
+  "ホ",
+  "ぼ",
+  "ボ",
+  "ポ",
+  "ぽ",
+  "マ",
+  "ま",
+  "ミ",
+  "み",
+  "む",
+  "ム",
+  "メ",
+  "め",
+  "も",
+  "モ",
+  "ゃ",
+  "ャ",
+  "や",
+  "ヤ",
+  "ュ",
+  "ゅ",
+  "ゆ",
+  "ユ",
+  "ョ",
+  "ょ",
+  "よ",
+  "ヨ",
+  "ラ",
+  "ら",
+  "リ",
+  "り",
+  "る",
+  "ル",
+  "れ",
+  "レ",
+  "ろ",
+  "ロ",
+  "ゎ",
+  "ヮ",
+  "わ",
+  "ワ",
+  "ゐ",
+  "ヰ",
+  "ヱ",
+  "ゑ",
+  "を",
+  "ヲ",
+  "ン",
+  "ん",
+  "亜",
+  "哀",
+  "愛",
+  "挨",
+  "悪",
+  "握",
+  "圧",
+  "扱",
+  "宛",
+  "安",
+  "暗",
+  "案",
+  "闇",
+  "以",
+  "位",
+  "依",
+  "偉",
+  "囲",
+  "委",
+  "威",
+  "尉",
+  "意",
+  "慰",
+  "易",
+  "椅",
+  "為",
+  "畏",
+  "異",
+  "移",
+  "維",
+  "緯",
+  "胃",
+  "萎",
+  "衣",
+  "違",
+  "遺",
+  "医",
+  "井",
+  "域",
+  "育",
+  "一",
+  "壱",
+  "逸",
+  "稲",
+  "茨",
+  "芋",
+  "印",
+  "咽",
+  "員",
+  "因",
+  "姻",
+  "引",
+  "飲",
+  "淫",
+  "院",
+  "陰",
+  "隠",
+  "韻",
+  "右",
+  "宇",
+  "羽",
+  "雨",
+  "臼",
+  "渦",
+  "唄",
+  "浦",
+  "運",
+  "雲",
+  "餌",
+  "営",
+  "影",
+  "映",
+  "栄",
+  "永",
+  "泳",
+  "英",
+  "衛",
+  "詠",
+  "鋭",
+  "液",
+  "疫",
+  "益",
+  "駅",
+  "悦",
+  "謁",
+  "越",
+  "閲",
+  "円",
+  "園",
+  "宴",
+  "延",
+  "怨",
+  "援",
+  "沿",
+  "演",
+  "炎",
+  "煙",
+  "猿",
+  "縁",
+  "艶",
+  "遠",
+  "鉛",
+  "塩",
+  "汚",
+  "凹",
+  "央",
+  "奥",
+  "往",
+  "応",
+  "押",
+  "旺",
+  "横",
+  "欧",
+  "殴",
+  "王",
+  "翁",
+  "黄",
+  "岡",
+  "沖",
+  "億",
+  "屋",
+  "憶",
+  "臆",
+  "乙",
+  "俺",
+  "卸",
+  "恩",
+  "温",
+  "穏",
+  "音",
+  "下",
+  "化",
+  "仮",
+  "何",
+  "価",
+  "佳",
+  "加",
+  "可",
+  "夏",
+  "嫁",
+  "家",
+  "寡",
+  "科",
+  "暇",
+  "果",
+  "架",
+  "歌",
+  "河",
+  "火",
+  "禍",
+  "稼",
+  "箇",
+  "花",
+  "苛",
+  "荷",
+  "華",
+  "菓",
+  "課",
+  "貨",
+  "過",
+  "蚊",
+  "我",
+  "牙",
+  "画",
+  "芽",
+  "賀",
+  "雅",
+  "餓",
+  "介",
+  "会",
+  "解",
+  "回",
+  "塊",
+  "壊",
+  "快",
+  "怪",
+  "悔",
+  "懐",
+  "戒",
+  "拐",
+  "改",
+  "械",
+  "海",
+  "灰",
+  "界",
+  "皆",
+  "絵",
+  "開",
+  "階",
+  "貝",
+  "劾",
+  "外",
+  "害",
+  "崖",
+  "慨",
+  "概",
+  "涯",
+  "蓋",
+  "街",
+  "該",
+  "骸",
+  "垣",
+  "柿",
+  "嚇",
+  "各",
+  "拡",
+  "格",
+  "核",
+  "殻",
+  "獲",
+  "確",
+  "穫",
+  "覚",
+  "角",
+  "較",
+  "郭",
+  "閣",
+  "隔",
+  "革",
+  "学",
+  "岳",
+  "楽",
+  "額",
+  "顎",
+  "掛",
+  "潟",
+  "割",
+  "喝",
+  "括",
+  "活",
+  "渇",
+  "滑",
+  "葛",
+  "褐",
+  "轄",
+  "且",
+  "株",
+  "釜",
+  "鎌",
+  "刈",
+  "瓦",
+  "乾",
+  "冠",
+  "寒",
+  "刊",
+  "勘",
+  "勧",
+  "巻",
+  "喚",
+  "堪",
+  "完",
+  "官",
+  "寛",
+  "干",
+  "幹",
+  "患",
+  "感",
+  "慣",
+  "憾",
+  "換",
+  "敢",
+  "棺",
+  "款",
+  "歓",
+  "汗",
+  "漢",
+  "環",
+  "甘",
+  "監",
+  "看",
+  "管",
+  "簡",
+  "緩",
+  "缶",
+  "肝",
+  "艦",
+  "観",
+  "貫",
+  "還",
+  "鑑",
+  "間",
+  "閑",
+  "関",
+  "陥",
+  "韓",
+  "館",
+  "丸",
+  "含",
+  "岸",
+  "玩",
+  "眼",
+  "岩",
+  "頑",
+  "顔",
+  "願",
+  "企",
+  "伎",
+  "危",
+  "喜",
+  "器",
+  "基",
+  "奇",
+  "寄",
+  "岐",
+  "希",
+  "幾",
+  "忌",
+  "揮",
+  "机",
+  "旗",
+  "既",
+  "期",
+  "棋",
+  "棄",
+  "機",
+  "帰",
+  "気",
+  "汽",
+  "畿",
+  "祈",
+  "季",
+  "紀",
+  "規",
+  "記",
+  "貴",
+  "起",
+  "軌",
+  "輝",
+  "飢",
+  "騎",
+  "鬼",
+  "亀",
+  "偽",
+  "儀",
+  "宜",
+  "戯",
+  "技",
+  "擬",
+  "欺",
+  "犠",
+  "疑",
+  "義",
+  "議",
+  "菊",
+  "吉",
+  "喫",
+  "詰",
+  "却",
+  "客",
+  "脚",
+  "虐",
+  "逆",
+  "丘",
+  "久",
+  "休",
+  "及",
+  "吸",
+  "宮",
+  "弓",
+  "急",
+  "救",
+  "朽",
+  "求",
+  "泣",
+  "球",
+  "究",
+  "窮",
+  "級",
+  "糾",
+  "給",
+  "旧",
+  "牛",
+  "去",
+  "居",
+  "巨",
+  "拒",
+  "拠",
+  "挙",
+  "虚",
+  "許",
+  "距",
+  "漁",
+  "魚",
+  "享",
+  "京",
+  "供",
+  "競",
+  "共",
+  "凶",
+  "協",
+  "叫",
+  "境",
+  "峡",
+  "強",
+  "恐",
+  "恭",
+  "挟",
+  "教",
+  "橋",
+  "況",
+  "狂",
+  "狭",
+  "矯",
+  "胸",
+  "脅",
+  "興",
+  "郷",
+  "鏡",
+  "響",
+  "驚",
+  "仰",
+  "凝",
+  "暁",
+  "業",
+  "局",
+  "曲",
+  "極",
+  "玉",
+  "僅",
+  "勤",
+  "均",
+  "巾",
+  "錦",
+  "斤",
+  "琴",
+  "禁",
+  "筋",
+  "緊",
+  "菌",
+  "襟",
+  "謹",
+  "近",
+  "金",
+  "吟",
+  "銀",
+  "九",
+  "句",
+  "区",
+  "苦",
+  "駆",
+  "駒",
+  "具",
+  "愚",
+  "虞",
+  "空",
+  "偶",
+  "遇",
+  "隅",
+  "串",
+  "屈",
+  "掘",
+  "窟",
+  "靴",
+  "熊",
+  "繰",
+  "桑",
+  "勲",
+  "君",
+  "薫",
+  "訓",
+  "群",
+  "軍",
+  "郡",
+  "係",
+  "傾",
+  "刑",
+  "兄",
+  "啓",
+  "型",
+  "契",
+  "形",
+  "径",
+  "恵",
+  "慶",
+  "憩",
+  "掲",
+  "携",
+  "敬",
+  "景",
+  "渓",
+  "稽",
+  "系",
+  "経",
+  "継",
+  "茎",
+  "蛍",
+  "計",
+  "詣",
+  "警",
+  "軽",
+  "鶏",
+  "芸",
+  "迎",
+  "鯨",
+  "劇",
+  "撃",
+  "激",
+  "隙",
+  "桁",
+  "傑",
+  "欠",
+  "決",
+  "潔",
+  "穴",
+  "結",
+  "血",
+  "月",
+  "件",
+  "倹",
+  "健",
+  "兼",
+  "券",
+  "剣",
+  "圏",
+  "堅",
+  "嫌",
+  "建",
+  "憲",
+  "懸",
+  "拳",
+  "検",
+  "権",
+  "犬",
+  "献",
+  "研",
+  "絹",
+  "県",
+  "肩",
+  "見",
+  "謙",
+  "賢",
+  "軒",
+  "遣",
+  "鍵",
+  "険",
+  "顕",
+  "験",
+  "元",
+  "原",
+  "厳",
+  "幻",
+  "弦",
+  "減",
+  "源",
+  "玄",
+  "現",
+  "舷",
+  "言",
+  "限",
+  "個",
+  "古",
+  "呼",
+  "固",
+  "孤",
+  "己",
+  "庫",
+  "弧",
+  "戸",
+  "故",
+  "枯",
+  "湖",
+  "股",
+  "虎",
+  "誇",
+  "雇",
+  "顧",
+  "鼓",
+  "五",
+  "互",
+  "午",
+  "呉",
+  "娯",
+  "後",
+  "御",
+  "悟",
+  "碁",
+  "語",
+  "誤",
+  "護",
+  "乞",
+  "交",
+  "侯",
+  "候",
+  "光",
+  "公",
+  "功",
+  "効",
+  "勾",
+  "厚",
+  "口",
+  "向",
+  "后",
+  "喉",
+  "坑",
+  "好",
+  "孔",
+  "孝",
+  "工",
+  "巧",
+  "幸",
+  "広",
+  "康",
+  "恒",
+  "慌",
+  "抗",
+  "拘",
+  "控",
+  "攻",
+  "更",
+  "校",
+  "梗",
+  "構",
+  "江",
+  "洪",
+  "港",
+  "溝",
+  "甲",
+  "皇",
+  "硬",
+  "稿",
+  "紅",
+  "絞",
+  "綱",
+  "耕",
+  "考",
+  "肯",
+  "航",
+  "荒",
+  "行",
+  "衡",
+  "講",
+  "貢",
+  "購",
+  "郊",
+  "酵",
+  "鉱",
+  "鋼",
+  "降",
+  "項",
+  "香",
+  "高",
+  "剛",
+  "号",
+  "合",
+  "拷",
+  "豪",
+  "克",
+  "刻",
+  "告",
+  "国",
+  "穀",
+  "酷",
+  "黒",
+  "獄",
+  "腰",
+  "骨",
+  "込",
+  "頃",
+  "今",
+  "困",
+  "墾",
+  "婚",
+  "恨",
+  "懇",
+  "昆",
+  "根",
+  "混",
+  "痕",
+  "紺",
+  "魂",
+  "佐",
+  "唆",
+  "左",
+  "差",
+  "査",
+  "沙",
+  "砂",
+  "詐",
+  "鎖",
+  "座",
+  "挫",
+  "債",
+  "催",
+  "再",
+  "最",
+  "塞",
+  "妻",
+  "宰",
+  "彩",
+  "才",
+  "採",
+  "栽",
+  "歳",
+  "済",
+  "災",
+  "采",
+  "砕",
+  "祭",
+  "斎",
+  "細",
+  "菜",
+  "裁",
+  "載",
+  "際",
+  "剤",
+  "在",
+  "材",
+  "罪",
+  "財",
+  "坂",
+  "阪",
+  "咲",
+  "崎",
+  "埼",
+  "作",
+  "削",
+  "搾",
+  "昨",
+  "柵",
+  "策",
+  "索",
+  "錯",
+  "桜",
+  "冊",
+  "刷",
+  "察",
+  "拶",
+  "撮",
+  "擦",
+  "札",
+  "殺",
+  "雑",
+  "皿",
+  "三",
+  "傘",
+  "参",
+  "山",
+  "惨",
+  "散",
+  "桟",
+  "産",
+  "算",
+  "蚕",
+  "賛",
+  "酸",
+  "斬",
+  "暫",
+  "残",
+  "仕",
+  "伺",
+  "使",
+  "刺",
+  "司",
+  "史",
+  "嗣",
+  "四",
+  "士",
+  "始",
+  "姉",
+  "姿",
+  "子",
+  "市",
+  "師",
+  "志",
+  "思",
+  "指",
+  "支",
+  "施",
+  "旨",
+  "枝",
+  "止",
+  "死",
+  "氏",
+  "祉",
+  "私",
+  "糸",
+  "紙",
+  "紫",
+  "肢",
+  "脂",
+  "至",
+  "視",
+  "詞",
+  "詩",
+  "試",
+  "誌",
+  "諮",
+  "資",
+  "賜",
+  "雌",
+  "飼",
+  "歯",
+  "事",
+  "似",
+  "侍",
+  "児",
+  "字",
+  "寺",
+  "慈",
+  "持",
+  "時",
+  "次",
+  "滋",
+  "治",
+  "璽",
+  "磁",
+  "示",
+  "耳",
+  "自",
+  "辞",
+  "鹿",
+  "式",
+  "識",
+  "軸",
+  "七",
+  "叱",
+  "執",
+  "失",
+  "嫉",
+  "室",
+  "湿",
+  "漆",
+  "疾",
+  "質",
+  "実",
+  "芝",
+  "舎",
+  "写",
+  "射",
+  "捨",
+  "赦",
+  "斜",
+  "煮",
+  "社",
+  "者",
+  "謝",
+  "車",
+  "遮",
+  "蛇",
+  "邪",
+  "借",
+  "尺",
+  "爵",
+  "酌",
+  "釈",
+  "若",
+  "寂",
+  "弱",
+  "主",
+  "取",
+  "守",
+  "手",
+  "朱",
+  "殊",
+  "狩",
+  "珠",
+  "種",
+  "腫",
+  "趣",
+  "酒",
+  "首",
+  "儒",
+  "受",
+  "呪",
+  "寿",
+  "授",
+  "樹",
+  "需",
+  "囚",
+  "収",
+  "周",
+  "宗",
+  "就",
+  "州",
+  "修",
+  "愁",
+  "拾",
+  "秀",
+  "秋",
+  "終",
+  "習",
+  "臭",
+  "舟",
+  "衆",
+  "襲",
+  "蹴",
+  "週",
+  "酬",
+  "集",
+  "醜",
+  "住",
+  "充",
+  "十",
+  "従",
+  "柔",
+  "汁",
+  "渋",
+  "獣",
+  "縦",
+  "重",
+  "銃",
+  "叔",
+  "宿",
+  "淑",
+  "祝",
+  "縮",
+  "粛",
+  "塾",
+  "熟",
+  "出",
+  "術",
+  "述",
+  "俊",
+  "春",
+  "瞬",
+  "准",
+  "循",
+  "旬",
+  "殉",
+  "準",
+  "潤",
+  "盾",
+  "純",
+  "巡",
+  "遵",
+  "順",
+  "処",
+  "初",
+  "所",
+  "暑",
+  "庶",
+  "緒",
+  "署",
+  "書",
+  "諸",
+  "助",
+  "叙",
+  "女",
+  "序",
+  "徐",
+  "除",
+  "傷",
+  "償",
+  "勝",
+  "匠",
+  "升",
+  "召",
+  "商",
+  "唱",
+  "奨",
+  "宵",
+  "将",
+  "小",
+  "少",
+  "尚",
+  "床",
+  "彰",
+  "承",
+  "抄",
+  "招",
+  "掌",
+  "昇",
+  "昭",
+  "晶",
+  "松",
+  "沼",
+  "消",
+  "渉",
+  "焼",
+  "焦",
+  "照",
+  "症",
+  "省",
+  "硝",
+  "礁",
+  "祥",
+  "称",
+  "章",
+  "笑",
+  "粧",
+  "紹",
+  "肖",
+  "衝",
+  "訟",
+  "証",
+  "詔",
+  "詳",
+  "象",
+  "賞",
+  "鐘",
+  "障",
+  "上",
+  "丈",
+  "乗",
+  "冗",
+  "剰",
+  "城",
+  "場",
+  "壌",
+  "嬢",
+  "常",
+  "情",
+  "条",
+  "浄",
+  "状",
+  "畳",
+  "蒸",
+  "譲",
+  "醸",
+  "錠",
+  "嘱",
+  "飾",
+  "拭",
+  "植",
+  "殖",
+  "織",
+  "職",
+  "色",
+  "触",
+  "食",
+  "辱",
+  "尻",
+  "伸",
+  "信",
+  "侵",
+  "唇",
+  "娠",
+  "寝",
+  "審",
+  "心",
+  "慎",
+  "振",
+  "新",
+  "森",
+  "浸",
+  "深",
+  "申",
+  "真",
+  "神",
+  "紳",
+  "臣",
+  "芯",
+  "薪",
+  "親",
+  "診",
+  "身",
+  "辛",
+  "進",
+  "針",
+  "震",
+  "人",
+  "仁",
+  "刃",
+  "尋",
+  "甚",
+  "尽",
+  "腎",
+  "迅",
+  "陣",
+  "須",
+  "酢",
+  "図",
+  "吹",
+  "垂",
+  "帥",
+  "推",
+  "水",
+  "炊",
+  "睡",
+  "粋",
+  "衰",
+  "遂",
+  "酔",
+  "随",
+  "髄",
+  "崇",
+  "数",
+  "枢",
+  "据",
+  "杉",
+  "裾",
+  "澄",
+  "寸",
+  "世",
+  "瀬",
+  "畝",
+  "是",
+  "凄",
+  "制",
+  "勢",
+  "姓",
+  "征",
+  "性",
+  "成",
+  "政",
+  "整",
+  "星",
+  "晴",
+  "正",
+  "清",
+  "牲",
+  "生",
+  "盛",
+  "精",
+  "聖",
+  "声",
+  "製",
+  "西",
+  "誠",
+  "誓",
+  "請",
+  "逝",
+  "醒",
+  "青",
+  "静",
+  "斉",
+  "税",
+  "隻",
+  "席",
+  "惜",
+  "戚",
+  "斥",
+  "昔",
+  "析",
+  "石",
+  "積",
+  "籍",
+  "績",
+  "脊",
+  "責",
+  "赤",
+  "跡",
+  "切",
+  "拙",
+  "接",
+  "摂",
+  "折",
+  "設",
+  "窃",
+  "節",
+  "説",
+  "雪",
+  "絶",
+  "舌",
+  "仙",
+  "先",
+  "千",
+  "占",
+  "宣",
+  "専",
+  "川",
+  "戦",
+  "扇",
+  "栓",
+  "泉",
+  "浅",
+  "洗",
+  "染",
+  "潜",
+  "煎",
+  "旋",
+  "線",
+  "繊",
+  "羨",
+  "腺",
+  "船",
+  "薦",
+  "詮",
+  "践",
+  "選",
+  "遷",
+  "銭",
+  "鮮",
+  "前",
+  "善",
+  "漸",
+  "然",
+  "全",
+  "禅",
+  "繕",
+  "膳",
+  "塑",
+  "措",
+  "曽",
+  "狙",
+  "疎",
+  "礎",
+  "祖",
+  "租",
+  "粗",
+  "素",
+  "組",
+  "訴",
+  "阻",
+  "遡",
+  "僧",
+  "創",
+  "双",
+  "倉",
+  "喪",
+  "壮",
+  "奏",
+  "爽",
+  "層",
+  "想",
+  "捜",
+  "掃",
+  "挿",
+  "操",
+  "早",
+  "曹",
+  "巣",
+  "槽",
+  "燥",
+  "争",
+  "痩",
+  "相",
+  "窓",
+  "総",
+  "草",
+  "荘",
+  "葬",
+  "藻",
+  "装",
+  "走",
+  "送",
+  "遭",
+  "霜",
+  "騒",
+  "像",
+  "増",
+  "憎",
+  "臓",
+  "蔵",
+  "贈",
+  "造",
+  "促",
+  "側",
+  "則",
+  "即",
+  "息",
+  "捉",
+  "束",
+  "測",
+  "足",
+  "速",
+  "俗",
+  "属",
+  "賊",
+  "族",
+  "続",
+  "卒",
+  "袖",
+  "存",
+  "孫",
+  "尊",
+  "損",
+  "村",
+  "遜",
+  "他",
+  "多",
+  "太",
+  "汰",
+  "唾",
+  "堕",
+  "妥",
+  "惰",
+  "打",
+  "駄",
+  "体",
+  "堆",
+  "対",
+  "耐",
+  "帯",
+  "待",
+  "怠",
+  "態",
+  "戴",
+  "替",
+  "泰",
+  "滞",
+  "胎",
+  "袋",
+  "貸",
+  "退",
+  "逮",
+  "隊",
+  "代",
+  "台",
+  "大",
+  "第",
+  "題",
+  "滝",
+  "卓",
+  "宅",
+  "択",
+  "拓",
+  "沢",
+  "濯",
+  "託",
+  "濁",
+  "諾",
+  "但",
+  "達",
+  "奪",
+  "脱",
+  "棚",
+  "谷",
+  "誰",
+  "丹",
+  "単",
+  "嘆",
+  "担",
+  "探",
+  "旦",
+  "淡",
+  "炭",
+  "短",
+  "端",
+  "綻",
+  "胆",
+  "誕",
+  "鍛",
+  "団",
+  "壇",
+  "弾",
+  "断",
+  "暖",
+  "段",
+  "男",
+  "談",
+  "値",
+  "知",
+  "地",
+  "恥",
+  "池",
+  "痴",
+  "稚",
+  "置",
+  "致",
+  "遅",
+  "築",
+  "畜",
+  "竹",
+  "蓄",
+  "逐",
+  "秩",
+  "窒",
+  "茶",
+  "嫡",
+  "着",
+  "中",
+  "仲",
+  "宙",
+  "忠",
+  "抽",
+  "昼",
+  "柱",
+  "注",
+  "虫",
+  "衷",
+  "酎",
+  "鋳",
+  "駐",
+  "著",
+  "貯",
+  "丁",
+  "兆",
+  "帳",
+  "庁",
+  "弔",
+  "張",
+  "彫",
+  "徴",
+  "懲",
+  "挑",
+  "朝",
+  "潮",
+  "町",
+  "眺",
+  "聴",
+  "腸",
+  "調",
+  "超",
+  "跳",
+  "長",
+  "頂",
+  "鳥",
+  "勅",
+  "捗",
+  "直",
+  "朕",
+  "沈",
+  "珍",
+  "賃",
+  "鎮",
+  "陳",
+  "津",
+  "墜",
+  "椎",
+  "追",
+  "痛",
+  "通",
+  "塚",
+  "漬",
+  "潰",
+  "坪",
+  "爪",
+  "釣",
+  "鶴",
+  "亭",
+  "低",
+  "停",
+  "偵",
+  "貞",
+  "呈",
+  "堤",
+  "定",
+  "帝",
+  "底",
+  "庭",
+  "廷",
+  "弟",
+  "抵",
+  "提",
+  "程",
+  "締",
+  "艇",
+  "訂",
+  "諦",
+  "逓",
+  "邸",
+  "泥",
+  "摘",
+  "敵",
+  "滴",
+  "的",
+  "笛",
+  "適",
+  "溺",
+  "哲",
+  "徹",
+  "撤",
+  "迭",
+  "鉄",
+  "典",
+  "填",
+  "天",
+  "展",
+  "店",
+  "添",
+  "貼",
+  "転",
+  "点",
+  "伝",
+  "殿",
+  "田",
+  "電",
+  "吐",
+  "塗",
+  "妬",
+  "徒",
+  "斗",
+  "渡",
+  "登",
+  "賭",
+  "途",
+  "都",
+  "努",
+  "度",
+  "土",
+  "奴",
+  "怒",
+  "倒",
+  "党",
+  "冬",
+  "凍",
+  "刀",
+  "唐",
+  "塔",
+  "島",
+  "悼",
+  "投",
+  "搭",
+  "東",
+  "桃",
+  "棟",
+  "盗",
+  "湯",
+  "灯",
+  "当",
+  "痘",
+  "等",
+  "答",
+  "筒",
+  "糖",
+  "統",
+  "到",
+  "藤",
+  "討",
+  "謄",
+  "豆",
+  "踏",
+  "逃",
+  "透",
+  "陶",
+  "頭",
+  "騰",
+  "闘",
+  "働",
+  "動",
+  "同",
+  "堂",
+  "導",
+  "憧",
+  "洞",
+  "瞳",
+  "童",
+  "胴",
+  "道",
+  "銅",
+  "峠",
+  "匿",
+  "得",
+  "徳",
+  "特",
+  "督",
+  "篤",
+  "毒",
+  "独",
+  "読",
+  "栃",
+  "凸",
+  "突",
+  "届",
+  "屯",
+  "豚",
+  "頓",
+  "曇",
+  "鈍",
+  "奈",
+  "那",
+  "内",
+  "謎",
+  "鍋",
+  "縄",
+  "南",
+  "軟",
+  "難",
+  "二",
+  "尼",
+  "弐",
+  "匂",
+  "肉",
+  "虹",
+  "日",
+  "乳",
+  "入",
+  "如",
+  "尿",
+  "任",
+  "妊",
+  "忍",
+  "認",
+  "寧",
+  "猫",
+  "熱",
+  "年",
+  "念",
+  "捻",
+  "燃",
+  "粘",
+  "悩",
+  "濃",
+  "納",
+  "能",
+  "脳",
+  "農",
+  "把",
+  "覇",
+  "波",
+  "派",
+  "破",
+  "婆",
+  "罵",
+  "馬",
+  "俳",
+  "廃",
+  "拝",
+  "排",
+  "敗",
+  "杯",
+  "背",
+  "肺",
+  "輩",
+  "配",
+  "倍",
+  "培",
+  "媒",
+  "梅",
+  "買",
+  "売",
+  "賠",
+  "陪",
+  "伯",
+  "剥",
+  "博",
+  "拍",
+  "泊",
+  "白",
+  "舶",
+  "薄",
+  "迫",
+  "漠",
+  "爆",
+  "縛",
+  "麦",
+  "箱",
+  "箸",
+  "肌",
+  "畑",
+  "八",
+  "鉢",
+  "発",
+  "髪",
+  "伐",
+  "罰",
+  "抜",
+  "閥",
+  "伴",
+  "判",
+  "半",
+  "反",
+  "帆",
+  "搬",
+  "斑",
+  "板",
+  "氾",
+  "汎",
+  "版",
+  "犯",
+  "班",
+  "畔",
+  "繁",
+  "般",
+  "藩",
+  "販",
+  "範",
+  "煩",
+  "頒",
+  "飯",
+  "晩",
+  "番",
+  "盤",
+  "蛮",
+  "卑",
+  "否",
+  "妃",
+  "彼",
+  "悲",
+  "扉",
+  "批",
+  "披",
+  "比",
+  "泌",
+  "疲",
+  "皮",
+  "碑",
+  "秘",
+  "罷",
+  "肥",
+  "被",
+  "費",
+  "避",
+  "非",
+  "飛",
+  "備",
+  "尾",
+  "微",
+  "眉",
+  "美",
+  "鼻",
+  "匹",
+  "膝",
+  "肘",
+  "必",
+  "筆",
+  "姫",
+  "媛",
+  "百",
+  "俵",
+  "標",
+  "氷",
+  "漂",
+  "票",
+  "表",
+  "評",
+  "描",
+  "病",
+  "秒",
+  "苗",
+  "品",
+  "浜",
+  "貧",
+  "賓",
+  "頻",
+  "敏",
+  "瓶",
+  "不",
+  "付",
+  "夫",
+  "婦",
+  "富",
+  "布",
+  "府",
+  "怖",
+  "扶",
+  "敷",
+  "普",
+  "浮",
+  "父",
+  "符",
+  "腐",
+  "膚",
+  "譜",
+  "負",
+  "賦",
+  "赴",
+  "阜",
+  "附",
+  "侮",
+  "武",
+  "舞",
+  "部",
+  "封",
+  "風",
+  "伏",
+  "副",
+  "復",
+  "幅",
+  "服",
+  "福",
+  "腹",
+  "複",
+  "覆",
+  "払",
+  "沸",
+  "仏",
+  "物",
+  "分",
+  "噴",
+  "墳",
+  "憤",
+  "奮",
+  "粉",
+  "紛",
+  "雰",
+  "文",
+  "聞",
+  "丙",
+  "併",
+  "兵",
+  "塀",
+  "幣",
+  "平",
+  "弊",
+  "柄",
+  "並",
+  "蔽",
+  "閉",
+  "陛",
+  "米",
+  "壁",
+  "癖",
+  "別",
+  "蔑",
+  "偏",
+  "変",
+  "片",
+  "編",
+  "辺",
+  "返",
+  "遍",
+  "便",
+  "勉",
+  "弁",
+  "保",
+  "舗",
+  "捕",
+  "歩",
+  "補",
+  "穂",
+  "募",
+  "墓",
+  "慕",
+  "暮",
+  "母",
+  "簿",
+  "倣",
+  "俸",
+  "包",
+  "報",
+  "奉",
+  "宝",
+  "峰",
+  "崩",
+  "抱",
+  "放",
+  "方",
+  "法",
+  "泡",
+  "砲",
+  "縫",
+  "胞",
+  "芳",
+  "蜂",
+  "褒",
+  "訪",
+  "豊",
+  "邦",
+  "飽",
+  "乏",
+  "亡",
+  "傍",
+  "剖",
+  "坊",
+  "妨",
+  "帽",
+  "忘",
+  "忙",
+  "房",
+  "暴",
+  "望",
+  "某",
+  "棒",
+  "冒",
+  "紡",
+  "肪",
+  "膨",
+  "謀",
+  "貌",
+  "貿",
+  "防",
+  "頬",
+  "北",
+  "僕",
+  "墨",
+  "撲",
+  "朴",
+  "牧",
+  "睦",
+  "勃",
+  "没",
+  "堀",
+  "奔",
+  "本",
+  "翻",
+  "凡",
+  "盆",
+  "摩",
+  "磨",
+  "魔",
+  "麻",
+  "埋",
+  "妹",
+  "昧",
+  "枚",
+  "毎",
+  "幕",
+  "膜",
+  "枕",
+  "又",
+  "抹",
+  "末",
+  "繭",
+  "万",
+  "慢",
+  "満",
+  "漫",
+  "味",
+  "未",
+  "魅",
+  "岬",
+  "密",
+  "蜜",
+  "脈",
+  "妙",
+  "民",
+  "眠",
+  "務",
+  "夢",
+  "無",
+  "矛",
+  "霧",
+  "婿",
+  "娘",
+  "冥",
+  "名",
+  "命",
+  "明",
+  "盟",
+  "迷",
+  "銘",
+  "鳴",
+  "滅",
+  "免",
+  "綿",
+  "面",
+  "麺",
+  "模",
+  "茂",
+  "妄",
+  "毛",
+  "猛",
+  "盲",
+  "網",
+  "耗",
+  "木",
+  "黙",
+  "目",
+  "餅",
+  "戻",
+  "問",
+  "紋",
+  "門",
+  "冶",
+  "夜",
+  "野",
+  "弥",
+  "矢",
+  "厄",
+  "役",
+  "約",
+  "薬",
+  "訳",
+  "躍",
+  "柳",
+  "愉",
+  "油",
+  "癒",
+  "諭",
+  "輸",
+  "唯",
+  "優",
+  "勇",
+  "友",
+  "幽",
+  "悠",
+  "憂",
+  "有",
+  "湧",
+  "猶",
+  "由",
+  "裕",
+  "誘",
+  "遊",
+  "郵",
+  "雄",
+  "融",
+  "夕",
+  "予",
+  "余",
+  "与",
+  "誉",
+  "預",
+  "幼",
+  "妖",
+  "容",
+  "庸",
+  "揚",
+  "揺",
+  "擁",
+  "曜",
+  "様",
+  "洋",
+  "溶",
+  "用",
+  "窯",
+  "羊",
+  "葉",
+  "要",
+  "謡",
+  "踊",
+  "陽",
+  "養",
+  "抑",
+  "欲",
+  "沃",
+  "浴",
+  "翌",
+  "翼",
+  "羅",
+  "裸",
+  "来",
+  "頼",
+  "雷",
+  "絡",
+  "落",
+  "酪",
+  "乱",
+  "卵",
+  "嵐",
+  "欄",
+  "濫",
+  "藍",
+  "覧",
+  "利",
+  "吏",
+  "履",
+  "梨",
+  "理",
+  "璃",
+  "痢",
+  "裏",
+  "里",
+  "離",
+  "陸",
+  "律",
+  "率",
+  "立",
+  "略",
+  "流",
+  "留",
+  "硫",
+  "粒",
+  "隆",
+  "竜",
+  "侶",
+  "慮",
+  "旅",
+  "虜",
+  "了",
+  "僚",
+  "両",
+  "寮",
+  "料",
+  "涼",
+  "猟",
+  "療",
+  "瞭",
+  "糧",
+  "良",
+  "量",
+  "陵",
+  "領",
+  "力",
+  "緑",
+  "倫",
+  "厘",
+  "林",
+  "臨",
+  "輪",
+  "隣",
+  "瑠",
+  "塁",
+  "涙",
+  "累",
+  "類",
+  "令",
+  "例",
+  "冷",
+  "励",
+  "礼",
+  "鈴",
+  "隷",
+  "零",
+  "霊",
+  "麗",
+  "齢",
+  "暦",
+  "歴",
+  "列",
+  "劣",
+  "烈",
+  "裂",
+  "廉",
+  "恋",
+  "練",
+  "連",
+  "錬",
+  "呂",
+  "炉",
+  "賂",
+  "路",
+  "露",
+  "労",
+  "廊",
+  "弄",
+  "朗",
+  "楼",
+  "浪",
+  "漏",
+  "老",
+  "郎",
+  "六",
+  "麓",
+  "録",
+  "論",
+  "和",
+  "話",
+  "賄",
+  "脇",
+  "惑",
+  "枠",
+  "湾",
+  "腕",
+  "丼",
+  "傲",
+  "刹",
+  "哺",
+  "喩",
+  "嗅",
+  "嘲",
+  "毀",
+  "彙",
+  "恣",
+  "惧",
+  "慄",
+  "憬",
+  "拉",
+  "摯",
+  "曖",
+  "楷",
+  "鬱",
+  "璧",
+  "瘍",
+  "箋",
+  "籠",
+  "緻",
+  "羞",
+  "訃",
+  "諧",
+  "貪",
+  "踪",
+  "辣",
+  "錮",
+};
+const char *ALPHA_118_LOWER[] = {
+  "々",
+  "ゝ",
+  "ヽ",
+  "ゞ",
+  "ヾ",
+  "ー",
+  "ぁ",
+  "ァ",
+  "ア",
+  "あ",
+  "ぃ",
+  "ィ",
+  "イ",
+  "い",
+  "ぅ",
+  "ゥ",
+  "ウ",
+  "う",
+  "ヴ",
+  "ぇ",
+  "ェ",
+  "エ",
+  "え",
+  "ぉ",
+  "ォ",
+  "オ",
+  "お",
+  "ヵ",
+  "か",
+  "カ",
+  "が",
+  "ガ",
+  "き",
+  "キ",
+  "ぎ",
+  "ギ",
+  "ク",
+  "く",
+  "ぐ",
+  "グ",
+  "ヶ",
+  "ケ",
+  "け",
+  "げ",
+  "ゲ",
+  "こ",
+  "コ",
+  "ゴ",
+  "ご",
+  "さ",
+  "サ",
+  "ざ",
+  "ザ",
+  "シ",
+  "し",
+  "ジ",
+  "じ",
+  "ス",
+  "す",
+  "ず",
+  "ズ",
+  "セ",
+  "せ",
+  "ゼ",
+  "ぜ",
+  "そ",
+  "ソ",
+  "ゾ",
+  "ぞ",
+  "タ",
+  "た",
+  "だ",
+  "ダ",
+  "ち",
+  "チ",
+  "ぢ",
+  "ヂ",
+  "っ",
+  "ッ",
+  "つ",
+  "ツ",
+  "づ",
+  "ヅ",
+  "テ",
+  "て",
+  "で",
+  "デ",
+  "ト",
+  "と",
+  "ど",
+  "ド",
+  "な",
+  "ナ",
+  "ニ",
+  "に",
+  "ぬ",
+  "ヌ",
+  "ね",
+  "ネ",
+  "ノ",
+  "の",
+  "は",
+  "ハ",
+  "ば",
+  "バ",
+  "パ",
+  "ぱ",
+  "ヒ",
+  "ひ",
+  "び",
+  "ビ",
+  "ピ",
+  "ぴ",
+  "ふ",
+  "フ",
+  "ブ",
+  "ぶ",
+  "プ",
+  "ぷ",
+  "へ",
+  "ヘ",
+  "べ",
+  "ベ",
+  "ぺ",
+  "ペ",
+  "ほ",
+  "ホ",
+  "ぼ",
+  "ボ",
+  "ポ",
+  "ぽ",
+  "マ",
+  "ま",
+  "ミ",
+  "み",
+  "む",
+  "ム",
+  "メ",
+  "め",
+  "も",
+  "モ",
+  "ゃ",
+  "ャ",
+  "や",
+  "ヤ",
+  "ュ",
+  "ゅ",
+  "ゆ",
+  "ユ",
+  "ョ",
+  "ょ",
+  "よ",
+  "ヨ",
+  "ラ",
+  "ら",
+  "リ",
+  "り",
+  "る",
+  "ル",
+  "れ",
+  "レ",
+  "ろ",
+  "ロ",
+  "ゎ",
+  "ヮ",
+  "わ",
+  "ワ",
+  "ゐ",
+  "ヰ",
+  "ヱ",
+  "ゑ",
+  "を",
+  "ヲ",
+  "ン",
+  "ん",
+  "亜",
+  "哀",
+  "愛",
+  "挨",
+  "悪",
+  "握",
+  "圧",
+  "扱",
+  "宛",
+  "安",
+  "暗",
+  "案",
+  "闇",
+  "以",
+  "位",
+  "依",
+  "偉",
+  "囲",
+  "委",
+  "威",
+  "尉",
+  "意",
+  "慰",
+  "易",
+  "椅",
+  "為",
+  "畏",
+  "異",
+  "移",
+  "維",
+  "緯",
+  "胃",
+  "萎",
+  "衣",
+  "違",
+  "遺",
+  "医",
+  "井",
+  "域",
+  "育",
+  "一",
+  "壱",
+  "逸",
+  "稲",
+  "茨",
+  "芋",
+  "印",
+  "咽",
+  "員",
+  "因",
+  "姻",
+  "引",
+  "飲",
+  "淫",
+  "院",
+  "陰",
+  "隠",
+  "韻",
+  "右",
+  "宇",
+  "羽",
+  "雨",
+  "臼",
+  "渦",
+  "唄",
+  "浦",
+  "運",
+  "雲",
+  "餌",
+  "営",
+  "影",
+  "映",
+  "栄",
+  "永",
+  "泳",
+  "英",
+  "衛",
+  "詠",
+  "鋭",
+  "液",
+  "疫",
+  "益",
+  "駅",
+  "悦",
+  "謁",
+  "越",
+  "閲",
+  "円",
+  "園",
+  "宴",
+  "延",
+  "怨",
+  "援",
+  "沿",
+  "演",
+  "炎",
+  "煙",
+  "猿",
+  "縁",
+  "艶",
+  "遠",
+  "鉛",
+  "塩",
+  "汚",
+  "凹",
+  "央",
+  "奥",
+  "往",
+  "応",
+  "押",
+  "旺",
+  "横",
+  "欧",
+  "殴",
+  "王",
+  "翁",
+  "黄",
+  "岡",
+  "沖",
+  "億",
+  "屋",
+  "憶",
+  "臆",
+  "乙",
+  "俺",
+  "卸",
+  "恩",
+  "温",
+  "穏",
+  "音",
+  "下",
+  "化",
+  "仮",
+  "何",
+  "価",
+  "佳",
+  "加",
+  "可",
+  "夏",
+  "嫁",
+  "家",
+  "寡",
+  "科",
+  "暇",
+  "果",
+  "架",
+  "歌",
+  "河",
+  "火",
+  "禍",
+  "稼",
+  "箇",
+  "花",
+  "苛",
+  "荷",
+  "華",
+  "菓",
+  "課",
+  "貨",
+  "過",
+  "蚊",
+  "我",
+  "牙",
+  "画",
+  "芽",
+  "賀",
+  "雅",
+  "餓",
+  "介",
+  "会",
+  "解",
+  "回",
+  "塊",
+  "壊",
+  "快",
+  "怪",
+  "悔",
+  "懐",
+  "戒",
+  "拐",
+  "改",
+  "械",
+  "海",
+  "灰",
+  "界",
+  "皆",
+  "絵",
+  "開",
+  "階",
+  "貝",
+  "劾",
+  "外",
+  "害",
+  "崖",
+  "慨",
+  "概",
+  "涯",
+  "蓋",
+  "街",
+  "該",
+  "骸",
+  "垣",
+  "柿",
+  "嚇",
+  "各",
+  "拡",
+  "格",
+  "核",
+  "殻",
+  "獲",
+  "確",
+  "穫",
+  "覚",
+  "角",
+  "較",
+  "郭",
+  "閣",
+  "隔",
+  "革",
+  "学",
+  "岳",
+  "楽",
+  "額",
+  "顎",
+  "掛",
+  "潟",
+  "割",
+  "喝",
+  "括",
+  "活",
+  "渇",
+  "滑",
+  "葛",
+  "褐",
+  "轄",
+  "且",
+  "株",
+  "釜",
+  "鎌",
+  "刈",
+  "瓦",
+  "乾",
+  "冠",
+  "寒",
+  "刊",
+  "勘",
+  "勧",
+  "巻",
+  "喚",
+  "堪",
+  "完",
+  "官",
+  "寛",
+  "干",
+  "幹",
+  "患",
+  "感",
+  "慣",
+  "憾",
+  "換",
+  "敢",
+  "棺",
+  "款",
+  "歓",
+  "汗",
+  "漢",
+  "環",
+  "甘",
+  "監",
+  "看",
+  "管",
+  "簡",
+  "緩",
+  "缶",
+  "肝",
+  "艦",
+  "観",
+  "貫",
+  "還",
+  "鑑",
+  "間",
+  "閑",
+  "関",
+  "陥",
+  "韓",
+  "館",
+  "丸",
+  "含",
+  "岸",
+  "玩",
+  "眼",
+  "岩",
+  "頑",
+  "顔",
+  "願",
+  "企",
+  "伎",
+  "危",
+  "喜",
+  "器",
+  "基",
+  "奇",
+  "寄",
+  "岐",
+  "希",
+  "幾",
+  "忌",
+  "揮",
+  "机",
+  "旗",
+  "既",
+  "期",
+  "棋",
+  "棄",
+  "機",
+  "帰",
+  "気",
+  "汽",
+  "畿",
+  "祈",
+  "季",
+  "紀",
+  "規",
+  "記",
+  "貴",
+  "起",
+  "軌",
+  "輝",
+  "飢",
+  "騎",
+  "鬼",
+  "亀",
+  "偽",
+  "儀",
+  "宜",
+  "戯",
+  "技",
+  "擬",
+  "欺",
+  "犠",
+  "疑",
+  "義",
+  "議",
+  "菊",
+  "吉",
+  "喫",
+  "詰",
+  "却",
+  "客",
+  "脚",
+  "虐",
+  "逆",
+  "丘",
+  "久",
+  "休",
+  "及",
+  "吸",
+  "宮",
+  "弓",
+  "急",
+  "救",
+  "朽",
+  "求",
+  "泣",
+  "球",
+  "究",
+  "窮",
+  "級",
+  "糾",
+  "給",
+  "旧",
+  "牛",
+  "去",
+  "居",
+  "巨",
+  "拒",
+  "拠",
+  "挙",
+  "虚",
+  "許",
+  "距",
+  "漁",
+  "魚",
+  "享",
+  "京",
+  "供",
+  "競",
+  "共",
+  "凶",
+  "協",
+  "叫",
+  "境",
+  "峡",
+  "強",
+  "恐",
+  "恭",
+  "挟",
+  "教",
+  "橋",
+  "況",
+  "狂",
+  "狭",
+  "矯",
+  "胸",
+  "脅",
+  "興",
+  "郷",
+  "鏡",
+  "響",
+  "驚",
+  "仰",
+  "凝",
+  "暁",
+  "業",
+  "局",
+  "曲",
+  "極",
+  "玉",
+  "僅",
+  "勤",
+  "均",
+  "巾",
+  "錦",
+  "斤",
+  "琴",
+  "禁",
+  "筋",
+  "緊",
+  "菌",
+  "襟",
+  "謹",
+  "近",
+  "金",
+  "吟",
+  "銀",
+  "九",
+  "句",
+  "区",
+  "苦",
+  "駆",
+  "駒",
+  "具",
+  "愚",
+  "虞",
+  "空",
+  "偶",
+  "遇",
+  "隅",
+  "串",
+  "屈",
+  "掘",
+  "窟",
+  "靴",
+  "熊",
+  "繰",
+  "桑",
+  "勲",
+  "君",
+  "薫",
+  "訓",
+  "群",
+  "軍",
+  "郡",
+  "係",
+  "傾",
+  "刑",
+  "兄",
+  "啓",
+  "型",
+  "契",
+  "形",
+  "径",
+  "恵",
+  "慶",
+  "憩",
+  "掲",
+  "携",
+  "敬",
+  "景",
+  "渓",
+  "稽",
+  "系",
+  "経",
+  "継",
+  "茎",
+  "蛍",
+  "計",
+  "詣",
+  "警",
+  "軽",
+  "鶏",
+  "芸",
+  "迎",
+  "鯨",
+  "劇",
+  "撃",
+  "激",
+  "隙",
+  "桁",
+  "傑",
+  "欠",
+  "決",
+  "潔",
+  "穴",
+  "結",
+  "血",
+  "月",
+  "件",
+  "倹",
+  "健",
+  "兼",
+  "券",
+  "剣",
+  "圏",
+  "堅",
+  "嫌",
+  "建",
+  "憲",
+  "懸",
+  "拳",
+  "検",
+  "権",
+  "犬",
+  "献",
+  "研",
+  "絹",
+  "県",
+  "肩",
+  "見",
+  "謙",
+  "賢",
+  "軒",
+  "遣",
+  "鍵",
+  "険",
+  "顕",
+  "験",
+  "元",
+  "原",
+  "厳",
+  "幻",
+  "弦",
+  "減",
+  "源",
+  "玄",
+  "現",
+  "舷",
+  "言",
+  "限",
+  "個",
+  "古",
+  "呼",
+  "固",
+  "孤",
+  "己",
+  "庫",
+  "弧",
+  "戸",
+  "故",
+  "枯",
+  "湖",
+  "股",
+  "虎",
+  "誇",
+  "雇",
+  "顧",
+  "鼓",
+  "五",
+  "互",
+  "午",
+  "呉",
+  "娯",
+  "後",
+  "御",
+  "悟",
+  "碁",
+  "語",
+  "誤",
+  "護",
+  "乞",
+  "交",
+  "侯",
+  "候",
+  "光",
+  "公",
+  "功",
+  "効",
+  "勾",
+  "厚",
+  "口",
+  "向",
+  "后",
+  "喉",
+  "坑",
+  "好",
+  "孔",
+  "孝",
+  "工",
+  "巧",
+  "幸",
+  "広",
+  "康",
+  "恒",
+  "慌",
+  "抗",
+  "拘",
+  "控",
+  "攻",
+  "更",
+  "校",
+  "梗",
+  "構",
+  "江",
+  "洪",
+  "港",
+  "溝",
+  "甲",
+  "皇",
+  "硬",
+  "稿",
+  "紅",
+  "絞",
+  "綱",
+  "耕",
+  "考",
+  "肯",
+  "航",
+  "荒",
+  "行",
+  "衡",
+  "講",
+  "貢",
+  "購",
+  "郊",
+  "酵",
+  "鉱",
+  "鋼",
+  "降",
+  "項",
+  "香",
+  "高",
+  "剛",
+  "号",
+  "合",
+  "拷",
+  "豪",
+  "克",
+  "刻",
+  "告",
+  "国",
+  "穀",
+  "酷",
+  "黒",
+  "獄",
+  "腰",
+  "骨",
+  "込",
+  "頃",
+  "今",
+  "困",
+  "墾",
+  "婚",
+  "恨",
+  "懇",
+  "昆",
+  "根",
+  "混",
+  "痕",
+  "紺",
+  "魂",
+  "佐",
+  "唆",
+  "左",
+  "差",
+  "査",
+  "沙",
+  "砂",
+  "詐",
+  "鎖",
+  "座",
+  "挫",
+  "債",
+  "催",
+  "再",
+  "最",
+  "塞",
+  "妻",
+  "宰",
+  "彩",
+  "才",
+  "採",
+  "栽",
+  "歳",
+  "済",
+  "災",
+  "采",
+  "砕",
+  "祭",
+  "斎",
+  "細",
+  "菜",
+  "裁",
+  "載",
+  "際",
+  "剤",
+  "在",
+  "材",
+  "罪",
+  "財",
+  "坂",
+  "阪",
+  "咲",
+  "崎",
+  "埼",
+  "作",
+  "削",
+  "搾",
+  "昨",
+  "柵",
+  "策",
+  "索",
+  "錯",
+  "桜",
+  "冊",
+  "刷",
+  "察",
+  "拶",
+  "撮",
+  "擦",
+  "札",
+  "殺",
+  "雑",
+  "皿",
+  "三",
+  "傘",
+  "参",
+  "山",
+  "惨",
+  "散",
+  "桟",
+  "産",
+  "算",
+  "蚕",
+  "賛",
+  "酸",
+  "斬",
+  "暫",
+  "残",
+  "仕",
+  "伺",
+  "使",
+  "刺",
+  "司",
+  "史",
+  "嗣",
+  "四",
+  "士",
+  "始",
+  "姉",
+  "姿",
+  "子",
+  "市",
+  "師",
+  "志",
+  "思",
+  "指",
+  "支",
+  "施",
+  "旨",
+  "枝",
+  "止",
+  "死",
+  "氏",
+  "祉",
+  "私",
+  "糸",
+  "紙",
+  "紫",
+  "肢",
+  "脂",
+  "至",
+  "視",
+  "詞",
+  "詩",
+  "試",
+  "誌",
+  "諮",
+  "資",
+  "賜",
+  "雌",
+  "飼",
+  "歯",
+  "事",
+  "似",
+  "侍",
+  "児",
+  "字",
+  "寺",
+  "慈",
+  "持",
+  "時",
+  "次",
+  "滋",
+  "治",
+  "璽",
+  "磁",
+  "示",
+  "耳",
+  "自",
+  "辞",
+  "鹿",
+  "式",
+  "識",
+  "軸",
+  "七",
+  "叱",
+  "執",
+  "失",
+  "嫉",
+  "室",
+  "湿",
+  "漆",
+  "疾",
+  "質",
+  "実",
+  "芝",
+  "舎",
+  "写",
+  "射",
+  "捨",
+  "赦",
+  "斜",
+  "煮",
+  "社",
+  "者",
+  "謝",
+  "車",
+  "遮",
+  "蛇",
+  "邪",
+  "借",
+  "尺",
+  "爵",
+  "酌",
+  "釈",
+  "若",
+  "寂",
+  "弱",
+  "主",
+  "取",
+  "守",
+  "手",
+  "朱",
+  "殊",
+  "狩",
+  "珠",
+  "種",
+  "腫",
+  "趣",
+  "酒",
+  "首",
+  "儒",
+  "受",
+  "呪",
+  "寿",
+  "授",
+  "樹",
+  "需",
+  "囚",
+  "収",
+  "周",
+  "宗",
+  "就",
+  "州",
+  "修",
+  "愁",
+  "拾",
+  "秀",
+  "秋",
+  "終",
+  "習",
+  "臭",
+  "舟",
+  "衆",
+  "襲",
+  "蹴",
+  "週",
+  "酬",
+  "集",
+  "醜",
+  "住",
+  "充",
+  "十",
+  "従",
+  "柔",
+  "汁",
+  "渋",
+  "獣",
+  "縦",
+  "重",
+  "銃",
+  "叔",
+  "宿",
+  "淑",
+  "祝",
+  "縮",
+  "粛",
+  "塾",
+  "熟",
+  "出",
+  "術",
+  "述",
+  "俊",
+  "春",
+  "瞬",
+  "准",
+  "循",
+  "旬",
+  "殉",
+  "準",
+  "潤",
+  "盾",
+  "純",
+  "巡",
+  "遵",
+  "順",
+  "処",
+  "初",
+  "所",
+  "暑",
+  "庶",
+  "緒",
+  "署",
+  "書",
+  "諸",
+  "助",
+  "叙",
+  "女",
+  "序",
+  "徐",
+  "除",
+  "傷",
+  "償",
+  "勝",
+  "匠",
+  "升",
+  "召",
+  "商",
+  "唱",
+  "奨",
+  "宵",
+  "将",
+  "小",
+  "少",
+  "尚",
+  "床",
+  "彰",
+  "承",
+  "抄",
+  "招",
+  "掌",
+  "昇",
+  "昭",
+  "晶",
+  "松",
+  "沼",
+  "消",
+  "渉",
+  "焼",
+  "焦",
+  "照",
+  "症",
+  "省",
+  "硝",
+  "礁",
+  "祥",
+  "称",
+  "章",
+  "笑",
+  "粧",
+  "紹",
+  "肖",
+  "衝",
+  "訟",
+  "証",
+  "詔",
+  "詳",
+  "象",
+  "賞",
+  "鐘",
+  "障",
+  "上",
+  "丈",
+  "乗",
+  "冗",
+  "剰",
+  "城",
+  "場",
+  "壌",
+  "嬢",
+  "常",
+  "情",
+  "条",
+  "浄",
+  "状",
+  "畳",
+  "蒸",
+  "譲",
+  "醸",
+  "錠",
+  "嘱",
+  "飾",
+  "拭",
+  "植",
+  "殖",
+  "織",
+  "職",
+  "色",
+  "触",
+  "食",
+  "辱",
+  "尻",
+  "伸",
+  "信",
+  "侵",
+  "唇",
+  "娠",
+  "寝",
+  "審",
+  "心",
+  "慎",
+  "振",
+  "新",
+  "森",
+  "浸",
+  "深",
+  "申",
+  "真",
+  "神",
+  "紳",
+  "臣",
+  "芯",
+  "薪",
+  "親",
+  "診",
+  "身",
+  "辛",
+  "進",
+  "針",
+  "震",
+  "人",
+  "仁",
+  "刃",
+  "尋",
+  "甚",
+  "尽",
+  "腎",
+  "迅",
+  "陣",
+  "須",
+  "酢",
+  "図",
+  "吹",
+  "垂",
+  "帥",
+  "推",
+  "水",
+  "炊",
+  "睡",
+  "粋",
+  "衰",
+  "遂",
+  "酔",
+  "随",
+  "髄",
+  "崇",
+  "数",
+  "枢",
+  "据",
+  "杉",
+  "裾",
+  "澄",
+  "寸",
+  "世",
+  "瀬",
+  "畝",
+  "是",
+  "凄",
+  "制",
+  "勢",
+  "姓",
+  "征",
+  "性",
+  "成",
+  "政",
+  "整",
+  "星",
+  "晴",
+  "正",
+  "清",
+  "牲",
+  "生",
+  "盛",
+  "精",
+  "聖",
+  "声",
+  "製",
+  "西",
+  "誠",
+  "誓",
+  "請",
+  "逝",
+  "醒",
+  "青",
+  "静",
+  "斉",
+  "税",
+  "隻",
+  "席",
+  "惜",
+  "戚",
+  "斥",
+  "昔",
+  "析",
+  "石",
+  "積",
+  "籍",
+  "績",
+  "脊",
+  "責",
+  "赤",
+  "跡",
+  "切",
+  "拙",
+  "接",
+  "摂",
+  "折",
+  "設",
+  "窃",
+  "節",
+  "説",
+  "雪",
+  "絶",
+  "舌",
+  "仙",
+  "先",
+  "千",
+  "占",
+  "宣",
+  "専",
+  "川",
+  "戦",
+  "扇",
+  "栓",
+  "泉",
+  "浅",
+  "洗",
+  "染",
+  "潜",
+  "煎",
+  "旋",
+  "線",
+  "繊",
+  "羨",
+  "腺",
+  "船",
+  "薦",
+  "詮",
+  "践",
+  "選",
+  "遷",
+  "銭",
+  "鮮",
+  "前",
+  "善",
+  "漸",
+  "然",
+  "全",
+  "禅",
+  "繕",
+  "膳",
+  "塑",
+  "措",
+  "曽",
+  "狙",
+  "疎",
+  "礎",
+  "祖",
+  "租",
+  "粗",
+  "素",
+  "組",
+  "訴",
+  "阻",
+  "遡",
+  "僧",
+  "創",
+  "双",
+  "倉",
+  "喪",
+  "壮",
+  "奏",
+  "爽",
+  "層",
+  "想",
+  "捜",
+  "掃",
+  "挿",
+  "操",
+  "早",
+  "曹",
+  "巣",
+  "槽",
+  "燥",
+  "争",
+  "痩",
+  "相",
+  "窓",
+  "総",
+  "草",
+  "荘",
+  "葬",
+  "藻",
+  "装",
+  "走",
+  "送",
+  "遭",
+  "霜",
+  "騒",
+  "像",
+  "増",
+  "憎",
+  "臓",
+  "蔵",
+  "贈",
+  "造",
+  "促",
+  "側",
+  "則",
+  "即",
+  "息",
+  "捉",
+  "束",
+  "測",
+  "足",
+  "速",
+  "俗",
+  "属",
+  "賊",
+  "族",
+  "続",
+  "卒",
+  "袖",
+  "存",
+  "孫",
+  "尊",
+  "損",
+  "村",
+  "遜",
+  "他",
+  "多",
+  "太",
+  "汰",
+  "唾",
+  "堕",
+  "妥",
+  "惰",
+  "打",
+  "駄",
+  "体",
+  "堆",
+  "対",
+  "耐",
+  "帯",
+  "待",
+  "怠",
+  "態",
+  "戴",
+  "替",
+  "泰",
+  "滞",
+  "胎",
+  "袋",
+  "貸",
+  "退",
+  "逮",
+  "隊",
+  "代",
+  "台",
+  "大",
+  "第",
+  "題",
+  "滝",
+  "卓",
+  "宅",
+  "択",
+  "拓",
+  "沢",
+  "濯",
+  "託",
+  "濁",
+  "諾",
+  "但",
+  "達",
+  "奪",
+  "脱",
+  "棚",
+  "谷",
+  "誰",
+  "丹",
+  "単",
+  "嘆",
+  "担",
+  "探",
+  "旦",
+  "淡",
+  "炭",
+  "短",
+  "端",
+  "綻",
+  "胆",
+  "誕",
+  "鍛",
+  "団",
+  "壇",
+  "弾",
+  "断",
+  "暖",
+  "段",
+  "男",
+  "談",
+  "値",
+  "知",
+  "地",
+  "恥",
+  "池",
+  "痴",
+  "稚",
+  "置",
+  "致",
+  "遅",
+  "築",
+  "畜",
+  "竹",
+  "蓄",
+  "逐",
+  "秩",
+  "窒",
+  "茶",
+  "嫡",
+  "着",
+  "中",
+  "仲",
+  "宙",
+  "忠",
+  "抽",
+  "昼",
+  "柱",
+  "注",
+  "虫",
+  "衷",
+  "酎",
+  "鋳",
+  "駐",
+  "著",
+  "貯",
+  "丁",
+  "兆",
+  "帳",
+  "庁",
+  "弔",
+  "張",
+  "彫",
+  "徴",
+  "懲",
+  "挑",
+  "朝",
+  "潮",
+  "町",
+  "眺",
+  "聴",
+  "腸",
+  "調",
+  "超",
+  "跳",
+  "長",
+  "頂",
+  "鳥",
+  "勅",
+  "捗",
+  "直",
+  "朕",
+  "沈",
+  "珍",
+  "賃",
+  "鎮",
+  "陳",
+  "津",
+  "墜",
+  "椎",
+  "追",
+  "痛",
+  "通",
+  "塚",
+  "漬",
+  "潰",
+  "坪",
+  "爪",
+  "釣",
+  "鶴",
+  "亭",
+  "低",
+  "停",
+  "偵",
+  "貞",
+  "呈",
+  "堤",
+  "定",
+  "帝",
+  "底",
+  "庭",
+  "廷",
+  "弟",
+  "抵",
+  "提",
+  "程",
+  "締",
+  "艇",
+  "訂",
+  "諦",
+  "逓",
+  "邸",
+  "泥",
+  "摘",
+  "敵",
+  "滴",
+  "的",
+  "笛",
+  "適",
+  "溺",
+  "哲",
+  "徹",
+  "撤",
+  "迭",
+  "鉄",
+  "典",
+  "填",
+  "天",
+  "展",
+  "店",
+  "添",
+  "貼",
+  "転",
+  "点",
+  "伝",
+  "殿",
+  "田",
+  "電",
+  "吐",
+  "塗",
+  "妬",
+  "徒",
+  "斗",
+  "渡",
+  "登",
+  "賭",
+  "途",
+  "都",
+  "努",
+  "度",
+  "土",
+  "奴",
+  "怒",
+  "倒",
+  "党",
+  "冬",
+  "凍",
+  "刀",
+  "唐",
+  "塔",
+  "島",
+  "悼",
+  "投",
+  "搭",
+  "東",
+  "桃",
+  "棟",
+  "盗",
+  "湯",
+  "灯",
+  "当",
+  "痘",
+  "等",
+  "答",
+  "筒",
+  "糖",
+  "統",
+  "到",
+  "藤",
+  "討",
+  "謄",
+  "豆",
+  "踏",
+  "逃",
+  "透",
+  "陶",
+  "頭",
+  "騰",
+  "闘",
+  "働",
+  "動",
+  "同",
+  "堂",
+  "導",
+  "憧",
+  "洞",
+  "瞳",
+  "童",
+  "胴",
+  "道",
+  "銅",
+  "峠",
+  "匿",
+  "得",
+  "徳",
+  "特",
+  "督",
+  "篤",
+  "毒",
+  "独",
+  "読",
+  "栃",
+  "凸",
+  "突",
+  "届",
+  "屯",
+  "豚",
+  "頓",
+  "曇",
+  "鈍",
+  "奈",
+  "那",
+  "内",
+  "謎",
+  "鍋",
+  "縄",
+  "南",
+  "軟",
+  "難",
+  "二",
+  "尼",
+  "弐",
+  "匂",
+  "肉",
+  "虹",
+  "日",
+  "乳",
+  "入",
+  "如",
+  "尿",
+  "任",
+  "妊",
+  "忍",
+  "認",
+  "寧",
+  "猫",
+  "熱",
+  "年",
+  "念",
+  "捻",
+  "燃",
+  "粘",
+  "悩",
+  "濃",
+  "納",
+  "能",
+  "脳",
+  "農",
+  "把",
+  "覇",
+  "波",
+  "派",
+  "破",
+  "婆",
+  "罵",
+  "馬",
+  "俳",
+  "廃",
+  "拝",
+  "排",
+  "敗",
+  "杯",
+  "背",
+  "肺",
+  "輩",
+  "配",
+  "倍",
+  "培",
+  "媒",
+  "梅",
+  "買",
+  "売",
+  "賠",
+  "陪",
+  "伯",
+  "剥",
+  "博",
+  "拍",
+  "泊",
+  "白",
+  "舶",
+  "薄",
+  "迫",
+  "漠",
+  "爆",
+  "縛",
+  "麦",
+  "箱",
+  "箸",
+  "肌",
+  "畑",
+  "八",
+  "鉢",
+  "発",
+  "髪",
+  "伐",
+  "罰",
+  "抜",
+  "閥",
+  "伴",
+  "判",
+  "半",
+  "反",
+  "帆",
+  "搬",
+  "斑",
+  "板",
+  "氾",
+  "汎",
+  "版",
+  "犯",
+  "班",
+  "畔",
+  "繁",
+  "般",
+  "藩",
+  "販",
+  "範",
+  "煩",
+  "頒",
+  "飯",
+  "晩",
+  "番",
+  "盤",
+  "蛮",
+  "卑",
+  "否",
+  "妃",
+  "彼",
+  "悲",
+  "扉",
+  "批",
+  "披",
+  "比",
+  "泌",
+  "疲",
+  "皮",
+  "碑",
+  "秘",
+  "罷",
+  "肥",
+  "被",
+  "費",
+  "避",
+  "非",
+  "飛",
+  "備",
+  "尾",
+  "微",
+  "眉",
+  "美",
+  "鼻",
+  "匹",
+  "膝",
+  "肘",
+  "必",
+  "筆",
+  "姫",
+  "媛",
+  "百",
+  "俵",
+  "標",
+  "氷",
+  "漂",
+  "票",
+  "表",
+  "評",
+  "描",
+  "病",
+  "秒",
+  "苗",
+  "品",
+  "浜",
+  "貧",
+  "賓",
+  "頻",
+  "敏",
+  "瓶",
+  "不",
+  "付",
+  "夫",
+  "婦",
+  "富",
+  "布",
+  "府",
+  "怖",
+  "扶",
+  "敷",
+  "普",
+  "浮",
+  "父",
+  "符",
+  "腐",
+  "膚",
+  "譜",
+  "負",
+  "賦",
+  "赴",
+  "阜",
+  "附",
+  "侮",
+  "武",
+  "舞",
+  "部",
+  "封",
+  "風",
+  "伏",
+  "副",
+  "復",
+  "幅",
+  "服",
+  "福",
+  "腹",
+  "複",
+  "覆",
+  "払",
+  "沸",
+  "仏",
+  "物",
+  "分",
+  "噴",
+  "墳",
+  "憤",
+  "奮",
+  "粉",
+  "紛",
+  "雰",
+  "文",
+  "聞",
+  "丙",
+  "併",
+  "兵",
+  "塀",
+  "幣",
+  "平",
+  "弊",
+  "柄",
+  "並",
+  "蔽",
+  "閉",
+  "陛",
+  "米",
+  "壁",
+  "癖",
+  "別",
+  "蔑",
+  "偏",
+  "変",
+  "片",
+  "編",
+  "辺",
+  "返",
+  "遍",
+  "便",
+  "勉",
+  "弁",
+  "保",
+  "舗",
+  "捕",
+  "歩",
+  "補",
+  "穂",
+  "募",
+  "墓",
+  "慕",
+  "暮",
+  "母",
+  "簿",
+  "倣",
+  "俸",
+  "包",
+  "報",
+  "奉",
+  "宝",
+  "峰",
+  "崩",
+  "抱",
+  "放",
+  "方",
+  "法",
+  "泡",
+  "砲",
+  "縫",
+  "胞",
+  "芳",
+  "蜂",
+  "褒",
+  "訪",
+  "豊",
+  "邦",
+  "飽",
+  "乏",
+  "亡",
+  "傍",
+  "剖",
+  "坊",
+  "妨",
+  "帽",
+  "忘",
+  "忙",
+  "房",
+  "暴",
+  "望",
+  "某",
+  "棒",
+  "冒",
+  "紡",
+  "肪",
+  "膨",
+  "謀",
+  "貌",
+  "貿",
+  "防",
+  "頬",
+  "北",
+  "僕",
+  "墨",
+  "撲",
+  "朴",
+  "牧",
+  "睦",
+  "勃",
+  "没",
+  "堀",
+  "奔",
+  "本",
+  "翻",
+  "凡",
+  "盆",
+  "摩",
+  "磨",
+  "魔",
+  "麻",
+  "埋",
+  "妹",
+  "昧",
+  "枚",
+  "毎",
+  "幕",
+  "膜",
+  "枕",
+  "又",
+  "抹",
+  "末",
+  "繭",
+  "万",
+  "慢",
+  "満",
+  "漫",
+  "味",
+  "未",
+  "魅",
+  "岬",
+  "密",
+  "蜜",
+  "脈",
+  "妙",
+  "民",
+  "眠",
+  "務",
+  "夢",
+  "無",
+  "矛",
+  "霧",
+  "婿",
+  "娘",
+  "冥",
+  "名",
+  "命",
+  "明",
+  "盟",
+  "迷",
+  "銘",
+  "鳴",
+  "滅",
+  "免",
+  "綿",
+  "面",
+  "麺",
+  "模",
+  "茂",
+  "妄",
+  "毛",
+  "猛",
+  "盲",
+  "網",
+  "耗",
+  "木",
+  "黙",
+  "目",
+  "餅",
+  "戻",
+  "問",
+  "紋",
+  "門",
+  "冶",
+  "夜",
+  "野",
+  "弥",
+  "矢",
+  "厄",
+  "役",
+  "約",
+  "薬",
+  "訳",
+  "躍",
+  "柳",
+  "愉",
+  "油",
+  "癒",
+  "諭",
+  "輸",
+  "唯",
+  "優",
+  "勇",
+  "友",
+  "幽",
+  "悠",
+  "憂",
+  "有",
+  "湧",
+  "猶",
+  "由",
+  "裕",
+  "誘",
+  "遊",
+  "郵",
+  "雄",
+  "融",
+  "夕",
+  "予",
+  "余",
+  "与",
+  "誉",
+  "預",
+  "幼",
+  "妖",
+  "容",
+  "庸",
+  "揚",
+  "揺",
+  "擁",
+  "曜",
+  "様",
+  "洋",
+  "溶",
+  "用",
+  "窯",
+  "羊",
+  "葉",
+  "要",
+  "謡",
+  "踊",
+  "陽",
+  "養",
+  "抑",
+  "欲",
+  "沃",
+  "浴",
+  "翌",
+  "翼",
+  "羅",
+  "裸",
+  "来",
+  "頼",
+  "雷",
+  "絡",
+  "落",
+  "酪",
+  "乱",
+  "卵",
+  "嵐",
+  "欄",
+  "濫",
+  "藍",
+  "覧",
+  "利",
+  "吏",
+  "履",
+  "梨",
+  "理",
+  "璃",
+  "痢",
+  "裏",
+  "里",
+  "離",
+  "陸",
+  "律",
+  "率",
+  "立",
+  "略",
+  "流",
+  "留",
+  "硫",
+  "粒",
+  "隆",
+  "竜",
+  "侶",
+  "慮",
+  "旅",
+  "虜",
+  "了",
+  "僚",
+  "両",
+  "寮",
+  "料",
+  "涼",
+  "猟",
+  "療",
+  "瞭",
+  "糧",
+  "良",
+  "量",
+  "陵",
+  "領",
+  "力",
+  "緑",
+  "倫",
+  "厘",
+  "林",
+  "臨",
+  "輪",
+  "隣",
+  "瑠",
+  "塁",
+  "涙",
+  "累",
+  "類",
+  "令",
+  "例",
+  "冷",
+  "励",
+  "礼",
+  "鈴",
+  "隷",
+  "零",
+  "霊",
+  "麗",
+  "齢",
+  "暦",
+  "歴",
+  "列",
+  "劣",
+  "烈",
+  "裂",
+  "廉",
+  "恋",
+  "練",
+  "連",
+  "錬",
+  "呂",
+  "炉",
+  "賂",
+  "路",
+  "露",
+  "労",
+  "廊",
+  "弄",
+  "朗",
+  "楼",
+  "浪",
+  "漏",
+  "老",
+  "郎",
+  "六",
+  "麓",
+  "録",
+  "論",
+  "和",
+  "話",
+  "賄",
+  "脇",
+  "惑",
+  "枠",
+  "湾",
+  "腕",
+  "丼",
+  "傲",
+  "刹",
+  "哺",
+  "喩",
+  "嗅",
+  "嘲",
+  "毀",
+  "彙",
+  "恣",
+  "惧",
+  "慄",
+  "憬",
+  "拉",
+  "摯",
+  "曖",
+  "楷",
+  "鬱",
+  "璧",
+  "瘍",
+  "箋",
+  "籠",
+  "緻",
+  "羞",
+  "訃",
+  "諧",
+  "貪",
+  "踪",
+  "辣",
+  "錮",
+};
+const char *ALPHA_118_DIGITS[] = {
+};
+const uint32_t ALPHA_118_UPPER_CPS[] = {
+  12293, 12353, 12354, 12355, 12356, 12357, 12358, 12359, 12360, 12361, 12362, 12363, 12364, 12365, 12366, 12367,
+  12368, 12369, 12370, 12371, 12372, 12373, 12374, 12375, 12376, 12377, 12378, 12379, 12380, 12381, 12382, 12383,
+  12384, 12385, 12386, 12387, 12388, 12389, 12390, 12391, 12392, 12393, 12394, 12395, 12396, 12397, 12398, 12399,
+  12400, 12401, 12402, 12403, 12404, 12405, 12406, 12407, 12408, 12409, 12410, 12411, 12412, 12413, 12414, 12415,
+  12416, 12417, 12418, 12419, 12420, 12421, 12422, 12423, 12424, 12425, 12426, 12427, 12428, 12429, 12430, 12431,
+  12432, 12433, 12434, 12435, 12445, 12446, 12449, 12450, 12451, 12452, 12453, 12454, 12455, 12456, 12457, 12458,
+  12459, 12460, 12461, 12462, 12463, 12464, 12465, 12466, 12467, 12468, 12469, 12470, 12471, 12472, 12473, 12474,
+  12475, 12476, 12477, 12478, 12479, 12480, 12481, 12482, 12483, 12484, 12485, 12486, 12487, 12488, 12489, 12490,
+  12491, 12492, 12493, 12494, 12495, 12496, 12497, 12498, 12499, 12500, 12501, 12502, 12503, 12504, 12505, 12506,
+  12507, 12508, 12509, 12510, 12511, 12512, 12513, 12514, 12515, 12516, 12517, 12518, 12519, 12520, 12521, 12522,
+  12523, 12524, 12525, 12526, 12527, 12528, 12529, 12530, 12531, 12532, 12533, 12534, 12540, 12541, 12542, 19968,
+  19969, 19971, 19975, 19976, 19977, 19978, 19979, 19981, 19982, 19988, 19990, 19992, 19993, 20001, 20006, 20013,
+  20018, 20024, 20025, 20027, 20028, 20037, 20047, 20055, 20057, 20061, 20062, 20081, 20083, 20094, 20096, 20102,
+  20104, 20105, 20107, 20108, 20114, 20116, 20117, 20124, 20129, 20132, 20139, 20140, 20141, 20154, 20161, 20170,
+  20171, 20175, 20181, 20182, 20184, 20185, 20195, 20196, 20197, 20206, 20208, 20210, 20214, 20219, 20225, 20238,
+  20239, 20240, 20241, 20250, 20253, 20271, 20276, 20280, 20282, 20284, 20294, 20301, 20302, 20303, 20304, 20307,
+  20309, 20313, 20316, 20339, 20341, 20351, 20363, 20365, 20379, 20381, 20385, 20398, 20399, 20405, 20406, 20415,
+  20418, 20419, 20426, 20439, 20445, 20449, 20462, 20467, 20469, 20472, 20474, 20489, 20491, 20493, 20498, 20505,
+  20511, 20515, 20516, 20523, 20537, 20553, 20559, 20572, 20581, 20596, 20597, 20598, 20605, 20621, 20625, 20632,
+  20633, 20652, 20658, 20661, 20663, 20670, 20677, 20685, 20687, 20693, 20698, 20711, 20736, 20740, 20754, 20767,
+  20778, 20803, 20804, 20805, 20806, 20808, 20809, 20811, 20813, 20816, 20826, 20837, 20840, 20843, 20844, 20845,
+  20849, 20853, 20855, 20856, 20860, 20869, 20870, 20874, 20877, 20882, 20887, 20889, 20896, 20901, 20908, 20918,
+  20919, 20932, 20934, 20941, 20957, 20961, 20966, 20982, 20984, 20985, 20986, 20992, 20995, 20998, 20999, 21000,
+  21002, 21009, 21015, 21021, 21028, 21029, 21033, 21040, 21046, 21047, 21048, 21049, 21050, 21051, 21063, 21066,
+  21069, 21078, 21083, 21091, 21092, 21093, 21103, 21104, 21106, 21109, 21127, 21147, 21151, 21152, 21155, 21161,
+  21162, 21169, 21172, 21177, 21182, 21187, 21189, 21191, 21193, 21205, 21208, 21209, 21213, 21215, 21218, 21220,
+  21223, 21234, 21246, 21250, 21253, 21270, 21271, 21280, 21305, 21306, 21307, 21311, 21313, 21315, 21319, 21320,
+  21322, 21329, 21330, 21331, 21332, 21335, 21336, 21338, 21344, 21360, 21361, 21363, 21364, 21365, 21368, 21380,
+  21400, 21402, 21407, 21427, 21435, 21442, 21448, 21450, 21451, 21452, 21453, 21454, 21460, 21462, 21463, 21465,
+  21475, 21476, 21477, 21483, 21484, 21487, 21488, 21489, 21490, 21491, 21495, 21496, 21508, 21512, 21513, 21516,
+  21517, 21518, 21519, 21520, 21521, 21531, 21535, 21542, 21547, 21560, 21561, 21570, 21576, 21577, 21578, 21608,
+  21610, 21619, 21628, 21629, 21644, 21682, 21693, 21696, 21697, 21729, 21746, 21754, 21764, 21766, 21767, 21776,
+  21807, 21809, 21822, 21830, 21839, 21843, 21892, 21897, 21914, 21916, 21917, 21929, 21930, 21931, 21942, 21957,
+  21987, 22022, 22065, 22066, 22120, 22132, 22151, 22234, 22235, 22238, 22240, 22243, 22256, 22258, 22259, 22266,
+  22269, 22287, 22290, 22303, 22311, 22312, 22320, 22338, 22343, 22346, 22353, 22378, 22402, 22411, 22435, 22475,
+  22478, 22495, 22519, 22521, 22522, 22524, 22528, 22530, 22533, 22534, 22549, 22564, 22570, 22577, 22580, 22592,
+  22593, 22602, 22609, 22612, 22615, 22618, 22622, 22633, 22635, 22654, 22659, 22675, 22679, 22684, 22696, 22707,
+  22718, 22721, 22727, 22730, 22732, 22763, 22766, 22768, 22769, 22770, 22793, 22799, 22805, 22806, 22810, 22812,
+  22818, 22823, 22825, 22826, 22827, 22830, 22833, 22855, 22856, 22857, 22863, 22865, 22868, 22885, 22888, 22890,
+  22894, 22899, 22900, 22909, 22914, 22915, 22916, 22922, 22934, 22937, 22949, 22952, 22956, 22969, 22971, 22985,
+  22987, 22995, 22996, 23019, 23035, 23039, 23041, 23064, 23072, 23087, 23110, 23130, 23142, 23167, 23186, 23195,
+  23233, 23241, 23244, 23265, 23330, 23376, 23380, 23383, 23384, 23389, 23395, 23396, 23398, 23403, 23429, 23431,
+  23432, 23433, 23436, 23447, 23448, 23449, 23450, 23451, 23452, 23453, 23455, 23458, 23459, 23460, 23470, 23472,
+  23475, 23476, 23477, 23478, 23481, 23487, 23490, 23492, 23494, 23500, 23506, 23515, 23517, 23519, 23521, 23527,
+  23529, 23534, 23544, 23546, 23550, 23551, 23553, 23554, 23556, 23558, 23561, 23562, 23563, 23566, 23567, 23569,
+  23578, 23601, 23610, 23611, 23612, 23613, 23614, 23615, 23616, 23621, 23624, 23626, 23627, 23637, 23646, 23652,
+  23653, 23663, 23665, 23696, 23713, 23721, 23724, 23731, 23736, 23776, 23777, 23792, 23798, 23815, 23822, 23830,
+  23849, 23888, 24029, 24030, 24033, 24035, 24037, 24038, 24039, 24040, 24046, 24049, 24059, 24062, 24066, 24067,
+  24070, 24076, 24093, 24101, 24107, 24109, 24111, 24112, 24115, 24120, 24125, 24133, 24149, 24163, 24178, 24179,
+  24180, 24184, 24185, 24187, 24188, 24189, 24190, 24193, 24195, 24202, 24207, 24213, 24215, 24220, 24230, 24231,
+  24235, 24237, 24246, 24247, 24248, 24259, 24265, 24266, 24310, 24311, 24314, 24321, 24324, 24330, 24335, 24336,
+  24339, 24340, 24341, 24351, 24357, 24358, 24359, 24369, 24373, 24375, 24382, 24403, 24409, 24418, 24425, 24427,
+  24432, 24433, 24441, 24444, 24448, 24449, 24452, 24453, 24459, 24460, 24464, 24466, 24467, 24471, 24481, 24489,
+  24490, 24494, 24499, 24500, 24505, 24515, 24517, 24524, 24525, 24535, 24536, 24537, 24540, 24544, 24555, 24565,
+  24594, 24598, 24605, 24608, 24613, 24615, 24616, 24618, 24651, 24656, 24658, 24675, 24677, 24680, 24681, 24685,
+  24687, 24693, 24724, 24735, 24736, 24739, 24742, 24745, 24746, 24754, 24764, 24773, 24785, 24796, 24807, 24808,
+  24816, 24819, 24833, 24841, 24847, 24858, 24859, 24863, 24900, 24904, 24907, 24908, 24910, 24917, 24930, 24931,
+  24936, 24942, 24944, 24950, 24962, 24974, 24996, 24999, 25001, 25004, 25010, 25014, 25022, 25031, 25040, 25074,
+  25080, 25104, 25105, 25106, 25114, 25126, 25135, 25140, 25144, 25147, 25151, 25152, 25159, 25161, 25163, 25165,
+  25171, 25173, 25201, 25206, 25209, 25215, 25216, 25220, 25226, 25233, 25237, 25239, 25240, 25244, 25246, 25259,
+  25265, 25269, 25273, 25276, 25277, 25285, 25289, 25293, 25296, 25298, 25299, 25304, 25305, 25307, 25309, 25312,
+  25313, 25324, 25325, 25331, 25334, 25335, 25342, 25345, 25351, 25361, 25369, 25375, 25384, 25387, 25391, 25407,
+  25417, 25429, 25431, 25436, 25448, 25454, 25467, 25475, 25480, 25484, 25490, 25496, 25499, 25505, 25506, 25509,
+  25511, 25512, 25514, 25522, 25551, 25552, 25562, 25563, 25569, 25582, 25588, 25594, 25613, 25644, 25645, 25658,
+  25662, 25666, 25688, 25705, 25711, 25731, 25764, 25774, 25778, 25793, 25805, 25830, 25836, 25903, 25913, 25915,
+  25918, 25919, 25925, 25935, 25937, 25943, 25945, 25954, 25955, 25964, 25968, 25972, 25973, 25975, 25991, 25993,
+  25998, 26001, 26007, 26009, 26012, 26020, 26021, 26028, 26029, 26032, 26041, 26045, 26053, 26059, 26063, 26071,
+  26082, 26085, 26086, 26087, 26088, 26089, 26092, 26106, 26118, 26119, 26126, 26131, 26132, 26143, 26144, 26149,
+  26151, 26152, 26157, 26159, 26172, 26178, 26217, 26222, 26223, 26228, 26230, 26241, 26247, 26257, 26262, 26263,
+  26278, 26283, 26286, 26292, 26311, 26326, 26332, 26354, 26356, 26360, 26361, 26365, 26367, 26368, 26376, 26377,
+  26381, 26389, 26391, 26395, 26397, 26399, 26408, 26410, 26411, 26412, 26413, 26417, 26420, 26426, 26429, 26441,
+  26448, 26449, 26463, 26465, 26469, 26479, 26481, 26494, 26495, 26512, 26517, 26519, 26522, 26524, 26525, 26528,
+  26530, 26543, 26550, 26564, 26576, 26579, 26580, 26609, 26611, 26613, 26619, 26623, 26627, 26628, 26643, 26657,
+  26666, 26680, 26681, 26684, 26685, 26689, 26691, 26696, 26705, 26716, 26719, 26757, 26775, 26792, 26800, 26820,
+  26827, 26834, 26842, 26847, 26862, 26874, 26885, 26893, 26894, 26908, 26989, 26997, 26999, 27004, 27005, 27010,
+  27083, 27096, 27133, 27161, 27169, 27177, 27178, 27193, 27211, 27231, 27396, 27424, 27425, 27431, 27442, 27450,
+  27454, 27468, 27475, 27490, 27491, 27494, 27497, 27503, 27507, 27508, 27515, 27529, 27530, 27531, 27542, 27572,
+  27573, 27578, 27579, 27583, 27584, 27597, 27598, 27602, 27604, 27611, 27663, 27665, 27671, 27700, 27703, 27704,
+  27710, 27713, 27714, 27726, 27735, 27738, 27743, 27744, 27760, 27770, 27773, 27779, 27784, 27798, 27801, 27809,
+  27810, 27827, 27832, 27833, 27835, 27836, 27839, 27841, 27849, 27850, 27852, 27861, 27873, 27874, 27875, 27877,
+  27880, 27888, 27891, 27915, 27927, 27934, 27941, 27946, 27963, 27966, 27969, 27972, 27973, 27996, 28006, 28010,
+  28014, 28020, 28023, 28024, 28040, 28057, 28079, 28082, 28092, 28113, 28129, 28139, 28145, 28151, 28155, 28165,
+  28167, 28168, 28169, 28171, 28179, 28187, 28193, 28198, 28201, 28204, 28207, 28246, 28263, 28271, 28286, 28287,
+  28288, 28304, 28310, 28317, 28342, 28346, 28357, 28363, 28369, 28381, 28382, 28404, 28417, 28418, 28422, 28431,
+  28436, 28448, 28450, 28459, 28460, 28472, 28500, 28508, 28511, 28516, 28526, 28528, 28548, 28608, 28609, 28611,
+  28651, 28655, 28716, 28779, 28783, 28784, 28797, 28809, 28810, 28814, 28845, 28857, 28858, 28872, 28961, 28966,
+  28982, 28988, 29006, 29017, 29031, 29033, 29038, 29066, 29087, 29105, 29123, 29157, 29190, 29226, 29237, 29238,
+  29245, 29255, 29256, 29273, 29275, 29287, 29289, 29298, 29305, 29344, 29356, 29359, 29366, 29378, 29401, 29417,
+  29420, 29421, 29467, 29471, 29483, 29486, 29494, 29503, 29508, 29539, 29554, 29572, 29575, 29577, 29579, 29609,
+  29645, 29664, 29677, 29694, 29699, 29702, 29748, 29792, 29827, 29863, 29872, 29885, 29926, 29942, 29976, 29978,
+  29983, 29987, 29992, 30000, 30001, 30002, 30003, 30007, 30010, 30011, 30028, 30031, 30033, 30036, 30041, 30044,
+  30045, 30053, 30058, 30064, 30067, 30079, 30094, 30097, 30123, 30130, 30142, 30149, 30151, 30165, 30168, 30171,
+  30178, 30185, 30196, 30221, 30274, 30290, 30294, 30330, 30331, 30333, 30334, 30340, 30342, 30343, 30382, 30399,
+  30406, 30410, 30423, 30427, 30431, 30435, 30436, 30446, 30450, 30452, 30456, 30462, 30465, 30473, 30475, 30476,
+  30495, 30496, 30522, 30524, 30528, 30561, 30563, 30566, 30636, 30637, 30643, 30683, 30690, 30693, 30701, 30703,
+  30707, 30722, 30740, 30741, 30770, 30772, 30813, 30827, 30828, 30849, 30865, 30906, 30913, 30952, 30977, 30990,
+  31034, 31036, 31038, 31048, 31049, 31062, 31069, 31070, 31077, 31080, 31085, 31105, 31109, 31117, 31119, 31168,
+  31169, 31179, 31185, 31186, 31192, 31199, 31209, 31216, 31227, 31243, 31246, 31258, 31278, 31282, 31292, 31293,
+  31295, 31296, 31298, 31309, 31311, 31339, 31348, 31350, 31354, 31361, 31363, 31378, 31379, 31391, 31406, 31407,
+  31435, 31452, 31456, 31461, 31471, 31478, 31481, 31505, 31515, 31526, 31532, 31558, 31561, 31563, 31570, 31572,
+  31574, 31623, 31627, 31639, 31649, 31665, 31672, 31680, 31684, 31689, 31716, 31777, 31807, 31821, 31840, 31859,
+  31881, 31883, 31890, 31895, 31896, 31899, 31911, 31934, 31958, 31975, 31992, 31995, 31998, 32000, 32004, 32005,
+  32011, 32013, 32020, 32025, 32026, 32027, 32032, 32033, 32034, 32043, 32047, 32048, 32051, 32057, 32058, 32066,
+  32068, 32076, 32080, 32094, 32097, 32102, 32113, 32117, 32118, 32121, 32153, 32154, 32173, 32177, 32178, 32187,
+  32191, 32202, 32207, 32209, 32210, 32218, 32224, 32232, 32233, 32239, 32244, 32251, 32257, 32260, 32283, 32294,
+  32299, 32302, 32318, 32321, 32330, 32340, 32341, 32365, 32368, 32566, 32618, 32622, 32624, 32626, 32629, 32631,
+  32645, 32650, 32654, 32670, 32676, 32680, 32681, 32701, 32705, 32716, 32722, 32763, 32764, 32769, 32771, 32773,
+  32784, 32789, 32791, 32819, 32854, 32862, 32884, 32887, 32905, 32908, 32918, 32920, 32925, 32929, 32930, 32933,
+  32937, 32938, 32943, 32946, 32954, 32963, 32966, 32972, 32974, 32990, 33012, 33016, 33021, 33026, 33029, 33031,
+  33032, 33034, 33050, 33073, 33075, 33102, 33104, 33109, 33131, 33136, 33144, 33145, 33146, 33178, 33180, 33181,
+  33192, 33203, 33222, 33235, 33251, 33256, 33258, 33261, 33267, 33268, 33276, 33288, 33292, 33294, 33303, 33310,
+  33311, 33322, 33324, 33334, 33335, 33337, 33351, 33382, 33391, 33394, 33398, 33419, 33437, 33455, 33457, 33459,
+  33464, 33469, 33495, 33499, 33509, 33510, 33521, 33538, 33550, 33576, 33590, 33609, 33618, 33624, 33655, 33738,
+  33740, 33747, 33756, 33775, 33806, 33853, 33865, 33879, 33883, 33900, 33976, 33988, 33995, 34065, 34101, 34109,
+  34180, 34214, 34218, 34219, 34220, 34253, 34276, 34281, 34299, 34382, 34384, 34394, 34396, 34398, 34411, 34425,
+  34442, 34453, 34503, 34509, 34542, 34562, 34588, 34701, 34880, 34886, 34892, 34899, 34903, 34907, 34909, 34913,
+  34915, 34920, 34928, 34935, 34955, 34966, 34987, 35009, 35010, 35013, 35023, 35029, 35036, 35064, 35069, 35070,
+  35079, 35088, 35090, 35167, 35186, 35199, 35201, 35206, 35207, 35211, 35215, 35222, 35226, 35239, 35242, 35251,
+  35282, 35299, 35302, 35328, 35330, 35331, 35336, 35342, 35347, 35351, 35352, 35359, 35370, 35373, 35377, 35379,
+  35380, 35386, 35388, 35408, 35412, 35413, 35422, 35424, 35427, 35430, 35433, 35438, 35440, 35441, 35442, 35443,
+  35463, 35465, 35468, 35469, 35475, 35477, 35480, 35486, 35488, 35492, 35500, 35501, 35504, 35506, 35519, 35527,
+  35531, 35542, 35558, 35559, 35565, 35566, 35576, 35582, 35584, 35585, 35588, 35598, 35609, 35611, 35613, 35617,
+  35641, 35672, 35676, 35686, 35696, 35698, 35703, 35895, 35910, 35914, 35930, 35937, 35946, 35980, 35997, 35998,
+  36000, 36001, 36002, 36007, 36008, 36009, 36010, 36011, 36012, 36015, 36020, 36023, 36024, 36027, 36028, 36031,
+  36032, 36034, 36035, 36036, 36039, 36042, 36051, 36059, 36060, 36062, 36064, 36066, 36070, 36074, 36077, 36092,
+  36104, 36196, 36198, 36208, 36212, 36215, 36229, 36234, 36259, 36275, 36317, 36321, 36335, 36339, 36341, 36362,
+  36367, 36394, 36468, 36493, 36523, 36554, 36556, 36557, 36562, 36575, 36578, 36600, 36605, 36611, 36617, 36637,
+  36649, 36650, 36664, 36676, 36763, 36766, 36771, 36785, 36786, 36794, 36796, 36805, 36814, 36817, 36820, 36843,
+  36845, 36848, 36855, 36861, 36864, 36865, 36867, 36870, 36879, 36880, 36883, 36884, 36890, 36893, 36895, 36896,
+  36899, 36910, 36913, 36914, 36920, 36930, 36933, 36935, 36938, 36939, 36941, 36942, 36947, 36948, 36949, 36956,
+  36960, 36961, 36963, 36969, 36973, 36974, 36981, 36983, 36984, 36986, 36991, 36996, 37027, 37030, 37034, 37048,
+  37066, 37070, 37089, 37096, 37101, 37109, 37111, 37117, 37196, 37197, 37198, 37202, 37204, 37218, 37226, 37228,
+  37237, 37239, 37240, 37266, 37276, 37304, 37319, 37320, 37324, 37325, 37326, 37327, 37329, 37340, 37341, 37347,
+  37389, 37428, 37444, 37467, 37474, 37489, 37504, 37507, 37509, 37528, 37549, 37613, 37619, 37628, 37664, 37670,
+  37676, 37678, 37679, 37682, 37707, 37723, 37749, 37772, 37782, 37806, 37857, 37912, 37969, 38263, 38272, 38281,
+  38283, 38289, 38291, 38306, 38307, 38309, 38322, 38343, 38360, 38428, 38442, 38450, 38459, 38468, 38477, 38480,
+  38491, 38498, 38499, 38500, 38501, 38506, 38512, 38515, 38517, 38518, 38520, 38522, 38525, 38533, 38534, 38538,
+  38542, 38543, 38548, 38553, 38555, 38556, 38560, 38563, 38583, 38587, 38596, 38597, 38598, 38599, 38604, 38609,
+  38626, 38627, 38632, 38634, 38640, 38642, 38646, 38647, 38651, 38656, 38663, 38666, 38684, 38695, 38706, 38738,
+  38745, 38750, 38754, 38761, 38772, 38867, 38899, 38907, 38911, 38914, 38915, 38917, 38918, 38920, 38928, 38929,
+  38930, 38931, 38936, 38956, 38957, 38971, 38972, 38988, 38989, 38990, 38996, 38997, 39000, 39006, 39015, 39080,
+  39131, 39135, 39138, 39151, 39154, 39164, 39165, 39166, 39173, 39178, 39180, 39187, 39208, 39318, 39321, 39340,
+  39364, 39365, 39366, 39376, 39378, 39438, 39442, 39443, 39472, 39514, 39592, 39608, 39620, 39640, 39658, 39729,
+  39740, 39746, 39749, 39764, 39770, 39854, 39912, 40165, 40180, 40335, 40372, 40575, 40595, 40599, 40614, 40634,
+  40635, 40644, 40658, 40665, 40723, 40763, 40802,
+};
+const uint32_t ALPHA_118_LOWER_CPS[] = {
+  12293, 12353, 12354, 12355, 12356, 12357, 12358, 12359, 12360, 12361, 12362, 12363, 12364, 12365, 12366, 12367,
+  12368, 12369, 12370, 12371, 12372, 12373, 12374, 12375, 12376, 12377, 12378, 12379, 12380, 12381, 12382, 12383,
+  12384, 12385, 12386, 12387, 12388, 12389, 12390, 12391, 12392, 12393, 12394, 12395, 12396, 12397, 12398, 12399,
+  12400, 12401, 12402, 12403, 12404, 12405, 12406, 12407, 12408, 12409, 12410, 12411, 12412, 12413, 12414, 12415,
+  12416, 12417, 12418, 12419, 12420, 12421, 12422, 12423, 12424, 12425, 12426, 12427, 12428, 12429, 12430, 12431,
+  12432, 12433, 12434, 12435, 12445, 12446, 12449, 12450, 12451, 12452, 12453, 12454, 12455, 12456, 12457, 12458,
+  12459, 12460, 12461, 12462, 12463, 12464, 12465, 12466, 12467, 12468, 12469, 12470, 12471, 12472, 12473, 12474,
+  12475, 12476, 12477, 12478, 12479, 12480, 12481, 12482, 12483, 12484, 12485, 12486, 12487, 12488, 12489, 12490,
+  12491, 12492, 12493, 12494, 12495, 12496, 12497, 12498, 12499, 12500, 12501, 12502, 12503, 12504, 12505, 12506,
+  12507, 12508, 12509, 12510, 12511, 12512, 12513, 12514, 12515, 12516, 12517, 12518, 12519, 12520, 12521, 12522,
+  12523, 12524, 12525, 12526, 12527, 12528, 12529, 12530, 12531, 12532, 12533, 12534, 12540, 12541, 12542, 19968,
+  19969, 19971, 19975, 19976, 19977, 19978, 19979, 19981, 19982, 19988, 19990, 19992, 19993, 20001, 20006, 20013,
+  20018, 20024, 20025, 20027, 20028, 20037, 20047, 20055, 20057, 20061, 20062, 20081, 20083, 20094, 20096, 20102,
+  20104, 20105, 20107, 20108, 20114, 20116, 20117, 20124, 20129, 20132, 20139, 20140, 20141, 20154, 20161, 20170,
+  20171, 20175, 20181, 20182, 20184, 20185, 20195, 20196, 20197, 20206, 20208, 20210, 20214, 20219, 20225, 20238,
+  20239, 20240, 20241, 20250, 20253, 20271, 20276, 20280, 20282, 20284, 20294, 20301, 20302, 20303, 20304, 20307,
+  20309, 20313, 20316, 20339, 20341, 20351, 20363, 20365, 20379, 20381, 20385, 20398, 20399, 20405, 20406, 20415,
+  20418, 20419, 20426, 20439, 20445, 20449, 20462, 20467, 20469, 20472, 20474, 20489, 20491, 20493, 20498, 20505,
+  20511, 20515, 20516, 20523, 20537, 20553, 20559, 20572, 20581, 20596, 20597, 20598, 20605, 20621, 20625, 20632,
+  20633, 20652, 20658, 20661, 20663, 20670, 20677, 20685, 20687, 20693, 20698, 20711, 20736, 20740, 20754, 20767,
+  20778, 20803, 20804, 20805, 20806, 20808, 20809, 20811, 20813, 20816, 20826, 20837, 20840, 20843, 20844, 20845,
+  20849, 20853, 20855, 20856, 20860, 20869, 20870, 20874, 20877, 20882, 20887, 20889, 20896, 20901, 20908, 20918,
+  20919, 20932, 20934, 20941, 20957, 20961, 20966, 20982, 20984, 20985, 20986, 20992, 20995, 20998, 20999, 21000,
+  21002, 21009, 21015, 21021, 21028, 21029, 21033, 21040, 21046, 21047, 21048, 21049, 21050, 21051, 21063, 21066,
+  21069, 21078, 21083, 21091, 21092, 21093, 21103, 21104, 21106, 21109, 21127, 21147, 21151, 21152, 21155, 21161,
+  21162, 21169, 21172, 21177, 21182, 21187, 21189, 21191, 21193, 21205, 21208, 21209, 21213, 21215, 21218, 21220,
+  21223, 21234, 21246, 21250, 21253, 21270, 21271, 21280, 21305, 21306, 21307, 21311, 21313, 21315, 21319, 21320,
+  21322, 21329, 21330, 21331, 21332, 21335, 21336, 21338, 21344, 21360, 21361, 21363, 21364, 21365, 21368, 21380,
+  21400, 21402, 21407, 21427, 21435, 21442, 21448, 21450, 21451, 21452, 21453, 21454, 21460, 21462, 21463, 21465,
+  21475, 21476, 21477, 21483, 21484, 21487, 21488, 21489, 21490, 21491, 21495, 21496, 21508, 21512, 21513, 21516,
+  21517, 21518, 21519, 21520, 21521, 21531, 21535, 21542, 21547, 21560, 21561, 21570, 21576, 21577, 21578, 21608,
+  21610, 21619, 21628, 21629, 21644, 21682, 21693, 21696, 21697, 21729, 21746, 21754, 21764, 21766, 21767, 21776,
+  21807, 21809, 21822, 21830, 21839, 21843, 21892, 21897, 21914, 21916, 21917, 21929, 21930, 21931, 21942, 21957,
+  21987, 22022, 22065, 22066, 22120, 22132, 22151, 22234, 22235, 22238, 22240, 22243, 22256, 22258, 22259, 22266,
+  22269, 22287, 22290, 22303, 22311, 22312, 22320, 22338, 22343, 22346, 22353, 22378, 22402, 22411, 22435, 22475,
+  22478, 22495, 22519, 22521, 22522, 22524, 22528, 22530, 22533, 22534, 22549, 22564, 22570, 22577, 22580, 22592,
+  22593, 22602, 22609, 22612, 22615, 22618, 22622, 22633, 22635, 22654, 22659, 22675, 22679, 22684, 22696, 22707,
+  22718, 22721, 22727, 22730, 22732, 22763, 22766, 22768, 22769, 22770, 22793, 22799, 22805, 22806, 22810, 22812,
+  22818, 22823, 22825, 22826, 22827, 22830, 22833, 22855, 22856, 22857, 22863, 22865, 22868, 22885, 22888, 22890,
+  22894, 22899, 22900, 22909, 22914, 22915, 22916, 22922, 22934, 22937, 22949, 22952, 22956, 22969, 22971, 22985,
+  22987, 22995, 22996, 23019, 23035, 23039, 23041, 23064, 23072, 23087, 23110, 23130, 23142, 23167, 23186, 23195,
+  23233, 23241, 23244, 23265, 23330, 23376, 23380, 23383, 23384, 23389, 23395, 23396, 23398, 23403, 23429, 23431,
+  23432, 23433, 23436, 23447, 23448, 23449, 23450, 23451, 23452, 23453, 23455, 23458, 23459, 23460, 23470, 23472,
+  23475, 23476, 23477, 23478, 23481, 23487, 23490, 23492, 23494, 23500, 23506, 23515, 23517, 23519, 23521, 23527,
+  23529, 23534, 23544, 23546, 23550, 23551, 23553, 23554, 23556, 23558, 23561, 23562, 23563, 23566, 23567, 23569,
+  23578, 23601, 23610, 23611, 23612, 23613, 23614, 23615, 23616, 23621, 23624, 23626, 23627, 23637, 23646, 23652,
+  23653, 23663, 23665, 23696, 23713, 23721, 23724, 23731, 23736, 23776, 23777, 23792, 23798, 23815, 23822, 23830,
+  23849, 23888, 24029, 24030, 24033, 24035, 24037, 24038, 24039, 24040, 24046, 24049, 24059, 24062, 24066, 24067,
+  24070, 24076, 24093, 24101, 24107, 24109, 24111, 24112, 24115, 24120, 24125, 24133, 24149, 24163, 24178, 24179,
+  24180, 24184, 24185, 24187, 24188, 24189, 24190, 24193, 24195, 24202, 24207, 24213, 24215, 24220, 24230, 24231,
+  24235, 24237, 24246, 24247, 24248, 24259, 24265, 24266, 24310, 24311, 24314, 24321, 24324, 24330, 24335, 24336,
+  24339, 24340, 24341, 24351, 24357, 24358, 24359, 24369, 24373, 24375, 24382, 24403, 24409, 24418, 24425, 24427,
+  24432, 24433, 24441, 24444, 24448, 24449, 24452, 24453, 24459, 24460, 24464, 24466, 24467, 24471, 24481, 24489,
+  24490, 24494, 24499, 24500, 24505, 24515, 24517, 24524, 24525, 24535, 24536, 24537, 24540, 24544, 24555, 24565,
+  24594, 24598, 24605, 24608, 24613, 24615, 24616, 24618, 24651, 24656, 24658, 24675, 24677, 24680, 24681, 24685,
+  24687, 24693, 24724, 24735, 24736, 24739, 24742, 24745, 24746, 24754, 24764, 24773, 24785, 24796, 24807, 24808,
+  24816, 24819, 24833, 24841, 24847, 24858, 24859, 24863, 24900, 24904, 24907, 24908, 24910, 24917, 24930, 24931,
+  24936, 24942, 24944, 24950, 24962, 24974, 24996, 24999, 25001, 25004, 25010, 25014, 25022, 25031, 25040, 25074,
+  25080, 25104, 25105, 25106, 25114, 25126, 25135, 25140, 25144, 25147, 25151, 25152, 25159, 25161, 25163, 25165,
+  25171, 25173, 25201, 25206, 25209, 25215, 25216, 25220, 25226, 25233, 25237, 25239, 25240, 25244, 25246, 25259,
+  25265, 25269, 25273, 25276, 25277, 25285, 25289, 25293, 25296, 25298, 25299, 25304, 25305, 25307, 25309, 25312,
+  25313, 25324, 25325, 25331, 25334, 25335, 25342, 25345, 25351, 25361, 25369, 25375, 25384, 25387, 25391, 25407,
+  25417, 25429, 25431, 25436, 25448, 25454, 25467, 25475, 25480, 25484, 25490, 25496, 25499, 25505, 25506, 25509,
+  25511, 25512, 25514, 25522, 25551, 25552, 25562, 25563, 25569, 25582, 25588, 25594, 25613, 25644, 25645, 25658,
+  25662, 25666, 25688, 25705, 25711, 25731, 25764, 25774, 25778, 25793, 25805, 25830, 25836, 25903, 25913, 25915,
+  25918, 25919, 25925, 25935, 25937, 25943, 25945, 25954, 25955, 25964, 25968, 25972, 25973, 25975, 25991, 25993,
+  25998, 26001, 26007, 26009, 26012, 26020, 26021, 26028, 26029, 26032, 26041, 26045, 26053, 26059, 26063, 26071,
+  26082, 26085, 26086, 26087, 26088, 26089, 26092, 26106, 26118, 26119, 26126, 26131, 26132, 26143, 26144, 26149,
+  26151, 26152, 26157, 26159, 26172, 26178, 26217, 26222, 26223, 26228, 26230, 26241, 26247, 26257, 26262, 26263,
+  26278, 26283, 26286, 26292, 26311, 26326, 26332, 26354, 26356, 26360, 26361, 26365, 26367, 26368, 26376, 26377,
+  26381, 26389, 26391, 26395, 26397, 26399, 26408, 26410, 26411, 26412, 26413, 26417, 26420, 26426, 26429, 26441,
+  26448, 26449, 26463, 26465, 26469, 26479, 26481, 26494, 26495, 26512, 26517, 26519, 26522, 26524, 26525, 26528,
+  26530, 26543, 26550, 26564, 26576, 26579, 26580, 26609, 26611, 26613, 26619, 26623, 26627, 26628, 26643, 26657,
+  26666, 26680, 26681, 26684, 26685, 26689, 26691, 26696, 26705, 26716, 26719, 26757, 26775, 26792, 26800, 26820,
+  26827, 26834, 26842, 26847, 26862, 26874, 26885, 26893, 26894, 26908, 26989, 26997, 26999, 27004, 27005, 27010,
+  27083, 27096, 27133, 27161, 27169, 27177, 27178, 27193, 27211, 27231, 27396, 27424, 27425, 27431, 27442, 27450,
+  27454, 27468, 27475, 27490, 27491, 27494, 27497, 27503, 27507, 27508, 27515, 27529, 27530, 27531, 27542, 27572,
+  27573, 27578, 27579, 27583, 27584, 27597, 27598, 27602, 27604, 27611, 27663, 27665, 27671, 27700, 27703, 27704,
+  27710, 27713, 27714, 27726, 27735, 27738, 27743, 27744, 27760, 27770, 27773, 27779, 27784, 27798, 27801, 27809,
+  27810, 27827, 27832, 27833, 27835, 27836, 27839, 27841, 27849, 27850, 27852, 27861, 27873, 27874, 27875, 27877,
+  27880, 27888, 27891, 27915, 27927, 27934, 27941, 27946, 27963, 27966, 27969, 27972, 27973, 27996, 28006, 28010,
+  28014, 28020, 28023, 28024, 28040, 28057, 28079, 28082, 28092, 28113, 28129, 28139, 28145, 28151, 28155, 28165,
+  28167, 28168, 28169, 28171, 28179, 28187, 28193, 28198, 28201, 28204, 28207, 28246, 28263, 28271, 28286, 28287,
+  28288, 28304, 28310, 28317, 28342, 28346, 28357, 28363, 28369, 28381, 28382, 28404, 28417, 28418, 28422, 28431,
+  28436, 28448, 28450, 28459, 28460, 28472, 28500, 28508, 28511, 28516, 28526, 28528, 28548, 28608, 28609, 28611,
+  28651, 28655, 28716, 28779, 28783, 28784, 28797, 28809, 28810, 28814, 28845, 28857, 28858, 28872, 28961, 28966,
+  28982, 28988, 29006, 29017, 29031, 29033, 29038, 29066, 29087, 29105, 29123, 29157, 29190, 29226, 29237, 29238,
+  29245, 29255, 29256, 29273, 29275, 29287, 29289, 29298, 29305, 29344, 29356, 29359, 29366, 29378, 29401, 29417,
+  29420, 29421, 29467, 29471, 29483, 29486, 29494, 29503, 29508, 29539, 29554, 29572, 29575, 29577, 29579, 29609,
+  29645, 29664, 29677, 29694, 29699, 29702, 29748, 29792, 29827, 29863, 29872, 29885, 29926, 29942, 29976, 29978,
+  29983, 29987, 29992, 30000, 30001, 30002, 30003, 30007, 30010, 30011, 30028, 30031, 30033, 30036, 30041, 30044,
+  30045, 30053, 30058, 30064, 30067, 30079, 30094, 30097, 30123, 30130, 30142, 30149, 30151, 30165, 30168, 30171,
+  30178, 30185, 30196, 30221, 30274, 30290, 30294, 30330, 30331, 30333, 30334, 30340, 30342, 30343, 30382, 30399,
+  30406, 30410, 30423, 30427, 30431, 30435, 30436, 30446, 30450, 30452, 30456, 30462, 30465, 30473, 30475, 30476,
+  30495, 30496, 30522, 30524, 30528, 30561, 30563, 30566, 30636, 30637, 30643, 30683, 30690, 30693, 30701, 30703,
+  30707, 30722, 30740, 30741, 30770, 30772, 30813, 30827, 30828, 30849, 30865, 30906, 30913, 30952, 30977, 30990,
+  31034, 31036, 31038, 31048, 31049, 31062, 31069, 31070, 31077, 31080, 31085, 31105, 31109, 31117, 31119, 31168,
+  31169, 31179, 31185, 31186, 31192, 31199, 31209, 31216, 31227, 31243, 31246, 31258, 31278, 31282, 31292, 31293,
+  31295, 31296, 31298, 31309, 31311, 31339, 31348, 31350, 31354, 31361, 31363, 31378, 31379, 31391, 31406, 31407,
+  31435, 31452, 31456, 31461, 31471, 31478, 31481, 31505, 31515, 31526, 31532, 31558, 31561, 31563, 31570, 31572,
+  31574, 31623, 31627, 31639, 31649, 31665, 31672, 31680, 31684, 31689, 31716, 31777, 31807, 31821, 31840, 31859,
+  31881, 31883, 31890, 31895, 31896, 31899, 31911, 31934, 31958, 31975, 31992, 31995, 31998, 32000, 32004, 32005,
+  32011, 32013, 32020, 32025, 32026, 32027, 32032, 32033, 32034, 32043, 32047, 32048, 32051, 32057, 32058, 32066,
+  32068, 32076, 32080, 32094, 32097, 32102, 32113, 32117, 32118, 32121, 32153, 32154, 32173, 32177, 32178, 32187,
+  32191, 32202, 32207, 32209, 32210, 32218, 32224, 32232, 32233, 32239, 32244, 32251, 32257, 32260, 32283, 32294,
+  32299, 32302, 32318, 32321, 32330, 32340, 32341, 32365, 32368, 32566, 32618, 32622, 32624, 32626, 32629, 32631,
+  32645, 32650, 32654, 32670, 32676, 32680, 32681, 32701, 32705, 32716, 32722, 32763, 32764, 32769, 32771, 32773,
+  32784, 32789, 32791, 32819, 32854, 32862, 32884, 32887, 32905, 32908, 32918, 32920, 32925, 32929, 32930, 32933,
+  32937, 32938, 32943, 32946, 32954, 32963, 32966, 32972, 32974, 32990, 33012, 33016, 33021, 33026, 33029, 33031,
+  33032, 33034, 33050, 33073, 33075, 33102, 33104, 33109, 33131, 33136, 33144, 33145, 33146, 33178, 33180, 33181,
+  33192, 33203, 33222, 33235, 33251, 33256, 33258, 33261, 33267, 33268, 33276, 33288, 33292, 33294, 33303, 33310,
+  33311, 33322, 33324, 33334, 33335, 33337, 33351, 33382, 33391, 33394, 33398, 33419, 33437, 33455, 33457, 33459,
+  33464, 33469, 33495, 33499, 33509, 33510, 33521, 33538, 33550, 33576, 33590, 33609, 33618, 33624, 33655, 33738,
+  33740, 33747, 33756, 33775, 33806, 33853, 33865, 33879, 33883, 33900, 33976, 33988, 33995, 34065, 34101, 34109,
+  34180, 34214, 34218, 34219, 34220, 34253, 34276, 34281, 34299, 34382, 34384, 34394, 34396, 34398, 34411, 34425,
+  34442, 34453, 34503, 34509, 34542, 34562, 34588, 34701, 34880, 34886, 34892, 34899, 34903, 34907, 34909, 34913,
+  34915, 34920, 34928, 34935, 34955, 34966, 34987, 35009, 35010, 35013, 35023, 35029, 35036, 35064, 35069, 35070,
+  35079, 35088, 35090, 35167, 35186, 35199, 35201, 35206, 35207, 35211, 35215, 35222, 35226, 35239, 35242, 35251,
+  35282, 35299, 35302, 35328, 35330, 35331, 35336, 35342, 35347, 35351, 35352, 35359, 35370, 35373, 35377, 35379,
+  35380, 35386, 35388, 35408, 35412, 35413, 35422, 35424, 35427, 35430, 35433, 35438, 35440, 35441, 35442, 35443,
+  35463, 35465, 35468, 35469, 35475, 35477, 35480, 35486, 35488, 35492, 35500, 35501, 35504, 35506, 35519, 35527,
+  35531, 35542, 35558, 35559, 35565, 35566, 35576, 35582, 35584, 35585, 35588, 35598, 35609, 35611, 35613, 35617,
+  35641, 35672, 35676, 35686, 35696, 35698, 35703, 35895, 35910, 35914, 35930, 35937, 35946, 35980, 35997, 35998,
+  36000, 36001, 36002, 36007, 36008, 36009, 36010, 36011, 36012, 36015, 36020, 36023, 36024, 36027, 36028, 36031,
+  36032, 36034, 36035, 36036, 36039, 36042, 36051, 36059, 36060, 36062, 36064, 36066, 36070, 36074, 36077, 36092,
+  36104, 36196, 36198, 36208, 36212, 36215, 36229, 36234, 36259, 36275, 36317, 36321, 36335, 36339, 36341, 36362,
+  36367, 36394, 36468, 36493, 36523, 36554, 36556, 36557, 36562, 36575, 36578, 36600, 36605, 36611, 36617, 36637,
+  36649, 36650, 36664, 36676, 36763, 36766, 36771, 36785, 36786, 36794, 36796, 36805, 36814, 36817, 36820, 36843,
+  36845, 36848, 36855, 36861, 36864, 36865, 36867, 36870, 36879, 36880, 36883, 36884, 36890, 36893, 36895, 36896,
+  36899, 36910, 36913, 36914, 36920, 36930, 36933, 36935, 36938, 36939, 36941, 36942, 36947, 36948, 36949, 36956,
+  36960, 36961, 36963, 36969, 36973, 36974, 36981, 36983, 36984, 36986, 36991, 36996, 37027, 37030, 37034, 37048,
+  37066, 37070, 37089, 37096, 37101, 37109, 37111, 37117, 37196, 37197, 37198, 37202, 37204, 37218, 37226, 37228,
+  37237, 37239, 37240, 37266, 37276, 37304, 37319, 37320, 37324, 37325, 37326, 37327, 37329, 37340, 37341, 37347,
+  37389, 37428, 37444, 37467, 37474, 37489, 37504, 37507, 37509, 37528, 37549, 37613, 37619, 37628, 37664, 37670,
+  37676, 37678, 37679, 37682, 37707, 37723, 37749, 37772, 37782, 37806, 37857, 37912, 37969, 38263, 38272, 38281,
+  38283, 38289, 38291, 38306, 38307, 38309, 38322, 38343, 38360, 38428, 38442, 38450, 38459, 38468, 38477, 38480,
+  38491, 38498, 38499, 38500, 38501, 38506, 38512, 38515, 38517, 38518, 38520, 38522, 38525, 38533, 38534, 38538,
+  38542, 38543, 38548, 38553, 38555, 38556, 38560, 38563, 38583, 38587, 38596, 38597, 38598, 38599, 38604, 38609,
+  38626, 38627, 38632, 38634, 38640, 38642, 38646, 38647, 38651, 38656, 38663, 38666, 38684, 38695, 38706, 38738,
+  38745, 38750, 38754, 38761, 38772, 38867, 38899, 38907, 38911, 38914, 38915, 38917, 38918, 38920, 38928, 38929,
+  38930, 38931, 38936, 38956, 38957, 38971, 38972, 38988, 38989, 38990, 38996, 38997, 39000, 39006, 39015, 39080,
+  39131, 39135, 39138, 39151, 39154, 39164, 39165, 39166, 39173, 39178, 39180, 39187, 39208, 39318, 39321, 39340,
+  39364, 39365, 39366, 39376, 39378, 39438, 39442, 39443, 39472, 39514, 39592, 39608, 39620, 39640, 39658, 39729,
+  39740, 39746, 39749, 39764, 39770, 39854, 39912, 40165, 40180, 40335, 40372, 40575, 40595, 40599, 40614, 40634,
+  40635, 40644, 40658, 40665, 40723, 40763, 40802,
+};
+const uint32_t ALPHA_118_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_118_FREQ[] = {
+  { "ど", 0.00250000 },
+  { "蛇", 0.00000000 },
+  { "丘", 0.00010000 },
+  { "到", 0.00010000 },
+  { "刷", 0.00000000 },
+  { "宰", 0.00000000 },
+  { "尽", 0.00000000 },
+  { "一", 0.00250000 },
+  { "償", 0.00000000 },
+  { "告", 0.00020000 },
+  { "寿", 0.00000000 },
+  { "輩", 0.00000000 },
+  { "妙", 0.00000000 },
+  { "酒", 0.00010000 },
+  { "裏", 0.00010000 },
+  { "扇", 0.00000000 },
+  { "銘", 0.00000000 },
+  { "桜", 0.00000000 },
+  { "喩", 0.00000000 },
+  { "芋", 0.00000000 },
+  { "磨", 0.00000000 },
+  { "漂", 0.00000000 },
+  { "併", 0.00020000 },
+  { "歳", 0.00030000 },
+  { "殴", 0.00000000 },
+  { "ヒ", 0.00040000 },
+  { "柱", 0.00000000 },
+  { "戸", 0.00030000 },
+  { "杯", 0.00000000 },
+  { "採", 0.00020000 },
+  { "媛", 0.00000000 },
+  { "寺", 0.00020000 },
+  { "冥", 0.00000000 },
+  { "勲", 0.00000000 },
+  { "純", 0.00010000 },
+  { "旨", 0.00000000 },
+  { "痘", 0.00000000 },
+  { "独", 0.00030000 },
+  { "仰", 0.00000000 },
+  { "略", 0.00020000 },
+  { "駒", 0.00000000 },
+  { "ゴ", 0.00050000 },
+  { "普", 0.00010000 },
+  { "驚", 0.00000000 },
+  { "易", 0.00010000 },
+  { "副", 0.00010000 },
+  { "吏", 0.00000000 },
+  { "促", 0.00000000 },
+  { "幅", 0.00010000 },
+  { "棒", 0.00000000 },
+  { "謹", 0.00000000 },
+  { "尾", 0.00010000 },
+  { "び", 0.00090000 },
+  { "織", 0.00020000 },
+  { "鋼", 0.00000000 },
+  { "暮", 0.00000000 },
+  { "庶", 0.00000000 },
+  { "洞", 0.00000000 },
+  { "旅", 0.00020000 },
+  { "遠", 0.00010000 },
+  { "送", 0.00090000 },
+  { "神", 0.00060000 },
+  { "領", 0.00030000 },
+  { "堂", 0.00010000 },
+  { "ミ", 0.00120000 },
+  { "努", 0.00000000 },
+  { "禍", 0.00000000 },
+  { "天", 0.00050000 },
+  { "曹", 0.00000000 },
+  { "速", 0.00030000 },
+  { "妖", 0.00000000 },
+  { "鎖", 0.00010000 },
+  { "府", 0.00040000 },
+  { "猛", 0.00000000 },
+  { "示", 0.00030000 },
+  { "ョ", 0.00110000 },
+  { "屋", 0.00030000 },
+  { "訴", 0.00010000 },
+  { "刑", 0.00010000 },
+  { "悠", 0.00000000 },
+  { "降", 0.00040000 },
+  { "后", 0.00000000 },
+  { "勾", 0.00000000 },
+  { "更", 0.00030000 },
+  { "焼", 0.00010000 },
+  { "柄", 0.00000000 },
+  { "泌", 0.00000000 },
+  { "霜", 0.00000000 },
+  { "需", 0.00000000 },
+  { "似", 0.00010000 },
+  { "港", 0.00020000 },
+  { "漬", 0.00000000 },
+  { "釈", 0.00010000 },
+  { "賀", 0.00010000 },
+  { "土", 0.00030000 },
+  { "隆", 0.00010000 },
+  { "籠", 0.00000000 },
+  { "医", 0.00010000 },
+  { "請", 0.00010000 },
+  { "答", 0.00010000 },
+  { "院", 0.00040000 },
+  { "牙", 0.00000000 },
+  { "常", 0.00040000 },
+  { "力", 0.00090000 },
+  { "憬", 0.00000000 },
+  { "州", 0.00060000 },
+  { "露", 0.00010000 },
+  { "楷", 0.00000000 },
+  { "殊", 0.00000000 },
+  { "損", 0.00010000 },
+  { "困", 0.00010000 },
+  { "零", 0.00000000 },
+  { "堤", 0.00000000 },
+  { "灯", 0.00000000 },
+  { "飲", 0.00000000 },
+  { "鎮", 0.00000000 },
+  { "悩", 0.00000000 },
+  { "某", 0.00000000 },
+  { "謀", 0.00000000 },
+  { "漸", 0.00000000 },
+  { "区", 0.00070000 },
+  { "座", 0.00020000 },
+  { "懇", 0.00000000 },
+  { "気", 0.00060000 },
+  { "入", 0.00140000 },
+  { "晩", 0.00000000 },
+  { "父", 0.00020000 },
+  { "遺", 0.00020000 },
+  { "基", 0.00050000 },
+  { "菊", 0.00000000 },
+  { "怠", 0.00000000 },
+  { "極", 0.00020000 },
+  { "遷", 0.00000000 },
+  { "馬", 0.00040000 },
+  { "賂", 0.00000000 },
+  { "行", 0.00250000 },
+  { "歌", 0.00030000 },
+  { "救", 0.00010000 },
+  { "洪", 0.00000000 },
+  { "盤", 0.00010000 },
+  { "ゼ", 0.00030000 },
+  { "役", 0.00040000 },
+  { "ぉ", 0.00000000 },
+  { "験", 0.00020000 },
+  { "訂", 0.00000000 },
+  { "在", 0.00130000 },
+  { "斤", 0.00000000 },
+  { "赤", 0.00020000 },
+  { "様", 0.00050000 },
+  { "黙", 0.00000000 },
+  { "罵", 0.00000000 },
+  { "横", 0.00020000 },
+  { "巣", 0.00000000 },
+  { "沸", 0.00000000 },
+  { "秒", 0.00010000 },
+  { "蔑", 0.00000000 },
+  { "狩", 0.00000000 },
+  { "個", 0.00020000 },
+  { "夕", 0.00000000 },
+  { "渡", 0.00020000 },
+  { "圧", 0.00020000 },
+  { "師", 0.00030000 },
+  { "填", 0.00000000 },
+  { "拶", 0.00000000 },
+  { "那", 0.00000000 },
+  { "室", 0.00020000 },
+  { "セ", 0.00100000 },
+  { "浄", 0.00000000 },
+  { "針", 0.00010000 },
+  { "栓", 0.00000000 },
+  { "疎", 0.00000000 },
+  { "沈", 0.00000000 },
+  { "柵", 0.00000000 },
+  { "回", 0.00080000 },
+  { "礼", 0.00010000 },
+  { "渦", 0.00000000 },
+  { "継", 0.00030000 },
+  { "抵", 0.00000000 },
+  { "乳", 0.00000000 },
+  { "毀", 0.00000000 },
+  { "星", 0.00030000 },
+  { "は", 0.02060000 },
+  { "マ", 0.00240000 },
+  { "加", 0.00070000 },
+  { "既", 0.00010000 },
+  { "肘", 0.00000000 },
+  { "阜", 0.00000000 },
+  { "ま", 0.00440000 },
+  { "穂", 0.00000000 },
+  { "幼", 0.00010000 },
+  { "狂", 0.00000000 },
+  { "舎", 0.00010000 },
+  { "机", 0.00000000 },
+  { "晶", 0.00000000 },
+  { "尉", 0.00000000 },
+  { "勘", 0.00000000 },
+  { "窃", 0.00000000 },
+  { "幾", 0.00000000 },
+  { "機", 0.00120000 },
+  { "至", 0.00010000 },
+  { "非", 0.00020000 },
+  { "ぅ", 0.00000000 },
+  { "碁", 0.00000000 },
+  { "嗣", 0.00000000 },
+  { "漁", 0.00000000 },
+  { "刃", 0.00000000 },
+  { "省", 0.00020000 },
+  { "苦", 0.00010000 },
+  { "羅", 0.00000000 },
+  { "謎", 0.00000000 },
+  { "撤", 0.00010000 },
+  { "薦", 0.00000000 },
+  { "月", 0.00370000 },
+  { "焦", 0.00000000 },
+  { "蚊", 0.00000000 },
+  { "人", 0.00290000 },
+  { "頓", 0.00000000 },
+  { "赦", 0.00000000 },
+  { "片", 0.00010000 },
+  { "負", 0.00020000 },
+  { "床", 0.00000000 },
+  { "永", 0.00010000 },
+  { "利", 0.00060000 },
+  { "末", 0.00020000 },
+  { "肖", 0.00000000 },
+  { "喝", 0.00000000 },
+  { "挟", 0.00000000 },
+  { "酬", 0.00000000 },
+  { "習", 0.00010000 },
+  { "週", 0.00010000 },
+  { "賊", 0.00000000 },
+  { "覇", 0.00010000 },
+  { "ポ", 0.00090000 },
+  { "舌", 0.00000000 },
+  { "餅", 0.00000000 },
+  { "効", 0.00020000 },
+  { "護", 0.00020000 },
+  { "満", 0.00020000 },
+  { "甲", 0.00010000 },
+  { "ケ", 0.00070000 },
+  { "投", 0.00030000 },
+  { "応", 0.00030000 },
+  { "誓", 0.00000000 },
+  { "袖", 0.00000000 },
+  { "潔", 0.00000000 },
+  { "笑", 0.00000000 },
+  { "房", 0.00010000 },
+  { "免", 0.00010000 },
+  { "鍵", 0.00000000 },
+  { "勉", 0.00000000 },
+  { "砲", 0.00020000 },
+  { "芸", 0.00020000 },
+  { "掘", 0.00000000 },
+  { "披", 0.00000000 },
+  { "縁", 0.00010000 },
+  { "ぇ", 0.00000000 },
+  { "止", 0.00040000 },
+  { "憤", 0.00000000 },
+  { "酎", 0.00000000 },
+  { "蔽", 0.00000000 },
+  { "傍", 0.00000000 },
+  { "オ", 0.00210000 },
+  { "旧", 0.00030000 },
+  { "版", 0.00040000 },
+  { "爽", 0.00000000 },
+  { "塔", 0.00010000 },
+  { "令", 0.00020000 },
+  { "依", 0.00010000 },
+  { "児", 0.00010000 },
+  { "吐", 0.00000000 },
+  { "殻", 0.00000000 },
+  { "哲", 0.00010000 },
+  { "十", 0.00020000 },
+  { "姿", 0.00010000 },
+  { "察", 0.00010000 },
+  { "筆", 0.00010000 },
+  { "欺", 0.00000000 },
+  { "東", 0.00130000 },
+  { "距", 0.00010000 },
+  { "ゐ", 0.00000000 },
+  { "実", 0.00090000 },
+  { "泣", 0.00000000 },
+  { "里", 0.00010000 },
+  { "首", 0.00020000 },
+  { "凄", 0.00000000 },
+  { "該", 0.00000000 },
+  { "避", 0.00010000 },
+  { "ざ", 0.00010000 },
+  { "宇", 0.00020000 },
+  { "綿", 0.00000000 },
+  { "傲", 0.00000000 },
+  { "変", 0.00060000 },
+  { "雰", 0.00000000 },
+  { "操", 0.00010000 },
+  { "講", 0.00010000 },
+  { "賜", 0.00000000 },
+  { "液", 0.00010000 },
+  { "そ", 0.00300000 },
+  { "話", 0.00040000 },
+  { "奮", 0.00000000 },
+  { "偏", 0.00000000 },
+  { "鋳", 0.00000000 },
+  { "綻", 0.00000000 },
+  { "闘", 0.00020000 },
+  { "俸", 0.00000000 },
+  { "雷", 0.00010000 },
+  { "逸", 0.00000000 },
+  { "側", 0.00040000 },
+  { "懐", 0.00000000 },
+  { "貯", 0.00000000 },
+  { "ゎ", 0.00000000 },
+  { "架", 0.00010000 },
+  { "呼", 0.00060000 },
+  { "税", 0.00010000 },
+  { "典", 0.00010000 },
+  { "桁", 0.00000000 },
+  { "期", 0.00090000 },
+  { "ジ", 0.00300000 },
+  { "藩", 0.00020000 },
+  { "卓", 0.00000000 },
+  { "中", 0.00260000 },
+  { "復", 0.00030000 },
+  { "訓", 0.00010000 },
+  { "可", 0.00040000 },
+  { "策", 0.00020000 },
+  { "海", 0.00080000 },
+  { "和", 0.00090000 },
+  { "場", 0.00180000 },
+  { "趣", 0.00000000 },
+  { "揺", 0.00000000 },
+  { "澄", 0.00000000 },
+  { "儒", 0.00000000 },
+  { "ぜ", 0.00010000 },
+  { "寛", 0.00010000 },
+  { "催", 0.00020000 },
+  { "卵", 0.00000000 },
+  { "か", 0.00760000 },
+  { "遍", 0.00000000 },
+  { "殿", 0.00010000 },
+  { "絞", 0.00000000 },
+  { "牛", 0.00000000 },
+  { "鍛", 0.00000000 },
+  { "践", 0.00000000 },
+  { "浴", 0.00000000 },
+  { "序", 0.00000000 },
+  { "夜", 0.00010000 },
+  { "撃", 0.00040000 },
+  { "邸", 0.00000000 },
+  { "尿", 0.00000000 },
+  { "点", 0.00070000 },
+  { "熱", 0.00010000 },
+  { "威", 0.00000000 },
+  { "九", 0.00010000 },
+  { "円", 0.00020000 },
+  { "直", 0.00050000 },
+  { "据", 0.00000000 },
+  { "丹", 0.00000000 },
+  { "冗", 0.00000000 },
+  { "逐", 0.00000000 },
+  { "承", 0.00010000 },
+  { "茎", 0.00000000 },
+  { "由", 0.00040000 },
+  { "腺", 0.00000000 },
+  { "崎", 0.00020000 },
+  { "伐", 0.00000000 },
+  { "督", 0.00030000 },
+  { "隔", 0.00000000 },
+  { "金", 0.00060000 },
+  { "賞", 0.00040000 },
+  { "賭", 0.00000000 },
+  { "硬", 0.00000000 },
+  { "朴", 0.00000000 },
+  { "取", 0.00060000 },
+  { "玉", 0.00010000 },
+  { "わ", 0.00220000 },
+  { "濃", 0.00010000 },
+  { "弊", 0.00000000 },
+  { "賠", 0.00000000 },
+  { "橋", 0.00030000 },
+  { "張", 0.00020000 },
+  { "符", 0.00000000 },
+  { "介", 0.00010000 },
+  { "簿", 0.00000000 },
+  { "超", 0.00010000 },
+  { "吸", 0.00010000 },
+  { "根", 0.00020000 },
+  { "鼻", 0.00000000 },
+  { "石", 0.00040000 },
+  { "腸", 0.00000000 },
+  { "引", 0.00040000 },
+  { "塗", 0.00000000 },
+  { "毒", 0.00000000 },
+  { "任", 0.00050000 },
+  { "盟", 0.00010000 },
+  { "拙", 0.00000000 },
+  { "顕", 0.00000000 },
+  { "侮", 0.00000000 },
+  { "涙", 0.00000000 },
+  { "学", 0.00250000 },
+  { "季", 0.00010000 },
+  { "正", 0.00070000 },
+  { "埋", 0.00000000 },
+  { "鐘", 0.00000000 },
+  { "無", 0.00050000 },
+  { "営", 0.00040000 },
+  { "パ", 0.00150000 },
+  { "工", 0.00050000 },
+  { "歴", 0.00030000 },
+  { "箱", 0.00000000 },
+  { "追", 0.00020000 },
+  { "森", 0.00010000 },
+  { "リ", 0.00610000 },
+  { "草", 0.00010000 },
+  { "両", 0.00050000 },
+  { "虹", 0.00000000 },
+  { "将", 0.00020000 },
+  { "江", 0.00020000 },
+  { "畏", 0.00000000 },
+  { "境", 0.00020000 },
+  { "女", 0.00060000 },
+  { "ほ", 0.00070000 },
+  { "鉛", 0.00000000 },
+  { "貨", 0.00010000 },
+  { "帽", 0.00000000 },
+  { "る", 0.02200000 },
+  { "繊", 0.00000000 },
+  { "鑑", 0.00000000 },
+  { "方", 0.00120000 },
+  { "傘", 0.00000000 },
+  { "砂", 0.00010000 },
+  { "ぢ", 0.00000000 },
+  { "鏡", 0.00000000 },
+  { "堀", 0.00000000 },
+  { "品", 0.00070000 },
+  { "斎", 0.00000000 },
+  { "反", 0.00040000 },
+  { "庭", 0.00010000 },
+  { "皿", 0.00000000 },
+  { "愚", 0.00000000 },
+  { "随", 0.00000000 },
+  { "薄", 0.00000000 },
+  { "甘", 0.00000000 },
+  { "ラ", 0.00550000 },
+  { "除", 0.00020000 },
+  { "民", 0.00070000 },
+  { "克", 0.00000000 },
+  { "剰", 0.00000000 },
+  { "減", 0.00020000 },
+  { "締", 0.00010000 },
+  { "読", 0.00010000 },
+  { "づ", 0.00020000 },
+  { "子", 0.00130000 },
+  { "痢", 0.00000000 },
+  { "不", 0.00050000 },
+  { "千", 0.00020000 },
+  { "条", 0.00030000 },
+  { "阻", 0.00000000 },
+  { "躍", 0.00020000 },
+  { "農", 0.00010000 },
+  { "四", 0.00020000 },
+  { "慕", 0.00000000 },
+  { "城", 0.00040000 },
+  { "捜", 0.00000000 },
+  { "層", 0.00010000 },
+  { "む", 0.00040000 },
+  { "億", 0.00010000 },
+  { "ぱ", 0.00000000 },
+  { "飽", 0.00000000 },
+  { "階", 0.00020000 },
+  { "召", 0.00000000 },
+  { "残", 0.00030000 },
+  { "署", 0.00000000 },
+  { "意", 0.00060000 },
+  { "肯", 0.00000000 },
+  { "災", 0.00010000 },
+  { "違", 0.00020000 },
+  { "ぃ", 0.00000000 },
+  { "皆", 0.00000000 },
+  { "逝", 0.00000000 },
+  { "爪", 0.00000000 },
+  { "向", 0.00050000 },
+  { "恭", 0.00000000 },
+  { "泰", 0.00000000 },
+  { "成", 0.00160000 },
+  { "肢", 0.00000000 },
+  { "削", 0.00000000 },
+  { "喚", 0.00000000 },
+  { "幽", 0.00000000 },
+  { "羽", 0.00010000 },
+  { "湾", 0.00010000 },
+  { "プ", 0.00250000 },
+  { "墓", 0.00000000 },
+  { "潮", 0.00000000 },
+  { "破", 0.00020000 },
+  { "塀", 0.00000000 },
+  { "姓", 0.00000000 },
+  { "昨", 0.00000000 },
+  { "宗", 0.00020000 },
+  { "王", 0.00060000 },
+  { "隅", 0.00000000 },
+  { "初", 0.00110000 },
+  { "聴", 0.00010000 },
+  { "標", 0.00020000 },
+  { "剥", 0.00000000 },
+  { "革", 0.00010000 },
+  { "墳", 0.00000000 },
+  { "霊", 0.00010000 },
+  { "テ", 0.00260000 },
+  { "汗", 0.00000000 },
+  { "試", 0.00040000 },
+  { "解", 0.00050000 },
+  { "愁", 0.00000000 },
+  { "逮", 0.00000000 },
+  { "隻", 0.00010000 },
+  { "忠", 0.00010000 },
+  { "種", 0.00050000 },
+  { "巨", 0.00010000 },
+  { "能", 0.00070000 },
+  { "倒", 0.00010000 },
+  { "高", 0.00140000 },
+  { "排", 0.00010000 },
+  { "戦", 0.00190000 },
+  { "瘍", 0.00000000 },
+  { "升", 0.00000000 },
+  { "だ", 0.00180000 },
+  { "惜", 0.00000000 },
+  { "犬", 0.00000000 },
+  { "疲", 0.00000000 },
+  { "飢", 0.00000000 },
+  { "射", 0.00020000 },
+  { "給", 0.00010000 },
+  { "拭", 0.00000000 },
+  { "郭", 0.00000000 },
+  { "紅", 0.00000000 },
+  { "眠", 0.00000000 },
+  { "暑", 0.00000000 },
+  { "佳", 0.00000000 },
+  { "備", 0.00040000 },
+  { "坪", 0.00000000 },
+  { "紹", 0.00010000 },
+  { "村", 0.00040000 },
+  { "振", 0.00010000 },
+  { "舞", 0.00010000 },
+  { "罷", 0.00000000 },
+  { "梗", 0.00000000 },
+  { "申", 0.00010000 },
+  { "衆", 0.00020000 },
+  { "扉", 0.00000000 },
+  { "徴", 0.00010000 },
+  { "働", 0.00010000 },
+  { "範", 0.00010000 },
+  { "状", 0.00040000 },
+  { "預", 0.00000000 },
+  { "竹", 0.00010000 },
+  { "ウ", 0.00190000 },
+  { "置", 0.00080000 },
+  { "貫", 0.00010000 },
+  { "駐", 0.00010000 },
+  { "角", 0.00010000 },
+  { "課", 0.00010000 },
+  { "斑", 0.00000000 },
+  { "款", 0.00000000 },
+  { "結", 0.00070000 },
+  { "忙", 0.00000000 },
+  { "周", 0.00030000 },
+  { "懲", 0.00000000 },
+  { "煮", 0.00000000 },
+  { "け", 0.00280000 },
+  { "関", 0.00100000 },
+  { "京", 0.00070000 },
+  { "地", 0.00210000 },
+  { "髄", 0.00000000 },
+  { "凍", 0.00000000 },
+  { "牲", 0.00000000 },
+  { "拠", 0.00010000 },
+  { "劾", 0.00000000 },
+  { "君", 0.00010000 },
+  { "年", 0.01030000 },
+  { "深", 0.00010000 },
+  { "酌", 0.00000000 },
+  { "孫", 0.00010000 },
+  { "秘", 0.00010000 },
+  { "瓦", 0.00000000 },
+  { "恐", 0.00010000 },
+  { "足", 0.00020000 },
+  { "舶", 0.00000000 },
+  { "朗", 0.00000000 },
+  { "兵", 0.00030000 },
+  { "虎", 0.00000000 },
+  { "頒", 0.00000000 },
+  { "ュ", 0.00180000 },
+  { "元", 0.00070000 },
+  { "折", 0.00010000 },
+  { "浪", 0.00000000 },
+  { "氷", 0.00000000 },
+  { "考", 0.00030000 },
+  { "亀", 0.00000000 },
+  { "貿", 0.00000000 },
+  { "股", 0.00000000 },
+  { "症", 0.00010000 },
+  { "つ", 0.00240000 },
+  { "篤", 0.00000000 },
+  { "詠", 0.00000000 },
+  { "牧", 0.00010000 },
+  { "佐", 0.00020000 },
+  { "タ", 0.00350000 },
+  { "要", 0.00080000 },
+  { "廃", 0.00020000 },
+  { "隊", 0.00050000 },
+  { "べ", 0.00040000 },
+  { "臓", 0.00000000 },
+  { "尼", 0.00000000 },
+  { "激", 0.00010000 },
+  { "雲", 0.00010000 },
+  { "練", 0.00010000 },
+  { "炭", 0.00010000 },
+  { "氾", 0.00000000 },
+  { "雌", 0.00000000 },
+  { "胆", 0.00000000 },
+  { "格", 0.00040000 },
+  { "侵", 0.00010000 },
+  { "走", 0.00030000 },
+  { "汰", 0.00000000 },
+  { "椅", 0.00000000 },
+  { "厄", 0.00000000 },
+  { "誘", 0.00010000 },
+  { "務", 0.00060000 },
+  { "招", 0.00010000 },
+  { "獄", 0.00000000 },
+  { "で", 0.01690000 },
+  { "閑", 0.00000000 },
+  { "充", 0.00010000 },
+  { "屈", 0.00000000 },
+  { "猿", 0.00000000 },
+  { "塁", 0.00010000 },
+  { "支", 0.00040000 },
+  { "何", 0.00010000 },
+  { "飯", 0.00000000 },
+  { "司", 0.00020000 },
+  { "酪", 0.00000000 },
+  { "現", 0.00140000 },
+  { "混", 0.00010000 },
+  { "辛", 0.00000000 },
+  { "ヶ", 0.00010000 },
+  { "敷", 0.00010000 },
+  { "母", 0.00020000 },
+  { "冊", 0.00000000 },
+  { "淑", 0.00000000 },
+  { "偉", 0.00000000 },
+  { "旗", 0.00010000 },
+  { "統", 0.00040000 },
+  { "泡", 0.00000000 },
+  { "宙", 0.00010000 },
+  { "遂", 0.00000000 },
+  { "瓶", 0.00000000 },
+  { "恥", 0.00000000 },
+  { "翁", 0.00000000 },
+  { "熊", 0.00010000 },
+  { "幸", 0.00010000 },
+  { "摂", 0.00000000 },
+  { "規", 0.00030000 },
+  { "凹", 0.00000000 },
+  { "欧", 0.00010000 },
+  { "械", 0.00000000 },
+  { "葬", 0.00000000 },
+  { "欄", 0.00000000 },
+  { "桟", 0.00000000 },
+  { "擁", 0.00000000 },
+  { "疾", 0.00000000 },
+  { "畑", 0.00000000 },
+  { "対", 0.00120000 },
+  { "寮", 0.00000000 },
+  { "堅", 0.00000000 },
+  { "壊", 0.00010000 },
+  { "荘", 0.00000000 },
+  { "も", 0.00690000 },
+  { "滑", 0.00000000 },
+  { "う", 0.00460000 },
+  { "接", 0.00030000 },
+  { "培", 0.00000000 },
+  { "摩", 0.00010000 },
+  { "越", 0.00020000 },
+  { "完", 0.00030000 },
+  { "押", 0.00010000 },
+  { "斜", 0.00000000 },
+  { "耳", 0.00000000 },
+  { "殖", 0.00000000 },
+  { "県", 0.00100000 },
+  { "緯", 0.00000000 },
+  { "畳", 0.00000000 },
+  { "煙", 0.00000000 },
+  { "た", 0.02140000 },
+  { "陣", 0.00010000 },
+  { "万", 0.00040000 },
+  { "康", 0.00010000 },
+  { "粧", 0.00000000 },
+  { "肪", 0.00000000 },
+  { "墨", 0.00000000 },
+  { "搭", 0.00010000 },
+  { "デ", 0.00220000 },
+  { "施", 0.00030000 },
+  { "ン", 0.01370000 },
+  { "商", 0.00030000 },
+  { "往", 0.00000000 },
+  { "砕", 0.00000000 },
+  { "存", 0.00050000 },
+  { "肥", 0.00000000 },
+  { "丈", 0.00000000 },
+  { "積", 0.00020000 },
+  { "迷", 0.00000000 },
+  { "補", 0.00020000 },
+  { "余", 0.00010000 },
+  { "守", 0.00020000 },
+  { "脱", 0.00010000 },
+  { "乙", 0.00000000 },
+  { "穫", 0.00000000 },
+  { "潰", 0.00000000 },
+  { "臣", 0.00020000 },
+  { "娯", 0.00000000 },
+  { "占", 0.00010000 },
+  { "抽", 0.00000000 },
+  { "ゃ", 0.00010000 },
+  { "功", 0.00020000 },
+  { "前", 0.00130000 },
+  { "株", 0.00020000 },
+  { "祈", 0.00000000 },
+  { "枝", 0.00000000 },
+  { "繰", 0.00010000 },
+  { "蔵", 0.00010000 },
+  { "際", 0.00060000 },
+  { "特", 0.00080000 },
+  { "議", 0.00060000 },
+  { "求", 0.00020000 },
+  { "融", 0.00010000 },
+  { "丸", 0.00010000 },
+  { "刊", 0.00020000 },
+  { "卒", 0.00020000 },
+  { "値", 0.00010000 },
+  { "柿", 0.00000000 },
+  { "程", 0.00020000 },
+  { "逆", 0.00010000 },
+  { "整", 0.00020000 },
+  { "匂", 0.00000000 },
+  { "涯", 0.00000000 },
+  { "才", 0.00000000 },
+  { "丁", 0.00010000 },
+  { "葛", 0.00000000 },
+  { "擬", 0.00000000 },
+  { "獣", 0.00000000 },
+  { "ト", 0.00660000 },
+  { "員", 0.00070000 },
+  { "豊", 0.00010000 },
+  { "傑", 0.00000000 },
+  { "契", 0.00010000 },
+  { "畜", 0.00000000 },
+  { "識", 0.00010000 },
+  { "糸", 0.00000000 },
+  { "弐", 0.00000000 },
+  { "養", 0.00010000 },
+  { "ゆ", 0.00020000 },
+  { "先", 0.00040000 },
+  { "荷", 0.00010000 },
+  { "快", 0.00010000 },
+  { "ブ", 0.00170000 },
+  { "管", 0.00030000 },
+  { "陰", 0.00000000 },
+  { "証", 0.00010000 },
+  { "附", 0.00000000 },
+  { "靴", 0.00000000 },
+  { "級", 0.00030000 },
+  { "目", 0.00110000 },
+  { "突", 0.00010000 },
+  { "徐", 0.00000000 },
+  { "陵", 0.00000000 },
+  { "旺", 0.00000000 },
+  { "差", 0.00020000 },
+  { "銀", 0.00020000 },
+  { "虚", 0.00000000 },
+  { "累", 0.00000000 },
+  { "終", 0.00050000 },
+  { "娠", 0.00000000 },
+  { "錠", 0.00000000 },
+  { "経", 0.00070000 },
+  { "風", 0.00020000 },
+  { "琴", 0.00000000 },
+  { "朽", 0.00000000 },
+  { "喜", 0.00010000 },
+  { "把", 0.00000000 },
+  { "ク", 0.00450000 },
+  { "山", 0.00110000 },
+  { "棟", 0.00000000 },
+  { "源", 0.00020000 },
+  { "ィ", 0.00240000 },
+  { "垂", 0.00000000 },
+  { "背", 0.00010000 },
+  { "楽", 0.00050000 },
+  { "朝", 0.00040000 },
+  { "瞬", 0.00000000 },
+  { "賢", 0.00000000 },
+  { "盛", 0.00010000 },
+  { "旋", 0.00000000 },
+  { "眉", 0.00000000 },
+  { "縮", 0.00010000 },
+  { "書", 0.00060000 },
+  { "賛", 0.00000000 },
+  { "宝", 0.00010000 },
+  { "挿", 0.00000000 },
+  { "祥", 0.00000000 },
+  { "療", 0.00010000 },
+  { "沖", 0.00010000 },
+  { "ぁ", 0.00000000 },
+  { "始", 0.00060000 },
+  { "移", 0.00050000 },
+  { "沿", 0.00010000 },
+  { "雑", 0.00010000 },
+  { "興", 0.00020000 },
+  { "危", 0.00010000 },
+  { "ニ", 0.00180000 },
+  { "夫", 0.00020000 },
+  { "核", 0.00010000 },
+  { "乗", 0.00040000 },
+  { "剤", 0.00000000 },
+  { "談", 0.00010000 },
+  { "秀", 0.00010000 },
+  { "弔", 0.00000000 },
+  { "塚", 0.00010000 },
+  { "ユ", 0.00030000 },
+  { "刻", 0.00010000 },
+  { "謄", 0.00000000 },
+  { "過", 0.00030000 },
+  { "悔", 0.00000000 },
+  { "概", 0.00010000 },
+  { "嫉", 0.00000000 },
+  { "伏", 0.00000000 },
+  { "唾", 0.00000000 },
+  { "慮", 0.00000000 },
+  { "唱", 0.00010000 },
+  { "登", 0.00050000 },
+  { "左", 0.00020000 },
+  { "叱", 0.00000000 },
+  { "米", 0.00030000 },
+  { "爆", 0.00010000 },
+  { "少", 0.00040000 },
+  { "衛", 0.00020000 },
+  { "修", 0.00020000 },
+  { "鉄", 0.00060000 },
+  { "亡", 0.00010000 },
+  { "蜂", 0.00000000 },
+  { "囲", 0.00010000 },
+  { "御", 0.00020000 },
+  { "昭", 0.00040000 },
+  { "身", 0.00070000 },
+  { "丙", 0.00000000 },
+  { "濫", 0.00000000 },
+  { "述", 0.00020000 },
+  { "髪", 0.00000000 },
+  { "娘", 0.00010000 },
+  { "勇", 0.00000000 },
+  { "二", 0.00050000 },
+  { "但", 0.00000000 },
+  { "欲", 0.00000000 },
+  { "吹", 0.00000000 },
+  { "覆", 0.00000000 },
+  { "推", 0.00020000 },
+  { "散", 0.00010000 },
+  { "倍", 0.00010000 },
+  { "准", 0.00000000 },
+  { "窒", 0.00000000 },
+  { "道", 0.00130000 },
+  { "乾", 0.00000000 },
+  { "感", 0.00020000 },
+  { "予", 0.00030000 },
+  { "巧", 0.00000000 },
+  { "艶", 0.00000000 },
+  { "払", 0.00010000 },
+  { "仕", 0.00020000 },
+  { "み", 0.00130000 },
+  { "菜", 0.00000000 },
+  { "次", 0.00060000 },
+  { "又", 0.00000000 },
+  { "詣", 0.00000000 },
+  { "票", 0.00010000 },
+  { "ふ", 0.00010000 },
+  { "姻", 0.00000000 },
+  { "祝", 0.00000000 },
+  { "臆", 0.00000000 },
+  { "却", 0.00010000 },
+  { "枢", 0.00000000 },
+  { "総", 0.00040000 },
+  { "錦", 0.00000000 },
+  { "伸", 0.00010000 },
+  { "担", 0.00020000 },
+  { "婚", 0.00010000 },
+  { "起", 0.00040000 },
+  { "雄", 0.00010000 },
+  { "な", 0.01210000 },
+  { "白", 0.00020000 },
+  { "俳", 0.00010000 },
+  { "被", 0.00010000 },
+  { "ご", 0.00030000 },
+  { "覧", 0.00010000 },
+  { "粋", 0.00000000 },
+  { "麻", 0.00010000 },
+  { "畿", 0.00000000 },
+  { "疫", 0.00000000 },
+  { "雇", 0.00000000 },
+  { "ア", 0.00570000 },
+  { "逓", 0.00000000 },
+  { "巾", 0.00000000 },
+  { "停", 0.00020000 },
+  { "判", 0.00030000 },
+  { "謡", 0.00000000 },
+  { "章", 0.00010000 },
+  { "績", 0.00010000 },
+  { "嘲", 0.00000000 },
+  { "泳", 0.00000000 },
+  { "襟", 0.00000000 },
+  { "拐", 0.00000000 },
+  { "陸", 0.00030000 },
+  { "新", 0.00110000 },
+  { "縫", 0.00000000 },
+  { "量", 0.00030000 },
+  { "扶", 0.00000000 },
+  { "生", 0.00170000 },
+  { "妥", 0.00000000 },
+  { "急", 0.00030000 },
+  { "香", 0.00010000 },
+  { "照", 0.00020000 },
+  { "循", 0.00000000 },
+  { "桃", 0.00000000 },
+  { "煎", 0.00000000 },
+  { "迎", 0.00010000 },
+  { "算", 0.00020000 },
+  { "内", 0.00130000 },
+  { "痩", 0.00000000 },
+  { "派", 0.00030000 },
+  { "罪", 0.00010000 },
+  { "育", 0.00030000 },
+  { "菓", 0.00000000 },
+  { "駄", 0.00000000 },
+  { "並", 0.00010000 },
+  { "拾", 0.00000000 },
+  { "悦", 0.00000000 },
+  { "ノ", 0.00080000 },
+  { "憩", 0.00000000 },
+  { "斬", 0.00000000 },
+  { "恋", 0.00000000 },
+  { "漆", 0.00000000 },
+  { "氏", 0.00030000 },
+  { "渋", 0.00000000 },
+  { "親", 0.00030000 },
+  { "曜", 0.00020000 },
+  { "去", 0.00020000 },
+  { "忍", 0.00000000 },
+  { "宜", 0.00000000 },
+  { "布", 0.00010000 },
+  { "央", 0.00020000 },
+  { "溺", 0.00000000 },
+  { "輝", 0.00000000 },
+  { "遣", 0.00010000 },
+  { "阪", 0.00030000 },
+  { "怖", 0.00000000 },
+  { "蛮", 0.00000000 },
+  { "陥", 0.00000000 },
+  { "河", 0.00020000 },
+  { "賦", 0.00000000 },
+  { "肝", 0.00000000 },
+  { "尚", 0.00000000 },
+  { "昔", 0.00000000 },
+  { "括", 0.00000000 },
+  { "言", 0.00070000 },
+  { "再", 0.00040000 },
+  { "ぼ", 0.00020000 },
+  { "衣", 0.00000000 },
+  { "宮", 0.00030000 },
+  { "益", 0.00010000 },
+  { "載", 0.00040000 },
+  { "瞳", 0.00000000 },
+  { "番", 0.00080000 },
+  { "ば", 0.00120000 },
+  { "悟", 0.00000000 },
+  { "鳴", 0.00000000 },
+  { "裂", 0.00000000 },
+  { "社", 0.00130000 },
+  { "製", 0.00050000 },
+  { "抜", 0.00010000 },
+  { "彰", 0.00000000 },
+  { "就", 0.00020000 },
+  { "青", 0.00020000 },
+  { "職", 0.00020000 },
+  { "尊", 0.00000000 },
+  { "象", 0.00020000 },
+  { "贈", 0.00000000 },
+  { "戻", 0.00010000 },
+  { "鋭", 0.00000000 },
+  { "探", 0.00010000 },
+  { "題", 0.00040000 },
+  { "延", 0.00010000 },
+  { "久", 0.00020000 },
+  { "的", 0.00180000 },
+  { "景", 0.00010000 },
+  { "勧", 0.00000000 },
+  { "泉", 0.00010000 },
+  { "会", 0.00190000 },
+  { "門", 0.00040000 },
+  { "ド", 0.00390000 },
+  { "共", 0.00060000 },
+  { "奨", 0.00000000 },
+  { "祉", 0.00000000 },
+  { "著", 0.00020000 },
+  { "錬", 0.00000000 },
+  { "異", 0.00030000 },
+  { "郵", 0.00000000 },
+  { "配", 0.00040000 },
+  { "希", 0.00000000 },
+  { "隷", 0.00000000 },
+  { "福", 0.00030000 },
+  { "都", 0.00060000 },
+  { "諸", 0.00020000 },
+  { "ち", 0.00140000 },
+  { "嬢", 0.00000000 },
+  { "鉱", 0.00000000 },
+  { "乏", 0.00000000 },
+  { "図", 0.00020000 },
+  { "校", 0.00080000 },
+  { "離", 0.00030000 },
+  { "貪", 0.00000000 },
+  { "メ", 0.00210000 },
+  { "戯", 0.00000000 },
+  { "遅", 0.00010000 },
+  { "妊", 0.00000000 },
+  { "部", 0.00190000 },
+  { "芽", 0.00000000 },
+  { "陛", 0.00000000 },
+  { "演", 0.00060000 },
+  { "劇", 0.00020000 },
+  { "貌", 0.00000000 },
+  { "坑", 0.00000000 },
+  { "討", 0.00010000 },
+  { "倣", 0.00000000 },
+  { "外", 0.00080000 },
+  { "ソ", 0.00090000 },
+  { "真", 0.00030000 },
+  { "膚", 0.00000000 },
+  { "粘", 0.00000000 },
+  { "平", 0.00080000 },
+  { "帆", 0.00000000 },
+  { "防", 0.00020000 },
+  { "惰", 0.00000000 },
+  { "隠", 0.00010000 },
+  { "合", 0.00200000 },
+  { "叙", 0.00000000 },
+  { "憧", 0.00000000 },
+  { "好", 0.00020000 },
+  { "帯", 0.00020000 },
+  { "仲", 0.00010000 },
+  { "群", 0.00010000 },
+  { "資", 0.00030000 },
+  { "植", 0.00010000 },
+  { "瀬", 0.00010000 },
+  { "偵", 0.00000000 },
+  { "発", 0.00200000 },
+  { "収", 0.00040000 },
+  { "滞", 0.00000000 },
+  { "盗", 0.00000000 },
+  { "称", 0.00050000 },
+  { "魚", 0.00010000 },
+  { "船", 0.00020000 },
+  { "問", 0.00040000 },
+  { "患", 0.00000000 },
+  { "箋", 0.00000000 },
+  { "択", 0.00010000 },
+  { "夏", 0.00010000 },
+  { "鮮", 0.00010000 },
+  { "午", 0.00010000 },
+  { "跡", 0.00010000 },
+  { "遭", 0.00000000 },
+  { "濯", 0.00000000 },
+  { "壇", 0.00000000 },
+  { "台", 0.00050000 },
+  { "今", 0.00020000 },
+  { "宣", 0.00010000 },
+  { "フ", 0.00330000 },
+  { "食", 0.00020000 },
+  { "寒", 0.00000000 },
+  { "萎", 0.00000000 },
+  { "ヂ", 0.00000000 },
+  { "冬", 0.00010000 },
+  { "頂", 0.00000000 },
+  { "念", 0.00020000 },
+  { "串", 0.00000000 },
+  { "厚", 0.00010000 },
+  { "肩", 0.00000000 },
+  { "例", 0.00030000 },
+  { "腕", 0.00000000 },
+  { "羞", 0.00000000 },
+  { "茂", 0.00000000 },
+  { "権", 0.00050000 },
+  { "病", 0.00020000 },
+  { "迭", 0.00000000 },
+  { "庸", 0.00000000 },
+  { "駆", 0.00010000 },
+  { "奥", 0.00010000 },
+  { "厳", 0.00010000 },
+  { "輪", 0.00010000 },
+  { "提", 0.00030000 },
+  { "ゝ", 0.00000000 },
+  { "誇", 0.00000000 },
+  { "硝", 0.00000000 },
+  { "齢", 0.00010000 },
+  { "挫", 0.00000000 },
+  { "喪", 0.00000000 },
+  { "像", 0.00020000 },
+  { "ぺ", 0.00000000 },
+  { "褐", 0.00000000 },
+  { "透", 0.00000000 },
+  { "辞", 0.00010000 },
+  { "伯", 0.00010000 },
+  { "婿", 0.00000000 },
+  { "供", 0.00020000 },
+  { "勃", 0.00000000 },
+  { "北", 0.00080000 },
+  { "膳", 0.00000000 },
+  { "宅", 0.00010000 },
+  { "保", 0.00050000 },
+  { "俊", 0.00000000 },
+  { "鈍", 0.00000000 },
+  { "肌", 0.00000000 },
+  { "ひ", 0.00030000 },
+  { "拳", 0.00000000 },
+  { "鈴", 0.00000000 },
+  { "劣", 0.00000000 },
+  { "酸", 0.00010000 },
+  { "岡", 0.00030000 },
+  { "溝", 0.00000000 },
+  { "を", 0.01720000 },
+  { "辺", 0.00020000 },
+  { "腎", 0.00000000 },
+  { "電", 0.00070000 },
+  { "安", 0.00040000 },
+  { "比", 0.00030000 },
+  { "伝", 0.00040000 },
+  { "墾", 0.00000000 },
+  { "槽", 0.00000000 },
+  { "頼", 0.00010000 },
+  { "間", 0.00160000 },
+  { "販", 0.00020000 },
+  { "搾", 0.00000000 },
+  { "叫", 0.00000000 },
+  { "密", 0.00010000 },
+  { "諭", 0.00000000 },
+  { "剛", 0.00000000 },
+  { "嫡", 0.00000000 },
+  { "掛", 0.00010000 },
+  { "魅", 0.00000000 },
+  { "愉", 0.00000000 },
+  { "則", 0.00010000 },
+  { "性", 0.00090000 },
+  { "祖", 0.00010000 },
+  { "稼", 0.00000000 },
+  { "導", 0.00030000 },
+  { "盆", 0.00000000 },
+  { "ぷ", 0.00000000 },
+  { "顎", 0.00000000 },
+  { "鹿", 0.00010000 },
+  { "態", 0.00030000 },
+  { "摯", 0.00000000 },
+  { "編", 0.00040000 },
+  { "烈", 0.00000000 },
+  { "弄", 0.00000000 },
+  { "玩", 0.00000000 },
+  { "池", 0.00010000 },
+  { "蜜", 0.00000000 },
+  { "憶", 0.00000000 },
+  { "因", 0.00010000 },
+  { "印", 0.00010000 },
+  { "呪", 0.00000000 },
+  { "園", 0.00030000 },
+  { "花", 0.00020000 },
+  { "峰", 0.00000000 },
+  { "ピ", 0.00080000 },
+  { "手", 0.00130000 },
+  { "掌", 0.00000000 },
+  { "戚", 0.00000000 },
+  { "句", 0.00000000 },
+  { "字", 0.00030000 },
+  { "蹴", 0.00000000 },
+  { "箸", 0.00000000 },
+  { "端", 0.00020000 },
+  { "替", 0.00010000 },
+  { "骸", 0.00000000 },
+  { "癖", 0.00000000 },
+  { "黄", 0.00010000 },
+  { "倹", 0.00000000 },
+  { "帥", 0.00000000 },
+  { "善", 0.00010000 },
+  { "味", 0.00030000 },
+  { "堆", 0.00000000 },
+  { "愛", 0.00020000 },
+  { "緒", 0.00000000 },
+  { "嘆", 0.00000000 },
+  { "啓", 0.00000000 },
+  { "幻", 0.00000000 },
+  { "矛", 0.00000000 },
+  { "扱", 0.00010000 },
+  { "虫", 0.00010000 },
+  { "分", 0.00150000 },
+  { "滋", 0.00000000 },
+  { "湿", 0.00000000 },
+  { "雅", 0.00000000 },
+  { "栄", 0.00010000 },
+  { "昇", 0.00010000 },
+  { "枚", 0.00010000 },
+  { "貢", 0.00010000 },
+  { "案", 0.00020000 },
+  { "艇", 0.00000000 },
+  { "治", 0.00060000 },
+  { "訟", 0.00000000 },
+  { "履", 0.00000000 },
+  { "圏", 0.00010000 },
+  { "郊", 0.00000000 },
+  { "毛", 0.00010000 },
+  { "ぽ", 0.00000000 },
+  { "癒", 0.00000000 },
+  { "後", 0.00240000 },
+  { "麺", 0.00000000 },
+  { "太", 0.00030000 },
+  { "運", 0.00070000 },
+  { "執", 0.00010000 },
+  { "蒸", 0.00000000 },
+  { "維", 0.00010000 },
+  { "釣", 0.00000000 },
+  { "是", 0.00000000 },
+  { "垣", 0.00000000 },
+  { "兆", 0.00000000 },
+  { "交", 0.00050000 },
+  { "麗", 0.00000000 },
+  { "六", 0.00010000 },
+  { "診", 0.00000000 },
+  { "や", 0.00250000 },
+  { "険", 0.00010000 },
+  { "譲", 0.00010000 },
+  { "り", 0.00670000 },
+  { "唆", 0.00000000 },
+  { "翌", 0.00020000 },
+  { "れ", 0.01280000 },
+  { "弧", 0.00000000 },
+  { "呉", 0.00000000 },
+  { "属", 0.00050000 },
+  { "確", 0.00030000 },
+  { "面", 0.00070000 },
+  { "抱", 0.00000000 },
+  { "画", 0.00090000 },
+  { "札", 0.00010000 },
+  { "沢", 0.00010000 },
+  { "環", 0.00020000 },
+  { "枯", 0.00000000 },
+  { "妄", 0.00000000 },
+  { "航", 0.00030000 },
+  { "昆", 0.00000000 },
+  { "舷", 0.00000000 },
+  { "尺", 0.00000000 },
+  { "賄", 0.00000000 },
+  { "っ", 0.00820000 },
+  { "詔", 0.00000000 },
+  { "ェ", 0.00130000 },
+  { "ヱ", 0.00000000 },
+  { "柳", 0.00000000 },
+  { "害", 0.00020000 },
+  { "暖", 0.00000000 },
+  { "諦", 0.00000000 },
+  { "惧", 0.00000000 },
+  { "沃", 0.00000000 },
+  { "暁", 0.00000000 },
+  { "双", 0.00010000 },
+  { "剖", 0.00000000 },
+  { "兼", 0.00010000 },
+  { "袋", 0.00000000 },
+  { "脅", 0.00000000 },
+  { "侶", 0.00000000 },
+  { "吟", 0.00000000 },
+  { "返", 0.00010000 },
+  { "ぎ", 0.00020000 },
+  { "警", 0.00020000 },
+  { "材", 0.00010000 },
+  { "信", 0.00050000 },
+  { "挨", 0.00000000 },
+  { "達", 0.00030000 },
+  { "連", 0.00090000 },
+  { "貞", 0.00000000 },
+  { "謁", 0.00000000 },
+  { "梨", 0.00000000 },
+  { "諧", 0.00000000 },
+  { "託", 0.00000000 },
+  { "苗", 0.00000000 },
+  { "途", 0.00010000 },
+  { "逃", 0.00010000 },
+  { "涼", 0.00000000 },
+  { "顔", 0.00010000 },
+  { "歓", 0.00000000 },
+  { "貴", 0.00010000 },
+  { "買", 0.00010000 },
+  { "潟", 0.00010000 },
+  { "見", 0.00090000 },
+  { "晴", 0.00000000 },
+  { "借", 0.00000000 },
+  { "禅", 0.00000000 },
+  { "こ", 0.00630000 },
+  { "華", 0.00010000 },
+  { "単", 0.00030000 },
+  { "悲", 0.00000000 },
+  { "ゾ", 0.00010000 },
+  { "ギ", 0.00070000 },
+  { "ょ", 0.00030000 },
+  { "型", 0.00060000 },
+  { "緑", 0.00010000 },
+  { "仏", 0.00010000 },
+  { "休", 0.00010000 },
+  { "録", 0.00050000 },
+  { "事", 0.00150000 },
+  { "ぴ", 0.00000000 },
+  { "踏", 0.00010000 },
+  { "拡", 0.00010000 },
+  { "魔", 0.00010000 },
+  { "建", 0.00050000 },
+  { "敵", 0.00010000 },
+  { "世", 0.00110000 },
+  { "音", 0.00050000 },
+  { "多", 0.00110000 },
+  { "創", 0.00020000 },
+  { "知", 0.00050000 },
+  { "ヮ", 0.00000000 },
+  { "認", 0.00030000 },
+  { "羊", 0.00000000 },
+  { "糾", 0.00000000 },
+  { "鎌", 0.00000000 },
+  { "ず", 0.00090000 },
+  { "恒", 0.00000000 },
+  { "辣", 0.00000000 },
+  { "膝", 0.00000000 },
+  { "軸", 0.00010000 },
+  { "漢", 0.00010000 },
+  { "栽", 0.00000000 },
+  { "醜", 0.00000000 },
+  { "体", 0.00120000 },
+  { "犯", 0.00010000 },
+  { "抗", 0.00010000 },
+  { "宵", 0.00000000 },
+  { "幹", 0.00010000 },
+  { "付", 0.00050000 },
+  { "慎", 0.00000000 },
+  { "況", 0.00010000 },
+  { "空", 0.00060000 },
+  { "衰", 0.00000000 },
+  { "誤", 0.00010000 },
+  { "塑", 0.00000000 },
+  { "響", 0.00020000 },
+  { "他", 0.00050000 },
+  { "賓", 0.00000000 },
+  { "麓", 0.00000000 },
+  { "監", 0.00020000 },
+  { "粛", 0.00000000 },
+  { "憲", 0.00010000 },
+  { "紫", 0.00000000 },
+  { "享", 0.00010000 },
+  { "挙", 0.00030000 },
+  { "皮", 0.00010000 },
+  { "冠", 0.00010000 },
+  { "珍", 0.00000000 },
+  { "嵐", 0.00000000 },
+  { "さ", 0.00730000 },
+  { "敢", 0.00000000 },
+  { "我", 0.00010000 },
+  { "打", 0.00040000 },
+  { "奉", 0.00000000 },
+  { "集", 0.00050000 },
+  { "弥", 0.00000000 },
+  { "血", 0.00010000 },
+  { "研", 0.00030000 },
+  { "翼", 0.00010000 },
+  { "慣", 0.00000000 },
+  { "歯", 0.00000000 },
+  { "店", 0.00030000 },
+  { "赴", 0.00000000 },
+  { "腰", 0.00000000 },
+  { "繭", 0.00000000 },
+  { "造", 0.00050000 },
+  { "島", 0.00080000 },
+  { "憾", 0.00000000 },
+  { "童", 0.00010000 },
+  { "術", 0.00040000 },
+  { "憎", 0.00000000 },
+  { "銭", 0.00000000 },
+  { "詞", 0.00010000 },
+  { "法", 0.00100000 },
+  { "英", 0.00030000 },
+  { "強", 0.00040000 },
+  { "塾", 0.00000000 },
+  { "適", 0.00010000 },
+  { "輸", 0.00020000 },
+  { "度", 0.00100000 },
+  { "陶", 0.00000000 },
+  { "没", 0.00010000 },
+  { "通", 0.00120000 },
+  { "罰", 0.00000000 },
+  { "拝", 0.00000000 },
+  { "擦", 0.00000000 },
+  { "岸", 0.00010000 },
+  { "紛", 0.00000000 },
+  { "寄", 0.00010000 },
+  { "ザ", 0.00060000 },
+  { "選", 0.00090000 },
+  { "曖", 0.00000000 },
+  { "団", 0.00050000 },
+  { "街", 0.00020000 },
+  { "々", 0.00050000 },
+  { "滴", 0.00000000 },
+  { "嫌", 0.00000000 },
+  { "持", 0.00070000 },
+  { "隙", 0.00000000 },
+  { "未", 0.00020000 },
+  { "怨", 0.00000000 },
+  { "ム", 0.00270000 },
+  { "聖", 0.00010000 },
+  { "者", 0.00150000 },
+  { "頻", 0.00000000 },
+  { "家", 0.00110000 },
+  { "聞", 0.00020000 },
+  { "論", 0.00030000 },
+  { "鬱", 0.00000000 },
+  { "評", 0.00020000 },
+  { "指", 0.00060000 },
+  { "揚", 0.00000000 },
+  { "緊", 0.00000000 },
+  { "唄", 0.00000000 },
+  { "酢", 0.00000000 },
+  { "胎", 0.00000000 },
+  { "臼", 0.00000000 },
+  { "捕", 0.00010000 },
+  { "糧", 0.00000000 },
+  { "誌", 0.00020000 },
+  { "稲", 0.00010000 },
+  { "情", 0.00030000 },
+  { "築", 0.00020000 },
+  { "暗", 0.00010000 },
+  { "喉", 0.00000000 },
+  { "ぶ", 0.00040000 },
+  { "映", 0.00040000 },
+  { "頬", 0.00000000 },
+  { "ォ", 0.00050000 },
+  { "定", 0.00150000 },
+  { "乱", 0.00010000 },
+  { "拒", 0.00000000 },
+  { "跳", 0.00000000 },
+  { "八", 0.00020000 },
+  { "甚", 0.00000000 },
+  { "茶", 0.00010000 },
+  { "俵", 0.00000000 },
+  { "冒", 0.00000000 },
+  { "爵", 0.00000000 },
+  { "彙", 0.00000000 },
+  { "稽", 0.00000000 },
+  { "流", 0.00050000 },
+  { "各", 0.00040000 },
+  { "昧", 0.00000000 },
+  { "遵", 0.00000000 },
+  { "争", 0.00030000 },
+  { "長", 0.00140000 },
+  { "伎", 0.00000000 },
+  { "汽", 0.00000000 },
+  { "閲", 0.00000000 },
+  { "昼", 0.00000000 },
+  { "責", 0.00010000 },
+  { "薫", 0.00000000 },
+  { "詮", 0.00000000 },
+  { "訳", 0.00010000 },
+  { "干", 0.00000000 },
+  { "矯", 0.00000000 },
+  { "債", 0.00000000 },
+  { "寸", 0.00000000 },
+  { "獲", 0.00020000 },
+  { "ス", 0.00860000 },
+  { "敏", 0.00000000 },
+  { "笛", 0.00000000 },
+  { "健", 0.00010000 },
+  { "献", 0.00010000 },
+  { "礁", 0.00000000 },
+  { "ぐ", 0.00020000 },
+  { "錯", 0.00000000 },
+  { "最", 0.00110000 },
+  { "駅", 0.00090000 },
+  { "夢", 0.00000000 },
+  { "待", 0.00010000 },
+  { "遮", 0.00000000 },
+  { "厘", 0.00000000 },
+  { "宿", 0.00010000 },
+  { "貸", 0.00000000 },
+  { "豆", 0.00000000 },
+  { "局", 0.00040000 },
+  { "慢", 0.00000000 },
+  { "記", 0.00090000 },
+  { "ね", 0.00020000 },
+  { "宴", 0.00000000 },
+  { "ら", 0.00760000 },
+  { "暫", 0.00000000 },
+  { "慨", 0.00000000 },
+  { "形", 0.00080000 },
+  { "欠", 0.00010000 },
+  { "立", 0.00120000 },
+  { "井", 0.00030000 },
+  { "果", 0.00040000 },
+  { "婆", 0.00000000 },
+  { "炊", 0.00000000 },
+  { "彩", 0.00000000 },
+  { "帰", 0.00020000 },
+  { "眼", 0.00000000 },
+  { "遜", 0.00000000 },
+  { "許", 0.00010000 },
+  { "致", 0.00010000 },
+  { "授", 0.00020000 },
+  { "企", 0.00020000 },
+  { "第", 0.00130000 },
+  { "邪", 0.00000000 },
+  { "謙", 0.00000000 },
+  { "睡", 0.00000000 },
+  { "渓", 0.00000000 },
+  { "峠", 0.00000000 },
+  { "自", 0.00130000 },
+  { "活", 0.00070000 },
+  { "秋", 0.00010000 },
+  { "ヽ", 0.00000000 },
+  { "項", 0.00010000 },
+  { "処", 0.00020000 },
+  { "均", 0.00010000 },
+  { "泊", 0.00000000 },
+  { "卑", 0.00000000 },
+  { "盲", 0.00000000 },
+  { "エ", 0.00170000 },
+  { "裾", 0.00000000 },
+  { "径", 0.00000000 },
+  { "璧", 0.00000000 },
+  { "武", 0.00030000 },
+  { "棄", 0.00000000 },
+  { "虐", 0.00000000 },
+  { "雨", 0.00010000 },
+  { "切", 0.00030000 },
+  { "精", 0.00010000 },
+  { "込", 0.00030000 },
+  { "艦", 0.00040000 },
+  { "従", 0.00020000 },
+  { "暦", 0.00010000 },
+  { "価", 0.00020000 },
+  { "老", 0.00010000 },
+  { "抹", 0.00000000 },
+  { "雪", 0.00010000 },
+  { "穀", 0.00000000 },
+  { "詰", 0.00000000 },
+  { "粗", 0.00000000 },
+  { "震", 0.00010000 },
+  { "褒", 0.00000000 },
+  { "ベ", 0.00100000 },
+  { "奏", 0.00020000 },
+  { "互", 0.00010000 },
+  { "ん", 0.00170000 },
+  { "巻", 0.00020000 },
+  { "貧", 0.00000000 },
+  { "業", 0.00130000 },
+  { "詳", 0.00010000 },
+  { "件", 0.00030000 },
+  { "ナ", 0.00170000 },
+  { "川", 0.00090000 },
+  { "析", 0.00000000 },
+  { "岩", 0.00010000 },
+  { "眺", 0.00000000 },
+  { "磁", 0.00000000 },
+  { "遡", 0.00000000 },
+  { "屯", 0.00000000 },
+  { "如", 0.00000000 },
+  { "町", 0.00060000 },
+  { "刈", 0.00000000 },
+  { "疑", 0.00010000 },
+  { "類", 0.00030000 },
+  { "奪", 0.00010000 },
+  { "凶", 0.00000000 },
+  { "凡", 0.00000000 },
+  { "添", 0.00000000 },
+  { "隣", 0.00010000 },
+  { "線", 0.00130000 },
+  { "刹", 0.00000000 },
+  { "義", 0.00050000 },
+  { "翻", 0.00000000 },
+  { "痕", 0.00000000 },
+  { "短", 0.00020000 },
+  { "餓", 0.00000000 },
+  { "般", 0.00030000 },
+  { "西", 0.00070000 },
+  { "き", 0.00310000 },
+  { "禁", 0.00010000 },
+  { "濁", 0.00000000 },
+  { "調", 0.00040000 },
+  { "頭", 0.00030000 },
+  { "悪", 0.00010000 },
+  { "族", 0.00030000 },
+  { "ろ", 0.00050000 },
+  { "揮", 0.00010000 },
+  { "胸", 0.00000000 },
+  { "鍋", 0.00000000 },
+  { "誰", 0.00000000 },
+  { "且", 0.00000000 },
+  { "竜", 0.00010000 },
+  { "崖", 0.00000000 },
+  { "ー", 0.01880000 },
+  { "弟", 0.00020000 },
+  { "幕", 0.00020000 },
+  { "鉢", 0.00000000 },
+  { "恩", 0.00000000 },
+  { "展", 0.00020000 },
+  { "鯨", 0.00000000 },
+  { "捻", 0.00000000 },
+  { "醸", 0.00000000 },
+  { "狭", 0.00010000 },
+  { "詐", 0.00000000 },
+  { "染", 0.00010000 },
+  { "孤", 0.00000000 },
+  { "婦", 0.00000000 },
+  { "妹", 0.00010000 },
+  { "丼", 0.00000000 },
+  { "糖", 0.00000000 },
+  { "費", 0.00010000 },
+  { "が", 0.01570000 },
+  { "く", 0.00350000 },
+  { "ル", 0.00800000 },
+  { "放", 0.00090000 },
+  { "崩", 0.00010000 },
+  { "瞭", 0.00000000 },
+  { "庁", 0.00010000 },
+  { "幣", 0.00000000 },
+  { "報", 0.00040000 },
+  { "虜", 0.00000000 },
+  { "縄", 0.00010000 },
+  { "閥", 0.00000000 },
+  { "梅", 0.00000000 },
+  { "富", 0.00010000 },
+  { "壁", 0.00010000 },
+  { "筋", 0.00000000 },
+  { "汁", 0.00000000 },
+  { "彼", 0.00040000 },
+  { "膜", 0.00000000 },
+  { "浸", 0.00000000 },
+  { "難", 0.00020000 },
+  { "凸", 0.00000000 },
+  { "湯", 0.00000000 },
+  { "語", 0.00090000 },
+  { "迫", 0.00000000 },
+  { "て", 0.01630000 },
+  { "匿", 0.00000000 },
+  { "栃", 0.00000000 },
+  { "車", 0.00140000 },
+  { "段", 0.00020000 },
+  { "募", 0.00000000 },
+  { "暴", 0.00010000 },
+  { "脈", 0.00000000 },
+  { "桑", 0.00000000 },
+  { "媒", 0.00000000 },
+  { "燃", 0.00010000 },
+  { "誕", 0.00010000 },
+  { "組", 0.00080000 },
+  { "具", 0.00010000 },
+  { "ヤ", 0.00050000 },
+  { "名", 0.00170000 },
+  { "計", 0.00050000 },
+  { "吉", 0.00020000 },
+  { "曲", 0.00050000 },
+  { "忌", 0.00000000 },
+  { "注", 0.00010000 },
+  { "了", 0.00020000 },
+  { "班", 0.00000000 },
+  { "芳", 0.00000000 },
+  { "楼", 0.00000000 },
+  { "割", 0.00020000 },
+  { "数", 0.00100000 },
+  { "亜", 0.00010000 },
+  { "羨", 0.00000000 },
+  { "封", 0.00010000 },
+  { "暇", 0.00000000 },
+  { "誉", 0.00000000 },
+  { "陳", 0.00000000 },
+  { "鶏", 0.00000000 },
+  { "舟", 0.00000000 },
+  { "律", 0.00010000 },
+  { "固", 0.00010000 },
+  { "薪", 0.00000000 },
+  { "豪", 0.00010000 },
+  { "コ", 0.00220000 },
+  { "せ", 0.00120000 },
+  { "曽", 0.00000000 },
+  { "覚", 0.00010000 },
+  { "嗅", 0.00000000 },
+  { "柔", 0.00000000 },
+  { "重", 0.00060000 },
+  { "上", 0.00200000 },
+  { "璃", 0.00000000 },
+  { "影", 0.00030000 },
+  { "消", 0.00020000 },
+  { "脚", 0.00010000 },
+  { "慌", 0.00000000 },
+  { "撲", 0.00000000 },
+  { "壮", 0.00000000 },
+  { "悼", 0.00000000 },
+  { "ホ", 0.00060000 },
+  { "堪", 0.00000000 },
+  { "較", 0.00010000 },
+  { "誠", 0.00000000 },
+  { "鼓", 0.00000000 },
+  { "紀", 0.00040000 },
+  { "蛍", 0.00000000 },
+  { "春", 0.00010000 },
+  { "装", 0.00040000 },
+  { "乞", 0.00000000 },
+  { "壱", 0.00000000 },
+  { "館", 0.00030000 },
+  { "畝", 0.00000000 },
+  { "済", 0.00020000 },
+  { "懸", 0.00000000 },
+  { "浜", 0.00020000 },
+  { "尻", 0.00000000 },
+  { "決", 0.00050000 },
+  { "チ", 0.00180000 },
+  { "酵", 0.00000000 },
+  { "改", 0.00050000 },
+  { "凝", 0.00000000 },
+  { "与", 0.00030000 },
+  { "勝", 0.00070000 },
+  { "説", 0.00040000 },
+  { "査", 0.00020000 },
+  { "質", 0.00030000 },
+  { "化", 0.00110000 },
+  { "俺", 0.00000000 },
+  { "捉", 0.00000000 },
+  { "と", 0.01870000 },
+  { "恣", 0.00000000 },
+  { "勅", 0.00000000 },
+  { "郷", 0.00010000 },
+  { "勢", 0.00020000 },
+  { "顧", 0.00000000 },
+  { "含", 0.00030000 },
+  { "咲", 0.00000000 },
+  { "ヴ", 0.00080000 },
+  { "妻", 0.00010000 },
+  { "用", 0.00210000 },
+  { "遇", 0.00000000 },
+  { "辱", 0.00000000 },
+  { "郡", 0.00030000 },
+  { "塊", 0.00000000 },
+  { "紡", 0.00000000 },
+  { "技", 0.00030000 },
+  { "遊", 0.00010000 },
+  { "虞", 0.00000000 },
+  { "釜", 0.00000000 },
+  { "券", 0.00010000 },
+  { "庫", 0.00010000 },
+  { "彫", 0.00000000 },
+  { "網", 0.00000000 },
+  { "狙", 0.00000000 },
+  { "ガ", 0.00090000 },
+  { "服", 0.00010000 },
+  { "噴", 0.00000000 },
+  { "号", 0.00070000 },
+  { "犠", 0.00000000 },
+  { "構", 0.00040000 },
+  { "偶", 0.00000000 },
+  { "還", 0.00010000 },
+  { "ヅ", 0.00000000 },
+  { "韻", 0.00000000 },
+  { "盾", 0.00000000 },
+  { "銅", 0.00000000 },
+  { "襲", 0.00010000 },
+  { "妨", 0.00000000 },
+  { "姫", 0.00000000 },
+  { "臨", 0.00010000 },
+  { "障", 0.00010000 },
+  { "沼", 0.00010000 },
+  { "孝", 0.00000000 },
+  { "汎", 0.00000000 },
+  { "本", 0.00320000 },
+  { "ゞ", 0.00000000 },
+  { "科", 0.00040000 },
+  { "蚕", 0.00000000 },
+  { "耕", 0.00000000 },
+  { "脂", 0.00000000 },
+  { "煩", 0.00000000 },
+  { "油", 0.00010000 },
+  { "増", 0.00030000 },
+  { "津", 0.00020000 },
+  { "広", 0.00050000 },
+  { "小", 0.00090000 },
+  { "イ", 0.00630000 },
+  { "博", 0.00020000 },
+  { "碑", 0.00000000 },
+  { "お", 0.00260000 },
+  { "ぬ", 0.00000000 },
+  { "よ", 0.00430000 },
+  { "ヌ", 0.00020000 },
+  { "岬", 0.00000000 },
+  { "忘", 0.00000000 },
+  { "等", 0.00060000 },
+  { "繁", 0.00010000 },
+  { "筒", 0.00000000 },
+  { "失", 0.00020000 },
+  { "光", 0.00030000 },
+  { "仁", 0.00010000 },
+  { "究", 0.00030000 },
+  { "大", 0.00380000 },
+  { "志", 0.00010000 },
+  { "ヾ", 0.00000000 },
+  { "路", 0.00060000 },
+  { "微", 0.00000000 },
+  { "攻", 0.00030000 },
+  { "膨", 0.00000000 },
+  { "思", 0.00020000 },
+  { "倉", 0.00010000 },
+  { "詩", 0.00010000 },
+  { "否", 0.00010000 },
+  { "緻", 0.00000000 },
+  { "衝", 0.00010000 },
+  { "唇", 0.00000000 },
+  { "低", 0.00020000 },
+  { "頑", 0.00000000 },
+  { "陪", 0.00000000 },
+  { "痴", 0.00000000 },
+  { "届", 0.00000000 },
+  { "衷", 0.00000000 },
+  { "椎", 0.00000000 },
+  { "窯", 0.00000000 },
+  { "裸", 0.00000000 },
+  { "郎", 0.00020000 },
+  { "蓄", 0.00000000 },
+  { "木", 0.00040000 },
+  { "息", 0.00010000 },
+  { "呈", 0.00000000 },
+  { "刺", 0.00000000 },
+  { "百", 0.00010000 },
+  { "慈", 0.00000000 },
+  { "偽", 0.00000000 },
+  { "儀", 0.00010000 },
+  { "斉", 0.00000000 },
+  { "紋", 0.00000000 },
+  { "灰", 0.00000000 },
+  { "死", 0.00040000 },
+  { "南", 0.00060000 },
+  { "哀", 0.00000000 },
+  { "倫", 0.00000000 },
+  { "漫", 0.00010000 },
+  { "脇", 0.00000000 },
+  { "嘱", 0.00000000 },
+  { "陽", 0.00010000 },
+  { "絡", 0.00010000 },
+  { "産", 0.00050000 },
+  { "縛", 0.00000000 },
+  { "睦", 0.00000000 },
+  { "絵", 0.00010000 },
+  { "脊", 0.00000000 },
+  { "租", 0.00000000 },
+  { "進", 0.00060000 },
+  { "慶", 0.00010000 },
+  { "板", 0.00020000 },
+  { "峡", 0.00000000 },
+  { "旬", 0.00000000 },
+  { "に", 0.02690000 },
+  { "荒", 0.00000000 },
+  { "球", 0.00040000 },
+  { "閉", 0.00010000 },
+  { "掲", 0.00010000 },
+  { "軌", 0.00010000 },
+  { "便", 0.00010000 },
+  { "軍", 0.00100000 },
+  { "皇", 0.00030000 },
+  { "五", 0.00020000 },
+  { "璽", 0.00000000 },
+  { "樹", 0.00010000 },
+  { "崇", 0.00000000 },
+  { "委", 0.00020000 },
+  { "敗", 0.00030000 },
+  { "清", 0.00020000 },
+  { "心", 0.00050000 },
+  { "時", 0.00230000 },
+  { "洗", 0.00000000 },
+  { "帝", 0.00030000 },
+  { "裁", 0.00010000 },
+  { "戒", 0.00000000 },
+  { "ヵ", 0.00000000 },
+  { "協", 0.00020000 },
+  { "然", 0.00020000 },
+  { "猫", 0.00000000 },
+  { "優", 0.00050000 },
+  { "浮", 0.00000000 },
+  { "籍", 0.00020000 },
+  { "紺", 0.00000000 },
+  { "す", 0.00590000 },
+  { "僅", 0.00000000 },
+  { "退", 0.00040000 },
+  { "浅", 0.00010000 },
+  { "洋", 0.00020000 },
+  { "系", 0.00060000 },
+  { "宛", 0.00000000 },
+  { "教", 0.00080000 },
+  { "唐", 0.00000000 },
+  { "藍", 0.00000000 },
+  { "転", 0.00050000 },
+  { "巡", 0.00010000 },
+  { "器", 0.00030000 },
+  { "戴", 0.00000000 },
+  { "政", 0.00080000 },
+  { "采", 0.00000000 },
+  { "ゑ", 0.00000000 },
+  { "絶", 0.00010000 },
+  { "ヰ", 0.00000000 },
+  { "骨", 0.00010000 },
+  { "亭", 0.00000000 },
+  { "傾", 0.00010000 },
+  { "賃", 0.00000000 },
+  { "薬", 0.00010000 },
+  { "士", 0.00040000 },
+  { "林", 0.00010000 },
+  { "近", 0.00060000 },
+  { "寝", 0.00000000 },
+  { "受", 0.00070000 },
+  { "諮", 0.00000000 },
+  { "列", 0.00040000 },
+  { "底", 0.00010000 },
+  { "潜", 0.00010000 },
+  { "包", 0.00000000 },
+  { "客", 0.00020000 },
+  { "恨", 0.00000000 },
+  { "淡", 0.00000000 },
+  { "騰", 0.00000000 },
+  { "模", 0.00020000 },
+  { "弁", 0.00010000 },
+  { "測", 0.00010000 },
+  { "怪", 0.00010000 },
+  { "寂", 0.00000000 },
+  { "明", 0.00080000 },
+  { "主", 0.00120000 },
+  { "絹", 0.00000000 },
+  { "国", 0.00270000 },
+  { "礎", 0.00000000 },
+  { "胴", 0.00000000 },
+  { "穴", 0.00000000 },
+  { "鶴", 0.00000000 },
+  { "繕", 0.00000000 },
+  { "財", 0.00010000 },
+  { "私", 0.00010000 },
+  { "玄", 0.00000000 },
+  { "批", 0.00010000 },
+  { "留", 0.00020000 },
+  { "嫁", 0.00000000 },
+  { "毎", 0.00020000 },
+  { "汚", 0.00000000 },
+  { "相", 0.00050000 },
+  { "あ", 0.00760000 },
+  { "げ", 0.00060000 },
+  { "浦", 0.00010000 },
+  { "岳", 0.00000000 },
+  { "騒", 0.00000000 },
+  { "友", 0.00010000 },
+  { "慄", 0.00000000 },
+  { "錮", 0.00000000 },
+  { "原", 0.00070000 },
+  { "耐", 0.00000000 },
+  { "壌", 0.00000000 },
+  { "喫", 0.00000000 },
+  { "バ", 0.00230000 },
+  { "葉", 0.00020000 },
+  { "断", 0.00020000 },
+  { "滝", 0.00000000 },
+  { "胞", 0.00010000 },
+  { "拷", 0.00000000 },
+  { "諾", 0.00000000 },
+  { "ペ", 0.00060000 },
+  { "束", 0.00000000 },
+  { "渉", 0.00000000 },
+  { "硫", 0.00000000 },
+  { "ぞ", 0.00020000 },
+  { "畔", 0.00000000 },
+  { "仮", 0.00010000 },
+  { "穏", 0.00000000 },
+  { "嚇", 0.00000000 },
+  { "席", 0.00020000 },
+  { "綱", 0.00010000 },
+  { "文", 0.00080000 },
+  { "及", 0.00030000 },
+  { "グ", 0.00230000 },
+  { "弾", 0.00020000 },
+  { "右", 0.00020000 },
+  { "塩", 0.00010000 },
+  { "摘", 0.00000000 },
+  { "稿", 0.00000000 },
+  { "伺", 0.00000000 },
+  { "着", 0.00040000 },
+  { "捗", 0.00000000 },
+  { "域", 0.00040000 },
+  { "敬", 0.00000000 },
+  { "カ", 0.00290000 },
+  { "軒", 0.00000000 },
+  { "粒", 0.00000000 },
+  { "茨", 0.00000000 },
+  { "ゥ", 0.00010000 },
+  { "党", 0.00040000 },
+  { "田", 0.00100000 },
+  { "市", 0.00150000 },
+  { "迅", 0.00000000 },
+  { "廷", 0.00000000 },
+  { "物", 0.00100000 },
+  { "腐", 0.00000000 },
+  { "餌", 0.00000000 },
+  { "傷", 0.00010000 },
+  { "額", 0.00010000 },
+  { "徒", 0.00010000 },
+  { "侍", 0.00000000 },
+  { "限", 0.00030000 },
+  { "キ", 0.00150000 },
+  { "溶", 0.00000000 },
+  { "歩", 0.00010000 },
+  { "掃", 0.00000000 },
+  { "温", 0.00010000 },
+  { "秩", 0.00000000 },
+  { "叔", 0.00000000 },
+  { "係", 0.00030000 },
+  { "湖", 0.00010000 },
+  { "描", 0.00010000 },
+  { "漏", 0.00000000 },
+  { "素", 0.00020000 },
+  { "脳", 0.00000000 },
+  { "舗", 0.00010000 },
+  { "口", 0.00050000 },
+  { "惑", 0.00010000 },
+  { "猶", 0.00000000 },
+  { "準", 0.00030000 },
+  { "設", 0.00120000 },
+  { "モ", 0.00100000 },
+  { "節", 0.00010000 },
+  { "冷", 0.00010000 },
+  { "サ", 0.00180000 },
+  { "俗", 0.00000000 },
+  { "弱", 0.00010000 },
+  { "騎", 0.00010000 },
+  { "式", 0.00090000 },
+  { "触", 0.00010000 },
+  { "挑", 0.00010000 },
+  { "踪", 0.00000000 },
+  { "坊", 0.00000000 },
+  { "墜", 0.00000000 },
+  { "堕", 0.00000000 },
+  { "惨", 0.00000000 },
+  { "助", 0.00020000 },
+  { "ゲ", 0.00060000 },
+  { "制", 0.00080000 },
+  { "奴", 0.00000000 },
+  { "界", 0.00060000 },
+  { "腹", 0.00000000 },
+  { "朕", 0.00000000 },
+  { "芝", 0.00000000 },
+  { "順", 0.00010000 },
+  { "豚", 0.00000000 },
+  { "即", 0.00010000 },
+  { "殺", 0.00020000 },
+  { "匠", 0.00000000 },
+  { "握", 0.00000000 },
+  { "半", 0.00040000 },
+  { "裕", 0.00000000 },
+  { "抑", 0.00010000 },
+  { "奇", 0.00000000 },
+  { "須", 0.00010000 },
+  { "谷", 0.00020000 },
+  { "魂", 0.00000000 },
+  { "声", 0.00020000 },
+  { "措", 0.00000000 },
+  { "朱", 0.00000000 },
+  { "写", 0.00010000 },
+  { "控", 0.00000000 },
+  { "細", 0.00020000 },
+  { "作", 0.00190000 },
+  { "静", 0.00010000 },
+  { "祭", 0.00010000 },
+  { "全", 0.00110000 },
+  { "寧", 0.00000000 },
+  { "僕", 0.00000000 },
+  { "姉", 0.00000000 },
+  { "淫", 0.00000000 },
+  { "飼", 0.00000000 },
+  { "料", 0.00030000 },
+  { "競", 0.00030000 },
+  { "斗", 0.00000000 },
+  { "ビ", 0.00160000 },
+  { "訃", 0.00000000 },
+  { "表", 0.00100000 },
+  { "廊", 0.00000000 },
+  { "胃", 0.00000000 },
+  { "炉", 0.00000000 },
+  { "稚", 0.00000000 },
+  { "緩", 0.00000000 },
+  { "曇", 0.00000000 },
+  { "湧", 0.00000000 },
+  { "頃", 0.00020000 },
+  { "苛", 0.00000000 },
+  { "飛", 0.00020000 },
+  { "願", 0.00010000 },
+  { "腫", 0.00000000 },
+  { "想", 0.00020000 },
+  { "咽", 0.00000000 },
+  { "貝", 0.00000000 },
+  { "鬼", 0.00000000 },
+  { "紳", 0.00000000 },
+  { "良", 0.00020000 },
+  { "弦", 0.00000000 },
+  { "有", 0.00060000 },
+  { "呂", 0.00000000 },
+  { "日", 0.00480000 },
+  { "下", 0.00120000 },
+  { "窟", 0.00000000 },
+  { "匹", 0.00000000 },
+  { "続", 0.00070000 },
+  { "伴", 0.00020000 },
+  { "憂", 0.00000000 },
+  { "換", 0.00020000 },
+  { "撮", 0.00010000 },
+  { "じ", 0.00110000 },
+  { "拓", 0.00000000 },
+  { "塞", 0.00000000 },
+  { "同", 0.00170000 },
+  { "水", 0.00070000 },
+  { "拉", 0.00000000 },
+  { "肉", 0.00010000 },
+  { "シ", 0.00380000 },
+  { "ヨ", 0.00030000 },
+  { "出", 0.00220000 },
+  { "索", 0.00000000 },
+  { "踊", 0.00000000 },
+  { "購", 0.00010000 },
+  { "侯", 0.00000000 },
+  { "視", 0.00020000 },
+  { "え", 0.00210000 },
+  { "弓", 0.00000000 },
+  { "ヲ", 0.00000000 },
+  { "美", 0.00030000 },
+  { "以", 0.00130000 },
+  { "理", 0.00080000 },
+  { "労", 0.00010000 },
+  { "七", 0.00010000 },
+  { "蓋", 0.00000000 },
+  { "渇", 0.00000000 },
+  { "居", 0.00010000 },
+  { "滅", 0.00010000 },
+  { "候", 0.00010000 },
+  { "古", 0.00040000 },
+  { "簡", 0.00010000 },
+  { "開", 0.00140000 },
+  { "臭", 0.00000000 },
+  { "為", 0.00020000 },
+  { "己", 0.00000000 },
+  { "窮", 0.00000000 },
+  { "矢", 0.00000000 },
+  { "鳥", 0.00010000 },
+  { "棚", 0.00000000 },
+  { "妬", 0.00000000 },
+  { "し", 0.01730000 },
+  { "黒", 0.00020000 },
+  { "野", 0.00070000 },
+  { "代", 0.00190000 },
+  { "火", 0.00020000 },
+  { "売", 0.00060000 },
+  { "箇", 0.00000000 },
+  { "泥", 0.00000000 },
+  { "奔", 0.00000000 },
+  { "囚", 0.00000000 },
+  { "棋", 0.00000000 },
+  { "命", 0.00040000 },
+  { "閣", 0.00010000 },
+  { "僚", 0.00000000 },
+  { "ッ", 0.00470000 },
+  { "瑠", 0.00000000 },
+  { "耗", 0.00000000 },
+  { "妃", 0.00000000 },
+  { "複", 0.00020000 },
+  { "徳", 0.00020000 },
+  { "粉", 0.00000000 },
+  { "検", 0.00020000 },
+  { "譜", 0.00000000 },
+  { "沙", 0.00000000 },
+  { "棺", 0.00000000 },
+  { "ネ", 0.00100000 },
+  { "奈", 0.00010000 },
+  { "邦", 0.00010000 },
+  { "色", 0.00030000 },
+  { "抄", 0.00000000 },
+  { "岐", 0.00010000 },
+  { "当", 0.00120000 },
+  { "訪", 0.00010000 },
+  { "必", 0.00030000 },
+  { "衡", 0.00000000 },
+  { "若", 0.00020000 },
+  { "ツ", 0.00090000 },
+  { "炎", 0.00000000 },
+  { "率", 0.00030000 },
+  { "枠", 0.00010000 },
+  { "専", 0.00020000 },
+  { "謝", 0.00000000 },
+  { "得", 0.00050000 },
+  { "廉", 0.00000000 },
+  { "故", 0.00010000 },
+  { "援", 0.00010000 },
+  { "徹", 0.00000000 },
+  { "ァ", 0.00080000 },
+  { "公", 0.00080000 },
+  { "史", 0.00030000 },
+  { "怒", 0.00000000 },
+  { "早", 0.00010000 },
+  { "納", 0.00010000 },
+  { "麦", 0.00000000 },
+  { "哺", 0.00000000 },
+  { "観", 0.00030000 },
+  { "痛", 0.00000000 },
+  { "肺", 0.00000000 },
+  { "ロ", 0.00330000 },
+  { "ゅ", 0.00010000 },
+  { "波", 0.00020000 },
+  { "住", 0.00030000 },
+  { "参", 0.00050000 },
+  { "三", 0.00070000 },
+  { "所", 0.00110000 },
+  { "窓", 0.00010000 },
+  { "紙", 0.00010000 },
+  { "動", 0.00130000 },
+  { "漠", 0.00000000 },
+  { "ハ", 0.00100000 },
+  { "望", 0.00010000 },
+  { "缶", 0.00000000 },
+  { "卸", 0.00000000 },
+  { "レ", 0.00320000 },
+  { "勤", 0.00010000 },
+  { "芯", 0.00000000 },
+  { "征", 0.00010000 },
+  { "菌", 0.00000000 },
+  { "埼", 0.00000000 },
+  { "審", 0.00010000 },
+  { "潤", 0.00000000 },
+  { "刀", 0.00000000 },
+  { "斥", 0.00000000 },
+  { "珠", 0.00000000 },
+  { "い", 0.01560000 },
+  { "の", 0.03940000 },
+  { "酷", 0.00000000 },
+  { "看", 0.00000000 },
+  { "兄", 0.00010000 },
+  { "霧", 0.00000000 },
+  { "来", 0.00070000 },
+  { "軽", 0.00010000 },
+  { "銃", 0.00010000 },
+  { "燥", 0.00000000 },
+  { "貼", 0.00000000 },
+  { "軟", 0.00000000 },
+  { "坂", 0.00010000 },
+  { "容", 0.00030000 },
+  { "藻", 0.00000000 },
+  { "め", 0.00340000 },
+  { "酔", 0.00000000 },
+  { "僧", 0.00000000 },
+  { "孔", 0.00000000 },
+  { "闇", 0.00000000 },
+  { "縦", 0.00000000 },
+  { "韓", 0.00010000 },
+  { "約", 0.00050000 },
+  { "使", 0.00080000 },
+  { "旦", 0.00000000 },
+  { "冶", 0.00000000 },
+  { "別", 0.00050000 },
+  { "藤", 0.00030000 },
+  { "搬", 0.00000000 },
+  { "励", 0.00000000 },
+  { "轄", 0.00000000 },
+  { "仙", 0.00010000 },
+  { "唯", 0.00010000 },
+  { "へ", 0.00100000 },
+  { "帳", 0.00000000 },
+  { "捨", 0.00000000 },
+  { "剣", 0.00000000 },
+  { "位", 0.00090000 },
+  { "拘", 0.00000000 },
+  { "猟", 0.00000000 },
+  { "ダ", 0.00140000 },
+  { "杉", 0.00010000 },
+  { "熟", 0.00000000 },
+  { "恵", 0.00010000 },
+  { "飾", 0.00010000 },
+  { "ワ", 0.00070000 },
+  { "官", 0.00030000 },
+  { "慰", 0.00000000 },
+  { "尋", 0.00000000 },
+  { "落", 0.00020000 },
+  { "松", 0.00030000 },
+  { "ズ", 0.00150000 },
+  { "ボ", 0.00080000 },
+  { "醒", 0.00000000 },
+  { "拍", 0.00000000 },
+  { "ヘ", 0.00030000 },
+  { "殉", 0.00000000 },
+  { "枕", 0.00000000 },
+  { "寡", 0.00000000 },
+  { "携", 0.00010000 },
+  { "男", 0.00040000 },
+  { "ャ", 0.00170000 },
+};
+
+const wa_cp_freq ALPHA_118_FREQ_CPS[] = {
+  { 0x3005u, 0.00050000 },
+  { 0x3041u, 0.00000000 },
+  { 0x3042u, 0.00760000 },
+  { 0x3043u, 0.00000000 },
+  { 0x3044u, 0.01560000 },
+  { 0x3045u, 0.00000000 },
+  { 0x3046u, 0.00460000 },
+  { 0x3047u, 0.00000000 },
+  { 0x3048u, 0.00210000 },
+  { 0x3049u, 0.00000000 },
+  { 0x304Au, 0.00260000 },
+  { 0x304Bu, 0.00760000 },
+  { 0x304Cu, 0.01570000 },
+  { 0x304Du, 0.00310000 },
+  { 0x304Eu, 0.00020000 },
+  { 0x304Fu, 0.00350000 },
+  { 0x3050u, 0.00020000 },
+  { 0x3051u, 0.00280000 },
+  { 0x3052u, 0.00060000 },
+  { 0x3053u, 0.00630000 },
+  { 0x3054u, 0.00030000 },
+  { 0x3055u, 0.00730000 },
+  { 0x3056u, 0.00010000 },
+  { 0x3057u, 0.01730000 },
+  { 0x3058u, 0.00110000 },
+  { 0x3059u, 0.00590000 },
+  { 0x305Au, 0.00090000 },
+  { 0x305Bu, 0.00120000 },
+  { 0x305Cu, 0.00010000 },
+  { 0x305Du, 0.00300000 },
+  { 0x305Eu, 0.00020000 },
+  { 0x305Fu, 0.02140000 },
+  { 0x3060u, 0.00180000 },
+  { 0x3061u, 0.00140000 },
+  { 0x3062u, 0.00000000 },
+  { 0x3063u, 0.00820000 },
+  { 0x3064u, 0.00240000 },
+  { 0x3065u, 0.00020000 },
+  { 0x3066u, 0.01630000 },
+  { 0x3067u, 0.01690000 },
+  { 0x3068u, 0.01870000 },
+  { 0x3069u, 0.00250000 },
+  { 0x306Au, 0.01210000 },
+  { 0x306Bu, 0.02690000 },
+  { 0x306Cu, 0.00000000 },
+  { 0x306Du, 0.00020000 },
+  { 0x306Eu, 0.03940000 },
+  { 0x306Fu, 0.02060000 },
+  { 0x3070u, 0.00120000 },
+  { 0x3071u, 0.00000000 },
+  { 0x3072u, 0.00030000 },
+  { 0x3073u, 0.00090000 },
+  { 0x3074u, 0.00000000 },
+  { 0x3075u, 0.00010000 },
+  { 0x3076u, 0.00040000 },
+  { 0x3077u, 0.00000000 },
+  { 0x3078u, 0.00100000 },
+  { 0x3079u, 0.00040000 },
+  { 0x307Au, 0.00000000 },
+  { 0x307Bu, 0.00070000 },
+  { 0x307Cu, 0.00020000 },
+  { 0x307Du, 0.00000000 },
+  { 0x307Eu, 0.00440000 },
+  { 0x307Fu, 0.00130000 },
+  { 0x3080u, 0.00040000 },
+  { 0x3081u, 0.00340000 },
+  { 0x3082u, 0.00690000 },
+  { 0x3083u, 0.00010000 },
+  { 0x3084u, 0.00250000 },
+  { 0x3085u, 0.00010000 },
+  { 0x3086u, 0.00020000 },
+  { 0x3087u, 0.00030000 },
+  { 0x3088u, 0.00430000 },
+  { 0x3089u, 0.00760000 },
+  { 0x308Au, 0.00670000 },
+  { 0x308Bu, 0.02200000 },
+  { 0x308Cu, 0.01280000 },
+  { 0x308Du, 0.00050000 },
+  { 0x308Eu, 0.00000000 },
+  { 0x308Fu, 0.00220000 },
+  { 0x3090u, 0.00000000 },
+  { 0x3091u, 0.00000000 },
+  { 0x3092u, 0.01720000 },
+  { 0x3093u, 0.00170000 },
+  { 0x309Du, 0.00000000 },
+  { 0x309Eu, 0.00000000 },
+  { 0x30A1u, 0.00080000 },
+  { 0x30A2u, 0.00570000 },
+  { 0x30A3u, 0.00240000 },
+  { 0x30A4u, 0.00630000 },
+  { 0x30A5u, 0.00010000 },
+  { 0x30A6u, 0.00190000 },
+  { 0x30A7u, 0.00130000 },
+  { 0x30A8u, 0.00170000 },
+  { 0x30A9u, 0.00050000 },
+  { 0x30AAu, 0.00210000 },
+  { 0x30ABu, 0.00290000 },
+  { 0x30ACu, 0.00090000 },
+  { 0x30ADu, 0.00150000 },
+  { 0x30AEu, 0.00070000 },
+  { 0x30AFu, 0.00450000 },
+  { 0x30B0u, 0.00230000 },
+  { 0x30B1u, 0.00070000 },
+  { 0x30B2u, 0.00060000 },
+  { 0x30B3u, 0.00220000 },
+  { 0x30B4u, 0.00050000 },
+  { 0x30B5u, 0.00180000 },
+  { 0x30B6u, 0.00060000 },
+  { 0x30B7u, 0.00380000 },
+  { 0x30B8u, 0.00300000 },
+  { 0x30B9u, 0.00860000 },
+  { 0x30BAu, 0.00150000 },
+  { 0x30BBu, 0.00100000 },
+  { 0x30BCu, 0.00030000 },
+  { 0x30BDu, 0.00090000 },
+  { 0x30BEu, 0.00010000 },
+  { 0x30BFu, 0.00350000 },
+  { 0x30C0u, 0.00140000 },
+  { 0x30C1u, 0.00180000 },
+  { 0x30C2u, 0.00000000 },
+  { 0x30C3u, 0.00470000 },
+  { 0x30C4u, 0.00090000 },
+  { 0x30C5u, 0.00000000 },
+  { 0x30C6u, 0.00260000 },
+  { 0x30C7u, 0.00220000 },
+  { 0x30C8u, 0.00660000 },
+  { 0x30C9u, 0.00390000 },
+  { 0x30CAu, 0.00170000 },
+  { 0x30CBu, 0.00180000 },
+  { 0x30CCu, 0.00020000 },
+  { 0x30CDu, 0.00100000 },
+  { 0x30CEu, 0.00080000 },
+  { 0x30CFu, 0.00100000 },
+  { 0x30D0u, 0.00230000 },
+  { 0x30D1u, 0.00150000 },
+  { 0x30D2u, 0.00040000 },
+  { 0x30D3u, 0.00160000 },
+  { 0x30D4u, 0.00080000 },
+  { 0x30D5u, 0.00330000 },
+  { 0x30D6u, 0.00170000 },
+  { 0x30D7u, 0.00250000 },
+  { 0x30D8u, 0.00030000 },
+  { 0x30D9u, 0.00100000 },
+  { 0x30DAu, 0.00060000 },
+  { 0x30DBu, 0.00060000 },
+  { 0x30DCu, 0.00080000 },
+  { 0x30DDu, 0.00090000 },
+  { 0x30DEu, 0.00240000 },
+  { 0x30DFu, 0.00120000 },
+  { 0x30E0u, 0.00270000 },
+  { 0x30E1u, 0.00210000 },
+  { 0x30E2u, 0.00100000 },
+  { 0x30E3u, 0.00170000 },
+  { 0x30E4u, 0.00050000 },
+  { 0x30E5u, 0.00180000 },
+  { 0x30E6u, 0.00030000 },
+  { 0x30E7u, 0.00110000 },
+  { 0x30E8u, 0.00030000 },
+  { 0x30E9u, 0.00550000 },
+  { 0x30EAu, 0.00610000 },
+  { 0x30EBu, 0.00800000 },
+  { 0x30ECu, 0.00320000 },
+  { 0x30EDu, 0.00330000 },
+  { 0x30EEu, 0.00000000 },
+  { 0x30EFu, 0.00070000 },
+  { 0x30F0u, 0.00000000 },
+  { 0x30F1u, 0.00000000 },
+  { 0x30F2u, 0.00000000 },
+  { 0x30F3u, 0.01370000 },
+  { 0x30F4u, 0.00080000 },
+  { 0x30F5u, 0.00000000 },
+  { 0x30F6u, 0.00010000 },
+  { 0x30FCu, 0.01880000 },
+  { 0x30FDu, 0.00000000 },
+  { 0x30FEu, 0.00000000 },
+  { 0x4E00u, 0.00250000 },
+  { 0x4E01u, 0.00010000 },
+  { 0x4E03u, 0.00010000 },
+  { 0x4E07u, 0.00040000 },
+  { 0x4E08u, 0.00000000 },
+  { 0x4E09u, 0.00070000 },
+  { 0x4E0Au, 0.00200000 },
+  { 0x4E0Bu, 0.00120000 },
+  { 0x4E0Du, 0.00050000 },
+  { 0x4E0Eu, 0.00030000 },
+  { 0x4E14u, 0.00000000 },
+  { 0x4E16u, 0.00110000 },
+  { 0x4E18u, 0.00010000 },
+  { 0x4E19u, 0.00000000 },
+  { 0x4E21u, 0.00050000 },
+  { 0x4E26u, 0.00010000 },
+  { 0x4E2Du, 0.00260000 },
+  { 0x4E32u, 0.00000000 },
+  { 0x4E38u, 0.00010000 },
+  { 0x4E39u, 0.00000000 },
+  { 0x4E3Bu, 0.00120000 },
+  { 0x4E3Cu, 0.00000000 },
+  { 0x4E45u, 0.00020000 },
+  { 0x4E4Fu, 0.00000000 },
+  { 0x4E57u, 0.00040000 },
+  { 0x4E59u, 0.00000000 },
+  { 0x4E5Du, 0.00010000 },
+  { 0x4E5Eu, 0.00000000 },
+  { 0x4E71u, 0.00010000 },
+  { 0x4E73u, 0.00000000 },
+  { 0x4E7Eu, 0.00000000 },
+  { 0x4E80u, 0.00000000 },
+  { 0x4E86u, 0.00020000 },
+  { 0x4E88u, 0.00030000 },
+  { 0x4E89u, 0.00030000 },
+  { 0x4E8Bu, 0.00150000 },
+  { 0x4E8Cu, 0.00050000 },
+  { 0x4E92u, 0.00010000 },
+  { 0x4E94u, 0.00020000 },
+  { 0x4E95u, 0.00030000 },
+  { 0x4E9Cu, 0.00010000 },
+  { 0x4EA1u, 0.00010000 },
+  { 0x4EA4u, 0.00050000 },
+  { 0x4EABu, 0.00010000 },
+  { 0x4EACu, 0.00070000 },
+  { 0x4EADu, 0.00000000 },
+  { 0x4EBAu, 0.00290000 },
+  { 0x4EC1u, 0.00010000 },
+  { 0x4ECAu, 0.00020000 },
+  { 0x4ECBu, 0.00010000 },
+  { 0x4ECFu, 0.00010000 },
+  { 0x4ED5u, 0.00020000 },
+  { 0x4ED6u, 0.00050000 },
+  { 0x4ED8u, 0.00050000 },
+  { 0x4ED9u, 0.00010000 },
+  { 0x4EE3u, 0.00190000 },
+  { 0x4EE4u, 0.00020000 },
+  { 0x4EE5u, 0.00130000 },
+  { 0x4EEEu, 0.00010000 },
+  { 0x4EF0u, 0.00000000 },
+  { 0x4EF2u, 0.00010000 },
+  { 0x4EF6u, 0.00030000 },
+  { 0x4EFBu, 0.00050000 },
+  { 0x4F01u, 0.00020000 },
+  { 0x4F0Eu, 0.00000000 },
+  { 0x4F0Fu, 0.00000000 },
+  { 0x4F10u, 0.00000000 },
+  { 0x4F11u, 0.00010000 },
+  { 0x4F1Au, 0.00190000 },
+  { 0x4F1Du, 0.00040000 },
+  { 0x4F2Fu, 0.00010000 },
+  { 0x4F34u, 0.00020000 },
+  { 0x4F38u, 0.00010000 },
+  { 0x4F3Au, 0.00000000 },
+  { 0x4F3Cu, 0.00010000 },
+  { 0x4F46u, 0.00000000 },
+  { 0x4F4Du, 0.00090000 },
+  { 0x4F4Eu, 0.00020000 },
+  { 0x4F4Fu, 0.00030000 },
+  { 0x4F50u, 0.00020000 },
+  { 0x4F53u, 0.00120000 },
+  { 0x4F55u, 0.00010000 },
+  { 0x4F59u, 0.00010000 },
+  { 0x4F5Cu, 0.00190000 },
+  { 0x4F73u, 0.00000000 },
+  { 0x4F75u, 0.00020000 },
+  { 0x4F7Fu, 0.00080000 },
+  { 0x4F8Bu, 0.00030000 },
+  { 0x4F8Du, 0.00000000 },
+  { 0x4F9Bu, 0.00020000 },
+  { 0x4F9Du, 0.00010000 },
+  { 0x4FA1u, 0.00020000 },
+  { 0x4FAEu, 0.00000000 },
+  { 0x4FAFu, 0.00000000 },
+  { 0x4FB5u, 0.00010000 },
+  { 0x4FB6u, 0.00000000 },
+  { 0x4FBFu, 0.00010000 },
+  { 0x4FC2u, 0.00030000 },
+  { 0x4FC3u, 0.00000000 },
+  { 0x4FCAu, 0.00000000 },
+  { 0x4FD7u, 0.00000000 },
+  { 0x4FDDu, 0.00050000 },
+  { 0x4FE1u, 0.00050000 },
+  { 0x4FEEu, 0.00020000 },
+  { 0x4FF3u, 0.00010000 },
+  { 0x4FF5u, 0.00000000 },
+  { 0x4FF8u, 0.00000000 },
+  { 0x4FFAu, 0.00000000 },
+  { 0x5009u, 0.00010000 },
+  { 0x500Bu, 0.00020000 },
+  { 0x500Du, 0.00010000 },
+  { 0x5012u, 0.00010000 },
+  { 0x5019u, 0.00010000 },
+  { 0x501Fu, 0.00000000 },
+  { 0x5023u, 0.00000000 },
+  { 0x5024u, 0.00010000 },
+  { 0x502Bu, 0.00000000 },
+  { 0x5039u, 0.00000000 },
+  { 0x5049u, 0.00000000 },
+  { 0x504Fu, 0.00000000 },
+  { 0x505Cu, 0.00020000 },
+  { 0x5065u, 0.00010000 },
+  { 0x5074u, 0.00040000 },
+  { 0x5075u, 0.00000000 },
+  { 0x5076u, 0.00000000 },
+  { 0x507Du, 0.00000000 },
+  { 0x508Du, 0.00000000 },
+  { 0x5091u, 0.00000000 },
+  { 0x5098u, 0.00000000 },
+  { 0x5099u, 0.00040000 },
+  { 0x50ACu, 0.00020000 },
+  { 0x50B2u, 0.00000000 },
+  { 0x50B5u, 0.00000000 },
+  { 0x50B7u, 0.00010000 },
+  { 0x50BEu, 0.00010000 },
+  { 0x50C5u, 0.00000000 },
+  { 0x50CDu, 0.00010000 },
+  { 0x50CFu, 0.00020000 },
+  { 0x50D5u, 0.00000000 },
+  { 0x50DAu, 0.00000000 },
+  { 0x50E7u, 0.00000000 },
+  { 0x5100u, 0.00010000 },
+  { 0x5104u, 0.00010000 },
+  { 0x5112u, 0.00000000 },
+  { 0x511Fu, 0.00000000 },
+  { 0x512Au, 0.00050000 },
+  { 0x5143u, 0.00070000 },
+  { 0x5144u, 0.00010000 },
+  { 0x5145u, 0.00010000 },
+  { 0x5146u, 0.00000000 },
+  { 0x5148u, 0.00040000 },
+  { 0x5149u, 0.00030000 },
+  { 0x514Bu, 0.00000000 },
+  { 0x514Du, 0.00010000 },
+  { 0x5150u, 0.00010000 },
+  { 0x515Au, 0.00040000 },
+  { 0x5165u, 0.00140000 },
+  { 0x5168u, 0.00110000 },
+  { 0x516Bu, 0.00020000 },
+  { 0x516Cu, 0.00080000 },
+  { 0x516Du, 0.00010000 },
+  { 0x5171u, 0.00060000 },
+  { 0x5175u, 0.00030000 },
+  { 0x5177u, 0.00010000 },
+  { 0x5178u, 0.00010000 },
+  { 0x517Cu, 0.00010000 },
+  { 0x5185u, 0.00130000 },
+  { 0x5186u, 0.00020000 },
+  { 0x518Au, 0.00000000 },
+  { 0x518Du, 0.00040000 },
+  { 0x5192u, 0.00000000 },
+  { 0x5197u, 0.00000000 },
+  { 0x5199u, 0.00010000 },
+  { 0x51A0u, 0.00010000 },
+  { 0x51A5u, 0.00000000 },
+  { 0x51ACu, 0.00010000 },
+  { 0x51B6u, 0.00000000 },
+  { 0x51B7u, 0.00010000 },
+  { 0x51C4u, 0.00000000 },
+  { 0x51C6u, 0.00000000 },
+  { 0x51CDu, 0.00000000 },
+  { 0x51DDu, 0.00000000 },
+  { 0x51E1u, 0.00000000 },
+  { 0x51E6u, 0.00020000 },
+  { 0x51F6u, 0.00000000 },
+  { 0x51F8u, 0.00000000 },
+  { 0x51F9u, 0.00000000 },
+  { 0x51FAu, 0.00220000 },
+  { 0x5200u, 0.00000000 },
+  { 0x5203u, 0.00000000 },
+  { 0x5206u, 0.00150000 },
+  { 0x5207u, 0.00030000 },
+  { 0x5208u, 0.00000000 },
+  { 0x520Au, 0.00020000 },
+  { 0x5211u, 0.00010000 },
+  { 0x5217u, 0.00040000 },
+  { 0x521Du, 0.00110000 },
+  { 0x5224u, 0.00030000 },
+  { 0x5225u, 0.00050000 },
+  { 0x5229u, 0.00060000 },
+  { 0x5230u, 0.00010000 },
+  { 0x5236u, 0.00080000 },
+  { 0x5237u, 0.00000000 },
+  { 0x5238u, 0.00010000 },
+  { 0x5239u, 0.00000000 },
+  { 0x523Au, 0.00000000 },
+  { 0x523Bu, 0.00010000 },
+  { 0x5247u, 0.00010000 },
+  { 0x524Au, 0.00000000 },
+  { 0x524Du, 0.00130000 },
+  { 0x5256u, 0.00000000 },
+  { 0x525Bu, 0.00000000 },
+  { 0x5263u, 0.00000000 },
+  { 0x5264u, 0.00000000 },
+  { 0x5265u, 0.00000000 },
+  { 0x526Fu, 0.00010000 },
+  { 0x5270u, 0.00000000 },
+  { 0x5272u, 0.00020000 },
+  { 0x5275u, 0.00020000 },
+  { 0x5287u, 0.00020000 },
+  { 0x529Bu, 0.00090000 },
+  { 0x529Fu, 0.00020000 },
+  { 0x52A0u, 0.00070000 },
+  { 0x52A3u, 0.00000000 },
+  { 0x52A9u, 0.00020000 },
+  { 0x52AAu, 0.00000000 },
+  { 0x52B1u, 0.00000000 },
+  { 0x52B4u, 0.00010000 },
+  { 0x52B9u, 0.00020000 },
+  { 0x52BEu, 0.00000000 },
+  { 0x52C3u, 0.00000000 },
+  { 0x52C5u, 0.00000000 },
+  { 0x52C7u, 0.00000000 },
+  { 0x52C9u, 0.00000000 },
+  { 0x52D5u, 0.00130000 },
+  { 0x52D8u, 0.00000000 },
+  { 0x52D9u, 0.00060000 },
+  { 0x52DDu, 0.00070000 },
+  { 0x52DFu, 0.00000000 },
+  { 0x52E2u, 0.00020000 },
+  { 0x52E4u, 0.00010000 },
+  { 0x52E7u, 0.00000000 },
+  { 0x52F2u, 0.00000000 },
+  { 0x52FEu, 0.00000000 },
+  { 0x5302u, 0.00000000 },
+  { 0x5305u, 0.00000000 },
+  { 0x5316u, 0.00110000 },
+  { 0x5317u, 0.00080000 },
+  { 0x5320u, 0.00000000 },
+  { 0x5339u, 0.00000000 },
+  { 0x533Au, 0.00070000 },
+  { 0x533Bu, 0.00010000 },
+  { 0x533Fu, 0.00000000 },
+  { 0x5341u, 0.00020000 },
+  { 0x5343u, 0.00020000 },
+  { 0x5347u, 0.00000000 },
+  { 0x5348u, 0.00010000 },
+  { 0x534Au, 0.00040000 },
+  { 0x5351u, 0.00000000 },
+  { 0x5352u, 0.00020000 },
+  { 0x5353u, 0.00000000 },
+  { 0x5354u, 0.00020000 },
+  { 0x5357u, 0.00060000 },
+  { 0x5358u, 0.00030000 },
+  { 0x535Au, 0.00020000 },
+  { 0x5360u, 0.00010000 },
+  { 0x5370u, 0.00010000 },
+  { 0x5371u, 0.00010000 },
+  { 0x5373u, 0.00010000 },
+  { 0x5374u, 0.00010000 },
+  { 0x5375u, 0.00000000 },
+  { 0x5378u, 0.00000000 },
+  { 0x5384u, 0.00000000 },
+  { 0x5398u, 0.00000000 },
+  { 0x539Au, 0.00010000 },
+  { 0x539Fu, 0.00070000 },
+  { 0x53B3u, 0.00010000 },
+  { 0x53BBu, 0.00020000 },
+  { 0x53C2u, 0.00050000 },
+  { 0x53C8u, 0.00000000 },
+  { 0x53CAu, 0.00030000 },
+  { 0x53CBu, 0.00010000 },
+  { 0x53CCu, 0.00010000 },
+  { 0x53CDu, 0.00040000 },
+  { 0x53CEu, 0.00040000 },
+  { 0x53D4u, 0.00000000 },
+  { 0x53D6u, 0.00060000 },
+  { 0x53D7u, 0.00070000 },
+  { 0x53D9u, 0.00000000 },
+  { 0x53E3u, 0.00050000 },
+  { 0x53E4u, 0.00040000 },
+  { 0x53E5u, 0.00000000 },
+  { 0x53EBu, 0.00000000 },
+  { 0x53ECu, 0.00000000 },
+  { 0x53EFu, 0.00040000 },
+  { 0x53F0u, 0.00050000 },
+  { 0x53F1u, 0.00000000 },
+  { 0x53F2u, 0.00030000 },
+  { 0x53F3u, 0.00020000 },
+  { 0x53F7u, 0.00070000 },
+  { 0x53F8u, 0.00020000 },
+  { 0x5404u, 0.00040000 },
+  { 0x5408u, 0.00200000 },
+  { 0x5409u, 0.00020000 },
+  { 0x540Cu, 0.00170000 },
+  { 0x540Du, 0.00170000 },
+  { 0x540Eu, 0.00000000 },
+  { 0x540Fu, 0.00000000 },
+  { 0x5410u, 0.00000000 },
+  { 0x5411u, 0.00050000 },
+  { 0x541Bu, 0.00010000 },
+  { 0x541Fu, 0.00000000 },
+  { 0x5426u, 0.00010000 },
+  { 0x542Bu, 0.00030000 },
+  { 0x5438u, 0.00010000 },
+  { 0x5439u, 0.00000000 },
+  { 0x5442u, 0.00000000 },
+  { 0x5448u, 0.00000000 },
+  { 0x5449u, 0.00000000 },
+  { 0x544Au, 0.00020000 },
+  { 0x5468u, 0.00030000 },
+  { 0x546Au, 0.00000000 },
+  { 0x5473u, 0.00030000 },
+  { 0x547Cu, 0.00060000 },
+  { 0x547Du, 0.00040000 },
+  { 0x548Cu, 0.00090000 },
+  { 0x54B2u, 0.00000000 },
+  { 0x54BDu, 0.00000000 },
+  { 0x54C0u, 0.00000000 },
+  { 0x54C1u, 0.00070000 },
+  { 0x54E1u, 0.00070000 },
+  { 0x54F2u, 0.00010000 },
+  { 0x54FAu, 0.00000000 },
+  { 0x5504u, 0.00000000 },
+  { 0x5506u, 0.00000000 },
+  { 0x5507u, 0.00000000 },
+  { 0x5510u, 0.00000000 },
+  { 0x552Fu, 0.00010000 },
+  { 0x5531u, 0.00010000 },
+  { 0x553Eu, 0.00000000 },
+  { 0x5546u, 0.00030000 },
+  { 0x554Fu, 0.00040000 },
+  { 0x5553u, 0.00000000 },
+  { 0x5584u, 0.00010000 },
+  { 0x5589u, 0.00000000 },
+  { 0x559Au, 0.00000000 },
+  { 0x559Cu, 0.00010000 },
+  { 0x559Du, 0.00000000 },
+  { 0x55A9u, 0.00000000 },
+  { 0x55AAu, 0.00000000 },
+  { 0x55ABu, 0.00000000 },
+  { 0x55B6u, 0.00040000 },
+  { 0x55C5u, 0.00000000 },
+  { 0x55E3u, 0.00000000 },
+  { 0x5606u, 0.00000000 },
+  { 0x5631u, 0.00000000 },
+  { 0x5632u, 0.00000000 },
+  { 0x5668u, 0.00030000 },
+  { 0x5674u, 0.00000000 },
+  { 0x5687u, 0.00000000 },
+  { 0x56DAu, 0.00000000 },
+  { 0x56DBu, 0.00020000 },
+  { 0x56DEu, 0.00080000 },
+  { 0x56E0u, 0.00010000 },
+  { 0x56E3u, 0.00050000 },
+  { 0x56F0u, 0.00010000 },
+  { 0x56F2u, 0.00010000 },
+  { 0x56F3u, 0.00020000 },
+  { 0x56FAu, 0.00010000 },
+  { 0x56FDu, 0.00270000 },
+  { 0x570Fu, 0.00010000 },
+  { 0x5712u, 0.00030000 },
+  { 0x571Fu, 0.00030000 },
+  { 0x5727u, 0.00020000 },
+  { 0x5728u, 0.00130000 },
+  { 0x5730u, 0.00210000 },
+  { 0x5742u, 0.00010000 },
+  { 0x5747u, 0.00010000 },
+  { 0x574Au, 0.00000000 },
+  { 0x5751u, 0.00000000 },
+  { 0x576Au, 0.00000000 },
+  { 0x5782u, 0.00000000 },
+  { 0x578Bu, 0.00060000 },
+  { 0x57A3u, 0.00000000 },
+  { 0x57CBu, 0.00000000 },
+  { 0x57CEu, 0.00040000 },
+  { 0x57DFu, 0.00040000 },
+  { 0x57F7u, 0.00010000 },
+  { 0x57F9u, 0.00000000 },
+  { 0x57FAu, 0.00050000 },
+  { 0x57FCu, 0.00000000 },
+  { 0x5800u, 0.00000000 },
+  { 0x5802u, 0.00010000 },
+  { 0x5805u, 0.00000000 },
+  { 0x5806u, 0.00000000 },
+  { 0x5815u, 0.00000000 },
+  { 0x5824u, 0.00000000 },
+  { 0x582Au, 0.00000000 },
+  { 0x5831u, 0.00040000 },
+  { 0x5834u, 0.00180000 },
+  { 0x5840u, 0.00000000 },
+  { 0x5841u, 0.00010000 },
+  { 0x584Au, 0.00000000 },
+  { 0x5851u, 0.00000000 },
+  { 0x5854u, 0.00010000 },
+  { 0x5857u, 0.00000000 },
+  { 0x585Au, 0.00010000 },
+  { 0x585Eu, 0.00000000 },
+  { 0x5869u, 0.00010000 },
+  { 0x586Bu, 0.00000000 },
+  { 0x587Eu, 0.00000000 },
+  { 0x5883u, 0.00020000 },
+  { 0x5893u, 0.00000000 },
+  { 0x5897u, 0.00030000 },
+  { 0x589Cu, 0.00000000 },
+  { 0x58A8u, 0.00000000 },
+  { 0x58B3u, 0.00000000 },
+  { 0x58BEu, 0.00000000 },
+  { 0x58C1u, 0.00010000 },
+  { 0x58C7u, 0.00000000 },
+  { 0x58CAu, 0.00010000 },
+  { 0x58CCu, 0.00000000 },
+  { 0x58EBu, 0.00040000 },
+  { 0x58EEu, 0.00000000 },
+  { 0x58F0u, 0.00020000 },
+  { 0x58F1u, 0.00000000 },
+  { 0x58F2u, 0.00060000 },
+  { 0x5909u, 0.00060000 },
+  { 0x590Fu, 0.00010000 },
+  { 0x5915u, 0.00000000 },
+  { 0x5916u, 0.00080000 },
+  { 0x591Au, 0.00110000 },
+  { 0x591Cu, 0.00010000 },
+  { 0x5922u, 0.00000000 },
+  { 0x5927u, 0.00380000 },
+  { 0x5929u, 0.00050000 },
+  { 0x592Au, 0.00030000 },
+  { 0x592Bu, 0.00020000 },
+  { 0x592Eu, 0.00020000 },
+  { 0x5931u, 0.00020000 },
+  { 0x5947u, 0.00000000 },
+  { 0x5948u, 0.00010000 },
+  { 0x5949u, 0.00000000 },
+  { 0x594Fu, 0.00020000 },
+  { 0x5951u, 0.00010000 },
+  { 0x5954u, 0.00000000 },
+  { 0x5965u, 0.00010000 },
+  { 0x5968u, 0.00000000 },
+  { 0x596Au, 0.00010000 },
+  { 0x596Eu, 0.00000000 },
+  { 0x5973u, 0.00060000 },
+  { 0x5974u, 0.00000000 },
+  { 0x597Du, 0.00020000 },
+  { 0x5982u, 0.00000000 },
+  { 0x5983u, 0.00000000 },
+  { 0x5984u, 0.00000000 },
+  { 0x598Au, 0.00000000 },
+  { 0x5996u, 0.00000000 },
+  { 0x5999u, 0.00000000 },
+  { 0x59A5u, 0.00000000 },
+  { 0x59A8u, 0.00000000 },
+  { 0x59ACu, 0.00000000 },
+  { 0x59B9u, 0.00010000 },
+  { 0x59BBu, 0.00010000 },
+  { 0x59C9u, 0.00000000 },
+  { 0x59CBu, 0.00060000 },
+  { 0x59D3u, 0.00000000 },
+  { 0x59D4u, 0.00020000 },
+  { 0x59EBu, 0.00000000 },
+  { 0x59FBu, 0.00000000 },
+  { 0x59FFu, 0.00010000 },
+  { 0x5A01u, 0.00000000 },
+  { 0x5A18u, 0.00010000 },
+  { 0x5A20u, 0.00000000 },
+  { 0x5A2Fu, 0.00000000 },
+  { 0x5A46u, 0.00000000 },
+  { 0x5A5Au, 0.00010000 },
+  { 0x5A66u, 0.00000000 },
+  { 0x5A7Fu, 0.00000000 },
+  { 0x5A92u, 0.00000000 },
+  { 0x5A9Bu, 0.00000000 },
+  { 0x5AC1u, 0.00000000 },
+  { 0x5AC9u, 0.00000000 },
+  { 0x5ACCu, 0.00000000 },
+  { 0x5AE1u, 0.00000000 },
+  { 0x5B22u, 0.00000000 },
+  { 0x5B50u, 0.00130000 },
+  { 0x5B54u, 0.00000000 },
+  { 0x5B57u, 0.00030000 },
+  { 0x5B58u, 0.00050000 },
+  { 0x5B5Du, 0.00000000 },
+  { 0x5B63u, 0.00010000 },
+  { 0x5B64u, 0.00000000 },
+  { 0x5B66u, 0.00250000 },
+  { 0x5B6Bu, 0.00010000 },
+  { 0x5B85u, 0.00010000 },
+  { 0x5B87u, 0.00020000 },
+  { 0x5B88u, 0.00020000 },
+  { 0x5B89u, 0.00040000 },
+  { 0x5B8Cu, 0.00030000 },
+  { 0x5B97u, 0.00020000 },
+  { 0x5B98u, 0.00030000 },
+  { 0x5B99u, 0.00010000 },
+  { 0x5B9Au, 0.00150000 },
+  { 0x5B9Bu, 0.00000000 },
+  { 0x5B9Cu, 0.00000000 },
+  { 0x5B9Du, 0.00010000 },
+  { 0x5B9Fu, 0.00090000 },
+  { 0x5BA2u, 0.00020000 },
+  { 0x5BA3u, 0.00010000 },
+  { 0x5BA4u, 0.00020000 },
+  { 0x5BAEu, 0.00030000 },
+  { 0x5BB0u, 0.00000000 },
+  { 0x5BB3u, 0.00020000 },
+  { 0x5BB4u, 0.00000000 },
+  { 0x5BB5u, 0.00000000 },
+  { 0x5BB6u, 0.00110000 },
+  { 0x5BB9u, 0.00030000 },
+  { 0x5BBFu, 0.00010000 },
+  { 0x5BC2u, 0.00000000 },
+  { 0x5BC4u, 0.00010000 },
+  { 0x5BC6u, 0.00010000 },
+  { 0x5BCCu, 0.00010000 },
+  { 0x5BD2u, 0.00000000 },
+  { 0x5BDBu, 0.00010000 },
+  { 0x5BDDu, 0.00000000 },
+  { 0x5BDFu, 0.00010000 },
+  { 0x5BE1u, 0.00000000 },
+  { 0x5BE7u, 0.00000000 },
+  { 0x5BE9u, 0.00010000 },
+  { 0x5BEEu, 0.00000000 },
+  { 0x5BF8u, 0.00000000 },
+  { 0x5BFAu, 0.00020000 },
+  { 0x5BFEu, 0.00120000 },
+  { 0x5BFFu, 0.00000000 },
+  { 0x5C01u, 0.00010000 },
+  { 0x5C02u, 0.00020000 },
+  { 0x5C04u, 0.00020000 },
+  { 0x5C06u, 0.00020000 },
+  { 0x5C09u, 0.00000000 },
+  { 0x5C0Au, 0.00000000 },
+  { 0x5C0Bu, 0.00000000 },
+  { 0x5C0Eu, 0.00030000 },
+  { 0x5C0Fu, 0.00090000 },
+  { 0x5C11u, 0.00040000 },
+  { 0x5C1Au, 0.00000000 },
+  { 0x5C31u, 0.00020000 },
+  { 0x5C3Au, 0.00000000 },
+  { 0x5C3Bu, 0.00000000 },
+  { 0x5C3Cu, 0.00000000 },
+  { 0x5C3Du, 0.00000000 },
+  { 0x5C3Eu, 0.00010000 },
+  { 0x5C3Fu, 0.00000000 },
+  { 0x5C40u, 0.00040000 },
+  { 0x5C45u, 0.00010000 },
+  { 0x5C48u, 0.00000000 },
+  { 0x5C4Au, 0.00000000 },
+  { 0x5C4Bu, 0.00030000 },
+  { 0x5C55u, 0.00020000 },
+  { 0x5C5Eu, 0.00050000 },
+  { 0x5C64u, 0.00010000 },
+  { 0x5C65u, 0.00000000 },
+  { 0x5C6Fu, 0.00000000 },
+  { 0x5C71u, 0.00110000 },
+  { 0x5C90u, 0.00010000 },
+  { 0x5CA1u, 0.00030000 },
+  { 0x5CA9u, 0.00010000 },
+  { 0x5CACu, 0.00000000 },
+  { 0x5CB3u, 0.00000000 },
+  { 0x5CB8u, 0.00010000 },
+  { 0x5CE0u, 0.00000000 },
+  { 0x5CE1u, 0.00000000 },
+  { 0x5CF0u, 0.00000000 },
+  { 0x5CF6u, 0.00080000 },
+  { 0x5D07u, 0.00000000 },
+  { 0x5D0Eu, 0.00020000 },
+  { 0x5D16u, 0.00000000 },
+  { 0x5D29u, 0.00010000 },
+  { 0x5D50u, 0.00000000 },
+  { 0x5DDDu, 0.00090000 },
+  { 0x5DDEu, 0.00060000 },
+  { 0x5DE1u, 0.00010000 },
+  { 0x5DE3u, 0.00000000 },
+  { 0x5DE5u, 0.00050000 },
+  { 0x5DE6u, 0.00020000 },
+  { 0x5DE7u, 0.00000000 },
+  { 0x5DE8u, 0.00010000 },
+  { 0x5DEEu, 0.00020000 },
+  { 0x5DF1u, 0.00000000 },
+  { 0x5DFBu, 0.00020000 },
+  { 0x5DFEu, 0.00000000 },
+  { 0x5E02u, 0.00150000 },
+  { 0x5E03u, 0.00010000 },
+  { 0x5E06u, 0.00000000 },
+  { 0x5E0Cu, 0.00000000 },
+  { 0x5E1Du, 0.00030000 },
+  { 0x5E25u, 0.00000000 },
+  { 0x5E2Bu, 0.00030000 },
+  { 0x5E2Du, 0.00020000 },
+  { 0x5E2Fu, 0.00020000 },
+  { 0x5E30u, 0.00020000 },
+  { 0x5E33u, 0.00000000 },
+  { 0x5E38u, 0.00040000 },
+  { 0x5E3Du, 0.00000000 },
+  { 0x5E45u, 0.00010000 },
+  { 0x5E55u, 0.00020000 },
+  { 0x5E63u, 0.00000000 },
+  { 0x5E72u, 0.00000000 },
+  { 0x5E73u, 0.00080000 },
+  { 0x5E74u, 0.01030000 },
+  { 0x5E78u, 0.00010000 },
+  { 0x5E79u, 0.00010000 },
+  { 0x5E7Bu, 0.00000000 },
+  { 0x5E7Cu, 0.00010000 },
+  { 0x5E7Du, 0.00000000 },
+  { 0x5E7Eu, 0.00000000 },
+  { 0x5E81u, 0.00010000 },
+  { 0x5E83u, 0.00050000 },
+  { 0x5E8Au, 0.00000000 },
+  { 0x5E8Fu, 0.00000000 },
+  { 0x5E95u, 0.00010000 },
+  { 0x5E97u, 0.00030000 },
+  { 0x5E9Cu, 0.00040000 },
+  { 0x5EA6u, 0.00100000 },
+  { 0x5EA7u, 0.00020000 },
+  { 0x5EABu, 0.00010000 },
+  { 0x5EADu, 0.00010000 },
+  { 0x5EB6u, 0.00000000 },
+  { 0x5EB7u, 0.00010000 },
+  { 0x5EB8u, 0.00000000 },
+  { 0x5EC3u, 0.00020000 },
+  { 0x5EC9u, 0.00000000 },
+  { 0x5ECAu, 0.00000000 },
+  { 0x5EF6u, 0.00010000 },
+  { 0x5EF7u, 0.00000000 },
+  { 0x5EFAu, 0.00050000 },
+  { 0x5F01u, 0.00010000 },
+  { 0x5F04u, 0.00000000 },
+  { 0x5F0Au, 0.00000000 },
+  { 0x5F0Fu, 0.00090000 },
+  { 0x5F10u, 0.00000000 },
+  { 0x5F13u, 0.00000000 },
+  { 0x5F14u, 0.00000000 },
+  { 0x5F15u, 0.00040000 },
+  { 0x5F1Fu, 0.00020000 },
+  { 0x5F25u, 0.00000000 },
+  { 0x5F26u, 0.00000000 },
+  { 0x5F27u, 0.00000000 },
+  { 0x5F31u, 0.00010000 },
+  { 0x5F35u, 0.00020000 },
+  { 0x5F37u, 0.00040000 },
+  { 0x5F3Eu, 0.00020000 },
+  { 0x5F53u, 0.00120000 },
+  { 0x5F59u, 0.00000000 },
+  { 0x5F62u, 0.00080000 },
+  { 0x5F69u, 0.00000000 },
+  { 0x5F6Bu, 0.00000000 },
+  { 0x5F70u, 0.00000000 },
+  { 0x5F71u, 0.00030000 },
+  { 0x5F79u, 0.00040000 },
+  { 0x5F7Cu, 0.00040000 },
+  { 0x5F80u, 0.00000000 },
+  { 0x5F81u, 0.00010000 },
+  { 0x5F84u, 0.00000000 },
+  { 0x5F85u, 0.00010000 },
+  { 0x5F8Bu, 0.00010000 },
+  { 0x5F8Cu, 0.00240000 },
+  { 0x5F90u, 0.00000000 },
+  { 0x5F92u, 0.00010000 },
+  { 0x5F93u, 0.00020000 },
+  { 0x5F97u, 0.00050000 },
+  { 0x5FA1u, 0.00020000 },
+  { 0x5FA9u, 0.00030000 },
+  { 0x5FAAu, 0.00000000 },
+  { 0x5FAEu, 0.00000000 },
+  { 0x5FB3u, 0.00020000 },
+  { 0x5FB4u, 0.00010000 },
+  { 0x5FB9u, 0.00000000 },
+  { 0x5FC3u, 0.00050000 },
+  { 0x5FC5u, 0.00030000 },
+  { 0x5FCCu, 0.00000000 },
+  { 0x5FCDu, 0.00000000 },
+  { 0x5FD7u, 0.00010000 },
+  { 0x5FD8u, 0.00000000 },
+  { 0x5FD9u, 0.00000000 },
+  { 0x5FDCu, 0.00030000 },
+  { 0x5FE0u, 0.00010000 },
+  { 0x5FEBu, 0.00010000 },
+  { 0x5FF5u, 0.00020000 },
+  { 0x6012u, 0.00000000 },
+  { 0x6016u, 0.00000000 },
+  { 0x601Du, 0.00020000 },
+  { 0x6020u, 0.00000000 },
+  { 0x6025u, 0.00030000 },
+  { 0x6027u, 0.00090000 },
+  { 0x6028u, 0.00000000 },
+  { 0x602Au, 0.00010000 },
+  { 0x604Bu, 0.00000000 },
+  { 0x6050u, 0.00010000 },
+  { 0x6052u, 0.00000000 },
+  { 0x6063u, 0.00000000 },
+  { 0x6065u, 0.00000000 },
+  { 0x6068u, 0.00000000 },
+  { 0x6069u, 0.00000000 },
+  { 0x606Du, 0.00000000 },
+  { 0x606Fu, 0.00010000 },
+  { 0x6075u, 0.00010000 },
+  { 0x6094u, 0.00000000 },
+  { 0x609Fu, 0.00000000 },
+  { 0x60A0u, 0.00000000 },
+  { 0x60A3u, 0.00000000 },
+  { 0x60A6u, 0.00000000 },
+  { 0x60A9u, 0.00000000 },
+  { 0x60AAu, 0.00010000 },
+  { 0x60B2u, 0.00000000 },
+  { 0x60BCu, 0.00000000 },
+  { 0x60C5u, 0.00030000 },
+  { 0x60D1u, 0.00010000 },
+  { 0x60DCu, 0.00000000 },
+  { 0x60E7u, 0.00000000 },
+  { 0x60E8u, 0.00000000 },
+  { 0x60F0u, 0.00000000 },
+  { 0x60F3u, 0.00020000 },
+  { 0x6101u, 0.00000000 },
+  { 0x6109u, 0.00000000 },
+  { 0x610Fu, 0.00060000 },
+  { 0x611Au, 0.00000000 },
+  { 0x611Bu, 0.00020000 },
+  { 0x611Fu, 0.00020000 },
+  { 0x6144u, 0.00000000 },
+  { 0x6148u, 0.00000000 },
+  { 0x614Bu, 0.00030000 },
+  { 0x614Cu, 0.00000000 },
+  { 0x614Eu, 0.00000000 },
+  { 0x6155u, 0.00000000 },
+  { 0x6162u, 0.00000000 },
+  { 0x6163u, 0.00000000 },
+  { 0x6168u, 0.00000000 },
+  { 0x616Eu, 0.00000000 },
+  { 0x6170u, 0.00000000 },
+  { 0x6176u, 0.00010000 },
+  { 0x6182u, 0.00000000 },
+  { 0x618Eu, 0.00000000 },
+  { 0x61A4u, 0.00000000 },
+  { 0x61A7u, 0.00000000 },
+  { 0x61A9u, 0.00000000 },
+  { 0x61ACu, 0.00000000 },
+  { 0x61B2u, 0.00010000 },
+  { 0x61B6u, 0.00000000 },
+  { 0x61BEu, 0.00000000 },
+  { 0x61C7u, 0.00000000 },
+  { 0x61D0u, 0.00000000 },
+  { 0x61F2u, 0.00000000 },
+  { 0x61F8u, 0.00000000 },
+  { 0x6210u, 0.00160000 },
+  { 0x6211u, 0.00010000 },
+  { 0x6212u, 0.00000000 },
+  { 0x621Au, 0.00000000 },
+  { 0x6226u, 0.00190000 },
+  { 0x622Fu, 0.00000000 },
+  { 0x6234u, 0.00000000 },
+  { 0x6238u, 0.00030000 },
+  { 0x623Bu, 0.00010000 },
+  { 0x623Fu, 0.00010000 },
+  { 0x6240u, 0.00110000 },
+  { 0x6247u, 0.00000000 },
+  { 0x6249u, 0.00000000 },
+  { 0x624Bu, 0.00130000 },
+  { 0x624Du, 0.00000000 },
+  { 0x6253u, 0.00040000 },
+  { 0x6255u, 0.00010000 },
+  { 0x6271u, 0.00010000 },
+  { 0x6276u, 0.00000000 },
+  { 0x6279u, 0.00010000 },
+  { 0x627Fu, 0.00010000 },
+  { 0x6280u, 0.00030000 },
+  { 0x6284u, 0.00000000 },
+  { 0x628Au, 0.00000000 },
+  { 0x6291u, 0.00010000 },
+  { 0x6295u, 0.00030000 },
+  { 0x6297u, 0.00010000 },
+  { 0x6298u, 0.00010000 },
+  { 0x629Cu, 0.00010000 },
+  { 0x629Eu, 0.00010000 },
+  { 0x62ABu, 0.00000000 },
+  { 0x62B1u, 0.00000000 },
+  { 0x62B5u, 0.00000000 },
+  { 0x62B9u, 0.00000000 },
+  { 0x62BCu, 0.00010000 },
+  { 0x62BDu, 0.00000000 },
+  { 0x62C5u, 0.00020000 },
+  { 0x62C9u, 0.00000000 },
+  { 0x62CDu, 0.00000000 },
+  { 0x62D0u, 0.00000000 },
+  { 0x62D2u, 0.00000000 },
+  { 0x62D3u, 0.00000000 },
+  { 0x62D8u, 0.00000000 },
+  { 0x62D9u, 0.00000000 },
+  { 0x62DBu, 0.00010000 },
+  { 0x62DDu, 0.00000000 },
+  { 0x62E0u, 0.00010000 },
+  { 0x62E1u, 0.00010000 },
+  { 0x62ECu, 0.00000000 },
+  { 0x62EDu, 0.00000000 },
+  { 0x62F3u, 0.00000000 },
+  { 0x62F6u, 0.00000000 },
+  { 0x62F7u, 0.00000000 },
+  { 0x62FEu, 0.00000000 },
+  { 0x6301u, 0.00070000 },
+  { 0x6307u, 0.00060000 },
+  { 0x6311u, 0.00010000 },
+  { 0x6319u, 0.00030000 },
+  { 0x631Fu, 0.00000000 },
+  { 0x6328u, 0.00000000 },
+  { 0x632Bu, 0.00000000 },
+  { 0x632Fu, 0.00010000 },
+  { 0x633Fu, 0.00000000 },
+  { 0x6349u, 0.00000000 },
+  { 0x6355u, 0.00010000 },
+  { 0x6357u, 0.00000000 },
+  { 0x635Cu, 0.00000000 },
+  { 0x6368u, 0.00000000 },
+  { 0x636Eu, 0.00000000 },
+  { 0x637Bu, 0.00000000 },
+  { 0x6383u, 0.00000000 },
+  { 0x6388u, 0.00020000 },
+  { 0x638Cu, 0.00000000 },
+  { 0x6392u, 0.00010000 },
+  { 0x6398u, 0.00000000 },
+  { 0x639Bu, 0.00010000 },
+  { 0x63A1u, 0.00020000 },
+  { 0x63A2u, 0.00010000 },
+  { 0x63A5u, 0.00030000 },
+  { 0x63A7u, 0.00000000 },
+  { 0x63A8u, 0.00020000 },
+  { 0x63AAu, 0.00000000 },
+  { 0x63B2u, 0.00010000 },
+  { 0x63CFu, 0.00010000 },
+  { 0x63D0u, 0.00030000 },
+  { 0x63DAu, 0.00000000 },
+  { 0x63DBu, 0.00020000 },
+  { 0x63E1u, 0.00000000 },
+  { 0x63EEu, 0.00010000 },
+  { 0x63F4u, 0.00010000 },
+  { 0x63FAu, 0.00000000 },
+  { 0x640Du, 0.00010000 },
+  { 0x642Cu, 0.00000000 },
+  { 0x642Du, 0.00010000 },
+  { 0x643Au, 0.00010000 },
+  { 0x643Eu, 0.00000000 },
+  { 0x6442u, 0.00000000 },
+  { 0x6458u, 0.00000000 },
+  { 0x6469u, 0.00010000 },
+  { 0x646Fu, 0.00000000 },
+  { 0x6483u, 0.00040000 },
+  { 0x64A4u, 0.00010000 },
+  { 0x64AEu, 0.00010000 },
+  { 0x64B2u, 0.00000000 },
+  { 0x64C1u, 0.00000000 },
+  { 0x64CDu, 0.00010000 },
+  { 0x64E6u, 0.00000000 },
+  { 0x64ECu, 0.00000000 },
+  { 0x652Fu, 0.00040000 },
+  { 0x6539u, 0.00050000 },
+  { 0x653Bu, 0.00030000 },
+  { 0x653Eu, 0.00090000 },
+  { 0x653Fu, 0.00080000 },
+  { 0x6545u, 0.00010000 },
+  { 0x654Fu, 0.00000000 },
+  { 0x6551u, 0.00010000 },
+  { 0x6557u, 0.00030000 },
+  { 0x6559u, 0.00080000 },
+  { 0x6562u, 0.00000000 },
+  { 0x6563u, 0.00010000 },
+  { 0x656Cu, 0.00000000 },
+  { 0x6570u, 0.00100000 },
+  { 0x6574u, 0.00020000 },
+  { 0x6575u, 0.00010000 },
+  { 0x6577u, 0.00010000 },
+  { 0x6587u, 0.00080000 },
+  { 0x6589u, 0.00000000 },
+  { 0x658Eu, 0.00000000 },
+  { 0x6591u, 0.00000000 },
+  { 0x6597u, 0.00000000 },
+  { 0x6599u, 0.00030000 },
+  { 0x659Cu, 0.00000000 },
+  { 0x65A4u, 0.00000000 },
+  { 0x65A5u, 0.00000000 },
+  { 0x65ACu, 0.00000000 },
+  { 0x65ADu, 0.00020000 },
+  { 0x65B0u, 0.00110000 },
+  { 0x65B9u, 0.00120000 },
+  { 0x65BDu, 0.00030000 },
+  { 0x65C5u, 0.00020000 },
+  { 0x65CBu, 0.00000000 },
+  { 0x65CFu, 0.00030000 },
+  { 0x65D7u, 0.00010000 },
+  { 0x65E2u, 0.00010000 },
+  { 0x65E5u, 0.00480000 },
+  { 0x65E6u, 0.00000000 },
+  { 0x65E7u, 0.00030000 },
+  { 0x65E8u, 0.00000000 },
+  { 0x65E9u, 0.00010000 },
+  { 0x65ECu, 0.00000000 },
+  { 0x65FAu, 0.00000000 },
+  { 0x6606u, 0.00000000 },
+  { 0x6607u, 0.00010000 },
+  { 0x660Eu, 0.00080000 },
+  { 0x6613u, 0.00010000 },
+  { 0x6614u, 0.00000000 },
+  { 0x661Fu, 0.00030000 },
+  { 0x6620u, 0.00040000 },
+  { 0x6625u, 0.00010000 },
+  { 0x6627u, 0.00000000 },
+  { 0x6628u, 0.00000000 },
+  { 0x662Du, 0.00040000 },
+  { 0x662Fu, 0.00000000 },
+  { 0x663Cu, 0.00000000 },
+  { 0x6642u, 0.00230000 },
+  { 0x6669u, 0.00000000 },
+  { 0x666Eu, 0.00010000 },
+  { 0x666Fu, 0.00010000 },
+  { 0x6674u, 0.00000000 },
+  { 0x6676u, 0.00000000 },
+  { 0x6681u, 0.00000000 },
+  { 0x6687u, 0.00000000 },
+  { 0x6691u, 0.00000000 },
+  { 0x6696u, 0.00000000 },
+  { 0x6697u, 0.00010000 },
+  { 0x66A6u, 0.00010000 },
+  { 0x66ABu, 0.00000000 },
+  { 0x66AEu, 0.00000000 },
+  { 0x66B4u, 0.00010000 },
+  { 0x66C7u, 0.00000000 },
+  { 0x66D6u, 0.00000000 },
+  { 0x66DCu, 0.00020000 },
+  { 0x66F2u, 0.00050000 },
+  { 0x66F4u, 0.00030000 },
+  { 0x66F8u, 0.00060000 },
+  { 0x66F9u, 0.00000000 },
+  { 0x66FDu, 0.00000000 },
+  { 0x66FFu, 0.00010000 },
+  { 0x6700u, 0.00110000 },
+  { 0x6708u, 0.00370000 },
+  { 0x6709u, 0.00060000 },
+  { 0x670Du, 0.00010000 },
+  { 0x6715u, 0.00000000 },
+  { 0x6717u, 0.00000000 },
+  { 0x671Bu, 0.00010000 },
+  { 0x671Du, 0.00040000 },
+  { 0x671Fu, 0.00090000 },
+  { 0x6728u, 0.00040000 },
+  { 0x672Au, 0.00020000 },
+  { 0x672Bu, 0.00020000 },
+  { 0x672Cu, 0.00320000 },
+  { 0x672Du, 0.00010000 },
+  { 0x6731u, 0.00000000 },
+  { 0x6734u, 0.00000000 },
+  { 0x673Au, 0.00000000 },
+  { 0x673Du, 0.00000000 },
+  { 0x6749u, 0.00010000 },
+  { 0x6750u, 0.00010000 },
+  { 0x6751u, 0.00040000 },
+  { 0x675Fu, 0.00000000 },
+  { 0x6761u, 0.00030000 },
+  { 0x6765u, 0.00070000 },
+  { 0x676Fu, 0.00000000 },
+  { 0x6771u, 0.00130000 },
+  { 0x677Eu, 0.00030000 },
+  { 0x677Fu, 0.00020000 },
+  { 0x6790u, 0.00000000 },
+  { 0x6795u, 0.00000000 },
+  { 0x6797u, 0.00010000 },
+  { 0x679Au, 0.00010000 },
+  { 0x679Cu, 0.00040000 },
+  { 0x679Du, 0.00000000 },
+  { 0x67A0u, 0.00010000 },
+  { 0x67A2u, 0.00000000 },
+  { 0x67AFu, 0.00000000 },
+  { 0x67B6u, 0.00010000 },
+  { 0x67C4u, 0.00000000 },
+  { 0x67D0u, 0.00000000 },
+  { 0x67D3u, 0.00010000 },
+  { 0x67D4u, 0.00000000 },
+  { 0x67F1u, 0.00000000 },
+  { 0x67F3u, 0.00000000 },
+  { 0x67F5u, 0.00000000 },
+  { 0x67FBu, 0.00020000 },
+  { 0x67FFu, 0.00000000 },
+  { 0x6803u, 0.00000000 },
+  { 0x6804u, 0.00010000 },
+  { 0x6813u, 0.00000000 },
+  { 0x6821u, 0.00080000 },
+  { 0x682Au, 0.00020000 },
+  { 0x6838u, 0.00010000 },
+  { 0x6839u, 0.00020000 },
+  { 0x683Cu, 0.00040000 },
+  { 0x683Du, 0.00000000 },
+  { 0x6841u, 0.00000000 },
+  { 0x6843u, 0.00000000 },
+  { 0x6848u, 0.00020000 },
+  { 0x6851u, 0.00000000 },
+  { 0x685Cu, 0.00000000 },
+  { 0x685Fu, 0.00000000 },
+  { 0x6885u, 0.00000000 },
+  { 0x6897u, 0.00000000 },
+  { 0x68A8u, 0.00000000 },
+  { 0x68B0u, 0.00000000 },
+  { 0x68C4u, 0.00000000 },
+  { 0x68CBu, 0.00000000 },
+  { 0x68D2u, 0.00000000 },
+  { 0x68DAu, 0.00000000 },
+  { 0x68DFu, 0.00000000 },
+  { 0x68EEu, 0.00010000 },
+  { 0x68FAu, 0.00000000 },
+  { 0x6905u, 0.00000000 },
+  { 0x690Du, 0.00010000 },
+  { 0x690Eu, 0.00000000 },
+  { 0x691Cu, 0.00020000 },
+  { 0x696Du, 0.00130000 },
+  { 0x6975u, 0.00020000 },
+  { 0x6977u, 0.00000000 },
+  { 0x697Cu, 0.00000000 },
+  { 0x697Du, 0.00050000 },
+  { 0x6982u, 0.00010000 },
+  { 0x69CBu, 0.00040000 },
+  { 0x69D8u, 0.00050000 },
+  { 0x69FDu, 0.00000000 },
+  { 0x6A19u, 0.00020000 },
+  { 0x6A21u, 0.00020000 },
+  { 0x6A29u, 0.00050000 },
+  { 0x6A2Au, 0.00020000 },
+  { 0x6A39u, 0.00010000 },
+  { 0x6A4Bu, 0.00030000 },
+  { 0x6A5Fu, 0.00120000 },
+  { 0x6B04u, 0.00000000 },
+  { 0x6B20u, 0.00010000 },
+  { 0x6B21u, 0.00060000 },
+  { 0x6B27u, 0.00010000 },
+  { 0x6B32u, 0.00000000 },
+  { 0x6B3Au, 0.00000000 },
+  { 0x6B3Eu, 0.00000000 },
+  { 0x6B4Cu, 0.00030000 },
+  { 0x6B53u, 0.00000000 },
+  { 0x6B62u, 0.00040000 },
+  { 0x6B63u, 0.00070000 },
+  { 0x6B66u, 0.00030000 },
+  { 0x6B69u, 0.00010000 },
+  { 0x6B6Fu, 0.00000000 },
+  { 0x6B73u, 0.00030000 },
+  { 0x6B74u, 0.00030000 },
+  { 0x6B7Bu, 0.00040000 },
+  { 0x6B89u, 0.00000000 },
+  { 0x6B8Au, 0.00000000 },
+  { 0x6B8Bu, 0.00030000 },
+  { 0x6B96u, 0.00000000 },
+  { 0x6BB4u, 0.00000000 },
+  { 0x6BB5u, 0.00020000 },
+  { 0x6BBAu, 0.00020000 },
+  { 0x6BBBu, 0.00000000 },
+  { 0x6BBFu, 0.00010000 },
+  { 0x6BC0u, 0.00000000 },
+  { 0x6BCDu, 0.00020000 },
+  { 0x6BCEu, 0.00020000 },
+  { 0x6BD2u, 0.00000000 },
+  { 0x6BD4u, 0.00030000 },
+  { 0x6BDBu, 0.00010000 },
+  { 0x6C0Fu, 0.00030000 },
+  { 0x6C11u, 0.00070000 },
+  { 0x6C17u, 0.00060000 },
+  { 0x6C34u, 0.00070000 },
+  { 0x6C37u, 0.00000000 },
+  { 0x6C38u, 0.00010000 },
+  { 0x6C3Eu, 0.00000000 },
+  { 0x6C41u, 0.00000000 },
+  { 0x6C42u, 0.00020000 },
+  { 0x6C4Eu, 0.00000000 },
+  { 0x6C57u, 0.00000000 },
+  { 0x6C5Au, 0.00000000 },
+  { 0x6C5Fu, 0.00020000 },
+  { 0x6C60u, 0.00010000 },
+  { 0x6C70u, 0.00000000 },
+  { 0x6C7Au, 0.00050000 },
+  { 0x6C7Du, 0.00000000 },
+  { 0x6C83u, 0.00000000 },
+  { 0x6C88u, 0.00000000 },
+  { 0x6C96u, 0.00010000 },
+  { 0x6C99u, 0.00000000 },
+  { 0x6CA1u, 0.00010000 },
+  { 0x6CA2u, 0.00010000 },
+  { 0x6CB3u, 0.00020000 },
+  { 0x6CB8u, 0.00000000 },
+  { 0x6CB9u, 0.00010000 },
+  { 0x6CBBu, 0.00060000 },
+  { 0x6CBCu, 0.00010000 },
+  { 0x6CBFu, 0.00010000 },
+  { 0x6CC1u, 0.00010000 },
+  { 0x6CC9u, 0.00010000 },
+  { 0x6CCAu, 0.00000000 },
+  { 0x6CCCu, 0.00000000 },
+  { 0x6CD5u, 0.00100000 },
+  { 0x6CE1u, 0.00000000 },
+  { 0x6CE2u, 0.00020000 },
+  { 0x6CE3u, 0.00000000 },
+  { 0x6CE5u, 0.00000000 },
+  { 0x6CE8u, 0.00010000 },
+  { 0x6CF0u, 0.00000000 },
+  { 0x6CF3u, 0.00000000 },
+  { 0x6D0Bu, 0.00020000 },
+  { 0x6D17u, 0.00000000 },
+  { 0x6D1Eu, 0.00000000 },
+  { 0x6D25u, 0.00020000 },
+  { 0x6D2Au, 0.00000000 },
+  { 0x6D3Bu, 0.00070000 },
+  { 0x6D3Eu, 0.00030000 },
+  { 0x6D41u, 0.00050000 },
+  { 0x6D44u, 0.00000000 },
+  { 0x6D45u, 0.00010000 },
+  { 0x6D5Cu, 0.00020000 },
+  { 0x6D66u, 0.00010000 },
+  { 0x6D6Au, 0.00000000 },
+  { 0x6D6Eu, 0.00000000 },
+  { 0x6D74u, 0.00000000 },
+  { 0x6D77u, 0.00080000 },
+  { 0x6D78u, 0.00000000 },
+  { 0x6D88u, 0.00020000 },
+  { 0x6D99u, 0.00000000 },
+  { 0x6DAFu, 0.00000000 },
+  { 0x6DB2u, 0.00010000 },
+  { 0x6DBCu, 0.00000000 },
+  { 0x6DD1u, 0.00000000 },
+  { 0x6DE1u, 0.00000000 },
+  { 0x6DEBu, 0.00000000 },
+  { 0x6DF1u, 0.00010000 },
+  { 0x6DF7u, 0.00010000 },
+  { 0x6DFBu, 0.00000000 },
+  { 0x6E05u, 0.00020000 },
+  { 0x6E07u, 0.00000000 },
+  { 0x6E08u, 0.00020000 },
+  { 0x6E09u, 0.00000000 },
+  { 0x6E0Bu, 0.00000000 },
+  { 0x6E13u, 0.00000000 },
+  { 0x6E1Bu, 0.00020000 },
+  { 0x6E21u, 0.00020000 },
+  { 0x6E26u, 0.00000000 },
+  { 0x6E29u, 0.00010000 },
+  { 0x6E2Cu, 0.00010000 },
+  { 0x6E2Fu, 0.00020000 },
+  { 0x6E56u, 0.00010000 },
+  { 0x6E67u, 0.00000000 },
+  { 0x6E6Fu, 0.00000000 },
+  { 0x6E7Eu, 0.00010000 },
+  { 0x6E7Fu, 0.00000000 },
+  { 0x6E80u, 0.00020000 },
+  { 0x6E90u, 0.00020000 },
+  { 0x6E96u, 0.00030000 },
+  { 0x6E9Du, 0.00000000 },
+  { 0x6EB6u, 0.00000000 },
+  { 0x6EBAu, 0.00000000 },
+  { 0x6EC5u, 0.00010000 },
+  { 0x6ECBu, 0.00000000 },
+  { 0x6ED1u, 0.00000000 },
+  { 0x6EDDu, 0.00000000 },
+  { 0x6EDEu, 0.00000000 },
+  { 0x6EF4u, 0.00000000 },
+  { 0x6F01u, 0.00000000 },
+  { 0x6F02u, 0.00000000 },
+  { 0x6F06u, 0.00000000 },
+  { 0x6F0Fu, 0.00000000 },
+  { 0x6F14u, 0.00060000 },
+  { 0x6F20u, 0.00000000 },
+  { 0x6F22u, 0.00010000 },
+  { 0x6F2Bu, 0.00010000 },
+  { 0x6F2Cu, 0.00000000 },
+  { 0x6F38u, 0.00000000 },
+  { 0x6F54u, 0.00000000 },
+  { 0x6F5Cu, 0.00010000 },
+  { 0x6F5Fu, 0.00010000 },
+  { 0x6F64u, 0.00000000 },
+  { 0x6F6Eu, 0.00000000 },
+  { 0x6F70u, 0.00000000 },
+  { 0x6F84u, 0.00000000 },
+  { 0x6FC0u, 0.00010000 },
+  { 0x6FC1u, 0.00000000 },
+  { 0x6FC3u, 0.00010000 },
+  { 0x6FEBu, 0.00000000 },
+  { 0x6FEFu, 0.00000000 },
+  { 0x702Cu, 0.00010000 },
+  { 0x706Bu, 0.00020000 },
+  { 0x706Fu, 0.00000000 },
+  { 0x7070u, 0.00000000 },
+  { 0x707Du, 0.00010000 },
+  { 0x7089u, 0.00000000 },
+  { 0x708Au, 0.00000000 },
+  { 0x708Eu, 0.00000000 },
+  { 0x70ADu, 0.00010000 },
+  { 0x70B9u, 0.00070000 },
+  { 0x70BAu, 0.00020000 },
+  { 0x70C8u, 0.00000000 },
+  { 0x7121u, 0.00050000 },
+  { 0x7126u, 0.00000000 },
+  { 0x7136u, 0.00020000 },
+  { 0x713Cu, 0.00010000 },
+  { 0x714Eu, 0.00000000 },
+  { 0x7159u, 0.00000000 },
+  { 0x7167u, 0.00020000 },
+  { 0x7169u, 0.00000000 },
+  { 0x716Eu, 0.00000000 },
+  { 0x718Au, 0.00010000 },
+  { 0x719Fu, 0.00000000 },
+  { 0x71B1u, 0.00010000 },
+  { 0x71C3u, 0.00010000 },
+  { 0x71E5u, 0.00000000 },
+  { 0x7206u, 0.00010000 },
+  { 0x722Au, 0.00000000 },
+  { 0x7235u, 0.00000000 },
+  { 0x7236u, 0.00020000 },
+  { 0x723Du, 0.00000000 },
+  { 0x7247u, 0.00010000 },
+  { 0x7248u, 0.00040000 },
+  { 0x7259u, 0.00000000 },
+  { 0x725Bu, 0.00000000 },
+  { 0x7267u, 0.00010000 },
+  { 0x7269u, 0.00100000 },
+  { 0x7272u, 0.00000000 },
+  { 0x7279u, 0.00080000 },
+  { 0x72A0u, 0.00000000 },
+  { 0x72ACu, 0.00000000 },
+  { 0x72AFu, 0.00010000 },
+  { 0x72B6u, 0.00040000 },
+  { 0x72C2u, 0.00000000 },
+  { 0x72D9u, 0.00000000 },
+  { 0x72E9u, 0.00000000 },
+  { 0x72ECu, 0.00030000 },
+  { 0x72EDu, 0.00010000 },
+  { 0x731Bu, 0.00000000 },
+  { 0x731Fu, 0.00000000 },
+  { 0x732Bu, 0.00000000 },
+  { 0x732Eu, 0.00010000 },
+  { 0x7336u, 0.00000000 },
+  { 0x733Fu, 0.00000000 },
+  { 0x7344u, 0.00000000 },
+  { 0x7363u, 0.00000000 },
+  { 0x7372u, 0.00020000 },
+  { 0x7384u, 0.00000000 },
+  { 0x7387u, 0.00030000 },
+  { 0x7389u, 0.00010000 },
+  { 0x738Bu, 0.00060000 },
+  { 0x73A9u, 0.00000000 },
+  { 0x73CDu, 0.00000000 },
+  { 0x73E0u, 0.00000000 },
+  { 0x73EDu, 0.00000000 },
+  { 0x73FEu, 0.00140000 },
+  { 0x7403u, 0.00040000 },
+  { 0x7406u, 0.00080000 },
+  { 0x7434u, 0.00000000 },
+  { 0x7460u, 0.00000000 },
+  { 0x7483u, 0.00000000 },
+  { 0x74A7u, 0.00000000 },
+  { 0x74B0u, 0.00020000 },
+  { 0x74BDu, 0.00000000 },
+  { 0x74E6u, 0.00000000 },
+  { 0x74F6u, 0.00000000 },
+  { 0x7518u, 0.00000000 },
+  { 0x751Au, 0.00000000 },
+  { 0x751Fu, 0.00170000 },
+  { 0x7523u, 0.00050000 },
+  { 0x7528u, 0.00210000 },
+  { 0x7530u, 0.00100000 },
+  { 0x7531u, 0.00040000 },
+  { 0x7532u, 0.00010000 },
+  { 0x7533u, 0.00010000 },
+  { 0x7537u, 0.00040000 },
+  { 0x753Au, 0.00060000 },
+  { 0x753Bu, 0.00090000 },
+  { 0x754Cu, 0.00060000 },
+  { 0x754Fu, 0.00000000 },
+  { 0x7551u, 0.00000000 },
+  { 0x7554u, 0.00000000 },
+  { 0x7559u, 0.00020000 },
+  { 0x755Cu, 0.00000000 },
+  { 0x755Du, 0.00000000 },
+  { 0x7565u, 0.00020000 },
+  { 0x756Au, 0.00080000 },
+  { 0x7570u, 0.00030000 },
+  { 0x7573u, 0.00000000 },
+  { 0x757Fu, 0.00000000 },
+  { 0x758Eu, 0.00000000 },
+  { 0x7591u, 0.00010000 },
+  { 0x75ABu, 0.00000000 },
+  { 0x75B2u, 0.00000000 },
+  { 0x75BEu, 0.00000000 },
+  { 0x75C5u, 0.00020000 },
+  { 0x75C7u, 0.00010000 },
+  { 0x75D5u, 0.00000000 },
+  { 0x75D8u, 0.00000000 },
+  { 0x75DBu, 0.00000000 },
+  { 0x75E2u, 0.00000000 },
+  { 0x75E9u, 0.00000000 },
+  { 0x75F4u, 0.00000000 },
+  { 0x760Du, 0.00000000 },
+  { 0x7642u, 0.00010000 },
+  { 0x7652u, 0.00000000 },
+  { 0x7656u, 0.00000000 },
+  { 0x767Au, 0.00200000 },
+  { 0x767Bu, 0.00050000 },
+  { 0x767Du, 0.00020000 },
+  { 0x767Eu, 0.00010000 },
+  { 0x7684u, 0.00180000 },
+  { 0x7686u, 0.00000000 },
+  { 0x7687u, 0.00030000 },
+  { 0x76AEu, 0.00010000 },
+  { 0x76BFu, 0.00000000 },
+  { 0x76C6u, 0.00000000 },
+  { 0x76CAu, 0.00010000 },
+  { 0x76D7u, 0.00000000 },
+  { 0x76DBu, 0.00010000 },
+  { 0x76DFu, 0.00010000 },
+  { 0x76E3u, 0.00020000 },
+  { 0x76E4u, 0.00010000 },
+  { 0x76EEu, 0.00110000 },
+  { 0x76F2u, 0.00000000 },
+  { 0x76F4u, 0.00050000 },
+  { 0x76F8u, 0.00050000 },
+  { 0x76FEu, 0.00000000 },
+  { 0x7701u, 0.00020000 },
+  { 0x7709u, 0.00000000 },
+  { 0x770Bu, 0.00000000 },
+  { 0x770Cu, 0.00100000 },
+  { 0x771Fu, 0.00030000 },
+  { 0x7720u, 0.00000000 },
+  { 0x773Au, 0.00000000 },
+  { 0x773Cu, 0.00000000 },
+  { 0x7740u, 0.00040000 },
+  { 0x7761u, 0.00000000 },
+  { 0x7763u, 0.00030000 },
+  { 0x7766u, 0.00000000 },
+  { 0x77ACu, 0.00000000 },
+  { 0x77ADu, 0.00000000 },
+  { 0x77B3u, 0.00000000 },
+  { 0x77DBu, 0.00000000 },
+  { 0x77E2u, 0.00000000 },
+  { 0x77E5u, 0.00050000 },
+  { 0x77EDu, 0.00020000 },
+  { 0x77EFu, 0.00000000 },
+  { 0x77F3u, 0.00040000 },
+  { 0x7802u, 0.00010000 },
+  { 0x7814u, 0.00030000 },
+  { 0x7815u, 0.00000000 },
+  { 0x7832u, 0.00020000 },
+  { 0x7834u, 0.00020000 },
+  { 0x785Du, 0.00000000 },
+  { 0x786Bu, 0.00000000 },
+  { 0x786Cu, 0.00000000 },
+  { 0x7881u, 0.00000000 },
+  { 0x7891u, 0.00000000 },
+  { 0x78BAu, 0.00030000 },
+  { 0x78C1u, 0.00000000 },
+  { 0x78E8u, 0.00000000 },
+  { 0x7901u, 0.00000000 },
+  { 0x790Eu, 0.00000000 },
+  { 0x793Au, 0.00030000 },
+  { 0x793Cu, 0.00010000 },
+  { 0x793Eu, 0.00130000 },
+  { 0x7948u, 0.00000000 },
+  { 0x7949u, 0.00000000 },
+  { 0x7956u, 0.00010000 },
+  { 0x795Du, 0.00000000 },
+  { 0x795Eu, 0.00060000 },
+  { 0x7965u, 0.00000000 },
+  { 0x7968u, 0.00010000 },
+  { 0x796Du, 0.00010000 },
+  { 0x7981u, 0.00010000 },
+  { 0x7985u, 0.00000000 },
+  { 0x798Du, 0.00000000 },
+  { 0x798Fu, 0.00030000 },
+  { 0x79C0u, 0.00010000 },
+  { 0x79C1u, 0.00010000 },
+  { 0x79CBu, 0.00010000 },
+  { 0x79D1u, 0.00040000 },
+  { 0x79D2u, 0.00010000 },
+  { 0x79D8u, 0.00010000 },
+  { 0x79DFu, 0.00000000 },
+  { 0x79E9u, 0.00000000 },
+  { 0x79F0u, 0.00050000 },
+  { 0x79FBu, 0.00050000 },
+  { 0x7A0Bu, 0.00020000 },
+  { 0x7A0Eu, 0.00010000 },
+  { 0x7A1Au, 0.00000000 },
+  { 0x7A2Eu, 0.00050000 },
+  { 0x7A32u, 0.00010000 },
+  { 0x7A3Cu, 0.00000000 },
+  { 0x7A3Du, 0.00000000 },
+  { 0x7A3Fu, 0.00000000 },
+  { 0x7A40u, 0.00000000 },
+  { 0x7A42u, 0.00000000 },
+  { 0x7A4Du, 0.00020000 },
+  { 0x7A4Fu, 0.00000000 },
+  { 0x7A6Bu, 0.00000000 },
+  { 0x7A74u, 0.00000000 },
+  { 0x7A76u, 0.00030000 },
+  { 0x7A7Au, 0.00060000 },
+  { 0x7A81u, 0.00010000 },
+  { 0x7A83u, 0.00000000 },
+  { 0x7A92u, 0.00000000 },
+  { 0x7A93u, 0.00010000 },
+  { 0x7A9Fu, 0.00000000 },
+  { 0x7AAEu, 0.00000000 },
+  { 0x7AAFu, 0.00000000 },
+  { 0x7ACBu, 0.00120000 },
+  { 0x7ADCu, 0.00010000 },
+  { 0x7AE0u, 0.00010000 },
+  { 0x7AE5u, 0.00010000 },
+  { 0x7AEFu, 0.00020000 },
+  { 0x7AF6u, 0.00030000 },
+  { 0x7AF9u, 0.00010000 },
+  { 0x7B11u, 0.00000000 },
+  { 0x7B1Bu, 0.00000000 },
+  { 0x7B26u, 0.00000000 },
+  { 0x7B2Cu, 0.00130000 },
+  { 0x7B46u, 0.00010000 },
+  { 0x7B49u, 0.00060000 },
+  { 0x7B4Bu, 0.00000000 },
+  { 0x7B52u, 0.00000000 },
+  { 0x7B54u, 0.00010000 },
+  { 0x7B56u, 0.00020000 },
+  { 0x7B87u, 0.00000000 },
+  { 0x7B8Bu, 0.00000000 },
+  { 0x7B97u, 0.00020000 },
+  { 0x7BA1u, 0.00030000 },
+  { 0x7BB1u, 0.00000000 },
+  { 0x7BB8u, 0.00000000 },
+  { 0x7BC0u, 0.00010000 },
+  { 0x7BC4u, 0.00010000 },
+  { 0x7BC9u, 0.00020000 },
+  { 0x7BE4u, 0.00000000 },
+  { 0x7C21u, 0.00010000 },
+  { 0x7C3Fu, 0.00000000 },
+  { 0x7C4Du, 0.00020000 },
+  { 0x7C60u, 0.00000000 },
+  { 0x7C73u, 0.00030000 },
+  { 0x7C89u, 0.00000000 },
+  { 0x7C8Bu, 0.00000000 },
+  { 0x7C92u, 0.00000000 },
+  { 0x7C97u, 0.00000000 },
+  { 0x7C98u, 0.00000000 },
+  { 0x7C9Bu, 0.00000000 },
+  { 0x7CA7u, 0.00000000 },
+  { 0x7CBEu, 0.00010000 },
+  { 0x7CD6u, 0.00000000 },
+  { 0x7CE7u, 0.00000000 },
+  { 0x7CF8u, 0.00000000 },
+  { 0x7CFBu, 0.00060000 },
+  { 0x7CFEu, 0.00000000 },
+  { 0x7D00u, 0.00040000 },
+  { 0x7D04u, 0.00050000 },
+  { 0x7D05u, 0.00000000 },
+  { 0x7D0Bu, 0.00000000 },
+  { 0x7D0Du, 0.00010000 },
+  { 0x7D14u, 0.00010000 },
+  { 0x7D19u, 0.00010000 },
+  { 0x7D1Au, 0.00030000 },
+  { 0x7D1Bu, 0.00000000 },
+  { 0x7D20u, 0.00020000 },
+  { 0x7D21u, 0.00000000 },
+  { 0x7D22u, 0.00000000 },
+  { 0x7D2Bu, 0.00000000 },
+  { 0x7D2Fu, 0.00000000 },
+  { 0x7D30u, 0.00020000 },
+  { 0x7D33u, 0.00000000 },
+  { 0x7D39u, 0.00010000 },
+  { 0x7D3Au, 0.00000000 },
+  { 0x7D42u, 0.00050000 },
+  { 0x7D44u, 0.00080000 },
+  { 0x7D4Cu, 0.00070000 },
+  { 0x7D50u, 0.00070000 },
+  { 0x7D5Eu, 0.00000000 },
+  { 0x7D61u, 0.00010000 },
+  { 0x7D66u, 0.00010000 },
+  { 0x7D71u, 0.00040000 },
+  { 0x7D75u, 0.00010000 },
+  { 0x7D76u, 0.00010000 },
+  { 0x7D79u, 0.00000000 },
+  { 0x7D99u, 0.00030000 },
+  { 0x7D9Au, 0.00070000 },
+  { 0x7DADu, 0.00010000 },
+  { 0x7DB1u, 0.00010000 },
+  { 0x7DB2u, 0.00000000 },
+  { 0x7DBBu, 0.00000000 },
+  { 0x7DBFu, 0.00000000 },
+  { 0x7DCAu, 0.00000000 },
+  { 0x7DCFu, 0.00040000 },
+  { 0x7DD1u, 0.00010000 },
+  { 0x7DD2u, 0.00000000 },
+  { 0x7DDAu, 0.00130000 },
+  { 0x7DE0u, 0.00010000 },
+  { 0x7DE8u, 0.00040000 },
+  { 0x7DE9u, 0.00000000 },
+  { 0x7DEFu, 0.00000000 },
+  { 0x7DF4u, 0.00010000 },
+  { 0x7DFBu, 0.00000000 },
+  { 0x7E01u, 0.00010000 },
+  { 0x7E04u, 0.00010000 },
+  { 0x7E1Bu, 0.00000000 },
+  { 0x7E26u, 0.00000000 },
+  { 0x7E2Bu, 0.00000000 },
+  { 0x7E2Eu, 0.00010000 },
+  { 0x7E3Eu, 0.00010000 },
+  { 0x7E41u, 0.00010000 },
+  { 0x7E4Au, 0.00000000 },
+  { 0x7E54u, 0.00020000 },
+  { 0x7E55u, 0.00000000 },
+  { 0x7E6Du, 0.00000000 },
+  { 0x7E70u, 0.00010000 },
+  { 0x7F36u, 0.00000000 },
+  { 0x7F6Au, 0.00010000 },
+  { 0x7F6Eu, 0.00080000 },
+  { 0x7F70u, 0.00000000 },
+  { 0x7F72u, 0.00000000 },
+  { 0x7F75u, 0.00000000 },
+  { 0x7F77u, 0.00000000 },
+  { 0x7F85u, 0.00000000 },
+  { 0x7F8Au, 0.00000000 },
+  { 0x7F8Eu, 0.00030000 },
+  { 0x7F9Eu, 0.00000000 },
+  { 0x7FA4u, 0.00010000 },
+  { 0x7FA8u, 0.00000000 },
+  { 0x7FA9u, 0.00050000 },
+  { 0x7FBDu, 0.00010000 },
+  { 0x7FC1u, 0.00000000 },
+  { 0x7FCCu, 0.00020000 },
+  { 0x7FD2u, 0.00010000 },
+  { 0x7FFBu, 0.00000000 },
+  { 0x7FFCu, 0.00010000 },
+  { 0x8001u, 0.00010000 },
+  { 0x8003u, 0.00030000 },
+  { 0x8005u, 0.00150000 },
+  { 0x8010u, 0.00000000 },
+  { 0x8015u, 0.00000000 },
+  { 0x8017u, 0.00000000 },
+  { 0x8033u, 0.00000000 },
+  { 0x8056u, 0.00010000 },
+  { 0x805Eu, 0.00020000 },
+  { 0x8074u, 0.00010000 },
+  { 0x8077u, 0.00020000 },
+  { 0x8089u, 0.00010000 },
+  { 0x808Cu, 0.00000000 },
+  { 0x8096u, 0.00000000 },
+  { 0x8098u, 0.00000000 },
+  { 0x809Du, 0.00000000 },
+  { 0x80A1u, 0.00000000 },
+  { 0x80A2u, 0.00000000 },
+  { 0x80A5u, 0.00000000 },
+  { 0x80A9u, 0.00000000 },
+  { 0x80AAu, 0.00000000 },
+  { 0x80AFu, 0.00000000 },
+  { 0x80B2u, 0.00030000 },
+  { 0x80BAu, 0.00000000 },
+  { 0x80C3u, 0.00000000 },
+  { 0x80C6u, 0.00000000 },
+  { 0x80CCu, 0.00010000 },
+  { 0x80CEu, 0.00000000 },
+  { 0x80DEu, 0.00010000 },
+  { 0x80F4u, 0.00000000 },
+  { 0x80F8u, 0.00000000 },
+  { 0x80FDu, 0.00070000 },
+  { 0x8102u, 0.00000000 },
+  { 0x8105u, 0.00000000 },
+  { 0x8107u, 0.00000000 },
+  { 0x8108u, 0.00000000 },
+  { 0x810Au, 0.00000000 },
+  { 0x811Au, 0.00010000 },
+  { 0x8131u, 0.00010000 },
+  { 0x8133u, 0.00000000 },
+  { 0x814Eu, 0.00000000 },
+  { 0x8150u, 0.00000000 },
+  { 0x8155u, 0.00000000 },
+  { 0x816Bu, 0.00000000 },
+  { 0x8170u, 0.00000000 },
+  { 0x8178u, 0.00000000 },
+  { 0x8179u, 0.00000000 },
+  { 0x817Au, 0.00000000 },
+  { 0x819Au, 0.00000000 },
+  { 0x819Cu, 0.00000000 },
+  { 0x819Du, 0.00000000 },
+  { 0x81A8u, 0.00000000 },
+  { 0x81B3u, 0.00000000 },
+  { 0x81C6u, 0.00000000 },
+  { 0x81D3u, 0.00000000 },
+  { 0x81E3u, 0.00020000 },
+  { 0x81E8u, 0.00010000 },
+  { 0x81EAu, 0.00130000 },
+  { 0x81EDu, 0.00000000 },
+  { 0x81F3u, 0.00010000 },
+  { 0x81F4u, 0.00010000 },
+  { 0x81FCu, 0.00000000 },
+  { 0x8208u, 0.00020000 },
+  { 0x820Cu, 0.00000000 },
+  { 0x820Eu, 0.00010000 },
+  { 0x8217u, 0.00010000 },
+  { 0x821Eu, 0.00010000 },
+  { 0x821Fu, 0.00000000 },
+  { 0x822Au, 0.00030000 },
+  { 0x822Cu, 0.00030000 },
+  { 0x8236u, 0.00000000 },
+  { 0x8237u, 0.00000000 },
+  { 0x8239u, 0.00020000 },
+  { 0x8247u, 0.00000000 },
+  { 0x8266u, 0.00040000 },
+  { 0x826Fu, 0.00020000 },
+  { 0x8272u, 0.00030000 },
+  { 0x8276u, 0.00000000 },
+  { 0x828Bu, 0.00000000 },
+  { 0x829Du, 0.00000000 },
+  { 0x82AFu, 0.00000000 },
+  { 0x82B1u, 0.00020000 },
+  { 0x82B3u, 0.00000000 },
+  { 0x82B8u, 0.00020000 },
+  { 0x82BDu, 0.00000000 },
+  { 0x82D7u, 0.00000000 },
+  { 0x82DBu, 0.00000000 },
+  { 0x82E5u, 0.00020000 },
+  { 0x82E6u, 0.00010000 },
+  { 0x82F1u, 0.00030000 },
+  { 0x8302u, 0.00000000 },
+  { 0x830Eu, 0.00000000 },
+  { 0x8328u, 0.00000000 },
+  { 0x8336u, 0.00010000 },
+  { 0x8349u, 0.00010000 },
+  { 0x8352u, 0.00000000 },
+  { 0x8358u, 0.00000000 },
+  { 0x8377u, 0.00010000 },
+  { 0x83CAu, 0.00000000 },
+  { 0x83CCu, 0.00000000 },
+  { 0x83D3u, 0.00000000 },
+  { 0x83DCu, 0.00000000 },
+  { 0x83EFu, 0.00010000 },
+  { 0x840Eu, 0.00000000 },
+  { 0x843Du, 0.00020000 },
+  { 0x8449u, 0.00020000 },
+  { 0x8457u, 0.00020000 },
+  { 0x845Bu, 0.00000000 },
+  { 0x846Cu, 0.00000000 },
+  { 0x84B8u, 0.00000000 },
+  { 0x84C4u, 0.00000000 },
+  { 0x84CBu, 0.00000000 },
+  { 0x8511u, 0.00000000 },
+  { 0x8535u, 0.00010000 },
+  { 0x853Du, 0.00000000 },
+  { 0x8584u, 0.00000000 },
+  { 0x85A6u, 0.00000000 },
+  { 0x85AAu, 0.00000000 },
+  { 0x85ABu, 0.00000000 },
+  { 0x85ACu, 0.00010000 },
+  { 0x85CDu, 0.00000000 },
+  { 0x85E4u, 0.00030000 },
+  { 0x85E9u, 0.00020000 },
+  { 0x85FBu, 0.00000000 },
+  { 0x864Eu, 0.00000000 },
+  { 0x8650u, 0.00000000 },
+  { 0x865Au, 0.00000000 },
+  { 0x865Cu, 0.00000000 },
+  { 0x865Eu, 0.00000000 },
+  { 0x866Bu, 0.00010000 },
+  { 0x8679u, 0.00000000 },
+  { 0x868Au, 0.00000000 },
+  { 0x8695u, 0.00000000 },
+  { 0x86C7u, 0.00000000 },
+  { 0x86CDu, 0.00000000 },
+  { 0x86EEu, 0.00000000 },
+  { 0x8702u, 0.00000000 },
+  { 0x871Cu, 0.00000000 },
+  { 0x878Du, 0.00010000 },
+  { 0x8840u, 0.00010000 },
+  { 0x8846u, 0.00020000 },
+  { 0x884Cu, 0.00250000 },
+  { 0x8853u, 0.00040000 },
+  { 0x8857u, 0.00020000 },
+  { 0x885Bu, 0.00020000 },
+  { 0x885Du, 0.00010000 },
+  { 0x8861u, 0.00000000 },
+  { 0x8863u, 0.00000000 },
+  { 0x8868u, 0.00100000 },
+  { 0x8870u, 0.00000000 },
+  { 0x8877u, 0.00000000 },
+  { 0x888Bu, 0.00000000 },
+  { 0x8896u, 0.00000000 },
+  { 0x88ABu, 0.00010000 },
+  { 0x88C1u, 0.00010000 },
+  { 0x88C2u, 0.00000000 },
+  { 0x88C5u, 0.00040000 },
+  { 0x88CFu, 0.00010000 },
+  { 0x88D5u, 0.00000000 },
+  { 0x88DCu, 0.00020000 },
+  { 0x88F8u, 0.00000000 },
+  { 0x88FDu, 0.00050000 },
+  { 0x88FEu, 0.00000000 },
+  { 0x8907u, 0.00020000 },
+  { 0x8910u, 0.00000000 },
+  { 0x8912u, 0.00000000 },
+  { 0x895Fu, 0.00000000 },
+  { 0x8972u, 0.00010000 },
+  { 0x897Fu, 0.00070000 },
+  { 0x8981u, 0.00080000 },
+  { 0x8986u, 0.00000000 },
+  { 0x8987u, 0.00010000 },
+  { 0x898Bu, 0.00090000 },
+  { 0x898Fu, 0.00030000 },
+  { 0x8996u, 0.00020000 },
+  { 0x899Au, 0.00010000 },
+  { 0x89A7u, 0.00010000 },
+  { 0x89AAu, 0.00030000 },
+  { 0x89B3u, 0.00030000 },
+  { 0x89D2u, 0.00010000 },
+  { 0x89E3u, 0.00050000 },
+  { 0x89E6u, 0.00010000 },
+  { 0x8A00u, 0.00070000 },
+  { 0x8A02u, 0.00000000 },
+  { 0x8A03u, 0.00000000 },
+  { 0x8A08u, 0.00050000 },
+  { 0x8A0Eu, 0.00010000 },
+  { 0x8A13u, 0.00010000 },
+  { 0x8A17u, 0.00000000 },
+  { 0x8A18u, 0.00090000 },
+  { 0x8A1Fu, 0.00000000 },
+  { 0x8A2Au, 0.00010000 },
+  { 0x8A2Du, 0.00120000 },
+  { 0x8A31u, 0.00010000 },
+  { 0x8A33u, 0.00010000 },
+  { 0x8A34u, 0.00010000 },
+  { 0x8A3Au, 0.00000000 },
+  { 0x8A3Cu, 0.00010000 },
+  { 0x8A50u, 0.00000000 },
+  { 0x8A54u, 0.00000000 },
+  { 0x8A55u, 0.00020000 },
+  { 0x8A5Eu, 0.00010000 },
+  { 0x8A60u, 0.00000000 },
+  { 0x8A63u, 0.00000000 },
+  { 0x8A66u, 0.00040000 },
+  { 0x8A69u, 0.00010000 },
+  { 0x8A6Eu, 0.00000000 },
+  { 0x8A70u, 0.00000000 },
+  { 0x8A71u, 0.00040000 },
+  { 0x8A72u, 0.00000000 },
+  { 0x8A73u, 0.00010000 },
+  { 0x8A87u, 0.00000000 },
+  { 0x8A89u, 0.00000000 },
+  { 0x8A8Cu, 0.00020000 },
+  { 0x8A8Du, 0.00030000 },
+  { 0x8A93u, 0.00000000 },
+  { 0x8A95u, 0.00010000 },
+  { 0x8A98u, 0.00010000 },
+  { 0x8A9Eu, 0.00090000 },
+  { 0x8AA0u, 0.00000000 },
+  { 0x8AA4u, 0.00010000 },
+  { 0x8AACu, 0.00040000 },
+  { 0x8AADu, 0.00010000 },
+  { 0x8AB0u, 0.00000000 },
+  { 0x8AB2u, 0.00010000 },
+  { 0x8ABFu, 0.00040000 },
+  { 0x8AC7u, 0.00010000 },
+  { 0x8ACBu, 0.00010000 },
+  { 0x8AD6u, 0.00030000 },
+  { 0x8AE6u, 0.00000000 },
+  { 0x8AE7u, 0.00000000 },
+  { 0x8AEDu, 0.00000000 },
+  { 0x8AEEu, 0.00000000 },
+  { 0x8AF8u, 0.00020000 },
+  { 0x8AFEu, 0.00000000 },
+  { 0x8B00u, 0.00000000 },
+  { 0x8B01u, 0.00000000 },
+  { 0x8B04u, 0.00000000 },
+  { 0x8B0Eu, 0.00000000 },
+  { 0x8B19u, 0.00000000 },
+  { 0x8B1Bu, 0.00010000 },
+  { 0x8B1Du, 0.00000000 },
+  { 0x8B21u, 0.00000000 },
+  { 0x8B39u, 0.00000000 },
+  { 0x8B58u, 0.00010000 },
+  { 0x8B5Cu, 0.00000000 },
+  { 0x8B66u, 0.00020000 },
+  { 0x8B70u, 0.00060000 },
+  { 0x8B72u, 0.00010000 },
+  { 0x8B77u, 0.00020000 },
+  { 0x8C37u, 0.00020000 },
+  { 0x8C46u, 0.00000000 },
+  { 0x8C4Au, 0.00010000 },
+  { 0x8C5Au, 0.00000000 },
+  { 0x8C61u, 0.00020000 },
+  { 0x8C6Au, 0.00010000 },
+  { 0x8C8Cu, 0.00000000 },
+  { 0x8C9Du, 0.00000000 },
+  { 0x8C9Eu, 0.00000000 },
+  { 0x8CA0u, 0.00020000 },
+  { 0x8CA1u, 0.00010000 },
+  { 0x8CA2u, 0.00010000 },
+  { 0x8CA7u, 0.00000000 },
+  { 0x8CA8u, 0.00010000 },
+  { 0x8CA9u, 0.00020000 },
+  { 0x8CAAu, 0.00000000 },
+  { 0x8CABu, 0.00010000 },
+  { 0x8CACu, 0.00010000 },
+  { 0x8CAFu, 0.00000000 },
+  { 0x8CB4u, 0.00010000 },
+  { 0x8CB7u, 0.00010000 },
+  { 0x8CB8u, 0.00000000 },
+  { 0x8CBBu, 0.00010000 },
+  { 0x8CBCu, 0.00000000 },
+  { 0x8CBFu, 0.00000000 },
+  { 0x8CC0u, 0.00010000 },
+  { 0x8CC2u, 0.00000000 },
+  { 0x8CC3u, 0.00000000 },
+  { 0x8CC4u, 0.00000000 },
+  { 0x8CC7u, 0.00030000 },
+  { 0x8CCAu, 0.00000000 },
+  { 0x8CD3u, 0.00000000 },
+  { 0x8CDBu, 0.00000000 },
+  { 0x8CDCu, 0.00000000 },
+  { 0x8CDEu, 0.00040000 },
+  { 0x8CE0u, 0.00000000 },
+  { 0x8CE2u, 0.00000000 },
+  { 0x8CE6u, 0.00000000 },
+  { 0x8CEAu, 0.00030000 },
+  { 0x8CEDu, 0.00000000 },
+  { 0x8CFCu, 0.00010000 },
+  { 0x8D08u, 0.00000000 },
+  { 0x8D64u, 0.00020000 },
+  { 0x8D66u, 0.00000000 },
+  { 0x8D70u, 0.00030000 },
+  { 0x8D74u, 0.00000000 },
+  { 0x8D77u, 0.00040000 },
+  { 0x8D85u, 0.00010000 },
+  { 0x8D8Au, 0.00020000 },
+  { 0x8DA3u, 0.00000000 },
+  { 0x8DB3u, 0.00020000 },
+  { 0x8DDDu, 0.00010000 },
+  { 0x8DE1u, 0.00010000 },
+  { 0x8DEFu, 0.00060000 },
+  { 0x8DF3u, 0.00000000 },
+  { 0x8DF5u, 0.00000000 },
+  { 0x8E0Au, 0.00000000 },
+  { 0x8E0Fu, 0.00010000 },
+  { 0x8E2Au, 0.00000000 },
+  { 0x8E74u, 0.00000000 },
+  { 0x8E8Du, 0.00020000 },
+  { 0x8EABu, 0.00070000 },
+  { 0x8ECAu, 0.00140000 },
+  { 0x8ECCu, 0.00010000 },
+  { 0x8ECDu, 0.00100000 },
+  { 0x8ED2u, 0.00000000 },
+  { 0x8EDFu, 0.00000000 },
+  { 0x8EE2u, 0.00050000 },
+  { 0x8EF8u, 0.00010000 },
+  { 0x8EFDu, 0.00010000 },
+  { 0x8F03u, 0.00010000 },
+  { 0x8F09u, 0.00040000 },
+  { 0x8F1Du, 0.00000000 },
+  { 0x8F29u, 0.00000000 },
+  { 0x8F2Au, 0.00010000 },
+  { 0x8F38u, 0.00020000 },
+  { 0x8F44u, 0.00000000 },
+  { 0x8F9Bu, 0.00000000 },
+  { 0x8F9Eu, 0.00010000 },
+  { 0x8FA3u, 0.00000000 },
+  { 0x8FB1u, 0.00000000 },
+  { 0x8FB2u, 0.00010000 },
+  { 0x8FBAu, 0.00020000 },
+  { 0x8FBCu, 0.00030000 },
+  { 0x8FC5u, 0.00000000 },
+  { 0x8FCEu, 0.00010000 },
+  { 0x8FD1u, 0.00060000 },
+  { 0x8FD4u, 0.00010000 },
+  { 0x8FEBu, 0.00000000 },
+  { 0x8FEDu, 0.00000000 },
+  { 0x8FF0u, 0.00020000 },
+  { 0x8FF7u, 0.00000000 },
+  { 0x8FFDu, 0.00020000 },
+  { 0x9000u, 0.00040000 },
+  { 0x9001u, 0.00090000 },
+  { 0x9003u, 0.00010000 },
+  { 0x9006u, 0.00010000 },
+  { 0x900Fu, 0.00000000 },
+  { 0x9010u, 0.00000000 },
+  { 0x9013u, 0.00000000 },
+  { 0x9014u, 0.00010000 },
+  { 0x901Au, 0.00120000 },
+  { 0x901Du, 0.00000000 },
+  { 0x901Fu, 0.00030000 },
+  { 0x9020u, 0.00050000 },
+  { 0x9023u, 0.00090000 },
+  { 0x902Eu, 0.00000000 },
+  { 0x9031u, 0.00010000 },
+  { 0x9032u, 0.00060000 },
+  { 0x9038u, 0.00000000 },
+  { 0x9042u, 0.00000000 },
+  { 0x9045u, 0.00010000 },
+  { 0x9047u, 0.00000000 },
+  { 0x904Au, 0.00010000 },
+  { 0x904Bu, 0.00070000 },
+  { 0x904Du, 0.00000000 },
+  { 0x904Eu, 0.00030000 },
+  { 0x9053u, 0.00130000 },
+  { 0x9054u, 0.00030000 },
+  { 0x9055u, 0.00020000 },
+  { 0x905Cu, 0.00000000 },
+  { 0x9060u, 0.00010000 },
+  { 0x9061u, 0.00000000 },
+  { 0x9063u, 0.00010000 },
+  { 0x9069u, 0.00010000 },
+  { 0x906Du, 0.00000000 },
+  { 0x906Eu, 0.00000000 },
+  { 0x9075u, 0.00000000 },
+  { 0x9077u, 0.00000000 },
+  { 0x9078u, 0.00090000 },
+  { 0x907Au, 0.00020000 },
+  { 0x907Fu, 0.00010000 },
+  { 0x9084u, 0.00010000 },
+  { 0x90A3u, 0.00000000 },
+  { 0x90A6u, 0.00010000 },
+  { 0x90AAu, 0.00000000 },
+  { 0x90B8u, 0.00000000 },
+  { 0x90CAu, 0.00000000 },
+  { 0x90CEu, 0.00020000 },
+  { 0x90E1u, 0.00030000 },
+  { 0x90E8u, 0.00190000 },
+  { 0x90EDu, 0.00000000 },
+  { 0x90F5u, 0.00000000 },
+  { 0x90F7u, 0.00010000 },
+  { 0x90FDu, 0.00060000 },
+  { 0x914Cu, 0.00000000 },
+  { 0x914Du, 0.00040000 },
+  { 0x914Eu, 0.00000000 },
+  { 0x9152u, 0.00010000 },
+  { 0x9154u, 0.00000000 },
+  { 0x9162u, 0.00000000 },
+  { 0x916Au, 0.00000000 },
+  { 0x916Cu, 0.00000000 },
+  { 0x9175u, 0.00000000 },
+  { 0x9177u, 0.00000000 },
+  { 0x9178u, 0.00010000 },
+  { 0x9192u, 0.00000000 },
+  { 0x919Cu, 0.00000000 },
+  { 0x91B8u, 0.00000000 },
+  { 0x91C7u, 0.00000000 },
+  { 0x91C8u, 0.00010000 },
+  { 0x91CCu, 0.00010000 },
+  { 0x91CDu, 0.00060000 },
+  { 0x91CEu, 0.00070000 },
+  { 0x91CFu, 0.00030000 },
+  { 0x91D1u, 0.00060000 },
+  { 0x91DCu, 0.00000000 },
+  { 0x91DDu, 0.00010000 },
+  { 0x91E3u, 0.00000000 },
+  { 0x920Du, 0.00000000 },
+  { 0x9234u, 0.00000000 },
+  { 0x9244u, 0.00060000 },
+  { 0x925Bu, 0.00000000 },
+  { 0x9262u, 0.00000000 },
+  { 0x9271u, 0.00000000 },
+  { 0x9280u, 0.00020000 },
+  { 0x9283u, 0.00010000 },
+  { 0x9285u, 0.00000000 },
+  { 0x9298u, 0.00000000 },
+  { 0x92ADu, 0.00000000 },
+  { 0x92EDu, 0.00000000 },
+  { 0x92F3u, 0.00000000 },
+  { 0x92FCu, 0.00000000 },
+  { 0x9320u, 0.00000000 },
+  { 0x9326u, 0.00000000 },
+  { 0x932Cu, 0.00000000 },
+  { 0x932Eu, 0.00000000 },
+  { 0x932Fu, 0.00000000 },
+  { 0x9332u, 0.00050000 },
+  { 0x934Bu, 0.00000000 },
+  { 0x935Bu, 0.00000000 },
+  { 0x9375u, 0.00000000 },
+  { 0x938Cu, 0.00000000 },
+  { 0x9396u, 0.00010000 },
+  { 0x93AEu, 0.00000000 },
+  { 0x93E1u, 0.00000000 },
+  { 0x9418u, 0.00000000 },
+  { 0x9451u, 0.00000000 },
+  { 0x9577u, 0.00140000 },
+  { 0x9580u, 0.00040000 },
+  { 0x9589u, 0.00010000 },
+  { 0x958Bu, 0.00140000 },
+  { 0x9591u, 0.00000000 },
+  { 0x9593u, 0.00160000 },
+  { 0x95A2u, 0.00100000 },
+  { 0x95A3u, 0.00010000 },
+  { 0x95A5u, 0.00000000 },
+  { 0x95B2u, 0.00000000 },
+  { 0x95C7u, 0.00000000 },
+  { 0x95D8u, 0.00020000 },
+  { 0x961Cu, 0.00000000 },
+  { 0x962Au, 0.00030000 },
+  { 0x9632u, 0.00020000 },
+  { 0x963Bu, 0.00000000 },
+  { 0x9644u, 0.00000000 },
+  { 0x964Du, 0.00040000 },
+  { 0x9650u, 0.00030000 },
+  { 0x965Bu, 0.00000000 },
+  { 0x9662u, 0.00040000 },
+  { 0x9663u, 0.00010000 },
+  { 0x9664u, 0.00020000 },
+  { 0x9665u, 0.00000000 },
+  { 0x966Au, 0.00000000 },
+  { 0x9670u, 0.00000000 },
+  { 0x9673u, 0.00000000 },
+  { 0x9675u, 0.00000000 },
+  { 0x9676u, 0.00000000 },
+  { 0x9678u, 0.00030000 },
+  { 0x967Au, 0.00010000 },
+  { 0x967Du, 0.00010000 },
+  { 0x9685u, 0.00000000 },
+  { 0x9686u, 0.00010000 },
+  { 0x968Au, 0.00050000 },
+  { 0x968Eu, 0.00020000 },
+  { 0x968Fu, 0.00000000 },
+  { 0x9694u, 0.00000000 },
+  { 0x9699u, 0.00000000 },
+  { 0x969Bu, 0.00060000 },
+  { 0x969Cu, 0.00010000 },
+  { 0x96A0u, 0.00010000 },
+  { 0x96A3u, 0.00010000 },
+  { 0x96B7u, 0.00000000 },
+  { 0x96BBu, 0.00010000 },
+  { 0x96C4u, 0.00010000 },
+  { 0x96C5u, 0.00000000 },
+  { 0x96C6u, 0.00050000 },
+  { 0x96C7u, 0.00000000 },
+  { 0x96CCu, 0.00000000 },
+  { 0x96D1u, 0.00010000 },
+  { 0x96E2u, 0.00030000 },
+  { 0x96E3u, 0.00020000 },
+  { 0x96E8u, 0.00010000 },
+  { 0x96EAu, 0.00010000 },
+  { 0x96F0u, 0.00000000 },
+  { 0x96F2u, 0.00010000 },
+  { 0x96F6u, 0.00000000 },
+  { 0x96F7u, 0.00010000 },
+  { 0x96FBu, 0.00070000 },
+  { 0x9700u, 0.00000000 },
+  { 0x9707u, 0.00010000 },
+  { 0x970Au, 0.00010000 },
+  { 0x971Cu, 0.00000000 },
+  { 0x9727u, 0.00000000 },
+  { 0x9732u, 0.00010000 },
+  { 0x9752u, 0.00020000 },
+  { 0x9759u, 0.00010000 },
+  { 0x975Eu, 0.00020000 },
+  { 0x9762u, 0.00070000 },
+  { 0x9769u, 0.00010000 },
+  { 0x9774u, 0.00000000 },
+  { 0x97D3u, 0.00010000 },
+  { 0x97F3u, 0.00050000 },
+  { 0x97FBu, 0.00000000 },
+  { 0x97FFu, 0.00020000 },
+  { 0x9802u, 0.00000000 },
+  { 0x9803u, 0.00020000 },
+  { 0x9805u, 0.00010000 },
+  { 0x9806u, 0.00010000 },
+  { 0x9808u, 0.00010000 },
+  { 0x9810u, 0.00000000 },
+  { 0x9811u, 0.00000000 },
+  { 0x9812u, 0.00000000 },
+  { 0x9813u, 0.00000000 },
+  { 0x9818u, 0.00030000 },
+  { 0x982Cu, 0.00000000 },
+  { 0x982Du, 0.00030000 },
+  { 0x983Bu, 0.00000000 },
+  { 0x983Cu, 0.00010000 },
+  { 0x984Cu, 0.00040000 },
+  { 0x984Du, 0.00010000 },
+  { 0x984Eu, 0.00000000 },
+  { 0x9854u, 0.00010000 },
+  { 0x9855u, 0.00000000 },
+  { 0x9858u, 0.00010000 },
+  { 0x985Eu, 0.00030000 },
+  { 0x9867u, 0.00000000 },
+  { 0x98A8u, 0.00020000 },
+  { 0x98DBu, 0.00020000 },
+  { 0x98DFu, 0.00020000 },
+  { 0x98E2u, 0.00000000 },
+  { 0x98EFu, 0.00000000 },
+  { 0x98F2u, 0.00000000 },
+  { 0x98FCu, 0.00000000 },
+  { 0x98FDu, 0.00000000 },
+  { 0x98FEu, 0.00010000 },
+  { 0x9905u, 0.00000000 },
+  { 0x990Au, 0.00010000 },
+  { 0x990Cu, 0.00000000 },
+  { 0x9913u, 0.00000000 },
+  { 0x9928u, 0.00030000 },
+  { 0x9996u, 0.00020000 },
+  { 0x9999u, 0.00010000 },
+  { 0x99ACu, 0.00040000 },
+  { 0x99C4u, 0.00000000 },
+  { 0x99C5u, 0.00090000 },
+  { 0x99C6u, 0.00010000 },
+  { 0x99D0u, 0.00010000 },
+  { 0x99D2u, 0.00000000 },
+  { 0x9A0Eu, 0.00010000 },
+  { 0x9A12u, 0.00000000 },
+  { 0x9A13u, 0.00020000 },
+  { 0x9A30u, 0.00000000 },
+  { 0x9A5Au, 0.00000000 },
+  { 0x9AA8u, 0.00010000 },
+  { 0x9AB8u, 0.00000000 },
+  { 0x9AC4u, 0.00000000 },
+  { 0x9AD8u, 0.00140000 },
+  { 0x9AEAu, 0.00000000 },
+  { 0x9B31u, 0.00000000 },
+  { 0x9B3Cu, 0.00000000 },
+  { 0x9B42u, 0.00000000 },
+  { 0x9B45u, 0.00000000 },
+  { 0x9B54u, 0.00010000 },
+  { 0x9B5Au, 0.00010000 },
+  { 0x9BAEu, 0.00010000 },
+  { 0x9BE8u, 0.00000000 },
+  { 0x9CE5u, 0.00010000 },
+  { 0x9CF4u, 0.00000000 },
+  { 0x9D8Fu, 0.00000000 },
+  { 0x9DB4u, 0.00000000 },
+  { 0x9E7Fu, 0.00010000 },
+  { 0x9E93u, 0.00000000 },
+  { 0x9E97u, 0.00000000 },
+  { 0x9EA6u, 0.00000000 },
+  { 0x9EBAu, 0.00000000 },
+  { 0x9EBBu, 0.00010000 },
+  { 0x9EC4u, 0.00010000 },
+  { 0x9ED2u, 0.00020000 },
+  { 0x9ED9u, 0.00000000 },
+  { 0x9F13u, 0.00000000 },
+  { 0x9F3Bu, 0.00000000 },
+  { 0x9F62u, 0.00010000 },
+};
+
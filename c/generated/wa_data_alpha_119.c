@@ -0,0 +1,211 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_119_UPPER[] = {
+  "ア",
+  "イ",
+  "ウ",
+  "エ",
+  "オ",
+  "カ",
+  "キ",
+  "ク",
+  "ケ",
+  "コ",
+  "サ",
+  "シ",
+  "ス",
+  "セ",
+  "ソ",
+  "タ",
+  "チ",
+  "ツ",
+  "テ",
+  "ト",
+  "ナ",
+  "ニ",
+  "ヌ",
+  "ネ",
+  "ノ",
+  "ハ",
+  "ヒ",
+  "フ",
+  "ヘ",
+  "ホ",
+  "マ",
+  "ミ",
+  "ム",
+  "メ",
+  "モ",
+  "ヤ",
+  "ユ",
+  "ヨ",
+  "ラ",
+  "リ",
+  "ル",
+  "レ",
+  "ロ",
+  "ワ",
+  "ヲ",
+  "ン",
+};
+const char *ALPHA_119_LOWER[] = {
+  "ア",
+  "イ",
+  "ウ",
+  "エ",
+  "オ",
+  "カ",
+  "キ",
+  "ク",
+  "ケ",
+  "コ",
+  "サ",
+  "シ",
+  "ス",
+  "セ",
+  "ソ",
+  "タ",
+  "チ",
+  "ツ",
+  "テ",
+  "ト",
+  "ナ",
+  "ニ",
+  "ヌ",
+  "ネ",
+  "ノ",
+  "ハ",
+  "ヒ",
+  "フ",
+  "ヘ",
+  "ホ",
+  "マ",
+  "ミ",
+  "ム",
+  "メ",
+  "モ",
+  "ヤ",
+  "ユ",
+  "ヨ",
+  "ラ",
+  "リ",
+  "ル",
+  "レ",
+  "ロ",
+  "ワ",
+  "ヲ",
+  "ン",
+};
+const char *ALPHA_119_DIGITS[] = {
+};
+const uint32_t ALPHA_119_UPPER_CPS[] = {
+  12450, 12452, 12454, 12456, 12458, 12459, 12461, 12463, 12465, 12467, 12469, 12471, 12473, 12475, 12477, 12479,
+  12481, 12484, 12486, 12488, 12490, 12491, 12492, 12493, 12494, 12495, 12498, 12501, 12504, 12507, 12510, 12511,
+  12512, 12513, 12514, 12516, 12518, 12520, 12521, 12522, 12523, 12524, 12525, 12527, 12530, 12531,
+};
+const uint32_t ALPHA_119_LOWER_CPS[] = {
+  12450, 12452, 12454, 12456, 12458, 12459, 12461, 12463, 12465, 12467, 12469, 12471, 12473, 12475, 12477, 12479,
+  12481, 12484, 12486, 12488, 12490, 12491, 12492, 12493, 12494, 12495, 12498, 12501, 12504, 12507, 12510, 12511,
+  12512, 12513, 12514, 12516, 12518, 12520, 12521, 12522, 12523, 12524, 12525, 12527, 12530, 12531,
+};
+const uint32_t ALPHA_119_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_119_FREQ[] = {
+  { "ア", 0.04640000 },
+  { "イ", 0.05130000 },
+  { "ウ", 0.01520000 },
+  { "エ", 0.01360000 },
+  { "オ", 0.01710000 },
+  { "カ", 0.02320000 },
+  { "キ", 0.01260000 },
+  { "ク", 0.03680000 },
+  { "ケ", 0.00590000 },
+  { "コ", 0.01790000 },
+  { "サ", 0.01450000 },
+  { "シ", 0.03070000 },
+  { "ス", 0.06960000 },
+  { "セ", 0.00830000 },
+  { "ソ", 0.00720000 },
+  { "タ", 0.02860000 },
+  { "チ", 0.01470000 },
+  { "ツ", 0.00770000 },
+  { "テ", 0.02090000 },
+  { "ト", 0.05350000 },
+  { "ナ", 0.01390000 },
+  { "ニ", 0.01490000 },
+  { "ヌ", 0.00140000 },
+  { "ネ", 0.00810000 },
+  { "ノ", 0.00610000 },
+  { "ハ", 0.00830000 },
+  { "ヒ", 0.00350000 },
+  { "フ", 0.02660000 },
+  { "ヘ", 0.00250000 },
+  { "ホ", 0.00510000 },
+  { "マ", 0.01980000 },
+  { "ミ", 0.01010000 },
+  { "ム", 0.02160000 },
+  { "メ", 0.01660000 },
+  { "モ", 0.00830000 },
+  { "ヤ", 0.00390000 },
+  { "ユ", 0.00280000 },
+  { "ヨ", 0.00260000 },
+  { "ラ", 0.04440000 },
+  { "リ", 0.04940000 },
+  { "ル", 0.06480000 },
+  { "レ", 0.02610000 },
+  { "ロ", 0.02640000 },
+  { "ワ", 0.00600000 },
+  { "ヲ", 0.00010000 },
+  { "ン", 0.11120000 },
+};
+
+const wa_cp_freq ALPHA_119_FREQ_CPS[] = {
+  { 0x30A2u, 0.04640000 },
+  { 0x30A4u, 0.05130000 },
+  { 0x30A6u, 0.01520000 },
+  { 0x30A8u, 0.01360000 },
+  { 0x30AAu, 0.01710000 },
+  { 0x30ABu, 0.02320000 },
+  { 0x30ADu, 0.01260000 },
+  { 0x30AFu, 0.03680000 },
+  { 0x30B1u, 0.00590000 },
+  { 0x30B3u, 0.01790000 },
+  { 0x30B5u, 0.01450000 },
+  { 0x30B7u, 0.03070000 },
+  { 0x30B9u, 0.06960000 },
+  { 0x30BBu, 0.00830000 },
+  { 0x30BDu, 0.00720000 },
+  { 0x30BFu, 0.02860000 },
+  { 0x30C1u, 0.01470000 },
+  { 0x30C4u, 0.00770000 },
+  { 0x30C6u, 0.02090000 },
+  { 0x30C8u, 0.05350000 },
+  { 0x30CAu, 0.01390000 },
+  { 0x30CBu, 0.01490000 },
+  { 0x30CCu, 0.00140000 },
+  { 0x30CDu, 0.00810000 },
+  { 0x30CEu, 0.00610000 },
+  { 0x30CFu, 0.00830000 },
+  { 0x30D2u, 0.00350000 },
+  { 0x30D5u, 0.02660000 },
+  { 0x30D8u, 0.00250000 },
+  { 0x30DBu, 0.00510000 },
+  { 0x30DEu, 0.01980000 },
+  { 0x30DFu, 0.01010000 },
+  { 0x30E0u, 0.02160000 },
+  { 0x30E1u, 0.01660000 },
+  { 0x30E2u, 0.00830000 },
+  { 0x30E4u, 0.00390000 },
+  { 0x30E6u, 0.00280000 },
+  { 0x30E8u, 0.00260000 },
+  { 0x30E9u, 0.04440000 },
+  { 0x30EAu, 0.04940000 },
+  { 0x30EBu, 0.06480000 },
+  { 0x30ECu, 0.02610000 },
+  { 0x30EDu, 0.02640000 },
+  { 0x30EFu, 0.00600000 },
+  { 0x30F2u, 0.00010000 },
+  { 0x30F3u, 0.11120000 },
+};
+
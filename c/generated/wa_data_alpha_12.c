@@ -0,0 +1,163 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_12_UPPER[] = {
+  "A",
+  "Á",
+  "B",
+  "C",
+  "D",
+  "E",
+  "É",
+  "F",
+  "G",
+  "H",
+  "Ḥ",
+  "I",
+  "Í",
+  "L",
+  "Ḷ",
+  "M",
+  "N",
+  "Ñ",
+  "O",
+  "Ó",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "Ú",
+  "Ü",
+  "V",
+  "X",
+  "Y",
+  "Z",
+};
+const char *ALPHA_12_LOWER[] = {
+  "a",
+  "á",
+  "b",
+  "c",
+  "d",
+  "e",
+  "é",
+  "f",
+  "g",
+  "h",
+  "ḥ",
+  "i",
+  "í",
+  "l",
+  "ḷ",
+  "m",
+  "n",
+  "ñ",
+  "o",
+  "ó",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "ú",
+  "ü",
+  "v",
+  "x",
+  "y",
+  "z",
+};
+const char *ALPHA_12_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_12_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 76, 77, 78, 79, 80, 81, 82,
+  83, 84, 85, 86, 88, 89, 90, 193, 201, 205, 209, 211, 218, 220, 7716, 7734,
+};
+const uint32_t ALPHA_12_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 108, 109, 110, 111, 112, 113, 114,
+  115, 116, 117, 118, 120, 121, 122, 225, 233, 237, 241, 243, 250, 252, 7717, 7735,
+};
+const uint32_t ALPHA_12_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_12_FREQ[] = {
+  { "a", 0.10980000 },
+  { "á", 0.00740000 },
+  { "b", 0.01230000 },
+  { "c", 0.04340000 },
+  { "d", 0.04560000 },
+  { "e", 0.12660000 },
+  { "é", 0.00410000 },
+  { "f", 0.01010000 },
+  { "g", 0.01150000 },
+  { "h", 0.00590000 },
+  { "ḥ", 0.00000000 },
+  { "i", 0.06770000 },
+  { "í", 0.00640000 },
+  { "l", 0.06470000 },
+  { "ḷ", 0.00010000 },
+  { "m", 0.02880000 },
+  { "n", 0.07410000 },
+  { "ñ", 0.00230000 },
+  { "o", 0.06830000 },
+  { "ó", 0.00800000 },
+  { "p", 0.02540000 },
+  { "q", 0.00690000 },
+  { "r", 0.06300000 },
+  { "s", 0.07180000 },
+  { "t", 0.04690000 },
+  { "u", 0.05450000 },
+  { "ú", 0.00160000 },
+  { "ü", 0.00030000 },
+  { "v", 0.00940000 },
+  { "x", 0.00650000 },
+  { "y", 0.01290000 },
+  { "z", 0.00350000 },
+};
+
+const wa_cp_freq ALPHA_12_FREQ_CPS[] = {
+  { 0x61u, 0.10980000 },
+  { 0x62u, 0.01230000 },
+  { 0x63u, 0.04340000 },
+  { 0x64u, 0.04560000 },
+  { 0x65u, 0.12660000 },
+  { 0x66u, 0.01010000 },
+  { 0x67u, 0.01150000 },
+  { 0x68u, 0.00590000 },
+  { 0x69u, 0.06770000 },
+  { 0x6Cu, 0.06470000 },
+  { 0x6Du, 0.02880000 },
+  { 0x6Eu, 0.07410000 },
+  { 0x6Fu, 0.06830000 },
+  { 0x70u, 0.02540000 },
+  { 0x71u, 0.00690000 },
+  { 0x72u, 0.06300000 },
+  { 0x73u, 0.07180000 },
+  { 0x74u, 0.04690000 },
+  { 0x75u, 0.05450000 },
+  { 0x76u, 0.00940000 },
+  { 0x78u, 0.00650000 },
+  { 0x79u, 0.01290000 },
+  { 0x7Au, 0.00350000 },
+  { 0xE1u, 0.00740000 },
+  { 0xE9u, 0.00410000 },
+  { 0xEDu, 0.00640000 },
+  { 0xF1u, 0.00230000 },
+  { 0xF3u, 0.00800000 },
+  { 0xFAu, 0.00160000 },
+  { 0xFCu, 0.00030000 },
+  { 0x1E25u, 0.00000000 },
+  { 0x1E37u, 0.00010000 },
+};
+
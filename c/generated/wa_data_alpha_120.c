@@ -0,0 +1,131 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_120_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "X",
+  "Y",
+  "Z",
+};
+const char *ALPHA_120_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "x",
+  "y",
+  "z",
+};
+const char *ALPHA_120_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_120_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  82, 83, 84, 85, 86, 88, 89, 90,
+};
+const uint32_t ALPHA_120_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  114, 115, 116, 117, 118, 120, 121, 122,
+};
+const uint32_t ALPHA_120_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_120_FREQ[] = {
+  { "a", 0.10810000 },
+  { "b", 0.02410000 },
+  { "c", 0.03930000 },
+  { "d", 0.02440000 },
+  { "e", 0.09250000 },
+  { "f", 0.01350000 },
+  { "g", 0.02030000 },
+  { "h", 0.00130000 },
+  { "i", 0.12100000 },
+  { "j", 0.01860000 },
+  { "k", 0.02780000 },
+  { "l", 0.08230000 },
+  { "m", 0.03150000 },
+  { "n", 0.05880000 },
+  { "o", 0.08610000 },
+  { "p", 0.01920000 },
+  { "r", 0.04280000 },
+  { "s", 0.04600000 },
+  { "t", 0.03650000 },
+  { "u", 0.06800000 },
+  { "v", 0.01020000 },
+  { "x", 0.00770000 },
+  { "y", 0.00980000 },
+  { "z", 0.01010000 },
+};
+
+const wa_cp_freq ALPHA_120_FREQ_CPS[] = {
+  { 0x61u, 0.10810000 },
+  { 0x62u, 0.02410000 },
+  { 0x63u, 0.03930000 },
+  { 0x64u, 0.02440000 },
+  { 0x65u, 0.09250000 },
+  { 0x66u, 0.01350000 },
+  { 0x67u, 0.02030000 },
+  { 0x68u, 0.00130000 },
+  { 0x69u, 0.12100000 },
+  { 0x6Au, 0.01860000 },
+  { 0x6Bu, 0.02780000 },
+  { 0x6Cu, 0.08230000 },
+  { 0x6Du, 0.03150000 },
+  { 0x6Eu, 0.05880000 },
+  { 0x6Fu, 0.08610000 },
+  { 0x70u, 0.01920000 },
+  { 0x72u, 0.04280000 },
+  { 0x73u, 0.04600000 },
+  { 0x74u, 0.03650000 },
+  { 0x75u, 0.06800000 },
+  { 0x76u, 0.01020000 },
+  { 0x78u, 0.00770000 },
+  { 0x79u, 0.00980000 },
+  { 0x7Au, 0.01010000 },
+};
+
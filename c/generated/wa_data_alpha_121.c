@@ -0,0 +1,193 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_121_UPPER[] = {
+  "A",
+  "Á",
+  "Â",
+  "Ǎ",
+  "B",
+  "C",
+  "D",
+  "Ɛ",
+  "F",
+  "G",
+  "H",
+  "I",
+  "Í",
+  "Î",
+  "Ǐ",
+  "J",
+  "K",
+  "L",
+  "M",
+  "Ḿ",
+  "N",
+  "Ń",
+  "Ǹ",
+  "Ŋ",
+  "Ɔ",
+  "P",
+  "S",
+  "T",
+  "U",
+  "Ú",
+  "Û",
+  "Ǔ",
+  "Ʉ",
+  "V",
+  "W",
+  "Ẅ",
+  "Y",
+  "Z",
+  "Ꞌ",
+};
+const char *ALPHA_121_LOWER[] = {
+  "a",
+  "á",
+  "â",
+  "ǎ",
+  "b",
+  "c",
+  "d",
+  "ɛ",
+  "f",
+  "g",
+  "h",
+  "i",
+  "í",
+  "î",
+  "ǐ",
+  "j",
+  "k",
+  "l",
+  "m",
+  "ḿ",
+  "n",
+  "ń",
+  "ǹ",
+  "ŋ",
+  "ɔ",
+  "p",
+  "s",
+  "t",
+  "u",
+  "ú",
+  "û",
+  "ǔ",
+  "ʉ",
+  "v",
+  "w",
+  "ẅ",
+  "y",
+  "z",
+  "ꞌ",
+};
+const char *ALPHA_121_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_121_UPPER_CPS[] = {
+  65, 66, 67, 68, 70, 71, 72, 73, 74, 75, 76, 77, 78, 80, 83, 84,
+  85, 86, 87, 89, 90, 193, 194, 205, 206, 218, 219, 323, 330, 390, 400, 461,
+  463, 467, 504, 580, 7742, 7812, 42891,
+};
+const uint32_t ALPHA_121_LOWER_CPS[] = {
+  97, 98, 99, 100, 102, 103, 104, 105, 106, 107, 108, 109, 110, 112, 115, 116,
+  117, 118, 119, 121, 122, 225, 226, 237, 238, 250, 251, 324, 331, 462, 464, 468,
+  505, 596, 603, 649, 7743, 7813, 42892,
+};
+const uint32_t ALPHA_121_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_121_FREQ[] = {
+  { "a", 0.00000000 },
+  { "á", 0.00000000 },
+  { "â", 0.00000000 },
+  { "ǎ", 0.00000000 },
+  { "b", 0.00000000 },
+  { "c", 0.00000000 },
+  { "d", 0.00000000 },
+  { "ɛ", 0.00000000 },
+  { "f", 0.00000000 },
+  { "g", 0.00000000 },
+  { "h", 0.00000000 },
+  { "i", 0.00000000 },
+  { "í", 0.00000000 },
+  { "î", 0.00000000 },
+  { "ǐ", 0.00000000 },
+  { "j", 0.00000000 },
+  { "k", 0.00000000 },
+  { "l", 0.00000000 },
+  { "m", 0.00000000 },
+  { "ḿ", 0.00000000 },
+  { "n", 0.00000000 },
+  { "ń", 0.00000000 },
+  { "ǹ", 0.00000000 },
+  { "ŋ", 0.00000000 },
+  { "ɔ", 0.00000000 },
+  { "p", 0.00000000 },
+  { "s", 0.00000000 },
+  { "t", 0.00000000 },
+  { "u", 0.00000000 },
+  { "ú", 0.00000000 },
+  { "û", 0.00000000 },
+  { "ǔ", 0.00000000 },
+  { "ʉ", 0.00000000 },
+  { "v", 0.00000000 },
+  { "w", 0.00000000 },
+  { "ẅ", 0.00000000 },
+  { "y", 0.00000000 },
+  { "z", 0.00000000 },
+  { "ꞌ", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_121_FREQ_CPS[] = {
+  { 0x61u, 0.00000000 },
+  { 0x62u, 0.00000000 },
+  { 0x63u, 0.00000000 },
+  { 0x64u, 0.00000000 },
+  { 0x66u, 0.00000000 },
+  { 0x67u, 0.00000000 },
+  { 0x68u, 0.00000000 },
+  { 0x69u, 0.00000000 },
+  { 0x6Au, 0.00000000 },
+  { 0x6Bu, 0.00000000 },
+  { 0x6Cu, 0.00000000 },
+  { 0x6Du, 0.00000000 },
+  { 0x6Eu, 0.00000000 },
+  { 0x70u, 0.00000000 },
+  { 0x73u, 0.00000000 },
+  { 0x74u, 0.00000000 },
+  { 0x75u, 0.00000000 },
+  { 0x76u, 0.00000000 },
+  { 0x77u, 0.00000000 },
+  { 0x79u, 0.00000000 },
+  { 0x7Au, 0.00000000 },
+  { 0xE1u, 0.00000000 },
+  { 0xE2u, 0.00000000 },
+  { 0xEDu, 0.00000000 },
+  { 0xEEu, 0.00000000 },
+  { 0xFAu, 0.00000000 },
+  { 0xFBu, 0.00000000 },
+  { 0x144u, 0.00000000 },
+  { 0x14Bu, 0.00000000 },
+  { 0x1CEu, 0.00000000 },
+  { 0x1D0u, 0.00000000 },
+  { 0x1D4u, 0.00000000 },
+  { 0x1F9u, 0.00000000 },
+  { 0x254u, 0.00000000 },
+  { 0x25Bu, 0.00000000 },
+  { 0x289u, 0.00000000 },
+  { 0x1E3Fu, 0.00000000 },
+  { 0x1E85u, 0.00000000 },
+  { 0xA78Cu, 0.00000000 },
+};
+
@@ -0,0 +1,141 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_122_UPPER[] = {
+  "A",
+  "Â",
+  "Å",
+  "B",
+  "C",
+  "D",
+  "E",
+  "É",
+  "È",
+  "Ê",
+  "G",
+  "H",
+  "I",
+  "Ì",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "Ò",
+  "P",
+  "R",
+  "S",
+  "T",
+  "U",
+  "Ù",
+  "W",
+  "Y",
+};
+const char *ALPHA_122_LOWER[] = {
+  "a",
+  "â",
+  "å",
+  "b",
+  "c",
+  "d",
+  "e",
+  "é",
+  "è",
+  "ê",
+  "g",
+  "h",
+  "i",
+  "ì",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "ò",
+  "p",
+  "r",
+  "s",
+  "t",
+  "u",
+  "ù",
+  "w",
+  "y",
+};
+const char *ALPHA_122_DIGITS[] = {
+};
+const uint32_t ALPHA_122_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 82,
+  83, 84, 85, 87, 89, 194, 197, 200, 201, 202, 204, 210, 217,
+};
+const uint32_t ALPHA_122_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 114,
+  115, 116, 117, 119, 121, 226, 229, 232, 233, 234, 236, 242, 249,
+};
+const uint32_t ALPHA_122_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_122_FREQ[] = {
+  { "a", 0.17640000 },
+  { "â", 0.00000000 },
+  { "å", 0.00000000 },
+  { "b", 0.02040000 },
+  { "c", 0.00880000 },
+  { "d", 0.03080000 },
+  { "e", 0.05290000 },
+  { "é", 0.01240000 },
+  { "è", 0.00470000 },
+  { "ê", 0.00000000 },
+  { "g", 0.05700000 },
+  { "h", 0.02400000 },
+  { "i", 0.09330000 },
+  { "ì", 0.00000000 },
+  { "j", 0.01150000 },
+  { "k", 0.05200000 },
+  { "l", 0.03490000 },
+  { "m", 0.02990000 },
+  { "n", 0.11760000 },
+  { "o", 0.03060000 },
+  { "ò", 0.00000000 },
+  { "p", 0.02690000 },
+  { "r", 0.04420000 },
+  { "s", 0.04900000 },
+  { "t", 0.04350000 },
+  { "u", 0.05050000 },
+  { "ù", 0.00000000 },
+  { "w", 0.01800000 },
+  { "y", 0.01070000 },
+};
+
+const wa_cp_freq ALPHA_122_FREQ_CPS[] = {
+  { 0x61u, 0.17640000 },
+  { 0x62u, 0.02040000 },
+  { 0x63u, 0.00880000 },
+  { 0x64u, 0.03080000 },
+  { 0x65u, 0.05290000 },
+  { 0x67u, 0.05700000 },
+  { 0x68u, 0.02400000 },
+  { 0x69u, 0.09330000 },
+  { 0x6Au, 0.01150000 },
+  { 0x6Bu, 0.05200000 },
+  { 0x6Cu, 0.03490000 },
+  { 0x6Du, 0.02990000 },
+  { 0x6Eu, 0.11760000 },
+  { 0x6Fu, 0.03060000 },
+  { 0x70u, 0.02690000 },
+  { 0x72u, 0.04420000 },
+  { 0x73u, 0.04900000 },
+  { 0x74u, 0.04350000 },
+  { 0x75u, 0.05050000 },
+  { 0x77u, 0.01800000 },
+  { 0x79u, 0.01070000 },
+  { 0xE2u, 0.00000000 },
+  { 0xE5u, 0.00000000 },
+  { 0xE8u, 0.00470000 },
+  { 0xE9u, 0.01240000 },
+  { 0xEAu, 0.00000000 },
+  { 0xECu, 0.00000000 },
+  { 0xF2u, 0.00000000 },
+  { 0xF9u, 0.00000000 },
+};
+
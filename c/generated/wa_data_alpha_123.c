@@ -0,0 +1,159 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_123_UPPER[] = {
+  "ა",
+  "ბ",
+  "გ",
+  "დ",
+  "ე",
+  "ვ",
+  "ზ",
+  "თ",
+  "ი",
+  "კ",
+  "ლ",
+  "მ",
+  "ნ",
+  "ო",
+  "პ",
+  "ჟ",
+  "რ",
+  "ს",
+  "ტ",
+  "უ",
+  "ფ",
+  "ქ",
+  "ღ",
+  "ყ",
+  "შ",
+  "ჩ",
+  "ც",
+  "ძ",
+  "წ",
+  "ჭ",
+  "ხ",
+  "ჯ",
+  "ჰ",
+};
+const char *ALPHA_123_LOWER[] = {
+  "ა",
+  "ბ",
+  "გ",
+  "დ",
+  "ე",
+  "ვ",
+  "ზ",
+  "თ",
+  "ი",
+  "კ",
+  "ლ",
+  "მ",
+  "ნ",
+  "ო",
+  "პ",
+  "ჟ",
+  "რ",
+  "ს",
+  "ტ",
+  "უ",
+  "ფ",
+  "ქ",
+  "ღ",
+  "ყ",
+  "შ",
+  "ჩ",
+  "ც",
+  "ძ",
+  "წ",
+  "ჭ",
+  "ხ",
+  "ჯ",
+  "ჰ",
+};
+const char *ALPHA_123_DIGITS[] = {
+};
+const uint32_t ALPHA_123_UPPER_CPS[] = {
+  4304, 4305, 4306, 4307, 4308, 4309, 4310, 4311, 4312, 4313, 4314, 4315, 4316, 4317, 4318, 4319,
+  4320, 4321, 4322, 4323, 4324, 4325, 4326, 4327, 4328, 4329, 4330, 4331, 4332, 4333, 4334, 4335,
+  4336,
+};
+const uint32_t ALPHA_123_LOWER_CPS[] = {
+  4304, 4305, 4306, 4307, 4308, 4309, 4310, 4311, 4312, 4313, 4314, 4315, 4316, 4317, 4318, 4319,
+  4320, 4321, 4322, 4323, 4324, 4325, 4326, 4327, 4328, 4329, 4330, 4331, 4332, 4333, 4334, 4335,
+  4336,
+};
+const uint32_t ALPHA_123_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_123_FREQ[] = {
+  { "ა", 0.12810000 },
+  { "ბ", 0.03170000 },
+  { "გ", 0.01910000 },
+  { "დ", 0.03860000 },
+  { "ე", 0.08430000 },
+  { "ვ", 0.02770000 },
+  { "ზ", 0.00760000 },
+  { "თ", 0.02260000 },
+  { "ი", 0.11780000 },
+  { "კ", 0.01490000 },
+  { "ლ", 0.04570000 },
+  { "მ", 0.04660000 },
+  { "ნ", 0.03960000 },
+  { "ო", 0.04920000 },
+  { "პ", 0.00830000 },
+  { "ჟ", 0.00070000 },
+  { "რ", 0.05650000 },
+  { "ს", 0.06680000 },
+  { "ტ", 0.01770000 },
+  { "უ", 0.02540000 },
+  { "ფ", 0.00770000 },
+  { "ქ", 0.00890000 },
+  { "ღ", 0.00450000 },
+  { "ყ", 0.00540000 },
+  { "შ", 0.01580000 },
+  { "ჩ", 0.00310000 },
+  { "ც", 0.01090000 },
+  { "ძ", 0.00360000 },
+  { "წ", 0.01000000 },
+  { "ჭ", 0.00110000 },
+  { "ხ", 0.01250000 },
+  { "ჯ", 0.00230000 },
+  { "ჰ", 0.00120000 },
+};
+
+const wa_cp_freq ALPHA_123_FREQ_CPS[] = {
+  { 0x10D0u, 0.12810000 },
+  { 0x10D1u, 0.03170000 },
+  { 0x10D2u, 0.01910000 },
+  { 0x10D3u, 0.03860000 },
+  { 0x10D4u, 0.08430000 },
+  { 0x10D5u, 0.02770000 },
+  { 0x10D6u, 0.00760000 },
+  { 0x10D7u, 0.02260000 },
+  { 0x10D8u, 0.11780000 },
+  { 0x10D9u, 0.01490000 },
+  { 0x10DAu, 0.04570000 },
+  { 0x10DBu, 0.04660000 },
+  { 0x10DCu, 0.03960000 },
+  { 0x10DDu, 0.04920000 },
+  { 0x10DEu, 0.00830000 },
+  { 0x10DFu, 0.00070000 },
+  { 0x10E0u, 0.05650000 },
+  { 0x10E1u, 0.06680000 },
+  { 0x10E2u, 0.01770000 },
+  { 0x10E3u, 0.02540000 },
+  { 0x10E4u, 0.00770000 },
+  { 0x10E5u, 0.00890000 },
+  { 0x10E6u, 0.00450000 },
+  { 0x10E7u, 0.00540000 },
+  { 0x10E8u, 0.01580000 },
+  { 0x10E9u, 0.00310000 },
+  { 0x10EAu, 0.01090000 },
+  { 0x10EBu, 0.00360000 },
+  { 0x10ECu, 0.01000000 },
+  { 0x10EDu, 0.00110000 },
+  { 0x10EEu, 0.01250000 },
+  { 0x10EFu, 0.00230000 },
+  { 0x10F0u, 0.00120000 },
+};
+
@@ -0,0 +1,201 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_124_UPPER[] = {
+  "А",
+  "Ә",
+  "Б",
+  "В",
+  "Г",
+  "Ғ",
+  "Д",
+  "Е",
+  "Ё",
+  "Ж",
+  "З",
+  "И",
+  "Й",
+  "К",
+  "Қ",
+  "Л",
+  "М",
+  "Н",
+  "Ң",
+  "О",
+  "Ө",
+  "П",
+  "Р",
+  "С",
+  "Т",
+  "У",
+  "Ў",
+  "Ү",
+  "Ф",
+  "Х",
+  "Ҳ",
+  "Ц",
+  "Ч",
+  "Ш",
+  "Щ",
+  "Ъ",
+  "Ы",
+  "Ь",
+  "Э",
+  "Ю",
+  "Я",
+};
+const char *ALPHA_124_LOWER[] = {
+  "а",
+  "ә",
+  "б",
+  "в",
+  "г",
+  "ғ",
+  "д",
+  "е",
+  "ё",
+  "ж",
+  "з",
+  "и",
+  "й",
+  "к",
+  "қ",
+  "л",
+  "м",
+  "н",
+  "ң",
+  "о",
+  "ө",
+  "п",
+  "р",
+  "с",
+  "т",
+  "у",
+  "ў",
+  "ү",
+  "ф",
+  "х",
+  "ҳ",
+  "ц",
+  "ч",
+  "ш",
+  "щ",
+  "ъ",
+  "ы",
+  "ь",
+  "э",
+  "ю",
+  "я",
+};
+const char *ALPHA_124_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_124_UPPER_CPS[] = {
+  1025, 1038, 1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053,
+  1054, 1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069,
+  1070, 1071, 1170, 1178, 1186, 1198, 1202, 1240, 1256,
+};
+const uint32_t ALPHA_124_LOWER_CPS[] = {
+  1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080, 1081, 1082, 1083, 1084, 1085, 1086, 1087,
+  1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103,
+  1105, 1118, 1171, 1179, 1187, 1199, 1203, 1241, 1257,
+};
+const uint32_t ALPHA_124_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_124_FREQ[] = {
+  { "а", 0.12770000 },
+  { "ә", 0.00170000 },
+  { "б", 0.01490000 },
+  { "в", 0.05640000 },
+  { "г", 0.01490000 },
+  { "ғ", 0.00330000 },
+  { "д", 0.02160000 },
+  { "е", 0.07130000 },
+  { "ё", 0.00660000 },
+  { "ж", 0.00500000 },
+  { "з", 0.00330000 },
+  { "и", 0.09620000 },
+  { "й", 0.02160000 },
+  { "к", 0.05140000 },
+  { "қ", 0.00500000 },
+  { "л", 0.05310000 },
+  { "м", 0.01330000 },
+  { "н", 0.04980000 },
+  { "ң", 0.00170000 },
+  { "о", 0.07630000 },
+  { "ө", 0.00170000 },
+  { "п", 0.01990000 },
+  { "р", 0.06140000 },
+  { "с", 0.06470000 },
+  { "т", 0.03480000 },
+  { "у", 0.01820000 },
+  { "ў", 0.00000000 },
+  { "ү", 0.00170000 },
+  { "ф", 0.01000000 },
+  { "х", 0.01490000 },
+  { "ҳ", 0.00000000 },
+  { "ц", 0.00330000 },
+  { "ч", 0.03150000 },
+  { "ш", 0.00500000 },
+  { "щ", 0.00170000 },
+  { "ъ", 0.00170000 },
+  { "ы", 0.00830000 },
+  { "ь", 0.01000000 },
+  { "э", 0.00170000 },
+  { "ю", 0.00330000 },
+  { "я", 0.01160000 },
+};
+
+const wa_cp_freq ALPHA_124_FREQ_CPS[] = {
+  { 0x430u, 0.12770000 },
+  { 0x431u, 0.01490000 },
+  { 0x432u, 0.05640000 },
+  { 0x433u, 0.01490000 },
+  { 0x434u, 0.02160000 },
+  { 0x435u, 0.07130000 },
+  { 0x436u, 0.00500000 },
+  { 0x437u, 0.00330000 },
+  { 0x438u, 0.09620000 },
+  { 0x439u, 0.02160000 },
+  { 0x43Au, 0.05140000 },
+  { 0x43Bu, 0.05310000 },
+  { 0x43Cu, 0.01330000 },
+  { 0x43Du, 0.04980000 },
+  { 0x43Eu, 0.07630000 },
+  { 0x43Fu, 0.01990000 },
+  { 0x440u, 0.06140000 },
+  { 0x441u, 0.06470000 },
+  { 0x442u, 0.03480000 },
+  { 0x443u, 0.01820000 },
+  { 0x444u, 0.01000000 },
+  { 0x445u, 0.01490000 },
+  { 0x446u, 0.00330000 },
+  { 0x447u, 0.03150000 },
+  { 0x448u, 0.00500000 },
+  { 0x449u, 0.00170000 },
+  { 0x44Au, 0.00170000 },
+  { 0x44Bu, 0.00830000 },
+  { 0x44Cu, 0.01000000 },
+  { 0x44Du, 0.00170000 },
+  { 0x44Eu, 0.00330000 },
+  { 0x44Fu, 0.01160000 },
+  { 0x451u, 0.00660000 },
+  { 0x45Eu, 0.00000000 },
+  { 0x493u, 0.00330000 },
+  { 0x49Bu, 0.00500000 },
+  { 0x4A3u, 0.00170000 },
+  { 0x4AFu, 0.00170000 },
+  { 0x4B3u, 0.00000000 },
+  { 0x4D9u, 0.00170000 },
+  { 0x4E9u, 0.00170000 },
+};
+
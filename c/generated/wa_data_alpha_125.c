@@ -0,0 +1,163 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_125_UPPER[] = {
+  "A",
+  "Á",
+  "B",
+  "C",
+  "H",
+  "D",
+  "E",
+  "F",
+  "G",
+  "Ǵ",
+  "I",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "Ń",
+  "O",
+  "Ó",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "Ú",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+};
+const char *ALPHA_125_LOWER[] = {
+  "a",
+  "á",
+  "b",
+  "c",
+  "h",
+  "d",
+  "e",
+  "f",
+  "g",
+  "ǵ",
+  "i",
+  "ı",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "ń",
+  "o",
+  "ó",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "ú",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+};
+const char *ALPHA_125_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_125_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 193, 211, 218, 323, 500,
+};
+const uint32_t ALPHA_125_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 225, 243, 250, 305, 324, 501,
+};
+const uint32_t ALPHA_125_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_125_FREQ[] = {
+  { "a", 0.14490000 },
+  { "á", 0.00000000 },
+  { "b", 0.02420000 },
+  { "c", 0.00130000 },
+  { "h", 0.02130000 },
+  { "d", 0.03670000 },
+  { "e", 0.06990000 },
+  { "f", 0.00250000 },
+  { "g", 0.02460000 },
+  { "ǵ", 0.00000000 },
+  { "i", 0.08240000 },
+  { "ı", 0.06020000 },
+  { "j", 0.01260000 },
+  { "k", 0.02570000 },
+  { "l", 0.06870000 },
+  { "m", 0.03090000 },
+  { "n", 0.07760000 },
+  { "ń", 0.00000000 },
+  { "o", 0.03440000 },
+  { "ó", 0.00000000 },
+  { "p", 0.01810000 },
+  { "q", 0.02740000 },
+  { "r", 0.05960000 },
+  { "s", 0.05180000 },
+  { "t", 0.04610000 },
+  { "u", 0.02110000 },
+  { "ú", 0.00000000 },
+  { "v", 0.00340000 },
+  { "w", 0.01350000 },
+  { "x", 0.00470000 },
+  { "y", 0.02460000 },
+  { "z", 0.01180000 },
+};
+
+const wa_cp_freq ALPHA_125_FREQ_CPS[] = {
+  { 0x61u, 0.14490000 },
+  { 0x62u, 0.02420000 },
+  { 0x63u, 0.00130000 },
+  { 0x64u, 0.03670000 },
+  { 0x65u, 0.06990000 },
+  { 0x66u, 0.00250000 },
+  { 0x67u, 0.02460000 },
+  { 0x68u, 0.02130000 },
+  { 0x69u, 0.08240000 },
+  { 0x6Au, 0.01260000 },
+  { 0x6Bu, 0.02570000 },
+  { 0x6Cu, 0.06870000 },
+  { 0x6Du, 0.03090000 },
+  { 0x6Eu, 0.07760000 },
+  { 0x6Fu, 0.03440000 },
+  { 0x70u, 0.01810000 },
+  { 0x71u, 0.02740000 },
+  { 0x72u, 0.05960000 },
+  { 0x73u, 0.05180000 },
+  { 0x74u, 0.04610000 },
+  { 0x75u, 0.02110000 },
+  { 0x76u, 0.00340000 },
+  { 0x77u, 0.01350000 },
+  { 0x78u, 0.00470000 },
+  { 0x79u, 0.02460000 },
+  { 0x7Au, 0.01180000 },
+  { 0xE1u, 0.00000000 },
+  { 0xF3u, 0.00000000 },
+  { 0xFAu, 0.00000000 },
+  { 0x131u, 0.06020000 },
+  { 0x144u, 0.00000000 },
+  { 0x1F5u, 0.00000000 },
+};
+
@@ -0,0 +1,173 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_126_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "Č",
+  "D",
+  "Ḍ",
+  "E",
+  "Ɛ",
+  "F",
+  "G",
+  "Ǧ",
+  "Ɣ",
+  "H",
+  "Ḥ",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "P",
+  "Q",
+  "R",
+  "Ṛ",
+  "S",
+  "Ṣ",
+  "T",
+  "Ṭ",
+  "U",
+  "W",
+  "X",
+  "Y",
+  "Z",
+  "Ẓ",
+};
+const char *ALPHA_126_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "č",
+  "d",
+  "ḍ",
+  "e",
+  "ɛ",
+  "f",
+  "g",
+  "ǧ",
+  "ɣ",
+  "h",
+  "ḥ",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "p",
+  "q",
+  "r",
+  "ṛ",
+  "s",
+  "ṣ",
+  "t",
+  "ṭ",
+  "u",
+  "w",
+  "x",
+  "y",
+  "z",
+  "ẓ",
+};
+const char *ALPHA_126_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_126_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 80, 81,
+  82, 83, 84, 85, 87, 88, 89, 90, 268, 400, 404, 486, 7692, 7716, 7770, 7778,
+  7788, 7826,
+};
+const uint32_t ALPHA_126_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 112, 113,
+  114, 115, 116, 117, 119, 120, 121, 122, 269, 487, 603, 611, 7693, 7717, 7771, 7779,
+  7789, 7827,
+};
+const uint32_t ALPHA_126_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_126_FREQ[] = {
+  { "a", 0.13660000 },
+  { "b", 0.01350000 },
+  { "c", 0.01160000 },
+  { "č", 0.00070000 },
+  { "d", 0.05770000 },
+  { "ḍ", 0.00390000 },
+  { "e", 0.11090000 },
+  { "ɛ", 0.00390000 },
+  { "f", 0.01350000 },
+  { "g", 0.02310000 },
+  { "ǧ", 0.00130000 },
+  { "ɣ", 0.01230000 },
+  { "h", 0.00490000 },
+  { "ḥ", 0.00380000 },
+  { "i", 0.08570000 },
+  { "j", 0.00230000 },
+  { "k", 0.02140000 },
+  { "l", 0.04500000 },
+  { "m", 0.04350000 },
+  { "n", 0.09110000 },
+  { "p", 0.00310000 },
+  { "q", 0.00960000 },
+  { "r", 0.04840000 },
+  { "ṛ", 0.00210000 },
+  { "s", 0.05240000 },
+  { "ṣ", 0.00110000 },
+  { "t", 0.07510000 },
+  { "ṭ", 0.00360000 },
+  { "u", 0.04410000 },
+  { "w", 0.02200000 },
+  { "x", 0.00300000 },
+  { "y", 0.03340000 },
+  { "z", 0.01340000 },
+  { "ẓ", 0.00180000 },
+};
+
+const wa_cp_freq ALPHA_126_FREQ_CPS[] = {
+  { 0x61u, 0.13660000 },
+  { 0x62u, 0.01350000 },
+  { 0x63u, 0.01160000 },
+  { 0x64u, 0.05770000 },
+  { 0x65u, 0.11090000 },
+  { 0x66u, 0.01350000 },
+  { 0x67u, 0.02310000 },
+  { 0x68u, 0.00490000 },
+  { 0x69u, 0.08570000 },
+  { 0x6Au, 0.00230000 },
+  { 0x6Bu, 0.02140000 },
+  { 0x6Cu, 0.04500000 },
+  { 0x6Du, 0.04350000 },
+  { 0x6Eu, 0.09110000 },
+  { 0x70u, 0.00310000 },
+  { 0x71u, 0.00960000 },
+  { 0x72u, 0.04840000 },
+  { 0x73u, 0.05240000 },
+  { 0x74u, 0.07510000 },
+  { 0x75u, 0.04410000 },
+  { 0x77u, 0.02200000 },
+  { 0x78u, 0.00300000 },
+  { 0x79u, 0.03340000 },
+  { 0x7Au, 0.01340000 },
+  { 0x10Du, 0.00070000 },
+  { 0x1E7u, 0.00130000 },
+  { 0x25Bu, 0.00390000 },
+  { 0x263u, 0.01230000 },
+  { 0x1E0Du, 0.00390000 },
+  { 0x1E25u, 0.00380000 },
+  { 0x1E5Bu, 0.00210000 },
+  { 0x1E63u, 0.00110000 },
+  { 0x1E6Du, 0.00360000 },
+  { 0x1E93u, 0.00180000 },
+};
+
@@ -0,0 +1,143 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_127_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "Ĩ",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "Ũ",
+  "V",
+  "W",
+  "Y",
+  "Z",
+};
+const char *ALPHA_127_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "ĩ",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "ũ",
+  "v",
+  "w",
+  "y",
+  "z",
+};
+const char *ALPHA_127_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_127_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 89, 90, 296, 360,
+};
+const uint32_t ALPHA_127_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 121, 122, 297, 361,
+};
+const uint32_t ALPHA_127_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_127_FREQ[] = {
+  { "a", 0.00000000 },
+  { "b", 0.00000000 },
+  { "c", 0.00000000 },
+  { "d", 0.00000000 },
+  { "e", 0.00000000 },
+  { "f", 0.00000000 },
+  { "g", 0.00000000 },
+  { "h", 0.00000000 },
+  { "i", 0.00000000 },
+  { "ĩ", 0.00000000 },
+  { "j", 0.00000000 },
+  { "k", 0.00000000 },
+  { "l", 0.00000000 },
+  { "m", 0.00000000 },
+  { "n", 0.00000000 },
+  { "o", 0.00000000 },
+  { "p", 0.00000000 },
+  { "q", 0.00000000 },
+  { "r", 0.00000000 },
+  { "s", 0.00000000 },
+  { "t", 0.00000000 },
+  { "u", 0.00000000 },
+  { "ũ", 0.00000000 },
+  { "v", 0.00000000 },
+  { "w", 0.00000000 },
+  { "y", 0.00000000 },
+  { "z", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_127_FREQ_CPS[] = {
+  { 0x61u, 0.00000000 },
+  { 0x62u, 0.00000000 },
+  { 0x63u, 0.00000000 },
+  { 0x64u, 0.00000000 },
+  { 0x65u, 0.00000000 },
+  { 0x66u, 0.00000000 },
+  { 0x67u, 0.00000000 },
+  { 0x68u, 0.00000000 },
+  { 0x69u, 0.00000000 },
+  { 0x6Au, 0.00000000 },
+  { 0x6Bu, 0.00000000 },
+  { 0x6Cu, 0.00000000 },
+  { 0x6Du, 0.00000000 },
+  { 0x6Eu, 0.00000000 },
+  { 0x6Fu, 0.00000000 },
+  { 0x70u, 0.00000000 },
+  { 0x71u, 0.00000000 },
+  { 0x72u, 0.00000000 },
+  { 0x73u, 0.00000000 },
+  { 0x74u, 0.00000000 },
+  { 0x75u, 0.00000000 },
+  { 0x76u, 0.00000000 },
+  { 0x77u, 0.00000000 },
+  { 0x79u, 0.00000000 },
+  { 0x7Au, 0.00000000 },
+  { 0x129u, 0.00000000 },
+  { 0x169u, 0.00000000 },
+};
+
@@ -0,0 +1,167 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_13_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+  "Á",
+  "Ä",
+  "É",
+  "Í",
+  "Ï",
+  "Ñ",
+  "Ó",
+  "Ú",
+  "Ü",
+};
+const char *ALPHA_13_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+  "á",
+  "ä",
+  "é",
+  "í",
+  "ï",
+  "ñ",
+  "ó",
+  "ú",
+  "ü",
+};
+const char *ALPHA_13_DIGITS[] = {
+};
+const uint32_t ALPHA_13_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 193, 196, 201, 205, 207, 209,
+  211, 218, 220,
+};
+const uint32_t ALPHA_13_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 225, 228, 233, 237, 239, 241,
+  243, 250, 252,
+};
+const uint32_t ALPHA_13_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_13_FREQ[] = {
+  { "l", 0.03500000 },
+  { "f", 0.00170000 },
+  { "b", 0.00330000 },
+  { "r", 0.05630000 },
+  { "j", 0.02650000 },
+  { "d", 0.01100000 },
+  { "v", 0.00260000 },
+  { "s", 0.05350000 },
+  { "a", 0.22030000 },
+  { "m", 0.03530000 },
+  { "ä", 0.00520000 },
+  { "h", 0.03290000 },
+  { "ü", 0.00010000 },
+  { "é", 0.00060000 },
+  { "c", 0.02800000 },
+  { "p", 0.03400000 },
+  { "ó", 0.00090000 },
+  { "t", 0.03880000 },
+  { "á", 0.00070000 },
+  { "e", 0.02000000 },
+  { "k", 0.05260000 },
+  { "y", 0.02980000 },
+  { "u", 0.07150000 },
+  { "g", 0.00370000 },
+  { "x", 0.01110000 },
+  { "z", 0.00090000 },
+  { "n", 0.05030000 },
+  { "q", 0.03280000 },
+  { "ú", 0.00040000 },
+  { "í", 0.00110000 },
+  { "ï", 0.00080000 },
+  { "i", 0.09470000 },
+  { "w", 0.02300000 },
+  { "o", 0.01660000 },
+  { "ñ", 0.00390000 },
+};
+
+const wa_cp_freq ALPHA_13_FREQ_CPS[] = {
+  { 0x61u, 0.22030000 },
+  { 0x62u, 0.00330000 },
+  { 0x63u, 0.02800000 },
+  { 0x64u, 0.01100000 },
+  { 0x65u, 0.02000000 },
+  { 0x66u, 0.00170000 },
+  { 0x67u, 0.00370000 },
+  { 0x68u, 0.03290000 },
+  { 0x69u, 0.09470000 },
+  { 0x6Au, 0.02650000 },
+  { 0x6Bu, 0.05260000 },
+  { 0x6Cu, 0.03500000 },
+  { 0x6Du, 0.03530000 },
+  { 0x6Eu, 0.05030000 },
+  { 0x6Fu, 0.01660000 },
+  { 0x70u, 0.03400000 },
+  { 0x71u, 0.03280000 },
+  { 0x72u, 0.05630000 },
+  { 0x73u, 0.05350000 },
+  { 0x74u, 0.03880000 },
+  { 0x75u, 0.07150000 },
+  { 0x76u, 0.00260000 },
+  { 0x77u, 0.02300000 },
+  { 0x78u, 0.01110000 },
+  { 0x79u, 0.02980000 },
+  { 0x7Au, 0.00090000 },
+  { 0xE1u, 0.00070000 },
+  { 0xE4u, 0.00520000 },
+  { 0xE9u, 0.00060000 },
+  { 0xEDu, 0.00110000 },
+  { 0xEFu, 0.00080000 },
+  { 0xF1u, 0.00390000 },
+  { 0xF3u, 0.00090000 },
+  { 0xFAu, 0.00040000 },
+  { 0xFCu, 0.00010000 },
+};
+
@@ -0,0 +1,189 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_130_UPPER[] = {
+  "A",
+  "Á",
+  "À",
+  "Ǎ",
+  "B",
+  "C",
+  "D",
+  "E",
+  "É",
+  "È",
+  "Ě",
+  "Ɛ",
+  "F",
+  "G",
+  "H",
+  "I",
+  "Ɨ",
+  "J",
+  "K",
+  "P",
+  "M",
+  "N",
+  "Y",
+  "Ŋ",
+  "O",
+  "Ó",
+  "Ò",
+  "Ǒ",
+  "Ɔ",
+  "R",
+  "S",
+  "T",
+  "U",
+  "Ú",
+  "Ù",
+  "Ǔ",
+  "Ʉ",
+  "W",
+};
+const char *ALPHA_130_LOWER[] = {
+  "a",
+  "á",
+  "à",
+  "ǎ",
+  "b",
+  "c",
+  "d",
+  "e",
+  "é",
+  "è",
+  "ě",
+  "ɛ",
+  "f",
+  "g",
+  "h",
+  "i",
+  "ɨ",
+  "j",
+  "k",
+  "p",
+  "m",
+  "n",
+  "y",
+  "ŋ",
+  "o",
+  "ó",
+  "ò",
+  "ǒ",
+  "ɔ",
+  "r",
+  "s",
+  "t",
+  "u",
+  "ú",
+  "ù",
+  "ǔ",
+  "ʉ",
+  "w",
+};
+const char *ALPHA_130_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_130_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 77, 78, 79, 80, 82,
+  83, 84, 85, 87, 89, 192, 193, 200, 201, 210, 211, 217, 218, 282, 330, 390,
+  400, 407, 461, 465, 467, 580,
+};
+const uint32_t ALPHA_130_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 109, 110, 111, 112, 114,
+  115, 116, 117, 119, 121, 224, 225, 232, 233, 242, 243, 249, 250, 283, 331, 462,
+  466, 468, 596, 603, 616, 649,
+};
+const uint32_t ALPHA_130_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_130_FREQ[] = {
+  { "a", 0.00000000 },
+  { "á", 0.00000000 },
+  { "à", 0.00000000 },
+  { "ǎ", 0.00000000 },
+  { "b", 0.00000000 },
+  { "c", 0.00000000 },
+  { "d", 0.00000000 },
+  { "e", 0.00000000 },
+  { "é", 0.00000000 },
+  { "è", 0.00000000 },
+  { "ě", 0.00000000 },
+  { "ɛ", 0.00000000 },
+  { "f", 0.00000000 },
+  { "g", 0.00000000 },
+  { "h", 0.00000000 },
+  { "i", 0.00000000 },
+  { "ɨ", 0.00000000 },
+  { "j", 0.00000000 },
+  { "k", 0.00000000 },
+  { "p", 0.00000000 },
+  { "m", 0.00000000 },
+  { "n", 0.00000000 },
+  { "y", 0.00000000 },
+  { "ŋ", 0.00000000 },
+  { "o", 0.00000000 },
+  { "ó", 0.00000000 },
+  { "ò", 0.00000000 },
+  { "ǒ", 0.00000000 },
+  { "ɔ", 0.00000000 },
+  { "r", 0.00000000 },
+  { "s", 0.00000000 },
+  { "t", 0.00000000 },
+  { "u", 0.00000000 },
+  { "ú", 0.00000000 },
+  { "ù", 0.00000000 },
+  { "ǔ", 0.00000000 },
+  { "ʉ", 0.00000000 },
+  { "w", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_130_FREQ_CPS[] = {
+  { 0x61u, 0.00000000 },
+  { 0x62u, 0.00000000 },
+  { 0x63u, 0.00000000 },
+  { 0x64u, 0.00000000 },
+  { 0x65u, 0.00000000 },
+  { 0x66u, 0.00000000 },
+  { 0x67u, 0.00000000 },
+  { 0x68u, 0.00000000 },
+  { 0x69u, 0.00000000 },
+  { 0x6Au, 0.00000000 },
+  { 0x6Bu, 0.00000000 },
+  { 0x6Du, 0.00000000 },
+  { 0x6Eu, 0.00000000 },
+  { 0x6Fu, 0.00000000 },
+  { 0x70u, 0.00000000 },
+  { 0x72u, 0.00000000 },
+  { 0x73u, 0.00000000 },
+  { 0x74u, 0.00000000 },
+  { 0x75u, 0.00000000 },
+  { 0x77u, 0.00000000 },
+  { 0x79u, 0.00000000 },
+  { 0xE0u, 0.00000000 },
+  { 0xE1u, 0.00000000 },
+  { 0xE8u, 0.00000000 },
+  { 0xE9u, 0.00000000 },
+  { 0xF2u, 0.00000000 },
+  { 0xF3u, 0.00000000 },
+  { 0xF9u, 0.00000000 },
+  { 0xFAu, 0.00000000 },
+  { 0x11Bu, 0.00000000 },
+  { 0x14Bu, 0.00000000 },
+  { 0x1CEu, 0.00000000 },
+  { 0x1D2u, 0.00000000 },
+  { 0x1D4u, 0.00000000 },
+  { 0x254u, 0.00000000 },
+  { 0x25Bu, 0.00000000 },
+  { 0x268u, 0.00000000 },
+  { 0x289u, 0.00000000 },
+};
+
@@ -0,0 +1,139 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_131_UPPER[] = {
+  "A",
+  "Á",
+  "Ã",
+  "E",
+  "É",
+  "Ẽ",
+  "F",
+  "G",
+  "H",
+  "I",
+  "Ĩ",
+  "J",
+  "K",
+  "M",
+  "N",
+  "O",
+  "Ó",
+  "P",
+  "R",
+  "S",
+  "T",
+  "U",
+  "Ũ",
+  "V",
+  "Y",
+  "Ỹ",
+};
+const char *ALPHA_131_LOWER[] = {
+  "a",
+  "á",
+  "ã",
+  "e",
+  "é",
+  "ẽ",
+  "f",
+  "g",
+  "h",
+  "i",
+  "ĩ",
+  "j",
+  "k",
+  "m",
+  "n",
+  "o",
+  "ó",
+  "p",
+  "r",
+  "s",
+  "t",
+  "u",
+  "ũ",
+  "v",
+  "y",
+  "ỹ",
+};
+const char *ALPHA_131_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_131_UPPER_CPS[] = {
+  65, 69, 70, 71, 72, 73, 74, 75, 77, 78, 79, 80, 82, 83, 84, 85,
+  86, 89, 193, 195, 201, 211, 296, 360, 7868, 7928,
+};
+const uint32_t ALPHA_131_LOWER_CPS[] = {
+  97, 101, 102, 103, 104, 105, 106, 107, 109, 110, 111, 112, 114, 115, 116, 117,
+  118, 121, 225, 227, 233, 243, 297, 361, 7869, 7929,
+};
+const uint32_t ALPHA_131_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_131_FREQ[] = {
+  { "a", 0.00000000 },
+  { "á", 0.00000000 },
+  { "ã", 0.00000000 },
+  { "e", 0.00000000 },
+  { "é", 0.00000000 },
+  { "ẽ", 0.00000000 },
+  { "f", 0.00000000 },
+  { "g", 0.00000000 },
+  { "h", 0.00000000 },
+  { "i", 0.00000000 },
+  { "ĩ", 0.00000000 },
+  { "j", 0.00000000 },
+  { "k", 0.00000000 },
+  { "m", 0.00000000 },
+  { "n", 0.00000000 },
+  { "o", 0.00000000 },
+  { "ó", 0.00000000 },
+  { "p", 0.00000000 },
+  { "r", 0.00000000 },
+  { "s", 0.00000000 },
+  { "t", 0.00000000 },
+  { "u", 0.00000000 },
+  { "ũ", 0.00000000 },
+  { "v", 0.00000000 },
+  { "y", 0.00000000 },
+  { "ỹ", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_131_FREQ_CPS[] = {
+  { 0x61u, 0.00000000 },
+  { 0x65u, 0.00000000 },
+  { 0x66u, 0.00000000 },
+  { 0x67u, 0.00000000 },
+  { 0x68u, 0.00000000 },
+  { 0x69u, 0.00000000 },
+  { 0x6Au, 0.00000000 },
+  { 0x6Bu, 0.00000000 },
+  { 0x6Du, 0.00000000 },
+  { 0x6Eu, 0.00000000 },
+  { 0x6Fu, 0.00000000 },
+  { 0x70u, 0.00000000 },
+  { 0x72u, 0.00000000 },
+  { 0x73u, 0.00000000 },
+  { 0x74u, 0.00000000 },
+  { 0x75u, 0.00000000 },
+  { 0x76u, 0.00000000 },
+  { 0x79u, 0.00000000 },
+  { 0xE1u, 0.00000000 },
+  { 0xE3u, 0.00000000 },
+  { 0xE9u, 0.00000000 },
+  { 0xF3u, 0.00000000 },
+  { 0x129u, 0.00000000 },
+  { 0x169u, 0.00000000 },
+  { 0x1EBDu, 0.00000000 },
+  { 0x1EF9u, 0.00000000 },
+};
+
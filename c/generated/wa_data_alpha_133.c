@@ -0,0 +1,105 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_133_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "M",
+  "N",
+  "O",
+  "R",
+  "T",
+  "U",
+  "W",
+  "Y",
+  "Ĩ",
+  "Ũ",
+};
+const char *ALPHA_133_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "m",
+  "n",
+  "o",
+  "r",
+  "t",
+  "u",
+  "w",
+  "y",
+  "ĩ",
+  "ũ",
+};
+const char *ALPHA_133_DIGITS[] = {
+};
+const uint32_t ALPHA_133_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 71, 72, 73, 74, 75, 77, 78, 79, 82, 84, 85,
+  87, 89, 296, 360,
+};
+const uint32_t ALPHA_133_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 103, 104, 105, 106, 107, 109, 110, 111, 114, 116, 117,
+  119, 121, 297, 361,
+};
+const uint32_t ALPHA_133_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_133_FREQ[] = {
+  { "a", 0.00000000 },
+  { "b", 0.00000000 },
+  { "c", 0.00000000 },
+  { "d", 0.00000000 },
+  { "e", 0.00000000 },
+  { "g", 0.00000000 },
+  { "h", 0.00000000 },
+  { "i", 0.00000000 },
+  { "j", 0.00000000 },
+  { "k", 0.00000000 },
+  { "m", 0.00000000 },
+  { "n", 0.00000000 },
+  { "o", 0.00000000 },
+  { "r", 0.00000000 },
+  { "t", 0.00000000 },
+  { "u", 0.00000000 },
+  { "w", 0.00000000 },
+  { "y", 0.00000000 },
+  { "ĩ", 0.00000000 },
+  { "ũ", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_133_FREQ_CPS[] = {
+  { 0x61u, 0.00000000 },
+  { 0x62u, 0.00000000 },
+  { 0x63u, 0.00000000 },
+  { 0x64u, 0.00000000 },
+  { 0x65u, 0.00000000 },
+  { 0x67u, 0.00000000 },
+  { 0x68u, 0.00000000 },
+  { 0x69u, 0.00000000 },
+  { 0x6Au, 0.00000000 },
+  { 0x6Bu, 0.00000000 },
+  { 0x6Du, 0.00000000 },
+  { 0x6Eu, 0.00000000 },
+  { 0x6Fu, 0.00000000 },
+  { 0x72u, 0.00000000 },
+  { 0x74u, 0.00000000 },
+  { 0x75u, 0.00000000 },
+  { 0x77u, 0.00000000 },
+  { 0x79u, 0.00000000 },
+  { 0x129u, 0.00000000 },
+  { 0x169u, 0.00000000 },
+};
+
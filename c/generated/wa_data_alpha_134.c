@@ -0,0 +1,195 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_134_UPPER[] = {
+  "А",
+  "Ә",
+  "Б",
+  "В",
+  "Г",
+  "Ғ",
+  "Д",
+  "Е",
+  "Ё",
+  "Ж",
+  "З",
+  "И",
+  "Й",
+  "К",
+  "Қ",
+  "Л",
+  "М",
+  "Н",
+  "Ң",
+  "О",
+  "Ө",
+  "П",
+  "Р",
+  "С",
+  "Т",
+  "У",
+  "Ұ",
+  "Ү",
+  "Ф",
+  "Х",
+  "Һ",
+  "Ц",
+  "Ч",
+  "Ш",
+  "Щ",
+  "Ъ",
+  "Ы",
+  "І",
+  "Ь",
+  "Э",
+  "Ю",
+  "Я",
+};
+const char *ALPHA_134_LOWER[] = {
+  "а",
+  "ә",
+  "б",
+  "в",
+  "г",
+  "ғ",
+  "д",
+  "е",
+  "ё",
+  "ж",
+  "з",
+  "и",
+  "й",
+  "к",
+  "қ",
+  "л",
+  "м",
+  "н",
+  "ң",
+  "о",
+  "ө",
+  "п",
+  "р",
+  "с",
+  "т",
+  "у",
+  "ұ",
+  "ү",
+  "ф",
+  "х",
+  "һ",
+  "ц",
+  "ч",
+  "ш",
+  "щ",
+  "ъ",
+  "ы",
+  "і",
+  "ь",
+  "э",
+  "ю",
+  "я",
+};
+const char *ALPHA_134_DIGITS[] = {
+};
+const uint32_t ALPHA_134_UPPER_CPS[] = {
+  1025, 1030, 1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053,
+  1054, 1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069,
+  1070, 1071, 1170, 1178, 1186, 1198, 1200, 1210, 1240, 1256,
+};
+const uint32_t ALPHA_134_LOWER_CPS[] = {
+  1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080, 1081, 1082, 1083, 1084, 1085, 1086, 1087,
+  1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103,
+  1105, 1110, 1171, 1179, 1187, 1199, 1201, 1211, 1241, 1257,
+};
+const uint32_t ALPHA_134_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_134_FREQ[] = {
+  { "а", 0.12650000 },
+  { "ә", 0.00680000 },
+  { "б", 0.02180000 },
+  { "в", 0.00400000 },
+  { "г", 0.01220000 },
+  { "ғ", 0.01760000 },
+  { "д", 0.04330000 },
+  { "е", 0.07170000 },
+  { "ё", 0.00000000 },
+  { "ж", 0.01700000 },
+  { "з", 0.01430000 },
+  { "и", 0.01930000 },
+  { "й", 0.01370000 },
+  { "к", 0.02890000 },
+  { "қ", 0.03110000 },
+  { "л", 0.05090000 },
+  { "м", 0.03160000 },
+  { "н", 0.06990000 },
+  { "ң", 0.01520000 },
+  { "о", 0.02880000 },
+  { "ө", 0.01040000 },
+  { "п", 0.01330000 },
+  { "р", 0.05690000 },
+  { "с", 0.04220000 },
+  { "т", 0.05760000 },
+  { "у", 0.01880000 },
+  { "ұ", 0.00930000 },
+  { "ү", 0.00620000 },
+  { "ф", 0.00210000 },
+  { "х", 0.00300000 },
+  { "һ", 0.00010000 },
+  { "ц", 0.00190000 },
+  { "ч", 0.00080000 },
+  { "ш", 0.01370000 },
+  { "щ", 0.00010000 },
+  { "ъ", 0.00010000 },
+  { "ы", 0.08230000 },
+  { "і", 0.04850000 },
+  { "ь", 0.00180000 },
+  { "э", 0.00120000 },
+  { "ю", 0.00060000 },
+  { "я", 0.00460000 },
+};
+
+const wa_cp_freq ALPHA_134_FREQ_CPS[] = {
+  { 0x430u, 0.12650000 },
+  { 0x431u, 0.02180000 },
+  { 0x432u, 0.00400000 },
+  { 0x433u, 0.01220000 },
+  { 0x434u, 0.04330000 },
+  { 0x435u, 0.07170000 },
+  { 0x436u, 0.01700000 },
+  { 0x437u, 0.01430000 },
+  { 0x438u, 0.01930000 },
+  { 0x439u, 0.01370000 },
+  { 0x43Au, 0.02890000 },
+  { 0x43Bu, 0.05090000 },
+  { 0x43Cu, 0.03160000 },
+  { 0x43Du, 0.06990000 },
+  { 0x43Eu, 0.02880000 },
+  { 0x43Fu, 0.01330000 },
+  { 0x440u, 0.05690000 },
+  { 0x441u, 0.04220000 },
+  { 0x442u, 0.05760000 },
+  { 0x443u, 0.01880000 },
+  { 0x444u, 0.00210000 },
+  { 0x445u, 0.00300000 },
+  { 0x446u, 0.00190000 },
+  { 0x447u, 0.00080000 },
+  { 0x448u, 0.01370000 },
+  { 0x449u, 0.00010000 },
+  { 0x44Au, 0.00010000 },
+  { 0x44Bu, 0.08230000 },
+  { 0x44Cu, 0.00180000 },
+  { 0x44Du, 0.00120000 },
+  { 0x44Eu, 0.00060000 },
+  { 0x44Fu, 0.00460000 },
+  { 0x451u, 0.00000000 },
+  { 0x456u, 0.04850000 },
+  { 0x493u, 0.01760000 },
+  { 0x49Bu, 0.03110000 },
+  { 0x4A3u, 0.01520000 },
+  { 0x4AFu, 0.00620000 },
+  { 0x4B1u, 0.00930000 },
+  { 0x4BBu, 0.00010000 },
+  { 0x4D9u, 0.00680000 },
+  { 0x4E9u, 0.01040000 },
+};
+
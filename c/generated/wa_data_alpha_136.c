@@ -0,0 +1,141 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_136_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+  "Æ",
+  "Ø",
+  "Å",
+};
+const char *ALPHA_136_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+  "æ",
+  "ø",
+  "å",
+};
+const char *ALPHA_136_DIGITS[] = {
+};
+const uint32_t ALPHA_136_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 197, 198, 216,
+};
+const uint32_t ALPHA_136_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 229, 230, 248,
+};
+const uint32_t ALPHA_136_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_136_FREQ[] = {
+  { "a", 0.15750000 },
+  { "w", 0.00160000 },
+  { "t", 0.07540000 },
+  { "h", 0.00590000 },
+  { "n", 0.08230000 },
+  { "g", 0.02770000 },
+  { "d", 0.00680000 },
+  { "b", 0.00490000 },
+  { "e", 0.04580000 },
+  { "o", 0.03490000 },
+  { "z", 0.00100000 },
+  { "x", 0.00040000 },
+  { "p", 0.02550000 },
+  { "i", 0.12720000 },
+  { "k", 0.03010000 },
+  { "l", 0.05650000 },
+  { "v", 0.00810000 },
+  { "c", 0.00440000 },
+  { "j", 0.00700000 },
+  { "m", 0.03870000 },
+  { "u", 0.07900000 },
+  { "s", 0.07040000 },
+  { "ø", 0.00040000 },
+  { "q", 0.03390000 },
+  { "f", 0.00970000 },
+  { "å", 0.00020000 },
+  { "æ", 0.00020000 },
+  { "r", 0.06150000 },
+  { "y", 0.00310000 },
+};
+
+const wa_cp_freq ALPHA_136_FREQ_CPS[] = {
+  { 0x61u, 0.15750000 },
+  { 0x62u, 0.00490000 },
+  { 0x63u, 0.00440000 },
+  { 0x64u, 0.00680000 },
+  { 0x65u, 0.04580000 },
+  { 0x66u, 0.00970000 },
+  { 0x67u, 0.02770000 },
+  { 0x68u, 0.00590000 },
+  { 0x69u, 0.12720000 },
+  { 0x6Au, 0.00700000 },
+  { 0x6Bu, 0.03010000 },
+  { 0x6Cu, 0.05650000 },
+  { 0x6Du, 0.03870000 },
+  { 0x6Eu, 0.08230000 },
+  { 0x6Fu, 0.03490000 },
+  { 0x70u, 0.02550000 },
+  { 0x71u, 0.03390000 },
+  { 0x72u, 0.06150000 },
+  { 0x73u, 0.07040000 },
+  { 0x74u, 0.07540000 },
+  { 0x75u, 0.07900000 },
+  { 0x76u, 0.00810000 },
+  { 0x77u, 0.00160000 },
+  { 0x78u, 0.00040000 },
+  { 0x79u, 0.00310000 },
+  { 0x7Au, 0.00100000 },
+  { 0xE5u, 0.00020000 },
+  { 0xE6u, 0.00020000 },
+  { 0xF8u, 0.00040000 },
+};
+
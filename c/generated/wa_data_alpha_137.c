@@ -0,0 +1,215 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_137_UPPER[] = {
+  "ក",
+  "ខ",
+  "គ",
+  "ឃ",
+  "ង",
+  "ច",
+  "ឆ",
+  "ជ",
+  "ឈ",
+  "ញ",
+  "ដ",
+  "ឋ",
+  "ឌ",
+  "ឍ",
+  "ណ",
+  "ត",
+  "ថ",
+  "ទ",
+  "ធ",
+  "ន",
+  "ប",
+  "ផ",
+  "ព",
+  "ភ",
+  "ម",
+  "យ",
+  "រ",
+  "ឫ",
+  "ឬ",
+  "ល",
+  "ឭ",
+  "ឮ",
+  "វ",
+  "ស",
+  "ហ",
+  "ឡ",
+  "អ",
+  "ឥ",
+  "ឦ",
+  "ឧ",
+  "ឩ",
+  "ឪ",
+  "ឯ",
+  "ឰ",
+  "ឱ",
+  "ឳ",
+  "ឲ",
+};
+const char *ALPHA_137_LOWER[] = {
+  "ក",
+  "ខ",
+  "គ",
+  "ឃ",
+  "ង",
+  "ច",
+  "ឆ",
+  "ជ",
+  "ឈ",
+  "ញ",
+  "ដ",
+  "ឋ",
+  "ឌ",
+  "ឍ",
+  "ណ",
+  "ត",
+  "ថ",
+  "ទ",
+  "ធ",
+  "ន",
+  "ប",
+  "ផ",
+  "ព",
+  "ភ",
+  "ម",
+  "យ",
+  "រ",
+  "ឫ",
+  "ឬ",
+  "ល",
+  "ឭ",
+  "ឮ",
+  "វ",
+  "ស",
+  "ហ",
+  "ឡ",
+  "អ",
+  "ឥ",
+  "ឦ",
+  "ឧ",
+  "ឩ",
+  "ឪ",
+  "ឯ",
+  "ឰ",
+  "ឱ",
+  "ឳ",
+  "ឲ",
+};
+const char *ALPHA_137_DIGITS[] = {
+};
+const uint32_t ALPHA_137_UPPER_CPS[] = {
+  6016, 6017, 6018, 6019, 6020, 6021, 6022, 6023, 6024, 6025, 6026, 6027, 6028, 6029, 6030, 6031,
+  6032, 6033, 6034, 6035, 6036, 6037, 6038, 6039, 6040, 6041, 6042, 6043, 6044, 6047, 6048, 6049,
+  6050, 6053, 6054, 6055, 6057, 6058, 6059, 6060, 6061, 6062, 6063, 6064, 6065, 6066, 6067,
+};
+const uint32_t ALPHA_137_LOWER_CPS[] = {
+  6016, 6017, 6018, 6019, 6020, 6021, 6022, 6023, 6024, 6025, 6026, 6027, 6028, 6029, 6030, 6031,
+  6032, 6033, 6034, 6035, 6036, 6037, 6038, 6039, 6040, 6041, 6042, 6043, 6044, 6047, 6048, 6049,
+  6050, 6053, 6054, 6055, 6057, 6058, 6059, 6060, 6061, 6062, 6063, 6064, 6065, 6066, 6067,
+};
+const uint32_t ALPHA_137_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_137_FREQ[] = {
+  { "ក", 0.07360000 },
+  { "ខ", 0.01250000 },
+  { "គ", 0.02270000 },
+  { "ឃ", 0.00220000 },
+  { "ង", 0.05650000 },
+  { "ច", 0.02840000 },
+  { "ឆ", 0.00450000 },
+  { "ជ", 0.02800000 },
+  { "ឈ", 0.00210000 },
+  { "ញ", 0.01040000 },
+  { "ដ", 0.03140000 },
+  { "ឋ", 0.00280000 },
+  { "ឌ", 0.00160000 },
+  { "ឍ", 0.00020000 },
+  { "ណ", 0.01360000 },
+  { "ត", 0.05390000 },
+  { "ថ", 0.01000000 },
+  { "ទ", 0.03740000 },
+  { "ធ", 0.01140000 },
+  { "ន", 0.10650000 },
+  { "ប", 0.06760000 },
+  { "ផ", 0.00760000 },
+  { "ព", 0.03210000 },
+  { "ភ", 0.00960000 },
+  { "ម", 0.05950000 },
+  { "យ", 0.03810000 },
+  { "រ", 0.09630000 },
+  { "ឫ", 0.00020000 },
+  { "ឬ", 0.00110000 },
+  { "ល", 0.04480000 },
+  { "ឭ", 0.00000000 },
+  { "ឮ", 0.00010000 },
+  { "វ", 0.02510000 },
+  { "ស", 0.06420000 },
+  { "ហ", 0.01290000 },
+  { "ឡ", 0.00440000 },
+  { "អ", 0.02170000 },
+  { "ឥ", 0.00090000 },
+  { "ឦ", 0.00000000 },
+  { "ឧ", 0.00100000 },
+  { "ឩ", 0.00000000 },
+  { "ឪ", 0.00020000 },
+  { "ឯ", 0.00130000 },
+  { "ឰ", 0.00000000 },
+  { "ឱ", 0.00060000 },
+  { "ឳ", 0.00000000 },
+  { "ឲ", 0.00120000 },
+};
+
+const wa_cp_freq ALPHA_137_FREQ_CPS[] = {
+  { 0x1780u, 0.07360000 },
+  { 0x1781u, 0.01250000 },
+  { 0x1782u, 0.02270000 },
+  { 0x1783u, 0.00220000 },
+  { 0x1784u, 0.05650000 },
+  { 0x1785u, 0.02840000 },
+  { 0x1786u, 0.00450000 },
+  { 0x1787u, 0.02800000 },
+  { 0x1788u, 0.00210000 },
+  { 0x1789u, 0.01040000 },
+  { 0x178Au, 0.03140000 },
+  { 0x178Bu, 0.00280000 },
+  { 0x178Cu, 0.00160000 },
+  { 0x178Du, 0.00020000 },
+  { 0x178Eu, 0.01360000 },
+  { 0x178Fu, 0.05390000 },
+  { 0x1790u, 0.01000000 },
+  { 0x1791u, 0.03740000 },
+  { 0x1792u, 0.01140000 },
+  { 0x1793u, 0.10650000 },
+  { 0x1794u, 0.06760000 },
+  { 0x1795u, 0.00760000 },
+  { 0x1796u, 0.03210000 },
+  { 0x1797u, 0.00960000 },
+  { 0x1798u, 0.05950000 },
+  { 0x1799u, 0.03810000 },
+  { 0x179Au, 0.09630000 },
+  { 0x179Bu, 0.04480000 },
+  { 0x179Cu, 0.02510000 },
+  { 0x179Fu, 0.06420000 },
+  { 0x17A0u, 0.01290000 },
+  { 0x17A1u, 0.00440000 },
+  { 0x17A2u, 0.02170000 },
+  { 0x17A5u, 0.00090000 },
+  { 0x17A6u, 0.00000000 },
+  { 0x17A7u, 0.00100000 },
+  { 0x17A9u, 0.00000000 },
+  { 0x17AAu, 0.00020000 },
+  { 0x17ABu, 0.00020000 },
+  { 0x17ACu, 0.00110000 },
+  { 0x17ADu, 0.00000000 },
+  { 0x17AEu, 0.00010000 },
+  { 0x17AFu, 0.00130000 },
+  { 0x17B0u, 0.00000000 },
+  { 0x17B1u, 0.00060000 },
+  { 0x17B2u, 0.00120000 },
+  { 0x17B3u, 0.00000000 },
+};
+
@@ -0,0 +1,237 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_138_UPPER[] = {
+  "ಅ",
+  "ಆ",
+  "ಇ",
+  "ಈ",
+  "ಉ",
+  "ಊ",
+  "ಋ",
+  "ೠ",
+  "ಌ",
+  "ೡ",
+  "ಎ",
+  "ಏ",
+  "ಐ",
+  "ಒ",
+  "ಓ",
+  "ಔ",
+  "ಕ",
+  "ಖ",
+  "ಗ",
+  "ಘ",
+  "ಙ",
+  "ಚ",
+  "ಛ",
+  "ಜ",
+  "ಝ",
+  "ಞ",
+  "ಟ",
+  "ಠ",
+  "ಡ",
+  "ಢ",
+  "ಣ",
+  "ತ",
+  "ಥ",
+  "ದ",
+  "ಧ",
+  "ನ",
+  "ಪ",
+  "ಫ",
+  "ಬ",
+  "ಭ",
+  "ಮ",
+  "ಯ",
+  "ರ",
+  "ಱ",
+  "ಲ",
+  "ವ",
+  "ಶ",
+  "ಷ",
+  "ಸ",
+  "ಹ",
+  "ಳ",
+  "ಽ",
+};
+const char *ALPHA_138_LOWER[] = {
+  "ಅ",
+  "ಆ",
+  "ಇ",
+  "ಈ",
+  "ಉ",
+  "ಊ",
+  "ಋ",
+  "ೠ",
+  "ಌ",
+  "ೡ",
+  "ಎ",
+  "ಏ",
+  "ಐ",
+  "ಒ",
+  "ಓ",
+  "ಔ",
+  "ಕ",
+  "ಖ",
+  "ಗ",
+  "ಘ",
+  "ಙ",
+  "ಚ",
+  "ಛ",
+  "ಜ",
+  "ಝ",
+  "ಞ",
+  "ಟ",
+  "ಠ",
+  "ಡ",
+  "ಢ",
+  "ಣ",
+  "ತ",
+  "ಥ",
+  "ದ",
+  "ಧ",
+  "ನ",
+  "ಪ",
+  "ಫ",
+  "ಬ",
+  "ಭ",
+  "ಮ",
+  "ಯ",
+  "ರ",
+  "ಱ",
+  "ಲ",
+  "ವ",
+  "ಶ",
+  "ಷ",
+  "ಸ",
+  "ಹ",
+  "ಳ",
+  "ಽ",
+};
+const char *ALPHA_138_DIGITS[] = {
+};
+const uint32_t ALPHA_138_UPPER_CPS[] = {
+  3205, 3206, 3207, 3208, 3209, 3210, 3211, 3212, 3214, 3215, 3216, 3218, 3219, 3220, 3221, 3222,
+  3223, 3224, 3225, 3226, 3227, 3228, 3229, 3230, 3231, 3232, 3233, 3234, 3235, 3236, 3237, 3238,
+  3239, 3240, 3242, 3243, 3244, 3245, 3246, 3247, 3248, 3249, 3250, 3251, 3253, 3254, 3255, 3256,
+  3257, 3261, 3296, 3297,
+};
+const uint32_t ALPHA_138_LOWER_CPS[] = {
+  3205, 3206, 3207, 3208, 3209, 3210, 3211, 3212, 3214, 3215, 3216, 3218, 3219, 3220, 3221, 3222,
+  3223, 3224, 3225, 3226, 3227, 3228, 3229, 3230, 3231, 3232, 3233, 3234, 3235, 3236, 3237, 3238,
+  3239, 3240, 3242, 3243, 3244, 3245, 3246, 3247, 3248, 3249, 3250, 3251, 3253, 3254, 3255, 3256,
+  3257, 3261, 3296, 3297,
+};
+const uint32_t ALPHA_138_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_138_FREQ[] = {
+  { "ಅ", 0.01580000 },
+  { "ಆ", 0.00820000 },
+  { "ಇ", 0.00750000 },
+  { "ಈ", 0.00280000 },
+  { "ಉ", 0.00330000 },
+  { "ಊ", 0.00010000 },
+  { "ಋ", 0.00010000 },
+  { "ೠ", 0.00000000 },
+  { "ಌ", 0.00000000 },
+  { "ೡ", 0.00000000 },
+  { "ಎ", 0.00620000 },
+  { "ಏ", 0.00090000 },
+  { "ಐ", 0.00060000 },
+  { "ಒ", 0.00420000 },
+  { "ಓ", 0.00040000 },
+  { "ಔ", 0.00020000 },
+  { "ಕ", 0.05570000 },
+  { "ಖ", 0.00290000 },
+  { "ಗ", 0.05970000 },
+  { "ಘ", 0.00090000 },
+  { "ಙ", 0.00000000 },
+  { "ಚ", 0.01120000 },
+  { "ಛ", 0.00030000 },
+  { "ಜ", 0.01080000 },
+  { "ಝ", 0.00020000 },
+  { "ಞ", 0.00050000 },
+  { "ಟ", 0.02370000 },
+  { "ಠ", 0.00050000 },
+  { "ಡ", 0.02530000 },
+  { "ಢ", 0.00020000 },
+  { "ಣ", 0.01020000 },
+  { "ತ", 0.07070000 },
+  { "ಥ", 0.00560000 },
+  { "ದ", 0.08050000 },
+  { "ಧ", 0.00770000 },
+  { "ನ", 0.08150000 },
+  { "ಪ", 0.02930000 },
+  { "ಫ", 0.00380000 },
+  { "ಬ", 0.02050000 },
+  { "ಭ", 0.00610000 },
+  { "ಮ", 0.03970000 },
+  { "ಯ", 0.04990000 },
+  { "ರ", 0.10190000 },
+  { "ಱ", 0.00000000 },
+  { "ಲ", 0.06560000 },
+  { "ವ", 0.05990000 },
+  { "ಶ", 0.01040000 },
+  { "ಷ", 0.00930000 },
+  { "ಸ", 0.05490000 },
+  { "ಹ", 0.02160000 },
+  { "ಳ", 0.02870000 },
+  { "ಽ", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_138_FREQ_CPS[] = {
+  { 0xC85u, 0.01580000 },
+  { 0xC86u, 0.00820000 },
+  { 0xC87u, 0.00750000 },
+  { 0xC88u, 0.00280000 },
+  { 0xC89u, 0.00330000 },
+  { 0xC8Au, 0.00010000 },
+  { 0xC8Bu, 0.00010000 },
+  { 0xC8Cu, 0.00000000 },
+  { 0xC8Eu, 0.00620000 },
+  { 0xC8Fu, 0.00090000 },
+  { 0xC90u, 0.00060000 },
+  { 0xC92u, 0.00420000 },
+  { 0xC93u, 0.00040000 },
+  { 0xC94u, 0.00020000 },
+  { 0xC95u, 0.05570000 },
+  { 0xC96u, 0.00290000 },
+  { 0xC97u, 0.05970000 },
+  { 0xC98u, 0.00090000 },
+  { 0xC99u, 0.00000000 },
+  { 0xC9Au, 0.01120000 },
+  { 0xC9Bu, 0.00030000 },
+  { 0xC9Cu, 0.01080000 },
+  { 0xC9Du, 0.00020000 },
+  { 0xC9Eu, 0.00050000 },
+  { 0xC9Fu, 0.02370000 },
+  { 0xCA0u, 0.00050000 },
+  { 0xCA1u, 0.02530000 },
+  { 0xCA2u, 0.00020000 },
+  { 0xCA3u, 0.01020000 },
+  { 0xCA4u, 0.07070000 },
+  { 0xCA5u, 0.00560000 },
+  { 0xCA6u, 0.08050000 },
+  { 0xCA7u, 0.00770000 },
+  { 0xCA8u, 0.08150000 },
+  { 0xCAAu, 0.02930000 },
+  { 0xCABu, 0.00380000 },
+  { 0xCACu, 0.02050000 },
+  { 0xCADu, 0.00610000 },
+  { 0xCAEu, 0.03970000 },
+  { 0xCAFu, 0.04990000 },
+  { 0xCB0u, 0.10190000 },
+  { 0xCB1u, 0.00000000 },
+  { 0xCB2u, 0.06560000 },
+  { 0xCB3u, 0.02870000 },
+  { 0xCB5u, 0.05990000 },
+  { 0xCB6u, 0.01040000 },
+  { 0xCB7u, 0.00930000 },
+  { 0xCB8u, 0.05490000 },
+  { 0xCB9u, 0.02160000 },
+  { 0xCBDu, 0.00000000 },
+  { 0xCE0u, 0.00000000 },
+  { 0xCE1u, 0.00000000 },
+};
+
@@ -0,0 +1,121 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_139_UPPER[] = {
+  "ㄱ",
+  "ㄴ",
+  "ㄷ",
+  "ㄹ",
+  "ㅁ",
+  "ㅂ",
+  "ㅅ",
+  "ㅇ",
+  "ㅈ",
+  "ㅊ",
+  "ㅋ",
+  "ㅌ",
+  "ㅍ",
+  "ㅎ",
+  "ㅏ",
+  "ㅑ",
+  "ㅓ",
+  "ㅕ",
+  "ㅗ",
+  "ㅛ",
+  "ㅜ",
+  "ㅠ",
+  "ㅡ",
+  "ㅣ",
+};
+const char *ALPHA_139_LOWER[] = {
+  "ㄱ",
+  "ㄴ",
+  "ㄷ",
+  "ㄹ",
+  "ㅁ",
+  "ㅂ",
+  "ㅅ",
+  "ㅇ",
+  "ㅈ",
+  "ㅊ",
+  "ㅋ",
+  "ㅌ",
+  "ㅍ",
+  "ㅎ",
+  "ㅏ",
+  "ㅑ",
+  "ㅓ",
+  "ㅕ",
+  "ㅗ",
+  "ㅛ",
+  "ㅜ",
+  "ㅠ",
+  "ㅡ",
+  "ㅣ",
+};
+const char *ALPHA_139_DIGITS[] = {
+};
+const uint32_t ALPHA_139_UPPER_CPS[] = {
+  12593, 12596, 12599, 12601, 12609, 12610, 12613, 12615, 12616, 12618, 12619, 12620, 12621, 12622, 12623, 12625,
+  12627, 12629, 12631, 12635, 12636, 12640, 12641, 12643,
+};
+const uint32_t ALPHA_139_LOWER_CPS[] = {
+  12593, 12596, 12599, 12601, 12609, 12610, 12613, 12615, 12616, 12618, 12619, 12620, 12621, 12622, 12623, 12625,
+  12627, 12629, 12631, 12635, 12636, 12640, 12641, 12643,
+};
+const uint32_t ALPHA_139_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_139_FREQ[] = {
+  { "ㄱ", 0.08680000 },
+  { "ㄴ", 0.07710000 },
+  { "ㄷ", 0.05910000 },
+  { "ㄹ", 0.09930000 },
+  { "ㅁ", 0.03460000 },
+  { "ㅂ", 0.04850000 },
+  { "ㅅ", 0.05680000 },
+  { "ㅇ", 0.07710000 },
+  { "ㅈ", 0.04530000 },
+  { "ㅊ", 0.03050000 },
+  { "ㅋ", 0.02820000 },
+  { "ㅌ", 0.02960000 },
+  { "ㅍ", 0.02590000 },
+  { "ㅎ", 0.04060000 },
+  { "ㅏ", 0.03830000 },
+  { "ㅑ", 0.01250000 },
+  { "ㅓ", 0.02360000 },
+  { "ㅕ", 0.01150000 },
+  { "ㅗ", 0.02770000 },
+  { "ㅛ", 0.00880000 },
+  { "ㅜ", 0.02080000 },
+  { "ㅠ", 0.01150000 },
+  { "ㅡ", 0.05500000 },
+  { "ㅣ", 0.05080000 },
+};
+
+const wa_cp_freq ALPHA_139_FREQ_CPS[] = {
+  { 0x3131u, 0.08680000 },
+  { 0x3134u, 0.07710000 },
+  { 0x3137u, 0.05910000 },
+  { 0x3139u, 0.09930000 },
+  { 0x3141u, 0.03460000 },
+  { 0x3142u, 0.04850000 },
+  { 0x3145u, 0.05680000 },
+  { 0x3147u, 0.07710000 },
+  { 0x3148u, 0.04530000 },
+  { 0x314Au, 0.03050000 },
+  { 0x314Bu, 0.02820000 },
+  { 0x314Cu, 0.02960000 },
+  { 0x314Du, 0.02590000 },
+  { 0x314Eu, 0.04060000 },
+  { 0x314Fu, 0.03830000 },
+  { 0x3151u, 0.01250000 },
+  { 0x3153u, 0.02360000 },
+  { 0x3155u, 0.01150000 },
+  { 0x3157u, 0.02770000 },
+  { 0x315Bu, 0.00880000 },
+  { 0x315Cu, 0.02080000 },
+  { 0x3160u, 0.01150000 },
+  { 0x3161u, 0.05500000 },
+  { 0x3163u, 0.05080000 },
+};
+
@@ -0,0 +1,169 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_14_UPPER[] = {
+  "А",
+  "Б",
+  "В",
+  "Г",
+  "Д",
+  "Е",
+  "Ж",
+  "З",
+  "И",
+  "Й",
+  "К",
+  "Л",
+  "М",
+  "Н",
+  "О",
+  "П",
+  "Р",
+  "С",
+  "Т",
+  "У",
+  "Ф",
+  "Х",
+  "Ч",
+  "Ш",
+  "Ы",
+  "Ј",
+  "Ғ",
+  "Ҝ",
+  "Ү",
+  "Ҹ",
+  "Һ",
+  "Ә",
+  "Ө",
+};
+const char *ALPHA_14_LOWER[] = {
+  "а",
+  "б",
+  "в",
+  "г",
+  "д",
+  "е",
+  "ж",
+  "з",
+  "и",
+  "й",
+  "к",
+  "л",
+  "м",
+  "н",
+  "о",
+  "п",
+  "р",
+  "с",
+  "т",
+  "у",
+  "ф",
+  "х",
+  "ч",
+  "ш",
+  "ы",
+  "ј",
+  "ғ",
+  "ҝ",
+  "ү",
+  "ҹ",
+  "һ",
+  "ә",
+  "ө",
+};
+const char *ALPHA_14_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_14_UPPER_CPS[] = {
+  1032, 1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053, 1054,
+  1055, 1056, 1057, 1058, 1059, 1060, 1061, 1063, 1064, 1067, 1170, 1180, 1198, 1208, 1210, 1240,
+  1256,
+};
+const uint32_t ALPHA_14_LOWER_CPS[] = {
+  1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080, 1081, 1082, 1083, 1084, 1085, 1086, 1087,
+  1088, 1089, 1090, 1091, 1092, 1093, 1095, 1096, 1099, 1112, 1171, 1181, 1199, 1209, 1211, 1241,
+  1257,
+};
+const uint32_t ALPHA_14_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_14_FREQ[] = {
+  { "а", 0.28440000 },
+  { "б", 0.00590000 },
+  { "в", 0.01560000 },
+  { "г", 0.00600000 },
+  { "д", 0.00880000 },
+  { "е", 0.12900000 },
+  { "ж", 0.00240000 },
+  { "з", 0.00590000 },
+  { "и", 0.02660000 },
+  { "й", 0.00450000 },
+  { "к", 0.03770000 },
+  { "л", 0.01210000 },
+  { "м", 0.01390000 },
+  { "н", 0.02040000 },
+  { "о", 0.12290000 },
+  { "п", 0.00820000 },
+  { "р", 0.01920000 },
+  { "с", 0.02060000 },
+  { "т", 0.02020000 },
+  { "у", 0.00720000 },
+  { "ф", 0.00180000 },
+  { "х", 0.05260000 },
+  { "ч", 0.00380000 },
+  { "ш", 0.00210000 },
+  { "ы", 0.00420000 },
+  { "ј", 0.00010000 },
+  { "ғ", 0.00000000 },
+  { "ҝ", 0.00000000 },
+  { "ү", 0.00000000 },
+  { "ҹ", 0.00000000 },
+  { "һ", 0.00210000 },
+  { "ә", 0.16190000 },
+  { "ө", 0.00010000 },
+};
+
+const wa_cp_freq ALPHA_14_FREQ_CPS[] = {
+  { 0x430u, 0.28440000 },
+  { 0x431u, 0.00590000 },
+  { 0x432u, 0.01560000 },
+  { 0x433u, 0.00600000 },
+  { 0x434u, 0.00880000 },
+  { 0x435u, 0.12900000 },
+  { 0x436u, 0.00240000 },
+  { 0x437u, 0.00590000 },
+  { 0x438u, 0.02660000 },
+  { 0x439u, 0.00450000 },
+  { 0x43Au, 0.03770000 },
+  { 0x43Bu, 0.01210000 },
+  { 0x43Cu, 0.01390000 },
+  { 0x43Du, 0.02040000 },
+  { 0x43Eu, 0.12290000 },
+  { 0x43Fu, 0.00820000 },
+  { 0x440u, 0.01920000 },
+  { 0x441u, 0.02060000 },
+  { 0x442u, 0.02020000 },
+  { 0x443u, 0.00720000 },
+  { 0x444u, 0.00180000 },
+  { 0x445u, 0.05260000 },
+  { 0x447u, 0.00380000 },
+  { 0x448u, 0.00210000 },
+  { 0x44Bu, 0.00420000 },
+  { 0x458u, 0.00010000 },
+  { 0x493u, 0.00000000 },
+  { 0x49Du, 0.00000000 },
+  { 0x4AFu, 0.00000000 },
+  { 0x4B9u, 0.00000000 },
+  { 0x4BBu, 0.00210000 },
+  { 0x4D9u, 0.16190000 },
+  { 0x4E9u, 0.00010000 },
+};
+
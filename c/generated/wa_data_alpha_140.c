@@ -0,0 +1,46107 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_140_UPPER[] = {
+  "가",
+  "각",
+  "갂",
+  "갃",
+  "간",
+  "갅",
+  "갆",
+  "갇",
+  "갈",
+  "갉",
+  "갊",
+  "갋",
+  "갌",
+  "갍",
+  "갎",
+  "갏",
+  "감",
+  "갑",
+  "값",
+  "갓",
+  "갔",
+  "강",
+  "갖",
+  "갗",
+  "갘",
+  "같",
+  "갚",
+  "갛",
+  "개",
+  "객",
+  "갞",
+  "갟",
+  "갠",
+  "갡",
+  "갢",
+  "갣",
+  "갤",
+  "갥",
+  "갦",
+  "갧",
+  "갨",
+  "갩",
+  "갪",
+  "갫",
+  "갬",
+  "갭",
+  "갮",
+  "갯",
+  "갰",
+  "갱",
+  "갲",
+  "갳",
+  "갴",
+  "갵",
+  "갶",
+  "갷",
+  "갸",
+  "갹",
+  "갺",
+  "갻",
+  "갼",
+  "갽",
+  "갾",
+  "갿",
+  "걀",
+  "걁",
+  "걂",
+  "걃",
+  "걄",
+  "걅",
+  "걆",
+  "걇",
+  "걈",
+  "걉",
+  "걊",
+  "걋",
+  "걌",
+  "걍",
+  "걎",
+  "걏",
+  "걐",
+  "걑",
+  "걒",
+  "걓",
+  "걔",
+  "걕",
+  "걖",
+  "걗",
+  "걘",
+  "걙",
+  "걚",
+  "걛",
+  "걜",
+  "걝",
+  "걞",
+  "걟",
+  "걠",
+  "걡",
+  "걢",
+  "걣",
+  "걤",
+  "걥",
+  "걦",
+  "걧",
+  "걨",
+  "걩",
+  "걪",
+  "걫",
+  "걬",
+  "걭",
+  "걮",
+  "걯",
+  "거",
+  "걱",
+  "걲",
+  "걳",
+  "건",
+  "걵",
+  "걶",
+  "걷",
+  "걸",
+  "걹",
+  "걺",
+  "걻",
+  "걼",
+  "걽",
+  "걾",
+  "걿",
+  "검",
+  "겁",
+  "겂",
+  "것",
+  "겄",
+  "겅",
+  "겆",
+  "겇",
+  "겈",
+  "겉",
+  "겊",
+  "겋",
+  "게",
+  "겍",
+  "겎",
+  "겏",
+  "겐",
+  "겑",
+  "겒",
+  "겓",
+  "겔",
+  "겕",
+  "겖",
+  "겗",
+  "겘",
+  "겙",
+  "겚",
+  "겛",
+  "겜",
+  "겝",
+  "겞",
+  "겟",
+  "겠",
+  "겡",
+  "겢",
+  "겣",
+  "겤",
+  "겥",
+  "겦",
+  "겧",
+  "겨",
+  "격",
+  "겪",
+  "겫",
+  "견",
+  "겭",
+  "겮",
+  "겯",
+  "결",
+  "겱",
+  "겲",
+  "겳",
+  "겴",
+  "겵",
+  "겶",
+  "겷",
+  "겸",
+  "겹",
+  "겺",
+  "겻",
+  "겼",
+  "경",
+  "겾",
+  "겿",
+  "곀",
+  "곁",
+  "곂",
+  "곃",
+  "계",
+  "곅",
+  "곆",
+  "곇",
+  "곈",
+  "곉",
+  "곊",
+  "곋",
+  "곌",
+  "곍",
+  "곎",
+  "곏",
+  "곐",
+  "곑",
+  "곒",
+  "곓",
+  "곔",
+  "곕",
+  "곖",
+  "곗",
+  "곘",
+  "곙",
+  "곚",
+  "곛",
+  "곜",
+  "곝",
+  "곞",
+  "곟",
+  "고",
+  "곡",
+  "곢",
+  "곣",
+  "곤",
+  "곥",
+  "곦",
+  "곧",
+  "골",
+  "곩",
+  "곪",
+  "곫",
+  "곬",
+  "곭",
+  "곮",
+  "곯",
+  "곰",
+  "곱",
+  "곲",
+  "곳",
+  "곴",
+  "공",
+  "곶",
+  "곷",
+  "곸",
+  "곹",
+  "곺",
+  "곻",
+  "과",
+  "곽",
+  "곾",
+  "곿",
+  "관",
+  "괁",
+  "괂",
+  "괃",
+  "괄",
+  "괅",
+  "괆",
+  "괇",
+  "괈",
+  "괉",
+  "괊",
+  "괋",
+  "괌",
+  "괍",
+  "괎",
+  "괏",
+  "괐",
+  "광",
+  "괒",
+  "괓",
+  "괔",
+  "괕",
+  "괖",
+  "괗",
+  "괘",
+  "괙",
+  "괚",
+  "괛",
+  "괜",
+  "괝",
+  "괞",
+  "괟",
+  "괠",
+  "괡",
+  "괢",
+  "괣",
+  "괤",
+  "괥",
+  "괦",
+  "괧",
+  "괨",
+  "괩",
+  "괪",
+  "괫",
+  "괬",
+  "괭",
+  "괮",
+  "괯",
+  "괰",
+  "괱",
+  "괲",
+  "괳",
+  "괴",
+  "괵",
+  "괶",
+  "괷",
+  "괸",
+  "괹",
+  "괺",
+  "괻",
+  "괼",
+  "괽",
+  "괾",
+  "괿",
+  "굀",
+  "굁",
+  "굂",
+  "굃",
+  "굄",
+  "굅",
+  "굆",
+  "굇",
+  "굈",
+  "굉",
+  "굊",
+  "굋",
+  "굌",
+  "굍",
+  "굎",
+  "굏",
+  "교",
+  "굑",
+  "굒",
+  "굓",
+  "굔",
+  "굕",
+  "굖",
+  "굗",
+  "굘",
+  "굙",
+  "굚",
+  "굛",
+  "굜",
+  "굝",
+  "굞",
+  "굟",
+  "굠",
+  "굡",
+  "굢",
+  "굣",
+  "굤",
+  "굥",
+  "굦",
+  "굧",
+  "굨",
+  "굩",
+  "굪",
+  "굫",
+  "구",
+  "국",
+  "굮",
+  "굯",
+  "군",
+  "굱",
+  "굲",
+  "굳",
+  "굴",
+  "굵",
+  "굶",
+  "굷",
+  "굸",
+  "굹",
+  "굺",
+  "굻",
+  "굼",
+  "굽",
+  "굾",
+  "굿",
+  "궀",
+  "궁",
+  "궂",
+  "궃",
+  "궄",
+  "궅",
+  "궆",
+  "궇",
+  "궈",
+  "궉",
+  "궊",
+  "궋",
+  "권",
+  "궍",
+  "궎",
+  "궏",
+  "궐",
+  "궑",
+  "궒",
+  "궓",
+  "궔",
+  "궕",
+  "궖",
+  "궗",
+  "궘",
+  "궙",
+  "궚",
+  "궛",
+  "궜",
+  "궝",
+  "궞",
+  "궟",
+  "궠",
+  "궡",
+  "궢",
+  "궣",
+  "궤",
+  "궥",
+  "궦",
+  "궧",
+  "궨",
+  "궩",
+  "궪",
+  "궫",
+  "궬",
+  "궭",
+  "궮",
+  "궯",
+  "궰",
+  "궱",
+  "궲",
+  "궳",
+  "궴",
+  "궵",
+  "궶",
+  "궷",
+  "궸",
+  "궹",
+  "궺",
+  "궻",
+  "궼",
+  "궽",
+  "궾",
+  "궿",
+  "귀",
+  "귁",
+  "귂",
+  "귃",
+  "귄",
+  "귅",
+  "귆",
+  "귇",
+  "귈",
+  "귉",
+  "귊",
+  "귋",
+  "귌",
+  "귍",
+  "귎",
+  "귏",
+  "귐",
+  "귑",
+  "귒",
+  "귓",
+  "귔",
+  "귕",
+  "귖",
+  "귗",
+  "귘",
+  "귙",
+  "귚",
+  "귛",
+  "규",
+  "귝",
+  "귞",
+  "귟",
+  "균",
+  "귡",
+  "귢",
+  "귣",
+  "귤",
+  "귥",
+  "귦",
+  "귧",
+  "귨",
+  "귩",
+  "귪",
+  "귫",
+  "귬",
+  "귭",
+  "귮",
+  "귯",
+  "귰",
+  "귱",
+  "귲",
+  "귳",
+  "귴",
+  "귵",
+  "귶",
+  "귷",
+  "그",
+  "극",
+  "귺",
+  "귻",
+  "근",
+  "귽",
+  "귾",
+  "귿",
+  "글",
+  "긁",
+  "긂",
+  "긃",
+  "긄",
+  "긅",
+  "긆",
+  "긇",
+  "금",
+  "급",
+  "긊",
+  "긋",
+  "긌",
+  "긍",
+  "긎",
+  "긏",
+  "긐",
+  "긑",
+  "긒",
+  "긓",
+  "긔",
+  "긕",
+  "긖",
+  "긗",
+  "긘",
+  "긙",
+  "긚",
+  "긛",
+  "긜",
+  "긝",
+  "긞",
+  "긟",
+  "긠",
+  "긡",
+  "긢",
+  "긣",
+  "긤",
+  "긥",
+  "긦",
+  "긧",
+  "긨",
+  "긩",
+  "긪",
+  "긫",
+  "긬",
+  "긭",
+  "긮",
+  "긯",
+  "기",
+  "긱",
+  "긲",
+  "긳",
+  "긴",
+  "긵",
+  "긶",
+  "긷",
+  "길",
+  "긹",
+  "긺",
+  "긻",
+  "긼",
+  "긽",
+  "긾",
+  "긿",
+  "김",
+  "깁",
+  "깂",
+  "깃",
+  "깄",
+  "깅",
+  "깆",
+  "깇",
+  "깈",
+  "깉",
+  "깊",
+  "깋",
+  "까",
+  "깍",
+  "깎",
+  "깏",
+  "깐",
+  "깑",
+  "깒",
+  "깓",
+  "깔",
+  "깕",
+  "깖",
+  "깗",
+  "깘",
+  "깙",
+  "깚",
+  "깛",
+  "깜",
+  "깝",
+  "깞",
+  "깟",
+  "깠",
+  "깡",
+  "깢",
+  "깣",
+  "깤",
+  "깥",
+  "깦",
+  "깧",
+  "깨",
+  "깩",
+  "깪",
+  "깫",
+  "깬",
+  "깭",
+  "깮",
+  "깯",
+  "깰",
+  "깱",
+  "깲",
+  "깳",
+  "깴",
+  "깵",
+  "깶",
+  "깷",
+  "깸",
+  "깹",
+  "깺",
+  "깻",
+  "깼",
+  "깽",
+  "깾",
+  "깿",
+  "꺀",
+  "꺁",
+  "꺂",
+  "꺃",
+  "꺄",
+  "꺅",
+  "꺆",
+  "꺇",
+  "꺈",
+  "꺉",
+  "꺊",
+  "꺋",
+  "꺌",
+  "꺍",
+  "꺎",
+  "꺏",
+  "꺐",
+  "꺑",
+  "꺒",
+  "꺓",
+  "꺔",
+  "꺕",
+  "꺖",
+  "꺗",
+  "꺘",
+  "꺙",
+  "꺚",
+  "꺛",
+  "꺜",
+  "꺝",
+  "꺞",
+  "꺟",
+  "꺠",
+  "꺡",
+  "꺢",
+  "꺣",
+  "꺤",
+  "꺥",
+  "꺦",
+  "꺧",
+  "꺨",
+  "꺩",
+  "꺪",
+  "꺫",
+  "꺬",
+  "꺭",
+  "꺮",
+  "꺯",
+  "꺰",
+  "꺱",
+  "꺲",
+  "꺳",
+  "꺴",
+  "꺵",
+  "꺶",
+  "꺷",
+  "꺸",
+  "꺹",
+  "꺺",
+  "꺻",
+  "꺼",
+  "꺽",
+  "꺾",
+  "꺿",
+  "껀",
+  "껁",
+  "껂",
+  "껃",
+  "껄",
+  "껅",
+  "껆",
+  "껇",
+  "껈",
+  "껉",
+  "껊",
+  "껋",
+  "껌",
+  "껍",
+  "껎",
+  "껏",
+  "껐",
+  "껑",
+  "껒",
+  "껓",
+  "껔",
+  "껕",
+  "껖",
+  "껗",
+  "께",
+  "껙",
+  "껚",
+  "껛",
+  "껜",
+  "껝",
+  "껞",
+  "껟",
+  "껠",
+  "껡",
+  "껢",
+  "껣",
+  "껤",
+  "껥",
+  "껦",
+  "껧",
+  "껨",
+  "껩",
+  "껪",
+  "껫",
+  "껬",
+  "껭",
+  "껮",
+  "껯",
+  "껰",
+  "껱",
+  "껲",
+  "껳",
+  "껴",
+  "껵",
+  "껶",
+  "껷",
+  "껸",
+  "껹",
+  "껺",
+  "껻",
+  "껼",
+  "껽",
+  "껾",
+  "껿",
+  "꼀",
+  "꼁",
+  "꼂",
+  "꼃",
+  "꼄",
+  "꼅",
+  "꼆",
+  "꼇",
+  "꼈",
+  "꼉",
+  "꼊",
+  "꼋",
+  "꼌",
+  "꼍",
+  "꼎",
+  "꼏",
+  "꼐",
+  "꼑",
+  "꼒",
+  "꼓",
+  "꼔",
+  "꼕",
+  "꼖",
+  "꼗",
+  "꼘",
+  "꼙",
+  "꼚",
+  "꼛",
+  "꼜",
+  "꼝",
+  "꼞",
+  "꼟",
+  "꼠",
+  "꼡",
+  "꼢",
+  "꼣",
+  "꼤",
+  "꼥",
+  "꼦",
+  "꼧",
+  "꼨",
+  "꼩",
+  "꼪",
+  "꼫",
+  "꼬",
+  "꼭",
+  "꼮",
+  "꼯",
+  "꼰",
+  "꼱",
+  "꼲",
+  "꼳",
+  "꼴",
+  "꼵",
+  "꼶",
+  "꼷",
+  "꼸",
+  "꼹",
+  "꼺",
+  "꼻",
+  "꼼",
+  "꼽",
+  "꼾",
+  "꼿",
+  "꽀",
+  "꽁",
+  "꽂",
+  "꽃",
+  "꽄",
+  "꽅",
+  "꽆",
+  "꽇",
+  "꽈",
+  "꽉",
+  "꽊",
+  "꽋",
+  "꽌",
+  "꽍",
+  "꽎",
+  "꽏",
+  "꽐",
+  "꽑",
+  "꽒",
+  "꽓",
+  "꽔",
+  "꽕",
+  "꽖",
+  "꽗",
+  "꽘",
+  "꽙",
+  "꽚",
+  "꽛",
+  "꽜",
+  "꽝",
+  "꽞",
+  "꽟",
+  "꽠",
+  "꽡",
+  "꽢",
+  "꽣",
+  "꽤",
+  "꽥",
+  "꽦",
+  "꽧",
+  "꽨",
+  "꽩",
+  "꽪",
+  "꽫",
+  "꽬",
+  "꽭",
+  "꽮",
+  "꽯",
+  "꽰",
+  "꽱",
+  "꽲",
+  "꽳",
+  "꽴",
+  "꽵",
+  "꽶",
+  "꽷",
+  "꽸",
+  "꽹",
+  "꽺",
+  "꽻",
+  "꽼",
+  "꽽",
+  "꽾",
+  "꽿",
+  "꾀",
+  "꾁",
+  "꾂",
+  "꾃",
+  "꾄",
+  "꾅",
+  "꾆",
+  "꾇",
+  "꾈",
+  "꾉",
+  "꾊",
+  "꾋",
+  "꾌",
+  "꾍",
+  "꾎",
+  "꾏",
+  "꾐",
+  "꾑",
+  "꾒",
+  "꾓",
+  "꾔",
+  "꾕",
+  "꾖",
+  "꾗",
+  "꾘",
+  "꾙",
+  "꾚",
+  "꾛",
+  "꾜",
+  "꾝",
+  "꾞",
+  "꾟",
+  "꾠",
+  "꾡",
+  "꾢",
+  "꾣",
+  "꾤",
+  "꾥",
+  "꾦",
+  "꾧",
+  "꾨",
+  "꾩",
+  "꾪",
+  "꾫",
+  "꾬",
+  "꾭",
+  "꾮",
+  "꾯",
+  "꾰",
+  "꾱",
+  "꾲",
+  "꾳",
+  "꾴",
+  "꾵",
+  "꾶",
+  "꾷",
+  "꾸",
+  "꾹",
+  "꾺",
+  "꾻",
+  "꾼",
+  "꾽",
+  "꾾",
+  "꾿",
+  "꿀",
+  "꿁",
+  "꿂",
+  "꿃",
+  "꿄",
+  "꿅",
+  "꿆",
+  "꿇",
+  "꿈",
+  "꿉",
+  "꿊",
+  "꿋",
+  "꿌",
+  "꿍",
+  "꿎",
+  "꿏",
+  "꿐",
+  "꿑",
+  "꿒",
+  "꿓",
+  "꿔",
+  "꿕",
+  "꿖",
+  "꿗",
+  "꿘",
+  "꿙",
+  "꿚",
+  "꿛",
+  "꿜",
+  "꿝",
+  "꿞",
+  "꿟",
+  "꿠",
+  "꿡",
+  "꿢",
+  "꿣",
+  "꿤",
+  "꿥",
+  "꿦",
+  "꿧",
+  "꿨",
+  "꿩",
+  "꿪",
+  "꿫",
+  "꿬",
+  "꿭",
+  "꿮",
+  "꿯",
+  "꿰",
+  "꿱",
+  "꿲",
+  "꿳",
+  "꿴",
+  "꿵",
+  "꿶",
+  "꿷",
+  "꿸",
+  "꿹",
+  "꿺",
+  "꿻",
+  "꿼",
+  "꿽",
+  "꿾",
+  "꿿",
+  "뀀",
+  "뀁",
+  "뀂",
+  "뀃",
+  "뀄",
+  "뀅",
+  "뀆",
+  "뀇",
+  "뀈",
+  "뀉",
+  "뀊",
+  "뀋",
+  "뀌",
+  "뀍",
+  "뀎",
+  "뀏",
+  "뀐",
+  "뀑",
+  "뀒",
+  "뀓",
+  "뀔",
+  "뀕",
+  "뀖",
+  "뀗",
+  "뀘",
+  "뀙",
+  "뀚",
+  "뀛",
+  "뀜",
+  "뀝",
+  "뀞",
+  "뀟",
+  "뀠",
+  "뀡",
+  "뀢",
+  "뀣",
+  "뀤",
+  "뀥",
+  "뀦",
+  "뀧",
+  "뀨",
+  "뀩",
+  "뀪",
+  "뀫",
+  "뀬",
+  "뀭",
+  "뀮",
+  "뀯",
+  "뀰",
+  "뀱",
+  "뀲",
+  "뀳",
+  "뀴",
+  "뀵",
+  "뀶",
+  "뀷",
+  "뀸",
+  "뀹",
+  "뀺",
+  "뀻",
+  "뀼",
+  "뀽",
+  "뀾",
+  "뀿",
+  "끀",
+  "끁",
+  "끂",
+  "끃",
+  "끄",
+  "끅",
+  "끆",
+  "끇",
+  "끈",
+  "끉",
+  "끊",
+  "끋",
+  "끌",
+  "끍",
+  "끎",
+  "끏",
+  "끐",
+  "끑",
+  "끒",
+  "끓",
+  "끔",
+  "끕",
+  "끖",
+  "끗",
+  "끘",
+  "끙",
+  "끚",
+  "끛",
+  "끜",
+  "끝",
+  "끞",
+  "끟",
+  "끠",
+  "끡",
+  "끢",
+  "끣",
+  "끤",
+  "끥",
+  "끦",
+  "끧",
+  "끨",
+  "끩",
+  "끪",
+  "끫",
+  "끬",
+  "끭",
+  "끮",
+  "끯",
+  "끰",
+  "끱",
+  "끲",
+  "끳",
+  "끴",
+  "끵",
+  "끶",
+  "끷",
+  "끸",
+  "끹",
+  "끺",
+  "끻",
+  "끼",
+  "끽",
+  "끾",
+  "끿",
+  "낀",
+  "낁",
+  "낂",
+  "낃",
+  "낄",
+  "낅",
+  "낆",
+  "낇",
+  "낈",
+  "낉",
+  "낊",
+  "낋",
+  "낌",
+  "낍",
+  "낎",
+  "낏",
+  "낐",
+  "낑",
+  "낒",
+  "낓",
+  "낔",
+  "낕",
+  "낖",
+  "낗",
+  "나",
+  "낙",
+  "낚",
+  "낛",
+  "난",
+  "낝",
+  "낞",
+  "낟",
+  "날",
+  "낡",
+  "낢",
+  "낣",
+  "낤",
+  "낥",
+  "낦",
+  "낧",
+  "남",
+  "납",
+  "낪",
+  "낫",
+  "났",
+  "낭",
+  "낮",
+  "낯",
+  "낰",
+  "낱",
+  "낲",
+  "낳",
+  "내",
+  "낵",
+  "낶",
+  "낷",
+  "낸",
+  "낹",
+  "낺",
+  "낻",
+  "낼",
+  "낽",
+  "낾",
+  "낿",
+  "냀",
+  "냁",
+  "냂",
+  "냃",
+  "냄",
+  "냅",
+  "냆",
+  "냇",
+  "냈",
+  "냉",
+  "냊",
+  "냋",
+  "냌",
+  "냍",
+  "냎",
+  "냏",
+  "냐",
+  "냑",
+  "냒",
+  "냓",
+  "냔",
+  "냕",
+  "냖",
+  "냗",
+  "냘",
+  "냙",
+  "냚",
+  "냛",
+  "냜",
+  "냝",
+  "냞",
+  "냟",
+  "냠",
+  "냡",
+  "냢",
+  "냣",
+  "냤",
+  "냥",
+  "냦",
+  "냧",
+  "냨",
+  "냩",
+  "냪",
+  "냫",
+  "냬",
+  "냭",
+  "냮",
+  "냯",
+  "냰",
+  "냱",
+  "냲",
+  "냳",
+  "냴",
+  "냵",
+  "냶",
+  "냷",
+  "냸",
+  "냹",
+  "냺",
+  "냻",
+  "냼",
+  "냽",
+  "냾",
+  "냿",
+  "넀",
+  "넁",
+  "넂",
+  "넃",
+  "넄",
+  "넅",
+  "넆",
+  "넇",
+  "너",
+  "넉",
+  "넊",
+  "넋",
+  "넌",
+  "넍",
+  "넎",
+  "넏",
+  "널",
+  "넑",
+  "넒",
+  "넓",
+  "넔",
+  "넕",
+  "넖",
+  "넗",
+  "넘",
+  "넙",
+  "넚",
+  "넛",
+  "넜",
+  "넝",
+  "넞",
+  "넟",
+  "넠",
+  "넡",
+  "넢",
+  "넣",
+  "네",
+  "넥",
+  "넦",
+  "넧",
+  "넨",
+  "넩",
+  "넪",
+  "넫",
+  "넬",
+  "넭",
+  "넮",
+  "넯",
+  "넰",
+  "넱",
+  "넲",
+  "넳",
+  "넴",
+  "넵",
+  "넶",
+  "넷",
+  "넸",
+  "넹",
+  "넺",
+  "넻",
+  "넼",
+  "넽",
+  "넾",
+  "넿",
+  "녀",
+  "녁",
+  "녂",
+  "녃",
+  "년",
+  "녅",
+  "녆",
+  "녇",
+  "녈",
+  "녉",
+  "녊",
+  "녋",
+  "녌",
+  "녍",
+  "녎",
+  "녏",
+  "념",
+  "녑",
+  "녒",
+  "녓",
+  "녔",
+  "녕",
+  "녖",
+  "녗",
+  "녘",
+  "녙",
+  "녚",
+  "녛",
+  "녜",
+  "녝",
+  "녞",
+  "녟",
+  "녠",
+  "녡",
+  "녢",
+  "녣",
+  "녤",
+  "녥",
+  "녦",
+  "녧",
+  "녨",
+  "녩",
+  "녪",
+  "녫",
+  "녬",
+  "녭",
+  "녮",
+  "녯",
+  "녰",
+  "녱",
+  "녲",
+  "녳",
+  "녴",
+  "녵",
+  "녶",
+  "녷",
+  "노",
+  "녹",
+  "녺",
+  "녻",
+  "논",
+  "녽",
+  "녾",
+  "녿",
+  "놀",
+  "놁",
+  "놂",
+  "놃",
+  "놄",
+  "놅",
+  "놆",
+  "놇",
+  "놈",
+  "놉",
+  "놊",
+  "놋",
+  "놌",
+  "농",
+  "놎",
+  "놏",
+  "놐",
+  "놑",
+  "높",
+  "놓",
+  "놔",
+  "놕",
+  "놖",
+  "놗",
+  "놘",
+  "놙",
+  "놚",
+  "놛",
+  "놜",
+  "놝",
+  "놞",
+  "놟",
+  "놠",
+  "놡",
+  "놢",
+  "놣",
+  "놤",
+  "놥",
+  "놦",
+  "놧",
+  "놨",
+  "놩",
+  "놪",
+  "놫",
+  "놬",
+  "놭",
+  "놮",
+  "놯",
+  "놰",
+  "놱",
+  "놲",
+  "놳",
+  "놴",
+  "놵",
+  "놶",
+  "놷",
+  "놸",
+  "놹",
+  "놺",
+  "놻",
+  "놼",
+  "놽",
+  "놾",
+  "놿",
+  "뇀",
+  "뇁",
+  "뇂",
+  "뇃",
+  "뇄",
+  "뇅",
+  "뇆",
+  "뇇",
+  "뇈",
+  "뇉",
+  "뇊",
+  "뇋",
+  "뇌",
+  "뇍",
+  "뇎",
+  "뇏",
+  "뇐",
+  "뇑",
+  "뇒",
+  "뇓",
+  "뇔",
+  "뇕",
+  "뇖",
+  "뇗",
+  "뇘",
+  "뇙",
+  "뇚",
+  "뇛",
+  "뇜",
+  "뇝",
+  "뇞",
+  "뇟",
+  "뇠",
+  "뇡",
+  "뇢",
+  "뇣",
+  "뇤",
+  "뇥",
+  "뇦",
+  "뇧",
+  "뇨",
+  "뇩",
+  "뇪",
+  "뇫",
+  "뇬",
+  "뇭",
+  "뇮",
+  "뇯",
+  "뇰",
+  "뇱",
+  "뇲",
+  "뇳",
+  "뇴",
+  "뇵",
+  "뇶",
+  "뇷",
+  "뇸",
+  "뇹",
+  "뇺",
+  "뇻",
+  "뇼",
+  "뇽",
+  "뇾",
+  "뇿",
+  "눀",
+  "눁",
+  "눂",
+  "눃",
+  "누",
+  "눅",
+  "눆",
+  "눇",
+  "눈",
+  "눉",
+  "눊",
+  "눋",
+  "눌",
+  "눍",
+  "눎",
+  "눏",
+  "눐",
+  "눑",
+  "눒",
+  "눓",
+  "눔",
+  "눕",
+  "눖",
+  "눗",
+  "눘",
+  "눙",
+  "눚",
+  "눛",
+  "눜",
+  "눝",
+  "눞",
+  "눟",
+  "눠",
+  "눡",
+  "눢",
+  "눣",
+  "눤",
+  "눥",
+  "눦",
+  "눧",
+  "눨",
+  "눩",
+  "눪",
+  "눫",
+  "눬",
+  "눭",
+  "눮",
+  "눯",
+  "눰",
+  "눱",
+  "눲",
+  "눳",
+  "눴",
+  "눵",
+  "눶",
+  "눷",
+  "눸",
+  "눹",
+  "눺",
+  "눻",
+  "눼",
+  "눽",
+  "눾",
+  "눿",
+  "뉀",
+  "뉁",
+  "뉂",
+  "뉃",
+  "뉄",
+  "뉅",
+  "뉆",
+  "뉇",
+  "뉈",
+  "뉉",
+  "뉊",
+  "뉋",
+  "뉌",
+  "뉍",
+  "뉎",
+  "뉏",
+  "뉐",
+  "뉑",
+  "뉒",
+  "뉓",
+  "뉔",
+  "뉕",
+  "뉖",
+  "뉗",
+  "뉘",
+  "뉙",
+  "뉚",
+  "뉛",
+  "뉜",
+  "뉝",
+  "뉞",
+  "뉟",
+  "뉠",
+  "뉡",
+  "뉢",
+  "뉣",
+  "뉤",
+  "뉥",
+  "뉦",
+  "뉧",
+  "뉨",
+  "뉩",
+  "뉪",
+  "뉫",
+  "뉬",
+  "뉭",
+  "뉮",
+  "뉯",
+  "뉰",
+  "뉱",
+  "뉲",
+  "뉳",
+  "뉴",
+  "뉵",
+  "뉶",
+  "뉷",
+  "뉸",
+  "뉹",
+  "뉺",
+  "뉻",
+  "뉼",
+  "뉽",
+  "뉾",
+  "뉿",
+  "늀",
+  "늁",
+  "늂",
+  "늃",
+  "늄",
+  "늅",
+  "늆",
+  "늇",
+  "늈",
+  "늉",
+  "늊",
+  "늋",
+  "늌",
+  "늍",
+  "늎",
+  "늏",
+  "느",
+  "늑",
+  "늒",
+  "늓",
+  "는",
+  "늕",
+  "늖",
+  "늗",
+  "늘",
+  "늙",
+  "늚",
+  "늛",
+  "늜",
+  "늝",
+  "늞",
+  "늟",
+  "늠",
+  "늡",
+  "늢",
+  "늣",
+  "늤",
+  "능",
+  "늦",
+  "늧",
+  "늨",
+  "늩",
+  "늪",
+  "늫",
+  "늬",
+  "늭",
+  "늮",
+  "늯",
+  "늰",
+  "늱",
+  "늲",
+  "늳",
+  "늴",
+  "늵",
+  "늶",
+  "늷",
+  "늸",
+  "늹",
+  "늺",
+  "늻",
+  "늼",
+  "늽",
+  "늾",
+  "늿",
+  "닀",
+  "닁",
+  "닂",
+  "닃",
+  "닄",
+  "닅",
+  "닆",
+  "닇",
+  "니",
+  "닉",
+  "닊",
+  "닋",
+  "닌",
+  "닍",
+  "닎",
+  "닏",
+  "닐",
+  "닑",
+  "닒",
+  "닓",
+  "닔",
+  "닕",
+  "닖",
+  "닗",
+  "님",
+  "닙",
+  "닚",
+  "닛",
+  "닜",
+  "닝",
+  "닞",
+  "닟",
+  "닠",
+  "닡",
+  "닢",
+  "닣",
+  "다",
+  "닥",
+  "닦",
+  "닧",
+  "단",
+  "닩",
+  "닪",
+  "닫",
+  "달",
+  "닭",
+  "닮",
+  "닯",
+  "닰",
+  "닱",
+  "닲",
+  "닳",
+  "담",
+  "답",
+  "닶",
+  "닷",
+  "닸",
+  "당",
+  "닺",
+  "닻",
+  "닼",
+  "닽",
+  "닾",
+  "닿",
+  "대",
+  "댁",
+  "댂",
+  "댃",
+  "댄",
+  "댅",
+  "댆",
+  "댇",
+  "댈",
+  "댉",
+  "댊",
+  "댋",
+  "댌",
+  "댍",
+  "댎",
+  "댏",
+  "댐",
+  "댑",
+  "댒",
+  "댓",
+  "댔",
+  "댕",
+  "댖",
+  "댗",
+  "댘",
+  "댙",
+  "댚",
+  "댛",
+  "댜",
+  "댝",
+  "댞",
+  "댟",
+  "댠",
+  "댡",
+  "댢",
+  "댣",
+  "댤",
+  "댥",
+  "댦",
+  "댧",
+  "댨",
+  "댩",
+  "댪",
+  "댫",
+  "댬",
+  "댭",
+  "댮",
+  "댯",
+  "댰",
+  "댱",
+  "댲",
+  "댳",
+  "댴",
+  "댵",
+  "댶",
+  "댷",
+  "댸",
+  "댹",
+  "댺",
+  "댻",
+  "댼",
+  "댽",
+  "댾",
+  "댿",
+  "덀",
+  "덁",
+  "덂",
+  "덃",
+  "덄",
+  "덅",
+  "덆",
+  "덇",
+  "덈",
+  "덉",
+  "덊",
+  "덋",
+  "덌",
+  "덍",
+  "덎",
+  "덏",
+  "덐",
+  "덑",
+  "덒",
+  "덓",
+  "더",
+  "덕",
+  "덖",
+  "덗",
+  "던",
+  "덙",
+  "덚",
+  "덛",
+  "덜",
+  "덝",
+  "덞",
+  "덟",
+  "덠",
+  "덡",
+  "덢",
+  "덣",
+  "덤",
+  "덥",
+  "덦",
+  "덧",
+  "덨",
+  "덩",
+  "덪",
+  "덫",
+  "덬",
+  "덭",
+  "덮",
+  "덯",
+  "데",
+  "덱",
+  "덲",
+  "덳",
+  "덴",
+  "덵",
+  "덶",
+  "덷",
+  "델",
+  "덹",
+  "덺",
+  "덻",
+  "덼",
+  "덽",
+  "덾",
+  "덿",
+  "뎀",
+  "뎁",
+  "뎂",
+  "뎃",
+  "뎄",
+  "뎅",
+  "뎆",
+  "뎇",
+  "뎈",
+  "뎉",
+  "뎊",
+  "뎋",
+  "뎌",
+  "뎍",
+  "뎎",
+  "뎏",
+  "뎐",
+  "뎑",
+  "뎒",
+  "뎓",
+  "뎔",
+  "뎕",
+  "뎖",
+  "뎗",
+  "뎘",
+  "뎙",
+  "뎚",
+  "뎛",
+  "뎜",
+  "뎝",
+  "뎞",
+  "뎟",
+  "뎠",
+  "뎡",
+  "뎢",
+  "뎣",
+  "뎤",
+  "뎥",
+  "뎦",
+  "뎧",
+  "뎨",
+  "뎩",
+  "뎪",
+  "뎫",
+  "뎬",
+  "뎭",
+  "뎮",
+  "뎯",
+  "뎰",
+  "뎱",
+  "뎲",
+  "뎳",
+  "뎴",
+  "뎵",
+  "뎶",
+  "뎷",
+  "뎸",
+  "뎹",
+  "뎺",
+  "뎻",
+  "뎼",
+  "뎽",
+  "뎾",
+  "뎿",
+  "돀",
+  "돁",
+  "돂",
+  "돃",
+  "도",
+  "독",
+  "돆",
+  "돇",
+  "돈",
+  "돉",
+  "돊",
+  "돋",
+  "돌",
+  "돍",
+  "돎",
+  "돏",
+  "돐",
+  "돑",
+  "돒",
+  "돓",
+  "돔",
+  "돕",
+  "돖",
+  "돗",
+  "돘",
+  "동",
+  "돚",
+  "돛",
+  "돜",
+  "돝",
+  "돞",
+  "돟",
+  "돠",
+  "돡",
+  "돢",
+  "돣",
+  "돤",
+  "돥",
+  "돦",
+  "돧",
+  "돨",
+  "돩",
+  "돪",
+  "돫",
+  "돬",
+  "돭",
+  "돮",
+  "돯",
+  "돰",
+  "돱",
+  "돲",
+  "돳",
+  "돴",
+  "돵",
+  "돶",
+  "돷",
+  "돸",
+  "돹",
+  "돺",
+  "돻",
+  "돼",
+  "돽",
+  "돾",
+  "돿",
+  "됀",
+  "됁",
+  "됂",
+  "됃",
+  "됄",
+  "됅",
+  "됆",
+  "됇",
+  "됈",
+  "됉",
+  "됊",
+  "됋",
+  "됌",
+  "됍",
+  "됎",
+  "됏",
+  "됐",
+  "됑",
+  "됒",
+  "됓",
+  "됔",
+  "됕",
+  "됖",
+  "됗",
+  "되",
+  "됙",
+  "됚",
+  "됛",
+  "된",
+  "됝",
+  "됞",
+  "됟",
+  "될",
+  "됡",
+  "됢",
+  "됣",
+  "됤",
+  "됥",
+  "됦",
+  "됧",
+  "됨",
+  "됩",
+  "됪",
+  "됫",
+  "됬",
+  "됭",
+  "됮",
+  "됯",
+  "됰",
+  "됱",
+  "됲",
+  "됳",
+  "됴",
+  "됵",
+  "됶",
+  "됷",
+  "됸",
+  "됹",
+  "됺",
+  "됻",
+  "됼",
+  "됽",
+  "됾",
+  "됿",
+  "둀",
+  "둁",
+  "둂",
+  "둃",
+  "둄",
+  "둅",
+  "둆",
+  "둇",
+  "둈",
+  "둉",
+  "둊",
+  "둋",
+  "둌",
+  "둍",
+  "둎",
+  "둏",
+  "두",
+  "둑",
+  "둒",
+  "둓",
+  "둔",
+  "둕",
+  "둖",
+  "둗",
+  "둘",
+  "둙",
+  "둚",
+  "둛",
+  "둜",
+  "둝",
+  "둞",
+  "둟",
+  "둠",
+  "둡",
+  "둢",
+  "둣",
+  "둤",
+  "둥",
+  "둦",
+  "둧",
+  "둨",
+  "둩",
+  "둪",
+  "둫",
+  "둬",
+  "둭",
+  "둮",
+  "둯",
+  "둰",
+  "둱",
+  "둲",
+  "둳",
+  "둴",
+  "둵",
+  "둶",
+  "둷",
+  "둸",
+  "둹",
+  "둺",
+  "둻",
+  "둼",
+  "둽",
+  "둾",
+  "둿",
+  "뒀",
+  "뒁",
+  "뒂",
+  "뒃",
+  "뒄",
+  "뒅",
+  "뒆",
+  "뒇",
+  "뒈",
+  "뒉",
+  "뒊",
+  "뒋",
+  "뒌",
+  "뒍",
+  "뒎",
+  "뒏",
+  "뒐",
+  "뒑",
+  "뒒",
+  "뒓",
+  "뒔",
+  "뒕",
+  "뒖",
+  "뒗",
+  "뒘",
+  "뒙",
+  "뒚",
+  "뒛",
+  "뒜",
+  "뒝",
+  "뒞",
+  "뒟",
+  "뒠",
+  "뒡",
+  "뒢",
+  "뒣",
+  "뒤",
+  "뒥",
+  "뒦",
+  "뒧",
+  "뒨",
+  "뒩",
+  "뒪",
+  "뒫",
+  "뒬",
+  "뒭",
+  "뒮",
+  "뒯",
+  "뒰",
+  "뒱",
+  "뒲",
+  "뒳",
+  "뒴",
+  "뒵",
+  "뒶",
+  "뒷",
+  "뒸",
+  "뒹",
+  "뒺",
+  "뒻",
+  "뒼",
+  "뒽",
+  "뒾",
+  "뒿",
+  "듀",
+  "듁",
+  "듂",
+  "듃",
+  "듄",
+  "듅",
+  "듆",
+  "듇",
+  "듈",
+  "듉",
+  "듊",
+  "듋",
+  "듌",
+  "듍",
+  "듎",
+  "듏",
+  "듐",
+  "듑",
+  "듒",
+  "듓",
+  "듔",
+  "듕",
+  "듖",
+  "듗",
+  "듘",
+  "듙",
+  "듚",
+  "듛",
+  "드",
+  "득",
+  "듞",
+  "듟",
+  "든",
+  "듡",
+  "듢",
+  "듣",
+  "들",
+  "듥",
+  "듦",
+  "듧",
+  "듨",
+  "듩",
+  "듪",
+  "듫",
+  "듬",
+  "듭",
+  "듮",
+  "듯",
+  "듰",
+  "등",
+  "듲",
+  "듳",
+  "듴",
+  "듵",
+  "듶",
+  "듷",
+  "듸",
+  "듹",
+  "듺",
+  "듻",
+  "듼",
+  "듽",
+  "듾",
+  "듿",
+  "딀",
+  "딁",
+  "딂",
+  "딃",
+  "딄",
+  "딅",
+  "딆",
+  "딇",
+  "딈",
+  "딉",
+  "딊",
+  "딋",
+  "딌",
+  "딍",
+  "딎",
+  "딏",
+  "딐",
+  "딑",
+  "딒",
+  "딓",
+  "디",
+  "딕",
+  "딖",
+  "딗",
+  "딘",
+  "딙",
+  "딚",
+  "딛",
+  "딜",
+  "딝",
+  "딞",
+  "딟",
+  "딠",
+  "딡",
+  "딢",
+  "딣",
+  "딤",
+  "딥",
+  "딦",
+  "딧",
+  "딨",
+  "딩",
+  "딪",
+  "딫",
+  "딬",
+  "딭",
+  "딮",
+  "딯",
+  "따",
+  "딱",
+  "딲",
+  "딳",
+  "딴",
+  "딵",
+  "딶",
+  "딷",
+  "딸",
+  "딹",
+  "딺",
+  "딻",
+  "딼",
+  "딽",
+  "딾",
+  "딿",
+  "땀",
+  "땁",
+  "땂",
+  "땃",
+  "땄",
+  "땅",
+  "땆",
+  "땇",
+  "땈",
+  "땉",
+  "땊",
+  "땋",
+  "때",
+  "땍",
+  "땎",
+  "땏",
+  "땐",
+  "땑",
+  "땒",
+  "땓",
+  "땔",
+  "땕",
+  "땖",
+  "땗",
+  "땘",
+  "땙",
+  "땚",
+  "땛",
+  "땜",
+  "땝",
+  "땞",
+  "땟",
+  "땠",
+  "땡",
+  "땢",
+  "땣",
+  "땤",
+  "땥",
+  "땦",
+  "땧",
+  "땨",
+  "땩",
+  "땪",
+  "땫",
+  "땬",
+  "땭",
+  "땮",
+  "땯",
+  "땰",
+  "땱",
+  "땲",
+  "땳",
+  "땴",
+  "땵",
+  "땶",
+  "땷",
+  "땸",
+  "땹",
+  "땺",
+  "땻",
+  "땼",
+  "땽",
+  "땾",
+  "땿",
+  "떀",
+  "떁",
+  "떂",
+  "떃",
+  "떄",
+  "떅",
+  "떆",
+  "떇",
+  "떈",
+  "떉",
+  "떊",
+  "떋",
+  "떌",
+  "떍",
+  "떎",
+  "떏",
+  "떐",
+  "떑",
+  "떒",
+  "떓",
+  "떔",
+  "떕",
+  "떖",
+  "떗",
+  "떘",
+  "떙",
+  "떚",
+  "떛",
+  "떜",
+  "떝",
+  "떞",
+  "떟",
+  "떠",
+  "떡",
+  "떢",
+  "떣",
+  "떤",
+  "떥",
+  "떦",
+  "떧",
+  "떨",
+  "떩",
+  "떪",
+  "떫",
+  "떬",
+  "떭",
+  "떮",
+  "떯",
+  "떰",
+  "떱",
+  "떲",
+  "떳",
+  "떴",
+  "떵",
+  "떶",
+  "떷",
+  "떸",
+  "떹",
+  "떺",
+  "떻",
+  "떼",
+  "떽",
+  "떾",
+  "떿",
+  "뗀",
+  "뗁",
+  "뗂",
+  "뗃",
+  "뗄",
+  "뗅",
+  "뗆",
+  "뗇",
+  "뗈",
+  "뗉",
+  "뗊",
+  "뗋",
+  "뗌",
+  "뗍",
+  "뗎",
+  "뗏",
+  "뗐",
+  "뗑",
+  "뗒",
+  "뗓",
+  "뗔",
+  "뗕",
+  "뗖",
+  "뗗",
+  "뗘",
+  "뗙",
+  "뗚",
+  "뗛",
+  "뗜",
+  "뗝",
+  "뗞",
+  "뗟",
+  "뗠",
+  "뗡",
+  "뗢",
+  "뗣",
+  "뗤",
+  "뗥",
+  "뗦",
+  "뗧",
+  "뗨",
+  "뗩",
+  "뗪",
+  "뗫",
+  "뗬",
+  "뗭",
+  "뗮",
+  "뗯",
+  "뗰",
+  "뗱",
+  "뗲",
+  "뗳",
+  "뗴",
+  "뗵",
+  "뗶",
+  "뗷",
+  "뗸",
+  "뗹",
+  "뗺",
+  "뗻",
+  "뗼",
+  "뗽",
+  "뗾",
+  "뗿",
+  "똀",
+  "똁",
+  "똂",
+  "똃",
+  "똄",
+  "똅",
+  "똆",
+  "똇",
+  "똈",
+  "똉",
+  "똊",
+  "똋",
+  "똌",
+  "똍",
+  "똎",
+  "똏",
+  "또",
+  "똑",
+  "똒",
+  "똓",
+  "똔",
+  "똕",
+  "똖",
+  "똗",
+  "똘",
+  "똙",
+  "똚",
+  "똛",
+  "똜",
+  "똝",
+  "똞",
+  "똟",
+  "똠",
+  "똡",
+  "똢",
+  "똣",
+  "똤",
+  "똥",
+  "똦",
+  "똧",
+  "똨",
+  "똩",
+  "똪",
+  "똫",
+  "똬",
+  "똭",
+  "똮",
+  "똯",
+  "똰",
+  "똱",
+  "똲",
+  "똳",
+  "똴",
+  "똵",
+  "똶",
+  "똷",
+  "똸",
+  "똹",
+  "똺",
+  "똻",
+  "똼",
+  "똽",
+  "똾",
+  "똿",
+  "뙀",
+  "뙁",
+  "뙂",
+  "뙃",
+  "뙄",
+  "뙅",
+  "뙆",
+  "뙇",
+  "뙈",
+  "뙉",
+  "뙊",
+  "뙋",
+  "뙌",
+  "뙍",
+  "뙎",
+  "뙏",
+  "뙐",
+  "뙑",
+  "뙒",
+  "뙓",
+  "뙔",
+  "뙕",
+  "뙖",
+  "뙗",
+  "뙘",
+  "뙙",
+  "뙚",
+  "뙛",
+  "뙜",
+  "뙝",
+  "뙞",
+  "뙟",
+  "뙠",
+  "뙡",
+  "뙢",
+  "뙣",
+  "뙤",
+  "뙥",
+  "뙦",
+  "뙧",
+  "뙨",
+  "뙩",
+  "뙪",
+  "뙫",
+  "뙬",
+  "뙭",
+  "뙮",
+  "뙯",
+  "뙰",
+  "뙱",
+  "뙲",
+  "뙳",
+  "뙴",
+  "뙵",
+  "뙶",
+  "뙷",
+  "뙸",
+  "뙹",
+  "뙺",
+  "뙻",
+  "뙼",
+  "뙽",
+  "뙾",
+  "뙿",
+  "뚀",
+  "뚁",
+  "뚂",
+  "뚃",
+  "뚄",
+  "뚅",
+  "뚆",
+  "뚇",
+  "뚈",
+  "뚉",
+  "뚊",
+  "뚋",
+  "뚌",
+  "뚍",
+  "뚎",
+  "뚏",
+  "뚐",
+  "뚑",
+  "뚒",
+  "뚓",
+  "뚔",
+  "뚕",
+  "뚖",
+  "뚗",
+  "뚘",
+  "뚙",
+  "뚚",
+  "뚛",
+  "뚜",
+  "뚝",
+  "뚞",
+  "뚟",
+  "뚠",
+  "뚡",
+  "뚢",
+  "뚣",
+  "뚤",
+  "뚥",
+  "뚦",
+  "뚧",
+  "뚨",
+  "뚩",
+  "뚪",
+  "뚫",
+  "뚬",
+  "뚭",
+  "뚮",
+  "뚯",
+  "뚰",
+  "뚱",
+  "뚲",
+  "뚳",
+  "뚴",
+  "뚵",
+  "뚶",
+  "뚷",
+  "뚸",
+  "뚹",
+  "뚺",
+  "뚻",
+  "뚼",
+  "뚽",
+  "뚾",
+  "뚿",
+  "뛀",
+  "뛁",
+  "뛂",
+  "뛃",
+  "뛄",
+  "뛅",
+  "뛆",
+  "뛇",
+  "뛈",
+  "뛉",
+  "뛊",
+  "뛋",
+  "뛌",
+  "뛍",
+  "뛎",
+  "뛏",
+  "뛐",
+  "뛑",
+  "뛒",
+  "뛓",
+  "뛔",
+  "뛕",
+  "뛖",
+  "뛗",
+  "뛘",
+  "뛙",
+  "뛚",
+  "뛛",
+  "뛜",
+  "뛝",
+  "뛞",
+  "뛟",
+  "뛠",
+  "뛡",
+  "뛢",
+  "뛣",
+  "뛤",
+  "뛥",
+  "뛦",
+  "뛧",
+  "뛨",
+  "뛩",
+  "뛪",
+  "뛫",
+  "뛬",
+  "뛭",
+  "뛮",
+  "뛯",
+  "뛰",
+  "뛱",
+  "뛲",
+  "뛳",
+  "뛴",
+  "뛵",
+  "뛶",
+  "뛷",
+  "뛸",
+  "뛹",
+  "뛺",
+  "뛻",
+  "뛼",
+  "뛽",
+  "뛾",
+  "뛿",
+  "뜀",
+  "뜁",
+  "뜂",
+  "뜃",
+  "뜄",
+  "뜅",
+  "뜆",
+  "뜇",
+  "뜈",
+  "뜉",
+  "뜊",
+  "뜋",
+  "뜌",
+  "뜍",
+  "뜎",
+  "뜏",
+  "뜐",
+  "뜑",
+  "뜒",
+  "뜓",
+  "뜔",
+  "뜕",
+  "뜖",
+  "뜗",
+  "뜘",
+  "뜙",
+  "뜚",
+  "뜛",
+  "뜜",
+  "뜝",
+  "뜞",
+  "뜟",
+  "뜠",
+  "뜡",
+  "뜢",
+  "뜣",
+  "뜤",
+  "뜥",
+  "뜦",
+  "뜧",
+  "뜨",
+  "뜩",
+  "뜪",
+  "뜫",
+  "뜬",
+  "뜭",
+  "뜮",
+  "뜯",
+  "뜰",
+  "뜱",
+  "뜲",
+  "뜳",
+  "뜴",
+  "뜵",
+  "뜶",
+  "뜷",
+  "뜸",
+  "뜹",
+  "뜺",
+  "뜻",
+  "뜼",
+  "뜽",
+  "뜾",
+  "뜿",
+  "띀",
+  "띁",
+  "띂",
+  "띃",
+  "띄",
+  "띅",
+  "띆",
+  "띇",
+  "띈",
+  "띉",
+  "띊",
+  "띋",
+  "띌",
+  "띍",
+  "띎",
+  "띏",
+  "띐",
+  "띑",
+  "띒",
+  "띓",
+  "띔",
+  "띕",
+  "띖",
+  "띗",
+  "띘",
+  "띙",
+  "띚",
+  "띛",
+  "띜",
+  "띝",
+  "띞",
+  "띟",
+  "띠",
+  "띡",
+  "띢",
+  "띣",
+  "띤",
+  "띥",
+  "띦",
+  "띧",
+  "띨",
+  "띩",
+  "띪",
+  "띫",
+  "띬",
+  "띭",
+  "띮",
+  "띯",
+  "띰",
+  "띱",
+  "띲",
+  "띳",
+  "띴",
+  "띵",
+  "띶",
+  "띷",
+  "띸",
+  "띹",
+  "띺",
+  "띻",
+  "라",
+  "락",
+  "띾",
+  "띿",
+  "란",
+  "랁",
+  "랂",
+  "랃",
+  "랄",
+  "랅",
+  "랆",
+  "랇",
+  "랈",
+  "랉",
+  "랊",
+  "랋",
+  "람",
+  "랍",
+  "랎",
+  "랏",
+  "랐",
+  "랑",
+  "랒",
+  "랓",
+  "랔",
+  "랕",
+  "랖",
+  "랗",
+  "래",
+  "랙",
+  "랚",
+  "랛",
+  "랜",
+  "랝",
+  "랞",
+  "랟",
+  "랠",
+  "랡",
+  "랢",
+  "랣",
+  "랤",
+  "랥",
+  "랦",
+  "랧",
+  "램",
+  "랩",
+  "랪",
+  "랫",
+  "랬",
+  "랭",
+  "랮",
+  "랯",
+  "랰",
+  "랱",
+  "랲",
+  "랳",
+  "랴",
+  "략",
+  "랶",
+  "랷",
+  "랸",
+  "랹",
+  "랺",
+  "랻",
+  "랼",
+  "랽",
+  "랾",
+  "랿",
+  "럀",
+  "럁",
+  "럂",
+  "럃",
+  "럄",
+  "럅",
+  "럆",
+  "럇",
+  "럈",
+  "량",
+  "럊",
+  "럋",
+  "럌",
+  "럍",
+  "럎",
+  "럏",
+  "럐",
+  "럑",
+  "럒",
+  "럓",
+  "럔",
+  "럕",
+  "럖",
+  "럗",
+  "럘",
+  "럙",
+  "럚",
+  "럛",
+  "럜",
+  "럝",
+  "럞",
+  "럟",
+  "럠",
+  "럡",
+  "럢",
+  "럣",
+  "럤",
+  "럥",
+  "럦",
+  "럧",
+  "럨",
+  "럩",
+  "럪",
+  "럫",
+  "러",
+  "럭",
+  "럮",
+  "럯",
+  "런",
+  "럱",
+  "럲",
+  "럳",
+  "럴",
+  "럵",
+  "럶",
+  "럷",
+  "럸",
+  "럹",
+  "럺",
+  "럻",
+  "럼",
+  "럽",
+  "럾",
+  "럿",
+  "렀",
+  "렁",
+  "렂",
+  "렃",
+  "렄",
+  "렅",
+  "렆",
+  "렇",
+  "레",
+  "렉",
+  "렊",
+  "렋",
+  "렌",
+  "렍",
+  "렎",
+  "렏",
+  "렐",
+  "렑",
+  "렒",
+  "렓",
+  "렔",
+  "렕",
+  "렖",
+  "렗",
+  "렘",
+  "렙",
+  "렚",
+  "렛",
+  "렜",
+  "렝",
+  "렞",
+  "렟",
+  "렠",
+  "렡",
+  "렢",
+  "렣",
+  "려",
+  "력",
+  "렦",
+  "렧",
+  "련",
+  "렩",
+  "렪",
+  "렫",
+  "렬",
+  "렭",
+  "렮",
+  "렯",
+  "렰",
+  "렱",
+  "렲",
+  "렳",
+  "렴",
+  "렵",
+  "렶",
+  "렷",
+  "렸",
+  "령",
+  "렺",
+  "렻",
+  "렼",
+  "렽",
+  "렾",
+  "렿",
+  "례",
+  "롁",
+  "롂",
+  "롃",
+  "롄",
+  "롅",
+  "롆",
+  "롇",
+  "롈",
+  "롉",
+  "롊",
+  "롋",
+  "롌",
+  "롍",
+  "롎",
+  "롏",
+  "롐",
+  "롑",
+  "롒",
+  "롓",
+  "롔",
+  "롕",
+  "롖",
+  "롗",
+  "롘",
+  "롙",
+  "롚",
+  "롛",
+  "로",
+  "록",
+  "롞",
+  "롟",
+  "론",
+  "롡",
+  "롢",
+  "롣",
+  "롤",
+  "롥",
+  "롦",
+  "롧",
+  "롨",
+  "롩",
+  "롪",
+  "롫",
+  "롬",
+  "롭",
+  "롮",
+  "롯",
+  "롰",
+  "롱",
+  "롲",
+  "롳",
+  "롴",
+  "롵",
+  "롶",
+  "롷",
+  "롸",
+  "롹",
+  "롺",
+  "롻",
+  "롼",
+  "롽",
+  "롾",
+  "롿",
+  "뢀",
+  "뢁",
+  "뢂",
+  "뢃",
+  "뢄",
+  "뢅",
+  "뢆",
+  "뢇",
+  "뢈",
+  "뢉",
+  "뢊",
+  "뢋",
+  "뢌",
+  "뢍",
+  "뢎",
+  "뢏",
+  "뢐",
+  "뢑",
+  "뢒",
+  "뢓",
+  "뢔",
+  "뢕",
+  "뢖",
+  "뢗",
+  "뢘",
+  "뢙",
+  "뢚",
+  "뢛",
+  "뢜",
+  "뢝",
+  "뢞",
+  "뢟",
+  "뢠",
+  "뢡",
+  "뢢",
+  "뢣",
+  "뢤",
+  "뢥",
+  "뢦",
+  "뢧",
+  "뢨",
+  "뢩",
+  "뢪",
+  "뢫",
+  "뢬",
+  "뢭",
+  "뢮",
+  "뢯",
+  "뢰",
+  "뢱",
+  "뢲",
+  "뢳",
+  "뢴",
+  "뢵",
+  "뢶",
+  "뢷",
+  "뢸",
+  "뢹",
+  "뢺",
+  "뢻",
+  "뢼",
+  "뢽",
+  "뢾",
+  "뢿",
+  "룀",
+  "룁",
+  "룂",
+  "룃",
+  "룄",
+  "룅",
+  "룆",
+  "룇",
+  "룈",
+  "룉",
+  "룊",
+  "룋",
+  "료",
+  "룍",
+  "룎",
+  "룏",
+  "룐",
+  "룑",
+  "룒",
+  "룓",
+  "룔",
+  "룕",
+  "룖",
+  "룗",
+  "룘",
+  "룙",
+  "룚",
+  "룛",
+  "룜",
+  "룝",
+  "룞",
+  "룟",
+  "룠",
+  "룡",
+  "룢",
+  "룣",
+  "룤",
+  "룥",
+  "룦",
+  "룧",
+  "루",
+  "룩",
+  "룪",
+  "룫",
+  "룬",
+  "룭",
+  "룮",
+  "룯",
+  "룰",
+  "룱",
+  "룲",
+  "룳",
+  "룴",
+  "룵",
+  "룶",
+  "룷",
+  "룸",
+  "룹",
+  "룺",
+  "룻",
+  "룼",
+  "룽",
+  "룾",
+  "룿",
+  "뤀",
+  "뤁",
+  "뤂",
+  "뤃",
+  "뤄",
+  "뤅",
+  "뤆",
+  "뤇",
+  "뤈",
+  "뤉",
+  "뤊",
+  "뤋",
+  "뤌",
+  "뤍",
+  "뤎",
+  "뤏",
+  "뤐",
+  "뤑",
+  "뤒",
+  "뤓",
+  "뤔",
+  "뤕",
+  "뤖",
+  "뤗",
+  "뤘",
+  "뤙",
+  "뤚",
+  "뤛",
+  "뤜",
+  "뤝",
+  "뤞",
+  "뤟",
+  "뤠",
+  "뤡",
+  "뤢",
+  "뤣",
+  "뤤",
+  "뤥",
+  "뤦",
+  "뤧",
+  "뤨",
+  "뤩",
+  "뤪",
+  "뤫",
+  "뤬",
+  "뤭",
+  "뤮",
+  "뤯",
+  "뤰",
+  "뤱",
+  "뤲",
+  "뤳",
+  "뤴",
+  "뤵",
+  "뤶",
+  "뤷",
+  "뤸",
+  "뤹",
+  "뤺",
+  "뤻",
+  "뤼",
+  "뤽",
+  "뤾",
+  "뤿",
+  "륀",
+  "륁",
+  "륂",
+  "륃",
+  "륄",
+  "륅",
+  "륆",
+  "륇",
+  "륈",
+  "륉",
+  "륊",
+  "륋",
+  "륌",
+  "륍",
+  "륎",
+  "륏",
+  "륐",
+  "륑",
+  "륒",
+  "륓",
+  "륔",
+  "륕",
+  "륖",
+  "륗",
+  "류",
+  "륙",
+  "륚",
+  "륛",
+  "륜",
+  "륝",
+  "륞",
+  "륟",
+  "률",
+  "륡",
+  "륢",
+  "륣",
+  "륤",
+  "륥",
+  "륦",
+  "륧",
+  "륨",
+  "륩",
+  "륪",
+  "륫",
+  "륬",
+  "륭",
+  "륮",
+  "륯",
+  "륰",
+  "륱",
+  "륲",
+  "륳",
+  "르",
+  "륵",
+  "륶",
+  "륷",
+  "른",
+  "륹",
+  "륺",
+  "륻",
+  "를",
+  "륽",
+  "륾",
+  "륿",
+  "릀",
+  "릁",
+  "릂",
+  "릃",
+  "름",
+  "릅",
+  "릆",
+  "릇",
+  "릈",
+  "릉",
+  "릊",
+  "릋",
+  "릌",
+  "릍",
+  "릎",
+  "릏",
+  "릐",
+  "릑",
+  "릒",
+  "릓",
+  "릔",
+  "릕",
+  "릖",
+  "릗",
+  "릘",
+  "릙",
+  "릚",
+  "릛",
+  "릜",
+  "릝",
+  "릞",
+  "릟",
+  "릠",
+  "릡",
+  "릢",
+  "릣",
+  "릤",
+  "릥",
+  "릦",
+  "릧",
+  "릨",
+  "릩",
+  "릪",
+  "릫",
+  "리",
+  "릭",
+  "릮",
+  "릯",
+  "린",
+  "릱",
+  "릲",
+  "릳",
+  "릴",
+  "릵",
+  "릶",
+  "릷",
+  "릸",
+  "릹",
+  "릺",
+  "릻",
+  "림",
+  "립",
+  "릾",
+  "릿",
+  "맀",
+  "링",
+  "맂",
+  "맃",
+  "맄",
+  "맅",
+  "맆",
+  "맇",
+  "마",
+  "막",
+  "맊",
+  "맋",
+  "만",
+  "맍",
+  "많",
+  "맏",
+  "말",
+  "맑",
+  "맒",
+  "맓",
+  "맔",
+  "맕",
+  "맖",
+  "맗",
+  "맘",
+  "맙",
+  "맚",
+  "맛",
+  "맜",
+  "망",
+  "맞",
+  "맟",
+  "맠",
+  "맡",
+  "맢",
+  "맣",
+  "매",
+  "맥",
+  "맦",
+  "맧",
+  "맨",
+  "맩",
+  "맪",
+  "맫",
+  "맬",
+  "맭",
+  "맮",
+  "맯",
+  "맰",
+  "맱",
+  "맲",
+  "맳",
+  "맴",
+  "맵",
+  "맶",
+  "맷",
+  "맸",
+  "맹",
+  "맺",
+  "맻",
+  "맼",
+  "맽",
+  "맾",
+  "맿",
+  "먀",
+  "먁",
+  "먂",
+  "먃",
+  "먄",
+  "먅",
+  "먆",
+  "먇",
+  "먈",
+  "먉",
+  "먊",
+  "먋",
+  "먌",
+  "먍",
+  "먎",
+  "먏",
+  "먐",
+  "먑",
+  "먒",
+  "먓",
+  "먔",
+  "먕",
+  "먖",
+  "먗",
+  "먘",
+  "먙",
+  "먚",
+  "먛",
+  "먜",
+  "먝",
+  "먞",
+  "먟",
+  "먠",
+  "먡",
+  "먢",
+  "먣",
+  "먤",
+  "먥",
+  "먦",
+  "먧",
+  "먨",
+  "먩",
+  "먪",
+  "먫",
+  "먬",
+  "먭",
+  "먮",
+  "먯",
+  "먰",
+  "먱",
+  "먲",
+  "먳",
+  "먴",
+  "먵",
+  "먶",
+  "먷",
+  "머",
+  "먹",
+  "먺",
+  "먻",
+  "먼",
+  "먽",
+  "먾",
+  "먿",
+  "멀",
+  "멁",
+  "멂",
+  "멃",
+  "멄",
+  "멅",
+  "멆",
+  "멇",
+  "멈",
+  "멉",
+  "멊",
+  "멋",
+  "멌",
+  "멍",
+  "멎",
+  "멏",
+  "멐",
+  "멑",
+  "멒",
+  "멓",
+  "메",
+  "멕",
+  "멖",
+  "멗",
+  "멘",
+  "멙",
+  "멚",
+  "멛",
+  "멜",
+  "멝",
+  "멞",
+  "멟",
+  "멠",
+  "멡",
+  "멢",
+  "멣",
+  "멤",
+  "멥",
+  "멦",
+  "멧",
+  "멨",
+  "멩",
+  "멪",
+  "멫",
+  "멬",
+  "멭",
+  "멮",
+  "멯",
+  "며",
+  "멱",
+  "멲",
+  "멳",
+  "면",
+  "멵",
+  "멶",
+  "멷",
+  "멸",
+  "멹",
+  "멺",
+  "멻",
+  "멼",
+  "멽",
+  "멾",
+  "멿",
+  "몀",
+  "몁",
+  "몂",
+  "몃",
+  "몄",
+  "명",
+  "몆",
+  "몇",
+  "몈",
+  "몉",
+  "몊",
+  "몋",
+  "몌",
+  "몍",
+  "몎",
+  "몏",
+  "몐",
+  "몑",
+  "몒",
+  "몓",
+  "몔",
+  "몕",
+  "몖",
+  "몗",
+  "몘",
+  "몙",
+  "몚",
+  "몛",
+  "몜",
+  "몝",
+  "몞",
+  "몟",
+  "몠",
+  "몡",
+  "몢",
+  "몣",
+  "몤",
+  "몥",
+  "몦",
+  "몧",
+  "모",
+  "목",
+  "몪",
+  "몫",
+  "몬",
+  "몭",
+  "몮",
+  "몯",
+  "몰",
+  "몱",
+  "몲",
+  "몳",
+  "몴",
+  "몵",
+  "몶",
+  "몷",
+  "몸",
+  "몹",
+  "몺",
+  "못",
+  "몼",
+  "몽",
+  "몾",
+  "몿",
+  "뫀",
+  "뫁",
+  "뫂",
+  "뫃",
+  "뫄",
+  "뫅",
+  "뫆",
+  "뫇",
+  "뫈",
+  "뫉",
+  "뫊",
+  "뫋",
+  "뫌",
+  "뫍",
+  "뫎",
+  "뫏",
+  "뫐",
+  "뫑",
+  "뫒",
+  "뫓",
+  "뫔",
+  "뫕",
+  "뫖",
+  "뫗",
+  "뫘",
+  "뫙",
+  "뫚",
+  "뫛",
+  "뫜",
+  "뫝",
+  "뫞",
+  "뫟",
+  "뫠",
+  "뫡",
+  "뫢",
+  "뫣",
+  "뫤",
+  "뫥",
+  "뫦",
+  "뫧",
+  "뫨",
+  "뫩",
+  "뫪",
+  "뫫",
+  "뫬",
+  "뫭",
+  "뫮",
+  "뫯",
+  "뫰",
+  "뫱",
+  "뫲",
+  "뫳",
+  "뫴",
+  "뫵",
+  "뫶",
+  "뫷",
+  "뫸",
+  "뫹",
+  "뫺",
+  "뫻",
+  "뫼",
+  "뫽",
+  "뫾",
+  "뫿",
+  "묀",
+  "묁",
+  "묂",
+  "묃",
+  "묄",
+  "묅",
+  "묆",
+  "묇",
+  "묈",
+  "묉",
+  "묊",
+  "묋",
+  "묌",
+  "묍",
+  "묎",
+  "묏",
+  "묐",
+  "묑",
+  "묒",
+  "묓",
+  "묔",
+  "묕",
+  "묖",
+  "묗",
+  "묘",
+  "묙",
+  "묚",
+  "묛",
+  "묜",
+  "묝",
+  "묞",
+  "묟",
+  "묠",
+  "묡",
+  "묢",
+  "묣",
+  "묤",
+  "묥",
+  "묦",
+  "묧",
+  "묨",
+  "묩",
+  "묪",
+  "묫",
+  "묬",
+  "묭",
+  "묮",
+  "묯",
+  "묰",
+  "묱",
+  "묲",
+  "묳",
+  "무",
+  "묵",
+  "묶",
+  "묷",
+  "문",
+  "묹",
+  "묺",
+  "묻",
+  "물",
+  "묽",
+  "묾",
+  "묿",
+  "뭀",
+  "뭁",
+  "뭂",
+  "뭃",
+  "뭄",
+  "뭅",
+  "뭆",
+  "뭇",
+  "뭈",
+  "뭉",
+  "뭊",
+  "뭋",
+  "뭌",
+  "뭍",
+  "뭎",
+  "뭏",
+  "뭐",
+  "뭑",
+  "뭒",
+  "뭓",
+  "뭔",
+  "뭕",
+  "뭖",
+  "뭗",
+  "뭘",
+  "뭙",
+  "뭚",
+  "뭛",
+  "뭜",
+  "뭝",
+  "뭞",
+  "뭟",
+  "뭠",
+  "뭡",
+  "뭢",
+  "뭣",
+  "뭤",
+  "뭥",
+  "뭦",
+  "뭧",
+  "뭨",
+  "뭩",
+  "뭪",
+  "뭫",
+  "뭬",
+  "뭭",
+  "뭮",
+  "뭯",
+  "뭰",
+  "뭱",
+  "뭲",
+  "뭳",
+  "뭴",
+  "뭵",
+  "뭶",
+  "뭷",
+  "뭸",
+  "뭹",
+  "뭺",
+  "뭻",
+  "뭼",
+  "뭽",
+  "뭾",
+  "뭿",
+  "뮀",
+  "뮁",
+  "뮂",
+  "뮃",
+  "뮄",
+  "뮅",
+  "뮆",
+  "뮇",
+  "뮈",
+  "뮉",
+  "뮊",
+  "뮋",
+  "뮌",
+  "뮍",
+  "뮎",
+  "뮏",
+  "뮐",
+  "뮑",
+  "뮒",
+  "뮓",
+  "뮔",
+  "뮕",
+  "뮖",
+  "뮗",
+  "뮘",
+  "뮙",
+  "뮚",
+  "뮛",
+  "뮜",
+  "뮝",
+  "뮞",
+  "뮟",
+  "뮠",
+  "뮡",
+  "뮢",
+  "뮣",
+  "뮤",
+  "뮥",
+  "뮦",
+  "뮧",
+  "뮨",
+  "뮩",
+  "뮪",
+  "뮫",
+  "뮬",
+  "뮭",
+  "뮮",
+  "뮯",
+  "뮰",
+  "뮱",
+  "뮲",
+  "뮳",
+  "뮴",
+  "뮵",
+  "뮶",
+  "뮷",
+  "뮸",
+  "뮹",
+  "뮺",
+  "뮻",
+  "뮼",
+  "뮽",
+  "뮾",
+  "뮿",
+  "므",
+  "믁",
+  "믂",
+  "믃",
+  "믄",
+  "믅",
+  "믆",
+  "믇",
+  "믈",
+  "믉",
+  "믊",
+  "믋",
+  "믌",
+  "믍",
+  "믎",
+  "믏",
+  "믐",
+  "믑",
+  "믒",
+  "믓",
+  "믔",
+  "믕",
+  "믖",
+  "믗",
+  "믘",
+  "믙",
+  "믚",
+  "믛",
+  "믜",
+  "믝",
+  "믞",
+  "믟",
+  "믠",
+  "믡",
+  "믢",
+  "믣",
+  "믤",
+  "믥",
+  "믦",
+  "믧",
+  "믨",
+  "믩",
+  "믪",
+  "믫",
+  "믬",
+  "믭",
+  "믮",
+  "믯",
+  "믰",
+  "믱",
+  "믲",
+  "믳",
+  "믴",
+  "믵",
+  "믶",
+  "믷",
+  "미",
+  "믹",
+  "믺",
+  "믻",
+  "민",
+  "믽",
+  "믾",
+  "믿",
+  "밀",
+  "밁",
+  "밂",
+  "밃",
+  "밄",
+  "밅",
+  "밆",
+  "밇",
+  "밈",
+  "밉",
+  "밊",
+  "밋",
+  "밌",
+  "밍",
+  "밎",
+  "및",
+  "밐",
+  "밑",
+  "밒",
+  "밓",
+  "바",
+  "박",
+  "밖",
+  "밗",
+  "반",
+  "밙",
+  "밚",
+  "받",
+  "발",
+  "밝",
+  "밞",
+  "밟",
+  "밠",
+  "밡",
+  "밢",
+  "밣",
+  "밤",
+  "밥",
+  "밦",
+  "밧",
+  "밨",
+  "방",
+  "밪",
+  "밫",
+  "밬",
+  "밭",
+  "밮",
+  "밯",
+  "배",
+  "백",
+  "밲",
+  "밳",
+  "밴",
+  "밵",
+  "밶",
+  "밷",
+  "밸",
+  "밹",
+  "밺",
+  "밻",
+  "밼",
+  "밽",
+  "밾",
+  "밿",
+  "뱀",
+  "뱁",
+  "뱂",
+  "뱃",
+  "뱄",
+  "뱅",
+  "뱆",
+  "뱇",
+  "뱈",
+  "뱉",
+  "뱊",
+  "뱋",
+  "뱌",
+  "뱍",
+  "뱎",
+  "뱏",
+  "뱐",
+  "뱑",
+  "뱒",
+  "뱓",
+  "뱔",
+  "뱕",
+  "뱖",
+  "뱗",
+  "뱘",
+  "뱙",
+  "뱚",
+  "뱛",
+  "뱜",
+  "뱝",
+  "뱞",
+  "뱟",
+  "뱠",
+  "뱡",
+  "뱢",
+  "뱣",
+  "뱤",
+  "뱥",
+  "뱦",
+  "뱧",
+  "뱨",
+  "뱩",
+  "뱪",
+  "뱫",
+  "뱬",
+  "뱭",
+  "뱮",
+  "뱯",
+  "뱰",
+  "뱱",
+  "뱲",
+  "뱳",
+  "뱴",
+  "뱵",
+  "뱶",
+  "뱷",
+  "뱸",
+  "뱹",
+  "뱺",
+  "뱻",
+  "뱼",
+  "뱽",
+  "뱾",
+  "뱿",
+  "벀",
+  "벁",
+  "벂",
+  "벃",
+  "버",
+  "벅",
+  "벆",
+  "벇",
+  "번",
+  "벉",
+  "벊",
+  "벋",
+  "벌",
+  "벍",
+  "벎",
+  "벏",
+  "벐",
+  "벑",
+  "벒",
+  "벓",
+  "범",
+  "법",
+  "벖",
+  "벗",
+  "벘",
+  "벙",
+  "벚",
+  "벛",
+  "벜",
+  "벝",
+  "벞",
+  "벟",
+  "베",
+  "벡",
+  "벢",
+  "벣",
+  "벤",
+  "벥",
+  "벦",
+  "벧",
+  "벨",
+  "벩",
+  "벪",
+  "벫",
+  "벬",
+  "벭",
+  "벮",
+  "벯",
+  "벰",
+  "벱",
+  "벲",
+  "벳",
+  "벴",
+  "벵",
+  "벶",
+  "벷",
+  "벸",
+  "벹",
+  "벺",
+  "벻",
+  "벼",
+  "벽",
+  "벾",
+  "벿",
+  "변",
+  "볁",
+  "볂",
+  "볃",
+  "별",
+  "볅",
+  "볆",
+  "볇",
+  "볈",
+  "볉",
+  "볊",
+  "볋",
+  "볌",
+  "볍",
+  "볎",
+  "볏",
+  "볐",
+  "병",
+  "볒",
+  "볓",
+  "볔",
+  "볕",
+  "볖",
+  "볗",
+  "볘",
+  "볙",
+  "볚",
+  "볛",
+  "볜",
+  "볝",
+  "볞",
+  "볟",
+  "볠",
+  "볡",
+  "볢",
+  "볣",
+  "볤",
+  "볥",
+  "볦",
+  "볧",
+  "볨",
+  "볩",
+  "볪",
+  "볫",
+  "볬",
+  "볭",
+  "볮",
+  "볯",
+  "볰",
+  "볱",
+  "볲",
+  "볳",
+  "보",
+  "복",
+  "볶",
+  "볷",
+  "본",
+  "볹",
+  "볺",
+  "볻",
+  "볼",
+  "볽",
+  "볾",
+  "볿",
+  "봀",
+  "봁",
+  "봂",
+  "봃",
+  "봄",
+  "봅",
+  "봆",
+  "봇",
+  "봈",
+  "봉",
+  "봊",
+  "봋",
+  "봌",
+  "봍",
+  "봎",
+  "봏",
+  "봐",
+  "봑",
+  "봒",
+  "봓",
+  "봔",
+  "봕",
+  "봖",
+  "봗",
+  "봘",
+  "봙",
+  "봚",
+  "봛",
+  "봜",
+  "봝",
+  "봞",
+  "봟",
+  "봠",
+  "봡",
+  "봢",
+  "봣",
+  "봤",
+  "봥",
+  "봦",
+  "봧",
+  "봨",
+  "봩",
+  "봪",
+  "봫",
+  "봬",
+  "봭",
+  "봮",
+  "봯",
+  "봰",
+  "봱",
+  "봲",
+  "봳",
+  "봴",
+  "봵",
+  "봶",
+  "봷",
+  "봸",
+  "봹",
+  "봺",
+  "봻",
+  "봼",
+  "봽",
+  "봾",
+  "봿",
+  "뵀",
+  "뵁",
+  "뵂",
+  "뵃",
+  "뵄",
+  "뵅",
+  "뵆",
+  "뵇",
+  "뵈",
+  "뵉",
+  "뵊",
+  "뵋",
+  "뵌",
+  "뵍",
+  "뵎",
+  "뵏",
+  "뵐",
+  "뵑",
+  "뵒",
+  "뵓",
+  "뵔",
+  "뵕",
+  "뵖",
+  "뵗",
+  "뵘",
+  "뵙",
+  "뵚",
+  "뵛",
+  "뵜",
+  "뵝",
+  "뵞",
+  "뵟",
+  "뵠",
+  "뵡",
+  "뵢",
+  "뵣",
+  "뵤",
+  "뵥",
+  "뵦",
+  "뵧",
+  "뵨",
+  "뵩",
+  "뵪",
+  "뵫",
+  "뵬",
+  "뵭",
+  "뵮",
+  "뵯",
+  "뵰",
+  "뵱",
+  "뵲",
+  "뵳",
+  "뵴",
+  "뵵",
+  "뵶",
+  "뵷",
+  "뵸",
+  "뵹",
+  "뵺",
+  "뵻",
+  "뵼",
+  "뵽",
+  "뵾",
+  "뵿",
+  "부",
+  "북",
+  "붂",
+  "붃",
+  "분",
+  "붅",
+  "붆",
+  "붇",
+  "불",
+  "붉",
+  "붊",
+  "붋",
+  "붌",
+  "붍",
+  "붎",
+  "붏",
+  "붐",
+  "붑",
+  "붒",
+  "붓",
+  "붔",
+  "붕",
+  "붖",
+  "붗",
+  "붘",
+  "붙",
+  "붚",
+  "붛",
+  "붜",
+  "붝",
+  "붞",
+  "붟",
+  "붠",
+  "붡",
+  "붢",
+  "붣",
+  "붤",
+  "붥",
+  "붦",
+  "붧",
+  "붨",
+  "붩",
+  "붪",
+  "붫",
+  "붬",
+  "붭",
+  "붮",
+  "붯",
+  "붰",
+  "붱",
+  "붲",
+  "붳",
+  "붴",
+  "붵",
+  "붶",
+  "붷",
+  "붸",
+  "붹",
+  "붺",
+  "붻",
+  "붼",
+  "붽",
+  "붾",
+  "붿",
+  "뷀",
+  "뷁",
+  "뷂",
+  "뷃",
+  "뷄",
+  "뷅",
+  "뷆",
+  "뷇",
+  "뷈",
+  "뷉",
+  "뷊",
+  "뷋",
+  "뷌",
+  "뷍",
+  "뷎",
+  "뷏",
+  "뷐",
+  "뷑",
+  "뷒",
+  "뷓",
+  "뷔",
+  "뷕",
+  "뷖",
+  "뷗",
+  "뷘",
+  "뷙",
+  "뷚",
+  "뷛",
+  "뷜",
+  "뷝",
+  "뷞",
+  "뷟",
+  "뷠",
+  "뷡",
+  "뷢",
+  "뷣",
+  "뷤",
+  "뷥",
+  "뷦",
+  "뷧",
+  "뷨",
+  "뷩",
+  "뷪",
+  "뷫",
+  "뷬",
+  "뷭",
+  "뷮",
+  "뷯",
+  "뷰",
+  "뷱",
+  "뷲",
+  "뷳",
+  "뷴",
+  "뷵",
+  "뷶",
+  "뷷",
+  "뷸",
+  "뷹",
+  "뷺",
+  "뷻",
+  "뷼",
+  "뷽",
+  "뷾",
+  "뷿",
+  "븀",
+  "븁",
+  "븂",
+  "븃",
+  "븄",
+  "븅",
+  "븆",
+  "븇",
+  "븈",
+  "븉",
+  "븊",
+  "븋",
+  "브",
+  "븍",
+  "븎",
+  "븏",
+  "븐",
+  "븑",
+  "븒",
+  "븓",
+  "블",
+  "븕",
+  "븖",
+  "븗",
+  "븘",
+  "븙",
+  "븚",
+  "븛",
+  "븜",
+  "븝",
+  "븞",
+  "븟",
+  "븠",
+  "븡",
+  "븢",
+  "븣",
+  "븤",
+  "븥",
+  "븦",
+  "븧",
+  "븨",
+  "븩",
+  "븪",
+  "븫",
+  "븬",
+  "븭",
+  "븮",
+  "븯",
+  "븰",
+  "븱",
+  "븲",
+  "븳",
+  "븴",
+  "븵",
+  "븶",
+  "븷",
+  "븸",
+  "븹",
+  "븺",
+  "븻",
+  "븼",
+  "븽",
+  "븾",
+  "븿",
+  "빀",
+  "빁",
+  "빂",
+  "빃",
+  "비",
+  "빅",
+  "빆",
+  "빇",
+  "빈",
+  "빉",
+  "빊",
+  "빋",
+  "빌",
+  "빍",
+  "빎",
+  "빏",
+  "빐",
+  "빑",
+  "빒",
+  "빓",
+  "빔",
+  "빕",
+  "빖",
+  "빗",
+  "빘",
+  "빙",
+  "빚",
+  "빛",
+  "빜",
+  "빝",
+  "빞",
+  "빟",
+  "빠",
+  "빡",
+  "빢",
+  "빣",
+  "빤",
+  "빥",
+  "빦",
+  "빧",
+  "빨",
+  "빩",
+  "빪",
+  "빫",
+  "빬",
+  "빭",
+  "빮",
+  "빯",
+  "빰",
+  "빱",
+  "빲",
+  "빳",
+  "빴",
+  "빵",
+  "빶",
+  "빷",
+  "빸",
+  "빹",
+  "빺",
+  "빻",
+  "빼",
+  "빽",
+  "빾",
+  "빿",
+  "뺀",
+  "뺁",
+  "뺂",
+  "뺃",
+  "뺄",
+  "뺅",
+  "뺆",
+  "뺇",
+  "뺈",
+  "뺉",
+  "뺊",
+  "뺋",
+  "뺌",
+  "뺍",
+  "뺎",
+  "뺏",
+  "뺐",
+  "뺑",
+  "뺒",
+  "뺓",
+  "뺔",
+  "뺕",
+  "뺖",
+  "뺗",
+  "뺘",
+  "뺙",
+  "뺚",
+  "뺛",
+  "뺜",
+  "뺝",
+  "뺞",
+  "뺟",
+  "뺠",
+  "뺡",
+  "뺢",
+  "뺣",
+  "뺤",
+  "뺥",
+  "뺦",
+  "뺧",
+  "뺨",
+  "뺩",
+  "뺪",
+  "뺫",
+  "뺬",
+  "뺭",
+  "뺮",
+  "뺯",
+  "뺰",
+  "뺱",
+  "뺲",
+  "뺳",
+  "뺴",
+  "뺵",
+  "뺶",
+  "뺷",
+  "뺸",
+  "뺹",
+  "뺺",
+  "뺻",
+  "뺼",
+  "뺽",
+  "뺾",
+  "뺿",
+  "뻀",
+  "뻁",
+  "뻂",
+  "뻃",
+  "뻄",
+  "뻅",
+  "뻆",
+  "뻇",
+  "뻈",
+  "뻉",
+  "뻊",
+  "뻋",
+  "뻌",
+  "뻍",
+  "뻎",
+  "뻏",
+  "뻐",
+  "뻑",
+  "뻒",
+  "뻓",
+  "뻔",
+  "뻕",
+  "뻖",
+  "뻗",
+  "뻘",
+  "뻙",
+  "뻚",
+  "뻛",
+  "뻜",
+  "뻝",
+  "뻞",
+  "뻟",
+  "뻠",
+  "뻡",
+  "뻢",
+  "뻣",
+  "뻤",
+  "뻥",
+  "뻦",
+  "뻧",
+  "뻨",
+  "뻩",
+  "뻪",
+  "뻫",
+  "뻬",
+  "뻭",
+  "뻮",
+  "뻯",
+  "뻰",
+  "뻱",
+  "뻲",
+  "뻳",
+  "뻴",
+  "뻵",
+  "뻶",
+  "뻷",
+  "뻸",
+  "뻹",
+  "뻺",
+  "뻻",
+  "뻼",
+  "뻽",
+  "뻾",
+  "뻿",
+  "뼀",
+  "뼁",
+  "뼂",
+  "뼃",
+  "뼄",
+  "뼅",
+  "뼆",
+  "뼇",
+  "뼈",
+  "뼉",
+  "뼊",
+  "뼋",
+  "뼌",
+  "뼍",
+  "뼎",
+  "뼏",
+  "뼐",
+  "뼑",
+  "뼒",
+  "뼓",
+  "뼔",
+  "뼕",
+  "뼖",
+  "뼗",
+  "뼘",
+  "뼙",
+  "뼚",
+  "뼛",
+  "뼜",
+  "뼝",
+  "뼞",
+  "뼟",
+  "뼠",
+  "뼡",
+  "뼢",
+  "뼣",
+  "뼤",
+  "뼥",
+  "뼦",
+  "뼧",
+  "뼨",
+  "뼩",
+  "뼪",
+  "뼫",
+  "뼬",
+  "뼭",
+  "뼮",
+  "뼯",
+  "뼰",
+  "뼱",
+  "뼲",
+  "뼳",
+  "뼴",
+  "뼵",
+  "뼶",
+  "뼷",
+  "뼸",
+  "뼹",
+  "뼺",
+  "뼻",
+  "뼼",
+  "뼽",
+  "뼾",
+  "뼿",
+  "뽀",
+  "뽁",
+  "뽂",
+  "뽃",
+  "뽄",
+  "뽅",
+  "뽆",
+  "뽇",
+  "뽈",
+  "뽉",
+  "뽊",
+  "뽋",
+  "뽌",
+  "뽍",
+  "뽎",
+  "뽏",
+  "뽐",
+  "뽑",
+  "뽒",
+  "뽓",
+  "뽔",
+  "뽕",
+  "뽖",
+  "뽗",
+  "뽘",
+  "뽙",
+  "뽚",
+  "뽛",
+  "뽜",
+  "뽝",
+  "뽞",
+  "뽟",
+  "뽠",
+  "뽡",
+  "뽢",
+  "뽣",
+  "뽤",
+  "뽥",
+  "뽦",
+  "뽧",
+  "뽨",
+  "뽩",
+  "뽪",
+  "뽫",
+  "뽬",
+  "뽭",
+  "뽮",
+  "뽯",
+  "뽰",
+  "뽱",
+  "뽲",
+  "뽳",
+  "뽴",
+  "뽵",
+  "뽶",
+  "뽷",
+  "뽸",
+  "뽹",
+  "뽺",
+  "뽻",
+  "뽼",
+  "뽽",
+  "뽾",
+  "뽿",
+  "뾀",
+  "뾁",
+  "뾂",
+  "뾃",
+  "뾄",
+  "뾅",
+  "뾆",
+  "뾇",
+  "뾈",
+  "뾉",
+  "뾊",
+  "뾋",
+  "뾌",
+  "뾍",
+  "뾎",
+  "뾏",
+  "뾐",
+  "뾑",
+  "뾒",
+  "뾓",
+  "뾔",
+  "뾕",
+  "뾖",
+  "뾗",
+  "뾘",
+  "뾙",
+  "뾚",
+  "뾛",
+  "뾜",
+  "뾝",
+  "뾞",
+  "뾟",
+  "뾠",
+  "뾡",
+  "뾢",
+  "뾣",
+  "뾤",
+  "뾥",
+  "뾦",
+  "뾧",
+  "뾨",
+  "뾩",
+  "뾪",
+  "뾫",
+  "뾬",
+  "뾭",
+  "뾮",
+  "뾯",
+  "뾰",
+  "뾱",
+  "뾲",
+  "뾳",
+  "뾴",
+  "뾵",
+  "뾶",
+  "뾷",
+  "뾸",
+  "뾹",
+  "뾺",
+  "뾻",
+  "뾼",
+  "뾽",
+  "뾾",
+  "뾿",
+  "뿀",
+  "뿁",
+  "뿂",
+  "뿃",
+  "뿄",
+  "뿅",
+  "뿆",
+  "뿇",
+  "뿈",
+  "뿉",
+  "뿊",
+  "뿋",
+  "뿌",
+  "뿍",
+  "뿎",
+  "뿏",
+  "뿐",
+  "뿑",
+  "뿒",
+  "뿓",
+  "뿔",
+  "뿕",
+  "뿖",
+  "뿗",
+  "뿘",
+  "뿙",
+  "뿚",
+  "뿛",
+  "뿜",
+  "뿝",
+  "뿞",
+  "뿟",
+  "뿠",
+  "뿡",
+  "뿢",
+  "뿣",
+  "뿤",
+  "뿥",
+  "뿦",
+  "뿧",
+  "뿨",
+  "뿩",
+  "뿪",
+  "뿫",
+  "뿬",
+  "뿭",
+  "뿮",
+  "뿯",
+  "뿰",
+  "뿱",
+  "뿲",
+  "뿳",
+  "뿴",
+  "뿵",
+  "뿶",
+  "뿷",
+  "뿸",
+  "뿹",
+  "뿺",
+  "뿻",
+  "뿼",
+  "뿽",
+  "뿾",
+  "뿿",
+  "쀀",
+  "쀁",
+  "쀂",
+  "쀃",
+  "쀄",
+  "쀅",
+  "쀆",
+  "쀇",
+  "쀈",
+  "쀉",
+  "쀊",
+  "쀋",
+  "쀌",
+  "쀍",
+  "쀎",
+  "쀏",
+  "쀐",
+  "쀑",
+  "쀒",
+  "쀓",
+  "쀔",
+  "쀕",
+  "쀖",
+  "쀗",
+  "쀘",
+  "쀙",
+  "쀚",
+  "쀛",
+  "쀜",
+  "쀝",
+  "쀞",
+  "쀟",
+  "쀠",
+  "쀡",
+  "쀢",
+  "쀣",
+  "쀤",
+  "쀥",
+  "쀦",
+  "쀧",
+  "쀨",
+  "쀩",
+  "쀪",
+  "쀫",
+  "쀬",
+  "쀭",
+  "쀮",
+  "쀯",
+  "쀰",
+  "쀱",
+  "쀲",
+  "쀳",
+  "쀴",
+  "쀵",
+  "쀶",
+  "쀷",
+  "쀸",
+  "쀹",
+  "쀺",
+  "쀻",
+  "쀼",
+  "쀽",
+  "쀾",
+  "쀿",
+  "쁀",
+  "쁁",
+  "쁂",
+  "쁃",
+  "쁄",
+  "쁅",
+  "쁆",
+  "쁇",
+  "쁈",
+  "쁉",
+  "쁊",
+  "쁋",
+  "쁌",
+  "쁍",
+  "쁎",
+  "쁏",
+  "쁐",
+  "쁑",
+  "쁒",
+  "쁓",
+  "쁔",
+  "쁕",
+  "쁖",
+  "쁗",
+  "쁘",
+  "쁙",
+  "쁚",
+  "쁛",
+  "쁜",
+  "쁝",
+  "쁞",
+  "쁟",
+  "쁠",
+  "쁡",
+  "쁢",
+  "쁣",
+  "쁤",
+  "쁥",
+  "쁦",
+  "쁧",
+  "쁨",
+  "쁩",
+  "쁪",
+  "쁫",
+  "쁬",
+  "쁭",
+  "쁮",
+  "쁯",
+  "쁰",
+  "쁱",
+  "쁲",
+  "쁳",
+  "쁴",
+  "쁵",
+  "쁶",
+  "쁷",
+  "쁸",
+  "쁹",
+  "쁺",
+  "쁻",
+  "쁼",
+  "쁽",
+  "쁾",
+  "쁿",
+  "삀",
+  "삁",
+  "삂",
+  "삃",
+  "삄",
+  "삅",
+  "삆",
+  "삇",
+  "삈",
+  "삉",
+  "삊",
+  "삋",
+  "삌",
+  "삍",
+  "삎",
+  "삏",
+  "삐",
+  "삑",
+  "삒",
+  "삓",
+  "삔",
+  "삕",
+  "삖",
+  "삗",
+  "삘",
+  "삙",
+  "삚",
+  "삛",
+  "삜",
+  "삝",
+  "삞",
+  "삟",
+  "삠",
+  "삡",
+  "삢",
+  "삣",
+  "삤",
+  "삥",
+  "삦",
+  "삧",
+  "삨",
+  "삩",
+  "삪",
+  "삫",
+  "사",
+  "삭",
+  "삮",
+  "삯",
+  "산",
+  "삱",
+  "삲",
+  "삳",
+  "살",
+  "삵",
+  "삶",
+  "삷",
+  "삸",
+  "삹",
+  "삺",
+  "삻",
+  "삼",
+  "삽",
+  "삾",
+  "삿",
+  "샀",
+  "상",
+  "샂",
+  "샃",
+  "샄",
+  "샅",
+  "샆",
+  "샇",
+  "새",
+  "색",
+  "샊",
+  "샋",
+  "샌",
+  "샍",
+  "샎",
+  "샏",
+  "샐",
+  "샑",
+  "샒",
+  "샓",
+  "샔",
+  "샕",
+  "샖",
+  "샗",
+  "샘",
+  "샙",
+  "샚",
+  "샛",
+  "샜",
+  "생",
+  "샞",
+  "샟",
+  "샠",
+  "샡",
+  "샢",
+  "샣",
+  "샤",
+  "샥",
+  "샦",
+  "샧",
+  "샨",
+  "샩",
+  "샪",
+  "샫",
+  "샬",
+  "샭",
+  "샮",
+  "샯",
+  "샰",
+  "샱",
+  "샲",
+  "샳",
+  "샴",
+  "샵",
+  "샶",
+  "샷",
+  "샸",
+  "샹",
+  "샺",
+  "샻",
+  "샼",
+  "샽",
+  "샾",
+  "샿",
+  "섀",
+  "섁",
+  "섂",
+  "섃",
+  "섄",
+  "섅",
+  "섆",
+  "섇",
+  "섈",
+  "섉",
+  "섊",
+  "섋",
+  "섌",
+  "섍",
+  "섎",
+  "섏",
+  "섐",
+  "섑",
+  "섒",
+  "섓",
+  "섔",
+  "섕",
+  "섖",
+  "섗",
+  "섘",
+  "섙",
+  "섚",
+  "섛",
+  "서",
+  "석",
+  "섞",
+  "섟",
+  "선",
+  "섡",
+  "섢",
+  "섣",
+  "설",
+  "섥",
+  "섦",
+  "섧",
+  "섨",
+  "섩",
+  "섪",
+  "섫",
+  "섬",
+  "섭",
+  "섮",
+  "섯",
+  "섰",
+  "성",
+  "섲",
+  "섳",
+  "섴",
+  "섵",
+  "섶",
+  "섷",
+  "세",
+  "섹",
+  "섺",
+  "섻",
+  "센",
+  "섽",
+  "섾",
+  "섿",
+  "셀",
+  "셁",
+  "셂",
+  "셃",
+  "셄",
+  "셅",
+  "셆",
+  "셇",
+  "셈",
+  "셉",
+  "셊",
+  "셋",
+  "셌",
+  "셍",
+  "셎",
+  "셏",
+  "셐",
+  "셑",
+  "셒",
+  "셓",
+  "셔",
+  "셕",
+  "셖",
+  "셗",
+  "션",
+  "셙",
+  "셚",
+  "셛",
+  "셜",
+  "셝",
+  "셞",
+  "셟",
+  "셠",
+  "셡",
+  "셢",
+  "셣",
+  "셤",
+  "셥",
+  "셦",
+  "셧",
+  "셨",
+  "셩",
+  "셪",
+  "셫",
+  "셬",
+  "셭",
+  "셮",
+  "셯",
+  "셰",
+  "셱",
+  "셲",
+  "셳",
+  "셴",
+  "셵",
+  "셶",
+  "셷",
+  "셸",
+  "셹",
+  "셺",
+  "셻",
+  "셼",
+  "셽",
+  "셾",
+  "셿",
+  "솀",
+  "솁",
+  "솂",
+  "솃",
+  "솄",
+  "솅",
+  "솆",
+  "솇",
+  "솈",
+  "솉",
+  "솊",
+  "솋",
+  "소",
+  "속",
+  "솎",
+  "솏",
+  "손",
+  "솑",
+  "솒",
+  "솓",
+  "솔",
+  "솕",
+  "솖",
+  "솗",
+  "솘",
+  "솙",
+  "솚",
+  "솛",
+  "솜",
+  "솝",
+  "솞",
+  "솟",
+  "솠",
+  "송",
+  "솢",
+  "솣",
+  "솤",
+  "솥",
+  "솦",
+  "솧",
+  "솨",
+  "솩",
+  "솪",
+  "솫",
+  "솬",
+  "솭",
+  "솮",
+  "솯",
+  "솰",
+  "솱",
+  "솲",
+  "솳",
+  "솴",
+  "솵",
+  "솶",
+  "솷",
+  "솸",
+  "솹",
+  "솺",
+  "솻",
+  "솼",
+  "솽",
+  "솾",
+  "솿",
+  "쇀",
+  "쇁",
+  "쇂",
+  "쇃",
+  "쇄",
+  "쇅",
+  "쇆",
+  "쇇",
+  "쇈",
+  "쇉",
+  "쇊",
+  "쇋",
+  "쇌",
+  "쇍",
+  "쇎",
+  "쇏",
+  "쇐",
+  "쇑",
+  "쇒",
+  "쇓",
+  "쇔",
+  "쇕",
+  "쇖",
+  "쇗",
+  "쇘",
+  "쇙",
+  "쇚",
+  "쇛",
+  "쇜",
+  "쇝",
+  "쇞",
+  "쇟",
+  "쇠",
+  "쇡",
+  "쇢",
+  "쇣",
+  "쇤",
+  "쇥",
+  "쇦",
+  "쇧",
+  "쇨",
+  "쇩",
+  "쇪",
+  "쇫",
+  "쇬",
+  "쇭",
+  "쇮",
+  "쇯",
+  "쇰",
+  "쇱",
+  "쇲",
+  "쇳",
+  "쇴",
+  "쇵",
+  "쇶",
+  "쇷",
+  "쇸",
+  "쇹",
+  "쇺",
+  "쇻",
+  "쇼",
+  "쇽",
+  "쇾",
+  "쇿",
+  "숀",
+  "숁",
+  "숂",
+  "숃",
+  "숄",
+  "숅",
+  "숆",
+  "숇",
+  "숈",
+  "숉",
+  "숊",
+  "숋",
+  "숌",
+  "숍",
+  "숎",
+  "숏",
+  "숐",
+  "숑",
+  "숒",
+  "숓",
+  "숔",
+  "숕",
+  "숖",
+  "숗",
+  "수",
+  "숙",
+  "숚",
+  "숛",
+  "순",
+  "숝",
+  "숞",
+  "숟",
+  "술",
+  "숡",
+  "숢",
+  "숣",
+  "숤",
+  "숥",
+  "숦",
+  "숧",
+  "숨",
+  "숩",
+  "숪",
+  "숫",
+  "숬",
+  "숭",
+  "숮",
+  "숯",
+  "숰",
+  "숱",
+  "숲",
+  "숳",
+  "숴",
+  "숵",
+  "숶",
+  "숷",
+  "숸",
+  "숹",
+  "숺",
+  "숻",
+  "숼",
+  "숽",
+  "숾",
+  "숿",
+  "쉀",
+  "쉁",
+  "쉂",
+  "쉃",
+  "쉄",
+  "쉅",
+  "쉆",
+  "쉇",
+  "쉈",
+  "쉉",
+  "쉊",
+  "쉋",
+  "쉌",
+  "쉍",
+  "쉎",
+  "쉏",
+  "쉐",
+  "쉑",
+  "쉒",
+  "쉓",
+  "쉔",
+  "쉕",
+  "쉖",
+  "쉗",
+  "쉘",
+  "쉙",
+  "쉚",
+  "쉛",
+  "쉜",
+  "쉝",
+  "쉞",
+  "쉟",
+  "쉠",
+  "쉡",
+  "쉢",
+  "쉣",
+  "쉤",
+  "쉥",
+  "쉦",
+  "쉧",
+  "쉨",
+  "쉩",
+  "쉪",
+  "쉫",
+  "쉬",
+  "쉭",
+  "쉮",
+  "쉯",
+  "쉰",
+  "쉱",
+  "쉲",
+  "쉳",
+  "쉴",
+  "쉵",
+  "쉶",
+  "쉷",
+  "쉸",
+  "쉹",
+  "쉺",
+  "쉻",
+  "쉼",
+  "쉽",
+  "쉾",
+  "쉿",
+  "슀",
+  "슁",
+  "슂",
+  "슃",
+  "슄",
+  "슅",
+  "슆",
+  "슇",
+  "슈",
+  "슉",
+  "슊",
+  "슋",
+  "슌",
+  "슍",
+  "슎",
+  "슏",
+  "슐",
+  "슑",
+  "슒",
+  "슓",
+  "슔",
+  "슕",
+  "슖",
+  "슗",
+  "슘",
+  "슙",
+  "슚",
+  "슛",
+  "슜",
+  "슝",
+  "슞",
+  "슟",
+  "슠",
+  "슡",
+  "슢",
+  "슣",
+  "스",
+  "슥",
+  "슦",
+  "슧",
+  "슨",
+  "슩",
+  "슪",
+  "슫",
+  "슬",
+  "슭",
+  "슮",
+  "슯",
+  "슰",
+  "슱",
+  "슲",
+  "슳",
+  "슴",
+  "습",
+  "슶",
+  "슷",
+  "슸",
+  "승",
+  "슺",
+  "슻",
+  "슼",
+  "슽",
+  "슾",
+  "슿",
+  "싀",
+  "싁",
+  "싂",
+  "싃",
+  "싄",
+  "싅",
+  "싆",
+  "싇",
+  "싈",
+  "싉",
+  "싊",
+  "싋",
+  "싌",
+  "싍",
+  "싎",
+  "싏",
+  "싐",
+  "싑",
+  "싒",
+  "싓",
+  "싔",
+  "싕",
+  "싖",
+  "싗",
+  "싘",
+  "싙",
+  "싚",
+  "싛",
+  "시",
+  "식",
+  "싞",
+  "싟",
+  "신",
+  "싡",
+  "싢",
+  "싣",
+  "실",
+  "싥",
+  "싦",
+  "싧",
+  "싨",
+  "싩",
+  "싪",
+  "싫",
+  "심",
+  "십",
+  "싮",
+  "싯",
+  "싰",
+  "싱",
+  "싲",
+  "싳",
+  "싴",
+  "싵",
+  "싶",
+  "싷",
+  "싸",
+  "싹",
+  "싺",
+  "싻",
+  "싼",
+  "싽",
+  "싾",
+  "싿",
+  "쌀",
+  "쌁",
+  "쌂",
+  "쌃",
+  "쌄",
+  "쌅",
+  "쌆",
+  "쌇",
+  "쌈",
+  "쌉",
+  "쌊",
+  "쌋",
+  "쌌",
+  "쌍",
+  "쌎",
+  "쌏",
+  "쌐",
+  "쌑",
+  "쌒",
+  "쌓",
+  "쌔",
+  "쌕",
+  "쌖",
+  "쌗",
+  "쌘",
+  "쌙",
+  "쌚",
+  "쌛",
+  "쌜",
+  "쌝",
+  "쌞",
+  "쌟",
+  "쌠",
+  "쌡",
+  "쌢",
+  "쌣",
+  "쌤",
+  "쌥",
+  "쌦",
+  "쌧",
+  "쌨",
+  "쌩",
+  "쌪",
+  "쌫",
+  "쌬",
+  "쌭",
+  "쌮",
+  "쌯",
+  "쌰",
+  "쌱",
+  "쌲",
+  "쌳",
+  "쌴",
+  "쌵",
+  "쌶",
+  "쌷",
+  "쌸",
+  "쌹",
+  "쌺",
+  "쌻",
+  "쌼",
+  "쌽",
+  "쌾",
+  "쌿",
+  "썀",
+  "썁",
+  "썂",
+  "썃",
+  "썄",
+  "썅",
+  "썆",
+  "썇",
+  "썈",
+  "썉",
+  "썊",
+  "썋",
+  "썌",
+  "썍",
+  "썎",
+  "썏",
+  "썐",
+  "썑",
+  "썒",
+  "썓",
+  "썔",
+  "썕",
+  "썖",
+  "썗",
+  "썘",
+  "썙",
+  "썚",
+  "썛",
+  "썜",
+  "썝",
+  "썞",
+  "썟",
+  "썠",
+  "썡",
+  "썢",
+  "썣",
+  "썤",
+  "썥",
+  "썦",
+  "썧",
+  "써",
+  "썩",
+  "썪",
+  "썫",
+  "썬",
+  "썭",
+  "썮",
+  "썯",
+  "썰",
+  "썱",
+  "썲",
+  "썳",
+  "썴",
+  "썵",
+  "썶",
+  "썷",
+  "썸",
+  "썹",
+  "썺",
+  "썻",
+  "썼",
+  "썽",
+  "썾",
+  "썿",
+  "쎀",
+  "쎁",
+  "쎂",
+  "쎃",
+  "쎄",
+  "쎅",
+  "쎆",
+  "쎇",
+  "쎈",
+  "쎉",
+  "쎊",
+  "쎋",
+  "쎌",
+  "쎍",
+  "쎎",
+  "쎏",
+  "쎐",
+  "쎑",
+  "쎒",
+  "쎓",
+  "쎔",
+  "쎕",
+  "쎖",
+  "쎗",
+  "쎘",
+  "쎙",
+  "쎚",
+  "쎛",
+  "쎜",
+  "쎝",
+  "쎞",
+  "쎟",
+  "쎠",
+  "쎡",
+  "쎢",
+  "쎣",
+  "쎤",
+  "쎥",
+  "쎦",
+  "쎧",
+  "쎨",
+  "쎩",
+  "쎪",
+  "쎫",
+  "쎬",
+  "쎭",
+  "쎮",
+  "쎯",
+  "쎰",
+  "쎱",
+  "쎲",
+  "쎳",
+  "쎴",
+  "쎵",
+  "쎶",
+  "쎷",
+  "쎸",
+  "쎹",
+  "쎺",
+  "쎻",
+  "쎼",
+  "쎽",
+  "쎾",
+  "쎿",
+  "쏀",
+  "쏁",
+  "쏂",
+  "쏃",
+  "쏄",
+  "쏅",
+  "쏆",
+  "쏇",
+  "쏈",
+  "쏉",
+  "쏊",
+  "쏋",
+  "쏌",
+  "쏍",
+  "쏎",
+  "쏏",
+  "쏐",
+  "쏑",
+  "쏒",
+  "쏓",
+  "쏔",
+  "쏕",
+  "쏖",
+  "쏗",
+  "쏘",
+  "쏙",
+  "쏚",
+  "쏛",
+  "쏜",
+  "쏝",
+  "쏞",
+  "쏟",
+  "쏠",
+  "쏡",
+  "쏢",
+  "쏣",
+  "쏤",
+  "쏥",
+  "쏦",
+  "쏧",
+  "쏨",
+  "쏩",
+  "쏪",
+  "쏫",
+  "쏬",
+  "쏭",
+  "쏮",
+  "쏯",
+  "쏰",
+  "쏱",
+  "쏲",
+  "쏳",
+  "쏴",
+  "쏵",
+  "쏶",
+  "쏷",
+  "쏸",
+  "쏹",
+  "쏺",
+  "쏻",
+  "쏼",
+  "쏽",
+  "쏾",
+  "쏿",
+  "쐀",
+  "쐁",
+  "쐂",
+  "쐃",
+  "쐄",
+  "쐅",
+  "쐆",
+  "쐇",
+  "쐈",
+  "쐉",
+  "쐊",
+  "쐋",
+  "쐌",
+  "쐍",
+  "쐎",
+  "쐏",
+  "쐐",
+  "쐑",
+  "쐒",
+  "쐓",
+  "쐔",
+  "쐕",
+  "쐖",
+  "쐗",
+  "쐘",
+  "쐙",
+  "쐚",
+  "쐛",
+  "쐜",
+  "쐝",
+  "쐞",
+  "쐟",
+  "쐠",
+  "쐡",
+  "쐢",
+  "쐣",
+  "쐤",
+  "쐥",
+  "쐦",
+  "쐧",
+  "쐨",
+  "쐩",
+  "쐪",
+  "쐫",
+  "쐬",
+  "쐭",
+  "쐮",
+  "쐯",
+  "쐰",
+  "쐱",
+  "쐲",
+  "쐳",
+  "쐴",
+  "쐵",
+  "쐶",
+  "쐷",
+  "쐸",
+  "쐹",
+  "쐺",
+  "쐻",
+  "쐼",
+  "쐽",
+  "쐾",
+  "쐿",
+  "쑀",
+  "쑁",
+  "쑂",
+  "쑃",
+  "쑄",
+  "쑅",
+  "쑆",
+  "쑇",
+  "쑈",
+  "쑉",
+  "쑊",
+  "쑋",
+  "쑌",
+  "쑍",
+  "쑎",
+  "쑏",
+  "쑐",
+  "쑑",
+  "쑒",
+  "쑓",
+  "쑔",
+  "쑕",
+  "쑖",
+  "쑗",
+  "쑘",
+  "쑙",
+  "쑚",
+  "쑛",
+  "쑜",
+  "쑝",
+  "쑞",
+  "쑟",
+  "쑠",
+  "쑡",
+  "쑢",
+  "쑣",
+  "쑤",
+  "쑥",
+  "쑦",
+  "쑧",
+  "쑨",
+  "쑩",
+  "쑪",
+  "쑫",
+  "쑬",
+  "쑭",
+  "쑮",
+  "쑯",
+  "쑰",
+  "쑱",
+  "쑲",
+  "쑳",
+  "쑴",
+  "쑵",
+  "쑶",
+  "쑷",
+  "쑸",
+  "쑹",
+  "쑺",
+  "쑻",
+  "쑼",
+  "쑽",
+  "쑾",
+  "쑿",
+  "쒀",
+  "쒁",
+  "쒂",
+  "쒃",
+  "쒄",
+  "쒅",
+  "쒆",
+  "쒇",
+  "쒈",
+  "쒉",
+  "쒊",
+  "쒋",
+  "쒌",
+  "쒍",
+  "쒎",
+  "쒏",
+  "쒐",
+  "쒑",
+  "쒒",
+  "쒓",
+  "쒔",
+  "쒕",
+  "쒖",
+  "쒗",
+  "쒘",
+  "쒙",
+  "쒚",
+  "쒛",
+  "쒜",
+  "쒝",
+  "쒞",
+  "쒟",
+  "쒠",
+  "쒡",
+  "쒢",
+  "쒣",
+  "쒤",
+  "쒥",
+  "쒦",
+  "쒧",
+  "쒨",
+  "쒩",
+  "쒪",
+  "쒫",
+  "쒬",
+  "쒭",
+  "쒮",
+  "쒯",
+  "쒰",
+  "쒱",
+  "쒲",
+  "쒳",
+  "쒴",
+  "쒵",
+  "쒶",
+  "쒷",
+  "쒸",
+  "쒹",
+  "쒺",
+  "쒻",
+  "쒼",
+  "쒽",
+  "쒾",
+  "쒿",
+  "쓀",
+  "쓁",
+  "쓂",
+  "쓃",
+  "쓄",
+  "쓅",
+  "쓆",
+  "쓇",
+  "쓈",
+  "쓉",
+  "쓊",
+  "쓋",
+  "쓌",
+  "쓍",
+  "쓎",
+  "쓏",
+  "쓐",
+  "쓑",
+  "쓒",
+  "쓓",
+  "쓔",
+  "쓕",
+  "쓖",
+  "쓗",
+  "쓘",
+  "쓙",
+  "쓚",
+  "쓛",
+  "쓜",
+  "쓝",
+  "쓞",
+  "쓟",
+  "쓠",
+  "쓡",
+  "쓢",
+  "쓣",
+  "쓤",
+  "쓥",
+  "쓦",
+  "쓧",
+  "쓨",
+  "쓩",
+  "쓪",
+  "쓫",
+  "쓬",
+  "쓭",
+  "쓮",
+  "쓯",
+  "쓰",
+  "쓱",
+  "쓲",
+  "쓳",
+  "쓴",
+  "쓵",
+  "쓶",
+  "쓷",
+  "쓸",
+  "쓹",
+  "쓺",
+  "쓻",
+  "쓼",
+  "쓽",
+  "쓾",
+  "쓿",
+  "씀",
+  "씁",
+  "씂",
+  "씃",
+  "씄",
+  "씅",
+  "씆",
+  "씇",
+  "씈",
+  "씉",
+  "씊",
+  "씋",
+  "씌",
+  "씍",
+  "씎",
+  "씏",
+  "씐",
+  "씑",
+  "씒",
+  "씓",
+  "씔",
+  "씕",
+  "씖",
+  "씗",
+  "씘",
+  "씙",
+  "씚",
+  "씛",
+  "씜",
+  "씝",
+  "씞",
+  "씟",
+  "씠",
+  "씡",
+  "씢",
+  "씣",
+  "씤",
+  "씥",
+  "씦",
+  "씧",
+  "씨",
+  "씩",
+  "씪",
+  "씫",
+  "씬",
+  "씭",
+  "씮",
+  "씯",
+  "씰",
+  "씱",
+  "씲",
+  "씳",
+  "씴",
+  "씵",
+  "씶",
+  "씷",
+  "씸",
+  "씹",
+  "씺",
+  "씻",
+  "씼",
+  "씽",
+  "씾",
+  "씿",
+  "앀",
+  "앁",
+  "앂",
+  "앃",
+  "아",
+  "악",
+  "앆",
+  "앇",
+  "안",
+  "앉",
+  "않",
+  "앋",
+  "알",
+  "앍",
+  "앎",
+  "앏",
+  "앐",
+  "앑",
+  "앒",
+  "앓",
+  "암",
+  "압",
+  "앖",
+  "앗",
+  "았",
+  "앙",
+  "앚",
+  "앛",
+  "앜",
+  "앝",
+  "앞",
+  "앟",
+  "애",
+  "액",
+  "앢",
+  "앣",
+  "앤",
+  "앥",
+  "앦",
+  "앧",
+  "앨",
+  "앩",
+  "앪",
+  "앫",
+  "앬",
+  "앭",
+  "앮",
+  "앯",
+  "앰",
+  "앱",
+  "앲",
+  "앳",
+  "앴",
+  "앵",
+  "앶",
+  "앷",
+  "앸",
+  "앹",
+  "앺",
+  "앻",
+  "야",
+  "약",
+  "앾",
+  "앿",
+  "얀",
+  "얁",
+  "얂",
+  "얃",
+  "얄",
+  "얅",
+  "얆",
+  "얇",
+  "얈",
+  "얉",
+  "얊",
+  "얋",
+  "얌",
+  "얍",
+  "얎",
+  "얏",
+  "얐",
+  "양",
+  "얒",
+  "얓",
+  "얔",
+  "얕",
+  "얖",
+  "얗",
+  "얘",
+  "얙",
+  "얚",
+  "얛",
+  "얜",
+  "얝",
+  "얞",
+  "얟",
+  "얠",
+  "얡",
+  "얢",
+  "얣",
+  "얤",
+  "얥",
+  "얦",
+  "얧",
+  "얨",
+  "얩",
+  "얪",
+  "얫",
+  "얬",
+  "얭",
+  "얮",
+  "얯",
+  "얰",
+  "얱",
+  "얲",
+  "얳",
+  "어",
+  "억",
+  "얶",
+  "얷",
+  "언",
+  "얹",
+  "얺",
+  "얻",
+  "얼",
+  "얽",
+  "얾",
+  "얿",
+  "엀",
+  "엁",
+  "엂",
+  "엃",
+  "엄",
+  "업",
+  "없",
+  "엇",
+  "었",
+  "엉",
+  "엊",
+  "엋",
+  "엌",
+  "엍",
+  "엎",
+  "엏",
+  "에",
+  "엑",
+  "엒",
+  "엓",
+  "엔",
+  "엕",
+  "엖",
+  "엗",
+  "엘",
+  "엙",
+  "엚",
+  "엛",
+  "엜",
+  "엝",
+  "엞",
+  "엟",
+  "엠",
+  "엡",
+  "엢",
+  "엣",
+  "엤",
+  "엥",
+  "엦",
+  "엧",
+  "엨",
+  "엩",
+  "엪",
+  "엫",
+  "여",
+  "역",
+  "엮",
+  "엯",
+  "연",
+  "엱",
+  "엲",
+  "엳",
+  "열",
+  "엵",
+  "엶",
+  "엷",
+  "엸",
+  "엹",
+  "엺",
+  "엻",
+  "염",
+  "엽",
+  "엾",
+  "엿",
+  "였",
+  "영",
+  "옂",
+  "옃",
+  "옄",
+  "옅",
+  "옆",
+  "옇",
+  "예",
+  "옉",
+  "옊",
+  "옋",
+  "옌",
+  "옍",
+  "옎",
+  "옏",
+  "옐",
+  "옑",
+  "옒",
+  "옓",
+  "옔",
+  "옕",
+  "옖",
+  "옗",
+  "옘",
+  "옙",
+  "옚",
+  "옛",
+  "옜",
+  "옝",
+  "옞",
+  "옟",
+  "옠",
+  "옡",
+  "옢",
+  "옣",
+  "오",
+  "옥",
+  "옦",
+  "옧",
+  "온",
+  "옩",
+  "옪",
+  "옫",
+  "올",
+  "옭",
+  "옮",
+  "옯",
+  "옰",
+  "옱",
+  "옲",
+  "옳",
+  "옴",
+  "옵",
+  "옶",
+  "옷",
+  "옸",
+  "옹",
+  "옺",
+  "옻",
+  "옼",
+  "옽",
+  "옾",
+  "옿",
+  "와",
+  "왁",
+  "왂",
+  "왃",
+  "완",
+  "왅",
+  "왆",
+  "왇",
+  "왈",
+  "왉",
+  "왊",
+  "왋",
+  "왌",
+  "왍",
+  "왎",
+  "왏",
+  "왐",
+  "왑",
+  "왒",
+  "왓",
+  "왔",
+  "왕",
+  "왖",
+  "왗",
+  "왘",
+  "왙",
+  "왚",
+  "왛",
+  "왜",
+  "왝",
+  "왞",
+  "왟",
+  "왠",
+  "왡",
+  "왢",
+  "왣",
+  "왤",
+  "왥",
+  "왦",
+  "왧",
+  "왨",
+  "왩",
+  "왪",
+  "왫",
+  "왬",
+  "왭",
+  "왮",
+  "왯",
+  "왰",
+  "왱",
+  "왲",
+  "왳",
+  "왴",
+  "왵",
+  "왶",
+  "왷",
+  "외",
+  "왹",
+  "왺",
+  "왻",
+  "왼",
+  "왽",
+  "왾",
+  "왿",
+  "욀",
+  "욁",
+  "욂",
+  "욃",
+  "욄",
+  "욅",
+  "욆",
+  "욇",
+  "욈",
+  "욉",
+  "욊",
+  "욋",
+  "욌",
+  "욍",
+  "욎",
+  "욏",
+  "욐",
+  "욑",
+  "욒",
+  "욓",
+  "요",
+  "욕",
+  "욖",
+  "욗",
+  "욘",
+  "욙",
+  "욚",
+  "욛",
+  "욜",
+  "욝",
+  "욞",
+  "욟",
+  "욠",
+  "욡",
+  "욢",
+  "욣",
+  "욤",
+  "욥",
+  "욦",
+  "욧",
+  "욨",
+  "용",
+  "욪",
+  "욫",
+  "욬",
+  "욭",
+  "욮",
+  "욯",
+  "우",
+  "욱",
+  "욲",
+  "욳",
+  "운",
+  "욵",
+  "욶",
+  "욷",
+  "울",
+  "욹",
+  "욺",
+  "욻",
+  "욼",
+  "욽",
+  "욾",
+  "욿",
+  "움",
+  "웁",
+  "웂",
+  "웃",
+  "웄",
+  "웅",
+  "웆",
+  "웇",
+  "웈",
+  "웉",
+  "웊",
+  "웋",
+  "워",
+  "웍",
+  "웎",
+  "웏",
+  "원",
+  "웑",
+  "웒",
+  "웓",
+  "월",
+  "웕",
+  "웖",
+  "웗",
+  "웘",
+  "웙",
+  "웚",
+  "웛",
+  "웜",
+  "웝",
+  "웞",
+  "웟",
+  "웠",
+  "웡",
+  "웢",
+  "웣",
+  "웤",
+  "웥",
+  "웦",
+  "웧",
+  "웨",
+  "웩",
+  "웪",
+  "웫",
+  "웬",
+  "웭",
+  "웮",
+  "웯",
+  "웰",
+  "웱",
+  "웲",
+  "웳",
+  "웴",
+  "웵",
+  "웶",
+  "웷",
+  "웸",
+  "웹",
+  "웺",
+  "웻",
+  "웼",
+  "웽",
+  "웾",
+  "웿",
+  "윀",
+  "윁",
+  "윂",
+  "윃",
+  "위",
+  "윅",
+  "윆",
+  "윇",
+  "윈",
+  "윉",
+  "윊",
+  "윋",
+  "윌",
+  "윍",
+  "윎",
+  "윏",
+  "윐",
+  "윑",
+  "윒",
+  "윓",
+  "윔",
+  "윕",
+  "윖",
+  "윗",
+  "윘",
+  "윙",
+  "윚",
+  "윛",
+  "윜",
+  "윝",
+  "윞",
+  "윟",
+  "유",
+  "육",
+  "윢",
+  "윣",
+  "윤",
+  "윥",
+  "윦",
+  "윧",
+  "율",
+  "윩",
+  "윪",
+  "윫",
+  "윬",
+  "윭",
+  "윮",
+  "윯",
+  "윰",
+  "윱",
+  "윲",
+  "윳",
+  "윴",
+  "융",
+  "윶",
+  "윷",
+  "윸",
+  "윹",
+  "윺",
+  "윻",
+  "으",
+  "윽",
+  "윾",
+  "윿",
+  "은",
+  "읁",
+  "읂",
+  "읃",
+  "을",
+  "읅",
+  "읆",
+  "읇",
+  "읈",
+  "읉",
+  "읊",
+  "읋",
+  "음",
+  "읍",
+  "읎",
+  "읏",
+  "읐",
+  "응",
+  "읒",
+  "읓",
+  "읔",
+  "읕",
+  "읖",
+  "읗",
+  "의",
+  "읙",
+  "읚",
+  "읛",
+  "읜",
+  "읝",
+  "읞",
+  "읟",
+  "읠",
+  "읡",
+  "읢",
+  "읣",
+  "읤",
+  "읥",
+  "읦",
+  "읧",
+  "읨",
+  "읩",
+  "읪",
+  "읫",
+  "읬",
+  "읭",
+  "읮",
+  "읯",
+  "읰",
+  "읱",
+  "읲",
+  "읳",
+  "이",
+  "익",
+  "읶",
+  "읷",
+  "인",
+  "읹",
+  "읺",
+  "읻",
+  "일",
+  "읽",
+  "읾",
+  "읿",
+  "잀",
+  "잁",
+  "잂",
+  "잃",
+  "임",
+  "입",
+  "잆",
+  "잇",
+  "있",
+  "잉",
+  "잊",
+  "잋",
+  "잌",
+  "잍",
+  "잎",
+  "잏",
+  "자",
+  "작",
+  "잒",
+  "잓",
+  "잔",
+  "잕",
+  "잖",
+  "잗",
+  "잘",
+  "잙",
+  "잚",
+  "잛",
+  "잜",
+  "잝",
+  "잞",
+  "잟",
+  "잠",
+  "잡",
+  "잢",
+  "잣",
+  "잤",
+  "장",
+  "잦",
+  "잧",
+  "잨",
+  "잩",
+  "잪",
+  "잫",
+  "재",
+  "잭",
+  "잮",
+  "잯",
+  "잰",
+  "잱",
+  "잲",
+  "잳",
+  "잴",
+  "잵",
+  "잶",
+  "잷",
+  "잸",
+  "잹",
+  "잺",
+  "잻",
+  "잼",
+  "잽",
+  "잾",
+  "잿",
+  "쟀",
+  "쟁",
+  "쟂",
+  "쟃",
+  "쟄",
+  "쟅",
+  "쟆",
+  "쟇",
+  "쟈",
+  "쟉",
+  "쟊",
+  "쟋",
+  "쟌",
+  "쟍",
+  "쟎",
+  "쟏",
+  "쟐",
+  "쟑",
+  "쟒",
+  "쟓",
+  "쟔",
+  "쟕",
+  "쟖",
+  "쟗",
+  "쟘",
+  "쟙",
+  "쟚",
+  "쟛",
+  "쟜",
+  "쟝",
+  "쟞",
+  "쟟",
+  "쟠",
+  "쟡",
+  "쟢",
+  "쟣",
+  "쟤",
+  "쟥",
+  "쟦",
+  "쟧",
+  "쟨",
+  "쟩",
+  "쟪",
+  "쟫",
+  "쟬",
+  "쟭",
+  "쟮",
+  "쟯",
+  "쟰",
+  "쟱",
+  "쟲",
+  "쟳",
+  "쟴",
+  "쟵",
+  "쟶",
+  "쟷",
+  "쟸",
+  "쟹",
+  "쟺",
+  "쟻",
+  "쟼",
+  "쟽",
+  "쟾",
+  "쟿",
+  "저",
+  "적",
+  "젂",
+  "젃",
+  "전",
+  "젅",
+  "젆",
+  "젇",
+  "절",
+  "젉",
+  "젊",
+  "젋",
+  "젌",
+  "젍",
+  "젎",
+  "젏",
+  "점",
+  "접",
+  "젒",
+  "젓",
+  "젔",
+  "정",
+  "젖",
+  "젗",
+  "젘",
+  "젙",
+  "젚",
+  "젛",
+  "제",
+  "젝",
+  "젞",
+  "젟",
+  "젠",
+  "젡",
+  "젢",
+  "젣",
+  "젤",
+  "젥",
+  "젦",
+  "젧",
+  "젨",
+  "젩",
+  "젪",
+  "젫",
+  "젬",
+  "젭",
+  "젮",
+  "젯",
+  "젰",
+  "젱",
+  "젲",
+  "젳",
+  "젴",
+  "젵",
+  "젶",
+  "젷",
+  "져",
+  "젹",
+  "젺",
+  "젻",
+  "젼",
+  "젽",
+  "젾",
+  "젿",
+  "졀",
+  "졁",
+  "졂",
+  "졃",
+  "졄",
+  "졅",
+  "졆",
+  "졇",
+  "졈",
+  "졉",
+  "졊",
+  "졋",
+  "졌",
+  "졍",
+  "졎",
+  "졏",
+  "졐",
+  "졑",
+  "졒",
+  "졓",
+  "졔",
+  "졕",
+  "졖",
+  "졗",
+  "졘",
+  "졙",
+  "졚",
+  "졛",
+  "졜",
+  "졝",
+  "졞",
+  "졟",
+  "졠",
+  "졡",
+  "졢",
+  "졣",
+  "졤",
+  "졥",
+  "졦",
+  "졧",
+  "졨",
+  "졩",
+  "졪",
+  "졫",
+  "졬",
+  "졭",
+  "졮",
+  "졯",
+  "조",
+  "족",
+  "졲",
+  "졳",
+  "존",
+  "졵",
+  "졶",
+  "졷",
+  "졸",
+  "졹",
+  "졺",
+  "졻",
+  "졼",
+  "졽",
+  "졾",
+  "졿",
+  "좀",
+  "좁",
+  "좂",
+  "좃",
+  "좄",
+  "종",
+  "좆",
+  "좇",
+  "좈",
+  "좉",
+  "좊",
+  "좋",
+  "좌",
+  "좍",
+  "좎",
+  "좏",
+  "좐",
+  "좑",
+  "좒",
+  "좓",
+  "좔",
+  "좕",
+  "좖",
+  "좗",
+  "좘",
+  "좙",
+  "좚",
+  "좛",
+  "좜",
+  "좝",
+  "좞",
+  "좟",
+  "좠",
+  "좡",
+  "좢",
+  "좣",
+  "좤",
+  "좥",
+  "좦",
+  "좧",
+  "좨",
+  "좩",
+  "좪",
+  "좫",
+  "좬",
+  "좭",
+  "좮",
+  "좯",
+  "좰",
+  "좱",
+  "좲",
+  "좳",
+  "좴",
+  "좵",
+  "좶",
+  "좷",
+  "좸",
+  "좹",
+  "좺",
+  "좻",
+  "좼",
+  "좽",
+  "좾",
+  "좿",
+  "죀",
+  "죁",
+  "죂",
+  "죃",
+  "죄",
+  "죅",
+  "죆",
+  "죇",
+  "죈",
+  "죉",
+  "죊",
+  "죋",
+  "죌",
+  "죍",
+  "죎",
+  "죏",
+  "죐",
+  "죑",
+  "죒",
+  "죓",
+  "죔",
+  "죕",
+  "죖",
+  "죗",
+  "죘",
+  "죙",
+  "죚",
+  "죛",
+  "죜",
+  "죝",
+  "죞",
+  "죟",
+  "죠",
+  "죡",
+  "죢",
+  "죣",
+  "죤",
+  "죥",
+  "죦",
+  "죧",
+  "죨",
+  "죩",
+  "죪",
+  "죫",
+  "죬",
+  "죭",
+  "죮",
+  "죯",
+  "죰",
+  "죱",
+  "죲",
+  "죳",
+  "죴",
+  "죵",
+  "죶",
+  "죷",
+  "죸",
+  "죹",
+  "죺",
+  "죻",
+  "주",
+  "죽",
+  "죾",
+  "죿",
+  "준",
+  "줁",
+  "줂",
+  "줃",
+  "줄",
+  "줅",
+  "줆",
+  "줇",
+  "줈",
+  "줉",
+  "줊",
+  "줋",
+  "줌",
+  "줍",
+  "줎",
+  "줏",
+  "줐",
+  "중",
+  "줒",
+  "줓",
+  "줔",
+  "줕",
+  "줖",
+  "줗",
+  "줘",
+  "줙",
+  "줚",
+  "줛",
+  "줜",
+  "줝",
+  "줞",
+  "줟",
+  "줠",
+  "줡",
+  "줢",
+  "줣",
+  "줤",
+  "줥",
+  "줦",
+  "줧",
+  "줨",
+  "줩",
+  "줪",
+  "줫",
+  "줬",
+  "줭",
+  "줮",
+  "줯",
+  "줰",
+  "줱",
+  "줲",
+  "줳",
+  "줴",
+  "줵",
+  "줶",
+  "줷",
+  "줸",
+  "줹",
+  "줺",
+  "줻",
+  "줼",
+  "줽",
+  "줾",
+  "줿",
+  "쥀",
+  "쥁",
+  "쥂",
+  "쥃",
+  "쥄",
+  "쥅",
+  "쥆",
+  "쥇",
+  "쥈",
+  "쥉",
+  "쥊",
+  "쥋",
+  "쥌",
+  "쥍",
+  "쥎",
+  "쥏",
+  "쥐",
+  "쥑",
+  "쥒",
+  "쥓",
+  "쥔",
+  "쥕",
+  "쥖",
+  "쥗",
+  "쥘",
+  "쥙",
+  "쥚",
+  "쥛",
+  "쥜",
+  "쥝",
+  "쥞",
+  "쥟",
+  "쥠",
+  "쥡",
+  "쥢",
+  "쥣",
+  "쥤",
+  "쥥",
+  "쥦",
+  "쥧",
+  "쥨",
+  "쥩",
+  "쥪",
+  "쥫",
+  "쥬",
+  "쥭",
+  "쥮",
+  "쥯",
+  "쥰",
+  "쥱",
+  "쥲",
+  "쥳",
+  "쥴",
+  "쥵",
+  "쥶",
+  "쥷",
+  "쥸",
+  "쥹",
+  "쥺",
+  "쥻",
+  "쥼",
+  "쥽",
+  "쥾",
+  "쥿",
+  "즀",
+  "즁",
+  "즂",
+  "즃",
+  "즄",
+  "즅",
+  "즆",
+  "즇",
+  "즈",
+  "즉",
+  "즊",
+  "즋",
+  "즌",
+  "즍",
+  "즎",
+  "즏",
+  "즐",
+  "즑",
+  "즒",
+  "즓",
+  "즔",
+  "즕",
+  "즖",
+  "즗",
+  "즘",
+  "즙",
+  "즚",
+  "즛",
+  "즜",
+  "증",
+  "즞",
+  "즟",
+  "즠",
+  "즡",
+  "즢",
+  "즣",
+  "즤",
+  "즥",
+  "즦",
+  "즧",
+  "즨",
+  "즩",
+  "즪",
+  "즫",
+  "즬",
+  "즭",
+  "즮",
+  "즯",
+  "즰",
+  "즱",
+  "즲",
+  "즳",
+  "즴",
+  "즵",
+  "즶",
+  "즷",
+  "즸",
+  "즹",
+  "즺",
+  "즻",
+  "즼",
+  "즽",
+  "즾",
+  "즿",
+  "지",
+  "직",
+  "짂",
+  "짃",
+  "진",
+  "짅",
+  "짆",
+  "짇",
+  "질",
+  "짉",
+  "짊",
+  "짋",
+  "짌",
+  "짍",
+  "짎",
+  "짏",
+  "짐",
+  "집",
+  "짒",
+  "짓",
+  "짔",
+  "징",
+  "짖",
+  "짗",
+  "짘",
+  "짙",
+  "짚",
+  "짛",
+  "짜",
+  "짝",
+  "짞",
+  "짟",
+  "짠",
+  "짡",
+  "짢",
+  "짣",
+  "짤",
+  "짥",
+  "짦",
+  "짧",
+  "짨",
+  "짩",
+  "짪",
+  "짫",
+  "짬",
+  "짭",
+  "짮",
+  "짯",
+  "짰",
+  "짱",
+  "짲",
+  "짳",
+  "짴",
+  "짵",
+  "짶",
+  "짷",
+  "째",
+  "짹",
+  "짺",
+  "짻",
+  "짼",
+  "짽",
+  "짾",
+  "짿",
+  "쨀",
+  "쨁",
+  "쨂",
+  "쨃",
+  "쨄",
+  "쨅",
+  "쨆",
+  "쨇",
+  "쨈",
+  "쨉",
+  "쨊",
+  "쨋",
+  "쨌",
+  "쨍",
+  "쨎",
+  "쨏",
+  "쨐",
+  "쨑",
+  "쨒",
+  "쨓",
+  "쨔",
+  "쨕",
+  "쨖",
+  "쨗",
+  "쨘",
+  "쨙",
+  "쨚",
+  "쨛",
+  "쨜",
+  "쨝",
+  "쨞",
+  "쨟",
+  "쨠",
+  "쨡",
+  "쨢",
+  "쨣",
+  "쨤",
+  "쨥",
+  "쨦",
+  "쨧",
+  "쨨",
+  "쨩",
+  "쨪",
+  "쨫",
+  "쨬",
+  "쨭",
+  "쨮",
+  "쨯",
+  "쨰",
+  "쨱",
+  "쨲",
+  "쨳",
+  "쨴",
+  "쨵",
+  "쨶",
+  "쨷",
+  "쨸",
+  "쨹",
+  "쨺",
+  "쨻",
+  "쨼",
+  "쨽",
+  "쨾",
+  "쨿",
+  "쩀",
+  "쩁",
+  "쩂",
+  "쩃",
+  "쩄",
+  "쩅",
+  "쩆",
+  "쩇",
+  "쩈",
+  "쩉",
+  "쩊",
+  "쩋",
+  "쩌",
+  "쩍",
+  "쩎",
+  "쩏",
+  "쩐",
+  "쩑",
+  "쩒",
+  "쩓",
+  "쩔",
+  "쩕",
+  "쩖",
+  "쩗",
+  "쩘",
+  "쩙",
+  "쩚",
+  "쩛",
+  "쩜",
+  "쩝",
+  "쩞",
+  "쩟",
+  "쩠",
+  "쩡",
+  "쩢",
+  "쩣",
+  "쩤",
+  "쩥",
+  "쩦",
+  "쩧",
+  "쩨",
+  "쩩",
+  "쩪",
+  "쩫",
+  "쩬",
+  "쩭",
+  "쩮",
+  "쩯",
+  "쩰",
+  "쩱",
+  "쩲",
+  "쩳",
+  "쩴",
+  "쩵",
+  "쩶",
+  "쩷",
+  "쩸",
+  "쩹",
+  "쩺",
+  "쩻",
+  "쩼",
+  "쩽",
+  "쩾",
+  "쩿",
+  "쪀",
+  "쪁",
+  "쪂",
+  "쪃",
+  "쪄",
+  "쪅",
+  "쪆",
+  "쪇",
+  "쪈",
+  "쪉",
+  "쪊",
+  "쪋",
+  "쪌",
+  "쪍",
+  "쪎",
+  "쪏",
+  "쪐",
+  "쪑",
+  "쪒",
+  "쪓",
+  "쪔",
+  "쪕",
+  "쪖",
+  "쪗",
+  "쪘",
+  "쪙",
+  "쪚",
+  "쪛",
+  "쪜",
+  "쪝",
+  "쪞",
+  "쪟",
+  "쪠",
+  "쪡",
+  "쪢",
+  "쪣",
+  "쪤",
+  "쪥",
+  "쪦",
+  "쪧",
+  "쪨",
+  "쪩",
+  "쪪",
+  "쪫",
+  "쪬",
+  "쪭",
+  "쪮",
+  "쪯",
+  "쪰",
+  "쪱",
+  "쪲",
+  "쪳",
+  "쪴",
+  "쪵",
+  "쪶",
+  "쪷",
+  "쪸",
+  "쪹",
+  "쪺",
+  "쪻",
+  "쪼",
+  "쪽",
+  "쪾",
+  "쪿",
+  "쫀",
+  "쫁",
+  "쫂",
+  "쫃",
+  "쫄",
+  "쫅",
+  "쫆",
+  "쫇",
+  "쫈",
+  "쫉",
+  "쫊",
+  "쫋",
+  "쫌",
+  "쫍",
+  "쫎",
+  "쫏",
+  "쫐",
+  "쫑",
+  "쫒",
+  "쫓",
+  "쫔",
+  "쫕",
+  "쫖",
+  "쫗",
+  "쫘",
+  "쫙",
+  "쫚",
+  "쫛",
+  "쫜",
+  "쫝",
+  "쫞",
+  "쫟",
+  "쫠",
+  "쫡",
+  "쫢",
+  "쫣",
+  "쫤",
+  "쫥",
+  "쫦",
+  "쫧",
+  "쫨",
+  "쫩",
+  "쫪",
+  "쫫",
+  "쫬",
+  "쫭",
+  "쫮",
+  "쫯",
+  "쫰",
+  "쫱",
+  "쫲",
+  "쫳",
+  "쫴",
+  "쫵",
+  "쫶",
+  "쫷",
+  "쫸",
+  "쫹",
+  "쫺",
+  "쫻",
+  "쫼",
+  "쫽",
+  "쫾",
+  "쫿",
+  "쬀",
+  "쬁",
+  "쬂",
+  "쬃",
+  "쬄",
+  "쬅",
+  "쬆",
+  "쬇",
+  "쬈",
+  "쬉",
+  "쬊",
+  "쬋",
+  "쬌",
+  "쬍",
+  "쬎",
+  "쬏",
+  "쬐",
+  "쬑",
+  "쬒",
+  "쬓",
+  "쬔",
+  "쬕",
+  "쬖",
+  "쬗",
+  "쬘",
+  "쬙",
+  "쬚",
+  "쬛",
+  "쬜",
+  "쬝",
+  "쬞",
+  "쬟",
+  "쬠",
+  "쬡",
+  "쬢",
+  "쬣",
+  "쬤",
+  "쬥",
+  "쬦",
+  "쬧",
+  "쬨",
+  "쬩",
+  "쬪",
+  "쬫",
+  "쬬",
+  "쬭",
+  "쬮",
+  "쬯",
+  "쬰",
+  "쬱",
+  "쬲",
+  "쬳",
+  "쬴",
+  "쬵",
+  "쬶",
+  "쬷",
+  "쬸",
+  "쬹",
+  "쬺",
+  "쬻",
+  "쬼",
+  "쬽",
+  "쬾",
+  "쬿",
+  "쭀",
+  "쭁",
+  "쭂",
+  "쭃",
+  "쭄",
+  "쭅",
+  "쭆",
+  "쭇",
+  "쭈",
+  "쭉",
+  "쭊",
+  "쭋",
+  "쭌",
+  "쭍",
+  "쭎",
+  "쭏",
+  "쭐",
+  "쭑",
+  "쭒",
+  "쭓",
+  "쭔",
+  "쭕",
+  "쭖",
+  "쭗",
+  "쭘",
+  "쭙",
+  "쭚",
+  "쭛",
+  "쭜",
+  "쭝",
+  "쭞",
+  "쭟",
+  "쭠",
+  "쭡",
+  "쭢",
+  "쭣",
+  "쭤",
+  "쭥",
+  "쭦",
+  "쭧",
+  "쭨",
+  "쭩",
+  "쭪",
+  "쭫",
+  "쭬",
+  "쭭",
+  "쭮",
+  "쭯",
+  "쭰",
+  "쭱",
+  "쭲",
+  "쭳",
+  "쭴",
+  "쭵",
+  "쭶",
+  "쭷",
+  "쭸",
+  "쭹",
+  "쭺",
+  "쭻",
+  "쭼",
+  "쭽",
+  "쭾",
+  "쭿",
+  "쮀",
+  "쮁",
+  "쮂",
+  "쮃",
+  "쮄",
+  "쮅",
+  "쮆",
+  "쮇",
+  "쮈",
+  "쮉",
+  "쮊",
+  "쮋",
+  "쮌",
+  "쮍",
+  "쮎",
+  "쮏",
+  "쮐",
+  "쮑",
+  "쮒",
+  "쮓",
+  "쮔",
+  "쮕",
+  "쮖",
+  "쮗",
+  "쮘",
+  "쮙",
+  "쮚",
+  "쮛",
+  "쮜",
+  "쮝",
+  "쮞",
+  "쮟",
+  "쮠",
+  "쮡",
+  "쮢",
+  "쮣",
+  "쮤",
+  "쮥",
+  "쮦",
+  "쮧",
+  "쮨",
+  "쮩",
+  "쮪",
+  "쮫",
+  "쮬",
+  "쮭",
+  "쮮",
+  "쮯",
+  "쮰",
+  "쮱",
+  "쮲",
+  "쮳",
+  "쮴",
+  "쮵",
+  "쮶",
+  "쮷",
+  "쮸",
+  "쮹",
+  "쮺",
+  "쮻",
+  "쮼",
+  "쮽",
+  "쮾",
+  "쮿",
+  "쯀",
+  "쯁",
+  "쯂",
+  "쯃",
+  "쯄",
+  "쯅",
+  "쯆",
+  "쯇",
+  "쯈",
+  "쯉",
+  "쯊",
+  "쯋",
+  "쯌",
+  "쯍",
+  "쯎",
+  "쯏",
+  "쯐",
+  "쯑",
+  "쯒",
+  "쯓",
+  "쯔",
+  "쯕",
+  "쯖",
+  "쯗",
+  "쯘",
+  "쯙",
+  "쯚",
+  "쯛",
+  "쯜",
+  "쯝",
+  "쯞",
+  "쯟",
+  "쯠",
+  "쯡",
+  "쯢",
+  "쯣",
+  "쯤",
+  "쯥",
+  "쯦",
+  "쯧",
+  "쯨",
+  "쯩",
+  "쯪",
+  "쯫",
+  "쯬",
+  "쯭",
+  "쯮",
+  "쯯",
+  "쯰",
+  "쯱",
+  "쯲",
+  "쯳",
+  "쯴",
+  "쯵",
+  "쯶",
+  "쯷",
+  "쯸",
+  "쯹",
+  "쯺",
+  "쯻",
+  "쯼",
+  "쯽",
+  "쯾",
+  "쯿",
+  "찀",
+  "찁",
+  "찂",
+  "찃",
+  "찄",
+  "찅",
+  "찆",
+  "찇",
+  "찈",
+  "찉",
+  "찊",
+  "찋",
+  "찌",
+  "찍",
+  "찎",
+  "찏",
+  "찐",
+  "찑",
+  "찒",
+  "찓",
+  "찔",
+  "찕",
+  "찖",
+  "찗",
+  "찘",
+  "찙",
+  "찚",
+  "찛",
+  "찜",
+  "찝",
+  "찞",
+  "찟",
+  "찠",
+  "찡",
+  "찢",
+  "찣",
+  "찤",
+  "찥",
+  "찦",
+  "찧",
+  "차",
+  "착",
+  "찪",
+  "찫",
+  "찬",
+  "찭",
+  "찮",
+  "찯",
+  "찰",
+  "찱",
+  "찲",
+  "찳",
+  "찴",
+  "찵",
+  "찶",
+  "찷",
+  "참",
+  "찹",
+  "찺",
+  "찻",
+  "찼",
+  "창",
+  "찾",
+  "찿",
+  "챀",
+  "챁",
+  "챂",
+  "챃",
+  "채",
+  "책",
+  "챆",
+  "챇",
+  "챈",
+  "챉",
+  "챊",
+  "챋",
+  "챌",
+  "챍",
+  "챎",
+  "챏",
+  "챐",
+  "챑",
+  "챒",
+  "챓",
+  "챔",
+  "챕",
+  "챖",
+  "챗",
+  "챘",
+  "챙",
+  "챚",
+  "챛",
+  "챜",
+  "챝",
+  "챞",
+  "챟",
+  "챠",
+  "챡",
+  "챢",
+  "챣",
+  "챤",
+  "챥",
+  "챦",
+  "챧",
+  "챨",
+  "챩",
+  "챪",
+  "챫",
+  "챬",
+  "챭",
+  "챮",
+  "챯",
+  "챰",
+  "챱",
+  "챲",
+  "챳",
+  "챴",
+  "챵",
+  "챶",
+  "챷",
+  "챸",
+  "챹",
+  "챺",
+  "챻",
+  "챼",
+  "챽",
+  "챾",
+  "챿",
+  "첀",
+  "첁",
+  "첂",
+  "첃",
+  "첄",
+  "첅",
+  "첆",
+  "첇",
+  "첈",
+  "첉",
+  "첊",
+  "첋",
+  "첌",
+  "첍",
+  "첎",
+  "첏",
+  "첐",
+  "첑",
+  "첒",
+  "첓",
+  "첔",
+  "첕",
+  "첖",
+  "첗",
+  "처",
+  "척",
+  "첚",
+  "첛",
+  "천",
+  "첝",
+  "첞",
+  "첟",
+  "철",
+  "첡",
+  "첢",
+  "첣",
+  "첤",
+  "첥",
+  "첦",
+  "첧",
+  "첨",
+  "첩",
+  "첪",
+  "첫",
+  "첬",
+  "청",
+  "첮",
+  "첯",
+  "첰",
+  "첱",
+  "첲",
+  "첳",
+  "체",
+  "첵",
+  "첶",
+  "첷",
+  "첸",
+  "첹",
+  "첺",
+  "첻",
+  "첼",
+  "첽",
+  "첾",
+  "첿",
+  "쳀",
+  "쳁",
+  "쳂",
+  "쳃",
+  "쳄",
+  "쳅",
+  "쳆",
+  "쳇",
+  "쳈",
+  "쳉",
+  "쳊",
+  "쳋",
+  "쳌",
+  "쳍",
+  "쳎",
+  "쳏",
+  "쳐",
+  "쳑",
+  "쳒",
+  "쳓",
+  "쳔",
+  "쳕",
+  "쳖",
+  "쳗",
+  "쳘",
+  "쳙",
+  "쳚",
+  "쳛",
+  "쳜",
+  "쳝",
+  "쳞",
+  "쳟",
+  "쳠",
+  "쳡",
+  "쳢",
+  "쳣",
+  "쳤",
+  "쳥",
+  "쳦",
+  "쳧",
+  "쳨",
+  "쳩",
+  "쳪",
+  "쳫",
+  "쳬",
+  "쳭",
+  "쳮",
+  "쳯",
+  "쳰",
+  "쳱",
+  "쳲",
+  "쳳",
+  "쳴",
+  "쳵",
+  "쳶",
+  "쳷",
+  "쳸",
+  "쳹",
+  "쳺",
+  "쳻",
+  "쳼",
+  "쳽",
+  "쳾",
+  "쳿",
+  "촀",
+  "촁",
+  "촂",
+  "촃",
+  "촄",
+  "촅",
+  "촆",
+  "촇",
+  "초",
+  "촉",
+  "촊",
+  "촋",
+  "촌",
+  "촍",
+  "촎",
+  "촏",
+  "촐",
+  "촑",
+  "촒",
+  "촓",
+  "촔",
+  "촕",
+  "촖",
+  "촗",
+  "촘",
+  "촙",
+  "촚",
+  "촛",
+  "촜",
+  "총",
+  "촞",
+  "촟",
+  "촠",
+  "촡",
+  "촢",
+  "촣",
+  "촤",
+  "촥",
+  "촦",
+  "촧",
+  "촨",
+  "촩",
+  "촪",
+  "촫",
+  "촬",
+  "촭",
+  "촮",
+  "촯",
+  "촰",
+  "촱",
+  "촲",
+  "촳",
+  "촴",
+  "촵",
+  "촶",
+  "촷",
+  "촸",
+  "촹",
+  "촺",
+  "촻",
+  "촼",
+  "촽",
+  "촾",
+  "촿",
+  "쵀",
+  "쵁",
+  "쵂",
+  "쵃",
+  "쵄",
+  "쵅",
+  "쵆",
+  "쵇",
+  "쵈",
+  "쵉",
+  "쵊",
+  "쵋",
+  "쵌",
+  "쵍",
+  "쵎",
+  "쵏",
+  "쵐",
+  "쵑",
+  "쵒",
+  "쵓",
+  "쵔",
+  "쵕",
+  "쵖",
+  "쵗",
+  "쵘",
+  "쵙",
+  "쵚",
+  "쵛",
+  "최",
+  "쵝",
+  "쵞",
+  "쵟",
+  "쵠",
+  "쵡",
+  "쵢",
+  "쵣",
+  "쵤",
+  "쵥",
+  "쵦",
+  "쵧",
+  "쵨",
+  "쵩",
+  "쵪",
+  "쵫",
+  "쵬",
+  "쵭",
+  "쵮",
+  "쵯",
+  "쵰",
+  "쵱",
+  "쵲",
+  "쵳",
+  "쵴",
+  "쵵",
+  "쵶",
+  "쵷",
+  "쵸",
+  "쵹",
+  "쵺",
+  "쵻",
+  "쵼",
+  "쵽",
+  "쵾",
+  "쵿",
+  "춀",
+  "춁",
+  "춂",
+  "춃",
+  "춄",
+  "춅",
+  "춆",
+  "춇",
+  "춈",
+  "춉",
+  "춊",
+  "춋",
+  "춌",
+  "춍",
+  "춎",
+  "춏",
+  "춐",
+  "춑",
+  "춒",
+  "춓",
+  "추",
+  "축",
+  "춖",
+  "춗",
+  "춘",
+  "춙",
+  "춚",
+  "춛",
+  "출",
+  "춝",
+  "춞",
+  "춟",
+  "춠",
+  "춡",
+  "춢",
+  "춣",
+  "춤",
+  "춥",
+  "춦",
+  "춧",
+  "춨",
+  "충",
+  "춪",
+  "춫",
+  "춬",
+  "춭",
+  "춮",
+  "춯",
+  "춰",
+  "춱",
+  "춲",
+  "춳",
+  "춴",
+  "춵",
+  "춶",
+  "춷",
+  "춸",
+  "춹",
+  "춺",
+  "춻",
+  "춼",
+  "춽",
+  "춾",
+  "춿",
+  "췀",
+  "췁",
+  "췂",
+  "췃",
+  "췄",
+  "췅",
+  "췆",
+  "췇",
+  "췈",
+  "췉",
+  "췊",
+  "췋",
+  "췌",
+  "췍",
+  "췎",
+  "췏",
+  "췐",
+  "췑",
+  "췒",
+  "췓",
+  "췔",
+  "췕",
+  "췖",
+  "췗",
+  "췘",
+  "췙",
+  "췚",
+  "췛",
+  "췜",
+  "췝",
+  "췞",
+  "췟",
+  "췠",
+  "췡",
+  "췢",
+  "췣",
+  "췤",
+  "췥",
+  "췦",
+  "췧",
+  "취",
+  "췩",
+  "췪",
+  "췫",
+  "췬",
+  "췭",
+  "췮",
+  "췯",
+  "췰",
+  "췱",
+  "췲",
+  "췳",
+  "췴",
+  "췵",
+  "췶",
+  "췷",
+  "췸",
+  "췹",
+  "췺",
+  "췻",
+  "췼",
+  "췽",
+  "췾",
+  "췿",
+  "츀",
+  "츁",
+  "츂",
+  "츃",
+  "츄",
+  "츅",
+  "츆",
+  "츇",
+  "츈",
+  "츉",
+  "츊",
+  "츋",
+  "츌",
+  "츍",
+  "츎",
+  "츏",
+  "츐",
+  "츑",
+  "츒",
+  "츓",
+  "츔",
+  "츕",
+  "츖",
+  "츗",
+  "츘",
+  "츙",
+  "츚",
+  "츛",
+  "츜",
+  "츝",
+  "츞",
+  "츟",
+  "츠",
+  "측",
+  "츢",
+  "츣",
+  "츤",
+  "츥",
+  "츦",
+  "츧",
+  "츨",
+  "츩",
+  "츪",
+  "츫",
+  "츬",
+  "츭",
+  "츮",
+  "츯",
+  "츰",
+  "츱",
+  "츲",
+  "츳",
+  "츴",
+  "층",
+  "츶",
+  "츷",
+  "츸",
+  "츹",
+  "츺",
+  "츻",
+  "츼",
+  "츽",
+  "츾",
+  "츿",
+  "칀",
+  "칁",
+  "칂",
+  "칃",
+  "칄",
+  "칅",
+  "칆",
+  "칇",
+  "칈",
+  "칉",
+  "칊",
+  "칋",
+  "칌",
+  "칍",
+  "칎",
+  "칏",
+  "칐",
+  "칑",
+  "칒",
+  "칓",
+  "칔",
+  "칕",
+  "칖",
+  "칗",
+  "치",
+  "칙",
+  "칚",
+  "칛",
+  "친",
+  "칝",
+  "칞",
+  "칟",
+  "칠",
+  "칡",
+  "칢",
+  "칣",
+  "칤",
+  "칥",
+  "칦",
+  "칧",
+  "침",
+  "칩",
+  "칪",
+  "칫",
+  "칬",
+  "칭",
+  "칮",
+  "칯",
+  "칰",
+  "칱",
+  "칲",
+  "칳",
+  "카",
+  "칵",
+  "칶",
+  "칷",
+  "칸",
+  "칹",
+  "칺",
+  "칻",
+  "칼",
+  "칽",
+  "칾",
+  "칿",
+  "캀",
+  "캁",
+  "캂",
+  "캃",
+  "캄",
+  "캅",
+  "캆",
+  "캇",
+  "캈",
+  "캉",
+  "캊",
+  "캋",
+  "캌",
+  "캍",
+  "캎",
+  "캏",
+  "캐",
+  "캑",
+  "캒",
+  "캓",
+  "캔",
+  "캕",
+  "캖",
+  "캗",
+  "캘",
+  "캙",
+  "캚",
+  "캛",
+  "캜",
+  "캝",
+  "캞",
+  "캟",
+  "캠",
+  "캡",
+  "캢",
+  "캣",
+  "캤",
+  "캥",
+  "캦",
+  "캧",
+  "캨",
+  "캩",
+  "캪",
+  "캫",
+  "캬",
+  "캭",
+  "캮",
+  "캯",
+  "캰",
+  "캱",
+  "캲",
+  "캳",
+  "캴",
+  "캵",
+  "캶",
+  "캷",
+  "캸",
+  "캹",
+  "캺",
+  "캻",
+  "캼",
+  "캽",
+  "캾",
+  "캿",
+  "컀",
+  "컁",
+  "컂",
+  "컃",
+  "컄",
+  "컅",
+  "컆",
+  "컇",
+  "컈",
+  "컉",
+  "컊",
+  "컋",
+  "컌",
+  "컍",
+  "컎",
+  "컏",
+  "컐",
+  "컑",
+  "컒",
+  "컓",
+  "컔",
+  "컕",
+  "컖",
+  "컗",
+  "컘",
+  "컙",
+  "컚",
+  "컛",
+  "컜",
+  "컝",
+  "컞",
+  "컟",
+  "컠",
+  "컡",
+  "컢",
+  "컣",
+  "커",
+  "컥",
+  "컦",
+  "컧",
+  "컨",
+  "컩",
+  "컪",
+  "컫",
+  "컬",
+  "컭",
+  "컮",
+  "컯",
+  "컰",
+  "컱",
+  "컲",
+  "컳",
+  "컴",
+  "컵",
+  "컶",
+  "컷",
+  "컸",
+  "컹",
+  "컺",
+  "컻",
+  "컼",
+  "컽",
+  "컾",
+  "컿",
+  "케",
+  "켁",
+  "켂",
+  "켃",
+  "켄",
+  "켅",
+  "켆",
+  "켇",
+  "켈",
+  "켉",
+  "켊",
+  "켋",
+  "켌",
+  "켍",
+  "켎",
+  "켏",
+  "켐",
+  "켑",
+  "켒",
+  "켓",
+  "켔",
+  "켕",
+  "켖",
+  "켗",
+  "켘",
+  "켙",
+  "켚",
+  "켛",
+  "켜",
+  "켝",
+  "켞",
+  "켟",
+  "켠",
+  "켡",
+  "켢",
+  "켣",
+  "켤",
+  "켥",
+  "켦",
+  "켧",
+  "켨",
+  "켩",
+  "켪",
+  "켫",
+  "켬",
+  "켭",
+  "켮",
+  "켯",
+  "켰",
+  "켱",
+  "켲",
+  "켳",
+  "켴",
+  "켵",
+  "켶",
+  "켷",
+  "켸",
+  "켹",
+  "켺",
+  "켻",
+  "켼",
+  "켽",
+  "켾",
+  "켿",
+  "콀",
+  "콁",
+  "콂",
+  "콃",
+  "콄",
+  "콅",
+  "콆",
+  "콇",
+  "콈",
+  "콉",
+  "콊",
+  "콋",
+  "콌",
+  "콍",
+  "콎",
+  "콏",
+  "콐",
+  "콑",
+  "콒",
+  "콓",
+  "코",
+  "콕",
+  "콖",
+  "콗",
+  "콘",
+  "콙",
+  "콚",
+  "콛",
+  "콜",
+  "콝",
+  "콞",
+  "콟",
+  "콠",
+  "콡",
+  "콢",
+  "콣",
+  "콤",
+  "콥",
+  "콦",
+  "콧",
+  "콨",
+  "콩",
+  "콪",
+  "콫",
+  "콬",
+  "콭",
+  "콮",
+  "콯",
+  "콰",
+  "콱",
+  "콲",
+  "콳",
+  "콴",
+  "콵",
+  "콶",
+  "콷",
+  "콸",
+  "콹",
+  "콺",
+  "콻",
+  "콼",
+  "콽",
+  "콾",
+  "콿",
+  "쾀",
+  "쾁",
+  "쾂",
+  "쾃",
+  "쾄",
+  "쾅",
+  "쾆",
+  "쾇",
+  "쾈",
+  "쾉",
+  "쾊",
+  "쾋",
+  "쾌",
+  "쾍",
+  "쾎",
+  "쾏",
+  "쾐",
+  "쾑",
+  "쾒",
+  "쾓",
+  "쾔",
+  "쾕",
+  "쾖",
+  "쾗",
+  "쾘",
+  "쾙",
+  "쾚",
+  "쾛",
+  "쾜",
+  "쾝",
+  "쾞",
+  "쾟",
+  "쾠",
+  "쾡",
+  "쾢",
+  "쾣",
+  "쾤",
+  "쾥",
+  "쾦",
+  "쾧",
+  "쾨",
+  "쾩",
+  "쾪",
+  "쾫",
+  "쾬",
+  "쾭",
+  "쾮",
+  "쾯",
+  "쾰",
+  "쾱",
+  "쾲",
+  "쾳",
+  "쾴",
+  "쾵",
+  "쾶",
+  "쾷",
+  "쾸",
+  "쾹",
+  "쾺",
+  "쾻",
+  "쾼",
+  "쾽",
+  "쾾",
+  "쾿",
+  "쿀",
+  "쿁",
+  "쿂",
+  "쿃",
+  "쿄",
+  "쿅",
+  "쿆",
+  "쿇",
+  "쿈",
+  "쿉",
+  "쿊",
+  "쿋",
+  "쿌",
+  "쿍",
+  "쿎",
+  "쿏",
+  "쿐",
+  "쿑",
+  "쿒",
+  "쿓",
+  "쿔",
+  "쿕",
+  "쿖",
+  "쿗",
+  "쿘",
+  "쿙",
+  "쿚",
+  "쿛",
+  "쿜",
+  "쿝",
+  "쿞",
+  "쿟",
+  "쿠",
+  "쿡",
+  "쿢",
+  "쿣",
+  "쿤",
+  "쿥",
+  "쿦",
+  "쿧",
+  "쿨",
+  "쿩",
+  "쿪",
+  "쿫",
+  "쿬",
+  "쿭",
+  "쿮",
+  "쿯",
+  "쿰",
+  "쿱",
+  "쿲",
+  "쿳",
+  "쿴",
+  "쿵",
+  "쿶",
+  "쿷",
+  "쿸",
+  "쿹",
+  "쿺",
+  "쿻",
+  "쿼",
+  "쿽",
+  "쿾",
+  "쿿",
+  "퀀",
+  "퀁",
+  "퀂",
+  "퀃",
+  "퀄",
+  "퀅",
+  "퀆",
+  "퀇",
+  "퀈",
+  "퀉",
+  "퀊",
+  "퀋",
+  "퀌",
+  "퀍",
+  "퀎",
+  "퀏",
+  "퀐",
+  "퀑",
+  "퀒",
+  "퀓",
+  "퀔",
+  "퀕",
+  "퀖",
+  "퀗",
+  "퀘",
+  "퀙",
+  "퀚",
+  "퀛",
+  "퀜",
+  "퀝",
+  "퀞",
+  "퀟",
+  "퀠",
+  "퀡",
+  "퀢",
+  "퀣",
+  "퀤",
+  "퀥",
+  "퀦",
+  "퀧",
+  "퀨",
+  "퀩",
+  "퀪",
+  "퀫",
+  "퀬",
+  "퀭",
+  "퀮",
+  "퀯",
+  "퀰",
+  "퀱",
+  "퀲",
+  "퀳",
+  "퀴",
+  "퀵",
+  "퀶",
+  "퀷",
+  "퀸",
+  "퀹",
+  "퀺",
+  "퀻",
+  "퀼",
+  "퀽",
+  "퀾",
+  "퀿",
+  "큀",
+  "큁",
+  "큂",
+  "큃",
+  "큄",
+  "큅",
+  "큆",
+  "큇",
+  "큈",
+  "큉",
+  "큊",
+  "큋",
+  "큌",
+  "큍",
+  "큎",
+  "큏",
+  "큐",
+  "큑",
+  "큒",
+  "큓",
+  "큔",
+  "큕",
+  "큖",
+  "큗",
+  "큘",
+  "큙",
+  "큚",
+  "큛",
+  "큜",
+  "큝",
+  "큞",
+  "큟",
+  "큠",
+  "큡",
+  "큢",
+  "큣",
+  "큤",
+  "큥",
+  "큦",
+  "큧",
+  "큨",
+  "큩",
+  "큪",
+  "큫",
+  "크",
+  "큭",
+  "큮",
+  "큯",
+  "큰",
+  "큱",
+  "큲",
+  "큳",
+  "클",
+  "큵",
+  "큶",
+  "큷",
+  "큸",
+  "큹",
+  "큺",
+  "큻",
+  "큼",
+  "큽",
+  "큾",
+  "큿",
+  "킀",
+  "킁",
+  "킂",
+  "킃",
+  "킄",
+  "킅",
+  "킆",
+  "킇",
+  "킈",
+  "킉",
+  "킊",
+  "킋",
+  "킌",
+  "킍",
+  "킎",
+  "킏",
+  "킐",
+  "킑",
+  "킒",
+  "킓",
+  "킔",
+  "킕",
+  "킖",
+  "킗",
+  "킘",
+  "킙",
+  "킚",
+  "킛",
+  "킜",
+  "킝",
+  "킞",
+  "킟",
+  "킠",
+  "킡",
+  "킢",
+  "킣",
+  "키",
+  "킥",
+  "킦",
+  "킧",
+  "킨",
+  "킩",
+  "킪",
+  "킫",
+  "킬",
+  "킭",
+  "킮",
+  "킯",
+  "킰",
+  "킱",
+  "킲",
+  "킳",
+  "킴",
+  "킵",
+  "킶",
+  "킷",
+  "킸",
+  "킹",
+  "킺",
+  "킻",
+  "킼",
+  "킽",
+  "킾",
+  "킿",
+  "타",
+  "탁",
+  "탂",
+  "탃",
+  "탄",
+  "탅",
+  "탆",
+  "탇",
+  "탈",
+  "탉",
+  "탊",
+  "탋",
+  "탌",
+  "탍",
+  "탎",
+  "탏",
+  "탐",
+  "탑",
+  "탒",
+  "탓",
+  "탔",
+  "탕",
+  "탖",
+  "탗",
+  "탘",
+  "탙",
+  "탚",
+  "탛",
+  "태",
+  "택",
+  "탞",
+  "탟",
+  "탠",
+  "탡",
+  "탢",
+  "탣",
+  "탤",
+  "탥",
+  "탦",
+  "탧",
+  "탨",
+  "탩",
+  "탪",
+  "탫",
+  "탬",
+  "탭",
+  "탮",
+  "탯",
+  "탰",
+  "탱",
+  "탲",
+  "탳",
+  "탴",
+  "탵",
+  "탶",
+  "탷",
+  "탸",
+  "탹",
+  "탺",
+  "탻",
+  "탼",
+  "탽",
+  "탾",
+  "탿",
+  "턀",
+  "턁",
+  "턂",
+  "턃",
+  "턄",
+  "턅",
+  "턆",
+  "턇",
+  "턈",
+  "턉",
+  "턊",
+  "턋",
+  "턌",
+  "턍",
+  "턎",
+  "턏",
+  "턐",
+  "턑",
+  "턒",
+  "턓",
+  "턔",
+  "턕",
+  "턖",
+  "턗",
+  "턘",
+  "턙",
+  "턚",
+  "턛",
+  "턜",
+  "턝",
+  "턞",
+  "턟",
+  "턠",
+  "턡",
+  "턢",
+  "턣",
+  "턤",
+  "턥",
+  "턦",
+  "턧",
+  "턨",
+  "턩",
+  "턪",
+  "턫",
+  "턬",
+  "턭",
+  "턮",
+  "턯",
+  "터",
+  "턱",
+  "턲",
+  "턳",
+  "턴",
+  "턵",
+  "턶",
+  "턷",
+  "털",
+  "턹",
+  "턺",
+  "턻",
+  "턼",
+  "턽",
+  "턾",
+  "턿",
+  "텀",
+  "텁",
+  "텂",
+  "텃",
+  "텄",
+  "텅",
+  "텆",
+  "텇",
+  "텈",
+  "텉",
+  "텊",
+  "텋",
+  "테",
+  "텍",
+  "텎",
+  "텏",
+  "텐",
+  "텑",
+  "텒",
+  "텓",
+  "텔",
+  "텕",
+  "텖",
+  "텗",
+  "텘",
+  "텙",
+  "텚",
+  "텛",
+  "템",
+  "텝",
+  "텞",
+  "텟",
+  "텠",
+  "텡",
+  "텢",
+  "텣",
+  "텤",
+  "텥",
+  "텦",
+  "텧",
+  "텨",
+  "텩",
+  "텪",
+  "텫",
+  "텬",
+  "텭",
+  "텮",
+  "텯",
+  "텰",
+  "텱",
+  "텲",
+  "텳",
+  "텴",
+  "텵",
+  "텶",
+  "텷",
+  "텸",
+  "텹",
+  "텺",
+  "텻",
+  "텼",
+  "텽",
+  "텾",
+  "텿",
+  "톀",
+  "톁",
+  "톂",
+  "톃",
+  "톄",
+  "톅",
+  "톆",
+  "톇",
+  "톈",
+  "톉",
+  "톊",
+  "톋",
+  "톌",
+  "톍",
+  "톎",
+  "톏",
+  "톐",
+  "톑",
+  "톒",
+  "톓",
+  "톔",
+  "톕",
+  "톖",
+  "톗",
+  "톘",
+  "톙",
+  "톚",
+  "톛",
+  "톜",
+  "톝",
+  "톞",
+  "톟",
+  "토",
+  "톡",
+  "톢",
+  "톣",
+  "톤",
+  "톥",
+  "톦",
+  "톧",
+  "톨",
+  "톩",
+  "톪",
+  "톫",
+  "톬",
+  "톭",
+  "톮",
+  "톯",
+  "톰",
+  "톱",
+  "톲",
+  "톳",
+  "톴",
+  "통",
+  "톶",
+  "톷",
+  "톸",
+  "톹",
+  "톺",
+  "톻",
+  "톼",
+  "톽",
+  "톾",
+  "톿",
+  "퇀",
+  "퇁",
+  "퇂",
+  "퇃",
+  "퇄",
+  "퇅",
+  "퇆",
+  "퇇",
+  "퇈",
+  "퇉",
+  "퇊",
+  "퇋",
+  "퇌",
+  "퇍",
+  "퇎",
+  "퇏",
+  "퇐",
+  "퇑",
+  "퇒",
+  "퇓",
+  "퇔",
+  "퇕",
+  "퇖",
+  "퇗",
+  "퇘",
+  "퇙",
+  "퇚",
+  "퇛",
+  "퇜",
+  "퇝",
+  "퇞",
+  "퇟",
+  "퇠",
+  "퇡",
+  "퇢",
+  "퇣",
+  "퇤",
+  "퇥",
+  "퇦",
+  "퇧",
+  "퇨",
+  "퇩",
+  "퇪",
+  "퇫",
+  "퇬",
+  "퇭",
+  "퇮",
+  "퇯",
+  "퇰",
+  "퇱",
+  "퇲",
+  "퇳",
+  "퇴",
+  "퇵",
+  "퇶",
+  "퇷",
+  "퇸",
+  "퇹",
+  "퇺",
+  "퇻",
+  "퇼",
+  "퇽",
+  "퇾",
+  "퇿",
+  "툀",
+  "툁",
+  "툂",
+  "툃",
+  "툄",
+  "툅",
+  "툆",
+  "툇",
+  "툈",
+  "툉",
+  "툊",
+  "툋",
+  "툌",
+  "툍",
+  "툎",
+  "툏",
+  "툐",
+  "툑",
+  "툒",
+  "툓",
+  "툔",
+  "툕",
+  "툖",
+  "툗",
+  "툘",
+  "툙",
+  "툚",
+  "툛",
+  "툜",
+  "툝",
+  "툞",
+  "툟",
+  "툠",
+  "툡",
+  "툢",
+  "툣",
+  "툤",
+  "툥",
+  "툦",
+  "툧",
+  "툨",
+  "툩",
+  "툪",
+  "툫",
+  "투",
+  "툭",
+  "툮",
+  "툯",
+  "툰",
+  "툱",
+  "툲",
+  "툳",
+  "툴",
+  "툵",
+  "툶",
+  "툷",
+  "툸",
+  "툹",
+  "툺",
+  "툻",
+  "툼",
+  "툽",
+  "툾",
+  "툿",
+  "퉀",
+  "퉁",
+  "퉂",
+  "퉃",
+  "퉄",
+  "퉅",
+  "퉆",
+  "퉇",
+  "퉈",
+  "퉉",
+  "퉊",
+  "퉋",
+  "퉌",
+  "퉍",
+  "퉎",
+  "퉏",
+  "퉐",
+  "퉑",
+  "퉒",
+  "퉓",
+  "퉔",
+  "퉕",
+  "퉖",
+  "퉗",
+  "퉘",
+  "퉙",
+  "퉚",
+  "퉛",
+  "퉜",
+  "퉝",
+  "퉞",
+  "퉟",
+  "퉠",
+  "퉡",
+  "퉢",
+  "퉣",
+  "퉤",
+  "퉥",
+  "퉦",
+  "퉧",
+  "퉨",
+  "퉩",
+  "퉪",
+  "퉫",
+  "퉬",
+  "퉭",
+  "퉮",
+  "퉯",
+  "퉰",
+  "퉱",
+  "퉲",
+  "퉳",
+  "퉴",
+  "퉵",
+  "퉶",
+  "퉷",
+  "퉸",
+  "퉹",
+  "퉺",
+  "퉻",
+  "퉼",
+  "퉽",
+  "퉾",
+  "퉿",
+  "튀",
+  "튁",
+  "튂",
+  "튃",
+  "튄",
+  "튅",
+  "튆",
+  "튇",
+  "튈",
+  "튉",
+  "튊",
+  "튋",
+  "튌",
+  "튍",
+  "튎",
+  "튏",
+  "튐",
+  "튑",
+  "튒",
+  "튓",
+  "튔",
+  "튕",
+  "튖",
+  "튗",
+  "튘",
+  "튙",
+  "튚",
+  "튛",
+  "튜",
+  "튝",
+  "튞",
+  "튟",
+  "튠",
+  "튡",
+  "튢",
+  "튣",
+  "튤",
+  "튥",
+  "튦",
+  "튧",
+  "튨",
+  "튩",
+  "튪",
+  "튫",
+  "튬",
+  "튭",
+  "튮",
+  "튯",
+  "튰",
+  "튱",
+  "튲",
+  "튳",
+  "튴",
+  "튵",
+  "튶",
+  "튷",
+  "트",
+  "특",
+  "튺",
+  "튻",
+  "튼",
+  "튽",
+  "튾",
+  "튿",
+  "틀",
+  "틁",
+  "틂",
+  "틃",
+  "틄",
+  "틅",
+  "틆",
+  "틇",
+  "틈",
+  "틉",
+  "틊",
+  "틋",
+  "틌",
+  "틍",
+  "틎",
+  "틏",
+  "틐",
+  "틑",
+  "틒",
+  "틓",
+  "틔",
+  "틕",
+  "틖",
+  "틗",
+  "틘",
+  "틙",
+  "틚",
+  "틛",
+  "틜",
+  "틝",
+  "틞",
+  "틟",
+  "틠",
+  "틡",
+  "틢",
+  "틣",
+  "틤",
+  "틥",
+  "틦",
+  "틧",
+  "틨",
+  "틩",
+  "틪",
+  "틫",
+  "틬",
+  "틭",
+  "틮",
+  "틯",
+  "티",
+  "틱",
+  "틲",
+  "틳",
+  "틴",
+  "틵",
+  "틶",
+  "틷",
+  "틸",
+  "틹",
+  "틺",
+  "틻",
+  "틼",
+  "틽",
+  "틾",
+  "틿",
+  "팀",
+  "팁",
+  "팂",
+  "팃",
+  "팄",
+  "팅",
+  "팆",
+  "팇",
+  "팈",
+  "팉",
+  "팊",
+  "팋",
+  "파",
+  "팍",
+  "팎",
+  "팏",
+  "판",
+  "팑",
+  "팒",
+  "팓",
+  "팔",
+  "팕",
+  "팖",
+  "팗",
+  "팘",
+  "팙",
+  "팚",
+  "팛",
+  "팜",
+  "팝",
+  "팞",
+  "팟",
+  "팠",
+  "팡",
+  "팢",
+  "팣",
+  "팤",
+  "팥",
+  "팦",
+  "팧",
+  "패",
+  "팩",
+  "팪",
+  "팫",
+  "팬",
+  "팭",
+  "팮",
+  "팯",
+  "팰",
+  "팱",
+  "팲",
+  "팳",
+  "팴",
+  "팵",
+  "팶",
+  "팷",
+  "팸",
+  "팹",
+  "팺",
+  "팻",
+  "팼",
+  "팽",
+  "팾",
+  "팿",
+  "퍀",
+  "퍁",
+  "퍂",
+  "퍃",
+  "퍄",
+  "퍅",
+  "퍆",
+  "퍇",
+  "퍈",
+  "퍉",
+  "퍊",
+  "퍋",
+  "퍌",
+  "퍍",
+  "퍎",
+  "퍏",
+  "퍐",
+  "퍑",
+  "퍒",
+  "퍓",
+  "퍔",
+  "퍕",
+  "퍖",
+  "퍗",
+  "퍘",
+  "퍙",
+  "퍚",
+  "퍛",
+  "퍜",
+  "퍝",
+  "퍞",
+  "퍟",
+  "퍠",
+  "퍡",
+  "퍢",
+  "퍣",
+  "퍤",
+  "퍥",
+  "퍦",
+  "퍧",
+  "퍨",
+  "퍩",
+  "퍪",
+  "퍫",
+  "퍬",
+  "퍭",
+  "퍮",
+  "퍯",
+  "퍰",
+  "퍱",
+  "퍲",
+  "퍳",
+  "퍴",
+  "퍵",
+  "퍶",
+  "퍷",
+  "퍸",
+  "퍹",
+  "퍺",
+  "퍻",
+  "퍼",
+  "퍽",
+  "퍾",
+  "퍿",
+  "펀",
+  "펁",
+  "펂",
+  "펃",
+  "펄",
+  "펅",
+  "펆",
+  "펇",
+  "펈",
+  "펉",
+  "펊",
+  "펋",
+  "펌",
+  "펍",
+  "펎",
+  "펏",
+  "펐",
+  "펑",
+  "펒",
+  "펓",
+  "펔",
+  "펕",
+  "펖",
+  "펗",
+  "페",
+  "펙",
+  "펚",
+  "펛",
+  "펜",
+  "펝",
+  "펞",
+  "펟",
+  "펠",
+  "펡",
+  "펢",
+  "펣",
+  "펤",
+  "펥",
+  "펦",
+  "펧",
+  "펨",
+  "펩",
+  "펪",
+  "펫",
+  "펬",
+  "펭",
+  "펮",
+  "펯",
+  "펰",
+  "펱",
+  "펲",
+  "펳",
+  "펴",
+  "펵",
+  "펶",
+  "펷",
+  "편",
+  "펹",
+  "펺",
+  "펻",
+  "펼",
+  "펽",
+  "펾",
+  "펿",
+  "폀",
+  "폁",
+  "폂",
+  "폃",
+  "폄",
+  "폅",
+  "폆",
+  "폇",
+  "폈",
+  "평",
+  "폊",
+  "폋",
+  "폌",
+  "폍",
+  "폎",
+  "폏",
+  "폐",
+  "폑",
+  "폒",
+  "폓",
+  "폔",
+  "폕",
+  "폖",
+  "폗",
+  "폘",
+  "폙",
+  "폚",
+  "폛",
+  "폜",
+  "폝",
+  "폞",
+  "폟",
+  "폠",
+  "폡",
+  "폢",
+  "폣",
+  "폤",
+  "폥",
+  "폦",
+  "폧",
+  "폨",
+  "폩",
+  "폪",
+  "폫",
+  "포",
+  "폭",
+  "폮",
+  "폯",
+  "폰",
+  "폱",
+  "폲",
+  "폳",
+  "폴",
+  "폵",
+  "폶",
+  "폷",
+  "폸",
+  "폹",
+  "폺",
+  "폻",
+  "폼",
+  "폽",
+  "폾",
+  "폿",
+  "퐀",
+  "퐁",
+  "퐂",
+  "퐃",
+  "퐄",
+  "퐅",
+  "퐆",
+  "퐇",
+  "퐈",
+  "퐉",
+  "퐊",
+  "퐋",
+  "퐌",
+  "퐍",
+  "퐎",
+  "퐏",
+  "퐐",
+  "퐑",
+  "퐒",
+  "퐓",
+  "퐔",
+  "퐕",
+  "퐖",
+  "퐗",
+  "퐘",
+  "퐙",
+  "퐚",
+  "퐛",
+  "퐜",
+  "퐝",
+  "퐞",
+  "퐟",
+  "퐠",
+  "퐡",
+  "퐢",
+  "퐣",
+  "퐤",
+  "퐥",
+  "퐦",
+  "퐧",
+  "퐨",
+  "퐩",
+  "퐪",
+  "퐫",
+  "퐬",
+  "퐭",
+  "퐮",
+  "퐯",
+  "퐰",
+  "퐱",
+  "퐲",
+  "퐳",
+  "퐴",
+  "퐵",
+  "퐶",
+  "퐷",
+  "퐸",
+  "퐹",
+  "퐺",
+  "퐻",
+  "퐼",
+  "퐽",
+  "퐾",
+  "퐿",
+  "푀",
+  "푁",
+  "푂",
+  "푃",
+  "푄",
+  "푅",
+  "푆",
+  "푇",
+  "푈",
+  "푉",
+  "푊",
+  "푋",
+  "푌",
+  "푍",
+  "푎",
+  "푏",
+  "푐",
+  "푑",
+  "푒",
+  "푓",
+  "푔",
+  "푕",
+  "푖",
+  "푗",
+  "푘",
+  "푙",
+  "푚",
+  "푛",
+  "표",
+  "푝",
+  "푞",
+  "푟",
+  "푠",
+  "푡",
+  "푢",
+  "푣",
+  "푤",
+  "푥",
+  "푦",
+  "푧",
+  "푨",
+  "푩",
+  "푪",
+  "푫",
+  "푬",
+  "푭",
+  "푮",
+  "푯",
+  "푰",
+  "푱",
+  "푲",
+  "푳",
+  "푴",
+  "푵",
+  "푶",
+  "푷",
+  "푸",
+  "푹",
+  "푺",
+  "푻",
+  "푼",
+  "푽",
+  "푾",
+  "푿",
+  "풀",
+  "풁",
+  "풂",
+  "풃",
+  "풄",
+  "풅",
+  "풆",
+  "풇",
+  "품",
+  "풉",
+  "풊",
+  "풋",
+  "풌",
+  "풍",
+  "풎",
+  "풏",
+  "풐",
+  "풑",
+  "풒",
+  "풓",
+  "풔",
+  "풕",
+  "풖",
+  "풗",
+  "풘",
+  "풙",
+  "풚",
+  "풛",
+  "풜",
+  "풝",
+  "풞",
+  "풟",
+  "풠",
+  "풡",
+  "풢",
+  "풣",
+  "풤",
+  "풥",
+  "풦",
+  "풧",
+  "풨",
+  "풩",
+  "풪",
+  "풫",
+  "풬",
+  "풭",
+  "풮",
+  "풯",
+  "풰",
+  "풱",
+  "풲",
+  "풳",
+  "풴",
+  "풵",
+  "풶",
+  "풷",
+  "풸",
+  "풹",
+  "풺",
+  "풻",
+  "풼",
+  "풽",
+  "풾",
+  "풿",
+  "퓀",
+  "퓁",
+  "퓂",
+  "퓃",
+  "퓄",
+  "퓅",
+  "퓆",
+  "퓇",
+  "퓈",
+  "퓉",
+  "퓊",
+  "퓋",
+  "퓌",
+  "퓍",
+  "퓎",
+  "퓏",
+  "퓐",
+  "퓑",
+  "퓒",
+  "퓓",
+  "퓔",
+  "퓕",
+  "퓖",
+  "퓗",
+  "퓘",
+  "퓙",
+  "퓚",
+  "퓛",
+  "퓜",
+  "퓝",
+  "퓞",
+  "퓟",
+  "퓠",
+  "퓡",
+  "퓢",
+  "퓣",
+  "퓤",
+  "퓥",
+  "퓦",
+  "퓧",
+  "퓨",
+  "퓩",
+  "퓪",
+  "퓫",
+  "퓬",
+  "퓭",
+  "퓮",
+  "퓯",
+  "퓰",
+  "퓱",
+  "퓲",
+  "퓳",
+  "퓴",
+  "퓵",
+  "퓶",
+  "퓷",
+  "퓸",
+  "퓹",
+  "퓺",
+  "퓻",
+  "퓼",
+  "퓽",
+  "퓾",
+  "퓿",
+  "픀",
+  "픁",
+  "픂",
+  "픃",
+  "프",
+  "픅",
+  "픆",
+  "픇",
+  "픈",
+  "픉",
+  "픊",
+  "픋",
+  "플",
+  "픍",
+  "픎",
+  "픏",
+  "픐",
+  "픑",
+  "픒",
+  "픓",
+  "픔",
+  "픕",
+  "픖",
+  "픗",
+  "픘",
+  "픙",
+  "픚",
+  "픛",
+  "픜",
+  "픝",
+  "픞",
+  "픟",
+  "픠",
+  "픡",
+  "픢",
+  "픣",
+  "픤",
+  "픥",
+  "픦",
+  "픧",
+  "픨",
+  "픩",
+  "픪",
+  "픫",
+  "픬",
+  "픭",
+  "픮",
+  "픯",
+  "픰",
+  "픱",
+  "픲",
+  "픳",
+  "픴",
+  "픵",
+  "픶",
+  "픷",
+  "픸",
+  "픹",
+  "픺",
+  "픻",
+  "피",
+  "픽",
+  "픾",
+  "픿",
+  "핀",
+  "핁",
+  "핂",
+  "핃",
+  "필",
+  "핅",
+  "핆",
+  "핇",
+  "핈",
+  "핉",
+  "핊",
+  "핋",
+  "핌",
+  "핍",
+  "핎",
+  "핏",
+  "핐",
+  "핑",
+  "핒",
+  "핓",
+  "핔",
+  "핕",
+  "핖",
+  "핗",
+  "하",
+  "학",
+  "핚",
+  "핛",
+  "한",
+  "핝",
+  "핞",
+  "핟",
+  "할",
+  "핡",
+  "핢",
+  "핣",
+  "핤",
+  "핥",
+  "핦",
+  "핧",
+  "함",
+  "합",
+  "핪",
+  "핫",
+  "핬",
+  "항",
+  "핮",
+  "핯",
+  "핰",
+  "핱",
+  "핲",
+  "핳",
+  "해",
+  "핵",
+  "핶",
+  "핷",
+  "핸",
+  "핹",
+  "핺",
+  "핻",
+  "핼",
+  "핽",
+  "핾",
+  "핿",
+  "햀",
+  "햁",
+  "햂",
+  "햃",
+  "햄",
+  "햅",
+  "햆",
+  "햇",
+  "했",
+  "행",
+  "햊",
+  "햋",
+  "햌",
+  "햍",
+  "햎",
+  "햏",
+  "햐",
+  "햑",
+  "햒",
+  "햓",
+  "햔",
+  "햕",
+  "햖",
+  "햗",
+  "햘",
+  "햙",
+  "햚",
+  "햛",
+  "햜",
+  "햝",
+  "햞",
+  "햟",
+  "햠",
+  "햡",
+  "햢",
+  "햣",
+  "햤",
+  "향",
+  "햦",
+  "햧",
+  "햨",
+  "햩",
+  "햪",
+  "햫",
+  "햬",
+  "햭",
+  "햮",
+  "햯",
+  "햰",
+  "햱",
+  "햲",
+  "햳",
+  "햴",
+  "햵",
+  "햶",
+  "햷",
+  "햸",
+  "햹",
+  "햺",
+  "햻",
+  "햼",
+  "햽",
+  "햾",
+  "햿",
+  "헀",
+  "헁",
+  "헂",
+  "헃",
+  "헄",
+  "헅",
+  "헆",
+  "헇",
+  "허",
+  "헉",
+  "헊",
+  "헋",
+  "헌",
+  "헍",
+  "헎",
+  "헏",
+  "헐",
+  "헑",
+  "헒",
+  "헓",
+  "헔",
+  "헕",
+  "헖",
+  "헗",
+  "험",
+  "헙",
+  "헚",
+  "헛",
+  "헜",
+  "헝",
+  "헞",
+  "헟",
+  "헠",
+  "헡",
+  "헢",
+  "헣",
+  "헤",
+  "헥",
+  "헦",
+  "헧",
+  "헨",
+  "헩",
+  "헪",
+  "헫",
+  "헬",
+  "헭",
+  "헮",
+  "헯",
+  "헰",
+  "헱",
+  "헲",
+  "헳",
+  "헴",
+  "헵",
+  "헶",
+  "헷",
+  "헸",
+  "헹",
+  "헺",
+  "헻",
+  "헼",
+  "헽",
+  "헾",
+  "헿",
+  "혀",
+  "혁",
+  "혂",
+  "혃",
+  "현",
+  "혅",
+  "혆",
+  "혇",
+  "혈",
+  "혉",
+  "혊",
+  "혋",
+  "혌",
+  "혍",
+  "혎",
+  "혏",
+  "혐",
+  "협",
+  "혒",
+  "혓",
+  "혔",
+  "형",
+  "혖",
+  "혗",
+  "혘",
+  "혙",
+  "혚",
+  "혛",
+  "혜",
+  "혝",
+  "혞",
+  "혟",
+  "혠",
+  "혡",
+  "혢",
+  "혣",
+  "혤",
+  "혥",
+  "혦",
+  "혧",
+  "혨",
+  "혩",
+  "혪",
+  "혫",
+  "혬",
+  "혭",
+  "혮",
+  "혯",
+  "혰",
+  "혱",
+  "혲",
+  "혳",
+  "혴",
+  "혵",
+  "혶",
+  "혷",
+  "호",
+  "혹",
+  "혺",
+  "혻",
+  "혼",
+  "혽",
+  "혾",
+  "혿",
+  "홀",
+  "홁",
+  "홂",
+  "홃",
+  "홄",
+  "홅",
+  "홆",
+  "홇",
+  "홈",
+  "홉",
+  "홊",
+  "홋",
+  "홌",
+  "홍",
+  "홎",
+  "홏",
+  "홐",
+  "홑",
+  "홒",
+  "홓",
+  "화",
+  "확",
+  "홖",
+  "홗",
+  "환",
+  "홙",
+  "홚",
+  "홛",
+  "활",
+  "홝",
+  "홞",
+  "홟",
+  "홠",
+  "홡",
+  "홢",
+  "홣",
+  "홤",
+  "홥",
+  "홦",
+  "홧",
+  "홨",
+  "황",
+  "홪",
+  "홫",
+  "홬",
+  "홭",
+  "홮",
+  "홯",
+  "홰",
+  "홱",
+  "홲",
+  "홳",
+  "홴",
+  "홵",
+  "홶",
+  "홷",
+  "홸",
+  "홹",
+  "홺",
+  "홻",
+  "홼",
+  "홽",
+  "홾",
+  "홿",
+  "횀",
+  "횁",
+  "횂",
+  "횃",
+  "횄",
+  "횅",
+  "횆",
+  "횇",
+  "횈",
+  "횉",
+  "횊",
+  "횋",
+  "회",
+  "획",
+  "횎",
+  "횏",
+  "횐",
+  "횑",
+  "횒",
+  "횓",
+  "횔",
+  "횕",
+  "횖",
+  "횗",
+  "횘",
+  "횙",
+  "횚",
+  "횛",
+  "횜",
+  "횝",
+  "횞",
+  "횟",
+  "횠",
+  "횡",
+  "횢",
+  "횣",
+  "횤",
+  "횥",
+  "횦",
+  "횧",
+  "효",
+  "횩",
+  "횪",
+  "횫",
+  "횬",
+  "횭",
+  "횮",
+  "횯",
+  "횰",
+  "횱",
+  "횲",
+  "횳",
+  "횴",
+  "횵",
+  "횶",
+  "횷",
+  "횸",
+  "횹",
+  "횺",
+  "횻",
+  "횼",
+  "횽",
+  "횾",
+  "횿",
+  "훀",
+  "훁",
+  "훂",
+  "훃",
+  "후",
+  "훅",
+  "훆",
+  "훇",
+  "훈",
+  "훉",
+  "훊",
+  "훋",
+  "훌",
+  "훍",
+  "훎",
+  "훏",
+  "훐",
+  "훑",
+  "훒",
+  "훓",
+  "훔",
+  "훕",
+  "훖",
+  "훗",
+  "훘",
+  "훙",
+  "훚",
+  "훛",
+  "훜",
+  "훝",
+  "훞",
+  "훟",
+  "훠",
+  "훡",
+  "훢",
+  "훣",
+  "훤",
+  "훥",
+  "훦",
+  "훧",
+  "훨",
+  "훩",
+  "훪",
+  "훫",
+  "훬",
+  "훭",
+  "훮",
+  "훯",
+  "훰",
+  "훱",
+  "훲",
+  "훳",
+  "훴",
+  "훵",
+  "훶",
+  "훷",
+  "훸",
+  "훹",
+  "훺",
+  "훻",
+  "훼",
+  "훽",
+  "훾",
+  "훿",
+  "휀",
+  "휁",
+  "휂",
+  "휃",
+  "휄",
+  "휅",
+  "휆",
+  "휇",
+  "휈",
+  "휉",
+  "휊",
+  "휋",
+  "휌",
+  "휍",
+  "휎",
+  "휏",
+  "휐",
+  "휑",
+  "휒",
+  "휓",
+  "휔",
+  "휕",
+  "휖",
+  "휗",
+  "휘",
+  "휙",
+  "휚",
+  "휛",
+  "휜",
+  "휝",
+  "휞",
+  "휟",
+  "휠",
+  "휡",
+  "휢",
+  "휣",
+  "휤",
+  "휥",
+  "휦",
+  "휧",
+  "휨",
+  "휩",
+  "휪",
+  "휫",
+  "휬",
+  "휭",
+  "휮",
+  "휯",
+  "휰",
+  "휱",
+  "휲",
+  "휳",
+  "휴",
+  "휵",
+  "휶",
+  "휷",
+  "휸",
+  "휹",
+  "휺",
+  "휻",
+  "휼",
+  "휽",
+  "휾",
+  "휿",
+  "흀",
+  "흁",
+  "흂",
+  "흃",
+  "흄",
+  "흅",
+  "흆",
+  "흇",
+  "흈",
+  "흉",
+  "흊",
+  "흋",
+  "흌",
+  "흍",
+  "흎",
+  "흏",
+  "흐",
+  "흑",
+  "흒",
+  "흓",
+  "흔",
+  "흕",
+  "흖",
+  "흗",
+  "흘",
+  "흙",
+  "흚",
+  "흛",
+  "흜",
+  "흝",
+  "흞",
+  "흟",
+  "흠",
+  "흡",
+  "흢",
+  "흣",
+  "흤",
+  "흥",
+  "흦",
+  "흧",
+  "흨",
+  "흩",
+  "흪",
+  "흫",
+  "희",
+  "흭",
+  "흮",
+  "흯",
+  "흰",
+  "흱",
+  "흲",
+  "흳",
+  "흴",
+  "흵",
+  "흶",
+  "흷",
+  "흸",
+  "흹",
+  "흺",
+  "흻",
+  "흼",
+  "흽",
+  "흾",
+  "흿",
+  "힀",
+  "힁",
+  "힂",
+  "힃",
+  "힄",
+  "힅",
+  "힆",
+  "힇",
+  "히",
+  "힉",
+  "힊",
+  "힋",
+  "힌",
+  "힍",
+  "힎",
+  "힏",
+  "힐",
+  "힑",
+  "힒",
+  "힓",
+  "힔",
+  "힕",
+  "힖",
+  "힗",
+  "힘",
+  "힙",
+  "힚",
+  "힛",
+  "힜",
+  "힝",
+  "힞",
+  "힟",
+  "힠",
+  "힡",
+  "힢",
+  "힣",
+};
+const char *ALPHA_140_LOWER[] = {
+  "가",
+  "각",
+  "갂",
+  "갃",
+  "간",
+  "갅",
+  "갆",
+  "갇",
+  "갈",
+  "갉",
+  "갊",
+  "갋",
+  "갌",
+  "갍",
+  "갎",
+  "갏",
+  "감",
+  "갑",
+  "값",
+  "갓",
+  "갔",
+  "강",
+  "갖",
+  "갗",
+  "갘",
+  "같",
+  "갚",
+  "갛",
+  "개",
+  "객",
+  "갞",
+  "갟",
+  "갠",
+  "갡",
+  "갢",
+  "갣",
+  "갤",
+  "갥",
+  "갦",
+  "갧",
+  "갨",
+  "갩",
+  "갪",
+  "갫",
+  "갬",
+  "갭",
+  "갮",
+  "갯",
+  "갰",
+  "갱",
+  "갲",
+  "갳",
+  "갴",
+  "갵",
+  "갶",
+  "갷",
+  "갸",
+  "갹",
+  "갺",
+  "갻",
+  "갼",
+  "갽",
+  "갾",
+  "갿",
+  "걀",
+  "걁",
+  "걂",
+  "걃",
+  "걄",
+  "걅",
+  "걆",
+  "걇",
+  "걈",
+  "걉",
+  "걊",
+  "걋",
+  "걌",
+  "걍",
+  "걎",
+  "걏",
+  "걐",
+  "걑",
+  "걒",
+  "걓",
+  "걔",
+  "걕",
+  "걖",
+  "걗",
+  "걘",
+  "걙",
+  "걚",
+  "걛",
+  "걜",
+  "걝",
+  "걞",
+  "걟",
+  "걠",
+  "걡",
+  "걢",
+  "걣",
+  "걤",
+  "걥",
+  "걦",
+  "걧",
+  "걨",
+  "걩",
+  "걪",
+  "걫",
+  "걬",
+  "걭",
+  "걮",
+  "걯",
+  "거",
+  "걱",
+  "걲",
+  "걳",
+  "건",
+  "걵",
+  "걶",
+  "걷",
+  "걸",
+  "걹",
+  "걺",
+  "걻",
+  "걼",
+  "걽",
+  "걾",
+  "걿",
+  "검",
+  "겁",
+  "겂",
+  "것",
+  "겄",
+  "겅",
+  "겆",
+  "겇",
+  "겈",
+  "겉",
+  "겊",
+  "겋",
+  "게",
+  "겍",
+  "겎",
+  "겏",
+  "겐",
+  "겑",
+  "겒",
+  "겓",
+  "겔",
+  "겕",
+  "겖",
+  "겗",
+  "겘",
+  "겙",
+  "겚",
+  "겛",
+  "겜",
+  "겝",
+  "겞",
+  "겟",
+  "겠",
+  "겡",
+  "겢",
+  "겣",
+  "겤",
+  "겥",
+  "겦",
+  "겧",
+  "겨",
+  "격",
+  "겪",
+  "겫",
+  "견",
+  "겭",
+  "겮",
+  "겯",
+  "결",
+  "겱",
+  "겲",
+  "겳",
+  "겴",
+  "겵",
+  "겶",
+  "겷",
+  "겸",
+  "겹",
+  "겺",
+  "겻",
+  "겼",
+  "경",
+  "겾",
+  "겿",
+  "곀",
+  "곁",
+  "곂",
+  "곃",
+  "계",
+  "곅",
+  "곆",
+  "곇",
+  "곈",
+  "곉",
+  "곊",
+  "곋",
+  "곌",
+  "곍",
+  "곎",
+  "곏",
+  "곐",
+  "곑",
+  "곒",
+  "곓",
+  "곔",
+  "곕",
+  "곖",
+  "곗",
+  "곘",
+  "곙",
+  "곚",
+  "곛",
+  "곜",
+  "곝",
+  "곞",
+  "곟",
+  "고",
+  "곡",
+  "곢",
+  "곣",
+  "곤",
+  "곥",
+  "곦",
+  "곧",
+  "골",
+  "곩",
+  "곪",
+  "곫",
+  "곬",
+  "곭",
+  "곮",
+  "곯",
+  "곰",
+  "곱",
+  "곲",
+  "곳",
+  "곴",
+  "공",
+  "곶",
+  "곷",
+  "곸",
+  "곹",
+  "곺",
+  "곻",
+  "과",
+  "곽",
+  "곾",
+  "곿",
+  "관",
+  "괁",
+  "괂",
+  "괃",
+  "괄",
+  "괅",
+  "괆",
+  "괇",
+  "괈",
+  "괉",
+  "괊",
+  "괋",
+  "괌",
+  "괍",
+  "괎",
+  "괏",
+  "괐",
+  "광",
+  "괒",
+  "괓",
+  "괔",
+  "괕",
+  "괖",
+  "괗",
+  "괘",
+  "괙",
+  "괚",
+  "괛",
+  "괜",
+  "괝",
+  "괞",
+  "괟",
+  "괠",
+  "괡",
+  "괢",
+  "괣",
+  "괤",
+  "괥",
+  "괦",
+  "괧",
+  "괨",
+  "괩",
+  "괪",
+  "괫",
+  "괬",
+  "괭",
+  "괮",
+  "괯",
+  "괰",
+  "괱",
+  "괲",
+  "괳",
+  "괴",
+  "괵",
+  "괶",
+  "괷",
+  "괸",
+  "괹",
+  "괺",
+  "괻",
+  "괼",
+  "괽",
+  "괾",
+  "괿",
+  "굀",
+  "굁",
+  "굂",
+  "굃",
+  "굄",
+  "굅",
+  "굆",
+  "굇",
+  "굈",
+  "굉",
+  "굊",
+  "굋",
+  "굌",
+  "굍",
+  "굎",
+  "굏",
+  "교",
+  "굑",
+  "굒",
+  "굓",
+  "굔",
+  "굕",
+  "굖",
+  "굗",
+  "굘",
+  "굙",
+  "굚",
+  "굛",
+  "굜",
+  "굝",
+  "굞",
+  "굟",
+  "굠",
+  "굡",
+  "굢",
+  "굣",
+  "굤",
+  "굥",
+  "굦",
+  "굧",
+  "굨",
+  "굩",
+  "굪",
+  "굫",
+  "구",
+  "국",
+  "굮",
+  "굯",
+  "군",
+  "굱",
+  "굲",
+  "굳",
+  "굴",
+  "굵",
+  "굶",
+  "굷",
+  "굸",
+  "굹",
+  "굺",
+  "굻",
+  "굼",
+  "굽",
+  "굾",
+  "굿",
+  "궀",
+  "궁",
+  "궂",
+  "궃",
+  "궄",
+  "궅",
+  "궆",
+  "궇",
+  "궈",
+  "궉",
+  "궊",
+  "궋",
+  "권",
+  "궍",
+  "궎",
+  "궏",
+  "궐",
+  "궑",
+  "궒",
+  "궓",
+  "궔",
+  "궕",
+  "궖",
+  "궗",
+  "궘",
+  "궙",
+  "궚",
+  "궛",
+  "궜",
+  "궝",
+  "궞",
+  "궟",
+  "궠",
+  "궡",
+  "궢",
+  "궣",
+  "궤",
+  "궥",
+  "궦",
+  "궧",
+  "궨",
+  "궩",
+  "궪",
+  "궫",
+  "궬",
+  "궭",
+  "궮",
+  "궯",
+  "궰",
+  "궱",
+  "궲",
+  "궳",
+  "궴",
+  "궵",
+  "궶",
+  "궷",
+  "궸",
+  "궹",
+  "궺",
+  "궻",
+  "궼",
+  "궽",
+  "궾",
+  "궿",
+  "귀",
+  "귁",
+  "귂",
+  "귃",
+  "귄",
+  "귅",
+  "귆",
+  "귇",
+  "귈",
+  "귉",
+  "귊",
+  "귋",
+  "귌",
+  "귍",
+  "귎",
+  "귏",
+  "귐",
+  "귑",
+  "귒",
+  "귓",
+  "귔",
+  "귕",
+  "귖",
+  "귗",
+  "귘",
+  "귙",
+  "귚",
+  "귛",
+  "규",
+  "귝",
+  "귞",
+  "귟",
+  "균",
+  "귡",
+  "귢",
+  "귣",
+  "귤",
+  "귥",
+  "귦",
+  "귧",
+  "귨",
+  "귩",
+  "귪",
+  "귫",
+  "귬",
+  "귭",
+  "귮",
+  "귯",
+  "귰",
+  "귱",
+  "귲",
+  "귳",
+  "귴",
+  "귵",
+  "귶",
+  "귷",
+  "그",
+  "극",
+  "귺",
+  "귻",
+  "근",
+  "귽",
+  "귾",
+  "귿",
+  "글",
+  "긁",
+  "긂",
+  "긃",
+  "긄",
+  "긅",
+  "긆",
+  "긇",
+  "금",
+  "급",
+  "긊",
+  "긋",
+  "긌",
+  "긍",
+  "긎",
+  "긏",
+  "긐",
+  "긑",
+  "긒",
+  "긓",
+  "긔",
+  "긕",
+  "긖",
+  "긗",
+  "긘",
+  "긙",
+  "긚",
+  "긛",
+  "긜",
+  "긝",
+  "긞",
+  "긟",
+  "긠",
+  "긡",
+  "긢",
+  "긣",
+  "긤",
+  "긥",
+  "긦",
+  "긧",
+  "긨",
+  "긩",
+  "긪",
+  "긫",
+  "긬",
+  "긭",
+  "긮",
+  "긯",
+  "기",
+  "긱",
+  "긲",
+  "긳",
+  "긴",
+  "긵",
+  "긶",
+  "긷",
+  "길",
+  "긹",
+  "긺",
+  "긻",
+  "긼",
+  "긽",
+  "긾",
+  "긿",
+  "김",
+  "깁",
+  "깂",
+  "깃",
+  "깄",
+  "깅",
+  "깆",
+  "깇",
+  "깈",
+  "깉",
+  "깊",
+  "깋",
+  "까",
+  "깍",
+  "깎",
+  "깏",
+  "깐",
+  "깑",
+  "깒",
+  "깓",
+  "깔",
+  "깕",
+  "깖",
+  "깗",
+  "깘",
+  "깙",
+  "깚",
+  "깛",
+  "깜",
+  "깝",
+  "깞",
+  "깟",
+  "깠",
+  "깡",
+  "깢",
+  "깣",
+  "깤",
+  "깥",
+  "깦",
+  "깧",
+  "깨",
+  "깩",
+  "깪",
+  "깫",
+  "깬",
+  "깭",
+  "깮",
+  "깯",
+  "깰",
+  "깱",
+  "깲",
+  "깳",
+  "깴",
+  "깵",
+  "깶",
+  "깷",
+  "깸",
+  "깹",
+  "깺",
+  "깻",
+  "깼",
+  "깽",
+  "깾",
+  "깿",
+  "꺀",
+  "꺁",
+  "꺂",
+  "꺃",
+  "꺄",
+  "꺅",
+  "꺆",
+  "꺇",
+  "꺈",
+  "꺉",
+  "꺊",
+  "꺋",
+  "꺌",
+  "꺍",
+  "꺎",
+  "꺏",
+  "꺐",
+  "꺑",
+  "꺒",
+  "꺓",
+  "꺔",
+  "꺕",
+  "꺖",
+  "꺗",
+  "꺘",
+  "꺙",
+  "꺚",
+  "꺛",
+  "꺜",
+  "꺝",
+  "꺞",
+  "꺟",
+  "꺠",
+  "꺡",
+  "꺢",
+  "꺣",
+  "꺤",
+  "꺥",
+  "꺦",
+  "꺧",
+  "꺨",
+  "꺩",
+  "꺪",
+  "꺫",
+  "꺬",
+  "꺭",
+  "꺮",
+  "꺯",
+  "꺰",
+  "꺱",
+  "꺲",
+  "꺳",
+  "꺴",
+  "꺵",
+  "꺶",
+  "꺷",
+  "꺸",
+  "꺹",
+  "꺺",
+  "꺻",
+  "꺼",
+  "꺽",
+  "꺾",
+  "꺿",
+  "껀",
+  "껁",
+  "껂",
+  "껃",
+  "껄",
+  "껅",
+  "껆",
+  "껇",
+  "껈",
+  "껉",
+  "껊",
+  "껋",
+  "껌",
+  "껍",
+  "껎",
+  "껏",
+  "껐",
+  "껑",
+  "껒",
+  "껓",
+  "껔",
+  "껕",
+  "껖",
+  "껗",
+  "께",
+  "껙",
+  "껚",
+  "껛",
+  "껜",
+  "껝",
+  "껞",
+  "껟",
+  "껠",
+  "껡",
+  "껢",
+  "껣",
+  "껤",
+  "껥",
+  "껦",
+  "껧",
+  "껨",
+  "껩",
+  "껪",
+  "껫",
+  "껬",
+  "껭",
+  "껮",
+  "껯",
+  "껰",
+  "껱",
+  "껲",
+  "껳",
+  "껴",
+  "껵",
+  "껶",
+  "껷",
+  "껸",
+  "껹",
+  "껺",
+  "껻",
+  "껼",
+  "껽",
+  "껾",
+  "껿",
+  "꼀",
+  "꼁",
+  "꼂",
+  "꼃",
+  "꼄",
+  "꼅",
+  "꼆",
+  "꼇",
+  "꼈",
+  "꼉",
+  "꼊",
+  "꼋",
+  "꼌",
+  "꼍",
+  "꼎",
+  "꼏",
+  "꼐",
+  "꼑",
+  "꼒",
+  "꼓",
+  "꼔",
+  "꼕",
+  "꼖",
+  "꼗",
+  "꼘",
+  "꼙",
+  "꼚",
+  "꼛",
+  "꼜",
+  "꼝",
+  "꼞",
+  "꼟",
+  "꼠",
+  "꼡",
+  "꼢",
+  "꼣",
+  "꼤",
+  "꼥",
+  "꼦",
+  "꼧",
+  "꼨",
+  "꼩",
+  "꼪",
+  "꼫",
+  "꼬",
+  "꼭",
+  "꼮",
+  "꼯",
+  "꼰",
+  "꼱",
+  "꼲",
+  "꼳",
+  "꼴",
+  "꼵",
+  "꼶",
+  "꼷",
+  "꼸",
+  "꼹",
+  "꼺",
+  "꼻",
+  "꼼",
+  "꼽",
+  "꼾",
+  "꼿",
+  "꽀",
+  "꽁",
+  "꽂",
+  "꽃",
+  "꽄",
+  "꽅",
+  "꽆",
+  "꽇",
+  "꽈",
+  "꽉",
+  "꽊",
+  "꽋",
+  "꽌",
+  "꽍",
+  "꽎",
+  "꽏",
+  "꽐",
+  "꽑",
+  "꽒",
+  "꽓",
+  "꽔",
+  "꽕",
+  "꽖",
+  "꽗",
+  "꽘",
+  "꽙",
+  "꽚",
+  "꽛",
+  "꽜",
+  "꽝",
+  "꽞",
+  "꽟",
+  "꽠",
+  "꽡",
+  "꽢",
+  "꽣",
+  "꽤",
+  "꽥",
+  "꽦",
+  "꽧",
+  "꽨",
+  "꽩",
+  "꽪",
+  "꽫",
+  "꽬",
+  "꽭",
+  "꽮",
+  "꽯",
+  "꽰",
+  "꽱",
+  "꽲",
+  "꽳",
+  "꽴",
+  "꽵",
+  "꽶",
+  "꽷",
+  "꽸",
+  "꽹",
+  "꽺",
+  "꽻",
+  "꽼",
+  "꽽",
+  "꽾",
+  "꽿",
+  "꾀",
+  "꾁",
+  "꾂",
+  "꾃",
+  "꾄",
+  "꾅",
+  "꾆",
+  "꾇",
+  "꾈",
+  "꾉",
+  "꾊",
+  "꾋",
+  "꾌",
+  "꾍",
+  "꾎",
+  "꾏",
+  "꾐",
+  "꾑",
+  "꾒",
+  "꾓",
+  "꾔",
+  "꾕",
+  "꾖",
+  "꾗",
+  "꾘",
+  "꾙",
+  "꾚",
+  "꾛",
+  "꾜",
+  "꾝",
+  "꾞",
+  "꾟",
+  "꾠",
+  "꾡",
+  "꾢",
+  "꾣",
+  "꾤",
+  "꾥",
+  "꾦",
+  "꾧",
+  "꾨",
+  "꾩",
+  "꾪",
+  "꾫",
+  "꾬",
+  "꾭",
+  "꾮",
+  "꾯",
+  "꾰",
+  "꾱",
+  "꾲",
+  "꾳",
+  "꾴",
+  "꾵",
+  "꾶",
+  "꾷",
+  "꾸",
+  "꾹",
+  "꾺",
+  "꾻",
+  "꾼",
+  "꾽",
+  "꾾",
+  "꾿",
+  "꿀",
+  "꿁",
+  "꿂",
+  "꿃",
+  "꿄",
+  "꿅",
+  "꿆",
+  "꿇",
+  "꿈",
+  "꿉",
+  "꿊",
+  "꿋",
+  "꿌",
+  "꿍",
+  "꿎",
+  "꿏",
+  "꿐",
+  "꿑",
+  "꿒",
+  "꿓",
+  "꿔",
+  "꿕",
+  "꿖",
+  "꿗",
+  "꿘",
+  "꿙",
+  "꿚",
+  "꿛",
+  "꿜",
+  "꿝",
+  "꿞",
+  "꿟",
+  "꿠",
+  "꿡",
+  "꿢",
+  "꿣",
+  "꿤",
+  "꿥",
+  "꿦",
+  "꿧",
+  "꿨",
+  "꿩",
+  "꿪",
+  "꿫",
+  "꿬",
+  "꿭",
+  "꿮",
+  "꿯",
+  "꿰",
+  "꿱",
+  "꿲",
+  "꿳",
+  "꿴",
+  "꿵",
+  "꿶",
+  "꿷",
+  "꿸",
+  "꿹",
+  "꿺",
+  "꿻",
+  "꿼",
+  "꿽",
+  "꿾",
+  "꿿",
+  "뀀",
+  "뀁",
+  "뀂",
+  "뀃",
+  "뀄",
+  "뀅",
+  "뀆",
+  "뀇",
+  "뀈",
+  "뀉",
+  "뀊",
+  "뀋",
+  "뀌",
+  "뀍",
+  "뀎",
+  "뀏",
+  "뀐",
+  "뀑",
+  "뀒",
+  "뀓",
+  "뀔",
+  "뀕",
+  "뀖",
+  "뀗",
+  "뀘",
+  "뀙",
+  "뀚",
+  "뀛",
+  "뀜",
+  "뀝",
+  "뀞",
+  "뀟",
+  "뀠",
+  "뀡",
+  "뀢",
+  "뀣",
+  "뀤",
+  "뀥",
+  "뀦",
+  "뀧",
+  "뀨",
+  "뀩",
+  "뀪",
+  "뀫",
+  "뀬",
+  "뀭",
+  "뀮",
+  "뀯",
+  "뀰",
+  "뀱",
+  "뀲",
+  "뀳",
+  "뀴",
+  "뀵",
+  "뀶",
+  "뀷",
+  "뀸",
+  "뀹",
+  "뀺",
+  "뀻",
+  "뀼",
+  "뀽",
+  "뀾",
+  "뀿",
+  "끀",
+  "끁",
+  "끂",
+  "끃",
+  "끄",
+  "끅",
+  "끆",
+  "끇",
+  "끈",
+  "끉",
+  "끊",
+  "끋",
+  "끌",
+  "끍",
+  "끎",
+  "끏",
+  "끐",
+  "끑",
+  "끒",
+  "끓",
+  "끔",
+  "끕",
+  "끖",
+  "끗",
+  "끘",
+  "끙",
+  "끚",
+  "끛",
+  "끜",
+  "끝",
+  "끞",
+  "끟",
+  "끠",
+  "끡",
+  "끢",
+  "끣",
+  "끤",
+  "끥",
+  "끦",
+  "끧",
+  "끨",
+  "끩",
+  "끪",
+  "끫",
+  "끬",
+  "끭",
+  "끮",
+  "끯",
+  "끰",
+  "끱",
+  "끲",
+  "끳",
+  "끴",
+  "끵",
+  "끶",
+  "끷",
+  "끸",
+  "끹",
+  "끺",
+  "끻",
+  "끼",
+  "끽",
+  "끾",
+  "끿",
+  "낀",
+  "낁",
+  "낂",
+  "낃",
+  "낄",
+  "낅",
+  "낆",
+  "낇",
+  "낈",
+  "낉",
+  "낊",
+  "낋",
+  "낌",
+  "낍",
+  "낎",
+  "낏",
+  "낐",
+  "낑",
+  "낒",
+  "낓",
+  "낔",
+  "낕",
+  "낖",
+  "낗",
+  "나",
+  "낙",
+  "낚",
+  "낛",
+  "난",
+  "낝",
+  "낞",
+  "낟",
+  "날",
+  "낡",
+  "낢",
+  "낣",
+  "낤",
+  "낥",
+  "낦",
+  "낧",
+  "남",
+  "납",
+  "낪",
+  "낫",
+  "났",
+  "낭",
+  "낮",
+  "낯",
+  "낰",
+  "낱",
+  "낲",
+  "낳",
+  "내",
+  "낵",
+  "낶",
+  "낷",
+  "낸",
+  "낹",
+  "낺",
+  "낻",
+  "낼",
+  "낽",
+  "낾",
+  "낿",
+  "냀",
+  "냁",
+  "냂",
+  "냃",
+  "냄",
+  "냅",
+  "냆",
+  "냇",
+  "냈",
+  "냉",
+  "냊",
+  "냋",
+  "냌",
+  "냍",
+  "냎",
+  "냏",
+  "냐",
+  "냑",
+  "냒",
+  "냓",
+  "냔",
+  "냕",
+  "냖",
+  "냗",
+  "냘",
+  "냙",
+  "냚",
+  "냛",
+  "냜",
+  "냝",
+  "냞",
+  "냟",
+  "냠",
+  "냡",
+  "냢",
+  "냣",
+  "냤",
+  "냥",
+  "냦",
+  "냧",
+  "냨",
+  "냩",
+  "냪",
+  "냫",
+  "냬",
+  "냭",
+  "냮",
+  "냯",
+  "냰",
+  "냱",
+  "냲",
+  "냳",
+  "냴",
+  "냵",
+  "냶",
+  "냷",
+  "냸",
+  "냹",
+  "냺",
+  "냻",
+  "냼",
+  "냽",
+  "냾",
+  "냿",
+  "넀",
+  "넁",
+  "넂",
+  "넃",
+  "넄",
+  "넅",
+  "넆",
+  "넇",
+  "너",
+  "넉",
+  "넊",
+  "넋",
+  "넌",
+  "넍",
+  "넎",
+  "넏",
+  "널",
+  "넑",
+  "넒",
+  "넓",
+  "넔",
+  "넕",
+  "넖",
+  "넗",
+  "넘",
+  "넙",
+  "넚",
+  "넛",
+  "넜",
+  "넝",
+  "넞",
+  "넟",
+  "넠",
+  "넡",
+  "넢",
+  "넣",
+  "네",
+  "넥",
+  "넦",
+  "넧",
+  "넨",
+  "넩",
+  "넪",
+  "넫",
+  "넬",
+  "넭",
+  "넮",
+  "넯",
+  "넰",
+  "넱",
+  "넲",
+  "넳",
+  "넴",
+  "넵",
+  "넶",
+  "넷",
+  "넸",
+  "넹",
+  "넺",
+  "넻",
+  "넼",
+  "넽",
+  "넾",
+  "넿",
+  "녀",
+  "녁",
+  "녂",
+  "녃",
+  "년",
+  "녅",
+  "녆",
+  "녇",
+  "녈",
+  "녉",
+  "녊",
+  "녋",
+  "녌",
+  "녍",
+  "녎",
+  "녏",
+  "념",
+  "녑",
+  "녒",
+  "녓",
+  "녔",
+  "녕",
+  "녖",
+  "녗",
+  "녘",
+  "녙",
+  "녚",
+  "녛",
+  "녜",
+  "녝",
+  "녞",
+  "녟",
+  "녠",
+  "녡",
+  "녢",
+  "녣",
+  "녤",
+  "녥",
+  "녦",
+  "녧",
+  "녨",
+  "녩",
+  "녪",
+  "녫",
+  "녬",
+  "녭",
+  "녮",
+  "녯",
+  "녰",
+  "녱",
+  "녲",
+  "녳",
+  "녴",
+  "녵",
+  "녶",
+  "녷",
+  "노",
+  "녹",
+  "녺",
+  "녻",
+  "논",
+  "녽",
+  "녾",
+  "녿",
+  "놀",
+  "놁",
+  "놂",
+  "놃",
+  "놄",
+  "놅",
+  "놆",
+  "놇",
+  "놈",
+  "놉",
+  "놊",
+  "놋",
+  "놌",
+  "농",
+  "놎",
+  "놏",
+  "놐",
+  "놑",
+  "높",
+  "놓",
+  "놔",
+  "놕",
+  "놖",
+  "놗",
+  "놘",
+  "놙",
+  "놚",
+  "놛",
+  "놜",
+  "놝",
+  "놞",
+  "놟",
+  "놠",
+  "놡",
+  "놢",
+  "놣",
+  "놤",
+  "놥",
+  "놦",
+  "놧",
+  "놨",
+  "놩",
+  "놪",
+  "놫",
+  "놬",
+  "놭",
+  "놮",
+  "놯",
+  "놰",
+  "놱",
+  "놲",
+  "놳",
+  "놴",
+  "놵",
+  "놶",
+  "놷",
+  "놸",
+  "놹",
+  "놺",
+  "놻",
+  "놼",
+  "놽",
+  "놾",
+  "놿",
+  "뇀",
+  "뇁",
+  "뇂",
+  "뇃",
+  "뇄",
+  "뇅",
+  "뇆",
+  "뇇",
+  "뇈",
+  "뇉",
+  "뇊",
+  "뇋",
+  "뇌",
+  "뇍",
+  "뇎",
+  "뇏",
+  "뇐",
+  "뇑",
+  "뇒",
+  "뇓",
+  "뇔",
+  "뇕",
+  "뇖",
+  "뇗",
+  "뇘",
+  "뇙",
+  "뇚",
+  "뇛",
+  "뇜",
+  "뇝",
+  "뇞",
+  "뇟",
+  "뇠",
+  "뇡",
+  "뇢",
+  "뇣",
+  "뇤",
+  "뇥",
+  "뇦",
+  "뇧",
+  "뇨",
+  "뇩",
+  "뇪",
+  "뇫",
+  "뇬",
+  "뇭",
+  "뇮",
+  "뇯",
+  "뇰",
+  "뇱",
+  "뇲",
+  "뇳",
+  "뇴",
+  "뇵",
+  "뇶",
+  "뇷",
+  "뇸",
+  "뇹",
+  "뇺",
+  "뇻",
+  "뇼",
+  "뇽",
+  "뇾",
+  "뇿",
+  "눀",
+  "눁",
+  "눂",
+  "눃",
+  "누",
+  "눅",
+  "눆",
+  "눇",
+  "눈",
+  "눉",
+  "눊",
+  "눋",
+  "눌",
+  "눍",
+  "눎",
+  "눏",
+  "눐",
+  "눑",
+  "눒",
+  "눓",
+  "눔",
+  "눕",
+  "눖",
+  "눗",
+  "눘",
+  "눙",
+  "눚",
+  "눛",
+  "눜",
+  "눝",
+  "눞",
+  "눟",
+  "눠",
+  "눡",
+  "눢",
+  "눣",
+  "눤",
+  "눥",
+  "눦",
+  "눧",
+  "눨",
+  "눩",
+  "눪",
+  "눫",
+  "눬",
+  "눭",
+  "눮",
+  "눯",
+  "눰",
+  "눱",
+  "눲",
+  "눳",
+  "눴",
+  "눵",
+  "눶",
+  "눷",
+  "눸",
+  "눹",
+  "눺",
+  "눻",
+  "눼",
+  "눽",
+  "눾",
+  "눿",
+  "뉀",
+  "뉁",
+  "뉂",
+  "뉃",
+  "뉄",
+  "뉅",
+  "뉆",
+  "뉇",
+  "뉈",
+  "뉉",
+  "뉊",
+  "뉋",
+  "뉌",
+  "뉍",
+  "뉎",
+  "뉏",
+  "뉐",
+  "뉑",
+  "뉒",
+  "뉓",
+  "뉔",
+  "뉕",
+  "뉖",
+  "뉗",
+  "뉘",
+  "뉙",
+  "뉚",
+  "뉛",
+  "뉜",
+  "뉝",
+  "뉞",
+  "뉟",
+  "뉠",
+  "뉡",
+  "뉢",
+  "뉣",
+  "뉤",
+  "뉥",
+  "뉦",
+  "뉧",
+  "뉨",
+  "뉩",
+  "뉪",
+  "뉫",
+  "뉬",
+  "뉭",
+  "뉮",
+  "뉯",
+  "뉰",
+  "뉱",
+  "뉲",
+  "뉳",
+  "뉴",
+  "뉵",
+  "뉶",
+  "뉷",
+  "뉸",
+  "뉹",
+  "뉺",
+  "뉻",
+  "뉼",
+  "뉽",
+  "뉾",
+  "뉿",
+  "늀",
+  "늁",
+  "늂",
+  "늃",
+  "늄",
+  "늅",
+  "늆",
+  "늇",
+  "늈",
+  "늉",
+  "늊",
+  "늋",
+  "늌",
+  "늍",
+  "늎",
+  "늏",
+  "느",
+  "늑",
+  "늒",
+  "늓",
+  "는",
+  "늕",
+  "늖",
+  "늗",
+  "늘",
+  "늙",
+  "늚",
+  "늛",
+  "늜",
+  "늝",
+  "늞",
+  "늟",
+  "늠",
+  "늡",
+  "늢",
+  "늣",
+  "늤",
+  "능",
+  "늦",
+  "늧",
+  "늨",
+  "늩",
+  "늪",
+  "늫",
+  "늬",
+  "늭",
+  "늮",
+  "늯",
+  "늰",
+  "늱",
+  "늲",
+  "늳",
+  "늴",
+  "늵",
+  "늶",
+  "늷",
+  "늸",
+  "늹",
+  "늺",
+  "늻",
+  "늼",
+  "늽",
+  "늾",
+  "늿",
+  "닀",
+  "닁",
+  "닂",
+  "닃",
+  "닄",
+  "닅",
+  "닆",
+  "닇",
+  "니",
+  "닉",
+  "닊",
+  "닋",
+  "닌",
+  "닍",
+  "닎",
+  "닏",
+  "닐",
+  "닑",
+  "닒",
+  "닓",
+  "닔",
+  "닕",
+  "닖",
+  "닗",
+  "님",
+  "닙",
+  "닚",
+  "닛",
+  "닜",
+  "닝",
+  "닞",
+  "닟",
+  "닠",
+  "닡",
+  "닢",
+  "닣",
+  "다",
+  "닥",
+  "닦",
+  "닧",
+  "단",
+  "닩",
+  "닪",
+  "닫",
+  "달",
+  "닭",
+  "닮",
+  "닯",
+  "닰",
+  "닱",
+  "닲",
+  "닳",
+  "담",
+  "답",
+  "닶",
+  "닷",
+  "닸",
+  "당",
+  "닺",
+  "닻",
+  "닼",
+  "닽",
+  "닾",
+  "닿",
+  "대",
+  "댁",
+  "댂",
+  "댃",
+  "댄",
+  "댅",
+  "댆",
+  "댇",
+  "댈",
+  "댉",
+  "댊",
+  "댋",
+  "댌",
+  "댍",
+  "댎",
+  "댏",
+  "댐",
+  "댑",
+  "댒",
+  "댓",
+  "댔",
+  "댕",
+  "댖",
+  "댗",
+  "댘",
+  "댙",
+  "댚",
+  "댛",
+  "댜",
+  "댝",
+  "댞",
+  "댟",
+  "댠",
+  "댡",
+  "댢",
+  "댣",
+  "댤",
+  "댥",
+  "댦",
+  "댧",
+  "댨",
+  "댩",
+  "댪",
+  "댫",
+  "댬",
+  "댭",
+  "댮",
+  "댯",
+  "댰",
+  "댱",
+  "댲",
+  "댳",
+  "댴",
+  "댵",
+  "댶",
+  "댷",
+  "댸",
+  "댹",
+  "댺",
+  "댻",
+  "댼",
+  "댽",
+  "댾",
+  "댿",
+  "덀",
+  "덁",
+  "덂",
+  "덃",
+  "덄",
+  "덅",
+  "덆",
+  "덇",
+  "덈",
+  "덉",
+  "덊",
+  "덋",
+  "덌",
+  "덍",
+  "덎",
+  "덏",
+  "덐",
+  "덑",
+  "덒",
+  "덓",
+  "더",
+  "덕",
+  "덖",
+  "덗",
+  "던",
+  "덙",
+  "덚",
+  "덛",
+  "덜",
+  "덝",
+  "덞",
+  "덟",
+  "덠",
+  "덡",
+  "덢",
+  "덣",
+  "덤",
+  "덥",
+  "덦",
+  "덧",
+  "덨",
+  "덩",
+  "덪",
+  "덫",
+  "덬",
+  "덭",
+  "덮",
+  "덯",
+  "데",
+  "덱",
+  "덲",
+  "덳",
+  "덴",
+  "덵",
+  "덶",
+  "덷",
+  "델",
+  "덹",
+  "덺",
+  "덻",
+  "덼",
+  "덽",
+  "덾",
+  "덿",
+  "뎀",
+  "뎁",
+  "뎂",
+  "뎃",
+  "뎄",
+  "뎅",
+  "뎆",
+  "뎇",
+  "뎈",
+  "뎉",
+  "뎊",
+  "뎋",
+  "뎌",
+  "뎍",
+  "뎎",
+  "뎏",
+  "뎐",
+  "뎑",
+  "뎒",
+  "뎓",
+  "뎔",
+  "뎕",
+  "뎖",
+  "뎗",
+  "뎘",
+  "뎙",
+  "뎚",
+  "뎛",
+  "뎜",
+  "뎝",
+  "뎞",
+  "뎟",
+  "뎠",
+  "뎡",
+  "뎢",
+  "뎣",
+  "뎤",
+  "뎥",
+  "뎦",
+  "뎧",
+  "뎨",
+  "뎩",
+  "뎪",
+  "뎫",
+  "뎬",
+  "뎭",
+  "뎮",
+  "뎯",
+  "뎰",
+  "뎱",
+  "뎲",
+  "뎳",
+  "뎴",
+  "뎵",
+  "뎶",
+  "뎷",
+  "뎸",
+  "뎹",
+  "뎺",
+  "뎻",
+  "뎼",
+  "뎽",
+  "뎾",
+  "뎿",
+  "돀",
+  "돁",
+  "돂",
+  "돃",
+  "도",
+  "독",
+  "돆",
+  "돇",
+  "돈",
+  "돉",
+  "돊",
+  "돋",
+  "돌",
+  "돍",
+  "돎",
+  "돏",
+  "돐",
+  "돑",
+  "돒",
+  "돓",
+  "돔",
+  "돕",
+  "돖",
+  "돗",
+  "돘",
+  "동",
+  "돚",
+  "돛",
+  "돜",
+  "돝",
+  "돞",
+  "돟",
+  "돠",
+  "돡",
+  "돢",
+  "돣",
+  "돤",
+  "돥",
+  "돦",
+  "돧",
+  "돨",
+  "돩",
+  "돪",
+  "돫",
+  "돬",
+  "돭",
+  "돮",
+  "돯",
+  "돰",
+  "돱",
+  "돲",
+  "돳",
+  "돴",
+  "돵",
+  "돶",
+  "돷",
+  "돸",
+  "돹",
+  "돺",
+  "돻",
+  "돼",
+  "돽",
+  "돾",
+  "돿",
+  "됀",
+  "됁",
+  "됂",
+  "됃",
+  "됄",
+  "됅",
+  "됆",
+  "됇",
+  "됈",
+  "됉",
+  "됊",
+  "됋",
+  "됌",
+  "됍",
+  "됎",
+  "됏",
+  "됐",
+  "됑",
+  "됒",
+  "됓",
+  "됔",
+  "됕",
+  "됖",
+  "됗",
+  "되",
+  "됙",
+  "됚",
+  "됛",
+  "된",
+  "됝",
+  "됞",
+  "됟",
+  "될",
+  "됡",
+  "됢",
+  "됣",
+  "됤",
+  "됥",
+  "됦",
+  "됧",
+  "됨",
+  "됩",
+  "됪",
+  "됫",
+  "됬",
+  "됭",
+  "됮",
+  "됯",
+  "됰",
+  "됱",
+  "됲",
+  "됳",
+  "됴",
+  "됵",
+  "됶",
+  "됷",
+  "됸",
+  "됹",
+  "됺",
+  "됻",
+  "됼",
+  "됽",
+  "됾",
+  "됿",
+  "둀",
+  "둁",
+  "둂",
+  "둃",
+  "둄",
+  "둅",
+  "둆",
+  "둇",
+  "둈",
+  "둉",
+  "둊",
+  "둋",
+  "둌",
+  "둍",
+  "둎",
+  "둏",
+  "두",
+  "둑",
+  "둒",
+  "둓",
+  "둔",
+  "둕",
+  "둖",
+  "둗",
+  "둘",
+  "둙",
+  "둚",
+  "둛",
+  "둜",
+  "둝",
+  "둞",
+  "둟",
+  "둠",
+  "둡",
+  "둢",
+  "둣",
+  "둤",
+  "둥",
+  "둦",
+  "둧",
+  "둨",
+  "둩",
+  "둪",
+  "둫",
+  "둬",
+  "둭",
+  "둮",
+  "둯",
+  "둰",
+  "둱",
+  "둲",
+  "둳",
+  "둴",
+  "둵",
+  "둶",
+  "둷",
+  "둸",
+  "둹",
+  "둺",
+  "둻",
+  "둼",
+  "둽",
+  "둾",
+  "둿",
+  "뒀",
+  "뒁",
+  "뒂",
+  "뒃",
+  "뒄",
+  "뒅",
+  "뒆",
+  "뒇",
+  "뒈",
+  "뒉",
+  "뒊",
+  "뒋",
+  "뒌",
+  "뒍",
+  "뒎",
+  "뒏",
+  "뒐",
+  "뒑",
+  "뒒",
+  "뒓",
+  "뒔",
+  "뒕",
+  "뒖",
+  "뒗",
+  "뒘",
+  "뒙",
+  "뒚",
+  "뒛",
+  "뒜",
+  "뒝",
+  "뒞",
+  "뒟",
+  "뒠",
+  "뒡",
+  "뒢",
+  "뒣",
+  "뒤",
+  "뒥",
+  "뒦",
+  "뒧",
+  "뒨",
+  "뒩",
+  "뒪",
+  "뒫",
+  "뒬",
+  "뒭",
+  "뒮",
+  "뒯",
+  "뒰",
+  "뒱",
+  "뒲",
+  "뒳",
+  "뒴",
+  "뒵",
+  "뒶",
+  "뒷",
+  "뒸",
+  "뒹",
+  "뒺",
+  "뒻",
+  "뒼",
+  "뒽",
+  "뒾",
+  "뒿",
+  "듀",
+  "듁",
+  "듂",
+  "듃",
+  "듄",
+  "듅",
+  "듆",
+  "듇",
+  "듈",
+  "듉",
+  "듊",
+  "듋",
+  "듌",
+  "듍",
+  "듎",
+  "듏",
+  "듐",
+  "듑",
+  "듒",
+  "듓",
+  "듔",
+  "듕",
+  "듖",
+  "듗",
+  "듘",
+  "듙",
+  "듚",
+  "듛",
+  "드",
+  "득",
+  "듞",
+  "듟",
+  "든",
+  "듡",
+  "듢",
+  "듣",
+  "들",
+  "듥",
+  "듦",
+  "듧",
+  "듨",
+  "듩",
+  "듪",
+  "듫",
+  "듬",
+  "듭",
+  "듮",
+  "듯",
+  "듰",
+  "등",
+  "듲",
+  "듳",
+  "듴",
+  "듵",
+  "듶",
+  "듷",
+  "듸",
+  "듹",
+  "듺",
+  "듻",
+  "듼",
+  "듽",
+  "듾",
+  "듿",
+  "딀",
+  "딁",
+  "딂",
+  "딃",
+  "딄",
+  "딅",
+  "딆",
+  "딇",
+  "딈",
+  "딉",
+  "딊",
+  "딋",
+  "딌",
+  "딍",
+  "딎",
+  "딏",
+  "딐",
+  "딑",
+  "딒",
+  "딓",
+  "디",
+  "딕",
+  "딖",
+  "딗",
+  "딘",
+  "딙",
+  "딚",
+  "딛",
+  "딜",
+  "딝",
+  "딞",
+  "딟",
+  "딠",
+  "딡",
+  "딢",
+  "딣",
+  "딤",
+  "딥",
+  "딦",
+  "딧",
+  "딨",
+  "딩",
+  "딪",
+  "딫",
+  "딬",
+  "딭",
+  "딮",
+  "딯",
+  "따",
+  "딱",
+  "딲",
+  "딳",
+  "딴",
+  "딵",
+  "딶",
+  "딷",
+  "딸",
+  "딹",
+  "딺",
+  "딻",
+  "딼",
+  "딽",
+  "딾",
+  "딿",
+  "땀",
+  "땁",
+  "땂",
+  "땃",
+  "땄",
+  "땅",
+  "땆",
+  "땇",
+  "땈",
+  "땉",
+  "땊",
+  "땋",
+  "때",
+  "땍",
+  "땎",
+  "땏",
+  "땐",
+  "땑",
+  "땒",
+  "땓",
+  "땔",
+  "땕",
+  "땖",
+  "땗",
+  "땘",
+  "땙",
+  "땚",
+  "땛",
+  "땜",
+  "땝",
+  "땞",
+  "땟",
+  "땠",
+  "땡",
+  "땢",
+  "땣",
+  "땤",
+  "땥",
+  "땦",
+  "땧",
+  "땨",
+  "땩",
+  "땪",
+  "땫",
+  "땬",
+  "땭",
+  "땮",
+  "땯",
+  "땰",
+  "땱",
+  "땲",
+  "땳",
+  "땴",
+  "땵",
+  "땶",
+  "땷",
+  "땸",
+  "땹",
+  "땺",
+  "땻",
+  "땼",
+  "땽",
+  "땾",
+  "땿",
+  "떀",
+  "떁",
+  "떂",
+  "떃",
+  "떄",
+  "떅",
+  "떆",
+  "떇",
+  "떈",
+  "떉",
+  "떊",
+  "떋",
+  "떌",
+  "떍",
+  "떎",
+  "떏",
+  "떐",
+  "떑",
+  "떒",
+  "떓",
+  "떔",
+  "떕",
+  "떖",
+  "떗",
+  "떘",
+  "떙",
+  "떚",
+  "떛",
+  "떜",
+  "떝",
+  "떞",
+  "떟",
+  "떠",
+  "떡",
+  "떢",
+  "떣",
+  "떤",
+  "떥",
+  "떦",
+  "떧",
+  "떨",
+  "떩",
+  "떪",
+  "떫",
+  "떬",
+  "떭",
+  "떮",
+  "떯",
+  "떰",
+  "떱",
+  "떲",
+  "떳",
+  "떴",
+  "떵",
+  "떶",
+  "떷",
+  "떸",
+  "떹",
+  "떺",
+  "떻",
+  "떼",
+  "떽",
+  "떾",
+  "떿",
+  "뗀",
+  "뗁",
+  "뗂",
+  "뗃",
+  "뗄",
+  "뗅",
+  "뗆",
+  "뗇",
+  "뗈",
+  "뗉",
+  "뗊",
+  "뗋",
+  "뗌",
+  "뗍",
+  "뗎",
+  "뗏",
+  "뗐",
+  "뗑",
+  "뗒",
+  "뗓",
+  "뗔",
+  "뗕",
+  "뗖",
+  "뗗",
+  "뗘",
+  "뗙",
+  "뗚",
+  "뗛",
+  "뗜",
+  "뗝",
+  "뗞",
+  "뗟",
+  "뗠",
+  "뗡",
+  "뗢",
+  "뗣",
+  "뗤",
+  "뗥",
+  "뗦",
+  "뗧",
+  "뗨",
+  "뗩",
+  "뗪",
+  "뗫",
+  "뗬",
+  "뗭",
+  "뗮",
+  "뗯",
+  "뗰",
+  "뗱",
+  "뗲",
+  "뗳",
+  "뗴",
+  "뗵",
+  "뗶",
+  "뗷",
+  "뗸",
+  "뗹",
+  "뗺",
+  "뗻",
+  "뗼",
+  "뗽",
+  "뗾",
+  "뗿",
+  "똀",
+  "똁",
+  "똂",
+  "똃",
+  "똄",
+  "똅",
+  "똆",
+  "똇",
+  "똈",
+  "똉",
+  "똊",
+  "똋",
+  "똌",
+  "똍",
+  "똎",
+  "똏",
+  "또",
+  "똑",
+  "똒",
+  "똓",
+  "똔",
+  "똕",
+  "똖",
+  "똗",
+  "똘",
+  "똙",
+  "똚",
+  "똛",
+  "똜",
+  "똝",
+  "똞",
+  "똟",
+  "똠",
+  "똡",
+  "똢",
+  "똣",
+  "똤",
+  "똥",
+  "똦",
+  "똧",
+  "똨",
+  "똩",
+  "똪",
+  "똫",
+  "똬",
+  "똭",
+  "똮",
+  "똯",
+  "똰",
+  "똱",
+  "똲",
+  "똳",
+  "똴",
+  "똵",
+  "똶",
+  "똷",
+  "똸",
+  "똹",
+  "똺",
+  "똻",
+  "똼",
+  "똽",
+  "똾",
+  "똿",
+  "뙀",
+  "뙁",
+  "뙂",
+  "뙃",
+  "뙄",
+  "뙅",
+  "뙆",
+  "뙇",
+  "뙈",
+  "뙉",
+  "뙊",
+  "뙋",
+  "뙌",
+  "뙍",
+  "뙎",
+  "뙏",
+  "뙐",
+  "뙑",
+  "뙒",
+  "뙓",
+  "뙔",
+  "뙕",
+  "뙖",
+  "뙗",
+  "뙘",
+  "뙙",
+  "뙚",
+  "뙛",
+  "뙜",
+  "뙝",
+  "뙞",
+  "뙟",
+  "뙠",
+  "뙡",
+  "뙢",
+  "뙣",
+  "뙤",
+  "뙥",
+  "뙦",
+  "뙧",
+  "뙨",
+  "뙩",
+  "뙪",
+  "뙫",
+  "뙬",
+  "뙭",
+  "뙮",
+  "뙯",
+  "뙰",
+  "뙱",
+  "뙲",
+  "뙳",
+  "뙴",
+  "뙵",
+  "뙶",
+  "뙷",
+  "뙸",
+  "뙹",
+  "뙺",
+  "뙻",
+  "뙼",
+  "뙽",
+  "뙾",
+  "뙿",
+  "뚀",
+  "뚁",
+  "뚂",
+  "뚃",
+  "뚄",
+  "뚅",
+  "뚆",
+  "뚇",
+  "뚈",
+  "뚉",
+  "뚊",
+  "뚋",
+  "뚌",
+  "뚍",
+  "뚎",
+  "뚏",
+  "뚐",
+  "뚑",
+  "뚒",
+  "뚓",
+  "뚔",
+  "뚕",
+  "뚖",
+  "뚗",
+  "뚘",
+  "뚙",
+  "뚚",
+  "뚛",
+  "뚜",
+  "뚝",
+  "뚞",
+  "뚟",
+  "뚠",
+  "뚡",
+  "뚢",
+  "뚣",
+  "뚤",
+  "뚥",
+  "뚦",
+  "뚧",
+  "뚨",
+  "뚩",
+  "뚪",
+  "뚫",
+  "뚬",
+  "뚭",
+  "뚮",
+  "뚯",
+  "뚰",
+  "뚱",
+  "뚲",
+  "뚳",
+  "뚴",
+  "뚵",
+  "뚶",
+  "뚷",
+  "뚸",
+  "뚹",
+  "뚺",
+  "뚻",
+  "뚼",
+  "뚽",
+  "뚾",
+  "뚿",
+  "뛀",
+  "뛁",
+  "뛂",
+  "뛃",
+  "뛄",
+  "뛅",
+  "뛆",
+  "뛇",
+  "뛈",
+  "뛉",
+  "뛊",
+  "뛋",
+  "뛌",
+  "뛍",
+  "뛎",
+  "뛏",
+  "뛐",
+  "뛑",
+  "뛒",
+  "뛓",
+  "뛔",
+  "뛕",
+  "뛖",
+  "뛗",
+  "뛘",
+  "뛙",
+  "뛚",
+  "뛛",
+  "뛜",
+  "뛝",
+  "뛞",
+  "뛟",
+  "뛠",
+  "뛡",
+  "뛢",
+  "뛣",
+  "뛤",
+  "뛥",
+  "뛦",
+  "뛧",
+  "뛨",
+  "뛩",
+  "뛪",
+  "뛫",
+  "뛬",
+  "뛭",
+  "뛮",
+  "뛯",
+  "뛰",
+  "뛱",
+  "뛲",
+  "뛳",
+  "뛴",
+  "뛵",
+  "뛶",
+  "뛷",
+  "뛸",
+  "뛹",
+  "뛺",
+  "뛻",
+  "뛼",
+  "뛽",
+  "뛾",
+  "뛿",
+  "뜀",
+  "뜁",
+  "뜂",
+  "뜃",
+  "뜄",
+  "뜅",
+  "뜆",
+  "뜇",
+  "뜈",
+  "뜉",
+  "뜊",
+  "뜋",
+  "뜌",
+  "뜍",
+  "뜎",
+  "뜏",
+  "뜐",
+  "뜑",
+  "뜒",
+  "뜓",
+  "뜔",
+  "뜕",
+  "뜖",
+  "뜗",
+  "뜘",
+  "뜙",
+  "뜚",
+  "뜛",
+  "뜜",
+  "뜝",
+  "뜞",
+  "뜟",
+  "뜠",
+  "뜡",
+  "뜢",
+  "뜣",
+  "뜤",
+  "뜥",
+  "뜦",
+  "뜧",
+  "뜨",
+  "뜩",
+  "뜪",
+  "뜫",
+  "뜬",
+  "뜭",
+  "뜮",
+  "뜯",
+  "뜰",
+  "뜱",
+  "뜲",
+  "뜳",
+  "뜴",
+  "뜵",
+  "뜶",
+  "뜷",
+  "뜸",
+  "뜹",
+  "뜺",
+  "뜻",
+  "뜼",
+  "뜽",
+  "뜾",
+  "뜿",
+  "띀",
+  "띁",
+  "띂",
+  "띃",
+  "띄",
+  "띅",
+  "띆",
+  "띇",
+  "띈",
+  "띉",
+  "띊",
+  "띋",
+  "띌",
+  "띍",
+  "띎",
+  "띏",
+  "띐",
+  "띑",
+  "띒",
+  "띓",
+  "띔",
+  "띕",
+  "띖",
+  "띗",
+  "띘",
+  "띙",
+  "띚",
+  "띛",
+  "띜",
+  "띝",
+  "띞",
+  "띟",
+  "띠",
+  "띡",
+  "띢",
+  "띣",
+  "띤",
+  "띥",
+  "띦",
+  "띧",
+  "띨",
+  "띩",
+  "띪",
+  "띫",
+  "띬",
+  "띭",
+  "띮",
+  "띯",
+  "띰",
+  "띱",
+  "띲",
+  "띳",
+  "띴",
+  "띵",
+  "띶",
+  "띷",
+  "띸",
+  "띹",
+  "띺",
+  "띻",
+  "라",
+  "락",
+  "띾",
+  "띿",
+  "란",
+  "랁",
+  "랂",
+  "랃",
+  "랄",
+  "랅",
+  "랆",
+  "랇",
+  "랈",
+  "랉",
+  "랊",
+  "랋",
+  "람",
+  "랍",
+  "랎",
+  "랏",
+  "랐",
+  "랑",
+  "랒",
+  "랓",
+  "랔",
+  "랕",
+  "랖",
+  "랗",
+  "래",
+  "랙",
+  "랚",
+  "랛",
+  "랜",
+  "랝",
+  "랞",
+  "랟",
+  "랠",
+  "랡",
+  "랢",
+  "랣",
+  "랤",
+  "랥",
+  "랦",
+  "랧",
+  "램",
+  "랩",
+  "랪",
+  "랫",
+  "랬",
+  "랭",
+  "랮",
+  "랯",
+  "랰",
+  "랱",
+  "랲",
+  "랳",
+  "랴",
+  "략",
+  "랶",
+  "랷",
+  "랸",
+  "랹",
+  "랺",
+  "랻",
+  "랼",
+  "랽",
+  "랾",
+  "랿",
+  "럀",
+  "럁",
+  "럂",
+  "럃",
+  "럄",
+  "럅",
+  "럆",
+  "럇",
+  "럈",
+  "량",
+  "럊",
+  "럋",
+  "럌",
+  "럍",
+  "럎",
+  "럏",
+  "럐",
+  "럑",
+  "럒",
+  "럓",
+  "럔",
+  "럕",
+  "럖",
+  "럗",
+  "럘",
+  "럙",
+  "럚",
+  "럛",
+  "럜",
+  "럝",
+  "럞",
+  "럟",
+  "럠",
+  "럡",
+  "럢",
+  "럣",
+  "럤",
+  "럥",
+  "럦",
+  "럧",
+  "럨",
+  "럩",
+  "럪",
+  "럫",
+  "러",
+  "럭",
+  "럮",
+  "럯",
+  "런",
+  "럱",
+  "럲",
+  "럳",
+  "럴",
+  "럵",
+  "럶",
+  "럷",
+  "럸",
+  "럹",
+  "럺",
+  "럻",
+  "럼",
+  "럽",
+  "럾",
+  "럿",
+  "렀",
+  "렁",
+  "렂",
+  "렃",
+  "렄",
+  "렅",
+  "렆",
+  "렇",
+  "레",
+  "렉",
+  "렊",
+  "렋",
+  "렌",
+  "렍",
+  "렎",
+  "렏",
+  "렐",
+  "렑",
+  "렒",
+  "렓",
+  "렔",
+  "렕",
+  "렖",
+  "렗",
+  "렘",
+  "렙",
+  "렚",
+  "렛",
+  "렜",
+  "렝",
+  "렞",
+  "렟",
+  "렠",
+  "렡",
+  "렢",
+  "렣",
+  "려",
+  "력",
+  "렦",
+  "렧",
+  "련",
+  "렩",
+  "렪",
+  "렫",
+  "렬",
+  "렭",
+  "렮",
+  "렯",
+  "렰",
+  "렱",
+  "렲",
+  "렳",
+  "렴",
+  "렵",
+  "렶",
+  "렷",
+  "렸",
+  "령",
+  "렺",
+  "렻",
+  "렼",
+  "렽",
+  "렾",
+  "렿",
+  "례",
+  "롁",
+  "롂",
+  "롃",
+  "롄",
+  "롅",
+  "롆",
+  "롇",
+  "롈",
+  "롉",
+  "롊",
+  "롋",
+  "롌",
+  "롍",
+  "롎",
+  "롏",
+  "롐",
+  "롑",
+  "롒",
+  "롓",
+  "롔",
+  "롕",
+  "롖",
+  "롗",
+  "롘",
+  "롙",
+  "롚",
+  "롛",
+  "로",
+  "록",
+  "롞",
+  "롟",
+  "론",
+  "롡",
+  "롢",
+  "롣",
+  "롤",
+  "롥",
+  "롦",
+  "롧",
+  "롨",
+  "롩",
+  "롪",
+  "롫",
+  "롬",
+  "롭",
+  "롮",
+  "롯",
+  "롰",
+  "롱",
+  "롲",
+  "롳",
+  "롴",
+  "롵",
+  "롶",
+  "롷",
+  "롸",
+  "롹",
+  "롺",
+  "롻",
+  "롼",
+  "롽",
+  "롾",
+  "롿",
+  "뢀",
+  "뢁",
+  "뢂",
+  "뢃",
+  "뢄",
+  "뢅",
+  "뢆",
+  "뢇",
+  "뢈",
+  "뢉",
+  "뢊",
+  "뢋",
+  "뢌",
+  "뢍",
+  "뢎",
+  "뢏",
+  "뢐",
+  "뢑",
+  "뢒",
+  "뢓",
+  "뢔",
+  "뢕",
+  "뢖",
+  "뢗",
+  "뢘",
+  "뢙",
+  "뢚",
+  "뢛",
+  "뢜",
+  "뢝",
+  "뢞",
+  "뢟",
+  "뢠",
+  "뢡",
+  "뢢",
+  "뢣",
+  "뢤",
+  "뢥",
+  "뢦",
+  "뢧",
+  "뢨",
+  "뢩",
+  "뢪",
+  "뢫",
+  "뢬",
+  "뢭",
+  "뢮",
+  "뢯",
+  "뢰",
+  "뢱",
+  "뢲",
+  "뢳",
+  "뢴",
+  "뢵",
+  "뢶",
+  "뢷",
+  "뢸",
+  "뢹",
+  "뢺",
+  "뢻",
+  "뢼",
+  "뢽",
+  "뢾",
+  "뢿",
+  "룀",
+  "룁",
+  "룂",
+  "룃",
+  "룄",
+  "룅",
+  "룆",
+  "룇",
+  "룈",
+  "룉",
+  "룊",
+  "룋",
+  "료",
+  "룍",
+  "룎",
+  "룏",
+  "룐",
+  "룑",
+  "룒",
+  "룓",
+  "룔",
+  "룕",
+  "룖",
+  "룗",
+  "룘",
+  "룙",
+  "룚",
+  "룛",
+  "룜",
+  "룝",
+  "룞",
+  "룟",
+  "룠",
+  "룡",
+  "룢",
+  "룣",
+  "룤",
+  "룥",
+  "룦",
+  "룧",
+  "루",
+  "룩",
+  "룪",
+  "룫",
+  "룬",
+  "룭",
+  "룮",
+  "룯",
+  "룰",
+  "룱",
+  "룲",
+  "룳",
+  "룴",
+  "룵",
+  "룶",
+  "룷",
+  "룸",
+  "룹",
+  "룺",
+  "룻",
+  "룼",
+  "룽",
+  "룾",
+  "룿",
+  "뤀",
+  "뤁",
+  "뤂",
+  "뤃",
+  "뤄",
+  "뤅",
+  "뤆",
+  "뤇",
+  "뤈",
+  "뤉",
+  "뤊",
+  "뤋",
+  "뤌",
+  "뤍",
+  "뤎",
+  "뤏",
+  "뤐",
+  "뤑",
+  "뤒",
+  "뤓",
+  "뤔",
+  "뤕",
+  "뤖",
+  "뤗",
+  "뤘",
+  "뤙",
+  "뤚",
+  "뤛",
+  "뤜",
+  "뤝",
+  "뤞",
+  "뤟",
+  "뤠",
+  "뤡",
+  "뤢",
+  "뤣",
+  "뤤",
+  "뤥",
+  "뤦",
+  "뤧",
+  "뤨",
+  "뤩",
+  "뤪",
+  "뤫",
+  "뤬",
+  "뤭",
+  "뤮",
+  "뤯",
+  "뤰",
+  "뤱",
+  "뤲",
+  "뤳",
+  "뤴",
+  "뤵",
+  "뤶",
+  "뤷",
+  "뤸",
+  "뤹",
+  "뤺",
+  "뤻",
+  "뤼",
+  "뤽",
+  "뤾",
+  "뤿",
+  "륀",
+  "륁",
+  "륂",
+  "륃",
+  "륄",
+  "륅",
+  "륆",
+  "륇",
+  "륈",
+  "륉",
+  "륊",
+  "륋",
+  "륌",
+  "륍",
+  "륎",
+  "륏",
+  "륐",
+  "륑",
+  "륒",
+  "륓",
+  "륔",
+  "륕",
+  "륖",
+  "륗",
+  "류",
+  "륙",
+  "륚",
+  "륛",
+  "륜",
+  "륝",
+  "륞",
+  "륟",
+  "률",
+  "륡",
+  "륢",
+  "륣",
+  "륤",
+  "륥",
+  "륦",
+  "륧",
+  "륨",
+  "륩",
+  "륪",
+  "륫",
+  "륬",
+  "륭",
+  "륮",
+  "륯",
+  "륰",
+  "륱",
+  "륲",
+  "륳",
+  "르",
+  "륵",
+  "륶",
+  "륷",
+  "른",
+  "륹",
+  "륺",
+  "륻",
+  "를",
+  "륽",
+  "륾",
+  "륿",
+  "릀",
+  "릁",
+  "릂",
+  "릃",
+  "름",
+  "릅",
+  "릆",
+  "릇",
+  "릈",
+  "릉",
+  "릊",
+  "릋",
+  "릌",
+  "릍",
+  "릎",
+  "릏",
+  "릐",
+  "릑",
+  "릒",
+  "릓",
+  "릔",
+  "릕",
+  "릖",
+  "릗",
+  "릘",
+  "릙",
+  "릚",
+  "릛",
+  "릜",
+  "릝",
+  "릞",
+  "릟",
+  "릠",
+  "릡",
+  "릢",
+  "릣",
+  "릤",
+  "릥",
+  "릦",
+  "릧",
+  "릨",
+  "릩",
+  "릪",
+  "릫",
+  "리",
+  "릭",
+  "릮",
+  "릯",
+  "린",
+  "릱",
+  "릲",
+  "릳",
+  "릴",
+  "릵",
+  "릶",
+  "릷",
+  "릸",
+  "릹",
+  "릺",
+  "릻",
+  "림",
+  "립",
+  "릾",
+  "릿",
+  "맀",
+  "링",
+  "맂",
+  "맃",
+  "맄",
+  "맅",
+  "맆",
+  "맇",
+  "마",
+  "막",
+  "맊",
+  "맋",
+  "만",
+  "맍",
+  "많",
+  "맏",
+  "말",
+  "맑",
+  "맒",
+  "맓",
+  "맔",
+  "맕",
+  "맖",
+  "맗",
+  "맘",
+  "맙",
+  "맚",
+  "맛",
+  "맜",
+  "망",
+  "맞",
+  "맟",
+  "맠",
+  "맡",
+  "맢",
+  "맣",
+  "매",
+  "맥",
+  "맦",
+  "맧",
+  "맨",
+  "맩",
+  "맪",
+  "맫",
+  "맬",
+  "맭",
+  "맮",
+  "맯",
+  "맰",
+  "맱",
+  "맲",
+  "맳",
+  "맴",
+  "맵",
+  "맶",
+  "맷",
+  "맸",
+  "맹",
+  "맺",
+  "맻",
+  "맼",
+  "맽",
+  "맾",
+  "맿",
+  "먀",
+  "먁",
+  "먂",
+  "먃",
+  "먄",
+  "먅",
+  "먆",
+  "먇",
+  "먈",
+  "먉",
+  "먊",
+  "먋",
+  "먌",
+  "먍",
+  "먎",
+  "먏",
+  "먐",
+  "먑",
+  "먒",
+  "먓",
+  "먔",
+  "먕",
+  "먖",
+  "먗",
+  "먘",
+  "먙",
+  "먚",
+  "먛",
+  "먜",
+  "먝",
+  "먞",
+  "먟",
+  "먠",
+  "먡",
+  "먢",
+  "먣",
+  "먤",
+  "먥",
+  "먦",
+  "먧",
+  "먨",
+  "먩",
+  "먪",
+  "먫",
+  "먬",
+  "먭",
+  "먮",
+  "먯",
+  "먰",
+  "먱",
+  "먲",
+  "먳",
+  "먴",
+  "먵",
+  "먶",
+  "먷",
+  "머",
+  "먹",
+  "먺",
+  "먻",
+  "먼",
+  "먽",
+  "먾",
+  "먿",
+  "멀",
+  "멁",
+  "멂",
+  "멃",
+  "멄",
+  "멅",
+  "멆",
+  "멇",
+  "멈",
+  "멉",
+  "멊",
+  "멋",
+  "멌",
+  "멍",
+  "멎",
+  "멏",
+  "멐",
+  "멑",
+  "멒",
+  "멓",
+  "메",
+  "멕",
+  "멖",
+  "멗",
+  "멘",
+  "멙",
+  "멚",
+  "멛",
+  "멜",
+  "멝",
+  "멞",
+  "멟",
+  "멠",
+  "멡",
+  "멢",
+  "멣",
+  "멤",
+  "멥",
+  "멦",
+  "멧",
+  "멨",
+  "멩",
+  "멪",
+  "멫",
+  "멬",
+  "멭",
+  "멮",
+  "멯",
+  "며",
+  "멱",
+  "멲",
+  "멳",
+  "면",
+  "멵",
+  "멶",
+  "멷",
+  "멸",
+  "멹",
+  "멺",
+  "멻",
+  "멼",
+  "멽",
+  "멾",
+  "멿",
+  "몀",
+  "몁",
+  "몂",
+  "몃",
+  "몄",
+  "명",
+  "몆",
+  "몇",
+  "몈",
+  "몉",
+  "몊",
+  "몋",
+  "몌",
+  "몍",
+  "몎",
+  "몏",
+  "몐",
+  "몑",
+  "몒",
+  "몓",
+  "몔",
+  "몕",
+  "몖",
+  "몗",
+  "몘",
+  "몙",
+  "몚",
+  "몛",
+  "몜",
+  "몝",
+  "몞",
+  "몟",
+  "몠",
+  "몡",
+  "몢",
+  "몣",
+  "몤",
+  "몥",
+  "몦",
+  "몧",
+  "모",
+  "목",
+  "몪",
+  "몫",
+  "몬",
+  "몭",
+  "몮",
+  "몯",
+  "몰",
+  "몱",
+  "몲",
+  "몳",
+  "몴",
+  "몵",
+  "몶",
+  "몷",
+  "몸",
+  "몹",
+  "몺",
+  "못",
+  "몼",
+  "몽",
+  "몾",
+  "몿",
+  "뫀",
+  "뫁",
+  "뫂",
+  "뫃",
+  "뫄",
+  "뫅",
+  "뫆",
+  "뫇",
+  "뫈",
+  "뫉",
+  "뫊",
+  "뫋",
+  "뫌",
+  "뫍",
+  "뫎",
+  "뫏",
+  "뫐",
+  "뫑",
+  "뫒",
+  "뫓",
+  "뫔",
+  "뫕",
+  "뫖",
+  "뫗",
+  "뫘",
+  "뫙",
+  "뫚",
+  "뫛",
+  "뫜",
+  "뫝",
+  "뫞",
+  "뫟",
+  "뫠",
+  "뫡",
+  "뫢",
+  "뫣",
+  "뫤",
+  "뫥",
+  "뫦",
+  "뫧",
+  "뫨",
+  "뫩",
+  "뫪",
+  "뫫",
+  "뫬",
+  "뫭",
+  "뫮",
+  "뫯",
+  "뫰",
+  "뫱",
+  "뫲",
+  "뫳",
+  "뫴",
+  "뫵",
+  "뫶",
+  "뫷",
+  "뫸",
+  "뫹",
+  "뫺",
+  "뫻",
+  "뫼",
+  "뫽",
+  "뫾",
+  "뫿",
+  "묀",
+  "묁",
+  "묂",
+  "묃",
+  "묄",
+  "묅",
+  "묆",
+  "묇",
+  "묈",
+  "묉",
+  "묊",
+  "묋",
+  "묌",
+  "묍",
+  "묎",
+  "묏",
+  "묐",
+  "묑",
+  "묒",
+  "묓",
+  "묔",
+  "묕",
+  "묖",
+  "묗",
+  "묘",
+  "묙",
+  "묚",
+  "묛",
+  "묜",
+  "묝",
+  "묞",
+  "묟",
+  "묠",
+  "묡",
+  "묢",
+  "묣",
+  "묤",
+  "묥",
+  "묦",
+  "묧",
+  "묨",
+  "묩",
+  "묪",
+  "묫",
+  "묬",
+  "묭",
+  "묮",
+  "묯",
+  "묰",
+  "묱",
+  "묲",
+  "묳",
+  "무",
+  "묵",
+  "묶",
+  "묷",
+  "문",
+  "묹",
+  "묺",
+  "묻",
+  "물",
+  "묽",
+  "묾",
+  "묿",
+  "뭀",
+  "뭁",
+  "뭂",
+  "뭃",
+  "뭄",
+  "뭅",
+  "뭆",
+  "뭇",
+  "뭈",
+  "뭉",
+  "뭊",
+  "뭋",
+  "뭌",
+  "뭍",
+  "뭎",
+  "뭏",
+  "뭐",
+  "뭑",
+  "뭒",
+  "뭓",
+  "뭔",
+  "뭕",
+  "뭖",
+  "뭗",
+  "뭘",
+  "뭙",
+  "뭚",
+  "뭛",
+  "뭜",
+  "뭝",
+  "뭞",
+  "뭟",
+  "뭠",
+  "뭡",
+  "뭢",
+  "뭣",
+  "뭤",
+  "뭥",
+  "뭦",
+  "뭧",
+  "뭨",
+  "뭩",
+  "뭪",
+  "뭫",
+  "뭬",
+  "뭭",
+  "뭮",
+  "뭯",
+  "뭰",
+  "뭱",
+  "뭲",
+  "뭳",
+  "뭴",
+  "뭵",
+  "뭶",
+  "뭷",
+  "뭸",
+  "뭹",
+  "뭺",
+  "뭻",
+  "뭼",
+  "뭽",
+  "뭾",
+  "뭿",
+  "뮀",
+  "뮁",
+  "뮂",
+  "뮃",
+  "뮄",
+  "뮅",
+  "뮆",
+  "뮇",
+  "뮈",
+  "뮉",
+  "뮊",
+  "뮋",
+  "뮌",
+  "뮍",
+  "뮎",
+  "뮏",
+  "뮐",
+  "뮑",
+  "뮒",
+  "뮓",
+  "뮔",
+  "뮕",
+  "뮖",
+  "뮗",
+  "뮘",
+  "뮙",
+  "뮚",
+  "뮛",
+  "뮜",
+  "뮝",
+  "뮞",
+  "뮟",
+  "뮠",
+  "뮡",
+  "뮢",
+  "뮣",
+  "뮤",
+  "뮥",
+  "뮦",
+  "뮧",
+  "뮨",
+  "뮩",
+  "뮪",
+  "뮫",
+  "뮬",
+  "뮭",
+  "뮮",
+  "뮯",
+  "뮰",
+  "뮱",
+  "뮲",
+  "뮳",
+  "뮴",
+  "뮵",
+  "뮶",
+  "뮷",
+  "뮸",
+  "뮹",
+  "뮺",
+  "뮻",
+  "뮼",
+  "뮽",
+  "뮾",
+  "뮿",
+  "므",
+  "믁",
+  "믂",
+  "믃",
+  "믄",
+  "믅",
+  "믆",
+  "믇",
+  "믈",
+  "믉",
+  "믊",
+  "믋",
+  "믌",
+  "믍",
+  "믎",
+  "믏",
+  "믐",
+  "믑",
+  "믒",
+  "믓",
+  "믔",
+  "믕",
+  "믖",
+  "믗",
+  "믘",
+  "믙",
+  "믚",
+  "믛",
+  "믜",
+  "믝",
+  "믞",
+  "믟",
+  "믠",
+  "믡",
+  "믢",
+  "믣",
+  "믤",
+  "믥",
+  "믦",
+  "믧",
+  "믨",
+  "믩",
+  "믪",
+  "믫",
+  "믬",
+  "믭",
+  "믮",
+  "믯",
+  "믰",
+  "믱",
+  "믲",
+  "믳",
+  "믴",
+  "믵",
+  "믶",
+  "믷",
+  "미",
+  "믹",
+  "믺",
+  "믻",
+  "민",
+  "믽",
+  "믾",
+  "믿",
+  "밀",
+  "밁",
+  "밂",
+  "밃",
+  "밄",
+  "밅",
+  "밆",
+  "밇",
+  "밈",
+  "밉",
+  "밊",
+  "밋",
+  "밌",
+  "밍",
+  "밎",
+  "및",
+  "밐",
+  "밑",
+  "밒",
+  "밓",
+  "바",
+  "박",
+  "밖",
+  "밗",
+  "반",
+  "밙",
+  "밚",
+  "받",
+  "발",
+  "밝",
+  "밞",
+  "밟",
+  "밠",
+  "밡",
+  "밢",
+  "밣",
+  "밤",
+  "밥",
+  "밦",
+  "밧",
+  "밨",
+  "방",
+  "밪",
+  "밫",
+  "밬",
+  "밭",
+  "밮",
+  "밯",
+  "배",
+  "백",
+  "밲",
+  "밳",
+  "밴",
+  "밵",
+  "밶",
+  "밷",
+  "밸",
+  "밹",
+  "밺",
+  "밻",
+  "밼",
+  "밽",
+  "밾",
+  "밿",
+  "뱀",
+  "뱁",
+  "뱂",
+  "뱃",
+  "뱄",
+  "뱅",
+  "뱆",
+  "뱇",
+  "뱈",
+  "뱉",
+  "뱊",
+  "뱋",
+  "뱌",
+  "뱍",
+  "뱎",
+  "뱏",
+  "뱐",
+  "뱑",
+  "뱒",
+  "뱓",
+  "뱔",
+  "뱕",
+  "뱖",
+  "뱗",
+  "뱘",
+  "뱙",
+  "뱚",
+  "뱛",
+  "뱜",
+  "뱝",
+  "뱞",
+  "뱟",
+  "뱠",
+  "뱡",
+  "뱢",
+  "뱣",
+  "뱤",
+  "뱥",
+  "뱦",
+  "뱧",
+  "뱨",
+  "뱩",
+  "뱪",
+  "뱫",
+  "뱬",
+  "뱭",
+  "뱮",
+  "뱯",
+  "뱰",
+  "뱱",
+  "뱲",
+  "뱳",
+  "뱴",
+  "뱵",
+  "뱶",
+  "뱷",
+  "뱸",
+  "뱹",
+  "뱺",
+  "뱻",
+  "뱼",
+  "뱽",
+  "뱾",
+  "뱿",
+  "벀",
+  "벁",
+  "벂",
+  "벃",
+  "버",
+  "벅",
+  "벆",
+  "벇",
+  "번",
+  "벉",
+  "벊",
+  "벋",
+  "벌",
+  "벍",
+  "벎",
+  "벏",
+  "벐",
+  "벑",
+  "벒",
+  "벓",
+  "범",
+  "법",
+  "벖",
+  "벗",
+  "벘",
+  "벙",
+  "벚",
+  "벛",
+  "벜",
+  "벝",
+  "벞",
+  "벟",
+  "베",
+  "벡",
+  "벢",
+  "벣",
+  "벤",
+  "벥",
+  "벦",
+  "벧",
+  "벨",
+  "벩",
+  "벪",
+  "벫",
+  "벬",
+  "벭",
+  "벮",
+  "벯",
+  "벰",
+  "벱",
+  "벲",
+  "벳",
+  "벴",
+  "벵",
+  "벶",
+  "벷",
+  "벸",
+  "벹",
+  "벺",
+  "벻",
+  "벼",
+  "벽",
+  "벾",
+  "벿",
+  "변",
+  "볁",
+  "볂",
+  "볃",
+  "별",
+  "볅",
+  "볆",
+  "볇",
+  "볈",
+  "볉",
+  "볊",
+  "볋",
+  "볌",
+  "볍",
+  "볎",
+  "볏",
+  "볐",
+  "병",
+  "볒",
+  "볓",
+  "볔",
+  "볕",
+  "볖",
+  "볗",
+  "볘",
+  "볙",
+  "볚",
+  "볛",
+  "볜",
+  "볝",
+  "볞",
+  "볟",
+  "볠",
+  "볡",
+  "볢",
+  "볣",
+  "볤",
+  "볥",
+  "볦",
+  "볧",
+  "볨",
+  "볩",
+  "볪",
+  "볫",
+  "볬",
+  "볭",
+  "볮",
+  "볯",
+  "볰",
+  "볱",
+  "볲",
+  "볳",
+  "보",
+  "복",
+  "볶",
+  "볷",
+  "본",
+  "볹",
+  "볺",
+  "볻",
+  "볼",
+  "볽",
+  "볾",
+  "볿",
+  "봀",
+  "봁",
+  "봂",
+  "봃",
+  "봄",
+  "봅",
+  "봆",
+  "봇",
+  "봈",
+  "봉",
+  "봊",
+  "봋",
+  "봌",
+  "봍",
+  "봎",
+  "봏",
+  "봐",
+  "봑",
+  "봒",
+  "봓",
+  "봔",
+  "봕",
+  "봖",
+  "봗",
+  "봘",
+  "봙",
+  "봚",
+  "봛",
+  "봜",
+  "봝",
+  "봞",
+  "봟",
+  "봠",
+  "봡",
+  "봢",
+  "봣",
+  "봤",
+  "봥",
+  "봦",
+  "봧",
+  "봨",
+  "봩",
+  "봪",
+  "봫",
+  "봬",
+  "봭",
+  "봮",
+  "봯",
+  "봰",
+  "봱",
+  "봲",
+  "봳",
+  "봴",
+  "봵",
+  "봶",
+  "봷",
+  "봸",
+  "봹",
+  "봺",
+  "봻",
+  "봼",
+  "봽",
+  "봾",
+  "봿",
+  "뵀",
+  "뵁",
+  "뵂",
+  "뵃",
+  "뵄",
+  "뵅",
+  "뵆",
+  "뵇",
+  "뵈",
+  "뵉",
+  "뵊",
+  "뵋",
+  "뵌",
+  "뵍",
+  "뵎",
+  "뵏",
+  "뵐",
+  "뵑",
+  "뵒",
+  "뵓",
+  "뵔",
+  "뵕",
+  "뵖",
+  "뵗",
+  "뵘",
+  "뵙",
+  "뵚",
+  "뵛",
+  "뵜",
+  "뵝",
+  "뵞",
+  "뵟",
+  "뵠",
+  "뵡",
+  "뵢",
+  "뵣",
+  "뵤",
+  "뵥",
+  "뵦",
+  "뵧",
+  "뵨",
+  "뵩",
+  "뵪",
+  "뵫",
+  "뵬",
+  "뵭",
+  "뵮",
+  "뵯",
+  "뵰",
+  "뵱",
+  "뵲",
+  "뵳",
+  "뵴",
+  "뵵",
+  "뵶",
+  "뵷",
+  "뵸",
+  "뵹",
+  "뵺",
+  "뵻",
+  "뵼",
+  "뵽",
+  "뵾",
+  "뵿",
+  "부",
+  "북",
+  "붂",
+  "붃",
+  "분",
+  "붅",
+  "붆",
+  "붇",
+  "불",
+  "붉",
+  "붊",
+  "붋",
+  "붌",
+  "붍",
+  "붎",
+  "붏",
+  "붐",
+  "붑",
+  "붒",
+  "붓",
+  "붔",
+  "붕",
+  "붖",
+  "붗",
+  "붘",
+  "붙",
+  "붚",
+  "붛",
+  "붜",
+  "붝",
+  "붞",
+  "붟",
+  "붠",
+  "붡",
+  "붢",
+  "붣",
+  "붤",
+  "붥",
+  "붦",
+  "붧",
+  "붨",
+  "붩",
+  "붪",
+  "붫",
+  "붬",
+  "붭",
+  "붮",
+  "붯",
+  "붰",
+  "붱",
+  "붲",
+  "붳",
+  "붴",
+  "붵",
+  "붶",
+  "붷",
+  "붸",
+  "붹",
+  "붺",
+  "붻",
+  "붼",
+  "붽",
+  "붾",
+  "붿",
+  "뷀",
+  "뷁",
+  "뷂",
+  "뷃",
+  "뷄",
+  "뷅",
+  "뷆",
+  "뷇",
+  "뷈",
+  "뷉",
+  "뷊",
+  "뷋",
+  "뷌",
+  "뷍",
+  "뷎",
+  "뷏",
+  "뷐",
+  "뷑",
+  "뷒",
+  "뷓",
+  "뷔",
+  "뷕",
+  "뷖",
+  "뷗",
+  "뷘",
+  "뷙",
+  "뷚",
+  "뷛",
+  "뷜",
+  "뷝",
+  "뷞",
+  "뷟",
+  "뷠",
+  "뷡",
+  "뷢",
+  "뷣",
+  "뷤",
+  "뷥",
+  "뷦",
+  "뷧",
+  "뷨",
+  "뷩",
+  "뷪",
+  "뷫",
+  "뷬",
+  "뷭",
+  "뷮",
+  "뷯",
+  "뷰",
+  "뷱",
+  "뷲",
+  "뷳",
+  "뷴",
+  "뷵",
+  "뷶",
+  "뷷",
+  "뷸",
+  "뷹",
+  "뷺",
+  "뷻",
+  "뷼",
+  "뷽",
+  "뷾",
+  "뷿",
+  "븀",
+  "븁",
+  "븂",
+  "븃",
+  "븄",
+  "븅",
+  "븆",
+  "븇",
+  "븈",
+  "븉",
+  "븊",
+  "븋",
+  "브",
+  "븍",
+  "븎",
+  "븏",
+  "븐",
+  "븑",
+  "븒",
+  "븓",
+  "블",
+  "븕",
+  "븖",
+  "븗",
+  "븘",
+  "븙",
+  "븚",
+  "븛",
+  "븜",
+  "븝",
+  "븞",
+  "븟",
+  "븠",
+  "븡",
+  "븢",
+  "븣",
+  "븤",
+  "븥",
+  "븦",
+  "븧",
+  "븨",
+  "븩",
+  "븪",
+  "븫",
+  "븬",
+  "븭",
+  "븮",
+  "븯",
+  "븰",
+  "븱",
+  "븲",
+  "븳",
+  "븴",
+  "븵",
+  "븶",
+  "븷",
+  "븸",
+  "븹",
+  "븺",
+  "븻",
+  "븼",
+  "븽",
+  "븾",
+  "븿",
+  "빀",
+  "빁",
+  "빂",
+  "빃",
+  "비",
+  "빅",
+  "빆",
+  "빇",
+  "빈",
+  "빉",
+  "빊",
+  "빋",
+  "빌",
+  "빍",
+  "빎",
+  "빏",
+  "빐",
+  "빑",
+  "빒",
+  "빓",
+  "빔",
+  "빕",
+  "빖",
+  "빗",
+  "빘",
+  "빙",
+  "빚",
+  "빛",
+  "빜",
+  "빝",
+  "빞",
+  "빟",
+  "빠",
+  "빡",
+  "빢",
+  "빣",
+  "빤",
+  "빥",
+  "빦",
+  "빧",
+  "빨",
+  "빩",
+  "빪",
+  "빫",
+  "빬",
+  "빭",
+  "빮",
+  "빯",
+  "빰",
+  "빱",
+  "빲",
+  "빳",
+  "빴",
+  "빵",
+  "빶",
+  "빷",
+  "빸",
+  "빹",
+  "빺",
+  "빻",
+  "빼",
+  "빽",
+  "빾",
+  "빿",
+  "뺀",
+  "뺁",
+  "뺂",
+  "뺃",
+  "뺄",
+  "뺅",
+  "뺆",
+  "뺇",
+  "뺈",
+  "뺉",
+  "뺊",
+  "뺋",
+  "뺌",
+  "뺍",
+  "뺎",
+  "뺏",
+  "뺐",
+  "뺑",
+  "뺒",
+  "뺓",
+  "뺔",
+  "뺕",
+  "뺖",
+  "뺗",
+  "뺘",
+  "뺙",
+  "뺚",
+  "뺛",
+  "뺜",
+  "뺝",
+  "뺞",
+  "뺟",
+  "뺠",
+  "뺡",
+  "뺢",
+  "뺣",
+  "뺤",
+  "뺥",
+  "뺦",
+  "뺧",
+  "뺨",
+  "뺩",
+  "뺪",
+  "뺫",
+  "뺬",
+  "뺭",
+  "뺮",
+  "뺯",
+  "뺰",
+  "뺱",
+  "뺲",
+  "뺳",
+  "뺴",
+  "뺵",
+  "뺶",
+  "뺷",
+  "뺸",
+  "뺹",
+  "뺺",
+  "뺻",
+  "뺼",
+  "뺽",
+  "뺾",
+  "뺿",
+  "뻀",
+  "뻁",
+  "뻂",
+  "뻃",
+  "뻄",
+  "뻅",
+  "뻆",
+  "뻇",
+  "뻈",
+  "뻉",
+  "뻊",
+  "뻋",
+  "뻌",
+  "뻍",
+  "뻎",
+  "뻏",
+  "뻐",
+  "뻑",
+  "뻒",
+  "뻓",
+  "뻔",
+  "뻕",
+  "뻖",
+  "뻗",
+  "뻘",
+  "뻙",
+  "뻚",
+  "뻛",
+  "뻜",
+  "뻝",
+  "뻞",
+  "뻟",
+  "뻠",
+  "뻡",
+  "뻢",
+  "뻣",
+  "뻤",
+  "뻥",
+  "뻦",
+  "뻧",
+  "뻨",
+  "뻩",
+  "뻪",
+  "뻫",
+  "뻬",
+  "뻭",
+  "뻮",
+  "뻯",
+  "뻰",
+  "뻱",
+  "뻲",
+  "뻳",
+  "뻴",
+  "뻵",
+  "뻶",
+  "뻷",
+  "뻸",
+  "뻹",
+  "뻺",
+  "뻻",
+  "뻼",
+  "뻽",
+  "뻾",
+  "뻿",
+  "뼀",
+  "뼁",
+  "뼂",
+  "뼃",
+  "뼄",
+  "뼅",
+  "뼆",
+  "뼇",
+  "뼈",
+  "뼉",
+  "뼊",
+  "뼋",
+  "뼌",
+  "뼍",
+  "뼎",
+  "뼏",
+  "뼐",
+  "뼑",
+  "뼒",
+  "뼓",
+  "뼔",
+  "뼕",
+  "뼖",
+  "뼗",
+  "뼘",
+  "뼙",
+  "뼚",
+  "뼛",
+  "뼜",
+  "뼝",
+  "뼞",
+  "뼟",
+  "뼠",
+  "뼡",
+  "뼢",
+  "뼣",
+  "뼤",
+  "뼥",
+  "뼦",
+  "뼧",
+  "뼨",
+  "뼩",
+  "뼪",
+  "뼫",
+  "뼬",
+  "뼭",
+  "뼮",
+  "뼯",
+  "뼰",
+  "뼱",
+  "뼲",
+  "뼳",
+  "뼴",
+  "뼵",
+  "뼶",
+  "뼷",
+  "뼸",
+  "뼹",
+  "뼺",
+  "뼻",
+  "뼼",
+  "뼽",
+  "뼾",
+  "뼿",
+  "뽀",
+  "뽁",
+  "뽂",
+  "뽃",
+  "뽄",
+  "뽅",
+  "뽆",
+  "뽇",
+  "뽈",
+  "뽉",
+  "뽊",
+  "뽋",
+  "뽌",
+  "뽍",
+  "뽎",
+  "뽏",
+  "뽐",
+  "뽑",
+  "뽒",
+  "뽓",
+  "뽔",
+  "뽕",
+  "뽖",
+  "뽗",
+  "뽘",
+  "뽙",
+  "뽚",
+  "뽛",
+  "뽜",
+  "뽝",
+  "뽞",
+  "뽟",
+  "뽠",
+  "뽡",
+  "뽢",
+  "뽣",
+  "뽤",
+  "뽥",
+  "뽦",
+  "뽧",
+  "뽨",
+  "뽩",
+  "뽪",
+  "뽫",
+  "뽬",
+  "뽭",
+  "뽮",
+  "뽯",
+  "뽰",
+  "뽱",
+  "뽲",
+  "뽳",
+  "뽴",
+  "뽵",
+  "뽶",
+  "뽷",
+  "뽸",
+  "뽹",
+  "뽺",
+  "뽻",
+  "뽼",
+  "뽽",
+  "뽾",
+  "뽿",
+  "뾀",
+  "뾁",
+  "뾂",
+  "뾃",
+  "뾄",
+  "뾅",
+  "뾆",
+  "뾇",
+  "뾈",
+  "뾉",
+  "뾊",
+  "뾋",
+  "뾌",
+  "뾍",
+  "뾎",
+  "뾏",
+  "뾐",
+  "뾑",
+  "뾒",
+  "뾓",
+  "뾔",
+  "뾕",
+  "뾖",
+  "뾗",
+  "뾘",
+  "뾙",
+  "뾚",
+  "뾛",
+  "뾜",
+  "뾝",
+  "뾞",
+  "뾟",
+  "뾠",
+  "뾡",
+  "뾢",
+  "뾣",
+  "뾤",
+  "뾥",
+  "뾦",
+  "뾧",
+  "뾨",
+  "뾩",
+  "뾪",
+  "뾫",
+  "뾬",
+  "뾭",
+  "뾮",
+  "뾯",
+  "뾰",
+  "뾱",
+  "뾲",
+  "뾳",
+  "뾴",
+  "뾵",
+  "뾶",
+  "뾷",
+  "뾸",
+  "뾹",
+  "뾺",
+  "뾻",
+  "뾼",
+  "뾽",
+  "뾾",
+  "뾿",
+  "뿀",
+  "뿁",
+  "뿂",
+  "뿃",
+  "뿄",
+  "뿅",
+  "뿆",
+  "뿇",
+  "뿈",
+  "뿉",
+  "뿊",
+  "뿋",
+  "뿌",
+  "뿍",
+  "뿎",
+  "뿏",
+  "뿐",
+  "뿑",
+  "뿒",
+  "뿓",
+  "뿔",
+  "뿕",
+  "뿖",
+  "뿗",
+  "뿘",
+  "뿙",
+  "뿚",
+  "뿛",
+  "뿜",
+  "뿝",
+  "뿞",
+  "뿟",
+  "뿠",
+  "뿡",
+  "뿢",
+  "뿣",
+  "뿤",
+  "뿥",
+  "뿦",
+  "뿧",
+  "뿨",
+  "뿩",
+  "뿪",
+  "뿫",
+  "뿬",
+  "뿭",
+  "뿮",
+  "뿯",
+  "뿰",
+  "뿱",
+  "뿲",
+  "뿳",
+  "뿴",
+  "뿵",
+  "뿶",
+  "뿷",
+  "뿸",
+  "뿹",
+  "뿺",
+  "뿻",
+  "뿼",
+  "뿽",
+  "뿾",
+  "뿿",
+  "쀀",
+  "쀁",
+  "쀂",
+  "쀃",
+  "쀄",
+  "쀅",
+  "쀆",
+  "쀇",
+  "쀈",
+  "쀉",
+  "쀊",
+  "쀋",
+  "쀌",
+  "쀍",
+  "쀎",
+  "쀏",
+  "쀐",
+  "쀑",
+  "쀒",
+  "쀓",
+  "쀔",
+  "쀕",
+  "쀖",
+  "쀗",
+  "쀘",
+  "쀙",
+  "쀚",
+  "쀛",
+  "쀜",
+  "쀝",
+  "쀞",
+  "쀟",
+  "쀠",
+  "쀡",
+  "쀢",
+  "쀣",
+  "쀤",
+  "쀥",
+  "쀦",
+  "쀧",
+  "쀨",
+  "쀩",
+  "쀪",
+  "쀫",
+  "쀬",
+  "쀭",
+  "쀮",
+  "쀯",
+  "쀰",
+  "쀱",
+  "쀲",
+  "쀳",
+  "쀴",
+  "쀵",
+  "쀶",
+  "쀷",
+  "쀸",
+  "쀹",
+  "쀺",
+  "쀻",
+  "쀼",
+  "쀽",
+  "쀾",
+  "쀿",
+  "쁀",
+  "쁁",
+  "쁂",
+  "쁃",
+  "쁄",
+  "쁅",
+  "쁆",
+  "쁇",
+  "쁈",
+  "쁉",
+  "쁊",
+  "쁋",
+  "쁌",
+  "쁍",
+  "쁎",
+  "쁏",
+  "쁐",
+  "쁑",
+  "쁒",
+  "쁓",
+  "쁔",
+  "쁕",
+  "쁖",
+  "쁗",
+  "쁘",
+  "쁙",
+  "쁚",
+  "쁛",
+  "쁜",
+  "쁝",
+  "쁞",
+  "쁟",
+  "쁠",
+  "쁡",
+  "쁢",
+  "쁣",
+  "쁤",
+  "쁥",
+  "쁦",
+  "쁧",
+  "쁨",
+  "쁩",
+  "쁪",
+  "쁫",
+  "쁬",
+  "쁭",
+  "쁮",
+  "쁯",
+  "쁰",
+  "쁱",
+  "쁲",
+  "쁳",
+  "쁴",
+  "쁵",
+  "쁶",
+  "쁷",
+  "쁸",
+  "쁹",
+  "쁺",
+  "쁻",
+  "쁼",
+  "쁽",
+  "쁾",
+  "쁿",
+  "삀",
+  "삁",
+  "삂",
+  "삃",
+  "삄",
+  "삅",
+  "삆",
+  "삇",
+  "삈",
+  "삉",
+  "삊",
+  "삋",
+  "삌",
+  "삍",
+  "삎",
+  "삏",
+  "삐",
+  "삑",
+  "삒",
+  "삓",
+  "삔",
+  "삕",
+  "삖",
+  "삗",
+  "삘",
+  "삙",
+  "삚",
+  "삛",
+  "삜",
+  "삝",
+  "삞",
+  "삟",
+  "삠",
+  "삡",
+  "삢",
+  "삣",
+  "삤",
+  "삥",
+  "삦",
+  "삧",
+  "삨",
+  "삩",
+  "삪",
+  "삫",
+  "사",
+  "삭",
+  "삮",
+  "삯",
+  "산",
+  "삱",
+  "삲",
+  "삳",
+  "살",
+  "삵",
+  "삶",
+  "삷",
+  "삸",
+  "삹",
+  "삺",
+  "삻",
+  "삼",
+  "삽",
+  "삾",
+  "삿",
+  "샀",
+  "상",
+  "샂",
+  "샃",
+  "샄",
+  "샅",
+  "샆",
+  "샇",
+  "새",
+  "색",
+  "샊",
+  "샋",
+  "샌",
+  "샍",
+  "샎",
+  "샏",
+  "샐",
+  "샑",
+  "샒",
+  "샓",
+  "샔",
+  "샕",
+  "샖",
+  "샗",
+  "샘",
+  "샙",
+  "샚",
+  "샛",
+  "샜",
+  "생",
+  "샞",
+  "샟",
+  "샠",
+  "샡",
+  "샢",
+  "샣",
+  "샤",
+  "샥",
+  "샦",
+  "샧",
+  "샨",
+  "샩",
+  "샪",
+  "샫",
+  "샬",
+  "샭",
+  "샮",
+  "샯",
+  "샰",
+  "샱",
+  "샲",
+  "샳",
+  "샴",
+  "샵",
+  "샶",
+  "샷",
+  "샸",
+  "샹",
+  "샺",
+  "샻",
+  "샼",
+  "샽",
+  "샾",
+  "샿",
+  "섀",
+  "섁",
+  "섂",
+  "섃",
+  "섄",
+  "섅",
+  "섆",
+  "섇",
+  "섈",
+  "섉",
+  "섊",
+  "섋",
+  "섌",
+  "섍",
+  "섎",
+  "섏",
+  "섐",
+  "섑",
+  "섒",
+  "섓",
+  "섔",
+  "섕",
+  "섖",
+  "섗",
+  "섘",
+  "섙",
+  "섚",
+  "섛",
+  "서",
+  "석",
+  "섞",
+  "섟",
+  "선",
+  "섡",
+  "섢",
+  "섣",
+  "설",
+  "섥",
+  "섦",
+  "섧",
+  "섨",
+  "섩",
+  "섪",
+  "섫",
+  "섬",
+  "섭",
+  "섮",
+  "섯",
+  "섰",
+  "성",
+  "섲",
+  "섳",
+  "섴",
+  "섵",
+  "섶",
+  "섷",
+  "세",
+  "섹",
+  "섺",
+  "섻",
+  "센",
+  "섽",
+  "섾",
+  "섿",
+  "셀",
+  "셁",
+  "셂",
+  "셃",
+  "셄",
+  "셅",
+  "셆",
+  "셇",
+  "셈",
+  "셉",
+  "셊",
+  "셋",
+  "셌",
+  "셍",
+  "셎",
+  "셏",
+  "셐",
+  "셑",
+  "셒",
+  "셓",
+  "셔",
+  "셕",
+  "셖",
+  "셗",
+  "션",
+  "셙",
+  "셚",
+  "셛",
+  "셜",
+  "셝",
+  "셞",
+  "셟",
+  "셠",
+  "셡",
+  "셢",
+  "셣",
+  "셤",
+  "셥",
+  "셦",
+  "셧",
+  "셨",
+  "셩",
+  "셪",
+  "셫",
+  "셬",
+  "셭",
+  "셮",
+  "셯",
+  "셰",
+  "셱",
+  "셲",
+  "셳",
+  "셴",
+  "셵",
+  "셶",
+  "셷",
+  "셸",
+  "셹",
+  "셺",
+  "셻",
+  "셼",
+  "셽",
+  "셾",
+  "셿",
+  "솀",
+  "솁",
+  "솂",
+  "솃",
+  "솄",
+  "솅",
+  "솆",
+  "솇",
+  "솈",
+  "솉",
+  "솊",
+  "솋",
+  "소",
+  "속",
+  "솎",
+  "솏",
+  "손",
+  "솑",
+  "솒",
+  "솓",
+  "솔",
+  "솕",
+  "솖",
+  "솗",
+  "솘",
+  "솙",
+  "솚",
+  "솛",
+  "솜",
+  "솝",
+  "솞",
+  "솟",
+  "솠",
+  "송",
+  "솢",
+  "솣",
+  "솤",
+  "솥",
+  "솦",
+  "솧",
+  "솨",
+  "솩",
+  "솪",
+  "솫",
+  "솬",
+  "솭",
+  "솮",
+  "솯",
+  "솰",
+  "솱",
+  "솲",
+  "솳",
+  "솴",
+  "솵",
+  "솶",
+  "솷",
+  "솸",
+  "솹",
+  "솺",
+  "솻",
+  "솼",
+  "솽",
+  "솾",
+  "솿",
+  "쇀",
+  "쇁",
+  "쇂",
+  "쇃",
+  "쇄",
+  "쇅",
+  "쇆",
+  "쇇",
+  "쇈",
+  "쇉",
+  "쇊",
+  "쇋",
+  "쇌",
+  "쇍",
+  "쇎",
+  "쇏",
+  "쇐",
+  "쇑",
+  "쇒",
+  "쇓",
+  "쇔",
+  "쇕",
+  "쇖",
+  "쇗",
+  "쇘",
+  "쇙",
+  "쇚",
+  "쇛",
+  "쇜",
+  "쇝",
+  "쇞",
+  "쇟",
+  "쇠",
+  "쇡",
+  "쇢",
+  "쇣",
+  "쇤",
+  "쇥",
+  "쇦",
+  "쇧",
+  "쇨",
+  "쇩",
+  "쇪",
+  "쇫",
+  "쇬",
+  "쇭",
+  "쇮",
+  "쇯",
+  "쇰",
+  "쇱",
+  "쇲",
+  "쇳",
+  "쇴",
+  "쇵",
+  "쇶",
+  "쇷",
+  "쇸",
+  "쇹",
+  "쇺",
+  "쇻",
+  "쇼",
+  "쇽",
+  "쇾",
+  "쇿",
+  "숀",
+  "숁",
+  "숂",
+  "숃",
+  "숄",
+  "숅",
+  "숆",
+  "숇",
+  "숈",
+  "숉",
+  "숊",
+  "숋",
+  "숌",
+  "숍",
+  "숎",
+  "숏",
+  "숐",
+  "숑",
+  "숒",
+  "숓",
+  "숔",
+  "숕",
+  "숖",
+  "숗",
+  "수",
+  "숙",
+  "숚",
+  "숛",
+  "순",
+  "숝",
+  "숞",
+  "숟",
+  "술",
+  "숡",
+  "숢",
+  "숣",
+  "숤",
+  "숥",
+  "숦",
+  "숧",
+  "숨",
+  "숩",
+  "숪",
+  "숫",
+  "숬",
+  "숭",
+  "숮",
+  "숯",
+  "숰",
+  "숱",
+  "숲",
+  "숳",
+  "숴",
+  "숵",
+  "숶",
+  "숷",
+  "숸",
+  "숹",
+  "숺",
+  "숻",
+  "숼",
+  "숽",
+  "숾",
+  "숿",
+  "쉀",
+  "쉁",
+  "쉂",
+  "쉃",
+  "쉄",
+  "쉅",
+  "쉆",
+  "쉇",
+  "쉈",
+  "쉉",
+  "쉊",
+  "쉋",
+  "쉌",
+  "쉍",
+  "쉎",
+  "쉏",
+  "쉐",
+  "쉑",
+  "쉒",
+  "쉓",
+  "쉔",
+  "쉕",
+  "쉖",
+  "쉗",
+  "쉘",
+  "쉙",
+  "쉚",
+  "쉛",
+  "쉜",
+  "쉝",
+  "쉞",
+  "쉟",
+  "쉠",
+  "쉡",
+  "쉢",
+  "쉣",
+  "쉤",
+  "쉥",
+  "쉦",
+  "쉧",
+  "쉨",
+  "쉩",
+  "쉪",
+  "쉫",
+  "쉬",
+  "쉭",
+  "쉮",
+  "쉯",
+  "쉰",
+  "쉱",
+  "쉲",
+  "쉳",
+  "쉴",
+  "쉵",
+  "쉶",
+  "쉷",
+  "쉸",
+  "쉹",
+  "쉺",
+  "쉻",
+  "쉼",
+  "쉽",
+  "쉾",
+  "쉿",
+  "슀",
+  "슁",
+  "슂",
+  "슃",
+  "슄",
+  "슅",
+  "슆",
+  "슇",
+  "슈",
+  "슉",
+  "슊",
+  "슋",
+  "슌",
+  "슍",
+  "슎",
+  "슏",
+  "슐",
+  "슑",
+  "슒",
+  "슓",
+  "슔",
+  "슕",
+  "슖",
+  "슗",
+  "슘",
+  "슙",
+  "슚",
+  "슛",
+  "슜",
+  "슝",
+  "슞",
+  "슟",
+  "슠",
+  "슡",
+  "슢",
+  "슣",
+  "스",
+  "슥",
+  "슦",
+  "슧",
+  "슨",
+  "슩",
+  "슪",
+  "슫",
+  "슬",
+  "슭",
+  "슮",
+  "슯",
+  "슰",
+  "슱",
+  "슲",
+  "슳",
+  "슴",
+  "습",
+  "슶",
+  "슷",
+  "슸",
+  "승",
+  "슺",
+  "슻",
+  "슼",
+  "슽",
+  "슾",
+  "슿",
+  "싀",
+  "싁",
+  "싂",
+  "싃",
+  "싄",
+  "싅",
+  "싆",
+  "싇",
+  "싈",
+  "싉",
+  "싊",
+  "싋",
+  "싌",
+  "싍",
+  "싎",
+  "싏",
+  "싐",
+  "싑",
+  "싒",
+  "싓",
+  "싔",
+  "싕",
+  "싖",
+  "싗",
+  "싘",
+  "싙",
+  "싚",
+  "싛",
+  "시",
+  "식",
+  "싞",
+  "싟",
+  "신",
+  "싡",
+  "싢",
+  "싣",
+  "실",
+  "싥",
+  "싦",
+  "싧",
+  "싨",
+  "싩",
+  "싪",
+  "싫",
+  "심",
+  "십",
+  "싮",
+  "싯",
+  "싰",
+  "싱",
+  "싲",
+  "싳",
+  "싴",
+  "싵",
+  "싶",
+  "싷",
+  "싸",
+  "싹",
+  "싺",
+  "싻",
+  "싼",
+  "싽",
+  "싾",
+  "싿",
+  "쌀",
+  "쌁",
+  "쌂",
+  "쌃",
+  "쌄",
+  "쌅",
+  "쌆",
+  "쌇",
+  "쌈",
+  "쌉",
+  "쌊",
+  "쌋",
+  "쌌",
+  "쌍",
+  "쌎",
+  "쌏",
+  "쌐",
+  "쌑",
+  "쌒",
+  "쌓",
+  "쌔",
+  "쌕",
+  "쌖",
+  "쌗",
+  "쌘",
+  "쌙",
+  "쌚",
+  "쌛",
+  "쌜",
+  "쌝",
+  "쌞",
+  "쌟",
+  "쌠",
+  "쌡",
+  "쌢",
+  "쌣",
+  "쌤",
+  "쌥",
+  "쌦",
+  "쌧",
+  "쌨",
+  "쌩",
+  "쌪",
+  "쌫",
+  "쌬",
+  "쌭",
+  "쌮",
+  "쌯",
+  "쌰",
+  "쌱",
+  "쌲",
+  "쌳",
+  "쌴",
+  "쌵",
+  "쌶",
+  "쌷",
+  "쌸",
+  "쌹",
+  "쌺",
+  "쌻",
+  "쌼",
+  "쌽",
+  "쌾",
+  "쌿",
+  "썀",
+  "썁",
+  "썂",
+  "썃",
+  "썄",
+  "썅",
+  "썆",
+  "썇",
+  "썈",
+  "썉",
+  "썊",
+  "썋",
+  "썌",
+  "썍",
+  "썎",
+  "썏",
+  "썐",
+  "썑",
+  "썒",
+  "썓",
+  "썔",
+  "썕",
+  "썖",
+  "썗",
+  "썘",
+  "썙",
+  "썚",
+  "썛",
+  "썜",
+  "썝",
+  "썞",
+  "썟",
+  "썠",
+  "썡",
+  "썢",
+  "썣",
+  "썤",
+  "썥",
+  "썦",
+  "썧",
+  "써",
+  "썩",
+  "썪",
+  "썫",
+  "썬",
+  "썭",
+  "썮",
+  "썯",
+  "썰",
+  "썱",
+  "썲",
+  "썳",
+  "썴",
+  "썵",
+  "썶",
+  "썷",
+  "썸",
+  "썹",
+  "썺",
+  "썻",
+  "썼",
+  "썽",
+  "썾",
+  "썿",
+  "쎀",
+  "쎁",
+  "쎂",
+  "쎃",
+  "쎄",
+  "쎅",
+  "쎆",
+  "쎇",
+  "쎈",
+  "쎉",
+  "쎊",
+  "쎋",
+  "쎌",
+  "쎍",
+  "쎎",
+  "쎏",
+  "쎐",
+  "쎑",
+  "쎒",
+  "쎓",
+  "쎔",
+  "쎕",
+  "쎖",
+  "쎗",
+  "쎘",
+  "쎙",
+  "쎚",
+  "쎛",
+  "쎜",
+  "쎝",
+  "쎞",
+  "쎟",
+  "쎠",
+  "쎡",
+  "쎢",
+  "쎣",
+  "쎤",
+  "쎥",
+  "쎦",
+  "쎧",
+  "쎨",
+  "쎩",
+  "쎪",
+  "쎫",
+  "쎬",
+  "쎭",
+  "쎮",
+  "쎯",
+  "쎰",
+  "쎱",
+  "쎲",
+  "쎳",
+  "쎴",
+  "쎵",
+  "쎶",
+  "쎷",
+  "쎸",
+  "쎹",
+  "쎺",
+  "쎻",
+  "쎼",
+  "쎽",
+  "쎾",
+  "쎿",
+  "쏀",
+  "쏁",
+  "쏂",
+  "쏃",
+  "쏄",
+  "쏅",
+  "쏆",
+  "쏇",
+  "쏈",
+  "쏉",
+  "쏊",
+  "쏋",
+  "쏌",
+  "쏍",
+  "쏎",
+  "쏏",
+  "쏐",
+  "쏑",
+  "쏒",
+  "쏓",
+  "쏔",
+  "쏕",
+  "쏖",
+  "쏗",
+  "쏘",
+  "쏙",
+  "쏚",
+  "쏛",
+  "쏜",
+  "쏝",
+  "쏞",
+  "쏟",
+  "쏠",
+  "쏡",
+  "쏢",
+  "쏣",
+  "쏤",
+  "쏥",
+  "쏦",
+  "쏧",
+  "쏨",
+  "쏩",
+  "쏪",
+  "쏫",
+  "쏬",
+  "쏭",
+  "쏮",
+  "쏯",
+  "쏰",
+  "쏱",
+  "쏲",
+  "쏳",
+  "쏴",
+  "쏵",
+  "쏶",
+  "쏷",
+  "쏸",
+  "쏹",
+  "쏺",
+  "쏻",
+  "쏼",
+  "쏽",
+  "쏾",
+  "쏿",
+  "쐀",
+  "쐁",
+  "쐂",
+  "쐃",
+  "쐄",
+  "쐅",
+  "쐆",
+  "쐇",
+  "쐈",
+  "쐉",
+  "쐊",
+  "쐋",
+  "쐌",
+  "쐍",
+  "쐎",
+  "쐏",
+  "쐐",
+  "쐑",
+  "쐒",
+  "쐓",
+  "쐔",
+  "쐕",
+  "쐖",
+  "쐗",
+  "쐘",
+  "쐙",
+  "쐚",
+  "쐛",
+  "쐜",
+  "쐝",
+  "쐞",
+  "쐟",
+  "쐠",
+  "쐡",
+  "쐢",
+  "쐣",
+  "쐤",
+  "쐥",
+  "쐦",
+  "쐧",
+  "쐨",
+  "쐩",
+  "쐪",
+  "쐫",
+  "쐬",
+  "쐭",
+  "쐮",
+  "쐯",
+  "쐰",
+  "쐱",
+  "쐲",
+  "쐳",
+  "쐴",
+  "쐵",
+  "쐶",
+  "쐷",
+  "쐸",
+  "쐹",
+  "쐺",
+  "쐻",
+  "쐼",
+  "쐽",
+  "쐾",
+  "쐿",
+  "쑀",
+  "쑁",
+  "쑂",
+  "쑃",
+  "쑄",
+  "쑅",
+  "쑆",
+  "쑇",
+  "쑈",
+  "쑉",
+  "쑊",
+  "쑋",
+  "쑌",
+  "쑍",
+  "쑎",
+  "쑏",
+  "쑐",
+  "쑑",
+  "쑒",
+  "쑓",
+  "쑔",
+  "쑕",
+  "쑖",
+  "쑗",
+  "쑘",
+  "쑙",
+  "쑚",
+  "쑛",
+  "쑜",
+  "쑝",
+  "쑞",
+  "쑟",
+  "쑠",
+  "쑡",
+  "쑢",
+  "쑣",
+  "쑤",
+  "쑥",
+  "쑦",
+  "쑧",
+  "쑨",
+  "쑩",
+  "쑪",
+  "쑫",
+  "쑬",
+  "쑭",
+  "쑮",
+  "쑯",
+  "쑰",
+  "쑱",
+  "쑲",
+  "쑳",
+  "쑴",
+  "쑵",
+  "쑶",
+  "쑷",
+  "쑸",
+  "쑹",
+  "쑺",
+  "쑻",
+  "쑼",
+  "쑽",
+  "쑾",
+  "쑿",
+  "쒀",
+  "쒁",
+  "쒂",
+  "쒃",
+  "쒄",
+  "쒅",
+  "쒆",
+  "쒇",
+  "쒈",
+  "쒉",
+  "쒊",
+  "쒋",
+  "쒌",
+  "쒍",
+  "쒎",
+  "쒏",
+  "쒐",
+  "쒑",
+  "쒒",
+  "쒓",
+  "쒔",
+  "쒕",
+  "쒖",
+  "쒗",
+  "쒘",
+  "쒙",
+  "쒚",
+  "쒛",
+  "쒜",
+  "쒝",
+  "쒞",
+  "쒟",
+  "쒠",
+  "쒡",
+  "쒢",
+  "쒣",
+  "쒤",
+  "쒥",
+  "쒦",
+  "쒧",
+  "쒨",
+  "쒩",
+  "쒪",
+  "쒫",
+  "쒬",
+  "쒭",
+  "쒮",
+  "쒯",
+  "쒰",
+  "쒱",
+  "쒲",
+  "쒳",
+  "쒴",
+  "쒵",
+  "쒶",
+  "쒷",
+  "쒸",
+  "쒹",
+  "쒺",
+  "쒻",
+  "쒼",
+  "쒽",
+  "쒾",
+  "쒿",
+  "쓀",
+  "쓁",
+  "쓂",
+  "쓃",
+  "쓄",
+  "쓅",
+  "쓆",
+  "쓇",
+  "쓈",
+  "쓉",
+  "쓊",
+  "쓋",
+  "쓌",
+  "쓍",
+  "쓎",
+  "쓏",
+  "쓐",
+  "쓑",
+  "쓒",
+  "쓓",
+  "쓔",
+  "쓕",
+  "쓖",
+  "쓗",
+  "쓘",
+  "쓙",
+  "쓚",
+  "쓛",
+  "쓜",
+  "쓝",
+  "쓞",
+  "쓟",
+  "쓠",
+  "쓡",
+  "쓢",
+  "쓣",
+  "쓤",
+  "쓥",
+  "쓦",
+  "쓧",
+  "쓨",
+  "쓩",
+  "쓪",
+  "쓫",
+  "쓬",
+  "쓭",
+  "쓮",
+  "쓯",
+  "쓰",
+  "쓱",
+  "쓲",
+  "쓳",
+  "쓴",
+  "쓵",
+  "쓶",
+  "쓷",
+  "쓸",
+  "쓹",
+  "쓺",
+  "쓻",
+  "쓼",
+  "쓽",
+  "쓾",
+  "쓿",
+  "씀",
+  "씁",
+  "씂",
+  "씃",
+  "씄",
+  "씅",
+  "씆",
+  "씇",
+  "씈",
+  "씉",
+  "씊",
+  "씋",
+  "씌",
+  "씍",
+  "씎",
+  "씏",
+  "씐",
+  "씑",
+  "씒",
+  "씓",
+  "씔",
+  "씕",
+  "씖",
+  "씗",
+  "씘",
+  "씙",
+  "씚",
+  "씛",
+  "씜",
+  "씝",
+  "씞",
+  "씟",
+  "씠",
+  "씡",
+  "씢",
+  "씣",
+  "씤",
+  "씥",
+  "씦",
+  "씧",
+  "씨",
+  "씩",
+  "씪",
+  "씫",
+  "씬",
+  "씭",
+  "씮",
+  "씯",
+  "씰",
+  "씱",
+  "씲",
+  "씳",
+  "씴",
+  "씵",
+  "씶",
+  "씷",
+  "씸",
+  "씹",
+  "씺",
+  "씻",
+  "씼",
+  "씽",
+  "씾",
+  "씿",
+  "앀",
+  "앁",
+  "앂",
+  "앃",
+  "아",
+  "악",
+  "앆",
+  "앇",
+  "안",
+  "앉",
+  "않",
+  "앋",
+  "알",
+  "앍",
+  "앎",
+  "앏",
+  "앐",
+  "앑",
+  "앒",
+  "앓",
+  "암",
+  "압",
+  "앖",
+  "앗",
+  "았",
+  "앙",
+  "앚",
+  "앛",
+  "앜",
+  "앝",
+  "앞",
+  "앟",
+  "애",
+  "액",
+  "앢",
+  "앣",
+  "앤",
+  "앥",
+  "앦",
+  "앧",
+  "앨",
+  "앩",
+  "앪",
+  "앫",
+  "앬",
+  "앭",
+  "앮",
+  "앯",
+  "앰",
+  "앱",
+  "앲",
+  "앳",
+  "앴",
+  "앵",
+  "앶",
+  "앷",
+  "앸",
+  "앹",
+  "앺",
+  "앻",
+  "야",
+  "약",
+  "앾",
+  "앿",
+  "얀",
+  "얁",
+  "얂",
+  "얃",
+  "얄",
+  "얅",
+  "얆",
+  "얇",
+  "얈",
+  "얉",
+  "얊",
+  "얋",
+  "얌",
+  "얍",
+  "얎",
+  "얏",
+  "얐",
+  "양",
+  "얒",
+  "얓",
+  "얔",
+  "얕",
+  "얖",
+  "얗",
+  "얘",
+  "얙",
+  "얚",
+  "얛",
+  "얜",
+  "얝",
+  "얞",
+  "얟",
+  "얠",
+  "얡",
+  "얢",
+  "얣",
+  "얤",
+  "얥",
+  "얦",
+  "얧",
+  "얨",
+  "얩",
+  "얪",
+  "얫",
+  "얬",
+  "얭",
+  "얮",
+  "얯",
+  "얰",
+  "얱",
+  "얲",
+  "얳",
+  "어",
+  "억",
+  "얶",
+  "얷",
+  "언",
+  "얹",
+  "얺",
+  "얻",
+  "얼",
+  "얽",
+  "얾",
+  "얿",
+  "엀",
+  "엁",
+  "엂",
+  "엃",
+  "엄",
+  "업",
+  "없",
+  "엇",
+  "었",
+  "엉",
+  "엊",
+  "엋",
+  "엌",
+  "엍",
+  "엎",
+  "엏",
+  "에",
+  "엑",
+  "엒",
+  "엓",
+  "엔",
+  "엕",
+  "엖",
+  "엗",
+  "엘",
+  "엙",
+  "엚",
+  "엛",
+  "엜",
+  "엝",
+  "엞",
+  "엟",
+  "엠",
+  "엡",
+  "엢",
+  "엣",
+  "엤",
+  "엥",
+  "엦",
+  "엧",
+  "엨",
+  "엩",
+  "엪",
+  "엫",
+  "여",
+  "역",
+  "엮",
+  "엯",
+  "연",
+  "엱",
+  "엲",
+  "엳",
+  "열",
+  "엵",
+  "엶",
+  "엷",
+  "엸",
+  "엹",
+  "엺",
+  "엻",
+  "염",
+  "엽",
+  "엾",
+  "엿",
+  "였",
+  "영",
+  "옂",
+  "옃",
+  "옄",
+  "옅",
+  "옆",
+  "옇",
+  "예",
+  "옉",
+  "옊",
+  "옋",
+  "옌",
+  "옍",
+  "옎",
+  "옏",
+  "옐",
+  "옑",
+  "옒",
+  "옓",
+  "옔",
+  "옕",
+  "옖",
+  "옗",
+  "옘",
+  "옙",
+  "옚",
+  "옛",
+  "옜",
+  "옝",
+  "옞",
+  "옟",
+  "옠",
+  "옡",
+  "옢",
+  "옣",
+  "오",
+  "옥",
+  "옦",
+  "옧",
+  "온",
+  "옩",
+  "옪",
+  "옫",
+  "올",
+  "옭",
+  "옮",
+  "옯",
+  "옰",
+  "옱",
+  "옲",
+  "옳",
+  "옴",
+  "옵",
+  "옶",
+  "옷",
+  "옸",
+  "옹",
+  "옺",
+  "옻",
+  "옼",
+  "옽",
+  "옾",
+  "옿",
+  "와",
+  "왁",
+  "왂",
+  "왃",
+  "완",
+  "왅",
+  "왆",
+  "왇",
+  "왈",
+  "왉",
+  "왊",
+  "왋",
+  "왌",
+  "왍",
+  "왎",
+  "왏",
+  "왐",
+  "왑",
+  "왒",
+  "왓",
+  "왔",
+  "왕",
+  "왖",
+  "왗",
+  "왘",
+  "왙",
+  "왚",
+  "왛",
+  "왜",
+  "왝",
+  "왞",
+  "왟",
+  "왠",
+  "왡",
+  "왢",
+  "왣",
+  "왤",
+  "왥",
+  "왦",
+  "왧",
+  "왨",
+  "왩",
+  "왪",
+  "왫",
+  "왬",
+  "왭",
+  "왮",
+  "왯",
+  "왰",
+  "왱",
+  "왲",
+  "왳",
+  "왴",
+  "왵",
+  "왶",
+  "왷",
+  "외",
+  "왹",
+  "왺",
+  "왻",
+  "왼",
+  "왽",
+  "왾",
+  "왿",
+  "욀",
+  "욁",
+  "욂",
+  "욃",
+  "욄",
+  "욅",
+  "욆",
+  "욇",
+  "욈",
+  "욉",
+  "욊",
+  "욋",
+  "욌",
+  "욍",
+  "욎",
+  "욏",
+  "욐",
+  "욑",
+  "욒",
+  "욓",
+  "요",
+  "욕",
+  "욖",
+  "욗",
+  "욘",
+  "욙",
+  "욚",
+  "욛",
+  "욜",
+  "욝",
+  "욞",
+  "욟",
+  "욠",
+  "욡",
+  "욢",
+  "욣",
+  "욤",
+  "욥",
+  "욦",
+  "욧",
+  "욨",
+  "용",
+  "욪",
+  "욫",
+  "욬",
+  "욭",
+  "욮",
+  "욯",
+  "우",
+  "욱",
+  "욲",
+  "욳",
+  "운",
+  "욵",
+  "욶",
+  "욷",
+  "울",
+  "욹",
+  "욺",
+  "욻",
+  "욼",
+  "욽",
+  "욾",
+  "욿",
+  "움",
+  "웁",
+  "웂",
+  "웃",
+  "웄",
+  "웅",
+  "웆",
+  "웇",
+  "웈",
+  "웉",
+  "웊",
+  "웋",
+  "워",
+  "웍",
+  "웎",
+  "웏",
+  "원",
+  "웑",
+  "웒",
+  "웓",
+  "월",
+  "웕",
+  "웖",
+  "웗",
+  "웘",
+  "웙",
+  "웚",
+  "웛",
+  "웜",
+  "웝",
+  "웞",
+  "웟",
+  "웠",
+  "웡",
+  "웢",
+  "웣",
+  "웤",
+  "웥",
+  "웦",
+  "웧",
+  "웨",
+  "웩",
+  "웪",
+  "웫",
+  "웬",
+  "웭",
+  "웮",
+  "웯",
+  "웰",
+  "웱",
+  "웲",
+  "웳",
+  "웴",
+  "웵",
+  "웶",
+  "웷",
+  "웸",
+  "웹",
+  "웺",
+  "웻",
+  "웼",
+  "웽",
+  "웾",
+  "웿",
+  "윀",
+  "윁",
+  "윂",
+  "윃",
+  "위",
+  "윅",
+  "윆",
+  "윇",
+  "윈",
+  "윉",
+  "윊",
+  "윋",
+  "윌",
+  "윍",
+  "윎",
+  "윏",
+  "윐",
+  "윑",
+  "윒",
+  "윓",
+  "윔",
+  "윕",
+  "윖",
+  "윗",
+  "윘",
+  "윙",
+  "윚",
+  "윛",
+  "윜",
+  "윝",
+  "윞",
+  "윟",
+  "유",
+  "육",
+  "윢",
+  "윣",
+  "윤",
+  "윥",
+  "윦",
+  "윧",
+  "율",
+  "윩",
+  "윪",
+  "윫",
+  "윬",
+  "윭",
+  "윮",
+  "윯",
+  "윰",
+  "윱",
+  "윲",
+  "윳",
+  "윴",
+  "융",
+  "윶",
+  "윷",
+  "윸",
+  "윹",
+  "윺",
+  "윻",
+  "으",
+  "윽",
+  "윾",
+  "윿",
+  "은",
+  "읁",
+  "읂",
+  "읃",
+  "을",
+  "읅",
+  "읆",
+  "읇",
+  "읈",
+  "읉",
+  "읊",
+  "읋",
+  "음",
+  "읍",
+  "읎",
+  "읏",
+  "읐",
+  "응",
+  "읒",
+  "읓",
+  "읔",
+  "읕",
+  "읖",
+  "읗",
+  "의",
+  "읙",
+  "읚",
+  "읛",
+  "읜",
+  "읝",
+  "읞",
+  "읟",
+  "읠",
+  "읡",
+  "읢",
+  "읣",
+  "읤",
+  "읥",
+  "읦",
+  "읧",
+  "읨",
+  "읩",
+  "읪",
+  "읫",
+  "읬",
+  "읭",
+  "읮",
+  "읯",
+  "읰",
+  "읱",
+  "읲",
+  "읳",
+  "이",
+  "익",
+  "읶",
+  "읷",
+  "인",
+  "읹",
+  "읺",
+  "읻",
+  "일",
+  "읽",
+  "읾",
+  "읿",
+  "잀",
+  "잁",
+  "잂",
+  "잃",
+  "임",
+  "입",
+  "잆",
+  "잇",
+  "있",
+  "잉",
+  "잊",
+  "잋",
+  "잌",
+  "잍",
+  "잎",
+  "잏",
+  "자",
+  "작",
+  "잒",
+  "잓",
+  "잔",
+  "잕",
+  "잖",
+  "잗",
+  "잘",
+  "잙",
+  "잚",
+  "잛",
+  "잜",
+  "잝",
+  "잞",
+  "잟",
+  "잠",
+  "잡",
+  "잢",
+  "잣",
+  "잤",
+  "장",
+  "잦",
+  "잧",
+  "잨",
+  "잩",
+  "잪",
+  "잫",
+  "재",
+  "잭",
+  "잮",
+  "잯",
+  "잰",
+  "잱",
+  "잲",
+  "잳",
+  "잴",
+  "잵",
+  "잶",
+  "잷",
+  "잸",
+  "잹",
+  "잺",
+  "잻",
+  "잼",
+  "잽",
+  "잾",
+  "잿",
+  "쟀",
+  "쟁",
+  "쟂",
+  "쟃",
+  "쟄",
+  "쟅",
+  "쟆",
+  "쟇",
+  "쟈",
+  "쟉",
+  "쟊",
+  "쟋",
+  "쟌",
+  "쟍",
+  "쟎",
+  "쟏",
+  "쟐",
+  "쟑",
+  "쟒",
+  "쟓",
+  "쟔",
+  "쟕",
+  "쟖",
+  "쟗",
+  "쟘",
+  "쟙",
+  "쟚",
+  "쟛",
+  "쟜",
+  "쟝",
+  "쟞",
+  "쟟",
+  "쟠",
+  "쟡",
+  "쟢",
+  "쟣",
+  "쟤",
+  "쟥",
+  "쟦",
+  "쟧",
+  "쟨",
+  "쟩",
+  "쟪",
+  "쟫",
+  "쟬",
+  "쟭",
+  "쟮",
+  "쟯",
+  "쟰",
+  "쟱",
+  "쟲",
+  "쟳",
+  "쟴",
+  "쟵",
+  "쟶",
+  "쟷",
+  "쟸",
+  "쟹",
+  "쟺",
+  "쟻",
+  "쟼",
+  "쟽",
+  "쟾",
+  "쟿",
+  "저",
+  "적",
+  "젂",
+  "젃",
+  "전",
+  "젅",
+  "젆",
+  "젇",
+  "절",
+  "젉",
+  "젊",
+  "젋",
+  "젌",
+  "젍",
+  "젎",
+  "젏",
+  "점",
+  "접",
+  "젒",
+  "젓",
+  "젔",
+  "정",
+  "젖",
+  "젗",
+  "젘",
+  "젙",
+  "젚",
+  "젛",
+  "제",
+  "젝",
+  "젞",
+  "젟",
+  "젠",
+  "젡",
+  "젢",
+  "젣",
+  "젤",
+  "젥",
+  "젦",
+  "젧",
+  "젨",
+  "젩",
+  "젪",
+  "젫",
+  "젬",
+  "젭",
+  "젮",
+  "젯",
+  "젰",
+  "젱",
+  "젲",
+  "젳",
+  "젴",
+  "젵",
+  "젶",
+  "젷",
+  "져",
+  "젹",
+  "젺",
+  "젻",
+  "젼",
+  "젽",
+  "젾",
+  "젿",
+  "졀",
+  "졁",
+  "졂",
+  "졃",
+  "졄",
+  "졅",
+  "졆",
+  "졇",
+  "졈",
+  "졉",
+  "졊",
+  "졋",
+  "졌",
+  "졍",
+  "졎",
+  "졏",
+  "졐",
+  "졑",
+  "졒",
+  "졓",
+  "졔",
+  "졕",
+  "졖",
+  "졗",
+  "졘",
+  "졙",
+  "졚",
+  "졛",
+  "졜",
+  "졝",
+  "졞",
+  "졟",
+  "졠",
+  "졡",
+  "졢",
+  "졣",
+  "졤",
+  "졥",
+  "졦",
+  "졧",
+  "졨",
+  "졩",
+  "졪",
+  "졫",
+  "졬",
+  "졭",
+  "졮",
+  "졯",
+  "조",
+  "족",
+  "졲",
+  "졳",
+  "존",
+  "졵",
+  "졶",
+  "졷",
+  "졸",
+  "졹",
+  "졺",
+  "졻",
+  "졼",
+  "졽",
+  "졾",
+  "졿",
+  "좀",
+  "좁",
+  "좂",
+  "좃",
+  "좄",
+  "종",
+  "좆",
+  "좇",
+  "좈",
+  "좉",
+  "좊",
+  "좋",
+  "좌",
+  "좍",
+  "좎",
+  "좏",
+  "좐",
+  "좑",
+  "좒",
+  "좓",
+  "좔",
+  "좕",
+  "좖",
+  "좗",
+  "좘",
+  "좙",
+  "좚",
+  "좛",
+  "좜",
+  "좝",
+  "좞",
+  "좟",
+  "좠",
+  "좡",
+  "좢",
+  "좣",
+  "좤",
+  "좥",
+  "좦",
+  "좧",
+  "좨",
+  "좩",
+  "좪",
+  "좫",
+  "좬",
+  "좭",
+  "좮",
+  "좯",
+  "좰",
+  "좱",
+  "좲",
+  "좳",
+  "좴",
+  "좵",
+  "좶",
+  "좷",
+  "좸",
+  "좹",
+  "좺",
+  "좻",
+  "좼",
+  "좽",
+  "좾",
+  "좿",
+  "죀",
+  "죁",
+  "죂",
+  "죃",
+  "죄",
+  "죅",
+  "죆",
+  "죇",
+  "죈",
+  "죉",
+  "죊",
+  "죋",
+  "죌",
+  "죍",
+  "죎",
+  "죏",
+  "죐",
+  "죑",
+  "죒",
+  "죓",
+  "죔",
+  "죕",
+  "죖",
+  "죗",
+  "죘",
+  "죙",
+  "죚",
+  "죛",
+  "죜",
+  "죝",
+  "죞",
+  "죟",
+  "죠",
+  "죡",
+  "죢",
+  "죣",
+  "죤",
+  "죥",
+  "죦",
+  "죧",
+  "죨",
+  "죩",
+  "죪",
+  "죫",
+  "죬",
+  "죭",
+  "죮",
+  "죯",
+  "죰",
+  "죱",
+  "죲",
+  "죳",
+  "죴",
+  "죵",
+  "죶",
+  "죷",
+  "죸",
+  "죹",
+  "죺",
+  "죻",
+  "주",
+  "죽",
+  "죾",
+  "죿",
+  "준",
+  "줁",
+  "줂",
+  "줃",
+  "줄",
+  "줅",
+  "줆",
+  "줇",
+  "줈",
+  "줉",
+  "줊",
+  "줋",
+  "줌",
+  "줍",
+  "줎",
+  "줏",
+  "줐",
+  "중",
+  "줒",
+  "줓",
+  "줔",
+  "줕",
+  "줖",
+  "줗",
+  "줘",
+  "줙",
+  "줚",
+  "줛",
+  "줜",
+  "줝",
+  "줞",
+  "줟",
+  "줠",
+  "줡",
+  "줢",
+  "줣",
+  "줤",
+  "줥",
+  "줦",
+  "줧",
+  "줨",
+  "줩",
+  "줪",
+  "줫",
+  "줬",
+  "줭",
+  "줮",
+  "줯",
+  "줰",
+  "줱",
+  "줲",
+  "줳",
+  "줴",
+  "줵",
+  "줶",
+  "줷",
+  "줸",
+  "줹",
+  "줺",
+  "줻",
+  "줼",
+  "줽",
+  "줾",
+  "줿",
+  "쥀",
+  "쥁",
+  "쥂",
+  "쥃",
+  "쥄",
+  "쥅",
+  "쥆",
+  "쥇",
+  "쥈",
+  "쥉",
+  "쥊",
+  "쥋",
+  "쥌",
+  "쥍",
+  "쥎",
+  "쥏",
+  "쥐",
+  "쥑",
+  "쥒",
+  "쥓",
+  "쥔",
+  "쥕",
+  "쥖",
+  "쥗",
+  "쥘",
+  "쥙",
+  "쥚",
+  "쥛",
+  "쥜",
+  "쥝",
+  "쥞",
+  "쥟",
+  "쥠",
+  "쥡",
+  "쥢",
+  "쥣",
+  "쥤",
+  "쥥",
+  "쥦",
+  "쥧",
+  "쥨",
+  "쥩",
+  "쥪",
+  "쥫",
+  "쥬",
+  "쥭",
+  "쥮",
+  "쥯",
+  "쥰",
+  "쥱",
+  "쥲",
+  "쥳",
+  "쥴",
+  "쥵",
+  "쥶",
+  "쥷",
+  "쥸",
+  "쥹",
+  "쥺",
+  "쥻",
+  "쥼",
+  "쥽",
+  "쥾",
+  "쥿",
+  "즀",
+  "즁",
+  "즂",
+  "즃",
+  "즄",
+  "즅",
+  "즆",
+  "즇",
+  "즈",
+  "즉",
+  "즊",
+  "즋",
+  "즌",
+  "즍",
+  "즎",
+  "즏",
+  "즐",
+  "즑",
+  "즒",
+  "즓",
+  "즔",
+  "즕",
+  "즖",
+  "즗",
+  "즘",
+  "즙",
+  "즚",
+  "즛",
+  "즜",
+  "증",
+  "즞",
+  "즟",
+  "즠",
+  "즡",
+  "즢",
+  "즣",
+  "즤",
+  "즥",
+  "즦",
+  "즧",
+  "즨",
+  "즩",
+  "즪",
+  "즫",
+  "즬",
+  "즭",
+  "즮",
+  "즯",
+  "즰",
+  "즱",
+  "즲",
+  "즳",
+  "즴",
+  "즵",
+  "즶",
+  "즷",
+  "즸",
+  "즹",
+  "즺",
+  "즻",
+  "즼",
+  "즽",
+  "즾",
+  "즿",
+  "지",
+  "직",
+  "짂",
+  "짃",
+  "진",
+  "짅",
+  "짆",
+  "짇",
+  "질",
+  "짉",
+  "짊",
+  "짋",
+  "짌",
+  "짍",
+  "짎",
+  "짏",
+  "짐",
+  "집",
+  "짒",
+  "짓",
+  "짔",
+  "징",
+  "짖",
+  "짗",
+  "짘",
+  "짙",
+  "짚",
+  "짛",
+  "짜",
+  "짝",
+  "짞",
+  "짟",
+  "짠",
+  "짡",
+  "짢",
+  "짣",
+  "짤",
+  "짥",
+  "짦",
+  "짧",
+  "짨",
+  "짩",
+  "짪",
+  "짫",
+  "짬",
+  "짭",
+  "짮",
+  "짯",
+  "짰",
+  "짱",
+  "짲",
+  "짳",
+  "짴",
+  "짵",
+  "짶",
+  "짷",
+  "째",
+  "짹",
+  "짺",
+  "짻",
+  "짼",
+  "짽",
+  "짾",
+  "짿",
+  "쨀",
+  "쨁",
+  "쨂",
+  "쨃",
+  "쨄",
+  "쨅",
+  "쨆",
+  "쨇",
+  "쨈",
+  "쨉",
+  "쨊",
+  "쨋",
+  "쨌",
+  "쨍",
+  "쨎",
+  "쨏",
+  "쨐",
+  "쨑",
+  "쨒",
+  "쨓",
+  "쨔",
+  "쨕",
+  "쨖",
+  "쨗",
+  "쨘",
+  "쨙",
+  "쨚",
+  "쨛",
+  "쨜",
+  "쨝",
+  "쨞",
+  "쨟",
+  "쨠",
+  "쨡",
+  "쨢",
+  "쨣",
+  "쨤",
+  "쨥",
+  "쨦",
+  "쨧",
+  "쨨",
+  "쨩",
+  "쨪",
+  "쨫",
+  "쨬",
+  "쨭",
+  "쨮",
+  "쨯",
+  "쨰",
+  "쨱",
+  "쨲",
+  "쨳",
+  "쨴",
+  "쨵",
+  "쨶",
+  "쨷",
+  "쨸",
+  "쨹",
+  "쨺",
+  "쨻",
+  "쨼",
+  "쨽",
+  "쨾",
+  "쨿",
+  "쩀",
+  "쩁",
+  "쩂",
+  "쩃",
+  "쩄",
+  "쩅",
+  "쩆",
+  "쩇",
+  "쩈",
+  "쩉",
+  "쩊",
+  "쩋",
+  "쩌",
+  "쩍",
+  "쩎",
+  "쩏",
+  "쩐",
+  "쩑",
+  "쩒",
+  "쩓",
+  "쩔",
+  "쩕",
+  "쩖",
+  "쩗",
+  "쩘",
+  "쩙",
+  "쩚",
+  "쩛",
+  "쩜",
+  "쩝",
+  "쩞",
+  "쩟",
+  "쩠",
+  "쩡",
+  "쩢",
+  "쩣",
+  "쩤",
+  "쩥",
+  "쩦",
+  "쩧",
+  "쩨",
+  "쩩",
+  "쩪",
+  "쩫",
+  "쩬",
+  "쩭",
+  "쩮",
+  "쩯",
+  "쩰",
+  "쩱",
+  "쩲",
+  "쩳",
+  "쩴",
+  "쩵",
+  "쩶",
+  "쩷",
+  "쩸",
+  "쩹",
+  "쩺",
+  "쩻",
+  "쩼",
+  "쩽",
+  "쩾",
+  "쩿",
+  "쪀",
+  "쪁",
+  "쪂",
+  "쪃",
+  "쪄",
+  "쪅",
+  "쪆",
+  "쪇",
+  "쪈",
+  "쪉",
+  "쪊",
+  "쪋",
+  "쪌",
+  "쪍",
+  "쪎",
+  "쪏",
+  "쪐",
+  "쪑",
+  "쪒",
+  "쪓",
+  "쪔",
+  "쪕",
+  "쪖",
+  "쪗",
+  "쪘",
+  "쪙",
+  "쪚",
+  "쪛",
+  "쪜",
+  "쪝",
+  "쪞",
+  "쪟",
+  "쪠",
+  "쪡",
+  "쪢",
+  "쪣",
+  "쪤",
+  "쪥",
+  "쪦",
+  "쪧",
+  "쪨",
+  "쪩",
+  "쪪",
+  "쪫",
+  "쪬",
+  "쪭",
+  "쪮",
+  "쪯",
+  "쪰",
+  "쪱",
+  "쪲",
+  "쪳",
+  "쪴",
+  "쪵",
+  "쪶",
+  "쪷",
+  "쪸",
+  "쪹",
+  "쪺",
+  "쪻",
+  "쪼",
+  "쪽",
+  "쪾",
+  "쪿",
+  "쫀",
+  "쫁",
+  "쫂",
+  "쫃",
+  "쫄",
+  "쫅",
+  "쫆",
+  "쫇",
+  "쫈",
+  "쫉",
+  "쫊",
+  "쫋",
+  "쫌",
+  "쫍",
+  "쫎",
+  "쫏",
+  "쫐",
+  "쫑",
+  "쫒",
+  "쫓",
+  "쫔",
+  "쫕",
+  "쫖",
+  "쫗",
+  "쫘",
+  "쫙",
+  "쫚",
+  "쫛",
+  "쫜",
+  "쫝",
+  "쫞",
+  "쫟",
+  "쫠",
+  "쫡",
+  "쫢",
+  "쫣",
+  "쫤",
+  "쫥",
+  "쫦",
+  "쫧",
+  "쫨",
+  "쫩",
+  "쫪",
+  "쫫",
+  "쫬",
+  "쫭",
+  "쫮",
+  "쫯",
+  "쫰",
+  "쫱",
+  "쫲",
+  "쫳",
+  "쫴",
+  "쫵",
+  "쫶",
+  "쫷",
+  "쫸",
+  "쫹",
+  "쫺",
+  "쫻",
+  "쫼",
+  "쫽",
+  "쫾",
+  "쫿",
+  "쬀",
+  "쬁",
+  "쬂",
+  "쬃",
+  "쬄",
+  "쬅",
+  "쬆",
+  "쬇",
+  "쬈",
+  "쬉",
+  "쬊",
+  "쬋",
+  "쬌",
+  "쬍",
+  "쬎",
+  "쬏",
+  "쬐",
+  "쬑",
+  "쬒",
+  "쬓",
+  "쬔",
+  "쬕",
+  "쬖",
+  "쬗",
+  "쬘",
+  "쬙",
+  "쬚",
+  "쬛",
+  "쬜",
+  "쬝",
+  "쬞",
+  "쬟",
+  "쬠",
+  "쬡",
+  "쬢",
+  "쬣",
+  "쬤",
+  "쬥",
+  "쬦",
+  "쬧",
+  "쬨",
+  "쬩",
+  "쬪",
+  "쬫",
+  "쬬",
+  "쬭",
+  "쬮",
+  "쬯",
+  "쬰",
+  "쬱",
+  "쬲",
+  "쬳",
+  "쬴",
+  "쬵",
+  "쬶",
+  "쬷",
+  "쬸",
+  "쬹",
+  "쬺",
+  "쬻",
+  "쬼",
+  "쬽",
+  "쬾",
+  "쬿",
+  "쭀",
+  "쭁",
+  "쭂",
+  "쭃",
+  "쭄",
+  "쭅",
+  "쭆",
+  "쭇",
+  "쭈",
+  "쭉",
+  "쭊",
+  "쭋",
+  "쭌",
+  "쭍",
+  "쭎",
+  "쭏",
+  "쭐",
+  "쭑",
+  "쭒",
+  "쭓",
+  "쭔",
+  "쭕",
+  "쭖",
+  "쭗",
+  "쭘",
+  "쭙",
+  "쭚",
+  "쭛",
+  "쭜",
+  "쭝",
+  "쭞",
+  "쭟",
+  "쭠",
+  "쭡",
+  "쭢",
+  "쭣",
+  "쭤",
+  "쭥",
+  "쭦",
+  "쭧",
+  "쭨",
+  "쭩",
+  "쭪",
+  "쭫",
+  "쭬",
+  "쭭",
+  "쭮",
+  "쭯",
+  "쭰",
+  "쭱",
+  "쭲",
+  "쭳",
+  "쭴",
+  "쭵",
+  "쭶",
+  "쭷",
+  "쭸",
+  "쭹",
+  "쭺",
+  "쭻",
+  "쭼",
+  "쭽",
+  "쭾",
+  "쭿",
+  "쮀",
+  "쮁",
+  "쮂",
+  "쮃",
+  "쮄",
+  "쮅",
+  "쮆",
+  "쮇",
+  "쮈",
+  "쮉",
+  "쮊",
+  "쮋",
+  "쮌",
+  "쮍",
+  "쮎",
+  "쮏",
+  "쮐",
+  "쮑",
+  "쮒",
+  "쮓",
+  "쮔",
+  "쮕",
+  "쮖",
+  "쮗",
+  "쮘",
+  "쮙",
+  "쮚",
+  "쮛",
+  "쮜",
+  "쮝",
+  "쮞",
+  "쮟",
+  "쮠",
+  "쮡",
+  "쮢",
+  "쮣",
+  "쮤",
+  "쮥",
+  "쮦",
+  "쮧",
+  "쮨",
+  "쮩",
+  "쮪",
+  "쮫",
+  "쮬",
+  "쮭",
+  "쮮",
+  "쮯",
+  "쮰",
+  "쮱",
+  "쮲",
+  "쮳",
+  "쮴",
+  "쮵",
+  "쮶",
+  "쮷",
+  "쮸",
+  "쮹",
+  "쮺",
+  "쮻",
+  "쮼",
+  "쮽",
+  "쮾",
+  "쮿",
+  "쯀",
+  "쯁",
+  "쯂",
+  "쯃",
+  "쯄",
+  "쯅",
+  "쯆",
+  "쯇",
+  "쯈",
+  "쯉",
+  "쯊",
+  "쯋",
+  "쯌",
+  "쯍",
+  "쯎",
+  "쯏",
+  "쯐",
+  "쯑",
+  "쯒",
+  "쯓",
+  "쯔",
+  "쯕",
+  "쯖",
+  "쯗",
+  "쯘",
+  "쯙",
+  "쯚",
+  "쯛",
+  "쯜",
+  "쯝",
+  "쯞",
+  "쯟",
+  "쯠",
+  "쯡",
+  "쯢",
+  "쯣",
+  "쯤",
+  "쯥",
+  "쯦",
+  "쯧",
+  "쯨",
+  "쯩",
+  "쯪",
+  "쯫",
+  "쯬",
+  "쯭",
+  "쯮",
+  "쯯",
+  "쯰",
+  "쯱",
+  "쯲",
+  "쯳",
+  "쯴",
+  "쯵",
+  "쯶",
+  "쯷",
+  "쯸",
+  "쯹",
+  "쯺",
+  "쯻",
+  "쯼",
+  "쯽",
+  "쯾",
+  "쯿",
+  "찀",
+  "찁",
+  "찂",
+  "찃",
+  "찄",
+  "찅",
+  "찆",
+  "찇",
+  "찈",
+  "찉",
+  "찊",
+  "찋",
+  "찌",
+  "찍",
+  "찎",
+  "찏",
+  "찐",
+  "찑",
+  "찒",
+  "찓",
+  "찔",
+  "찕",
+  "찖",
+  "찗",
+  "찘",
+  "찙",
+  "찚",
+  "찛",
+  "찜",
+  "찝",
+  "찞",
+  "찟",
+  "찠",
+  "찡",
+  "찢",
+  "찣",
+  "찤",
+  "찥",
+  "찦",
+  "찧",
+  "차",
+  "착",
+  "찪",
+  "찫",
+  "찬",
+  "찭",
+  "찮",
+  "찯",
+  "찰",
+  "찱",
+  "찲",
+  "찳",
+  "찴",
+  "찵",
+  "찶",
+  "찷",
+  "참",
+  "찹",
+  "찺",
+  "찻",
+  "찼",
+  "창",
+  "찾",
+  "찿",
+  "챀",
+  "챁",
+  "챂",
+  "챃",
+  "채",
+  "책",
+  "챆",
+  "챇",
+  "챈",
+  "챉",
+  "챊",
+  "챋",
+  "챌",
+  "챍",
+  "챎",
+  "챏",
+  "챐",
+  "챑",
+  "챒",
+  "챓",
+  "챔",
+  "챕",
+  "챖",
+  "챗",
+  "챘",
+  "챙",
+  "챚",
+  "챛",
+  "챜",
+  "챝",
+  "챞",
+  "챟",
+  "챠",
+  "챡",
+  "챢",
+  "챣",
+  "챤",
+  "챥",
+  "챦",
+  "챧",
+  "챨",
+  "챩",
+  "챪",
+  "챫",
+  "챬",
+  "챭",
+  "챮",
+  "챯",
+  "챰",
+  "챱",
+  "챲",
+  "챳",
+  "챴",
+  "챵",
+  "챶",
+  "챷",
+  "챸",
+  "챹",
+  "챺",
+  "챻",
+  "챼",
+  "챽",
+  "챾",
+  "챿",
+  "첀",
+  "첁",
+  "첂",
+  "첃",
+  "첄",
+  "첅",
+  "첆",
+  "첇",
+  "첈",
+  "첉",
+  "첊",
+  "첋",
+  "첌",
+  "첍",
+  "첎",
+  "첏",
+  "첐",
+  "첑",
+  "첒",
+  "첓",
+  "첔",
+  "첕",
+  "첖",
+  "첗",
+  "처",
+  "척",
+  "첚",
+  "첛",
+  "천",
+  "첝",
+  "첞",
+  "첟",
+  "철",
+  "첡",
+  "첢",
+  "첣",
+  "첤",
+  "첥",
+  "첦",
+  "첧",
+  "첨",
+  "첩",
+  "첪",
+  "첫",
+  "첬",
+  "청",
+  "첮",
+  "첯",
+  "첰",
+  "첱",
+  "첲",
+  "첳",
+  "체",
+  "첵",
+  "첶",
+  "첷",
+  "첸",
+  "첹",
+  "첺",
+  "첻",
+  "첼",
+  "첽",
+  "첾",
+  "첿",
+  "쳀",
+  "쳁",
+  "쳂",
+  "쳃",
+  "쳄",
+  "쳅",
+  "쳆",
+  "쳇",
+  "쳈",
+  "쳉",
+  "쳊",
+  "쳋",
+  "쳌",
+  "쳍",
+  "쳎",
+  "쳏",
+  "쳐",
+  "쳑",
+  "쳒",
+  "쳓",
+  "쳔",
+  "쳕",
+  "쳖",
+  "쳗",
+  "쳘",
+  "쳙",
+  "쳚",
+  "쳛",
+  "쳜",
+  "쳝",
+  "쳞",
+  "쳟",
+  "쳠",
+  "쳡",
+  "쳢",
+  "쳣",
+  "쳤",
+  "쳥",
+  "쳦",
+  "쳧",
+  "쳨",
+  "쳩",
+  "쳪",
+  "쳫",
+  "쳬",
+  "쳭",
+  "쳮",
+  "쳯",
+  "쳰",
+  "쳱",
+  "쳲",
+  "쳳",
+  "쳴",
+  "쳵",
+  "쳶",
+  "쳷",
+  "쳸",
+  "쳹",
+  "쳺",
+  "쳻",
+  "쳼",
+  "쳽",
+  "쳾",
+  "쳿",
+  "촀",
+  "촁",
+  "촂",
+  "촃",
+  "촄",
+  "촅",
+  "촆",
+  "촇",
+  "초",
+  "촉",
+  "촊",
+  "촋",
+  "촌",
+  "촍",
+  "촎",
+  "촏",
+  "촐",
+  "촑",
+  "촒",
+  "촓",
+  "촔",
+  "촕",
+  "촖",
+  "촗",
+  "촘",
+  "촙",
+  "촚",
+  "촛",
+  "촜",
+  "총",
+  "촞",
+  "촟",
+  "촠",
+  "촡",
+  "촢",
+  "촣",
+  "촤",
+  "촥",
+  "촦",
+  "촧",
+  "촨",
+  "촩",
+  "촪",
+  "촫",
+  "촬",
+  "촭",
+  "촮",
+  "촯",
+  "촰",
+  "촱",
+  "촲",
+  "촳",
+  "촴",
+  "촵",
+  "촶",
+  "촷",
+  "촸",
+  "촹",
+  "촺",
+  "촻",
+  "촼",
+  "촽",
+  "촾",
+  "촿",
+  "쵀",
+  "쵁",
+  "쵂",
+  "쵃",
+  "쵄",
+  "쵅",
+  "쵆",
+  "쵇",
+  "쵈",
+  "쵉",
+  "쵊",
+  "쵋",
+  "쵌",
+  "쵍",
+  "쵎",
+  "쵏",
+  "쵐",
+  "쵑",
+  "쵒",
+  "쵓",
+  "쵔",
+  "쵕",
+  "쵖",
+  "쵗",
+  "쵘",
+  "쵙",
+  "쵚",
+  "쵛",
+  "최",
+  "쵝",
+  "쵞",
+  "쵟",
+  "쵠",
+  "쵡",
+  "쵢",
+  "쵣",
+  "쵤",
+  "쵥",
+  "쵦",
+  "쵧",
+  "쵨",
+  "쵩",
+  "쵪",
+  "쵫",
+  "쵬",
+  "쵭",
+  "쵮",
+  "쵯",
+  "쵰",
+  "쵱",
+  "쵲",
+  "쵳",
+  "쵴",
+  "쵵",
+  "쵶",
+  "쵷",
+  "쵸",
+  "쵹",
+  "쵺",
+  "쵻",
+  "쵼",
+  "쵽",
+  "쵾",
+  "쵿",
+  "춀",
+  "춁",
+  "춂",
+  "춃",
+  "춄",
+  "춅",
+  "춆",
+  "춇",
+  "춈",
+  "춉",
+  "춊",
+  "춋",
+  "춌",
+  "춍",
+  "춎",
+  "춏",
+  "춐",
+  "춑",
+  "춒",
+  "춓",
+  "추",
+  "축",
+  "춖",
+  "춗",
+  "춘",
+  "춙",
+  "춚",
+  "춛",
+  "출",
+  "춝",
+  "춞",
+  "춟",
+  "춠",
+  "춡",
+  "춢",
+  "춣",
+  "춤",
+  "춥",
+  "춦",
+  "춧",
+  "춨",
+  "충",
+  "춪",
+  "춫",
+  "춬",
+  "춭",
+  "춮",
+  "춯",
+  "춰",
+  "춱",
+  "춲",
+  "춳",
+  "춴",
+  "춵",
+  "춶",
+  "춷",
+  "춸",
+  "춹",
+  "춺",
+  "춻",
+  "춼",
+  "춽",
+  "춾",
+  "춿",
+  "췀",
+  "췁",
+  "췂",
+  "췃",
+  "췄",
+  "췅",
+  "췆",
+  "췇",
+  "췈",
+  "췉",
+  "췊",
+  "췋",
+  "췌",
+  "췍",
+  "췎",
+  "췏",
+  "췐",
+  "췑",
+  "췒",
+  "췓",
+  "췔",
+  "췕",
+  "췖",
+  "췗",
+  "췘",
+  "췙",
+  "췚",
+  "췛",
+  "췜",
+  "췝",
+  "췞",
+  "췟",
+  "췠",
+  "췡",
+  "췢",
+  "췣",
+  "췤",
+  "췥",
+  "췦",
+  "췧",
+  "취",
+  "췩",
+  "췪",
+  "췫",
+  "췬",
+  "췭",
+  "췮",
+  "췯",
+  "췰",
+  "췱",
+  "췲",
+  "췳",
+  "췴",
+  "췵",
+  "췶",
+  "췷",
+  "췸",
+  "췹",
+  "췺",
+  "췻",
+  "췼",
+  "췽",
+  "췾",
+  "췿",
+  "츀",
+  "츁",
+  "츂",
+  "츃",
+  "츄",
+  "츅",
+  "츆",
+  "츇",
+  "츈",
+  "츉",
+  "츊",
+  "츋",
+  "츌",
+  "츍",
+  "츎",
+  "츏",
+  "츐",
+  "츑",
+  "츒",
+  "츓",
+  "츔",
+  "츕",
+  "츖",
+  "츗",
+  "츘",
+  "츙",
+  "츚",
+  "츛",
+  "츜",
+  "츝",
+  "츞",
+  "츟",
+  "츠",
+  "측",
+  "츢",
+  "츣",
+  "츤",
+  "츥",
+  "츦",
+  "츧",
+  "츨",
+  "츩",
+  "츪",
+  "츫",
+  "츬",
+  "츭",
+  "츮",
+  "츯",
+  "츰",
+  "츱",
+  "츲",
+  "츳",
+  "츴",
+  "층",
+  "츶",
+  "츷",
+  "츸",
+  "츹",
+  "츺",
+  "츻",
+  "츼",
+  "츽",
+  "츾",
+  "츿",
+  "칀",
+  "칁",
+  "칂",
+  "칃",
+  "칄",
+  "칅",
+  "칆",
+  "칇",
+  "칈",
+  "칉",
+  "칊",
+  "칋",
+  "칌",
+  "칍",
+  "칎",
+  "칏",
+  "칐",
+  "칑",
+  "칒",
+  "칓",
+  "칔",
+  "칕",
+  "칖",
+  "칗",
+  "치",
+  "칙",
+  "칚",
+  "칛",
+  "친",
+  "칝",
+  "칞",
+  "칟",
+  "칠",
+  "칡",
+  "칢",
+  "칣",
+  "칤",
+  "칥",
+  "칦",
+  "칧",
+  "침",
+  "칩",
+  "칪",
+  "칫",
+  "칬",
+  "칭",
+  "칮",
+  "칯",
+  "칰",
+  "칱",
+  "칲",
+  "칳",
+  "카",
+  "칵",
+  "칶",
+  "칷",
+  "칸",
+  "칹",
+  "칺",
+  "칻",
+  "칼",
+  "칽",
+  "칾",
+  "칿",
+  "캀",
+  "캁",
+  "캂",
+  "캃",
+  "캄",
+  "캅",
+  "캆",
+  "캇",
+  "캈",
+  "캉",
+  "캊",
+  "캋",
+  "캌",
+  "캍",
+  "캎",
+  "캏",
+  "캐",
+  "캑",
+  "캒",
+  "캓",
+  "캔",
+  "캕",
+  "캖",
+  "캗",
+  "캘",
+  "캙",
+  "캚",
+  "캛",
+  "캜",
+  "캝",
+  "캞",
+  "캟",
+  "캠",
+  "캡",
+  "캢",
+  "캣",
+  "캤",
+  "캥",
+  "캦",
+  "캧",
+  "캨",
+  "캩",
+  "캪",
+  "캫",
+  "캬",
+  "캭",
+  "캮",
+  "캯",
+  "캰",
+  "캱",
+  "캲",
+  "캳",
+  "캴",
+  "캵",
+  "캶",
+  "캷",
+  "캸",
+  "캹",
+  "캺",
+  "캻",
+  "캼",
+  "캽",
+  "캾",
+  "캿",
+  "컀",
+  "컁",
+  "컂",
+  "컃",
+  "컄",
+  "컅",
+  "컆",
+  "컇",
+  "컈",
+  "컉",
+  "컊",
+  "컋",
+  "컌",
+  "컍",
+  "컎",
+  "컏",
+  "컐",
+  "컑",
+  "컒",
+  "컓",
+  "컔",
+  "컕",
+  "컖",
+  "컗",
+  "컘",
+  "컙",
+  "컚",
+  "컛",
+  "컜",
+  "컝",
+  "컞",
+  "컟",
+  "컠",
+  "컡",
+  "컢",
+  "컣",
+  "커",
+  "컥",
+  "컦",
+  "컧",
+  "컨",
+  "컩",
+  "컪",
+  "컫",
+  "컬",
+  "컭",
+  "컮",
+  "컯",
+  "컰",
+  "컱",
+  "컲",
+  "컳",
+  "컴",
+  "컵",
+  "컶",
+  "컷",
+  "컸",
+  "컹",
+  "컺",
+  "컻",
+  "컼",
+  "컽",
+  "컾",
+  "컿",
+  "케",
+  "켁",
+  "켂",
+  "켃",
+  "켄",
+  "켅",
+  "켆",
+  "켇",
+  "켈",
+  "켉",
+  "켊",
+  "켋",
+  "켌",
+  "켍",
+  "켎",
+  "켏",
+  "켐",
+  "켑",
+  "켒",
+  "켓",
+  "켔",
+  "켕",
+  "켖",
+  "켗",
+  "켘",
+  "켙",
+  "켚",
+  "켛",
+  "켜",
+  "켝",
+  "켞",
+  "켟",
+  "켠",
+  "켡",
+  "켢",
+  "켣",
+  "켤",
+  "켥",
+  "켦",
+  "켧",
+  "켨",
+  "켩",
+  "켪",
+  "켫",
+  "켬",
+  "켭",
+  "켮",
+  "켯",
+  "켰",
+  "켱",
+  "켲",
+  "켳",
+  "켴",
+  "켵",
+  "켶",
+  "켷",
+  "켸",
+  "켹",
+  "켺",
+  "켻",
+  "켼",
+  "켽",
+  "켾",
+  "켿",
+  "콀",
+  "콁",
+  "콂",
+  "콃",
+  "콄",
+  "콅",
+  "콆",
+  "콇",
+  "콈",
+  "콉",
+  "콊",
+  "콋",
+  "콌",
+  "콍",
+  "콎",
+  "콏",
+  "콐",
+  "콑",
+  "콒",
+  "콓",
+  "코",
+  "콕",
+  "콖",
+  "콗",
+  "콘",
+  "콙",
+  "콚",
+  "콛",
+  "콜",
+  "콝",
+  "콞",
+  "콟",
+  "콠",
+  "콡",
+  "콢",
+  "콣",
+  "콤",
+  "콥",
+  "콦",
+  "콧",
+  "콨",
+  "콩",
+  "콪",
+  "콫",
+  "콬",
+  "콭",
+  "콮",
+  "콯",
+  "콰",
+  "콱",
+  "콲",
+  "콳",
+  "콴",
+  "콵",
+  "콶",
+  "콷",
+  "콸",
+  "콹",
+  "콺",
+  "콻",
+  "콼",
+  "콽",
+  "콾",
+  "콿",
+  "쾀",
+  "쾁",
+  "쾂",
+  "쾃",
+  "쾄",
+  "쾅",
+  "쾆",
+  "쾇",
+  "쾈",
+  "쾉",
+  "쾊",
+  "쾋",
+  "쾌",
+  "쾍",
+  "쾎",
+  "쾏",
+  "쾐",
+  "쾑",
+  "쾒",
+  "쾓",
+  "쾔",
+  "쾕",
+  "쾖",
+  "쾗",
+  "쾘",
+  "쾙",
+  "쾚",
+  "쾛",
+  "쾜",
+  "쾝",
+  "쾞",
+  "쾟",
+  "쾠",
+  "쾡",
+  "쾢",
+  "쾣",
+  "쾤",
+  "쾥",
+  "쾦",
+  "쾧",
+  "쾨",
+  "쾩",
+  "쾪",
+  "쾫",
+  "쾬",
+  "쾭",
+  "쾮",
+  "쾯",
+  "쾰",
+  "쾱",
+  "쾲",
+  "쾳",
+  "쾴",
+  "쾵",
+  "쾶",
+  "쾷",
+  "쾸",
+  "쾹",
+  "쾺",
+  "쾻",
+  "쾼",
+  "쾽",
+  "쾾",
+  "쾿",
+  "쿀",
+  "쿁",
+  "쿂",
+  "쿃",
+  "쿄",
+  "쿅",
+  "쿆",
+  "쿇",
+  "쿈",
+  "쿉",
+  "쿊",
+  "쿋",
+  "쿌",
+  "쿍",
+  "쿎",
+  "쿏",
+  "쿐",
+  "쿑",
+  "쿒",
+  "쿓",
+  "쿔",
+  "쿕",
+  "쿖",
+  "쿗",
+  "쿘",
+  "쿙",
+  "쿚",
+  "쿛",
+  "쿜",
+  "쿝",
+  "쿞",
+  "쿟",
+  "쿠",
+  "쿡",
+  "쿢",
+  "쿣",
+  "쿤",
+  "쿥",
+  "쿦",
+  "쿧",
+  "쿨",
+  "쿩",
+  "쿪",
+  "쿫",
+  "쿬",
+  "쿭",
+  "쿮",
+  "쿯",
+  "쿰",
+  "쿱",
+  "쿲",
+  "쿳",
+  "쿴",
+  "쿵",
+  "쿶",
+  "쿷",
+  "쿸",
+  "쿹",
+  "쿺",
+  "쿻",
+  "쿼",
+  "쿽",
+  "쿾",
+  "쿿",
+  "퀀",
+  "퀁",
+  "퀂",
+  "퀃",
+  "퀄",
+  "퀅",
+  "퀆",
+  "퀇",
+  "퀈",
+  "퀉",
+  "퀊",
+  "퀋",
+  "퀌",
+  "퀍",
+  "퀎",
+  "퀏",
+  "퀐",
+  "퀑",
+  "퀒",
+  "퀓",
+  "퀔",
+  "퀕",
+  "퀖",
+  "퀗",
+  "퀘",
+  "퀙",
+  "퀚",
+  "퀛",
+  "퀜",
+  "퀝",
+  "퀞",
+  "퀟",
+  "퀠",
+  "퀡",
+  "퀢",
+  "퀣",
+  "퀤",
+  "퀥",
+  "퀦",
+  "퀧",
+  "퀨",
+  "퀩",
+  "퀪",
+  "퀫",
+  "퀬",
+  "퀭",
+  "퀮",
+  "퀯",
+  "퀰",
+  "퀱",
+  "퀲",
+  "퀳",
+  "퀴",
+  "퀵",
+  "퀶",
+  "퀷",
+  "퀸",
+  "퀹",
+  "퀺",
+  "퀻",
+  "퀼",
+  "퀽",
+  "퀾",
+  "퀿",
+  "큀",
+  "큁",
+  "큂",
+  "큃",
+  "큄",
+  "큅",
+  "큆",
+  "큇",
+  "큈",
+  "큉",
+  "큊",
+  "큋",
+  "큌",
+  "큍",
+  "큎",
+  "큏",
+  "큐",
+  "큑",
+  "큒",
+  "큓",
+  "큔",
+  "큕",
+  "큖",
+  "큗",
+  "큘",
+  "큙",
+  "큚",
+  "큛",
+  "큜",
+  "큝",
+  "큞",
+  "큟",
+  "큠",
+  "큡",
+  "큢",
+  "큣",
+  "큤",
+  "큥",
+  "큦",
+  "큧",
+  "큨",
+  "큩",
+  "큪",
+  "큫",
+  "크",
+  "큭",
+  "큮",
+  "큯",
+  "큰",
+  "큱",
+  "큲",
+  "큳",
+  "클",
+  "큵",
+  "큶",
+  "큷",
+  "큸",
+  "큹",
+  "큺",
+  "큻",
+  "큼",
+  "큽",
+  "큾",
+  "큿",
+  "킀",
+  "킁",
+  "킂",
+  "킃",
+  "킄",
+  "킅",
+  "킆",
+  "킇",
+  "킈",
+  "킉",
+  "킊",
+  "킋",
+  "킌",
+  "킍",
+  "킎",
+  "킏",
+  "킐",
+  "킑",
+  "킒",
+  "킓",
+  "킔",
+  "킕",
+  "킖",
+  "킗",
+  "킘",
+  "킙",
+  "킚",
+  "킛",
+  "킜",
+  "킝",
+  "킞",
+  "킟",
+  "킠",
+  "킡",
+  "킢",
+  "킣",
+  "키",
+  "킥",
+  "킦",
+  "킧",
+  "킨",
+  "킩",
+  "킪",
+  "킫",
+  "킬",
+  "킭",
+  "킮",
+  "킯",
+  "킰",
+  "킱",
+  "킲",
+  "킳",
+  "킴",
+  "킵",
+  "킶",
+  "킷",
+  "킸",
+  "킹",
+  "킺",
+  "킻",
+  "킼",
+  "킽",
+  "킾",
+  "킿",
+  "타",
+  "탁",
+  "탂",
+  "탃",
+  "탄",
+  "탅",
+  "탆",
+  "탇",
+  "탈",
+  "탉",
+  "탊",
+  "탋",
+  "탌",
+  "탍",
+  "탎",
+  "탏",
+  "탐",
+  "탑",
+  "탒",
+  "탓",
+  "탔",
+  "탕",
+  "탖",
+  "탗",
+  "탘",
+  "탙",
+  "탚",
+  "탛",
+  "태",
+  "택",
+  "탞",
+  "탟",
+  "탠",
+  "탡",
+  "탢",
+  "탣",
+  "탤",
+  "탥",
+  "탦",
+  "탧",
+  "탨",
+  "탩",
+  "탪",
+  "탫",
+  "탬",
+  "탭",
+  "탮",
+  "탯",
+  "탰",
+  "탱",
+  "탲",
+  "탳",
+  "탴",
+  "탵",
+  "탶",
+  "탷",
+  "탸",
+  "탹",
+  "탺",
+  "탻",
+  "탼",
+  "탽",
+  "탾",
+  "탿",
+  "턀",
+  "턁",
+  "턂",
+  "턃",
+  "턄",
+  "턅",
+  "턆",
+  "턇",
+  "턈",
+  "턉",
+  "턊",
+  "턋",
+  "턌",
+  "턍",
+  "턎",
+  "턏",
+  "턐",
+  "턑",
+  "턒",
+  "턓",
+  "턔",
+  "턕",
+  "턖",
+  "턗",
+  "턘",
+  "턙",
+  "턚",
+  "턛",
+  "턜",
+  "턝",
+  "턞",
+  "턟",
+  "턠",
+  "턡",
+  "턢",
+  "턣",
+  "턤",
+  "턥",
+  "턦",
+  "턧",
+  "턨",
+  "턩",
+  "턪",
+  "턫",
+  "턬",
+  "턭",
+  "턮",
+  "턯",
+  "터",
+  "턱",
+  "턲",
+  "턳",
+  "턴",
+  "턵",
+  "턶",
+  "턷",
+  "털",
+  "턹",
+  "턺",
+  "턻",
+  "턼",
+  "턽",
+  "턾",
+  "턿",
+  "텀",
+  "텁",
+  "텂",
+  "텃",
+  "텄",
+  "텅",
+  "텆",
+  "텇",
+  "텈",
+  "텉",
+  "텊",
+  "텋",
+  "테",
+  "텍",
+  "텎",
+  "텏",
+  "텐",
+  "텑",
+  "텒",
+  "텓",
+  "텔",
+  "텕",
+  "텖",
+  "텗",
+  "텘",
+  "텙",
+  "텚",
+  "텛",
+  "템",
+  "텝",
+  "텞",
+  "텟",
+  "텠",
+  "텡",
+  "텢",
+  "텣",
+  "텤",
+  "텥",
+  "텦",
+  "텧",
+  "텨",
+  "텩",
+  "텪",
+  "텫",
+  "텬",
+  "텭",
+  "텮",
+  "텯",
+  "텰",
+  "텱",
+  "텲",
+  "텳",
+  "텴",
+  "텵",
+  "텶",
+  "텷",
+  "텸",
+  "텹",
+  "텺",
+  "텻",
+  "텼",
+  "텽",
+  "텾",
+  "텿",
+  "톀",
+  "톁",
+  "톂",
+  "톃",
+  "톄",
+  "톅",
+  "톆",
+  "톇",
+  "톈",
+  "톉",
+  "톊",
+  "톋",
+  "톌",
+  "톍",
+  "톎",
+  "톏",
+  "톐",
+  "톑",
+  "톒",
+  "톓",
+  "톔",
+  "톕",
+  "톖",
+  "톗",
+  "톘",
+  "톙",
+  "톚",
+  "톛",
+  "톜",
+  "톝",
+  "톞",
+  "톟",
+  "토",
+  "톡",
+  "톢",
+  "톣",
+  "톤",
+  "톥",
+  "톦",
+  "톧",
+  "톨",
+  "톩",
+  "톪",
+  "톫",
+  "톬",
+  "톭",
+  "톮",
+  "톯",
+  "톰",
+  "톱",
+  "톲",
+  "톳",
+  "톴",
+  "통",
+  "톶",
+  "톷",
+  "톸",
+  "톹",
+  "톺",
+  "톻",
+  "톼",
+  "톽",
+  "톾",
+  "톿",
+  "퇀",
+  "퇁",
+  "퇂",
+  "퇃",
+  "퇄",
+  "퇅",
+  "퇆",
+  "퇇",
+  "퇈",
+  "퇉",
+  "퇊",
+  "퇋",
+  "퇌",
+  "퇍",
+  "퇎",
+  "퇏",
+  "퇐",
+  "퇑",
+  "퇒",
+  "퇓",
+  "퇔",
+  "퇕",
+  "퇖",
+  "퇗",
+  "퇘",
+  "퇙",
+  "퇚",
+  "퇛",
+  "퇜",
+  "퇝",
+  "퇞",
+  "퇟",
+  "퇠",
+  "퇡",
+  "퇢",
+  "퇣",
+  "퇤",
+  "퇥",
+  "퇦",
+  "퇧",
+  "퇨",
+  "퇩",
+  "퇪",
+  "퇫",
+  "퇬",
+  "퇭",
+  "퇮",
+  "퇯",
+  "퇰",
+  "퇱",
+  "퇲",
+  "퇳",
+  "퇴",
+  "퇵",
+  "퇶",
+  "퇷",
+  "퇸",
+  "퇹",
+  "퇺",
+  "퇻",
+  "퇼",
+  "퇽",
+  "퇾",
+  "퇿",
+  "툀",
+  "툁",
+  "툂",
+  "툃",
+  "툄",
+  "툅",
+  "툆",
+  "툇",
+  "툈",
+  "툉",
+  "툊",
+  "툋",
+  "툌",
+  "툍",
+  "툎",
+  "툏",
+  "툐",
+  "툑",
+  "툒",
+  "툓",
+  "툔",
+  "툕",
+  "툖",
+  "툗",
+  "툘",
+  "툙",
+  "툚",
+  "툛",
+  "툜",
+  "툝",
+  "툞",
+  "툟",
+  "툠",
+  "툡",
+  "툢",
+  "툣",
+  "툤",
+  "툥",
+  "툦",
+  "툧",
+  "툨",
+  "툩",
+  "툪",
+  "툫",
+  "투",
+  "툭",
+  "툮",
+  "툯",
+  "툰",
+  "툱",
+  "툲",
+  "툳",
+  "툴",
+  "툵",
+  "툶",
+  "툷",
+  "툸",
+  "툹",
+  "툺",
+  "툻",
+  "툼",
+  "툽",
+  "툾",
+  "툿",
+  "퉀",
+  "퉁",
+  "퉂",
+  "퉃",
+  "퉄",
+  "퉅",
+  "퉆",
+  "퉇",
+  "퉈",
+  "퉉",
+  "퉊",
+  "퉋",
+  "퉌",
+  "퉍",
+  "퉎",
+  "퉏",
+  "퉐",
+  "퉑",
+  "퉒",
+  "퉓",
+  "퉔",
+  "퉕",
+  "퉖",
+  "퉗",
+  "퉘",
+  "퉙",
+  "퉚",
+  "퉛",
+  "퉜",
+  "퉝",
+  "퉞",
+  "퉟",
+  "퉠",
+  "퉡",
+  "퉢",
+  "퉣",
+  "퉤",
+  "퉥",
+  "퉦",
+  "퉧",
+  "퉨",
+  "퉩",
+  "퉪",
+  "퉫",
+  "퉬",
+  "퉭",
+  "퉮",
+  "퉯",
+  "퉰",
+  "퉱",
+  "퉲",
+  "퉳",
+  "퉴",
+  "퉵",
+  "퉶",
+  "퉷",
+  "퉸",
+  "퉹",
+  "퉺",
+  "퉻",
+  "퉼",
+  "퉽",
+  "퉾",
+  "퉿",
+  "튀",
+  "튁",
+  "튂",
+  "튃",
+  "튄",
+  "튅",
+  "튆",
+  "튇",
+  "튈",
+  "튉",
+  "튊",
+  "튋",
+  "튌",
+  "튍",
+  "튎",
+  "튏",
+  "튐",
+  "튑",
+  "튒",
+  "튓",
+  "튔",
+  "튕",
+  "튖",
+  "튗",
+  "튘",
+  "튙",
+  "튚",
+  "튛",
+  "튜",
+  "튝",
+  "튞",
+  "튟",
+  "튠",
+  "튡",
+  "튢",
+  "튣",
+  "튤",
+  "튥",
+  "튦",
+  "튧",
+  "튨",
+  "튩",
+  "튪",
+  "튫",
+  "튬",
+  "튭",
+  "튮",
+  "튯",
+  "튰",
+  "튱",
+  "튲",
+  "튳",
+  "튴",
+  "튵",
+  "튶",
+  "튷",
+  "트",
+  "특",
+  "튺",
+  "튻",
+  "튼",
+  "튽",
+  "튾",
+  "튿",
+  "틀",
+  "틁",
+  "틂",
+  "틃",
+  "틄",
+  "틅",
+  "틆",
+  "틇",
+  "틈",
+  "틉",
+  "틊",
+  "틋",
+  "틌",
+  "틍",
+  "틎",
+  "틏",
+  "틐",
+  "틑",
+  "틒",
+  "틓",
+  "틔",
+  "틕",
+  "틖",
+  "틗",
+  "틘",
+  "틙",
+  "틚",
+  "틛",
+  "틜",
+  "틝",
+  "틞",
+  "틟",
+  "틠",
+  "틡",
+  "틢",
+  "틣",
+  "틤",
+  "틥",
+  "틦",
+  "틧",
+  "틨",
+  "틩",
+  "틪",
+  "틫",
+  "틬",
+  "틭",
+  "틮",
+  "틯",
+  "티",
+  "틱",
+  "틲",
+  "틳",
+  "틴",
+  "틵",
+  "틶",
+  "틷",
+  "틸",
+  "틹",
+  "틺",
+  "틻",
+  "틼",
+  "틽",
+  "틾",
+  "틿",
+  "팀",
+  "팁",
+  "팂",
+  "팃",
+  "팄",
+  "팅",
+  "팆",
+  "팇",
+  "팈",
+  "팉",
+  "팊",
+  "팋",
+  "파",
+  "팍",
+  "팎",
+  "팏",
+  "판",
+  "팑",
+  "팒",
+  "팓",
+  "팔",
+  "팕",
+  "팖",
+  "팗",
+  "팘",
+  "팙",
+  "팚",
+  "팛",
+  "팜",
+  "팝",
+  "팞",
+  "팟",
+  "팠",
+  "팡",
+  "팢",
+  "팣",
+  "팤",
+  "팥",
+  "팦",
+  "팧",
+  "패",
+  "팩",
+  "팪",
+  "팫",
+  "팬",
+  "팭",
+  "팮",
+  "팯",
+  "팰",
+  "팱",
+  "팲",
+  "팳",
+  "팴",
+  "팵",
+  "팶",
+  "팷",
+  "팸",
+  "팹",
+  "팺",
+  "팻",
+  "팼",
+  "팽",
+  "팾",
+  "팿",
+  "퍀",
+  "퍁",
+  "퍂",
+  "퍃",
+  "퍄",
+  "퍅",
+  "퍆",
+  "퍇",
+  "퍈",
+  "퍉",
+  "퍊",
+  "퍋",
+  "퍌",
+  "퍍",
+  "퍎",
+  "퍏",
+  "퍐",
+  "퍑",
+  "퍒",
+  "퍓",
+  "퍔",
+  "퍕",
+  "퍖",
+  "퍗",
+  "퍘",
+  "퍙",
+  "퍚",
+  "퍛",
+  "퍜",
+  "퍝",
+  "퍞",
+  "퍟",
+  "퍠",
+  "퍡",
+  "퍢",
+  "퍣",
+  "퍤",
+  "퍥",
+  "퍦",
+  "퍧",
+  "퍨",
+  "퍩",
+  "퍪",
+  "퍫",
+  "퍬",
+  "퍭",
+  "퍮",
+  "퍯",
+  "퍰",
+  "퍱",
+  "퍲",
+  "퍳",
+  "퍴",
+  "퍵",
+  "퍶",
+  "퍷",
+  "퍸",
+  "퍹",
+  "퍺",
+  "퍻",
+  "퍼",
+  "퍽",
+  "퍾",
+  "퍿",
+  "펀",
+  "펁",
+  "펂",
+  "펃",
+  "펄",
+  "펅",
+  "펆",
+  "펇",
+  "펈",
+  "펉",
+  "펊",
+  "펋",
+  "펌",
+  "펍",
+  "펎",
+  "펏",
+  "펐",
+  "펑",
+  "펒",
+  "펓",
+  "펔",
+  "펕",
+  "펖",
+  "펗",
+  "페",
+  "펙",
+  "펚",
+  "펛",
+  "펜",
+  "펝",
+  "펞",
+  "펟",
+  "펠",
+  "펡",
+  "펢",
+  "펣",
+  "펤",
+  "펥",
+  "펦",
+  "펧",
+  "펨",
+  "펩",
+  "펪",
+  "펫",
+  "펬",
+  "펭",
+  "펮",
+  "펯",
+  "펰",
+  "펱",
+  "펲",
+  "펳",
+  "펴",
+  "펵",
+  "펶",
+  "펷",
+  "편",
+  "펹",
+  "펺",
+  "펻",
+  "펼",
+  "펽",
+  "펾",
+  "펿",
+  "폀",
+  "폁",
+  "폂",
+  "폃",
+  "폄",
+  "폅",
+  "폆",
+  "폇",
+  "폈",
+  "평",
+  "폊",
+  "폋",
+  "폌",
+  "폍",
+  "폎",
+  "폏",
+  "폐",
+  "폑",
+  "폒",
+  "폓",
+  "폔",
+  "폕",
+  "폖",
+  "폗",
+  "폘",
+  "폙",
+  "폚",
+  "폛",
+  "폜",
+  "폝",
+  "폞",
+  "폟",
+  "폠",
+  "폡",
+  "폢",
+  "폣",
+  "폤",
+  "폥",
+  "폦",
+  "폧",
+  "폨",
+  "폩",
+  "폪",
+  "폫",
+  "포",
+  "폭",
+  "폮",
+  "폯",
+  "폰",
+  "폱",
+  "폲",
+  "폳",
+  "폴",
+  "폵",
+  "폶",
+  "폷",
+  "폸",
+  "폹",
+  "폺",
+  "폻",
+  "폼",
+  "폽",
+  "폾",
+  "폿",
+  "퐀",
+  "퐁",
+  "퐂",
+  "퐃",
+  "퐄",
+  "퐅",
+  "퐆",
+  "퐇",
+  "퐈",
+  "퐉",
+  "퐊",
+  "퐋",
+  "퐌",
+  "퐍",
+  "퐎",
+  "퐏",
+  "퐐",
+  "퐑",
+  "퐒",
+  "퐓",
+  "퐔",
+  "퐕",
+  "퐖",
+  "퐗",
+  "퐘",
+  "퐙",
+  "퐚",
+  "퐛",
+  "퐜",
+  "퐝",
+  "퐞",
+  "퐟",
+  "퐠",
+  "퐡",
+  "퐢",
+  "퐣",
+  "퐤",
+  "퐥",
+  "퐦",
+  "퐧",
+  "퐨",
+  "퐩",
+  "퐪",
+  "퐫",
+  "퐬",
+  "퐭",
+  "퐮",
+  "퐯",
+  "퐰",
+  "퐱",
+  "퐲",
+  "퐳",
+  "퐴",
+  "퐵",
+  "퐶",
+  "퐷",
+  "퐸",
+  "퐹",
+  "퐺",
+  "퐻",
+  "퐼",
+  "퐽",
+  "퐾",
+  "퐿",
+  "푀",
+  "푁",
+  "푂",
+  "푃",
+  "푄",
+  "푅",
+  "푆",
+  "푇",
+  "푈",
+  "푉",
+  "푊",
+  "푋",
+  "푌",
+  "푍",
+  "푎",
+  "푏",
+  "푐",
+  "푑",
+  "푒",
+  "푓",
+  "푔",
+  "푕",
+  "푖",
+  "푗",
+  "푘",
+  "푙",
+  "푚",
+  "푛",
+  "표",
+  "푝",
+  "푞",
+  "푟",
+  "푠",
+  "푡",
+  "푢",
+  "푣",
+  "푤",
+  "푥",
+  "푦",
+  "푧",
+  "푨",
+  "푩",
+  "푪",
+  "푫",
+  "푬",
+  "푭",
+  "푮",
+  "푯",
+  "푰",
+  "푱",
+  "푲",
+  "푳",
+  "푴",
+  "푵",
+  "푶",
+  "푷",
+  "푸",
+  "푹",
+  "푺",
+  "푻",
+  "푼",
+  "푽",
+  "푾",
+  "푿",
+  "풀",
+  "풁",
+  "풂",
+  "풃",
+  "풄",
+  "풅",
+  "풆",
+  "풇",
+  "품",
+  "풉",
+  "풊",
+  "풋",
+  "풌",
+  "풍",
+  "풎",
+  "풏",
+  "풐",
+  "풑",
+  "풒",
+  "풓",
+  "풔",
+  "풕",
+  "풖",
+  "풗",
+  "풘",
+  "풙",
+  "풚",
+  "풛",
+  "풜",
+  "풝",
+  "풞",
+  "풟",
+  "풠",
+  "풡",
+  "풢",
+  "풣",
+  "풤",
+  "풥",
+  "풦",
+  "풧",
+  "풨",
+  "풩",
+  "풪",
+  "풫",
+  "풬",
+  "풭",
+  "풮",
+  "풯",
+  "풰",
+  "풱",
+  "풲",
+  "풳",
+  "풴",
+  "풵",
+  "풶",
+  "풷",
+  "풸",
+  "풹",
+  "풺",
+  "풻",
+  "풼",
+  "풽",
+  "풾",
+  "풿",
+  "퓀",
+  "퓁",
+  "퓂",
+  "퓃",
+  "퓄",
+  "퓅",
+  "퓆",
+  "퓇",
+  "퓈",
+  "퓉",
+  "퓊",
+  "퓋",
+  "퓌",
+  "퓍",
+  "퓎",
+  "퓏",
+  "퓐",
+  "퓑",
+  "퓒",
+  "퓓",
+  "퓔",
+  "퓕",
+  "퓖",
+  "퓗",
+  "퓘",
+  "퓙",
+  "퓚",
+  "퓛",
+  "퓜",
+  "퓝",
+  "퓞",
+  "퓟",
+  "퓠",
+  "퓡",
+  "퓢",
+  "퓣",
+  "퓤",
+  "퓥",
+  "퓦",
+  "퓧",
+  "퓨",
+  "퓩",
+  "퓪",
+  "퓫",
+  "퓬",
+  "퓭",
+  "퓮",
+  "퓯",
+  "퓰",
+  "퓱",
+  "퓲",
+  "퓳",
+  "퓴",
+  "퓵",
+  "퓶",
+  "퓷",
+  "퓸",
+  "퓹",
+  "퓺",
+  "퓻",
+  "퓼",
+  "퓽",
+  "퓾",
+  "퓿",
+  "픀",
+  "픁",
+  "픂",
+  "픃",
+  "프",
+  "픅",
+  "픆",
+  "픇",
+  "픈",
+  "픉",
+  "픊",
+  "픋",
+  "플",
+  "픍",
+  "픎",
+  "픏",
+  "픐",
+  "픑",
+  "픒",
+  "픓",
+  "픔",
+  "픕",
+  "픖",
+  "픗",
+  "픘",
+  "픙",
+  "픚",
+  "픛",
+  "픜",
+  "픝",
+  "픞",
+  "픟",
+  "픠",
+  "픡",
+  "픢",
+  "픣",
+  "픤",
+  "픥",
+  "픦",
+  "픧",
+  "픨",
+  "픩",
+  "픪",
+  "픫",
+  "픬",
+  "픭",
+  "픮",
+  "픯",
+  "픰",
+  "픱",
+  "픲",
+  "픳",
+  "픴",
+  "픵",
+  "픶",
+  "픷",
+  "픸",
+  "픹",
+  "픺",
+  "픻",
+  "피",
+  "픽",
+  "픾",
+  "픿",
+  "핀",
+  "핁",
+  "핂",
+  "핃",
+  "필",
+  "핅",
+  "핆",
+  "핇",
+  "핈",
+  "핉",
+  "핊",
+  "핋",
+  "핌",
+  "핍",
+  "핎",
+  "핏",
+  "핐",
+  "핑",
+  "핒",
+  "핓",
+  "핔",
+  "핕",
+  "핖",
+  "핗",
+  "하",
+  "학",
+  "핚",
+  "핛",
+  "한",
+  "핝",
+  "핞",
+  "핟",
+  "할",
+  "핡",
+  "핢",
+  "핣",
+  "핤",
+  "핥",
+  "핦",
+  "핧",
+  "함",
+  "합",
+  "핪",
+  "핫",
+  "핬",
+  "항",
+  "핮",
+  "핯",
+  "핰",
+  "핱",
+  "핲",
+  "핳",
+  "해",
+  "핵",
+  "핶",
+  "핷",
+  "핸",
+  "핹",
+  "핺",
+  "핻",
+  "핼",
+  "핽",
+  "핾",
+  "핿",
+  "햀",
+  "햁",
+  "햂",
+  "햃",
+  "햄",
+  "햅",
+  "햆",
+  "햇",
+  "했",
+  "행",
+  "햊",
+  "햋",
+  "햌",
+  "햍",
+  "햎",
+  "햏",
+  "햐",
+  "햑",
+  "햒",
+  "햓",
+  "햔",
+  "햕",
+  "햖",
+  "햗",
+  "햘",
+  "햙",
+  "햚",
+  "햛",
+  "햜",
+  "햝",
+  "햞",
+  "햟",
+  "햠",
+  "햡",
+  "햢",
+  "햣",
+  "햤",
+  "향",
+  "햦",
+  "햧",
+  "햨",
+  "햩",
+  "햪",
+  "햫",
+  "햬",
+  "햭",
+  "햮",
+  "햯",
+  "햰",
+  "햱",
+  "햲",
+  "햳",
+  "햴",
+  "햵",
+  "햶",
+  "햷",
+  "햸",
+  "햹",
+  "햺",
+  "햻",
+  "햼",
+  "햽",
+  "햾",
+  "햿",
+  "헀",
+  "헁",
+  "헂",
+  "헃",
+  "헄",
+  "헅",
+  "헆",
+  "헇",
+  "허",
+  "헉",
+  "헊",
+  "헋",
+  "헌",
+  "헍",
+  "헎",
+  "헏",
+  "헐",
+  "헑",
+  "헒",
+  "헓",
+  "헔",
+  "헕",
+  "헖",
+  "헗",
+  "험",
+  "헙",
+  "헚",
+  "헛",
+  "헜",
+  "헝",
+  "헞",
+  "헟",
+  "헠",
+  "헡",
+  "헢",
+  "헣",
+  "헤",
+  "헥",
+  "헦",
+  "헧",
+  "헨",
+  "헩",
+  "헪",
+  "헫",
+  "헬",
+  "헭",
+  "헮",
+  "헯",
+  "헰",
+  "헱",
+  "헲",
+  "헳",
+  "헴",
+  "헵",
+  "헶",
+  "헷",
+  "헸",
+  "헹",
+  "헺",
+  "헻",
+  "헼",
+  "헽",
+  "헾",
+  "헿",
+  "혀",
+  "혁",
+  "혂",
+  "혃",
+  "현",
+  "혅",
+  "혆",
+  "혇",
+  "혈",
+  "혉",
+  "혊",
+  "혋",
+  "혌",
+  "혍",
+  "혎",
+  "혏",
+  "혐",
+  "협",
+  "혒",
+  "혓",
+  "혔",
+  "형",
+  "혖",
+  "혗",
+  "혘",
+  "혙",
+  "혚",
+  "혛",
+  "혜",
+  "혝",
+  "혞",
+  "혟",
+  "혠",
+  "혡",
+  "혢",
+  "혣",
+  "혤",
+  "혥",
+  "혦",
+  "혧",
+  "혨",
+  "혩",
+  "혪",
+  "혫",
+  "혬",
+  "혭",
+  "혮",
+  "혯",
+  "혰",
+  "혱",
+  "혲",
+  "혳",
+  "혴",
+  "혵",
+  "혶",
+  "혷",
+  "호",
+  "혹",
+  "혺",
+  "혻",
+  "혼",
+  "혽",
+  "혾",
+  "혿",
+  "홀",
+  "홁",
+  "홂",
+  "홃",
+  "홄",
+  "홅",
+  "홆",
+  "홇",
+  "홈",
+  "홉",
+  "홊",
+  "홋",
+  "홌",
+  "홍",
+  "홎",
+  "홏",
+  "홐",
+  "홑",
+  "홒",
+  "홓",
+  "화",
+  "확",
+  "홖",
+  "홗",
+  "환",
+  "홙",
+  "홚",
+  "홛",
+  "활",
+  "홝",
+  "홞",
+  "홟",
+  "홠",
+  "홡",
+  "홢",
+  "홣",
+  "홤",
+  "홥",
+  "홦",
+  "홧",
+  "홨",
+  "황",
+  "홪",
+  "홫",
+  "홬",
+  "홭",
+  "홮",
+  "홯",
+  "홰",
+  "홱",
+  "홲",
+  "홳",
+  "홴",
+  "홵",
+  "홶",
+  "홷",
+  "홸",
+  "홹",
+  "홺",
+  "홻",
+  "홼",
+  "홽",
+  "홾",
+  "홿",
+  "횀",
+  "횁",
+  "횂",
+  "횃",
+  "횄",
+  "횅",
+  "횆",
+  "횇",
+  "횈",
+  "횉",
+  "횊",
+  "횋",
+  "회",
+  "획",
+  "횎",
+  "횏",
+  "횐",
+  "횑",
+  "횒",
+  "횓",
+  "횔",
+  "횕",
+  "횖",
+  "횗",
+  "횘",
+  "횙",
+  "횚",
+  "횛",
+  "횜",
+  "횝",
+  "횞",
+  "횟",
+  "횠",
+  "횡",
+  "횢",
+  "횣",
+  "횤",
+  "횥",
+  "횦",
+  "횧",
+  "효",
+  "횩",
+  "횪",
+  "횫",
+  "횬",
+  "횭",
+  "횮",
+  "횯",
+  "횰",
+  "횱",
+  "횲",
+  "횳",
+  "횴",
+  "횵",
+  "횶",
+  "횷",
+  "횸",
+  "횹",
+  "횺",
+  "횻",
+  "횼",
+  "횽",
+  "횾",
+  "횿",
+  "훀",
+  "훁",
+  "훂",
+  "훃",
+  "후",
+  "훅",
+  "훆",
+  "훇",
+  "훈",
+  "훉",
+  "훊",
+  "훋",
+  "훌",
+  "훍",
+  "훎",
+  "훏",
+  "훐",
+  "훑",
+  "훒",
+  "훓",
+  "훔",
+  "훕",
+  "훖",
+  "훗",
+  "훘",
+  "훙",
+  "훚",
+  "훛",
+  "훜",
+  "훝",
+  "훞",
+  "훟",
+  "훠",
+  "훡",
+  "훢",
+  "훣",
+  "훤",
+  "훥",
+  "훦",
+  "훧",
+  "훨",
+  "훩",
+  "훪",
+  "훫",
+  "훬",
+  "훭",
+  "훮",
+  "훯",
+  "훰",
+  "훱",
+  "훲",
+  "훳",
+  "훴",
+  "훵",
+  "훶",
+  "훷",
+  "훸",
+  "훹",
+  "훺",
+  "훻",
+  "훼",
+  "훽",
+  "훾",
+  "훿",
+  "휀",
+  "휁",
+  "휂",
+  "휃",
+  "휄",
+  "휅",
+  "휆",
+  "휇",
+  "휈",
+  "휉",
+  "휊",
+  "휋",
+  "휌",
+  "휍",
+  "휎",
+  "휏",
+  "휐",
+  "휑",
+  "휒",
+  "휓",
+  "휔",
+  "휕",
+  "휖",
+  "휗",
+  "휘",
+  "휙",
+  "휚",
+  "휛",
+  "휜",
+  "휝",
+  "휞",
+  "휟",
+  "휠",
+  "휡",
+  "휢",
+  "휣",
+  "휤",
+  "휥",
+  "휦",
+  "휧",
+  "휨",
+  "휩",
+  "휪",
+  "휫",
+  "휬",
+  "휭",
+  "휮",
+  "휯",
+  "휰",
+  "휱",
+  "휲",
+  "휳",
+  "휴",
+  "휵",
+  "휶",
+  "휷",
+  "휸",
+  "휹",
+  "휺",
+  "휻",
+  "휼",
+  "휽",
+  "휾",
+  "휿",
+  "흀",
+  "흁",
+  "흂",
+  "흃",
+  "흄",
+  "흅",
+  "흆",
+  "흇",
+  "흈",
+  "흉",
+  "흊",
+  "흋",
+  "흌",
+  "흍",
+  "흎",
+  "흏",
+  "흐",
+  "흑",
+  "흒",
+  "흓",
+  "흔",
+  "흕",
+  "흖",
+  "흗",
+  "흘",
+  "흙",
+  "흚",
+  "흛",
+  "흜",
+  "흝",
+  "흞",
+  "흟",
+  "흠",
+  "흡",
+  "흢",
+  "흣",
+  "흤",
+  "흥",
+  "흦",
+  "흧",
+  "흨",
+  "흩",
+  "흪",
+  "흫",
+  "희",
+  "흭",
+  "흮",
+  "흯",
+  "흰",
+  "흱",
+  "흲",
+  "흳",
+  "흴",
+  "흵",
+  "흶",
+  "흷",
+  "흸",
+  "흹",
+  "흺",
+  "흻",
+  "흼",
+  "흽",
+  "흾",
+  "흿",
+  "힀",
+  "힁",
+  "힂",
+  "힃",
+  "힄",
+  "힅",
+  "힆",
+  "힇",
+  "히",
+  "힉",
+  "힊",
+  "힋",
+  "힌",
+  "힍",
+  "힎",
+  "힏",
+  "힐",
+  "힑",
+  "힒",
+  "힓",
+  "힔",
+  "힕",
+  "힖",
+  "힗",
+  "힘",
+  "힙",
+  "힚",
+  "힛",
+  "힜",
+  "힝",
+  "힞",
+  "힟",
+  "힠",
+  "힡",
+  "힢",
+  "힣",
+};
+const char *ALPHA_140_DIGITS[] = {
+};
+const uint32_t ALPHA_140_UPPER_CPS[] = {
+  44032, 44033, 44034, 44035, 44036, 44037, 44038, 44039, 44040, 44041, 44042, 44043, 44044, 44045, 44046, 44047,
+  44048, 44049, 44050, 44051, 44052, 44053, 44054, 44055, 44056, 44057, 44058, 44059, 44060, 44061, 44062, 44063,
+  44064, 44065, 44066, 44067, 44068, 44069, 44070, 44071, 44072, 44073, 44074, 44075, 44076, 44077, 44078, 44079,
+  44080, 44081, 44082, 44083, 44084, 44085, 44086, 44087, 44088, 44089, 44090, 44091, 44092, 44093, 44094, 44095,
+  44096, 44097, 44098, 44099, 44100, 44101, 44102, 44103, 44104, 44105, 44106, 44107, 44108, 44109, 44110, 44111,
+  44112, 44113, 44114, 44115, 44116, 44117, 44118, 44119, 44120, 44121, 44122, 44123, 44124, 44125, 44126, 44127,
+  44128, 44129, 44130, 44131, 44132, 44133, 44134, 44135, 44136, 44137, 44138, 44139, 44140, 44141, 44142, 44143,
+  44144, 44145, 44146, 44147, 44148, 44149, 44150, 44151, 44152, 44153, 44154, 44155, 44156, 44157, 44158, 44159,
+  44160, 44161, 44162, 44163, 44164, 44165, 44166, 44167, 44168, 44169, 44170, 44171, 44172, 44173, 44174, 44175,
+  44176, 44177, 44178, 44179, 44180, 44181, 44182, 44183, 44184, 44185, 44186, 44187, 44188, 44189, 44190, 44191,
+  44192, 44193, 44194, 44195, 44196, 44197, 44198, 44199, 44200, 44201, 44202, 44203, 44204, 44205, 44206, 44207,
+  44208, 44209, 44210, 44211, 44212, 44213, 44214, 44215, 44216, 44217, 44218, 44219, 44220, 44221, 44222, 44223,
+  44224, 44225, 44226, 44227, 44228, 44229, 44230, 44231, 44232, 44233, 44234, 44235, 44236, 44237, 44238, 44239,
+  44240, 44241, 44242, 44243, 44244, 44245, 44246, 44247, 44248, 44249, 44250, 44251, 44252, 44253, 44254, 44255,
+  44256, 44257, 44258, 44259, 44260, 44261, 44262, 44263, 44264, 44265, 44266, 44267, 44268, 44269, 44270, 44271,
+  44272, 44273, 44274, 44275, 44276, 44277, 44278, 44279, 44280, 44281, 44282, 44283, 44284, 44285, 44286, 44287,
+  44288, 44289, 44290, 44291, 44292, 44293, 44294, 44295, 44296, 44297, 44298, 44299, 44300, 44301, 44302, 44303,
+  44304, 44305, 44306, 44307, 44308, 44309, 44310, 44311, 44312, 44313, 44314, 44315, 44316, 44317, 44318, 44319,
+  44320, 44321, 44322, 44323, 44324, 44325, 44326, 44327, 44328, 44329, 44330, 44331, 44332, 44333, 44334, 44335,
+  44336, 44337, 44338, 44339, 44340, 44341, 44342, 44343, 44344, 44345, 44346, 44347, 44348, 44349, 44350, 44351,
+  44352, 44353, 44354, 44355, 44356, 44357, 44358, 44359, 44360, 44361, 44362, 44363, 44364, 44365, 44366, 44367,
+  44368, 44369, 44370, 44371, 44372, 44373, 44374, 44375, 44376, 44377, 44378, 44379, 44380, 44381, 44382, 44383,
+  44384, 44385, 44386, 44387, 44388, 44389, 44390, 44391, 44392, 44393, 44394, 44395, 44396, 44397, 44398, 44399,
+  44400, 44401, 44402, 44403, 44404, 44405, 44406, 44407, 44408, 44409, 44410, 44411, 44412, 44413, 44414, 44415,
+  44416, 44417, 44418, 44419, 44420, 44421, 44422, 44423, 44424, 44425, 44426, 44427, 44428, 44429, 44430, 44431,
+  44432, 44433, 44434, 44435, 44436, 44437, 44438, 44439, 44440, 44441, 44442, 44443, 44444, 44445, 44446, 44447,
+  44448, 44449, 44450, 44451, 44452, 44453, 44454, 44455, 44456, 44457, 44458, 44459, 44460, 44461, 44462, 44463,
+  44464, 44465, 44466, 44467, 44468, 44469, 44470, 44471, 44472, 44473, 44474, 44475, 44476, 44477, 44478, 44479,
+  44480, 44481, 44482, 44483, 44484, 44485, 44486, 44487, 44488, 44489, 44490, 44491, 44492, 44493, 44494, 44495,
+  44496, 44497, 44498, 44499, 44500, 44501, 44502, 44503, 44504, 44505, 44506, 44507, 44508, 44509, 44510, 44511,
+  44512, 44513, 44514, 44515, 44516, 44517, 44518, 44519, 44520, 44521, 44522, 44523, 44524, 44525, 44526, 44527,
+  44528, 44529, 44530, 44531, 44532, 44533, 44534, 44535, 44536, 44537, 44538, 44539, 44540, 44541, 44542, 44543,
+  44544, 44545, 44546, 44547, 44548, 44549, 44550, 44551, 44552, 44553, 44554, 44555, 44556, 44557, 44558, 44559,
+  44560, 44561, 44562, 44563, 44564, 44565, 44566, 44567, 44568, 44569, 44570, 44571, 44572, 44573, 44574, 44575,
+  44576, 44577, 44578, 44579, 44580, 44581, 44582, 44583, 44584, 44585, 44586, 44587, 44588, 44589, 44590, 44591,
+  44592, 44593, 44594, 44595, 44596, 44597, 44598, 44599, 44600, 44601, 44602, 44603, 44604, 44605, 44606, 44607,
+  44608, 44609, 44610, 44611, 44612, 44613, 44614, 44615, 44616, 44617, 44618, 44619, 44620, 44621, 44622, 44623,
+  44624, 44625, 44626, 44627, 44628, 44629, 44630, 44631, 44632, 44633, 44634, 44635, 44636, 44637, 44638, 44639,
+  44640, 44641, 44642, 44643, 44644, 44645, 44646, 44647, 44648, 44649, 44650, 44651, 44652, 44653, 44654, 44655,
+  44656, 44657, 44658, 44659, 44660, 44661, 44662, 44663, 44664, 44665, 44666, 44667, 44668, 44669, 44670, 44671,
+  44672, 44673, 44674, 44675, 44676, 44677, 44678, 44679, 44680, 44681, 44682, 44683, 44684, 44685, 44686, 44687,
+  44688, 44689, 44690, 44691, 44692, 44693, 44694, 44695, 44696, 44697, 44698, 44699, 44700, 44701, 44702, 44703,
+  44704, 44705, 44706, 44707, 44708, 44709, 44710, 44711, 44712, 44713, 44714, 44715, 44716, 44717, 44718, 44719,
+  44720, 44721, 44722, 44723, 44724, 44725, 44726, 44727, 44728, 44729, 44730, 44731, 44732, 44733, 44734, 44735,
+  44736, 44737, 44738, 44739, 44740, 44741, 44742, 44743, 44744, 44745, 44746, 44747, 44748, 44749, 44750, 44751,
+  44752, 44753, 44754, 44755, 44756, 44757, 44758, 44759, 44760, 44761, 44762, 44763, 44764, 44765, 44766, 44767,
+  44768, 44769, 44770, 44771, 44772, 44773, 44774, 44775, 44776, 44777, 44778, 44779, 44780, 44781, 44782, 44783,
+  44784, 44785, 44786, 44787, 44788, 44789, 44790, 44791, 44792, 44793, 44794, 44795, 44796, 44797, 44798, 44799,
+  44800, 44801, 44802, 44803, 44804, 44805, 44806, 44807, 44808, 44809, 44810, 44811, 44812, 44813, 44814, 44815,
+  44816, 44817, 44818, 44819, 44820, 44821, 44822, 44823, 44824, 44825, 44826, 44827, 44828, 44829, 44830, 44831,
+  44832, 44833, 44834, 44835, 44836, 44837, 44838, 44839, 44840, 44841, 44842, 44843, 44844, 44845, 44846, 44847,
+  44848, 44849, 44850, 44851, 44852, 44853, 44854, 44855, 44856, 44857, 44858, 44859, 44860, 44861, 44862, 44863,
+  44864, 44865, 44866, 44867, 44868, 44869, 44870, 44871, 44872, 44873, 44874, 44875, 44876, 44877, 44878, 44879,
+  44880, 44881, 44882, 44883, 44884, 44885, 44886, 44887, 44888, 44889, 44890, 44891, 44892, 44893, 44894, 44895,
+  44896, 44897, 44898, 44899, 44900, 44901, 44902, 44903, 44904, 44905, 44906, 44907, 44908, 44909, 44910, 44911,
+  44912, 44913, 44914, 44915, 44916, 44917, 44918, 44919, 44920, 44921, 44922, 44923, 44924, 44925, 44926, 44927,
+  44928, 44929, 44930, 44931, 44932, 44933, 44934, 44935, 44936, 44937, 44938, 44939, 44940, 44941, 44942, 44943,
+  44944, 44945, 44946, 44947, 44948, 44949, 44950, 44951, 44952, 44953, 44954, 44955, 44956, 44957, 44958, 44959,
+  44960, 44961, 44962, 44963, 44964, 44965, 44966, 44967, 44968, 44969, 44970, 44971, 44972, 44973, 44974, 44975,
+  44976, 44977, 44978, 44979, 44980, 44981, 44982, 44983, 44984, 44985, 44986, 44987, 44988, 44989, 44990, 44991,
+  44992, 44993, 44994, 44995, 44996, 44997, 44998, 44999, 45000, 45001, 45002, 45003, 45004, 45005, 45006, 45007,
+  45008, 45009, 45010, 45011, 45012, 45013, 45014, 45015, 45016, 45017, 45018, 45019, 45020, 45021, 45022, 45023,
+  45024, 45025, 45026, 45027, 45028, 45029, 45030, 45031, 45032, 45033, 45034, 45035, 45036, 45037, 45038, 45039,
+  45040, 45041, 45042, 45043, 45044, 45045, 45046, 45047, 45048, 45049, 45050, 45051, 45052, 45053, 45054, 45055,
+  45056, 45057, 45058, 45059, 45060, 45061, 45062, 45063, 45064, 45065, 45066, 45067, 45068, 45069, 45070, 45071,
+  45072, 45073, 45074, 45075, 45076, 45077, 45078, 45079, 45080, 45081, 45082, 45083, 45084, 45085, 45086, 45087,
+  45088, 45089, 45090, 45091, 45092, 45093, 45094, 45095, 45096, 45097, 45098, 45099, 45100, 45101, 45102, 45103,
+  45104, 45105, 45106, 45107, 45108, 45109, 45110, 45111, 45112, 45113, 45114, 45115, 45116, 45117, 45118, 45119,
+  45120, 45121, 45122, 45123, 45124, 45125, 45126, 45127, 45128, 45129, 45130, 45131, 45132, 45133, 45134, 45135,
+  45136, 45137, 45138, 45139, 45140, 45141, 45142, 45143, 45144, 45145, 45146, 45147, 45148, 45149, 45150, 45151,
+  45152, 45153, 45154, 45155, 45156, 45157, 45158, 45159, 45160, 45161, 45162, 45163, 45164, 45165, 45166, 45167,
+  45168, 45169, 45170, 45171, 45172, 45173, 45174, 45175, 45176, 45177, 45178, 45179, 45180, 45181, 45182, 45183,
+  45184, 45185, 45186, 45187, 45188, 45189, 45190, 45191, 45192, 45193, 45194, 45195, 45196, 45197, 45198, 45199,
+  45200, 45201, 45202, 45203, 45204, 45205, 45206, 45207, 45208, 45209, 45210, 45211, 45212, 45213, 45214, 45215,
+  45216, 45217, 45218, 45219, 45220, 45221, 45222, 45223, 45224, 45225, 45226, 45227, 45228, 45229, 45230, 45231,
+  45232, 45233, 45234, 45235, 45236, 45237, 45238, 45239, 45240, 45241, 45242, 45243, 45244, 45245, 45246, 45247,
+  45248, 45249, 45250, 45251, 45252, 45253, 45254, 45255, 45256, 45257, 45258, 45259, 45260, 45261, 45262, 45263,
+  45264, 45265, 45266, 45267, 45268, 45269, 45270, 45271, 45272, 45273, 45274, 45275, 45276, 45277, 45278, 45279,
+  45280, 45281, 45282, 45283, 45284, 45285, 45286, 45287, 45288, 45289, 45290, 45291, 45292, 45293, 45294, 45295,
+  45296, 45297, 45298, 45299, 45300, 45301, 45302, 45303, 45304, 45305, 45306, 45307, 45308, 45309, 45310, 45311,
+  45312, 45313, 45314, 45315, 45316, 45317, 45318, 45319, 45320, 45321, 45322, 45323, 45324, 45325, 45326, 45327,
+  45328, 45329, 45330, 45331, 45332, 45333, 45334, 45335, 45336, 45337, 45338, 45339, 45340, 45341, 45342, 45343,
+  45344, 45345, 45346, 45347, 45348, 45349, 45350, 45351, 45352, 45353, 45354, 45355, 45356, 45357, 45358, 45359,
+  45360, 45361, 45362, 45363, 45364, 45365, 45366, 45367, 45368, 45369, 45370, 45371, 45372, 45373, 45374, 45375,
+  45376, 45377, 45378, 45379, 45380, 45381, 45382, 45383, 45384, 45385, 45386, 45387, 45388, 45389, 45390, 45391,
+  45392, 45393, 45394, 45395, 45396, 45397, 45398, 45399, 45400, 45401, 45402, 45403, 45404, 45405, 45406, 45407,
+  45408, 45409, 45410, 45411, 45412, 45413, 45414, 45415, 45416, 45417, 45418, 45419, 45420, 45421, 45422, 45423,
+  45424, 45425, 45426, 45427, 45428, 45429, 45430, 45431, 45432, 45433, 45434, 45435, 45436, 45437, 45438, 45439,
+  45440, 45441, 45442, 45443, 45444, 45445, 45446, 45447, 45448, 45449, 45450, 45451, 45452, 45453, 45454, 45455,
+  45456, 45457, 45458, 45459, 45460, 45461, 45462, 45463, 45464, 45465, 45466, 45467, 45468, 45469, 45470, 45471,
+  45472, 45473, 45474, 45475, 45476, 45477, 45478, 45479, 45480, 45481, 45482, 45483, 45484, 45485, 45486, 45487,
+  45488, 45489, 45490, 45491, 45492, 45493, 45494, 45495, 45496, 45497, 45498, 45499, 45500, 45501, 45502, 45503,
+  45504, 45505, 45506, 45507, 45508, 45509, 45510, 45511, 45512, 45513, 45514, 45515, 45516, 45517, 45518, 45519,
+  45520, 45521, 45522, 45523, 45524, 45525, 45526, 45527, 45528, 45529, 45530, 45531, 45532, 45533, 45534, 45535,
+  45536, 45537, 45538, 45539, 45540, 45541, 45542, 45543, 45544, 45545, 45546, 45547, 45548, 45549, 45550, 45551,
+  45552, 45553, 45554, 45555, 45556, 45557, 45558, 45559, 45560, 45561, 45562, 45563, 45564, 45565, 45566, 45567,
+  45568, 45569, 45570, 45571, 45572, 45573, 45574, 45575, 45576, 45577, 45578, 45579, 45580, 45581, 45582, 45583,
+  45584, 45585, 45586, 45587, 45588, 45589, 45590, 45591, 45592, 45593, 45594, 45595, 45596, 45597, 45598, 45599,
+  45600, 45601, 45602, 45603, 45604, 45605, 45606, 45607, 45608, 45609, 45610, 45611, 45612, 45613, 45614, 45615,
+  45616, 45617, 45618, 45619, 45620, 45621, 45622, 45623, 45624, 45625, 45626, 45627, 45628, 45629, 45630, 45631,
+  45632, 45633, 45634, 45635, 45636, 45637, 45638, 45639, 45640, 45641, 45642, 45643, 45644, 45645, 45646, 45647,
+  45648, 45649, 45650, 45651, 45652, 45653, 45654, 45655, 45656, 45657, 45658, 45659, 45660, 45661, 45662, 45663,
+  45664, 45665, 45666, 45667, 45668, 45669, 45670, 45671, 45672, 45673, 45674, 45675, 45676, 45677, 45678, 45679,
+  45680, 45681, 45682, 45683, 45684, 45685, 45686, 45687, 45688, 45689, 45690, 45691, 45692, 45693, 45694, 45695,
+  45696, 45697, 45698, 45699, 45700, 45701, 45702, 45703, 45704, 45705, 45706, 45707, 45708, 45709, 45710, 45711,
+  45712, 45713, 45714, 45715, 45716, 45717, 45718, 45719, 45720, 45721, 45722, 45723, 45724, 45725, 45726, 45727,
+  45728, 45729, 45730, 45731, 45732, 45733, 45734, 45735, 45736, 45737, 45738, 45739, 45740, 45741, 45742, 45743,
+  45744, 45745, 45746, 45747, 45748, 45749, 45750, 45751, 45752, 45753, 45754, 45755, 45756, 45757, 45758, 45759,
+  45760, 45761, 45762, 45763, 45764, 45765, 45766, 45767, 45768, 45769, 45770, 45771, 45772, 45773, 45774, 45775,
+  45776, 45777, 45778, 45779, 45780, 45781, 45782, 45783, 45784, 45785, 45786, 45787, 45788, 45789, 45790, 45791,
+  45792, 45793, 45794, 45795, 45796, 45797, 45798, 45799, 45800, 45801, 45802, 45803, 45804, 45805, 45806, 45807,
+  45808, 45809, 45810, 45811, 45812, 45813, 45814, 45815, 45816, 45817, 45818, 45819, 45820, 45821, 45822, 45823,
+  45824, 45825, 45826, 45827, 45828, 45829, 45830, 45831, 45832, 45833, 45834, 45835, 45836, 45837, 45838, 45839,
+  45840, 45841, 45842, 45843, 45844, 45845, 45846, 45847, 45848, 45849, 45850, 45851, 45852, 45853, 45854, 45855,
+  45856, 45857, 45858, 45859, 45860, 45861, 45862, 45863, 45864, 45865, 45866, 45867, 45868, 45869, 45870, 45871,
+  45872, 45873, 45874, 45875, 45876, 45877, 45878, 45879, 45880, 45881, 45882, 45883, 45884, 45885, 45886, 45887,
+  45888, 45889, 45890, 45891, 45892, 45893, 45894, 45895, 45896, 45897, 45898, 45899, 45900, 45901, 45902, 45903,
+  45904, 45905, 45906, 45907, 45908, 45909, 45910, 45911, 45912, 45913, 45914, 45915, 45916, 45917, 45918, 45919,
+  45920, 45921, 45922, 45923, 45924, 45925, 45926, 45927, 45928, 45929, 45930, 45931, 45932, 45933, 45934, 45935,
+  45936, 45937, 45938, 45939, 45940, 45941, 45942, 45943, 45944, 45945, 45946, 45947, 45948, 45949, 45950, 45951,
+  45952, 45953, 45954, 45955, 45956, 45957, 45958, 45959, 45960, 45961, 45962, 45963, 45964, 45965, 45966, 45967,
+  45968, 45969, 45970, 45971, 45972, 45973, 45974, 45975, 45976, 45977, 45978, 45979, 45980, 45981, 45982, 45983,
+  45984, 45985, 45986, 45987, 45988, 45989, 45990, 45991, 45992, 45993, 45994, 45995, 45996, 45997, 45998, 45999,
+  46000, 46001, 46002, 46003, 46004, 46005, 46006, 46007, 46008, 46009, 46010, 46011, 46012, 46013, 46014, 46015,
+  46016, 46017, 46018, 46019, 46020, 46021, 46022, 46023, 46024, 46025, 46026, 46027, 46028, 46029, 46030, 46031,
+  46032, 46033, 46034, 46035, 46036, 46037, 46038, 46039, 46040, 46041, 46042, 46043, 46044, 46045, 46046, 46047,
+  46048, 46049, 46050, 46051, 46052, 46053, 46054, 46055, 46056, 46057, 46058, 46059, 46060, 46061, 46062, 46063,
+  46064, 46065, 46066, 46067, 46068, 46069, 46070, 46071, 46072, 46073, 46074, 46075, 46076, 46077, 46078, 46079,
+  46080, 46081, 46082, 46083, 46084, 46085, 46086, 46087, 46088, 46089, 46090, 46091, 46092, 46093, 46094, 46095,
+  46096, 46097, 46098, 46099, 46100, 46101, 46102, 46103, 46104, 46105, 46106, 46107, 46108, 46109, 46110, 46111,
+  46112, 46113, 46114, 46115, 46116, 46117, 46118, 46119, 46120, 46121, 46122, 46123, 46124, 46125, 46126, 46127,
+  46128, 46129, 46130, 46131, 46132, 46133, 46134, 46135, 46136, 46137, 46138, 46139, 46140, 46141, 46142, 46143,
+  46144, 46145, 46146, 46147, 46148, 46149, 46150, 46151, 46152, 46153, 46154, 46155, 46156, 46157, 46158, 46159,
+  46160, 46161, 46162, 46163, 46164, 46165, 46166, 46167, 46168, 46169, 46170, 46171, 46172, 46173, 46174, 46175,
+  46176, 46177, 46178, 46179, 46180, 46181, 46182, 46183, 46184, 46185, 46186, 46187, 46188, 46189, 46190, 46191,
+  46192, 46193, 46194, 46195, 46196, 46197, 46198, 46199, 46200, 46201, 46202, 46203, 46204, 46205, 46206, 46207,
+  46208, 46209, 46210, 46211, 46212, 46213, 46214, 46215, 46216, 46217, 46218, 46219, 46220, 46221, 46222, 46223,
+  46224, 46225, 46226, 46227, 46228, 46229, 46230, 46231, 46232, 46233, 46234, 46235, 46236, 46237, 46238, 46239,
+  46240, 46241, 46242, 46243, 46244, 46245, 46246, 46247, 46248, 46249, 46250, 46251, 46252, 46253, 46254, 46255,
+  46256, 46257, 46258, 46259, 46260, 46261, 46262, 46263, 46264, 46265, 46266, 46267, 46268, 46269, 46270, 46271,
+  46272, 46273, 46274, 46275, 46276, 46277, 46278, 46279, 46280, 46281, 46282, 46283, 46284, 46285, 46286, 46287,
+  46288, 46289, 46290, 46291, 46292, 46293, 46294, 46295, 46296, 46297, 46298, 46299, 46300, 46301, 46302, 46303,
+  46304, 46305, 46306, 46307, 46308, 46309, 46310, 46311, 46312, 46313, 46314, 46315, 46316, 46317, 46318, 46319,
+  46320, 46321, 46322, 46323, 46324, 46325, 46326, 46327, 46328, 46329, 46330, 46331, 46332, 46333, 46334, 46335,
+  46336, 46337, 46338, 46339, 46340, 46341, 46342, 46343, 46344, 46345, 46346, 46347, 46348, 46349, 46350, 46351,
+  46352, 46353, 46354, 46355, 46356, 46357, 46358, 46359, 46360, 46361, 46362, 46363, 46364, 46365, 46366, 46367,
+  46368, 46369, 46370, 46371, 46372, 46373, 46374, 46375, 46376, 46377, 46378, 46379, 46380, 46381, 46382, 46383,
+  46384, 46385, 46386, 46387, 46388, 46389, 46390, 46391, 46392, 46393, 46394, 46395, 46396, 46397, 46398, 46399,
+  46400, 46401, 46402, 46403, 46404, 46405, 46406, 46407, 46408, 46409, 46410, 46411, 46412, 46413, 46414, 46415,
+  46416, 46417, 46418, 46419, 46420, 46421, 46422, 46423, 46424, 46425, 46426, 46427, 46428, 46429, 46430, 46431,
+  46432, 46433, 46434, 46435, 46436, 46437, 46438, 46439, 46440, 46441, 46442, 46443, 46444, 46445, 46446, 46447,
+  46448, 46449, 46450, 46451, 46452, 46453, 46454, 46455, 46456, 46457, 46458, 46459, 46460, 46461, 46462, 46463,
+  46464, 46465, 46466, 46467, 46468, 46469, 46470, 46471, 46472, 46473, 46474, 46475, 46476, 46477, 46478, 46479,
+  46480, 46481, 46482, 46483, 46484, 46485, 46486, 46487, 46488, 46489, 46490, 46491, 46492, 46493, 46494, 46495,
+  46496, 46497, 46498, 46499, 46500, 46501, 46502, 46503, 46504, 46505, 46506, 46507, 46508, 46509, 46510, 46511,
+  46512, 46513, 46514, 46515, 46516, 46517, 46518, 46519, 46520, 46521, 46522, 46523, 46524, 46525, 46526, 46527,
+  46528, 46529, 46530, 46531, 46532, 46533, 46534, 46535, 46536, 46537, 46538, 46539, 46540, 46541, 46542, 46543,
+  46544, 46545, 46546, 46547, 46548, 46549, 46550, 46551, 46552, 46553, 46554, 46555, 46556, 46557, 46558, 46559,
+  46560, 46561, 46562, 46563, 46564, 46565, 46566, 46567, 46568, 46569, 46570, 46571, 46572, 46573, 46574, 46575,
+  46576, 46577, 46578, 46579, 46580, 46581, 46582, 46583, 46584, 46585, 46586, 46587, 46588, 46589, 46590, 46591,
+  46592, 46593, 46594, 46595, 46596, 46597, 46598, 46599, 46600, 46601, 46602, 46603, 46604, 46605, 46606, 46607,
+  46608, 46609, 46610, 46611, 46612, 46613, 46614, 46615, 46616, 46617, 46618, 46619, 46620, 46621, 46622, 46623,
+  46624, 46625, 46626, 46627, 46628, 46629, 46630, 46631, 46632, 46633, 46634, 46635, 46636, 46637, 46638, 46639,
+  46640, 46641, 46642, 46643, 46644, 46645, 46646, 46647, 46648, 46649, 46650, 46651, 46652, 46653, 46654, 46655,
+  46656, 46657, 46658, 46659, 46660, 46661, 46662, 46663, 46664, 46665, 46666, 46667, 46668, 46669, 46670, 46671,
+  46672, 46673, 46674, 46675, 46676, 46677, 46678, 46679, 46680, 46681, 46682, 46683, 46684, 46685, 46686, 46687,
+  46688, 46689, 46690, 46691, 46692, 46693, 46694, 46695, 46696, 46697, 46698, 46699, 46700, 46701, 46702, 46703,
+  46704, 46705, 46706, 46707, 46708, 46709, 46710, 46711, 46712, 46713, 46714, 46715, 46716, 46717, 46718, 46719,
+  46720, 46721, 46722, 46723, 46724, 46725, 46726, 46727, 46728, 46729, 46730, 46731, 46732, 46733, 46734, 46735,
+  46736, 46737, 46738, 46739, 46740, 46741, 46742, 46743, 46744, 46745, 46746, 46747, 46748, 46749, 46750, 46751,
+  46752, 46753, 46754, 46755, 46756, 46757, 46758, 46759, 46760, 46761, 46762, 46763, 46764, 46765, 46766, 46767,
+  46768, 46769, 46770, 46771, 46772, 46773, 46774, 46775, 46776, 46777, 46778, 46779, 46780, 46781, 46782, 46783,
+  46784, 46785, 46786, 46787, 46788, 46789, 46790, 46791, 46792, 46793, 46794, 46795, 46796, 46797, 46798, 46799,
+  46800, 46801, 46802, 46803, 46804, 46805, 46806, 46807, 46808, 46809, 46810, 46811, 46812, 46813, 46814, 46815,
+  46816, 46817, 46818, 46819, 46820, 46821, 46822, 46823, 46824, 46825, 46826, 46827, 46828, 46829, 46830, 46831,
+  46832, 46833, 46834, 46835, 46836, 46837, 46838, 46839, 46840, 46841, 46842, 46843, 46844, 46845, 46846, 46847,
+  46848, 46849, 46850, 46851, 46852, 46853, 46854, 46855, 46856, 46857, 46858, 46859, 46860, 46861, 46862, 46863,
+  46864, 46865, 46866, 46867, 46868, 46869, 46870, 46871, 46872, 46873, 46874, 46875, 46876, 46877, 46878, 46879,
+  46880, 46881, 46882, 46883, 46884, 46885, 46886, 46887, 46888, 46889, 46890, 46891, 46892, 46893, 46894, 46895,
+  46896, 46897, 46898, 46899, 46900, 46901, 46902, 46903, 46904, 46905, 46906, 46907, 46908, 46909, 46910, 46911,
+  46912, 46913, 46914, 46915, 46916, 46917, 46918, 46919, 46920, 46921, 46922, 46923, 46924, 46925, 46926, 46927,
+  46928, 46929, 46930, 46931, 46932, 46933, 46934, 46935, 46936, 46937, 46938, 46939, 46940, 46941, 46942, 46943,
+  46944, 46945, 46946, 46947, 46948, 46949, 46950, 46951, 46952, 46953, 46954, 46955, 46956, 46957, 46958, 46959,
+  46960, 46961, 46962, 46963, 46964, 46965, 46966, 46967, 46968, 46969, 46970, 46971, 46972, 46973, 46974, 46975,
+  46976, 46977, 46978, 46979, 46980, 46981, 46982, 46983, 46984, 46985, 46986, 46987, 46988, 46989, 46990, 46991,
+  46992, 46993, 46994, 46995, 46996, 46997, 46998, 46999, 47000, 47001, 47002, 47003, 47004, 47005, 47006, 47007,
+  47008, 47009, 47010, 47011, 47012, 47013, 47014, 47015, 47016, 47017, 47018, 47019, 47020, 47021, 47022, 47023,
+  47024, 47025, 47026, 47027, 47028, 47029, 47030, 47031, 47032, 47033, 47034, 47035, 47036, 47037, 47038, 47039,
+  47040, 47041, 47042, 47043, 47044, 47045, 47046, 47047, 47048, 47049, 47050, 47051, 47052, 47053, 47054, 47055,
+  47056, 47057, 47058, 47059, 47060, 47061, 47062, 47063, 47064, 47065, 47066, 47067, 47068, 47069, 47070, 47071,
+  47072, 47073, 47074, 47075, 47076, 47077, 47078, 47079, 47080, 47081, 47082, 47083, 47084, 47085, 47086, 47087,
+  47088, 47089, 47090, 47091, 47092, 47093, 47094, 47095, 47096, 47097, 47098, 47099, 47100, 47101, 47102, 47103,
+  47104, 47105, 47106, 47107, 47108, 47109, 47110, 47111, 47112, 47113, 47114, 47115, 47116, 47117, 47118, 47119,
+  47120, 47121, 47122, 47123, 47124, 47125, 47126, 47127, 47128, 47129, 47130, 47131, 47132, 47133, 47134, 47135,
+  47136, 47137, 47138, 47139, 47140, 47141, 47142, 47143, 47144, 47145, 47146, 47147, 47148, 47149, 47150, 47151,
+  47152, 47153, 47154, 47155, 47156, 47157, 47158, 47159, 47160, 47161, 47162, 47163, 47164, 47165, 47166, 47167,
+  47168, 47169, 47170, 47171, 47172, 47173, 47174, 47175, 47176, 47177, 47178, 47179, 47180, 47181, 47182, 47183,
+  47184, 47185, 47186, 47187, 47188, 47189, 47190, 47191, 47192, 47193, 47194, 47195, 47196, 47197, 47198, 47199,
+  47200, 47201, 47202, 47203, 47204, 47205, 47206, 47207, 47208, 47209, 47210, 47211, 47212, 47213, 47214, 47215,
+  47216, 47217, 47218, 47219, 47220, 47221, 47222, 47223, 47224, 47225, 47226, 47227, 47228, 47229, 47230, 47231,
+  47232, 47233, 47234, 47235, 47236, 47237, 47238, 47239, 47240, 47241, 47242, 47243, 47244, 47245, 47246, 47247,
+  47248, 47249, 47250, 47251, 47252, 47253, 47254, 47255, 47256, 47257, 47258, 47259, 47260, 47261, 47262, 47263,
+  47264, 47265, 47266, 47267, 47268, 47269, 47270, 47271, 47272, 47273, 47274, 47275, 47276, 47277, 47278, 47279,
+  47280, 47281, 47282, 47283, 47284, 47285, 47286, 47287, 47288, 47289, 47290, 47291, 47292, 47293, 47294, 47295,
+  47296, 47297, 47298, 47299, 47300, 47301, 47302, 47303, 47304, 47305, 47306, 47307, 47308, 47309, 47310, 47311,
+  47312, 47313, 47314, 47315, 47316, 47317, 47318, 47319, 47320, 47321, 47322, 47323, 47324, 47325, 47326, 47327,
+  47328, 47329, 47330, 47331, 47332, 47333, 47334, 47335, 47336, 47337, 47338, 47339, 47340, 47341, 47342, 47343,
+  47344, 47345, 47346, 47347, 47348, 47349, 47350, 47351, 47352, 47353, 47354, 47355, 47356, 47357, 47358, 47359,
+  47360, 47361, 47362, 47363, 47364, 47365, 47366, 47367, 47368, 47369, 47370, 47371, 47372, 47373, 47374, 47375,
+  47376, 47377, 47378, 47379, 47380, 47381, 47382, 47383, 47384, 47385, 47386, 47387, 47388, 47389, 47390, 47391,
+  47392, 47393, 47394, 47395, 47396, 47397, 47398, 47399, 47400, 47401, 47402, 47403, 47404, 47405, 47406, 47407,
+  47408, 47409, 47410, 47411, 47412, 47413, 47414, 47415, 47416, 47417, 47418, 47419, 47420, 47421, 47422, 47423,
+  47424, 47425, 47426, 47427, 47428, 47429, 47430, 47431, 47432, 47433, 47434, 47435, 47436, 47437, 47438, 47439,
+  47440, 47441, 47442, 47443, 47444, 47445, 47446, 47447, 47448, 47449, 47450, 47451, 47452, 47453, 47454, 47455,
+  47456, 47457, 47458, 47459, 47460, 47461, 47462, 47463, 47464, 47465, 47466, 47467, 47468, 47469, 47470, 47471,
+  47472, 47473, 47474, 47475, 47476, 47477, 47478, 47479, 47480, 47481, 47482, 47483, 47484, 47485, 47486, 47487,
+  47488, 47489, 47490, 47491, 47492, 47493, 47494, 47495, 47496, 47497, 47498, 47499, 47500, 47501, 47502, 47503,
+  47504, 47505, 47506, 47507, 47508, 47509, 47510, 47511, 47512, 47513, 47514, 47515, 47516, 47517, 47518, 47519,
+  47520, 47521, 47522, 47523, 47524, 47525, 47526, 47527, 47528, 47529, 47530, 47531, 47532, 47533, 47534, 47535,
+  47536, 47537, 47538, 47539, 47540, 47541, 47542, 47543, 47544, 47545, 47546, 47547, 47548, 47549, 47550, 47551,
+  47552, 47553, 47554, 47555, 47556, 47557, 47558, 47559, 47560, 47561, 47562, 47563, 47564, 47565, 47566, 47567,
+  47568, 47569, 47570, 47571, 47572, 47573, 47574, 47575, 47576, 47577, 47578, 47579, 47580, 47581, 47582, 47583,
+  47584, 47585, 47586, 47587, 47588, 47589, 47590, 47591, 47592, 47593, 47594, 47595, 47596, 47597, 47598, 47599,
+  47600, 47601, 47602, 47603, 47604, 47605, 47606, 47607, 47608, 47609, 47610, 47611, 47612, 47613, 47614, 47615,
+  47616, 47617, 47618, 47619, 47620, 47621, 47622, 47623, 47624, 47625, 47626, 47627, 47628, 47629, 47630, 47631,
+  47632, 47633, 47634, 47635, 47636, 47637, 47638, 47639, 47640, 47641, 47642, 47643, 47644, 47645, 47646, 47647,
+  47648, 47649, 47650, 47651, 47652, 47653, 47654, 47655, 47656, 47657, 47658, 47659, 47660, 47661, 47662, 47663,
+  47664, 47665, 47666, 47667, 47668, 47669, 47670, 47671, 47672, 47673, 47674, 47675, 47676, 47677, 47678, 47679,
+  47680, 47681, 47682, 47683, 47684, 47685, 47686, 47687, 47688, 47689, 47690, 47691, 47692, 47693, 47694, 47695,
+  47696, 47697, 47698, 47699, 47700, 47701, 47702, 47703, 47704, 47705, 47706, 47707, 47708, 47709, 47710, 47711,
+  47712, 47713, 47714, 47715, 47716, 47717, 47718, 47719, 47720, 47721, 47722, 47723, 47724, 47725, 47726, 47727,
+  47728, 47729, 47730, 47731, 47732, 47733, 47734, 47735, 47736, 47737, 47738, 47739, 47740, 47741, 47742, 47743,
+  47744, 47745, 47746, 47747, 47748, 47749, 47750, 47751, 47752, 47753, 47754, 47755, 47756, 47757, 47758, 47759,
+  47760, 47761, 47762, 47763, 47764, 47765, 47766, 47767, 47768, 47769, 47770, 47771, 47772, 47773, 47774, 47775,
+  47776, 47777, 47778, 47779, 47780, 47781, 47782, 47783, 47784, 47785, 47786, 47787, 47788, 47789, 47790, 47791,
+  47792, 47793, 47794, 47795, 47796, 47797, 47798, 47799, 47800, 47801, 47802, 47803, 47804, 47805, 47806, 47807,
+  47808, 47809, 47810, 47811, 47812, 47813, 47814, 47815, 47816, 47817, 47818, 47819, 47820, 47821, 47822, 47823,
+  47824, 47825, 47826, 47827, 47828, 47829, 47830, 47831, 47832, 47833, 47834, 47835, 47836, 47837, 47838, 47839,
+  47840, 47841, 47842, 47843, 47844, 47845, 47846, 47847, 47848, 47849, 47850, 47851, 47852, 47853, 47854, 47855,
+  47856, 47857, 47858, 47859, 47860, 47861, 47862, 47863, 47864, 47865, 47866, 47867, 47868, 47869, 47870, 47871,
+  47872, 47873, 47874, 47875, 47876, 47877, 47878, 47879, 47880, 47881, 47882, 47883, 47884, 47885, 47886, 47887,
+  47888, 47889, 47890, 47891, 47892, 47893, 47894, 47895, 47896, 47897, 47898, 47899, 47900, 47901, 47902, 47903,
+  47904, 47905, 47906, 47907, 47908, 47909, 47910, 47911, 47912, 47913, 47914, 47915, 47916, 47917, 47918, 47919,
+  47920, 47921, 47922, 47923, 47924, 47925, 47926, 47927, 47928, 47929, 47930, 47931, 47932, 47933, 47934, 47935,
+  47936, 47937, 47938, 47939, 47940, 47941, 47942, 47943, 47944, 47945, 47946, 47947, 47948, 47949, 47950, 47951,
+  47952, 47953, 47954, 47955, 47956, 47957, 47958, 47959, 47960, 47961, 47962, 47963, 47964, 47965, 47966, 47967,
+  47968, 47969, 47970, 47971, 47972, 47973, 47974, 47975, 47976, 47977, 47978, 47979, 47980, 47981, 47982, 47983,
+  47984, 47985, 47986, 47987, 47988, 47989, 47990, 47991, 47992, 47993, 47994, 47995, 47996, 47997, 47998, 47999,
+  48000, 48001, 48002, 48003, 48004, 48005, 48006, 48007, 48008, 48009, 48010, 48011, 48012, 48013, 48014, 48015,
+  48016, 48017, 48018, 48019, 48020, 48021, 48022, 48023, 48024, 48025, 48026, 48027, 48028, 48029, 48030, 48031,
+  48032, 48033, 48034, 48035, 48036, 48037, 48038, 48039, 48040, 48041, 48042, 48043, 48044, 48045, 48046, 48047,
+  48048, 48049, 48050, 48051, 48052, 48053, 48054, 48055, 48056, 48057, 48058, 48059, 48060, 48061, 48062, 48063,
+  48064, 48065, 48066, 48067, 48068, 48069, 48070, 48071, 48072, 48073, 48074, 48075, 48076, 48077, 48078, 48079,
+  48080, 48081, 48082, 48083, 48084, 48085, 48086, 48087, 48088, 48089, 48090, 48091, 48092, 48093, 48094, 48095,
+  48096, 48097, 48098, 48099, 48100, 48101, 48102, 48103, 48104, 48105, 48106, 48107, 48108, 48109, 48110, 48111,
+  48112, 48113, 48114, 48115, 48116, 48117, 48118, 48119, 48120, 48121, 48122, 48123, 48124, 48125, 48126, 48127,
+  48128, 48129, 48130, 48131, 48132, 48133, 48134, 48135, 48136, 48137, 48138, 48139, 48140, 48141, 48142, 48143,
+  48144, 48145, 48146, 48147, 48148, 48149, 48150, 48151, 48152, 48153, 48154, 48155, 48156, 48157, 48158, 48159,
+  48160, 48161, 48162, 48163, 48164, 48165, 48166, 48167, 48168, 48169, 48170, 48171, 48172, 48173, 48174, 48175,
+  48176, 48177, 48178, 48179, 48180, 48181, 48182, 48183, 48184, 48185, 48186, 48187, 48188, 48189, 48190, 48191,
+  48192, 48193, 48194, 48195, 48196, 48197, 48198, 48199, 48200, 48201, 48202, 48203, 48204, 48205, 48206, 48207,
+  48208, 48209, 48210, 48211, 48212, 48213, 48214, 48215, 48216, 48217, 48218, 48219, 48220, 48221, 48222, 48223,
+  48224, 48225, 48226, 48227, 48228, 48229, 48230, 48231, 48232, 48233, 48234, 48235, 48236, 48237, 48238, 48239,
+  48240, 48241, 48242, 48243, 48244, 48245, 48246, 48247, 48248, 48249, 48250, 48251, 48252, 48253, 48254, 48255,
+  48256, 48257, 48258, 48259, 48260, 48261, 48262, 48263, 48264, 48265, 48266, 48267, 48268, 48269, 48270, 48271,
+  48272, 48273, 48274, 48275, 48276, 48277, 48278, 48279, 48280, 48281, 48282, 48283, 48284, 48285, 48286, 48287,
+  48288, 48289, 48290, 48291, 48292, 48293, 48294, 48295, 48296, 48297, 48298, 48299, 48300, 48301, 48302, 48303,
+  48304, 48305, 48306, 48307, 48308, 48309, 48310, 48311, 48312, 48313, 48314, 48315, 48316, 48317, 48318, 48319,
+  48320, 48321, 48322, 48323, 48324, 48325, 48326, 48327, 48328, 48329, 48330, 48331, 48332, 48333, 48334, 48335,
+  48336, 48337, 48338, 48339, 48340, 48341, 48342, 48343, 48344, 48345, 48346, 48347, 48348, 48349, 48350, 48351,
+  48352, 48353, 48354, 48355, 48356, 48357, 48358, 48359, 48360, 48361, 48362, 48363, 48364, 48365, 48366, 48367,
+  48368, 48369, 48370, 48371, 48372, 48373, 48374, 48375, 48376, 48377, 48378, 48379, 48380, 48381, 48382, 48383,
+  48384, 48385, 48386, 48387, 48388, 48389, 48390, 48391, 48392, 48393, 48394, 48395, 48396, 48397, 48398, 48399,
+  48400, 48401, 48402, 48403, 48404, 48405, 48406, 48407, 48408, 48409, 48410, 48411, 48412, 48413, 48414, 48415,
+  48416, 48417, 48418, 48419, 48420, 48421, 48422, 48423, 48424, 48425, 48426, 48427, 48428, 48429, 48430, 48431,
+  48432, 48433, 48434, 48435, 48436, 48437, 48438, 48439, 48440, 48441, 48442, 48443, 48444, 48445, 48446, 48447,
+  48448, 48449, 48450, 48451, 48452, 48453, 48454, 48455, 48456, 48457, 48458, 48459, 48460, 48461, 48462, 48463,
+  48464, 48465, 48466, 48467, 48468, 48469, 48470, 48471, 48472, 48473, 48474, 48475, 48476, 48477, 48478, 48479,
+  48480, 48481, 48482, 48483, 48484, 48485, 48486, 48487, 48488, 48489, 48490, 48491, 48492, 48493, 48494, 48495,
+  48496, 48497, 48498, 48499, 48500, 48501, 48502, 48503, 48504, 48505, 48506, 48507, 48508, 48509, 48510, 48511,
+  48512, 48513, 48514, 48515, 48516, 48517, 48518, 48519, 48520, 48521, 48522, 48523, 48524, 48525, 48526, 48527,
+  48528, 48529, 48530, 48531, 48532, 48533, 48534, 48535, 48536, 48537, 48538, 48539, 48540, 48541, 48542, 48543,
+  48544, 48545, 48546, 48547, 48548, 48549, 48550, 48551, 48552, 48553, 48554, 48555, 48556, 48557, 48558, 48559,
+  48560, 48561, 48562, 48563, 48564, 48565, 48566, 48567, 48568, 48569, 48570, 48571, 48572, 48573, 48574, 48575,
+  48576, 48577, 48578, 48579, 48580, 48581, 48582, 48583, 48584, 48585, 48586, 48587, 48588, 48589, 48590, 48591,
+  48592, 48593, 48594, 48595, 48596, 48597, 48598, 48599, 48600, 48601, 48602, 48603, 48604, 48605, 48606, 48607,
+  48608, 48609, 48610, 48611, 48612, 48613, 48614, 48615, 48616, 48617, 48618, 48619, 48620, 48621, 48622, 48623,
+  48624, 48625, 48626, 48627, 48628, 48629, 48630, 48631, 48632, 48633, 48634, 48635, 48636, 48637, 48638, 48639,
+  48640, 48641, 48642, 48643, 48644, 48645, 48646, 48647, 48648, 48649, 48650, 48651, 48652, 48653, 48654, 48655,
+  48656, 48657, 48658, 48659, 48660, 48661, 48662, 48663, 48664, 48665, 48666, 48667, 48668, 48669, 48670, 48671,
+  48672, 48673, 48674, 48675, 48676, 48677, 48678, 48679, 48680, 48681, 48682, 48683, 48684, 48685, 48686, 48687,
+  48688, 48689, 48690, 48691, 48692, 48693, 48694, 48695, 48696, 48697, 48698, 48699, 48700, 48701, 48702, 48703,
+  48704, 48705, 48706, 48707, 48708, 48709, 48710, 48711, 48712, 48713, 48714, 48715, 48716, 48717, 48718, 48719,
+  48720, 48721, 48722, 48723, 48724, 48725, 48726, 48727, 48728, 48729, 48730, 48731, 48732, 48733, 48734, 48735,
+  48736, 48737, 48738, 48739, 48740, 48741, 48742, 48743, 48744, 48745, 48746, 48747, 48748, 48749, 48750, 48751,
+  48752, 48753, 48754, 48755, 48756, 48757, 48758, 48759, 48760, 48761, 48762, 48763, 48764, 48765, 48766, 48767,
+  48768, 48769, 48770, 48771, 48772, 48773, 48774, 48775, 48776, 48777, 48778, 48779, 48780, 48781, 48782, 48783,
+  48784, 48785, 48786, 48787, 48788, 48789, 48790, 48791, 48792, 48793, 48794, 48795, 48796, 48797, 48798, 48799,
+  48800, 48801, 48802, 48803, 48804, 48805, 48806, 48807, 48808, 48809, 48810, 48811, 48812, 48813, 48814, 48815,
+  48816, 48817, 48818, 48819, 48820, 48821, 48822, 48823, 48824, 48825, 48826, 48827, 48828, 48829, 48830, 48831,
+  48832, 48833, 48834, 48835, 48836, 48837, 48838, 48839, 48840, 48841, 48842, 48843, 48844, 48845, 48846, 48847,
+  48848, 48849, 48850, 48851, 48852, 48853, 48854, 48855, 48856, 48857, 48858, 48859, 48860, 48861, 48862, 48863,
+  48864, 48865, 48866, 48867, 48868, 48869, 48870, 48871, 48872, 48873, 48874, 48875, 48876, 48877, 48878, 48879,
+  48880, 48881, 48882, 48883, 48884, 48885, 48886, 48887, 48888, 48889, 48890, 48891, 48892, 48893, 48894, 48895,
+  48896, 48897, 48898, 48899, 48900, 48901, 48902, 48903, 48904, 48905, 48906, 48907, 48908, 48909, 48910, 48911,
+  48912, 48913, 48914, 48915, 48916, 48917, 48918, 48919, 48920, 48921, 48922, 48923, 48924, 48925, 48926, 48927,
+  48928, 48929, 48930, 48931, 48932, 48933, 48934, 48935, 48936, 48937, 48938, 48939, 48940, 48941, 48942, 48943,
+  48944, 48945, 48946, 48947, 48948, 48949, 48950, 48951, 48952, 48953, 48954, 48955, 48956, 48957, 48958, 48959,
+  48960, 48961, 48962, 48963, 48964, 48965, 48966, 48967, 48968, 48969, 48970, 48971, 48972, 48973, 48974, 48975,
+  48976, 48977, 48978, 48979, 48980, 48981, 48982, 48983, 48984, 48985, 48986, 48987, 48988, 48989, 48990, 48991,
+  48992, 48993, 48994, 48995, 48996, 48997, 48998, 48999, 49000, 49001, 49002, 49003, 49004, 49005, 49006, 49007,
+  49008, 49009, 49010, 49011, 49012, 49013, 49014, 49015, 49016, 49017, 49018, 49019, 49020, 49021, 49022, 49023,
+  49024, 49025, 49026, 49027, 49028, 49029, 49030, 49031, 49032, 49033, 49034, 49035, 49036, 49037, 49038, 49039,
+  49040, 49041, 49042, 49043, 49044, 49045, 49046, 49047, 49048, 49049, 49050, 49051, 49052, 49053, 49054, 49055,
+  49056, 49057, 49058, 49059, 49060, 49061, 49062, 49063, 49064, 49065, 49066, 49067, 49068, 49069, 49070, 49071,
+  49072, 49073, 49074, 49075, 49076, 49077, 49078, 49079, 49080, 49081, 49082, 49083, 49084, 49085, 49086, 49087,
+  49088, 49089, 49090, 49091, 49092, 49093, 49094, 49095, 49096, 49097, 49098, 49099, 49100, 49101, 49102, 49103,
+  49104, 49105, 49106, 49107, 49108, 49109, 49110, 49111, 49112, 49113, 49114, 49115, 49116, 49117, 49118, 49119,
+  49120, 49121, 49122, 49123, 49124, 49125, 49126, 49127, 49128, 49129, 49130, 49131, 49132, 49133, 49134, 49135,
+  49136, 49137, 49138, 49139, 49140, 49141, 49142, 49143, 49144, 49145, 49146, 49147, 49148, 49149, 49150, 49151,
+  49152, 49153, 49154, 49155, 49156, 49157, 49158, 49159, 49160, 49161, 49162, 49163, 49164, 49165, 49166, 49167,
+  49168, 49169, 49170, 49171, 49172, 49173, 49174, 49175, 49176, 49177, 49178, 49179, 49180, 49181, 49182, 49183,
+  49184, 49185, 49186, 49187, 49188, 49189, 49190, 49191, 49192, 49193, 49194, 49195, 49196, 49197, 49198, 49199,
+  49200, 49201, 49202, 49203, 49204, 49205, 49206, 49207, 49208, 49209, 49210, 49211, 49212, 49213, 49214, 49215,
+  49216, 49217, 49218, 49219, 49220, 49221, 49222, 49223, 49224, 49225, 49226, 49227, 49228, 49229, 49230, 49231,
+  49232, 49233, 49234, 49235, 49236, 49237, 49238, 49239, 49240, 49241, 49242, 49243, 49244, 49245, 49246, 49247,
+  49248, 49249, 49250, 49251, 49252, 49253, 49254, 49255, 49256, 49257, 49258, 49259, 49260, 49261, 49262, 49263,
+  49264, 49265, 49266, 49267, 49268, 49269, 49270, 49271, 49272, 49273, 49274, 49275, 49276, 49277, 49278, 49279,
+  49280, 49281, 49282, 49283, 49284, 49285, 49286, 49287, 49288, 49289, 49290, 49291, 49292, 49293, 49294, 49295,
+  49296, 49297, 49298, 49299, 49300, 49301, 49302, 49303, 49304, 49305, 49306, 49307, 49308, 49309, 49310, 49311,
+  49312, 49313, 49314, 49315, 49316, 49317, 49318, 49319, 49320, 49321, 49322, 49323, 49324, 49325, 49326, 49327,
+  49328, 49329, 49330, 49331, 49332, 49333, 49334, 49335, 49336, 49337, 49338, 49339, 49340, 49341, 49342, 49343,
+  49344, 49345, 49346, 49347, 49348, 49349, 49350, 49351, 49352, 49353, 49354, 49355, 49356, 49357, 49358, 49359,
+  49360, 49361, 49362, 49363, 49364, 49365, 49366, 49367, 49368, 49369, 49370, 49371, 49372, 49373, 49374, 49375,
+  49376, 49377, 49378, 49379, 49380, 49381, 49382, 49383, 49384, 49385, 49386, 49387, 49388, 49389, 49390, 49391,
+  49392, 49393, 49394, 49395, 49396, 49397, 49398, 49399, 49400, 49401, 49402, 49403, 49404, 49405, 49406, 49407,
+  49408, 49409, 49410, 49411, 49412, 49413, 49414, 49415, 49416, 49417, 49418, 49419, 49420, 49421, 49422, 49423,
+  49424, 49425, 49426, 49427, 49428, 49429, 49430, 49431, 49432, 49433, 49434, 49435, 49436, 49437, 49438, 49439,
+  49440, 49441, 49442, 49443, 49444, 49445, 49446, 49447, 49448, 49449, 49450, 49451, 49452, 49453, 49454, 49455,
+  49456, 49457, 49458, 49459, 49460, 49461, 49462, 49463, 49464, 49465, 49466, 49467, 49468, 49469, 49470, 49471,
+  49472, 49473, 49474, 49475, 49476, 49477, 49478, 49479, 49480, 49481, 49482, 49483, 49484, 49485, 49486, 49487,
+  49488, 49489, 49490, 49491, 49492, 49493, 49494, 49495, 49496, 49497, 49498, 49499, 49500, 49501, 49502, 49503,
+  49504, 49505, 49506, 49507, 49508, 49509, 49510, 49511, 49512, 49513, 49514, 49515, 49516, 49517, 49518, 49519,
+  49520, 49521, 49522, 49523, 49524, 49525, 49526, 49527, 49528, 49529, 49530, 49531, 49532, 49533, 49534, 49535,
+  49536, 49537, 49538, 49539, 49540, 49541, 49542, 49543, 49544, 49545, 49546, 49547, 49548, 49549, 49550, 49551,
+  49552, 49553, 49554, 49555, 49556, 49557, 49558, 49559, 49560, 49561, 49562, 49563, 49564, 49565, 49566, 49567,
+  49568, 49569, 49570, 49571, 49572, 49573, 49574, 49575, 49576, 49577, 49578, 49579, 49580, 49581, 49582, 49583,
+  49584, 49585, 49586, 49587, 49588, 49589, 49590, 49591, 49592, 49593, 49594, 49595, 49596, 49597, 49598, 49599,
+  49600, 49601, 49602, 49603, 49604, 49605, 49606, 49607, 49608, 49609, 49610, 49611, 49612, 49613, 49614, 49615,
+  49616, 49617, 49618, 49619, 49620, 49621, 49622, 49623, 49624, 49625, 49626, 49627, 49628, 49629, 49630, 49631,
+  49632, 49633, 49634, 49635, 49636, 49637, 49638, 49639, 49640, 49641, 49642, 49643, 49644, 49645, 49646, 49647,
+  49648, 49649, 49650, 49651, 49652, 49653, 49654, 49655, 49656, 49657, 49658, 49659, 49660, 49661, 49662, 49663,
+  49664, 49665, 49666, 49667, 49668, 49669, 49670, 49671, 49672, 49673, 49674, 49675, 49676, 49677, 49678, 49679,
+  49680, 49681, 49682, 49683, 49684, 49685, 49686, 49687, 49688, 49689, 49690, 49691, 49692, 49693, 49694, 49695,
+  49696, 49697, 49698, 49699, 49700, 49701, 49702, 49703, 49704, 49705, 49706, 49707, 49708, 49709, 49710, 49711,
+  49712, 49713, 49714, 49715, 49716, 49717, 49718, 49719, 49720, 49721, 49722, 49723, 49724, 49725, 49726, 49727,
+  49728, 49729, 49730, 49731, 49732, 49733, 49734, 49735, 49736, 49737, 49738, 49739, 49740, 49741, 49742, 49743,
+  49744, 49745, 49746, 49747, 49748, 49749, 49750, 49751, 49752, 49753, 49754, 49755, 49756, 49757, 49758, 49759,
+  49760, 49761, 49762, 49763, 49764, 49765, 49766, 49767, 49768, 49769, 49770, 49771, 49772, 49773, 49774, 49775,
+  49776, 49777, 49778, 49779, 49780, 49781, 49782, 49783, 49784, 49785, 49786, 49787, 49788, 49789, 49790, 49791,
+  49792, 49793, 49794, 49795, 49796, 49797, 49798, 49799, 49800, 49801, 49802, 49803, 49804, 49805, 49806, 49807,
+  49808, 49809, 49810, 49811, 49812, 49813, 49814, 49815, 49816, 49817, 49818, 49819, 49820, 49821, 49822, 49823,
+  49824, 49825, 49826, 49827, 49828, 49829, 49830, 49831, 49832, 49833, 49834, 49835, 49836, 49837, 49838, 49839,
+  49840, 49841, 49842, 49843, 49844, 49845, 49846, 49847, 49848, 49849, 49850, 49851, 49852, 49853, 49854, 49855,
+  49856, 49857, 49858, 49859, 49860, 49861, 49862, 49863, 49864, 49865, 49866, 49867, 49868, 49869, 49870, 49871,
+  49872, 49873, 49874, 49875, 49876, 49877, 49878, 49879, 49880, 49881, 49882, 49883, 49884, 49885, 49886, 49887,
+  49888, 49889, 49890, 49891, 49892, 49893, 49894, 49895, 49896, 49897, 49898, 49899, 49900, 49901, 49902, 49903,
+  49904, 49905, 49906, 49907, 49908, 49909, 49910, 49911, 49912, 49913, 49914, 49915, 49916, 49917, 49918, 49919,
+  49920, 49921, 49922, 49923, 49924, 49925, 49926, 49927, 49928, 49929, 49930, 49931, 49932, 49933, 49934, 49935,
+  49936, 49937, 49938, 49939, 49940, 49941, 49942, 49943, 49944, 49945, 49946, 49947, 49948, 49949, 49950, 49951,
+  49952, 49953, 49954, 49955, 49956, 49957, 49958, 49959, 49960, 49961, 49962, 49963, 49964, 49965, 49966, 49967,
+  49968, 49969, 49970, 49971, 49972, 49973, 49974, 49975, 49976, 49977, 49978, 49979, 49980, 49981, 49982, 49983,
+  49984, 49985, 49986, 49987, 49988, 49989, 49990, 49991, 49992, 49993, 49994, 49995, 49996, 49997, 49998, 49999,
+  50000, 50001, 50002, 50003, 50004, 50005, 50006, 50007, 50008, 50009, 50010, 50011, 50012, 50013, 50014, 50015,
+  50016, 50017, 50018, 50019, 50020, 50021, 50022, 50023, 50024, 50025, 50026, 50027, 50028, 50029, 50030, 50031,
+  50032, 50033, 50034, 50035, 50036, 50037, 50038, 50039, 50040, 50041, 50042, 50043, 50044, 50045, 50046, 50047,
+  50048, 50049, 50050, 50051, 50052, 50053, 50054, 50055, 50056, 50057, 50058, 50059, 50060, 50061, 50062, 50063,
+  50064, 50065, 50066, 50067, 50068, 50069, 50070, 50071, 50072, 50073, 50074, 50075, 50076, 50077, 50078, 50079,
+  50080, 50081, 50082, 50083, 50084, 50085, 50086, 50087, 50088, 50089, 50090, 50091, 50092, 50093, 50094, 50095,
+  50096, 50097, 50098, 50099, 50100, 50101, 50102, 50103, 50104, 50105, 50106, 50107, 50108, 50109, 50110, 50111,
+  50112, 50113, 50114, 50115, 50116, 50117, 50118, 50119, 50120, 50121, 50122, 50123, 50124, 50125, 50126, 50127,
+  50128, 50129, 50130, 50131, 50132, 50133, 50134, 50135, 50136, 50137, 50138, 50139, 50140, 50141, 50142, 50143,
+  50144, 50145, 50146, 50147, 50148, 50149, 50150, 50151, 50152, 50153, 50154, 50155, 50156, 50157, 50158, 50159,
+  50160, 50161, 50162, 50163, 50164, 50165, 50166, 50167, 50168, 50169, 50170, 50171, 50172, 50173, 50174, 50175,
+  50176, 50177, 50178, 50179, 50180, 50181, 50182, 50183, 50184, 50185, 50186, 50187, 50188, 50189, 50190, 50191,
+  50192, 50193, 50194, 50195, 50196, 50197, 50198, 50199, 50200, 50201, 50202, 50203, 50204, 50205, 50206, 50207,
+  50208, 50209, 50210, 50211, 50212, 50213, 50214, 50215, 50216, 50217, 50218, 50219, 50220, 50221, 50222, 50223,
+  50224, 50225, 50226, 50227, 50228, 50229, 50230, 50231, 50232, 50233, 50234, 50235, 50236, 50237, 50238, 50239,
+  50240, 50241, 50242, 50243, 50244, 50245, 50246, 50247, 50248, 50249, 50250, 50251, 50252, 50253, 50254, 50255,
+  50256, 50257, 50258, 50259, 50260, 50261, 50262, 50263, 50264, 50265, 50266, 50267, 50268, 50269, 50270, 50271,
+  50272, 50273, 50274, 50275, 50276, 50277, 50278, 50279, 50280, 50281, 50282, 50283, 50284, 50285, 50286, 50287,
+  50288, 50289, 50290, 50291, 50292, 50293, 50294, 50295, 50296, 50297, 50298, 50299, 50300, 50301, 50302, 50303,
+  50304, 50305, 50306, 50307, 50308, 50309, 50310, 50311, 50312, 50313, 50314, 50315, 50316, 50317, 50318, 50319,
+  50320, 50321, 50322, 50323, 50324, 50325, 50326, 50327, 50328, 50329, 50330, 50331, 50332, 50333, 50334, 50335,
+  50336, 50337, 50338, 50339, 50340, 50341, 50342, 50343, 50344, 50345, 50346, 50347, 50348, 50349, 50350, 50351,
+  50352, 50353, 50354, 50355, 50356, 50357, 50358, 50359, 50360, 50361, 50362, 50363, 50364, 50365, 50366, 50367,
+  50368, 50369, 50370, 50371, 50372, 50373, 50374, 50375, 50376, 50377, 50378, 50379, 50380, 50381, 50382, 50383,
+  50384, 50385, 50386, 50387, 50388, 50389, 50390, 50391, 50392, 50393, 50394, 50395, 50396, 50397, 50398, 50399,
+  50400, 50401, 50402, 50403, 50404, 50405, 50406, 50407, 50408, 50409, 50410, 50411, 50412, 50413, 50414, 50415,
+  50416, 50417, 50418, 50419, 50420, 50421, 50422, 50423, 50424, 50425, 50426, 50427, 50428, 50429, 50430, 50431,
+  50432, 50433, 50434, 50435, 50436, 50437, 50438, 50439, 50440, 50441, 50442, 50443, 50444, 50445, 50446, 50447,
+  50448, 50449, 50450, 50451, 50452, 50453, 50454, 50455, 50456, 50457, 50458, 50459, 50460, 50461, 50462, 50463,
+  50464, 50465, 50466, 50467, 50468, 50469, 50470, 50471, 50472, 50473, 50474, 50475, 50476, 50477, 50478, 50479,
+  50480, 50481, 50482, 50483, 50484, 50485, 50486, 50487, 50488, 50489, 50490, 50491, 50492, 50493, 50494, 50495,
+  50496, 50497, 50498, 50499, 50500, 50501, 50502, 50503, 50504, 50505, 50506, 50507, 50508, 50509, 50510, 50511,
+  50512, 50513, 50514, 50515, 50516, 50517, 50518, 50519, 50520, 50521, 50522, 50523, 50524, 50525, 50526, 50527,
+  50528, 50529, 50530, 50531, 50532, 50533, 50534, 50535, 50536, 50537, 50538, 50539, 50540, 50541, 50542, 50543,
+  50544, 50545, 50546, 50547, 50548, 50549, 50550, 50551, 50552, 50553, 50554, 50555, 50556, 50557, 50558, 50559,
+  50560, 50561, 50562, 50563, 50564, 50565, 50566, 50567, 50568, 50569, 50570, 50571, 50572, 50573, 50574, 50575,
+  50576, 50577, 50578, 50579, 50580, 50581, 50582, 50583, 50584, 50585, 50586, 50587, 50588, 50589, 50590, 50591,
+  50592, 50593, 50594, 50595, 50596, 50597, 50598, 50599, 50600, 50601, 50602, 50603, 50604, 50605, 50606, 50607,
+  50608, 50609, 50610, 50611, 50612, 50613, 50614, 50615, 50616, 50617, 50618, 50619, 50620, 50621, 50622, 50623,
+  50624, 50625, 50626, 50627, 50628, 50629, 50630, 50631, 50632, 50633, 50634, 50635, 50636, 50637, 50638, 50639,
+  50640, 50641, 50642, 50643, 50644, 50645, 50646, 50647, 50648, 50649, 50650, 50651, 50652, 50653, 50654, 50655,
+  50656, 50657, 50658, 50659, 50660, 50661, 50662, 50663, 50664, 50665, 50666, 50667, 50668, 50669, 50670, 50671,
+  50672, 50673, 50674, 50675, 50676, 50677, 50678, 50679, 50680, 50681, 50682, 50683, 50684, 50685, 50686, 50687,
+  50688, 50689, 50690, 50691, 50692, 50693, 50694, 50695, 50696, 50697, 50698, 50699, 50700, 50701, 50702, 50703,
+  50704, 50705, 50706, 50707, 50708, 50709, 50710, 50711, 50712, 50713, 50714, 50715, 50716, 50717, 50718, 50719,
+  50720, 50721, 50722, 50723, 50724, 50725, 50726, 50727, 50728, 50729, 50730, 50731, 50732, 50733, 50734, 50735,
+  50736, 50737, 50738, 50739, 50740, 50741, 50742, 50743, 50744, 50745, 50746, 50747, 50748, 50749, 50750, 50751,
+  50752, 50753, 50754, 50755, 50756, 50757, 50758, 50759, 50760, 50761, 50762, 50763, 50764, 50765, 50766, 50767,
+  50768, 50769, 50770, 50771, 50772, 50773, 50774, 50775, 50776, 50777, 50778, 50779, 50780, 50781, 50782, 50783,
+  50784, 50785, 50786, 50787, 50788, 50789, 50790, 50791, 50792, 50793, 50794, 50795, 50796, 50797, 50798, 50799,
+  50800, 50801, 50802, 50803, 50804, 50805, 50806, 50807, 50808, 50809, 50810, 50811, 50812, 50813, 50814, 50815,
+  50816, 50817, 50818, 50819, 50820, 50821, 50822, 50823, 50824, 50825, 50826, 50827, 50828, 50829, 50830, 50831,
+  50832, 50833, 50834, 50835, 50836, 50837, 50838, 50839, 50840, 50841, 50842, 50843, 50844, 50845, 50846, 50847,
+  50848, 50849, 50850, 50851, 50852, 50853, 50854, 50855, 50856, 50857, 50858, 50859, 50860, 50861, 50862, 50863,
+  50864, 50865, 50866, 50867, 50868, 50869, 50870, 50871, 50872, 50873, 50874, 50875, 50876, 50877, 50878, 50879,
+  50880, 50881, 50882, 50883, 50884, 50885, 50886, 50887, 50888, 50889, 50890, 50891, 50892, 50893, 50894, 50895,
+  50896, 50897, 50898, 50899, 50900, 50901, 50902, 50903, 50904, 50905, 50906, 50907, 50908, 50909, 50910, 50911,
+  50912, 50913, 50914, 50915, 50916, 50917, 50918, 50919, 50920, 50921, 50922, 50923, 50924, 50925, 50926, 50927,
+  50928, 50929, 50930, 50931, 50932, 50933, 50934, 50935, 50936, 50937, 50938, 50939, 50940, 50941, 50942, 50943,
+  50944, 50945, 50946, 50947, 50948, 50949, 50950, 50951, 50952, 50953, 50954, 50955, 50956, 50957, 50958, 50959,
+  50960, 50961, 50962, 50963, 50964, 50965, 50966, 50967, 50968, 50969, 50970, 50971, 50972, 50973, 50974, 50975,
+  50976, 50977, 50978, 50979, 50980, 50981, 50982, 50983, 50984, 50985, 50986, 50987, 50988, 50989, 50990, 50991,
+  50992, 50993, 50994, 50995, 50996, 50997, 50998, 50999, 51000, 51001, 51002, 51003, 51004, 51005, 51006, 51007,
+  51008, 51009, 51010, 51011, 51012, 51013, 51014, 51015, 51016, 51017, 51018, 51019, 51020, 51021, 51022, 51023,
+  51024, 51025, 51026, 51027, 51028, 51029, 51030, 51031, 51032, 51033, 51034, 51035, 51036, 51037, 51038, 51039,
+  51040, 51041, 51042, 51043, 51044, 51045, 51046, 51047, 51048, 51049, 51050, 51051, 51052, 51053, 51054, 51055,
+  51056, 51057, 51058, 51059, 51060, 51061, 51062, 51063, 51064, 51065, 51066, 51067, 51068, 51069, 51070, 51071,
+  51072, 51073, 51074, 51075, 51076, 51077, 51078, 51079, 51080, 51081, 51082, 51083, 51084, 51085, 51086, 51087,
+  51088, 51089, 51090, 51091, 51092, 51093, 51094, 51095, 51096, 51097, 51098, 51099, 51100, 51101, 51102, 51103,
+  51104, 51105, 51106, 51107, 51108, 51109, 51110, 51111, 51112, 51113, 51114, 51115, 51116, 51117, 51118, 51119,
+  51120, 51121, 51122, 51123, 51124, 51125, 51126, 51127, 51128, 51129, 51130, 51131, 51132, 51133, 51134, 51135,
+  51136, 51137, 51138, 51139, 51140, 51141, 51142, 51143, 51144, 51145, 51146, 51147, 51148, 51149, 51150, 51151,
+  51152, 51153, 51154, 51155, 51156, 51157, 51158, 51159, 51160, 51161, 51162, 51163, 51164, 51165, 51166, 51167,
+  51168, 51169, 51170, 51171, 51172, 51173, 51174, 51175, 51176, 51177, 51178, 51179, 51180, 51181, 51182, 51183,
+  51184, 51185, 51186, 51187, 51188, 51189, 51190, 51191, 51192, 51193, 51194, 51195, 51196, 51197, 51198, 51199,
+  51200, 51201, 51202, 51203, 51204, 51205, 51206, 51207, 51208, 51209, 51210, 51211, 51212, 51213, 51214, 51215,
+  51216, 51217, 51218, 51219, 51220, 51221, 51222, 51223, 51224, 51225, 51226, 51227, 51228, 51229, 51230, 51231,
+  51232, 51233, 51234, 51235, 51236, 51237, 51238, 51239, 51240, 51241, 51242, 51243, 51244, 51245, 51246, 51247,
+  51248, 51249, 51250, 51251, 51252, 51253, 51254, 51255, 51256, 51257, 51258, 51259, 51260, 51261, 51262, 51263,
+  51264, 51265, 51266, 51267, 51268, 51269, 51270, 51271, 51272, 51273, 51274, 51275, 51276, 51277, 51278, 51279,
+  51280, 51281, 51282, 51283, 51284, 51285, 51286, 51287, 51288, 51289, 51290, 51291, 51292, 51293, 51294, 51295,
+  51296, 51297, 51298, 51299, 51300, 51301, 51302, 51303, 51304, 51305, 51306, 51307, 51308, 51309, 51310, 51311,
+  51312, 51313, 51314, 51315, 51316, 51317, 51318, 51319, 51320, 51321, 51322, 51323, 51324, 51325, 51326, 51327,
+  51328, 51329, 51330, 51331, 51332, 51333, 51334, 51335, 51336, 51337, 51338, 51339, 51340, 51341, 51342, 51343,
+  51344, 51345, 51346, 51347, 51348, 51349, 51350, 51351, 51352, 51353, 51354, 51355, 51356, 51357, 51358, 51359,
+  51360, 51361, 51362, 51363, 51364, 51365, 51366, 51367, 51368, 51369, 51370, 51371, 51372, 51373, 51374, 51375,
+  51376, 51377, 51378, 51379, 51380, 51381, 51382, 51383, 51384, 51385, 51386, 51387, 51388, 51389, 51390, 51391,
+  51392, 51393, 51394, 51395, 51396, 51397, 51398, 51399, 51400, 51401, 51402, 51403, 51404, 51405, 51406, 51407,
+  51408, 51409, 51410, 51411, 51412, 51413, 51414, 51415, 51416, 51417, 51418, 51419, 51420, 51421, 51422, 51423,
+  51424, 51425, 51426, 51427, 51428, 51429, 51430, 51431, 51432, 51433, 51434, 51435, 51436, 51437, 51438, 51439,
+  51440, 51441, 51442, 51443, 51444, 51445, 51446, 51447, 51448, 51449, 51450, 51451, 51452, 51453, 51454, 51455,
+  51456, 51457, 51458, 51459, 51460, 51461, 51462, 51463, 51464, 51465, 51466, 51467, 51468, 51469, 51470, 51471,
+  51472, 51473, 51474, 51475, 51476, 51477, 51478, 51479, 51480, 51481, 51482, 51483, 51484, 51485, 51486, 51487,
+  51488, 51489, 51490, 51491, 51492, 51493, 51494, 51495, 51496, 51497, 51498, 51499, 51500, 51501, 51502, 51503,
+  51504, 51505, 51506, 51507, 51508, 51509, 51510, 51511, 51512, 51513, 51514, 51515, 51516, 51517, 51518, 51519,
+  51520, 51521, 51522, 51523, 51524, 51525, 51526, 51527, 51528, 51529, 51530, 51531, 51532, 51533, 51534, 51535,
+  51536, 51537, 51538, 51539, 51540, 51541, 51542, 51543, 51544, 51545, 51546, 51547, 51548, 51549, 51550, 51551,
+  51552, 51553, 51554, 51555, 51556, 51557, 51558, 51559, 51560, 51561, 51562, 51563, 51564, 51565, 51566, 51567,
+  51568, 51569, 51570, 51571, 51572, 51573, 51574, 51575, 51576, 51577, 51578, 51579, 51580, 51581, 51582, 51583,
+  51584, 51585, 51586, 51587, 51588, 51589, 51590, 51591, 51592, 51593, 51594, 51595, 51596, 51597, 51598, 51599,
+  51600, 51601, 51602, 51603, 51604, 51605, 51606, 51607, 51608, 51609, 51610, 51611, 51612, 51613, 51614, 51615,
+  51616, 51617, 51618, 51619, 51620, 51621, 51622, 51623, 51624, 51625, 51626, 51627, 51628, 51629, 51630, 51631,
+  51632, 51633, 51634, 51635, 51636, 51637, 51638, 51639, 51640, 51641, 51642, 51643, 51644, 51645, 51646, 51647,
+  51648, 51649, 51650, 51651, 51652, 51653, 51654, 51655, 51656, 51657, 51658, 51659, 51660, 51661, 51662, 51663,
+  51664, 51665, 51666, 51667, 51668, 51669, 51670, 51671, 51672, 51673, 51674, 51675, 51676, 51677, 51678, 51679,
+  51680, 51681, 51682, 51683, 51684, 51685, 51686, 51687, 51688, 51689, 51690, 51691, 51692, 51693, 51694, 51695,
+  51696, 51697, 51698, 51699, 51700, 51701, 51702, 51703, 51704, 51705, 51706, 51707, 51708, 51709, 51710, 51711,
+  51712, 51713, 51714, 51715, 51716, 51717, 51718, 51719, 51720, 51721, 51722, 51723, 51724, 51725, 51726, 51727,
+  51728, 51729, 51730, 51731, 51732, 51733, 51734, 51735, 51736, 51737, 51738, 51739, 51740, 51741, 51742, 51743,
+  51744, 51745, 51746, 51747, 51748, 51749, 51750, 51751, 51752, 51753, 51754, 51755, 51756, 51757, 51758, 51759,
+  51760, 51761, 51762, 51763, 51764, 51765, 51766, 51767, 51768, 51769, 51770, 51771, 51772, 51773, 51774, 51775,
+  51776, 51777, 51778, 51779, 51780, 51781, 51782, 51783, 51784, 51785, 51786, 51787, 51788, 51789, 51790, 51791,
+  51792, 51793, 51794, 51795, 51796, 51797, 51798, 51799, 51800, 51801, 51802, 51803, 51804, 51805, 51806, 51807,
+  51808, 51809, 51810, 51811, 51812, 51813, 51814, 51815, 51816, 51817, 51818, 51819, 51820, 51821, 51822, 51823,
+  51824, 51825, 51826, 51827, 51828, 51829, 51830, 51831, 51832, 51833, 51834, 51835, 51836, 51837, 51838, 51839,
+  51840, 51841, 51842, 51843, 51844, 51845, 51846, 51847, 51848, 51849, 51850, 51851, 51852, 51853, 51854, 51855,
+  51856, 51857, 51858, 51859, 51860, 51861, 51862, 51863, 51864, 51865, 51866, 51867, 51868, 51869, 51870, 51871,
+  51872, 51873, 51874, 51875, 51876, 51877, 51878, 51879, 51880, 51881, 51882, 51883, 51884, 51885, 51886, 51887,
+  51888, 51889, 51890, 51891, 51892, 51893, 51894, 51895, 51896, 51897, 51898, 51899, 51900, 51901, 51902, 51903,
+  51904, 51905, 51906, 51907, 51908, 51909, 51910, 51911, 51912, 51913, 51914, 51915, 51916, 51917, 51918, 51919,
+  51920, 51921, 51922, 51923, 51924, 51925, 51926, 51927, 51928, 51929, 51930, 51931, 51932, 51933, 51934, 51935,
+  51936, 51937, 51938, 51939, 51940, 51941, 51942, 51943, 51944, 51945, 51946, 51947, 51948, 51949, 51950, 51951,
+  51952, 51953, 51954, 51955, 51956, 51957, 51958, 51959, 51960, 51961, 51962, 51963, 51964, 51965, 51966, 51967,
+  51968, 51969, 51970, 51971, 51972, 51973, 51974, 51975, 51976, 51977, 51978, 51979, 51980, 51981, 51982, 51983,
+  51984, 51985, 51986, 51987, 51988, 51989, 51990, 51991, 51992, 51993, 51994, 51995, 51996, 51997, 51998, 51999,
+  52000, 52001, 52002, 52003, 52004, 52005, 52006, 52007, 52008, 52009, 52010, 52011, 52012, 52013, 52014, 52015,
+  52016, 52017, 52018, 52019, 52020, 52021, 52022, 52023, 52024, 52025, 52026, 52027, 52028, 52029, 52030, 52031,
+  52032, 52033, 52034, 52035, 52036, 52037, 52038, 52039, 52040, 52041, 52042, 52043, 52044, 52045, 52046, 52047,
+  52048, 52049, 52050, 52051, 52052, 52053, 52054, 52055, 52056, 52057, 52058, 52059, 52060, 52061, 52062, 52063,
+  52064, 52065, 52066, 52067, 52068, 52069, 52070, 52071, 52072, 52073, 52074, 52075, 52076, 52077, 52078, 52079,
+  52080, 52081, 52082, 52083, 52084, 52085, 52086, 52087, 52088, 52089, 52090, 52091, 52092, 52093, 52094, 52095,
+  52096, 52097, 52098, 52099, 52100, 52101, 52102, 52103, 52104, 52105, 52106, 52107, 52108, 52109, 52110, 52111,
+  52112, 52113, 52114, 52115, 52116, 52117, 52118, 52119, 52120, 52121, 52122, 52123, 52124, 52125, 52126, 52127,
+  52128, 52129, 52130, 52131, 52132, 52133, 52134, 52135, 52136, 52137, 52138, 52139, 52140, 52141, 52142, 52143,
+  52144, 52145, 52146, 52147, 52148, 52149, 52150, 52151, 52152, 52153, 52154, 52155, 52156, 52157, 52158, 52159,
+  52160, 52161, 52162, 52163, 52164, 52165, 52166, 52167, 52168, 52169, 52170, 52171, 52172, 52173, 52174, 52175,
+  52176, 52177, 52178, 52179, 52180, 52181, 52182, 52183, 52184, 52185, 52186, 52187, 52188, 52189, 52190, 52191,
+  52192, 52193, 52194, 52195, 52196, 52197, 52198, 52199, 52200, 52201, 52202, 52203, 52204, 52205, 52206, 52207,
+  52208, 52209, 52210, 52211, 52212, 52213, 52214, 52215, 52216, 52217, 52218, 52219, 52220, 52221, 52222, 52223,
+  52224, 52225, 52226, 52227, 52228, 52229, 52230, 52231, 52232, 52233, 52234, 52235, 52236, 52237, 52238, 52239,
+  52240, 52241, 52242, 52243, 52244, 52245, 52246, 52247, 52248, 52249, 52250, 52251, 52252, 52253, 52254, 52255,
+  52256, 52257, 52258, 52259, 52260, 52261, 52262, 52263, 52264, 52265, 52266, 52267, 52268, 52269, 52270, 52271,
+  52272, 52273, 52274, 52275, 52276, 52277, 52278, 52279, 52280, 52281, 52282, 52283, 52284, 52285, 52286, 52287,
+  52288, 52289, 52290, 52291, 52292, 52293, 52294, 52295, 52296, 52297, 52298, 52299, 52300, 52301, 52302, 52303,
+  52304, 52305, 52306, 52307, 52308, 52309, 52310, 52311, 52312, 52313, 52314, 52315, 52316, 52317, 52318, 52319,
+  52320, 52321, 52322, 52323, 52324, 52325, 52326, 52327, 52328, 52329, 52330, 52331, 52332, 52333, 52334, 52335,
+  52336, 52337, 52338, 52339, 52340, 52341, 52342, 52343, 52344, 52345, 52346, 52347, 52348, 52349, 52350, 52351,
+  52352, 52353, 52354, 52355, 52356, 52357, 52358, 52359, 52360, 52361, 52362, 52363, 52364, 52365, 52366, 52367,
+  52368, 52369, 52370, 52371, 52372, 52373, 52374, 52375, 52376, 52377, 52378, 52379, 52380, 52381, 52382, 52383,
+  52384, 52385, 52386, 52387, 52388, 52389, 52390, 52391, 52392, 52393, 52394, 52395, 52396, 52397, 52398, 52399,
+  52400, 52401, 52402, 52403, 52404, 52405, 52406, 52407, 52408, 52409, 52410, 52411, 52412, 52413, 52414, 52415,
+  52416, 52417, 52418, 52419, 52420, 52421, 52422, 52423, 52424, 52425, 52426, 52427, 52428, 52429, 52430, 52431,
+  52432, 52433, 52434, 52435, 52436, 52437, 52438, 52439, 52440, 52441, 52442, 52443, 52444, 52445, 52446, 52447,
+  52448, 52449, 52450, 52451, 52452, 52453, 52454, 52455, 52456, 52457, 52458, 52459, 52460, 52461, 52462, 52463,
+  52464, 52465, 52466, 52467, 52468, 52469, 52470, 52471, 52472, 52473, 52474, 52475, 52476, 52477, 52478, 52479,
+  52480, 52481, 52482, 52483, 52484, 52485, 52486, 52487, 52488, 52489, 52490, 52491, 52492, 52493, 52494, 52495,
+  52496, 52497, 52498, 52499, 52500, 52501, 52502, 52503, 52504, 52505, 52506, 52507, 52508, 52509, 52510, 52511,
+  52512, 52513, 52514, 52515, 52516, 52517, 52518, 52519, 52520, 52521, 52522, 52523, 52524, 52525, 52526, 52527,
+  52528, 52529, 52530, 52531, 52532, 52533, 52534, 52535, 52536, 52537, 52538, 52539, 52540, 52541, 52542, 52543,
+  52544, 52545, 52546, 52547, 52548, 52549, 52550, 52551, 52552, 52553, 52554, 52555, 52556, 52557, 52558, 52559,
+  52560, 52561, 52562, 52563, 52564, 52565, 52566, 52567, 52568, 52569, 52570, 52571, 52572, 52573, 52574, 52575,
+  52576, 52577, 52578, 52579, 52580, 52581, 52582, 52583, 52584, 52585, 52586, 52587, 52588, 52589, 52590, 52591,
+  52592, 52593, 52594, 52595, 52596, 52597, 52598, 52599, 52600, 52601, 52602, 52603, 52604, 52605, 52606, 52607,
+  52608, 52609, 52610, 52611, 52612, 52613, 52614, 52615, 52616, 52617, 52618, 52619, 52620, 52621, 52622, 52623,
+  52624, 52625, 52626, 52627, 52628, 52629, 52630, 52631, 52632, 52633, 52634, 52635, 52636, 52637, 52638, 52639,
+  52640, 52641, 52642, 52643, 52644, 52645, 52646, 52647, 52648, 52649, 52650, 52651, 52652, 52653, 52654, 52655,
+  52656, 52657, 52658, 52659, 52660, 52661, 52662, 52663, 52664, 52665, 52666, 52667, 52668, 52669, 52670, 52671,
+  52672, 52673, 52674, 52675, 52676, 52677, 52678, 52679, 52680, 52681, 52682, 52683, 52684, 52685, 52686, 52687,
+  52688, 52689, 52690, 52691, 52692, 52693, 52694, 52695, 52696, 52697, 52698, 52699, 52700, 52701, 52702, 52703,
+  52704, 52705, 52706, 52707, 52708, 52709, 52710, 52711, 52712, 52713, 52714, 52715, 52716, 52717, 52718, 52719,
+  52720, 52721, 52722, 52723, 52724, 52725, 52726, 52727, 52728, 52729, 52730, 52731, 52732, 52733, 52734, 52735,
+  52736, 52737, 52738, 52739, 52740, 52741, 52742, 52743, 52744, 52745, 52746, 52747, 52748, 52749, 52750, 52751,
+  52752, 52753, 52754, 52755, 52756, 52757, 52758, 52759, 52760, 52761, 52762, 52763, 52764, 52765, 52766, 52767,
+  52768, 52769, 52770, 52771, 52772, 52773, 52774, 52775, 52776, 52777, 52778, 52779, 52780, 52781, 52782, 52783,
+  52784, 52785, 52786, 52787, 52788, 52789, 52790, 52791, 52792, 52793, 52794, 52795, 52796, 52797, 52798, 52799,
+  52800, 52801, 52802, 52803, 52804, 52805, 52806, 52807, 52808, 52809, 52810, 52811, 52812, 52813, 52814, 52815,
+  52816, 52817, 52818, 52819, 52820, 52821, 52822, 52823, 52824, 52825, 52826, 52827, 52828, 52829, 52830, 52831,
+  52832, 52833, 52834, 52835, 52836, 52837, 52838, 52839, 52840, 52841, 52842, 52843, 52844, 52845, 52846, 52847,
+  52848, 52849, 52850, 52851, 52852, 52853, 52854, 52855, 52856, 52857, 52858, 52859, 52860, 52861, 52862, 52863,
+  52864, 52865, 52866, 52867, 52868, 52869, 52870, 52871, 52872, 52873, 52874, 52875, 52876, 52877, 52878, 52879,
+  52880, 52881, 52882, 52883, 52884, 52885, 52886, 52887, 52888, 52889, 52890, 52891, 52892, 52893, 52894, 52895,
+  52896, 52897, 52898, 52899, 52900, 52901, 52902, 52903, 52904, 52905, 52906, 52907, 52908, 52909, 52910, 52911,
+  52912, 52913, 52914, 52915, 52916, 52917, 52918, 52919, 52920, 52921, 52922, 52923, 52924, 52925, 52926, 52927,
+  52928, 52929, 52930, 52931, 52932, 52933, 52934, 52935, 52936, 52937, 52938, 52939, 52940, 52941, 52942, 52943,
+  52944, 52945, 52946, 52947, 52948, 52949, 52950, 52951, 52952, 52953, 52954, 52955, 52956, 52957, 52958, 52959,
+  52960, 52961, 52962, 52963, 52964, 52965, 52966, 52967, 52968, 52969, 52970, 52971, 52972, 52973, 52974, 52975,
+  52976, 52977, 52978, 52979, 52980, 52981, 52982, 52983, 52984, 52985, 52986, 52987, 52988, 52989, 52990, 52991,
+  52992, 52993, 52994, 52995, 52996, 52997, 52998, 52999, 53000, 53001, 53002, 53003, 53004, 53005, 53006, 53007,
+  53008, 53009, 53010, 53011, 53012, 53013, 53014, 53015, 53016, 53017, 53018, 53019, 53020, 53021, 53022, 53023,
+  53024, 53025, 53026, 53027, 53028, 53029, 53030, 53031, 53032, 53033, 53034, 53035, 53036, 53037, 53038, 53039,
+  53040, 53041, 53042, 53043, 53044, 53045, 53046, 53047, 53048, 53049, 53050, 53051, 53052, 53053, 53054, 53055,
+  53056, 53057, 53058, 53059, 53060, 53061, 53062, 53063, 53064, 53065, 53066, 53067, 53068, 53069, 53070, 53071,
+  53072, 53073, 53074, 53075, 53076, 53077, 53078, 53079, 53080, 53081, 53082, 53083, 53084, 53085, 53086, 53087,
+  53088, 53089, 53090, 53091, 53092, 53093, 53094, 53095, 53096, 53097, 53098, 53099, 53100, 53101, 53102, 53103,
+  53104, 53105, 53106, 53107, 53108, 53109, 53110, 53111, 53112, 53113, 53114, 53115, 53116, 53117, 53118, 53119,
+  53120, 53121, 53122, 53123, 53124, 53125, 53126, 53127, 53128, 53129, 53130, 53131, 53132, 53133, 53134, 53135,
+  53136, 53137, 53138, 53139, 53140, 53141, 53142, 53143, 53144, 53145, 53146, 53147, 53148, 53149, 53150, 53151,
+  53152, 53153, 53154, 53155, 53156, 53157, 53158, 53159, 53160, 53161, 53162, 53163, 53164, 53165, 53166, 53167,
+  53168, 53169, 53170, 53171, 53172, 53173, 53174, 53175, 53176, 53177, 53178, 53179, 53180, 53181, 53182, 53183,
+  53184, 53185, 53186, 53187, 53188, 53189, 53190, 53191, 53192, 53193, 53194, 53195, 53196, 53197, 53198, 53199,
+  53200, 53201, 53202, 53203, 53204, 53205, 53206, 53207, 53208, 53209, 53210, 53211, 53212, 53213, 53214, 53215,
+  53216, 53217, 53218, 53219, 53220, 53221, 53222, 53223, 53224, 53225, 53226, 53227, 53228, 53229, 53230, 53231,
+  53232, 53233, 53234, 53235, 53236, 53237, 53238, 53239, 53240, 53241, 53242, 53243, 53244, 53245, 53246, 53247,
+  53248, 53249, 53250, 53251, 53252, 53253, 53254, 53255, 53256, 53257, 53258, 53259, 53260, 53261, 53262, 53263,
+  53264, 53265, 53266, 53267, 53268, 53269, 53270, 53271, 53272, 53273, 53274, 53275, 53276, 53277, 53278, 53279,
+  53280, 53281, 53282, 53283, 53284, 53285, 53286, 53287, 53288, 53289, 53290, 53291, 53292, 53293, 53294, 53295,
+  53296, 53297, 53298, 53299, 53300, 53301, 53302, 53303, 53304, 53305, 53306, 53307, 53308, 53309, 53310, 53311,
+  53312, 53313, 53314, 53315, 53316, 53317, 53318, 53319, 53320, 53321, 53322, 53323, 53324, 53325, 53326, 53327,
+  53328, 53329, 53330, 53331, 53332, 53333, 53334, 53335, 53336, 53337, 53338, 53339, 53340, 53341, 53342, 53343,
+  53344, 53345, 53346, 53347, 53348, 53349, 53350, 53351, 53352, 53353, 53354, 53355, 53356, 53357, 53358, 53359,
+  53360, 53361, 53362, 53363, 53364, 53365, 53366, 53367, 53368, 53369, 53370, 53371, 53372, 53373, 53374, 53375,
+  53376, 53377, 53378, 53379, 53380, 53381, 53382, 53383, 53384, 53385, 53386, 53387, 53388, 53389, 53390, 53391,
+  53392, 53393, 53394, 53395, 53396, 53397, 53398, 53399, 53400, 53401, 53402, 53403, 53404, 53405, 53406, 53407,
+  53408, 53409, 53410, 53411, 53412, 53413, 53414, 53415, 53416, 53417, 53418, 53419, 53420, 53421, 53422, 53423,
+  53424, 53425, 53426, 53427, 53428, 53429, 53430, 53431, 53432, 53433, 53434, 53435, 53436, 53437, 53438, 53439,
+  53440, 53441, 53442, 53443, 53444, 53445, 53446, 53447, 53448, 53449, 53450, 53451, 53452, 53453, 53454, 53455,
+  53456, 53457, 53458, 53459, 53460, 53461, 53462, 53463, 53464, 53465, 53466, 53467, 53468, 53469, 53470, 53471,
+  53472, 53473, 53474, 53475, 53476, 53477, 53478, 53479, 53480, 53481, 53482, 53483, 53484, 53485, 53486, 53487,
+  53488, 53489, 53490, 53491, 53492, 53493, 53494, 53495, 53496, 53497, 53498, 53499, 53500, 53501, 53502, 53503,
+  53504, 53505, 53506, 53507, 53508, 53509, 53510, 53511, 53512, 53513, 53514, 53515, 53516, 53517, 53518, 53519,
+  53520, 53521, 53522, 53523, 53524, 53525, 53526, 53527, 53528, 53529, 53530, 53531, 53532, 53533, 53534, 53535,
+  53536, 53537, 53538, 53539, 53540, 53541, 53542, 53543, 53544, 53545, 53546, 53547, 53548, 53549, 53550, 53551,
+  53552, 53553, 53554, 53555, 53556, 53557, 53558, 53559, 53560, 53561, 53562, 53563, 53564, 53565, 53566, 53567,
+  53568, 53569, 53570, 53571, 53572, 53573, 53574, 53575, 53576, 53577, 53578, 53579, 53580, 53581, 53582, 53583,
+  53584, 53585, 53586, 53587, 53588, 53589, 53590, 53591, 53592, 53593, 53594, 53595, 53596, 53597, 53598, 53599,
+  53600, 53601, 53602, 53603, 53604, 53605, 53606, 53607, 53608, 53609, 53610, 53611, 53612, 53613, 53614, 53615,
+  53616, 53617, 53618, 53619, 53620, 53621, 53622, 53623, 53624, 53625, 53626, 53627, 53628, 53629, 53630, 53631,
+  53632, 53633, 53634, 53635, 53636, 53637, 53638, 53639, 53640, 53641, 53642, 53643, 53644, 53645, 53646, 53647,
+  53648, 53649, 53650, 53651, 53652, 53653, 53654, 53655, 53656, 53657, 53658, 53659, 53660, 53661, 53662, 53663,
+  53664, 53665, 53666, 53667, 53668, 53669, 53670, 53671, 53672, 53673, 53674, 53675, 53676, 53677, 53678, 53679,
+  53680, 53681, 53682, 53683, 53684, 53685, 53686, 53687, 53688, 53689, 53690, 53691, 53692, 53693, 53694, 53695,
+  53696, 53697, 53698, 53699, 53700, 53701, 53702, 53703, 53704, 53705, 53706, 53707, 53708, 53709, 53710, 53711,
+  53712, 53713, 53714, 53715, 53716, 53717, 53718, 53719, 53720, 53721, 53722, 53723, 53724, 53725, 53726, 53727,
+  53728, 53729, 53730, 53731, 53732, 53733, 53734, 53735, 53736, 53737, 53738, 53739, 53740, 53741, 53742, 53743,
+  53744, 53745, 53746, 53747, 53748, 53749, 53750, 53751, 53752, 53753, 53754, 53755, 53756, 53757, 53758, 53759,
+  53760, 53761, 53762, 53763, 53764, 53765, 53766, 53767, 53768, 53769, 53770, 53771, 53772, 53773, 53774, 53775,
+  53776, 53777, 53778, 53779, 53780, 53781, 53782, 53783, 53784, 53785, 53786, 53787, 53788, 53789, 53790, 53791,
+  53792, 53793, 53794, 53795, 53796, 53797, 53798, 53799, 53800, 53801, 53802, 53803, 53804, 53805, 53806, 53807,
+  53808, 53809, 53810, 53811, 53812, 53813, 53814, 53815, 53816, 53817, 53818, 53819, 53820, 53821, 53822, 53823,
+  53824, 53825, 53826, 53827, 53828, 53829, 53830, 53831, 53832, 53833, 53834, 53835, 53836, 53837, 53838, 53839,
+  53840, 53841, 53842, 53843, 53844, 53845, 53846, 53847, 53848, 53849, 53850, 53851, 53852, 53853, 53854, 53855,
+  53856, 53857, 53858, 53859, 53860, 53861, 53862, 53863, 53864, 53865, 53866, 53867, 53868, 53869, 53870, 53871,
+  53872, 53873, 53874, 53875, 53876, 53877, 53878, 53879, 53880, 53881, 53882, 53883, 53884, 53885, 53886, 53887,
+  53888, 53889, 53890, 53891, 53892, 53893, 53894, 53895, 53896, 53897, 53898, 53899, 53900, 53901, 53902, 53903,
+  53904, 53905, 53906, 53907, 53908, 53909, 53910, 53911, 53912, 53913, 53914, 53915, 53916, 53917, 53918, 53919,
+  53920, 53921, 53922, 53923, 53924, 53925, 53926, 53927, 53928, 53929, 53930, 53931, 53932, 53933, 53934, 53935,
+  53936, 53937, 53938, 53939, 53940, 53941, 53942, 53943, 53944, 53945, 53946, 53947, 53948, 53949, 53950, 53951,
+  53952, 53953, 53954, 53955, 53956, 53957, 53958, 53959, 53960, 53961, 53962, 53963, 53964, 53965, 53966, 53967,
+  53968, 53969, 53970, 53971, 53972, 53973, 53974, 53975, 53976, 53977, 53978, 53979, 53980, 53981, 53982, 53983,
+  53984, 53985, 53986, 53987, 53988, 53989, 53990, 53991, 53992, 53993, 53994, 53995, 53996, 53997, 53998, 53999,
+  54000, 54001, 54002, 54003, 54004, 54005, 54006, 54007, 54008, 54009, 54010, 54011, 54012, 54013, 54014, 54015,
+  54016, 54017, 54018, 54019, 54020, 54021, 54022, 54023, 54024, 54025, 54026, 54027, 54028, 54029, 54030, 54031,
+  54032, 54033, 54034, 54035, 54036, 54037, 54038, 54039, 54040, 54041, 54042, 54043, 54044, 54045, 54046, 54047,
+  54048, 54049, 54050, 54051, 54052, 54053, 54054, 54055, 54056, 54057, 54058, 54059, 54060, 54061, 54062, 54063,
+  54064, 54065, 54066, 54067, 54068, 54069, 54070, 54071, 54072, 54073, 54074, 54075, 54076, 54077, 54078, 54079,
+  54080, 54081, 54082, 54083, 54084, 54085, 54086, 54087, 54088, 54089, 54090, 54091, 54092, 54093, 54094, 54095,
+  54096, 54097, 54098, 54099, 54100, 54101, 54102, 54103, 54104, 54105, 54106, 54107, 54108, 54109, 54110, 54111,
+  54112, 54113, 54114, 54115, 54116, 54117, 54118, 54119, 54120, 54121, 54122, 54123, 54124, 54125, 54126, 54127,
+  54128, 54129, 54130, 54131, 54132, 54133, 54134, 54135, 54136, 54137, 54138, 54139, 54140, 54141, 54142, 54143,
+  54144, 54145, 54146, 54147, 54148, 54149, 54150, 54151, 54152, 54153, 54154, 54155, 54156, 54157, 54158, 54159,
+  54160, 54161, 54162, 54163, 54164, 54165, 54166, 54167, 54168, 54169, 54170, 54171, 54172, 54173, 54174, 54175,
+  54176, 54177, 54178, 54179, 54180, 54181, 54182, 54183, 54184, 54185, 54186, 54187, 54188, 54189, 54190, 54191,
+  54192, 54193, 54194, 54195, 54196, 54197, 54198, 54199, 54200, 54201, 54202, 54203, 54204, 54205, 54206, 54207,
+  54208, 54209, 54210, 54211, 54212, 54213, 54214, 54215, 54216, 54217, 54218, 54219, 54220, 54221, 54222, 54223,
+  54224, 54225, 54226, 54227, 54228, 54229, 54230, 54231, 54232, 54233, 54234, 54235, 54236, 54237, 54238, 54239,
+  54240, 54241, 54242, 54243, 54244, 54245, 54246, 54247, 54248, 54249, 54250, 54251, 54252, 54253, 54254, 54255,
+  54256, 54257, 54258, 54259, 54260, 54261, 54262, 54263, 54264, 54265, 54266, 54267, 54268, 54269, 54270, 54271,
+  54272, 54273, 54274, 54275, 54276, 54277, 54278, 54279, 54280, 54281, 54282, 54283, 54284, 54285, 54286, 54287,
+  54288, 54289, 54290, 54291, 54292, 54293, 54294, 54295, 54296, 54297, 54298, 54299, 54300, 54301, 54302, 54303,
+  54304, 54305, 54306, 54307, 54308, 54309, 54310, 54311, 54312, 54313, 54314, 54315, 54316, 54317, 54318, 54319,
+  54320, 54321, 54322, 54323, 54324, 54325, 54326, 54327, 54328, 54329, 54330, 54331, 54332, 54333, 54334, 54335,
+  54336, 54337, 54338, 54339, 54340, 54341, 54342, 54343, 54344, 54345, 54346, 54347, 54348, 54349, 54350, 54351,
+  54352, 54353, 54354, 54355, 54356, 54357, 54358, 54359, 54360, 54361, 54362, 54363, 54364, 54365, 54366, 54367,
+  54368, 54369, 54370, 54371, 54372, 54373, 54374, 54375, 54376, 54377, 54378, 54379, 54380, 54381, 54382, 54383,
+  54384, 54385, 54386, 54387, 54388, 54389, 54390, 54391, 54392, 54393, 54394, 54395, 54396, 54397, 54398, 54399,
+  54400, 54401, 54402, 54403, 54404, 54405, 54406, 54407, 54408, 54409, 54410, 54411, 54412, 54413, 54414, 54415,
+  54416, 54417, 54418, 54419, 54420, 54421, 54422, 54423, 54424, 54425, 54426, 54427, 54428, 54429, 54430, 54431,
+  54432, 54433, 54434, 54435, 54436, 54437, 54438, 54439, 54440, 54441, 54442, 54443, 54444, 54445, 54446, 54447,
+  54448, 54449, 54450, 54451, 54452, 54453, 54454, 54455, 54456, 54457, 54458, 54459, 54460, 54461, 54462, 54463,
+  54464, 54465, 54466, 54467, 54468, 54469, 54470, 54471, 54472, 54473, 54474, 54475, 54476, 54477, 54478, 54479,
+  54480, 54481, 54482, 54483, 54484, 54485, 54486, 54487, 54488, 54489, 54490, 54491, 54492, 54493, 54494, 54495,
+  54496, 54497, 54498, 54499, 54500, 54501, 54502, 54503, 54504, 54505, 54506, 54507, 54508, 54509, 54510, 54511,
+  54512, 54513, 54514, 54515, 54516, 54517, 54518, 54519, 54520, 54521, 54522, 54523, 54524, 54525, 54526, 54527,
+  54528, 54529, 54530, 54531, 54532, 54533, 54534, 54535, 54536, 54537, 54538, 54539, 54540, 54541, 54542, 54543,
+  54544, 54545, 54546, 54547, 54548, 54549, 54550, 54551, 54552, 54553, 54554, 54555, 54556, 54557, 54558, 54559,
+  54560, 54561, 54562, 54563, 54564, 54565, 54566, 54567, 54568, 54569, 54570, 54571, 54572, 54573, 54574, 54575,
+  54576, 54577, 54578, 54579, 54580, 54581, 54582, 54583, 54584, 54585, 54586, 54587, 54588, 54589, 54590, 54591,
+  54592, 54593, 54594, 54595, 54596, 54597, 54598, 54599, 54600, 54601, 54602, 54603, 54604, 54605, 54606, 54607,
+  54608, 54609, 54610, 54611, 54612, 54613, 54614, 54615, 54616, 54617, 54618, 54619, 54620, 54621, 54622, 54623,
+  54624, 54625, 54626, 54627, 54628, 54629, 54630, 54631, 54632, 54633, 54634, 54635, 54636, 54637, 54638, 54639,
+  54640, 54641, 54642, 54643, 54644, 54645, 54646, 54647, 54648, 54649, 54650, 54651, 54652, 54653, 54654, 54655,
+  54656, 54657, 54658, 54659, 54660, 54661, 54662, 54663, 54664, 54665, 54666, 54667, 54668, 54669, 54670, 54671,
+  54672, 54673, 54674, 54675, 54676, 54677, 54678, 54679, 54680, 54681, 54682, 54683, 54684, 54685, 54686, 54687,
+  54688, 54689, 54690, 54691, 54692, 54693, 54694, 54695, 54696, 54697, 54698, 54699, 54700, 54701, 54702, 54703,
+  54704, 54705, 54706, 54707, 54708, 54709, 54710, 54711, 54712, 54713, 54714, 54715, 54716, 54717, 54718, 54719,
+  54720, 54721, 54722, 54723, 54724, 54725, 54726, 54727, 54728, 54729, 54730, 54731, 54732, 54733, 54734, 54735,
+  54736, 54737, 54738, 54739, 54740, 54741, 54742, 54743, 54744, 54745, 54746, 54747, 54748, 54749, 54750, 54751,
+  54752, 54753, 54754, 54755, 54756, 54757, 54758, 54759, 54760, 54761, 54762, 54763, 54764, 54765, 54766, 54767,
+  54768, 54769, 54770, 54771, 54772, 54773, 54774, 54775, 54776, 54777, 54778, 54779, 54780, 54781, 54782, 54783,
+  54784, 54785, 54786, 54787, 54788, 54789, 54790, 54791, 54792, 54793, 54794, 54795, 54796, 54797, 54798, 54799,
+  54800, 54801, 54802, 54803, 54804, 54805, 54806, 54807, 54808, 54809, 54810, 54811, 54812, 54813, 54814, 54815,
+  54816, 54817, 54818, 54819, 54820, 54821, 54822, 54823, 54824, 54825, 54826, 54827, 54828, 54829, 54830, 54831,
+  54832, 54833, 54834, 54835, 54836, 54837, 54838, 54839, 54840, 54841, 54842, 54843, 54844, 54845, 54846, 54847,
+  54848, 54849, 54850, 54851, 54852, 54853, 54854, 54855, 54856, 54857, 54858, 54859, 54860, 54861, 54862, 54863,
+  54864, 54865, 54866, 54867, 54868, 54869, 54870, 54871, 54872, 54873, 54874, 54875, 54876, 54877, 54878, 54879,
+  54880, 54881, 54882, 54883, 54884, 54885, 54886, 54887, 54888, 54889, 54890, 54891, 54892, 54893, 54894, 54895,
+  54896, 54897, 54898, 54899, 54900, 54901, 54902, 54903, 54904, 54905, 54906, 54907, 54908, 54909, 54910, 54911,
+  54912, 54913, 54914, 54915, 54916, 54917, 54918, 54919, 54920, 54921, 54922, 54923, 54924, 54925, 54926, 54927,
+  54928, 54929, 54930, 54931, 54932, 54933, 54934, 54935, 54936, 54937, 54938, 54939, 54940, 54941, 54942, 54943,
+  54944, 54945, 54946, 54947, 54948, 54949, 54950, 54951, 54952, 54953, 54954, 54955, 54956, 54957, 54958, 54959,
+  54960, 54961, 54962, 54963, 54964, 54965, 54966, 54967, 54968, 54969, 54970, 54971, 54972, 54973, 54974, 54975,
+  54976, 54977, 54978, 54979, 54980, 54981, 54982, 54983, 54984, 54985, 54986, 54987, 54988, 54989, 54990, 54991,
+  54992, 54993, 54994, 54995, 54996, 54997, 54998, 54999, 55000, 55001, 55002, 55003, 55004, 55005, 55006, 55007,
+  55008, 55009, 55010, 55011, 55012, 55013, 55014, 55015, 55016, 55017, 55018, 55019, 55020, 55021, 55022, 55023,
+  55024, 55025, 55026, 55027, 55028, 55029, 55030, 55031, 55032, 55033, 55034, 55035, 55036, 55037, 55038, 55039,
+  55040, 55041, 55042, 55043, 55044, 55045, 55046, 55047, 55048, 55049, 55050, 55051, 55052, 55053, 55054, 55055,
+  55056, 55057, 55058, 55059, 55060, 55061, 55062, 55063, 55064, 55065, 55066, 55067, 55068, 55069, 55070, 55071,
+  55072, 55073, 55074, 55075, 55076, 55077, 55078, 55079, 55080, 55081, 55082, 55083, 55084, 55085, 55086, 55087,
+  55088, 55089, 55090, 55091, 55092, 55093, 55094, 55095, 55096, 55097, 55098, 55099, 55100, 55101, 55102, 55103,
+  55104, 55105, 55106, 55107, 55108, 55109, 55110, 55111, 55112, 55113, 55114, 55115, 55116, 55117, 55118, 55119,
+  55120, 55121, 55122, 55123, 55124, 55125, 55126, 55127, 55128, 55129, 55130, 55131, 55132, 55133, 55134, 55135,
+  55136, 55137, 55138, 55139, 55140, 55141, 55142, 55143, 55144, 55145, 55146, 55147, 55148, 55149, 55150, 55151,
+  55152, 55153, 55154, 55155, 55156, 55157, 55158, 55159, 55160, 55161, 55162, 55163, 55164, 55165, 55166, 55167,
+  55168, 55169, 55170, 55171, 55172, 55173, 55174, 55175, 55176, 55177, 55178, 55179, 55180, 55181, 55182, 55183,
+  55184, 55185, 55186, 55187, 55188, 55189, 55190, 55191, 55192, 55193, 55194, 55195, 55196, 55197, 55198, 55199,
+  55200, 55201, 55202, 55203,
+};
+const uint32_t ALPHA_140_LOWER_CPS[] = {
+  44032, 44033, 44034, 44035, 44036, 44037, 44038, 44039, 44040, 44041, 44042, 44043, 44044, 44045, 44046, 44047,
+  44048, 44049, 44050, 44051, 44052, 44053, 44054, 44055, 44056, 44057, 44058, 44059, 44060, 44061, 44062, 44063,
+  44064, 44065, 44066, 44067, 44068, 44069, 44070, 44071, 44072, 44073, 44074, 44075, 44076, 44077, 44078, 44079,
+  44080, 44081, 44082, 44083, 44084, 44085, 44086, 44087, 44088, 44089, 44090, 44091, 44092, 44093, 44094, 44095,
+  44096, 44097, 44098, 44099, 44100, 44101, 44102, 44103, 44104, 44105, 44106, 44107, 44108, 44109, 44110, 44111,
+  44112, 44113, 44114, 44115, 44116, 44117, 44118, 44119, 44120, 44121, 44122, 44123, 44124, 44125, 44126, 44127,
+  44128, 44129, 44130, 44131, 44132, 44133, 44134, 44135, 44136, 44137, 44138, 44139, 44140, 44141, 44142, 44143,
+  44144, 44145, 44146, 44147, 44148, 44149, 44150, 44151, 44152, 44153, 44154, 44155, 44156, 44157, 44158, 44159,
+  44160, 44161, 44162, 44163, 44164, 44165, 44166, 44167, 44168, 44169, 44170, 44171, 44172, 44173, 44174, 44175,
+  44176, 44177, 44178, 44179, 44180, 44181, 44182, 44183, 44184, 44185, 44186, 44187, 44188, 44189, 44190, 44191,
+  44192, 44193, 44194, 44195, 44196, 44197, 44198, 44199, 44200, 44201, 44202, 44203, 44204, 44205, 44206, 44207,
+  44208, 44209, 44210, 44211, 44212, 44213, 44214, 44215, 44216, 44217, 44218, 44219, 44220, 44221, 44222, 44223,
+  44224, 44225, 44226, 44227, 44228, 44229, 44230, 44231, 44232, 44233, 44234, 44235, 44236, 44237, 44238, 44239,
+  44240, 44241, 44242, 44243, 44244, 44245, 44246, 44247, 44248, 44249, 44250, 44251, 44252, 44253, 44254, 44255,
+  44256, 44257, 44258, 44259, 44260, 44261, 44262, 44263, 44264, 44265, 44266, 44267, 44268, 44269, 44270, 44271,
+  44272, 44273, 44274, 44275, 44276, 44277, 44278, 44279, 44280, 44281, 44282, 44283, 44284, 44285, 44286, 44287,
+  44288, 44289, 44290, 44291, 44292, 44293, 44294, 44295, 44296, 44297, 44298, 44299, 44300, 44301, 44302, 44303,
+  44304, 44305, 44306, 44307, 44308, 44309, 44310, 44311, 44312, 44313, 44314, 44315, 44316, 44317, 44318, 44319,
+  44320, 44321, 44322, 44323, 44324, 44325, 44326, 44327, 44328, 44329, 44330, 44331, 44332, 44333, 44334, 44335,
+  44336, 44337, 44338, 44339, 44340, 44341, 44342, 44343, 44344, 44345, 44346, 44347, 44348, 44349, 44350, 44351,
+  44352, 44353, 44354, 44355, 44356, 44357, 44358, 44359, 44360, 44361, 44362, 44363, 44364, 44365, 44366, 44367,
+  44368, 44369, 44370, 44371, 44372, 44373, 44374, 44375, 44376, 44377, 44378, 44379, 44380, 44381, 44382, 44383,
+  44384, 44385, 44386, 44387, 44388, 44389, 44390, 44391, 44392, 44393, 44394, 44395, 44396, 44397, 44398, 44399,
+  44400, 44401, 44402, 44403, 44404, 44405, 44406, 44407, 44408, 44409, 44410, 44411, 44412, 44413, 44414, 44415,
+  44416, 44417, 44418, 44419, 44420, 44421, 44422, 44423, 44424, 44425, 44426, 44427, 44428, 44429, 44430, 44431,
+  44432, 44433, 44434, 44435, 44436, 44437, 44438, 44439, 44440, 44441, 44442, 44443, 44444, 44445, 44446, 44447,
+  44448, 44449, 44450, 44451, 44452, 44453, 44454, 44455, 44456, 44457, 44458, 44459, 44460, 44461, 44462, 44463,
+  44464, 44465, 44466, 44467, 44468, 44469, 44470, 44471, 44472, 44473, 44474, 44475, 44476, 44477, 44478, 44479,
+  44480, 44481, 44482, 44483, 44484, 44485, 44486, 44487, 44488, 44489, 44490, 44491, 44492, 44493, 44494, 44495,
+  44496, 44497, 44498, 44499, 44500, 44501, 44502, 44503, 44504, 44505, 44506, 44507, 44508, 44509, 44510, 44511,
+  44512, 44513, 44514, 44515, 44516, 44517, 44518, 44519, 44520, 44521, 44522, 44523, 44524, 44525, 44526, 44527,
+  44528, 44529, 44530, 44531, 44532, 44533, 44534, 44535, 44536, 44537, 44538, 44539, 44540, 44541, 44542, 44543,
+  44544, 44545, 44546, 44547, 44548, 44549, 44550, 44551, 44552, 44553, 44554, 44555, 44556, 44557, 44558, 44559,
+  44560, 44561, 44562, 44563, 44564, 44565, 44566, 44567, 44568, 44569, 44570, 44571, 44572, 44573, 44574, 44575,
+  44576, 44577, 44578, 44579, 44580, 44581, 44582, 44583, 44584, 44585, 44586, 44587, 44588, 44589, 44590, 44591,
+  44592, 44593, 44594, 44595, 44596, 44597, 44598, 44599, 44600, 44601, 44602, 44603, 44604, 44605, 44606, 44607,
+  44608, 44609, 44610, 44611, 44612, 44613, 44614, 44615, 44616, 44617, 44618, 44619, 44620, 44621, 44622, 44623,
+  44624, 44625, 44626, 44627, 44628, 44629, 44630, 44631, 44632, 44633, 44634, 44635, 44636, 44637, 44638, 44639,
+  44640, 44641, 44642, 44643, 44644, 44645, 44646, 44647, 44648, 44649, 44650, 44651, 44652, 44653, 44654, 44655,
+  44656, 44657, 44658, 44659, 44660, 44661, 44662, 44663, 44664, 44665, 44666, 44667, 44668, 44669, 44670, 44671,
+  44672, 44673, 44674, 44675, 44676, 44677, 44678, 44679, 44680, 44681, 44682, 44683, 44684, 44685, 44686, 44687,
+  44688, 44689, 44690, 44691, 44692, 44693, 44694, 44695, 44696, 44697, 44698, 44699, 44700, 44701, 44702, 44703,
+  44704, 44705, 44706, 44707, 44708, 44709, 44710, 44711, 44712, 44713, 44714, 44715, 44716, 44717, 44718, 44719,
+  44720, 44721, 44722, 44723, 44724, 44725, 44726, 44727, 44728, 44729, 44730, 44731, 44732, 44733, 44734, 44735,
+  44736, 44737, 44738, 44739, 44740, 44741, 44742, 44743, 44744, 44745, 44746, 44747, 44748, 44749, 44750, 44751,
+  44752, 44753, 44754, 44755, 44756, 44757, 44758, 44759, 44760, 44761, 44762, 44763, 44764, 44765, 44766, 44767,
+  44768, 44769, 44770, 44771, 44772, 44773, 44774, 44775, 44776, 44777, 44778, 44779, 44780, 44781, 44782, 44783,
+  44784, 44785, 44786, 44787, 44788, 44789, 44790, 44791, 44792, 44793, 44794, 44795, 44796, 44797, 44798, 44799,
+  44800, 44801, 44802, 44803, 44804, 44805, 44806, 44807, 44808, 44809, 44810, 44811, 44812, 44813, 44814, 44815,
+  44816, 44817, 44818, 44819, 44820, 44821, 44822, 44823, 44824, 44825, 44826, 44827, 44828, 44829, 44830, 44831,
+  44832, 44833, 44834, 44835, 44836, 44837, 44838, 44839, 44840, 44841, 44842, 44843, 44844, 44845, 44846, 44847,
+  44848, 44849, 44850, 44851, 44852, 44853, 44854, 44855, 44856, 44857, 44858, 44859, 44860, 44861, 44862, 44863,
+  44864, 44865, 44866, 44867, 44868, 44869, 44870, 44871, 44872, 44873, 44874, 44875, 44876, 44877, 44878, 44879,
+  44880, 44881, 44882, 44883, 44884, 44885, 44886, 44887, 44888, 44889, 44890, 44891, 44892, 44893, 44894, 44895,
+  44896, 44897, 44898, 44899, 44900, 44901, 44902, 44903, 44904, 44905, 44906, 44907, 44908, 44909, 44910, 44911,
+  44912, 44913, 44914, 44915, 44916, 44917, 44918, 44919, 44920, 44921, 44922, 44923, 44924, 44925, 44926, 44927,
+  44928, 44929, 44930, 44931, 44932, 44933, 44934, 44935, 44936, 44937, 44938, 44939, 44940, 44941, 44942, 44943,
+  44944, 44945, 44946, 44947, 44948, 44949, 44950, 44951, 44952, 44953, 44954, 44955, 44956, 44957, 44958, 44959,
+  44960, 44961, 44962, 44963, 44964, 44965, 44966, 44967, 44968, 44969, 44970, 44971, 44972, 44973, 44974, 44975,
+  44976, 44977, 44978, 44979, 44980, 44981, 44982, 44983, 44984, 44985, 44986, 44987, 44988, 44989, 44990, 44991,
+  44992, 44993, 44994, 44995, 44996, 44997, 44998, 44999, 45000, 45001, 45002, 45003, 45004, 45005, 45006, 45007,
+  45008, 45009, 45010, 45011, 45012, 45013, 45014, 45015, 45016, 45017, 45018, 45019, 45020, 45021, 45022, 45023,
+  45024, 45025, 45026, 45027, 45028, 45029, 45030, 45031, 45032, 45033, 45034, 45035, 45036, 45037, 45038, 45039,
+  45040, 45041, 45042, 45043, 45044, 45045, 45046, 45047, 45048, 45049, 45050, 45051, 45052, 45053, 45054, 45055,
+  45056, 45057, 45058, 45059, 45060, 45061, 45062, 45063, 45064, 45065, 45066, 45067, 45068, 45069, 45070, 45071,
+  45072, 45073, 45074, 45075, 45076, 45077, 45078, 45079, 45080, 45081, 45082, 45083, 45084, 45085, 45086, 45087,
+  45088, 45089, 45090, 45091, 45092, 45093, 45094, 45095, 45096, 45097, 45098, 45099, 45100, 45101, 45102, 45103,
+  45104, 45105, 45106, 45107, 45108, 45109, 45110, 45111, 45112, 45113, 45114, 45115, 45116, 45117, 45118, 45119,
+  45120, 45121, 45122, 45123, 45124, 45125, 45126, 45127, 45128, 45129, 45130, 45131, 45132, 45133, 45134, 45135,
+  45136, 45137, 45138, 45139, 45140, 45141, 45142, 45143, 45144, 45145, 45146, 45147, 45148, 45149, 45150, 45151,
+  45152, 45153, 45154, 45155, 45156, 45157, 45158, 45159, 45160, 45161, 45162, 45163, 45164, 45165, 45166, 45167,
+  45168, 45169, 45170, 45171, 45172, 45173, 45174, 45175, 45176, 45177, 45178, 45179, 45180, 45181, 45182, 45183,
+  45184, 45185, 45186, 45187, 45188, 45189, 45190, 45191, 45192, 45193, 45194, 45195, 45196, 45197, 45198, 45199,
+  45200, 45201, 45202, 45203, 45204, 45205, 45206, 45207, 45208, 45209, 45210, 45211, 45212, 45213, 45214, 45215,
+  45216, 45217, 45218, 45219, 45220, 45221, 45222, 45223, 45224, 45225, 45226, 45227, 45228, 45229, 45230, 45231,
+  45232, 45233, 45234, 45235, 45236, 45237, 45238, 45239, 45240, 45241, 45242, 45243, 45244, 45245, 45246, 45247,
+  45248, 45249, 45250, 45251, 45252, 45253, 45254, 45255, 45256, 45257, 45258, 45259, 45260, 45261, 45262, 45263,
+  45264, 45265, 45266, 45267, 45268, 45269, 45270, 45271, 45272, 45273, 45274, 45275, 45276, 45277, 45278, 45279,
+  45280, 45281, 45282, 45283, 45284, 45285, 45286, 45287, 45288, 45289, 45290, 45291, 45292, 45293, 45294, 45295,
+  45296, 45297, 45298, 45299, 45300, 45301, 45302, 45303, 45304, 45305, 45306, 45307, 45308, 45309, 45310, 45311,
+  45312, 45313, 45314, 45315, 45316, 45317, 45318, 45319, 45320, 45321, 45322, 45323, 45324, 45325, 45326, 45327,
+  45328, 45329, 45330, 45331, 45332, 45333, 45334, 45335, 45336, 45337, 45338, 45339, 45340, 45341, 45342, 45343,
+  45344, 45345, 45346, 45347, 45348, 45349, 45350, 45351, 45352, 45353, 45354, 45355, 45356, 45357, 45358, 45359,
+  45360, 45361, 45362, 45363, 45364, 45365, 45366, 45367, 45368, 45369, 45370, 45371, 45372, 45373, 45374, 45375,
+  45376, 45377, 45378, 45379, 45380, 45381, 45382, 45383, 45384, 45385, 45386, 45387, 45388, 45389, 45390, 45391,
+  45392, 45393, 45394, 45395, 45396, 45397, 45398, 45399, 45400, 45401, 45402, 45403, 45404, 45405, 45406, 45407,
+  45408, 45409, 45410, 45411, 45412, 45413, 45414, 45415, 45416, 45417, 45418, 45419, 45420, 45421, 45422, 45423,
+  45424, 45425, 45426, 45427, 45428, 45429, 45430, 45431, 45432, 45433, 45434, 45435, 45436, 45437, 45438, 45439,
+  45440, 45441, 45442, 45443, 45444, 45445, 45446, 45447, 45448, 45449, 45450, 45451, 45452, 45453, 45454, 45455,
+  45456, 45457, 45458, 45459, 45460, 45461, 45462, 45463, 45464, 45465, 45466, 45467, 45468, 45469, 45470, 45471,
+  45472, 45473, 45474, 45475, 45476, 45477, 45478, 45479, 45480, 45481, 45482, 45483, 45484, 45485, 45486, 45487,
+  45488, 45489, 45490, 45491, 45492, 45493, 45494, 45495, 45496, 45497, 45498, 45499, 45500, 45501, 45502, 45503,
+  45504, 45505, 45506, 45507, 45508, 45509, 45510, 45511, 45512, 45513, 45514, 45515, 45516, 45517, 45518, 45519,
+  45520, 45521, 45522, 45523, 45524, 45525, 45526, 45527, 45528, 45529, 45530, 45531, 45532, 45533, 45534, 45535,
+  45536, 45537, 45538, 45539, 45540, 45541, 45542, 45543, 45544, 45545, 45546, 45547, 45548, 45549, 45550, 45551,
+  45552, 45553, 45554, 45555, 45556, 45557, 45558, 45559, 45560, 45561, 45562, 45563, 45564, 45565, 45566, 45567,
+  45568, 45569, 45570, 45571, 45572, 45573, 45574, 45575, 45576, 45577, 45578, 45579, 45580, 45581, 45582, 45583,
+  45584, 45585, 45586, 45587, 45588, 45589, 45590, 45591, 45592, 45593, 45594, 45595, 45596, 45597, 45598, 45599,
+  45600, 45601, 45602, 45603, 45604, 45605, 45606, 45607, 45608, 45609, 45610, 45611, 45612, 45613, 45614, 45615,
+  45616, 45617, 45618, 45619, 45620, 45621, 45622, 45623, 45624, 45625, 45626, 45627, 45628, 45629, 45630, 45631,
+  45632, 45633, 45634, 45635, 45636, 45637, 45638, 45639, 45640, 45641, 45642, 45643, 45644, 45645, 45646, 45647,
+  45648, 45649, 45650, 45651, 45652, 45653, 45654, 45655, 45656, 45657, 45658, 45659, 45660, 45661, 45662, 45663,
+  45664, 45665, 45666, 45667, 45668, 45669, 45670, 45671, 45672, 45673, 45674, 45675, 45676, 45677, 45678, 45679,
+  45680, 45681, 45682, 45683, 45684, 45685, 45686, 45687, 45688, 45689, 45690, 45691, 45692, 45693, 45694, 45695,
+  45696, 45697, 45698, 45699, 45700, 45701, 45702, 45703, 45704, 45705, 45706, 45707, 45708, 45709, 45710, 45711,
+  45712, 45713, 45714, 45715, 45716, 45717, 45718, 45719, 45720, 45721, 45722, 45723, 45724, 45725, 45726, 45727,
+  45728, 45729, 45730, 45731, 45732, 45733, 45734, 45735, 45736, 45737, 45738, 45739, 45740, 45741, 45742, 45743,
+  45744, 45745, 45746, 45747, 45748, 45749, 45750, 45751, 45752, 45753, 45754, 45755, 45756, 45757, 45758, 45759,
+  45760, 45761, 45762, 45763, 45764, 45765, 45766, 45767, 45768, 45769, 45770, 45771, 45772, 45773, 45774, 45775,
+  45776, 45777, 45778, 45779, 45780, 45781, 45782, 45783, 45784, 45785, 45786, 45787, 45788, 45789, 45790, 45791,
+  45792, 45793, 45794, 45795, 45796, 45797, 45798, 45799, 45800, 45801, 45802, 45803, 45804, 45805, 45806, 45807,
+  45808, 45809, 45810, 45811, 45812, 45813, 45814, 45815, 45816, 45817, 45818, 45819, 45820, 45821, 45822, 45823,
+  45824, 45825, 45826, 45827, 45828, 45829, 45830, 45831, 45832, 45833, 45834, 45835, 45836, 45837, 45838, 45839,
+  45840, 45841, 45842, 45843, 45844, 45845, 45846, 45847, 45848, 45849, 45850, 45851, 45852, 45853, 45854, 45855,
+  45856, 45857, 45858, 45859, 45860, 45861, 45862, 45863, 45864, 45865, 45866, 45867, 45868, 45869, 45870, 45871,
+  45872, 45873, 45874, 45875, 45876, 45877, 45878, 45879, 45880, 45881, 45882, 45883, 45884, 45885, 45886, 45887,
+  45888, 45889, 45890, 45891, 45892, 45893, 45894, 45895, 45896, 45897, 45898, 45899, 45900, 45901, 45902, 45903,
+  45904, 45905, 45906, 45907, 45908, 45909, 45910, 45911, 45912, 45913, 45914, 45915, 45916, 45917, 45918, 45919,
+  45920, 45921, 45922, 45923, 45924, 45925, 45926, 45927, 45928, 45929, 45930, 45931, 45932, 45933, 45934, 45935,
+  45936, 45937, 45938, 45939, 45940, 45941, 45942, 45943, 45944, 45945, 45946, 45947, 45948, 45949, 45950, 45951,
+  45952, 45953, 45954, 45955, 45956, 45957, 45958, 45959, 45960, 45961, 45962, 45963, 45964, 45965, 45966, 45967,
+  45968, 45969, 45970, 45971, 45972, 45973, 45974, 45975, 45976, 45977, 45978, 45979, 45980, 45981, 45982, 45983,
+  45984, 45985, 45986, 45987, 45988, 45989, 45990, 45991, 45992, 45993, 45994, 45995, 45996, 45997, 45998, 45999,
+  46000, 46001, 46002, 46003, 46004, 46005, 46006, 46007, 46008, 46009, 46010, 46011, 46012, 46013, 46014, 46015,
+  46016, 46017, 46018, 46019, 46020, 46021, 46022, 46023, 46024, 46025, 46026, 46027, 46028, 46029, 46030, 46031,
+  46032, 46033, 46034, 46035, 46036, 46037, 46038, 46039, 46040, 46041, 46042, 46043, 46044, 46045, 46046, 46047,
+  46048, 46049, 46050, 46051, 46052, 46053, 46054, 46055, 46056, 46057, 46058, 46059, 46060, 46061, 46062, 46063,
+  46064, 46065, 46066, 46067, 46068, 46069, 46070, 46071, 46072, 46073, 46074, 46075, 46076, 46077, 46078, 46079,
+  46080, 46081, 46082, 46083, 46084, 46085, 46086, 46087, 46088, 46089, 46090, 46091, 46092, 46093, 46094, 46095,
+  46096, 46097, 46098, 46099, 46100, 46101, 46102, 46103, 46104, 46105, 46106, 46107, 46108, 46109, 46110, 46111,
+  46112, 46113, 46114, 46115, 46116, 46117, 46118, 46119, 46120, 46121, 46122, 46123, 46124, 46125, 46126, 46127,
+  46128, 46129, 46130, 46131, 46132, 46133, 46134, 46135, 46136, 46137, 46138, 46139, 46140, 46141, 46142, 46143,
+  46144, 46145, 46146, 46147, 46148, 46149, 46150, 46151, 46152, 46153, 46154, 46155, 46156, 46157, 46158, 46159,
+  46160, 46161, 46162, 46163, 46164, 46165, 46166, 46167, 46168, 46169, 46170, 46171, 46172, 46173, 46174, 46175,
+  46176, 46177, 46178, 46179, 46180, 46181, 46182, 46183, 46184, 46185, 46186, 46187, 46188, 46189, 46190, 46191,
+  46192, 46193, 46194, 46195, 46196, 46197, 46198, 46199, 46200, 46201, 46202, 46203, 46204, 46205, 46206, 46207,
+  46208, 46209, 46210, 46211, 46212, 46213, 46214, 46215, 46216, 46217, 46218, 46219, 46220, 46221, 46222, 46223,
+  46224, 46225, 46226, 46227, 46228, 46229, 46230, 46231, 46232, 46233, 46234, 46235, 46236, 46237, 46238, 46239,
+  46240, 46241, 46242, 46243, 46244, 46245, 46246, 46247, 46248, 46249, 46250, 46251, 46252, 46253, 46254, 46255,
+  46256, 46257, 46258, 46259, 46260, 46261, 46262, 46263, 46264, 46265, 46266, 46267, 46268, 46269, 46270, 46271,
+  46272, 46273, 46274, 46275, 46276, 46277, 46278, 46279, 46280, 46281, 46282, 46283, 46284, 46285, 46286, 46287,
+  46288, 46289, 46290, 46291, 46292, 46293, 46294, 46295, 46296, 46297, 46298, 46299, 46300, 46301, 46302, 46303,
+  46304, 46305, 46306, 46307, 46308, 46309, 46310, 46311, 46312, 46313, 46314, 46315, 46316, 46317, 46318, 46319,
+  46320, 46321, 46322, 46323, 46324, 46325, 46326, 46327, 46328, 46329, 46330, 46331, 46332, 46333, 46334, 46335,
+  46336, 46337, 46338, 46339, 46340, 46341, 46342, 46343, 46344, 46345, 46346, 46347, 46348, 46349, 46350, 46351,
+  46352, 46353, 46354, 46355, 46356, 46357, 46358, 46359, 46360, 46361, 46362, 46363, 46364, 46365, 46366, 46367,
+  46368, 46369, 46370, 46371, 46372, 46373, 46374, 46375, 46376, 46377, 46378, 46379, 46380, 46381, 46382, 46383,
+  46384, 46385, 46386, 46387, 46388, 46389, 46390, 46391, 46392, 46393, 46394, 46395, 46396, 46397, 46398, 46399,
+  46400, 46401, 46402, 46403, 46404, 46405, 46406, 46407, 46408, 46409, 46410, 46411, 46412, 46413, 46414, 46415,
+  46416, 46417, 46418, 46419, 46420, 46421, 46422, 46423, 46424, 46425, 46426, 46427, 46428, 46429, 46430, 46431,
+  46432, 46433, 46434, 46435, 46436, 46437, 46438, 46439, 46440, 46441, 46442, 46443, 46444, 46445, 46446, 46447,
+  46448, 46449, 46450, 46451, 46452, 46453, 46454, 46455, 46456, 46457, 46458, 46459, 46460, 46461, 46462, 46463,
+  46464, 46465, 46466, 46467, 46468, 46469, 46470, 46471, 46472, 46473, 46474, 46475, 46476, 46477, 46478, 46479,
+  46480, 46481, 46482, 46483, 46484, 46485, 46486, 46487, 46488, 46489, 46490, 46491, 46492, 46493, 46494, 46495,
+  46496, 46497, 46498, 46499, 46500, 46501, 46502, 46503, 46504, 46505, 46506, 46507, 46508, 46509, 46510, 46511,
+  46512, 46513, 46514, 46515, 46516, 46517, 46518, 46519, 46520, 46521, 46522, 46523, 46524, 46525, 46526, 46527,
+  46528, 46529, 46530, 46531, 46532, 46533, 46534, 46535, 46536, 46537, 46538, 46539, 46540, 46541, 46542, 46543,
+  46544, 46545, 46546, 46547, 46548, 46549, 46550, 46551, 46552, 46553, 46554, 46555, 46556, 46557, 46558, 46559,
+  46560, 46561, 46562, 46563, 46564, 46565, 46566, 46567, 46568, 46569, 46570, 46571, 46572, 46573, 46574, 46575,
+  46576, 46577, 46578, 46579, 46580, 46581, 46582, 46583, 46584, 46585, 46586, 46587, 46588, 46589, 46590, 46591,
+  46592, 46593, 46594, 46595, 46596, 46597, 46598, 46599, 46600, 46601, 46602, 46603, 46604, 46605, 46606, 46607,
+  46608, 46609, 46610, 46611, 46612, 46613, 46614, 46615, 46616, 46617, 46618, 46619, 46620, 46621, 46622, 46623,
+  46624, 46625, 46626, 46627, 46628, 46629, 46630, 46631, 46632, 46633, 46634, 46635, 46636, 46637, 46638, 46639,
+  46640, 46641, 46642, 46643, 46644, 46645, 46646, 46647, 46648, 46649, 46650, 46651, 46652, 46653, 46654, 46655,
+  46656, 46657, 46658, 46659, 46660, 46661, 46662, 46663, 46664, 46665, 46666, 46667, 46668, 46669, 46670, 46671,
+  46672, 46673, 46674, 46675, 46676, 46677, 46678, 46679, 46680, 46681, 46682, 46683, 46684, 46685, 46686, 46687,
+  46688, 46689, 46690, 46691, 46692, 46693, 46694, 46695, 46696, 46697, 46698, 46699, 46700, 46701, 46702, 46703,
+  46704, 46705, 46706, 46707, 46708, 46709, 46710, 46711, 46712, 46713, 46714, 46715, 46716, 46717, 46718, 46719,
+  46720, 46721, 46722, 46723, 46724, 46725, 46726, 46727, 46728, 46729, 46730, 46731, 46732, 46733, 46734, 46735,
+  46736, 46737, 46738, 46739, 46740, 46741, 46742, 46743, 46744, 46745, 46746, 46747, 46748, 46749, 46750, 46751,
+  46752, 46753, 46754, 46755, 46756, 46757, 46758, 46759, 46760, 46761, 46762, 46763, 46764, 46765, 46766, 46767,
+  46768, 46769, 46770, 46771, 46772, 46773, 46774, 46775, 46776, 46777, 46778, 46779, 46780, 46781, 46782, 46783,
+  46784, 46785, 46786, 46787, 46788, 46789, 46790, 46791, 46792, 46793, 46794, 46795, 46796, 46797, 46798, 46799,
+  46800, 46801, 46802, 46803, 46804, 46805, 46806, 46807, 46808, 46809, 46810, 46811, 46812, 46813, 46814, 46815,
+  46816, 46817, 46818, 46819, 46820, 46821, 46822, 46823, 46824, 46825, 46826, 46827, 46828, 46829, 46830, 46831,
+  46832, 46833, 46834, 46835, 46836, 46837, 46838, 46839, 46840, 46841, 46842, 46843, 46844, 46845, 46846, 46847,
+  46848, 46849, 46850, 46851, 46852, 46853, 46854, 46855, 46856, 46857, 46858, 46859, 46860, 46861, 46862, 46863,
+  46864, 46865, 46866, 46867, 46868, 46869, 46870, 46871, 46872, 46873, 46874, 46875, 46876, 46877, 46878, 46879,
+  46880, 46881, 46882, 46883, 46884, 46885, 46886, 46887, 46888, 46889, 46890, 46891, 46892, 46893, 46894, 46895,
+  46896, 46897, 46898, 46899, 46900, 46901, 46902, 46903, 46904, 46905, 46906, 46907, 46908, 46909, 46910, 46911,
+  46912, 46913, 46914, 46915, 46916, 46917, 46918, 46919, 46920, 46921, 46922, 46923, 46924, 46925, 46926, 46927,
+  46928, 46929, 46930, 46931, 46932, 46933, 46934, 46935, 46936, 46937, 46938, 46939, 46940, 46941, 46942, 46943,
+  46944, 46945, 46946, 46947, 46948, 46949, 46950, 46951, 46952, 46953, 46954, 46955, 46956, 46957, 46958, 46959,
+  46960, 46961, 46962, 46963, 46964, 46965, 46966, 46967, 46968, 46969, 46970, 46971, 46972, 46973, 46974, 46975,
+  46976, 46977, 46978, 46979, 46980, 46981, 46982, 46983, 46984, 46985, 46986, 46987, 46988, 46989, 46990, 46991,
+  46992, 46993, 46994, 46995, 46996, 46997, 46998, 46999, 47000, 47001, 47002, 47003, 47004, 47005, 47006, 47007,
+  47008, 47009, 47010, 47011, 47012, 47013, 47014, 47015, 47016, 47017, 47018, 47019, 47020, 47021, 47022, 47023,
+  47024, 47025, 47026, 47027, 47028, 47029, 47030, 47031, 47032, 47033, 47034, 47035, 47036, 47037, 47038, 47039,
+  47040, 47041, 47042, 47043, 47044, 47045, 47046, 47047, 47048, 47049, 47050, 47051, 47052, 47053, 47054, 47055,
+  47056, 47057, 47058, 47059, 47060, 47061, 47062, 47063, 47064, 47065, 47066, 47067, 47068, 47069, 47070, 47071,
+  47072, 47073, 47074, 47075, 47076, 47077, 47078, 47079, 47080, 47081, 47082, 47083, 47084, 47085, 47086, 47087,
+  47088, 47089, 47090, 47091, 47092, 47093, 47094, 47095, 47096, 47097, 47098, 47099, 47100, 47101, 47102, 47103,
+  47104, 47105, 47106, 47107, 47108, 47109, 47110, 47111, 47112, 47113, 47114, 47115, 47116, 47117, 47118, 47119,
+  47120, 47121, 47122, 47123, 47124, 47125, 47126, 47127, 47128, 47129, 47130, 47131, 47132, 47133, 47134, 47135,
+  47136, 47137, 47138, 47139, 47140, 47141, 47142, 47143, 47144, 47145, 47146, 47147, 47148, 47149, 47150, 47151,
+  47152, 47153, 47154, 47155, 47156, 47157, 47158, 47159, 47160, 47161, 47162, 47163, 47164, 47165, 47166, 47167,
+  47168, 47169, 47170, 47171, 47172, 47173, 47174, 47175, 47176, 47177, 47178, 47179, 47180, 47181, 47182, 47183,
+  47184, 47185, 47186, 47187, 47188, 47189, 47190, 47191, 47192, 47193, 47194, 47195, 47196, 47197, 47198, 47199,
+  47200, 47201, 47202, 47203, 47204, 47205, 47206, 47207, 47208, 47209, 47210, 47211, 47212, 47213, 47214, 47215,
+  47216, 47217, 47218, 47219, 47220, 47221, 47222, 47223, 47224, 47225, 47226, 47227, 47228, 47229, 47230, 47231,
+  47232, 47233, 47234, 47235, 47236, 47237, 47238, 47239, 47240, 47241, 47242, 47243, 47244, 47245, 47246, 47247,
+  47248, 47249, 47250, 47251, 47252, 47253, 47254, 47255, 47256, 47257, 47258, 47259, 47260, 47261, 47262, 47263,
+  47264, 47265, 47266, 47267, 47268, 47269, 47270, 47271, 47272, 47273, 47274, 47275, 47276, 47277, 47278, 47279,
+  47280, 47281, 47282, 47283, 47284, 47285, 47286, 47287, 47288, 47289, 47290, 47291, 47292, 47293, 47294, 47295,
+  47296, 47297, 47298, 47299, 47300, 47301, 47302, 47303, 47304, 47305, 47306, 47307, 47308, 47309, 47310, 47311,
+  47312, 47313, 47314, 47315, 47316, 47317, 47318, 47319, 47320, 47321, 47322, 47323, 47324, 47325, 47326, 47327,
+  47328, 47329, 47330, 47331, 47332, 47333, 47334, 47335, 47336, 47337, 47338, 47339, 47340, 47341, 47342, 47343,
+  47344, 47345, 47346, 47347, 47348, 47349, 47350, 47351, 47352, 47353, 47354, 47355, 47356, 47357, 47358, 47359,
+  47360, 47361, 47362, 47363, 47364, 47365, 47366, 47367, 47368, 47369, 47370, 47371, 47372, 47373, 47374, 47375,
+  47376, 47377, 47378, 47379, 47380, 47381, 47382, 47383, 47384, 47385, 47386, 47387, 47388, 47389, 47390, 47391,
+  47392, 47393, 47394, 47395, 47396, 47397, 47398, 47399, 47400, 47401, 47402, 47403, 47404, 47405, 47406, 47407,
+  47408, 47409, 47410, 47411, 47412, 47413, 47414, 47415, 47416, 47417, 47418, 47419, 47420, 47421, 47422, 47423,
+  47424, 47425, 47426, 47427, 47428, 47429, 47430, 47431, 47432, 47433, 47434, 47435, 47436, 47437, 47438, 47439,
+  47440, 47441, 47442, 47443, 47444, 47445, 47446, 47447, 47448, 47449, 47450, 47451, 47452, 47453, 47454, 47455,
+  47456, 47457, 47458, 47459, 47460, 47461, 47462, 47463, 47464, 47465, 47466, 47467, 47468, 47469, 47470, 47471,
+  47472, 47473, 47474, 47475, 47476, 47477, 47478, 47479, 47480, 47481, 47482, 47483, 47484, 47485, 47486, 47487,
+  47488, 47489, 47490, 47491, 47492, 47493, 47494, 47495, 47496, 47497, 47498, 47499, 47500, 47501, 47502, 47503,
+  47504, 47505, 47506, 47507, 47508, 47509, 47510, 47511, 47512, 47513, 47514, 47515, 47516, 47517, 47518, 47519,
+  47520, 47521, 47522, 47523, 47524, 47525, 47526, 47527, 47528, 47529, 47530, 47531, 47532, 47533, 47534, 47535,
+  47536, 47537, 47538, 47539, 47540, 47541, 47542, 47543, 47544, 47545, 47546, 47547, 47548, 47549, 47550, 47551,
+  47552, 47553, 47554, 47555, 47556, 47557, 47558, 47559, 47560, 47561, 47562, 47563, 47564, 47565, 47566, 47567,
+  47568, 47569, 47570, 47571, 47572, 47573, 47574, 47575, 47576, 47577, 47578, 47579, 47580, 47581, 47582, 47583,
+  47584, 47585, 47586, 47587, 47588, 47589, 47590, 47591, 47592, 47593, 47594, 47595, 47596, 47597, 47598, 47599,
+  47600, 47601, 47602, 47603, 47604, 47605, 47606, 47607, 47608, 47609, 47610, 47611, 47612, 47613, 47614, 47615,
+  47616, 47617, 47618, 47619, 47620, 47621, 47622, 47623, 47624, 47625, 47626, 47627, 47628, 47629, 47630, 47631,
+  47632, 47633, 47634, 47635, 47636, 47637, 47638, 47639, 47640, 47641, 47642, 47643, 47644, 47645, 47646, 47647,
+  47648, 47649, 47650, 47651, 47652, 47653, 47654, 47655, 47656, 47657, 47658, 47659, 47660, 47661, 47662, 47663,
+  47664, 47665, 47666, 47667, 47668, 47669, 47670, 47671, 47672, 47673, 47674, 47675, 47676, 47677, 47678, 47679,
+  47680, 47681, 47682, 47683, 47684, 47685, 47686, 47687, 47688, 47689, 47690, 47691, 47692, 47693, 47694, 47695,
+  47696, 47697, 47698, 47699, 47700, 47701, 47702, 47703, 47704, 47705, 47706, 47707, 47708, 47709, 47710, 47711,
+  47712, 47713, 47714, 47715, 47716, 47717, 47718, 47719, 47720, 47721, 47722, 47723, 47724, 47725, 47726, 47727,
+  47728, 47729, 47730, 47731, 47732, 47733, 47734, 47735, 47736, 47737, 47738, 47739, 47740, 47741, 47742, 47743,
+  47744, 47745, 47746, 47747, 47748, 47749, 47750, 47751, 47752, 47753, 47754, 47755, 47756, 47757, 47758, 47759,
+  47760, 47761, 47762, 47763, 47764, 47765, 47766, 47767, 47768, 47769, 47770, 47771, 47772, 47773, 47774, 47775,
+  47776, 47777, 47778, 47779, 47780, 47781, 47782, 47783, 47784, 47785, 47786, 47787, 47788, 47789, 47790, 47791,
+  47792, 47793, 47794, 47795, 47796, 47797, 47798, 47799, 47800, 47801, 47802, 47803, 47804, 47805, 47806, 47807,
+  47808, 47809, 47810, 47811, 47812, 47813, 47814, 47815, 47816, 47817, 47818, 47819, 47820, 47821, 47822, 47823,
+  47824, 47825, 47826, 47827, 47828, 47829, 47830, 47831, 47832, 47833, 47834, 47835, 47836, 47837, 47838, 47839,
+  47840, 47841, 47842, 47843, 47844, 47845, 47846, 47847, 47848, 47849, 47850, 47851, 47852, 47853, 47854, 47855,
+  47856, 47857, 47858, 47859, 47860, 47861, 47862, 47863, 47864, 47865, 47866, 47867, 47868, 47869, 47870, 47871,
+  47872, 47873, 47874, 47875, 47876, 47877, 47878, 47879, 47880, 47881, 47882, 47883, 47884, 47885, 47886, 47887,
+  47888, 47889, 47890, 47891, 47892, 47893, 47894, 47895, 47896, 47897, 47898, 47899, 47900, 47901, 47902, 47903,
+  47904, 47905, 47906, 47907, 47908, 47909, 47910, 47911, 47912, 47913, 47914, 47915, 47916, 47917, 47918, 47919,
+  47920, 47921, 47922, 47923, 47924, 47925, 47926, 47927, 47928, 47929, 47930, 47931, 47932, 47933, 47934, 47935,
+  47936, 47937, 47938, 47939, 47940, 47941, 47942, 47943, 47944, 47945, 47946, 47947, 47948, 47949, 47950, 47951,
+  47952, 47953, 47954, 47955, 47956, 47957, 47958, 47959, 47960, 47961, 47962, 47963, 47964, 47965, 47966, 47967,
+  47968, 47969, 47970, 47971, 47972, 47973, 47974, 47975, 47976, 47977, 47978, 47979, 47980, 47981, 47982, 47983,
+  47984, 47985, 47986, 47987, 47988, 47989, 47990, 47991, 47992, 47993, 47994, 47995, 47996, 47997, 47998, 47999,
+  48000, 48001, 48002, 48003, 48004, 48005, 48006, 48007, 48008, 48009, 48010, 48011, 48012, 48013, 48014, 48015,
+  48016, 48017, 48018, 48019, 48020, 48021, 48022, 48023, 48024, 48025, 48026, 48027, 48028, 48029, 48030, 48031,
+  48032, 48033, 48034, 48035, 48036, 48037, 48038, 48039, 48040, 48041, 48042, 48043, 48044, 48045, 48046, 48047,
+  48048, 48049, 48050, 48051, 48052, 48053, 48054, 48055, 48056, 48057, 48058, 48059, 48060, 48061, 48062, 48063,
+  48064, 48065, 48066, 48067, 48068, 48069, 48070, 48071, 48072, 48073, 48074, 48075, 48076, 48077, 48078, 48079,
+  48080, 48081, 48082, 48083, 48084, 48085, 48086, 48087, 48088, 48089, 48090, 48091, 48092, 48093, 48094, 48095,
+  48096, 48097, 48098, 48099, 48100, 48101, 48102, 48103, 48104, 48105, 48106, 48107, 48108, 48109, 48110, 48111,
+  48112, 48113, 48114, 48115, 48116, 48117, 48118, 48119, 48120, 48121, 48122, 48123, 48124, 48125, 48126, 48127,
+  48128, 48129, 48130, 48131, 48132, 48133, 48134, 48135, 48136, 48137, 48138, 48139, 48140, 48141, 48142, 48143,
+  48144, 48145, 48146, 48147, 48148, 48149, 48150, 48151, 48152, 48153, 48154, 48155, 48156, 48157, 48158, 48159,
+  48160, 48161, 48162, 48163, 48164, 48165, 48166, 48167, 48168, 48169, 48170, 48171, 48172, 48173, 48174, 48175,
+  48176, 48177, 48178, 48179, 48180, 48181, 48182, 48183, 48184, 48185, 48186, 48187, 48188, 48189, 48190, 48191,
+  48192, 48193, 48194, 48195, 48196, 48197, 48198, 48199, 48200, 48201, 48202, 48203, 48204, 48205, 48206, 48207,
+  48208, 48209, 48210, 48211, 48212, 48213, 48214, 48215, 48216, 48217, 48218, 48219, 48220, 48221, 48222, 48223,
+  48224, 48225, 48226, 48227, 48228, 48229, 48230, 48231, 48232, 48233, 48234, 48235, 48236, 48237, 48238, 48239,
+  48240, 48241, 48242, 48243, 48244, 48245, 48246, 48247, 48248, 48249, 48250, 48251, 48252, 48253, 48254, 48255,
+  48256, 48257, 48258, 48259, 48260, 48261, 48262, 48263, 48264, 48265, 48266, 48267, 48268, 48269, 48270, 48271,
+  48272, 48273, 48274, 48275, 48276, 48277, 48278, 48279, 48280, 48281, 48282, 48283, 48284, 48285, 48286, 48287,
+  48288, 48289, 48290, 48291, 48292, 48293, 48294, 48295, 48296, 48297, 48298, 48299, 48300, 48301, 48302, 48303,
+  48304, 48305, 48306, 48307, 48308, 48309, 48310, 48311, 48312, 48313, 48314, 48315, 48316, 48317, 48318, 48319,
+  48320, 48321, 48322, 48323, 48324, 48325, 48326, 48327, 48328, 48329, 48330, 48331, 48332, 48333, 48334, 48335,
+  48336, 48337, 48338, 48339, 48340, 48341, 48342, 48343, 48344, 48345, 48346, 48347, 48348, 48349, 48350, 48351,
+  48352, 48353, 48354, 48355, 48356, 48357, 48358, 48359, 48360, 48361, 48362, 48363, 48364, 48365, 48366, 48367,
+  48368, 48369, 48370, 48371, 48372, 48373, 48374, 48375, 48376, 48377, 48378, 48379, 48380, 48381, 48382, 48383,
+  48384, 48385, 48386, 48387, 48388, 48389, 48390, 48391, 48392, 48393, 48394, 48395, 48396, 48397, 48398, 48399,
+  48400, 48401, 48402, 48403, 48404, 48405, 48406, 48407, 48408, 48409, 48410, 48411, 48412, 48413, 48414, 48415,
+  48416, 48417, 48418, 48419, 48420, 48421, 48422, 48423, 48424, 48425, 48426, 48427, 48428, 48429, 48430, 48431,
+  48432, 48433, 48434, 48435, 48436, 48437, 48438, 48439, 48440, 48441, 48442, 48443, 48444, 48445, 48446, 48447,
+  48448, 48449, 48450, 48451, 48452, 48453, 48454, 48455, 48456, 48457, 48458, 48459, 48460, 48461, 48462, 48463,
+  48464, 48465, 48466, 48467, 48468, 48469, 48470, 48471, 48472, 48473, 48474, 48475, 48476, 48477, 48478, 48479,
+  48480, 48481, 48482, 48483, 48484, 48485, 48486, 48487, 48488, 48489, 48490, 48491, 48492, 48493, 48494, 48495,
+  48496, 48497, 48498, 48499, 48500, 48501, 48502, 48503, 48504, 48505, 48506, 48507, 48508, 48509, 48510, 48511,
+  48512, 48513, 48514, 48515, 48516, 48517, 48518, 48519, 48520, 48521, 48522, 48523, 48524, 48525, 48526, 48527,
+  48528, 48529, 48530, 48531, 48532, 48533, 48534, 48535, 48536, 48537, 48538, 48539, 48540, 48541, 48542, 48543,
+  48544, 48545, 48546, 48547, 48548, 48549, 48550, 48551, 48552, 48553, 48554, 48555, 48556, 48557, 48558, 48559,
+  48560, 48561, 48562, 48563, 48564, 48565, 48566, 48567, 48568, 48569, 48570, 48571, 48572, 48573, 48574, 48575,
+  48576, 48577, 48578, 48579, 48580, 48581, 48582, 48583, 48584, 48585, 48586, 48587, 48588, 48589, 48590, 48591,
+  48592, 48593, 48594, 48595, 48596, 48597, 48598, 48599, 48600, 48601, 48602, 48603, 48604, 48605, 48606, 48607,
+  48608, 48609, 48610, 48611, 48612, 48613, 48614, 48615, 48616, 48617, 48618, 48619, 48620, 48621, 48622, 48623,
+  48624, 48625, 48626, 48627, 48628, 48629, 48630, 48631, 48632, 48633, 48634, 48635, 48636, 48637, 48638, 48639,
+  48640, 48641, 48642, 48643, 48644, 48645, 48646, 48647, 48648, 48649, 48650, 48651, 48652, 48653, 48654, 48655,
+  48656, 48657, 48658, 48659, 48660, 48661, 48662, 48663, 48664, 48665, 48666, 48667, 48668, 48669, 48670, 48671,
+  48672, 48673, 48674, 48675, 48676, 48677, 48678, 48679, 48680, 48681, 48682, 48683, 48684, 48685, 48686, 48687,
+  48688, 48689, 48690, 48691, 48692, 48693, 48694, 48695, 48696, 48697, 48698, 48699, 48700, 48701, 48702, 48703,
+  48704, 48705, 48706, 48707, 48708, 48709, 48710, 48711, 48712, 48713, 48714, 48715, 48716, 48717, 48718, 48719,
+  48720, 48721, 48722, 48723, 48724, 48725, 48726, 48727, 48728, 48729, 48730, 48731, 48732, 48733, 48734, 48735,
+  48736, 48737, 48738, 48739, 48740, 48741, 48742, 48743, 48744, 48745, 48746, 48747, 48748, 48749, 48750, 48751,
+  48752, 48753, 48754, 48755, 48756, 48757, 48758, 48759, 48760, 48761, 48762, 48763, 48764, 48765, 48766, 48767,
+  48768, 48769, 48770, 48771, 48772, 48773, 48774, 48775, 48776, 48777, 48778, 48779, 48780, 48781, 48782, 48783,
+  48784, 48785, 48786, 48787, 48788, 48789, 48790, 48791, 48792, 48793, 48794, 48795, 48796, 48797, 48798, 48799,
+  48800, 48801, 48802, 48803, 48804, 48805, 48806, 48807, 48808, 48809, 48810, 48811, 48812, 48813, 48814, 48815,
+  48816, 48817, 48818, 48819, 48820, 48821, 48822, 48823, 48824, 48825, 48826, 48827, 48828, 48829, 48830, 48831,
+  48832, 48833, 48834, 48835, 48836, 48837, 48838, 48839, 48840, 48841, 48842, 48843, 48844, 48845, 48846, 48847,
+  48848, 48849, 48850, 48851, 48852, 48853, 48854, 48855, 48856, 48857, 48858, 48859, 48860, 48861, 48862, 48863,
+  48864, 48865, 48866, 48867, 48868, 48869, 48870, 48871, 48872, 48873, 48874, 48875, 48876, 48877, 48878, 48879,
+  48880, 48881, 48882, 48883, 48884, 48885, 48886, 48887, 48888, 48889, 48890, 48891, 48892, 48893, 48894, 48895,
+  48896, 48897, 48898, 48899, 48900, 48901, 48902, 48903, 48904, 48905, 48906, 48907, 48908, 48909, 48910, 48911,
+  48912, 48913, 48914, 48915, 48916, 48917, 48918, 48919, 48920, 48921, 48922, 48923, 48924, 48925, 48926, 48927,
+  48928, 48929, 48930, 48931, 48932, 48933, 48934, 48935, 48936, 48937, 48938, 48939, 48940, 48941, 48942, 48943,
+  48944, 48945, 48946, 48947, 48948, 48949, 48950, 48951, 48952, 48953, 48954, 48955, 48956, 48957, 48958, 48959,
+  48960, 48961, 48962, 48963, 48964, 48965, 48966, 48967, 48968, 48969, 48970, 48971, 48972, 48973, 48974, 48975,
+  48976, 48977, 48978, 48979, 48980, 48981, 48982, 48983, 48984, 48985, 48986, 48987, 48988, 48989, 48990, 48991,
+  48992, 48993, 48994, 48995, 48996, 48997, 48998, 48999, 49000, 49001, 49002, 49003, 49004, 49005, 49006, 49007,
+  49008, 49009, 49010, 49011, 49012, 49013, 49014, 49015, 49016, 49017, 49018, 49019, 49020, 49021, 49022, 49023,
+  49024, 49025, 49026, 49027, 49028, 49029, 49030, 49031, 49032, 49033, 49034, 49035, 49036, 49037, 49038, 49039,
+  49040, 49041, 49042, 49043, 49044, 49045, 49046, 49047, 49048, 49049, 49050, 49051, 49052, 49053, 49054, 49055,
+  49056, 49057, 49058, 49059, 49060, 49061, 49062, 49063, 49064, 49065, 49066, 49067, 49068, 49069, 49070, 49071,
+  49072, 49073, 49074, 49075, 49076, 49077, 49078, 49079, 49080, 49081, 49082, 49083, 49084, 49085, 49086, 49087,
+  49088, 49089, 49090, 49091, 49092, 49093, 49094, 49095, 49096, 49097, 49098, 49099, 49100, 49101, 49102, 49103,
+  49104, 49105, 49106, 49107, 49108, 49109, 49110, 49111, 49112, 49113, 49114, 49115, 49116, 49117, 49118, 49119,
+  49120, 49121, 49122, 49123, 49124, 49125, 49126, 49127, 49128, 49129, 49130, 49131, 49132, 49133, 49134, 49135,
+  49136, 49137, 49138, 49139, 49140, 49141, 49142, 49143, 49144, 49145, 49146, 49147, 49148, 49149, 49150, 49151,
+  49152, 49153, 49154, 49155, 49156, 49157, 49158, 49159, 49160, 49161, 49162, 49163, 49164, 49165, 49166, 49167,
+  49168, 49169, 49170, 49171, 49172, 49173, 49174, 49175, 49176, 49177, 49178, 49179, 49180, 49181, 49182, 49183,
+  49184, 49185, 49186, 49187, 49188, 49189, 49190, 49191, 49192, 49193, 49194, 49195, 49196, 49197, 49198, 49199,
+  49200, 49201, 49202, 49203, 49204, 49205, 49206, 49207, 49208, 49209, 49210, 49211, 49212, 49213, 49214, 49215,
+  49216, 49217, 49218, 49219, 49220, 49221, 49222, 49223, 49224, 49225, 49226, 49227, 49228, 49229, 49230, 49231,
+  49232, 49233, 49234, 49235, 49236, 49237, 49238, 49239, 49240, 49241, 49242, 49243, 49244, 49245, 49246, 49247,
+  49248, 49249, 49250, 49251, 49252, 49253, 49254, 49255, 49256, 49257, 49258, 49259, 49260, 49261, 49262, 49263,
+  49264, 49265, 49266, 49267, 49268, 49269, 49270, 49271, 49272, 49273, 49274, 49275, 49276, 49277, 49278, 49279,
+  49280, 49281, 49282, 49283, 49284, 49285, 49286, 49287, 49288, 49289, 49290, 49291, 49292, 49293, 49294, 49295,
+  49296, 49297, 49298, 49299, 49300, 49301, 49302, 49303, 49304, 49305, 49306, 49307, 49308, 49309, 49310, 49311,
+  49312, 49313, 49314, 49315, 49316, 49317, 49318, 49319, 49320, 49321, 49322, 49323, 49324, 49325, 49326, 49327,
+  49328, 49329, 49330, 49331, 49332, 49333, 49334, 49335, 49336, 49337, 49338, 49339, 49340, 49341, 49342, 49343,
+  49344, 49345, 49346, 49347, 49348, 49349, 49350, 49351, 49352, 49353, 49354, 49355, 49356, 49357, 49358, 49359,
+  49360, 49361, 49362, 49363, 49364, 49365, 49366, 49367, 49368, 49369, 49370, 49371, 49372, 49373, 49374, 49375,
+  49376, 49377, 49378, 49379, 49380, 49381, 49382, 49383, 49384, 49385, 49386, 49387, 49388, 49389, 49390, 49391,
+  49392, 49393, 49394, 49395, 49396, 49397, 49398, 49399, 49400, 49401, 49402, 49403, 49404, 49405, 49406, 49407,
+  49408, 49409, 49410, 49411, 49412, 49413, 49414, 49415, 49416, 49417, 49418, 49419, 49420, 49421, 49422, 49423,
+  49424, 49425, 49426, 49427, 49428, 49429, 49430, 49431, 49432, 49433, 49434, 49435, 49436, 49437, 49438, 49439,
+  49440, 49441, 49442, 49443, 49444, 49445, 49446, 49447, 49448, 49449, 49450, 49451, 49452, 49453, 49454, 49455,
+  49456, 49457, 49458, 49459, 49460, 49461, 49462, 49463, 49464, 49465, 49466, 49467, 49468, 49469, 49470, 49471,
+  49472, 49473, 49474, 49475, 49476, 49477, 49478, 49479, 49480, 49481, 49482, 49483, 49484, 49485, 49486, 49487,
+  49488, 49489, 49490, 49491, 49492, 49493, 49494, 49495, 49496, 49497, 49498, 49499, 49500, 49501, 49502, 49503,
+  49504, 49505, 49506, 49507, 49508, 49509, 49510, 49511, 49512, 49513, 49514, 49515, 49516, 49517, 49518, 49519,
+  49520, 49521, 49522, 49523, 49524, 49525, 49526, 49527, 49528, 49529, 49530, 49531, 49532, 49533, 49534, 49535,
+  49536, 49537, 49538, 49539, 49540, 49541, 49542, 49543, 49544, 49545, 49546, 49547, 49548, 49549, 49550, 49551,
+  49552, 49553, 49554, 49555, 49556, 49557, 49558, 49559, 49560, 49561, 49562, 49563, 49564, 49565, 49566, 49567,
+  49568, 49569, 49570, 49571, 49572, 49573, 49574, 49575, 49576, 49577, 49578, 49579, 49580, 49581, 49582, 49583,
+  49584, 49585, 49586, 49587, 49588, 49589, 49590, 49591, 49592, 49593, 49594, 49595, 49596, 49597, 49598, 49599,
+  49600, 49601, 49602, 49603, 49604, 49605, 49606, 49607, 49608, 49609, 49610, 49611, 49612, 49613, 49614, 49615,
+  49616, 49617, 49618, 49619, 49620, 49621, 49622, 49623, 49624, 49625, 49626, 49627, 49628, 49629, 49630, 49631,
+  49632, 49633, 49634, 49635, 49636, 49637, 49638, 49639, 49640, 49641, 49642, 49643, 49644, 49645, 49646, 49647,
+  49648, 49649, 49650, 49651, 49652, 49653, 49654, 49655, 49656, 49657, 49658, 49659, 49660, 49661, 49662, 49663,
+  49664, 49665, 49666, 49667, 49668, 49669, 49670, 49671, 49672, 49673, 49674, 49675, 49676, 49677, 49678, 49679,
+  49680, 49681, 49682, 49683, 49684, 49685, 49686, 49687, 49688, 49689, 49690, 49691, 49692, 49693, 49694, 49695,
+  49696, 49697, 49698, 49699, 49700, 49701, 49702, 49703, 49704, 49705, 49706, 49707, 49708, 49709, 49710, 49711,
+  49712, 49713, 49714, 49715, 49716, 49717, 49718, 49719, 49720, 49721, 49722, 49723, 49724, 49725, 49726, 49727,
+  49728, 49729, 49730, 49731, 49732, 49733, 49734, 49735, 49736, 49737, 49738, 49739, 49740, 49741, 49742, 49743,
+  49744, 49745, 49746, 49747, 49748, 49749, 49750, 49751, 49752, 49753, 49754, 49755, 49756, 49757, 49758, 49759,
+  49760, 49761, 49762, 49763, 49764, 49765, 49766, 49767, 49768, 49769, 49770, 49771, 49772, 49773, 49774, 49775,
+  49776, 49777, 49778, 49779, 49780, 49781, 49782, 49783, 49784, 49785, 49786, 49787, 49788, 49789, 49790, 49791,
+  49792, 49793, 49794, 49795, 49796, 49797, 49798, 49799, 49800, 49801, 49802, 49803, 49804, 49805, 49806, 49807,
+  49808, 49809, 49810, 49811, 49812, 49813, 49814, 49815, 49816, 49817, 49818, 49819, 49820, 49821, 49822, 49823,
+  49824, 49825, 49826, 49827, 49828, 49829, 49830, 49831, 49832, 49833, 49834, 49835, 49836, 49837, 49838, 49839,
+  49840, 49841, 49842, 49843, 49844, 49845, 49846, 49847, 49848, 49849, 49850, 49851, 49852, 49853, 49854, 49855,
+  49856, 49857, 49858, 49859, 49860, 49861, 49862, 49863, 49864, 49865, 49866, 49867, 49868, 49869, 49870, 49871,
+  49872, 49873, 49874, 49875, 49876, 49877, 49878, 49879, 49880, 49881, 49882, 49883, 49884, 49885, 49886, 49887,
+  49888, 49889, 49890, 49891, 49892, 49893, 49894, 49895, 49896, 49897, 49898, 49899, 49900, 49901, 49902, 49903,
+  49904, 49905, 49906, 49907, 49908, 49909, 49910, 49911, 49912, 49913, 49914, 49915, 49916, 49917, 49918, 49919,
+  49920, 49921, 49922, 49923, 49924, 49925, 49926, 49927, 49928, 49929, 49930, 49931, 49932, 49933, 49934, 49935,
+  49936, 49937, 49938, 49939, 49940, 49941, 49942, 49943, 49944, 49945, 49946, 49947, 49948, 49949, 49950, 49951,
+  49952, 49953, 49954, 49955, 49956, 49957, 49958, 49959, 49960, 49961, 49962, 49963, 49964, 49965, 49966, 49967,
+  49968, 49969, 49970, 49971, 49972, 49973, 49974, 49975, 49976, 49977, 49978, 49979, 49980, 49981, 49982, 49983,
+  49984, 49985, 49986, 49987, 49988, 49989, 49990, 49991, 49992, 49993, 49994, 49995, 49996, 49997, 49998, 49999,
+  50000, 50001, 50002, 50003, 50004, 50005, 50006, 50007, 50008, 50009, 50010, 50011, 50012, 50013, 50014, 50015,
+  50016, 50017, 50018, 50019, 50020, 50021, 50022, 50023, 50024, 50025, 50026, 50027, 50028, 50029, 50030, 50031,
+  50032, 50033, 50034, 50035, 50036, 50037, 50038, 50039, 50040, 50041, 50042, 50043, 50044, 50045, 50046, 50047,
+  50048, 50049, 50050, 50051, 50052, 50053, 50054, 50055, 50056, 50057, 50058, 50059, 50060, 50061, 50062, 50063,
+  50064, 50065, 50066, 50067, 50068, 50069, 50070, 50071, 50072, 50073, 50074, 50075, 50076, 50077, 50078, 50079,
+  50080, 50081, 50082, 50083, 50084, 50085, 50086, 50087, 50088, 50089, 50090, 50091, 50092, 50093, 50094, 50095,
+  50096, 50097, 50098, 50099, 50100, 50101, 50102, 50103, 50104, 50105, 50106, 50107, 50108, 50109, 50110, 50111,
+  50112, 50113, 50114, 50115, 50116, 50117, 50118, 50119, 50120, 50121, 50122, 50123, 50124, 50125, 50126, 50127,
+  50128, 50129, 50130, 50131, 50132, 50133, 50134, 50135, 50136, 50137, 50138, 50139, 50140, 50141, 50142, 50143,
+  50144, 50145, 50146, 50147, 50148, 50149, 50150, 50151, 50152, 50153, 50154, 50155, 50156, 50157, 50158, 50159,
+  50160, 50161, 50162, 50163, 50164, 50165, 50166, 50167, 50168, 50169, 50170, 50171, 50172, 50173, 50174, 50175,
+  50176, 50177, 50178, 50179, 50180, 50181, 50182, 50183, 50184, 50185, 50186, 50187, 50188, 50189, 50190, 50191,
+  50192, 50193, 50194, 50195, 50196, 50197, 50198, 50199, 50200, 50201, 50202, 50203, 50204, 50205, 50206, 50207,
+  50208, 50209, 50210, 50211, 50212, 50213, 50214, 50215, 50216, 50217, 50218, 50219, 50220, 50221, 50222, 50223,
+  50224, 50225, 50226, 50227, 50228, 50229, 50230, 50231, 50232, 50233, 50234, 50235, 50236, 50237, 50238, 50239,
+  50240, 50241, 50242, 50243, 50244, 50245, 50246, 50247, 50248, 50249, 50250, 50251, 50252, 50253, 50254, 50255,
+  50256, 50257, 50258, 50259, 50260, 50261, 50262, 50263, 50264, 50265, 50266, 50267, 50268, 50269, 50270, 50271,
+  50272, 50273, 50274, 50275, 50276, 50277, 50278, 50279, 50280, 50281, 50282, 50283, 50284, 50285, 50286, 50287,
+  50288, 50289, 50290, 50291, 50292, 50293, 50294, 50295, 50296, 50297, 50298, 50299, 50300, 50301, 50302, 50303,
+  50304, 50305, 50306, 50307, 50308, 50309, 50310, 50311, 50312, 50313, 50314, 50315, 50316, 50317, 50318, 50319,
+  50320, 50321, 50322, 50323, 50324, 50325, 50326, 50327, 50328, 50329, 50330, 50331, 50332, 50333, 50334, 50335,
+  50336, 50337, 50338, 50339, 50340, 50341, 50342, 50343, 50344, 50345, 50346, 50347, 50348, 50349, 50350, 50351,
+  50352, 50353, 50354, 50355, 50356, 50357, 50358, 50359, 50360, 50361, 50362, 50363, 50364, 50365, 50366, 50367,
+  50368, 50369, 50370, 50371, 50372, 50373, 50374, 50375, 50376, 50377, 50378, 50379, 50380, 50381, 50382, 50383,
+  50384, 50385, 50386, 50387, 50388, 50389, 50390, 50391, 50392, 50393, 50394, 50395, 50396, 50397, 50398, 50399,
+  50400, 50401, 50402, 50403, 50404, 50405, 50406, 50407, 50408, 50409, 50410, 50411, 50412, 50413, 50414, 50415,
+  50416, 50417, 50418, 50419, 50420, 50421, 50422, 50423, 50424, 50425, 50426, 50427, 50428, 50429, 50430, 50431,
+  50432, 50433, 50434, 50435, 50436, 50437, 50438, 50439, 50440, 50441, 50442, 50443, 50444, 50445, 50446, 50447,
+  50448, 50449, 50450, 50451, 50452, 50453, 50454, 50455, 50456, 50457, 50458, 50459, 50460, 50461, 50462, 50463,
+  50464, 50465, 50466, 50467, 50468, 50469, 50470, 50471, 50472, 50473, 50474, 50475, 50476, 50477, 50478, 50479,
+  50480, 50481, 50482, 50483, 50484, 50485, 50486, 50487, 50488, 50489, 50490, 50491, 50492, 50493, 50494, 50495,
+  50496, 50497, 50498, 50499, 50500, 50501, 50502, 50503, 50504, 50505, 50506, 50507, 50508, 50509, 50510, 50511,
+  50512, 50513, 50514, 50515, 50516, 50517, 50518, 50519, 50520, 50521, 50522, 50523, 50524, 50525, 50526, 50527,
+  50528, 50529, 50530, 50531, 50532, 50533, 50534, 50535, 50536, 50537, 50538, 50539, 50540, 50541, 50542, 50543,
+  50544, 50545, 50546, 50547, 50548, 50549, 50550, 50551, 50552, 50553, 50554, 50555, 50556, 50557, 50558, 50559,
+  50560, 50561, 50562, 50563, 50564, 50565, 50566, 50567, 50568, 50569, 50570, 50571, 50572, 50573, 50574, 50575,
+  50576, 50577, 50578, 50579, 50580, 50581, 50582, 50583, 50584, 50585, 50586, 50587, 50588, 50589, 50590, 50591,
+  50592, 50593, 50594, 50595, 50596, 50597, 50598, 50599, 50600, 50601, 50602, 50603, 50604, 50605, 50606, 50607,
+  50608, 50609, 50610, 50611, 50612, 50613, 50614, 50615, 50616, 50617, 50618, 50619, 50620, 50621, 50622, 50623,
+  50624, 50625, 50626, 50627, 50628, 50629, 50630, 50631, 50632, 50633, 50634, 50635, 50636, 50637, 50638, 50639,
+  50640, 50641, 50642, 50643, 50644, 50645, 50646, 50647, 50648, 50649, 50650, 50651, 50652, 50653, 50654, 50655,
+  50656, 50657, 50658, 50659, 50660, 50661, 50662, 50663, 50664, 50665, 50666, 50667, 50668, 50669, 50670, 50671,
+  50672, 50673, 50674, 50675, 50676, 50677, 50678, 50679, 50680, 50681, 50682, 50683, 50684, 50685, 50686, 50687,
+  50688, 50689, 50690, 50691, 50692, 50693, 50694, 50695, 50696, 50697, 50698, 50699, 50700, 50701, 50702, 50703,
+  50704, 50705, 50706, 50707, 50708, 50709, 50710, 50711, 50712, 50713, 50714, 50715, 50716, 50717, 50718, 50719,
+  50720, 50721, 50722, 50723, 50724, 50725, 50726, 50727, 50728, 50729, 50730, 50731, 50732, 50733, 50734, 50735,
+  50736, 50737, 50738, 50739, 50740, 50741, 50742, 50743, 50744, 50745, 50746, 50747, 50748, 50749, 50750, 50751,
+  50752, 50753, 50754, 50755, 50756, 50757, 50758, 50759, 50760, 50761, 50762, 50763, 50764, 50765, 50766, 50767,
+  50768, 50769, 50770, 50771, 50772, 50773, 50774, 50775, 50776, 50777, 50778, 50779, 50780, 50781, 50782, 50783,
+  50784, 50785, 50786, 50787, 50788, 50789, 50790, 50791, 50792, 50793, 50794, 50795, 50796, 50797, 50798, 50799,
+  50800, 50801, 50802, 50803, 50804, 50805, 50806, 50807, 50808, 50809, 50810, 50811, 50812, 50813, 50814, 50815,
+  50816, 50817, 50818, 50819, 50820, 50821, 50822, 50823, 50824, 50825, 50826, 50827, 50828, 50829, 50830, 50831,
+  50832, 50833, 50834, 50835, 50836, 50837, 50838, 50839, 50840, 50841, 50842, 50843, 50844, 50845, 50846, 50847,
+  50848, 50849, 50850, 50851, 50852, 50853, 50854, 50855, 50856, 50857, 50858, 50859, 50860, 50861, 50862, 50863,
+  50864, 50865, 50866, 50867, 50868, 50869, 50870, 50871, 50872, 50873, 50874, 50875, 50876, 50877, 50878, 50879,
+  50880, 50881, 50882, 50883, 50884, 50885, 50886, 50887, 50888, 50889, 50890, 50891, 50892, 50893, 50894, 50895,
+  50896, 50897, 50898, 50899, 50900, 50901, 50902, 50903, 50904, 50905, 50906, 50907, 50908, 50909, 50910, 50911,
+  50912, 50913, 50914, 50915, 50916, 50917, 50918, 50919, 50920, 50921, 50922, 50923, 50924, 50925, 50926, 50927,
+  50928, 50929, 50930, 50931, 50932, 50933, 50934, 50935, 50936, 50937, 50938, 50939, 50940, 50941, 50942, 50943,
+  50944, 50945, 50946, 50947, 50948, 50949, 50950, 50951, 50952, 50953, 50954, 50955, 50956, 50957, 50958, 50959,
+  50960, 50961, 50962, 50963, 50964, 50965, 50966, 50967, 50968, 50969, 50970, 50971, 50972, 50973, 50974, 50975,
+  50976, 50977, 50978, 50979, 50980, 50981, 50982, 50983, 50984, 50985, 50986, 50987, 50988, 50989, 50990, 50991,
+  50992, 50993, 50994, 50995, 50996, 50997, 50998, 50999, 51000, 51001, 51002, 51003, 51004, 51005, 51006, 51007,
+  51008, 51009, 51010, 51011, 51012, 51013, 51014, 51015, 51016, 51017, 51018, 51019, 51020, 51021, 51022, 51023,
+  51024, 51025, 51026, 51027, 51028, 51029, 51030, 51031, 51032, 51033, 51034, 51035, 51036, 51037, 51038, 51039,
+  51040, 51041, 51042, 51043, 51044, 51045, 51046, 51047, 51048, 51049, 51050, 51051, 51052, 51053, 51054, 51055,
+  51056, 51057, 51058, 51059, 51060, 51061, 51062, 51063, 51064, 51065, 51066, 51067, 51068, 51069, 51070, 51071,
+  51072, 51073, 51074, 51075, 51076, 51077, 51078, 51079, 51080, 51081, 51082, 51083, 51084, 51085, 51086, 51087,
+  51088, 51089, 51090, 51091, 51092, 51093, 51094, 51095, 51096, 51097, 51098, 51099, 51100, 51101, 51102, 51103,
+  51104, 51105, 51106, 51107, 51108, 51109, 51110, 51111, 51112, 51113, 51114, 51115, 51116, 51117, 51118, 51119,
+  51120, 51121, 51122, 51123, 51124, 51125, 51126, 51127, 51128, 51129, 51130, 51131, 51132, 51133, 51134, 51135,
+  51136, 51137, 51138, 51139, 51140, 51141, 51142, 51143, 51144, 51145, 51146, 51147, 51148, 51149, 51150, 51151,
+  51152, 51153, 51154, 51155, 51156, 51157, 51158, 51159, 51160, 51161, 51162, 51163, 51164, 51165, 51166, 51167,
+  51168, 51169, 51170, 51171, 51172, 51173, 51174, 51175, 51176, 51177, 51178, 51179, 51180, 51181, 51182, 51183,
+  51184, 51185, 51186, 51187, 51188, 51189, 51190, 51191, 51192, 51193, 51194, 51195, 51196, 51197, 51198, 51199,
+  51200, 51201, 51202, 51203, 51204, 51205, 51206, 51207, 51208, 51209, 51210, 51211, 51212, 51213, 51214, 51215,
+  51216, 51217, 51218, 51219, 51220, 51221, 51222, 51223, 51224, 51225, 51226, 51227, 51228, 51229, 51230, 51231,
+  51232, 51233, 51234, 51235, 51236, 51237, 51238, 51239, 51240, 51241, 51242, 51243, 51244, 51245, 51246, 51247,
+  51248, 51249, 51250, 51251, 51252, 51253, 51254, 51255, 51256, 51257, 51258, 51259, 51260, 51261, 51262, 51263,
+  51264, 51265, 51266, 51267, 51268, 51269, 51270, 51271, 51272, 51273, 51274, 51275, 51276, 51277, 51278, 51279,
+  51280, 51281, 51282, 51283, 51284, 51285, 51286, 51287, 51288, 51289, 51290, 51291, 51292, 51293, 51294, 51295,
+  51296, 51297, 51298, 51299, 51300, 51301, 51302, 51303, 51304, 51305, 51306, 51307, 51308, 51309, 51310, 51311,
+  51312, 51313, 51314, 51315, 51316, 51317, 51318, 51319, 51320, 51321, 51322, 51323, 51324, 51325, 51326, 51327,
+  51328, 51329, 51330, 51331, 51332, 51333, 51334, 51335, 51336, 51337, 51338, 51339, 51340, 51341, 51342, 51343,
+  51344, 51345, 51346, 51347, 51348, 51349, 51350, 51351, 51352, 51353, 51354, 51355, 51356, 51357, 51358, 51359,
+  51360, 51361, 51362, 51363, 51364, 51365, 51366, 51367, 51368, 51369, 51370, 51371, 51372, 51373, 51374, 51375,
+  51376, 51377, 51378, 51379, 51380, 51381, 51382, 51383, 51384, 51385, 51386, 51387, 51388, 51389, 51390, 51391,
+  51392, 51393, 51394, 51395, 51396, 51397, 51398, 51399, 51400, 51401, 51402, 51403, 51404, 51405, 51406, 51407,
+  51408, 51409, 51410, 51411, 51412, 51413, 51414, 51415, 51416, 51417, 51418, 51419, 51420, 51421, 51422, 51423,
+  51424, 51425, 51426, 51427, 51428, 51429, 51430, 51431, 51432, 51433, 51434, 51435, 51436, 51437, 51438, 51439,
+  51440, 51441, 51442, 51443, 51444, 51445, 51446, 51447, 51448, 51449, 51450, 51451, 51452, 51453, 51454, 51455,
+  51456, 51457, 51458, 51459, 51460, 51461, 51462, 51463, 51464, 51465, 51466, 51467, 51468, 51469, 51470, 51471,
+  51472, 51473, 51474, 51475, 51476, 51477, 51478, 51479, 51480, 51481, 51482, 51483, 51484, 51485, 51486, 51487,
+  51488, 51489, 51490, 51491, 51492, 51493, 51494, 51495, 51496, 51497, 51498, 51499, 51500, 51501, 51502, 51503,
+  51504, 51505, 51506, 51507, 51508, 51509, 51510, 51511, 51512, 51513, 51514, 51515, 51516, 51517, 51518, 51519,
+  51520, 51521, 51522, 51523, 51524, 51525, 51526, 51527, 51528, 51529, 51530, 51531, 51532, 51533, 51534, 51535,
+  51536, 51537, 51538, 51539, 51540, 51541, 51542, 51543, 51544, 51545, 51546, 51547, 51548, 51549, 51550, 51551,
+  51552, 51553, 51554, 51555, 51556, 51557, 51558, 51559, 51560, 51561, 51562, 51563, 51564, 51565, 51566, 51567,
+  51568, 51569, 51570, 51571, 51572, 51573, 51574, 51575, 51576, 51577, 51578, 51579, 51580, 51581, 51582, 51583,
+  51584, 51585, 51586, 51587, 51588, 51589, 51590, 51591, 51592, 51593, 51594, 51595, 51596, 51597, 51598, 51599,
+  51600, 51601, 51602, 51603, 51604, 51605, 51606, 51607, 51608, 51609, 51610, 51611, 51612, 51613, 51614, 51615,
+  51616, 51617, 51618, 51619, 51620, 51621, 51622, 51623, 51624, 51625, 51626, 51627, 51628, 51629, 51630, 51631,
+  51632, 51633, 51634, 51635, 51636, 51637, 51638, 51639, 51640, 51641, 51642, 51643, 51644, 51645, 51646, 51647,
+  51648, 51649, 51650, 51651, 51652, 51653, 51654, 51655, 51656, 51657, 51658, 51659, 51660, 51661, 51662, 51663,
+  51664, 51665, 51666, 51667, 51668, 51669, 51670, 51671, 51672, 51673, 51674, 51675, 51676, 51677, 51678, 51679,
+  51680, 51681, 51682, 51683, 51684, 51685, 51686, 51687, 51688, 51689, 51690, 51691, 51692, 51693, 51694, 51695,
+  51696, 51697, 51698, 51699, 51700, 51701, 51702, 51703, 51704, 51705, 51706, 51707, 51708, 51709, 51710, 51711,
+  51712, 51713, 51714, 51715, 51716, 51717, 51718, 51719, 51720, 51721, 51722, 51723, 51724, 51725, 51726, 51727,
+  51728, 51729, 51730, 51731, 51732, 51733, 51734, 51735, 51736, 51737, 51738, 51739, 51740, 51741, 51742, 51743,
+  51744, 51745, 51746, 51747, 51748, 51749, 51750, 51751, 51752, 51753, 51754, 51755, 51756, 51757, 51758, 51759,
+  51760, 51761, 51762, 51763, 51764, 51765, 51766, 51767, 51768, 51769, 51770, 51771, 51772, 51773, 51774, 51775,
+  51776, 51777, 51778, 51779, 51780, 51781, 51782, 51783, 51784, 51785, 51786, 51787, 51788, 51789, 51790, 51791,
+  51792, 51793, 51794, 51795, 51796, 51797, 51798, 51799, 51800, 51801, 51802, 51803, 51804, 51805, 51806, 51807,
+  51808, 51809, 51810, 51811, 51812, 51813, 51814, 51815, 51816, 51817, 51818, 51819, 51820, 51821, 51822, 51823,
+  51824, 51825, 51826, 51827, 51828, 51829, 51830, 51831, 51832, 51833, 51834, 51835, 51836, 51837, 51838, 51839,
+  51840, 51841, 51842, 51843, 51844, 51845, 51846, 51847, 51848, 51849, 51850, 51851, 51852, 51853, 51854, 51855,
+  51856, 51857, 51858, 51859, 51860, 51861, 51862, 51863, 51864, 51865, 51866, 51867, 51868, 51869, 51870, 51871,
+  51872, 51873, 51874, 51875, 51876, 51877, 51878, 51879, 51880, 51881, 51882, 51883, 51884, 51885, 51886, 51887,
+  51888, 51889, 51890, 51891, 51892, 51893, 51894, 51895, 51896, 51897, 51898, 51899, 51900, 51901, 51902, 51903,
+  51904, 51905, 51906, 51907, 51908, 51909, 51910, 51911, 51912, 51913, 51914, 51915, 51916, 51917, 51918, 51919,
+  51920, 51921, 51922, 51923, 51924, 51925, 51926, 51927, 51928, 51929, 51930, 51931, 51932, 51933, 51934, 51935,
+  51936, 51937, 51938, 51939, 51940, 51941, 51942, 51943, 51944, 51945, 51946, 51947, 51948, 51949, 51950, 51951,
+  51952, 51953, 51954, 51955, 51956, 51957, 51958, 51959, 51960, 51961, 51962, 51963, 51964, 51965, 51966, 51967,
+  51968, 51969, 51970, 51971, 51972, 51973, 51974, 51975, 51976, 51977, 51978, 51979, 51980, 51981, 51982, 51983,
+  51984, 51985, 51986, 51987, 51988, 51989, 51990, 51991, 51992, 51993, 51994, 51995, 51996, 51997, 51998, 51999,
+  52000, 52001, 52002, 52003, 52004, 52005, 52006, 52007, 52008, 52009, 52010, 52011, 52012, 52013, 52014, 52015,
+  52016, 52017, 52018, 52019, 52020, 52021, 52022, 52023, 52024, 52025, 52026, 52027, 52028, 52029, 52030, 52031,
+  52032, 52033, 52034, 52035, 52036, 52037, 52038, 52039, 52040, 52041, 52042, 52043, 52044, 52045, 52046, 52047,
+  52048, 52049, 52050, 52051, 52052, 52053, 52054, 52055, 52056, 52057, 52058, 52059, 52060, 52061, 52062, 52063,
+  52064, 52065, 52066, 52067, 52068, 52069, 52070, 52071, 52072, 52073, 52074, 52075, 52076, 52077, 52078, 52079,
+  52080, 52081, 52082, 52083, 52084, 52085, 52086, 52087, 52088, 52089, 52090, 52091, 52092, 52093, 52094, 52095,
+  52096, 52097, 52098, 52099, 52100, 52101, 52102, 52103, 52104, 52105, 52106, 52107, 52108, 52109, 52110, 52111,
+  52112, 52113, 52114, 52115, 52116, 52117, 52118, 52119, 52120, 52121, 52122, 52123, 52124, 52125, 52126, 52127,
+  52128, 52129, 52130, 52131, 52132, 52133, 52134, 52135, 52136, 52137, 52138, 52139, 52140, 52141, 52142, 52143,
+  52144, 52145, 52146, 52147, 52148, 52149, 52150, 52151, 52152, 52153, 52154, 52155, 52156, 52157, 52158, 52159,
+  52160, 52161, 52162, 52163, 52164, 52165, 52166, 52167, 52168, 52169, 52170, 52171, 52172, 52173, 52174, 52175,
+  52176, 52177, 52178, 52179, 52180, 52181, 52182, 52183, 52184, 52185, 52186, 52187, 52188, 52189, 52190, 52191,
+  52192, 52193, 52194, 52195, 52196, 52197, 52198, 52199, 52200, 52201, 52202, 52203, 52204, 52205, 52206, 52207,
+  52208, 52209, 52210, 52211, 52212, 52213, 52214, 52215, 52216, 52217, 52218, 52219, 52220, 52221, 52222, 52223,
+  52224, 52225, 52226, 52227, 52228, 52229, 52230, 52231, 52232, 52233, 52234, 52235, 52236, 52237, 52238, 52239,
+  52240, 52241, 52242, 52243, 52244, 52245, 52246, 52247, 52248, 52249, 52250, 52251, 52252, 52253, 52254, 52255,
+  52256, 52257, 52258, 52259, 52260, 52261, 52262, 52263, 52264, 52265, 52266, 52267, 52268, 52269, 52270, 52271,
+  52272, 52273, 52274, 52275, 52276, 52277, 52278, 52279, 52280, 52281, 52282, 52283, 52284, 52285, 52286, 52287,
+  52288, 52289, 52290, 52291, 52292, 52293, 52294, 52295, 52296, 52297, 52298, 52299, 52300, 52301, 52302, 52303,
+  52304, 52305, 52306, 52307, 52308, 52309, 52310, 52311, 52312, 52313, 52314, 52315, 52316, 52317, 52318, 52319,
+  52320, 52321, 52322, 52323, 52324, 52325, 52326, 52327, 52328, 52329, 52330, 52331, 52332, 52333, 52334, 52335,
+  52336, 52337, 52338, 52339, 52340, 52341, 52342, 52343, 52344, 52345, 52346, 52347, 52348, 52349, 52350, 52351,
+  52352, 52353, 52354, 52355, 52356, 52357, 52358, 52359, 52360, 52361, 52362, 52363, 52364, 52365, 52366, 52367,
+  52368, 52369, 52370, 52371, 52372, 52373, 52374, 52375, 52376, 52377, 52378, 52379, 52380, 52381, 52382, 52383,
+  52384, 52385, 52386, 52387, 52388, 52389, 52390, 52391, 52392, 52393, 52394, 52395, 52396, 52397, 52398, 52399,
+  52400, 52401, 52402, 52403, 52404, 52405, 52406, 52407, 52408, 52409, 52410, 52411, 52412, 52413, 52414, 52415,
+  52416, 52417, 52418, 52419, 52420, 52421, 52422, 52423, 52424, 52425, 52426, 52427, 52428, 52429, 52430, 52431,
+  52432, 52433, 52434, 52435, 52436, 52437, 52438, 52439, 52440, 52441, 52442, 52443, 52444, 52445, 52446, 52447,
+  52448, 52449, 52450, 52451, 52452, 52453, 52454, 52455, 52456, 52457, 52458, 52459, 52460, 52461, 52462, 52463,
+  52464, 52465, 52466, 52467, 52468, 52469, 52470, 52471, 52472, 52473, 52474, 52475, 52476, 52477, 52478, 52479,
+  52480, 52481, 52482, 52483, 52484, 52485, 52486, 52487, 52488, 52489, 52490, 52491, 52492, 52493, 52494, 52495,
+  52496, 52497, 52498, 52499, 52500, 52501, 52502, 52503, 52504, 52505, 52506, 52507, 52508, 52509, 52510, 52511,
+  52512, 52513, 52514, 52515, 52516, 52517, 52518, 52519, 52520, 52521, 52522, 52523, 52524, 52525, 52526, 52527,
+  52528, 52529, 52530, 52531, 52532, 52533, 52534, 52535, 52536, 52537, 52538, 52539, 52540, 52541, 52542, 52543,
+  52544, 52545, 52546, 52547, 52548, 52549, 52550, 52551, 52552, 52553, 52554, 52555, 52556, 52557, 52558, 52559,
+  52560, 52561, 52562, 52563, 52564, 52565, 52566, 52567, 52568, 52569, 52570, 52571, 52572, 52573, 52574, 52575,
+  52576, 52577, 52578, 52579, 52580, 52581, 52582, 52583, 52584, 52585, 52586, 52587, 52588, 52589, 52590, 52591,
+  52592, 52593, 52594, 52595, 52596, 52597, 52598, 52599, 52600, 52601, 52602, 52603, 52604, 52605, 52606, 52607,
+  52608, 52609, 52610, 52611, 52612, 52613, 52614, 52615, 52616, 52617, 52618, 52619, 52620, 52621, 52622, 52623,
+  52624, 52625, 52626, 52627, 52628, 52629, 52630, 52631, 52632, 52633, 52634, 52635, 52636, 52637, 52638, 52639,
+  52640, 52641, 52642, 52643, 52644, 52645, 52646, 52647, 52648, 52649, 52650, 52651, 52652, 52653, 52654, 52655,
+  52656, 52657, 52658, 52659, 52660, 52661, 52662, 52663, 52664, 52665, 52666, 52667, 52668, 52669, 52670, 52671,
+  52672, 52673, 52674, 52675, 52676, 52677, 52678, 52679, 52680, 52681, 52682, 52683, 52684, 52685, 52686, 52687,
+  52688, 52689, 52690, 52691, 52692, 52693, 52694, 52695, 52696, 52697, 52698, 52699, 52700, 52701, 52702, 52703,
+  52704, 52705, 52706, 52707, 52708, 52709, 52710, 52711, 52712, 52713, 52714, 52715, 52716, 52717, 52718, 52719,
+  52720, 52721, 52722, 52723, 52724, 52725, 52726, 52727, 52728, 52729, 52730, 52731, 52732, 52733, 52734, 52735,
+  52736, 52737, 52738, 52739, 52740, 52741, 52742, 52743, 52744, 52745, 52746, 52747, 52748, 52749, 52750, 52751,
+  52752, 52753, 52754, 52755, 52756, 52757, 52758, 52759, 52760, 52761, 52762, 52763, 52764, 52765, 52766, 52767,
+  52768, 52769, 52770, 52771, 52772, 52773, 52774, 52775, 52776, 52777, 52778, 52779, 52780, 52781, 52782, 52783,
+  52784, 52785, 52786, 52787, 52788, 52789, 52790, 52791, 52792, 52793, 52794, 52795, 52796, 52797, 52798, 52799,
+  52800, 52801, 52802, 52803, 52804, 52805, 52806, 52807, 52808, 52809, 52810, 52811, 52812, 52813, 52814, 52815,
+  52816, 52817, 52818, 52819, 52820, 52821, 52822, 52823, 52824, 52825, 52826, 52827, 52828, 52829, 52830, 52831,
+  52832, 52833, 52834, 52835, 52836, 52837, 52838, 52839, 52840, 52841, 52842, 52843, 52844, 52845, 52846, 52847,
+  52848, 52849, 52850, 52851, 52852, 52853, 52854, 52855, 52856, 52857, 52858, 52859, 52860, 52861, 52862, 52863,
+  52864, 52865, 52866, 52867, 52868, 52869, 52870, 52871, 52872, 52873, 52874, 52875, 52876, 52877, 52878, 52879,
+  52880, 52881, 52882, 52883, 52884, 52885, 52886, 52887, 52888, 52889, 52890, 52891, 52892, 52893, 52894, 52895,
+  52896, 52897, 52898, 52899, 52900, 52901, 52902, 52903, 52904, 52905, 52906, 52907, 52908, 52909, 52910, 52911,
+  52912, 52913, 52914, 52915, 52916, 52917, 52918, 52919, 52920, 52921, 52922, 52923, 52924, 52925, 52926, 52927,
+  52928, 52929, 52930, 52931, 52932, 52933, 52934, 52935, 52936, 52937, 52938, 52939, 52940, 52941, 52942, 52943,
+  52944, 52945, 52946, 52947, 52948, 52949, 52950, 52951, 52952, 52953, 52954, 52955, 52956, 52957, 52958, 52959,
+  52960, 52961, 52962, 52963, 52964, 52965, 52966, 52967, 52968, 52969, 52970, 52971, 52972, 52973, 52974, 52975,
+  52976, 52977, 52978, 52979, 52980, 52981, 52982, 52983, 52984, 52985, 52986, 52987, 52988, 52989, 52990, 52991,
+  52992, 52993, 52994, 52995, 52996, 52997, 52998, 52999, 53000, 53001, 53002, 53003, 53004, 53005, 53006, 53007,
+  53008, 53009, 53010, 53011, 53012, 53013, 53014, 53015, 53016, 53017, 53018, 53019, 53020, 53021, 53022, 53023,
+  53024, 53025, 53026, 53027, 53028, 53029, 53030, 53031, 53032, 53033, 53034, 53035, 53036, 53037, 53038, 53039,
+  53040, 53041, 53042, 53043, 53044, 53045, 53046, 53047, 53048, 53049, 53050, 53051, 53052, 53053, 53054, 53055,
+  53056, 53057, 53058, 53059, 53060, 53061, 53062, 53063, 53064, 53065, 53066, 53067, 53068, 53069, 53070, 53071,
+  53072, 53073, 53074, 53075, 53076, 53077, 53078, 53079, 53080, 53081, 53082, 53083, 53084, 53085, 53086, 53087,
+  53088, 53089, 53090, 53091, 53092, 53093, 53094, 53095, 53096, 53097, 53098, 53099, 53100, 53101, 53102, 53103,
+  53104, 53105, 53106, 53107, 53108, 53109, 53110, 53111, 53112, 53113, 53114, 53115, 53116, 53117, 53118, 53119,
+  53120, 53121, 53122, 53123, 53124, 53125, 53126, 53127, 53128, 53129, 53130, 53131, 53132, 53133, 53134, 53135,
+  53136, 53137, 53138, 53139, 53140, 53141, 53142, 53143, 53144, 53145, 53146, 53147, 53148, 53149, 53150, 53151,
+  53152, 53153, 53154, 53155, 53156, 53157, 53158, 53159, 53160, 53161, 53162, 53163, 53164, 53165, 53166, 53167,
+  53168, 53169, 53170, 53171, 53172, 53173, 53174, 53175, 53176, 53177, 53178, 53179, 53180, 53181, 53182, 53183,
+  53184, 53185, 53186, 53187, 53188, 53189, 53190, 53191, 53192, 53193, 53194, 53195, 53196, 53197, 53198, 53199,
+  53200, 53201, 53202, 53203, 53204, 53205, 53206, 53207, 53208, 53209, 53210, 53211, 53212, 53213, 53214, 53215,
+  53216, 53217, 53218, 53219, 53220, 53221, 53222, 53223, 53224, 53225, 53226, 53227, 53228, 53229, 53230, 53231,
+  53232, 53233, 53234, 53235, 53236, 53237, 53238, 53239, 53240, 53241, 53242, 53243, 53244, 53245, 53246, 53247,
+  53248, 53249, 53250, 53251, 53252, 53253, 53254, 53255, 53256, 53257, 53258, 53259, 53260, 53261, 53262, 53263,
+  53264, 53265, 53266, 53267, 53268, 53269, 53270, 53271, 53272, 53273, 53274, 53275, 53276, 53277, 53278, 53279,
+  53280, 53281, 53282, 53283, 53284, 53285, 53286, 53287, 53288, 53289, 53290, 53291, 53292, 53293, 53294, 53295,
+  53296, 53297, 53298, 53299, 53300, 53301, 53302, 53303, 53304, 53305, 53306, 53307, 53308, 53309, 53310, 53311,
+  53312, 53313, 53314, 53315, 53316, 53317, 53318, 53319, 53320, 53321, 53322, 53323, 53324, 53325, 53326, 53327,
+  53328, 53329, 53330, 53331, 53332, 53333, 53334, 53335, 53336, 53337, 53338, 53339, 53340, 53341, 53342, 53343,
+  53344, 53345, 53346, 53347, 53348, 53349, 53350, 53351, 53352, 53353, 53354, 53355, 53356, 53357, 53358, 53359,
+  53360, 53361, 53362, 53363, 53364, 53365, 53366, 53367, 53368, 53369, 53370, 53371, 53372, 53373, 53374, 53375,
+  53376, 53377, 53378, 53379, 53380, 53381, 53382, 53383, 53384, 53385, 53386, 53387, 53388, 53389, 53390, 53391,
+  53392, 53393, 53394, 53395, 53396, 53397, 53398, 53399, 53400, 53401, 53402, 53403, 53404, 53405, 53406, 53407,
+  53408, 53409, 53410, 53411, 53412, 53413, 53414, 53415, 53416, 53417, 53418, 53419, 53420, 53421, 53422, 53423,
+  53424, 53425, 53426, 53427, 53428, 53429, 53430, 53431, 53432, 53433, 53434, 53435, 53436, 53437, 53438, 53439,
+  53440, 53441, 53442, 53443, 53444, 53445, 53446, 53447, 53448, 53449, 53450, 53451, 53452, 53453, 53454, 53455,
+  53456, 53457, 53458, 53459, 53460, 53461, 53462, 53463, 53464, 53465, 53466, 53467, 53468, 53469, 53470, 53471,
+  53472, 53473, 53474, 53475, 53476, 53477, 53478, 53479, 53480, 53481, 53482, 53483, 53484, 53485, 53486, 53487,
+  53488, 53489, 53490, 53491, 53492, 53493, 53494, 53495, 53496, 53497, 53498, 53499, 53500, 53501, 53502, 53503,
+  53504, 53505, 53506, 53507, 53508, 53509, 53510, 53511, 53512, 53513, 53514, 53515, 53516, 53517, 53518, 53519,
+  53520, 53521, 53522, 53523, 53524, 53525, 53526, 53527, 53528, 53529, 53530, 53531, 53532, 53533, 53534, 53535,
+  53536, 53537, 53538, 53539, 53540, 53541, 53542, 53543, 53544, 53545, 53546, 53547, 53548, 53549, 53550, 53551,
+  53552, 53553, 53554, 53555, 53556, 53557, 53558, 53559, 53560, 53561, 53562, 53563, 53564, 53565, 53566, 53567,
+  53568, 53569, 53570, 53571, 53572, 53573, 53574, 53575, 53576, 53577, 53578, 53579, 53580, 53581, 53582, 53583,
+  53584, 53585, 53586, 53587, 53588, 53589, 53590, 53591, 53592, 53593, 53594, 53595, 53596, 53597, 53598, 53599,
+  53600, 53601, 53602, 53603, 53604, 53605, 53606, 53607, 53608, 53609, 53610, 53611, 53612, 53613, 53614, 53615,
+  53616, 53617, 53618, 53619, 53620, 53621, 53622, 53623, 53624, 53625, 53626, 53627, 53628, 53629, 53630, 53631,
+  53632, 53633, 53634, 53635, 53636, 53637, 53638, 53639, 53640, 53641, 53642, 53643, 53644, 53645, 53646, 53647,
+  53648, 53649, 53650, 53651, 53652, 53653, 53654, 53655, 53656, 53657, 53658, 53659, 53660, 53661, 53662, 53663,
+  53664, 53665, 53666, 53667, 53668, 53669, 53670, 53671, 53672, 53673, 53674, 53675, 53676, 53677, 53678, 53679,
+  53680, 53681, 53682, 53683, 53684, 53685, 53686, 53687, 53688, 53689, 53690, 53691, 53692, 53693, 53694, 53695,
+  53696, 53697, 53698, 53699, 53700, 53701, 53702, 53703, 53704, 53705, 53706, 53707, 53708, 53709, 53710, 53711,
+  53712, 53713, 53714, 53715, 53716, 53717, 53718, 53719, 53720, 53721, 53722, 53723, 53724, 53725, 53726, 53727,
+  53728, 53729, 53730, 53731, 53732, 53733, 53734, 53735, 53736, 53737, 53738, 53739, 53740, 53741, 53742, 53743,
+  53744, 53745, 53746, 53747, 53748, 53749, 53750, 53751, 53752, 53753, 53754, 53755, 53756, 53757, 53758, 53759,
+  53760, 53761, 53762, 53763, 53764, 53765, 53766, 53767, 53768, 53769, 53770, 53771, 53772, 53773, 53774, 53775,
+  53776, 53777, 53778, 53779, 53780, 53781, 53782, 53783, 53784, 53785, 53786, 53787, 53788, 53789, 53790, 53791,
+  53792, 53793, 53794, 53795, 53796, 53797, 53798, 53799, 53800, 53801, 53802, 53803, 53804, 53805, 53806, 53807,
+  53808, 53809, 53810, 53811, 53812, 53813, 53814, 53815, 53816, 53817, 53818, 53819, 53820, 53821, 53822, 53823,
+  53824, 53825, 53826, 53827, 53828, 53829, 53830, 53831, 53832, 53833, 53834, 53835, 53836, 53837, 53838, 53839,
+  53840, 53841, 53842, 53843, 53844, 53845, 53846, 53847, 53848, 53849, 53850, 53851, 53852, 53853, 53854, 53855,
+  53856, 53857, 53858, 53859, 53860, 53861, 53862, 53863, 53864, 53865, 53866, 53867, 53868, 53869, 53870, 53871,
+  53872, 53873, 53874, 53875, 53876, 53877, 53878, 53879, 53880, 53881, 53882, 53883, 53884, 53885, 53886, 53887,
+  53888, 53889, 53890, 53891, 53892, 53893, 53894, 53895, 53896, 53897, 53898, 53899, 53900, 53901, 53902, 53903,
+  53904, 53905, 53906, 53907, 53908, 53909, 53910, 53911, 53912, 53913, 53914, 53915, 53916, 53917, 53918, 53919,
+  53920, 53921, 53922, 53923, 53924, 53925, 53926, 53927, 53928, 53929, 53930, 53931, 53932, 53933, 53934, 53935,
+  53936, 53937, 53938, 53939, 53940, 53941, 53942, 53943, 53944, 53945, 53946, 53947, 53948, 53949, 53950, 53951,
+  53952, 53953, 53954, 53955, 53956, 53957, 53958, 53959, 53960, 53961, 53962, 53963, 53964, 53965, 53966, 53967,
+  53968, 53969, 53970, 53971, 53972, 53973, 53974, 53975, 53976, 53977, 53978, 53979, 53980, 53981, 53982, 53983,
+  53984, 53985, 53986, 53987, 53988, 53989, 53990, 53991, 53992, 53993, 53994, 53995, 53996, 53997, 53998, 53999,
+  54000, 54001, 54002, 54003, 54004, 54005, 54006, 54007, 54008, 54009, 54010, 54011, 54012, 54013, 54014, 54015,
+  54016, 54017, 54018, 54019, 54020, 54021, 54022, 54023, 54024, 54025, 54026, 54027, 54028, 54029, 54030, 54031,
+  54032, 54033, 54034, 54035, 54036, 54037, 54038, 54039, 54040, 54041, 54042, 54043, 54044, 54045, 54046, 54047,
+  54048, 54049, 54050, 54051, 54052, 54053, 54054, 54055, 54056, 54057, 54058, 54059, 54060, 54061, 54062, 54063,
+  54064, 54065, 54066, 54067, 54068, 54069, 54070, 54071, 54072, 54073, 54074, 54075, 54076, 54077, 54078, 54079,
+  54080, 54081, 54082, 54083, 54084, 54085, 54086, 54087, 54088, 54089, 54090, 54091, 54092, 54093, 54094, 54095,
+  54096, 54097, 54098, 54099, 54100, 54101, 54102, 54103, 54104, 54105, 54106, 54107, 54108, 54109, 54110, 54111,
+  54112, 54113, 54114, 54115, 54116, 54117, 54118, 54119, 54120, 54121, 54122, 54123, 54124, 54125, 54126, 54127,
+  54128, 54129, 54130, 54131, 54132, 54133, 54134, 54135, 54136, 54137, 54138, 54139, 54140, 54141, 54142, 54143,
+  54144, 54145, 54146, 54147, 54148, 54149, 54150, 54151, 54152, 54153, 54154, 54155, 54156, 54157, 54158, 54159,
+  54160, 54161, 54162, 54163, 54164, 54165, 54166, 54167, 54168, 54169, 54170, 54171, 54172, 54173, 54174, 54175,
+  54176, 54177, 54178, 54179, 54180, 54181, 54182, 54183, 54184, 54185, 54186, 54187, 54188, 54189, 54190, 54191,
+  54192, 54193, 54194, 54195, 54196, 54197, 54198, 54199, 54200, 54201, 54202, 54203, 54204, 54205, 54206, 54207,
+  54208, 54209, 54210, 54211, 54212, 54213, 54214, 54215, 54216, 54217, 54218, 54219, 54220, 54221, 54222, 54223,
+  54224, 54225, 54226, 54227, 54228, 54229, 54230, 54231, 54232, 54233, 54234, 54235, 54236, 54237, 54238, 54239,
+  54240, 54241, 54242, 54243, 54244, 54245, 54246, 54247, 54248, 54249, 54250, 54251, 54252, 54253, 54254, 54255,
+  54256, 54257, 54258, 54259, 54260, 54261, 54262, 54263, 54264, 54265, 54266, 54267, 54268, 54269, 54270, 54271,
+  54272, 54273, 54274, 54275, 54276, 54277, 54278, 54279, 54280, 54281, 54282, 54283, 54284, 54285, 54286, 54287,
+  54288, 54289, 54290, 54291, 54292, 54293, 54294, 54295, 54296, 54297, 54298, 54299, 54300, 54301, 54302, 54303,
+  54304, 54305, 54306, 54307, 54308, 54309, 54310, 54311, 54312, 54313, 54314, 54315, 54316, 54317, 54318, 54319,
+  54320, 54321, 54322, 54323, 54324, 54325, 54326, 54327, 54328, 54329, 54330, 54331, 54332, 54333, 54334, 54335,
+  54336, 54337, 54338, 54339, 54340, 54341, 54342, 54343, 54344, 54345, 54346, 54347, 54348, 54349, 54350, 54351,
+  54352, 54353, 54354, 54355, 54356, 54357, 54358, 54359, 54360, 54361, 54362, 54363, 54364, 54365, 54366, 54367,
+  54368, 54369, 54370, 54371, 54372, 54373, 54374, 54375, 54376, 54377, 54378, 54379, 54380, 54381, 54382, 54383,
+  54384, 54385, 54386, 54387, 54388, 54389, 54390, 54391, 54392, 54393, 54394, 54395, 54396, 54397, 54398, 54399,
+  54400, 54401, 54402, 54403, 54404, 54405, 54406, 54407, 54408, 54409, 54410, 54411, 54412, 54413, 54414, 54415,
+  54416, 54417, 54418, 54419, 54420, 54421, 54422, 54423, 54424, 54425, 54426, 54427, 54428, 54429, 54430, 54431,
+  54432, 54433, 54434, 54435, 54436, 54437, 54438, 54439, 54440, 54441, 54442, 54443, 54444, 54445, 54446, 54447,
+  54448, 54449, 54450, 54451, 54452, 54453, 54454, 54455, 54456, 54457, 54458, 54459, 54460, 54461, 54462, 54463,
+  54464, 54465, 54466, 54467, 54468, 54469, 54470, 54471, 54472, 54473, 54474, 54475, 54476, 54477, 54478, 54479,
+  54480, 54481, 54482, 54483, 54484, 54485, 54486, 54487, 54488, 54489, 54490, 54491, 54492, 54493, 54494, 54495,
+  54496, 54497, 54498, 54499, 54500, 54501, 54502, 54503, 54504, 54505, 54506, 54507, 54508, 54509, 54510, 54511,
+  54512, 54513, 54514, 54515, 54516, 54517, 54518, 54519, 54520, 54521, 54522, 54523, 54524, 54525, 54526, 54527,
+  54528, 54529, 54530, 54531, 54532, 54533, 54534, 54535, 54536, 54537, 54538, 54539, 54540, 54541, 54542, 54543,
+  54544, 54545, 54546, 54547, 54548, 54549, 54550, 54551, 54552, 54553, 54554, 54555, 54556, 54557, 54558, 54559,
+  54560, 54561, 54562, 54563, 54564, 54565, 54566, 54567, 54568, 54569, 54570, 54571, 54572, 54573, 54574, 54575,
+  54576, 54577, 54578, 54579, 54580, 54581, 54582, 54583, 54584, 54585, 54586, 54587, 54588, 54589, 54590, 54591,
+  54592, 54593, 54594, 54595, 54596, 54597, 54598, 54599, 54600, 54601, 54602, 54603, 54604, 54605, 54606, 54607,
+  54608, 54609, 54610, 54611, 54612, 54613, 54614, 54615, 54616, 54617, 54618, 54619, 54620, 54621, 54622, 54623,
+  54624, 54625, 54626, 54627, 54628, 54629, 54630, 54631, 54632, 54633, 54634, 54635, 54636, 54637, 54638, 54639,
+  54640, 54641, 54642, 54643, 54644, 54645, 54646, 54647, 54648, 54649, 54650, 54651, 54652, 54653, 54654, 54655,
+  54656, 54657, 54658, 54659, 54660, 54661, 54662, 54663, 54664, 54665, 54666, 54667, 54668, 54669, 54670, 54671,
+  54672, 54673, 54674, 54675, 54676, 54677, 54678, 54679, 54680, 54681, 54682, 54683, 54684, 54685, 54686, 54687,
+  54688, 54689, 54690, 54691, 54692, 54693, 54694, 54695, 54696, 54697, 54698, 54699, 54700, 54701, 54702, 54703,
+  54704, 54705, 54706, 54707, 54708, 54709, 54710, 54711, 54712, 54713, 54714, 54715, 54716, 54717, 54718, 54719,
+  54720, 54721, 54722, 54723, 54724, 54725, 54726, 54727, 54728, 54729, 54730, 54731, 54732, 54733, 54734, 54735,
+  54736, 54737, 54738, 54739, 54740, 54741, 54742, 54743, 54744, 54745, 54746, 54747, 54748, 54749, 54750, 54751,
+  54752, 54753, 54754, 54755, 54756, 54757, 54758, 54759, 54760, 54761, 54762, 54763, 54764, 54765, 54766, 54767,
+  54768, 54769, 54770, 54771, 54772, 54773, 54774, 54775, 54776, 54777, 54778, 54779, 54780, 54781, 54782, 54783,
+  54784, 54785, 54786, 54787, 54788, 54789, 54790, 54791, 54792, 54793, 54794, 54795, 54796, 54797, 54798, 54799,
+  54800, 54801, 54802, 54803, 54804, 54805, 54806, 54807, 54808, 54809, 54810, 54811, 54812, 54813, 54814, 54815,
+  54816, 54817, 54818, 54819, 54820, 54821, 54822, 54823, 54824, 54825, 54826, 54827, 54828, 54829, 54830, 54831,
+  54832, 54833, 54834, 54835, 54836, 54837, 54838, 54839, 54840, 54841, 54842, 54843, 54844, 54845, 54846, 54847,
+  54848, 54849, 54850, 54851, 54852, 54853, 54854, 54855, 54856, 54857, 54858, 54859, 54860, 54861, 54862, 54863,
+  54864, 54865, 54866, 54867, 54868, 54869, 54870, 54871, 54872, 54873, 54874, 54875, 54876, 54877, 54878, 54879,
+  54880, 54881, 54882, 54883, 54884, 54885, 54886, 54887, 54888, 54889, 54890, 54891, 54892, 54893, 54894, 54895,
+  54896, 54897, 54898, 54899, 54900, 54901, 54902, 54903, 54904, 54905, 54906, 54907, 54908, 54909, 54910, 54911,
+  54912, 54913, 54914, 54915, 54916, 54917, 54918, 54919, 54920, 54921, 54922, 54923, 54924, 54925, 54926, 54927,
+  54928, 54929, 54930, 54931, 54932, 54933, 54934, 54935, 54936, 54937, 54938, 54939, 54940, 54941, 54942, 54943,
+  54944, 54945, 54946, 54947, 54948, 54949, 54950, 54951, 54952, 54953, 54954, 54955, 54956, 54957, 54958, 54959,
+  54960, 54961, 54962, 54963, 54964, 54965, 54966, 54967, 54968, 54969, 54970, 54971, 54972, 54973, 54974, 54975,
+  54976, 54977, 54978, 54979, 54980, 54981, 54982, 54983, 54984, 54985, 54986, 54987, 54988, 54989, 54990, 54991,
+  54992, 54993, 54994, 54995, 54996, 54997, 54998, 54999, 55000, 55001, 55002, 55003, 55004, 55005, 55006, 55007,
+  55008, 55009, 55010, 55011, 55012, 55013, 55014, 55015, 55016, 55017, 55018, 55019, 55020, 55021, 55022, 55023,
+  55024, 55025, 55026, 55027, 55028, 55029, 55030, 55031, 55032, 55033, 55034, 55035, 55036, 55037, 55038, 55039,
+  55040, 55041, 55042, 55043, 55044, 55045, 55046, 55047, 55048, 55049, 55050, 55051, 55052, 55053, 55054, 55055,
+  55056, 55057, 55058, 55059, 55060, 55061, 55062, 55063, 55064, 55065, 55066, 55067, 55068, 55069, 55070, 55071,
+  55072, 55073, 55074, 55075, 55076, 55077, 55078, 55079, 55080, 55081, 55082, 55083, 55084, 55085, 55086, 55087,
+  55088, 55089, 55090, 55091, 55092, 55093, 55094, 55095, 55096, 55097, 55098, 55099, 55100, 55101, 55102, 55103,
+  55104, 55105, 55106, 55107, 55108, 55109, 55110, 55111, 55112, 55113, 55114, 55115, 55116, 55117, 55118, 55119,
+  55120, 55121, 55122, 55123, 55124, 55125, 55126, 55127, 55128, 55129, 55130, 55131, 55132, 55133, 55134, 55135,
+  55136, 55137, 55138, 55139, 55140, 55141, 55142, 55143, 55144, 55145, 55146, 55147, 55148, 55149, 55150, 55151,
+  55152, 55153, 55154, 55155, 55156, 55157, 55158, 55159, 55160, 55161, 55162, 55163, 55164, 55165, 55166, 55167,
+  55168, 55169, 55170, 55171, 55172, 55173, 55174, 55175, 55176, 55177, 55178, 55179, 55180, 55181, 55182, 55183,
+  55184, 55185, 55186, 55187, 55188, 55189, 55190, 55191, 55192, 55193, 55194, 55195, 55196, 55197, 55198, 55199,
+  55200, 55201, 55202, 55203,
+};
+const uint32_t ALPHA_140_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_140_FREQ[] = {
+  { "컊", 0.00000000 },
+  { "푹", 0.00000000 },
+  { "뵪", 0.00000000 },
+  { "뇁", 0.00000000 },
+  { "숱", 0.00000000 },
+  { "앀", 0.00000000 },
+  { "럨", 0.00000000 },
+  { "쎺", 0.00000000 },
+  { "쉰", 0.00000000 },
+  { "죌", 0.00000000 },
+  { "똬", 0.00000000 },
+  { "쬂", 0.00000000 },
+  { "짺", 0.00000000 },
+  { "솖", 0.00000000 },
+  { "뺦", 0.00000000 },
+  { "춗", 0.00000000 },
+  { "푑", 0.00000000 },
+  { "툮", 0.00000000 },
+  { "뷵", 0.00000000 },
+  { "옹", 0.00010000 },
+  { "꽉", 0.00000000 },
+  { "땽", 0.00000000 },
+  { "먁", 0.00000000 },
+  { "웃", 0.00010000 },
+  { "퓕", 0.00000000 },
+  { "뉄", 0.00000000 },
+  { "뇳", 0.00000000 },
+  { "즧", 0.00000000 },
+  { "템", 0.00020000 },
+  { "껜", 0.00000000 },
+  { "얞", 0.00000000 },
+  { "퓻", 0.00000000 },
+  { "턂", 0.00000000 },
+  { "듦", 0.00000000 },
+  { "졵", 0.00000000 },
+  { "끄", 0.00010000 },
+  { "땢", 0.00000000 },
+  { "뽨", 0.00000000 },
+  { "쀍", 0.00000000 },
+  { "핋", 0.00000000 },
+  { "릵", 0.00000000 },
+  { "밲", 0.00000000 },
+  { "귾", 0.00000000 },
+  { "럑", 0.00000000 },
+  { "셔", 0.00010000 },
+  { "뻡", 0.00000000 },
+  { "읡", 0.00000000 },
+  { "뗑", 0.00000000 },
+  { "쥃", 0.00000000 },
+  { "턩", 0.00000000 },
+  { "뤃", 0.00000000 },
+  { "욿", 0.00000000 },
+  { "햻", 0.00000000 },
+  { "옾", 0.00000000 },
+  { "됐", 0.00010000 },
+  { "걵", 0.00000000 },
+  { "꽲", 0.00000000 },
+  { "똺", 0.00000000 },
+  { "궽", 0.00000000 },
+  { "땫", 0.00000000 },
+  { "뭵", 0.00000000 },
+  { "븺", 0.00000000 },
+  { "넶", 0.00000000 },
+  { "뱤", 0.00000000 },
+  { "떂", 0.00000000 },
+  { "헗", 0.00000000 },
+  { "빙", 0.00010000 },
+  { "빃", 0.00000000 },
+  { "뎮", 0.00000000 },
+  { "켤", 0.00000000 },
+  { "누", 0.00030000 },
+  { "둸", 0.00000000 },
+  { "넑", 0.00000000 },
+  { "띗", 0.00000000 },
+  { "쑴", 0.00000000 },
+  { "쪸", 0.00000000 },
+  { "걎", 0.00000000 },
+  { "썉", 0.00000000 },
+  { "뱋", 0.00000000 },
+  { "셮", 0.00000000 },
+  { "겄", 0.00000000 },
+  { "뢐", 0.00000000 },
+  { "쭿", 0.00000000 },
+  { "죁", 0.00000000 },
+  { "깤", 0.00000000 },
+  { "붪", 0.00000000 },
+  { "얢", 0.00000000 },
+  { "햀", 0.00000000 },
+  { "뀪", 0.00000000 },
+  { "컬", 0.00010000 },
+  { "쵔", 0.00000000 },
+  { "븡", 0.00000000 },
+  { "똶", 0.00000000 },
+  { "깰", 0.00000000 },
+  { "빡", 0.00000000 },
+  { "떣", 0.00000000 },
+  { "랡", 0.00000000 },
+  { "껯", 0.00000000 },
+  { "릓", 0.00000000 },
+  { "륕", 0.00000000 },
+  { "뷫", 0.00000000 },
+  { "읆", 0.00000000 },
+  { "퓝", 0.00000000 },
+  { "킰", 0.00000000 },
+  { "쉯", 0.00000000 },
+  { "팹", 0.00000000 },
+  { "칕", 0.00000000 },
+  { "흽", 0.00000000 },
+  { "숡", 0.00000000 },
+  { "랐", 0.00010000 },
+  { "뫼", 0.00000000 },
+  { "픆", 0.00000000 },
+  { "뽈", 0.00000000 },
+  { "팧", 0.00000000 },
+  { "뼏", 0.00000000 },
+  { "볈", 0.00000000 },
+  { "뀒", 0.00000000 },
+  { "뒞", 0.00000000 },
+  { "쫣", 0.00000000 },
+  { "얍", 0.00000000 },
+  { "촨", 0.00000000 },
+  { "옦", 0.00000000 },
+  { "웄", 0.00000000 },
+  { "뵅", 0.00000000 },
+  { "덀", 0.00000000 },
+  { "톔", 0.00000000 },
+  { "힁", 0.00000000 },
+  { "쉉", 0.00000000 },
+  { "뫹", 0.00000000 },
+  { "튴", 0.00000000 },
+  { "꼢", 0.00000000 },
+  { "궲", 0.00000000 },
+  { "엶", 0.00000000 },
+  { "툼", 0.00000000 },
+  { "짓", 0.00010000 },
+  { "닶", 0.00000000 },
+  { "뙉", 0.00000000 },
+  { "곁", 0.00000000 },
+  { "왋", 0.00000000 },
+  { "푞", 0.00000000 },
+  { "극", 0.00050000 },
+  { "쁣", 0.00000000 },
+  { "뉐", 0.00000000 },
+  { "뎏", 0.00000000 },
+  { "풒", 0.00000000 },
+  { "흋", 0.00000000 },
+  { "뢺", 0.00000000 },
+  { "픽", 0.00030000 },
+  { "씋", 0.00000000 },
+  { "쉶", 0.00000000 },
+  { "볏", 0.00000000 },
+  { "뗂", 0.00000000 },
+  { "쾭", 0.00000000 },
+  { "봩", 0.00000000 },
+  { "햆", 0.00000000 },
+  { "늕", 0.00000000 },
+  { "쒍", 0.00000000 },
+  { "쌼", 0.00000000 },
+  { "쐃", 0.00000000 },
+  { "펐", 0.00000000 },
+  { "퇡", 0.00000000 },
+  { "목", 0.00090000 },
+  { "빲", 0.00000000 },
+  { "뎦", 0.00000000 },
+  { "뺖", 0.00000000 },
+  { "빣", 0.00000000 },
+  { "쾩", 0.00000000 },
+  { "덙", 0.00000000 },
+  { "칾", 0.00000000 },
+  { "폒", 0.00000000 },
+  { "짦", 0.00000000 },
+  { "귎", 0.00000000 },
+  { "뺎", 0.00000000 },
+  { "쐤", 0.00000000 },
+  { "뤅", 0.00000000 },
+  { "퀨", 0.00000000 },
+  { "릧", 0.00000000 },
+  { "땕", 0.00000000 },
+  { "뻿", 0.00000000 },
+  { "쪑", 0.00000000 },
+  { "뚟", 0.00000000 },
+  { "힜", 0.00000000 },
+  { "옳", 0.00000000 },
+  { "퐜", 0.00000000 },
+  { "멋", 0.00000000 },
+  { "뱻", 0.00000000 },
+  { "빧", 0.00000000 },
+  { "굣", 0.00000000 },
+  { "뮯", 0.00000000 },
+  { "뀮", 0.00000000 },
+  { "섙", 0.00000000 },
+  { "쌑", 0.00000000 },
+  { "팈", 0.00000000 },
+  { "퐴", 0.00000000 },
+  { "숔", 0.00000000 },
+  { "뎺", 0.00000000 },
+  { "핟", 0.00000000 },
+  { "껇", 0.00000000 },
+  { "틡", 0.00000000 },
+  { "쉧", 0.00000000 },
+  { "뎧", 0.00000000 },
+  { "걯", 0.00000000 },
+  { "괂", 0.00000000 },
+  { "뜑", 0.00000000 },
+  { "즲", 0.00000000 },
+  { "륇", 0.00000000 },
+  { "략", 0.00010000 },
+  { "핊", 0.00000000 },
+  { "헡", 0.00000000 },
+  { "걁", 0.00000000 },
+  { "땼", 0.00000000 },
+  { "믣", 0.00000000 },
+  { "갷", 0.00000000 },
+  { "졃", 0.00000000 },
+  { "퍿", 0.00000000 },
+  { "쎐", 0.00000000 },
+  { "꼃", 0.00000000 },
+  { "눎", 0.00000000 },
+  { "뫝", 0.00000000 },
+  { "힆", 0.00000000 },
+  { "뛔", 0.00000000 },
+  { "륖", 0.00000000 },
+  { "틙", 0.00000000 },
+  { "켸", 0.00000000 },
+  { "씑", 0.00000000 },
+  { "쎒", 0.00000000 },
+  { "비", 0.00310000 },
+  { "데", 0.00210000 },
+  { "첤", 0.00000000 },
+  { "힌", 0.00010000 },
+  { "꺻", 0.00000000 },
+  { "촚", 0.00000000 },
+  { "뾸", 0.00000000 },
+  { "믲", 0.00000000 },
+  { "죛", 0.00000000 },
+  { "갻", 0.00000000 },
+  { "퉨", 0.00000000 },
+  { "쳌", 0.00000000 },
+  { "뱅", 0.00000000 },
+  { "쾧", 0.00000000 },
+  { "뢡", 0.00000000 },
+  { "쐆", 0.00000000 },
+  { "첮", 0.00000000 },
+  { "뾤", 0.00000000 },
+  { "즗", 0.00000000 },
+  { "쬤", 0.00000000 },
+  { "맹", 0.00020000 },
+  { "뗖", 0.00000000 },
+  { "뢅", 0.00000000 },
+  { "낂", 0.00000000 },
+  { "젲", 0.00000000 },
+  { "퐇", 0.00000000 },
+  { "룦", 0.00000000 },
+  { "꼫", 0.00000000 },
+  { "쳄", 0.00000000 },
+  { "듸", 0.00000000 },
+  { "퀮", 0.00000000 },
+  { "훋", 0.00000000 },
+  { "쮍", 0.00000000 },
+  { "웮", 0.00000000 },
+  { "췭", 0.00000000 },
+  { "폸", 0.00000000 },
+  { "뛸", 0.00000000 },
+  { "륃", 0.00000000 },
+  { "쨱", 0.00000000 },
+  { "좧", 0.00000000 },
+  { "텯", 0.00000000 },
+  { "싯", 0.00000000 },
+  { "톛", 0.00000000 },
+  { "픾", 0.00000000 },
+  { "풏", 0.00000000 },
+  { "눴", 0.00000000 },
+  { "큀", 0.00000000 },
+  { "쫄", 0.00000000 },
+  { "낛", 0.00000000 },
+  { "늧", 0.00000000 },
+  { "윚", 0.00000000 },
+  { "욧", 0.00000000 },
+  { "꺗", 0.00000000 },
+  { "읏", 0.00000000 },
+  { "퍳", 0.00000000 },
+  { "쏯", 0.00000000 },
+  { "좣", 0.00000000 },
+  { "햟", 0.00000000 },
+  { "뀜", 0.00000000 },
+  { "먈", 0.00000000 },
+  { "긳", 0.00000000 },
+  { "뢩", 0.00000000 },
+  { "춮", 0.00000000 },
+  { "랱", 0.00000000 },
+  { "뭄", 0.00000000 },
+  { "텬", 0.00000000 },
+  { "땓", 0.00000000 },
+  { "휉", 0.00000000 },
+  { "갋", 0.00000000 },
+  { "랼", 0.00000000 },
+  { "퉞", 0.00000000 },
+  { "꺶", 0.00000000 },
+  { "놝", 0.00000000 },
+  { "턭", 0.00000000 },
+  { "묁", 0.00000000 },
+  { "쐡", 0.00000000 },
+  { "떳", 0.00000000 },
+  { "똀", 0.00000000 },
+  { "쑡", 0.00000000 },
+  { "펨", 0.00000000 },
+  { "확", 0.00050000 },
+  { "먀", 0.00000000 },
+  { "밐", 0.00000000 },
+  { "촞", 0.00000000 },
+  { "먷", 0.00000000 },
+  { "쉀", 0.00000000 },
+  { "풋", 0.00000000 },
+  { "삂", 0.00000000 },
+  { "캼", 0.00000000 },
+  { "얪", 0.00000000 },
+  { "쏶", 0.00000000 },
+  { "끢", 0.00000000 },
+  { "냀", 0.00000000 },
+  { "궷", 0.00000000 },
+  { "댽", 0.00000000 },
+  { "얕", 0.00000000 },
+  { "켣", 0.00000000 },
+  { "솴", 0.00000000 },
+  { "룵", 0.00000000 },
+  { "늳", 0.00000000 },
+  { "췳", 0.00000000 },
+  { "먪", 0.00000000 },
+  { "곘", 0.00000000 },
+  { "춆", 0.00000000 },
+  { "첀", 0.00000000 },
+  { "뜐", 0.00000000 },
+  { "뻴", 0.00000000 },
+  { "근", 0.00070000 },
+  { "뢒", 0.00000000 },
+  { "졹", 0.00000000 },
+  { "픓", 0.00000000 },
+  { "틮", 0.00000000 },
+  { "샚", 0.00000000 },
+  { "뱱", 0.00000000 },
+  { "끍", 0.00000000 },
+  { "붏", 0.00000000 },
+  { "쭪", 0.00000000 },
+  { "휗", 0.00000000 },
+  { "꾯", 0.00000000 },
+  { "삌", 0.00000000 },
+  { "섓", 0.00000000 },
+  { "청", 0.00090000 },
+  { "쑳", 0.00000000 },
+  { "챃", 0.00000000 },
+  { "될", 0.00020000 },
+  { "큋", 0.00000000 },
+  { "꼩", 0.00000000 },
+  { "쏦", 0.00000000 },
+  { "븸", 0.00000000 },
+  { "묓", 0.00000000 },
+  { "웢", 0.00000000 },
+  { "쒃", 0.00000000 },
+  { "퍉", 0.00000000 },
+  { "딧", 0.00000000 },
+  { "띳", 0.00000000 },
+  { "툖", 0.00000000 },
+  { "됧", 0.00000000 },
+  { "밫", 0.00000000 },
+  { "쏞", 0.00000000 },
+  { "튠", 0.00000000 },
+  { "홢", 0.00000000 },
+  { "굕", 0.00000000 },
+  { "껨", 0.00000000 },
+  { "냄", 0.00000000 },
+  { "쩔", 0.00000000 },
+  { "풿", 0.00000000 },
+  { "픑", 0.00000000 },
+  { "쭣", 0.00000000 },
+  { "헅", 0.00000000 },
+  { "땝", 0.00000000 },
+  { "맩", 0.00000000 },
+  { "놢", 0.00000000 },
+  { "반", 0.00190000 },
+  { "뚵", 0.00000000 },
+  { "켧", 0.00000000 },
+  { "댏", 0.00000000 },
+  { "뵭", 0.00000000 },
+  { "쏹", 0.00000000 },
+  { "숋", 0.00000000 },
+  { "룃", 0.00000000 },
+  { "뛿", 0.00000000 },
+  { "턴", 0.00020000 },
+  { "롢", 0.00000000 },
+  { "믠", 0.00000000 },
+  { "훳", 0.00000000 },
+  { "줯", 0.00000000 },
+  { "쌇", 0.00000000 },
+  { "응", 0.00030000 },
+  { "줍", 0.00000000 },
+  { "럚", 0.00000000 },
+  { "딩", 0.00010000 },
+  { "쐄", 0.00000000 },
+  { "첩", 0.00000000 },
+  { "옙", 0.00000000 },
+  { "윦", 0.00000000 },
+  { "낲", 0.00000000 },
+  { "흢", 0.00000000 },
+  { "뛚", 0.00000000 },
+  { "훸", 0.00000000 },
+  { "껵", 0.00000000 },
+  { "챏", 0.00000000 },
+  { "켢", 0.00000000 },
+  { "톋", 0.00000000 },
+  { "꿊", 0.00000000 },
+  { "앝", 0.00000000 },
+  { "눑", 0.00000000 },
+  { "퀟", 0.00000000 },
+  { "큙", 0.00000000 },
+  { "쨠", 0.00000000 },
+  { "붸", 0.00000000 },
+  { "딎", 0.00000000 },
+  { "썮", 0.00000000 },
+  { "짼", 0.00000000 },
+  { "폷", 0.00000000 },
+  { "튄", 0.00000000 },
+  { "툚", 0.00000000 },
+  { "숤", 0.00000000 },
+  { "쿝", 0.00000000 },
+  { "얽", 0.00000000 },
+  { "렵", 0.00010000 },
+  { "퓫", 0.00000000 },
+  { "졌", 0.00050000 },
+  { "뒠", 0.00000000 },
+  { "닥", 0.00010000 },
+  { "엧", 0.00000000 },
+  { "꽔", 0.00000000 },
+  { "젽", 0.00000000 },
+  { "굀", 0.00000000 },
+  { "볤", 0.00000000 },
+  { "읁", 0.00000000 },
+  { "믚", 0.00000000 },
+  { "긄", 0.00000000 },
+  { "즽", 0.00000000 },
+  { "쪌", 0.00000000 },
+  { "덐", 0.00000000 },
+  { "꼙", 0.00000000 },
+  { "뿒", 0.00000000 },
+  { "텗", 0.00000000 },
+  { "콏", 0.00000000 },
+  { "퍘", 0.00000000 },
+  { "쀩", 0.00000000 },
+  { "줲", 0.00000000 },
+  { "잣", 0.00000000 },
+  { "젧", 0.00000000 },
+  { "뭃", 0.00000000 },
+  { "휥", 0.00000000 },
+  { "디", 0.00110000 },
+  { "댢", 0.00000000 },
+  { "촤", 0.00000000 },
+  { "핃", 0.00000000 },
+  { "쿍", 0.00000000 },
+  { "쌡", 0.00000000 },
+  { "꿁", 0.00000000 },
+  { "힅", 0.00000000 },
+  { "쭘", 0.00000000 },
+  { "떍", 0.00000000 },
+  { "궐", 0.00000000 },
+  { "쓯", 0.00000000 },
+  { "싛", 0.00000000 },
+  { "헧", 0.00000000 },
+  { "밢", 0.00000000 },
+  { "횡", 0.00000000 },
+  { "졨", 0.00000000 },
+  { "죘", 0.00000000 },
+  { "붳", 0.00000000 },
+  { "욳", 0.00000000 },
+  { "칗", 0.00000000 },
+  { "똁", 0.00000000 },
+  { "뻆", 0.00000000 },
+  { "컾", 0.00000000 },
+  { "땟", 0.00000000 },
+  { "쵐", 0.00000000 },
+  { "첺", 0.00000000 },
+  { "젓", 0.00000000 },
+  { "헏", 0.00000000 },
+  { "낧", 0.00000000 },
+  { "끞", 0.00000000 },
+  { "켟", 0.00000000 },
+  { "폱", 0.00000000 },
+  { "쟳", 0.00000000 },
+  { "벷", 0.00000000 },
+  { "즜", 0.00000000 },
+  { "찁", 0.00000000 },
+  { "뉟", 0.00000000 },
+  { "섾", 0.00000000 },
+  { "췖", 0.00000000 },
+  { "콢", 0.00000000 },
+  { "미", 0.00310000 },
+  { "캸", 0.00000000 },
+  { "붇", 0.00000000 },
+  { "켓", 0.00010000 },
+  { "녀", 0.00040000 },
+  { "쥁", 0.00000000 },
+  { "왧", 0.00000000 },
+  { "곆", 0.00000000 },
+  { "껩", 0.00000000 },
+  { "존", 0.00060000 },
+  { "킀", 0.00000000 },
+  { "쌈", 0.00000000 },
+  { "뜟", 0.00000000 },
+  { "딟", 0.00000000 },
+  { "믨", 0.00000000 },
+  { "얈", 0.00000000 },
+  { "뭊", 0.00000000 },
+  { "첟", 0.00000000 },
+  { "퍻", 0.00000000 },
+  { "뙎", 0.00000000 },
+  { "괣", 0.00000000 },
+  { "뛷", 0.00000000 },
+  { "뿇", 0.00000000 },
+  { "쏄", 0.00000000 },
+  { "삝", 0.00000000 },
+  { "뺯", 0.00000000 },
+  { "븐", 0.00000000 },
+  { "숌", 0.00000000 },
+  { "띈", 0.00000000 },
+  { "뚍", 0.00000000 },
+  { "눲", 0.00000000 },
+  { "꾔", 0.00000000 },
+  { "네", 0.00080000 },
+  { "맱", 0.00000000 },
+  { "씕", 0.00000000 },
+  { "컀", 0.00000000 },
+  { "댣", 0.00000000 },
+  { "럿", 0.00000000 },
+  { "얹", 0.00000000 },
+  { "퇵", 0.00000000 },
+  { "폕", 0.00000000 },
+  { "왭", 0.00000000 },
+  { "교", 0.00340000 },
+  { "땱", 0.00000000 },
+  { "딻", 0.00000000 },
+  { "뎽", 0.00000000 },
+  { "옆", 0.00000000 },
+  { "괙", 0.00000000 },
+  { "캮", 0.00000000 },
+  { "좶", 0.00000000 },
+  { "캅", 0.00000000 },
+  { "돚", 0.00000000 },
+  { "끂", 0.00000000 },
+  { "핅", 0.00000000 },
+  { "픧", 0.00000000 },
+  { "븍", 0.00000000 },
+  { "홉", 0.00000000 },
+  { "뷿", 0.00000000 },
+  { "얷", 0.00000000 },
+  { "좊", 0.00000000 },
+  { "픭", 0.00000000 },
+  { "롎", 0.00000000 },
+  { "넸", 0.00000000 },
+  { "갪", 0.00000000 },
+  { "띩", 0.00000000 },
+  { "콋", 0.00000000 },
+  { "쾒", 0.00000000 },
+  { "릍", 0.00000000 },
+  { "뜴", 0.00000000 },
+  { "쀐", 0.00000000 },
+  { "쥿", 0.00000000 },
+  { "깬", 0.00000000 },
+  { "뵲", 0.00000000 },
+  { "붆", 0.00000000 },
+  { "둝", 0.00000000 },
+  { "댇", 0.00000000 },
+  { "딛", 0.00000000 },
+  { "꽟", 0.00000000 },
+  { "늓", 0.00000000 },
+  { "긨", 0.00000000 },
+  { "뇼", 0.00000000 },
+  { "띛", 0.00000000 },
+  { "졕", 0.00000000 },
+  { "죶", 0.00000000 },
+  { "쉑", 0.00000000 },
+  { "릶", 0.00000000 },
+  { "줞", 0.00000000 },
+  { "텂", 0.00000000 },
+  { "쨔", 0.00000000 },
+  { "떇", 0.00000000 },
+  { "퍮", 0.00000000 },
+  { "괉", 0.00000000 },
+  { "쏇", 0.00000000 },
+  { "똧", 0.00000000 },
+  { "값", 0.00010000 },
+  { "짜", 0.00010000 },
+  { "웡", 0.00000000 },
+  { "걛", 0.00000000 },
+  { "릸", 0.00000000 },
+  { "뎚", 0.00000000 },
+  { "폑", 0.00000000 },
+  { "딀", 0.00000000 },
+  { "횘", 0.00000000 },
+  { "펖", 0.00000000 },
+  { "쇿", 0.00000000 },
+  { "뤋", 0.00000000 },
+  { "왫", 0.00000000 },
+  { "쒞", 0.00000000 },
+  { "탂", 0.00000000 },
+  { "짙", 0.00000000 },
+  { "껴", 0.00000000 },
+  { "샮", 0.00000000 },
+  { "쪫", 0.00000000 },
+  { "빨", 0.00010000 },
+  { "뿗", 0.00000000 },
+  { "샤", 0.00020000 },
+  { "횓", 0.00000000 },
+  { "셜", 0.00000000 },
+  { "샣", 0.00000000 },
+  { "븼", 0.00000000 },
+  { "냚", 0.00000000 },
+  { "챷", 0.00000000 },
+  { "컪", 0.00000000 },
+  { "눐", 0.00000000 },
+  { "얬", 0.00000000 },
+  { "촣", 0.00000000 },
+  { "젯", 0.00000000 },
+  { "뇝", 0.00000000 },
+  { "긹", 0.00000000 },
+  { "쒤", 0.00000000 },
+  { "콵", 0.00000000 },
+  { "뷠", 0.00000000 },
+  { "툧", 0.00000000 },
+  { "섕", 0.00000000 },
+  { "훕", 0.00000000 },
+  { "믝", 0.00000000 },
+  { "튍", 0.00000000 },
+  { "뜔", 0.00000000 },
+  { "콽", 0.00000000 },
+  { "뗝", 0.00000000 },
+  { "용", 0.00260000 },
+  { "렆", 0.00000000 },
+  { "휼", 0.00000000 },
+  { "좖", 0.00000000 },
+  { "쨡", 0.00000000 },
+  { "봧", 0.00000000 },
+  { "딈", 0.00000000 },
+  { "뀨", 0.00000000 },
+  { "웠", 0.00010000 },
+  { "홾", 0.00000000 },
+  { "계", 0.00290000 },
+  { "옊", 0.00000000 },
+  { "쩈", 0.00000000 },
+  { "띡", 0.00000000 },
+  { "밴", 0.00010000 },
+  { "귥", 0.00000000 },
+  { "쥛", 0.00000000 },
+  { "궆", 0.00000000 },
+  { "땺", 0.00000000 },
+  { "쥦", 0.00000000 },
+  { "랆", 0.00000000 },
+  { "죑", 0.00000000 },
+  { "램", 0.00020000 },
+  { "쥪", 0.00000000 },
+  { "췷", 0.00000000 },
+  { "봽", 0.00000000 },
+  { "렐", 0.00000000 },
+  { "믩", 0.00000000 },
+  { "럷", 0.00000000 },
+  { "쐼", 0.00000000 },
+  { "뎶", 0.00000000 },
+  { "꿎", 0.00000000 },
+  { "듳", 0.00000000 },
+  { "웸", 0.00000000 },
+  { "합", 0.00120000 },
+  { "귵", 0.00000000 },
+  { "됾", 0.00000000 },
+  { "돶", 0.00000000 },
+  { "뗼", 0.00000000 },
+  { "둴", 0.00000000 },
+  { "홳", 0.00000000 },
+  { "릘", 0.00000000 },
+  { "뀊", 0.00000000 },
+  { "폓", 0.00000000 },
+  { "켁", 0.00000000 },
+  { "쏲", 0.00000000 },
+  { "뻞", 0.00000000 },
+  { "럕", 0.00000000 },
+  { "뾉", 0.00000000 },
+  { "궦", 0.00000000 },
+  { "쒏", 0.00000000 },
+  { "덁", 0.00000000 },
+  { "굸", 0.00000000 },
+  { "됇", 0.00000000 },
+  { "헴", 0.00000000 },
+  { "뙮", 0.00000000 },
+  { "뗊", 0.00000000 },
+  { "픣", 0.00000000 },
+  { "멌", 0.00000000 },
+  { "곉", 0.00000000 },
+  { "웭", 0.00000000 },
+  { "맖", 0.00000000 },
+  { "뷄", 0.00000000 },
+  { "쏜", 0.00000000 },
+  { "쐧", 0.00000000 },
+  { "옛", 0.00010000 },
+  { "븿", 0.00000000 },
+  { "퇗", 0.00000000 },
+  { "다", 0.03000000 },
+  { "젥", 0.00000000 },
+  { "섟", 0.00000000 },
+  { "녘", 0.00000000 },
+  { "땩", 0.00000000 },
+  { "뱼", 0.00000000 },
+  { "앃", 0.00000000 },
+  { "쑧", 0.00000000 },
+  { "가", 0.01320000 },
+  { "쓽", 0.00000000 },
+  { "틇", 0.00000000 },
+  { "빦", 0.00000000 },
+  { "톳", 0.00000000 },
+  { "헉", 0.00000000 },
+  { "줗", 0.00000000 },
+  { "칻", 0.00000000 },
+  { "뽊", 0.00000000 },
+  { "줭", 0.00000000 },
+  { "콺", 0.00000000 },
+  { "꽞", 0.00000000 },
+  { "협", 0.00040000 },
+  { "펌", 0.00000000 },
+  { "큆", 0.00000000 },
+  { "툤", 0.00000000 },
+  { "쯛", 0.00000000 },
+  { "삑", 0.00000000 },
+  { "퍆", 0.00000000 },
+  { "삄", 0.00000000 },
+  { "힎", 0.00000000 },
+  { "욭", 0.00000000 },
+  { "뭍", 0.00000000 },
+  { "킁", 0.00000000 },
+  { "뇊", 0.00000000 },
+  { "씬", 0.00000000 },
+  { "윋", 0.00000000 },
+  { "룾", 0.00000000 },
+  { "됡", 0.00000000 },
+  { "뜵", 0.00000000 },
+  { "탆", 0.00000000 },
+  { "괴", 0.00020000 },
+  { "첵", 0.00000000 },
+  { "않", 0.00110000 },
+  { "귳", 0.00000000 },
+  { "썽", 0.00000000 },
+  { "꽘", 0.00000000 },
+  { "챥", 0.00000000 },
+  { "찐", 0.00000000 },
+  { "쎊", 0.00000000 },
+  { "갾", 0.00000000 },
+  { "쩳", 0.00000000 },
+  { "쩘", 0.00000000 },
+  { "꽩", 0.00000000 },
+  { "콁", 0.00000000 },
+  { "축", 0.00060000 },
+  { "괠", 0.00000000 },
+  { "퍯", 0.00000000 },
+  { "뢠", 0.00000000 },
+  { "폞", 0.00000000 },
+  { "냰", 0.00000000 },
+  { "챒", 0.00000000 },
+  { "짬", 0.00000000 },
+  { "얚", 0.00000000 },
+  { "퉿", 0.00000000 },
+  { "쟎", 0.00000000 },
+  { "뀁", 0.00000000 },
+  { "좪", 0.00000000 },
+  { "뤮", 0.00000000 },
+  { "툁", 0.00000000 },
+  { "냵", 0.00000000 },
+  { "듾", 0.00000000 },
+  { "햂", 0.00000000 },
+  { "쓭", 0.00000000 },
+  { "쎙", 0.00000000 },
+  { "휮", 0.00000000 },
+  { "꺭", 0.00000000 },
+  { "끛", 0.00000000 },
+  { "섗", 0.00000000 },
+  { "쇉", 0.00000000 },
+  { "퀑", 0.00000000 },
+  { "뼼", 0.00000000 },
+  { "엣", 0.00000000 },
+  { "슒", 0.00000000 },
+  { "솂", 0.00000000 },
+  { "잂", 0.00000000 },
+  { "꽄", 0.00000000 },
+  { "혨", 0.00000000 },
+  { "폶", 0.00000000 },
+  { "웨", 0.00030000 },
+  { "렡", 0.00000000 },
+  { "묈", 0.00000000 },
+  { "볱", 0.00000000 },
+  { "뇥", 0.00000000 },
+  { "됚", 0.00000000 },
+  { "뢋", 0.00000000 },
+  { "똵", 0.00000000 },
+  { "쌻", 0.00000000 },
+  { "핞", 0.00000000 },
+  { "륅", 0.00000000 },
+  { "빍", 0.00000000 },
+  { "껰", 0.00000000 },
+  { "홠", 0.00000000 },
+  { "퇰", 0.00000000 },
+  { "렁", 0.00000000 },
+  { "켛", 0.00000000 },
+  { "콨", 0.00000000 },
+  { "쾵", 0.00000000 },
+  { "쁕", 0.00000000 },
+  { "둞", 0.00000000 },
+  { "옎", 0.00000000 },
+  { "닑", 0.00000000 },
+  { "띙", 0.00000000 },
+  { "쵸", 0.00000000 },
+  { "혞", 0.00000000 },
+  { "촖", 0.00000000 },
+  { "쎄", 0.00000000 },
+  { "띪", 0.00000000 },
+  { "쓒", 0.00000000 },
+  { "듎", 0.00000000 },
+  { "솙", 0.00000000 },
+  { "넂", 0.00000000 },
+  { "텆", 0.00000000 },
+  { "눠", 0.00000000 },
+  { "툎", 0.00000000 },
+  { "밒", 0.00000000 },
+  { "뾄", 0.00000000 },
+  { "팱", 0.00000000 },
+  { "쁭", 0.00000000 },
+  { "센", 0.00030000 },
+  { "윻", 0.00000000 },
+  { "읶", 0.00000000 },
+  { "넨", 0.00000000 },
+  { "썺", 0.00000000 },
+  { "좵", 0.00000000 },
+  { "뢳", 0.00000000 },
+  { "턆", 0.00000000 },
+  { "헛", 0.00000000 },
+  { "둜", 0.00000000 },
+  { "뇂", 0.00000000 },
+  { "끫", 0.00000000 },
+  { "뫦", 0.00000000 },
+  { "쁁", 0.00000000 },
+  { "욓", 0.00000000 },
+  { "괵", 0.00000000 },
+  { "꺑", 0.00000000 },
+  { "룖", 0.00000000 },
+  { "뉔", 0.00000000 },
+  { "윭", 0.00000000 },
+  { "읜", 0.00000000 },
+  { "쳠", 0.00000000 },
+  { "텫", 0.00000000 },
+  { "껿", 0.00000000 },
+  { "뒱", 0.00000000 },
+  { "뤳", 0.00000000 },
+  { "젛", 0.00000000 },
+  { "랈", 0.00000000 },
+  { "띕", 0.00000000 },
+  { "쀫", 0.00000000 },
+  { "훃", 0.00000000 },
+  { "됨", 0.00010000 },
+  { "뼾", 0.00000000 },
+  { "굋", 0.00000000 },
+  { "픯", 0.00000000 },
+  { "쩒", 0.00000000 },
+  { "돛", 0.00000000 },
+  { "겼", 0.00010000 },
+  { "뵝", 0.00000000 },
+  { "컌", 0.00000000 },
+  { "놜", 0.00000000 },
+  { "좕", 0.00000000 },
+  { "끋", 0.00000000 },
+  { "겔", 0.00000000 },
+  { "늌", 0.00000000 },
+  { "븯", 0.00000000 },
+  { "녋", 0.00000000 },
+  { "방", 0.00230000 },
+  { "퉣", 0.00000000 },
+  { "낉", 0.00000000 },
+  { "퇶", 0.00000000 },
+  { "볃", 0.00000000 },
+  { "림", 0.00050000 },
+  { "뱜", 0.00000000 },
+  { "뭣", 0.00000000 },
+  { "뺟", 0.00000000 },
+  { "꼅", 0.00000000 },
+  { "댊", 0.00000000 },
+  { "뚄", 0.00000000 },
+  { "킗", 0.00000000 },
+  { "낁", 0.00000000 },
+  { "칳", 0.00000000 },
+  { "눆", 0.00000000 },
+  { "뤵", 0.00000000 },
+  { "껧", 0.00000000 },
+  { "뢆", 0.00000000 },
+  { "땶", 0.00000000 },
+  { "꽏", 0.00000000 },
+  { "됄", 0.00000000 },
+  { "뗔", 0.00000000 },
+  { "핓", 0.00000000 },
+  { "믢", 0.00000000 },
+  { "첾", 0.00000000 },
+  { "혺", 0.00000000 },
+  { "칧", 0.00000000 },
+  { "쮚", 0.00000000 },
+  { "먞", 0.00000000 },
+  { "쏼", 0.00000000 },
+  { "쉋", 0.00000000 },
+  { "꿐", 0.00000000 },
+  { "텋", 0.00000000 },
+  { "섦", 0.00000000 },
+  { "뾔", 0.00000000 },
+  { "픳", 0.00000000 },
+  { "뷕", 0.00000000 },
+  { "징", 0.00030000 },
+  { "뽢", 0.00000000 },
+  { "뼮", 0.00000000 },
+  { "꺊", 0.00000000 },
+  { "먲", 0.00000000 },
+  { "뵱", 0.00000000 },
+  { "뾃", 0.00000000 },
+  { "쇂", 0.00000000 },
+  { "뭰", 0.00000000 },
+  { "횞", 0.00000000 },
+  { "띄", 0.00000000 },
+  { "뢻", 0.00000000 },
+  { "얇", 0.00000000 },
+  { "멄", 0.00000000 },
+  { "즴", 0.00000000 },
+  { "쇝", 0.00000000 },
+  { "흮", 0.00000000 },
+  { "유", 0.00310000 },
+  { "틳", 0.00000000 },
+  { "픦", 0.00000000 },
+  { "홲", 0.00000000 },
+  { "쐓", 0.00000000 },
+  { "벵", 0.00000000 },
+  { "넏", 0.00000000 },
+  { "밳", 0.00000000 },
+  { "뾞", 0.00000000 },
+  { "릲", 0.00000000 },
+  { "냏", 0.00000000 },
+  { "녭", 0.00000000 },
+  { "꼾", 0.00000000 },
+  { "톐", 0.00000000 },
+  { "퓉", 0.00000000 },
+  { "쥱", 0.00000000 },
+  { "먆", 0.00000000 },
+  { "섹", 0.00000000 },
+  { "몎", 0.00000000 },
+  { "펹", 0.00000000 },
+  { "풼", 0.00000000 },
+  { "룓", 0.00000000 },
+  { "낌", 0.00000000 },
+  { "홁", 0.00000000 },
+  { "풯", 0.00000000 },
+  { "켶", 0.00000000 },
+  { "곲", 0.00000000 },
+  { "뫁", 0.00000000 },
+  { "뙦", 0.00000000 },
+  { "스", 0.00820000 },
+  { "캲", 0.00000000 },
+  { "퇍", 0.00000000 },
+  { "뤜", 0.00000000 },
+  { "멉", 0.00000000 },
+  { "쩆", 0.00000000 },
+  { "샷", 0.00000000 },
+  { "쩅", 0.00000000 },
+  { "뮚", 0.00000000 },
+  { "봕", 0.00000000 },
+  { "큑", 0.00000000 },
+  { "뗟", 0.00000000 },
+  { "뗲", 0.00000000 },
+  { "컫", 0.00000000 },
+  { "궕", 0.00000000 },
+  { "췟", 0.00000000 },
+  { "머", 0.00050000 },
+  { "납", 0.00010000 },
+  { "엖", 0.00000000 },
+  { "늗", 0.00000000 },
+  { "컸", 0.00000000 },
+  { "뫋", 0.00000000 },
+  { "뀗", 0.00000000 },
+  { "섢", 0.00000000 },
+  { "믅", 0.00000000 },
+  { "뀘", 0.00000000 },
+  { "읠", 0.00000000 },
+  { "촄", 0.00000000 },
+  { "젫", 0.00000000 },
+  { "큌", 0.00000000 },
+  { "쬮", 0.00000000 },
+  { "쎞", 0.00000000 },
+  { "춤", 0.00000000 },
+  { "얾", 0.00000000 },
+  { "츁", 0.00000000 },
+  { "떯", 0.00000000 },
+  { "앰", 0.00000000 },
+  { "뇒", 0.00000000 },
+  { "툉", 0.00000000 },
+  { "췽", 0.00000000 },
+  { "흟", 0.00000000 },
+  { "쌍", 0.00010000 },
+  { "냓", 0.00000000 },
+  { "졜", 0.00000000 },
+  { "쮕", 0.00000000 },
+  { "뚽", 0.00000000 },
+  { "뵬", 0.00000000 },
+  { "촠", 0.00000000 },
+  { "잘", 0.00020000 },
+  { "퓺", 0.00000000 },
+  { "휳", 0.00000000 },
+  { "룚", 0.00000000 },
+  { "벤", 0.00010000 },
+  { "껓", 0.00000000 },
+  { "뤶", 0.00000000 },
+  { "쵫", 0.00000000 },
+  { "폭", 0.00030000 },
+  { "궏", 0.00000000 },
+  { "킒", 0.00000000 },
+  { "륛", 0.00000000 },
+  { "턐", 0.00000000 },
+  { "닞", 0.00000000 },
+  { "뀶", 0.00000000 },
+  { "뼅", 0.00000000 },
+  { "폇", 0.00000000 },
+  { "삈", 0.00000000 },
+  { "셋", 0.00000000 },
+  { "얦", 0.00000000 },
+  { "굗", 0.00000000 },
+  { "쇟", 0.00000000 },
+  { "쓖", 0.00000000 },
+  { "괕", 0.00000000 },
+  { "싶", 0.00000000 },
+  { "흙", 0.00000000 },
+  { "굆", 0.00000000 },
+  { "꼆", 0.00000000 },
+  { "뜫", 0.00000000 },
+  { "렏", 0.00000000 },
+  { "퍝", 0.00000000 },
+  { "똦", 0.00000000 },
+  { "햐", 0.00000000 },
+  { "쮆", 0.00000000 },
+  { "재", 0.00230000 },
+  { "뚆", 0.00000000 },
+  { "괄", 0.00000000 },
+  { "뭸", 0.00000000 },
+  { "붃", 0.00000000 },
+  { "닭", 0.00000000 },
+  { "커", 0.00030000 },
+  { "퐲", 0.00000000 },
+  { "든", 0.00050000 },
+  { "퍵", 0.00000000 },
+  { "뵘", 0.00000000 },
+  { "홣", 0.00000000 },
+  { "럵", 0.00000000 },
+  { "쁗", 0.00000000 },
+  { "섑", 0.00000000 },
+  { "션", 0.00040000 },
+  { "꽫", 0.00000000 },
+  { "뮺", 0.00000000 },
+  { "띞", 0.00000000 },
+  { "킨", 0.00020000 },
+  { "뜚", 0.00000000 },
+  { "즙", 0.00000000 },
+  { "쎡", 0.00000000 },
+  { "딂", 0.00000000 },
+  { "똓", 0.00000000 },
+  { "걕", 0.00000000 },
+  { "욛", 0.00000000 },
+  { "훎", 0.00000000 },
+  { "앚", 0.00000000 },
+  { "졊", 0.00000000 },
+  { "츆", 0.00000000 },
+  { "쾯", 0.00000000 },
+  { "퍊", 0.00000000 },
+  { "우", 0.00310000 },
+  { "헢", 0.00000000 },
+  { "뽐", 0.00000000 },
+  { "에", 0.02520000 },
+  { "잨", 0.00000000 },
+  { "붚", 0.00000000 },
+  { "걆", 0.00000000 },
+  { "롛", 0.00000000 },
+  { "쳑", 0.00000000 },
+  { "췂", 0.00000000 },
+  { "랂", 0.00000000 },
+  { "뾚", 0.00000000 },
+  { "혯", 0.00000000 },
+  { "띠", 0.00000000 },
+  { "꽊", 0.00000000 },
+  { "귣", 0.00000000 },
+  { "딠", 0.00000000 },
+  { "죵", 0.00000000 },
+  { "굨", 0.00000000 },
+  { "칮", 0.00000000 },
+  { "뉱", 0.00000000 },
+  { "쑉", 0.00000000 },
+  { "댓", 0.00000000 },
+  { "낔", 0.00000000 },
+  { "멇", 0.00000000 },
+  { "옣", 0.00000000 },
+  { "즉", 0.00020000 },
+  { "띨", 0.00000000 },
+  { "띷", 0.00000000 },
+  { "똌", 0.00000000 },
+  { "엾", 0.00000000 },
+  { "겶", 0.00000000 },
+  { "좻", 0.00000000 },
+  { "쑭", 0.00000000 },
+  { "튢", 0.00000000 },
+  { "뫡", 0.00000000 },
+  { "횈", 0.00000000 },
+  { "쒂", 0.00000000 },
+  { "릊", 0.00000000 },
+  { "읉", 0.00000000 },
+  { "줂", 0.00000000 },
+  { "귓", 0.00000000 },
+  { "쉱", 0.00000000 },
+  { "앫", 0.00000000 },
+  { "쀓", 0.00000000 },
+  { "쩭", 0.00000000 },
+  { "듛", 0.00000000 },
+  { "읻", 0.00000000 },
+  { "줳", 0.00000000 },
+  { "뗫", 0.00000000 },
+  { "욖", 0.00000000 },
+  { "앓", 0.00000000 },
+  { "턟", 0.00000000 },
+  { "쮠", 0.00000000 },
+  { "쀕", 0.00000000 },
+  { "찞", 0.00000000 },
+  { "쭒", 0.00000000 },
+  { "특", 0.00090000 },
+  { "팳", 0.00000000 },
+  { "퇠", 0.00000000 },
+  { "햝", 0.00000000 },
+  { "줆", 0.00000000 },
+  { "픪", 0.00000000 },
+  { "룹", 0.00020000 },
+  { "꽳", 0.00000000 },
+  { "햏", 0.00000000 },
+  { "푠", 0.00000000 },
+  { "븊", 0.00000000 },
+  { "킓", 0.00000000 },
+  { "뷭", 0.00000000 },
+  { "것", 0.00260000 },
+  { "랗", 0.00000000 },
+  { "픞", 0.00000000 },
+  { "멺", 0.00000000 },
+  { "쇀", 0.00000000 },
+  { "퓚", 0.00000000 },
+  { "굹", 0.00000000 },
+  { "봄", 0.00000000 },
+  { "킋", 0.00000000 },
+  { "뚖", 0.00000000 },
+  { "퇈", 0.00000000 },
+  { "숫", 0.00000000 },
+  { "컢", 0.00000000 },
+  { "엫", 0.00000000 },
+  { "물", 0.00160000 },
+  { "쒗", 0.00000000 },
+  { "횾", 0.00000000 },
+  { "뚋", 0.00000000 },
+  { "웩", 0.00000000 },
+  { "식", 0.00170000 },
+  { "잉", 0.00010000 },
+  { "욼", 0.00000000 },
+  { "킥", 0.00000000 },
+  { "롂", 0.00000000 },
+  { "뽏", 0.00000000 },
+  { "뮷", 0.00000000 },
+  { "혾", 0.00000000 },
+  { "쨛", 0.00000000 },
+  { "힞", 0.00000000 },
+  { "럲", 0.00000000 },
+  { "놤", 0.00000000 },
+  { "얥", 0.00000000 },
+  { "줦", 0.00000000 },
+  { "풂", 0.00000000 },
+  { "땹", 0.00000000 },
+  { "퍕", 0.00000000 },
+  { "옂", 0.00000000 },
+  { "줜", 0.00000000 },
+  { "뤠", 0.00000000 },
+  { "쪊", 0.00000000 },
+  { "땭", 0.00000000 },
+  { "냼", 0.00000000 },
+  { "퍋", 0.00000000 },
+  { "뽰", 0.00000000 },
+  { "덬", 0.00000000 },
+  { "톫", 0.00000000 },
+  { "슽", 0.00000000 },
+  { "춁", 0.00000000 },
+  { "츊", 0.00000000 },
+  { "녠", 0.00000000 },
+  { "떟", 0.00000000 },
+  { "삠", 0.00000000 },
+  { "꾷", 0.00000000 },
+  { "즼", 0.00000000 },
+  { "텞", 0.00000000 },
+  { "믒", 0.00000000 },
+  { "딮", 0.00000000 },
+  { "뜋", 0.00000000 },
+  { "쁡", 0.00000000 },
+  { "삫", 0.00000000 },
+  { "퓱", 0.00000000 },
+  { "뢲", 0.00000000 },
+  { "곿", 0.00000000 },
+  { "녍", 0.00000000 },
+  { "텒", 0.00000000 },
+  { "띯", 0.00000000 },
+  { "꿀", 0.00000000 },
+  { "엯", 0.00000000 },
+  { "둉", 0.00000000 },
+  { "웈", 0.00000000 },
+  { "퀞", 0.00000000 },
+  { "듪", 0.00000000 },
+  { "꼡", 0.00000000 },
+  { "꿑", 0.00000000 },
+  { "껂", 0.00000000 },
+  { "홚", 0.00000000 },
+  { "묉", 0.00000000 },
+  { "냷", 0.00000000 },
+  { "꾢", 0.00000000 },
+  { "똥", 0.00000000 },
+  { "샊", 0.00000000 },
+  { "쎧", 0.00000000 },
+  { "턿", 0.00000000 },
+  { "폆", 0.00000000 },
+  { "헂", 0.00000000 },
+  { "됑", 0.00000000 },
+  { "쨩", 0.00000000 },
+  { "뚱", 0.00000000 },
+  { "뱗", 0.00000000 },
+  { "낪", 0.00000000 },
+  { "펞", 0.00000000 },
+  { "됯", 0.00000000 },
+  { "뙋", 0.00000000 },
+  { "훛", 0.00000000 },
+  { "뤔", 0.00000000 },
+  { "쎯", 0.00000000 },
+  { "쁌", 0.00000000 },
+  { "쨜", 0.00000000 },
+  { "둓", 0.00000000 },
+  { "솋", 0.00000000 },
+  { "듀", 0.00010000 },
+  { "튂", 0.00000000 },
+  { "찵", 0.00000000 },
+  { "뾌", 0.00000000 },
+  { "휓", 0.00000000 },
+  { "닊", 0.00000000 },
+  { "뗚", 0.00000000 },
+  { "뚌", 0.00000000 },
+  { "편", 0.00090000 },
+  { "촪", 0.00000000 },
+  { "칊", 0.00000000 },
+  { "호", 0.00170000 },
+  { "첅", 0.00000000 },
+  { "킬", 0.00010000 },
+  { "꾘", 0.00000000 },
+  { "틧", 0.00000000 },
+  { "챐", 0.00000000 },
+  { "딏", 0.00000000 },
+  { "뛌", 0.00000000 },
+  { "챵", 0.00000000 },
+  { "퐑", 0.00000000 },
+  { "쟟", 0.00000000 },
+  { "홥", 0.00000000 },
+  { "맇", 0.00000000 },
+  { "풜", 0.00000000 },
+  { "뷌", 0.00000000 },
+  { "돈", 0.00010000 },
+  { "쭴", 0.00000000 },
+  { "풴", 0.00000000 },
+  { "봛", 0.00000000 },
+  { "꽭", 0.00000000 },
+  { "뗦", 0.00000000 },
+  { "얻", 0.00020000 },
+  { "췐", 0.00000000 },
+  { "닾", 0.00000000 },
+  { "툄", 0.00000000 },
+  { "틣", 0.00000000 },
+  { "닖", 0.00000000 },
+  { "녌", 0.00000000 },
+  { "왜", 0.00010000 },
+  { "섽", 0.00000000 },
+  { "퇻", 0.00000000 },
+  { "쁀", 0.00000000 },
+  { "잭", 0.00000000 },
+  { "켩", 0.00000000 },
+  { "꽢", 0.00000000 },
+  { "린", 0.00080000 },
+  { "좗", 0.00000000 },
+  { "녾", 0.00000000 },
+  { "캉", 0.00000000 },
+  { "눦", 0.00000000 },
+  { "뢨", 0.00000000 },
+  { "웛", 0.00000000 },
+  { "갂", 0.00000000 },
+  { "쬡", 0.00000000 },
+  { "쒋", 0.00000000 },
+  { "헀", 0.00000000 },
+  { "겋", 0.00000000 },
+  { "춋", 0.00000000 },
+  { "쇨", 0.00000000 },
+  { "튆", 0.00000000 },
+  { "롵", 0.00000000 },
+  { "쫕", 0.00000000 },
+  { "쀔", 0.00000000 },
+  { "뒟", 0.00000000 },
+  { "숟", 0.00000000 },
+  { "쨟", 0.00000000 },
+  { "렫", 0.00000000 },
+  { "뷍", 0.00000000 },
+  { "탲", 0.00000000 },
+  { "츂", 0.00000000 },
+  { "즥", 0.00000000 },
+  { "깢", 0.00000000 },
+  { "묻", 0.00000000 },
+  { "뺺", 0.00000000 },
+  { "쇭", 0.00000000 },
+  { "뒔", 0.00000000 },
+  { "퀡", 0.00000000 },
+  { "궫", 0.00000000 },
+  { "쬓", 0.00000000 },
+  { "줠", 0.00000000 },
+  { "밝", 0.00020000 },
+  { "뺀", 0.00000000 },
+  { "쬦", 0.00000000 },
+  { "횸", 0.00000000 },
+  { "쵽", 0.00000000 },
+  { "릻", 0.00000000 },
+  { "붱", 0.00000000 },
+  { "웾", 0.00000000 },
+  { "찺", 0.00000000 },
+  { "쟿", 0.00000000 },
+  { "뾍", 0.00000000 },
+  { "얋", 0.00000000 },
+  { "졗", 0.00000000 },
+  { "쳍", 0.00000000 },
+  { "뢷", 0.00000000 },
+  { "녫", 0.00000000 },
+  { "끱", 0.00000000 },
+  { "멐", 0.00000000 },
+  { "붾", 0.00000000 },
+  { "통", 0.00200000 },
+  { "퓧", 0.00000000 },
+  { "봀", 0.00000000 },
+  { "졸", 0.00020000 },
+  { "눿", 0.00000000 },
+  { "굅", 0.00000000 },
+  { "훿", 0.00000000 },
+  { "쉛", 0.00000000 },
+  { "씣", 0.00000000 },
+  { "쓎", 0.00000000 },
+  { "찀", 0.00000000 },
+  { "놖", 0.00000000 },
+  { "퐚", 0.00000000 },
+  { "픵", 0.00000000 },
+  { "쉎", 0.00000000 },
+  { "쒚", 0.00000000 },
+  { "뚊", 0.00000000 },
+  { "뽖", 0.00000000 },
+  { "킢", 0.00000000 },
+  { "쨤", 0.00000000 },
+  { "롊", 0.00000000 },
+  { "쎩", 0.00000000 },
+  { "랃", 0.00000000 },
+  { "샍", 0.00000000 },
+  { "궠", 0.00000000 },
+  { "먛", 0.00000000 },
+  { "꺙", 0.00000000 },
+  { "귄", 0.00000000 },
+  { "첨", 0.00000000 },
+  { "쵂", 0.00000000 },
+  { "뀱", 0.00000000 },
+  { "뛠", 0.00000000 },
+  { "텘", 0.00000000 },
+  { "숢", 0.00000000 },
+  { "뤓", 0.00000000 },
+  { "셣", 0.00000000 },
+  { "퉺", 0.00000000 },
+  { "삥", 0.00000000 },
+  { "껀", 0.00000000 },
+  { "뵒", 0.00000000 },
+  { "갆", 0.00000000 },
+  { "곈", 0.00000000 },
+  { "뚐", 0.00000000 },
+  { "씼", 0.00000000 },
+  { "혻", 0.00000000 },
+  { "폌", 0.00000000 },
+  { "릀", 0.00000000 },
+  { "칅", 0.00000000 },
+  { "뿪", 0.00000000 },
+  { "솗", 0.00000000 },
+  { "흶", 0.00000000 },
+  { "티", 0.00090000 },
+  { "뀐", 0.00000000 },
+  { "솜", 0.00000000 },
+  { "슸", 0.00000000 },
+  { "윾", 0.00000000 },
+  { "뻓", 0.00000000 },
+  { "맼", 0.00000000 },
+  { "쨌", 0.00000000 },
+  { "퍶", 0.00000000 },
+  { "뙿", 0.00000000 },
+  { "꽣", 0.00000000 },
+  { "찛", 0.00000000 },
+  { "킺", 0.00000000 },
+  { "궚", 0.00000000 },
+  { "떩", 0.00000000 },
+  { "쨎", 0.00000000 },
+  { "뜈", 0.00000000 },
+  { "뫢", 0.00000000 },
+  { "쟥", 0.00000000 },
+  { "웒", 0.00000000 },
+  { "긠", 0.00000000 },
+  { "풘", 0.00000000 },
+  { "윀", 0.00000000 },
+  { "뼜", 0.00000000 },
+  { "깙", 0.00000000 },
+  { "샄", 0.00000000 },
+  { "툴", 0.00000000 },
+  { "쎲", 0.00000000 },
+  { "뎤", 0.00000000 },
+  { "쎘", 0.00000000 },
+  { "폘", 0.00000000 },
+  { "폗", 0.00000000 },
+  { "붟", 0.00000000 },
+  { "뤝", 0.00000000 },
+  { "굴", 0.00010000 },
+  { "톏", 0.00000000 },
+  { "덖", 0.00000000 },
+  { "뭺", 0.00000000 },
+  { "욹", 0.00000000 },
+  { "찮", 0.00000000 },
+  { "꼑", 0.00000000 },
+  { "쁋", 0.00000000 },
+  { "솀", 0.00000000 },
+  { "땻", 0.00000000 },
+  { "멙", 0.00000000 },
+  { "딐", 0.00000000 },
+  { "뎯", 0.00000000 },
+  { "붂", 0.00000000 },
+  { "뚢", 0.00000000 },
+  { "결", 0.00150000 },
+  { "벗", 0.00000000 },
+  { "뺾", 0.00000000 },
+  { "묬", 0.00000000 },
+  { "믳", 0.00000000 },
+  { "헃", 0.00000000 },
+  { "겍", 0.00000000 },
+  { "뼟", 0.00000000 },
+  { "젡", 0.00000000 },
+  { "뢢", 0.00000000 },
+  { "깿", 0.00000000 },
+  { "뀆", 0.00000000 },
+  { "팼", 0.00000000 },
+  { "흈", 0.00000000 },
+  { "뇇", 0.00000000 },
+  { "뻑", 0.00000000 },
+  { "혍", 0.00000000 },
+  { "븰", 0.00000000 },
+  { "름", 0.00080000 },
+  { "뷙", 0.00000000 },
+  { "됬", 0.00000000 },
+  { "땊", 0.00000000 },
+  { "룇", 0.00000000 },
+  { "쩩", 0.00000000 },
+  { "햮", 0.00000000 },
+  { "풁", 0.00000000 },
+  { "똚", 0.00000000 },
+  { "틘", 0.00000000 },
+  { "녴", 0.00000000 },
+  { "뱂", 0.00000000 },
+  { "눁", 0.00000000 },
+  { "롞", 0.00000000 },
+  { "쀾", 0.00000000 },
+  { "쬒", 0.00000000 },
+  { "탉", 0.00000000 },
+  { "풔", 0.00000000 },
+  { "옢", 0.00000000 },
+  { "쩫", 0.00000000 },
+  { "뻏", 0.00000000 },
+  { "촂", 0.00000000 },
+  { "쿂", 0.00000000 },
+  { "쟕", 0.00000000 },
+  { "햃", 0.00000000 },
+  { "덾", 0.00000000 },
+  { "닚", 0.00000000 },
+  { "솶", 0.00000000 },
+  { "꺄", 0.00000000 },
+  { "덡", 0.00000000 },
+  { "뇈", 0.00000000 },
+  { "줴", 0.00000000 },
+  { "퐨", 0.00000000 },
+  { "척", 0.00010000 },
+  { "붦", 0.00000000 },
+  { "꿮", 0.00000000 },
+  { "셭", 0.00000000 },
+  { "뢟", 0.00000000 },
+  { "뢞", 0.00000000 },
+  { "잽", 0.00000000 },
+  { "튷", 0.00000000 },
+  { "뀑", 0.00000000 },
+  { "눌", 0.00000000 },
+  { "솾", 0.00000000 },
+  { "슘", 0.00000000 },
+  { "뺫", 0.00000000 },
+  { "쓴", 0.00010000 },
+  { "뗞", 0.00000000 },
+  { "뤒", 0.00000000 },
+  { "쁏", 0.00000000 },
+  { "슟", 0.00000000 },
+  { "뚥", 0.00000000 },
+  { "혊", 0.00000000 },
+  { "컎", 0.00000000 },
+  { "쳯", 0.00000000 },
+  { "꽹", 0.00000000 },
+  { "붗", 0.00000000 },
+  { "푾", 0.00000000 },
+  { "침", 0.00030000 },
+  { "젗", 0.00000000 },
+  { "냆", 0.00000000 },
+  { "퇬", 0.00000000 },
+  { "삧", 0.00000000 },
+  { "숅", 0.00000000 },
+  { "뫟", 0.00000000 },
+  { "슃", 0.00000000 },
+  { "뚓", 0.00000000 },
+  { "셨", 0.00000000 },
+  { "썅", 0.00000000 },
+  { "뱾", 0.00000000 },
+  { "혷", 0.00000000 },
+  { "쓑", 0.00000000 },
+  { "먊", 0.00000000 },
+  { "쭙", 0.00000000 },
+  { "쇙", 0.00000000 },
+  { "뀺", 0.00000000 },
+  { "툷", 0.00000000 },
+  { "횻", 0.00000000 },
+  { "땑", 0.00000000 },
+  { "짪", 0.00000000 },
+  { "쁴", 0.00000000 },
+  { "숖", 0.00000000 },
+  { "렓", 0.00000000 },
+  { "퀂", 0.00000000 },
+  { "멡", 0.00000000 },
+  { "쯼", 0.00000000 },
+  { "곃", 0.00000000 },
+  { "슄", 0.00000000 },
+  { "퀪", 0.00000000 },
+  { "쑼", 0.00000000 },
+  { "뉃", 0.00000000 },
+  { "폄", 0.00000000 },
+  { "쵿", 0.00000000 },
+  { "넻", 0.00000000 },
+  { "쓰", 0.00060000 },
+  { "뉗", 0.00000000 },
+  { "믉", 0.00000000 },
+  { "닝", 0.00010000 },
+  { "쀺", 0.00000000 },
+  { "묫", 0.00000000 },
+  { "럗", 0.00000000 },
+  { "신", 0.00310000 },
+  { "틺", 0.00000000 },
+  { "쓐", 0.00000000 },
+  { "쐍", 0.00000000 },
+  { "컟", 0.00000000 },
+  { "좦", 0.00000000 },
+  { "퐫", 0.00000000 },
+  { "뿹", 0.00000000 },
+  { "열", 0.00090000 },
+  { "쩥", 0.00000000 },
+  { "챝", 0.00000000 },
+  { "쐢", 0.00000000 },
+  { "뱥", 0.00000000 },
+  { "꽧", 0.00000000 },
+  { "푂", 0.00000000 },
+  { "뤬", 0.00000000 },
+  { "햙", 0.00000000 },
+  { "쬊", 0.00000000 },
+  { "얛", 0.00000000 },
+  { "풸", 0.00000000 },
+  { "듊", 0.00000000 },
+  { "믭", 0.00000000 },
+  { "켻", 0.00000000 },
+  { "퉩", 0.00000000 },
+  { "닯", 0.00000000 },
+  { "죬", 0.00000000 },
+  { "쮂", 0.00000000 },
+  { "땯", 0.00000000 },
+  { "긇", 0.00000000 },
+  { "꼣", 0.00000000 },
+  { "넉", 0.00000000 },
+  { "휅", 0.00000000 },
+  { "똨", 0.00000000 },
+  { "봻", 0.00000000 },
+  { "괱", 0.00000000 },
+  { "뙵", 0.00000000 },
+  { "꺦", 0.00000000 },
+  { "망", 0.00050000 },
+  { "놾", 0.00000000 },
+  { "꽌", 0.00000000 },
+  { "팮", 0.00000000 },
+  { "홒", 0.00000000 },
+  { "뱞", 0.00000000 },
+  { "죧", 0.00000000 },
+  { "싍", 0.00000000 },
+  { "켪", 0.00000000 },
+  { "쩽", 0.00000000 },
+  { "툌", 0.00000000 },
+  { "딲", 0.00000000 },
+  { "넁", 0.00000000 },
+  { "깖", 0.00000000 },
+  { "욍", 0.00000000 },
+  { "봦", 0.00000000 },
+  { "썬", 0.00000000 },
+  { "삚", 0.00000000 },
+  { "멮", 0.00000000 },
+  { "풆", 0.00000000 },
+  { "뭗", 0.00000000 },
+  { "횶", 0.00000000 },
+  { "춀", 0.00000000 },
+  { "텻", 0.00000000 },
+  { "멾", 0.00000000 },
+  { "뗅", 0.00000000 },
+  { "쪰", 0.00000000 },
+  { "휶", 0.00000000 },
+  { "뵕", 0.00000000 },
+  { "삵", 0.00000000 },
+  { "멳", 0.00000000 },
+  { "킭", 0.00000000 },
+  { "턺", 0.00000000 },
+  { "퀃", 0.00000000 },
+  { "픿", 0.00000000 },
+  { "퐖", 0.00000000 },
+  { "픛", 0.00000000 },
+  { "똝", 0.00000000 },
+  { "뾩", 0.00000000 },
+  { "뛩", 0.00000000 },
+  { "뗪", 0.00000000 },
+  { "쒄", 0.00000000 },
+  { "쨊", 0.00000000 },
+  { "졠", 0.00000000 },
+  { "륒", 0.00000000 },
+  { "핛", 0.00000000 },
+  { "쫘", 0.00000000 },
+  { "쒼", 0.00000000 },
+  { "즮", 0.00000000 },
+  { "쇁", 0.00000000 },
+  { "힏", 0.00000000 },
+  { "쀼", 0.00000000 },
+  { "슯", 0.00000000 },
+  { "쭥", 0.00000000 },
+  { "둆", 0.00000000 },
+  { "쵷", 0.00000000 },
+  { "힢", 0.00000000 },
+  { "쟗", 0.00000000 },
+  { "색", 0.00050000 },
+  { "쫥", 0.00000000 },
+  { "콯", 0.00000000 },
+  { "츤", 0.00000000 },
+  { "샧", 0.00000000 },
+  { "죨", 0.00000000 },
+  { "왺", 0.00000000 },
+  { "뼤", 0.00000000 },
+  { "먰", 0.00000000 },
+  { "뗀", 0.00000000 },
+  { "궻", 0.00000000 },
+  { "롹", 0.00000000 },
+  { "찄", 0.00000000 },
+  { "덅", 0.00000000 },
+  { "첦", 0.00000000 },
+  { "귃", 0.00000000 },
+  { "뙼", 0.00000000 },
+  { "책", 0.00040000 },
+  { "봺", 0.00000000 },
+  { "쇶", 0.00000000 },
+  { "퀵", 0.00000000 },
+  { "뾂", 0.00000000 },
+  { "엲", 0.00000000 },
+  { "홆", 0.00000000 },
+  { "뗸", 0.00000000 },
+  { "뭱", 0.00000000 },
+  { "꼥", 0.00000000 },
+  { "툇", 0.00000000 },
+  { "튙", 0.00000000 },
+  { "즬", 0.00000000 },
+  { "읱", 0.00000000 },
+  { "햣", 0.00000000 },
+  { "뇱", 0.00000000 },
+  { "쁸", 0.00000000 },
+  { "귅", 0.00000000 },
+  { "뇐", 0.00000000 },
+  { "턝", 0.00000000 },
+  { "쀽", 0.00000000 },
+  { "홰", 0.00000000 },
+  { "됩", 0.00000000 },
+  { "샢", 0.00000000 },
+  { "놂", 0.00000000 },
+  { "뼷", 0.00000000 },
+  { "헷", 0.00000000 },
+  { "븨", 0.00000000 },
+  { "즠", 0.00000000 },
+  { "봮", 0.00000000 },
+  { "귀", 0.00030000 },
+  { "뺼", 0.00000000 },
+  { "힠", 0.00000000 },
+  { "쥍", 0.00000000 },
+  { "국", 0.00610000 },
+  { "튤", 0.00000000 },
+  { "겲", 0.00000000 },
+  { "룅", 0.00000000 },
+  { "쉹", 0.00000000 },
+  { "꾑", 0.00000000 },
+  { "긑", 0.00000000 },
+  { "썼", 0.00010000 },
+  { "졧", 0.00000000 },
+  { "죪", 0.00000000 },
+  { "즣", 0.00000000 },
+  { "쀙", 0.00000000 },
+  { "꿖", 0.00000000 },
+  { "팰", 0.00000000 },
+  { "옟", 0.00000000 },
+  { "썘", 0.00000000 },
+  { "퍾", 0.00000000 },
+  { "쉙", 0.00000000 },
+  { "꾠", 0.00000000 },
+  { "둽", 0.00000000 },
+  { "젉", 0.00000000 },
+  { "깅", 0.00000000 },
+  { "쌿", 0.00000000 },
+  { "쑟", 0.00000000 },
+  { "앖", 0.00000000 },
+  { "칁", 0.00000000 },
+  { "툿", 0.00000000 },
+  { "요", 0.00160000 },
+  { "뢙", 0.00000000 },
+  { "렉", 0.00010000 },
+  { "뺥", 0.00000000 },
+  { "쀞", 0.00000000 },
+  { "묨", 0.00000000 },
+  { "듔", 0.00000000 },
+  { "밤", 0.00010000 },
+  { "꺳", 0.00000000 },
+  { "캀", 0.00000000 },
+  { "릹", 0.00000000 },
+  { "뒈", 0.00000000 },
+  { "뷔", 0.00020000 },
+  { "금", 0.00090000 },
+  { "팲", 0.00000000 },
+  { "앍", 0.00000000 },
+  { "떈", 0.00000000 },
+  { "붭", 0.00000000 },
+  { "꾾", 0.00000000 },
+  { "봚", 0.00000000 },
+  { "틀", 0.00030000 },
+  { "옩", 0.00000000 },
+  { "쨧", 0.00000000 },
+  { "쁃", 0.00000000 },
+  { "죡", 0.00000000 },
+  { "랄", 0.00000000 },
+  { "쳴", 0.00000000 },
+  { "쭚", 0.00000000 },
+  { "놗", 0.00000000 },
+  { "쳰", 0.00000000 },
+  { "뀙", 0.00000000 },
+  { "킆", 0.00000000 },
+  { "톹", 0.00000000 },
+  { "뎗", 0.00000000 },
+  { "굦", 0.00000000 },
+  { "괺", 0.00000000 },
+  { "뛞", 0.00000000 },
+  { "셍", 0.00000000 },
+  { "렜", 0.00000000 },
+  { "즭", 0.00000000 },
+  { "쯨", 0.00000000 },
+  { "볰", 0.00000000 },
+  { "깉", 0.00000000 },
+  { "뙆", 0.00000000 },
+  { "턠", 0.00000000 },
+  { "샯", 0.00000000 },
+  { "욟", 0.00000000 },
+  { "웱", 0.00000000 },
+  { "묧", 0.00000000 },
+  { "삯", 0.00000000 },
+  { "뙇", 0.00000000 },
+  { "껟", 0.00000000 },
+  { "곤", 0.00010000 },
+  { "큺", 0.00000000 },
+  { "쇋", 0.00000000 },
+  { "풩", 0.00000000 },
+  { "욑", 0.00000000 },
+  { "뤾", 0.00000000 },
+  { "혼", 0.00040000 },
+  { "륬", 0.00000000 },
+  { "긭", 0.00000000 },
+  { "궧", 0.00000000 },
+  { "큗", 0.00000000 },
+  { "휋", 0.00000000 },
+  { "쬐", 0.00000000 },
+  { "돪", 0.00000000 },
+  { "왂", 0.00000000 },
+  { "뇨", 0.00000000 },
+  { "잆", 0.00000000 },
+  { "됛", 0.00000000 },
+  { "췋", 0.00000000 },
+  { "꺀", 0.00000000 },
+  { "샓", 0.00000000 },
+  { "죎", 0.00000000 },
+  { "슣", 0.00000000 },
+  { "흣", 0.00000000 },
+  { "췦", 0.00000000 },
+  { "댯", 0.00000000 },
+  { "썑", 0.00000000 },
+  { "믹", 0.00000000 },
+  { "똍", 0.00000000 },
+  { "쵃", 0.00000000 },
+  { "뿂", 0.00000000 },
+  { "뱪", 0.00000000 },
+  { "꾗", 0.00000000 },
+  { "볐", 0.00000000 },
+  { "푧", 0.00000000 },
+  { "윘", 0.00000000 },
+  { "섭", 0.00010000 },
+  { "뫧", 0.00000000 },
+  { "쨺", 0.00000000 },
+  { "릮", 0.00000000 },
+  { "쎽", 0.00000000 },
+  { "훴", 0.00000000 },
+  { "촏", 0.00000000 },
+  { "꾟", 0.00000000 },
+  { "넽", 0.00000000 },
+  { "륋", 0.00000000 },
+  { "쓗", 0.00000000 },
+  { "큹", 0.00000000 },
+  { "섅", 0.00000000 },
+  { "갗", 0.00000000 },
+  { "홈", 0.00010000 },
+  { "쁮", 0.00000000 },
+  { "셯", 0.00000000 },
+  { "긗", 0.00000000 },
+  { "춑", 0.00000000 },
+  { "걗", 0.00000000 },
+  { "셙", 0.00000000 },
+  { "캾", 0.00000000 },
+  { "꽅", 0.00000000 },
+  { "꾇", 0.00000000 },
+  { "쟮", 0.00000000 },
+  { "덣", 0.00000000 },
+  { "쯘", 0.00000000 },
+  { "홤", 0.00000000 },
+  { "숿", 0.00000000 },
+  { "췰", 0.00000000 },
+  { "쐸", 0.00000000 },
+  { "뾵", 0.00000000 },
+  { "푖", 0.00000000 },
+  { "룲", 0.00000000 },
+  { "멸", 0.00010000 },
+  { "뺙", 0.00000000 },
+  { "쳇", 0.00000000 },
+  { "쬣", 0.00000000 },
+  { "솓", 0.00000000 },
+  { "깘", 0.00000000 },
+  { "덩", 0.00000000 },
+  { "냎", 0.00000000 },
+  { "딿", 0.00000000 },
+  { "츙", 0.00000000 },
+  { "텷", 0.00000000 },
+  { "냜", 0.00000000 },
+  { "쀛", 0.00000000 },
+  { "뫫", 0.00000000 },
+  { "겫", 0.00000000 },
+  { "돧", 0.00000000 },
+  { "쁥", 0.00000000 },
+  { "쇇", 0.00000000 },
+  { "톭", 0.00000000 },
+  { "쭽", 0.00000000 },
+  { "녃", 0.00000000 },
+  { "뱔", 0.00000000 },
+  { "튧", 0.00000000 },
+  { "뎘", 0.00000000 },
+  { "됉", 0.00000000 },
+  { "쏘", 0.00000000 },
+  { "핝", 0.00000000 },
+  { "왒", 0.00000000 },
+  { "됏", 0.00000000 },
+  { "쩄", 0.00000000 },
+  { "뷱", 0.00000000 },
+  { "싳", 0.00000000 },
+  { "뵡", 0.00000000 },
+  { "똠", 0.00000000 },
+  { "곥", 0.00000000 },
+  { "덴", 0.00020000 },
+  { "벛", 0.00000000 },
+  { "괶", 0.00000000 },
+  { "춞", 0.00000000 },
+  { "뾛", 0.00000000 },
+  { "쏡", 0.00000000 },
+  { "렽", 0.00000000 },
+  { "륥", 0.00000000 },
+  { "챰", 0.00000000 },
+  { "툠", 0.00000000 },
+  { "킱", 0.00000000 },
+  { "쿙", 0.00000000 },
+  { "컼", 0.00000000 },
+  { "둢", 0.00000000 },
+  { "욃", 0.00000000 },
+  { "뾾", 0.00000000 },
+  { "쑬", 0.00000000 },
+  { "볎", 0.00000000 },
+  { "긮", 0.00000000 },
+  { "뉮", 0.00000000 },
+  { "걃", 0.00000000 },
+  { "춨", 0.00000000 },
+  { "췗", 0.00000000 },
+  { "찭", 0.00000000 },
+  { "먃", 0.00000000 },
+  { "옺", 0.00000000 },
+  { "뻇", 0.00000000 },
+  { "풕", 0.00000000 },
+  { "묑", 0.00000000 },
+  { "쬩", 0.00000000 },
+  { "퇯", 0.00000000 },
+  { "덒", 0.00000000 },
+  { "떁", 0.00000000 },
+  { "띣", 0.00000000 },
+  { "랠", 0.00000000 },
+  { "쬉", 0.00000000 },
+  { "뙰", 0.00000000 },
+  { "틋", 0.00000000 },
+  { "툪", 0.00000000 },
+  { "쌵", 0.00000000 },
+  { "뺂", 0.00000000 },
+  { "질", 0.00070000 },
+  { "쐋", 0.00000000 },
+  { "촬", 0.00000000 },
+  { "졷", 0.00000000 },
+  { "텶", 0.00000000 },
+  { "닡", 0.00000000 },
+  { "밬", 0.00000000 },
+  { "짞", 0.00000000 },
+  { "괛", 0.00000000 },
+  { "휊", 0.00000000 },
+  { "몍", 0.00000000 },
+  { "꿹", 0.00000000 },
+  { "싖", 0.00000000 },
+  { "뼌", 0.00000000 },
+  { "쳱", 0.00000000 },
+  { "잒", 0.00000000 },
+  { "뺈", 0.00000000 },
+  { "뼯", 0.00000000 },
+  { "쭵", 0.00000000 },
+  { "쎾", 0.00000000 },
+  { "푍", 0.00000000 },
+  { "쩢", 0.00000000 },
+  { "잚", 0.00000000 },
+  { "볙", 0.00000000 },
+  { "춰", 0.00000000 },
+  { "펧", 0.00000000 },
+  { "뜢", 0.00000000 },
+  { "쿥", 0.00000000 },
+  { "엠", 0.00000000 },
+  { "삲", 0.00000000 },
+  { "읲", 0.00000000 },
+  { "뾎", 0.00000000 },
+  { "팪", 0.00000000 },
+  { "갽", 0.00000000 },
+  { "쁵", 0.00000000 },
+  { "텪", 0.00000000 },
+  { "딝", 0.00000000 },
+  { "뜁", 0.00000000 },
+  { "탌", 0.00000000 },
+  { "꽋", 0.00000000 },
+  { "귧", 0.00000000 },
+  { "쓕", 0.00000000 },
+  { "흕", 0.00000000 },
+  { "뜧", 0.00000000 },
+  { "깑", 0.00000000 },
+  { "뒽", 0.00000000 },
+  { "톑", 0.00000000 },
+  { "끐", 0.00000000 },
+  { "뮓", 0.00000000 },
+  { "쭯", 0.00000000 },
+  { "쥙", 0.00000000 },
+  { "냦", 0.00000000 },
+  { "볬", 0.00000000 },
+  { "푐", 0.00000000 },
+  { "붩", 0.00000000 },
+  { "췈", 0.00000000 },
+  { "쭐", 0.00000000 },
+  { "퓾", 0.00000000 },
+  { "콞", 0.00000000 },
+  { "셑", 0.00000000 },
+  { "칈", 0.00000000 },
+  { "쎢", 0.00000000 },
+  { "췮", 0.00000000 },
+  { "홪", 0.00000000 },
+  { "릋", 0.00000000 },
+  { "웿", 0.00000000 },
+  { "쭬", 0.00000000 },
+  { "햋", 0.00000000 },
+  { "뭀", 0.00000000 },
+  { "몀", 0.00000000 },
+  { "츕", 0.00000000 },
+  { "뿩", 0.00000000 },
+  { "꽒", 0.00000000 },
+  { "뜼", 0.00000000 },
+  { "녔", 0.00000000 },
+  { "섰", 0.00000000 },
+  { "묦", 0.00000000 },
+  { "붼", 0.00000000 },
+  { "썕", 0.00000000 },
+  { "툰", 0.00000000 },
+  { "됃", 0.00000000 },
+  { "힘", 0.00020000 },
+  { "씺", 0.00000000 },
+  { "떚", 0.00000000 },
+  { "휣", 0.00000000 },
+  { "겷", 0.00000000 },
+  { "톶", 0.00000000 },
+  { "쎃", 0.00000000 },
+  { "맑", 0.00000000 },
+  { "넹", 0.00000000 },
+  { "믂", 0.00000000 },
+  { "븤", 0.00000000 },
+  { "믙", 0.00000000 },
+  { "즶", 0.00000000 },
+  { "갉", 0.00000000 },
+  { "긃", 0.00000000 },
+  { "뵃", 0.00000000 },
+  { "퓃", 0.00000000 },
+  { "밦", 0.00000000 },
+  { "챊", 0.00000000 },
+  { "뫃", 0.00000000 },
+  { "숳", 0.00000000 },
+  { "졁", 0.00000000 },
+  { "뚗", 0.00000000 },
+  { "혩", 0.00000000 },
+  { "졮", 0.00000000 },
+  { "뇘", 0.00000000 },
+  { "촀", 0.00000000 },
+  { "튕", 0.00000000 },
+  { "뜡", 0.00000000 },
+  { "맶", 0.00000000 },
+  { "닁", 0.00000000 },
+  { "쭍", 0.00000000 },
+  { "촡", 0.00000000 },
+  { "됶", 0.00000000 },
+  { "콚", 0.00000000 },
+  { "쥤", 0.00000000 },
+  { "곀", 0.00000000 },
+  { "캍", 0.00000000 },
+  { "촮", 0.00000000 },
+  { "헊", 0.00000000 },
+  { "홼", 0.00000000 },
+  { "죣", 0.00000000 },
+  { "뾢", 0.00000000 },
+  { "닟", 0.00000000 },
+  { "퇒", 0.00000000 },
+  { "틭", 0.00000000 },
+  { "겸", 0.00010000 },
+  { "괮", 0.00000000 },
+  { "췬", 0.00000000 },
+  { "뜻", 0.00020000 },
+  { "횽", 0.00000000 },
+  { "쵺", 0.00000000 },
+  { "뿞", 0.00000000 },
+  { "뇤", 0.00000000 },
+  { "떞", 0.00000000 },
+  { "묢", 0.00000000 },
+  { "캂", 0.00000000 },
+  { "쒧", 0.00000000 },
+  { "쿴", 0.00000000 },
+  { "퀌", 0.00000000 },
+  { "킛", 0.00000000 },
+  { "풇", 0.00000000 },
+  { "혃", 0.00000000 },
+  { "콑", 0.00000000 },
+  { "괜", 0.00000000 },
+  { "뮲", 0.00000000 },
+  { "맫", 0.00000000 },
+  { "쏿", 0.00000000 },
+  { "쳐", 0.00040000 },
+  { "귲", 0.00000000 },
+  { "젞", 0.00000000 },
+  { "쀥", 0.00000000 },
+  { "접", 0.00050000 },
+  { "줓", 0.00000000 },
+  { "빤", 0.00000000 },
+  { "꽦", 0.00000000 },
+  { "깯", 0.00000000 },
+  { "욀", 0.00000000 },
+  { "꾧", 0.00000000 },
+  { "븽", 0.00000000 },
+  { "쒘", 0.00000000 },
+  { "뒆", 0.00000000 },
+  { "튿", 0.00000000 },
+  { "쯖", 0.00000000 },
+  { "뚫", 0.00000000 },
+  { "뙜", 0.00000000 },
+  { "묝", 0.00000000 },
+  { "앤", 0.00010000 },
+  { "퍓", 0.00000000 },
+  { "폋", 0.00000000 },
+  { "퍌", 0.00000000 },
+  { "펈", 0.00000000 },
+  { "뙖", 0.00000000 },
+  { "욶", 0.00000000 },
+  { "훩", 0.00000000 },
+  { "졉", 0.00000000 },
+  { "꺠", 0.00000000 },
+  { "뫶", 0.00000000 },
+  { "뭐", 0.00000000 },
+  { "쑔", 0.00000000 },
+  { "블", 0.00030000 },
+  { "퀗", 0.00000000 },
+  { "왙", 0.00000000 },
+  { "쫟", 0.00000000 },
+  { "껕", 0.00000000 },
+  { "앺", 0.00000000 },
+  { "포", 0.00180000 },
+  { "푲", 0.00000000 },
+  { "헿", 0.00000000 },
+  { "앩", 0.00000000 },
+  { "죿", 0.00000000 },
+  { "붠", 0.00000000 },
+  { "쒖", 0.00000000 },
+  { "륫", 0.00000000 },
+  { "숄", 0.00000000 },
+  { "뿁", 0.00000000 },
+  { "쁪", 0.00000000 },
+  { "죄", 0.00010000 },
+  { "퇭", 0.00000000 },
+  { "쁒", 0.00000000 },
+  { "쿮", 0.00000000 },
+  { "슇", 0.00000000 },
+  { "얌", 0.00000000 },
+  { "케", 0.00050000 },
+  { "쾺", 0.00000000 },
+  { "샇", 0.00000000 },
+  { "툝", 0.00000000 },
+  { "뚒", 0.00000000 },
+  { "턋", 0.00000000 },
+  { "벨", 0.00020000 },
+  { "냶", 0.00000000 },
+  { "섨", 0.00000000 },
+  { "쟐", 0.00000000 },
+  { "쐠", 0.00000000 },
+  { "됺", 0.00000000 },
+  { "핌", 0.00000000 },
+  { "댝", 0.00000000 },
+  { "눸", 0.00000000 },
+  { "렀", 0.00010000 },
+  { "뾮", 0.00000000 },
+  { "퓈", 0.00000000 },
+  { "딼", 0.00000000 },
+  { "앇", 0.00000000 },
+  { "똅", 0.00000000 },
+  { "갤", 0.00000000 },
+  { "홽", 0.00000000 },
+  { "댎", 0.00000000 },
+  { "쟅", 0.00000000 },
+  { "쵎", 0.00000000 },
+  { "뀈", 0.00000000 },
+  { "푪", 0.00000000 },
+  { "뛯", 0.00000000 },
+  { "쏙", 0.00000000 },
+  { "튝", 0.00000000 },
+  { "렼", 0.00000000 },
+  { "펜", 0.00010000 },
+  { "킄", 0.00000000 },
+  { "쩟", 0.00000000 },
+  { "곭", 0.00000000 },
+  { "꼷", 0.00000000 },
+  { "볻", 0.00000000 },
+  { "툨", 0.00000000 },
+  { "쎷", 0.00000000 },
+  { "냭", 0.00000000 },
+  { "툍", 0.00000000 },
+  { "촭", 0.00000000 },
+  { "카", 0.00190000 },
+  { "탙", 0.00000000 },
+  { "땳", 0.00000000 },
+  { "씟", 0.00000000 },
+  { "꺃", 0.00000000 },
+  { "뵯", 0.00000000 },
+  { "광", 0.00080000 },
+  { "뫅", 0.00000000 },
+  { "롯", 0.00020000 },
+  { "뢶", 0.00000000 },
+  { "낝", 0.00000000 },
+  { "귞", 0.00000000 },
+  { "닔", 0.00000000 },
+  { "촒", 0.00000000 },
+  { "펗", 0.00000000 },
+  { "혁", 0.00030000 },
+  { "믱", 0.00000000 },
+  { "뇢", 0.00000000 },
+  { "덞", 0.00000000 },
+  { "싙", 0.00000000 },
+  { "떋", 0.00000000 },
+  { "쵳", 0.00000000 },
+  { "삨", 0.00000000 },
+  { "쓅", 0.00000000 },
+  { "틗", 0.00000000 },
+  { "겹", 0.00000000 },
+  { "꾕", 0.00000000 },
+  { "퍥", 0.00000000 },
+  { "뮫", 0.00000000 },
+  { "흗", 0.00000000 },
+  { "싥", 0.00000000 },
+  { "봜", 0.00000000 },
+  { "쮰", 0.00000000 },
+  { "짔", 0.00000000 },
+  { "빻", 0.00000000 },
+  { "쵚", 0.00000000 },
+  { "쥲", 0.00000000 },
+  { "꾵", 0.00000000 },
+  { "눯", 0.00000000 },
+  { "덦", 0.00000000 },
+  { "쉊", 0.00000000 },
+  { "횐", 0.00000000 },
+  { "있", 0.00700000 },
+  { "풅", 0.00000000 },
+  { "킾", 0.00000000 },
+  { "밻", 0.00000000 },
+  { "빓", 0.00000000 },
+  { "휭", 0.00000000 },
+  { "꼴", 0.00000000 },
+  { "뿊", 0.00000000 },
+  { "똼", 0.00000000 },
+  { "꺝", 0.00000000 },
+  { "녶", 0.00000000 },
+  { "욘", 0.00000000 },
+  { "볉", 0.00000000 },
+  { "쨥", 0.00000000 },
+  { "뉨", 0.00000000 },
+  { "쿠", 0.00060000 },
+  { "굮", 0.00000000 },
+  { "팟", 0.00000000 },
+  { "쟍", 0.00000000 },
+  { "괻", 0.00000000 },
+  { "먹", 0.00010000 },
+  { "웻", 0.00000000 },
+  { "뢿", 0.00000000 },
+  { "벆", 0.00000000 },
+  { "뵣", 0.00000000 },
+  { "뭂", 0.00000000 },
+  { "쮽", 0.00000000 },
+  { "욣", 0.00000000 },
+  { "낽", 0.00000000 },
+  { "쭊", 0.00000000 },
+  { "흲", 0.00000000 },
+  { "쑌", 0.00000000 },
+  { "쿊", 0.00000000 },
+  { "돃", 0.00000000 },
+  { "젬", 0.00000000 },
+  { "똪", 0.00000000 },
+  { "륝", 0.00000000 },
+  { "쪟", 0.00000000 },
+  { "환", 0.00060000 },
+  { "꽃", 0.00010000 },
+  { "뉊", 0.00000000 },
+  { "룱", 0.00000000 },
+  { "럝", 0.00000000 },
+  { "푣", 0.00000000 },
+  { "쵱", 0.00000000 },
+  { "뭻", 0.00000000 },
+  { "쀭", 0.00000000 },
+  { "꽤", 0.00000000 },
+  { "쬻", 0.00000000 },
+  { "언", 0.00080000 },
+  { "외", 0.00090000 },
+  { "읊", 0.00000000 },
+  { "죷", 0.00000000 },
+  { "몺", 0.00000000 },
+  { "첎", 0.00000000 },
+  { "칚", 0.00000000 },
+  { "끈", 0.00000000 },
+  { "쎿", 0.00000000 },
+  { "텰", 0.00000000 },
+  { "뼍", 0.00000000 },
+  { "퉝", 0.00000000 },
+  { "놱", 0.00000000 },
+  { "땎", 0.00000000 },
+  { "꾰", 0.00000000 },
+  { "종", 0.00170000 },
+  { "뢚", 0.00000000 },
+  { "홋", 0.00000000 },
+  { "섪", 0.00000000 },
+  { "촱", 0.00000000 },
+  { "툀", 0.00000000 },
+  { "쫎", 0.00000000 },
+  { "뒏", 0.00000000 },
+  { "덹", 0.00000000 },
+  { "쾠", 0.00000000 },
+  { "볳", 0.00000000 },
+  { "끴", 0.00000000 },
+  { "묙", 0.00000000 },
+  { "놭", 0.00000000 },
+  { "꾨", 0.00000000 },
+  { "긁", 0.00000000 },
+  { "쀄", 0.00000000 },
+  { "훱", 0.00000000 },
+  { "뢯", 0.00000000 },
+  { "섺", 0.00000000 },
+  { "챑", 0.00000000 },
+  { "꿔", 0.00000000 },
+  { "뙢", 0.00000000 },
+  { "괗", 0.00000000 },
+  { "됕", 0.00000000 },
+  { "습", 0.00030000 },
+  { "틥", 0.00000000 },
+  { "뀝", 0.00000000 },
+  { "즑", 0.00000000 },
+  { "먦", 0.00000000 },
+  { "졛", 0.00000000 },
+  { "뎪", 0.00000000 },
+  { "쮧", 0.00000000 },
+  { "쀨", 0.00000000 },
+  { "벧", 0.00000000 },
+  { "땣", 0.00000000 },
+  { "첢", 0.00000000 },
+  { "쟧", 0.00000000 },
+  { "캁", 0.00000000 },
+  { "뭏", 0.00000000 },
+  { "닅", 0.00000000 },
+  { "뇧", 0.00000000 },
+  { "렇", 0.00010000 },
+  { "랑", 0.00070000 },
+  { "깟", 0.00000000 },
+  { "섔", 0.00000000 },
+  { "깓", 0.00000000 },
+  { "쪦", 0.00000000 },
+  { "뱉", 0.00000000 },
+  { "삍", 0.00000000 },
+  { "룮", 0.00000000 },
+  { "츏", 0.00000000 },
+  { "뜽", 0.00000000 },
+  { "뚡", 0.00000000 },
+  { "푦", 0.00000000 },
+  { "룕", 0.00000000 },
+  { "뮆", 0.00000000 },
+  { "얧", 0.00000000 },
+  { "퓽", 0.00000000 },
+  { "퇸", 0.00000000 },
+  { "츪", 0.00000000 },
+  { "햊", 0.00000000 },
+  { "먢", 0.00000000 },
+  { "끹", 0.00000000 },
+  { "눅", 0.00000000 },
+  { "팾", 0.00000000 },
+  { "쥅", 0.00000000 },
+  { "훭", 0.00000000 },
+  { "뗏", 0.00000000 },
+  { "댰", 0.00000000 },
+  { "억", 0.00020000 },
+  { "믦", 0.00000000 },
+  { "묰", 0.00000000 },
+  { "빴", 0.00000000 },
+  { "쬆", 0.00000000 },
+  { "뙄", 0.00000000 },
+  { "탢", 0.00000000 },
+  { "타", 0.00220000 },
+  { "휦", 0.00000000 },
+  { "퉇", 0.00000000 },
+  { "깜", 0.00000000 },
+  { "끘", 0.00000000 },
+  { "큿", 0.00000000 },
+  { "짋", 0.00000000 },
+  { "묔", 0.00000000 },
+  { "튪", 0.00000000 },
+  { "먶", 0.00000000 },
+  { "꼌", 0.00000000 },
+  { "풚", 0.00000000 },
+  { "뉶", 0.00000000 },
+  { "샀", 0.00000000 },
+  { "햁", 0.00000000 },
+  { "낡", 0.00000000 },
+  { "깼", 0.00000000 },
+  { "먡", 0.00000000 },
+  { "쯶", 0.00000000 },
+  { "꿙", 0.00000000 },
+  { "눪", 0.00000000 },
+  { "늭", 0.00000000 },
+  { "쏧", 0.00000000 },
+  { "풳", 0.00000000 },
+  { "뜎", 0.00000000 },
+  { "붨", 0.00000000 },
+  { "뒪", 0.00000000 },
+  { "츲", 0.00000000 },
+  { "뼴", 0.00000000 },
+  { "믃", 0.00000000 },
+  { "췿", 0.00000000 },
+  { "턎", 0.00000000 },
+  { "브", 0.00080000 },
+  { "뺧", 0.00000000 },
+  { "쪐", 0.00000000 },
+  { "쥝", 0.00000000 },
+  { "핯", 0.00000000 },
+  { "쥄", 0.00000000 },
+  { "슖", 0.00000000 },
+  { "찟", 0.00000000 },
+  { "쇒", 0.00000000 },
+  { "늑", 0.00000000 },
+  { "몭", 0.00000000 },
+  { "뒹", 0.00000000 },
+  { "뱿", 0.00000000 },
+  { "셲", 0.00000000 },
+  { "쇐", 0.00000000 },
+  { "눼", 0.00000000 },
+  { "쐣", 0.00000000 },
+  { "걐", 0.00000000 },
+  { "뉻", 0.00000000 },
+  { "뇿", 0.00000000 },
+  { "뛕", 0.00000000 },
+  { "옔", 0.00000000 },
+  { "쇞", 0.00000000 },
+  { "텕", 0.00000000 },
+  { "몔", 0.00000000 },
+  { "횀", 0.00000000 },
+  { "뱷", 0.00000000 },
+  { "쮾", 0.00000000 },
+  { "쫚", 0.00000000 },
+  { "뚇", 0.00000000 },
+  { "뢈", 0.00000000 },
+  { "뤰", 0.00000000 },
+  { "찜", 0.00000000 },
+  { "걔", 0.00000000 },
+  { "꼭", 0.00000000 },
+  { "띒", 0.00000000 },
+  { "빾", 0.00000000 },
+  { "뺁", 0.00000000 },
+  { "삜", 0.00000000 },
+  { "몥", 0.00000000 },
+  { "캹", 0.00000000 },
+  { "슏", 0.00000000 },
+  { "싮", 0.00000000 },
+  { "뭶", 0.00000000 },
+  { "괡", 0.00000000 },
+  { "볶", 0.00000000 },
+  { "뽤", 0.00000000 },
+  { "쩾", 0.00000000 },
+  { "싾", 0.00000000 },
+  { "쬴", 0.00000000 },
+  { "뫄", 0.00000000 },
+  { "쮿", 0.00000000 },
+  { "퍄", 0.00000000 },
+  { "긲", 0.00000000 },
+  { "햯", 0.00000000 },
+  { "토", 0.00140000 },
+  { "뷩", 0.00000000 },
+  { "봘", 0.00000000 },
+  { "힐", 0.00000000 },
+  { "떖", 0.00000000 },
+  { "첛", 0.00000000 },
+  { "쵁", 0.00000000 },
+  { "쑈", 0.00000000 },
+  { "뎱", 0.00000000 },
+  { "꺽", 0.00000000 },
+  { "둘", 0.00020000 },
+  { "얿", 0.00000000 },
+  { "텎", 0.00000000 },
+  { "늩", 0.00000000 },
+  { "회", 0.00280000 },
+  { "봱", 0.00000000 },
+  { "읣", 0.00000000 },
+  { "퉢", 0.00000000 },
+  { "찲", 0.00000000 },
+  { "쪴", 0.00000000 },
+  { "북", 0.00090000 },
+  { "뻎", 0.00000000 },
+  { "켕", 0.00000000 },
+  { "변", 0.00070000 },
+  { "쿆", 0.00000000 },
+  { "퀢", 0.00000000 },
+  { "흏", 0.00000000 },
+  { "큮", 0.00000000 },
+  { "녊", 0.00000000 },
+  { "뀄", 0.00000000 },
+  { "켞", 0.00000000 },
+  { "퍡", 0.00000000 },
+  { "쫾", 0.00000000 },
+  { "틉", 0.00000000 },
+  { "쒻", 0.00000000 },
+  { "죹", 0.00000000 },
+  { "췄", 0.00000000 },
+  { "쨄", 0.00000000 },
+  { "퇌", 0.00000000 },
+  { "뻘", 0.00000000 },
+  { "렸", 0.00030000 },
+  { "뵺", 0.00000000 },
+  { "웬", 0.00000000 },
+  { "됪", 0.00000000 },
+  { "뢱", 0.00000000 },
+  { "팋", 0.00000000 },
+  { "간", 0.00200000 },
+  { "흂", 0.00000000 },
+  { "쭜", 0.00000000 },
+  { "굡", 0.00000000 },
+  { "걚", 0.00000000 },
+  { "땀", 0.00000000 },
+  { "룿", 0.00000000 },
+  { "썯", 0.00000000 },
+  { "픝", 0.00000000 },
+  { "톬", 0.00000000 },
+  { "쭱", 0.00000000 },
+  { "펄", 0.00000000 },
+  { "쑵", 0.00000000 },
+  { "뻼", 0.00000000 },
+  { "천", 0.00100000 },
+  { "꿩", 0.00000000 },
+  { "뾷", 0.00000000 },
+  { "랭", 0.00010000 },
+  { "띁", 0.00000000 },
+  { "팀", 0.00050000 },
+  { "풻", 0.00000000 },
+  { "뽆", 0.00000000 },
+  { "픇", 0.00000000 },
+  { "쮼", 0.00000000 },
+  { "돌", 0.00050000 },
+  { "쀟", 0.00000000 },
+  { "췹", 0.00000000 },
+  { "류", 0.00070000 },
+  { "섄", 0.00000000 },
+  { "컶", 0.00000000 },
+  { "낟", 0.00000000 },
+  { "헜", 0.00000000 },
+  { "뢮", 0.00000000 },
+  { "샂", 0.00000000 },
+  { "쨮", 0.00000000 },
+  { "숒", 0.00000000 },
+  { "솤", 0.00000000 },
+  { "횭", 0.00000000 },
+  { "쏃", 0.00000000 },
+  { "깣", 0.00000000 },
+  { "땪", 0.00000000 },
+  { "봝", 0.00000000 },
+  { "듂", 0.00000000 },
+  { "쉗", 0.00000000 },
+  { "괏", 0.00000000 },
+  { "겥", 0.00000000 },
+  { "뾝", 0.00000000 },
+  { "띿", 0.00000000 },
+  { "쵖", 0.00000000 },
+  { "댋", 0.00000000 },
+  { "슧", 0.00000000 },
+  { "촃", 0.00000000 },
+  { "동", 0.00440000 },
+  { "륮", 0.00000000 },
+  { "쌽", 0.00000000 },
+  { "짴", 0.00000000 },
+  { "퀁", 0.00000000 },
+  { "붓", 0.00000000 },
+  { "꼚", 0.00000000 },
+  { "귬", 0.00000000 },
+  { "뀕", 0.00000000 },
+  { "쐳", 0.00000000 },
+  { "롺", 0.00000000 },
+  { "좹", 0.00000000 },
+  { "팖", 0.00000000 },
+  { "톣", 0.00000000 },
+  { "쮎", 0.00000000 },
+  { "곚", 0.00000000 },
+  { "뚕", 0.00000000 },
+  { "궘", 0.00000000 },
+  { "텽", 0.00000000 },
+  { "짏", 0.00000000 },
+  { "긕", 0.00000000 },
+  { "훈", 0.00020000 },
+  { "낚", 0.00000000 },
+  { "똑", 0.00000000 },
+  { "쨹", 0.00000000 },
+  { "몶", 0.00000000 },
+  { "킅", 0.00000000 },
+  { "쁯", 0.00000000 },
+  { "실", 0.00160000 },
+  { "졡", 0.00000000 },
+  { "쒐", 0.00000000 },
+  { "뽇", 0.00000000 },
+  { "횁", 0.00000000 },
+  { "뎐", 0.00000000 },
+  { "뻯", 0.00000000 },
+  { "씳", 0.00000000 },
+  { "쪡", 0.00000000 },
+  { "튒", 0.00000000 },
+  { "퓄", 0.00000000 },
+  { "흒", 0.00000000 },
+  { "뉪", 0.00000000 },
+  { "롑", 0.00000000 },
+  { "쁙", 0.00000000 },
+  { "짨", 0.00000000 },
+  { "믋", 0.00000000 },
+  { "쁜", 0.00000000 },
+  { "캕", 0.00000000 },
+  { "햹", 0.00000000 },
+  { "쇑", 0.00000000 },
+  { "놼", 0.00000000 },
+  { "띇", 0.00000000 },
+  { "쯒", 0.00000000 },
+  { "폙", 0.00000000 },
+  { "퓌", 0.00000000 },
+  { "댡", 0.00000000 },
+  { "셬", 0.00000000 },
+  { "쌣", 0.00000000 },
+  { "쏽", 0.00000000 },
+  { "뮒", 0.00000000 },
+  { "벇", 0.00000000 },
+  { "읒", 0.00000000 },
+  { "률", 0.00020000 },
+  { "큪", 0.00000000 },
+  { "솱", 0.00000000 },
+  { "뺬", 0.00000000 },
+  { "맭", 0.00000000 },
+  { "쓞", 0.00000000 },
+  { "웵", 0.00000000 },
+  { "켭", 0.00000000 },
+  { "챨", 0.00000000 },
+  { "메", 0.00100000 },
+  { "쓋", 0.00000000 },
+  { "솰", 0.00000000 },
+  { "픗", 0.00000000 },
+  { "킫", 0.00000000 },
+  { "쑻", 0.00000000 },
+  { "첬", 0.00000000 },
+  { "퀄", 0.00000000 },
+  { "얮", 0.00000000 },
+  { "쟝", 0.00000000 },
+  { "췠", 0.00000000 },
+  { "퇂", 0.00000000 },
+  { "퍩", 0.00000000 },
+  { "멨", 0.00000000 },
+  { "웟", 0.00000000 },
+  { "궳", 0.00000000 },
+  { "휏", 0.00000000 },
+  { "늍", 0.00000000 },
+  { "퉐", 0.00000000 },
+  { "텭", 0.00000000 },
+  { "뒌", 0.00000000 },
+  { "쯥", 0.00000000 },
+  { "뻣", 0.00000000 },
+  { "몢", 0.00000000 },
+  { "듒", 0.00000000 },
+  { "옗", 0.00000000 },
+  { "픬", 0.00000000 },
+  { "즱", 0.00000000 },
+  { "쥣", 0.00000000 },
+  { "껃", 0.00000000 },
+  { "쑢", 0.00000000 },
+  { "듟", 0.00000000 },
+  { "퐈", 0.00000000 },
+  { "챼", 0.00000000 },
+  { "컧", 0.00000000 },
+  { "쒡", 0.00000000 },
+  { "샹", 0.00000000 },
+  { "퇀", 0.00000000 },
+  { "콈", 0.00000000 },
+  { "돡", 0.00000000 },
+  { "썆", 0.00000000 },
+  { "슼", 0.00000000 },
+  { "룬", 0.00010000 },
+  { "듏", 0.00000000 },
+  { "썹", 0.00000000 },
+  { "렭", 0.00000000 },
+  { "뀭", 0.00000000 },
+  { "왌", 0.00000000 },
+  { "팝", 0.00000000 },
+  { "뗬", 0.00000000 },
+  { "싵", 0.00000000 },
+  { "뻨", 0.00000000 },
+  { "꼇", 0.00000000 },
+  { "쓮", 0.00000000 },
+  { "필", 0.00050000 },
+  { "뢖", 0.00000000 },
+  { "쀷", 0.00000000 },
+  { "츾", 0.00000000 },
+  { "퀼", 0.00000000 },
+  { "뼉", 0.00000000 },
+  { "둳", 0.00000000 },
+  { "쯅", 0.00000000 },
+  { "끵", 0.00000000 },
+  { "뼠", 0.00000000 },
+  { "켇", 0.00000000 },
+  { "궥", 0.00000000 },
+  { "건", 0.00120000 },
+  { "쭝", 0.00000000 },
+  { "왚", 0.00000000 },
+  { "쥢", 0.00000000 },
+  { "쿪", 0.00000000 },
+  { "쇬", 0.00000000 },
+  { "앏", 0.00000000 },
+  { "늸", 0.00000000 },
+  { "쫈", 0.00000000 },
+  { "탤", 0.00000000 },
+  { "긷", 0.00000000 },
+  { "쌄", 0.00000000 },
+  { "쯝", 0.00000000 },
+  { "곜", 0.00000000 },
+  { "몾", 0.00000000 },
+  { "쁱", 0.00000000 },
+  { "례", 0.00030000 },
+  { "쭂", 0.00000000 },
+  { "옏", 0.00000000 },
+  { "쥯", 0.00000000 },
+  { "뷹", 0.00000000 },
+  { "퍇", 0.00000000 },
+  { "쩺", 0.00000000 },
+  { "괆", 0.00000000 },
+  { "짛", 0.00000000 },
+  { "짇", 0.00000000 },
+  { "뒘", 0.00000000 },
+  { "톲", 0.00000000 },
+  { "땥", 0.00000000 },
+  { "씁", 0.00000000 },
+  { "닸", 0.00000000 },
+  { "뫊", 0.00000000 },
+  { "쒁", 0.00000000 },
+  { "똴", 0.00000000 },
+  { "왳", 0.00000000 },
+  { "녮", 0.00000000 },
+  { "봾", 0.00000000 },
+  { "똜", 0.00000000 },
+  { "퉹", 0.00000000 },
+  { "멞", 0.00000000 },
+  { "쏢", 0.00000000 },
+  { "뙀", 0.00000000 },
+  { "퉱", 0.00000000 },
+  { "춓", 0.00000000 },
+  { "츢", 0.00000000 },
+  { "솃", 0.00000000 },
+  { "붒", 0.00000000 },
+  { "뗴", 0.00000000 },
+  { "혣", 0.00000000 },
+  { "탸", 0.00000000 },
+  { "툘", 0.00000000 },
+  { "경", 0.00330000 },
+  { "얁", 0.00000000 },
+  { "싹", 0.00000000 },
+  { "놃", 0.00000000 },
+  { "폈", 0.00000000 },
+  { "뽎", 0.00000000 },
+  { "텴", 0.00000000 },
+  { "뿓", 0.00000000 },
+  { "횝", 0.00000000 },
+  { "쀮", 0.00000000 },
+  { "젭", 0.00000000 },
+  { "퉾", 0.00000000 },
+  { "맸", 0.00000000 },
+  { "킈", 0.00000000 },
+  { "땉", 0.00000000 },
+  { "퉳", 0.00000000 },
+  { "퀶", 0.00000000 },
+  { "둤", 0.00000000 },
+  { "퐎", 0.00000000 },
+  { "쀢", 0.00000000 },
+  { "폁", 0.00000000 },
+  { "헬", 0.00010000 },
+  { "곽", 0.00000000 },
+  { "싻", 0.00000000 },
+  { "쭉", 0.00000000 },
+  { "큯", 0.00000000 },
+  { "텍", 0.00010000 },
+  { "꿕", 0.00000000 },
+  { "숴", 0.00000000 },
+  { "졅", 0.00000000 },
+  { "넣", 0.00010000 },
+  { "쓪", 0.00000000 },
+  { "쉆", 0.00000000 },
+  { "쉲", 0.00000000 },
+  { "냯", 0.00000000 },
+  { "렗", 0.00000000 },
+  { "륢", 0.00000000 },
+  { "둀", 0.00000000 },
+  { "푃", 0.00000000 },
+  { "쥰", 0.00000000 },
+  { "묖", 0.00000000 },
+  { "쪯", 0.00000000 },
+  { "퀜", 0.00000000 },
+  { "덟", 0.00000000 },
+  { "눒", 0.00000000 },
+  { "빥", 0.00000000 },
+  { "쑘", 0.00000000 },
+  { "퐅", 0.00000000 },
+  { "몏", 0.00000000 },
+  { "쐚", 0.00000000 },
+  { "뒖", 0.00000000 },
+  { "쀂", 0.00000000 },
+  { "뽞", 0.00000000 },
+  { "칵", 0.00000000 },
+  { "꺷", 0.00000000 },
+  { "윹", 0.00000000 },
+  { "놙", 0.00000000 },
+  { "쯠", 0.00000000 },
+  { "솝", 0.00000000 },
+  { "꿯", 0.00000000 },
+  { "렺", 0.00000000 },
+  { "럥", 0.00000000 },
+  { "뿛", 0.00000000 },
+  { "좰", 0.00000000 },
+  { "댦", 0.00000000 },
+  { "뻹", 0.00000000 },
+  { "옪", 0.00000000 },
+  { "뼳", 0.00000000 },
+  { "젼", 0.00000000 },
+  { "큃", 0.00000000 },
+  { "풃", 0.00000000 },
+  { "랊", 0.00000000 },
+  { "벣", 0.00000000 },
+  { "촩", 0.00000000 },
+  { "죳", 0.00000000 },
+  { "핑", 0.00010000 },
+  { "냟", 0.00000000 },
+  { "뙷", 0.00000000 },
+  { "퀇", 0.00000000 },
+  { "뗒", 0.00000000 },
+  { "늱", 0.00000000 },
+  { "풪", 0.00000000 },
+  { "쒪", 0.00000000 },
+  { "샩", 0.00000000 },
+  { "썣", 0.00000000 },
+  { "걊", 0.00000000 },
+  { "눵", 0.00000000 },
+  { "뭫", 0.00000000 },
+  { "횟", 0.00000000 },
+  { "딱", 0.00000000 },
+  { "쎆", 0.00000000 },
+  { "픩", 0.00000000 },
+  { "쳡", 0.00000000 },
+  { "맦", 0.00000000 },
+  { "첻", 0.00000000 },
+  { "췍", 0.00000000 },
+  { "춌", 0.00000000 },
+  { "궭", 0.00000000 },
+  { "뽴", 0.00000000 },
+  { "컄", 0.00000000 },
+  { "퇖", 0.00000000 },
+  { "뎸", 0.00000000 },
+  { "넀", 0.00000000 },
+  { "촫", 0.00000000 },
+  { "뼈", 0.00000000 },
+  { "됗", 0.00000000 },
+  { "갞", 0.00000000 },
+  { "븀", 0.00000000 },
+  { "빟", 0.00000000 },
+  { "퓁", 0.00000000 },
+  { "턻", 0.00000000 },
+  { "짣", 0.00000000 },
+  { "뽧", 0.00000000 },
+  { "쇥", 0.00000000 },
+  { "됅", 0.00000000 },
+  { "힙", 0.00000000 },
+  { "읿", 0.00000000 },
+  { "묪", 0.00000000 },
+  { "뎆", 0.00000000 },
+  { "솮", 0.00000000 },
+  { "칹", 0.00000000 },
+  { "늿", 0.00000000 },
+  { "퇛", 0.00000000 },
+  { "펤", 0.00000000 },
+  { "퓅", 0.00000000 },
+  { "핕", 0.00000000 },
+  { "왲", 0.00000000 },
+  { "흛", 0.00000000 },
+  { "꿠", 0.00000000 },
+  { "빞", 0.00000000 },
+  { "욒", 0.00000000 },
+  { "벡", 0.00000000 },
+  { "꿿", 0.00000000 },
+  { "녅", 0.00000000 },
+  { "똙", 0.00000000 },
+  { "췺", 0.00000000 },
+  { "샴", 0.00000000 },
+  { "툋", 0.00000000 },
+  { "팙", 0.00000000 },
+  { "뷡", 0.00000000 },
+  { "훑", 0.00000000 },
+  { "낙", 0.00010000 },
+  { "록", 0.00110000 },
+  { "숉", 0.00000000 },
+  { "뉿", 0.00000000 },
+  { "렠", 0.00000000 },
+  { "릩", 0.00000000 },
+  { "뱮", 0.00000000 },
+  { "쑃", 0.00000000 },
+  { "씈", 0.00000000 },
+  { "잪", 0.00000000 },
+  { "묟", 0.00000000 },
+  { "퉉", 0.00000000 },
+  { "군", 0.00240000 },
+  { "흝", 0.00000000 },
+  { "귩", 0.00000000 },
+  { "왆", 0.00000000 },
+  { "풊", 0.00000000 },
+  { "뭿", 0.00000000 },
+  { "땴", 0.00000000 },
+  { "밞", 0.00000000 },
+  { "퓎", 0.00000000 },
+  { "난", 0.00070000 },
+  { "톖", 0.00000000 },
+  { "쬄", 0.00000000 },
+  { "쑷", 0.00000000 },
+  { "쮃", 0.00000000 },
+  { "뇻", 0.00000000 },
+  { "핂", 0.00000000 },
+  { "냲", 0.00000000 },
+  { "쒝", 0.00000000 },
+  { "각", 0.00130000 },
+  { "쓇", 0.00000000 },
+  { "쪈", 0.00000000 },
+  { "핇", 0.00000000 },
+  { "눩", 0.00000000 },
+  { "쟵", 0.00000000 },
+  { "룺", 0.00000000 },
+  { "믴", 0.00000000 },
+  { "왁", 0.00000000 },
+  { "쮗", 0.00000000 },
+  { "꺅", 0.00000000 },
+  { "셥", 0.00000000 },
+  { "뽱", 0.00000000 },
+  { "뇰", 0.00000000 },
+  { "츠", 0.00040000 },
+  { "퉀", 0.00000000 },
+  { "멒", 0.00000000 },
+  { "렑", 0.00000000 },
+  { "맕", 0.00000000 },
+  { "췕", 0.00000000 },
+  { "붡", 0.00000000 },
+  { "낃", 0.00000000 },
+  { "뺜", 0.00000000 },
+  { "삸", 0.00000000 },
+  { "쒿", 0.00000000 },
+  { "벲", 0.00000000 },
+  { "킯", 0.00000000 },
+  { "왍", 0.00000000 },
+  { "튰", 0.00000000 },
+  { "걄", 0.00000000 },
+  { "볕", 0.00000000 },
+  { "뤷", 0.00000000 },
+  { "놄", 0.00000000 },
+  { "듙", 0.00000000 },
+  { "덍", 0.00000000 },
+  { "밆", 0.00000000 },
+  { "전", 0.00640000 },
+  { "띏", 0.00000000 },
+  { "켴", 0.00000000 },
+  { "땔", 0.00000000 },
+  { "삹", 0.00000000 },
+  { "쿢", 0.00000000 },
+  { "퇤", 0.00000000 },
+  { "떗", 0.00000000 },
+  { "쯍", 0.00000000 },
+  { "엋", 0.00000000 },
+  { "말", 0.00100000 },
+  { "뷓", 0.00000000 },
+  { "뺛", 0.00000000 },
+  { "둬", 0.00000000 },
+  { "둿", 0.00000000 },
+  { "옍", 0.00000000 },
+  { "뉎", 0.00000000 },
+  { "씴", 0.00000000 },
+  { "걽", 0.00000000 },
+  { "겂", 0.00000000 },
+  { "믺", 0.00000000 },
+  { "쬟", 0.00000000 },
+  { "최", 0.00110000 },
+  { "걓", 0.00000000 },
+  { "눋", 0.00000000 },
+  { "펪", 0.00000000 },
+  { "뗘", 0.00000000 },
+  { "빺", 0.00000000 },
+  { "쿽", 0.00000000 },
+  { "깠", 0.00000000 },
+  { "쓸", 0.00000000 },
+  { "뷲", 0.00000000 },
+  { "뻫", 0.00000000 },
+  { "즫", 0.00000000 },
+  { "횎", 0.00000000 },
+  { "펢", 0.00000000 },
+  { "둯", 0.00000000 },
+  { "쫆", 0.00000000 },
+  { "탩", 0.00000000 },
+  { "층", 0.00020000 },
+  { "캄", 0.00000000 },
+  { "쪜", 0.00000000 },
+  { "쿰", 0.00000000 },
+  { "괁", 0.00000000 },
+  { "뮬", 0.00000000 },
+  { "슅", 0.00000000 },
+  { "권", 0.00110000 },
+  { "곑", 0.00000000 },
+  { "늚", 0.00000000 },
+  { "융", 0.00010000 },
+  { "탐", 0.00010000 },
+  { "섀", 0.00000000 },
+  { "컲", 0.00000000 },
+  { "뒺", 0.00000000 },
+  { "퇾", 0.00000000 },
+  { "쌸", 0.00000000 },
+  { "듵", 0.00000000 },
+  { "쏖", 0.00000000 },
+  { "킑", 0.00000000 },
+  { "뢼", 0.00000000 },
+  { "쀁", 0.00000000 },
+  { "떙", 0.00000000 },
+  { "쇻", 0.00000000 },
+  { "럈", 0.00000000 },
+  { "빿", 0.00000000 },
+  { "붲", 0.00000000 },
+  { "흞", 0.00000000 },
+  { "퓤", 0.00000000 },
+  { "뜷", 0.00000000 },
+  { "욉", 0.00000000 },
+  { "퐧", 0.00000000 },
+  { "뇏", 0.00000000 },
+  { "웷", 0.00000000 },
+  { "롭", 0.00010000 },
+  { "붌", 0.00000000 },
+  { "롕", 0.00000000 },
+  { "칭", 0.00040000 },
+  { "앥", 0.00000000 },
+  { "뎓", 0.00000000 },
+  { "푁", 0.00000000 },
+  { "즤", 0.00000000 },
+  { "쩧", 0.00000000 },
+  { "췤", 0.00000000 },
+  { "쵀", 0.00000000 },
+  { "붣", 0.00000000 },
+  { "퇨", 0.00000000 },
+  { "훥", 0.00000000 },
+  { "킣", 0.00000000 },
+  { "벽", 0.00010000 },
+  { "촺", 0.00000000 },
+  { "렱", 0.00000000 },
+  { "웰", 0.00000000 },
+  { "쬅", 0.00000000 },
+  { "괎", 0.00000000 },
+  { "릢", 0.00000000 },
+  { "묒", 0.00000000 },
+  { "딫", 0.00000000 },
+  { "벚", 0.00000000 },
+  { "촷", 0.00000000 },
+  { "쑹", 0.00000000 },
+  { "팵", 0.00000000 },
+  { "할", 0.00170000 },
+  { "쩹", 0.00000000 },
+  { "풬", 0.00000000 },
+  { "눂", 0.00000000 },
+  { "럔", 0.00000000 },
+  { "숙", 0.00020000 },
+  { "퀯", 0.00000000 },
+  { "킻", 0.00000000 },
+  { "벭", 0.00000000 },
+  { "혽", 0.00000000 },
+  { "핶", 0.00000000 },
+  { "봰", 0.00000000 },
+  { "쿱", 0.00000000 },
+  { "혫", 0.00000000 },
+  { "뎜", 0.00000000 },
+  { "눞", 0.00000000 },
+  { "귙", 0.00000000 },
+  { "긼", 0.00000000 },
+  { "쭡", 0.00000000 },
+  { "퓿", 0.00000000 },
+  { "뇡", 0.00000000 },
+  { "땅", 0.00010000 },
+  { "푫", 0.00000000 },
+  { "숭", 0.00010000 },
+  { "뢫", 0.00000000 },
+  { "괥", 0.00000000 },
+  { "쀦", 0.00000000 },
+  { "턤", 0.00000000 },
+  { "럣", 0.00000000 },
+  { "녁", 0.00000000 },
+  { "쨸", 0.00000000 },
+  { "갚", 0.00000000 },
+  { "릆", 0.00000000 },
+  { "쇣", 0.00000000 },
+  { "촢", 0.00000000 },
+  { "횼", 0.00000000 },
+  { "섣", 0.00000000 },
+  { "뺽", 0.00000000 },
+  { "껪", 0.00000000 },
+  { "퀘", 0.00000000 },
+  { "뼔", 0.00000000 },
+  { "셦", 0.00000000 },
+  { "딚", 0.00000000 },
+  { "쵬", 0.00000000 },
+  { "쇽", 0.00000000 },
+  { "첏", 0.00000000 },
+  { "쨾", 0.00000000 },
+  { "즁", 0.00000000 },
+  { "돩", 0.00000000 },
+  { "푗", 0.00000000 },
+  { "꽯", 0.00000000 },
+  { "왃", 0.00000000 },
+  { "껺", 0.00000000 },
+  { "휒", 0.00000000 },
+  { "뉢", 0.00000000 },
+  { "뤖", 0.00000000 },
+  { "쏟", 0.00000000 },
+  { "얠", 0.00000000 },
+  { "짒", 0.00000000 },
+  { "쵯", 0.00000000 },
+  { "돍", 0.00000000 },
+  { "쇚", 0.00000000 },
+  { "쎜", 0.00000000 },
+  { "솥", 0.00000000 },
+  { "쵼", 0.00000000 },
+  { "셉", 0.00000000 },
+  { "쉷", 0.00000000 },
+  { "쁊", 0.00000000 },
+  { "육", 0.00060000 },
+  { "쒕", 0.00000000 },
+  { "쌅", 0.00000000 },
+  { "쮏", 0.00000000 },
+  { "줱", 0.00000000 },
+  { "늛", 0.00000000 },
+  { "럾", 0.00000000 },
+  { "룫", 0.00000000 },
+  { "풎", 0.00000000 },
+  { "뻚", 0.00000000 },
+  { "횂", 0.00000000 },
+  { "뻔", 0.00000000 },
+  { "씱", 0.00000000 },
+  { "붛", 0.00000000 },
+  { "큽", 0.00000000 },
+  { "쥸", 0.00000000 },
+  { "뀓", 0.00000000 },
+  { "댶", 0.00000000 },
+  { "졍", 0.00000000 },
+  { "배", 0.00110000 },
+  { "꺞", 0.00000000 },
+  { "뻉", 0.00000000 },
+  { "뎇", 0.00000000 },
+  { "셤", 0.00000000 },
+  { "혧", 0.00000000 },
+  { "낼", 0.00000000 },
+  { "뚼", 0.00000000 },
+  { "틆", 0.00000000 },
+  { "엊", 0.00000000 },
+  { "떷", 0.00000000 },
+  { "끿", 0.00000000 },
+  { "탟", 0.00000000 },
+  { "쾃", 0.00000000 },
+  { "텠", 0.00000000 },
+  { "쐖", 0.00000000 },
+  { "텛", 0.00000000 },
+  { "쐛", 0.00000000 },
+  { "핖", 0.00000000 },
+  { "쒇", 0.00000000 },
+  { "씶", 0.00000000 },
+  { "프", 0.00250000 },
+  { "쌋", 0.00000000 },
+  { "셗", 0.00000000 },
+  { "캤", 0.00000000 },
+  { "샼", 0.00000000 },
+  { "캝", 0.00000000 },
+  { "혢", 0.00000000 },
+  { "뙧", 0.00000000 },
+  { "챻", 0.00000000 },
+  { "뉹", 0.00000000 },
+  { "왪", 0.00000000 },
+  { "쒀", 0.00000000 },
+  { "덕", 0.00020000 },
+  { "뉲", 0.00000000 },
+  { "쯊", 0.00000000 },
+  { "큜", 0.00000000 },
+  { "뫔", 0.00000000 },
+  { "괲", 0.00000000 },
+  { "릪", 0.00000000 },
+  { "냺", 0.00000000 },
+  { "둖", 0.00000000 },
+  { "뾈", 0.00000000 },
+  { "쎻", 0.00000000 },
+  { "예", 0.00110000 },
+  { "췡", 0.00000000 },
+  { "뿔", 0.00000000 },
+  { "감", 0.00080000 },
+  { "뀬", 0.00000000 },
+  { "퀖", 0.00000000 },
+  { "맲", 0.00000000 },
+  { "샺", 0.00000000 },
+  { "귪", 0.00000000 },
+  { "탞", 0.00000000 },
+  { "뿵", 0.00000000 },
+  { "뛼", 0.00000000 },
+  { "븋", 0.00000000 },
+  { "잳", 0.00000000 },
+  { "굑", 0.00000000 },
+  { "굯", 0.00000000 },
+  { "쪼", 0.00000000 },
+  { "뜙", 0.00000000 },
+  { "펡", 0.00000000 },
+  { "헄", 0.00000000 },
+  { "뼪", 0.00000000 },
+  { "엻", 0.00000000 },
+  { "귌", 0.00000000 },
+  { "쵗", 0.00000000 },
+  { "읯", 0.00000000 },
+  { "잺", 0.00000000 },
+  { "쳲", 0.00000000 },
+  { "젎", 0.00000000 },
+  { "뺠", 0.00000000 },
+  { "퍠", 0.00000000 },
+  { "픱", 0.00000000 },
+  { "돥", 0.00000000 },
+  { "먎", 0.00000000 },
+  { "췘", 0.00000000 },
+  { "볮", 0.00000000 },
+  { "쨑", 0.00000000 },
+  { "툣", 0.00000000 },
+  { "귴", 0.00000000 },
+  { "붴", 0.00000000 },
+  { "쨨", 0.00000000 },
+  { "굇", 0.00000000 },
+  { "듋", 0.00000000 },
+  { "맏", 0.00000000 },
+  { "멁", 0.00000000 },
+  { "녗", 0.00000000 },
+  { "픋", 0.00000000 },
+  { "뱖", 0.00000000 },
+  { "뜀", 0.00000000 },
+  { "찍", 0.00010000 },
+  { "럱", 0.00000000 },
+  { "럯", 0.00000000 },
+  { "캱", 0.00000000 },
+  { "됖", 0.00000000 },
+  { "댠", 0.00000000 },
+  { "뮠", 0.00000000 },
+  { "쎁", 0.00000000 },
+  { "켙", 0.00000000 },
+  { "뀴", 0.00000000 },
+  { "자", 0.00700000 },
+  { "늴", 0.00000000 },
+  { "꿻", 0.00000000 },
+  { "중", 0.00360000 },
+  { "뇖", 0.00000000 },
+  { "뒎", 0.00000000 },
+  { "흯", 0.00000000 },
+  { "퀺", 0.00000000 },
+  { "뵴", 0.00000000 },
+  { "뱌", 0.00000000 },
+  { "낣", 0.00000000 },
+  { "캐", 0.00020000 },
+  { "읗", 0.00000000 },
+  { "뽘", 0.00000000 },
+  { "튩", 0.00000000 },
+  { "쾴", 0.00000000 },
+  { "퐙", 0.00000000 },
+  { "똆", 0.00000000 },
+  { "뙡", 0.00000000 },
+  { "쯴", 0.00000000 },
+  { "뒸", 0.00000000 },
+  { "쫷", 0.00000000 },
+  { "뽡", 0.00000000 },
+  { "싷", 0.00000000 },
+  { "겣", 0.00000000 },
+  { "쏵", 0.00000000 },
+  { "뗇", 0.00000000 },
+  { "졣", 0.00000000 },
+  { "어", 0.00730000 },
+  { "찎", 0.00000000 },
+  { "픺", 0.00000000 },
+  { "늝", 0.00000000 },
+  { "퓏", 0.00000000 },
+  { "뇫", 0.00000000 },
+  { "챈", 0.00000000 },
+  { "뻍", 0.00000000 },
+  { "쉕", 0.00000000 },
+  { "댷", 0.00000000 },
+  { "퀩", 0.00000000 },
+  { "쓺", 0.00000000 },
+  { "꽛", 0.00000000 },
+  { "픻", 0.00000000 },
+  { "텲", 0.00000000 },
+  { "낊", 0.00000000 },
+  { "퓴", 0.00000000 },
+  { "섌", 0.00000000 },
+  { "윣", 0.00000000 },
+  { "텓", 0.00000000 },
+  { "쨂", 0.00000000 },
+  { "춵", 0.00000000 },
+  { "벊", 0.00000000 },
+  { "햗", 0.00000000 },
+  { "험", 0.00040000 },
+  { "꺮", 0.00000000 },
+  { "쥚", 0.00000000 },
+  { "뵎", 0.00000000 },
+  { "틂", 0.00000000 },
+  { "뜉", 0.00000000 },
+  { "퐭", 0.00000000 },
+  { "얀", 0.00000000 },
+  { "솪", 0.00000000 },
+  { "쇱", 0.00000000 },
+  { "쨘", 0.00000000 },
+  { "뇅", 0.00000000 },
+  { "써", 0.00030000 },
+  { "터", 0.00270000 },
+  { "펻", 0.00000000 },
+  { "솬", 0.00000000 },
+  { "쿛", 0.00000000 },
+  { "섫", 0.00000000 },
+  { "슗", 0.00000000 },
+  { "뛑", 0.00000000 },
+  { "얫", 0.00000000 },
+  { "뇗", 0.00000000 },
+  { "뻪", 0.00000000 },
+  { "렢", 0.00000000 },
+  { "뭈", 0.00000000 },
+  { "욁", 0.00000000 },
+  { "놧", 0.00000000 },
+  { "처", 0.00090000 },
+  { "맃", 0.00000000 },
+  { "뮪", 0.00000000 },
+  { "쐁", 0.00000000 },
+  { "샵", 0.00000000 },
+  { "쉞", 0.00000000 },
+  { "낵", 0.00000000 },
+  { "뫮", 0.00000000 },
+  { "슿", 0.00000000 },
+  { "꿚", 0.00000000 },
+  { "끟", 0.00000000 },
+  { "뫇", 0.00000000 },
+  { "툺", 0.00000000 },
+  { "섡", 0.00000000 },
+  { "뢗", 0.00000000 },
+  { "퍼", 0.00040000 },
+  { "띜", 0.00000000 },
+  { "댗", 0.00000000 },
+  { "룻", 0.00000000 },
+  { "톉", 0.00000000 },
+  { "땘", 0.00000000 },
+  { "볞", 0.00000000 },
+  { "뻅", 0.00000000 },
+  { "즃", 0.00000000 },
+  { "모", 0.00250000 },
+  { "벞", 0.00000000 },
+  { "뉼", 0.00000000 },
+  { "껖", 0.00000000 },
+  { "념", 0.00020000 },
+  { "쿈", 0.00000000 },
+  { "으", 0.01030000 },
+  { "촯", 0.00000000 },
+  { "밭", 0.00000000 },
+  { "쐂", 0.00000000 },
+  { "럟", 0.00000000 },
+  { "쀲", 0.00000000 },
+  { "쨁", 0.00000000 },
+  { "쨳", 0.00000000 },
+  { "줿", 0.00000000 },
+  { "혉", 0.00000000 },
+  { "곋", 0.00000000 },
+  { "쒸", 0.00000000 },
+  { "뽽", 0.00000000 },
+  { "튔", 0.00000000 },
+  { "퀛", 0.00000000 },
+  { "뻥", 0.00000000 },
+  { "쑂", 0.00000000 },
+  { "춿", 0.00000000 },
+  { "껅", 0.00000000 },
+  { "됳", 0.00000000 },
+  { "삆", 0.00000000 },
+  { "홅", 0.00000000 },
+  { "곪", 0.00000000 },
+  { "쾾", 0.00000000 },
+  { "컝", 0.00000000 },
+  { "쮔", 0.00000000 },
+  { "뛻", 0.00000000 },
+  { "꺹", 0.00000000 },
+  { "뾙", 0.00000000 },
+  { "죺", 0.00000000 },
+  { "쁔", 0.00000000 },
+  { "삿", 0.00000000 },
+  { "툟", 0.00000000 },
+  { "맢", 0.00000000 },
+  { "띟", 0.00000000 },
+  { "븚", 0.00000000 },
+  { "뮊", 0.00000000 },
+  { "썦", 0.00000000 },
+  { "훨", 0.00000000 },
+  { "딦", 0.00000000 },
+  { "챉", 0.00000000 },
+  { "맪", 0.00000000 },
+  { "숧", 0.00000000 },
+  { "잀", 0.00000000 },
+  { "솁", 0.00000000 },
+  { "휟", 0.00000000 },
+  { "늫", 0.00000000 },
+  { "살", 0.00060000 },
+  { "꽻", 0.00000000 },
+  { "샐", 0.00000000 },
+  { "갌", 0.00000000 },
+  { "둗", 0.00000000 },
+  { "읢", 0.00000000 },
+  { "짆", 0.00000000 },
+  { "퉏", 0.00000000 },
+  { "훪", 0.00000000 },
+  { "뺑", 0.00000000 },
+  { "궺", 0.00000000 },
+  { "퐐", 0.00000000 },
+  { "틵", 0.00000000 },
+  { "뻸", 0.00000000 },
+  { "킃", 0.00000000 },
+  { "궤", 0.00010000 },
+  { "횢", 0.00000000 },
+  { "얖", 0.00000000 },
+  { "턜", 0.00000000 },
+  { "릜", 0.00000000 },
+  { "뱓", 0.00000000 },
+  { "늰", 0.00000000 },
+  { "푡", 0.00000000 },
+  { "틹", 0.00000000 },
+  { "래", 0.00110000 },
+  { "뒇", 0.00000000 },
+  { "촗", 0.00000000 },
+  { "흹", 0.00000000 },
+  { "쇠", 0.00010000 },
+  { "뷯", 0.00000000 },
+  { "뻩", 0.00000000 },
+  { "뷾", 0.00000000 },
+  { "쇃", 0.00000000 },
+  { "뤟", 0.00000000 },
+  { "훘", 0.00000000 },
+  { "댤", 0.00000000 },
+  { "넥", 0.00000000 },
+  { "돔", 0.00000000 },
+  { "펵", 0.00000000 },
+  { "딊", 0.00000000 },
+  { "뛒", 0.00000000 },
+  { "겗", 0.00000000 },
+  { "큷", 0.00000000 },
+  { "췔", 0.00000000 },
+  { "밍", 0.00010000 },
+  { "쮟", 0.00000000 },
+  { "춝", 0.00000000 },
+  { "끜", 0.00000000 },
+  { "뺚", 0.00000000 },
+  { "눖", 0.00000000 },
+  { "왯", 0.00000000 },
+  { "췞", 0.00000000 },
+  { "찙", 0.00000000 },
+  { "톸", 0.00000000 },
+  { "쩖", 0.00000000 },
+  { "텐", 0.00010000 },
+  { "뗄", 0.00000000 },
+  { "낤", 0.00000000 },
+  { "뫏", 0.00000000 },
+  { "붖", 0.00000000 },
+  { "쉏", 0.00000000 },
+  { "쥳", 0.00000000 },
+  { "밁", 0.00000000 },
+  { "쮷", 0.00000000 },
+  { "큳", 0.00000000 },
+  { "줊", 0.00000000 },
+  { "뷈", 0.00000000 },
+  { "쬀", 0.00000000 },
+  { "븲", 0.00000000 },
+  { "쓥", 0.00000000 },
+  { "룤", 0.00000000 },
+  { "짗", 0.00000000 },
+  { "벎", 0.00000000 },
+  { "뼹", 0.00000000 },
+  { "읞", 0.00000000 },
+  { "틴", 0.00010000 },
+  { "돣", 0.00000000 },
+  { "쫳", 0.00000000 },
+  { "쾞", 0.00000000 },
+  { "녦", 0.00000000 },
+  { "람", 0.00070000 },
+  { "낄", 0.00000000 },
+  { "벀", 0.00000000 },
+  { "큡", 0.00000000 },
+  { "긐", 0.00000000 },
+  { "뙯", 0.00000000 },
+  { "쌪", 0.00000000 },
+  { "퐥", 0.00000000 },
+  { "멼", 0.00000000 },
+  { "닧", 0.00000000 },
+  { "닢", 0.00000000 },
+  { "썭", 0.00000000 },
+  { "넃", 0.00000000 },
+  { "짿", 0.00000000 },
+  { "푢", 0.00000000 },
+  { "퇣", 0.00000000 },
+  { "쬹", 0.00000000 },
+  { "솽", 0.00000000 },
+  { "흻", 0.00000000 },
+  { "싣", 0.00000000 },
+  { "깸", 0.00000000 },
+  { "쯲", 0.00000000 },
+  { "릝", 0.00000000 },
+  { "엿", 0.00000000 },
+  { "굻", 0.00000000 },
+  { "끼", 0.00010000 },
+  { "럻", 0.00000000 },
+  { "믇", 0.00000000 },
+  { "슴", 0.00000000 },
+  { "갼", 0.00000000 },
+  { "뢽", 0.00000000 },
+  { "쌙", 0.00000000 },
+  { "튶", 0.00000000 },
+  { "솿", 0.00000000 },
+  { "뙒", 0.00000000 },
+  { "쓬", 0.00000000 },
+  { "셡", 0.00000000 },
+  { "꾊", 0.00000000 },
+  { "쭄", 0.00000000 },
+  { "끰", 0.00000000 },
+  { "웳", 0.00000000 },
+  { "벪", 0.00000000 },
+  { "쒨", 0.00000000 },
+  { "큼", 0.00010000 },
+  { "꼘", 0.00000000 },
+  { "뮶", 0.00000000 },
+  { "섇", 0.00000000 },
+  { "턲", 0.00000000 },
+  { "롟", 0.00000000 },
+  { "마", 0.00350000 },
+  { "뷃", 0.00000000 },
+  { "홱", 0.00000000 },
+  { "뒙", 0.00000000 },
+  { "깆", 0.00000000 },
+  { "턙", 0.00000000 },
+  { "꾱", 0.00000000 },
+  { "봳", 0.00000000 },
+  { "샸", 0.00000000 },
+  { "쇮", 0.00000000 },
+  { "삋", 0.00000000 },
+  { "쁽", 0.00000000 },
+  { "붋", 0.00000000 },
+  { "범", 0.00050000 },
+  { "곯", 0.00000000 },
+  { "숪", 0.00000000 },
+  { "윈", 0.00010000 },
+  { "걒", 0.00000000 },
+  { "몙", 0.00000000 },
+  { "뷰", 0.00000000 },
+  { "쯩", 0.00000000 },
+  { "옥", 0.00020000 },
+  { "읔", 0.00000000 },
+  { "뭋", 0.00000000 },
+  { "덱", 0.00000000 },
+  { "멗", 0.00000000 },
+  { "뭧", 0.00000000 },
+  { "챩", 0.00000000 },
+  { "뤢", 0.00000000 },
+  { "혿", 0.00000000 },
+  { "앪", 0.00000000 },
+  { "찢", 0.00000000 },
+  { "뒅", 0.00000000 },
+  { "뫺", 0.00000000 },
+  { "힄", 0.00000000 },
+  { "놵", 0.00000000 },
+  { "쿀", 0.00000000 },
+  { "슋", 0.00000000 },
+  { "쬪", 0.00000000 },
+  { "풵", 0.00000000 },
+  { "털", 0.00010000 },
+  { "졻", 0.00000000 },
+  { "뛂", 0.00000000 },
+  { "큅", 0.00000000 },
+  { "뎖", 0.00000000 },
+  { "혌", 0.00000000 },
+  { "픃", 0.00000000 },
+  { "늆", 0.00000000 },
+  { "잁", 0.00000000 },
+  { "퉻", 0.00000000 },
+  { "즾", 0.00000000 },
+  { "눃", 0.00000000 },
+  { "랅", 0.00000000 },
+  { "쾮", 0.00000000 },
+  { "꾀", 0.00000000 },
+  { "땨", 0.00000000 },
+  { "쿚", 0.00000000 },
+  { "엍", 0.00000000 },
+  { "춯", 0.00000000 },
+  { "잢", 0.00000000 },
+  { "흦", 0.00000000 },
+  { "뉩", 0.00000000 },
+  { "줶", 0.00000000 },
+  { "횠", 0.00000000 },
+  { "흱", 0.00000000 },
+  { "폰", 0.00010000 },
+  { "쒫", 0.00000000 },
+  { "떲", 0.00000000 },
+  { "늞", 0.00000000 },
+  { "곎", 0.00000000 },
+  { "뮧", 0.00000000 },
+  { "꾹", 0.00000000 },
+  { "싨", 0.00000000 },
+  { "탭", 0.00000000 },
+  { "퉃", 0.00000000 },
+  { "뇶", 0.00000000 },
+  { "볒", 0.00000000 },
+  { "쒅", 0.00000000 },
+  { "펷", 0.00000000 },
+  { "삣", 0.00000000 },
+  { "쵑", 0.00000000 },
+  { "벘", 0.00000000 },
+  { "뮄", 0.00000000 },
+  { "탴", 0.00000000 },
+  { "펂", 0.00000000 },
+  { "볼", 0.00030000 },
+  { "쿄", 0.00010000 },
+  { "죢", 0.00000000 },
+  { "삡", 0.00000000 },
+  { "빚", 0.00000000 },
+  { "젘", 0.00000000 },
+  { "뼥", 0.00000000 },
+  { "뙔", 0.00000000 },
+  { "켺", 0.00000000 },
+  { "긫", 0.00000000 },
+  { "맊", 0.00000000 },
+  { "럸", 0.00000000 },
+  { "뮛", 0.00000000 },
+  { "솒", 0.00000000 },
+  { "뇎", 0.00000000 },
+  { "돿", 0.00000000 },
+  { "얙", 0.00000000 },
+  { "쫗", 0.00000000 },
+  { "앢", 0.00000000 },
+  { "푚", 0.00000000 },
+  { "홏", 0.00000000 },
+  { "숊", 0.00000000 },
+  { "댍", 0.00000000 },
+  { "숽", 0.00000000 },
+  { "뫙", 0.00000000 },
+  { "움", 0.00030000 },
+  { "볠", 0.00000000 },
+  { "헟", 0.00000000 },
+  { "럌", 0.00000000 },
+  { "쏊", 0.00000000 },
+  { "팅", 0.00010000 },
+  { "논", 0.00030000 },
+  { "핳", 0.00000000 },
+  { "췲", 0.00000000 },
+  { "곂", 0.00000000 },
+  { "칫", 0.00000000 },
+  { "뷉", 0.00000000 },
+  { "뻲", 0.00000000 },
+  { "뺄", 0.00000000 },
+  { "꾭", 0.00000000 },
+  { "삾", 0.00000000 },
+  { "댞", 0.00000000 },
+  { "롼", 0.00000000 },
+  { "쁛", 0.00000000 },
+  { "짭", 0.00000000 },
+  { "훻", 0.00000000 },
+  { "쀃", 0.00000000 },
+  { "꺼", 0.00000000 },
+  { "쌆", 0.00000000 },
+  { "됽", 0.00000000 },
+  { "뺘", 0.00000000 },
+  { "뼄", 0.00000000 },
+  { "쏰", 0.00000000 },
+  { "뻽", 0.00000000 },
+  { "췥", 0.00000000 },
+  { "뱛", 0.00000000 },
+  { "둮", 0.00000000 },
+  { "쬞", 0.00000000 },
+  { "왑", 0.00000000 },
+  { "걱", 0.00000000 },
+  { "숚", 0.00000000 },
+  { "쒓", 0.00000000 },
+  { "뭆", 0.00000000 },
+  { "킮", 0.00000000 },
+  { "윲", 0.00000000 },
+  { "믆", 0.00000000 },
+  { "꺥", 0.00000000 },
+  { "뤞", 0.00000000 },
+  { "뙱", 0.00000000 },
+  { "륧", 0.00000000 },
+  { "악", 0.00070000 },
+  { "뎛", 0.00000000 },
+  { "롇", 0.00000000 },
+  { "쁂", 0.00000000 },
+  { "뾆", 0.00000000 },
+  { "겘", 0.00000000 },
+  { "랫", 0.00010000 },
+  { "첑", 0.00000000 },
+  { "쒰", 0.00000000 },
+  { "썋", 0.00000000 },
+  { "퍒", 0.00000000 },
+  { "싴", 0.00000000 },
+  { "쿅", 0.00000000 },
+  { "랛", 0.00000000 },
+  { "킊", 0.00000000 },
+  { "얉", 0.00000000 },
+  { "꼹", 0.00000000 },
+  { "춟", 0.00000000 },
+  { "빰", 0.00000000 },
+  { "뢏", 0.00000000 },
+  { "킎", 0.00000000 },
+  { "춅", 0.00000000 },
+  { "똯", 0.00000000 },
+  { "먭", 0.00000000 },
+  { "뀉", 0.00000000 },
+  { "뗤", 0.00000000 },
+  { "삺", 0.00000000 },
+  { "싘", 0.00000000 },
+  { "놎", 0.00000000 },
+  { "죮", 0.00000000 },
+  { "땒", 0.00000000 },
+  { "급", 0.00080000 },
+  { "뇀", 0.00000000 },
+  { "릇", 0.00000000 },
+  { "깹", 0.00000000 },
+  { "츇", 0.00000000 },
+  { "퉟", 0.00000000 },
+  { "좓", 0.00000000 },
+  { "뵠", 0.00000000 },
+  { "앗", 0.00000000 },
+  { "뇋", 0.00000000 },
+  { "쪒", 0.00000000 },
+  { "욇", 0.00000000 },
+  { "녡", 0.00000000 },
+  { "쑥", 0.00000000 },
+  { "맓", 0.00000000 },
+  { "훂", 0.00000000 },
+  { "씧", 0.00000000 },
+  { "촳", 0.00000000 },
+  { "퍗", 0.00000000 },
+  { "씩", 0.00010000 },
+  { "킸", 0.00000000 },
+  { "멻", 0.00000000 },
+  { "준", 0.00080000 },
+  { "텚", 0.00000000 },
+  { "돯", 0.00000000 },
+  { "뢵", 0.00000000 },
+  { "행", 0.00200000 },
+  { "뵮", 0.00000000 },
+  { "뫚", 0.00000000 },
+  { "히", 0.00140000 },
+  { "띫", 0.00000000 },
+  { "퓞", 0.00000000 },
+  { "쭨", 0.00000000 },
+  { "탒", 0.00000000 },
+  { "쳂", 0.00000000 },
+  { "땗", 0.00000000 },
+  { "넔", 0.00000000 },
+  { "씦", 0.00000000 },
+  { "륚", 0.00000000 },
+  { "윪", 0.00000000 },
+  { "뫲", 0.00000000 },
+  { "걲", 0.00000000 },
+  { "쬕", 0.00000000 },
+  { "틸", 0.00000000 },
+  { "톨", 0.00010000 },
+  { "퀔", 0.00000000 },
+  { "촲", 0.00000000 },
+  { "뉓", 0.00000000 },
+  { "쓦", 0.00000000 },
+  { "츸", 0.00000000 },
+  { "찝", 0.00000000 },
+  { "귆", 0.00000000 },
+  { "쒠", 0.00000000 },
+  { "앻", 0.00000000 },
+  { "쬸", 0.00000000 },
+  { "팣", 0.00000000 },
+  { "굧", 0.00000000 },
+  { "끉", 0.00000000 },
+  { "톺", 0.00000000 },
+  { "뎙", 0.00000000 },
+  { "탛", 0.00000000 },
+  { "맥", 0.00020000 },
+  { "훧", 0.00000000 },
+  { "콐", 0.00000000 },
+  { "덵", 0.00000000 },
+  { "븳", 0.00000000 },
+  { "촁", 0.00000000 },
+  { "탷", 0.00000000 },
+  { "캔", 0.00000000 },
+  { "펺", 0.00000000 },
+  { "컍", 0.00000000 },
+  { "뭛", 0.00000000 },
+  { "녿", 0.00000000 },
+  { "쟾", 0.00000000 },
+  { "첒", 0.00000000 },
+  { "쪓", 0.00000000 },
+  { "눔", 0.00000000 },
+  { "눷", 0.00000000 },
+  { "뎠", 0.00000000 },
+  { "덤", 0.00000000 },
+  { "뀳", 0.00000000 },
+  { "횔", 0.00000000 },
+  { "웜", 0.00000000 },
+  { "뿜", 0.00000000 },
+  { "놘", 0.00000000 },
+  { "쉳", 0.00000000 },
+  { "땐", 0.00000000 },
+  { "벐", 0.00000000 },
+  { "줼", 0.00000000 },
+  { "쌃", 0.00000000 },
+  { "곍", 0.00000000 },
+  { "븦", 0.00000000 },
+  { "뛍", 0.00000000 },
+  { "뱸", 0.00000000 },
+  { "캷", 0.00000000 },
+  { "쾦", 0.00000000 },
+  { "뱍", 0.00000000 },
+  { "셟", 0.00000000 },
+  { "륉", 0.00000000 },
+  { "킐", 0.00000000 },
+  { "됌", 0.00000000 },
+  { "틱", 0.00000000 },
+  { "롄", 0.00000000 },
+  { "멢", 0.00000000 },
+  { "뒶", 0.00000000 },
+  { "뛜", 0.00000000 },
+  { "돉", 0.00000000 },
+  { "솔", 0.00010000 },
+  { "슫", 0.00000000 },
+  { "쀜", 0.00000000 },
+  { "로", 0.01850000 },
+  { "섴", 0.00000000 },
+  { "봁", 0.00000000 },
+  { "혠", 0.00000000 },
+  { "욜", 0.00000000 },
+  { "턒", 0.00000000 },
+  { "벏", 0.00000000 },
+  { "괰", 0.00000000 },
+  { "꾬", 0.00000000 },
+  { "뀏", 0.00000000 },
+  { "쟼", 0.00000000 },
+  { "벌", 0.00040000 },
+  { "롒", 0.00000000 },
+  { "퐘", 0.00000000 },
+  { "븑", 0.00000000 },
+  { "샬", 0.00000000 },
+  { "툗", 0.00000000 },
+  { "븜", 0.00000000 },
+  { "뙸", 0.00000000 },
+  { "뜰", 0.00000000 },
+  { "휷", 0.00000000 },
+  { "뮾", 0.00000000 },
+  { "땞", 0.00000000 },
+  { "갭", 0.00000000 },
+  { "빒", 0.00000000 },
+  { "핽", 0.00000000 },
+  { "댉", 0.00000000 },
+  { "뮼", 0.00000000 },
+  { "썶", 0.00000000 },
+  { "뜌", 0.00000000 },
+  { "콧", 0.00000000 },
+  { "픜", 0.00000000 },
+  { "릱", 0.00000000 },
+  { "톄", 0.00000000 },
+  { "뫨", 0.00000000 },
+  { "쮑", 0.00000000 },
+  { "형", 0.00140000 },
+  { "돓", 0.00000000 },
+  { "삮", 0.00000000 },
+  { "홶", 0.00000000 },
+  { "뗠", 0.00000000 },
+  { "즂", 0.00000000 },
+  { "눕", 0.00000000 },
+  { "뚨", 0.00000000 },
+  { "쟢", 0.00000000 },
+  { "앴", 0.00000000 },
+  { "솯", 0.00000000 },
+  { "팦", 0.00000000 },
+  { "헚", 0.00000000 },
+  { "뷇", 0.00000000 },
+  { "긌", 0.00000000 },
+  { "뽻", 0.00000000 },
+  { "쮅", 0.00000000 },
+  { "쵣", 0.00000000 },
+  { "롤", 0.00010000 },
+  { "쬢", 0.00000000 },
+  { "뭑", 0.00000000 },
+  { "챔", 0.00010000 },
+  { "떸", 0.00000000 },
+  { "혗", 0.00000000 },
+  { "웊", 0.00000000 },
+  { "껊", 0.00000000 },
+  { "톓", 0.00000000 },
+  { "닪", 0.00000000 },
+  { "몲", 0.00000000 },
+  { "섻", 0.00000000 },
+  { "뼙", 0.00000000 },
+  { "쨭", 0.00000000 },
+  { "플", 0.00050000 },
+  { "햇", 0.00000000 },
+  { "햒", 0.00000000 },
+  { "똕", 0.00000000 },
+  { "뎔", 0.00000000 },
+  { "쎴", 0.00000000 },
+  { "뵈", 0.00000000 },
+  { "롥", 0.00000000 },
+  { "닲", 0.00000000 },
+  { "츽", 0.00000000 },
+  { "뎋", 0.00000000 },
+  { "옖", 0.00000000 },
+  { "젟", 0.00000000 },
+  { "셼", 0.00000000 },
+  { "쾀", 0.00000000 },
+  { "겁", 0.00000000 },
+  { "칼", 0.00020000 },
+  { "쀳", 0.00000000 },
+  { "뀧", 0.00000000 },
+  { "캎", 0.00000000 },
+  { "폴", 0.00030000 },
+  { "쭳", 0.00000000 },
+  { "뚠", 0.00000000 },
+  { "쏬", 0.00000000 },
+  { "멯", 0.00000000 },
+  { "촇", 0.00000000 },
+  { "팡", 0.00000000 },
+  { "뎥", 0.00000000 },
+  { "앬", 0.00000000 },
+  { "뽼", 0.00000000 },
+  { "쫑", 0.00000000 },
+  { "둔", 0.00010000 },
+  { "쾊", 0.00000000 },
+  { "젂", 0.00000000 },
+  { "왏", 0.00000000 },
+  { "뫓", 0.00000000 },
+  { "졦", 0.00000000 },
+  { "걤", 0.00000000 },
+  { "뇓", 0.00000000 },
+  { "둺", 0.00000000 },
+  { "쓡", 0.00000000 },
+  { "쭠", 0.00000000 },
+  { "쇺", 0.00000000 },
+  { "쒩", 0.00000000 },
+  { "굄", 0.00000000 },
+  { "꼲", 0.00000000 },
+  { "끚", 0.00000000 },
+  { "뎃", 0.00000000 },
+  { "붮", 0.00000000 },
+  { "얩", 0.00000000 },
+  { "쎝", 0.00000000 },
+  { "퍷", 0.00000000 },
+  { "끷", 0.00000000 },
+  { "훞", 0.00000000 },
+  { "빝", 0.00000000 },
+  { "똟", 0.00000000 },
+  { "횋", 0.00000000 },
+  { "앂", 0.00000000 },
+  { "쾟", 0.00000000 },
+  { "퉌", 0.00000000 },
+  { "쩏", 0.00000000 },
+  { "긏", 0.00000000 },
+  { "쟹", 0.00000000 },
+  { "줬", 0.00000000 },
+  { "웴", 0.00000000 },
+  { "췎", 0.00000000 },
+  { "훡", 0.00000000 },
+  { "즰", 0.00000000 },
+  { "퀳", 0.00000000 },
+  { "퍨", 0.00000000 },
+  { "덳", 0.00000000 },
+  { "젪", 0.00000000 },
+  { "뒃", 0.00000000 },
+  { "횷", 0.00000000 },
+  { "옰", 0.00000000 },
+  { "뼐", 0.00000000 },
+  { "퓭", 0.00000000 },
+  { "님", 0.00010000 },
+  { "뼖", 0.00000000 },
+  { "쑣", 0.00000000 },
+  { "퉪", 0.00000000 },
+  { "쵌", 0.00000000 },
+  { "젶", 0.00000000 },
+  { "뛢", 0.00000000 },
+  { "푈", 0.00000000 },
+  { "얤", 0.00000000 },
+  { "쌢", 0.00000000 },
+  { "쵶", 0.00000000 },
+  { "쁧", 0.00000000 },
+  { "뼫", 0.00000000 },
+  { "펓", 0.00000000 },
+  { "싀", 0.00000000 },
+  { "훓", 0.00000000 },
+  { "낹", 0.00000000 },
+  { "댆", 0.00000000 },
+  { "얄", 0.00000000 },
+  { "위", 0.00400000 },
+  { "퓖", 0.00000000 },
+  { "꼦", 0.00000000 },
+  { "쥗", 0.00000000 },
+  { "효", 0.00030000 },
+  { "큊", 0.00000000 },
+  { "똻", 0.00000000 },
+  { "찪", 0.00000000 },
+  { "박", 0.00060000 },
+  { "뗻", 0.00000000 },
+  { "폝", 0.00000000 },
+  { "뿽", 0.00000000 },
+  { "휑", 0.00000000 },
+  { "릛", 0.00000000 },
+  { "뵓", 0.00000000 },
+  { "끺", 0.00000000 },
+  { "듧", 0.00000000 },
+  { "켅", 0.00000000 },
+  { "뗓", 0.00000000 },
+  { "잴", 0.00000000 },
+  { "뭪", 0.00000000 },
+  { "쮸", 0.00000000 },
+  { "혤", 0.00000000 },
+  { "탬", 0.00000000 },
+  { "겤", 0.00000000 },
+  { "멣", 0.00000000 },
+  { "돖", 0.00000000 },
+  { "뿳", 0.00000000 },
+  { "풉", 0.00000000 },
+  { "꺏", 0.00000000 },
+  { "뢊", 0.00000000 },
+  { "볋", 0.00000000 },
+  { "쑇", 0.00000000 },
+  { "헻", 0.00000000 },
+  { "쫤", 0.00000000 },
+  { "혲", 0.00000000 },
+  { "걋", 0.00000000 },
+  { "끃", 0.00000000 },
+  { "뙠", 0.00000000 },
+  { "앮", 0.00000000 },
+  { "걩", 0.00000000 },
+  { "힡", 0.00000000 },
+  { "휹", 0.00000000 },
+  { "짃", 0.00000000 },
+  { "랹", 0.00000000 },
+  { "믓", 0.00000000 },
+  { "왟", 0.00000000 },
+  { "뽉", 0.00000000 },
+  { "뜤", 0.00000000 },
+  { "돤", 0.00000000 },
+  { "깨", 0.00010000 },
+  { "취", 0.00040000 },
+  { "렖", 0.00000000 },
+  { "땙", 0.00000000 },
+  { "븾", 0.00000000 },
+  { "뵥", 0.00000000 },
+  { "쒛", 0.00000000 },
+  { "댟", 0.00000000 },
+  { "놩", 0.00000000 },
+  { "좫", 0.00000000 },
+  { "랚", 0.00000000 },
+  { "찫", 0.00000000 },
+  { "븅", 0.00000000 },
+  { "걥", 0.00000000 },
+  { "죸", 0.00000000 },
+  { "꼰", 0.00000000 },
+  { "췅", 0.00000000 },
+  { "푰", 0.00000000 },
+  { "젋", 0.00000000 },
+  { "썊", 0.00000000 },
+  { "맜", 0.00000000 },
+  { "깝", 0.00000000 },
+  { "녧", 0.00000000 },
+  { "얐", 0.00000000 },
+  { "쌁", 0.00000000 },
+  { "숩", 0.00000000 },
+  { "캻", 0.00000000 },
+  { "숬", 0.00000000 },
+  { "쐩", 0.00000000 },
+  { "뀩", 0.00000000 },
+  { "왶", 0.00000000 },
+  { "촊", 0.00000000 },
+  { "뱙", 0.00000000 },
+  { "횯", 0.00000000 },
+  { "쉨", 0.00000000 },
+  { "뗮", 0.00000000 },
+  { "죊", 0.00000000 },
+  { "쪳", 0.00000000 },
+  { "쟀", 0.00000000 },
+  { "꺂", 0.00000000 },
+  { "덛", 0.00000000 },
+  { "콡", 0.00000000 },
+  { "흡", 0.00010000 },
+  { "괤", 0.00000000 },
+  { "놿", 0.00000000 },
+  { "복", 0.00080000 },
+  { "죃", 0.00000000 },
+  { "떬", 0.00000000 },
+  { "칩", 0.00000000 },
+  { "돝", 0.00000000 },
+  { "뽪", 0.00000000 },
+  { "꾡", 0.00000000 },
+  { "핰", 0.00000000 },
+  { "닜", 0.00000000 },
+  { "햕", 0.00000000 },
+  { "찚", 0.00000000 },
+  { "쵹", 0.00000000 },
+  { "핀", 0.00010000 },
+  { "슩", 0.00000000 },
+  { "륦", 0.00000000 },
+  { "츼", 0.00000000 },
+  { "씙", 0.00000000 },
+  { "귔", 0.00000000 },
+  { "쓨", 0.00000000 },
+  { "롏", 0.00000000 },
+  { "갖", 0.00020000 },
+  { "겢", 0.00000000 },
+  { "꼤", 0.00000000 },
+  { "썒", 0.00000000 },
+  { "쎀", 0.00000000 },
+  { "쎠", 0.00000000 },
+  { "턯", 0.00000000 },
+  { "틾", 0.00000000 },
+  { "켍", 0.00000000 },
+  { "팠", 0.00000000 },
+  { "샒", 0.00000000 },
+  { "췪", 0.00000000 },
+  { "럧", 0.00000000 },
+  { "댩", 0.00000000 },
+  { "뷊", 0.00000000 },
+  { "뫾", 0.00000000 },
+  { "즆", 0.00000000 },
+  { "넓", 0.00010000 },
+  { "냃", 0.00000000 },
+  { "뾓", 0.00000000 },
+  { "몇", 0.00020000 },
+  { "땈", 0.00000000 },
+  { "쭆", 0.00000000 },
+  { "뤴", 0.00000000 },
+  { "괇", 0.00000000 },
+  { "쵊", 0.00000000 },
+  { "봠", 0.00000000 },
+  { "뺸", 0.00000000 },
+  { "왮", 0.00000000 },
+  { "뤥", 0.00000000 },
+  { "뽒", 0.00000000 },
+  { "맙", 0.00000000 },
+  { "졾", 0.00000000 },
+  { "봉", 0.00040000 },
+  { "츃", 0.00000000 },
+  { "툏", 0.00000000 },
+  { "흳", 0.00000000 },
+  { "럘", 0.00000000 },
+  { "겚", 0.00000000 },
+  { "휂", 0.00000000 },
+  { "걢", 0.00000000 },
+  { "뚸", 0.00000000 },
+  { "맔", 0.00000000 },
+  { "똊", 0.00000000 },
+  { "벍", 0.00000000 },
+  { "쯮", 0.00000000 },
+  { "슈", 0.00030000 },
+  { "봐", 0.00000000 },
+  { "캣", 0.00000000 },
+  { "꺁", 0.00000000 },
+  { "긔", 0.00000000 },
+  { "릡", 0.00000000 },
+  { "땏", 0.00000000 },
+  { "듥", 0.00000000 },
+  { "띮", 0.00000000 },
+  { "푓", 0.00000000 },
+  { "휎", 0.00000000 },
+  { "몳", 0.00000000 },
+  { "콳", 0.00000000 },
+  { "퓨", 0.00010000 },
+  { "뽷", 0.00000000 },
+  { "쇵", 0.00000000 },
+  { "킷", 0.00000000 },
+  { "맵", 0.00000000 },
+  { "욷", 0.00000000 },
+  { "켑", 0.00000000 },
+  { "뛣", 0.00000000 },
+  { "꾓", 0.00000000 },
+  { "뉝", 0.00000000 },
+  { "눫", 0.00000000 },
+  { "덝", 0.00000000 },
+  { "샠", 0.00000000 },
+  { "럼", 0.00020000 },
+  { "썁", 0.00000000 },
+  { "깃", 0.00000000 },
+  { "콂", 0.00000000 },
+  { "갴", 0.00000000 },
+  { "꺎", 0.00000000 },
+  { "쵪", 0.00000000 },
+  { "쾻", 0.00000000 },
+  { "황", 0.00080000 },
+  { "뚣", 0.00000000 },
+  { "맒", 0.00000000 },
+  { "쫐", 0.00000000 },
+  { "퍱", 0.00000000 },
+  { "읽", 0.00000000 },
+  { "됔", 0.00000000 },
+  { "쪁", 0.00000000 },
+  { "칐", 0.00000000 },
+  { "쉡", 0.00000000 },
+  { "췣", 0.00000000 },
+  { "탚", 0.00000000 },
+  { "둷", 0.00000000 },
+  { "꾥", 0.00000000 },
+  { "뚚", 0.00000000 },
+  { "뒁", 0.00000000 },
+  { "롱", 0.00010000 },
+  { "뵻", 0.00000000 },
+  { "헾", 0.00000000 },
+  { "늽", 0.00000000 },
+  { "씅", 0.00000000 },
+  { "쑪", 0.00000000 },
+  { "궯", 0.00000000 },
+  { "쏋", 0.00000000 },
+  { "껱", 0.00000000 },
+  { "샡", 0.00000000 },
+  { "륱", 0.00000000 },
+  { "휡", 0.00000000 },
+  { "냿", 0.00000000 },
+  { "쐽", 0.00000000 },
+  { "추", 0.00090000 },
+  { "뫛", 0.00000000 },
+  { "춪", 0.00000000 },
+  { "굷", 0.00000000 },
+  { "띸", 0.00000000 },
+  { "즿", 0.00000000 },
+  { "롩", 0.00000000 },
+  { "겳", 0.00000000 },
+  { "궿", 0.00000000 },
+  { "뗽", 0.00000000 },
+  { "뚅", 0.00000000 },
+  { "뻾", 0.00000000 },
+  { "끾", 0.00000000 },
+  { "틝", 0.00000000 },
+  { "욨", 0.00000000 },
+  { "딍", 0.00000000 },
+  { "쟫", 0.00000000 },
+  { "팏", 0.00000000 },
+  { "홀", 0.00010000 },
+  { "꼏", 0.00000000 },
+  { "쌂", 0.00000000 },
+  { "렚", 0.00000000 },
+  { "튃", 0.00000000 },
+  { "뫒", 0.00000000 },
+  { "뒣", 0.00000000 },
+  { "뭉", 0.00000000 },
+  { "쨇", 0.00000000 },
+  { "냐", 0.00010000 },
+  { "봴", 0.00000000 },
+  { "퐂", 0.00000000 },
+  { "뉠", 0.00000000 },
+  { "븗", 0.00000000 },
+  { "띝", 0.00000000 },
+  { "뮨", 0.00000000 },
+  { "쫢", 0.00000000 },
+  { "첌", 0.00000000 },
+  { "톮", 0.00000000 },
+  { "퐀", 0.00000000 },
+  { "뚃", 0.00000000 },
+  { "몑", 0.00000000 },
+  { "쒙", 0.00000000 },
+  { "틦", 0.00000000 },
+  { "쌫", 0.00000000 },
+  { "쉚", 0.00000000 },
+  { "볓", 0.00000000 },
+  { "뜆", 0.00000000 },
+  { "읋", 0.00000000 },
+  { "꾫", 0.00000000 },
+  { "첯", 0.00000000 },
+  { "큕", 0.00000000 },
+  { "퍟", 0.00000000 },
+  { "뙚", 0.00000000 },
+  { "뛶", 0.00000000 },
+  { "쫧", 0.00000000 },
+  { "푄", 0.00000000 },
+  { "퀥", 0.00000000 },
+  { "핼", 0.00000000 },
+  { "쮴", 0.00000000 },
+  { "횴", 0.00000000 },
+  { "쮖", 0.00000000 },
+  { "펽", 0.00000000 },
+  { "큇", 0.00000000 },
+  { "싌", 0.00000000 },
+  { "뙁", 0.00000000 },
+  { "쪆", 0.00000000 },
+  { "윓", 0.00000000 },
+  { "캦", 0.00000000 },
+  { "엤", 0.00000000 },
+  { "꿡", 0.00000000 },
+  { "뀻", 0.00000000 },
+  { "둡", 0.00000000 },
+  { "믘", 0.00000000 },
+  { "졤", 0.00000000 },
+  { "쿗", 0.00000000 },
+  { "녟", 0.00000000 },
+  { "뮔", 0.00000000 },
+  { "꺈", 0.00000000 },
+  { "뀋", 0.00000000 },
+  { "뙫", 0.00000000 },
+  { "쫸", 0.00000000 },
+  { "뷂", 0.00000000 },
+  { "쳉", 0.00000000 },
+  { "뿦", 0.00000000 },
+  { "굊", 0.00000000 },
+  { "퉬", 0.00000000 },
+  { "햚", 0.00000000 },
+  { "쵍", 0.00000000 },
+  { "틲", 0.00000000 },
+  { "꾚", 0.00000000 },
+  { "펬", 0.00000000 },
+  { "됫", 0.00000000 },
+  { "흺", 0.00000000 },
+  { "쭛", 0.00000000 },
+  { "챯", 0.00000000 },
+  { "쭏", 0.00000000 },
+  { "떾", 0.00000000 },
+  { "뺐", 0.00000000 },
+  { "쎶", 0.00000000 },
+  { "솫", 0.00000000 },
+  { "퓐", 0.00000000 },
+  { "뺕", 0.00000000 },
+  { "넯", 0.00000000 },
+  { "보", 0.00340000 },
+  { "빷", 0.00000000 },
+  { "뤏", 0.00000000 },
+  { "뢦", 0.00000000 },
+  { "탽", 0.00000000 },
+  { "쯷", 0.00000000 },
+  { "옐", 0.00000000 },
+  { "삅", 0.00000000 },
+  { "횺", 0.00000000 },
+  { "굓", 0.00000000 },
+  { "펊", 0.00000000 },
+  { "낾", 0.00000000 },
+  { "끥", 0.00000000 },
+  { "겉", 0.00000000 },
+  { "쨐", 0.00000000 },
+  { "쓘", 0.00000000 },
+  { "굎", 0.00000000 },
+  { "꼛", 0.00000000 },
+  { "뻃", 0.00000000 },
+  { "뫽", 0.00000000 },
+  { "쮶", 0.00000000 },
+  { "툶", 0.00000000 },
+  { "켠", 0.00000000 },
+  { "걞", 0.00000000 },
+  { "뙭", 0.00000000 },
+  { "똳", 0.00000000 },
+  { "펔", 0.00000000 },
+  { "퀷", 0.00000000 },
+  { "풲", 0.00000000 },
+  { "쮬", 0.00000000 },
+  { "좠", 0.00000000 },
+  { "엁", 0.00000000 },
+  { "쥀", 0.00000000 },
+  { "늜", 0.00000000 },
+  { "쪶", 0.00000000 },
+  { "퉽", 0.00000000 },
+  { "뽯", 0.00000000 },
+  { "탠", 0.00000000 },
+  { "쇗", 0.00000000 },
+  { "셺", 0.00000000 },
+  { "이", 0.03350000 },
+  { "퍬", 0.00000000 },
+  { "깎", 0.00000000 },
+  { "둶", 0.00000000 },
+  { "큫", 0.00000000 },
+  { "큵", 0.00000000 },
+  { "탊", 0.00000000 },
+  { "퉁", 0.00000000 },
+  { "쾖", 0.00000000 },
+  { "릚", 0.00000000 },
+  { "뷧", 0.00000000 },
+  { "꿒", 0.00000000 },
+  { "쩎", 0.00000000 },
+  { "젷", 0.00000000 },
+  { "씭", 0.00000000 },
+  { "뎡", 0.00000000 },
+  { "숛", 0.00000000 },
+  { "픚", 0.00000000 },
+  { "꾋", 0.00000000 },
+  { "좲", 0.00000000 },
+  { "빘", 0.00000000 },
+  { "뢧", 0.00000000 },
+  { "횛", 0.00000000 },
+  { "촍", 0.00000000 },
+  { "첹", 0.00000000 },
+  { "쫇", 0.00000000 },
+  { "쯆", 0.00000000 },
+  { "쮁", 0.00000000 },
+  { "링", 0.00020000 },
+  { "싟", 0.00000000 },
+  { "굌", 0.00000000 },
+  { "뤩", 0.00000000 },
+  { "놯", 0.00000000 },
+  { "캏", 0.00000000 },
+  { "몦", 0.00000000 },
+  { "툅", 0.00000000 },
+  { "멘", 0.00010000 },
+  { "퉖", 0.00000000 },
+  { "븣", 0.00000000 },
+  { "턞", 0.00000000 },
+  { "쌹", 0.00000000 },
+  { "텥", 0.00000000 },
+  { "귭", 0.00000000 },
+  { "츧", 0.00000000 },
+  { "쏠", 0.00000000 },
+  { "끦", 0.00000000 },
+  { "뺿", 0.00000000 },
+  { "잶", 0.00000000 },
+  { "뒝", 0.00000000 },
+  { "꾂", 0.00000000 },
+  { "쐵", 0.00000000 },
+  { "튯", 0.00000000 },
+  { "읓", 0.00000000 },
+  { "읩", 0.00000000 },
+  { "롖", 0.00000000 },
+  { "댺", 0.00000000 },
+  { "쁤", 0.00000000 },
+  { "츣", 0.00000000 },
+  { "뉜", 0.00000000 },
+  { "뷣", 0.00000000 },
+  { "쏛", 0.00000000 },
+  { "됙", 0.00000000 },
+  { "놻", 0.00000000 },
+  { "뷢", 0.00000000 },
+  { "얳", 0.00000000 },
+  { "끌", 0.00020000 },
+  { "땧", 0.00000000 },
+  { "썱", 0.00000000 },
+  { "싧", 0.00000000 },
+  { "떭", 0.00000000 },
+  { "뛓", 0.00000000 },
+  { "빊", 0.00000000 },
+  { "쐭", 0.00000000 },
+  { "왼", 0.00000000 },
+  { "햼", 0.00000000 },
+  { "퍽", 0.00000000 },
+  { "뭖", 0.00000000 },
+  { "돞", 0.00000000 },
+  { "쓁", 0.00000000 },
+  { "텙", 0.00000000 },
+  { "곗", 0.00000000 },
+  { "뀼", 0.00000000 },
+  { "넆", 0.00000000 },
+  { "휢", 0.00000000 },
+  { "좭", 0.00000000 },
+  { "꾦", 0.00000000 },
+  { "늠", 0.00000000 },
+  { "뫂", 0.00000000 },
+  { "홺", 0.00000000 },
+  { "벻", 0.00000000 },
+  { "릈", 0.00000000 },
+  { "쎪", 0.00000000 },
+  { "정", 0.00610000 },
+  { "픷", 0.00000000 },
+  { "뤙", 0.00000000 },
+  { "뺍", 0.00000000 },
+  { "볇", 0.00000000 },
+  { "듫", 0.00000000 },
+  { "졶", 0.00000000 },
+  { "헹", 0.00000000 },
+  { "뻷", 0.00000000 },
+  { "뜠", 0.00000000 },
+  { "꾝", 0.00000000 },
+  { "낦", 0.00000000 },
+  { "롐", 0.00000000 },
+  { "옻", 0.00000000 },
+  { "흧", 0.00000000 },
+  { "붅", 0.00000000 },
+  { "퇊", 0.00000000 },
+  { "쀚", 0.00000000 },
+  { "콬", 0.00000000 },
+  { "솩", 0.00000000 },
+  { "몖", 0.00000000 },
+  { "눺", 0.00000000 },
+  { "뛐", 0.00000000 },
+  { "쳥", 0.00000000 },
+  { "턾", 0.00000000 },
+  { "맿", 0.00000000 },
+  { "솎", 0.00000000 },
+  { "뱄", 0.00000000 },
+  { "뇑", 0.00000000 },
+  { "댴", 0.00000000 },
+  { "잷", 0.00000000 },
+  { "캜", 0.00000000 },
+  { "텅", 0.00000000 },
+  { "퐽", 0.00000000 },
+  { "겾", 0.00000000 },
+  { "콴", 0.00000000 },
+  { "끭", 0.00000000 },
+  { "뢝", 0.00000000 },
+  { "휧", 0.00000000 },
+  { "번", 0.00120000 },
+  { "캠", 0.00010000 },
+  { "믻", 0.00000000 },
+  { "뾁", 0.00000000 },
+  { "쌛", 0.00000000 },
+  { "씃", 0.00000000 },
+  { "띴", 0.00000000 },
+  { "먑", 0.00000000 },
+  { "꿼", 0.00000000 },
+  { "롮", 0.00000000 },
+  { "뾼", 0.00000000 },
+  { "촾", 0.00000000 },
+  { "쮊", 0.00000000 },
+  { "쾐", 0.00000000 },
+  { "루", 0.00140000 },
+  { "켒", 0.00000000 },
+  { "잡", 0.00030000 },
+  { "꾉", 0.00000000 },
+  { "워", 0.00050000 },
+  { "닏", 0.00000000 },
+  { "뒑", 0.00000000 },
+  { "첣", 0.00000000 },
+  { "사", 0.00950000 },
+  { "갟", 0.00000000 },
+  { "쇼", 0.00020000 },
+  { "쁼", 0.00000000 },
+  { "끶", 0.00000000 },
+  { "려", 0.00140000 },
+  { "쁍", 0.00000000 },
+  { "춂", 0.00000000 },
+  { "볿", 0.00000000 },
+  { "낕", 0.00000000 },
+  { "셹", 0.00000000 },
+  { "텦", 0.00000000 },
+  { "싫", 0.00000000 },
+  { "뒜", 0.00000000 },
+  { "륹", 0.00000000 },
+  { "쀤", 0.00000000 },
+  { "쳼", 0.00000000 },
+  { "퉰", 0.00000000 },
+  { "쭁", 0.00000000 },
+  { "띘", 0.00000000 },
+  { "맘", 0.00000000 },
+  { "쪤", 0.00000000 },
+  { "곞", 0.00000000 },
+  { "쌳", 0.00000000 },
+  { "댃", 0.00000000 },
+  { "첳", 0.00000000 },
+  { "쵄", 0.00000000 },
+  { "쳿", 0.00000000 },
+  { "릅", 0.00000000 },
+  { "컗", 0.00000000 },
+  { "깕", 0.00000000 },
+  { "팎", 0.00000000 },
+  { "쐦", 0.00000000 },
+  { "뵨", 0.00000000 },
+  { "땃", 0.00000000 },
+  { "풄", 0.00000000 },
+  { "햅", 0.00000000 },
+  { "쒌", 0.00000000 },
+  { "뻵", 0.00000000 },
+  { "귂", 0.00000000 },
+  { "초", 0.00120000 },
+  { "몬", 0.00020000 },
+  { "쮐", 0.00000000 },
+  { "끝", 0.00030000 },
+  { "뾴", 0.00000000 },
+  { "쳟", 0.00000000 },
+  { "뎕", 0.00000000 },
+  { "풮", 0.00000000 },
+  { "뇷", 0.00000000 },
+  { "뽲", 0.00000000 },
+  { "쬷", 0.00000000 },
+  { "뱚", 0.00000000 },
+  { "큱", 0.00000000 },
+  { "챭", 0.00000000 },
+  { "켖", 0.00000000 },
+  { "첈", 0.00000000 },
+  { "힇", 0.00000000 },
+  { "렧", 0.00000000 },
+  { "믿", 0.00010000 },
+  { "곖", 0.00000000 },
+  { "툞", 0.00000000 },
+  { "핐", 0.00000000 },
+  { "혡", 0.00000000 },
+  { "턵", 0.00000000 },
+  { "듺", 0.00000000 },
+  { "먄", 0.00000000 },
+  { "셕", 0.00000000 },
+  { "쮮", 0.00000000 },
+  { "뻄", 0.00000000 },
+  { "퓬", 0.00000000 },
+  { "쨞", 0.00000000 },
+  { "롌", 0.00000000 },
+  { "뀟", 0.00000000 },
+  { "꾛", 0.00000000 },
+  { "덪", 0.00000000 },
+  { "뺭", 0.00000000 },
+  { "봸", 0.00000000 },
+  { "끬", 0.00000000 },
+  { "녷", 0.00000000 },
+  { "밌", 0.00000000 },
+  { "찓", 0.00000000 },
+  { "뺵", 0.00000000 },
+  { "뎢", 0.00000000 },
+  { "셫", 0.00000000 },
+  { "폫", 0.00000000 },
+  { "얆", 0.00000000 },
+  { "덈", 0.00000000 },
+  { "쫼", 0.00000000 },
+  { "죴", 0.00000000 },
+  { "쨕", 0.00000000 },
+  { "쪋", 0.00000000 },
+  { "쮻", 0.00000000 },
+  { "옇", 0.00000000 },
+  { "턚", 0.00000000 },
+  { "뢌", 0.00000000 },
+  { "싽", 0.00000000 },
+  { "툵", 0.00000000 },
+  { "넵", 0.00000000 },
+  { "냴", 0.00000000 },
+  { "꾐", 0.00000000 },
+  { "랲", 0.00000000 },
+  { "멶", 0.00000000 },
+  { "섷", 0.00000000 },
+  { "뼒", 0.00000000 },
+  { "돆", 0.00000000 },
+  { "겐", 0.00010000 },
+  { "뽣", 0.00000000 },
+  { "떧", 0.00000000 },
+  { "썵", 0.00000000 },
+  { "윉", 0.00000000 },
+  { "헙", 0.00000000 },
+  { "삘", 0.00000000 },
+  { "섧", 0.00000000 },
+  { "헽", 0.00000000 },
+  { "뎳", 0.00000000 },
+  { "밮", 0.00000000 },
+  { "웺", 0.00000000 },
+  { "쨼", 0.00000000 },
+  { "퓆", 0.00000000 },
+  { "놬", 0.00000000 },
+  { "졝", 0.00000000 },
+  { "푳", 0.00000000 },
+  { "녥", 0.00000000 },
+  { "뼺", 0.00000000 },
+  { "욏", 0.00000000 },
+  { "쫪", 0.00000000 },
+  { "푙", 0.00000000 },
+  { "뇭", 0.00000000 },
+  { "헠", 0.00000000 },
+  { "쨒", 0.00000000 },
+  { "밓", 0.00000000 },
+  { "봥", 0.00000000 },
+  { "굒", 0.00000000 },
+  { "퉙", 0.00000000 },
+  { "폡", 0.00000000 },
+  { "횿", 0.00000000 },
+  { "냅", 0.00000000 },
+  { "튛", 0.00000000 },
+  { "쓧", 0.00000000 },
+  { "칛", 0.00000000 },
+  { "킡", 0.00000000 },
+  { "딹", 0.00000000 },
+  { "랝", 0.00000000 },
+  { "줣", 0.00000000 },
+  { "뮵", 0.00000000 },
+  { "뭨", 0.00000000 },
+  { "쥽", 0.00000000 },
+  { "겮", 0.00000000 },
+  { "욕", 0.00010000 },
+  { "씎", 0.00000000 },
+  { "숈", 0.00000000 },
+  { "퐮", 0.00000000 },
+  { "봆", 0.00000000 },
+  { "윒", 0.00000000 },
+  { "핔", 0.00000000 },
+  { "웽", 0.00000000 },
+  { "슳", 0.00000000 },
+  { "뜳", 0.00000000 },
+  { "봓", 0.00000000 },
+  { "뵰", 0.00000000 },
+  { "싰", 0.00000000 },
+  { "넡", 0.00000000 },
+  { "욯", 0.00000000 },
+  { "옌", 0.00000000 },
+  { "뀞", 0.00000000 },
+  { "굽", 0.00000000 },
+  { "놲", 0.00000000 },
+  { "듐", 0.00000000 },
+  { "쪻", 0.00000000 },
+  { "뙌", 0.00000000 },
+  { "줰", 0.00000000 },
+  { "샘", 0.00000000 },
+  { "멷", 0.00000000 },
+  { "눀", 0.00000000 },
+  { "꽬", 0.00000000 },
+  { "샟", 0.00000000 },
+  { "푸", 0.00020000 },
+  { "쳋", 0.00000000 },
+  { "샿", 0.00000000 },
+  { "칀", 0.00000000 },
+  { "릷", 0.00000000 },
+  { "밂", 0.00000000 },
+  { "쟺", 0.00000000 },
+  { "픉", 0.00000000 },
+  { "힛", 0.00000000 },
+  { "쇴", 0.00000000 },
+  { "캚", 0.00000000 },
+  { "먾", 0.00000000 },
+  { "궩", 0.00000000 },
+  { "됱", 0.00000000 },
+  { "뮮", 0.00000000 },
+  { "팂", 0.00000000 },
+  { "겇", 0.00000000 },
+  { "껤", 0.00000000 },
+  { "쿜", 0.00000000 },
+  { "쉩", 0.00000000 },
+  { "넱", 0.00000000 },
+  { "힔", 0.00000000 },
+  { "맍", 0.00000000 },
+  { "뭷", 0.00000000 },
+  { "쐶", 0.00000000 },
+  { "곊", 0.00000000 },
+  { "쌒", 0.00000000 },
+  { "퐪", 0.00000000 },
+  { "챌", 0.00000000 },
+  { "톽", 0.00000000 },
+  { "곕", 0.00000000 },
+  { "쉫", 0.00000000 },
+  { "꿵", 0.00000000 },
+  { "썄", 0.00000000 },
+  { "콸", 0.00000000 },
+  { "뿣", 0.00000000 },
+  { "싃", 0.00000000 },
+  { "쬲", 0.00000000 },
+  { "놉", 0.00000000 },
+  { "몰", 0.00020000 },
+  { "핒", 0.00000000 },
+  { "꺇", 0.00000000 },
+  { "볢", 0.00000000 },
+  { "쪙", 0.00000000 },
+  { "꾆", 0.00000000 },
+  { "년", 0.00990000 },
+  { "뇞", 0.00000000 },
+  { "뾑", 0.00000000 },
+  { "뮗", 0.00000000 },
+  { "뫆", 0.00000000 },
+  { "먥", 0.00000000 },
+  { "풤", 0.00000000 },
+  { "랶", 0.00000000 },
+  { "뺅", 0.00000000 },
+  { "젍", 0.00000000 },
+  { "퓔", 0.00000000 },
+  { "몪", 0.00000000 },
+  { "삶", 0.00000000 },
+  { "솢", 0.00000000 },
+  { "핤", 0.00000000 },
+  { "븂", 0.00000000 },
+  { "쵮", 0.00000000 },
+  { "맺", 0.00010000 },
+  { "됭", 0.00000000 },
+  { "툊", 0.00000000 },
+  { "삀", 0.00000000 },
+  { "뜯", 0.00000000 },
+  { "옝", 0.00000000 },
+  { "꽇", 0.00000000 },
+  { "훲", 0.00000000 },
+  { "섏", 0.00000000 },
+  { "죔", 0.00000000 },
+  { "톕", 0.00000000 },
+  { "늘", 0.00020000 },
+  { "퇚", 0.00000000 },
+  { "떨", 0.00020000 },
+  { "팕", 0.00000000 },
+  { "퇝", 0.00000000 },
+  { "옚", 0.00000000 },
+  { "멪", 0.00000000 },
+  { "샪", 0.00000000 },
+  { "칟", 0.00000000 },
+  { "꿟", 0.00000000 },
+  { "빂", 0.00000000 },
+  { "쪾", 0.00000000 },
+  { "뛧", 0.00000000 },
+  { "긞", 0.00000000 },
+  { "숆", 0.00000000 },
+  { "쿧", 0.00000000 },
+  { "걸", 0.00030000 },
+  { "갏", 0.00000000 },
+  { "봌", 0.00000000 },
+  { "쮇", 0.00000000 },
+  { "툯", 0.00000000 },
+  { "긛", 0.00000000 },
+  { "땲", 0.00000000 },
+  { "뮴", 0.00000000 },
+  { "샎", 0.00000000 },
+  { "녖", 0.00000000 },
+  { "봏", 0.00000000 },
+  { "폏", 0.00000000 },
+  { "둅", 0.00000000 },
+  { "쯽", 0.00000000 },
+  { "썙", 0.00000000 },
+  { "틑", 0.00000000 },
+  { "뤛", 0.00000000 },
+  { "숼", 0.00000000 },
+  { "웪", 0.00000000 },
+  { "쒦", 0.00000000 },
+  { "쑗", 0.00000000 },
+  { "쭈", 0.00000000 },
+  { "톪", 0.00000000 },
+  { "폎", 0.00000000 },
+  { "랰", 0.00000000 },
+  { "맟", 0.00000000 },
+  { "뾿", 0.00000000 },
+  { "뤪", 0.00000000 },
+  { "쳜", 0.00000000 },
+  { "힑", 0.00000000 },
+  { "쮦", 0.00000000 },
+  { "콹", 0.00000000 },
+  { "욾", 0.00000000 },
+  { "뷤", 0.00000000 },
+  { "슻", 0.00000000 },
+  { "킏", 0.00000000 },
+  { "쳝", 0.00000000 },
+  { "뙍", 0.00000000 },
+  { "뭯", 0.00000000 },
+  { "묠", 0.00000000 },
+  { "틠", 0.00000000 },
+  { "떛", 0.00000000 },
+  { "눟", 0.00000000 },
+  { "딃", 0.00000000 },
+  { "쒈", 0.00000000 },
+  { "렎", 0.00000000 },
+  { "쳾", 0.00000000 },
+  { "챪", 0.00000000 },
+  { "띾", 0.00000000 },
+  { "슂", 0.00000000 },
+  { "쇹", 0.00000000 },
+  { "꾿", 0.00000000 },
+  { "뭅", 0.00000000 },
+  { "넜", 0.00000000 },
+  { "팜", 0.00000000 },
+  { "칆", 0.00000000 },
+  { "뱲", 0.00000000 },
+  { "숰", 0.00000000 },
+  { "죻", 0.00000000 },
+  { "톆", 0.00000000 },
+  { "뇕", 0.00000000 },
+  { "뼃", 0.00000000 },
+  { "쮣", 0.00000000 },
+  { "옓", 0.00000000 },
+  { "슛", 0.00000000 },
+  { "앳", 0.00000000 },
+  { "렪", 0.00000000 },
+  { "론", 0.00060000 },
+  { "궱", 0.00000000 },
+  { "눣", 0.00000000 },
+  { "췢", 0.00000000 },
+  { "샦", 0.00000000 },
+  { "쳧", 0.00000000 },
+  { "뽾", 0.00000000 },
+  { "츜", 0.00000000 },
+  { "툭", 0.00000000 },
+  { "굶", 0.00000000 },
+  { "뀥", 0.00000000 },
+  { "떪", 0.00000000 },
+  { "묏", 0.00000000 },
+  { "쐰", 0.00000000 },
+  { "쳭", 0.00000000 },
+  { "딸", 0.00010000 },
+  { "는", 0.02220000 },
+  { "맨", 0.00010000 },
+  { "및", 0.00050000 },
+  { "큸", 0.00000000 },
+  { "뫖", 0.00000000 },
+  { "딤", 0.00000000 },
+  { "궔", 0.00000000 },
+  { "룁", 0.00000000 },
+  { "쵲", 0.00000000 },
+  { "칎", 0.00000000 },
+  { "앑", 0.00000000 },
+  { "쬯", 0.00000000 },
+  { "춶", 0.00000000 },
+  { "왩", 0.00000000 },
+  { "뮝", 0.00000000 },
+  { "균", 0.00020000 },
+  { "룙", 0.00000000 },
+  { "굉", 0.00000000 },
+  { "쭸", 0.00000000 },
+  { "쒺", 0.00000000 },
+  { "쩦", 0.00000000 },
+  { "컮", 0.00000000 },
+  { "뗱", 0.00000000 },
+  { "볟", 0.00000000 },
+  { "쑏", 0.00000000 },
+  { "뛖", 0.00000000 },
+  { "큏", 0.00000000 },
+  { "퍭", 0.00000000 },
+  { "퓙", 0.00000000 },
+  { "둠", 0.00000000 },
+  { "귿", 0.00000000 },
+  { "믪", 0.00000000 },
+  { "횹", 0.00000000 },
+  { "묅", 0.00000000 },
+  { "뵜", 0.00000000 },
+  { "츥", 0.00000000 },
+  { "앯", 0.00000000 },
+  { "켨", 0.00000000 },
+  { "뜾", 0.00000000 },
+  { "찖", 0.00000000 },
+  { "읪", 0.00000000 },
+  { "춇", 0.00000000 },
+  { "럺", 0.00000000 },
+  { "넠", 0.00000000 },
+  { "볌", 0.00000000 },
+  { "젚", 0.00000000 },
+  { "룆", 0.00000000 },
+  { "떄", 0.00000000 },
+  { "짫", 0.00000000 },
+  { "붔", 0.00000000 },
+  { "힕", 0.00000000 },
+  { "쎑", 0.00000000 },
+  { "꾜", 0.00000000 },
+  { "뛡", 0.00000000 },
+  { "옴", 0.00000000 },
+  { "셓", 0.00000000 },
+  { "뽟", 0.00000000 },
+  { "쟜", 0.00000000 },
+  { "끅", 0.00000000 },
+  { "쏩", 0.00000000 },
+  { "쥩", 0.00000000 },
+  { "샋", 0.00000000 },
+  { "뀸", 0.00000000 },
+  { "횩", 0.00000000 },
+  { "싏", 0.00000000 },
+  { "곦", 0.00000000 },
+  { "왝", 0.00000000 },
+  { "챁", 0.00000000 },
+  { "쑒", 0.00000000 },
+  { "땄", 0.00000000 },
+  { "찏", 0.00000000 },
+  { "퓒", 0.00000000 },
+  { "섬", 0.00030000 },
+  { "랾", 0.00000000 },
+  { "졄", 0.00000000 },
+  { "푒", 0.00000000 },
+  { "쟶", 0.00000000 },
+  { "쯕", 0.00000000 },
+  { "즯", 0.00000000 },
+  { "큝", 0.00000000 },
+  { "뻻", 0.00000000 },
+  { "꽨", 0.00000000 },
+  { "샆", 0.00000000 },
+  { "홐", 0.00000000 },
+  { "샨", 0.00000000 },
+  { "뛵", 0.00000000 },
+  { "띬", 0.00000000 },
+  { "몡", 0.00000000 },
+  { "셐", 0.00000000 },
+  { "욝", 0.00000000 },
+  { "슚", 0.00000000 },
+  { "쥎", 0.00000000 },
+  { "곛", 0.00000000 },
+  { "뮱", 0.00000000 },
+  { "궴", 0.00000000 },
+  { "냬", 0.00000000 },
+  { "굿", 0.00000000 },
+  { "믔", 0.00000000 },
+  { "뀃", 0.00000000 },
+  { "뤁", 0.00000000 },
+  { "팬", 0.00010000 },
+  { "퓶", 0.00000000 },
+  { "궒", 0.00000000 },
+  { "뉂", 0.00000000 },
+  { "뷏", 0.00000000 },
+  { "거", 0.00210000 },
+  { "켮", 0.00000000 },
+  { "봨", 0.00000000 },
+  { "픹", 0.00000000 },
+  { "껳", 0.00000000 },
+  { "꾮", 0.00000000 },
+  { "작", 0.00230000 },
+  { "뛮", 0.00000000 },
+  { "귏", 0.00000000 },
+  { "먴", 0.00000000 },
+  { "녏", 0.00000000 },
+  { "쉬", 0.00010000 },
+  { "궟", 0.00000000 },
+  { "죥", 0.00000000 },
+  { "놌", 0.00000000 },
+  { "헒", 0.00000000 },
+  { "녆", 0.00000000 },
+  { "듕", 0.00000000 },
+  { "뛊", 0.00000000 },
+  { "쓷", 0.00000000 },
+  { "톩", 0.00000000 },
+  { "쥐", 0.00000000 },
+  { "뜘", 0.00000000 },
+  { "먌", 0.00000000 },
+  { "좚", 0.00000000 },
+  { "튟", 0.00000000 },
+  { "뱣", 0.00000000 },
+  { "왞", 0.00000000 },
+  { "굤", 0.00000000 },
+  { "셰", 0.00010000 },
+  { "엗", 0.00000000 },
+  { "쟔", 0.00000000 },
+  { "줕", 0.00000000 },
+  { "뛾", 0.00000000 },
+  { "췀", 0.00000000 },
+  { "귯", 0.00000000 },
+  { "맴", 0.00000000 },
+  { "떶", 0.00000000 },
+  { "탖", 0.00000000 },
+  { "쓝", 0.00000000 },
+  { "큶", 0.00000000 },
+  { "흄", 0.00000000 },
+  { "턧", 0.00000000 },
+  { "쫲", 0.00000000 },
+  { "핍", 0.00000000 },
+  { "쓵", 0.00000000 },
+  { "듄", 0.00000000 },
+  { "죰", 0.00000000 },
+  { "쨈", 0.00000000 },
+  { "훯", 0.00000000 },
+  { "찇", 0.00000000 },
+  { "윝", 0.00000000 },
+  { "뢘", 0.00000000 },
+  { "툲", 0.00000000 },
+  { "싼", 0.00000000 },
+  { "챦", 0.00000000 },
+  { "걀", 0.00000000 },
+  { "짍", 0.00000000 },
+  { "웎", 0.00000000 },
+  { "생", 0.00200000 },
+  { "쯵", 0.00000000 },
+  { "싓", 0.00000000 },
+  { "졼", 0.00000000 },
+  { "쩗", 0.00000000 },
+  { "쬳", 0.00000000 },
+  { "굈", 0.00000000 },
+  { "됻", 0.00000000 },
+  { "뢥", 0.00000000 },
+  { "럃", 0.00000000 },
+  { "몛", 0.00000000 },
+  { "윯", 0.00000000 },
+  { "볪", 0.00000000 },
+  { "쐌", 0.00000000 },
+  { "넄", 0.00000000 },
+  { "뱯", 0.00000000 },
+  { "렋", 0.00000000 },
+  { "쏫", 0.00000000 },
+  { "뷟", 0.00000000 },
+  { "희", 0.00030000 },
+  { "긶", 0.00000000 },
+  { "쉪", 0.00000000 },
+  { "힉", 0.00000000 },
+  { "퓇", 0.00000000 },
+  { "챜", 0.00000000 },
+  { "턁", 0.00000000 },
+  { "윂", 0.00000000 },
+  { "츳", 0.00000000 },
+  { "픐", 0.00000000 },
+  { "껡", 0.00000000 },
+  { "뿆", 0.00000000 },
+  { "턌", 0.00000000 },
+  { "뮎", 0.00000000 },
+  { "웤", 0.00000000 },
+  { "곴", 0.00000000 },
+  { "먍", 0.00000000 },
+  { "쩓", 0.00000000 },
+  { "졥", 0.00000000 },
+  { "찻", 0.00000000 },
+  { "츗", 0.00000000 },
+  { "촋", 0.00000000 },
+  { "꾩", 0.00000000 },
+  { "꺌", 0.00000000 },
+  { "뀯", 0.00000000 },
+  { "면", 0.00270000 },
+  { "팩", 0.00000000 },
+  { "뗌", 0.00000000 },
+  { "뢪", 0.00000000 },
+  { "쿾", 0.00000000 },
+  { "굫", 0.00000000 },
+  { "룷", 0.00000000 },
+  { "쬈", 0.00000000 },
+  { "눭", 0.00000000 },
+  { "노", 0.00170000 },
+  { "닺", 0.00000000 },
+  { "쑝", 0.00000000 },
+  { "뗗", 0.00000000 },
+  { "훹", 0.00000000 },
+  { "긺", 0.00000000 },
+  { "졽", 0.00000000 },
+  { "쵇", 0.00000000 },
+  { "굩", 0.00000000 },
+  { "혒", 0.00000000 },
+  { "꾌", 0.00000000 },
+  { "멆", 0.00000000 },
+  { "몵", 0.00000000 },
+  { "쾶", 0.00000000 },
+  { "뇌", 0.00010000 },
+  { "졀", 0.00000000 },
+  { "뢀", 0.00000000 },
+  { "틁", 0.00000000 },
+  { "개", 0.00310000 },
+  { "렛", 0.00000000 },
+  { "쀵", 0.00000000 },
+  { "삭", 0.00010000 },
+  { "시", 0.00950000 },
+  { "즏", 0.00000000 },
+  { "됋", 0.00000000 },
+  { "던", 0.00150000 },
+  { "뺓", 0.00000000 },
+  { "녓", 0.00000000 },
+  { "뭞", 0.00000000 },
+  { "럂", 0.00000000 },
+  { "뀎", 0.00000000 },
+  { "껞", 0.00000000 },
+  { "욙", 0.00000000 },
+  { "뒥", 0.00000000 },
+  { "뉚", 0.00000000 },
+  { "햷", 0.00000000 },
+  { "덮", 0.00000000 },
+  { "뱺", 0.00000000 },
+  { "궵", 0.00000000 },
+  { "폹", 0.00000000 },
+  { "첖", 0.00000000 },
+  { "땷", 0.00000000 },
+  { "쐪", 0.00000000 },
+  { "젮", 0.00000000 },
+  { "픕", 0.00000000 },
+  { "싋", 0.00000000 },
+  { "껈", 0.00000000 },
+  { "뼶", 0.00000000 },
+  { "캰", 0.00000000 },
+  { "쨏", 0.00000000 },
+  { "쀿", 0.00000000 },
+  { "뼢", 0.00000000 },
+  { "힂", 0.00000000 },
+  { "쨲", 0.00000000 },
+  { "뾡", 0.00000000 },
+  { "뒄", 0.00000000 },
+  { "롍", 0.00000000 },
+  { "꼍", 0.00000000 },
+  { "뚎", 0.00000000 },
+  { "끣", 0.00000000 },
+  { "됈", 0.00000000 },
+  { "뙘", 0.00000000 },
+  { "욅", 0.00000000 },
+  { "쩤", 0.00000000 },
+  { "뜦", 0.00000000 },
+  { "쥫", 0.00000000 },
+  { "곏", 0.00000000 },
+  { "앭", 0.00000000 },
+  { "잎", 0.00010000 },
+  { "똗", 0.00000000 },
+  { "빜", 0.00000000 },
+  { "냡", 0.00000000 },
+  { "랢", 0.00000000 },
+  { "늮", 0.00000000 },
+  { "퇅", 0.00000000 },
+  { "뾇", 0.00000000 },
+  { "푤", 0.00000000 },
+  { "춷", 0.00000000 },
+  { "붑", 0.00000000 },
+  { "콠", 0.00000000 },
+  { "줤", 0.00000000 },
+  { "튽", 0.00000000 },
+  { "띦", 0.00000000 },
+  { "땋", 0.00000000 },
+  { "뼵", 0.00000000 },
+  { "낅", 0.00000000 },
+  { "쎚", 0.00000000 },
+  { "띲", 0.00000000 },
+  { "퓟", 0.00000000 },
+  { "얰", 0.00000000 },
+  { "촟", 0.00000000 },
+  { "뻠", 0.00000000 },
+  { "꽴", 0.00000000 },
+  { "젠", 0.00010000 },
+  { "믵", 0.00000000 },
+  { "뼀", 0.00000000 },
+  { "훁", 0.00000000 },
+  { "찌", 0.00000000 },
+  { "맛", 0.00000000 },
+  { "멩", 0.00000000 },
+  { "듨", 0.00000000 },
+  { "캞", 0.00000000 },
+  { "쌎", 0.00000000 },
+  { "왤", 0.00000000 },
+  { "쎦", 0.00000000 },
+  { "쩃", 0.00000000 },
+  { "믯", 0.00000000 },
+  { "꿨", 0.00000000 },
+  { "돼", 0.00000000 },
+  { "끙", 0.00000000 },
+  { "캆", 0.00000000 },
+  { "쀒", 0.00000000 },
+  { "킳", 0.00000000 },
+  { "꽎", 0.00000000 },
+  { "굳", 0.00000000 },
+  { "쟰", 0.00000000 },
+  { "겏", 0.00000000 },
+  { "퍀", 0.00000000 },
+  { "믎", 0.00000000 },
+  { "킟", 0.00000000 },
+  { "뷶", 0.00000000 },
+  { "츔", 0.00000000 },
+  { "꿂", 0.00000000 },
+  { "뜥", 0.00000000 },
+  { "헖", 0.00000000 },
+  { "꿓", 0.00000000 },
+  { "힃", 0.00000000 },
+  { "떎", 0.00000000 },
+  { "뇯", 0.00000000 },
+  { "뻌", 0.00000000 },
+  { "싂", 0.00000000 },
+  { "끡", 0.00000000 },
+  { "뻗", 0.00000000 },
+  { "뉌", 0.00000000 },
+  { "쵒", 0.00000000 },
+  { "낀", 0.00000000 },
+  { "끖", 0.00000000 },
+  { "뒚", 0.00000000 },
+  { "엵", 0.00000000 },
+  { "럫", 0.00000000 },
+  { "숀", 0.00000000 },
+  { "쩋", 0.00000000 },
+  { "됷", 0.00000000 },
+  { "뤿", 0.00000000 },
+  { "뺷", 0.00000000 },
+  { "윰", 0.00000000 },
+  { "밨", 0.00000000 },
+  { "큥", 0.00000000 },
+  { "팞", 0.00000000 },
+  { "캽", 0.00000000 },
+  { "쳁", 0.00000000 },
+  { "끪", 0.00000000 },
+  { "슲", 0.00000000 },
+  { "캥", 0.00000000 },
+  { "쏕", 0.00000000 },
+  { "쿲", 0.00000000 },
+  { "톧", 0.00000000 },
+  { "괿", 0.00000000 },
+  { "탦", 0.00000000 },
+  { "춎", 0.00000000 },
+  { "멛", 0.00000000 },
+  { "쥏", 0.00000000 },
+  { "츌", 0.00000000 },
+  { "닗", 0.00000000 },
+  { "햞", 0.00000000 },
+  { "핵", 0.00020000 },
+  { "덿", 0.00000000 },
+  { "쐇", 0.00000000 },
+  { "됹", 0.00000000 },
+  { "쇡", 0.00000000 },
+  { "톡", 0.00000000 },
+  { "갊", 0.00000000 },
+  { "밠", 0.00000000 },
+  { "똸", 0.00000000 },
+  { "돦", 0.00000000 },
+  { "똇", 0.00000000 },
+  { "괦", 0.00000000 },
+  { "븻", 0.00000000 },
+  { "띎", 0.00000000 },
+  { "쐷", 0.00000000 },
+  { "젤", 0.00010000 },
+  { "띹", 0.00000000 },
+  { "쭻", 0.00000000 },
+  { "냣", 0.00000000 },
+  { "쭷", 0.00000000 },
+  { "튳", 0.00000000 },
+  { "좞", 0.00000000 },
+  { "핧", 0.00000000 },
+  { "놋", 0.00000000 },
+  { "늒", 0.00000000 },
+  { "뜂", 0.00000000 },
+  { "뤱", 0.00000000 },
+  { "튓", 0.00000000 },
+  { "꿣", 0.00000000 },
+  { "뙟", 0.00000000 },
+  { "뛦", 0.00000000 },
+  { "봲", 0.00000000 },
+  { "썃", 0.00000000 },
+  { "후", 0.00290000 },
+  { "쑆", 0.00000000 },
+  { "뱠", 0.00000000 },
+  { "좍", 0.00000000 },
+  { "쓳", 0.00000000 },
+  { "퓳", 0.00000000 },
+  { "씽", 0.00000000 },
+  { "띅", 0.00000000 },
+  { "댙", 0.00000000 },
+  { "퉂", 0.00000000 },
+  { "튾", 0.00000000 },
+  { "쫅", 0.00000000 },
+  { "욋", 0.00000000 },
+  { "쩊", 0.00000000 },
+  { "꿥", 0.00000000 },
+  { "숮", 0.00000000 },
+  { "귢", 0.00000000 },
+  { "댕", 0.00000000 },
+  { "쬨", 0.00000000 },
+  { "껍", 0.00000000 },
+  { "밗", 0.00000000 },
+  { "친", 0.00050000 },
+  { "뿲", 0.00000000 },
+  { "뀅", 0.00000000 },
+  { "쑸", 0.00000000 },
+  { "죞", 0.00000000 },
+  { "떻", 0.00000000 },
+  { "괹", 0.00000000 },
+  { "술", 0.00070000 },
+  { "뤤", 0.00000000 },
+  { "쒳", 0.00000000 },
+  { "푀", 0.00000000 },
+  { "됂", 0.00000000 },
+  { "훗", 0.00000000 },
+  { "똛", 0.00000000 },
+  { "칇", 0.00000000 },
+  { "쀗", 0.00000000 },
+  { "곢", 0.00000000 },
+  { "냠", 0.00000000 },
+  { "숃", 0.00000000 },
+  { "벱", 0.00000000 },
+  { "곳", 0.00040000 },
+  { "쥜", 0.00000000 },
+  { "뒦", 0.00000000 },
+  { "되", 0.00650000 },
+  { "싒", 0.00000000 },
+  { "깋", 0.00000000 },
+  { "뗳", 0.00000000 },
+  { "뒀", 0.00000000 },
+  { "쑽", 0.00000000 },
+  { "뻁", 0.00000000 },
+  { "챲", 0.00000000 },
+  { "죝", 0.00000000 },
+  { "묄", 0.00000000 },
+  { "딵", 0.00000000 },
+  { "켡", 0.00000000 },
+  { "휆", 0.00000000 },
+  { "졢", 0.00000000 },
+  { "롰", 0.00000000 },
+  { "뭚", 0.00000000 },
+  { "뢸", 0.00000000 },
+  { "륰", 0.00000000 },
+  { "좯", 0.00000000 },
+  { "굱", 0.00000000 },
+  { "쩇", 0.00000000 },
+  { "횧", 0.00000000 },
+  { "럊", 0.00000000 },
+  { "흤", 0.00000000 },
+  { "뵽", 0.00000000 },
+  { "퍴", 0.00000000 },
+  { "핻", 0.00000000 },
+  { "쭢", 0.00000000 },
+  { "퉓", 0.00000000 },
+  { "샅", 0.00000000 },
+  { "흭", 0.00000000 },
+  { "뱃", 0.00000000 },
+  { "샾", 0.00000000 },
+  { "힋", 0.00000000 },
+  { "먬", 0.00000000 },
+  { "죆", 0.00000000 },
+  { "윆", 0.00000000 },
+  { "읙", 0.00000000 },
+  { "뵛", 0.00000000 },
+  { "뫩", 0.00000000 },
+  { "뮦", 0.00000000 },
+  { "봍", 0.00000000 },
+  { "벯", 0.00000000 },
+  { "등", 0.00270000 },
+  { "뼛", 0.00000000 },
+  { "씻", 0.00000000 },
+  { "뽑", 0.00000000 },
+  { "됸", 0.00000000 },
+  { "꾼", 0.00000000 },
+  { "넊", 0.00000000 },
+  { "즌", 0.00030000 },
+  { "궁", 0.00020000 },
+  { "찗", 0.00000000 },
+  { "뉘", 0.00010000 },
+  { "창", 0.00060000 },
+  { "됆", 0.00000000 },
+  { "툥", 0.00000000 },
+  { "뀠", 0.00000000 },
+  { "뒵", 0.00000000 },
+  { "료", 0.00050000 },
+  { "샑", 0.00000000 },
+  { "덼", 0.00000000 },
+  { "쨣", 0.00000000 },
+  { "뛗", 0.00000000 },
+  { "귉", 0.00000000 },
+  { "녂", 0.00000000 },
+  { "둛", 0.00000000 },
+  { "틶", 0.00000000 },
+  { "펅", 0.00000000 },
+  { "픴", 0.00000000 },
+  { "볾", 0.00000000 },
+  { "압", 0.00030000 },
+  { "긦", 0.00000000 },
+  { "쩜", 0.00000000 },
+  { "몘", 0.00000000 },
+  { "갇", 0.00000000 },
+  { "룄", 0.00000000 },
+  { "큓", 0.00000000 },
+  { "탾", 0.00000000 },
+  { "뮀", 0.00000000 },
+  { "싱", 0.00020000 },
+  { "젅", 0.00000000 },
+  { "쭇", 0.00000000 },
+  { "었", 0.00580000 },
+  { "켯", 0.00000000 },
+  { "혅", 0.00000000 },
+  { "꽀", 0.00000000 },
+  { "톊", 0.00000000 },
+  { "렂", 0.00000000 },
+  { "랟", 0.00000000 },
+  { "찠", 0.00000000 },
+  { "툡", 0.00000000 },
+  { "헪", 0.00000000 },
+  { "꼺", 0.00000000 },
+  { "앉", 0.00000000 },
+  { "줁", 0.00000000 },
+  { "슓", 0.00000000 },
+  { "홬", 0.00000000 },
+  { "녈", 0.00000000 },
+  { "입", 0.00130000 },
+  { "헫", 0.00000000 },
+  { "꽆", 0.00000000 },
+  { "넬", 0.00000000 },
+  { "뀣", 0.00000000 },
+  { "몋", 0.00000000 },
+  { "쌮", 0.00000000 },
+  { "갢", 0.00000000 },
+  { "뤊", 0.00000000 },
+  { "쳊", 0.00000000 },
+  { "쫝", 0.00000000 },
+  { "왡", 0.00000000 },
+  { "쥨", 0.00000000 },
+  { "쓢", 0.00000000 },
+  { "룭", 0.00000000 },
+  { "뵾", 0.00000000 },
+  { "뾋", 0.00000000 },
+  { "돇", 0.00000000 },
+  { "됒", 0.00000000 },
+  { "퍏", 0.00000000 },
+  { "찤", 0.00000000 },
+  { "샌", 0.00000000 },
+  { "튡", 0.00000000 },
+  { "풷", 0.00000000 },
+  { "뾧", 0.00000000 },
+  { "깞", 0.00000000 },
+  { "뎼", 0.00000000 },
+  { "뒲", 0.00000000 },
+  { "췜", 0.00000000 },
+  { "묷", 0.00000000 },
+  { "쿤", 0.00000000 },
+  { "쫦", 0.00000000 },
+  { "돽", 0.00000000 },
+  { "삉", 0.00000000 },
+  { "쎣", 0.00000000 },
+  { "궉", 0.00000000 },
+  { "붍", 0.00000000 },
+  { "봫", 0.00000000 },
+  { "규", 0.00050000 },
+  { "꿜", 0.00000000 },
+  { "륏", 0.00000000 },
+  { "훊", 0.00000000 },
+  { "껦", 0.00000000 },
+  { "뗢", 0.00000000 },
+  { "죅", 0.00000000 },
+  { "찈", 0.00000000 },
+  { "웂", 0.00000000 },
+  { "촛", 0.00000000 },
+  { "킂", 0.00000000 },
+  { "훠", 0.00000000 },
+  { "컘", 0.00000000 },
+  { "좸", 0.00000000 },
+  { "밪", 0.00000000 },
+  { "톈", 0.00000000 },
+  { "챗", 0.00000000 },
+  { "뤎", 0.00000000 },
+  { "컽", 0.00000000 },
+  { "춍", 0.00000000 },
+  { "챓", 0.00000000 },
+  { "묣", 0.00000000 },
+  { "뉽", 0.00000000 },
+  { "멍", 0.00000000 },
+  { "줵", 0.00000000 },
+  { "눤", 0.00000000 },
+  { "뗡", 0.00000000 },
+  { "읤", 0.00000000 },
+  { "좔", 0.00000000 },
+  { "퓓", 0.00000000 },
+  { "쭅", 0.00000000 },
+  { "뎑", 0.00000000 },
+  { "껆", 0.00000000 },
+  { "얊", 0.00000000 },
+  { "퍖", 0.00000000 },
+  { "슊", 0.00000000 },
+  { "햢", 0.00000000 },
+  { "쇏", 0.00000000 },
+  { "녛", 0.00000000 },
+  { "겱", 0.00000000 },
+  { "뽮", 0.00000000 },
+  { "뉴", 0.00030000 },
+  { "쾢", 0.00000000 },
+  { "닌", 0.00020000 },
+  { "윎", 0.00000000 },
+  { "췓", 0.00000000 },
+  { "쎔", 0.00000000 },
+  { "눇", 0.00000000 },
+  { "놪", 0.00000000 },
+  { "봖", 0.00000000 },
+  { "뵌", 0.00000000 },
+  { "엏", 0.00000000 },
+  { "햤", 0.00000000 },
+  { "딆", 0.00000000 },
+  { "읨", 0.00000000 },
+  { "혚", 0.00000000 },
+  { "쑞", 0.00000000 },
+  { "됴", 0.00000000 },
+  { "닿", 0.00000000 },
+  { "흓", 0.00000000 },
+  { "낯", 0.00000000 },
+  { "놇", 0.00000000 },
+  { "붯", 0.00000000 },
+  { "킇", 0.00000000 },
+  { "갦", 0.00000000 },
+  { "퇿", 0.00000000 },
+  { "찒", 0.00000000 },
+  { "갵", 0.00000000 },
+  { "뺝", 0.00000000 },
+  { "홑", 0.00000000 },
+  { "삇", 0.00000000 },
+  { "솕", 0.00000000 },
+  { "뾻", 0.00000000 },
+  { "돕", 0.00000000 },
+  { "칄", 0.00000000 },
+  { "똉", 0.00000000 },
+  { "썫", 0.00000000 },
+  { "풧", 0.00000000 },
+  { "뾐", 0.00000000 },
+  { "먐", 0.00000000 },
+  { "좙", 0.00000000 },
+  { "뚳", 0.00000000 },
+  { "휍", 0.00000000 },
+  { "글", 0.00050000 },
+  { "줅", 0.00000000 },
+  { "즍", 0.00000000 },
+  { "냂", 0.00000000 },
+  { "홍", 0.00030000 },
+  { "젔", 0.00000000 },
+  { "쟃", 0.00000000 },
+  { "흑", 0.00010000 },
+  { "뀛", 0.00000000 },
+  { "홝", 0.00000000 },
+  { "즢", 0.00000000 },
+  { "뎎", 0.00000000 },
+  { "좢", 0.00000000 },
+  { "둊", 0.00000000 },
+  { "릌", 0.00000000 },
+  { "흠", 0.00000000 },
+  { "젿", 0.00000000 },
+  { "왘", 0.00000000 },
+  { "좉", 0.00000000 },
+  { "렟", 0.00000000 },
+  { "무", 0.00230000 },
+  { "혐", 0.00000000 },
+  { "졂", 0.00000000 },
+  { "닦", 0.00000000 },
+  { "츨", 0.00000000 },
+  { "꼄", 0.00000000 },
+  { "녎", 0.00000000 },
+  { "도", 0.00890000 },
+  { "윜", 0.00000000 },
+  { "핪", 0.00000000 },
+  { "닳", 0.00000000 },
+  { "귑", 0.00000000 },
+  { "암", 0.00030000 },
+  { "뉞", 0.00000000 },
+  { "볭", 0.00000000 },
+  { "욻", 0.00000000 },
+  { "윇", 0.00000000 },
+  { "횊", 0.00000000 },
+  { "꺴", 0.00000000 },
+  { "폻", 0.00000000 },
+  { "밇", 0.00000000 },
+  { "뭘", 0.00000000 },
+  { "훦", 0.00000000 },
+  { "캧", 0.00000000 },
+  { "냻", 0.00000000 },
+  { "궗", 0.00000000 },
+  { "봵", 0.00000000 },
+  { "음", 0.00190000 },
+  { "콮", 0.00000000 },
+  { "쉝", 0.00000000 },
+  { "폩", 0.00000000 },
+  { "퓊", 0.00000000 },
+  { "쌌", 0.00000000 },
+  { "솞", 0.00000000 },
+  { "뷦", 0.00000000 },
+  { "퀀", 0.00000000 },
+  { "넩", 0.00000000 },
+  { "쫍", 0.00000000 },
+  { "퐠", 0.00000000 },
+  { "닉", 0.00010000 },
+  { "놦", 0.00000000 },
+  { "띃", 0.00000000 },
+  { "쨉", 0.00000000 },
+  { "꼒", 0.00000000 },
+  { "빯", 0.00000000 },
+  { "퐿", 0.00000000 },
+  { "줫", 0.00000000 },
+  { "애", 0.00050000 },
+  { "잏", 0.00000000 },
+  { "쯾", 0.00000000 },
+  { "뜭", 0.00000000 },
+  { "퐻", 0.00000000 },
+  { "퀍", 0.00000000 },
+  { "툓", 0.00000000 },
+  { "섞", 0.00000000 },
+  { "홡", 0.00000000 },
+  { "욞", 0.00000000 },
+  { "낍", 0.00000000 },
+  { "뻤", 0.00000000 },
+  { "달", 0.00090000 },
+  { "쳀", 0.00000000 },
+  { "뉣", 0.00000000 },
+  { "낭", 0.00000000 },
+  { "셵", 0.00000000 },
+  { "먤", 0.00000000 },
+  { "쭹", 0.00000000 },
+  { "멕", 0.00010000 },
+  { "퍈", 0.00000000 },
+  { "텔", 0.00020000 },
+  { "뭴", 0.00000000 },
+  { "푩", 0.00000000 },
+  { "뛀", 0.00000000 },
+  { "럓", 0.00000000 },
+  { "픠", 0.00000000 },
+  { "쇛", 0.00000000 },
+  { "뮌", 0.00000000 },
+  { "녵", 0.00000000 },
+  { "츦", 0.00000000 },
+  { "핁", 0.00000000 },
+  { "졆", 0.00000000 },
+  { "쫂", 0.00000000 },
+  { "벸", 0.00000000 },
+  { "츬", 0.00000000 },
+  { "귘", 0.00000000 },
+  { "퇟", 0.00000000 },
+  { "좝", 0.00000000 },
+  { "똱", 0.00000000 },
+  { "끸", 0.00000000 },
+  { "졺", 0.00000000 },
+  { "깽", 0.00000000 },
+  { "딪", 0.00000000 },
+  { "킲", 0.00000000 },
+  { "퍤", 0.00000000 },
+  { "뙙", 0.00000000 },
+  { "뎣", 0.00000000 },
+  { "쐕", 0.00000000 },
+  { "쵡", 0.00000000 },
+  { "갹", 0.00000000 },
+  { "껒", 0.00000000 },
+  { "율", 0.00020000 },
+  { "뺋", 0.00000000 },
+  { "뒧", 0.00000000 },
+  { "퐌", 0.00000000 },
+  { "쁇", 0.00000000 },
+  { "칺", 0.00000000 },
+  { "씢", 0.00000000 },
+  { "썏", 0.00000000 },
+  { "홷", 0.00000000 },
+  { "뫑", 0.00000000 },
+  { "읈", 0.00000000 },
+  { "뤺", 0.00000000 },
+  { "딜", 0.00000000 },
+  { "롻", 0.00000000 },
+  { "땮", 0.00000000 },
+  { "쀋", 0.00000000 },
+  { "췧", 0.00000000 },
+  { "캵", 0.00000000 },
+  { "캬", 0.00000000 },
+  { "쨆", 0.00000000 },
+  { "첧", 0.00000000 },
+  { "텉", 0.00000000 },
+  { "롫", 0.00000000 },
+  { "튫", 0.00000000 },
+  { "쑊", 0.00000000 },
+  { "퀅", 0.00000000 },
+  { "쀀", 0.00000000 },
+  { "뵟", 0.00000000 },
+  { "홙", 0.00000000 },
+  { "뚈", 0.00000000 },
+  { "폪", 0.00000000 },
+  { "옲", 0.00000000 },
+  { "승", 0.00130000 },
+  { "븫", 0.00000000 },
+  { "쇘", 0.00000000 },
+  { "흊", 0.00000000 },
+  { "뙅", 0.00000000 },
+  { "젾", 0.00000000 },
+  { "둥", 0.00010000 },
+  { "쓩", 0.00000000 },
+  { "쪽", 0.00070000 },
+  { "븘", 0.00000000 },
+  { "쳆", 0.00000000 },
+  { "읎", 0.00000000 },
+  { "땁", 0.00000000 },
+  { "쁨", 0.00000000 },
+  { "튊", 0.00000000 },
+  { "큂", 0.00000000 },
+  { "됎", 0.00000000 },
+  { "톱", 0.00000000 },
+  { "륙", 0.00010000 },
+  { "쪏", 0.00000000 },
+  { "줾", 0.00000000 },
+  { "찘", 0.00000000 },
+  { "괳", 0.00000000 },
+  { "령", 0.00080000 },
+  { "끔", 0.00000000 },
+  { "뷑", 0.00000000 },
+  { "쌀", 0.00000000 },
+  { "쨀", 0.00000000 },
+  { "뱡", 0.00000000 },
+  { "뗧", 0.00000000 },
+  { "쮯", 0.00000000 },
+  { "쮲", 0.00000000 },
+  { "뤕", 0.00000000 },
+  { "쯤", 0.00000000 },
+  { "풑", 0.00000000 },
+  { "쓈", 0.00000000 },
+  { "먮", 0.00000000 },
+  { "렩", 0.00000000 },
+  { "꼮", 0.00000000 },
+  { "랏", 0.00000000 },
+  { "알", 0.00090000 },
+  { "쒯", 0.00000000 },
+  { "빹", 0.00000000 },
+  { "썻", 0.00000000 },
+  { "차", 0.00200000 },
+  { "욌", 0.00000000 },
+  { "젩", 0.00000000 },
+  { "괒", 0.00000000 },
+  { "쌷", 0.00000000 },
+  { "윳", 0.00000000 },
+  { "뚻", 0.00000000 },
+  { "짰", 0.00000000 },
+  { "폥", 0.00000000 },
+  { "슨", 0.00020000 },
+  { "쟣", 0.00000000 },
+  { "췴", 0.00000000 },
+  { "꺜", 0.00000000 },
+  { "엒", 0.00000000 },
+  { "쾆", 0.00000000 },
+  { "묀", 0.00000000 },
+  { "춐", 0.00000000 },
+  { "쎤", 0.00000000 },
+  { "췸", 0.00000000 },
+  { "쯯", 0.00000000 },
+  { "듗", 0.00000000 },
+  { "혴", 0.00000000 },
+  { "옯", 0.00000000 },
+  { "뿨", 0.00000000 },
+  { "띉", 0.00000000 },
+  { "봇", 0.00000000 },
+  { "틻", 0.00000000 },
+  { "넞", 0.00000000 },
+  { "꽓", 0.00000000 },
+  { "닣", 0.00000000 },
+  { "랿", 0.00000000 },
+  { "낱", 0.00000000 },
+  { "윏", 0.00000000 },
+  { "콲", 0.00000000 },
+  { "깻", 0.00000000 },
+  { "쑩", 0.00000000 },
+  { "쾪", 0.00000000 },
+  { "뺱", 0.00000000 },
+  { "내", 0.00190000 },
+  { "닄", 0.00000000 },
+  { "뢑", 0.00000000 },
+  { "멥", 0.00000000 },
+  { "볂", 0.00000000 },
+  { "쾇", 0.00000000 },
+  { "퉫", 0.00000000 },
+  { "얭", 0.00000000 },
+  { "뗷", 0.00000000 },
+  { "갓", 0.00000000 },
+  { "넢", 0.00000000 },
+  { "듢", 0.00000000 },
+  { "뗰", 0.00000000 },
+  { "촉", 0.00010000 },
+  { "퉈", 0.00000000 },
+  { "돋", 0.00000000 },
+  { "쿎", 0.00000000 },
+  { "쓲", 0.00000000 },
+  { "늙", 0.00000000 },
+  { "텹", 0.00000000 },
+  { "쫖", 0.00000000 },
+  { "뵋", 0.00000000 },
+  { "쟖", 0.00000000 },
+  { "짠", 0.00000000 },
+  { "갳", 0.00000000 },
+  { "킉", 0.00000000 },
+  { "퓣", 0.00000000 },
+  { "벴", 0.00000000 },
+  { "퐟", 0.00000000 },
+  { "귖", 0.00000000 },
+  { "봬", 0.00000000 },
+  { "맣", 0.00000000 },
+  { "쏀", 0.00000000 },
+  { "즡", 0.00000000 },
+  { "키", 0.00130000 },
+  { "쯬", 0.00000000 },
+  { "밡", 0.00000000 },
+  { "왽", 0.00000000 },
+  { "쪲", 0.00000000 },
+  { "횕", 0.00000000 },
+  { "웞", 0.00000000 },
+  { "쌧", 0.00000000 },
+  { "놫", 0.00000000 },
+  { "겻", 0.00000000 },
+  { "첼", 0.00000000 },
+  { "뮣", 0.00000000 },
+  { "쪪", 0.00000000 },
+  { "밷", 0.00000000 },
+  { "궈", 0.00000000 },
+  { "첶", 0.00000000 },
+  { "뗁", 0.00000000 },
+  { "뾟", 0.00000000 },
+  { "륓", 0.00000000 },
+  { "썡", 0.00000000 },
+  { "읍", 0.00010000 },
+  { "뤻", 0.00000000 },
+  { "쫯", 0.00000000 },
+  { "즘", 0.00010000 },
+  { "똈", 0.00000000 },
+  { "썂", 0.00000000 },
+  { "렲", 0.00000000 },
+  { "툃", 0.00000000 },
+  { "팗", 0.00000000 },
+  { "뗎", 0.00000000 },
+  { "뗨", 0.00000000 },
+  { "쬙", 0.00000000 },
+  { "슬", 0.00030000 },
+  { "햴", 0.00000000 },
+  { "앧", 0.00000000 },
+  { "쵵", 0.00000000 },
+  { "겵", 0.00000000 },
+  { "욽", 0.00000000 },
+  { "풾", 0.00000000 },
+  { "펱", 0.00000000 },
+  { "벋", 0.00000000 },
+  { "랁", 0.00000000 },
+  { "숷", 0.00000000 },
+  { "덥", 0.00000000 },
+  { "촌", 0.00020000 },
+  { "쀏", 0.00000000 },
+  { "쮌", 0.00000000 },
+  { "뜿", 0.00000000 },
+  { "츺", 0.00000000 },
+  { "뽶", 0.00000000 },
+  { "뜝", 0.00000000 },
+  { "벿", 0.00000000 },
+  { "쐮", 0.00000000 },
+  { "렴", 0.00000000 },
+  { "풡", 0.00000000 },
+  { "켬", 0.00000000 },
+  { "럆", 0.00000000 },
+  { "믛", 0.00000000 },
+  { "뻀", 0.00000000 },
+  { "획", 0.00030000 },
+  { "울", 0.00070000 },
+  { "둹", 0.00000000 },
+  { "뢾", 0.00000000 },
+  { "뒬", 0.00000000 },
+  { "쌞", 0.00000000 },
+  { "쾨", 0.00000000 },
+  { "묞", 0.00000000 },
+  { "픥", 0.00000000 },
+  { "냳", 0.00000000 },
+  { "뤂", 0.00000000 },
+  { "맅", 0.00000000 },
+  { "놠", 0.00000000 },
+  { "둙", 0.00000000 },
+  { "샜", 0.00000000 },
+  { "뢹", 0.00000000 },
+  { "엞", 0.00000000 },
+  { "옘", 0.00000000 },
+  { "쮳", 0.00000000 },
+  { "쏂", 0.00000000 },
+  { "쬶", 0.00000000 },
+  { "섛", 0.00000000 },
+  { "쎋", 0.00000000 },
+  { "춚", 0.00000000 },
+  { "읛", 0.00000000 },
+  { "핿", 0.00000000 },
+  { "몌", 0.00000000 },
+  { "먇", 0.00000000 },
+  { "쫉", 0.00000000 },
+  { "횳", 0.00000000 },
+  { "졖", 0.00000000 },
+  { "퀋", 0.00000000 },
+  { "춠", 0.00000000 },
+  { "뜮", 0.00000000 },
+  { "괓", 0.00000000 },
+  { "괢", 0.00000000 },
+  { "틫", 0.00000000 },
+  { "춸", 0.00000000 },
+  { "띱", 0.00000000 },
+  { "밧", 0.00000000 },
+  { "봭", 0.00000000 },
+  { "즐", 0.00010000 },
+  { "윍", 0.00000000 },
+  { "뿠", 0.00000000 },
+  { "몼", 0.00000000 },
+  { "찂", 0.00000000 },
+  { "퇞", 0.00000000 },
+  { "흖", 0.00000000 },
+  { "펑", 0.00000000 },
+  { "뼨", 0.00000000 },
+  { "났", 0.00030000 },
+  { "뎭", 0.00000000 },
+  { "먉", 0.00000000 },
+  { "연", 0.00280000 },
+  { "뚲", 0.00000000 },
+  { "맧", 0.00000000 },
+  { "쐲", 0.00000000 },
+  { "윩", 0.00000000 },
+  { "놟", 0.00000000 },
+  { "삳", 0.00000000 },
+  { "뿮", 0.00000000 },
+  { "흩", 0.00000000 },
+  { "꺤", 0.00000000 },
+  { "쮘", 0.00000000 },
+  { "즷", 0.00000000 },
+  { "켹", 0.00000000 },
+  { "뇙", 0.00000000 },
+  { "폨", 0.00000000 },
+  { "퐃", 0.00000000 },
+  { "롚", 0.00000000 },
+  { "픀", 0.00000000 },
+  { "엑", 0.00000000 },
+  { "점", 0.00110000 },
+  { "쾎", 0.00000000 },
+  { "슪", 0.00000000 },
+  { "깚", 0.00000000 },
+  { "팓", 0.00000000 },
+  { "믽", 0.00000000 },
+  { "뢇", 0.00000000 },
+  { "풝", 0.00000000 },
+  { "힊", 0.00000000 },
+  { "뽂", 0.00000000 },
+  { "멠", 0.00000000 },
+  { "뱵", 0.00000000 },
+  { "뼓", 0.00000000 },
+  { "얝", 0.00000000 },
+  { "듻", 0.00000000 },
+  { "쎮", 0.00000000 },
+  { "싺", 0.00000000 },
+  { "뢓", 0.00000000 },
+  { "좤", 0.00000000 },
+  { "뺇", 0.00000000 },
+  { "씖", 0.00000000 },
+  { "럤", 0.00000000 },
+  { "판", 0.00100000 },
+  { "럖", 0.00000000 },
+  { "땚", 0.00000000 },
+  { "쟘", 0.00000000 },
+  { "눙", 0.00000000 },
+  { "좽", 0.00000000 },
+  { "츻", 0.00000000 },
+  { "큢", 0.00000000 },
+  { "슎", 0.00000000 },
+  { "꾶", 0.00000000 },
+  { "틔", 0.00000000 },
+  { "휸", 0.00000000 },
+  { "탕", 0.00010000 },
+  { "뜃", 0.00000000 },
+  { "눗", 0.00000000 },
+  { "촴", 0.00000000 },
+  { "쳺", 0.00000000 },
+  { "탪", 0.00000000 },
+  { "샭", 0.00000000 },
+  { "탻", 0.00000000 },
+  { "췏", 0.00000000 },
+  { "쮒", 0.00000000 },
+  { "쥖", 0.00000000 },
+  { "컇", 0.00000000 },
+  { "딢", 0.00000000 },
+  { "쀸", 0.00000000 },
+  { "쿃", 0.00000000 },
+  { "컆", 0.00000000 },
+  { "궝", 0.00000000 },
+  { "룶", 0.00000000 },
+  { "켥", 0.00000000 },
+  { "휔", 0.00000000 },
+  { "뺪", 0.00000000 },
+  { "넌", 0.00000000 },
+  { "줻", 0.00000000 },
+  { "멑", 0.00000000 },
+  { "둂", 0.00000000 },
+  { "뒨", 0.00000000 },
+  { "쓔", 0.00000000 },
+  { "떦", 0.00000000 },
+  { "쿐", 0.00000000 },
+  { "셃", 0.00000000 },
+  { "꿶", 0.00000000 },
+  { "녰", 0.00000000 },
+  { "얒", 0.00000000 },
+  { "썗", 0.00000000 },
+  { "빠", 0.00020000 },
+  { "짧", 0.00010000 },
+  { "낞", 0.00000000 },
+  { "쮩", 0.00000000 },
+  { "휵", 0.00000000 },
+  { "뢭", 0.00000000 },
+  { "몽", 0.00010000 },
+  { "섒", 0.00000000 },
+  { "꼬", 0.00000000 },
+  { "락", 0.00030000 },
+  { "셖", 0.00000000 },
+  { "쒟", 0.00000000 },
+  { "젆", 0.00000000 },
+  { "쀊", 0.00000000 },
+  { "뫐", 0.00000000 },
+  { "넚", 0.00000000 },
+  { "긚", 0.00000000 },
+  { "뒮", 0.00000000 },
+  { "줢", 0.00000000 },
+  { "폜", 0.00000000 },
+  { "쟨", 0.00000000 },
+  { "뫗", 0.00000000 },
+  { "껼", 0.00000000 },
+  { "짹", 0.00000000 },
+  { "뺌", 0.00000000 },
+  { "뿙", 0.00000000 },
+  { "씹", 0.00000000 },
+  { "쾹", 0.00000000 },
+  { "켜", 0.00010000 },
+  { "뱐", 0.00000000 },
+  { "쑠", 0.00000000 },
+  { "뗈", 0.00000000 },
+  { "단", 0.00220000 },
+  { "볘", 0.00000000 },
+  { "텖", 0.00000000 },
+  { "썪", 0.00000000 },
+  { "촧", 0.00000000 },
+  { "뭓", 0.00000000 },
+  { "걾", 0.00000000 },
+  { "쁲", 0.00000000 },
+  { "팘", 0.00000000 },
+  { "듽", 0.00000000 },
+  { "굂", 0.00000000 },
+  { "맾", 0.00000000 },
+  { "쏱", 0.00000000 },
+  { "췒", 0.00000000 },
+  { "뛰", 0.00010000 },
+  { "겓", 0.00000000 },
+  { "떿", 0.00000000 },
+  { "셆", 0.00000000 },
+  { "뿯", 0.00000000 },
+  { "뙬", 0.00000000 },
+  { "먨", 0.00000000 },
+  { "쀑", 0.00000000 },
+  { "퐶", 0.00000000 },
+  { "쉤", 0.00000000 },
+  { "숥", 0.00000000 },
+  { "첂", 0.00000000 },
+  { "욢", 0.00000000 },
+  { "벒", 0.00000000 },
+  { "녉", 0.00000000 },
+  { "핎", 0.00000000 },
+  { "뤸", 0.00000000 },
+  { "퐳", 0.00000000 },
+  { "쵏", 0.00000000 },
+  { "폮", 0.00000000 },
+  { "틒", 0.00000000 },
+  { "퀬", 0.00000000 },
+  { "롈", 0.00000000 },
+  { "풍", 0.00030000 },
+  { "됢", 0.00000000 },
+  { "샗", 0.00000000 },
+  { "뙓", 0.00000000 },
+  { "삔", 0.00000000 },
+  { "퐆", 0.00000000 },
+  { "햲", 0.00000000 },
+  { "쀣", 0.00000000 },
+  { "뫵", 0.00000000 },
+  { "뷥", 0.00000000 },
+  { "짊", 0.00000000 },
+  { "뮽", 0.00000000 },
+  { "뮇", 0.00000000 },
+  { "을", 0.01510000 },
+  { "쀇", 0.00000000 },
+  { "뀰", 0.00000000 },
+  { "쐘", 0.00000000 },
+  { "푎", 0.00000000 },
+  { "쬼", 0.00000000 },
+  { "뱧", 0.00000000 },
+  { "쥑", 0.00000000 },
+  { "뵏", 0.00000000 },
+  { "걶", 0.00000000 },
+  { "폅", 0.00000000 },
+  { "텿", 0.00000000 },
+  { "튨", 0.00000000 },
+  { "왢", 0.00000000 },
+  { "폟", 0.00000000 },
+  { "렞", 0.00000000 },
+  { "쨵", 0.00000000 },
+  { "듇", 0.00000000 },
+  { "덊", 0.00000000 },
+  { "퇥", 0.00000000 },
+  { "쬵", 0.00000000 },
+  { "꽚", 0.00000000 },
+  { "뛅", 0.00000000 },
+  { "궎", 0.00000000 },
+  { "몮", 0.00000000 },
+  { "놚", 0.00000000 },
+  { "뻋", 0.00000000 },
+  { "꼳", 0.00000000 },
+  { "앟", 0.00000000 },
+  { "쨝", 0.00000000 },
+  { "짤", 0.00000000 },
+  { "홊", 0.00000000 },
+  { "좮", 0.00000000 },
+  { "븒", 0.00000000 },
+  { "뛹", 0.00000000 },
+  { "룉", 0.00000000 },
+  { "륪", 0.00000000 },
+  { "휚", 0.00000000 },
+  { "킵", 0.00000000 },
+  { "깾", 0.00000000 },
+  { "쇍", 0.00000000 },
+  { "챙", 0.00000000 },
+  { "쿋", 0.00000000 },
+  { "퐺", 0.00000000 },
+  { "졒", 0.00000000 },
+  { "뢰", 0.00010000 },
+  { "찋", 0.00000000 },
+  { "쯎", 0.00000000 },
+  { "븬", 0.00000000 },
+  { "쇖", 0.00000000 },
+  { "쟬", 0.00000000 },
+  { "휰", 0.00000000 },
+  { "촥", 0.00000000 },
+  { "됲", 0.00000000 },
+  { "퓠", 0.00000000 },
+  { "팸", 0.00000000 },
+  { "뿻", 0.00000000 },
+  { "걮", 0.00000000 },
+  { "헳", 0.00000000 },
+  { "떵", 0.00000000 },
+  { "괖", 0.00000000 },
+  { "봑", 0.00000000 },
+  { "곱", 0.00000000 },
+  { "퉠", 0.00000000 },
+  { "덑", 0.00000000 },
+  { "뿎", 0.00000000 },
+  { "퍸", 0.00000000 },
+  { "헩", 0.00000000 },
+  { "튭", 0.00000000 },
+  { "뇬", 0.00000000 },
+  { "킖", 0.00000000 },
+  { "쑜", 0.00000000 },
+  { "뜱", 0.00000000 },
+  { "껽", 0.00000000 },
+  { "뾯", 0.00000000 },
+  { "댹", 0.00000000 },
+  { "괐", 0.00000000 },
+  { "뢉", 0.00000000 },
+  { "벅", 0.00000000 },
+  { "킼", 0.00000000 },
+  { "쿬", 0.00000000 },
+  { "눬", 0.00000000 },
+  { "캟", 0.00000000 },
+  { "쩬", 0.00000000 },
+  { "쏗", 0.00000000 },
+  { "쫿", 0.00000000 },
+  { "꽠", 0.00000000 },
+  { "쪖", 0.00000000 },
+  { "뎒", 0.00000000 },
+  { "쥊", 0.00000000 },
+  { "윽", 0.00000000 },
+  { "찉", 0.00000000 },
+  { "뛏", 0.00000000 },
+  { "졘", 0.00000000 },
+  { "쟤", 0.00000000 },
+  { "겅", 0.00000000 },
+  { "됰", 0.00000000 },
+  { "뺣", 0.00000000 },
+  { "츟", 0.00000000 },
+  { "텳", 0.00000000 },
+  { "칓", 0.00000000 },
+  { "뇹", 0.00000000 },
+  { "긒", 0.00000000 },
+  { "뭥", 0.00000000 },
+  { "여", 0.00460000 },
+  { "꺓", 0.00000000 },
+  { "쾝", 0.00000000 },
+  { "흅", 0.00000000 },
+  { "퐩", 0.00000000 },
+  { "옫", 0.00000000 },
+  { "븝", 0.00000000 },
+  { "릟", 0.00000000 },
+  { "씗", 0.00000000 },
+  { "턅", 0.00000000 },
+  { "슶", 0.00000000 },
+  { "뵉", 0.00000000 },
+  { "뢔", 0.00000000 },
+  { "럜", 0.00000000 },
+  { "렬", 0.00010000 },
+  { "뻳", 0.00000000 },
+  { "맠", 0.00000000 },
+  { "밯", 0.00000000 },
+  { "띺", 0.00000000 },
+  { "뒰", 0.00000000 },
+  { "멤", 0.00010000 },
+  { "붙", 0.00020000 },
+  { "몚", 0.00000000 },
+  { "쟭", 0.00000000 },
+  { "눶", 0.00000000 },
+  { "퇑", 0.00000000 },
+  { "꼟", 0.00000000 },
+  { "띻", 0.00000000 },
+  { "떢", 0.00000000 },
+  { "썛", 0.00000000 },
+  { "쾅", 0.00000000 },
+  { "쳖", 0.00000000 },
+  { "꺵", 0.00000000 },
+  { "쎥", 0.00000000 },
+  { "쁢", 0.00000000 },
+  { "송", 0.00070000 },
+  { "렰", 0.00000000 },
+  { "꺖", 0.00000000 },
+  { "뾳", 0.00000000 },
+  { "묌", 0.00000000 },
+  { "꿫", 0.00000000 },
+  { "쀹", 0.00000000 },
+  { "퓥", 0.00000000 },
+  { "돴", 0.00000000 },
+  { "혥", 0.00000000 },
+  { "믷", 0.00000000 },
+  { "퉮", 0.00000000 },
+  { "맂", 0.00000000 },
+  { "뙝", 0.00000000 },
+  { "똘", 0.00000000 },
+  { "볺", 0.00000000 },
+  { "쉟", 0.00000000 },
+  { "녝", 0.00000000 },
+  { "롽", 0.00000000 },
+  { "녢", 0.00000000 },
+  { "촻", 0.00000000 },
+  { "톒", 0.00000000 },
+  { "밼", 0.00000000 },
+  { "묥", 0.00000000 },
+  { "퉄", 0.00000000 },
+  { "돳", 0.00000000 },
+  { "섳", 0.00000000 },
+  { "펩", 0.00000000 },
+  { "눓", 0.00000000 },
+  { "큦", 0.00000000 },
+  { "쯿", 0.00000000 },
+  { "늊", 0.00000000 },
+  { "콼", 0.00000000 },
+  { "놮", 0.00000000 },
+  { "뫠", 0.00000000 },
+  { "놛", 0.00000000 },
+  { "씾", 0.00000000 },
+  { "슑", 0.00000000 },
+  { "쬁", 0.00000000 },
+  { "펾", 0.00000000 },
+  { "뭟", 0.00000000 },
+  { "며", 0.00360000 },
+  { "혟", 0.00000000 },
+  { "뾀", 0.00000000 },
+  { "셏", 0.00000000 },
+  { "쐅", 0.00000000 },
+  { "쯏", 0.00000000 },
+  { "썸", 0.00000000 },
+  { "뉍", 0.00000000 },
+  { "쒣", 0.00000000 },
+  { "왷", 0.00000000 },
+  { "뼘", 0.00000000 },
+  { "맗", 0.00000000 },
+  { "핉", 0.00000000 },
+  { "쯃", 0.00000000 },
+  { "좬", 0.00000000 },
+  { "횏", 0.00000000 },
+  { "삐", 0.00000000 },
+  { "쳙", 0.00000000 },
+  { "웦", 0.00000000 },
+  { "뮸", 0.00000000 },
+  { "쁶", 0.00000000 },
+  { "퀈", 0.00000000 },
+  { "럄", 0.00000000 },
+  { "쩲", 0.00000000 },
+  { "왬", 0.00000000 },
+  { "틬", 0.00000000 },
+  { "냊", 0.00000000 },
+  { "콝", 0.00000000 },
+  { "뱎", 0.00000000 },
+  { "쎼", 0.00000000 },
+  { "득", 0.00020000 },
+  { "줺", 0.00000000 },
+  { "턊", 0.00000000 },
+  { "묃", 0.00000000 },
+  { "고", 0.01270000 },
+  { "쑮", 0.00000000 },
+  { "퇓", 0.00000000 },
+  { "삽", 0.00000000 },
+  { "팒", 0.00000000 },
+  { "띧", 0.00000000 },
+  { "옧", 0.00000000 },
+  { "돑", 0.00000000 },
+  { "쑎", 0.00000000 },
+  { "넮", 0.00000000 },
+  { "푽", 0.00000000 },
+  { "꽽", 0.00000000 },
+  { "뵦", 0.00000000 },
+  { "훼", 0.00000000 },
+  { "뛎", 0.00000000 },
+  { "윥", 0.00000000 },
+  { "롦", 0.00000000 },
+  { "쪞", 0.00000000 },
+  { "쉇", 0.00000000 },
+  { "둑", 0.00000000 },
+  { "뀖", 0.00000000 },
+  { "멹", 0.00000000 },
+  { "캊", 0.00000000 },
+  { "뷼", 0.00000000 },
+  { "뒓", 0.00000000 },
+  { "뜞", 0.00000000 },
+  { "윮", 0.00000000 },
+  { "퐍", 0.00000000 },
+  { "촐", 0.00000000 },
+  { "뛱", 0.00000000 },
+  { "꺩", 0.00000000 },
+  { "콻", 0.00000000 },
+  { "쏷", 0.00000000 },
+  { "칖", 0.00000000 },
+  { "퐏", 0.00000000 },
+  { "쒜", 0.00000000 },
+  { "돁", 0.00000000 },
+  { "촙", 0.00000000 },
+  { "눉", 0.00000000 },
+  { "헲", 0.00000000 },
+  { "꺰", 0.00000000 },
+  { "푊", 0.00000000 },
+  { "댒", 0.00000000 },
+  { "쳕", 0.00000000 },
+  { "쮛", 0.00000000 },
+  { "긜", 0.00000000 },
+  { "돸", 0.00000000 },
+  { "솦", 0.00000000 },
+  { "쪿", 0.00000000 },
+  { "삓", 0.00000000 },
+  { "윿", 0.00000000 },
+  { "턳", 0.00000000 },
+  { "괃", 0.00000000 },
+  { "졬", 0.00000000 },
+  { "쟷", 0.00000000 },
+  { "콉", 0.00000000 },
+  { "씵", 0.00000000 },
+  { "쐿", 0.00000000 },
+  { "쩸", 0.00000000 },
+  { "뛆", 0.00000000 },
+  { "씍", 0.00000000 },
+  { "뵑", 0.00000000 },
+  { "엓", 0.00000000 },
+  { "븉", 0.00000000 },
+  { "쁉", 0.00000000 },
+  { "잯", 0.00000000 },
+  { "셞", 0.00000000 },
+  { "덻", 0.00000000 },
+  { "쐗", 0.00000000 },
+  { "쪗", 0.00000000 },
+  { "몴", 0.00000000 },
+  { "쟂", 0.00000000 },
+  { "룳", 0.00000000 },
+  { "흸", 0.00000000 },
+  { "쳔", 0.00000000 },
+  { "벾", 0.00000000 },
+  { "볷", 0.00000000 },
+  { "숑", 0.00000000 },
+  { "썰", 0.00000000 },
+  { "캯", 0.00000000 },
+  { "훖", 0.00000000 },
+  { "헥", 0.00000000 },
+  { "먗", 0.00000000 },
+  { "걠", 0.00000000 },
+  { "둈", 0.00000000 },
+  { "땖", 0.00000000 },
+  { "붐", 0.00000000 },
+  { "퀭", 0.00000000 },
+  { "빐", 0.00000000 },
+  { "췫", 0.00000000 },
+  { "약", 0.00110000 },
+  { "훰", 0.00000000 },
+  { "늏", 0.00000000 },
+  { "슕", 0.00000000 },
+  { "럦", 0.00000000 },
+  { "뭹", 0.00000000 },
+  { "츑", 0.00000000 },
+  { "뛽", 0.00000000 },
+  { "킞", 0.00000000 },
+  { "쌰", 0.00000000 },
+  { "꽜", 0.00000000 },
+  { "쨦", 0.00000000 },
+  { "쎸", 0.00000000 },
+  { "궙", 0.00000000 },
+  { "큠", 0.00000000 },
+  { "쓤", 0.00000000 },
+  { "쾸", 0.00000000 },
+  { "벬", 0.00000000 },
+  { "킧", 0.00000000 },
+  { "뎻", 0.00000000 },
+  { "툙", 0.00000000 },
+  { "귡", 0.00000000 },
+  { "쮡", 0.00000000 },
+  { "겿", 0.00000000 },
+  { "픮", 0.00000000 },
+  { "퇕", 0.00000000 },
+  { "뿶", 0.00000000 },
+  { "먂", 0.00000000 },
+  { "퀸", 0.00000000 },
+  { "죕", 0.00000000 },
+  { "뱭", 0.00000000 },
+  { "눜", 0.00000000 },
+  { "읇", 0.00000000 },
+  { "폯", 0.00000000 },
+  { "덆", 0.00000000 },
+  { "탍", 0.00000000 },
+  { "뷅", 0.00000000 },
+  { "챟", 0.00000000 },
+  { "쌝", 0.00000000 },
+  { "촘", 0.00000000 },
+  { "덨", 0.00000000 },
+  { "춦", 0.00000000 },
+  { "츭", 0.00000000 },
+  { "팭", 0.00000000 },
+  { "맡", 0.00020000 },
+  { "잩", 0.00000000 },
+  { "젏", 0.00000000 },
+  { "큞", 0.00000000 },
+  { "븄", 0.00000000 },
+  { "뷐", 0.00000000 },
+  { "쥒", 0.00000000 },
+  { "뿝", 0.00000000 },
+  { "삻", 0.00000000 },
+  { "톜", 0.00000000 },
+  { "츖", 0.00000000 },
+  { "먘", 0.00000000 },
+  { "옋", 0.00000000 },
+  { "둲", 0.00000000 },
+  { "퀿", 0.00000000 },
+  { "틷", 0.00000000 },
+  { "꿲", 0.00000000 },
+  { "엄", 0.00020000 },
+  { "찦", 0.00000000 },
+  { "뻮", 0.00000000 },
+  { "눧", 0.00000000 },
+  { "렕", 0.00000000 },
+  { "믶", 0.00000000 },
+  { "꿄", 0.00000000 },
+  { "궮", 0.00000000 },
+  { "솵", 0.00000000 },
+  { "됀", 0.00000000 },
+  { "휪", 0.00000000 },
+  { "틤", 0.00000000 },
+  { "곔", 0.00000000 },
+  { "똞", 0.00000000 },
+  { "뉧", 0.00000000 },
+  { "쳈", 0.00000000 },
+  { "텏", 0.00000000 },
+  { "퀾", 0.00000000 },
+  { "륷", 0.00000000 },
+  { "헞", 0.00000000 },
+  { "닋", 0.00000000 },
+  { "뿿", 0.00000000 },
+  { "폃", 0.00000000 },
+  { "쑫", 0.00000000 },
+  { "욊", 0.00000000 },
+  { "듡", 0.00000000 },
+  { "랞", 0.00000000 },
+  { "볧", 0.00000000 },
+  { "싉", 0.00000000 },
+  { "촕", 0.00000000 },
+  { "뮖", 0.00000000 },
+  { "뱢", 0.00000000 },
+  { "튼", 0.00010000 },
+  { "칑", 0.00000000 },
+  { "둼", 0.00000000 },
+  { "좡", 0.00000000 },
+  { "낢", 0.00000000 },
+  { "왕", 0.00110000 },
+  { "꺧", 0.00000000 },
+  { "치", 0.00280000 },
+  { "뫥", 0.00000000 },
+  { "돎", 0.00000000 },
+  { "먩", 0.00000000 },
+  { "귗", 0.00000000 },
+  { "쐻", 0.00000000 },
+  { "귋", 0.00000000 },
+  { "윫", 0.00000000 },
+  { "를", 0.00930000 },
+  { "꾞", 0.00000000 },
+  { "휕", 0.00000000 },
+  { "꺱", 0.00000000 },
+  { "흾", 0.00000000 },
+  { "눾", 0.00000000 },
+  { "뱹", 0.00000000 },
+  { "췱", 0.00000000 },
+  { "컖", 0.00000000 },
+  { "쫔", 0.00000000 },
+  { "롡", 0.00000000 },
+  { "쫃", 0.00000000 },
+  { "걨", 0.00000000 },
+  { "쫮", 0.00000000 },
+  { "뎍", 0.00000000 },
+  { "슾", 0.00000000 },
+  { "쭰", 0.00000000 },
+  { "푆", 0.00000000 },
+  { "풭", 0.00000000 },
+  { "훽", 0.00000000 },
+  { "셱", 0.00000000 },
+  { "촦", 0.00000000 },
+  { "톻", 0.00000000 },
+  { "퇷", 0.00000000 },
+  { "솨", 0.00000000 },
+  { "벰", 0.00000000 },
+  { "럪", 0.00000000 },
+  { "쾜", 0.00000000 },
+  { "뮉", 0.00000000 },
+  { "뭲", 0.00000000 },
+  { "좷", 0.00000000 },
+  { "켗", 0.00000000 },
+  { "먣", 0.00000000 },
+  { "앨", 0.00020000 },
+  { "큛", 0.00000000 },
+  { "췇", 0.00000000 },
+  { "췛", 0.00000000 },
+  { "섚", 0.00000000 },
+  { "덉", 0.00000000 },
+  { "벟", 0.00000000 },
+  { "굃", 0.00000000 },
+  { "쾱", 0.00000000 },
+  { "펠", 0.00010000 },
+  { "심", 0.00100000 },
+  { "룐", 0.00000000 },
+  { "톝", 0.00000000 },
+  { "뱘", 0.00000000 },
+  { "븶", 0.00000000 },
+  { "쇷", 0.00000000 },
+  { "째", 0.00050000 },
+  { "롗", 0.00000000 },
+  { "컜", 0.00000000 },
+  { "룗", 0.00000000 },
+  { "벑", 0.00000000 },
+  { "쑀", 0.00000000 },
+  { "찹", 0.00000000 },
+  { "몃", 0.00000000 },
+  { "짲", 0.00000000 },
+  { "퍜", 0.00000000 },
+  { "춉", 0.00000000 },
+  { "퀹", 0.00000000 },
+  { "쪥", 0.00000000 },
+  { "뺻", 0.00000000 },
+  { "멊", 0.00000000 },
+  { "똎", 0.00000000 },
+  { "쬥", 0.00000000 },
+  { "끤", 0.00000000 },
+  { "뀍", 0.00000000 },
+  { "쩪", 0.00000000 },
+  { "쇆", 0.00000000 },
+  { "놷", 0.00000000 },
+  { "췊", 0.00000000 },
+  { "랤", 0.00000000 },
+  { "쥠", 0.00000000 },
+  { "훀", 0.00000000 },
+  { "뒐", 0.00000000 },
+  { "꾅", 0.00000000 },
+  { "늇", 0.00000000 },
+  { "쁄", 0.00000000 },
+  { "텃", 0.00000000 },
+  { "젨", 0.00000000 },
+  { "줟", 0.00000000 },
+  { "놥", 0.00000000 },
+  { "럮", 0.00000000 },
+  { "철", 0.00070000 },
+  { "봷", 0.00000000 },
+  { "쓚", 0.00000000 },
+  { "굺", 0.00000000 },
+  { "뭇", 0.00000000 },
+  { "찷", 0.00000000 },
+  { "옒", 0.00000000 },
+  { "뱶", 0.00000000 },
+  { "뫸", 0.00000000 },
+  { "쨶", 0.00000000 },
+  { "잠", 0.00010000 },
+  { "뛳", 0.00000000 },
+  { "주", 0.00540000 },
+  { "뚑", 0.00000000 },
+  { "틚", 0.00000000 },
+  { "쒽", 0.00000000 },
+  { "왵", 0.00000000 },
+  { "긋", 0.00000000 },
+  { "뻢", 0.00000000 },
+  { "즋", 0.00000000 },
+  { "귱", 0.00000000 },
+  { "놹", 0.00000000 },
+  { "밽", 0.00000000 },
+  { "퇳", 0.00000000 },
+  { "숍", 0.00000000 },
+  { "촹", 0.00000000 },
+  { "킙", 0.00000000 },
+  { "죓", 0.00000000 },
+  { "뫀", 0.00000000 },
+  { "줃", 0.00000000 },
+  { "쳶", 0.00000000 },
+  { "쒾", 0.00000000 },
+  { "괅", 0.00000000 },
+  { "몫", 0.00000000 },
+  { "얱", 0.00000000 },
+  { "쒆", 0.00000000 },
+  { "즟", 0.00000000 },
+  { "믾", 0.00000000 },
+  { "씛", 0.00000000 },
+  { "퇄", 0.00000000 },
+  { "턽", 0.00000000 },
+  { "뼬", 0.00000000 },
+  { "뉏", 0.00000000 },
+  { "쩰", 0.00000000 },
+  { "츴", 0.00000000 },
+  { "냕", 0.00000000 },
+  { "톦", 0.00000000 },
+  { "쯫", 0.00000000 },
+  { "컯", 0.00000000 },
+  { "켽", 0.00000000 },
+  { "턍", 0.00000000 },
+  { "꿺", 0.00000000 },
+  { "읷", 0.00000000 },
+  { "쩞", 0.00000000 },
+  { "춭", 0.00000000 },
+  { "홂", 0.00000000 },
+  { "삩", 0.00000000 },
+  { "썷", 0.00000000 },
+  { "뭦", 0.00000000 },
+  { "젦", 0.00000000 },
+  { "뼱", 0.00000000 },
+  { "뺶", 0.00000000 },
+  { "염", 0.00020000 },
+  { "굙", 0.00000000 },
+  { "꿤", 0.00000000 },
+  { "닼", 0.00000000 },
+  { "쫫", 0.00000000 },
+  { "돜", 0.00000000 },
+  { "셾", 0.00000000 },
+  { "얲", 0.00000000 },
+  { "뙾", 0.00000000 },
+  { "쥋", 0.00000000 },
+  { "귶", 0.00000000 },
+  { "헶", 0.00000000 },
+  { "쉂", 0.00000000 },
+  { "빁", 0.00000000 },
+  { "퇋", 0.00000000 },
+  { "짘", 0.00000000 },
+  { "멿", 0.00000000 },
+  { "탣", 0.00000000 },
+  { "뷋", 0.00000000 },
+  { "넒", 0.00000000 },
+  { "딉", 0.00000000 },
+  { "렷", 0.00000000 },
+  { "쇪", 0.00000000 },
+  { "믫", 0.00000000 },
+  { "쯀", 0.00000000 },
+  { "퐗", 0.00000000 },
+  { "뙤", 0.00000000 },
+  { "됊", 0.00000000 },
+  { "꿬", 0.00000000 },
+  { "왈", 0.00000000 },
+  { "잝", 0.00000000 },
+  { "쎉", 0.00000000 },
+  { "쮫", 0.00000000 },
+  { "돐", 0.00000000 },
+  { "뱒", 0.00000000 },
+  { "숦", 0.00000000 },
+  { "앾", 0.00000000 },
+  { "쟑", 0.00000000 },
+  { "팿", 0.00000000 },
+  { "둄", 0.00000000 },
+  { "옄", 0.00000000 },
+  { "떊", 0.00000000 },
+  { "꼽", 0.00000000 },
+  { "짳", 0.00000000 },
+  { "얜", 0.00000000 },
+  { "퍛", 0.00000000 },
+  { "죐", 0.00000000 },
+  { "꾪", 0.00000000 },
+  { "딄", 0.00000000 },
+  { "믬", 0.00000000 },
+  { "섿", 0.00000000 },
+  { "과", 0.00550000 },
+  { "놕", 0.00000000 },
+  { "햳", 0.00000000 },
+  { "쭶", 0.00000000 },
+  { "꺬", 0.00000000 },
+  { "퀻", 0.00000000 },
+  { "핹", 0.00000000 },
+  { "륑", 0.00000000 },
+  { "뷎", 0.00000000 },
+  { "쇯", 0.00000000 },
+  { "럙", 0.00000000 },
+  { "의", 0.02470000 },
+  { "첓", 0.00000000 },
+  { "퓮", 0.00000000 },
+  { "쾔", 0.00000000 },
+  { "럹", 0.00000000 },
+  { "륍", 0.00000000 },
+  { "픰", 0.00000000 },
+  { "햌", 0.00000000 },
+  { "퇁", 0.00000000 },
+  { "잞", 0.00000000 },
+  { "발", 0.00260000 },
+  { "곶", 0.00000000 },
+  { "쓠", 0.00000000 },
+  { "뗾", 0.00000000 },
+  { "캈", 0.00000000 },
+  { "갧", 0.00000000 },
+  { "긩", 0.00000000 },
+  { "쟱", 0.00000000 },
+  { "몯", 0.00000000 },
+  { "뭼", 0.00000000 },
+  { "쵰", 0.00000000 },
+  { "쐯", 0.00000000 },
+  { "헔", 0.00000000 },
+  { "뼝", 0.00000000 },
+  { "쳬", 0.00000000 },
+  { "늾", 0.00000000 },
+  { "슦", 0.00000000 },
+  { "갈", 0.00030000 },
+  { "푥", 0.00000000 },
+  { "잹", 0.00000000 },
+  { "뽃", 0.00000000 },
+  { "됿", 0.00000000 },
+  { "덽", 0.00000000 },
+  { "먋", 0.00000000 },
+  { "쁻", 0.00000000 },
+  { "몉", 0.00000000 },
+  { "꺟", 0.00000000 },
+  { "깩", 0.00000000 },
+  { "캗", 0.00000000 },
+  { "잰", 0.00000000 },
+  { "웉", 0.00000000 },
+  { "탨", 0.00000000 },
+  { "뷜", 0.00000000 },
+  { "쯳", 0.00000000 },
+  { "쯇", 0.00000000 },
+  { "퇏", 0.00000000 },
+  { "훇", 0.00000000 },
+  { "긤", 0.00000000 },
+  { "쬘", 0.00000000 },
+  { "뫪", 0.00000000 },
+  { "깴", 0.00000000 },
+  { "엳", 0.00000000 },
+  { "쌔", 0.00000000 },
+  { "첔", 0.00000000 },
+  { "붎", 0.00000000 },
+  { "껑", 0.00000000 },
+  { "퍞", 0.00000000 },
+  { "백", 0.00060000 },
+  { "륡", 0.00000000 },
+  { "꾻", 0.00000000 },
+  { "켔", 0.00000000 },
+  { "엘", 0.00020000 },
+  { "뾬", 0.00000000 },
+  { "폠", 0.00000000 },
+  { "돘", 0.00000000 },
+  { "폂", 0.00000000 },
+  { "쩡", 0.00000000 },
+  { "뱰", 0.00000000 },
+  { "뢎", 0.00000000 },
+  { "훅", 0.00000000 },
+  { "촶", 0.00000000 },
+  { "뚁", 0.00000000 },
+  { "먼", 0.00020000 },
+  { "뿫", 0.00000000 },
+  { "킕", 0.00000000 },
+  { "찿", 0.00000000 },
+  { "쎅", 0.00000000 },
+  { "틟", 0.00000000 },
+  { "췆", 0.00000000 },
+  { "풫", 0.00000000 },
+  { "꺕", 0.00000000 },
+  { "첲", 0.00000000 },
+  { "룯", 0.00000000 },
+  { "숣", 0.00000000 },
+  { "꾄", 0.00000000 },
+  { "쏐", 0.00000000 },
+  { "끀", 0.00000000 },
+  { "킶", 0.00000000 },
+  { "픅", 0.00000000 },
+  { "훺", 0.00000000 },
+  { "롳", 0.00000000 },
+  { "콗", 0.00000000 },
+  { "퐝", 0.00000000 },
+  { "귛", 0.00000000 },
+  { "늡", 0.00000000 },
+  { "틜", 0.00000000 },
+  { "귇", 0.00000000 },
+  { "렌", 0.00020000 },
+  { "듮", 0.00000000 },
+  { "윺", 0.00000000 },
+  { "쒴", 0.00000000 },
+  { "뮭", 0.00000000 },
+  { "봈", 0.00000000 },
+  { "훾", 0.00000000 },
+  { "뛬", 0.00000000 },
+  { "벦", 0.00000000 },
+  { "턨", 0.00000000 },
+  { "폀", 0.00000000 },
+  { "썓", 0.00000000 },
+  { "멱", 0.00000000 },
+  { "눝", 0.00000000 },
+  { "곇", 0.00000000 },
+  { "셌", 0.00000000 },
+  { "휽", 0.00000000 },
+  { "춧", 0.00000000 },
+  { "붰", 0.00000000 },
+  { "섐", 0.00000000 },
+  { "쪺", 0.00000000 },
+  { "칙", 0.00020000 },
+  { "랷", 0.00000000 },
+  { "뗵", 0.00000000 },
+  { "뿥", 0.00000000 },
+  { "앋", 0.00000000 },
+  { "흜", 0.00000000 },
+  { "폖", 0.00000000 },
+  { "폢", 0.00000000 },
+  { "깫", 0.00000000 },
+  { "켃", 0.00000000 },
+  { "깭", 0.00000000 },
+  { "텑", 0.00000000 },
+  { "괫", 0.00000000 },
+  { "쾂", 0.00000000 },
+  { "갍", 0.00000000 },
+  { "혰", 0.00000000 },
+  { "븃", 0.00000000 },
+  { "퓯", 0.00000000 },
+  { "횵", 0.00000000 },
+  { "쌟", 0.00000000 },
+  { "줐", 0.00000000 },
+  { "뮕", 0.00000000 },
+  { "멀", 0.00010000 },
+  { "쮝", 0.00000000 },
+  { "칏", 0.00000000 },
+  { "늪", 0.00000000 },
+  { "쐺", 0.00000000 },
+  { "퍂", 0.00000000 },
+  { "뉈", 0.00000000 },
+  { "뚤", 0.00000000 },
+  { "쳞", 0.00000000 },
+  { "쪭", 0.00000000 },
+  { "겖", 0.00000000 },
+  { "구", 0.00450000 },
+  { "품", 0.00060000 },
+  { "뉤", 0.00000000 },
+  { "닫", 0.00000000 },
+  { "읰", 0.00000000 },
+  { "춲", 0.00000000 },
+  { "챾", 0.00000000 },
+  { "픔", 0.00000000 },
+  { "녜", 0.00000000 },
+  { "짥", 0.00000000 },
+  { "뽳", 0.00000000 },
+  { "콕", 0.00000000 },
+  { "곓", 0.00000000 },
+  { "럎", 0.00000000 },
+  { "쌺", 0.00000000 },
+  { "챚", 0.00000000 },
+  { "쉈", 0.00000000 },
+  { "빈", 0.00020000 },
+  { "녲", 0.00000000 },
+  { "좜", 0.00000000 },
+  { "녱", 0.00000000 },
+  { "쵧", 0.00000000 },
+  { "쵛", 0.00000000 },
+  { "냧", 0.00000000 },
+  { "떌", 0.00000000 },
+  { "웋", 0.00000000 },
+  { "퐤", 0.00000000 },
+  { "픒", 0.00000000 },
+  { "쿇", 0.00000000 },
+  { "렮", 0.00000000 },
+  { "냹", 0.00000000 },
+  { "뱀", 0.00000000 },
+  { "퀕", 0.00000000 },
+  { "챆", 0.00000000 },
+  { "쎹", 0.00000000 },
+  { "닐", 0.00000000 },
+  { "췉", 0.00000000 },
+  { "켂", 0.00000000 },
+  { "룸", 0.00000000 },
+  { "핗", 0.00000000 },
+  { "짉", 0.00000000 },
+  { "됤", 0.00000000 },
+  { "새", 0.00050000 },
+  { "컴", 0.00020000 },
+  { "큒", 0.00000000 },
+  { "햺", 0.00000000 },
+  { "굚", 0.00000000 },
+  { "귮", 0.00000000 },
+  { "썟", 0.00000000 },
+  { "민", 0.00230000 },
+  { "큁", 0.00000000 },
+  { "뮟", 0.00000000 },
+  { "넪", 0.00000000 },
+  { "멫", 0.00000000 },
+  { "뵄", 0.00000000 },
+  { "귚", 0.00000000 },
+  { "뗃", 0.00000000 },
+  { "꼂", 0.00000000 },
+  { "롿", 0.00000000 },
+  { "릉", 0.00010000 },
+  { "쳸", 0.00000000 },
+  { "즻", 0.00000000 },
+  { "퓦", 0.00000000 },
+  { "괔", 0.00000000 },
+  { "오", 0.00300000 },
+  { "튎", 0.00000000 },
+  { "휾", 0.00000000 },
+  { "믁", 0.00000000 },
+  { "퇢", 0.00000000 },
+  { "쾑", 0.00000000 },
+  { "섘", 0.00000000 },
+  { "묲", 0.00000000 },
+  { "궢", 0.00000000 },
+  { "녒", 0.00000000 },
+  { "쥔", 0.00000000 },
+  { "볅", 0.00000000 },
+  { "흀", 0.00000000 },
+  { "랴", 0.00000000 },
+  { "뾗", 0.00000000 },
+  { "푇", 0.00000000 },
+  { "궊", 0.00000000 },
+  { "쐱", 0.00000000 },
+  { "콱", 0.00000000 },
+  { "밸", 0.00000000 },
+  { "퓢", 0.00000000 },
+  { "괭", 0.00000000 },
+  { "쳃", 0.00000000 },
+  { "캳", 0.00000000 },
+  { "놞", 0.00000000 },
+  { "뺔", 0.00000000 },
+  { "렙", 0.00000000 },
+  { "푷", 0.00000000 },
+  { "띵", 0.00000000 },
+  { "떓", 0.00000000 },
+  { "잖", 0.00000000 },
+  { "쭾", 0.00000000 },
+  { "걑", 0.00000000 },
+  { "렿", 0.00000000 },
+  { "쇓", 0.00000000 },
+  { "푏", 0.00000000 },
+  { "꾈", 0.00000000 },
+  { "삤", 0.00000000 },
+  { "녕", 0.00000000 },
+  { "뱇", 0.00000000 },
+  { "쑲", 0.00000000 },
+  { "틊", 0.00000000 },
+  { "괝", 0.00000000 },
+  { "샏", 0.00000000 },
+  { "쭫", 0.00000000 },
+  { "깇", 0.00000000 },
+  { "죭", 0.00000000 },
+  { "멭", 0.00000000 },
+  { "앜", 0.00000000 },
+  { "덚", 0.00000000 },
+  { "묋", 0.00000000 },
+  { "롷", 0.00000000 },
+  { "폳", 0.00000000 },
+  { "겎", 0.00000000 },
+  { "뒭", 0.00000000 },
+  { "칤", 0.00000000 },
+  { "킘", 0.00000000 },
+  { "씘", 0.00000000 },
+  { "횮", 0.00000000 },
+  { "룰", 0.00000000 },
+  { "좼", 0.00000000 },
+  { "쮙", 0.00000000 },
+  { "쉍", 0.00000000 },
+  { "빅", 0.00010000 },
+  { "뵳", 0.00000000 },
+  { "쀈", 0.00000000 },
+  { "틖", 0.00000000 },
+  { "휌", 0.00000000 },
+  { "뻝", 0.00000000 },
+  { "뾽", 0.00000000 },
+  { "뵤", 0.00000000 },
+  { "뽵", 0.00000000 },
+  { "쇜", 0.00000000 },
+  { "퍢", 0.00000000 },
+  { "떕", 0.00000000 },
+  { "뾕", 0.00000000 },
+  { "럠", 0.00000000 },
+  { "낥", 0.00000000 },
+  { "밶", 0.00000000 },
+  { "귤", 0.00000000 },
+  { "측", 0.00040000 },
+  { "뚧", 0.00000000 },
+  { "뤫", 0.00000000 },
+  { "쵻", 0.00000000 },
+  { "줖", 0.00000000 },
+  { "툽", 0.00000000 },
+  { "꿈", 0.00000000 },
+  { "핢", 0.00000000 },
+  { "퇮", 0.00000000 },
+  { "왿", 0.00000000 },
+  { "겒", 0.00000000 },
+  { "굘", 0.00000000 },
+  { "첄", 0.00000000 },
+  { "짚", 0.00000000 },
+  { "춹", 0.00000000 },
+  { "줡", 0.00000000 },
+  { "랔", 0.00000000 },
+  { "뵚", 0.00000000 },
+  { "긻", 0.00000000 },
+  { "봊", 0.00000000 },
+  { "뵖", 0.00000000 },
+  { "퐯", 0.00000000 },
+  { "벫", 0.00000000 },
+  { "괸", 0.00000000 },
+  { "뇉", 0.00000000 },
+  { "굔", 0.00000000 },
+  { "쪅", 0.00000000 },
+  { "늯", 0.00000000 },
+  { "셶", 0.00000000 },
+  { "뎀", 0.00000000 },
+  { "쿻", 0.00000000 },
+  { "꺍", 0.00000000 },
+  { "뗉", 0.00000000 },
+  { "꾎", 0.00000000 },
+  { "뭢", 0.00000000 },
+  { "냱", 0.00000000 },
+  { "붉", 0.00000000 },
+  { "챕", 0.00000000 },
+  { "뻖", 0.00000000 },
+  { "턗", 0.00000000 },
+  { "눘", 0.00000000 },
+  { "뷒", 0.00000000 },
+  { "러", 0.00240000 },
+  { "풓", 0.00000000 },
+  { "역", 0.00260000 },
+  { "횬", 0.00000000 },
+  { "낒", 0.00000000 },
+  { "쯁", 0.00000000 },
+  { "활", 0.00100000 },
+  { "욲", 0.00000000 },
+  { "좂", 0.00000000 },
+  { "흇", 0.00000000 },
+  { "죙", 0.00000000 },
+  { "톍", 0.00000000 },
+  { "샽", 0.00000000 },
+  { "뜖", 0.00000000 },
+  { "쉘", 0.00000000 },
+  { "츞", 0.00000000 },
+  { "뤹", 0.00000000 },
+  { "룝", 0.00000000 },
+  { "왹", 0.00000000 },
+  { "삗", 0.00000000 },
+  { "뮻", 0.00000000 },
+  { "컦", 0.00000000 },
+  { "앙", 0.00030000 },
+  { "묵", 0.00000000 },
+  { "풺", 0.00000000 },
+  { "줈", 0.00000000 },
+  { "괌", 0.00000000 },
+  { "뱟", 0.00000000 },
+  { "뱈", 0.00000000 },
+  { "웘", 0.00000000 },
+  { "팯", 0.00000000 },
+  { "겟", 0.00000000 },
+  { "혬", 0.00000000 },
+  { "봯", 0.00000000 },
+  { "엌", 0.00000000 },
+  { "듘", 0.00000000 },
+  { "쌐", 0.00000000 },
+  { "쾁", 0.00000000 },
+  { "뮩", 0.00000000 },
+  { "륈", 0.00000000 },
+  { "엸", 0.00000000 },
+  { "좀", 0.00000000 },
+  { "쯭", 0.00000000 },
+  { "쫰", 0.00000000 },
+  { "춛", 0.00000000 },
+  { "컞", 0.00000000 },
+  { "듍", 0.00000000 },
+  { "튌", 0.00000000 },
+  { "삒", 0.00000000 },
+  { "팺", 0.00000000 },
+  { "쎗", 0.00000000 },
+  { "돏", 0.00000000 },
+  { "쀬", 0.00000000 },
+  { "넧", 0.00000000 },
+  { "텸", 0.00000000 },
+  { "볦", 0.00000000 },
+  { "쟠", 0.00000000 },
+  { "싇", 0.00000000 },
+  { "왅", 0.00000000 },
+  { "그", 0.00630000 },
+  { "붝", 0.00000000 },
+  { "냾", 0.00000000 },
+  { "욮", 0.00000000 },
+  { "곻", 0.00000000 },
+  { "턓", 0.00000000 },
+  { "퍲", 0.00000000 },
+  { "궅", 0.00000000 },
+  { "졞", 0.00000000 },
+  { "꺸", 0.00000000 },
+  { "쑕", 0.00000000 },
+  { "뻟", 0.00000000 },
+  { "썚", 0.00000000 },
+  { "븢", 0.00000000 },
+  { "밚", 0.00000000 },
+  { "븖", 0.00000000 },
+  { "콆", 0.00000000 },
+  { "녺", 0.00000000 },
+  { "럩", 0.00000000 },
+  { "귁", 0.00000000 },
+  { "숯", 0.00000000 },
+  { "챤", 0.00000000 },
+  { "뻶", 0.00000000 },
+  { "캖", 0.00000000 },
+  { "칍", 0.00000000 },
+  { "붧", 0.00000000 },
+  { "뢬", 0.00000000 },
+  { "현", 0.00190000 },
+  { "댱", 0.00000000 },
+  { "옑", 0.00000000 },
+  { "줹", 0.00000000 },
+  { "쨰", 0.00000000 },
+  { "챖", 0.00000000 },
+  { "뎁", 0.00000000 },
+  { "눽", 0.00000000 },
+  { "츷", 0.00000000 },
+  { "륯", 0.00000000 },
+  { "쩂", 0.00000000 },
+  { "냇", 0.00000000 },
+  { "걻", 0.00000000 },
+  { "눨", 0.00000000 },
+  { "썀", 0.00000000 },
+  { "봔", 0.00000000 },
+  { "쏥", 0.00000000 },
+  { "갶", 0.00000000 },
+  { "컃", 0.00000000 },
+  { "끗", 0.00000000 },
+  { "큐", 0.00010000 },
+  { "횅", 0.00000000 },
+  { "껮", 0.00000000 },
+  { "냽", 0.00000000 },
+  { "뢤", 0.00000000 },
+  { "닩", 0.00000000 },
+  { "푺", 0.00000000 },
+  { "뼋", 0.00000000 },
+  { "혔", 0.00010000 },
+  { "숸", 0.00000000 },
+  { "긊", 0.00000000 },
+  { "씥", 0.00000000 },
+  { "쇦", 0.00000000 },
+  { "믑", 0.00000000 },
+  { "뽫", 0.00000000 },
+  { "뫈", 0.00000000 },
+  { "뭳", 0.00000000 },
+  { "쀰", 0.00000000 },
+  { "곸", 0.00000000 },
+  { "겜", 0.00000000 },
+  { "폛", 0.00000000 },
+  { "뭡", 0.00000000 },
+  { "챿", 0.00000000 },
+  { "칱", 0.00000000 },
+  { "팫", 0.00000000 },
+  { "뷁", 0.00000000 },
+  { "왨", 0.00000000 },
+  { "뛪", 0.00000000 },
+  { "쬽", 0.00000000 },
+  { "쿕", 0.00000000 },
+  { "쏈", 0.00000000 },
+  { "똒", 0.00000000 },
+  { "휬", 0.00000000 },
+  { "볁", 0.00000000 },
+  { "텨", 0.00000000 },
+  { "픂", 0.00000000 },
+  { "됝", 0.00000000 },
+  { "왦", 0.00000000 },
+  { "윌", 0.00010000 },
+  { "쯋", 0.00000000 },
+  { "쿳", 0.00000000 },
+  { "욫", 0.00000000 },
+  { "껣", 0.00000000 },
+  { "쾏", 0.00000000 },
+  { "쌾", 0.00000000 },
+  { "씞", 0.00000000 },
+  { "줧", 0.00000000 },
+  { "멓", 0.00000000 },
+  { "뼊", 0.00000000 },
+  { "푭", 0.00000000 },
+  { "뿕", 0.00000000 },
+  { "됵", 0.00000000 },
+  { "긵", 0.00000000 },
+  { "땠", 0.00000000 },
+  { "답", 0.00010000 },
+  { "꽗", 0.00000000 },
+  { "뙻", 0.00000000 },
+  { "숐", 0.00000000 },
+  { "씯", 0.00000000 },
+  { "휙", 0.00000000 },
+  { "쌩", 0.00000000 },
+  { "옕", 0.00000000 },
+  { "긧", 0.00000000 },
+  { "볚", 0.00000000 },
+  { "댻", 0.00000000 },
+  { "씿", 0.00000000 },
+  { "됮", 0.00000000 },
+  { "뼲", 0.00000000 },
+  { "톇", 0.00000000 },
+  { "뭜", 0.00000000 },
+  { "뺞", 0.00000000 },
+  { "쐔", 0.00000000 },
+  { "햾", 0.00000000 },
+  { "횜", 0.00000000 },
+  { "웹", 0.00010000 },
+  { "춈", 0.00000000 },
+  { "밀", 0.00040000 },
+  { "뷺", 0.00000000 },
+  { "햰", 0.00000000 },
+  { "럍", 0.00000000 },
+  { "때", 0.00170000 },
+  { "앶", 0.00000000 },
+  { "뼰", 0.00000000 },
+  { "괍", 0.00000000 },
+  { "팔", 0.00020000 },
+  { "섩", 0.00000000 },
+  { "둎", 0.00000000 },
+  { "젢", 0.00000000 },
+  { "쿖", 0.00000000 },
+  { "빗", 0.00000000 },
+  { "엱", 0.00000000 },
+  { "쭼", 0.00000000 },
+  { "륻", 0.00000000 },
+  { "액", 0.00020000 },
+  { "슝", 0.00000000 },
+  { "녬", 0.00000000 },
+  { "솏", 0.00000000 },
+  { "뿷", 0.00000000 },
+  { "휁", 0.00000000 },
+  { "컺", 0.00000000 },
+  { "칦", 0.00000000 },
+  { "원", 0.00390000 },
+  { "놁", 0.00000000 },
+  { "뱏", 0.00000000 },
+  { "셪", 0.00000000 },
+  { "뀽", 0.00000000 },
+  { "옿", 0.00000000 },
+  { "킹", 0.00010000 },
+  { "븕", 0.00000000 },
+  { "좌", 0.00020000 },
+  { "뿃", 0.00000000 },
+  { "즳", 0.00000000 },
+  { "슉", 0.00000000 },
+  { "퍃", 0.00000000 },
+  { "엽", 0.00010000 },
+  { "츮", 0.00000000 },
+  { "븹", 0.00000000 },
+  { "꽁", 0.00000000 },
+  { "뀿", 0.00000000 },
+  { "랸", 0.00000000 },
+  { "꼗", 0.00000000 },
+  { "낻", 0.00000000 },
+  { "꼔", 0.00000000 },
+  { "쉴", 0.00000000 },
+  { "짷", 0.00000000 },
+  { "팄", 0.00000000 },
+  { "긝", 0.00000000 },
+  { "휺", 0.00000000 },
+  { "냢", 0.00000000 },
+  { "쑾", 0.00000000 },
+  { "켿", 0.00000000 },
+  { "볝", 0.00000000 },
+  { "얟", 0.00000000 },
+  { "탗", 0.00000000 },
+  { "썤", 0.00000000 },
+  { "몷", 0.00000000 },
+  { "릙", 0.00000000 },
+  { "쵤", 0.00000000 },
+  { "딁", 0.00000000 },
+  { "딗", 0.00000000 },
+  { "덭", 0.00000000 },
+  { "꾲", 0.00000000 },
+  { "겑", 0.00000000 },
+  { "룑", 0.00000000 },
+  { "샰", 0.00000000 },
+  { "엛", 0.00000000 },
+  { "잼", 0.00000000 },
+  { "묯", 0.00000000 },
+  { "꼵", 0.00000000 },
+  { "컰", 0.00000000 },
+  { "훉", 0.00000000 },
+  { "렄", 0.00000000 },
+  { "팚", 0.00000000 },
+  { "훟", 0.00000000 },
+  { "맆", 0.00000000 },
+  { "훷", 0.00000000 },
+  { "쬠", 0.00000000 },
+  { "깁", 0.00000000 },
+  { "묳", 0.00000000 },
+  { "쯓", 0.00000000 },
+  { "솇", 0.00000000 },
+  { "탇", 0.00000000 },
+  { "쨅", 0.00000000 },
+  { "셻", 0.00000000 },
+  { "롃", 0.00000000 },
+  { "뭠", 0.00000000 },
+  { "코", 0.00120000 },
+  { "혏", 0.00000000 },
+  { "뜕", 0.00000000 },
+  { "뼻", 0.00000000 },
+  { "듬", 0.00010000 },
+  { "쏮", 0.00000000 },
+  { "탿", 0.00000000 },
+  { "묹", 0.00000000 },
+  { "촵", 0.00000000 },
+  { "틃", 0.00000000 },
+  { "죍", 0.00000000 },
+  { "풙", 0.00000000 },
+  { "붷", 0.00000000 },
+  { "쑅", 0.00000000 },
+  { "뜲", 0.00000000 },
+  { "갲", 0.00000000 },
+  { "궡", 0.00000000 },
+  { "읃", 0.00000000 },
+  { "흐", 0.00020000 },
+  { "쟚", 0.00000000 },
+  { "퓲", 0.00000000 },
+  { "놔", 0.00000000 },
+  { "헋", 0.00000000 },
+  { "넟", 0.00000000 },
+  { "띓", 0.00000000 },
+  { "솧", 0.00000000 },
+  { "줽", 0.00000000 },
+  { "팴", 0.00000000 },
+  { "쥕", 0.00000000 },
+  { "갯", 0.00000000 },
+  { "뎂", 0.00000000 },
+  { "쎓", 0.00000000 },
+  { "삎", 0.00000000 },
+  { "죇", 0.00000000 },
+  { "쌜", 0.00000000 },
+  { "튲", 0.00000000 },
+  { "횆", 0.00000000 },
+  { "졭", 0.00000000 },
+  { "뚙", 0.00000000 },
+  { "쿡", 0.00000000 },
+  { "쿨", 0.00000000 },
+  { "꾙", 0.00000000 },
+  { "젵", 0.00000000 },
+  { "얗", 0.00000000 },
+  { "욥", 0.00000000 },
+  { "탶", 0.00000000 },
+  { "먿", 0.00000000 },
+  { "럇", 0.00000000 },
+  { "끇", 0.00000000 },
+  { "엃", 0.00000000 },
+  { "쬧", 0.00000000 },
+  { "켘", 0.00000000 },
+  { "삛", 0.00000000 },
+  { "줋", 0.00000000 },
+  { "롆", 0.00000000 },
+  { "썌", 0.00000000 },
+  { "풠", 0.00000000 },
+  { "휃", 0.00000000 },
+  { "룋", 0.00000000 },
+  { "쓣", 0.00000000 },
+  { "학", 0.00350000 },
+  { "훚", 0.00000000 },
+  { "뇛", 0.00000000 },
+  { "걿", 0.00000000 },
+  { "씚", 0.00000000 },
+  { "꺨", 0.00000000 },
+  { "듭", 0.00000000 },
+  { "샫", 0.00000000 },
+  { "륟", 0.00000000 },
+  { "쀎", 0.00000000 },
+  { "턹", 0.00000000 },
+  { "푼", 0.00000000 },
+  { "걜", 0.00000000 },
+  { "섵", 0.00000000 },
+  { "븷", 0.00000000 },
+  { "혙", 0.00000000 },
+  { "듩", 0.00000000 },
+  { "싲", 0.00000000 },
+  { "놐", 0.00000000 },
+  { "뽓", 0.00000000 },
+  { "뉆", 0.00000000 },
+  { "돗", 0.00000000 },
+  { "쾚", 0.00000000 },
+  { "헑", 0.00000000 },
+  { "몄", 0.00000000 },
+  { "듚", 0.00000000 },
+  { "인", 0.00860000 },
+  { "햨", 0.00000000 },
+  { "녳", 0.00000000 },
+  { "뱁", 0.00000000 },
+  { "츰", 0.00000000 },
+  { "졪", 0.00000000 },
+  { "섂", 0.00000000 },
+  { "핥", 0.00000000 },
+  { "뇔", 0.00000000 },
+  { "낿", 0.00000000 },
+  { "쪎", 0.00000000 },
+  { "쳻", 0.00000000 },
+  { "뫞", 0.00000000 },
+  { "얓", 0.00000000 },
+  { "쉻", 0.00000000 },
+  { "핏", 0.00000000 },
+  { "쳣", 0.00000000 },
+  { "캇", 0.00000000 },
+  { "츛", 0.00000000 },
+  { "칥", 0.00000000 },
+  { "뛨", 0.00000000 },
+  { "장", 0.00460000 },
+  { "명", 0.00320000 },
+  { "츄", 0.00000000 },
+  { "슭", 0.00000000 },
+  { "븙", 0.00000000 },
+  { "욚", 0.00000000 },
+  { "뫷", 0.00000000 },
+  { "턛", 0.00000000 },
+  { "춱", 0.00000000 },
+  { "썳", 0.00000000 },
+  { "썲", 0.00000000 },
+  { "퐢", 0.00000000 },
+  { "믕", 0.00000000 },
+  { "컻", 0.00000000 },
+  { "읹", 0.00000000 },
+  { "퉎", 0.00000000 },
+  { "상", 0.00420000 },
+  { "쬋", 0.00000000 },
+  { "빽", 0.00000000 },
+  { "왐", 0.00000000 },
+  { "퇱", 0.00000000 },
+  { "빏", 0.00000000 },
+  { "믖", 0.00000000 },
+  { "찊", 0.00000000 },
+  { "귫", 0.00000000 },
+  { "뎈", 0.00000000 },
+  { "왛", 0.00000000 },
+  { "뤧", 0.00000000 },
+  { "픊", 0.00000000 },
+  { "됦", 0.00000000 },
+  { "얯", 0.00000000 },
+  { "넿", 0.00000000 },
+  { "뀫", 0.00000000 },
+  { "꼯", 0.00000000 },
+  { "잓", 0.00000000 },
+  { "뵀", 0.00000000 },
+  { "껔", 0.00000000 },
+  { "쾥", 0.00000000 },
+  { "쯜", 0.00000000 },
+  { "쁷", 0.00000000 },
+  { "뱳", 0.00000000 },
+  { "궹", 0.00000000 },
+  { "챺", 0.00000000 },
+  { "괩", 0.00000000 },
+  { "맰", 0.00000000 },
+  { "눏", 0.00000000 },
+  { "뿀", 0.00000000 },
+  { "긍", 0.00000000 },
+  { "쵨", 0.00000000 },
+  { "챳", 0.00000000 },
+  { "릔", 0.00000000 },
+  { "매", 0.00110000 },
+  { "홌", 0.00000000 },
+  { "퉍", 0.00000000 },
+  { "긽", 0.00000000 },
+  { "쥌", 0.00000000 },
+  { "뵩", 0.00000000 },
+  { "쪔", 0.00000000 },
+  { "꿏", 0.00000000 },
+  { "턄", 0.00000000 },
+  { "빵", 0.00000000 },
+  { "뼸", 0.00000000 },
+  { "뜛", 0.00000000 },
+  { "뀔", 0.00000000 },
+  { "죾", 0.00000000 },
+  { "롲", 0.00000000 },
+  { "튥", 0.00000000 },
+  { "똽", 0.00000000 },
+  { "훮", 0.00000000 },
+  { "픘", 0.00000000 },
+  { "됥", 0.00000000 },
+  { "갺", 0.00000000 },
+  { "뿌", 0.00000000 },
+  { "랻", 0.00000000 },
+  { "밉", 0.00000000 },
+  { "긬", 0.00000000 },
+  { "죚", 0.00000000 },
+  { "꼸", 0.00000000 },
+  { "곺", 0.00000000 },
+  { "슮", 0.00000000 },
+  { "쑍", 0.00000000 },
+  { "욐", 0.00000000 },
+  { "트", 0.00340000 },
+  { "츫", 0.00000000 },
+  { "갬", 0.00000000 },
+  { "챹", 0.00000000 },
+  { "힝", 0.00000000 },
+  { "웫", 0.00000000 },
+  { "닓", 0.00000000 },
+  { "깪", 0.00000000 },
+  { "얨", 0.00000000 },
+  { "횃", 0.00000000 },
+  { "뻭", 0.00000000 },
+  { "켼", 0.00000000 },
+  { "댅", 0.00000000 },
+  { "곝", 0.00000000 },
+  { "렃", 0.00000000 },
+  { "웍", 0.00000000 },
+  { "잊", 0.00000000 },
+  { "숗", 0.00000000 },
+  { "퉆", 0.00000000 },
+  { "썞", 0.00000000 },
+  { "펙", 0.00000000 },
+  { "뉋", 0.00000000 },
+  { "돰", 0.00000000 },
+  { "볊", 0.00000000 },
+  { "잌", 0.00000000 },
+  { "묚", 0.00000000 },
+  { "텩", 0.00000000 },
+  { "꾒", 0.00000000 },
+  { "즛", 0.00000000 },
+  { "헮", 0.00000000 },
+  { "뤌", 0.00000000 },
+  { "패", 0.00050000 },
+  { "뼞", 0.00000000 },
+  { "쯔", 0.00000000 },
+  { "쪂", 0.00000000 },
+  { "퀽", 0.00000000 },
+  { "탺", 0.00000000 },
+  { "퐱", 0.00000000 },
+  { "숓", 0.00000000 },
+  { "훐", 0.00000000 },
+  { "훵", 0.00000000 },
+  { "셢", 0.00000000 },
+  { "홃", 0.00000000 },
+  { "뉥", 0.00000000 },
+  { "퓵", 0.00000000 },
+  { "혖", 0.00000000 },
+  { "풦", 0.00000000 },
+  { "쀶", 0.00000000 },
+  { "뉫", 0.00000000 },
+  { "쬱", 0.00000000 },
+  { "곧", 0.00010000 },
+  { "뙥", 0.00000000 },
+  { "쨯", 0.00000000 },
+  { "갰", 0.00000000 },
+  { "똣", 0.00000000 },
+  { "샻", 0.00000000 },
+  { "쿦", 0.00000000 },
+  { "춏", 0.00000000 },
+  { "쟸", 0.00000000 },
+  { "쒔", 0.00000000 },
+  { "챸", 0.00000000 },
+  { "첊", 0.00000000 },
+  { "쇰", 0.00000000 },
+  { "혳", 0.00000000 },
+  { "쉐", 0.00000000 },
+  { "봙", 0.00000000 },
+  { "쓙", 0.00000000 },
+  { "첥", 0.00000000 },
+  { "쬌", 0.00000000 },
+  { "졑", 0.00000000 },
+  { "흴", 0.00000000 },
+  { "컐", 0.00000000 },
+  { "븱", 0.00000000 },
+  { "궓", 0.00000000 },
+  { "볩", 0.00000000 },
+  { "엝", 0.00000000 },
+  { "껌", 0.00000000 },
+  { "객", 0.00020000 },
+  { "므", 0.00020000 },
+  { "둌", 0.00000000 },
+  { "셸", 0.00000000 },
+  { "퀦", 0.00000000 },
+  { "걘", 0.00000000 },
+  { "캙", 0.00000000 },
+  { "궞", 0.00000000 },
+  { "꽙", 0.00000000 },
+  { "늖", 0.00000000 },
+  { "젃", 0.00000000 },
+  { "쥉", 0.00000000 },
+  { "꽮", 0.00000000 },
+  { "뼗", 0.00000000 },
+  { "쭩", 0.00000000 },
+  { "눈", 0.00010000 },
+  { "쐐", 0.00000000 },
+  { "퀣", 0.00000000 },
+  { "윙", 0.00000000 },
+  { "숝", 0.00000000 },
+  { "싩", 0.00000000 },
+  { "잻", 0.00000000 },
+  { "줩", 0.00000000 },
+  { "팇", 0.00000000 },
+  { "괈", 0.00000000 },
+  { "퉯", 0.00000000 },
+  { "푛", 0.00000000 },
+  { "땂", 0.00000000 },
+  { "깊", 0.00010000 },
+  { "욬", 0.00000000 },
+  { "츶", 0.00000000 },
+  { "끊", 0.00000000 },
+  { "괊", 0.00000000 },
+  { "둰", 0.00000000 },
+  { "씡", 0.00000000 },
+  { "펳", 0.00000000 },
+  { "쏆", 0.00000000 },
+  { "튘", 0.00000000 },
+  { "큉", 0.00000000 },
+  { "횇", 0.00000000 },
+  { "텮", 0.00000000 },
+  { "뎅", 0.00000000 },
+  { "뫰", 0.00000000 },
+  { "뎫", 0.00000000 },
+  { "택", 0.00030000 },
+  { "끻", 0.00000000 },
+  { "풖", 0.00000000 },
+  { "씪", 0.00000000 },
+  { "뼑", 0.00000000 },
+  { "뽚", 0.00000000 },
+  { "부", 0.00660000 },
+  { "딒", 0.00000000 },
+  { "첝", 0.00000000 },
+  { "뮑", 0.00000000 },
+  { "묤", 0.00000000 },
+  { "컁", 0.00000000 },
+  { "뱦", 0.00000000 },
+  { "찱", 0.00000000 },
+  { "햭", 0.00000000 },
+  { "꾣", 0.00000000 },
+  { "혜", 0.00010000 },
+  { "냸", 0.00000000 },
+  { "섎", 0.00000000 },
+  { "젴", 0.00000000 },
+  { "튞", 0.00000000 },
+  { "먏", 0.00000000 },
+  { "횒", 0.00000000 },
+  { "뿬", 0.00000000 },
+  { "튮", 0.00000000 },
+  { "휠", 0.00000000 },
+  { "꼐", 0.00000000 },
+  { "괚", 0.00000000 },
+  { "룞", 0.00000000 },
+  { "곒", 0.00000000 },
+  { "뽿", 0.00000000 },
+  { "월", 0.00410000 },
+  { "읝", 0.00000000 },
+  { "컵", 0.00020000 },
+  { "륨", 0.00000000 },
+  { "쩵", 0.00000000 },
+  { "좏", 0.00000000 },
+  { "쇳", 0.00000000 },
+  { "펫", 0.00000000 },
+  { "뚷", 0.00000000 },
+  { "븁", 0.00000000 },
+  { "븧", 0.00000000 },
+  { "곷", 0.00000000 },
+  { "텢", 0.00000000 },
+  { "횱", 0.00000000 },
+  { "퐦", 0.00000000 },
+  { "좈", 0.00000000 },
+  { "밑", 0.00010000 },
+  { "쒢", 0.00000000 },
+  { "멲", 0.00000000 },
+  { "쁩", 0.00000000 },
+  { "좄", 0.00000000 },
+  { "죫", 0.00000000 },
+  { "늬", 0.00000000 },
+  { "딴", 0.00000000 },
+  { "땾", 0.00000000 },
+  { "탧", 0.00000000 },
+  { "끑", 0.00000000 },
+  { "뉦", 0.00000000 },
+  { "뒊", 0.00000000 },
+  { "튇", 0.00000000 },
+  { "헇", 0.00000000 },
+  { "묮", 0.00000000 },
+  { "쇸", 0.00000000 },
+  { "임", 0.00160000 },
+  { "읫", 0.00000000 },
+  { "솆", 0.00000000 },
+  { "뙹", 0.00000000 },
+  { "뎨", 0.00000000 },
+  { "읟", 0.00000000 },
+  { "젒", 0.00000000 },
+  { "긘", 0.00000000 },
+  { "셊", 0.00000000 },
+  { "뭝", 0.00000000 },
+  { "뙊", 0.00000000 },
+  { "앛", 0.00000000 },
+  { "쌴", 0.00000000 },
+  { "졲", 0.00000000 },
+  { "뙈", 0.00000000 },
+  { "밙", 0.00000000 },
+  { "좱", 0.00000000 },
+  { "귺", 0.00000000 },
+  { "뿟", 0.00000000 },
+  { "녯", 0.00000000 },
+  { "릭", 0.00020000 },
+  { "댿", 0.00000000 },
+  { "흚", 0.00000000 },
+  { "홛", 0.00000000 },
+  { "톅", 0.00000000 },
+  { "몊", 0.00000000 },
+  { "뺲", 0.00000000 },
+  { "딖", 0.00000000 },
+  { "퀴", 0.00000000 },
+  { "뻙", 0.00000000 },
+  { "횙", 0.00000000 },
+  { "팷", 0.00000000 },
+  { "닃", 0.00000000 },
+  { "뿘", 0.00000000 },
+  { "섈", 0.00000000 },
+  { "훆", 0.00000000 },
+  { "톟", 0.00000000 },
+  { "툸", 0.00000000 },
+  { "띑", 0.00000000 },
+  { "쟏", 0.00000000 },
+  { "웏", 0.00000000 },
+  { "졚", 0.00000000 },
+  { "곾", 0.00000000 },
+  { "콫", 0.00000000 },
+  { "휐", 0.00000000 },
+  { "픟", 0.00000000 },
+  { "성", 0.00460000 },
+  { "홸", 0.00000000 },
+  { "뎞", 0.00000000 },
+  { "깏", 0.00000000 },
+  { "꽵", 0.00000000 },
+  { "뮡", 0.00000000 },
+  { "렳", 0.00000000 },
+  { "튐", 0.00000000 },
+  { "퓸", 0.00000000 },
+  { "쎰", 0.00000000 },
+  { "삞", 0.00000000 },
+  { "햱", 0.00000000 },
+  { "폺", 0.00000000 },
+  { "찯", 0.00000000 },
+  { "쌠", 0.00000000 },
+  { "뚦", 0.00000000 },
+  { "쑄", 0.00000000 },
+  { "죀", 0.00000000 },
+  { "붹", 0.00000000 },
+  { "쮪", 0.00000000 },
+  { "짮", 0.00000000 },
+  { "관", 0.00280000 },
+  { "챽", 0.00000000 },
+  { "훶", 0.00000000 },
+  { "풟", 0.00000000 },
+  { "긙", 0.00000000 },
+  { "꺺", 0.00000000 },
+  { "촸", 0.00000000 },
+  { "뾒", 0.00000000 },
+  { "꼠", 0.00000000 },
+  { "풰", 0.00000000 },
+  { "걺", 0.00000000 },
+  { "력", 0.00130000 },
+  { "쩿", 0.00000000 },
+  { "뵫", 0.00000000 },
+  { "콇", 0.00000000 },
+  { "곟", 0.00000000 },
+  { "짎", 0.00000000 },
+  { "뇩", 0.00000000 },
+  { "둃", 0.00000000 },
+  { "섁", 0.00000000 },
+  { "즔", 0.00000000 },
+  { "멅", 0.00000000 },
+  { "껁", 0.00000000 },
+  { "쟇", 0.00000000 },
+  { "븆", 0.00000000 },
+  { "쵞", 0.00000000 },
+  { "휜", 0.00000000 },
+  { "덧", 0.00000000 },
+  { "봋", 0.00000000 },
+  { "뷮", 0.00000000 },
+  { "몸", 0.00010000 },
+  { "쾙", 0.00000000 },
+  { "쓾", 0.00000000 },
+  { "몹", 0.00000000 },
+  { "붜", 0.00000000 },
+  { "탡", 0.00000000 },
+  { "쉁", 0.00000000 },
+  { "줙", 0.00000000 },
+  { "넛", 0.00000000 },
+  { "뒩", 0.00000000 },
+  { "퀎", 0.00000000 },
+  { "뙺", 0.00000000 },
+  { "샱", 0.00000000 },
+  { "떽", 0.00000000 },
+  { "놳", 0.00000000 },
+  { "늼", 0.00000000 },
+  { "뷚", 0.00000000 },
+  { "헺", 0.00000000 },
+  { "뚬", 0.00000000 },
+  { "까", 0.00130000 },
+  { "썩", 0.00000000 },
+  { "죽", 0.00030000 },
+  { "낆", 0.00000000 },
+  { "푻", 0.00000000 },
+  { "쏴", 0.00000000 },
+  { "씲", 0.00000000 },
+  { "펏", 0.00000000 },
+  { "엦", 0.00000000 },
+  { "씆", 0.00000000 },
+  { "뀦", 0.00000000 },
+  { "낶", 0.00000000 },
+  { "냘", 0.00000000 },
+  { "둚", 0.00000000 },
+  { "뙳", 0.00000000 },
+  { "쳏", 0.00000000 },
+  { "웁", 0.00000000 },
+  { "랥", 0.00000000 },
+  { "퀓", 0.00000000 },
+  { "뵹", 0.00000000 },
+  { "꿘", 0.00000000 },
+  { "놈", 0.00000000 },
+  { "뛥", 0.00000000 },
+  { "뽀", 0.00000000 },
+  { "헐", 0.00000000 },
+  { "쉜", 0.00000000 },
+  { "쿿", 0.00000000 },
+  { "셳", 0.00000000 },
+  { "짻", 0.00000000 },
+  { "긪", 0.00000000 },
+  { "깲", 0.00000000 },
+  { "쀌", 0.00000000 },
+  { "띂", 0.00000000 },
+  { "투", 0.00090000 },
+  { "뀤", 0.00000000 },
+  { "맷", 0.00000000 },
+  { "냒", 0.00000000 },
+  { "햧", 0.00000000 },
+  { "챮", 0.00000000 },
+  { "혹", 0.00020000 },
+  { "뜅", 0.00000000 },
+  { "볥", 0.00000000 },
+  { "쓜", 0.00000000 },
+  { "좁", 0.00000000 },
+  { "틈", 0.00000000 },
+  { "씷", 0.00000000 },
+  { "찕", 0.00000000 },
+  { "캓", 0.00000000 },
+  { "돂", 0.00000000 },
+  { "횪", 0.00000000 },
+  { "쭭", 0.00000000 },
+  { "뎬", 0.00000000 },
+  { "챛", 0.00000000 },
+  { "닱", 0.00000000 },
+  { "쟈", 0.00000000 },
+  { "볨", 0.00000000 },
+  { "뜒", 0.00000000 },
+  { "룼", 0.00000000 },
+  { "싞", 0.00000000 },
+  { "쪛", 0.00000000 },
+  { "듆", 0.00000000 },
+  { "켄", 0.00000000 },
+  { "쑯", 0.00000000 },
+  { "즕", 0.00000000 },
+  { "컅", 0.00000000 },
+  { "씊", 0.00000000 },
+  { "씔", 0.00000000 },
+  { "안", 0.00180000 },
+  { "땰", 0.00000000 },
+  { "뗯", 0.00000000 },
+  { "곌", 0.00000000 },
+  { "뙏", 0.00000000 },
+  { "븎", 0.00000000 },
+  { "틿", 0.00000000 },
+  { "줚", 0.00000000 },
+  { "쵙", 0.00000000 },
+  { "괪", 0.00000000 },
+  { "풹", 0.00000000 },
+  { "펼", 0.00010000 },
+  { "똰", 0.00000000 },
+  { "풣", 0.00000000 },
+  { "좑", 0.00000000 },
+  { "띐", 0.00000000 },
+  { "팛", 0.00000000 },
+  { "굞", 0.00000000 },
+  { "뭎", 0.00000000 },
+  { "꺉", 0.00000000 },
+  { "껙", 0.00000000 },
+  { "큖", 0.00000000 },
+  { "뷨", 0.00000000 },
+  { "콃", 0.00000000 },
+  { "퀲", 0.00000000 },
+  { "듷", 0.00000000 },
+  { "늵", 0.00000000 },
+  { "수", 0.00660000 },
+  { "봒", 0.00000000 },
+  { "뵷", 0.00000000 },
+  { "홨", 0.00000000 },
+  { "뱨", 0.00000000 },
+  { "쬚", 0.00000000 },
+  { "룣", 0.00000000 },
+  { "쥻", 0.00000000 },
+  { "쁠", 0.00000000 },
+  { "섥", 0.00000000 },
+  { "셒", 0.00000000 },
+  { "풌", 0.00000000 },
+  { "놑", 0.00000000 },
+  { "톾", 0.00000000 },
+  { "콍", 0.00000000 },
+  { "랩", 0.00000000 },
+  { "쭺", 0.00000000 },
+  { "흨", 0.00000000 },
+  { "콶", 0.00000000 },
+  { "앱", 0.00000000 },
+  { "헆", 0.00000000 },
+  { "델", 0.00020000 },
+  { "댈", 0.00000000 },
+  { "나", 0.00660000 },
+  { "불", 0.00110000 },
+  { "졳", 0.00000000 },
+  { "벜", 0.00000000 },
+  { "솊", 0.00000000 },
+  { "쌭", 0.00000000 },
+  { "톌", 0.00000000 },
+  { "늤", 0.00000000 },
+  { "첽", 0.00000000 },
+  { "퐰", 0.00000000 },
+  { "댲", 0.00000000 },
+  { "받", 0.00120000 },
+  { "씐", 0.00000000 },
+  { "쮨", 0.00000000 },
+  { "뾥", 0.00000000 },
+  { "붿", 0.00000000 },
+  { "꼨", 0.00000000 },
+  { "쏚", 0.00000000 },
+  { "멃", 0.00000000 },
+  { "르", 0.00280000 },
+  { "떝", 0.00000000 },
+  { "뛈", 0.00000000 },
+  { "짶", 0.00000000 },
+  { "휱", 0.00000000 },
+  { "촎", 0.00000000 },
+  { "뾊", 0.00000000 },
+  { "쑐", 0.00000000 },
+  { "씤", 0.00000000 },
+  { "묿", 0.00000000 },
+  { "켱", 0.00000000 },
+  { "텁", 0.00000000 },
+  { "픏", 0.00000000 },
+  { "꽍", 0.00000000 },
+  { "팊", 0.00000000 },
+  { "냝", 0.00000000 },
+  { "뭮", 0.00000000 },
+  { "쓱", 0.00000000 },
+  { "컑", 0.00000000 },
+  { "쁓", 0.00000000 },
+  { "뜨", 0.00010000 },
+  { "빕", 0.00000000 },
+  { "컨", 0.00010000 },
+  { "솅", 0.00000000 },
+  { "밖", 0.00010000 },
+  { "뿚", 0.00000000 },
+  { "귒", 0.00000000 },
+  { "깳", 0.00000000 },
+  { "웝", 0.00000000 },
+  { "댘", 0.00000000 },
+  { "땛", 0.00000000 },
+  { "뱫", 0.00000000 },
+  { "젊", 0.00000000 },
+  { "숻", 0.00000000 },
+  { "뮘", 0.00000000 },
+  { "라", 0.00650000 },
+  { "꼋", 0.00000000 },
+  { "뼭", 0.00000000 },
+  { "뉸", 0.00000000 },
+  { "즺", 0.00000000 },
+  { "뻐", 0.00000000 },
+  { "풥", 0.00000000 },
+  { "옜", 0.00000000 },
+  { "큲", 0.00000000 },
+  { "날", 0.00050000 },
+  { "멖", 0.00000000 },
+  { "갅", 0.00000000 },
+  { "켋", 0.00000000 },
+  { "읮", 0.00000000 },
+  { "껉", 0.00000000 },
+  { "턫", 0.00000000 },
+  { "륣", 0.00000000 },
+  { "혓", 0.00000000 },
+  { "롴", 0.00000000 },
+  { "뢛", 0.00000000 },
+  { "꾃", 0.00000000 },
+  { "쭗", 0.00000000 },
+  { "귷", 0.00000000 },
+  { "썍", 0.00000000 },
+  { "겭", 0.00000000 },
+  { "죋", 0.00000000 },
+  { "퐷", 0.00000000 },
+  { "퀠", 0.00000000 },
+  { "츅", 0.00000000 },
+  { "손", 0.00040000 },
+  { "봟", 0.00000000 },
+  { "츓", 0.00000000 },
+  { "헨", 0.00010000 },
+  { "쥾", 0.00000000 },
+  { "쑨", 0.00000000 },
+  { "줔", 0.00000000 },
+  { "틛", 0.00000000 },
+  { "혪", 0.00000000 },
+  { "솚", 0.00000000 },
+  { "팻", 0.00000000 },
+  { "럀", 0.00000000 },
+  { "떅", 0.00000000 },
+  { "씌", 0.00000000 },
+  { "웥", 0.00000000 },
+  { "벓", 0.00000000 },
+  { "쐨", 0.00000000 },
+  { "탅", 0.00000000 },
+  { "몗", 0.00000000 },
+  { "뒷", 0.00000000 },
+  { "썧", 0.00000000 },
+  { "뭾", 0.00000000 },
+  { "틢", 0.00000000 },
+  { "븈", 0.00000000 },
+  { "뿖", 0.00000000 },
+  { "뒯", 0.00000000 },
+  { "떤", 0.00010000 },
+  { "쏏", 0.00000000 },
+  { "걖", 0.00000000 },
+  { "쓟", 0.00000000 },
+  { "뗍", 0.00000000 },
+  { "핷", 0.00000000 },
+  { "믊", 0.00000000 },
+  { "퉷", 0.00000000 },
+  { "륽", 0.00000000 },
+  { "휇", 0.00000000 },
+  { "혎", 0.00000000 },
+  { "뎄", 0.00000000 },
+  { "쪘", 0.00000000 },
+  { "흥", 0.00020000 },
+  { "갫", 0.00000000 },
+  { "쾣", 0.00000000 },
+  { "돀", 0.00000000 },
+  { "쮀", 0.00000000 },
+  { "뉑", 0.00000000 },
+  { "몓", 0.00000000 },
+  { "굠", 0.00000000 },
+  { "튵", 0.00000000 },
+  { "랍", 0.00010000 },
+  { "컩", 0.00000000 },
+  { "쭤", 0.00000000 },
+  { "몤", 0.00000000 },
+  { "훜", 0.00000000 },
+  { "뵶", 0.00000000 },
+  { "듑", 0.00000000 },
+  { "엪", 0.00000000 },
+  { "뛁", 0.00000000 },
+  { "싄", 0.00000000 },
+  { "햑", 0.00000000 },
+  { "홯", 0.00000000 },
+  { "쫌", 0.00000000 },
+  { "첰", 0.00000000 },
+  { "뇲", 0.00000000 },
+  { "펯", 0.00000000 },
+  { "벥", 0.00000000 },
+  { "춴", 0.00000000 },
+  { "뺴", 0.00000000 },
+  { "족", 0.00080000 },
+  { "쎂", 0.00000000 },
+  { "쑛", 0.00000000 },
+  { "졩", 0.00000000 },
+  { "똹", 0.00000000 },
+  { "휄", 0.00000000 },
+  { "뛇", 0.00000000 },
+  { "좎", 0.00000000 },
+  { "댛", 0.00000000 },
+  { "뇮", 0.00000000 },
+  { "쿼", 0.00000000 },
+  { "쉅", 0.00000000 },
+  { "제", 0.00540000 },
+  { "쏎", 0.00000000 },
+  { "줪", 0.00000000 },
+  { "앞", 0.00020000 },
+  { "떜", 0.00000000 },
+  { "갥", 0.00000000 },
+  { "흘", 0.00000000 },
+  { "벮", 0.00000000 },
+  { "댑", 0.00000000 },
+  { "섮", 0.00000000 },
+  { "뮞", 0.00000000 },
+  { "촼", 0.00000000 },
+  { "뇟", 0.00000000 },
+  { "흵", 0.00000000 },
+  { "뛲", 0.00000000 },
+  { "쉾", 0.00000000 },
+  { "꿪", 0.00000000 },
+  { "뿴", 0.00000000 },
+  { "큩", 0.00000000 },
+  { "튦", 0.00000000 },
+  { "횗", 0.00000000 },
+  { "쓫", 0.00000000 },
+  { "껭", 0.00000000 },
+  { "큘", 0.00000000 },
+  { "냛", 0.00000000 },
+  { "닕", 0.00000000 },
+  { "딑", 0.00000000 },
+  { "혝", 0.00000000 },
+  { "됁", 0.00000000 },
+  { "뢜", 0.00000000 },
+  { "롸", 0.00000000 },
+  { "숲", 0.00000000 },
+  { "꼜", 0.00000000 },
+  { "쵩", 0.00000000 },
+  { "킪", 0.00000000 },
+  { "끎", 0.00000000 },
+  { "밹", 0.00000000 },
+  { "뾜", 0.00000000 },
+  { "뿺", 0.00000000 },
+  { "옶", 0.00000000 },
+  { "챠", 0.00000000 },
+  { "퇘", 0.00000000 },
+  { "걬", 0.00000000 },
+  { "껚", 0.00000000 },
+  { "쩷", 0.00000000 },
+  { "뱊", 0.00000000 },
+  { "쇢", 0.00000000 },
+  { "귻", 0.00000000 },
+  { "륜", 0.00000000 },
+  { "뼩", 0.00000000 },
+  { "쿓", 0.00000000 },
+  { "삢", 0.00000000 },
+  { "몂", 0.00000000 },
+  { "컒", 0.00000000 },
+  { "쌘", 0.00000000 },
+  { "앦", 0.00000000 },
+  { "걈", 0.00000000 },
+  { "뚏", 0.00000000 },
+  { "슱", 0.00000000 },
+  { "턶", 0.00000000 },
+  { "쥘", 0.00000000 },
+  { "륊", 0.00000000 },
+  { "픢", 0.00000000 },
+  { "힒", 0.00000000 },
+  { "뫤", 0.00000000 },
+  { "벖", 0.00000000 },
+  { "뽌", 0.00000000 },
+  { "숵", 0.00000000 },
+  { "됣", 0.00000000 },
+  { "읅", 0.00000000 },
+  { "눥", 0.00000000 },
+  { "뚀", 0.00000000 },
+  { "솈", 0.00000000 },
+  { "씓", 0.00000000 },
+  { "컉", 0.00000000 },
+  { "츋", 0.00000000 },
+  { "넼", 0.00000000 },
+  { "쒎", 0.00000000 },
+  { "챋", 0.00000000 },
+  { "즨", 0.00000000 },
+  { "돫", 0.00000000 },
+  { "톚", 0.00000000 },
+  { "슙", 0.00000000 },
+  { "쐹", 0.00000000 },
+  { "콣", 0.00000000 },
+  { "틩", 0.00000000 },
+  { "륎", 0.00000000 },
+  { "굛", 0.00000000 },
+  { "드", 0.00310000 },
+  { "곐", 0.00000000 },
+  { "뻛", 0.00000000 },
+  { "폣", 0.00000000 },
+  { "혈", 0.00010000 },
+  { "퍣", 0.00000000 },
+  { "듯", 0.00010000 },
+  { "뾏", 0.00000000 },
+  { "텊", 0.00000000 },
+  { "렾", 0.00000000 },
+  { "쌤", 0.00000000 },
+  { "턘", 0.00000000 },
+  { "뇴", 0.00000000 },
+  { "잇", 0.00010000 },
+  { "뉛", 0.00000000 },
+  { "끏", 0.00000000 },
+  { "항", 0.00100000 },
+  { "팃", 0.00000000 },
+  { "츚", 0.00000000 },
+  { "젰", 0.00000000 },
+  { "꿆", 0.00000000 },
+  { "렊", 0.00000000 },
+  { "또", 0.00110000 },
+  { "옸", 0.00000000 },
+  { "볡", 0.00000000 },
+  { "턱", 0.00000000 },
+  { "뻱", 0.00000000 },
+  { "붬", 0.00000000 },
+  { "콖", 0.00000000 },
+  { "솛", 0.00000000 },
+  { "떘", 0.00000000 },
+  { "쥼", 0.00000000 },
+  { "껎", 0.00000000 },
+  { "씰", 0.00000000 },
+  { "뉰", 0.00000000 },
+  { "괬", 0.00000000 },
+  { "썢", 0.00000000 },
+  { "콩", 0.00010000 },
+  { "뼿", 0.00000000 },
+  { "훢", 0.00000000 },
+  { "뷘", 0.00000000 },
+  { "뉡", 0.00000000 },
+  { "쑦", 0.00000000 },
+  { "긢", 0.00000000 },
+  { "찧", 0.00000000 },
+  { "꿦", 0.00000000 },
+  { "증", 0.00050000 },
+  { "뮁", 0.00000000 },
+  { "쯻", 0.00000000 },
+  { "셄", 0.00000000 },
+  { "홟", 0.00000000 },
+  { "딕", 0.00000000 },
+  { "슠", 0.00000000 },
+  { "듃", 0.00000000 },
+  { "봞", 0.00000000 },
+  { "빀", 0.00000000 },
+  { "퉭", 0.00000000 },
+  { "쏣", 0.00000000 },
+  { "칪", 0.00000000 },
+  { "뒒", 0.00000000 },
+  { "쏌", 0.00000000 },
+  { "믡", 0.00000000 },
+  { "긖", 0.00000000 },
+  { "랬", 0.00000000 },
+  { "닻", 0.00000000 },
+  { "첆", 0.00000000 },
+  { "촑", 0.00000000 },
+  { "긣", 0.00000000 },
+  { "돲", 0.00000000 },
+  { "옡", 0.00000000 },
+  { "뼽", 0.00000000 },
+  { "췾", 0.00000000 },
+  { "강", 0.00150000 },
+  { "쐜", 0.00000000 },
+  { "픫", 0.00000000 },
+  { "좃", 0.00000000 },
+  { "왗", 0.00000000 },
+  { "체", 0.00180000 },
+  { "떔", 0.00000000 },
+  { "쒒", 0.00000000 },
+  { "쑿", 0.00000000 },
+  { "쑋", 0.00000000 },
+  { "뚔", 0.00000000 },
+  { "퐊", 0.00000000 },
+  { "폐", 0.00030000 },
+  { "퉵", 0.00000000 },
+  { "콓", 0.00000000 },
+  { "꽪", 0.00000000 },
+  { "펲", 0.00000000 },
+  { "촿", 0.00000000 },
+  { "쳪", 0.00000000 },
+  { "넴", 0.00000000 },
+  { "읥", 0.00000000 },
+  { "쩮", 0.00000000 },
+  { "벹", 0.00000000 },
+  { "녚", 0.00000000 },
+  { "파", 0.00170000 },
+  { "뮙", 0.00000000 },
+  { "곮", 0.00000000 },
+  { "켏", 0.00000000 },
+  { "쫜", 0.00000000 },
+  { "떀", 0.00000000 },
+  { "얎", 0.00000000 },
+  { "쟙", 0.00000000 },
+  { "톀", 0.00000000 },
+  { "켆", 0.00000000 },
+  { "톤", 0.00010000 },
+  { "쭀", 0.00000000 },
+  { "넳", 0.00000000 },
+  { "쬺", 0.00000000 },
+  { "븞", 0.00000000 },
+  { "휝", 0.00000000 },
+  { "딓", 0.00000000 },
+  { "쥺", 0.00000000 },
+  { "떺", 0.00000000 },
+  { "쭞", 0.00000000 },
+  { "립", 0.00100000 },
+  { "븴", 0.00000000 },
+  { "삪", 0.00000000 },
+  { "샛", 0.00000000 },
+  { "첉", 0.00000000 },
+  { "켾", 0.00000000 },
+  { "놅", 0.00000000 },
+  { "웅", 0.00010000 },
+  { "텧", 0.00000000 },
+  { "썥", 0.00000000 },
+  { "췩", 0.00000000 },
+  { "뷞", 0.00000000 },
+  { "엮", 0.00000000 },
+  { "쳳", 0.00000000 },
+  { "뵆", 0.00000000 },
+  { "퇎", 0.00000000 },
+  { "뿋", 0.00000000 },
+  { "툩", 0.00000000 },
+  { "륌", 0.00000000 },
+  { "잵", 0.00000000 },
+  { "솲", 0.00000000 },
+  { "쳤", 0.00010000 },
+  { "츀", 0.00000000 },
+  { "렝", 0.00000000 },
+  { "괽", 0.00000000 },
+  { "팁", 0.00000000 },
+  { "엨", 0.00000000 },
+  { "봅", 0.00000000 },
+  { "툂", 0.00000000 },
+  { "턈", 0.00000000 },
+  { "폊", 0.00000000 },
+  { "퐁", 0.00000000 },
+  { "밃", 0.00000000 },
+  { "퇹", 0.00000000 },
+  { "쪀", 0.00000000 },
+  { "칽", 0.00000000 },
+  { "컓", 0.00000000 },
+  { "뀢", 0.00000000 },
+  { "빱", 0.00000000 },
+  { "뎰", 0.00000000 },
+  { "쭓", 0.00000000 },
+  { "헓", 0.00000000 },
+  { "둫", 0.00000000 },
+  { "슁", 0.00000000 },
+  { "뫭", 0.00000000 },
+  { "륄", 0.00000000 },
+  { "칷", 0.00000000 },
+  { "칲", 0.00000000 },
+  { "횄", 0.00000000 },
+  { "몞", 0.00000000 },
+  { "퇪", 0.00000000 },
+  { "뚿", 0.00000000 },
+  { "잧", 0.00000000 },
+  { "덠", 0.00000000 },
+  { "톞", 0.00000000 },
+  { "풞", 0.00000000 },
+  { "퉑", 0.00000000 },
+  { "쓍", 0.00000000 },
+  { "떡", 0.00000000 },
+  { "꿱", 0.00000000 },
+  { "꽖", 0.00000000 },
+  { "껛", 0.00000000 },
+  { "죯", 0.00000000 },
+  { "꿧", 0.00000000 },
+  { "꽷", 0.00000000 },
+  { "륲", 0.00000000 },
+  { "댭", 0.00000000 },
+  { "쫭", 0.00000000 },
+  { "퀱", 0.00000000 },
+  { "믐", 0.00000000 },
+  { "싡", 0.00000000 },
+  { "뒴", 0.00000000 },
+  { "븭", 0.00000000 },
+  { "흎", 0.00000000 },
+  { "좺", 0.00000000 },
+  { "뵊", 0.00000000 },
+  { "윅", 0.00000000 },
+  { "폦", 0.00000000 },
+  { "멏", 0.00000000 },
+  { "씇", 0.00000000 },
+  { "넭", 0.00000000 },
+  { "괋", 0.00000000 },
+  { "룈", 0.00000000 },
+  { "선", 0.00370000 },
+  { "똢", 0.00000000 },
+  { "탋", 0.00000000 },
+  { "겨", 0.00040000 },
+  { "떑", 0.00000000 },
+  { "빳", 0.00000000 },
+  { "꼪", 0.00000000 },
+  { "뫿", 0.00000000 },
+  { "쏒", 0.00000000 },
+  { "볍", 0.00000000 },
+  { "띢", 0.00000000 },
+  { "뻺", 0.00000000 },
+  { "켰", 0.00020000 },
+  { "뛝", 0.00000000 },
+  { "랦", 0.00000000 },
+  { "좿", 0.00000000 },
+  { "혱", 0.00000000 },
+  { "컏", 0.00000000 },
+  { "넰", 0.00000000 },
+  { "즎", 0.00000000 },
+  { "뤇", 0.00000000 },
+  { "횖", 0.00000000 },
+  { "쩁", 0.00000000 },
+  { "촅", 0.00000000 },
+  { "퐒", 0.00000000 },
+  { "꿽", 0.00000000 },
+  { "윸", 0.00000000 },
+  { "닰", 0.00000000 },
+  { "픸", 0.00000000 },
+  { "쀱", 0.00000000 },
+  { "푋", 0.00000000 },
+  { "쫓", 0.00000000 },
+  { "홖", 0.00000000 },
+  { "륿", 0.00000000 },
+  { "릺", 0.00000000 },
+  { "늲", 0.00000000 },
+  { "셩", 0.00000000 },
+  { "샲", 0.00000000 },
+  { "눢", 0.00000000 },
+  { "줉", 0.00000000 },
+  { "쇌", 0.00000000 },
+  { "졓", 0.00000000 },
+  { "듉", 0.00000000 },
+  { "죗", 0.00000000 },
+  { "넦", 0.00000000 },
+  { "릃", 0.00000000 },
+  { "춢", 0.00000000 },
+  { "퉴", 0.00000000 },
+  { "쀆", 0.00000000 },
+  { "첚", 0.00000000 },
+  { "똔", 0.00000000 },
+  { "햸", 0.00000000 },
+  { "푉", 0.00000000 },
+  { "젱", 0.00000000 },
+  { "웯", 0.00000000 },
+  { "멧", 0.00000000 },
+  { "뻕", 0.00000000 },
+  { "뚪", 0.00000000 },
+  { "핆", 0.00000000 },
+  { "윊", 0.00000000 },
+  { "젺", 0.00000000 },
+  { "펰", 0.00000000 },
+  { "꺾", 0.00000000 },
+  { "븮", 0.00000000 },
+  { "뱬", 0.00000000 },
+  { "헰", 0.00000000 },
+  { "몝", 0.00000000 },
+  { "섉", 0.00000000 },
+  { "너", 0.00040000 },
+  { "촰", 0.00000000 },
+  { "얔", 0.00000000 },
+  { "럅", 0.00000000 },
+  { "낓", 0.00000000 },
+  { "뼆", 0.00000000 },
+  { "툱", 0.00000000 },
+  { "쩚", 0.00000000 },
+  { "쁰", 0.00000000 },
+  { "뭁", 0.00000000 },
+  { "양", 0.00150000 },
+  { "듲", 0.00000000 },
+  { "좾", 0.00000000 },
+  { "뛙", 0.00000000 },
+  { "갔", 0.00020000 },
+  { "뷝", 0.00000000 },
+  { "륗", 0.00000000 },
+  { "몧", 0.00000000 },
+  { "쮓", 0.00000000 },
+  { "덫", 0.00000000 },
+  { "컔", 0.00000000 },
+  { "걭", 0.00000000 },
+  { "봪", 0.00000000 },
+  { "끽", 0.00000000 },
+  { "퐬", 0.00000000 },
+  { "먳", 0.00000000 },
+  { "븇", 0.00000000 },
+  { "싸", 0.00020000 },
+  { "꾴", 0.00000000 },
+  { "껻", 0.00000000 },
+  { "됟", 0.00000000 },
+  { "쩱", 0.00000000 },
+  { "쿟", 0.00000000 },
+  { "씀", 0.00000000 },
+  { "멦", 0.00000000 },
+  { "벂", 0.00000000 },
+  { "펕", 0.00000000 },
+  { "빫", 0.00000000 },
+  { "퉕", 0.00000000 },
+  { "웧", 0.00000000 },
+  { "쁈", 0.00000000 },
+  { "뤯", 0.00000000 },
+  { "륵", 0.00000000 },
+  { "먺", 0.00000000 },
+  { "콛", 0.00000000 },
+  { "넲", 0.00000000 },
+  { "놺", 0.00000000 },
+  { "햦", 0.00000000 },
+  { "뫎", 0.00000000 },
+  { "룒", 0.00000000 },
+  { "쏾", 0.00000000 },
+  { "쬰", 0.00000000 },
+  { "릤", 0.00000000 },
+  { "혛", 0.00000000 },
+  { "퓘", 0.00000000 },
+  { "돹", 0.00000000 },
+  { "킚", 0.00000000 },
+  { "큚", 0.00000000 },
+  { "쏓", 0.00000000 },
+  { "넷", 0.00010000 },
+  { "콤", 0.00000000 },
+  { "뵸", 0.00000000 },
+  { "룢", 0.00000000 },
+  { "캌", 0.00000000 },
+  { "왻", 0.00000000 },
+  { "컭", 0.00000000 },
+  { "맚", 0.00000000 },
+  { "소", 0.00320000 },
+  { "뉷", 0.00000000 },
+  { "쮈", 0.00000000 },
+  { "쵘", 0.00000000 },
+  { "뒤", 0.00050000 },
+  { "버", 0.00120000 },
+  { "엂", 0.00000000 },
+  { "떆", 0.00000000 },
+  { "겛", 0.00000000 },
+  { "믥", 0.00000000 },
+  { "탈", 0.00050000 },
+  { "펒", 0.00000000 },
+  { "뷪", 0.00000000 },
+  { "띭", 0.00000000 },
+  { "란", 0.00090000 },
+  { "픙", 0.00000000 },
+  { "꽰", 0.00000000 },
+  { "휀", 0.00000000 },
+  { "랉", 0.00000000 },
+  { "콟", 0.00000000 },
+  { "핾", 0.00000000 },
+  { "왣", 0.00000000 },
+  { "뮍", 0.00000000 },
+  { "귽", 0.00000000 },
+  { "챡", 0.00000000 },
+  { "퀉", 0.00000000 },
+  { "홎", 0.00000000 },
+  { "욎", 0.00000000 },
+  { "쒹", 0.00000000 },
+  { "뤍", 0.00000000 },
+  { "잛", 0.00000000 },
+  { "쎵", 0.00000000 },
+  { "해", 0.00570000 },
+  { "견", 0.00050000 },
+  { "쒥", 0.00000000 },
+  { "툔", 0.00000000 },
+  { "휛", 0.00000000 },
+  { "뗕", 0.00000000 },
+  { "폚", 0.00000000 },
+  { "겙", 0.00000000 },
+  { "탄", 0.00050000 },
+  { "둩", 0.00000000 },
+  { "쟄", 0.00000000 },
+  { "걪", 0.00000000 },
+  { "잱", 0.00000000 },
+  { "롘", 0.00000000 },
+  { "퉸", 0.00000000 },
+  { "펃", 0.00000000 },
+  { "야", 0.00150000 },
+  { "얅", 0.00000000 },
+  { "삏", 0.00000000 },
+  { "뙩", 0.00000000 },
+  { "쇊", 0.00000000 },
+  { "싚", 0.00000000 },
+  { "낇", 0.00000000 },
+  { "솘", 0.00000000 },
+  { "뚛", 0.00000000 },
+  { "쉥", 0.00000000 },
+  { "탱", 0.00000000 },
+  { "쉿", 0.00000000 },
+  { "떰", 0.00000000 },
+  { "죤", 0.00000000 },
+  { "냞", 0.00000000 },
+  { "띆", 0.00000000 },
+  { "씉", 0.00000000 },
+  { "둏", 0.00000000 },
+  { "퇜", 0.00000000 },
+  { "탮", 0.00000000 },
+  { "퀊", 0.00000000 },
+  { "놓", 0.00020000 },
+  { "튏", 0.00000000 },
+  { "줮", 0.00000000 },
+  { "윴", 0.00000000 },
+  { "뤉", 0.00000000 },
+  { "켝", 0.00000000 },
+  { "쨗", 0.00000000 },
+  { "찾", 0.00020000 },
+  { "싪", 0.00000000 },
+  { "댖", 0.00000000 },
+  { "뤲", 0.00000000 },
+  { "풐", 0.00000000 },
+  { "굢", 0.00000000 },
+  { "댌", 0.00000000 },
+  { "묛", 0.00000000 },
+  { "쓉", 0.00000000 },
+  { "늹", 0.00000000 },
+  { "폍", 0.00000000 },
+  { "핦", 0.00000000 },
+  { "힓", 0.00000000 },
+  { "냉", 0.00000000 },
+  { "컳", 0.00000000 },
+  { "폤", 0.00000000 },
+  { "헍", 0.00000000 },
+  { "총", 0.00070000 },
+  { "괧", 0.00000000 },
+  { "둵", 0.00000000 },
+  { "풛", 0.00000000 },
+  { "괯", 0.00000000 },
+  { "뀷", 0.00000000 },
+  { "씏", 0.00000000 },
+  { "짾", 0.00000000 },
+  { "뵞", 0.00000000 },
+  { "꼎", 0.00000000 },
+  { "햠", 0.00000000 },
+  { "궃", 0.00000000 },
+  { "룽", 0.00000000 },
+  { "큣", 0.00000000 },
+  { "쿒", 0.00000000 },
+  { "웲", 0.00000000 },
+  { "컱", 0.00000000 },
+  { "춒", 0.00000000 },
+  { "볲", 0.00000000 },
+  { "톢", 0.00000000 },
+  { "엹", 0.00000000 },
+  { "련", 0.00050000 },
+  { "촓", 0.00000000 },
+  { "퉧", 0.00000000 },
+  { "쾛", 0.00000000 },
+  { "뵵", 0.00000000 },
+  { "솠", 0.00000000 },
+  { "솄", 0.00000000 },
+  { "쉌", 0.00000000 },
+  { "껗", 0.00000000 },
+  { "턉", 0.00000000 },
+  { "낷", 0.00000000 },
+  { "얶", 0.00000000 },
+  { "쾌", 0.00000000 },
+  { "퐣", 0.00000000 },
+  { "듞", 0.00000000 },
+  { "깥", 0.00000000 },
+  { "먱", 0.00000000 },
+  { "욤", 0.00000000 },
+  { "짐", 0.00010000 },
+  { "봿", 0.00000000 },
+  { "홗", 0.00000000 },
+  { "쳛", 0.00000000 },
+  { "쀅", 0.00000000 },
+  { "랋", 0.00000000 },
+  { "잦", 0.00000000 },
+  { "찔", 0.00000000 },
+  { "툕", 0.00000000 },
+  { "찑", 0.00000000 },
+  { "걡", 0.00000000 },
+  { "꿭", 0.00000000 },
+  { "높", 0.00030000 },
+  { "뗥", 0.00000000 },
+  { "웚", 0.00000000 },
+  { "쑖", 0.00000000 },
+  { "맻", 0.00000000 },
+  { "깡", 0.00000000 },
+  { "땦", 0.00000000 },
+  { "뫳", 0.00000000 },
+  { "쉣", 0.00000000 },
+  { "췃", 0.00000000 },
+  { "뮢", 0.00000000 },
+  { "턀", 0.00000000 },
+  { "웇", 0.00000000 },
+  { "쩕", 0.00000000 },
+  { "찡", 0.00000000 },
+  { "껬", 0.00000000 },
+  { "퇩", 0.00000000 },
+  { "픡", 0.00000000 },
+  { "걦", 0.00000000 },
+  { "즚", 0.00000000 },
+  { "쨬", 0.00000000 },
+  { "콰", 0.00000000 },
+  { "썠", 0.00000000 },
+  { "뚜", 0.00000000 },
+  { "첪", 0.00000000 },
+  { "촆", 0.00000000 },
+  { "뚶", 0.00000000 },
+  { "뗭", 0.00000000 },
+  { "쿫", 0.00000000 },
+  { "헯", 0.00000000 },
+  { "맮", 0.00000000 },
+  { "롣", 0.00000000 },
+  { "엕", 0.00000000 },
+  { "덎", 0.00000000 },
+  { "공", 0.00380000 },
+  { "쮤", 0.00000000 },
+  { "숺", 0.00000000 },
+  { "왖", 0.00000000 },
+  { "덂", 0.00000000 },
+  { "닠", 0.00000000 },
+  { "뷴", 0.00000000 },
+  { "쇔", 0.00000000 },
+  { "꺔", 0.00000000 },
+  { "맄", 0.00000000 },
+  { "섊", 0.00000000 },
+  { "슰", 0.00000000 },
+  { "셎", 0.00000000 },
+  { "쵉", 0.00000000 },
+  { "냗", 0.00000000 },
+  { "댔", 0.00000000 },
+  { "쪬", 0.00000000 },
+  { "횥", 0.00000000 },
+  { "쵋", 0.00000000 },
+  { "덃", 0.00000000 },
+  { "틐", 0.00000000 },
+  { "밋", 0.00000000 },
+  { "맞", 0.00020000 },
+  { "쎫", 0.00000000 },
+  { "낗", 0.00000000 },
+  { "셽", 0.00000000 },
+  { "챶", 0.00000000 },
+  { "퐕", 0.00000000 },
+  { "담", 0.00040000 },
+  { "뇜", 0.00000000 },
+  { "꾸", 0.00010000 },
+  { "턼", 0.00000000 },
+  { "펥", 0.00000000 },
+  { "뽺", 0.00000000 },
+  { "쩴", 0.00000000 },
+  { "굲", 0.00000000 },
+  { "랒", 0.00000000 },
+  { "벩", 0.00000000 },
+  { "돢", 0.00000000 },
+  { "꺐", 0.00000000 },
+  { "탵", 0.00000000 },
+  { "좨", 0.00000000 },
+  { "윛", 0.00000000 },
+  { "봼", 0.00000000 },
+  { "쏭", 0.00000000 },
+  { "찥", 0.00000000 },
+  { "껾", 0.00000000 },
+  { "닀", 0.00000000 },
+  { "쎇", 0.00000000 },
+  { "웣", 0.00000000 },
+  { "똾", 0.00000000 },
+  { "긓", 0.00000000 },
+  { "룥", 0.00000000 },
+  { "룏", 0.00000000 },
+  { "눡", 0.00000000 },
+  { "쩐", 0.00000000 },
+  { "읚", 0.00000000 },
+  { "뱕", 0.00000000 },
+  { "뵔", 0.00000000 },
+  { "롬", 0.00010000 },
+  { "퓪", 0.00000000 },
+  { "띍", 0.00000000 },
+  { "쯱", 0.00000000 },
+  { "앷", 0.00000000 },
+  { "넾", 0.00000000 },
+  { "쪢", 0.00000000 },
+  { "넕", 0.00000000 },
+  { "뱝", 0.00000000 },
+  { "쀪", 0.00000000 },
+  { "똡", 0.00000000 },
+  { "캒", 0.00000000 },
+  { "긟", 0.00000000 },
+  { "롨", 0.00000000 },
+  { "뮏", 0.00000000 },
+  { "샶", 0.00000000 },
+  { "툐", 0.00000000 },
+  { "쏉", 0.00000000 },
+  { "죟", 0.00000000 },
+  { "넗", 0.00000000 },
+  { "댜", 0.00000000 },
+  { "곙", 0.00000000 },
+  { "쫹", 0.00000000 },
+  { "갮", 0.00000000 },
+  { "딯", 0.00000000 },
+  { "따", 0.00080000 },
+  { "픍", 0.00000000 },
+  { "았", 0.00110000 },
+  { "똏", 0.00000000 },
+  { "뤚", 0.00000000 },
+  { "뒳", 0.00000000 },
+  { "똖", 0.00000000 },
+  { "믍", 0.00000000 },
+  { "콅", 0.00000000 },
+  { "쪝", 0.00000000 },
+  { "넎", 0.00000000 },
+  { "꿷", 0.00000000 },
+  { "솸", 0.00000000 },
+  { "쌏", 0.00000000 },
+  { "밾", 0.00000000 },
+  { "쫙", 0.00000000 },
+  { "켚", 0.00000000 },
+  { "뇚", 0.00000000 },
+  { "쾿", 0.00000000 },
+  { "뢂", 0.00000000 },
+  { "쀻", 0.00000000 },
+  { "혘", 0.00000000 },
+  { "뤐", 0.00000000 },
+  { "읧", 0.00000000 },
+  { "앣", 0.00000000 },
+  { "완", 0.00040000 },
+  { "먙", 0.00000000 },
+  { "웆", 0.00000000 },
+  { "슥", 0.00000000 },
+  { "퓍", 0.00000000 },
+  { "댮", 0.00000000 },
+  { "꼉", 0.00000000 },
+  { "듁", 0.00000000 },
+  { "뽦", 0.00000000 },
+  { "쐑", 0.00000000 },
+  { "먟", 0.00000000 },
+  { "괼", 0.00000000 },
+  { "둧", 0.00000000 },
+  { "쟻", 0.00000000 },
+  { "눛", 0.00000000 },
+  { "텵", 0.00000000 },
+  { "늀", 0.00000000 },
+  { "쨻", 0.00000000 },
+  { "쁚", 0.00000000 },
+  { "춥", 0.00000000 },
+  { "늂", 0.00000000 },
+  { "샃", 0.00000000 },
+  { "밈", 0.00000000 },
+  { "쁆", 0.00000000 },
+  { "멟", 0.00000000 },
+  { "켎", 0.00000000 },
+  { "묗", 0.00000000 },
+  { "젻", 0.00000000 },
+  { "쟴", 0.00000000 },
+  { "볛", 0.00000000 },
+  { "뜶", 0.00000000 },
+  { "뷷", 0.00000000 },
+  { "녇", 0.00000000 },
+  { "쐀", 0.00000000 },
+  { "쏸", 0.00000000 },
+  { "게", 0.00380000 },
+  { "넖", 0.00000000 },
+  { "퍪", 0.00000000 },
+  { "긿", 0.00000000 },
+  { "쩝", 0.00000000 },
+  { "엉", 0.00000000 },
+  { "꾤", 0.00000000 },
+  { "엺", 0.00000000 },
+  { "쯑", 0.00000000 },
+  { "뵢", 0.00000000 },
+  { "왰", 0.00000000 },
+  { "쁘", 0.00000000 },
+  { "뫕", 0.00000000 },
+  { "뻜", 0.00000000 },
+  { "쪣", 0.00000000 },
+  { "꿉", 0.00000000 },
+  { "놊", 0.00000000 },
+  { "탰", 0.00000000 },
+  { "틼", 0.00000000 },
+  { "뒋", 0.00000000 },
+  { "뚘", 0.00000000 },
+  { "쐊", 0.00000000 },
+  { "댪", 0.00000000 },
+  { "쨃", 0.00000000 },
+  { "뽅", 0.00000000 },
+  { "뾪", 0.00000000 },
+  { "냩", 0.00000000 },
+  { "아", 0.00690000 },
+  { "걼", 0.00000000 },
+  { "옞", 0.00000000 },
+  { "좛", 0.00000000 },
+  { "뷻", 0.00000000 },
+  { "춡", 0.00000000 },
+  { "쌲", 0.00000000 },
+  { "츍", 0.00000000 },
+  { "톘", 0.00000000 },
+  { "쫵", 0.00000000 },
+  { "랣", 0.00000000 },
+  { "끳", 0.00000000 },
+  { "킝", 0.00000000 },
+  { "홄", 0.00000000 },
+  { "탼", 0.00000000 },
+  { "텾", 0.00000000 },
+  { "퉒", 0.00000000 },
+  { "뫴", 0.00000000 },
+  { "깶", 0.00000000 },
+  { "휩", 0.00000000 },
+  { "쟯", 0.00000000 },
+  { "큎", 0.00000000 },
+  { "롶", 0.00000000 },
+  { "함", 0.00140000 },
+  { "빮", 0.00000000 },
+  { "곫", 0.00000000 },
+  { "쏪", 0.00000000 },
+  { "튋", 0.00000000 },
+  { "쓼", 0.00000000 },
+  { "빬", 0.00000000 },
+  { "솳", 0.00000000 },
+  { "릐", 0.00000000 },
+  { "걙", 0.00000000 },
+  { "쨋", 0.00000000 },
+  { "묡", 0.00000000 },
+  { "윤", 0.00020000 },
+  { "붫", 0.00000000 },
+  { "쫱", 0.00000000 },
+  { "릫", 0.00000000 },
+  { "졈", 0.00000000 },
+  { "퓼", 0.00000000 },
+  { "쯂", 0.00000000 },
+  { "쮉", 0.00000000 },
+  { "널", 0.00030000 },
+  { "쪱", 0.00000000 },
+  { "캨", 0.00000000 },
+  { "홹", 0.00000000 },
+  { "샳", 0.00000000 },
+  { "딨", 0.00000000 },
+  { "뚺", 0.00000000 },
+  { "죖", 0.00000000 },
+  { "덌", 0.00000000 },
+  { "맽", 0.00000000 },
+  { "퍐", 0.00000000 },
+  { "헱", 0.00000000 },
+  { "줇", 0.00000000 },
+  { "헭", 0.00000000 },
+  { "튅", 0.00000000 },
+  { "톷", 0.00000000 },
+  { "뢄", 0.00000000 },
+  { "줥", 0.00000000 },
+  { "귟", 0.00000000 },
+  { "늅", 0.00000000 },
+  { "큟", 0.00000000 },
+  { "렍", 0.00000000 },
+  { "륔", 0.00000000 },
+  { "줛", 0.00000000 },
+  { "씠", 0.00000000 },
+  { "훙", 0.00000000 },
+  { "껠", 0.00000000 },
+  { "렯", 0.00000000 },
+  { "빪", 0.00000000 },
+  { "윞", 0.00000000 },
+  { "죈", 0.00000000 },
+  { "짯", 0.00000000 },
+  { "슢", 0.00000000 },
+  { "쐞", 0.00000000 },
+  { "뎝", 0.00000000 },
+  { "퍑", 0.00000000 },
+  { "똮", 0.00000000 },
+  { "딾", 0.00000000 },
+  { "댂", 0.00000000 },
+  { "럡", 0.00000000 },
+  { "탳", 0.00000000 },
+  { "쯐", 0.00000000 },
+  { "샥", 0.00000000 },
+  { "뻊", 0.00000000 },
+  { "뛟", 0.00000000 },
+  { "숎", 0.00000000 },
+  { "같", 0.00090000 },
+  { "뜺", 0.00000000 },
+  { "엷", 0.00000000 },
+  { "봃", 0.00000000 },
+  { "즄", 0.00000000 },
+  { "끯", 0.00000000 },
+  { "횲", 0.00000000 },
+  { "먫", 0.00000000 },
+  { "늺", 0.00000000 },
+  { "륞", 0.00000000 },
+  { "뽔", 0.00000000 },
+  { "냖", 0.00000000 },
+  { "랪", 0.00000000 },
+  { "첱", 0.00000000 },
+  { "쌚", 0.00000000 },
+  { "쉔", 0.00000000 },
+  { "뒿", 0.00000000 },
+  { "쒵", 0.00000000 },
+  { "릾", 0.00000000 },
+  { "틽", 0.00000000 },
+  { "셚", 0.00000000 },
+  { "숾", 0.00000000 },
+  { "쏅", 0.00000000 },
+  { "쌕", 0.00000000 },
+  { "꺛", 0.00000000 },
+  { "쫏", 0.00000000 },
+  { "믮", 0.00000000 },
+  { "킔", 0.00000000 },
+  { "졎", 0.00000000 },
+  { "듹", 0.00000000 },
+  { "녙", 0.00000000 },
+  { "뮋", 0.00000000 },
+  { "짢", 0.00000000 },
+  { "묎", 0.00000000 },
+  { "뺡", 0.00000000 },
+  { "홫", 0.00000000 },
+  { "뾭", 0.00000000 },
+  { "렶", 0.00000000 },
+  { "놏", 0.00000000 },
+  { "붶", 0.00000000 },
+  { "진", 0.00270000 },
+  { "삦", 0.00000000 },
+  { "풗", 0.00000000 },
+  { "퍚", 0.00000000 },
+  { "혮", 0.00000000 },
+  { "믰", 0.00000000 },
+  { "뿈", 0.00000000 },
+  { "콄", 0.00000000 },
+  { "쒬", 0.00000000 },
+  { "턷", 0.00000000 },
+  { "돺", 0.00000000 },
+  { "덗", 0.00000000 },
+  { "쏨", 0.00000000 },
+  { "뫱", 0.00000000 },
+  { "쿔", 0.00000000 },
+  { "뺒", 0.00000000 },
+  { "왉", 0.00000000 },
+  { "쥬", 0.00000000 },
+  { "깈", 0.00000000 },
+  { "뷳", 0.00000000 },
+  { "퉼", 0.00000000 },
+  { "떏", 0.00000000 },
+  { "느", 0.00020000 },
+  { "겧", 0.00000000 },
+  { "냙", 0.00000000 },
+  { "쩍", 0.00000000 },
+  { "뚭", 0.00000000 },
+  { "몐", 0.00000000 },
+  { "핈", 0.00000000 },
+  { "쟡", 0.00000000 },
+  { "롋", 0.00000000 },
+  { "쨖", 0.00000000 },
+  { "푘", 0.00000000 },
+  { "밺", 0.00000000 },
+  { "튜", 0.00010000 },
+  { "뼁", 0.00000000 },
+  { "껋", 0.00000000 },
+  { "뽸", 0.00000000 },
+  { "싎", 0.00000000 },
+  { "횑", 0.00000000 },
+  { "씮", 0.00000000 },
+  { "쒮", 0.00000000 },
+  { "젇", 0.00000000 },
+  { "삼", 0.00050000 },
+  { "긅", 0.00000000 },
+  { "퉊", 0.00000000 },
+  { "쐉", 0.00000000 },
+  { "벢", 0.00000000 },
+  { "칬", 0.00000000 },
+  { "쇧", 0.00000000 },
+  { "쿏", 0.00000000 },
+  { "캭", 0.00000000 },
+  { "퐋", 0.00000000 },
+  { "띔", 0.00000000 },
+  { "쳽", 0.00000000 },
+  { "셧", 0.00000000 },
+  { "퉛", 0.00000000 },
+  { "뿡", 0.00000000 },
+  { "갎", 0.00000000 },
+  { "쇎", 0.00000000 },
+  { "촜", 0.00000000 },
+  { "셀", 0.00010000 },
+  { "쬝", 0.00000000 },
+  { "쇄", 0.00010000 },
+  { "왊", 0.00000000 },
+  { "숇", 0.00000000 },
+  { "꺆", 0.00000000 },
+  { "졏", 0.00000000 },
+  { "딺", 0.00000000 },
+  { "쫴", 0.00000000 },
+  { "삷", 0.00000000 },
+  { "쬑", 0.00000000 },
+  { "촽", 0.00000000 },
+  { "칢", 0.00000000 },
+  { "펶", 0.00000000 },
+  { "뜓", 0.00000000 },
+  { "딡", 0.00000000 },
+  { "끨", 0.00000000 },
+  { "룟", 0.00000000 },
+  { "쾍", 0.00000000 },
+  { "셁", 0.00000000 },
+  { "얃", 0.00000000 },
+  { "쨚", 0.00000000 },
+  { "첞", 0.00000000 },
+  { "뚉", 0.00000000 },
+  { "뙛", 0.00000000 },
+  { "죠", 0.00000000 },
+  { "갠", 0.00000000 },
+  { "뗆", 0.00000000 },
+  { "쇤", 0.00000000 },
+  { "쨙", 0.00000000 },
+  { "쭋", 0.00000000 },
+  { "쉼", 0.00000000 },
+  { "런", 0.00040000 },
+  { "닷", 0.00000000 },
+  { "헦", 0.00000000 },
+  { "뱆", 0.00000000 },
+  { "봤", 0.00000000 },
+  { "랧", 0.00000000 },
+  { "햔", 0.00000000 },
+  { "먓", 0.00000000 },
+  { "넺", 0.00000000 },
+  { "욠", 0.00000000 },
+  { "퍅", 0.00000000 },
+  { "뤆", 0.00000000 },
+  { "냫", 0.00000000 },
+  { "쀉", 0.00000000 },
+  { "쐒", 0.00000000 },
+  { "띌", 0.00000000 },
+  { "큄", 0.00000000 },
+  { "멂", 0.00000000 },
+  { "쐫", 0.00000000 },
+  { "쑑", 0.00000000 },
+  { "쫛", 0.00000000 },
+  { "먽", 0.00000000 },
+  { "믗", 0.00000000 },
+  { "쬛", 0.00000000 },
+  { "쉵", 0.00000000 },
+  { "튬", 0.00000000 },
+  { "갃", 0.00000000 },
+  { "껥", 0.00000000 },
+  { "쫻", 0.00000000 },
+  { "퓷", 0.00000000 },
+  { "륺", 0.00000000 },
+  { "웙", 0.00000000 },
+  { "쵢", 0.00000000 },
+  { "퉋", 0.00000000 },
+  { "만", 0.00370000 },
+  { "읾", 0.00000000 },
+  { "굝", 0.00000000 },
+  { "돵", 0.00000000 },
+  { "삱", 0.00000000 },
+  { "뵿", 0.00000000 },
+  { "횚", 0.00000000 },
+  { "쏺", 0.00000000 },
+  { "둟", 0.00000000 },
+  { "붢", 0.00000000 },
+  { "뭽", 0.00000000 },
+  { "쐾", 0.00000000 },
+  { "옼", 0.00000000 },
+  { "뫻", 0.00000000 },
+  { "뽹", 0.00000000 },
+  { "둣", 0.00000000 },
+  { "셿", 0.00000000 },
+  { "찣", 0.00000000 },
+  { "꽸", 0.00000000 },
+  { "졙", 0.00000000 },
+  { "덢", 0.00000000 },
+  { "풨", 0.00000000 },
+  { "틨", 0.00000000 },
+  { "훝", 0.00000000 },
+  { "븩", 0.00000000 },
+  { "븪", 0.00000000 },
+  { "궾", 0.00000000 },
+  { "닍", 0.00000000 },
+  { "뗶", 0.00000000 },
+  { "깂", 0.00000000 },
+  { "쁖", 0.00000000 },
+  { "춊", 0.00000000 },
+  { "턦", 0.00000000 },
+  { "픎", 0.00000000 },
+  { "껢", 0.00000000 },
+  { "팤", 0.00000000 },
+  { "턥", 0.00000000 },
+  { "쁞", 0.00000000 },
+  { "짵", 0.00000000 },
+  { "퉚", 0.00000000 },
+  { "퇧", 0.00000000 },
+  { "뽍", 0.00000000 },
+  { "셷", 0.00000000 },
+  { "잃", 0.00010000 },
+  { "휫", 0.00000000 },
+  { "잋", 0.00000000 },
+  { "뿢", 0.00000000 },
+  { "킦", 0.00000000 },
+  { "쀡", 0.00000000 },
+  { "뇺", 0.00000000 },
+  { "뇠", 0.00000000 },
+  { "솉", 0.00000000 },
+  { "궣", 0.00000000 },
+  { "뙞", 0.00000000 },
+  { "쯉", 0.00000000 },
+  { "싿", 0.00000000 },
+  { "띚", 0.00000000 },
+  { "갸", 0.00000000 },
+  { "쫶", 0.00000000 },
+  { "놴", 0.00000000 },
+  { "뺩", 0.00000000 },
+  { "쌨", 0.00000000 },
+  { "홧", 0.00000000 },
+  { "퇐", 0.00000000 },
+  { "셠", 0.00000000 },
+  { "룎", 0.00000000 },
+  { "썜", 0.00000000 },
+  { "륳", 0.00000000 },
+  { "춖", 0.00000000 },
+  { "벁", 0.00000000 },
+  { "한", 0.01200000 },
+  { "툛", 0.00000000 },
+  { "턮", 0.00000000 },
+  { "뾰", 0.00000000 },
+  { "꽡", 0.00000000 },
+  { "쥮", 0.00000000 },
+  { "픤", 0.00000000 },
+  { "깗", 0.00000000 },
+  { "묇", 0.00000000 },
+  { "뿱", 0.00000000 },
+  { "쭑", 0.00000000 },
+  { "캛", 0.00000000 },
+  { "읕", 0.00000000 },
+  { "솟", 0.00000000 },
+  { "쁎", 0.00000000 },
+  { "궰", 0.00000000 },
+  { "잫", 0.00000000 },
+  { "잾", 0.00000000 },
+  { "쟪", 0.00000000 },
+  { "뽬", 0.00000000 },
+  { "췯", 0.00000000 },
+  { "욈", 0.00000000 },
+  { "뛋", 0.00000000 },
+  { "졫", 0.00000000 },
+  { "떫", 0.00000000 },
+  { "땸", 0.00000000 },
+  { "롉", 0.00000000 },
+  { "쀝", 0.00000000 },
+  { "슌", 0.00000000 },
+  { "텣", 0.00000000 },
+  { "툹", 0.00000000 },
+  { "쨽", 0.00000000 },
+  { "뱩", 0.00000000 },
+  { "켦", 0.00000000 },
+  { "쐴", 0.00000000 },
+  { "쬃", 0.00000000 },
+  { "큻", 0.00000000 },
+  { "틍", 0.00000000 },
+  { "검", 0.00030000 },
+  { "먝", 0.00000000 },
+  { "즪", 0.00000000 },
+  { "훒", 0.00000000 },
+  { "슷", 0.00010000 },
+  { "춼", 0.00000000 },
+  { "냔", 0.00000000 },
+  { "윔", 0.00000000 },
+  { "꿋", 0.00000000 },
+  { "튣", 0.00000000 },
+  { "업", 0.00140000 },
+  { "벉", 0.00000000 },
+  { "싆", 0.00000000 },
+  { "뽛", 0.00000000 },
+  { "윶", 0.00000000 },
+  { "쿶", 0.00000000 },
+  { "궇", 0.00000000 },
+  { "헼", 0.00000000 },
+  { "혇", 0.00000000 },
+  { "뭬", 0.00000000 },
+  { "빖", 0.00000000 },
+  { "본", 0.00180000 },
+  { "랙", 0.00010000 },
+  { "믞", 0.00000000 },
+  { "뺗", 0.00000000 },
+  { "뜊", 0.00000000 },
+  { "왱", 0.00000000 },
+  { "렔", 0.00000000 },
+  { "꼿", 0.00000000 },
+  { "뢁", 0.00000000 },
+  { "붕", 0.00010000 },
+  { "쐏", 0.00000000 },
+  { "씄", 0.00000000 },
+  { "쇩", 0.00000000 },
+  { "쏍", 0.00000000 },
+  { "햡", 0.00000000 },
+  { "삕", 0.00000000 },
+  { "쵴", 0.00000000 },
+  { "픖", 0.00000000 },
+  { "쨢", 0.00000000 },
+  { "궍", 0.00000000 },
+  { "쩑", 0.00000000 },
+  { "닛", 0.00000000 },
+  { "떹", 0.00000000 },
+  { "죲", 0.00000000 },
+  { "뇍", 0.00000000 },
+  { "탓", 0.00000000 },
+  { "냪", 0.00000000 },
+  { "멵", 0.00000000 },
+  { "뭩", 0.00000000 },
+  { "쯚", 0.00000000 },
+  { "밵", 0.00000000 },
+  { "븛", 0.00000000 },
+  { "춺", 0.00000000 },
+  { "빆", 0.00000000 },
+  { "즵", 0.00000000 },
+  { "쿣", 0.00000000 },
+  { "뼂", 0.00000000 },
+  { "뤨", 0.00000000 },
+  { "엟", 0.00000000 },
+  { "묩", 0.00000000 },
+  { "졟", 0.00000000 },
+  { "쳅", 0.00000000 },
+  { "뙗", 0.00000000 },
+  { "빛", 0.00010000 },
+  { "꼞", 0.00000000 },
+  { "럽", 0.00040000 },
+  { "갡", 0.00000000 },
+  { "좘", 0.00000000 },
+  { "앒", 0.00000000 },
+  { "뒛", 0.00000000 },
+  { "겆", 0.00000000 },
+  { "껹", 0.00000000 },
+  { "뉳", 0.00000000 },
+  { "뾠", 0.00000000 },
+  { "헎", 0.00000000 },
+  { "윧", 0.00000000 },
+  { "뫣", 0.00000000 },
+  { "솹", 0.00000000 },
+  { "굥", 0.00000000 },
+  { "툆", 0.00000000 },
+  { "쌓", 0.00000000 },
+  { "쪚", 0.00000000 },
+  { "쟽", 0.00000000 },
+  { "춫", 0.00000000 },
+  { "겺", 0.00000000 },
+  { "듈", 0.00000000 },
+  { "쮭", 0.00000000 },
+  { "퇺", 0.00000000 },
+  { "쒱", 0.00000000 },
+  { "읂", 0.00000000 },
+  { "횉", 0.00000000 },
+  { "떼", 0.00000000 },
+  { "퐾", 0.00000000 },
+  { "뗜", 0.00000000 },
+  { "똲", 0.00000000 },
+  { "빩", 0.00000000 },
+  { "궑", 0.00000000 },
+  { "챴", 0.00000000 },
+  { "쉢", 0.00000000 },
+  { "쵈", 0.00000000 },
+  { "퇲", 0.00000000 },
+  { "눍", 0.00000000 },
+  { "쑤", 0.00000000 },
+  { "껐", 0.00000000 },
+  { "쭃", 0.00000000 },
+  { "쉺", 0.00000000 },
+  { "땍", 0.00000000 },
+  { "쉒", 0.00000000 },
+  { "쟁", 0.00050000 },
+  { "홇", 0.00000000 },
+  { "횰", 0.00000000 },
+  { "쓀", 0.00000000 },
+  { "뵙", 0.00000000 },
+  { "셛", 0.00000000 },
+  { "믄", 0.00000000 },
+  { "홮", 0.00000000 },
+  { "즹", 0.00000000 },
+  { "욦", 0.00000000 },
+  { "겠", 0.00010000 },
+  { "퍙", 0.00000000 },
+  { "샖", 0.00000000 },
+  { "뜄", 0.00000000 },
+  { "컹", 0.00000000 },
+  { "핣", 0.00000000 },
+  { "뺏", 0.00000000 },
+  { "뉕", 0.00000000 },
+  { "줷", 0.00000000 },
+  { "섯", 0.00010000 },
+  { "쪹", 0.00000000 },
+  { "엎", 0.00000000 },
+  { "쑙", 0.00000000 },
+  { "첷", 0.00000000 },
+  { "싕", 0.00000000 },
+  { "쐙", 0.00000000 },
+  { "절", 0.00060000 },
+  { "턡", 0.00000000 },
+  { "셂", 0.00000000 },
+  { "쒑", 0.00000000 },
+  { "뇸", 0.00000000 },
+  { "퓡", 0.00000000 },
+  { "뀌", 0.00010000 },
+  { "쁫", 0.00000000 },
+  { "얘", 0.00000000 },
+  { "썝", 0.00000000 },
+  { "뉭", 0.00000000 },
+  { "딬", 0.00000000 },
+  { "랕", 0.00000000 },
+  { "뉺", 0.00000000 },
+  { "깺", 0.00000000 },
+  { "멈", 0.00000000 },
+  { "팥", 0.00000000 },
+  { "쯹", 0.00000000 },
+  { "뛺", 0.00000000 },
+  { "갱", 0.00000000 },
+  { "쁹", 0.00000000 },
+  { "쨷", 0.00000000 },
+  { "쐎", 0.00000000 },
+  { "낎", 0.00000000 },
+  { "옭", 0.00000000 },
+  { "킿", 0.00000000 },
+  { "묭", 0.00000000 },
+  { "틞", 0.00000000 },
+  { "훏", 0.00000000 },
+  { "듌", 0.00000000 },
+  { "륭", 0.00000000 },
+  { "쿌", 0.00000000 },
+  { "쥂", 0.00000000 },
+  { "궨", 0.00000000 },
+  { "문", 0.00310000 },
+  { "쵾", 0.00000000 },
+  { "뛃", 0.00000000 },
+  { "붞", 0.00000000 },
+  { "빋", 0.00000000 },
+  { "푴", 0.00000000 },
+  { "텡", 0.00000000 },
+  { "늈", 0.00000000 },
+  { "껫", 0.00000000 },
+  { "좩", 0.00000000 },
+  { "뮈", 0.00000000 },
+  { "튱", 0.00000000 },
+  { "띋", 0.00000000 },
+  { "췶", 0.00000000 },
+  { "쬿", 0.00000000 },
+  { "냤", 0.00000000 },
+  { "똩", 0.00000000 },
+  { "땜", 0.00000000 },
+  { "혶", 0.00000000 },
+  { "깔", 0.00000000 },
+  { "긡", 0.00000000 },
+  { "듓", 0.00000000 },
+  { "싦", 0.00000000 },
+  { "쩀", 0.00000000 },
+  { "쯗", 0.00000000 },
+  { "퇔", 0.00000000 },
+  { "즦", 0.00000000 },
+  { "둭", 0.00000000 },
+  { "퐛", 0.00000000 },
+  { "귰", 0.00000000 },
+  { "햄", 0.00000000 },
+  { "셈", 0.00000000 },
+  { "젖", 0.00000000 },
+  { "텀", 0.00000000 },
+  { "꿌", 0.00000000 },
+  { "쏝", 0.00000000 },
+  { "쳷", 0.00000000 },
+  { "꿝", 0.00000000 },
+  { "쇅", 0.00000000 },
+  { "좳", 0.00000000 },
+  { "낈", 0.00000000 },
+  { "읭", 0.00000000 },
+  { "땿", 0.00000000 },
+  { "읬", 0.00000000 },
+  { "빼", 0.00000000 },
+  { "댨", 0.00000000 },
+  { "좐", 0.00000000 },
+  { "몱", 0.00000000 },
+  { "쟛", 0.00000000 },
+  { "뎷", 0.00000000 },
+  { "궪", 0.00000000 },
+  { "놨", 0.00000000 },
+  { "흁", 0.00000000 },
+  { "뇄", 0.00000000 },
+  { "뮥", 0.00000000 },
+  { "맋", 0.00000000 },
+  { "컛", 0.00000000 },
+  { "댥", 0.00000000 },
+  { "엇", 0.00000000 },
+  { "쥭", 0.00000000 },
+  { "윁", 0.00000000 },
+  { "걹", 0.00000000 },
+  { "쾰", 0.00000000 },
+  { "뎌", 0.00000000 },
+  { "돬", 0.00000000 },
+  { "륾", 0.00000000 },
+  { "퍹", 0.00000000 },
+  { "냁", 0.00000000 },
+  { "뮤", 0.00010000 },
+  { "퀒", 0.00000000 },
+  { "겕", 0.00000000 },
+  { "냨", 0.00000000 },
+  { "쳩", 0.00000000 },
+  { "넍", 0.00000000 },
+  { "돾", 0.00000000 },
+  { "운", 0.00180000 },
+  { "껏", 0.00000000 },
+  { "쪷", 0.00000000 },
+  { "왇", 0.00000000 },
+  { "춣", 0.00000000 },
+  { "귝", 0.00000000 },
+  { "덯", 0.00000000 },
+  { "삟", 0.00000000 },
+  { "클", 0.00050000 },
+  { "뷽", 0.00000000 },
+  { "셴", 0.00000000 },
+  { "덶", 0.00000000 },
+  { "묶", 0.00000000 },
+  { "큈", 0.00000000 },
+  { "쭌", 0.00000000 },
+  { "엀", 0.00000000 },
+  { "큰", 0.00030000 },
+  { "톼", 0.00000000 },
+  { "꼶", 0.00000000 },
+  { "넙", 0.00000000 },
+  { "랇", 0.00000000 },
+  { "꼊", 0.00000000 },
+  { "뿤", 0.00000000 },
+  { "콿", 0.00000000 },
+  { "룂", 0.00000000 },
+  { "얏", 0.00000000 },
+  { "뭙", 0.00000000 },
+  { "툾", 0.00000000 },
+  { "더", 0.00090000 },
+  { "빔", 0.00000000 },
+  { "딽", 0.00000000 },
+  { "짟", 0.00000000 },
+  { "쀴", 0.00000000 },
+  { "럐", 0.00000000 },
+  { "띶", 0.00000000 },
+  { "킩", 0.00000000 },
+  { "멝", 0.00000000 },
+  { "깱", 0.00000000 },
+  { "줘", 0.00000000 },
+  { "싊", 0.00000000 },
+  { "푟", 0.00000000 },
+  { "닇", 0.00000000 },
+  { "퇼", 0.00000000 },
+  { "섍", 0.00000000 },
+  { "칶", 0.00000000 },
+  { "췼", 0.00000000 },
+  { "잸", 0.00000000 },
+  { "와", 0.00400000 },
+  { "괟", 0.00000000 },
+  { "젣", 0.00000000 },
+  { "펿", 0.00000000 },
+  { "탏", 0.00000000 },
+  { "귨", 0.00000000 },
+  { "썴", 0.00000000 },
+  { "뻰", 0.00000000 },
+  { "뀹", 0.00000000 },
+  { "짖", 0.00000000 },
+  { "싗", 0.00000000 },
+  { "섖", 0.00000000 },
+  { "컥", 0.00000000 },
+  { "깵", 0.00000000 },
+  { "숏", 0.00000000 },
+  { "훫", 0.00000000 },
+  { "옱", 0.00000000 },
+  { "농", 0.00030000 },
+  { "쵭", 0.00000000 },
+  { "영", 0.00250000 },
+  { "볔", 0.00000000 },
+  { "괨", 0.00000000 },
+  { "칰", 0.00000000 },
+  { "캿", 0.00000000 },
+  { "콥", 0.00000000 },
+  { "뢍", 0.00000000 },
+  { "쉄", 0.00000000 },
+  { "봣", 0.00000000 },
+  { "긂", 0.00000000 },
+  { "몜", 0.00000000 },
+  { "웕", 0.00000000 },
+  { "쳨", 0.00000000 },
+  { "츩", 0.00000000 },
+  { "뒾", 0.00000000 },
+  { "잗", 0.00000000 },
+  { "춙", 0.00000000 },
+  { "츘", 0.00000000 },
+  { "된", 0.00260000 },
+  { "텇", 0.00000000 },
+  { "퍫", 0.00000000 },
+  { "튈", 0.00000000 },
+  { "셝", 0.00000000 },
+  { "럞", 0.00000000 },
+  { "쐟", 0.00000000 },
+  { "룘", 0.00000000 },
+  { "뾖", 0.00000000 },
+  { "쯡", 0.00000000 },
+  { "캺", 0.00000000 },
+  { "앲", 0.00000000 },
+  { "뉙", 0.00000000 },
+  { "쩯", 0.00000000 },
+  { "꼻", 0.00000000 },
+  { "쿞", 0.00000000 },
+  { "펋", 0.00000000 },
+  { "쩛", 0.00000000 },
+  { "뿏", 0.00000000 },
+  { "퐔", 0.00000000 },
+  { "뺉", 0.00000000 },
+  { "뜬", 0.00000000 },
+  { "챬", 0.00000000 },
+  { "묽", 0.00000000 },
+  { "뮹", 0.00000000 },
+  { "긾", 0.00000000 },
+  { "킍", 0.00000000 },
+  { "귐", 0.00000000 },
+  { "줒", 0.00000000 },
+  { "뽝", 0.00000000 },
+  { "칠", 0.00010000 },
+  { "멎", 0.00000000 },
+  { "뾲", 0.00000000 },
+  { "쯣", 0.00000000 },
+  { "쎱", 0.00000000 },
+  { "쯌", 0.00000000 },
+  { "퍰", 0.00000000 },
+  { "춘", 0.00010000 },
+  { "쥷", 0.00000000 },
+  { "둱", 0.00000000 },
+  { "읐", 0.00000000 },
+  { "캃", 0.00000000 },
+  { "춄", 0.00000000 },
+  { "뾶", 0.00000000 },
+  { "걟", 0.00000000 },
+  { "믌", 0.00000000 },
+  { "채", 0.00040000 },
+  { "윕", 0.00000000 },
+  { "김", 0.00070000 },
+  { "꿛", 0.00000000 },
+  { "즞", 0.00000000 },
+  { "걝", 0.00000000 },
+  { "쓃", 0.00000000 },
+  { "쾋", 0.00000000 },
+  { "칔", 0.00000000 },
+  { "푔", 0.00000000 },
+  { "엢", 0.00000000 },
+  { "뚾", 0.00000000 },
+  { "꺡", 0.00000000 },
+  { "헁", 0.00000000 },
+  { "휻", 0.00000000 },
+  { "잤", 0.00000000 },
+  { "쇕", 0.00000000 },
+  { "빶", 0.00000000 },
+  { "눹", 0.00000000 },
+  { "떐", 0.00000000 },
+  { "쏑", 0.00000000 },
+  { "덷", 0.00000000 },
+  { "늉", 0.00000000 },
+  { "멜", 0.00010000 },
+  { "뼣", 0.00000000 },
+  { "꽺", 0.00000000 },
+  { "딘", 0.00000000 },
+  { "푨", 0.00000000 },
+  { "횤", 0.00000000 },
+  { "퍺", 0.00000000 },
+  { "슐", 0.00000000 },
+  { "땬", 0.00000000 },
+  { "튚", 0.00000000 },
+  { "곣", 0.00000000 },
+  { "두", 0.00140000 },
+  { "퉔", 0.00000000 },
+  { "했", 0.00390000 },
+  { "퉅", 0.00000000 },
+  { "굾", 0.00000000 },
+  { "컠", 0.00000000 },
+  { "쮢", 0.00000000 },
+  { "렅", 0.00000000 },
+  { "벶", 0.00000000 },
+  { "묘", 0.00020000 },
+  { "뱴", 0.00000000 },
+  { "뷬", 0.00000000 },
+  { "뿄", 0.00000000 },
+  { "릥", 0.00000000 },
+  { "햶", 0.00000000 },
+  { "휲", 0.00000000 },
+  { "꺫", 0.00000000 },
+  { "놽", 0.00000000 },
+  { "쐬", 0.00000000 },
+  { "쟒", 0.00000000 },
+  { "눊", 0.00000000 },
+  { "넅", 0.00000000 },
+  { "힍", 0.00000000 },
+  { "걧", 0.00000000 },
+  { "콌", 0.00000000 },
+  { "펝", 0.00000000 },
+  { "썇", 0.00000000 },
+  { "몟", 0.00000000 },
+  { "늦", 0.00000000 },
+  { "쫬", 0.00000000 },
+  { "쉓", 0.00000000 },
+  { "뛄", 0.00000000 },
+  { "첇", 0.00000000 },
+  { "춳", 0.00000000 },
+  { "펛", 0.00000000 },
+  { "뾦", 0.00000000 },
+  { "쑺", 0.00000000 },
+  { "앸", 0.00000000 },
+  { "힀", 0.00000000 },
+  { "덓", 0.00000000 },
+  { "븟", 0.00000000 },
+  { "쥞", 0.00000000 },
+  { "헤", 0.00020000 },
+  { "뤀", 0.00000000 },
+  { "컿", 0.00000000 },
+  { "쵠", 0.00000000 },
+  { "뽭", 0.00000000 },
+  { "뼧", 0.00000000 },
+  { "꽥", 0.00000000 },
+  { "쀧", 0.00000000 },
+  { "쫩", 0.00000000 },
+  { "힟", 0.00000000 },
+  { "뒕", 0.00000000 },
+  { "길", 0.00040000 },
+  { "화", 0.00330000 },
+  { "펁", 0.00000000 },
+  { "묆", 0.00000000 },
+  { "낳", 0.00010000 },
+  { "럶", 0.00000000 },
+  { "툻", 0.00000000 },
+  { "걇", 0.00000000 },
+  { "룠", 0.00000000 },
+  { "렦", 0.00000000 },
+  { "볯", 0.00000000 },
+  { "퀫", 0.00000000 },
+  { "긥", 0.00000000 },
+  { "텟", 0.00000000 },
+  { "온", 0.00060000 },
+  { "턇", 0.00000000 },
+  { "뀲", 0.00000000 },
+  { "쐝", 0.00000000 },
+  { "굍", 0.00000000 },
+  { "쭖", 0.00000000 },
+  { "콦", 0.00000000 },
+  { "큔", 0.00000000 },
+  { "턑", 0.00000000 },
+  { "꺯", 0.00000000 },
+  { "츿", 0.00000000 },
+  { "푬", 0.00000000 },
+  { "엚", 0.00000000 },
+  { "퓰", 0.00000000 },
+  { "베", 0.00090000 },
+  { "왎", 0.00000000 },
+  { "쉦", 0.00000000 },
+  { "꾖", 0.00000000 },
+  { "읦", 0.00000000 },
+  { "턣", 0.00000000 },
+  { "쾕", 0.00000000 },
+  { "곩", 0.00000000 },
+  { "뙕", 0.00000000 },
+  { "룊", 0.00000000 },
+  { "캘", 0.00000000 },
+  { "들", 0.00470000 },
+  { "홻", 0.00000000 },
+  { "럢", 0.00000000 },
+  { "먵", 0.00000000 },
+  { "늣", 0.00000000 },
+  { "빭", 0.00000000 },
+  { "뇪", 0.00000000 },
+  { "쉮", 0.00000000 },
+  { "앵", 0.00000000 },
+  { "쵅", 0.00000000 },
+  { "뺹", 0.00000000 },
+  { "쿑", 0.00000000 },
+  { "푅", 0.00000000 },
+  { "퐉", 0.00000000 },
+  { "쵦", 0.00000000 },
+  { "엔", 0.00030000 },
+  { "챫", 0.00000000 },
+  { "퓜", 0.00000000 },
+  { "볣", 0.00000000 },
+  { "깒", 0.00000000 },
+  { "뵐", 0.00000000 },
+  { "냈", 0.00020000 },
+  { "듅", 0.00000000 },
+  { "묊", 0.00000000 },
+  { "퐸", 0.00000000 },
+  { "놆", 0.00000000 },
+  { "졋", 0.00000000 },
+  { "떉", 0.00000000 },
+  { "쮥", 0.00000000 },
+  { "탘", 0.00000000 },
+  { "격", 0.00110000 },
+  { "늷", 0.00000000 },
+  { "폾", 0.00000000 },
+  { "졐", 0.00000000 },
+  { "대", 0.00960000 },
+  { "윃", 0.00000000 },
+  { "첡", 0.00000000 },
+  { "윐", 0.00000000 },
+  { "뼦", 0.00000000 },
+  { "텼", 0.00000000 },
+  { "쥆", 0.00000000 },
+  { "흷", 0.00000000 },
+  { "웖", 0.00000000 },
+  { "츱", 0.00000000 },
+  { "쵟", 0.00000000 },
+  { "놡", 0.00000000 },
+  { "줎", 0.00000000 },
+  { "쎬", 0.00000000 },
+  { "쇫", 0.00000000 },
+  { "턃", 0.00000000 },
+  { "뵂", 0.00000000 },
+  { "능", 0.00070000 },
+  { "핮", 0.00000000 },
+  { "왠", 0.00000000 },
+  { "댼", 0.00000000 },
+  { "튺", 0.00000000 },
+  { "릣", 0.00000000 },
+  { "쉭", 0.00000000 },
+  { "뺰", 0.00000000 },
+  { "께", 0.00050000 },
+  { "쓻", 0.00000000 },
+  { "퇙", 0.00000000 },
+  { "쌬", 0.00000000 },
+  { "턏", 0.00000000 },
+  { "뤘", 0.00000000 },
+  { "얺", 0.00000000 },
+  { "풶", 0.00000000 },
+  { "듣", 0.00000000 },
+  { "꿞", 0.00000000 },
+  { "쾗", 0.00000000 },
+  { "즸", 0.00000000 },
+  { "꽝", 0.00000000 },
+  { "덇", 0.00000000 },
+  { "렣", 0.00000000 },
+  { "슍", 0.00000000 },
+  { "봶", 0.00000000 },
+  { "참", 0.00070000 },
+  { "깮", 0.00000000 },
+  { "셇", 0.00000000 },
+  { "쵥", 0.00000000 },
+  { "똄", 0.00000000 },
+  { "쭦", 0.00000000 },
+  { "놣", 0.00000000 },
+  { "피", 0.00100000 },
+  { "뎹", 0.00000000 },
+  { "몈", 0.00000000 },
+  { "퉤", 0.00000000 },
+  { "뤡", 0.00000000 },
+  { "뫯", 0.00000000 },
+  { "팽", 0.00000000 },
+  { "혆", 0.00000000 },
+  { "훍", 0.00000000 },
+  { "퐞", 0.00000000 },
+  { "앹", 0.00000000 },
+  { "윑", 0.00000000 },
+  { "꼁", 0.00000000 },
+  { "뾱", 0.00000000 },
+  { "퉲", 0.00000000 },
+  { "잔", 0.00010000 },
+  { "적", 0.00420000 },
+  { "죦", 0.00000000 },
+  { "쭟", 0.00000000 },
+  { "풽", 0.00000000 },
+  { "읺", 0.00000000 },
+  { "젳", 0.00000000 },
+  { "쿺", 0.00000000 },
+  { "똤", 0.00000000 },
+  { "쪨", 0.00000000 },
+  { "츐", 0.00000000 },
+  { "딷", 0.00000000 },
+  { "욺", 0.00000000 },
+  { "펴", 0.00000000 },
+  { "콾", 0.00000000 },
+  { "줨", 0.00000000 },
+  { "순", 0.00050000 },
+  { "썈", 0.00000000 },
+  { "쩠", 0.00000000 },
+  { "밎", 0.00000000 },
+  { "뜩", 0.00000000 },
+  { "쉃", 0.00000000 },
+  { "홦", 0.00000000 },
+  { "썿", 0.00000000 },
+  { "쮋", 0.00000000 },
+  { "뾅", 0.00000000 },
+  { "썎", 0.00000000 },
+  { "롧", 0.00000000 },
+  { "꽕", 0.00000000 },
+  { "퉗", 0.00000000 },
+  { "괞", 0.00000000 },
+  { "쇲", 0.00000000 },
+  { "륀", 0.00000000 },
+  { "낏", 0.00000000 },
+  { "폲", 0.00000000 },
+  { "욱", 0.00010000 },
+  { "묂", 0.00000000 },
+  { "귍", 0.00000000 },
+  { "끁", 0.00000000 },
+  { "붥", 0.00000000 },
+  { "쨓", 0.00000000 },
+  { "븏", 0.00000000 },
+  { "굵", 0.00000000 },
+  { "맳", 0.00000000 },
+  { "몆", 0.00000000 },
+  { "쯟", 0.00000000 },
+  { "뉾", 0.00000000 },
+  { "퀤", 0.00000000 },
+  { "똋", 0.00000000 },
+  { "픁", 0.00000000 },
+  { "쨫", 0.00000000 },
+  { "싅", 0.00000000 },
+  { "꽑", 0.00000000 },
+  { "륆", 0.00000000 },
+  { "솻", 0.00000000 },
+  { "팆", 0.00000000 },
+  { "슡", 0.00000000 },
+  { "딥", 0.00000000 },
+  { "싑", 0.00000000 },
+  { "읖", 0.00000000 },
+  { "잙", 0.00000000 },
+  { "혂", 0.00000000 },
+  { "퓗", 0.00000000 },
+  { "푝", 0.00000000 },
+  { "흼", 0.00000000 },
+  { "빑", 0.00000000 },
+  { "씂", 0.00000000 },
+  { "뿰", 0.00000000 },
+  { "쳵", 0.00000000 },
+  { "롾", 0.00000000 },
+  { "꺘", 0.00000000 },
+  { "곡", 0.00060000 },
+  { "벙", 0.00000000 },
+  { "뛘", 0.00000000 },
+  { "닮", 0.00000000 },
+  { "숹", 0.00000000 },
+  { "짅", 0.00000000 },
+  { "헵", 0.00000000 },
+  { "쥈", 0.00000000 },
+  { "뇾", 0.00000000 },
+  { "톎", 0.00000000 },
+  { "닽", 0.00000000 },
+  { "릂", 0.00000000 },
+  { "뾺", 0.00000000 },
+  { "덄", 0.00000000 },
+  { "떱", 0.00000000 },
+  { "덲", 0.00000000 },
+  { "첿", 0.00000000 },
+  { "쬔", 0.00000000 },
+  { "롁", 0.00000000 },
+  { "콎", 0.00000000 },
+  { "캢", 0.00000000 },
+  { "끩", 0.00000000 },
+  { "쪩", 0.00000000 },
+  { "툢", 0.00000000 },
+  { "둇", 0.00000000 },
+  { "츉", 0.00000000 },
+  { "꺿", 0.00000000 },
+  { "닒", 0.00000000 },
+  { "은", 0.01150000 },
+  { "뀾", 0.00000000 },
+  { "뜇", 0.00000000 },
+  { "츈", 0.00000000 },
+  { "캋", 0.00000000 },
+  { "뒗", 0.00000000 },
+  { "쮱", 0.00000000 },
+  { "믜", 0.00000000 },
+  { "돭", 0.00000000 },
+  { "턪", 0.00000000 },
+  { "틎", 0.00000000 },
+  { "휨", 0.00000000 },
+  { "굟", 0.00000000 },
+  { "꿴", 0.00000000 },
+  { "룪", 0.00000000 },
+  { "홿", 0.00000000 },
+  { "쿸", 0.00000000 },
+  { "늟", 0.00000000 },
+  { "쫞", 0.00000000 },
+  { "컷", 0.00000000 },
+  { "갩", 0.00000000 },
+  { "즩", 0.00000000 },
+  { "챂", 0.00000000 },
+  { "틯", 0.00000000 },
+  { "챣", 0.00000000 },
+  { "충", 0.00040000 },
+  { "쥵", 0.00000000 },
+  { "탁", 0.00010000 },
+  { "쎨", 0.00000000 },
+  { "췌", 0.00000000 },
+  { "꽾", 0.00000000 },
+  { "쎕", 0.00000000 },
+  { "욵", 0.00000000 },
+  { "쬍", 0.00000000 },
+  { "표", 0.00140000 },
+  { "좴", 0.00000000 },
+  { "햬", 0.00000000 },
+  { "볫", 0.00000000 },
+  { "혋", 0.00000000 },
+  { "칯", 0.00000000 },
+  { "뵼", 0.00000000 },
+  { "햓", 0.00000000 },
+  { "첕", 0.00000000 },
+  { "푌", 0.00000000 },
+  { "니", 0.00200000 },
+  { "튑", 0.00000000 },
+  { "켉", 0.00000000 },
+  { "끲", 0.00000000 },
+  { "뜏", 0.00000000 },
+  { "랳", 0.00000000 },
+  { "뎾", 0.00000000 },
+  { "믤", 0.00000000 },
+  { "꼱", 0.00000000 },
+  { "뭔", 0.00000000 },
+  { "샕", 0.00000000 },
+  { "칸", 0.00020000 },
+  { "랖", 0.00000000 },
+  { "낫", 0.00000000 },
+  { "믏", 0.00000000 },
+  { "룍", 0.00000000 },
+  { "뿉", 0.00000000 },
+  { "퓀", 0.00000000 },
+  { "혀", 0.00020000 },
+  { "솺", 0.00000000 },
+  { "눻", 0.00000000 },
+  { "뿍", 0.00000000 },
+  { "칞", 0.00000000 },
+  { "뼚", 0.00000000 },
+  { "륤", 0.00000000 },
+  { "춬", 0.00000000 },
+  { "뻬", 0.00000000 },
+  { "냍", 0.00000000 },
+  { "볽", 0.00000000 },
+  { "쑓", 0.00000000 },
+  { "맬", 0.00000000 },
+  { "졯", 0.00000000 },
+  { "쩶", 0.00000000 },
+  { "쯈", 0.00000000 },
+  { "벼", 0.00000000 },
+  { "뎿", 0.00000000 },
+  { "긱", 0.00000000 },
+  { "츝", 0.00000000 },
+  { "뢣", 0.00000000 },
+  { "랺", 0.00000000 },
+  { "른", 0.00090000 },
+  { "굼", 0.00000000 },
+  { "뷆", 0.00000000 },
+  { "쑚", 0.00000000 },
+  { "꿗", 0.00000000 },
+  { "꽈", 0.00000000 },
+  { "앁", 0.00000000 },
+  { "콘", 0.00020000 },
+  { "뎴", 0.00000000 },
+  { "롔", 0.00000000 },
+  { "쩌", 0.00000000 },
+  { "앿", 0.00000000 },
+  { "뚝", 0.00000000 },
+  { "콊", 0.00000000 },
+  { "끧", 0.00000000 },
+  { "겪", 0.00010000 },
+  { "곰", 0.00000000 },
+  { "쓂", 0.00000000 },
+  { "촔", 0.00000000 },
+  { "햘", 0.00000000 },
+  { "녑", 0.00000000 },
+  { "쬗", 0.00000000 },
+  { "먜", 0.00000000 },
+  { "뗺", 0.00000000 },
+  { "츎", 0.00000000 },
+  { "독", 0.00130000 },
+  { "봎", 0.00000000 },
+  { "큭", 0.00000000 },
+  { "턬", 0.00000000 },
+  { "썖", 0.00000000 },
+  { "럏", 0.00000000 },
+  { "찶", 0.00000000 },
+  { "흔", 0.00010000 },
+  { "팢", 0.00000000 },
+  { "뤈", 0.00000000 },
+  { "쯧", 0.00000000 },
+  { "븵", 0.00000000 },
+  { "쏁", 0.00000000 },
+  { "뵍", 0.00000000 },
+  { "쌊", 0.00000000 },
+  { "뮿", 0.00000000 },
+  { "캡", 0.00000000 },
+  { "꼀", 0.00000000 },
+  { "첐", 0.00000000 },
+  { "묜", 0.00000000 },
+  { "뻒", 0.00000000 },
+  { "돒", 0.00000000 },
+  { "둒", 0.00000000 },
+  { "괷", 0.00000000 },
+  { "평", 0.00090000 },
+  { "쇾", 0.00000000 },
+  { "픈", 0.00000000 },
+  { "컚", 0.00000000 },
+  { "뭕", 0.00000000 },
+  { "먅", 0.00000000 },
+  { "뀡", 0.00000000 },
+  { "봂", 0.00000000 },
+  { "뉯", 0.00000000 },
+  { "쉠", 0.00000000 },
+  { "뀂", 0.00000000 },
+  { "뇽", 0.00000000 },
+  { "샙", 0.00000000 },
+  { "량", 0.00060000 },
+  { "쬬", 0.00000000 },
+  { "싁", 0.00000000 },
+  { "듴", 0.00000000 },
+  { "먧", 0.00000000 },
+  { "크", 0.00180000 },
+  { "뛛", 0.00000000 },
+  { "뒼", 0.00000000 },
+  { "뛭", 0.00000000 },
+  { "룜", 0.00000000 },
+  { "쟞", 0.00000000 },
+  { "츹", 0.00000000 },
+  { "폿", 0.00000000 },
+  { "썾", 0.00000000 },
+  { "뙣", 0.00000000 },
+  { "킌", 0.00000000 },
+  { "퍦", 0.00000000 },
+  { "쯄", 0.00000000 },
+  { "꽼", 0.00000000 },
+  { "찼", 0.00000000 },
+  { "헸", 0.00000000 },
+  { "셅", 0.00000000 },
+  { "쌉", 0.00000000 },
+  { "깍", 0.00000000 },
+  { "딭", 0.00000000 },
+  { "댳", 0.00000000 },
+  { "쥓", 0.00000000 },
+  { "흿", 0.00000000 },
+  { "뚴", 0.00000000 },
+  { "속", 0.00160000 },
+  { "쭎", 0.00000000 },
+  { "띖", 0.00000000 },
+  { "긆", 0.00000000 },
+  { "쀘", 0.00000000 },
+  { "뒂", 0.00000000 },
+  { "귈", 0.00000000 },
+  { "냑", 0.00000000 },
+  { "늎", 0.00000000 },
+  { "붵", 0.00000000 },
+  { "펚", 0.00000000 },
+  { "릳", 0.00000000 },
+  { "둪", 0.00000000 },
+  { "뷸", 0.00000000 },
+  { "찬", 0.00020000 },
+  { "닙", 0.00000000 },
+  { "쪇", 0.00000000 },
+  { "찳", 0.00000000 },
+  { "띊", 0.00000000 },
+  { "쭕", 0.00000000 },
+  { "뛴", 0.00000000 },
+  { "웼", 0.00000000 },
+  { "챎", 0.00000000 },
+  { "퉦", 0.00000000 },
+  { "쓄", 0.00000000 },
+  { "똷", 0.00000000 },
+  { "잜", 0.00000000 },
+  { "짡", 0.00000000 },
+  { "뺤", 0.00000000 },
+  { "뤼", 0.00000000 },
+  { "뛫", 0.00000000 },
+  { "옃", 0.00000000 },
+  { "턖", 0.00000000 },
+  { "뚰", 0.00000000 },
+  { "튗", 0.00000000 },
+  { "녩", 0.00000000 },
+  { "꺣", 0.00000000 },
+  { "넘", 0.00020000 },
+  { "산", 0.00230000 },
+  { "꿅", 0.00000000 },
+  { "둋", 0.00000000 },
+  { "늁", 0.00000000 },
+  { "큍", 0.00000000 },
+  { "쉸", 0.00000000 },
+  { "맀", 0.00000000 },
+  { "하", 0.01780000 },
+  { "옷", 0.00000000 },
+  { "깧", 0.00000000 },
+  { "뇃", 0.00000000 },
+  { "챍", 0.00000000 },
+  { "딙", 0.00000000 },
+  { "붽", 0.00000000 },
+  { "즓", 0.00000000 },
+  { "훬", 0.00000000 },
+  { "뎩", 0.00000000 },
+  { "늋", 0.00000000 },
+  { "챇", 0.00000000 },
+  { "멽", 0.00000000 },
+  { "퐼", 0.00000000 },
+  { "왥", 0.00000000 },
+  { "탫", 0.00000000 },
+  { "뇵", 0.00000000 },
+  { "빎", 0.00000000 },
+  { "됞", 0.00000000 },
+  { "걂", 0.00000000 },
+  { "싔", 0.00000000 },
+  { "힗", 0.00000000 },
+  { "없", 0.00090000 },
+  { "솑", 0.00000000 },
+  { "룛", 0.00000000 },
+  { "쓌", 0.00000000 },
+  { "굪", 0.00000000 },
+  { "쓹", 0.00000000 },
+  { "햩", 0.00000000 },
+  { "테", 0.00070000 },
+  { "뮜", 0.00000000 },
+  { "뺃", 0.00000000 },
+  { "남", 0.00170000 },
+  { "뛤", 0.00000000 },
+  { "쒷", 0.00000000 },
+  { "븓", 0.00000000 },
+  { "횦", 0.00000000 },
+  { "잮", 0.00000000 },
+  { "퐡", 0.00000000 },
+  { "솷", 0.00000000 },
+  { "퍧", 0.00000000 },
+  { "텄", 0.00000000 },
+  { "씝", 0.00000000 },
+  { "쏤", 0.00000000 },
+  { "꿇", 0.00000000 },
+  { "랜", 0.00040000 },
+  { "녨", 0.00000000 },
+  { "퓛", 0.00000000 },
+  { "쬇", 0.00000000 },
+  { "푮", 0.00000000 },
+  { "퇃", 0.00000000 },
+  { "녪", 0.00000000 },
+  { "뙴", 0.00000000 },
+  { "뚮", 0.00000000 },
+  { "땵", 0.00000000 },
+  { "뻧", 0.00000000 },
+  { "갘", 0.00000000 },
+  { "훌", 0.00000000 },
+  { "삊", 0.00000000 },
+  { "숁", 0.00000000 },
+  { "밣", 0.00000000 },
+  { "틄", 0.00000000 },
+  { "퐹", 0.00000000 },
+  { "핲", 0.00000000 },
+  { "밊", 0.00000000 },
+  { "듰", 0.00000000 },
+  { "쓆", 0.00000000 },
+  { "뚯", 0.00000000 },
+  { "뗛", 0.00000000 },
+  { "쪮", 0.00000000 },
+  { "빢", 0.00000000 },
+  { "캶", 0.00000000 },
+  { "뼕", 0.00000000 },
+  { "쯦", 0.00000000 },
+  { "뎟", 0.00000000 },
+  { "핚", 0.00000000 },
+  { "랎", 0.00000000 },
+  { "먻", 0.00000000 },
+  { "석", 0.00070000 },
+  { "쬖", 0.00000000 },
+  { "뾘", 0.00000000 },
+  { "뙐", 0.00000000 },
+  { "붺", 0.00000000 },
+  { "쭲", 0.00000000 },
+  { "돷", 0.00000000 },
+  { "붊", 0.00000000 },
+  { "귦", 0.00000000 },
+  { "롙", 0.00000000 },
+  { "뼎", 0.00000000 },
+  { "붻", 0.00000000 },
+  { "쨪", 0.00000000 },
+  { "젌", 0.00000000 },
+  { "묍", 0.00000000 },
+  { "쬾", 0.00000000 },
+  { "탃", 0.00000000 },
+  { "묕", 0.00000000 },
+  { "태", 0.00130000 },
+  { "릖", 0.00000000 },
+  { "홴", 0.00000000 },
+  { "푶", 0.00000000 },
+  { "뉉", 0.00000000 },
+  { "뚂", 0.00000000 },
+  { "뙶", 0.00000000 },
+  { "뒡", 0.00000000 },
+  { "퉡", 0.00000000 },
+  { "쫨", 0.00000000 },
+  { "펇", 0.00000000 },
+  { "녻", 0.00000000 },
+  { "쌥", 0.00000000 },
+  { "췑", 0.00000000 },
+  { "퇫", 0.00000000 },
+  { "쪠", 0.00000000 },
+  { "콭", 0.00000000 },
+  { "펣", 0.00000000 },
+  { "앎", 0.00000000 },
+  { "뗩", 0.00000000 },
+  { "뽜", 0.00000000 },
+  { "뽄", 0.00000000 },
+  { "맯", 0.00000000 },
+  { "냥", 0.00000000 },
+  { "걷", 0.00000000 },
+  { "둻", 0.00000000 },
+  { "쁅", 0.00000000 },
+  { "땆", 0.00000000 },
+  { "뢴", 0.00000000 },
+  { "쓓", 0.00000000 },
+  { "깛", 0.00000000 },
+  { "출", 0.00160000 },
+  { "숨", 0.00010000 },
+  { "법", 0.00130000 },
+  { "뤭", 0.00000000 },
+  { "횫", 0.00000000 },
+  { "뽗", 0.00000000 },
+  { "봡", 0.00000000 },
+  { "텤", 0.00000000 },
+  { "즇", 0.00000000 },
+  { "긯", 0.00000000 },
+  { "휞", 0.00000000 },
+  { "댸", 0.00000000 },
+  { "싐", 0.00000000 },
+  { "뭤", 0.00000000 },
+  { "흍", 0.00000000 },
+  { "쐥", 0.00000000 },
+  { "콪", 0.00000000 },
+  { "똿", 0.00000000 },
+  { "칉", 0.00000000 },
+  { "콀", 0.00000000 },
+  { "궂", 0.00000000 },
+  { "빸", 0.00000000 },
+  { "뤣", 0.00000000 },
+  { "뺳", 0.00000000 },
+  { "큤", 0.00000000 },
+  { "릁", 0.00000000 },
+  { "릒", 0.00000000 },
+  { "쥴", 0.00000000 },
+  { "귊", 0.00000000 },
+  { "쾷", 0.00000000 },
+  { "뵇", 0.00000000 },
+  { "낰", 0.00000000 },
+  { "힖", 0.00000000 },
+  { "뽠", 0.00000000 },
+  { "꺚", 0.00000000 },
+  { "렻", 0.00000000 },
+  { "퀙", 0.00000000 },
+  { "뙑", 0.00000000 },
+  { "먒", 0.00000000 },
+  { "쮞", 0.00000000 },
+  { "뫌", 0.00000000 },
+  { "쒭", 0.00000000 },
+  { "녤", 0.00000000 },
+  { "쮄", 0.00000000 },
+  { "땤", 0.00000000 },
+  { "뫬", 0.00000000 },
+  { "쥇", 0.00000000 },
+  { "똫", 0.00000000 },
+  { "퀚", 0.00000000 },
+  { "넇", 0.00000000 },
+  { "쩼", 0.00000000 },
+  { "텱", 0.00000000 },
+  { "돊", 0.00000000 },
+  { "늻", 0.00000000 },
+  { "썐", 0.00000000 },
+  { "톰", 0.00000000 },
+  { "쫒", 0.00000000 },
+  { "궬", 0.00000000 },
+  { "바", 0.00190000 },
+  { "춃", 0.00000000 },
+  { "껷", 0.00000000 },
+  { "쾡", 0.00000000 },
+  { "랽", 0.00000000 },
+  { "눮", 0.00000000 },
+  { "끮", 0.00000000 },
+  { "꽱", 0.00000000 },
+  { "뷖", 0.00000000 },
+  { "집", 0.00080000 },
+  { "몕", 0.00000000 },
+  { "햵", 0.00000000 },
+  { "딌", 0.00000000 },
+  { "릴", 0.00010000 },
+  { "쿉", 0.00000000 },
+  { "퍔", 0.00000000 },
+  { "쬎", 0.00000000 },
+  { "떥", 0.00000000 },
+  { "랯", 0.00000000 },
+  { "샞", 0.00000000 },
+  { "잲", 0.00000000 },
+  { "튖", 0.00000000 },
+  { "뿾", 0.00000000 },
+  { "컋", 0.00000000 },
+  { "쬜", 0.00000000 },
+  { "푯", 0.00000000 },
+  { "눳", 0.00000000 },
+  { "븥", 0.00000000 },
+  { "욂", 0.00000000 },
+  { "윬", 0.00000000 },
+  { "꼕", 0.00000000 },
+  { "뱽", 0.00000000 },
+  { "퍁", 0.00000000 },
+  { "쮜", 0.00000000 },
+  { "뽥", 0.00000000 },
+  { "퓑", 0.00000000 },
+  { "쁝", 0.00000000 },
+  { "뇦", 0.00000000 },
+  { "뮃", 0.00000000 },
+  { "핬", 0.00000000 },
+  { "쓿", 0.00000000 },
+  { "걳", 0.00000000 },
+  { "뎵", 0.00000000 },
+  { "짽", 0.00000000 },
+  { "췝", 0.00000000 },
+  { "띀", 0.00000000 },
+  { "뱑", 0.00000000 },
+  { "킠", 0.00000000 },
+  { "흆", 0.00000000 },
+  { "햍", 0.00000000 },
+  { "휘", 0.00020000 },
+  { "엩", 0.00000000 },
+  { "쀯", 0.00000000 },
+  { "줌", 0.00000000 },
+  { "덋", 0.00000000 },
+  { "켵", 0.00000000 },
+  { "옮", 0.00010000 },
+  { "뵗", 0.00000000 },
+  { "붤", 0.00000000 },
+  { "돟", 0.00000000 },
+  { "럁", 0.00000000 },
+  { "딅", 0.00000000 },
+  { "뗋", 0.00000000 },
+  { "똂", 0.00000000 },
+  { "뿐", 0.00020000 },
+  { "윱", 0.00000000 },
+  { "볆", 0.00000000 },
+  { "꺲", 0.00000000 },
+  { "윢", 0.00000000 },
+  { "좇", 0.00000000 },
+  { "쮹", 0.00000000 },
+  { "릕", 0.00000000 },
+  { "넋", 0.00000000 },
+  { "첗", 0.00000000 },
+  { "뉅", 0.00000000 },
+  { "놶", 0.00000000 },
+  { "뚩", 0.00000000 },
+  { "흰", 0.00000000 },
+  { "쫁", 0.00000000 },
+  { "햖", 0.00000000 },
+  { "뮐", 0.00000000 },
+  { "삖", 0.00000000 },
+  { "쎏", 0.00000000 },
+  { "겊", 0.00000000 },
+  { "놸", 0.00000000 },
+  { "춽", 0.00000000 },
+  { "뀀", 0.00000000 },
+  { "컡", 0.00000000 },
+  { "겦", 0.00000000 },
+  { "밅", 0.00000000 },
+  { "냋", 0.00000000 },
+  { "엙", 0.00000000 },
+  { "톥", 0.00000000 },
+  { "껝", 0.00000000 },
+  { "뭒", 0.00000000 },
+  { "봹", 0.00000000 },
+  { "툜", 0.00000000 },
+  { "둨", 0.00000000 },
+  { "겞", 0.00000000 },
+  { "핫", 0.00000000 },
+  { "짱", 0.00000000 },
+  { "뒻", 0.00000000 },
+  { "럛", 0.00000000 },
+  { "칒", 0.00000000 },
+  { "슆", 0.00000000 },
+  { "뀇", 0.00000000 },
+  { "쵝", 0.00000000 },
+  { "앆", 0.00000000 },
+  { "틌", 0.00000000 },
+  { "렘", 0.00000000 },
+  { "뮰", 0.00000000 },
+  { "숕", 0.00000000 },
+  { "첁", 0.00000000 },
+  { "륶", 0.00000000 },
+  { "얂", 0.00000000 },
+  { "웶", 0.00000000 },
+  { "뉒", 0.00000000 },
+  { "춾", 0.00000000 },
+  { "겈", 0.00000000 },
+  { "릿", 0.00000000 },
+  { "먚", 0.00000000 },
+  { "췁", 0.00000000 },
+  { "옉", 0.00000000 },
+  { "뺢", 0.00000000 },
+  { "짝", 0.00000000 },
+  { "쳹", 0.00000000 },
+  { "뺊", 0.00000000 },
+  { "쁾", 0.00000000 },
+  { "펎", 0.00000000 },
+  { "곬", 0.00000000 },
+  { "띥", 0.00000000 },
+  { "텺", 0.00000000 },
+  { "죉", 0.00000000 },
+  { "쁬", 0.00000000 },
+  { "궄", 0.00000000 },
+  { "믧", 0.00000000 },
+  { "씜", 0.00000000 },
+  { "펀", 0.00000000 },
+  { "씨", 0.00030000 },
+  { "퉘", 0.00000000 },
+  { "톴", 0.00000000 },
+  { "몣", 0.00000000 },
+  { "뷛", 0.00000000 },
+  { "뉀", 0.00000000 },
+  { "싢", 0.00000000 },
+  { "켷", 0.00000000 },
+  { "쑁", 0.00000000 },
+  { "줝", 0.00000000 },
+  { "죒", 0.00000000 },
+  { "좒", 0.00000000 },
+  { "분", 0.00190000 },
+  { "녹", 0.00010000 },
+  { "숂", 0.00000000 },
+  { "츒", 0.00000000 },
+  { "콷", 0.00000000 },
+  { "둁", 0.00000000 },
+  { "쓛", 0.00000000 },
+  { "섃", 0.00000000 },
+  { "챧", 0.00000000 },
+  { "뿼", 0.00000000 },
+  { "쟋", 0.00000000 },
+  { "욆", 0.00000000 },
+  { "럴", 0.00000000 },
+  { "빉", 0.00000000 },
+  { "쪃", 0.00000000 },
+  { "찆", 0.00000000 },
+  { "됼", 0.00000000 },
+  { "펦", 0.00000000 },
+  { "쎳", 0.00000000 },
+  { "햫", 0.00000000 },
+  { "쓊", 0.00000000 },
+  { "횣", 0.00000000 },
+  { "덺", 0.00000000 },
+  { "낮", 0.00010000 },
+  { "돠", 0.00000000 },
+  { "쨿", 0.00000000 },
+  { "톯", 0.00000000 },
+  { "틕", 0.00000000 },
+  { "막", 0.00040000 },
+  { "쿘", 0.00000000 },
+  { "흉", 0.00000000 },
+  { "꿳", 0.00000000 },
+  { "딣", 0.00000000 },
+  { "놀", 0.00010000 },
+  { "킽", 0.00000000 },
+  { "리", 0.00890000 },
+  { "걣", 0.00000000 },
+  { "잍", 0.00000000 },
+  { "릑", 0.00000000 },
+  { "뵧", 0.00000000 },
+  { "돻", 0.00000000 },
+  { "뢕", 0.00000000 },
+  { "믈", 0.00000000 },
+  { "줸", 0.00000000 },
+  { "쫡", 0.00000000 },
+  { "뎲", 0.00000000 },
+  { "쮺", 0.00000000 },
+  { "탯", 0.00000000 },
+  { "싈", 0.00000000 },
+  { "딳", 0.00000000 },
+  { "쎎", 0.00000000 },
+  { "툦", 0.00000000 },
+  { "뜍", 0.00000000 },
+  { "헣", 0.00000000 },
+  { "쇈", 0.00000000 },
+  { "쒉", 0.00000000 },
+  { "캫", 0.00000000 },
+  { "쳚", 0.00000000 },
+  { "궶", 0.00000000 },
+  { "뭭", 0.00000000 },
+  { "쟉", 0.00000000 },
+  { "팶", 0.00000000 },
+  { "허", 0.00030000 },
+  { "쳎", 0.00000000 },
+  { "헝", 0.00010000 },
+  { "뜹", 0.00000000 },
+  { "쿵", 0.00000000 },
+  { "췻", 0.00000000 },
+  { "쪄", 0.00000000 },
+  { "죏", 0.00000000 },
+  { "밄", 0.00000000 },
+  { "꽿", 0.00000000 },
+  { "쮵", 0.00000000 },
+  { "찃", 0.00000000 },
+  { "댄", 0.00000000 },
+  { "켌", 0.00000000 },
+  { "쭧", 0.00000000 },
+  { "닎", 0.00000000 },
+  { "슞", 0.00000000 },
+  { "릗", 0.00000000 },
+  { "잟", 0.00000000 },
+  { "뫍", 0.00000000 },
+  { "쪧", 0.00000000 },
+  { "퓩", 0.00000000 },
+  { "쏳", 0.00000000 },
+  { "튉", 0.00000000 },
+  { "쳘", 0.00000000 },
+  { "슺", 0.00000000 },
+  { "조", 0.00340000 },
+  { "쁿", 0.00000000 },
+  { "뙂", 0.00000000 },
+  { "렒", 0.00000000 },
+  { "큨", 0.00000000 },
+  { "늃", 0.00000000 },
+  { "꼧", 0.00000000 },
+  { "쏻", 0.00000000 },
+  { "첫", 0.00030000 },
+  { "뙨", 0.00000000 },
+  { "긴", 0.00020000 },
+  { "캴", 0.00000000 },
+  { "칌", 0.00000000 },
+  { "쿩", 0.00000000 },
+  { "쾳", 0.00000000 },
+  { "꾽", 0.00000000 },
+  { "뉁", 0.00000000 },
+  { "뙲", 0.00000000 },
+  { "욄", 0.00000000 },
+  { "댁", 0.00000000 },
+  { "럭", 0.00000000 },
+  { "죜", 0.00000000 },
+  { "뤄", 0.00000000 },
+  { "쯰", 0.00000000 },
+  { "곅", 0.00000000 },
+  { "흪", 0.00000000 },
+  { "죩", 0.00000000 },
+  { "빌", 0.00020000 },
+  { "윟", 0.00000000 },
+  { "퀏", 0.00000000 },
+  { "퉥", 0.00000000 },
+  { "짩", 0.00000000 },
+  { "꽂", 0.00000000 },
+  { "윖", 0.00000000 },
+  { "벳", 0.00000000 },
+  { "뜣", 0.00000000 },
+  { "푵", 0.00000000 },
+  { "쳢", 0.00000000 },
+  { "몁", 0.00000000 },
+  { "쾫", 0.00000000 },
+  { "좆", 0.00000000 },
+  { "줄", 0.00020000 },
+  { "퓋", 0.00000000 },
+  { "뗙", 0.00000000 },
+  { "펆", 0.00000000 },
+  { "컂", 0.00000000 },
+  { "쎭", 0.00000000 },
+  { "쀖", 0.00000000 },
+  { "못", 0.00040000 },
+  { "툫", 0.00000000 },
+  { "틏", 0.00000000 },
+  { "홓", 0.00000000 },
+  { "꾺", 0.00000000 },
+  { "폵", 0.00000000 },
+  { "꽐", 0.00000000 },
+  { "냌", 0.00000000 },
+  { "옵", 0.00000000 },
+  { "젝", 0.00010000 },
+  { "똭", 0.00000000 },
+  { "웑", 0.00000000 },
+  { "댫", 0.00000000 },
+  { "꿾", 0.00000000 },
+  { "눰", 0.00000000 },
+  { "왾", 0.00000000 },
+  { "걫", 0.00000000 },
+  { "쯙", 0.00000000 },
+  { "툑", 0.00000000 },
+  { "쯺", 0.00000000 },
+  { "깦", 0.00000000 },
+  { "낐", 0.00000000 },
+  { "챱", 0.00000000 },
+  { "홞", 0.00000000 },
+  { "컙", 0.00000000 },
+  { "궋", 0.00000000 },
+  { "별", 0.00070000 },
+  { "늢", 0.00000000 },
+  { "쫽", 0.00000000 },
+  { "턕", 0.00000000 },
+  { "십", 0.00020000 },
+  { "삁", 0.00000000 },
+  { "룡", 0.00010000 },
+  { "웗", 0.00000000 },
+  { "룴", 0.00000000 },
+  { "쑰", 0.00000000 },
+  { "기", 0.01090000 },
+  { "씸", 0.00000000 },
+  { "뉵", 0.00000000 },
+  { "햜", 0.00000000 },
+  { "옅", 0.00000000 },
+  { "퓂", 0.00000000 },
+  { "얣", 0.00000000 },
+  { "혭", 0.00000000 },
+  { "서", 0.01220000 },
+  { "햽", 0.00000000 },
+  { "휴", 0.00010000 },
+  { "걅", 0.00000000 },
+  { "쿭", 0.00000000 },
+  { "휯", 0.00000000 },
+  { "힣", 0.00000000 },
+  { "뿭", 0.00000000 },
+  { "뜸", 0.00000000 },
+  { "쳗", 0.00000000 },
+  { "핺", 0.00000000 },
+  { "톿", 0.00000000 },
+  { "씒", 0.00000000 },
+  { "땡", 0.00000000 },
+  { "퇴", 0.00030000 },
+  { "쯢", 0.00000000 },
+  { "빇", 0.00000000 },
+  { "틓", 0.00000000 },
+  { "펭", 0.00000000 },
+  { "켈", 0.00000000 },
+  { "눚", 0.00000000 },
+  { "찰", 0.00030000 },
+  { "향", 0.00080000 },
+  { "멬", 0.00000000 },
+  { "뿅", 0.00000000 },
+  { "꾏", 0.00000000 },
+  { "즈", 0.00080000 },
+  { "틅", 0.00000000 },
+  { "톃", 0.00000000 },
+  { "겴", 0.00000000 },
+  { "깷", 0.00000000 },
+  { "륁", 0.00000000 },
+  { "짂", 0.00000000 },
+  { "뗐", 0.00000000 },
+  { "칝", 0.00000000 },
+  { "롅", 0.00000000 },
+  { "붘", 0.00000000 },
+  { "톂", 0.00000000 },
+  { "튀", 0.00000000 },
+  { "쿹", 0.00000000 },
+  { "퀧", 0.00000000 },
+  { "픶", 0.00000000 },
+  { "궸", 0.00000000 },
+  { "벃", 0.00000000 },
+  { "쬫", 0.00000000 },
+  { "걉", 0.00000000 },
+  { "썔", 0.00000000 },
+  { "퉜", 0.00000000 },
+  { "켐", 0.00000000 },
+  { "좟", 0.00000000 },
+  { "톗", 0.00000000 },
+  { "푕", 0.00000000 },
+  { "쭮", 0.00000000 },
+  { "뤗", 0.00000000 },
+  { "쉽", 0.00010000 },
+  { "올", 0.00070000 },
+  { "쩉", 0.00000000 },
+  { "굜", 0.00000000 },
+  { "쾽", 0.00000000 },
+  { "흫", 0.00000000 },
+  { "옠", 0.00000000 },
+  { "꿸", 0.00000000 },
+  { "햎", 0.00000000 },
+  { "먯", 0.00000000 },
+  { "쎈", 0.00000000 },
+  { "캩", 0.00000000 },
+  { "엡", 0.00000000 },
+  { "츯", 0.00000000 },
+  { "펉", 0.00000000 },
+  { "냮", 0.00000000 },
+  { "페", 0.00070000 },
+  { "킜", 0.00000000 },
+  { "슀", 0.00000000 },
+  { "뫜", 0.00000000 },
+  { "톙", 0.00000000 },
+  { "쒲", 0.00000000 },
+  { "떃", 0.00000000 },
+  { "뷀", 0.00000000 },
+  { "쑶", 0.00000000 },
+  { "쥹", 0.00000000 },
+  { "몿", 0.00000000 },
+  { "뺮", 0.00000000 },
+  { "돮", 0.00000000 },
+  { "큧", 0.00000000 },
+  { "뼡", 0.00000000 },
+  { "쒊", 0.00000000 },
+  { "쩻", 0.00000000 },
+  { "뾣", 0.00000000 },
+  { "걍", 0.00000000 },
+  { "홭", 0.00000000 },
+  { "골", 0.00030000 },
+  { "뉖", 0.00000000 },
+  { "좥", 0.00000000 },
+  { "윗", 0.00000000 },
+  { "탥", 0.00000000 },
+  { "흃", 0.00000000 },
+  { "쨴", 0.00000000 },
+  { "릠", 0.00000000 },
+  { "끓", 0.00000000 },
+  { "묾", 0.00000000 },
+  { "줏", 0.00000000 },
+  { "펟", 0.00000000 },
+  { "당", 0.00230000 },
+  { "첋", 0.00000000 },
+  { "볗", 0.00000000 },
+  { "즊", 0.00000000 },
+  { "꽶", 0.00000000 },
+  { "펮", 0.00000000 },
+  { "쾲", 0.00000000 },
+  { "웓", 0.00000000 },
+  { "땇", 0.00000000 },
+  { "뵁", 0.00000000 },
+  { "갨", 0.00000000 },
+  { "졇", 0.00000000 },
+  { "뎊", 0.00000000 },
+  { "뎉", 0.00000000 },
+  { "뺆", 0.00000000 },
+  { "쾓", 0.00000000 },
+  { "봢", 0.00000000 },
+  { "혵", 0.00000000 },
+  { "쌱", 0.00000000 },
+  { "갑", 0.00010000 },
+  { "됓", 0.00000000 },
+  { "앐", 0.00000000 },
+  { "쟌", 0.00000000 },
+  { "췙", 0.00000000 },
+  { "세", 0.00330000 },
+  { "뾹", 0.00000000 },
+  { "얡", 0.00000000 },
+  { "솣", 0.00000000 },
+  { "졔", 0.00000000 },
+  { "좋", 0.00020000 },
+  { "묱", 0.00000000 },
+  { "쾉", 0.00000000 },
+  { "뒢", 0.00000000 },
+  { "쳓", 0.00000000 },
+  { "쥧", 0.00000000 },
+  { "퍎", 0.00000000 },
+  { "뒫", 0.00000000 },
+  { "딇", 0.00000000 },
+  { "쁳", 0.00000000 },
+  { "삙", 0.00000000 },
+  { "꺋", 0.00000000 },
+  { "헕", 0.00000000 },
+  { "꿃", 0.00000000 },
+  { "윷", 0.00000000 },
+  { "뿑", 0.00000000 },
+  { "휈", 0.00000000 },
+  { "괘", 0.00000000 },
+  { "룀", 0.00000000 },
+  { "릦", 0.00000000 },
+  { "쨍", 0.00000000 },
+  { "켲", 0.00000000 },
+  { "퇉", 0.00000000 },
+  { "튻", 0.00000000 },
+  { "떠", 0.00020000 },
+  { "뭌", 0.00000000 },
+  { "슔", 0.00000000 },
+  { "밥", 0.00000000 },
+  { "즖", 0.00000000 },
+  { "럒", 0.00000000 },
+  { "쥥", 0.00000000 },
+  { "쳫", 0.00000000 },
+  { "뻈", 0.00000000 },
+  { "컕", 0.00000000 },
+  { "듿", 0.00000000 },
+  { "솭", 0.00000000 },
+  { "굖", 0.00000000 },
+  { "꼼", 0.00000000 },
+  { "쪕", 0.00000000 },
+  { "탹", 0.00000000 },
+  { "뿧", 0.00000000 },
+  { "탎", 0.00000000 },
+  { "숶", 0.00000000 },
+  { "햛", 0.00000000 },
+  { "댧", 0.00000000 },
+  { "럋", 0.00000000 },
+  { "쎖", 0.00000000 },
+  { "쀠", 0.00000000 },
+  { "끕", 0.00000000 },
+  { "픲", 0.00000000 },
+  { "꺪", 0.00000000 },
+  { "쥟", 0.00000000 },
+  { "덏", 0.00000000 },
+  { "둕", 0.00000000 },
+  { "섶", 0.00000000 },
+  { "뽋", 0.00000000 },
+  { "쩨", 0.00000000 },
+  { "륐", 0.00000000 },
+  { "훣", 0.00000000 },
+  { "왓", 0.00000000 },
+  { "꿰", 0.00000000 },
+  { "뻦", 0.00000000 },
+  { "컈", 0.00000000 },
+  { "뽙", 0.00000000 },
+  { "툈", 0.00000000 },
+  { "뤑", 0.00000000 },
+  { "쩣", 0.00000000 },
+  { "겡", 0.00000000 },
+  { "덜", 0.00010000 },
+  { "졿", 0.00000000 },
+  { "휿", 0.00000000 },
+  { "딶", 0.00000000 },
+  { "돱", 0.00000000 },
+  { "틪", 0.00000000 },
+  { "궖", 0.00000000 },
+  { "쌖", 0.00000000 },
+  { "흌", 0.00000000 },
+  { "굏", 0.00000000 },
+  { "딞", 0.00000000 },
+  { "밟", 0.00000000 },
+  { "낸", 0.00020000 },
+  { "짌", 0.00000000 },
+  { "퍍", 0.00000000 },
+  { "릨", 0.00000000 },
+  { "걏", 0.00000000 },
+  { "젹", 0.00000000 },
+  { "늶", 0.00000000 },
+  { "큾", 0.00000000 },
+  { "딋", 0.00000000 },
+  { "쎛", 0.00000000 },
+  { "쥶", 0.00000000 },
+  { "긎", 0.00000000 },
+  { "릞", 0.00000000 },
+  { "퉶", 0.00000000 },
+  { "듶", 0.00000000 },
+  { "룩", 0.00000000 },
+  { "럳", 0.00000000 },
+  { "룧", 0.00000000 },
+  { "지", 0.01240000 },
+  { "였", 0.00410000 },
+  { "닂", 0.00000000 },
+  { "찴", 0.00000000 },
+  { "꼖", 0.00000000 },
+  { "탔", 0.00000000 },
+  { "퇆", 0.00000000 },
+  { "괾", 0.00000000 },
+  { "꺢", 0.00000000 },
+  { "욡", 0.00000000 },
+  { "삃", 0.00000000 },
+  { "퀝", 0.00000000 },
+  { "퇇", 0.00000000 },
+  { "핸", 0.00000000 },
+  { "꾍", 0.00000000 },
+  { "눱", 0.00000000 },
+  { "펍", 0.00000000 },
+  { "직", 0.00120000 },
+  { "풢", 0.00000000 },
+  { "꼈", 0.00000000 },
+  { "뤽", 0.00000000 },
+  { "돨", 0.00000000 },
+  { "둦", 0.00000000 },
+  { "녞", 0.00000000 },
+  { "훔", 0.00000000 },
+  { "옽", 0.00000000 },
+  { "툳", 0.00000000 },
+  { "뙽", 0.00000000 },
+  { "넝", 0.00000000 },
+  { "얼", 0.00020000 },
+  { "쳦", 0.00000000 },
+  { "팉", 0.00000000 },
+  { "칣", 0.00000000 },
+  { "퀐", 0.00000000 },
+  { "뙃", 0.00000000 },
+  { "뚹", 0.00000000 },
+  { "퀰", 0.00000000 },
+  { "떴", 0.00000000 },
+  { "챘", 0.00000000 },
+  { "쾬", 0.00000000 },
+  { "궛", 0.00000000 },
+  { "뜗", 0.00000000 },
+  { "쌯", 0.00000000 },
+  { "떒", 0.00000000 },
+  { "섲", 0.00000000 },
+  { "쏔", 0.00000000 },
+  { "쐈", 0.00000000 },
+  { "턢", 0.00000000 },
+  { "쿷", 0.00000000 },
+  { "폧", 0.00000000 },
+  { "낑", 0.00000000 },
+  { "깐", 0.00000000 },
+  { "귕", 0.00000000 },
+  { "씫", 0.00000000 },
+  { "쟲", 0.00000000 },
+  { "퀆", 0.00000000 },
+  { "뜪", 0.00000000 },
+  { "챢", 0.00000000 },
+  { "댚", 0.00000000 },
+  { "쾄", 0.00000000 },
+  { "핱", 0.00000000 },
+  { "첸", 0.00000000 },
+  { "튁", 0.00000000 },
+  { "착", 0.00030000 },
+  { "낋", 0.00000000 },
+  { "홵", 0.00000000 },
+  { "쿯", 0.00000000 },
+  { "껄", 0.00000000 },
+  { "먠", 0.00000000 },
+  { "뫉", 0.00000000 },
+  { "퓹", 0.00000000 },
+  { "쵓", 0.00000000 },
+  { "칃", 0.00000000 },
+  { "뗣", 0.00000000 },
+  { "멚", 0.00000000 },
+  { "쳮", 0.00000000 },
+  { "쌗", 0.00000000 },
+  { "쭔", 0.00000000 },
+  { "픨", 0.00000000 },
+  { "쁦", 0.00000000 },
+  { "켳", 0.00000000 },
+  { "죂", 0.00000000 },
+  { "쵕", 0.00000000 },
+  { "깄", 0.00000000 },
+  { "꺒", 0.00000000 },
+  { "궜", 0.00000000 },
+  { "룔", 0.00000000 },
+  { "넫", 0.00000000 },
+  { "둾", 0.00000000 },
+  { "뽩", 0.00000000 },
+  { "섆", 0.00000000 },
+  { "풀", 0.00010000 },
+  { "꿍", 0.00000000 },
+  { "뻂", 0.00000000 },
+  { "쟓", 0.00000000 },
+  { "휖", 0.00000000 },
+  { "볜", 0.00000000 },
+  { "뾫", 0.00000000 },
+  { "낖", 0.00000000 },
+  { "벺", 0.00000000 },
+  { "댵", 0.00000000 },
+  { "첃", 0.00000000 },
+  { "저", 0.00090000 },
+  { "묐", 0.00000000 },
+  { "쟦", 0.00000000 },
+  { "챀", 0.00000000 },
+  { "뽁", 0.00000000 },
+  { "죱", 0.00000000 },
+  { "져", 0.00060000 },
+  { "텈", 0.00000000 },
+  { "병", 0.00080000 },
+  { "릯", 0.00000000 },
+  { "뷗", 0.00000000 },
+  { "왴", 0.00000000 },
+  { "뗹", 0.00000000 },
+  { "띤", 0.00000000 },
+  { "뀚", 0.00000000 },
+  { "췚", 0.00000000 },
+  { "먔", 0.00000000 },
+  { "뫘", 0.00000000 },
+  { "쟩", 0.00000000 },
+  { "쁺", 0.00000000 },
+  { "폔", 0.00000000 },
+  { "섋", 0.00000000 },
+  { "쫺", 0.00000000 },
+  { "됍", 0.00000000 },
+  { "껸", 0.00000000 },
+  { "댾", 0.00000000 },
+  { "븠", 0.00000000 },
+  { "턔", 0.00000000 },
+  { "꾁", 0.00000000 },
+  { "볹", 0.00000000 },
+  { "쪉", 0.00000000 },
+  { "핡", 0.00000000 },
+  { "늄", 0.00000000 },
+  { "쪍", 0.00000000 },
+  { "뮂", 0.00000000 },
+  { "뿸", 0.00000000 },
+  { "벝", 0.00000000 },
+  { "쎌", 0.00000000 },
+  { "뚞", 0.00000000 },
+  { "뉇", 0.00000000 },
+  { "릏", 0.00000000 },
+  { "캑", 0.00000000 },
+  { "설", 0.00150000 },
+  { "쾤", 0.00000000 },
+  { "쾼", 0.00000000 },
+  { "컣", 0.00000000 },
+  { "듖", 0.00000000 },
+  { "떮", 0.00000000 },
+  { "슜", 0.00000000 },
+  { "쌦", 0.00000000 },
+  { "껶", 0.00000000 },
+  { "퇦", 0.00000000 },
+  { "꼝", 0.00000000 },
+  { "쿁", 0.00000000 },
+  { "켫", 0.00000000 },
+  { "쫋", 0.00000000 },
+  { "겯", 0.00000000 },
+  { "먖", 0.00000000 },
+  { "쉖", 0.00000000 },
+  { "뤦", 0.00000000 },
+  { "쯸", 0.00000000 },
+  { "샔", 0.00000000 },
+  { "쩙", 0.00000000 },
+  { "뒍", 0.00000000 },
+  { "똃", 0.00000000 },
+  { "궀", 0.00000000 },
+  { "힚", 0.00000000 },
+  { "쎍", 0.00000000 },
+  { "욪", 0.00000000 },
+  { "퐓", 0.00000000 },
+  { "헌", 0.00030000 },
+  { "둍", 0.00000000 },
+  { "쫊", 0.00000000 },
+  { "푿", 0.00000000 },
+  { "쫠", 0.00000000 },
+  { "먕", 0.00000000 },
+  { "쓶", 0.00000000 },
+  { "꾳", 0.00000000 },
+  { "뾨", 0.00000000 },
+  { "꿢", 0.00000000 },
+  { "볖", 0.00000000 },
+  { "밿", 0.00000000 },
+  { "걌", 0.00000000 },
+  { "겝", 0.00000000 },
+  { "끆", 0.00000000 },
+  { "즀", 0.00000000 },
+  { "쫀", 0.00000000 },
+  { "뜜", 0.00000000 },
+  { "쥡", 0.00000000 },
+  { "췵", 0.00000000 },
+  { "칂", 0.00000000 },
+  { "햿", 0.00000000 },
+  { "뼇", 0.00000000 },
+  { "챞", 0.00000000 },
+  { "뇣", 0.00000000 },
+  { "뀵", 0.00000000 },
+  { "묺", 0.00000000 },
+  { "폽", 0.00000000 },
+  { "뮳", 0.00000000 },
+  { "왔", 0.00030000 },
+  { "쟊", 0.00000000 },
+  { "놰", 0.00000000 },
+  { "쒶", 0.00000000 },
+  { "많", 0.00080000 },
+  { "뉬", 0.00000000 },
+  { "팑", 0.00000000 },
+  { "잕", 0.00000000 },
+  { "랓", 0.00000000 },
+  { "뮅", 0.00000000 },
+  { "햪", 0.00000000 },
+  { "곹", 0.00000000 },
+  { "댐", 0.00000000 },
+  { "쎟", 0.00000000 },
+  { "칡", 0.00000000 },
+  { "풱", 0.00000000 },
+  { "갛", 0.00000000 },
+  { "쯞", 0.00000000 },
+  { "즒", 0.00000000 },
+  { "쑱", 0.00000000 },
+  { "푱", 0.00000000 },
+  { "뢃", 0.00000000 },
+  { "쁑", 0.00000000 },
+  { "콙", 0.00000000 },
+  { "굁", 0.00000000 },
+  { "쁟", 0.00000000 },
+  { "톁", 0.00000000 },
+  { "닆", 0.00000000 },
+  { "궼", 0.00000000 },
+  { "엜", 0.00000000 },
+  { "콜", 0.00020000 },
+  { "퐄", 0.00000000 },
+  { "녽", 0.00000000 },
+  { "뽕", 0.00000000 },
+  { "댬", 0.00000000 },
+  { "듼", 0.00000000 },
+  { "뙪", 0.00000000 },
+  { "읳", 0.00000000 },
+  { "칿", 0.00000000 },
+  { "폼", 0.00000000 },
+  { "툒", 0.00000000 },
+  { "껲", 0.00000000 },
+  { "끠", 0.00000000 },
+  { "엥", 0.00000000 },
+  { "퇽", 0.00000000 },
+  { "레", 0.00190000 },
+  { "쓏", 0.00000000 },
+  { "롓", 0.00000000 },
+  { "탑", 0.00010000 },
+  { "익", 0.00020000 },
+  { "휤", 0.00000000 },
+  { "찅", 0.00000000 },
+  { "갣", 0.00000000 },
+  { "뗿", 0.00000000 },
+  { "쾈", 0.00000000 },
+  { "솼", 0.00000000 },
+  { "녣", 0.00000000 },
+  { "몒", 0.00000000 },
+  { "몠", 0.00000000 },
+  { "끒", 0.00000000 },
+  { "롪", 0.00000000 },
+  { "뛉", 0.00000000 },
+  { "콒", 0.00000000 },
+  { "욗", 0.00000000 },
+  { "젙", 0.00000000 },
+  { "칋", 0.00000000 },
+  { "쌶", 0.00000000 },
+  { "쪵", 0.00000000 },
+  { "쯪", 0.00000000 },
+  { "잿", 0.00000000 },
+  { "캪", 0.00000000 },
+  { "쾘", 0.00000000 },
+  { "일", 0.00750000 },
+  { "춻", 0.00000000 },
+  { "쁐", 0.00000000 },
+  { "첍", 0.00000000 },
+  { "릎", 0.00000000 },
+  { "뺨", 0.00000000 },
+  { "륂", 0.00000000 },
+  { "팍", 0.00000000 },
+  { "쟆", 0.00000000 },
+  { "쳒", 0.00000000 },
+  { "훤", 0.00000000 },
+  { "뇆", 0.00000000 },
+  { "쬭", 0.00000000 },
+  { "쵆", 0.00000000 },
+  { "륩", 0.00000000 },
+  { "꼓", 0.00000000 },
+  { "킴", 0.00000000 },
+  { "퐵", 0.00000000 },
+  { "뒉", 0.00000000 },
+  { "혦", 0.00000000 },
+  { "갿", 0.00000000 },
+  { "켊", 0.00000000 },
+  { "낺", 0.00000000 },
+  { "랮", 0.00000000 },
+  { "봗", 0.00000000 },
+  { "쬏", 0.00000000 },
+  { "텝", 0.00000000 },
+  { "숞", 0.00000000 },
+  { "늨", 0.00000000 },
+  { "즅", 0.00000000 },
+  { "띰", 0.00000000 },
+  { "믟", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_140_FREQ_CPS[] = {
+  { 0xAC00u, 0.01320000 },
+  { 0xAC01u, 0.00130000 },
+  { 0xAC02u, 0.00000000 },
+  { 0xAC03u, 0.00000000 },
+  { 0xAC04u, 0.00200000 },
+  { 0xAC05u, 0.00000000 },
+  { 0xAC06u, 0.00000000 },
+  { 0xAC07u, 0.00000000 },
+  { 0xAC08u, 0.00030000 },
+  { 0xAC09u, 0.00000000 },
+  { 0xAC0Au, 0.00000000 },
+  { 0xAC0Bu, 0.00000000 },
+  { 0xAC0Cu, 0.00000000 },
+  { 0xAC0Du, 0.00000000 },
+  { 0xAC0Eu, 0.00000000 },
+  { 0xAC0Fu, 0.00000000 },
+  { 0xAC10u, 0.00080000 },
+  { 0xAC11u, 0.00010000 },
+  { 0xAC12u, 0.00010000 },
+  { 0xAC13u, 0.00000000 },
+  { 0xAC14u, 0.00020000 },
+  { 0xAC15u, 0.00150000 },
+  { 0xAC16u, 0.00020000 },
+  { 0xAC17u, 0.00000000 },
+  { 0xAC18u, 0.00000000 },
+  { 0xAC19u, 0.00090000 },
+  { 0xAC1Au, 0.00000000 },
+  { 0xAC1Bu, 0.00000000 },
+  { 0xAC1Cu, 0.00310000 },
+  { 0xAC1Du, 0.00020000 },
+  { 0xAC1Eu, 0.00000000 },
+  { 0xAC1Fu, 0.00000000 },
+  { 0xAC20u, 0.00000000 },
+  { 0xAC21u, 0.00000000 },
+  { 0xAC22u, 0.00000000 },
+  { 0xAC23u, 0.00000000 },
+  { 0xAC24u, 0.00000000 },
+  { 0xAC25u, 0.00000000 },
+  { 0xAC26u, 0.00000000 },
+  { 0xAC27u, 0.00000000 },
+  { 0xAC28u, 0.00000000 },
+  { 0xAC29u, 0.00000000 },
+  { 0xAC2Au, 0.00000000 },
+  { 0xAC2Bu, 0.00000000 },
+  { 0xAC2Cu, 0.00000000 },
+  { 0xAC2Du, 0.00000000 },
+  { 0xAC2Eu, 0.00000000 },
+  { 0xAC2Fu, 0.00000000 },
+  { 0xAC30u, 0.00000000 },
+  { 0xAC31u, 0.00000000 },
+  { 0xAC32u, 0.00000000 },
+  { 0xAC33u, 0.00000000 },
+  { 0xAC34u, 0.00000000 },
+  { 0xAC35u, 0.00000000 },
+  { 0xAC36u, 0.00000000 },
+  { 0xAC37u, 0.00000000 },
+  { 0xAC38u, 0.00000000 },
+  { 0xAC39u, 0.00000000 },
+  { 0xAC3Au, 0.00000000 },
+  { 0xAC3Bu, 0.00000000 },
+  { 0xAC3Cu, 0.00000000 },
+  { 0xAC3Du, 0.00000000 },
+  { 0xAC3Eu, 0.00000000 },
+  { 0xAC3Fu, 0.00000000 },
+  { 0xAC40u, 0.00000000 },
+  { 0xAC41u, 0.00000000 },
+  { 0xAC42u, 0.00000000 },
+  { 0xAC43u, 0.00000000 },
+  { 0xAC44u, 0.00000000 },
+  { 0xAC45u, 0.00000000 },
+  { 0xAC46u, 0.00000000 },
+  { 0xAC47u, 0.00000000 },
+  { 0xAC48u, 0.00000000 },
+  { 0xAC49u, 0.00000000 },
+  { 0xAC4Au, 0.00000000 },
+  { 0xAC4Bu, 0.00000000 },
+  { 0xAC4Cu, 0.00000000 },
+  { 0xAC4Du, 0.00000000 },
+  { 0xAC4Eu, 0.00000000 },
+  { 0xAC4Fu, 0.00000000 },
+  { 0xAC50u, 0.00000000 },
+  { 0xAC51u, 0.00000000 },
+  { 0xAC52u, 0.00000000 },
+  { 0xAC53u, 0.00000000 },
+  { 0xAC54u, 0.00000000 },
+  { 0xAC55u, 0.00000000 },
+  { 0xAC56u, 0.00000000 },
+  { 0xAC57u, 0.00000000 },
+  { 0xAC58u, 0.00000000 },
+  { 0xAC59u, 0.00000000 },
+  { 0xAC5Au, 0.00000000 },
+  { 0xAC5Bu, 0.00000000 },
+  { 0xAC5Cu, 0.00000000 },
+  { 0xAC5Du, 0.00000000 },
+  { 0xAC5Eu, 0.00000000 },
+  { 0xAC5Fu, 0.00000000 },
+  { 0xAC60u, 0.00000000 },
+  { 0xAC61u, 0.00000000 },
+  { 0xAC62u, 0.00000000 },
+  { 0xAC63u, 0.00000000 },
+  { 0xAC64u, 0.00000000 },
+  { 0xAC65u, 0.00000000 },
+  { 0xAC66u, 0.00000000 },
+  { 0xAC67u, 0.00000000 },
+  { 0xAC68u, 0.00000000 },
+  { 0xAC69u, 0.00000000 },
+  { 0xAC6Au, 0.00000000 },
+  { 0xAC6Bu, 0.00000000 },
+  { 0xAC6Cu, 0.00000000 },
+  { 0xAC6Du, 0.00000000 },
+  { 0xAC6Eu, 0.00000000 },
+  { 0xAC6Fu, 0.00000000 },
+  { 0xAC70u, 0.00210000 },
+  { 0xAC71u, 0.00000000 },
+  { 0xAC72u, 0.00000000 },
+  { 0xAC73u, 0.00000000 },
+  { 0xAC74u, 0.00120000 },
+  { 0xAC75u, 0.00000000 },
+  { 0xAC76u, 0.00000000 },
+  { 0xAC77u, 0.00000000 },
+  { 0xAC78u, 0.00030000 },
+  { 0xAC79u, 0.00000000 },
+  { 0xAC7Au, 0.00000000 },
+  { 0xAC7Bu, 0.00000000 },
+  { 0xAC7Cu, 0.00000000 },
+  { 0xAC7Du, 0.00000000 },
+  { 0xAC7Eu, 0.00000000 },
+  { 0xAC7Fu, 0.00000000 },
+  { 0xAC80u, 0.00030000 },
+  { 0xAC81u, 0.00000000 },
+  { 0xAC82u, 0.00000000 },
+  { 0xAC83u, 0.00260000 },
+  { 0xAC84u, 0.00000000 },
+  { 0xAC85u, 0.00000000 },
+  { 0xAC86u, 0.00000000 },
+  { 0xAC87u, 0.00000000 },
+  { 0xAC88u, 0.00000000 },
+  { 0xAC89u, 0.00000000 },
+  { 0xAC8Au, 0.00000000 },
+  { 0xAC8Bu, 0.00000000 },
+  { 0xAC8Cu, 0.00380000 },
+  { 0xAC8Du, 0.00000000 },
+  { 0xAC8Eu, 0.00000000 },
+  { 0xAC8Fu, 0.00000000 },
+  { 0xAC90u, 0.00010000 },
+  { 0xAC91u, 0.00000000 },
+  { 0xAC92u, 0.00000000 },
+  { 0xAC93u, 0.00000000 },
+  { 0xAC94u, 0.00000000 },
+  { 0xAC95u, 0.00000000 },
+  { 0xAC96u, 0.00000000 },
+  { 0xAC97u, 0.00000000 },
+  { 0xAC98u, 0.00000000 },
+  { 0xAC99u, 0.00000000 },
+  { 0xAC9Au, 0.00000000 },
+  { 0xAC9Bu, 0.00000000 },
+  { 0xAC9Cu, 0.00000000 },
+  { 0xAC9Du, 0.00000000 },
+  { 0xAC9Eu, 0.00000000 },
+  { 0xAC9Fu, 0.00000000 },
+  { 0xACA0u, 0.00010000 },
+  { 0xACA1u, 0.00000000 },
+  { 0xACA2u, 0.00000000 },
+  { 0xACA3u, 0.00000000 },
+  { 0xACA4u, 0.00000000 },
+  { 0xACA5u, 0.00000000 },
+  { 0xACA6u, 0.00000000 },
+  { 0xACA7u, 0.00000000 },
+  { 0xACA8u, 0.00040000 },
+  { 0xACA9u, 0.00110000 },
+  { 0xACAAu, 0.00010000 },
+  { 0xACABu, 0.00000000 },
+  { 0xACACu, 0.00050000 },
+  { 0xACADu, 0.00000000 },
+  { 0xACAEu, 0.00000000 },
+  { 0xACAFu, 0.00000000 },
+  { 0xACB0u, 0.00150000 },
+  { 0xACB1u, 0.00000000 },
+  { 0xACB2u, 0.00000000 },
+  { 0xACB3u, 0.00000000 },
+  { 0xACB4u, 0.00000000 },
+  { 0xACB5u, 0.00000000 },
+  { 0xACB6u, 0.00000000 },
+  { 0xACB7u, 0.00000000 },
+  { 0xACB8u, 0.00010000 },
+  { 0xACB9u, 0.00000000 },
+  { 0xACBAu, 0.00000000 },
+  { 0xACBBu, 0.00000000 },
+  { 0xACBCu, 0.00010000 },
+  { 0xACBDu, 0.00330000 },
+  { 0xACBEu, 0.00000000 },
+  { 0xACBFu, 0.00000000 },
+  { 0xACC0u, 0.00000000 },
+  { 0xACC1u, 0.00000000 },
+  { 0xACC2u, 0.00000000 },
+  { 0xACC3u, 0.00000000 },
+  { 0xACC4u, 0.00290000 },
+  { 0xACC5u, 0.00000000 },
+  { 0xACC6u, 0.00000000 },
+  { 0xACC7u, 0.00000000 },
+  { 0xACC8u, 0.00000000 },
+  { 0xACC9u, 0.00000000 },
+  { 0xACCAu, 0.00000000 },
+  { 0xACCBu, 0.00000000 },
+  { 0xACCCu, 0.00000000 },
+  { 0xACCDu, 0.00000000 },
+  { 0xACCEu, 0.00000000 },
+  { 0xACCFu, 0.00000000 },
+  { 0xACD0u, 0.00000000 },
+  { 0xACD1u, 0.00000000 },
+  { 0xACD2u, 0.00000000 },
+  { 0xACD3u, 0.00000000 },
+  { 0xACD4u, 0.00000000 },
+  { 0xACD5u, 0.00000000 },
+  { 0xACD6u, 0.00000000 },
+  { 0xACD7u, 0.00000000 },
+  { 0xACD8u, 0.00000000 },
+  { 0xACD9u, 0.00000000 },
+  { 0xACDAu, 0.00000000 },
+  { 0xACDBu, 0.00000000 },
+  { 0xACDCu, 0.00000000 },
+  { 0xACDDu, 0.00000000 },
+  { 0xACDEu, 0.00000000 },
+  { 0xACDFu, 0.00000000 },
+  { 0xACE0u, 0.01270000 },
+  { 0xACE1u, 0.00060000 },
+  { 0xACE2u, 0.00000000 },
+  { 0xACE3u, 0.00000000 },
+  { 0xACE4u, 0.00010000 },
+  { 0xACE5u, 0.00000000 },
+  { 0xACE6u, 0.00000000 },
+  { 0xACE7u, 0.00010000 },
+  { 0xACE8u, 0.00030000 },
+  { 0xACE9u, 0.00000000 },
+  { 0xACEAu, 0.00000000 },
+  { 0xACEBu, 0.00000000 },
+  { 0xACECu, 0.00000000 },
+  { 0xACEDu, 0.00000000 },
+  { 0xACEEu, 0.00000000 },
+  { 0xACEFu, 0.00000000 },
+  { 0xACF0u, 0.00000000 },
+  { 0xACF1u, 0.00000000 },
+  { 0xACF2u, 0.00000000 },
+  { 0xACF3u, 0.00040000 },
+  { 0xACF4u, 0.00000000 },
+  { 0xACF5u, 0.00380000 },
+  { 0xACF6u, 0.00000000 },
+  { 0xACF7u, 0.00000000 },
+  { 0xACF8u, 0.00000000 },
+  { 0xACF9u, 0.00000000 },
+  { 0xACFAu, 0.00000000 },
+  { 0xACFBu, 0.00000000 },
+  { 0xACFCu, 0.00550000 },
+  { 0xACFDu, 0.00000000 },
+  { 0xACFEu, 0.00000000 },
+  { 0xACFFu, 0.00000000 },
+  { 0xAD00u, 0.00280000 },
+  { 0xAD01u, 0.00000000 },
+  { 0xAD02u, 0.00000000 },
+  { 0xAD03u, 0.00000000 },
+  { 0xAD04u, 0.00000000 },
+  { 0xAD05u, 0.00000000 },
+  { 0xAD06u, 0.00000000 },
+  { 0xAD07u, 0.00000000 },
+  { 0xAD08u, 0.00000000 },
+  { 0xAD09u, 0.00000000 },
+  { 0xAD0Au, 0.00000000 },
+  { 0xAD0Bu, 0.00000000 },
+  { 0xAD0Cu, 0.00000000 },
+  { 0xAD0Du, 0.00000000 },
+  { 0xAD0Eu, 0.00000000 },
+  { 0xAD0Fu, 0.00000000 },
+  { 0xAD10u, 0.00000000 },
+  { 0xAD11u, 0.00080000 },
+  { 0xAD12u, 0.00000000 },
+  { 0xAD13u, 0.00000000 },
+  { 0xAD14u, 0.00000000 },
+  { 0xAD15u, 0.00000000 },
+  { 0xAD16u, 0.00000000 },
+  { 0xAD17u, 0.00000000 },
+  { 0xAD18u, 0.00000000 },
+  { 0xAD19u, 0.00000000 },
+  { 0xAD1Au, 0.00000000 },
+  { 0xAD1Bu, 0.00000000 },
+  { 0xAD1Cu, 0.00000000 },
+  { 0xAD1Du, 0.00000000 },
+  { 0xAD1Eu, 0.00000000 },
+  { 0xAD1Fu, 0.00000000 },
+  { 0xAD20u, 0.00000000 },
+  { 0xAD21u, 0.00000000 },
+  { 0xAD22u, 0.00000000 },
+  { 0xAD23u, 0.00000000 },
+  { 0xAD24u, 0.00000000 },
+  { 0xAD25u, 0.00000000 },
+  { 0xAD26u, 0.00000000 },
+  { 0xAD27u, 0.00000000 },
+  { 0xAD28u, 0.00000000 },
+  { 0xAD29u, 0.00000000 },
+  { 0xAD2Au, 0.00000000 },
+  { 0xAD2Bu, 0.00000000 },
+  { 0xAD2Cu, 0.00000000 },
+  { 0xAD2Du, 0.00000000 },
+  { 0xAD2Eu, 0.00000000 },
+  { 0xAD2Fu, 0.00000000 },
+  { 0xAD30u, 0.00000000 },
+  { 0xAD31u, 0.00000000 },
+  { 0xAD32u, 0.00000000 },
+  { 0xAD33u, 0.00000000 },
+  { 0xAD34u, 0.00020000 },
+  { 0xAD35u, 0.00000000 },
+  { 0xAD36u, 0.00000000 },
+  { 0xAD37u, 0.00000000 },
+  { 0xAD38u, 0.00000000 },
+  { 0xAD39u, 0.00000000 },
+  { 0xAD3Au, 0.00000000 },
+  { 0xAD3Bu, 0.00000000 },
+  { 0xAD3Cu, 0.00000000 },
+  { 0xAD3Du, 0.00000000 },
+  { 0xAD3Eu, 0.00000000 },
+  { 0xAD3Fu, 0.00000000 },
+  { 0xAD40u, 0.00000000 },
+  { 0xAD41u, 0.00000000 },
+  { 0xAD42u, 0.00000000 },
+  { 0xAD43u, 0.00000000 },
+  { 0xAD44u, 0.00000000 },
+  { 0xAD45u, 0.00000000 },
+  { 0xAD46u, 0.00000000 },
+  { 0xAD47u, 0.00000000 },
+  { 0xAD48u, 0.00000000 },
+  { 0xAD49u, 0.00000000 },
+  { 0xAD4Au, 0.00000000 },
+  { 0xAD4Bu, 0.00000000 },
+  { 0xAD4Cu, 0.00000000 },
+  { 0xAD4Du, 0.00000000 },
+  { 0xAD4Eu, 0.00000000 },
+  { 0xAD4Fu, 0.00000000 },
+  { 0xAD50u, 0.00340000 },
+  { 0xAD51u, 0.00000000 },
+  { 0xAD52u, 0.00000000 },
+  { 0xAD53u, 0.00000000 },
+  { 0xAD54u, 0.00000000 },
+  { 0xAD55u, 0.00000000 },
+  { 0xAD56u, 0.00000000 },
+  { 0xAD57u, 0.00000000 },
+  { 0xAD58u, 0.00000000 },
+  { 0xAD59u, 0.00000000 },
+  { 0xAD5Au, 0.00000000 },
+  { 0xAD5Bu, 0.00000000 },
+  { 0xAD5Cu, 0.00000000 },
+  { 0xAD5Du, 0.00000000 },
+  { 0xAD5Eu, 0.00000000 },
+  { 0xAD5Fu, 0.00000000 },
+  { 0xAD60u, 0.00000000 },
+  { 0xAD61u, 0.00000000 },
+  { 0xAD62u, 0.00000000 },
+  { 0xAD63u, 0.00000000 },
+  { 0xAD64u, 0.00000000 },
+  { 0xAD65u, 0.00000000 },
+  { 0xAD66u, 0.00000000 },
+  { 0xAD67u, 0.00000000 },
+  { 0xAD68u, 0.00000000 },
+  { 0xAD69u, 0.00000000 },
+  { 0xAD6Au, 0.00000000 },
+  { 0xAD6Bu, 0.00000000 },
+  { 0xAD6Cu, 0.00450000 },
+  { 0xAD6Du, 0.00610000 },
+  { 0xAD6Eu, 0.00000000 },
+  { 0xAD6Fu, 0.00000000 },
+  { 0xAD70u, 0.00240000 },
+  { 0xAD71u, 0.00000000 },
+  { 0xAD72u, 0.00000000 },
+  { 0xAD73u, 0.00000000 },
+  { 0xAD74u, 0.00010000 },
+  { 0xAD75u, 0.00000000 },
+  { 0xAD76u, 0.00000000 },
+  { 0xAD77u, 0.00000000 },
+  { 0xAD78u, 0.00000000 },
+  { 0xAD79u, 0.00000000 },
+  { 0xAD7Au, 0.00000000 },
+  { 0xAD7Bu, 0.00000000 },
+  { 0xAD7Cu, 0.00000000 },
+  { 0xAD7Du, 0.00000000 },
+  { 0xAD7Eu, 0.00000000 },
+  { 0xAD7Fu, 0.00000000 },
+  { 0xAD80u, 0.00000000 },
+  { 0xAD81u, 0.00020000 },
+  { 0xAD82u, 0.00000000 },
+  { 0xAD83u, 0.00000000 },
+  { 0xAD84u, 0.00000000 },
+  { 0xAD85u, 0.00000000 },
+  { 0xAD86u, 0.00000000 },
+  { 0xAD87u, 0.00000000 },
+  { 0xAD88u, 0.00000000 },
+  { 0xAD89u, 0.00000000 },
+  { 0xAD8Au, 0.00000000 },
+  { 0xAD8Bu, 0.00000000 },
+  { 0xAD8Cu, 0.00110000 },
+  { 0xAD8Du, 0.00000000 },
+  { 0xAD8Eu, 0.00000000 },
+  { 0xAD8Fu, 0.00000000 },
+  { 0xAD90u, 0.00000000 },
+  { 0xAD91u, 0.00000000 },
+  { 0xAD92u, 0.00000000 },
+  { 0xAD93u, 0.00000000 },
+  { 0xAD94u, 0.00000000 },
+  { 0xAD95u, 0.00000000 },
+  { 0xAD96u, 0.00000000 },
+  { 0xAD97u, 0.00000000 },
+  { 0xAD98u, 0.00000000 },
+  { 0xAD99u, 0.00000000 },
+  { 0xAD9Au, 0.00000000 },
+  { 0xAD9Bu, 0.00000000 },
+  { 0xAD9Cu, 0.00000000 },
+  { 0xAD9Du, 0.00000000 },
+  { 0xAD9Eu, 0.00000000 },
+  { 0xAD9Fu, 0.00000000 },
+  { 0xADA0u, 0.00000000 },
+  { 0xADA1u, 0.00000000 },
+  { 0xADA2u, 0.00000000 },
+  { 0xADA3u, 0.00000000 },
+  { 0xADA4u, 0.00010000 },
+  { 0xADA5u, 0.00000000 },
+  { 0xADA6u, 0.00000000 },
+  { 0xADA7u, 0.00000000 },
+  { 0xADA8u, 0.00000000 },
+  { 0xADA9u, 0.00000000 },
+  { 0xADAAu, 0.00000000 },
+  { 0xADABu, 0.00000000 },
+  { 0xADACu, 0.00000000 },
+  { 0xADADu, 0.00000000 },
+  { 0xADAEu, 0.00000000 },
+  { 0xADAFu, 0.00000000 },
+  { 0xADB0u, 0.00000000 },
+  { 0xADB1u, 0.00000000 },
+  { 0xADB2u, 0.00000000 },
+  { 0xADB3u, 0.00000000 },
+  { 0xADB4u, 0.00000000 },
+  { 0xADB5u, 0.00000000 },
+  { 0xADB6u, 0.00000000 },
+  { 0xADB7u, 0.00000000 },
+  { 0xADB8u, 0.00000000 },
+  { 0xADB9u, 0.00000000 },
+  { 0xADBAu, 0.00000000 },
+  { 0xADBBu, 0.00000000 },
+  { 0xADBCu, 0.00000000 },
+  { 0xADBDu, 0.00000000 },
+  { 0xADBEu, 0.00000000 },
+  { 0xADBFu, 0.00000000 },
+  { 0xADC0u, 0.00030000 },
+  { 0xADC1u, 0.00000000 },
+  { 0xADC2u, 0.00000000 },
+  { 0xADC3u, 0.00000000 },
+  { 0xADC4u, 0.00000000 },
+  { 0xADC5u, 0.00000000 },
+  { 0xADC6u, 0.00000000 },
+  { 0xADC7u, 0.00000000 },
+  { 0xADC8u, 0.00000000 },
+  { 0xADC9u, 0.00000000 },
+  { 0xADCAu, 0.00000000 },
+  { 0xADCBu, 0.00000000 },
+  { 0xADCCu, 0.00000000 },
+  { 0xADCDu, 0.00000000 },
+  { 0xADCEu, 0.00000000 },
+  { 0xADCFu, 0.00000000 },
+  { 0xADD0u, 0.00000000 },
+  { 0xADD1u, 0.00000000 },
+  { 0xADD2u, 0.00000000 },
+  { 0xADD3u, 0.00000000 },
+  { 0xADD4u, 0.00000000 },
+  { 0xADD5u, 0.00000000 },
+  { 0xADD6u, 0.00000000 },
+  { 0xADD7u, 0.00000000 },
+  { 0xADD8u, 0.00000000 },
+  { 0xADD9u, 0.00000000 },
+  { 0xADDAu, 0.00000000 },
+  { 0xADDBu, 0.00000000 },
+  { 0xADDCu, 0.00050000 },
+  { 0xADDDu, 0.00000000 },
+  { 0xADDEu, 0.00000000 },
+  { 0xADDFu, 0.00000000 },
+  { 0xADE0u, 0.00020000 },
+  { 0xADE1u, 0.00000000 },
+  { 0xADE2u, 0.00000000 },
+  { 0xADE3u, 0.00000000 },
+  { 0xADE4u, 0.00000000 },
+  { 0xADE5u, 0.00000000 },
+  { 0xADE6u, 0.00000000 },
+  { 0xADE7u, 0.00000000 },
+  { 0xADE8u, 0.00000000 },
+  { 0xADE9u, 0.00000000 },
+  { 0xADEAu, 0.00000000 },
+  { 0xADEBu, 0.00000000 },
+  { 0xADECu, 0.00000000 },
+  { 0xADEDu, 0.00000000 },
+  { 0xADEEu, 0.00000000 },
+  { 0xADEFu, 0.00000000 },
+  { 0xADF0u, 0.00000000 },
+  { 0xADF1u, 0.00000000 },
+  { 0xADF2u, 0.00000000 },
+  { 0xADF3u, 0.00000000 },
+  { 0xADF4u, 0.00000000 },
+  { 0xADF5u, 0.00000000 },
+  { 0xADF6u, 0.00000000 },
+  { 0xADF7u, 0.00000000 },
+  { 0xADF8u, 0.00630000 },
+  { 0xADF9u, 0.00050000 },
+  { 0xADFAu, 0.00000000 },
+  { 0xADFBu, 0.00000000 },
+  { 0xADFCu, 0.00070000 },
+  { 0xADFDu, 0.00000000 },
+  { 0xADFEu, 0.00000000 },
+  { 0xADFFu, 0.00000000 },
+  { 0xAE00u, 0.00050000 },
+  { 0xAE01u, 0.00000000 },
+  { 0xAE02u, 0.00000000 },
+  { 0xAE03u, 0.00000000 },
+  { 0xAE04u, 0.00000000 },
+  { 0xAE05u, 0.00000000 },
+  { 0xAE06u, 0.00000000 },
+  { 0xAE07u, 0.00000000 },
+  { 0xAE08u, 0.00090000 },
+  { 0xAE09u, 0.00080000 },
+  { 0xAE0Au, 0.00000000 },
+  { 0xAE0Bu, 0.00000000 },
+  { 0xAE0Cu, 0.00000000 },
+  { 0xAE0Du, 0.00000000 },
+  { 0xAE0Eu, 0.00000000 },
+  { 0xAE0Fu, 0.00000000 },
+  { 0xAE10u, 0.00000000 },
+  { 0xAE11u, 0.00000000 },
+  { 0xAE12u, 0.00000000 },
+  { 0xAE13u, 0.00000000 },
+  { 0xAE14u, 0.00000000 },
+  { 0xAE15u, 0.00000000 },
+  { 0xAE16u, 0.00000000 },
+  { 0xAE17u, 0.00000000 },
+  { 0xAE18u, 0.00000000 },
+  { 0xAE19u, 0.00000000 },
+  { 0xAE1Au, 0.00000000 },
+  { 0xAE1Bu, 0.00000000 },
+  { 0xAE1Cu, 0.00000000 },
+  { 0xAE1Du, 0.00000000 },
+  { 0xAE1Eu, 0.00000000 },
+  { 0xAE1Fu, 0.00000000 },
+  { 0xAE20u, 0.00000000 },
+  { 0xAE21u, 0.00000000 },
+  { 0xAE22u, 0.00000000 },
+  { 0xAE23u, 0.00000000 },
+  { 0xAE24u, 0.00000000 },
+  { 0xAE25u, 0.00000000 },
+  { 0xAE26u, 0.00000000 },
+  { 0xAE27u, 0.00000000 },
+  { 0xAE28u, 0.00000000 },
+  { 0xAE29u, 0.00000000 },
+  { 0xAE2Au, 0.00000000 },
+  { 0xAE2Bu, 0.00000000 },
+  { 0xAE2Cu, 0.00000000 },
+  { 0xAE2Du, 0.00000000 },
+  { 0xAE2Eu, 0.00000000 },
+  { 0xAE2Fu, 0.00000000 },
+  { 0xAE30u, 0.01090000 },
+  { 0xAE31u, 0.00000000 },
+  { 0xAE32u, 0.00000000 },
+  { 0xAE33u, 0.00000000 },
+  { 0xAE34u, 0.00020000 },
+  { 0xAE35u, 0.00000000 },
+  { 0xAE36u, 0.00000000 },
+  { 0xAE37u, 0.00000000 },
+  { 0xAE38u, 0.00040000 },
+  { 0xAE39u, 0.00000000 },
+  { 0xAE3Au, 0.00000000 },
+  { 0xAE3Bu, 0.00000000 },
+  { 0xAE3Cu, 0.00000000 },
+  { 0xAE3Du, 0.00000000 },
+  { 0xAE3Eu, 0.00000000 },
+  { 0xAE3Fu, 0.00000000 },
+  { 0xAE40u, 0.00070000 },
+  { 0xAE41u, 0.00000000 },
+  { 0xAE42u, 0.00000000 },
+  { 0xAE43u, 0.00000000 },
+  { 0xAE44u, 0.00000000 },
+  { 0xAE45u, 0.00000000 },
+  { 0xAE46u, 0.00000000 },
+  { 0xAE47u, 0.00000000 },
+  { 0xAE48u, 0.00000000 },
+  { 0xAE49u, 0.00000000 },
+  { 0xAE4Au, 0.00010000 },
+  { 0xAE4Bu, 0.00000000 },
+  { 0xAE4Cu, 0.00130000 },
+  { 0xAE4Du, 0.00000000 },
+  { 0xAE4Eu, 0.00000000 },
+  { 0xAE4Fu, 0.00000000 },
+  { 0xAE50u, 0.00000000 },
+  { 0xAE51u, 0.00000000 },
+  { 0xAE52u, 0.00000000 },
+  { 0xAE53u, 0.00000000 },
+  { 0xAE54u, 0.00000000 },
+  { 0xAE55u, 0.00000000 },
+  { 0xAE56u, 0.00000000 },
+  { 0xAE57u, 0.00000000 },
+  { 0xAE58u, 0.00000000 },
+  { 0xAE59u, 0.00000000 },
+  { 0xAE5Au, 0.00000000 },
+  { 0xAE5Bu, 0.00000000 },
+  { 0xAE5Cu, 0.00000000 },
+  { 0xAE5Du, 0.00000000 },
+  { 0xAE5Eu, 0.00000000 },
+  { 0xAE5Fu, 0.00000000 },
+  { 0xAE60u, 0.00000000 },
+  { 0xAE61u, 0.00000000 },
+  { 0xAE62u, 0.00000000 },
+  { 0xAE63u, 0.00000000 },
+  { 0xAE64u, 0.00000000 },
+  { 0xAE65u, 0.00000000 },
+  { 0xAE66u, 0.00000000 },
+  { 0xAE67u, 0.00000000 },
+  { 0xAE68u, 0.00010000 },
+  { 0xAE69u, 0.00000000 },
+  { 0xAE6Au, 0.00000000 },
+  { 0xAE6Bu, 0.00000000 },
+  { 0xAE6Cu, 0.00000000 },
+  { 0xAE6Du, 0.00000000 },
+  { 0xAE6Eu, 0.00000000 },
+  { 0xAE6Fu, 0.00000000 },
+  { 0xAE70u, 0.00000000 },
+  { 0xAE71u, 0.00000000 },
+  { 0xAE72u, 0.00000000 },
+  { 0xAE73u, 0.00000000 },
+  { 0xAE74u, 0.00000000 },
+  { 0xAE75u, 0.00000000 },
+  { 0xAE76u, 0.00000000 },
+  { 0xAE77u, 0.00000000 },
+  { 0xAE78u, 0.00000000 },
+  { 0xAE79u, 0.00000000 },
+  { 0xAE7Au, 0.00000000 },
+  { 0xAE7Bu, 0.00000000 },
+  { 0xAE7Cu, 0.00000000 },
+  { 0xAE7Du, 0.00000000 },
+  { 0xAE7Eu, 0.00000000 },
+  { 0xAE7Fu, 0.00000000 },
+  { 0xAE80u, 0.00000000 },
+  { 0xAE81u, 0.00000000 },
+  { 0xAE82u, 0.00000000 },
+  { 0xAE83u, 0.00000000 },
+  { 0xAE84u, 0.00000000 },
+  { 0xAE85u, 0.00000000 },
+  { 0xAE86u, 0.00000000 },
+  { 0xAE87u, 0.00000000 },
+  { 0xAE88u, 0.00000000 },
+  { 0xAE89u, 0.00000000 },
+  { 0xAE8Au, 0.00000000 },
+  { 0xAE8Bu, 0.00000000 },
+  { 0xAE8Cu, 0.00000000 },
+  { 0xAE8Du, 0.00000000 },
+  { 0xAE8Eu, 0.00000000 },
+  { 0xAE8Fu, 0.00000000 },
+  { 0xAE90u, 0.00000000 },
+  { 0xAE91u, 0.00000000 },
+  { 0xAE92u, 0.00000000 },
+  { 0xAE93u, 0.00000000 },
+  { 0xAE94u, 0.00000000 },
+  { 0xAE95u, 0.00000000 },
+  { 0xAE96u, 0.00000000 },
+  { 0xAE97u, 0.00000000 },
+  { 0xAE98u, 0.00000000 },
+  { 0xAE99u, 0.00000000 },
+  { 0xAE9Au, 0.00000000 },
+  { 0xAE9Bu, 0.00000000 },
+  { 0xAE9Cu, 0.00000000 },
+  { 0xAE9Du, 0.00000000 },
+  { 0xAE9Eu, 0.00000000 },
+  { 0xAE9Fu, 0.00000000 },
+  { 0xAEA0u, 0.00000000 },
+  { 0xAEA1u, 0.00000000 },
+  { 0xAEA2u, 0.00000000 },
+  { 0xAEA3u, 0.00000000 },
+  { 0xAEA4u, 0.00000000 },
+  { 0xAEA5u, 0.00000000 },
+  { 0xAEA6u, 0.00000000 },
+  { 0xAEA7u, 0.00000000 },
+  { 0xAEA8u, 0.00000000 },
+  { 0xAEA9u, 0.00000000 },
+  { 0xAEAAu, 0.00000000 },
+  { 0xAEABu, 0.00000000 },
+  { 0xAEACu, 0.00000000 },
+  { 0xAEADu, 0.00000000 },
+  { 0xAEAEu, 0.00000000 },
+  { 0xAEAFu, 0.00000000 },
+  { 0xAEB0u, 0.00000000 },
+  { 0xAEB1u, 0.00000000 },
+  { 0xAEB2u, 0.00000000 },
+  { 0xAEB3u, 0.00000000 },
+  { 0xAEB4u, 0.00000000 },
+  { 0xAEB5u, 0.00000000 },
+  { 0xAEB6u, 0.00000000 },
+  { 0xAEB7u, 0.00000000 },
+  { 0xAEB8u, 0.00000000 },
+  { 0xAEB9u, 0.00000000 },
+  { 0xAEBAu, 0.00000000 },
+  { 0xAEBBu, 0.00000000 },
+  { 0xAEBCu, 0.00000000 },
+  { 0xAEBDu, 0.00000000 },
+  { 0xAEBEu, 0.00000000 },
+  { 0xAEBFu, 0.00000000 },
+  { 0xAEC0u, 0.00000000 },
+  { 0xAEC1u, 0.00000000 },
+  { 0xAEC2u, 0.00000000 },
+  { 0xAEC3u, 0.00000000 },
+  { 0xAEC4u, 0.00000000 },
+  { 0xAEC5u, 0.00000000 },
+  { 0xAEC6u, 0.00000000 },
+  { 0xAEC7u, 0.00000000 },
+  { 0xAEC8u, 0.00000000 },
+  { 0xAEC9u, 0.00000000 },
+  { 0xAECAu, 0.00000000 },
+  { 0xAECBu, 0.00000000 },
+  { 0xAECCu, 0.00000000 },
+  { 0xAECDu, 0.00000000 },
+  { 0xAECEu, 0.00000000 },
+  { 0xAECFu, 0.00000000 },
+  { 0xAED0u, 0.00000000 },
+  { 0xAED1u, 0.00000000 },
+  { 0xAED2u, 0.00000000 },
+  { 0xAED3u, 0.00000000 },
+  { 0xAED4u, 0.00000000 },
+  { 0xAED5u, 0.00000000 },
+  { 0xAED6u, 0.00000000 },
+  { 0xAED7u, 0.00000000 },
+  { 0xAED8u, 0.00050000 },
+  { 0xAED9u, 0.00000000 },
+  { 0xAEDAu, 0.00000000 },
+  { 0xAEDBu, 0.00000000 },
+  { 0xAEDCu, 0.00000000 },
+  { 0xAEDDu, 0.00000000 },
+  { 0xAEDEu, 0.00000000 },
+  { 0xAEDFu, 0.00000000 },
+  { 0xAEE0u, 0.00000000 },
+  { 0xAEE1u, 0.00000000 },
+  { 0xAEE2u, 0.00000000 },
+  { 0xAEE3u, 0.00000000 },
+  { 0xAEE4u, 0.00000000 },
+  { 0xAEE5u, 0.00000000 },
+  { 0xAEE6u, 0.00000000 },
+  { 0xAEE7u, 0.00000000 },
+  { 0xAEE8u, 0.00000000 },
+  { 0xAEE9u, 0.00000000 },
+  { 0xAEEAu, 0.00000000 },
+  { 0xAEEBu, 0.00000000 },
+  { 0xAEECu, 0.00000000 },
+  { 0xAEEDu, 0.00000000 },
+  { 0xAEEEu, 0.00000000 },
+  { 0xAEEFu, 0.00000000 },
+  { 0xAEF0u, 0.00000000 },
+  { 0xAEF1u, 0.00000000 },
+  { 0xAEF2u, 0.00000000 },
+  { 0xAEF3u, 0.00000000 },
+  { 0xAEF4u, 0.00000000 },
+  { 0xAEF5u, 0.00000000 },
+  { 0xAEF6u, 0.00000000 },
+  { 0xAEF7u, 0.00000000 },
+  { 0xAEF8u, 0.00000000 },
+  { 0xAEF9u, 0.00000000 },
+  { 0xAEFAu, 0.00000000 },
+  { 0xAEFBu, 0.00000000 },
+  { 0xAEFCu, 0.00000000 },
+  { 0xAEFDu, 0.00000000 },
+  { 0xAEFEu, 0.00000000 },
+  { 0xAEFFu, 0.00000000 },
+  { 0xAF00u, 0.00000000 },
+  { 0xAF01u, 0.00000000 },
+  { 0xAF02u, 0.00000000 },
+  { 0xAF03u, 0.00000000 },
+  { 0xAF04u, 0.00000000 },
+  { 0xAF05u, 0.00000000 },
+  { 0xAF06u, 0.00000000 },
+  { 0xAF07u, 0.00000000 },
+  { 0xAF08u, 0.00000000 },
+  { 0xAF09u, 0.00000000 },
+  { 0xAF0Au, 0.00000000 },
+  { 0xAF0Bu, 0.00000000 },
+  { 0xAF0Cu, 0.00000000 },
+  { 0xAF0Du, 0.00000000 },
+  { 0xAF0Eu, 0.00000000 },
+  { 0xAF0Fu, 0.00000000 },
+  { 0xAF10u, 0.00000000 },
+  { 0xAF11u, 0.00000000 },
+  { 0xAF12u, 0.00000000 },
+  { 0xAF13u, 0.00000000 },
+  { 0xAF14u, 0.00000000 },
+  { 0xAF15u, 0.00000000 },
+  { 0xAF16u, 0.00000000 },
+  { 0xAF17u, 0.00000000 },
+  { 0xAF18u, 0.00000000 },
+  { 0xAF19u, 0.00000000 },
+  { 0xAF1Au, 0.00000000 },
+  { 0xAF1Bu, 0.00000000 },
+  { 0xAF1Cu, 0.00000000 },
+  { 0xAF1Du, 0.00000000 },
+  { 0xAF1Eu, 0.00000000 },
+  { 0xAF1Fu, 0.00000000 },
+  { 0xAF20u, 0.00000000 },
+  { 0xAF21u, 0.00000000 },
+  { 0xAF22u, 0.00000000 },
+  { 0xAF23u, 0.00000000 },
+  { 0xAF24u, 0.00000000 },
+  { 0xAF25u, 0.00000000 },
+  { 0xAF26u, 0.00000000 },
+  { 0xAF27u, 0.00000000 },
+  { 0xAF28u, 0.00000000 },
+  { 0xAF29u, 0.00000000 },
+  { 0xAF2Au, 0.00000000 },
+  { 0xAF2Bu, 0.00000000 },
+  { 0xAF2Cu, 0.00000000 },
+  { 0xAF2Du, 0.00000000 },
+  { 0xAF2Eu, 0.00000000 },
+  { 0xAF2Fu, 0.00000000 },
+  { 0xAF30u, 0.00000000 },
+  { 0xAF31u, 0.00000000 },
+  { 0xAF32u, 0.00000000 },
+  { 0xAF33u, 0.00000000 },
+  { 0xAF34u, 0.00000000 },
+  { 0xAF35u, 0.00000000 },
+  { 0xAF36u, 0.00000000 },
+  { 0xAF37u, 0.00000000 },
+  { 0xAF38u, 0.00000000 },
+  { 0xAF39u, 0.00000000 },
+  { 0xAF3Au, 0.00000000 },
+  { 0xAF3Bu, 0.00000000 },
+  { 0xAF3Cu, 0.00000000 },
+  { 0xAF3Du, 0.00000000 },
+  { 0xAF3Eu, 0.00000000 },
+  { 0xAF3Fu, 0.00000000 },
+  { 0xAF40u, 0.00000000 },
+  { 0xAF41u, 0.00000000 },
+  { 0xAF42u, 0.00000000 },
+  { 0xAF43u, 0.00010000 },
+  { 0xAF44u, 0.00000000 },
+  { 0xAF45u, 0.00000000 },
+  { 0xAF46u, 0.00000000 },
+  { 0xAF47u, 0.00000000 },
+  { 0xAF48u, 0.00000000 },
+  { 0xAF49u, 0.00000000 },
+  { 0xAF4Au, 0.00000000 },
+  { 0xAF4Bu, 0.00000000 },
+  { 0xAF4Cu, 0.00000000 },
+  { 0xAF4Du, 0.00000000 },
+  { 0xAF4Eu, 0.00000000 },
+  { 0xAF4Fu, 0.00000000 },
+  { 0xAF50u, 0.00000000 },
+  { 0xAF51u, 0.00000000 },
+  { 0xAF52u, 0.00000000 },
+  { 0xAF53u, 0.00000000 },
+  { 0xAF54u, 0.00000000 },
+  { 0xAF55u, 0.00000000 },
+  { 0xAF56u, 0.00000000 },
+  { 0xAF57u, 0.00000000 },
+  { 0xAF58u, 0.00000000 },
+  { 0xAF59u, 0.00000000 },
+  { 0xAF5Au, 0.00000000 },
+  { 0xAF5Bu, 0.00000000 },
+  { 0xAF5Cu, 0.00000000 },
+  { 0xAF5Du, 0.00000000 },
+  { 0xAF5Eu, 0.00000000 },
+  { 0xAF5Fu, 0.00000000 },
+  { 0xAF60u, 0.00000000 },
+  { 0xAF61u, 0.00000000 },
+  { 0xAF62u, 0.00000000 },
+  { 0xAF63u, 0.00000000 },
+  { 0xAF64u, 0.00000000 },
+  { 0xAF65u, 0.00000000 },
+  { 0xAF66u, 0.00000000 },
+  { 0xAF67u, 0.00000000 },
+  { 0xAF68u, 0.00000000 },
+  { 0xAF69u, 0.00000000 },
+  { 0xAF6Au, 0.00000000 },
+  { 0xAF6Bu, 0.00000000 },
+  { 0xAF6Cu, 0.00000000 },
+  { 0xAF6Du, 0.00000000 },
+  { 0xAF6Eu, 0.00000000 },
+  { 0xAF6Fu, 0.00000000 },
+  { 0xAF70u, 0.00000000 },
+  { 0xAF71u, 0.00000000 },
+  { 0xAF72u, 0.00000000 },
+  { 0xAF73u, 0.00000000 },
+  { 0xAF74u, 0.00000000 },
+  { 0xAF75u, 0.00000000 },
+  { 0xAF76u, 0.00000000 },
+  { 0xAF77u, 0.00000000 },
+  { 0xAF78u, 0.00000000 },
+  { 0xAF79u, 0.00000000 },
+  { 0xAF7Au, 0.00000000 },
+  { 0xAF7Bu, 0.00000000 },
+  { 0xAF7Cu, 0.00000000 },
+  { 0xAF7Du, 0.00000000 },
+  { 0xAF7Eu, 0.00000000 },
+  { 0xAF7Fu, 0.00000000 },
+  { 0xAF80u, 0.00000000 },
+  { 0xAF81u, 0.00000000 },
+  { 0xAF82u, 0.00000000 },
+  { 0xAF83u, 0.00000000 },
+  { 0xAF84u, 0.00000000 },
+  { 0xAF85u, 0.00000000 },
+  { 0xAF86u, 0.00000000 },
+  { 0xAF87u, 0.00000000 },
+  { 0xAF88u, 0.00000000 },
+  { 0xAF89u, 0.00000000 },
+  { 0xAF8Au, 0.00000000 },
+  { 0xAF8Bu, 0.00000000 },
+  { 0xAF8Cu, 0.00000000 },
+  { 0xAF8Du, 0.00000000 },
+  { 0xAF8Eu, 0.00000000 },
+  { 0xAF8Fu, 0.00000000 },
+  { 0xAF90u, 0.00000000 },
+  { 0xAF91u, 0.00000000 },
+  { 0xAF92u, 0.00000000 },
+  { 0xAF93u, 0.00000000 },
+  { 0xAF94u, 0.00000000 },
+  { 0xAF95u, 0.00000000 },
+  { 0xAF96u, 0.00000000 },
+  { 0xAF97u, 0.00000000 },
+  { 0xAF98u, 0.00000000 },
+  { 0xAF99u, 0.00000000 },
+  { 0xAF9Au, 0.00000000 },
+  { 0xAF9Bu, 0.00000000 },
+  { 0xAF9Cu, 0.00000000 },
+  { 0xAF9Du, 0.00000000 },
+  { 0xAF9Eu, 0.00000000 },
+  { 0xAF9Fu, 0.00000000 },
+  { 0xAFA0u, 0.00000000 },
+  { 0xAFA1u, 0.00000000 },
+  { 0xAFA2u, 0.00000000 },
+  { 0xAFA3u, 0.00000000 },
+  { 0xAFA4u, 0.00000000 },
+  { 0xAFA5u, 0.00000000 },
+  { 0xAFA6u, 0.00000000 },
+  { 0xAFA7u, 0.00000000 },
+  { 0xAFA8u, 0.00000000 },
+  { 0xAFA9u, 0.00000000 },
+  { 0xAFAAu, 0.00000000 },
+  { 0xAFABu, 0.00000000 },
+  { 0xAFACu, 0.00000000 },
+  { 0xAFADu, 0.00000000 },
+  { 0xAFAEu, 0.00000000 },
+  { 0xAFAFu, 0.00000000 },
+  { 0xAFB0u, 0.00000000 },
+  { 0xAFB1u, 0.00000000 },
+  { 0xAFB2u, 0.00000000 },
+  { 0xAFB3u, 0.00000000 },
+  { 0xAFB4u, 0.00000000 },
+  { 0xAFB5u, 0.00000000 },
+  { 0xAFB6u, 0.00000000 },
+  { 0xAFB7u, 0.00000000 },
+  { 0xAFB8u, 0.00010000 },
+  { 0xAFB9u, 0.00000000 },
+  { 0xAFBAu, 0.00000000 },
+  { 0xAFBBu, 0.00000000 },
+  { 0xAFBCu, 0.00000000 },
+  { 0xAFBDu, 0.00000000 },
+  { 0xAFBEu, 0.00000000 },
+  { 0xAFBFu, 0.00000000 },
+  { 0xAFC0u, 0.00000000 },
+  { 0xAFC1u, 0.00000000 },
+  { 0xAFC2u, 0.00000000 },
+  { 0xAFC3u, 0.00000000 },
+  { 0xAFC4u, 0.00000000 },
+  { 0xAFC5u, 0.00000000 },
+  { 0xAFC6u, 0.00000000 },
+  { 0xAFC7u, 0.00000000 },
+  { 0xAFC8u, 0.00000000 },
+  { 0xAFC9u, 0.00000000 },
+  { 0xAFCAu, 0.00000000 },
+  { 0xAFCBu, 0.00000000 },
+  { 0xAFCCu, 0.00000000 },
+  { 0xAFCDu, 0.00000000 },
+  { 0xAFCEu, 0.00000000 },
+  { 0xAFCFu, 0.00000000 },
+  { 0xAFD0u, 0.00000000 },
+  { 0xAFD1u, 0.00000000 },
+  { 0xAFD2u, 0.00000000 },
+  { 0xAFD3u, 0.00000000 },
+  { 0xAFD4u, 0.00000000 },
+  { 0xAFD5u, 0.00000000 },
+  { 0xAFD6u, 0.00000000 },
+  { 0xAFD7u, 0.00000000 },
+  { 0xAFD8u, 0.00000000 },
+  { 0xAFD9u, 0.00000000 },
+  { 0xAFDAu, 0.00000000 },
+  { 0xAFDBu, 0.00000000 },
+  { 0xAFDCu, 0.00000000 },
+  { 0xAFDDu, 0.00000000 },
+  { 0xAFDEu, 0.00000000 },
+  { 0xAFDFu, 0.00000000 },
+  { 0xAFE0u, 0.00000000 },
+  { 0xAFE1u, 0.00000000 },
+  { 0xAFE2u, 0.00000000 },
+  { 0xAFE3u, 0.00000000 },
+  { 0xAFE4u, 0.00000000 },
+  { 0xAFE5u, 0.00000000 },
+  { 0xAFE6u, 0.00000000 },
+  { 0xAFE7u, 0.00000000 },
+  { 0xAFE8u, 0.00000000 },
+  { 0xAFE9u, 0.00000000 },
+  { 0xAFEAu, 0.00000000 },
+  { 0xAFEBu, 0.00000000 },
+  { 0xAFECu, 0.00000000 },
+  { 0xAFEDu, 0.00000000 },
+  { 0xAFEEu, 0.00000000 },
+  { 0xAFEFu, 0.00000000 },
+  { 0xAFF0u, 0.00000000 },
+  { 0xAFF1u, 0.00000000 },
+  { 0xAFF2u, 0.00000000 },
+  { 0xAFF3u, 0.00000000 },
+  { 0xAFF4u, 0.00000000 },
+  { 0xAFF5u, 0.00000000 },
+  { 0xAFF6u, 0.00000000 },
+  { 0xAFF7u, 0.00000000 },
+  { 0xAFF8u, 0.00000000 },
+  { 0xAFF9u, 0.00000000 },
+  { 0xAFFAu, 0.00000000 },
+  { 0xAFFBu, 0.00000000 },
+  { 0xAFFCu, 0.00000000 },
+  { 0xAFFDu, 0.00000000 },
+  { 0xAFFEu, 0.00000000 },
+  { 0xAFFFu, 0.00000000 },
+  { 0xB000u, 0.00000000 },
+  { 0xB001u, 0.00000000 },
+  { 0xB002u, 0.00000000 },
+  { 0xB003u, 0.00000000 },
+  { 0xB004u, 0.00000000 },
+  { 0xB005u, 0.00000000 },
+  { 0xB006u, 0.00000000 },
+  { 0xB007u, 0.00000000 },
+  { 0xB008u, 0.00000000 },
+  { 0xB009u, 0.00000000 },
+  { 0xB00Au, 0.00000000 },
+  { 0xB00Bu, 0.00000000 },
+  { 0xB00Cu, 0.00010000 },
+  { 0xB00Du, 0.00000000 },
+  { 0xB00Eu, 0.00000000 },
+  { 0xB00Fu, 0.00000000 },
+  { 0xB010u, 0.00000000 },
+  { 0xB011u, 0.00000000 },
+  { 0xB012u, 0.00000000 },
+  { 0xB013u, 0.00000000 },
+  { 0xB014u, 0.00000000 },
+  { 0xB015u, 0.00000000 },
+  { 0xB016u, 0.00000000 },
+  { 0xB017u, 0.00000000 },
+  { 0xB018u, 0.00000000 },
+  { 0xB019u, 0.00000000 },
+  { 0xB01Au, 0.00000000 },
+  { 0xB01Bu, 0.00000000 },
+  { 0xB01Cu, 0.00000000 },
+  { 0xB01Du, 0.00000000 },
+  { 0xB01Eu, 0.00000000 },
+  { 0xB01Fu, 0.00000000 },
+  { 0xB020u, 0.00000000 },
+  { 0xB021u, 0.00000000 },
+  { 0xB022u, 0.00000000 },
+  { 0xB023u, 0.00000000 },
+  { 0xB024u, 0.00000000 },
+  { 0xB025u, 0.00000000 },
+  { 0xB026u, 0.00000000 },
+  { 0xB027u, 0.00000000 },
+  { 0xB028u, 0.00000000 },
+  { 0xB029u, 0.00000000 },
+  { 0xB02Au, 0.00000000 },
+  { 0xB02Bu, 0.00000000 },
+  { 0xB02Cu, 0.00000000 },
+  { 0xB02Du, 0.00000000 },
+  { 0xB02Eu, 0.00000000 },
+  { 0xB02Fu, 0.00000000 },
+  { 0xB030u, 0.00000000 },
+  { 0xB031u, 0.00000000 },
+  { 0xB032u, 0.00000000 },
+  { 0xB033u, 0.00000000 },
+  { 0xB034u, 0.00000000 },
+  { 0xB035u, 0.00000000 },
+  { 0xB036u, 0.00000000 },
+  { 0xB037u, 0.00000000 },
+  { 0xB038u, 0.00000000 },
+  { 0xB039u, 0.00000000 },
+  { 0xB03Au, 0.00000000 },
+  { 0xB03Bu, 0.00000000 },
+  { 0xB03Cu, 0.00000000 },
+  { 0xB03Du, 0.00000000 },
+  { 0xB03Eu, 0.00000000 },
+  { 0xB03Fu, 0.00000000 },
+  { 0xB040u, 0.00000000 },
+  { 0xB041u, 0.00000000 },
+  { 0xB042u, 0.00000000 },
+  { 0xB043u, 0.00000000 },
+  { 0xB044u, 0.00010000 },
+  { 0xB045u, 0.00000000 },
+  { 0xB046u, 0.00000000 },
+  { 0xB047u, 0.00000000 },
+  { 0xB048u, 0.00000000 },
+  { 0xB049u, 0.00000000 },
+  { 0xB04Au, 0.00000000 },
+  { 0xB04Bu, 0.00000000 },
+  { 0xB04Cu, 0.00020000 },
+  { 0xB04Du, 0.00000000 },
+  { 0xB04Eu, 0.00000000 },
+  { 0xB04Fu, 0.00000000 },
+  { 0xB050u, 0.00000000 },
+  { 0xB051u, 0.00000000 },
+  { 0xB052u, 0.00000000 },
+  { 0xB053u, 0.00000000 },
+  { 0xB054u, 0.00000000 },
+  { 0xB055u, 0.00000000 },
+  { 0xB056u, 0.00000000 },
+  { 0xB057u, 0.00000000 },
+  { 0xB058u, 0.00000000 },
+  { 0xB059u, 0.00000000 },
+  { 0xB05Au, 0.00000000 },
+  { 0xB05Bu, 0.00000000 },
+  { 0xB05Cu, 0.00000000 },
+  { 0xB05Du, 0.00030000 },
+  { 0xB05Eu, 0.00000000 },
+  { 0xB05Fu, 0.00000000 },
+  { 0xB060u, 0.00000000 },
+  { 0xB061u, 0.00000000 },
+  { 0xB062u, 0.00000000 },
+  { 0xB063u, 0.00000000 },
+  { 0xB064u, 0.00000000 },
+  { 0xB065u, 0.00000000 },
+  { 0xB066u, 0.00000000 },
+  { 0xB067u, 0.00000000 },
+  { 0xB068u, 0.00000000 },
+  { 0xB069u, 0.00000000 },
+  { 0xB06Au, 0.00000000 },
+  { 0xB06Bu, 0.00000000 },
+  { 0xB06Cu, 0.00000000 },
+  { 0xB06Du, 0.00000000 },
+  { 0xB06Eu, 0.00000000 },
+  { 0xB06Fu, 0.00000000 },
+  { 0xB070u, 0.00000000 },
+  { 0xB071u, 0.00000000 },
+  { 0xB072u, 0.00000000 },
+  { 0xB073u, 0.00000000 },
+  { 0xB074u, 0.00000000 },
+  { 0xB075u, 0.00000000 },
+  { 0xB076u, 0.00000000 },
+  { 0xB077u, 0.00000000 },
+  { 0xB078u, 0.00000000 },
+  { 0xB079u, 0.00000000 },
+  { 0xB07Au, 0.00000000 },
+  { 0xB07Bu, 0.00000000 },
+  { 0xB07Cu, 0.00010000 },
+  { 0xB07Du, 0.00000000 },
+  { 0xB07Eu, 0.00000000 },
+  { 0xB07Fu, 0.00000000 },
+  { 0xB080u, 0.00000000 },
+  { 0xB081u, 0.00000000 },
+  { 0xB082u, 0.00000000 },
+  { 0xB083u, 0.00000000 },
+  { 0xB084u, 0.00000000 },
+  { 0xB085u, 0.00000000 },
+  { 0xB086u, 0.00000000 },
+  { 0xB087u, 0.00000000 },
+  { 0xB088u, 0.00000000 },
+  { 0xB089u, 0.00000000 },
+  { 0xB08Au, 0.00000000 },
+  { 0xB08Bu, 0.00000000 },
+  { 0xB08Cu, 0.00000000 },
+  { 0xB08Du, 0.00000000 },
+  { 0xB08Eu, 0.00000000 },
+  { 0xB08Fu, 0.00000000 },
+  { 0xB090u, 0.00000000 },
+  { 0xB091u, 0.00000000 },
+  { 0xB092u, 0.00000000 },
+  { 0xB093u, 0.00000000 },
+  { 0xB094u, 0.00000000 },
+  { 0xB095u, 0.00000000 },
+  { 0xB096u, 0.00000000 },
+  { 0xB097u, 0.00000000 },
+  { 0xB098u, 0.00660000 },
+  { 0xB099u, 0.00010000 },
+  { 0xB09Au, 0.00000000 },
+  { 0xB09Bu, 0.00000000 },
+  { 0xB09Cu, 0.00070000 },
+  { 0xB09Du, 0.00000000 },
+  { 0xB09Eu, 0.00000000 },
+  { 0xB09Fu, 0.00000000 },
+  { 0xB0A0u, 0.00050000 },
+  { 0xB0A1u, 0.00000000 },
+  { 0xB0A2u, 0.00000000 },
+  { 0xB0A3u, 0.00000000 },
+  { 0xB0A4u, 0.00000000 },
+  { 0xB0A5u, 0.00000000 },
+  { 0xB0A6u, 0.00000000 },
+  { 0xB0A7u, 0.00000000 },
+  { 0xB0A8u, 0.00170000 },
+  { 0xB0A9u, 0.00010000 },
+  { 0xB0AAu, 0.00000000 },
+  { 0xB0ABu, 0.00000000 },
+  { 0xB0ACu, 0.00030000 },
+  { 0xB0ADu, 0.00000000 },
+  { 0xB0AEu, 0.00010000 },
+  { 0xB0AFu, 0.00000000 },
+  { 0xB0B0u, 0.00000000 },
+  { 0xB0B1u, 0.00000000 },
+  { 0xB0B2u, 0.00000000 },
+  { 0xB0B3u, 0.00010000 },
+  { 0xB0B4u, 0.00190000 },
+  { 0xB0B5u, 0.00000000 },
+  { 0xB0B6u, 0.00000000 },
+  { 0xB0B7u, 0.00000000 },
+  { 0xB0B8u, 0.00020000 },
+  { 0xB0B9u, 0.00000000 },
+  { 0xB0BAu, 0.00000000 },
+  { 0xB0BBu, 0.00000000 },
+  { 0xB0BCu, 0.00000000 },
+  { 0xB0BDu, 0.00000000 },
+  { 0xB0BEu, 0.00000000 },
+  { 0xB0BFu, 0.00000000 },
+  { 0xB0C0u, 0.00000000 },
+  { 0xB0C1u, 0.00000000 },
+  { 0xB0C2u, 0.00000000 },
+  { 0xB0C3u, 0.00000000 },
+  { 0xB0C4u, 0.00000000 },
+  { 0xB0C5u, 0.00000000 },
+  { 0xB0C6u, 0.00000000 },
+  { 0xB0C7u, 0.00000000 },
+  { 0xB0C8u, 0.00020000 },
+  { 0xB0C9u, 0.00000000 },
+  { 0xB0CAu, 0.00000000 },
+  { 0xB0CBu, 0.00000000 },
+  { 0xB0CCu, 0.00000000 },
+  { 0xB0CDu, 0.00000000 },
+  { 0xB0CEu, 0.00000000 },
+  { 0xB0CFu, 0.00000000 },
+  { 0xB0D0u, 0.00010000 },
+  { 0xB0D1u, 0.00000000 },
+  { 0xB0D2u, 0.00000000 },
+  { 0xB0D3u, 0.00000000 },
+  { 0xB0D4u, 0.00000000 },
+  { 0xB0D5u, 0.00000000 },
+  { 0xB0D6u, 0.00000000 },
+  { 0xB0D7u, 0.00000000 },
+  { 0xB0D8u, 0.00000000 },
+  { 0xB0D9u, 0.00000000 },
+  { 0xB0DAu, 0.00000000 },
+  { 0xB0DBu, 0.00000000 },
+  { 0xB0DCu, 0.00000000 },
+  { 0xB0DDu, 0.00000000 },
+  { 0xB0DEu, 0.00000000 },
+  { 0xB0DFu, 0.00000000 },
+  { 0xB0E0u, 0.00000000 },
+  { 0xB0E1u, 0.00000000 },
+  { 0xB0E2u, 0.00000000 },
+  { 0xB0E3u, 0.00000000 },
+  { 0xB0E4u, 0.00000000 },
+  { 0xB0E5u, 0.00000000 },
+  { 0xB0E6u, 0.00000000 },
+  { 0xB0E7u, 0.00000000 },
+  { 0xB0E8u, 0.00000000 },
+  { 0xB0E9u, 0.00000000 },
+  { 0xB0EAu, 0.00000000 },
+  { 0xB0EBu, 0.00000000 },
+  { 0xB0ECu, 0.00000000 },
+  { 0xB0EDu, 0.00000000 },
+  { 0xB0EEu, 0.00000000 },
+  { 0xB0EFu, 0.00000000 },
+  { 0xB0F0u, 0.00000000 },
+  { 0xB0F1u, 0.00000000 },
+  { 0xB0F2u, 0.00000000 },
+  { 0xB0F3u, 0.00000000 },
+  { 0xB0F4u, 0.00000000 },
+  { 0xB0F5u, 0.00000000 },
+  { 0xB0F6u, 0.00000000 },
+  { 0xB0F7u, 0.00000000 },
+  { 0xB0F8u, 0.00000000 },
+  { 0xB0F9u, 0.00000000 },
+  { 0xB0FAu, 0.00000000 },
+  { 0xB0FBu, 0.00000000 },
+  { 0xB0FCu, 0.00000000 },
+  { 0xB0FDu, 0.00000000 },
+  { 0xB0FEu, 0.00000000 },
+  { 0xB0FFu, 0.00000000 },
+  { 0xB100u, 0.00000000 },
+  { 0xB101u, 0.00000000 },
+  { 0xB102u, 0.00000000 },
+  { 0xB103u, 0.00000000 },
+  { 0xB104u, 0.00000000 },
+  { 0xB105u, 0.00000000 },
+  { 0xB106u, 0.00000000 },
+  { 0xB107u, 0.00000000 },
+  { 0xB108u, 0.00040000 },
+  { 0xB109u, 0.00000000 },
+  { 0xB10Au, 0.00000000 },
+  { 0xB10Bu, 0.00000000 },
+  { 0xB10Cu, 0.00000000 },
+  { 0xB10Du, 0.00000000 },
+  { 0xB10Eu, 0.00000000 },
+  { 0xB10Fu, 0.00000000 },
+  { 0xB110u, 0.00030000 },
+  { 0xB111u, 0.00000000 },
+  { 0xB112u, 0.00000000 },
+  { 0xB113u, 0.00010000 },
+  { 0xB114u, 0.00000000 },
+  { 0xB115u, 0.00000000 },
+  { 0xB116u, 0.00000000 },
+  { 0xB117u, 0.00000000 },
+  { 0xB118u, 0.00020000 },
+  { 0xB119u, 0.00000000 },
+  { 0xB11Au, 0.00000000 },
+  { 0xB11Bu, 0.00000000 },
+  { 0xB11Cu, 0.00000000 },
+  { 0xB11Du, 0.00000000 },
+  { 0xB11Eu, 0.00000000 },
+  { 0xB11Fu, 0.00000000 },
+  { 0xB120u, 0.00000000 },
+  { 0xB121u, 0.00000000 },
+  { 0xB122u, 0.00000000 },
+  { 0xB123u, 0.00010000 },
+  { 0xB124u, 0.00080000 },
+  { 0xB125u, 0.00000000 },
+  { 0xB126u, 0.00000000 },
+  { 0xB127u, 0.00000000 },
+  { 0xB128u, 0.00000000 },
+  { 0xB129u, 0.00000000 },
+  { 0xB12Au, 0.00000000 },
+  { 0xB12Bu, 0.00000000 },
+  { 0xB12Cu, 0.00000000 },
+  { 0xB12Du, 0.00000000 },
+  { 0xB12Eu, 0.00000000 },
+  { 0xB12Fu, 0.00000000 },
+  { 0xB130u, 0.00000000 },
+  { 0xB131u, 0.00000000 },
+  { 0xB132u, 0.00000000 },
+  { 0xB133u, 0.00000000 },
+  { 0xB134u, 0.00000000 },
+  { 0xB135u, 0.00000000 },
+  { 0xB136u, 0.00000000 },
+  { 0xB137u, 0.00010000 },
+  { 0xB138u, 0.00000000 },
+  { 0xB139u, 0.00000000 },
+  { 0xB13Au, 0.00000000 },
+  { 0xB13Bu, 0.00000000 },
+  { 0xB13Cu, 0.00000000 },
+  { 0xB13Du, 0.00000000 },
+  { 0xB13Eu, 0.00000000 },
+  { 0xB13Fu, 0.00000000 },
+  { 0xB140u, 0.00040000 },
+  { 0xB141u, 0.00000000 },
+  { 0xB142u, 0.00000000 },
+  { 0xB143u, 0.00000000 },
+  { 0xB144u, 0.00990000 },
+  { 0xB145u, 0.00000000 },
+  { 0xB146u, 0.00000000 },
+  { 0xB147u, 0.00000000 },
+  { 0xB148u, 0.00000000 },
+  { 0xB149u, 0.00000000 },
+  { 0xB14Au, 0.00000000 },
+  { 0xB14Bu, 0.00000000 },
+  { 0xB14Cu, 0.00000000 },
+  { 0xB14Du, 0.00000000 },
+  { 0xB14Eu, 0.00000000 },
+  { 0xB14Fu, 0.00000000 },
+  { 0xB150u, 0.00020000 },
+  { 0xB151u, 0.00000000 },
+  { 0xB152u, 0.00000000 },
+  { 0xB153u, 0.00000000 },
+  { 0xB154u, 0.00000000 },
+  { 0xB155u, 0.00000000 },
+  { 0xB156u, 0.00000000 },
+  { 0xB157u, 0.00000000 },
+  { 0xB158u, 0.00000000 },
+  { 0xB159u, 0.00000000 },
+  { 0xB15Au, 0.00000000 },
+  { 0xB15Bu, 0.00000000 },
+  { 0xB15Cu, 0.00000000 },
+  { 0xB15Du, 0.00000000 },
+  { 0xB15Eu, 0.00000000 },
+  { 0xB15Fu, 0.00000000 },
+  { 0xB160u, 0.00000000 },
+  { 0xB161u, 0.00000000 },
+  { 0xB162u, 0.00000000 },
+  { 0xB163u, 0.00000000 },
+  { 0xB164u, 0.00000000 },
+  { 0xB165u, 0.00000000 },
+  { 0xB166u, 0.00000000 },
+  { 0xB167u, 0.00000000 },
+  { 0xB168u, 0.00000000 },
+  { 0xB169u, 0.00000000 },
+  { 0xB16Au, 0.00000000 },
+  { 0xB16Bu, 0.00000000 },
+  { 0xB16Cu, 0.00000000 },
+  { 0xB16Du, 0.00000000 },
+  { 0xB16Eu, 0.00000000 },
+  { 0xB16Fu, 0.00000000 },
+  { 0xB170u, 0.00000000 },
+  { 0xB171u, 0.00000000 },
+  { 0xB172u, 0.00000000 },
+  { 0xB173u, 0.00000000 },
+  { 0xB174u, 0.00000000 },
+  { 0xB175u, 0.00000000 },
+  { 0xB176u, 0.00000000 },
+  { 0xB177u, 0.00000000 },
+  { 0xB178u, 0.00170000 },
+  { 0xB179u, 0.00010000 },
+  { 0xB17Au, 0.00000000 },
+  { 0xB17Bu, 0.00000000 },
+  { 0xB17Cu, 0.00030000 },
+  { 0xB17Du, 0.00000000 },
+  { 0xB17Eu, 0.00000000 },
+  { 0xB17Fu, 0.00000000 },
+  { 0xB180u, 0.00010000 },
+  { 0xB181u, 0.00000000 },
+  { 0xB182u, 0.00000000 },
+  { 0xB183u, 0.00000000 },
+  { 0xB184u, 0.00000000 },
+  { 0xB185u, 0.00000000 },
+  { 0xB186u, 0.00000000 },
+  { 0xB187u, 0.00000000 },
+  { 0xB188u, 0.00000000 },
+  { 0xB189u, 0.00000000 },
+  { 0xB18Au, 0.00000000 },
+  { 0xB18Bu, 0.00000000 },
+  { 0xB18Cu, 0.00000000 },
+  { 0xB18Du, 0.00030000 },
+  { 0xB18Eu, 0.00000000 },
+  { 0xB18Fu, 0.00000000 },
+  { 0xB190u, 0.00000000 },
+  { 0xB191u, 0.00000000 },
+  { 0xB192u, 0.00030000 },
+  { 0xB193u, 0.00020000 },
+  { 0xB194u, 0.00000000 },
+  { 0xB195u, 0.00000000 },
+  { 0xB196u, 0.00000000 },
+  { 0xB197u, 0.00000000 },
+  { 0xB198u, 0.00000000 },
+  { 0xB199u, 0.00000000 },
+  { 0xB19Au, 0.00000000 },
+  { 0xB19Bu, 0.00000000 },
+  { 0xB19Cu, 0.00000000 },
+  { 0xB19Du, 0.00000000 },
+  { 0xB19Eu, 0.00000000 },
+  { 0xB19Fu, 0.00000000 },
+  { 0xB1A0u, 0.00000000 },
+  { 0xB1A1u, 0.00000000 },
+  { 0xB1A2u, 0.00000000 },
+  { 0xB1A3u, 0.00000000 },
+  { 0xB1A4u, 0.00000000 },
+  { 0xB1A5u, 0.00000000 },
+  { 0xB1A6u, 0.00000000 },
+  { 0xB1A7u, 0.00000000 },
+  { 0xB1A8u, 0.00000000 },
+  { 0xB1A9u, 0.00000000 },
+  { 0xB1AAu, 0.00000000 },
+  { 0xB1ABu, 0.00000000 },
+  { 0xB1ACu, 0.00000000 },
+  { 0xB1ADu, 0.00000000 },
+  { 0xB1AEu, 0.00000000 },
+  { 0xB1AFu, 0.00000000 },
+  { 0xB1B0u, 0.00000000 },
+  { 0xB1B1u, 0.00000000 },
+  { 0xB1B2u, 0.00000000 },
+  { 0xB1B3u, 0.00000000 },
+  { 0xB1B4u, 0.00000000 },
+  { 0xB1B5u, 0.00000000 },
+  { 0xB1B6u, 0.00000000 },
+  { 0xB1B7u, 0.00000000 },
+  { 0xB1B8u, 0.00000000 },
+  { 0xB1B9u, 0.00000000 },
+  { 0xB1BAu, 0.00000000 },
+  { 0xB1BBu, 0.00000000 },
+  { 0xB1BCu, 0.00000000 },
+  { 0xB1BDu, 0.00000000 },
+  { 0xB1BEu, 0.00000000 },
+  { 0xB1BFu, 0.00000000 },
+  { 0xB1C0u, 0.00000000 },
+  { 0xB1C1u, 0.00000000 },
+  { 0xB1C2u, 0.00000000 },
+  { 0xB1C3u, 0.00000000 },
+  { 0xB1C4u, 0.00000000 },
+  { 0xB1C5u, 0.00000000 },
+  { 0xB1C6u, 0.00000000 },
+  { 0xB1C7u, 0.00000000 },
+  { 0xB1C8u, 0.00000000 },
+  { 0xB1C9u, 0.00000000 },
+  { 0xB1CAu, 0.00000000 },
+  { 0xB1CBu, 0.00000000 },
+  { 0xB1CCu, 0.00010000 },
+  { 0xB1CDu, 0.00000000 },
+  { 0xB1CEu, 0.00000000 },
+  { 0xB1CFu, 0.00000000 },
+  { 0xB1D0u, 0.00000000 },
+  { 0xB1D1u, 0.00000000 },
+  { 0xB1D2u, 0.00000000 },
+  { 0xB1D3u, 0.00000000 },
+  { 0xB1D4u, 0.00000000 },
+  { 0xB1D5u, 0.00000000 },
+  { 0xB1D6u, 0.00000000 },
+  { 0xB1D7u, 0.00000000 },
+  { 0xB1D8u, 0.00000000 },
+  { 0xB1D9u, 0.00000000 },
+  { 0xB1DAu, 0.00000000 },
+  { 0xB1DBu, 0.00000000 },
+  { 0xB1DCu, 0.00000000 },
+  { 0xB1DDu, 0.00000000 },
+  { 0xB1DEu, 0.00000000 },
+  { 0xB1DFu, 0.00000000 },
+  { 0xB1E0u, 0.00000000 },
+  { 0xB1E1u, 0.00000000 },
+  { 0xB1E2u, 0.00000000 },
+  { 0xB1E3u, 0.00000000 },
+  { 0xB1E4u, 0.00000000 },
+  { 0xB1E5u, 0.00000000 },
+  { 0xB1E6u, 0.00000000 },
+  { 0xB1E7u, 0.00000000 },
+  { 0xB1E8u, 0.00000000 },
+  { 0xB1E9u, 0.00000000 },
+  { 0xB1EAu, 0.00000000 },
+  { 0xB1EBu, 0.00000000 },
+  { 0xB1ECu, 0.00000000 },
+  { 0xB1EDu, 0.00000000 },
+  { 0xB1EEu, 0.00000000 },
+  { 0xB1EFu, 0.00000000 },
+  { 0xB1F0u, 0.00000000 },
+  { 0xB1F1u, 0.00000000 },
+  { 0xB1F2u, 0.00000000 },
+  { 0xB1F3u, 0.00000000 },
+  { 0xB1F4u, 0.00000000 },
+  { 0xB1F5u, 0.00000000 },
+  { 0xB1F6u, 0.00000000 },
+  { 0xB1F7u, 0.00000000 },
+  { 0xB1F8u, 0.00000000 },
+  { 0xB1F9u, 0.00000000 },
+  { 0xB1FAu, 0.00000000 },
+  { 0xB1FBu, 0.00000000 },
+  { 0xB1FCu, 0.00000000 },
+  { 0xB1FDu, 0.00000000 },
+  { 0xB1FEu, 0.00000000 },
+  { 0xB1FFu, 0.00000000 },
+  { 0xB200u, 0.00000000 },
+  { 0xB201u, 0.00000000 },
+  { 0xB202u, 0.00000000 },
+  { 0xB203u, 0.00000000 },
+  { 0xB204u, 0.00030000 },
+  { 0xB205u, 0.00000000 },
+  { 0xB206u, 0.00000000 },
+  { 0xB207u, 0.00000000 },
+  { 0xB208u, 0.00010000 },
+  { 0xB209u, 0.00000000 },
+  { 0xB20Au, 0.00000000 },
+  { 0xB20Bu, 0.00000000 },
+  { 0xB20Cu, 0.00000000 },
+  { 0xB20Du, 0.00000000 },
+  { 0xB20Eu, 0.00000000 },
+  { 0xB20Fu, 0.00000000 },
+  { 0xB210u, 0.00000000 },
+  { 0xB211u, 0.00000000 },
+  { 0xB212u, 0.00000000 },
+  { 0xB213u, 0.00000000 },
+  { 0xB214u, 0.00000000 },
+  { 0xB215u, 0.00000000 },
+  { 0xB216u, 0.00000000 },
+  { 0xB217u, 0.00000000 },
+  { 0xB218u, 0.00000000 },
+  { 0xB219u, 0.00000000 },
+  { 0xB21Au, 0.00000000 },
+  { 0xB21Bu, 0.00000000 },
+  { 0xB21Cu, 0.00000000 },
+  { 0xB21Du, 0.00000000 },
+  { 0xB21Eu, 0.00000000 },
+  { 0xB21Fu, 0.00000000 },
+  { 0xB220u, 0.00000000 },
+  { 0xB221u, 0.00000000 },
+  { 0xB222u, 0.00000000 },
+  { 0xB223u, 0.00000000 },
+  { 0xB224u, 0.00000000 },
+  { 0xB225u, 0.00000000 },
+  { 0xB226u, 0.00000000 },
+  { 0xB227u, 0.00000000 },
+  { 0xB228u, 0.00000000 },
+  { 0xB229u, 0.00000000 },
+  { 0xB22Au, 0.00000000 },
+  { 0xB22Bu, 0.00000000 },
+  { 0xB22Cu, 0.00000000 },
+  { 0xB22Du, 0.00000000 },
+  { 0xB22Eu, 0.00000000 },
+  { 0xB22Fu, 0.00000000 },
+  { 0xB230u, 0.00000000 },
+  { 0xB231u, 0.00000000 },
+  { 0xB232u, 0.00000000 },
+  { 0xB233u, 0.00000000 },
+  { 0xB234u, 0.00000000 },
+  { 0xB235u, 0.00000000 },
+  { 0xB236u, 0.00000000 },
+  { 0xB237u, 0.00000000 },
+  { 0xB238u, 0.00000000 },
+  { 0xB239u, 0.00000000 },
+  { 0xB23Au, 0.00000000 },
+  { 0xB23Bu, 0.00000000 },
+  { 0xB23Cu, 0.00000000 },
+  { 0xB23Du, 0.00000000 },
+  { 0xB23Eu, 0.00000000 },
+  { 0xB23Fu, 0.00000000 },
+  { 0xB240u, 0.00000000 },
+  { 0xB241u, 0.00000000 },
+  { 0xB242u, 0.00000000 },
+  { 0xB243u, 0.00000000 },
+  { 0xB244u, 0.00000000 },
+  { 0xB245u, 0.00000000 },
+  { 0xB246u, 0.00000000 },
+  { 0xB247u, 0.00000000 },
+  { 0xB248u, 0.00000000 },
+  { 0xB249u, 0.00000000 },
+  { 0xB24Au, 0.00000000 },
+  { 0xB24Bu, 0.00000000 },
+  { 0xB24Cu, 0.00000000 },
+  { 0xB24Du, 0.00000000 },
+  { 0xB24Eu, 0.00000000 },
+  { 0xB24Fu, 0.00000000 },
+  { 0xB250u, 0.00000000 },
+  { 0xB251u, 0.00000000 },
+  { 0xB252u, 0.00000000 },
+  { 0xB253u, 0.00000000 },
+  { 0xB254u, 0.00000000 },
+  { 0xB255u, 0.00000000 },
+  { 0xB256u, 0.00000000 },
+  { 0xB257u, 0.00000000 },
+  { 0xB258u, 0.00010000 },
+  { 0xB259u, 0.00000000 },
+  { 0xB25Au, 0.00000000 },
+  { 0xB25Bu, 0.00000000 },
+  { 0xB25Cu, 0.00000000 },
+  { 0xB25Du, 0.00000000 },
+  { 0xB25Eu, 0.00000000 },
+  { 0xB25Fu, 0.00000000 },
+  { 0xB260u, 0.00000000 },
+  { 0xB261u, 0.00000000 },
+  { 0xB262u, 0.00000000 },
+  { 0xB263u, 0.00000000 },
+  { 0xB264u, 0.00000000 },
+  { 0xB265u, 0.00000000 },
+  { 0xB266u, 0.00000000 },
+  { 0xB267u, 0.00000000 },
+  { 0xB268u, 0.00000000 },
+  { 0xB269u, 0.00000000 },
+  { 0xB26Au, 0.00000000 },
+  { 0xB26Bu, 0.00000000 },
+  { 0xB26Cu, 0.00000000 },
+  { 0xB26Du, 0.00000000 },
+  { 0xB26Eu, 0.00000000 },
+  { 0xB26Fu, 0.00000000 },
+  { 0xB270u, 0.00000000 },
+  { 0xB271u, 0.00000000 },
+  { 0xB272u, 0.00000000 },
+  { 0xB273u, 0.00000000 },
+  { 0xB274u, 0.00030000 },
+  { 0xB275u, 0.00000000 },
+  { 0xB276u, 0.00000000 },
+  { 0xB277u, 0.00000000 },
+  { 0xB278u, 0.00000000 },
+  { 0xB279u, 0.00000000 },
+  { 0xB27Au, 0.00000000 },
+  { 0xB27Bu, 0.00000000 },
+  { 0xB27Cu, 0.00000000 },
+  { 0xB27Du, 0.00000000 },
+  { 0xB27Eu, 0.00000000 },
+  { 0xB27Fu, 0.00000000 },
+  { 0xB280u, 0.00000000 },
+  { 0xB281u, 0.00000000 },
+  { 0xB282u, 0.00000000 },
+  { 0xB283u, 0.00000000 },
+  { 0xB284u, 0.00000000 },
+  { 0xB285u, 0.00000000 },
+  { 0xB286u, 0.00000000 },
+  { 0xB287u, 0.00000000 },
+  { 0xB288u, 0.00000000 },
+  { 0xB289u, 0.00000000 },
+  { 0xB28Au, 0.00000000 },
+  { 0xB28Bu, 0.00000000 },
+  { 0xB28Cu, 0.00000000 },
+  { 0xB28Du, 0.00000000 },
+  { 0xB28Eu, 0.00000000 },
+  { 0xB28Fu, 0.00000000 },
+  { 0xB290u, 0.00020000 },
+  { 0xB291u, 0.00000000 },
+  { 0xB292u, 0.00000000 },
+  { 0xB293u, 0.00000000 },
+  { 0xB294u, 0.02220000 },
+  { 0xB295u, 0.00000000 },
+  { 0xB296u, 0.00000000 },
+  { 0xB297u, 0.00000000 },
+  { 0xB298u, 0.00020000 },
+  { 0xB299u, 0.00000000 },
+  { 0xB29Au, 0.00000000 },
+  { 0xB29Bu, 0.00000000 },
+  { 0xB29Cu, 0.00000000 },
+  { 0xB29Du, 0.00000000 },
+  { 0xB29Eu, 0.00000000 },
+  { 0xB29Fu, 0.00000000 },
+  { 0xB2A0u, 0.00000000 },
+  { 0xB2A1u, 0.00000000 },
+  { 0xB2A2u, 0.00000000 },
+  { 0xB2A3u, 0.00000000 },
+  { 0xB2A4u, 0.00000000 },
+  { 0xB2A5u, 0.00070000 },
+  { 0xB2A6u, 0.00000000 },
+  { 0xB2A7u, 0.00000000 },
+  { 0xB2A8u, 0.00000000 },
+  { 0xB2A9u, 0.00000000 },
+  { 0xB2AAu, 0.00000000 },
+  { 0xB2ABu, 0.00000000 },
+  { 0xB2ACu, 0.00000000 },
+  { 0xB2ADu, 0.00000000 },
+  { 0xB2AEu, 0.00000000 },
+  { 0xB2AFu, 0.00000000 },
+  { 0xB2B0u, 0.00000000 },
+  { 0xB2B1u, 0.00000000 },
+  { 0xB2B2u, 0.00000000 },
+  { 0xB2B3u, 0.00000000 },
+  { 0xB2B4u, 0.00000000 },
+  { 0xB2B5u, 0.00000000 },
+  { 0xB2B6u, 0.00000000 },
+  { 0xB2B7u, 0.00000000 },
+  { 0xB2B8u, 0.00000000 },
+  { 0xB2B9u, 0.00000000 },
+  { 0xB2BAu, 0.00000000 },
+  { 0xB2BBu, 0.00000000 },
+  { 0xB2BCu, 0.00000000 },
+  { 0xB2BDu, 0.00000000 },
+  { 0xB2BEu, 0.00000000 },
+  { 0xB2BFu, 0.00000000 },
+  { 0xB2C0u, 0.00000000 },
+  { 0xB2C1u, 0.00000000 },
+  { 0xB2C2u, 0.00000000 },
+  { 0xB2C3u, 0.00000000 },
+  { 0xB2C4u, 0.00000000 },
+  { 0xB2C5u, 0.00000000 },
+  { 0xB2C6u, 0.00000000 },
+  { 0xB2C7u, 0.00000000 },
+  { 0xB2C8u, 0.00200000 },
+  { 0xB2C9u, 0.00010000 },
+  { 0xB2CAu, 0.00000000 },
+  { 0xB2CBu, 0.00000000 },
+  { 0xB2CCu, 0.00020000 },
+  { 0xB2CDu, 0.00000000 },
+  { 0xB2CEu, 0.00000000 },
+  { 0xB2CFu, 0.00000000 },
+  { 0xB2D0u, 0.00000000 },
+  { 0xB2D1u, 0.00000000 },
+  { 0xB2D2u, 0.00000000 },
+  { 0xB2D3u, 0.00000000 },
+  { 0xB2D4u, 0.00000000 },
+  { 0xB2D5u, 0.00000000 },
+  { 0xB2D6u, 0.00000000 },
+  { 0xB2D7u, 0.00000000 },
+  { 0xB2D8u, 0.00010000 },
+  { 0xB2D9u, 0.00000000 },
+  { 0xB2DAu, 0.00000000 },
+  { 0xB2DBu, 0.00000000 },
+  { 0xB2DCu, 0.00000000 },
+  { 0xB2DDu, 0.00010000 },
+  { 0xB2DEu, 0.00000000 },
+  { 0xB2DFu, 0.00000000 },
+  { 0xB2E0u, 0.00000000 },
+  { 0xB2E1u, 0.00000000 },
+  { 0xB2E2u, 0.00000000 },
+  { 0xB2E3u, 0.00000000 },
+  { 0xB2E4u, 0.03000000 },
+  { 0xB2E5u, 0.00010000 },
+  { 0xB2E6u, 0.00000000 },
+  { 0xB2E7u, 0.00000000 },
+  { 0xB2E8u, 0.00220000 },
+  { 0xB2E9u, 0.00000000 },
+  { 0xB2EAu, 0.00000000 },
+  { 0xB2EBu, 0.00000000 },
+  { 0xB2ECu, 0.00090000 },
+  { 0xB2EDu, 0.00000000 },
+  { 0xB2EEu, 0.00000000 },
+  { 0xB2EFu, 0.00000000 },
+  { 0xB2F0u, 0.00000000 },
+  { 0xB2F1u, 0.00000000 },
+  { 0xB2F2u, 0.00000000 },
+  { 0xB2F3u, 0.00000000 },
+  { 0xB2F4u, 0.00040000 },
+  { 0xB2F5u, 0.00010000 },
+  { 0xB2F6u, 0.00000000 },
+  { 0xB2F7u, 0.00000000 },
+  { 0xB2F8u, 0.00000000 },
+  { 0xB2F9u, 0.00230000 },
+  { 0xB2FAu, 0.00000000 },
+  { 0xB2FBu, 0.00000000 },
+  { 0xB2FCu, 0.00000000 },
+  { 0xB2FDu, 0.00000000 },
+  { 0xB2FEu, 0.00000000 },
+  { 0xB2FFu, 0.00000000 },
+  { 0xB300u, 0.00960000 },
+  { 0xB301u, 0.00000000 },
+  { 0xB302u, 0.00000000 },
+  { 0xB303u, 0.00000000 },
+  { 0xB304u, 0.00000000 },
+  { 0xB305u, 0.00000000 },
+  { 0xB306u, 0.00000000 },
+  { 0xB307u, 0.00000000 },
+  { 0xB308u, 0.00000000 },
+  { 0xB309u, 0.00000000 },
+  { 0xB30Au, 0.00000000 },
+  { 0xB30Bu, 0.00000000 },
+  { 0xB30Cu, 0.00000000 },
+  { 0xB30Du, 0.00000000 },
+  { 0xB30Eu, 0.00000000 },
+  { 0xB30Fu, 0.00000000 },
+  { 0xB310u, 0.00000000 },
+  { 0xB311u, 0.00000000 },
+  { 0xB312u, 0.00000000 },
+  { 0xB313u, 0.00000000 },
+  { 0xB314u, 0.00000000 },
+  { 0xB315u, 0.00000000 },
+  { 0xB316u, 0.00000000 },
+  { 0xB317u, 0.00000000 },
+  { 0xB318u, 0.00000000 },
+  { 0xB319u, 0.00000000 },
+  { 0xB31Au, 0.00000000 },
+  { 0xB31Bu, 0.00000000 },
+  { 0xB31Cu, 0.00000000 },
+  { 0xB31Du, 0.00000000 },
+  { 0xB31Eu, 0.00000000 },
+  { 0xB31Fu, 0.00000000 },
+  { 0xB320u, 0.00000000 },
+  { 0xB321u, 0.00000000 },
+  { 0xB322u, 0.00000000 },
+  { 0xB323u, 0.00000000 },
+  { 0xB324u, 0.00000000 },
+  { 0xB325u, 0.00000000 },
+  { 0xB326u, 0.00000000 },
+  { 0xB327u, 0.00000000 },
+  { 0xB328u, 0.00000000 },
+  { 0xB329u, 0.00000000 },
+  { 0xB32Au, 0.00000000 },
+  { 0xB32Bu, 0.00000000 },
+  { 0xB32Cu, 0.00000000 },
+  { 0xB32Du, 0.00000000 },
+  { 0xB32Eu, 0.00000000 },
+  { 0xB32Fu, 0.00000000 },
+  { 0xB330u, 0.00000000 },
+  { 0xB331u, 0.00000000 },
+  { 0xB332u, 0.00000000 },
+  { 0xB333u, 0.00000000 },
+  { 0xB334u, 0.00000000 },
+  { 0xB335u, 0.00000000 },
+  { 0xB336u, 0.00000000 },
+  { 0xB337u, 0.00000000 },
+  { 0xB338u, 0.00000000 },
+  { 0xB339u, 0.00000000 },
+  { 0xB33Au, 0.00000000 },
+  { 0xB33Bu, 0.00000000 },
+  { 0xB33Cu, 0.00000000 },
+  { 0xB33Du, 0.00000000 },
+  { 0xB33Eu, 0.00000000 },
+  { 0xB33Fu, 0.00000000 },
+  { 0xB340u, 0.00000000 },
+  { 0xB341u, 0.00000000 },
+  { 0xB342u, 0.00000000 },
+  { 0xB343u, 0.00000000 },
+  { 0xB344u, 0.00000000 },
+  { 0xB345u, 0.00000000 },
+  { 0xB346u, 0.00000000 },
+  { 0xB347u, 0.00000000 },
+  { 0xB348u, 0.00000000 },
+  { 0xB349u, 0.00000000 },
+  { 0xB34Au, 0.00000000 },
+  { 0xB34Bu, 0.00000000 },
+  { 0xB34Cu, 0.00000000 },
+  { 0xB34Du, 0.00000000 },
+  { 0xB34Eu, 0.00000000 },
+  { 0xB34Fu, 0.00000000 },
+  { 0xB350u, 0.00000000 },
+  { 0xB351u, 0.00000000 },
+  { 0xB352u, 0.00000000 },
+  { 0xB353u, 0.00000000 },
+  { 0xB354u, 0.00090000 },
+  { 0xB355u, 0.00020000 },
+  { 0xB356u, 0.00000000 },
+  { 0xB357u, 0.00000000 },
+  { 0xB358u, 0.00150000 },
+  { 0xB359u, 0.00000000 },
+  { 0xB35Au, 0.00000000 },
+  { 0xB35Bu, 0.00000000 },
+  { 0xB35Cu, 0.00010000 },
+  { 0xB35Du, 0.00000000 },
+  { 0xB35Eu, 0.00000000 },
+  { 0xB35Fu, 0.00000000 },
+  { 0xB360u, 0.00000000 },
+  { 0xB361u, 0.00000000 },
+  { 0xB362u, 0.00000000 },
+  { 0xB363u, 0.00000000 },
+  { 0xB364u, 0.00000000 },
+  { 0xB365u, 0.00000000 },
+  { 0xB366u, 0.00000000 },
+  { 0xB367u, 0.00000000 },
+  { 0xB368u, 0.00000000 },
+  { 0xB369u, 0.00000000 },
+  { 0xB36Au, 0.00000000 },
+  { 0xB36Bu, 0.00000000 },
+  { 0xB36Cu, 0.00000000 },
+  { 0xB36Du, 0.00000000 },
+  { 0xB36Eu, 0.00000000 },
+  { 0xB36Fu, 0.00000000 },
+  { 0xB370u, 0.00210000 },
+  { 0xB371u, 0.00000000 },
+  { 0xB372u, 0.00000000 },
+  { 0xB373u, 0.00000000 },
+  { 0xB374u, 0.00020000 },
+  { 0xB375u, 0.00000000 },
+  { 0xB376u, 0.00000000 },
+  { 0xB377u, 0.00000000 },
+  { 0xB378u, 0.00020000 },
+  { 0xB379u, 0.00000000 },
+  { 0xB37Au, 0.00000000 },
+  { 0xB37Bu, 0.00000000 },
+  { 0xB37Cu, 0.00000000 },
+  { 0xB37Du, 0.00000000 },
+  { 0xB37Eu, 0.00000000 },
+  { 0xB37Fu, 0.00000000 },
+  { 0xB380u, 0.00000000 },
+  { 0xB381u, 0.00000000 },
+  { 0xB382u, 0.00000000 },
+  { 0xB383u, 0.00000000 },
+  { 0xB384u, 0.00000000 },
+  { 0xB385u, 0.00000000 },
+  { 0xB386u, 0.00000000 },
+  { 0xB387u, 0.00000000 },
+  { 0xB388u, 0.00000000 },
+  { 0xB389u, 0.00000000 },
+  { 0xB38Au, 0.00000000 },
+  { 0xB38Bu, 0.00000000 },
+  { 0xB38Cu, 0.00000000 },
+  { 0xB38Du, 0.00000000 },
+  { 0xB38Eu, 0.00000000 },
+  { 0xB38Fu, 0.00000000 },
+  { 0xB390u, 0.00000000 },
+  { 0xB391u, 0.00000000 },
+  { 0xB392u, 0.00000000 },
+  { 0xB393u, 0.00000000 },
+  { 0xB394u, 0.00000000 },
+  { 0xB395u, 0.00000000 },
+  { 0xB396u, 0.00000000 },
+  { 0xB397u, 0.00000000 },
+  { 0xB398u, 0.00000000 },
+  { 0xB399u, 0.00000000 },
+  { 0xB39Au, 0.00000000 },
+  { 0xB39Bu, 0.00000000 },
+  { 0xB39Cu, 0.00000000 },
+  { 0xB39Du, 0.00000000 },
+  { 0xB39Eu, 0.00000000 },
+  { 0xB39Fu, 0.00000000 },
+  { 0xB3A0u, 0.00000000 },
+  { 0xB3A1u, 0.00000000 },
+  { 0xB3A2u, 0.00000000 },
+  { 0xB3A3u, 0.00000000 },
+  { 0xB3A4u, 0.00000000 },
+  { 0xB3A5u, 0.00000000 },
+  { 0xB3A6u, 0.00000000 },
+  { 0xB3A7u, 0.00000000 },
+  { 0xB3A8u, 0.00000000 },
+  { 0xB3A9u, 0.00000000 },
+  { 0xB3AAu, 0.00000000 },
+  { 0xB3ABu, 0.00000000 },
+  { 0xB3ACu, 0.00000000 },
+  { 0xB3ADu, 0.00000000 },
+  { 0xB3AEu, 0.00000000 },
+  { 0xB3AFu, 0.00000000 },
+  { 0xB3B0u, 0.00000000 },
+  { 0xB3B1u, 0.00000000 },
+  { 0xB3B2u, 0.00000000 },
+  { 0xB3B3u, 0.00000000 },
+  { 0xB3B4u, 0.00000000 },
+  { 0xB3B5u, 0.00000000 },
+  { 0xB3B6u, 0.00000000 },
+  { 0xB3B7u, 0.00000000 },
+  { 0xB3B8u, 0.00000000 },
+  { 0xB3B9u, 0.00000000 },
+  { 0xB3BAu, 0.00000000 },
+  { 0xB3BBu, 0.00000000 },
+  { 0xB3BCu, 0.00000000 },
+  { 0xB3BDu, 0.00000000 },
+  { 0xB3BEu, 0.00000000 },
+  { 0xB3BFu, 0.00000000 },
+  { 0xB3C0u, 0.00000000 },
+  { 0xB3C1u, 0.00000000 },
+  { 0xB3C2u, 0.00000000 },
+  { 0xB3C3u, 0.00000000 },
+  { 0xB3C4u, 0.00890000 },
+  { 0xB3C5u, 0.00130000 },
+  { 0xB3C6u, 0.00000000 },
+  { 0xB3C7u, 0.00000000 },
+  { 0xB3C8u, 0.00010000 },
+  { 0xB3C9u, 0.00000000 },
+  { 0xB3CAu, 0.00000000 },
+  { 0xB3CBu, 0.00000000 },
+  { 0xB3CCu, 0.00050000 },
+  { 0xB3CDu, 0.00000000 },
+  { 0xB3CEu, 0.00000000 },
+  { 0xB3CFu, 0.00000000 },
+  { 0xB3D0u, 0.00000000 },
+  { 0xB3D1u, 0.00000000 },
+  { 0xB3D2u, 0.00000000 },
+  { 0xB3D3u, 0.00000000 },
+  { 0xB3D4u, 0.00000000 },
+  { 0xB3D5u, 0.00000000 },
+  { 0xB3D6u, 0.00000000 },
+  { 0xB3D7u, 0.00000000 },
+  { 0xB3D8u, 0.00000000 },
+  { 0xB3D9u, 0.00440000 },
+  { 0xB3DAu, 0.00000000 },
+  { 0xB3DBu, 0.00000000 },
+  { 0xB3DCu, 0.00000000 },
+  { 0xB3DDu, 0.00000000 },
+  { 0xB3DEu, 0.00000000 },
+  { 0xB3DFu, 0.00000000 },
+  { 0xB3E0u, 0.00000000 },
+  { 0xB3E1u, 0.00000000 },
+  { 0xB3E2u, 0.00000000 },
+  { 0xB3E3u, 0.00000000 },
+  { 0xB3E4u, 0.00000000 },
+  { 0xB3E5u, 0.00000000 },
+  { 0xB3E6u, 0.00000000 },
+  { 0xB3E7u, 0.00000000 },
+  { 0xB3E8u, 0.00000000 },
+  { 0xB3E9u, 0.00000000 },
+  { 0xB3EAu, 0.00000000 },
+  { 0xB3EBu, 0.00000000 },
+  { 0xB3ECu, 0.00000000 },
+  { 0xB3EDu, 0.00000000 },
+  { 0xB3EEu, 0.00000000 },
+  { 0xB3EFu, 0.00000000 },
+  { 0xB3F0u, 0.00000000 },
+  { 0xB3F1u, 0.00000000 },
+  { 0xB3F2u, 0.00000000 },
+  { 0xB3F3u, 0.00000000 },
+  { 0xB3F4u, 0.00000000 },
+  { 0xB3F5u, 0.00000000 },
+  { 0xB3F6u, 0.00000000 },
+  { 0xB3F7u, 0.00000000 },
+  { 0xB3F8u, 0.00000000 },
+  { 0xB3F9u, 0.00000000 },
+  { 0xB3FAu, 0.00000000 },
+  { 0xB3FBu, 0.00000000 },
+  { 0xB3FCu, 0.00000000 },
+  { 0xB3FDu, 0.00000000 },
+  { 0xB3FEu, 0.00000000 },
+  { 0xB3FFu, 0.00000000 },
+  { 0xB400u, 0.00000000 },
+  { 0xB401u, 0.00000000 },
+  { 0xB402u, 0.00000000 },
+  { 0xB403u, 0.00000000 },
+  { 0xB404u, 0.00000000 },
+  { 0xB405u, 0.00000000 },
+  { 0xB406u, 0.00000000 },
+  { 0xB407u, 0.00000000 },
+  { 0xB408u, 0.00000000 },
+  { 0xB409u, 0.00000000 },
+  { 0xB40Au, 0.00000000 },
+  { 0xB40Bu, 0.00000000 },
+  { 0xB40Cu, 0.00000000 },
+  { 0xB40Du, 0.00000000 },
+  { 0xB40Eu, 0.00000000 },
+  { 0xB40Fu, 0.00000000 },
+  { 0xB410u, 0.00010000 },
+  { 0xB411u, 0.00000000 },
+  { 0xB412u, 0.00000000 },
+  { 0xB413u, 0.00000000 },
+  { 0xB414u, 0.00000000 },
+  { 0xB415u, 0.00000000 },
+  { 0xB416u, 0.00000000 },
+  { 0xB417u, 0.00000000 },
+  { 0xB418u, 0.00650000 },
+  { 0xB419u, 0.00000000 },
+  { 0xB41Au, 0.00000000 },
+  { 0xB41Bu, 0.00000000 },
+  { 0xB41Cu, 0.00260000 },
+  { 0xB41Du, 0.00000000 },
+  { 0xB41Eu, 0.00000000 },
+  { 0xB41Fu, 0.00000000 },
+  { 0xB420u, 0.00020000 },
+  { 0xB421u, 0.00000000 },
+  { 0xB422u, 0.00000000 },
+  { 0xB423u, 0.00000000 },
+  { 0xB424u, 0.00000000 },
+  { 0xB425u, 0.00000000 },
+  { 0xB426u, 0.00000000 },
+  { 0xB427u, 0.00000000 },
+  { 0xB428u, 0.00010000 },
+  { 0xB429u, 0.00000000 },
+  { 0xB42Au, 0.00000000 },
+  { 0xB42Bu, 0.00000000 },
+  { 0xB42Cu, 0.00000000 },
+  { 0xB42Du, 0.00000000 },
+  { 0xB42Eu, 0.00000000 },
+  { 0xB42Fu, 0.00000000 },
+  { 0xB430u, 0.00000000 },
+  { 0xB431u, 0.00000000 },
+  { 0xB432u, 0.00000000 },
+  { 0xB433u, 0.00000000 },
+  { 0xB434u, 0.00000000 },
+  { 0xB435u, 0.00000000 },
+  { 0xB436u, 0.00000000 },
+  { 0xB437u, 0.00000000 },
+  { 0xB438u, 0.00000000 },
+  { 0xB439u, 0.00000000 },
+  { 0xB43Au, 0.00000000 },
+  { 0xB43Bu, 0.00000000 },
+  { 0xB43Cu, 0.00000000 },
+  { 0xB43Du, 0.00000000 },
+  { 0xB43Eu, 0.00000000 },
+  { 0xB43Fu, 0.00000000 },
+  { 0xB440u, 0.00000000 },
+  { 0xB441u, 0.00000000 },
+  { 0xB442u, 0.00000000 },
+  { 0xB443u, 0.00000000 },
+  { 0xB444u, 0.00000000 },
+  { 0xB445u, 0.00000000 },
+  { 0xB446u, 0.00000000 },
+  { 0xB447u, 0.00000000 },
+  { 0xB448u, 0.00000000 },
+  { 0xB449u, 0.00000000 },
+  { 0xB44Au, 0.00000000 },
+  { 0xB44Bu, 0.00000000 },
+  { 0xB44Cu, 0.00000000 },
+  { 0xB44Du, 0.00000000 },
+  { 0xB44Eu, 0.00000000 },
+  { 0xB44Fu, 0.00000000 },
+  { 0xB450u, 0.00140000 },
+  { 0xB451u, 0.00000000 },
+  { 0xB452u, 0.00000000 },
+  { 0xB453u, 0.00000000 },
+  { 0xB454u, 0.00010000 },
+  { 0xB455u, 0.00000000 },
+  { 0xB456u, 0.00000000 },
+  { 0xB457u, 0.00000000 },
+  { 0xB458u, 0.00020000 },
+  { 0xB459u, 0.00000000 },
+  { 0xB45Au, 0.00000000 },
+  { 0xB45Bu, 0.00000000 },
+  { 0xB45Cu, 0.00000000 },
+  { 0xB45Du, 0.00000000 },
+  { 0xB45Eu, 0.00000000 },
+  { 0xB45Fu, 0.00000000 },
+  { 0xB460u, 0.00000000 },
+  { 0xB461u, 0.00000000 },
+  { 0xB462u, 0.00000000 },
+  { 0xB463u, 0.00000000 },
+  { 0xB464u, 0.00000000 },
+  { 0xB465u, 0.00010000 },
+  { 0xB466u, 0.00000000 },
+  { 0xB467u, 0.00000000 },
+  { 0xB468u, 0.00000000 },
+  { 0xB469u, 0.00000000 },
+  { 0xB46Au, 0.00000000 },
+  { 0xB46Bu, 0.00000000 },
+  { 0xB46Cu, 0.00000000 },
+  { 0xB46Du, 0.00000000 },
+  { 0xB46Eu, 0.00000000 },
+  { 0xB46Fu, 0.00000000 },
+  { 0xB470u, 0.00000000 },
+  { 0xB471u, 0.00000000 },
+  { 0xB472u, 0.00000000 },
+  { 0xB473u, 0.00000000 },
+  { 0xB474u, 0.00000000 },
+  { 0xB475u, 0.00000000 },
+  { 0xB476u, 0.00000000 },
+  { 0xB477u, 0.00000000 },
+  { 0xB478u, 0.00000000 },
+  { 0xB479u, 0.00000000 },
+  { 0xB47Au, 0.00000000 },
+  { 0xB47Bu, 0.00000000 },
+  { 0xB47Cu, 0.00000000 },
+  { 0xB47Du, 0.00000000 },
+  { 0xB47Eu, 0.00000000 },
+  { 0xB47Fu, 0.00000000 },
+  { 0xB480u, 0.00000000 },
+  { 0xB481u, 0.00000000 },
+  { 0xB482u, 0.00000000 },
+  { 0xB483u, 0.00000000 },
+  { 0xB484u, 0.00000000 },
+  { 0xB485u, 0.00000000 },
+  { 0xB486u, 0.00000000 },
+  { 0xB487u, 0.00000000 },
+  { 0xB488u, 0.00000000 },
+  { 0xB489u, 0.00000000 },
+  { 0xB48Au, 0.00000000 },
+  { 0xB48Bu, 0.00000000 },
+  { 0xB48Cu, 0.00000000 },
+  { 0xB48Du, 0.00000000 },
+  { 0xB48Eu, 0.00000000 },
+  { 0xB48Fu, 0.00000000 },
+  { 0xB490u, 0.00000000 },
+  { 0xB491u, 0.00000000 },
+  { 0xB492u, 0.00000000 },
+  { 0xB493u, 0.00000000 },
+  { 0xB494u, 0.00000000 },
+  { 0xB495u, 0.00000000 },
+  { 0xB496u, 0.00000000 },
+  { 0xB497u, 0.00000000 },
+  { 0xB498u, 0.00000000 },
+  { 0xB499u, 0.00000000 },
+  { 0xB49Au, 0.00000000 },
+  { 0xB49Bu, 0.00000000 },
+  { 0xB49Cu, 0.00000000 },
+  { 0xB49Du, 0.00000000 },
+  { 0xB49Eu, 0.00000000 },
+  { 0xB49Fu, 0.00000000 },
+  { 0xB4A0u, 0.00000000 },
+  { 0xB4A1u, 0.00000000 },
+  { 0xB4A2u, 0.00000000 },
+  { 0xB4A3u, 0.00000000 },
+  { 0xB4A4u, 0.00050000 },
+  { 0xB4A5u, 0.00000000 },
+  { 0xB4A6u, 0.00000000 },
+  { 0xB4A7u, 0.00000000 },
+  { 0xB4A8u, 0.00000000 },
+  { 0xB4A9u, 0.00000000 },
+  { 0xB4AAu, 0.00000000 },
+  { 0xB4ABu, 0.00000000 },
+  { 0xB4ACu, 0.00000000 },
+  { 0xB4ADu, 0.00000000 },
+  { 0xB4AEu, 0.00000000 },
+  { 0xB4AFu, 0.00000000 },
+  { 0xB4B0u, 0.00000000 },
+  { 0xB4B1u, 0.00000000 },
+  { 0xB4B2u, 0.00000000 },
+  { 0xB4B3u, 0.00000000 },
+  { 0xB4B4u, 0.00000000 },
+  { 0xB4B5u, 0.00000000 },
+  { 0xB4B6u, 0.00000000 },
+  { 0xB4B7u, 0.00000000 },
+  { 0xB4B8u, 0.00000000 },
+  { 0xB4B9u, 0.00000000 },
+  { 0xB4BAu, 0.00000000 },
+  { 0xB4BBu, 0.00000000 },
+  { 0xB4BCu, 0.00000000 },
+  { 0xB4BDu, 0.00000000 },
+  { 0xB4BEu, 0.00000000 },
+  { 0xB4BFu, 0.00000000 },
+  { 0xB4C0u, 0.00010000 },
+  { 0xB4C1u, 0.00000000 },
+  { 0xB4C2u, 0.00000000 },
+  { 0xB4C3u, 0.00000000 },
+  { 0xB4C4u, 0.00000000 },
+  { 0xB4C5u, 0.00000000 },
+  { 0xB4C6u, 0.00000000 },
+  { 0xB4C7u, 0.00000000 },
+  { 0xB4C8u, 0.00000000 },
+  { 0xB4C9u, 0.00000000 },
+  { 0xB4CAu, 0.00000000 },
+  { 0xB4CBu, 0.00000000 },
+  { 0xB4CCu, 0.00000000 },
+  { 0xB4CDu, 0.00000000 },
+  { 0xB4CEu, 0.00000000 },
+  { 0xB4CFu, 0.00000000 },
+  { 0xB4D0u, 0.00000000 },
+  { 0xB4D1u, 0.00000000 },
+  { 0xB4D2u, 0.00000000 },
+  { 0xB4D3u, 0.00000000 },
+  { 0xB4D4u, 0.00000000 },
+  { 0xB4D5u, 0.00000000 },
+  { 0xB4D6u, 0.00000000 },
+  { 0xB4D7u, 0.00000000 },
+  { 0xB4D8u, 0.00000000 },
+  { 0xB4D9u, 0.00000000 },
+  { 0xB4DAu, 0.00000000 },
+  { 0xB4DBu, 0.00000000 },
+  { 0xB4DCu, 0.00310000 },
+  { 0xB4DDu, 0.00020000 },
+  { 0xB4DEu, 0.00000000 },
+  { 0xB4DFu, 0.00000000 },
+  { 0xB4E0u, 0.00050000 },
+  { 0xB4E1u, 0.00000000 },
+  { 0xB4E2u, 0.00000000 },
+  { 0xB4E3u, 0.00000000 },
+  { 0xB4E4u, 0.00470000 },
+  { 0xB4E5u, 0.00000000 },
+  { 0xB4E6u, 0.00000000 },
+  { 0xB4E7u, 0.00000000 },
+  { 0xB4E8u, 0.00000000 },
+  { 0xB4E9u, 0.00000000 },
+  { 0xB4EAu, 0.00000000 },
+  { 0xB4EBu, 0.00000000 },
+  { 0xB4ECu, 0.00010000 },
+  { 0xB4EDu, 0.00000000 },
+  { 0xB4EEu, 0.00000000 },
+  { 0xB4EFu, 0.00010000 },
+  { 0xB4F0u, 0.00000000 },
+  { 0xB4F1u, 0.00270000 },
+  { 0xB4F2u, 0.00000000 },
+  { 0xB4F3u, 0.00000000 },
+  { 0xB4F4u, 0.00000000 },
+  { 0xB4F5u, 0.00000000 },
+  { 0xB4F6u, 0.00000000 },
+  { 0xB4F7u, 0.00000000 },
+  { 0xB4F8u, 0.00000000 },
+  { 0xB4F9u, 0.00000000 },
+  { 0xB4FAu, 0.00000000 },
+  { 0xB4FBu, 0.00000000 },
+  { 0xB4FCu, 0.00000000 },
+  { 0xB4FDu, 0.00000000 },
+  { 0xB4FEu, 0.00000000 },
+  { 0xB4FFu, 0.00000000 },
+  { 0xB500u, 0.00000000 },
+  { 0xB501u, 0.00000000 },
+  { 0xB502u, 0.00000000 },
+  { 0xB503u, 0.00000000 },
+  { 0xB504u, 0.00000000 },
+  { 0xB505u, 0.00000000 },
+  { 0xB506u, 0.00000000 },
+  { 0xB507u, 0.00000000 },
+  { 0xB508u, 0.00000000 },
+  { 0xB509u, 0.00000000 },
+  { 0xB50Au, 0.00000000 },
+  { 0xB50Bu, 0.00000000 },
+  { 0xB50Cu, 0.00000000 },
+  { 0xB50Du, 0.00000000 },
+  { 0xB50Eu, 0.00000000 },
+  { 0xB50Fu, 0.00000000 },
+  { 0xB510u, 0.00000000 },
+  { 0xB511u, 0.00000000 },
+  { 0xB512u, 0.00000000 },
+  { 0xB513u, 0.00000000 },
+  { 0xB514u, 0.00110000 },
+  { 0xB515u, 0.00000000 },
+  { 0xB516u, 0.00000000 },
+  { 0xB517u, 0.00000000 },
+  { 0xB518u, 0.00000000 },
+  { 0xB519u, 0.00000000 },
+  { 0xB51Au, 0.00000000 },
+  { 0xB51Bu, 0.00000000 },
+  { 0xB51Cu, 0.00000000 },
+  { 0xB51Du, 0.00000000 },
+  { 0xB51Eu, 0.00000000 },
+  { 0xB51Fu, 0.00000000 },
+  { 0xB520u, 0.00000000 },
+  { 0xB521u, 0.00000000 },
+  { 0xB522u, 0.00000000 },
+  { 0xB523u, 0.00000000 },
+  { 0xB524u, 0.00000000 },
+  { 0xB525u, 0.00000000 },
+  { 0xB526u, 0.00000000 },
+  { 0xB527u, 0.00000000 },
+  { 0xB528u, 0.00000000 },
+  { 0xB529u, 0.00010000 },
+  { 0xB52Au, 0.00000000 },
+  { 0xB52Bu, 0.00000000 },
+  { 0xB52Cu, 0.00000000 },
+  { 0xB52Du, 0.00000000 },
+  { 0xB52Eu, 0.00000000 },
+  { 0xB52Fu, 0.00000000 },
+  { 0xB530u, 0.00080000 },
+  { 0xB531u, 0.00000000 },
+  { 0xB532u, 0.00000000 },
+  { 0xB533u, 0.00000000 },
+  { 0xB534u, 0.00000000 },
+  { 0xB535u, 0.00000000 },
+  { 0xB536u, 0.00000000 },
+  { 0xB537u, 0.00000000 },
+  { 0xB538u, 0.00010000 },
+  { 0xB539u, 0.00000000 },
+  { 0xB53Au, 0.00000000 },
+  { 0xB53Bu, 0.00000000 },
+  { 0xB53Cu, 0.00000000 },
+  { 0xB53Du, 0.00000000 },
+  { 0xB53Eu, 0.00000000 },
+  { 0xB53Fu, 0.00000000 },
+  { 0xB540u, 0.00000000 },
+  { 0xB541u, 0.00000000 },
+  { 0xB542u, 0.00000000 },
+  { 0xB543u, 0.00000000 },
+  { 0xB544u, 0.00000000 },
+  { 0xB545u, 0.00010000 },
+  { 0xB546u, 0.00000000 },
+  { 0xB547u, 0.00000000 },
+  { 0xB548u, 0.00000000 },
+  { 0xB549u, 0.00000000 },
+  { 0xB54Au, 0.00000000 },
+  { 0xB54Bu, 0.00000000 },
+  { 0xB54Cu, 0.00170000 },
+  { 0xB54Du, 0.00000000 },
+  { 0xB54Eu, 0.00000000 },
+  { 0xB54Fu, 0.00000000 },
+  { 0xB550u, 0.00000000 },
+  { 0xB551u, 0.00000000 },
+  { 0xB552u, 0.00000000 },
+  { 0xB553u, 0.00000000 },
+  { 0xB554u, 0.00000000 },
+  { 0xB555u, 0.00000000 },
+  { 0xB556u, 0.00000000 },
+  { 0xB557u, 0.00000000 },
+  { 0xB558u, 0.00000000 },
+  { 0xB559u, 0.00000000 },
+  { 0xB55Au, 0.00000000 },
+  { 0xB55Bu, 0.00000000 },
+  { 0xB55Cu, 0.00000000 },
+  { 0xB55Du, 0.00000000 },
+  { 0xB55Eu, 0.00000000 },
+  { 0xB55Fu, 0.00000000 },
+  { 0xB560u, 0.00000000 },
+  { 0xB561u, 0.00000000 },
+  { 0xB562u, 0.00000000 },
+  { 0xB563u, 0.00000000 },
+  { 0xB564u, 0.00000000 },
+  { 0xB565u, 0.00000000 },
+  { 0xB566u, 0.00000000 },
+  { 0xB567u, 0.00000000 },
+  { 0xB568u, 0.00000000 },
+  { 0xB569u, 0.00000000 },
+  { 0xB56Au, 0.00000000 },
+  { 0xB56Bu, 0.00000000 },
+  { 0xB56Cu, 0.00000000 },
+  { 0xB56Du, 0.00000000 },
+  { 0xB56Eu, 0.00000000 },
+  { 0xB56Fu, 0.00000000 },
+  { 0xB570u, 0.00000000 },
+  { 0xB571u, 0.00000000 },
+  { 0xB572u, 0.00000000 },
+  { 0xB573u, 0.00000000 },
+  { 0xB574u, 0.00000000 },
+  { 0xB575u, 0.00000000 },
+  { 0xB576u, 0.00000000 },
+  { 0xB577u, 0.00000000 },
+  { 0xB578u, 0.00000000 },
+  { 0xB579u, 0.00000000 },
+  { 0xB57Au, 0.00000000 },
+  { 0xB57Bu, 0.00000000 },
+  { 0xB57Cu, 0.00000000 },
+  { 0xB57Du, 0.00000000 },
+  { 0xB57Eu, 0.00000000 },
+  { 0xB57Fu, 0.00000000 },
+  { 0xB580u, 0.00000000 },
+  { 0xB581u, 0.00000000 },
+  { 0xB582u, 0.00000000 },
+  { 0xB583u, 0.00000000 },
+  { 0xB584u, 0.00000000 },
+  { 0xB585u, 0.00000000 },
+  { 0xB586u, 0.00000000 },
+  { 0xB587u, 0.00000000 },
+  { 0xB588u, 0.00000000 },
+  { 0xB589u, 0.00000000 },
+  { 0xB58Au, 0.00000000 },
+  { 0xB58Bu, 0.00000000 },
+  { 0xB58Cu, 0.00000000 },
+  { 0xB58Du, 0.00000000 },
+  { 0xB58Eu, 0.00000000 },
+  { 0xB58Fu, 0.00000000 },
+  { 0xB590u, 0.00000000 },
+  { 0xB591u, 0.00000000 },
+  { 0xB592u, 0.00000000 },
+  { 0xB593u, 0.00000000 },
+  { 0xB594u, 0.00000000 },
+  { 0xB595u, 0.00000000 },
+  { 0xB596u, 0.00000000 },
+  { 0xB597u, 0.00000000 },
+  { 0xB598u, 0.00000000 },
+  { 0xB599u, 0.00000000 },
+  { 0xB59Au, 0.00000000 },
+  { 0xB59Bu, 0.00000000 },
+  { 0xB59Cu, 0.00000000 },
+  { 0xB59Du, 0.00000000 },
+  { 0xB59Eu, 0.00000000 },
+  { 0xB59Fu, 0.00000000 },
+  { 0xB5A0u, 0.00020000 },
+  { 0xB5A1u, 0.00000000 },
+  { 0xB5A2u, 0.00000000 },
+  { 0xB5A3u, 0.00000000 },
+  { 0xB5A4u, 0.00010000 },
+  { 0xB5A5u, 0.00000000 },
+  { 0xB5A6u, 0.00000000 },
+  { 0xB5A7u, 0.00000000 },
+  { 0xB5A8u, 0.00020000 },
+  { 0xB5A9u, 0.00000000 },
+  { 0xB5AAu, 0.00000000 },
+  { 0xB5ABu, 0.00000000 },
+  { 0xB5ACu, 0.00000000 },
+  { 0xB5ADu, 0.00000000 },
+  { 0xB5AEu, 0.00000000 },
+  { 0xB5AFu, 0.00000000 },
+  { 0xB5B0u, 0.00000000 },
+  { 0xB5B1u, 0.00000000 },
+  { 0xB5B2u, 0.00000000 },
+  { 0xB5B3u, 0.00000000 },
+  { 0xB5B4u, 0.00000000 },
+  { 0xB5B5u, 0.00000000 },
+  { 0xB5B6u, 0.00000000 },
+  { 0xB5B7u, 0.00000000 },
+  { 0xB5B8u, 0.00000000 },
+  { 0xB5B9u, 0.00000000 },
+  { 0xB5BAu, 0.00000000 },
+  { 0xB5BBu, 0.00000000 },
+  { 0xB5BCu, 0.00000000 },
+  { 0xB5BDu, 0.00000000 },
+  { 0xB5BEu, 0.00000000 },
+  { 0xB5BFu, 0.00000000 },
+  { 0xB5C0u, 0.00000000 },
+  { 0xB5C1u, 0.00000000 },
+  { 0xB5C2u, 0.00000000 },
+  { 0xB5C3u, 0.00000000 },
+  { 0xB5C4u, 0.00000000 },
+  { 0xB5C5u, 0.00000000 },
+  { 0xB5C6u, 0.00000000 },
+  { 0xB5C7u, 0.00000000 },
+  { 0xB5C8u, 0.00000000 },
+  { 0xB5C9u, 0.00000000 },
+  { 0xB5CAu, 0.00000000 },
+  { 0xB5CBu, 0.00000000 },
+  { 0xB5CCu, 0.00000000 },
+  { 0xB5CDu, 0.00000000 },
+  { 0xB5CEu, 0.00000000 },
+  { 0xB5CFu, 0.00000000 },
+  { 0xB5D0u, 0.00000000 },
+  { 0xB5D1u, 0.00000000 },
+  { 0xB5D2u, 0.00000000 },
+  { 0xB5D3u, 0.00000000 },
+  { 0xB5D4u, 0.00000000 },
+  { 0xB5D5u, 0.00000000 },
+  { 0xB5D6u, 0.00000000 },
+  { 0xB5D7u, 0.00000000 },
+  { 0xB5D8u, 0.00000000 },
+  { 0xB5D9u, 0.00000000 },
+  { 0xB5DAu, 0.00000000 },
+  { 0xB5DBu, 0.00000000 },
+  { 0xB5DCu, 0.00000000 },
+  { 0xB5DDu, 0.00000000 },
+  { 0xB5DEu, 0.00000000 },
+  { 0xB5DFu, 0.00000000 },
+  { 0xB5E0u, 0.00000000 },
+  { 0xB5E1u, 0.00000000 },
+  { 0xB5E2u, 0.00000000 },
+  { 0xB5E3u, 0.00000000 },
+  { 0xB5E4u, 0.00000000 },
+  { 0xB5E5u, 0.00000000 },
+  { 0xB5E6u, 0.00000000 },
+  { 0xB5E7u, 0.00000000 },
+  { 0xB5E8u, 0.00000000 },
+  { 0xB5E9u, 0.00000000 },
+  { 0xB5EAu, 0.00000000 },
+  { 0xB5EBu, 0.00000000 },
+  { 0xB5ECu, 0.00000000 },
+  { 0xB5EDu, 0.00000000 },
+  { 0xB5EEu, 0.00000000 },
+  { 0xB5EFu, 0.00000000 },
+  { 0xB5F0u, 0.00000000 },
+  { 0xB5F1u, 0.00000000 },
+  { 0xB5F2u, 0.00000000 },
+  { 0xB5F3u, 0.00000000 },
+  { 0xB5F4u, 0.00000000 },
+  { 0xB5F5u, 0.00000000 },
+  { 0xB5F6u, 0.00000000 },
+  { 0xB5F7u, 0.00000000 },
+  { 0xB5F8u, 0.00000000 },
+  { 0xB5F9u, 0.00000000 },
+  { 0xB5FAu, 0.00000000 },
+  { 0xB5FBu, 0.00000000 },
+  { 0xB5FCu, 0.00000000 },
+  { 0xB5FDu, 0.00000000 },
+  { 0xB5FEu, 0.00000000 },
+  { 0xB5FFu, 0.00000000 },
+  { 0xB600u, 0.00000000 },
+  { 0xB601u, 0.00000000 },
+  { 0xB602u, 0.00000000 },
+  { 0xB603u, 0.00000000 },
+  { 0xB604u, 0.00000000 },
+  { 0xB605u, 0.00000000 },
+  { 0xB606u, 0.00000000 },
+  { 0xB607u, 0.00000000 },
+  { 0xB608u, 0.00000000 },
+  { 0xB609u, 0.00000000 },
+  { 0xB60Au, 0.00000000 },
+  { 0xB60Bu, 0.00000000 },
+  { 0xB60Cu, 0.00000000 },
+  { 0xB60Du, 0.00000000 },
+  { 0xB60Eu, 0.00000000 },
+  { 0xB60Fu, 0.00000000 },
+  { 0xB610u, 0.00110000 },
+  { 0xB611u, 0.00000000 },
+  { 0xB612u, 0.00000000 },
+  { 0xB613u, 0.00000000 },
+  { 0xB614u, 0.00000000 },
+  { 0xB615u, 0.00000000 },
+  { 0xB616u, 0.00000000 },
+  { 0xB617u, 0.00000000 },
+  { 0xB618u, 0.00000000 },
+  { 0xB619u, 0.00000000 },
+  { 0xB61Au, 0.00000000 },
+  { 0xB61Bu, 0.00000000 },
+  { 0xB61Cu, 0.00000000 },
+  { 0xB61Du, 0.00000000 },
+  { 0xB61Eu, 0.00000000 },
+  { 0xB61Fu, 0.00000000 },
+  { 0xB620u, 0.00000000 },
+  { 0xB621u, 0.00000000 },
+  { 0xB622u, 0.00000000 },
+  { 0xB623u, 0.00000000 },
+  { 0xB624u, 0.00000000 },
+  { 0xB625u, 0.00000000 },
+  { 0xB626u, 0.00000000 },
+  { 0xB627u, 0.00000000 },
+  { 0xB628u, 0.00000000 },
+  { 0xB629u, 0.00000000 },
+  { 0xB62Au, 0.00000000 },
+  { 0xB62Bu, 0.00000000 },
+  { 0xB62Cu, 0.00000000 },
+  { 0xB62Du, 0.00000000 },
+  { 0xB62Eu, 0.00000000 },
+  { 0xB62Fu, 0.00000000 },
+  { 0xB630u, 0.00000000 },
+  { 0xB631u, 0.00000000 },
+  { 0xB632u, 0.00000000 },
+  { 0xB633u, 0.00000000 },
+  { 0xB634u, 0.00000000 },
+  { 0xB635u, 0.00000000 },
+  { 0xB636u, 0.00000000 },
+  { 0xB637u, 0.00000000 },
+  { 0xB638u, 0.00000000 },
+  { 0xB639u, 0.00000000 },
+  { 0xB63Au, 0.00000000 },
+  { 0xB63Bu, 0.00000000 },
+  { 0xB63Cu, 0.00000000 },
+  { 0xB63Du, 0.00000000 },
+  { 0xB63Eu, 0.00000000 },
+  { 0xB63Fu, 0.00000000 },
+  { 0xB640u, 0.00000000 },
+  { 0xB641u, 0.00000000 },
+  { 0xB642u, 0.00000000 },
+  { 0xB643u, 0.00000000 },
+  { 0xB644u, 0.00000000 },
+  { 0xB645u, 0.00000000 },
+  { 0xB646u, 0.00000000 },
+  { 0xB647u, 0.00000000 },
+  { 0xB648u, 0.00000000 },
+  { 0xB649u, 0.00000000 },
+  { 0xB64Au, 0.00000000 },
+  { 0xB64Bu, 0.00000000 },
+  { 0xB64Cu, 0.00000000 },
+  { 0xB64Du, 0.00000000 },
+  { 0xB64Eu, 0.00000000 },
+  { 0xB64Fu, 0.00000000 },
+  { 0xB650u, 0.00000000 },
+  { 0xB651u, 0.00000000 },
+  { 0xB652u, 0.00000000 },
+  { 0xB653u, 0.00000000 },
+  { 0xB654u, 0.00000000 },
+  { 0xB655u, 0.00000000 },
+  { 0xB656u, 0.00000000 },
+  { 0xB657u, 0.00000000 },
+  { 0xB658u, 0.00000000 },
+  { 0xB659u, 0.00000000 },
+  { 0xB65Au, 0.00000000 },
+  { 0xB65Bu, 0.00000000 },
+  { 0xB65Cu, 0.00000000 },
+  { 0xB65Du, 0.00000000 },
+  { 0xB65Eu, 0.00000000 },
+  { 0xB65Fu, 0.00000000 },
+  { 0xB660u, 0.00000000 },
+  { 0xB661u, 0.00000000 },
+  { 0xB662u, 0.00000000 },
+  { 0xB663u, 0.00000000 },
+  { 0xB664u, 0.00000000 },
+  { 0xB665u, 0.00000000 },
+  { 0xB666u, 0.00000000 },
+  { 0xB667u, 0.00000000 },
+  { 0xB668u, 0.00000000 },
+  { 0xB669u, 0.00000000 },
+  { 0xB66Au, 0.00000000 },
+  { 0xB66Bu, 0.00000000 },
+  { 0xB66Cu, 0.00000000 },
+  { 0xB66Du, 0.00000000 },
+  { 0xB66Eu, 0.00000000 },
+  { 0xB66Fu, 0.00000000 },
+  { 0xB670u, 0.00000000 },
+  { 0xB671u, 0.00000000 },
+  { 0xB672u, 0.00000000 },
+  { 0xB673u, 0.00000000 },
+  { 0xB674u, 0.00000000 },
+  { 0xB675u, 0.00000000 },
+  { 0xB676u, 0.00000000 },
+  { 0xB677u, 0.00000000 },
+  { 0xB678u, 0.00000000 },
+  { 0xB679u, 0.00000000 },
+  { 0xB67Au, 0.00000000 },
+  { 0xB67Bu, 0.00000000 },
+  { 0xB67Cu, 0.00000000 },
+  { 0xB67Du, 0.00000000 },
+  { 0xB67Eu, 0.00000000 },
+  { 0xB67Fu, 0.00000000 },
+  { 0xB680u, 0.00000000 },
+  { 0xB681u, 0.00000000 },
+  { 0xB682u, 0.00000000 },
+  { 0xB683u, 0.00000000 },
+  { 0xB684u, 0.00000000 },
+  { 0xB685u, 0.00000000 },
+  { 0xB686u, 0.00000000 },
+  { 0xB687u, 0.00000000 },
+  { 0xB688u, 0.00000000 },
+  { 0xB689u, 0.00000000 },
+  { 0xB68Au, 0.00000000 },
+  { 0xB68Bu, 0.00000000 },
+  { 0xB68Cu, 0.00000000 },
+  { 0xB68Du, 0.00000000 },
+  { 0xB68Eu, 0.00000000 },
+  { 0xB68Fu, 0.00000000 },
+  { 0xB690u, 0.00000000 },
+  { 0xB691u, 0.00000000 },
+  { 0xB692u, 0.00000000 },
+  { 0xB693u, 0.00000000 },
+  { 0xB694u, 0.00000000 },
+  { 0xB695u, 0.00000000 },
+  { 0xB696u, 0.00000000 },
+  { 0xB697u, 0.00000000 },
+  { 0xB698u, 0.00000000 },
+  { 0xB699u, 0.00000000 },
+  { 0xB69Au, 0.00000000 },
+  { 0xB69Bu, 0.00000000 },
+  { 0xB69Cu, 0.00000000 },
+  { 0xB69Du, 0.00000000 },
+  { 0xB69Eu, 0.00000000 },
+  { 0xB69Fu, 0.00000000 },
+  { 0xB6A0u, 0.00000000 },
+  { 0xB6A1u, 0.00000000 },
+  { 0xB6A2u, 0.00000000 },
+  { 0xB6A3u, 0.00000000 },
+  { 0xB6A4u, 0.00000000 },
+  { 0xB6A5u, 0.00000000 },
+  { 0xB6A6u, 0.00000000 },
+  { 0xB6A7u, 0.00000000 },
+  { 0xB6A8u, 0.00000000 },
+  { 0xB6A9u, 0.00000000 },
+  { 0xB6AAu, 0.00000000 },
+  { 0xB6ABu, 0.00000000 },
+  { 0xB6ACu, 0.00000000 },
+  { 0xB6ADu, 0.00000000 },
+  { 0xB6AEu, 0.00000000 },
+  { 0xB6AFu, 0.00000000 },
+  { 0xB6B0u, 0.00000000 },
+  { 0xB6B1u, 0.00000000 },
+  { 0xB6B2u, 0.00000000 },
+  { 0xB6B3u, 0.00000000 },
+  { 0xB6B4u, 0.00000000 },
+  { 0xB6B5u, 0.00000000 },
+  { 0xB6B6u, 0.00000000 },
+  { 0xB6B7u, 0.00000000 },
+  { 0xB6B8u, 0.00000000 },
+  { 0xB6B9u, 0.00000000 },
+  { 0xB6BAu, 0.00000000 },
+  { 0xB6BBu, 0.00000000 },
+  { 0xB6BCu, 0.00000000 },
+  { 0xB6BDu, 0.00000000 },
+  { 0xB6BEu, 0.00000000 },
+  { 0xB6BFu, 0.00000000 },
+  { 0xB6C0u, 0.00000000 },
+  { 0xB6C1u, 0.00000000 },
+  { 0xB6C2u, 0.00000000 },
+  { 0xB6C3u, 0.00000000 },
+  { 0xB6C4u, 0.00000000 },
+  { 0xB6C5u, 0.00000000 },
+  { 0xB6C6u, 0.00000000 },
+  { 0xB6C7u, 0.00000000 },
+  { 0xB6C8u, 0.00000000 },
+  { 0xB6C9u, 0.00000000 },
+  { 0xB6CAu, 0.00000000 },
+  { 0xB6CBu, 0.00000000 },
+  { 0xB6CCu, 0.00000000 },
+  { 0xB6CDu, 0.00000000 },
+  { 0xB6CEu, 0.00000000 },
+  { 0xB6CFu, 0.00000000 },
+  { 0xB6D0u, 0.00000000 },
+  { 0xB6D1u, 0.00000000 },
+  { 0xB6D2u, 0.00000000 },
+  { 0xB6D3u, 0.00000000 },
+  { 0xB6D4u, 0.00000000 },
+  { 0xB6D5u, 0.00000000 },
+  { 0xB6D6u, 0.00000000 },
+  { 0xB6D7u, 0.00000000 },
+  { 0xB6D8u, 0.00000000 },
+  { 0xB6D9u, 0.00000000 },
+  { 0xB6DAu, 0.00000000 },
+  { 0xB6DBu, 0.00000000 },
+  { 0xB6DCu, 0.00000000 },
+  { 0xB6DDu, 0.00000000 },
+  { 0xB6DEu, 0.00000000 },
+  { 0xB6DFu, 0.00000000 },
+  { 0xB6E0u, 0.00000000 },
+  { 0xB6E1u, 0.00000000 },
+  { 0xB6E2u, 0.00000000 },
+  { 0xB6E3u, 0.00000000 },
+  { 0xB6E4u, 0.00000000 },
+  { 0xB6E5u, 0.00000000 },
+  { 0xB6E6u, 0.00000000 },
+  { 0xB6E7u, 0.00000000 },
+  { 0xB6E8u, 0.00000000 },
+  { 0xB6E9u, 0.00000000 },
+  { 0xB6EAu, 0.00000000 },
+  { 0xB6EBu, 0.00000000 },
+  { 0xB6ECu, 0.00000000 },
+  { 0xB6EDu, 0.00000000 },
+  { 0xB6EEu, 0.00000000 },
+  { 0xB6EFu, 0.00000000 },
+  { 0xB6F0u, 0.00010000 },
+  { 0xB6F1u, 0.00000000 },
+  { 0xB6F2u, 0.00000000 },
+  { 0xB6F3u, 0.00000000 },
+  { 0xB6F4u, 0.00000000 },
+  { 0xB6F5u, 0.00000000 },
+  { 0xB6F6u, 0.00000000 },
+  { 0xB6F7u, 0.00000000 },
+  { 0xB6F8u, 0.00000000 },
+  { 0xB6F9u, 0.00000000 },
+  { 0xB6FAu, 0.00000000 },
+  { 0xB6FBu, 0.00000000 },
+  { 0xB6FCu, 0.00000000 },
+  { 0xB6FDu, 0.00000000 },
+  { 0xB6FEu, 0.00000000 },
+  { 0xB6FFu, 0.00000000 },
+  { 0xB700u, 0.00000000 },
+  { 0xB701u, 0.00000000 },
+  { 0xB702u, 0.00000000 },
+  { 0xB703u, 0.00000000 },
+  { 0xB704u, 0.00000000 },
+  { 0xB705u, 0.00000000 },
+  { 0xB706u, 0.00000000 },
+  { 0xB707u, 0.00000000 },
+  { 0xB708u, 0.00000000 },
+  { 0xB709u, 0.00000000 },
+  { 0xB70Au, 0.00000000 },
+  { 0xB70Bu, 0.00000000 },
+  { 0xB70Cu, 0.00000000 },
+  { 0xB70Du, 0.00000000 },
+  { 0xB70Eu, 0.00000000 },
+  { 0xB70Fu, 0.00000000 },
+  { 0xB710u, 0.00000000 },
+  { 0xB711u, 0.00000000 },
+  { 0xB712u, 0.00000000 },
+  { 0xB713u, 0.00000000 },
+  { 0xB714u, 0.00000000 },
+  { 0xB715u, 0.00000000 },
+  { 0xB716u, 0.00000000 },
+  { 0xB717u, 0.00000000 },
+  { 0xB718u, 0.00000000 },
+  { 0xB719u, 0.00000000 },
+  { 0xB71Au, 0.00000000 },
+  { 0xB71Bu, 0.00000000 },
+  { 0xB71Cu, 0.00000000 },
+  { 0xB71Du, 0.00000000 },
+  { 0xB71Eu, 0.00000000 },
+  { 0xB71Fu, 0.00000000 },
+  { 0xB720u, 0.00000000 },
+  { 0xB721u, 0.00000000 },
+  { 0xB722u, 0.00000000 },
+  { 0xB723u, 0.00000000 },
+  { 0xB724u, 0.00000000 },
+  { 0xB725u, 0.00000000 },
+  { 0xB726u, 0.00000000 },
+  { 0xB727u, 0.00000000 },
+  { 0xB728u, 0.00010000 },
+  { 0xB729u, 0.00000000 },
+  { 0xB72Au, 0.00000000 },
+  { 0xB72Bu, 0.00000000 },
+  { 0xB72Cu, 0.00000000 },
+  { 0xB72Du, 0.00000000 },
+  { 0xB72Eu, 0.00000000 },
+  { 0xB72Fu, 0.00000000 },
+  { 0xB730u, 0.00000000 },
+  { 0xB731u, 0.00000000 },
+  { 0xB732u, 0.00000000 },
+  { 0xB733u, 0.00000000 },
+  { 0xB734u, 0.00000000 },
+  { 0xB735u, 0.00000000 },
+  { 0xB736u, 0.00000000 },
+  { 0xB737u, 0.00000000 },
+  { 0xB738u, 0.00000000 },
+  { 0xB739u, 0.00000000 },
+  { 0xB73Au, 0.00000000 },
+  { 0xB73Bu, 0.00020000 },
+  { 0xB73Cu, 0.00000000 },
+  { 0xB73Du, 0.00000000 },
+  { 0xB73Eu, 0.00000000 },
+  { 0xB73Fu, 0.00000000 },
+  { 0xB740u, 0.00000000 },
+  { 0xB741u, 0.00000000 },
+  { 0xB742u, 0.00000000 },
+  { 0xB743u, 0.00000000 },
+  { 0xB744u, 0.00000000 },
+  { 0xB745u, 0.00000000 },
+  { 0xB746u, 0.00000000 },
+  { 0xB747u, 0.00000000 },
+  { 0xB748u, 0.00000000 },
+  { 0xB749u, 0.00000000 },
+  { 0xB74Au, 0.00000000 },
+  { 0xB74Bu, 0.00000000 },
+  { 0xB74Cu, 0.00000000 },
+  { 0xB74Du, 0.00000000 },
+  { 0xB74Eu, 0.00000000 },
+  { 0xB74Fu, 0.00000000 },
+  { 0xB750u, 0.00000000 },
+  { 0xB751u, 0.00000000 },
+  { 0xB752u, 0.00000000 },
+  { 0xB753u, 0.00000000 },
+  { 0xB754u, 0.00000000 },
+  { 0xB755u, 0.00000000 },
+  { 0xB756u, 0.00000000 },
+  { 0xB757u, 0.00000000 },
+  { 0xB758u, 0.00000000 },
+  { 0xB759u, 0.00000000 },
+  { 0xB75Au, 0.00000000 },
+  { 0xB75Bu, 0.00000000 },
+  { 0xB75Cu, 0.00000000 },
+  { 0xB75Du, 0.00000000 },
+  { 0xB75Eu, 0.00000000 },
+  { 0xB75Fu, 0.00000000 },
+  { 0xB760u, 0.00000000 },
+  { 0xB761u, 0.00000000 },
+  { 0xB762u, 0.00000000 },
+  { 0xB763u, 0.00000000 },
+  { 0xB764u, 0.00000000 },
+  { 0xB765u, 0.00000000 },
+  { 0xB766u, 0.00000000 },
+  { 0xB767u, 0.00000000 },
+  { 0xB768u, 0.00000000 },
+  { 0xB769u, 0.00000000 },
+  { 0xB76Au, 0.00000000 },
+  { 0xB76Bu, 0.00000000 },
+  { 0xB76Cu, 0.00000000 },
+  { 0xB76Du, 0.00000000 },
+  { 0xB76Eu, 0.00000000 },
+  { 0xB76Fu, 0.00000000 },
+  { 0xB770u, 0.00000000 },
+  { 0xB771u, 0.00000000 },
+  { 0xB772u, 0.00000000 },
+  { 0xB773u, 0.00000000 },
+  { 0xB774u, 0.00000000 },
+  { 0xB775u, 0.00000000 },
+  { 0xB776u, 0.00000000 },
+  { 0xB777u, 0.00000000 },
+  { 0xB778u, 0.00000000 },
+  { 0xB779u, 0.00000000 },
+  { 0xB77Au, 0.00000000 },
+  { 0xB77Bu, 0.00000000 },
+  { 0xB77Cu, 0.00650000 },
+  { 0xB77Du, 0.00030000 },
+  { 0xB77Eu, 0.00000000 },
+  { 0xB77Fu, 0.00000000 },
+  { 0xB780u, 0.00090000 },
+  { 0xB781u, 0.00000000 },
+  { 0xB782u, 0.00000000 },
+  { 0xB783u, 0.00000000 },
+  { 0xB784u, 0.00000000 },
+  { 0xB785u, 0.00000000 },
+  { 0xB786u, 0.00000000 },
+  { 0xB787u, 0.00000000 },
+  { 0xB788u, 0.00000000 },
+  { 0xB789u, 0.00000000 },
+  { 0xB78Au, 0.00000000 },
+  { 0xB78Bu, 0.00000000 },
+  { 0xB78Cu, 0.00070000 },
+  { 0xB78Du, 0.00010000 },
+  { 0xB78Eu, 0.00000000 },
+  { 0xB78Fu, 0.00000000 },
+  { 0xB790u, 0.00010000 },
+  { 0xB791u, 0.00070000 },
+  { 0xB792u, 0.00000000 },
+  { 0xB793u, 0.00000000 },
+  { 0xB794u, 0.00000000 },
+  { 0xB795u, 0.00000000 },
+  { 0xB796u, 0.00000000 },
+  { 0xB797u, 0.00000000 },
+  { 0xB798u, 0.00110000 },
+  { 0xB799u, 0.00010000 },
+  { 0xB79Au, 0.00000000 },
+  { 0xB79Bu, 0.00000000 },
+  { 0xB79Cu, 0.00040000 },
+  { 0xB79Du, 0.00000000 },
+  { 0xB79Eu, 0.00000000 },
+  { 0xB79Fu, 0.00000000 },
+  { 0xB7A0u, 0.00000000 },
+  { 0xB7A1u, 0.00000000 },
+  { 0xB7A2u, 0.00000000 },
+  { 0xB7A3u, 0.00000000 },
+  { 0xB7A4u, 0.00000000 },
+  { 0xB7A5u, 0.00000000 },
+  { 0xB7A6u, 0.00000000 },
+  { 0xB7A7u, 0.00000000 },
+  { 0xB7A8u, 0.00020000 },
+  { 0xB7A9u, 0.00000000 },
+  { 0xB7AAu, 0.00000000 },
+  { 0xB7ABu, 0.00010000 },
+  { 0xB7ACu, 0.00000000 },
+  { 0xB7ADu, 0.00010000 },
+  { 0xB7AEu, 0.00000000 },
+  { 0xB7AFu, 0.00000000 },
+  { 0xB7B0u, 0.00000000 },
+  { 0xB7B1u, 0.00000000 },
+  { 0xB7B2u, 0.00000000 },
+  { 0xB7B3u, 0.00000000 },
+  { 0xB7B4u, 0.00000000 },
+  { 0xB7B5u, 0.00010000 },
+  { 0xB7B6u, 0.00000000 },
+  { 0xB7B7u, 0.00000000 },
+  { 0xB7B8u, 0.00000000 },
+  { 0xB7B9u, 0.00000000 },
+  { 0xB7BAu, 0.00000000 },
+  { 0xB7BBu, 0.00000000 },
+  { 0xB7BCu, 0.00000000 },
+  { 0xB7BDu, 0.00000000 },
+  { 0xB7BEu, 0.00000000 },
+  { 0xB7BFu, 0.00000000 },
+  { 0xB7C0u, 0.00000000 },
+  { 0xB7C1u, 0.00000000 },
+  { 0xB7C2u, 0.00000000 },
+  { 0xB7C3u, 0.00000000 },
+  { 0xB7C4u, 0.00000000 },
+  { 0xB7C5u, 0.00000000 },
+  { 0xB7C6u, 0.00000000 },
+  { 0xB7C7u, 0.00000000 },
+  { 0xB7C8u, 0.00000000 },
+  { 0xB7C9u, 0.00060000 },
+  { 0xB7CAu, 0.00000000 },
+  { 0xB7CBu, 0.00000000 },
+  { 0xB7CCu, 0.00000000 },
+  { 0xB7CDu, 0.00000000 },
+  { 0xB7CEu, 0.00000000 },
+  { 0xB7CFu, 0.00000000 },
+  { 0xB7D0u, 0.00000000 },
+  { 0xB7D1u, 0.00000000 },
+  { 0xB7D2u, 0.00000000 },
+  { 0xB7D3u, 0.00000000 },
+  { 0xB7D4u, 0.00000000 },
+  { 0xB7D5u, 0.00000000 },
+  { 0xB7D6u, 0.00000000 },
+  { 0xB7D7u, 0.00000000 },
+  { 0xB7D8u, 0.00000000 },
+  { 0xB7D9u, 0.00000000 },
+  { 0xB7DAu, 0.00000000 },
+  { 0xB7DBu, 0.00000000 },
+  { 0xB7DCu, 0.00000000 },
+  { 0xB7DDu, 0.00000000 },
+  { 0xB7DEu, 0.00000000 },
+  { 0xB7DFu, 0.00000000 },
+  { 0xB7E0u, 0.00000000 },
+  { 0xB7E1u, 0.00000000 },
+  { 0xB7E2u, 0.00000000 },
+  { 0xB7E3u, 0.00000000 },
+  { 0xB7E4u, 0.00000000 },
+  { 0xB7E5u, 0.00000000 },
+  { 0xB7E6u, 0.00000000 },
+  { 0xB7E7u, 0.00000000 },
+  { 0xB7E8u, 0.00000000 },
+  { 0xB7E9u, 0.00000000 },
+  { 0xB7EAu, 0.00000000 },
+  { 0xB7EBu, 0.00000000 },
+  { 0xB7ECu, 0.00240000 },
+  { 0xB7EDu, 0.00000000 },
+  { 0xB7EEu, 0.00000000 },
+  { 0xB7EFu, 0.00000000 },
+  { 0xB7F0u, 0.00040000 },
+  { 0xB7F1u, 0.00000000 },
+  { 0xB7F2u, 0.00000000 },
+  { 0xB7F3u, 0.00000000 },
+  { 0xB7F4u, 0.00000000 },
+  { 0xB7F5u, 0.00000000 },
+  { 0xB7F6u, 0.00000000 },
+  { 0xB7F7u, 0.00000000 },
+  { 0xB7F8u, 0.00000000 },
+  { 0xB7F9u, 0.00000000 },
+  { 0xB7FAu, 0.00000000 },
+  { 0xB7FBu, 0.00000000 },
+  { 0xB7FCu, 0.00020000 },
+  { 0xB7FDu, 0.00040000 },
+  { 0xB7FEu, 0.00000000 },
+  { 0xB7FFu, 0.00000000 },
+  { 0xB800u, 0.00010000 },
+  { 0xB801u, 0.00000000 },
+  { 0xB802u, 0.00000000 },
+  { 0xB803u, 0.00000000 },
+  { 0xB804u, 0.00000000 },
+  { 0xB805u, 0.00000000 },
+  { 0xB806u, 0.00000000 },
+  { 0xB807u, 0.00010000 },
+  { 0xB808u, 0.00190000 },
+  { 0xB809u, 0.00010000 },
+  { 0xB80Au, 0.00000000 },
+  { 0xB80Bu, 0.00000000 },
+  { 0xB80Cu, 0.00020000 },
+  { 0xB80Du, 0.00000000 },
+  { 0xB80Eu, 0.00000000 },
+  { 0xB80Fu, 0.00000000 },
+  { 0xB810u, 0.00000000 },
+  { 0xB811u, 0.00000000 },
+  { 0xB812u, 0.00000000 },
+  { 0xB813u, 0.00000000 },
+  { 0xB814u, 0.00000000 },
+  { 0xB815u, 0.00000000 },
+  { 0xB816u, 0.00000000 },
+  { 0xB817u, 0.00000000 },
+  { 0xB818u, 0.00000000 },
+  { 0xB819u, 0.00000000 },
+  { 0xB81Au, 0.00000000 },
+  { 0xB81Bu, 0.00000000 },
+  { 0xB81Cu, 0.00000000 },
+  { 0xB81Du, 0.00000000 },
+  { 0xB81Eu, 0.00000000 },
+  { 0xB81Fu, 0.00000000 },
+  { 0xB820u, 0.00000000 },
+  { 0xB821u, 0.00000000 },
+  { 0xB822u, 0.00000000 },
+  { 0xB823u, 0.00000000 },
+  { 0xB824u, 0.00140000 },
+  { 0xB825u, 0.00130000 },
+  { 0xB826u, 0.00000000 },
+  { 0xB827u, 0.00000000 },
+  { 0xB828u, 0.00050000 },
+  { 0xB829u, 0.00000000 },
+  { 0xB82Au, 0.00000000 },
+  { 0xB82Bu, 0.00000000 },
+  { 0xB82Cu, 0.00010000 },
+  { 0xB82Du, 0.00000000 },
+  { 0xB82Eu, 0.00000000 },
+  { 0xB82Fu, 0.00000000 },
+  { 0xB830u, 0.00000000 },
+  { 0xB831u, 0.00000000 },
+  { 0xB832u, 0.00000000 },
+  { 0xB833u, 0.00000000 },
+  { 0xB834u, 0.00000000 },
+  { 0xB835u, 0.00010000 },
+  { 0xB836u, 0.00000000 },
+  { 0xB837u, 0.00000000 },
+  { 0xB838u, 0.00030000 },
+  { 0xB839u, 0.00080000 },
+  { 0xB83Au, 0.00000000 },
+  { 0xB83Bu, 0.00000000 },
+  { 0xB83Cu, 0.00000000 },
+  { 0xB83Du, 0.00000000 },
+  { 0xB83Eu, 0.00000000 },
+  { 0xB83Fu, 0.00000000 },
+  { 0xB840u, 0.00030000 },
+  { 0xB841u, 0.00000000 },
+  { 0xB842u, 0.00000000 },
+  { 0xB843u, 0.00000000 },
+  { 0xB844u, 0.00000000 },
+  { 0xB845u, 0.00000000 },
+  { 0xB846u, 0.00000000 },
+  { 0xB847u, 0.00000000 },
+  { 0xB848u, 0.00000000 },
+  { 0xB849u, 0.00000000 },
+  { 0xB84Au, 0.00000000 },
+  { 0xB84Bu, 0.00000000 },
+  { 0xB84Cu, 0.00000000 },
+  { 0xB84Du, 0.00000000 },
+  { 0xB84Eu, 0.00000000 },
+  { 0xB84Fu, 0.00000000 },
+  { 0xB850u, 0.00000000 },
+  { 0xB851u, 0.00000000 },
+  { 0xB852u, 0.00000000 },
+  { 0xB853u, 0.00000000 },
+  { 0xB854u, 0.00000000 },
+  { 0xB855u, 0.00000000 },
+  { 0xB856u, 0.00000000 },
+  { 0xB857u, 0.00000000 },
+  { 0xB858u, 0.00000000 },
+  { 0xB859u, 0.00000000 },
+  { 0xB85Au, 0.00000000 },
+  { 0xB85Bu, 0.00000000 },
+  { 0xB85Cu, 0.01850000 },
+  { 0xB85Du, 0.00110000 },
+  { 0xB85Eu, 0.00000000 },
+  { 0xB85Fu, 0.00000000 },
+  { 0xB860u, 0.00060000 },
+  { 0xB861u, 0.00000000 },
+  { 0xB862u, 0.00000000 },
+  { 0xB863u, 0.00000000 },
+  { 0xB864u, 0.00010000 },
+  { 0xB865u, 0.00000000 },
+  { 0xB866u, 0.00000000 },
+  { 0xB867u, 0.00000000 },
+  { 0xB868u, 0.00000000 },
+  { 0xB869u, 0.00000000 },
+  { 0xB86Au, 0.00000000 },
+  { 0xB86Bu, 0.00000000 },
+  { 0xB86Cu, 0.00010000 },
+  { 0xB86Du, 0.00010000 },
+  { 0xB86Eu, 0.00000000 },
+  { 0xB86Fu, 0.00020000 },
+  { 0xB870u, 0.00000000 },
+  { 0xB871u, 0.00010000 },
+  { 0xB872u, 0.00000000 },
+  { 0xB873u, 0.00000000 },
+  { 0xB874u, 0.00000000 },
+  { 0xB875u, 0.00000000 },
+  { 0xB876u, 0.00000000 },
+  { 0xB877u, 0.00000000 },
+  { 0xB878u, 0.00000000 },
+  { 0xB879u, 0.00000000 },
+  { 0xB87Au, 0.00000000 },
+  { 0xB87Bu, 0.00000000 },
+  { 0xB87Cu, 0.00000000 },
+  { 0xB87Du, 0.00000000 },
+  { 0xB87Eu, 0.00000000 },
+  { 0xB87Fu, 0.00000000 },
+  { 0xB880u, 0.00000000 },
+  { 0xB881u, 0.00000000 },
+  { 0xB882u, 0.00000000 },
+  { 0xB883u, 0.00000000 },
+  { 0xB884u, 0.00000000 },
+  { 0xB885u, 0.00000000 },
+  { 0xB886u, 0.00000000 },
+  { 0xB887u, 0.00000000 },
+  { 0xB888u, 0.00000000 },
+  { 0xB889u, 0.00000000 },
+  { 0xB88Au, 0.00000000 },
+  { 0xB88Bu, 0.00000000 },
+  { 0xB88Cu, 0.00000000 },
+  { 0xB88Du, 0.00000000 },
+  { 0xB88Eu, 0.00000000 },
+  { 0xB88Fu, 0.00000000 },
+  { 0xB890u, 0.00000000 },
+  { 0xB891u, 0.00000000 },
+  { 0xB892u, 0.00000000 },
+  { 0xB893u, 0.00000000 },
+  { 0xB894u, 0.00000000 },
+  { 0xB895u, 0.00000000 },
+  { 0xB896u, 0.00000000 },
+  { 0xB897u, 0.00000000 },
+  { 0xB898u, 0.00000000 },
+  { 0xB899u, 0.00000000 },
+  { 0xB89Au, 0.00000000 },
+  { 0xB89Bu, 0.00000000 },
+  { 0xB89Cu, 0.00000000 },
+  { 0xB89Du, 0.00000000 },
+  { 0xB89Eu, 0.00000000 },
+  { 0xB89Fu, 0.00000000 },
+  { 0xB8A0u, 0.00000000 },
+  { 0xB8A1u, 0.00000000 },
+  { 0xB8A2u, 0.00000000 },
+  { 0xB8A3u, 0.00000000 },
+  { 0xB8A4u, 0.00000000 },
+  { 0xB8A5u, 0.00000000 },
+  { 0xB8A6u, 0.00000000 },
+  { 0xB8A7u, 0.00000000 },
+  { 0xB8A8u, 0.00000000 },
+  { 0xB8A9u, 0.00000000 },
+  { 0xB8AAu, 0.00000000 },
+  { 0xB8ABu, 0.00000000 },
+  { 0xB8ACu, 0.00000000 },
+  { 0xB8ADu, 0.00000000 },
+  { 0xB8AEu, 0.00000000 },
+  { 0xB8AFu, 0.00000000 },
+  { 0xB8B0u, 0.00010000 },
+  { 0xB8B1u, 0.00000000 },
+  { 0xB8B2u, 0.00000000 },
+  { 0xB8B3u, 0.00000000 },
+  { 0xB8B4u, 0.00000000 },
+  { 0xB8B5u, 0.00000000 },
+  { 0xB8B6u, 0.00000000 },
+  { 0xB8B7u, 0.00000000 },
+  { 0xB8B8u, 0.00000000 },
+  { 0xB8B9u, 0.00000000 },
+  { 0xB8BAu, 0.00000000 },
+  { 0xB8BBu, 0.00000000 },
+  { 0xB8BCu, 0.00000000 },
+  { 0xB8BDu, 0.00000000 },
+  { 0xB8BEu, 0.00000000 },
+  { 0xB8BFu, 0.00000000 },
+  { 0xB8C0u, 0.00000000 },
+  { 0xB8C1u, 0.00000000 },
+  { 0xB8C2u, 0.00000000 },
+  { 0xB8C3u, 0.00000000 },
+  { 0xB8C4u, 0.00000000 },
+  { 0xB8C5u, 0.00000000 },
+  { 0xB8C6u, 0.00000000 },
+  { 0xB8C7u, 0.00000000 },
+  { 0xB8C8u, 0.00000000 },
+  { 0xB8C9u, 0.00000000 },
+  { 0xB8CAu, 0.00000000 },
+  { 0xB8CBu, 0.00000000 },
+  { 0xB8CCu, 0.00050000 },
+  { 0xB8CDu, 0.00000000 },
+  { 0xB8CEu, 0.00000000 },
+  { 0xB8CFu, 0.00000000 },
+  { 0xB8D0u, 0.00000000 },
+  { 0xB8D1u, 0.00000000 },
+  { 0xB8D2u, 0.00000000 },
+  { 0xB8D3u, 0.00000000 },
+  { 0xB8D4u, 0.00000000 },
+  { 0xB8D5u, 0.00000000 },
+  { 0xB8D6u, 0.00000000 },
+  { 0xB8D7u, 0.00000000 },
+  { 0xB8D8u, 0.00000000 },
+  { 0xB8D9u, 0.00000000 },
+  { 0xB8DAu, 0.00000000 },
+  { 0xB8DBu, 0.00000000 },
+  { 0xB8DCu, 0.00000000 },
+  { 0xB8DDu, 0.00000000 },
+  { 0xB8DEu, 0.00000000 },
+  { 0xB8DFu, 0.00000000 },
+  { 0xB8E0u, 0.00000000 },
+  { 0xB8E1u, 0.00010000 },
+  { 0xB8E2u, 0.00000000 },
+  { 0xB8E3u, 0.00000000 },
+  { 0xB8E4u, 0.00000000 },
+  { 0xB8E5u, 0.00000000 },
+  { 0xB8E6u, 0.00000000 },
+  { 0xB8E7u, 0.00000000 },
+  { 0xB8E8u, 0.00140000 },
+  { 0xB8E9u, 0.00000000 },
+  { 0xB8EAu, 0.00000000 },
+  { 0xB8EBu, 0.00000000 },
+  { 0xB8ECu, 0.00010000 },
+  { 0xB8EDu, 0.00000000 },
+  { 0xB8EEu, 0.00000000 },
+  { 0xB8EFu, 0.00000000 },
+  { 0xB8F0u, 0.00000000 },
+  { 0xB8F1u, 0.00000000 },
+  { 0xB8F2u, 0.00000000 },
+  { 0xB8F3u, 0.00000000 },
+  { 0xB8F4u, 0.00000000 },
+  { 0xB8F5u, 0.00000000 },
+  { 0xB8F6u, 0.00000000 },
+  { 0xB8F7u, 0.00000000 },
+  { 0xB8F8u, 0.00000000 },
+  { 0xB8F9u, 0.00020000 },
+  { 0xB8FAu, 0.00000000 },
+  { 0xB8FBu, 0.00000000 },
+  { 0xB8FCu, 0.00000000 },
+  { 0xB8FDu, 0.00000000 },
+  { 0xB8FEu, 0.00000000 },
+  { 0xB8FFu, 0.00000000 },
+  { 0xB900u, 0.00000000 },
+  { 0xB901u, 0.00000000 },
+  { 0xB902u, 0.00000000 },
+  { 0xB903u, 0.00000000 },
+  { 0xB904u, 0.00000000 },
+  { 0xB905u, 0.00000000 },
+  { 0xB906u, 0.00000000 },
+  { 0xB907u, 0.00000000 },
+  { 0xB908u, 0.00000000 },
+  { 0xB909u, 0.00000000 },
+  { 0xB90Au, 0.00000000 },
+  { 0xB90Bu, 0.00000000 },
+  { 0xB90Cu, 0.00000000 },
+  { 0xB90Du, 0.00000000 },
+  { 0xB90Eu, 0.00000000 },
+  { 0xB90Fu, 0.00000000 },
+  { 0xB910u, 0.00000000 },
+  { 0xB911u, 0.00000000 },
+  { 0xB912u, 0.00000000 },
+  { 0xB913u, 0.00000000 },
+  { 0xB914u, 0.00000000 },
+  { 0xB915u, 0.00000000 },
+  { 0xB916u, 0.00000000 },
+  { 0xB917u, 0.00000000 },
+  { 0xB918u, 0.00000000 },
+  { 0xB919u, 0.00000000 },
+  { 0xB91Au, 0.00000000 },
+  { 0xB91Bu, 0.00000000 },
+  { 0xB91Cu, 0.00000000 },
+  { 0xB91Du, 0.00000000 },
+  { 0xB91Eu, 0.00000000 },
+  { 0xB91Fu, 0.00000000 },
+  { 0xB920u, 0.00000000 },
+  { 0xB921u, 0.00000000 },
+  { 0xB922u, 0.00000000 },
+  { 0xB923u, 0.00000000 },
+  { 0xB924u, 0.00000000 },
+  { 0xB925u, 0.00000000 },
+  { 0xB926u, 0.00000000 },
+  { 0xB927u, 0.00000000 },
+  { 0xB928u, 0.00000000 },
+  { 0xB929u, 0.00000000 },
+  { 0xB92Au, 0.00000000 },
+  { 0xB92Bu, 0.00000000 },
+  { 0xB92Cu, 0.00000000 },
+  { 0xB92Du, 0.00000000 },
+  { 0xB92Eu, 0.00000000 },
+  { 0xB92Fu, 0.00000000 },
+  { 0xB930u, 0.00000000 },
+  { 0xB931u, 0.00000000 },
+  { 0xB932u, 0.00000000 },
+  { 0xB933u, 0.00000000 },
+  { 0xB934u, 0.00000000 },
+  { 0xB935u, 0.00000000 },
+  { 0xB936u, 0.00000000 },
+  { 0xB937u, 0.00000000 },
+  { 0xB938u, 0.00000000 },
+  { 0xB939u, 0.00000000 },
+  { 0xB93Au, 0.00000000 },
+  { 0xB93Bu, 0.00000000 },
+  { 0xB93Cu, 0.00000000 },
+  { 0xB93Du, 0.00000000 },
+  { 0xB93Eu, 0.00000000 },
+  { 0xB93Fu, 0.00000000 },
+  { 0xB940u, 0.00000000 },
+  { 0xB941u, 0.00000000 },
+  { 0xB942u, 0.00000000 },
+  { 0xB943u, 0.00000000 },
+  { 0xB944u, 0.00000000 },
+  { 0xB945u, 0.00000000 },
+  { 0xB946u, 0.00000000 },
+  { 0xB947u, 0.00000000 },
+  { 0xB948u, 0.00000000 },
+  { 0xB949u, 0.00000000 },
+  { 0xB94Au, 0.00000000 },
+  { 0xB94Bu, 0.00000000 },
+  { 0xB94Cu, 0.00000000 },
+  { 0xB94Du, 0.00000000 },
+  { 0xB94Eu, 0.00000000 },
+  { 0xB94Fu, 0.00000000 },
+  { 0xB950u, 0.00000000 },
+  { 0xB951u, 0.00000000 },
+  { 0xB952u, 0.00000000 },
+  { 0xB953u, 0.00000000 },
+  { 0xB954u, 0.00000000 },
+  { 0xB955u, 0.00000000 },
+  { 0xB956u, 0.00000000 },
+  { 0xB957u, 0.00000000 },
+  { 0xB958u, 0.00070000 },
+  { 0xB959u, 0.00010000 },
+  { 0xB95Au, 0.00000000 },
+  { 0xB95Bu, 0.00000000 },
+  { 0xB95Cu, 0.00000000 },
+  { 0xB95Du, 0.00000000 },
+  { 0xB95Eu, 0.00000000 },
+  { 0xB95Fu, 0.00000000 },
+  { 0xB960u, 0.00020000 },
+  { 0xB961u, 0.00000000 },
+  { 0xB962u, 0.00000000 },
+  { 0xB963u, 0.00000000 },
+  { 0xB964u, 0.00000000 },
+  { 0xB965u, 0.00000000 },
+  { 0xB966u, 0.00000000 },
+  { 0xB967u, 0.00000000 },
+  { 0xB968u, 0.00000000 },
+  { 0xB969u, 0.00000000 },
+  { 0xB96Au, 0.00000000 },
+  { 0xB96Bu, 0.00000000 },
+  { 0xB96Cu, 0.00000000 },
+  { 0xB96Du, 0.00000000 },
+  { 0xB96Eu, 0.00000000 },
+  { 0xB96Fu, 0.00000000 },
+  { 0xB970u, 0.00000000 },
+  { 0xB971u, 0.00000000 },
+  { 0xB972u, 0.00000000 },
+  { 0xB973u, 0.00000000 },
+  { 0xB974u, 0.00280000 },
+  { 0xB975u, 0.00000000 },
+  { 0xB976u, 0.00000000 },
+  { 0xB977u, 0.00000000 },
+  { 0xB978u, 0.00090000 },
+  { 0xB979u, 0.00000000 },
+  { 0xB97Au, 0.00000000 },
+  { 0xB97Bu, 0.00000000 },
+  { 0xB97Cu, 0.00930000 },
+  { 0xB97Du, 0.00000000 },
+  { 0xB97Eu, 0.00000000 },
+  { 0xB97Fu, 0.00000000 },
+  { 0xB980u, 0.00000000 },
+  { 0xB981u, 0.00000000 },
+  { 0xB982u, 0.00000000 },
+  { 0xB983u, 0.00000000 },
+  { 0xB984u, 0.00080000 },
+  { 0xB985u, 0.00000000 },
+  { 0xB986u, 0.00000000 },
+  { 0xB987u, 0.00000000 },
+  { 0xB988u, 0.00000000 },
+  { 0xB989u, 0.00010000 },
+  { 0xB98Au, 0.00000000 },
+  { 0xB98Bu, 0.00000000 },
+  { 0xB98Cu, 0.00000000 },
+  { 0xB98Du, 0.00000000 },
+  { 0xB98Eu, 0.00000000 },
+  { 0xB98Fu, 0.00000000 },
+  { 0xB990u, 0.00000000 },
+  { 0xB991u, 0.00000000 },
+  { 0xB992u, 0.00000000 },
+  { 0xB993u, 0.00000000 },
+  { 0xB994u, 0.00000000 },
+  { 0xB995u, 0.00000000 },
+  { 0xB996u, 0.00000000 },
+  { 0xB997u, 0.00000000 },
+  { 0xB998u, 0.00000000 },
+  { 0xB999u, 0.00000000 },
+  { 0xB99Au, 0.00000000 },
+  { 0xB99Bu, 0.00000000 },
+  { 0xB99Cu, 0.00000000 },
+  { 0xB99Du, 0.00000000 },
+  { 0xB99Eu, 0.00000000 },
+  { 0xB99Fu, 0.00000000 },
+  { 0xB9A0u, 0.00000000 },
+  { 0xB9A1u, 0.00000000 },
+  { 0xB9A2u, 0.00000000 },
+  { 0xB9A3u, 0.00000000 },
+  { 0xB9A4u, 0.00000000 },
+  { 0xB9A5u, 0.00000000 },
+  { 0xB9A6u, 0.00000000 },
+  { 0xB9A7u, 0.00000000 },
+  { 0xB9A8u, 0.00000000 },
+  { 0xB9A9u, 0.00000000 },
+  { 0xB9AAu, 0.00000000 },
+  { 0xB9ABu, 0.00000000 },
+  { 0xB9ACu, 0.00890000 },
+  { 0xB9ADu, 0.00020000 },
+  { 0xB9AEu, 0.00000000 },
+  { 0xB9AFu, 0.00000000 },
+  { 0xB9B0u, 0.00080000 },
+  { 0xB9B1u, 0.00000000 },
+  { 0xB9B2u, 0.00000000 },
+  { 0xB9B3u, 0.00000000 },
+  { 0xB9B4u, 0.00010000 },
+  { 0xB9B5u, 0.00000000 },
+  { 0xB9B6u, 0.00000000 },
+  { 0xB9B7u, 0.00000000 },
+  { 0xB9B8u, 0.00000000 },
+  { 0xB9B9u, 0.00000000 },
+  { 0xB9BAu, 0.00000000 },
+  { 0xB9BBu, 0.00000000 },
+  { 0xB9BCu, 0.00050000 },
+  { 0xB9BDu, 0.00100000 },
+  { 0xB9BEu, 0.00000000 },
+  { 0xB9BFu, 0.00000000 },
+  { 0xB9C0u, 0.00000000 },
+  { 0xB9C1u, 0.00020000 },
+  { 0xB9C2u, 0.00000000 },
+  { 0xB9C3u, 0.00000000 },
+  { 0xB9C4u, 0.00000000 },
+  { 0xB9C5u, 0.00000000 },
+  { 0xB9C6u, 0.00000000 },
+  { 0xB9C7u, 0.00000000 },
+  { 0xB9C8u, 0.00350000 },
+  { 0xB9C9u, 0.00040000 },
+  { 0xB9CAu, 0.00000000 },
+  { 0xB9CBu, 0.00000000 },
+  { 0xB9CCu, 0.00370000 },
+  { 0xB9CDu, 0.00000000 },
+  { 0xB9CEu, 0.00080000 },
+  { 0xB9CFu, 0.00000000 },
+  { 0xB9D0u, 0.00100000 },
+  { 0xB9D1u, 0.00000000 },
+  { 0xB9D2u, 0.00000000 },
+  { 0xB9D3u, 0.00000000 },
+  { 0xB9D4u, 0.00000000 },
+  { 0xB9D5u, 0.00000000 },
+  { 0xB9D6u, 0.00000000 },
+  { 0xB9D7u, 0.00000000 },
+  { 0xB9D8u, 0.00000000 },
+  { 0xB9D9u, 0.00000000 },
+  { 0xB9DAu, 0.00000000 },
+  { 0xB9DBu, 0.00000000 },
+  { 0xB9DCu, 0.00000000 },
+  { 0xB9DDu, 0.00050000 },
+  { 0xB9DEu, 0.00020000 },
+  { 0xB9DFu, 0.00000000 },
+  { 0xB9E0u, 0.00000000 },
+  { 0xB9E1u, 0.00020000 },
+  { 0xB9E2u, 0.00000000 },
+  { 0xB9E3u, 0.00000000 },
+  { 0xB9E4u, 0.00110000 },
+  { 0xB9E5u, 0.00020000 },
+  { 0xB9E6u, 0.00000000 },
+  { 0xB9E7u, 0.00000000 },
+  { 0xB9E8u, 0.00010000 },
+  { 0xB9E9u, 0.00000000 },
+  { 0xB9EAu, 0.00000000 },
+  { 0xB9EBu, 0.00000000 },
+  { 0xB9ECu, 0.00000000 },
+  { 0xB9EDu, 0.00000000 },
+  { 0xB9EEu, 0.00000000 },
+  { 0xB9EFu, 0.00000000 },
+  { 0xB9F0u, 0.00000000 },
+  { 0xB9F1u, 0.00000000 },
+  { 0xB9F2u, 0.00000000 },
+  { 0xB9F3u, 0.00000000 },
+  { 0xB9F4u, 0.00000000 },
+  { 0xB9F5u, 0.00000000 },
+  { 0xB9F6u, 0.00000000 },
+  { 0xB9F7u, 0.00000000 },
+  { 0xB9F8u, 0.00000000 },
+  { 0xB9F9u, 0.00020000 },
+  { 0xB9FAu, 0.00010000 },
+  { 0xB9FBu, 0.00000000 },
+  { 0xB9FCu, 0.00000000 },
+  { 0xB9FDu, 0.00000000 },
+  { 0xB9FEu, 0.00000000 },
+  { 0xB9FFu, 0.00000000 },
+  { 0xBA00u, 0.00000000 },
+  { 0xBA01u, 0.00000000 },
+  { 0xBA02u, 0.00000000 },
+  { 0xBA03u, 0.00000000 },
+  { 0xBA04u, 0.00000000 },
+  { 0xBA05u, 0.00000000 },
+  { 0xBA06u, 0.00000000 },
+  { 0xBA07u, 0.00000000 },
+  { 0xBA08u, 0.00000000 },
+  { 0xBA09u, 0.00000000 },
+  { 0xBA0Au, 0.00000000 },
+  { 0xBA0Bu, 0.00000000 },
+  { 0xBA0Cu, 0.00000000 },
+  { 0xBA0Du, 0.00000000 },
+  { 0xBA0Eu, 0.00000000 },
+  { 0xBA0Fu, 0.00000000 },
+  { 0xBA10u, 0.00000000 },
+  { 0xBA11u, 0.00000000 },
+  { 0xBA12u, 0.00000000 },
+  { 0xBA13u, 0.00000000 },
+  { 0xBA14u, 0.00000000 },
+  { 0xBA15u, 0.00000000 },
+  { 0xBA16u, 0.00000000 },
+  { 0xBA17u, 0.00000000 },
+  { 0xBA18u, 0.00000000 },
+  { 0xBA19u, 0.00000000 },
+  { 0xBA1Au, 0.00000000 },
+  { 0xBA1Bu, 0.00000000 },
+  { 0xBA1Cu, 0.00000000 },
+  { 0xBA1Du, 0.00000000 },
+  { 0xBA1Eu, 0.00000000 },
+  { 0xBA1Fu, 0.00000000 },
+  { 0xBA20u, 0.00000000 },
+  { 0xBA21u, 0.00000000 },
+  { 0xBA22u, 0.00000000 },
+  { 0xBA23u, 0.00000000 },
+  { 0xBA24u, 0.00000000 },
+  { 0xBA25u, 0.00000000 },
+  { 0xBA26u, 0.00000000 },
+  { 0xBA27u, 0.00000000 },
+  { 0xBA28u, 0.00000000 },
+  { 0xBA29u, 0.00000000 },
+  { 0xBA2Au, 0.00000000 },
+  { 0xBA2Bu, 0.00000000 },
+  { 0xBA2Cu, 0.00000000 },
+  { 0xBA2Du, 0.00000000 },
+  { 0xBA2Eu, 0.00000000 },
+  { 0xBA2Fu, 0.00000000 },
+  { 0xBA30u, 0.00000000 },
+  { 0xBA31u, 0.00000000 },
+  { 0xBA32u, 0.00000000 },
+  { 0xBA33u, 0.00000000 },
+  { 0xBA34u, 0.00000000 },
+  { 0xBA35u, 0.00000000 },
+  { 0xBA36u, 0.00000000 },
+  { 0xBA37u, 0.00000000 },
+  { 0xBA38u, 0.00050000 },
+  { 0xBA39u, 0.00010000 },
+  { 0xBA3Au, 0.00000000 },
+  { 0xBA3Bu, 0.00000000 },
+  { 0xBA3Cu, 0.00020000 },
+  { 0xBA3Du, 0.00000000 },
+  { 0xBA3Eu, 0.00000000 },
+  { 0xBA3Fu, 0.00000000 },
+  { 0xBA40u, 0.00010000 },
+  { 0xBA41u, 0.00000000 },
+  { 0xBA42u, 0.00000000 },
+  { 0xBA43u, 0.00000000 },
+  { 0xBA44u, 0.00000000 },
+  { 0xBA45u, 0.00000000 },
+  { 0xBA46u, 0.00000000 },
+  { 0xBA47u, 0.00000000 },
+  { 0xBA48u, 0.00000000 },
+  { 0xBA49u, 0.00000000 },
+  { 0xBA4Au, 0.00000000 },
+  { 0xBA4Bu, 0.00000000 },
+  { 0xBA4Cu, 0.00000000 },
+  { 0xBA4Du, 0.00000000 },
+  { 0xBA4Eu, 0.00000000 },
+  { 0xBA4Fu, 0.00000000 },
+  { 0xBA50u, 0.00000000 },
+  { 0xBA51u, 0.00000000 },
+  { 0xBA52u, 0.00000000 },
+  { 0xBA53u, 0.00000000 },
+  { 0xBA54u, 0.00100000 },
+  { 0xBA55u, 0.00010000 },
+  { 0xBA56u, 0.00000000 },
+  { 0xBA57u, 0.00000000 },
+  { 0xBA58u, 0.00010000 },
+  { 0xBA59u, 0.00000000 },
+  { 0xBA5Au, 0.00000000 },
+  { 0xBA5Bu, 0.00000000 },
+  { 0xBA5Cu, 0.00010000 },
+  { 0xBA5Du, 0.00000000 },
+  { 0xBA5Eu, 0.00000000 },
+  { 0xBA5Fu, 0.00000000 },
+  { 0xBA60u, 0.00000000 },
+  { 0xBA61u, 0.00000000 },
+  { 0xBA62u, 0.00000000 },
+  { 0xBA63u, 0.00000000 },
+  { 0xBA64u, 0.00010000 },
+  { 0xBA65u, 0.00000000 },
+  { 0xBA66u, 0.00000000 },
+  { 0xBA67u, 0.00000000 },
+  { 0xBA68u, 0.00000000 },
+  { 0xBA69u, 0.00000000 },
+  { 0xBA6Au, 0.00000000 },
+  { 0xBA6Bu, 0.00000000 },
+  { 0xBA6Cu, 0.00000000 },
+  { 0xBA6Du, 0.00000000 },
+  { 0xBA6Eu, 0.00000000 },
+  { 0xBA6Fu, 0.00000000 },
+  { 0xBA70u, 0.00360000 },
+  { 0xBA71u, 0.00000000 },
+  { 0xBA72u, 0.00000000 },
+  { 0xBA73u, 0.00000000 },
+  { 0xBA74u, 0.00270000 },
+  { 0xBA75u, 0.00000000 },
+  { 0xBA76u, 0.00000000 },
+  { 0xBA77u, 0.00000000 },
+  { 0xBA78u, 0.00010000 },
+  { 0xBA79u, 0.00000000 },
+  { 0xBA7Au, 0.00000000 },
+  { 0xBA7Bu, 0.00000000 },
+  { 0xBA7Cu, 0.00000000 },
+  { 0xBA7Du, 0.00000000 },
+  { 0xBA7Eu, 0.00000000 },
+  { 0xBA7Fu, 0.00000000 },
+  { 0xBA80u, 0.00000000 },
+  { 0xBA81u, 0.00000000 },
+  { 0xBA82u, 0.00000000 },
+  { 0xBA83u, 0.00000000 },
+  { 0xBA84u, 0.00000000 },
+  { 0xBA85u, 0.00320000 },
+  { 0xBA86u, 0.00000000 },
+  { 0xBA87u, 0.00020000 },
+  { 0xBA88u, 0.00000000 },
+  { 0xBA89u, 0.00000000 },
+  { 0xBA8Au, 0.00000000 },
+  { 0xBA8Bu, 0.00000000 },
+  { 0xBA8Cu, 0.00000000 },
+  { 0xBA8Du, 0.00000000 },
+  { 0xBA8Eu, 0.00000000 },
+  { 0xBA8Fu, 0.00000000 },
+  { 0xBA90u, 0.00000000 },
+  { 0xBA91u, 0.00000000 },
+  { 0xBA92u, 0.00000000 },
+  { 0xBA93u, 0.00000000 },
+  { 0xBA94u, 0.00000000 },
+  { 0xBA95u, 0.00000000 },
+  { 0xBA96u, 0.00000000 },
+  { 0xBA97u, 0.00000000 },
+  { 0xBA98u, 0.00000000 },
+  { 0xBA99u, 0.00000000 },
+  { 0xBA9Au, 0.00000000 },
+  { 0xBA9Bu, 0.00000000 },
+  { 0xBA9Cu, 0.00000000 },
+  { 0xBA9Du, 0.00000000 },
+  { 0xBA9Eu, 0.00000000 },
+  { 0xBA9Fu, 0.00000000 },
+  { 0xBAA0u, 0.00000000 },
+  { 0xBAA1u, 0.00000000 },
+  { 0xBAA2u, 0.00000000 },
+  { 0xBAA3u, 0.00000000 },
+  { 0xBAA4u, 0.00000000 },
+  { 0xBAA5u, 0.00000000 },
+  { 0xBAA6u, 0.00000000 },
+  { 0xBAA7u, 0.00000000 },
+  { 0xBAA8u, 0.00250000 },
+  { 0xBAA9u, 0.00090000 },
+  { 0xBAAAu, 0.00000000 },
+  { 0xBAABu, 0.00000000 },
+  { 0xBAACu, 0.00020000 },
+  { 0xBAADu, 0.00000000 },
+  { 0xBAAEu, 0.00000000 },
+  { 0xBAAFu, 0.00000000 },
+  { 0xBAB0u, 0.00020000 },
+  { 0xBAB1u, 0.00000000 },
+  { 0xBAB2u, 0.00000000 },
+  { 0xBAB3u, 0.00000000 },
+  { 0xBAB4u, 0.00000000 },
+  { 0xBAB5u, 0.00000000 },
+  { 0xBAB6u, 0.00000000 },
+  { 0xBAB7u, 0.00000000 },
+  { 0xBAB8u, 0.00010000 },
+  { 0xBAB9u, 0.00000000 },
+  { 0xBABAu, 0.00000000 },
+  { 0xBABBu, 0.00040000 },
+  { 0xBABCu, 0.00000000 },
+  { 0xBABDu, 0.00010000 },
+  { 0xBABEu, 0.00000000 },
+  { 0xBABFu, 0.00000000 },
+  { 0xBAC0u, 0.00000000 },
+  { 0xBAC1u, 0.00000000 },
+  { 0xBAC2u, 0.00000000 },
+  { 0xBAC3u, 0.00000000 },
+  { 0xBAC4u, 0.00000000 },
+  { 0xBAC5u, 0.00000000 },
+  { 0xBAC6u, 0.00000000 },
+  { 0xBAC7u, 0.00000000 },
+  { 0xBAC8u, 0.00000000 },
+  { 0xBAC9u, 0.00000000 },
+  { 0xBACAu, 0.00000000 },
+  { 0xBACBu, 0.00000000 },
+  { 0xBACCu, 0.00000000 },
+  { 0xBACDu, 0.00000000 },
+  { 0xBACEu, 0.00000000 },
+  { 0xBACFu, 0.00000000 },
+  { 0xBAD0u, 0.00000000 },
+  { 0xBAD1u, 0.00000000 },
+  { 0xBAD2u, 0.00000000 },
+  { 0xBAD3u, 0.00000000 },
+  { 0xBAD4u, 0.00000000 },
+  { 0xBAD5u, 0.00000000 },
+  { 0xBAD6u, 0.00000000 },
+  { 0xBAD7u, 0.00000000 },
+  { 0xBAD8u, 0.00000000 },
+  { 0xBAD9u, 0.00000000 },
+  { 0xBADAu, 0.00000000 },
+  { 0xBADBu, 0.00000000 },
+  { 0xBADCu, 0.00000000 },
+  { 0xBADDu, 0.00000000 },
+  { 0xBADEu, 0.00000000 },
+  { 0xBADFu, 0.00000000 },
+  { 0xBAE0u, 0.00000000 },
+  { 0xBAE1u, 0.00000000 },
+  { 0xBAE2u, 0.00000000 },
+  { 0xBAE3u, 0.00000000 },
+  { 0xBAE4u, 0.00000000 },
+  { 0xBAE5u, 0.00000000 },
+  { 0xBAE6u, 0.00000000 },
+  { 0xBAE7u, 0.00000000 },
+  { 0xBAE8u, 0.00000000 },
+  { 0xBAE9u, 0.00000000 },
+  { 0xBAEAu, 0.00000000 },
+  { 0xBAEBu, 0.00000000 },
+  { 0xBAECu, 0.00000000 },
+  { 0xBAEDu, 0.00000000 },
+  { 0xBAEEu, 0.00000000 },
+  { 0xBAEFu, 0.00000000 },
+  { 0xBAF0u, 0.00000000 },
+  { 0xBAF1u, 0.00000000 },
+  { 0xBAF2u, 0.00000000 },
+  { 0xBAF3u, 0.00000000 },
+  { 0xBAF4u, 0.00000000 },
+  { 0xBAF5u, 0.00000000 },
+  { 0xBAF6u, 0.00000000 },
+  { 0xBAF7u, 0.00000000 },
+  { 0xBAF8u, 0.00000000 },
+  { 0xBAF9u, 0.00000000 },
+  { 0xBAFAu, 0.00000000 },
+  { 0xBAFBu, 0.00000000 },
+  { 0xBAFCu, 0.00000000 },
+  { 0xBAFDu, 0.00000000 },
+  { 0xBAFEu, 0.00000000 },
+  { 0xBAFFu, 0.00000000 },
+  { 0xBB00u, 0.00000000 },
+  { 0xBB01u, 0.00000000 },
+  { 0xBB02u, 0.00000000 },
+  { 0xBB03u, 0.00000000 },
+  { 0xBB04u, 0.00000000 },
+  { 0xBB05u, 0.00000000 },
+  { 0xBB06u, 0.00000000 },
+  { 0xBB07u, 0.00000000 },
+  { 0xBB08u, 0.00000000 },
+  { 0xBB09u, 0.00000000 },
+  { 0xBB0Au, 0.00000000 },
+  { 0xBB0Bu, 0.00000000 },
+  { 0xBB0Cu, 0.00000000 },
+  { 0xBB0Du, 0.00000000 },
+  { 0xBB0Eu, 0.00000000 },
+  { 0xBB0Fu, 0.00000000 },
+  { 0xBB10u, 0.00000000 },
+  { 0xBB11u, 0.00000000 },
+  { 0xBB12u, 0.00000000 },
+  { 0xBB13u, 0.00000000 },
+  { 0xBB14u, 0.00000000 },
+  { 0xBB15u, 0.00000000 },
+  { 0xBB16u, 0.00000000 },
+  { 0xBB17u, 0.00000000 },
+  { 0xBB18u, 0.00020000 },
+  { 0xBB19u, 0.00000000 },
+  { 0xBB1Au, 0.00000000 },
+  { 0xBB1Bu, 0.00000000 },
+  { 0xBB1Cu, 0.00000000 },
+  { 0xBB1Du, 0.00000000 },
+  { 0xBB1Eu, 0.00000000 },
+  { 0xBB1Fu, 0.00000000 },
+  { 0xBB20u, 0.00000000 },
+  { 0xBB21u, 0.00000000 },
+  { 0xBB22u, 0.00000000 },
+  { 0xBB23u, 0.00000000 },
+  { 0xBB24u, 0.00000000 },
+  { 0xBB25u, 0.00000000 },
+  { 0xBB26u, 0.00000000 },
+  { 0xBB27u, 0.00000000 },
+  { 0xBB28u, 0.00000000 },
+  { 0xBB29u, 0.00000000 },
+  { 0xBB2Au, 0.00000000 },
+  { 0xBB2Bu, 0.00000000 },
+  { 0xBB2Cu, 0.00000000 },
+  { 0xBB2Du, 0.00000000 },
+  { 0xBB2Eu, 0.00000000 },
+  { 0xBB2Fu, 0.00000000 },
+  { 0xBB30u, 0.00000000 },
+  { 0xBB31u, 0.00000000 },
+  { 0xBB32u, 0.00000000 },
+  { 0xBB33u, 0.00000000 },
+  { 0xBB34u, 0.00230000 },
+  { 0xBB35u, 0.00000000 },
+  { 0xBB36u, 0.00000000 },
+  { 0xBB37u, 0.00000000 },
+  { 0xBB38u, 0.00310000 },
+  { 0xBB39u, 0.00000000 },
+  { 0xBB3Au, 0.00000000 },
+  { 0xBB3Bu, 0.00000000 },
+  { 0xBB3Cu, 0.00160000 },
+  { 0xBB3Du, 0.00000000 },
+  { 0xBB3Eu, 0.00000000 },
+  { 0xBB3Fu, 0.00000000 },
+  { 0xBB40u, 0.00000000 },
+  { 0xBB41u, 0.00000000 },
+  { 0xBB42u, 0.00000000 },
+  { 0xBB43u, 0.00000000 },
+  { 0xBB44u, 0.00000000 },
+  { 0xBB45u, 0.00000000 },
+  { 0xBB46u, 0.00000000 },
+  { 0xBB47u, 0.00000000 },
+  { 0xBB48u, 0.00000000 },
+  { 0xBB49u, 0.00000000 },
+  { 0xBB4Au, 0.00000000 },
+  { 0xBB4Bu, 0.00000000 },
+  { 0xBB4Cu, 0.00000000 },
+  { 0xBB4Du, 0.00000000 },
+  { 0xBB4Eu, 0.00000000 },
+  { 0xBB4Fu, 0.00000000 },
+  { 0xBB50u, 0.00000000 },
+  { 0xBB51u, 0.00000000 },
+  { 0xBB52u, 0.00000000 },
+  { 0xBB53u, 0.00000000 },
+  { 0xBB54u, 0.00000000 },
+  { 0xBB55u, 0.00000000 },
+  { 0xBB56u, 0.00000000 },
+  { 0xBB57u, 0.00000000 },
+  { 0xBB58u, 0.00000000 },
+  { 0xBB59u, 0.00000000 },
+  { 0xBB5Au, 0.00000000 },
+  { 0xBB5Bu, 0.00000000 },
+  { 0xBB5Cu, 0.00000000 },
+  { 0xBB5Du, 0.00000000 },
+  { 0xBB5Eu, 0.00000000 },
+  { 0xBB5Fu, 0.00000000 },
+  { 0xBB60u, 0.00000000 },
+  { 0xBB61u, 0.00000000 },
+  { 0xBB62u, 0.00000000 },
+  { 0xBB63u, 0.00000000 },
+  { 0xBB64u, 0.00000000 },
+  { 0xBB65u, 0.00000000 },
+  { 0xBB66u, 0.00000000 },
+  { 0xBB67u, 0.00000000 },
+  { 0xBB68u, 0.00000000 },
+  { 0xBB69u, 0.00000000 },
+  { 0xBB6Au, 0.00000000 },
+  { 0xBB6Bu, 0.00000000 },
+  { 0xBB6Cu, 0.00000000 },
+  { 0xBB6Du, 0.00000000 },
+  { 0xBB6Eu, 0.00000000 },
+  { 0xBB6Fu, 0.00000000 },
+  { 0xBB70u, 0.00000000 },
+  { 0xBB71u, 0.00000000 },
+  { 0xBB72u, 0.00000000 },
+  { 0xBB73u, 0.00000000 },
+  { 0xBB74u, 0.00000000 },
+  { 0xBB75u, 0.00000000 },
+  { 0xBB76u, 0.00000000 },
+  { 0xBB77u, 0.00000000 },
+  { 0xBB78u, 0.00000000 },
+  { 0xBB79u, 0.00000000 },
+  { 0xBB7Au, 0.00000000 },
+  { 0xBB7Bu, 0.00000000 },
+  { 0xBB7Cu, 0.00000000 },
+  { 0xBB7Du, 0.00000000 },
+  { 0xBB7Eu, 0.00000000 },
+  { 0xBB7Fu, 0.00000000 },
+  { 0xBB80u, 0.00000000 },
+  { 0xBB81u, 0.00000000 },
+  { 0xBB82u, 0.00000000 },
+  { 0xBB83u, 0.00000000 },
+  { 0xBB84u, 0.00000000 },
+  { 0xBB85u, 0.00000000 },
+  { 0xBB86u, 0.00000000 },
+  { 0xBB87u, 0.00000000 },
+  { 0xBB88u, 0.00000000 },
+  { 0xBB89u, 0.00000000 },
+  { 0xBB8Au, 0.00000000 },
+  { 0xBB8Bu, 0.00000000 },
+  { 0xBB8Cu, 0.00000000 },
+  { 0xBB8Du, 0.00000000 },
+  { 0xBB8Eu, 0.00000000 },
+  { 0xBB8Fu, 0.00000000 },
+  { 0xBB90u, 0.00000000 },
+  { 0xBB91u, 0.00000000 },
+  { 0xBB92u, 0.00000000 },
+  { 0xBB93u, 0.00000000 },
+  { 0xBB94u, 0.00000000 },
+  { 0xBB95u, 0.00000000 },
+  { 0xBB96u, 0.00000000 },
+  { 0xBB97u, 0.00000000 },
+  { 0xBB98u, 0.00000000 },
+  { 0xBB99u, 0.00000000 },
+  { 0xBB9Au, 0.00000000 },
+  { 0xBB9Bu, 0.00000000 },
+  { 0xBB9Cu, 0.00000000 },
+  { 0xBB9Du, 0.00000000 },
+  { 0xBB9Eu, 0.00000000 },
+  { 0xBB9Fu, 0.00000000 },
+  { 0xBBA0u, 0.00000000 },
+  { 0xBBA1u, 0.00000000 },
+  { 0xBBA2u, 0.00000000 },
+  { 0xBBA3u, 0.00000000 },
+  { 0xBBA4u, 0.00010000 },
+  { 0xBBA5u, 0.00000000 },
+  { 0xBBA6u, 0.00000000 },
+  { 0xBBA7u, 0.00000000 },
+  { 0xBBA8u, 0.00000000 },
+  { 0xBBA9u, 0.00000000 },
+  { 0xBBAAu, 0.00000000 },
+  { 0xBBABu, 0.00000000 },
+  { 0xBBACu, 0.00000000 },
+  { 0xBBADu, 0.00000000 },
+  { 0xBBAEu, 0.00000000 },
+  { 0xBBAFu, 0.00000000 },
+  { 0xBBB0u, 0.00000000 },
+  { 0xBBB1u, 0.00000000 },
+  { 0xBBB2u, 0.00000000 },
+  { 0xBBB3u, 0.00000000 },
+  { 0xBBB4u, 0.00000000 },
+  { 0xBBB5u, 0.00000000 },
+  { 0xBBB6u, 0.00000000 },
+  { 0xBBB7u, 0.00000000 },
+  { 0xBBB8u, 0.00000000 },
+  { 0xBBB9u, 0.00000000 },
+  { 0xBBBAu, 0.00000000 },
+  { 0xBBBBu, 0.00000000 },
+  { 0xBBBCu, 0.00000000 },
+  { 0xBBBDu, 0.00000000 },
+  { 0xBBBEu, 0.00000000 },
+  { 0xBBBFu, 0.00000000 },
+  { 0xBBC0u, 0.00020000 },
+  { 0xBBC1u, 0.00000000 },
+  { 0xBBC2u, 0.00000000 },
+  { 0xBBC3u, 0.00000000 },
+  { 0xBBC4u, 0.00000000 },
+  { 0xBBC5u, 0.00000000 },
+  { 0xBBC6u, 0.00000000 },
+  { 0xBBC7u, 0.00000000 },
+  { 0xBBC8u, 0.00000000 },
+  { 0xBBC9u, 0.00000000 },
+  { 0xBBCAu, 0.00000000 },
+  { 0xBBCBu, 0.00000000 },
+  { 0xBBCCu, 0.00000000 },
+  { 0xBBCDu, 0.00000000 },
+  { 0xBBCEu, 0.00000000 },
+  { 0xBBCFu, 0.00000000 },
+  { 0xBBD0u, 0.00000000 },
+  { 0xBBD1u, 0.00000000 },
+  { 0xBBD2u, 0.00000000 },
+  { 0xBBD3u, 0.00000000 },
+  { 0xBBD4u, 0.00000000 },
+  { 0xBBD5u, 0.00000000 },
+  { 0xBBD6u, 0.00000000 },
+  { 0xBBD7u, 0.00000000 },
+  { 0xBBD8u, 0.00000000 },
+  { 0xBBD9u, 0.00000000 },
+  { 0xBBDAu, 0.00000000 },
+  { 0xBBDBu, 0.00000000 },
+  { 0xBBDCu, 0.00000000 },
+  { 0xBBDDu, 0.00000000 },
+  { 0xBBDEu, 0.00000000 },
+  { 0xBBDFu, 0.00000000 },
+  { 0xBBE0u, 0.00000000 },
+  { 0xBBE1u, 0.00000000 },
+  { 0xBBE2u, 0.00000000 },
+  { 0xBBE3u, 0.00000000 },
+  { 0xBBE4u, 0.00000000 },
+  { 0xBBE5u, 0.00000000 },
+  { 0xBBE6u, 0.00000000 },
+  { 0xBBE7u, 0.00000000 },
+  { 0xBBE8u, 0.00000000 },
+  { 0xBBE9u, 0.00000000 },
+  { 0xBBEAu, 0.00000000 },
+  { 0xBBEBu, 0.00000000 },
+  { 0xBBECu, 0.00000000 },
+  { 0xBBEDu, 0.00000000 },
+  { 0xBBEEu, 0.00000000 },
+  { 0xBBEFu, 0.00000000 },
+  { 0xBBF0u, 0.00000000 },
+  { 0xBBF1u, 0.00000000 },
+  { 0xBBF2u, 0.00000000 },
+  { 0xBBF3u, 0.00000000 },
+  { 0xBBF4u, 0.00000000 },
+  { 0xBBF5u, 0.00000000 },
+  { 0xBBF6u, 0.00000000 },
+  { 0xBBF7u, 0.00000000 },
+  { 0xBBF8u, 0.00310000 },
+  { 0xBBF9u, 0.00000000 },
+  { 0xBBFAu, 0.00000000 },
+  { 0xBBFBu, 0.00000000 },
+  { 0xBBFCu, 0.00230000 },
+  { 0xBBFDu, 0.00000000 },
+  { 0xBBFEu, 0.00000000 },
+  { 0xBBFFu, 0.00010000 },
+  { 0xBC00u, 0.00040000 },
+  { 0xBC01u, 0.00000000 },
+  { 0xBC02u, 0.00000000 },
+  { 0xBC03u, 0.00000000 },
+  { 0xBC04u, 0.00000000 },
+  { 0xBC05u, 0.00000000 },
+  { 0xBC06u, 0.00000000 },
+  { 0xBC07u, 0.00000000 },
+  { 0xBC08u, 0.00000000 },
+  { 0xBC09u, 0.00000000 },
+  { 0xBC0Au, 0.00000000 },
+  { 0xBC0Bu, 0.00000000 },
+  { 0xBC0Cu, 0.00000000 },
+  { 0xBC0Du, 0.00010000 },
+  { 0xBC0Eu, 0.00000000 },
+  { 0xBC0Fu, 0.00050000 },
+  { 0xBC10u, 0.00000000 },
+  { 0xBC11u, 0.00010000 },
+  { 0xBC12u, 0.00000000 },
+  { 0xBC13u, 0.00000000 },
+  { 0xBC14u, 0.00190000 },
+  { 0xBC15u, 0.00060000 },
+  { 0xBC16u, 0.00010000 },
+  { 0xBC17u, 0.00000000 },
+  { 0xBC18u, 0.00190000 },
+  { 0xBC19u, 0.00000000 },
+  { 0xBC1Au, 0.00000000 },
+  { 0xBC1Bu, 0.00120000 },
+  { 0xBC1Cu, 0.00260000 },
+  { 0xBC1Du, 0.00020000 },
+  { 0xBC1Eu, 0.00000000 },
+  { 0xBC1Fu, 0.00000000 },
+  { 0xBC20u, 0.00000000 },
+  { 0xBC21u, 0.00000000 },
+  { 0xBC22u, 0.00000000 },
+  { 0xBC23u, 0.00000000 },
+  { 0xBC24u, 0.00010000 },
+  { 0xBC25u, 0.00000000 },
+  { 0xBC26u, 0.00000000 },
+  { 0xBC27u, 0.00000000 },
+  { 0xBC28u, 0.00000000 },
+  { 0xBC29u, 0.00230000 },
+  { 0xBC2Au, 0.00000000 },
+  { 0xBC2Bu, 0.00000000 },
+  { 0xBC2Cu, 0.00000000 },
+  { 0xBC2Du, 0.00000000 },
+  { 0xBC2Eu, 0.00000000 },
+  { 0xBC2Fu, 0.00000000 },
+  { 0xBC30u, 0.00110000 },
+  { 0xBC31u, 0.00060000 },
+  { 0xBC32u, 0.00000000 },
+  { 0xBC33u, 0.00000000 },
+  { 0xBC34u, 0.00010000 },
+  { 0xBC35u, 0.00000000 },
+  { 0xBC36u, 0.00000000 },
+  { 0xBC37u, 0.00000000 },
+  { 0xBC38u, 0.00000000 },
+  { 0xBC39u, 0.00000000 },
+  { 0xBC3Au, 0.00000000 },
+  { 0xBC3Bu, 0.00000000 },
+  { 0xBC3Cu, 0.00000000 },
+  { 0xBC3Du, 0.00000000 },
+  { 0xBC3Eu, 0.00000000 },
+  { 0xBC3Fu, 0.00000000 },
+  { 0xBC40u, 0.00000000 },
+  { 0xBC41u, 0.00000000 },
+  { 0xBC42u, 0.00000000 },
+  { 0xBC43u, 0.00000000 },
+  { 0xBC44u, 0.00000000 },
+  { 0xBC45u, 0.00000000 },
+  { 0xBC46u, 0.00000000 },
+  { 0xBC47u, 0.00000000 },
+  { 0xBC48u, 0.00000000 },
+  { 0xBC49u, 0.00000000 },
+  { 0xBC4Au, 0.00000000 },
+  { 0xBC4Bu, 0.00000000 },
+  { 0xBC4Cu, 0.00000000 },
+  { 0xBC4Du, 0.00000000 },
+  { 0xBC4Eu, 0.00000000 },
+  { 0xBC4Fu, 0.00000000 },
+  { 0xBC50u, 0.00000000 },
+  { 0xBC51u, 0.00000000 },
+  { 0xBC52u, 0.00000000 },
+  { 0xBC53u, 0.00000000 },
+  { 0xBC54u, 0.00000000 },
+  { 0xBC55u, 0.00000000 },
+  { 0xBC56u, 0.00000000 },
+  { 0xBC57u, 0.00000000 },
+  { 0xBC58u, 0.00000000 },
+  { 0xBC59u, 0.00000000 },
+  { 0xBC5Au, 0.00000000 },
+  { 0xBC5Bu, 0.00000000 },
+  { 0xBC5Cu, 0.00000000 },
+  { 0xBC5Du, 0.00000000 },
+  { 0xBC5Eu, 0.00000000 },
+  { 0xBC5Fu, 0.00000000 },
+  { 0xBC60u, 0.00000000 },
+  { 0xBC61u, 0.00000000 },
+  { 0xBC62u, 0.00000000 },
+  { 0xBC63u, 0.00000000 },
+  { 0xBC64u, 0.00000000 },
+  { 0xBC65u, 0.00000000 },
+  { 0xBC66u, 0.00000000 },
+  { 0xBC67u, 0.00000000 },
+  { 0xBC68u, 0.00000000 },
+  { 0xBC69u, 0.00000000 },
+  { 0xBC6Au, 0.00000000 },
+  { 0xBC6Bu, 0.00000000 },
+  { 0xBC6Cu, 0.00000000 },
+  { 0xBC6Du, 0.00000000 },
+  { 0xBC6Eu, 0.00000000 },
+  { 0xBC6Fu, 0.00000000 },
+  { 0xBC70u, 0.00000000 },
+  { 0xBC71u, 0.00000000 },
+  { 0xBC72u, 0.00000000 },
+  { 0xBC73u, 0.00000000 },
+  { 0xBC74u, 0.00000000 },
+  { 0xBC75u, 0.00000000 },
+  { 0xBC76u, 0.00000000 },
+  { 0xBC77u, 0.00000000 },
+  { 0xBC78u, 0.00000000 },
+  { 0xBC79u, 0.00000000 },
+  { 0xBC7Au, 0.00000000 },
+  { 0xBC7Bu, 0.00000000 },
+  { 0xBC7Cu, 0.00000000 },
+  { 0xBC7Du, 0.00000000 },
+  { 0xBC7Eu, 0.00000000 },
+  { 0xBC7Fu, 0.00000000 },
+  { 0xBC80u, 0.00000000 },
+  { 0xBC81u, 0.00000000 },
+  { 0xBC82u, 0.00000000 },
+  { 0xBC83u, 0.00000000 },
+  { 0xBC84u, 0.00120000 },
+  { 0xBC85u, 0.00000000 },
+  { 0xBC86u, 0.00000000 },
+  { 0xBC87u, 0.00000000 },
+  { 0xBC88u, 0.00120000 },
+  { 0xBC89u, 0.00000000 },
+  { 0xBC8Au, 0.00000000 },
+  { 0xBC8Bu, 0.00000000 },
+  { 0xBC8Cu, 0.00040000 },
+  { 0xBC8Du, 0.00000000 },
+  { 0xBC8Eu, 0.00000000 },
+  { 0xBC8Fu, 0.00000000 },
+  { 0xBC90u, 0.00000000 },
+  { 0xBC91u, 0.00000000 },
+  { 0xBC92u, 0.00000000 },
+  { 0xBC93u, 0.00000000 },
+  { 0xBC94u, 0.00050000 },
+  { 0xBC95u, 0.00130000 },
+  { 0xBC96u, 0.00000000 },
+  { 0xBC97u, 0.00000000 },
+  { 0xBC98u, 0.00000000 },
+  { 0xBC99u, 0.00000000 },
+  { 0xBC9Au, 0.00000000 },
+  { 0xBC9Bu, 0.00000000 },
+  { 0xBC9Cu, 0.00000000 },
+  { 0xBC9Du, 0.00000000 },
+  { 0xBC9Eu, 0.00000000 },
+  { 0xBC9Fu, 0.00000000 },
+  { 0xBCA0u, 0.00090000 },
+  { 0xBCA1u, 0.00000000 },
+  { 0xBCA2u, 0.00000000 },
+  { 0xBCA3u, 0.00000000 },
+  { 0xBCA4u, 0.00010000 },
+  { 0xBCA5u, 0.00000000 },
+  { 0xBCA6u, 0.00000000 },
+  { 0xBCA7u, 0.00000000 },
+  { 0xBCA8u, 0.00020000 },
+  { 0xBCA9u, 0.00000000 },
+  { 0xBCAAu, 0.00000000 },
+  { 0xBCABu, 0.00000000 },
+  { 0xBCACu, 0.00000000 },
+  { 0xBCADu, 0.00000000 },
+  { 0xBCAEu, 0.00000000 },
+  { 0xBCAFu, 0.00000000 },
+  { 0xBCB0u, 0.00000000 },
+  { 0xBCB1u, 0.00000000 },
+  { 0xBCB2u, 0.00000000 },
+  { 0xBCB3u, 0.00000000 },
+  { 0xBCB4u, 0.00000000 },
+  { 0xBCB5u, 0.00000000 },
+  { 0xBCB6u, 0.00000000 },
+  { 0xBCB7u, 0.00000000 },
+  { 0xBCB8u, 0.00000000 },
+  { 0xBCB9u, 0.00000000 },
+  { 0xBCBAu, 0.00000000 },
+  { 0xBCBBu, 0.00000000 },
+  { 0xBCBCu, 0.00000000 },
+  { 0xBCBDu, 0.00010000 },
+  { 0xBCBEu, 0.00000000 },
+  { 0xBCBFu, 0.00000000 },
+  { 0xBCC0u, 0.00070000 },
+  { 0xBCC1u, 0.00000000 },
+  { 0xBCC2u, 0.00000000 },
+  { 0xBCC3u, 0.00000000 },
+  { 0xBCC4u, 0.00070000 },
+  { 0xBCC5u, 0.00000000 },
+  { 0xBCC6u, 0.00000000 },
+  { 0xBCC7u, 0.00000000 },
+  { 0xBCC8u, 0.00000000 },
+  { 0xBCC9u, 0.00000000 },
+  { 0xBCCAu, 0.00000000 },
+  { 0xBCCBu, 0.00000000 },
+  { 0xBCCCu, 0.00000000 },
+  { 0xBCCDu, 0.00000000 },
+  { 0xBCCEu, 0.00000000 },
+  { 0xBCCFu, 0.00000000 },
+  { 0xBCD0u, 0.00000000 },
+  { 0xBCD1u, 0.00080000 },
+  { 0xBCD2u, 0.00000000 },
+  { 0xBCD3u, 0.00000000 },
+  { 0xBCD4u, 0.00000000 },
+  { 0xBCD5u, 0.00000000 },
+  { 0xBCD6u, 0.00000000 },
+  { 0xBCD7u, 0.00000000 },
+  { 0xBCD8u, 0.00000000 },
+  { 0xBCD9u, 0.00000000 },
+  { 0xBCDAu, 0.00000000 },
+  { 0xBCDBu, 0.00000000 },
+  { 0xBCDCu, 0.00000000 },
+  { 0xBCDDu, 0.00000000 },
+  { 0xBCDEu, 0.00000000 },
+  { 0xBCDFu, 0.00000000 },
+  { 0xBCE0u, 0.00000000 },
+  { 0xBCE1u, 0.00000000 },
+  { 0xBCE2u, 0.00000000 },
+  { 0xBCE3u, 0.00000000 },
+  { 0xBCE4u, 0.00000000 },
+  { 0xBCE5u, 0.00000000 },
+  { 0xBCE6u, 0.00000000 },
+  { 0xBCE7u, 0.00000000 },
+  { 0xBCE8u, 0.00000000 },
+  { 0xBCE9u, 0.00000000 },
+  { 0xBCEAu, 0.00000000 },
+  { 0xBCEBu, 0.00000000 },
+  { 0xBCECu, 0.00000000 },
+  { 0xBCEDu, 0.00000000 },
+  { 0xBCEEu, 0.00000000 },
+  { 0xBCEFu, 0.00000000 },
+  { 0xBCF0u, 0.00000000 },
+  { 0xBCF1u, 0.00000000 },
+  { 0xBCF2u, 0.00000000 },
+  { 0xBCF3u, 0.00000000 },
+  { 0xBCF4u, 0.00340000 },
+  { 0xBCF5u, 0.00080000 },
+  { 0xBCF6u, 0.00000000 },
+  { 0xBCF7u, 0.00000000 },
+  { 0xBCF8u, 0.00180000 },
+  { 0xBCF9u, 0.00000000 },
+  { 0xBCFAu, 0.00000000 },
+  { 0xBCFBu, 0.00000000 },
+  { 0xBCFCu, 0.00030000 },
+  { 0xBCFDu, 0.00000000 },
+  { 0xBCFEu, 0.00000000 },
+  { 0xBCFFu, 0.00000000 },
+  { 0xBD00u, 0.00000000 },
+  { 0xBD01u, 0.00000000 },
+  { 0xBD02u, 0.00000000 },
+  { 0xBD03u, 0.00000000 },
+  { 0xBD04u, 0.00000000 },
+  { 0xBD05u, 0.00000000 },
+  { 0xBD06u, 0.00000000 },
+  { 0xBD07u, 0.00000000 },
+  { 0xBD08u, 0.00000000 },
+  { 0xBD09u, 0.00040000 },
+  { 0xBD0Au, 0.00000000 },
+  { 0xBD0Bu, 0.00000000 },
+  { 0xBD0Cu, 0.00000000 },
+  { 0xBD0Du, 0.00000000 },
+  { 0xBD0Eu, 0.00000000 },
+  { 0xBD0Fu, 0.00000000 },
+  { 0xBD10u, 0.00000000 },
+  { 0xBD11u, 0.00000000 },
+  { 0xBD12u, 0.00000000 },
+  { 0xBD13u, 0.00000000 },
+  { 0xBD14u, 0.00000000 },
+  { 0xBD15u, 0.00000000 },
+  { 0xBD16u, 0.00000000 },
+  { 0xBD17u, 0.00000000 },
+  { 0xBD18u, 0.00000000 },
+  { 0xBD19u, 0.00000000 },
+  { 0xBD1Au, 0.00000000 },
+  { 0xBD1Bu, 0.00000000 },
+  { 0xBD1Cu, 0.00000000 },
+  { 0xBD1Du, 0.00000000 },
+  { 0xBD1Eu, 0.00000000 },
+  { 0xBD1Fu, 0.00000000 },
+  { 0xBD20u, 0.00000000 },
+  { 0xBD21u, 0.00000000 },
+  { 0xBD22u, 0.00000000 },
+  { 0xBD23u, 0.00000000 },
+  { 0xBD24u, 0.00000000 },
+  { 0xBD25u, 0.00000000 },
+  { 0xBD26u, 0.00000000 },
+  { 0xBD27u, 0.00000000 },
+  { 0xBD28u, 0.00000000 },
+  { 0xBD29u, 0.00000000 },
+  { 0xBD2Au, 0.00000000 },
+  { 0xBD2Bu, 0.00000000 },
+  { 0xBD2Cu, 0.00000000 },
+  { 0xBD2Du, 0.00000000 },
+  { 0xBD2Eu, 0.00000000 },
+  { 0xBD2Fu, 0.00000000 },
+  { 0xBD30u, 0.00000000 },
+  { 0xBD31u, 0.00000000 },
+  { 0xBD32u, 0.00000000 },
+  { 0xBD33u, 0.00000000 },
+  { 0xBD34u, 0.00000000 },
+  { 0xBD35u, 0.00000000 },
+  { 0xBD36u, 0.00000000 },
+  { 0xBD37u, 0.00000000 },
+  { 0xBD38u, 0.00000000 },
+  { 0xBD39u, 0.00000000 },
+  { 0xBD3Au, 0.00000000 },
+  { 0xBD3Bu, 0.00000000 },
+  { 0xBD3Cu, 0.00000000 },
+  { 0xBD3Du, 0.00000000 },
+  { 0xBD3Eu, 0.00000000 },
+  { 0xBD3Fu, 0.00000000 },
+  { 0xBD40u, 0.00000000 },
+  { 0xBD41u, 0.00000000 },
+  { 0xBD42u, 0.00000000 },
+  { 0xBD43u, 0.00000000 },
+  { 0xBD44u, 0.00000000 },
+  { 0xBD45u, 0.00000000 },
+  { 0xBD46u, 0.00000000 },
+  { 0xBD47u, 0.00000000 },
+  { 0xBD48u, 0.00000000 },
+  { 0xBD49u, 0.00000000 },
+  { 0xBD4Au, 0.00000000 },
+  { 0xBD4Bu, 0.00000000 },
+  { 0xBD4Cu, 0.00000000 },
+  { 0xBD4Du, 0.00000000 },
+  { 0xBD4Eu, 0.00000000 },
+  { 0xBD4Fu, 0.00000000 },
+  { 0xBD50u, 0.00000000 },
+  { 0xBD51u, 0.00000000 },
+  { 0xBD52u, 0.00000000 },
+  { 0xBD53u, 0.00000000 },
+  { 0xBD54u, 0.00000000 },
+  { 0xBD55u, 0.00000000 },
+  { 0xBD56u, 0.00000000 },
+  { 0xBD57u, 0.00000000 },
+  { 0xBD58u, 0.00000000 },
+  { 0xBD59u, 0.00000000 },
+  { 0xBD5Au, 0.00000000 },
+  { 0xBD5Bu, 0.00000000 },
+  { 0xBD5Cu, 0.00000000 },
+  { 0xBD5Du, 0.00000000 },
+  { 0xBD5Eu, 0.00000000 },
+  { 0xBD5Fu, 0.00000000 },
+  { 0xBD60u, 0.00000000 },
+  { 0xBD61u, 0.00000000 },
+  { 0xBD62u, 0.00000000 },
+  { 0xBD63u, 0.00000000 },
+  { 0xBD64u, 0.00000000 },
+  { 0xBD65u, 0.00000000 },
+  { 0xBD66u, 0.00000000 },
+  { 0xBD67u, 0.00000000 },
+  { 0xBD68u, 0.00000000 },
+  { 0xBD69u, 0.00000000 },
+  { 0xBD6Au, 0.00000000 },
+  { 0xBD6Bu, 0.00000000 },
+  { 0xBD6Cu, 0.00000000 },
+  { 0xBD6Du, 0.00000000 },
+  { 0xBD6Eu, 0.00000000 },
+  { 0xBD6Fu, 0.00000000 },
+  { 0xBD70u, 0.00000000 },
+  { 0xBD71u, 0.00000000 },
+  { 0xBD72u, 0.00000000 },
+  { 0xBD73u, 0.00000000 },
+  { 0xBD74u, 0.00000000 },
+  { 0xBD75u, 0.00000000 },
+  { 0xBD76u, 0.00000000 },
+  { 0xBD77u, 0.00000000 },
+  { 0xBD78u, 0.00000000 },
+  { 0xBD79u, 0.00000000 },
+  { 0xBD7Au, 0.00000000 },
+  { 0xBD7Bu, 0.00000000 },
+  { 0xBD7Cu, 0.00000000 },
+  { 0xBD7Du, 0.00000000 },
+  { 0xBD7Eu, 0.00000000 },
+  { 0xBD7Fu, 0.00000000 },
+  { 0xBD80u, 0.00660000 },
+  { 0xBD81u, 0.00090000 },
+  { 0xBD82u, 0.00000000 },
+  { 0xBD83u, 0.00000000 },
+  { 0xBD84u, 0.00190000 },
+  { 0xBD85u, 0.00000000 },
+  { 0xBD86u, 0.00000000 },
+  { 0xBD87u, 0.00000000 },
+  { 0xBD88u, 0.00110000 },
+  { 0xBD89u, 0.00000000 },
+  { 0xBD8Au, 0.00000000 },
+  { 0xBD8Bu, 0.00000000 },
+  { 0xBD8Cu, 0.00000000 },
+  { 0xBD8Du, 0.00000000 },
+  { 0xBD8Eu, 0.00000000 },
+  { 0xBD8Fu, 0.00000000 },
+  { 0xBD90u, 0.00000000 },
+  { 0xBD91u, 0.00000000 },
+  { 0xBD92u, 0.00000000 },
+  { 0xBD93u, 0.00000000 },
+  { 0xBD94u, 0.00000000 },
+  { 0xBD95u, 0.00010000 },
+  { 0xBD96u, 0.00000000 },
+  { 0xBD97u, 0.00000000 },
+  { 0xBD98u, 0.00000000 },
+  { 0xBD99u, 0.00020000 },
+  { 0xBD9Au, 0.00000000 },
+  { 0xBD9Bu, 0.00000000 },
+  { 0xBD9Cu, 0.00000000 },
+  { 0xBD9Du, 0.00000000 },
+  { 0xBD9Eu, 0.00000000 },
+  { 0xBD9Fu, 0.00000000 },
+  { 0xBDA0u, 0.00000000 },
+  { 0xBDA1u, 0.00000000 },
+  { 0xBDA2u, 0.00000000 },
+  { 0xBDA3u, 0.00000000 },
+  { 0xBDA4u, 0.00000000 },
+  { 0xBDA5u, 0.00000000 },
+  { 0xBDA6u, 0.00000000 },
+  { 0xBDA7u, 0.00000000 },
+  { 0xBDA8u, 0.00000000 },
+  { 0xBDA9u, 0.00000000 },
+  { 0xBDAAu, 0.00000000 },
+  { 0xBDABu, 0.00000000 },
+  { 0xBDACu, 0.00000000 },
+  { 0xBDADu, 0.00000000 },
+  { 0xBDAEu, 0.00000000 },
+  { 0xBDAFu, 0.00000000 },
+  { 0xBDB0u, 0.00000000 },
+  { 0xBDB1u, 0.00000000 },
+  { 0xBDB2u, 0.00000000 },
+  { 0xBDB3u, 0.00000000 },
+  { 0xBDB4u, 0.00000000 },
+  { 0xBDB5u, 0.00000000 },
+  { 0xBDB6u, 0.00000000 },
+  { 0xBDB7u, 0.00000000 },
+  { 0xBDB8u, 0.00000000 },
+  { 0xBDB9u, 0.00000000 },
+  { 0xBDBAu, 0.00000000 },
+  { 0xBDBBu, 0.00000000 },
+  { 0xBDBCu, 0.00000000 },
+  { 0xBDBDu, 0.00000000 },
+  { 0xBDBEu, 0.00000000 },
+  { 0xBDBFu, 0.00000000 },
+  { 0xBDC0u, 0.00000000 },
+  { 0xBDC1u, 0.00000000 },
+  { 0xBDC2u, 0.00000000 },
+  { 0xBDC3u, 0.00000000 },
+  { 0xBDC4u, 0.00000000 },
+  { 0xBDC5u, 0.00000000 },
+  { 0xBDC6u, 0.00000000 },
+  { 0xBDC7u, 0.00000000 },
+  { 0xBDC8u, 0.00000000 },
+  { 0xBDC9u, 0.00000000 },
+  { 0xBDCAu, 0.00000000 },
+  { 0xBDCBu, 0.00000000 },
+  { 0xBDCCu, 0.00000000 },
+  { 0xBDCDu, 0.00000000 },
+  { 0xBDCEu, 0.00000000 },
+  { 0xBDCFu, 0.00000000 },
+  { 0xBDD0u, 0.00000000 },
+  { 0xBDD1u, 0.00000000 },
+  { 0xBDD2u, 0.00000000 },
+  { 0xBDD3u, 0.00000000 },
+  { 0xBDD4u, 0.00020000 },
+  { 0xBDD5u, 0.00000000 },
+  { 0xBDD6u, 0.00000000 },
+  { 0xBDD7u, 0.00000000 },
+  { 0xBDD8u, 0.00000000 },
+  { 0xBDD9u, 0.00000000 },
+  { 0xBDDAu, 0.00000000 },
+  { 0xBDDBu, 0.00000000 },
+  { 0xBDDCu, 0.00000000 },
+  { 0xBDDDu, 0.00000000 },
+  { 0xBDDEu, 0.00000000 },
+  { 0xBDDFu, 0.00000000 },
+  { 0xBDE0u, 0.00000000 },
+  { 0xBDE1u, 0.00000000 },
+  { 0xBDE2u, 0.00000000 },
+  { 0xBDE3u, 0.00000000 },
+  { 0xBDE4u, 0.00000000 },
+  { 0xBDE5u, 0.00000000 },
+  { 0xBDE6u, 0.00000000 },
+  { 0xBDE7u, 0.00000000 },
+  { 0xBDE8u, 0.00000000 },
+  { 0xBDE9u, 0.00000000 },
+  { 0xBDEAu, 0.00000000 },
+  { 0xBDEBu, 0.00000000 },
+  { 0xBDECu, 0.00000000 },
+  { 0xBDEDu, 0.00000000 },
+  { 0xBDEEu, 0.00000000 },
+  { 0xBDEFu, 0.00000000 },
+  { 0xBDF0u, 0.00000000 },
+  { 0xBDF1u, 0.00000000 },
+  { 0xBDF2u, 0.00000000 },
+  { 0xBDF3u, 0.00000000 },
+  { 0xBDF4u, 0.00000000 },
+  { 0xBDF5u, 0.00000000 },
+  { 0xBDF6u, 0.00000000 },
+  { 0xBDF7u, 0.00000000 },
+  { 0xBDF8u, 0.00000000 },
+  { 0xBDF9u, 0.00000000 },
+  { 0xBDFAu, 0.00000000 },
+  { 0xBDFBu, 0.00000000 },
+  { 0xBDFCu, 0.00000000 },
+  { 0xBDFDu, 0.00000000 },
+  { 0xBDFEu, 0.00000000 },
+  { 0xBDFFu, 0.00000000 },
+  { 0xBE00u, 0.00000000 },
+  { 0xBE01u, 0.00000000 },
+  { 0xBE02u, 0.00000000 },
+  { 0xBE03u, 0.00000000 },
+  { 0xBE04u, 0.00000000 },
+  { 0xBE05u, 0.00000000 },
+  { 0xBE06u, 0.00000000 },
+  { 0xBE07u, 0.00000000 },
+  { 0xBE08u, 0.00000000 },
+  { 0xBE09u, 0.00000000 },
+  { 0xBE0Au, 0.00000000 },
+  { 0xBE0Bu, 0.00000000 },
+  { 0xBE0Cu, 0.00080000 },
+  { 0xBE0Du, 0.00000000 },
+  { 0xBE0Eu, 0.00000000 },
+  { 0xBE0Fu, 0.00000000 },
+  { 0xBE10u, 0.00000000 },
+  { 0xBE11u, 0.00000000 },
+  { 0xBE12u, 0.00000000 },
+  { 0xBE13u, 0.00000000 },
+  { 0xBE14u, 0.00030000 },
+  { 0xBE15u, 0.00000000 },
+  { 0xBE16u, 0.00000000 },
+  { 0xBE17u, 0.00000000 },
+  { 0xBE18u, 0.00000000 },
+  { 0xBE19u, 0.00000000 },
+  { 0xBE1Au, 0.00000000 },
+  { 0xBE1Bu, 0.00000000 },
+  { 0xBE1Cu, 0.00000000 },
+  { 0xBE1Du, 0.00000000 },
+  { 0xBE1Eu, 0.00000000 },
+  { 0xBE1Fu, 0.00000000 },
+  { 0xBE20u, 0.00000000 },
+  { 0xBE21u, 0.00000000 },
+  { 0xBE22u, 0.00000000 },
+  { 0xBE23u, 0.00000000 },
+  { 0xBE24u, 0.00000000 },
+  { 0xBE25u, 0.00000000 },
+  { 0xBE26u, 0.00000000 },
+  { 0xBE27u, 0.00000000 },
+  { 0xBE28u, 0.00000000 },
+  { 0xBE29u, 0.00000000 },
+  { 0xBE2Au, 0.00000000 },
+  { 0xBE2Bu, 0.00000000 },
+  { 0xBE2Cu, 0.00000000 },
+  { 0xBE2Du, 0.00000000 },
+  { 0xBE2Eu, 0.00000000 },
+  { 0xBE2Fu, 0.00000000 },
+  { 0xBE30u, 0.00000000 },
+  { 0xBE31u, 0.00000000 },
+  { 0xBE32u, 0.00000000 },
+  { 0xBE33u, 0.00000000 },
+  { 0xBE34u, 0.00000000 },
+  { 0xBE35u, 0.00000000 },
+  { 0xBE36u, 0.00000000 },
+  { 0xBE37u, 0.00000000 },
+  { 0xBE38u, 0.00000000 },
+  { 0xBE39u, 0.00000000 },
+  { 0xBE3Au, 0.00000000 },
+  { 0xBE3Bu, 0.00000000 },
+  { 0xBE3Cu, 0.00000000 },
+  { 0xBE3Du, 0.00000000 },
+  { 0xBE3Eu, 0.00000000 },
+  { 0xBE3Fu, 0.00000000 },
+  { 0xBE40u, 0.00000000 },
+  { 0xBE41u, 0.00000000 },
+  { 0xBE42u, 0.00000000 },
+  { 0xBE43u, 0.00000000 },
+  { 0xBE44u, 0.00310000 },
+  { 0xBE45u, 0.00010000 },
+  { 0xBE46u, 0.00000000 },
+  { 0xBE47u, 0.00000000 },
+  { 0xBE48u, 0.00020000 },
+  { 0xBE49u, 0.00000000 },
+  { 0xBE4Au, 0.00000000 },
+  { 0xBE4Bu, 0.00000000 },
+  { 0xBE4Cu, 0.00020000 },
+  { 0xBE4Du, 0.00000000 },
+  { 0xBE4Eu, 0.00000000 },
+  { 0xBE4Fu, 0.00000000 },
+  { 0xBE50u, 0.00000000 },
+  { 0xBE51u, 0.00000000 },
+  { 0xBE52u, 0.00000000 },
+  { 0xBE53u, 0.00000000 },
+  { 0xBE54u, 0.00000000 },
+  { 0xBE55u, 0.00000000 },
+  { 0xBE56u, 0.00000000 },
+  { 0xBE57u, 0.00000000 },
+  { 0xBE58u, 0.00000000 },
+  { 0xBE59u, 0.00010000 },
+  { 0xBE5Au, 0.00000000 },
+  { 0xBE5Bu, 0.00010000 },
+  { 0xBE5Cu, 0.00000000 },
+  { 0xBE5Du, 0.00000000 },
+  { 0xBE5Eu, 0.00000000 },
+  { 0xBE5Fu, 0.00000000 },
+  { 0xBE60u, 0.00020000 },
+  { 0xBE61u, 0.00000000 },
+  { 0xBE62u, 0.00000000 },
+  { 0xBE63u, 0.00000000 },
+  { 0xBE64u, 0.00000000 },
+  { 0xBE65u, 0.00000000 },
+  { 0xBE66u, 0.00000000 },
+  { 0xBE67u, 0.00000000 },
+  { 0xBE68u, 0.00010000 },
+  { 0xBE69u, 0.00000000 },
+  { 0xBE6Au, 0.00000000 },
+  { 0xBE6Bu, 0.00000000 },
+  { 0xBE6Cu, 0.00000000 },
+  { 0xBE6Du, 0.00000000 },
+  { 0xBE6Eu, 0.00000000 },
+  { 0xBE6Fu, 0.00000000 },
+  { 0xBE70u, 0.00000000 },
+  { 0xBE71u, 0.00000000 },
+  { 0xBE72u, 0.00000000 },
+  { 0xBE73u, 0.00000000 },
+  { 0xBE74u, 0.00000000 },
+  { 0xBE75u, 0.00000000 },
+  { 0xBE76u, 0.00000000 },
+  { 0xBE77u, 0.00000000 },
+  { 0xBE78u, 0.00000000 },
+  { 0xBE79u, 0.00000000 },
+  { 0xBE7Au, 0.00000000 },
+  { 0xBE7Bu, 0.00000000 },
+  { 0xBE7Cu, 0.00000000 },
+  { 0xBE7Du, 0.00000000 },
+  { 0xBE7Eu, 0.00000000 },
+  { 0xBE7Fu, 0.00000000 },
+  { 0xBE80u, 0.00000000 },
+  { 0xBE81u, 0.00000000 },
+  { 0xBE82u, 0.00000000 },
+  { 0xBE83u, 0.00000000 },
+  { 0xBE84u, 0.00000000 },
+  { 0xBE85u, 0.00000000 },
+  { 0xBE86u, 0.00000000 },
+  { 0xBE87u, 0.00000000 },
+  { 0xBE88u, 0.00000000 },
+  { 0xBE89u, 0.00000000 },
+  { 0xBE8Au, 0.00000000 },
+  { 0xBE8Bu, 0.00000000 },
+  { 0xBE8Cu, 0.00000000 },
+  { 0xBE8Du, 0.00000000 },
+  { 0xBE8Eu, 0.00000000 },
+  { 0xBE8Fu, 0.00000000 },
+  { 0xBE90u, 0.00000000 },
+  { 0xBE91u, 0.00000000 },
+  { 0xBE92u, 0.00000000 },
+  { 0xBE93u, 0.00000000 },
+  { 0xBE94u, 0.00000000 },
+  { 0xBE95u, 0.00000000 },
+  { 0xBE96u, 0.00000000 },
+  { 0xBE97u, 0.00000000 },
+  { 0xBE98u, 0.00000000 },
+  { 0xBE99u, 0.00000000 },
+  { 0xBE9Au, 0.00000000 },
+  { 0xBE9Bu, 0.00000000 },
+  { 0xBE9Cu, 0.00000000 },
+  { 0xBE9Du, 0.00000000 },
+  { 0xBE9Eu, 0.00000000 },
+  { 0xBE9Fu, 0.00000000 },
+  { 0xBEA0u, 0.00000000 },
+  { 0xBEA1u, 0.00000000 },
+  { 0xBEA2u, 0.00000000 },
+  { 0xBEA3u, 0.00000000 },
+  { 0xBEA4u, 0.00000000 },
+  { 0xBEA5u, 0.00000000 },
+  { 0xBEA6u, 0.00000000 },
+  { 0xBEA7u, 0.00000000 },
+  { 0xBEA8u, 0.00000000 },
+  { 0xBEA9u, 0.00000000 },
+  { 0xBEAAu, 0.00000000 },
+  { 0xBEABu, 0.00000000 },
+  { 0xBEACu, 0.00000000 },
+  { 0xBEADu, 0.00000000 },
+  { 0xBEAEu, 0.00000000 },
+  { 0xBEAFu, 0.00000000 },
+  { 0xBEB0u, 0.00000000 },
+  { 0xBEB1u, 0.00000000 },
+  { 0xBEB2u, 0.00000000 },
+  { 0xBEB3u, 0.00000000 },
+  { 0xBEB4u, 0.00000000 },
+  { 0xBEB5u, 0.00000000 },
+  { 0xBEB6u, 0.00000000 },
+  { 0xBEB7u, 0.00000000 },
+  { 0xBEB8u, 0.00000000 },
+  { 0xBEB9u, 0.00000000 },
+  { 0xBEBAu, 0.00000000 },
+  { 0xBEBBu, 0.00000000 },
+  { 0xBEBCu, 0.00000000 },
+  { 0xBEBDu, 0.00000000 },
+  { 0xBEBEu, 0.00000000 },
+  { 0xBEBFu, 0.00000000 },
+  { 0xBEC0u, 0.00000000 },
+  { 0xBEC1u, 0.00000000 },
+  { 0xBEC2u, 0.00000000 },
+  { 0xBEC3u, 0.00000000 },
+  { 0xBEC4u, 0.00000000 },
+  { 0xBEC5u, 0.00000000 },
+  { 0xBEC6u, 0.00000000 },
+  { 0xBEC7u, 0.00000000 },
+  { 0xBEC8u, 0.00000000 },
+  { 0xBEC9u, 0.00000000 },
+  { 0xBECAu, 0.00000000 },
+  { 0xBECBu, 0.00000000 },
+  { 0xBECCu, 0.00000000 },
+  { 0xBECDu, 0.00000000 },
+  { 0xBECEu, 0.00000000 },
+  { 0xBECFu, 0.00000000 },
+  { 0xBED0u, 0.00000000 },
+  { 0xBED1u, 0.00000000 },
+  { 0xBED2u, 0.00000000 },
+  { 0xBED3u, 0.00000000 },
+  { 0xBED4u, 0.00000000 },
+  { 0xBED5u, 0.00000000 },
+  { 0xBED6u, 0.00000000 },
+  { 0xBED7u, 0.00000000 },
+  { 0xBED8u, 0.00000000 },
+  { 0xBED9u, 0.00000000 },
+  { 0xBEDAu, 0.00000000 },
+  { 0xBEDBu, 0.00000000 },
+  { 0xBEDCu, 0.00000000 },
+  { 0xBEDDu, 0.00000000 },
+  { 0xBEDEu, 0.00000000 },
+  { 0xBEDFu, 0.00000000 },
+  { 0xBEE0u, 0.00000000 },
+  { 0xBEE1u, 0.00000000 },
+  { 0xBEE2u, 0.00000000 },
+  { 0xBEE3u, 0.00000000 },
+  { 0xBEE4u, 0.00000000 },
+  { 0xBEE5u, 0.00000000 },
+  { 0xBEE6u, 0.00000000 },
+  { 0xBEE7u, 0.00000000 },
+  { 0xBEE8u, 0.00000000 },
+  { 0xBEE9u, 0.00000000 },
+  { 0xBEEAu, 0.00000000 },
+  { 0xBEEBu, 0.00000000 },
+  { 0xBEECu, 0.00000000 },
+  { 0xBEEDu, 0.00000000 },
+  { 0xBEEEu, 0.00000000 },
+  { 0xBEEFu, 0.00000000 },
+  { 0xBEF0u, 0.00000000 },
+  { 0xBEF1u, 0.00000000 },
+  { 0xBEF2u, 0.00000000 },
+  { 0xBEF3u, 0.00000000 },
+  { 0xBEF4u, 0.00000000 },
+  { 0xBEF5u, 0.00000000 },
+  { 0xBEF6u, 0.00000000 },
+  { 0xBEF7u, 0.00000000 },
+  { 0xBEF8u, 0.00000000 },
+  { 0xBEF9u, 0.00000000 },
+  { 0xBEFAu, 0.00000000 },
+  { 0xBEFBu, 0.00000000 },
+  { 0xBEFCu, 0.00000000 },
+  { 0xBEFDu, 0.00000000 },
+  { 0xBEFEu, 0.00000000 },
+  { 0xBEFFu, 0.00000000 },
+  { 0xBF00u, 0.00000000 },
+  { 0xBF01u, 0.00000000 },
+  { 0xBF02u, 0.00000000 },
+  { 0xBF03u, 0.00000000 },
+  { 0xBF04u, 0.00000000 },
+  { 0xBF05u, 0.00000000 },
+  { 0xBF06u, 0.00000000 },
+  { 0xBF07u, 0.00000000 },
+  { 0xBF08u, 0.00000000 },
+  { 0xBF09u, 0.00000000 },
+  { 0xBF0Au, 0.00000000 },
+  { 0xBF0Bu, 0.00000000 },
+  { 0xBF0Cu, 0.00000000 },
+  { 0xBF0Du, 0.00000000 },
+  { 0xBF0Eu, 0.00000000 },
+  { 0xBF0Fu, 0.00000000 },
+  { 0xBF10u, 0.00000000 },
+  { 0xBF11u, 0.00000000 },
+  { 0xBF12u, 0.00000000 },
+  { 0xBF13u, 0.00000000 },
+  { 0xBF14u, 0.00000000 },
+  { 0xBF15u, 0.00000000 },
+  { 0xBF16u, 0.00000000 },
+  { 0xBF17u, 0.00000000 },
+  { 0xBF18u, 0.00000000 },
+  { 0xBF19u, 0.00000000 },
+  { 0xBF1Au, 0.00000000 },
+  { 0xBF1Bu, 0.00000000 },
+  { 0xBF1Cu, 0.00000000 },
+  { 0xBF1Du, 0.00000000 },
+  { 0xBF1Eu, 0.00000000 },
+  { 0xBF1Fu, 0.00000000 },
+  { 0xBF20u, 0.00000000 },
+  { 0xBF21u, 0.00000000 },
+  { 0xBF22u, 0.00000000 },
+  { 0xBF23u, 0.00000000 },
+  { 0xBF24u, 0.00000000 },
+  { 0xBF25u, 0.00000000 },
+  { 0xBF26u, 0.00000000 },
+  { 0xBF27u, 0.00000000 },
+  { 0xBF28u, 0.00000000 },
+  { 0xBF29u, 0.00000000 },
+  { 0xBF2Au, 0.00000000 },
+  { 0xBF2Bu, 0.00000000 },
+  { 0xBF2Cu, 0.00000000 },
+  { 0xBF2Du, 0.00000000 },
+  { 0xBF2Eu, 0.00000000 },
+  { 0xBF2Fu, 0.00000000 },
+  { 0xBF30u, 0.00000000 },
+  { 0xBF31u, 0.00000000 },
+  { 0xBF32u, 0.00000000 },
+  { 0xBF33u, 0.00000000 },
+  { 0xBF34u, 0.00000000 },
+  { 0xBF35u, 0.00000000 },
+  { 0xBF36u, 0.00000000 },
+  { 0xBF37u, 0.00000000 },
+  { 0xBF38u, 0.00000000 },
+  { 0xBF39u, 0.00000000 },
+  { 0xBF3Au, 0.00000000 },
+  { 0xBF3Bu, 0.00000000 },
+  { 0xBF3Cu, 0.00000000 },
+  { 0xBF3Du, 0.00000000 },
+  { 0xBF3Eu, 0.00000000 },
+  { 0xBF3Fu, 0.00000000 },
+  { 0xBF40u, 0.00000000 },
+  { 0xBF41u, 0.00000000 },
+  { 0xBF42u, 0.00000000 },
+  { 0xBF43u, 0.00000000 },
+  { 0xBF44u, 0.00000000 },
+  { 0xBF45u, 0.00000000 },
+  { 0xBF46u, 0.00000000 },
+  { 0xBF47u, 0.00000000 },
+  { 0xBF48u, 0.00000000 },
+  { 0xBF49u, 0.00000000 },
+  { 0xBF4Au, 0.00000000 },
+  { 0xBF4Bu, 0.00000000 },
+  { 0xBF4Cu, 0.00000000 },
+  { 0xBF4Du, 0.00000000 },
+  { 0xBF4Eu, 0.00000000 },
+  { 0xBF4Fu, 0.00000000 },
+  { 0xBF50u, 0.00000000 },
+  { 0xBF51u, 0.00000000 },
+  { 0xBF52u, 0.00000000 },
+  { 0xBF53u, 0.00000000 },
+  { 0xBF54u, 0.00000000 },
+  { 0xBF55u, 0.00000000 },
+  { 0xBF56u, 0.00000000 },
+  { 0xBF57u, 0.00000000 },
+  { 0xBF58u, 0.00000000 },
+  { 0xBF59u, 0.00000000 },
+  { 0xBF5Au, 0.00000000 },
+  { 0xBF5Bu, 0.00000000 },
+  { 0xBF5Cu, 0.00000000 },
+  { 0xBF5Du, 0.00000000 },
+  { 0xBF5Eu, 0.00000000 },
+  { 0xBF5Fu, 0.00000000 },
+  { 0xBF60u, 0.00000000 },
+  { 0xBF61u, 0.00000000 },
+  { 0xBF62u, 0.00000000 },
+  { 0xBF63u, 0.00000000 },
+  { 0xBF64u, 0.00000000 },
+  { 0xBF65u, 0.00000000 },
+  { 0xBF66u, 0.00000000 },
+  { 0xBF67u, 0.00000000 },
+  { 0xBF68u, 0.00000000 },
+  { 0xBF69u, 0.00000000 },
+  { 0xBF6Au, 0.00000000 },
+  { 0xBF6Bu, 0.00000000 },
+  { 0xBF6Cu, 0.00000000 },
+  { 0xBF6Du, 0.00000000 },
+  { 0xBF6Eu, 0.00000000 },
+  { 0xBF6Fu, 0.00000000 },
+  { 0xBF70u, 0.00000000 },
+  { 0xBF71u, 0.00000000 },
+  { 0xBF72u, 0.00000000 },
+  { 0xBF73u, 0.00000000 },
+  { 0xBF74u, 0.00000000 },
+  { 0xBF75u, 0.00000000 },
+  { 0xBF76u, 0.00000000 },
+  { 0xBF77u, 0.00000000 },
+  { 0xBF78u, 0.00000000 },
+  { 0xBF79u, 0.00000000 },
+  { 0xBF7Au, 0.00000000 },
+  { 0xBF7Bu, 0.00000000 },
+  { 0xBF7Cu, 0.00000000 },
+  { 0xBF7Du, 0.00000000 },
+  { 0xBF7Eu, 0.00000000 },
+  { 0xBF7Fu, 0.00000000 },
+  { 0xBF80u, 0.00000000 },
+  { 0xBF81u, 0.00000000 },
+  { 0xBF82u, 0.00000000 },
+  { 0xBF83u, 0.00000000 },
+  { 0xBF84u, 0.00000000 },
+  { 0xBF85u, 0.00000000 },
+  { 0xBF86u, 0.00000000 },
+  { 0xBF87u, 0.00000000 },
+  { 0xBF88u, 0.00000000 },
+  { 0xBF89u, 0.00000000 },
+  { 0xBF8Au, 0.00000000 },
+  { 0xBF8Bu, 0.00000000 },
+  { 0xBF8Cu, 0.00000000 },
+  { 0xBF8Du, 0.00000000 },
+  { 0xBF8Eu, 0.00000000 },
+  { 0xBF8Fu, 0.00000000 },
+  { 0xBF90u, 0.00000000 },
+  { 0xBF91u, 0.00000000 },
+  { 0xBF92u, 0.00000000 },
+  { 0xBF93u, 0.00000000 },
+  { 0xBF94u, 0.00000000 },
+  { 0xBF95u, 0.00000000 },
+  { 0xBF96u, 0.00000000 },
+  { 0xBF97u, 0.00000000 },
+  { 0xBF98u, 0.00000000 },
+  { 0xBF99u, 0.00000000 },
+  { 0xBF9Au, 0.00000000 },
+  { 0xBF9Bu, 0.00000000 },
+  { 0xBF9Cu, 0.00000000 },
+  { 0xBF9Du, 0.00000000 },
+  { 0xBF9Eu, 0.00000000 },
+  { 0xBF9Fu, 0.00000000 },
+  { 0xBFA0u, 0.00000000 },
+  { 0xBFA1u, 0.00000000 },
+  { 0xBFA2u, 0.00000000 },
+  { 0xBFA3u, 0.00000000 },
+  { 0xBFA4u, 0.00000000 },
+  { 0xBFA5u, 0.00000000 },
+  { 0xBFA6u, 0.00000000 },
+  { 0xBFA7u, 0.00000000 },
+  { 0xBFA8u, 0.00000000 },
+  { 0xBFA9u, 0.00000000 },
+  { 0xBFAAu, 0.00000000 },
+  { 0xBFABu, 0.00000000 },
+  { 0xBFACu, 0.00000000 },
+  { 0xBFADu, 0.00000000 },
+  { 0xBFAEu, 0.00000000 },
+  { 0xBFAFu, 0.00000000 },
+  { 0xBFB0u, 0.00000000 },
+  { 0xBFB1u, 0.00000000 },
+  { 0xBFB2u, 0.00000000 },
+  { 0xBFB3u, 0.00000000 },
+  { 0xBFB4u, 0.00000000 },
+  { 0xBFB5u, 0.00000000 },
+  { 0xBFB6u, 0.00000000 },
+  { 0xBFB7u, 0.00000000 },
+  { 0xBFB8u, 0.00000000 },
+  { 0xBFB9u, 0.00000000 },
+  { 0xBFBAu, 0.00000000 },
+  { 0xBFBBu, 0.00000000 },
+  { 0xBFBCu, 0.00000000 },
+  { 0xBFBDu, 0.00000000 },
+  { 0xBFBEu, 0.00000000 },
+  { 0xBFBFu, 0.00000000 },
+  { 0xBFC0u, 0.00000000 },
+  { 0xBFC1u, 0.00000000 },
+  { 0xBFC2u, 0.00000000 },
+  { 0xBFC3u, 0.00000000 },
+  { 0xBFC4u, 0.00000000 },
+  { 0xBFC5u, 0.00000000 },
+  { 0xBFC6u, 0.00000000 },
+  { 0xBFC7u, 0.00000000 },
+  { 0xBFC8u, 0.00000000 },
+  { 0xBFC9u, 0.00000000 },
+  { 0xBFCAu, 0.00000000 },
+  { 0xBFCBu, 0.00000000 },
+  { 0xBFCCu, 0.00000000 },
+  { 0xBFCDu, 0.00000000 },
+  { 0xBFCEu, 0.00000000 },
+  { 0xBFCFu, 0.00000000 },
+  { 0xBFD0u, 0.00020000 },
+  { 0xBFD1u, 0.00000000 },
+  { 0xBFD2u, 0.00000000 },
+  { 0xBFD3u, 0.00000000 },
+  { 0xBFD4u, 0.00000000 },
+  { 0xBFD5u, 0.00000000 },
+  { 0xBFD6u, 0.00000000 },
+  { 0xBFD7u, 0.00000000 },
+  { 0xBFD8u, 0.00000000 },
+  { 0xBFD9u, 0.00000000 },
+  { 0xBFDAu, 0.00000000 },
+  { 0xBFDBu, 0.00000000 },
+  { 0xBFDCu, 0.00000000 },
+  { 0xBFDDu, 0.00000000 },
+  { 0xBFDEu, 0.00000000 },
+  { 0xBFDFu, 0.00000000 },
+  { 0xBFE0u, 0.00000000 },
+  { 0xBFE1u, 0.00000000 },
+  { 0xBFE2u, 0.00000000 },
+  { 0xBFE3u, 0.00000000 },
+  { 0xBFE4u, 0.00000000 },
+  { 0xBFE5u, 0.00000000 },
+  { 0xBFE6u, 0.00000000 },
+  { 0xBFE7u, 0.00000000 },
+  { 0xBFE8u, 0.00000000 },
+  { 0xBFE9u, 0.00000000 },
+  { 0xBFEAu, 0.00000000 },
+  { 0xBFEBu, 0.00000000 },
+  { 0xBFECu, 0.00000000 },
+  { 0xBFEDu, 0.00000000 },
+  { 0xBFEEu, 0.00000000 },
+  { 0xBFEFu, 0.00000000 },
+  { 0xBFF0u, 0.00000000 },
+  { 0xBFF1u, 0.00000000 },
+  { 0xBFF2u, 0.00000000 },
+  { 0xBFF3u, 0.00000000 },
+  { 0xBFF4u, 0.00000000 },
+  { 0xBFF5u, 0.00000000 },
+  { 0xBFF6u, 0.00000000 },
+  { 0xBFF7u, 0.00000000 },
+  { 0xBFF8u, 0.00000000 },
+  { 0xBFF9u, 0.00000000 },
+  { 0xBFFAu, 0.00000000 },
+  { 0xBFFBu, 0.00000000 },
+  { 0xBFFCu, 0.00000000 },
+  { 0xBFFDu, 0.00000000 },
+  { 0xBFFEu, 0.00000000 },
+  { 0xBFFFu, 0.00000000 },
+  { 0xC000u, 0.00000000 },
+  { 0xC001u, 0.00000000 },
+  { 0xC002u, 0.00000000 },
+  { 0xC003u, 0.00000000 },
+  { 0xC004u, 0.00000000 },
+  { 0xC005u, 0.00000000 },
+  { 0xC006u, 0.00000000 },
+  { 0xC007u, 0.00000000 },
+  { 0xC008u, 0.00000000 },
+  { 0xC009u, 0.00000000 },
+  { 0xC00Au, 0.00000000 },
+  { 0xC00Bu, 0.00000000 },
+  { 0xC00Cu, 0.00000000 },
+  { 0xC00Du, 0.00000000 },
+  { 0xC00Eu, 0.00000000 },
+  { 0xC00Fu, 0.00000000 },
+  { 0xC010u, 0.00000000 },
+  { 0xC011u, 0.00000000 },
+  { 0xC012u, 0.00000000 },
+  { 0xC013u, 0.00000000 },
+  { 0xC014u, 0.00000000 },
+  { 0xC015u, 0.00000000 },
+  { 0xC016u, 0.00000000 },
+  { 0xC017u, 0.00000000 },
+  { 0xC018u, 0.00000000 },
+  { 0xC019u, 0.00000000 },
+  { 0xC01Au, 0.00000000 },
+  { 0xC01Bu, 0.00000000 },
+  { 0xC01Cu, 0.00000000 },
+  { 0xC01Du, 0.00000000 },
+  { 0xC01Eu, 0.00000000 },
+  { 0xC01Fu, 0.00000000 },
+  { 0xC020u, 0.00000000 },
+  { 0xC021u, 0.00000000 },
+  { 0xC022u, 0.00000000 },
+  { 0xC023u, 0.00000000 },
+  { 0xC024u, 0.00000000 },
+  { 0xC025u, 0.00000000 },
+  { 0xC026u, 0.00000000 },
+  { 0xC027u, 0.00000000 },
+  { 0xC028u, 0.00000000 },
+  { 0xC029u, 0.00000000 },
+  { 0xC02Au, 0.00000000 },
+  { 0xC02Bu, 0.00000000 },
+  { 0xC02Cu, 0.00000000 },
+  { 0xC02Du, 0.00000000 },
+  { 0xC02Eu, 0.00000000 },
+  { 0xC02Fu, 0.00000000 },
+  { 0xC030u, 0.00000000 },
+  { 0xC031u, 0.00000000 },
+  { 0xC032u, 0.00000000 },
+  { 0xC033u, 0.00000000 },
+  { 0xC034u, 0.00000000 },
+  { 0xC035u, 0.00000000 },
+  { 0xC036u, 0.00000000 },
+  { 0xC037u, 0.00000000 },
+  { 0xC038u, 0.00000000 },
+  { 0xC039u, 0.00000000 },
+  { 0xC03Au, 0.00000000 },
+  { 0xC03Bu, 0.00000000 },
+  { 0xC03Cu, 0.00000000 },
+  { 0xC03Du, 0.00000000 },
+  { 0xC03Eu, 0.00000000 },
+  { 0xC03Fu, 0.00000000 },
+  { 0xC040u, 0.00000000 },
+  { 0xC041u, 0.00000000 },
+  { 0xC042u, 0.00000000 },
+  { 0xC043u, 0.00000000 },
+  { 0xC044u, 0.00000000 },
+  { 0xC045u, 0.00000000 },
+  { 0xC046u, 0.00000000 },
+  { 0xC047u, 0.00000000 },
+  { 0xC048u, 0.00000000 },
+  { 0xC049u, 0.00000000 },
+  { 0xC04Au, 0.00000000 },
+  { 0xC04Bu, 0.00000000 },
+  { 0xC04Cu, 0.00000000 },
+  { 0xC04Du, 0.00000000 },
+  { 0xC04Eu, 0.00000000 },
+  { 0xC04Fu, 0.00000000 },
+  { 0xC050u, 0.00000000 },
+  { 0xC051u, 0.00000000 },
+  { 0xC052u, 0.00000000 },
+  { 0xC053u, 0.00000000 },
+  { 0xC054u, 0.00000000 },
+  { 0xC055u, 0.00000000 },
+  { 0xC056u, 0.00000000 },
+  { 0xC057u, 0.00000000 },
+  { 0xC058u, 0.00000000 },
+  { 0xC059u, 0.00000000 },
+  { 0xC05Au, 0.00000000 },
+  { 0xC05Bu, 0.00000000 },
+  { 0xC05Cu, 0.00000000 },
+  { 0xC05Du, 0.00000000 },
+  { 0xC05Eu, 0.00000000 },
+  { 0xC05Fu, 0.00000000 },
+  { 0xC060u, 0.00000000 },
+  { 0xC061u, 0.00000000 },
+  { 0xC062u, 0.00000000 },
+  { 0xC063u, 0.00000000 },
+  { 0xC064u, 0.00000000 },
+  { 0xC065u, 0.00000000 },
+  { 0xC066u, 0.00000000 },
+  { 0xC067u, 0.00000000 },
+  { 0xC068u, 0.00000000 },
+  { 0xC069u, 0.00000000 },
+  { 0xC06Au, 0.00000000 },
+  { 0xC06Bu, 0.00000000 },
+  { 0xC06Cu, 0.00000000 },
+  { 0xC06Du, 0.00000000 },
+  { 0xC06Eu, 0.00000000 },
+  { 0xC06Fu, 0.00000000 },
+  { 0xC070u, 0.00000000 },
+  { 0xC071u, 0.00000000 },
+  { 0xC072u, 0.00000000 },
+  { 0xC073u, 0.00000000 },
+  { 0xC074u, 0.00000000 },
+  { 0xC075u, 0.00000000 },
+  { 0xC076u, 0.00000000 },
+  { 0xC077u, 0.00000000 },
+  { 0xC078u, 0.00000000 },
+  { 0xC079u, 0.00000000 },
+  { 0xC07Au, 0.00000000 },
+  { 0xC07Bu, 0.00000000 },
+  { 0xC07Cu, 0.00000000 },
+  { 0xC07Du, 0.00000000 },
+  { 0xC07Eu, 0.00000000 },
+  { 0xC07Fu, 0.00000000 },
+  { 0xC080u, 0.00000000 },
+  { 0xC081u, 0.00000000 },
+  { 0xC082u, 0.00000000 },
+  { 0xC083u, 0.00000000 },
+  { 0xC084u, 0.00000000 },
+  { 0xC085u, 0.00000000 },
+  { 0xC086u, 0.00000000 },
+  { 0xC087u, 0.00000000 },
+  { 0xC088u, 0.00000000 },
+  { 0xC089u, 0.00000000 },
+  { 0xC08Au, 0.00000000 },
+  { 0xC08Bu, 0.00000000 },
+  { 0xC08Cu, 0.00000000 },
+  { 0xC08Du, 0.00000000 },
+  { 0xC08Eu, 0.00000000 },
+  { 0xC08Fu, 0.00000000 },
+  { 0xC090u, 0.00000000 },
+  { 0xC091u, 0.00000000 },
+  { 0xC092u, 0.00000000 },
+  { 0xC093u, 0.00000000 },
+  { 0xC094u, 0.00000000 },
+  { 0xC095u, 0.00000000 },
+  { 0xC096u, 0.00000000 },
+  { 0xC097u, 0.00000000 },
+  { 0xC098u, 0.00000000 },
+  { 0xC099u, 0.00000000 },
+  { 0xC09Au, 0.00000000 },
+  { 0xC09Bu, 0.00000000 },
+  { 0xC09Cu, 0.00000000 },
+  { 0xC09Du, 0.00000000 },
+  { 0xC09Eu, 0.00000000 },
+  { 0xC09Fu, 0.00000000 },
+  { 0xC0A0u, 0.00000000 },
+  { 0xC0A1u, 0.00000000 },
+  { 0xC0A2u, 0.00000000 },
+  { 0xC0A3u, 0.00000000 },
+  { 0xC0A4u, 0.00000000 },
+  { 0xC0A5u, 0.00000000 },
+  { 0xC0A6u, 0.00000000 },
+  { 0xC0A7u, 0.00000000 },
+  { 0xC0A8u, 0.00000000 },
+  { 0xC0A9u, 0.00000000 },
+  { 0xC0AAu, 0.00000000 },
+  { 0xC0ABu, 0.00000000 },
+  { 0xC0ACu, 0.00950000 },
+  { 0xC0ADu, 0.00010000 },
+  { 0xC0AEu, 0.00000000 },
+  { 0xC0AFu, 0.00000000 },
+  { 0xC0B0u, 0.00230000 },
+  { 0xC0B1u, 0.00000000 },
+  { 0xC0B2u, 0.00000000 },
+  { 0xC0B3u, 0.00000000 },
+  { 0xC0B4u, 0.00060000 },
+  { 0xC0B5u, 0.00000000 },
+  { 0xC0B6u, 0.00000000 },
+  { 0xC0B7u, 0.00000000 },
+  { 0xC0B8u, 0.00000000 },
+  { 0xC0B9u, 0.00000000 },
+  { 0xC0BAu, 0.00000000 },
+  { 0xC0BBu, 0.00000000 },
+  { 0xC0BCu, 0.00050000 },
+  { 0xC0BDu, 0.00000000 },
+  { 0xC0BEu, 0.00000000 },
+  { 0xC0BFu, 0.00000000 },
+  { 0xC0C0u, 0.00000000 },
+  { 0xC0C1u, 0.00420000 },
+  { 0xC0C2u, 0.00000000 },
+  { 0xC0C3u, 0.00000000 },
+  { 0xC0C4u, 0.00000000 },
+  { 0xC0C5u, 0.00000000 },
+  { 0xC0C6u, 0.00000000 },
+  { 0xC0C7u, 0.00000000 },
+  { 0xC0C8u, 0.00050000 },
+  { 0xC0C9u, 0.00050000 },
+  { 0xC0CAu, 0.00000000 },
+  { 0xC0CBu, 0.00000000 },
+  { 0xC0CCu, 0.00000000 },
+  { 0xC0CDu, 0.00000000 },
+  { 0xC0CEu, 0.00000000 },
+  { 0xC0CFu, 0.00000000 },
+  { 0xC0D0u, 0.00000000 },
+  { 0xC0D1u, 0.00000000 },
+  { 0xC0D2u, 0.00000000 },
+  { 0xC0D3u, 0.00000000 },
+  { 0xC0D4u, 0.00000000 },
+  { 0xC0D5u, 0.00000000 },
+  { 0xC0D6u, 0.00000000 },
+  { 0xC0D7u, 0.00000000 },
+  { 0xC0D8u, 0.00000000 },
+  { 0xC0D9u, 0.00000000 },
+  { 0xC0DAu, 0.00000000 },
+  { 0xC0DBu, 0.00000000 },
+  { 0xC0DCu, 0.00000000 },
+  { 0xC0DDu, 0.00200000 },
+  { 0xC0DEu, 0.00000000 },
+  { 0xC0DFu, 0.00000000 },
+  { 0xC0E0u, 0.00000000 },
+  { 0xC0E1u, 0.00000000 },
+  { 0xC0E2u, 0.00000000 },
+  { 0xC0E3u, 0.00000000 },
+  { 0xC0E4u, 0.00020000 },
+  { 0xC0E5u, 0.00000000 },
+  { 0xC0E6u, 0.00000000 },
+  { 0xC0E7u, 0.00000000 },
+  { 0xC0E8u, 0.00000000 },
+  { 0xC0E9u, 0.00000000 },
+  { 0xC0EAu, 0.00000000 },
+  { 0xC0EBu, 0.00000000 },
+  { 0xC0ECu, 0.00000000 },
+  { 0xC0EDu, 0.00000000 },
+  { 0xC0EEu, 0.00000000 },
+  { 0xC0EFu, 0.00000000 },
+  { 0xC0F0u, 0.00000000 },
+  { 0xC0F1u, 0.00000000 },
+  { 0xC0F2u, 0.00000000 },
+  { 0xC0F3u, 0.00000000 },
+  { 0xC0F4u, 0.00000000 },
+  { 0xC0F5u, 0.00000000 },
+  { 0xC0F6u, 0.00000000 },
+  { 0xC0F7u, 0.00000000 },
+  { 0xC0F8u, 0.00000000 },
+  { 0xC0F9u, 0.00000000 },
+  { 0xC0FAu, 0.00000000 },
+  { 0xC0FBu, 0.00000000 },
+  { 0xC0FCu, 0.00000000 },
+  { 0xC0FDu, 0.00000000 },
+  { 0xC0FEu, 0.00000000 },
+  { 0xC0FFu, 0.00000000 },
+  { 0xC100u, 0.00000000 },
+  { 0xC101u, 0.00000000 },
+  { 0xC102u, 0.00000000 },
+  { 0xC103u, 0.00000000 },
+  { 0xC104u, 0.00000000 },
+  { 0xC105u, 0.00000000 },
+  { 0xC106u, 0.00000000 },
+  { 0xC107u, 0.00000000 },
+  { 0xC108u, 0.00000000 },
+  { 0xC109u, 0.00000000 },
+  { 0xC10Au, 0.00000000 },
+  { 0xC10Bu, 0.00000000 },
+  { 0xC10Cu, 0.00000000 },
+  { 0xC10Du, 0.00000000 },
+  { 0xC10Eu, 0.00000000 },
+  { 0xC10Fu, 0.00000000 },
+  { 0xC110u, 0.00000000 },
+  { 0xC111u, 0.00000000 },
+  { 0xC112u, 0.00000000 },
+  { 0xC113u, 0.00000000 },
+  { 0xC114u, 0.00000000 },
+  { 0xC115u, 0.00000000 },
+  { 0xC116u, 0.00000000 },
+  { 0xC117u, 0.00000000 },
+  { 0xC118u, 0.00000000 },
+  { 0xC119u, 0.00000000 },
+  { 0xC11Au, 0.00000000 },
+  { 0xC11Bu, 0.00000000 },
+  { 0xC11Cu, 0.01220000 },
+  { 0xC11Du, 0.00070000 },
+  { 0xC11Eu, 0.00000000 },
+  { 0xC11Fu, 0.00000000 },
+  { 0xC120u, 0.00370000 },
+  { 0xC121u, 0.00000000 },
+  { 0xC122u, 0.00000000 },
+  { 0xC123u, 0.00000000 },
+  { 0xC124u, 0.00150000 },
+  { 0xC125u, 0.00000000 },
+  { 0xC126u, 0.00000000 },
+  { 0xC127u, 0.00000000 },
+  { 0xC128u, 0.00000000 },
+  { 0xC129u, 0.00000000 },
+  { 0xC12Au, 0.00000000 },
+  { 0xC12Bu, 0.00000000 },
+  { 0xC12Cu, 0.00030000 },
+  { 0xC12Du, 0.00010000 },
+  { 0xC12Eu, 0.00000000 },
+  { 0xC12Fu, 0.00010000 },
+  { 0xC130u, 0.00000000 },
+  { 0xC131u, 0.00460000 },
+  { 0xC132u, 0.00000000 },
+  { 0xC133u, 0.00000000 },
+  { 0xC134u, 0.00000000 },
+  { 0xC135u, 0.00000000 },
+  { 0xC136u, 0.00000000 },
+  { 0xC137u, 0.00000000 },
+  { 0xC138u, 0.00330000 },
+  { 0xC139u, 0.00000000 },
+  { 0xC13Au, 0.00000000 },
+  { 0xC13Bu, 0.00000000 },
+  { 0xC13Cu, 0.00030000 },
+  { 0xC13Du, 0.00000000 },
+  { 0xC13Eu, 0.00000000 },
+  { 0xC13Fu, 0.00000000 },
+  { 0xC140u, 0.00010000 },
+  { 0xC141u, 0.00000000 },
+  { 0xC142u, 0.00000000 },
+  { 0xC143u, 0.00000000 },
+  { 0xC144u, 0.00000000 },
+  { 0xC145u, 0.00000000 },
+  { 0xC146u, 0.00000000 },
+  { 0xC147u, 0.00000000 },
+  { 0xC148u, 0.00000000 },
+  { 0xC149u, 0.00000000 },
+  { 0xC14Au, 0.00000000 },
+  { 0xC14Bu, 0.00000000 },
+  { 0xC14Cu, 0.00000000 },
+  { 0xC14Du, 0.00000000 },
+  { 0xC14Eu, 0.00000000 },
+  { 0xC14Fu, 0.00000000 },
+  { 0xC150u, 0.00000000 },
+  { 0xC151u, 0.00000000 },
+  { 0xC152u, 0.00000000 },
+  { 0xC153u, 0.00000000 },
+  { 0xC154u, 0.00010000 },
+  { 0xC155u, 0.00000000 },
+  { 0xC156u, 0.00000000 },
+  { 0xC157u, 0.00000000 },
+  { 0xC158u, 0.00040000 },
+  { 0xC159u, 0.00000000 },
+  { 0xC15Au, 0.00000000 },
+  { 0xC15Bu, 0.00000000 },
+  { 0xC15Cu, 0.00000000 },
+  { 0xC15Du, 0.00000000 },
+  { 0xC15Eu, 0.00000000 },
+  { 0xC15Fu, 0.00000000 },
+  { 0xC160u, 0.00000000 },
+  { 0xC161u, 0.00000000 },
+  { 0xC162u, 0.00000000 },
+  { 0xC163u, 0.00000000 },
+  { 0xC164u, 0.00000000 },
+  { 0xC165u, 0.00000000 },
+  { 0xC166u, 0.00000000 },
+  { 0xC167u, 0.00000000 },
+  { 0xC168u, 0.00000000 },
+  { 0xC169u, 0.00000000 },
+  { 0xC16Au, 0.00000000 },
+  { 0xC16Bu, 0.00000000 },
+  { 0xC16Cu, 0.00000000 },
+  { 0xC16Du, 0.00000000 },
+  { 0xC16Eu, 0.00000000 },
+  { 0xC16Fu, 0.00000000 },
+  { 0xC170u, 0.00010000 },
+  { 0xC171u, 0.00000000 },
+  { 0xC172u, 0.00000000 },
+  { 0xC173u, 0.00000000 },
+  { 0xC174u, 0.00000000 },
+  { 0xC175u, 0.00000000 },
+  { 0xC176u, 0.00000000 },
+  { 0xC177u, 0.00000000 },
+  { 0xC178u, 0.00000000 },
+  { 0xC179u, 0.00000000 },
+  { 0xC17Au, 0.00000000 },
+  { 0xC17Bu, 0.00000000 },
+  { 0xC17Cu, 0.00000000 },
+  { 0xC17Du, 0.00000000 },
+  { 0xC17Eu, 0.00000000 },
+  { 0xC17Fu, 0.00000000 },
+  { 0xC180u, 0.00000000 },
+  { 0xC181u, 0.00000000 },
+  { 0xC182u, 0.00000000 },
+  { 0xC183u, 0.00000000 },
+  { 0xC184u, 0.00000000 },
+  { 0xC185u, 0.00000000 },
+  { 0xC186u, 0.00000000 },
+  { 0xC187u, 0.00000000 },
+  { 0xC188u, 0.00000000 },
+  { 0xC189u, 0.00000000 },
+  { 0xC18Au, 0.00000000 },
+  { 0xC18Bu, 0.00000000 },
+  { 0xC18Cu, 0.00320000 },
+  { 0xC18Du, 0.00160000 },
+  { 0xC18Eu, 0.00000000 },
+  { 0xC18Fu, 0.00000000 },
+  { 0xC190u, 0.00040000 },
+  { 0xC191u, 0.00000000 },
+  { 0xC192u, 0.00000000 },
+  { 0xC193u, 0.00000000 },
+  { 0xC194u, 0.00010000 },
+  { 0xC195u, 0.00000000 },
+  { 0xC196u, 0.00000000 },
+  { 0xC197u, 0.00000000 },
+  { 0xC198u, 0.00000000 },
+  { 0xC199u, 0.00000000 },
+  { 0xC19Au, 0.00000000 },
+  { 0xC19Bu, 0.00000000 },
+  { 0xC19Cu, 0.00000000 },
+  { 0xC19Du, 0.00000000 },
+  { 0xC19Eu, 0.00000000 },
+  { 0xC19Fu, 0.00000000 },
+  { 0xC1A0u, 0.00000000 },
+  { 0xC1A1u, 0.00070000 },
+  { 0xC1A2u, 0.00000000 },
+  { 0xC1A3u, 0.00000000 },
+  { 0xC1A4u, 0.00000000 },
+  { 0xC1A5u, 0.00000000 },
+  { 0xC1A6u, 0.00000000 },
+  { 0xC1A7u, 0.00000000 },
+  { 0xC1A8u, 0.00000000 },
+  { 0xC1A9u, 0.00000000 },
+  { 0xC1AAu, 0.00000000 },
+  { 0xC1ABu, 0.00000000 },
+  { 0xC1ACu, 0.00000000 },
+  { 0xC1ADu, 0.00000000 },
+  { 0xC1AEu, 0.00000000 },
+  { 0xC1AFu, 0.00000000 },
+  { 0xC1B0u, 0.00000000 },
+  { 0xC1B1u, 0.00000000 },
+  { 0xC1B2u, 0.00000000 },
+  { 0xC1B3u, 0.00000000 },
+  { 0xC1B4u, 0.00000000 },
+  { 0xC1B5u, 0.00000000 },
+  { 0xC1B6u, 0.00000000 },
+  { 0xC1B7u, 0.00000000 },
+  { 0xC1B8u, 0.00000000 },
+  { 0xC1B9u, 0.00000000 },
+  { 0xC1BAu, 0.00000000 },
+  { 0xC1BBu, 0.00000000 },
+  { 0xC1BCu, 0.00000000 },
+  { 0xC1BDu, 0.00000000 },
+  { 0xC1BEu, 0.00000000 },
+  { 0xC1BFu, 0.00000000 },
+  { 0xC1C0u, 0.00000000 },
+  { 0xC1C1u, 0.00000000 },
+  { 0xC1C2u, 0.00000000 },
+  { 0xC1C3u, 0.00000000 },
+  { 0xC1C4u, 0.00010000 },
+  { 0xC1C5u, 0.00000000 },
+  { 0xC1C6u, 0.00000000 },
+  { 0xC1C7u, 0.00000000 },
+  { 0xC1C8u, 0.00000000 },
+  { 0xC1C9u, 0.00000000 },
+  { 0xC1CAu, 0.00000000 },
+  { 0xC1CBu, 0.00000000 },
+  { 0xC1CCu, 0.00000000 },
+  { 0xC1CDu, 0.00000000 },
+  { 0xC1CEu, 0.00000000 },
+  { 0xC1CFu, 0.00000000 },
+  { 0xC1D0u, 0.00000000 },
+  { 0xC1D1u, 0.00000000 },
+  { 0xC1D2u, 0.00000000 },
+  { 0xC1D3u, 0.00000000 },
+  { 0xC1D4u, 0.00000000 },
+  { 0xC1D5u, 0.00000000 },
+  { 0xC1D6u, 0.00000000 },
+  { 0xC1D7u, 0.00000000 },
+  { 0xC1D8u, 0.00000000 },
+  { 0xC1D9u, 0.00000000 },
+  { 0xC1DAu, 0.00000000 },
+  { 0xC1DBu, 0.00000000 },
+  { 0xC1DCu, 0.00000000 },
+  { 0xC1DDu, 0.00000000 },
+  { 0xC1DEu, 0.00000000 },
+  { 0xC1DFu, 0.00000000 },
+  { 0xC1E0u, 0.00010000 },
+  { 0xC1E1u, 0.00000000 },
+  { 0xC1E2u, 0.00000000 },
+  { 0xC1E3u, 0.00000000 },
+  { 0xC1E4u, 0.00000000 },
+  { 0xC1E5u, 0.00000000 },
+  { 0xC1E6u, 0.00000000 },
+  { 0xC1E7u, 0.00000000 },
+  { 0xC1E8u, 0.00000000 },
+  { 0xC1E9u, 0.00000000 },
+  { 0xC1EAu, 0.00000000 },
+  { 0xC1EBu, 0.00000000 },
+  { 0xC1ECu, 0.00000000 },
+  { 0xC1EDu, 0.00000000 },
+  { 0xC1EEu, 0.00000000 },
+  { 0xC1EFu, 0.00000000 },
+  { 0xC1F0u, 0.00000000 },
+  { 0xC1F1u, 0.00000000 },
+  { 0xC1F2u, 0.00000000 },
+  { 0xC1F3u, 0.00000000 },
+  { 0xC1F4u, 0.00000000 },
+  { 0xC1F5u, 0.00000000 },
+  { 0xC1F6u, 0.00000000 },
+  { 0xC1F7u, 0.00000000 },
+  { 0xC1F8u, 0.00000000 },
+  { 0xC1F9u, 0.00000000 },
+  { 0xC1FAu, 0.00000000 },
+  { 0xC1FBu, 0.00000000 },
+  { 0xC1FCu, 0.00020000 },
+  { 0xC1FDu, 0.00000000 },
+  { 0xC1FEu, 0.00000000 },
+  { 0xC1FFu, 0.00000000 },
+  { 0xC200u, 0.00000000 },
+  { 0xC201u, 0.00000000 },
+  { 0xC202u, 0.00000000 },
+  { 0xC203u, 0.00000000 },
+  { 0xC204u, 0.00000000 },
+  { 0xC205u, 0.00000000 },
+  { 0xC206u, 0.00000000 },
+  { 0xC207u, 0.00000000 },
+  { 0xC208u, 0.00000000 },
+  { 0xC209u, 0.00000000 },
+  { 0xC20Au, 0.00000000 },
+  { 0xC20Bu, 0.00000000 },
+  { 0xC20Cu, 0.00000000 },
+  { 0xC20Du, 0.00000000 },
+  { 0xC20Eu, 0.00000000 },
+  { 0xC20Fu, 0.00000000 },
+  { 0xC210u, 0.00000000 },
+  { 0xC211u, 0.00000000 },
+  { 0xC212u, 0.00000000 },
+  { 0xC213u, 0.00000000 },
+  { 0xC214u, 0.00000000 },
+  { 0xC215u, 0.00000000 },
+  { 0xC216u, 0.00000000 },
+  { 0xC217u, 0.00000000 },
+  { 0xC218u, 0.00660000 },
+  { 0xC219u, 0.00020000 },
+  { 0xC21Au, 0.00000000 },
+  { 0xC21Bu, 0.00000000 },
+  { 0xC21Cu, 0.00050000 },
+  { 0xC21Du, 0.00000000 },
+  { 0xC21Eu, 0.00000000 },
+  { 0xC21Fu, 0.00000000 },
+  { 0xC220u, 0.00070000 },
+  { 0xC221u, 0.00000000 },
+  { 0xC222u, 0.00000000 },
+  { 0xC223u, 0.00000000 },
+  { 0xC224u, 0.00000000 },
+  { 0xC225u, 0.00000000 },
+  { 0xC226u, 0.00000000 },
+  { 0xC227u, 0.00000000 },
+  { 0xC228u, 0.00010000 },
+  { 0xC229u, 0.00000000 },
+  { 0xC22Au, 0.00000000 },
+  { 0xC22Bu, 0.00000000 },
+  { 0xC22Cu, 0.00000000 },
+  { 0xC22Du, 0.00010000 },
+  { 0xC22Eu, 0.00000000 },
+  { 0xC22Fu, 0.00000000 },
+  { 0xC230u, 0.00000000 },
+  { 0xC231u, 0.00000000 },
+  { 0xC232u, 0.00000000 },
+  { 0xC233u, 0.00000000 },
+  { 0xC234u, 0.00000000 },
+  { 0xC235u, 0.00000000 },
+  { 0xC236u, 0.00000000 },
+  { 0xC237u, 0.00000000 },
+  { 0xC238u, 0.00000000 },
+  { 0xC239u, 0.00000000 },
+  { 0xC23Au, 0.00000000 },
+  { 0xC23Bu, 0.00000000 },
+  { 0xC23Cu, 0.00000000 },
+  { 0xC23Du, 0.00000000 },
+  { 0xC23Eu, 0.00000000 },
+  { 0xC23Fu, 0.00000000 },
+  { 0xC240u, 0.00000000 },
+  { 0xC241u, 0.00000000 },
+  { 0xC242u, 0.00000000 },
+  { 0xC243u, 0.00000000 },
+  { 0xC244u, 0.00000000 },
+  { 0xC245u, 0.00000000 },
+  { 0xC246u, 0.00000000 },
+  { 0xC247u, 0.00000000 },
+  { 0xC248u, 0.00000000 },
+  { 0xC249u, 0.00000000 },
+  { 0xC24Au, 0.00000000 },
+  { 0xC24Bu, 0.00000000 },
+  { 0xC24Cu, 0.00000000 },
+  { 0xC24Du, 0.00000000 },
+  { 0xC24Eu, 0.00000000 },
+  { 0xC24Fu, 0.00000000 },
+  { 0xC250u, 0.00000000 },
+  { 0xC251u, 0.00000000 },
+  { 0xC252u, 0.00000000 },
+  { 0xC253u, 0.00000000 },
+  { 0xC254u, 0.00000000 },
+  { 0xC255u, 0.00000000 },
+  { 0xC256u, 0.00000000 },
+  { 0xC257u, 0.00000000 },
+  { 0xC258u, 0.00000000 },
+  { 0xC259u, 0.00000000 },
+  { 0xC25Au, 0.00000000 },
+  { 0xC25Bu, 0.00000000 },
+  { 0xC25Cu, 0.00000000 },
+  { 0xC25Du, 0.00000000 },
+  { 0xC25Eu, 0.00000000 },
+  { 0xC25Fu, 0.00000000 },
+  { 0xC260u, 0.00000000 },
+  { 0xC261u, 0.00000000 },
+  { 0xC262u, 0.00000000 },
+  { 0xC263u, 0.00000000 },
+  { 0xC264u, 0.00000000 },
+  { 0xC265u, 0.00000000 },
+  { 0xC266u, 0.00000000 },
+  { 0xC267u, 0.00000000 },
+  { 0xC268u, 0.00000000 },
+  { 0xC269u, 0.00000000 },
+  { 0xC26Au, 0.00000000 },
+  { 0xC26Bu, 0.00000000 },
+  { 0xC26Cu, 0.00010000 },
+  { 0xC26Du, 0.00000000 },
+  { 0xC26Eu, 0.00000000 },
+  { 0xC26Fu, 0.00000000 },
+  { 0xC270u, 0.00000000 },
+  { 0xC271u, 0.00000000 },
+  { 0xC272u, 0.00000000 },
+  { 0xC273u, 0.00000000 },
+  { 0xC274u, 0.00000000 },
+  { 0xC275u, 0.00000000 },
+  { 0xC276u, 0.00000000 },
+  { 0xC277u, 0.00000000 },
+  { 0xC278u, 0.00000000 },
+  { 0xC279u, 0.00000000 },
+  { 0xC27Au, 0.00000000 },
+  { 0xC27Bu, 0.00000000 },
+  { 0xC27Cu, 0.00000000 },
+  { 0xC27Du, 0.00010000 },
+  { 0xC27Eu, 0.00000000 },
+  { 0xC27Fu, 0.00000000 },
+  { 0xC280u, 0.00000000 },
+  { 0xC281u, 0.00000000 },
+  { 0xC282u, 0.00000000 },
+  { 0xC283u, 0.00000000 },
+  { 0xC284u, 0.00000000 },
+  { 0xC285u, 0.00000000 },
+  { 0xC286u, 0.00000000 },
+  { 0xC287u, 0.00000000 },
+  { 0xC288u, 0.00030000 },
+  { 0xC289u, 0.00000000 },
+  { 0xC28Au, 0.00000000 },
+  { 0xC28Bu, 0.00000000 },
+  { 0xC28Cu, 0.00000000 },
+  { 0xC28Du, 0.00000000 },
+  { 0xC28Eu, 0.00000000 },
+  { 0xC28Fu, 0.00000000 },
+  { 0xC290u, 0.00000000 },
+  { 0xC291u, 0.00000000 },
+  { 0xC292u, 0.00000000 },
+  { 0xC293u, 0.00000000 },
+  { 0xC294u, 0.00000000 },
+  { 0xC295u, 0.00000000 },
+  { 0xC296u, 0.00000000 },
+  { 0xC297u, 0.00000000 },
+  { 0xC298u, 0.00000000 },
+  { 0xC299u, 0.00000000 },
+  { 0xC29Au, 0.00000000 },
+  { 0xC29Bu, 0.00000000 },
+  { 0xC29Cu, 0.00000000 },
+  { 0xC29Du, 0.00000000 },
+  { 0xC29Eu, 0.00000000 },
+  { 0xC29Fu, 0.00000000 },
+  { 0xC2A0u, 0.00000000 },
+  { 0xC2A1u, 0.00000000 },
+  { 0xC2A2u, 0.00000000 },
+  { 0xC2A3u, 0.00000000 },
+  { 0xC2A4u, 0.00820000 },
+  { 0xC2A5u, 0.00000000 },
+  { 0xC2A6u, 0.00000000 },
+  { 0xC2A7u, 0.00000000 },
+  { 0xC2A8u, 0.00020000 },
+  { 0xC2A9u, 0.00000000 },
+  { 0xC2AAu, 0.00000000 },
+  { 0xC2ABu, 0.00000000 },
+  { 0xC2ACu, 0.00030000 },
+  { 0xC2ADu, 0.00000000 },
+  { 0xC2AEu, 0.00000000 },
+  { 0xC2AFu, 0.00000000 },
+  { 0xC2B0u, 0.00000000 },
+  { 0xC2B1u, 0.00000000 },
+  { 0xC2B2u, 0.00000000 },
+  { 0xC2B3u, 0.00000000 },
+  { 0xC2B4u, 0.00000000 },
+  { 0xC2B5u, 0.00030000 },
+  { 0xC2B6u, 0.00000000 },
+  { 0xC2B7u, 0.00010000 },
+  { 0xC2B8u, 0.00000000 },
+  { 0xC2B9u, 0.00130000 },
+  { 0xC2BAu, 0.00000000 },
+  { 0xC2BBu, 0.00000000 },
+  { 0xC2BCu, 0.00000000 },
+  { 0xC2BDu, 0.00000000 },
+  { 0xC2BEu, 0.00000000 },
+  { 0xC2BFu, 0.00000000 },
+  { 0xC2C0u, 0.00000000 },
+  { 0xC2C1u, 0.00000000 },
+  { 0xC2C2u, 0.00000000 },
+  { 0xC2C3u, 0.00000000 },
+  { 0xC2C4u, 0.00000000 },
+  { 0xC2C5u, 0.00000000 },
+  { 0xC2C6u, 0.00000000 },
+  { 0xC2C7u, 0.00000000 },
+  { 0xC2C8u, 0.00000000 },
+  { 0xC2C9u, 0.00000000 },
+  { 0xC2CAu, 0.00000000 },
+  { 0xC2CBu, 0.00000000 },
+  { 0xC2CCu, 0.00000000 },
+  { 0xC2CDu, 0.00000000 },
+  { 0xC2CEu, 0.00000000 },
+  { 0xC2CFu, 0.00000000 },
+  { 0xC2D0u, 0.00000000 },
+  { 0xC2D1u, 0.00000000 },
+  { 0xC2D2u, 0.00000000 },
+  { 0xC2D3u, 0.00000000 },
+  { 0xC2D4u, 0.00000000 },
+  { 0xC2D5u, 0.00000000 },
+  { 0xC2D6u, 0.00000000 },
+  { 0xC2D7u, 0.00000000 },
+  { 0xC2D8u, 0.00000000 },
+  { 0xC2D9u, 0.00000000 },
+  { 0xC2DAu, 0.00000000 },
+  { 0xC2DBu, 0.00000000 },
+  { 0xC2DCu, 0.00950000 },
+  { 0xC2DDu, 0.00170000 },
+  { 0xC2DEu, 0.00000000 },
+  { 0xC2DFu, 0.00000000 },
+  { 0xC2E0u, 0.00310000 },
+  { 0xC2E1u, 0.00000000 },
+  { 0xC2E2u, 0.00000000 },
+  { 0xC2E3u, 0.00000000 },
+  { 0xC2E4u, 0.00160000 },
+  { 0xC2E5u, 0.00000000 },
+  { 0xC2E6u, 0.00000000 },
+  { 0xC2E7u, 0.00000000 },
+  { 0xC2E8u, 0.00000000 },
+  { 0xC2E9u, 0.00000000 },
+  { 0xC2EAu, 0.00000000 },
+  { 0xC2EBu, 0.00000000 },
+  { 0xC2ECu, 0.00100000 },
+  { 0xC2EDu, 0.00020000 },
+  { 0xC2EEu, 0.00000000 },
+  { 0xC2EFu, 0.00000000 },
+  { 0xC2F0u, 0.00000000 },
+  { 0xC2F1u, 0.00020000 },
+  { 0xC2F2u, 0.00000000 },
+  { 0xC2F3u, 0.00000000 },
+  { 0xC2F4u, 0.00000000 },
+  { 0xC2F5u, 0.00000000 },
+  { 0xC2F6u, 0.00000000 },
+  { 0xC2F7u, 0.00000000 },
+  { 0xC2F8u, 0.00020000 },
+  { 0xC2F9u, 0.00000000 },
+  { 0xC2FAu, 0.00000000 },
+  { 0xC2FBu, 0.00000000 },
+  { 0xC2FCu, 0.00000000 },
+  { 0xC2FDu, 0.00000000 },
+  { 0xC2FEu, 0.00000000 },
+  { 0xC2FFu, 0.00000000 },
+  { 0xC300u, 0.00000000 },
+  { 0xC301u, 0.00000000 },
+  { 0xC302u, 0.00000000 },
+  { 0xC303u, 0.00000000 },
+  { 0xC304u, 0.00000000 },
+  { 0xC305u, 0.00000000 },
+  { 0xC306u, 0.00000000 },
+  { 0xC307u, 0.00000000 },
+  { 0xC308u, 0.00000000 },
+  { 0xC309u, 0.00000000 },
+  { 0xC30Au, 0.00000000 },
+  { 0xC30Bu, 0.00000000 },
+  { 0xC30Cu, 0.00000000 },
+  { 0xC30Du, 0.00010000 },
+  { 0xC30Eu, 0.00000000 },
+  { 0xC30Fu, 0.00000000 },
+  { 0xC310u, 0.00000000 },
+  { 0xC311u, 0.00000000 },
+  { 0xC312u, 0.00000000 },
+  { 0xC313u, 0.00000000 },
+  { 0xC314u, 0.00000000 },
+  { 0xC315u, 0.00000000 },
+  { 0xC316u, 0.00000000 },
+  { 0xC317u, 0.00000000 },
+  { 0xC318u, 0.00000000 },
+  { 0xC319u, 0.00000000 },
+  { 0xC31Au, 0.00000000 },
+  { 0xC31Bu, 0.00000000 },
+  { 0xC31Cu, 0.00000000 },
+  { 0xC31Du, 0.00000000 },
+  { 0xC31Eu, 0.00000000 },
+  { 0xC31Fu, 0.00000000 },
+  { 0xC320u, 0.00000000 },
+  { 0xC321u, 0.00000000 },
+  { 0xC322u, 0.00000000 },
+  { 0xC323u, 0.00000000 },
+  { 0xC324u, 0.00000000 },
+  { 0xC325u, 0.00000000 },
+  { 0xC326u, 0.00000000 },
+  { 0xC327u, 0.00000000 },
+  { 0xC328u, 0.00000000 },
+  { 0xC329u, 0.00000000 },
+  { 0xC32Au, 0.00000000 },
+  { 0xC32Bu, 0.00000000 },
+  { 0xC32Cu, 0.00000000 },
+  { 0xC32Du, 0.00000000 },
+  { 0xC32Eu, 0.00000000 },
+  { 0xC32Fu, 0.00000000 },
+  { 0xC330u, 0.00000000 },
+  { 0xC331u, 0.00000000 },
+  { 0xC332u, 0.00000000 },
+  { 0xC333u, 0.00000000 },
+  { 0xC334u, 0.00000000 },
+  { 0xC335u, 0.00000000 },
+  { 0xC336u, 0.00000000 },
+  { 0xC337u, 0.00000000 },
+  { 0xC338u, 0.00000000 },
+  { 0xC339u, 0.00000000 },
+  { 0xC33Au, 0.00000000 },
+  { 0xC33Bu, 0.00000000 },
+  { 0xC33Cu, 0.00000000 },
+  { 0xC33Du, 0.00000000 },
+  { 0xC33Eu, 0.00000000 },
+  { 0xC33Fu, 0.00000000 },
+  { 0xC340u, 0.00000000 },
+  { 0xC341u, 0.00000000 },
+  { 0xC342u, 0.00000000 },
+  { 0xC343u, 0.00000000 },
+  { 0xC344u, 0.00000000 },
+  { 0xC345u, 0.00000000 },
+  { 0xC346u, 0.00000000 },
+  { 0xC347u, 0.00000000 },
+  { 0xC348u, 0.00000000 },
+  { 0xC349u, 0.00000000 },
+  { 0xC34Au, 0.00000000 },
+  { 0xC34Bu, 0.00000000 },
+  { 0xC34Cu, 0.00000000 },
+  { 0xC34Du, 0.00000000 },
+  { 0xC34Eu, 0.00000000 },
+  { 0xC34Fu, 0.00000000 },
+  { 0xC350u, 0.00000000 },
+  { 0xC351u, 0.00000000 },
+  { 0xC352u, 0.00000000 },
+  { 0xC353u, 0.00000000 },
+  { 0xC354u, 0.00000000 },
+  { 0xC355u, 0.00000000 },
+  { 0xC356u, 0.00000000 },
+  { 0xC357u, 0.00000000 },
+  { 0xC358u, 0.00000000 },
+  { 0xC359u, 0.00000000 },
+  { 0xC35Au, 0.00000000 },
+  { 0xC35Bu, 0.00000000 },
+  { 0xC35Cu, 0.00000000 },
+  { 0xC35Du, 0.00000000 },
+  { 0xC35Eu, 0.00000000 },
+  { 0xC35Fu, 0.00000000 },
+  { 0xC360u, 0.00000000 },
+  { 0xC361u, 0.00000000 },
+  { 0xC362u, 0.00000000 },
+  { 0xC363u, 0.00000000 },
+  { 0xC364u, 0.00000000 },
+  { 0xC365u, 0.00000000 },
+  { 0xC366u, 0.00000000 },
+  { 0xC367u, 0.00000000 },
+  { 0xC368u, 0.00030000 },
+  { 0xC369u, 0.00000000 },
+  { 0xC36Au, 0.00000000 },
+  { 0xC36Bu, 0.00000000 },
+  { 0xC36Cu, 0.00000000 },
+  { 0xC36Du, 0.00000000 },
+  { 0xC36Eu, 0.00000000 },
+  { 0xC36Fu, 0.00000000 },
+  { 0xC370u, 0.00000000 },
+  { 0xC371u, 0.00000000 },
+  { 0xC372u, 0.00000000 },
+  { 0xC373u, 0.00000000 },
+  { 0xC374u, 0.00000000 },
+  { 0xC375u, 0.00000000 },
+  { 0xC376u, 0.00000000 },
+  { 0xC377u, 0.00000000 },
+  { 0xC378u, 0.00000000 },
+  { 0xC379u, 0.00000000 },
+  { 0xC37Au, 0.00000000 },
+  { 0xC37Bu, 0.00000000 },
+  { 0xC37Cu, 0.00010000 },
+  { 0xC37Du, 0.00000000 },
+  { 0xC37Eu, 0.00000000 },
+  { 0xC37Fu, 0.00000000 },
+  { 0xC380u, 0.00000000 },
+  { 0xC381u, 0.00000000 },
+  { 0xC382u, 0.00000000 },
+  { 0xC383u, 0.00000000 },
+  { 0xC384u, 0.00000000 },
+  { 0xC385u, 0.00000000 },
+  { 0xC386u, 0.00000000 },
+  { 0xC387u, 0.00000000 },
+  { 0xC388u, 0.00000000 },
+  { 0xC389u, 0.00000000 },
+  { 0xC38Au, 0.00000000 },
+  { 0xC38Bu, 0.00000000 },
+  { 0xC38Cu, 0.00000000 },
+  { 0xC38Du, 0.00000000 },
+  { 0xC38Eu, 0.00000000 },
+  { 0xC38Fu, 0.00000000 },
+  { 0xC390u, 0.00000000 },
+  { 0xC391u, 0.00000000 },
+  { 0xC392u, 0.00000000 },
+  { 0xC393u, 0.00000000 },
+  { 0xC394u, 0.00000000 },
+  { 0xC395u, 0.00000000 },
+  { 0xC396u, 0.00000000 },
+  { 0xC397u, 0.00000000 },
+  { 0xC398u, 0.00000000 },
+  { 0xC399u, 0.00000000 },
+  { 0xC39Au, 0.00000000 },
+  { 0xC39Bu, 0.00000000 },
+  { 0xC39Cu, 0.00000000 },
+  { 0xC39Du, 0.00000000 },
+  { 0xC39Eu, 0.00000000 },
+  { 0xC39Fu, 0.00000000 },
+  { 0xC3A0u, 0.00000000 },
+  { 0xC3A1u, 0.00000000 },
+  { 0xC3A2u, 0.00000000 },
+  { 0xC3A3u, 0.00000000 },
+  { 0xC3A4u, 0.00000000 },
+  { 0xC3A5u, 0.00000000 },
+  { 0xC3A6u, 0.00000000 },
+  { 0xC3A7u, 0.00000000 },
+  { 0xC3A8u, 0.00000000 },
+  { 0xC3A9u, 0.00000000 },
+  { 0xC3AAu, 0.00000000 },
+  { 0xC3ABu, 0.00000000 },
+  { 0xC3ACu, 0.00000000 },
+  { 0xC3ADu, 0.00000000 },
+  { 0xC3AEu, 0.00000000 },
+  { 0xC3AFu, 0.00000000 },
+  { 0xC3B0u, 0.00000000 },
+  { 0xC3B1u, 0.00000000 },
+  { 0xC3B2u, 0.00000000 },
+  { 0xC3B3u, 0.00000000 },
+  { 0xC3B4u, 0.00000000 },
+  { 0xC3B5u, 0.00000000 },
+  { 0xC3B6u, 0.00000000 },
+  { 0xC3B7u, 0.00000000 },
+  { 0xC3B8u, 0.00000000 },
+  { 0xC3B9u, 0.00000000 },
+  { 0xC3BAu, 0.00000000 },
+  { 0xC3BBu, 0.00000000 },
+  { 0xC3BCu, 0.00000000 },
+  { 0xC3BDu, 0.00000000 },
+  { 0xC3BEu, 0.00000000 },
+  { 0xC3BFu, 0.00000000 },
+  { 0xC3C0u, 0.00000000 },
+  { 0xC3C1u, 0.00000000 },
+  { 0xC3C2u, 0.00000000 },
+  { 0xC3C3u, 0.00000000 },
+  { 0xC3C4u, 0.00000000 },
+  { 0xC3C5u, 0.00000000 },
+  { 0xC3C6u, 0.00000000 },
+  { 0xC3C7u, 0.00000000 },
+  { 0xC3C8u, 0.00000000 },
+  { 0xC3C9u, 0.00000000 },
+  { 0xC3CAu, 0.00000000 },
+  { 0xC3CBu, 0.00000000 },
+  { 0xC3CCu, 0.00000000 },
+  { 0xC3CDu, 0.00000000 },
+  { 0xC3CEu, 0.00000000 },
+  { 0xC3CFu, 0.00000000 },
+  { 0xC3D0u, 0.00000000 },
+  { 0xC3D1u, 0.00000000 },
+  { 0xC3D2u, 0.00000000 },
+  { 0xC3D3u, 0.00000000 },
+  { 0xC3D4u, 0.00000000 },
+  { 0xC3D5u, 0.00000000 },
+  { 0xC3D6u, 0.00000000 },
+  { 0xC3D7u, 0.00000000 },
+  { 0xC3D8u, 0.00000000 },
+  { 0xC3D9u, 0.00000000 },
+  { 0xC3DAu, 0.00000000 },
+  { 0xC3DBu, 0.00000000 },
+  { 0xC3DCu, 0.00000000 },
+  { 0xC3DDu, 0.00000000 },
+  { 0xC3DEu, 0.00000000 },
+  { 0xC3DFu, 0.00000000 },
+  { 0xC3E0u, 0.00000000 },
+  { 0xC3E1u, 0.00000000 },
+  { 0xC3E2u, 0.00000000 },
+  { 0xC3E3u, 0.00000000 },
+  { 0xC3E4u, 0.00000000 },
+  { 0xC3E5u, 0.00000000 },
+  { 0xC3E6u, 0.00000000 },
+  { 0xC3E7u, 0.00000000 },
+  { 0xC3E8u, 0.00000000 },
+  { 0xC3E9u, 0.00000000 },
+  { 0xC3EAu, 0.00000000 },
+  { 0xC3EBu, 0.00000000 },
+  { 0xC3ECu, 0.00000000 },
+  { 0xC3EDu, 0.00000000 },
+  { 0xC3EEu, 0.00000000 },
+  { 0xC3EFu, 0.00000000 },
+  { 0xC3F0u, 0.00000000 },
+  { 0xC3F1u, 0.00000000 },
+  { 0xC3F2u, 0.00000000 },
+  { 0xC3F3u, 0.00000000 },
+  { 0xC3F4u, 0.00000000 },
+  { 0xC3F5u, 0.00000000 },
+  { 0xC3F6u, 0.00000000 },
+  { 0xC3F7u, 0.00000000 },
+  { 0xC3F8u, 0.00000000 },
+  { 0xC3F9u, 0.00000000 },
+  { 0xC3FAu, 0.00000000 },
+  { 0xC3FBu, 0.00000000 },
+  { 0xC3FCu, 0.00000000 },
+  { 0xC3FDu, 0.00000000 },
+  { 0xC3FEu, 0.00000000 },
+  { 0xC3FFu, 0.00000000 },
+  { 0xC400u, 0.00000000 },
+  { 0xC401u, 0.00000000 },
+  { 0xC402u, 0.00000000 },
+  { 0xC403u, 0.00000000 },
+  { 0xC404u, 0.00000000 },
+  { 0xC405u, 0.00000000 },
+  { 0xC406u, 0.00000000 },
+  { 0xC407u, 0.00000000 },
+  { 0xC408u, 0.00000000 },
+  { 0xC409u, 0.00000000 },
+  { 0xC40Au, 0.00000000 },
+  { 0xC40Bu, 0.00000000 },
+  { 0xC40Cu, 0.00000000 },
+  { 0xC40Du, 0.00000000 },
+  { 0xC40Eu, 0.00000000 },
+  { 0xC40Fu, 0.00000000 },
+  { 0xC410u, 0.00000000 },
+  { 0xC411u, 0.00000000 },
+  { 0xC412u, 0.00000000 },
+  { 0xC413u, 0.00000000 },
+  { 0xC414u, 0.00000000 },
+  { 0xC415u, 0.00000000 },
+  { 0xC416u, 0.00000000 },
+  { 0xC417u, 0.00000000 },
+  { 0xC418u, 0.00000000 },
+  { 0xC419u, 0.00000000 },
+  { 0xC41Au, 0.00000000 },
+  { 0xC41Bu, 0.00000000 },
+  { 0xC41Cu, 0.00000000 },
+  { 0xC41Du, 0.00000000 },
+  { 0xC41Eu, 0.00000000 },
+  { 0xC41Fu, 0.00000000 },
+  { 0xC420u, 0.00000000 },
+  { 0xC421u, 0.00000000 },
+  { 0xC422u, 0.00000000 },
+  { 0xC423u, 0.00000000 },
+  { 0xC424u, 0.00000000 },
+  { 0xC425u, 0.00000000 },
+  { 0xC426u, 0.00000000 },
+  { 0xC427u, 0.00000000 },
+  { 0xC428u, 0.00000000 },
+  { 0xC429u, 0.00000000 },
+  { 0xC42Au, 0.00000000 },
+  { 0xC42Bu, 0.00000000 },
+  { 0xC42Cu, 0.00000000 },
+  { 0xC42Du, 0.00000000 },
+  { 0xC42Eu, 0.00000000 },
+  { 0xC42Fu, 0.00000000 },
+  { 0xC430u, 0.00000000 },
+  { 0xC431u, 0.00000000 },
+  { 0xC432u, 0.00000000 },
+  { 0xC433u, 0.00000000 },
+  { 0xC434u, 0.00000000 },
+  { 0xC435u, 0.00000000 },
+  { 0xC436u, 0.00000000 },
+  { 0xC437u, 0.00000000 },
+  { 0xC438u, 0.00000000 },
+  { 0xC439u, 0.00000000 },
+  { 0xC43Au, 0.00000000 },
+  { 0xC43Bu, 0.00000000 },
+  { 0xC43Cu, 0.00000000 },
+  { 0xC43Du, 0.00000000 },
+  { 0xC43Eu, 0.00000000 },
+  { 0xC43Fu, 0.00000000 },
+  { 0xC440u, 0.00000000 },
+  { 0xC441u, 0.00000000 },
+  { 0xC442u, 0.00000000 },
+  { 0xC443u, 0.00000000 },
+  { 0xC444u, 0.00000000 },
+  { 0xC445u, 0.00000000 },
+  { 0xC446u, 0.00000000 },
+  { 0xC447u, 0.00000000 },
+  { 0xC448u, 0.00000000 },
+  { 0xC449u, 0.00000000 },
+  { 0xC44Au, 0.00000000 },
+  { 0xC44Bu, 0.00000000 },
+  { 0xC44Cu, 0.00000000 },
+  { 0xC44Du, 0.00000000 },
+  { 0xC44Eu, 0.00000000 },
+  { 0xC44Fu, 0.00000000 },
+  { 0xC450u, 0.00000000 },
+  { 0xC451u, 0.00000000 },
+  { 0xC452u, 0.00000000 },
+  { 0xC453u, 0.00000000 },
+  { 0xC454u, 0.00000000 },
+  { 0xC455u, 0.00000000 },
+  { 0xC456u, 0.00000000 },
+  { 0xC457u, 0.00000000 },
+  { 0xC458u, 0.00000000 },
+  { 0xC459u, 0.00000000 },
+  { 0xC45Au, 0.00000000 },
+  { 0xC45Bu, 0.00000000 },
+  { 0xC45Cu, 0.00000000 },
+  { 0xC45Du, 0.00000000 },
+  { 0xC45Eu, 0.00000000 },
+  { 0xC45Fu, 0.00000000 },
+  { 0xC460u, 0.00000000 },
+  { 0xC461u, 0.00000000 },
+  { 0xC462u, 0.00000000 },
+  { 0xC463u, 0.00000000 },
+  { 0xC464u, 0.00000000 },
+  { 0xC465u, 0.00000000 },
+  { 0xC466u, 0.00000000 },
+  { 0xC467u, 0.00000000 },
+  { 0xC468u, 0.00000000 },
+  { 0xC469u, 0.00000000 },
+  { 0xC46Au, 0.00000000 },
+  { 0xC46Bu, 0.00000000 },
+  { 0xC46Cu, 0.00000000 },
+  { 0xC46Du, 0.00000000 },
+  { 0xC46Eu, 0.00000000 },
+  { 0xC46Fu, 0.00000000 },
+  { 0xC470u, 0.00000000 },
+  { 0xC471u, 0.00000000 },
+  { 0xC472u, 0.00000000 },
+  { 0xC473u, 0.00000000 },
+  { 0xC474u, 0.00000000 },
+  { 0xC475u, 0.00000000 },
+  { 0xC476u, 0.00000000 },
+  { 0xC477u, 0.00000000 },
+  { 0xC478u, 0.00000000 },
+  { 0xC479u, 0.00000000 },
+  { 0xC47Au, 0.00000000 },
+  { 0xC47Bu, 0.00000000 },
+  { 0xC47Cu, 0.00000000 },
+  { 0xC47Du, 0.00000000 },
+  { 0xC47Eu, 0.00000000 },
+  { 0xC47Fu, 0.00000000 },
+  { 0xC480u, 0.00000000 },
+  { 0xC481u, 0.00000000 },
+  { 0xC482u, 0.00000000 },
+  { 0xC483u, 0.00000000 },
+  { 0xC484u, 0.00000000 },
+  { 0xC485u, 0.00000000 },
+  { 0xC486u, 0.00000000 },
+  { 0xC487u, 0.00000000 },
+  { 0xC488u, 0.00000000 },
+  { 0xC489u, 0.00000000 },
+  { 0xC48Au, 0.00000000 },
+  { 0xC48Bu, 0.00000000 },
+  { 0xC48Cu, 0.00000000 },
+  { 0xC48Du, 0.00000000 },
+  { 0xC48Eu, 0.00000000 },
+  { 0xC48Fu, 0.00000000 },
+  { 0xC490u, 0.00000000 },
+  { 0xC491u, 0.00000000 },
+  { 0xC492u, 0.00000000 },
+  { 0xC493u, 0.00000000 },
+  { 0xC494u, 0.00000000 },
+  { 0xC495u, 0.00000000 },
+  { 0xC496u, 0.00000000 },
+  { 0xC497u, 0.00000000 },
+  { 0xC498u, 0.00000000 },
+  { 0xC499u, 0.00000000 },
+  { 0xC49Au, 0.00000000 },
+  { 0xC49Bu, 0.00000000 },
+  { 0xC49Cu, 0.00000000 },
+  { 0xC49Du, 0.00000000 },
+  { 0xC49Eu, 0.00000000 },
+  { 0xC49Fu, 0.00000000 },
+  { 0xC4A0u, 0.00000000 },
+  { 0xC4A1u, 0.00000000 },
+  { 0xC4A2u, 0.00000000 },
+  { 0xC4A3u, 0.00000000 },
+  { 0xC4A4u, 0.00000000 },
+  { 0xC4A5u, 0.00000000 },
+  { 0xC4A6u, 0.00000000 },
+  { 0xC4A7u, 0.00000000 },
+  { 0xC4A8u, 0.00000000 },
+  { 0xC4A9u, 0.00000000 },
+  { 0xC4AAu, 0.00000000 },
+  { 0xC4ABu, 0.00000000 },
+  { 0xC4ACu, 0.00000000 },
+  { 0xC4ADu, 0.00000000 },
+  { 0xC4AEu, 0.00000000 },
+  { 0xC4AFu, 0.00000000 },
+  { 0xC4B0u, 0.00000000 },
+  { 0xC4B1u, 0.00000000 },
+  { 0xC4B2u, 0.00000000 },
+  { 0xC4B3u, 0.00000000 },
+  { 0xC4B4u, 0.00000000 },
+  { 0xC4B5u, 0.00000000 },
+  { 0xC4B6u, 0.00000000 },
+  { 0xC4B7u, 0.00000000 },
+  { 0xC4B8u, 0.00000000 },
+  { 0xC4B9u, 0.00000000 },
+  { 0xC4BAu, 0.00000000 },
+  { 0xC4BBu, 0.00000000 },
+  { 0xC4BCu, 0.00000000 },
+  { 0xC4BDu, 0.00000000 },
+  { 0xC4BEu, 0.00000000 },
+  { 0xC4BFu, 0.00000000 },
+  { 0xC4C0u, 0.00000000 },
+  { 0xC4C1u, 0.00000000 },
+  { 0xC4C2u, 0.00000000 },
+  { 0xC4C3u, 0.00000000 },
+  { 0xC4C4u, 0.00000000 },
+  { 0xC4C5u, 0.00000000 },
+  { 0xC4C6u, 0.00000000 },
+  { 0xC4C7u, 0.00000000 },
+  { 0xC4C8u, 0.00000000 },
+  { 0xC4C9u, 0.00000000 },
+  { 0xC4CAu, 0.00000000 },
+  { 0xC4CBu, 0.00000000 },
+  { 0xC4CCu, 0.00000000 },
+  { 0xC4CDu, 0.00000000 },
+  { 0xC4CEu, 0.00000000 },
+  { 0xC4CFu, 0.00000000 },
+  { 0xC4D0u, 0.00000000 },
+  { 0xC4D1u, 0.00000000 },
+  { 0xC4D2u, 0.00000000 },
+  { 0xC4D3u, 0.00000000 },
+  { 0xC4D4u, 0.00000000 },
+  { 0xC4D5u, 0.00000000 },
+  { 0xC4D6u, 0.00000000 },
+  { 0xC4D7u, 0.00000000 },
+  { 0xC4D8u, 0.00000000 },
+  { 0xC4D9u, 0.00000000 },
+  { 0xC4DAu, 0.00000000 },
+  { 0xC4DBu, 0.00000000 },
+  { 0xC4DCu, 0.00000000 },
+  { 0xC4DDu, 0.00000000 },
+  { 0xC4DEu, 0.00000000 },
+  { 0xC4DFu, 0.00000000 },
+  { 0xC4E0u, 0.00000000 },
+  { 0xC4E1u, 0.00000000 },
+  { 0xC4E2u, 0.00000000 },
+  { 0xC4E3u, 0.00000000 },
+  { 0xC4E4u, 0.00000000 },
+  { 0xC4E5u, 0.00000000 },
+  { 0xC4E6u, 0.00000000 },
+  { 0xC4E7u, 0.00000000 },
+  { 0xC4E8u, 0.00000000 },
+  { 0xC4E9u, 0.00000000 },
+  { 0xC4EAu, 0.00000000 },
+  { 0xC4EBu, 0.00000000 },
+  { 0xC4ECu, 0.00000000 },
+  { 0xC4EDu, 0.00000000 },
+  { 0xC4EEu, 0.00000000 },
+  { 0xC4EFu, 0.00000000 },
+  { 0xC4F0u, 0.00060000 },
+  { 0xC4F1u, 0.00000000 },
+  { 0xC4F2u, 0.00000000 },
+  { 0xC4F3u, 0.00000000 },
+  { 0xC4F4u, 0.00010000 },
+  { 0xC4F5u, 0.00000000 },
+  { 0xC4F6u, 0.00000000 },
+  { 0xC4F7u, 0.00000000 },
+  { 0xC4F8u, 0.00000000 },
+  { 0xC4F9u, 0.00000000 },
+  { 0xC4FAu, 0.00000000 },
+  { 0xC4FBu, 0.00000000 },
+  { 0xC4FCu, 0.00000000 },
+  { 0xC4FDu, 0.00000000 },
+  { 0xC4FEu, 0.00000000 },
+  { 0xC4FFu, 0.00000000 },
+  { 0xC500u, 0.00000000 },
+  { 0xC501u, 0.00000000 },
+  { 0xC502u, 0.00000000 },
+  { 0xC503u, 0.00000000 },
+  { 0xC504u, 0.00000000 },
+  { 0xC505u, 0.00000000 },
+  { 0xC506u, 0.00000000 },
+  { 0xC507u, 0.00000000 },
+  { 0xC508u, 0.00000000 },
+  { 0xC509u, 0.00000000 },
+  { 0xC50Au, 0.00000000 },
+  { 0xC50Bu, 0.00000000 },
+  { 0xC50Cu, 0.00000000 },
+  { 0xC50Du, 0.00000000 },
+  { 0xC50Eu, 0.00000000 },
+  { 0xC50Fu, 0.00000000 },
+  { 0xC510u, 0.00000000 },
+  { 0xC511u, 0.00000000 },
+  { 0xC512u, 0.00000000 },
+  { 0xC513u, 0.00000000 },
+  { 0xC514u, 0.00000000 },
+  { 0xC515u, 0.00000000 },
+  { 0xC516u, 0.00000000 },
+  { 0xC517u, 0.00000000 },
+  { 0xC518u, 0.00000000 },
+  { 0xC519u, 0.00000000 },
+  { 0xC51Au, 0.00000000 },
+  { 0xC51Bu, 0.00000000 },
+  { 0xC51Cu, 0.00000000 },
+  { 0xC51Du, 0.00000000 },
+  { 0xC51Eu, 0.00000000 },
+  { 0xC51Fu, 0.00000000 },
+  { 0xC520u, 0.00000000 },
+  { 0xC521u, 0.00000000 },
+  { 0xC522u, 0.00000000 },
+  { 0xC523u, 0.00000000 },
+  { 0xC524u, 0.00000000 },
+  { 0xC525u, 0.00000000 },
+  { 0xC526u, 0.00000000 },
+  { 0xC527u, 0.00000000 },
+  { 0xC528u, 0.00030000 },
+  { 0xC529u, 0.00010000 },
+  { 0xC52Au, 0.00000000 },
+  { 0xC52Bu, 0.00000000 },
+  { 0xC52Cu, 0.00000000 },
+  { 0xC52Du, 0.00000000 },
+  { 0xC52Eu, 0.00000000 },
+  { 0xC52Fu, 0.00000000 },
+  { 0xC530u, 0.00000000 },
+  { 0xC531u, 0.00000000 },
+  { 0xC532u, 0.00000000 },
+  { 0xC533u, 0.00000000 },
+  { 0xC534u, 0.00000000 },
+  { 0xC535u, 0.00000000 },
+  { 0xC536u, 0.00000000 },
+  { 0xC537u, 0.00000000 },
+  { 0xC538u, 0.00000000 },
+  { 0xC539u, 0.00000000 },
+  { 0xC53Au, 0.00000000 },
+  { 0xC53Bu, 0.00000000 },
+  { 0xC53Cu, 0.00000000 },
+  { 0xC53Du, 0.00000000 },
+  { 0xC53Eu, 0.00000000 },
+  { 0xC53Fu, 0.00000000 },
+  { 0xC540u, 0.00000000 },
+  { 0xC541u, 0.00000000 },
+  { 0xC542u, 0.00000000 },
+  { 0xC543u, 0.00000000 },
+  { 0xC544u, 0.00690000 },
+  { 0xC545u, 0.00070000 },
+  { 0xC546u, 0.00000000 },
+  { 0xC547u, 0.00000000 },
+  { 0xC548u, 0.00180000 },
+  { 0xC549u, 0.00000000 },
+  { 0xC54Au, 0.00110000 },
+  { 0xC54Bu, 0.00000000 },
+  { 0xC54Cu, 0.00090000 },
+  { 0xC54Du, 0.00000000 },
+  { 0xC54Eu, 0.00000000 },
+  { 0xC54Fu, 0.00000000 },
+  { 0xC550u, 0.00000000 },
+  { 0xC551u, 0.00000000 },
+  { 0xC552u, 0.00000000 },
+  { 0xC553u, 0.00000000 },
+  { 0xC554u, 0.00030000 },
+  { 0xC555u, 0.00030000 },
+  { 0xC556u, 0.00000000 },
+  { 0xC557u, 0.00000000 },
+  { 0xC558u, 0.00110000 },
+  { 0xC559u, 0.00030000 },
+  { 0xC55Au, 0.00000000 },
+  { 0xC55Bu, 0.00000000 },
+  { 0xC55Cu, 0.00000000 },
+  { 0xC55Du, 0.00000000 },
+  { 0xC55Eu, 0.00020000 },
+  { 0xC55Fu, 0.00000000 },
+  { 0xC560u, 0.00050000 },
+  { 0xC561u, 0.00020000 },
+  { 0xC562u, 0.00000000 },
+  { 0xC563u, 0.00000000 },
+  { 0xC564u, 0.00010000 },
+  { 0xC565u, 0.00000000 },
+  { 0xC566u, 0.00000000 },
+  { 0xC567u, 0.00000000 },
+  { 0xC568u, 0.00020000 },
+  { 0xC569u, 0.00000000 },
+  { 0xC56Au, 0.00000000 },
+  { 0xC56Bu, 0.00000000 },
+  { 0xC56Cu, 0.00000000 },
+  { 0xC56Du, 0.00000000 },
+  { 0xC56Eu, 0.00000000 },
+  { 0xC56Fu, 0.00000000 },
+  { 0xC570u, 0.00000000 },
+  { 0xC571u, 0.00000000 },
+  { 0xC572u, 0.00000000 },
+  { 0xC573u, 0.00000000 },
+  { 0xC574u, 0.00000000 },
+  { 0xC575u, 0.00000000 },
+  { 0xC576u, 0.00000000 },
+  { 0xC577u, 0.00000000 },
+  { 0xC578u, 0.00000000 },
+  { 0xC579u, 0.00000000 },
+  { 0xC57Au, 0.00000000 },
+  { 0xC57Bu, 0.00000000 },
+  { 0xC57Cu, 0.00150000 },
+  { 0xC57Du, 0.00110000 },
+  { 0xC57Eu, 0.00000000 },
+  { 0xC57Fu, 0.00000000 },
+  { 0xC580u, 0.00000000 },
+  { 0xC581u, 0.00000000 },
+  { 0xC582u, 0.00000000 },
+  { 0xC583u, 0.00000000 },
+  { 0xC584u, 0.00000000 },
+  { 0xC585u, 0.00000000 },
+  { 0xC586u, 0.00000000 },
+  { 0xC587u, 0.00000000 },
+  { 0xC588u, 0.00000000 },
+  { 0xC589u, 0.00000000 },
+  { 0xC58Au, 0.00000000 },
+  { 0xC58Bu, 0.00000000 },
+  { 0xC58Cu, 0.00000000 },
+  { 0xC58Du, 0.00000000 },
+  { 0xC58Eu, 0.00000000 },
+  { 0xC58Fu, 0.00000000 },
+  { 0xC590u, 0.00000000 },
+  { 0xC591u, 0.00150000 },
+  { 0xC592u, 0.00000000 },
+  { 0xC593u, 0.00000000 },
+  { 0xC594u, 0.00000000 },
+  { 0xC595u, 0.00000000 },
+  { 0xC596u, 0.00000000 },
+  { 0xC597u, 0.00000000 },
+  { 0xC598u, 0.00000000 },
+  { 0xC599u, 0.00000000 },
+  { 0xC59Au, 0.00000000 },
+  { 0xC59Bu, 0.00000000 },
+  { 0xC59Cu, 0.00000000 },
+  { 0xC59Du, 0.00000000 },
+  { 0xC59Eu, 0.00000000 },
+  { 0xC59Fu, 0.00000000 },
+  { 0xC5A0u, 0.00000000 },
+  { 0xC5A1u, 0.00000000 },
+  { 0xC5A2u, 0.00000000 },
+  { 0xC5A3u, 0.00000000 },
+  { 0xC5A4u, 0.00000000 },
+  { 0xC5A5u, 0.00000000 },
+  { 0xC5A6u, 0.00000000 },
+  { 0xC5A7u, 0.00000000 },
+  { 0xC5A8u, 0.00000000 },
+  { 0xC5A9u, 0.00000000 },
+  { 0xC5AAu, 0.00000000 },
+  { 0xC5ABu, 0.00000000 },
+  { 0xC5ACu, 0.00000000 },
+  { 0xC5ADu, 0.00000000 },
+  { 0xC5AEu, 0.00000000 },
+  { 0xC5AFu, 0.00000000 },
+  { 0xC5B0u, 0.00000000 },
+  { 0xC5B1u, 0.00000000 },
+  { 0xC5B2u, 0.00000000 },
+  { 0xC5B3u, 0.00000000 },
+  { 0xC5B4u, 0.00730000 },
+  { 0xC5B5u, 0.00020000 },
+  { 0xC5B6u, 0.00000000 },
+  { 0xC5B7u, 0.00000000 },
+  { 0xC5B8u, 0.00080000 },
+  { 0xC5B9u, 0.00000000 },
+  { 0xC5BAu, 0.00000000 },
+  { 0xC5BBu, 0.00020000 },
+  { 0xC5BCu, 0.00020000 },
+  { 0xC5BDu, 0.00000000 },
+  { 0xC5BEu, 0.00000000 },
+  { 0xC5BFu, 0.00000000 },
+  { 0xC5C0u, 0.00000000 },
+  { 0xC5C1u, 0.00000000 },
+  { 0xC5C2u, 0.00000000 },
+  { 0xC5C3u, 0.00000000 },
+  { 0xC5C4u, 0.00020000 },
+  { 0xC5C5u, 0.00140000 },
+  { 0xC5C6u, 0.00090000 },
+  { 0xC5C7u, 0.00000000 },
+  { 0xC5C8u, 0.00580000 },
+  { 0xC5C9u, 0.00000000 },
+  { 0xC5CAu, 0.00000000 },
+  { 0xC5CBu, 0.00000000 },
+  { 0xC5CCu, 0.00000000 },
+  { 0xC5CDu, 0.00000000 },
+  { 0xC5CEu, 0.00000000 },
+  { 0xC5CFu, 0.00000000 },
+  { 0xC5D0u, 0.02520000 },
+  { 0xC5D1u, 0.00000000 },
+  { 0xC5D2u, 0.00000000 },
+  { 0xC5D3u, 0.00000000 },
+  { 0xC5D4u, 0.00030000 },
+  { 0xC5D5u, 0.00000000 },
+  { 0xC5D6u, 0.00000000 },
+  { 0xC5D7u, 0.00000000 },
+  { 0xC5D8u, 0.00020000 },
+  { 0xC5D9u, 0.00000000 },
+  { 0xC5DAu, 0.00000000 },
+  { 0xC5DBu, 0.00000000 },
+  { 0xC5DCu, 0.00000000 },
+  { 0xC5DDu, 0.00000000 },
+  { 0xC5DEu, 0.00000000 },
+  { 0xC5DFu, 0.00000000 },
+  { 0xC5E0u, 0.00000000 },
+  { 0xC5E1u, 0.00000000 },
+  { 0xC5E2u, 0.00000000 },
+  { 0xC5E3u, 0.00000000 },
+  { 0xC5E4u, 0.00000000 },
+  { 0xC5E5u, 0.00000000 },
+  { 0xC5E6u, 0.00000000 },
+  { 0xC5E7u, 0.00000000 },
+  { 0xC5E8u, 0.00000000 },
+  { 0xC5E9u, 0.00000000 },
+  { 0xC5EAu, 0.00000000 },
+  { 0xC5EBu, 0.00000000 },
+  { 0xC5ECu, 0.00460000 },
+  { 0xC5EDu, 0.00260000 },
+  { 0xC5EEu, 0.00000000 },
+  { 0xC5EFu, 0.00000000 },
+  { 0xC5F0u, 0.00280000 },
+  { 0xC5F1u, 0.00000000 },
+  { 0xC5F2u, 0.00000000 },
+  { 0xC5F3u, 0.00000000 },
+  { 0xC5F4u, 0.00090000 },
+  { 0xC5F5u, 0.00000000 },
+  { 0xC5F6u, 0.00000000 },
+  { 0xC5F7u, 0.00000000 },
+  { 0xC5F8u, 0.00000000 },
+  { 0xC5F9u, 0.00000000 },
+  { 0xC5FAu, 0.00000000 },
+  { 0xC5FBu, 0.00000000 },
+  { 0xC5FCu, 0.00020000 },
+  { 0xC5FDu, 0.00010000 },
+  { 0xC5FEu, 0.00000000 },
+  { 0xC5FFu, 0.00000000 },
+  { 0xC600u, 0.00410000 },
+  { 0xC601u, 0.00250000 },
+  { 0xC602u, 0.00000000 },
+  { 0xC603u, 0.00000000 },
+  { 0xC604u, 0.00000000 },
+  { 0xC605u, 0.00000000 },
+  { 0xC606u, 0.00000000 },
+  { 0xC607u, 0.00000000 },
+  { 0xC608u, 0.00110000 },
+  { 0xC609u, 0.00000000 },
+  { 0xC60Au, 0.00000000 },
+  { 0xC60Bu, 0.00000000 },
+  { 0xC60Cu, 0.00000000 },
+  { 0xC60Du, 0.00000000 },
+  { 0xC60Eu, 0.00000000 },
+  { 0xC60Fu, 0.00000000 },
+  { 0xC610u, 0.00000000 },
+  { 0xC611u, 0.00000000 },
+  { 0xC612u, 0.00000000 },
+  { 0xC613u, 0.00000000 },
+  { 0xC614u, 0.00000000 },
+  { 0xC615u, 0.00000000 },
+  { 0xC616u, 0.00000000 },
+  { 0xC617u, 0.00000000 },
+  { 0xC618u, 0.00000000 },
+  { 0xC619u, 0.00000000 },
+  { 0xC61Au, 0.00000000 },
+  { 0xC61Bu, 0.00010000 },
+  { 0xC61Cu, 0.00000000 },
+  { 0xC61Du, 0.00000000 },
+  { 0xC61Eu, 0.00000000 },
+  { 0xC61Fu, 0.00000000 },
+  { 0xC620u, 0.00000000 },
+  { 0xC621u, 0.00000000 },
+  { 0xC622u, 0.00000000 },
+  { 0xC623u, 0.00000000 },
+  { 0xC624u, 0.00300000 },
+  { 0xC625u, 0.00020000 },
+  { 0xC626u, 0.00000000 },
+  { 0xC627u, 0.00000000 },
+  { 0xC628u, 0.00060000 },
+  { 0xC629u, 0.00000000 },
+  { 0xC62Au, 0.00000000 },
+  { 0xC62Bu, 0.00000000 },
+  { 0xC62Cu, 0.00070000 },
+  { 0xC62Du, 0.00000000 },
+  { 0xC62Eu, 0.00010000 },
+  { 0xC62Fu, 0.00000000 },
+  { 0xC630u, 0.00000000 },
+  { 0xC631u, 0.00000000 },
+  { 0xC632u, 0.00000000 },
+  { 0xC633u, 0.00000000 },
+  { 0xC634u, 0.00000000 },
+  { 0xC635u, 0.00000000 },
+  { 0xC636u, 0.00000000 },
+  { 0xC637u, 0.00000000 },
+  { 0xC638u, 0.00000000 },
+  { 0xC639u, 0.00010000 },
+  { 0xC63Au, 0.00000000 },
+  { 0xC63Bu, 0.00000000 },
+  { 0xC63Cu, 0.00000000 },
+  { 0xC63Du, 0.00000000 },
+  { 0xC63Eu, 0.00000000 },
+  { 0xC63Fu, 0.00000000 },
+  { 0xC640u, 0.00400000 },
+  { 0xC641u, 0.00000000 },
+  { 0xC642u, 0.00000000 },
+  { 0xC643u, 0.00000000 },
+  { 0xC644u, 0.00040000 },
+  { 0xC645u, 0.00000000 },
+  { 0xC646u, 0.00000000 },
+  { 0xC647u, 0.00000000 },
+  { 0xC648u, 0.00000000 },
+  { 0xC649u, 0.00000000 },
+  { 0xC64Au, 0.00000000 },
+  { 0xC64Bu, 0.00000000 },
+  { 0xC64Cu, 0.00000000 },
+  { 0xC64Du, 0.00000000 },
+  { 0xC64Eu, 0.00000000 },
+  { 0xC64Fu, 0.00000000 },
+  { 0xC650u, 0.00000000 },
+  { 0xC651u, 0.00000000 },
+  { 0xC652u, 0.00000000 },
+  { 0xC653u, 0.00000000 },
+  { 0xC654u, 0.00030000 },
+  { 0xC655u, 0.00110000 },
+  { 0xC656u, 0.00000000 },
+  { 0xC657u, 0.00000000 },
+  { 0xC658u, 0.00000000 },
+  { 0xC659u, 0.00000000 },
+  { 0xC65Au, 0.00000000 },
+  { 0xC65Bu, 0.00000000 },
+  { 0xC65Cu, 0.00010000 },
+  { 0xC65Du, 0.00000000 },
+  { 0xC65Eu, 0.00000000 },
+  { 0xC65Fu, 0.00000000 },
+  { 0xC660u, 0.00000000 },
+  { 0xC661u, 0.00000000 },
+  { 0xC662u, 0.00000000 },
+  { 0xC663u, 0.00000000 },
+  { 0xC664u, 0.00000000 },
+  { 0xC665u, 0.00000000 },
+  { 0xC666u, 0.00000000 },
+  { 0xC667u, 0.00000000 },
+  { 0xC668u, 0.00000000 },
+  { 0xC669u, 0.00000000 },
+  { 0xC66Au, 0.00000000 },
+  { 0xC66Bu, 0.00000000 },
+  { 0xC66Cu, 0.00000000 },
+  { 0xC66Du, 0.00000000 },
+  { 0xC66Eu, 0.00000000 },
+  { 0xC66Fu, 0.00000000 },
+  { 0xC670u, 0.00000000 },
+  { 0xC671u, 0.00000000 },
+  { 0xC672u, 0.00000000 },
+  { 0xC673u, 0.00000000 },
+  { 0xC674u, 0.00000000 },
+  { 0xC675u, 0.00000000 },
+  { 0xC676u, 0.00000000 },
+  { 0xC677u, 0.00000000 },
+  { 0xC678u, 0.00090000 },
+  { 0xC679u, 0.00000000 },
+  { 0xC67Au, 0.00000000 },
+  { 0xC67Bu, 0.00000000 },
+  { 0xC67Cu, 0.00000000 },
+  { 0xC67Du, 0.00000000 },
+  { 0xC67Eu, 0.00000000 },
+  { 0xC67Fu, 0.00000000 },
+  { 0xC680u, 0.00000000 },
+  { 0xC681u, 0.00000000 },
+  { 0xC682u, 0.00000000 },
+  { 0xC683u, 0.00000000 },
+  { 0xC684u, 0.00000000 },
+  { 0xC685u, 0.00000000 },
+  { 0xC686u, 0.00000000 },
+  { 0xC687u, 0.00000000 },
+  { 0xC688u, 0.00000000 },
+  { 0xC689u, 0.00000000 },
+  { 0xC68Au, 0.00000000 },
+  { 0xC68Bu, 0.00000000 },
+  { 0xC68Cu, 0.00000000 },
+  { 0xC68Du, 0.00000000 },
+  { 0xC68Eu, 0.00000000 },
+  { 0xC68Fu, 0.00000000 },
+  { 0xC690u, 0.00000000 },
+  { 0xC691u, 0.00000000 },
+  { 0xC692u, 0.00000000 },
+  { 0xC693u, 0.00000000 },
+  { 0xC694u, 0.00160000 },
+  { 0xC695u, 0.00010000 },
+  { 0xC696u, 0.00000000 },
+  { 0xC697u, 0.00000000 },
+  { 0xC698u, 0.00000000 },
+  { 0xC699u, 0.00000000 },
+  { 0xC69Au, 0.00000000 },
+  { 0xC69Bu, 0.00000000 },
+  { 0xC69Cu, 0.00000000 },
+  { 0xC69Du, 0.00000000 },
+  { 0xC69Eu, 0.00000000 },
+  { 0xC69Fu, 0.00000000 },
+  { 0xC6A0u, 0.00000000 },
+  { 0xC6A1u, 0.00000000 },
+  { 0xC6A2u, 0.00000000 },
+  { 0xC6A3u, 0.00000000 },
+  { 0xC6A4u, 0.00000000 },
+  { 0xC6A5u, 0.00000000 },
+  { 0xC6A6u, 0.00000000 },
+  { 0xC6A7u, 0.00000000 },
+  { 0xC6A8u, 0.00000000 },
+  { 0xC6A9u, 0.00260000 },
+  { 0xC6AAu, 0.00000000 },
+  { 0xC6ABu, 0.00000000 },
+  { 0xC6ACu, 0.00000000 },
+  { 0xC6ADu, 0.00000000 },
+  { 0xC6AEu, 0.00000000 },
+  { 0xC6AFu, 0.00000000 },
+  { 0xC6B0u, 0.00310000 },
+  { 0xC6B1u, 0.00010000 },
+  { 0xC6B2u, 0.00000000 },
+  { 0xC6B3u, 0.00000000 },
+  { 0xC6B4u, 0.00180000 },
+  { 0xC6B5u, 0.00000000 },
+  { 0xC6B6u, 0.00000000 },
+  { 0xC6B7u, 0.00000000 },
+  { 0xC6B8u, 0.00070000 },
+  { 0xC6B9u, 0.00000000 },
+  { 0xC6BAu, 0.00000000 },
+  { 0xC6BBu, 0.00000000 },
+  { 0xC6BCu, 0.00000000 },
+  { 0xC6BDu, 0.00000000 },
+  { 0xC6BEu, 0.00000000 },
+  { 0xC6BFu, 0.00000000 },
+  { 0xC6C0u, 0.00030000 },
+  { 0xC6C1u, 0.00000000 },
+  { 0xC6C2u, 0.00000000 },
+  { 0xC6C3u, 0.00010000 },
+  { 0xC6C4u, 0.00000000 },
+  { 0xC6C5u, 0.00010000 },
+  { 0xC6C6u, 0.00000000 },
+  { 0xC6C7u, 0.00000000 },
+  { 0xC6C8u, 0.00000000 },
+  { 0xC6C9u, 0.00000000 },
+  { 0xC6CAu, 0.00000000 },
+  { 0xC6CBu, 0.00000000 },
+  { 0xC6CCu, 0.00050000 },
+  { 0xC6CDu, 0.00000000 },
+  { 0xC6CEu, 0.00000000 },
+  { 0xC6CFu, 0.00000000 },
+  { 0xC6D0u, 0.00390000 },
+  { 0xC6D1u, 0.00000000 },
+  { 0xC6D2u, 0.00000000 },
+  { 0xC6D3u, 0.00000000 },
+  { 0xC6D4u, 0.00410000 },
+  { 0xC6D5u, 0.00000000 },
+  { 0xC6D6u, 0.00000000 },
+  { 0xC6D7u, 0.00000000 },
+  { 0xC6D8u, 0.00000000 },
+  { 0xC6D9u, 0.00000000 },
+  { 0xC6DAu, 0.00000000 },
+  { 0xC6DBu, 0.00000000 },
+  { 0xC6DCu, 0.00000000 },
+  { 0xC6DDu, 0.00000000 },
+  { 0xC6DEu, 0.00000000 },
+  { 0xC6DFu, 0.00000000 },
+  { 0xC6E0u, 0.00010000 },
+  { 0xC6E1u, 0.00000000 },
+  { 0xC6E2u, 0.00000000 },
+  { 0xC6E3u, 0.00000000 },
+  { 0xC6E4u, 0.00000000 },
+  { 0xC6E5u, 0.00000000 },
+  { 0xC6E6u, 0.00000000 },
+  { 0xC6E7u, 0.00000000 },
+  { 0xC6E8u, 0.00030000 },
+  { 0xC6E9u, 0.00000000 },
+  { 0xC6EAu, 0.00000000 },
+  { 0xC6EBu, 0.00000000 },
+  { 0xC6ECu, 0.00000000 },
+  { 0xC6EDu, 0.00000000 },
+  { 0xC6EEu, 0.00000000 },
+  { 0xC6EFu, 0.00000000 },
+  { 0xC6F0u, 0.00000000 },
+  { 0xC6F1u, 0.00000000 },
+  { 0xC6F2u, 0.00000000 },
+  { 0xC6F3u, 0.00000000 },
+  { 0xC6F4u, 0.00000000 },
+  { 0xC6F5u, 0.00000000 },
+  { 0xC6F6u, 0.00000000 },
+  { 0xC6F7u, 0.00000000 },
+  { 0xC6F8u, 0.00000000 },
+  { 0xC6F9u, 0.00010000 },
+  { 0xC6FAu, 0.00000000 },
+  { 0xC6FBu, 0.00000000 },
+  { 0xC6FCu, 0.00000000 },
+  { 0xC6FDu, 0.00000000 },
+  { 0xC6FEu, 0.00000000 },
+  { 0xC6FFu, 0.00000000 },
+  { 0xC700u, 0.00000000 },
+  { 0xC701u, 0.00000000 },
+  { 0xC702u, 0.00000000 },
+  { 0xC703u, 0.00000000 },
+  { 0xC704u, 0.00400000 },
+  { 0xC705u, 0.00000000 },
+  { 0xC706u, 0.00000000 },
+  { 0xC707u, 0.00000000 },
+  { 0xC708u, 0.00010000 },
+  { 0xC709u, 0.00000000 },
+  { 0xC70Au, 0.00000000 },
+  { 0xC70Bu, 0.00000000 },
+  { 0xC70Cu, 0.00010000 },
+  { 0xC70Du, 0.00000000 },
+  { 0xC70Eu, 0.00000000 },
+  { 0xC70Fu, 0.00000000 },
+  { 0xC710u, 0.00000000 },
+  { 0xC711u, 0.00000000 },
+  { 0xC712u, 0.00000000 },
+  { 0xC713u, 0.00000000 },
+  { 0xC714u, 0.00000000 },
+  { 0xC715u, 0.00000000 },
+  { 0xC716u, 0.00000000 },
+  { 0xC717u, 0.00000000 },
+  { 0xC718u, 0.00000000 },
+  { 0xC719u, 0.00000000 },
+  { 0xC71Au, 0.00000000 },
+  { 0xC71Bu, 0.00000000 },
+  { 0xC71Cu, 0.00000000 },
+  { 0xC71Du, 0.00000000 },
+  { 0xC71Eu, 0.00000000 },
+  { 0xC71Fu, 0.00000000 },
+  { 0xC720u, 0.00310000 },
+  { 0xC721u, 0.00060000 },
+  { 0xC722u, 0.00000000 },
+  { 0xC723u, 0.00000000 },
+  { 0xC724u, 0.00020000 },
+  { 0xC725u, 0.00000000 },
+  { 0xC726u, 0.00000000 },
+  { 0xC727u, 0.00000000 },
+  { 0xC728u, 0.00020000 },
+  { 0xC729u, 0.00000000 },
+  { 0xC72Au, 0.00000000 },
+  { 0xC72Bu, 0.00000000 },
+  { 0xC72Cu, 0.00000000 },
+  { 0xC72Du, 0.00000000 },
+  { 0xC72Eu, 0.00000000 },
+  { 0xC72Fu, 0.00000000 },
+  { 0xC730u, 0.00000000 },
+  { 0xC731u, 0.00000000 },
+  { 0xC732u, 0.00000000 },
+  { 0xC733u, 0.00000000 },
+  { 0xC734u, 0.00000000 },
+  { 0xC735u, 0.00010000 },
+  { 0xC736u, 0.00000000 },
+  { 0xC737u, 0.00000000 },
+  { 0xC738u, 0.00000000 },
+  { 0xC739u, 0.00000000 },
+  { 0xC73Au, 0.00000000 },
+  { 0xC73Bu, 0.00000000 },
+  { 0xC73Cu, 0.01030000 },
+  { 0xC73Du, 0.00000000 },
+  { 0xC73Eu, 0.00000000 },
+  { 0xC73Fu, 0.00000000 },
+  { 0xC740u, 0.01150000 },
+  { 0xC741u, 0.00000000 },
+  { 0xC742u, 0.00000000 },
+  { 0xC743u, 0.00000000 },
+  { 0xC744u, 0.01510000 },
+  { 0xC745u, 0.00000000 },
+  { 0xC746u, 0.00000000 },
+  { 0xC747u, 0.00000000 },
+  { 0xC748u, 0.00000000 },
+  { 0xC749u, 0.00000000 },
+  { 0xC74Au, 0.00000000 },
+  { 0xC74Bu, 0.00000000 },
+  { 0xC74Cu, 0.00190000 },
+  { 0xC74Du, 0.00010000 },
+  { 0xC74Eu, 0.00000000 },
+  { 0xC74Fu, 0.00000000 },
+  { 0xC750u, 0.00000000 },
+  { 0xC751u, 0.00030000 },
+  { 0xC752u, 0.00000000 },
+  { 0xC753u, 0.00000000 },
+  { 0xC754u, 0.00000000 },
+  { 0xC755u, 0.00000000 },
+  { 0xC756u, 0.00000000 },
+  { 0xC757u, 0.00000000 },
+  { 0xC758u, 0.02470000 },
+  { 0xC759u, 0.00000000 },
+  { 0xC75Au, 0.00000000 },
+  { 0xC75Bu, 0.00000000 },
+  { 0xC75Cu, 0.00000000 },
+  { 0xC75Du, 0.00000000 },
+  { 0xC75Eu, 0.00000000 },
+  { 0xC75Fu, 0.00000000 },
+  { 0xC760u, 0.00000000 },
+  { 0xC761u, 0.00000000 },
+  { 0xC762u, 0.00000000 },
+  { 0xC763u, 0.00000000 },
+  { 0xC764u, 0.00000000 },
+  { 0xC765u, 0.00000000 },
+  { 0xC766u, 0.00000000 },
+  { 0xC767u, 0.00000000 },
+  { 0xC768u, 0.00000000 },
+  { 0xC769u, 0.00000000 },
+  { 0xC76Au, 0.00000000 },
+  { 0xC76Bu, 0.00000000 },
+  { 0xC76Cu, 0.00000000 },
+  { 0xC76Du, 0.00000000 },
+  { 0xC76Eu, 0.00000000 },
+  { 0xC76Fu, 0.00000000 },
+  { 0xC770u, 0.00000000 },
+  { 0xC771u, 0.00000000 },
+  { 0xC772u, 0.00000000 },
+  { 0xC773u, 0.00000000 },
+  { 0xC774u, 0.03350000 },
+  { 0xC775u, 0.00020000 },
+  { 0xC776u, 0.00000000 },
+  { 0xC777u, 0.00000000 },
+  { 0xC778u, 0.00860000 },
+  { 0xC779u, 0.00000000 },
+  { 0xC77Au, 0.00000000 },
+  { 0xC77Bu, 0.00000000 },
+  { 0xC77Cu, 0.00750000 },
+  { 0xC77Du, 0.00000000 },
+  { 0xC77Eu, 0.00000000 },
+  { 0xC77Fu, 0.00000000 },
+  { 0xC780u, 0.00000000 },
+  { 0xC781u, 0.00000000 },
+  { 0xC782u, 0.00000000 },
+  { 0xC783u, 0.00010000 },
+  { 0xC784u, 0.00160000 },
+  { 0xC785u, 0.00130000 },
+  { 0xC786u, 0.00000000 },
+  { 0xC787u, 0.00010000 },
+  { 0xC788u, 0.00700000 },
+  { 0xC789u, 0.00010000 },
+  { 0xC78Au, 0.00000000 },
+  { 0xC78Bu, 0.00000000 },
+  { 0xC78Cu, 0.00000000 },
+  { 0xC78Du, 0.00000000 },
+  { 0xC78Eu, 0.00010000 },
+  { 0xC78Fu, 0.00000000 },
+  { 0xC790u, 0.00700000 },
+  { 0xC791u, 0.00230000 },
+  { 0xC792u, 0.00000000 },
+  { 0xC793u, 0.00000000 },
+  { 0xC794u, 0.00010000 },
+  { 0xC795u, 0.00000000 },
+  { 0xC796u, 0.00000000 },
+  { 0xC797u, 0.00000000 },
+  { 0xC798u, 0.00020000 },
+  { 0xC799u, 0.00000000 },
+  { 0xC79Au, 0.00000000 },
+  { 0xC79Bu, 0.00000000 },
+  { 0xC79Cu, 0.00000000 },
+  { 0xC79Du, 0.00000000 },
+  { 0xC79Eu, 0.00000000 },
+  { 0xC79Fu, 0.00000000 },
+  { 0xC7A0u, 0.00010000 },
+  { 0xC7A1u, 0.00030000 },
+  { 0xC7A2u, 0.00000000 },
+  { 0xC7A3u, 0.00000000 },
+  { 0xC7A4u, 0.00000000 },
+  { 0xC7A5u, 0.00460000 },
+  { 0xC7A6u, 0.00000000 },
+  { 0xC7A7u, 0.00000000 },
+  { 0xC7A8u, 0.00000000 },
+  { 0xC7A9u, 0.00000000 },
+  { 0xC7AAu, 0.00000000 },
+  { 0xC7ABu, 0.00000000 },
+  { 0xC7ACu, 0.00230000 },
+  { 0xC7ADu, 0.00000000 },
+  { 0xC7AEu, 0.00000000 },
+  { 0xC7AFu, 0.00000000 },
+  { 0xC7B0u, 0.00000000 },
+  { 0xC7B1u, 0.00000000 },
+  { 0xC7B2u, 0.00000000 },
+  { 0xC7B3u, 0.00000000 },
+  { 0xC7B4u, 0.00000000 },
+  { 0xC7B5u, 0.00000000 },
+  { 0xC7B6u, 0.00000000 },
+  { 0xC7B7u, 0.00000000 },
+  { 0xC7B8u, 0.00000000 },
+  { 0xC7B9u, 0.00000000 },
+  { 0xC7BAu, 0.00000000 },
+  { 0xC7BBu, 0.00000000 },
+  { 0xC7BCu, 0.00000000 },
+  { 0xC7BDu, 0.00000000 },
+  { 0xC7BEu, 0.00000000 },
+  { 0xC7BFu, 0.00000000 },
+  { 0xC7C0u, 0.00000000 },
+  { 0xC7C1u, 0.00050000 },
+  { 0xC7C2u, 0.00000000 },
+  { 0xC7C3u, 0.00000000 },
+  { 0xC7C4u, 0.00000000 },
+  { 0xC7C5u, 0.00000000 },
+  { 0xC7C6u, 0.00000000 },
+  { 0xC7C7u, 0.00000000 },
+  { 0xC7C8u, 0.00000000 },
+  { 0xC7C9u, 0.00000000 },
+  { 0xC7CAu, 0.00000000 },
+  { 0xC7CBu, 0.00000000 },
+  { 0xC7CCu, 0.00000000 },
+  { 0xC7CDu, 0.00000000 },
+  { 0xC7CEu, 0.00000000 },
+  { 0xC7CFu, 0.00000000 },
+  { 0xC7D0u, 0.00000000 },
+  { 0xC7D1u, 0.00000000 },
+  { 0xC7D2u, 0.00000000 },
+  { 0xC7D3u, 0.00000000 },
+  { 0xC7D4u, 0.00000000 },
+  { 0xC7D5u, 0.00000000 },
+  { 0xC7D6u, 0.00000000 },
+  { 0xC7D7u, 0.00000000 },
+  { 0xC7D8u, 0.00000000 },
+  { 0xC7D9u, 0.00000000 },
+  { 0xC7DAu, 0.00000000 },
+  { 0xC7DBu, 0.00000000 },
+  { 0xC7DCu, 0.00000000 },
+  { 0xC7DDu, 0.00000000 },
+  { 0xC7DEu, 0.00000000 },
+  { 0xC7DFu, 0.00000000 },
+  { 0xC7E0u, 0.00000000 },
+  { 0xC7E1u, 0.00000000 },
+  { 0xC7E2u, 0.00000000 },
+  { 0xC7E3u, 0.00000000 },
+  { 0xC7E4u, 0.00000000 },
+  { 0xC7E5u, 0.00000000 },
+  { 0xC7E6u, 0.00000000 },
+  { 0xC7E7u, 0.00000000 },
+  { 0xC7E8u, 0.00000000 },
+  { 0xC7E9u, 0.00000000 },
+  { 0xC7EAu, 0.00000000 },
+  { 0xC7EBu, 0.00000000 },
+  { 0xC7ECu, 0.00000000 },
+  { 0xC7EDu, 0.00000000 },
+  { 0xC7EEu, 0.00000000 },
+  { 0xC7EFu, 0.00000000 },
+  { 0xC7F0u, 0.00000000 },
+  { 0xC7F1u, 0.00000000 },
+  { 0xC7F2u, 0.00000000 },
+  { 0xC7F3u, 0.00000000 },
+  { 0xC7F4u, 0.00000000 },
+  { 0xC7F5u, 0.00000000 },
+  { 0xC7F6u, 0.00000000 },
+  { 0xC7F7u, 0.00000000 },
+  { 0xC7F8u, 0.00000000 },
+  { 0xC7F9u, 0.00000000 },
+  { 0xC7FAu, 0.00000000 },
+  { 0xC7FBu, 0.00000000 },
+  { 0xC7FCu, 0.00000000 },
+  { 0xC7FDu, 0.00000000 },
+  { 0xC7FEu, 0.00000000 },
+  { 0xC7FFu, 0.00000000 },
+  { 0xC800u, 0.00090000 },
+  { 0xC801u, 0.00420000 },
+  { 0xC802u, 0.00000000 },
+  { 0xC803u, 0.00000000 },
+  { 0xC804u, 0.00640000 },
+  { 0xC805u, 0.00000000 },
+  { 0xC806u, 0.00000000 },
+  { 0xC807u, 0.00000000 },
+  { 0xC808u, 0.00060000 },
+  { 0xC809u, 0.00000000 },
+  { 0xC80Au, 0.00000000 },
+  { 0xC80Bu, 0.00000000 },
+  { 0xC80Cu, 0.00000000 },
+  { 0xC80Du, 0.00000000 },
+  { 0xC80Eu, 0.00000000 },
+  { 0xC80Fu, 0.00000000 },
+  { 0xC810u, 0.00110000 },
+  { 0xC811u, 0.00050000 },
+  { 0xC812u, 0.00000000 },
+  { 0xC813u, 0.00000000 },
+  { 0xC814u, 0.00000000 },
+  { 0xC815u, 0.00610000 },
+  { 0xC816u, 0.00000000 },
+  { 0xC817u, 0.00000000 },
+  { 0xC818u, 0.00000000 },
+  { 0xC819u, 0.00000000 },
+  { 0xC81Au, 0.00000000 },
+  { 0xC81Bu, 0.00000000 },
+  { 0xC81Cu, 0.00540000 },
+  { 0xC81Du, 0.00010000 },
+  { 0xC81Eu, 0.00000000 },
+  { 0xC81Fu, 0.00000000 },
+  { 0xC820u, 0.00010000 },
+  { 0xC821u, 0.00000000 },
+  { 0xC822u, 0.00000000 },
+  { 0xC823u, 0.00000000 },
+  { 0xC824u, 0.00010000 },
+  { 0xC825u, 0.00000000 },
+  { 0xC826u, 0.00000000 },
+  { 0xC827u, 0.00000000 },
+  { 0xC828u, 0.00000000 },
+  { 0xC829u, 0.00000000 },
+  { 0xC82Au, 0.00000000 },
+  { 0xC82Bu, 0.00000000 },
+  { 0xC82Cu, 0.00000000 },
+  { 0xC82Du, 0.00000000 },
+  { 0xC82Eu, 0.00000000 },
+  { 0xC82Fu, 0.00000000 },
+  { 0xC830u, 0.00000000 },
+  { 0xC831u, 0.00000000 },
+  { 0xC832u, 0.00000000 },
+  { 0xC833u, 0.00000000 },
+  { 0xC834u, 0.00000000 },
+  { 0xC835u, 0.00000000 },
+  { 0xC836u, 0.00000000 },
+  { 0xC837u, 0.00000000 },
+  { 0xC838u, 0.00060000 },
+  { 0xC839u, 0.00000000 },
+  { 0xC83Au, 0.00000000 },
+  { 0xC83Bu, 0.00000000 },
+  { 0xC83Cu, 0.00000000 },
+  { 0xC83Du, 0.00000000 },
+  { 0xC83Eu, 0.00000000 },
+  { 0xC83Fu, 0.00000000 },
+  { 0xC840u, 0.00000000 },
+  { 0xC841u, 0.00000000 },
+  { 0xC842u, 0.00000000 },
+  { 0xC843u, 0.00000000 },
+  { 0xC844u, 0.00000000 },
+  { 0xC845u, 0.00000000 },
+  { 0xC846u, 0.00000000 },
+  { 0xC847u, 0.00000000 },
+  { 0xC848u, 0.00000000 },
+  { 0xC849u, 0.00000000 },
+  { 0xC84Au, 0.00000000 },
+  { 0xC84Bu, 0.00000000 },
+  { 0xC84Cu, 0.00050000 },
+  { 0xC84Du, 0.00000000 },
+  { 0xC84Eu, 0.00000000 },
+  { 0xC84Fu, 0.00000000 },
+  { 0xC850u, 0.00000000 },
+  { 0xC851u, 0.00000000 },
+  { 0xC852u, 0.00000000 },
+  { 0xC853u, 0.00000000 },
+  { 0xC854u, 0.00000000 },
+  { 0xC855u, 0.00000000 },
+  { 0xC856u, 0.00000000 },
+  { 0xC857u, 0.00000000 },
+  { 0xC858u, 0.00000000 },
+  { 0xC859u, 0.00000000 },
+  { 0xC85Au, 0.00000000 },
+  { 0xC85Bu, 0.00000000 },
+  { 0xC85Cu, 0.00000000 },
+  { 0xC85Du, 0.00000000 },
+  { 0xC85Eu, 0.00000000 },
+  { 0xC85Fu, 0.00000000 },
+  { 0xC860u, 0.00000000 },
+  { 0xC861u, 0.00000000 },
+  { 0xC862u, 0.00000000 },
+  { 0xC863u, 0.00000000 },
+  { 0xC864u, 0.00000000 },
+  { 0xC865u, 0.00000000 },
+  { 0xC866u, 0.00000000 },
+  { 0xC867u, 0.00000000 },
+  { 0xC868u, 0.00000000 },
+  { 0xC869u, 0.00000000 },
+  { 0xC86Au, 0.00000000 },
+  { 0xC86Bu, 0.00000000 },
+  { 0xC86Cu, 0.00000000 },
+  { 0xC86Du, 0.00000000 },
+  { 0xC86Eu, 0.00000000 },
+  { 0xC86Fu, 0.00000000 },
+  { 0xC870u, 0.00340000 },
+  { 0xC871u, 0.00080000 },
+  { 0xC872u, 0.00000000 },
+  { 0xC873u, 0.00000000 },
+  { 0xC874u, 0.00060000 },
+  { 0xC875u, 0.00000000 },
+  { 0xC876u, 0.00000000 },
+  { 0xC877u, 0.00000000 },
+  { 0xC878u, 0.00020000 },
+  { 0xC879u, 0.00000000 },
+  { 0xC87Au, 0.00000000 },
+  { 0xC87Bu, 0.00000000 },
+  { 0xC87Cu, 0.00000000 },
+  { 0xC87Du, 0.00000000 },
+  { 0xC87Eu, 0.00000000 },
+  { 0xC87Fu, 0.00000000 },
+  { 0xC880u, 0.00000000 },
+  { 0xC881u, 0.00000000 },
+  { 0xC882u, 0.00000000 },
+  { 0xC883u, 0.00000000 },
+  { 0xC884u, 0.00000000 },
+  { 0xC885u, 0.00170000 },
+  { 0xC886u, 0.00000000 },
+  { 0xC887u, 0.00000000 },
+  { 0xC888u, 0.00000000 },
+  { 0xC889u, 0.00000000 },
+  { 0xC88Au, 0.00000000 },
+  { 0xC88Bu, 0.00020000 },
+  { 0xC88Cu, 0.00020000 },
+  { 0xC88Du, 0.00000000 },
+  { 0xC88Eu, 0.00000000 },
+  { 0xC88Fu, 0.00000000 },
+  { 0xC890u, 0.00000000 },
+  { 0xC891u, 0.00000000 },
+  { 0xC892u, 0.00000000 },
+  { 0xC893u, 0.00000000 },
+  { 0xC894u, 0.00000000 },
+  { 0xC895u, 0.00000000 },
+  { 0xC896u, 0.00000000 },
+  { 0xC897u, 0.00000000 },
+  { 0xC898u, 0.00000000 },
+  { 0xC899u, 0.00000000 },
+  { 0xC89Au, 0.00000000 },
+  { 0xC89Bu, 0.00000000 },
+  { 0xC89Cu, 0.00000000 },
+  { 0xC89Du, 0.00000000 },
+  { 0xC89Eu, 0.00000000 },
+  { 0xC89Fu, 0.00000000 },
+  { 0xC8A0u, 0.00000000 },
+  { 0xC8A1u, 0.00000000 },
+  { 0xC8A2u, 0.00000000 },
+  { 0xC8A3u, 0.00000000 },
+  { 0xC8A4u, 0.00000000 },
+  { 0xC8A5u, 0.00000000 },
+  { 0xC8A6u, 0.00000000 },
+  { 0xC8A7u, 0.00000000 },
+  { 0xC8A8u, 0.00000000 },
+  { 0xC8A9u, 0.00000000 },
+  { 0xC8AAu, 0.00000000 },
+  { 0xC8ABu, 0.00000000 },
+  { 0xC8ACu, 0.00000000 },
+  { 0xC8ADu, 0.00000000 },
+  { 0xC8AEu, 0.00000000 },
+  { 0xC8AFu, 0.00000000 },
+  { 0xC8B0u, 0.00000000 },
+  { 0xC8B1u, 0.00000000 },
+  { 0xC8B2u, 0.00000000 },
+  { 0xC8B3u, 0.00000000 },
+  { 0xC8B4u, 0.00000000 },
+  { 0xC8B5u, 0.00000000 },
+  { 0xC8B6u, 0.00000000 },
+  { 0xC8B7u, 0.00000000 },
+  { 0xC8B8u, 0.00000000 },
+  { 0xC8B9u, 0.00000000 },
+  { 0xC8BAu, 0.00000000 },
+  { 0xC8BBu, 0.00000000 },
+  { 0xC8BCu, 0.00000000 },
+  { 0xC8BDu, 0.00000000 },
+  { 0xC8BEu, 0.00000000 },
+  { 0xC8BFu, 0.00000000 },
+  { 0xC8C0u, 0.00000000 },
+  { 0xC8C1u, 0.00000000 },
+  { 0xC8C2u, 0.00000000 },
+  { 0xC8C3u, 0.00000000 },
+  { 0xC8C4u, 0.00010000 },
+  { 0xC8C5u, 0.00000000 },
+  { 0xC8C6u, 0.00000000 },
+  { 0xC8C7u, 0.00000000 },
+  { 0xC8C8u, 0.00000000 },
+  { 0xC8C9u, 0.00000000 },
+  { 0xC8CAu, 0.00000000 },
+  { 0xC8CBu, 0.00000000 },
+  { 0xC8CCu, 0.00000000 },
+  { 0xC8CDu, 0.00000000 },
+  { 0xC8CEu, 0.00000000 },
+  { 0xC8CFu, 0.00000000 },
+  { 0xC8D0u, 0.00000000 },
+  { 0xC8D1u, 0.00000000 },
+  { 0xC8D2u, 0.00000000 },
+  { 0xC8D3u, 0.00000000 },
+  { 0xC8D4u, 0.00000000 },
+  { 0xC8D5u, 0.00000000 },
+  { 0xC8D6u, 0.00000000 },
+  { 0xC8D7u, 0.00000000 },
+  { 0xC8D8u, 0.00000000 },
+  { 0xC8D9u, 0.00000000 },
+  { 0xC8DAu, 0.00000000 },
+  { 0xC8DBu, 0.00000000 },
+  { 0xC8DCu, 0.00000000 },
+  { 0xC8DDu, 0.00000000 },
+  { 0xC8DEu, 0.00000000 },
+  { 0xC8DFu, 0.00000000 },
+  { 0xC8E0u, 0.00000000 },
+  { 0xC8E1u, 0.00000000 },
+  { 0xC8E2u, 0.00000000 },
+  { 0xC8E3u, 0.00000000 },
+  { 0xC8E4u, 0.00000000 },
+  { 0xC8E5u, 0.00000000 },
+  { 0xC8E6u, 0.00000000 },
+  { 0xC8E7u, 0.00000000 },
+  { 0xC8E8u, 0.00000000 },
+  { 0xC8E9u, 0.00000000 },
+  { 0xC8EAu, 0.00000000 },
+  { 0xC8EBu, 0.00000000 },
+  { 0xC8ECu, 0.00000000 },
+  { 0xC8EDu, 0.00000000 },
+  { 0xC8EEu, 0.00000000 },
+  { 0xC8EFu, 0.00000000 },
+  { 0xC8F0u, 0.00000000 },
+  { 0xC8F1u, 0.00000000 },
+  { 0xC8F2u, 0.00000000 },
+  { 0xC8F3u, 0.00000000 },
+  { 0xC8F4u, 0.00000000 },
+  { 0xC8F5u, 0.00000000 },
+  { 0xC8F6u, 0.00000000 },
+  { 0xC8F7u, 0.00000000 },
+  { 0xC8F8u, 0.00000000 },
+  { 0xC8F9u, 0.00000000 },
+  { 0xC8FAu, 0.00000000 },
+  { 0xC8FBu, 0.00000000 },
+  { 0xC8FCu, 0.00540000 },
+  { 0xC8FDu, 0.00030000 },
+  { 0xC8FEu, 0.00000000 },
+  { 0xC8FFu, 0.00000000 },
+  { 0xC900u, 0.00080000 },
+  { 0xC901u, 0.00000000 },
+  { 0xC902u, 0.00000000 },
+  { 0xC903u, 0.00000000 },
+  { 0xC904u, 0.00020000 },
+  { 0xC905u, 0.00000000 },
+  { 0xC906u, 0.00000000 },
+  { 0xC907u, 0.00000000 },
+  { 0xC908u, 0.00000000 },
+  { 0xC909u, 0.00000000 },
+  { 0xC90Au, 0.00000000 },
+  { 0xC90Bu, 0.00000000 },
+  { 0xC90Cu, 0.00000000 },
+  { 0xC90Du, 0.00000000 },
+  { 0xC90Eu, 0.00000000 },
+  { 0xC90Fu, 0.00000000 },
+  { 0xC910u, 0.00000000 },
+  { 0xC911u, 0.00360000 },
+  { 0xC912u, 0.00000000 },
+  { 0xC913u, 0.00000000 },
+  { 0xC914u, 0.00000000 },
+  { 0xC915u, 0.00000000 },
+  { 0xC916u, 0.00000000 },
+  { 0xC917u, 0.00000000 },
+  { 0xC918u, 0.00000000 },
+  { 0xC919u, 0.00000000 },
+  { 0xC91Au, 0.00000000 },
+  { 0xC91Bu, 0.00000000 },
+  { 0xC91Cu, 0.00000000 },
+  { 0xC91Du, 0.00000000 },
+  { 0xC91Eu, 0.00000000 },
+  { 0xC91Fu, 0.00000000 },
+  { 0xC920u, 0.00000000 },
+  { 0xC921u, 0.00000000 },
+  { 0xC922u, 0.00000000 },
+  { 0xC923u, 0.00000000 },
+  { 0xC924u, 0.00000000 },
+  { 0xC925u, 0.00000000 },
+  { 0xC926u, 0.00000000 },
+  { 0xC927u, 0.00000000 },
+  { 0xC928u, 0.00000000 },
+  { 0xC929u, 0.00000000 },
+  { 0xC92Au, 0.00000000 },
+  { 0xC92Bu, 0.00000000 },
+  { 0xC92Cu, 0.00000000 },
+  { 0xC92Du, 0.00000000 },
+  { 0xC92Eu, 0.00000000 },
+  { 0xC92Fu, 0.00000000 },
+  { 0xC930u, 0.00000000 },
+  { 0xC931u, 0.00000000 },
+  { 0xC932u, 0.00000000 },
+  { 0xC933u, 0.00000000 },
+  { 0xC934u, 0.00000000 },
+  { 0xC935u, 0.00000000 },
+  { 0xC936u, 0.00000000 },
+  { 0xC937u, 0.00000000 },
+  { 0xC938u, 0.00000000 },
+  { 0xC939u, 0.00000000 },
+  { 0xC93Au, 0.00000000 },
+  { 0xC93Bu, 0.00000000 },
+  { 0xC93Cu, 0.00000000 },
+  { 0xC93Du, 0.00000000 },
+  { 0xC93Eu, 0.00000000 },
+  { 0xC93Fu, 0.00000000 },
+  { 0xC940u, 0.00000000 },
+  { 0xC941u, 0.00000000 },
+  { 0xC942u, 0.00000000 },
+  { 0xC943u, 0.00000000 },
+  { 0xC944u, 0.00000000 },
+  { 0xC945u, 0.00000000 },
+  { 0xC946u, 0.00000000 },
+  { 0xC947u, 0.00000000 },
+  { 0xC948u, 0.00000000 },
+  { 0xC949u, 0.00000000 },
+  { 0xC94Au, 0.00000000 },
+  { 0xC94Bu, 0.00000000 },
+  { 0xC94Cu, 0.00000000 },
+  { 0xC94Du, 0.00000000 },
+  { 0xC94Eu, 0.00000000 },
+  { 0xC94Fu, 0.00000000 },
+  { 0xC950u, 0.00000000 },
+  { 0xC951u, 0.00000000 },
+  { 0xC952u, 0.00000000 },
+  { 0xC953u, 0.00000000 },
+  { 0xC954u, 0.00000000 },
+  { 0xC955u, 0.00000000 },
+  { 0xC956u, 0.00000000 },
+  { 0xC957u, 0.00000000 },
+  { 0xC958u, 0.00000000 },
+  { 0xC959u, 0.00000000 },
+  { 0xC95Au, 0.00000000 },
+  { 0xC95Bu, 0.00000000 },
+  { 0xC95Cu, 0.00000000 },
+  { 0xC95Du, 0.00000000 },
+  { 0xC95Eu, 0.00000000 },
+  { 0xC95Fu, 0.00000000 },
+  { 0xC960u, 0.00000000 },
+  { 0xC961u, 0.00000000 },
+  { 0xC962u, 0.00000000 },
+  { 0xC963u, 0.00000000 },
+  { 0xC964u, 0.00000000 },
+  { 0xC965u, 0.00000000 },
+  { 0xC966u, 0.00000000 },
+  { 0xC967u, 0.00000000 },
+  { 0xC968u, 0.00000000 },
+  { 0xC969u, 0.00000000 },
+  { 0xC96Au, 0.00000000 },
+  { 0xC96Bu, 0.00000000 },
+  { 0xC96Cu, 0.00000000 },
+  { 0xC96Du, 0.00000000 },
+  { 0xC96Eu, 0.00000000 },
+  { 0xC96Fu, 0.00000000 },
+  { 0xC970u, 0.00000000 },
+  { 0xC971u, 0.00000000 },
+  { 0xC972u, 0.00000000 },
+  { 0xC973u, 0.00000000 },
+  { 0xC974u, 0.00000000 },
+  { 0xC975u, 0.00000000 },
+  { 0xC976u, 0.00000000 },
+  { 0xC977u, 0.00000000 },
+  { 0xC978u, 0.00000000 },
+  { 0xC979u, 0.00000000 },
+  { 0xC97Au, 0.00000000 },
+  { 0xC97Bu, 0.00000000 },
+  { 0xC97Cu, 0.00000000 },
+  { 0xC97Du, 0.00000000 },
+  { 0xC97Eu, 0.00000000 },
+  { 0xC97Fu, 0.00000000 },
+  { 0xC980u, 0.00000000 },
+  { 0xC981u, 0.00000000 },
+  { 0xC982u, 0.00000000 },
+  { 0xC983u, 0.00000000 },
+  { 0xC984u, 0.00000000 },
+  { 0xC985u, 0.00000000 },
+  { 0xC986u, 0.00000000 },
+  { 0xC987u, 0.00000000 },
+  { 0xC988u, 0.00080000 },
+  { 0xC989u, 0.00020000 },
+  { 0xC98Au, 0.00000000 },
+  { 0xC98Bu, 0.00000000 },
+  { 0xC98Cu, 0.00030000 },
+  { 0xC98Du, 0.00000000 },
+  { 0xC98Eu, 0.00000000 },
+  { 0xC98Fu, 0.00000000 },
+  { 0xC990u, 0.00010000 },
+  { 0xC991u, 0.00000000 },
+  { 0xC992u, 0.00000000 },
+  { 0xC993u, 0.00000000 },
+  { 0xC994u, 0.00000000 },
+  { 0xC995u, 0.00000000 },
+  { 0xC996u, 0.00000000 },
+  { 0xC997u, 0.00000000 },
+  { 0xC998u, 0.00010000 },
+  { 0xC999u, 0.00000000 },
+  { 0xC99Au, 0.00000000 },
+  { 0xC99Bu, 0.00000000 },
+  { 0xC99Cu, 0.00000000 },
+  { 0xC99Du, 0.00050000 },
+  { 0xC99Eu, 0.00000000 },
+  { 0xC99Fu, 0.00000000 },
+  { 0xC9A0u, 0.00000000 },
+  { 0xC9A1u, 0.00000000 },
+  { 0xC9A2u, 0.00000000 },
+  { 0xC9A3u, 0.00000000 },
+  { 0xC9A4u, 0.00000000 },
+  { 0xC9A5u, 0.00000000 },
+  { 0xC9A6u, 0.00000000 },
+  { 0xC9A7u, 0.00000000 },
+  { 0xC9A8u, 0.00000000 },
+  { 0xC9A9u, 0.00000000 },
+  { 0xC9AAu, 0.00000000 },
+  { 0xC9ABu, 0.00000000 },
+  { 0xC9ACu, 0.00000000 },
+  { 0xC9ADu, 0.00000000 },
+  { 0xC9AEu, 0.00000000 },
+  { 0xC9AFu, 0.00000000 },
+  { 0xC9B0u, 0.00000000 },
+  { 0xC9B1u, 0.00000000 },
+  { 0xC9B2u, 0.00000000 },
+  { 0xC9B3u, 0.00000000 },
+  { 0xC9B4u, 0.00000000 },
+  { 0xC9B5u, 0.00000000 },
+  { 0xC9B6u, 0.00000000 },
+  { 0xC9B7u, 0.00000000 },
+  { 0xC9B8u, 0.00000000 },
+  { 0xC9B9u, 0.00000000 },
+  { 0xC9BAu, 0.00000000 },
+  { 0xC9BBu, 0.00000000 },
+  { 0xC9BCu, 0.00000000 },
+  { 0xC9BDu, 0.00000000 },
+  { 0xC9BEu, 0.00000000 },
+  { 0xC9BFu, 0.00000000 },
+  { 0xC9C0u, 0.01240000 },
+  { 0xC9C1u, 0.00120000 },
+  { 0xC9C2u, 0.00000000 },
+  { 0xC9C3u, 0.00000000 },
+  { 0xC9C4u, 0.00270000 },
+  { 0xC9C5u, 0.00000000 },
+  { 0xC9C6u, 0.00000000 },
+  { 0xC9C7u, 0.00000000 },
+  { 0xC9C8u, 0.00070000 },
+  { 0xC9C9u, 0.00000000 },
+  { 0xC9CAu, 0.00000000 },
+  { 0xC9CBu, 0.00000000 },
+  { 0xC9CCu, 0.00000000 },
+  { 0xC9CDu, 0.00000000 },
+  { 0xC9CEu, 0.00000000 },
+  { 0xC9CFu, 0.00000000 },
+  { 0xC9D0u, 0.00010000 },
+  { 0xC9D1u, 0.00080000 },
+  { 0xC9D2u, 0.00000000 },
+  { 0xC9D3u, 0.00010000 },
+  { 0xC9D4u, 0.00000000 },
+  { 0xC9D5u, 0.00030000 },
+  { 0xC9D6u, 0.00000000 },
+  { 0xC9D7u, 0.00000000 },
+  { 0xC9D8u, 0.00000000 },
+  { 0xC9D9u, 0.00000000 },
+  { 0xC9DAu, 0.00000000 },
+  { 0xC9DBu, 0.00000000 },
+  { 0xC9DCu, 0.00010000 },
+  { 0xC9DDu, 0.00000000 },
+  { 0xC9DEu, 0.00000000 },
+  { 0xC9DFu, 0.00000000 },
+  { 0xC9E0u, 0.00000000 },
+  { 0xC9E1u, 0.00000000 },
+  { 0xC9E2u, 0.00000000 },
+  { 0xC9E3u, 0.00000000 },
+  { 0xC9E4u, 0.00000000 },
+  { 0xC9E5u, 0.00000000 },
+  { 0xC9E6u, 0.00000000 },
+  { 0xC9E7u, 0.00010000 },
+  { 0xC9E8u, 0.00000000 },
+  { 0xC9E9u, 0.00000000 },
+  { 0xC9EAu, 0.00000000 },
+  { 0xC9EBu, 0.00000000 },
+  { 0xC9ECu, 0.00000000 },
+  { 0xC9EDu, 0.00000000 },
+  { 0xC9EEu, 0.00000000 },
+  { 0xC9EFu, 0.00000000 },
+  { 0xC9F0u, 0.00000000 },
+  { 0xC9F1u, 0.00000000 },
+  { 0xC9F2u, 0.00000000 },
+  { 0xC9F3u, 0.00000000 },
+  { 0xC9F4u, 0.00000000 },
+  { 0xC9F5u, 0.00000000 },
+  { 0xC9F6u, 0.00000000 },
+  { 0xC9F7u, 0.00000000 },
+  { 0xC9F8u, 0.00050000 },
+  { 0xC9F9u, 0.00000000 },
+  { 0xC9FAu, 0.00000000 },
+  { 0xC9FBu, 0.00000000 },
+  { 0xC9FCu, 0.00000000 },
+  { 0xC9FDu, 0.00000000 },
+  { 0xC9FEu, 0.00000000 },
+  { 0xC9FFu, 0.00000000 },
+  { 0xCA00u, 0.00000000 },
+  { 0xCA01u, 0.00000000 },
+  { 0xCA02u, 0.00000000 },
+  { 0xCA03u, 0.00000000 },
+  { 0xCA04u, 0.00000000 },
+  { 0xCA05u, 0.00000000 },
+  { 0xCA06u, 0.00000000 },
+  { 0xCA07u, 0.00000000 },
+  { 0xCA08u, 0.00000000 },
+  { 0xCA09u, 0.00000000 },
+  { 0xCA0Au, 0.00000000 },
+  { 0xCA0Bu, 0.00000000 },
+  { 0xCA0Cu, 0.00000000 },
+  { 0xCA0Du, 0.00000000 },
+  { 0xCA0Eu, 0.00000000 },
+  { 0xCA0Fu, 0.00000000 },
+  { 0xCA10u, 0.00000000 },
+  { 0xCA11u, 0.00000000 },
+  { 0xCA12u, 0.00000000 },
+  { 0xCA13u, 0.00000000 },
+  { 0xCA14u, 0.00000000 },
+  { 0xCA15u, 0.00000000 },
+  { 0xCA16u, 0.00000000 },
+  { 0xCA17u, 0.00000000 },
+  { 0xCA18u, 0.00000000 },
+  { 0xCA19u, 0.00000000 },
+  { 0xCA1Au, 0.00000000 },
+  { 0xCA1Bu, 0.00000000 },
+  { 0xCA1Cu, 0.00000000 },
+  { 0xCA1Du, 0.00000000 },
+  { 0xCA1Eu, 0.00000000 },
+  { 0xCA1Fu, 0.00000000 },
+  { 0xCA20u, 0.00000000 },
+  { 0xCA21u, 0.00000000 },
+  { 0xCA22u, 0.00000000 },
+  { 0xCA23u, 0.00000000 },
+  { 0xCA24u, 0.00000000 },
+  { 0xCA25u, 0.00000000 },
+  { 0xCA26u, 0.00000000 },
+  { 0xCA27u, 0.00000000 },
+  { 0xCA28u, 0.00000000 },
+  { 0xCA29u, 0.00000000 },
+  { 0xCA2Au, 0.00000000 },
+  { 0xCA2Bu, 0.00000000 },
+  { 0xCA2Cu, 0.00000000 },
+  { 0xCA2Du, 0.00000000 },
+  { 0xCA2Eu, 0.00000000 },
+  { 0xCA2Fu, 0.00000000 },
+  { 0xCA30u, 0.00000000 },
+  { 0xCA31u, 0.00000000 },
+  { 0xCA32u, 0.00000000 },
+  { 0xCA33u, 0.00000000 },
+  { 0xCA34u, 0.00000000 },
+  { 0xCA35u, 0.00000000 },
+  { 0xCA36u, 0.00000000 },
+  { 0xCA37u, 0.00000000 },
+  { 0xCA38u, 0.00000000 },
+  { 0xCA39u, 0.00000000 },
+  { 0xCA3Au, 0.00000000 },
+  { 0xCA3Bu, 0.00000000 },
+  { 0xCA3Cu, 0.00000000 },
+  { 0xCA3Du, 0.00000000 },
+  { 0xCA3Eu, 0.00000000 },
+  { 0xCA3Fu, 0.00000000 },
+  { 0xCA40u, 0.00000000 },
+  { 0xCA41u, 0.00000000 },
+  { 0xCA42u, 0.00000000 },
+  { 0xCA43u, 0.00000000 },
+  { 0xCA44u, 0.00000000 },
+  { 0xCA45u, 0.00000000 },
+  { 0xCA46u, 0.00000000 },
+  { 0xCA47u, 0.00000000 },
+  { 0xCA48u, 0.00000000 },
+  { 0xCA49u, 0.00000000 },
+  { 0xCA4Au, 0.00000000 },
+  { 0xCA4Bu, 0.00000000 },
+  { 0xCA4Cu, 0.00000000 },
+  { 0xCA4Du, 0.00000000 },
+  { 0xCA4Eu, 0.00000000 },
+  { 0xCA4Fu, 0.00000000 },
+  { 0xCA50u, 0.00000000 },
+  { 0xCA51u, 0.00000000 },
+  { 0xCA52u, 0.00000000 },
+  { 0xCA53u, 0.00000000 },
+  { 0xCA54u, 0.00000000 },
+  { 0xCA55u, 0.00000000 },
+  { 0xCA56u, 0.00000000 },
+  { 0xCA57u, 0.00000000 },
+  { 0xCA58u, 0.00000000 },
+  { 0xCA59u, 0.00000000 },
+  { 0xCA5Au, 0.00000000 },
+  { 0xCA5Bu, 0.00000000 },
+  { 0xCA5Cu, 0.00000000 },
+  { 0xCA5Du, 0.00000000 },
+  { 0xCA5Eu, 0.00000000 },
+  { 0xCA5Fu, 0.00000000 },
+  { 0xCA60u, 0.00000000 },
+  { 0xCA61u, 0.00000000 },
+  { 0xCA62u, 0.00000000 },
+  { 0xCA63u, 0.00000000 },
+  { 0xCA64u, 0.00000000 },
+  { 0xCA65u, 0.00000000 },
+  { 0xCA66u, 0.00000000 },
+  { 0xCA67u, 0.00000000 },
+  { 0xCA68u, 0.00000000 },
+  { 0xCA69u, 0.00000000 },
+  { 0xCA6Au, 0.00000000 },
+  { 0xCA6Bu, 0.00000000 },
+  { 0xCA6Cu, 0.00000000 },
+  { 0xCA6Du, 0.00000000 },
+  { 0xCA6Eu, 0.00000000 },
+  { 0xCA6Fu, 0.00000000 },
+  { 0xCA70u, 0.00000000 },
+  { 0xCA71u, 0.00000000 },
+  { 0xCA72u, 0.00000000 },
+  { 0xCA73u, 0.00000000 },
+  { 0xCA74u, 0.00000000 },
+  { 0xCA75u, 0.00000000 },
+  { 0xCA76u, 0.00000000 },
+  { 0xCA77u, 0.00000000 },
+  { 0xCA78u, 0.00000000 },
+  { 0xCA79u, 0.00000000 },
+  { 0xCA7Au, 0.00000000 },
+  { 0xCA7Bu, 0.00000000 },
+  { 0xCA7Cu, 0.00000000 },
+  { 0xCA7Du, 0.00000000 },
+  { 0xCA7Eu, 0.00000000 },
+  { 0xCA7Fu, 0.00000000 },
+  { 0xCA80u, 0.00000000 },
+  { 0xCA81u, 0.00000000 },
+  { 0xCA82u, 0.00000000 },
+  { 0xCA83u, 0.00000000 },
+  { 0xCA84u, 0.00000000 },
+  { 0xCA85u, 0.00000000 },
+  { 0xCA86u, 0.00000000 },
+  { 0xCA87u, 0.00000000 },
+  { 0xCA88u, 0.00000000 },
+  { 0xCA89u, 0.00000000 },
+  { 0xCA8Au, 0.00000000 },
+  { 0xCA8Bu, 0.00000000 },
+  { 0xCA8Cu, 0.00000000 },
+  { 0xCA8Du, 0.00000000 },
+  { 0xCA8Eu, 0.00000000 },
+  { 0xCA8Fu, 0.00000000 },
+  { 0xCA90u, 0.00000000 },
+  { 0xCA91u, 0.00000000 },
+  { 0xCA92u, 0.00000000 },
+  { 0xCA93u, 0.00000000 },
+  { 0xCA94u, 0.00000000 },
+  { 0xCA95u, 0.00000000 },
+  { 0xCA96u, 0.00000000 },
+  { 0xCA97u, 0.00000000 },
+  { 0xCA98u, 0.00000000 },
+  { 0xCA99u, 0.00000000 },
+  { 0xCA9Au, 0.00000000 },
+  { 0xCA9Bu, 0.00000000 },
+  { 0xCA9Cu, 0.00000000 },
+  { 0xCA9Du, 0.00000000 },
+  { 0xCA9Eu, 0.00000000 },
+  { 0xCA9Fu, 0.00000000 },
+  { 0xCAA0u, 0.00000000 },
+  { 0xCAA1u, 0.00000000 },
+  { 0xCAA2u, 0.00000000 },
+  { 0xCAA3u, 0.00000000 },
+  { 0xCAA4u, 0.00000000 },
+  { 0xCAA5u, 0.00000000 },
+  { 0xCAA6u, 0.00000000 },
+  { 0xCAA7u, 0.00000000 },
+  { 0xCAA8u, 0.00000000 },
+  { 0xCAA9u, 0.00000000 },
+  { 0xCAAAu, 0.00000000 },
+  { 0xCAABu, 0.00000000 },
+  { 0xCAACu, 0.00000000 },
+  { 0xCAADu, 0.00000000 },
+  { 0xCAAEu, 0.00000000 },
+  { 0xCAAFu, 0.00000000 },
+  { 0xCAB0u, 0.00000000 },
+  { 0xCAB1u, 0.00000000 },
+  { 0xCAB2u, 0.00000000 },
+  { 0xCAB3u, 0.00000000 },
+  { 0xCAB4u, 0.00000000 },
+  { 0xCAB5u, 0.00000000 },
+  { 0xCAB6u, 0.00000000 },
+  { 0xCAB7u, 0.00000000 },
+  { 0xCAB8u, 0.00000000 },
+  { 0xCAB9u, 0.00000000 },
+  { 0xCABAu, 0.00000000 },
+  { 0xCABBu, 0.00000000 },
+  { 0xCABCu, 0.00000000 },
+  { 0xCABDu, 0.00070000 },
+  { 0xCABEu, 0.00000000 },
+  { 0xCABFu, 0.00000000 },
+  { 0xCAC0u, 0.00000000 },
+  { 0xCAC1u, 0.00000000 },
+  { 0xCAC2u, 0.00000000 },
+  { 0xCAC3u, 0.00000000 },
+  { 0xCAC4u, 0.00000000 },
+  { 0xCAC5u, 0.00000000 },
+  { 0xCAC6u, 0.00000000 },
+  { 0xCAC7u, 0.00000000 },
+  { 0xCAC8u, 0.00000000 },
+  { 0xCAC9u, 0.00000000 },
+  { 0xCACAu, 0.00000000 },
+  { 0xCACBu, 0.00000000 },
+  { 0xCACCu, 0.00000000 },
+  { 0xCACDu, 0.00000000 },
+  { 0xCACEu, 0.00000000 },
+  { 0xCACFu, 0.00000000 },
+  { 0xCAD0u, 0.00000000 },
+  { 0xCAD1u, 0.00000000 },
+  { 0xCAD2u, 0.00000000 },
+  { 0xCAD3u, 0.00000000 },
+  { 0xCAD4u, 0.00000000 },
+  { 0xCAD5u, 0.00000000 },
+  { 0xCAD6u, 0.00000000 },
+  { 0xCAD7u, 0.00000000 },
+  { 0xCAD8u, 0.00000000 },
+  { 0xCAD9u, 0.00000000 },
+  { 0xCADAu, 0.00000000 },
+  { 0xCADBu, 0.00000000 },
+  { 0xCADCu, 0.00000000 },
+  { 0xCADDu, 0.00000000 },
+  { 0xCADEu, 0.00000000 },
+  { 0xCADFu, 0.00000000 },
+  { 0xCAE0u, 0.00000000 },
+  { 0xCAE1u, 0.00000000 },
+  { 0xCAE2u, 0.00000000 },
+  { 0xCAE3u, 0.00000000 },
+  { 0xCAE4u, 0.00000000 },
+  { 0xCAE5u, 0.00000000 },
+  { 0xCAE6u, 0.00000000 },
+  { 0xCAE7u, 0.00000000 },
+  { 0xCAE8u, 0.00000000 },
+  { 0xCAE9u, 0.00000000 },
+  { 0xCAEAu, 0.00000000 },
+  { 0xCAEBu, 0.00000000 },
+  { 0xCAECu, 0.00000000 },
+  { 0xCAEDu, 0.00000000 },
+  { 0xCAEEu, 0.00000000 },
+  { 0xCAEFu, 0.00000000 },
+  { 0xCAF0u, 0.00000000 },
+  { 0xCAF1u, 0.00000000 },
+  { 0xCAF2u, 0.00000000 },
+  { 0xCAF3u, 0.00000000 },
+  { 0xCAF4u, 0.00000000 },
+  { 0xCAF5u, 0.00000000 },
+  { 0xCAF6u, 0.00000000 },
+  { 0xCAF7u, 0.00000000 },
+  { 0xCAF8u, 0.00000000 },
+  { 0xCAF9u, 0.00000000 },
+  { 0xCAFAu, 0.00000000 },
+  { 0xCAFBu, 0.00000000 },
+  { 0xCAFCu, 0.00000000 },
+  { 0xCAFDu, 0.00000000 },
+  { 0xCAFEu, 0.00000000 },
+  { 0xCAFFu, 0.00000000 },
+  { 0xCB00u, 0.00000000 },
+  { 0xCB01u, 0.00000000 },
+  { 0xCB02u, 0.00000000 },
+  { 0xCB03u, 0.00000000 },
+  { 0xCB04u, 0.00000000 },
+  { 0xCB05u, 0.00000000 },
+  { 0xCB06u, 0.00000000 },
+  { 0xCB07u, 0.00000000 },
+  { 0xCB08u, 0.00000000 },
+  { 0xCB09u, 0.00000000 },
+  { 0xCB0Au, 0.00000000 },
+  { 0xCB0Bu, 0.00000000 },
+  { 0xCB0Cu, 0.00000000 },
+  { 0xCB0Du, 0.00000000 },
+  { 0xCB0Eu, 0.00000000 },
+  { 0xCB0Fu, 0.00000000 },
+  { 0xCB10u, 0.00000000 },
+  { 0xCB11u, 0.00000000 },
+  { 0xCB12u, 0.00000000 },
+  { 0xCB13u, 0.00000000 },
+  { 0xCB14u, 0.00000000 },
+  { 0xCB15u, 0.00000000 },
+  { 0xCB16u, 0.00000000 },
+  { 0xCB17u, 0.00000000 },
+  { 0xCB18u, 0.00000000 },
+  { 0xCB19u, 0.00000000 },
+  { 0xCB1Au, 0.00000000 },
+  { 0xCB1Bu, 0.00000000 },
+  { 0xCB1Cu, 0.00000000 },
+  { 0xCB1Du, 0.00000000 },
+  { 0xCB1Eu, 0.00000000 },
+  { 0xCB1Fu, 0.00000000 },
+  { 0xCB20u, 0.00000000 },
+  { 0xCB21u, 0.00000000 },
+  { 0xCB22u, 0.00000000 },
+  { 0xCB23u, 0.00000000 },
+  { 0xCB24u, 0.00000000 },
+  { 0xCB25u, 0.00000000 },
+  { 0xCB26u, 0.00000000 },
+  { 0xCB27u, 0.00000000 },
+  { 0xCB28u, 0.00000000 },
+  { 0xCB29u, 0.00000000 },
+  { 0xCB2Au, 0.00000000 },
+  { 0xCB2Bu, 0.00000000 },
+  { 0xCB2Cu, 0.00000000 },
+  { 0xCB2Du, 0.00000000 },
+  { 0xCB2Eu, 0.00000000 },
+  { 0xCB2Fu, 0.00000000 },
+  { 0xCB30u, 0.00000000 },
+  { 0xCB31u, 0.00000000 },
+  { 0xCB32u, 0.00000000 },
+  { 0xCB33u, 0.00000000 },
+  { 0xCB34u, 0.00000000 },
+  { 0xCB35u, 0.00000000 },
+  { 0xCB36u, 0.00000000 },
+  { 0xCB37u, 0.00000000 },
+  { 0xCB38u, 0.00000000 },
+  { 0xCB39u, 0.00000000 },
+  { 0xCB3Au, 0.00000000 },
+  { 0xCB3Bu, 0.00000000 },
+  { 0xCB3Cu, 0.00000000 },
+  { 0xCB3Du, 0.00000000 },
+  { 0xCB3Eu, 0.00000000 },
+  { 0xCB3Fu, 0.00000000 },
+  { 0xCB40u, 0.00000000 },
+  { 0xCB41u, 0.00000000 },
+  { 0xCB42u, 0.00000000 },
+  { 0xCB43u, 0.00000000 },
+  { 0xCB44u, 0.00000000 },
+  { 0xCB45u, 0.00000000 },
+  { 0xCB46u, 0.00000000 },
+  { 0xCB47u, 0.00000000 },
+  { 0xCB48u, 0.00000000 },
+  { 0xCB49u, 0.00000000 },
+  { 0xCB4Au, 0.00000000 },
+  { 0xCB4Bu, 0.00000000 },
+  { 0xCB4Cu, 0.00000000 },
+  { 0xCB4Du, 0.00000000 },
+  { 0xCB4Eu, 0.00000000 },
+  { 0xCB4Fu, 0.00000000 },
+  { 0xCB50u, 0.00000000 },
+  { 0xCB51u, 0.00000000 },
+  { 0xCB52u, 0.00000000 },
+  { 0xCB53u, 0.00000000 },
+  { 0xCB54u, 0.00000000 },
+  { 0xCB55u, 0.00000000 },
+  { 0xCB56u, 0.00000000 },
+  { 0xCB57u, 0.00000000 },
+  { 0xCB58u, 0.00000000 },
+  { 0xCB59u, 0.00000000 },
+  { 0xCB5Au, 0.00000000 },
+  { 0xCB5Bu, 0.00000000 },
+  { 0xCB5Cu, 0.00000000 },
+  { 0xCB5Du, 0.00000000 },
+  { 0xCB5Eu, 0.00000000 },
+  { 0xCB5Fu, 0.00000000 },
+  { 0xCB60u, 0.00000000 },
+  { 0xCB61u, 0.00000000 },
+  { 0xCB62u, 0.00000000 },
+  { 0xCB63u, 0.00000000 },
+  { 0xCB64u, 0.00000000 },
+  { 0xCB65u, 0.00000000 },
+  { 0xCB66u, 0.00000000 },
+  { 0xCB67u, 0.00000000 },
+  { 0xCB68u, 0.00000000 },
+  { 0xCB69u, 0.00000000 },
+  { 0xCB6Au, 0.00000000 },
+  { 0xCB6Bu, 0.00000000 },
+  { 0xCB6Cu, 0.00000000 },
+  { 0xCB6Du, 0.00000000 },
+  { 0xCB6Eu, 0.00000000 },
+  { 0xCB6Fu, 0.00000000 },
+  { 0xCB70u, 0.00000000 },
+  { 0xCB71u, 0.00000000 },
+  { 0xCB72u, 0.00000000 },
+  { 0xCB73u, 0.00000000 },
+  { 0xCB74u, 0.00000000 },
+  { 0xCB75u, 0.00000000 },
+  { 0xCB76u, 0.00000000 },
+  { 0xCB77u, 0.00000000 },
+  { 0xCB78u, 0.00000000 },
+  { 0xCB79u, 0.00000000 },
+  { 0xCB7Au, 0.00000000 },
+  { 0xCB7Bu, 0.00000000 },
+  { 0xCB7Cu, 0.00000000 },
+  { 0xCB7Du, 0.00000000 },
+  { 0xCB7Eu, 0.00000000 },
+  { 0xCB7Fu, 0.00000000 },
+  { 0xCB80u, 0.00000000 },
+  { 0xCB81u, 0.00000000 },
+  { 0xCB82u, 0.00000000 },
+  { 0xCB83u, 0.00000000 },
+  { 0xCB84u, 0.00000000 },
+  { 0xCB85u, 0.00000000 },
+  { 0xCB86u, 0.00000000 },
+  { 0xCB87u, 0.00000000 },
+  { 0xCB88u, 0.00000000 },
+  { 0xCB89u, 0.00000000 },
+  { 0xCB8Au, 0.00000000 },
+  { 0xCB8Bu, 0.00000000 },
+  { 0xCB8Cu, 0.00000000 },
+  { 0xCB8Du, 0.00000000 },
+  { 0xCB8Eu, 0.00000000 },
+  { 0xCB8Fu, 0.00000000 },
+  { 0xCB90u, 0.00000000 },
+  { 0xCB91u, 0.00000000 },
+  { 0xCB92u, 0.00000000 },
+  { 0xCB93u, 0.00000000 },
+  { 0xCB94u, 0.00000000 },
+  { 0xCB95u, 0.00000000 },
+  { 0xCB96u, 0.00000000 },
+  { 0xCB97u, 0.00000000 },
+  { 0xCB98u, 0.00000000 },
+  { 0xCB99u, 0.00000000 },
+  { 0xCB9Au, 0.00000000 },
+  { 0xCB9Bu, 0.00000000 },
+  { 0xCB9Cu, 0.00000000 },
+  { 0xCB9Du, 0.00000000 },
+  { 0xCB9Eu, 0.00000000 },
+  { 0xCB9Fu, 0.00000000 },
+  { 0xCBA0u, 0.00000000 },
+  { 0xCBA1u, 0.00000000 },
+  { 0xCBA2u, 0.00000000 },
+  { 0xCBA3u, 0.00000000 },
+  { 0xCBA4u, 0.00000000 },
+  { 0xCBA5u, 0.00000000 },
+  { 0xCBA6u, 0.00000000 },
+  { 0xCBA7u, 0.00000000 },
+  { 0xCBA8u, 0.00000000 },
+  { 0xCBA9u, 0.00000000 },
+  { 0xCBAAu, 0.00000000 },
+  { 0xCBABu, 0.00000000 },
+  { 0xCBACu, 0.00000000 },
+  { 0xCBADu, 0.00000000 },
+  { 0xCBAEu, 0.00000000 },
+  { 0xCBAFu, 0.00000000 },
+  { 0xCBB0u, 0.00000000 },
+  { 0xCBB1u, 0.00000000 },
+  { 0xCBB2u, 0.00000000 },
+  { 0xCBB3u, 0.00000000 },
+  { 0xCBB4u, 0.00000000 },
+  { 0xCBB5u, 0.00000000 },
+  { 0xCBB6u, 0.00000000 },
+  { 0xCBB7u, 0.00000000 },
+  { 0xCBB8u, 0.00000000 },
+  { 0xCBB9u, 0.00000000 },
+  { 0xCBBAu, 0.00000000 },
+  { 0xCBBBu, 0.00000000 },
+  { 0xCBBCu, 0.00000000 },
+  { 0xCBBDu, 0.00000000 },
+  { 0xCBBEu, 0.00000000 },
+  { 0xCBBFu, 0.00000000 },
+  { 0xCBC0u, 0.00000000 },
+  { 0xCBC1u, 0.00000000 },
+  { 0xCBC2u, 0.00000000 },
+  { 0xCBC3u, 0.00000000 },
+  { 0xCBC4u, 0.00000000 },
+  { 0xCBC5u, 0.00000000 },
+  { 0xCBC6u, 0.00000000 },
+  { 0xCBC7u, 0.00000000 },
+  { 0xCBC8u, 0.00000000 },
+  { 0xCBC9u, 0.00000000 },
+  { 0xCBCAu, 0.00000000 },
+  { 0xCBCBu, 0.00000000 },
+  { 0xCBCCu, 0.00000000 },
+  { 0xCBCDu, 0.00000000 },
+  { 0xCBCEu, 0.00000000 },
+  { 0xCBCFu, 0.00000000 },
+  { 0xCBD0u, 0.00000000 },
+  { 0xCBD1u, 0.00000000 },
+  { 0xCBD2u, 0.00000000 },
+  { 0xCBD3u, 0.00000000 },
+  { 0xCBD4u, 0.00000000 },
+  { 0xCBD5u, 0.00000000 },
+  { 0xCBD6u, 0.00000000 },
+  { 0xCBD7u, 0.00000000 },
+  { 0xCBD8u, 0.00000000 },
+  { 0xCBD9u, 0.00000000 },
+  { 0xCBDAu, 0.00000000 },
+  { 0xCBDBu, 0.00000000 },
+  { 0xCBDCu, 0.00000000 },
+  { 0xCBDDu, 0.00000000 },
+  { 0xCBDEu, 0.00000000 },
+  { 0xCBDFu, 0.00000000 },
+  { 0xCBE0u, 0.00000000 },
+  { 0xCBE1u, 0.00000000 },
+  { 0xCBE2u, 0.00000000 },
+  { 0xCBE3u, 0.00000000 },
+  { 0xCBE4u, 0.00000000 },
+  { 0xCBE5u, 0.00000000 },
+  { 0xCBE6u, 0.00000000 },
+  { 0xCBE7u, 0.00000000 },
+  { 0xCBE8u, 0.00000000 },
+  { 0xCBE9u, 0.00000000 },
+  { 0xCBEAu, 0.00000000 },
+  { 0xCBEBu, 0.00000000 },
+  { 0xCBECu, 0.00000000 },
+  { 0xCBEDu, 0.00000000 },
+  { 0xCBEEu, 0.00000000 },
+  { 0xCBEFu, 0.00000000 },
+  { 0xCBF0u, 0.00000000 },
+  { 0xCBF1u, 0.00000000 },
+  { 0xCBF2u, 0.00000000 },
+  { 0xCBF3u, 0.00000000 },
+  { 0xCBF4u, 0.00000000 },
+  { 0xCBF5u, 0.00000000 },
+  { 0xCBF6u, 0.00000000 },
+  { 0xCBF7u, 0.00000000 },
+  { 0xCBF8u, 0.00000000 },
+  { 0xCBF9u, 0.00000000 },
+  { 0xCBFAu, 0.00000000 },
+  { 0xCBFBu, 0.00000000 },
+  { 0xCBFCu, 0.00000000 },
+  { 0xCBFDu, 0.00000000 },
+  { 0xCBFEu, 0.00000000 },
+  { 0xCBFFu, 0.00000000 },
+  { 0xCC00u, 0.00000000 },
+  { 0xCC01u, 0.00000000 },
+  { 0xCC02u, 0.00000000 },
+  { 0xCC03u, 0.00000000 },
+  { 0xCC04u, 0.00000000 },
+  { 0xCC05u, 0.00000000 },
+  { 0xCC06u, 0.00000000 },
+  { 0xCC07u, 0.00000000 },
+  { 0xCC08u, 0.00000000 },
+  { 0xCC09u, 0.00000000 },
+  { 0xCC0Au, 0.00000000 },
+  { 0xCC0Bu, 0.00000000 },
+  { 0xCC0Cu, 0.00000000 },
+  { 0xCC0Du, 0.00010000 },
+  { 0xCC0Eu, 0.00000000 },
+  { 0xCC0Fu, 0.00000000 },
+  { 0xCC10u, 0.00000000 },
+  { 0xCC11u, 0.00000000 },
+  { 0xCC12u, 0.00000000 },
+  { 0xCC13u, 0.00000000 },
+  { 0xCC14u, 0.00000000 },
+  { 0xCC15u, 0.00000000 },
+  { 0xCC16u, 0.00000000 },
+  { 0xCC17u, 0.00000000 },
+  { 0xCC18u, 0.00000000 },
+  { 0xCC19u, 0.00000000 },
+  { 0xCC1Au, 0.00000000 },
+  { 0xCC1Bu, 0.00000000 },
+  { 0xCC1Cu, 0.00000000 },
+  { 0xCC1Du, 0.00000000 },
+  { 0xCC1Eu, 0.00000000 },
+  { 0xCC1Fu, 0.00000000 },
+  { 0xCC20u, 0.00000000 },
+  { 0xCC21u, 0.00000000 },
+  { 0xCC22u, 0.00000000 },
+  { 0xCC23u, 0.00000000 },
+  { 0xCC24u, 0.00000000 },
+  { 0xCC25u, 0.00000000 },
+  { 0xCC26u, 0.00000000 },
+  { 0xCC27u, 0.00000000 },
+  { 0xCC28u, 0.00200000 },
+  { 0xCC29u, 0.00030000 },
+  { 0xCC2Au, 0.00000000 },
+  { 0xCC2Bu, 0.00000000 },
+  { 0xCC2Cu, 0.00020000 },
+  { 0xCC2Du, 0.00000000 },
+  { 0xCC2Eu, 0.00000000 },
+  { 0xCC2Fu, 0.00000000 },
+  { 0xCC30u, 0.00030000 },
+  { 0xCC31u, 0.00000000 },
+  { 0xCC32u, 0.00000000 },
+  { 0xCC33u, 0.00000000 },
+  { 0xCC34u, 0.00000000 },
+  { 0xCC35u, 0.00000000 },
+  { 0xCC36u, 0.00000000 },
+  { 0xCC37u, 0.00000000 },
+  { 0xCC38u, 0.00070000 },
+  { 0xCC39u, 0.00000000 },
+  { 0xCC3Au, 0.00000000 },
+  { 0xCC3Bu, 0.00000000 },
+  { 0xCC3Cu, 0.00000000 },
+  { 0xCC3Du, 0.00060000 },
+  { 0xCC3Eu, 0.00020000 },
+  { 0xCC3Fu, 0.00000000 },
+  { 0xCC40u, 0.00000000 },
+  { 0xCC41u, 0.00000000 },
+  { 0xCC42u, 0.00000000 },
+  { 0xCC43u, 0.00000000 },
+  { 0xCC44u, 0.00040000 },
+  { 0xCC45u, 0.00040000 },
+  { 0xCC46u, 0.00000000 },
+  { 0xCC47u, 0.00000000 },
+  { 0xCC48u, 0.00000000 },
+  { 0xCC49u, 0.00000000 },
+  { 0xCC4Au, 0.00000000 },
+  { 0xCC4Bu, 0.00000000 },
+  { 0xCC4Cu, 0.00000000 },
+  { 0xCC4Du, 0.00000000 },
+  { 0xCC4Eu, 0.00000000 },
+  { 0xCC4Fu, 0.00000000 },
+  { 0xCC50u, 0.00000000 },
+  { 0xCC51u, 0.00000000 },
+  { 0xCC52u, 0.00000000 },
+  { 0xCC53u, 0.00000000 },
+  { 0xCC54u, 0.00010000 },
+  { 0xCC55u, 0.00000000 },
+  { 0xCC56u, 0.00000000 },
+  { 0xCC57u, 0.00000000 },
+  { 0xCC58u, 0.00000000 },
+  { 0xCC59u, 0.00000000 },
+  { 0xCC5Au, 0.00000000 },
+  { 0xCC5Bu, 0.00000000 },
+  { 0xCC5Cu, 0.00000000 },
+  { 0xCC5Du, 0.00000000 },
+  { 0xCC5Eu, 0.00000000 },
+  { 0xCC5Fu, 0.00000000 },
+  { 0xCC60u, 0.00000000 },
+  { 0xCC61u, 0.00000000 },
+  { 0xCC62u, 0.00000000 },
+  { 0xCC63u, 0.00000000 },
+  { 0xCC64u, 0.00000000 },
+  { 0xCC65u, 0.00000000 },
+  { 0xCC66u, 0.00000000 },
+  { 0xCC67u, 0.00000000 },
+  { 0xCC68u, 0.00000000 },
+  { 0xCC69u, 0.00000000 },
+  { 0xCC6Au, 0.00000000 },
+  { 0xCC6Bu, 0.00000000 },
+  { 0xCC6Cu, 0.00000000 },
+  { 0xCC6Du, 0.00000000 },
+  { 0xCC6Eu, 0.00000000 },
+  { 0xCC6Fu, 0.00000000 },
+  { 0xCC70u, 0.00000000 },
+  { 0xCC71u, 0.00000000 },
+  { 0xCC72u, 0.00000000 },
+  { 0xCC73u, 0.00000000 },
+  { 0xCC74u, 0.00000000 },
+  { 0xCC75u, 0.00000000 },
+  { 0xCC76u, 0.00000000 },
+  { 0xCC77u, 0.00000000 },
+  { 0xCC78u, 0.00000000 },
+  { 0xCC79u, 0.00000000 },
+  { 0xCC7Au, 0.00000000 },
+  { 0xCC7Bu, 0.00000000 },
+  { 0xCC7Cu, 0.00000000 },
+  { 0xCC7Du, 0.00000000 },
+  { 0xCC7Eu, 0.00000000 },
+  { 0xCC7Fu, 0.00000000 },
+  { 0xCC80u, 0.00000000 },
+  { 0xCC81u, 0.00000000 },
+  { 0xCC82u, 0.00000000 },
+  { 0xCC83u, 0.00000000 },
+  { 0xCC84u, 0.00000000 },
+  { 0xCC85u, 0.00000000 },
+  { 0xCC86u, 0.00000000 },
+  { 0xCC87u, 0.00000000 },
+  { 0xCC88u, 0.00000000 },
+  { 0xCC89u, 0.00000000 },
+  { 0xCC8Au, 0.00000000 },
+  { 0xCC8Bu, 0.00000000 },
+  { 0xCC8Cu, 0.00000000 },
+  { 0xCC8Du, 0.00000000 },
+  { 0xCC8Eu, 0.00000000 },
+  { 0xCC8Fu, 0.00000000 },
+  { 0xCC90u, 0.00000000 },
+  { 0xCC91u, 0.00000000 },
+  { 0xCC92u, 0.00000000 },
+  { 0xCC93u, 0.00000000 },
+  { 0xCC94u, 0.00000000 },
+  { 0xCC95u, 0.00000000 },
+  { 0xCC96u, 0.00000000 },
+  { 0xCC97u, 0.00000000 },
+  { 0xCC98u, 0.00090000 },
+  { 0xCC99u, 0.00010000 },
+  { 0xCC9Au, 0.00000000 },
+  { 0xCC9Bu, 0.00000000 },
+  { 0xCC9Cu, 0.00100000 },
+  { 0xCC9Du, 0.00000000 },
+  { 0xCC9Eu, 0.00000000 },
+  { 0xCC9Fu, 0.00000000 },
+  { 0xCCA0u, 0.00070000 },
+  { 0xCCA1u, 0.00000000 },
+  { 0xCCA2u, 0.00000000 },
+  { 0xCCA3u, 0.00000000 },
+  { 0xCCA4u, 0.00000000 },
+  { 0xCCA5u, 0.00000000 },
+  { 0xCCA6u, 0.00000000 },
+  { 0xCCA7u, 0.00000000 },
+  { 0xCCA8u, 0.00000000 },
+  { 0xCCA9u, 0.00000000 },
+  { 0xCCAAu, 0.00000000 },
+  { 0xCCABu, 0.00030000 },
+  { 0xCCACu, 0.00000000 },
+  { 0xCCADu, 0.00090000 },
+  { 0xCCAEu, 0.00000000 },
+  { 0xCCAFu, 0.00000000 },
+  { 0xCCB0u, 0.00000000 },
+  { 0xCCB1u, 0.00000000 },
+  { 0xCCB2u, 0.00000000 },
+  { 0xCCB3u, 0.00000000 },
+  { 0xCCB4u, 0.00180000 },
+  { 0xCCB5u, 0.00000000 },
+  { 0xCCB6u, 0.00000000 },
+  { 0xCCB7u, 0.00000000 },
+  { 0xCCB8u, 0.00000000 },
+  { 0xCCB9u, 0.00000000 },
+  { 0xCCBAu, 0.00000000 },
+  { 0xCCBBu, 0.00000000 },
+  { 0xCCBCu, 0.00000000 },
+  { 0xCCBDu, 0.00000000 },
+  { 0xCCBEu, 0.00000000 },
+  { 0xCCBFu, 0.00000000 },
+  { 0xCCC0u, 0.00000000 },
+  { 0xCCC1u, 0.00000000 },
+  { 0xCCC2u, 0.00000000 },
+  { 0xCCC3u, 0.00000000 },
+  { 0xCCC4u, 0.00000000 },
+  { 0xCCC5u, 0.00000000 },
+  { 0xCCC6u, 0.00000000 },
+  { 0xCCC7u, 0.00000000 },
+  { 0xCCC8u, 0.00000000 },
+  { 0xCCC9u, 0.00000000 },
+  { 0xCCCAu, 0.00000000 },
+  { 0xCCCBu, 0.00000000 },
+  { 0xCCCCu, 0.00000000 },
+  { 0xCCCDu, 0.00000000 },
+  { 0xCCCEu, 0.00000000 },
+  { 0xCCCFu, 0.00000000 },
+  { 0xCCD0u, 0.00040000 },
+  { 0xCCD1u, 0.00000000 },
+  { 0xCCD2u, 0.00000000 },
+  { 0xCCD3u, 0.00000000 },
+  { 0xCCD4u, 0.00000000 },
+  { 0xCCD5u, 0.00000000 },
+  { 0xCCD6u, 0.00000000 },
+  { 0xCCD7u, 0.00000000 },
+  { 0xCCD8u, 0.00000000 },
+  { 0xCCD9u, 0.00000000 },
+  { 0xCCDAu, 0.00000000 },
+  { 0xCCDBu, 0.00000000 },
+  { 0xCCDCu, 0.00000000 },
+  { 0xCCDDu, 0.00000000 },
+  { 0xCCDEu, 0.00000000 },
+  { 0xCCDFu, 0.00000000 },
+  { 0xCCE0u, 0.00000000 },
+  { 0xCCE1u, 0.00000000 },
+  { 0xCCE2u, 0.00000000 },
+  { 0xCCE3u, 0.00000000 },
+  { 0xCCE4u, 0.00010000 },
+  { 0xCCE5u, 0.00000000 },
+  { 0xCCE6u, 0.00000000 },
+  { 0xCCE7u, 0.00000000 },
+  { 0xCCE8u, 0.00000000 },
+  { 0xCCE9u, 0.00000000 },
+  { 0xCCEAu, 0.00000000 },
+  { 0xCCEBu, 0.00000000 },
+  { 0xCCECu, 0.00000000 },
+  { 0xCCEDu, 0.00000000 },
+  { 0xCCEEu, 0.00000000 },
+  { 0xCCEFu, 0.00000000 },
+  { 0xCCF0u, 0.00000000 },
+  { 0xCCF1u, 0.00000000 },
+  { 0xCCF2u, 0.00000000 },
+  { 0xCCF3u, 0.00000000 },
+  { 0xCCF4u, 0.00000000 },
+  { 0xCCF5u, 0.00000000 },
+  { 0xCCF6u, 0.00000000 },
+  { 0xCCF7u, 0.00000000 },
+  { 0xCCF8u, 0.00000000 },
+  { 0xCCF9u, 0.00000000 },
+  { 0xCCFAu, 0.00000000 },
+  { 0xCCFBu, 0.00000000 },
+  { 0xCCFCu, 0.00000000 },
+  { 0xCCFDu, 0.00000000 },
+  { 0xCCFEu, 0.00000000 },
+  { 0xCCFFu, 0.00000000 },
+  { 0xCD00u, 0.00000000 },
+  { 0xCD01u, 0.00000000 },
+  { 0xCD02u, 0.00000000 },
+  { 0xCD03u, 0.00000000 },
+  { 0xCD04u, 0.00000000 },
+  { 0xCD05u, 0.00000000 },
+  { 0xCD06u, 0.00000000 },
+  { 0xCD07u, 0.00000000 },
+  { 0xCD08u, 0.00120000 },
+  { 0xCD09u, 0.00010000 },
+  { 0xCD0Au, 0.00000000 },
+  { 0xCD0Bu, 0.00000000 },
+  { 0xCD0Cu, 0.00020000 },
+  { 0xCD0Du, 0.00000000 },
+  { 0xCD0Eu, 0.00000000 },
+  { 0xCD0Fu, 0.00000000 },
+  { 0xCD10u, 0.00000000 },
+  { 0xCD11u, 0.00000000 },
+  { 0xCD12u, 0.00000000 },
+  { 0xCD13u, 0.00000000 },
+  { 0xCD14u, 0.00000000 },
+  { 0xCD15u, 0.00000000 },
+  { 0xCD16u, 0.00000000 },
+  { 0xCD17u, 0.00000000 },
+  { 0xCD18u, 0.00000000 },
+  { 0xCD19u, 0.00000000 },
+  { 0xCD1Au, 0.00000000 },
+  { 0xCD1Bu, 0.00000000 },
+  { 0xCD1Cu, 0.00000000 },
+  { 0xCD1Du, 0.00070000 },
+  { 0xCD1Eu, 0.00000000 },
+  { 0xCD1Fu, 0.00000000 },
+  { 0xCD20u, 0.00000000 },
+  { 0xCD21u, 0.00000000 },
+  { 0xCD22u, 0.00000000 },
+  { 0xCD23u, 0.00000000 },
+  { 0xCD24u, 0.00000000 },
+  { 0xCD25u, 0.00000000 },
+  { 0xCD26u, 0.00000000 },
+  { 0xCD27u, 0.00000000 },
+  { 0xCD28u, 0.00000000 },
+  { 0xCD29u, 0.00000000 },
+  { 0xCD2Au, 0.00000000 },
+  { 0xCD2Bu, 0.00000000 },
+  { 0xCD2Cu, 0.00000000 },
+  { 0xCD2Du, 0.00000000 },
+  { 0xCD2Eu, 0.00000000 },
+  { 0xCD2Fu, 0.00000000 },
+  { 0xCD30u, 0.00000000 },
+  { 0xCD31u, 0.00000000 },
+  { 0xCD32u, 0.00000000 },
+  { 0xCD33u, 0.00000000 },
+  { 0xCD34u, 0.00000000 },
+  { 0xCD35u, 0.00000000 },
+  { 0xCD36u, 0.00000000 },
+  { 0xCD37u, 0.00000000 },
+  { 0xCD38u, 0.00000000 },
+  { 0xCD39u, 0.00000000 },
+  { 0xCD3Au, 0.00000000 },
+  { 0xCD3Bu, 0.00000000 },
+  { 0xCD3Cu, 0.00000000 },
+  { 0xCD3Du, 0.00000000 },
+  { 0xCD3Eu, 0.00000000 },
+  { 0xCD3Fu, 0.00000000 },
+  { 0xCD40u, 0.00000000 },
+  { 0xCD41u, 0.00000000 },
+  { 0xCD42u, 0.00000000 },
+  { 0xCD43u, 0.00000000 },
+  { 0xCD44u, 0.00000000 },
+  { 0xCD45u, 0.00000000 },
+  { 0xCD46u, 0.00000000 },
+  { 0xCD47u, 0.00000000 },
+  { 0xCD48u, 0.00000000 },
+  { 0xCD49u, 0.00000000 },
+  { 0xCD4Au, 0.00000000 },
+  { 0xCD4Bu, 0.00000000 },
+  { 0xCD4Cu, 0.00000000 },
+  { 0xCD4Du, 0.00000000 },
+  { 0xCD4Eu, 0.00000000 },
+  { 0xCD4Fu, 0.00000000 },
+  { 0xCD50u, 0.00000000 },
+  { 0xCD51u, 0.00000000 },
+  { 0xCD52u, 0.00000000 },
+  { 0xCD53u, 0.00000000 },
+  { 0xCD54u, 0.00000000 },
+  { 0xCD55u, 0.00000000 },
+  { 0xCD56u, 0.00000000 },
+  { 0xCD57u, 0.00000000 },
+  { 0xCD58u, 0.00000000 },
+  { 0xCD59u, 0.00000000 },
+  { 0xCD5Au, 0.00000000 },
+  { 0xCD5Bu, 0.00000000 },
+  { 0xCD5Cu, 0.00110000 },
+  { 0xCD5Du, 0.00000000 },
+  { 0xCD5Eu, 0.00000000 },
+  { 0xCD5Fu, 0.00000000 },
+  { 0xCD60u, 0.00000000 },
+  { 0xCD61u, 0.00000000 },
+  { 0xCD62u, 0.00000000 },
+  { 0xCD63u, 0.00000000 },
+  { 0xCD64u, 0.00000000 },
+  { 0xCD65u, 0.00000000 },
+  { 0xCD66u, 0.00000000 },
+  { 0xCD67u, 0.00000000 },
+  { 0xCD68u, 0.00000000 },
+  { 0xCD69u, 0.00000000 },
+  { 0xCD6Au, 0.00000000 },
+  { 0xCD6Bu, 0.00000000 },
+  { 0xCD6Cu, 0.00000000 },
+  { 0xCD6Du, 0.00000000 },
+  { 0xCD6Eu, 0.00000000 },
+  { 0xCD6Fu, 0.00000000 },
+  { 0xCD70u, 0.00000000 },
+  { 0xCD71u, 0.00000000 },
+  { 0xCD72u, 0.00000000 },
+  { 0xCD73u, 0.00000000 },
+  { 0xCD74u, 0.00000000 },
+  { 0xCD75u, 0.00000000 },
+  { 0xCD76u, 0.00000000 },
+  { 0xCD77u, 0.00000000 },
+  { 0xCD78u, 0.00000000 },
+  { 0xCD79u, 0.00000000 },
+  { 0xCD7Au, 0.00000000 },
+  { 0xCD7Bu, 0.00000000 },
+  { 0xCD7Cu, 0.00000000 },
+  { 0xCD7Du, 0.00000000 },
+  { 0xCD7Eu, 0.00000000 },
+  { 0xCD7Fu, 0.00000000 },
+  { 0xCD80u, 0.00000000 },
+  { 0xCD81u, 0.00000000 },
+  { 0xCD82u, 0.00000000 },
+  { 0xCD83u, 0.00000000 },
+  { 0xCD84u, 0.00000000 },
+  { 0xCD85u, 0.00000000 },
+  { 0xCD86u, 0.00000000 },
+  { 0xCD87u, 0.00000000 },
+  { 0xCD88u, 0.00000000 },
+  { 0xCD89u, 0.00000000 },
+  { 0xCD8Au, 0.00000000 },
+  { 0xCD8Bu, 0.00000000 },
+  { 0xCD8Cu, 0.00000000 },
+  { 0xCD8Du, 0.00000000 },
+  { 0xCD8Eu, 0.00000000 },
+  { 0xCD8Fu, 0.00000000 },
+  { 0xCD90u, 0.00000000 },
+  { 0xCD91u, 0.00000000 },
+  { 0xCD92u, 0.00000000 },
+  { 0xCD93u, 0.00000000 },
+  { 0xCD94u, 0.00090000 },
+  { 0xCD95u, 0.00060000 },
+  { 0xCD96u, 0.00000000 },
+  { 0xCD97u, 0.00000000 },
+  { 0xCD98u, 0.00010000 },
+  { 0xCD99u, 0.00000000 },
+  { 0xCD9Au, 0.00000000 },
+  { 0xCD9Bu, 0.00000000 },
+  { 0xCD9Cu, 0.00160000 },
+  { 0xCD9Du, 0.00000000 },
+  { 0xCD9Eu, 0.00000000 },
+  { 0xCD9Fu, 0.00000000 },
+  { 0xCDA0u, 0.00000000 },
+  { 0xCDA1u, 0.00000000 },
+  { 0xCDA2u, 0.00000000 },
+  { 0xCDA3u, 0.00000000 },
+  { 0xCDA4u, 0.00000000 },
+  { 0xCDA5u, 0.00000000 },
+  { 0xCDA6u, 0.00000000 },
+  { 0xCDA7u, 0.00000000 },
+  { 0xCDA8u, 0.00000000 },
+  { 0xCDA9u, 0.00040000 },
+  { 0xCDAAu, 0.00000000 },
+  { 0xCDABu, 0.00000000 },
+  { 0xCDACu, 0.00000000 },
+  { 0xCDADu, 0.00000000 },
+  { 0xCDAEu, 0.00000000 },
+  { 0xCDAFu, 0.00000000 },
+  { 0xCDB0u, 0.00000000 },
+  { 0xCDB1u, 0.00000000 },
+  { 0xCDB2u, 0.00000000 },
+  { 0xCDB3u, 0.00000000 },
+  { 0xCDB4u, 0.00000000 },
+  { 0xCDB5u, 0.00000000 },
+  { 0xCDB6u, 0.00000000 },
+  { 0xCDB7u, 0.00000000 },
+  { 0xCDB8u, 0.00000000 },
+  { 0xCDB9u, 0.00000000 },
+  { 0xCDBAu, 0.00000000 },
+  { 0xCDBBu, 0.00000000 },
+  { 0xCDBCu, 0.00000000 },
+  { 0xCDBDu, 0.00000000 },
+  { 0xCDBEu, 0.00000000 },
+  { 0xCDBFu, 0.00000000 },
+  { 0xCDC0u, 0.00000000 },
+  { 0xCDC1u, 0.00000000 },
+  { 0xCDC2u, 0.00000000 },
+  { 0xCDC3u, 0.00000000 },
+  { 0xCDC4u, 0.00000000 },
+  { 0xCDC5u, 0.00000000 },
+  { 0xCDC6u, 0.00000000 },
+  { 0xCDC7u, 0.00000000 },
+  { 0xCDC8u, 0.00000000 },
+  { 0xCDC9u, 0.00000000 },
+  { 0xCDCAu, 0.00000000 },
+  { 0xCDCBu, 0.00000000 },
+  { 0xCDCCu, 0.00000000 },
+  { 0xCDCDu, 0.00000000 },
+  { 0xCDCEu, 0.00000000 },
+  { 0xCDCFu, 0.00000000 },
+  { 0xCDD0u, 0.00000000 },
+  { 0xCDD1u, 0.00000000 },
+  { 0xCDD2u, 0.00000000 },
+  { 0xCDD3u, 0.00000000 },
+  { 0xCDD4u, 0.00000000 },
+  { 0xCDD5u, 0.00000000 },
+  { 0xCDD6u, 0.00000000 },
+  { 0xCDD7u, 0.00000000 },
+  { 0xCDD8u, 0.00000000 },
+  { 0xCDD9u, 0.00000000 },
+  { 0xCDDAu, 0.00000000 },
+  { 0xCDDBu, 0.00000000 },
+  { 0xCDDCu, 0.00000000 },
+  { 0xCDDDu, 0.00000000 },
+  { 0xCDDEu, 0.00000000 },
+  { 0xCDDFu, 0.00000000 },
+  { 0xCDE0u, 0.00000000 },
+  { 0xCDE1u, 0.00000000 },
+  { 0xCDE2u, 0.00000000 },
+  { 0xCDE3u, 0.00000000 },
+  { 0xCDE4u, 0.00000000 },
+  { 0xCDE5u, 0.00000000 },
+  { 0xCDE6u, 0.00000000 },
+  { 0xCDE7u, 0.00000000 },
+  { 0xCDE8u, 0.00040000 },
+  { 0xCDE9u, 0.00000000 },
+  { 0xCDEAu, 0.00000000 },
+  { 0xCDEBu, 0.00000000 },
+  { 0xCDECu, 0.00000000 },
+  { 0xCDEDu, 0.00000000 },
+  { 0xCDEEu, 0.00000000 },
+  { 0xCDEFu, 0.00000000 },
+  { 0xCDF0u, 0.00000000 },
+  { 0xCDF1u, 0.00000000 },
+  { 0xCDF2u, 0.00000000 },
+  { 0xCDF3u, 0.00000000 },
+  { 0xCDF4u, 0.00000000 },
+  { 0xCDF5u, 0.00000000 },
+  { 0xCDF6u, 0.00000000 },
+  { 0xCDF7u, 0.00000000 },
+  { 0xCDF8u, 0.00000000 },
+  { 0xCDF9u, 0.00000000 },
+  { 0xCDFAu, 0.00000000 },
+  { 0xCDFBu, 0.00000000 },
+  { 0xCDFCu, 0.00000000 },
+  { 0xCDFDu, 0.00000000 },
+  { 0xCDFEu, 0.00000000 },
+  { 0xCDFFu, 0.00000000 },
+  { 0xCE00u, 0.00000000 },
+  { 0xCE01u, 0.00000000 },
+  { 0xCE02u, 0.00000000 },
+  { 0xCE03u, 0.00000000 },
+  { 0xCE04u, 0.00000000 },
+  { 0xCE05u, 0.00000000 },
+  { 0xCE06u, 0.00000000 },
+  { 0xCE07u, 0.00000000 },
+  { 0xCE08u, 0.00000000 },
+  { 0xCE09u, 0.00000000 },
+  { 0xCE0Au, 0.00000000 },
+  { 0xCE0Bu, 0.00000000 },
+  { 0xCE0Cu, 0.00000000 },
+  { 0xCE0Du, 0.00000000 },
+  { 0xCE0Eu, 0.00000000 },
+  { 0xCE0Fu, 0.00000000 },
+  { 0xCE10u, 0.00000000 },
+  { 0xCE11u, 0.00000000 },
+  { 0xCE12u, 0.00000000 },
+  { 0xCE13u, 0.00000000 },
+  { 0xCE14u, 0.00000000 },
+  { 0xCE15u, 0.00000000 },
+  { 0xCE16u, 0.00000000 },
+  { 0xCE17u, 0.00000000 },
+  { 0xCE18u, 0.00000000 },
+  { 0xCE19u, 0.00000000 },
+  { 0xCE1Au, 0.00000000 },
+  { 0xCE1Bu, 0.00000000 },
+  { 0xCE1Cu, 0.00000000 },
+  { 0xCE1Du, 0.00000000 },
+  { 0xCE1Eu, 0.00000000 },
+  { 0xCE1Fu, 0.00000000 },
+  { 0xCE20u, 0.00040000 },
+  { 0xCE21u, 0.00040000 },
+  { 0xCE22u, 0.00000000 },
+  { 0xCE23u, 0.00000000 },
+  { 0xCE24u, 0.00000000 },
+  { 0xCE25u, 0.00000000 },
+  { 0xCE26u, 0.00000000 },
+  { 0xCE27u, 0.00000000 },
+  { 0xCE28u, 0.00000000 },
+  { 0xCE29u, 0.00000000 },
+  { 0xCE2Au, 0.00000000 },
+  { 0xCE2Bu, 0.00000000 },
+  { 0xCE2Cu, 0.00000000 },
+  { 0xCE2Du, 0.00000000 },
+  { 0xCE2Eu, 0.00000000 },
+  { 0xCE2Fu, 0.00000000 },
+  { 0xCE30u, 0.00000000 },
+  { 0xCE31u, 0.00000000 },
+  { 0xCE32u, 0.00000000 },
+  { 0xCE33u, 0.00000000 },
+  { 0xCE34u, 0.00000000 },
+  { 0xCE35u, 0.00020000 },
+  { 0xCE36u, 0.00000000 },
+  { 0xCE37u, 0.00000000 },
+  { 0xCE38u, 0.00000000 },
+  { 0xCE39u, 0.00000000 },
+  { 0xCE3Au, 0.00000000 },
+  { 0xCE3Bu, 0.00000000 },
+  { 0xCE3Cu, 0.00000000 },
+  { 0xCE3Du, 0.00000000 },
+  { 0xCE3Eu, 0.00000000 },
+  { 0xCE3Fu, 0.00000000 },
+  { 0xCE40u, 0.00000000 },
+  { 0xCE41u, 0.00000000 },
+  { 0xCE42u, 0.00000000 },
+  { 0xCE43u, 0.00000000 },
+  { 0xCE44u, 0.00000000 },
+  { 0xCE45u, 0.00000000 },
+  { 0xCE46u, 0.00000000 },
+  { 0xCE47u, 0.00000000 },
+  { 0xCE48u, 0.00000000 },
+  { 0xCE49u, 0.00000000 },
+  { 0xCE4Au, 0.00000000 },
+  { 0xCE4Bu, 0.00000000 },
+  { 0xCE4Cu, 0.00000000 },
+  { 0xCE4Du, 0.00000000 },
+  { 0xCE4Eu, 0.00000000 },
+  { 0xCE4Fu, 0.00000000 },
+  { 0xCE50u, 0.00000000 },
+  { 0xCE51u, 0.00000000 },
+  { 0xCE52u, 0.00000000 },
+  { 0xCE53u, 0.00000000 },
+  { 0xCE54u, 0.00000000 },
+  { 0xCE55u, 0.00000000 },
+  { 0xCE56u, 0.00000000 },
+  { 0xCE57u, 0.00000000 },
+  { 0xCE58u, 0.00280000 },
+  { 0xCE59u, 0.00020000 },
+  { 0xCE5Au, 0.00000000 },
+  { 0xCE5Bu, 0.00000000 },
+  { 0xCE5Cu, 0.00050000 },
+  { 0xCE5Du, 0.00000000 },
+  { 0xCE5Eu, 0.00000000 },
+  { 0xCE5Fu, 0.00000000 },
+  { 0xCE60u, 0.00010000 },
+  { 0xCE61u, 0.00000000 },
+  { 0xCE62u, 0.00000000 },
+  { 0xCE63u, 0.00000000 },
+  { 0xCE64u, 0.00000000 },
+  { 0xCE65u, 0.00000000 },
+  { 0xCE66u, 0.00000000 },
+  { 0xCE67u, 0.00000000 },
+  { 0xCE68u, 0.00030000 },
+  { 0xCE69u, 0.00000000 },
+  { 0xCE6Au, 0.00000000 },
+  { 0xCE6Bu, 0.00000000 },
+  { 0xCE6Cu, 0.00000000 },
+  { 0xCE6Du, 0.00040000 },
+  { 0xCE6Eu, 0.00000000 },
+  { 0xCE6Fu, 0.00000000 },
+  { 0xCE70u, 0.00000000 },
+  { 0xCE71u, 0.00000000 },
+  { 0xCE72u, 0.00000000 },
+  { 0xCE73u, 0.00000000 },
+  { 0xCE74u, 0.00190000 },
+  { 0xCE75u, 0.00000000 },
+  { 0xCE76u, 0.00000000 },
+  { 0xCE77u, 0.00000000 },
+  { 0xCE78u, 0.00020000 },
+  { 0xCE79u, 0.00000000 },
+  { 0xCE7Au, 0.00000000 },
+  { 0xCE7Bu, 0.00000000 },
+  { 0xCE7Cu, 0.00020000 },
+  { 0xCE7Du, 0.00000000 },
+  { 0xCE7Eu, 0.00000000 },
+  { 0xCE7Fu, 0.00000000 },
+  { 0xCE80u, 0.00000000 },
+  { 0xCE81u, 0.00000000 },
+  { 0xCE82u, 0.00000000 },
+  { 0xCE83u, 0.00000000 },
+  { 0xCE84u, 0.00000000 },
+  { 0xCE85u, 0.00000000 },
+  { 0xCE86u, 0.00000000 },
+  { 0xCE87u, 0.00000000 },
+  { 0xCE88u, 0.00000000 },
+  { 0xCE89u, 0.00000000 },
+  { 0xCE8Au, 0.00000000 },
+  { 0xCE8Bu, 0.00000000 },
+  { 0xCE8Cu, 0.00000000 },
+  { 0xCE8Du, 0.00000000 },
+  { 0xCE8Eu, 0.00000000 },
+  { 0xCE8Fu, 0.00000000 },
+  { 0xCE90u, 0.00020000 },
+  { 0xCE91u, 0.00000000 },
+  { 0xCE92u, 0.00000000 },
+  { 0xCE93u, 0.00000000 },
+  { 0xCE94u, 0.00000000 },
+  { 0xCE95u, 0.00000000 },
+  { 0xCE96u, 0.00000000 },
+  { 0xCE97u, 0.00000000 },
+  { 0xCE98u, 0.00000000 },
+  { 0xCE99u, 0.00000000 },
+  { 0xCE9Au, 0.00000000 },
+  { 0xCE9Bu, 0.00000000 },
+  { 0xCE9Cu, 0.00000000 },
+  { 0xCE9Du, 0.00000000 },
+  { 0xCE9Eu, 0.00000000 },
+  { 0xCE9Fu, 0.00000000 },
+  { 0xCEA0u, 0.00010000 },
+  { 0xCEA1u, 0.00000000 },
+  { 0xCEA2u, 0.00000000 },
+  { 0xCEA3u, 0.00000000 },
+  { 0xCEA4u, 0.00000000 },
+  { 0xCEA5u, 0.00000000 },
+  { 0xCEA6u, 0.00000000 },
+  { 0xCEA7u, 0.00000000 },
+  { 0xCEA8u, 0.00000000 },
+  { 0xCEA9u, 0.00000000 },
+  { 0xCEAAu, 0.00000000 },
+  { 0xCEABu, 0.00000000 },
+  { 0xCEACu, 0.00000000 },
+  { 0xCEADu, 0.00000000 },
+  { 0xCEAEu, 0.00000000 },
+  { 0xCEAFu, 0.00000000 },
+  { 0xCEB0u, 0.00000000 },
+  { 0xCEB1u, 0.00000000 },
+  { 0xCEB2u, 0.00000000 },
+  { 0xCEB3u, 0.00000000 },
+  { 0xCEB4u, 0.00000000 },
+  { 0xCEB5u, 0.00000000 },
+  { 0xCEB6u, 0.00000000 },
+  { 0xCEB7u, 0.00000000 },
+  { 0xCEB8u, 0.00000000 },
+  { 0xCEB9u, 0.00000000 },
+  { 0xCEBAu, 0.00000000 },
+  { 0xCEBBu, 0.00000000 },
+  { 0xCEBCu, 0.00000000 },
+  { 0xCEBDu, 0.00000000 },
+  { 0xCEBEu, 0.00000000 },
+  { 0xCEBFu, 0.00000000 },
+  { 0xCEC0u, 0.00000000 },
+  { 0xCEC1u, 0.00000000 },
+  { 0xCEC2u, 0.00000000 },
+  { 0xCEC3u, 0.00000000 },
+  { 0xCEC4u, 0.00000000 },
+  { 0xCEC5u, 0.00000000 },
+  { 0xCEC6u, 0.00000000 },
+  { 0xCEC7u, 0.00000000 },
+  { 0xCEC8u, 0.00000000 },
+  { 0xCEC9u, 0.00000000 },
+  { 0xCECAu, 0.00000000 },
+  { 0xCECBu, 0.00000000 },
+  { 0xCECCu, 0.00000000 },
+  { 0xCECDu, 0.00000000 },
+  { 0xCECEu, 0.00000000 },
+  { 0xCECFu, 0.00000000 },
+  { 0xCED0u, 0.00000000 },
+  { 0xCED1u, 0.00000000 },
+  { 0xCED2u, 0.00000000 },
+  { 0xCED3u, 0.00000000 },
+  { 0xCED4u, 0.00000000 },
+  { 0xCED5u, 0.00000000 },
+  { 0xCED6u, 0.00000000 },
+  { 0xCED7u, 0.00000000 },
+  { 0xCED8u, 0.00000000 },
+  { 0xCED9u, 0.00000000 },
+  { 0xCEDAu, 0.00000000 },
+  { 0xCEDBu, 0.00000000 },
+  { 0xCEDCu, 0.00000000 },
+  { 0xCEDDu, 0.00000000 },
+  { 0xCEDEu, 0.00000000 },
+  { 0xCEDFu, 0.00000000 },
+  { 0xCEE0u, 0.00000000 },
+  { 0xCEE1u, 0.00000000 },
+  { 0xCEE2u, 0.00000000 },
+  { 0xCEE3u, 0.00000000 },
+  { 0xCEE4u, 0.00030000 },
+  { 0xCEE5u, 0.00000000 },
+  { 0xCEE6u, 0.00000000 },
+  { 0xCEE7u, 0.00000000 },
+  { 0xCEE8u, 0.00010000 },
+  { 0xCEE9u, 0.00000000 },
+  { 0xCEEAu, 0.00000000 },
+  { 0xCEEBu, 0.00000000 },
+  { 0xCEECu, 0.00010000 },
+  { 0xCEEDu, 0.00000000 },
+  { 0xCEEEu, 0.00000000 },
+  { 0xCEEFu, 0.00000000 },
+  { 0xCEF0u, 0.00000000 },
+  { 0xCEF1u, 0.00000000 },
+  { 0xCEF2u, 0.00000000 },
+  { 0xCEF3u, 0.00000000 },
+  { 0xCEF4u, 0.00020000 },
+  { 0xCEF5u, 0.00020000 },
+  { 0xCEF6u, 0.00000000 },
+  { 0xCEF7u, 0.00000000 },
+  { 0xCEF8u, 0.00000000 },
+  { 0xCEF9u, 0.00000000 },
+  { 0xCEFAu, 0.00000000 },
+  { 0xCEFBu, 0.00000000 },
+  { 0xCEFCu, 0.00000000 },
+  { 0xCEFDu, 0.00000000 },
+  { 0xCEFEu, 0.00000000 },
+  { 0xCEFFu, 0.00000000 },
+  { 0xCF00u, 0.00050000 },
+  { 0xCF01u, 0.00000000 },
+  { 0xCF02u, 0.00000000 },
+  { 0xCF03u, 0.00000000 },
+  { 0xCF04u, 0.00000000 },
+  { 0xCF05u, 0.00000000 },
+  { 0xCF06u, 0.00000000 },
+  { 0xCF07u, 0.00000000 },
+  { 0xCF08u, 0.00000000 },
+  { 0xCF09u, 0.00000000 },
+  { 0xCF0Au, 0.00000000 },
+  { 0xCF0Bu, 0.00000000 },
+  { 0xCF0Cu, 0.00000000 },
+  { 0xCF0Du, 0.00000000 },
+  { 0xCF0Eu, 0.00000000 },
+  { 0xCF0Fu, 0.00000000 },
+  { 0xCF10u, 0.00000000 },
+  { 0xCF11u, 0.00000000 },
+  { 0xCF12u, 0.00000000 },
+  { 0xCF13u, 0.00010000 },
+  { 0xCF14u, 0.00000000 },
+  { 0xCF15u, 0.00000000 },
+  { 0xCF16u, 0.00000000 },
+  { 0xCF17u, 0.00000000 },
+  { 0xCF18u, 0.00000000 },
+  { 0xCF19u, 0.00000000 },
+  { 0xCF1Au, 0.00000000 },
+  { 0xCF1Bu, 0.00000000 },
+  { 0xCF1Cu, 0.00010000 },
+  { 0xCF1Du, 0.00000000 },
+  { 0xCF1Eu, 0.00000000 },
+  { 0xCF1Fu, 0.00000000 },
+  { 0xCF20u, 0.00000000 },
+  { 0xCF21u, 0.00000000 },
+  { 0xCF22u, 0.00000000 },
+  { 0xCF23u, 0.00000000 },
+  { 0xCF24u, 0.00000000 },
+  { 0xCF25u, 0.00000000 },
+  { 0xCF26u, 0.00000000 },
+  { 0xCF27u, 0.00000000 },
+  { 0xCF28u, 0.00000000 },
+  { 0xCF29u, 0.00000000 },
+  { 0xCF2Au, 0.00000000 },
+  { 0xCF2Bu, 0.00000000 },
+  { 0xCF2Cu, 0.00000000 },
+  { 0xCF2Du, 0.00000000 },
+  { 0xCF2Eu, 0.00000000 },
+  { 0xCF2Fu, 0.00000000 },
+  { 0xCF30u, 0.00020000 },
+  { 0xCF31u, 0.00000000 },
+  { 0xCF32u, 0.00000000 },
+  { 0xCF33u, 0.00000000 },
+  { 0xCF34u, 0.00000000 },
+  { 0xCF35u, 0.00000000 },
+  { 0xCF36u, 0.00000000 },
+  { 0xCF37u, 0.00000000 },
+  { 0xCF38u, 0.00000000 },
+  { 0xCF39u, 0.00000000 },
+  { 0xCF3Au, 0.00000000 },
+  { 0xCF3Bu, 0.00000000 },
+  { 0xCF3Cu, 0.00000000 },
+  { 0xCF3Du, 0.00000000 },
+  { 0xCF3Eu, 0.00000000 },
+  { 0xCF3Fu, 0.00000000 },
+  { 0xCF40u, 0.00000000 },
+  { 0xCF41u, 0.00000000 },
+  { 0xCF42u, 0.00000000 },
+  { 0xCF43u, 0.00000000 },
+  { 0xCF44u, 0.00000000 },
+  { 0xCF45u, 0.00000000 },
+  { 0xCF46u, 0.00000000 },
+  { 0xCF47u, 0.00000000 },
+  { 0xCF48u, 0.00000000 },
+  { 0xCF49u, 0.00000000 },
+  { 0xCF4Au, 0.00000000 },
+  { 0xCF4Bu, 0.00000000 },
+  { 0xCF4Cu, 0.00000000 },
+  { 0xCF4Du, 0.00000000 },
+  { 0xCF4Eu, 0.00000000 },
+  { 0xCF4Fu, 0.00000000 },
+  { 0xCF50u, 0.00000000 },
+  { 0xCF51u, 0.00000000 },
+  { 0xCF52u, 0.00000000 },
+  { 0xCF53u, 0.00000000 },
+  { 0xCF54u, 0.00120000 },
+  { 0xCF55u, 0.00000000 },
+  { 0xCF56u, 0.00000000 },
+  { 0xCF57u, 0.00000000 },
+  { 0xCF58u, 0.00020000 },
+  { 0xCF59u, 0.00000000 },
+  { 0xCF5Au, 0.00000000 },
+  { 0xCF5Bu, 0.00000000 },
+  { 0xCF5Cu, 0.00020000 },
+  { 0xCF5Du, 0.00000000 },
+  { 0xCF5Eu, 0.00000000 },
+  { 0xCF5Fu, 0.00000000 },
+  { 0xCF60u, 0.00000000 },
+  { 0xCF61u, 0.00000000 },
+  { 0xCF62u, 0.00000000 },
+  { 0xCF63u, 0.00000000 },
+  { 0xCF64u, 0.00000000 },
+  { 0xCF65u, 0.00000000 },
+  { 0xCF66u, 0.00000000 },
+  { 0xCF67u, 0.00000000 },
+  { 0xCF68u, 0.00000000 },
+  { 0xCF69u, 0.00010000 },
+  { 0xCF6Au, 0.00000000 },
+  { 0xCF6Bu, 0.00000000 },
+  { 0xCF6Cu, 0.00000000 },
+  { 0xCF6Du, 0.00000000 },
+  { 0xCF6Eu, 0.00000000 },
+  { 0xCF6Fu, 0.00000000 },
+  { 0xCF70u, 0.00000000 },
+  { 0xCF71u, 0.00000000 },
+  { 0xCF72u, 0.00000000 },
+  { 0xCF73u, 0.00000000 },
+  { 0xCF74u, 0.00000000 },
+  { 0xCF75u, 0.00000000 },
+  { 0xCF76u, 0.00000000 },
+  { 0xCF77u, 0.00000000 },
+  { 0xCF78u, 0.00000000 },
+  { 0xCF79u, 0.00000000 },
+  { 0xCF7Au, 0.00000000 },
+  { 0xCF7Bu, 0.00000000 },
+  { 0xCF7Cu, 0.00000000 },
+  { 0xCF7Du, 0.00000000 },
+  { 0xCF7Eu, 0.00000000 },
+  { 0xCF7Fu, 0.00000000 },
+  { 0xCF80u, 0.00000000 },
+  { 0xCF81u, 0.00000000 },
+  { 0xCF82u, 0.00000000 },
+  { 0xCF83u, 0.00000000 },
+  { 0xCF84u, 0.00000000 },
+  { 0xCF85u, 0.00000000 },
+  { 0xCF86u, 0.00000000 },
+  { 0xCF87u, 0.00000000 },
+  { 0xCF88u, 0.00000000 },
+  { 0xCF89u, 0.00000000 },
+  { 0xCF8Au, 0.00000000 },
+  { 0xCF8Bu, 0.00000000 },
+  { 0xCF8Cu, 0.00000000 },
+  { 0xCF8Du, 0.00000000 },
+  { 0xCF8Eu, 0.00000000 },
+  { 0xCF8Fu, 0.00000000 },
+  { 0xCF90u, 0.00000000 },
+  { 0xCF91u, 0.00000000 },
+  { 0xCF92u, 0.00000000 },
+  { 0xCF93u, 0.00000000 },
+  { 0xCF94u, 0.00000000 },
+  { 0xCF95u, 0.00000000 },
+  { 0xCF96u, 0.00000000 },
+  { 0xCF97u, 0.00000000 },
+  { 0xCF98u, 0.00000000 },
+  { 0xCF99u, 0.00000000 },
+  { 0xCF9Au, 0.00000000 },
+  { 0xCF9Bu, 0.00000000 },
+  { 0xCF9Cu, 0.00000000 },
+  { 0xCF9Du, 0.00000000 },
+  { 0xCF9Eu, 0.00000000 },
+  { 0xCF9Fu, 0.00000000 },
+  { 0xCFA0u, 0.00000000 },
+  { 0xCFA1u, 0.00000000 },
+  { 0xCFA2u, 0.00000000 },
+  { 0xCFA3u, 0.00000000 },
+  { 0xCFA4u, 0.00000000 },
+  { 0xCFA5u, 0.00000000 },
+  { 0xCFA6u, 0.00000000 },
+  { 0xCFA7u, 0.00000000 },
+  { 0xCFA8u, 0.00000000 },
+  { 0xCFA9u, 0.00000000 },
+  { 0xCFAAu, 0.00000000 },
+  { 0xCFABu, 0.00000000 },
+  { 0xCFACu, 0.00000000 },
+  { 0xCFADu, 0.00000000 },
+  { 0xCFAEu, 0.00000000 },
+  { 0xCFAFu, 0.00000000 },
+  { 0xCFB0u, 0.00000000 },
+  { 0xCFB1u, 0.00000000 },
+  { 0xCFB2u, 0.00000000 },
+  { 0xCFB3u, 0.00000000 },
+  { 0xCFB4u, 0.00000000 },
+  { 0xCFB5u, 0.00000000 },
+  { 0xCFB6u, 0.00000000 },
+  { 0xCFB7u, 0.00000000 },
+  { 0xCFB8u, 0.00000000 },
+  { 0xCFB9u, 0.00000000 },
+  { 0xCFBAu, 0.00000000 },
+  { 0xCFBBu, 0.00000000 },
+  { 0xCFBCu, 0.00000000 },
+  { 0xCFBDu, 0.00000000 },
+  { 0xCFBEu, 0.00000000 },
+  { 0xCFBFu, 0.00000000 },
+  { 0xCFC0u, 0.00000000 },
+  { 0xCFC1u, 0.00000000 },
+  { 0xCFC2u, 0.00000000 },
+  { 0xCFC3u, 0.00000000 },
+  { 0xCFC4u, 0.00010000 },
+  { 0xCFC5u, 0.00000000 },
+  { 0xCFC6u, 0.00000000 },
+  { 0xCFC7u, 0.00000000 },
+  { 0xCFC8u, 0.00000000 },
+  { 0xCFC9u, 0.00000000 },
+  { 0xCFCAu, 0.00000000 },
+  { 0xCFCBu, 0.00000000 },
+  { 0xCFCCu, 0.00000000 },
+  { 0xCFCDu, 0.00000000 },
+  { 0xCFCEu, 0.00000000 },
+  { 0xCFCFu, 0.00000000 },
+  { 0xCFD0u, 0.00000000 },
+  { 0xCFD1u, 0.00000000 },
+  { 0xCFD2u, 0.00000000 },
+  { 0xCFD3u, 0.00000000 },
+  { 0xCFD4u, 0.00000000 },
+  { 0xCFD5u, 0.00000000 },
+  { 0xCFD6u, 0.00000000 },
+  { 0xCFD7u, 0.00000000 },
+  { 0xCFD8u, 0.00000000 },
+  { 0xCFD9u, 0.00000000 },
+  { 0xCFDAu, 0.00000000 },
+  { 0xCFDBu, 0.00000000 },
+  { 0xCFDCu, 0.00000000 },
+  { 0xCFDDu, 0.00000000 },
+  { 0xCFDEu, 0.00000000 },
+  { 0xCFDFu, 0.00000000 },
+  { 0xCFE0u, 0.00060000 },
+  { 0xCFE1u, 0.00000000 },
+  { 0xCFE2u, 0.00000000 },
+  { 0xCFE3u, 0.00000000 },
+  { 0xCFE4u, 0.00000000 },
+  { 0xCFE5u, 0.00000000 },
+  { 0xCFE6u, 0.00000000 },
+  { 0xCFE7u, 0.00000000 },
+  { 0xCFE8u, 0.00000000 },
+  { 0xCFE9u, 0.00000000 },
+  { 0xCFEAu, 0.00000000 },
+  { 0xCFEBu, 0.00000000 },
+  { 0xCFECu, 0.00000000 },
+  { 0xCFEDu, 0.00000000 },
+  { 0xCFEEu, 0.00000000 },
+  { 0xCFEFu, 0.00000000 },
+  { 0xCFF0u, 0.00000000 },
+  { 0xCFF1u, 0.00000000 },
+  { 0xCFF2u, 0.00000000 },
+  { 0xCFF3u, 0.00000000 },
+  { 0xCFF4u, 0.00000000 },
+  { 0xCFF5u, 0.00000000 },
+  { 0xCFF6u, 0.00000000 },
+  { 0xCFF7u, 0.00000000 },
+  { 0xCFF8u, 0.00000000 },
+  { 0xCFF9u, 0.00000000 },
+  { 0xCFFAu, 0.00000000 },
+  { 0xCFFBu, 0.00000000 },
+  { 0xCFFCu, 0.00000000 },
+  { 0xCFFDu, 0.00000000 },
+  { 0xCFFEu, 0.00000000 },
+  { 0xCFFFu, 0.00000000 },
+  { 0xD000u, 0.00000000 },
+  { 0xD001u, 0.00000000 },
+  { 0xD002u, 0.00000000 },
+  { 0xD003u, 0.00000000 },
+  { 0xD004u, 0.00000000 },
+  { 0xD005u, 0.00000000 },
+  { 0xD006u, 0.00000000 },
+  { 0xD007u, 0.00000000 },
+  { 0xD008u, 0.00000000 },
+  { 0xD009u, 0.00000000 },
+  { 0xD00Au, 0.00000000 },
+  { 0xD00Bu, 0.00000000 },
+  { 0xD00Cu, 0.00000000 },
+  { 0xD00Du, 0.00000000 },
+  { 0xD00Eu, 0.00000000 },
+  { 0xD00Fu, 0.00000000 },
+  { 0xD010u, 0.00000000 },
+  { 0xD011u, 0.00000000 },
+  { 0xD012u, 0.00000000 },
+  { 0xD013u, 0.00000000 },
+  { 0xD014u, 0.00000000 },
+  { 0xD015u, 0.00000000 },
+  { 0xD016u, 0.00000000 },
+  { 0xD017u, 0.00000000 },
+  { 0xD018u, 0.00000000 },
+  { 0xD019u, 0.00000000 },
+  { 0xD01Au, 0.00000000 },
+  { 0xD01Bu, 0.00000000 },
+  { 0xD01Cu, 0.00000000 },
+  { 0xD01Du, 0.00000000 },
+  { 0xD01Eu, 0.00000000 },
+  { 0xD01Fu, 0.00000000 },
+  { 0xD020u, 0.00000000 },
+  { 0xD021u, 0.00000000 },
+  { 0xD022u, 0.00000000 },
+  { 0xD023u, 0.00000000 },
+  { 0xD024u, 0.00000000 },
+  { 0xD025u, 0.00000000 },
+  { 0xD026u, 0.00000000 },
+  { 0xD027u, 0.00000000 },
+  { 0xD028u, 0.00000000 },
+  { 0xD029u, 0.00000000 },
+  { 0xD02Au, 0.00000000 },
+  { 0xD02Bu, 0.00000000 },
+  { 0xD02Cu, 0.00000000 },
+  { 0xD02Du, 0.00000000 },
+  { 0xD02Eu, 0.00000000 },
+  { 0xD02Fu, 0.00000000 },
+  { 0xD030u, 0.00000000 },
+  { 0xD031u, 0.00000000 },
+  { 0xD032u, 0.00000000 },
+  { 0xD033u, 0.00000000 },
+  { 0xD034u, 0.00000000 },
+  { 0xD035u, 0.00000000 },
+  { 0xD036u, 0.00000000 },
+  { 0xD037u, 0.00000000 },
+  { 0xD038u, 0.00000000 },
+  { 0xD039u, 0.00000000 },
+  { 0xD03Au, 0.00000000 },
+  { 0xD03Bu, 0.00000000 },
+  { 0xD03Cu, 0.00000000 },
+  { 0xD03Du, 0.00000000 },
+  { 0xD03Eu, 0.00000000 },
+  { 0xD03Fu, 0.00000000 },
+  { 0xD040u, 0.00000000 },
+  { 0xD041u, 0.00000000 },
+  { 0xD042u, 0.00000000 },
+  { 0xD043u, 0.00000000 },
+  { 0xD044u, 0.00000000 },
+  { 0xD045u, 0.00000000 },
+  { 0xD046u, 0.00000000 },
+  { 0xD047u, 0.00000000 },
+  { 0xD048u, 0.00000000 },
+  { 0xD049u, 0.00000000 },
+  { 0xD04Au, 0.00000000 },
+  { 0xD04Bu, 0.00000000 },
+  { 0xD04Cu, 0.00000000 },
+  { 0xD04Du, 0.00000000 },
+  { 0xD04Eu, 0.00000000 },
+  { 0xD04Fu, 0.00000000 },
+  { 0xD050u, 0.00010000 },
+  { 0xD051u, 0.00000000 },
+  { 0xD052u, 0.00000000 },
+  { 0xD053u, 0.00000000 },
+  { 0xD054u, 0.00000000 },
+  { 0xD055u, 0.00000000 },
+  { 0xD056u, 0.00000000 },
+  { 0xD057u, 0.00000000 },
+  { 0xD058u, 0.00000000 },
+  { 0xD059u, 0.00000000 },
+  { 0xD05Au, 0.00000000 },
+  { 0xD05Bu, 0.00000000 },
+  { 0xD05Cu, 0.00000000 },
+  { 0xD05Du, 0.00000000 },
+  { 0xD05Eu, 0.00000000 },
+  { 0xD05Fu, 0.00000000 },
+  { 0xD060u, 0.00000000 },
+  { 0xD061u, 0.00000000 },
+  { 0xD062u, 0.00000000 },
+  { 0xD063u, 0.00000000 },
+  { 0xD064u, 0.00000000 },
+  { 0xD065u, 0.00000000 },
+  { 0xD066u, 0.00000000 },
+  { 0xD067u, 0.00000000 },
+  { 0xD068u, 0.00000000 },
+  { 0xD069u, 0.00000000 },
+  { 0xD06Au, 0.00000000 },
+  { 0xD06Bu, 0.00000000 },
+  { 0xD06Cu, 0.00180000 },
+  { 0xD06Du, 0.00000000 },
+  { 0xD06Eu, 0.00000000 },
+  { 0xD06Fu, 0.00000000 },
+  { 0xD070u, 0.00030000 },
+  { 0xD071u, 0.00000000 },
+  { 0xD072u, 0.00000000 },
+  { 0xD073u, 0.00000000 },
+  { 0xD074u, 0.00050000 },
+  { 0xD075u, 0.00000000 },
+  { 0xD076u, 0.00000000 },
+  { 0xD077u, 0.00000000 },
+  { 0xD078u, 0.00000000 },
+  { 0xD079u, 0.00000000 },
+  { 0xD07Au, 0.00000000 },
+  { 0xD07Bu, 0.00000000 },
+  { 0xD07Cu, 0.00010000 },
+  { 0xD07Du, 0.00000000 },
+  { 0xD07Eu, 0.00000000 },
+  { 0xD07Fu, 0.00000000 },
+  { 0xD080u, 0.00000000 },
+  { 0xD081u, 0.00000000 },
+  { 0xD082u, 0.00000000 },
+  { 0xD083u, 0.00000000 },
+  { 0xD084u, 0.00000000 },
+  { 0xD085u, 0.00000000 },
+  { 0xD086u, 0.00000000 },
+  { 0xD087u, 0.00000000 },
+  { 0xD088u, 0.00000000 },
+  { 0xD089u, 0.00000000 },
+  { 0xD08Au, 0.00000000 },
+  { 0xD08Bu, 0.00000000 },
+  { 0xD08Cu, 0.00000000 },
+  { 0xD08Du, 0.00000000 },
+  { 0xD08Eu, 0.00000000 },
+  { 0xD08Fu, 0.00000000 },
+  { 0xD090u, 0.00000000 },
+  { 0xD091u, 0.00000000 },
+  { 0xD092u, 0.00000000 },
+  { 0xD093u, 0.00000000 },
+  { 0xD094u, 0.00000000 },
+  { 0xD095u, 0.00000000 },
+  { 0xD096u, 0.00000000 },
+  { 0xD097u, 0.00000000 },
+  { 0xD098u, 0.00000000 },
+  { 0xD099u, 0.00000000 },
+  { 0xD09Au, 0.00000000 },
+  { 0xD09Bu, 0.00000000 },
+  { 0xD09Cu, 0.00000000 },
+  { 0xD09Du, 0.00000000 },
+  { 0xD09Eu, 0.00000000 },
+  { 0xD09Fu, 0.00000000 },
+  { 0xD0A0u, 0.00000000 },
+  { 0xD0A1u, 0.00000000 },
+  { 0xD0A2u, 0.00000000 },
+  { 0xD0A3u, 0.00000000 },
+  { 0xD0A4u, 0.00130000 },
+  { 0xD0A5u, 0.00000000 },
+  { 0xD0A6u, 0.00000000 },
+  { 0xD0A7u, 0.00000000 },
+  { 0xD0A8u, 0.00020000 },
+  { 0xD0A9u, 0.00000000 },
+  { 0xD0AAu, 0.00000000 },
+  { 0xD0ABu, 0.00000000 },
+  { 0xD0ACu, 0.00010000 },
+  { 0xD0ADu, 0.00000000 },
+  { 0xD0AEu, 0.00000000 },
+  { 0xD0AFu, 0.00000000 },
+  { 0xD0B0u, 0.00000000 },
+  { 0xD0B1u, 0.00000000 },
+  { 0xD0B2u, 0.00000000 },
+  { 0xD0B3u, 0.00000000 },
+  { 0xD0B4u, 0.00000000 },
+  { 0xD0B5u, 0.00000000 },
+  { 0xD0B6u, 0.00000000 },
+  { 0xD0B7u, 0.00000000 },
+  { 0xD0B8u, 0.00000000 },
+  { 0xD0B9u, 0.00010000 },
+  { 0xD0BAu, 0.00000000 },
+  { 0xD0BBu, 0.00000000 },
+  { 0xD0BCu, 0.00000000 },
+  { 0xD0BDu, 0.00000000 },
+  { 0xD0BEu, 0.00000000 },
+  { 0xD0BFu, 0.00000000 },
+  { 0xD0C0u, 0.00220000 },
+  { 0xD0C1u, 0.00010000 },
+  { 0xD0C2u, 0.00000000 },
+  { 0xD0C3u, 0.00000000 },
+  { 0xD0C4u, 0.00050000 },
+  { 0xD0C5u, 0.00000000 },
+  { 0xD0C6u, 0.00000000 },
+  { 0xD0C7u, 0.00000000 },
+  { 0xD0C8u, 0.00050000 },
+  { 0xD0C9u, 0.00000000 },
+  { 0xD0CAu, 0.00000000 },
+  { 0xD0CBu, 0.00000000 },
+  { 0xD0CCu, 0.00000000 },
+  { 0xD0CDu, 0.00000000 },
+  { 0xD0CEu, 0.00000000 },
+  { 0xD0CFu, 0.00000000 },
+  { 0xD0D0u, 0.00010000 },
+  { 0xD0D1u, 0.00010000 },
+  { 0xD0D2u, 0.00000000 },
+  { 0xD0D3u, 0.00000000 },
+  { 0xD0D4u, 0.00000000 },
+  { 0xD0D5u, 0.00010000 },
+  { 0xD0D6u, 0.00000000 },
+  { 0xD0D7u, 0.00000000 },
+  { 0xD0D8u, 0.00000000 },
+  { 0xD0D9u, 0.00000000 },
+  { 0xD0DAu, 0.00000000 },
+  { 0xD0DBu, 0.00000000 },
+  { 0xD0DCu, 0.00130000 },
+  { 0xD0DDu, 0.00030000 },
+  { 0xD0DEu, 0.00000000 },
+  { 0xD0DFu, 0.00000000 },
+  { 0xD0E0u, 0.00000000 },
+  { 0xD0E1u, 0.00000000 },
+  { 0xD0E2u, 0.00000000 },
+  { 0xD0E3u, 0.00000000 },
+  { 0xD0E4u, 0.00000000 },
+  { 0xD0E5u, 0.00000000 },
+  { 0xD0E6u, 0.00000000 },
+  { 0xD0E7u, 0.00000000 },
+  { 0xD0E8u, 0.00000000 },
+  { 0xD0E9u, 0.00000000 },
+  { 0xD0EAu, 0.00000000 },
+  { 0xD0EBu, 0.00000000 },
+  { 0xD0ECu, 0.00000000 },
+  { 0xD0EDu, 0.00000000 },
+  { 0xD0EEu, 0.00000000 },
+  { 0xD0EFu, 0.00000000 },
+  { 0xD0F0u, 0.00000000 },
+  { 0xD0F1u, 0.00000000 },
+  { 0xD0F2u, 0.00000000 },
+  { 0xD0F3u, 0.00000000 },
+  { 0xD0F4u, 0.00000000 },
+  { 0xD0F5u, 0.00000000 },
+  { 0xD0F6u, 0.00000000 },
+  { 0xD0F7u, 0.00000000 },
+  { 0xD0F8u, 0.00000000 },
+  { 0xD0F9u, 0.00000000 },
+  { 0xD0FAu, 0.00000000 },
+  { 0xD0FBu, 0.00000000 },
+  { 0xD0FCu, 0.00000000 },
+  { 0xD0FDu, 0.00000000 },
+  { 0xD0FEu, 0.00000000 },
+  { 0xD0FFu, 0.00000000 },
+  { 0xD100u, 0.00000000 },
+  { 0xD101u, 0.00000000 },
+  { 0xD102u, 0.00000000 },
+  { 0xD103u, 0.00000000 },
+  { 0xD104u, 0.00000000 },
+  { 0xD105u, 0.00000000 },
+  { 0xD106u, 0.00000000 },
+  { 0xD107u, 0.00000000 },
+  { 0xD108u, 0.00000000 },
+  { 0xD109u, 0.00000000 },
+  { 0xD10Au, 0.00000000 },
+  { 0xD10Bu, 0.00000000 },
+  { 0xD10Cu, 0.00000000 },
+  { 0xD10Du, 0.00000000 },
+  { 0xD10Eu, 0.00000000 },
+  { 0xD10Fu, 0.00000000 },
+  { 0xD110u, 0.00000000 },
+  { 0xD111u, 0.00000000 },
+  { 0xD112u, 0.00000000 },
+  { 0xD113u, 0.00000000 },
+  { 0xD114u, 0.00000000 },
+  { 0xD115u, 0.00000000 },
+  { 0xD116u, 0.00000000 },
+  { 0xD117u, 0.00000000 },
+  { 0xD118u, 0.00000000 },
+  { 0xD119u, 0.00000000 },
+  { 0xD11Au, 0.00000000 },
+  { 0xD11Bu, 0.00000000 },
+  { 0xD11Cu, 0.00000000 },
+  { 0xD11Du, 0.00000000 },
+  { 0xD11Eu, 0.00000000 },
+  { 0xD11Fu, 0.00000000 },
+  { 0xD120u, 0.00000000 },
+  { 0xD121u, 0.00000000 },
+  { 0xD122u, 0.00000000 },
+  { 0xD123u, 0.00000000 },
+  { 0xD124u, 0.00000000 },
+  { 0xD125u, 0.00000000 },
+  { 0xD126u, 0.00000000 },
+  { 0xD127u, 0.00000000 },
+  { 0xD128u, 0.00000000 },
+  { 0xD129u, 0.00000000 },
+  { 0xD12Au, 0.00000000 },
+  { 0xD12Bu, 0.00000000 },
+  { 0xD12Cu, 0.00000000 },
+  { 0xD12Du, 0.00000000 },
+  { 0xD12Eu, 0.00000000 },
+  { 0xD12Fu, 0.00000000 },
+  { 0xD130u, 0.00270000 },
+  { 0xD131u, 0.00000000 },
+  { 0xD132u, 0.00000000 },
+  { 0xD133u, 0.00000000 },
+  { 0xD134u, 0.00020000 },
+  { 0xD135u, 0.00000000 },
+  { 0xD136u, 0.00000000 },
+  { 0xD137u, 0.00000000 },
+  { 0xD138u, 0.00010000 },
+  { 0xD139u, 0.00000000 },
+  { 0xD13Au, 0.00000000 },
+  { 0xD13Bu, 0.00000000 },
+  { 0xD13Cu, 0.00000000 },
+  { 0xD13Du, 0.00000000 },
+  { 0xD13Eu, 0.00000000 },
+  { 0xD13Fu, 0.00000000 },
+  { 0xD140u, 0.00000000 },
+  { 0xD141u, 0.00000000 },
+  { 0xD142u, 0.00000000 },
+  { 0xD143u, 0.00000000 },
+  { 0xD144u, 0.00000000 },
+  { 0xD145u, 0.00000000 },
+  { 0xD146u, 0.00000000 },
+  { 0xD147u, 0.00000000 },
+  { 0xD148u, 0.00000000 },
+  { 0xD149u, 0.00000000 },
+  { 0xD14Au, 0.00000000 },
+  { 0xD14Bu, 0.00000000 },
+  { 0xD14Cu, 0.00070000 },
+  { 0xD14Du, 0.00010000 },
+  { 0xD14Eu, 0.00000000 },
+  { 0xD14Fu, 0.00000000 },
+  { 0xD150u, 0.00010000 },
+  { 0xD151u, 0.00000000 },
+  { 0xD152u, 0.00000000 },
+  { 0xD153u, 0.00000000 },
+  { 0xD154u, 0.00020000 },
+  { 0xD155u, 0.00000000 },
+  { 0xD156u, 0.00000000 },
+  { 0xD157u, 0.00000000 },
+  { 0xD158u, 0.00000000 },
+  { 0xD159u, 0.00000000 },
+  { 0xD15Au, 0.00000000 },
+  { 0xD15Bu, 0.00000000 },
+  { 0xD15Cu, 0.00020000 },
+  { 0xD15Du, 0.00000000 },
+  { 0xD15Eu, 0.00000000 },
+  { 0xD15Fu, 0.00000000 },
+  { 0xD160u, 0.00000000 },
+  { 0xD161u, 0.00000000 },
+  { 0xD162u, 0.00000000 },
+  { 0xD163u, 0.00000000 },
+  { 0xD164u, 0.00000000 },
+  { 0xD165u, 0.00000000 },
+  { 0xD166u, 0.00000000 },
+  { 0xD167u, 0.00000000 },
+  { 0xD168u, 0.00000000 },
+  { 0xD169u, 0.00000000 },
+  { 0xD16Au, 0.00000000 },
+  { 0xD16Bu, 0.00000000 },
+  { 0xD16Cu, 0.00000000 },
+  { 0xD16Du, 0.00000000 },
+  { 0xD16Eu, 0.00000000 },
+  { 0xD16Fu, 0.00000000 },
+  { 0xD170u, 0.00000000 },
+  { 0xD171u, 0.00000000 },
+  { 0xD172u, 0.00000000 },
+  { 0xD173u, 0.00000000 },
+  { 0xD174u, 0.00000000 },
+  { 0xD175u, 0.00000000 },
+  { 0xD176u, 0.00000000 },
+  { 0xD177u, 0.00000000 },
+  { 0xD178u, 0.00000000 },
+  { 0xD179u, 0.00000000 },
+  { 0xD17Au, 0.00000000 },
+  { 0xD17Bu, 0.00000000 },
+  { 0xD17Cu, 0.00000000 },
+  { 0xD17Du, 0.00000000 },
+  { 0xD17Eu, 0.00000000 },
+  { 0xD17Fu, 0.00000000 },
+  { 0xD180u, 0.00000000 },
+  { 0xD181u, 0.00000000 },
+  { 0xD182u, 0.00000000 },
+  { 0xD183u, 0.00000000 },
+  { 0xD184u, 0.00000000 },
+  { 0xD185u, 0.00000000 },
+  { 0xD186u, 0.00000000 },
+  { 0xD187u, 0.00000000 },
+  { 0xD188u, 0.00000000 },
+  { 0xD189u, 0.00000000 },
+  { 0xD18Au, 0.00000000 },
+  { 0xD18Bu, 0.00000000 },
+  { 0xD18Cu, 0.00000000 },
+  { 0xD18Du, 0.00000000 },
+  { 0xD18Eu, 0.00000000 },
+  { 0xD18Fu, 0.00000000 },
+  { 0xD190u, 0.00000000 },
+  { 0xD191u, 0.00000000 },
+  { 0xD192u, 0.00000000 },
+  { 0xD193u, 0.00000000 },
+  { 0xD194u, 0.00000000 },
+  { 0xD195u, 0.00000000 },
+  { 0xD196u, 0.00000000 },
+  { 0xD197u, 0.00000000 },
+  { 0xD198u, 0.00000000 },
+  { 0xD199u, 0.00000000 },
+  { 0xD19Au, 0.00000000 },
+  { 0xD19Bu, 0.00000000 },
+  { 0xD19Cu, 0.00000000 },
+  { 0xD19Du, 0.00000000 },
+  { 0xD19Eu, 0.00000000 },
+  { 0xD19Fu, 0.00000000 },
+  { 0xD1A0u, 0.00140000 },
+  { 0xD1A1u, 0.00000000 },
+  { 0xD1A2u, 0.00000000 },
+  { 0xD1A3u, 0.00000000 },
+  { 0xD1A4u, 0.00010000 },
+  { 0xD1A5u, 0.00000000 },
+  { 0xD1A6u, 0.00000000 },
+  { 0xD1A7u, 0.00000000 },
+  { 0xD1A8u, 0.00010000 },
+  { 0xD1A9u, 0.00000000 },
+  { 0xD1AAu, 0.00000000 },
+  { 0xD1ABu, 0.00000000 },
+  { 0xD1ACu, 0.00000000 },
+  { 0xD1ADu, 0.00000000 },
+  { 0xD1AEu, 0.00000000 },
+  { 0xD1AFu, 0.00000000 },
+  { 0xD1B0u, 0.00000000 },
+  { 0xD1B1u, 0.00000000 },
+  { 0xD1B2u, 0.00000000 },
+  { 0xD1B3u, 0.00000000 },
+  { 0xD1B4u, 0.00000000 },
+  { 0xD1B5u, 0.00200000 },
+  { 0xD1B6u, 0.00000000 },
+  { 0xD1B7u, 0.00000000 },
+  { 0xD1B8u, 0.00000000 },
+  { 0xD1B9u, 0.00000000 },
+  { 0xD1BAu, 0.00000000 },
+  { 0xD1BBu, 0.00000000 },
+  { 0xD1BCu, 0.00000000 },
+  { 0xD1BDu, 0.00000000 },
+  { 0xD1BEu, 0.00000000 },
+  { 0xD1BFu, 0.00000000 },
+  { 0xD1C0u, 0.00000000 },
+  { 0xD1C1u, 0.00000000 },
+  { 0xD1C2u, 0.00000000 },
+  { 0xD1C3u, 0.00000000 },
+  { 0xD1C4u, 0.00000000 },
+  { 0xD1C5u, 0.00000000 },
+  { 0xD1C6u, 0.00000000 },
+  { 0xD1C7u, 0.00000000 },
+  { 0xD1C8u, 0.00000000 },
+  { 0xD1C9u, 0.00000000 },
+  { 0xD1CAu, 0.00000000 },
+  { 0xD1CBu, 0.00000000 },
+  { 0xD1CCu, 0.00000000 },
+  { 0xD1CDu, 0.00000000 },
+  { 0xD1CEu, 0.00000000 },
+  { 0xD1CFu, 0.00000000 },
+  { 0xD1D0u, 0.00000000 },
+  { 0xD1D1u, 0.00000000 },
+  { 0xD1D2u, 0.00000000 },
+  { 0xD1D3u, 0.00000000 },
+  { 0xD1D4u, 0.00000000 },
+  { 0xD1D5u, 0.00000000 },
+  { 0xD1D6u, 0.00000000 },
+  { 0xD1D7u, 0.00000000 },
+  { 0xD1D8u, 0.00000000 },
+  { 0xD1D9u, 0.00000000 },
+  { 0xD1DAu, 0.00000000 },
+  { 0xD1DBu, 0.00000000 },
+  { 0xD1DCu, 0.00000000 },
+  { 0xD1DDu, 0.00000000 },
+  { 0xD1DEu, 0.00000000 },
+  { 0xD1DFu, 0.00000000 },
+  { 0xD1E0u, 0.00000000 },
+  { 0xD1E1u, 0.00000000 },
+  { 0xD1E2u, 0.00000000 },
+  { 0xD1E3u, 0.00000000 },
+  { 0xD1E4u, 0.00000000 },
+  { 0xD1E5u, 0.00000000 },
+  { 0xD1E6u, 0.00000000 },
+  { 0xD1E7u, 0.00000000 },
+  { 0xD1E8u, 0.00000000 },
+  { 0xD1E9u, 0.00000000 },
+  { 0xD1EAu, 0.00000000 },
+  { 0xD1EBu, 0.00000000 },
+  { 0xD1ECu, 0.00000000 },
+  { 0xD1EDu, 0.00000000 },
+  { 0xD1EEu, 0.00000000 },
+  { 0xD1EFu, 0.00000000 },
+  { 0xD1F0u, 0.00000000 },
+  { 0xD1F1u, 0.00000000 },
+  { 0xD1F2u, 0.00000000 },
+  { 0xD1F3u, 0.00000000 },
+  { 0xD1F4u, 0.00030000 },
+  { 0xD1F5u, 0.00000000 },
+  { 0xD1F6u, 0.00000000 },
+  { 0xD1F7u, 0.00000000 },
+  { 0xD1F8u, 0.00000000 },
+  { 0xD1F9u, 0.00000000 },
+  { 0xD1FAu, 0.00000000 },
+  { 0xD1FBu, 0.00000000 },
+  { 0xD1FCu, 0.00000000 },
+  { 0xD1FDu, 0.00000000 },
+  { 0xD1FEu, 0.00000000 },
+  { 0xD1FFu, 0.00000000 },
+  { 0xD200u, 0.00000000 },
+  { 0xD201u, 0.00000000 },
+  { 0xD202u, 0.00000000 },
+  { 0xD203u, 0.00000000 },
+  { 0xD204u, 0.00000000 },
+  { 0xD205u, 0.00000000 },
+  { 0xD206u, 0.00000000 },
+  { 0xD207u, 0.00000000 },
+  { 0xD208u, 0.00000000 },
+  { 0xD209u, 0.00000000 },
+  { 0xD20Au, 0.00000000 },
+  { 0xD20Bu, 0.00000000 },
+  { 0xD20Cu, 0.00000000 },
+  { 0xD20Du, 0.00000000 },
+  { 0xD20Eu, 0.00000000 },
+  { 0xD20Fu, 0.00000000 },
+  { 0xD210u, 0.00000000 },
+  { 0xD211u, 0.00000000 },
+  { 0xD212u, 0.00000000 },
+  { 0xD213u, 0.00000000 },
+  { 0xD214u, 0.00000000 },
+  { 0xD215u, 0.00000000 },
+  { 0xD216u, 0.00000000 },
+  { 0xD217u, 0.00000000 },
+  { 0xD218u, 0.00000000 },
+  { 0xD219u, 0.00000000 },
+  { 0xD21Au, 0.00000000 },
+  { 0xD21Bu, 0.00000000 },
+  { 0xD21Cu, 0.00000000 },
+  { 0xD21Du, 0.00000000 },
+  { 0xD21Eu, 0.00000000 },
+  { 0xD21Fu, 0.00000000 },
+  { 0xD220u, 0.00000000 },
+  { 0xD221u, 0.00000000 },
+  { 0xD222u, 0.00000000 },
+  { 0xD223u, 0.00000000 },
+  { 0xD224u, 0.00000000 },
+  { 0xD225u, 0.00000000 },
+  { 0xD226u, 0.00000000 },
+  { 0xD227u, 0.00000000 },
+  { 0xD228u, 0.00000000 },
+  { 0xD229u, 0.00000000 },
+  { 0xD22Au, 0.00000000 },
+  { 0xD22Bu, 0.00000000 },
+  { 0xD22Cu, 0.00090000 },
+  { 0xD22Du, 0.00000000 },
+  { 0xD22Eu, 0.00000000 },
+  { 0xD22Fu, 0.00000000 },
+  { 0xD230u, 0.00000000 },
+  { 0xD231u, 0.00000000 },
+  { 0xD232u, 0.00000000 },
+  { 0xD233u, 0.00000000 },
+  { 0xD234u, 0.00000000 },
+  { 0xD235u, 0.00000000 },
+  { 0xD236u, 0.00000000 },
+  { 0xD237u, 0.00000000 },
+  { 0xD238u, 0.00000000 },
+  { 0xD239u, 0.00000000 },
+  { 0xD23Au, 0.00000000 },
+  { 0xD23Bu, 0.00000000 },
+  { 0xD23Cu, 0.00000000 },
+  { 0xD23Du, 0.00000000 },
+  { 0xD23Eu, 0.00000000 },
+  { 0xD23Fu, 0.00000000 },
+  { 0xD240u, 0.00000000 },
+  { 0xD241u, 0.00000000 },
+  { 0xD242u, 0.00000000 },
+  { 0xD243u, 0.00000000 },
+  { 0xD244u, 0.00000000 },
+  { 0xD245u, 0.00000000 },
+  { 0xD246u, 0.00000000 },
+  { 0xD247u, 0.00000000 },
+  { 0xD248u, 0.00000000 },
+  { 0xD249u, 0.00000000 },
+  { 0xD24Au, 0.00000000 },
+  { 0xD24Bu, 0.00000000 },
+  { 0xD24Cu, 0.00000000 },
+  { 0xD24Du, 0.00000000 },
+  { 0xD24Eu, 0.00000000 },
+  { 0xD24Fu, 0.00000000 },
+  { 0xD250u, 0.00000000 },
+  { 0xD251u, 0.00000000 },
+  { 0xD252u, 0.00000000 },
+  { 0xD253u, 0.00000000 },
+  { 0xD254u, 0.00000000 },
+  { 0xD255u, 0.00000000 },
+  { 0xD256u, 0.00000000 },
+  { 0xD257u, 0.00000000 },
+  { 0xD258u, 0.00000000 },
+  { 0xD259u, 0.00000000 },
+  { 0xD25Au, 0.00000000 },
+  { 0xD25Bu, 0.00000000 },
+  { 0xD25Cu, 0.00000000 },
+  { 0xD25Du, 0.00000000 },
+  { 0xD25Eu, 0.00000000 },
+  { 0xD25Fu, 0.00000000 },
+  { 0xD260u, 0.00000000 },
+  { 0xD261u, 0.00000000 },
+  { 0xD262u, 0.00000000 },
+  { 0xD263u, 0.00000000 },
+  { 0xD264u, 0.00000000 },
+  { 0xD265u, 0.00000000 },
+  { 0xD266u, 0.00000000 },
+  { 0xD267u, 0.00000000 },
+  { 0xD268u, 0.00000000 },
+  { 0xD269u, 0.00000000 },
+  { 0xD26Au, 0.00000000 },
+  { 0xD26Bu, 0.00000000 },
+  { 0xD26Cu, 0.00000000 },
+  { 0xD26Du, 0.00000000 },
+  { 0xD26Eu, 0.00000000 },
+  { 0xD26Fu, 0.00000000 },
+  { 0xD270u, 0.00000000 },
+  { 0xD271u, 0.00000000 },
+  { 0xD272u, 0.00000000 },
+  { 0xD273u, 0.00000000 },
+  { 0xD274u, 0.00000000 },
+  { 0xD275u, 0.00000000 },
+  { 0xD276u, 0.00000000 },
+  { 0xD277u, 0.00000000 },
+  { 0xD278u, 0.00000000 },
+  { 0xD279u, 0.00000000 },
+  { 0xD27Au, 0.00000000 },
+  { 0xD27Bu, 0.00000000 },
+  { 0xD27Cu, 0.00000000 },
+  { 0xD27Du, 0.00000000 },
+  { 0xD27Eu, 0.00000000 },
+  { 0xD27Fu, 0.00000000 },
+  { 0xD280u, 0.00000000 },
+  { 0xD281u, 0.00000000 },
+  { 0xD282u, 0.00000000 },
+  { 0xD283u, 0.00000000 },
+  { 0xD284u, 0.00000000 },
+  { 0xD285u, 0.00000000 },
+  { 0xD286u, 0.00000000 },
+  { 0xD287u, 0.00000000 },
+  { 0xD288u, 0.00000000 },
+  { 0xD289u, 0.00000000 },
+  { 0xD28Au, 0.00000000 },
+  { 0xD28Bu, 0.00000000 },
+  { 0xD28Cu, 0.00000000 },
+  { 0xD28Du, 0.00000000 },
+  { 0xD28Eu, 0.00000000 },
+  { 0xD28Fu, 0.00000000 },
+  { 0xD290u, 0.00000000 },
+  { 0xD291u, 0.00000000 },
+  { 0xD292u, 0.00000000 },
+  { 0xD293u, 0.00000000 },
+  { 0xD294u, 0.00000000 },
+  { 0xD295u, 0.00000000 },
+  { 0xD296u, 0.00000000 },
+  { 0xD297u, 0.00000000 },
+  { 0xD298u, 0.00000000 },
+  { 0xD299u, 0.00000000 },
+  { 0xD29Au, 0.00000000 },
+  { 0xD29Bu, 0.00000000 },
+  { 0xD29Cu, 0.00010000 },
+  { 0xD29Du, 0.00000000 },
+  { 0xD29Eu, 0.00000000 },
+  { 0xD29Fu, 0.00000000 },
+  { 0xD2A0u, 0.00000000 },
+  { 0xD2A1u, 0.00000000 },
+  { 0xD2A2u, 0.00000000 },
+  { 0xD2A3u, 0.00000000 },
+  { 0xD2A4u, 0.00000000 },
+  { 0xD2A5u, 0.00000000 },
+  { 0xD2A6u, 0.00000000 },
+  { 0xD2A7u, 0.00000000 },
+  { 0xD2A8u, 0.00000000 },
+  { 0xD2A9u, 0.00000000 },
+  { 0xD2AAu, 0.00000000 },
+  { 0xD2ABu, 0.00000000 },
+  { 0xD2ACu, 0.00000000 },
+  { 0xD2ADu, 0.00000000 },
+  { 0xD2AEu, 0.00000000 },
+  { 0xD2AFu, 0.00000000 },
+  { 0xD2B0u, 0.00000000 },
+  { 0xD2B1u, 0.00000000 },
+  { 0xD2B2u, 0.00000000 },
+  { 0xD2B3u, 0.00000000 },
+  { 0xD2B4u, 0.00000000 },
+  { 0xD2B5u, 0.00000000 },
+  { 0xD2B6u, 0.00000000 },
+  { 0xD2B7u, 0.00000000 },
+  { 0xD2B8u, 0.00340000 },
+  { 0xD2B9u, 0.00090000 },
+  { 0xD2BAu, 0.00000000 },
+  { 0xD2BBu, 0.00000000 },
+  { 0xD2BCu, 0.00010000 },
+  { 0xD2BDu, 0.00000000 },
+  { 0xD2BEu, 0.00000000 },
+  { 0xD2BFu, 0.00000000 },
+  { 0xD2C0u, 0.00030000 },
+  { 0xD2C1u, 0.00000000 },
+  { 0xD2C2u, 0.00000000 },
+  { 0xD2C3u, 0.00000000 },
+  { 0xD2C4u, 0.00000000 },
+  { 0xD2C5u, 0.00000000 },
+  { 0xD2C6u, 0.00000000 },
+  { 0xD2C7u, 0.00000000 },
+  { 0xD2C8u, 0.00000000 },
+  { 0xD2C9u, 0.00000000 },
+  { 0xD2CAu, 0.00000000 },
+  { 0xD2CBu, 0.00000000 },
+  { 0xD2CCu, 0.00000000 },
+  { 0xD2CDu, 0.00000000 },
+  { 0xD2CEu, 0.00000000 },
+  { 0xD2CFu, 0.00000000 },
+  { 0xD2D0u, 0.00000000 },
+  { 0xD2D1u, 0.00000000 },
+  { 0xD2D2u, 0.00000000 },
+  { 0xD2D3u, 0.00000000 },
+  { 0xD2D4u, 0.00000000 },
+  { 0xD2D5u, 0.00000000 },
+  { 0xD2D6u, 0.00000000 },
+  { 0xD2D7u, 0.00000000 },
+  { 0xD2D8u, 0.00000000 },
+  { 0xD2D9u, 0.00000000 },
+  { 0xD2DAu, 0.00000000 },
+  { 0xD2DBu, 0.00000000 },
+  { 0xD2DCu, 0.00000000 },
+  { 0xD2DDu, 0.00000000 },
+  { 0xD2DEu, 0.00000000 },
+  { 0xD2DFu, 0.00000000 },
+  { 0xD2E0u, 0.00000000 },
+  { 0xD2E1u, 0.00000000 },
+  { 0xD2E2u, 0.00000000 },
+  { 0xD2E3u, 0.00000000 },
+  { 0xD2E4u, 0.00000000 },
+  { 0xD2E5u, 0.00000000 },
+  { 0xD2E6u, 0.00000000 },
+  { 0xD2E7u, 0.00000000 },
+  { 0xD2E8u, 0.00000000 },
+  { 0xD2E9u, 0.00000000 },
+  { 0xD2EAu, 0.00000000 },
+  { 0xD2EBu, 0.00000000 },
+  { 0xD2ECu, 0.00000000 },
+  { 0xD2EDu, 0.00000000 },
+  { 0xD2EEu, 0.00000000 },
+  { 0xD2EFu, 0.00000000 },
+  { 0xD2F0u, 0.00090000 },
+  { 0xD2F1u, 0.00000000 },
+  { 0xD2F2u, 0.00000000 },
+  { 0xD2F3u, 0.00000000 },
+  { 0xD2F4u, 0.00010000 },
+  { 0xD2F5u, 0.00000000 },
+  { 0xD2F6u, 0.00000000 },
+  { 0xD2F7u, 0.00000000 },
+  { 0xD2F8u, 0.00000000 },
+  { 0xD2F9u, 0.00000000 },
+  { 0xD2FAu, 0.00000000 },
+  { 0xD2FBu, 0.00000000 },
+  { 0xD2FCu, 0.00000000 },
+  { 0xD2FDu, 0.00000000 },
+  { 0xD2FEu, 0.00000000 },
+  { 0xD2FFu, 0.00000000 },
+  { 0xD300u, 0.00050000 },
+  { 0xD301u, 0.00000000 },
+  { 0xD302u, 0.00000000 },
+  { 0xD303u, 0.00000000 },
+  { 0xD304u, 0.00000000 },
+  { 0xD305u, 0.00010000 },
+  { 0xD306u, 0.00000000 },
+  { 0xD307u, 0.00000000 },
+  { 0xD308u, 0.00000000 },
+  { 0xD309u, 0.00000000 },
+  { 0xD30Au, 0.00000000 },
+  { 0xD30Bu, 0.00000000 },
+  { 0xD30Cu, 0.00170000 },
+  { 0xD30Du, 0.00000000 },
+  { 0xD30Eu, 0.00000000 },
+  { 0xD30Fu, 0.00000000 },
+  { 0xD310u, 0.00100000 },
+  { 0xD311u, 0.00000000 },
+  { 0xD312u, 0.00000000 },
+  { 0xD313u, 0.00000000 },
+  { 0xD314u, 0.00020000 },
+  { 0xD315u, 0.00000000 },
+  { 0xD316u, 0.00000000 },
+  { 0xD317u, 0.00000000 },
+  { 0xD318u, 0.00000000 },
+  { 0xD319u, 0.00000000 },
+  { 0xD31Au, 0.00000000 },
+  { 0xD31Bu, 0.00000000 },
+  { 0xD31Cu, 0.00000000 },
+  { 0xD31Du, 0.00000000 },
+  { 0xD31Eu, 0.00000000 },
+  { 0xD31Fu, 0.00000000 },
+  { 0xD320u, 0.00000000 },
+  { 0xD321u, 0.00000000 },
+  { 0xD322u, 0.00000000 },
+  { 0xD323u, 0.00000000 },
+  { 0xD324u, 0.00000000 },
+  { 0xD325u, 0.00000000 },
+  { 0xD326u, 0.00000000 },
+  { 0xD327u, 0.00000000 },
+  { 0xD328u, 0.00050000 },
+  { 0xD329u, 0.00000000 },
+  { 0xD32Au, 0.00000000 },
+  { 0xD32Bu, 0.00000000 },
+  { 0xD32Cu, 0.00010000 },
+  { 0xD32Du, 0.00000000 },
+  { 0xD32Eu, 0.00000000 },
+  { 0xD32Fu, 0.00000000 },
+  { 0xD330u, 0.00000000 },
+  { 0xD331u, 0.00000000 },
+  { 0xD332u, 0.00000000 },
+  { 0xD333u, 0.00000000 },
+  { 0xD334u, 0.00000000 },
+  { 0xD335u, 0.00000000 },
+  { 0xD336u, 0.00000000 },
+  { 0xD337u, 0.00000000 },
+  { 0xD338u, 0.00000000 },
+  { 0xD339u, 0.00000000 },
+  { 0xD33Au, 0.00000000 },
+  { 0xD33Bu, 0.00000000 },
+  { 0xD33Cu, 0.00000000 },
+  { 0xD33Du, 0.00000000 },
+  { 0xD33Eu, 0.00000000 },
+  { 0xD33Fu, 0.00000000 },
+  { 0xD340u, 0.00000000 },
+  { 0xD341u, 0.00000000 },
+  { 0xD342u, 0.00000000 },
+  { 0xD343u, 0.00000000 },
+  { 0xD344u, 0.00000000 },
+  { 0xD345u, 0.00000000 },
+  { 0xD346u, 0.00000000 },
+  { 0xD347u, 0.00000000 },
+  { 0xD348u, 0.00000000 },
+  { 0xD349u, 0.00000000 },
+  { 0xD34Au, 0.00000000 },
+  { 0xD34Bu, 0.00000000 },
+  { 0xD34Cu, 0.00000000 },
+  { 0xD34Du, 0.00000000 },
+  { 0xD34Eu, 0.00000000 },
+  { 0xD34Fu, 0.00000000 },
+  { 0xD350u, 0.00000000 },
+  { 0xD351u, 0.00000000 },
+  { 0xD352u, 0.00000000 },
+  { 0xD353u, 0.00000000 },
+  { 0xD354u, 0.00000000 },
+  { 0xD355u, 0.00000000 },
+  { 0xD356u, 0.00000000 },
+  { 0xD357u, 0.00000000 },
+  { 0xD358u, 0.00000000 },
+  { 0xD359u, 0.00000000 },
+  { 0xD35Au, 0.00000000 },
+  { 0xD35Bu, 0.00000000 },
+  { 0xD35Cu, 0.00000000 },
+  { 0xD35Du, 0.00000000 },
+  { 0xD35Eu, 0.00000000 },
+  { 0xD35Fu, 0.00000000 },
+  { 0xD360u, 0.00000000 },
+  { 0xD361u, 0.00000000 },
+  { 0xD362u, 0.00000000 },
+  { 0xD363u, 0.00000000 },
+  { 0xD364u, 0.00000000 },
+  { 0xD365u, 0.00000000 },
+  { 0xD366u, 0.00000000 },
+  { 0xD367u, 0.00000000 },
+  { 0xD368u, 0.00000000 },
+  { 0xD369u, 0.00000000 },
+  { 0xD36Au, 0.00000000 },
+  { 0xD36Bu, 0.00000000 },
+  { 0xD36Cu, 0.00000000 },
+  { 0xD36Du, 0.00000000 },
+  { 0xD36Eu, 0.00000000 },
+  { 0xD36Fu, 0.00000000 },
+  { 0xD370u, 0.00000000 },
+  { 0xD371u, 0.00000000 },
+  { 0xD372u, 0.00000000 },
+  { 0xD373u, 0.00000000 },
+  { 0xD374u, 0.00000000 },
+  { 0xD375u, 0.00000000 },
+  { 0xD376u, 0.00000000 },
+  { 0xD377u, 0.00000000 },
+  { 0xD378u, 0.00000000 },
+  { 0xD379u, 0.00000000 },
+  { 0xD37Au, 0.00000000 },
+  { 0xD37Bu, 0.00000000 },
+  { 0xD37Cu, 0.00040000 },
+  { 0xD37Du, 0.00000000 },
+  { 0xD37Eu, 0.00000000 },
+  { 0xD37Fu, 0.00000000 },
+  { 0xD380u, 0.00000000 },
+  { 0xD381u, 0.00000000 },
+  { 0xD382u, 0.00000000 },
+  { 0xD383u, 0.00000000 },
+  { 0xD384u, 0.00000000 },
+  { 0xD385u, 0.00000000 },
+  { 0xD386u, 0.00000000 },
+  { 0xD387u, 0.00000000 },
+  { 0xD388u, 0.00000000 },
+  { 0xD389u, 0.00000000 },
+  { 0xD38Au, 0.00000000 },
+  { 0xD38Bu, 0.00000000 },
+  { 0xD38Cu, 0.00000000 },
+  { 0xD38Du, 0.00000000 },
+  { 0xD38Eu, 0.00000000 },
+  { 0xD38Fu, 0.00000000 },
+  { 0xD390u, 0.00000000 },
+  { 0xD391u, 0.00000000 },
+  { 0xD392u, 0.00000000 },
+  { 0xD393u, 0.00000000 },
+  { 0xD394u, 0.00000000 },
+  { 0xD395u, 0.00000000 },
+  { 0xD396u, 0.00000000 },
+  { 0xD397u, 0.00000000 },
+  { 0xD398u, 0.00070000 },
+  { 0xD399u, 0.00000000 },
+  { 0xD39Au, 0.00000000 },
+  { 0xD39Bu, 0.00000000 },
+  { 0xD39Cu, 0.00010000 },
+  { 0xD39Du, 0.00000000 },
+  { 0xD39Eu, 0.00000000 },
+  { 0xD39Fu, 0.00000000 },
+  { 0xD3A0u, 0.00010000 },
+  { 0xD3A1u, 0.00000000 },
+  { 0xD3A2u, 0.00000000 },
+  { 0xD3A3u, 0.00000000 },
+  { 0xD3A4u, 0.00000000 },
+  { 0xD3A5u, 0.00000000 },
+  { 0xD3A6u, 0.00000000 },
+  { 0xD3A7u, 0.00000000 },
+  { 0xD3A8u, 0.00000000 },
+  { 0xD3A9u, 0.00000000 },
+  { 0xD3AAu, 0.00000000 },
+  { 0xD3ABu, 0.00000000 },
+  { 0xD3ACu, 0.00000000 },
+  { 0xD3ADu, 0.00000000 },
+  { 0xD3AEu, 0.00000000 },
+  { 0xD3AFu, 0.00000000 },
+  { 0xD3B0u, 0.00000000 },
+  { 0xD3B1u, 0.00000000 },
+  { 0xD3B2u, 0.00000000 },
+  { 0xD3B3u, 0.00000000 },
+  { 0xD3B4u, 0.00000000 },
+  { 0xD3B5u, 0.00000000 },
+  { 0xD3B6u, 0.00000000 },
+  { 0xD3B7u, 0.00000000 },
+  { 0xD3B8u, 0.00090000 },
+  { 0xD3B9u, 0.00000000 },
+  { 0xD3BAu, 0.00000000 },
+  { 0xD3BBu, 0.00000000 },
+  { 0xD3BCu, 0.00010000 },
+  { 0xD3BDu, 0.00000000 },
+  { 0xD3BEu, 0.00000000 },
+  { 0xD3BFu, 0.00000000 },
+  { 0xD3C0u, 0.00000000 },
+  { 0xD3C1u, 0.00000000 },
+  { 0xD3C2u, 0.00000000 },
+  { 0xD3C3u, 0.00000000 },
+  { 0xD3C4u, 0.00000000 },
+  { 0xD3C5u, 0.00000000 },
+  { 0xD3C6u, 0.00000000 },
+  { 0xD3C7u, 0.00000000 },
+  { 0xD3C8u, 0.00000000 },
+  { 0xD3C9u, 0.00090000 },
+  { 0xD3CAu, 0.00000000 },
+  { 0xD3CBu, 0.00000000 },
+  { 0xD3CCu, 0.00000000 },
+  { 0xD3CDu, 0.00000000 },
+  { 0xD3CEu, 0.00000000 },
+  { 0xD3CFu, 0.00000000 },
+  { 0xD3D0u, 0.00030000 },
+  { 0xD3D1u, 0.00000000 },
+  { 0xD3D2u, 0.00000000 },
+  { 0xD3D3u, 0.00000000 },
+  { 0xD3D4u, 0.00000000 },
+  { 0xD3D5u, 0.00000000 },
+  { 0xD3D6u, 0.00000000 },
+  { 0xD3D7u, 0.00000000 },
+  { 0xD3D8u, 0.00000000 },
+  { 0xD3D9u, 0.00000000 },
+  { 0xD3DAu, 0.00000000 },
+  { 0xD3DBu, 0.00000000 },
+  { 0xD3DCu, 0.00000000 },
+  { 0xD3DDu, 0.00000000 },
+  { 0xD3DEu, 0.00000000 },
+  { 0xD3DFu, 0.00000000 },
+  { 0xD3E0u, 0.00000000 },
+  { 0xD3E1u, 0.00000000 },
+  { 0xD3E2u, 0.00000000 },
+  { 0xD3E3u, 0.00000000 },
+  { 0xD3E4u, 0.00000000 },
+  { 0xD3E5u, 0.00000000 },
+  { 0xD3E6u, 0.00000000 },
+  { 0xD3E7u, 0.00000000 },
+  { 0xD3E8u, 0.00000000 },
+  { 0xD3E9u, 0.00000000 },
+  { 0xD3EAu, 0.00000000 },
+  { 0xD3EBu, 0.00000000 },
+  { 0xD3ECu, 0.00180000 },
+  { 0xD3EDu, 0.00030000 },
+  { 0xD3EEu, 0.00000000 },
+  { 0xD3EFu, 0.00000000 },
+  { 0xD3F0u, 0.00010000 },
+  { 0xD3F1u, 0.00000000 },
+  { 0xD3F2u, 0.00000000 },
+  { 0xD3F3u, 0.00000000 },
+  { 0xD3F4u, 0.00030000 },
+  { 0xD3F5u, 0.00000000 },
+  { 0xD3F6u, 0.00000000 },
+  { 0xD3F7u, 0.00000000 },
+  { 0xD3F8u, 0.00000000 },
+  { 0xD3F9u, 0.00000000 },
+  { 0xD3FAu, 0.00000000 },
+  { 0xD3FBu, 0.00000000 },
+  { 0xD3FCu, 0.00000000 },
+  { 0xD3FDu, 0.00000000 },
+  { 0xD3FEu, 0.00000000 },
+  { 0xD3FFu, 0.00000000 },
+  { 0xD400u, 0.00000000 },
+  { 0xD401u, 0.00000000 },
+  { 0xD402u, 0.00000000 },
+  { 0xD403u, 0.00000000 },
+  { 0xD404u, 0.00000000 },
+  { 0xD405u, 0.00000000 },
+  { 0xD406u, 0.00000000 },
+  { 0xD407u, 0.00000000 },
+  { 0xD408u, 0.00000000 },
+  { 0xD409u, 0.00000000 },
+  { 0xD40Au, 0.00000000 },
+  { 0xD40Bu, 0.00000000 },
+  { 0xD40Cu, 0.00000000 },
+  { 0xD40Du, 0.00000000 },
+  { 0xD40Eu, 0.00000000 },
+  { 0xD40Fu, 0.00000000 },
+  { 0xD410u, 0.00000000 },
+  { 0xD411u, 0.00000000 },
+  { 0xD412u, 0.00000000 },
+  { 0xD413u, 0.00000000 },
+  { 0xD414u, 0.00000000 },
+  { 0xD415u, 0.00000000 },
+  { 0xD416u, 0.00000000 },
+  { 0xD417u, 0.00000000 },
+  { 0xD418u, 0.00000000 },
+  { 0xD419u, 0.00000000 },
+  { 0xD41Au, 0.00000000 },
+  { 0xD41Bu, 0.00000000 },
+  { 0xD41Cu, 0.00000000 },
+  { 0xD41Du, 0.00000000 },
+  { 0xD41Eu, 0.00000000 },
+  { 0xD41Fu, 0.00000000 },
+  { 0xD420u, 0.00000000 },
+  { 0xD421u, 0.00000000 },
+  { 0xD422u, 0.00000000 },
+  { 0xD423u, 0.00000000 },
+  { 0xD424u, 0.00000000 },
+  { 0xD425u, 0.00000000 },
+  { 0xD426u, 0.00000000 },
+  { 0xD427u, 0.00000000 },
+  { 0xD428u, 0.00000000 },
+  { 0xD429u, 0.00000000 },
+  { 0xD42Au, 0.00000000 },
+  { 0xD42Bu, 0.00000000 },
+  { 0xD42Cu, 0.00000000 },
+  { 0xD42Du, 0.00000000 },
+  { 0xD42Eu, 0.00000000 },
+  { 0xD42Fu, 0.00000000 },
+  { 0xD430u, 0.00000000 },
+  { 0xD431u, 0.00000000 },
+  { 0xD432u, 0.00000000 },
+  { 0xD433u, 0.00000000 },
+  { 0xD434u, 0.00000000 },
+  { 0xD435u, 0.00000000 },
+  { 0xD436u, 0.00000000 },
+  { 0xD437u, 0.00000000 },
+  { 0xD438u, 0.00000000 },
+  { 0xD439u, 0.00000000 },
+  { 0xD43Au, 0.00000000 },
+  { 0xD43Bu, 0.00000000 },
+  { 0xD43Cu, 0.00000000 },
+  { 0xD43Du, 0.00000000 },
+  { 0xD43Eu, 0.00000000 },
+  { 0xD43Fu, 0.00000000 },
+  { 0xD440u, 0.00000000 },
+  { 0xD441u, 0.00000000 },
+  { 0xD442u, 0.00000000 },
+  { 0xD443u, 0.00000000 },
+  { 0xD444u, 0.00000000 },
+  { 0xD445u, 0.00000000 },
+  { 0xD446u, 0.00000000 },
+  { 0xD447u, 0.00000000 },
+  { 0xD448u, 0.00000000 },
+  { 0xD449u, 0.00000000 },
+  { 0xD44Au, 0.00000000 },
+  { 0xD44Bu, 0.00000000 },
+  { 0xD44Cu, 0.00000000 },
+  { 0xD44Du, 0.00000000 },
+  { 0xD44Eu, 0.00000000 },
+  { 0xD44Fu, 0.00000000 },
+  { 0xD450u, 0.00000000 },
+  { 0xD451u, 0.00000000 },
+  { 0xD452u, 0.00000000 },
+  { 0xD453u, 0.00000000 },
+  { 0xD454u, 0.00000000 },
+  { 0xD455u, 0.00000000 },
+  { 0xD456u, 0.00000000 },
+  { 0xD457u, 0.00000000 },
+  { 0xD458u, 0.00000000 },
+  { 0xD459u, 0.00000000 },
+  { 0xD45Au, 0.00000000 },
+  { 0xD45Bu, 0.00000000 },
+  { 0xD45Cu, 0.00140000 },
+  { 0xD45Du, 0.00000000 },
+  { 0xD45Eu, 0.00000000 },
+  { 0xD45Fu, 0.00000000 },
+  { 0xD460u, 0.00000000 },
+  { 0xD461u, 0.00000000 },
+  { 0xD462u, 0.00000000 },
+  { 0xD463u, 0.00000000 },
+  { 0xD464u, 0.00000000 },
+  { 0xD465u, 0.00000000 },
+  { 0xD466u, 0.00000000 },
+  { 0xD467u, 0.00000000 },
+  { 0xD468u, 0.00000000 },
+  { 0xD469u, 0.00000000 },
+  { 0xD46Au, 0.00000000 },
+  { 0xD46Bu, 0.00000000 },
+  { 0xD46Cu, 0.00000000 },
+  { 0xD46Du, 0.00000000 },
+  { 0xD46Eu, 0.00000000 },
+  { 0xD46Fu, 0.00000000 },
+  { 0xD470u, 0.00000000 },
+  { 0xD471u, 0.00000000 },
+  { 0xD472u, 0.00000000 },
+  { 0xD473u, 0.00000000 },
+  { 0xD474u, 0.00000000 },
+  { 0xD475u, 0.00000000 },
+  { 0xD476u, 0.00000000 },
+  { 0xD477u, 0.00000000 },
+  { 0xD478u, 0.00020000 },
+  { 0xD479u, 0.00000000 },
+  { 0xD47Au, 0.00000000 },
+  { 0xD47Bu, 0.00000000 },
+  { 0xD47Cu, 0.00000000 },
+  { 0xD47Du, 0.00000000 },
+  { 0xD47Eu, 0.00000000 },
+  { 0xD47Fu, 0.00000000 },
+  { 0xD480u, 0.00010000 },
+  { 0xD481u, 0.00000000 },
+  { 0xD482u, 0.00000000 },
+  { 0xD483u, 0.00000000 },
+  { 0xD484u, 0.00000000 },
+  { 0xD485u, 0.00000000 },
+  { 0xD486u, 0.00000000 },
+  { 0xD487u, 0.00000000 },
+  { 0xD488u, 0.00060000 },
+  { 0xD489u, 0.00000000 },
+  { 0xD48Au, 0.00000000 },
+  { 0xD48Bu, 0.00000000 },
+  { 0xD48Cu, 0.00000000 },
+  { 0xD48Du, 0.00030000 },
+  { 0xD48Eu, 0.00000000 },
+  { 0xD48Fu, 0.00000000 },
+  { 0xD490u, 0.00000000 },
+  { 0xD491u, 0.00000000 },
+  { 0xD492u, 0.00000000 },
+  { 0xD493u, 0.00000000 },
+  { 0xD494u, 0.00000000 },
+  { 0xD495u, 0.00000000 },
+  { 0xD496u, 0.00000000 },
+  { 0xD497u, 0.00000000 },
+  { 0xD498u, 0.00000000 },
+  { 0xD499u, 0.00000000 },
+  { 0xD49Au, 0.00000000 },
+  { 0xD49Bu, 0.00000000 },
+  { 0xD49Cu, 0.00000000 },
+  { 0xD49Du, 0.00000000 },
+  { 0xD49Eu, 0.00000000 },
+  { 0xD49Fu, 0.00000000 },
+  { 0xD4A0u, 0.00000000 },
+  { 0xD4A1u, 0.00000000 },
+  { 0xD4A2u, 0.00000000 },
+  { 0xD4A3u, 0.00000000 },
+  { 0xD4A4u, 0.00000000 },
+  { 0xD4A5u, 0.00000000 },
+  { 0xD4A6u, 0.00000000 },
+  { 0xD4A7u, 0.00000000 },
+  { 0xD4A8u, 0.00000000 },
+  { 0xD4A9u, 0.00000000 },
+  { 0xD4AAu, 0.00000000 },
+  { 0xD4ABu, 0.00000000 },
+  { 0xD4ACu, 0.00000000 },
+  { 0xD4ADu, 0.00000000 },
+  { 0xD4AEu, 0.00000000 },
+  { 0xD4AFu, 0.00000000 },
+  { 0xD4B0u, 0.00000000 },
+  { 0xD4B1u, 0.00000000 },
+  { 0xD4B2u, 0.00000000 },
+  { 0xD4B3u, 0.00000000 },
+  { 0xD4B4u, 0.00000000 },
+  { 0xD4B5u, 0.00000000 },
+  { 0xD4B6u, 0.00000000 },
+  { 0xD4B7u, 0.00000000 },
+  { 0xD4B8u, 0.00000000 },
+  { 0xD4B9u, 0.00000000 },
+  { 0xD4BAu, 0.00000000 },
+  { 0xD4BBu, 0.00000000 },
+  { 0xD4BCu, 0.00000000 },
+  { 0xD4BDu, 0.00000000 },
+  { 0xD4BEu, 0.00000000 },
+  { 0xD4BFu, 0.00000000 },
+  { 0xD4C0u, 0.00000000 },
+  { 0xD4C1u, 0.00000000 },
+  { 0xD4C2u, 0.00000000 },
+  { 0xD4C3u, 0.00000000 },
+  { 0xD4C4u, 0.00000000 },
+  { 0xD4C5u, 0.00000000 },
+  { 0xD4C6u, 0.00000000 },
+  { 0xD4C7u, 0.00000000 },
+  { 0xD4C8u, 0.00000000 },
+  { 0xD4C9u, 0.00000000 },
+  { 0xD4CAu, 0.00000000 },
+  { 0xD4CBu, 0.00000000 },
+  { 0xD4CCu, 0.00000000 },
+  { 0xD4CDu, 0.00000000 },
+  { 0xD4CEu, 0.00000000 },
+  { 0xD4CFu, 0.00000000 },
+  { 0xD4D0u, 0.00000000 },
+  { 0xD4D1u, 0.00000000 },
+  { 0xD4D2u, 0.00000000 },
+  { 0xD4D3u, 0.00000000 },
+  { 0xD4D4u, 0.00000000 },
+  { 0xD4D5u, 0.00000000 },
+  { 0xD4D6u, 0.00000000 },
+  { 0xD4D7u, 0.00000000 },
+  { 0xD4D8u, 0.00000000 },
+  { 0xD4D9u, 0.00000000 },
+  { 0xD4DAu, 0.00000000 },
+  { 0xD4DBu, 0.00000000 },
+  { 0xD4DCu, 0.00000000 },
+  { 0xD4DDu, 0.00000000 },
+  { 0xD4DEu, 0.00000000 },
+  { 0xD4DFu, 0.00000000 },
+  { 0xD4E0u, 0.00000000 },
+  { 0xD4E1u, 0.00000000 },
+  { 0xD4E2u, 0.00000000 },
+  { 0xD4E3u, 0.00000000 },
+  { 0xD4E4u, 0.00000000 },
+  { 0xD4E5u, 0.00000000 },
+  { 0xD4E6u, 0.00000000 },
+  { 0xD4E7u, 0.00000000 },
+  { 0xD4E8u, 0.00010000 },
+  { 0xD4E9u, 0.00000000 },
+  { 0xD4EAu, 0.00000000 },
+  { 0xD4EBu, 0.00000000 },
+  { 0xD4ECu, 0.00000000 },
+  { 0xD4EDu, 0.00000000 },
+  { 0xD4EEu, 0.00000000 },
+  { 0xD4EFu, 0.00000000 },
+  { 0xD4F0u, 0.00000000 },
+  { 0xD4F1u, 0.00000000 },
+  { 0xD4F2u, 0.00000000 },
+  { 0xD4F3u, 0.00000000 },
+  { 0xD4F4u, 0.00000000 },
+  { 0xD4F5u, 0.00000000 },
+  { 0xD4F6u, 0.00000000 },
+  { 0xD4F7u, 0.00000000 },
+  { 0xD4F8u, 0.00000000 },
+  { 0xD4F9u, 0.00000000 },
+  { 0xD4FAu, 0.00000000 },
+  { 0xD4FBu, 0.00000000 },
+  { 0xD4FCu, 0.00000000 },
+  { 0xD4FDu, 0.00000000 },
+  { 0xD4FEu, 0.00000000 },
+  { 0xD4FFu, 0.00000000 },
+  { 0xD500u, 0.00000000 },
+  { 0xD501u, 0.00000000 },
+  { 0xD502u, 0.00000000 },
+  { 0xD503u, 0.00000000 },
+  { 0xD504u, 0.00250000 },
+  { 0xD505u, 0.00000000 },
+  { 0xD506u, 0.00000000 },
+  { 0xD507u, 0.00000000 },
+  { 0xD508u, 0.00000000 },
+  { 0xD509u, 0.00000000 },
+  { 0xD50Au, 0.00000000 },
+  { 0xD50Bu, 0.00000000 },
+  { 0xD50Cu, 0.00050000 },
+  { 0xD50Du, 0.00000000 },
+  { 0xD50Eu, 0.00000000 },
+  { 0xD50Fu, 0.00000000 },
+  { 0xD510u, 0.00000000 },
+  { 0xD511u, 0.00000000 },
+  { 0xD512u, 0.00000000 },
+  { 0xD513u, 0.00000000 },
+  { 0xD514u, 0.00000000 },
+  { 0xD515u, 0.00000000 },
+  { 0xD516u, 0.00000000 },
+  { 0xD517u, 0.00000000 },
+  { 0xD518u, 0.00000000 },
+  { 0xD519u, 0.00000000 },
+  { 0xD51Au, 0.00000000 },
+  { 0xD51Bu, 0.00000000 },
+  { 0xD51Cu, 0.00000000 },
+  { 0xD51Du, 0.00000000 },
+  { 0xD51Eu, 0.00000000 },
+  { 0xD51Fu, 0.00000000 },
+  { 0xD520u, 0.00000000 },
+  { 0xD521u, 0.00000000 },
+  { 0xD522u, 0.00000000 },
+  { 0xD523u, 0.00000000 },
+  { 0xD524u, 0.00000000 },
+  { 0xD525u, 0.00000000 },
+  { 0xD526u, 0.00000000 },
+  { 0xD527u, 0.00000000 },
+  { 0xD528u, 0.00000000 },
+  { 0xD529u, 0.00000000 },
+  { 0xD52Au, 0.00000000 },
+  { 0xD52Bu, 0.00000000 },
+  { 0xD52Cu, 0.00000000 },
+  { 0xD52Du, 0.00000000 },
+  { 0xD52Eu, 0.00000000 },
+  { 0xD52Fu, 0.00000000 },
+  { 0xD530u, 0.00000000 },
+  { 0xD531u, 0.00000000 },
+  { 0xD532u, 0.00000000 },
+  { 0xD533u, 0.00000000 },
+  { 0xD534u, 0.00000000 },
+  { 0xD535u, 0.00000000 },
+  { 0xD536u, 0.00000000 },
+  { 0xD537u, 0.00000000 },
+  { 0xD538u, 0.00000000 },
+  { 0xD539u, 0.00000000 },
+  { 0xD53Au, 0.00000000 },
+  { 0xD53Bu, 0.00000000 },
+  { 0xD53Cu, 0.00100000 },
+  { 0xD53Du, 0.00030000 },
+  { 0xD53Eu, 0.00000000 },
+  { 0xD53Fu, 0.00000000 },
+  { 0xD540u, 0.00010000 },
+  { 0xD541u, 0.00000000 },
+  { 0xD542u, 0.00000000 },
+  { 0xD543u, 0.00000000 },
+  { 0xD544u, 0.00050000 },
+  { 0xD545u, 0.00000000 },
+  { 0xD546u, 0.00000000 },
+  { 0xD547u, 0.00000000 },
+  { 0xD548u, 0.00000000 },
+  { 0xD549u, 0.00000000 },
+  { 0xD54Au, 0.00000000 },
+  { 0xD54Bu, 0.00000000 },
+  { 0xD54Cu, 0.00000000 },
+  { 0xD54Du, 0.00000000 },
+  { 0xD54Eu, 0.00000000 },
+  { 0xD54Fu, 0.00000000 },
+  { 0xD550u, 0.00000000 },
+  { 0xD551u, 0.00010000 },
+  { 0xD552u, 0.00000000 },
+  { 0xD553u, 0.00000000 },
+  { 0xD554u, 0.00000000 },
+  { 0xD555u, 0.00000000 },
+  { 0xD556u, 0.00000000 },
+  { 0xD557u, 0.00000000 },
+  { 0xD558u, 0.01780000 },
+  { 0xD559u, 0.00350000 },
+  { 0xD55Au, 0.00000000 },
+  { 0xD55Bu, 0.00000000 },
+  { 0xD55Cu, 0.01200000 },
+  { 0xD55Du, 0.00000000 },
+  { 0xD55Eu, 0.00000000 },
+  { 0xD55Fu, 0.00000000 },
+  { 0xD560u, 0.00170000 },
+  { 0xD561u, 0.00000000 },
+  { 0xD562u, 0.00000000 },
+  { 0xD563u, 0.00000000 },
+  { 0xD564u, 0.00000000 },
+  { 0xD565u, 0.00000000 },
+  { 0xD566u, 0.00000000 },
+  { 0xD567u, 0.00000000 },
+  { 0xD568u, 0.00140000 },
+  { 0xD569u, 0.00120000 },
+  { 0xD56Au, 0.00000000 },
+  { 0xD56Bu, 0.00000000 },
+  { 0xD56Cu, 0.00000000 },
+  { 0xD56Du, 0.00100000 },
+  { 0xD56Eu, 0.00000000 },
+  { 0xD56Fu, 0.00000000 },
+  { 0xD570u, 0.00000000 },
+  { 0xD571u, 0.00000000 },
+  { 0xD572u, 0.00000000 },
+  { 0xD573u, 0.00000000 },
+  { 0xD574u, 0.00570000 },
+  { 0xD575u, 0.00020000 },
+  { 0xD576u, 0.00000000 },
+  { 0xD577u, 0.00000000 },
+  { 0xD578u, 0.00000000 },
+  { 0xD579u, 0.00000000 },
+  { 0xD57Au, 0.00000000 },
+  { 0xD57Bu, 0.00000000 },
+  { 0xD57Cu, 0.00000000 },
+  { 0xD57Du, 0.00000000 },
+  { 0xD57Eu, 0.00000000 },
+  { 0xD57Fu, 0.00000000 },
+  { 0xD580u, 0.00000000 },
+  { 0xD581u, 0.00000000 },
+  { 0xD582u, 0.00000000 },
+  { 0xD583u, 0.00000000 },
+  { 0xD584u, 0.00000000 },
+  { 0xD585u, 0.00000000 },
+  { 0xD586u, 0.00000000 },
+  { 0xD587u, 0.00000000 },
+  { 0xD588u, 0.00390000 },
+  { 0xD589u, 0.00200000 },
+  { 0xD58Au, 0.00000000 },
+  { 0xD58Bu, 0.00000000 },
+  { 0xD58Cu, 0.00000000 },
+  { 0xD58Du, 0.00000000 },
+  { 0xD58Eu, 0.00000000 },
+  { 0xD58Fu, 0.00000000 },
+  { 0xD590u, 0.00000000 },
+  { 0xD591u, 0.00000000 },
+  { 0xD592u, 0.00000000 },
+  { 0xD593u, 0.00000000 },
+  { 0xD594u, 0.00000000 },
+  { 0xD595u, 0.00000000 },
+  { 0xD596u, 0.00000000 },
+  { 0xD597u, 0.00000000 },
+  { 0xD598u, 0.00000000 },
+  { 0xD599u, 0.00000000 },
+  { 0xD59Au, 0.00000000 },
+  { 0xD59Bu, 0.00000000 },
+  { 0xD59Cu, 0.00000000 },
+  { 0xD59Du, 0.00000000 },
+  { 0xD59Eu, 0.00000000 },
+  { 0xD59Fu, 0.00000000 },
+  { 0xD5A0u, 0.00000000 },
+  { 0xD5A1u, 0.00000000 },
+  { 0xD5A2u, 0.00000000 },
+  { 0xD5A3u, 0.00000000 },
+  { 0xD5A4u, 0.00000000 },
+  { 0xD5A5u, 0.00080000 },
+  { 0xD5A6u, 0.00000000 },
+  { 0xD5A7u, 0.00000000 },
+  { 0xD5A8u, 0.00000000 },
+  { 0xD5A9u, 0.00000000 },
+  { 0xD5AAu, 0.00000000 },
+  { 0xD5ABu, 0.00000000 },
+  { 0xD5ACu, 0.00000000 },
+  { 0xD5ADu, 0.00000000 },
+  { 0xD5AEu, 0.00000000 },
+  { 0xD5AFu, 0.00000000 },
+  { 0xD5B0u, 0.00000000 },
+  { 0xD5B1u, 0.00000000 },
+  { 0xD5B2u, 0.00000000 },
+  { 0xD5B3u, 0.00000000 },
+  { 0xD5B4u, 0.00000000 },
+  { 0xD5B5u, 0.00000000 },
+  { 0xD5B6u, 0.00000000 },
+  { 0xD5B7u, 0.00000000 },
+  { 0xD5B8u, 0.00000000 },
+  { 0xD5B9u, 0.00000000 },
+  { 0xD5BAu, 0.00000000 },
+  { 0xD5BBu, 0.00000000 },
+  { 0xD5BCu, 0.00000000 },
+  { 0xD5BDu, 0.00000000 },
+  { 0xD5BEu, 0.00000000 },
+  { 0xD5BFu, 0.00000000 },
+  { 0xD5C0u, 0.00000000 },
+  { 0xD5C1u, 0.00000000 },
+  { 0xD5C2u, 0.00000000 },
+  { 0xD5C3u, 0.00000000 },
+  { 0xD5C4u, 0.00000000 },
+  { 0xD5C5u, 0.00000000 },
+  { 0xD5C6u, 0.00000000 },
+  { 0xD5C7u, 0.00000000 },
+  { 0xD5C8u, 0.00030000 },
+  { 0xD5C9u, 0.00000000 },
+  { 0xD5CAu, 0.00000000 },
+  { 0xD5CBu, 0.00000000 },
+  { 0xD5CCu, 0.00030000 },
+  { 0xD5CDu, 0.00000000 },
+  { 0xD5CEu, 0.00000000 },
+  { 0xD5CFu, 0.00000000 },
+  { 0xD5D0u, 0.00000000 },
+  { 0xD5D1u, 0.00000000 },
+  { 0xD5D2u, 0.00000000 },
+  { 0xD5D3u, 0.00000000 },
+  { 0xD5D4u, 0.00000000 },
+  { 0xD5D5u, 0.00000000 },
+  { 0xD5D6u, 0.00000000 },
+  { 0xD5D7u, 0.00000000 },
+  { 0xD5D8u, 0.00040000 },
+  { 0xD5D9u, 0.00000000 },
+  { 0xD5DAu, 0.00000000 },
+  { 0xD5DBu, 0.00000000 },
+  { 0xD5DCu, 0.00000000 },
+  { 0xD5DDu, 0.00010000 },
+  { 0xD5DEu, 0.00000000 },
+  { 0xD5DFu, 0.00000000 },
+  { 0xD5E0u, 0.00000000 },
+  { 0xD5E1u, 0.00000000 },
+  { 0xD5E2u, 0.00000000 },
+  { 0xD5E3u, 0.00000000 },
+  { 0xD5E4u, 0.00020000 },
+  { 0xD5E5u, 0.00000000 },
+  { 0xD5E6u, 0.00000000 },
+  { 0xD5E7u, 0.00000000 },
+  { 0xD5E8u, 0.00010000 },
+  { 0xD5E9u, 0.00000000 },
+  { 0xD5EAu, 0.00000000 },
+  { 0xD5EBu, 0.00000000 },
+  { 0xD5ECu, 0.00010000 },
+  { 0xD5EDu, 0.00000000 },
+  { 0xD5EEu, 0.00000000 },
+  { 0xD5EFu, 0.00000000 },
+  { 0xD5F0u, 0.00000000 },
+  { 0xD5F1u, 0.00000000 },
+  { 0xD5F2u, 0.00000000 },
+  { 0xD5F3u, 0.00000000 },
+  { 0xD5F4u, 0.00000000 },
+  { 0xD5F5u, 0.00000000 },
+  { 0xD5F6u, 0.00000000 },
+  { 0xD5F7u, 0.00000000 },
+  { 0xD5F8u, 0.00000000 },
+  { 0xD5F9u, 0.00000000 },
+  { 0xD5FAu, 0.00000000 },
+  { 0xD5FBu, 0.00000000 },
+  { 0xD5FCu, 0.00000000 },
+  { 0xD5FDu, 0.00000000 },
+  { 0xD5FEu, 0.00000000 },
+  { 0xD5FFu, 0.00000000 },
+  { 0xD600u, 0.00020000 },
+  { 0xD601u, 0.00030000 },
+  { 0xD602u, 0.00000000 },
+  { 0xD603u, 0.00000000 },
+  { 0xD604u, 0.00190000 },
+  { 0xD605u, 0.00000000 },
+  { 0xD606u, 0.00000000 },
+  { 0xD607u, 0.00000000 },
+  { 0xD608u, 0.00010000 },
+  { 0xD609u, 0.00000000 },
+  { 0xD60Au, 0.00000000 },
+  { 0xD60Bu, 0.00000000 },
+  { 0xD60Cu, 0.00000000 },
+  { 0xD60Du, 0.00000000 },
+  { 0xD60Eu, 0.00000000 },
+  { 0xD60Fu, 0.00000000 },
+  { 0xD610u, 0.00000000 },
+  { 0xD611u, 0.00040000 },
+  { 0xD612u, 0.00000000 },
+  { 0xD613u, 0.00000000 },
+  { 0xD614u, 0.00010000 },
+  { 0xD615u, 0.00140000 },
+  { 0xD616u, 0.00000000 },
+  { 0xD617u, 0.00000000 },
+  { 0xD618u, 0.00000000 },
+  { 0xD619u, 0.00000000 },
+  { 0xD61Au, 0.00000000 },
+  { 0xD61Bu, 0.00000000 },
+  { 0xD61Cu, 0.00010000 },
+  { 0xD61Du, 0.00000000 },
+  { 0xD61Eu, 0.00000000 },
+  { 0xD61Fu, 0.00000000 },
+  { 0xD620u, 0.00000000 },
+  { 0xD621u, 0.00000000 },
+  { 0xD622u, 0.00000000 },
+  { 0xD623u, 0.00000000 },
+  { 0xD624u, 0.00000000 },
+  { 0xD625u, 0.00000000 },
+  { 0xD626u, 0.00000000 },
+  { 0xD627u, 0.00000000 },
+  { 0xD628u, 0.00000000 },
+  { 0xD629u, 0.00000000 },
+  { 0xD62Au, 0.00000000 },
+  { 0xD62Bu, 0.00000000 },
+  { 0xD62Cu, 0.00000000 },
+  { 0xD62Du, 0.00000000 },
+  { 0xD62Eu, 0.00000000 },
+  { 0xD62Fu, 0.00000000 },
+  { 0xD630u, 0.00000000 },
+  { 0xD631u, 0.00000000 },
+  { 0xD632u, 0.00000000 },
+  { 0xD633u, 0.00000000 },
+  { 0xD634u, 0.00000000 },
+  { 0xD635u, 0.00000000 },
+  { 0xD636u, 0.00000000 },
+  { 0xD637u, 0.00000000 },
+  { 0xD638u, 0.00170000 },
+  { 0xD639u, 0.00020000 },
+  { 0xD63Au, 0.00000000 },
+  { 0xD63Bu, 0.00000000 },
+  { 0xD63Cu, 0.00040000 },
+  { 0xD63Du, 0.00000000 },
+  { 0xD63Eu, 0.00000000 },
+  { 0xD63Fu, 0.00000000 },
+  { 0xD640u, 0.00010000 },
+  { 0xD641u, 0.00000000 },
+  { 0xD642u, 0.00000000 },
+  { 0xD643u, 0.00000000 },
+  { 0xD644u, 0.00000000 },
+  { 0xD645u, 0.00000000 },
+  { 0xD646u, 0.00000000 },
+  { 0xD647u, 0.00000000 },
+  { 0xD648u, 0.00010000 },
+  { 0xD649u, 0.00000000 },
+  { 0xD64Au, 0.00000000 },
+  { 0xD64Bu, 0.00000000 },
+  { 0xD64Cu, 0.00000000 },
+  { 0xD64Du, 0.00030000 },
+  { 0xD64Eu, 0.00000000 },
+  { 0xD64Fu, 0.00000000 },
+  { 0xD650u, 0.00000000 },
+  { 0xD651u, 0.00000000 },
+  { 0xD652u, 0.00000000 },
+  { 0xD653u, 0.00000000 },
+  { 0xD654u, 0.00330000 },
+  { 0xD655u, 0.00050000 },
+  { 0xD656u, 0.00000000 },
+  { 0xD657u, 0.00000000 },
+  { 0xD658u, 0.00060000 },
+  { 0xD659u, 0.00000000 },
+  { 0xD65Au, 0.00000000 },
+  { 0xD65Bu, 0.00000000 },
+  { 0xD65Cu, 0.00100000 },
+  { 0xD65Du, 0.00000000 },
+  { 0xD65Eu, 0.00000000 },
+  { 0xD65Fu, 0.00000000 },
+  { 0xD660u, 0.00000000 },
+  { 0xD661u, 0.00000000 },
+  { 0xD662u, 0.00000000 },
+  { 0xD663u, 0.00000000 },
+  { 0xD664u, 0.00000000 },
+  { 0xD665u, 0.00000000 },
+  { 0xD666u, 0.00000000 },
+  { 0xD667u, 0.00000000 },
+  { 0xD668u, 0.00000000 },
+  { 0xD669u, 0.00080000 },
+  { 0xD66Au, 0.00000000 },
+  { 0xD66Bu, 0.00000000 },
+  { 0xD66Cu, 0.00000000 },
+  { 0xD66Du, 0.00000000 },
+  { 0xD66Eu, 0.00000000 },
+  { 0xD66Fu, 0.00000000 },
+  { 0xD670u, 0.00000000 },
+  { 0xD671u, 0.00000000 },
+  { 0xD672u, 0.00000000 },
+  { 0xD673u, 0.00000000 },
+  { 0xD674u, 0.00000000 },
+  { 0xD675u, 0.00000000 },
+  { 0xD676u, 0.00000000 },
+  { 0xD677u, 0.00000000 },
+  { 0xD678u, 0.00000000 },
+  { 0xD679u, 0.00000000 },
+  { 0xD67Au, 0.00000000 },
+  { 0xD67Bu, 0.00000000 },
+  { 0xD67Cu, 0.00000000 },
+  { 0xD67Du, 0.00000000 },
+  { 0xD67Eu, 0.00000000 },
+  { 0xD67Fu, 0.00000000 },
+  { 0xD680u, 0.00000000 },
+  { 0xD681u, 0.00000000 },
+  { 0xD682u, 0.00000000 },
+  { 0xD683u, 0.00000000 },
+  { 0xD684u, 0.00000000 },
+  { 0xD685u, 0.00000000 },
+  { 0xD686u, 0.00000000 },
+  { 0xD687u, 0.00000000 },
+  { 0xD688u, 0.00000000 },
+  { 0xD689u, 0.00000000 },
+  { 0xD68Au, 0.00000000 },
+  { 0xD68Bu, 0.00000000 },
+  { 0xD68Cu, 0.00280000 },
+  { 0xD68Du, 0.00030000 },
+  { 0xD68Eu, 0.00000000 },
+  { 0xD68Fu, 0.00000000 },
+  { 0xD690u, 0.00000000 },
+  { 0xD691u, 0.00000000 },
+  { 0xD692u, 0.00000000 },
+  { 0xD693u, 0.00000000 },
+  { 0xD694u, 0.00000000 },
+  { 0xD695u, 0.00000000 },
+  { 0xD696u, 0.00000000 },
+  { 0xD697u, 0.00000000 },
+  { 0xD698u, 0.00000000 },
+  { 0xD699u, 0.00000000 },
+  { 0xD69Au, 0.00000000 },
+  { 0xD69Bu, 0.00000000 },
+  { 0xD69Cu, 0.00000000 },
+  { 0xD69Du, 0.00000000 },
+  { 0xD69Eu, 0.00000000 },
+  { 0xD69Fu, 0.00000000 },
+  { 0xD6A0u, 0.00000000 },
+  { 0xD6A1u, 0.00000000 },
+  { 0xD6A2u, 0.00000000 },
+  { 0xD6A3u, 0.00000000 },
+  { 0xD6A4u, 0.00000000 },
+  { 0xD6A5u, 0.00000000 },
+  { 0xD6A6u, 0.00000000 },
+  { 0xD6A7u, 0.00000000 },
+  { 0xD6A8u, 0.00030000 },
+  { 0xD6A9u, 0.00000000 },
+  { 0xD6AAu, 0.00000000 },
+  { 0xD6ABu, 0.00000000 },
+  { 0xD6ACu, 0.00000000 },
+  { 0xD6ADu, 0.00000000 },
+  { 0xD6AEu, 0.00000000 },
+  { 0xD6AFu, 0.00000000 },
+  { 0xD6B0u, 0.00000000 },
+  { 0xD6B1u, 0.00000000 },
+  { 0xD6B2u, 0.00000000 },
+  { 0xD6B3u, 0.00000000 },
+  { 0xD6B4u, 0.00000000 },
+  { 0xD6B5u, 0.00000000 },
+  { 0xD6B6u, 0.00000000 },
+  { 0xD6B7u, 0.00000000 },
+  { 0xD6B8u, 0.00000000 },
+  { 0xD6B9u, 0.00000000 },
+  { 0xD6BAu, 0.00000000 },
+  { 0xD6BBu, 0.00000000 },
+  { 0xD6BCu, 0.00000000 },
+  { 0xD6BDu, 0.00000000 },
+  { 0xD6BEu, 0.00000000 },
+  { 0xD6BFu, 0.00000000 },
+  { 0xD6C0u, 0.00000000 },
+  { 0xD6C1u, 0.00000000 },
+  { 0xD6C2u, 0.00000000 },
+  { 0xD6C3u, 0.00000000 },
+  { 0xD6C4u, 0.00290000 },
+  { 0xD6C5u, 0.00000000 },
+  { 0xD6C6u, 0.00000000 },
+  { 0xD6C7u, 0.00000000 },
+  { 0xD6C8u, 0.00020000 },
+  { 0xD6C9u, 0.00000000 },
+  { 0xD6CAu, 0.00000000 },
+  { 0xD6CBu, 0.00000000 },
+  { 0xD6CCu, 0.00000000 },
+  { 0xD6CDu, 0.00000000 },
+  { 0xD6CEu, 0.00000000 },
+  { 0xD6CFu, 0.00000000 },
+  { 0xD6D0u, 0.00000000 },
+  { 0xD6D1u, 0.00000000 },
+  { 0xD6D2u, 0.00000000 },
+  { 0xD6D3u, 0.00000000 },
+  { 0xD6D4u, 0.00000000 },
+  { 0xD6D5u, 0.00000000 },
+  { 0xD6D6u, 0.00000000 },
+  { 0xD6D7u, 0.00000000 },
+  { 0xD6D8u, 0.00000000 },
+  { 0xD6D9u, 0.00000000 },
+  { 0xD6DAu, 0.00000000 },
+  { 0xD6DBu, 0.00000000 },
+  { 0xD6DCu, 0.00000000 },
+  { 0xD6DDu, 0.00000000 },
+  { 0xD6DEu, 0.00000000 },
+  { 0xD6DFu, 0.00000000 },
+  { 0xD6E0u, 0.00000000 },
+  { 0xD6E1u, 0.00000000 },
+  { 0xD6E2u, 0.00000000 },
+  { 0xD6E3u, 0.00000000 },
+  { 0xD6E4u, 0.00000000 },
+  { 0xD6E5u, 0.00000000 },
+  { 0xD6E6u, 0.00000000 },
+  { 0xD6E7u, 0.00000000 },
+  { 0xD6E8u, 0.00000000 },
+  { 0xD6E9u, 0.00000000 },
+  { 0xD6EAu, 0.00000000 },
+  { 0xD6EBu, 0.00000000 },
+  { 0xD6ECu, 0.00000000 },
+  { 0xD6EDu, 0.00000000 },
+  { 0xD6EEu, 0.00000000 },
+  { 0xD6EFu, 0.00000000 },
+  { 0xD6F0u, 0.00000000 },
+  { 0xD6F1u, 0.00000000 },
+  { 0xD6F2u, 0.00000000 },
+  { 0xD6F3u, 0.00000000 },
+  { 0xD6F4u, 0.00000000 },
+  { 0xD6F5u, 0.00000000 },
+  { 0xD6F6u, 0.00000000 },
+  { 0xD6F7u, 0.00000000 },
+  { 0xD6F8u, 0.00000000 },
+  { 0xD6F9u, 0.00000000 },
+  { 0xD6FAu, 0.00000000 },
+  { 0xD6FBu, 0.00000000 },
+  { 0xD6FCu, 0.00000000 },
+  { 0xD6FDu, 0.00000000 },
+  { 0xD6FEu, 0.00000000 },
+  { 0xD6FFu, 0.00000000 },
+  { 0xD700u, 0.00000000 },
+  { 0xD701u, 0.00000000 },
+  { 0xD702u, 0.00000000 },
+  { 0xD703u, 0.00000000 },
+  { 0xD704u, 0.00000000 },
+  { 0xD705u, 0.00000000 },
+  { 0xD706u, 0.00000000 },
+  { 0xD707u, 0.00000000 },
+  { 0xD708u, 0.00000000 },
+  { 0xD709u, 0.00000000 },
+  { 0xD70Au, 0.00000000 },
+  { 0xD70Bu, 0.00000000 },
+  { 0xD70Cu, 0.00000000 },
+  { 0xD70Du, 0.00000000 },
+  { 0xD70Eu, 0.00000000 },
+  { 0xD70Fu, 0.00000000 },
+  { 0xD710u, 0.00000000 },
+  { 0xD711u, 0.00000000 },
+  { 0xD712u, 0.00000000 },
+  { 0xD713u, 0.00000000 },
+  { 0xD714u, 0.00000000 },
+  { 0xD715u, 0.00000000 },
+  { 0xD716u, 0.00000000 },
+  { 0xD717u, 0.00000000 },
+  { 0xD718u, 0.00020000 },
+  { 0xD719u, 0.00000000 },
+  { 0xD71Au, 0.00000000 },
+  { 0xD71Bu, 0.00000000 },
+  { 0xD71Cu, 0.00000000 },
+  { 0xD71Du, 0.00000000 },
+  { 0xD71Eu, 0.00000000 },
+  { 0xD71Fu, 0.00000000 },
+  { 0xD720u, 0.00000000 },
+  { 0xD721u, 0.00000000 },
+  { 0xD722u, 0.00000000 },
+  { 0xD723u, 0.00000000 },
+  { 0xD724u, 0.00000000 },
+  { 0xD725u, 0.00000000 },
+  { 0xD726u, 0.00000000 },
+  { 0xD727u, 0.00000000 },
+  { 0xD728u, 0.00000000 },
+  { 0xD729u, 0.00000000 },
+  { 0xD72Au, 0.00000000 },
+  { 0xD72Bu, 0.00000000 },
+  { 0xD72Cu, 0.00000000 },
+  { 0xD72Du, 0.00000000 },
+  { 0xD72Eu, 0.00000000 },
+  { 0xD72Fu, 0.00000000 },
+  { 0xD730u, 0.00000000 },
+  { 0xD731u, 0.00000000 },
+  { 0xD732u, 0.00000000 },
+  { 0xD733u, 0.00000000 },
+  { 0xD734u, 0.00010000 },
+  { 0xD735u, 0.00000000 },
+  { 0xD736u, 0.00000000 },
+  { 0xD737u, 0.00000000 },
+  { 0xD738u, 0.00000000 },
+  { 0xD739u, 0.00000000 },
+  { 0xD73Au, 0.00000000 },
+  { 0xD73Bu, 0.00000000 },
+  { 0xD73Cu, 0.00000000 },
+  { 0xD73Du, 0.00000000 },
+  { 0xD73Eu, 0.00000000 },
+  { 0xD73Fu, 0.00000000 },
+  { 0xD740u, 0.00000000 },
+  { 0xD741u, 0.00000000 },
+  { 0xD742u, 0.00000000 },
+  { 0xD743u, 0.00000000 },
+  { 0xD744u, 0.00000000 },
+  { 0xD745u, 0.00000000 },
+  { 0xD746u, 0.00000000 },
+  { 0xD747u, 0.00000000 },
+  { 0xD748u, 0.00000000 },
+  { 0xD749u, 0.00000000 },
+  { 0xD74Au, 0.00000000 },
+  { 0xD74Bu, 0.00000000 },
+  { 0xD74Cu, 0.00000000 },
+  { 0xD74Du, 0.00000000 },
+  { 0xD74Eu, 0.00000000 },
+  { 0xD74Fu, 0.00000000 },
+  { 0xD750u, 0.00020000 },
+  { 0xD751u, 0.00010000 },
+  { 0xD752u, 0.00000000 },
+  { 0xD753u, 0.00000000 },
+  { 0xD754u, 0.00010000 },
+  { 0xD755u, 0.00000000 },
+  { 0xD756u, 0.00000000 },
+  { 0xD757u, 0.00000000 },
+  { 0xD758u, 0.00000000 },
+  { 0xD759u, 0.00000000 },
+  { 0xD75Au, 0.00000000 },
+  { 0xD75Bu, 0.00000000 },
+  { 0xD75Cu, 0.00000000 },
+  { 0xD75Du, 0.00000000 },
+  { 0xD75Eu, 0.00000000 },
+  { 0xD75Fu, 0.00000000 },
+  { 0xD760u, 0.00000000 },
+  { 0xD761u, 0.00010000 },
+  { 0xD762u, 0.00000000 },
+  { 0xD763u, 0.00000000 },
+  { 0xD764u, 0.00000000 },
+  { 0xD765u, 0.00020000 },
+  { 0xD766u, 0.00000000 },
+  { 0xD767u, 0.00000000 },
+  { 0xD768u, 0.00000000 },
+  { 0xD769u, 0.00000000 },
+  { 0xD76Au, 0.00000000 },
+  { 0xD76Bu, 0.00000000 },
+  { 0xD76Cu, 0.00030000 },
+  { 0xD76Du, 0.00000000 },
+  { 0xD76Eu, 0.00000000 },
+  { 0xD76Fu, 0.00000000 },
+  { 0xD770u, 0.00000000 },
+  { 0xD771u, 0.00000000 },
+  { 0xD772u, 0.00000000 },
+  { 0xD773u, 0.00000000 },
+  { 0xD774u, 0.00000000 },
+  { 0xD775u, 0.00000000 },
+  { 0xD776u, 0.00000000 },
+  { 0xD777u, 0.00000000 },
+  { 0xD778u, 0.00000000 },
+  { 0xD779u, 0.00000000 },
+  { 0xD77Au, 0.00000000 },
+  { 0xD77Bu, 0.00000000 },
+  { 0xD77Cu, 0.00000000 },
+  { 0xD77Du, 0.00000000 },
+  { 0xD77Eu, 0.00000000 },
+  { 0xD77Fu, 0.00000000 },
+  { 0xD780u, 0.00000000 },
+  { 0xD781u, 0.00000000 },
+  { 0xD782u, 0.00000000 },
+  { 0xD783u, 0.00000000 },
+  { 0xD784u, 0.00000000 },
+  { 0xD785u, 0.00000000 },
+  { 0xD786u, 0.00000000 },
+  { 0xD787u, 0.00000000 },
+  { 0xD788u, 0.00140000 },
+  { 0xD789u, 0.00000000 },
+  { 0xD78Au, 0.00000000 },
+  { 0xD78Bu, 0.00000000 },
+  { 0xD78Cu, 0.00010000 },
+  { 0xD78Du, 0.00000000 },
+  { 0xD78Eu, 0.00000000 },
+  { 0xD78Fu, 0.00000000 },
+  { 0xD790u, 0.00000000 },
+  { 0xD791u, 0.00000000 },
+  { 0xD792u, 0.00000000 },
+  { 0xD793u, 0.00000000 },
+  { 0xD794u, 0.00000000 },
+  { 0xD795u, 0.00000000 },
+  { 0xD796u, 0.00000000 },
+  { 0xD797u, 0.00000000 },
+  { 0xD798u, 0.00020000 },
+  { 0xD799u, 0.00000000 },
+  { 0xD79Au, 0.00000000 },
+  { 0xD79Bu, 0.00000000 },
+  { 0xD79Cu, 0.00000000 },
+  { 0xD79Du, 0.00000000 },
+  { 0xD79Eu, 0.00000000 },
+  { 0xD79Fu, 0.00000000 },
+  { 0xD7A0u, 0.00000000 },
+  { 0xD7A1u, 0.00000000 },
+  { 0xD7A2u, 0.00000000 },
+  { 0xD7A3u, 0.00000000 },
+};
+
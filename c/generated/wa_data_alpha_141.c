@@ -0,0 +1,239 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_141_UPPER[] = {
+  "ॐ",
+  "अ",
+  "आ",
+  "इ",
+  "ई",
+  "उ",
+  "ऊ",
+  "ऋ",
+  "ऌ",
+  "ऍ",
+  "ए",
+  "ऐ",
+  "ऑ",
+  "ओ",
+  "औ",
+  "क",
+  "ख",
+  "ग",
+  "घ",
+  "ङ",
+  "च",
+  "छ",
+  "ज",
+  "झ",
+  "ञ",
+  "ट",
+  "ठ",
+  "ड",
+  "ढ",
+  "ण",
+  "त",
+  "थ",
+  "द",
+  "ध",
+  "न",
+  "प",
+  "फ",
+  "ब",
+  "भ",
+  "म",
+  "य",
+  "र",
+  "ल",
+  "व",
+  "श",
+  "ष",
+  "स",
+  "ह",
+  "ळ",
+  "ऽ",
+};
+const char *ALPHA_141_LOWER[] = {
+  "ॐ",
+  "अ",
+  "आ",
+  "इ",
+  "ई",
+  "उ",
+  "ऊ",
+  "ऋ",
+  "ऌ",
+  "ऍ",
+  "ए",
+  "ऐ",
+  "ऑ",
+  "ओ",
+  "औ",
+  "क",
+  "ख",
+  "ग",
+  "घ",
+  "ङ",
+  "च",
+  "छ",
+  "ज",
+  "झ",
+  "ञ",
+  "ट",
+  "ठ",
+  "ड",
+  "ढ",
+  "ण",
+  "त",
+  "थ",
+  "द",
+  "ध",
+  "न",
+  "प",
+  "फ",
+  "ब",
+  "भ",
+  "म",
+  "य",
+  "र",
+  "ल",
+  "व",
+  "श",
+  "ष",
+  "स",
+  "ह",
+  "ळ",
+  "ऽ",
+};
+const char *ALPHA_141_DIGITS[] = {
+  "०",
+  "१",
+  "२",
+  "३",
+  "४",
+  "५",
+  "६",
+  "७",
+  "८",
+  "९",
+};
+const uint32_t ALPHA_141_UPPER_CPS[] = {
+  2309, 2310, 2311, 2312, 2313, 2314, 2315, 2316, 2317, 2319, 2320, 2321, 2323, 2324, 2325, 2326,
+  2327, 2328, 2329, 2330, 2331, 2332, 2333, 2334, 2335, 2336, 2337, 2338, 2339, 2340, 2341, 2342,
+  2343, 2344, 2346, 2347, 2348, 2349, 2350, 2351, 2352, 2354, 2355, 2357, 2358, 2359, 2360, 2361,
+  2365, 2384,
+};
+const uint32_t ALPHA_141_LOWER_CPS[] = {
+  2309, 2310, 2311, 2312, 2313, 2314, 2315, 2316, 2317, 2319, 2320, 2321, 2323, 2324, 2325, 2326,
+  2327, 2328, 2329, 2330, 2331, 2332, 2333, 2334, 2335, 2336, 2337, 2338, 2339, 2340, 2341, 2342,
+  2343, 2344, 2346, 2347, 2348, 2349, 2350, 2351, 2352, 2354, 2355, 2357, 2358, 2359, 2360, 2361,
+  2365, 2384,
+};
+const uint32_t ALPHA_141_DIGITS_CPS[] = {
+  2406, 2407, 2408, 2409, 2410, 2411, 2412, 2413, 2414, 2415,
+};
+const wa_freq_entry ALPHA_141_FREQ[] = {
+  { "ॐ", 0.00000000 },
+  { "अ", 0.00000000 },
+  { "आ", 0.00000000 },
+  { "इ", 0.00000000 },
+  { "ई", 0.00000000 },
+  { "उ", 0.00000000 },
+  { "ऊ", 0.00000000 },
+  { "ऋ", 0.00000000 },
+  { "ऌ", 0.00000000 },
+  { "ऍ", 0.00000000 },
+  { "ए", 0.00000000 },
+  { "ऐ", 0.00000000 },
+  { "ऑ", 0.00000000 },
+  { "ओ", 0.00000000 },
+  { "औ", 0.00000000 },
+  { "क", 0.00000000 },
+  { "ख", 0.00000000 },
+  { "ग", 0.00000000 },
+  { "घ", 0.00000000 },
+  { "ङ", 0.00000000 },
+  { "च", 0.00000000 },
+  { "छ", 0.00000000 },
+  { "ज", 0.00000000 },
+  { "झ", 0.00000000 },
+  { "ञ", 0.00000000 },
+  { "ट", 0.00000000 },
+  { "ठ", 0.00000000 },
+  { "ड", 0.00000000 },
+  { "ढ", 0.00000000 },
+  { "ण", 0.00000000 },
+  { "त", 0.00000000 },
+  { "थ", 0.00000000 },
+  { "द", 0.00000000 },
+  { "ध", 0.00000000 },
+  { "न", 0.00000000 },
+  { "प", 0.00000000 },
+  { "फ", 0.00000000 },
+  { "ब", 0.00000000 },
+  { "भ", 0.00000000 },
+  { "म", 0.00000000 },
+  { "य", 0.00000000 },
+  { "र", 0.00000000 },
+  { "ल", 0.00000000 },
+  { "व", 0.00000000 },
+  { "श", 0.00000000 },
+  { "ष", 0.00000000 },
+  { "स", 0.00000000 },
+  { "ह", 0.00000000 },
+  { "ळ", 0.00000000 },
+  { "ऽ", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_141_FREQ_CPS[] = {
+  { 0x905u, 0.00000000 },
+  { 0x906u, 0.00000000 },
+  { 0x907u, 0.00000000 },
+  { 0x908u, 0.00000000 },
+  { 0x909u, 0.00000000 },
+  { 0x90Au, 0.00000000 },
+  { 0x90Bu, 0.00000000 },
+  { 0x90Cu, 0.00000000 },
+  { 0x90Du, 0.00000000 },
+  { 0x90Fu, 0.00000000 },
+  { 0x910u, 0.00000000 },
+  { 0x911u, 0.00000000 },
+  { 0x913u, 0.00000000 },
+  { 0x914u, 0.00000000 },
+  { 0x915u, 0.00000000 },
+  { 0x916u, 0.00000000 },
+  { 0x917u, 0.00000000 },
+  { 0x918u, 0.00000000 },
+  { 0x919u, 0.00000000 },
+  { 0x91Au, 0.00000000 },
+  { 0x91Bu, 0.00000000 },
+  { 0x91Cu, 0.00000000 },
+  { 0x91Du, 0.00000000 },
+  { 0x91Eu, 0.00000000 },
+  { 0x91Fu, 0.00000000 },
+  { 0x920u, 0.00000000 },
+  { 0x921u, 0.00000000 },
+  { 0x922u, 0.00000000 },
+  { 0x923u, 0.00000000 },
+  { 0x924u, 0.00000000 },
+  { 0x925u, 0.00000000 },
+  { 0x926u, 0.00000000 },
+  { 0x927u, 0.00000000 },
+  { 0x928u, 0.00000000 },
+  { 0x92Au, 0.00000000 },
+  { 0x92Bu, 0.00000000 },
+  { 0x92Cu, 0.00000000 },
+  { 0x92Du, 0.00000000 },
+  { 0x92Eu, 0.00000000 },
+  { 0x92Fu, 0.00000000 },
+  { 0x930u, 0.00000000 },
+  { 0x932u, 0.00000000 },
+  { 0x933u, 0.00000000 },
+  { 0x935u, 0.00000000 },
+  { 0x936u, 0.00000000 },
+  { 0x937u, 0.00000000 },
+  { 0x938u, 0.00000000 },
+  { 0x939u, 0.00000000 },
+  { 0x93Du, 0.00000000 },
+  { 0x950u, 0.00000000 },
+};
+
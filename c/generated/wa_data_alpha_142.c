@@ -0,0 +1,173 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_142_UPPER[] = {
+  "A",
+  "Ã",
+  "B",
+  "C",
+  "Ç",
+  "D",
+  "E",
+  "Ê",
+  "Ẽ",
+  "F",
+  "G",
+  "H",
+  "I",
+  "Ĩ",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "Ñ",
+  "O",
+  "Ô",
+  "Õ",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+};
+const char *ALPHA_142_LOWER[] = {
+  "a",
+  "ã",
+  "b",
+  "c",
+  "ç",
+  "d",
+  "e",
+  "ê",
+  "ẽ",
+  "f",
+  "g",
+  "h",
+  "i",
+  "ĩ",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "ñ",
+  "o",
+  "ô",
+  "õ",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+};
+const char *ALPHA_142_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_142_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 195, 199, 202, 209, 212, 213,
+  296, 7868,
+};
+const uint32_t ALPHA_142_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 227, 231, 234, 241, 244, 245,
+  297, 7869,
+};
+const uint32_t ALPHA_142_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_142_FREQ[] = {
+  { "a", 0.00000000 },
+  { "ã", 0.00000000 },
+  { "b", 0.00000000 },
+  { "c", 0.00000000 },
+  { "ç", 0.00000000 },
+  { "d", 0.00000000 },
+  { "e", 0.00000000 },
+  { "ê", 0.00000000 },
+  { "ẽ", 0.00000000 },
+  { "f", 0.00000000 },
+  { "g", 0.00000000 },
+  { "h", 0.00000000 },
+  { "i", 0.00000000 },
+  { "ĩ", 0.00000000 },
+  { "j", 0.00000000 },
+  { "k", 0.00000000 },
+  { "l", 0.00000000 },
+  { "m", 0.00000000 },
+  { "n", 0.00000000 },
+  { "ñ", 0.00000000 },
+  { "o", 0.00000000 },
+  { "ô", 0.00000000 },
+  { "õ", 0.00000000 },
+  { "p", 0.00000000 },
+  { "q", 0.00000000 },
+  { "r", 0.00000000 },
+  { "s", 0.00000000 },
+  { "t", 0.00000000 },
+  { "u", 0.00000000 },
+  { "v", 0.00000000 },
+  { "w", 0.00000000 },
+  { "x", 0.00000000 },
+  { "y", 0.00000000 },
+  { "z", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_142_FREQ_CPS[] = {
+  { 0x61u, 0.00000000 },
+  { 0x62u, 0.00000000 },
+  { 0x63u, 0.00000000 },
+  { 0x64u, 0.00000000 },
+  { 0x65u, 0.00000000 },
+  { 0x66u, 0.00000000 },
+  { 0x67u, 0.00000000 },
+  { 0x68u, 0.00000000 },
+  { 0x69u, 0.00000000 },
+  { 0x6Au, 0.00000000 },
+  { 0x6Bu, 0.00000000 },
+  { 0x6Cu, 0.00000000 },
+  { 0x6Du, 0.00000000 },
+  { 0x6Eu, 0.00000000 },
+  { 0x6Fu, 0.00000000 },
+  { 0x70u, 0.00000000 },
+  { 0x71u, 0.00000000 },
+  { 0x72u, 0.00000000 },
+  { 0x73u, 0.00000000 },
+  { 0x74u, 0.00000000 },
+  { 0x75u, 0.00000000 },
+  { 0x76u, 0.00000000 },
+  { 0x77u, 0.00000000 },
+  { 0x78u, 0.00000000 },
+  { 0x79u, 0.00000000 },
+  { 0x7Au, 0.00000000 },
+  { 0xE3u, 0.00000000 },
+  { 0xE7u, 0.00000000 },
+  { 0xEAu, 0.00000000 },
+  { 0xF1u, 0.00000000 },
+  { 0xF4u, 0.00000000 },
+  { 0xF5u, 0.00000000 },
+  { 0x129u, 0.00000000 },
+  { 0x1EBDu, 0.00000000 },
+};
+
@@ -0,0 +1,151 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_143_UPPER[] = {
+  "A",
+  "B",
+  "Ɓ",
+  "D",
+  "E",
+  "Ə",
+  "Ɛ",
+  "F",
+  "G",
+  "Ĝ",
+  "W",
+  "Ɣ",
+  "H",
+  "I",
+  "J",
+  "K",
+  "P",
+  "L",
+  "M",
+  "N",
+  "Y",
+  "Ɲ",
+  "Ŋ",
+  "O",
+  "Ɔ",
+  "T",
+  "U",
+  "V",
+  "Z",
+};
+const char *ALPHA_143_LOWER[] = {
+  "a",
+  "b",
+  "ɓ",
+  "d",
+  "e",
+  "ə",
+  "ɛ",
+  "f",
+  "g",
+  "ĝ",
+  "w",
+  "ɣ",
+  "h",
+  "i",
+  "j",
+  "k",
+  "p",
+  "l",
+  "m",
+  "n",
+  "y",
+  "ɲ",
+  "ŋ",
+  "o",
+  "ɔ",
+  "t",
+  "u",
+  "v",
+  "z",
+};
+const char *ALPHA_143_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_143_UPPER_CPS[] = {
+  65, 66, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 84,
+  85, 86, 87, 89, 90, 284, 330, 385, 390, 399, 400, 404, 413,
+};
+const uint32_t ALPHA_143_LOWER_CPS[] = {
+  97, 98, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 116,
+  117, 118, 119, 121, 122, 285, 331, 595, 596, 601, 603, 611, 626,
+};
+const uint32_t ALPHA_143_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_143_FREQ[] = {
+  { "a", 0.00000000 },
+  { "b", 0.00000000 },
+  { "ɓ", 0.00000000 },
+  { "d", 0.00000000 },
+  { "e", 0.00000000 },
+  { "ə", 0.00000000 },
+  { "ɛ", 0.00000000 },
+  { "f", 0.00000000 },
+  { "g", 0.00000000 },
+  { "ĝ", 0.00000000 },
+  { "w", 0.00000000 },
+  { "ɣ", 0.00000000 },
+  { "h", 0.00000000 },
+  { "i", 0.00000000 },
+  { "j", 0.00000000 },
+  { "k", 0.00000000 },
+  { "p", 0.00000000 },
+  { "l", 0.00000000 },
+  { "m", 0.00000000 },
+  { "n", 0.00000000 },
+  { "y", 0.00000000 },
+  { "ɲ", 0.00000000 },
+  { "ŋ", 0.00000000 },
+  { "o", 0.00000000 },
+  { "ɔ", 0.00000000 },
+  { "t", 0.00000000 },
+  { "u", 0.00000000 },
+  { "v", 0.00000000 },
+  { "z", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_143_FREQ_CPS[] = {
+  { 0x61u, 0.00000000 },
+  { 0x62u, 0.00000000 },
+  { 0x64u, 0.00000000 },
+  { 0x65u, 0.00000000 },
+  { 0x66u, 0.00000000 },
+  { 0x67u, 0.00000000 },
+  { 0x68u, 0.00000000 },
+  { 0x69u, 0.00000000 },
+  { 0x6Au, 0.00000000 },
+  { 0x6Bu, 0.00000000 },
+  { 0x6Cu, 0.00000000 },
+  { 0x6Du, 0.00000000 },
+  { 0x6Eu, 0.00000000 },
+  { 0x6Fu, 0.00000000 },
+  { 0x70u, 0.00000000 },
+  { 0x74u, 0.00000000 },
+  { 0x75u, 0.00000000 },
+  { 0x76u, 0.00000000 },
+  { 0x77u, 0.00000000 },
+  { 0x79u, 0.00000000 },
+  { 0x7Au, 0.00000000 },
+  { 0x11Du, 0.00000000 },
+  { 0x14Bu, 0.00000000 },
+  { 0x253u, 0.00000000 },
+  { 0x254u, 0.00000000 },
+  { 0x259u, 0.00000000 },
+  { 0x25Bu, 0.00000000 },
+  { 0x263u, 0.00000000 },
+  { 0x272u, 0.00000000 },
+};
+
@@ -0,0 +1,211 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_144_UPPER[] = {
+  "ء",
+  "آ",
+  "أ",
+  "ٲ",
+  "ؤ",
+  "ا",
+  "ب",
+  "پ",
+  "ت",
+  "ث",
+  "ٹ",
+  "ج",
+  "چ",
+  "ح",
+  "خ",
+  "د",
+  "ذ",
+  "ڈ",
+  "ر",
+  "ز",
+  "ڑ",
+  "ژ",
+  "س",
+  "ش",
+  "ص",
+  "ض",
+  "ط",
+  "ظ",
+  "ع",
+  "غ",
+  "ف",
+  "ق",
+  "ک",
+  "گ",
+  "ل",
+  "م",
+  "ن",
+  "ں",
+  "ھ",
+  "ہ",
+  "و",
+  "ۄ",
+  "ۆ",
+  "ی",
+  "ؠ",
+  "ے",
+};
+const char *ALPHA_144_LOWER[] = {
+  "ء",
+  "آ",
+  "أ",
+  "ٲ",
+  "ؤ",
+  "ا",
+  "ب",
+  "پ",
+  "ت",
+  "ث",
+  "ٹ",
+  "ج",
+  "چ",
+  "ح",
+  "خ",
+  "د",
+  "ذ",
+  "ڈ",
+  "ر",
+  "ز",
+  "ڑ",
+  "ژ",
+  "س",
+  "ش",
+  "ص",
+  "ض",
+  "ط",
+  "ظ",
+  "ع",
+  "غ",
+  "ف",
+  "ق",
+  "ک",
+  "گ",
+  "ل",
+  "م",
+  "ن",
+  "ں",
+  "ھ",
+  "ہ",
+  "و",
+  "ۄ",
+  "ۆ",
+  "ی",
+  "ؠ",
+  "ے",
+};
+const char *ALPHA_144_DIGITS[] = {
+};
+const uint32_t ALPHA_144_UPPER_CPS[] = {
+  1568, 1569, 1570, 1571, 1572, 1575, 1576, 1578, 1579, 1580, 1581, 1582, 1583, 1584, 1585, 1586,
+  1587, 1588, 1589, 1590, 1591, 1592, 1593, 1594, 1601, 1602, 1604, 1605, 1606, 1608, 1650, 1657,
+  1662, 1670, 1672, 1681, 1688, 1705, 1711, 1722, 1726, 1729, 1732, 1734, 1740, 1746,
+};
+const uint32_t ALPHA_144_LOWER_CPS[] = {
+  1568, 1569, 1570, 1571, 1572, 1575, 1576, 1578, 1579, 1580, 1581, 1582, 1583, 1584, 1585, 1586,
+  1587, 1588, 1589, 1590, 1591, 1592, 1593, 1594, 1601, 1602, 1604, 1605, 1606, 1608, 1650, 1657,
+  1662, 1670, 1672, 1681, 1688, 1705, 1711, 1722, 1726, 1729, 1732, 1734, 1740, 1746,
+};
+const uint32_t ALPHA_144_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_144_FREQ[] = {
+  { "ش", 0.01670000 },
+  { "ح", 0.00770000 },
+  { "ل", 0.03650000 },
+  { "ٹ", 0.01170000 },
+  { "ض", 0.00170000 },
+  { "گ", 0.01440000 },
+  { "ے", 0.00830000 },
+  { "ژ", 0.00460000 },
+  { "ن", 0.08050000 },
+  { "و", 0.05270000 },
+  { "ق", 0.01000000 },
+  { "ھ", 0.04500000 },
+  { "چ", 0.02790000 },
+  { "ی", 0.07250000 },
+  { "م", 0.06250000 },
+  { "ظ", 0.00080000 },
+  { "ہ", 0.07570000 },
+  { "ڈ", 0.00250000 },
+  { "س", 0.04820000 },
+  { "ص", 0.00500000 },
+  { "ت", 0.04380000 },
+  { "ذ", 0.00230000 },
+  { "ۆ", 0.00230000 },
+  { "غ", 0.00210000 },
+  { "پ", 0.02110000 },
+  { "ط", 0.00250000 },
+  { "خ", 0.00500000 },
+  { "ب", 0.02250000 },
+  { "ر", 0.06550000 },
+  { "ڑ", 0.00000000 },
+  { "ث", 0.00130000 },
+  { "أ", 0.00150000 },
+  { "ؤ", 0.00000000 },
+  { "ز", 0.01560000 },
+  { "ع", 0.01000000 },
+  { "ں", 0.00350000 },
+  { "ۄ", 0.00500000 },
+  { "ک", 0.04840000 },
+  { "ء", 0.00020000 },
+  { "آ", 0.01130000 },
+  { "ف", 0.00460000 },
+  { "ٲ", 0.01230000 },
+  { "ا", 0.09050000 },
+  { "ؠ", 0.00000000 },
+  { "ج", 0.00850000 },
+  { "د", 0.03520000 },
+};
+
+const wa_cp_freq ALPHA_144_FREQ_CPS[] = {
+  { 0x620u, 0.00000000 },
+  { 0x621u, 0.00020000 },
+  { 0x622u, 0.01130000 },
+  { 0x623u, 0.00150000 },
+  { 0x624u, 0.00000000 },
+  { 0x627u, 0.09050000 },
+  { 0x628u, 0.02250000 },
+  { 0x62Au, 0.04380000 },
+  { 0x62Bu, 0.00130000 },
+  { 0x62Cu, 0.00850000 },
+  { 0x62Du, 0.00770000 },
+  { 0x62Eu, 0.00500000 },
+  { 0x62Fu, 0.03520000 },
+  { 0x630u, 0.00230000 },
+  { 0x631u, 0.06550000 },
+  { 0x632u, 0.01560000 },
+  { 0x633u, 0.04820000 },
+  { 0x634u, 0.01670000 },
+  { 0x635u, 0.00500000 },
+  { 0x636u, 0.00170000 },
+  { 0x637u, 0.00250000 },
+  { 0x638u, 0.00080000 },
+  { 0x639u, 0.01000000 },
+  { 0x63Au, 0.00210000 },
+  { 0x641u, 0.00460000 },
+  { 0x642u, 0.01000000 },
+  { 0x644u, 0.03650000 },
+  { 0x645u, 0.06250000 },
+  { 0x646u, 0.08050000 },
+  { 0x648u, 0.05270000 },
+  { 0x672u, 0.01230000 },
+  { 0x679u, 0.01170000 },
+  { 0x67Eu, 0.02110000 },
+  { 0x686u, 0.02790000 },
+  { 0x688u, 0.00250000 },
+  { 0x691u, 0.00000000 },
+  { 0x698u, 0.00460000 },
+  { 0x6A9u, 0.04840000 },
+  { 0x6AFu, 0.01440000 },
+  { 0x6BAu, 0.00350000 },
+  { 0x6BEu, 0.04500000 },
+  { 0x6C1u, 0.07570000 },
+  { 0x6C4u, 0.00500000 },
+  { 0x6C6u, 0.00230000 },
+  { 0x6CCu, 0.07250000 },
+  { 0x6D2u, 0.00830000 },
+};
+
@@ -0,0 +1,159 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_145_UPPER[] = {
+  "अ",
+  "आ",
+  "इ",
+  "ई",
+  "उ",
+  "ऊ",
+  "ए",
+  "ऑ",
+  "ओ",
+  "क",
+  "ख",
+  "ग",
+  "च",
+  "छ",
+  "ज",
+  "ट",
+  "ठ",
+  "ड",
+  "त",
+  "थ",
+  "द",
+  "न",
+  "प",
+  "फ",
+  "ब",
+  "म",
+  "य",
+  "र",
+  "ल",
+  "व",
+  "श",
+  "स",
+  "ह",
+};
+const char *ALPHA_145_LOWER[] = {
+  "अ",
+  "आ",
+  "इ",
+  "ई",
+  "उ",
+  "ऊ",
+  "ए",
+  "ऑ",
+  "ओ",
+  "क",
+  "ख",
+  "ग",
+  "च",
+  "छ",
+  "ज",
+  "ट",
+  "ठ",
+  "ड",
+  "त",
+  "थ",
+  "द",
+  "न",
+  "प",
+  "फ",
+  "ब",
+  "म",
+  "य",
+  "र",
+  "ल",
+  "व",
+  "श",
+  "स",
+  "ह",
+};
+const char *ALPHA_145_DIGITS[] = {
+};
+const uint32_t ALPHA_145_UPPER_CPS[] = {
+  2309, 2310, 2311, 2312, 2313, 2314, 2319, 2321, 2323, 2325, 2326, 2327, 2330, 2331, 2332, 2335,
+  2336, 2337, 2340, 2341, 2342, 2344, 2346, 2347, 2348, 2350, 2351, 2352, 2354, 2357, 2358, 2360,
+  2361,
+};
+const uint32_t ALPHA_145_LOWER_CPS[] = {
+  2309, 2310, 2311, 2312, 2313, 2314, 2319, 2321, 2323, 2325, 2326, 2327, 2330, 2331, 2332, 2335,
+  2336, 2337, 2340, 2341, 2342, 2344, 2346, 2347, 2348, 2350, 2351, 2352, 2354, 2357, 2358, 2360,
+  2361,
+};
+const uint32_t ALPHA_145_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_145_FREQ[] = {
+  { "अ", 0.02430000 },
+  { "आ", 0.00490000 },
+  { "इ", 0.00880000 },
+  { "ई", 0.00000000 },
+  { "उ", 0.00100000 },
+  { "ऊ", 0.00000000 },
+  { "ए", 0.00000000 },
+  { "ऑ", 0.00000000 },
+  { "ओ", 0.00390000 },
+  { "क", 0.07390000 },
+  { "ख", 0.02720000 },
+  { "ग", 0.01360000 },
+  { "च", 0.00680000 },
+  { "छ", 0.03400000 },
+  { "ज", 0.04670000 },
+  { "ट", 0.01560000 },
+  { "ठ", 0.00190000 },
+  { "ड", 0.03310000 },
+  { "त", 0.04670000 },
+  { "थ", 0.02140000 },
+  { "द", 0.02820000 },
+  { "न", 0.11580000 },
+  { "प", 0.02630000 },
+  { "फ", 0.01070000 },
+  { "ब", 0.03210000 },
+  { "म", 0.06910000 },
+  { "य", 0.07780000 },
+  { "र", 0.07780000 },
+  { "ल", 0.04380000 },
+  { "व", 0.05250000 },
+  { "श", 0.01560000 },
+  { "स", 0.06130000 },
+  { "ह", 0.02530000 },
+};
+
+const wa_cp_freq ALPHA_145_FREQ_CPS[] = {
+  { 0x905u, 0.02430000 },
+  { 0x906u, 0.00490000 },
+  { 0x907u, 0.00880000 },
+  { 0x908u, 0.00000000 },
+  { 0x909u, 0.00100000 },
+  { 0x90Au, 0.00000000 },
+  { 0x90Fu, 0.00000000 },
+  { 0x911u, 0.00000000 },
+  { 0x913u, 0.00390000 },
+  { 0x915u, 0.07390000 },
+  { 0x916u, 0.02720000 },
+  { 0x917u, 0.01360000 },
+  { 0x91Au, 0.00680000 },
+  { 0x91Bu, 0.03400000 },
+  { 0x91Cu, 0.04670000 },
+  { 0x91Fu, 0.01560000 },
+  { 0x920u, 0.00190000 },
+  { 0x921u, 0.03310000 },
+  { 0x924u, 0.04670000 },
+  { 0x925u, 0.02140000 },
+  { 0x926u, 0.02820000 },
+  { 0x928u, 0.11580000 },
+  { 0x92Au, 0.02630000 },
+  { 0x92Bu, 0.01070000 },
+  { 0x92Cu, 0.03210000 },
+  { 0x92Eu, 0.06910000 },
+  { 0x92Fu, 0.07780000 },
+  { 0x930u, 0.07780000 },
+  { 0x932u, 0.04380000 },
+  { 0x935u, 0.05250000 },
+  { 0x936u, 0.01560000 },
+  { 0x938u, 0.06130000 },
+  { 0x939u, 0.02530000 },
+};
+
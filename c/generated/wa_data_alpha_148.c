@@ -0,0 +1,170 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_148_UPPER[] = {
+  "A",
+  "Å",
+  "Ä",
+  "Æ",
+  "B",
+  "C",
+  "D",
+  "E",
+  "Ë",
+  "Ė",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "Ö",
+  "Œ",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "SS",
+  "T",
+  "U",
+  "Ů",
+  "Ü",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+};
+const char *ALPHA_148_LOWER[] = {
+  "a",
+  "å",
+  "ä",
+  "æ",
+  "b",
+  "c",
+  "d",
+  "e",
+  "ë",
+  "ė",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "ö",
+  "œ",
+  "p",
+  "q",
+  "r",
+  "s",
+  "ss",
+  "t",
+  "u",
+  "ů",
+  "ü",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+};
+const char *ALPHA_148_DIGITS[] = {
+};
+const uint32_t ALPHA_148_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 196, 197, 198, 203, 214, 220,
+  278, 338, 366,
+};
+const uint32_t ALPHA_148_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 228, 229, 230, 235, 246, 252,
+  279, 339, 367,
+};
+const uint32_t ALPHA_148_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_148_FREQ[] = {
+  { "a", 0.06160000 },
+  { "ů", 0.00010000 },
+  { "ė", 0.00060000 },
+  { "t", 0.05510000 },
+  { "w", 0.01740000 },
+  { "ö", 0.02280000 },
+  { "ss", 0.00000000 },
+  { "ë", 0.00100000 },
+  { "h", 0.04890000 },
+  { "œ", 0.00000000 },
+  { "n", 0.07510000 },
+  { "g", 0.01280000 },
+  { "d", 0.06310000 },
+  { "ü", 0.00730000 },
+  { "b", 0.01530000 },
+  { "ä", 0.02530000 },
+  { "e", 0.13340000 },
+  { "o", 0.05500000 },
+  { "z", 0.01190000 },
+  { "x", 0.00070000 },
+  { "p", 0.01400000 },
+  { "i", 0.04770000 },
+  { "k", 0.01890000 },
+  { "l", 0.04080000 },
+  { "v", 0.02260000 },
+  { "c", 0.02920000 },
+  { "j", 0.02370000 },
+  { "m", 0.03240000 },
+  { "u", 0.03020000 },
+  { "s", 0.05770000 },
+  { "q", 0.00020000 },
+  { "f", 0.01270000 },
+  { "å", 0.00000000 },
+  { "æ", 0.00000000 },
+  { "r", 0.06140000 },
+  { "y", 0.00120000 },
+};
+
+const wa_cp_freq ALPHA_148_FREQ_CPS[] = {
+  { 0x61u, 0.06160000 },
+  { 0x62u, 0.01530000 },
+  { 0x63u, 0.02920000 },
+  { 0x64u, 0.06310000 },
+  { 0x65u, 0.13340000 },
+  { 0x66u, 0.01270000 },
+  { 0x67u, 0.01280000 },
+  { 0x68u, 0.04890000 },
+  { 0x69u, 0.04770000 },
+  { 0x6Au, 0.02370000 },
+  { 0x6Bu, 0.01890000 },
+  { 0x6Cu, 0.04080000 },
+  { 0x6Du, 0.03240000 },
+  { 0x6Eu, 0.07510000 },
+  { 0x6Fu, 0.05500000 },
+  { 0x70u, 0.01400000 },
+  { 0x71u, 0.00020000 },
+  { 0x72u, 0.06140000 },
+  { 0x73u, 0.05770000 },
+  { 0x74u, 0.05510000 },
+  { 0x75u, 0.03020000 },
+  { 0x76u, 0.02260000 },
+  { 0x77u, 0.01740000 },
+  { 0x78u, 0.00070000 },
+  { 0x79u, 0.00120000 },
+  { 0x7Au, 0.01190000 },
+  { 0xE4u, 0.02530000 },
+  { 0xE5u, 0.00000000 },
+  { 0xE6u, 0.00000000 },
+  { 0xEBu, 0.00100000 },
+  { 0xF6u, 0.02280000 },
+  { 0xFCu, 0.00730000 },
+  { 0x117u, 0.00060000 },
+  { 0x153u, 0.00000000 },
+  { 0x16Fu, 0.00010000 },
+};
+
@@ -0,0 +1,149 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_149_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "Ç",
+  "D",
+  "E",
+  "Ê",
+  "F",
+  "G",
+  "H",
+  "I",
+  "Î",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "Ş",
+  "T",
+  "U",
+  "Û",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+};
+const char *ALPHA_149_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "ç",
+  "d",
+  "e",
+  "ê",
+  "f",
+  "g",
+  "h",
+  "i",
+  "î",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "q",
+  "r",
+  "s",
+  "ş",
+  "t",
+  "u",
+  "û",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+};
+const char *ALPHA_149_DIGITS[] = {
+};
+const uint32_t ALPHA_149_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 199, 202, 206, 219, 350,
+};
+const uint32_t ALPHA_149_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 231, 234, 238, 251, 351,
+};
+const uint32_t ALPHA_149_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_149_FREQ[] = {
+  { "a", 0.10380000 },
+  { "b", 0.03090000 },
+  { "c", 0.00620000 },
+  { "ç", 0.00550000 },
+  { "d", 0.04710000 },
+  { "e", 0.10790000 },
+  { "ê", 0.05160000 },
+  { "f", 0.00490000 },
+  { "g", 0.01440000 },
+  { "h", 0.02040000 },
+  { "i", 0.08750000 },
+  { "î", 0.04040000 },
+  { "j", 0.01480000 },
+  { "k", 0.04120000 },
+  { "l", 0.02990000 },
+  { "m", 0.02550000 },
+  { "n", 0.07680000 },
+  { "o", 0.02040000 },
+  { "p", 0.01040000 },
+  { "q", 0.00310000 },
+  { "r", 0.06450000 },
+  { "s", 0.02570000 },
+  { "ş", 0.01030000 },
+  { "t", 0.03320000 },
+  { "u", 0.01530000 },
+  { "û", 0.01720000 },
+  { "v", 0.01780000 },
+  { "w", 0.01960000 },
+  { "x", 0.01010000 },
+  { "y", 0.03260000 },
+  { "z", 0.01100000 },
+};
+
+const wa_cp_freq ALPHA_149_FREQ_CPS[] = {
+  { 0x61u, 0.10380000 },
+  { 0x62u, 0.03090000 },
+  { 0x63u, 0.00620000 },
+  { 0x64u, 0.04710000 },
+  { 0x65u, 0.10790000 },
+  { 0x66u, 0.00490000 },
+  { 0x67u, 0.01440000 },
+  { 0x68u, 0.02040000 },
+  { 0x69u, 0.08750000 },
+  { 0x6Au, 0.01480000 },
+  { 0x6Bu, 0.04120000 },
+  { 0x6Cu, 0.02990000 },
+  { 0x6Du, 0.02550000 },
+  { 0x6Eu, 0.07680000 },
+  { 0x6Fu, 0.02040000 },
+  { 0x70u, 0.01040000 },
+  { 0x71u, 0.00310000 },
+  { 0x72u, 0.06450000 },
+  { 0x73u, 0.02570000 },
+  { 0x74u, 0.03320000 },
+  { 0x75u, 0.01530000 },
+  { 0x76u, 0.01780000 },
+  { 0x77u, 0.01960000 },
+  { 0x78u, 0.01010000 },
+  { 0x79u, 0.03260000 },
+  { 0x7Au, 0.01100000 },
+  { 0xE7u, 0.00550000 },
+  { 0xEAu, 0.05160000 },
+  { 0xEEu, 0.04040000 },
+  { 0xFBu, 0.01720000 },
+  { 0x15Fu, 0.01030000 },
+};
+
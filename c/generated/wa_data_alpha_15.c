@@ -0,0 +1,166 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_15_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "Ç",
+  "D",
+  "E",
+  "Ə",
+  "F",
+  "G",
+  "Ğ",
+  "H",
+  "X",
+  "I",
+  "I",
+  "J",
+  "K",
+  "Q",
+  "L",
+  "M",
+  "N",
+  "O",
+  "Ö",
+  "P",
+  "R",
+  "S",
+  "Ş",
+  "T",
+  "U",
+  "Ü",
+  "V",
+  "Y",
+  "Z",
+  "İ",
+};
+const char *ALPHA_15_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "ç",
+  "d",
+  "e",
+  "ə",
+  "f",
+  "g",
+  "ğ",
+  "h",
+  "x",
+  "i",
+  "ı",
+  "j",
+  "k",
+  "q",
+  "l",
+  "m",
+  "n",
+  "o",
+  "ö",
+  "p",
+  "r",
+  "s",
+  "ş",
+  "t",
+  "u",
+  "ü",
+  "v",
+  "y",
+  "z",
+  "i̇",
+};
+const char *ALPHA_15_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_15_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 88, 89, 90, 199, 214, 220, 286, 304, 350, 399,
+};
+const uint32_t ALPHA_15_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 120, 121, 122, 231, 246, 252, 287, 305, 351, 601,
+};
+const uint32_t ALPHA_15_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_15_FREQ[] = {
+  { "a", 0.10210000 },
+  { "b", 0.02420000 },
+  { "c", 0.01080000 },
+  { "ç", 0.00720000 },
+  { "d", 0.05160000 },
+  { "e", 0.02360000 },
+  { "ə", 0.09260000 },
+  { "f", 0.00840000 },
+  { "g", 0.00650000 },
+  { "ğ", 0.00480000 },
+  { "h", 0.01250000 },
+  { "x", 0.00790000 },
+  { "i", 0.10110000 },
+  { "ı", 0.03570000 },
+  { "j", 0.00070000 },
+  { "k", 0.02320000 },
+  { "q", 0.01690000 },
+  { "l", 0.06420000 },
+  { "m", 0.03610000 },
+  { "n", 0.07520000 },
+  { "o", 0.02200000 },
+  { "ö", 0.00720000 },
+  { "p", 0.00610000 },
+  { "r", 0.07070000 },
+  { "s", 0.03650000 },
+  { "ş", 0.01710000 },
+  { "t", 0.03470000 },
+  { "u", 0.02560000 },
+  { "ü", 0.01750000 },
+  { "v", 0.01580000 },
+  { "y", 0.02870000 },
+  { "z", 0.01310000 },
+  { "i̇", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_15_FREQ_CPS[] = {
+  { 0x61u, 0.10210000 },
+  { 0x62u, 0.02420000 },
+  { 0x63u, 0.01080000 },
+  { 0x64u, 0.05160000 },
+  { 0x65u, 0.02360000 },
+  { 0x66u, 0.00840000 },
+  { 0x67u, 0.00650000 },
+  { 0x68u, 0.01250000 },
+  { 0x69u, 0.10110000 },
+  { 0x6Au, 0.00070000 },
+  { 0x6Bu, 0.02320000 },
+  { 0x6Cu, 0.06420000 },
+  { 0x6Du, 0.03610000 },
+  { 0x6Eu, 0.07520000 },
+  { 0x6Fu, 0.02200000 },
+  { 0x70u, 0.00610000 },
+  { 0x71u, 0.01690000 },
+  { 0x72u, 0.07070000 },
+  { 0x73u, 0.03650000 },
+  { 0x74u, 0.03470000 },
+  { 0x75u, 0.02560000 },
+  { 0x76u, 0.01580000 },
+  { 0x78u, 0.00790000 },
+  { 0x79u, 0.02870000 },
+  { 0x7Au, 0.01310000 },
+  { 0xE7u, 0.00720000 },
+  { 0xF6u, 0.00720000 },
+  { 0xFCu, 0.01750000 },
+  { 0x11Fu, 0.00480000 },
+  { 0x131u, 0.03570000 },
+  { 0x15Fu, 0.01710000 },
+  { 0x259u, 0.09260000 },
+};
+
@@ -0,0 +1,129 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_150_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+};
+const char *ALPHA_150_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+};
+const char *ALPHA_150_DIGITS[] = {
+};
+const uint32_t ALPHA_150_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90,
+};
+const uint32_t ALPHA_150_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122,
+};
+const uint32_t ALPHA_150_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_150_FREQ[] = {
+  { "a", 0.11050000 },
+  { "b", 0.01650000 },
+  { "c", 0.00780000 },
+  { "d", 0.03390000 },
+  { "e", 0.10090000 },
+  { "f", 0.00710000 },
+  { "g", 0.02500000 },
+  { "h", 0.04980000 },
+  { "i", 0.03630000 },
+  { "j", 0.00310000 },
+  { "k", 0.03240000 },
+  { "l", 0.03790000 },
+  { "m", 0.02250000 },
+  { "n", 0.10590000 },
+  { "o", 0.06110000 },
+  { "p", 0.01470000 },
+  { "q", 0.00030000 },
+  { "r", 0.06350000 },
+  { "s", 0.07280000 },
+  { "t", 0.04670000 },
+  { "u", 0.01960000 },
+  { "v", 0.01800000 },
+  { "w", 0.04000000 },
+  { "x", 0.00030000 },
+  { "y", 0.07250000 },
+  { "z", 0.00080000 },
+};
+
+const wa_cp_freq ALPHA_150_FREQ_CPS[] = {
+  { 0x61u, 0.11050000 },
+  { 0x62u, 0.01650000 },
+  { 0x63u, 0.00780000 },
+  { 0x64u, 0.03390000 },
+  { 0x65u, 0.10090000 },
+  { 0x66u, 0.00710000 },
+  { 0x67u, 0.02500000 },
+  { 0x68u, 0.04980000 },
+  { 0x69u, 0.03630000 },
+  { 0x6Au, 0.00310000 },
+  { 0x6Bu, 0.03240000 },
+  { 0x6Cu, 0.03790000 },
+  { 0x6Du, 0.02250000 },
+  { 0x6Eu, 0.10590000 },
+  { 0x6Fu, 0.06110000 },
+  { 0x70u, 0.01470000 },
+  { 0x71u, 0.00030000 },
+  { 0x72u, 0.06350000 },
+  { 0x73u, 0.07280000 },
+  { 0x74u, 0.04670000 },
+  { 0x75u, 0.01960000 },
+  { 0x76u, 0.01800000 },
+  { 0x77u, 0.04000000 },
+  { 0x78u, 0.00030000 },
+  { 0x79u, 0.07250000 },
+  { 0x7Au, 0.00080000 },
+};
+
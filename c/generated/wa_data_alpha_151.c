@@ -0,0 +1,151 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_151_UPPER[] = {
+  "ଅ",
+  "ଆ",
+  "ଇ",
+  "ଈ",
+  "ଉ",
+  "ଊ",
+  "ଏ",
+  "କ",
+  "ଗ",
+  "ଙ",
+  "ଚ",
+  "ଜ",
+  "ଞ",
+  "ଟ",
+  "ଡ",
+  "ଣ",
+  "ତ",
+  "ଦ",
+  "ନ",
+  "ପ",
+  "ବ",
+  "ମ",
+  "ୟ",
+  "ର",
+  "ଲ",
+  "ଳ",
+  "ୱ",
+  "ସ",
+  "ହ",
+};
+const char *ALPHA_151_LOWER[] = {
+  "ଅ",
+  "ଆ",
+  "ଇ",
+  "ଈ",
+  "ଉ",
+  "ଊ",
+  "ଏ",
+  "କ",
+  "ଗ",
+  "ଙ",
+  "ଚ",
+  "ଜ",
+  "ଞ",
+  "ଟ",
+  "ଡ",
+  "ଣ",
+  "ତ",
+  "ଦ",
+  "ନ",
+  "ପ",
+  "ବ",
+  "ମ",
+  "ୟ",
+  "ର",
+  "ଲ",
+  "ଳ",
+  "ୱ",
+  "ସ",
+  "ହ",
+};
+const char *ALPHA_151_DIGITS[] = {
+  "0",
+  "୧",
+  "୨",
+  "୩",
+  "୪",
+  "୫",
+  "୬",
+  "୭",
+  "୮",
+  "୯",
+};
+const uint32_t ALPHA_151_UPPER_CPS[] = {
+  2821, 2822, 2823, 2824, 2825, 2826, 2831, 2837, 2839, 2841, 2842, 2844, 2846, 2847, 2849, 2851,
+  2852, 2854, 2856, 2858, 2860, 2862, 2864, 2866, 2867, 2872, 2873, 2911, 2929,
+};
+const uint32_t ALPHA_151_LOWER_CPS[] = {
+  2821, 2822, 2823, 2824, 2825, 2826, 2831, 2837, 2839, 2841, 2842, 2844, 2846, 2847, 2849, 2851,
+  2852, 2854, 2856, 2858, 2860, 2862, 2864, 2866, 2867, 2872, 2873, 2911, 2929,
+};
+const uint32_t ALPHA_151_DIGITS_CPS[] = {
+  48, 2919, 2920, 2921, 2922, 2923, 2924, 2925, 2926, 2927,
+};
+const wa_freq_entry ALPHA_151_FREQ[] = {
+  { "ଅ", 0.00000000 },
+  { "ଆ", 0.00000000 },
+  { "ଇ", 0.00000000 },
+  { "ଈ", 0.00000000 },
+  { "ଉ", 0.00000000 },
+  { "ଊ", 0.00000000 },
+  { "ଏ", 0.00000000 },
+  { "କ", 0.00000000 },
+  { "ଗ", 0.00000000 },
+  { "ଙ", 0.00000000 },
+  { "ଚ", 0.00000000 },
+  { "ଜ", 0.00000000 },
+  { "ଞ", 0.00000000 },
+  { "ଟ", 0.00000000 },
+  { "ଡ", 0.00000000 },
+  { "ଣ", 0.00000000 },
+  { "ତ", 0.00000000 },
+  { "ଦ", 0.00000000 },
+  { "ନ", 0.00000000 },
+  { "ପ", 0.00000000 },
+  { "ବ", 0.00000000 },
+  { "ମ", 0.00000000 },
+  { "ୟ", 0.00000000 },
+  { "ର", 0.00000000 },
+  { "ଲ", 0.00000000 },
+  { "ଳ", 0.00000000 },
+  { "ୱ", 0.00000000 },
+  { "ସ", 0.00000000 },
+  { "ହ", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_151_FREQ_CPS[] = {
+  { 0xB05u, 0.00000000 },
+  { 0xB06u, 0.00000000 },
+  { 0xB07u, 0.00000000 },
+  { 0xB08u, 0.00000000 },
+  { 0xB09u, 0.00000000 },
+  { 0xB0Au, 0.00000000 },
+  { 0xB0Fu, 0.00000000 },
+  { 0xB15u, 0.00000000 },
+  { 0xB17u, 0.00000000 },
+  { 0xB19u, 0.00000000 },
+  { 0xB1Au, 0.00000000 },
+  { 0xB1Cu, 0.00000000 },
+  { 0xB1Eu, 0.00000000 },
+  { 0xB1Fu, 0.00000000 },
+  { 0xB21u, 0.00000000 },
+  { 0xB23u, 0.00000000 },
+  { 0xB24u, 0.00000000 },
+  { 0xB26u, 0.00000000 },
+  { 0xB28u, 0.00000000 },
+  { 0xB2Au, 0.00000000 },
+  { 0xB2Cu, 0.00000000 },
+  { 0xB2Eu, 0.00000000 },
+  { 0xB30u, 0.00000000 },
+  { 0xB32u, 0.00000000 },
+  { 0xB33u, 0.00000000 },
+  { 0xB38u, 0.00000000 },
+  { 0xB39u, 0.00000000 },
+  { 0xB5Fu, 0.00000000 },
+  { 0xB71u, 0.00000000 },
+};
+
@@ -0,0 +1,149 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_152_UPPER[] = {
+  "А",
+  "Б",
+  "Г",
+  "Д",
+  "Е",
+  "Ё",
+  "Ж",
+  "З",
+  "И",
+  "Й",
+  "К",
+  "Л",
+  "М",
+  "Н",
+  "Ң",
+  "О",
+  "Ө",
+  "П",
+  "Р",
+  "С",
+  "Т",
+  "У",
+  "Ү",
+  "Х",
+  "Ч",
+  "Ш",
+  "Ъ",
+  "Ы",
+  "Э",
+  "Ю",
+  "Я",
+};
+const char *ALPHA_152_LOWER[] = {
+  "а",
+  "б",
+  "г",
+  "д",
+  "е",
+  "ё",
+  "ж",
+  "з",
+  "и",
+  "й",
+  "к",
+  "л",
+  "м",
+  "н",
+  "ң",
+  "о",
+  "ө",
+  "п",
+  "р",
+  "с",
+  "т",
+  "у",
+  "ү",
+  "х",
+  "ч",
+  "ш",
+  "ъ",
+  "ы",
+  "э",
+  "ю",
+  "я",
+};
+const char *ALPHA_152_DIGITS[] = {
+};
+const uint32_t ALPHA_152_UPPER_CPS[] = {
+  1025, 1040, 1041, 1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053, 1054, 1055,
+  1056, 1057, 1058, 1059, 1061, 1063, 1064, 1066, 1067, 1069, 1070, 1071, 1186, 1198, 1256,
+};
+const uint32_t ALPHA_152_LOWER_CPS[] = {
+  1072, 1073, 1075, 1076, 1077, 1078, 1079, 1080, 1081, 1082, 1083, 1084, 1085, 1086, 1087, 1088,
+  1089, 1090, 1091, 1093, 1095, 1096, 1098, 1099, 1101, 1102, 1103, 1105, 1187, 1199, 1257,
+};
+const uint32_t ALPHA_152_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_152_FREQ[] = {
+  { "а", 0.12730000 },
+  { "б", 0.02650000 },
+  { "г", 0.03070000 },
+  { "д", 0.04030000 },
+  { "е", 0.05030000 },
+  { "ё", 0.00010000 },
+  { "ж", 0.01690000 },
+  { "з", 0.01410000 },
+  { "и", 0.05070000 },
+  { "й", 0.01550000 },
+  { "к", 0.06180000 },
+  { "л", 0.05170000 },
+  { "м", 0.02890000 },
+  { "н", 0.08070000 },
+  { "ң", 0.00350000 },
+  { "о", 0.04210000 },
+  { "ө", 0.02170000 },
+  { "п", 0.01580000 },
+  { "р", 0.05840000 },
+  { "с", 0.02730000 },
+  { "т", 0.05890000 },
+  { "у", 0.04500000 },
+  { "ү", 0.02700000 },
+  { "х", 0.00210000 },
+  { "ч", 0.01410000 },
+  { "ш", 0.01530000 },
+  { "ъ", 0.00010000 },
+  { "ы", 0.05680000 },
+  { "э", 0.00800000 },
+  { "ю", 0.00200000 },
+  { "я", 0.00630000 },
+};
+
+const wa_cp_freq ALPHA_152_FREQ_CPS[] = {
+  { 0x430u, 0.12730000 },
+  { 0x431u, 0.02650000 },
+  { 0x433u, 0.03070000 },
+  { 0x434u, 0.04030000 },
+  { 0x435u, 0.05030000 },
+  { 0x436u, 0.01690000 },
+  { 0x437u, 0.01410000 },
+  { 0x438u, 0.05070000 },
+  { 0x439u, 0.01550000 },
+  { 0x43Au, 0.06180000 },
+  { 0x43Bu, 0.05170000 },
+  { 0x43Cu, 0.02890000 },
+  { 0x43Du, 0.08070000 },
+  { 0x43Eu, 0.04210000 },
+  { 0x43Fu, 0.01580000 },
+  { 0x440u, 0.05840000 },
+  { 0x441u, 0.02730000 },
+  { 0x442u, 0.05890000 },
+  { 0x443u, 0.04500000 },
+  { 0x445u, 0.00210000 },
+  { 0x447u, 0.01410000 },
+  { 0x448u, 0.01530000 },
+  { 0x44Au, 0.00010000 },
+  { 0x44Bu, 0.05680000 },
+  { 0x44Du, 0.00800000 },
+  { 0x44Eu, 0.00200000 },
+  { 0x44Fu, 0.00630000 },
+  { 0x451u, 0.00010000 },
+  { 0x4A3u, 0.00350000 },
+  { 0x4AFu, 0.02700000 },
+  { 0x4E9u, 0.02170000 },
+};
+
@@ -0,0 +1,129 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_153_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+};
+const char *ALPHA_153_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+};
+const char *ALPHA_153_DIGITS[] = {
+};
+const uint32_t ALPHA_153_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90,
+};
+const uint32_t ALPHA_153_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122,
+};
+const uint32_t ALPHA_153_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_153_FREQ[] = {
+  { "a", 0.10000000 },
+  { "b", 0.01690000 },
+  { "c", 0.04200000 },
+  { "d", 0.02380000 },
+  { "e", 0.09840000 },
+  { "f", 0.00960000 },
+  { "g", 0.01340000 },
+  { "h", 0.01040000 },
+  { "i", 0.11190000 },
+  { "j", 0.00050000 },
+  { "k", 0.00140000 },
+  { "l", 0.03450000 },
+  { "m", 0.04740000 },
+  { "n", 0.06670000 },
+  { "o", 0.05750000 },
+  { "p", 0.02440000 },
+  { "q", 0.00630000 },
+  { "r", 0.06500000 },
+  { "s", 0.06970000 },
+  { "t", 0.07660000 },
+  { "u", 0.06440000 },
+  { "v", 0.01110000 },
+  { "w", 0.00090000 },
+  { "x", 0.00380000 },
+  { "y", 0.00280000 },
+  { "z", 0.00090000 },
+};
+
+const wa_cp_freq ALPHA_153_FREQ_CPS[] = {
+  { 0x61u, 0.10000000 },
+  { 0x62u, 0.01690000 },
+  { 0x63u, 0.04200000 },
+  { 0x64u, 0.02380000 },
+  { 0x65u, 0.09840000 },
+  { 0x66u, 0.00960000 },
+  { 0x67u, 0.01340000 },
+  { 0x68u, 0.01040000 },
+  { 0x69u, 0.11190000 },
+  { 0x6Au, 0.00050000 },
+  { 0x6Bu, 0.00140000 },
+  { 0x6Cu, 0.03450000 },
+  { 0x6Du, 0.04740000 },
+  { 0x6Eu, 0.06670000 },
+  { 0x6Fu, 0.05750000 },
+  { 0x70u, 0.02440000 },
+  { 0x71u, 0.00630000 },
+  { 0x72u, 0.06500000 },
+  { 0x73u, 0.06970000 },
+  { 0x74u, 0.07660000 },
+  { 0x75u, 0.06440000 },
+  { 0x76u, 0.01110000 },
+  { 0x77u, 0.00090000 },
+  { 0x78u, 0.00380000 },
+  { 0x79u, 0.00280000 },
+  { 0x7Au, 0.00090000 },
+};
+
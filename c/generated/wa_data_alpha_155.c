@@ -0,0 +1,141 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_155_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+  "Ä",
+  "É",
+  "Ë",
+};
+const char *ALPHA_155_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+  "ä",
+  "é",
+  "ë",
+};
+const char *ALPHA_155_DIGITS[] = {
+};
+const uint32_t ALPHA_155_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 196, 201, 203,
+};
+const uint32_t ALPHA_155_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 228, 233, 235,
+};
+const uint32_t ALPHA_155_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_155_FREQ[] = {
+  { "a", 0.06880000 },
+  { "b", 0.01540000 },
+  { "c", 0.02910000 },
+  { "d", 0.04490000 },
+  { "e", 0.15070000 },
+  { "f", 0.01570000 },
+  { "g", 0.03260000 },
+  { "h", 0.03600000 },
+  { "i", 0.05910000 },
+  { "j", 0.00390000 },
+  { "k", 0.01410000 },
+  { "l", 0.03870000 },
+  { "m", 0.03270000 },
+  { "n", 0.08930000 },
+  { "o", 0.04070000 },
+  { "p", 0.01530000 },
+  { "q", 0.00070000 },
+  { "r", 0.07300000 },
+  { "s", 0.06330000 },
+  { "t", 0.06120000 },
+  { "u", 0.04530000 },
+  { "v", 0.01420000 },
+  { "w", 0.01270000 },
+  { "x", 0.00120000 },
+  { "y", 0.00230000 },
+  { "z", 0.01150000 },
+  { "ä", 0.00670000 },
+  { "é", 0.01280000 },
+  { "ë", 0.00780000 },
+};
+
+const wa_cp_freq ALPHA_155_FREQ_CPS[] = {
+  { 0x61u, 0.06880000 },
+  { 0x62u, 0.01540000 },
+  { 0x63u, 0.02910000 },
+  { 0x64u, 0.04490000 },
+  { 0x65u, 0.15070000 },
+  { 0x66u, 0.01570000 },
+  { 0x67u, 0.03260000 },
+  { 0x68u, 0.03600000 },
+  { 0x69u, 0.05910000 },
+  { 0x6Au, 0.00390000 },
+  { 0x6Bu, 0.01410000 },
+  { 0x6Cu, 0.03870000 },
+  { 0x6Du, 0.03270000 },
+  { 0x6Eu, 0.08930000 },
+  { 0x6Fu, 0.04070000 },
+  { 0x70u, 0.01530000 },
+  { 0x71u, 0.00070000 },
+  { 0x72u, 0.07300000 },
+  { 0x73u, 0.06330000 },
+  { 0x74u, 0.06120000 },
+  { 0x75u, 0.04530000 },
+  { 0x76u, 0.01420000 },
+  { 0x77u, 0.01270000 },
+  { 0x78u, 0.00120000 },
+  { 0x79u, 0.00230000 },
+  { 0x7Au, 0.01150000 },
+  { 0xE4u, 0.00670000 },
+  { 0xE9u, 0.01280000 },
+  { 0xEBu, 0.00780000 },
+};
+
@@ -0,0 +1,265 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_156_UPPER[] = {
+  "ᰀ",
+  "ᰁ",
+  "ᰂ",
+  "ᰃ",
+  "ᰄ",
+  "ᰅ",
+  "ᰆ",
+  "ᰇ",
+  "ᰈ",
+  "ᰉ",
+  "ᰊ",
+  "ᰋ",
+  "ᰌ",
+  "ᰍ",
+  "ᰎ",
+  "ᰏ",
+  "ᰐ",
+  "ᰑ",
+  "ᰒ",
+  "ᰓ",
+  "ᰔ",
+  "ᰕ",
+  "ᰖ",
+  "ᰗ",
+  "ᰘ",
+  "ᰙ",
+  "ᰚ",
+  "ᰛ",
+  "ᰜ",
+  "ᰝ",
+  "ᰞ",
+  "ᰟ",
+  "ᰠ",
+  "ᰡ",
+  "ᰢ",
+  "ᰣ",
+  "ᰤ",
+  "ᰥ",
+  "ᰦ",
+  "ᰧ",
+  "ᰨ",
+  "ᰩ",
+  "ᰪ",
+  "ᰫ",
+  "ᰬ",
+  "ᰭ",
+  "ᰮ",
+  "ᰯ",
+  "ᰰ",
+  "ᰱ",
+  "ᰲ",
+  "ᰳ",
+  "ᰴ",
+  "ᰵ",
+  "ᰶ",
+  "᰷",
+  "ᱍ",
+  "ᱎ",
+  "ᱏ",
+};
+const char *ALPHA_156_LOWER[] = {
+  "ᰀ",
+  "ᰁ",
+  "ᰂ",
+  "ᰃ",
+  "ᰄ",
+  "ᰅ",
+  "ᰆ",
+  "ᰇ",
+  "ᰈ",
+  "ᰉ",
+  "ᰊ",
+  "ᰋ",
+  "ᰌ",
+  "ᰍ",
+  "ᰎ",
+  "ᰏ",
+  "ᰐ",
+  "ᰑ",
+  "ᰒ",
+  "ᰓ",
+  "ᰔ",
+  "ᰕ",
+  "ᰖ",
+  "ᰗ",
+  "ᰘ",
+  "ᰙ",
+  "ᰚ",
+  "ᰛ",
+  "ᰜ",
+  "ᰝ",
+  "ᰞ",
+  "ᰟ",
+  "ᰠ",
+  "ᰡ",
+  "ᰢ",
+  "ᰣ",
+  "ᰤ",
+  "ᰥ",
+  "ᰦ",
+  "ᰧ",
+  "ᰨ",
+  "ᰩ",
+  "ᰪ",
+  "ᰫ",
+  "ᰬ",
+  "ᰭ",
+  "ᰮ",
+  "ᰯ",
+  "ᰰ",
+  "ᰱ",
+  "ᰲ",
+  "ᰳ",
+  "ᰴ",
+  "ᰵ",
+  "ᰶ",
+  "᰷",
+  "ᱍ",
+  "ᱎ",
+  "ᱏ",
+};
+const char *ALPHA_156_DIGITS[] = {
+};
+const uint32_t ALPHA_156_UPPER_CPS[] = {
+  7168, 7169, 7170, 7171, 7172, 7173, 7174, 7175, 7176, 7177, 7178, 7179, 7180, 7181, 7182, 7183,
+  7184, 7185, 7186, 7187, 7188, 7189, 7190, 7191, 7192, 7193, 7194, 7195, 7196, 7197, 7198, 7199,
+  7200, 7201, 7202, 7203, 7204, 7205, 7206, 7207, 7208, 7209, 7210, 7211, 7212, 7213, 7214, 7215,
+  7216, 7217, 7218, 7219, 7220, 7221, 7222, 7223, 7245, 7246, 7247,
+};
+const uint32_t ALPHA_156_LOWER_CPS[] = {
+  7168, 7169, 7170, 7171, 7172, 7173, 7174, 7175, 7176, 7177, 7178, 7179, 7180, 7181, 7182, 7183,
+  7184, 7185, 7186, 7187, 7188, 7189, 7190, 7191, 7192, 7193, 7194, 7195, 7196, 7197, 7198, 7199,
+  7200, 7201, 7202, 7203, 7204, 7205, 7206, 7207, 7208, 7209, 7210, 7211, 7212, 7213, 7214, 7215,
+  7216, 7217, 7218, 7219, 7220, 7221, 7222, 7223, 7245, 7246, 7247,
+};
+const uint32_t ALPHA_156_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_156_FREQ[] = {
+  { "ᰀ", 0.00000000 },
+  { "ᰁ", 0.00000000 },
+  { "ᰂ", 0.00000000 },
+  { "ᰃ", 0.00000000 },
+  { "ᰄ", 0.00000000 },
+  { "ᰅ", 0.00000000 },
+  { "ᰆ", 0.00000000 },
+  { "ᰇ", 0.00000000 },
+  { "ᰈ", 0.00000000 },
+  { "ᰉ", 0.00000000 },
+  { "ᰊ", 0.00000000 },
+  { "ᰋ", 0.00000000 },
+  { "ᰌ", 0.00000000 },
+  { "ᰍ", 0.00000000 },
+  { "ᰎ", 0.00000000 },
+  { "ᰏ", 0.00000000 },
+  { "ᰐ", 0.00000000 },
+  { "ᰑ", 0.00000000 },
+  { "ᰒ", 0.00000000 },
+  { "ᰓ", 0.00000000 },
+  { "ᰔ", 0.00000000 },
+  { "ᰕ", 0.00000000 },
+  { "ᰖ", 0.00000000 },
+  { "ᰗ", 0.00000000 },
+  { "ᰘ", 0.00000000 },
+  { "ᰙ", 0.00000000 },
+  { "ᰚ", 0.00000000 },
+  { "ᰛ", 0.00000000 },
+  { "ᰜ", 0.00000000 },
+  { "ᰝ", 0.00000000 },
+  { "ᰞ", 0.00000000 },
+  { "ᰟ", 0.00000000 },
+  { "ᰠ", 0.00000000 },
+  { "ᰡ", 0.00000000 },
+  { "ᰢ", 0.00000000 },
+  { "ᰣ", 0.00000000 },
+  { "ᰤ", 0.00000000 },
+  { "ᰥ", 0.00000000 },
+  { "ᰦ", 0.00000000 },
+  { "ᰧ", 0.00000000 },
+  { "ᰨ", 0.00000000 },
+  { "ᰩ", 0.00000000 },
+  { "ᰪ", 0.00000000 },
+  { "ᰫ", 0.00000000 },
+  { "ᰬ", 0.00000000 },
+  { "ᰭ", 0.00000000 },
+  { "ᰮ", 0.00000000 },
+  { "ᰯ", 0.00000000 },
+  { "ᰰ", 0.00000000 },
+  { "ᰱ", 0.00000000 },
+  { "ᰲ", 0.00000000 },
+  { "ᰳ", 0.00000000 },
+  { "ᰴ", 0.00000000 },
+  { "ᰵ", 0.00000000 },
+  { "ᰶ", 0.00000000 },
+  { "᰷", 0.00000000 },
+  { "ᱍ", 0.00000000 },
+  { "ᱎ", 0.00000000 },
+  { "ᱏ", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_156_FREQ_CPS[] = {
+  { 0x1C00u, 0.00000000 },
+  { 0x1C01u, 0.00000000 },
+  { 0x1C02u, 0.00000000 },
+  { 0x1C03u, 0.00000000 },
+  { 0x1C04u, 0.00000000 },
+  { 0x1C05u, 0.00000000 },
+  { 0x1C06u, 0.00000000 },
+  { 0x1C07u, 0.00000000 },
+  { 0x1C08u, 0.00000000 },
+  { 0x1C09u, 0.00000000 },
+  { 0x1C0Au, 0.00000000 },
+  { 0x1C0Bu, 0.00000000 },
+  { 0x1C0Cu, 0.00000000 },
+  { 0x1C0Du, 0.00000000 },
+  { 0x1C0Eu, 0.00000000 },
+  { 0x1C0Fu, 0.00000000 },
+  { 0x1C10u, 0.00000000 },
+  { 0x1C11u, 0.00000000 },
+  { 0x1C12u, 0.00000000 },
+  { 0x1C13u, 0.00000000 },
+  { 0x1C14u, 0.00000000 },
+  { 0x1C15u, 0.00000000 },
+  { 0x1C16u, 0.00000000 },
+  { 0x1C17u, 0.00000000 },
+  { 0x1C18u, 0.00000000 },
+  { 0x1C19u, 0.00000000 },
+  { 0x1C1Au, 0.00000000 },
+  { 0x1C1Bu, 0.00000000 },
+  { 0x1C1Cu, 0.00000000 },
+  { 0x1C1Du, 0.00000000 },
+  { 0x1C1Eu, 0.00000000 },
+  { 0x1C1Fu, 0.00000000 },
+  { 0x1C20u, 0.00000000 },
+  { 0x1C21u, 0.00000000 },
+  { 0x1C22u, 0.00000000 },
+  { 0x1C23u, 0.00000000 },
+  { 0x1C24u, 0.00000000 },
+  { 0x1C25u, 0.00000000 },
+  { 0x1C26u, 0.00000000 },
+  { 0x1C27u, 0.00000000 },
+  { 0x1C28u, 0.00000000 },
+  { 0x1C29u, 0.00000000 },
+  { 0x1C2Au, 0.00000000 },
+  { 0x1C2Bu, 0.00000000 },
+  { 0x1C2Cu, 0.00000000 },
+  { 0x1C2Du, 0.00000000 },
+  { 0x1C2Eu, 0.00000000 },
+  { 0x1C2Fu, 0.00000000 },
+  { 0x1C30u, 0.00000000 },
+  { 0x1C31u, 0.00000000 },
+  { 0x1C32u, 0.00000000 },
+  { 0x1C33u, 0.00000000 },
+  { 0x1C34u, 0.00000000 },
+  { 0x1C35u, 0.00000000 },
+  { 0x1C36u, 0.00000000 },
+  { 0x1C37u, 0.00000000 },
+  { 0x1C4Du, 0.00000000 },
+  { 0x1C4Eu, 0.00000000 },
+  { 0x1C4Fu, 0.00000000 },
+};
+
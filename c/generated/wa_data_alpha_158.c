@@ -0,0 +1,227 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_158_UPPER[] = {
+  "ᤀ",
+  "ᤁ",
+  "ᤂ",
+  "ᤃ",
+  "ᤄ",
+  "ᤅ",
+  "ᤆ",
+  "ᤇ",
+  "ᤈ",
+  "ᤉ",
+  "ᤊ",
+  "ᤋ",
+  "ᤌ",
+  "ᤍ",
+  "ᤎ",
+  "ᤏ",
+  "ᤐ",
+  "ᤑ",
+  "ᤒ",
+  "ᤓ",
+  "ᤔ",
+  "ᤕ",
+  "ᤖ",
+  "ᤗ",
+  "ᤘ",
+  "ᤙ",
+  "ᤚ",
+  "ᤛ",
+  "ᤜ",
+  "ᤝ",
+  "ᤞ",
+  "ᤠ",
+  "ᤡ",
+  "ᤢ",
+  "ᤣ",
+  "ᤤ",
+  "ᤥ",
+  "ᤦ",
+  "ᤧ",
+  "ᤨ",
+  "ᤩ",
+  "ᤪ",
+  "ᤫ",
+  "ᤠ",
+  "ᤡ",
+  "ᤢ",
+  "ᤣ",
+  "ᤤ",
+  "ᤥ",
+  "ᤦ",
+  "ᤧ",
+  "ᤨ",
+  "ᤩ",
+  "ᤪ",
+  "ᤫ",
+  "᥀",
+};
+const char *ALPHA_158_LOWER[] = {
+  "ᤀ",
+  "ᤁ",
+  "ᤂ",
+  "ᤃ",
+  "ᤄ",
+  "ᤅ",
+  "ᤆ",
+  "ᤇ",
+  "ᤈ",
+  "ᤉ",
+  "ᤊ",
+  "ᤋ",
+  "ᤌ",
+  "ᤍ",
+  "ᤎ",
+  "ᤏ",
+  "ᤐ",
+  "ᤑ",
+  "ᤒ",
+  "ᤓ",
+  "ᤔ",
+  "ᤕ",
+  "ᤖ",
+  "ᤗ",
+  "ᤘ",
+  "ᤙ",
+  "ᤚ",
+  "ᤛ",
+  "ᤜ",
+  "ᤝ",
+  "ᤞ",
+  "ᤠ",
+  "ᤡ",
+  "ᤢ",
+  "ᤣ",
+  "ᤤ",
+  "ᤥ",
+  "ᤦ",
+  "ᤧ",
+  "ᤨ",
+  "ᤩ",
+  "ᤪ",
+  "ᤫ",
+  "ᤠ",
+  "ᤡ",
+  "ᤢ",
+  "ᤣ",
+  "ᤤ",
+  "ᤥ",
+  "ᤦ",
+  "ᤧ",
+  "ᤨ",
+  "ᤩ",
+  "ᤪ",
+  "ᤫ",
+  "᥀",
+};
+const char *ALPHA_158_DIGITS[] = {
+};
+const uint32_t ALPHA_158_UPPER_CPS[] = {
+  6400, 6401, 6402, 6403, 6404, 6405, 6406, 6407, 6408, 6409, 6410, 6411, 6412, 6413, 6414, 6415,
+  6416, 6417, 6418, 6419, 6420, 6421, 6422, 6423, 6424, 6425, 6426, 6427, 6428, 6429, 6430, 6432,
+  6433, 6434, 6435, 6436, 6437, 6438, 6439, 6440, 6441, 6442, 6443, 6464,
+};
+const uint32_t ALPHA_158_LOWER_CPS[] = {
+  6400, 6401, 6402, 6403, 6404, 6405, 6406, 6407, 6408, 6409, 6410, 6411, 6412, 6413, 6414, 6415,
+  6416, 6417, 6418, 6419, 6420, 6421, 6422, 6423, 6424, 6425, 6426, 6427, 6428, 6429, 6430, 6432,
+  6433, 6434, 6435, 6436, 6437, 6438, 6439, 6440, 6441, 6442, 6443, 6464,
+};
+const uint32_t ALPHA_158_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_158_FREQ[] = {
+  { "ᤀ", 0.00000000 },
+  { "ᤁ", 0.00000000 },
+  { "ᤂ", 0.00000000 },
+  { "ᤃ", 0.00000000 },
+  { "ᤄ", 0.00000000 },
+  { "ᤅ", 0.00000000 },
+  { "ᤆ", 0.00000000 },
+  { "ᤇ", 0.00000000 },
+  { "ᤈ", 0.00000000 },
+  { "ᤉ", 0.00000000 },
+  { "ᤊ", 0.00000000 },
+  { "ᤋ", 0.00000000 },
+  { "ᤌ", 0.00000000 },
+  { "ᤍ", 0.00000000 },
+  { "ᤎ", 0.00000000 },
+  { "ᤏ", 0.00000000 },
+  { "ᤐ", 0.00000000 },
+  { "ᤑ", 0.00000000 },
+  { "ᤒ", 0.00000000 },
+  { "ᤓ", 0.00000000 },
+  { "ᤔ", 0.00000000 },
+  { "ᤕ", 0.00000000 },
+  { "ᤖ", 0.00000000 },
+  { "ᤗ", 0.00000000 },
+  { "ᤘ", 0.00000000 },
+  { "ᤙ", 0.00000000 },
+  { "ᤚ", 0.00000000 },
+  { "ᤛ", 0.00000000 },
+  { "ᤜ", 0.00000000 },
+  { "ᤝ", 0.00000000 },
+  { "ᤞ", 0.00000000 },
+  { "ᤠ", 0.00000000 },
+  { "ᤡ", 0.00000000 },
+  { "ᤢ", 0.00000000 },
+  { "ᤣ", 0.00000000 },
+  { "ᤤ", 0.00000000 },
+  { "ᤥ", 0.00000000 },
+  { "ᤦ", 0.00000000 },
+  { "ᤧ", 0.00000000 },
+  { "ᤨ", 0.00000000 },
+  { "ᤩ", 0.00000000 },
+  { "ᤪ", 0.00000000 },
+  { "ᤫ", 0.00000000 },
+  { "᥀", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_158_FREQ_CPS[] = {
+  { 0x1900u, 0.00000000 },
+  { 0x1901u, 0.00000000 },
+  { 0x1902u, 0.00000000 },
+  { 0x1903u, 0.00000000 },
+  { 0x1904u, 0.00000000 },
+  { 0x1905u, 0.00000000 },
+  { 0x1906u, 0.00000000 },
+  { 0x1907u, 0.00000000 },
+  { 0x1908u, 0.00000000 },
+  { 0x1909u, 0.00000000 },
+  { 0x190Au, 0.00000000 },
+  { 0x190Bu, 0.00000000 },
+  { 0x190Cu, 0.00000000 },
+  { 0x190Du, 0.00000000 },
+  { 0x190Eu, 0.00000000 },
+  { 0x190Fu, 0.00000000 },
+  { 0x1910u, 0.00000000 },
+  { 0x1911u, 0.00000000 },
+  { 0x1912u, 0.00000000 },
+  { 0x1913u, 0.00000000 },
+  { 0x1914u, 0.00000000 },
+  { 0x1915u, 0.00000000 },
+  { 0x1916u, 0.00000000 },
+  { 0x1917u, 0.00000000 },
+  { 0x1918u, 0.00000000 },
+  { 0x1919u, 0.00000000 },
+  { 0x191Au, 0.00000000 },
+  { 0x191Bu, 0.00000000 },
+  { 0x191Cu, 0.00000000 },
+  { 0x191Du, 0.00000000 },
+  { 0x191Eu, 0.00000000 },
+  { 0x1920u, 0.00000000 },
+  { 0x1921u, 0.00000000 },
+  { 0x1922u, 0.00000000 },
+  { 0x1923u, 0.00000000 },
+  { 0x1924u, 0.00000000 },
+  { 0x1925u, 0.00000000 },
+  { 0x1926u, 0.00000000 },
+  { 0x1927u, 0.00000000 },
+  { 0x1928u, 0.00000000 },
+  { 0x1929u, 0.00000000 },
+  { 0x192Au, 0.00000000 },
+  { 0x192Bu, 0.00000000 },
+  { 0x1940u, 0.00000000 },
+};
+
@@ -0,0 +1,221 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_159_UPPER[] = {
+  "A",
+  "À",
+  "Â",
+  "Ä",
+  "Æ",
+  "B",
+  "C",
+  "Ç",
+  "D",
+  "E",
+  "É",
+  "È",
+  "Ê",
+  "Ë",
+  "F",
+  "G",
+  "H",
+  "I",
+  "Ì",
+  "Î",
+  "Ï",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "Ñ",
+  "O",
+  "Ó",
+  "Ò",
+  "Ô",
+  "Ö",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "Ù",
+  "Û",
+  "Ü",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+};
+const char *ALPHA_159_LOWER[] = {
+  "a",
+  "à",
+  "â",
+  "ä",
+  "æ",
+  "b",
+  "c",
+  "ç",
+  "d",
+  "e",
+  "é",
+  "è",
+  "ê",
+  "ë",
+  "f",
+  "g",
+  "h",
+  "i",
+  "ì",
+  "î",
+  "ï",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "ñ",
+  "o",
+  "ó",
+  "ò",
+  "ô",
+  "ö",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "ù",
+  "û",
+  "ü",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+};
+const char *ALPHA_159_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_159_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 192, 194, 196, 198, 199, 200,
+  201, 202, 203, 204, 206, 207, 209, 210, 211, 212, 214, 217, 219, 220,
+};
+const uint32_t ALPHA_159_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 224, 226, 228, 230, 231, 232,
+  233, 234, 235, 236, 238, 239, 241, 242, 243, 244, 246, 249, 251, 252,
+};
+const uint32_t ALPHA_159_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_159_FREQ[] = {
+  { "a", 0.11210000 },
+  { "à", 0.00130000 },
+  { "â", 0.00570000 },
+  { "ä", 0.00150000 },
+  { "æ", 0.00640000 },
+  { "b", 0.00900000 },
+  { "c", 0.04290000 },
+  { "ç", 0.00820000 },
+  { "d", 0.04280000 },
+  { "e", 0.10720000 },
+  { "é", 0.00150000 },
+  { "è", 0.00390000 },
+  { "ê", 0.00140000 },
+  { "ë", 0.00030000 },
+  { "f", 0.01230000 },
+  { "g", 0.02230000 },
+  { "h", 0.00930000 },
+  { "i", 0.10290000 },
+  { "ì", 0.00150000 },
+  { "î", 0.00130000 },
+  { "ï", 0.00060000 },
+  { "j", 0.00080000 },
+  { "k", 0.00150000 },
+  { "l", 0.03800000 },
+  { "m", 0.03110000 },
+  { "n", 0.07840000 },
+  { "ñ", 0.00060000 },
+  { "o", 0.09100000 },
+  { "ó", 0.00050000 },
+  { "ò", 0.00300000 },
+  { "ô", 0.00160000 },
+  { "ö", 0.00170000 },
+  { "p", 0.02730000 },
+  { "q", 0.00330000 },
+  { "r", 0.05190000 },
+  { "s", 0.04900000 },
+  { "t", 0.06320000 },
+  { "u", 0.03010000 },
+  { "ù", 0.00080000 },
+  { "û", 0.00170000 },
+  { "ü", 0.00200000 },
+  { "v", 0.01620000 },
+  { "w", 0.00060000 },
+  { "x", 0.00440000 },
+  { "y", 0.00090000 },
+  { "z", 0.00590000 },
+};
+
+const wa_cp_freq ALPHA_159_FREQ_CPS[] = {
+  { 0x61u, 0.11210000 },
+  { 0x62u, 0.00900000 },
+  { 0x63u, 0.04290000 },
+  { 0x64u, 0.04280000 },
+  { 0x65u, 0.10720000 },
+  { 0x66u, 0.01230000 },
+  { 0x67u, 0.02230000 },
+  { 0x68u, 0.00930000 },
+  { 0x69u, 0.10290000 },
+  { 0x6Au, 0.00080000 },
+  { 0x6Bu, 0.00150000 },
+  { 0x6Cu, 0.03800000 },
+  { 0x6Du, 0.03110000 },
+  { 0x6Eu, 0.07840000 },
+  { 0x6Fu, 0.09100000 },
+  { 0x70u, 0.02730000 },
+  { 0x71u, 0.00330000 },
+  { 0x72u, 0.05190000 },
+  { 0x73u, 0.04900000 },
+  { 0x74u, 0.06320000 },
+  { 0x75u, 0.03010000 },
+  { 0x76u, 0.01620000 },
+  { 0x77u, 0.00060000 },
+  { 0x78u, 0.00440000 },
+  { 0x79u, 0.00090000 },
+  { 0x7Au, 0.00590000 },
+  { 0xE0u, 0.00130000 },
+  { 0xE2u, 0.00570000 },
+  { 0xE4u, 0.00150000 },
+  { 0xE6u, 0.00640000 },
+  { 0xE7u, 0.00820000 },
+  { 0xE8u, 0.00390000 },
+  { 0xE9u, 0.00150000 },
+  { 0xEAu, 0.00140000 },
+  { 0xEBu, 0.00030000 },
+  { 0xECu, 0.00150000 },
+  { 0xEEu, 0.00130000 },
+  { 0xEFu, 0.00060000 },
+  { 0xF1u, 0.00060000 },
+  { 0xF2u, 0.00300000 },
+  { 0xF3u, 0.00050000 },
+  { 0xF4u, 0.00160000 },
+  { 0xF6u, 0.00170000 },
+  { 0xF9u, 0.00080000 },
+  { 0xFBu, 0.00170000 },
+  { 0xFCu, 0.00200000 },
+};
+
@@ -0,0 +1,205 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_16_UPPER[] = {
+  "А",
+  "Ә",
+  "Б",
+  "В",
+  "Г",
+  "Ғ",
+  "Д",
+  "Ҙ",
+  "Е",
+  "Ё",
+  "Ж",
+  "З",
+  "И",
+  "Й",
+  "К",
+  "Ҡ",
+  "Л",
+  "М",
+  "Н",
+  "Ң",
+  "О",
+  "Ө",
+  "П",
+  "Р",
+  "С",
+  "Ҫ",
+  "Т",
+  "У",
+  "Ү",
+  "Ф",
+  "Х",
+  "Һ",
+  "Ц",
+  "Ч",
+  "Ш",
+  "Щ",
+  "Ъ",
+  "Ы",
+  "Ь",
+  "Э",
+  "Ю",
+  "Я",
+};
+const char *ALPHA_16_LOWER[] = {
+  "а",
+  "ә",
+  "б",
+  "в",
+  "г",
+  "ғ",
+  "д",
+  "ҙ",
+  "е",
+  "ё",
+  "ж",
+  "з",
+  "и",
+  "й",
+  "к",
+  "ҡ",
+  "л",
+  "м",
+  "н",
+  "ң",
+  "о",
+  "ө",
+  "п",
+  "р",
+  "с",
+  "ҫ",
+  "т",
+  "у",
+  "ү",
+  "ф",
+  "х",
+  "һ",
+  "ц",
+  "ч",
+  "ш",
+  "щ",
+  "ъ",
+  "ы",
+  "ь",
+  "э",
+  "ю",
+  "я",
+};
+const char *ALPHA_16_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_16_UPPER_CPS[] = {
+  1025, 1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053, 1054,
+  1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069, 1070,
+  1071, 1170, 1176, 1184, 1186, 1194, 1198, 1210, 1240, 1256,
+};
+const uint32_t ALPHA_16_LOWER_CPS[] = {
+  1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080, 1081, 1082, 1083, 1084, 1085, 1086, 1087,
+  1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103,
+  1105, 1171, 1177, 1185, 1187, 1195, 1199, 1211, 1241, 1257,
+};
+const uint32_t ALPHA_16_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_16_FREQ[] = {
+  { "а", 0.11180000 },
+  { "ә", 0.05510000 },
+  { "б", 0.02660000 },
+  { "в", 0.00760000 },
+  { "г", 0.00970000 },
+  { "ғ", 0.03220000 },
+  { "д", 0.02150000 },
+  { "ҙ", 0.00780000 },
+  { "е", 0.05180000 },
+  { "ё", 0.00010000 },
+  { "ж", 0.00250000 },
+  { "з", 0.00240000 },
+  { "и", 0.02360000 },
+  { "й", 0.04070000 },
+  { "к", 0.03620000 },
+  { "ҡ", 0.01700000 },
+  { "л", 0.06570000 },
+  { "м", 0.02830000 },
+  { "н", 0.06670000 },
+  { "ң", 0.00770000 },
+  { "о", 0.03820000 },
+  { "ө", 0.01080000 },
+  { "п", 0.00690000 },
+  { "р", 0.04640000 },
+  { "с", 0.03950000 },
+  { "ҫ", 0.00330000 },
+  { "т", 0.03950000 },
+  { "у", 0.03350000 },
+  { "ү", 0.00860000 },
+  { "ф", 0.00130000 },
+  { "х", 0.00570000 },
+  { "һ", 0.02290000 },
+  { "ц", 0.00160000 },
+  { "ч", 0.00490000 },
+  { "ш", 0.01570000 },
+  { "щ", 0.00010000 },
+  { "ъ", 0.00030000 },
+  { "ы", 0.09090000 },
+  { "ь", 0.00500000 },
+  { "э", 0.00090000 },
+  { "ю", 0.00150000 },
+  { "я", 0.00750000 },
+};
+
+const wa_cp_freq ALPHA_16_FREQ_CPS[] = {
+  { 0x430u, 0.11180000 },
+  { 0x431u, 0.02660000 },
+  { 0x432u, 0.00760000 },
+  { 0x433u, 0.00970000 },
+  { 0x434u, 0.02150000 },
+  { 0x435u, 0.05180000 },
+  { 0x436u, 0.00250000 },
+  { 0x437u, 0.00240000 },
+  { 0x438u, 0.02360000 },
+  { 0x439u, 0.04070000 },
+  { 0x43Au, 0.03620000 },
+  { 0x43Bu, 0.06570000 },
+  { 0x43Cu, 0.02830000 },
+  { 0x43Du, 0.06670000 },
+  { 0x43Eu, 0.03820000 },
+  { 0x43Fu, 0.00690000 },
+  { 0x440u, 0.04640000 },
+  { 0x441u, 0.03950000 },
+  { 0x442u, 0.03950000 },
+  { 0x443u, 0.03350000 },
+  { 0x444u, 0.00130000 },
+  { 0x445u, 0.00570000 },
+  { 0x446u, 0.00160000 },
+  { 0x447u, 0.00490000 },
+  { 0x448u, 0.01570000 },
+  { 0x449u, 0.00010000 },
+  { 0x44Au, 0.00030000 },
+  { 0x44Bu, 0.09090000 },
+  { 0x44Cu, 0.00500000 },
+  { 0x44Du, 0.00090000 },
+  { 0x44Eu, 0.00150000 },
+  { 0x44Fu, 0.00750000 },
+  { 0x451u, 0.00010000 },
+  { 0x493u, 0.03220000 },
+  { 0x499u, 0.00780000 },
+  { 0x4A1u, 0.01700000 },
+  { 0x4A3u, 0.00770000 },
+  { 0x4ABu, 0.00330000 },
+  { 0x4AFu, 0.00860000 },
+  { 0x4BBu, 0.02290000 },
+  { 0x4D9u, 0.05510000 },
+  { 0x4E9u, 0.01080000 },
+};
+
@@ -0,0 +1,187 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_160_UPPER[] = {
+  "ꓐ",
+  "ꓑ",
+  "ꓒ",
+  "ꓓ",
+  "ꓔ",
+  "ꓕ",
+  "ꓖ",
+  "ꓗ",
+  "ꓘ",
+  "ꓙ",
+  "ꓚ",
+  "ꓛ",
+  "ꓜ",
+  "ꓝ",
+  "ꓞ",
+  "ꓟ",
+  "ꓠ",
+  "ꓡ",
+  "ꓢ",
+  "ꓣ",
+  "ꓤ",
+  "ꓥ",
+  "ꓦ",
+  "ꓧ",
+  "ꓨ",
+  "ꓩ",
+  "ꓪ",
+  "ꓫ",
+  "ꓬ",
+  "ꓭ",
+  "ꓮ",
+  "ꓯ",
+  "ꓰ",
+  "ꓱ",
+  "ꓲ",
+  "ꓳ",
+  "ꓴ",
+  "ꓵ",
+  "ꓶ",
+  "ꓷ",
+};
+const char *ALPHA_160_LOWER[] = {
+  "ꓐ",
+  "ꓑ",
+  "ꓒ",
+  "ꓓ",
+  "ꓔ",
+  "ꓕ",
+  "ꓖ",
+  "ꓗ",
+  "ꓘ",
+  "ꓙ",
+  "ꓚ",
+  "ꓛ",
+  "ꓜ",
+  "ꓝ",
+  "ꓞ",
+  "ꓟ",
+  "ꓠ",
+  "ꓡ",
+  "ꓢ",
+  "ꓣ",
+  "ꓤ",
+  "ꓥ",
+  "ꓦ",
+  "ꓧ",
+  "ꓨ",
+  "ꓩ",
+  "ꓪ",
+  "ꓫ",
+  "ꓬ",
+  "ꓭ",
+  "ꓮ",
+  "ꓯ",
+  "ꓰ",
+  "ꓱ",
+  "ꓲ",
+  "ꓳ",
+  "ꓴ",
+  "ꓵ",
+  "ꓶ",
+  "ꓷ",
+};
+const char *ALPHA_160_DIGITS[] = {
+};
+const uint32_t ALPHA_160_UPPER_CPS[] = {
+  42192, 42193, 42194, 42195, 42196, 42197, 42198, 42199, 42200, 42201, 42202, 42203, 42204, 42205, 42206, 42207,
+  42208, 42209, 42210, 42211, 42212, 42213, 42214, 42215, 42216, 42217, 42218, 42219, 42220, 42221, 42222, 42223,
+  42224, 42225, 42226, 42227, 42228, 42229, 42230, 42231,
+};
+const uint32_t ALPHA_160_LOWER_CPS[] = {
+  42192, 42193, 42194, 42195, 42196, 42197, 42198, 42199, 42200, 42201, 42202, 42203, 42204, 42205, 42206, 42207,
+  42208, 42209, 42210, 42211, 42212, 42213, 42214, 42215, 42216, 42217, 42218, 42219, 42220, 42221, 42222, 42223,
+  42224, 42225, 42226, 42227, 42228, 42229, 42230, 42231,
+};
+const uint32_t ALPHA_160_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_160_FREQ[] = {
+  { "ꓐ", 0.00000000 },
+  { "ꓑ", 0.00000000 },
+  { "ꓒ", 0.00000000 },
+  { "ꓓ", 0.00000000 },
+  { "ꓔ", 0.00000000 },
+  { "ꓕ", 0.00000000 },
+  { "ꓖ", 0.00000000 },
+  { "ꓗ", 0.00000000 },
+  { "ꓘ", 0.00000000 },
+  { "ꓙ", 0.00000000 },
+  { "ꓚ", 0.00000000 },
+  { "ꓛ", 0.00000000 },
+  { "ꓜ", 0.00000000 },
+  { "ꓝ", 0.00000000 },
+  { "ꓞ", 0.00000000 },
+  { "ꓟ", 0.00000000 },
+  { "ꓠ", 0.00000000 },
+  { "ꓡ", 0.00000000 },
+  { "ꓢ", 0.00000000 },
+  { "ꓣ", 0.00000000 },
+  { "ꓤ", 0.00000000 },
+  { "ꓥ", 0.00000000 },
+  { "ꓦ", 0.00000000 },
+  { "ꓧ", 0.00000000 },
+  { "ꓨ", 0.00000000 },
+  { "ꓩ", 0.00000000 },
+  { "ꓪ", 0.00000000 },
+  { "ꓫ", 0.00000000 },
+  { "ꓬ", 0.00000000 },
+  { "ꓭ", 0.00000000 },
+  { "ꓮ", 0.00000000 },
+  { "ꓯ", 0.00000000 },
+  { "ꓰ", 0.00000000 },
+  { "ꓱ", 0.00000000 },
+  { "ꓲ", 0.00000000 },
+  { "ꓳ", 0.00000000 },
+  { "ꓴ", 0.00000000 },
+  { "ꓵ", 0.00000000 },
+  { "ꓶ", 0.00000000 },
+  { "ꓷ", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_160_FREQ_CPS[] = {
+  { 0xA4D0u, 0.00000000 },
+  { 0xA4D1u, 0.00000000 },
+  { 0xA4D2u, 0.00000000 },
+  { 0xA4D3u, 0.00000000 },
+  { 0xA4D4u, 0.00000000 },
+  { 0xA4D5u, 0.00000000 },
+  { 0xA4D6u, 0.00000000 },
+  { 0xA4D7u, 0.00000000 },
+  { 0xA4D8u, 0.00000000 },
+  { 0xA4D9u, 0.00000000 },
+  { 0xA4DAu, 0.00000000 },
+  { 0xA4DBu, 0.00000000 },
+  { 0xA4DCu, 0.00000000 },
+  { 0xA4DDu, 0.00000000 },
+  { 0xA4DEu, 0.00000000 },
+  { 0xA4DFu, 0.00000000 },
+  { 0xA4E0u, 0.00000000 },
+  { 0xA4E1u, 0.00000000 },
+  { 0xA4E2u, 0.00000000 },
+  { 0xA4E3u, 0.00000000 },
+  { 0xA4E4u, 0.00000000 },
+  { 0xA4E5u, 0.00000000 },
+  { 0xA4E6u, 0.00000000 },
+  { 0xA4E7u, 0.00000000 },
+  { 0xA4E8u, 0.00000000 },
+  { 0xA4E9u, 0.00000000 },
+  { 0xA4EAu, 0.00000000 },
+  { 0xA4EBu, 0.00000000 },
+  { 0xA4ECu, 0.00000000 },
+  { 0xA4EDu, 0.00000000 },
+  { 0xA4EEu, 0.00000000 },
+  { 0xA4EFu, 0.00000000 },
+  { 0xA4F0u, 0.00000000 },
+  { 0xA4F1u, 0.00000000 },
+  { 0xA4F2u, 0.00000000 },
+  { 0xA4F3u, 0.00000000 },
+  { 0xA4F4u, 0.00000000 },
+  { 0xA4F5u, 0.00000000 },
+  { 0xA4F6u, 0.00000000 },
+  { 0xA4F7u, 0.00000000 },
+};
+
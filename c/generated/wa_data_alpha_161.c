@@ -0,0 +1,155 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_161_UPPER[] = {
+  "A",
+  "Á",
+  "Ŋ",
+  "B",
+  "Č",
+  "H",
+  "ʼ",
+  "E",
+  "É",
+  "G",
+  "Ǧ",
+  "Ȟ",
+  "I",
+  "Í",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "Ó",
+  "P",
+  "S",
+  "Š",
+  "T",
+  "U",
+  "Ú",
+  "W",
+  "Y",
+  "Z",
+  "Ž",
+};
+const char *ALPHA_161_LOWER[] = {
+  "a",
+  "á",
+  "ŋ",
+  "b",
+  "č",
+  "h",
+  "ʼ",
+  "e",
+  "é",
+  "g",
+  "ǧ",
+  "ȟ",
+  "i",
+  "í",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "ó",
+  "p",
+  "s",
+  "š",
+  "t",
+  "u",
+  "ú",
+  "w",
+  "y",
+  "z",
+  "ž",
+};
+const char *ALPHA_161_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_161_UPPER_CPS[] = {
+  65, 66, 69, 71, 72, 73, 75, 76, 77, 78, 79, 80, 83, 84, 85, 87,
+  89, 90, 193, 201, 205, 211, 218, 268, 330, 352, 381, 486, 542, 700,
+};
+const uint32_t ALPHA_161_LOWER_CPS[] = {
+  97, 98, 101, 103, 104, 105, 107, 108, 109, 110, 111, 112, 115, 116, 117, 119,
+  121, 122, 225, 233, 237, 243, 250, 269, 331, 353, 382, 487, 543, 700,
+};
+const uint32_t ALPHA_161_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_161_FREQ[] = {
+  { "a", 0.00000000 },
+  { "á", 0.00000000 },
+  { "ŋ", 0.00000000 },
+  { "b", 0.00000000 },
+  { "č", 0.00000000 },
+  { "h", 0.00000000 },
+  { "ʼ", 0.00000000 },
+  { "e", 0.00000000 },
+  { "é", 0.00000000 },
+  { "g", 0.00000000 },
+  { "ǧ", 0.00000000 },
+  { "ȟ", 0.00000000 },
+  { "i", 0.00000000 },
+  { "í", 0.00000000 },
+  { "k", 0.00000000 },
+  { "l", 0.00000000 },
+  { "m", 0.00000000 },
+  { "n", 0.00000000 },
+  { "o", 0.00000000 },
+  { "ó", 0.00000000 },
+  { "p", 0.00000000 },
+  { "s", 0.00000000 },
+  { "š", 0.00000000 },
+  { "t", 0.00000000 },
+  { "u", 0.00000000 },
+  { "ú", 0.00000000 },
+  { "w", 0.00000000 },
+  { "y", 0.00000000 },
+  { "z", 0.00000000 },
+  { "ž", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_161_FREQ_CPS[] = {
+  { 0x61u, 0.00000000 },
+  { 0x62u, 0.00000000 },
+  { 0x65u, 0.00000000 },
+  { 0x67u, 0.00000000 },
+  { 0x68u, 0.00000000 },
+  { 0x69u, 0.00000000 },
+  { 0x6Bu, 0.00000000 },
+  { 0x6Cu, 0.00000000 },
+  { 0x6Du, 0.00000000 },
+  { 0x6Eu, 0.00000000 },
+  { 0x6Fu, 0.00000000 },
+  { 0x70u, 0.00000000 },
+  { 0x73u, 0.00000000 },
+  { 0x74u, 0.00000000 },
+  { 0x75u, 0.00000000 },
+  { 0x77u, 0.00000000 },
+  { 0x79u, 0.00000000 },
+  { 0x7Au, 0.00000000 },
+  { 0xE1u, 0.00000000 },
+  { 0xE9u, 0.00000000 },
+  { 0xEDu, 0.00000000 },
+  { 0xF3u, 0.00000000 },
+  { 0xFAu, 0.00000000 },
+  { 0x10Du, 0.00000000 },
+  { 0x14Bu, 0.00000000 },
+  { 0x161u, 0.00000000 },
+  { 0x17Eu, 0.00000000 },
+  { 0x1E7u, 0.00000000 },
+  { 0x21Fu, 0.00000000 },
+  { 0x2BCu, 0.00000000 },
+};
+
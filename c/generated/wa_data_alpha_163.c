@@ -0,0 +1,139 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_163_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+};
+const char *ALPHA_163_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+};
+const char *ALPHA_163_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_163_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90,
+};
+const uint32_t ALPHA_163_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122,
+};
+const uint32_t ALPHA_163_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_163_FREQ[] = {
+  { "a", 0.13080000 },
+  { "b", 0.01460000 },
+  { "c", 0.04670000 },
+  { "d", 0.05990000 },
+  { "e", 0.12040000 },
+  { "f", 0.01330000 },
+  { "g", 0.02220000 },
+  { "h", 0.01670000 },
+  { "i", 0.07590000 },
+  { "j", 0.00160000 },
+  { "k", 0.00510000 },
+  { "l", 0.07940000 },
+  { "m", 0.03530000 },
+  { "n", 0.08080000 },
+  { "o", 0.03700000 },
+  { "p", 0.02680000 },
+  { "q", 0.00160000 },
+  { "r", 0.06750000 },
+  { "s", 0.05340000 },
+  { "t", 0.05600000 },
+  { "u", 0.03170000 },
+  { "v", 0.01340000 },
+  { "w", 0.00120000 },
+  { "x", 0.00050000 },
+  { "y", 0.00100000 },
+  { "z", 0.00740000 },
+};
+
+const wa_cp_freq ALPHA_163_FREQ_CPS[] = {
+  { 0x61u, 0.13080000 },
+  { 0x62u, 0.01460000 },
+  { 0x63u, 0.04670000 },
+  { 0x64u, 0.05990000 },
+  { 0x65u, 0.12040000 },
+  { 0x66u, 0.01330000 },
+  { 0x67u, 0.02220000 },
+  { 0x68u, 0.01670000 },
+  { 0x69u, 0.07590000 },
+  { 0x6Au, 0.00160000 },
+  { 0x6Bu, 0.00510000 },
+  { 0x6Cu, 0.07940000 },
+  { 0x6Du, 0.03530000 },
+  { 0x6Eu, 0.08080000 },
+  { 0x6Fu, 0.03700000 },
+  { 0x70u, 0.02680000 },
+  { 0x71u, 0.00160000 },
+  { 0x72u, 0.06750000 },
+  { 0x73u, 0.05340000 },
+  { 0x74u, 0.05600000 },
+  { 0x75u, 0.03170000 },
+  { 0x76u, 0.01340000 },
+  { 0x77u, 0.00120000 },
+  { 0x78u, 0.00050000 },
+  { 0x79u, 0.00100000 },
+  { 0x7Au, 0.00740000 },
+};
+
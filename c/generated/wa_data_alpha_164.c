@@ -0,0 +1,179 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_164_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "Ɛ",
+  "F",
+  "G",
+  "H",
+  "I",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "Á",
+  "Â",
+  "É",
+  "Ê",
+  "Í",
+  "Î",
+  "Ó",
+  "Ô",
+  "Ú",
+  "Ě",
+  "Ǎ",
+  "Ǐ",
+  "Ǒ",
+  "Ɔ",
+  "P",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "W",
+  "Y",
+  "Z",
+};
+const char *ALPHA_164_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "ɛ",
+  "f",
+  "g",
+  "h",
+  "i",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "á",
+  "â",
+  "é",
+  "ê",
+  "í",
+  "î",
+  "ó",
+  "ô",
+  "ú",
+  "ě",
+  "ǎ",
+  "ǐ",
+  "ǒ",
+  "ɔ",
+  "p",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "w",
+  "y",
+  "z",
+};
+const char *ALPHA_164_DIGITS[] = {
+};
+const uint32_t ALPHA_164_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 75, 76, 77, 78, 79, 80, 82,
+  83, 84, 85, 86, 87, 89, 90, 193, 194, 201, 202, 205, 206, 211, 212, 218,
+  282, 390, 400, 461, 463, 465,
+};
+const uint32_t ALPHA_164_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 107, 108, 109, 110, 111, 112, 114,
+  115, 116, 117, 118, 119, 121, 122, 225, 226, 233, 234, 237, 238, 243, 244, 250,
+  283, 462, 464, 466, 596, 603,
+};
+const uint32_t ALPHA_164_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_164_FREQ[] = {
+  { "a", 0.14540000 },
+  { "b", 0.04660000 },
+  { "c", 0.00860000 },
+  { "d", 0.01490000 },
+  { "e", 0.06290000 },
+  { "ɛ", 0.01080000 },
+  { "f", 0.00500000 },
+  { "g", 0.02280000 },
+  { "h", 0.00400000 },
+  { "i", 0.06730000 },
+  { "k", 0.05060000 },
+  { "l", 0.06060000 },
+  { "m", 0.06170000 },
+  { "n", 0.07680000 },
+  { "o", 0.07630000 },
+  { "á", 0.02030000 },
+  { "â", 0.00030000 },
+  { "é", 0.01650000 },
+  { "ê", 0.00040000 },
+  { "í", 0.01810000 },
+  { "î", 0.00010000 },
+  { "ó", 0.01280000 },
+  { "ô", 0.00020000 },
+  { "ú", 0.00600000 },
+  { "ě", 0.00070000 },
+  { "ǎ", 0.00060000 },
+  { "ǐ", 0.00010000 },
+  { "ǒ", 0.00230000 },
+  { "ɔ", 0.01100000 },
+  { "p", 0.01920000 },
+  { "r", 0.01790000 },
+  { "s", 0.04070000 },
+  { "t", 0.03780000 },
+  { "u", 0.01970000 },
+  { "v", 0.00420000 },
+  { "w", 0.00760000 },
+  { "y", 0.03120000 },
+  { "z", 0.01790000 },
+};
+
+const wa_cp_freq ALPHA_164_FREQ_CPS[] = {
+  { 0x61u, 0.14540000 },
+  { 0x62u, 0.04660000 },
+  { 0x63u, 0.00860000 },
+  { 0x64u, 0.01490000 },
+  { 0x65u, 0.06290000 },
+  { 0x66u, 0.00500000 },
+  { 0x67u, 0.02280000 },
+  { 0x68u, 0.00400000 },
+  { 0x69u, 0.06730000 },
+  { 0x6Bu, 0.05060000 },
+  { 0x6Cu, 0.06060000 },
+  { 0x6Du, 0.06170000 },
+  { 0x6Eu, 0.07680000 },
+  { 0x6Fu, 0.07630000 },
+  { 0x70u, 0.01920000 },
+  { 0x72u, 0.01790000 },
+  { 0x73u, 0.04070000 },
+  { 0x74u, 0.03780000 },
+  { 0x75u, 0.01970000 },
+  { 0x76u, 0.00420000 },
+  { 0x77u, 0.00760000 },
+  { 0x79u, 0.03120000 },
+  { 0x7Au, 0.01790000 },
+  { 0xE1u, 0.02030000 },
+  { 0xE2u, 0.00030000 },
+  { 0xE9u, 0.01650000 },
+  { 0xEAu, 0.00040000 },
+  { 0xEDu, 0.01810000 },
+  { 0xEEu, 0.00010000 },
+  { 0xF3u, 0.01280000 },
+  { 0xF4u, 0.00020000 },
+  { 0xFAu, 0.00600000 },
+  { 0x11Bu, 0.00070000 },
+  { 0x1CEu, 0.00060000 },
+  { 0x1D0u, 0.00010000 },
+  { 0x1D2u, 0.00230000 },
+  { 0x254u, 0.01100000 },
+  { 0x25Bu, 0.01080000 },
+};
+
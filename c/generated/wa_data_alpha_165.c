@@ -0,0 +1,187 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_165_UPPER[] = {
+  "ກ",
+  "ຂ",
+  "ຄ",
+  "ຈ",
+  "ສ",
+  "ຊ",
+  "ດ",
+  "ຕ",
+  "ຖ",
+  "ທ",
+  "ບ",
+  "ປ",
+  "ຜ",
+  "ຝ",
+  "ພ",
+  "ຟ",
+  "ຢ",
+  "ຣ",
+  "ງ",
+  "ຯ",
+  "ະ",
+  "າ",
+  "ຳ",
+  "ຽ",
+  "ເ",
+  "ແ",
+  "ໂ",
+  "ໃ",
+  "ໄ",
+  "ໆ",
+  "ໜ",
+  "ໝ",
+  "ຍ",
+  "ນ",
+  "ມ",
+  "ລ",
+  "ຫ",
+  "ວ",
+  "ອ",
+  "ຮ",
+};
+const char *ALPHA_165_LOWER[] = {
+  "ກ",
+  "ຂ",
+  "ຄ",
+  "ຈ",
+  "ສ",
+  "ຊ",
+  "ດ",
+  "ຕ",
+  "ຖ",
+  "ທ",
+  "ບ",
+  "ປ",
+  "ຜ",
+  "ຝ",
+  "ພ",
+  "ຟ",
+  "ຢ",
+  "ຣ",
+  "ງ",
+  "ຯ",
+  "ະ",
+  "າ",
+  "ຳ",
+  "ຽ",
+  "ເ",
+  "ແ",
+  "ໂ",
+  "ໃ",
+  "ໄ",
+  "ໆ",
+  "ໜ",
+  "ໝ",
+  "ຍ",
+  "ນ",
+  "ມ",
+  "ລ",
+  "ຫ",
+  "ວ",
+  "ອ",
+  "ຮ",
+};
+const char *ALPHA_165_DIGITS[] = {
+};
+const uint32_t ALPHA_165_UPPER_CPS[] = {
+  3713, 3714, 3716, 3719, 3720, 3722, 3725, 3732, 3733, 3734, 3735, 3737, 3738, 3739, 3740, 3741,
+  3742, 3743, 3745, 3746, 3747, 3749, 3751, 3754, 3755, 3757, 3758, 3759, 3760, 3762, 3763, 3773,
+  3776, 3777, 3778, 3779, 3780, 3782, 3804, 3805,
+};
+const uint32_t ALPHA_165_LOWER_CPS[] = {
+  3713, 3714, 3716, 3719, 3720, 3722, 3725, 3732, 3733, 3734, 3735, 3737, 3738, 3739, 3740, 3741,
+  3742, 3743, 3745, 3746, 3747, 3749, 3751, 3754, 3755, 3757, 3758, 3759, 3760, 3762, 3763, 3773,
+  3776, 3777, 3778, 3779, 3780, 3782, 3804, 3805,
+};
+const uint32_t ALPHA_165_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_165_FREQ[] = {
+  { "ກ", 0.05300000 },
+  { "ຂ", 0.01710000 },
+  { "ຄ", 0.01830000 },
+  { "ຈ", 0.01520000 },
+  { "ສ", 0.03380000 },
+  { "ຊ", 0.01720000 },
+  { "ດ", 0.05330000 },
+  { "ຕ", 0.02040000 },
+  { "ຖ", 0.00760000 },
+  { "ທ", 0.03120000 },
+  { "ບ", 0.02790000 },
+  { "ປ", 0.02530000 },
+  { "ຜ", 0.00500000 },
+  { "ຝ", 0.00100000 },
+  { "ພ", 0.01770000 },
+  { "ຟ", 0.00170000 },
+  { "ຢ", 0.00470000 },
+  { "ຣ", 0.00330000 },
+  { "ງ", 0.05780000 },
+  { "ຯ", 0.00000000 },
+  { "ະ", 0.04910000 },
+  { "າ", 0.09880000 },
+  { "ຳ", 0.01100000 },
+  { "ຽ", 0.00640000 },
+  { "ເ", 0.04630000 },
+  { "ແ", 0.02360000 },
+  { "ໂ", 0.00690000 },
+  { "ໃ", 0.01490000 },
+  { "ໄ", 0.01270000 },
+  { "ໆ", 0.00180000 },
+  { "ໜ", 0.00420000 },
+  { "ໝ", 0.00260000 },
+  { "ຍ", 0.02260000 },
+  { "ນ", 0.09820000 },
+  { "ມ", 0.04170000 },
+  { "ລ", 0.03320000 },
+  { "ຫ", 0.02370000 },
+  { "ວ", 0.03740000 },
+  { "ອ", 0.04420000 },
+  { "ຮ", 0.00930000 },
+};
+
+const wa_cp_freq ALPHA_165_FREQ_CPS[] = {
+  { 0xE81u, 0.05300000 },
+  { 0xE82u, 0.01710000 },
+  { 0xE84u, 0.01830000 },
+  { 0xE87u, 0.05780000 },
+  { 0xE88u, 0.01520000 },
+  { 0xE8Au, 0.01720000 },
+  { 0xE8Du, 0.02260000 },
+  { 0xE94u, 0.05330000 },
+  { 0xE95u, 0.02040000 },
+  { 0xE96u, 0.00760000 },
+  { 0xE97u, 0.03120000 },
+  { 0xE99u, 0.09820000 },
+  { 0xE9Au, 0.02790000 },
+  { 0xE9Bu, 0.02530000 },
+  { 0xE9Cu, 0.00500000 },
+  { 0xE9Du, 0.00100000 },
+  { 0xE9Eu, 0.01770000 },
+  { 0xE9Fu, 0.00170000 },
+  { 0xEA1u, 0.04170000 },
+  { 0xEA2u, 0.00470000 },
+  { 0xEA3u, 0.00330000 },
+  { 0xEA5u, 0.03320000 },
+  { 0xEA7u, 0.03740000 },
+  { 0xEAAu, 0.03380000 },
+  { 0xEABu, 0.02370000 },
+  { 0xEADu, 0.04420000 },
+  { 0xEAEu, 0.00930000 },
+  { 0xEAFu, 0.00000000 },
+  { 0xEB0u, 0.04910000 },
+  { 0xEB2u, 0.09880000 },
+  { 0xEB3u, 0.01100000 },
+  { 0xEBDu, 0.00640000 },
+  { 0xEC0u, 0.04630000 },
+  { 0xEC1u, 0.02360000 },
+  { 0xEC2u, 0.00690000 },
+  { 0xEC3u, 0.01490000 },
+  { 0xEC4u, 0.01270000 },
+  { 0xEC6u, 0.00180000 },
+  { 0xEDCu, 0.00420000 },
+  { 0xEDDu, 0.00260000 },
+};
+
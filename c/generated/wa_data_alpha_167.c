@@ -0,0 +1,153 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_167_UPPER[] = {
+  "A",
+  "Ą",
+  "B",
+  "C",
+  "Č",
+  "D",
+  "E",
+  "Ę",
+  "Ė",
+  "F",
+  "G",
+  "H",
+  "I",
+  "Į",
+  "Y",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "R",
+  "S",
+  "Š",
+  "T",
+  "U",
+  "Ų",
+  "Ū",
+  "V",
+  "Z",
+  "Ž",
+};
+const char *ALPHA_167_LOWER[] = {
+  "a",
+  "ą",
+  "b",
+  "c",
+  "č",
+  "d",
+  "e",
+  "ę",
+  "ė",
+  "f",
+  "g",
+  "h",
+  "i",
+  "į",
+  "y",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "r",
+  "s",
+  "š",
+  "t",
+  "u",
+  "ų",
+  "ū",
+  "v",
+  "z",
+  "ž",
+};
+const char *ALPHA_167_DIGITS[] = {
+};
+const uint32_t ALPHA_167_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  82, 83, 84, 85, 86, 89, 90, 260, 268, 278, 280, 302, 352, 362, 370, 381,
+};
+const uint32_t ALPHA_167_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  114, 115, 116, 117, 118, 121, 122, 261, 269, 279, 281, 303, 353, 363, 371, 382,
+};
+const uint32_t ALPHA_167_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_167_FREQ[] = {
+  { "a", 0.11210000 },
+  { "ą", 0.00540000 },
+  { "b", 0.01490000 },
+  { "c", 0.00600000 },
+  { "č", 0.00430000 },
+  { "d", 0.02580000 },
+  { "e", 0.05630000 },
+  { "ę", 0.00170000 },
+  { "ė", 0.01670000 },
+  { "f", 0.00350000 },
+  { "g", 0.01800000 },
+  { "h", 0.00280000 },
+  { "i", 0.12980000 },
+  { "į", 0.00490000 },
+  { "y", 0.01430000 },
+  { "j", 0.02340000 },
+  { "k", 0.04180000 },
+  { "l", 0.03510000 },
+  { "m", 0.03580000 },
+  { "n", 0.05150000 },
+  { "o", 0.06750000 },
+  { "p", 0.02740000 },
+  { "r", 0.05680000 },
+  { "s", 0.07890000 },
+  { "š", 0.01140000 },
+  { "t", 0.05340000 },
+  { "u", 0.04590000 },
+  { "ų", 0.01260000 },
+  { "ū", 0.00410000 },
+  { "v", 0.02660000 },
+  { "z", 0.00350000 },
+  { "ž", 0.00800000 },
+};
+
+const wa_cp_freq ALPHA_167_FREQ_CPS[] = {
+  { 0x61u, 0.11210000 },
+  { 0x62u, 0.01490000 },
+  { 0x63u, 0.00600000 },
+  { 0x64u, 0.02580000 },
+  { 0x65u, 0.05630000 },
+  { 0x66u, 0.00350000 },
+  { 0x67u, 0.01800000 },
+  { 0x68u, 0.00280000 },
+  { 0x69u, 0.12980000 },
+  { 0x6Au, 0.02340000 },
+  { 0x6Bu, 0.04180000 },
+  { 0x6Cu, 0.03510000 },
+  { 0x6Du, 0.03580000 },
+  { 0x6Eu, 0.05150000 },
+  { 0x6Fu, 0.06750000 },
+  { 0x70u, 0.02740000 },
+  { 0x72u, 0.05680000 },
+  { 0x73u, 0.07890000 },
+  { 0x74u, 0.05340000 },
+  { 0x75u, 0.04590000 },
+  { 0x76u, 0.02660000 },
+  { 0x79u, 0.01430000 },
+  { 0x7Au, 0.00350000 },
+  { 0x105u, 0.00540000 },
+  { 0x10Du, 0.00430000 },
+  { 0x117u, 0.01670000 },
+  { 0x119u, 0.00170000 },
+  { 0x12Fu, 0.00490000 },
+  { 0x161u, 0.01140000 },
+  { 0x16Bu, 0.00410000 },
+  { 0x173u, 0.01260000 },
+  { 0x17Eu, 0.00800000 },
+};
+
@@ -0,0 +1,177 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_168_UPPER[] = {
+  "A",
+  "Ā",
+  "B",
+  "C",
+  "Č",
+  "D",
+  "E",
+  "Ē",
+  "F",
+  "G",
+  "Ģ",
+  "H",
+  "I",
+  "Ī",
+  "J",
+  "K",
+  "Ķ",
+  "L",
+  "Ļ",
+  "M",
+  "N",
+  "Ņ",
+  "O",
+  "Ō",
+  "P",
+  "R",
+  "S",
+  "Š",
+  "T",
+  "U",
+  "Ū",
+  "V",
+  "Y",
+  "Z",
+  "Ž",
+};
+const char *ALPHA_168_LOWER[] = {
+  "a",
+  "ā",
+  "b",
+  "c",
+  "č",
+  "d",
+  "e",
+  "ē",
+  "f",
+  "g",
+  "ģ",
+  "h",
+  "i",
+  "ī",
+  "j",
+  "k",
+  "ķ",
+  "l",
+  "ļ",
+  "m",
+  "n",
+  "ņ",
+  "o",
+  "ō",
+  "p",
+  "r",
+  "s",
+  "š",
+  "t",
+  "u",
+  "ū",
+  "v",
+  "y",
+  "z",
+  "ž",
+};
+const char *ALPHA_168_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_168_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  82, 83, 84, 85, 86, 89, 90, 256, 268, 274, 290, 298, 310, 315, 325, 332,
+  352, 362, 381,
+};
+const uint32_t ALPHA_168_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  114, 115, 116, 117, 118, 121, 122, 257, 269, 275, 291, 299, 311, 316, 326, 333,
+  353, 363, 382,
+};
+const uint32_t ALPHA_168_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_168_FREQ[] = {
+  { "a", 0.10440000 },
+  { "ā", 0.01660000 },
+  { "b", 0.01510000 },
+  { "c", 0.01200000 },
+  { "č", 0.00100000 },
+  { "d", 0.03380000 },
+  { "e", 0.05960000 },
+  { "ē", 0.00300000 },
+  { "f", 0.00280000 },
+  { "g", 0.02310000 },
+  { "ģ", 0.00000000 },
+  { "h", 0.00140000 },
+  { "i", 0.08900000 },
+  { "ī", 0.01850000 },
+  { "j", 0.02090000 },
+  { "k", 0.03550000 },
+  { "ķ", 0.00010000 },
+  { "l", 0.03880000 },
+  { "ļ", 0.00900000 },
+  { "m", 0.02870000 },
+  { "n", 0.03580000 },
+  { "ņ", 0.00500000 },
+  { "o", 0.06250000 },
+  { "ō", 0.00010000 },
+  { "p", 0.02860000 },
+  { "r", 0.05060000 },
+  { "s", 0.08510000 },
+  { "š", 0.00990000 },
+  { "t", 0.05780000 },
+  { "u", 0.06870000 },
+  { "ū", 0.01200000 },
+  { "v", 0.02970000 },
+  { "y", 0.02250000 },
+  { "z", 0.01590000 },
+  { "ž", 0.00250000 },
+};
+
+const wa_cp_freq ALPHA_168_FREQ_CPS[] = {
+  { 0x61u, 0.10440000 },
+  { 0x62u, 0.01510000 },
+  { 0x63u, 0.01200000 },
+  { 0x64u, 0.03380000 },
+  { 0x65u, 0.05960000 },
+  { 0x66u, 0.00280000 },
+  { 0x67u, 0.02310000 },
+  { 0x68u, 0.00140000 },
+  { 0x69u, 0.08900000 },
+  { 0x6Au, 0.02090000 },
+  { 0x6Bu, 0.03550000 },
+  { 0x6Cu, 0.03880000 },
+  { 0x6Du, 0.02870000 },
+  { 0x6Eu, 0.03580000 },
+  { 0x6Fu, 0.06250000 },
+  { 0x70u, 0.02860000 },
+  { 0x72u, 0.05060000 },
+  { 0x73u, 0.08510000 },
+  { 0x74u, 0.05780000 },
+  { 0x75u, 0.06870000 },
+  { 0x76u, 0.02970000 },
+  { 0x79u, 0.02250000 },
+  { 0x7Au, 0.01590000 },
+  { 0x101u, 0.01660000 },
+  { 0x10Du, 0.00100000 },
+  { 0x113u, 0.00300000 },
+  { 0x123u, 0.00000000 },
+  { 0x12Bu, 0.01850000 },
+  { 0x137u, 0.00010000 },
+  { 0x13Cu, 0.00900000 },
+  { 0x146u, 0.00500000 },
+  { 0x14Du, 0.00010000 },
+  { 0x161u, 0.00990000 },
+  { 0x16Bu, 0.01200000 },
+  { 0x17Eu, 0.00250000 },
+};
+
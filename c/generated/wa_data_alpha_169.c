@@ -0,0 +1,171 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_169_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "Q",
+  "S",
+  "T",
+  "U",
+  "V",
+  "W",
+  "Y",
+  "Z",
+  "G",
+  "À",
+  "Á",
+  "È",
+  "É",
+  "Ì",
+  "Í",
+  "Ò",
+  "Ó",
+  "Ù",
+  "Ú",
+  "Ɔ",
+  "Ɛ",
+};
+const char *ALPHA_169_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "q",
+  "s",
+  "t",
+  "u",
+  "v",
+  "w",
+  "y",
+  "z",
+  "g",
+  "à",
+  "á",
+  "è",
+  "é",
+  "ì",
+  "í",
+  "ò",
+  "ó",
+  "ù",
+  "ú",
+  "ɔ",
+  "ɛ",
+};
+const char *ALPHA_169_DIGITS[] = {
+};
+const uint32_t ALPHA_169_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 83, 84, 85, 86, 87, 89, 90, 192, 193, 200, 201, 204, 205, 210, 211,
+  217, 218, 390, 400,
+};
+const uint32_t ALPHA_169_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 115, 116, 117, 118, 119, 121, 122, 224, 225, 232, 233, 236, 237, 242, 243,
+  249, 250, 596, 603,
+};
+const uint32_t ALPHA_169_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_169_FREQ[] = {
+  { "a", 0.00000000 },
+  { "b", 0.00000000 },
+  { "c", 0.00000000 },
+  { "d", 0.00000000 },
+  { "e", 0.00000000 },
+  { "f", 0.00000000 },
+  { "h", 0.00000000 },
+  { "i", 0.00000000 },
+  { "j", 0.00000000 },
+  { "k", 0.00000000 },
+  { "l", 0.00000000 },
+  { "m", 0.00000000 },
+  { "n", 0.00000000 },
+  { "o", 0.00000000 },
+  { "p", 0.00000000 },
+  { "q", 0.00000000 },
+  { "s", 0.00000000 },
+  { "t", 0.00000000 },
+  { "u", 0.00000000 },
+  { "v", 0.00000000 },
+  { "w", 0.00000000 },
+  { "y", 0.00000000 },
+  { "z", 0.00000000 },
+  { "g", 0.00000000 },
+  { "à", 0.00000000 },
+  { "á", 0.00000000 },
+  { "è", 0.00000000 },
+  { "é", 0.00000000 },
+  { "ì", 0.00000000 },
+  { "í", 0.00000000 },
+  { "ò", 0.00000000 },
+  { "ó", 0.00000000 },
+  { "ù", 0.00000000 },
+  { "ú", 0.00000000 },
+  { "ɔ", 0.00000000 },
+  { "ɛ", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_169_FREQ_CPS[] = {
+  { 0x61u, 0.00000000 },
+  { 0x62u, 0.00000000 },
+  { 0x63u, 0.00000000 },
+  { 0x64u, 0.00000000 },
+  { 0x65u, 0.00000000 },
+  { 0x66u, 0.00000000 },
+  { 0x67u, 0.00000000 },
+  { 0x68u, 0.00000000 },
+  { 0x69u, 0.00000000 },
+  { 0x6Au, 0.00000000 },
+  { 0x6Bu, 0.00000000 },
+  { 0x6Cu, 0.00000000 },
+  { 0x6Du, 0.00000000 },
+  { 0x6Eu, 0.00000000 },
+  { 0x6Fu, 0.00000000 },
+  { 0x70u, 0.00000000 },
+  { 0x71u, 0.00000000 },
+  { 0x73u, 0.00000000 },
+  { 0x74u, 0.00000000 },
+  { 0x75u, 0.00000000 },
+  { 0x76u, 0.00000000 },
+  { 0x77u, 0.00000000 },
+  { 0x79u, 0.00000000 },
+  { 0x7Au, 0.00000000 },
+  { 0xE0u, 0.00000000 },
+  { 0xE1u, 0.00000000 },
+  { 0xE8u, 0.00000000 },
+  { 0xE9u, 0.00000000 },
+  { 0xECu, 0.00000000 },
+  { 0xEDu, 0.00000000 },
+  { 0xF2u, 0.00000000 },
+  { 0xF3u, 0.00000000 },
+  { 0xF9u, 0.00000000 },
+  { 0xFAu, 0.00000000 },
+  { 0x254u, 0.00000000 },
+  { 0x25Bu, 0.00000000 },
+};
+
@@ -0,0 +1,147 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_17_UPPER[] = {
+  "آ",
+  "ا",
+  "ئ",
+  "ب",
+  "پ",
+  "ت",
+  "ٹ",
+  "ج",
+  "چ",
+  "د",
+  "ڈ",
+  "ر",
+  "ڑ",
+  "ز",
+  "ژ",
+  "س",
+  "ش",
+  "ک",
+  "گ",
+  "ل",
+  "م",
+  "ن",
+  "و",
+  "ۆ",
+  "ه",
+  "ی",
+  "ێ",
+  "ے",
+};
+const char *ALPHA_17_LOWER[] = {
+  "آ",
+  "ا",
+  "ئ",
+  "ب",
+  "پ",
+  "ت",
+  "ٹ",
+  "ج",
+  "چ",
+  "د",
+  "ڈ",
+  "ر",
+  "ڑ",
+  "ز",
+  "ژ",
+  "س",
+  "ش",
+  "ک",
+  "گ",
+  "ل",
+  "م",
+  "ن",
+  "و",
+  "ۆ",
+  "ه",
+  "ی",
+  "ێ",
+  "ے",
+};
+const char *ALPHA_17_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_17_UPPER_CPS[] = {
+  1570, 1574, 1575, 1576, 1578, 1580, 1583, 1585, 1586, 1587, 1588, 1604, 1605, 1606, 1607, 1608,
+  1657, 1662, 1670, 1672, 1681, 1688, 1705, 1711, 1734, 1740, 1742, 1746,
+};
+const uint32_t ALPHA_17_LOWER_CPS[] = {
+  1570, 1574, 1575, 1576, 1578, 1580, 1583, 1585, 1586, 1587, 1588, 1604, 1605, 1606, 1607, 1608,
+  1657, 1662, 1670, 1672, 1681, 1688, 1705, 1711, 1734, 1740, 1742, 1746,
+};
+const uint32_t ALPHA_17_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_17_FREQ[] = {
+  { "آ", 0.00000000 },
+  { "ا", 0.00000000 },
+  { "ئ", 0.00000000 },
+  { "ب", 0.00000000 },
+  { "پ", 0.00000000 },
+  { "ت", 0.00000000 },
+  { "ٹ", 0.00000000 },
+  { "ج", 0.00000000 },
+  { "چ", 0.00000000 },
+  { "د", 0.00000000 },
+  { "ڈ", 0.00000000 },
+  { "ر", 0.00000000 },
+  { "ڑ", 0.00000000 },
+  { "ز", 0.00000000 },
+  { "ژ", 0.00000000 },
+  { "س", 0.00000000 },
+  { "ش", 0.00000000 },
+  { "ک", 0.00000000 },
+  { "گ", 0.00000000 },
+  { "ل", 0.00000000 },
+  { "م", 0.00000000 },
+  { "ن", 0.00000000 },
+  { "و", 0.00000000 },
+  { "ۆ", 0.00000000 },
+  { "ه", 0.00000000 },
+  { "ی", 0.00000000 },
+  { "ێ", 0.00000000 },
+  { "ے", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_17_FREQ_CPS[] = {
+  { 0x622u, 0.00000000 },
+  { 0x626u, 0.00000000 },
+  { 0x627u, 0.00000000 },
+  { 0x628u, 0.00000000 },
+  { 0x62Au, 0.00000000 },
+  { 0x62Cu, 0.00000000 },
+  { 0x62Fu, 0.00000000 },
+  { 0x631u, 0.00000000 },
+  { 0x632u, 0.00000000 },
+  { 0x633u, 0.00000000 },
+  { 0x634u, 0.00000000 },
+  { 0x644u, 0.00000000 },
+  { 0x645u, 0.00000000 },
+  { 0x646u, 0.00000000 },
+  { 0x647u, 0.00000000 },
+  { 0x648u, 0.00000000 },
+  { 0x679u, 0.00000000 },
+  { 0x67Eu, 0.00000000 },
+  { 0x686u, 0.00000000 },
+  { 0x688u, 0.00000000 },
+  { 0x691u, 0.00000000 },
+  { 0x698u, 0.00000000 },
+  { 0x6A9u, 0.00000000 },
+  { 0x6AFu, 0.00000000 },
+  { 0x6C6u, 0.00000000 },
+  { 0x6CCu, 0.00000000 },
+  { 0x6CEu, 0.00000000 },
+  { 0x6D2u, 0.00000000 },
+};
+
@@ -0,0 +1,159 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_172_UPPER[] = {
+  "A",
+  "Ā",
+  "B",
+  "C",
+  "Č",
+  "D",
+  "E",
+  "Ē",
+  "F",
+  "G",
+  "Ģ",
+  "H",
+  "I",
+  "Ī",
+  "J",
+  "K",
+  "Ķ",
+  "L",
+  "Ļ",
+  "M",
+  "N",
+  "Ņ",
+  "O",
+  "P",
+  "R",
+  "S",
+  "Š",
+  "T",
+  "U",
+  "Ū",
+  "V",
+  "Z",
+  "Ž",
+};
+const char *ALPHA_172_LOWER[] = {
+  "a",
+  "ā",
+  "b",
+  "c",
+  "č",
+  "d",
+  "e",
+  "ē",
+  "f",
+  "g",
+  "ģ",
+  "h",
+  "i",
+  "ī",
+  "j",
+  "k",
+  "ķ",
+  "l",
+  "ļ",
+  "m",
+  "n",
+  "ņ",
+  "o",
+  "p",
+  "r",
+  "s",
+  "š",
+  "t",
+  "u",
+  "ū",
+  "v",
+  "z",
+  "ž",
+};
+const char *ALPHA_172_DIGITS[] = {
+};
+const uint32_t ALPHA_172_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  82, 83, 84, 85, 86, 90, 256, 268, 274, 290, 298, 310, 315, 325, 352, 362,
+  381,
+};
+const uint32_t ALPHA_172_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  114, 115, 116, 117, 118, 122, 257, 269, 275, 291, 299, 311, 316, 326, 353, 363,
+  382,
+};
+const uint32_t ALPHA_172_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_172_FREQ[] = {
+  { "a", 0.11860000 },
+  { "ā", 0.04070000 },
+  { "b", 0.01660000 },
+  { "c", 0.01170000 },
+  { "č", 0.00120000 },
+  { "d", 0.03160000 },
+  { "e", 0.06150000 },
+  { "ē", 0.01630000 },
+  { "f", 0.00400000 },
+  { "g", 0.01730000 },
+  { "ģ", 0.00130000 },
+  { "h", 0.00290000 },
+  { "i", 0.09300000 },
+  { "ī", 0.01780000 },
+  { "j", 0.02410000 },
+  { "k", 0.03840000 },
+  { "ķ", 0.00150000 },
+  { "l", 0.03570000 },
+  { "ļ", 0.00400000 },
+  { "m", 0.03440000 },
+  { "n", 0.04450000 },
+  { "ņ", 0.00450000 },
+  { "o", 0.03970000 },
+  { "p", 0.02940000 },
+  { "r", 0.05710000 },
+  { "s", 0.08240000 },
+  { "š", 0.00910000 },
+  { "t", 0.05930000 },
+  { "u", 0.04990000 },
+  { "ū", 0.00370000 },
+  { "v", 0.02700000 },
+  { "z", 0.01830000 },
+  { "ž", 0.00230000 },
+};
+
+const wa_cp_freq ALPHA_172_FREQ_CPS[] = {
+  { 0x61u, 0.11860000 },
+  { 0x62u, 0.01660000 },
+  { 0x63u, 0.01170000 },
+  { 0x64u, 0.03160000 },
+  { 0x65u, 0.06150000 },
+  { 0x66u, 0.00400000 },
+  { 0x67u, 0.01730000 },
+  { 0x68u, 0.00290000 },
+  { 0x69u, 0.09300000 },
+  { 0x6Au, 0.02410000 },
+  { 0x6Bu, 0.03840000 },
+  { 0x6Cu, 0.03570000 },
+  { 0x6Du, 0.03440000 },
+  { 0x6Eu, 0.04450000 },
+  { 0x6Fu, 0.03970000 },
+  { 0x70u, 0.02940000 },
+  { 0x72u, 0.05710000 },
+  { 0x73u, 0.08240000 },
+  { 0x74u, 0.05930000 },
+  { 0x75u, 0.04990000 },
+  { 0x76u, 0.02700000 },
+  { 0x7Au, 0.01830000 },
+  { 0x101u, 0.04070000 },
+  { 0x10Du, 0.00120000 },
+  { 0x113u, 0.01630000 },
+  { 0x123u, 0.00130000 },
+  { 0x12Bu, 0.01780000 },
+  { 0x137u, 0.00150000 },
+  { 0x13Cu, 0.00400000 },
+  { 0x146u, 0.00450000 },
+  { 0x161u, 0.00910000 },
+  { 0x16Bu, 0.00370000 },
+  { 0x17Eu, 0.00230000 },
+};
+
@@ -0,0 +1,221 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_175_UPPER[] = {
+  "A",
+  "Á",
+  "À",
+  "Â",
+  "Ā",
+  "B",
+  "C",
+  "D",
+  "E",
+  "É",
+  "È",
+  "Ê",
+  "Ē",
+  "Ɛ",
+  "G",
+  "H",
+  "I",
+  "Í",
+  "Ì",
+  "Î",
+  "Ī",
+  "Ɨ",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "Y",
+  "Ŋ",
+  "O",
+  "Ó",
+  "Ò",
+  "Ô",
+  "Ō",
+  "Ɔ",
+  "P",
+  "R",
+  "S",
+  "T",
+  "U",
+  "Ú",
+  "Ù",
+  "Û",
+  "Ū",
+  "Ʉ",
+  "W",
+};
+const char *ALPHA_175_LOWER[] = {
+  "a",
+  "á",
+  "à",
+  "â",
+  "ā",
+  "b",
+  "c",
+  "d",
+  "e",
+  "é",
+  "è",
+  "ê",
+  "ē",
+  "ɛ",
+  "g",
+  "h",
+  "i",
+  "í",
+  "ì",
+  "î",
+  "ī",
+  "ɨ",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "y",
+  "ŋ",
+  "o",
+  "ó",
+  "ò",
+  "ô",
+  "ō",
+  "ɔ",
+  "p",
+  "r",
+  "s",
+  "t",
+  "u",
+  "ú",
+  "ù",
+  "û",
+  "ū",
+  "ʉ",
+  "w",
+};
+const char *ALPHA_175_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_175_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 82,
+  83, 84, 85, 87, 89, 192, 193, 194, 200, 201, 202, 204, 205, 206, 210, 211,
+  212, 217, 218, 219, 256, 274, 298, 330, 332, 362, 390, 400, 407, 580,
+};
+const uint32_t ALPHA_175_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 114,
+  115, 116, 117, 119, 121, 224, 225, 226, 232, 233, 234, 236, 237, 238, 242, 243,
+  244, 249, 250, 251, 257, 275, 299, 331, 333, 363, 596, 603, 616, 649,
+};
+const uint32_t ALPHA_175_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_175_FREQ[] = {
+  { "a", 0.00000000 },
+  { "á", 0.00000000 },
+  { "à", 0.00000000 },
+  { "â", 0.00000000 },
+  { "ā", 0.00000000 },
+  { "b", 0.00000000 },
+  { "c", 0.00000000 },
+  { "d", 0.00000000 },
+  { "e", 0.00000000 },
+  { "é", 0.00000000 },
+  { "è", 0.00000000 },
+  { "ê", 0.00000000 },
+  { "ē", 0.00000000 },
+  { "ɛ", 0.00000000 },
+  { "g", 0.00000000 },
+  { "h", 0.00000000 },
+  { "i", 0.00000000 },
+  { "í", 0.00000000 },
+  { "ì", 0.00000000 },
+  { "î", 0.00000000 },
+  { "ī", 0.00000000 },
+  { "ɨ", 0.00000000 },
+  { "j", 0.00000000 },
+  { "k", 0.00000000 },
+  { "l", 0.00000000 },
+  { "m", 0.00000000 },
+  { "n", 0.00000000 },
+  { "y", 0.00000000 },
+  { "ŋ", 0.00000000 },
+  { "o", 0.00000000 },
+  { "ó", 0.00000000 },
+  { "ò", 0.00000000 },
+  { "ô", 0.00000000 },
+  { "ō", 0.00000000 },
+  { "ɔ", 0.00000000 },
+  { "p", 0.00000000 },
+  { "r", 0.00000000 },
+  { "s", 0.00000000 },
+  { "t", 0.00000000 },
+  { "u", 0.00000000 },
+  { "ú", 0.00000000 },
+  { "ù", 0.00000000 },
+  { "û", 0.00000000 },
+  { "ū", 0.00000000 },
+  { "ʉ", 0.00000000 },
+  { "w", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_175_FREQ_CPS[] = {
+  { 0x61u, 0.00000000 },
+  { 0x62u, 0.00000000 },
+  { 0x63u, 0.00000000 },
+  { 0x64u, 0.00000000 },
+  { 0x65u, 0.00000000 },
+  { 0x67u, 0.00000000 },
+  { 0x68u, 0.00000000 },
+  { 0x69u, 0.00000000 },
+  { 0x6Au, 0.00000000 },
+  { 0x6Bu, 0.00000000 },
+  { 0x6Cu, 0.00000000 },
+  { 0x6Du, 0.00000000 },
+  { 0x6Eu, 0.00000000 },
+  { 0x6Fu, 0.00000000 },
+  { 0x70u, 0.00000000 },
+  { 0x72u, 0.00000000 },
+  { 0x73u, 0.00000000 },
+  { 0x74u, 0.00000000 },
+  { 0x75u, 0.00000000 },
+  { 0x77u, 0.00000000 },
+  { 0x79u, 0.00000000 },
+  { 0xE0u, 0.00000000 },
+  { 0xE1u, 0.00000000 },
+  { 0xE2u, 0.00000000 },
+  { 0xE8u, 0.00000000 },
+  { 0xE9u, 0.00000000 },
+  { 0xEAu, 0.00000000 },
+  { 0xECu, 0.00000000 },
+  { 0xEDu, 0.00000000 },
+  { 0xEEu, 0.00000000 },
+  { 0xF2u, 0.00000000 },
+  { 0xF3u, 0.00000000 },
+  { 0xF4u, 0.00000000 },
+  { 0xF9u, 0.00000000 },
+  { 0xFAu, 0.00000000 },
+  { 0xFBu, 0.00000000 },
+  { 0x101u, 0.00000000 },
+  { 0x113u, 0.00000000 },
+  { 0x12Bu, 0.00000000 },
+  { 0x14Bu, 0.00000000 },
+  { 0x14Du, 0.00000000 },
+  { 0x16Bu, 0.00000000 },
+  { 0x254u, 0.00000000 },
+  { 0x25Bu, 0.00000000 },
+  { 0x268u, 0.00000000 },
+  { 0x289u, 0.00000000 },
+};
+
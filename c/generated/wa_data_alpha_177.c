@@ -0,0 +1,143 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_177_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "X",
+  "Y",
+  "Á",
+  "Ñ",
+  "Ú",
+  "Ɨ",
+};
+const char *ALPHA_177_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "x",
+  "y",
+  "á",
+  "ñ",
+  "ú",
+  "ɨ",
+};
+const char *ALPHA_177_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_177_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  82, 83, 84, 85, 86, 88, 89, 193, 209, 218, 407,
+};
+const uint32_t ALPHA_177_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  114, 115, 116, 117, 118, 120, 121, 225, 241, 250, 616,
+};
+const uint32_t ALPHA_177_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_177_FREQ[] = {
+  { "a", 0.13700000 },
+  { "n", 0.13040000 },
+  { "i", 0.13100000 },
+  { "j", 0.03120000 },
+  { "e", 0.05090000 },
+  { "d", 0.00710000 },
+  { "u", 0.10920000 },
+  { "s", 0.04000000 },
+  { "v", 0.02180000 },
+  { "o", 0.03760000 },
+  { "k", 0.09090000 },
+  { "t", 0.08060000 },
+  { "y", 0.03330000 },
+  { "m", 0.01200000 },
+  { "ɨ", 0.02930000 },
+  { "ñ", 0.01470000 },
+  { "x", 0.01370000 },
+  { "l", 0.01180000 },
+  { "p", 0.00260000 },
+  { "h", 0.00110000 },
+  { "f", 0.00060000 },
+  { "r", 0.00920000 },
+  { "g", 0.00150000 },
+  { "c", 0.00090000 },
+  { "b", 0.00110000 },
+  { "ú", 0.00040000 },
+  { "á", 0.00020000 },
+};
+
+const wa_cp_freq ALPHA_177_FREQ_CPS[] = {
+  { 0x61u, 0.13700000 },
+  { 0x62u, 0.00110000 },
+  { 0x63u, 0.00090000 },
+  { 0x64u, 0.00710000 },
+  { 0x65u, 0.05090000 },
+  { 0x66u, 0.00060000 },
+  { 0x67u, 0.00150000 },
+  { 0x68u, 0.00110000 },
+  { 0x69u, 0.13100000 },
+  { 0x6Au, 0.03120000 },
+  { 0x6Bu, 0.09090000 },
+  { 0x6Cu, 0.01180000 },
+  { 0x6Du, 0.01200000 },
+  { 0x6Eu, 0.13040000 },
+  { 0x6Fu, 0.03760000 },
+  { 0x70u, 0.00260000 },
+  { 0x72u, 0.00920000 },
+  { 0x73u, 0.04000000 },
+  { 0x74u, 0.08060000 },
+  { 0x75u, 0.10920000 },
+  { 0x76u, 0.02180000 },
+  { 0x78u, 0.01370000 },
+  { 0x79u, 0.03330000 },
+  { 0xE1u, 0.00020000 },
+  { 0xF1u, 0.01470000 },
+  { 0xFAu, 0.00040000 },
+  { 0x268u, 0.02930000 },
+};
+
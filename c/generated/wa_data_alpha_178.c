@@ -0,0 +1,131 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_178_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "W",
+  "Y",
+  "Z",
+};
+const char *ALPHA_178_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "w",
+  "y",
+  "z",
+};
+const char *ALPHA_178_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_178_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  82, 83, 84, 85, 86, 87, 89, 90,
+};
+const uint32_t ALPHA_178_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  114, 115, 116, 117, 118, 119, 121, 122,
+};
+const uint32_t ALPHA_178_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_178_FREQ[] = {
+  { "w", 0.01180000 },
+  { "a", 0.17840000 },
+  { "k", 0.05810000 },
+  { "b", 0.03040000 },
+  { "g", 0.03310000 },
+  { "o", 0.02980000 },
+  { "u", 0.06620000 },
+  { "j", 0.01910000 },
+  { "i", 0.07380000 },
+  { "e", 0.10060000 },
+  { "t", 0.04230000 },
+  { "l", 0.04470000 },
+  { "n", 0.08720000 },
+  { "m", 0.04470000 },
+  { "d", 0.02470000 },
+  { "y", 0.01600000 },
+  { "s", 0.04270000 },
+  { "p", 0.03070000 },
+  { "h", 0.02560000 },
+  { "c", 0.00550000 },
+  { "r", 0.03130000 },
+  { "z", 0.00040000 },
+  { "v", 0.00110000 },
+  { "f", 0.00180000 },
+};
+
+const wa_cp_freq ALPHA_178_FREQ_CPS[] = {
+  { 0x61u, 0.17840000 },
+  { 0x62u, 0.03040000 },
+  { 0x63u, 0.00550000 },
+  { 0x64u, 0.02470000 },
+  { 0x65u, 0.10060000 },
+  { 0x66u, 0.00180000 },
+  { 0x67u, 0.03310000 },
+  { 0x68u, 0.02560000 },
+  { 0x69u, 0.07380000 },
+  { 0x6Au, 0.01910000 },
+  { 0x6Bu, 0.05810000 },
+  { 0x6Cu, 0.04470000 },
+  { 0x6Du, 0.04470000 },
+  { 0x6Eu, 0.08720000 },
+  { 0x6Fu, 0.02980000 },
+  { 0x70u, 0.03070000 },
+  { 0x72u, 0.03130000 },
+  { 0x73u, 0.04270000 },
+  { 0x74u, 0.04230000 },
+  { 0x75u, 0.06620000 },
+  { 0x76u, 0.00110000 },
+  { 0x77u, 0.01180000 },
+  { 0x79u, 0.01600000 },
+  { 0x7Au, 0.00040000 },
+};
+
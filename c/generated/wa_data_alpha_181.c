@@ -0,0 +1,153 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_181_UPPER[] = {
+  "A",
+  "B",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "R",
+  "S",
+  "T",
+  "V",
+  "Y",
+  "Z",
+  "À",
+  "Â",
+  "È",
+  "É",
+  "Ê",
+  "Ë",
+  "Ì",
+  "Î",
+  "Ï",
+  "Ñ",
+  "Ô",
+};
+const char *ALPHA_181_LOWER[] = {
+  "a",
+  "b",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "r",
+  "s",
+  "t",
+  "v",
+  "y",
+  "z",
+  "à",
+  "â",
+  "è",
+  "é",
+  "ê",
+  "ë",
+  "ì",
+  "î",
+  "ï",
+  "ñ",
+  "ô",
+};
+const char *ALPHA_181_DIGITS[] = {
+};
+const uint32_t ALPHA_181_UPPER_CPS[] = {
+  65, 66, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 82,
+  83, 84, 86, 89, 90, 192, 194, 200, 201, 202, 203, 204, 206, 207, 209, 212,
+};
+const uint32_t ALPHA_181_LOWER_CPS[] = {
+  97, 98, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 114,
+  115, 116, 118, 121, 122, 224, 226, 232, 233, 234, 235, 236, 238, 239, 241, 244,
+};
+const uint32_t ALPHA_181_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_181_FREQ[] = {
+  { "a", 0.21650000 },
+  { "b", 0.00880000 },
+  { "d", 0.04060000 },
+  { "e", 0.04310000 },
+  { "f", 0.01540000 },
+  { "g", 0.00510000 },
+  { "h", 0.01950000 },
+  { "i", 0.11260000 },
+  { "j", 0.00500000 },
+  { "k", 0.02010000 },
+  { "l", 0.01980000 },
+  { "m", 0.04210000 },
+  { "n", 0.14940000 },
+  { "o", 0.06980000 },
+  { "p", 0.01270000 },
+  { "r", 0.05830000 },
+  { "s", 0.02640000 },
+  { "t", 0.04540000 },
+  { "v", 0.00810000 },
+  { "y", 0.06600000 },
+  { "z", 0.00870000 },
+  { "à", 0.00310000 },
+  { "â", 0.00010000 },
+  { "è", 0.00040000 },
+  { "é", 0.00110000 },
+  { "ê", 0.00000000 },
+  { "ë", 0.00000000 },
+  { "ì", 0.00000000 },
+  { "î", 0.00000000 },
+  { "ï", 0.00000000 },
+  { "ñ", 0.00000000 },
+  { "ô", 0.00180000 },
+};
+
+const wa_cp_freq ALPHA_181_FREQ_CPS[] = {
+  { 0x61u, 0.21650000 },
+  { 0x62u, 0.00880000 },
+  { 0x64u, 0.04060000 },
+  { 0x65u, 0.04310000 },
+  { 0x66u, 0.01540000 },
+  { 0x67u, 0.00510000 },
+  { 0x68u, 0.01950000 },
+  { 0x69u, 0.11260000 },
+  { 0x6Au, 0.00500000 },
+  { 0x6Bu, 0.02010000 },
+  { 0x6Cu, 0.01980000 },
+  { 0x6Du, 0.04210000 },
+  { 0x6Eu, 0.14940000 },
+  { 0x6Fu, 0.06980000 },
+  { 0x70u, 0.01270000 },
+  { 0x72u, 0.05830000 },
+  { 0x73u, 0.02640000 },
+  { 0x74u, 0.04540000 },
+  { 0x76u, 0.00810000 },
+  { 0x79u, 0.06600000 },
+  { 0x7Au, 0.00870000 },
+  { 0xE0u, 0.00310000 },
+  { 0xE2u, 0.00010000 },
+  { 0xE8u, 0.00040000 },
+  { 0xE9u, 0.00110000 },
+  { 0xEAu, 0.00000000 },
+  { 0xEBu, 0.00000000 },
+  { 0xECu, 0.00000000 },
+  { 0xEEu, 0.00000000 },
+  { 0xEFu, 0.00000000 },
+  { 0xF1u, 0.00000000 },
+  { 0xF4u, 0.00180000 },
+};
+
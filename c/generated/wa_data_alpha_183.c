@@ -0,0 +1,159 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_183_UPPER[] = {
+  "A",
+  "À",
+  "B",
+  "C",
+  "H",
+  "D",
+  "E",
+  "È",
+  "Ə",
+  "F",
+  "G",
+  "I",
+  "Ì",
+  "J",
+  "K",
+  "M",
+  "N",
+  "Ŋ",
+  "O",
+  "Ò",
+  "Ɔ",
+  "P",
+  "R",
+  "S",
+  "T",
+  "U",
+  "Ù",
+  "W",
+  "Y",
+  "Z",
+  "ʼ",
+};
+const char *ALPHA_183_LOWER[] = {
+  "a",
+  "à",
+  "b",
+  "c",
+  "h",
+  "d",
+  "e",
+  "è",
+  "ə",
+  "f",
+  "g",
+  "i",
+  "ì",
+  "j",
+  "k",
+  "m",
+  "n",
+  "ŋ",
+  "o",
+  "ò",
+  "ɔ",
+  "p",
+  "r",
+  "s",
+  "t",
+  "u",
+  "ù",
+  "w",
+  "y",
+  "z",
+  "ʼ",
+};
+const char *ALPHA_183_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_183_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 77, 78, 79, 80, 82,
+  83, 84, 85, 87, 89, 90, 192, 200, 204, 210, 217, 330, 390, 399, 700,
+};
+const uint32_t ALPHA_183_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 109, 110, 111, 112, 114,
+  115, 116, 117, 119, 121, 122, 224, 232, 236, 242, 249, 331, 596, 601, 700,
+};
+const uint32_t ALPHA_183_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_183_FREQ[] = {
+  { "a", 0.00000000 },
+  { "à", 0.00000000 },
+  { "b", 0.00000000 },
+  { "c", 0.00000000 },
+  { "h", 0.00000000 },
+  { "d", 0.00000000 },
+  { "e", 0.00000000 },
+  { "è", 0.00000000 },
+  { "ə", 0.00000000 },
+  { "f", 0.00000000 },
+  { "g", 0.00000000 },
+  { "i", 0.00000000 },
+  { "ì", 0.00000000 },
+  { "j", 0.00000000 },
+  { "k", 0.00000000 },
+  { "m", 0.00000000 },
+  { "n", 0.00000000 },
+  { "ŋ", 0.00000000 },
+  { "o", 0.00000000 },
+  { "ò", 0.00000000 },
+  { "ɔ", 0.00000000 },
+  { "p", 0.00000000 },
+  { "r", 0.00000000 },
+  { "s", 0.00000000 },
+  { "t", 0.00000000 },
+  { "u", 0.00000000 },
+  { "ù", 0.00000000 },
+  { "w", 0.00000000 },
+  { "y", 0.00000000 },
+  { "z", 0.00000000 },
+  { "ʼ", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_183_FREQ_CPS[] = {
+  { 0x61u, 0.00000000 },
+  { 0x62u, 0.00000000 },
+  { 0x63u, 0.00000000 },
+  { 0x64u, 0.00000000 },
+  { 0x65u, 0.00000000 },
+  { 0x66u, 0.00000000 },
+  { 0x67u, 0.00000000 },
+  { 0x68u, 0.00000000 },
+  { 0x69u, 0.00000000 },
+  { 0x6Au, 0.00000000 },
+  { 0x6Bu, 0.00000000 },
+  { 0x6Du, 0.00000000 },
+  { 0x6Eu, 0.00000000 },
+  { 0x6Fu, 0.00000000 },
+  { 0x70u, 0.00000000 },
+  { 0x72u, 0.00000000 },
+  { 0x73u, 0.00000000 },
+  { 0x74u, 0.00000000 },
+  { 0x75u, 0.00000000 },
+  { 0x77u, 0.00000000 },
+  { 0x79u, 0.00000000 },
+  { 0x7Au, 0.00000000 },
+  { 0xE0u, 0.00000000 },
+  { 0xE8u, 0.00000000 },
+  { 0xECu, 0.00000000 },
+  { 0xF2u, 0.00000000 },
+  { 0xF9u, 0.00000000 },
+  { 0x14Bu, 0.00000000 },
+  { 0x254u, 0.00000000 },
+  { 0x259u, 0.00000000 },
+  { 0x2BCu, 0.00000000 },
+};
+
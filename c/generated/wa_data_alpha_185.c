@@ -0,0 +1,111 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_185_UPPER[] = {
+  "A",
+  "Ā",
+  "E",
+  "Ē",
+  "H",
+  "I",
+  "Ī",
+  "K",
+  "M",
+  "N",
+  "G",
+  "O",
+  "Ō",
+  "P",
+  "R",
+  "T",
+  "U",
+  "Ū",
+  "W",
+};
+const char *ALPHA_185_LOWER[] = {
+  "a",
+  "ā",
+  "e",
+  "ē",
+  "h",
+  "i",
+  "ī",
+  "k",
+  "m",
+  "n",
+  "g",
+  "o",
+  "ō",
+  "p",
+  "r",
+  "t",
+  "u",
+  "ū",
+  "w",
+};
+const char *ALPHA_185_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_185_UPPER_CPS[] = {
+  65, 69, 71, 72, 73, 75, 77, 78, 79, 80, 82, 84, 85, 87, 256, 274,
+  298, 332, 362,
+};
+const uint32_t ALPHA_185_LOWER_CPS[] = {
+  97, 101, 103, 104, 105, 107, 109, 110, 111, 112, 114, 116, 117, 119, 257, 275,
+  299, 333, 363,
+};
+const uint32_t ALPHA_185_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_185_FREQ[] = {
+  { "a", 0.15610000 },
+  { "ā", 0.04160000 },
+  { "e", 0.11600000 },
+  { "ē", 0.00420000 },
+  { "h", 0.05600000 },
+  { "i", 0.09920000 },
+  { "ī", 0.00310000 },
+  { "k", 0.06420000 },
+  { "m", 0.01730000 },
+  { "n", 0.07040000 },
+  { "g", 0.02460000 },
+  { "o", 0.09030000 },
+  { "ō", 0.00650000 },
+  { "p", 0.01520000 },
+  { "r", 0.04420000 },
+  { "t", 0.11150000 },
+  { "u", 0.04660000 },
+  { "ū", 0.00500000 },
+  { "w", 0.02820000 },
+};
+
+const wa_cp_freq ALPHA_185_FREQ_CPS[] = {
+  { 0x61u, 0.15610000 },
+  { 0x65u, 0.11600000 },
+  { 0x67u, 0.02460000 },
+  { 0x68u, 0.05600000 },
+  { 0x69u, 0.09920000 },
+  { 0x6Bu, 0.06420000 },
+  { 0x6Du, 0.01730000 },
+  { 0x6Eu, 0.07040000 },
+  { 0x6Fu, 0.09030000 },
+  { 0x70u, 0.01520000 },
+  { 0x72u, 0.04420000 },
+  { 0x74u, 0.11150000 },
+  { 0x75u, 0.04660000 },
+  { 0x77u, 0.02820000 },
+  { 0x101u, 0.04160000 },
+  { 0x113u, 0.00420000 },
+  { 0x12Bu, 0.00310000 },
+  { 0x14Du, 0.00650000 },
+  { 0x16Bu, 0.00500000 },
+};
+
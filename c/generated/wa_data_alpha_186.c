@@ -0,0 +1,123 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_186_UPPER[] = {
+  "A",
+  "Á",
+  "E",
+  "É",
+  "I",
+  "Ɨ",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "Ó",
+  "P",
+  "Q",
+  "S",
+  "T",
+  "U",
+  "Ú",
+  "W",
+  "Y",
+  "ʼ",
+};
+const char *ALPHA_186_LOWER[] = {
+  "a",
+  "á",
+  "e",
+  "é",
+  "i",
+  "ɨ",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "ó",
+  "p",
+  "q",
+  "s",
+  "t",
+  "u",
+  "ú",
+  "w",
+  "y",
+  "ʼ",
+};
+const char *ALPHA_186_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_186_UPPER_CPS[] = {
+  65, 69, 73, 74, 75, 76, 77, 78, 79, 80, 81, 83, 84, 85, 87, 89,
+  193, 201, 211, 218, 407, 700,
+};
+const uint32_t ALPHA_186_LOWER_CPS[] = {
+  97, 101, 105, 106, 107, 108, 109, 110, 111, 112, 113, 115, 116, 117, 119, 121,
+  225, 233, 243, 250, 616, 700,
+};
+const uint32_t ALPHA_186_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_186_FREQ[] = {
+  { "a", 0.00000000 },
+  { "á", 0.00000000 },
+  { "e", 0.00000000 },
+  { "é", 0.00000000 },
+  { "i", 0.00000000 },
+  { "ɨ", 0.00000000 },
+  { "j", 0.00000000 },
+  { "k", 0.00000000 },
+  { "l", 0.00000000 },
+  { "m", 0.00000000 },
+  { "n", 0.00000000 },
+  { "o", 0.00000000 },
+  { "ó", 0.00000000 },
+  { "p", 0.00000000 },
+  { "q", 0.00000000 },
+  { "s", 0.00000000 },
+  { "t", 0.00000000 },
+  { "u", 0.00000000 },
+  { "ú", 0.00000000 },
+  { "w", 0.00000000 },
+  { "y", 0.00000000 },
+  { "ʼ", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_186_FREQ_CPS[] = {
+  { 0x61u, 0.00000000 },
+  { 0x65u, 0.00000000 },
+  { 0x69u, 0.00000000 },
+  { 0x6Au, 0.00000000 },
+  { 0x6Bu, 0.00000000 },
+  { 0x6Cu, 0.00000000 },
+  { 0x6Du, 0.00000000 },
+  { 0x6Eu, 0.00000000 },
+  { 0x6Fu, 0.00000000 },
+  { 0x70u, 0.00000000 },
+  { 0x71u, 0.00000000 },
+  { 0x73u, 0.00000000 },
+  { 0x74u, 0.00000000 },
+  { 0x75u, 0.00000000 },
+  { 0x77u, 0.00000000 },
+  { 0x79u, 0.00000000 },
+  { 0xE1u, 0.00000000 },
+  { 0xE9u, 0.00000000 },
+  { 0xF3u, 0.00000000 },
+  { 0xFAu, 0.00000000 },
+  { 0x268u, 0.00000000 },
+  { 0x2BCu, 0.00000000 },
+};
+
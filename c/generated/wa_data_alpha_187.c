@@ -0,0 +1,141 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_187_UPPER[] = {
+  "ࡀ",
+  "ࡁ",
+  "ࡂ",
+  "ࡃ",
+  "ࡄ",
+  "ࡅ",
+  "ࡆ",
+  "ࡇ",
+  "ࡈ",
+  "ࡉ",
+  "ࡊ",
+  "ࡋ",
+  "ࡌ",
+  "ࡍ",
+  "ࡎ",
+  "ࡏ",
+  "ࡐ",
+  "ࡑ",
+  "ࡒ",
+  "ࡓ",
+  "ࡔ",
+  "ࡕ",
+  "ࡖ",
+  "ࡗ",
+  "ࡘ",
+  "࡙",
+  "࡚",
+  "࡛",
+  "࡞",
+};
+const char *ALPHA_187_LOWER[] = {
+  "ࡀ",
+  "ࡁ",
+  "ࡂ",
+  "ࡃ",
+  "ࡄ",
+  "ࡅ",
+  "ࡆ",
+  "ࡇ",
+  "ࡈ",
+  "ࡉ",
+  "ࡊ",
+  "ࡋ",
+  "ࡌ",
+  "ࡍ",
+  "ࡎ",
+  "ࡏ",
+  "ࡐ",
+  "ࡑ",
+  "ࡒ",
+  "ࡓ",
+  "ࡔ",
+  "ࡕ",
+  "ࡖ",
+  "ࡗ",
+  "ࡘ",
+  "࡙",
+  "࡚",
+  "࡛",
+  "࡞",
+};
+const char *ALPHA_187_DIGITS[] = {
+};
+const uint32_t ALPHA_187_UPPER_CPS[] = {
+  2112, 2113, 2114, 2115, 2116, 2117, 2118, 2119, 2120, 2121, 2122, 2123, 2124, 2125, 2126, 2127,
+  2128, 2129, 2130, 2131, 2132, 2133, 2134, 2135, 2136, 2137, 2138, 2139, 2142,
+};
+const uint32_t ALPHA_187_LOWER_CPS[] = {
+  2112, 2113, 2114, 2115, 2116, 2117, 2118, 2119, 2120, 2121, 2122, 2123, 2124, 2125, 2126, 2127,
+  2128, 2129, 2130, 2131, 2132, 2133, 2134, 2135, 2136, 2137, 2138, 2139, 2142,
+};
+const uint32_t ALPHA_187_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_187_FREQ[] = {
+  { "ࡀ", 0.00000000 },
+  { "ࡁ", 0.00000000 },
+  { "ࡂ", 0.00000000 },
+  { "ࡃ", 0.00000000 },
+  { "ࡄ", 0.00000000 },
+  { "ࡅ", 0.00000000 },
+  { "ࡆ", 0.00000000 },
+  { "ࡇ", 0.00000000 },
+  { "ࡈ", 0.00000000 },
+  { "ࡉ", 0.00000000 },
+  { "ࡊ", 0.00000000 },
+  { "ࡋ", 0.00000000 },
+  { "ࡌ", 0.00000000 },
+  { "ࡍ", 0.00000000 },
+  { "ࡎ", 0.00000000 },
+  { "ࡏ", 0.00000000 },
+  { "ࡐ", 0.00000000 },
+  { "ࡑ", 0.00000000 },
+  { "ࡒ", 0.00000000 },
+  { "ࡓ", 0.00000000 },
+  { "ࡔ", 0.00000000 },
+  { "ࡕ", 0.00000000 },
+  { "ࡖ", 0.00000000 },
+  { "ࡗ", 0.00000000 },
+  { "ࡘ", 0.00000000 },
+  { "࡙", 0.00000000 },
+  { "࡚", 0.00000000 },
+  { "࡛", 0.00000000 },
+  { "࡞", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_187_FREQ_CPS[] = {
+  { 0x840u, 0.00000000 },
+  { 0x841u, 0.00000000 },
+  { 0x842u, 0.00000000 },
+  { 0x843u, 0.00000000 },
+  { 0x844u, 0.00000000 },
+  { 0x845u, 0.00000000 },
+  { 0x846u, 0.00000000 },
+  { 0x847u, 0.00000000 },
+  { 0x848u, 0.00000000 },
+  { 0x849u, 0.00000000 },
+  { 0x84Au, 0.00000000 },
+  { 0x84Bu, 0.00000000 },
+  { 0x84Cu, 0.00000000 },
+  { 0x84Du, 0.00000000 },
+  { 0x84Eu, 0.00000000 },
+  { 0x84Fu, 0.00000000 },
+  { 0x850u, 0.00000000 },
+  { 0x851u, 0.00000000 },
+  { 0x852u, 0.00000000 },
+  { 0x853u, 0.00000000 },
+  { 0x854u, 0.00000000 },
+  { 0x855u, 0.00000000 },
+  { 0x856u, 0.00000000 },
+  { 0x857u, 0.00000000 },
+  { 0x858u, 0.00000000 },
+  { 0x859u, 0.00000000 },
+  { 0x85Au, 0.00000000 },
+  { 0x85Bu, 0.00000000 },
+  { 0x85Eu, 0.00000000 },
+};
+
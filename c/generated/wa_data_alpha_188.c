@@ -0,0 +1,149 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_188_UPPER[] = {
+  "А",
+  "Б",
+  "В",
+  "Г",
+  "Д",
+  "Ѓ",
+  "Е",
+  "Ж",
+  "З",
+  "Ѕ",
+  "И",
+  "Ј",
+  "К",
+  "Л",
+  "Љ",
+  "М",
+  "Н",
+  "Њ",
+  "О",
+  "П",
+  "Р",
+  "С",
+  "Т",
+  "Ќ",
+  "У",
+  "Ф",
+  "Х",
+  "Ц",
+  "Ч",
+  "Џ",
+  "Ш",
+};
+const char *ALPHA_188_LOWER[] = {
+  "а",
+  "б",
+  "в",
+  "г",
+  "д",
+  "ѓ",
+  "е",
+  "ж",
+  "з",
+  "ѕ",
+  "и",
+  "ј",
+  "к",
+  "л",
+  "љ",
+  "м",
+  "н",
+  "њ",
+  "о",
+  "п",
+  "р",
+  "с",
+  "т",
+  "ќ",
+  "у",
+  "ф",
+  "х",
+  "ц",
+  "ч",
+  "џ",
+  "ш",
+};
+const char *ALPHA_188_DIGITS[] = {
+};
+const uint32_t ALPHA_188_UPPER_CPS[] = {
+  1027, 1029, 1032, 1033, 1034, 1036, 1039, 1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048,
+  1050, 1051, 1052, 1053, 1054, 1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064,
+};
+const uint32_t ALPHA_188_LOWER_CPS[] = {
+  1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080, 1082, 1083, 1084, 1085, 1086, 1087, 1088,
+  1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 1107, 1109, 1112, 1113, 1114, 1116, 1119,
+};
+const uint32_t ALPHA_188_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_188_FREQ[] = {
+  { "а", 0.13330000 },
+  { "б", 0.01570000 },
+  { "в", 0.04250000 },
+  { "г", 0.01780000 },
+  { "д", 0.03810000 },
+  { "ѓ", 0.00140000 },
+  { "е", 0.08330000 },
+  { "ж", 0.00450000 },
+  { "з", 0.01590000 },
+  { "ѕ", 0.00040000 },
+  { "и", 0.09170000 },
+  { "ј", 0.01930000 },
+  { "к", 0.03970000 },
+  { "л", 0.03480000 },
+  { "љ", 0.00020000 },
+  { "м", 0.02260000 },
+  { "н", 0.07220000 },
+  { "њ", 0.00310000 },
+  { "о", 0.11240000 },
+  { "п", 0.02790000 },
+  { "р", 0.05120000 },
+  { "с", 0.04670000 },
+  { "т", 0.07180000 },
+  { "ќ", 0.00190000 },
+  { "у", 0.02130000 },
+  { "ф", 0.00450000 },
+  { "х", 0.00260000 },
+  { "ц", 0.00710000 },
+  { "ч", 0.00800000 },
+  { "џ", 0.00070000 },
+  { "ш", 0.00730000 },
+};
+
+const wa_cp_freq ALPHA_188_FREQ_CPS[] = {
+  { 0x430u, 0.13330000 },
+  { 0x431u, 0.01570000 },
+  { 0x432u, 0.04250000 },
+  { 0x433u, 0.01780000 },
+  { 0x434u, 0.03810000 },
+  { 0x435u, 0.08330000 },
+  { 0x436u, 0.00450000 },
+  { 0x437u, 0.01590000 },
+  { 0x438u, 0.09170000 },
+  { 0x43Au, 0.03970000 },
+  { 0x43Bu, 0.03480000 },
+  { 0x43Cu, 0.02260000 },
+  { 0x43Du, 0.07220000 },
+  { 0x43Eu, 0.11240000 },
+  { 0x43Fu, 0.02790000 },
+  { 0x440u, 0.05120000 },
+  { 0x441u, 0.04670000 },
+  { 0x442u, 0.07180000 },
+  { 0x443u, 0.02130000 },
+  { 0x444u, 0.00450000 },
+  { 0x445u, 0.00260000 },
+  { 0x446u, 0.00710000 },
+  { 0x447u, 0.00800000 },
+  { 0x448u, 0.00730000 },
+  { 0x453u, 0.00140000 },
+  { 0x455u, 0.00040000 },
+  { 0x458u, 0.01930000 },
+  { 0x459u, 0.00020000 },
+  { 0x45Au, 0.00310000 },
+  { 0x45Cu, 0.00190000 },
+  { 0x45Fu, 0.00070000 },
+};
+
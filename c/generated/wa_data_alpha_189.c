@@ -0,0 +1,225 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_189_UPPER[] = {
+  "അ",
+  "ആ",
+  "ഇ",
+  "ഈ",
+  "ഉ",
+  "ഊ",
+  "ഋ",
+  "എ",
+  "ഏ",
+  "ഐ",
+  "ഒ",
+  "ഓ",
+  "ഔ",
+  "ക",
+  "ഖ",
+  "ഗ",
+  "ഘ",
+  "ങ",
+  "ച",
+  "ഛ",
+  "ജ",
+  "ഝ",
+  "ഞ",
+  "ട",
+  "ഠ",
+  "ഡ",
+  "ഢ",
+  "ണ",
+  "ത",
+  "ഥ",
+  "ദ",
+  "ധ",
+  "ന",
+  "പ",
+  "ഫ",
+  "ബ",
+  "ഭ",
+  "മ",
+  "യ",
+  "ര",
+  "ല",
+  "വ",
+  "ശ",
+  "ഷ",
+  "സ",
+  "ഹ",
+  "ള",
+  "ഴ",
+  "റ",
+};
+const char *ALPHA_189_LOWER[] = {
+  "അ",
+  "ആ",
+  "ഇ",
+  "ഈ",
+  "ഉ",
+  "ഊ",
+  "ഋ",
+  "എ",
+  "ഏ",
+  "ഐ",
+  "ഒ",
+  "ഓ",
+  "ഔ",
+  "ക",
+  "ഖ",
+  "ഗ",
+  "ഘ",
+  "ങ",
+  "ച",
+  "ഛ",
+  "ജ",
+  "ഝ",
+  "ഞ",
+  "ട",
+  "ഠ",
+  "ഡ",
+  "ഢ",
+  "ണ",
+  "ത",
+  "ഥ",
+  "ദ",
+  "ധ",
+  "ന",
+  "പ",
+  "ഫ",
+  "ബ",
+  "ഭ",
+  "മ",
+  "യ",
+  "ര",
+  "ല",
+  "വ",
+  "ശ",
+  "ഷ",
+  "സ",
+  "ഹ",
+  "ള",
+  "ഴ",
+  "റ",
+};
+const char *ALPHA_189_DIGITS[] = {
+};
+const uint32_t ALPHA_189_UPPER_CPS[] = {
+  3333, 3334, 3335, 3336, 3337, 3338, 3339, 3342, 3343, 3344, 3346, 3347, 3348, 3349, 3350, 3351,
+  3352, 3353, 3354, 3355, 3356, 3357, 3358, 3359, 3360, 3361, 3362, 3363, 3364, 3365, 3366, 3367,
+  3368, 3370, 3371, 3372, 3373, 3374, 3375, 3376, 3377, 3378, 3379, 3380, 3381, 3382, 3383, 3384,
+  3385,
+};
+const uint32_t ALPHA_189_LOWER_CPS[] = {
+  3333, 3334, 3335, 3336, 3337, 3338, 3339, 3342, 3343, 3344, 3346, 3347, 3348, 3349, 3350, 3351,
+  3352, 3353, 3354, 3355, 3356, 3357, 3358, 3359, 3360, 3361, 3362, 3363, 3364, 3365, 3366, 3367,
+  3368, 3370, 3371, 3372, 3373, 3374, 3375, 3376, 3377, 3378, 3379, 3380, 3381, 3382, 3383, 3384,
+  3385,
+};
+const uint32_t ALPHA_189_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_189_FREQ[] = {
+  { "അ", 0.01350000 },
+  { "ആ", 0.00660000 },
+  { "ഇ", 0.00740000 },
+  { "ഈ", 0.00250000 },
+  { "ഉ", 0.00440000 },
+  { "ഊ", 0.00020000 },
+  { "ഋ", 0.00000000 },
+  { "എ", 0.00870000 },
+  { "ഏ", 0.00170000 },
+  { "ഐ", 0.00040000 },
+  { "ഒ", 0.00420000 },
+  { "ഓ", 0.00110000 },
+  { "ഔ", 0.00020000 },
+  { "ക", 0.09890000 },
+  { "ഖ", 0.00240000 },
+  { "ഗ", 0.01140000 },
+  { "ഘ", 0.00130000 },
+  { "ങ", 0.02200000 },
+  { "ച", 0.02930000 },
+  { "ഛ", 0.00020000 },
+  { "ജ", 0.00880000 },
+  { "ഝ", 0.00000000 },
+  { "ഞ", 0.00490000 },
+  { "ട", 0.04930000 },
+  { "ഠ", 0.00070000 },
+  { "ഡ", 0.00530000 },
+  { "ഢ", 0.00010000 },
+  { "ണ", 0.02720000 },
+  { "ത", 0.09340000 },
+  { "ഥ", 0.00470000 },
+  { "ദ", 0.01690000 },
+  { "ധ", 0.00840000 },
+  { "ന", 0.10650000 },
+  { "പ", 0.05290000 },
+  { "ഫ", 0.00320000 },
+  { "ബ", 0.00790000 },
+  { "ഭ", 0.00710000 },
+  { "മ", 0.04370000 },
+  { "യ", 0.06790000 },
+  { "ര", 0.06350000 },
+  { "ല", 0.03740000 },
+  { "വ", 0.04440000 },
+  { "ശ", 0.01120000 },
+  { "ഷ", 0.01080000 },
+  { "സ", 0.03620000 },
+  { "ഹ", 0.00750000 },
+  { "ള", 0.02620000 },
+  { "ഴ", 0.00440000 },
+  { "റ", 0.03320000 },
+};
+
+const wa_cp_freq ALPHA_189_FREQ_CPS[] = {
+  { 0xD05u, 0.01350000 },
+  { 0xD06u, 0.00660000 },
+  { 0xD07u, 0.00740000 },
+  { 0xD08u, 0.00250000 },
+  { 0xD09u, 0.00440000 },
+  { 0xD0Au, 0.00020000 },
+  { 0xD0Bu, 0.00000000 },
+  { 0xD0Eu, 0.00870000 },
+  { 0xD0Fu, 0.00170000 },
+  { 0xD10u, 0.00040000 },
+  { 0xD12u, 0.00420000 },
+  { 0xD13u, 0.00110000 },
+  { 0xD14u, 0.00020000 },
+  { 0xD15u, 0.09890000 },
+  { 0xD16u, 0.00240000 },
+  { 0xD17u, 0.01140000 },
+  { 0xD18u, 0.00130000 },
+  { 0xD19u, 0.02200000 },
+  { 0xD1Au, 0.02930000 },
+  { 0xD1Bu, 0.00020000 },
+  { 0xD1Cu, 0.00880000 },
+  { 0xD1Du, 0.00000000 },
+  { 0xD1Eu, 0.00490000 },
+  { 0xD1Fu, 0.04930000 },
+  { 0xD20u, 0.00070000 },
+  { 0xD21u, 0.00530000 },
+  { 0xD22u, 0.00010000 },
+  { 0xD23u, 0.02720000 },
+  { 0xD24u, 0.09340000 },
+  { 0xD25u, 0.00470000 },
+  { 0xD26u, 0.01690000 },
+  { 0xD27u, 0.00840000 },
+  { 0xD28u, 0.10650000 },
+  { 0xD2Au, 0.05290000 },
+  { 0xD2Bu, 0.00320000 },
+  { 0xD2Cu, 0.00790000 },
+  { 0xD2Du, 0.00710000 },
+  { 0xD2Eu, 0.04370000 },
+  { 0xD2Fu, 0.06790000 },
+  { 0xD30u, 0.06350000 },
+  { 0xD31u, 0.03320000 },
+  { 0xD32u, 0.03740000 },
+  { 0xD33u, 0.02620000 },
+  { 0xD34u, 0.00440000 },
+  { 0xD35u, 0.04440000 },
+  { 0xD36u, 0.01120000 },
+  { 0xD37u, 0.01080000 },
+  { 0xD38u, 0.03620000 },
+  { 0xD39u, 0.00750000 },
+};
+
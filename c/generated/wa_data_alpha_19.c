@@ -0,0 +1,335 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_19_UPPER[] = {
+  "ᬅ",
+  "ᬆ",
+  "ᬇ",
+  "ᬈ",
+  "ᬉ",
+  "ᬊ",
+  "ᬋ",
+  "ᬌ",
+  "ᬍ",
+  "ᬎ",
+  "ᬏ",
+  "ᬐ",
+  "ᬑ",
+  "ᬒ",
+  "ᬓ",
+  "ᬔ",
+  "ᬕ",
+  "ᬖ",
+  "ᬗ",
+  "ᬘ",
+  "ᬙ",
+  "ᬚ",
+  "ᬛ",
+  "ᬜ",
+  "ᬝ",
+  "ᬞ",
+  "ᬟ",
+  "ᬠ",
+  "ᬡ",
+  "ᬢ",
+  "ᬣ",
+  "ᬤ",
+  "ᬥ",
+  "ᬦ",
+  "ᬧ",
+  "ᬨ",
+  "ᬩ",
+  "ᬪ",
+  "ᬫ",
+  "ᬬ",
+  "ᬭ",
+  "ᬮ",
+  "ᬯ",
+  "ᬰ",
+  "ᬱ",
+  "ᬲ",
+  "ᬳ",
+  "ᬀ",
+  "ᬁ",
+  "ᬂ",
+  "ᬃ",
+  "ᬄ",
+  "᬴",
+  "ᬵ",
+  "ᬶ",
+  "ᬷ",
+  "ᬸ",
+  "ᬹ",
+  "ᬺ",
+  "ᬻ",
+  "ᬼ",
+  "ᬽ",
+  "ᬾ",
+  "ᬿ",
+  "ᭀ",
+  "ᭁ",
+  "ᭂ",
+  "ᭃ",
+  "᭄",
+  "ᭅ",
+  "ᭆ",
+  "ᭇ",
+  "ᭈ",
+  "ᭉ",
+  "ᭊ",
+  "ᭋ",
+};
+const char *ALPHA_19_LOWER[] = {
+  "ᬅ",
+  "ᬆ",
+  "ᬇ",
+  "ᬈ",
+  "ᬉ",
+  "ᬊ",
+  "ᬋ",
+  "ᬌ",
+  "ᬍ",
+  "ᬎ",
+  "ᬏ",
+  "ᬐ",
+  "ᬑ",
+  "ᬒ",
+  "ᬓ",
+  "ᬔ",
+  "ᬕ",
+  "ᬖ",
+  "ᬗ",
+  "ᬘ",
+  "ᬙ",
+  "ᬚ",
+  "ᬛ",
+  "ᬜ",
+  "ᬝ",
+  "ᬞ",
+  "ᬟ",
+  "ᬠ",
+  "ᬡ",
+  "ᬢ",
+  "ᬣ",
+  "ᬤ",
+  "ᬥ",
+  "ᬦ",
+  "ᬧ",
+  "ᬨ",
+  "ᬩ",
+  "ᬪ",
+  "ᬫ",
+  "ᬬ",
+  "ᬭ",
+  "ᬮ",
+  "ᬯ",
+  "ᬰ",
+  "ᬱ",
+  "ᬲ",
+  "ᬳ",
+  "ᬀ",
+  "ᬁ",
+  "ᬂ",
+  "ᬃ",
+  "ᬄ",
+  "᬴",
+  "ᬵ",
+  "ᬶ",
+  "ᬷ",
+  "ᬸ",
+  "ᬹ",
+  "ᬺ",
+  "ᬻ",
+  "ᬼ",
+  "ᬽ",
+  "ᬾ",
+  "ᬿ",
+  "ᭀ",
+  "ᭁ",
+  "ᭂ",
+  "ᭃ",
+  "᭄",
+  "ᭅ",
+  "ᭆ",
+  "ᭇ",
+  "ᭈ",
+  "ᭉ",
+  "ᭊ",
+  "ᭋ",
+};
+const char *ALPHA_19_DIGITS[] = {
+};
+const uint32_t ALPHA_19_UPPER_CPS[] = {
+  6912, 6913, 6914, 6915, 6916, 6917, 6918, 6919, 6920, 6921, 6922, 6923, 6924, 6925, 6926, 6927,
+  6928, 6929, 6930, 6931, 6932, 6933, 6934, 6935, 6936, 6937, 6938, 6939, 6940, 6941, 6942, 6943,
+  6944, 6945, 6946, 6947, 6948, 6949, 6950, 6951, 6952, 6953, 6954, 6955, 6956, 6957, 6958, 6959,
+  6960, 6961, 6962, 6963, 6964, 6965, 6966, 6967, 6968, 6969, 6970, 6971, 6972, 6973, 6974, 6975,
+  6976, 6977, 6978, 6979, 6980, 6981, 6982, 6983, 6984, 6985, 6986, 6987,
+};
+const uint32_t ALPHA_19_LOWER_CPS[] = {
+  6912, 6913, 6914, 6915, 6916, 6917, 6918, 6919, 6920, 6921, 6922, 6923, 6924, 6925, 6926, 6927,
+  6928, 6929, 6930, 6931, 6932, 6933, 6934, 6935, 6936, 6937, 6938, 6939, 6940, 6941, 6942, 6943,
+  6944, 6945, 6946, 6947, 6948, 6949, 6950, 6951, 6952, 6953, 6954, 6955, 6956, 6957, 6958, 6959,
+  6960, 6961, 6962, 6963, 6964, 6965, 6966, 6967, 6968, 6969, 6970, 6971, 6972, 6973, 6974, 6975,
+  6976, 6977, 6978, 6979, 6980, 6981, 6982, 6983, 6984, 6985, 6986, 6987,
+};
+const uint32_t ALPHA_19_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_19_FREQ[] = {
+  { "ᬅ", 0.00000000 },
+  { "ᬆ", 0.00000000 },
+  { "ᬇ", 0.00000000 },
+  { "ᬈ", 0.00000000 },
+  { "ᬉ", 0.00000000 },
+  { "ᬊ", 0.00000000 },
+  { "ᬋ", 0.00000000 },
+  { "ᬌ", 0.00000000 },
+  { "ᬍ", 0.00000000 },
+  { "ᬎ", 0.00000000 },
+  { "ᬏ", 0.00000000 },
+  { "ᬐ", 0.00000000 },
+  { "ᬑ", 0.00000000 },
+  { "ᬒ", 0.00000000 },
+  { "ᬓ", 0.00000000 },
+  { "ᬔ", 0.00000000 },
+  { "ᬕ", 0.00000000 },
+  { "ᬖ", 0.00000000 },
+  { "ᬗ", 0.00000000 },
+  { "ᬘ", 0.00000000 },
+  { "ᬙ", 0.00000000 },
+  { "ᬚ", 0.00000000 },
+  { "ᬛ", 0.00000000 },
+  { "ᬜ", 0.00000000 },
+  { "ᬝ", 0.00000000 },
+  { "ᬞ", 0.00000000 },
+  { "ᬟ", 0.00000000 },
+  { "ᬠ", 0.00000000 },
+  { "ᬡ", 0.00000000 },
+  { "ᬢ", 0.00000000 },
+  { "ᬣ", 0.00000000 },
+  { "ᬤ", 0.00000000 },
+  { "ᬥ", 0.00000000 },
+  { "ᬦ", 0.00000000 },
+  { "ᬧ", 0.00000000 },
+  { "ᬨ", 0.00000000 },
+  { "ᬩ", 0.00000000 },
+  { "ᬪ", 0.00000000 },
+  { "ᬫ", 0.00000000 },
+  { "ᬬ", 0.00000000 },
+  { "ᬭ", 0.00000000 },
+  { "ᬮ", 0.00000000 },
+  { "ᬯ", 0.00000000 },
+  { "ᬰ", 0.00000000 },
+  { "ᬱ", 0.00000000 },
+  { "ᬲ", 0.00000000 },
+  { "ᬳ", 0.00000000 },
+  { "ᬀ", 0.00000000 },
+  { "ᬁ", 0.00000000 },
+  { "ᬂ", 0.00000000 },
+  { "ᬃ", 0.00000000 },
+  { "ᬄ", 0.00000000 },
+  { "᬴", 0.00000000 },
+  { "ᬵ", 0.00000000 },
+  { "ᬶ", 0.00000000 },
+  { "ᬷ", 0.00000000 },
+  { "ᬸ", 0.00000000 },
+  { "ᬹ", 0.00000000 },
+  { "ᬺ", 0.00000000 },
+  { "ᬻ", 0.00000000 },
+  { "ᬼ", 0.00000000 },
+  { "ᬽ", 0.00000000 },
+  { "ᬾ", 0.00000000 },
+  { "ᬿ", 0.00000000 },
+  { "ᭀ", 0.00000000 },
+  { "ᭁ", 0.00000000 },
+  { "ᭂ", 0.00000000 },
+  { "ᭃ", 0.00000000 },
+  { "᭄", 0.00000000 },
+  { "ᭅ", 0.00000000 },
+  { "ᭆ", 0.00000000 },
+  { "ᭇ", 0.00000000 },
+  { "ᭈ", 0.00000000 },
+  { "ᭉ", 0.00000000 },
+  { "ᭊ", 0.00000000 },
+  { "ᭋ", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_19_FREQ_CPS[] = {
+  { 0x1B00u, 0.00000000 },
+  { 0x1B01u, 0.00000000 },
+  { 0x1B02u, 0.00000000 },
+  { 0x1B03u, 0.00000000 },
+  { 0x1B04u, 0.00000000 },
+  { 0x1B05u, 0.00000000 },
+  { 0x1B06u, 0.00000000 },
+  { 0x1B07u, 0.00000000 },
+  { 0x1B08u, 0.00000000 },
+  { 0x1B09u, 0.00000000 },
+  { 0x1B0Au, 0.00000000 },
+  { 0x1B0Bu, 0.00000000 },
+  { 0x1B0Cu, 0.00000000 },
+  { 0x1B0Du, 0.00000000 },
+  { 0x1B0Eu, 0.00000000 },
+  { 0x1B0Fu, 0.00000000 },
+  { 0x1B10u, 0.00000000 },
+  { 0x1B11u, 0.00000000 },
+  { 0x1B12u, 0.00000000 },
+  { 0x1B13u, 0.00000000 },
+  { 0x1B14u, 0.00000000 },
+  { 0x1B15u, 0.00000000 },
+  { 0x1B16u, 0.00000000 },
+  { 0x1B17u, 0.00000000 },
+  { 0x1B18u, 0.00000000 },
+  { 0x1B19u, 0.00000000 },
+  { 0x1B1Au, 0.00000000 },
+  { 0x1B1Bu, 0.00000000 },
+  { 0x1B1Cu, 0.00000000 },
+  { 0x1B1Du, 0.00000000 },
+  { 0x1B1Eu, 0.00000000 },
+  { 0x1B1Fu, 0.00000000 },
+  { 0x1B20u, 0.00000000 },
+  { 0x1B21u, 0.00000000 },
+  { 0x1B22u, 0.00000000 },
+  { 0x1B23u, 0.00000000 },
+  { 0x1B24u, 0.00000000 },
+  { 0x1B25u, 0.00000000 },
+  { 0x1B26u, 0.00000000 },
+  { 0x1B27u, 0.00000000 },
+  { 0x1B28u, 0.00000000 },
+  { 0x1B29u, 0.00000000 },
+  { 0x1B2Au, 0.00000000 },
+  { 0x1B2Bu, 0.00000000 },
+  { 0x1B2Cu, 0.00000000 },
+  { 0x1B2Du, 0.00000000 },
+  { 0x1B2Eu, 0.00000000 },
+  { 0x1B2Fu, 0.00000000 },
+  { 0x1B30u, 0.00000000 },
+  { 0x1B31u, 0.00000000 },
+  { 0x1B32u, 0.00000000 },
+  { 0x1B33u, 0.00000000 },
+  { 0x1B34u, 0.00000000 },
+  { 0x1B35u, 0.00000000 },
+  { 0x1B36u, 0.00000000 },
+  { 0x1B37u, 0.00000000 },
+  { 0x1B38u, 0.00000000 },
+  { 0x1B39u, 0.00000000 },
+  { 0x1B3Au, 0.00000000 },
+  { 0x1B3Bu, 0.00000000 },
+  { 0x1B3Cu, 0.00000000 },
+  { 0x1B3Du, 0.00000000 },
+  { 0x1B3Eu, 0.00000000 },
+  { 0x1B3Fu, 0.00000000 },
+  { 0x1B40u, 0.00000000 },
+  { 0x1B41u, 0.00000000 },
+  { 0x1B42u, 0.00000000 },
+  { 0x1B43u, 0.00000000 },
+  { 0x1B44u, 0.00000000 },
+  { 0x1B45u, 0.00000000 },
+  { 0x1B46u, 0.00000000 },
+  { 0x1B47u, 0.00000000 },
+  { 0x1B48u, 0.00000000 },
+  { 0x1B49u, 0.00000000 },
+  { 0x1B4Au, 0.00000000 },
+  { 0x1B4Bu, 0.00000000 },
+};
+
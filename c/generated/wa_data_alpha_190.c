@@ -0,0 +1,221 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_190_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+  "À",
+  "Á",
+  "Â",
+  "Ä",
+  "È",
+  "É",
+  "Ê",
+  "Ë",
+  "Ì",
+  "Í",
+  "Î",
+  "Ñ",
+  "Ò",
+  "Ó",
+  "Ô",
+  "Ö",
+  "Ù",
+  "Ú",
+  "Û",
+  "Ü",
+};
+const char *ALPHA_190_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+  "à",
+  "á",
+  "â",
+  "ä",
+  "è",
+  "é",
+  "ê",
+  "ë",
+  "ì",
+  "í",
+  "î",
+  "ñ",
+  "ò",
+  "ó",
+  "ô",
+  "ö",
+  "ù",
+  "ú",
+  "û",
+  "ü",
+};
+const char *ALPHA_190_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_190_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 192, 193, 194, 196, 200, 201,
+  202, 203, 204, 205, 206, 209, 210, 211, 212, 214, 217, 218, 219, 220,
+};
+const uint32_t ALPHA_190_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 224, 225, 226, 228, 232, 233,
+  234, 235, 236, 237, 238, 241, 242, 243, 244, 246, 249, 250, 251, 252,
+};
+const uint32_t ALPHA_190_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_190_FREQ[] = {
+  { "k", 0.02760000 },
+  { "a", 0.04330000 },
+  { "o", 0.03230000 },
+  { "r", 0.02740000 },
+  { "á", 0.02950000 },
+  { "n", 0.06930000 },
+  { "ú", 0.00990000 },
+  { "ü", 0.02240000 },
+  { "y", 0.02220000 },
+  { "ó", 0.01640000 },
+  { "m", 0.04950000 },
+  { "b", 0.02190000 },
+  { "i", 0.05840000 },
+  { "e", 0.04140000 },
+  { "í", 0.03100000 },
+  { "ä", 0.00730000 },
+  { "d", 0.03910000 },
+  { "ë", 0.00760000 },
+  { "t", 0.04040000 },
+  { "s", 0.03180000 },
+  { "j", 0.10690000 },
+  { "p", 0.02610000 },
+  { "u", 0.02450000 },
+  { "à", 0.00470000 },
+  { "g", 0.02920000 },
+  { "é", 0.03670000 },
+  { "â", 0.01040000 },
+  { "ñ", 0.02030000 },
+  { "c", 0.01560000 },
+  { "h", 0.01900000 },
+  { "q", 0.00080000 },
+  { "x", 0.01770000 },
+  { "ö", 0.00570000 },
+  { "ô", 0.01360000 },
+  { "z", 0.01590000 },
+  { "ê", 0.00340000 },
+  { "ù", 0.00290000 },
+  { "ò", 0.00260000 },
+  { "v", 0.00160000 },
+  { "l", 0.00700000 },
+  { "f", 0.00160000 },
+  { "è", 0.00230000 },
+  { "î", 0.00210000 },
+  { "û", 0.00030000 },
+  { "w", 0.00030000 },
+  { "ì", 0.00030000 },
+};
+
+const wa_cp_freq ALPHA_190_FREQ_CPS[] = {
+  { 0x61u, 0.04330000 },
+  { 0x62u, 0.02190000 },
+  { 0x63u, 0.01560000 },
+  { 0x64u, 0.03910000 },
+  { 0x65u, 0.04140000 },
+  { 0x66u, 0.00160000 },
+  { 0x67u, 0.02920000 },
+  { 0x68u, 0.01900000 },
+  { 0x69u, 0.05840000 },
+  { 0x6Au, 0.10690000 },
+  { 0x6Bu, 0.02760000 },
+  { 0x6Cu, 0.00700000 },
+  { 0x6Du, 0.04950000 },
+  { 0x6Eu, 0.06930000 },
+  { 0x6Fu, 0.03230000 },
+  { 0x70u, 0.02610000 },
+  { 0x71u, 0.00080000 },
+  { 0x72u, 0.02740000 },
+  { 0x73u, 0.03180000 },
+  { 0x74u, 0.04040000 },
+  { 0x75u, 0.02450000 },
+  { 0x76u, 0.00160000 },
+  { 0x77u, 0.00030000 },
+  { 0x78u, 0.01770000 },
+  { 0x79u, 0.02220000 },
+  { 0x7Au, 0.01590000 },
+  { 0xE0u, 0.00470000 },
+  { 0xE1u, 0.02950000 },
+  { 0xE2u, 0.01040000 },
+  { 0xE4u, 0.00730000 },
+  { 0xE8u, 0.00230000 },
+  { 0xE9u, 0.03670000 },
+  { 0xEAu, 0.00340000 },
+  { 0xEBu, 0.00760000 },
+  { 0xECu, 0.00030000 },
+  { 0xEDu, 0.03100000 },
+  { 0xEEu, 0.00210000 },
+  { 0xF1u, 0.02030000 },
+  { 0xF2u, 0.00260000 },
+  { 0xF3u, 0.01640000 },
+  { 0xF4u, 0.01360000 },
+  { 0xF6u, 0.00570000 },
+  { 0xF9u, 0.00290000 },
+  { 0xFAu, 0.00990000 },
+  { 0xFBu, 0.00030000 },
+  { 0xFCu, 0.02240000 },
+};
+
@@ -0,0 +1,167 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_191_UPPER[] = {
+  "А",
+  "Б",
+  "В",
+  "Г",
+  "Д",
+  "Е",
+  "Ж",
+  "З",
+  "И",
+  "Й",
+  "К",
+  "Л",
+  "М",
+  "Н",
+  "О",
+  "Ө",
+  "П",
+  "Р",
+  "С",
+  "Т",
+  "У",
+  "Ү",
+  "Ф",
+  "Х",
+  "Ц",
+  "Ч",
+  "Ш",
+  "Щ",
+  "Ъ",
+  "Ы",
+  "Ь",
+  "Э",
+  "Ю",
+  "Я",
+  "Ё",
+};
+const char *ALPHA_191_LOWER[] = {
+  "а",
+  "б",
+  "в",
+  "г",
+  "д",
+  "е",
+  "ж",
+  "з",
+  "и",
+  "й",
+  "к",
+  "л",
+  "м",
+  "н",
+  "о",
+  "ө",
+  "п",
+  "р",
+  "с",
+  "т",
+  "у",
+  "ү",
+  "ф",
+  "х",
+  "ц",
+  "ч",
+  "ш",
+  "щ",
+  "ъ",
+  "ы",
+  "ь",
+  "э",
+  "ю",
+  "я",
+  "ё",
+};
+const char *ALPHA_191_DIGITS[] = {
+};
+const uint32_t ALPHA_191_UPPER_CPS[] = {
+  1025, 1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053, 1054,
+  1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069, 1070,
+  1071, 1198, 1256,
+};
+const uint32_t ALPHA_191_LOWER_CPS[] = {
+  1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080, 1081, 1082, 1083, 1084, 1085, 1086, 1087,
+  1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103,
+  1105, 1199, 1257,
+};
+const uint32_t ALPHA_191_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_191_FREQ[] = {
+  { "а", 0.10900000 },
+  { "б", 0.02630000 },
+  { "в", 0.01240000 },
+  { "г", 0.05950000 },
+  { "д", 0.04840000 },
+  { "е", 0.00940000 },
+  { "ж", 0.01450000 },
+  { "з", 0.01020000 },
+  { "и", 0.04760000 },
+  { "й", 0.03980000 },
+  { "к", 0.00570000 },
+  { "л", 0.05880000 },
+  { "м", 0.02440000 },
+  { "н", 0.09320000 },
+  { "о", 0.05600000 },
+  { "ө", 0.02450000 },
+  { "п", 0.00300000 },
+  { "р", 0.05430000 },
+  { "с", 0.03440000 },
+  { "т", 0.03820000 },
+  { "у", 0.03830000 },
+  { "ү", 0.02760000 },
+  { "ф", 0.00140000 },
+  { "х", 0.03920000 },
+  { "ц", 0.00690000 },
+  { "ч", 0.01000000 },
+  { "ш", 0.00750000 },
+  { "щ", 0.00000000 },
+  { "ъ", 0.00010000 },
+  { "ы", 0.01570000 },
+  { "ь", 0.00880000 },
+  { "э", 0.06740000 },
+  { "ю", 0.00280000 },
+  { "я", 0.00370000 },
+  { "ё", 0.00120000 },
+};
+
+const wa_cp_freq ALPHA_191_FREQ_CPS[] = {
+  { 0x430u, 0.10900000 },
+  { 0x431u, 0.02630000 },
+  { 0x432u, 0.01240000 },
+  { 0x433u, 0.05950000 },
+  { 0x434u, 0.04840000 },
+  { 0x435u, 0.00940000 },
+  { 0x436u, 0.01450000 },
+  { 0x437u, 0.01020000 },
+  { 0x438u, 0.04760000 },
+  { 0x439u, 0.03980000 },
+  { 0x43Au, 0.00570000 },
+  { 0x43Bu, 0.05880000 },
+  { 0x43Cu, 0.02440000 },
+  { 0x43Du, 0.09320000 },
+  { 0x43Eu, 0.05600000 },
+  { 0x43Fu, 0.00300000 },
+  { 0x440u, 0.05430000 },
+  { 0x441u, 0.03440000 },
+  { 0x442u, 0.03820000 },
+  { 0x443u, 0.03830000 },
+  { 0x444u, 0.00140000 },
+  { 0x445u, 0.03920000 },
+  { 0x446u, 0.00690000 },
+  { 0x447u, 0.01000000 },
+  { 0x448u, 0.00750000 },
+  { 0x449u, 0.00000000 },
+  { 0x44Au, 0.00010000 },
+  { 0x44Bu, 0.01570000 },
+  { 0x44Cu, 0.00880000 },
+  { 0x44Du, 0.06740000 },
+  { 0x44Eu, 0.00280000 },
+  { 0x44Fu, 0.00370000 },
+  { 0x451u, 0.00120000 },
+  { 0x4AFu, 0.02760000 },
+  { 0x4E9u, 0.02450000 },
+};
+
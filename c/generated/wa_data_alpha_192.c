@@ -0,0 +1,167 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_192_UPPER[] = {
+  "ᠠ",
+  "ᠡ",
+  "ᠢ",
+  "ᠣ",
+  "ᠤ",
+  "ᠥ",
+  "ᠦ",
+  "ᠧ",
+  "ᠨ",
+  "ᠩ",
+  "ᠪ",
+  "ᠫ",
+  "ᠬ",
+  "ᠭ",
+  "ᠮ",
+  "ᠯ",
+  "ᠰ",
+  "ᠱ",
+  "ᠲ",
+  "ᠳ",
+  "ᠴ",
+  "ᠵ",
+  "ᠶ",
+  "ᠷ",
+  "ᠸ",
+  "ᠹ",
+  "ᠺ",
+  "ᠻ",
+  "ᠼ",
+  "ᠽ",
+  "ᠾ",
+  "ᠿ",
+  "ᡀ",
+  "ᡁ",
+  "ᡂ",
+};
+const char *ALPHA_192_LOWER[] = {
+  "ᠠ",
+  "ᠡ",
+  "ᠢ",
+  "ᠣ",
+  "ᠤ",
+  "ᠥ",
+  "ᠦ",
+  "ᠧ",
+  "ᠨ",
+  "ᠩ",
+  "ᠪ",
+  "ᠫ",
+  "ᠬ",
+  "ᠭ",
+  "ᠮ",
+  "ᠯ",
+  "ᠰ",
+  "ᠱ",
+  "ᠲ",
+  "ᠳ",
+  "ᠴ",
+  "ᠵ",
+  "ᠶ",
+  "ᠷ",
+  "ᠸ",
+  "ᠹ",
+  "ᠺ",
+  "ᠻ",
+  "ᠼ",
+  "ᠽ",
+  "ᠾ",
+  "ᠿ",
+  "ᡀ",
+  "ᡁ",
+  "ᡂ",
+};
+const char *ALPHA_192_DIGITS[] = {
+};
+const uint32_t ALPHA_192_UPPER_CPS[] = {
+  6176, 6177, 6178, 6179, 6180, 6181, 6182, 6183, 6184, 6185, 6186, 6187, 6188, 6189, 6190, 6191,
+  6192, 6193, 6194, 6195, 6196, 6197, 6198, 6199, 6200, 6201, 6202, 6203, 6204, 6205, 6206, 6207,
+  6208, 6209, 6210,
+};
+const uint32_t ALPHA_192_LOWER_CPS[] = {
+  6176, 6177, 6178, 6179, 6180, 6181, 6182, 6183, 6184, 6185, 6186, 6187, 6188, 6189, 6190, 6191,
+  6192, 6193, 6194, 6195, 6196, 6197, 6198, 6199, 6200, 6201, 6202, 6203, 6204, 6205, 6206, 6207,
+  6208, 6209, 6210,
+};
+const uint32_t ALPHA_192_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_192_FREQ[] = {
+  { "ᠠ", 0.17650000 },
+  { "ᠡ", 0.05880000 },
+  { "ᠢ", 0.02940000 },
+  { "ᠣ", 0.08820000 },
+  { "ᠤ", 0.00000000 },
+  { "ᠥ", 0.00000000 },
+  { "ᠦ", 0.05880000 },
+  { "ᠧ", 0.00000000 },
+  { "ᠨ", 0.08820000 },
+  { "ᠩ", 0.02940000 },
+  { "ᠪ", 0.02940000 },
+  { "ᠫ", 0.00000000 },
+  { "ᠬ", 0.02940000 },
+  { "ᠭ", 0.02940000 },
+  { "ᠮ", 0.02940000 },
+  { "ᠯ", 0.14710000 },
+  { "ᠰ", 0.11760000 },
+  { "ᠱ", 0.00000000 },
+  { "ᠲ", 0.02940000 },
+  { "ᠳ", 0.02940000 },
+  { "ᠴ", 0.00000000 },
+  { "ᠵ", 0.02940000 },
+  { "ᠶ", 0.00000000 },
+  { "ᠷ", 0.00000000 },
+  { "ᠸ", 0.00000000 },
+  { "ᠹ", 0.00000000 },
+  { "ᠺ", 0.00000000 },
+  { "ᠻ", 0.00000000 },
+  { "ᠼ", 0.00000000 },
+  { "ᠽ", 0.00000000 },
+  { "ᠾ", 0.00000000 },
+  { "ᠿ", 0.00000000 },
+  { "ᡀ", 0.00000000 },
+  { "ᡁ", 0.00000000 },
+  { "ᡂ", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_192_FREQ_CPS[] = {
+  { 0x1820u, 0.17650000 },
+  { 0x1821u, 0.05880000 },
+  { 0x1822u, 0.02940000 },
+  { 0x1823u, 0.08820000 },
+  { 0x1824u, 0.00000000 },
+  { 0x1825u, 0.00000000 },
+  { 0x1826u, 0.05880000 },
+  { 0x1827u, 0.00000000 },
+  { 0x1828u, 0.08820000 },
+  { 0x1829u, 0.02940000 },
+  { 0x182Au, 0.02940000 },
+  { 0x182Bu, 0.00000000 },
+  { 0x182Cu, 0.02940000 },
+  { 0x182Du, 0.02940000 },
+  { 0x182Eu, 0.02940000 },
+  { 0x182Fu, 0.14710000 },
+  { 0x1830u, 0.11760000 },
+  { 0x1831u, 0.00000000 },
+  { 0x1832u, 0.02940000 },
+  { 0x1833u, 0.02940000 },
+  { 0x1834u, 0.00000000 },
+  { 0x1835u, 0.02940000 },
+  { 0x1836u, 0.00000000 },
+  { 0x1837u, 0.00000000 },
+  { 0x1838u, 0.00000000 },
+  { 0x1839u, 0.00000000 },
+  { 0x183Au, 0.00000000 },
+  { 0x183Bu, 0.00000000 },
+  { 0x183Cu, 0.00000000 },
+  { 0x183Du, 0.00000000 },
+  { 0x183Eu, 0.00000000 },
+  { 0x183Fu, 0.00000000 },
+  { 0x1840u, 0.00000000 },
+  { 0x1841u, 0.00000000 },
+  { 0x1842u, 0.00000000 },
+};
+
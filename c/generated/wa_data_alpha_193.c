@@ -0,0 +1,213 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_193_UPPER[] = {
+  "অ",
+  "আ",
+  "ই",
+  "ঈ",
+  "উ",
+  "ঊ",
+  "ঋ",
+  "এ",
+  "ঐ",
+  "ও",
+  "ঔ",
+  "ক",
+  "খ",
+  "গ",
+  "ঘ",
+  "ঙ",
+  "চ",
+  "ছ",
+  "জ",
+  "ঝ",
+  "ঞ",
+  "ট",
+  "ঠ",
+  "ড",
+  "ঢ",
+  "ণ",
+  "ত",
+  "থ",
+  "দ",
+  "ধ",
+  "ন",
+  "প",
+  "ফ",
+  "ব",
+  "ভ",
+  "ম",
+  "য",
+  "র",
+  "ল",
+  "ৱ",
+  "শ",
+  "ষ",
+  "স",
+  "হ",
+};
+const char *ALPHA_193_LOWER[] = {
+  "অ",
+  "আ",
+  "ই",
+  "ঈ",
+  "উ",
+  "ঊ",
+  "ঋ",
+  "এ",
+  "ঐ",
+  "ও",
+  "ঔ",
+  "ক",
+  "খ",
+  "গ",
+  "ঘ",
+  "ঙ",
+  "চ",
+  "ছ",
+  "জ",
+  "ঝ",
+  "ঞ",
+  "ট",
+  "ঠ",
+  "ড",
+  "ঢ",
+  "ণ",
+  "ত",
+  "থ",
+  "দ",
+  "ধ",
+  "ন",
+  "প",
+  "ফ",
+  "ব",
+  "ভ",
+  "ম",
+  "য",
+  "র",
+  "ল",
+  "ৱ",
+  "শ",
+  "ষ",
+  "স",
+  "হ",
+};
+const char *ALPHA_193_DIGITS[] = {
+  "০",
+  "১",
+  "২",
+  "৩",
+  "৪",
+  "৫",
+  "৬",
+  "৭",
+  "৮",
+  "৯",
+};
+const uint32_t ALPHA_193_UPPER_CPS[] = {
+  2437, 2438, 2439, 2440, 2441, 2442, 2443, 2447, 2448, 2451, 2452, 2453, 2454, 2455, 2456, 2457,
+  2458, 2459, 2460, 2461, 2462, 2463, 2464, 2465, 2466, 2467, 2468, 2469, 2470, 2471, 2472, 2474,
+  2475, 2476, 2477, 2478, 2479, 2480, 2482, 2486, 2487, 2488, 2489, 2545,
+};
+const uint32_t ALPHA_193_LOWER_CPS[] = {
+  2437, 2438, 2439, 2440, 2441, 2442, 2443, 2447, 2448, 2451, 2452, 2453, 2454, 2455, 2456, 2457,
+  2458, 2459, 2460, 2461, 2462, 2463, 2464, 2465, 2466, 2467, 2468, 2469, 2470, 2471, 2472, 2474,
+  2475, 2476, 2477, 2478, 2479, 2480, 2482, 2486, 2487, 2488, 2489, 2545,
+};
+const uint32_t ALPHA_193_DIGITS_CPS[] = {
+  2534, 2535, 2536, 2537, 2538, 2539, 2540, 2541, 2542, 2543,
+};
+const wa_freq_entry ALPHA_193_FREQ[] = {
+  { "অ", 0.00000000 },
+  { "আ", 0.00000000 },
+  { "ই", 0.00000000 },
+  { "ঈ", 0.00000000 },
+  { "উ", 0.00000000 },
+  { "ঊ", 0.00000000 },
+  { "ঋ", 0.00000000 },
+  { "এ", 0.00000000 },
+  { "ঐ", 0.00000000 },
+  { "ও", 0.00000000 },
+  { "ঔ", 0.00000000 },
+  { "ক", 0.00000000 },
+  { "খ", 0.00000000 },
+  { "গ", 0.00000000 },
+  { "ঘ", 0.00000000 },
+  { "ঙ", 0.00000000 },
+  { "চ", 0.00000000 },
+  { "ছ", 0.00000000 },
+  { "জ", 0.00000000 },
+  { "ঝ", 0.00000000 },
+  { "ঞ", 0.00000000 },
+  { "ট", 0.00000000 },
+  { "ঠ", 0.00000000 },
+  { "ড", 0.00000000 },
+  { "ঢ", 0.00000000 },
+  { "ণ", 0.00000000 },
+  { "ত", 0.00000000 },
+  { "থ", 0.00000000 },
+  { "দ", 0.00000000 },
+  { "ধ", 0.00000000 },
+  { "ন", 0.00000000 },
+  { "প", 0.00000000 },
+  { "ফ", 0.00000000 },
+  { "ব", 0.00000000 },
+  { "ভ", 0.00000000 },
+  { "ম", 0.00000000 },
+  { "য", 0.00000000 },
+  { "র", 0.00000000 },
+  { "ল", 0.00000000 },
+  { "ৱ", 0.00000000 },
+  { "শ", 0.00000000 },
+  { "ষ", 0.00000000 },
+  { "স", 0.00000000 },
+  { "হ", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_193_FREQ_CPS[] = {
+  { 0x985u, 0.00000000 },
+  { 0x986u, 0.00000000 },
+  { 0x987u, 0.00000000 },
+  { 0x988u, 0.00000000 },
+  { 0x989u, 0.00000000 },
+  { 0x98Au, 0.00000000 },
+  { 0x98Bu, 0.00000000 },
+  { 0x98Fu, 0.00000000 },
+  { 0x990u, 0.00000000 },
+  { 0x993u, 0.00000000 },
+  { 0x994u, 0.00000000 },
+  { 0x995u, 0.00000000 },
+  { 0x996u, 0.00000000 },
+  { 0x997u, 0.00000000 },
+  { 0x998u, 0.00000000 },
+  { 0x999u, 0.00000000 },
+  { 0x99Au, 0.00000000 },
+  { 0x99Bu, 0.00000000 },
+  { 0x99Cu, 0.00000000 },
+  { 0x99Du, 0.00000000 },
+  { 0x99Eu, 0.00000000 },
+  { 0x99Fu, 0.00000000 },
+  { 0x9A0u, 0.00000000 },
+  { 0x9A1u, 0.00000000 },
+  { 0x9A2u, 0.00000000 },
+  { 0x9A3u, 0.00000000 },
+  { 0x9A4u, 0.00000000 },
+  { 0x9A5u, 0.00000000 },
+  { 0x9A6u, 0.00000000 },
+  { 0x9A7u, 0.00000000 },
+  { 0x9A8u, 0.00000000 },
+  { 0x9AAu, 0.00000000 },
+  { 0x9ABu, 0.00000000 },
+  { 0x9ACu, 0.00000000 },
+  { 0x9ADu, 0.00000000 },
+  { 0x9AEu, 0.00000000 },
+  { 0x9AFu, 0.00000000 },
+  { 0x9B0u, 0.00000000 },
+  { 0x9B2u, 0.00000000 },
+  { 0x9B6u, 0.00000000 },
+  { 0x9B7u, 0.00000000 },
+  { 0x9B8u, 0.00000000 },
+  { 0x9B9u, 0.00000000 },
+  { 0x9F1u, 0.00000000 },
+};
+
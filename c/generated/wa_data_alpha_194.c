@@ -0,0 +1,177 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_194_UPPER[] = {
+  "ꯀ",
+  "ꯁ",
+  "ꯂ",
+  "ꯃ",
+  "ꯄ",
+  "ꯅ",
+  "ꯆ",
+  "ꯇ",
+  "ꯈ",
+  "ꯉ",
+  "ꯊ",
+  "ꯋ",
+  "ꯌ",
+  "ꯍ",
+  "ꯎ",
+  "ꯏ",
+  "ꯐ",
+  "ꯑ",
+  "ꯒ",
+  "ꯓ",
+  "ꯔ",
+  "ꯕ",
+  "ꯖ",
+  "ꯗ",
+  "ꯘ",
+  "ꯙ",
+  "ꯚ",
+  "ꯛ",
+  "ꯜ",
+  "ꯝ",
+  "ꯞ",
+  "ꯟ",
+  "ꯠ",
+  "ꯡ",
+  "ꯢ",
+};
+const char *ALPHA_194_LOWER[] = {
+  "ꯀ",
+  "ꯁ",
+  "ꯂ",
+  "ꯃ",
+  "ꯄ",
+  "ꯅ",
+  "ꯆ",
+  "ꯇ",
+  "ꯈ",
+  "ꯉ",
+  "ꯊ",
+  "ꯋ",
+  "ꯌ",
+  "ꯍ",
+  "ꯎ",
+  "ꯏ",
+  "ꯐ",
+  "ꯑ",
+  "ꯒ",
+  "ꯓ",
+  "ꯔ",
+  "ꯕ",
+  "ꯖ",
+  "ꯗ",
+  "ꯘ",
+  "ꯙ",
+  "ꯚ",
+  "ꯛ",
+  "ꯜ",
+  "ꯝ",
+  "ꯞ",
+  "ꯟ",
+  "ꯠ",
+  "ꯡ",
+  "ꯢ",
+};
+const char *ALPHA_194_DIGITS[] = {
+  "꯰",
+  "꯱",
+  "꯲",
+  "꯳",
+  "꯴",
+  "꯵",
+  "꯶",
+  "꯷",
+  "꯸",
+  "꯹",
+};
+const uint32_t ALPHA_194_UPPER_CPS[] = {
+  43968, 43969, 43970, 43971, 43972, 43973, 43974, 43975, 43976, 43977, 43978, 43979, 43980, 43981, 43982, 43983,
+  43984, 43985, 43986, 43987, 43988, 43989, 43990, 43991, 43992, 43993, 43994, 43995, 43996, 43997, 43998, 43999,
+  44000, 44001, 44002,
+};
+const uint32_t ALPHA_194_LOWER_CPS[] = {
+  43968, 43969, 43970, 43971, 43972, 43973, 43974, 43975, 43976, 43977, 43978, 43979, 43980, 43981, 43982, 43983,
+  43984, 43985, 43986, 43987, 43988, 43989, 43990, 43991, 43992, 43993, 43994, 43995, 43996, 43997, 43998, 43999,
+  44000, 44001, 44002,
+};
+const uint32_t ALPHA_194_DIGITS_CPS[] = {
+  44016, 44017, 44018, 44019, 44020, 44021, 44022, 44023, 44024, 44025,
+};
+const wa_freq_entry ALPHA_194_FREQ[] = {
+  { "ꯀ", 0.00000000 },
+  { "ꯁ", 0.00000000 },
+  { "ꯂ", 0.00000000 },
+  { "ꯃ", 0.00000000 },
+  { "ꯄ", 0.00000000 },
+  { "ꯅ", 0.00000000 },
+  { "ꯆ", 0.00000000 },
+  { "ꯇ", 0.00000000 },
+  { "ꯈ", 0.00000000 },
+  { "ꯉ", 0.00000000 },
+  { "ꯊ", 0.00000000 },
+  { "ꯋ", 0.00000000 },
+  { "ꯌ", 0.00000000 },
+  { "ꯍ", 0.00000000 },
+  { "ꯎ", 0.00000000 },
+  { "ꯏ", 0.00000000 },
+  { "ꯐ", 0.00000000 },
+  { "ꯑ", 0.00000000 },
+  { "ꯒ", 0.00000000 },
+  { "ꯓ", 0.00000000 },
+  { "ꯔ", 0.00000000 },
+  { "ꯕ", 0.00000000 },
+  { "ꯖ", 0.00000000 },
+  { "ꯗ", 0.00000000 },
+  { "ꯘ", 0.00000000 },
+  { "ꯙ", 0.00000000 },
+  { "ꯚ", 0.00000000 },
+  { "ꯛ", 0.00000000 },
+  { "ꯜ", 0.00000000 },
+  { "ꯝ", 0.00000000 },
+  { "ꯞ", 0.00000000 },
+  { "ꯟ", 0.00000000 },
+  { "ꯠ", 0.00000000 },
+  { "ꯡ", 0.00000000 },
+  { "ꯢ", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_194_FREQ_CPS[] = {
+  { 0xABC0u, 0.00000000 },
+  { 0xABC1u, 0.00000000 },
+  { 0xABC2u, 0.00000000 },
+  { 0xABC3u, 0.00000000 },
+  { 0xABC4u, 0.00000000 },
+  { 0xABC5u, 0.00000000 },
+  { 0xABC6u, 0.00000000 },
+  { 0xABC7u, 0.00000000 },
+  { 0xABC8u, 0.00000000 },
+  { 0xABC9u, 0.00000000 },
+  { 0xABCAu, 0.00000000 },
+  { 0xABCBu, 0.00000000 },
+  { 0xABCCu, 0.00000000 },
+  { 0xABCDu, 0.00000000 },
+  { 0xABCEu, 0.00000000 },
+  { 0xABCFu, 0.00000000 },
+  { 0xABD0u, 0.00000000 },
+  { 0xABD1u, 0.00000000 },
+  { 0xABD2u, 0.00000000 },
+  { 0xABD3u, 0.00000000 },
+  { 0xABD4u, 0.00000000 },
+  { 0xABD5u, 0.00000000 },
+  { 0xABD6u, 0.00000000 },
+  { 0xABD7u, 0.00000000 },
+  { 0xABD8u, 0.00000000 },
+  { 0xABD9u, 0.00000000 },
+  { 0xABDAu, 0.00000000 },
+  { 0xABDBu, 0.00000000 },
+  { 0xABDCu, 0.00000000 },
+  { 0xABDDu, 0.00000000 },
+  { 0xABDEu, 0.00000000 },
+  { 0xABDFu, 0.00000000 },
+  { 0xABE0u, 0.00000000 },
+  { 0xABE1u, 0.00000000 },
+  { 0xABE2u, 0.00000000 },
+};
+
@@ -0,0 +1,149 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_195_UPPER[] = {
+  "A",
+  "Ă",
+  "Â",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "Î",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "Ș",
+  "T",
+  "Ț",
+  "U",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+};
+const char *ALPHA_195_LOWER[] = {
+  "a",
+  "ă",
+  "â",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "î",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "q",
+  "r",
+  "s",
+  "ș",
+  "t",
+  "ț",
+  "u",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+};
+const char *ALPHA_195_DIGITS[] = {
+};
+const uint32_t ALPHA_195_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 194, 206, 258, 536, 538,
+};
+const uint32_t ALPHA_195_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 226, 238, 259, 537, 539,
+};
+const uint32_t ALPHA_195_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_195_FREQ[] = {
+  { "a", 0.10260000 },
+  { "w", 0.00480000 },
+  { "t", 0.06470000 },
+  { "î", 0.00730000 },
+  { "h", 0.01040000 },
+  { "n", 0.06560000 },
+  { "g", 0.01090000 },
+  { "d", 0.03290000 },
+  { "b", 0.00990000 },
+  { "ș", 0.00000000 },
+  { "e", 0.11600000 },
+  { "o", 0.04830000 },
+  { "z", 0.00800000 },
+  { "p", 0.02780000 },
+  { "x", 0.00460000 },
+  { "i", 0.11770000 },
+  { "k", 0.00600000 },
+  { "â", 0.00270000 },
+  { "l", 0.05420000 },
+  { "v", 0.01100000 },
+  { "c", 0.04870000 },
+  { "ț", 0.00000000 },
+  { "m", 0.03400000 },
+  { "j", 0.00180000 },
+  { "u", 0.05580000 },
+  { "s", 0.05130000 },
+  { "q", 0.00060000 },
+  { "f", 0.01230000 },
+  { "ă", 0.02170000 },
+  { "r", 0.06530000 },
+  { "y", 0.00320000 },
+};
+
+const wa_cp_freq ALPHA_195_FREQ_CPS[] = {
+  { 0x61u, 0.10260000 },
+  { 0x62u, 0.00990000 },
+  { 0x63u, 0.04870000 },
+  { 0x64u, 0.03290000 },
+  { 0x65u, 0.11600000 },
+  { 0x66u, 0.01230000 },
+  { 0x67u, 0.01090000 },
+  { 0x68u, 0.01040000 },
+  { 0x69u, 0.11770000 },
+  { 0x6Au, 0.00180000 },
+  { 0x6Bu, 0.00600000 },
+  { 0x6Cu, 0.05420000 },
+  { 0x6Du, 0.03400000 },
+  { 0x6Eu, 0.06560000 },
+  { 0x6Fu, 0.04830000 },
+  { 0x70u, 0.02780000 },
+  { 0x71u, 0.00060000 },
+  { 0x72u, 0.06530000 },
+  { 0x73u, 0.05130000 },
+  { 0x74u, 0.06470000 },
+  { 0x75u, 0.05580000 },
+  { 0x76u, 0.01100000 },
+  { 0x77u, 0.00480000 },
+  { 0x78u, 0.00460000 },
+  { 0x79u, 0.00320000 },
+  { 0x7Au, 0.00800000 },
+  { 0xE2u, 0.00270000 },
+  { 0xEEu, 0.00730000 },
+  { 0x103u, 0.02170000 },
+  { 0x219u, 0.00000000 },
+  { 0x21Bu, 0.00000000 },
+};
+
@@ -0,0 +1,119 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_196_UPPER[] = {
+  "A",
+  "Á",
+  "À",
+  "E",
+  "É",
+  "È",
+  "H",
+  "I",
+  "Í",
+  "Ì",
+  "K",
+  "N",
+  "O",
+  "Ó",
+  "Ò",
+  "R",
+  "S",
+  "T",
+  "W",
+  "Y",
+  "ʼ",
+};
+const char *ALPHA_196_LOWER[] = {
+  "a",
+  "á",
+  "à",
+  "e",
+  "é",
+  "è",
+  "h",
+  "i",
+  "í",
+  "ì",
+  "k",
+  "n",
+  "o",
+  "ó",
+  "ò",
+  "r",
+  "s",
+  "t",
+  "w",
+  "y",
+  "ʼ",
+};
+const char *ALPHA_196_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_196_UPPER_CPS[] = {
+  65, 69, 72, 73, 75, 78, 79, 82, 83, 84, 87, 89, 192, 193, 200, 201,
+  204, 205, 210, 211, 700,
+};
+const uint32_t ALPHA_196_LOWER_CPS[] = {
+  97, 101, 104, 105, 107, 110, 111, 114, 115, 116, 119, 121, 224, 225, 232, 233,
+  236, 237, 242, 243, 700,
+};
+const uint32_t ALPHA_196_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_196_FREQ[] = {
+  { "a", 0.00000000 },
+  { "á", 0.00000000 },
+  { "à", 0.00000000 },
+  { "e", 0.00000000 },
+  { "é", 0.00000000 },
+  { "è", 0.00000000 },
+  { "h", 0.00000000 },
+  { "i", 0.00000000 },
+  { "í", 0.00000000 },
+  { "ì", 0.00000000 },
+  { "k", 0.00000000 },
+  { "n", 0.00000000 },
+  { "o", 0.00000000 },
+  { "ó", 0.00000000 },
+  { "ò", 0.00000000 },
+  { "r", 0.00000000 },
+  { "s", 0.00000000 },
+  { "t", 0.00000000 },
+  { "w", 0.00000000 },
+  { "y", 0.00000000 },
+  { "ʼ", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_196_FREQ_CPS[] = {
+  { 0x61u, 0.00000000 },
+  { 0x65u, 0.00000000 },
+  { 0x68u, 0.00000000 },
+  { 0x69u, 0.00000000 },
+  { 0x6Bu, 0.00000000 },
+  { 0x6Eu, 0.00000000 },
+  { 0x6Fu, 0.00000000 },
+  { 0x72u, 0.00000000 },
+  { 0x73u, 0.00000000 },
+  { 0x74u, 0.00000000 },
+  { 0x77u, 0.00000000 },
+  { 0x79u, 0.00000000 },
+  { 0xE0u, 0.00000000 },
+  { 0xE1u, 0.00000000 },
+  { 0xE8u, 0.00000000 },
+  { 0xE9u, 0.00000000 },
+  { 0xECu, 0.00000000 },
+  { 0xEDu, 0.00000000 },
+  { 0xF2u, 0.00000000 },
+  { 0xF3u, 0.00000000 },
+  { 0x2BCu, 0.00000000 },
+};
+
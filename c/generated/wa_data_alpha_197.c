@@ -0,0 +1,225 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_197_UPPER[] = {
+  "ॐ",
+  "अ",
+  "आ",
+  "इ",
+  "ई",
+  "उ",
+  "ऊ",
+  "ऋ",
+  "ऌ",
+  "ए",
+  "ऐ",
+  "ऑ",
+  "ओ",
+  "औ",
+  "क",
+  "ख",
+  "ग",
+  "घ",
+  "ङ",
+  "च",
+  "छ",
+  "ज",
+  "झ",
+  "ञ",
+  "ट",
+  "ठ",
+  "ड",
+  "ढ",
+  "ण",
+  "त",
+  "थ",
+  "द",
+  "ध",
+  "न",
+  "प",
+  "फ",
+  "ब",
+  "भ",
+  "म",
+  "य",
+  "र",
+  "ल",
+  "व",
+  "श",
+  "ष",
+  "स",
+  "ह",
+  "ळ",
+  "ऽ",
+};
+const char *ALPHA_197_LOWER[] = {
+  "ॐ",
+  "अ",
+  "आ",
+  "इ",
+  "ई",
+  "उ",
+  "ऊ",
+  "ऋ",
+  "ऌ",
+  "ए",
+  "ऐ",
+  "ऑ",
+  "ओ",
+  "औ",
+  "क",
+  "ख",
+  "ग",
+  "घ",
+  "ङ",
+  "च",
+  "छ",
+  "ज",
+  "झ",
+  "ञ",
+  "ट",
+  "ठ",
+  "ड",
+  "ढ",
+  "ण",
+  "त",
+  "थ",
+  "द",
+  "ध",
+  "न",
+  "प",
+  "फ",
+  "ब",
+  "भ",
+  "म",
+  "य",
+  "र",
+  "ल",
+  "व",
+  "श",
+  "ष",
+  "स",
+  "ह",
+  "ळ",
+  "ऽ",
+};
+const char *ALPHA_197_DIGITS[] = {
+};
+const uint32_t ALPHA_197_UPPER_CPS[] = {
+  2309, 2310, 2311, 2312, 2313, 2314, 2315, 2316, 2319, 2320, 2321, 2323, 2324, 2325, 2326, 2327,
+  2328, 2329, 2330, 2331, 2332, 2333, 2334, 2335, 2336, 2337, 2338, 2339, 2340, 2341, 2342, 2343,
+  2344, 2346, 2347, 2348, 2349, 2350, 2351, 2352, 2354, 2355, 2357, 2358, 2359, 2360, 2361, 2365,
+  2384,
+};
+const uint32_t ALPHA_197_LOWER_CPS[] = {
+  2309, 2310, 2311, 2312, 2313, 2314, 2315, 2316, 2319, 2320, 2321, 2323, 2324, 2325, 2326, 2327,
+  2328, 2329, 2330, 2331, 2332, 2333, 2334, 2335, 2336, 2337, 2338, 2339, 2340, 2341, 2342, 2343,
+  2344, 2346, 2347, 2348, 2349, 2350, 2351, 2352, 2354, 2355, 2357, 2358, 2359, 2360, 2361, 2365,
+  2384,
+};
+const uint32_t ALPHA_197_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_197_FREQ[] = {
+  { "ॐ", 0.00000000 },
+  { "अ", 0.01480000 },
+  { "आ", 0.01910000 },
+  { "इ", 0.00620000 },
+  { "ई", 0.00210000 },
+  { "उ", 0.00450000 },
+  { "ऊ", 0.00100000 },
+  { "ऋ", 0.00010000 },
+  { "ऌ", 0.00000000 },
+  { "ए", 0.00580000 },
+  { "ऐ", 0.00020000 },
+  { "ऑ", 0.00090000 },
+  { "ओ", 0.00090000 },
+  { "औ", 0.00040000 },
+  { "क", 0.06060000 },
+  { "ख", 0.00810000 },
+  { "ग", 0.02200000 },
+  { "घ", 0.00420000 },
+  { "ङ", 0.00010000 },
+  { "च", 0.03730000 },
+  { "छ", 0.00070000 },
+  { "ज", 0.02300000 },
+  { "झ", 0.00350000 },
+  { "ञ", 0.00080000 },
+  { "ट", 0.01560000 },
+  { "ठ", 0.00590000 },
+  { "ड", 0.01300000 },
+  { "ढ", 0.00220000 },
+  { "ण", 0.02310000 },
+  { "त", 0.08470000 },
+  { "थ", 0.00750000 },
+  { "द", 0.02660000 },
+  { "ध", 0.01380000 },
+  { "न", 0.05530000 },
+  { "प", 0.03830000 },
+  { "फ", 0.00420000 },
+  { "ब", 0.01500000 },
+  { "भ", 0.01120000 },
+  { "म", 0.04420000 },
+  { "य", 0.07100000 },
+  { "र", 0.09990000 },
+  { "ल", 0.05780000 },
+  { "व", 0.05120000 },
+  { "श", 0.01860000 },
+  { "ष", 0.01140000 },
+  { "स", 0.05660000 },
+  { "ह", 0.04590000 },
+  { "ळ", 0.01050000 },
+  { "ऽ", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_197_FREQ_CPS[] = {
+  { 0x905u, 0.01480000 },
+  { 0x906u, 0.01910000 },
+  { 0x907u, 0.00620000 },
+  { 0x908u, 0.00210000 },
+  { 0x909u, 0.00450000 },
+  { 0x90Au, 0.00100000 },
+  { 0x90Bu, 0.00010000 },
+  { 0x90Cu, 0.00000000 },
+  { 0x90Fu, 0.00580000 },
+  { 0x910u, 0.00020000 },
+  { 0x911u, 0.00090000 },
+  { 0x913u, 0.00090000 },
+  { 0x914u, 0.00040000 },
+  { 0x915u, 0.06060000 },
+  { 0x916u, 0.00810000 },
+  { 0x917u, 0.02200000 },
+  { 0x918u, 0.00420000 },
+  { 0x919u, 0.00010000 },
+  { 0x91Au, 0.03730000 },
+  { 0x91Bu, 0.00070000 },
+  { 0x91Cu, 0.02300000 },
+  { 0x91Du, 0.00350000 },
+  { 0x91Eu, 0.00080000 },
+  { 0x91Fu, 0.01560000 },
+  { 0x920u, 0.00590000 },
+  { 0x921u, 0.01300000 },
+  { 0x922u, 0.00220000 },
+  { 0x923u, 0.02310000 },
+  { 0x924u, 0.08470000 },
+  { 0x925u, 0.00750000 },
+  { 0x926u, 0.02660000 },
+  { 0x927u, 0.01380000 },
+  { 0x928u, 0.05530000 },
+  { 0x92Au, 0.03830000 },
+  { 0x92Bu, 0.00420000 },
+  { 0x92Cu, 0.01500000 },
+  { 0x92Du, 0.01120000 },
+  { 0x92Eu, 0.04420000 },
+  { 0x92Fu, 0.07100000 },
+  { 0x930u, 0.09990000 },
+  { 0x932u, 0.05780000 },
+  { 0x933u, 0.01050000 },
+  { 0x935u, 0.05120000 },
+  { 0x936u, 0.01860000 },
+  { 0x937u, 0.01140000 },
+  { 0x938u, 0.05660000 },
+  { 0x939u, 0.04590000 },
+  { 0x93Du, 0.00000000 },
+  { 0x950u, 0.00000000 },
+};
+
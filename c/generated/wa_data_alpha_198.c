@@ -0,0 +1,129 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_198_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+};
+const char *ALPHA_198_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+};
+const char *ALPHA_198_DIGITS[] = {
+};
+const uint32_t ALPHA_198_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90,
+};
+const uint32_t ALPHA_198_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122,
+};
+const uint32_t ALPHA_198_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_198_FREQ[] = {
+  { "a", 0.08420000 },
+  { "b", 0.01440000 },
+  { "c", 0.03320000 },
+  { "d", 0.03790000 },
+  { "e", 0.11800000 },
+  { "f", 0.02230000 },
+  { "g", 0.01890000 },
+  { "h", 0.04610000 },
+  { "i", 0.07310000 },
+  { "j", 0.00180000 },
+  { "k", 0.00580000 },
+  { "l", 0.04110000 },
+  { "m", 0.02570000 },
+  { "n", 0.07120000 },
+  { "o", 0.07160000 },
+  { "p", 0.02060000 },
+  { "q", 0.00110000 },
+  { "r", 0.06430000 },
+  { "s", 0.06440000 },
+  { "t", 0.08350000 },
+  { "u", 0.02610000 },
+  { "v", 0.01030000 },
+  { "w", 0.01620000 },
+  { "x", 0.00200000 },
+  { "y", 0.01510000 },
+  { "z", 0.00130000 },
+};
+
+const wa_cp_freq ALPHA_198_FREQ_CPS[] = {
+  { 0x61u, 0.08420000 },
+  { 0x62u, 0.01440000 },
+  { 0x63u, 0.03320000 },
+  { 0x64u, 0.03790000 },
+  { 0x65u, 0.11800000 },
+  { 0x66u, 0.02230000 },
+  { 0x67u, 0.01890000 },
+  { 0x68u, 0.04610000 },
+  { 0x69u, 0.07310000 },
+  { 0x6Au, 0.00180000 },
+  { 0x6Bu, 0.00580000 },
+  { 0x6Cu, 0.04110000 },
+  { 0x6Du, 0.02570000 },
+  { 0x6Eu, 0.07120000 },
+  { 0x6Fu, 0.07160000 },
+  { 0x70u, 0.02060000 },
+  { 0x71u, 0.00110000 },
+  { 0x72u, 0.06430000 },
+  { 0x73u, 0.06440000 },
+  { 0x74u, 0.08350000 },
+  { 0x75u, 0.02610000 },
+  { 0x76u, 0.01030000 },
+  { 0x77u, 0.01620000 },
+  { 0x78u, 0.00200000 },
+  { 0x79u, 0.01510000 },
+  { 0x7Au, 0.00130000 },
+};
+
@@ -0,0 +1,169 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_2_UPPER[] = {
+  "А",
+  "Б",
+  "В",
+  "Г",
+  "Д",
+  "Е",
+  "Ж",
+  "З",
+  "И",
+  "Й",
+  "К",
+  "Л",
+  "М",
+  "Н",
+  "О",
+  "П",
+  "Р",
+  "С",
+  "Т",
+  "У",
+  "Ф",
+  "Х",
+  "Ц",
+  "Ч",
+  "Ш",
+  "Щ",
+  "Ъ",
+  "Ы",
+  "Ь",
+  "Э",
+  "Ю",
+  "Я",
+  "Ӏ",
+};
+const char *ALPHA_2_LOWER[] = {
+  "а",
+  "б",
+  "в",
+  "г",
+  "д",
+  "е",
+  "ж",
+  "з",
+  "и",
+  "й",
+  "к",
+  "л",
+  "м",
+  "н",
+  "о",
+  "п",
+  "р",
+  "с",
+  "т",
+  "у",
+  "ф",
+  "х",
+  "ц",
+  "ч",
+  "ш",
+  "щ",
+  "ъ",
+  "ы",
+  "ь",
+  "э",
+  "ю",
+  "я",
+  "ӏ",
+};
+const char *ALPHA_2_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_2_UPPER_CPS[] = {
+  1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053, 1054, 1055,
+  1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069, 1070, 1071,
+  1216,
+};
+const uint32_t ALPHA_2_LOWER_CPS[] = {
+  1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080, 1081, 1082, 1083, 1084, 1085, 1086, 1087,
+  1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103,
+  1231,
+};
+const uint32_t ALPHA_2_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_2_FREQ[] = {
+  { "с", 0.02950000 },
+  { "э", 0.14210000 },
+  { "а", 0.05860000 },
+  { "щ", 0.01350000 },
+  { "т", 0.03180000 },
+  { "р", 0.04580000 },
+  { "ы", 0.07350000 },
+  { "д", 0.02300000 },
+  { "о", 0.02680000 },
+  { "к", 0.04260000 },
+  { "ӏ", 0.04930000 },
+  { "и", 0.02830000 },
+  { "м", 0.04650000 },
+  { "г", 0.03180000 },
+  { "х", 0.04760000 },
+  { "н", 0.02420000 },
+  { "е", 0.01790000 },
+  { "п", 0.02090000 },
+  { "з", 0.01280000 },
+  { "у", 0.04740000 },
+  { "ь", 0.01720000 },
+  { "ф", 0.01230000 },
+  { "ъ", 0.06510000 },
+  { "ж", 0.01750000 },
+  { "л", 0.02160000 },
+  { "ш", 0.01880000 },
+  { "я", 0.00370000 },
+  { "ч", 0.00720000 },
+  { "б", 0.01510000 },
+  { "ц", 0.00470000 },
+  { "й", 0.00190000 },
+  { "в", 0.00090000 },
+  { "ю", 0.00020000 },
+};
+
+const wa_cp_freq ALPHA_2_FREQ_CPS[] = {
+  { 0x430u, 0.05860000 },
+  { 0x431u, 0.01510000 },
+  { 0x432u, 0.00090000 },
+  { 0x433u, 0.03180000 },
+  { 0x434u, 0.02300000 },
+  { 0x435u, 0.01790000 },
+  { 0x436u, 0.01750000 },
+  { 0x437u, 0.01280000 },
+  { 0x438u, 0.02830000 },
+  { 0x439u, 0.00190000 },
+  { 0x43Au, 0.04260000 },
+  { 0x43Bu, 0.02160000 },
+  { 0x43Cu, 0.04650000 },
+  { 0x43Du, 0.02420000 },
+  { 0x43Eu, 0.02680000 },
+  { 0x43Fu, 0.02090000 },
+  { 0x440u, 0.04580000 },
+  { 0x441u, 0.02950000 },
+  { 0x442u, 0.03180000 },
+  { 0x443u, 0.04740000 },
+  { 0x444u, 0.01230000 },
+  { 0x445u, 0.04760000 },
+  { 0x446u, 0.00470000 },
+  { 0x447u, 0.00720000 },
+  { 0x448u, 0.01880000 },
+  { 0x449u, 0.01350000 },
+  { 0x44Au, 0.06510000 },
+  { 0x44Bu, 0.07350000 },
+  { 0x44Cu, 0.01720000 },
+  { 0x44Du, 0.14210000 },
+  { 0x44Eu, 0.00020000 },
+  { 0x44Fu, 0.00370000 },
+  { 0x4CFu, 0.04930000 },
+};
+
@@ -0,0 +1,135 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_200_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "W",
+  "Y",
+  "Z",
+};
+const char *ALPHA_200_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "w",
+  "y",
+  "z",
+};
+const char *ALPHA_200_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_200_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 89, 90,
+};
+const uint32_t ALPHA_200_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 121, 122,
+};
+const uint32_t ALPHA_200_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_200_FREQ[] = {
+  { "u", 0.05300000 },
+  { "m", 0.05260000 },
+  { "y", 0.01180000 },
+  { "a", 0.20280000 },
+  { "n", 0.09700000 },
+  { "g", 0.03800000 },
+  { "s", 0.04170000 },
+  { "k", 0.05030000 },
+  { "i", 0.07570000 },
+  { "t", 0.04610000 },
+  { "d", 0.02540000 },
+  { "l", 0.03460000 },
+  { "h", 0.02490000 },
+  { "j", 0.01330000 },
+  { "e", 0.08250000 },
+  { "o", 0.01440000 },
+  { "r", 0.04960000 },
+  { "b", 0.03510000 },
+  { "p", 0.03280000 },
+  { "c", 0.00890000 },
+  { "f", 0.00210000 },
+  { "z", 0.00060000 },
+  { "w", 0.00550000 },
+  { "v", 0.00110000 },
+  { "q", 0.00020000 },
+};
+
+const wa_cp_freq ALPHA_200_FREQ_CPS[] = {
+  { 0x61u, 0.20280000 },
+  { 0x62u, 0.03510000 },
+  { 0x63u, 0.00890000 },
+  { 0x64u, 0.02540000 },
+  { 0x65u, 0.08250000 },
+  { 0x66u, 0.00210000 },
+  { 0x67u, 0.03800000 },
+  { 0x68u, 0.02490000 },
+  { 0x69u, 0.07570000 },
+  { 0x6Au, 0.01330000 },
+  { 0x6Bu, 0.05030000 },
+  { 0x6Cu, 0.03460000 },
+  { 0x6Du, 0.05260000 },
+  { 0x6Eu, 0.09700000 },
+  { 0x6Fu, 0.01440000 },
+  { 0x70u, 0.03280000 },
+  { 0x71u, 0.00020000 },
+  { 0x72u, 0.04960000 },
+  { 0x73u, 0.04170000 },
+  { 0x74u, 0.04610000 },
+  { 0x75u, 0.05300000 },
+  { 0x76u, 0.00110000 },
+  { 0x77u, 0.00550000 },
+  { 0x79u, 0.01180000 },
+  { 0x7Au, 0.00060000 },
+};
+
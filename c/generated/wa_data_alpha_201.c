@@ -0,0 +1,159 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_201_UPPER[] = {
+  "A",
+  "B",
+  "Ċ",
+  "D",
+  "F",
+  "Ġ",
+  "G",
+  "H",
+  "Ħ",
+  "I",
+  "E",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "W",
+  "X",
+  "À",
+  "È",
+  "Ì",
+  "Ò",
+  "Ù",
+  "Ż",
+  "Z",
+};
+const char *ALPHA_201_LOWER[] = {
+  "a",
+  "b",
+  "ċ",
+  "d",
+  "f",
+  "ġ",
+  "g",
+  "h",
+  "ħ",
+  "i",
+  "e",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "w",
+  "x",
+  "à",
+  "è",
+  "ì",
+  "ò",
+  "ù",
+  "ż",
+  "z",
+};
+const char *ALPHA_201_DIGITS[] = {
+};
+const uint32_t ALPHA_201_UPPER_CPS[] = {
+  65, 66, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81,
+  82, 83, 84, 85, 86, 87, 88, 90, 192, 200, 204, 210, 217, 266, 288, 294,
+  379,
+};
+const uint32_t ALPHA_201_LOWER_CPS[] = {
+  97, 98, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113,
+  114, 115, 116, 117, 118, 119, 120, 122, 224, 232, 236, 242, 249, 267, 289, 295,
+  380,
+};
+const uint32_t ALPHA_201_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_201_FREQ[] = {
+  { "a", 0.12400000 },
+  { "b", 0.02150000 },
+  { "ċ", 0.00580000 },
+  { "d", 0.02630000 },
+  { "f", 0.02380000 },
+  { "ġ", 0.00780000 },
+  { "g", 0.01730000 },
+  { "h", 0.01230000 },
+  { "ħ", 0.02040000 },
+  { "i", 0.11890000 },
+  { "e", 0.07050000 },
+  { "j", 0.02980000 },
+  { "k", 0.02810000 },
+  { "l", 0.07940000 },
+  { "m", 0.03920000 },
+  { "n", 0.05730000 },
+  { "o", 0.03680000 },
+  { "p", 0.01840000 },
+  { "q", 0.00690000 },
+  { "r", 0.05260000 },
+  { "s", 0.03880000 },
+  { "t", 0.07530000 },
+  { "u", 0.04220000 },
+  { "v", 0.00620000 },
+  { "w", 0.01440000 },
+  { "x", 0.00710000 },
+  { "à", 0.00080000 },
+  { "è", 0.00010000 },
+  { "ì", 0.00000000 },
+  { "ò", 0.00010000 },
+  { "ù", 0.00010000 },
+  { "ż", 0.00750000 },
+  { "z", 0.01010000 },
+};
+
+const wa_cp_freq ALPHA_201_FREQ_CPS[] = {
+  { 0x61u, 0.12400000 },
+  { 0x62u, 0.02150000 },
+  { 0x64u, 0.02630000 },
+  { 0x65u, 0.07050000 },
+  { 0x66u, 0.02380000 },
+  { 0x67u, 0.01730000 },
+  { 0x68u, 0.01230000 },
+  { 0x69u, 0.11890000 },
+  { 0x6Au, 0.02980000 },
+  { 0x6Bu, 0.02810000 },
+  { 0x6Cu, 0.07940000 },
+  { 0x6Du, 0.03920000 },
+  { 0x6Eu, 0.05730000 },
+  { 0x6Fu, 0.03680000 },
+  { 0x70u, 0.01840000 },
+  { 0x71u, 0.00690000 },
+  { 0x72u, 0.05260000 },
+  { 0x73u, 0.03880000 },
+  { 0x74u, 0.07530000 },
+  { 0x75u, 0.04220000 },
+  { 0x76u, 0.00620000 },
+  { 0x77u, 0.01440000 },
+  { 0x78u, 0.00710000 },
+  { 0x7Au, 0.01010000 },
+  { 0xE0u, 0.00080000 },
+  { 0xE8u, 0.00010000 },
+  { 0xECu, 0.00000000 },
+  { 0xF2u, 0.00010000 },
+  { 0xF9u, 0.00010000 },
+  { 0x10Bu, 0.00580000 },
+  { 0x121u, 0.00780000 },
+  { 0x127u, 0.02040000 },
+  { 0x17Cu, 0.00750000 },
+};
+
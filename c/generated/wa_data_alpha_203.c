@@ -0,0 +1,119 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_203_UPPER[] = {
+  "A",
+  "C",
+  "E",
+  "Ē",
+  "F",
+  "H",
+  "I",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "W",
+  "Y",
+  "ʼ",
+};
+const char *ALPHA_203_LOWER[] = {
+  "a",
+  "c",
+  "e",
+  "ē",
+  "f",
+  "h",
+  "i",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "w",
+  "y",
+  "ʼ",
+};
+const char *ALPHA_203_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_203_UPPER_CPS[] = {
+  65, 67, 69, 70, 72, 73, 75, 76, 77, 78, 79, 80, 82, 83, 84, 85,
+  86, 87, 89, 274, 700,
+};
+const uint32_t ALPHA_203_LOWER_CPS[] = {
+  97, 99, 101, 102, 104, 105, 107, 108, 109, 110, 111, 112, 114, 115, 116, 117,
+  118, 119, 121, 275, 700,
+};
+const uint32_t ALPHA_203_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_203_FREQ[] = {
+  { "a", 0.00000000 },
+  { "c", 0.00000000 },
+  { "e", 0.00000000 },
+  { "ē", 0.00000000 },
+  { "f", 0.00000000 },
+  { "h", 0.00000000 },
+  { "i", 0.00000000 },
+  { "k", 0.00000000 },
+  { "l", 0.00000000 },
+  { "m", 0.00000000 },
+  { "n", 0.00000000 },
+  { "o", 0.00000000 },
+  { "p", 0.00000000 },
+  { "r", 0.00000000 },
+  { "s", 0.00000000 },
+  { "t", 0.00000000 },
+  { "u", 0.00000000 },
+  { "v", 0.00000000 },
+  { "w", 0.00000000 },
+  { "y", 0.00000000 },
+  { "ʼ", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_203_FREQ_CPS[] = {
+  { 0x61u, 0.00000000 },
+  { 0x63u, 0.00000000 },
+  { 0x65u, 0.00000000 },
+  { 0x66u, 0.00000000 },
+  { 0x68u, 0.00000000 },
+  { 0x69u, 0.00000000 },
+  { 0x6Bu, 0.00000000 },
+  { 0x6Cu, 0.00000000 },
+  { 0x6Du, 0.00000000 },
+  { 0x6Eu, 0.00000000 },
+  { 0x6Fu, 0.00000000 },
+  { 0x70u, 0.00000000 },
+  { 0x72u, 0.00000000 },
+  { 0x73u, 0.00000000 },
+  { 0x74u, 0.00000000 },
+  { 0x75u, 0.00000000 },
+  { 0x76u, 0.00000000 },
+  { 0x77u, 0.00000000 },
+  { 0x79u, 0.00000000 },
+  { 0x113u, 0.00000000 },
+  { 0x2BCu, 0.00000000 },
+};
+
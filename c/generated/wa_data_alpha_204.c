@@ -0,0 +1,195 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_204_UPPER[] = {
+  "က",
+  "ခ",
+  "ဂ",
+  "ဃ",
+  "င",
+  "စ",
+  "ဆ",
+  "ဇ",
+  "ဈ",
+  "ဉ",
+  "ည",
+  "ဋ",
+  "ဌ",
+  "ဍ",
+  "ဎ",
+  "ဏ",
+  "တ",
+  "ထ",
+  "ဒ",
+  "ဓ",
+  "န",
+  "ပ",
+  "ဖ",
+  "ဗ",
+  "ဘ",
+  "မ",
+  "ယ",
+  "ရ",
+  "လ",
+  "ဝ",
+  "သ",
+  "ဟ",
+  "ဠ",
+  "အ",
+  "ဣ",
+  "ဤ",
+  "ဥ",
+  "ဦ",
+  "ဧ",
+  "ဩ",
+  "ဪ",
+  "ဿ",
+};
+const char *ALPHA_204_LOWER[] = {
+  "က",
+  "ခ",
+  "ဂ",
+  "ဃ",
+  "င",
+  "စ",
+  "ဆ",
+  "ဇ",
+  "ဈ",
+  "ဉ",
+  "ည",
+  "ဋ",
+  "ဌ",
+  "ဍ",
+  "ဎ",
+  "ဏ",
+  "တ",
+  "ထ",
+  "ဒ",
+  "ဓ",
+  "န",
+  "ပ",
+  "ဖ",
+  "ဗ",
+  "ဘ",
+  "မ",
+  "ယ",
+  "ရ",
+  "လ",
+  "ဝ",
+  "သ",
+  "ဟ",
+  "ဠ",
+  "အ",
+  "ဣ",
+  "ဤ",
+  "ဥ",
+  "ဦ",
+  "ဧ",
+  "ဩ",
+  "ဪ",
+  "ဿ",
+};
+const char *ALPHA_204_DIGITS[] = {
+};
+const uint32_t ALPHA_204_UPPER_CPS[] = {
+  4096, 4097, 4098, 4099, 4100, 4101, 4102, 4103, 4104, 4105, 4106, 4107, 4108, 4109, 4110, 4111,
+  4112, 4113, 4114, 4115, 4116, 4117, 4118, 4119, 4120, 4121, 4122, 4123, 4124, 4125, 4126, 4127,
+  4128, 4129, 4131, 4132, 4133, 4134, 4135, 4137, 4138, 4159,
+};
+const uint32_t ALPHA_204_LOWER_CPS[] = {
+  4096, 4097, 4098, 4099, 4100, 4101, 4102, 4103, 4104, 4105, 4106, 4107, 4108, 4109, 4110, 4111,
+  4112, 4113, 4114, 4115, 4116, 4117, 4118, 4119, 4120, 4121, 4122, 4123, 4124, 4125, 4126, 4127,
+  4128, 4129, 4131, 4132, 4133, 4134, 4135, 4137, 4138, 4159,
+};
+const uint32_t ALPHA_204_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_204_FREQ[] = {
+  { "က", 0.09900000 },
+  { "ခ", 0.04020000 },
+  { "ဂ", 0.00680000 },
+  { "ဃ", 0.00010000 },
+  { "င", 0.09760000 },
+  { "စ", 0.05420000 },
+  { "ဆ", 0.01790000 },
+  { "ဇ", 0.00330000 },
+  { "ဈ", 0.00020000 },
+  { "ဉ", 0.00230000 },
+  { "ည", 0.04790000 },
+  { "ဋ", 0.00050000 },
+  { "ဌ", 0.00090000 },
+  { "ဍ", 0.00020000 },
+  { "ဎ", 0.00000000 },
+  { "ဏ", 0.00210000 },
+  { "တ", 0.07350000 },
+  { "ထ", 0.01910000 },
+  { "ဒ", 0.00810000 },
+  { "ဓ", 0.00220000 },
+  { "န", 0.06820000 },
+  { "ပ", 0.06450000 },
+  { "ဖ", 0.02220000 },
+  { "ဗ", 0.00390000 },
+  { "ဘ", 0.00910000 },
+  { "မ", 0.07960000 },
+  { "ယ", 0.01900000 },
+  { "ရ", 0.06020000 },
+  { "လ", 0.04480000 },
+  { "ဝ", 0.01190000 },
+  { "သ", 0.07660000 },
+  { "ဟ", 0.00670000 },
+  { "ဠ", 0.00020000 },
+  { "အ", 0.05160000 },
+  { "ဣ", 0.00000000 },
+  { "ဤ", 0.00060000 },
+  { "ဥ", 0.00140000 },
+  { "ဦ", 0.00270000 },
+  { "ဧ", 0.00040000 },
+  { "ဩ", 0.00030000 },
+  { "ဪ", 0.00000000 },
+  { "ဿ", 0.00030000 },
+};
+
+const wa_cp_freq ALPHA_204_FREQ_CPS[] = {
+  { 0x1000u, 0.09900000 },
+  { 0x1001u, 0.04020000 },
+  { 0x1002u, 0.00680000 },
+  { 0x1003u, 0.00010000 },
+  { 0x1004u, 0.09760000 },
+  { 0x1005u, 0.05420000 },
+  { 0x1006u, 0.01790000 },
+  { 0x1007u, 0.00330000 },
+  { 0x1008u, 0.00020000 },
+  { 0x1009u, 0.00230000 },
+  { 0x100Au, 0.04790000 },
+  { 0x100Bu, 0.00050000 },
+  { 0x100Cu, 0.00090000 },
+  { 0x100Du, 0.00020000 },
+  { 0x100Eu, 0.00000000 },
+  { 0x100Fu, 0.00210000 },
+  { 0x1010u, 0.07350000 },
+  { 0x1011u, 0.01910000 },
+  { 0x1012u, 0.00810000 },
+  { 0x1013u, 0.00220000 },
+  { 0x1014u, 0.06820000 },
+  { 0x1015u, 0.06450000 },
+  { 0x1016u, 0.02220000 },
+  { 0x1017u, 0.00390000 },
+  { 0x1018u, 0.00910000 },
+  { 0x1019u, 0.07960000 },
+  { 0x101Au, 0.01900000 },
+  { 0x101Bu, 0.06020000 },
+  { 0x101Cu, 0.04480000 },
+  { 0x101Du, 0.01190000 },
+  { 0x101Eu, 0.07660000 },
+  { 0x101Fu, 0.00670000 },
+  { 0x1020u, 0.00020000 },
+  { 0x1021u, 0.05160000 },
+  { 0x1023u, 0.00000000 },
+  { 0x1024u, 0.00060000 },
+  { 0x1025u, 0.00140000 },
+  { 0x1026u, 0.00270000 },
+  { 0x1027u, 0.00040000 },
+  { 0x1029u, 0.00030000 },
+  { 0x102Au, 0.00000000 },
+  { 0x103Fu, 0.00030000 },
+};
+
@@ -0,0 +1,169 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_205_UPPER[] = {
+  "А",
+  "Б",
+  "В",
+  "Г",
+  "Д",
+  "Е",
+  "Ё",
+  "Ж",
+  "З",
+  "И",
+  "Й",
+  "К",
+  "Л",
+  "М",
+  "Н",
+  "О",
+  "П",
+  "Р",
+  "С",
+  "Т",
+  "У",
+  "Ф",
+  "Х",
+  "Ц",
+  "Ч",
+  "Ш",
+  "Щ",
+  "Ъ",
+  "Ы",
+  "Ь",
+  "Э",
+  "Ю",
+  "Я",
+};
+const char *ALPHA_205_LOWER[] = {
+  "а",
+  "б",
+  "в",
+  "г",
+  "д",
+  "е",
+  "ё",
+  "ж",
+  "з",
+  "и",
+  "й",
+  "к",
+  "л",
+  "м",
+  "н",
+  "о",
+  "п",
+  "р",
+  "с",
+  "т",
+  "у",
+  "ф",
+  "х",
+  "ц",
+  "ч",
+  "ш",
+  "щ",
+  "ъ",
+  "ы",
+  "ь",
+  "э",
+  "ю",
+  "я",
+};
+const char *ALPHA_205_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_205_UPPER_CPS[] = {
+  1025, 1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053, 1054,
+  1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069, 1070,
+  1071,
+};
+const uint32_t ALPHA_205_LOWER_CPS[] = {
+  1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080, 1081, 1082, 1083, 1084, 1085, 1086, 1087,
+  1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103,
+  1105,
+};
+const uint32_t ALPHA_205_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_205_FREQ[] = {
+  { "а", 0.07310000 },
+  { "б", 0.00490000 },
+  { "в", 0.04290000 },
+  { "г", 0.01250000 },
+  { "д", 0.02280000 },
+  { "е", 0.08470000 },
+  { "ё", 0.00350000 },
+  { "ж", 0.00780000 },
+  { "з", 0.01790000 },
+  { "и", 0.05510000 },
+  { "й", 0.00870000 },
+  { "к", 0.05890000 },
+  { "л", 0.02930000 },
+  { "м", 0.03260000 },
+  { "н", 0.07730000 },
+  { "о", 0.09440000 },
+  { "п", 0.01750000 },
+  { "р", 0.04120000 },
+  { "с", 0.06320000 },
+  { "т", 0.07280000 },
+  { "у", 0.01640000 },
+  { "ф", 0.00090000 },
+  { "х", 0.00120000 },
+  { "ц", 0.00760000 },
+  { "ч", 0.01500000 },
+  { "ш", 0.01250000 },
+  { "щ", 0.00020000 },
+  { "ъ", 0.00000000 },
+  { "ы", 0.00870000 },
+  { "ь", 0.07070000 },
+  { "э", 0.01510000 },
+  { "ю", 0.00260000 },
+  { "я", 0.02810000 },
+};
+
+const wa_cp_freq ALPHA_205_FREQ_CPS[] = {
+  { 0x430u, 0.07310000 },
+  { 0x431u, 0.00490000 },
+  { 0x432u, 0.04290000 },
+  { 0x433u, 0.01250000 },
+  { 0x434u, 0.02280000 },
+  { 0x435u, 0.08470000 },
+  { 0x436u, 0.00780000 },
+  { 0x437u, 0.01790000 },
+  { 0x438u, 0.05510000 },
+  { 0x439u, 0.00870000 },
+  { 0x43Au, 0.05890000 },
+  { 0x43Bu, 0.02930000 },
+  { 0x43Cu, 0.03260000 },
+  { 0x43Du, 0.07730000 },
+  { 0x43Eu, 0.09440000 },
+  { 0x43Fu, 0.01750000 },
+  { 0x440u, 0.04120000 },
+  { 0x441u, 0.06320000 },
+  { 0x442u, 0.07280000 },
+  { 0x443u, 0.01640000 },
+  { 0x444u, 0.00090000 },
+  { 0x445u, 0.00120000 },
+  { 0x446u, 0.00760000 },
+  { 0x447u, 0.01500000 },
+  { 0x448u, 0.01250000 },
+  { 0x449u, 0.00020000 },
+  { 0x44Au, 0.00000000 },
+  { 0x44Bu, 0.00870000 },
+  { 0x44Cu, 0.07070000 },
+  { 0x44Du, 0.01510000 },
+  { 0x44Eu, 0.00260000 },
+  { 0x44Fu, 0.02810000 },
+  { 0x451u, 0.00350000 },
+};
+
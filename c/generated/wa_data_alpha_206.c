@@ -0,0 +1,189 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_206_UPPER[] = {
+  "ء",
+  "آ",
+  "أ",
+  "ؤ",
+  "ئ",
+  "ا",
+  "ب",
+  "پ",
+  "ة",
+  "ت",
+  "ث",
+  "ج",
+  "چ",
+  "ح",
+  "خ",
+  "د",
+  "ذ",
+  "ر",
+  "ز",
+  "ژ",
+  "س",
+  "ش",
+  "ص",
+  "ض",
+  "ط",
+  "ظ",
+  "ع",
+  "غ",
+  "ف",
+  "ق",
+  "ک",
+  "گ",
+  "ل",
+  "م",
+  "ن",
+  "ه",
+  "و",
+  "ی",
+};
+const char *ALPHA_206_LOWER[] = {
+  "ء",
+  "آ",
+  "أ",
+  "ؤ",
+  "ئ",
+  "ا",
+  "ب",
+  "پ",
+  "ة",
+  "ت",
+  "ث",
+  "ج",
+  "چ",
+  "ح",
+  "خ",
+  "د",
+  "ذ",
+  "ر",
+  "ز",
+  "ژ",
+  "س",
+  "ش",
+  "ص",
+  "ض",
+  "ط",
+  "ظ",
+  "ع",
+  "غ",
+  "ف",
+  "ق",
+  "ک",
+  "گ",
+  "ل",
+  "م",
+  "ن",
+  "ه",
+  "و",
+  "ی",
+};
+const char *ALPHA_206_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_206_UPPER_CPS[] = {
+  1569, 1570, 1571, 1572, 1574, 1575, 1576, 1577, 1578, 1579, 1580, 1581, 1582, 1583, 1584, 1585,
+  1586, 1587, 1588, 1589, 1590, 1591, 1592, 1593, 1594, 1601, 1602, 1604, 1605, 1606, 1607, 1608,
+  1662, 1670, 1688, 1705, 1711, 1740,
+};
+const uint32_t ALPHA_206_LOWER_CPS[] = {
+  1569, 1570, 1571, 1572, 1574, 1575, 1576, 1577, 1578, 1579, 1580, 1581, 1582, 1583, 1584, 1585,
+  1586, 1587, 1588, 1589, 1590, 1591, 1592, 1593, 1594, 1601, 1602, 1604, 1605, 1606, 1607, 1608,
+  1662, 1670, 1688, 1705, 1711, 1740,
+};
+const uint32_t ALPHA_206_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_206_FREQ[] = {
+  { "ء", 0.00040000 },
+  { "آ", 0.00460000 },
+  { "أ", 0.00060000 },
+  { "ؤ", 0.00010000 },
+  { "ئ", 0.00710000 },
+  { "ا", 0.12830000 },
+  { "ب", 0.03360000 },
+  { "پ", 0.00690000 },
+  { "ة", 0.00010000 },
+  { "ت", 0.05380000 },
+  { "ث", 0.00080000 },
+  { "ج", 0.01230000 },
+  { "چ", 0.00240000 },
+  { "ح", 0.00430000 },
+  { "خ", 0.00780000 },
+  { "د", 0.04650000 },
+  { "ذ", 0.00060000 },
+  { "ر", 0.08840000 },
+  { "ز", 0.01430000 },
+  { "ژ", 0.00080000 },
+  { "س", 0.04650000 },
+  { "ش", 0.02740000 },
+  { "ص", 0.00250000 },
+  { "ض", 0.00100000 },
+  { "ط", 0.00240000 },
+  { "ظ", 0.00070000 },
+  { "ع", 0.01070000 },
+  { "غ", 0.00170000 },
+  { "ف", 0.01110000 },
+  { "ق", 0.00940000 },
+  { "ک", 0.02570000 },
+  { "گ", 0.01100000 },
+  { "ل", 0.03480000 },
+  { "م", 0.04170000 },
+  { "ن", 0.08270000 },
+  { "ه", 0.10480000 },
+  { "و", 0.08190000 },
+  { "ی", 0.09040000 },
+};
+
+const wa_cp_freq ALPHA_206_FREQ_CPS[] = {
+  { 0x621u, 0.00040000 },
+  { 0x622u, 0.00460000 },
+  { 0x623u, 0.00060000 },
+  { 0x624u, 0.00010000 },
+  { 0x626u, 0.00710000 },
+  { 0x627u, 0.12830000 },
+  { 0x628u, 0.03360000 },
+  { 0x629u, 0.00010000 },
+  { 0x62Au, 0.05380000 },
+  { 0x62Bu, 0.00080000 },
+  { 0x62Cu, 0.01230000 },
+  { 0x62Du, 0.00430000 },
+  { 0x62Eu, 0.00780000 },
+  { 0x62Fu, 0.04650000 },
+  { 0x630u, 0.00060000 },
+  { 0x631u, 0.08840000 },
+  { 0x632u, 0.01430000 },
+  { 0x633u, 0.04650000 },
+  { 0x634u, 0.02740000 },
+  { 0x635u, 0.00250000 },
+  { 0x636u, 0.00100000 },
+  { 0x637u, 0.00240000 },
+  { 0x638u, 0.00070000 },
+  { 0x639u, 0.01070000 },
+  { 0x63Au, 0.00170000 },
+  { 0x641u, 0.01110000 },
+  { 0x642u, 0.00940000 },
+  { 0x644u, 0.03480000 },
+  { 0x645u, 0.04170000 },
+  { 0x646u, 0.08270000 },
+  { 0x647u, 0.10480000 },
+  { 0x648u, 0.08190000 },
+  { 0x67Eu, 0.00690000 },
+  { 0x686u, 0.00240000 },
+  { 0x698u, 0.00080000 },
+  { 0x6A9u, 0.02570000 },
+  { 0x6AFu, 0.01100000 },
+  { 0x6CCu, 0.09040000 },
+};
+
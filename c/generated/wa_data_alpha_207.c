@@ -0,0 +1,159 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_207_UPPER[] = {
+  "A",
+  "Â",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "Î",
+  "K",
+  "M",
+  "N",
+  "O",
+  "Ô",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "Û",
+  "W",
+  "X",
+  "Y",
+  "Z",
+  "ǀ",
+  "ǁ",
+  "ǂ",
+  "ǃ",
+};
+const char *ALPHA_207_LOWER[] = {
+  "a",
+  "â",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "î",
+  "k",
+  "m",
+  "n",
+  "o",
+  "ô",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "û",
+  "w",
+  "x",
+  "y",
+  "z",
+  "ǀ",
+  "ǁ",
+  "ǂ",
+  "ǃ",
+};
+const char *ALPHA_207_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_207_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 75, 77, 78, 79, 80, 81, 82,
+  83, 84, 85, 87, 88, 89, 90, 194, 206, 212, 219, 448, 449, 450, 451,
+};
+const uint32_t ALPHA_207_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 107, 109, 110, 111, 112, 113, 114,
+  115, 116, 117, 119, 120, 121, 122, 226, 238, 244, 251, 448, 449, 450, 451,
+};
+const uint32_t ALPHA_207_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_207_FREQ[] = {
+  { "a", 0.00000000 },
+  { "â", 0.00000000 },
+  { "b", 0.00000000 },
+  { "c", 0.00000000 },
+  { "d", 0.00000000 },
+  { "e", 0.00000000 },
+  { "f", 0.00000000 },
+  { "g", 0.00000000 },
+  { "h", 0.00000000 },
+  { "i", 0.00000000 },
+  { "î", 0.00000000 },
+  { "k", 0.00000000 },
+  { "m", 0.00000000 },
+  { "n", 0.00000000 },
+  { "o", 0.00000000 },
+  { "ô", 0.00000000 },
+  { "p", 0.00000000 },
+  { "q", 0.00000000 },
+  { "r", 0.00000000 },
+  { "s", 0.00000000 },
+  { "t", 0.00000000 },
+  { "u", 0.00000000 },
+  { "û", 0.00000000 },
+  { "w", 0.00000000 },
+  { "x", 0.00000000 },
+  { "y", 0.00000000 },
+  { "z", 0.00000000 },
+  { "ǀ", 0.00000000 },
+  { "ǁ", 0.00000000 },
+  { "ǂ", 0.00000000 },
+  { "ǃ", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_207_FREQ_CPS[] = {
+  { 0x61u, 0.00000000 },
+  { 0x62u, 0.00000000 },
+  { 0x63u, 0.00000000 },
+  { 0x64u, 0.00000000 },
+  { 0x65u, 0.00000000 },
+  { 0x66u, 0.00000000 },
+  { 0x67u, 0.00000000 },
+  { 0x68u, 0.00000000 },
+  { 0x69u, 0.00000000 },
+  { 0x6Bu, 0.00000000 },
+  { 0x6Du, 0.00000000 },
+  { 0x6Eu, 0.00000000 },
+  { 0x6Fu, 0.00000000 },
+  { 0x70u, 0.00000000 },
+  { 0x71u, 0.00000000 },
+  { 0x72u, 0.00000000 },
+  { 0x73u, 0.00000000 },
+  { 0x74u, 0.00000000 },
+  { 0x75u, 0.00000000 },
+  { 0x77u, 0.00000000 },
+  { 0x78u, 0.00000000 },
+  { 0x79u, 0.00000000 },
+  { 0x7Au, 0.00000000 },
+  { 0xE2u, 0.00000000 },
+  { 0xEEu, 0.00000000 },
+  { 0xF4u, 0.00000000 },
+  { 0xFBu, 0.00000000 },
+  { 0x1C0u, 0.00000000 },
+  { 0x1C1u, 0.00000000 },
+  { 0x1C2u, 0.00000000 },
+  { 0x1C3u, 0.00000000 },
+};
+
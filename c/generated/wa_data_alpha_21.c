@@ -0,0 +1,351 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_21_UPPER[] = {
+  "ꚠ",
+  "ꚡ",
+  "ꚢ",
+  "ꚣ",
+  "ꚤ",
+  "ꚥ",
+  "ꚦ",
+  "ꚧ",
+  "ꚨ",
+  "ꚩ",
+  "ꚪ",
+  "ꚫ",
+  "ꚬ",
+  "ꚭ",
+  "ꚮ",
+  "ꚯ",
+  "ꚰ",
+  "ꚱ",
+  "ꚲ",
+  "ꚳ",
+  "ꚴ",
+  "ꚵ",
+  "ꚶ",
+  "ꚷ",
+  "ꚸ",
+  "ꚹ",
+  "ꚺ",
+  "ꚻ",
+  "ꚼ",
+  "ꚽ",
+  "ꚾ",
+  "ꚿ",
+  "ꛀ",
+  "ꛁ",
+  "ꛂ",
+  "ꛃ",
+  "ꛄ",
+  "ꛅ",
+  "ꛆ",
+  "ꛇ",
+  "ꛈ",
+  "ꛉ",
+  "ꛊ",
+  "ꛋ",
+  "ꛌ",
+  "ꛍ",
+  "ꛎ",
+  "ꛏ",
+  "ꛐ",
+  "ꛑ",
+  "ꛒ",
+  "ꛓ",
+  "ꛔ",
+  "ꛕ",
+  "ꛖ",
+  "ꛗ",
+  "ꛘ",
+  "ꛙ",
+  "ꛚ",
+  "ꛛ",
+  "ꛜ",
+  "ꛝ",
+  "ꛞ",
+  "ꛟ",
+  "ꛠ",
+  "ꛡ",
+  "ꛢ",
+  "ꛣ",
+  "ꛤ",
+  "ꛥ",
+  "ꛦ",
+  "ꛧ",
+  "ꛨ",
+  "ꛩ",
+  "ꛪ",
+  "ꛫ",
+  "ꛬ",
+  "ꛭ",
+  "ꛮ",
+  "ꛯ",
+};
+const char *ALPHA_21_LOWER[] = {
+  "ꚠ",
+  "ꚡ",
+  "ꚢ",
+  "ꚣ",
+  "ꚤ",
+  "ꚥ",
+  "ꚦ",
+  "ꚧ",
+  "ꚨ",
+  "ꚩ",
+  "ꚪ",
+  "ꚫ",
+  "ꚬ",
+  "ꚭ",
+  "ꚮ",
+  "ꚯ",
+  "ꚰ",
+  "ꚱ",
+  "ꚲ",
+  "ꚳ",
+  "ꚴ",
+  "ꚵ",
+  "ꚶ",
+  "ꚷ",
+  "ꚸ",
+  "ꚹ",
+  "ꚺ",
+  "ꚻ",
+  "ꚼ",
+  "ꚽ",
+  "ꚾ",
+  "ꚿ",
+  "ꛀ",
+  "ꛁ",
+  "ꛂ",
+  "ꛃ",
+  "ꛄ",
+  "ꛅ",
+  "ꛆ",
+  "ꛇ",
+  "ꛈ",
+  "ꛉ",
+  "ꛊ",
+  "ꛋ",
+  "ꛌ",
+  "ꛍ",
+  "ꛎ",
+  "ꛏ",
+  "ꛐ",
+  "ꛑ",
+  "ꛒ",
+  "ꛓ",
+  "ꛔ",
+  "ꛕ",
+  "ꛖ",
+  "ꛗ",
+  "ꛘ",
+  "ꛙ",
+  "ꛚ",
+  "ꛛ",
+  "ꛜ",
+  "ꛝ",
+  "ꛞ",
+  "ꛟ",
+  "ꛠ",
+  "ꛡ",
+  "ꛢ",
+  "ꛣ",
+  "ꛤ",
+  "ꛥ",
+  "ꛦ",
+  "ꛧ",
+  "ꛨ",
+  "ꛩ",
+  "ꛪ",
+  "ꛫ",
+  "ꛬ",
+  "ꛭ",
+  "ꛮ",
+  "ꛯ",
+};
+const char *ALPHA_21_DIGITS[] = {
+};
+const uint32_t ALPHA_21_UPPER_CPS[] = {
+  42656, 42657, 42658, 42659, 42660, 42661, 42662, 42663, 42664, 42665, 42666, 42667, 42668, 42669, 42670, 42671,
+  42672, 42673, 42674, 42675, 42676, 42677, 42678, 42679, 42680, 42681, 42682, 42683, 42684, 42685, 42686, 42687,
+  42688, 42689, 42690, 42691, 42692, 42693, 42694, 42695, 42696, 42697, 42698, 42699, 42700, 42701, 42702, 42703,
+  42704, 42705, 42706, 42707, 42708, 42709, 42710, 42711, 42712, 42713, 42714, 42715, 42716, 42717, 42718, 42719,
+  42720, 42721, 42722, 42723, 42724, 42725, 42726, 42727, 42728, 42729, 42730, 42731, 42732, 42733, 42734, 42735,
+};
+const uint32_t ALPHA_21_LOWER_CPS[] = {
+  42656, 42657, 42658, 42659, 42660, 42661, 42662, 42663, 42664, 42665, 42666, 42667, 42668, 42669, 42670, 42671,
+  42672, 42673, 42674, 42675, 42676, 42677, 42678, 42679, 42680, 42681, 42682, 42683, 42684, 42685, 42686, 42687,
+  42688, 42689, 42690, 42691, 42692, 42693, 42694, 42695, 42696, 42697, 42698, 42699, 42700, 42701, 42702, 42703,
+  42704, 42705, 42706, 42707, 42708, 42709, 42710, 42711, 42712, 42713, 42714, 42715, 42716, 42717, 42718, 42719,
+  42720, 42721, 42722, 42723, 42724, 42725, 42726, 42727, 42728, 42729, 42730, 42731, 42732, 42733, 42734, 42735,
+};
+const uint32_t ALPHA_21_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_21_FREQ[] = {
+  { "ꚠ", 0.00000000 },
+  { "ꚡ", 0.00000000 },
+  { "ꚢ", 0.00000000 },
+  { "ꚣ", 0.00000000 },
+  { "ꚤ", 0.00000000 },
+  { "ꚥ", 0.00000000 },
+  { "ꚦ", 0.00000000 },
+  { "ꚧ", 0.00000000 },
+  { "ꚨ", 0.00000000 },
+  { "ꚩ", 0.00000000 },
+  { "ꚪ", 0.00000000 },
+  { "ꚫ", 0.00000000 },
+  { "ꚬ", 0.00000000 },
+  { "ꚭ", 0.00000000 },
+  { "ꚮ", 0.00000000 },
+  { "ꚯ", 0.00000000 },
+  { "ꚰ", 0.00000000 },
+  { "ꚱ", 0.00000000 },
+  { "ꚲ", 0.00000000 },
+  { "ꚳ", 0.00000000 },
+  { "ꚴ", 0.00000000 },
+  { "ꚵ", 0.00000000 },
+  { "ꚶ", 0.00000000 },
+  { "ꚷ", 0.00000000 },
+  { "ꚸ", 0.00000000 },
+  { "ꚹ", 0.00000000 },
+  { "ꚺ", 0.00000000 },
+  { "ꚻ", 0.00000000 },
+  { "ꚼ", 0.00000000 },
+  { "ꚽ", 0.00000000 },
+  { "ꚾ", 0.00000000 },
+  { "ꚿ", 0.00000000 },
+  { "ꛀ", 0.00000000 },
+  { "ꛁ", 0.00000000 },
+  { "ꛂ", 0.00000000 },
+  { "ꛃ", 0.00000000 },
+  { "ꛄ", 0.00000000 },
+  { "ꛅ", 0.00000000 },
+  { "ꛆ", 0.00000000 },
+  { "ꛇ", 0.00000000 },
+  { "ꛈ", 0.00000000 },
+  { "ꛉ", 0.00000000 },
+  { "ꛊ", 0.00000000 },
+  { "ꛋ", 0.00000000 },
+  { "ꛌ", 0.00000000 },
+  { "ꛍ", 0.00000000 },
+  { "ꛎ", 0.00000000 },
+  { "ꛏ", 0.00000000 },
+  { "ꛐ", 0.00000000 },
+  { "ꛑ", 0.00000000 },
+  { "ꛒ", 0.00000000 },
+  { "ꛓ", 0.00000000 },
+  { "ꛔ", 0.00000000 },
+  { "ꛕ", 0.00000000 },
+  { "ꛖ", 0.00000000 },
+  { "ꛗ", 0.00000000 },
+  { "ꛘ", 0.00000000 },
+  { "ꛙ", 0.00000000 },
+  { "ꛚ", 0.00000000 },
+  { "ꛛ", 0.00000000 },
+  { "ꛜ", 0.00000000 },
+  { "ꛝ", 0.00000000 },
+  { "ꛞ", 0.00000000 },
+  { "ꛟ", 0.00000000 },
+  { "ꛠ", 0.00000000 },
+  { "ꛡ", 0.00000000 },
+  { "ꛢ", 0.00000000 },
+  { "ꛣ", 0.00000000 },
+  { "ꛤ", 0.00000000 },
+  { "ꛥ", 0.00000000 },
+  { "ꛦ", 0.00000000 },
+  { "ꛧ", 0.00000000 },
+  { "ꛨ", 0.00000000 },
+  { "ꛩ", 0.00000000 },
+  { "ꛪ", 0.00000000 },
+  { "ꛫ", 0.00000000 },
+  { "ꛬ", 0.00000000 },
+  { "ꛭ", 0.00000000 },
+  { "ꛮ", 0.00000000 },
+  { "ꛯ", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_21_FREQ_CPS[] = {
+  { 0xA6A0u, 0.00000000 },
+  { 0xA6A1u, 0.00000000 },
+  { 0xA6A2u, 0.00000000 },
+  { 0xA6A3u, 0.00000000 },
+  { 0xA6A4u, 0.00000000 },
+  { 0xA6A5u, 0.00000000 },
+  { 0xA6A6u, 0.00000000 },
+  { 0xA6A7u, 0.00000000 },
+  { 0xA6A8u, 0.00000000 },
+  { 0xA6A9u, 0.00000000 },
+  { 0xA6AAu, 0.00000000 },
+  { 0xA6ABu, 0.00000000 },
+  { 0xA6ACu, 0.00000000 },
+  { 0xA6ADu, 0.00000000 },
+  { 0xA6AEu, 0.00000000 },
+  { 0xA6AFu, 0.00000000 },
+  { 0xA6B0u, 0.00000000 },
+  { 0xA6B1u, 0.00000000 },
+  { 0xA6B2u, 0.00000000 },
+  { 0xA6B3u, 0.00000000 },
+  { 0xA6B4u, 0.00000000 },
+  { 0xA6B5u, 0.00000000 },
+  { 0xA6B6u, 0.00000000 },
+  { 0xA6B7u, 0.00000000 },
+  { 0xA6B8u, 0.00000000 },
+  { 0xA6B9u, 0.00000000 },
+  { 0xA6BAu, 0.00000000 },
+  { 0xA6BBu, 0.00000000 },
+  { 0xA6BCu, 0.00000000 },
+  { 0xA6BDu, 0.00000000 },
+  { 0xA6BEu, 0.00000000 },
+  { 0xA6BFu, 0.00000000 },
+  { 0xA6C0u, 0.00000000 },
+  { 0xA6C1u, 0.00000000 },
+  { 0xA6C2u, 0.00000000 },
+  { 0xA6C3u, 0.00000000 },
+  { 0xA6C4u, 0.00000000 },
+  { 0xA6C5u, 0.00000000 },
+  { 0xA6C6u, 0.00000000 },
+  { 0xA6C7u, 0.00000000 },
+  { 0xA6C8u, 0.00000000 },
+  { 0xA6C9u, 0.00000000 },
+  { 0xA6CAu, 0.00000000 },
+  { 0xA6CBu, 0.00000000 },
+  { 0xA6CCu, 0.00000000 },
+  { 0xA6CDu, 0.00000000 },
+  { 0xA6CEu, 0.00000000 },
+  { 0xA6CFu, 0.00000000 },
+  { 0xA6D0u, 0.00000000 },
+  { 0xA6D1u, 0.00000000 },
+  { 0xA6D2u, 0.00000000 },
+  { 0xA6D3u, 0.00000000 },
+  { 0xA6D4u, 0.00000000 },
+  { 0xA6D5u, 0.00000000 },
+  { 0xA6D6u, 0.00000000 },
+  { 0xA6D7u, 0.00000000 },
+  { 0xA6D8u, 0.00000000 },
+  { 0xA6D9u, 0.00000000 },
+  { 0xA6DAu, 0.00000000 },
+  { 0xA6DBu, 0.00000000 },
+  { 0xA6DCu, 0.00000000 },
+  { 0xA6DDu, 0.00000000 },
+  { 0xA6DEu, 0.00000000 },
+  { 0xA6DFu, 0.00000000 },
+  { 0xA6E0u, 0.00000000 },
+  { 0xA6E1u, 0.00000000 },
+  { 0xA6E2u, 0.00000000 },
+  { 0xA6E3u, 0.00000000 },
+  { 0xA6E4u, 0.00000000 },
+  { 0xA6E5u, 0.00000000 },
+  { 0xA6E6u, 0.00000000 },
+  { 0xA6E7u, 0.00000000 },
+  { 0xA6E8u, 0.00000000 },
+  { 0xA6E9u, 0.00000000 },
+  { 0xA6EAu, 0.00000000 },
+  { 0xA6EBu, 0.00000000 },
+  { 0xA6ECu, 0.00000000 },
+  { 0xA6EDu, 0.00000000 },
+  { 0xA6EEu, 0.00000000 },
+  { 0xA6EFu, 0.00000000 },
+};
+
@@ -0,0 +1,155 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_210_UPPER[] = {
+  "A",
+  "Å",
+  "Ä",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "Ö",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "Ü",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+};
+const char *ALPHA_210_LOWER[] = {
+  "a",
+  "å",
+  "ä",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "ö",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "ü",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+};
+const char *ALPHA_210_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_210_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 196, 197, 214, 220,
+};
+const uint32_t ALPHA_210_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 228, 229, 246, 252,
+};
+const uint32_t ALPHA_210_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_210_FREQ[] = {
+  { "a", 0.06480000 },
+  { "å", 0.00000000 },
+  { "ä", 0.00280000 },
+  { "b", 0.01920000 },
+  { "c", 0.01920000 },
+  { "d", 0.05190000 },
+  { "e", 0.14800000 },
+  { "f", 0.01320000 },
+  { "g", 0.02150000 },
+  { "h", 0.03820000 },
+  { "i", 0.05580000 },
+  { "j", 0.00310000 },
+  { "k", 0.02250000 },
+  { "l", 0.03780000 },
+  { "m", 0.02600000 },
+  { "n", 0.11540000 },
+  { "o", 0.04390000 },
+  { "ö", 0.01040000 },
+  { "p", 0.01480000 },
+  { "q", 0.00020000 },
+  { "r", 0.06960000 },
+  { "s", 0.05980000 },
+  { "t", 0.07510000 },
+  { "u", 0.03480000 },
+  { "ü", 0.01070000 },
+  { "v", 0.01880000 },
+  { "w", 0.01540000 },
+  { "x", 0.00070000 },
+  { "y", 0.00240000 },
+  { "z", 0.00360000 },
+};
+
+const wa_cp_freq ALPHA_210_FREQ_CPS[] = {
+  { 0x61u, 0.06480000 },
+  { 0x62u, 0.01920000 },
+  { 0x63u, 0.01920000 },
+  { 0x64u, 0.05190000 },
+  { 0x65u, 0.14800000 },
+  { 0x66u, 0.01320000 },
+  { 0x67u, 0.02150000 },
+  { 0x68u, 0.03820000 },
+  { 0x69u, 0.05580000 },
+  { 0x6Au, 0.00310000 },
+  { 0x6Bu, 0.02250000 },
+  { 0x6Cu, 0.03780000 },
+  { 0x6Du, 0.02600000 },
+  { 0x6Eu, 0.11540000 },
+  { 0x6Fu, 0.04390000 },
+  { 0x70u, 0.01480000 },
+  { 0x71u, 0.00020000 },
+  { 0x72u, 0.06960000 },
+  { 0x73u, 0.05980000 },
+  { 0x74u, 0.07510000 },
+  { 0x75u, 0.03480000 },
+  { 0x76u, 0.01880000 },
+  { 0x77u, 0.01540000 },
+  { 0x78u, 0.00070000 },
+  { 0x79u, 0.00240000 },
+  { 0x7Au, 0.00360000 },
+  { 0xE4u, 0.00280000 },
+  { 0xE5u, 0.00000000 },
+  { 0xF6u, 0.01040000 },
+  { 0xFCu, 0.01070000 },
+};
+
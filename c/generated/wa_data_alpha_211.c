@@ -0,0 +1,229 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_211_UPPER[] = {
+  "अ",
+  "आ",
+  "इ",
+  "ई",
+  "उ",
+  "ऊ",
+  "ऋ",
+  "ए",
+  "ऐ",
+  "ओ",
+  "औ",
+  "क",
+  "ख",
+  "ग",
+  "घ",
+  "ङ",
+  "च",
+  "छ",
+  "ज",
+  "झ",
+  "ञ",
+  "ट",
+  "ठ",
+  "ड",
+  "ढ",
+  "ण",
+  "त",
+  "थ",
+  "द",
+  "ध",
+  "न",
+  "प",
+  "फ",
+  "ब",
+  "भ",
+  "म",
+  "य",
+  "र",
+  "ल",
+  "व",
+  "श",
+  "ष",
+  "स",
+  "ह",
+  "ऌ",
+  "ऍ",
+  "ऑ",
+  "ळ",
+  "ऽ",
+  "ॐ",
+};
+const char *ALPHA_211_LOWER[] = {
+  "अ",
+  "आ",
+  "इ",
+  "ई",
+  "उ",
+  "ऊ",
+  "ऋ",
+  "ए",
+  "ऐ",
+  "ओ",
+  "औ",
+  "क",
+  "ख",
+  "ग",
+  "घ",
+  "ङ",
+  "च",
+  "छ",
+  "ज",
+  "झ",
+  "ञ",
+  "ट",
+  "ठ",
+  "ड",
+  "ढ",
+  "ण",
+  "त",
+  "थ",
+  "द",
+  "ध",
+  "न",
+  "प",
+  "फ",
+  "ब",
+  "भ",
+  "म",
+  "य",
+  "र",
+  "ल",
+  "व",
+  "श",
+  "ष",
+  "स",
+  "ह",
+  "ऌ",
+  "ऍ",
+  "ऑ",
+  "ळ",
+  "ऽ",
+  "ॐ",
+};
+const char *ALPHA_211_DIGITS[] = {
+};
+const uint32_t ALPHA_211_UPPER_CPS[] = {
+  2309, 2310, 2311, 2312, 2313, 2314, 2315, 2316, 2317, 2319, 2320, 2321, 2323, 2324, 2325, 2326,
+  2327, 2328, 2329, 2330, 2331, 2332, 2333, 2334, 2335, 2336, 2337, 2338, 2339, 2340, 2341, 2342,
+  2343, 2344, 2346, 2347, 2348, 2349, 2350, 2351, 2352, 2354, 2355, 2357, 2358, 2359, 2360, 2361,
+  2365, 2384,
+};
+const uint32_t ALPHA_211_LOWER_CPS[] = {
+  2309, 2310, 2311, 2312, 2313, 2314, 2315, 2316, 2317, 2319, 2320, 2321, 2323, 2324, 2325, 2326,
+  2327, 2328, 2329, 2330, 2331, 2332, 2333, 2334, 2335, 2336, 2337, 2338, 2339, 2340, 2341, 2342,
+  2343, 2344, 2346, 2347, 2348, 2349, 2350, 2351, 2352, 2354, 2355, 2357, 2358, 2359, 2360, 2361,
+  2365, 2384,
+};
+const uint32_t ALPHA_211_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_211_FREQ[] = {
+  { "अ", 0.01360000 },
+  { "आ", 0.00670000 },
+  { "इ", 0.00510000 },
+  { "ई", 0.00780000 },
+  { "उ", 0.01090000 },
+  { "ऊ", 0.00030000 },
+  { "ऋ", 0.00020000 },
+  { "ए", 0.01540000 },
+  { "ऐ", 0.00020000 },
+  { "ओ", 0.00070000 },
+  { "औ", 0.00050000 },
+  { "क", 0.09560000 },
+  { "ख", 0.00970000 },
+  { "ग", 0.02900000 },
+  { "घ", 0.00200000 },
+  { "ङ", 0.00200000 },
+  { "च", 0.01150000 },
+  { "छ", 0.01650000 },
+  { "ज", 0.02340000 },
+  { "झ", 0.00100000 },
+  { "ञ", 0.00210000 },
+  { "ट", 0.01540000 },
+  { "ठ", 0.00260000 },
+  { "ड", 0.00890000 },
+  { "ढ", 0.00120000 },
+  { "ण", 0.00850000 },
+  { "त", 0.05180000 },
+  { "थ", 0.01300000 },
+  { "द", 0.02940000 },
+  { "ध", 0.01220000 },
+  { "न", 0.08380000 },
+  { "प", 0.04540000 },
+  { "फ", 0.00550000 },
+  { "ब", 0.01870000 },
+  { "भ", 0.01610000 },
+  { "म", 0.05950000 },
+  { "य", 0.04700000 },
+  { "र", 0.11640000 },
+  { "ल", 0.05200000 },
+  { "व", 0.03620000 },
+  { "श", 0.01510000 },
+  { "ष", 0.01080000 },
+  { "स", 0.06080000 },
+  { "ह", 0.03570000 },
+  { "ऌ", 0.00000000 },
+  { "ऍ", 0.00000000 },
+  { "ऑ", 0.00000000 },
+  { "ळ", 0.00000000 },
+  { "ऽ", 0.00000000 },
+  { "ॐ", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_211_FREQ_CPS[] = {
+  { 0x905u, 0.01360000 },
+  { 0x906u, 0.00670000 },
+  { 0x907u, 0.00510000 },
+  { 0x908u, 0.00780000 },
+  { 0x909u, 0.01090000 },
+  { 0x90Au, 0.00030000 },
+  { 0x90Bu, 0.00020000 },
+  { 0x90Cu, 0.00000000 },
+  { 0x90Du, 0.00000000 },
+  { 0x90Fu, 0.01540000 },
+  { 0x910u, 0.00020000 },
+  { 0x911u, 0.00000000 },
+  { 0x913u, 0.00070000 },
+  { 0x914u, 0.00050000 },
+  { 0x915u, 0.09560000 },
+  { 0x916u, 0.00970000 },
+  { 0x917u, 0.02900000 },
+  { 0x918u, 0.00200000 },
+  { 0x919u, 0.00200000 },
+  { 0x91Au, 0.01150000 },
+  { 0x91Bu, 0.01650000 },
+  { 0x91Cu, 0.02340000 },
+  { 0x91Du, 0.00100000 },
+  { 0x91Eu, 0.00210000 },
+  { 0x91Fu, 0.01540000 },
+  { 0x920u, 0.00260000 },
+  { 0x921u, 0.00890000 },
+  { 0x922u, 0.00120000 },
+  { 0x923u, 0.00850000 },
+  { 0x924u, 0.05180000 },
+  { 0x925u, 0.01300000 },
+  { 0x926u, 0.02940000 },
+  { 0x927u, 0.01220000 },
+  { 0x928u, 0.08380000 },
+  { 0x92Au, 0.04540000 },
+  { 0x92Bu, 0.00550000 },
+  { 0x92Cu, 0.01870000 },
+  { 0x92Du, 0.01610000 },
+  { 0x92Eu, 0.05950000 },
+  { 0x92Fu, 0.04700000 },
+  { 0x930u, 0.11640000 },
+  { 0x932u, 0.05200000 },
+  { 0x933u, 0.00000000 },
+  { 0x935u, 0.03620000 },
+  { 0x936u, 0.01510000 },
+  { 0x937u, 0.01080000 },
+  { 0x938u, 0.06080000 },
+  { 0x939u, 0.03570000 },
+  { 0x93Du, 0.00000000 },
+  { 0x950u, 0.00000000 },
+};
+
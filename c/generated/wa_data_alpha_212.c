@@ -0,0 +1,171 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_212_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+  "Á",
+  "Ä",
+  "É",
+  "Ë",
+  "Í",
+  "Ï",
+  "Ó",
+  "Ö",
+  "Ú",
+  "Ü",
+};
+const char *ALPHA_212_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+  "á",
+  "ä",
+  "é",
+  "ë",
+  "í",
+  "ï",
+  "ó",
+  "ö",
+  "ú",
+  "ü",
+};
+const char *ALPHA_212_DIGITS[] = {
+};
+const uint32_t ALPHA_212_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 193, 196, 201, 203, 205, 207,
+  211, 214, 218, 220,
+};
+const uint32_t ALPHA_212_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 225, 228, 233, 235, 237, 239,
+  243, 246, 250, 252,
+};
+const uint32_t ALPHA_212_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_212_FREQ[] = {
+  { "a", 0.07760000 },
+  { "b", 0.01580000 },
+  { "c", 0.01760000 },
+  { "d", 0.05610000 },
+  { "e", 0.17680000 },
+  { "f", 0.00860000 },
+  { "g", 0.02800000 },
+  { "h", 0.02630000 },
+  { "i", 0.07030000 },
+  { "j", 0.01320000 },
+  { "k", 0.01980000 },
+  { "l", 0.03970000 },
+  { "m", 0.02390000 },
+  { "n", 0.09420000 },
+  { "o", 0.06120000 },
+  { "p", 0.01750000 },
+  { "q", 0.00020000 },
+  { "r", 0.06600000 },
+  { "s", 0.04800000 },
+  { "t", 0.06470000 },
+  { "u", 0.02000000 },
+  { "v", 0.02480000 },
+  { "w", 0.01480000 },
+  { "x", 0.00090000 },
+  { "y", 0.00260000 },
+  { "z", 0.00970000 },
+  { "á", 0.00010000 },
+  { "ä", 0.00010000 },
+  { "é", 0.00060000 },
+  { "ë", 0.00060000 },
+  { "í", 0.00010000 },
+  { "ï", 0.00010000 },
+  { "ó", 0.00010000 },
+  { "ö", 0.00010000 },
+  { "ú", 0.00000000 },
+  { "ü", 0.00010000 },
+};
+
+const wa_cp_freq ALPHA_212_FREQ_CPS[] = {
+  { 0x61u, 0.07760000 },
+  { 0x62u, 0.01580000 },
+  { 0x63u, 0.01760000 },
+  { 0x64u, 0.05610000 },
+  { 0x65u, 0.17680000 },
+  { 0x66u, 0.00860000 },
+  { 0x67u, 0.02800000 },
+  { 0x68u, 0.02630000 },
+  { 0x69u, 0.07030000 },
+  { 0x6Au, 0.01320000 },
+  { 0x6Bu, 0.01980000 },
+  { 0x6Cu, 0.03970000 },
+  { 0x6Du, 0.02390000 },
+  { 0x6Eu, 0.09420000 },
+  { 0x6Fu, 0.06120000 },
+  { 0x70u, 0.01750000 },
+  { 0x71u, 0.00020000 },
+  { 0x72u, 0.06600000 },
+  { 0x73u, 0.04800000 },
+  { 0x74u, 0.06470000 },
+  { 0x75u, 0.02000000 },
+  { 0x76u, 0.02480000 },
+  { 0x77u, 0.01480000 },
+  { 0x78u, 0.00090000 },
+  { 0x79u, 0.00260000 },
+  { 0x7Au, 0.00970000 },
+  { 0xE1u, 0.00010000 },
+  { 0xE4u, 0.00010000 },
+  { 0xE9u, 0.00060000 },
+  { 0xEBu, 0.00060000 },
+  { 0xEDu, 0.00010000 },
+  { 0xEFu, 0.00010000 },
+  { 0xF3u, 0.00010000 },
+  { 0xF6u, 0.00010000 },
+  { 0xFAu, 0.00000000 },
+  { 0xFCu, 0.00010000 },
+};
+
@@ -0,0 +1,251 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_213_UPPER[] = {
+  "A",
+  "Á",
+  "Â",
+  "Ǎ",
+  "Ä",
+  "Ā",
+  "B",
+  "Ɓ",
+  "C",
+  "D",
+  "E",
+  "É",
+  "Ê",
+  "Ě",
+  "Ē",
+  "Ǝ",
+  "Ɛ",
+  "F",
+  "G",
+  "H",
+  "I",
+  "Í",
+  "Î",
+  "Ǐ",
+  "Ï",
+  "Ī",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "Ń",
+  "Ŋ",
+  "O",
+  "Ó",
+  "Ô",
+  "Ǒ",
+  "Ö",
+  "Ō",
+  "Ɔ",
+  "P",
+  "R",
+  "Ŕ",
+  "S",
+  "T",
+  "U",
+  "Ú",
+  "Û",
+  "Ǔ",
+  "Ū",
+  "V",
+  "W",
+  "Y",
+};
+const char *ALPHA_213_LOWER[] = {
+  "a",
+  "á",
+  "â",
+  "ǎ",
+  "ä",
+  "ā",
+  "b",
+  "ɓ",
+  "c",
+  "d",
+  "e",
+  "é",
+  "ê",
+  "ě",
+  "ē",
+  "ǝ",
+  "ɛ",
+  "f",
+  "g",
+  "h",
+  "i",
+  "í",
+  "î",
+  "ǐ",
+  "ï",
+  "ī",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "ń",
+  "ŋ",
+  "o",
+  "ó",
+  "ô",
+  "ǒ",
+  "ö",
+  "ō",
+  "ɔ",
+  "p",
+  "r",
+  "ŕ",
+  "s",
+  "t",
+  "u",
+  "ú",
+  "û",
+  "ǔ",
+  "ū",
+  "v",
+  "w",
+  "y",
+};
+const char *ALPHA_213_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_213_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  82, 83, 84, 85, 86, 87, 89, 193, 194, 196, 201, 202, 205, 206, 207, 211,
+  212, 214, 218, 219, 256, 274, 282, 298, 323, 330, 332, 340, 362, 385, 390, 398,
+  400, 461, 463, 465, 467,
+};
+const uint32_t ALPHA_213_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  114, 115, 116, 117, 118, 119, 121, 225, 226, 228, 233, 234, 237, 238, 239, 243,
+  244, 246, 250, 251, 257, 275, 283, 299, 324, 331, 333, 341, 363, 462, 464, 466,
+  468, 477, 595, 596, 603,
+};
+const uint32_t ALPHA_213_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_213_FREQ[] = {
+  { "a", 0.00000000 },
+  { "á", 0.00000000 },
+  { "â", 0.00000000 },
+  { "ǎ", 0.00000000 },
+  { "ä", 0.00000000 },
+  { "ā", 0.00000000 },
+  { "b", 0.00000000 },
+  { "ɓ", 0.00000000 },
+  { "c", 0.00000000 },
+  { "d", 0.00000000 },
+  { "e", 0.00000000 },
+  { "é", 0.00000000 },
+  { "ê", 0.00000000 },
+  { "ě", 0.00000000 },
+  { "ē", 0.00000000 },
+  { "ǝ", 0.00000000 },
+  { "ɛ", 0.00000000 },
+  { "f", 0.00000000 },
+  { "g", 0.00000000 },
+  { "h", 0.00000000 },
+  { "i", 0.00000000 },
+  { "í", 0.00000000 },
+  { "î", 0.00000000 },
+  { "ǐ", 0.00000000 },
+  { "ï", 0.00000000 },
+  { "ī", 0.00000000 },
+  { "j", 0.00000000 },
+  { "k", 0.00000000 },
+  { "l", 0.00000000 },
+  { "m", 0.00000000 },
+  { "n", 0.00000000 },
+  { "ń", 0.00000000 },
+  { "ŋ", 0.00000000 },
+  { "o", 0.00000000 },
+  { "ó", 0.00000000 },
+  { "ô", 0.00000000 },
+  { "ǒ", 0.00000000 },
+  { "ö", 0.00000000 },
+  { "ō", 0.00000000 },
+  { "ɔ", 0.00000000 },
+  { "p", 0.00000000 },
+  { "r", 0.00000000 },
+  { "ŕ", 0.00000000 },
+  { "s", 0.00000000 },
+  { "t", 0.00000000 },
+  { "u", 0.00000000 },
+  { "ú", 0.00000000 },
+  { "û", 0.00000000 },
+  { "ǔ", 0.00000000 },
+  { "ū", 0.00000000 },
+  { "v", 0.00000000 },
+  { "w", 0.00000000 },
+  { "y", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_213_FREQ_CPS[] = {
+  { 0x61u, 0.00000000 },
+  { 0x62u, 0.00000000 },
+  { 0x63u, 0.00000000 },
+  { 0x64u, 0.00000000 },
+  { 0x65u, 0.00000000 },
+  { 0x66u, 0.00000000 },
+  { 0x67u, 0.00000000 },
+  { 0x68u, 0.00000000 },
+  { 0x69u, 0.00000000 },
+  { 0x6Au, 0.00000000 },
+  { 0x6Bu, 0.00000000 },
+  { 0x6Cu, 0.00000000 },
+  { 0x6Du, 0.00000000 },
+  { 0x6Eu, 0.00000000 },
+  { 0x6Fu, 0.00000000 },
+  { 0x70u, 0.00000000 },
+  { 0x72u, 0.00000000 },
+  { 0x73u, 0.00000000 },
+  { 0x74u, 0.00000000 },
+  { 0x75u, 0.00000000 },
+  { 0x76u, 0.00000000 },
+  { 0x77u, 0.00000000 },
+  { 0x79u, 0.00000000 },
+  { 0xE1u, 0.00000000 },
+  { 0xE2u, 0.00000000 },
+  { 0xE4u, 0.00000000 },
+  { 0xE9u, 0.00000000 },
+  { 0xEAu, 0.00000000 },
+  { 0xEDu, 0.00000000 },
+  { 0xEEu, 0.00000000 },
+  { 0xEFu, 0.00000000 },
+  { 0xF3u, 0.00000000 },
+  { 0xF4u, 0.00000000 },
+  { 0xF6u, 0.00000000 },
+  { 0xFAu, 0.00000000 },
+  { 0xFBu, 0.00000000 },
+  { 0x101u, 0.00000000 },
+  { 0x113u, 0.00000000 },
+  { 0x11Bu, 0.00000000 },
+  { 0x12Bu, 0.00000000 },
+  { 0x144u, 0.00000000 },
+  { 0x14Bu, 0.00000000 },
+  { 0x14Du, 0.00000000 },
+  { 0x155u, 0.00000000 },
+  { 0x16Bu, 0.00000000 },
+  { 0x1CEu, 0.00000000 },
+  { 0x1D0u, 0.00000000 },
+  { 0x1D2u, 0.00000000 },
+  { 0x1D4u, 0.00000000 },
+  { 0x1DDu, 0.00000000 },
+  { 0x253u, 0.00000000 },
+  { 0x254u, 0.00000000 },
+  { 0x25Bu, 0.00000000 },
+};
+
@@ -0,0 +1,163 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_214_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+  "Æ",
+  "Ø",
+  "Å",
+  "À",
+  "É",
+  "Ò",
+  "Ó",
+  "Ô",
+};
+const char *ALPHA_214_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+  "æ",
+  "ø",
+  "å",
+  "à",
+  "é",
+  "ò",
+  "ó",
+  "ô",
+};
+const char *ALPHA_214_DIGITS[] = {
+};
+const uint32_t ALPHA_214_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 192, 197, 198, 201, 210, 211,
+  212, 216,
+};
+const uint32_t ALPHA_214_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 224, 229, 230, 233, 242, 243,
+  244, 248,
+};
+const uint32_t ALPHA_214_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_214_FREQ[] = {
+  { "a", 0.08600000 },
+  { "b", 0.01370000 },
+  { "c", 0.00400000 },
+  { "d", 0.04290000 },
+  { "e", 0.12970000 },
+  { "f", 0.01880000 },
+  { "g", 0.03750000 },
+  { "h", 0.01500000 },
+  { "i", 0.06880000 },
+  { "j", 0.01130000 },
+  { "k", 0.03710000 },
+  { "l", 0.05020000 },
+  { "m", 0.03360000 },
+  { "n", 0.07800000 },
+  { "o", 0.05320000 },
+  { "p", 0.01790000 },
+  { "q", 0.00010000 },
+  { "r", 0.08560000 },
+  { "s", 0.06170000 },
+  { "t", 0.07450000 },
+  { "u", 0.01980000 },
+  { "v", 0.02630000 },
+  { "w", 0.00140000 },
+  { "x", 0.00030000 },
+  { "y", 0.00980000 },
+  { "z", 0.00080000 },
+  { "æ", 0.00130000 },
+  { "ø", 0.00760000 },
+  { "å", 0.01250000 },
+  { "à", 0.00000000 },
+  { "é", 0.00020000 },
+  { "ò", 0.00040000 },
+  { "ó", 0.00010000 },
+  { "ô", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_214_FREQ_CPS[] = {
+  { 0x61u, 0.08600000 },
+  { 0x62u, 0.01370000 },
+  { 0x63u, 0.00400000 },
+  { 0x64u, 0.04290000 },
+  { 0x65u, 0.12970000 },
+  { 0x66u, 0.01880000 },
+  { 0x67u, 0.03750000 },
+  { 0x68u, 0.01500000 },
+  { 0x69u, 0.06880000 },
+  { 0x6Au, 0.01130000 },
+  { 0x6Bu, 0.03710000 },
+  { 0x6Cu, 0.05020000 },
+  { 0x6Du, 0.03360000 },
+  { 0x6Eu, 0.07800000 },
+  { 0x6Fu, 0.05320000 },
+  { 0x70u, 0.01790000 },
+  { 0x71u, 0.00010000 },
+  { 0x72u, 0.08560000 },
+  { 0x73u, 0.06170000 },
+  { 0x74u, 0.07450000 },
+  { 0x75u, 0.01980000 },
+  { 0x76u, 0.02630000 },
+  { 0x77u, 0.00140000 },
+  { 0x78u, 0.00030000 },
+  { 0x79u, 0.00980000 },
+  { 0x7Au, 0.00080000 },
+  { 0xE0u, 0.00000000 },
+  { 0xE5u, 0.01250000 },
+  { 0xE6u, 0.00130000 },
+  { 0xE9u, 0.00020000 },
+  { 0xF2u, 0.00040000 },
+  { 0xF3u, 0.00010000 },
+  { 0xF4u, 0.00000000 },
+  { 0xF8u, 0.00760000 },
+};
+
@@ -0,0 +1,163 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_217_UPPER[] = {
+  "ߊ",
+  "ߋ",
+  "ߌ",
+  "ߍ",
+  "ߎ",
+  "ߏ",
+  "ߐ",
+  "ߑ",
+  "ߒ",
+  "ߓ",
+  "ߔ",
+  "ߕ",
+  "ߖ",
+  "ߗ",
+  "ߘ",
+  "ߙ",
+  "ߚ",
+  "ߛ",
+  "ߜ",
+  "ߝ",
+  "ߞ",
+  "ߟ",
+  "ߠ",
+  "ߡ",
+  "ߢ",
+  "ߣ",
+  "ߤ",
+  "ߥ",
+  "ߦ",
+  "ߧ",
+  "ߴ",
+  "ߵ",
+};
+const char *ALPHA_217_LOWER[] = {
+  "ߊ",
+  "ߋ",
+  "ߌ",
+  "ߍ",
+  "ߎ",
+  "ߏ",
+  "ߐ",
+  "ߑ",
+  "ߒ",
+  "ߓ",
+  "ߔ",
+  "ߕ",
+  "ߖ",
+  "ߗ",
+  "ߘ",
+  "ߙ",
+  "ߚ",
+  "ߛ",
+  "ߜ",
+  "ߝ",
+  "ߞ",
+  "ߟ",
+  "ߠ",
+  "ߡ",
+  "ߢ",
+  "ߣ",
+  "ߤ",
+  "ߥ",
+  "ߦ",
+  "ߧ",
+  "ߴ",
+  "ߵ",
+};
+const char *ALPHA_217_DIGITS[] = {
+  "߀",
+  "߁",
+  "߂",
+  "߃",
+  "߄",
+  "߅",
+  "߆",
+  "߇",
+  "߈",
+  "߉",
+};
+const uint32_t ALPHA_217_UPPER_CPS[] = {
+  1994, 1995, 1996, 1997, 1998, 1999, 2000, 2001, 2002, 2003, 2004, 2005, 2006, 2007, 2008, 2009,
+  2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2036, 2037,
+};
+const uint32_t ALPHA_217_LOWER_CPS[] = {
+  1994, 1995, 1996, 1997, 1998, 1999, 2000, 2001, 2002, 2003, 2004, 2005, 2006, 2007, 2008, 2009,
+  2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2036, 2037,
+};
+const uint32_t ALPHA_217_DIGITS_CPS[] = {
+  1984, 1985, 1986, 1987, 1988, 1989, 1990, 1991, 1992, 1993,
+};
+const wa_freq_entry ALPHA_217_FREQ[] = {
+  { "ߊ", 0.00000000 },
+  { "ߋ", 0.00000000 },
+  { "ߌ", 0.00000000 },
+  { "ߍ", 0.00000000 },
+  { "ߎ", 0.00000000 },
+  { "ߏ", 0.00000000 },
+  { "ߐ", 0.00000000 },
+  { "ߑ", 0.00000000 },
+  { "ߒ", 0.00000000 },
+  { "ߓ", 0.00000000 },
+  { "ߔ", 0.00000000 },
+  { "ߕ", 0.00000000 },
+  { "ߖ", 0.00000000 },
+  { "ߗ", 0.00000000 },
+  { "ߘ", 0.00000000 },
+  { "ߙ", 0.00000000 },
+  { "ߚ", 0.00000000 },
+  { "ߛ", 0.00000000 },
+  { "ߜ", 0.00000000 },
+  { "ߝ", 0.00000000 },
+  { "ߞ", 0.00000000 },
+  { "ߟ", 0.00000000 },
+  { "ߠ", 0.00000000 },
+  { "ߡ", 0.00000000 },
+  { "ߢ", 0.00000000 },
+  { "ߣ", 0.00000000 },
+  { "ߤ", 0.00000000 },
+  { "ߥ", 0.00000000 },
+  { "ߦ", 0.00000000 },
+  { "ߧ", 0.00000000 },
+  { "ߴ", 0.00000000 },
+  { "ߵ", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_217_FREQ_CPS[] = {
+  { 0x7CAu, 0.00000000 },
+  { 0x7CBu, 0.00000000 },
+  { 0x7CCu, 0.00000000 },
+  { 0x7CDu, 0.00000000 },
+  { 0x7CEu, 0.00000000 },
+  { 0x7CFu, 0.00000000 },
+  { 0x7D0u, 0.00000000 },
+  { 0x7D1u, 0.00000000 },
+  { 0x7D2u, 0.00000000 },
+  { 0x7D3u, 0.00000000 },
+  { 0x7D4u, 0.00000000 },
+  { 0x7D5u, 0.00000000 },
+  { 0x7D6u, 0.00000000 },
+  { 0x7D7u, 0.00000000 },
+  { 0x7D8u, 0.00000000 },
+  { 0x7D9u, 0.00000000 },
+  { 0x7DAu, 0.00000000 },
+  { 0x7DBu, 0.00000000 },
+  { 0x7DCu, 0.00000000 },
+  { 0x7DDu, 0.00000000 },
+  { 0x7DEu, 0.00000000 },
+  { 0x7DFu, 0.00000000 },
+  { 0x7E0u, 0.00000000 },
+  { 0x7E1u, 0.00000000 },
+  { 0x7E2u, 0.00000000 },
+  { 0x7E3u, 0.00000000 },
+  { 0x7E4u, 0.00000000 },
+  { 0x7E5u, 0.00000000 },
+  { 0x7E6u, 0.00000000 },
+  { 0x7E7u, 0.00000000 },
+  { 0x7F4u, 0.00000000 },
+  { 0x7F5u, 0.00000000 },
+};
+
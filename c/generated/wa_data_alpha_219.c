@@ -0,0 +1,135 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_219_UPPER[] = {
+  "A",
+  "B",
+  "D",
+  "E",
+  "Ê",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "Ô",
+  "P",
+  "R",
+  "S",
+  "Š",
+  "T",
+  "U",
+  "W",
+  "X",
+  "Y",
+};
+const char *ALPHA_219_LOWER[] = {
+  "a",
+  "b",
+  "d",
+  "e",
+  "ê",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "ô",
+  "p",
+  "r",
+  "s",
+  "š",
+  "t",
+  "u",
+  "w",
+  "x",
+  "y",
+};
+const char *ALPHA_219_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_219_UPPER_CPS[] = {
+  65, 66, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 82,
+  83, 84, 85, 87, 88, 89, 202, 212, 352,
+};
+const uint32_t ALPHA_219_LOWER_CPS[] = {
+  97, 98, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 114,
+  115, 116, 117, 119, 120, 121, 234, 244, 353,
+};
+const uint32_t ALPHA_219_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_219_FREQ[] = {
+  { "a", 0.15510000 },
+  { "b", 0.02650000 },
+  { "d", 0.02140000 },
+  { "e", 0.14670000 },
+  { "ê", 0.00000000 },
+  { "f", 0.01020000 },
+  { "g", 0.05980000 },
+  { "h", 0.02180000 },
+  { "i", 0.04330000 },
+  { "j", 0.00230000 },
+  { "k", 0.03680000 },
+  { "l", 0.07660000 },
+  { "m", 0.04250000 },
+  { "n", 0.04730000 },
+  { "o", 0.10440000 },
+  { "ô", 0.00020000 },
+  { "p", 0.01800000 },
+  { "r", 0.02760000 },
+  { "s", 0.03470000 },
+  { "š", 0.02250000 },
+  { "t", 0.05090000 },
+  { "u", 0.01220000 },
+  { "w", 0.02330000 },
+  { "x", 0.00030000 },
+  { "y", 0.01560000 },
+};
+
+const wa_cp_freq ALPHA_219_FREQ_CPS[] = {
+  { 0x61u, 0.15510000 },
+  { 0x62u, 0.02650000 },
+  { 0x64u, 0.02140000 },
+  { 0x65u, 0.14670000 },
+  { 0x66u, 0.01020000 },
+  { 0x67u, 0.05980000 },
+  { 0x68u, 0.02180000 },
+  { 0x69u, 0.04330000 },
+  { 0x6Au, 0.00230000 },
+  { 0x6Bu, 0.03680000 },
+  { 0x6Cu, 0.07660000 },
+  { 0x6Du, 0.04250000 },
+  { 0x6Eu, 0.04730000 },
+  { 0x6Fu, 0.10440000 },
+  { 0x70u, 0.01800000 },
+  { 0x72u, 0.02760000 },
+  { 0x73u, 0.03470000 },
+  { 0x74u, 0.05090000 },
+  { 0x75u, 0.01220000 },
+  { 0x77u, 0.02330000 },
+  { 0x78u, 0.00030000 },
+  { 0x79u, 0.01560000 },
+  { 0xEAu, 0.00000000 },
+  { 0xF4u, 0.00020000 },
+  { 0x161u, 0.02250000 },
+};
+
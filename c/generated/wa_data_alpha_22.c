@@ -0,0 +1,153 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_22_UPPER[] = {
+  "А",
+  "Б",
+  "В",
+  "Г",
+  "Д",
+  "Е",
+  "Ё",
+  "Ж",
+  "З",
+  "І",
+  "Й",
+  "К",
+  "Л",
+  "М",
+  "Н",
+  "О",
+  "П",
+  "Р",
+  "С",
+  "Т",
+  "У",
+  "Ў",
+  "Ф",
+  "Х",
+  "Ц",
+  "Ч",
+  "Ш",
+  "Ы",
+  "Ь",
+  "Э",
+  "Ю",
+  "Я",
+};
+const char *ALPHA_22_LOWER[] = {
+  "а",
+  "б",
+  "в",
+  "г",
+  "д",
+  "е",
+  "ё",
+  "ж",
+  "з",
+  "і",
+  "й",
+  "к",
+  "л",
+  "м",
+  "н",
+  "о",
+  "п",
+  "р",
+  "с",
+  "т",
+  "у",
+  "ў",
+  "ф",
+  "х",
+  "ц",
+  "ч",
+  "ш",
+  "ы",
+  "ь",
+  "э",
+  "ю",
+  "я",
+};
+const char *ALPHA_22_DIGITS[] = {
+};
+const uint32_t ALPHA_22_UPPER_CPS[] = {
+  1025, 1030, 1038, 1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 1049, 1050, 1051, 1052, 1053,
+  1054, 1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1067, 1068, 1069, 1070, 1071,
+};
+const uint32_t ALPHA_22_LOWER_CPS[] = {
+  1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079, 1081, 1082, 1083, 1084, 1085, 1086, 1087, 1088,
+  1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 1099, 1100, 1101, 1102, 1103, 1105, 1110, 1118,
+};
+const uint32_t ALPHA_22_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_22_FREQ[] = {
+  { "а", 0.15450000 },
+  { "б", 0.01430000 },
+  { "в", 0.03000000 },
+  { "г", 0.02020000 },
+  { "д", 0.03080000 },
+  { "е", 0.03500000 },
+  { "ё", 0.00330000 },
+  { "ж", 0.00540000 },
+  { "з", 0.02310000 },
+  { "і", 0.05190000 },
+  { "й", 0.01150000 },
+  { "к", 0.03920000 },
+  { "л", 0.03750000 },
+  { "м", 0.02870000 },
+  { "н", 0.06420000 },
+  { "о", 0.02930000 },
+  { "п", 0.02590000 },
+  { "р", 0.04790000 },
+  { "с", 0.04430000 },
+  { "т", 0.03290000 },
+  { "у", 0.02670000 },
+  { "ў", 0.02100000 },
+  { "ф", 0.00360000 },
+  { "х", 0.01010000 },
+  { "ц", 0.02060000 },
+  { "ч", 0.01300000 },
+  { "ш", 0.00820000 },
+  { "ы", 0.04110000 },
+  { "ь", 0.00980000 },
+  { "э", 0.01170000 },
+  { "ю", 0.00470000 },
+  { "я", 0.02980000 },
+};
+
+const wa_cp_freq ALPHA_22_FREQ_CPS[] = {
+  { 0x430u, 0.15450000 },
+  { 0x431u, 0.01430000 },
+  { 0x432u, 0.03000000 },
+  { 0x433u, 0.02020000 },
+  { 0x434u, 0.03080000 },
+  { 0x435u, 0.03500000 },
+  { 0x436u, 0.00540000 },
+  { 0x437u, 0.02310000 },
+  { 0x439u, 0.01150000 },
+  { 0x43Au, 0.03920000 },
+  { 0x43Bu, 0.03750000 },
+  { 0x43Cu, 0.02870000 },
+  { 0x43Du, 0.06420000 },
+  { 0x43Eu, 0.02930000 },
+  { 0x43Fu, 0.02590000 },
+  { 0x440u, 0.04790000 },
+  { 0x441u, 0.04430000 },
+  { 0x442u, 0.03290000 },
+  { 0x443u, 0.02670000 },
+  { 0x444u, 0.00360000 },
+  { 0x445u, 0.01010000 },
+  { 0x446u, 0.02060000 },
+  { 0x447u, 0.01300000 },
+  { 0x448u, 0.00820000 },
+  { 0x44Bu, 0.04110000 },
+  { 0x44Cu, 0.00980000 },
+  { 0x44Du, 0.01170000 },
+  { 0x44Eu, 0.00470000 },
+  { 0x44Fu, 0.02980000 },
+  { 0x451u, 0.00330000 },
+  { 0x456u, 0.05190000 },
+  { 0x45Eu, 0.02100000 },
+};
+
@@ -0,0 +1,151 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_221_UPPER[] = {
+  "A",
+  "Á",
+  "Ą",
+  "B",
+  "C",
+  "H",
+  "D",
+  "L",
+  "Z",
+  "E",
+  "É",
+  "Ę",
+  "G",
+  "W",
+  "I",
+  "Í",
+  "Į",
+  "J",
+  "K",
+  "Ł",
+  "M",
+  "N",
+  "O",
+  "Ó",
+  "Ǫ",
+  "S",
+  "T",
+  "X",
+  "Y",
+};
+const char *ALPHA_221_LOWER[] = {
+  "a",
+  "á",
+  "ą",
+  "b",
+  "c",
+  "h",
+  "d",
+  "l",
+  "z",
+  "e",
+  "é",
+  "ę",
+  "g",
+  "w",
+  "i",
+  "í",
+  "į",
+  "j",
+  "k",
+  "ł",
+  "m",
+  "n",
+  "o",
+  "ó",
+  "ǫ",
+  "s",
+  "t",
+  "x",
+  "y",
+};
+const char *ALPHA_221_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_221_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 71, 72, 73, 74, 75, 76, 77, 78, 79, 83, 84,
+  87, 88, 89, 90, 193, 201, 205, 211, 260, 280, 302, 321, 490,
+};
+const uint32_t ALPHA_221_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 103, 104, 105, 106, 107, 108, 109, 110, 111, 115, 116,
+  119, 120, 121, 122, 225, 233, 237, 243, 261, 281, 303, 322, 491,
+};
+const uint32_t ALPHA_221_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_221_FREQ[] = {
+  { "a", 0.10380000 },
+  { "á", 0.05000000 },
+  { "ą", 0.01650000 },
+  { "b", 0.02610000 },
+  { "c", 0.01250000 },
+  { "h", 0.07290000 },
+  { "d", 0.07130000 },
+  { "l", 0.02670000 },
+  { "z", 0.01880000 },
+  { "e", 0.03380000 },
+  { "é", 0.04600000 },
+  { "ę", 0.00530000 },
+  { "g", 0.02740000 },
+  { "w", 0.00450000 },
+  { "i", 0.10430000 },
+  { "í", 0.07380000 },
+  { "į", 0.00830000 },
+  { "j", 0.00670000 },
+  { "k", 0.02000000 },
+  { "ł", 0.02730000 },
+  { "m", 0.00370000 },
+  { "n", 0.05370000 },
+  { "o", 0.05020000 },
+  { "ó", 0.03540000 },
+  { "ǫ", 0.00570000 },
+  { "s", 0.03750000 },
+  { "t", 0.03500000 },
+  { "x", 0.00070000 },
+  { "y", 0.02200000 },
+};
+
+const wa_cp_freq ALPHA_221_FREQ_CPS[] = {
+  { 0x61u, 0.10380000 },
+  { 0x62u, 0.02610000 },
+  { 0x63u, 0.01250000 },
+  { 0x64u, 0.07130000 },
+  { 0x65u, 0.03380000 },
+  { 0x67u, 0.02740000 },
+  { 0x68u, 0.07290000 },
+  { 0x69u, 0.10430000 },
+  { 0x6Au, 0.00670000 },
+  { 0x6Bu, 0.02000000 },
+  { 0x6Cu, 0.02670000 },
+  { 0x6Du, 0.00370000 },
+  { 0x6Eu, 0.05370000 },
+  { 0x6Fu, 0.05020000 },
+  { 0x73u, 0.03750000 },
+  { 0x74u, 0.03500000 },
+  { 0x77u, 0.00450000 },
+  { 0x78u, 0.00070000 },
+  { 0x79u, 0.02200000 },
+  { 0x7Au, 0.01880000 },
+  { 0xE1u, 0.05000000 },
+  { 0xE9u, 0.04600000 },
+  { 0xEDu, 0.07380000 },
+  { 0xF3u, 0.03540000 },
+  { 0x105u, 0.01650000 },
+  { 0x119u, 0.00530000 },
+  { 0x12Fu, 0.00830000 },
+  { 0x142u, 0.02730000 },
+  { 0x1EBu, 0.00570000 },
+};
+
@@ -0,0 +1,175 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_224_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+  "À",
+  "Á",
+  "Ç",
+  "È",
+  "É",
+  "Í",
+  "Ï",
+  "Ò",
+  "Ó",
+  "Ú",
+  "Ü",
+};
+const char *ALPHA_224_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+  "à",
+  "á",
+  "ç",
+  "è",
+  "é",
+  "í",
+  "ï",
+  "ò",
+  "ó",
+  "ú",
+  "ü",
+};
+const char *ALPHA_224_DIGITS[] = {
+};
+const uint32_t ALPHA_224_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 192, 193, 199, 200, 201, 205,
+  207, 210, 211, 218, 220,
+};
+const uint32_t ALPHA_224_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 224, 225, 231, 232, 233, 237,
+  239, 242, 243, 250, 252,
+};
+const uint32_t ALPHA_224_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_224_FREQ[] = {
+  { "a", 0.12570000 },
+  { "b", 0.01170000 },
+  { "c", 0.03770000 },
+  { "d", 0.04930000 },
+  { "e", 0.11950000 },
+  { "f", 0.01040000 },
+  { "g", 0.01640000 },
+  { "h", 0.00900000 },
+  { "i", 0.06820000 },
+  { "j", 0.00260000 },
+  { "k", 0.00120000 },
+  { "l", 0.06000000 },
+  { "m", 0.02950000 },
+  { "n", 0.07640000 },
+  { "o", 0.05390000 },
+  { "p", 0.02570000 },
+  { "q", 0.00690000 },
+  { "r", 0.06610000 },
+  { "s", 0.07490000 },
+  { "t", 0.05990000 },
+  { "u", 0.04610000 },
+  { "v", 0.01160000 },
+  { "w", 0.00040000 },
+  { "x", 0.00230000 },
+  { "y", 0.00220000 },
+  { "z", 0.00180000 },
+  { "à", 0.00210000 },
+  { "á", 0.00080000 },
+  { "ç", 0.00150000 },
+  { "è", 0.01090000 },
+  { "é", 0.00720000 },
+  { "í", 0.00140000 },
+  { "ï", 0.00030000 },
+  { "ò", 0.00570000 },
+  { "ó", 0.00030000 },
+  { "ú", 0.00010000 },
+  { "ü", 0.00010000 },
+};
+
+const wa_cp_freq ALPHA_224_FREQ_CPS[] = {
+  { 0x61u, 0.12570000 },
+  { 0x62u, 0.01170000 },
+  { 0x63u, 0.03770000 },
+  { 0x64u, 0.04930000 },
+  { 0x65u, 0.11950000 },
+  { 0x66u, 0.01040000 },
+  { 0x67u, 0.01640000 },
+  { 0x68u, 0.00900000 },
+  { 0x69u, 0.06820000 },
+  { 0x6Au, 0.00260000 },
+  { 0x6Bu, 0.00120000 },
+  { 0x6Cu, 0.06000000 },
+  { 0x6Du, 0.02950000 },
+  { 0x6Eu, 0.07640000 },
+  { 0x6Fu, 0.05390000 },
+  { 0x70u, 0.02570000 },
+  { 0x71u, 0.00690000 },
+  { 0x72u, 0.06610000 },
+  { 0x73u, 0.07490000 },
+  { 0x74u, 0.05990000 },
+  { 0x75u, 0.04610000 },
+  { 0x76u, 0.01160000 },
+  { 0x77u, 0.00040000 },
+  { 0x78u, 0.00230000 },
+  { 0x79u, 0.00220000 },
+  { 0x7Au, 0.00180000 },
+  { 0xE0u, 0.00210000 },
+  { 0xE1u, 0.00080000 },
+  { 0xE7u, 0.00150000 },
+  { 0xE8u, 0.01090000 },
+  { 0xE9u, 0.00720000 },
+  { 0xEDu, 0.00140000 },
+  { 0xEFu, 0.00030000 },
+  { 0xF2u, 0.00570000 },
+  { 0xF3u, 0.00030000 },
+  { 0xFAu, 0.00010000 },
+  { 0xFCu, 0.00010000 },
+};
+
@@ -0,0 +1,129 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_225_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+};
+const char *ALPHA_225_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+};
+const char *ALPHA_225_DIGITS[] = {
+};
+const uint32_t ALPHA_225_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90,
+};
+const uint32_t ALPHA_225_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122,
+};
+const uint32_t ALPHA_225_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_225_FREQ[] = {
+  { "a", 0.21160000 },
+  { "b", 0.02840000 },
+  { "c", 0.01250000 },
+  { "d", 0.03380000 },
+  { "e", 0.07060000 },
+  { "f", 0.01980000 },
+  { "g", 0.02010000 },
+  { "h", 0.03120000 },
+  { "i", 0.09750000 },
+  { "j", 0.01070000 },
+  { "k", 0.03260000 },
+  { "l", 0.02900000 },
+  { "m", 0.03780000 },
+  { "n", 0.07050000 },
+  { "o", 0.05170000 },
+  { "p", 0.00710000 },
+  { "q", 0.00870000 },
+  { "r", 0.04790000 },
+  { "s", 0.04260000 },
+  { "t", 0.05690000 },
+  { "u", 0.04530000 },
+  { "v", 0.00230000 },
+  { "w", 0.00840000 },
+  { "x", 0.00190000 },
+  { "y", 0.01920000 },
+  { "z", 0.00170000 },
+};
+
+const wa_cp_freq ALPHA_225_FREQ_CPS[] = {
+  { 0x61u, 0.21160000 },
+  { 0x62u, 0.02840000 },
+  { 0x63u, 0.01250000 },
+  { 0x64u, 0.03380000 },
+  { 0x65u, 0.07060000 },
+  { 0x66u, 0.01980000 },
+  { 0x67u, 0.02010000 },
+  { 0x68u, 0.03120000 },
+  { 0x69u, 0.09750000 },
+  { 0x6Au, 0.01070000 },
+  { 0x6Bu, 0.03260000 },
+  { 0x6Cu, 0.02900000 },
+  { 0x6Du, 0.03780000 },
+  { 0x6Eu, 0.07050000 },
+  { 0x6Fu, 0.05170000 },
+  { 0x70u, 0.00710000 },
+  { 0x71u, 0.00870000 },
+  { 0x72u, 0.04790000 },
+  { 0x73u, 0.04260000 },
+  { 0x74u, 0.05690000 },
+  { 0x75u, 0.04530000 },
+  { 0x76u, 0.00230000 },
+  { 0x77u, 0.00840000 },
+  { 0x78u, 0.00190000 },
+  { 0x79u, 0.01920000 },
+  { 0x7Au, 0.00170000 },
+};
+
@@ -0,0 +1,215 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_226_UPPER[] = {
+  "ଅ",
+  "ଆ",
+  "ଇ",
+  "ଈ",
+  "ଉ",
+  "ଊ",
+  "ଋ",
+  "ଏ",
+  "ଐ",
+  "ଓ",
+  "ଔ",
+  "ଖ",
+  "ଗ",
+  "ଘ",
+  "ଙ",
+  "ଚ",
+  "ଛ",
+  "ଜ",
+  "ଝ",
+  "ଞ",
+  "ଟ",
+  "ଠ",
+  "ଡ",
+  "ଢ",
+  "ଣ",
+  "ତ",
+  "ଥ",
+  "ଦ",
+  "ଧ",
+  "ନ",
+  "ପ",
+  "ଫ",
+  "ବ",
+  "ଭ",
+  "ମ",
+  "ଯ",
+  "ର",
+  "ଲ",
+  "ଳ",
+  "ଶ",
+  "ସ",
+  "ହ",
+  "କ",
+  "ଵ",
+  "ୟ",
+  "ୱ",
+  "ଷ",
+};
+const char *ALPHA_226_LOWER[] = {
+  "ଅ",
+  "ଆ",
+  "ଇ",
+  "ଈ",
+  "ଉ",
+  "ଊ",
+  "ଋ",
+  "ଏ",
+  "ଐ",
+  "ଓ",
+  "ଔ",
+  "ଖ",
+  "ଗ",
+  "ଘ",
+  "ଙ",
+  "ଚ",
+  "ଛ",
+  "ଜ",
+  "ଝ",
+  "ଞ",
+  "ଟ",
+  "ଠ",
+  "ଡ",
+  "ଢ",
+  "ଣ",
+  "ତ",
+  "ଥ",
+  "ଦ",
+  "ଧ",
+  "ନ",
+  "ପ",
+  "ଫ",
+  "ବ",
+  "ଭ",
+  "ମ",
+  "ଯ",
+  "ର",
+  "ଲ",
+  "ଳ",
+  "ଶ",
+  "ସ",
+  "ହ",
+  "କ",
+  "ଵ",
+  "ୟ",
+  "ୱ",
+  "ଷ",
+};
+const char *ALPHA_226_DIGITS[] = {
+};
+const uint32_t ALPHA_226_UPPER_CPS[] = {
+  2821, 2822, 2823, 2824, 2825, 2826, 2827, 2831, 2832, 2835, 2836, 2837, 2838, 2839, 2840, 2841,
+  2842, 2843, 2844, 2845, 2846, 2847, 2848, 2849, 2850, 2851, 2852, 2853, 2854, 2855, 2856, 2858,
+  2859, 2860, 2861, 2862, 2863, 2864, 2866, 2867, 2869, 2870, 2871, 2872, 2873, 2911, 2929,
+};
+const uint32_t ALPHA_226_LOWER_CPS[] = {
+  2821, 2822, 2823, 2824, 2825, 2826, 2827, 2831, 2832, 2835, 2836, 2837, 2838, 2839, 2840, 2841,
+  2842, 2843, 2844, 2845, 2846, 2847, 2848, 2849, 2850, 2851, 2852, 2853, 2854, 2855, 2856, 2858,
+  2859, 2860, 2861, 2862, 2863, 2864, 2866, 2867, 2869, 2870, 2871, 2872, 2873, 2911, 2929,
+};
+const uint32_t ALPHA_226_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_226_FREQ[] = {
+  { "ଅ", 0.01560000 },
+  { "ଆ", 0.01340000 },
+  { "ଇ", 0.01680000 },
+  { "ଈ", 0.00020000 },
+  { "ଉ", 0.00810000 },
+  { "ଊ", 0.00000000 },
+  { "ଋ", 0.00020000 },
+  { "ଏ", 0.02160000 },
+  { "ଐ", 0.00010000 },
+  { "ଓ", 0.01000000 },
+  { "ଔ", 0.00030000 },
+  { "ଖ", 0.00750000 },
+  { "ଗ", 0.02390000 },
+  { "ଘ", 0.00190000 },
+  { "ଙ", 0.01210000 },
+  { "ଚ", 0.01300000 },
+  { "ଛ", 0.00610000 },
+  { "ଜ", 0.01810000 },
+  { "ଝ", 0.00080000 },
+  { "ଞ", 0.00290000 },
+  { "ଟ", 0.01410000 },
+  { "ଠ", 0.00570000 },
+  { "ଡ", 0.01280000 },
+  { "ଢ", 0.00120000 },
+  { "ଣ", 0.01990000 },
+  { "ତ", 0.05710000 },
+  { "ଥ", 0.02340000 },
+  { "ଦ", 0.02950000 },
+  { "ଧ", 0.01310000 },
+  { "ନ", 0.06090000 },
+  { "ପ", 0.04370000 },
+  { "ଫ", 0.00320000 },
+  { "ବ", 0.05510000 },
+  { "ଭ", 0.01450000 },
+  { "ମ", 0.04670000 },
+  { "ଯ", 0.01400000 },
+  { "ର", 0.14730000 },
+  { "ଲ", 0.02730000 },
+  { "ଳ", 0.01670000 },
+  { "ଶ", 0.01860000 },
+  { "ସ", 0.04650000 },
+  { "ହ", 0.03480000 },
+  { "କ", 0.07560000 },
+  { "ଵ", 0.00380000 },
+  { "ୟ", 0.02510000 },
+  { "ୱ", 0.00160000 },
+  { "ଷ", 0.01500000 },
+};
+
+const wa_cp_freq ALPHA_226_FREQ_CPS[] = {
+  { 0xB05u, 0.01560000 },
+  { 0xB06u, 0.01340000 },
+  { 0xB07u, 0.01680000 },
+  { 0xB08u, 0.00020000 },
+  { 0xB09u, 0.00810000 },
+  { 0xB0Au, 0.00000000 },
+  { 0xB0Bu, 0.00020000 },
+  { 0xB0Fu, 0.02160000 },
+  { 0xB10u, 0.00010000 },
+  { 0xB13u, 0.01000000 },
+  { 0xB14u, 0.00030000 },
+  { 0xB15u, 0.07560000 },
+  { 0xB16u, 0.00750000 },
+  { 0xB17u, 0.02390000 },
+  { 0xB18u, 0.00190000 },
+  { 0xB19u, 0.01210000 },
+  { 0xB1Au, 0.01300000 },
+  { 0xB1Bu, 0.00610000 },
+  { 0xB1Cu, 0.01810000 },
+  { 0xB1Du, 0.00080000 },
+  { 0xB1Eu, 0.00290000 },
+  { 0xB1Fu, 0.01410000 },
+  { 0xB20u, 0.00570000 },
+  { 0xB21u, 0.01280000 },
+  { 0xB22u, 0.00120000 },
+  { 0xB23u, 0.01990000 },
+  { 0xB24u, 0.05710000 },
+  { 0xB25u, 0.02340000 },
+  { 0xB26u, 0.02950000 },
+  { 0xB27u, 0.01310000 },
+  { 0xB28u, 0.06090000 },
+  { 0xB2Au, 0.04370000 },
+  { 0xB2Bu, 0.00320000 },
+  { 0xB2Cu, 0.05510000 },
+  { 0xB2Du, 0.01450000 },
+  { 0xB2Eu, 0.04670000 },
+  { 0xB2Fu, 0.01400000 },
+  { 0xB30u, 0.14730000 },
+  { 0xB32u, 0.02730000 },
+  { 0xB33u, 0.01670000 },
+  { 0xB35u, 0.00380000 },
+  { 0xB36u, 0.01860000 },
+  { 0xB37u, 0.01500000 },
+  { 0xB38u, 0.04650000 },
+  { 0xB39u, 0.03480000 },
+  { 0xB5Fu, 0.02510000 },
+  { 0xB71u, 0.00160000 },
+};
+
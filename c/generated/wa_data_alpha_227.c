@@ -0,0 +1,163 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_227_UPPER[] = {
+  "А",
+  "Ӕ",
+  "Б",
+  "В",
+  "Г",
+  "Д",
+  "Е",
+  "Ё",
+  "Ж",
+  "З",
+  "И",
+  "Й",
+  "К",
+  "Л",
+  "М",
+  "Н",
+  "О",
+  "П",
+  "Р",
+  "С",
+  "Т",
+  "У",
+  "Ф",
+  "Ъ",
+  "Ь",
+  "Х",
+  "Ц",
+  "Ч",
+  "Ш",
+  "Щ",
+  "Ы",
+  "Э",
+  "Ю",
+  "Я",
+};
+const char *ALPHA_227_LOWER[] = {
+  "а",
+  "ӕ",
+  "б",
+  "в",
+  "г",
+  "д",
+  "е",
+  "ё",
+  "ж",
+  "з",
+  "и",
+  "й",
+  "к",
+  "л",
+  "м",
+  "н",
+  "о",
+  "п",
+  "р",
+  "с",
+  "т",
+  "у",
+  "ф",
+  "ъ",
+  "ь",
+  "х",
+  "ц",
+  "ч",
+  "ш",
+  "щ",
+  "ы",
+  "э",
+  "ю",
+  "я",
+};
+const char *ALPHA_227_DIGITS[] = {
+};
+const uint32_t ALPHA_227_UPPER_CPS[] = {
+  1025, 1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053, 1054,
+  1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069, 1070,
+  1071, 1236,
+};
+const uint32_t ALPHA_227_LOWER_CPS[] = {
+  1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080, 1081, 1082, 1083, 1084, 1085, 1086, 1087,
+  1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103,
+  1105, 1237,
+};
+const uint32_t ALPHA_227_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_227_FREQ[] = {
+  { "а", 0.09890000 },
+  { "ӕ", 0.00000000 },
+  { "б", 0.01660000 },
+  { "в", 0.01320000 },
+  { "г", 0.03590000 },
+  { "д", 0.06160000 },
+  { "е", 0.02180000 },
+  { "ё", 0.00030000 },
+  { "ж", 0.00660000 },
+  { "з", 0.02560000 },
+  { "и", 0.04990000 },
+  { "й", 0.03430000 },
+  { "к", 0.02750000 },
+  { "л", 0.02740000 },
+  { "м", 0.04060000 },
+  { "н", 0.06480000 },
+  { "о", 0.04360000 },
+  { "п", 0.01070000 },
+  { "р", 0.06870000 },
+  { "с", 0.05480000 },
+  { "т", 0.06520000 },
+  { "у", 0.04650000 },
+  { "ф", 0.01510000 },
+  { "ъ", 0.01170000 },
+  { "ь", 0.00230000 },
+  { "х", 0.02850000 },
+  { "ц", 0.02030000 },
+  { "ч", 0.00320000 },
+  { "ш", 0.00150000 },
+  { "щ", 0.00010000 },
+  { "ы", 0.09820000 },
+  { "э", 0.00180000 },
+  { "ю", 0.00100000 },
+  { "я", 0.00170000 },
+};
+
+const wa_cp_freq ALPHA_227_FREQ_CPS[] = {
+  { 0x430u, 0.09890000 },
+  { 0x431u, 0.01660000 },
+  { 0x432u, 0.01320000 },
+  { 0x433u, 0.03590000 },
+  { 0x434u, 0.06160000 },
+  { 0x435u, 0.02180000 },
+  { 0x436u, 0.00660000 },
+  { 0x437u, 0.02560000 },
+  { 0x438u, 0.04990000 },
+  { 0x439u, 0.03430000 },
+  { 0x43Au, 0.02750000 },
+  { 0x43Bu, 0.02740000 },
+  { 0x43Cu, 0.04060000 },
+  { 0x43Du, 0.06480000 },
+  { 0x43Eu, 0.04360000 },
+  { 0x43Fu, 0.01070000 },
+  { 0x440u, 0.06870000 },
+  { 0x441u, 0.05480000 },
+  { 0x442u, 0.06520000 },
+  { 0x443u, 0.04650000 },
+  { 0x444u, 0.01510000 },
+  { 0x445u, 0.02850000 },
+  { 0x446u, 0.02030000 },
+  { 0x447u, 0.00320000 },
+  { 0x448u, 0.00150000 },
+  { 0x449u, 0.00010000 },
+  { 0x44Au, 0.01170000 },
+  { 0x44Bu, 0.09820000 },
+  { 0x44Cu, 0.00230000 },
+  { 0x44Du, 0.00180000 },
+  { 0x44Eu, 0.00100000 },
+  { 0x44Fu, 0.00170000 },
+  { 0x451u, 0.00030000 },
+  { 0x4D5u, 0.00000000 },
+};
+
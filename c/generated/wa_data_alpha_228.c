@@ -0,0 +1,181 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_228_UPPER[] = {
+  "𐒰",
+  "𐒱",
+  "𐒲",
+  "𐒳",
+  "𐒴",
+  "𐒵",
+  "𐒶",
+  "𐒷",
+  "𐒸",
+  "𐒹",
+  "𐒺",
+  "𐒻",
+  "𐒼",
+  "𐒽",
+  "𐒾",
+  "𐒿",
+  "𐓀",
+  "𐓁",
+  "𐓂",
+  "𐓃",
+  "𐓄",
+  "𐓅",
+  "𐓆",
+  "𐓇",
+  "𐓈",
+  "𐓉",
+  "𐓊",
+  "𐓋",
+  "𐓌",
+  "𐓍",
+  "𐓎",
+  "𐓏",
+  "𐓐",
+  "𐓑",
+  "𐓒",
+  "𐓓",
+};
+const char *ALPHA_228_LOWER[] = {
+  "𐓘",
+  "𐓙",
+  "𐓚",
+  "𐓛",
+  "𐓜",
+  "𐓝",
+  "𐓞",
+  "𐓟",
+  "𐓠",
+  "𐓡",
+  "𐓢",
+  "𐓣",
+  "𐓤",
+  "𐓥",
+  "𐓦",
+  "𐓧",
+  "𐓨",
+  "𐓩",
+  "𐓪",
+  "𐓫",
+  "𐓬",
+  "𐓭",
+  "𐓮",
+  "𐓯",
+  "𐓰",
+  "𐓱",
+  "𐓲",
+  "𐓳",
+  "𐓴",
+  "𐓵",
+  "𐓶",
+  "𐓷",
+  "𐓸",
+  "𐓹",
+  "𐓺",
+  "𐓻",
+};
+const char *ALPHA_228_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_228_UPPER_CPS[] = {
+  66736, 66737, 66738, 66739, 66740, 66741, 66742, 66743, 66744, 66745, 66746, 66747, 66748, 66749, 66750, 66751,
+  66752, 66753, 66754, 66755, 66756, 66757, 66758, 66759, 66760, 66761, 66762, 66763, 66764, 66765, 66766, 66767,
+  66768, 66769, 66770, 66771,
+};
+const uint32_t ALPHA_228_LOWER_CPS[] = {
+  66776, 66777, 66778, 66779, 66780, 66781, 66782, 66783, 66784, 66785, 66786, 66787, 66788, 66789, 66790, 66791,
+  66792, 66793, 66794, 66795, 66796, 66797, 66798, 66799, 66800, 66801, 66802, 66803, 66804, 66805, 66806, 66807,
+  66808, 66809, 66810, 66811,
+};
+const uint32_t ALPHA_228_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_228_FREQ[] = {
+  { "𐓘", 0.00000000 },
+  { "𐓙", 0.00000000 },
+  { "𐓚", 0.00000000 },
+  { "𐓛", 0.00000000 },
+  { "𐓜", 0.00000000 },
+  { "𐓝", 0.00000000 },
+  { "𐓞", 0.00000000 },
+  { "𐓟", 0.00000000 },
+  { "𐓠", 0.00000000 },
+  { "𐓡", 0.00000000 },
+  { "𐓢", 0.00000000 },
+  { "𐓣", 0.00000000 },
+  { "𐓤", 0.00000000 },
+  { "𐓥", 0.00000000 },
+  { "𐓦", 0.00000000 },
+  { "𐓧", 0.00000000 },
+  { "𐓨", 0.00000000 },
+  { "𐓩", 0.00000000 },
+  { "𐓪", 0.00000000 },
+  { "𐓫", 0.00000000 },
+  { "𐓬", 0.00000000 },
+  { "𐓭", 0.00000000 },
+  { "𐓮", 0.00000000 },
+  { "𐓯", 0.00000000 },
+  { "𐓰", 0.00000000 },
+  { "𐓱", 0.00000000 },
+  { "𐓲", 0.00000000 },
+  { "𐓳", 0.00000000 },
+  { "𐓴", 0.00000000 },
+  { "𐓵", 0.00000000 },
+  { "𐓶", 0.00000000 },
+  { "𐓷", 0.00000000 },
+  { "𐓸", 0.00000000 },
+  { "𐓹", 0.00000000 },
+  { "𐓺", 0.00000000 },
+  { "𐓻", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_228_FREQ_CPS[] = {
+  { 0x104D8u, 0.00000000 },
+  { 0x104D9u, 0.00000000 },
+  { 0x104DAu, 0.00000000 },
+  { 0x104DBu, 0.00000000 },
+  { 0x104DCu, 0.00000000 },
+  { 0x104DDu, 0.00000000 },
+  { 0x104DEu, 0.00000000 },
+  { 0x104DFu, 0.00000000 },
+  { 0x104E0u, 0.00000000 },
+  { 0x104E1u, 0.00000000 },
+  { 0x104E2u, 0.00000000 },
+  { 0x104E3u, 0.00000000 },
+  { 0x104E4u, 0.00000000 },
+  { 0x104E5u, 0.00000000 },
+  { 0x104E6u, 0.00000000 },
+  { 0x104E7u, 0.00000000 },
+  { 0x104E8u, 0.00000000 },
+  { 0x104E9u, 0.00000000 },
+  { 0x104EAu, 0.00000000 },
+  { 0x104EBu, 0.00000000 },
+  { 0x104ECu, 0.00000000 },
+  { 0x104EDu, 0.00000000 },
+  { 0x104EEu, 0.00000000 },
+  { 0x104EFu, 0.00000000 },
+  { 0x104F0u, 0.00000000 },
+  { 0x104F1u, 0.00000000 },
+  { 0x104F2u, 0.00000000 },
+  { 0x104F3u, 0.00000000 },
+  { 0x104F4u, 0.00000000 },
+  { 0x104F5u, 0.00000000 },
+  { 0x104F6u, 0.00000000 },
+  { 0x104F7u, 0.00000000 },
+  { 0x104F8u, 0.00000000 },
+  { 0x104F9u, 0.00000000 },
+  { 0x104FAu, 0.00000000 },
+  { 0x104FBu, 0.00000000 },
+};
+
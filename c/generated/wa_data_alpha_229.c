@@ -0,0 +1,207 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_229_UPPER[] = {
+  "ੳ",
+  "ਅ",
+  "ੲ",
+  "ਸ",
+  "ਹ",
+  "ਕ",
+  "ਖ",
+  "ਗ",
+  "ਘ",
+  "ਙ",
+  "ਚ",
+  "ਛ",
+  "ਜ",
+  "ਝ",
+  "ਞ",
+  "ਟ",
+  "ਠ",
+  "ਡ",
+  "ਢ",
+  "ਣ",
+  "ਤ",
+  "ਥ",
+  "ਦ",
+  "ਧ",
+  "ਨ",
+  "ਪ",
+  "ਫ",
+  "ਬ",
+  "ਭ",
+  "ਮ",
+  "ਯ",
+  "ਰ",
+  "ਲ",
+  "ਵ",
+  "ੜ",
+  "ਆ",
+  "ਇ",
+  "ਈ",
+  "ਉ",
+  "ਊ",
+  "ਏ",
+  "ਐ",
+  "ਓ",
+  "ਔ",
+  "ੴ",
+};
+const char *ALPHA_229_LOWER[] = {
+  "ੳ",
+  "ਅ",
+  "ੲ",
+  "ਸ",
+  "ਹ",
+  "ਕ",
+  "ਖ",
+  "ਗ",
+  "ਘ",
+  "ਙ",
+  "ਚ",
+  "ਛ",
+  "ਜ",
+  "ਝ",
+  "ਞ",
+  "ਟ",
+  "ਠ",
+  "ਡ",
+  "ਢ",
+  "ਣ",
+  "ਤ",
+  "ਥ",
+  "ਦ",
+  "ਧ",
+  "ਨ",
+  "ਪ",
+  "ਫ",
+  "ਬ",
+  "ਭ",
+  "ਮ",
+  "ਯ",
+  "ਰ",
+  "ਲ",
+  "ਵ",
+  "ੜ",
+  "ਆ",
+  "ਇ",
+  "ਈ",
+  "ਉ",
+  "ਊ",
+  "ਏ",
+  "ਐ",
+  "ਓ",
+  "ਔ",
+  "ੴ",
+};
+const char *ALPHA_229_DIGITS[] = {
+};
+const uint32_t ALPHA_229_UPPER_CPS[] = {
+  2565, 2566, 2567, 2568, 2569, 2570, 2575, 2576, 2579, 2580, 2581, 2582, 2583, 2584, 2585, 2586,
+  2587, 2588, 2589, 2590, 2591, 2592, 2593, 2594, 2595, 2596, 2597, 2598, 2599, 2600, 2602, 2603,
+  2604, 2605, 2606, 2607, 2608, 2610, 2613, 2616, 2617, 2652, 2674, 2675, 2676,
+};
+const uint32_t ALPHA_229_LOWER_CPS[] = {
+  2565, 2566, 2567, 2568, 2569, 2570, 2575, 2576, 2579, 2580, 2581, 2582, 2583, 2584, 2585, 2586,
+  2587, 2588, 2589, 2590, 2591, 2592, 2593, 2594, 2595, 2596, 2597, 2598, 2599, 2600, 2602, 2603,
+  2604, 2605, 2606, 2607, 2608, 2610, 2613, 2616, 2617, 2652, 2674, 2675, 2676,
+};
+const uint32_t ALPHA_229_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_229_FREQ[] = {
+  { "ੳ", 0.00000000 },
+  { "ਅ", 0.02250000 },
+  { "ੲ", 0.00000000 },
+  { "ਸ", 0.08320000 },
+  { "ਹ", 0.06260000 },
+  { "ਕ", 0.06140000 },
+  { "ਖ", 0.01310000 },
+  { "ਗ", 0.02610000 },
+  { "ਘ", 0.00430000 },
+  { "ਙ", 0.00000000 },
+  { "ਚ", 0.02420000 },
+  { "ਛ", 0.00220000 },
+  { "ਜ", 0.03600000 },
+  { "ਝ", 0.00170000 },
+  { "ਞ", 0.00000000 },
+  { "ਟ", 0.01200000 },
+  { "ਠ", 0.00160000 },
+  { "ਡ", 0.00870000 },
+  { "ਢ", 0.00080000 },
+  { "ਣ", 0.01500000 },
+  { "ਤ", 0.06200000 },
+  { "ਥ", 0.00700000 },
+  { "ਦ", 0.07690000 },
+  { "ਧ", 0.00750000 },
+  { "ਨ", 0.06550000 },
+  { "ਪ", 0.03470000 },
+  { "ਫ", 0.00670000 },
+  { "ਬ", 0.02450000 },
+  { "ਭ", 0.00910000 },
+  { "ਮ", 0.03730000 },
+  { "ਯ", 0.00440000 },
+  { "ਰ", 0.09590000 },
+  { "ਲ", 0.05190000 },
+  { "ਵ", 0.04930000 },
+  { "ੜ", 0.00500000 },
+  { "ਆ", 0.03030000 },
+  { "ਇ", 0.02430000 },
+  { "ਈ", 0.00990000 },
+  { "ਉ", 0.01380000 },
+  { "ਊ", 0.00100000 },
+  { "ਏ", 0.00510000 },
+  { "ਐ", 0.00100000 },
+  { "ਓ", 0.00090000 },
+  { "ਔ", 0.00040000 },
+  { "ੴ", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_229_FREQ_CPS[] = {
+  { 0xA05u, 0.02250000 },
+  { 0xA06u, 0.03030000 },
+  { 0xA07u, 0.02430000 },
+  { 0xA08u, 0.00990000 },
+  { 0xA09u, 0.01380000 },
+  { 0xA0Au, 0.00100000 },
+  { 0xA0Fu, 0.00510000 },
+  { 0xA10u, 0.00100000 },
+  { 0xA13u, 0.00090000 },
+  { 0xA14u, 0.00040000 },
+  { 0xA15u, 0.06140000 },
+  { 0xA16u, 0.01310000 },
+  { 0xA17u, 0.02610000 },
+  { 0xA18u, 0.00430000 },
+  { 0xA19u, 0.00000000 },
+  { 0xA1Au, 0.02420000 },
+  { 0xA1Bu, 0.00220000 },
+  { 0xA1Cu, 0.03600000 },
+  { 0xA1Du, 0.00170000 },
+  { 0xA1Eu, 0.00000000 },
+  { 0xA1Fu, 0.01200000 },
+  { 0xA20u, 0.00160000 },
+  { 0xA21u, 0.00870000 },
+  { 0xA22u, 0.00080000 },
+  { 0xA23u, 0.01500000 },
+  { 0xA24u, 0.06200000 },
+  { 0xA25u, 0.00700000 },
+  { 0xA26u, 0.07690000 },
+  { 0xA27u, 0.00750000 },
+  { 0xA28u, 0.06550000 },
+  { 0xA2Au, 0.03470000 },
+  { 0xA2Bu, 0.00670000 },
+  { 0xA2Cu, 0.02450000 },
+  { 0xA2Du, 0.00910000 },
+  { 0xA2Eu, 0.03730000 },
+  { 0xA2Fu, 0.00440000 },
+  { 0xA30u, 0.09590000 },
+  { 0xA32u, 0.05190000 },
+  { 0xA35u, 0.04930000 },
+  { 0xA38u, 0.08320000 },
+  { 0xA39u, 0.06260000 },
+  { 0xA5Cu, 0.00500000 },
+  { 0xA72u, 0.00000000 },
+  { 0xA73u, 0.00000000 },
+  { 0xA74u, 0.00000000 },
+};
+
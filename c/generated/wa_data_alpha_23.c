@@ -0,0 +1,153 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_23_UPPER[] = {
+  "А",
+  "Б",
+  "В",
+  "Г",
+  "Д",
+  "Е",
+  "Ё",
+  "Ж",
+  "З",
+  "І",
+  "Й",
+  "К",
+  "Л",
+  "М",
+  "Н",
+  "О",
+  "П",
+  "Р",
+  "С",
+  "Т",
+  "У",
+  "Ў",
+  "Ф",
+  "Х",
+  "Ц",
+  "Ч",
+  "Ш",
+  "Ы",
+  "Ь",
+  "Э",
+  "Ю",
+  "Я",
+};
+const char *ALPHA_23_LOWER[] = {
+  "а",
+  "б",
+  "в",
+  "г",
+  "д",
+  "е",
+  "ё",
+  "ж",
+  "з",
+  "і",
+  "й",
+  "к",
+  "л",
+  "м",
+  "н",
+  "о",
+  "п",
+  "р",
+  "с",
+  "т",
+  "у",
+  "ў",
+  "ф",
+  "х",
+  "ц",
+  "ч",
+  "ш",
+  "ы",
+  "ь",
+  "э",
+  "ю",
+  "я",
+};
+const char *ALPHA_23_DIGITS[] = {
+};
+const uint32_t ALPHA_23_UPPER_CPS[] = {
+  1025, 1030, 1038, 1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 1049, 1050, 1051, 1052, 1053,
+  1054, 1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1067, 1068, 1069, 1070, 1071,
+};
+const uint32_t ALPHA_23_LOWER_CPS[] = {
+  1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079, 1081, 1082, 1083, 1084, 1085, 1086, 1087, 1088,
+  1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 1099, 1100, 1101, 1102, 1103, 1105, 1110, 1118,
+};
+const uint32_t ALPHA_23_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_23_FREQ[] = {
+  { "ш", 0.00860000 },
+  { "р", 0.04970000 },
+  { "б", 0.01590000 },
+  { "ф", 0.00350000 },
+  { "н", 0.06640000 },
+  { "ц", 0.02170000 },
+  { "ы", 0.04300000 },
+  { "о", 0.03150000 },
+  { "п", 0.02670000 },
+  { "ў", 0.02430000 },
+  { "л", 0.03960000 },
+  { "й", 0.01250000 },
+  { "ч", 0.01330000 },
+  { "ю", 0.00530000 },
+  { "з", 0.02570000 },
+  { "к", 0.04240000 },
+  { "г", 0.02130000 },
+  { "я", 0.03350000 },
+  { "ж", 0.00560000 },
+  { "х", 0.01030000 },
+  { "е", 0.03340000 },
+  { "у", 0.03080000 },
+  { "в", 0.03200000 },
+  { "і", 0.05230000 },
+  { "м", 0.03000000 },
+  { "ь", 0.02250000 },
+  { "с", 0.04760000 },
+  { "т", 0.03440000 },
+  { "д", 0.03370000 },
+  { "э", 0.01680000 },
+  { "ё", 0.00450000 },
+  { "а", 0.16100000 },
+};
+
+const wa_cp_freq ALPHA_23_FREQ_CPS[] = {
+  { 0x430u, 0.16100000 },
+  { 0x431u, 0.01590000 },
+  { 0x432u, 0.03200000 },
+  { 0x433u, 0.02130000 },
+  { 0x434u, 0.03370000 },
+  { 0x435u, 0.03340000 },
+  { 0x436u, 0.00560000 },
+  { 0x437u, 0.02570000 },
+  { 0x439u, 0.01250000 },
+  { 0x43Au, 0.04240000 },
+  { 0x43Bu, 0.03960000 },
+  { 0x43Cu, 0.03000000 },
+  { 0x43Du, 0.06640000 },
+  { 0x43Eu, 0.03150000 },
+  { 0x43Fu, 0.02670000 },
+  { 0x440u, 0.04970000 },
+  { 0x441u, 0.04760000 },
+  { 0x442u, 0.03440000 },
+  { 0x443u, 0.03080000 },
+  { 0x444u, 0.00350000 },
+  { 0x445u, 0.01030000 },
+  { 0x446u, 0.02170000 },
+  { 0x447u, 0.01330000 },
+  { 0x448u, 0.00860000 },
+  { 0x44Bu, 0.04300000 },
+  { 0x44Cu, 0.02250000 },
+  { 0x44Du, 0.01680000 },
+  { 0x44Eu, 0.00530000 },
+  { 0x44Fu, 0.03350000 },
+  { 0x451u, 0.00450000 },
+  { 0x456u, 0.05230000 },
+  { 0x45Eu, 0.02430000 },
+};
+
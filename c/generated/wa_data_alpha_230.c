@@ -0,0 +1,159 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_230_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "È",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "Ñ",
+  "O",
+  "Ò",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "Ù",
+  "Ü",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+};
+const char *ALPHA_230_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "è",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "ñ",
+  "o",
+  "ò",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "ù",
+  "ü",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+};
+const char *ALPHA_230_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_230_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 200, 209, 210, 217, 220,
+};
+const uint32_t ALPHA_230_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 232, 241, 242, 249, 252,
+};
+const uint32_t ALPHA_230_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_230_FREQ[] = {
+  { "a", 0.14920000 },
+  { "b", 0.02710000 },
+  { "c", 0.01430000 },
+  { "d", 0.04800000 },
+  { "e", 0.09260000 },
+  { "è", 0.00210000 },
+  { "f", 0.00880000 },
+  { "g", 0.01140000 },
+  { "h", 0.01660000 },
+  { "i", 0.09440000 },
+  { "j", 0.00250000 },
+  { "k", 0.03110000 },
+  { "l", 0.02950000 },
+  { "m", 0.03320000 },
+  { "n", 0.08930000 },
+  { "ñ", 0.00250000 },
+  { "o", 0.07150000 },
+  { "ò", 0.00230000 },
+  { "p", 0.02780000 },
+  { "q", 0.00030000 },
+  { "r", 0.06060000 },
+  { "s", 0.05580000 },
+  { "t", 0.06170000 },
+  { "u", 0.04740000 },
+  { "ù", 0.00080000 },
+  { "ü", 0.00130000 },
+  { "v", 0.00500000 },
+  { "w", 0.00400000 },
+  { "x", 0.00060000 },
+  { "y", 0.00680000 },
+  { "z", 0.00150000 },
+};
+
+const wa_cp_freq ALPHA_230_FREQ_CPS[] = {
+  { 0x61u, 0.14920000 },
+  { 0x62u, 0.02710000 },
+  { 0x63u, 0.01430000 },
+  { 0x64u, 0.04800000 },
+  { 0x65u, 0.09260000 },
+  { 0x66u, 0.00880000 },
+  { 0x67u, 0.01140000 },
+  { 0x68u, 0.01660000 },
+  { 0x69u, 0.09440000 },
+  { 0x6Au, 0.00250000 },
+  { 0x6Bu, 0.03110000 },
+  { 0x6Cu, 0.02950000 },
+  { 0x6Du, 0.03320000 },
+  { 0x6Eu, 0.08930000 },
+  { 0x6Fu, 0.07150000 },
+  { 0x70u, 0.02780000 },
+  { 0x71u, 0.00030000 },
+  { 0x72u, 0.06060000 },
+  { 0x73u, 0.05580000 },
+  { 0x74u, 0.06170000 },
+  { 0x75u, 0.04740000 },
+  { 0x76u, 0.00500000 },
+  { 0x77u, 0.00400000 },
+  { 0x78u, 0.00060000 },
+  { 0x79u, 0.00680000 },
+  { 0x7Au, 0.00150000 },
+  { 0xE8u, 0.00210000 },
+  { 0xF1u, 0.00250000 },
+  { 0xF2u, 0.00230000 },
+  { 0xF9u, 0.00080000 },
+  { 0xFCu, 0.00130000 },
+};
+
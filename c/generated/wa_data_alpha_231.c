@@ -0,0 +1,159 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_231_UPPER[] = {
+  "A",
+  "Á",
+  "B",
+  "C",
+  "H",
+  "D",
+  "E",
+  "É",
+  "Ẹ",
+  "F",
+  "G",
+  "I",
+  "Í",
+  "J",
+  "K",
+  "P",
+  "L",
+  "M",
+  "N",
+  "O",
+  "Ó",
+  "Ọ",
+  "R",
+  "S",
+  "T",
+  "U",
+  "Ú",
+  "V",
+  "W",
+  "Y",
+  "Z",
+};
+const char *ALPHA_231_LOWER[] = {
+  "a",
+  "á",
+  "b",
+  "c",
+  "h",
+  "d",
+  "e",
+  "é",
+  "ẹ",
+  "f",
+  "g",
+  "i",
+  "í",
+  "j",
+  "k",
+  "p",
+  "l",
+  "m",
+  "n",
+  "o",
+  "ó",
+  "ọ",
+  "r",
+  "s",
+  "t",
+  "u",
+  "ú",
+  "v",
+  "w",
+  "y",
+  "z",
+};
+const char *ALPHA_231_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_231_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  82, 83, 84, 85, 86, 87, 89, 90, 193, 201, 205, 211, 218, 7864, 7884,
+};
+const uint32_t ALPHA_231_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  114, 115, 116, 117, 118, 119, 121, 122, 225, 233, 237, 243, 250, 7865, 7885,
+};
+const uint32_t ALPHA_231_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_231_FREQ[] = {
+  { "a", 0.00000000 },
+  { "á", 0.00000000 },
+  { "b", 0.00000000 },
+  { "c", 0.00000000 },
+  { "h", 0.00000000 },
+  { "d", 0.00000000 },
+  { "e", 0.00000000 },
+  { "é", 0.00000000 },
+  { "ẹ", 0.00000000 },
+  { "f", 0.00000000 },
+  { "g", 0.00000000 },
+  { "i", 0.00000000 },
+  { "í", 0.00000000 },
+  { "j", 0.00000000 },
+  { "k", 0.00000000 },
+  { "p", 0.00000000 },
+  { "l", 0.00000000 },
+  { "m", 0.00000000 },
+  { "n", 0.00000000 },
+  { "o", 0.00000000 },
+  { "ó", 0.00000000 },
+  { "ọ", 0.00000000 },
+  { "r", 0.00000000 },
+  { "s", 0.00000000 },
+  { "t", 0.00000000 },
+  { "u", 0.00000000 },
+  { "ú", 0.00000000 },
+  { "v", 0.00000000 },
+  { "w", 0.00000000 },
+  { "y", 0.00000000 },
+  { "z", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_231_FREQ_CPS[] = {
+  { 0x61u, 0.00000000 },
+  { 0x62u, 0.00000000 },
+  { 0x63u, 0.00000000 },
+  { 0x64u, 0.00000000 },
+  { 0x65u, 0.00000000 },
+  { 0x66u, 0.00000000 },
+  { 0x67u, 0.00000000 },
+  { 0x68u, 0.00000000 },
+  { 0x69u, 0.00000000 },
+  { 0x6Au, 0.00000000 },
+  { 0x6Bu, 0.00000000 },
+  { 0x6Cu, 0.00000000 },
+  { 0x6Du, 0.00000000 },
+  { 0x6Eu, 0.00000000 },
+  { 0x6Fu, 0.00000000 },
+  { 0x70u, 0.00000000 },
+  { 0x72u, 0.00000000 },
+  { 0x73u, 0.00000000 },
+  { 0x74u, 0.00000000 },
+  { 0x75u, 0.00000000 },
+  { 0x76u, 0.00000000 },
+  { 0x77u, 0.00000000 },
+  { 0x79u, 0.00000000 },
+  { 0x7Au, 0.00000000 },
+  { 0xE1u, 0.00000000 },
+  { 0xE9u, 0.00000000 },
+  { 0xEDu, 0.00000000 },
+  { 0xF3u, 0.00000000 },
+  { 0xFAu, 0.00000000 },
+  { 0x1EB9u, 0.00000000 },
+  { 0x1ECDu, 0.00000000 },
+};
+
@@ -0,0 +1,163 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_233_UPPER[] = {
+  "A",
+  "Ą",
+  "B",
+  "C",
+  "Ć",
+  "D",
+  "E",
+  "Ę",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "Ł",
+  "M",
+  "N",
+  "Ń",
+  "O",
+  "Ó",
+  "P",
+  "R",
+  "S",
+  "Ś",
+  "T",
+  "U",
+  "W",
+  "Y",
+  "Z",
+  "Ź",
+  "Ż",
+};
+const char *ALPHA_233_LOWER[] = {
+  "a",
+  "ą",
+  "b",
+  "c",
+  "ć",
+  "d",
+  "e",
+  "ę",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "ł",
+  "m",
+  "n",
+  "ń",
+  "o",
+  "ó",
+  "p",
+  "r",
+  "s",
+  "ś",
+  "t",
+  "u",
+  "w",
+  "y",
+  "z",
+  "ź",
+  "ż",
+};
+const char *ALPHA_233_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_233_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  82, 83, 84, 85, 87, 89, 90, 211, 260, 262, 280, 321, 323, 346, 377, 379,
+};
+const uint32_t ALPHA_233_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  114, 115, 116, 117, 119, 121, 122, 243, 261, 263, 281, 322, 324, 347, 378, 380,
+};
+const uint32_t ALPHA_233_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_233_FREQ[] = {
+  { "a", 0.09060000 },
+  { "ą", 0.00880000 },
+  { "b", 0.01370000 },
+  { "c", 0.03970000 },
+  { "ć", 0.00210000 },
+  { "d", 0.03200000 },
+  { "e", 0.07550000 },
+  { "ę", 0.00870000 },
+  { "f", 0.00450000 },
+  { "g", 0.01620000 },
+  { "h", 0.01300000 },
+  { "i", 0.08190000 },
+  { "j", 0.02220000 },
+  { "k", 0.03560000 },
+  { "l", 0.02470000 },
+  { "ł", 0.01790000 },
+  { "m", 0.02770000 },
+  { "n", 0.05770000 },
+  { "ń", 0.00220000 },
+  { "o", 0.07890000 },
+  { "ó", 0.00860000 },
+  { "p", 0.02880000 },
+  { "r", 0.05220000 },
+  { "s", 0.04500000 },
+  { "ś", 0.00550000 },
+  { "t", 0.03930000 },
+  { "u", 0.02630000 },
+  { "w", 0.04920000 },
+  { "y", 0.03550000 },
+  { "z", 0.04950000 },
+  { "ź", 0.00070000 },
+  { "ż", 0.00600000 },
+};
+
+const wa_cp_freq ALPHA_233_FREQ_CPS[] = {
+  { 0x61u, 0.09060000 },
+  { 0x62u, 0.01370000 },
+  { 0x63u, 0.03970000 },
+  { 0x64u, 0.03200000 },
+  { 0x65u, 0.07550000 },
+  { 0x66u, 0.00450000 },
+  { 0x67u, 0.01620000 },
+  { 0x68u, 0.01300000 },
+  { 0x69u, 0.08190000 },
+  { 0x6Au, 0.02220000 },
+  { 0x6Bu, 0.03560000 },
+  { 0x6Cu, 0.02470000 },
+  { 0x6Du, 0.02770000 },
+  { 0x6Eu, 0.05770000 },
+  { 0x6Fu, 0.07890000 },
+  { 0x70u, 0.02880000 },
+  { 0x72u, 0.05220000 },
+  { 0x73u, 0.04500000 },
+  { 0x74u, 0.03930000 },
+  { 0x75u, 0.02630000 },
+  { 0x77u, 0.04920000 },
+  { 0x79u, 0.03550000 },
+  { 0x7Au, 0.04950000 },
+  { 0xF3u, 0.00860000 },
+  { 0x105u, 0.00880000 },
+  { 0x107u, 0.00210000 },
+  { 0x119u, 0.00870000 },
+  { 0x142u, 0.01790000 },
+  { 0x144u, 0.00220000 },
+  { 0x15Bu, 0.00550000 },
+  { 0x17Au, 0.00070000 },
+  { 0x17Cu, 0.00600000 },
+};
+
@@ -0,0 +1,193 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_234_UPPER[] = {
+  "A",
+  "Ā",
+  "B",
+  "C",
+  "D",
+  "Ḑ",
+  "E",
+  "Ē",
+  "F",
+  "G",
+  "Ģ",
+  "H",
+  "I",
+  "Ī",
+  "J",
+  "K",
+  "Ķ",
+  "L",
+  "M",
+  "N",
+  "Ņ",
+  "O",
+  "Ō",
+  "P",
+  "Q",
+  "R",
+  "Ŗ",
+  "S",
+  "Š",
+  "T",
+  "Ț",
+  "U",
+  "Ū",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+  "Ž",
+};
+const char *ALPHA_234_LOWER[] = {
+  "a",
+  "ā",
+  "b",
+  "c",
+  "d",
+  "ḑ",
+  "e",
+  "ē",
+  "f",
+  "g",
+  "ģ",
+  "h",
+  "i",
+  "ī",
+  "j",
+  "k",
+  "ķ",
+  "l",
+  "m",
+  "n",
+  "ņ",
+  "o",
+  "ō",
+  "p",
+  "q",
+  "r",
+  "ŗ",
+  "s",
+  "š",
+  "t",
+  "ț",
+  "u",
+  "ū",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+  "ž",
+};
+const char *ALPHA_234_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_234_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 256, 274, 290, 298, 310, 325,
+  332, 342, 352, 362, 381, 538, 7696,
+};
+const uint32_t ALPHA_234_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 257, 275, 291, 299, 311, 326,
+  333, 343, 353, 363, 382, 539, 7697,
+};
+const uint32_t ALPHA_234_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_234_FREQ[] = {
+  { "a", 0.00000000 },
+  { "ā", 0.00000000 },
+  { "b", 0.00000000 },
+  { "c", 0.00000000 },
+  { "d", 0.00000000 },
+  { "ḑ", 0.00000000 },
+  { "e", 0.00000000 },
+  { "ē", 0.00000000 },
+  { "f", 0.00000000 },
+  { "g", 0.00000000 },
+  { "ģ", 0.00000000 },
+  { "h", 0.00000000 },
+  { "i", 0.00000000 },
+  { "ī", 0.00000000 },
+  { "j", 0.00000000 },
+  { "k", 0.00000000 },
+  { "ķ", 0.00000000 },
+  { "l", 0.00000000 },
+  { "m", 0.00000000 },
+  { "n", 0.00000000 },
+  { "ņ", 0.00000000 },
+  { "o", 0.00000000 },
+  { "ō", 0.00000000 },
+  { "p", 0.00000000 },
+  { "q", 0.00000000 },
+  { "r", 0.00000000 },
+  { "ŗ", 0.00000000 },
+  { "s", 0.00000000 },
+  { "š", 0.00000000 },
+  { "t", 0.00000000 },
+  { "ț", 0.00000000 },
+  { "u", 0.00000000 },
+  { "ū", 0.00000000 },
+  { "v", 0.00000000 },
+  { "w", 0.00000000 },
+  { "x", 0.00000000 },
+  { "y", 0.00000000 },
+  { "z", 0.00000000 },
+  { "ž", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_234_FREQ_CPS[] = {
+  { 0x61u, 0.00000000 },
+  { 0x62u, 0.00000000 },
+  { 0x63u, 0.00000000 },
+  { 0x64u, 0.00000000 },
+  { 0x65u, 0.00000000 },
+  { 0x66u, 0.00000000 },
+  { 0x67u, 0.00000000 },
+  { 0x68u, 0.00000000 },
+  { 0x69u, 0.00000000 },
+  { 0x6Au, 0.00000000 },
+  { 0x6Bu, 0.00000000 },
+  { 0x6Cu, 0.00000000 },
+  { 0x6Du, 0.00000000 },
+  { 0x6Eu, 0.00000000 },
+  { 0x6Fu, 0.00000000 },
+  { 0x70u, 0.00000000 },
+  { 0x71u, 0.00000000 },
+  { 0x72u, 0.00000000 },
+  { 0x73u, 0.00000000 },
+  { 0x74u, 0.00000000 },
+  { 0x75u, 0.00000000 },
+  { 0x76u, 0.00000000 },
+  { 0x77u, 0.00000000 },
+  { 0x78u, 0.00000000 },
+  { 0x79u, 0.00000000 },
+  { 0x7Au, 0.00000000 },
+  { 0x101u, 0.00000000 },
+  { 0x113u, 0.00000000 },
+  { 0x123u, 0.00000000 },
+  { 0x12Bu, 0.00000000 },
+  { 0x137u, 0.00000000 },
+  { 0x146u, 0.00000000 },
+  { 0x14Du, 0.00000000 },
+  { 0x157u, 0.00000000 },
+  { 0x161u, 0.00000000 },
+  { 0x16Bu, 0.00000000 },
+  { 0x17Eu, 0.00000000 },
+  { 0x21Bu, 0.00000000 },
+  { 0x1E11u, 0.00000000 },
+};
+
@@ -0,0 +1,229 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_235_UPPER[] = {
+  "آ",
+  "ا",
+  "ء",
+  "ب",
+  "پ",
+  "ت",
+  "ټ",
+  "ث",
+  "ج",
+  "ځ",
+  "چ",
+  "څ",
+  "ح",
+  "خ",
+  "د",
+  "ډ",
+  "ذ",
+  "ر",
+  "ړ",
+  "ز",
+  "ژ",
+  "ږ",
+  "س",
+  "ش",
+  "ښ",
+  "ص",
+  "ض",
+  "ط",
+  "ظ",
+  "ع",
+  "غ",
+  "ف",
+  "ق",
+  "ک",
+  "ګ",
+  "ل",
+  "م",
+  "ن",
+  "ڼ",
+  "ه",
+  "و",
+  "ی",
+  "أ",
+  "ؤ",
+  "ئ",
+  "ة",
+  "ي",
+  "گ",
+  "ۍ",
+  "ې",
+};
+const char *ALPHA_235_LOWER[] = {
+  "آ",
+  "ا",
+  "ء",
+  "ب",
+  "پ",
+  "ت",
+  "ټ",
+  "ث",
+  "ج",
+  "ځ",
+  "چ",
+  "څ",
+  "ح",
+  "خ",
+  "د",
+  "ډ",
+  "ذ",
+  "ر",
+  "ړ",
+  "ز",
+  "ژ",
+  "ږ",
+  "س",
+  "ش",
+  "ښ",
+  "ص",
+  "ض",
+  "ط",
+  "ظ",
+  "ع",
+  "غ",
+  "ف",
+  "ق",
+  "ک",
+  "ګ",
+  "ل",
+  "م",
+  "ن",
+  "ڼ",
+  "ه",
+  "و",
+  "ی",
+  "أ",
+  "ؤ",
+  "ئ",
+  "ة",
+  "ي",
+  "گ",
+  "ۍ",
+  "ې",
+};
+const char *ALPHA_235_DIGITS[] = {
+};
+const uint32_t ALPHA_235_UPPER_CPS[] = {
+  1569, 1570, 1571, 1572, 1574, 1575, 1576, 1577, 1578, 1579, 1580, 1581, 1582, 1583, 1584, 1585,
+  1586, 1587, 1588, 1589, 1590, 1591, 1592, 1593, 1594, 1601, 1602, 1604, 1605, 1606, 1607, 1608,
+  1610, 1660, 1662, 1665, 1669, 1670, 1673, 1683, 1686, 1688, 1690, 1705, 1707, 1711, 1724, 1740,
+  1741, 1744,
+};
+const uint32_t ALPHA_235_LOWER_CPS[] = {
+  1569, 1570, 1571, 1572, 1574, 1575, 1576, 1577, 1578, 1579, 1580, 1581, 1582, 1583, 1584, 1585,
+  1586, 1587, 1588, 1589, 1590, 1591, 1592, 1593, 1594, 1601, 1602, 1604, 1605, 1606, 1607, 1608,
+  1610, 1660, 1662, 1665, 1669, 1670, 1673, 1683, 1686, 1688, 1690, 1705, 1707, 1711, 1724, 1740,
+  1741, 1744,
+};
+const uint32_t ALPHA_235_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_235_FREQ[] = {
+  { "آ", 0.00090000 },
+  { "ا", 0.10020000 },
+  { "ء", 0.00010000 },
+  { "ب", 0.02000000 },
+  { "پ", 0.03210000 },
+  { "ت", 0.03490000 },
+  { "ټ", 0.00560000 },
+  { "ث", 0.00090000 },
+  { "ج", 0.00580000 },
+  { "ځ", 0.00600000 },
+  { "چ", 0.00910000 },
+  { "څ", 0.00480000 },
+  { "ح", 0.00540000 },
+  { "خ", 0.01610000 },
+  { "د", 0.06530000 },
+  { "ډ", 0.00480000 },
+  { "ذ", 0.00050000 },
+  { "ر", 0.05950000 },
+  { "ړ", 0.01230000 },
+  { "ز", 0.01030000 },
+  { "ژ", 0.00220000 },
+  { "ږ", 0.00390000 },
+  { "س", 0.02750000 },
+  { "ش", 0.01230000 },
+  { "ښ", 0.00570000 },
+  { "ص", 0.00250000 },
+  { "ض", 0.00120000 },
+  { "ط", 0.00190000 },
+  { "ظ", 0.00080000 },
+  { "ع", 0.00650000 },
+  { "غ", 0.01010000 },
+  { "ف", 0.00650000 },
+  { "ق", 0.00450000 },
+  { "ک", 0.02890000 },
+  { "ګ", 0.00850000 },
+  { "ل", 0.05870000 },
+  { "م", 0.03920000 },
+  { "ن", 0.05570000 },
+  { "ڼ", 0.00110000 },
+  { "ه", 0.07820000 },
+  { "و", 0.11400000 },
+  { "ی", 0.02240000 },
+  { "أ", 0.00010000 },
+  { "ؤ", 0.00040000 },
+  { "ئ", 0.00070000 },
+  { "ة", 0.00010000 },
+  { "ي", 0.06420000 },
+  { "گ", 0.00070000 },
+  { "ۍ", 0.00350000 },
+  { "ې", 0.04330000 },
+};
+
+const wa_cp_freq ALPHA_235_FREQ_CPS[] = {
+  { 0x621u, 0.00010000 },
+  { 0x622u, 0.00090000 },
+  { 0x623u, 0.00010000 },
+  { 0x624u, 0.00040000 },
+  { 0x626u, 0.00070000 },
+  { 0x627u, 0.10020000 },
+  { 0x628u, 0.02000000 },
+  { 0x629u, 0.00010000 },
+  { 0x62Au, 0.03490000 },
+  { 0x62Bu, 0.00090000 },
+  { 0x62Cu, 0.00580000 },
+  { 0x62Du, 0.00540000 },
+  { 0x62Eu, 0.01610000 },
+  { 0x62Fu, 0.06530000 },
+  { 0x630u, 0.00050000 },
+  { 0x631u, 0.05950000 },
+  { 0x632u, 0.01030000 },
+  { 0x633u, 0.02750000 },
+  { 0x634u, 0.01230000 },
+  { 0x635u, 0.00250000 },
+  { 0x636u, 0.00120000 },
+  { 0x637u, 0.00190000 },
+  { 0x638u, 0.00080000 },
+  { 0x639u, 0.00650000 },
+  { 0x63Au, 0.01010000 },
+  { 0x641u, 0.00650000 },
+  { 0x642u, 0.00450000 },
+  { 0x644u, 0.05870000 },
+  { 0x645u, 0.03920000 },
+  { 0x646u, 0.05570000 },
+  { 0x647u, 0.07820000 },
+  { 0x648u, 0.11400000 },
+  { 0x64Au, 0.06420000 },
+  { 0x67Cu, 0.00560000 },
+  { 0x67Eu, 0.03210000 },
+  { 0x681u, 0.00600000 },
+  { 0x685u, 0.00480000 },
+  { 0x686u, 0.00910000 },
+  { 0x689u, 0.00480000 },
+  { 0x693u, 0.01230000 },
+  { 0x696u, 0.00390000 },
+  { 0x698u, 0.00220000 },
+  { 0x69Au, 0.00570000 },
+  { 0x6A9u, 0.02890000 },
+  { 0x6ABu, 0.00850000 },
+  { 0x6AFu, 0.00070000 },
+  { 0x6BCu, 0.00110000 },
+  { 0x6CCu, 0.02240000 },
+  { 0x6CDu, 0.00350000 },
+  { 0x6D0u, 0.04330000 },
+};
+
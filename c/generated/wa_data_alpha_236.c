@@ -0,0 +1,183 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_236_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+  "À",
+  "Á",
+  "Â",
+  "Ã",
+  "Ç",
+  "É",
+  "Ê",
+  "Í",
+  "Ò",
+  "Ó",
+  "Ô",
+  "Õ",
+  "Ú",
+};
+const char *ALPHA_236_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+  "à",
+  "á",
+  "â",
+  "ã",
+  "ç",
+  "é",
+  "ê",
+  "í",
+  "ò",
+  "ó",
+  "ô",
+  "õ",
+  "ú",
+};
+const char *ALPHA_236_DIGITS[] = {
+};
+const uint32_t ALPHA_236_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 192, 193, 194, 195, 199, 201,
+  202, 205, 210, 211, 212, 213, 218,
+};
+const uint32_t ALPHA_236_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 224, 225, 226, 227, 231, 233,
+  234, 237, 242, 243, 244, 245, 250,
+};
+const uint32_t ALPHA_236_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_236_FREQ[] = {
+  { "a", 0.12330000 },
+  { "b", 0.01150000 },
+  { "c", 0.03790000 },
+  { "d", 0.05690000 },
+  { "e", 0.11480000 },
+  { "f", 0.01150000 },
+  { "g", 0.01350000 },
+  { "h", 0.00950000 },
+  { "i", 0.06880000 },
+  { "j", 0.00340000 },
+  { "k", 0.00210000 },
+  { "l", 0.03200000 },
+  { "m", 0.04460000 },
+  { "n", 0.05450000 },
+  { "o", 0.10250000 },
+  { "p", 0.02720000 },
+  { "q", 0.00590000 },
+  { "r", 0.06740000 },
+  { "s", 0.07180000 },
+  { "t", 0.04860000 },
+  { "u", 0.03810000 },
+  { "v", 0.01240000 },
+  { "w", 0.00120000 },
+  { "x", 0.00270000 },
+  { "y", 0.00170000 },
+  { "z", 0.00350000 },
+  { "à", 0.00070000 },
+  { "á", 0.00370000 },
+  { "â", 0.00060000 },
+  { "ã", 0.00670000 },
+  { "ç", 0.00560000 },
+  { "é", 0.00580000 },
+  { "ê", 0.00140000 },
+  { "í", 0.00340000 },
+  { "ò", 0.00000000 },
+  { "ó", 0.00220000 },
+  { "ô", 0.00040000 },
+  { "õ", 0.00110000 },
+  { "ú", 0.00110000 },
+};
+
+const wa_cp_freq ALPHA_236_FREQ_CPS[] = {
+  { 0x61u, 0.12330000 },
+  { 0x62u, 0.01150000 },
+  { 0x63u, 0.03790000 },
+  { 0x64u, 0.05690000 },
+  { 0x65u, 0.11480000 },
+  { 0x66u, 0.01150000 },
+  { 0x67u, 0.01350000 },
+  { 0x68u, 0.00950000 },
+  { 0x69u, 0.06880000 },
+  { 0x6Au, 0.00340000 },
+  { 0x6Bu, 0.00210000 },
+  { 0x6Cu, 0.03200000 },
+  { 0x6Du, 0.04460000 },
+  { 0x6Eu, 0.05450000 },
+  { 0x6Fu, 0.10250000 },
+  { 0x70u, 0.02720000 },
+  { 0x71u, 0.00590000 },
+  { 0x72u, 0.06740000 },
+  { 0x73u, 0.07180000 },
+  { 0x74u, 0.04860000 },
+  { 0x75u, 0.03810000 },
+  { 0x76u, 0.01240000 },
+  { 0x77u, 0.00120000 },
+  { 0x78u, 0.00270000 },
+  { 0x79u, 0.00170000 },
+  { 0x7Au, 0.00350000 },
+  { 0xE0u, 0.00070000 },
+  { 0xE1u, 0.00370000 },
+  { 0xE2u, 0.00060000 },
+  { 0xE3u, 0.00670000 },
+  { 0xE7u, 0.00560000 },
+  { 0xE9u, 0.00580000 },
+  { 0xEAu, 0.00140000 },
+  { 0xEDu, 0.00340000 },
+  { 0xF2u, 0.00000000 },
+  { 0xF3u, 0.00220000 },
+  { 0xF4u, 0.00040000 },
+  { 0xF5u, 0.00110000 },
+  { 0xFAu, 0.00110000 },
+};
+
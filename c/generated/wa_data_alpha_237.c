@@ -0,0 +1,93 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_237_UPPER[] = {
+  "A",
+  "C",
+  "H",
+  "I",
+  "K",
+  "L",
+  "M",
+  "N",
+  "Ñ",
+  "P",
+  "Q",
+  "S",
+  "T",
+  "U",
+  "W",
+  "Y",
+  "ʼ",
+};
+const char *ALPHA_237_LOWER[] = {
+  "a",
+  "c",
+  "h",
+  "i",
+  "k",
+  "l",
+  "m",
+  "n",
+  "ñ",
+  "p",
+  "q",
+  "s",
+  "t",
+  "u",
+  "w",
+  "y",
+  "ʼ",
+};
+const char *ALPHA_237_DIGITS[] = {
+};
+const uint32_t ALPHA_237_UPPER_CPS[] = {
+  65, 67, 72, 73, 75, 76, 77, 78, 80, 81, 83, 84, 85, 87, 89, 209,
+  700,
+};
+const uint32_t ALPHA_237_LOWER_CPS[] = {
+  97, 99, 104, 105, 107, 108, 109, 110, 112, 113, 115, 116, 117, 119, 121, 241,
+  700,
+};
+const uint32_t ALPHA_237_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_237_FREQ[] = {
+  { "a", 0.21760000 },
+  { "c", 0.02690000 },
+  { "h", 0.03830000 },
+  { "i", 0.12530000 },
+  { "k", 0.04820000 },
+  { "l", 0.05840000 },
+  { "m", 0.05210000 },
+  { "n", 0.07420000 },
+  { "ñ", 0.00480000 },
+  { "p", 0.04940000 },
+  { "q", 0.05530000 },
+  { "s", 0.05510000 },
+  { "t", 0.04910000 },
+  { "u", 0.08370000 },
+  { "w", 0.02990000 },
+  { "y", 0.03200000 },
+  { "ʼ", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_237_FREQ_CPS[] = {
+  { 0x61u, 0.21760000 },
+  { 0x63u, 0.02690000 },
+  { 0x68u, 0.03830000 },
+  { 0x69u, 0.12530000 },
+  { 0x6Bu, 0.04820000 },
+  { 0x6Cu, 0.05840000 },
+  { 0x6Du, 0.05210000 },
+  { 0x6Eu, 0.07420000 },
+  { 0x70u, 0.04940000 },
+  { 0x71u, 0.05530000 },
+  { 0x73u, 0.05510000 },
+  { 0x74u, 0.04910000 },
+  { 0x75u, 0.08370000 },
+  { 0x77u, 0.02990000 },
+  { 0x79u, 0.03200000 },
+  { 0xF1u, 0.00480000 },
+  { 0x2BCu, 0.00000000 },
+};
+
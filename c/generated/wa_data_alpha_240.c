@@ -0,0 +1,175 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_240_UPPER[] = {
+  "ꤰ",
+  "ꤱ",
+  "ꤲ",
+  "ꤳ",
+  "ꤴ",
+  "ꤵ",
+  "ꤶ",
+  "ꤷ",
+  "ꤸ",
+  "ꤹ",
+  "ꤺ",
+  "ꤻ",
+  "ꤼ",
+  "ꤽ",
+  "ꤾ",
+  "ꤿ",
+  "ꥀ",
+  "ꥁ",
+  "ꥂ",
+  "ꥃ",
+  "ꥄ",
+  "ꥅ",
+  "ꥆ",
+  "ꥇ",
+  "ꥈ",
+  "ꥉ",
+  "ꥊ",
+  "ꥋ",
+  "ꥌ",
+  "ꥍ",
+  "ꥎ",
+  "ꥏ",
+  "ꥐ",
+  "ꥑ",
+  "ꥒ",
+  "꥓",
+  "꥟",
+};
+const char *ALPHA_240_LOWER[] = {
+  "ꤰ",
+  "ꤱ",
+  "ꤲ",
+  "ꤳ",
+  "ꤴ",
+  "ꤵ",
+  "ꤶ",
+  "ꤷ",
+  "ꤸ",
+  "ꤹ",
+  "ꤺ",
+  "ꤻ",
+  "ꤼ",
+  "ꤽ",
+  "ꤾ",
+  "ꤿ",
+  "ꥀ",
+  "ꥁ",
+  "ꥂ",
+  "ꥃ",
+  "ꥄ",
+  "ꥅ",
+  "ꥆ",
+  "ꥇ",
+  "ꥈ",
+  "ꥉ",
+  "ꥊ",
+  "ꥋ",
+  "ꥌ",
+  "ꥍ",
+  "ꥎ",
+  "ꥏ",
+  "ꥐ",
+  "ꥑ",
+  "ꥒ",
+  "꥓",
+  "꥟",
+};
+const char *ALPHA_240_DIGITS[] = {
+};
+const uint32_t ALPHA_240_UPPER_CPS[] = {
+  43312, 43313, 43314, 43315, 43316, 43317, 43318, 43319, 43320, 43321, 43322, 43323, 43324, 43325, 43326, 43327,
+  43328, 43329, 43330, 43331, 43332, 43333, 43334, 43335, 43336, 43337, 43338, 43339, 43340, 43341, 43342, 43343,
+  43344, 43345, 43346, 43347, 43359,
+};
+const uint32_t ALPHA_240_LOWER_CPS[] = {
+  43312, 43313, 43314, 43315, 43316, 43317, 43318, 43319, 43320, 43321, 43322, 43323, 43324, 43325, 43326, 43327,
+  43328, 43329, 43330, 43331, 43332, 43333, 43334, 43335, 43336, 43337, 43338, 43339, 43340, 43341, 43342, 43343,
+  43344, 43345, 43346, 43347, 43359,
+};
+const uint32_t ALPHA_240_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_240_FREQ[] = {
+  { "ꤰ", 0.00000000 },
+  { "ꤱ", 0.00000000 },
+  { "ꤲ", 0.00000000 },
+  { "ꤳ", 0.00000000 },
+  { "ꤴ", 0.00000000 },
+  { "ꤵ", 0.00000000 },
+  { "ꤶ", 0.00000000 },
+  { "ꤷ", 0.00000000 },
+  { "ꤸ", 0.00000000 },
+  { "ꤹ", 0.00000000 },
+  { "ꤺ", 0.00000000 },
+  { "ꤻ", 0.00000000 },
+  { "ꤼ", 0.00000000 },
+  { "ꤽ", 0.00000000 },
+  { "ꤾ", 0.00000000 },
+  { "ꤿ", 0.00000000 },
+  { "ꥀ", 0.00000000 },
+  { "ꥁ", 0.00000000 },
+  { "ꥂ", 0.00000000 },
+  { "ꥃ", 0.00000000 },
+  { "ꥄ", 0.00000000 },
+  { "ꥅ", 0.00000000 },
+  { "ꥆ", 0.00000000 },
+  { "ꥇ", 0.00000000 },
+  { "ꥈ", 0.00000000 },
+  { "ꥉ", 0.00000000 },
+  { "ꥊ", 0.00000000 },
+  { "ꥋ", 0.00000000 },
+  { "ꥌ", 0.00000000 },
+  { "ꥍ", 0.00000000 },
+  { "ꥎ", 0.00000000 },
+  { "ꥏ", 0.00000000 },
+  { "ꥐ", 0.00000000 },
+  { "ꥑ", 0.00000000 },
+  { "ꥒ", 0.00000000 },
+  { "꥓", 0.00000000 },
+  { "꥟", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_240_FREQ_CPS[] = {
+  { 0xA930u, 0.00000000 },
+  { 0xA931u, 0.00000000 },
+  { 0xA932u, 0.00000000 },
+  { 0xA933u, 0.00000000 },
+  { 0xA934u, 0.00000000 },
+  { 0xA935u, 0.00000000 },
+  { 0xA936u, 0.00000000 },
+  { 0xA937u, 0.00000000 },
+  { 0xA938u, 0.00000000 },
+  { 0xA939u, 0.00000000 },
+  { 0xA93Au, 0.00000000 },
+  { 0xA93Bu, 0.00000000 },
+  { 0xA93Cu, 0.00000000 },
+  { 0xA93Du, 0.00000000 },
+  { 0xA93Eu, 0.00000000 },
+  { 0xA93Fu, 0.00000000 },
+  { 0xA940u, 0.00000000 },
+  { 0xA941u, 0.00000000 },
+  { 0xA942u, 0.00000000 },
+  { 0xA943u, 0.00000000 },
+  { 0xA944u, 0.00000000 },
+  { 0xA945u, 0.00000000 },
+  { 0xA946u, 0.00000000 },
+  { 0xA947u, 0.00000000 },
+  { 0xA948u, 0.00000000 },
+  { 0xA949u, 0.00000000 },
+  { 0xA94Au, 0.00000000 },
+  { 0xA94Bu, 0.00000000 },
+  { 0xA94Cu, 0.00000000 },
+  { 0xA94Du, 0.00000000 },
+  { 0xA94Eu, 0.00000000 },
+  { 0xA94Fu, 0.00000000 },
+  { 0xA950u, 0.00000000 },
+  { 0xA951u, 0.00000000 },
+  { 0xA952u, 0.00000000 },
+  { 0xA953u, 0.00000000 },
+  { 0xA95Fu, 0.00000000 },
+};
+
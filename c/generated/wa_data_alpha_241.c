@@ -0,0 +1,177 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_241_UPPER[] = {
+  "𐴀",
+  "𐴝",
+  "𐴞",
+  "𐴟",
+  "𐴠",
+  "𐴡",
+  "𐴁",
+  "𐴂",
+  "𐴃",
+  "𐴄",
+  "𐴅",
+  "𐴆",
+  "𐴇",
+  "𐴈",
+  "𐴉",
+  "𐴊",
+  "𐴋",
+  "𐴌",
+  "𐴍",
+  "𐴎",
+  "𐴏",
+  "𐴐",
+  "𐴑",
+  "𐴒",
+  "𐴓",
+  "𐴔",
+  "𐴕",
+  "𐴖",
+  "𐴗",
+  "𐴘",
+  "𐴙",
+  "𐴚",
+  "𐴛",
+  "𐴢",
+  "𐴣",
+};
+const char *ALPHA_241_LOWER[] = {
+  "𐴀",
+  "𐴝",
+  "𐴞",
+  "𐴟",
+  "𐴠",
+  "𐴡",
+  "𐴁",
+  "𐴂",
+  "𐴃",
+  "𐴄",
+  "𐴅",
+  "𐴆",
+  "𐴇",
+  "𐴈",
+  "𐴉",
+  "𐴊",
+  "𐴋",
+  "𐴌",
+  "𐴍",
+  "𐴎",
+  "𐴏",
+  "𐴐",
+  "𐴑",
+  "𐴒",
+  "𐴓",
+  "𐴔",
+  "𐴕",
+  "𐴖",
+  "𐴗",
+  "𐴘",
+  "𐴙",
+  "𐴚",
+  "𐴛",
+  "𐴢",
+  "𐴣",
+};
+const char *ALPHA_241_DIGITS[] = {
+  "𐴰",
+  "𐴱",
+  "𐴲",
+  "𐴳",
+  "𐴴",
+  "𐴵",
+  "𐴶",
+  "𐴷",
+  "𐴸",
+  "𐴹",
+};
+const uint32_t ALPHA_241_UPPER_CPS[] = {
+  68864, 68865, 68866, 68867, 68868, 68869, 68870, 68871, 68872, 68873, 68874, 68875, 68876, 68877, 68878, 68879,
+  68880, 68881, 68882, 68883, 68884, 68885, 68886, 68887, 68888, 68889, 68890, 68891, 68893, 68894, 68895, 68896,
+  68897, 68898, 68899,
+};
+const uint32_t ALPHA_241_LOWER_CPS[] = {
+  68864, 68865, 68866, 68867, 68868, 68869, 68870, 68871, 68872, 68873, 68874, 68875, 68876, 68877, 68878, 68879,
+  68880, 68881, 68882, 68883, 68884, 68885, 68886, 68887, 68888, 68889, 68890, 68891, 68893, 68894, 68895, 68896,
+  68897, 68898, 68899,
+};
+const uint32_t ALPHA_241_DIGITS_CPS[] = {
+  68912, 68913, 68914, 68915, 68916, 68917, 68918, 68919, 68920, 68921,
+};
+const wa_freq_entry ALPHA_241_FREQ[] = {
+  { "𐴀", 0.00000000 },
+  { "𐴝", 0.00000000 },
+  { "𐴞", 0.00000000 },
+  { "𐴟", 0.00000000 },
+  { "𐴠", 0.00000000 },
+  { "𐴡", 0.00000000 },
+  { "𐴁", 0.00000000 },
+  { "𐴂", 0.00000000 },
+  { "𐴃", 0.00000000 },
+  { "𐴄", 0.00000000 },
+  { "𐴅", 0.00000000 },
+  { "𐴆", 0.00000000 },
+  { "𐴇", 0.00000000 },
+  { "𐴈", 0.00000000 },
+  { "𐴉", 0.00000000 },
+  { "𐴊", 0.00000000 },
+  { "𐴋", 0.00000000 },
+  { "𐴌", 0.00000000 },
+  { "𐴍", 0.00000000 },
+  { "𐴎", 0.00000000 },
+  { "𐴏", 0.00000000 },
+  { "𐴐", 0.00000000 },
+  { "𐴑", 0.00000000 },
+  { "𐴒", 0.00000000 },
+  { "𐴓", 0.00000000 },
+  { "𐴔", 0.00000000 },
+  { "𐴕", 0.00000000 },
+  { "𐴖", 0.00000000 },
+  { "𐴗", 0.00000000 },
+  { "𐴘", 0.00000000 },
+  { "𐴙", 0.00000000 },
+  { "𐴚", 0.00000000 },
+  { "𐴛", 0.00000000 },
+  { "𐴢", 0.00000000 },
+  { "𐴣", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_241_FREQ_CPS[] = {
+  { 0x10D00u, 0.00000000 },
+  { 0x10D01u, 0.00000000 },
+  { 0x10D02u, 0.00000000 },
+  { 0x10D03u, 0.00000000 },
+  { 0x10D04u, 0.00000000 },
+  { 0x10D05u, 0.00000000 },
+  { 0x10D06u, 0.00000000 },
+  { 0x10D07u, 0.00000000 },
+  { 0x10D08u, 0.00000000 },
+  { 0x10D09u, 0.00000000 },
+  { 0x10D0Au, 0.00000000 },
+  { 0x10D0Bu, 0.00000000 },
+  { 0x10D0Cu, 0.00000000 },
+  { 0x10D0Du, 0.00000000 },
+  { 0x10D0Eu, 0.00000000 },
+  { 0x10D0Fu, 0.00000000 },
+  { 0x10D10u, 0.00000000 },
+  { 0x10D11u, 0.00000000 },
+  { 0x10D12u, 0.00000000 },
+  { 0x10D13u, 0.00000000 },
+  { 0x10D14u, 0.00000000 },
+  { 0x10D15u, 0.00000000 },
+  { 0x10D16u, 0.00000000 },
+  { 0x10D17u, 0.00000000 },
+  { 0x10D18u, 0.00000000 },
+  { 0x10D19u, 0.00000000 },
+  { 0x10D1Au, 0.00000000 },
+  { 0x10D1Bu, 0.00000000 },
+  { 0x10D1Du, 0.00000000 },
+  { 0x10D1Eu, 0.00000000 },
+  { 0x10D1Fu, 0.00000000 },
+  { 0x10D20u, 0.00000000 },
+  { 0x10D21u, 0.00000000 },
+  { 0x10D22u, 0.00000000 },
+  { 0x10D23u, 0.00000000 },
+};
+
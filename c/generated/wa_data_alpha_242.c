@@ -0,0 +1,153 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_242_UPPER[] = {
+  "A",
+  "À",
+  "B",
+  "C",
+  "D",
+  "E",
+  "É",
+  "È",
+  "F",
+  "G",
+  "H",
+  "I",
+  "Ì",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "Ò",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "Ù",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+};
+const char *ALPHA_242_LOWER[] = {
+  "a",
+  "à",
+  "b",
+  "c",
+  "d",
+  "e",
+  "é",
+  "è",
+  "f",
+  "g",
+  "h",
+  "i",
+  "ì",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "ò",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "ù",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+};
+const char *ALPHA_242_DIGITS[] = {
+};
+const uint32_t ALPHA_242_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 192, 200, 201, 204, 210, 217,
+};
+const uint32_t ALPHA_242_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 224, 232, 233, 236, 242, 249,
+};
+const uint32_t ALPHA_242_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_242_FREQ[] = {
+  { "a", 0.14900000 },
+  { "à", 0.00290000 },
+  { "b", 0.00960000 },
+  { "c", 0.04270000 },
+  { "d", 0.04760000 },
+  { "e", 0.08460000 },
+  { "é", 0.00030000 },
+  { "è", 0.00430000 },
+  { "f", 0.01060000 },
+  { "g", 0.02310000 },
+  { "h", 0.02040000 },
+  { "i", 0.09050000 },
+  { "ì", 0.00140000 },
+  { "j", 0.00130000 },
+  { "k", 0.00130000 },
+  { "l", 0.06620000 },
+  { "m", 0.02450000 },
+  { "n", 0.08100000 },
+  { "o", 0.02910000 },
+  { "ò", 0.00010000 },
+  { "p", 0.02430000 },
+  { "q", 0.00360000 },
+  { "r", 0.06380000 },
+  { "s", 0.07790000 },
+  { "t", 0.05790000 },
+  { "u", 0.04820000 },
+  { "ù", 0.00000000 },
+  { "v", 0.02010000 },
+  { "w", 0.00070000 },
+  { "x", 0.00150000 },
+  { "y", 0.00080000 },
+  { "z", 0.01070000 },
+};
+
+const wa_cp_freq ALPHA_242_FREQ_CPS[] = {
+  { 0x61u, 0.14900000 },
+  { 0x62u, 0.00960000 },
+  { 0x63u, 0.04270000 },
+  { 0x64u, 0.04760000 },
+  { 0x65u, 0.08460000 },
+  { 0x66u, 0.01060000 },
+  { 0x67u, 0.02310000 },
+  { 0x68u, 0.02040000 },
+  { 0x69u, 0.09050000 },
+  { 0x6Au, 0.00130000 },
+  { 0x6Bu, 0.00130000 },
+  { 0x6Cu, 0.06620000 },
+  { 0x6Du, 0.02450000 },
+  { 0x6Eu, 0.08100000 },
+  { 0x6Fu, 0.02910000 },
+  { 0x70u, 0.02430000 },
+  { 0x71u, 0.00360000 },
+  { 0x72u, 0.06380000 },
+  { 0x73u, 0.07790000 },
+  { 0x74u, 0.05790000 },
+  { 0x75u, 0.04820000 },
+  { 0x76u, 0.02010000 },
+  { 0x77u, 0.00070000 },
+  { 0x78u, 0.00150000 },
+  { 0x79u, 0.00080000 },
+  { 0x7Au, 0.01070000 },
+  { 0xE0u, 0.00290000 },
+  { 0xE8u, 0.00430000 },
+  { 0xE9u, 0.00030000 },
+  { 0xECu, 0.00140000 },
+  { 0xF2u, 0.00010000 },
+  { 0xF9u, 0.00000000 },
+};
+
@@ -0,0 +1,129 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_243_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+};
+const char *ALPHA_243_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+};
+const char *ALPHA_243_DIGITS[] = {
+};
+const uint32_t ALPHA_243_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90,
+};
+const uint32_t ALPHA_243_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122,
+};
+const uint32_t ALPHA_243_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_243_FREQ[] = {
+  { "a", 0.14530000 },
+  { "b", 0.04870000 },
+  { "c", 0.01470000 },
+  { "d", 0.01640000 },
+  { "e", 0.06760000 },
+  { "f", 0.00440000 },
+  { "g", 0.03550000 },
+  { "h", 0.02390000 },
+  { "i", 0.11910000 },
+  { "j", 0.00400000 },
+  { "k", 0.04270000 },
+  { "l", 0.00830000 },
+  { "m", 0.04580000 },
+  { "n", 0.07550000 },
+  { "o", 0.04320000 },
+  { "p", 0.00510000 },
+  { "q", 0.00010000 },
+  { "r", 0.06830000 },
+  { "s", 0.02940000 },
+  { "t", 0.03010000 },
+  { "u", 0.08230000 },
+  { "v", 0.00850000 },
+  { "w", 0.03130000 },
+  { "x", 0.00030000 },
+  { "y", 0.03060000 },
+  { "z", 0.01890000 },
+};
+
+const wa_cp_freq ALPHA_243_FREQ_CPS[] = {
+  { 0x61u, 0.14530000 },
+  { 0x62u, 0.04870000 },
+  { 0x63u, 0.01470000 },
+  { 0x64u, 0.01640000 },
+  { 0x65u, 0.06760000 },
+  { 0x66u, 0.00440000 },
+  { 0x67u, 0.03550000 },
+  { 0x68u, 0.02390000 },
+  { 0x69u, 0.11910000 },
+  { 0x6Au, 0.00400000 },
+  { 0x6Bu, 0.04270000 },
+  { 0x6Cu, 0.00830000 },
+  { 0x6Du, 0.04580000 },
+  { 0x6Eu, 0.07550000 },
+  { 0x6Fu, 0.04320000 },
+  { 0x70u, 0.00510000 },
+  { 0x71u, 0.00010000 },
+  { 0x72u, 0.06830000 },
+  { 0x73u, 0.02940000 },
+  { 0x74u, 0.03010000 },
+  { 0x75u, 0.08230000 },
+  { 0x76u, 0.00850000 },
+  { 0x77u, 0.03130000 },
+  { 0x78u, 0.00030000 },
+  { 0x79u, 0.03060000 },
+  { 0x7Au, 0.01890000 },
+};
+
@@ -0,0 +1,149 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_244_UPPER[] = {
+  "A",
+  "Ă",
+  "Â",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "Î",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "Ș",
+  "T",
+  "Ț",
+  "U",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+};
+const char *ALPHA_244_LOWER[] = {
+  "a",
+  "ă",
+  "â",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "î",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "q",
+  "r",
+  "s",
+  "ș",
+  "t",
+  "ț",
+  "u",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+};
+const char *ALPHA_244_DIGITS[] = {
+};
+const uint32_t ALPHA_244_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 194, 206, 258, 536, 538,
+};
+const uint32_t ALPHA_244_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 226, 238, 259, 537, 539,
+};
+const uint32_t ALPHA_244_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_244_FREQ[] = {
+  { "a", 0.10510000 },
+  { "ă", 0.02250000 },
+  { "â", 0.00450000 },
+  { "b", 0.01060000 },
+  { "c", 0.04730000 },
+  { "d", 0.03510000 },
+  { "e", 0.11400000 },
+  { "f", 0.01280000 },
+  { "g", 0.01060000 },
+  { "h", 0.00590000 },
+  { "i", 0.10670000 },
+  { "î", 0.01080000 },
+  { "j", 0.00250000 },
+  { "k", 0.00180000 },
+  { "l", 0.05430000 },
+  { "m", 0.02850000 },
+  { "n", 0.06740000 },
+  { "o", 0.05010000 },
+  { "p", 0.02900000 },
+  { "q", 0.00020000 },
+  { "r", 0.07360000 },
+  { "s", 0.04120000 },
+  { "ș", 0.01010000 },
+  { "t", 0.06510000 },
+  { "ț", 0.00940000 },
+  { "u", 0.05830000 },
+  { "v", 0.01090000 },
+  { "w", 0.00110000 },
+  { "x", 0.00210000 },
+  { "y", 0.00130000 },
+  { "z", 0.00710000 },
+};
+
+const wa_cp_freq ALPHA_244_FREQ_CPS[] = {
+  { 0x61u, 0.10510000 },
+  { 0x62u, 0.01060000 },
+  { 0x63u, 0.04730000 },
+  { 0x64u, 0.03510000 },
+  { 0x65u, 0.11400000 },
+  { 0x66u, 0.01280000 },
+  { 0x67u, 0.01060000 },
+  { 0x68u, 0.00590000 },
+  { 0x69u, 0.10670000 },
+  { 0x6Au, 0.00250000 },
+  { 0x6Bu, 0.00180000 },
+  { 0x6Cu, 0.05430000 },
+  { 0x6Du, 0.02850000 },
+  { 0x6Eu, 0.06740000 },
+  { 0x6Fu, 0.05010000 },
+  { 0x70u, 0.02900000 },
+  { 0x71u, 0.00020000 },
+  { 0x72u, 0.07360000 },
+  { 0x73u, 0.04120000 },
+  { 0x74u, 0.06510000 },
+  { 0x75u, 0.05830000 },
+  { 0x76u, 0.01090000 },
+  { 0x77u, 0.00110000 },
+  { 0x78u, 0.00210000 },
+  { 0x79u, 0.00130000 },
+  { 0x7Au, 0.00710000 },
+  { 0xE2u, 0.00450000 },
+  { 0xEEu, 0.01080000 },
+  { 0x103u, 0.02250000 },
+  { 0x219u, 0.01010000 },
+  { 0x21Bu, 0.00940000 },
+};
+
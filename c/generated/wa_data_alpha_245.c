@@ -0,0 +1,159 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_245_UPPER[] = {
+  "А",
+  "Б",
+  "В",
+  "Г",
+  "Д",
+  "Е",
+  "Ё",
+  "Ж",
+  "З",
+  "И",
+  "Й",
+  "К",
+  "Л",
+  "М",
+  "Н",
+  "О",
+  "П",
+  "Р",
+  "С",
+  "Т",
+  "У",
+  "Ф",
+  "Х",
+  "Ц",
+  "Ч",
+  "Ш",
+  "Щ",
+  "Ы",
+  "Э",
+  "Ю",
+  "Я",
+  "Ъ",
+  "Ь",
+};
+const char *ALPHA_245_LOWER[] = {
+  "а",
+  "б",
+  "в",
+  "г",
+  "д",
+  "е",
+  "ё",
+  "ж",
+  "з",
+  "и",
+  "й",
+  "к",
+  "л",
+  "м",
+  "н",
+  "о",
+  "п",
+  "р",
+  "с",
+  "т",
+  "у",
+  "ф",
+  "х",
+  "ц",
+  "ч",
+  "ш",
+  "щ",
+  "ы",
+  "э",
+  "ю",
+  "я",
+  "ъ",
+  "ь",
+};
+const char *ALPHA_245_DIGITS[] = {
+};
+const uint32_t ALPHA_245_UPPER_CPS[] = {
+  1025, 1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053, 1054,
+  1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069, 1070,
+  1071,
+};
+const uint32_t ALPHA_245_LOWER_CPS[] = {
+  1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080, 1081, 1082, 1083, 1084, 1085, 1086, 1087,
+  1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103,
+  1105,
+};
+const uint32_t ALPHA_245_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_245_FREQ[] = {
+  { "а", 0.08220000 },
+  { "б", 0.01550000 },
+  { "в", 0.04880000 },
+  { "г", 0.02010000 },
+  { "д", 0.03030000 },
+  { "е", 0.07990000 },
+  { "ё", 0.00240000 },
+  { "ж", 0.00740000 },
+  { "з", 0.01560000 },
+  { "и", 0.07980000 },
+  { "й", 0.01430000 },
+  { "к", 0.03590000 },
+  { "л", 0.04380000 },
+  { "м", 0.03120000 },
+  { "н", 0.06690000 },
+  { "о", 0.10620000 },
+  { "п", 0.02810000 },
+  { "р", 0.05510000 },
+  { "с", 0.05730000 },
+  { "т", 0.05570000 },
+  { "у", 0.02280000 },
+  { "ф", 0.00430000 },
+  { "х", 0.01020000 },
+  { "ц", 0.00610000 },
+  { "ч", 0.01170000 },
+  { "ш", 0.00550000 },
+  { "щ", 0.00330000 },
+  { "ы", 0.01820000 },
+  { "э", 0.00290000 },
+  { "ю", 0.00600000 },
+  { "я", 0.01930000 },
+  { "ъ", 0.00030000 },
+  { "ь", 0.01310000 },
+};
+
+const wa_cp_freq ALPHA_245_FREQ_CPS[] = {
+  { 0x430u, 0.08220000 },
+  { 0x431u, 0.01550000 },
+  { 0x432u, 0.04880000 },
+  { 0x433u, 0.02010000 },
+  { 0x434u, 0.03030000 },
+  { 0x435u, 0.07990000 },
+  { 0x436u, 0.00740000 },
+  { 0x437u, 0.01560000 },
+  { 0x438u, 0.07980000 },
+  { 0x439u, 0.01430000 },
+  { 0x43Au, 0.03590000 },
+  { 0x43Bu, 0.04380000 },
+  { 0x43Cu, 0.03120000 },
+  { 0x43Du, 0.06690000 },
+  { 0x43Eu, 0.10620000 },
+  { 0x43Fu, 0.02810000 },
+  { 0x440u, 0.05510000 },
+  { 0x441u, 0.05730000 },
+  { 0x442u, 0.05570000 },
+  { 0x443u, 0.02280000 },
+  { 0x444u, 0.00430000 },
+  { 0x445u, 0.01020000 },
+  { 0x446u, 0.00610000 },
+  { 0x447u, 0.01170000 },
+  { 0x448u, 0.00550000 },
+  { 0x449u, 0.00330000 },
+  { 0x44Au, 0.00030000 },
+  { 0x44Bu, 0.01820000 },
+  { 0x44Cu, 0.01310000 },
+  { 0x44Du, 0.00290000 },
+  { 0x44Eu, 0.00600000 },
+  { 0x44Fu, 0.01930000 },
+  { 0x451u, 0.00240000 },
+};
+
@@ -0,0 +1,131 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_246_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "W",
+  "Y",
+  "Z",
+};
+const char *ALPHA_246_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "w",
+  "y",
+  "z",
+};
+const char *ALPHA_246_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_246_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  82, 83, 84, 85, 86, 87, 89, 90,
+};
+const uint32_t ALPHA_246_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  114, 115, 116, 117, 118, 119, 121, 122,
+};
+const uint32_t ALPHA_246_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_246_FREQ[] = {
+  { "n", 0.07280000 },
+  { "g", 0.02790000 },
+  { "a", 0.16810000 },
+  { "o", 0.08960000 },
+  { "m", 0.04540000 },
+  { "u", 0.06980000 },
+  { "t", 0.01930000 },
+  { "i", 0.09100000 },
+  { "e", 0.07960000 },
+  { "r", 0.02410000 },
+  { "b", 0.07180000 },
+  { "k", 0.06280000 },
+  { "y", 0.03480000 },
+  { "s", 0.03170000 },
+  { "l", 0.02910000 },
+  { "w", 0.03880000 },
+  { "z", 0.01380000 },
+  { "d", 0.01380000 },
+  { "f", 0.00410000 },
+  { "h", 0.00140000 },
+  { "j", 0.00630000 },
+  { "p", 0.00210000 },
+  { "v", 0.00130000 },
+  { "c", 0.00080000 },
+};
+
+const wa_cp_freq ALPHA_246_FREQ_CPS[] = {
+  { 0x61u, 0.16810000 },
+  { 0x62u, 0.07180000 },
+  { 0x63u, 0.00080000 },
+  { 0x64u, 0.01380000 },
+  { 0x65u, 0.07960000 },
+  { 0x66u, 0.00410000 },
+  { 0x67u, 0.02790000 },
+  { 0x68u, 0.00140000 },
+  { 0x69u, 0.09100000 },
+  { 0x6Au, 0.00630000 },
+  { 0x6Bu, 0.06280000 },
+  { 0x6Cu, 0.02910000 },
+  { 0x6Du, 0.04540000 },
+  { 0x6Eu, 0.07280000 },
+  { 0x6Fu, 0.08960000 },
+  { 0x70u, 0.00210000 },
+  { 0x72u, 0.02410000 },
+  { 0x73u, 0.03170000 },
+  { 0x74u, 0.01930000 },
+  { 0x75u, 0.06980000 },
+  { 0x76u, 0.00130000 },
+  { 0x77u, 0.03880000 },
+  { 0x79u, 0.03480000 },
+  { 0x7Au, 0.01380000 },
+};
+
@@ -0,0 +1,129 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_247_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+};
+const char *ALPHA_247_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+};
+const char *ALPHA_247_DIGITS[] = {
+};
+const uint32_t ALPHA_247_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90,
+};
+const uint32_t ALPHA_247_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122,
+};
+const uint32_t ALPHA_247_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_247_FREQ[] = {
+  { "a", 0.14490000 },
+  { "b", 0.04120000 },
+  { "c", 0.01250000 },
+  { "d", 0.01420000 },
+  { "e", 0.06020000 },
+  { "f", 0.00570000 },
+  { "g", 0.03900000 },
+  { "h", 0.02020000 },
+  { "i", 0.12890000 },
+  { "j", 0.00540000 },
+  { "k", 0.03980000 },
+  { "l", 0.01270000 },
+  { "m", 0.05140000 },
+  { "n", 0.07000000 },
+  { "o", 0.04120000 },
+  { "p", 0.00650000 },
+  { "q", 0.00050000 },
+  { "r", 0.06300000 },
+  { "s", 0.02800000 },
+  { "t", 0.03150000 },
+  { "u", 0.09130000 },
+  { "v", 0.00480000 },
+  { "w", 0.02640000 },
+  { "x", 0.00020000 },
+  { "y", 0.04000000 },
+  { "z", 0.02040000 },
+};
+
+const wa_cp_freq ALPHA_247_FREQ_CPS[] = {
+  { 0x61u, 0.14490000 },
+  { 0x62u, 0.04120000 },
+  { 0x63u, 0.01250000 },
+  { 0x64u, 0.01420000 },
+  { 0x65u, 0.06020000 },
+  { 0x66u, 0.00570000 },
+  { 0x67u, 0.03900000 },
+  { 0x68u, 0.02020000 },
+  { 0x69u, 0.12890000 },
+  { 0x6Au, 0.00540000 },
+  { 0x6Bu, 0.03980000 },
+  { 0x6Cu, 0.01270000 },
+  { 0x6Du, 0.05140000 },
+  { 0x6Eu, 0.07000000 },
+  { 0x6Fu, 0.04120000 },
+  { 0x70u, 0.00650000 },
+  { 0x71u, 0.00050000 },
+  { 0x72u, 0.06300000 },
+  { 0x73u, 0.02800000 },
+  { 0x74u, 0.03150000 },
+  { 0x75u, 0.09130000 },
+  { 0x76u, 0.00480000 },
+  { 0x77u, 0.02640000 },
+  { 0x78u, 0.00020000 },
+  { 0x79u, 0.04000000 },
+  { 0x7Au, 0.02040000 },
+};
+
@@ -0,0 +1,229 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_249_UPPER[] = {
+  "अ",
+  "आ",
+  "इ",
+  "ई",
+  "उ",
+  "ऊ",
+  "ऋ",
+  "ॠ",
+  "ऌ",
+  "ॡ",
+  "ए",
+  "ऐ",
+  "ओ",
+  "औ",
+  "क",
+  "ख",
+  "ग",
+  "घ",
+  "ङ",
+  "च",
+  "छ",
+  "ज",
+  "झ",
+  "ञ",
+  "ट",
+  "ठ",
+  "ड",
+  "ढ",
+  "ण",
+  "त",
+  "थ",
+  "द",
+  "ध",
+  "न",
+  "प",
+  "फ",
+  "ब",
+  "भ",
+  "म",
+  "य",
+  "र",
+  "ल",
+  "ळ",
+  "व",
+  "श",
+  "ष",
+  "स",
+  "ह",
+  "ऽ",
+  "ॐ",
+};
+const char *ALPHA_249_LOWER[] = {
+  "अ",
+  "आ",
+  "इ",
+  "ई",
+  "उ",
+  "ऊ",
+  "ऋ",
+  "ॠ",
+  "ऌ",
+  "ॡ",
+  "ए",
+  "ऐ",
+  "ओ",
+  "औ",
+  "क",
+  "ख",
+  "ग",
+  "घ",
+  "ङ",
+  "च",
+  "छ",
+  "ज",
+  "झ",
+  "ञ",
+  "ट",
+  "ठ",
+  "ड",
+  "ढ",
+  "ण",
+  "त",
+  "थ",
+  "द",
+  "ध",
+  "न",
+  "प",
+  "फ",
+  "ब",
+  "भ",
+  "म",
+  "य",
+  "र",
+  "ल",
+  "ळ",
+  "व",
+  "श",
+  "ष",
+  "स",
+  "ह",
+  "ऽ",
+  "ॐ",
+};
+const char *ALPHA_249_DIGITS[] = {
+};
+const uint32_t ALPHA_249_UPPER_CPS[] = {
+  2309, 2310, 2311, 2312, 2313, 2314, 2315, 2316, 2319, 2320, 2323, 2324, 2325, 2326, 2327, 2328,
+  2329, 2330, 2331, 2332, 2333, 2334, 2335, 2336, 2337, 2338, 2339, 2340, 2341, 2342, 2343, 2344,
+  2346, 2347, 2348, 2349, 2350, 2351, 2352, 2354, 2355, 2357, 2358, 2359, 2360, 2361, 2365, 2384,
+  2400, 2401,
+};
+const uint32_t ALPHA_249_LOWER_CPS[] = {
+  2309, 2310, 2311, 2312, 2313, 2314, 2315, 2316, 2319, 2320, 2323, 2324, 2325, 2326, 2327, 2328,
+  2329, 2330, 2331, 2332, 2333, 2334, 2335, 2336, 2337, 2338, 2339, 2340, 2341, 2342, 2343, 2344,
+  2346, 2347, 2348, 2349, 2350, 2351, 2352, 2354, 2355, 2357, 2358, 2359, 2360, 2361, 2365, 2384,
+  2400, 2401,
+};
+const uint32_t ALPHA_249_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_249_FREQ[] = {
+  { "अ", 0.02170000 },
+  { "आ", 0.00770000 },
+  { "इ", 0.00820000 },
+  { "ई", 0.00080000 },
+  { "उ", 0.00450000 },
+  { "ऊ", 0.00020000 },
+  { "ऋ", 0.00020000 },
+  { "ॠ", 0.00000000 },
+  { "ऌ", 0.00000000 },
+  { "ॡ", 0.00000000 },
+  { "ए", 0.00860000 },
+  { "ऐ", 0.00020000 },
+  { "ओ", 0.00040000 },
+  { "औ", 0.00090000 },
+  { "क", 0.05770000 },
+  { "ख", 0.00410000 },
+  { "ग", 0.02200000 },
+  { "घ", 0.00140000 },
+  { "ङ", 0.00410000 },
+  { "च", 0.01690000 },
+  { "छ", 0.00150000 },
+  { "ज", 0.01690000 },
+  { "झ", 0.00020000 },
+  { "ञ", 0.00380000 },
+  { "ट", 0.00870000 },
+  { "ठ", 0.00160000 },
+  { "ड", 0.00600000 },
+  { "ढ", 0.00040000 },
+  { "ण", 0.01990000 },
+  { "त", 0.11010000 },
+  { "थ", 0.01060000 },
+  { "द", 0.03590000 },
+  { "ध", 0.01420000 },
+  { "न", 0.07750000 },
+  { "प", 0.04490000 },
+  { "फ", 0.00190000 },
+  { "ब", 0.01030000 },
+  { "भ", 0.01710000 },
+  { "म", 0.06010000 },
+  { "य", 0.07400000 },
+  { "र", 0.10200000 },
+  { "ल", 0.02410000 },
+  { "ळ", 0.00080000 },
+  { "व", 0.06290000 },
+  { "श", 0.02290000 },
+  { "ष", 0.02220000 },
+  { "स", 0.07020000 },
+  { "ह", 0.01840000 },
+  { "ऽ", 0.00120000 },
+  { "ॐ", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_249_FREQ_CPS[] = {
+  { 0x905u, 0.02170000 },
+  { 0x906u, 0.00770000 },
+  { 0x907u, 0.00820000 },
+  { 0x908u, 0.00080000 },
+  { 0x909u, 0.00450000 },
+  { 0x90Au, 0.00020000 },
+  { 0x90Bu, 0.00020000 },
+  { 0x90Cu, 0.00000000 },
+  { 0x90Fu, 0.00860000 },
+  { 0x910u, 0.00020000 },
+  { 0x913u, 0.00040000 },
+  { 0x914u, 0.00090000 },
+  { 0x915u, 0.05770000 },
+  { 0x916u, 0.00410000 },
+  { 0x917u, 0.02200000 },
+  { 0x918u, 0.00140000 },
+  { 0x919u, 0.00410000 },
+  { 0x91Au, 0.01690000 },
+  { 0x91Bu, 0.00150000 },
+  { 0x91Cu, 0.01690000 },
+  { 0x91Du, 0.00020000 },
+  { 0x91Eu, 0.00380000 },
+  { 0x91Fu, 0.00870000 },
+  { 0x920u, 0.00160000 },
+  { 0x921u, 0.00600000 },
+  { 0x922u, 0.00040000 },
+  { 0x923u, 0.01990000 },
+  { 0x924u, 0.11010000 },
+  { 0x925u, 0.01060000 },
+  { 0x926u, 0.03590000 },
+  { 0x927u, 0.01420000 },
+  { 0x928u, 0.07750000 },
+  { 0x92Au, 0.04490000 },
+  { 0x92Bu, 0.00190000 },
+  { 0x92Cu, 0.01030000 },
+  { 0x92Du, 0.01710000 },
+  { 0x92Eu, 0.06010000 },
+  { 0x92Fu, 0.07400000 },
+  { 0x930u, 0.10200000 },
+  { 0x932u, 0.02410000 },
+  { 0x933u, 0.00080000 },
+  { 0x935u, 0.06290000 },
+  { 0x936u, 0.02290000 },
+  { 0x937u, 0.02220000 },
+  { 0x938u, 0.07020000 },
+  { 0x939u, 0.01840000 },
+  { 0x93Du, 0.00120000 },
+  { 0x950u, 0.00000000 },
+  { 0x960u, 0.00000000 },
+  { 0x961u, 0.00000000 },
+};
+
@@ -0,0 +1,139 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_250_UPPER[] = {
+  "А",
+  "Б",
+  "Г",
+  "Ҕ",
+  "Д",
+  "Ь",
+  "И",
+  "Й",
+  "К",
+  "Л",
+  "М",
+  "Н",
+  "Ҥ",
+  "О",
+  "Ө",
+  "П",
+  "Р",
+  "С",
+  "Т",
+  "У",
+  "Ү",
+  "Х",
+  "Һ",
+  "Ч",
+  "Ы",
+  "Э",
+};
+const char *ALPHA_250_LOWER[] = {
+  "а",
+  "б",
+  "г",
+  "ҕ",
+  "д",
+  "ь",
+  "и",
+  "й",
+  "к",
+  "л",
+  "м",
+  "н",
+  "ҥ",
+  "о",
+  "ө",
+  "п",
+  "р",
+  "с",
+  "т",
+  "у",
+  "ү",
+  "х",
+  "һ",
+  "ч",
+  "ы",
+  "э",
+};
+const char *ALPHA_250_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_250_UPPER_CPS[] = {
+  1040, 1041, 1043, 1044, 1048, 1049, 1050, 1051, 1052, 1053, 1054, 1055, 1056, 1057, 1058, 1059,
+  1061, 1063, 1067, 1068, 1069, 1172, 1188, 1198, 1210, 1256,
+};
+const uint32_t ALPHA_250_LOWER_CPS[] = {
+  1072, 1073, 1075, 1076, 1080, 1081, 1082, 1083, 1084, 1085, 1086, 1087, 1088, 1089, 1090, 1091,
+  1093, 1095, 1099, 1100, 1101, 1173, 1189, 1199, 1211, 1257,
+};
+const uint32_t ALPHA_250_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_250_FREQ[] = {
+  { "а", 0.14130000 },
+  { "б", 0.02890000 },
+  { "г", 0.01870000 },
+  { "ҕ", 0.00730000 },
+  { "д", 0.02350000 },
+  { "ь", 0.00830000 },
+  { "и", 0.06790000 },
+  { "й", 0.01650000 },
+  { "к", 0.04050000 },
+  { "л", 0.05620000 },
+  { "м", 0.01870000 },
+  { "н", 0.07450000 },
+  { "ҥ", 0.00560000 },
+  { "о", 0.05380000 },
+  { "ө", 0.01390000 },
+  { "п", 0.01010000 },
+  { "р", 0.07500000 },
+  { "с", 0.04780000 },
+  { "т", 0.07200000 },
+  { "у", 0.05240000 },
+  { "ү", 0.02020000 },
+  { "х", 0.02320000 },
+  { "һ", 0.00930000 },
+  { "ч", 0.00790000 },
+  { "ы", 0.05030000 },
+  { "э", 0.05610000 },
+};
+
+const wa_cp_freq ALPHA_250_FREQ_CPS[] = {
+  { 0x430u, 0.14130000 },
+  { 0x431u, 0.02890000 },
+  { 0x433u, 0.01870000 },
+  { 0x434u, 0.02350000 },
+  { 0x438u, 0.06790000 },
+  { 0x439u, 0.01650000 },
+  { 0x43Au, 0.04050000 },
+  { 0x43Bu, 0.05620000 },
+  { 0x43Cu, 0.01870000 },
+  { 0x43Du, 0.07450000 },
+  { 0x43Eu, 0.05380000 },
+  { 0x43Fu, 0.01010000 },
+  { 0x440u, 0.07500000 },
+  { 0x441u, 0.04780000 },
+  { 0x442u, 0.07200000 },
+  { 0x443u, 0.05240000 },
+  { 0x445u, 0.02320000 },
+  { 0x447u, 0.00790000 },
+  { 0x44Bu, 0.05030000 },
+  { 0x44Cu, 0.00830000 },
+  { 0x44Du, 0.05610000 },
+  { 0x495u, 0.00730000 },
+  { 0x4A5u, 0.00560000 },
+  { 0x4AFu, 0.02020000 },
+  { 0x4BBu, 0.00930000 },
+  { 0x4E9u, 0.01390000 },
+};
+
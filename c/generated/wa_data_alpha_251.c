@@ -0,0 +1,273 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_251_UPPER[] = {
+  "ࠀ",
+  "ࠁ",
+  "ࠂ",
+  "ࠃ",
+  "ࠄ",
+  "ࠅ",
+  "ࠆ",
+  "ࠇ",
+  "ࠈ",
+  "ࠉ",
+  "ࠊ",
+  "ࠋ",
+  "ࠌ",
+  "ࠍ",
+  "ࠎ",
+  "ࠏ",
+  "ࠐ",
+  "ࠑ",
+  "ࠒ",
+  "ࠓ",
+  "ࠔ",
+  "ࠕ",
+  "ࠖ",
+  "ࠗ",
+  "࠘",
+  "࠙",
+  "ࠚ",
+  "ࠛ",
+  "ࠜ",
+  "ࠝ",
+  "ࠞ",
+  "ࠟ",
+  "ࠠ",
+  "ࠡ",
+  "ࠢ",
+  "ࠣ",
+  "ࠤ",
+  "ࠥ",
+  "ࠦ",
+  "ࠧ",
+  "ࠨ",
+  "ࠩ",
+  "ࠪ",
+  "ࠫ",
+  "ࠬ",
+  "࠭",
+  "࠰",
+  "࠱",
+  "࠲",
+  "࠳",
+  "࠴",
+  "࠵",
+  "࠶",
+  "࠷",
+  "࠸",
+  "࠹",
+  "࠺",
+  "࠻",
+  "࠼",
+  "࠽",
+  "࠾",
+};
+const char *ALPHA_251_LOWER[] = {
+  "ࠀ",
+  "ࠁ",
+  "ࠂ",
+  "ࠃ",
+  "ࠄ",
+  "ࠅ",
+  "ࠆ",
+  "ࠇ",
+  "ࠈ",
+  "ࠉ",
+  "ࠊ",
+  "ࠋ",
+  "ࠌ",
+  "ࠍ",
+  "ࠎ",
+  "ࠏ",
+  "ࠐ",
+  "ࠑ",
+  "ࠒ",
+  "ࠓ",
+  "ࠔ",
+  "ࠕ",
+  "ࠖ",
+  "ࠗ",
+  "࠘",
+  "࠙",
+  "ࠚ",
+  "ࠛ",
+  "ࠜ",
+  "ࠝ",
+  "ࠞ",
+  "ࠟ",
+  "ࠠ",
+  "ࠡ",
+  "ࠢ",
+  "ࠣ",
+  "ࠤ",
+  "ࠥ",
+  "ࠦ",
+  "ࠧ",
+  "ࠨ",
+  "ࠩ",
+  "ࠪ",
+  "ࠫ",
+  "ࠬ",
+  "࠭",
+  "࠰",
+  "࠱",
+  "࠲",
+  "࠳",
+  "࠴",
+  "࠵",
+  "࠶",
+  "࠷",
+  "࠸",
+  "࠹",
+  "࠺",
+  "࠻",
+  "࠼",
+  "࠽",
+  "࠾",
+};
+const char *ALPHA_251_DIGITS[] = {
+};
+const uint32_t ALPHA_251_UPPER_CPS[] = {
+  2048, 2049, 2050, 2051, 2052, 2053, 2054, 2055, 2056, 2057, 2058, 2059, 2060, 2061, 2062, 2063,
+  2064, 2065, 2066, 2067, 2068, 2069, 2070, 2071, 2072, 2073, 2074, 2075, 2076, 2077, 2078, 2079,
+  2080, 2081, 2082, 2083, 2084, 2085, 2086, 2087, 2088, 2089, 2090, 2091, 2092, 2093, 2096, 2097,
+  2098, 2099, 2100, 2101, 2102, 2103, 2104, 2105, 2106, 2107, 2108, 2109, 2110,
+};
+const uint32_t ALPHA_251_LOWER_CPS[] = {
+  2048, 2049, 2050, 2051, 2052, 2053, 2054, 2055, 2056, 2057, 2058, 2059, 2060, 2061, 2062, 2063,
+  2064, 2065, 2066, 2067, 2068, 2069, 2070, 2071, 2072, 2073, 2074, 2075, 2076, 2077, 2078, 2079,
+  2080, 2081, 2082, 2083, 2084, 2085, 2086, 2087, 2088, 2089, 2090, 2091, 2092, 2093, 2096, 2097,
+  2098, 2099, 2100, 2101, 2102, 2103, 2104, 2105, 2106, 2107, 2108, 2109, 2110,
+};
+const uint32_t ALPHA_251_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_251_FREQ[] = {
+  { "ࠀ", 0.00000000 },
+  { "ࠁ", 0.00000000 },
+  { "ࠂ", 0.00000000 },
+  { "ࠃ", 0.00000000 },
+  { "ࠄ", 0.00000000 },
+  { "ࠅ", 0.00000000 },
+  { "ࠆ", 0.00000000 },
+  { "ࠇ", 0.00000000 },
+  { "ࠈ", 0.00000000 },
+  { "ࠉ", 0.00000000 },
+  { "ࠊ", 0.00000000 },
+  { "ࠋ", 0.00000000 },
+  { "ࠌ", 0.00000000 },
+  { "ࠍ", 0.00000000 },
+  { "ࠎ", 0.00000000 },
+  { "ࠏ", 0.00000000 },
+  { "ࠐ", 0.00000000 },
+  { "ࠑ", 0.00000000 },
+  { "ࠒ", 0.00000000 },
+  { "ࠓ", 0.00000000 },
+  { "ࠔ", 0.00000000 },
+  { "ࠕ", 0.00000000 },
+  { "ࠖ", 0.00000000 },
+  { "ࠗ", 0.00000000 },
+  { "࠘", 0.00000000 },
+  { "࠙", 0.00000000 },
+  { "ࠚ", 0.00000000 },
+  { "ࠛ", 0.00000000 },
+  { "ࠜ", 0.00000000 },
+  { "ࠝ", 0.00000000 },
+  { "ࠞ", 0.00000000 },
+  { "ࠟ", 0.00000000 },
+  { "ࠠ", 0.00000000 },
+  { "ࠡ", 0.00000000 },
+  { "ࠢ", 0.00000000 },
+  { "ࠣ", 0.00000000 },
+  { "ࠤ", 0.00000000 },
+  { "ࠥ", 0.00000000 },
+  { "ࠦ", 0.00000000 },
+  { "ࠧ", 0.00000000 },
+  { "ࠨ", 0.00000000 },
+  { "ࠩ", 0.00000000 },
+  { "ࠪ", 0.00000000 },
+  { "ࠫ", 0.00000000 },
+  { "ࠬ", 0.00000000 },
+  { "࠭", 0.00000000 },
+  { "࠰", 0.00000000 },
+  { "࠱", 0.00000000 },
+  { "࠲", 0.00000000 },
+  { "࠳", 0.00000000 },
+  { "࠴", 0.00000000 },
+  { "࠵", 0.00000000 },
+  { "࠶", 0.00000000 },
+  { "࠷", 0.00000000 },
+  { "࠸", 0.00000000 },
+  { "࠹", 0.00000000 },
+  { "࠺", 0.00000000 },
+  { "࠻", 0.00000000 },
+  { "࠼", 0.00000000 },
+  { "࠽", 0.00000000 },
+  { "࠾", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_251_FREQ_CPS[] = {
+  { 0x800u, 0.00000000 },
+  { 0x801u, 0.00000000 },
+  { 0x802u, 0.00000000 },
+  { 0x803u, 0.00000000 },
+  { 0x804u, 0.00000000 },
+  { 0x805u, 0.00000000 },
+  { 0x806u, 0.00000000 },
+  { 0x807u, 0.00000000 },
+  { 0x808u, 0.00000000 },
+  { 0x809u, 0.00000000 },
+  { 0x80Au, 0.00000000 },
+  { 0x80Bu, 0.00000000 },
+  { 0x80Cu, 0.00000000 },
+  { 0x80Du, 0.00000000 },
+  { 0x80Eu, 0.00000000 },
+  { 0x80Fu, 0.00000000 },
+  { 0x810u, 0.00000000 },
+  { 0x811u, 0.00000000 },
+  { 0x812u, 0.00000000 },
+  { 0x813u, 0.00000000 },
+  { 0x814u, 0.00000000 },
+  { 0x815u, 0.00000000 },
+  { 0x816u, 0.00000000 },
+  { 0x817u, 0.00000000 },
+  { 0x818u, 0.00000000 },
+  { 0x819u, 0.00000000 },
+  { 0x81Au, 0.00000000 },
+  { 0x81Bu, 0.00000000 },
+  { 0x81Cu, 0.00000000 },
+  { 0x81Du, 0.00000000 },
+  { 0x81Eu, 0.00000000 },
+  { 0x81Fu, 0.00000000 },
+  { 0x820u, 0.00000000 },
+  { 0x821u, 0.00000000 },
+  { 0x822u, 0.00000000 },
+  { 0x823u, 0.00000000 },
+  { 0x824u, 0.00000000 },
+  { 0x825u, 0.00000000 },
+  { 0x826u, 0.00000000 },
+  { 0x827u, 0.00000000 },
+  { 0x828u, 0.00000000 },
+  { 0x829u, 0.00000000 },
+  { 0x82Au, 0.00000000 },
+  { 0x82Bu, 0.00000000 },
+  { 0x82Cu, 0.00000000 },
+  { 0x82Du, 0.00000000 },
+  { 0x830u, 0.00000000 },
+  { 0x831u, 0.00000000 },
+  { 0x832u, 0.00000000 },
+  { 0x833u, 0.00000000 },
+  { 0x834u, 0.00000000 },
+  { 0x835u, 0.00000000 },
+  { 0x836u, 0.00000000 },
+  { 0x837u, 0.00000000 },
+  { 0x838u, 0.00000000 },
+  { 0x839u, 0.00000000 },
+  { 0x83Au, 0.00000000 },
+  { 0x83Bu, 0.00000000 },
+  { 0x83Cu, 0.00000000 },
+  { 0x83Du, 0.00000000 },
+  { 0x83Eu, 0.00000000 },
+};
+
@@ -0,0 +1,139 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_253_UPPER[] = {
+  "अ",
+  "आ",
+  "ई",
+  "उ",
+  "ए",
+  "ओ",
+  "क",
+  "ग",
+  "च",
+  "ज",
+  "ञ",
+  "ट",
+  "ड",
+  "ण",
+  "त",
+  "द",
+  "न",
+  "प",
+  "ब",
+  "म",
+  "य",
+  "र",
+  "ल",
+  "व",
+  "स",
+  "ह",
+};
+const char *ALPHA_253_LOWER[] = {
+  "अ",
+  "आ",
+  "ई",
+  "उ",
+  "ए",
+  "ओ",
+  "क",
+  "ग",
+  "च",
+  "ज",
+  "ञ",
+  "ट",
+  "ड",
+  "ण",
+  "त",
+  "द",
+  "न",
+  "प",
+  "ब",
+  "म",
+  "य",
+  "र",
+  "ल",
+  "व",
+  "स",
+  "ह",
+};
+const char *ALPHA_253_DIGITS[] = {
+  "०",
+  "१",
+  "२",
+  "३",
+  "४",
+  "५",
+  "६",
+  "७",
+  "८",
+  "९",
+};
+const uint32_t ALPHA_253_UPPER_CPS[] = {
+  2309, 2310, 2312, 2313, 2319, 2323, 2325, 2327, 2330, 2332, 2334, 2335, 2337, 2339, 2340, 2342,
+  2344, 2346, 2348, 2350, 2351, 2352, 2354, 2357, 2360, 2361,
+};
+const uint32_t ALPHA_253_LOWER_CPS[] = {
+  2309, 2310, 2312, 2313, 2319, 2323, 2325, 2327, 2330, 2332, 2334, 2335, 2337, 2339, 2340, 2342,
+  2344, 2346, 2348, 2350, 2351, 2352, 2354, 2357, 2360, 2361,
+};
+const uint32_t ALPHA_253_DIGITS_CPS[] = {
+  2406, 2407, 2408, 2409, 2410, 2411, 2412, 2413, 2414, 2415,
+};
+const wa_freq_entry ALPHA_253_FREQ[] = {
+  { "अ", 0.00000000 },
+  { "आ", 0.00000000 },
+  { "ई", 0.00000000 },
+  { "उ", 0.00000000 },
+  { "ए", 0.00000000 },
+  { "ओ", 0.00000000 },
+  { "क", 0.00000000 },
+  { "ग", 0.00000000 },
+  { "च", 0.00000000 },
+  { "ज", 0.00000000 },
+  { "ञ", 0.00000000 },
+  { "ट", 0.00000000 },
+  { "ड", 0.00000000 },
+  { "ण", 0.00000000 },
+  { "त", 0.00000000 },
+  { "द", 0.00000000 },
+  { "न", 0.00000000 },
+  { "प", 0.00000000 },
+  { "ब", 0.00000000 },
+  { "म", 0.00000000 },
+  { "य", 0.00000000 },
+  { "र", 0.00000000 },
+  { "ल", 0.00000000 },
+  { "व", 0.00000000 },
+  { "स", 0.00000000 },
+  { "ह", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_253_FREQ_CPS[] = {
+  { 0x905u, 0.00000000 },
+  { 0x906u, 0.00000000 },
+  { 0x908u, 0.00000000 },
+  { 0x909u, 0.00000000 },
+  { 0x90Fu, 0.00000000 },
+  { 0x913u, 0.00000000 },
+  { 0x915u, 0.00000000 },
+  { 0x917u, 0.00000000 },
+  { 0x91Au, 0.00000000 },
+  { 0x91Cu, 0.00000000 },
+  { 0x91Eu, 0.00000000 },
+  { 0x91Fu, 0.00000000 },
+  { 0x921u, 0.00000000 },
+  { 0x923u, 0.00000000 },
+  { 0x924u, 0.00000000 },
+  { 0x926u, 0.00000000 },
+  { 0x928u, 0.00000000 },
+  { 0x92Au, 0.00000000 },
+  { 0x92Cu, 0.00000000 },
+  { 0x92Eu, 0.00000000 },
+  { 0x92Fu, 0.00000000 },
+  { 0x930u, 0.00000000 },
+  { 0x932u, 0.00000000 },
+  { 0x935u, 0.00000000 },
+  { 0x938u, 0.00000000 },
+  { 0x939u, 0.00000000 },
+};
+
@@ -0,0 +1,181 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_254_UPPER[] = {
+  "ᱚ",
+  "ᱛ",
+  "ᱜ",
+  "ᱝ",
+  "ᱞ",
+  "ᱟ",
+  "ᱠ",
+  "ᱡ",
+  "ᱢ",
+  "ᱣ",
+  "ᱤ",
+  "ᱥ",
+  "ᱦ",
+  "ᱧ",
+  "ᱨ",
+  "ᱩ",
+  "ᱪ",
+  "ᱫ",
+  "ᱬ",
+  "ᱭ",
+  "ᱮ",
+  "ᱯ",
+  "ᱰ",
+  "ᱱ",
+  "ᱲ",
+  "ᱳ",
+  "ᱴ",
+  "ᱵ",
+  "ᱶ",
+  "ᱷ",
+  "ᱸ",
+  "ᱹ",
+  "ᱺ",
+  "ᱻ",
+  "ᱼ",
+  "ᱽ",
+};
+const char *ALPHA_254_LOWER[] = {
+  "ᱚ",
+  "ᱛ",
+  "ᱜ",
+  "ᱝ",
+  "ᱞ",
+  "ᱟ",
+  "ᱠ",
+  "ᱡ",
+  "ᱢ",
+  "ᱣ",
+  "ᱤ",
+  "ᱥ",
+  "ᱦ",
+  "ᱧ",
+  "ᱨ",
+  "ᱩ",
+  "ᱪ",
+  "ᱫ",
+  "ᱬ",
+  "ᱭ",
+  "ᱮ",
+  "ᱯ",
+  "ᱰ",
+  "ᱱ",
+  "ᱲ",
+  "ᱳ",
+  "ᱴ",
+  "ᱵ",
+  "ᱶ",
+  "ᱷ",
+  "ᱸ",
+  "ᱹ",
+  "ᱺ",
+  "ᱻ",
+  "ᱼ",
+  "ᱽ",
+};
+const char *ALPHA_254_DIGITS[] = {
+  "᱐",
+  "᱑",
+  "᱒",
+  "᱓",
+  "᱔",
+  "᱕",
+  "᱖",
+  "᱗",
+  "᱘",
+  "᱙",
+};
+const uint32_t ALPHA_254_UPPER_CPS[] = {
+  7258, 7259, 7260, 7261, 7262, 7263, 7264, 7265, 7266, 7267, 7268, 7269, 7270, 7271, 7272, 7273,
+  7274, 7275, 7276, 7277, 7278, 7279, 7280, 7281, 7282, 7283, 7284, 7285, 7286, 7287, 7288, 7289,
+  7290, 7291, 7292, 7293,
+};
+const uint32_t ALPHA_254_LOWER_CPS[] = {
+  7258, 7259, 7260, 7261, 7262, 7263, 7264, 7265, 7266, 7267, 7268, 7269, 7270, 7271, 7272, 7273,
+  7274, 7275, 7276, 7277, 7278, 7279, 7280, 7281, 7282, 7283, 7284, 7285, 7286, 7287, 7288, 7289,
+  7290, 7291, 7292, 7293,
+};
+const uint32_t ALPHA_254_DIGITS_CPS[] = {
+  7248, 7249, 7250, 7251, 7252, 7253, 7254, 7255, 7256, 7257,
+};
+const wa_freq_entry ALPHA_254_FREQ[] = {
+  { "ᱚ", 0.00000000 },
+  { "ᱛ", 0.00000000 },
+  { "ᱜ", 0.00000000 },
+  { "ᱝ", 0.00000000 },
+  { "ᱞ", 0.00000000 },
+  { "ᱟ", 0.00000000 },
+  { "ᱠ", 0.00000000 },
+  { "ᱡ", 0.00000000 },
+  { "ᱢ", 0.00000000 },
+  { "ᱣ", 0.00000000 },
+  { "ᱤ", 0.00000000 },
+  { "ᱥ", 0.00000000 },
+  { "ᱦ", 0.00000000 },
+  { "ᱧ", 0.00000000 },
+  { "ᱨ", 0.00000000 },
+  { "ᱩ", 0.00000000 },
+  { "ᱪ", 0.00000000 },
+  { "ᱫ", 0.00000000 },
+  { "ᱬ", 0.00000000 },
+  { "ᱭ", 0.00000000 },
+  { "ᱮ", 0.00000000 },
+  { "ᱯ", 0.00000000 },
+  { "ᱰ", 0.00000000 },
+  { "ᱱ", 0.00000000 },
+  { "ᱲ", 0.00000000 },
+  { "ᱳ", 0.00000000 },
+  { "ᱴ", 0.00000000 },
+  { "ᱵ", 0.00000000 },
+  { "ᱶ", 0.00000000 },
+  { "ᱷ", 0.00000000 },
+  { "ᱸ", 0.00000000 },
+  { "ᱹ", 0.00000000 },
+  { "ᱺ", 0.00000000 },
+  { "ᱻ", 0.00000000 },
+  { "ᱼ", 0.00000000 },
+  { "ᱽ", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_254_FREQ_CPS[] = {
+  { 0x1C5Au, 0.00000000 },
+  { 0x1C5Bu, 0.00000000 },
+  { 0x1C5Cu, 0.00000000 },
+  { 0x1C5Du, 0.00000000 },
+  { 0x1C5Eu, 0.00000000 },
+  { 0x1C5Fu, 0.00000000 },
+  { 0x1C60u, 0.00000000 },
+  { 0x1C61u, 0.00000000 },
+  { 0x1C62u, 0.00000000 },
+  { 0x1C63u, 0.00000000 },
+  { 0x1C64u, 0.00000000 },
+  { 0x1C65u, 0.00000000 },
+  { 0x1C66u, 0.00000000 },
+  { 0x1C67u, 0.00000000 },
+  { 0x1C68u, 0.00000000 },
+  { 0x1C69u, 0.00000000 },
+  { 0x1C6Au, 0.00000000 },
+  { 0x1C6Bu, 0.00000000 },
+  { 0x1C6Cu, 0.00000000 },
+  { 0x1C6Du, 0.00000000 },
+  { 0x1C6Eu, 0.00000000 },
+  { 0x1C6Fu, 0.00000000 },
+  { 0x1C70u, 0.00000000 },
+  { 0x1C71u, 0.00000000 },
+  { 0x1C72u, 0.00000000 },
+  { 0x1C73u, 0.00000000 },
+  { 0x1C74u, 0.00000000 },
+  { 0x1C75u, 0.00000000 },
+  { 0x1C76u, 0.00000000 },
+  { 0x1C77u, 0.00000000 },
+  { 0x1C78u, 0.00000000 },
+  { 0x1C79u, 0.00000000 },
+  { 0x1C7Au, 0.00000000 },
+  { 0x1C7Bu, 0.00000000 },
+  { 0x1C7Cu, 0.00000000 },
+  { 0x1C7Du, 0.00000000 },
+};
+
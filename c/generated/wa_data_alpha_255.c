@@ -0,0 +1,233 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_255_UPPER[] = {
+  "ꢒ",
+  "ꢓ",
+  "ꢔ",
+  "ꢕ",
+  "ꢖ",
+  "ꢗ",
+  "ꢘ",
+  "ꢙ",
+  "ꢚ",
+  "ꢛ",
+  "ꢜ",
+  "ꢝ",
+  "ꢞ",
+  "ꢟ",
+  "ꢠ",
+  "ꢡ",
+  "ꢢ",
+  "ꢣ",
+  "ꢤ",
+  "ꢥ",
+  "ꢦ",
+  "ꢧ",
+  "ꢨ",
+  "ꢩ",
+  "ꢪ",
+  "ꢫ",
+  "ꢬ",
+  "ꢭ",
+  "ꢮ",
+  "ꢯ",
+  "ꢰ",
+  "ꢱ",
+  "ꢲ",
+  "ꢳ",
+  "ꢴ",
+  "ꢵ",
+  "ꢶ",
+  "ꢷ",
+  "ꢸ",
+  "ꢹ",
+  "ꢺ",
+  "ꢻ",
+  "ꢼ",
+  "ꢽ",
+  "ꢾ",
+  "ꢿ",
+  "ꣀ",
+  "ꣁ",
+  "ꣂ",
+  "ꣃ",
+  "꣄",
+};
+const char *ALPHA_255_LOWER[] = {
+  "ꢒ",
+  "ꢓ",
+  "ꢔ",
+  "ꢕ",
+  "ꢖ",
+  "ꢗ",
+  "ꢘ",
+  "ꢙ",
+  "ꢚ",
+  "ꢛ",
+  "ꢜ",
+  "ꢝ",
+  "ꢞ",
+  "ꢟ",
+  "ꢠ",
+  "ꢡ",
+  "ꢢ",
+  "ꢣ",
+  "ꢤ",
+  "ꢥ",
+  "ꢦ",
+  "ꢧ",
+  "ꢨ",
+  "ꢩ",
+  "ꢪ",
+  "ꢫ",
+  "ꢬ",
+  "ꢭ",
+  "ꢮ",
+  "ꢯ",
+  "ꢰ",
+  "ꢱ",
+  "ꢲ",
+  "ꢳ",
+  "ꢴ",
+  "ꢵ",
+  "ꢶ",
+  "ꢷ",
+  "ꢸ",
+  "ꢹ",
+  "ꢺ",
+  "ꢻ",
+  "ꢼ",
+  "ꢽ",
+  "ꢾ",
+  "ꢿ",
+  "ꣀ",
+  "ꣁ",
+  "ꣂ",
+  "ꣃ",
+  "꣄",
+};
+const char *ALPHA_255_DIGITS[] = {
+};
+const uint32_t ALPHA_255_UPPER_CPS[] = {
+  43154, 43155, 43156, 43157, 43158, 43159, 43160, 43161, 43162, 43163, 43164, 43165, 43166, 43167, 43168, 43169,
+  43170, 43171, 43172, 43173, 43174, 43175, 43176, 43177, 43178, 43179, 43180, 43181, 43182, 43183, 43184, 43185,
+  43186, 43187, 43188, 43189, 43190, 43191, 43192, 43193, 43194, 43195, 43196, 43197, 43198, 43199, 43200, 43201,
+  43202, 43203, 43204,
+};
+const uint32_t ALPHA_255_LOWER_CPS[] = {
+  43154, 43155, 43156, 43157, 43158, 43159, 43160, 43161, 43162, 43163, 43164, 43165, 43166, 43167, 43168, 43169,
+  43170, 43171, 43172, 43173, 43174, 43175, 43176, 43177, 43178, 43179, 43180, 43181, 43182, 43183, 43184, 43185,
+  43186, 43187, 43188, 43189, 43190, 43191, 43192, 43193, 43194, 43195, 43196, 43197, 43198, 43199, 43200, 43201,
+  43202, 43203, 43204,
+};
+const uint32_t ALPHA_255_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_255_FREQ[] = {
+  { "ꢒ", 0.00000000 },
+  { "ꢓ", 0.00000000 },
+  { "ꢔ", 0.00000000 },
+  { "ꢕ", 0.00000000 },
+  { "ꢖ", 0.00000000 },
+  { "ꢗ", 0.00000000 },
+  { "ꢘ", 0.00000000 },
+  { "ꢙ", 0.00000000 },
+  { "ꢚ", 0.00000000 },
+  { "ꢛ", 0.00000000 },
+  { "ꢜ", 0.00000000 },
+  { "ꢝ", 0.00000000 },
+  { "ꢞ", 0.00000000 },
+  { "ꢟ", 0.00000000 },
+  { "ꢠ", 0.00000000 },
+  { "ꢡ", 0.00000000 },
+  { "ꢢ", 0.00000000 },
+  { "ꢣ", 0.00000000 },
+  { "ꢤ", 0.00000000 },
+  { "ꢥ", 0.00000000 },
+  { "ꢦ", 0.00000000 },
+  { "ꢧ", 0.00000000 },
+  { "ꢨ", 0.00000000 },
+  { "ꢩ", 0.00000000 },
+  { "ꢪ", 0.00000000 },
+  { "ꢫ", 0.00000000 },
+  { "ꢬ", 0.00000000 },
+  { "ꢭ", 0.00000000 },
+  { "ꢮ", 0.00000000 },
+  { "ꢯ", 0.00000000 },
+  { "ꢰ", 0.00000000 },
+  { "ꢱ", 0.00000000 },
+  { "ꢲ", 0.00000000 },
+  { "ꢳ", 0.00000000 },
+  { "ꢴ", 0.00000000 },
+  { "ꢵ", 0.00000000 },
+  { "ꢶ", 0.00000000 },
+  { "ꢷ", 0.00000000 },
+  { "ꢸ", 0.00000000 },
+  { "ꢹ", 0.00000000 },
+  { "ꢺ", 0.00000000 },
+  { "ꢻ", 0.00000000 },
+  { "ꢼ", 0.00000000 },
+  { "ꢽ", 0.00000000 },
+  { "ꢾ", 0.00000000 },
+  { "ꢿ", 0.00000000 },
+  { "ꣀ", 0.00000000 },
+  { "ꣁ", 0.00000000 },
+  { "ꣂ", 0.00000000 },
+  { "ꣃ", 0.00000000 },
+  { "꣄", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_255_FREQ_CPS[] = {
+  { 0xA892u, 0.00000000 },
+  { 0xA893u, 0.00000000 },
+  { 0xA894u, 0.00000000 },
+  { 0xA895u, 0.00000000 },
+  { 0xA896u, 0.00000000 },
+  { 0xA897u, 0.00000000 },
+  { 0xA898u, 0.00000000 },
+  { 0xA899u, 0.00000000 },
+  { 0xA89Au, 0.00000000 },
+  { 0xA89Bu, 0.00000000 },
+  { 0xA89Cu, 0.00000000 },
+  { 0xA89Du, 0.00000000 },
+  { 0xA89Eu, 0.00000000 },
+  { 0xA89Fu, 0.00000000 },
+  { 0xA8A0u, 0.00000000 },
+  { 0xA8A1u, 0.00000000 },
+  { 0xA8A2u, 0.00000000 },
+  { 0xA8A3u, 0.00000000 },
+  { 0xA8A4u, 0.00000000 },
+  { 0xA8A5u, 0.00000000 },
+  { 0xA8A6u, 0.00000000 },
+  { 0xA8A7u, 0.00000000 },
+  { 0xA8A8u, 0.00000000 },
+  { 0xA8A9u, 0.00000000 },
+  { 0xA8AAu, 0.00000000 },
+  { 0xA8ABu, 0.00000000 },
+  { 0xA8ACu, 0.00000000 },
+  { 0xA8ADu, 0.00000000 },
+  { 0xA8AEu, 0.00000000 },
+  { 0xA8AFu, 0.00000000 },
+  { 0xA8B0u, 0.00000000 },
+  { 0xA8B1u, 0.00000000 },
+  { 0xA8B2u, 0.00000000 },
+  { 0xA8B3u, 0.00000000 },
+  { 0xA8B4u, 0.00000000 },
+  { 0xA8B5u, 0.00000000 },
+  { 0xA8B6u, 0.00000000 },
+  { 0xA8B7u, 0.00000000 },
+  { 0xA8B8u, 0.00000000 },
+  { 0xA8B9u, 0.00000000 },
+  { 0xA8BAu, 0.00000000 },
+  { 0xA8BBu, 0.00000000 },
+  { 0xA8BCu, 0.00000000 },
+  { 0xA8BDu, 0.00000000 },
+  { 0xA8BEu, 0.00000000 },
+  { 0xA8BFu, 0.00000000 },
+  { 0xA8C0u, 0.00000000 },
+  { 0xA8C1u, 0.00000000 },
+  { 0xA8C2u, 0.00000000 },
+  { 0xA8C3u, 0.00000000 },
+  { 0xA8C4u, 0.00000000 },
+};
+
@@ -0,0 +1,129 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_257_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "À",
+  "È",
+  "Ì",
+  "Ò",
+  "Ù",
+  "Z",
+};
+const char *ALPHA_257_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "à",
+  "è",
+  "ì",
+  "ò",
+  "ù",
+  "z",
+};
+const char *ALPHA_257_DIGITS[] = {
+};
+const uint32_t ALPHA_257_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 76, 77, 78, 79, 80, 82,
+  83, 84, 85, 86, 90, 192, 200, 204, 210, 217,
+};
+const uint32_t ALPHA_257_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 108, 109, 110, 111, 112, 114,
+  115, 116, 117, 118, 122, 224, 232, 236, 242, 249,
+};
+const uint32_t ALPHA_257_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_257_FREQ[] = {
+  { "a", 0.12750000 },
+  { "b", 0.01410000 },
+  { "c", 0.03570000 },
+  { "d", 0.05440000 },
+  { "e", 0.09700000 },
+  { "f", 0.01110000 },
+  { "g", 0.01700000 },
+  { "h", 0.00940000 },
+  { "i", 0.10020000 },
+  { "j", 0.00140000 },
+  { "l", 0.02730000 },
+  { "m", 0.02660000 },
+  { "n", 0.07400000 },
+  { "o", 0.05490000 },
+  { "p", 0.02450000 },
+  { "r", 0.05810000 },
+  { "s", 0.10140000 },
+  { "t", 0.06860000 },
+  { "u", 0.07160000 },
+  { "v", 0.00750000 },
+  { "à", 0.00230000 },
+  { "è", 0.00150000 },
+  { "ì", 0.00200000 },
+  { "ò", 0.00120000 },
+  { "ù", 0.00070000 },
+  { "z", 0.01010000 },
+};
+
+const wa_cp_freq ALPHA_257_FREQ_CPS[] = {
+  { 0x61u, 0.12750000 },
+  { 0x62u, 0.01410000 },
+  { 0x63u, 0.03570000 },
+  { 0x64u, 0.05440000 },
+  { 0x65u, 0.09700000 },
+  { 0x66u, 0.01110000 },
+  { 0x67u, 0.01700000 },
+  { 0x68u, 0.00940000 },
+  { 0x69u, 0.10020000 },
+  { 0x6Au, 0.00140000 },
+  { 0x6Cu, 0.02730000 },
+  { 0x6Du, 0.02660000 },
+  { 0x6Eu, 0.07400000 },
+  { 0x6Fu, 0.05490000 },
+  { 0x70u, 0.02450000 },
+  { 0x72u, 0.05810000 },
+  { 0x73u, 0.10140000 },
+  { 0x74u, 0.06860000 },
+  { 0x75u, 0.07160000 },
+  { 0x76u, 0.00750000 },
+  { 0x7Au, 0.01010000 },
+  { 0xE0u, 0.00230000 },
+  { 0xE8u, 0.00150000 },
+  { 0xECu, 0.00200000 },
+  { 0xF2u, 0.00120000 },
+  { 0xF9u, 0.00070000 },
+};
+
@@ -0,0 +1,169 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_258_UPPER[] = {
+  "A",
+  "À",
+  "Â",
+  "B",
+  "C",
+  "D",
+  "Ḍ",
+  "E",
+  "È",
+  "Ê",
+  "F",
+  "G",
+  "H",
+  "I",
+  "Ì",
+  "Î",
+  "J",
+  "L",
+  "M",
+  "N",
+  "O",
+  "Ò",
+  "Ô",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "Ù",
+  "Û",
+  "V",
+  "Z",
+};
+const char *ALPHA_258_LOWER[] = {
+  "a",
+  "à",
+  "â",
+  "b",
+  "c",
+  "d",
+  "ḍ",
+  "e",
+  "è",
+  "ê",
+  "f",
+  "g",
+  "h",
+  "i",
+  "ì",
+  "î",
+  "j",
+  "l",
+  "m",
+  "n",
+  "o",
+  "ò",
+  "ô",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "ù",
+  "û",
+  "v",
+  "z",
+};
+const char *ALPHA_258_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_258_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 76, 77, 78, 79, 80, 81,
+  82, 83, 84, 85, 86, 90, 192, 194, 200, 202, 204, 206, 210, 212, 217, 219,
+  7692,
+};
+const uint32_t ALPHA_258_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 108, 109, 110, 111, 112, 113,
+  114, 115, 116, 117, 118, 122, 224, 226, 232, 234, 236, 238, 242, 244, 249, 251,
+  7693,
+};
+const uint32_t ALPHA_258_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_258_FREQ[] = {
+  { "a", 0.11870000 },
+  { "à", 0.00410000 },
+  { "â", 0.00370000 },
+  { "b", 0.01090000 },
+  { "c", 0.05300000 },
+  { "d", 0.03790000 },
+  { "ḍ", 0.00000000 },
+  { "e", 0.03700000 },
+  { "è", 0.00640000 },
+  { "ê", 0.00070000 },
+  { "f", 0.01140000 },
+  { "g", 0.01800000 },
+  { "h", 0.01080000 },
+  { "i", 0.15590000 },
+  { "ì", 0.00500000 },
+  { "î", 0.00140000 },
+  { "j", 0.00170000 },
+  { "l", 0.04590000 },
+  { "m", 0.02880000 },
+  { "n", 0.07850000 },
+  { "o", 0.02550000 },
+  { "ò", 0.00330000 },
+  { "ô", 0.00240000 },
+  { "p", 0.02900000 },
+  { "q", 0.00190000 },
+  { "r", 0.06390000 },
+  { "s", 0.04820000 },
+  { "t", 0.06910000 },
+  { "u", 0.09490000 },
+  { "ù", 0.00200000 },
+  { "û", 0.00240000 },
+  { "v", 0.01420000 },
+  { "z", 0.01330000 },
+};
+
+const wa_cp_freq ALPHA_258_FREQ_CPS[] = {
+  { 0x61u, 0.11870000 },
+  { 0x62u, 0.01090000 },
+  { 0x63u, 0.05300000 },
+  { 0x64u, 0.03790000 },
+  { 0x65u, 0.03700000 },
+  { 0x66u, 0.01140000 },
+  { 0x67u, 0.01800000 },
+  { 0x68u, 0.01080000 },
+  { 0x69u, 0.15590000 },
+  { 0x6Au, 0.00170000 },
+  { 0x6Cu, 0.04590000 },
+  { 0x6Du, 0.02880000 },
+  { 0x6Eu, 0.07850000 },
+  { 0x6Fu, 0.02550000 },
+  { 0x70u, 0.02900000 },
+  { 0x71u, 0.00190000 },
+  { 0x72u, 0.06390000 },
+  { 0x73u, 0.04820000 },
+  { 0x74u, 0.06910000 },
+  { 0x75u, 0.09490000 },
+  { 0x76u, 0.01420000 },
+  { 0x7Au, 0.01330000 },
+  { 0xE0u, 0.00410000 },
+  { 0xE2u, 0.00370000 },
+  { 0xE8u, 0.00640000 },
+  { 0xEAu, 0.00070000 },
+  { 0xECu, 0.00500000 },
+  { 0xEEu, 0.00140000 },
+  { 0xF2u, 0.00330000 },
+  { 0xF4u, 0.00240000 },
+  { 0xF9u, 0.00200000 },
+  { 0xFBu, 0.00240000 },
+  { 0x1E0Du, 0.00000000 },
+};
+
@@ -0,0 +1,237 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_259_UPPER[] = {
+  "ء",
+  "آ",
+  "ا",
+  "ب",
+  "ٻ",
+  "پ",
+  "ڀ",
+  "ت",
+  "ث",
+  "ٺ",
+  "ٽ",
+  "ٿ",
+  "ج",
+  "ڃ",
+  "ڄ",
+  "چ",
+  "ڇ",
+  "ح",
+  "خ",
+  "د",
+  "ذ",
+  "ڊ",
+  "ڌ",
+  "ڍ",
+  "ڏ",
+  "ر",
+  "ز",
+  "ڙ",
+  "س",
+  "ش",
+  "ص",
+  "ض",
+  "ط",
+  "ظ",
+  "ع",
+  "غ",
+  "ف",
+  "ڦ",
+  "ق",
+  "ک",
+  "ڪ",
+  "گ",
+  "ڱ",
+  "ڳ",
+  "ل",
+  "م",
+  "ن",
+  "ڻ",
+  "ه",
+  "ھ",
+  "و",
+  "ي",
+};
+const char *ALPHA_259_LOWER[] = {
+  "ء",
+  "آ",
+  "ا",
+  "ب",
+  "ٻ",
+  "پ",
+  "ڀ",
+  "ت",
+  "ث",
+  "ٺ",
+  "ٽ",
+  "ٿ",
+  "ج",
+  "ڃ",
+  "ڄ",
+  "چ",
+  "ڇ",
+  "ح",
+  "خ",
+  "د",
+  "ذ",
+  "ڊ",
+  "ڌ",
+  "ڍ",
+  "ڏ",
+  "ر",
+  "ز",
+  "ڙ",
+  "س",
+  "ش",
+  "ص",
+  "ض",
+  "ط",
+  "ظ",
+  "ع",
+  "غ",
+  "ف",
+  "ڦ",
+  "ق",
+  "ک",
+  "ڪ",
+  "گ",
+  "ڱ",
+  "ڳ",
+  "ل",
+  "م",
+  "ن",
+  "ڻ",
+  "ه",
+  "ھ",
+  "و",
+  "ي",
+};
+const char *ALPHA_259_DIGITS[] = {
+};
+const uint32_t ALPHA_259_UPPER_CPS[] = {
+  1569, 1570, 1575, 1576, 1578, 1579, 1580, 1581, 1582, 1583, 1584, 1585, 1586, 1587, 1588, 1589,
+  1590, 1591, 1592, 1593, 1594, 1601, 1602, 1604, 1605, 1606, 1607, 1608, 1610, 1658, 1659, 1661,
+  1662, 1663, 1664, 1667, 1668, 1670, 1671, 1674, 1676, 1677, 1679, 1689, 1702, 1705, 1706, 1711,
+  1713, 1715, 1723, 1726,
+};
+const uint32_t ALPHA_259_LOWER_CPS[] = {
+  1569, 1570, 1575, 1576, 1578, 1579, 1580, 1581, 1582, 1583, 1584, 1585, 1586, 1587, 1588, 1589,
+  1590, 1591, 1592, 1593, 1594, 1601, 1602, 1604, 1605, 1606, 1607, 1608, 1610, 1658, 1659, 1661,
+  1662, 1663, 1664, 1667, 1668, 1670, 1671, 1674, 1676, 1677, 1679, 1689, 1702, 1705, 1706, 1711,
+  1713, 1715, 1723, 1726,
+};
+const uint32_t ALPHA_259_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_259_FREQ[] = {
+  { "ٺ", 0.00230000 },
+  { "ڃ", 0.00130000 },
+  { "ز", 0.00560000 },
+  { "چ", 0.00530000 },
+  { "ڍ", 0.00090000 },
+  { "م", 0.03830000 },
+  { "ذ", 0.00150000 },
+  { "پ", 0.01650000 },
+  { "ر", 0.05860000 },
+  { "ا", 0.11230000 },
+  { "ب", 0.01940000 },
+  { "د", 0.02700000 },
+  { "ڦ", 0.00050000 },
+  { "ڪ", 0.03230000 },
+  { "ڊ", 0.00360000 },
+  { "ڳ", 0.00370000 },
+  { "ڻ", 0.01070000 },
+  { "ڄ", 0.00140000 },
+  { "ٿ", 0.00830000 },
+  { "ء", 0.00800000 },
+  { "ٽ", 0.00830000 },
+  { "ڌ", 0.00560000 },
+  { "ڙ", 0.00650000 },
+  { "ش", 0.00840000 },
+  { "ظ", 0.00180000 },
+  { "ٻ", 0.00350000 },
+  { "ل", 0.03350000 },
+  { "ڏ", 0.00740000 },
+  { "ع", 0.01190000 },
+  { "ھ", 0.00230000 },
+  { "غ", 0.00160000 },
+  { "ث", 0.00140000 },
+  { "ڱ", 0.00030000 },
+  { "گ", 0.00850000 },
+  { "آ", 0.01140000 },
+  { "ق", 0.00890000 },
+  { "ي", 0.13420000 },
+  { "و", 0.07950000 },
+  { "ح", 0.00840000 },
+  { "س", 0.03490000 },
+  { "ص", 0.00490000 },
+  { "ک", 0.01240000 },
+  { "ف", 0.00760000 },
+  { "ن", 0.09140000 },
+  { "ط", 0.00360000 },
+  { "ه", 0.06360000 },
+  { "ڀ", 0.00220000 },
+  { "خ", 0.00530000 },
+  { "ت", 0.03170000 },
+  { "ڇ", 0.00220000 },
+  { "ض", 0.00200000 },
+  { "ج", 0.03750000 },
+};
+
+const wa_cp_freq ALPHA_259_FREQ_CPS[] = {
+  { 0x621u, 0.00800000 },
+  { 0x622u, 0.01140000 },
+  { 0x627u, 0.11230000 },
+  { 0x628u, 0.01940000 },
+  { 0x62Au, 0.03170000 },
+  { 0x62Bu, 0.00140000 },
+  { 0x62Cu, 0.03750000 },
+  { 0x62Du, 0.00840000 },
+  { 0x62Eu, 0.00530000 },
+  { 0x62Fu, 0.02700000 },
+  { 0x630u, 0.00150000 },
+  { 0x631u, 0.05860000 },
+  { 0x632u, 0.00560000 },
+  { 0x633u, 0.03490000 },
+  { 0x634u, 0.00840000 },
+  { 0x635u, 0.00490000 },
+  { 0x636u, 0.00200000 },
+  { 0x637u, 0.00360000 },
+  { 0x638u, 0.00180000 },
+  { 0x639u, 0.01190000 },
+  { 0x63Au, 0.00160000 },
+  { 0x641u, 0.00760000 },
+  { 0x642u, 0.00890000 },
+  { 0x644u, 0.03350000 },
+  { 0x645u, 0.03830000 },
+  { 0x646u, 0.09140000 },
+  { 0x647u, 0.06360000 },
+  { 0x648u, 0.07950000 },
+  { 0x64Au, 0.13420000 },
+  { 0x67Au, 0.00230000 },
+  { 0x67Bu, 0.00350000 },
+  { 0x67Du, 0.00830000 },
+  { 0x67Eu, 0.01650000 },
+  { 0x67Fu, 0.00830000 },
+  { 0x680u, 0.00220000 },
+  { 0x683u, 0.00130000 },
+  { 0x684u, 0.00140000 },
+  { 0x686u, 0.00530000 },
+  { 0x687u, 0.00220000 },
+  { 0x68Au, 0.00360000 },
+  { 0x68Cu, 0.00560000 },
+  { 0x68Du, 0.00090000 },
+  { 0x68Fu, 0.00740000 },
+  { 0x699u, 0.00650000 },
+  { 0x6A6u, 0.00050000 },
+  { 0x6A9u, 0.01240000 },
+  { 0x6AAu, 0.03230000 },
+  { 0x6AFu, 0.00850000 },
+  { 0x6B1u, 0.00030000 },
+  { 0x6B3u, 0.00370000 },
+  { 0x6BBu, 0.01070000 },
+  { 0x6BEu, 0.00230000 },
+};
+
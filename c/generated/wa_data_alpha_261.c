@@ -0,0 +1,141 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_261_UPPER[] = {
+  "A",
+  "Á",
+  "B",
+  "C",
+  "Č",
+  "D",
+  "Đ",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "Ŋ",
+  "O",
+  "P",
+  "R",
+  "S",
+  "Š",
+  "T",
+  "Ŧ",
+  "U",
+  "V",
+  "Z",
+  "Ž",
+};
+const char *ALPHA_261_LOWER[] = {
+  "a",
+  "á",
+  "b",
+  "c",
+  "č",
+  "d",
+  "đ",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "ŋ",
+  "o",
+  "p",
+  "r",
+  "s",
+  "š",
+  "t",
+  "ŧ",
+  "u",
+  "v",
+  "z",
+  "ž",
+};
+const char *ALPHA_261_DIGITS[] = {
+};
+const uint32_t ALPHA_261_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  82, 83, 84, 85, 86, 90, 193, 268, 272, 330, 352, 358, 381,
+};
+const uint32_t ALPHA_261_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  114, 115, 116, 117, 118, 122, 225, 269, 273, 331, 353, 359, 382,
+};
+const uint32_t ALPHA_261_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_261_FREQ[] = {
+  { "a", 0.13600000 },
+  { "á", 0.03860000 },
+  { "b", 0.01440000 },
+  { "c", 0.00370000 },
+  { "č", 0.00600000 },
+  { "d", 0.04820000 },
+  { "đ", 0.00480000 },
+  { "e", 0.07820000 },
+  { "f", 0.00510000 },
+  { "g", 0.04120000 },
+  { "h", 0.02250000 },
+  { "i", 0.09310000 },
+  { "j", 0.02240000 },
+  { "k", 0.02930000 },
+  { "l", 0.06830000 },
+  { "m", 0.03380000 },
+  { "n", 0.04830000 },
+  { "ŋ", 0.00170000 },
+  { "o", 0.05400000 },
+  { "p", 0.01020000 },
+  { "r", 0.04170000 },
+  { "s", 0.05630000 },
+  { "š", 0.01020000 },
+  { "t", 0.04890000 },
+  { "ŧ", 0.00080000 },
+  { "u", 0.04600000 },
+  { "v", 0.03440000 },
+  { "z", 0.00070000 },
+  { "ž", 0.00140000 },
+};
+
+const wa_cp_freq ALPHA_261_FREQ_CPS[] = {
+  { 0x61u, 0.13600000 },
+  { 0x62u, 0.01440000 },
+  { 0x63u, 0.00370000 },
+  { 0x64u, 0.04820000 },
+  { 0x65u, 0.07820000 },
+  { 0x66u, 0.00510000 },
+  { 0x67u, 0.04120000 },
+  { 0x68u, 0.02250000 },
+  { 0x69u, 0.09310000 },
+  { 0x6Au, 0.02240000 },
+  { 0x6Bu, 0.02930000 },
+  { 0x6Cu, 0.06830000 },
+  { 0x6Du, 0.03380000 },
+  { 0x6Eu, 0.04830000 },
+  { 0x6Fu, 0.05400000 },
+  { 0x70u, 0.01020000 },
+  { 0x72u, 0.04170000 },
+  { 0x73u, 0.05630000 },
+  { 0x74u, 0.04890000 },
+  { 0x75u, 0.04600000 },
+  { 0x76u, 0.03440000 },
+  { 0x7Au, 0.00070000 },
+  { 0xE1u, 0.03860000 },
+  { 0x10Du, 0.00600000 },
+  { 0x111u, 0.00480000 },
+  { 0x14Bu, 0.00170000 },
+  { 0x161u, 0.01020000 },
+  { 0x167u, 0.00080000 },
+  { 0x17Eu, 0.00140000 },
+};
+
@@ -0,0 +1,163 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_263_UPPER[] = {
+  "A",
+  "Ã",
+  "B",
+  "C",
+  "D",
+  "E",
+  "Ẽ",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "Ɲ",
+  "Ŋ",
+  "O",
+  "Õ",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "Š",
+  "T",
+  "U",
+  "W",
+  "X",
+  "Y",
+  "Z",
+  "Ž",
+};
+const char *ALPHA_263_LOWER[] = {
+  "a",
+  "ã",
+  "b",
+  "c",
+  "d",
+  "e",
+  "ẽ",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "ɲ",
+  "ŋ",
+  "o",
+  "õ",
+  "p",
+  "q",
+  "r",
+  "s",
+  "š",
+  "t",
+  "u",
+  "w",
+  "x",
+  "y",
+  "z",
+  "ž",
+};
+const char *ALPHA_263_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_263_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 87, 88, 89, 90, 195, 213, 330, 352, 381, 413, 7868,
+};
+const uint32_t ALPHA_263_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 119, 120, 121, 122, 227, 245, 331, 353, 382, 626, 7869,
+};
+const uint32_t ALPHA_263_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_263_FREQ[] = {
+  { "a", 0.00000000 },
+  { "ã", 0.00000000 },
+  { "b", 0.00000000 },
+  { "c", 0.00000000 },
+  { "d", 0.00000000 },
+  { "e", 0.00000000 },
+  { "ẽ", 0.00000000 },
+  { "f", 0.00000000 },
+  { "g", 0.00000000 },
+  { "h", 0.00000000 },
+  { "i", 0.00000000 },
+  { "j", 0.00000000 },
+  { "k", 0.00000000 },
+  { "l", 0.00000000 },
+  { "m", 0.00000000 },
+  { "n", 0.00000000 },
+  { "ɲ", 0.00000000 },
+  { "ŋ", 0.00000000 },
+  { "o", 0.00000000 },
+  { "õ", 0.00000000 },
+  { "p", 0.00000000 },
+  { "q", 0.00000000 },
+  { "r", 0.00000000 },
+  { "s", 0.00000000 },
+  { "š", 0.00000000 },
+  { "t", 0.00000000 },
+  { "u", 0.00000000 },
+  { "w", 0.00000000 },
+  { "x", 0.00000000 },
+  { "y", 0.00000000 },
+  { "z", 0.00000000 },
+  { "ž", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_263_FREQ_CPS[] = {
+  { 0x61u, 0.00000000 },
+  { 0x62u, 0.00000000 },
+  { 0x63u, 0.00000000 },
+  { 0x64u, 0.00000000 },
+  { 0x65u, 0.00000000 },
+  { 0x66u, 0.00000000 },
+  { 0x67u, 0.00000000 },
+  { 0x68u, 0.00000000 },
+  { 0x69u, 0.00000000 },
+  { 0x6Au, 0.00000000 },
+  { 0x6Bu, 0.00000000 },
+  { 0x6Cu, 0.00000000 },
+  { 0x6Du, 0.00000000 },
+  { 0x6Eu, 0.00000000 },
+  { 0x6Fu, 0.00000000 },
+  { 0x70u, 0.00000000 },
+  { 0x71u, 0.00000000 },
+  { 0x72u, 0.00000000 },
+  { 0x73u, 0.00000000 },
+  { 0x74u, 0.00000000 },
+  { 0x75u, 0.00000000 },
+  { 0x77u, 0.00000000 },
+  { 0x78u, 0.00000000 },
+  { 0x79u, 0.00000000 },
+  { 0x7Au, 0.00000000 },
+  { 0xE3u, 0.00000000 },
+  { 0xF5u, 0.00000000 },
+  { 0x14Bu, 0.00000000 },
+  { 0x161u, 0.00000000 },
+  { 0x17Eu, 0.00000000 },
+  { 0x272u, 0.00000000 },
+  { 0x1EBDu, 0.00000000 },
+};
+
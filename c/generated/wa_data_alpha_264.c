@@ -0,0 +1,163 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_264_UPPER[] = {
+  "A",
+  "B",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "W",
+  "Y",
+  "Z",
+  "Â",
+  "Ä",
+  "Ê",
+  "Ë",
+  "Î",
+  "Ï",
+  "Ô",
+  "Ö",
+  "Ù",
+  "Û",
+  "Ü",
+};
+const char *ALPHA_264_LOWER[] = {
+  "a",
+  "b",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "w",
+  "y",
+  "z",
+  "â",
+  "ä",
+  "ê",
+  "ë",
+  "î",
+  "ï",
+  "ô",
+  "ö",
+  "ù",
+  "û",
+  "ü",
+};
+const char *ALPHA_264_DIGITS[] = {
+};
+const uint32_t ALPHA_264_UPPER_CPS[] = {
+  65, 66, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 82,
+  83, 84, 85, 86, 87, 89, 90, 194, 196, 202, 203, 206, 207, 212, 214, 217,
+  219, 220,
+};
+const uint32_t ALPHA_264_LOWER_CPS[] = {
+  97, 98, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 114,
+  115, 116, 117, 118, 119, 121, 122, 226, 228, 234, 235, 238, 239, 244, 246, 249,
+  251, 252,
+};
+const uint32_t ALPHA_264_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_264_FREQ[] = {
+  { "a", 0.09800000 },
+  { "b", 0.02920000 },
+  { "d", 0.02340000 },
+  { "e", 0.06360000 },
+  { "f", 0.00550000 },
+  { "g", 0.04220000 },
+  { "h", 0.01140000 },
+  { "i", 0.02230000 },
+  { "j", 0.00160000 },
+  { "k", 0.05010000 },
+  { "l", 0.03470000 },
+  { "m", 0.02300000 },
+  { "n", 0.09440000 },
+  { "o", 0.05610000 },
+  { "p", 0.01200000 },
+  { "r", 0.02540000 },
+  { "s", 0.03550000 },
+  { "t", 0.06560000 },
+  { "u", 0.01420000 },
+  { "v", 0.00240000 },
+  { "w", 0.01420000 },
+  { "y", 0.02540000 },
+  { "z", 0.01720000 },
+  { "â", 0.03530000 },
+  { "ä", 0.01960000 },
+  { "ê", 0.02740000 },
+  { "ë", 0.01390000 },
+  { "î", 0.07100000 },
+  { "ï", 0.01140000 },
+  { "ô", 0.01210000 },
+  { "ö", 0.03100000 },
+  { "ù", 0.00070000 },
+  { "û", 0.00670000 },
+  { "ü", 0.00360000 },
+};
+
+const wa_cp_freq ALPHA_264_FREQ_CPS[] = {
+  { 0x61u, 0.09800000 },
+  { 0x62u, 0.02920000 },
+  { 0x64u, 0.02340000 },
+  { 0x65u, 0.06360000 },
+  { 0x66u, 0.00550000 },
+  { 0x67u, 0.04220000 },
+  { 0x68u, 0.01140000 },
+  { 0x69u, 0.02230000 },
+  { 0x6Au, 0.00160000 },
+  { 0x6Bu, 0.05010000 },
+  { 0x6Cu, 0.03470000 },
+  { 0x6Du, 0.02300000 },
+  { 0x6Eu, 0.09440000 },
+  { 0x6Fu, 0.05610000 },
+  { 0x70u, 0.01200000 },
+  { 0x72u, 0.02540000 },
+  { 0x73u, 0.03550000 },
+  { 0x74u, 0.06560000 },
+  { 0x75u, 0.01420000 },
+  { 0x76u, 0.00240000 },
+  { 0x77u, 0.01420000 },
+  { 0x79u, 0.02540000 },
+  { 0x7Au, 0.01720000 },
+  { 0xE2u, 0.03530000 },
+  { 0xE4u, 0.01960000 },
+  { 0xEAu, 0.02740000 },
+  { 0xEBu, 0.01390000 },
+  { 0xEEu, 0.07100000 },
+  { 0xEFu, 0.01140000 },
+  { 0xF4u, 0.01210000 },
+  { 0xF6u, 0.03100000 },
+  { 0xF9u, 0.00070000 },
+  { 0xFBu, 0.00670000 },
+  { 0xFCu, 0.00360000 },
+};
+
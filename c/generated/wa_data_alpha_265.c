@@ -0,0 +1,133 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_265_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "Č",
+  "Ć",
+  "D",
+  "Đ",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "R",
+  "S",
+  "Š",
+  "T",
+  "U",
+  "V",
+  "Z",
+  "Ž",
+};
+const char *ALPHA_265_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "č",
+  "ć",
+  "d",
+  "đ",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "r",
+  "s",
+  "š",
+  "t",
+  "u",
+  "v",
+  "z",
+  "ž",
+};
+const char *ALPHA_265_DIGITS[] = {
+};
+const uint32_t ALPHA_265_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  82, 83, 84, 85, 86, 90, 262, 268, 272, 352, 381,
+};
+const uint32_t ALPHA_265_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  114, 115, 116, 117, 118, 122, 263, 269, 273, 353, 382,
+};
+const uint32_t ALPHA_265_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_265_FREQ[] = {
+  { "o", 0.09090000 },
+  { "t", 0.04380000 },
+  { "u", 0.04260000 },
+  { "s", 0.05000000 },
+  { "k", 0.03790000 },
+  { "c", 0.01070000 },
+  { "j", 0.05000000 },
+  { "m", 0.03130000 },
+  { "a", 0.11570000 },
+  { "h", 0.00850000 },
+  { "r", 0.05330000 },
+  { "š", 0.00700000 },
+  { "p", 0.02890000 },
+  { "d", 0.03350000 },
+  { "č", 0.00860000 },
+  { "i", 0.09830000 },
+  { "ž", 0.00470000 },
+  { "đ", 0.00220000 },
+  { "z", 0.01690000 },
+  { "e", 0.08790000 },
+  { "ć", 0.00400000 },
+  { "v", 0.03350000 },
+  { "n", 0.06610000 },
+  { "b", 0.01510000 },
+  { "f", 0.00390000 },
+  { "l", 0.03570000 },
+  { "g", 0.01890000 },
+};
+
+const wa_cp_freq ALPHA_265_FREQ_CPS[] = {
+  { 0x61u, 0.11570000 },
+  { 0x62u, 0.01510000 },
+  { 0x63u, 0.01070000 },
+  { 0x64u, 0.03350000 },
+  { 0x65u, 0.08790000 },
+  { 0x66u, 0.00390000 },
+  { 0x67u, 0.01890000 },
+  { 0x68u, 0.00850000 },
+  { 0x69u, 0.09830000 },
+  { 0x6Au, 0.05000000 },
+  { 0x6Bu, 0.03790000 },
+  { 0x6Cu, 0.03570000 },
+  { 0x6Du, 0.03130000 },
+  { 0x6Eu, 0.06610000 },
+  { 0x6Fu, 0.09090000 },
+  { 0x70u, 0.02890000 },
+  { 0x72u, 0.05330000 },
+  { 0x73u, 0.05000000 },
+  { 0x74u, 0.04380000 },
+  { 0x75u, 0.04260000 },
+  { 0x76u, 0.03350000 },
+  { 0x7Au, 0.01690000 },
+  { 0x107u, 0.00400000 },
+  { 0x10Du, 0.00860000 },
+  { 0x111u, 0.00220000 },
+  { 0x161u, 0.00700000 },
+  { 0x17Eu, 0.00470000 },
+};
+
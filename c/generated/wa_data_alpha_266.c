@@ -0,0 +1,159 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_266_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "Ḍ",
+  "E",
+  "Ɛ",
+  "F",
+  "G",
+  "ʷ",
+  "Ɣ",
+  "H",
+  "Ḥ",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "Q",
+  "R",
+  "Ṛ",
+  "S",
+  "Ṣ",
+  "T",
+  "Ṭ",
+  "U",
+  "W",
+  "X",
+  "Y",
+  "Z",
+};
+const char *ALPHA_266_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "ḍ",
+  "e",
+  "ɛ",
+  "f",
+  "g",
+  "ʷ",
+  "ɣ",
+  "h",
+  "ḥ",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "q",
+  "r",
+  "ṛ",
+  "s",
+  "ṣ",
+  "t",
+  "ṭ",
+  "u",
+  "w",
+  "x",
+  "y",
+  "z",
+};
+const char *ALPHA_266_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_266_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 81, 82,
+  83, 84, 85, 87, 88, 89, 90, 400, 404, 695, 7692, 7716, 7770, 7778, 7788,
+};
+const uint32_t ALPHA_266_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 113, 114,
+  115, 116, 117, 119, 120, 121, 122, 603, 611, 695, 7693, 7717, 7771, 7779, 7789,
+};
+const uint32_t ALPHA_266_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_266_FREQ[] = {
+  { "a", 0.00000000 },
+  { "b", 0.00000000 },
+  { "c", 0.00000000 },
+  { "d", 0.00000000 },
+  { "ḍ", 0.00000000 },
+  { "e", 0.00000000 },
+  { "ɛ", 0.00000000 },
+  { "f", 0.00000000 },
+  { "g", 0.00000000 },
+  { "ʷ", 0.00000000 },
+  { "ɣ", 0.00000000 },
+  { "h", 0.00000000 },
+  { "ḥ", 0.00000000 },
+  { "i", 0.00000000 },
+  { "j", 0.00000000 },
+  { "k", 0.00000000 },
+  { "l", 0.00000000 },
+  { "m", 0.00000000 },
+  { "n", 0.00000000 },
+  { "q", 0.00000000 },
+  { "r", 0.00000000 },
+  { "ṛ", 0.00000000 },
+  { "s", 0.00000000 },
+  { "ṣ", 0.00000000 },
+  { "t", 0.00000000 },
+  { "ṭ", 0.00000000 },
+  { "u", 0.00000000 },
+  { "w", 0.00000000 },
+  { "x", 0.00000000 },
+  { "y", 0.00000000 },
+  { "z", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_266_FREQ_CPS[] = {
+  { 0x61u, 0.00000000 },
+  { 0x62u, 0.00000000 },
+  { 0x63u, 0.00000000 },
+  { 0x64u, 0.00000000 },
+  { 0x65u, 0.00000000 },
+  { 0x66u, 0.00000000 },
+  { 0x67u, 0.00000000 },
+  { 0x68u, 0.00000000 },
+  { 0x69u, 0.00000000 },
+  { 0x6Au, 0.00000000 },
+  { 0x6Bu, 0.00000000 },
+  { 0x6Cu, 0.00000000 },
+  { 0x6Du, 0.00000000 },
+  { 0x6Eu, 0.00000000 },
+  { 0x71u, 0.00000000 },
+  { 0x72u, 0.00000000 },
+  { 0x73u, 0.00000000 },
+  { 0x74u, 0.00000000 },
+  { 0x75u, 0.00000000 },
+  { 0x77u, 0.00000000 },
+  { 0x78u, 0.00000000 },
+  { 0x79u, 0.00000000 },
+  { 0x7Au, 0.00000000 },
+  { 0x25Bu, 0.00000000 },
+  { 0x263u, 0.00000000 },
+  { 0x2B7u, 0.00000000 },
+  { 0x1E0Du, 0.00000000 },
+  { 0x1E25u, 0.00000000 },
+  { 0x1E5Bu, 0.00000000 },
+  { 0x1E63u, 0.00000000 },
+  { 0x1E6Du, 0.00000000 },
+};
+
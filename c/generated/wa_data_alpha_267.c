@@ -0,0 +1,249 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_267_UPPER[] = {
+  "අ",
+  "ආ",
+  "ඇ",
+  "ඈ",
+  "ඉ",
+  "ඊ",
+  "උ",
+  "ඌ",
+  "ඍ",
+  "එ",
+  "ඒ",
+  "ඓ",
+  "ඔ",
+  "ඕ",
+  "ඖ",
+  "ක",
+  "ඛ",
+  "ග",
+  "ඝ",
+  "ඞ",
+  "ඟ",
+  "ච",
+  "ඡ",
+  "ජ",
+  "ඣ",
+  "ඥ",
+  "ඤ",
+  "ට",
+  "ඨ",
+  "ඩ",
+  "ඪ",
+  "ණ",
+  "ඬ",
+  "ත",
+  "ථ",
+  "ද",
+  "ධ",
+  "න",
+  "ඳ",
+  "ප",
+  "ඵ",
+  "බ",
+  "භ",
+  "ම",
+  "ඹ",
+  "ය",
+  "ර",
+  "ල",
+  "ව",
+  "ශ",
+  "ෂ",
+  "ස",
+  "හ",
+  "ළ",
+  "ෆ",
+};
+const char *ALPHA_267_LOWER[] = {
+  "අ",
+  "ආ",
+  "ඇ",
+  "ඈ",
+  "ඉ",
+  "ඊ",
+  "උ",
+  "ඌ",
+  "ඍ",
+  "එ",
+  "ඒ",
+  "ඓ",
+  "ඔ",
+  "ඕ",
+  "ඖ",
+  "ක",
+  "ඛ",
+  "ග",
+  "ඝ",
+  "ඞ",
+  "ඟ",
+  "ච",
+  "ඡ",
+  "ජ",
+  "ඣ",
+  "ඥ",
+  "ඤ",
+  "ට",
+  "ඨ",
+  "ඩ",
+  "ඪ",
+  "ණ",
+  "ඬ",
+  "ත",
+  "ථ",
+  "ද",
+  "ධ",
+  "න",
+  "ඳ",
+  "ප",
+  "ඵ",
+  "බ",
+  "භ",
+  "ම",
+  "ඹ",
+  "ය",
+  "ර",
+  "ල",
+  "ව",
+  "ශ",
+  "ෂ",
+  "ස",
+  "හ",
+  "ළ",
+  "ෆ",
+};
+const char *ALPHA_267_DIGITS[] = {
+};
+const uint32_t ALPHA_267_UPPER_CPS[] = {
+  3461, 3462, 3463, 3464, 3465, 3466, 3467, 3468, 3469, 3473, 3474, 3475, 3476, 3477, 3478, 3482,
+  3483, 3484, 3485, 3486, 3487, 3488, 3489, 3490, 3491, 3492, 3493, 3495, 3496, 3497, 3498, 3499,
+  3500, 3501, 3502, 3503, 3504, 3505, 3507, 3508, 3509, 3510, 3511, 3512, 3513, 3514, 3515, 3517,
+  3520, 3521, 3522, 3523, 3524, 3525, 3526,
+};
+const uint32_t ALPHA_267_LOWER_CPS[] = {
+  3461, 3462, 3463, 3464, 3465, 3466, 3467, 3468, 3469, 3473, 3474, 3475, 3476, 3477, 3478, 3482,
+  3483, 3484, 3485, 3486, 3487, 3488, 3489, 3490, 3491, 3492, 3493, 3495, 3496, 3497, 3498, 3499,
+  3500, 3501, 3502, 3503, 3504, 3505, 3507, 3508, 3509, 3510, 3511, 3512, 3513, 3514, 3515, 3517,
+  3520, 3521, 3522, 3523, 3524, 3525, 3526,
+};
+const uint32_t ALPHA_267_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_267_FREQ[] = {
+  { "අ", 0.01740000 },
+  { "ආ", 0.00470000 },
+  { "ඇ", 0.00650000 },
+  { "ඈ", 0.00010000 },
+  { "ඉ", 0.00430000 },
+  { "ඊ", 0.00040000 },
+  { "උ", 0.00310000 },
+  { "ඌ", 0.00000000 },
+  { "ඍ", 0.00010000 },
+  { "එ", 0.00750000 },
+  { "ඒ", 0.00160000 },
+  { "ඓ", 0.00010000 },
+  { "ඔ", 0.00260000 },
+  { "ඕ", 0.00030000 },
+  { "ඖ", 0.00010000 },
+  { "ක", 0.07650000 },
+  { "ඛ", 0.00110000 },
+  { "ග", 0.02660000 },
+  { "ඝ", 0.00050000 },
+  { "ඞ", 0.00010000 },
+  { "ඟ", 0.00160000 },
+  { "ච", 0.00380000 },
+  { "ඡ", 0.00040000 },
+  { "ජ", 0.00940000 },
+  { "ඣ", 0.00000000 },
+  { "ඥ", 0.00050000 },
+  { "ඤ", 0.00010000 },
+  { "ට", 0.02790000 },
+  { "ඨ", 0.00060000 },
+  { "ඩ", 0.00900000 },
+  { "ඪ", 0.00000000 },
+  { "ණ", 0.01490000 },
+  { "ඬ", 0.00010000 },
+  { "ත", 0.06540000 },
+  { "ථ", 0.00360000 },
+  { "ද", 0.04390000 },
+  { "ධ", 0.00880000 },
+  { "න", 0.09910000 },
+  { "ඳ", 0.00440000 },
+  { "ප", 0.04210000 },
+  { "ඵ", 0.00040000 },
+  { "බ", 0.01720000 },
+  { "භ", 0.00500000 },
+  { "ම", 0.06810000 },
+  { "ඹ", 0.00080000 },
+  { "ය", 0.08810000 },
+  { "ර", 0.07720000 },
+  { "ල", 0.04190000 },
+  { "ව", 0.09160000 },
+  { "ශ", 0.01070000 },
+  { "ෂ", 0.00700000 },
+  { "ස", 0.05780000 },
+  { "හ", 0.03570000 },
+  { "ළ", 0.00860000 },
+  { "ෆ", 0.00090000 },
+};
+
+const wa_cp_freq ALPHA_267_FREQ_CPS[] = {
+  { 0xD85u, 0.01740000 },
+  { 0xD86u, 0.00470000 },
+  { 0xD87u, 0.00650000 },
+  { 0xD88u, 0.00010000 },
+  { 0xD89u, 0.00430000 },
+  { 0xD8Au, 0.00040000 },
+  { 0xD8Bu, 0.00310000 },
+  { 0xD8Cu, 0.00000000 },
+  { 0xD8Du, 0.00010000 },
+  { 0xD91u, 0.00750000 },
+  { 0xD92u, 0.00160000 },
+  { 0xD93u, 0.00010000 },
+  { 0xD94u, 0.00260000 },
+  { 0xD95u, 0.00030000 },
+  { 0xD96u, 0.00010000 },
+  { 0xD9Au, 0.07650000 },
+  { 0xD9Bu, 0.00110000 },
+  { 0xD9Cu, 0.02660000 },
+  { 0xD9Du, 0.00050000 },
+  { 0xD9Eu, 0.00010000 },
+  { 0xD9Fu, 0.00160000 },
+  { 0xDA0u, 0.00380000 },
+  { 0xDA1u, 0.00040000 },
+  { 0xDA2u, 0.00940000 },
+  { 0xDA3u, 0.00000000 },
+  { 0xDA4u, 0.00010000 },
+  { 0xDA5u, 0.00050000 },
+  { 0xDA7u, 0.02790000 },
+  { 0xDA8u, 0.00060000 },
+  { 0xDA9u, 0.00900000 },
+  { 0xDAAu, 0.00000000 },
+  { 0xDABu, 0.01490000 },
+  { 0xDACu, 0.00010000 },
+  { 0xDADu, 0.06540000 },
+  { 0xDAEu, 0.00360000 },
+  { 0xDAFu, 0.04390000 },
+  { 0xDB0u, 0.00880000 },
+  { 0xDB1u, 0.09910000 },
+  { 0xDB3u, 0.00440000 },
+  { 0xDB4u, 0.04210000 },
+  { 0xDB5u, 0.00040000 },
+  { 0xDB6u, 0.01720000 },
+  { 0xDB7u, 0.00500000 },
+  { 0xDB8u, 0.06810000 },
+  { 0xDB9u, 0.00080000 },
+  { 0xDBAu, 0.08810000 },
+  { 0xDBBu, 0.07720000 },
+  { 0xDBDu, 0.04190000 },
+  { 0xDC0u, 0.09160000 },
+  { 0xDC1u, 0.01070000 },
+  { 0xDC2u, 0.00700000 },
+  { 0xDC3u, 0.05780000 },
+  { 0xDC4u, 0.03570000 },
+  { 0xDC5u, 0.00860000 },
+  { 0xDC6u, 0.00090000 },
+};
+
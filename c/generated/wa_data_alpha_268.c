@@ -0,0 +1,199 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_268_UPPER[] = {
+  "A",
+  "Ä",
+  "B",
+  "Č",
+  "D",
+  "Ď",
+  "E",
+  "F",
+  "G",
+  "C",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "Ľ",
+  "M",
+  "N",
+  "O",
+  "Ô",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "Š",
+  "T",
+  "Ť",
+  "U",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+  "Á",
+  "É",
+  "Í",
+  "Ó",
+  "Ú",
+  "Ý",
+  "Ĺ",
+  "Ň",
+  "Ŕ",
+  "Ž",
+};
+const char *ALPHA_268_LOWER[] = {
+  "a",
+  "ä",
+  "b",
+  "č",
+  "d",
+  "ď",
+  "e",
+  "f",
+  "g",
+  "c",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "ľ",
+  "m",
+  "n",
+  "o",
+  "ô",
+  "p",
+  "q",
+  "r",
+  "s",
+  "š",
+  "t",
+  "ť",
+  "u",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+  "á",
+  "é",
+  "í",
+  "ó",
+  "ú",
+  "ý",
+  "ĺ",
+  "ň",
+  "ŕ",
+  "ž",
+};
+const char *ALPHA_268_DIGITS[] = {
+};
+const uint32_t ALPHA_268_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 193, 196, 201, 205, 211, 212,
+  218, 221, 268, 270, 313, 317, 327, 340, 352, 356, 381,
+};
+const uint32_t ALPHA_268_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 225, 228, 233, 237, 243, 244,
+  250, 253, 269, 271, 314, 318, 328, 341, 353, 357, 382,
+};
+const uint32_t ALPHA_268_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_268_FREQ[] = {
+  { "a", 0.08830000 },
+  { "ä", 0.00090000 },
+  { "b", 0.01970000 },
+  { "č", 0.00880000 },
+  { "d", 0.03080000 },
+  { "ď", 0.00090000 },
+  { "e", 0.08020000 },
+  { "f", 0.00480000 },
+  { "g", 0.00600000 },
+  { "c", 0.02550000 },
+  { "h", 0.02330000 },
+  { "i", 0.05540000 },
+  { "j", 0.02190000 },
+  { "k", 0.03840000 },
+  { "l", 0.03870000 },
+  { "ľ", 0.00470000 },
+  { "m", 0.03020000 },
+  { "n", 0.06000000 },
+  { "o", 0.09570000 },
+  { "ô", 0.00150000 },
+  { "p", 0.02930000 },
+  { "q", 0.00010000 },
+  { "r", 0.05390000 },
+  { "s", 0.04610000 },
+  { "š", 0.00770000 },
+  { "t", 0.04700000 },
+  { "ť", 0.00330000 },
+  { "u", 0.02830000 },
+  { "v", 0.04830000 },
+  { "w", 0.00100000 },
+  { "x", 0.00100000 },
+  { "y", 0.01500000 },
+  { "z", 0.01910000 },
+  { "á", 0.01750000 },
+  { "é", 0.00790000 },
+  { "í", 0.00970000 },
+  { "ó", 0.00210000 },
+  { "ú", 0.00740000 },
+  { "ý", 0.01060000 },
+  { "ĺ", 0.00010000 },
+  { "ň", 0.00100000 },
+  { "ŕ", 0.00010000 },
+  { "ž", 0.00760000 },
+};
+
+const wa_cp_freq ALPHA_268_FREQ_CPS[] = {
+  { 0x61u, 0.08830000 },
+  { 0x62u, 0.01970000 },
+  { 0x63u, 0.02550000 },
+  { 0x64u, 0.03080000 },
+  { 0x65u, 0.08020000 },
+  { 0x66u, 0.00480000 },
+  { 0x67u, 0.00600000 },
+  { 0x68u, 0.02330000 },
+  { 0x69u, 0.05540000 },
+  { 0x6Au, 0.02190000 },
+  { 0x6Bu, 0.03840000 },
+  { 0x6Cu, 0.03870000 },
+  { 0x6Du, 0.03020000 },
+  { 0x6Eu, 0.06000000 },
+  { 0x6Fu, 0.09570000 },
+  { 0x70u, 0.02930000 },
+  { 0x71u, 0.00010000 },
+  { 0x72u, 0.05390000 },
+  { 0x73u, 0.04610000 },
+  { 0x74u, 0.04700000 },
+  { 0x75u, 0.02830000 },
+  { 0x76u, 0.04830000 },
+  { 0x77u, 0.00100000 },
+  { 0x78u, 0.00100000 },
+  { 0x79u, 0.01500000 },
+  { 0x7Au, 0.01910000 },
+  { 0xE1u, 0.01750000 },
+  { 0xE4u, 0.00090000 },
+  { 0xE9u, 0.00790000 },
+  { 0xEDu, 0.00970000 },
+  { 0xF3u, 0.00210000 },
+  { 0xF4u, 0.00150000 },
+  { 0xFAu, 0.00740000 },
+  { 0xFDu, 0.01060000 },
+  { 0x10Du, 0.00880000 },
+  { 0x10Fu, 0.00090000 },
+  { 0x13Au, 0.00010000 },
+  { 0x13Eu, 0.00470000 },
+  { 0x148u, 0.00100000 },
+  { 0x155u, 0.00010000 },
+  { 0x161u, 0.00770000 },
+  { 0x165u, 0.00330000 },
+  { 0x17Eu, 0.00760000 },
+};
+
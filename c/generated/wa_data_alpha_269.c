@@ -0,0 +1,125 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_269_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "Č",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "R",
+  "S",
+  "Š",
+  "T",
+  "U",
+  "V",
+  "Z",
+  "Ž",
+};
+const char *ALPHA_269_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "č",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "r",
+  "s",
+  "š",
+  "t",
+  "u",
+  "v",
+  "z",
+  "ž",
+};
+const char *ALPHA_269_DIGITS[] = {
+};
+const uint32_t ALPHA_269_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  82, 83, 84, 85, 86, 90, 268, 352, 381,
+};
+const uint32_t ALPHA_269_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  114, 115, 116, 117, 118, 122, 269, 353, 382,
+};
+const uint32_t ALPHA_269_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_269_FREQ[] = {
+  { "a", 0.10180000 },
+  { "b", 0.01740000 },
+  { "c", 0.01060000 },
+  { "č", 0.01130000 },
+  { "d", 0.03230000 },
+  { "e", 0.10290000 },
+  { "f", 0.00410000 },
+  { "g", 0.01620000 },
+  { "h", 0.01230000 },
+  { "i", 0.09230000 },
+  { "j", 0.04470000 },
+  { "k", 0.03730000 },
+  { "l", 0.04920000 },
+  { "m", 0.02890000 },
+  { "n", 0.07070000 },
+  { "o", 0.08730000 },
+  { "p", 0.03230000 },
+  { "r", 0.05550000 },
+  { "s", 0.04930000 },
+  { "š", 0.00880000 },
+  { "t", 0.04570000 },
+  { "u", 0.02200000 },
+  { "v", 0.04180000 },
+  { "z", 0.02010000 },
+  { "ž", 0.00540000 },
+};
+
+const wa_cp_freq ALPHA_269_FREQ_CPS[] = {
+  { 0x61u, 0.10180000 },
+  { 0x62u, 0.01740000 },
+  { 0x63u, 0.01060000 },
+  { 0x64u, 0.03230000 },
+  { 0x65u, 0.10290000 },
+  { 0x66u, 0.00410000 },
+  { 0x67u, 0.01620000 },
+  { 0x68u, 0.01230000 },
+  { 0x69u, 0.09230000 },
+  { 0x6Au, 0.04470000 },
+  { 0x6Bu, 0.03730000 },
+  { 0x6Cu, 0.04920000 },
+  { 0x6Du, 0.02890000 },
+  { 0x6Eu, 0.07070000 },
+  { 0x6Fu, 0.08730000 },
+  { 0x70u, 0.03230000 },
+  { 0x72u, 0.05550000 },
+  { 0x73u, 0.04930000 },
+  { 0x74u, 0.04570000 },
+  { 0x75u, 0.02200000 },
+  { 0x76u, 0.04180000 },
+  { 0x7Au, 0.02010000 },
+  { 0x10Du, 0.01130000 },
+  { 0x161u, 0.00880000 },
+  { 0x17Eu, 0.00540000 },
+};
+
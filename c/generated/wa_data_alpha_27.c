@@ -0,0 +1,155 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_27_UPPER[] = {
+  "А",
+  "Б",
+  "В",
+  "Г",
+  "Д",
+  "Е",
+  "Ж",
+  "З",
+  "И",
+  "Й",
+  "К",
+  "Л",
+  "М",
+  "Н",
+  "О",
+  "П",
+  "Р",
+  "С",
+  "Т",
+  "У",
+  "Ф",
+  "Х",
+  "Ц",
+  "Ч",
+  "Ш",
+  "Щ",
+  "Ю",
+  "Я",
+  "Ъ",
+  "Ь",
+};
+const char *ALPHA_27_LOWER[] = {
+  "а",
+  "б",
+  "в",
+  "г",
+  "д",
+  "е",
+  "ж",
+  "з",
+  "и",
+  "й",
+  "к",
+  "л",
+  "м",
+  "н",
+  "о",
+  "п",
+  "р",
+  "с",
+  "т",
+  "у",
+  "ф",
+  "х",
+  "ц",
+  "ч",
+  "ш",
+  "щ",
+  "ю",
+  "я",
+  "ъ",
+  "ь",
+};
+const char *ALPHA_27_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_27_UPPER_CPS[] = {
+  1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053, 1054, 1055,
+  1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066, 1068, 1070, 1071,
+};
+const uint32_t ALPHA_27_LOWER_CPS[] = {
+  1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080, 1081, 1082, 1083, 1084, 1085, 1086, 1087,
+  1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097, 1098, 1100, 1102, 1103,
+};
+const uint32_t ALPHA_27_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_27_FREQ[] = {
+  { "а", 0.12290000 },
+  { "б", 0.01370000 },
+  { "в", 0.04600000 },
+  { "г", 0.01770000 },
+  { "д", 0.03180000 },
+  { "е", 0.08400000 },
+  { "ж", 0.00640000 },
+  { "з", 0.02130000 },
+  { "и", 0.09340000 },
+  { "й", 0.00680000 },
+  { "к", 0.03520000 },
+  { "л", 0.03530000 },
+  { "м", 0.02330000 },
+  { "н", 0.07500000 },
+  { "о", 0.08760000 },
+  { "п", 0.02970000 },
+  { "р", 0.05790000 },
+  { "с", 0.05260000 },
+  { "т", 0.07470000 },
+  { "у", 0.01490000 },
+  { "ф", 0.00430000 },
+  { "х", 0.00440000 },
+  { "ц", 0.00710000 },
+  { "ч", 0.01080000 },
+  { "ш", 0.00340000 },
+  { "щ", 0.00460000 },
+  { "ю", 0.00210000 },
+  { "я", 0.01700000 },
+  { "ъ", 0.01580000 },
+  { "ь", 0.00040000 },
+};
+
+const wa_cp_freq ALPHA_27_FREQ_CPS[] = {
+  { 0x430u, 0.12290000 },
+  { 0x431u, 0.01370000 },
+  { 0x432u, 0.04600000 },
+  { 0x433u, 0.01770000 },
+  { 0x434u, 0.03180000 },
+  { 0x435u, 0.08400000 },
+  { 0x436u, 0.00640000 },
+  { 0x437u, 0.02130000 },
+  { 0x438u, 0.09340000 },
+  { 0x439u, 0.00680000 },
+  { 0x43Au, 0.03520000 },
+  { 0x43Bu, 0.03530000 },
+  { 0x43Cu, 0.02330000 },
+  { 0x43Du, 0.07500000 },
+  { 0x43Eu, 0.08760000 },
+  { 0x43Fu, 0.02970000 },
+  { 0x440u, 0.05790000 },
+  { 0x441u, 0.05260000 },
+  { 0x442u, 0.07470000 },
+  { 0x443u, 0.01490000 },
+  { 0x444u, 0.00430000 },
+  { 0x445u, 0.00440000 },
+  { 0x446u, 0.00710000 },
+  { 0x447u, 0.01080000 },
+  { 0x448u, 0.00340000 },
+  { 0x449u, 0.00460000 },
+  { 0x44Au, 0.01580000 },
+  { 0x44Cu, 0.00040000 },
+  { 0x44Eu, 0.00210000 },
+  { 0x44Fu, 0.01700000 },
+};
+
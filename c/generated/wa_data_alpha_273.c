@@ -0,0 +1,181 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_273_UPPER[] = {
+  "A",
+  "Â",
+  "Å",
+  "Ä",
+  "B",
+  "C",
+  "Č",
+  "D",
+  "Đ",
+  "E",
+  "F",
+  "G",
+  "Ǧ",
+  "Ǥ",
+  "H",
+  "I",
+  "J",
+  "K",
+  "Ǩ",
+  "L",
+  "M",
+  "N",
+  "Ŋ",
+  "O",
+  "Õ",
+  "P",
+  "R",
+  "S",
+  "Š",
+  "T",
+  "U",
+  "V",
+  "Z",
+  "Ž",
+  "Ʒ",
+  "Ǯ",
+};
+const char *ALPHA_273_LOWER[] = {
+  "a",
+  "â",
+  "å",
+  "ä",
+  "b",
+  "c",
+  "č",
+  "d",
+  "đ",
+  "e",
+  "f",
+  "g",
+  "ǧ",
+  "ǥ",
+  "h",
+  "i",
+  "j",
+  "k",
+  "ǩ",
+  "l",
+  "m",
+  "n",
+  "ŋ",
+  "o",
+  "õ",
+  "p",
+  "r",
+  "s",
+  "š",
+  "t",
+  "u",
+  "v",
+  "z",
+  "ž",
+  "ʒ",
+  "ǯ",
+};
+const char *ALPHA_273_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_273_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  82, 83, 84, 85, 86, 90, 194, 196, 197, 213, 268, 272, 330, 352, 381, 439,
+  484, 486, 488, 494,
+};
+const uint32_t ALPHA_273_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  114, 115, 116, 117, 118, 122, 226, 228, 229, 245, 269, 273, 331, 353, 382, 485,
+  487, 489, 495, 658,
+};
+const uint32_t ALPHA_273_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_273_FREQ[] = {
+  { "a", 0.00000000 },
+  { "â", 0.00000000 },
+  { "å", 0.00000000 },
+  { "ä", 0.00000000 },
+  { "b", 0.00000000 },
+  { "c", 0.00000000 },
+  { "č", 0.00000000 },
+  { "d", 0.00000000 },
+  { "đ", 0.00000000 },
+  { "e", 0.00000000 },
+  { "f", 0.00000000 },
+  { "g", 0.00000000 },
+  { "ǧ", 0.00000000 },
+  { "ǥ", 0.00000000 },
+  { "h", 0.00000000 },
+  { "i", 0.00000000 },
+  { "j", 0.00000000 },
+  { "k", 0.00000000 },
+  { "ǩ", 0.00000000 },
+  { "l", 0.00000000 },
+  { "m", 0.00000000 },
+  { "n", 0.00000000 },
+  { "ŋ", 0.00000000 },
+  { "o", 0.00000000 },
+  { "õ", 0.00000000 },
+  { "p", 0.00000000 },
+  { "r", 0.00000000 },
+  { "s", 0.00000000 },
+  { "š", 0.00000000 },
+  { "t", 0.00000000 },
+  { "u", 0.00000000 },
+  { "v", 0.00000000 },
+  { "z", 0.00000000 },
+  { "ž", 0.00000000 },
+  { "ʒ", 0.00000000 },
+  { "ǯ", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_273_FREQ_CPS[] = {
+  { 0x61u, 0.00000000 },
+  { 0x62u, 0.00000000 },
+  { 0x63u, 0.00000000 },
+  { 0x64u, 0.00000000 },
+  { 0x65u, 0.00000000 },
+  { 0x66u, 0.00000000 },
+  { 0x67u, 0.00000000 },
+  { 0x68u, 0.00000000 },
+  { 0x69u, 0.00000000 },
+  { 0x6Au, 0.00000000 },
+  { 0x6Bu, 0.00000000 },
+  { 0x6Cu, 0.00000000 },
+  { 0x6Du, 0.00000000 },
+  { 0x6Eu, 0.00000000 },
+  { 0x6Fu, 0.00000000 },
+  { 0x70u, 0.00000000 },
+  { 0x72u, 0.00000000 },
+  { 0x73u, 0.00000000 },
+  { 0x74u, 0.00000000 },
+  { 0x75u, 0.00000000 },
+  { 0x76u, 0.00000000 },
+  { 0x7Au, 0.00000000 },
+  { 0xE2u, 0.00000000 },
+  { 0xE4u, 0.00000000 },
+  { 0xE5u, 0.00000000 },
+  { 0xF5u, 0.00000000 },
+  { 0x10Du, 0.00000000 },
+  { 0x111u, 0.00000000 },
+  { 0x14Bu, 0.00000000 },
+  { 0x161u, 0.00000000 },
+  { 0x17Eu, 0.00000000 },
+  { 0x1E5u, 0.00000000 },
+  { 0x1E7u, 0.00000000 },
+  { 0x1E9u, 0.00000000 },
+  { 0x1EFu, 0.00000000 },
+  { 0x292u, 0.00000000 },
+};
+
@@ -0,0 +1,121 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_274_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "W",
+  "Y",
+  "Z",
+};
+const char *ALPHA_274_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "w",
+  "y",
+  "z",
+};
+const char *ALPHA_274_DIGITS[] = {
+};
+const uint32_t ALPHA_274_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  82, 83, 84, 85, 86, 87, 89, 90,
+};
+const uint32_t ALPHA_274_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  114, 115, 116, 117, 118, 119, 121, 122,
+};
+const uint32_t ALPHA_274_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_274_FREQ[] = {
+  { "a", 0.15190000 },
+  { "b", 0.01740000 },
+  { "c", 0.01920000 },
+  { "d", 0.02990000 },
+  { "e", 0.06680000 },
+  { "f", 0.00470000 },
+  { "g", 0.01850000 },
+  { "h", 0.04070000 },
+  { "i", 0.10170000 },
+  { "j", 0.00190000 },
+  { "k", 0.05080000 },
+  { "l", 0.00510000 },
+  { "m", 0.04640000 },
+  { "n", 0.08300000 },
+  { "o", 0.05620000 },
+  { "p", 0.01610000 },
+  { "r", 0.05230000 },
+  { "s", 0.02940000 },
+  { "t", 0.03040000 },
+  { "u", 0.06810000 },
+  { "v", 0.03120000 },
+  { "w", 0.02920000 },
+  { "y", 0.01650000 },
+  { "z", 0.03270000 },
+};
+
+const wa_cp_freq ALPHA_274_FREQ_CPS[] = {
+  { 0x61u, 0.15190000 },
+  { 0x62u, 0.01740000 },
+  { 0x63u, 0.01920000 },
+  { 0x64u, 0.02990000 },
+  { 0x65u, 0.06680000 },
+  { 0x66u, 0.00470000 },
+  { 0x67u, 0.01850000 },
+  { 0x68u, 0.04070000 },
+  { 0x69u, 0.10170000 },
+  { 0x6Au, 0.00190000 },
+  { 0x6Bu, 0.05080000 },
+  { 0x6Cu, 0.00510000 },
+  { 0x6Du, 0.04640000 },
+  { 0x6Eu, 0.08300000 },
+  { 0x6Fu, 0.05620000 },
+  { 0x70u, 0.01610000 },
+  { 0x72u, 0.05230000 },
+  { 0x73u, 0.02940000 },
+  { 0x74u, 0.03040000 },
+  { 0x75u, 0.06810000 },
+  { 0x76u, 0.03120000 },
+  { 0x77u, 0.02920000 },
+  { 0x79u, 0.01650000 },
+  { 0x7Au, 0.03270000 },
+};
+
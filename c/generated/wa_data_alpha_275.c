@@ -0,0 +1,97 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_275_UPPER[] = {
+  "B",
+  "C",
+  "D",
+  "F",
+  "G",
+  "H",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "W",
+  "X",
+  "Y",
+};
+const char *ALPHA_275_LOWER[] = {
+  "b",
+  "c",
+  "d",
+  "f",
+  "g",
+  "h",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "q",
+  "r",
+  "s",
+  "t",
+  "w",
+  "x",
+  "y",
+};
+const char *ALPHA_275_DIGITS[] = {
+};
+const uint32_t ALPHA_275_UPPER_CPS[] = {
+  66, 67, 68, 70, 71, 72, 74, 75, 76, 77, 78, 81, 82, 83, 84, 87,
+  88, 89,
+};
+const uint32_t ALPHA_275_LOWER_CPS[] = {
+  98, 99, 100, 102, 103, 104, 106, 107, 108, 109, 110, 113, 114, 115, 116, 119,
+  120, 121,
+};
+const uint32_t ALPHA_275_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_275_FREQ[] = {
+  { "b", 0.04840000 },
+  { "c", 0.02380000 },
+  { "d", 0.11950000 },
+  { "f", 0.01290000 },
+  { "g", 0.04960000 },
+  { "h", 0.07240000 },
+  { "j", 0.01100000 },
+  { "k", 0.07000000 },
+  { "l", 0.07880000 },
+  { "m", 0.05590000 },
+  { "n", 0.09430000 },
+  { "q", 0.01870000 },
+  { "r", 0.06600000 },
+  { "s", 0.07490000 },
+  { "t", 0.03640000 },
+  { "w", 0.04440000 },
+  { "x", 0.03680000 },
+  { "y", 0.08620000 },
+};
+
+const wa_cp_freq ALPHA_275_FREQ_CPS[] = {
+  { 0x62u, 0.04840000 },
+  { 0x63u, 0.02380000 },
+  { 0x64u, 0.11950000 },
+  { 0x66u, 0.01290000 },
+  { 0x67u, 0.04960000 },
+  { 0x68u, 0.07240000 },
+  { 0x6Au, 0.01100000 },
+  { 0x6Bu, 0.07000000 },
+  { 0x6Cu, 0.07880000 },
+  { 0x6Du, 0.05590000 },
+  { 0x6Eu, 0.09430000 },
+  { 0x71u, 0.01870000 },
+  { 0x72u, 0.06600000 },
+  { 0x73u, 0.07490000 },
+  { 0x74u, 0.03640000 },
+  { 0x77u, 0.04440000 },
+  { 0x78u, 0.03680000 },
+  { 0x79u, 0.08620000 },
+};
+
@@ -0,0 +1,133 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_276_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "Ç",
+  "D",
+  "E",
+  "Ë",
+  "F",
+  "G",
+  "I",
+  "K",
+  "L",
+  "M",
+  "N",
+  "J",
+  "O",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "X",
+  "Y",
+  "Z",
+  "H",
+};
+const char *ALPHA_276_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "ç",
+  "d",
+  "e",
+  "ë",
+  "f",
+  "g",
+  "i",
+  "k",
+  "l",
+  "m",
+  "n",
+  "j",
+  "o",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "x",
+  "y",
+  "z",
+  "h",
+};
+const char *ALPHA_276_DIGITS[] = {
+};
+const uint32_t ALPHA_276_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 88, 89, 90, 199, 203,
+};
+const uint32_t ALPHA_276_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 120, 121, 122, 231, 235,
+};
+const uint32_t ALPHA_276_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_276_FREQ[] = {
+  { "a", 0.07430000 },
+  { "b", 0.01190000 },
+  { "c", 0.00650000 },
+  { "ç", 0.00150000 },
+  { "d", 0.03120000 },
+  { "e", 0.10210000 },
+  { "ë", 0.07820000 },
+  { "f", 0.01010000 },
+  { "g", 0.01530000 },
+  { "i", 0.08470000 },
+  { "k", 0.03180000 },
+  { "l", 0.02920000 },
+  { "m", 0.03570000 },
+  { "n", 0.06640000 },
+  { "j", 0.02930000 },
+  { "o", 0.03950000 },
+  { "p", 0.02670000 },
+  { "q", 0.00830000 },
+  { "r", 0.07170000 },
+  { "s", 0.05620000 },
+  { "t", 0.08440000 },
+  { "u", 0.03330000 },
+  { "v", 0.01510000 },
+  { "x", 0.00100000 },
+  { "y", 0.00570000 },
+  { "z", 0.00730000 },
+  { "h", 0.04240000 },
+};
+
+const wa_cp_freq ALPHA_276_FREQ_CPS[] = {
+  { 0x61u, 0.07430000 },
+  { 0x62u, 0.01190000 },
+  { 0x63u, 0.00650000 },
+  { 0x64u, 0.03120000 },
+  { 0x65u, 0.10210000 },
+  { 0x66u, 0.01010000 },
+  { 0x67u, 0.01530000 },
+  { 0x68u, 0.04240000 },
+  { 0x69u, 0.08470000 },
+  { 0x6Au, 0.02930000 },
+  { 0x6Bu, 0.03180000 },
+  { 0x6Cu, 0.02920000 },
+  { 0x6Du, 0.03570000 },
+  { 0x6Eu, 0.06640000 },
+  { 0x6Fu, 0.03950000 },
+  { 0x70u, 0.02670000 },
+  { 0x71u, 0.00830000 },
+  { 0x72u, 0.07170000 },
+  { 0x73u, 0.05620000 },
+  { 0x74u, 0.08440000 },
+  { 0x75u, 0.03330000 },
+  { 0x76u, 0.01510000 },
+  { 0x78u, 0.00100000 },
+  { 0x79u, 0.00570000 },
+  { 0x7Au, 0.00730000 },
+  { 0xE7u, 0.00150000 },
+  { 0xEBu, 0.07820000 },
+};
+
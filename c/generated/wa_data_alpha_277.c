@@ -0,0 +1,145 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_277_UPPER[] = {
+  "А",
+  "Б",
+  "В",
+  "Г",
+  "Д",
+  "Ђ",
+  "Е",
+  "Ж",
+  "З",
+  "И",
+  "Ј",
+  "К",
+  "Л",
+  "Љ",
+  "М",
+  "Н",
+  "Њ",
+  "О",
+  "П",
+  "Р",
+  "С",
+  "Т",
+  "Ћ",
+  "У",
+  "Ф",
+  "Х",
+  "Ц",
+  "Ч",
+  "Џ",
+  "Ш",
+};
+const char *ALPHA_277_LOWER[] = {
+  "а",
+  "б",
+  "в",
+  "г",
+  "д",
+  "ђ",
+  "е",
+  "ж",
+  "з",
+  "и",
+  "ј",
+  "к",
+  "л",
+  "љ",
+  "м",
+  "н",
+  "њ",
+  "о",
+  "п",
+  "р",
+  "с",
+  "т",
+  "ћ",
+  "у",
+  "ф",
+  "х",
+  "ц",
+  "ч",
+  "џ",
+  "ш",
+};
+const char *ALPHA_277_DIGITS[] = {
+};
+const uint32_t ALPHA_277_UPPER_CPS[] = {
+  1026, 1032, 1033, 1034, 1035, 1039, 1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048, 1050,
+  1051, 1052, 1053, 1054, 1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064,
+};
+const uint32_t ALPHA_277_LOWER_CPS[] = {
+  1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080, 1082, 1083, 1084, 1085, 1086, 1087, 1088,
+  1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 1106, 1112, 1113, 1114, 1115, 1119,
+};
+const uint32_t ALPHA_277_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_277_FREQ[] = {
+  { "г", 0.01920000 },
+  { "к", 0.03850000 },
+  { "ц", 0.00890000 },
+  { "е", 0.08870000 },
+  { "ћ", 0.00380000 },
+  { "х", 0.00610000 },
+  { "а", 0.12050000 },
+  { "д", 0.03480000 },
+  { "у", 0.04290000 },
+  { "о", 0.09260000 },
+  { "п", 0.03040000 },
+  { "ч", 0.00870000 },
+  { "џ", 0.00040000 },
+  { "б", 0.01550000 },
+  { "ф", 0.00400000 },
+  { "с", 0.05160000 },
+  { "л", 0.02980000 },
+  { "ј", 0.03700000 },
+  { "н", 0.06410000 },
+  { "и", 0.09590000 },
+  { "ш", 0.00890000 },
+  { "р", 0.05450000 },
+  { "ђ", 0.00230000 },
+  { "т", 0.04290000 },
+  { "њ", 0.00600000 },
+  { "љ", 0.00470000 },
+  { "м", 0.03060000 },
+  { "з", 0.01760000 },
+  { "в", 0.03490000 },
+  { "ж", 0.00460000 },
+};
+
+const wa_cp_freq ALPHA_277_FREQ_CPS[] = {
+  { 0x430u, 0.12050000 },
+  { 0x431u, 0.01550000 },
+  { 0x432u, 0.03490000 },
+  { 0x433u, 0.01920000 },
+  { 0x434u, 0.03480000 },
+  { 0x435u, 0.08870000 },
+  { 0x436u, 0.00460000 },
+  { 0x437u, 0.01760000 },
+  { 0x438u, 0.09590000 },
+  { 0x43Au, 0.03850000 },
+  { 0x43Bu, 0.02980000 },
+  { 0x43Cu, 0.03060000 },
+  { 0x43Du, 0.06410000 },
+  { 0x43Eu, 0.09260000 },
+  { 0x43Fu, 0.03040000 },
+  { 0x440u, 0.05450000 },
+  { 0x441u, 0.05160000 },
+  { 0x442u, 0.04290000 },
+  { 0x443u, 0.04290000 },
+  { 0x444u, 0.00400000 },
+  { 0x445u, 0.00610000 },
+  { 0x446u, 0.00890000 },
+  { 0x447u, 0.00870000 },
+  { 0x448u, 0.00890000 },
+  { 0x452u, 0.00230000 },
+  { 0x458u, 0.03700000 },
+  { 0x459u, 0.00470000 },
+  { 0x45Au, 0.00600000 },
+  { 0x45Bu, 0.00380000 },
+  { 0x45Fu, 0.00040000 },
+};
+
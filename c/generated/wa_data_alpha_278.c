@@ -0,0 +1,133 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_278_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "Z",
+  "Ć",
+  "Č",
+  "Đ",
+  "Š",
+  "Ž",
+};
+const char *ALPHA_278_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "z",
+  "ć",
+  "č",
+  "đ",
+  "š",
+  "ž",
+};
+const char *ALPHA_278_DIGITS[] = {
+};
+const uint32_t ALPHA_278_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  82, 83, 84, 85, 86, 90, 262, 268, 272, 352, 381,
+};
+const uint32_t ALPHA_278_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  114, 115, 116, 117, 118, 122, 263, 269, 273, 353, 382,
+};
+const uint32_t ALPHA_278_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_278_FREQ[] = {
+  { "h", 0.01380000 },
+  { "m", 0.04230000 },
+  { "e", 0.08840000 },
+  { "o", 0.08540000 },
+  { "d", 0.03180000 },
+  { "b", 0.01390000 },
+  { "z", 0.01530000 },
+  { "r", 0.05660000 },
+  { "l", 0.03890000 },
+  { "g", 0.02370000 },
+  { "k", 0.03360000 },
+  { "š", 0.00500000 },
+  { "c", 0.02090000 },
+  { "v", 0.02530000 },
+  { "j", 0.03470000 },
+  { "ž", 0.00340000 },
+  { "p", 0.02860000 },
+  { "t", 0.05760000 },
+  { "n", 0.06550000 },
+  { "a", 0.10890000 },
+  { "ć", 0.00300000 },
+  { "č", 0.00670000 },
+  { "f", 0.00880000 },
+  { "i", 0.09950000 },
+  { "s", 0.05010000 },
+  { "đ", 0.00160000 },
+  { "u", 0.03680000 },
+};
+
+const wa_cp_freq ALPHA_278_FREQ_CPS[] = {
+  { 0x61u, 0.10890000 },
+  { 0x62u, 0.01390000 },
+  { 0x63u, 0.02090000 },
+  { 0x64u, 0.03180000 },
+  { 0x65u, 0.08840000 },
+  { 0x66u, 0.00880000 },
+  { 0x67u, 0.02370000 },
+  { 0x68u, 0.01380000 },
+  { 0x69u, 0.09950000 },
+  { 0x6Au, 0.03470000 },
+  { 0x6Bu, 0.03360000 },
+  { 0x6Cu, 0.03890000 },
+  { 0x6Du, 0.04230000 },
+  { 0x6Eu, 0.06550000 },
+  { 0x6Fu, 0.08540000 },
+  { 0x70u, 0.02860000 },
+  { 0x72u, 0.05660000 },
+  { 0x73u, 0.05010000 },
+  { 0x74u, 0.05760000 },
+  { 0x75u, 0.03680000 },
+  { 0x76u, 0.02530000 },
+  { 0x7Au, 0.01530000 },
+  { 0x107u, 0.00300000 },
+  { 0x10Du, 0.00670000 },
+  { 0x111u, 0.00160000 },
+  { 0x161u, 0.00500000 },
+  { 0x17Eu, 0.00340000 },
+};
+
@@ -0,0 +1,129 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_279_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+};
+const char *ALPHA_279_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+};
+const char *ALPHA_279_DIGITS[] = {
+};
+const uint32_t ALPHA_279_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90,
+};
+const uint32_t ALPHA_279_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122,
+};
+const uint32_t ALPHA_279_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_279_FREQ[] = {
+  { "a", 0.11400000 },
+  { "b", 0.03310000 },
+  { "c", 0.01670000 },
+  { "d", 0.02340000 },
+  { "e", 0.10600000 },
+  { "f", 0.01420000 },
+  { "g", 0.02190000 },
+  { "h", 0.04550000 },
+  { "i", 0.09210000 },
+  { "j", 0.00430000 },
+  { "k", 0.03530000 },
+  { "l", 0.06360000 },
+  { "m", 0.03220000 },
+  { "n", 0.07800000 },
+  { "o", 0.05490000 },
+  { "p", 0.01370000 },
+  { "q", 0.00070000 },
+  { "r", 0.02640000 },
+  { "s", 0.05340000 },
+  { "t", 0.06120000 },
+  { "u", 0.04700000 },
+  { "v", 0.01000000 },
+  { "w", 0.02440000 },
+  { "x", 0.00130000 },
+  { "y", 0.01940000 },
+  { "z", 0.00720000 },
+};
+
+const wa_cp_freq ALPHA_279_FREQ_CPS[] = {
+  { 0x61u, 0.11400000 },
+  { 0x62u, 0.03310000 },
+  { 0x63u, 0.01670000 },
+  { 0x64u, 0.02340000 },
+  { 0x65u, 0.10600000 },
+  { 0x66u, 0.01420000 },
+  { 0x67u, 0.02190000 },
+  { 0x68u, 0.04550000 },
+  { 0x69u, 0.09210000 },
+  { 0x6Au, 0.00430000 },
+  { 0x6Bu, 0.03530000 },
+  { 0x6Cu, 0.06360000 },
+  { 0x6Du, 0.03220000 },
+  { 0x6Eu, 0.07800000 },
+  { 0x6Fu, 0.05490000 },
+  { 0x70u, 0.01370000 },
+  { 0x71u, 0.00070000 },
+  { 0x72u, 0.02640000 },
+  { 0x73u, 0.05340000 },
+  { 0x74u, 0.06120000 },
+  { 0x75u, 0.04700000 },
+  { 0x76u, 0.01000000 },
+  { 0x77u, 0.02440000 },
+  { 0x78u, 0.00130000 },
+  { 0x79u, 0.01940000 },
+  { 0x7Au, 0.00720000 },
+};
+
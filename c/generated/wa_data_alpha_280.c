@@ -0,0 +1,123 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_280_UPPER[] = {
+  "A",
+  "B",
+  "T",
+  "S",
+  "E",
+  "C",
+  "K",
+  "X",
+  "I",
+  "D",
+  "Q",
+  "R",
+  "F",
+  "G",
+  "O",
+  "L",
+  "M",
+  "N",
+  "U",
+  "W",
+  "H",
+  "Y",
+};
+const char *ALPHA_280_LOWER[] = {
+  "a",
+  "b",
+  "t",
+  "s",
+  "e",
+  "c",
+  "k",
+  "x",
+  "i",
+  "d",
+  "q",
+  "r",
+  "f",
+  "g",
+  "o",
+  "l",
+  "m",
+  "n",
+  "u",
+  "w",
+  "h",
+  "y",
+};
+const char *ALPHA_280_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_280_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 75, 76, 77, 78, 79, 81, 82,
+  83, 84, 85, 87, 88, 89,
+};
+const uint32_t ALPHA_280_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 107, 108, 109, 110, 111, 113, 114,
+  115, 116, 117, 119, 120, 121,
+};
+const uint32_t ALPHA_280_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_280_FREQ[] = {
+  { "a", 0.00000000 },
+  { "b", 0.00000000 },
+  { "t", 0.00000000 },
+  { "s", 0.00000000 },
+  { "e", 0.00000000 },
+  { "c", 0.00000000 },
+  { "k", 0.00000000 },
+  { "x", 0.00000000 },
+  { "i", 0.00000000 },
+  { "d", 0.00000000 },
+  { "q", 0.00000000 },
+  { "r", 0.00000000 },
+  { "f", 0.00000000 },
+  { "g", 0.00000000 },
+  { "o", 0.00000000 },
+  { "l", 0.00000000 },
+  { "m", 0.00000000 },
+  { "n", 0.00000000 },
+  { "u", 0.00000000 },
+  { "w", 0.00000000 },
+  { "h", 0.00000000 },
+  { "y", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_280_FREQ_CPS[] = {
+  { 0x61u, 0.00000000 },
+  { 0x62u, 0.00000000 },
+  { 0x63u, 0.00000000 },
+  { 0x64u, 0.00000000 },
+  { 0x65u, 0.00000000 },
+  { 0x66u, 0.00000000 },
+  { 0x67u, 0.00000000 },
+  { 0x68u, 0.00000000 },
+  { 0x69u, 0.00000000 },
+  { 0x6Bu, 0.00000000 },
+  { 0x6Cu, 0.00000000 },
+  { 0x6Du, 0.00000000 },
+  { 0x6Eu, 0.00000000 },
+  { 0x6Fu, 0.00000000 },
+  { 0x71u, 0.00000000 },
+  { 0x72u, 0.00000000 },
+  { 0x73u, 0.00000000 },
+  { 0x74u, 0.00000000 },
+  { 0x75u, 0.00000000 },
+  { 0x77u, 0.00000000 },
+  { 0x78u, 0.00000000 },
+  { 0x79u, 0.00000000 },
+};
+
@@ -0,0 +1,133 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_282_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "É",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+};
+const char *ALPHA_282_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "é",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+};
+const char *ALPHA_282_DIGITS[] = {
+};
+const uint32_t ALPHA_282_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 201,
+};
+const uint32_t ALPHA_282_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 233,
+};
+const uint32_t ALPHA_282_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_282_FREQ[] = {
+  { "a", 0.17240000 },
+  { "b", 0.02110000 },
+  { "c", 0.01570000 },
+  { "d", 0.03350000 },
+  { "e", 0.06510000 },
+  { "é", 0.01620000 },
+  { "f", 0.00740000 },
+  { "g", 0.03640000 },
+  { "h", 0.02610000 },
+  { "i", 0.07940000 },
+  { "j", 0.01240000 },
+  { "k", 0.03580000 },
+  { "l", 0.03360000 },
+  { "m", 0.02880000 },
+  { "n", 0.10220000 },
+  { "o", 0.03830000 },
+  { "p", 0.02620000 },
+  { "q", 0.00050000 },
+  { "r", 0.05140000 },
+  { "s", 0.05320000 },
+  { "t", 0.05790000 },
+  { "u", 0.05730000 },
+  { "v", 0.00390000 },
+  { "w", 0.01130000 },
+  { "x", 0.00090000 },
+  { "y", 0.01240000 },
+  { "z", 0.00080000 },
+};
+
+const wa_cp_freq ALPHA_282_FREQ_CPS[] = {
+  { 0x61u, 0.17240000 },
+  { 0x62u, 0.02110000 },
+  { 0x63u, 0.01570000 },
+  { 0x64u, 0.03350000 },
+  { 0x65u, 0.06510000 },
+  { 0x66u, 0.00740000 },
+  { 0x67u, 0.03640000 },
+  { 0x68u, 0.02610000 },
+  { 0x69u, 0.07940000 },
+  { 0x6Au, 0.01240000 },
+  { 0x6Bu, 0.03580000 },
+  { 0x6Cu, 0.03360000 },
+  { 0x6Du, 0.02880000 },
+  { 0x6Eu, 0.10220000 },
+  { 0x6Fu, 0.03830000 },
+  { 0x70u, 0.02620000 },
+  { 0x71u, 0.00050000 },
+  { 0x72u, 0.05140000 },
+  { 0x73u, 0.05320000 },
+  { 0x74u, 0.05790000 },
+  { 0x75u, 0.05730000 },
+  { 0x76u, 0.00390000 },
+  { 0x77u, 0.01130000 },
+  { 0x78u, 0.00090000 },
+  { 0x79u, 0.01240000 },
+  { 0x7Au, 0.00080000 },
+  { 0xE9u, 0.01620000 },
+};
+
@@ -0,0 +1,149 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_283_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+  "Å",
+  "Ä",
+  "Ö",
+  "À",
+  "É",
+};
+const char *ALPHA_283_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+  "å",
+  "ä",
+  "ö",
+  "à",
+  "é",
+};
+const char *ALPHA_283_DIGITS[] = {
+};
+const uint32_t ALPHA_283_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 192, 196, 197, 201, 214,
+};
+const uint32_t ALPHA_283_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 224, 228, 229, 233, 246,
+};
+const uint32_t ALPHA_283_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_283_FREQ[] = {
+  { "a", 0.09260000 },
+  { "b", 0.01510000 },
+  { "c", 0.01570000 },
+  { "d", 0.04630000 },
+  { "e", 0.10200000 },
+  { "f", 0.02020000 },
+  { "g", 0.02900000 },
+  { "h", 0.02130000 },
+  { "i", 0.06000000 },
+  { "j", 0.00590000 },
+  { "k", 0.03110000 },
+  { "l", 0.05260000 },
+  { "m", 0.03450000 },
+  { "n", 0.08640000 },
+  { "o", 0.04610000 },
+  { "p", 0.01820000 },
+  { "q", 0.00020000 },
+  { "r", 0.08400000 },
+  { "s", 0.06560000 },
+  { "t", 0.07550000 },
+  { "u", 0.02010000 },
+  { "v", 0.02410000 },
+  { "w", 0.00140000 },
+  { "x", 0.00150000 },
+  { "y", 0.00710000 },
+  { "z", 0.00080000 },
+  { "å", 0.01270000 },
+  { "ä", 0.01670000 },
+  { "ö", 0.01280000 },
+  { "à", 0.00000000 },
+  { "é", 0.00050000 },
+};
+
+const wa_cp_freq ALPHA_283_FREQ_CPS[] = {
+  { 0x61u, 0.09260000 },
+  { 0x62u, 0.01510000 },
+  { 0x63u, 0.01570000 },
+  { 0x64u, 0.04630000 },
+  { 0x65u, 0.10200000 },
+  { 0x66u, 0.02020000 },
+  { 0x67u, 0.02900000 },
+  { 0x68u, 0.02130000 },
+  { 0x69u, 0.06000000 },
+  { 0x6Au, 0.00590000 },
+  { 0x6Bu, 0.03110000 },
+  { 0x6Cu, 0.05260000 },
+  { 0x6Du, 0.03450000 },
+  { 0x6Eu, 0.08640000 },
+  { 0x6Fu, 0.04610000 },
+  { 0x70u, 0.01820000 },
+  { 0x71u, 0.00020000 },
+  { 0x72u, 0.08400000 },
+  { 0x73u, 0.06560000 },
+  { 0x74u, 0.07550000 },
+  { 0x75u, 0.02010000 },
+  { 0x76u, 0.02410000 },
+  { 0x77u, 0.00140000 },
+  { 0x78u, 0.00150000 },
+  { 0x79u, 0.00710000 },
+  { 0x7Au, 0.00080000 },
+  { 0xE0u, 0.00000000 },
+  { 0xE4u, 0.01670000 },
+  { 0xE5u, 0.01270000 },
+  { 0xE9u, 0.00050000 },
+  { 0xF6u, 0.01280000 },
+};
+
@@ -0,0 +1,121 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_284_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "W",
+  "Y",
+  "Z",
+};
+const char *ALPHA_284_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "w",
+  "y",
+  "z",
+};
+const char *ALPHA_284_DIGITS[] = {
+};
+const uint32_t ALPHA_284_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  82, 83, 84, 85, 86, 87, 89, 90,
+};
+const uint32_t ALPHA_284_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  114, 115, 116, 117, 118, 119, 121, 122,
+};
+const uint32_t ALPHA_284_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_284_FREQ[] = {
+  { "a", 0.21260000 },
+  { "b", 0.01910000 },
+  { "c", 0.00960000 },
+  { "d", 0.01810000 },
+  { "e", 0.04440000 },
+  { "f", 0.00960000 },
+  { "g", 0.01480000 },
+  { "h", 0.03200000 },
+  { "i", 0.12300000 },
+  { "j", 0.01230000 },
+  { "k", 0.06580000 },
+  { "l", 0.03450000 },
+  { "m", 0.04850000 },
+  { "n", 0.06790000 },
+  { "o", 0.04150000 },
+  { "p", 0.01170000 },
+  { "r", 0.02200000 },
+  { "s", 0.02860000 },
+  { "t", 0.03330000 },
+  { "u", 0.05810000 },
+  { "v", 0.00600000 },
+  { "w", 0.04270000 },
+  { "y", 0.02750000 },
+  { "z", 0.01660000 },
+};
+
+const wa_cp_freq ALPHA_284_FREQ_CPS[] = {
+  { 0x61u, 0.21260000 },
+  { 0x62u, 0.01910000 },
+  { 0x63u, 0.00960000 },
+  { 0x64u, 0.01810000 },
+  { 0x65u, 0.04440000 },
+  { 0x66u, 0.00960000 },
+  { 0x67u, 0.01480000 },
+  { 0x68u, 0.03200000 },
+  { 0x69u, 0.12300000 },
+  { 0x6Au, 0.01230000 },
+  { 0x6Bu, 0.06580000 },
+  { 0x6Cu, 0.03450000 },
+  { 0x6Du, 0.04850000 },
+  { 0x6Eu, 0.06790000 },
+  { 0x6Fu, 0.04150000 },
+  { 0x70u, 0.01170000 },
+  { 0x72u, 0.02200000 },
+  { 0x73u, 0.02860000 },
+  { 0x74u, 0.03330000 },
+  { 0x75u, 0.05810000 },
+  { 0x76u, 0.00600000 },
+  { 0x77u, 0.04270000 },
+  { 0x79u, 0.02750000 },
+  { 0x7Au, 0.01660000 },
+};
+
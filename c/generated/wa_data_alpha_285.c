@@ -0,0 +1,113 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_285_UPPER[] = {
+  "ܐ",
+  "ܒ",
+  "ܓ",
+  "ܕ",
+  "ܗ",
+  "ܘ",
+  "ܙ",
+  "ܚ",
+  "ܛ",
+  "ܝ",
+  "ܟ",
+  "ܠ",
+  "ܡ",
+  "ܢ",
+  "ܣ",
+  "ܥ",
+  "ܦ",
+  "ܨ",
+  "ܩ",
+  "ܪ",
+  "ܫ",
+  "ܬ",
+};
+const char *ALPHA_285_LOWER[] = {
+  "ܐ",
+  "ܒ",
+  "ܓ",
+  "ܕ",
+  "ܗ",
+  "ܘ",
+  "ܙ",
+  "ܚ",
+  "ܛ",
+  "ܝ",
+  "ܟ",
+  "ܠ",
+  "ܡ",
+  "ܢ",
+  "ܣ",
+  "ܥ",
+  "ܦ",
+  "ܨ",
+  "ܩ",
+  "ܪ",
+  "ܫ",
+  "ܬ",
+};
+const char *ALPHA_285_DIGITS[] = {
+};
+const uint32_t ALPHA_285_UPPER_CPS[] = {
+  1808, 1810, 1811, 1813, 1815, 1816, 1817, 1818, 1819, 1821, 1823, 1824, 1825, 1826, 1827, 1829,
+  1830, 1832, 1833, 1834, 1835, 1836,
+};
+const uint32_t ALPHA_285_LOWER_CPS[] = {
+  1808, 1810, 1811, 1813, 1815, 1816, 1817, 1818, 1819, 1821, 1823, 1824, 1825, 1826, 1827, 1829,
+  1830, 1832, 1833, 1834, 1835, 1836,
+};
+const uint32_t ALPHA_285_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_285_FREQ[] = {
+  { "ܐ", 0.00000000 },
+  { "ܒ", 0.00000000 },
+  { "ܓ", 0.00000000 },
+  { "ܕ", 0.00000000 },
+  { "ܗ", 0.00000000 },
+  { "ܘ", 0.00000000 },
+  { "ܙ", 0.00000000 },
+  { "ܚ", 0.00000000 },
+  { "ܛ", 0.00000000 },
+  { "ܝ", 0.00000000 },
+  { "ܟ", 0.00000000 },
+  { "ܠ", 0.00000000 },
+  { "ܡ", 0.00000000 },
+  { "ܢ", 0.00000000 },
+  { "ܣ", 0.00000000 },
+  { "ܥ", 0.00000000 },
+  { "ܦ", 0.00000000 },
+  { "ܨ", 0.00000000 },
+  { "ܩ", 0.00000000 },
+  { "ܪ", 0.00000000 },
+  { "ܫ", 0.00000000 },
+  { "ܬ", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_285_FREQ_CPS[] = {
+  { 0x710u, 0.00000000 },
+  { 0x712u, 0.00000000 },
+  { 0x713u, 0.00000000 },
+  { 0x715u, 0.00000000 },
+  { 0x717u, 0.00000000 },
+  { 0x718u, 0.00000000 },
+  { 0x719u, 0.00000000 },
+  { 0x71Au, 0.00000000 },
+  { 0x71Bu, 0.00000000 },
+  { 0x71Du, 0.00000000 },
+  { 0x71Fu, 0.00000000 },
+  { 0x720u, 0.00000000 },
+  { 0x721u, 0.00000000 },
+  { 0x722u, 0.00000000 },
+  { 0x723u, 0.00000000 },
+  { 0x725u, 0.00000000 },
+  { 0x726u, 0.00000000 },
+  { 0x728u, 0.00000000 },
+  { 0x729u, 0.00000000 },
+  { 0x72Au, 0.00000000 },
+  { 0x72Bu, 0.00000000 },
+  { 0x72Cu, 0.00000000 },
+};
+
@@ -0,0 +1,173 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_286_UPPER[] = {
+  "A",
+  "Ã",
+  "B",
+  "C",
+  "Ć",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "Ł",
+  "M",
+  "N",
+  "Ń",
+  "O",
+  "Ŏ",
+  "Ô",
+  "Õ",
+  "Ō",
+  "P",
+  "R",
+  "S",
+  "Ś",
+  "T",
+  "U",
+  "W",
+  "Y",
+  "Z",
+  "Ź",
+  "Ż",
+};
+const char *ALPHA_286_LOWER[] = {
+  "a",
+  "ã",
+  "b",
+  "c",
+  "ć",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "ł",
+  "m",
+  "n",
+  "ń",
+  "o",
+  "ŏ",
+  "ô",
+  "õ",
+  "ō",
+  "p",
+  "r",
+  "s",
+  "ś",
+  "t",
+  "u",
+  "w",
+  "y",
+  "z",
+  "ź",
+  "ż",
+};
+const char *ALPHA_286_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_286_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  82, 83, 84, 85, 87, 89, 90, 195, 212, 213, 262, 321, 323, 332, 334, 346,
+  377, 379,
+};
+const uint32_t ALPHA_286_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  114, 115, 116, 117, 119, 121, 122, 227, 244, 245, 263, 322, 324, 333, 335, 347,
+  378, 380,
+};
+const uint32_t ALPHA_286_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_286_FREQ[] = {
+  { "a", 0.08610000 },
+  { "ã", 0.00000000 },
+  { "b", 0.01630000 },
+  { "c", 0.03050000 },
+  { "ć", 0.00550000 },
+  { "d", 0.03220000 },
+  { "e", 0.07030000 },
+  { "f", 0.00610000 },
+  { "g", 0.01930000 },
+  { "h", 0.01490000 },
+  { "i", 0.04750000 },
+  { "j", 0.04470000 },
+  { "k", 0.04170000 },
+  { "l", 0.03060000 },
+  { "ł", 0.00790000 },
+  { "m", 0.03630000 },
+  { "n", 0.05110000 },
+  { "ń", 0.01620000 },
+  { "o", 0.09190000 },
+  { "ŏ", 0.00020000 },
+  { "ô", 0.00010000 },
+  { "õ", 0.00000000 },
+  { "ō", 0.00040000 },
+  { "p", 0.02650000 },
+  { "r", 0.04910000 },
+  { "s", 0.04280000 },
+  { "ś", 0.00950000 },
+  { "t", 0.03970000 },
+  { "u", 0.03840000 },
+  { "w", 0.04480000 },
+  { "y", 0.05850000 },
+  { "z", 0.03250000 },
+  { "ź", 0.00470000 },
+  { "ż", 0.00350000 },
+};
+
+const wa_cp_freq ALPHA_286_FREQ_CPS[] = {
+  { 0x61u, 0.08610000 },
+  { 0x62u, 0.01630000 },
+  { 0x63u, 0.03050000 },
+  { 0x64u, 0.03220000 },
+  { 0x65u, 0.07030000 },
+  { 0x66u, 0.00610000 },
+  { 0x67u, 0.01930000 },
+  { 0x68u, 0.01490000 },
+  { 0x69u, 0.04750000 },
+  { 0x6Au, 0.04470000 },
+  { 0x6Bu, 0.04170000 },
+  { 0x6Cu, 0.03060000 },
+  { 0x6Du, 0.03630000 },
+  { 0x6Eu, 0.05110000 },
+  { 0x6Fu, 0.09190000 },
+  { 0x70u, 0.02650000 },
+  { 0x72u, 0.04910000 },
+  { 0x73u, 0.04280000 },
+  { 0x74u, 0.03970000 },
+  { 0x75u, 0.03840000 },
+  { 0x77u, 0.04480000 },
+  { 0x79u, 0.05850000 },
+  { 0x7Au, 0.03250000 },
+  { 0xE3u, 0.00000000 },
+  { 0xF4u, 0.00010000 },
+  { 0xF5u, 0.00000000 },
+  { 0x107u, 0.00550000 },
+  { 0x142u, 0.00790000 },
+  { 0x144u, 0.01620000 },
+  { 0x14Du, 0.00040000 },
+  { 0x14Fu, 0.00020000 },
+  { 0x15Bu, 0.00950000 },
+  { 0x17Au, 0.00470000 },
+  { 0x17Cu, 0.00350000 },
+};
+
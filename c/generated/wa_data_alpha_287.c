@@ -0,0 +1,167 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_287_UPPER[] = {
+  "அ",
+  "ஆ",
+  "இ",
+  "ஈ",
+  "உ",
+  "ஊ",
+  "எ",
+  "ஏ",
+  "ஐ",
+  "ஒ",
+  "ஓ",
+  "ஔ",
+  "க",
+  "ங",
+  "ச",
+  "ஞ",
+  "ட",
+  "ண",
+  "த",
+  "ந",
+  "ப",
+  "ம",
+  "ய",
+  "ர",
+  "ல",
+  "வ",
+  "ழ",
+  "ள",
+  "ற",
+  "ன",
+  "ஃ",
+  "ஜ",
+  "ஷ",
+  "ஸ",
+  "ஹ",
+};
+const char *ALPHA_287_LOWER[] = {
+  "அ",
+  "ஆ",
+  "இ",
+  "ஈ",
+  "உ",
+  "ஊ",
+  "எ",
+  "ஏ",
+  "ஐ",
+  "ஒ",
+  "ஓ",
+  "ஔ",
+  "க",
+  "ங",
+  "ச",
+  "ஞ",
+  "ட",
+  "ண",
+  "த",
+  "ந",
+  "ப",
+  "ம",
+  "ய",
+  "ர",
+  "ல",
+  "வ",
+  "ழ",
+  "ள",
+  "ற",
+  "ன",
+  "ஃ",
+  "ஜ",
+  "ஷ",
+  "ஸ",
+  "ஹ",
+};
+const char *ALPHA_287_DIGITS[] = {
+};
+const uint32_t ALPHA_287_UPPER_CPS[] = {
+  2947, 2949, 2950, 2951, 2952, 2953, 2954, 2958, 2959, 2960, 2962, 2963, 2964, 2965, 2969, 2970,
+  2972, 2974, 2975, 2979, 2980, 2984, 2985, 2986, 2990, 2991, 2992, 2993, 2994, 2995, 2996, 2997,
+  2999, 3000, 3001,
+};
+const uint32_t ALPHA_287_LOWER_CPS[] = {
+  2947, 2949, 2950, 2951, 2952, 2953, 2954, 2958, 2959, 2960, 2962, 2963, 2964, 2965, 2969, 2970,
+  2972, 2974, 2975, 2979, 2980, 2984, 2985, 2986, 2990, 2991, 2992, 2993, 2994, 2995, 2996, 2997,
+  2999, 3000, 3001,
+};
+const uint32_t ALPHA_287_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_287_FREQ[] = {
+  { "அ", 0.01620000 },
+  { "ஆ", 0.01010000 },
+  { "இ", 0.01920000 },
+  { "ஈ", 0.00040000 },
+  { "உ", 0.00650000 },
+  { "ஊ", 0.00040000 },
+  { "எ", 0.00910000 },
+  { "ஏ", 0.00170000 },
+  { "ஐ", 0.00080000 },
+  { "ஒ", 0.00450000 },
+  { "ஓ", 0.00070000 },
+  { "ஔ", 0.00000000 },
+  { "க", 0.12630000 },
+  { "ங", 0.00960000 },
+  { "ச", 0.03130000 },
+  { "ஞ", 0.00100000 },
+  { "ட", 0.07410000 },
+  { "ண", 0.01740000 },
+  { "த", 0.10780000 },
+  { "ந", 0.02820000 },
+  { "ப", 0.08720000 },
+  { "ம", 0.07060000 },
+  { "ய", 0.04250000 },
+  { "ர", 0.07170000 },
+  { "ல", 0.05580000 },
+  { "வ", 0.05220000 },
+  { "ழ", 0.00980000 },
+  { "ள", 0.03890000 },
+  { "ற", 0.04300000 },
+  { "ன", 0.05370000 },
+  { "ஃ", 0.00080000 },
+  { "ஜ", 0.00230000 },
+  { "ஷ", 0.00090000 },
+  { "ஸ", 0.00430000 },
+  { "ஹ", 0.00110000 },
+};
+
+const wa_cp_freq ALPHA_287_FREQ_CPS[] = {
+  { 0xB83u, 0.00080000 },
+  { 0xB85u, 0.01620000 },
+  { 0xB86u, 0.01010000 },
+  { 0xB87u, 0.01920000 },
+  { 0xB88u, 0.00040000 },
+  { 0xB89u, 0.00650000 },
+  { 0xB8Au, 0.00040000 },
+  { 0xB8Eu, 0.00910000 },
+  { 0xB8Fu, 0.00170000 },
+  { 0xB90u, 0.00080000 },
+  { 0xB92u, 0.00450000 },
+  { 0xB93u, 0.00070000 },
+  { 0xB94u, 0.00000000 },
+  { 0xB95u, 0.12630000 },
+  { 0xB99u, 0.00960000 },
+  { 0xB9Au, 0.03130000 },
+  { 0xB9Cu, 0.00230000 },
+  { 0xB9Eu, 0.00100000 },
+  { 0xB9Fu, 0.07410000 },
+  { 0xBA3u, 0.01740000 },
+  { 0xBA4u, 0.10780000 },
+  { 0xBA8u, 0.02820000 },
+  { 0xBA9u, 0.05370000 },
+  { 0xBAAu, 0.08720000 },
+  { 0xBAEu, 0.07060000 },
+  { 0xBAFu, 0.04250000 },
+  { 0xBB0u, 0.07170000 },
+  { 0xBB1u, 0.04300000 },
+  { 0xBB2u, 0.05580000 },
+  { 0xBB3u, 0.03890000 },
+  { 0xBB4u, 0.00980000 },
+  { 0xBB5u, 0.05220000 },
+  { 0xBB7u, 0.00090000 },
+  { 0xBB8u, 0.00430000 },
+  { 0xBB9u, 0.00110000 },
+};
+
@@ -0,0 +1,97 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_288_UPPER[] = {
+  "ᝠ",
+  "ᝡ",
+  "ᝢ",
+  "ᝣ",
+  "ᝤ",
+  "ᝥ",
+  "ᝦ",
+  "ᝧ",
+  "ᝨ",
+  "ᝩ",
+  "ᝪ",
+  "ᝫ",
+  "ᝬ",
+  "ᝮ",
+  "ᝯ",
+  "ᝰ",
+  "ᝲ",
+  "ᝳ",
+};
+const char *ALPHA_288_LOWER[] = {
+  "ᝠ",
+  "ᝡ",
+  "ᝢ",
+  "ᝣ",
+  "ᝤ",
+  "ᝥ",
+  "ᝦ",
+  "ᝧ",
+  "ᝨ",
+  "ᝩ",
+  "ᝪ",
+  "ᝫ",
+  "ᝬ",
+  "ᝮ",
+  "ᝯ",
+  "ᝰ",
+  "ᝲ",
+  "ᝳ",
+};
+const char *ALPHA_288_DIGITS[] = {
+};
+const uint32_t ALPHA_288_UPPER_CPS[] = {
+  5984, 5985, 5986, 5987, 5988, 5989, 5990, 5991, 5992, 5993, 5994, 5995, 5996, 5998, 5999, 6000,
+  6002, 6003,
+};
+const uint32_t ALPHA_288_LOWER_CPS[] = {
+  5984, 5985, 5986, 5987, 5988, 5989, 5990, 5991, 5992, 5993, 5994, 5995, 5996, 5998, 5999, 6000,
+  6002, 6003,
+};
+const uint32_t ALPHA_288_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_288_FREQ[] = {
+  { "ᝠ", 0.00000000 },
+  { "ᝡ", 0.00000000 },
+  { "ᝢ", 0.00000000 },
+  { "ᝣ", 0.00000000 },
+  { "ᝤ", 0.00000000 },
+  { "ᝥ", 0.00000000 },
+  { "ᝦ", 0.00000000 },
+  { "ᝧ", 0.00000000 },
+  { "ᝨ", 0.00000000 },
+  { "ᝩ", 0.00000000 },
+  { "ᝪ", 0.00000000 },
+  { "ᝫ", 0.00000000 },
+  { "ᝬ", 0.00000000 },
+  { "ᝮ", 0.00000000 },
+  { "ᝯ", 0.00000000 },
+  { "ᝰ", 0.00000000 },
+  { "ᝲ", 0.00000000 },
+  { "ᝳ", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_288_FREQ_CPS[] = {
+  { 0x1760u, 0.00000000 },
+  { 0x1761u, 0.00000000 },
+  { 0x1762u, 0.00000000 },
+  { 0x1763u, 0.00000000 },
+  { 0x1764u, 0.00000000 },
+  { 0x1765u, 0.00000000 },
+  { 0x1766u, 0.00000000 },
+  { 0x1767u, 0.00000000 },
+  { 0x1768u, 0.00000000 },
+  { 0x1769u, 0.00000000 },
+  { 0x176Au, 0.00000000 },
+  { 0x176Bu, 0.00000000 },
+  { 0x176Cu, 0.00000000 },
+  { 0x176Eu, 0.00000000 },
+  { 0x176Fu, 0.00000000 },
+  { 0x1770u, 0.00000000 },
+  { 0x1772u, 0.00000000 },
+  { 0x1773u, 0.00000000 },
+};
+
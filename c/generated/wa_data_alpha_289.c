@@ -0,0 +1,233 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_289_UPPER[] = {
+  "అ",
+  "ఆ",
+  "ఇ",
+  "ఈ",
+  "ఉ",
+  "ఊ",
+  "ఋ",
+  "ౠ",
+  "ఎ",
+  "ఏ",
+  "ఐ",
+  "ఒ",
+  "ఓ",
+  "ఔ",
+  "క",
+  "ఖ",
+  "గ",
+  "ఘ",
+  "ఙ",
+  "చ",
+  "ఛ",
+  "జ",
+  "ఝ",
+  "ఞ",
+  "ట",
+  "ఠ",
+  "డ",
+  "ఢ",
+  "ణ",
+  "త",
+  "థ",
+  "ద",
+  "ధ",
+  "న",
+  "ప",
+  "ఫ",
+  "బ",
+  "భ",
+  "మ",
+  "య",
+  "ర",
+  "ఱ",
+  "ల",
+  "వ",
+  "శ",
+  "ష",
+  "స",
+  "హ",
+  "ళ",
+  "ఌ",
+  "ౡ",
+};
+const char *ALPHA_289_LOWER[] = {
+  "అ",
+  "ఆ",
+  "ఇ",
+  "ఈ",
+  "ఉ",
+  "ఊ",
+  "ఋ",
+  "ౠ",
+  "ఎ",
+  "ఏ",
+  "ఐ",
+  "ఒ",
+  "ఓ",
+  "ఔ",
+  "క",
+  "ఖ",
+  "గ",
+  "ఘ",
+  "ఙ",
+  "చ",
+  "ఛ",
+  "జ",
+  "ఝ",
+  "ఞ",
+  "ట",
+  "ఠ",
+  "డ",
+  "ఢ",
+  "ణ",
+  "త",
+  "థ",
+  "ద",
+  "ధ",
+  "న",
+  "ప",
+  "ఫ",
+  "బ",
+  "భ",
+  "మ",
+  "య",
+  "ర",
+  "ఱ",
+  "ల",
+  "వ",
+  "శ",
+  "ష",
+  "స",
+  "హ",
+  "ళ",
+  "ఌ",
+  "ౡ",
+};
+const char *ALPHA_289_DIGITS[] = {
+};
+const uint32_t ALPHA_289_UPPER_CPS[] = {
+  3077, 3078, 3079, 3080, 3081, 3082, 3083, 3084, 3086, 3087, 3088, 3090, 3091, 3092, 3093, 3094,
+  3095, 3096, 3097, 3098, 3099, 3100, 3101, 3102, 3103, 3104, 3105, 3106, 3107, 3108, 3109, 3110,
+  3111, 3112, 3114, 3115, 3116, 3117, 3118, 3119, 3120, 3121, 3122, 3123, 3125, 3126, 3127, 3128,
+  3129, 3168, 3169,
+};
+const uint32_t ALPHA_289_LOWER_CPS[] = {
+  3077, 3078, 3079, 3080, 3081, 3082, 3083, 3084, 3086, 3087, 3088, 3090, 3091, 3092, 3093, 3094,
+  3095, 3096, 3097, 3098, 3099, 3100, 3101, 3102, 3103, 3104, 3105, 3106, 3107, 3108, 3109, 3110,
+  3111, 3112, 3114, 3115, 3116, 3117, 3118, 3119, 3120, 3121, 3122, 3123, 3125, 3126, 3127, 3128,
+  3129, 3168, 3169,
+};
+const uint32_t ALPHA_289_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_289_FREQ[] = {
+  { "అ", 0.01720000 },
+  { "ఆ", 0.00770000 },
+  { "ఇ", 0.00570000 },
+  { "ఈ", 0.00340000 },
+  { "ఉ", 0.00770000 },
+  { "ఊ", 0.00020000 },
+  { "ఋ", 0.00010000 },
+  { "ౠ", 0.00000000 },
+  { "ఎ", 0.00360000 },
+  { "ఏ", 0.00160000 },
+  { "ఐ", 0.00050000 },
+  { "ఒ", 0.00360000 },
+  { "ఓ", 0.00050000 },
+  { "ఔ", 0.00010000 },
+  { "క", 0.07580000 },
+  { "ఖ", 0.00240000 },
+  { "గ", 0.03440000 },
+  { "ఘ", 0.00070000 },
+  { "ఙ", 0.00000000 },
+  { "చ", 0.03440000 },
+  { "ఛ", 0.00040000 },
+  { "జ", 0.01470000 },
+  { "ఝ", 0.00000000 },
+  { "ఞ", 0.00030000 },
+  { "ట", 0.03400000 },
+  { "ఠ", 0.00040000 },
+  { "డ", 0.03460000 },
+  { "ఢ", 0.00010000 },
+  { "ణ", 0.00750000 },
+  { "త", 0.05490000 },
+  { "థ", 0.00420000 },
+  { "ద", 0.04540000 },
+  { "ధ", 0.01060000 },
+  { "న", 0.09730000 },
+  { "ప", 0.05160000 },
+  { "ఫ", 0.00420000 },
+  { "బ", 0.01480000 },
+  { "భ", 0.00780000 },
+  { "మ", 0.05090000 },
+  { "య", 0.04510000 },
+  { "ర", 0.10670000 },
+  { "ఱ", 0.00000000 },
+  { "ల", 0.08440000 },
+  { "వ", 0.05100000 },
+  { "శ", 0.01080000 },
+  { "ష", 0.00890000 },
+  { "స", 0.04800000 },
+  { "హ", 0.00790000 },
+  { "ళ", 0.00360000 },
+  { "ఌ", 0.00000000 },
+  { "ౡ", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_289_FREQ_CPS[] = {
+  { 0xC05u, 0.01720000 },
+  { 0xC06u, 0.00770000 },
+  { 0xC07u, 0.00570000 },
+  { 0xC08u, 0.00340000 },
+  { 0xC09u, 0.00770000 },
+  { 0xC0Au, 0.00020000 },
+  { 0xC0Bu, 0.00010000 },
+  { 0xC0Cu, 0.00000000 },
+  { 0xC0Eu, 0.00360000 },
+  { 0xC0Fu, 0.00160000 },
+  { 0xC10u, 0.00050000 },
+  { 0xC12u, 0.00360000 },
+  { 0xC13u, 0.00050000 },
+  { 0xC14u, 0.00010000 },
+  { 0xC15u, 0.07580000 },
+  { 0xC16u, 0.00240000 },
+  { 0xC17u, 0.03440000 },
+  { 0xC18u, 0.00070000 },
+  { 0xC19u, 0.00000000 },
+  { 0xC1Au, 0.03440000 },
+  { 0xC1Bu, 0.00040000 },
+  { 0xC1Cu, 0.01470000 },
+  { 0xC1Du, 0.00000000 },
+  { 0xC1Eu, 0.00030000 },
+  { 0xC1Fu, 0.03400000 },
+  { 0xC20u, 0.00040000 },
+  { 0xC21u, 0.03460000 },
+  { 0xC22u, 0.00010000 },
+  { 0xC23u, 0.00750000 },
+  { 0xC24u, 0.05490000 },
+  { 0xC25u, 0.00420000 },
+  { 0xC26u, 0.04540000 },
+  { 0xC27u, 0.01060000 },
+  { 0xC28u, 0.09730000 },
+  { 0xC2Au, 0.05160000 },
+  { 0xC2Bu, 0.00420000 },
+  { 0xC2Cu, 0.01480000 },
+  { 0xC2Du, 0.00780000 },
+  { 0xC2Eu, 0.05090000 },
+  { 0xC2Fu, 0.04510000 },
+  { 0xC30u, 0.10670000 },
+  { 0xC31u, 0.00000000 },
+  { 0xC32u, 0.08440000 },
+  { 0xC33u, 0.00360000 },
+  { 0xC35u, 0.05100000 },
+  { 0xC36u, 0.01080000 },
+  { 0xC37u, 0.00890000 },
+  { 0xC38u, 0.04800000 },
+  { 0xC39u, 0.00790000 },
+  { 0xC60u, 0.00000000 },
+  { 0xC61u, 0.00000000 },
+};
+
@@ -0,0 +1,185 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_29_UPPER[] = {
+  "آ",
+  "ئ",
+  "ا",
+  "ب",
+  "پ",
+  "ت",
+  "ث",
+  "ٹ",
+  "ج",
+  "چ",
+  "ح",
+  "خ",
+  "د",
+  "ڈ",
+  "ر",
+  "ز",
+  "ڑ",
+  "ژ",
+  "س",
+  "ش",
+  "ص",
+  "ض",
+  "ط",
+  "ظ",
+  "غ",
+  "ف",
+  "ق",
+  "ک",
+  "گ",
+  "ل",
+  "م",
+  "ن",
+  "ھ",
+  "و",
+  "ۆ",
+  "ی",
+  "ێ",
+};
+const char *ALPHA_29_LOWER[] = {
+  "آ",
+  "ئ",
+  "ا",
+  "ب",
+  "پ",
+  "ت",
+  "ث",
+  "ٹ",
+  "ج",
+  "چ",
+  "ح",
+  "خ",
+  "د",
+  "ڈ",
+  "ر",
+  "ز",
+  "ڑ",
+  "ژ",
+  "س",
+  "ش",
+  "ص",
+  "ض",
+  "ط",
+  "ظ",
+  "غ",
+  "ف",
+  "ق",
+  "ک",
+  "گ",
+  "ل",
+  "م",
+  "ن",
+  "ھ",
+  "و",
+  "ۆ",
+  "ی",
+  "ێ",
+};
+const char *ALPHA_29_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_29_UPPER_CPS[] = {
+  1570, 1574, 1575, 1576, 1578, 1579, 1580, 1581, 1582, 1583, 1585, 1586, 1587, 1588, 1589, 1590,
+  1591, 1592, 1594, 1601, 1602, 1604, 1605, 1606, 1608, 1657, 1662, 1670, 1672, 1681, 1688, 1705,
+  1711, 1726, 1734, 1740, 1742,
+};
+const uint32_t ALPHA_29_LOWER_CPS[] = {
+  1570, 1574, 1575, 1576, 1578, 1579, 1580, 1581, 1582, 1583, 1585, 1586, 1587, 1588, 1589, 1590,
+  1591, 1592, 1594, 1601, 1602, 1604, 1605, 1606, 1608, 1657, 1662, 1670, 1672, 1681, 1688, 1705,
+  1711, 1726, 1734, 1740, 1742,
+};
+const uint32_t ALPHA_29_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_29_FREQ[] = {
+  { "آ", 0.00000000 },
+  { "ئ", 0.00000000 },
+  { "ا", 0.00000000 },
+  { "ب", 0.00000000 },
+  { "پ", 0.00000000 },
+  { "ت", 0.00000000 },
+  { "ث", 0.00000000 },
+  { "ٹ", 0.00000000 },
+  { "ج", 0.00000000 },
+  { "چ", 0.00000000 },
+  { "ح", 0.00000000 },
+  { "خ", 0.00000000 },
+  { "د", 0.00000000 },
+  { "ڈ", 0.00000000 },
+  { "ر", 0.00000000 },
+  { "ز", 0.00000000 },
+  { "ڑ", 0.00000000 },
+  { "ژ", 0.00000000 },
+  { "س", 0.00000000 },
+  { "ش", 0.00000000 },
+  { "ص", 0.00000000 },
+  { "ض", 0.00000000 },
+  { "ط", 0.00000000 },
+  { "ظ", 0.00000000 },
+  { "غ", 0.00000000 },
+  { "ف", 0.00000000 },
+  { "ق", 0.00000000 },
+  { "ک", 0.00000000 },
+  { "گ", 0.00000000 },
+  { "ل", 0.00000000 },
+  { "م", 0.00000000 },
+  { "ن", 0.00000000 },
+  { "ھ", 0.00000000 },
+  { "و", 0.00000000 },
+  { "ۆ", 0.00000000 },
+  { "ی", 0.00000000 },
+  { "ێ", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_29_FREQ_CPS[] = {
+  { 0x622u, 0.00000000 },
+  { 0x626u, 0.00000000 },
+  { 0x627u, 0.00000000 },
+  { 0x628u, 0.00000000 },
+  { 0x62Au, 0.00000000 },
+  { 0x62Bu, 0.00000000 },
+  { 0x62Cu, 0.00000000 },
+  { 0x62Du, 0.00000000 },
+  { 0x62Eu, 0.00000000 },
+  { 0x62Fu, 0.00000000 },
+  { 0x631u, 0.00000000 },
+  { 0x632u, 0.00000000 },
+  { 0x633u, 0.00000000 },
+  { 0x634u, 0.00000000 },
+  { 0x635u, 0.00000000 },
+  { 0x636u, 0.00000000 },
+  { 0x637u, 0.00000000 },
+  { 0x638u, 0.00000000 },
+  { 0x63Au, 0.00000000 },
+  { 0x641u, 0.00000000 },
+  { 0x642u, 0.00000000 },
+  { 0x644u, 0.00000000 },
+  { 0x645u, 0.00000000 },
+  { 0x646u, 0.00000000 },
+  { 0x648u, 0.00000000 },
+  { 0x679u, 0.00000000 },
+  { 0x67Eu, 0.00000000 },
+  { 0x686u, 0.00000000 },
+  { 0x688u, 0.00000000 },
+  { 0x691u, 0.00000000 },
+  { 0x698u, 0.00000000 },
+  { 0x6A9u, 0.00000000 },
+  { 0x6AFu, 0.00000000 },
+  { 0x6BEu, 0.00000000 },
+  { 0x6C6u, 0.00000000 },
+  { 0x6CCu, 0.00000000 },
+  { 0x6CEu, 0.00000000 },
+};
+
@@ -0,0 +1,167 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_291_UPPER[] = {
+  "А",
+  "Б",
+  "В",
+  "Г",
+  "Ғ",
+  "Д",
+  "Е",
+  "Ё",
+  "Ж",
+  "З",
+  "И",
+  "Ӣ",
+  "Й",
+  "К",
+  "Қ",
+  "Л",
+  "М",
+  "Н",
+  "О",
+  "П",
+  "Р",
+  "С",
+  "Т",
+  "У",
+  "Ӯ",
+  "Ф",
+  "Х",
+  "Ҳ",
+  "Ч",
+  "Ҷ",
+  "Ш",
+  "Ъ",
+  "Э",
+  "Ю",
+  "Я",
+};
+const char *ALPHA_291_LOWER[] = {
+  "а",
+  "б",
+  "в",
+  "г",
+  "ғ",
+  "д",
+  "е",
+  "ё",
+  "ж",
+  "з",
+  "и",
+  "ӣ",
+  "й",
+  "к",
+  "қ",
+  "л",
+  "м",
+  "н",
+  "о",
+  "п",
+  "р",
+  "с",
+  "т",
+  "у",
+  "ӯ",
+  "ф",
+  "х",
+  "ҳ",
+  "ч",
+  "ҷ",
+  "ш",
+  "ъ",
+  "э",
+  "ю",
+  "я",
+};
+const char *ALPHA_291_DIGITS[] = {
+};
+const uint32_t ALPHA_291_UPPER_CPS[] = {
+  1025, 1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053, 1054,
+  1055, 1056, 1057, 1058, 1059, 1060, 1061, 1063, 1064, 1066, 1069, 1070, 1071, 1170, 1178, 1202,
+  1206, 1250, 1262,
+};
+const uint32_t ALPHA_291_LOWER_CPS[] = {
+  1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080, 1081, 1082, 1083, 1084, 1085, 1086, 1087,
+  1088, 1089, 1090, 1091, 1092, 1093, 1095, 1096, 1098, 1101, 1102, 1103, 1105, 1171, 1179, 1203,
+  1207, 1251, 1263,
+};
+const uint32_t ALPHA_291_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_291_FREQ[] = {
+  { "а", 0.14980000 },
+  { "б", 0.02980000 },
+  { "в", 0.02430000 },
+  { "г", 0.01370000 },
+  { "ғ", 0.00160000 },
+  { "д", 0.05210000 },
+  { "е", 0.02480000 },
+  { "ё", 0.00500000 },
+  { "ж", 0.00140000 },
+  { "з", 0.01890000 },
+  { "и", 0.11720000 },
+  { "ӣ", 0.00510000 },
+  { "й", 0.00640000 },
+  { "к", 0.02840000 },
+  { "қ", 0.00590000 },
+  { "л", 0.03110000 },
+  { "м", 0.04150000 },
+  { "н", 0.05880000 },
+  { "о", 0.08870000 },
+  { "п", 0.00780000 },
+  { "р", 0.06720000 },
+  { "с", 0.04050000 },
+  { "т", 0.04740000 },
+  { "у", 0.03530000 },
+  { "ӯ", 0.00350000 },
+  { "ф", 0.00940000 },
+  { "х", 0.01510000 },
+  { "ҳ", 0.01850000 },
+  { "ч", 0.00550000 },
+  { "ҷ", 0.00680000 },
+  { "ш", 0.02140000 },
+  { "ъ", 0.00450000 },
+  { "э", 0.00170000 },
+  { "ю", 0.00150000 },
+  { "я", 0.00940000 },
+};
+
+const wa_cp_freq ALPHA_291_FREQ_CPS[] = {
+  { 0x430u, 0.14980000 },
+  { 0x431u, 0.02980000 },
+  { 0x432u, 0.02430000 },
+  { 0x433u, 0.01370000 },
+  { 0x434u, 0.05210000 },
+  { 0x435u, 0.02480000 },
+  { 0x436u, 0.00140000 },
+  { 0x437u, 0.01890000 },
+  { 0x438u, 0.11720000 },
+  { 0x439u, 0.00640000 },
+  { 0x43Au, 0.02840000 },
+  { 0x43Bu, 0.03110000 },
+  { 0x43Cu, 0.04150000 },
+  { 0x43Du, 0.05880000 },
+  { 0x43Eu, 0.08870000 },
+  { 0x43Fu, 0.00780000 },
+  { 0x440u, 0.06720000 },
+  { 0x441u, 0.04050000 },
+  { 0x442u, 0.04740000 },
+  { 0x443u, 0.03530000 },
+  { 0x444u, 0.00940000 },
+  { 0x445u, 0.01510000 },
+  { 0x447u, 0.00550000 },
+  { 0x448u, 0.02140000 },
+  { 0x44Au, 0.00450000 },
+  { 0x44Du, 0.00170000 },
+  { 0x44Eu, 0.00150000 },
+  { 0x44Fu, 0.00940000 },
+  { 0x451u, 0.00500000 },
+  { 0x493u, 0.00160000 },
+  { 0x49Bu, 0.00590000 },
+  { 0x4B3u, 0.01850000 },
+  { 0x4B7u, 0.00680000 },
+  { 0x4E3u, 0.00510000 },
+  { 0x4EFu, 0.00350000 },
+};
+
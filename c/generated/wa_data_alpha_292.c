@@ -0,0 +1,257 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_292_UPPER[] = {
+  "ก",
+  "ข",
+  "ฃ",
+  "ค",
+  "ฅ",
+  "ฆ",
+  "ง",
+  "จ",
+  "ฉ",
+  "ช",
+  "ซ",
+  "ฌ",
+  "ญ",
+  "ฎ",
+  "ฏ",
+  "ฐ",
+  "ฑ",
+  "ฒ",
+  "ณ",
+  "ด",
+  "ต",
+  "ถ",
+  "ท",
+  "ธ",
+  "น",
+  "บ",
+  "ป",
+  "ผ",
+  "ฝ",
+  "พ",
+  "ฟ",
+  "ภ",
+  "ม",
+  "ย",
+  "ร",
+  "ฤ",
+  "ล",
+  "ฦ",
+  "ว",
+  "ศ",
+  "ษ",
+  "ส",
+  "ห",
+  "ฬ",
+  "อ",
+  "ฮ",
+  "ฯ",
+  "ะ",
+  "า",
+  "ำ",
+  "เ",
+  "แ",
+  "โ",
+  "ใ",
+  "ไ",
+  "ๅ",
+  "ๆ",
+};
+const char *ALPHA_292_LOWER[] = {
+  "ก",
+  "ข",
+  "ฃ",
+  "ค",
+  "ฅ",
+  "ฆ",
+  "ง",
+  "จ",
+  "ฉ",
+  "ช",
+  "ซ",
+  "ฌ",
+  "ญ",
+  "ฎ",
+  "ฏ",
+  "ฐ",
+  "ฑ",
+  "ฒ",
+  "ณ",
+  "ด",
+  "ต",
+  "ถ",
+  "ท",
+  "ธ",
+  "น",
+  "บ",
+  "ป",
+  "ผ",
+  "ฝ",
+  "พ",
+  "ฟ",
+  "ภ",
+  "ม",
+  "ย",
+  "ร",
+  "ฤ",
+  "ล",
+  "ฦ",
+  "ว",
+  "ศ",
+  "ษ",
+  "ส",
+  "ห",
+  "ฬ",
+  "อ",
+  "ฮ",
+  "ฯ",
+  "ะ",
+  "า",
+  "ำ",
+  "เ",
+  "แ",
+  "โ",
+  "ใ",
+  "ไ",
+  "ๅ",
+  "ๆ",
+};
+const char *ALPHA_292_DIGITS[] = {
+};
+const uint32_t ALPHA_292_UPPER_CPS[] = {
+  3585, 3586, 3587, 3588, 3589, 3590, 3591, 3592, 3593, 3594, 3595, 3596, 3597, 3598, 3599, 3600,
+  3601, 3602, 3603, 3604, 3605, 3606, 3607, 3608, 3609, 3610, 3611, 3612, 3613, 3614, 3615, 3616,
+  3617, 3618, 3619, 3620, 3621, 3622, 3623, 3624, 3625, 3626, 3627, 3628, 3629, 3630, 3631, 3632,
+  3634, 3635, 3648, 3649, 3650, 3651, 3652, 3653, 3654,
+};
+const uint32_t ALPHA_292_LOWER_CPS[] = {
+  3585, 3586, 3587, 3588, 3589, 3590, 3591, 3592, 3593, 3594, 3595, 3596, 3597, 3598, 3599, 3600,
+  3601, 3602, 3603, 3604, 3605, 3606, 3607, 3608, 3609, 3610, 3611, 3612, 3613, 3614, 3615, 3616,
+  3617, 3618, 3619, 3620, 3621, 3622, 3623, 3624, 3625, 3626, 3627, 3628, 3629, 3630, 3631, 3632,
+  3634, 3635, 3648, 3649, 3650, 3651, 3652, 3653, 3654,
+};
+const uint32_t ALPHA_292_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_292_FREQ[] = {
+  { "ก", 0.05330000 },
+  { "ข", 0.01430000 },
+  { "ฃ", 0.00000000 },
+  { "ค", 0.02110000 },
+  { "ฅ", 0.00000000 },
+  { "ฆ", 0.00020000 },
+  { "ง", 0.05020000 },
+  { "จ", 0.01820000 },
+  { "ฉ", 0.00100000 },
+  { "ช", 0.01470000 },
+  { "ซ", 0.00600000 },
+  { "ฌ", 0.00000000 },
+  { "ญ", 0.00340000 },
+  { "ฎ", 0.00050000 },
+  { "ฏ", 0.00060000 },
+  { "ฐ", 0.00170000 },
+  { "ฑ", 0.00030000 },
+  { "ฒ", 0.00050000 },
+  { "ณ", 0.00440000 },
+  { "ด", 0.03060000 },
+  { "ต", 0.02580000 },
+  { "ถ", 0.00540000 },
+  { "ท", 0.02960000 },
+  { "ธ", 0.00470000 },
+  { "น", 0.07630000 },
+  { "บ", 0.02260000 },
+  { "ป", 0.02420000 },
+  { "ผ", 0.00410000 },
+  { "ฝ", 0.00090000 },
+  { "พ", 0.01780000 },
+  { "ฟ", 0.00260000 },
+  { "ภ", 0.00440000 },
+  { "ม", 0.04320000 },
+  { "ย", 0.03500000 },
+  { "ร", 0.06980000 },
+  { "ฤ", 0.00100000 },
+  { "ล", 0.03370000 },
+  { "ฦ", 0.00000000 },
+  { "ว", 0.03240000 },
+  { "ศ", 0.00940000 },
+  { "ษ", 0.00450000 },
+  { "ส", 0.02690000 },
+  { "ห", 0.02080000 },
+  { "ฬ", 0.00030000 },
+  { "อ", 0.05430000 },
+  { "ฮ", 0.00120000 },
+  { "ฯ", 0.00030000 },
+  { "ะ", 0.02460000 },
+  { "า", 0.08510000 },
+  { "ำ", 0.00870000 },
+  { "เ", 0.05140000 },
+  { "แ", 0.02000000 },
+  { "โ", 0.01050000 },
+  { "ใ", 0.01420000 },
+  { "ไ", 0.01230000 },
+  { "ๅ", 0.00000000 },
+  { "ๆ", 0.00110000 },
+};
+
+const wa_cp_freq ALPHA_292_FREQ_CPS[] = {
+  { 0xE01u, 0.05330000 },
+  { 0xE02u, 0.01430000 },
+  { 0xE03u, 0.00000000 },
+  { 0xE04u, 0.02110000 },
+  { 0xE05u, 0.00000000 },
+  { 0xE06u, 0.00020000 },
+  { 0xE07u, 0.05020000 },
+  { 0xE08u, 0.01820000 },
+  { 0xE09u, 0.00100000 },
+  { 0xE0Au, 0.01470000 },
+  { 0xE0Bu, 0.00600000 },
+  { 0xE0Cu, 0.00000000 },
+  { 0xE0Du, 0.00340000 },
+  { 0xE0Eu, 0.00050000 },
+  { 0xE0Fu, 0.00060000 },
+  { 0xE10u, 0.00170000 },
+  { 0xE11u, 0.00030000 },
+  { 0xE12u, 0.00050000 },
+  { 0xE13u, 0.00440000 },
+  { 0xE14u, 0.03060000 },
+  { 0xE15u, 0.02580000 },
+  { 0xE16u, 0.00540000 },
+  { 0xE17u, 0.02960000 },
+  { 0xE18u, 0.00470000 },
+  { 0xE19u, 0.07630000 },
+  { 0xE1Au, 0.02260000 },
+  { 0xE1Bu, 0.02420000 },
+  { 0xE1Cu, 0.00410000 },
+  { 0xE1Du, 0.00090000 },
+  { 0xE1Eu, 0.01780000 },
+  { 0xE1Fu, 0.00260000 },
+  { 0xE20u, 0.00440000 },
+  { 0xE21u, 0.04320000 },
+  { 0xE22u, 0.03500000 },
+  { 0xE23u, 0.06980000 },
+  { 0xE24u, 0.00100000 },
+  { 0xE25u, 0.03370000 },
+  { 0xE26u, 0.00000000 },
+  { 0xE27u, 0.03240000 },
+  { 0xE28u, 0.00940000 },
+  { 0xE29u, 0.00450000 },
+  { 0xE2Au, 0.02690000 },
+  { 0xE2Bu, 0.02080000 },
+  { 0xE2Cu, 0.00030000 },
+  { 0xE2Du, 0.05430000 },
+  { 0xE2Eu, 0.00120000 },
+  { 0xE2Fu, 0.00030000 },
+  { 0xE30u, 0.02460000 },
+  { 0xE32u, 0.08510000 },
+  { 0xE33u, 0.00870000 },
+  { 0xE40u, 0.05140000 },
+  { 0xE41u, 0.02000000 },
+  { 0xE42u, 0.01050000 },
+  { 0xE43u, 0.01420000 },
+  { 0xE44u, 0.01230000 },
+  { 0xE45u, 0.00000000 },
+  { 0xE46u, 0.00110000 },
+};
+
@@ -0,0 +1,1259 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_293_UPPER[] = {
+  "ሀ",
+  "ለ",
+  "ሐ",
+  "መ",
+  "ሠ",
+  "ረ",
+  "ሰ",
+  "ሸ",
+  "ቀ",
+  "ቈ",
+  "ቐ",
+  "ቘ",
+  "በ",
+  "ቨ",
+  "ተ",
+  "ቸ",
+  "ኀ",
+  "ኈ",
+  "ነ",
+  "ኘ",
+  "አ",
+  "ከ",
+  "ኰ",
+  "ኸ",
+  "ዀ",
+  "ወ",
+  "ዐ",
+  "ዘ",
+  "ዠ",
+  "የ",
+  "ደ",
+  "ጀ",
+  "ገ",
+  "ጐ",
+  "ጠ",
+  "ጨ",
+  "ጰ",
+  "ጸ",
+  "ፀ",
+  "ፈ",
+  "ፐ",
+  "ሁ",
+  "ሂ",
+  "ሃ",
+  "ሄ",
+  "ህ",
+  "ሆ",
+  "ሉ",
+  "ሊ",
+  "ላ",
+  "ሌ",
+  "ል",
+  "ሎ",
+  "ሏ",
+  "ሑ",
+  "ሒ",
+  "ሓ",
+  "ሔ",
+  "ሕ",
+  "ሖ",
+  "ሗ",
+  "ሙ",
+  "ሚ",
+  "ማ",
+  "ሜ",
+  "ም",
+  "ሞ",
+  "ሟ",
+  "ሡ",
+  "ሢ",
+  "ሣ",
+  "ሤ",
+  "ሥ",
+  "ሦ",
+  "ሧ",
+  "ሩ",
+  "ሪ",
+  "ራ",
+  "ሬ",
+  "ር",
+  "ሮ",
+  "ሯ",
+  "ሱ",
+  "ሲ",
+  "ሳ",
+  "ሴ",
+  "ስ",
+  "ሶ",
+  "ሷ",
+  "ሹ",
+  "ሺ",
+  "ሻ",
+  "ሼ",
+  "ሽ",
+  "ሾ",
+  "ሿ",
+  "ቁ",
+  "ቂ",
+  "ቃ",
+  "ቄ",
+  "ቅ",
+  "ቆ",
+  "ቊ",
+  "ቋ",
+  "ቌ",
+  "ቍ",
+  "ቑ",
+  "ቒ",
+  "ቓ",
+  "ቔ",
+  "ቕ",
+  "ቖ",
+  "ቚ",
+  "ቛ",
+  "ቜ",
+  "ቝ",
+  "ቡ",
+  "ቢ",
+  "ባ",
+  "ቤ",
+  "ብ",
+  "ቦ",
+  "ቧ",
+  "ቩ",
+  "ቪ",
+  "ቫ",
+  "ቬ",
+  "ቭ",
+  "ቮ",
+  "ቯ",
+  "ቱ",
+  "ቲ",
+  "ታ",
+  "ቴ",
+  "ት",
+  "ቶ",
+  "ቷ",
+  "ቹ",
+  "ቺ",
+  "ቻ",
+  "ቼ",
+  "ች",
+  "ቾ",
+  "ቿ",
+  "ኁ",
+  "ኂ",
+  "ኃ",
+  "ኄ",
+  "ኅ",
+  "ኆ",
+  "ኊ",
+  "ኋ",
+  "ኌ",
+  "ኍ",
+  "ኑ",
+  "ኒ",
+  "ና",
+  "ኔ",
+  "ን",
+  "ኖ",
+  "ኗ",
+  "ኙ",
+  "ኚ",
+  "ኛ",
+  "ኜ",
+  "ኝ",
+  "ኞ",
+  "ኟ",
+  "ኡ",
+  "ኢ",
+  "ኣ",
+  "ኤ",
+  "እ",
+  "ኦ",
+  "ኧ",
+  "ኩ",
+  "ኪ",
+  "ካ",
+  "ኬ",
+  "ክ",
+  "ኮ",
+  "ኲ",
+  "ኳ",
+  "ኴ",
+  "ኵ",
+  "ኹ",
+  "ኺ",
+  "ኻ",
+  "ኼ",
+  "ኽ",
+  "ኾ",
+  "ዂ",
+  "ዃ",
+  "ዄ",
+  "ዅ",
+  "ዉ",
+  "ዊ",
+  "ዋ",
+  "ዌ",
+  "ው",
+  "ዎ",
+  "ዑ",
+  "ዒ",
+  "ዓ",
+  "ዔ",
+  "ዕ",
+  "ዖ",
+  "ዙ",
+  "ዚ",
+  "ዛ",
+  "ዜ",
+  "ዝ",
+  "ዞ",
+  "ዟ",
+  "ዡ",
+  "ዢ",
+  "ዣ",
+  "ዤ",
+  "ዥ",
+  "ዦ",
+  "ዧ",
+  "ዩ",
+  "ዪ",
+  "ያ",
+  "ዬ",
+  "ይ",
+  "ዮ",
+  "ዱ",
+  "ዲ",
+  "ዳ",
+  "ዴ",
+  "ድ",
+  "ዶ",
+  "ዷ",
+  "ጁ",
+  "ጂ",
+  "ጃ",
+  "ጄ",
+  "ጅ",
+  "ጆ",
+  "ጇ",
+  "ጉ",
+  "ጊ",
+  "ጋ",
+  "ጌ",
+  "ግ",
+  "ጎ",
+  "ጒ",
+  "ጓ",
+  "ጔ",
+  "ጕ",
+  "ጡ",
+  "ጢ",
+  "ጣ",
+  "ጤ",
+  "ጥ",
+  "ጦ",
+  "ጧ",
+  "ጩ",
+  "ጪ",
+  "ጫ",
+  "ጬ",
+  "ጭ",
+  "ጮ",
+  "ጯ",
+  "ጱ",
+  "ጲ",
+  "ጳ",
+  "ጴ",
+  "ጵ",
+  "ጶ",
+  "ጷ",
+  "ጹ",
+  "ጺ",
+  "ጻ",
+  "ጼ",
+  "ጽ",
+  "ጾ",
+  "ጿ",
+  "ፁ",
+  "ፂ",
+  "ፃ",
+  "ፄ",
+  "ፅ",
+  "ፆ",
+  "ፇ",
+  "ፉ",
+  "ፊ",
+  "ፋ",
+  "ፌ",
+  "ፍ",
+  "ፎ",
+  "ፏ",
+  "ፑ",
+  "ፒ",
+  "ፓ",
+  "ፔ",
+  "ፕ",
+  "ፖ",
+  "ፗ",
+};
+const char *ALPHA_293_LOWER[] = {
+  "ሀ",
+  "ለ",
+  "ሐ",
+  "መ",
+  "ሠ",
+  "ረ",
+  "ሰ",
+  "ሸ",
+  "ቀ",
+  "ቈ",
+  "ቐ",
+  "ቘ",
+  "በ",
+  "ቨ",
+  "ተ",
+  "ቸ",
+  "ኀ",
+  "ኈ",
+  "ነ",
+  "ኘ",
+  "አ",
+  "ከ",
+  "ኰ",
+  "ኸ",
+  "ዀ",
+  "ወ",
+  "ዐ",
+  "ዘ",
+  "ዠ",
+  "የ",
+  "ደ",
+  "ጀ",
+  "ገ",
+  "ጐ",
+  "ጠ",
+  "ጨ",
+  "ጰ",
+  "ጸ",
+  "ፀ",
+  "ፈ",
+  "ፐ",
+  "ሁ",
+  "ሂ",
+  "ሃ",
+  "ሄ",
+  "ህ",
+  "ሆ",
+  "ሉ",
+  "ሊ",
+  "ላ",
+  "ሌ",
+  "ል",
+  "ሎ",
+  "ሏ",
+  "ሑ",
+  "ሒ",
+  "ሓ",
+  "ሔ",
+  "ሕ",
+  "ሖ",
+  "ሗ",
+  "ሙ",
+  "ሚ",
+  "ማ",
+  "ሜ",
+  "ም",
+  "ሞ",
+  "ሟ",
+  "ሡ",
+  "ሢ",
+  "ሣ",
+  "ሤ",
+  "ሥ",
+  "ሦ",
+  "ሧ",
+  "ሩ",
+  "ሪ",
+  "ራ",
+  "ሬ",
+  "ር",
+  "ሮ",
+  "ሯ",
+  "ሱ",
+  "ሲ",
+  "ሳ",
+  "ሴ",
+  "ስ",
+  "ሶ",
+  "ሷ",
+  "ሹ",
+  "ሺ",
+  "ሻ",
+  "ሼ",
+  "ሽ",
+  "ሾ",
+  "ሿ",
+  "ቁ",
+  "ቂ",
+  "ቃ",
+  "ቄ",
+  "ቅ",
+  "ቆ",
+  "ቊ",
+  "ቋ",
+  "ቌ",
+  "ቍ",
+  "ቑ",
+  "ቒ",
+  "ቓ",
+  "ቔ",
+  "ቕ",
+  "ቖ",
+  "ቚ",
+  "ቛ",
+  "ቜ",
+  "ቝ",
+  "ቡ",
+  "ቢ",
+  "ባ",
+  "ቤ",
+  "ብ",
+  "ቦ",
+  "ቧ",
+  "ቩ",
+  "ቪ",
+  "ቫ",
+  "ቬ",
+  "ቭ",
+  "ቮ",
+  "ቯ",
+  "ቱ",
+  "ቲ",
+  "ታ",
+  "ቴ",
+  "ት",
+  "ቶ",
+  "ቷ",
+  "ቹ",
+  "ቺ",
+  "ቻ",
+  "ቼ",
+  "ች",
+  "ቾ",
+  "ቿ",
+  "ኁ",
+  "ኂ",
+  "ኃ",
+  "ኄ",
+  "ኅ",
+  "ኆ",
+  "ኊ",
+  "ኋ",
+  "ኌ",
+  "ኍ",
+  "ኑ",
+  "ኒ",
+  "ና",
+  "ኔ",
+  "ን",
+  "ኖ",
+  "ኗ",
+  "ኙ",
+  "ኚ",
+  "ኛ",
+  "ኜ",
+  "ኝ",
+  "ኞ",
+  "ኟ",
+  "ኡ",
+  "ኢ",
+  "ኣ",
+  "ኤ",
+  "እ",
+  "ኦ",
+  "ኧ",
+  "ኩ",
+  "ኪ",
+  "ካ",
+  "ኬ",
+  "ክ",
+  "ኮ",
+  "ኲ",
+  "ኳ",
+  "ኴ",
+  "ኵ",
+  "ኹ",
+  "ኺ",
+  "ኻ",
+  "ኼ",
+  "ኽ",
+  "ኾ",
+  "ዂ",
+  "ዃ",
+  "ዄ",
+  "ዅ",
+  "ዉ",
+  "ዊ",
+  "ዋ",
+  "ዌ",
+  "ው",
+  "ዎ",
+  "ዑ",
+  "ዒ",
+  "ዓ",
+  "ዔ",
+  "ዕ",
+  "ዖ",
+  "ዙ",
+  "ዚ",
+  "ዛ",
+  "ዜ",
+  "ዝ",
+  "ዞ",
+  "ዟ",
+  "ዡ",
+  "ዢ",
+  "ዣ",
+  "ዤ",
+  "ዥ",
+  "ዦ",
+  "ዧ",
+  "ዩ",
+  "ዪ",
+  "ያ",
+  "ዬ",
+  "ይ",
+  "ዮ",
+  "ዱ",
+  "ዲ",
+  "ዳ",
+  "ዴ",
+  "ድ",
+  "ዶ",
+  "ዷ",
+  "ጁ",
+  "ጂ",
+  "ጃ",
+  "ጄ",
+  "ጅ",
+  "ጆ",
+  "ጇ",
+  "ጉ",
+  "ጊ",
+  "ጋ",
+  "ጌ",
+  "ግ",
+  "ጎ",
+  "ጒ",
+  "ጓ",
+  "ጔ",
+  "ጕ",
+  "ጡ",
+  "ጢ",
+  "ጣ",
+  "ጤ",
+  "ጥ",
+  "ጦ",
+  "ጧ",
+  "ጩ",
+  "ጪ",
+  "ጫ",
+  "ጬ",
+  "ጭ",
+  "ጮ",
+  "ጯ",
+  "ጱ",
+  "ጲ",
+  "ጳ",
+  "ጴ",
+  "ጵ",
+  "ጶ",
+  "ጷ",
+  "ጹ",
+  "ጺ",
+  "ጻ",
+  "ጼ",
+  "ጽ",
+  "ጾ",
+  "ጿ",
+  "ፁ",
+  "ፂ",
+  "ፃ",
+  "ፄ",
+  "ፅ",
+  "ፆ",
+  "ፇ",
+  "ፉ",
+  "ፊ",
+  "ፋ",
+  "ፌ",
+  "ፍ",
+  "ፎ",
+  "ፏ",
+  "ፑ",
+  "ፒ",
+  "ፓ",
+  "ፔ",
+  "ፕ",
+  "ፖ",
+  "ፗ",
+};
+const char *ALPHA_293_DIGITS[] = {
+};
+const uint32_t ALPHA_293_UPPER_CPS[] = {
+  4608, 4609, 4610, 4611, 4612, 4613, 4614, 4616, 4617, 4618, 4619, 4620, 4621, 4622, 4623, 4624,
+  4625, 4626, 4627, 4628, 4629, 4630, 4631, 4632, 4633, 4634, 4635, 4636, 4637, 4638, 4639, 4640,
+  4641, 4642, 4643, 4644, 4645, 4646, 4647, 4648, 4649, 4650, 4651, 4652, 4653, 4654, 4655, 4656,
+  4657, 4658, 4659, 4660, 4661, 4662, 4663, 4664, 4665, 4666, 4667, 4668, 4669, 4670, 4671, 4672,
+  4673, 4674, 4675, 4676, 4677, 4678, 4680, 4682, 4683, 4684, 4685, 4688, 4689, 4690, 4691, 4692,
+  4693, 4694, 4696, 4698, 4699, 4700, 4701, 4704, 4705, 4706, 4707, 4708, 4709, 4710, 4711, 4712,
+  4713, 4714, 4715, 4716, 4717, 4718, 4719, 4720, 4721, 4722, 4723, 4724, 4725, 4726, 4727, 4728,
+  4729, 4730, 4731, 4732, 4733, 4734, 4735, 4736, 4737, 4738, 4739, 4740, 4741, 4742, 4744, 4746,
+  4747, 4748, 4749, 4752, 4753, 4754, 4755, 4756, 4757, 4758, 4759, 4760, 4761, 4762, 4763, 4764,
+  4765, 4766, 4767, 4768, 4769, 4770, 4771, 4772, 4773, 4774, 4775, 4776, 4777, 4778, 4779, 4780,
+  4781, 4782, 4784, 4786, 4787, 4788, 4789, 4792, 4793, 4794, 4795, 4796, 4797, 4798, 4800, 4802,
+  4803, 4804, 4805, 4808, 4809, 4810, 4811, 4812, 4813, 4814, 4816, 4817, 4818, 4819, 4820, 4821,
+  4822, 4824, 4825, 4826, 4827, 4828, 4829, 4830, 4831, 4832, 4833, 4834, 4835, 4836, 4837, 4838,
+  4839, 4840, 4841, 4842, 4843, 4844, 4845, 4846, 4848, 4849, 4850, 4851, 4852, 4853, 4854, 4855,
+  4864, 4865, 4866, 4867, 4868, 4869, 4870, 4871, 4872, 4873, 4874, 4875, 4876, 4877, 4878, 4880,
+  4882, 4883, 4884, 4885, 4896, 4897, 4898, 4899, 4900, 4901, 4902, 4903, 4904, 4905, 4906, 4907,
+  4908, 4909, 4910, 4911, 4912, 4913, 4914, 4915, 4916, 4917, 4918, 4919, 4920, 4921, 4922, 4923,
+  4924, 4925, 4926, 4927, 4928, 4929, 4930, 4931, 4932, 4933, 4934, 4935, 4936, 4937, 4938, 4939,
+  4940, 4941, 4942, 4943, 4944, 4945, 4946, 4947, 4948, 4949, 4950, 4951,
+};
+const uint32_t ALPHA_293_LOWER_CPS[] = {
+  4608, 4609, 4610, 4611, 4612, 4613, 4614, 4616, 4617, 4618, 4619, 4620, 4621, 4622, 4623, 4624,
+  4625, 4626, 4627, 4628, 4629, 4630, 4631, 4632, 4633, 4634, 4635, 4636, 4637, 4638, 4639, 4640,
+  4641, 4642, 4643, 4644, 4645, 4646, 4647, 4648, 4649, 4650, 4651, 4652, 4653, 4654, 4655, 4656,
+  4657, 4658, 4659, 4660, 4661, 4662, 4663, 4664, 4665, 4666, 4667, 4668, 4669, 4670, 4671, 4672,
+  4673, 4674, 4675, 4676, 4677, 4678, 4680, 4682, 4683, 4684, 4685, 4688, 4689, 4690, 4691, 4692,
+  4693, 4694, 4696, 4698, 4699, 4700, 4701, 4704, 4705, 4706, 4707, 4708, 4709, 4710, 4711, 4712,
+  4713, 4714, 4715, 4716, 4717, 4718, 4719, 4720, 4721, 4722, 4723, 4724, 4725, 4726, 4727, 4728,
+  4729, 4730, 4731, 4732, 4733, 4734, 4735, 4736, 4737, 4738, 4739, 4740, 4741, 4742, 4744, 4746,
+  4747, 4748, 4749, 4752, 4753, 4754, 4755, 4756, 4757, 4758, 4759, 4760, 4761, 4762, 4763, 4764,
+  4765, 4766, 4767, 4768, 4769, 4770, 4771, 4772, 4773, 4774, 4775, 4776, 4777, 4778, 4779, 4780,
+  4781, 4782, 4784, 4786, 4787, 4788, 4789, 4792, 4793, 4794, 4795, 4796, 4797, 4798, 4800, 4802,
+  4803, 4804, 4805, 4808, 4809, 4810, 4811, 4812, 4813, 4814, 4816, 4817, 4818, 4819, 4820, 4821,
+  4822, 4824, 4825, 4826, 4827, 4828, 4829, 4830, 4831, 4832, 4833, 4834, 4835, 4836, 4837, 4838,
+  4839, 4840, 4841, 4842, 4843, 4844, 4845, 4846, 4848, 4849, 4850, 4851, 4852, 4853, 4854, 4855,
+  4864, 4865, 4866, 4867, 4868, 4869, 4870, 4871, 4872, 4873, 4874, 4875, 4876, 4877, 4878, 4880,
+  4882, 4883, 4884, 4885, 4896, 4897, 4898, 4899, 4900, 4901, 4902, 4903, 4904, 4905, 4906, 4907,
+  4908, 4909, 4910, 4911, 4912, 4913, 4914, 4915, 4916, 4917, 4918, 4919, 4920, 4921, 4922, 4923,
+  4924, 4925, 4926, 4927, 4928, 4929, 4930, 4931, 4932, 4933, 4934, 4935, 4936, 4937, 4938, 4939,
+  4940, 4941, 4942, 4943, 4944, 4945, 4946, 4947, 4948, 4949, 4950, 4951,
+};
+const uint32_t ALPHA_293_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_293_FREQ[] = {
+  { "ሀ", 0.00020000 },
+  { "ለ", 0.01310000 },
+  { "ሐ", 0.00110000 },
+  { "መ", 0.02100000 },
+  { "ሠ", 0.00000000 },
+  { "ረ", 0.01020000 },
+  { "ሰ", 0.00800000 },
+  { "ሸ", 0.00090000 },
+  { "ቀ", 0.00630000 },
+  { "ቈ", 0.00060000 },
+  { "ቐ", 0.00100000 },
+  { "ቘ", 0.00070000 },
+  { "በ", 0.01150000 },
+  { "ቨ", 0.00020000 },
+  { "ተ", 0.02010000 },
+  { "ቸ", 0.00000000 },
+  { "ኀ", 0.00000000 },
+  { "ኈ", 0.00000000 },
+  { "ነ", 0.01330000 },
+  { "ኘ", 0.00000000 },
+  { "አ", 0.00310000 },
+  { "ከ", 0.00880000 },
+  { "ኰ", 0.00150000 },
+  { "ኸ", 0.00310000 },
+  { "ዀ", 0.00110000 },
+  { "ወ", 0.00880000 },
+  { "ዐ", 0.00050000 },
+  { "ዘ", 0.00690000 },
+  { "ዠ", 0.00000000 },
+  { "የ", 0.00330000 },
+  { "ደ", 0.01190000 },
+  { "ጀ", 0.00150000 },
+  { "ገ", 0.00860000 },
+  { "ጐ", 0.00060000 },
+  { "ጠ", 0.00210000 },
+  { "ጨ", 0.00050000 },
+  { "ጰ", 0.00000000 },
+  { "ጸ", 0.00260000 },
+  { "ፀ", 0.00000000 },
+  { "ፈ", 0.00320000 },
+  { "ፐ", 0.00030000 },
+  { "ሁ", 0.00060000 },
+  { "ሂ", 0.00090000 },
+  { "ሃ", 0.00730000 },
+  { "ሄ", 0.00010000 },
+  { "ህ", 0.00580000 },
+  { "ሆ", 0.00040000 },
+  { "ሉ", 0.00680000 },
+  { "ሊ", 0.00500000 },
+  { "ላ", 0.00690000 },
+  { "ሌ", 0.00020000 },
+  { "ል", 0.02260000 },
+  { "ሎ", 0.00410000 },
+  { "ሏ", 0.00000000 },
+  { "ሑ", 0.00210000 },
+  { "ሒ", 0.00150000 },
+  { "ሓ", 0.01770000 },
+  { "ሔ", 0.00000000 },
+  { "ሕ", 0.01140000 },
+  { "ሖ", 0.00060000 },
+  { "ሗ", 0.00000000 },
+  { "ሙ", 0.00230000 },
+  { "ሚ", 0.00140000 },
+  { "ማ", 0.00850000 },
+  { "ሜ", 0.00080000 },
+  { "ም", 0.03390000 },
+  { "ሞ", 0.00220000 },
+  { "ሟ", 0.00010000 },
+  { "ሡ", 0.00010000 },
+  { "ሢ", 0.00000000 },
+  { "ሣ", 0.00000000 },
+  { "ሤ", 0.00000000 },
+  { "ሥ", 0.00000000 },
+  { "ሦ", 0.00000000 },
+  { "ሧ", 0.00000000 },
+  { "ሩ", 0.00250000 },
+  { "ሪ", 0.00790000 },
+  { "ራ", 0.01040000 },
+  { "ሬ", 0.00050000 },
+  { "ር", 0.02940000 },
+  { "ሮ", 0.00340000 },
+  { "ሯ", 0.00000000 },
+  { "ሱ", 0.00100000 },
+  { "ሲ", 0.00180000 },
+  { "ሳ", 0.00690000 },
+  { "ሴ", 0.00010000 },
+  { "ስ", 0.02290000 },
+  { "ሶ", 0.00100000 },
+  { "ሷ", 0.00000000 },
+  { "ሹ", 0.00020000 },
+  { "ሺ", 0.00030000 },
+  { "ሻ", 0.00050000 },
+  { "ሼ", 0.00000000 },
+  { "ሽ", 0.00620000 },
+  { "ሾ", 0.00020000 },
+  { "ሿ", 0.00000000 },
+  { "ቁ", 0.00320000 },
+  { "ቂ", 0.00050000 },
+  { "ቃ", 0.00160000 },
+  { "ቄ", 0.00000000 },
+  { "ቅ", 0.00340000 },
+  { "ቆ", 0.00020000 },
+  { "ቊ", 0.00000000 },
+  { "ቋ", 0.01300000 },
+  { "ቌ", 0.00000000 },
+  { "ቍ", 0.00020000 },
+  { "ቑ", 0.00090000 },
+  { "ቒ", 0.00020000 },
+  { "ቓ", 0.00070000 },
+  { "ቔ", 0.00000000 },
+  { "ቕ", 0.00230000 },
+  { "ቖ", 0.00040000 },
+  { "ቚ", 0.00000000 },
+  { "ቛ", 0.00100000 },
+  { "ቜ", 0.00000000 },
+  { "ቝ", 0.00000000 },
+  { "ቡ", 0.00290000 },
+  { "ቢ", 0.00440000 },
+  { "ባ", 0.01160000 },
+  { "ቤ", 0.00140000 },
+  { "ብ", 0.03800000 },
+  { "ቦ", 0.00240000 },
+  { "ቧ", 0.00000000 },
+  { "ቩ", 0.00010000 },
+  { "ቪ", 0.00050000 },
+  { "ቫ", 0.00000000 },
+  { "ቬ", 0.00000000 },
+  { "ቭ", 0.00000000 },
+  { "ቮ", 0.00020000 },
+  { "ቯ", 0.00000000 },
+  { "ቱ", 0.00190000 },
+  { "ቲ", 0.01560000 },
+  { "ታ", 0.01390000 },
+  { "ቴ", 0.00020000 },
+  { "ት", 0.04080000 },
+  { "ቶ", 0.00420000 },
+  { "ቷ", 0.00000000 },
+  { "ቹ", 0.00010000 },
+  { "ቺ", 0.00030000 },
+  { "ቻ", 0.00020000 },
+  { "ቼ", 0.00010000 },
+  { "ች", 0.00000000 },
+  { "ቾ", 0.00010000 },
+  { "ቿ", 0.00000000 },
+  { "ኁ", 0.00000000 },
+  { "ኂ", 0.00000000 },
+  { "ኃ", 0.00000000 },
+  { "ኄ", 0.00000000 },
+  { "ኅ", 0.00010000 },
+  { "ኆ", 0.00000000 },
+  { "ኊ", 0.00000000 },
+  { "ኋ", 0.00000000 },
+  { "ኌ", 0.00000000 },
+  { "ኍ", 0.00000000 },
+  { "ኑ", 0.00270000 },
+  { "ኒ", 0.00190000 },
+  { "ና", 0.01490000 },
+  { "ኔ", 0.00030000 },
+  { "ን", 0.06320000 },
+  { "ኖ", 0.00100000 },
+  { "ኗ", 0.00000000 },
+  { "ኙ", 0.00000000 },
+  { "ኚ", 0.00000000 },
+  { "ኛ", 0.00140000 },
+  { "ኜ", 0.00000000 },
+  { "ኝ", 0.00000000 },
+  { "ኞ", 0.00000000 },
+  { "ኟ", 0.00000000 },
+  { "ኡ", 0.00260000 },
+  { "ኢ", 0.00570000 },
+  { "ኣ", 0.03490000 },
+  { "ኤ", 0.00190000 },
+  { "እ", 0.02750000 },
+  { "ኦ", 0.00230000 },
+  { "ኧ", 0.00000000 },
+  { "ኩ", 0.00080000 },
+  { "ኪ", 0.00510000 },
+  { "ካ", 0.00880000 },
+  { "ኬ", 0.00050000 },
+  { "ክ", 0.01410000 },
+  { "ኮ", 0.00170000 },
+  { "ኲ", 0.00000000 },
+  { "ኳ", 0.00000000 },
+  { "ኴ", 0.00000000 },
+  { "ኵ", 0.00110000 },
+  { "ኹ", 0.00010000 },
+  { "ኺ", 0.00020000 },
+  { "ኻ", 0.00220000 },
+  { "ኼ", 0.00040000 },
+  { "ኽ", 0.00330000 },
+  { "ኾ", 0.00040000 },
+  { "ዂ", 0.00000000 },
+  { "ዃ", 0.00050000 },
+  { "ዄ", 0.00000000 },
+  { "ዅ", 0.00050000 },
+  { "ዉ", 0.00140000 },
+  { "ዊ", 0.00480000 },
+  { "ዋ", 0.00510000 },
+  { "ዌ", 0.00050000 },
+  { "ው", 0.00970000 },
+  { "ዎ", 0.00270000 },
+  { "ዑ", 0.00220000 },
+  { "ዒ", 0.00040000 },
+  { "ዓ", 0.01140000 },
+  { "ዔ", 0.00000000 },
+  { "ዕ", 0.01170000 },
+  { "ዖ", 0.00020000 },
+  { "ዙ", 0.00120000 },
+  { "ዚ", 0.01150000 },
+  { "ዛ", 0.00320000 },
+  { "ዜ", 0.00150000 },
+  { "ዝ", 0.01560000 },
+  { "ዞ", 0.00070000 },
+  { "ዟ", 0.00000000 },
+  { "ዡ", 0.00000000 },
+  { "ዢ", 0.00010000 },
+  { "ዣ", 0.00000000 },
+  { "ዤ", 0.00000000 },
+  { "ዥ", 0.00010000 },
+  { "ዦ", 0.00000000 },
+  { "ዧ", 0.00000000 },
+  { "ዩ", 0.00990000 },
+  { "ዪ", 0.00030000 },
+  { "ያ", 0.00950000 },
+  { "ዬ", 0.00000000 },
+  { "ይ", 0.03060000 },
+  { "ዮ", 0.00330000 },
+  { "ዱ", 0.00230000 },
+  { "ዲ", 0.00370000 },
+  { "ዳ", 0.00620000 },
+  { "ዴ", 0.00010000 },
+  { "ድ", 0.00960000 },
+  { "ዶ", 0.00190000 },
+  { "ዷ", 0.00000000 },
+  { "ጁ", 0.00000000 },
+  { "ጂ", 0.00090000 },
+  { "ጃ", 0.00050000 },
+  { "ጄ", 0.00000000 },
+  { "ጅ", 0.00050000 },
+  { "ጆ", 0.00000000 },
+  { "ጇ", 0.00000000 },
+  { "ጉ", 0.00110000 },
+  { "ጊ", 0.00050000 },
+  { "ጋ", 0.00180000 },
+  { "ጌ", 0.00080000 },
+  { "ግ", 0.01250000 },
+  { "ጎ", 0.00120000 },
+  { "ጒ", 0.00010000 },
+  { "ጓ", 0.00050000 },
+  { "ጔ", 0.00000000 },
+  { "ጕ", 0.00070000 },
+  { "ጡ", 0.00050000 },
+  { "ጢ", 0.00080000 },
+  { "ጣ", 0.00090000 },
+  { "ጤ", 0.00000000 },
+  { "ጥ", 0.00280000 },
+  { "ጦ", 0.00000000 },
+  { "ጧ", 0.00000000 },
+  { "ጩ", 0.00000000 },
+  { "ጪ", 0.00010000 },
+  { "ጫ", 0.00020000 },
+  { "ጬ", 0.00000000 },
+  { "ጭ", 0.00060000 },
+  { "ጮ", 0.00000000 },
+  { "ጯ", 0.00000000 },
+  { "ጱ", 0.00000000 },
+  { "ጲ", 0.00000000 },
+  { "ጳ", 0.00070000 },
+  { "ጴ", 0.00000000 },
+  { "ጵ", 0.00030000 },
+  { "ጶ", 0.00000000 },
+  { "ጷ", 0.00000000 },
+  { "ጹ", 0.00050000 },
+  { "ጺ", 0.00080000 },
+  { "ጻ", 0.00170000 },
+  { "ጼ", 0.00000000 },
+  { "ጽ", 0.01060000 },
+  { "ጾ", 0.00040000 },
+  { "ጿ", 0.00000000 },
+  { "ፁ", 0.00000000 },
+  { "ፂ", 0.00000000 },
+  { "ፃ", 0.00010000 },
+  { "ፄ", 0.00000000 },
+  { "ፅ", 0.00040000 },
+  { "ፆ", 0.00000000 },
+  { "ፇ", 0.00000000 },
+  { "ፉ", 0.00040000 },
+  { "ፊ", 0.00210000 },
+  { "ፋ", 0.00180000 },
+  { "ፌ", 0.00000000 },
+  { "ፍ", 0.00880000 },
+  { "ፎ", 0.00020000 },
+  { "ፏ", 0.00000000 },
+  { "ፑ", 0.00010000 },
+  { "ፒ", 0.00050000 },
+  { "ፓ", 0.00050000 },
+  { "ፔ", 0.00010000 },
+  { "ፕ", 0.00040000 },
+  { "ፖ", 0.00020000 },
+  { "ፗ", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_293_FREQ_CPS[] = {
+  { 0x1200u, 0.00020000 },
+  { 0x1201u, 0.00060000 },
+  { 0x1202u, 0.00090000 },
+  { 0x1203u, 0.00730000 },
+  { 0x1204u, 0.00010000 },
+  { 0x1205u, 0.00580000 },
+  { 0x1206u, 0.00040000 },
+  { 0x1208u, 0.01310000 },
+  { 0x1209u, 0.00680000 },
+  { 0x120Au, 0.00500000 },
+  { 0x120Bu, 0.00690000 },
+  { 0x120Cu, 0.00020000 },
+  { 0x120Du, 0.02260000 },
+  { 0x120Eu, 0.00410000 },
+  { 0x120Fu, 0.00000000 },
+  { 0x1210u, 0.00110000 },
+  { 0x1211u, 0.00210000 },
+  { 0x1212u, 0.00150000 },
+  { 0x1213u, 0.01770000 },
+  { 0x1214u, 0.00000000 },
+  { 0x1215u, 0.01140000 },
+  { 0x1216u, 0.00060000 },
+  { 0x1217u, 0.00000000 },
+  { 0x1218u, 0.02100000 },
+  { 0x1219u, 0.00230000 },
+  { 0x121Au, 0.00140000 },
+  { 0x121Bu, 0.00850000 },
+  { 0x121Cu, 0.00080000 },
+  { 0x121Du, 0.03390000 },
+  { 0x121Eu, 0.00220000 },
+  { 0x121Fu, 0.00010000 },
+  { 0x1220u, 0.00000000 },
+  { 0x1221u, 0.00010000 },
+  { 0x1222u, 0.00000000 },
+  { 0x1223u, 0.00000000 },
+  { 0x1224u, 0.00000000 },
+  { 0x1225u, 0.00000000 },
+  { 0x1226u, 0.00000000 },
+  { 0x1227u, 0.00000000 },
+  { 0x1228u, 0.01020000 },
+  { 0x1229u, 0.00250000 },
+  { 0x122Au, 0.00790000 },
+  { 0x122Bu, 0.01040000 },
+  { 0x122Cu, 0.00050000 },
+  { 0x122Du, 0.02940000 },
+  { 0x122Eu, 0.00340000 },
+  { 0x122Fu, 0.00000000 },
+  { 0x1230u, 0.00800000 },
+  { 0x1231u, 0.00100000 },
+  { 0x1232u, 0.00180000 },
+  { 0x1233u, 0.00690000 },
+  { 0x1234u, 0.00010000 },
+  { 0x1235u, 0.02290000 },
+  { 0x1236u, 0.00100000 },
+  { 0x1237u, 0.00000000 },
+  { 0x1238u, 0.00090000 },
+  { 0x1239u, 0.00020000 },
+  { 0x123Au, 0.00030000 },
+  { 0x123Bu, 0.00050000 },
+  { 0x123Cu, 0.00000000 },
+  { 0x123Du, 0.00620000 },
+  { 0x123Eu, 0.00020000 },
+  { 0x123Fu, 0.00000000 },
+  { 0x1240u, 0.00630000 },
+  { 0x1241u, 0.00320000 },
+  { 0x1242u, 0.00050000 },
+  { 0x1243u, 0.00160000 },
+  { 0x1244u, 0.00000000 },
+  { 0x1245u, 0.00340000 },
+  { 0x1246u, 0.00020000 },
+  { 0x1248u, 0.00060000 },
+  { 0x124Au, 0.00000000 },
+  { 0x124Bu, 0.01300000 },
+  { 0x124Cu, 0.00000000 },
+  { 0x124Du, 0.00020000 },
+  { 0x1250u, 0.00100000 },
+  { 0x1251u, 0.00090000 },
+  { 0x1252u, 0.00020000 },
+  { 0x1253u, 0.00070000 },
+  { 0x1254u, 0.00000000 },
+  { 0x1255u, 0.00230000 },
+  { 0x1256u, 0.00040000 },
+  { 0x1258u, 0.00070000 },
+  { 0x125Au, 0.00000000 },
+  { 0x125Bu, 0.00100000 },
+  { 0x125Cu, 0.00000000 },
+  { 0x125Du, 0.00000000 },
+  { 0x1260u, 0.01150000 },
+  { 0x1261u, 0.00290000 },
+  { 0x1262u, 0.00440000 },
+  { 0x1263u, 0.01160000 },
+  { 0x1264u, 0.00140000 },
+  { 0x1265u, 0.03800000 },
+  { 0x1266u, 0.00240000 },
+  { 0x1267u, 0.00000000 },
+  { 0x1268u, 0.00020000 },
+  { 0x1269u, 0.00010000 },
+  { 0x126Au, 0.00050000 },
+  { 0x126Bu, 0.00000000 },
+  { 0x126Cu, 0.00000000 },
+  { 0x126Du, 0.00000000 },
+  { 0x126Eu, 0.00020000 },
+  { 0x126Fu, 0.00000000 },
+  { 0x1270u, 0.02010000 },
+  { 0x1271u, 0.00190000 },
+  { 0x1272u, 0.01560000 },
+  { 0x1273u, 0.01390000 },
+  { 0x1274u, 0.00020000 },
+  { 0x1275u, 0.04080000 },
+  { 0x1276u, 0.00420000 },
+  { 0x1277u, 0.00000000 },
+  { 0x1278u, 0.00000000 },
+  { 0x1279u, 0.00010000 },
+  { 0x127Au, 0.00030000 },
+  { 0x127Bu, 0.00020000 },
+  { 0x127Cu, 0.00010000 },
+  { 0x127Du, 0.00000000 },
+  { 0x127Eu, 0.00010000 },
+  { 0x127Fu, 0.00000000 },
+  { 0x1280u, 0.00000000 },
+  { 0x1281u, 0.00000000 },
+  { 0x1282u, 0.00000000 },
+  { 0x1283u, 0.00000000 },
+  { 0x1284u, 0.00000000 },
+  { 0x1285u, 0.00010000 },
+  { 0x1286u, 0.00000000 },
+  { 0x1288u, 0.00000000 },
+  { 0x128Au, 0.00000000 },
+  { 0x128Bu, 0.00000000 },
+  { 0x128Cu, 0.00000000 },
+  { 0x128Du, 0.00000000 },
+  { 0x1290u, 0.01330000 },
+  { 0x1291u, 0.00270000 },
+  { 0x1292u, 0.00190000 },
+  { 0x1293u, 0.01490000 },
+  { 0x1294u, 0.00030000 },
+  { 0x1295u, 0.06320000 },
+  { 0x1296u, 0.00100000 },
+  { 0x1297u, 0.00000000 },
+  { 0x1298u, 0.00000000 },
+  { 0x1299u, 0.00000000 },
+  { 0x129Au, 0.00000000 },
+  { 0x129Bu, 0.00140000 },
+  { 0x129Cu, 0.00000000 },
+  { 0x129Du, 0.00000000 },
+  { 0x129Eu, 0.00000000 },
+  { 0x129Fu, 0.00000000 },
+  { 0x12A0u, 0.00310000 },
+  { 0x12A1u, 0.00260000 },
+  { 0x12A2u, 0.00570000 },
+  { 0x12A3u, 0.03490000 },
+  { 0x12A4u, 0.00190000 },
+  { 0x12A5u, 0.02750000 },
+  { 0x12A6u, 0.00230000 },
+  { 0x12A7u, 0.00000000 },
+  { 0x12A8u, 0.00880000 },
+  { 0x12A9u, 0.00080000 },
+  { 0x12AAu, 0.00510000 },
+  { 0x12ABu, 0.00880000 },
+  { 0x12ACu, 0.00050000 },
+  { 0x12ADu, 0.01410000 },
+  { 0x12AEu, 0.00170000 },
+  { 0x12B0u, 0.00150000 },
+  { 0x12B2u, 0.00000000 },
+  { 0x12B3u, 0.00000000 },
+  { 0x12B4u, 0.00000000 },
+  { 0x12B5u, 0.00110000 },
+  { 0x12B8u, 0.00310000 },
+  { 0x12B9u, 0.00010000 },
+  { 0x12BAu, 0.00020000 },
+  { 0x12BBu, 0.00220000 },
+  { 0x12BCu, 0.00040000 },
+  { 0x12BDu, 0.00330000 },
+  { 0x12BEu, 0.00040000 },
+  { 0x12C0u, 0.00110000 },
+  { 0x12C2u, 0.00000000 },
+  { 0x12C3u, 0.00050000 },
+  { 0x12C4u, 0.00000000 },
+  { 0x12C5u, 0.00050000 },
+  { 0x12C8u, 0.00880000 },
+  { 0x12C9u, 0.00140000 },
+  { 0x12CAu, 0.00480000 },
+  { 0x12CBu, 0.00510000 },
+  { 0x12CCu, 0.00050000 },
+  { 0x12CDu, 0.00970000 },
+  { 0x12CEu, 0.00270000 },
+  { 0x12D0u, 0.00050000 },
+  { 0x12D1u, 0.00220000 },
+  { 0x12D2u, 0.00040000 },
+  { 0x12D3u, 0.01140000 },
+  { 0x12D4u, 0.00000000 },
+  { 0x12D5u, 0.01170000 },
+  { 0x12D6u, 0.00020000 },
+  { 0x12D8u, 0.00690000 },
+  { 0x12D9u, 0.00120000 },
+  { 0x12DAu, 0.01150000 },
+  { 0x12DBu, 0.00320000 },
+  { 0x12DCu, 0.00150000 },
+  { 0x12DDu, 0.01560000 },
+  { 0x12DEu, 0.00070000 },
+  { 0x12DFu, 0.00000000 },
+  { 0x12E0u, 0.00000000 },
+  { 0x12E1u, 0.00000000 },
+  { 0x12E2u, 0.00010000 },
+  { 0x12E3u, 0.00000000 },
+  { 0x12E4u, 0.00000000 },
+  { 0x12E5u, 0.00010000 },
+  { 0x12E6u, 0.00000000 },
+  { 0x12E7u, 0.00000000 },
+  { 0x12E8u, 0.00330000 },
+  { 0x12E9u, 0.00990000 },
+  { 0x12EAu, 0.00030000 },
+  { 0x12EBu, 0.00950000 },
+  { 0x12ECu, 0.00000000 },
+  { 0x12EDu, 0.03060000 },
+  { 0x12EEu, 0.00330000 },
+  { 0x12F0u, 0.01190000 },
+  { 0x12F1u, 0.00230000 },
+  { 0x12F2u, 0.00370000 },
+  { 0x12F3u, 0.00620000 },
+  { 0x12F4u, 0.00010000 },
+  { 0x12F5u, 0.00960000 },
+  { 0x12F6u, 0.00190000 },
+  { 0x12F7u, 0.00000000 },
+  { 0x1300u, 0.00150000 },
+  { 0x1301u, 0.00000000 },
+  { 0x1302u, 0.00090000 },
+  { 0x1303u, 0.00050000 },
+  { 0x1304u, 0.00000000 },
+  { 0x1305u, 0.00050000 },
+  { 0x1306u, 0.00000000 },
+  { 0x1307u, 0.00000000 },
+  { 0x1308u, 0.00860000 },
+  { 0x1309u, 0.00110000 },
+  { 0x130Au, 0.00050000 },
+  { 0x130Bu, 0.00180000 },
+  { 0x130Cu, 0.00080000 },
+  { 0x130Du, 0.01250000 },
+  { 0x130Eu, 0.00120000 },
+  { 0x1310u, 0.00060000 },
+  { 0x1312u, 0.00010000 },
+  { 0x1313u, 0.00050000 },
+  { 0x1314u, 0.00000000 },
+  { 0x1315u, 0.00070000 },
+  { 0x1320u, 0.00210000 },
+  { 0x1321u, 0.00050000 },
+  { 0x1322u, 0.00080000 },
+  { 0x1323u, 0.00090000 },
+  { 0x1324u, 0.00000000 },
+  { 0x1325u, 0.00280000 },
+  { 0x1326u, 0.00000000 },
+  { 0x1327u, 0.00000000 },
+  { 0x1328u, 0.00050000 },
+  { 0x1329u, 0.00000000 },
+  { 0x132Au, 0.00010000 },
+  { 0x132Bu, 0.00020000 },
+  { 0x132Cu, 0.00000000 },
+  { 0x132Du, 0.00060000 },
+  { 0x132Eu, 0.00000000 },
+  { 0x132Fu, 0.00000000 },
+  { 0x1330u, 0.00000000 },
+  { 0x1331u, 0.00000000 },
+  { 0x1332u, 0.00000000 },
+  { 0x1333u, 0.00070000 },
+  { 0x1334u, 0.00000000 },
+  { 0x1335u, 0.00030000 },
+  { 0x1336u, 0.00000000 },
+  { 0x1337u, 0.00000000 },
+  { 0x1338u, 0.00260000 },
+  { 0x1339u, 0.00050000 },
+  { 0x133Au, 0.00080000 },
+  { 0x133Bu, 0.00170000 },
+  { 0x133Cu, 0.00000000 },
+  { 0x133Du, 0.01060000 },
+  { 0x133Eu, 0.00040000 },
+  { 0x133Fu, 0.00000000 },
+  { 0x1340u, 0.00000000 },
+  { 0x1341u, 0.00000000 },
+  { 0x1342u, 0.00000000 },
+  { 0x1343u, 0.00010000 },
+  { 0x1344u, 0.00000000 },
+  { 0x1345u, 0.00040000 },
+  { 0x1346u, 0.00000000 },
+  { 0x1347u, 0.00000000 },
+  { 0x1348u, 0.00320000 },
+  { 0x1349u, 0.00040000 },
+  { 0x134Au, 0.00210000 },
+  { 0x134Bu, 0.00180000 },
+  { 0x134Cu, 0.00000000 },
+  { 0x134Du, 0.00880000 },
+  { 0x134Eu, 0.00020000 },
+  { 0x134Fu, 0.00000000 },
+  { 0x1350u, 0.00030000 },
+  { 0x1351u, 0.00010000 },
+  { 0x1352u, 0.00050000 },
+  { 0x1353u, 0.00050000 },
+  { 0x1354u, 0.00010000 },
+  { 0x1355u, 0.00040000 },
+  { 0x1356u, 0.00020000 },
+  { 0x1357u, 0.00000000 },
+};
+
@@ -0,0 +1,1769 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_294_UPPER[] = {
+  "ሀ",
+  "ሁ",
+  "ሂ",
+  "ሃ",
+  "ሄ",
+  "ህ",
+  "ሆ",
+  "ሇ",
+  "ለ",
+  "ሉ",
+  "ሊ",
+  "ላ",
+  "ሌ",
+  "ል",
+  "ሎ",
+  "ሏ",
+  "ⶀ",
+  "ሐ",
+  "ሑ",
+  "ሒ",
+  "ሓ",
+  "ሔ",
+  "ሕ",
+  "ሖ",
+  "ሗ",
+  "መ",
+  "ሙ",
+  "ሚ",
+  "ማ",
+  "ሜ",
+  "ም",
+  "ሞ",
+  "ሟ",
+  "ᎀ",
+  "ᎁ",
+  "ᎂ",
+  "ᎃ",
+  "ⶁ",
+  "ሠ",
+  "ሡ",
+  "ሢ",
+  "ሣ",
+  "ሤ",
+  "ሥ",
+  "ሦ",
+  "ሧ",
+  "ረ",
+  "ሩ",
+  "ሪ",
+  "ራ",
+  "ሬ",
+  "ር",
+  "ሮ",
+  "ሯ",
+  "ⶂ",
+  "ሰ",
+  "ሱ",
+  "ሲ",
+  "ሳ",
+  "ሴ",
+  "ስ",
+  "ሶ",
+  "ሷ",
+  "ⶃ",
+  "ሸ",
+  "ሹ",
+  "ሺ",
+  "ሻ",
+  "ሼ",
+  "ሽ",
+  "ሾ",
+  "ሿ",
+  "ⶄ",
+  "ቀ",
+  "ቁ",
+  "ቂ",
+  "ቃ",
+  "ቄ",
+  "ቅ",
+  "ቆ",
+  "ቇ",
+  "ቈ",
+  "ቊ",
+  "ቋ",
+  "ቌ",
+  "ቍ",
+  "ቐ",
+  "ቑ",
+  "ቒ",
+  "ቓ",
+  "ቔ",
+  "ቕ",
+  "ቖ",
+  "ቘ",
+  "ቚ",
+  "ቛ",
+  "ቜ",
+  "ቝ",
+  "በ",
+  "ቡ",
+  "ቢ",
+  "ባ",
+  "ቤ",
+  "ብ",
+  "ቦ",
+  "ቧ",
+  "ᎄ",
+  "ᎅ",
+  "ᎆ",
+  "ᎇ",
+  "ⶅ",
+  "ቨ",
+  "ቩ",
+  "ቪ",
+  "ቫ",
+  "ቬ",
+  "ቭ",
+  "ቮ",
+  "ቯ",
+  "ተ",
+  "ቱ",
+  "ቲ",
+  "ታ",
+  "ቴ",
+  "ት",
+  "ቶ",
+  "ቷ",
+  "ⶆ",
+  "ቸ",
+  "ቹ",
+  "ቺ",
+  "ቻ",
+  "ቼ",
+  "ች",
+  "ቾ",
+  "ቿ",
+  "ⶇ",
+  "ኀ",
+  "ኁ",
+  "ኂ",
+  "ኃ",
+  "ኄ",
+  "ኅ",
+  "ኆ",
+  "ኇ",
+  "ኈ",
+  "ኊ",
+  "ኋ",
+  "ኌ",
+  "ኍ",
+  "ነ",
+  "ኑ",
+  "ኒ",
+  "ና",
+  "ኔ",
+  "ን",
+  "ኖ",
+  "ኗ",
+  "ⶈ",
+  "ኘ",
+  "ኙ",
+  "ኚ",
+  "ኛ",
+  "ኜ",
+  "ኝ",
+  "ኞ",
+  "ኟ",
+  "ⶉ",
+  "አ",
+  "ኡ",
+  "ኢ",
+  "ኣ",
+  "ኤ",
+  "እ",
+  "ኦ",
+  "ኧ",
+  "ⶊ",
+  "ከ",
+  "ኩ",
+  "ኪ",
+  "ካ",
+  "ኬ",
+  "ክ",
+  "ኮ",
+  "ኯ",
+  "ኰ",
+  "ኲ",
+  "ኳ",
+  "ኴ",
+  "ኵ",
+  "ኸ",
+  "ኹ",
+  "ኺ",
+  "ኻ",
+  "ኼ",
+  "ኽ",
+  "ኾ",
+  "ዀ",
+  "ዂ",
+  "ዃ",
+  "ዄ",
+  "ዅ",
+  "ወ",
+  "ዉ",
+  "ዊ",
+  "ዋ",
+  "ዌ",
+  "ው",
+  "ዎ",
+  "ዏ",
+  "ዐ",
+  "ዑ",
+  "ዒ",
+  "ዓ",
+  "ዔ",
+  "ዕ",
+  "ዖ",
+  "ዘ",
+  "ዙ",
+  "ዚ",
+  "ዛ",
+  "ዜ",
+  "ዝ",
+  "ዞ",
+  "ዟ",
+  "ⶋ",
+  "ዠ",
+  "ዡ",
+  "ዢ",
+  "ዣ",
+  "ዤ",
+  "ዥ",
+  "ዦ",
+  "ዧ",
+  "የ",
+  "ዩ",
+  "ዪ",
+  "ያ",
+  "ዬ",
+  "ይ",
+  "ዮ",
+  "ዯ",
+  "ደ",
+  "ዱ",
+  "ዲ",
+  "ዳ",
+  "ዴ",
+  "ድ",
+  "ዶ",
+  "ዷ",
+  "ⶌ",
+  "ዸ",
+  "ዹ",
+  "ዺ",
+  "ዻ",
+  "ዼ",
+  "ዽ",
+  "ዾ",
+  "ዿ",
+  "ⶍ",
+  "ጀ",
+  "ጁ",
+  "ጂ",
+  "ጃ",
+  "ጄ",
+  "ጅ",
+  "ጆ",
+  "ጇ",
+  "ⶎ",
+  "ገ",
+  "ጉ",
+  "ጊ",
+  "ጋ",
+  "ጌ",
+  "ግ",
+  "ጎ",
+  "ጏ",
+  "ጐ",
+  "ጒ",
+  "ጓ",
+  "ጔ",
+  "ጕ",
+  "ጘ",
+  "ጙ",
+  "ጚ",
+  "ጛ",
+  "ጜ",
+  "ጝ",
+  "ጞ",
+  "ጟ",
+  "ⶓ",
+  "ⶔ",
+  "ⶕ",
+  "ⶖ",
+  "ጠ",
+  "ጡ",
+  "ጢ",
+  "ጣ",
+  "ጤ",
+  "ጥ",
+  "ጦ",
+  "ጧ",
+  "ⶏ",
+  "ጨ",
+  "ጩ",
+  "ጪ",
+  "ጫ",
+  "ጬ",
+  "ጭ",
+  "ጮ",
+  "ጯ",
+  "ⶐ",
+  "ጰ",
+  "ጱ",
+  "ጲ",
+  "ጳ",
+  "ጴ",
+  "ጵ",
+  "ጶ",
+  "ጷ",
+  "ⶑ",
+  "ጸ",
+  "ጹ",
+  "ጺ",
+  "ጻ",
+  "ጼ",
+  "ጽ",
+  "ጾ",
+  "ጿ",
+  "ፀ",
+  "ፁ",
+  "ፂ",
+  "ፃ",
+  "ፄ",
+  "ፅ",
+  "ፆ",
+  "ፇ",
+  "ፈ",
+  "ፉ",
+  "ፊ",
+  "ፋ",
+  "ፌ",
+  "ፍ",
+  "ፎ",
+  "ፏ",
+  "ᎈ",
+  "ᎉ",
+  "ᎊ",
+  "ᎋ",
+  "ፐ",
+  "ፑ",
+  "ፒ",
+  "ፓ",
+  "ፔ",
+  "ፕ",
+  "ፖ",
+  "ፗ",
+  "ᎌ",
+  "ᎍ",
+  "ᎎ",
+  "ᎏ",
+  "ⶒ",
+  "ፘ",
+  "ፙ",
+  "ፚ",
+  "ⶠ",
+  "ⶡ",
+  "ⶢ",
+  "ⶣ",
+  "ⶤ",
+  "ⶥ",
+  "ⶦ",
+  "ⶨ",
+  "ⶩ",
+  "ⶪ",
+  "ⶫ",
+  "ⶬ",
+  "ⶭ",
+  "ⶮ",
+  "ⶰ",
+  "ⶱ",
+  "ⶲ",
+  "ⶳ",
+  "ⶴ",
+  "ⶵ",
+  "ⶶ",
+  "ⶸ",
+  "ⶹ",
+  "ⶺ",
+  "ⶻ",
+  "ⶼ",
+  "ⶽ",
+  "ⶾ",
+  "ⷀ",
+  "ⷁ",
+  "ⷂ",
+  "ⷃ",
+  "ⷄ",
+  "ⷅ",
+  "ⷆ",
+  "ⷈ",
+  "ⷉ",
+  "ⷊ",
+  "ⷋ",
+  "ⷌ",
+  "ⷍ",
+  "ⷎ",
+  "ⷐ",
+  "ⷑ",
+  "ⷒ",
+  "ⷓ",
+  "ⷔ",
+  "ⷕ",
+  "ⷖ",
+  "ⷘ",
+  "ⷙ",
+  "ⷚ",
+  "ⷛ",
+  "ⷜ",
+  "ⷝ",
+  "ⷞ",
+};
+const char *ALPHA_294_LOWER[] = {
+  "ሀ",
+  "ሁ",
+  "ሂ",
+  "ሃ",
+  "ሄ",
+  "ህ",
+  "ሆ",
+  "ሇ",
+  "ለ",
+  "ሉ",
+  "ሊ",
+  "ላ",
+  "ሌ",
+  "ል",
+  "ሎ",
+  "ሏ",
+  "ⶀ",
+  "ሐ",
+  "ሑ",
+  "ሒ",
+  "ሓ",
+  "ሔ",
+  "ሕ",
+  "ሖ",
+  "ሗ",
+  "መ",
+  "ሙ",
+  "ሚ",
+  "ማ",
+  "ሜ",
+  "ም",
+  "ሞ",
+  "ሟ",
+  "ᎀ",
+  "ᎁ",
+  "ᎂ",
+  "ᎃ",
+  "ⶁ",
+  "ሠ",
+  "ሡ",
+  "ሢ",
+  "ሣ",
+  "ሤ",
+  "ሥ",
+  "ሦ",
+  "ሧ",
+  "ረ",
+  "ሩ",
+  "ሪ",
+  "ራ",
+  "ሬ",
+  "ር",
+  "ሮ",
+  "ሯ",
+  "ⶂ",
+  "ሰ",
+  "ሱ",
+  "ሲ",
+  "ሳ",
+  "ሴ",
+  "ስ",
+  "ሶ",
+  "ሷ",
+  "ⶃ",
+  "ሸ",
+  "ሹ",
+  "ሺ",
+  "ሻ",
+  "ሼ",
+  "ሽ",
+  "ሾ",
+  "ሿ",
+  "ⶄ",
+  "ቀ",
+  "ቁ",
+  "ቂ",
+  "ቃ",
+  "ቄ",
+  "ቅ",
+  "ቆ",
+  "ቇ",
+  "ቈ",
+  "ቊ",
+  "ቋ",
+  "ቌ",
+  "ቍ",
+  "ቐ",
+  "ቑ",
+  "ቒ",
+  "ቓ",
+  "ቔ",
+  "ቕ",
+  "ቖ",
+  "ቘ",
+  "ቚ",
+  "ቛ",
+  "ቜ",
+  "ቝ",
+  "በ",
+  "ቡ",
+  "ቢ",
+  "ባ",
+  "ቤ",
+  "ብ",
+  "ቦ",
+  "ቧ",
+  "ᎄ",
+  "ᎅ",
+  "ᎆ",
+  "ᎇ",
+  "ⶅ",
+  "ቨ",
+  "ቩ",
+  "ቪ",
+  "ቫ",
+  "ቬ",
+  "ቭ",
+  "ቮ",
+  "ቯ",
+  "ተ",
+  "ቱ",
+  "ቲ",
+  "ታ",
+  "ቴ",
+  "ት",
+  "ቶ",
+  "ቷ",
+  "ⶆ",
+  "ቸ",
+  "ቹ",
+  "ቺ",
+  "ቻ",
+  "ቼ",
+  "ች",
+  "ቾ",
+  "ቿ",
+  "ⶇ",
+  "ኀ",
+  "ኁ",
+  "ኂ",
+  "ኃ",
+  "ኄ",
+  "ኅ",
+  "ኆ",
+  "ኇ",
+  "ኈ",
+  "ኊ",
+  "ኋ",
+  "ኌ",
+  "ኍ",
+  "ነ",
+  "ኑ",
+  "ኒ",
+  "ና",
+  "ኔ",
+  "ን",
+  "ኖ",
+  "ኗ",
+  "ⶈ",
+  "ኘ",
+  "ኙ",
+  "ኚ",
+  "ኛ",
+  "ኜ",
+  "ኝ",
+  "ኞ",
+  "ኟ",
+  "ⶉ",
+  "አ",
+  "ኡ",
+  "ኢ",
+  "ኣ",
+  "ኤ",
+  "እ",
+  "ኦ",
+  "ኧ",
+  "ⶊ",
+  "ከ",
+  "ኩ",
+  "ኪ",
+  "ካ",
+  "ኬ",
+  "ክ",
+  "ኮ",
+  "ኯ",
+  "ኰ",
+  "ኲ",
+  "ኳ",
+  "ኴ",
+  "ኵ",
+  "ኸ",
+  "ኹ",
+  "ኺ",
+  "ኻ",
+  "ኼ",
+  "ኽ",
+  "ኾ",
+  "ዀ",
+  "ዂ",
+  "ዃ",
+  "ዄ",
+  "ዅ",
+  "ወ",
+  "ዉ",
+  "ዊ",
+  "ዋ",
+  "ዌ",
+  "ው",
+  "ዎ",
+  "ዏ",
+  "ዐ",
+  "ዑ",
+  "ዒ",
+  "ዓ",
+  "ዔ",
+  "ዕ",
+  "ዖ",
+  "ዘ",
+  "ዙ",
+  "ዚ",
+  "ዛ",
+  "ዜ",
+  "ዝ",
+  "ዞ",
+  "ዟ",
+  "ⶋ",
+  "ዠ",
+  "ዡ",
+  "ዢ",
+  "ዣ",
+  "ዤ",
+  "ዥ",
+  "ዦ",
+  "ዧ",
+  "የ",
+  "ዩ",
+  "ዪ",
+  "ያ",
+  "ዬ",
+  "ይ",
+  "ዮ",
+  "ዯ",
+  "ደ",
+  "ዱ",
+  "ዲ",
+  "ዳ",
+  "ዴ",
+  "ድ",
+  "ዶ",
+  "ዷ",
+  "ⶌ",
+  "ዸ",
+  "ዹ",
+  "ዺ",
+  "ዻ",
+  "ዼ",
+  "ዽ",
+  "ዾ",
+  "ዿ",
+  "ⶍ",
+  "ጀ",
+  "ጁ",
+  "ጂ",
+  "ጃ",
+  "ጄ",
+  "ጅ",
+  "ጆ",
+  "ጇ",
+  "ⶎ",
+  "ገ",
+  "ጉ",
+  "ጊ",
+  "ጋ",
+  "ጌ",
+  "ግ",
+  "ጎ",
+  "ጏ",
+  "ጐ",
+  "ጒ",
+  "ጓ",
+  "ጔ",
+  "ጕ",
+  "ጘ",
+  "ጙ",
+  "ጚ",
+  "ጛ",
+  "ጜ",
+  "ጝ",
+  "ጞ",
+  "ጟ",
+  "ⶓ",
+  "ⶔ",
+  "ⶕ",
+  "ⶖ",
+  "ጠ",
+  "ጡ",
+  "ጢ",
+  "ጣ",
+  "ጤ",
+  "ጥ",
+  "ጦ",
+  "ጧ",
+  "ⶏ",
+  "ጨ",
+  "ጩ",
+  "ጪ",
+  "ጫ",
+  "ጬ",
+  "ጭ",
+  "ጮ",
+  "ጯ",
+  "ⶐ",
+  "ጰ",
+  "ጱ",
+  "ጲ",
+  "ጳ",
+  "ጴ",
+  "ጵ",
+  "ጶ",
+  "ጷ",
+  "ⶑ",
+  "ጸ",
+  "ጹ",
+  "ጺ",
+  "ጻ",
+  "ጼ",
+  "ጽ",
+  "ጾ",
+  "ጿ",
+  "ፀ",
+  "ፁ",
+  "ፂ",
+  "ፃ",
+  "ፄ",
+  "ፅ",
+  "ፆ",
+  "ፇ",
+  "ፈ",
+  "ፉ",
+  "ፊ",
+  "ፋ",
+  "ፌ",
+  "ፍ",
+  "ፎ",
+  "ፏ",
+  "ᎈ",
+  "ᎉ",
+  "ᎊ",
+  "ᎋ",
+  "ፐ",
+  "ፑ",
+  "ፒ",
+  "ፓ",
+  "ፔ",
+  "ፕ",
+  "ፖ",
+  "ፗ",
+  "ᎌ",
+  "ᎍ",
+  "ᎎ",
+  "ᎏ",
+  "ⶒ",
+  "ፘ",
+  "ፙ",
+  "ፚ",
+  "ⶠ",
+  "ⶡ",
+  "ⶢ",
+  "ⶣ",
+  "ⶤ",
+  "ⶥ",
+  "ⶦ",
+  "ⶨ",
+  "ⶩ",
+  "ⶪ",
+  "ⶫ",
+  "ⶬ",
+  "ⶭ",
+  "ⶮ",
+  "ⶰ",
+  "ⶱ",
+  "ⶲ",
+  "ⶳ",
+  "ⶴ",
+  "ⶵ",
+  "ⶶ",
+  "ⶸ",
+  "ⶹ",
+  "ⶺ",
+  "ⶻ",
+  "ⶼ",
+  "ⶽ",
+  "ⶾ",
+  "ⷀ",
+  "ⷁ",
+  "ⷂ",
+  "ⷃ",
+  "ⷄ",
+  "ⷅ",
+  "ⷆ",
+  "ⷈ",
+  "ⷉ",
+  "ⷊ",
+  "ⷋ",
+  "ⷌ",
+  "ⷍ",
+  "ⷎ",
+  "ⷐ",
+  "ⷑ",
+  "ⷒ",
+  "ⷓ",
+  "ⷔ",
+  "ⷕ",
+  "ⷖ",
+  "ⷘ",
+  "ⷙ",
+  "ⷚ",
+  "ⷛ",
+  "ⷜ",
+  "ⷝ",
+  "ⷞ",
+};
+const char *ALPHA_294_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_294_UPPER_CPS[] = {
+  4608, 4609, 4610, 4611, 4612, 4613, 4614, 4615, 4616, 4617, 4618, 4619, 4620, 4621, 4622, 4623,
+  4624, 4625, 4626, 4627, 4628, 4629, 4630, 4631, 4632, 4633, 4634, 4635, 4636, 4637, 4638, 4639,
+  4640, 4641, 4642, 4643, 4644, 4645, 4646, 4647, 4648, 4649, 4650, 4651, 4652, 4653, 4654, 4655,
+  4656, 4657, 4658, 4659, 4660, 4661, 4662, 4663, 4664, 4665, 4666, 4667, 4668, 4669, 4670, 4671,
+  4672, 4673, 4674, 4675, 4676, 4677, 4678, 4679, 4680, 4682, 4683, 4684, 4685, 4688, 4689, 4690,
+  4691, 4692, 4693, 4694, 4696, 4698, 4699, 4700, 4701, 4704, 4705, 4706, 4707, 4708, 4709, 4710,
+  4711, 4712, 4713, 4714, 4715, 4716, 4717, 4718, 4719, 4720, 4721, 4722, 4723, 4724, 4725, 4726,
+  4727, 4728, 4729, 4730, 4731, 4732, 4733, 4734, 4735, 4736, 4737, 4738, 4739, 4740, 4741, 4742,
+  4743, 4744, 4746, 4747, 4748, 4749, 4752, 4753, 4754, 4755, 4756, 4757, 4758, 4759, 4760, 4761,
+  4762, 4763, 4764, 4765, 4766, 4767, 4768, 4769, 4770, 4771, 4772, 4773, 4774, 4775, 4776, 4777,
+  4778, 4779, 4780, 4781, 4782, 4783, 4784, 4786, 4787, 4788, 4789, 4792, 4793, 4794, 4795, 4796,
+  4797, 4798, 4800, 4802, 4803, 4804, 4805, 4808, 4809, 4810, 4811, 4812, 4813, 4814, 4815, 4816,
+  4817, 4818, 4819, 4820, 4821, 4822, 4824, 4825, 4826, 4827, 4828, 4829, 4830, 4831, 4832, 4833,
+  4834, 4835, 4836, 4837, 4838, 4839, 4840, 4841, 4842, 4843, 4844, 4845, 4846, 4847, 4848, 4849,
+  4850, 4851, 4852, 4853, 4854, 4855, 4856, 4857, 4858, 4859, 4860, 4861, 4862, 4863, 4864, 4865,
+  4866, 4867, 4868, 4869, 4870, 4871, 4872, 4873, 4874, 4875, 4876, 4877, 4878, 4879, 4880, 4882,
+  4883, 4884, 4885, 4888, 4889, 4890, 4891, 4892, 4893, 4894, 4895, 4896, 4897, 4898, 4899, 4900,
+  4901, 4902, 4903, 4904, 4905, 4906, 4907, 4908, 4909, 4910, 4911, 4912, 4913, 4914, 4915, 4916,
+  4917, 4918, 4919, 4920, 4921, 4922, 4923, 4924, 4925, 4926, 4927, 4928, 4929, 4930, 4931, 4932,
+  4933, 4934, 4935, 4936, 4937, 4938, 4939, 4940, 4941, 4942, 4943, 4944, 4945, 4946, 4947, 4948,
+  4949, 4950, 4951, 4952, 4953, 4954, 4992, 4993, 4994, 4995, 4996, 4997, 4998, 4999, 5000, 5001,
+  5002, 5003, 5004, 5005, 5006, 5007, 11648, 11649, 11650, 11651, 11652, 11653, 11654, 11655, 11656, 11657,
+  11658, 11659, 11660, 11661, 11662, 11663, 11664, 11665, 11666, 11667, 11668, 11669, 11670, 11680, 11681, 11682,
+  11683, 11684, 11685, 11686, 11688, 11689, 11690, 11691, 11692, 11693, 11694, 11696, 11697, 11698, 11699, 11700,
+  11701, 11702, 11704, 11705, 11706, 11707, 11708, 11709, 11710, 11712, 11713, 11714, 11715, 11716, 11717, 11718,
+  11720, 11721, 11722, 11723, 11724, 11725, 11726, 11728, 11729, 11730, 11731, 11732, 11733, 11734, 11736, 11737,
+  11738, 11739, 11740, 11741, 11742,
+};
+const uint32_t ALPHA_294_LOWER_CPS[] = {
+  4608, 4609, 4610, 4611, 4612, 4613, 4614, 4615, 4616, 4617, 4618, 4619, 4620, 4621, 4622, 4623,
+  4624, 4625, 4626, 4627, 4628, 4629, 4630, 4631, 4632, 4633, 4634, 4635, 4636, 4637, 4638, 4639,
+  4640, 4641, 4642, 4643, 4644, 4645, 4646, 4647, 4648, 4649, 4650, 4651, 4652, 4653, 4654, 4655,
+  4656, 4657, 4658, 4659, 4660, 4661, 4662, 4663, 4664, 4665, 4666, 4667, 4668, 4669, 4670, 4671,
+  4672, 4673, 4674, 4675, 4676, 4677, 4678, 4679, 4680, 4682, 4683, 4684, 4685, 4688, 4689, 4690,
+  4691, 4692, 4693, 4694, 4696, 4698, 4699, 4700, 4701, 4704, 4705, 4706, 4707, 4708, 4709, 4710,
+  4711, 4712, 4713, 4714, 4715, 4716, 4717, 4718, 4719, 4720, 4721, 4722, 4723, 4724, 4725, 4726,
+  4727, 4728, 4729, 4730, 4731, 4732, 4733, 4734, 4735, 4736, 4737, 4738, 4739, 4740, 4741, 4742,
+  4743, 4744, 4746, 4747, 4748, 4749, 4752, 4753, 4754, 4755, 4756, 4757, 4758, 4759, 4760, 4761,
+  4762, 4763, 4764, 4765, 4766, 4767, 4768, 4769, 4770, 4771, 4772, 4773, 4774, 4775, 4776, 4777,
+  4778, 4779, 4780, 4781, 4782, 4783, 4784, 4786, 4787, 4788, 4789, 4792, 4793, 4794, 4795, 4796,
+  4797, 4798, 4800, 4802, 4803, 4804, 4805, 4808, 4809, 4810, 4811, 4812, 4813, 4814, 4815, 4816,
+  4817, 4818, 4819, 4820, 4821, 4822, 4824, 4825, 4826, 4827, 4828, 4829, 4830, 4831, 4832, 4833,
+  4834, 4835, 4836, 4837, 4838, 4839, 4840, 4841, 4842, 4843, 4844, 4845, 4846, 4847, 4848, 4849,
+  4850, 4851, 4852, 4853, 4854, 4855, 4856, 4857, 4858, 4859, 4860, 4861, 4862, 4863, 4864, 4865,
+  4866, 4867, 4868, 4869, 4870, 4871, 4872, 4873, 4874, 4875, 4876, 4877, 4878, 4879, 4880, 4882,
+  4883, 4884, 4885, 4888, 4889, 4890, 4891, 4892, 4893, 4894, 4895, 4896, 4897, 4898, 4899, 4900,
+  4901, 4902, 4903, 4904, 4905, 4906, 4907, 4908, 4909, 4910, 4911, 4912, 4913, 4914, 4915, 4916,
+  4917, 4918, 4919, 4920, 4921, 4922, 4923, 4924, 4925, 4926, 4927, 4928, 4929, 4930, 4931, 4932,
+  4933, 4934, 4935, 4936, 4937, 4938, 4939, 4940, 4941, 4942, 4943, 4944, 4945, 4946, 4947, 4948,
+  4949, 4950, 4951, 4952, 4953, 4954, 4992, 4993, 4994, 4995, 4996, 4997, 4998, 4999, 5000, 5001,
+  5002, 5003, 5004, 5005, 5006, 5007, 11648, 11649, 11650, 11651, 11652, 11653, 11654, 11655, 11656, 11657,
+  11658, 11659, 11660, 11661, 11662, 11663, 11664, 11665, 11666, 11667, 11668, 11669, 11670, 11680, 11681, 11682,
+  11683, 11684, 11685, 11686, 11688, 11689, 11690, 11691, 11692, 11693, 11694, 11696, 11697, 11698, 11699, 11700,
+  11701, 11702, 11704, 11705, 11706, 11707, 11708, 11709, 11710, 11712, 11713, 11714, 11715, 11716, 11717, 11718,
+  11720, 11721, 11722, 11723, 11724, 11725, 11726, 11728, 11729, 11730, 11731, 11732, 11733, 11734, 11736, 11737,
+  11738, 11739, 11740, 11741, 11742,
+};
+const uint32_t ALPHA_294_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_294_FREQ[] = {
+  { "ሀ", 0.00000000 },
+  { "ሁ", 0.00000000 },
+  { "ሂ", 0.00000000 },
+  { "ሃ", 0.00000000 },
+  { "ሄ", 0.00000000 },
+  { "ህ", 0.00000000 },
+  { "ሆ", 0.00000000 },
+  { "ሇ", 0.00000000 },
+  { "ለ", 0.00000000 },
+  { "ሉ", 0.00000000 },
+  { "ሊ", 0.00000000 },
+  { "ላ", 0.00000000 },
+  { "ሌ", 0.00000000 },
+  { "ል", 0.00000000 },
+  { "ሎ", 0.00000000 },
+  { "ሏ", 0.00000000 },
+  { "ⶀ", 0.00000000 },
+  { "ሐ", 0.00000000 },
+  { "ሑ", 0.00000000 },
+  { "ሒ", 0.00000000 },
+  { "ሓ", 0.00000000 },
+  { "ሔ", 0.00000000 },
+  { "ሕ", 0.00000000 },
+  { "ሖ", 0.00000000 },
+  { "ሗ", 0.00000000 },
+  { "መ", 0.00000000 },
+  { "ሙ", 0.00000000 },
+  { "ሚ", 0.00000000 },
+  { "ማ", 0.00000000 },
+  { "ሜ", 0.00000000 },
+  { "ም", 0.00000000 },
+  { "ሞ", 0.00000000 },
+  { "ሟ", 0.00000000 },
+  { "ᎀ", 0.00000000 },
+  { "ᎁ", 0.00000000 },
+  { "ᎂ", 0.00000000 },
+  { "ᎃ", 0.00000000 },
+  { "ⶁ", 0.00000000 },
+  { "ሠ", 0.00000000 },
+  { "ሡ", 0.00000000 },
+  { "ሢ", 0.00000000 },
+  { "ሣ", 0.00000000 },
+  { "ሤ", 0.00000000 },
+  { "ሥ", 0.00000000 },
+  { "ሦ", 0.00000000 },
+  { "ሧ", 0.00000000 },
+  { "ረ", 0.00000000 },
+  { "ሩ", 0.00000000 },
+  { "ሪ", 0.00000000 },
+  { "ራ", 0.00000000 },
+  { "ሬ", 0.00000000 },
+  { "ር", 0.00000000 },
+  { "ሮ", 0.00000000 },
+  { "ሯ", 0.00000000 },
+  { "ⶂ", 0.00000000 },
+  { "ሰ", 0.00000000 },
+  { "ሱ", 0.00000000 },
+  { "ሲ", 0.00000000 },
+  { "ሳ", 0.00000000 },
+  { "ሴ", 0.00000000 },
+  { "ስ", 0.00000000 },
+  { "ሶ", 0.00000000 },
+  { "ሷ", 0.00000000 },
+  { "ⶃ", 0.00000000 },
+  { "ሸ", 0.00000000 },
+  { "ሹ", 0.00000000 },
+  { "ሺ", 0.00000000 },
+  { "ሻ", 0.00000000 },
+  { "ሼ", 0.00000000 },
+  { "ሽ", 0.00000000 },
+  { "ሾ", 0.00000000 },
+  { "ሿ", 0.00000000 },
+  { "ⶄ", 0.00000000 },
+  { "ቀ", 0.00000000 },
+  { "ቁ", 0.00000000 },
+  { "ቂ", 0.00000000 },
+  { "ቃ", 0.00000000 },
+  { "ቄ", 0.00000000 },
+  { "ቅ", 0.00000000 },
+  { "ቆ", 0.00000000 },
+  { "ቇ", 0.00000000 },
+  { "ቈ", 0.00000000 },
+  { "ቊ", 0.00000000 },
+  { "ቋ", 0.00000000 },
+  { "ቌ", 0.00000000 },
+  { "ቍ", 0.00000000 },
+  { "ቐ", 0.00000000 },
+  { "ቑ", 0.00000000 },
+  { "ቒ", 0.00000000 },
+  { "ቓ", 0.00000000 },
+  { "ቔ", 0.00000000 },
+  { "ቕ", 0.00000000 },
+  { "ቖ", 0.00000000 },
+  { "ቘ", 0.00000000 },
+  { "ቚ", 0.00000000 },
+  { "ቛ", 0.00000000 },
+  { "ቜ", 0.00000000 },
+  { "ቝ", 0.00000000 },
+  { "በ", 0.00000000 },
+  { "ቡ", 0.00000000 },
+  { "ቢ", 0.00000000 },
+  { "ባ", 0.00000000 },
+  { "ቤ", 0.00000000 },
+  { "ብ", 0.00000000 },
+  { "ቦ", 0.00000000 },
+  { "ቧ", 0.00000000 },
+  { "ᎄ", 0.00000000 },
+  { "ᎅ", 0.00000000 },
+  { "ᎆ", 0.00000000 },
+  { "ᎇ", 0.00000000 },
+  { "ⶅ", 0.00000000 },
+  { "ቨ", 0.00000000 },
+  { "ቩ", 0.00000000 },
+  { "ቪ", 0.00000000 },
+  { "ቫ", 0.00000000 },
+  { "ቬ", 0.00000000 },
+  { "ቭ", 0.00000000 },
+  { "ቮ", 0.00000000 },
+  { "ቯ", 0.00000000 },
+  { "ተ", 0.00000000 },
+  { "ቱ", 0.00000000 },
+  { "ቲ", 0.00000000 },
+  { "ታ", 0.00000000 },
+  { "ቴ", 0.00000000 },
+  { "ት", 0.00000000 },
+  { "ቶ", 0.00000000 },
+  { "ቷ", 0.00000000 },
+  { "ⶆ", 0.00000000 },
+  { "ቸ", 0.00000000 },
+  { "ቹ", 0.00000000 },
+  { "ቺ", 0.00000000 },
+  { "ቻ", 0.00000000 },
+  { "ቼ", 0.00000000 },
+  { "ች", 0.00000000 },
+  { "ቾ", 0.00000000 },
+  { "ቿ", 0.00000000 },
+  { "ⶇ", 0.00000000 },
+  { "ኀ", 0.00000000 },
+  { "ኁ", 0.00000000 },
+  { "ኂ", 0.00000000 },
+  { "ኃ", 0.00000000 },
+  { "ኄ", 0.00000000 },
+  { "ኅ", 0.00000000 },
+  { "ኆ", 0.00000000 },
+  { "ኇ", 0.00000000 },
+  { "ኈ", 0.00000000 },
+  { "ኊ", 0.00000000 },
+  { "ኋ", 0.00000000 },
+  { "ኌ", 0.00000000 },
+  { "ኍ", 0.00000000 },
+  { "ነ", 0.00000000 },
+  { "ኑ", 0.00000000 },
+  { "ኒ", 0.00000000 },
+  { "ና", 0.00000000 },
+  { "ኔ", 0.00000000 },
+  { "ን", 0.00000000 },
+  { "ኖ", 0.00000000 },
+  { "ኗ", 0.00000000 },
+  { "ⶈ", 0.00000000 },
+  { "ኘ", 0.00000000 },
+  { "ኙ", 0.00000000 },
+  { "ኚ", 0.00000000 },
+  { "ኛ", 0.00000000 },
+  { "ኜ", 0.00000000 },
+  { "ኝ", 0.00000000 },
+  { "ኞ", 0.00000000 },
+  { "ኟ", 0.00000000 },
+  { "ⶉ", 0.00000000 },
+  { "አ", 0.00000000 },
+  { "ኡ", 0.00000000 },
+  { "ኢ", 0.00000000 },
+  { "ኣ", 0.00000000 },
+  { "ኤ", 0.00000000 },
+  { "እ", 0.00000000 },
+  { "ኦ", 0.00000000 },
+  { "ኧ", 0.00000000 },
+  { "ⶊ", 0.00000000 },
+  { "ከ", 0.00000000 },
+  { "ኩ", 0.00000000 },
+  { "ኪ", 0.00000000 },
+  { "ካ", 0.00000000 },
+  { "ኬ", 0.00000000 },
+  { "ክ", 0.00000000 },
+  { "ኮ", 0.00000000 },
+  { "ኯ", 0.00000000 },
+  { "ኰ", 0.00000000 },
+  { "ኲ", 0.00000000 },
+  { "ኳ", 0.00000000 },
+  { "ኴ", 0.00000000 },
+  { "ኵ", 0.00000000 },
+  { "ኸ", 0.00000000 },
+  { "ኹ", 0.00000000 },
+  { "ኺ", 0.00000000 },
+  { "ኻ", 0.00000000 },
+  { "ኼ", 0.00000000 },
+  { "ኽ", 0.00000000 },
+  { "ኾ", 0.00000000 },
+  { "ዀ", 0.00000000 },
+  { "ዂ", 0.00000000 },
+  { "ዃ", 0.00000000 },
+  { "ዄ", 0.00000000 },
+  { "ዅ", 0.00000000 },
+  { "ወ", 0.00000000 },
+  { "ዉ", 0.00000000 },
+  { "ዊ", 0.00000000 },
+  { "ዋ", 0.00000000 },
+  { "ዌ", 0.00000000 },
+  { "ው", 0.00000000 },
+  { "ዎ", 0.00000000 },
+  { "ዏ", 0.00000000 },
+  { "ዐ", 0.00000000 },
+  { "ዑ", 0.00000000 },
+  { "ዒ", 0.00000000 },
+  { "ዓ", 0.00000000 },
+  { "ዔ", 0.00000000 },
+  { "ዕ", 0.00000000 },
+  { "ዖ", 0.00000000 },
+  { "ዘ", 0.00000000 },
+  { "ዙ", 0.00000000 },
+  { "ዚ", 0.00000000 },
+  { "ዛ", 0.00000000 },
+  { "ዜ", 0.00000000 },
+  { "ዝ", 0.00000000 },
+  { "ዞ", 0.00000000 },
+  { "ዟ", 0.00000000 },
+  { "ⶋ", 0.00000000 },
+  { "ዠ", 0.00000000 },
+  { "ዡ", 0.00000000 },
+  { "ዢ", 0.00000000 },
+  { "ዣ", 0.00000000 },
+  { "ዤ", 0.00000000 },
+  { "ዥ", 0.00000000 },
+  { "ዦ", 0.00000000 },
+  { "ዧ", 0.00000000 },
+  { "የ", 0.00000000 },
+  { "ዩ", 0.00000000 },
+  { "ዪ", 0.00000000 },
+  { "ያ", 0.00000000 },
+  { "ዬ", 0.00000000 },
+  { "ይ", 0.00000000 },
+  { "ዮ", 0.00000000 },
+  { "ዯ", 0.00000000 },
+  { "ደ", 0.00000000 },
+  { "ዱ", 0.00000000 },
+  { "ዲ", 0.00000000 },
+  { "ዳ", 0.00000000 },
+  { "ዴ", 0.00000000 },
+  { "ድ", 0.00000000 },
+  { "ዶ", 0.00000000 },
+  { "ዷ", 0.00000000 },
+  { "ⶌ", 0.00000000 },
+  { "ዸ", 0.00000000 },
+  { "ዹ", 0.00000000 },
+  { "ዺ", 0.00000000 },
+  { "ዻ", 0.00000000 },
+  { "ዼ", 0.00000000 },
+  { "ዽ", 0.00000000 },
+  { "ዾ", 0.00000000 },
+  { "ዿ", 0.00000000 },
+  { "ⶍ", 0.00000000 },
+  { "ጀ", 0.00000000 },
+  { "ጁ", 0.00000000 },
+  { "ጂ", 0.00000000 },
+  { "ጃ", 0.00000000 },
+  { "ጄ", 0.00000000 },
+  { "ጅ", 0.00000000 },
+  { "ጆ", 0.00000000 },
+  { "ጇ", 0.00000000 },
+  { "ⶎ", 0.00000000 },
+  { "ገ", 0.00000000 },
+  { "ጉ", 0.00000000 },
+  { "ጊ", 0.00000000 },
+  { "ጋ", 0.00000000 },
+  { "ጌ", 0.00000000 },
+  { "ግ", 0.00000000 },
+  { "ጎ", 0.00000000 },
+  { "ጏ", 0.00000000 },
+  { "ጐ", 0.00000000 },
+  { "ጒ", 0.00000000 },
+  { "ጓ", 0.00000000 },
+  { "ጔ", 0.00000000 },
+  { "ጕ", 0.00000000 },
+  { "ጘ", 0.00000000 },
+  { "ጙ", 0.00000000 },
+  { "ጚ", 0.00000000 },
+  { "ጛ", 0.00000000 },
+  { "ጜ", 0.00000000 },
+  { "ጝ", 0.00000000 },
+  { "ጞ", 0.00000000 },
+  { "ጟ", 0.00000000 },
+  { "ⶓ", 0.00000000 },
+  { "ⶔ", 0.00000000 },
+  { "ⶕ", 0.00000000 },
+  { "ⶖ", 0.00000000 },
+  { "ጠ", 0.00000000 },
+  { "ጡ", 0.00000000 },
+  { "ጢ", 0.00000000 },
+  { "ጣ", 0.00000000 },
+  { "ጤ", 0.00000000 },
+  { "ጥ", 0.00000000 },
+  { "ጦ", 0.00000000 },
+  { "ጧ", 0.00000000 },
+  { "ⶏ", 0.00000000 },
+  { "ጨ", 0.00000000 },
+  { "ጩ", 0.00000000 },
+  { "ጪ", 0.00000000 },
+  { "ጫ", 0.00000000 },
+  { "ጬ", 0.00000000 },
+  { "ጭ", 0.00000000 },
+  { "ጮ", 0.00000000 },
+  { "ጯ", 0.00000000 },
+  { "ⶐ", 0.00000000 },
+  { "ጰ", 0.00000000 },
+  { "ጱ", 0.00000000 },
+  { "ጲ", 0.00000000 },
+  { "ጳ", 0.00000000 },
+  { "ጴ", 0.00000000 },
+  { "ጵ", 0.00000000 },
+  { "ጶ", 0.00000000 },
+  { "ጷ", 0.00000000 },
+  { "ⶑ", 0.00000000 },
+  { "ጸ", 0.00000000 },
+  { "ጹ", 0.00000000 },
+  { "ጺ", 0.00000000 },
+  { "ጻ", 0.00000000 },
+  { "ጼ", 0.00000000 },
+  { "ጽ", 0.00000000 },
+  { "ጾ", 0.00000000 },
+  { "ጿ", 0.00000000 },
+  { "ፀ", 0.00000000 },
+  { "ፁ", 0.00000000 },
+  { "ፂ", 0.00000000 },
+  { "ፃ", 0.00000000 },
+  { "ፄ", 0.00000000 },
+  { "ፅ", 0.00000000 },
+  { "ፆ", 0.00000000 },
+  { "ፇ", 0.00000000 },
+  { "ፈ", 0.00000000 },
+  { "ፉ", 0.00000000 },
+  { "ፊ", 0.00000000 },
+  { "ፋ", 0.00000000 },
+  { "ፌ", 0.00000000 },
+  { "ፍ", 0.00000000 },
+  { "ፎ", 0.00000000 },
+  { "ፏ", 0.00000000 },
+  { "ᎈ", 0.00000000 },
+  { "ᎉ", 0.00000000 },
+  { "ᎊ", 0.00000000 },
+  { "ᎋ", 0.00000000 },
+  { "ፐ", 0.00000000 },
+  { "ፑ", 0.00000000 },
+  { "ፒ", 0.00000000 },
+  { "ፓ", 0.00000000 },
+  { "ፔ", 0.00000000 },
+  { "ፕ", 0.00000000 },
+  { "ፖ", 0.00000000 },
+  { "ፗ", 0.00000000 },
+  { "ᎌ", 0.00000000 },
+  { "ᎍ", 0.00000000 },
+  { "ᎎ", 0.00000000 },
+  { "ᎏ", 0.00000000 },
+  { "ⶒ", 0.00000000 },
+  { "ፘ", 0.00000000 },
+  { "ፙ", 0.00000000 },
+  { "ፚ", 0.00000000 },
+  { "ⶠ", 0.00000000 },
+  { "ⶡ", 0.00000000 },
+  { "ⶢ", 0.00000000 },
+  { "ⶣ", 0.00000000 },
+  { "ⶤ", 0.00000000 },
+  { "ⶥ", 0.00000000 },
+  { "ⶦ", 0.00000000 },
+  { "ⶨ", 0.00000000 },
+  { "ⶩ", 0.00000000 },
+  { "ⶪ", 0.00000000 },
+  { "ⶫ", 0.00000000 },
+  { "ⶬ", 0.00000000 },
+  { "ⶭ", 0.00000000 },
+  { "ⶮ", 0.00000000 },
+  { "ⶰ", 0.00000000 },
+  { "ⶱ", 0.00000000 },
+  { "ⶲ", 0.00000000 },
+  { "ⶳ", 0.00000000 },
+  { "ⶴ", 0.00000000 },
+  { "ⶵ", 0.00000000 },
+  { "ⶶ", 0.00000000 },
+  { "ⶸ", 0.00000000 },
+  { "ⶹ", 0.00000000 },
+  { "ⶺ", 0.00000000 },
+  { "ⶻ", 0.00000000 },
+  { "ⶼ", 0.00000000 },
+  { "ⶽ", 0.00000000 },
+  { "ⶾ", 0.00000000 },
+  { "ⷀ", 0.00000000 },
+  { "ⷁ", 0.00000000 },
+  { "ⷂ", 0.00000000 },
+  { "ⷃ", 0.00000000 },
+  { "ⷄ", 0.00000000 },
+  { "ⷅ", 0.00000000 },
+  { "ⷆ", 0.00000000 },
+  { "ⷈ", 0.00000000 },
+  { "ⷉ", 0.00000000 },
+  { "ⷊ", 0.00000000 },
+  { "ⷋ", 0.00000000 },
+  { "ⷌ", 0.00000000 },
+  { "ⷍ", 0.00000000 },
+  { "ⷎ", 0.00000000 },
+  { "ⷐ", 0.00000000 },
+  { "ⷑ", 0.00000000 },
+  { "ⷒ", 0.00000000 },
+  { "ⷓ", 0.00000000 },
+  { "ⷔ", 0.00000000 },
+  { "ⷕ", 0.00000000 },
+  { "ⷖ", 0.00000000 },
+  { "ⷘ", 0.00000000 },
+  { "ⷙ", 0.00000000 },
+  { "ⷚ", 0.00000000 },
+  { "ⷛ", 0.00000000 },
+  { "ⷜ", 0.00000000 },
+  { "ⷝ", 0.00000000 },
+  { "ⷞ", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_294_FREQ_CPS[] = {
+  { 0x1200u, 0.00000000 },
+  { 0x1201u, 0.00000000 },
+  { 0x1202u, 0.00000000 },
+  { 0x1203u, 0.00000000 },
+  { 0x1204u, 0.00000000 },
+  { 0x1205u, 0.00000000 },
+  { 0x1206u, 0.00000000 },
+  { 0x1207u, 0.00000000 },
+  { 0x1208u, 0.00000000 },
+  { 0x1209u, 0.00000000 },
+  { 0x120Au, 0.00000000 },
+  { 0x120Bu, 0.00000000 },
+  { 0x120Cu, 0.00000000 },
+  { 0x120Du, 0.00000000 },
+  { 0x120Eu, 0.00000000 },
+  { 0x120Fu, 0.00000000 },
+  { 0x1210u, 0.00000000 },
+  { 0x1211u, 0.00000000 },
+  { 0x1212u, 0.00000000 },
+  { 0x1213u, 0.00000000 },
+  { 0x1214u, 0.00000000 },
+  { 0x1215u, 0.00000000 },
+  { 0x1216u, 0.00000000 },
+  { 0x1217u, 0.00000000 },
+  { 0x1218u, 0.00000000 },
+  { 0x1219u, 0.00000000 },
+  { 0x121Au, 0.00000000 },
+  { 0x121Bu, 0.00000000 },
+  { 0x121Cu, 0.00000000 },
+  { 0x121Du, 0.00000000 },
+  { 0x121Eu, 0.00000000 },
+  { 0x121Fu, 0.00000000 },
+  { 0x1220u, 0.00000000 },
+  { 0x1221u, 0.00000000 },
+  { 0x1222u, 0.00000000 },
+  { 0x1223u, 0.00000000 },
+  { 0x1224u, 0.00000000 },
+  { 0x1225u, 0.00000000 },
+  { 0x1226u, 0.00000000 },
+  { 0x1227u, 0.00000000 },
+  { 0x1228u, 0.00000000 },
+  { 0x1229u, 0.00000000 },
+  { 0x122Au, 0.00000000 },
+  { 0x122Bu, 0.00000000 },
+  { 0x122Cu, 0.00000000 },
+  { 0x122Du, 0.00000000 },
+  { 0x122Eu, 0.00000000 },
+  { 0x122Fu, 0.00000000 },
+  { 0x1230u, 0.00000000 },
+  { 0x1231u, 0.00000000 },
+  { 0x1232u, 0.00000000 },
+  { 0x1233u, 0.00000000 },
+  { 0x1234u, 0.00000000 },
+  { 0x1235u, 0.00000000 },
+  { 0x1236u, 0.00000000 },
+  { 0x1237u, 0.00000000 },
+  { 0x1238u, 0.00000000 },
+  { 0x1239u, 0.00000000 },
+  { 0x123Au, 0.00000000 },
+  { 0x123Bu, 0.00000000 },
+  { 0x123Cu, 0.00000000 },
+  { 0x123Du, 0.00000000 },
+  { 0x123Eu, 0.00000000 },
+  { 0x123Fu, 0.00000000 },
+  { 0x1240u, 0.00000000 },
+  { 0x1241u, 0.00000000 },
+  { 0x1242u, 0.00000000 },
+  { 0x1243u, 0.00000000 },
+  { 0x1244u, 0.00000000 },
+  { 0x1245u, 0.00000000 },
+  { 0x1246u, 0.00000000 },
+  { 0x1247u, 0.00000000 },
+  { 0x1248u, 0.00000000 },
+  { 0x124Au, 0.00000000 },
+  { 0x124Bu, 0.00000000 },
+  { 0x124Cu, 0.00000000 },
+  { 0x124Du, 0.00000000 },
+  { 0x1250u, 0.00000000 },
+  { 0x1251u, 0.00000000 },
+  { 0x1252u, 0.00000000 },
+  { 0x1253u, 0.00000000 },
+  { 0x1254u, 0.00000000 },
+  { 0x1255u, 0.00000000 },
+  { 0x1256u, 0.00000000 },
+  { 0x1258u, 0.00000000 },
+  { 0x125Au, 0.00000000 },
+  { 0x125Bu, 0.00000000 },
+  { 0x125Cu, 0.00000000 },
+  { 0x125Du, 0.00000000 },
+  { 0x1260u, 0.00000000 },
+  { 0x1261u, 0.00000000 },
+  { 0x1262u, 0.00000000 },
+  { 0x1263u, 0.00000000 },
+  { 0x1264u, 0.00000000 },
+  { 0x1265u, 0.00000000 },
+  { 0x1266u, 0.00000000 },
+  { 0x1267u, 0.00000000 },
+  { 0x1268u, 0.00000000 },
+  { 0x1269u, 0.00000000 },
+  { 0x126Au, 0.00000000 },
+  { 0x126Bu, 0.00000000 },
+  { 0x126Cu, 0.00000000 },
+  { 0x126Du, 0.00000000 },
+  { 0x126Eu, 0.00000000 },
+  { 0x126Fu, 0.00000000 },
+  { 0x1270u, 0.00000000 },
+  { 0x1271u, 0.00000000 },
+  { 0x1272u, 0.00000000 },
+  { 0x1273u, 0.00000000 },
+  { 0x1274u, 0.00000000 },
+  { 0x1275u, 0.00000000 },
+  { 0x1276u, 0.00000000 },
+  { 0x1277u, 0.00000000 },
+  { 0x1278u, 0.00000000 },
+  { 0x1279u, 0.00000000 },
+  { 0x127Au, 0.00000000 },
+  { 0x127Bu, 0.00000000 },
+  { 0x127Cu, 0.00000000 },
+  { 0x127Du, 0.00000000 },
+  { 0x127Eu, 0.00000000 },
+  { 0x127Fu, 0.00000000 },
+  { 0x1280u, 0.00000000 },
+  { 0x1281u, 0.00000000 },
+  { 0x1282u, 0.00000000 },
+  { 0x1283u, 0.00000000 },
+  { 0x1284u, 0.00000000 },
+  { 0x1285u, 0.00000000 },
+  { 0x1286u, 0.00000000 },
+  { 0x1287u, 0.00000000 },
+  { 0x1288u, 0.00000000 },
+  { 0x128Au, 0.00000000 },
+  { 0x128Bu, 0.00000000 },
+  { 0x128Cu, 0.00000000 },
+  { 0x128Du, 0.00000000 },
+  { 0x1290u, 0.00000000 },
+  { 0x1291u, 0.00000000 },
+  { 0x1292u, 0.00000000 },
+  { 0x1293u, 0.00000000 },
+  { 0x1294u, 0.00000000 },
+  { 0x1295u, 0.00000000 },
+  { 0x1296u, 0.00000000 },
+  { 0x1297u, 0.00000000 },
+  { 0x1298u, 0.00000000 },
+  { 0x1299u, 0.00000000 },
+  { 0x129Au, 0.00000000 },
+  { 0x129Bu, 0.00000000 },
+  { 0x129Cu, 0.00000000 },
+  { 0x129Du, 0.00000000 },
+  { 0x129Eu, 0.00000000 },
+  { 0x129Fu, 0.00000000 },
+  { 0x12A0u, 0.00000000 },
+  { 0x12A1u, 0.00000000 },
+  { 0x12A2u, 0.00000000 },
+  { 0x12A3u, 0.00000000 },
+  { 0x12A4u, 0.00000000 },
+  { 0x12A5u, 0.00000000 },
+  { 0x12A6u, 0.00000000 },
+  { 0x12A7u, 0.00000000 },
+  { 0x12A8u, 0.00000000 },
+  { 0x12A9u, 0.00000000 },
+  { 0x12AAu, 0.00000000 },
+  { 0x12ABu, 0.00000000 },
+  { 0x12ACu, 0.00000000 },
+  { 0x12ADu, 0.00000000 },
+  { 0x12AEu, 0.00000000 },
+  { 0x12AFu, 0.00000000 },
+  { 0x12B0u, 0.00000000 },
+  { 0x12B2u, 0.00000000 },
+  { 0x12B3u, 0.00000000 },
+  { 0x12B4u, 0.00000000 },
+  { 0x12B5u, 0.00000000 },
+  { 0x12B8u, 0.00000000 },
+  { 0x12B9u, 0.00000000 },
+  { 0x12BAu, 0.00000000 },
+  { 0x12BBu, 0.00000000 },
+  { 0x12BCu, 0.00000000 },
+  { 0x12BDu, 0.00000000 },
+  { 0x12BEu, 0.00000000 },
+  { 0x12C0u, 0.00000000 },
+  { 0x12C2u, 0.00000000 },
+  { 0x12C3u, 0.00000000 },
+  { 0x12C4u, 0.00000000 },
+  { 0x12C5u, 0.00000000 },
+  { 0x12C8u, 0.00000000 },
+  { 0x12C9u, 0.00000000 },
+  { 0x12CAu, 0.00000000 },
+  { 0x12CBu, 0.00000000 },
+  { 0x12CCu, 0.00000000 },
+  { 0x12CDu, 0.00000000 },
+  { 0x12CEu, 0.00000000 },
+  { 0x12CFu, 0.00000000 },
+  { 0x12D0u, 0.00000000 },
+  { 0x12D1u, 0.00000000 },
+  { 0x12D2u, 0.00000000 },
+  { 0x12D3u, 0.00000000 },
+  { 0x12D4u, 0.00000000 },
+  { 0x12D5u, 0.00000000 },
+  { 0x12D6u, 0.00000000 },
+  { 0x12D8u, 0.00000000 },
+  { 0x12D9u, 0.00000000 },
+  { 0x12DAu, 0.00000000 },
+  { 0x12DBu, 0.00000000 },
+  { 0x12DCu, 0.00000000 },
+  { 0x12DDu, 0.00000000 },
+  { 0x12DEu, 0.00000000 },
+  { 0x12DFu, 0.00000000 },
+  { 0x12E0u, 0.00000000 },
+  { 0x12E1u, 0.00000000 },
+  { 0x12E2u, 0.00000000 },
+  { 0x12E3u, 0.00000000 },
+  { 0x12E4u, 0.00000000 },
+  { 0x12E5u, 0.00000000 },
+  { 0x12E6u, 0.00000000 },
+  { 0x12E7u, 0.00000000 },
+  { 0x12E8u, 0.00000000 },
+  { 0x12E9u, 0.00000000 },
+  { 0x12EAu, 0.00000000 },
+  { 0x12EBu, 0.00000000 },
+  { 0x12ECu, 0.00000000 },
+  { 0x12EDu, 0.00000000 },
+  { 0x12EEu, 0.00000000 },
+  { 0x12EFu, 0.00000000 },
+  { 0x12F0u, 0.00000000 },
+  { 0x12F1u, 0.00000000 },
+  { 0x12F2u, 0.00000000 },
+  { 0x12F3u, 0.00000000 },
+  { 0x12F4u, 0.00000000 },
+  { 0x12F5u, 0.00000000 },
+  { 0x12F6u, 0.00000000 },
+  { 0x12F7u, 0.00000000 },
+  { 0x12F8u, 0.00000000 },
+  { 0x12F9u, 0.00000000 },
+  { 0x12FAu, 0.00000000 },
+  { 0x12FBu, 0.00000000 },
+  { 0x12FCu, 0.00000000 },
+  { 0x12FDu, 0.00000000 },
+  { 0x12FEu, 0.00000000 },
+  { 0x12FFu, 0.00000000 },
+  { 0x1300u, 0.00000000 },
+  { 0x1301u, 0.00000000 },
+  { 0x1302u, 0.00000000 },
+  { 0x1303u, 0.00000000 },
+  { 0x1304u, 0.00000000 },
+  { 0x1305u, 0.00000000 },
+  { 0x1306u, 0.00000000 },
+  { 0x1307u, 0.00000000 },
+  { 0x1308u, 0.00000000 },
+  { 0x1309u, 0.00000000 },
+  { 0x130Au, 0.00000000 },
+  { 0x130Bu, 0.00000000 },
+  { 0x130Cu, 0.00000000 },
+  { 0x130Du, 0.00000000 },
+  { 0x130Eu, 0.00000000 },
+  { 0x130Fu, 0.00000000 },
+  { 0x1310u, 0.00000000 },
+  { 0x1312u, 0.00000000 },
+  { 0x1313u, 0.00000000 },
+  { 0x1314u, 0.00000000 },
+  { 0x1315u, 0.00000000 },
+  { 0x1318u, 0.00000000 },
+  { 0x1319u, 0.00000000 },
+  { 0x131Au, 0.00000000 },
+  { 0x131Bu, 0.00000000 },
+  { 0x131Cu, 0.00000000 },
+  { 0x131Du, 0.00000000 },
+  { 0x131Eu, 0.00000000 },
+  { 0x131Fu, 0.00000000 },
+  { 0x1320u, 0.00000000 },
+  { 0x1321u, 0.00000000 },
+  { 0x1322u, 0.00000000 },
+  { 0x1323u, 0.00000000 },
+  { 0x1324u, 0.00000000 },
+  { 0x1325u, 0.00000000 },
+  { 0x1326u, 0.00000000 },
+  { 0x1327u, 0.00000000 },
+  { 0x1328u, 0.00000000 },
+  { 0x1329u, 0.00000000 },
+  { 0x132Au, 0.00000000 },
+  { 0x132Bu, 0.00000000 },
+  { 0x132Cu, 0.00000000 },
+  { 0x132Du, 0.00000000 },
+  { 0x132Eu, 0.00000000 },
+  { 0x132Fu, 0.00000000 },
+  { 0x1330u, 0.00000000 },
+  { 0x1331u, 0.00000000 },
+  { 0x1332u, 0.00000000 },
+  { 0x1333u, 0.00000000 },
+  { 0x1334u, 0.00000000 },
+  { 0x1335u, 0.00000000 },
+  { 0x1336u, 0.00000000 },
+  { 0x1337u, 0.00000000 },
+  { 0x1338u, 0.00000000 },
+  { 0x1339u, 0.00000000 },
+  { 0x133Au, 0.00000000 },
+  { 0x133Bu, 0.00000000 },
+  { 0x133Cu, 0.00000000 },
+  { 0x133Du, 0.00000000 },
+  { 0x133Eu, 0.00000000 },
+  { 0x133Fu, 0.00000000 },
+  { 0x1340u, 0.00000000 },
+  { 0x1341u, 0.00000000 },
+  { 0x1342u, 0.00000000 },
+  { 0x1343u, 0.00000000 },
+  { 0x1344u, 0.00000000 },
+  { 0x1345u, 0.00000000 },
+  { 0x1346u, 0.00000000 },
+  { 0x1347u, 0.00000000 },
+  { 0x1348u, 0.00000000 },
+  { 0x1349u, 0.00000000 },
+  { 0x134Au, 0.00000000 },
+  { 0x134Bu, 0.00000000 },
+  { 0x134Cu, 0.00000000 },
+  { 0x134Du, 0.00000000 },
+  { 0x134Eu, 0.00000000 },
+  { 0x134Fu, 0.00000000 },
+  { 0x1350u, 0.00000000 },
+  { 0x1351u, 0.00000000 },
+  { 0x1352u, 0.00000000 },
+  { 0x1353u, 0.00000000 },
+  { 0x1354u, 0.00000000 },
+  { 0x1355u, 0.00000000 },
+  { 0x1356u, 0.00000000 },
+  { 0x1357u, 0.00000000 },
+  { 0x1358u, 0.00000000 },
+  { 0x1359u, 0.00000000 },
+  { 0x135Au, 0.00000000 },
+  { 0x1380u, 0.00000000 },
+  { 0x1381u, 0.00000000 },
+  { 0x1382u, 0.00000000 },
+  { 0x1383u, 0.00000000 },
+  { 0x1384u, 0.00000000 },
+  { 0x1385u, 0.00000000 },
+  { 0x1386u, 0.00000000 },
+  { 0x1387u, 0.00000000 },
+  { 0x1388u, 0.00000000 },
+  { 0x1389u, 0.00000000 },
+  { 0x138Au, 0.00000000 },
+  { 0x138Bu, 0.00000000 },
+  { 0x138Cu, 0.00000000 },
+  { 0x138Du, 0.00000000 },
+  { 0x138Eu, 0.00000000 },
+  { 0x138Fu, 0.00000000 },
+  { 0x2D80u, 0.00000000 },
+  { 0x2D81u, 0.00000000 },
+  { 0x2D82u, 0.00000000 },
+  { 0x2D83u, 0.00000000 },
+  { 0x2D84u, 0.00000000 },
+  { 0x2D85u, 0.00000000 },
+  { 0x2D86u, 0.00000000 },
+  { 0x2D87u, 0.00000000 },
+  { 0x2D88u, 0.00000000 },
+  { 0x2D89u, 0.00000000 },
+  { 0x2D8Au, 0.00000000 },
+  { 0x2D8Bu, 0.00000000 },
+  { 0x2D8Cu, 0.00000000 },
+  { 0x2D8Du, 0.00000000 },
+  { 0x2D8Eu, 0.00000000 },
+  { 0x2D8Fu, 0.00000000 },
+  { 0x2D90u, 0.00000000 },
+  { 0x2D91u, 0.00000000 },
+  { 0x2D92u, 0.00000000 },
+  { 0x2D93u, 0.00000000 },
+  { 0x2D94u, 0.00000000 },
+  { 0x2D95u, 0.00000000 },
+  { 0x2D96u, 0.00000000 },
+  { 0x2DA0u, 0.00000000 },
+  { 0x2DA1u, 0.00000000 },
+  { 0x2DA2u, 0.00000000 },
+  { 0x2DA3u, 0.00000000 },
+  { 0x2DA4u, 0.00000000 },
+  { 0x2DA5u, 0.00000000 },
+  { 0x2DA6u, 0.00000000 },
+  { 0x2DA8u, 0.00000000 },
+  { 0x2DA9u, 0.00000000 },
+  { 0x2DAAu, 0.00000000 },
+  { 0x2DABu, 0.00000000 },
+  { 0x2DACu, 0.00000000 },
+  { 0x2DADu, 0.00000000 },
+  { 0x2DAEu, 0.00000000 },
+  { 0x2DB0u, 0.00000000 },
+  { 0x2DB1u, 0.00000000 },
+  { 0x2DB2u, 0.00000000 },
+  { 0x2DB3u, 0.00000000 },
+  { 0x2DB4u, 0.00000000 },
+  { 0x2DB5u, 0.00000000 },
+  { 0x2DB6u, 0.00000000 },
+  { 0x2DB8u, 0.00000000 },
+  { 0x2DB9u, 0.00000000 },
+  { 0x2DBAu, 0.00000000 },
+  { 0x2DBBu, 0.00000000 },
+  { 0x2DBCu, 0.00000000 },
+  { 0x2DBDu, 0.00000000 },
+  { 0x2DBEu, 0.00000000 },
+  { 0x2DC0u, 0.00000000 },
+  { 0x2DC1u, 0.00000000 },
+  { 0x2DC2u, 0.00000000 },
+  { 0x2DC3u, 0.00000000 },
+  { 0x2DC4u, 0.00000000 },
+  { 0x2DC5u, 0.00000000 },
+  { 0x2DC6u, 0.00000000 },
+  { 0x2DC8u, 0.00000000 },
+  { 0x2DC9u, 0.00000000 },
+  { 0x2DCAu, 0.00000000 },
+  { 0x2DCBu, 0.00000000 },
+  { 0x2DCCu, 0.00000000 },
+  { 0x2DCDu, 0.00000000 },
+  { 0x2DCEu, 0.00000000 },
+  { 0x2DD0u, 0.00000000 },
+  { 0x2DD1u, 0.00000000 },
+  { 0x2DD2u, 0.00000000 },
+  { 0x2DD3u, 0.00000000 },
+  { 0x2DD4u, 0.00000000 },
+  { 0x2DD5u, 0.00000000 },
+  { 0x2DD6u, 0.00000000 },
+  { 0x2DD8u, 0.00000000 },
+  { 0x2DD9u, 0.00000000 },
+  { 0x2DDAu, 0.00000000 },
+  { 0x2DDBu, 0.00000000 },
+  { 0x2DDCu, 0.00000000 },
+  { 0x2DDDu, 0.00000000 },
+  { 0x2DDEu, 0.00000000 },
+};
+
@@ -0,0 +1,145 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_295_UPPER[] = {
+  "A",
+  "B",
+  "Ç",
+  "D",
+  "E",
+  "Ä",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "Ž",
+  "K",
+  "L",
+  "M",
+  "N",
+  "Ň",
+  "O",
+  "Ö",
+  "P",
+  "R",
+  "S",
+  "Ş",
+  "T",
+  "U",
+  "Ü",
+  "W",
+  "Y",
+  "Ý",
+  "Z",
+};
+const char *ALPHA_295_LOWER[] = {
+  "a",
+  "b",
+  "ç",
+  "d",
+  "e",
+  "ä",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "ž",
+  "k",
+  "l",
+  "m",
+  "n",
+  "ň",
+  "o",
+  "ö",
+  "p",
+  "r",
+  "s",
+  "ş",
+  "t",
+  "u",
+  "ü",
+  "w",
+  "y",
+  "ý",
+  "z",
+};
+const char *ALPHA_295_DIGITS[] = {
+};
+const uint32_t ALPHA_295_UPPER_CPS[] = {
+  65, 66, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 82,
+  83, 84, 85, 87, 89, 90, 196, 199, 214, 220, 221, 327, 350, 381,
+};
+const uint32_t ALPHA_295_LOWER_CPS[] = {
+  97, 98, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 114,
+  115, 116, 117, 119, 121, 122, 228, 231, 246, 252, 253, 328, 351, 382,
+};
+const uint32_t ALPHA_295_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_295_FREQ[] = {
+  { "a", 0.12110000 },
+  { "b", 0.02400000 },
+  { "ç", 0.00980000 },
+  { "d", 0.04970000 },
+  { "e", 0.07820000 },
+  { "ä", 0.00930000 },
+  { "f", 0.00200000 },
+  { "g", 0.03220000 },
+  { "h", 0.01310000 },
+  { "i", 0.07450000 },
+  { "j", 0.00640000 },
+  { "ž", 0.00020000 },
+  { "k", 0.03080000 },
+  { "l", 0.06960000 },
+  { "m", 0.03070000 },
+  { "n", 0.06550000 },
+  { "ň", 0.01690000 },
+  { "o", 0.02540000 },
+  { "ö", 0.01140000 },
+  { "p", 0.01730000 },
+  { "r", 0.07420000 },
+  { "s", 0.02840000 },
+  { "ş", 0.01640000 },
+  { "t", 0.03230000 },
+  { "u", 0.02240000 },
+  { "ü", 0.01320000 },
+  { "w", 0.01200000 },
+  { "y", 0.06770000 },
+  { "ý", 0.03360000 },
+  { "z", 0.01180000 },
+};
+
+const wa_cp_freq ALPHA_295_FREQ_CPS[] = {
+  { 0x61u, 0.12110000 },
+  { 0x62u, 0.02400000 },
+  { 0x64u, 0.04970000 },
+  { 0x65u, 0.07820000 },
+  { 0x66u, 0.00200000 },
+  { 0x67u, 0.03220000 },
+  { 0x68u, 0.01310000 },
+  { 0x69u, 0.07450000 },
+  { 0x6Au, 0.00640000 },
+  { 0x6Bu, 0.03080000 },
+  { 0x6Cu, 0.06960000 },
+  { 0x6Du, 0.03070000 },
+  { 0x6Eu, 0.06550000 },
+  { 0x6Fu, 0.02540000 },
+  { 0x70u, 0.01730000 },
+  { 0x72u, 0.07420000 },
+  { 0x73u, 0.02840000 },
+  { 0x74u, 0.03230000 },
+  { 0x75u, 0.02240000 },
+  { 0x77u, 0.01200000 },
+  { 0x79u, 0.06770000 },
+  { 0x7Au, 0.01180000 },
+  { 0xE4u, 0.00930000 },
+  { 0xE7u, 0.00980000 },
+  { 0xF6u, 0.01140000 },
+  { 0xFCu, 0.01320000 },
+  { 0xFDu, 0.03360000 },
+  { 0x148u, 0.01690000 },
+  { 0x15Fu, 0.01640000 },
+  { 0x17Eu, 0.00020000 },
+};
+
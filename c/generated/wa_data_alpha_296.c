@@ -0,0 +1,105 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_296_UPPER[] = {
+  "ᜀ",
+  "ᜁ",
+  "ᜂ",
+  "ᜃ",
+  "ᜄ",
+  "ᜅ",
+  "ᜆ",
+  "ᜇ",
+  "ᜈ",
+  "ᜉ",
+  "ᜊ",
+  "ᜋ",
+  "ᜌ",
+  "ᜎ",
+  "ᜏ",
+  "ᜐ",
+  "ᜑ",
+  "ᜒ",
+  "ᜓ",
+  "᜔",
+};
+const char *ALPHA_296_LOWER[] = {
+  "ᜀ",
+  "ᜁ",
+  "ᜂ",
+  "ᜃ",
+  "ᜄ",
+  "ᜅ",
+  "ᜆ",
+  "ᜇ",
+  "ᜈ",
+  "ᜉ",
+  "ᜊ",
+  "ᜋ",
+  "ᜌ",
+  "ᜎ",
+  "ᜏ",
+  "ᜐ",
+  "ᜑ",
+  "ᜒ",
+  "ᜓ",
+  "᜔",
+};
+const char *ALPHA_296_DIGITS[] = {
+};
+const uint32_t ALPHA_296_UPPER_CPS[] = {
+  5888, 5889, 5890, 5891, 5892, 5893, 5894, 5895, 5896, 5897, 5898, 5899, 5900, 5902, 5903, 5904,
+  5905, 5906, 5907, 5908,
+};
+const uint32_t ALPHA_296_LOWER_CPS[] = {
+  5888, 5889, 5890, 5891, 5892, 5893, 5894, 5895, 5896, 5897, 5898, 5899, 5900, 5902, 5903, 5904,
+  5905, 5906, 5907, 5908,
+};
+const uint32_t ALPHA_296_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_296_FREQ[] = {
+  { "ᜀ", 0.00000000 },
+  { "ᜁ", 0.00000000 },
+  { "ᜂ", 0.00000000 },
+  { "ᜃ", 0.00000000 },
+  { "ᜄ", 0.00000000 },
+  { "ᜅ", 0.00000000 },
+  { "ᜆ", 0.00000000 },
+  { "ᜇ", 0.00000000 },
+  { "ᜈ", 0.00000000 },
+  { "ᜉ", 0.00000000 },
+  { "ᜊ", 0.00000000 },
+  { "ᜋ", 0.00000000 },
+  { "ᜌ", 0.00000000 },
+  { "ᜎ", 0.00000000 },
+  { "ᜏ", 0.00000000 },
+  { "ᜐ", 0.00000000 },
+  { "ᜑ", 0.00000000 },
+  { "ᜒ", 0.00000000 },
+  { "ᜓ", 0.00000000 },
+  { "᜔", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_296_FREQ_CPS[] = {
+  { 0x1700u, 0.00000000 },
+  { 0x1701u, 0.00000000 },
+  { 0x1702u, 0.00000000 },
+  { 0x1703u, 0.00000000 },
+  { 0x1704u, 0.00000000 },
+  { 0x1705u, 0.00000000 },
+  { 0x1706u, 0.00000000 },
+  { 0x1707u, 0.00000000 },
+  { 0x1708u, 0.00000000 },
+  { 0x1709u, 0.00000000 },
+  { 0x170Au, 0.00000000 },
+  { 0x170Bu, 0.00000000 },
+  { 0x170Cu, 0.00000000 },
+  { 0x170Eu, 0.00000000 },
+  { 0x170Fu, 0.00000000 },
+  { 0x1710u, 0.00000000 },
+  { 0x1711u, 0.00000000 },
+  { 0x1712u, 0.00000000 },
+  { 0x1713u, 0.00000000 },
+  { 0x1714u, 0.00000000 },
+};
+
@@ -0,0 +1,117 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_297_UPPER[] = {
+  "A",
+  "B",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "R",
+  "S",
+  "T",
+  "U",
+  "W",
+  "Y",
+  "Ê",
+  "Ô",
+};
+const char *ALPHA_297_LOWER[] = {
+  "a",
+  "b",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "r",
+  "s",
+  "t",
+  "u",
+  "w",
+  "y",
+  "ê",
+  "ô",
+};
+const char *ALPHA_297_DIGITS[] = {
+};
+const uint32_t ALPHA_297_UPPER_CPS[] = {
+  65, 66, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 82,
+  83, 84, 85, 87, 89, 202, 212,
+};
+const uint32_t ALPHA_297_LOWER_CPS[] = {
+  97, 98, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 114,
+  115, 116, 117, 119, 121, 234, 244,
+};
+const uint32_t ALPHA_297_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_297_FREQ[] = {
+  { "a", 0.16330000 },
+  { "b", 0.03760000 },
+  { "d", 0.02190000 },
+  { "e", 0.12140000 },
+  { "f", 0.01050000 },
+  { "g", 0.05580000 },
+  { "h", 0.02450000 },
+  { "i", 0.04680000 },
+  { "j", 0.00410000 },
+  { "k", 0.03670000 },
+  { "l", 0.06730000 },
+  { "m", 0.03900000 },
+  { "n", 0.05790000 },
+  { "o", 0.10730000 },
+  { "p", 0.01510000 },
+  { "r", 0.02460000 },
+  { "s", 0.05450000 },
+  { "t", 0.06100000 },
+  { "u", 0.01010000 },
+  { "w", 0.02840000 },
+  { "y", 0.01220000 },
+  { "ê", 0.00000000 },
+  { "ô", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_297_FREQ_CPS[] = {
+  { 0x61u, 0.16330000 },
+  { 0x62u, 0.03760000 },
+  { 0x64u, 0.02190000 },
+  { 0x65u, 0.12140000 },
+  { 0x66u, 0.01050000 },
+  { 0x67u, 0.05580000 },
+  { 0x68u, 0.02450000 },
+  { 0x69u, 0.04680000 },
+  { 0x6Au, 0.00410000 },
+  { 0x6Bu, 0.03670000 },
+  { 0x6Cu, 0.06730000 },
+  { 0x6Du, 0.03900000 },
+  { 0x6Eu, 0.05790000 },
+  { 0x6Fu, 0.10730000 },
+  { 0x70u, 0.01510000 },
+  { 0x72u, 0.02460000 },
+  { 0x73u, 0.05450000 },
+  { 0x74u, 0.06100000 },
+  { 0x75u, 0.01010000 },
+  { 0x77u, 0.02840000 },
+  { 0x79u, 0.01220000 },
+  { 0xEAu, 0.00000000 },
+  { 0xF4u, 0.00000000 },
+};
+
@@ -0,0 +1,133 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_298_UPPER[] = {
+  "A",
+  "E",
+  "F",
+  "H",
+  "I",
+  "K",
+  "L",
+  "M",
+  "N",
+  "G",
+  "O",
+  "P",
+  "S",
+  "T",
+  "U",
+  "V",
+  "Á",
+  "É",
+  "Í",
+  "Ó",
+  "Ú",
+  "Ā",
+  "Ē",
+  "Ī",
+  "Ō",
+  "Ū",
+  "ʻ",
+};
+const char *ALPHA_298_LOWER[] = {
+  "a",
+  "e",
+  "f",
+  "h",
+  "i",
+  "k",
+  "l",
+  "m",
+  "n",
+  "g",
+  "o",
+  "p",
+  "s",
+  "t",
+  "u",
+  "v",
+  "á",
+  "é",
+  "í",
+  "ó",
+  "ú",
+  "ā",
+  "ē",
+  "ī",
+  "ō",
+  "ū",
+  "ʻ",
+};
+const char *ALPHA_298_DIGITS[] = {
+};
+const uint32_t ALPHA_298_UPPER_CPS[] = {
+  65, 69, 70, 71, 72, 73, 75, 76, 77, 78, 79, 80, 83, 84, 85, 86,
+  193, 201, 205, 211, 218, 256, 274, 298, 332, 362, 699,
+};
+const uint32_t ALPHA_298_LOWER_CPS[] = {
+  97, 101, 102, 103, 104, 105, 107, 108, 109, 110, 111, 112, 115, 116, 117, 118,
+  225, 233, 237, 243, 250, 257, 275, 299, 333, 363, 699,
+};
+const uint32_t ALPHA_298_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_298_FREQ[] = {
+  { "a", 0.15390000 },
+  { "e", 0.10110000 },
+  { "f", 0.02730000 },
+  { "h", 0.05110000 },
+  { "i", 0.09600000 },
+  { "k", 0.06040000 },
+  { "l", 0.03810000 },
+  { "m", 0.02900000 },
+  { "n", 0.05930000 },
+  { "g", 0.02310000 },
+  { "o", 0.10210000 },
+  { "p", 0.02060000 },
+  { "s", 0.02520000 },
+  { "t", 0.06140000 },
+  { "u", 0.06370000 },
+  { "v", 0.00910000 },
+  { "á", 0.00090000 },
+  { "é", 0.00000000 },
+  { "í", 0.00020000 },
+  { "ó", 0.00010000 },
+  { "ú", 0.00020000 },
+  { "ā", 0.00610000 },
+  { "ē", 0.00260000 },
+  { "ī", 0.00050000 },
+  { "ō", 0.00120000 },
+  { "ū", 0.00040000 },
+  { "ʻ", 0.06610000 },
+};
+
+const wa_cp_freq ALPHA_298_FREQ_CPS[] = {
+  { 0x61u, 0.15390000 },
+  { 0x65u, 0.10110000 },
+  { 0x66u, 0.02730000 },
+  { 0x67u, 0.02310000 },
+  { 0x68u, 0.05110000 },
+  { 0x69u, 0.09600000 },
+  { 0x6Bu, 0.06040000 },
+  { 0x6Cu, 0.03810000 },
+  { 0x6Du, 0.02900000 },
+  { 0x6Eu, 0.05930000 },
+  { 0x6Fu, 0.10210000 },
+  { 0x70u, 0.02060000 },
+  { 0x73u, 0.02520000 },
+  { 0x74u, 0.06140000 },
+  { 0x75u, 0.06370000 },
+  { 0x76u, 0.00910000 },
+  { 0xE1u, 0.00090000 },
+  { 0xE9u, 0.00000000 },
+  { 0xEDu, 0.00020000 },
+  { 0xF3u, 0.00010000 },
+  { 0xFAu, 0.00020000 },
+  { 0x101u, 0.00610000 },
+  { 0x113u, 0.00260000 },
+  { 0x12Bu, 0.00050000 },
+  { 0x14Du, 0.00120000 },
+  { 0x16Bu, 0.00040000 },
+  { 0x2BBu, 0.06610000 },
+};
+
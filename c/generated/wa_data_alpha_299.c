@@ -0,0 +1,163 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_299_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "X",
+  "Y",
+  "Z",
+  "Á",
+  "Í",
+  "Ñ",
+  "Ó",
+  "Ý",
+  "Ÿ",
+  "Ỹ",
+};
+const char *ALPHA_299_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "x",
+  "y",
+  "z",
+  "á",
+  "í",
+  "ñ",
+  "ó",
+  "ý",
+  "ÿ",
+  "ỹ",
+};
+const char *ALPHA_299_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_299_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 88, 89, 90, 193, 205, 209, 211, 221, 376, 7928,
+};
+const uint32_t ALPHA_299_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 120, 121, 122, 225, 237, 241, 243, 253, 255, 7929,
+};
+const uint32_t ALPHA_299_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_299_FREQ[] = {
+  { "d", 0.00700000 },
+  { "a", 0.23880000 },
+  { "n", 0.06230000 },
+  { "c", 0.05170000 },
+  { "h", 0.03110000 },
+  { "e", 0.07790000 },
+  { "r", 0.00730000 },
+  { "o", 0.06180000 },
+  { "u", 0.04930000 },
+  { "s", 0.02800000 },
+  { "q", 0.04740000 },
+  { "t", 0.06030000 },
+  { "l", 0.03870000 },
+  { "i", 0.08920000 },
+  { "m", 0.02200000 },
+  { "ý", 0.00830000 },
+  { "y", 0.00930000 },
+  { "x", 0.04220000 },
+  { "g", 0.02250000 },
+  { "j", 0.00180000 },
+  { "ñ", 0.01390000 },
+  { "p", 0.02300000 },
+  { "v", 0.00380000 },
+  { "b", 0.00050000 },
+  { "z", 0.00030000 },
+  { "ÿ", 0.00030000 },
+  { "f", 0.00020000 },
+  { "í", 0.00020000 },
+  { "ó", 0.00020000 },
+  { "ỹ", 0.00030000 },
+  { "k", 0.00020000 },
+  { "á", 0.00020000 },
+};
+
+const wa_cp_freq ALPHA_299_FREQ_CPS[] = {
+  { 0x61u, 0.23880000 },
+  { 0x62u, 0.00050000 },
+  { 0x63u, 0.05170000 },
+  { 0x64u, 0.00700000 },
+  { 0x65u, 0.07790000 },
+  { 0x66u, 0.00020000 },
+  { 0x67u, 0.02250000 },
+  { 0x68u, 0.03110000 },
+  { 0x69u, 0.08920000 },
+  { 0x6Au, 0.00180000 },
+  { 0x6Bu, 0.00020000 },
+  { 0x6Cu, 0.03870000 },
+  { 0x6Du, 0.02200000 },
+  { 0x6Eu, 0.06230000 },
+  { 0x6Fu, 0.06180000 },
+  { 0x70u, 0.02300000 },
+  { 0x71u, 0.04740000 },
+  { 0x72u, 0.00730000 },
+  { 0x73u, 0.02800000 },
+  { 0x74u, 0.06030000 },
+  { 0x75u, 0.04930000 },
+  { 0x76u, 0.00380000 },
+  { 0x78u, 0.04220000 },
+  { 0x79u, 0.00930000 },
+  { 0x7Au, 0.00030000 },
+  { 0xE1u, 0.00020000 },
+  { 0xEDu, 0.00020000 },
+  { 0xF1u, 0.01390000 },
+  { 0xF3u, 0.00020000 },
+  { 0xFDu, 0.00830000 },
+  { 0xFFu, 0.00030000 },
+  { 0x1EF9u, 0.00030000 },
+};
+
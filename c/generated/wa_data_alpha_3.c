@@ -0,0 +1,185 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_3_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+  "Á",
+  "Â",
+  "È",
+  "É",
+  "Ê",
+  "Ë",
+  "Î",
+  "Ï",
+  "Ô",
+  "Ö",
+  "Û",
+};
+const char *ALPHA_3_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+  "á",
+  "â",
+  "è",
+  "é",
+  "ê",
+  "ë",
+  "î",
+  "ï",
+  "ô",
+  "ö",
+  "û",
+};
+const char *ALPHA_3_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_3_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 193, 194, 200, 201, 202, 203,
+  206, 207, 212, 214, 219,
+};
+const uint32_t ALPHA_3_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 225, 226, 232, 233, 234, 235,
+  238, 239, 244, 246, 251,
+};
+const uint32_t ALPHA_3_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_3_FREQ[] = {
+  { "a", 0.08200000 },
+  { "b", 0.01650000 },
+  { "c", 0.00350000 },
+  { "d", 0.05770000 },
+  { "e", 0.17150000 },
+  { "f", 0.00850000 },
+  { "g", 0.03350000 },
+  { "h", 0.01660000 },
+  { "i", 0.08770000 },
+  { "j", 0.00300000 },
+  { "k", 0.03110000 },
+  { "l", 0.03970000 },
+  { "m", 0.02300000 },
+  { "n", 0.08160000 },
+  { "o", 0.05950000 },
+  { "p", 0.01640000 },
+  { "q", 0.00010000 },
+  { "r", 0.06650000 },
+  { "s", 0.06740000 },
+  { "t", 0.05680000 },
+  { "u", 0.02230000 },
+  { "v", 0.02310000 },
+  { "w", 0.01790000 },
+  { "x", 0.00030000 },
+  { "y", 0.00980000 },
+  { "z", 0.00070000 },
+  { "á", 0.00020000 },
+  { "â", 0.00000000 },
+  { "è", 0.00000000 },
+  { "é", 0.00040000 },
+  { "ê", 0.00080000 },
+  { "ë", 0.00160000 },
+  { "î", 0.00000000 },
+  { "ï", 0.00020000 },
+  { "ô", 0.00000000 },
+  { "ö", 0.00010000 },
+  { "û", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_3_FREQ_CPS[] = {
+  { 0x61u, 0.08200000 },
+  { 0x62u, 0.01650000 },
+  { 0x63u, 0.00350000 },
+  { 0x64u, 0.05770000 },
+  { 0x65u, 0.17150000 },
+  { 0x66u, 0.00850000 },
+  { 0x67u, 0.03350000 },
+  { 0x68u, 0.01660000 },
+  { 0x69u, 0.08770000 },
+  { 0x6Au, 0.00300000 },
+  { 0x6Bu, 0.03110000 },
+  { 0x6Cu, 0.03970000 },
+  { 0x6Du, 0.02300000 },
+  { 0x6Eu, 0.08160000 },
+  { 0x6Fu, 0.05950000 },
+  { 0x70u, 0.01640000 },
+  { 0x71u, 0.00010000 },
+  { 0x72u, 0.06650000 },
+  { 0x73u, 0.06740000 },
+  { 0x74u, 0.05680000 },
+  { 0x75u, 0.02230000 },
+  { 0x76u, 0.02310000 },
+  { 0x77u, 0.01790000 },
+  { 0x78u, 0.00030000 },
+  { 0x79u, 0.00980000 },
+  { 0x7Au, 0.00070000 },
+  { 0xE1u, 0.00020000 },
+  { 0xE2u, 0.00000000 },
+  { 0xE8u, 0.00000000 },
+  { 0xE9u, 0.00040000 },
+  { 0xEAu, 0.00080000 },
+  { 0xEBu, 0.00160000 },
+  { 0xEEu, 0.00000000 },
+  { 0xEFu, 0.00020000 },
+  { 0xF4u, 0.00000000 },
+  { 0xF6u, 0.00010000 },
+  { 0xFBu, 0.00000000 },
+};
+
@@ -0,0 +1,163 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_30_UPPER[] = {
+  "क",
+  "ख",
+  "ग",
+  "घ",
+  "च",
+  "छ",
+  "ज",
+  "झ",
+  "ञ",
+  "ट",
+  "ठ",
+  "ड",
+  "ढ",
+  "ण",
+  "त",
+  "थ",
+  "द",
+  "ध",
+  "न",
+  "प",
+  "फ",
+  "ब",
+  "भ",
+  "म",
+  "य",
+  "र",
+  "ल",
+  "व",
+  "श",
+  "ष",
+  "स",
+  "ह",
+};
+const char *ALPHA_30_LOWER[] = {
+  "क",
+  "ख",
+  "ग",
+  "घ",
+  "च",
+  "छ",
+  "ज",
+  "झ",
+  "ञ",
+  "ट",
+  "ठ",
+  "ड",
+  "ढ",
+  "ण",
+  "त",
+  "थ",
+  "द",
+  "ध",
+  "न",
+  "प",
+  "फ",
+  "ब",
+  "भ",
+  "म",
+  "य",
+  "र",
+  "ल",
+  "व",
+  "श",
+  "ष",
+  "स",
+  "ह",
+};
+const char *ALPHA_30_DIGITS[] = {
+  "०",
+  "१",
+  "२",
+  "३",
+  "४",
+  "५",
+  "६",
+  "७",
+  "८",
+  "९",
+};
+const uint32_t ALPHA_30_UPPER_CPS[] = {
+  2325, 2326, 2327, 2328, 2330, 2331, 2332, 2333, 2334, 2335, 2336, 2337, 2338, 2339, 2340, 2341,
+  2342, 2343, 2344, 2346, 2347, 2348, 2349, 2350, 2351, 2352, 2354, 2357, 2358, 2359, 2360, 2361,
+};
+const uint32_t ALPHA_30_LOWER_CPS[] = {
+  2325, 2326, 2327, 2328, 2330, 2331, 2332, 2333, 2334, 2335, 2336, 2337, 2338, 2339, 2340, 2341,
+  2342, 2343, 2344, 2346, 2347, 2348, 2349, 2350, 2351, 2352, 2354, 2357, 2358, 2359, 2360, 2361,
+};
+const uint32_t ALPHA_30_DIGITS_CPS[] = {
+  2406, 2407, 2408, 2409, 2410, 2411, 2412, 2413, 2414, 2415,
+};
+const wa_freq_entry ALPHA_30_FREQ[] = {
+  { "क", 0.00000000 },
+  { "ख", 0.00000000 },
+  { "ग", 0.00000000 },
+  { "घ", 0.00000000 },
+  { "च", 0.00000000 },
+  { "छ", 0.00000000 },
+  { "ज", 0.00000000 },
+  { "झ", 0.00000000 },
+  { "ञ", 0.00000000 },
+  { "ट", 0.00000000 },
+  { "ठ", 0.00000000 },
+  { "ड", 0.00000000 },
+  { "ढ", 0.00000000 },
+  { "ण", 0.00000000 },
+  { "त", 0.00000000 },
+  { "थ", 0.00000000 },
+  { "द", 0.00000000 },
+  { "ध", 0.00000000 },
+  { "न", 0.00000000 },
+  { "प", 0.00000000 },
+  { "फ", 0.00000000 },
+  { "ब", 0.00000000 },
+  { "भ", 0.00000000 },
+  { "म", 0.00000000 },
+  { "य", 0.00000000 },
+  { "र", 0.00000000 },
+  { "ल", 0.00000000 },
+  { "व", 0.00000000 },
+  { "श", 0.00000000 },
+  { "ष", 0.00000000 },
+  { "स", 0.00000000 },
+  { "ह", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_30_FREQ_CPS[] = {
+  { 0x915u, 0.00000000 },
+  { 0x916u, 0.00000000 },
+  { 0x917u, 0.00000000 },
+  { 0x918u, 0.00000000 },
+  { 0x91Au, 0.00000000 },
+  { 0x91Bu, 0.00000000 },
+  { 0x91Cu, 0.00000000 },
+  { 0x91Du, 0.00000000 },
+  { 0x91Eu, 0.00000000 },
+  { 0x91Fu, 0.00000000 },
+  { 0x920u, 0.00000000 },
+  { 0x921u, 0.00000000 },
+  { 0x922u, 0.00000000 },
+  { 0x923u, 0.00000000 },
+  { 0x924u, 0.00000000 },
+  { 0x925u, 0.00000000 },
+  { 0x926u, 0.00000000 },
+  { 0x927u, 0.00000000 },
+  { 0x928u, 0.00000000 },
+  { 0x92Au, 0.00000000 },
+  { 0x92Bu, 0.00000000 },
+  { 0x92Cu, 0.00000000 },
+  { 0x92Du, 0.00000000 },
+  { 0x92Eu, 0.00000000 },
+  { 0x92Fu, 0.00000000 },
+  { 0x930u, 0.00000000 },
+  { 0x932u, 0.00000000 },
+  { 0x935u, 0.00000000 },
+  { 0x936u, 0.00000000 },
+  { 0x937u, 0.00000000 },
+  { 0x938u, 0.00000000 },
+  { 0x939u, 0.00000000 },
+};
+
@@ -0,0 +1,88 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_300_UPPER[] = {
+  "A",
+  "E",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "S",
+  "T",
+  "U",
+  "W",
+};
+const char *ALPHA_300_LOWER[] = {
+  "a",
+  "e",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "s",
+  "t",
+  "u",
+  "w",
+};
+const char *ALPHA_300_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_300_UPPER_CPS[] = {
+  65, 69, 73, 74, 75, 76, 77, 78, 79, 80, 83, 84, 85, 87,
+};
+const uint32_t ALPHA_300_LOWER_CPS[] = {
+  97, 101, 105, 106, 107, 108, 109, 110, 111, 112, 115, 116, 117, 119,
+};
+const uint32_t ALPHA_300_DIGITS_CPS[] = {
+  48, 49, 50, 51, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_300_FREQ[] = {
+  { "a", 0.17065945 },
+  { "e", 0.07828756 },
+  { "i", 0.14291106 },
+  { "j", 0.02084490 },
+  { "k", 0.04523184 },
+  { "l", 0.10761031 },
+  { "m", 0.04561850 },
+  { "n", 0.12083932 },
+  { "o", 0.07618471 },
+  { "p", 0.04346026 },
+  { "s", 0.04294877 },
+  { "t", 0.04589364 },
+  { "u", 0.03214168 },
+  { "w", 0.02736800 },
+};
+
+const wa_cp_freq ALPHA_300_FREQ_CPS[] = {
+  { 0x61u, 0.17065945 },
+  { 0x65u, 0.07828756 },
+  { 0x69u, 0.14291106 },
+  { 0x6Au, 0.02084490 },
+  { 0x6Bu, 0.04523184 },
+  { 0x6Cu, 0.10761031 },
+  { 0x6Du, 0.04561850 },
+  { 0x6Eu, 0.12083932 },
+  { 0x6Fu, 0.07618471 },
+  { 0x70u, 0.04346026 },
+  { 0x73u, 0.04294877 },
+  { 0x74u, 0.04589364 },
+  { 0x75u, 0.03214168 },
+  { 0x77u, 0.02736800 },
+};
+
@@ -0,0 +1,163 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_301_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+  "Á",
+  "É",
+  "Í",
+  "Ñ",
+  "Ó",
+  "Ú",
+};
+const char *ALPHA_301_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+  "á",
+  "é",
+  "í",
+  "ñ",
+  "ó",
+  "ú",
+};
+const char *ALPHA_301_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_301_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 193, 201, 205, 209, 211, 218,
+};
+const uint32_t ALPHA_301_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 225, 233, 237, 241, 243, 250,
+};
+const uint32_t ALPHA_301_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_301_FREQ[] = {
+  { "a", 0.23030000 },
+  { "m", 0.03330000 },
+  { "c", 0.01980000 },
+  { "h", 0.02840000 },
+  { "i", 0.08410000 },
+  { "n", 0.09990000 },
+  { "k", 0.09840000 },
+  { "u", 0.05200000 },
+  { "e", 0.01260000 },
+  { "s", 0.03380000 },
+  { "t", 0.08580000 },
+  { "l", 0.06100000 },
+  { "x", 0.02240000 },
+  { "y", 0.01380000 },
+  { "o", 0.01320000 },
+  { "w", 0.03510000 },
+  { "p", 0.02140000 },
+  { "r", 0.00530000 },
+  { "q", 0.00050000 },
+  { "g", 0.02840000 },
+  { "á", 0.00500000 },
+  { "j", 0.00870000 },
+  { "d", 0.00080000 },
+  { "b", 0.00080000 },
+  { "í", 0.00260000 },
+  { "ú", 0.00120000 },
+  { "ñ", 0.00020000 },
+  { "f", 0.00020000 },
+  { "é", 0.00030000 },
+  { "z", 0.00050000 },
+  { "v", 0.00030000 },
+  { "ó", 0.00020000 },
+};
+
+const wa_cp_freq ALPHA_301_FREQ_CPS[] = {
+  { 0x61u, 0.23030000 },
+  { 0x62u, 0.00080000 },
+  { 0x63u, 0.01980000 },
+  { 0x64u, 0.00080000 },
+  { 0x65u, 0.01260000 },
+  { 0x66u, 0.00020000 },
+  { 0x67u, 0.02840000 },
+  { 0x68u, 0.02840000 },
+  { 0x69u, 0.08410000 },
+  { 0x6Au, 0.00870000 },
+  { 0x6Bu, 0.09840000 },
+  { 0x6Cu, 0.06100000 },
+  { 0x6Du, 0.03330000 },
+  { 0x6Eu, 0.09990000 },
+  { 0x6Fu, 0.01320000 },
+  { 0x70u, 0.02140000 },
+  { 0x71u, 0.00050000 },
+  { 0x72u, 0.00530000 },
+  { 0x73u, 0.03380000 },
+  { 0x74u, 0.08580000 },
+  { 0x75u, 0.05200000 },
+  { 0x76u, 0.00030000 },
+  { 0x77u, 0.03510000 },
+  { 0x78u, 0.02240000 },
+  { 0x79u, 0.01380000 },
+  { 0x7Au, 0.00050000 },
+  { 0xE1u, 0.00500000 },
+  { 0xE9u, 0.00030000 },
+  { 0xEDu, 0.00260000 },
+  { 0xF1u, 0.00020000 },
+  { 0xF3u, 0.00020000 },
+  { 0xFAu, 0.00120000 },
+};
+
@@ -0,0 +1,119 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_302_UPPER[] = {
+  "A",
+  "B",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "R",
+  "S",
+  "T",
+  "U",
+  "W",
+  "Y",
+};
+const char *ALPHA_302_LOWER[] = {
+  "a",
+  "b",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "r",
+  "s",
+  "t",
+  "u",
+  "w",
+  "y",
+};
+const char *ALPHA_302_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_302_UPPER_CPS[] = {
+  65, 66, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 82,
+  83, 84, 85, 87, 89,
+};
+const uint32_t ALPHA_302_LOWER_CPS[] = {
+  97, 98, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 114,
+  115, 116, 117, 119, 121,
+};
+const uint32_t ALPHA_302_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_302_FREQ[] = {
+  { "a", 0.12130000 },
+  { "b", 0.02190000 },
+  { "d", 0.01410000 },
+  { "e", 0.08050000 },
+  { "f", 0.00520000 },
+  { "g", 0.04420000 },
+  { "h", 0.01060000 },
+  { "i", 0.11670000 },
+  { "j", 0.00220000 },
+  { "k", 0.02790000 },
+  { "l", 0.08270000 },
+  { "m", 0.04440000 },
+  { "n", 0.11360000 },
+  { "o", 0.07700000 },
+  { "p", 0.04260000 },
+  { "r", 0.03640000 },
+  { "s", 0.05500000 },
+  { "t", 0.05730000 },
+  { "u", 0.02560000 },
+  { "w", 0.01340000 },
+  { "y", 0.00740000 },
+};
+
+const wa_cp_freq ALPHA_302_FREQ_CPS[] = {
+  { 0x61u, 0.12130000 },
+  { 0x62u, 0.02190000 },
+  { 0x64u, 0.01410000 },
+  { 0x65u, 0.08050000 },
+  { 0x66u, 0.00520000 },
+  { 0x67u, 0.04420000 },
+  { 0x68u, 0.01060000 },
+  { 0x69u, 0.11670000 },
+  { 0x6Au, 0.00220000 },
+  { 0x6Bu, 0.02790000 },
+  { 0x6Cu, 0.08270000 },
+  { 0x6Du, 0.04440000 },
+  { 0x6Eu, 0.11360000 },
+  { 0x6Fu, 0.07700000 },
+  { 0x70u, 0.04260000 },
+  { 0x72u, 0.03640000 },
+  { 0x73u, 0.05500000 },
+  { 0x74u, 0.05730000 },
+  { 0x75u, 0.02560000 },
+  { 0x77u, 0.01340000 },
+  { 0x79u, 0.00740000 },
+};
+
@@ -0,0 +1,144 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_303_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "Ç",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "Ö",
+  "P",
+  "R",
+  "S",
+  "Ş",
+  "T",
+  "U",
+  "Ü",
+  "V",
+  "Y",
+  "Z",
+  "İ",
+  "Ğ",
+};
+const char *ALPHA_303_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "ç",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "ı",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "ö",
+  "p",
+  "r",
+  "s",
+  "ş",
+  "t",
+  "u",
+  "ü",
+  "v",
+  "y",
+  "z",
+  "i̇",
+  "ğ",
+};
+const char *ALPHA_303_DIGITS[] = {
+};
+const uint32_t ALPHA_303_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  82, 83, 84, 85, 86, 89, 90, 199, 214, 220, 286, 304, 350,
+};
+const uint32_t ALPHA_303_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  114, 115, 116, 117, 118, 121, 122, 231, 246, 252, 287, 305, 351,
+};
+const uint32_t ALPHA_303_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_303_FREQ[] = {
+  { "a", 0.11800000 },
+  { "b", 0.02170000 },
+  { "c", 0.00990000 },
+  { "ç", 0.00950000 },
+  { "d", 0.04290000 },
+  { "e", 0.09120000 },
+  { "f", 0.00670000 },
+  { "g", 0.01250000 },
+  { "h", 0.01100000 },
+  { "i", 0.08590000 },
+  { "ı", 0.04630000 },
+  { "j", 0.00120000 },
+  { "k", 0.04630000 },
+  { "l", 0.07010000 },
+  { "m", 0.03400000 },
+  { "n", 0.07370000 },
+  { "o", 0.02760000 },
+  { "ö", 0.00890000 },
+  { "p", 0.00990000 },
+  { "r", 0.07210000 },
+  { "s", 0.03460000 },
+  { "ş", 0.01500000 },
+  { "t", 0.03960000 },
+  { "u", 0.03020000 },
+  { "ü", 0.01740000 },
+  { "v", 0.01280000 },
+  { "y", 0.03080000 },
+  { "z", 0.01110000 },
+  { "i̇", 0.00000000 },
+  { "ğ", 0.00910000 },
+};
+
+const wa_cp_freq ALPHA_303_FREQ_CPS[] = {
+  { 0x61u, 0.11800000 },
+  { 0x62u, 0.02170000 },
+  { 0x63u, 0.00990000 },
+  { 0x64u, 0.04290000 },
+  { 0x65u, 0.09120000 },
+  { 0x66u, 0.00670000 },
+  { 0x67u, 0.01250000 },
+  { 0x68u, 0.01100000 },
+  { 0x69u, 0.08590000 },
+  { 0x6Au, 0.00120000 },
+  { 0x6Bu, 0.04630000 },
+  { 0x6Cu, 0.07010000 },
+  { 0x6Du, 0.03400000 },
+  { 0x6Eu, 0.07370000 },
+  { 0x6Fu, 0.02760000 },
+  { 0x70u, 0.00990000 },
+  { 0x72u, 0.07210000 },
+  { 0x73u, 0.03460000 },
+  { 0x74u, 0.03960000 },
+  { 0x75u, 0.03020000 },
+  { 0x76u, 0.01280000 },
+  { 0x79u, 0.03080000 },
+  { 0x7Au, 0.01110000 },
+  { 0xE7u, 0.00950000 },
+  { 0xF6u, 0.00890000 },
+  { 0xFCu, 0.01740000 },
+  { 0x11Fu, 0.00910000 },
+  { 0x131u, 0.04630000 },
+  { 0x15Fu, 0.01500000 },
+};
+
@@ -0,0 +1,129 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_304_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+};
+const char *ALPHA_304_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+};
+const char *ALPHA_304_DIGITS[] = {
+};
+const uint32_t ALPHA_304_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90,
+};
+const uint32_t ALPHA_304_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122,
+};
+const uint32_t ALPHA_304_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_304_FREQ[] = {
+  { "a", 0.16850000 },
+  { "b", 0.01550000 },
+  { "c", 0.00540000 },
+  { "d", 0.01530000 },
+  { "e", 0.07160000 },
+  { "f", 0.00990000 },
+  { "g", 0.02190000 },
+  { "h", 0.04270000 },
+  { "i", 0.10150000 },
+  { "j", 0.00100000 },
+  { "k", 0.05520000 },
+  { "l", 0.05300000 },
+  { "m", 0.04120000 },
+  { "n", 0.07820000 },
+  { "o", 0.04710000 },
+  { "p", 0.00780000 },
+  { "q", 0.00050000 },
+  { "r", 0.03270000 },
+  { "s", 0.02970000 },
+  { "t", 0.03230000 },
+  { "u", 0.06140000 },
+  { "v", 0.02270000 },
+  { "w", 0.04000000 },
+  { "x", 0.01150000 },
+  { "y", 0.02260000 },
+  { "z", 0.01060000 },
+};
+
+const wa_cp_freq ALPHA_304_FREQ_CPS[] = {
+  { 0x61u, 0.16850000 },
+  { 0x62u, 0.01550000 },
+  { 0x63u, 0.00540000 },
+  { 0x64u, 0.01530000 },
+  { 0x65u, 0.07160000 },
+  { 0x66u, 0.00990000 },
+  { 0x67u, 0.02190000 },
+  { 0x68u, 0.04270000 },
+  { 0x69u, 0.10150000 },
+  { 0x6Au, 0.00100000 },
+  { 0x6Bu, 0.05520000 },
+  { 0x6Cu, 0.05300000 },
+  { 0x6Du, 0.04120000 },
+  { 0x6Eu, 0.07820000 },
+  { 0x6Fu, 0.04710000 },
+  { 0x70u, 0.00780000 },
+  { 0x71u, 0.00050000 },
+  { 0x72u, 0.03270000 },
+  { 0x73u, 0.02970000 },
+  { 0x74u, 0.03230000 },
+  { 0x75u, 0.06140000 },
+  { 0x76u, 0.02270000 },
+  { 0x77u, 0.04000000 },
+  { 0x78u, 0.01150000 },
+  { 0x79u, 0.02260000 },
+  { 0x7Au, 0.01060000 },
+};
+
@@ -0,0 +1,183 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_305_UPPER[] = {
+  "А",
+  "Ә",
+  "Б",
+  "В",
+  "Г",
+  "Д",
+  "Е",
+  "Ё",
+  "Ж",
+  "Җ",
+  "З",
+  "И",
+  "Й",
+  "К",
+  "Л",
+  "М",
+  "Н",
+  "Ң",
+  "О",
+  "Ө",
+  "П",
+  "Р",
+  "С",
+  "Т",
+  "У",
+  "Ү",
+  "Ф",
+  "Х",
+  "Һ",
+  "Ц",
+  "Ч",
+  "Ш",
+  "Щ",
+  "Ъ",
+  "Ы",
+  "Ь",
+  "Э",
+  "Ю",
+  "Я",
+};
+const char *ALPHA_305_LOWER[] = {
+  "а",
+  "ә",
+  "б",
+  "в",
+  "г",
+  "д",
+  "е",
+  "ё",
+  "ж",
+  "җ",
+  "з",
+  "и",
+  "й",
+  "к",
+  "л",
+  "м",
+  "н",
+  "ң",
+  "о",
+  "ө",
+  "п",
+  "р",
+  "с",
+  "т",
+  "у",
+  "ү",
+  "ф",
+  "х",
+  "һ",
+  "ц",
+  "ч",
+  "ш",
+  "щ",
+  "ъ",
+  "ы",
+  "ь",
+  "э",
+  "ю",
+  "я",
+};
+const char *ALPHA_305_DIGITS[] = {
+};
+const uint32_t ALPHA_305_UPPER_CPS[] = {
+  1025, 1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053, 1054,
+  1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069, 1070,
+  1071, 1174, 1186, 1198, 1210, 1240, 1256,
+};
+const uint32_t ALPHA_305_LOWER_CPS[] = {
+  1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080, 1081, 1082, 1083, 1084, 1085, 1086, 1087,
+  1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103,
+  1105, 1175, 1187, 1199, 1211, 1241, 1257,
+};
+const uint32_t ALPHA_305_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_305_FREQ[] = {
+  { "а", 0.11900000 },
+  { "ә", 0.05440000 },
+  { "б", 0.02410000 },
+  { "в", 0.01180000 },
+  { "г", 0.02680000 },
+  { "д", 0.02800000 },
+  { "е", 0.07150000 },
+  { "ё", 0.00070000 },
+  { "ж", 0.00070000 },
+  { "җ", 0.00380000 },
+  { "з", 0.01120000 },
+  { "и", 0.04480000 },
+  { "й", 0.01020000 },
+  { "к", 0.05340000 },
+  { "л", 0.06760000 },
+  { "м", 0.02950000 },
+  { "н", 0.07530000 },
+  { "ң", 0.01080000 },
+  { "о", 0.02310000 },
+  { "ө", 0.00820000 },
+  { "п", 0.01330000 },
+  { "р", 0.06370000 },
+  { "с", 0.03150000 },
+  { "т", 0.05350000 },
+  { "у", 0.02550000 },
+  { "ү", 0.00910000 },
+  { "ф", 0.00480000 },
+  { "х", 0.00590000 },
+  { "һ", 0.00510000 },
+  { "ц", 0.00220000 },
+  { "ч", 0.01480000 },
+  { "ш", 0.01690000 },
+  { "щ", 0.00010000 },
+  { "ъ", 0.00180000 },
+  { "ы", 0.05570000 },
+  { "ь", 0.00490000 },
+  { "э", 0.00250000 },
+  { "ю", 0.00150000 },
+  { "я", 0.01220000 },
+};
+
+const wa_cp_freq ALPHA_305_FREQ_CPS[] = {
+  { 0x430u, 0.11900000 },
+  { 0x431u, 0.02410000 },
+  { 0x432u, 0.01180000 },
+  { 0x433u, 0.02680000 },
+  { 0x434u, 0.02800000 },
+  { 0x435u, 0.07150000 },
+  { 0x436u, 0.00070000 },
+  { 0x437u, 0.01120000 },
+  { 0x438u, 0.04480000 },
+  { 0x439u, 0.01020000 },
+  { 0x43Au, 0.05340000 },
+  { 0x43Bu, 0.06760000 },
+  { 0x43Cu, 0.02950000 },
+  { 0x43Du, 0.07530000 },
+  { 0x43Eu, 0.02310000 },
+  { 0x43Fu, 0.01330000 },
+  { 0x440u, 0.06370000 },
+  { 0x441u, 0.03150000 },
+  { 0x442u, 0.05350000 },
+  { 0x443u, 0.02550000 },
+  { 0x444u, 0.00480000 },
+  { 0x445u, 0.00590000 },
+  { 0x446u, 0.00220000 },
+  { 0x447u, 0.01480000 },
+  { 0x448u, 0.01690000 },
+  { 0x449u, 0.00010000 },
+  { 0x44Au, 0.00180000 },
+  { 0x44Bu, 0.05570000 },
+  { 0x44Cu, 0.00490000 },
+  { 0x44Du, 0.00250000 },
+  { 0x44Eu, 0.00150000 },
+  { 0x44Fu, 0.01220000 },
+  { 0x451u, 0.00070000 },
+  { 0x497u, 0.00380000 },
+  { 0x4A3u, 0.01080000 },
+  { 0x4AFu, 0.00910000 },
+  { 0x4BBu, 0.00510000 },
+  { 0x4D9u, 0.05440000 },
+  { 0x4E9u, 0.00820000 },
+};
+
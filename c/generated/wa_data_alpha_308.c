@@ -0,0 +1,181 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_308_UPPER[] = {
+  "А",
+  "Б",
+  "В",
+  "Г",
+  "Д",
+  "Е",
+  "Ё",
+  "Ж",
+  "З",
+  "И",
+  "Й",
+  "К",
+  "Л",
+  "М",
+  "Н",
+  "Ң",
+  "О",
+  "Ө",
+  "П",
+  "Р",
+  "С",
+  "Т",
+  "У",
+  "Ү",
+  "Ф",
+  "Х",
+  "Ц",
+  "Ч",
+  "Ш",
+  "Щ",
+  "Ъ",
+  "Ы",
+  "Ь",
+  "Э",
+  "Ю",
+  "Я",
+};
+const char *ALPHA_308_LOWER[] = {
+  "а",
+  "б",
+  "в",
+  "г",
+  "д",
+  "е",
+  "ё",
+  "ж",
+  "з",
+  "и",
+  "й",
+  "к",
+  "л",
+  "м",
+  "н",
+  "ң",
+  "о",
+  "ө",
+  "п",
+  "р",
+  "с",
+  "т",
+  "у",
+  "ү",
+  "ф",
+  "х",
+  "ц",
+  "ч",
+  "ш",
+  "щ",
+  "ъ",
+  "ы",
+  "ь",
+  "э",
+  "ю",
+  "я",
+};
+const char *ALPHA_308_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_308_UPPER_CPS[] = {
+  1025, 1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053, 1054,
+  1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069, 1070,
+  1071, 1186, 1198, 1256,
+};
+const uint32_t ALPHA_308_LOWER_CPS[] = {
+  1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080, 1081, 1082, 1083, 1084, 1085, 1086, 1087,
+  1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103,
+  1105, 1187, 1199, 1257,
+};
+const uint32_t ALPHA_308_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_308_FREQ[] = {
+  { "а", 0.00000000 },
+  { "б", 0.00000000 },
+  { "в", 0.00000000 },
+  { "г", 0.00000000 },
+  { "д", 0.00000000 },
+  { "е", 0.00000000 },
+  { "ё", 0.00000000 },
+  { "ж", 0.00000000 },
+  { "з", 0.00000000 },
+  { "и", 0.00000000 },
+  { "й", 0.00000000 },
+  { "к", 0.00000000 },
+  { "л", 0.00000000 },
+  { "м", 0.00000000 },
+  { "н", 0.00000000 },
+  { "ң", 0.00000000 },
+  { "о", 0.00000000 },
+  { "ө", 0.00000000 },
+  { "п", 0.00000000 },
+  { "р", 0.00000000 },
+  { "с", 0.00000000 },
+  { "т", 0.00000000 },
+  { "у", 0.00000000 },
+  { "ү", 0.00000000 },
+  { "ф", 0.00000000 },
+  { "х", 0.00000000 },
+  { "ц", 0.00000000 },
+  { "ч", 0.00000000 },
+  { "ш", 0.00000000 },
+  { "щ", 0.00000000 },
+  { "ъ", 0.00000000 },
+  { "ы", 0.00000000 },
+  { "ь", 0.00000000 },
+  { "э", 0.00000000 },
+  { "ю", 0.00000000 },
+  { "я", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_308_FREQ_CPS[] = {
+  { 0x430u, 0.00000000 },
+  { 0x431u, 0.00000000 },
+  { 0x432u, 0.00000000 },
+  { 0x433u, 0.00000000 },
+  { 0x434u, 0.00000000 },
+  { 0x435u, 0.00000000 },
+  { 0x436u, 0.00000000 },
+  { 0x437u, 0.00000000 },
+  { 0x438u, 0.00000000 },
+  { 0x439u, 0.00000000 },
+  { 0x43Au, 0.00000000 },
+  { 0x43Bu, 0.00000000 },
+  { 0x43Cu, 0.00000000 },
+  { 0x43Du, 0.00000000 },
+  { 0x43Eu, 0.00000000 },
+  { 0x43Fu, 0.00000000 },
+  { 0x440u, 0.00000000 },
+  { 0x441u, 0.00000000 },
+  { 0x442u, 0.00000000 },
+  { 0x443u, 0.00000000 },
+  { 0x444u, 0.00000000 },
+  { 0x445u, 0.00000000 },
+  { 0x446u, 0.00000000 },
+  { 0x447u, 0.00000000 },
+  { 0x448u, 0.00000000 },
+  { 0x449u, 0.00000000 },
+  { 0x44Au, 0.00000000 },
+  { 0x44Bu, 0.00000000 },
+  { 0x44Cu, 0.00000000 },
+  { 0x44Du, 0.00000000 },
+  { 0x44Eu, 0.00000000 },
+  { 0x44Fu, 0.00000000 },
+  { 0x451u, 0.00000000 },
+  { 0x4A3u, 0.00000000 },
+  { 0x4AFu, 0.00000000 },
+  { 0x4E9u, 0.00000000 },
+};
+
@@ -0,0 +1,105 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_31_UPPER[] = {
+  "ᝀ",
+  "ᝁ",
+  "ᝂ",
+  "ᝃ",
+  "ᝄ",
+  "ᝅ",
+  "ᝆ",
+  "ᝇ",
+  "ᝈ",
+  "ᝉ",
+  "ᝊ",
+  "ᝋ",
+  "ᝌ",
+  "ᝍ",
+  "ᝎ",
+  "ᝏ",
+  "ᝐ",
+  "ᝑ",
+  "ᝒ",
+  "ᝓ",
+};
+const char *ALPHA_31_LOWER[] = {
+  "ᝀ",
+  "ᝁ",
+  "ᝂ",
+  "ᝃ",
+  "ᝄ",
+  "ᝅ",
+  "ᝆ",
+  "ᝇ",
+  "ᝈ",
+  "ᝉ",
+  "ᝊ",
+  "ᝋ",
+  "ᝌ",
+  "ᝍ",
+  "ᝎ",
+  "ᝏ",
+  "ᝐ",
+  "ᝑ",
+  "ᝒ",
+  "ᝓ",
+};
+const char *ALPHA_31_DIGITS[] = {
+};
+const uint32_t ALPHA_31_UPPER_CPS[] = {
+  5952, 5953, 5954, 5955, 5956, 5957, 5958, 5959, 5960, 5961, 5962, 5963, 5964, 5965, 5966, 5967,
+  5968, 5969, 5970, 5971,
+};
+const uint32_t ALPHA_31_LOWER_CPS[] = {
+  5952, 5953, 5954, 5955, 5956, 5957, 5958, 5959, 5960, 5961, 5962, 5963, 5964, 5965, 5966, 5967,
+  5968, 5969, 5970, 5971,
+};
+const uint32_t ALPHA_31_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_31_FREQ[] = {
+  { "ᝀ", 0.00000000 },
+  { "ᝁ", 0.00000000 },
+  { "ᝂ", 0.00000000 },
+  { "ᝃ", 0.00000000 },
+  { "ᝄ", 0.00000000 },
+  { "ᝅ", 0.00000000 },
+  { "ᝆ", 0.00000000 },
+  { "ᝇ", 0.00000000 },
+  { "ᝈ", 0.00000000 },
+  { "ᝉ", 0.00000000 },
+  { "ᝊ", 0.00000000 },
+  { "ᝋ", 0.00000000 },
+  { "ᝌ", 0.00000000 },
+  { "ᝍ", 0.00000000 },
+  { "ᝎ", 0.00000000 },
+  { "ᝏ", 0.00000000 },
+  { "ᝐ", 0.00000000 },
+  { "ᝑ", 0.00000000 },
+  { "ᝒ", 0.00000000 },
+  { "ᝓ", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_31_FREQ_CPS[] = {
+  { 0x1740u, 0.00000000 },
+  { 0x1741u, 0.00000000 },
+  { 0x1742u, 0.00000000 },
+  { 0x1743u, 0.00000000 },
+  { 0x1744u, 0.00000000 },
+  { 0x1745u, 0.00000000 },
+  { 0x1746u, 0.00000000 },
+  { 0x1747u, 0.00000000 },
+  { 0x1748u, 0.00000000 },
+  { 0x1749u, 0.00000000 },
+  { 0x174Au, 0.00000000 },
+  { 0x174Bu, 0.00000000 },
+  { 0x174Cu, 0.00000000 },
+  { 0x174Du, 0.00000000 },
+  { 0x174Eu, 0.00000000 },
+  { 0x174Fu, 0.00000000 },
+  { 0x1750u, 0.00000000 },
+  { 0x1751u, 0.00000000 },
+  { 0x1752u, 0.00000000 },
+  { 0x1753u, 0.00000000 },
+};
+
@@ -0,0 +1,163 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_310_UPPER[] = {
+  "ه",
+  "ئ",
+  "ا",
+  "ە",
+  "ب",
+  "پ",
+  "ت",
+  "ج",
+  "چ",
+  "خ",
+  "د",
+  "ر",
+  "ز",
+  "ژ",
+  "س",
+  "ش",
+  "غ",
+  "ف",
+  "ق",
+  "ك",
+  "گ",
+  "ڭ",
+  "ل",
+  "م",
+  "ن",
+  "ھ",
+  "و",
+  "ۇ",
+  "ۆ",
+  "ۈ",
+  "ۋ",
+  "ې",
+  "ى",
+  "ي",
+};
+const char *ALPHA_310_LOWER[] = {
+  "ه",
+  "ئ",
+  "ا",
+  "ە",
+  "ب",
+  "پ",
+  "ت",
+  "ج",
+  "چ",
+  "خ",
+  "د",
+  "ر",
+  "ز",
+  "ژ",
+  "س",
+  "ش",
+  "غ",
+  "ف",
+  "ق",
+  "ك",
+  "گ",
+  "ڭ",
+  "ل",
+  "م",
+  "ن",
+  "ھ",
+  "و",
+  "ۇ",
+  "ۆ",
+  "ۈ",
+  "ۋ",
+  "ې",
+  "ى",
+  "ي",
+};
+const char *ALPHA_310_DIGITS[] = {
+};
+const uint32_t ALPHA_310_UPPER_CPS[] = {
+  1574, 1575, 1576, 1578, 1580, 1582, 1583, 1585, 1586, 1587, 1588, 1594, 1601, 1602, 1603, 1604,
+  1605, 1606, 1607, 1608, 1609, 1610, 1662, 1670, 1688, 1709, 1711, 1726, 1734, 1735, 1736, 1739,
+  1744, 1749,
+};
+const uint32_t ALPHA_310_LOWER_CPS[] = {
+  1574, 1575, 1576, 1578, 1580, 1582, 1583, 1585, 1586, 1587, 1588, 1594, 1601, 1602, 1603, 1604,
+  1605, 1606, 1607, 1608, 1609, 1610, 1662, 1670, 1688, 1709, 1711, 1726, 1734, 1735, 1736, 1739,
+  1744, 1749,
+};
+const uint32_t ALPHA_310_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_310_FREQ[] = {
+  { "ه", 0.00000000 },
+  { "ئ", 0.03390000 },
+  { "ا", 0.09140000 },
+  { "ە", 0.06260000 },
+  { "ب", 0.02280000 },
+  { "پ", 0.01750000 },
+  { "ت", 0.04580000 },
+  { "ج", 0.00610000 },
+  { "چ", 0.01090000 },
+  { "خ", 0.00680000 },
+  { "د", 0.03120000 },
+  { "ر", 0.05370000 },
+  { "ز", 0.01110000 },
+  { "ژ", 0.00020000 },
+  { "س", 0.02540000 },
+  { "ش", 0.02080000 },
+  { "غ", 0.01430000 },
+  { "ف", 0.00100000 },
+  { "ق", 0.03410000 },
+  { "ك", 0.02790000 },
+  { "گ", 0.00950000 },
+  { "ڭ", 0.01320000 },
+  { "ل", 0.06470000 },
+  { "م", 0.03200000 },
+  { "ن", 0.05920000 },
+  { "ھ", 0.00970000 },
+  { "و", 0.02100000 },
+  { "ۇ", 0.04040000 },
+  { "ۆ", 0.00630000 },
+  { "ۈ", 0.01050000 },
+  { "ۋ", 0.00990000 },
+  { "ې", 0.01400000 },
+  { "ى", 0.16110000 },
+  { "ي", 0.03110000 },
+};
+
+const wa_cp_freq ALPHA_310_FREQ_CPS[] = {
+  { 0x626u, 0.03390000 },
+  { 0x627u, 0.09140000 },
+  { 0x628u, 0.02280000 },
+  { 0x62Au, 0.04580000 },
+  { 0x62Cu, 0.00610000 },
+  { 0x62Eu, 0.00680000 },
+  { 0x62Fu, 0.03120000 },
+  { 0x631u, 0.05370000 },
+  { 0x632u, 0.01110000 },
+  { 0x633u, 0.02540000 },
+  { 0x634u, 0.02080000 },
+  { 0x63Au, 0.01430000 },
+  { 0x641u, 0.00100000 },
+  { 0x642u, 0.03410000 },
+  { 0x643u, 0.02790000 },
+  { 0x644u, 0.06470000 },
+  { 0x645u, 0.03200000 },
+  { 0x646u, 0.05920000 },
+  { 0x647u, 0.00000000 },
+  { 0x648u, 0.02100000 },
+  { 0x649u, 0.16110000 },
+  { 0x64Au, 0.03110000 },
+  { 0x67Eu, 0.01750000 },
+  { 0x686u, 0.01090000 },
+  { 0x698u, 0.00020000 },
+  { 0x6ADu, 0.01320000 },
+  { 0x6AFu, 0.00950000 },
+  { 0x6BEu, 0.00970000 },
+  { 0x6C6u, 0.00630000 },
+  { 0x6C7u, 0.04040000 },
+  { 0x6C8u, 0.01050000 },
+  { 0x6CBu, 0.00990000 },
+  { 0x6D0u, 0.01400000 },
+  { 0x6D5u, 0.06260000 },
+};
+
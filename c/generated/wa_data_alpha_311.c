@@ -0,0 +1,163 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_311_UPPER[] = {
+  "А",
+  "Б",
+  "В",
+  "Г",
+  "Ґ",
+  "Д",
+  "Е",
+  "Є",
+  "Ж",
+  "З",
+  "И",
+  "І",
+  "Ї",
+  "Й",
+  "К",
+  "Л",
+  "М",
+  "Н",
+  "О",
+  "П",
+  "Р",
+  "С",
+  "Т",
+  "У",
+  "Ф",
+  "Х",
+  "Ц",
+  "Ч",
+  "Ш",
+  "Щ",
+  "Ю",
+  "Я",
+  "ʼ",
+  "Ь",
+};
+const char *ALPHA_311_LOWER[] = {
+  "а",
+  "б",
+  "в",
+  "г",
+  "ґ",
+  "д",
+  "е",
+  "є",
+  "ж",
+  "з",
+  "и",
+  "і",
+  "ї",
+  "й",
+  "к",
+  "л",
+  "м",
+  "н",
+  "о",
+  "п",
+  "р",
+  "с",
+  "т",
+  "у",
+  "ф",
+  "х",
+  "ц",
+  "ч",
+  "ш",
+  "щ",
+  "ю",
+  "я",
+  "ʼ",
+  "ь",
+};
+const char *ALPHA_311_DIGITS[] = {
+};
+const uint32_t ALPHA_311_UPPER_CPS[] = {
+  700, 1028, 1030, 1031, 1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051,
+  1052, 1053, 1054, 1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1068, 1070,
+  1071, 1168,
+};
+const uint32_t ALPHA_311_LOWER_CPS[] = {
+  700, 1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080, 1081, 1082, 1083, 1084, 1085, 1086,
+  1087, 1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097, 1100, 1102, 1103, 1108, 1110,
+  1111, 1169,
+};
+const uint32_t ALPHA_311_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_311_FREQ[] = {
+  { "а", 0.08360000 },
+  { "б", 0.01600000 },
+  { "в", 0.05410000 },
+  { "г", 0.01560000 },
+  { "ґ", 0.00020000 },
+  { "д", 0.03210000 },
+  { "е", 0.04620000 },
+  { "є", 0.00460000 },
+  { "ж", 0.00700000 },
+  { "з", 0.02070000 },
+  { "и", 0.05670000 },
+  { "і", 0.06520000 },
+  { "ї", 0.00820000 },
+  { "й", 0.01230000 },
+  { "к", 0.04090000 },
+  { "л", 0.03750000 },
+  { "м", 0.03030000 },
+  { "н", 0.07300000 },
+  { "о", 0.09340000 },
+  { "п", 0.02810000 },
+  { "р", 0.05550000 },
+  { "с", 0.04500000 },
+  { "т", 0.04790000 },
+  { "у", 0.03530000 },
+  { "ф", 0.00400000 },
+  { "х", 0.01140000 },
+  { "ц", 0.01020000 },
+  { "ч", 0.01200000 },
+  { "ш", 0.00650000 },
+  { "щ", 0.00270000 },
+  { "ю", 0.00700000 },
+  { "я", 0.01880000 },
+  { "ʼ", 0.00000000 },
+  { "ь", 0.01780000 },
+};
+
+const wa_cp_freq ALPHA_311_FREQ_CPS[] = {
+  { 0x2BCu, 0.00000000 },
+  { 0x430u, 0.08360000 },
+  { 0x431u, 0.01600000 },
+  { 0x432u, 0.05410000 },
+  { 0x433u, 0.01560000 },
+  { 0x434u, 0.03210000 },
+  { 0x435u, 0.04620000 },
+  { 0x436u, 0.00700000 },
+  { 0x437u, 0.02070000 },
+  { 0x438u, 0.05670000 },
+  { 0x439u, 0.01230000 },
+  { 0x43Au, 0.04090000 },
+  { 0x43Bu, 0.03750000 },
+  { 0x43Cu, 0.03030000 },
+  { 0x43Du, 0.07300000 },
+  { 0x43Eu, 0.09340000 },
+  { 0x43Fu, 0.02810000 },
+  { 0x440u, 0.05550000 },
+  { 0x441u, 0.04500000 },
+  { 0x442u, 0.04790000 },
+  { 0x443u, 0.03530000 },
+  { 0x444u, 0.00400000 },
+  { 0x445u, 0.01140000 },
+  { 0x446u, 0.01020000 },
+  { 0x447u, 0.01200000 },
+  { 0x448u, 0.00650000 },
+  { 0x449u, 0.00270000 },
+  { 0x44Cu, 0.01780000 },
+  { 0x44Eu, 0.00700000 },
+  { 0x44Fu, 0.01880000 },
+  { 0x454u, 0.00460000 },
+  { 0x456u, 0.06520000 },
+  { 0x457u, 0.00820000 },
+  { 0x491u, 0.00020000 },
+};
+
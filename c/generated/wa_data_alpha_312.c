@@ -0,0 +1,127 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_312_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "G",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "R",
+  "S",
+  "T",
+  "U",
+  "W",
+  "Y",
+  "Ö",
+  "Ŋ",
+  "Ɲ",
+};
+const char *ALPHA_312_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "g",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "r",
+  "s",
+  "t",
+  "u",
+  "w",
+  "y",
+  "ö",
+  "ŋ",
+  "ɲ",
+};
+const char *ALPHA_312_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_312_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 71, 73, 74, 75, 76, 77, 78, 79, 80, 82, 83,
+  84, 85, 87, 89, 214, 330, 413,
+};
+const uint32_t ALPHA_312_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 103, 105, 106, 107, 108, 109, 110, 111, 112, 114, 115,
+  116, 117, 119, 121, 246, 331, 626,
+};
+const uint32_t ALPHA_312_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_312_FREQ[] = {
+  { "n", 0.07930000 },
+  { "a", 0.10210000 },
+  { "k", 0.07180000 },
+  { "o", 0.07520000 },
+  { "l", 0.04290000 },
+  { "i", 0.09860000 },
+  { "y", 0.03820000 },
+  { "ŋ", 0.02720000 },
+  { "u", 0.07620000 },
+  { "t", 0.05180000 },
+  { "d", 0.03960000 },
+  { "e", 0.06510000 },
+  { "j", 0.02360000 },
+  { "b", 0.02720000 },
+  { "p", 0.01400000 },
+  { "r", 0.03680000 },
+  { "g", 0.03030000 },
+  { "m", 0.02500000 },
+  { "s", 0.02340000 },
+  { "ö", 0.03400000 },
+  { "w", 0.01730000 },
+  { "ɲ", 0.00020000 },
+  { "c", 0.00020000 },
+};
+
+const wa_cp_freq ALPHA_312_FREQ_CPS[] = {
+  { 0x61u, 0.10210000 },
+  { 0x62u, 0.02720000 },
+  { 0x63u, 0.00020000 },
+  { 0x64u, 0.03960000 },
+  { 0x65u, 0.06510000 },
+  { 0x67u, 0.03030000 },
+  { 0x69u, 0.09860000 },
+  { 0x6Au, 0.02360000 },
+  { 0x6Bu, 0.07180000 },
+  { 0x6Cu, 0.04290000 },
+  { 0x6Du, 0.02500000 },
+  { 0x6Eu, 0.07930000 },
+  { 0x6Fu, 0.07520000 },
+  { 0x70u, 0.01400000 },
+  { 0x72u, 0.03680000 },
+  { 0x73u, 0.02340000 },
+  { 0x74u, 0.05180000 },
+  { 0x75u, 0.07620000 },
+  { 0x77u, 0.01730000 },
+  { 0x79u, 0.03820000 },
+  { 0xF6u, 0.03400000 },
+  { 0x14Bu, 0.02720000 },
+  { 0x272u, 0.00020000 },
+};
+
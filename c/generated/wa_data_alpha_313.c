@@ -0,0 +1,179 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_313_UPPER[] = {
+  "ا",
+  "ب",
+  "پ",
+  "ت",
+  "ٹ",
+  "ث",
+  "ج",
+  "چ",
+  "ح",
+  "خ",
+  "د",
+  "ڈ",
+  "ذ",
+  "ر",
+  "ڑ",
+  "ز",
+  "ژ",
+  "س",
+  "ش",
+  "ص",
+  "ض",
+  "ط",
+  "ظ",
+  "ع",
+  "غ",
+  "ف",
+  "ق",
+  "ک",
+  "گ",
+  "ل",
+  "م",
+  "ن",
+  "و",
+  "ہ",
+  "ھ",
+  "ء",
+  "ی",
+  "ے",
+};
+const char *ALPHA_313_LOWER[] = {
+  "ا",
+  "ب",
+  "پ",
+  "ت",
+  "ٹ",
+  "ث",
+  "ج",
+  "چ",
+  "ح",
+  "خ",
+  "د",
+  "ڈ",
+  "ذ",
+  "ر",
+  "ڑ",
+  "ز",
+  "ژ",
+  "س",
+  "ش",
+  "ص",
+  "ض",
+  "ط",
+  "ظ",
+  "ع",
+  "غ",
+  "ف",
+  "ق",
+  "ک",
+  "گ",
+  "ل",
+  "م",
+  "ن",
+  "و",
+  "ہ",
+  "ھ",
+  "ء",
+  "ی",
+  "ے",
+};
+const char *ALPHA_313_DIGITS[] = {
+};
+const uint32_t ALPHA_313_UPPER_CPS[] = {
+  1569, 1575, 1576, 1578, 1579, 1580, 1581, 1582, 1583, 1584, 1585, 1586, 1587, 1588, 1589, 1590,
+  1591, 1592, 1593, 1594, 1601, 1602, 1604, 1605, 1606, 1608, 1657, 1662, 1670, 1672, 1681, 1688,
+  1705, 1711, 1726, 1729, 1740, 1746,
+};
+const uint32_t ALPHA_313_LOWER_CPS[] = {
+  1569, 1575, 1576, 1578, 1579, 1580, 1581, 1582, 1583, 1584, 1585, 1586, 1587, 1588, 1589, 1590,
+  1591, 1592, 1593, 1594, 1601, 1602, 1604, 1605, 1606, 1608, 1657, 1662, 1670, 1672, 1681, 1688,
+  1705, 1711, 1726, 1729, 1740, 1746,
+};
+const uint32_t ALPHA_313_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_313_FREQ[] = {
+  { "ش", 0.01040000 },
+  { "ح", 0.01030000 },
+  { "ل", 0.03970000 },
+  { "ٹ", 0.00580000 },
+  { "ض", 0.00280000 },
+  { "گ", 0.01090000 },
+  { "ے", 0.04840000 },
+  { "ژ", 0.00010000 },
+  { "ن", 0.05190000 },
+  { "و", 0.06280000 },
+  { "ق", 0.01230000 },
+  { "ھ", 0.01350000 },
+  { "چ", 0.00490000 },
+  { "ی", 0.10790000 },
+  { "م", 0.05500000 },
+  { "ظ", 0.00230000 },
+  { "ہ", 0.05140000 },
+  { "ڈ", 0.00290000 },
+  { "س", 0.03870000 },
+  { "ص", 0.00700000 },
+  { "ت", 0.04160000 },
+  { "ذ", 0.00150000 },
+  { "غ", 0.00220000 },
+  { "پ", 0.01430000 },
+  { "ط", 0.00570000 },
+  { "خ", 0.00710000 },
+  { "ب", 0.03030000 },
+  { "ر", 0.06820000 },
+  { "ڑ", 0.00230000 },
+  { "ث", 0.00190000 },
+  { "ز", 0.00860000 },
+  { "ع", 0.01580000 },
+  { "ک", 0.06540000 },
+  { "ء", 0.00250000 },
+  { "ف", 0.01070000 },
+  { "ا", 0.13490000 },
+  { "ج", 0.01840000 },
+  { "د", 0.02940000 },
+};
+
+const wa_cp_freq ALPHA_313_FREQ_CPS[] = {
+  { 0x621u, 0.00250000 },
+  { 0x627u, 0.13490000 },
+  { 0x628u, 0.03030000 },
+  { 0x62Au, 0.04160000 },
+  { 0x62Bu, 0.00190000 },
+  { 0x62Cu, 0.01840000 },
+  { 0x62Du, 0.01030000 },
+  { 0x62Eu, 0.00710000 },
+  { 0x62Fu, 0.02940000 },
+  { 0x630u, 0.00150000 },
+  { 0x631u, 0.06820000 },
+  { 0x632u, 0.00860000 },
+  { 0x633u, 0.03870000 },
+  { 0x634u, 0.01040000 },
+  { 0x635u, 0.00700000 },
+  { 0x636u, 0.00280000 },
+  { 0x637u, 0.00570000 },
+  { 0x638u, 0.00230000 },
+  { 0x639u, 0.01580000 },
+  { 0x63Au, 0.00220000 },
+  { 0x641u, 0.01070000 },
+  { 0x642u, 0.01230000 },
+  { 0x644u, 0.03970000 },
+  { 0x645u, 0.05500000 },
+  { 0x646u, 0.05190000 },
+  { 0x648u, 0.06280000 },
+  { 0x679u, 0.00580000 },
+  { 0x67Eu, 0.01430000 },
+  { 0x686u, 0.00490000 },
+  { 0x688u, 0.00290000 },
+  { 0x691u, 0.00230000 },
+  { 0x698u, 0.00010000 },
+  { 0x6A9u, 0.06540000 },
+  { 0x6AFu, 0.01090000 },
+  { 0x6BEu, 0.01350000 },
+  { 0x6C1u, 0.05140000 },
+  { 0x6CCu, 0.10790000 },
+  { 0x6D2u, 0.04840000 },
+};
+
@@ -0,0 +1,159 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_314_UPPER[] = {
+  "А",
+  "Б",
+  "В",
+  "Г",
+  "Д",
+  "Е",
+  "Ж",
+  "З",
+  "И",
+  "Й",
+  "К",
+  "Л",
+  "М",
+  "Н",
+  "О",
+  "П",
+  "Р",
+  "С",
+  "Т",
+  "У",
+  "Ф",
+  "Х",
+  "Ч",
+  "Ш",
+  "Ъ",
+  "Э",
+  "Ю",
+  "Я",
+  "Ё",
+  "Ў",
+  "Ғ",
+  "Қ",
+  "Ҳ",
+};
+const char *ALPHA_314_LOWER[] = {
+  "а",
+  "б",
+  "в",
+  "г",
+  "д",
+  "е",
+  "ж",
+  "з",
+  "и",
+  "й",
+  "к",
+  "л",
+  "м",
+  "н",
+  "о",
+  "п",
+  "р",
+  "с",
+  "т",
+  "у",
+  "ф",
+  "х",
+  "ч",
+  "ш",
+  "ъ",
+  "э",
+  "ю",
+  "я",
+  "ё",
+  "ў",
+  "ғ",
+  "қ",
+  "ҳ",
+};
+const char *ALPHA_314_DIGITS[] = {
+};
+const uint32_t ALPHA_314_UPPER_CPS[] = {
+  1025, 1038, 1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053,
+  1054, 1055, 1056, 1057, 1058, 1059, 1060, 1061, 1063, 1064, 1066, 1069, 1070, 1071, 1170, 1178,
+  1202,
+};
+const uint32_t ALPHA_314_LOWER_CPS[] = {
+  1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080, 1081, 1082, 1083, 1084, 1085, 1086, 1087,
+  1088, 1089, 1090, 1091, 1092, 1093, 1095, 1096, 1098, 1101, 1102, 1103, 1105, 1118, 1171, 1179,
+  1203,
+};
+const uint32_t ALPHA_314_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_314_FREQ[] = {
+  { "а", 0.19650000 },
+  { "б", 0.01380000 },
+  { "в", 0.04200000 },
+  { "г", 0.02070000 },
+  { "д", 0.02600000 },
+  { "е", 0.09050000 },
+  { "ж", 0.01150000 },
+  { "з", 0.01000000 },
+  { "и", 0.07350000 },
+  { "й", 0.00970000 },
+  { "к", 0.03580000 },
+  { "л", 0.03340000 },
+  { "м", 0.03180000 },
+  { "н", 0.04380000 },
+  { "о", 0.10860000 },
+  { "п", 0.01650000 },
+  { "р", 0.05140000 },
+  { "с", 0.04600000 },
+  { "т", 0.05220000 },
+  { "у", 0.02250000 },
+  { "ф", 0.00420000 },
+  { "х", 0.00660000 },
+  { "ч", 0.00740000 },
+  { "ш", 0.01270000 },
+  { "ъ", 0.00030000 },
+  { "э", 0.00190000 },
+  { "ю", 0.00510000 },
+  { "я", 0.02130000 },
+  { "ё", 0.00160000 },
+  { "ў", 0.00080000 },
+  { "ғ", 0.00010000 },
+  { "қ", 0.00100000 },
+  { "ҳ", 0.00080000 },
+};
+
+const wa_cp_freq ALPHA_314_FREQ_CPS[] = {
+  { 0x430u, 0.19650000 },
+  { 0x431u, 0.01380000 },
+  { 0x432u, 0.04200000 },
+  { 0x433u, 0.02070000 },
+  { 0x434u, 0.02600000 },
+  { 0x435u, 0.09050000 },
+  { 0x436u, 0.01150000 },
+  { 0x437u, 0.01000000 },
+  { 0x438u, 0.07350000 },
+  { 0x439u, 0.00970000 },
+  { 0x43Au, 0.03580000 },
+  { 0x43Bu, 0.03340000 },
+  { 0x43Cu, 0.03180000 },
+  { 0x43Du, 0.04380000 },
+  { 0x43Eu, 0.10860000 },
+  { 0x43Fu, 0.01650000 },
+  { 0x440u, 0.05140000 },
+  { 0x441u, 0.04600000 },
+  { 0x442u, 0.05220000 },
+  { 0x443u, 0.02250000 },
+  { 0x444u, 0.00420000 },
+  { 0x445u, 0.00660000 },
+  { 0x447u, 0.00740000 },
+  { 0x448u, 0.01270000 },
+  { 0x44Au, 0.00030000 },
+  { 0x44Du, 0.00190000 },
+  { 0x44Eu, 0.00510000 },
+  { 0x44Fu, 0.02130000 },
+  { 0x451u, 0.00160000 },
+  { 0x45Eu, 0.00080000 },
+  { 0x493u, 0.00010000 },
+  { 0x49Bu, 0.00100000 },
+  { 0x4B3u, 0.00080000 },
+};
+
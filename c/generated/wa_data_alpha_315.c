@@ -0,0 +1,133 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_315_UPPER[] = {
+  "A",
+  "B",
+  "D",
+  "E",
+  "F",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "P",
+  "Q",
+  "R",
+  "T",
+  "U",
+  "V",
+  "X",
+  "Y",
+  "Z",
+  "O",
+  "G",
+  "ʻ",
+  "ʼ",
+  "S",
+  "C",
+};
+const char *ALPHA_315_LOWER[] = {
+  "a",
+  "b",
+  "d",
+  "e",
+  "f",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "p",
+  "q",
+  "r",
+  "t",
+  "u",
+  "v",
+  "x",
+  "y",
+  "z",
+  "o",
+  "g",
+  "ʻ",
+  "ʼ",
+  "s",
+  "c",
+};
+const char *ALPHA_315_DIGITS[] = {
+};
+const uint32_t ALPHA_315_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 88, 89, 90, 699, 700,
+};
+const uint32_t ALPHA_315_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 120, 121, 122, 699, 700,
+};
+const uint32_t ALPHA_315_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_315_FREQ[] = {
+  { "a", 0.15080000 },
+  { "b", 0.02180000 },
+  { "d", 0.04110000 },
+  { "e", 0.02750000 },
+  { "f", 0.00740000 },
+  { "h", 0.03210000 },
+  { "i", 0.14190000 },
+  { "j", 0.00690000 },
+  { "k", 0.03020000 },
+  { "l", 0.05420000 },
+  { "m", 0.04020000 },
+  { "n", 0.07260000 },
+  { "p", 0.01020000 },
+  { "q", 0.01670000 },
+  { "r", 0.06100000 },
+  { "t", 0.04290000 },
+  { "u", 0.02570000 },
+  { "v", 0.01420000 },
+  { "x", 0.00270000 },
+  { "y", 0.03410000 },
+  { "z", 0.00740000 },
+  { "o", 0.06230000 },
+  { "g", 0.03200000 },
+  { "ʻ", 0.00450000 },
+  { "ʼ", 0.00050000 },
+  { "s", 0.05000000 },
+  { "c", 0.00920000 },
+};
+
+const wa_cp_freq ALPHA_315_FREQ_CPS[] = {
+  { 0x61u, 0.15080000 },
+  { 0x62u, 0.02180000 },
+  { 0x63u, 0.00920000 },
+  { 0x64u, 0.04110000 },
+  { 0x65u, 0.02750000 },
+  { 0x66u, 0.00740000 },
+  { 0x67u, 0.03200000 },
+  { 0x68u, 0.03210000 },
+  { 0x69u, 0.14190000 },
+  { 0x6Au, 0.00690000 },
+  { 0x6Bu, 0.03020000 },
+  { 0x6Cu, 0.05420000 },
+  { 0x6Du, 0.04020000 },
+  { 0x6Eu, 0.07260000 },
+  { 0x6Fu, 0.06230000 },
+  { 0x70u, 0.01020000 },
+  { 0x71u, 0.01670000 },
+  { 0x72u, 0.06100000 },
+  { 0x73u, 0.05000000 },
+  { 0x74u, 0.04290000 },
+  { 0x75u, 0.02570000 },
+  { 0x76u, 0.01420000 },
+  { 0x78u, 0.00270000 },
+  { 0x79u, 0.03410000 },
+  { 0x7Au, 0.00740000 },
+  { 0x2BBu, 0.00450000 },
+  { 0x2BCu, 0.00050000 },
+};
+
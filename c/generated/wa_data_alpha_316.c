@@ -0,0 +1,1163 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_316_UPPER[] = {
+  "ꔀ",
+  "ꔁ",
+  "ꔂ",
+  "ꔃ",
+  "ꔄ",
+  "ꔅ",
+  "ꔆ",
+  "ꔇ",
+  "ꔈ",
+  "ꔉ",
+  "ꔊ",
+  "ꔋ",
+  "ꔌ",
+  "ꔍ",
+  "ꔎ",
+  "ꔏ",
+  "ꔐ",
+  "ꔑ",
+  "ꔒ",
+  "ꔓ",
+  "ꔔ",
+  "ꔕ",
+  "ꔖ",
+  "ꔗ",
+  "ꔘ",
+  "ꔙ",
+  "ꔚ",
+  "ꔛ",
+  "ꔜ",
+  "ꔝ",
+  "ꔞ",
+  "ꔟ",
+  "ꔠ",
+  "ꔡ",
+  "ꔢ",
+  "ꔣ",
+  "ꔤ",
+  "ꔥ",
+  "ꔦ",
+  "ꔧ",
+  "ꔨ",
+  "ꔩ",
+  "ꔪ",
+  "ꔫ",
+  "ꔬ",
+  "ꔭ",
+  "ꔮ",
+  "ꔯ",
+  "ꔰ",
+  "ꔱ",
+  "ꔲ",
+  "ꔳ",
+  "ꔴ",
+  "ꔵ",
+  "ꔶ",
+  "ꔷ",
+  "ꔸ",
+  "ꔹ",
+  "ꔺ",
+  "ꔻ",
+  "ꔼ",
+  "ꔽ",
+  "ꔾ",
+  "ꔿ",
+  "ꕀ",
+  "ꕁ",
+  "ꕂ",
+  "ꕃ",
+  "ꕄ",
+  "ꕅ",
+  "ꕆ",
+  "ꕇ",
+  "ꕈ",
+  "ꕉ",
+  "ꕊ",
+  "ꕋ",
+  "ꕌ",
+  "ꕍ",
+  "ꕎ",
+  "ꕏ",
+  "ꕐ",
+  "ꕑ",
+  "ꕒ",
+  "ꕓ",
+  "ꕔ",
+  "ꕕ",
+  "ꕖ",
+  "ꕗ",
+  "ꕘ",
+  "ꘐ",
+  "ꕙ",
+  "ꕚ",
+  "ꕛ",
+  "ꕜ",
+  "ꕝ",
+  "ꕞ",
+  "ꕟ",
+  "ꕠ",
+  "ꕡ",
+  "ꕢ",
+  "ꕣ",
+  "ꕤ",
+  "ꕥ",
+  "ꕦ",
+  "ꕧ",
+  "ꕨ",
+  "ꕩ",
+  "ꕪ",
+  "ꘑ",
+  "ꕫ",
+  "ꕬ",
+  "ꕭ",
+  "ꕮ",
+  "ꘪ",
+  "ꕯ",
+  "ꕰ",
+  "ꕱ",
+  "ꕲ",
+  "ꕳ",
+  "ꕴ",
+  "ꕵ",
+  "ꕶ",
+  "ꕷ",
+  "ꕸ",
+  "ꕹ",
+  "ꕺ",
+  "ꕻ",
+  "ꕼ",
+  "ꕽ",
+  "ꕾ",
+  "ꕿ",
+  "ꖀ",
+  "ꖁ",
+  "ꖂ",
+  "ꖃ",
+  "ꖄ",
+  "ꖅ",
+  "ꖆ",
+  "ꖇ",
+  "ꘒ",
+  "ꖈ",
+  "ꖉ",
+  "ꖊ",
+  "ꖋ",
+  "ꖌ",
+  "ꖍ",
+  "ꖎ",
+  "ꖏ",
+  "ꖐ",
+  "ꖑ",
+  "ꖒ",
+  "ꖓ",
+  "ꖔ",
+  "ꖕ",
+  "ꖖ",
+  "ꖗ",
+  "ꖘ",
+  "ꖙ",
+  "ꖚ",
+  "ꖛ",
+  "ꖜ",
+  "ꖝ",
+  "ꖞ",
+  "ꖟ",
+  "ꖠ",
+  "ꖡ",
+  "ꖢ",
+  "ꖣ",
+  "ꖤ",
+  "ꖥ",
+  "ꖦ",
+  "ꖧ",
+  "ꖨ",
+  "ꖩ",
+  "ꖪ",
+  "ꖫ",
+  "ꖬ",
+  "ꖭ",
+  "ꖮ",
+  "ꖯ",
+  "ꖰ",
+  "ꖱ",
+  "ꖲ",
+  "ꖳ",
+  "ꖴ",
+  "ꖵ",
+  "ꖶ",
+  "ꖷ",
+  "ꖸ",
+  "ꖹ",
+  "ꖺ",
+  "ꖻ",
+  "ꖼ",
+  "ꖽ",
+  "ꖾ",
+  "ꖿ",
+  "ꗀ",
+  "ꗁ",
+  "ꗂ",
+  "ꗃ",
+  "ꗄ",
+  "ꗅ",
+  "ꗆ",
+  "ꗇ",
+  "ꗈ",
+  "ꗉ",
+  "ꗊ",
+  "ꗋ",
+  "ꗌ",
+  "ꗍ",
+  "ꗎ",
+  "ꗏ",
+  "ꗐ",
+  "ꗑ",
+  "ꘫ",
+  "ꗒ",
+  "ꗓ",
+  "ꗔ",
+  "ꗕ",
+  "ꗖ",
+  "ꗗ",
+  "ꗘ",
+  "ꗙ",
+  "ꗚ",
+  "ꗛ",
+  "ꗜ",
+  "ꗝ",
+  "ꗞ",
+  "ꗟ",
+  "ꗠ",
+  "ꗡ",
+  "ꗢ",
+  "ꗣ",
+  "ꗤ",
+  "ꗥ",
+  "ꗦ",
+  "ꗧ",
+  "ꗨ",
+  "ꗩ",
+  "ꗪ",
+  "ꗫ",
+  "ꗬ",
+  "ꗭ",
+  "ꗮ",
+  "ꗯ",
+  "ꗰ",
+  "ꗱ",
+  "ꗲ",
+  "ꗳ",
+  "ꗴ",
+  "ꗵ",
+  "ꗶ",
+  "ꗷ",
+  "ꗸ",
+  "ꗹ",
+  "ꗺ",
+  "ꗻ",
+  "ꗼ",
+  "ꗽ",
+  "ꗾ",
+  "ꗿ",
+  "ꘀ",
+  "ꘁ",
+  "ꘂ",
+  "ꘃ",
+  "ꘄ",
+  "ꘅ",
+  "ꘆ",
+  "ꘇ",
+  "ꘈ",
+  "ꘉ",
+  "ꘊ",
+  "ꘋ",
+  "ꘌ",
+};
+const char *ALPHA_316_LOWER[] = {
+  "ꔀ",
+  "ꔁ",
+  "ꔂ",
+  "ꔃ",
+  "ꔄ",
+  "ꔅ",
+  "ꔆ",
+  "ꔇ",
+  "ꔈ",
+  "ꔉ",
+  "ꔊ",
+  "ꔋ",
+  "ꔌ",
+  "ꔍ",
+  "ꔎ",
+  "ꔏ",
+  "ꔐ",
+  "ꔑ",
+  "ꔒ",
+  "ꔓ",
+  "ꔔ",
+  "ꔕ",
+  "ꔖ",
+  "ꔗ",
+  "ꔘ",
+  "ꔙ",
+  "ꔚ",
+  "ꔛ",
+  "ꔜ",
+  "ꔝ",
+  "ꔞ",
+  "ꔟ",
+  "ꔠ",
+  "ꔡ",
+  "ꔢ",
+  "ꔣ",
+  "ꔤ",
+  "ꔥ",
+  "ꔦ",
+  "ꔧ",
+  "ꔨ",
+  "ꔩ",
+  "ꔪ",
+  "ꔫ",
+  "ꔬ",
+  "ꔭ",
+  "ꔮ",
+  "ꔯ",
+  "ꔰ",
+  "ꔱ",
+  "ꔲ",
+  "ꔳ",
+  "ꔴ",
+  "ꔵ",
+  "ꔶ",
+  "ꔷ",
+  "ꔸ",
+  "ꔹ",
+  "ꔺ",
+  "ꔻ",
+  "ꔼ",
+  "ꔽ",
+  "ꔾ",
+  "ꔿ",
+  "ꕀ",
+  "ꕁ",
+  "ꕂ",
+  "ꕃ",
+  "ꕄ",
+  "ꕅ",
+  "ꕆ",
+  "ꕇ",
+  "ꕈ",
+  "ꕉ",
+  "ꕊ",
+  "ꕋ",
+  "ꕌ",
+  "ꕍ",
+  "ꕎ",
+  "ꕏ",
+  "ꕐ",
+  "ꕑ",
+  "ꕒ",
+  "ꕓ",
+  "ꕔ",
+  "ꕕ",
+  "ꕖ",
+  "ꕗ",
+  "ꕘ",
+  "ꘐ",
+  "ꕙ",
+  "ꕚ",
+  "ꕛ",
+  "ꕜ",
+  "ꕝ",
+  "ꕞ",
+  "ꕟ",
+  "ꕠ",
+  "ꕡ",
+  "ꕢ",
+  "ꕣ",
+  "ꕤ",
+  "ꕥ",
+  "ꕦ",
+  "ꕧ",
+  "ꕨ",
+  "ꕩ",
+  "ꕪ",
+  "ꘑ",
+  "ꕫ",
+  "ꕬ",
+  "ꕭ",
+  "ꕮ",
+  "ꘪ",
+  "ꕯ",
+  "ꕰ",
+  "ꕱ",
+  "ꕲ",
+  "ꕳ",
+  "ꕴ",
+  "ꕵ",
+  "ꕶ",
+  "ꕷ",
+  "ꕸ",
+  "ꕹ",
+  "ꕺ",
+  "ꕻ",
+  "ꕼ",
+  "ꕽ",
+  "ꕾ",
+  "ꕿ",
+  "ꖀ",
+  "ꖁ",
+  "ꖂ",
+  "ꖃ",
+  "ꖄ",
+  "ꖅ",
+  "ꖆ",
+  "ꖇ",
+  "ꘒ",
+  "ꖈ",
+  "ꖉ",
+  "ꖊ",
+  "ꖋ",
+  "ꖌ",
+  "ꖍ",
+  "ꖎ",
+  "ꖏ",
+  "ꖐ",
+  "ꖑ",
+  "ꖒ",
+  "ꖓ",
+  "ꖔ",
+  "ꖕ",
+  "ꖖ",
+  "ꖗ",
+  "ꖘ",
+  "ꖙ",
+  "ꖚ",
+  "ꖛ",
+  "ꖜ",
+  "ꖝ",
+  "ꖞ",
+  "ꖟ",
+  "ꖠ",
+  "ꖡ",
+  "ꖢ",
+  "ꖣ",
+  "ꖤ",
+  "ꖥ",
+  "ꖦ",
+  "ꖧ",
+  "ꖨ",
+  "ꖩ",
+  "ꖪ",
+  "ꖫ",
+  "ꖬ",
+  "ꖭ",
+  "ꖮ",
+  "ꖯ",
+  "ꖰ",
+  "ꖱ",
+  "ꖲ",
+  "ꖳ",
+  "ꖴ",
+  "ꖵ",
+  "ꖶ",
+  "ꖷ",
+  "ꖸ",
+  "ꖹ",
+  "ꖺ",
+  "ꖻ",
+  "ꖼ",
+  "ꖽ",
+  "ꖾ",
+  "ꖿ",
+  "ꗀ",
+  "ꗁ",
+  "ꗂ",
+  "ꗃ",
+  "ꗄ",
+  "ꗅ",
+  "ꗆ",
+  "ꗇ",
+  "ꗈ",
+  "ꗉ",
+  "ꗊ",
+  "ꗋ",
+  "ꗌ",
+  "ꗍ",
+  "ꗎ",
+  "ꗏ",
+  "ꗐ",
+  "ꗑ",
+  "ꘫ",
+  "ꗒ",
+  "ꗓ",
+  "ꗔ",
+  "ꗕ",
+  "ꗖ",
+  "ꗗ",
+  "ꗘ",
+  "ꗙ",
+  "ꗚ",
+  "ꗛ",
+  "ꗜ",
+  "ꗝ",
+  "ꗞ",
+  "ꗟ",
+  "ꗠ",
+  "ꗡ",
+  "ꗢ",
+  "ꗣ",
+  "ꗤ",
+  "ꗥ",
+  "ꗦ",
+  "ꗧ",
+  "ꗨ",
+  "ꗩ",
+  "ꗪ",
+  "ꗫ",
+  "ꗬ",
+  "ꗭ",
+  "ꗮ",
+  "ꗯ",
+  "ꗰ",
+  "ꗱ",
+  "ꗲ",
+  "ꗳ",
+  "ꗴ",
+  "ꗵ",
+  "ꗶ",
+  "ꗷ",
+  "ꗸ",
+  "ꗹ",
+  "ꗺ",
+  "ꗻ",
+  "ꗼ",
+  "ꗽ",
+  "ꗾ",
+  "ꗿ",
+  "ꘀ",
+  "ꘁ",
+  "ꘂ",
+  "ꘃ",
+  "ꘄ",
+  "ꘅ",
+  "ꘆ",
+  "ꘇ",
+  "ꘈ",
+  "ꘉ",
+  "ꘊ",
+  "ꘋ",
+  "ꘌ",
+};
+const char *ALPHA_316_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_316_UPPER_CPS[] = {
+  42240, 42241, 42242, 42243, 42244, 42245, 42246, 42247, 42248, 42249, 42250, 42251, 42252, 42253, 42254, 42255,
+  42256, 42257, 42258, 42259, 42260, 42261, 42262, 42263, 42264, 42265, 42266, 42267, 42268, 42269, 42270, 42271,
+  42272, 42273, 42274, 42275, 42276, 42277, 42278, 42279, 42280, 42281, 42282, 42283, 42284, 42285, 42286, 42287,
+  42288, 42289, 42290, 42291, 42292, 42293, 42294, 42295, 42296, 42297, 42298, 42299, 42300, 42301, 42302, 42303,
+  42304, 42305, 42306, 42307, 42308, 42309, 42310, 42311, 42312, 42313, 42314, 42315, 42316, 42317, 42318, 42319,
+  42320, 42321, 42322, 42323, 42324, 42325, 42326, 42327, 42328, 42329, 42330, 42331, 42332, 42333, 42334, 42335,
+  42336, 42337, 42338, 42339, 42340, 42341, 42342, 42343, 42344, 42345, 42346, 42347, 42348, 42349, 42350, 42351,
+  42352, 42353, 42354, 42355, 42356, 42357, 42358, 42359, 42360, 42361, 42362, 42363, 42364, 42365, 42366, 42367,
+  42368, 42369, 42370, 42371, 42372, 42373, 42374, 42375, 42376, 42377, 42378, 42379, 42380, 42381, 42382, 42383,
+  42384, 42385, 42386, 42387, 42388, 42389, 42390, 42391, 42392, 42393, 42394, 42395, 42396, 42397, 42398, 42399,
+  42400, 42401, 42402, 42403, 42404, 42405, 42406, 42407, 42408, 42409, 42410, 42411, 42412, 42413, 42414, 42415,
+  42416, 42417, 42418, 42419, 42420, 42421, 42422, 42423, 42424, 42425, 42426, 42427, 42428, 42429, 42430, 42431,
+  42432, 42433, 42434, 42435, 42436, 42437, 42438, 42439, 42440, 42441, 42442, 42443, 42444, 42445, 42446, 42447,
+  42448, 42449, 42450, 42451, 42452, 42453, 42454, 42455, 42456, 42457, 42458, 42459, 42460, 42461, 42462, 42463,
+  42464, 42465, 42466, 42467, 42468, 42469, 42470, 42471, 42472, 42473, 42474, 42475, 42476, 42477, 42478, 42479,
+  42480, 42481, 42482, 42483, 42484, 42485, 42486, 42487, 42488, 42489, 42490, 42491, 42492, 42493, 42494, 42495,
+  42496, 42497, 42498, 42499, 42500, 42501, 42502, 42503, 42504, 42505, 42506, 42507, 42508, 42512, 42513, 42514,
+  42538, 42539,
+};
+const uint32_t ALPHA_316_LOWER_CPS[] = {
+  42240, 42241, 42242, 42243, 42244, 42245, 42246, 42247, 42248, 42249, 42250, 42251, 42252, 42253, 42254, 42255,
+  42256, 42257, 42258, 42259, 42260, 42261, 42262, 42263, 42264, 42265, 42266, 42267, 42268, 42269, 42270, 42271,
+  42272, 42273, 42274, 42275, 42276, 42277, 42278, 42279, 42280, 42281, 42282, 42283, 42284, 42285, 42286, 42287,
+  42288, 42289, 42290, 42291, 42292, 42293, 42294, 42295, 42296, 42297, 42298, 42299, 42300, 42301, 42302, 42303,
+  42304, 42305, 42306, 42307, 42308, 42309, 42310, 42311, 42312, 42313, 42314, 42315, 42316, 42317, 42318, 42319,
+  42320, 42321, 42322, 42323, 42324, 42325, 42326, 42327, 42328, 42329, 42330, 42331, 42332, 42333, 42334, 42335,
+  42336, 42337, 42338, 42339, 42340, 42341, 42342, 42343, 42344, 42345, 42346, 42347, 42348, 42349, 42350, 42351,
+  42352, 42353, 42354, 42355, 42356, 42357, 42358, 42359, 42360, 42361, 42362, 42363, 42364, 42365, 42366, 42367,
+  42368, 42369, 42370, 42371, 42372, 42373, 42374, 42375, 42376, 42377, 42378, 42379, 42380, 42381, 42382, 42383,
+  42384, 42385, 42386, 42387, 42388, 42389, 42390, 42391, 42392, 42393, 42394, 42395, 42396, 42397, 42398, 42399,
+  42400, 42401, 42402, 42403, 42404, 42405, 42406, 42407, 42408, 42409, 42410, 42411, 42412, 42413, 42414, 42415,
+  42416, 42417, 42418, 42419, 42420, 42421, 42422, 42423, 42424, 42425, 42426, 42427, 42428, 42429, 42430, 42431,
+  42432, 42433, 42434, 42435, 42436, 42437, 42438, 42439, 42440, 42441, 42442, 42443, 42444, 42445, 42446, 42447,
+  42448, 42449, 42450, 42451, 42452, 42453, 42454, 42455, 42456, 42457, 42458, 42459, 42460, 42461, 42462, 42463,
+  42464, 42465, 42466, 42467, 42468, 42469, 42470, 42471, 42472, 42473, 42474, 42475, 42476, 42477, 42478, 42479,
+  42480, 42481, 42482, 42483, 42484, 42485, 42486, 42487, 42488, 42489, 42490, 42491, 42492, 42493, 42494, 42495,
+  42496, 42497, 42498, 42499, 42500, 42501, 42502, 42503, 42504, 42505, 42506, 42507, 42508, 42512, 42513, 42514,
+  42538, 42539,
+};
+const uint32_t ALPHA_316_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_316_FREQ[] = {
+  { "ꔀ", 0.00000000 },
+  { "ꔁ", 0.00000000 },
+  { "ꔂ", 0.00000000 },
+  { "ꔃ", 0.00000000 },
+  { "ꔄ", 0.00000000 },
+  { "ꔅ", 0.00000000 },
+  { "ꔆ", 0.00000000 },
+  { "ꔇ", 0.00000000 },
+  { "ꔈ", 0.00000000 },
+  { "ꔉ", 0.00000000 },
+  { "ꔊ", 0.00000000 },
+  { "ꔋ", 0.00000000 },
+  { "ꔌ", 0.00000000 },
+  { "ꔍ", 0.00000000 },
+  { "ꔎ", 0.00000000 },
+  { "ꔏ", 0.00000000 },
+  { "ꔐ", 0.00000000 },
+  { "ꔑ", 0.00000000 },
+  { "ꔒ", 0.00000000 },
+  { "ꔓ", 0.00000000 },
+  { "ꔔ", 0.00000000 },
+  { "ꔕ", 0.00000000 },
+  { "ꔖ", 0.00000000 },
+  { "ꔗ", 0.00000000 },
+  { "ꔘ", 0.00000000 },
+  { "ꔙ", 0.00000000 },
+  { "ꔚ", 0.00000000 },
+  { "ꔛ", 0.00000000 },
+  { "ꔜ", 0.00000000 },
+  { "ꔝ", 0.00000000 },
+  { "ꔞ", 0.00000000 },
+  { "ꔟ", 0.00000000 },
+  { "ꔠ", 0.00000000 },
+  { "ꔡ", 0.00000000 },
+  { "ꔢ", 0.00000000 },
+  { "ꔣ", 0.00000000 },
+  { "ꔤ", 0.00000000 },
+  { "ꔥ", 0.00000000 },
+  { "ꔦ", 0.00000000 },
+  { "ꔧ", 0.00000000 },
+  { "ꔨ", 0.00000000 },
+  { "ꔩ", 0.00000000 },
+  { "ꔪ", 0.00000000 },
+  { "ꔫ", 0.00000000 },
+  { "ꔬ", 0.00000000 },
+  { "ꔭ", 0.00000000 },
+  { "ꔮ", 0.00000000 },
+  { "ꔯ", 0.00000000 },
+  { "ꔰ", 0.00000000 },
+  { "ꔱ", 0.00000000 },
+  { "ꔲ", 0.00000000 },
+  { "ꔳ", 0.00000000 },
+  { "ꔴ", 0.00000000 },
+  { "ꔵ", 0.00000000 },
+  { "ꔶ", 0.00000000 },
+  { "ꔷ", 0.00000000 },
+  { "ꔸ", 0.00000000 },
+  { "ꔹ", 0.00000000 },
+  { "ꔺ", 0.00000000 },
+  { "ꔻ", 0.00000000 },
+  { "ꔼ", 0.00000000 },
+  { "ꔽ", 0.00000000 },
+  { "ꔾ", 0.00000000 },
+  { "ꔿ", 0.00000000 },
+  { "ꕀ", 0.00000000 },
+  { "ꕁ", 0.00000000 },
+  { "ꕂ", 0.00000000 },
+  { "ꕃ", 0.00000000 },
+  { "ꕄ", 0.00000000 },
+  { "ꕅ", 0.00000000 },
+  { "ꕆ", 0.00000000 },
+  { "ꕇ", 0.00000000 },
+  { "ꕈ", 0.00000000 },
+  { "ꕉ", 0.00000000 },
+  { "ꕊ", 0.00000000 },
+  { "ꕋ", 0.00000000 },
+  { "ꕌ", 0.00000000 },
+  { "ꕍ", 0.00000000 },
+  { "ꕎ", 0.00000000 },
+  { "ꕏ", 0.00000000 },
+  { "ꕐ", 0.00000000 },
+  { "ꕑ", 0.00000000 },
+  { "ꕒ", 0.00000000 },
+  { "ꕓ", 0.00000000 },
+  { "ꕔ", 0.00000000 },
+  { "ꕕ", 0.00000000 },
+  { "ꕖ", 0.00000000 },
+  { "ꕗ", 0.00000000 },
+  { "ꕘ", 0.00000000 },
+  { "ꘐ", 0.00000000 },
+  { "ꕙ", 0.00000000 },
+  { "ꕚ", 0.00000000 },
+  { "ꕛ", 0.00000000 },
+  { "ꕜ", 0.00000000 },
+  { "ꕝ", 0.00000000 },
+  { "ꕞ", 0.00000000 },
+  { "ꕟ", 0.00000000 },
+  { "ꕠ", 0.00000000 },
+  { "ꕡ", 0.00000000 },
+  { "ꕢ", 0.00000000 },
+  { "ꕣ", 0.00000000 },
+  { "ꕤ", 0.00000000 },
+  { "ꕥ", 0.00000000 },
+  { "ꕦ", 0.00000000 },
+  { "ꕧ", 0.00000000 },
+  { "ꕨ", 0.00000000 },
+  { "ꕩ", 0.00000000 },
+  { "ꕪ", 0.00000000 },
+  { "ꘑ", 0.00000000 },
+  { "ꕫ", 0.00000000 },
+  { "ꕬ", 0.00000000 },
+  { "ꕭ", 0.00000000 },
+  { "ꕮ", 0.00000000 },
+  { "ꘪ", 0.00000000 },
+  { "ꕯ", 0.00000000 },
+  { "ꕰ", 0.00000000 },
+  { "ꕱ", 0.00000000 },
+  { "ꕲ", 0.00000000 },
+  { "ꕳ", 0.00000000 },
+  { "ꕴ", 0.00000000 },
+  { "ꕵ", 0.00000000 },
+  { "ꕶ", 0.00000000 },
+  { "ꕷ", 0.00000000 },
+  { "ꕸ", 0.00000000 },
+  { "ꕹ", 0.00000000 },
+  { "ꕺ", 0.00000000 },
+  { "ꕻ", 0.00000000 },
+  { "ꕼ", 0.00000000 },
+  { "ꕽ", 0.00000000 },
+  { "ꕾ", 0.00000000 },
+  { "ꕿ", 0.00000000 },
+  { "ꖀ", 0.00000000 },
+  { "ꖁ", 0.00000000 },
+  { "ꖂ", 0.00000000 },
+  { "ꖃ", 0.00000000 },
+  { "ꖄ", 0.00000000 },
+  { "ꖅ", 0.00000000 },
+  { "ꖆ", 0.00000000 },
+  { "ꖇ", 0.00000000 },
+  { "ꘒ", 0.00000000 },
+  { "ꖈ", 0.00000000 },
+  { "ꖉ", 0.00000000 },
+  { "ꖊ", 0.00000000 },
+  { "ꖋ", 0.00000000 },
+  { "ꖌ", 0.00000000 },
+  { "ꖍ", 0.00000000 },
+  { "ꖎ", 0.00000000 },
+  { "ꖏ", 0.00000000 },
+  { "ꖐ", 0.00000000 },
+  { "ꖑ", 0.00000000 },
+  { "ꖒ", 0.00000000 },
+  { "ꖓ", 0.00000000 },
+  { "ꖔ", 0.00000000 },
+  { "ꖕ", 0.00000000 },
+  { "ꖖ", 0.00000000 },
+  { "ꖗ", 0.00000000 },
+  { "ꖘ", 0.00000000 },
+  { "ꖙ", 0.00000000 },
+  { "ꖚ", 0.00000000 },
+  { "ꖛ", 0.00000000 },
+  { "ꖜ", 0.00000000 },
+  { "ꖝ", 0.00000000 },
+  { "ꖞ", 0.00000000 },
+  { "ꖟ", 0.00000000 },
+  { "ꖠ", 0.00000000 },
+  { "ꖡ", 0.00000000 },
+  { "ꖢ", 0.00000000 },
+  { "ꖣ", 0.00000000 },
+  { "ꖤ", 0.00000000 },
+  { "ꖥ", 0.00000000 },
+  { "ꖦ", 0.00000000 },
+  { "ꖧ", 0.00000000 },
+  { "ꖨ", 0.00000000 },
+  { "ꖩ", 0.00000000 },
+  { "ꖪ", 0.00000000 },
+  { "ꖫ", 0.00000000 },
+  { "ꖬ", 0.00000000 },
+  { "ꖭ", 0.00000000 },
+  { "ꖮ", 0.00000000 },
+  { "ꖯ", 0.00000000 },
+  { "ꖰ", 0.00000000 },
+  { "ꖱ", 0.00000000 },
+  { "ꖲ", 0.00000000 },
+  { "ꖳ", 0.00000000 },
+  { "ꖴ", 0.00000000 },
+  { "ꖵ", 0.00000000 },
+  { "ꖶ", 0.00000000 },
+  { "ꖷ", 0.00000000 },
+  { "ꖸ", 0.00000000 },
+  { "ꖹ", 0.00000000 },
+  { "ꖺ", 0.00000000 },
+  { "ꖻ", 0.00000000 },
+  { "ꖼ", 0.00000000 },
+  { "ꖽ", 0.00000000 },
+  { "ꖾ", 0.00000000 },
+  { "ꖿ", 0.00000000 },
+  { "ꗀ", 0.00000000 },
+  { "ꗁ", 0.00000000 },
+  { "ꗂ", 0.00000000 },
+  { "ꗃ", 0.00000000 },
+  { "ꗄ", 0.00000000 },
+  { "ꗅ", 0.00000000 },
+  { "ꗆ", 0.00000000 },
+  { "ꗇ", 0.00000000 },
+  { "ꗈ", 0.00000000 },
+  { "ꗉ", 0.00000000 },
+  { "ꗊ", 0.00000000 },
+  { "ꗋ", 0.00000000 },
+  { "ꗌ", 0.00000000 },
+  { "ꗍ", 0.00000000 },
+  { "ꗎ", 0.00000000 },
+  { "ꗏ", 0.00000000 },
+  { "ꗐ", 0.00000000 },
+  { "ꗑ", 0.00000000 },
+  { "ꘫ", 0.00000000 },
+  { "ꗒ", 0.00000000 },
+  { "ꗓ", 0.00000000 },
+  { "ꗔ", 0.00000000 },
+  { "ꗕ", 0.00000000 },
+  { "ꗖ", 0.00000000 },
+  { "ꗗ", 0.00000000 },
+  { "ꗘ", 0.00000000 },
+  { "ꗙ", 0.00000000 },
+  { "ꗚ", 0.00000000 },
+  { "ꗛ", 0.00000000 },
+  { "ꗜ", 0.00000000 },
+  { "ꗝ", 0.00000000 },
+  { "ꗞ", 0.00000000 },
+  { "ꗟ", 0.00000000 },
+  { "ꗠ", 0.00000000 },
+  { "ꗡ", 0.00000000 },
+  { "ꗢ", 0.00000000 },
+  { "ꗣ", 0.00000000 },
+  { "ꗤ", 0.00000000 },
+  { "ꗥ", 0.00000000 },
+  { "ꗦ", 0.00000000 },
+  { "ꗧ", 0.00000000 },
+  { "ꗨ", 0.00000000 },
+  { "ꗩ", 0.00000000 },
+  { "ꗪ", 0.00000000 },
+  { "ꗫ", 0.00000000 },
+  { "ꗬ", 0.00000000 },
+  { "ꗭ", 0.00000000 },
+  { "ꗮ", 0.00000000 },
+  { "ꗯ", 0.00000000 },
+  { "ꗰ", 0.00000000 },
+  { "ꗱ", 0.00000000 },
+  { "ꗲ", 0.00000000 },
+  { "ꗳ", 0.00000000 },
+  { "ꗴ", 0.00000000 },
+  { "ꗵ", 0.00000000 },
+  { "ꗶ", 0.00000000 },
+  { "ꗷ", 0.00000000 },
+  { "ꗸ", 0.00000000 },
+  { "ꗹ", 0.00000000 },
+  { "ꗺ", 0.00000000 },
+  { "ꗻ", 0.00000000 },
+  { "ꗼ", 0.00000000 },
+  { "ꗽ", 0.00000000 },
+  { "ꗾ", 0.00000000 },
+  { "ꗿ", 0.00000000 },
+  { "ꘀ", 0.00000000 },
+  { "ꘁ", 0.00000000 },
+  { "ꘂ", 0.00000000 },
+  { "ꘃ", 0.00000000 },
+  { "ꘄ", 0.00000000 },
+  { "ꘅ", 0.00000000 },
+  { "ꘆ", 0.00000000 },
+  { "ꘇ", 0.00000000 },
+  { "ꘈ", 0.00000000 },
+  { "ꘉ", 0.00000000 },
+  { "ꘊ", 0.00000000 },
+  { "ꘋ", 0.00000000 },
+  { "ꘌ", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_316_FREQ_CPS[] = {
+  { 0xA500u, 0.00000000 },
+  { 0xA501u, 0.00000000 },
+  { 0xA502u, 0.00000000 },
+  { 0xA503u, 0.00000000 },
+  { 0xA504u, 0.00000000 },
+  { 0xA505u, 0.00000000 },
+  { 0xA506u, 0.00000000 },
+  { 0xA507u, 0.00000000 },
+  { 0xA508u, 0.00000000 },
+  { 0xA509u, 0.00000000 },
+  { 0xA50Au, 0.00000000 },
+  { 0xA50Bu, 0.00000000 },
+  { 0xA50Cu, 0.00000000 },
+  { 0xA50Du, 0.00000000 },
+  { 0xA50Eu, 0.00000000 },
+  { 0xA50Fu, 0.00000000 },
+  { 0xA510u, 0.00000000 },
+  { 0xA511u, 0.00000000 },
+  { 0xA512u, 0.00000000 },
+  { 0xA513u, 0.00000000 },
+  { 0xA514u, 0.00000000 },
+  { 0xA515u, 0.00000000 },
+  { 0xA516u, 0.00000000 },
+  { 0xA517u, 0.00000000 },
+  { 0xA518u, 0.00000000 },
+  { 0xA519u, 0.00000000 },
+  { 0xA51Au, 0.00000000 },
+  { 0xA51Bu, 0.00000000 },
+  { 0xA51Cu, 0.00000000 },
+  { 0xA51Du, 0.00000000 },
+  { 0xA51Eu, 0.00000000 },
+  { 0xA51Fu, 0.00000000 },
+  { 0xA520u, 0.00000000 },
+  { 0xA521u, 0.00000000 },
+  { 0xA522u, 0.00000000 },
+  { 0xA523u, 0.00000000 },
+  { 0xA524u, 0.00000000 },
+  { 0xA525u, 0.00000000 },
+  { 0xA526u, 0.00000000 },
+  { 0xA527u, 0.00000000 },
+  { 0xA528u, 0.00000000 },
+  { 0xA529u, 0.00000000 },
+  { 0xA52Au, 0.00000000 },
+  { 0xA52Bu, 0.00000000 },
+  { 0xA52Cu, 0.00000000 },
+  { 0xA52Du, 0.00000000 },
+  { 0xA52Eu, 0.00000000 },
+  { 0xA52Fu, 0.00000000 },
+  { 0xA530u, 0.00000000 },
+  { 0xA531u, 0.00000000 },
+  { 0xA532u, 0.00000000 },
+  { 0xA533u, 0.00000000 },
+  { 0xA534u, 0.00000000 },
+  { 0xA535u, 0.00000000 },
+  { 0xA536u, 0.00000000 },
+  { 0xA537u, 0.00000000 },
+  { 0xA538u, 0.00000000 },
+  { 0xA539u, 0.00000000 },
+  { 0xA53Au, 0.00000000 },
+  { 0xA53Bu, 0.00000000 },
+  { 0xA53Cu, 0.00000000 },
+  { 0xA53Du, 0.00000000 },
+  { 0xA53Eu, 0.00000000 },
+  { 0xA53Fu, 0.00000000 },
+  { 0xA540u, 0.00000000 },
+  { 0xA541u, 0.00000000 },
+  { 0xA542u, 0.00000000 },
+  { 0xA543u, 0.00000000 },
+  { 0xA544u, 0.00000000 },
+  { 0xA545u, 0.00000000 },
+  { 0xA546u, 0.00000000 },
+  { 0xA547u, 0.00000000 },
+  { 0xA548u, 0.00000000 },
+  { 0xA549u, 0.00000000 },
+  { 0xA54Au, 0.00000000 },
+  { 0xA54Bu, 0.00000000 },
+  { 0xA54Cu, 0.00000000 },
+  { 0xA54Du, 0.00000000 },
+  { 0xA54Eu, 0.00000000 },
+  { 0xA54Fu, 0.00000000 },
+  { 0xA550u, 0.00000000 },
+  { 0xA551u, 0.00000000 },
+  { 0xA552u, 0.00000000 },
+  { 0xA553u, 0.00000000 },
+  { 0xA554u, 0.00000000 },
+  { 0xA555u, 0.00000000 },
+  { 0xA556u, 0.00000000 },
+  { 0xA557u, 0.00000000 },
+  { 0xA558u, 0.00000000 },
+  { 0xA559u, 0.00000000 },
+  { 0xA55Au, 0.00000000 },
+  { 0xA55Bu, 0.00000000 },
+  { 0xA55Cu, 0.00000000 },
+  { 0xA55Du, 0.00000000 },
+  { 0xA55Eu, 0.00000000 },
+  { 0xA55Fu, 0.00000000 },
+  { 0xA560u, 0.00000000 },
+  { 0xA561u, 0.00000000 },
+  { 0xA562u, 0.00000000 },
+  { 0xA563u, 0.00000000 },
+  { 0xA564u, 0.00000000 },
+  { 0xA565u, 0.00000000 },
+  { 0xA566u, 0.00000000 },
+  { 0xA567u, 0.00000000 },
+  { 0xA568u, 0.00000000 },
+  { 0xA569u, 0.00000000 },
+  { 0xA56Au, 0.00000000 },
+  { 0xA56Bu, 0.00000000 },
+  { 0xA56Cu, 0.00000000 },
+  { 0xA56Du, 0.00000000 },
+  { 0xA56Eu, 0.00000000 },
+  { 0xA56Fu, 0.00000000 },
+  { 0xA570u, 0.00000000 },
+  { 0xA571u, 0.00000000 },
+  { 0xA572u, 0.00000000 },
+  { 0xA573u, 0.00000000 },
+  { 0xA574u, 0.00000000 },
+  { 0xA575u, 0.00000000 },
+  { 0xA576u, 0.00000000 },
+  { 0xA577u, 0.00000000 },
+  { 0xA578u, 0.00000000 },
+  { 0xA579u, 0.00000000 },
+  { 0xA57Au, 0.00000000 },
+  { 0xA57Bu, 0.00000000 },
+  { 0xA57Cu, 0.00000000 },
+  { 0xA57Du, 0.00000000 },
+  { 0xA57Eu, 0.00000000 },
+  { 0xA57Fu, 0.00000000 },
+  { 0xA580u, 0.00000000 },
+  { 0xA581u, 0.00000000 },
+  { 0xA582u, 0.00000000 },
+  { 0xA583u, 0.00000000 },
+  { 0xA584u, 0.00000000 },
+  { 0xA585u, 0.00000000 },
+  { 0xA586u, 0.00000000 },
+  { 0xA587u, 0.00000000 },
+  { 0xA588u, 0.00000000 },
+  { 0xA589u, 0.00000000 },
+  { 0xA58Au, 0.00000000 },
+  { 0xA58Bu, 0.00000000 },
+  { 0xA58Cu, 0.00000000 },
+  { 0xA58Du, 0.00000000 },
+  { 0xA58Eu, 0.00000000 },
+  { 0xA58Fu, 0.00000000 },
+  { 0xA590u, 0.00000000 },
+  { 0xA591u, 0.00000000 },
+  { 0xA592u, 0.00000000 },
+  { 0xA593u, 0.00000000 },
+  { 0xA594u, 0.00000000 },
+  { 0xA595u, 0.00000000 },
+  { 0xA596u, 0.00000000 },
+  { 0xA597u, 0.00000000 },
+  { 0xA598u, 0.00000000 },
+  { 0xA599u, 0.00000000 },
+  { 0xA59Au, 0.00000000 },
+  { 0xA59Bu, 0.00000000 },
+  { 0xA59Cu, 0.00000000 },
+  { 0xA59Du, 0.00000000 },
+  { 0xA59Eu, 0.00000000 },
+  { 0xA59Fu, 0.00000000 },
+  { 0xA5A0u, 0.00000000 },
+  { 0xA5A1u, 0.00000000 },
+  { 0xA5A2u, 0.00000000 },
+  { 0xA5A3u, 0.00000000 },
+  { 0xA5A4u, 0.00000000 },
+  { 0xA5A5u, 0.00000000 },
+  { 0xA5A6u, 0.00000000 },
+  { 0xA5A7u, 0.00000000 },
+  { 0xA5A8u, 0.00000000 },
+  { 0xA5A9u, 0.00000000 },
+  { 0xA5AAu, 0.00000000 },
+  { 0xA5ABu, 0.00000000 },
+  { 0xA5ACu, 0.00000000 },
+  { 0xA5ADu, 0.00000000 },
+  { 0xA5AEu, 0.00000000 },
+  { 0xA5AFu, 0.00000000 },
+  { 0xA5B0u, 0.00000000 },
+  { 0xA5B1u, 0.00000000 },
+  { 0xA5B2u, 0.00000000 },
+  { 0xA5B3u, 0.00000000 },
+  { 0xA5B4u, 0.00000000 },
+  { 0xA5B5u, 0.00000000 },
+  { 0xA5B6u, 0.00000000 },
+  { 0xA5B7u, 0.00000000 },
+  { 0xA5B8u, 0.00000000 },
+  { 0xA5B9u, 0.00000000 },
+  { 0xA5BAu, 0.00000000 },
+  { 0xA5BBu, 0.00000000 },
+  { 0xA5BCu, 0.00000000 },
+  { 0xA5BDu, 0.00000000 },
+  { 0xA5BEu, 0.00000000 },
+  { 0xA5BFu, 0.00000000 },
+  { 0xA5C0u, 0.00000000 },
+  { 0xA5C1u, 0.00000000 },
+  { 0xA5C2u, 0.00000000 },
+  { 0xA5C3u, 0.00000000 },
+  { 0xA5C4u, 0.00000000 },
+  { 0xA5C5u, 0.00000000 },
+  { 0xA5C6u, 0.00000000 },
+  { 0xA5C7u, 0.00000000 },
+  { 0xA5C8u, 0.00000000 },
+  { 0xA5C9u, 0.00000000 },
+  { 0xA5CAu, 0.00000000 },
+  { 0xA5CBu, 0.00000000 },
+  { 0xA5CCu, 0.00000000 },
+  { 0xA5CDu, 0.00000000 },
+  { 0xA5CEu, 0.00000000 },
+  { 0xA5CFu, 0.00000000 },
+  { 0xA5D0u, 0.00000000 },
+  { 0xA5D1u, 0.00000000 },
+  { 0xA5D2u, 0.00000000 },
+  { 0xA5D3u, 0.00000000 },
+  { 0xA5D4u, 0.00000000 },
+  { 0xA5D5u, 0.00000000 },
+  { 0xA5D6u, 0.00000000 },
+  { 0xA5D7u, 0.00000000 },
+  { 0xA5D8u, 0.00000000 },
+  { 0xA5D9u, 0.00000000 },
+  { 0xA5DAu, 0.00000000 },
+  { 0xA5DBu, 0.00000000 },
+  { 0xA5DCu, 0.00000000 },
+  { 0xA5DDu, 0.00000000 },
+  { 0xA5DEu, 0.00000000 },
+  { 0xA5DFu, 0.00000000 },
+  { 0xA5E0u, 0.00000000 },
+  { 0xA5E1u, 0.00000000 },
+  { 0xA5E2u, 0.00000000 },
+  { 0xA5E3u, 0.00000000 },
+  { 0xA5E4u, 0.00000000 },
+  { 0xA5E5u, 0.00000000 },
+  { 0xA5E6u, 0.00000000 },
+  { 0xA5E7u, 0.00000000 },
+  { 0xA5E8u, 0.00000000 },
+  { 0xA5E9u, 0.00000000 },
+  { 0xA5EAu, 0.00000000 },
+  { 0xA5EBu, 0.00000000 },
+  { 0xA5ECu, 0.00000000 },
+  { 0xA5EDu, 0.00000000 },
+  { 0xA5EEu, 0.00000000 },
+  { 0xA5EFu, 0.00000000 },
+  { 0xA5F0u, 0.00000000 },
+  { 0xA5F1u, 0.00000000 },
+  { 0xA5F2u, 0.00000000 },
+  { 0xA5F3u, 0.00000000 },
+  { 0xA5F4u, 0.00000000 },
+  { 0xA5F5u, 0.00000000 },
+  { 0xA5F6u, 0.00000000 },
+  { 0xA5F7u, 0.00000000 },
+  { 0xA5F8u, 0.00000000 },
+  { 0xA5F9u, 0.00000000 },
+  { 0xA5FAu, 0.00000000 },
+  { 0xA5FBu, 0.00000000 },
+  { 0xA5FCu, 0.00000000 },
+  { 0xA5FDu, 0.00000000 },
+  { 0xA5FEu, 0.00000000 },
+  { 0xA5FFu, 0.00000000 },
+  { 0xA600u, 0.00000000 },
+  { 0xA601u, 0.00000000 },
+  { 0xA602u, 0.00000000 },
+  { 0xA603u, 0.00000000 },
+  { 0xA604u, 0.00000000 },
+  { 0xA605u, 0.00000000 },
+  { 0xA606u, 0.00000000 },
+  { 0xA607u, 0.00000000 },
+  { 0xA608u, 0.00000000 },
+  { 0xA609u, 0.00000000 },
+  { 0xA60Au, 0.00000000 },
+  { 0xA60Bu, 0.00000000 },
+  { 0xA60Cu, 0.00000000 },
+  { 0xA610u, 0.00000000 },
+  { 0xA611u, 0.00000000 },
+  { 0xA612u, 0.00000000 },
+  { 0xA62Au, 0.00000000 },
+  { 0xA62Bu, 0.00000000 },
+};
+
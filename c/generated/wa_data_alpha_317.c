@@ -0,0 +1,137 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_317_UPPER[] = {
+  "A",
+  "B",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+  "Ḓ",
+  "Ḽ",
+  "Ṅ",
+  "Ṋ",
+  "Ṱ",
+};
+const char *ALPHA_317_LOWER[] = {
+  "a",
+  "b",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+  "ḓ",
+  "ḽ",
+  "ṅ",
+  "ṋ",
+  "ṱ",
+};
+const char *ALPHA_317_DIGITS[] = {
+};
+const uint32_t ALPHA_317_UPPER_CPS[] = {
+  65, 66, 68, 69, 70, 71, 72, 73, 75, 76, 77, 78, 79, 80, 82, 83,
+  84, 85, 86, 87, 88, 89, 90, 7698, 7740, 7748, 7754, 7792,
+};
+const uint32_t ALPHA_317_LOWER_CPS[] = {
+  97, 98, 100, 101, 102, 103, 104, 105, 107, 108, 109, 110, 111, 112, 114, 115,
+  116, 117, 118, 119, 120, 121, 122, 7699, 7741, 7749, 7755, 7793,
+};
+const uint32_t ALPHA_317_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_317_FREQ[] = {
+  { "a", 0.17080000 },
+  { "b", 0.01570000 },
+  { "d", 0.04010000 },
+  { "e", 0.05010000 },
+  { "f", 0.01230000 },
+  { "g", 0.01690000 },
+  { "h", 0.10550000 },
+  { "i", 0.08440000 },
+  { "k", 0.02140000 },
+  { "l", 0.03760000 },
+  { "m", 0.03810000 },
+  { "n", 0.07890000 },
+  { "o", 0.05310000 },
+  { "p", 0.00870000 },
+  { "r", 0.01510000 },
+  { "s", 0.03910000 },
+  { "t", 0.03790000 },
+  { "u", 0.06380000 },
+  { "v", 0.04370000 },
+  { "w", 0.02990000 },
+  { "x", 0.00030000 },
+  { "y", 0.01180000 },
+  { "z", 0.02290000 },
+  { "ḓ", 0.00080000 },
+  { "ḽ", 0.00030000 },
+  { "ṅ", 0.00040000 },
+  { "ṋ", 0.00000000 },
+  { "ṱ", 0.00050000 },
+};
+
+const wa_cp_freq ALPHA_317_FREQ_CPS[] = {
+  { 0x61u, 0.17080000 },
+  { 0x62u, 0.01570000 },
+  { 0x64u, 0.04010000 },
+  { 0x65u, 0.05010000 },
+  { 0x66u, 0.01230000 },
+  { 0x67u, 0.01690000 },
+  { 0x68u, 0.10550000 },
+  { 0x69u, 0.08440000 },
+  { 0x6Bu, 0.02140000 },
+  { 0x6Cu, 0.03760000 },
+  { 0x6Du, 0.03810000 },
+  { 0x6Eu, 0.07890000 },
+  { 0x6Fu, 0.05310000 },
+  { 0x70u, 0.00870000 },
+  { 0x72u, 0.01510000 },
+  { 0x73u, 0.03910000 },
+  { 0x74u, 0.03790000 },
+  { 0x75u, 0.06380000 },
+  { 0x76u, 0.04370000 },
+  { 0x77u, 0.02990000 },
+  { 0x78u, 0.00030000 },
+  { 0x79u, 0.01180000 },
+  { 0x7Au, 0.02290000 },
+  { 0x1E13u, 0.00080000 },
+  { 0x1E3Du, 0.00030000 },
+  { 0x1E45u, 0.00040000 },
+  { 0x1E4Bu, 0.00000000 },
+  { 0x1E71u, 0.00050000 },
+};
+
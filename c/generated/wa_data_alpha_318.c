@@ -0,0 +1,151 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_318_UPPER[] = {
+  "A",
+  "À",
+  "B",
+  "C",
+  "D",
+  "E",
+  "É",
+  "È",
+  "F",
+  "G",
+  "H",
+  "I",
+  "Ì",
+  "J",
+  "L",
+  "M",
+  "N",
+  "O",
+  "Ó",
+  "Ò",
+  "P",
+  "R",
+  "S",
+  "T",
+  "U",
+  "Ù",
+  "V",
+  "X",
+  "Z",
+};
+const char *ALPHA_318_LOWER[] = {
+  "a",
+  "à",
+  "b",
+  "c",
+  "d",
+  "e",
+  "é",
+  "è",
+  "f",
+  "g",
+  "h",
+  "i",
+  "ì",
+  "j",
+  "l",
+  "m",
+  "n",
+  "o",
+  "ó",
+  "ò",
+  "p",
+  "r",
+  "s",
+  "t",
+  "u",
+  "ù",
+  "v",
+  "x",
+  "z",
+};
+const char *ALPHA_318_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_318_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 76, 77, 78, 79, 80, 82,
+  83, 84, 85, 86, 88, 90, 192, 200, 201, 204, 210, 211, 217,
+};
+const uint32_t ALPHA_318_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 108, 109, 110, 111, 112, 114,
+  115, 116, 117, 118, 120, 122, 224, 232, 233, 236, 242, 243, 249,
+};
+const uint32_t ALPHA_318_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_318_FREQ[] = {
+  { "a", 0.12940000 },
+  { "à", 0.00930000 },
+  { "b", 0.00980000 },
+  { "c", 0.03890000 },
+  { "d", 0.04440000 },
+  { "e", 0.13020000 },
+  { "é", 0.00230000 },
+  { "è", 0.00280000 },
+  { "f", 0.01110000 },
+  { "g", 0.01960000 },
+  { "h", 0.00960000 },
+  { "i", 0.09510000 },
+  { "ì", 0.00230000 },
+  { "j", 0.00220000 },
+  { "l", 0.05110000 },
+  { "m", 0.02380000 },
+  { "n", 0.07540000 },
+  { "o", 0.08450000 },
+  { "ó", 0.00120000 },
+  { "ò", 0.00130000 },
+  { "p", 0.02750000 },
+  { "r", 0.06320000 },
+  { "s", 0.05120000 },
+  { "t", 0.05850000 },
+  { "u", 0.02300000 },
+  { "ù", 0.00110000 },
+  { "v", 0.01630000 },
+  { "x", 0.01180000 },
+  { "z", 0.00330000 },
+};
+
+const wa_cp_freq ALPHA_318_FREQ_CPS[] = {
+  { 0x61u, 0.12940000 },
+  { 0x62u, 0.00980000 },
+  { 0x63u, 0.03890000 },
+  { 0x64u, 0.04440000 },
+  { 0x65u, 0.13020000 },
+  { 0x66u, 0.01110000 },
+  { 0x67u, 0.01960000 },
+  { 0x68u, 0.00960000 },
+  { 0x69u, 0.09510000 },
+  { 0x6Au, 0.00220000 },
+  { 0x6Cu, 0.05110000 },
+  { 0x6Du, 0.02380000 },
+  { 0x6Eu, 0.07540000 },
+  { 0x6Fu, 0.08450000 },
+  { 0x70u, 0.02750000 },
+  { 0x72u, 0.06320000 },
+  { 0x73u, 0.05120000 },
+  { 0x74u, 0.05850000 },
+  { 0x75u, 0.02300000 },
+  { 0x76u, 0.01630000 },
+  { 0x78u, 0.01180000 },
+  { 0x7Au, 0.00330000 },
+  { 0xE0u, 0.00930000 },
+  { 0xE8u, 0.00280000 },
+  { 0xE9u, 0.00230000 },
+  { 0xECu, 0.00230000 },
+  { 0xF2u, 0.00130000 },
+  { 0xF3u, 0.00120000 },
+  { 0xF9u, 0.00110000 },
+};
+
@@ -0,0 +1,151 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_319_UPPER[] = {
+  "A",
+  "Ă",
+  "Â",
+  "B",
+  "C",
+  "D",
+  "Đ",
+  "E",
+  "Ê",
+  "G",
+  "H",
+  "I",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "Ô",
+  "Ơ",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "Ư",
+  "V",
+  "X",
+  "Y",
+};
+const char *ALPHA_319_LOWER[] = {
+  "a",
+  "ă",
+  "â",
+  "b",
+  "c",
+  "d",
+  "đ",
+  "e",
+  "ê",
+  "g",
+  "h",
+  "i",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "ô",
+  "ơ",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "ư",
+  "v",
+  "x",
+  "y",
+};
+const char *ALPHA_319_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_319_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 71, 72, 73, 75, 76, 77, 78, 79, 80, 81, 82,
+  83, 84, 85, 86, 88, 89, 194, 202, 212, 258, 272, 416, 431,
+};
+const uint32_t ALPHA_319_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 103, 104, 105, 107, 108, 109, 110, 111, 112, 113, 114,
+  115, 116, 117, 118, 120, 121, 226, 234, 244, 259, 273, 417, 432,
+};
+const uint32_t ALPHA_319_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_319_FREQ[] = {
+  { "a", 0.05450000 },
+  { "ă", 0.00560000 },
+  { "â", 0.00820000 },
+  { "b", 0.01830000 },
+  { "c", 0.07270000 },
+  { "d", 0.01570000 },
+  { "đ", 0.02830000 },
+  { "e", 0.02270000 },
+  { "ê", 0.00800000 },
+  { "g", 0.05800000 },
+  { "h", 0.09940000 },
+  { "i", 0.07460000 },
+  { "k", 0.01500000 },
+  { "l", 0.03370000 },
+  { "m", 0.03610000 },
+  { "n", 0.13650000 },
+  { "o", 0.03780000 },
+  { "ô", 0.00850000 },
+  { "ơ", 0.00390000 },
+  { "p", 0.01920000 },
+  { "q", 0.00570000 },
+  { "r", 0.03230000 },
+  { "s", 0.02340000 },
+  { "t", 0.08410000 },
+  { "u", 0.03690000 },
+  { "ư", 0.01760000 },
+  { "v", 0.02130000 },
+  { "x", 0.00390000 },
+  { "y", 0.01790000 },
+};
+
+const wa_cp_freq ALPHA_319_FREQ_CPS[] = {
+  { 0x61u, 0.05450000 },
+  { 0x62u, 0.01830000 },
+  { 0x63u, 0.07270000 },
+  { 0x64u, 0.01570000 },
+  { 0x65u, 0.02270000 },
+  { 0x67u, 0.05800000 },
+  { 0x68u, 0.09940000 },
+  { 0x69u, 0.07460000 },
+  { 0x6Bu, 0.01500000 },
+  { 0x6Cu, 0.03370000 },
+  { 0x6Du, 0.03610000 },
+  { 0x6Eu, 0.13650000 },
+  { 0x6Fu, 0.03780000 },
+  { 0x70u, 0.01920000 },
+  { 0x71u, 0.00570000 },
+  { 0x72u, 0.03230000 },
+  { 0x73u, 0.02340000 },
+  { 0x74u, 0.08410000 },
+  { 0x75u, 0.03690000 },
+  { 0x76u, 0.02130000 },
+  { 0x78u, 0.00390000 },
+  { 0x79u, 0.01790000 },
+  { 0xE2u, 0.00820000 },
+  { 0xEAu, 0.00800000 },
+  { 0xF4u, 0.00850000 },
+  { 0x103u, 0.00560000 },
+  { 0x111u, 0.02830000 },
+  { 0x1A1u, 0.00390000 },
+  { 0x1B0u, 0.01760000 },
+};
+
@@ -0,0 +1,143 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_32_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "Ɛ",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "Ɲ",
+  "Ŋ",
+  "O",
+  "Ɔ",
+  "P",
+  "R",
+  "S",
+  "T",
+  "U",
+  "W",
+  "Y",
+  "Z",
+};
+const char *ALPHA_32_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "ɛ",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "ɲ",
+  "ŋ",
+  "o",
+  "ɔ",
+  "p",
+  "r",
+  "s",
+  "t",
+  "u",
+  "w",
+  "y",
+  "z",
+};
+const char *ALPHA_32_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_32_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  82, 83, 84, 85, 87, 89, 90, 330, 390, 400, 413,
+};
+const uint32_t ALPHA_32_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  114, 115, 116, 117, 119, 121, 122, 331, 596, 603, 626,
+};
+const uint32_t ALPHA_32_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_32_FREQ[] = {
+  { "a", 0.18170000 },
+  { "b", 0.03720000 },
+  { "c", 0.00730000 },
+  { "d", 0.02920000 },
+  { "e", 0.05320000 },
+  { "ɛ", 0.02670000 },
+  { "f", 0.02350000 },
+  { "g", 0.02520000 },
+  { "h", 0.00460000 },
+  { "i", 0.07780000 },
+  { "j", 0.01190000 },
+  { "k", 0.05690000 },
+  { "l", 0.04800000 },
+  { "m", 0.03870000 },
+  { "n", 0.11110000 },
+  { "ɲ", 0.00290000 },
+  { "ŋ", 0.00030000 },
+  { "o", 0.04860000 },
+  { "ɔ", 0.02950000 },
+  { "p", 0.00360000 },
+  { "r", 0.03570000 },
+  { "s", 0.03570000 },
+  { "t", 0.02690000 },
+  { "u", 0.04200000 },
+  { "w", 0.01520000 },
+  { "y", 0.02500000 },
+  { "z", 0.00160000 },
+};
+
+const wa_cp_freq ALPHA_32_FREQ_CPS[] = {
+  { 0x61u, 0.18170000 },
+  { 0x62u, 0.03720000 },
+  { 0x63u, 0.00730000 },
+  { 0x64u, 0.02920000 },
+  { 0x65u, 0.05320000 },
+  { 0x66u, 0.02350000 },
+  { 0x67u, 0.02520000 },
+  { 0x68u, 0.00460000 },
+  { 0x69u, 0.07780000 },
+  { 0x6Au, 0.01190000 },
+  { 0x6Bu, 0.05690000 },
+  { 0x6Cu, 0.04800000 },
+  { 0x6Du, 0.03870000 },
+  { 0x6Eu, 0.11110000 },
+  { 0x6Fu, 0.04860000 },
+  { 0x70u, 0.00360000 },
+  { 0x72u, 0.03570000 },
+  { 0x73u, 0.03570000 },
+  { 0x74u, 0.02690000 },
+  { 0x75u, 0.04200000 },
+  { 0x77u, 0.01520000 },
+  { 0x79u, 0.02500000 },
+  { 0x7Au, 0.00160000 },
+  { 0x14Bu, 0.00030000 },
+  { 0x254u, 0.02950000 },
+  { 0x25Bu, 0.02670000 },
+  { 0x272u, 0.00290000 },
+};
+
@@ -0,0 +1,133 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_321_UPPER[] = {
+  "A",
+  "Ä",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "Ö",
+  "P",
+  "R",
+  "S",
+  "T",
+  "U",
+  "Ü",
+  "V",
+  "X",
+  "Y",
+  "Z",
+};
+const char *ALPHA_321_LOWER[] = {
+  "a",
+  "ä",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "ö",
+  "p",
+  "r",
+  "s",
+  "t",
+  "u",
+  "ü",
+  "v",
+  "x",
+  "y",
+  "z",
+};
+const char *ALPHA_321_DIGITS[] = {
+};
+const uint32_t ALPHA_321_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  82, 83, 84, 85, 86, 88, 89, 90, 196, 214, 220,
+};
+const uint32_t ALPHA_321_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  114, 115, 116, 117, 118, 120, 121, 122, 228, 246, 252,
+};
+const uint32_t ALPHA_321_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_321_FREQ[] = {
+  { "a", 0.09500000 },
+  { "ä", 0.03820000 },
+  { "b", 0.03780000 },
+  { "c", 0.00700000 },
+  { "d", 0.05170000 },
+  { "e", 0.07710000 },
+  { "f", 0.02510000 },
+  { "g", 0.00670000 },
+  { "h", 0.00500000 },
+  { "i", 0.07820000 },
+  { "j", 0.00250000 },
+  { "k", 0.02040000 },
+  { "l", 0.08190000 },
+  { "m", 0.04550000 },
+  { "n", 0.10220000 },
+  { "o", 0.06760000 },
+  { "ö", 0.02630000 },
+  { "p", 0.02280000 },
+  { "r", 0.01970000 },
+  { "s", 0.07160000 },
+  { "t", 0.04190000 },
+  { "u", 0.02420000 },
+  { "ü", 0.02160000 },
+  { "v", 0.01360000 },
+  { "x", 0.00040000 },
+  { "y", 0.01030000 },
+  { "z", 0.00560000 },
+};
+
+const wa_cp_freq ALPHA_321_FREQ_CPS[] = {
+  { 0x61u, 0.09500000 },
+  { 0x62u, 0.03780000 },
+  { 0x63u, 0.00700000 },
+  { 0x64u, 0.05170000 },
+  { 0x65u, 0.07710000 },
+  { 0x66u, 0.02510000 },
+  { 0x67u, 0.00670000 },
+  { 0x68u, 0.00500000 },
+  { 0x69u, 0.07820000 },
+  { 0x6Au, 0.00250000 },
+  { 0x6Bu, 0.02040000 },
+  { 0x6Cu, 0.08190000 },
+  { 0x6Du, 0.04550000 },
+  { 0x6Eu, 0.10220000 },
+  { 0x6Fu, 0.06760000 },
+  { 0x70u, 0.02280000 },
+  { 0x72u, 0.01970000 },
+  { 0x73u, 0.07160000 },
+  { 0x74u, 0.04190000 },
+  { 0x75u, 0.02420000 },
+  { 0x76u, 0.01360000 },
+  { 0x78u, 0.00040000 },
+  { 0x79u, 0.01030000 },
+  { 0x7Au, 0.00560000 },
+  { 0xE4u, 0.03820000 },
+  { 0xF6u, 0.02630000 },
+  { 0xFCu, 0.02160000 },
+};
+
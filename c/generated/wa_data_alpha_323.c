@@ -0,0 +1,199 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_323_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+  "À",
+  "Â",
+  "Å",
+  "Æ",
+  "Ç",
+  "È",
+  "É",
+  "Ê",
+  "Ë",
+  "Î",
+  "Ï",
+  "Ô",
+  "Ù",
+  "Û",
+  "Ü",
+  "Ÿ",
+  "Œ",
+};
+const char *ALPHA_323_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+  "à",
+  "â",
+  "å",
+  "æ",
+  "ç",
+  "è",
+  "é",
+  "ê",
+  "ë",
+  "î",
+  "ï",
+  "ô",
+  "ù",
+  "û",
+  "ü",
+  "ÿ",
+  "œ",
+};
+const char *ALPHA_323_DIGITS[] = {
+};
+const uint32_t ALPHA_323_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 192, 194, 197, 198, 199, 200,
+  201, 202, 203, 206, 207, 212, 217, 219, 220, 338, 376,
+};
+const uint32_t ALPHA_323_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 224, 226, 229, 230, 231, 232,
+  233, 234, 235, 238, 239, 244, 249, 251, 252, 255, 339,
+};
+const uint32_t ALPHA_323_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_323_FREQ[] = {
+  { "a", 0.06440000 },
+  { "b", 0.01110000 },
+  { "c", 0.03280000 },
+  { "d", 0.05350000 },
+  { "e", 0.14000000 },
+  { "f", 0.01010000 },
+  { "g", 0.00840000 },
+  { "h", 0.01210000 },
+  { "i", 0.07800000 },
+  { "j", 0.01410000 },
+  { "k", 0.01240000 },
+  { "l", 0.05360000 },
+  { "m", 0.02620000 },
+  { "n", 0.07350000 },
+  { "o", 0.06530000 },
+  { "p", 0.02350000 },
+  { "q", 0.00030000 },
+  { "r", 0.04590000 },
+  { "s", 0.08800000 },
+  { "t", 0.06170000 },
+  { "u", 0.02740000 },
+  { "v", 0.01650000 },
+  { "w", 0.01110000 },
+  { "x", 0.00210000 },
+  { "y", 0.01680000 },
+  { "z", 0.00540000 },
+  { "à", 0.00020000 },
+  { "â", 0.00020000 },
+  { "å", 0.01080000 },
+  { "æ", 0.00000000 },
+  { "ç", 0.00130000 },
+  { "è", 0.00690000 },
+  { "é", 0.00850000 },
+  { "ê", 0.00350000 },
+  { "ë", 0.00020000 },
+  { "î", 0.00820000 },
+  { "ï", 0.00000000 },
+  { "ô", 0.00350000 },
+  { "ù", 0.00000000 },
+  { "û", 0.00230000 },
+  { "ü", 0.00000000 },
+  { "ÿ", 0.00000000 },
+  { "œ", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_323_FREQ_CPS[] = {
+  { 0x61u, 0.06440000 },
+  { 0x62u, 0.01110000 },
+  { 0x63u, 0.03280000 },
+  { 0x64u, 0.05350000 },
+  { 0x65u, 0.14000000 },
+  { 0x66u, 0.01010000 },
+  { 0x67u, 0.00840000 },
+  { 0x68u, 0.01210000 },
+  { 0x69u, 0.07800000 },
+  { 0x6Au, 0.01410000 },
+  { 0x6Bu, 0.01240000 },
+  { 0x6Cu, 0.05360000 },
+  { 0x6Du, 0.02620000 },
+  { 0x6Eu, 0.07350000 },
+  { 0x6Fu, 0.06530000 },
+  { 0x70u, 0.02350000 },
+  { 0x71u, 0.00030000 },
+  { 0x72u, 0.04590000 },
+  { 0x73u, 0.08800000 },
+  { 0x74u, 0.06170000 },
+  { 0x75u, 0.02740000 },
+  { 0x76u, 0.01650000 },
+  { 0x77u, 0.01110000 },
+  { 0x78u, 0.00210000 },
+  { 0x79u, 0.01680000 },
+  { 0x7Au, 0.00540000 },
+  { 0xE0u, 0.00020000 },
+  { 0xE2u, 0.00020000 },
+  { 0xE5u, 0.01080000 },
+  { 0xE6u, 0.00000000 },
+  { 0xE7u, 0.00130000 },
+  { 0xE8u, 0.00690000 },
+  { 0xE9u, 0.00850000 },
+  { 0xEAu, 0.00350000 },
+  { 0xEBu, 0.00020000 },
+  { 0xEEu, 0.00820000 },
+  { 0xEFu, 0.00000000 },
+  { 0xF4u, 0.00350000 },
+  { 0xF9u, 0.00000000 },
+  { 0xFBu, 0.00230000 },
+  { 0xFCu, 0.00000000 },
+  { 0xFFu, 0.00000000 },
+  { 0x153u, 0.00000000 },
+};
+
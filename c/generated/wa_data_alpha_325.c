@@ -0,0 +1,93 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_325_UPPER[] = {
+  "A",
+  "D",
+  "G",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "P",
+  "R",
+  "T",
+  "U",
+  "W",
+  "Y",
+};
+const char *ALPHA_325_LOWER[] = {
+  "a",
+  "d",
+  "g",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "p",
+  "r",
+  "t",
+  "u",
+  "w",
+  "y",
+};
+const char *ALPHA_325_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_325_UPPER_CPS[] = {
+  65, 68, 71, 73, 74, 75, 76, 77, 78, 80, 82, 84, 85, 87, 89,
+};
+const uint32_t ALPHA_325_LOWER_CPS[] = {
+  97, 100, 103, 105, 106, 107, 108, 109, 110, 112, 114, 116, 117, 119, 121,
+};
+const uint32_t ALPHA_325_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_325_FREQ[] = {
+  { "a", 0.00000000 },
+  { "d", 0.00000000 },
+  { "g", 0.00000000 },
+  { "i", 0.00000000 },
+  { "j", 0.00000000 },
+  { "k", 0.00000000 },
+  { "l", 0.00000000 },
+  { "m", 0.00000000 },
+  { "n", 0.00000000 },
+  { "p", 0.00000000 },
+  { "r", 0.00000000 },
+  { "t", 0.00000000 },
+  { "u", 0.00000000 },
+  { "w", 0.00000000 },
+  { "y", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_325_FREQ_CPS[] = {
+  { 0x61u, 0.00000000 },
+  { 0x64u, 0.00000000 },
+  { 0x67u, 0.00000000 },
+  { 0x69u, 0.00000000 },
+  { 0x6Au, 0.00000000 },
+  { 0x6Bu, 0.00000000 },
+  { 0x6Cu, 0.00000000 },
+  { 0x6Du, 0.00000000 },
+  { 0x6Eu, 0.00000000 },
+  { 0x70u, 0.00000000 },
+  { 0x72u, 0.00000000 },
+  { 0x74u, 0.00000000 },
+  { 0x75u, 0.00000000 },
+  { 0x77u, 0.00000000 },
+  { 0x79u, 0.00000000 },
+};
+
@@ -0,0 +1,141 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_326_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "Ŋ",
+  "O",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "W",
+  "X",
+  "Y",
+  "À",
+  "É",
+  "Ë",
+  "Ñ",
+  "Ó",
+};
+const char *ALPHA_326_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "ŋ",
+  "o",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "w",
+  "x",
+  "y",
+  "à",
+  "é",
+  "ë",
+  "ñ",
+  "ó",
+};
+const char *ALPHA_326_DIGITS[] = {
+};
+const uint32_t ALPHA_326_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 73, 74, 75, 76, 77, 78, 79, 80, 81,
+  82, 83, 84, 85, 87, 88, 89, 192, 201, 203, 209, 211, 330,
+};
+const uint32_t ALPHA_326_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 105, 106, 107, 108, 109, 110, 111, 112, 113,
+  114, 115, 116, 117, 119, 120, 121, 224, 233, 235, 241, 243, 331,
+};
+const uint32_t ALPHA_326_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_326_FREQ[] = {
+  { "a", 0.14740000 },
+  { "b", 0.03180000 },
+  { "c", 0.02050000 },
+  { "d", 0.03250000 },
+  { "e", 0.06890000 },
+  { "f", 0.01240000 },
+  { "g", 0.03740000 },
+  { "i", 0.08290000 },
+  { "j", 0.01850000 },
+  { "k", 0.03860000 },
+  { "l", 0.04980000 },
+  { "m", 0.04770000 },
+  { "n", 0.07070000 },
+  { "ŋ", 0.00020000 },
+  { "o", 0.07450000 },
+  { "p", 0.00910000 },
+  { "q", 0.00120000 },
+  { "r", 0.02980000 },
+  { "s", 0.02330000 },
+  { "t", 0.03420000 },
+  { "u", 0.05990000 },
+  { "w", 0.02130000 },
+  { "x", 0.01520000 },
+  { "y", 0.03390000 },
+  { "à", 0.00900000 },
+  { "é", 0.00550000 },
+  { "ë", 0.01030000 },
+  { "ñ", 0.01270000 },
+  { "ó", 0.00070000 },
+};
+
+const wa_cp_freq ALPHA_326_FREQ_CPS[] = {
+  { 0x61u, 0.14740000 },
+  { 0x62u, 0.03180000 },
+  { 0x63u, 0.02050000 },
+  { 0x64u, 0.03250000 },
+  { 0x65u, 0.06890000 },
+  { 0x66u, 0.01240000 },
+  { 0x67u, 0.03740000 },
+  { 0x69u, 0.08290000 },
+  { 0x6Au, 0.01850000 },
+  { 0x6Bu, 0.03860000 },
+  { 0x6Cu, 0.04980000 },
+  { 0x6Du, 0.04770000 },
+  { 0x6Eu, 0.07070000 },
+  { 0x6Fu, 0.07450000 },
+  { 0x70u, 0.00910000 },
+  { 0x71u, 0.00120000 },
+  { 0x72u, 0.02980000 },
+  { 0x73u, 0.02330000 },
+  { 0x74u, 0.03420000 },
+  { 0x75u, 0.05990000 },
+  { 0x77u, 0.02130000 },
+  { 0x78u, 0.01520000 },
+  { 0x79u, 0.03390000 },
+  { 0xE0u, 0.00900000 },
+  { 0xE9u, 0.00550000 },
+  { 0xEBu, 0.01030000 },
+  { 0xF1u, 0.01270000 },
+  { 0xF3u, 0.00070000 },
+  { 0x14Bu, 0.00020000 },
+};
+
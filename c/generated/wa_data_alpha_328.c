@@ -0,0 +1,135 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_328_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+};
+const char *ALPHA_328_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+};
+const char *ALPHA_328_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_328_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  82, 83, 84, 85, 86, 87, 88, 89, 90,
+};
+const uint32_t ALPHA_328_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  114, 115, 116, 117, 118, 119, 120, 121, 122,
+};
+const uint32_t ALPHA_328_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_328_FREQ[] = {
+  { "n", 0.10060000 },
+  { "a", 0.16980000 },
+  { "u", 0.06780000 },
+  { "m", 0.04380000 },
+  { "i", 0.06860000 },
+  { "l", 0.04510000 },
+  { "k", 0.07050000 },
+  { "e", 0.09990000 },
+  { "j", 0.01310000 },
+  { "t", 0.05840000 },
+  { "y", 0.01360000 },
+  { "g", 0.04850000 },
+  { "p", 0.04040000 },
+  { "d", 0.02560000 },
+  { "b", 0.02670000 },
+  { "c", 0.00720000 },
+  { "s", 0.03220000 },
+  { "r", 0.02010000 },
+  { "o", 0.03050000 },
+  { "h", 0.01040000 },
+  { "w", 0.00550000 },
+  { "z", 0.00040000 },
+  { "f", 0.00060000 },
+  { "v", 0.00040000 },
+  { "x", 0.00020000 },
+};
+
+const wa_cp_freq ALPHA_328_FREQ_CPS[] = {
+  { 0x61u, 0.16980000 },
+  { 0x62u, 0.02670000 },
+  { 0x63u, 0.00720000 },
+  { 0x64u, 0.02560000 },
+  { 0x65u, 0.09990000 },
+  { 0x66u, 0.00060000 },
+  { 0x67u, 0.04850000 },
+  { 0x68u, 0.01040000 },
+  { 0x69u, 0.06860000 },
+  { 0x6Au, 0.01310000 },
+  { 0x6Bu, 0.07050000 },
+  { 0x6Cu, 0.04510000 },
+  { 0x6Du, 0.04380000 },
+  { 0x6Eu, 0.10060000 },
+  { 0x6Fu, 0.03050000 },
+  { 0x70u, 0.04040000 },
+  { 0x72u, 0.02010000 },
+  { 0x73u, 0.03220000 },
+  { 0x74u, 0.05840000 },
+  { 0x75u, 0.06780000 },
+  { 0x76u, 0.00040000 },
+  { 0x77u, 0.00550000 },
+  { 0x78u, 0.00020000 },
+  { 0x79u, 0.01360000 },
+  { 0x7Au, 0.00040000 },
+};
+
@@ -0,0 +1,217 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_331_UPPER[] = {
+  "A",
+  "Á",
+  "À",
+  "Â",
+  "Ǎ",
+  "Ā",
+  "B",
+  "C",
+  "D",
+  "E",
+  "É",
+  "È",
+  "Ɛ",
+  "F",
+  "H",
+  "I",
+  "Í",
+  "Ì",
+  "Î",
+  "Ī",
+  "K",
+  "L",
+  "M",
+  "N",
+  "Y",
+  "Ŋ",
+  "G",
+  "O",
+  "Ó",
+  "Ò",
+  "Ô",
+  "Ǒ",
+  "Ō",
+  "Ɔ",
+  "P",
+  "S",
+  "T",
+  "U",
+  "Ú",
+  "Ù",
+  "Û",
+  "Ǔ",
+  "Ū",
+  "V",
+  "W",
+};
+const char *ALPHA_331_LOWER[] = {
+  "a",
+  "á",
+  "à",
+  "â",
+  "ǎ",
+  "ā",
+  "b",
+  "c",
+  "d",
+  "e",
+  "é",
+  "è",
+  "ɛ",
+  "f",
+  "h",
+  "i",
+  "í",
+  "ì",
+  "î",
+  "ī",
+  "k",
+  "l",
+  "m",
+  "n",
+  "y",
+  "ŋ",
+  "g",
+  "o",
+  "ó",
+  "ò",
+  "ô",
+  "ǒ",
+  "ō",
+  "ɔ",
+  "p",
+  "s",
+  "t",
+  "u",
+  "ú",
+  "ù",
+  "û",
+  "ǔ",
+  "ū",
+  "v",
+  "w",
+};
+const char *ALPHA_331_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_331_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 75, 76, 77, 78, 79, 80, 83,
+  84, 85, 86, 87, 89, 192, 193, 194, 200, 201, 204, 205, 206, 210, 211, 212,
+  217, 218, 219, 256, 298, 330, 332, 362, 390, 400, 461, 465, 467,
+};
+const uint32_t ALPHA_331_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 107, 108, 109, 110, 111, 112, 115,
+  116, 117, 118, 119, 121, 224, 225, 226, 232, 233, 236, 237, 238, 242, 243, 244,
+  249, 250, 251, 257, 299, 331, 333, 363, 462, 466, 468, 596, 603,
+};
+const uint32_t ALPHA_331_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_331_FREQ[] = {
+  { "a", 0.00000000 },
+  { "á", 0.00000000 },
+  { "à", 0.00000000 },
+  { "â", 0.00000000 },
+  { "ǎ", 0.00000000 },
+  { "ā", 0.00000000 },
+  { "b", 0.00000000 },
+  { "c", 0.00000000 },
+  { "d", 0.00000000 },
+  { "e", 0.00000000 },
+  { "é", 0.00000000 },
+  { "è", 0.00000000 },
+  { "ɛ", 0.00000000 },
+  { "f", 0.00000000 },
+  { "h", 0.00000000 },
+  { "i", 0.00000000 },
+  { "í", 0.00000000 },
+  { "ì", 0.00000000 },
+  { "î", 0.00000000 },
+  { "ī", 0.00000000 },
+  { "k", 0.00000000 },
+  { "l", 0.00000000 },
+  { "m", 0.00000000 },
+  { "n", 0.00000000 },
+  { "y", 0.00000000 },
+  { "ŋ", 0.00000000 },
+  { "g", 0.00000000 },
+  { "o", 0.00000000 },
+  { "ó", 0.00000000 },
+  { "ò", 0.00000000 },
+  { "ô", 0.00000000 },
+  { "ǒ", 0.00000000 },
+  { "ō", 0.00000000 },
+  { "ɔ", 0.00000000 },
+  { "p", 0.00000000 },
+  { "s", 0.00000000 },
+  { "t", 0.00000000 },
+  { "u", 0.00000000 },
+  { "ú", 0.00000000 },
+  { "ù", 0.00000000 },
+  { "û", 0.00000000 },
+  { "ǔ", 0.00000000 },
+  { "ū", 0.00000000 },
+  { "v", 0.00000000 },
+  { "w", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_331_FREQ_CPS[] = {
+  { 0x61u, 0.00000000 },
+  { 0x62u, 0.00000000 },
+  { 0x63u, 0.00000000 },
+  { 0x64u, 0.00000000 },
+  { 0x65u, 0.00000000 },
+  { 0x66u, 0.00000000 },
+  { 0x67u, 0.00000000 },
+  { 0x68u, 0.00000000 },
+  { 0x69u, 0.00000000 },
+  { 0x6Bu, 0.00000000 },
+  { 0x6Cu, 0.00000000 },
+  { 0x6Du, 0.00000000 },
+  { 0x6Eu, 0.00000000 },
+  { 0x6Fu, 0.00000000 },
+  { 0x70u, 0.00000000 },
+  { 0x73u, 0.00000000 },
+  { 0x74u, 0.00000000 },
+  { 0x75u, 0.00000000 },
+  { 0x76u, 0.00000000 },
+  { 0x77u, 0.00000000 },
+  { 0x79u, 0.00000000 },
+  { 0xE0u, 0.00000000 },
+  { 0xE1u, 0.00000000 },
+  { 0xE2u, 0.00000000 },
+  { 0xE8u, 0.00000000 },
+  { 0xE9u, 0.00000000 },
+  { 0xECu, 0.00000000 },
+  { 0xEDu, 0.00000000 },
+  { 0xEEu, 0.00000000 },
+  { 0xF2u, 0.00000000 },
+  { 0xF3u, 0.00000000 },
+  { 0xF4u, 0.00000000 },
+  { 0xF9u, 0.00000000 },
+  { 0xFAu, 0.00000000 },
+  { 0xFBu, 0.00000000 },
+  { 0x101u, 0.00000000 },
+  { 0x12Bu, 0.00000000 },
+  { 0x14Bu, 0.00000000 },
+  { 0x14Du, 0.00000000 },
+  { 0x16Bu, 0.00000000 },
+  { 0x1CEu, 0.00000000 },
+  { 0x1D2u, 0.00000000 },
+  { 0x1D4u, 0.00000000 },
+  { 0x254u, 0.00000000 },
+  { 0x25Bu, 0.00000000 },
+};
+
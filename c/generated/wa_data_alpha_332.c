@@ -0,0 +1,137 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_332_UPPER[] = {
+  "א",
+  "ב",
+  "ג",
+  "ד",
+  "ה",
+  "ו",
+  "ז",
+  "ח",
+  "ט",
+  "י",
+  "כ",
+  "ל",
+  "מ",
+  "נ",
+  "ס",
+  "ע",
+  "פ",
+  "צ",
+  "ק",
+  "ר",
+  "ש",
+  "ת",
+  "ך",
+  "ם",
+  "ן",
+  "ף",
+  "ץ",
+  "ײ",
+};
+const char *ALPHA_332_LOWER[] = {
+  "א",
+  "ב",
+  "ג",
+  "ד",
+  "ה",
+  "ו",
+  "ז",
+  "ח",
+  "ט",
+  "י",
+  "כ",
+  "ל",
+  "מ",
+  "נ",
+  "ס",
+  "ע",
+  "פ",
+  "צ",
+  "ק",
+  "ר",
+  "ש",
+  "ת",
+  "ך",
+  "ם",
+  "ן",
+  "ף",
+  "ץ",
+  "ײ",
+};
+const char *ALPHA_332_DIGITS[] = {
+};
+const uint32_t ALPHA_332_UPPER_CPS[] = {
+  1488, 1489, 1490, 1491, 1492, 1493, 1494, 1495, 1496, 1497, 1498, 1499, 1500, 1501, 1502, 1503,
+  1504, 1505, 1506, 1507, 1508, 1509, 1510, 1511, 1512, 1513, 1514, 1522,
+};
+const uint32_t ALPHA_332_LOWER_CPS[] = {
+  1488, 1489, 1490, 1491, 1492, 1493, 1494, 1495, 1496, 1497, 1498, 1499, 1500, 1501, 1502, 1503,
+  1504, 1505, 1506, 1507, 1508, 1509, 1510, 1511, 1512, 1513, 1514, 1522,
+};
+const uint32_t ALPHA_332_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_332_FREQ[] = {
+  { "א", 0.11780000 },
+  { "ב", 0.02320000 },
+  { "ג", 0.02920000 },
+  { "ד", 0.03730000 },
+  { "ה", 0.01670000 },
+  { "ו", 0.08920000 },
+  { "ז", 0.02410000 },
+  { "ח", 0.00350000 },
+  { "ט", 0.05600000 },
+  { "י", 0.13090000 },
+  { "כ", 0.00800000 },
+  { "ל", 0.03370000 },
+  { "מ", 0.02360000 },
+  { "נ", 0.04040000 },
+  { "ס", 0.02510000 },
+  { "ע", 0.10320000 },
+  { "פ", 0.03140000 },
+  { "צ", 0.01270000 },
+  { "ק", 0.01920000 },
+  { "ר", 0.07340000 },
+  { "ש", 0.02160000 },
+  { "ת", 0.00470000 },
+  { "ך", 0.00620000 },
+  { "ם", 0.00810000 },
+  { "ן", 0.05680000 },
+  { "ף", 0.00220000 },
+  { "ץ", 0.00130000 },
+  { "ײ", 0.00060000 },
+};
+
+const wa_cp_freq ALPHA_332_FREQ_CPS[] = {
+  { 0x5D0u, 0.11780000 },
+  { 0x5D1u, 0.02320000 },
+  { 0x5D2u, 0.02920000 },
+  { 0x5D3u, 0.03730000 },
+  { 0x5D4u, 0.01670000 },
+  { 0x5D5u, 0.08920000 },
+  { 0x5D6u, 0.02410000 },
+  { 0x5D7u, 0.00350000 },
+  { 0x5D8u, 0.05600000 },
+  { 0x5D9u, 0.13090000 },
+  { 0x5DAu, 0.00620000 },
+  { 0x5DBu, 0.00800000 },
+  { 0x5DCu, 0.03370000 },
+  { 0x5DDu, 0.00810000 },
+  { 0x5DEu, 0.02360000 },
+  { 0x5DFu, 0.05680000 },
+  { 0x5E0u, 0.04040000 },
+  { 0x5E1u, 0.02510000 },
+  { 0x5E2u, 0.10320000 },
+  { 0x5E3u, 0.00220000 },
+  { 0x5E4u, 0.03140000 },
+  { 0x5E5u, 0.00130000 },
+  { 0x5E6u, 0.01270000 },
+  { 0x5E7u, 0.01920000 },
+  { 0x5E8u, 0.07340000 },
+  { 0x5E9u, 0.02160000 },
+  { 0x5EAu, 0.00470000 },
+  { 0x5F2u, 0.00060000 },
+};
+
@@ -0,0 +1,175 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_333_UPPER[] = {
+  "A",
+  "B",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "R",
+  "S",
+  "T",
+  "U",
+  "W",
+  "Y",
+  "À",
+  "Á",
+  "È",
+  "É",
+  "Ì",
+  "Í",
+  "Ò",
+  "Ó",
+  "Ù",
+  "Ú",
+  "Ń",
+  "Ǹ",
+  "Ḿ",
+  "Ṣ",
+  "Ẹ",
+  "Ọ",
+};
+const char *ALPHA_333_LOWER[] = {
+  "a",
+  "b",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "r",
+  "s",
+  "t",
+  "u",
+  "w",
+  "y",
+  "à",
+  "á",
+  "è",
+  "é",
+  "ì",
+  "í",
+  "ò",
+  "ó",
+  "ù",
+  "ú",
+  "ń",
+  "ǹ",
+  "ḿ",
+  "ṣ",
+  "ẹ",
+  "ọ",
+};
+const char *ALPHA_333_DIGITS[] = {
+};
+const uint32_t ALPHA_333_UPPER_CPS[] = {
+  65, 66, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 82,
+  83, 84, 85, 87, 89, 192, 193, 200, 201, 204, 205, 210, 211, 217, 218, 323,
+  504, 7742, 7778, 7864, 7884,
+};
+const uint32_t ALPHA_333_LOWER_CPS[] = {
+  97, 98, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 114,
+  115, 116, 117, 119, 121, 224, 225, 232, 233, 236, 237, 242, 243, 249, 250, 324,
+  505, 7743, 7779, 7865, 7885,
+};
+const uint32_t ALPHA_333_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_333_FREQ[] = {
+  { "a", 0.06470000 },
+  { "b", 0.04030000 },
+  { "d", 0.02670000 },
+  { "e", 0.06500000 },
+  { "f", 0.00920000 },
+  { "g", 0.02630000 },
+  { "h", 0.00820000 },
+  { "i", 0.08280000 },
+  { "j", 0.03040000 },
+  { "k", 0.03210000 },
+  { "l", 0.04210000 },
+  { "m", 0.01630000 },
+  { "n", 0.07940000 },
+  { "o", 0.05930000 },
+  { "p", 0.01960000 },
+  { "r", 0.05000000 },
+  { "s", 0.03430000 },
+  { "t", 0.04780000 },
+  { "u", 0.02120000 },
+  { "w", 0.01580000 },
+  { "y", 0.01250000 },
+  { "à", 0.02320000 },
+  { "á", 0.02980000 },
+  { "è", 0.00860000 },
+  { "é", 0.02150000 },
+  { "ì", 0.03880000 },
+  { "í", 0.02470000 },
+  { "ò", 0.00880000 },
+  { "ó", 0.01010000 },
+  { "ù", 0.00300000 },
+  { "ú", 0.00860000 },
+  { "ń", 0.00150000 },
+  { "ǹ", 0.00000000 },
+  { "ḿ", 0.00000000 },
+  { "ṣ", 0.00080000 },
+  { "ẹ", 0.02500000 },
+  { "ọ", 0.01190000 },
+};
+
+const wa_cp_freq ALPHA_333_FREQ_CPS[] = {
+  { 0x61u, 0.06470000 },
+  { 0x62u, 0.04030000 },
+  { 0x64u, 0.02670000 },
+  { 0x65u, 0.06500000 },
+  { 0x66u, 0.00920000 },
+  { 0x67u, 0.02630000 },
+  { 0x68u, 0.00820000 },
+  { 0x69u, 0.08280000 },
+  { 0x6Au, 0.03040000 },
+  { 0x6Bu, 0.03210000 },
+  { 0x6Cu, 0.04210000 },
+  { 0x6Du, 0.01630000 },
+  { 0x6Eu, 0.07940000 },
+  { 0x6Fu, 0.05930000 },
+  { 0x70u, 0.01960000 },
+  { 0x72u, 0.05000000 },
+  { 0x73u, 0.03430000 },
+  { 0x74u, 0.04780000 },
+  { 0x75u, 0.02120000 },
+  { 0x77u, 0.01580000 },
+  { 0x79u, 0.01250000 },
+  { 0xE0u, 0.02320000 },
+  { 0xE1u, 0.02980000 },
+  { 0xE8u, 0.00860000 },
+  { 0xE9u, 0.02150000 },
+  { 0xECu, 0.03880000 },
+  { 0xEDu, 0.02470000 },
+  { 0xF2u, 0.00880000 },
+  { 0xF3u, 0.01010000 },
+  { 0xF9u, 0.00300000 },
+  { 0xFAu, 0.00860000 },
+  { 0x144u, 0.00150000 },
+  { 0x1F9u, 0.00000000 },
+  { 0x1E3Fu, 0.00000000 },
+  { 0x1E63u, 0.00080000 },
+  { 0x1EB9u, 0.02500000 },
+  { 0x1ECDu, 0.01190000 },
+};
+
@@ -0,0 +1,119 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_334_UPPER[] = {
+  "A",
+  "Ã",
+  "B",
+  "D",
+  "E",
+  "Ẽ",
+  "G",
+  "I",
+  "Ĩ",
+  "K",
+  "M",
+  "N",
+  "P",
+  "R",
+  "S",
+  "T",
+  "U",
+  "Ũ",
+  "W",
+  "X",
+  "Y",
+};
+const char *ALPHA_334_LOWER[] = {
+  "a",
+  "ã",
+  "b",
+  "d",
+  "e",
+  "ẽ",
+  "g",
+  "i",
+  "ĩ",
+  "k",
+  "m",
+  "n",
+  "p",
+  "r",
+  "s",
+  "t",
+  "u",
+  "ũ",
+  "w",
+  "x",
+  "y",
+};
+const char *ALPHA_334_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_334_UPPER_CPS[] = {
+  65, 66, 68, 69, 71, 73, 75, 77, 78, 80, 82, 83, 84, 85, 87, 88,
+  89, 195, 296, 360, 7868,
+};
+const uint32_t ALPHA_334_LOWER_CPS[] = {
+  97, 98, 100, 101, 103, 105, 107, 109, 110, 112, 114, 115, 116, 117, 119, 120,
+  121, 227, 297, 361, 7869,
+};
+const uint32_t ALPHA_334_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_334_FREQ[] = {
+  { "a", 0.00000000 },
+  { "ã", 0.00000000 },
+  { "b", 0.00000000 },
+  { "d", 0.00000000 },
+  { "e", 0.00000000 },
+  { "ẽ", 0.00000000 },
+  { "g", 0.00000000 },
+  { "i", 0.00000000 },
+  { "ĩ", 0.00000000 },
+  { "k", 0.00000000 },
+  { "m", 0.00000000 },
+  { "n", 0.00000000 },
+  { "p", 0.00000000 },
+  { "r", 0.00000000 },
+  { "s", 0.00000000 },
+  { "t", 0.00000000 },
+  { "u", 0.00000000 },
+  { "ũ", 0.00000000 },
+  { "w", 0.00000000 },
+  { "x", 0.00000000 },
+  { "y", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_334_FREQ_CPS[] = {
+  { 0x61u, 0.00000000 },
+  { 0x62u, 0.00000000 },
+  { 0x64u, 0.00000000 },
+  { 0x65u, 0.00000000 },
+  { 0x67u, 0.00000000 },
+  { 0x69u, 0.00000000 },
+  { 0x6Bu, 0.00000000 },
+  { 0x6Du, 0.00000000 },
+  { 0x6Eu, 0.00000000 },
+  { 0x70u, 0.00000000 },
+  { 0x72u, 0.00000000 },
+  { 0x73u, 0.00000000 },
+  { 0x74u, 0.00000000 },
+  { 0x75u, 0.00000000 },
+  { 0x77u, 0.00000000 },
+  { 0x78u, 0.00000000 },
+  { 0x79u, 0.00000000 },
+  { 0xE3u, 0.00000000 },
+  { 0x129u, 0.00000000 },
+  { 0x169u, 0.00000000 },
+  { 0x1EBDu, 0.00000000 },
+};
+
@@ -0,0 +1,129 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_335_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+};
+const char *ALPHA_335_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+};
+const char *ALPHA_335_DIGITS[] = {
+};
+const uint32_t ALPHA_335_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90,
+};
+const uint32_t ALPHA_335_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122,
+};
+const uint32_t ALPHA_335_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_335_FREQ[] = {
+  { "a", 0.08410000 },
+  { "b", 0.02260000 },
+  { "c", 0.03190000 },
+  { "d", 0.04190000 },
+  { "e", 0.11500000 },
+  { "f", 0.01510000 },
+  { "g", 0.05000000 },
+  { "h", 0.04990000 },
+  { "i", 0.08420000 },
+  { "j", 0.01620000 },
+  { "k", 0.00940000 },
+  { "l", 0.03040000 },
+  { "m", 0.02280000 },
+  { "n", 0.09050000 },
+  { "o", 0.04970000 },
+  { "p", 0.01450000 },
+  { "q", 0.01060000 },
+  { "r", 0.04280000 },
+  { "s", 0.04810000 },
+  { "t", 0.04830000 },
+  { "u", 0.04270000 },
+  { "v", 0.01140000 },
+  { "w", 0.01800000 },
+  { "x", 0.00440000 },
+  { "y", 0.01920000 },
+  { "z", 0.02640000 },
+};
+
+const wa_cp_freq ALPHA_335_FREQ_CPS[] = {
+  { 0x61u, 0.08410000 },
+  { 0x62u, 0.02260000 },
+  { 0x63u, 0.03190000 },
+  { 0x64u, 0.04190000 },
+  { 0x65u, 0.11500000 },
+  { 0x66u, 0.01510000 },
+  { 0x67u, 0.05000000 },
+  { 0x68u, 0.04990000 },
+  { 0x69u, 0.08420000 },
+  { 0x6Au, 0.01620000 },
+  { 0x6Bu, 0.00940000 },
+  { 0x6Cu, 0.03040000 },
+  { 0x6Du, 0.02280000 },
+  { 0x6Eu, 0.09050000 },
+  { 0x6Fu, 0.04970000 },
+  { 0x70u, 0.01450000 },
+  { 0x71u, 0.01060000 },
+  { 0x72u, 0.04280000 },
+  { 0x73u, 0.04810000 },
+  { 0x74u, 0.04830000 },
+  { 0x75u, 0.04270000 },
+  { 0x76u, 0.01140000 },
+  { 0x77u, 0.01800000 },
+  { 0x78u, 0.00440000 },
+  { 0x79u, 0.01920000 },
+  { 0x7Au, 0.02640000 },
+};
+
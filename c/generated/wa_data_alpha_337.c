@@ -0,0 +1,9011 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_337_UPPER[] = {
+  "一",
+  "乙",
+  "二",
+  "人",
+  "入",
+  "八",
+  "刀",
+  "力",
+  "十",
+  "卜",
+  "又",
+  "口",
+  "土",
+  "士",
+  "夕",
+  "大",
+  "女",
+  "子",
+  "小",
+  "山",
+  "工",
+  "己",
+  "干",
+  "心",
+  "戈",
+  "戶",
+  "手",
+  "支",
+  "文",
+  "斗",
+  "方",
+  "日",
+  "曰",
+  "月",
+  "木",
+  "止",
+  "比",
+  "毛",
+  "氏",
+  "水",
+  "火",
+  "爪",
+  "父",
+  "片",
+  "牙",
+  "牛",
+  "玄",
+  "玉",
+  "瓜",
+  "瓦",
+  "甘",
+  "生",
+  "用",
+  "田",
+  "白",
+  "皮",
+  "目",
+  "矛",
+  "石",
+  "示",
+  "立",
+  "竹",
+  "米",
+  "羊",
+  "羽",
+  "老",
+  "而",
+  "耳",
+  "肉",
+  "臣",
+  "自",
+  "至",
+  "舌",
+  "舟",
+  "色",
+  "血",
+  "行",
+  "衣",
+  "見",
+  "角",
+  "言",
+  "谷",
+  "豆",
+  "貝",
+  "赤",
+  "走",
+  "足",
+  "身",
+  "車",
+  "辛",
+  "辰",
+  "酉",
+  "里",
+  "金",
+  "長",
+  "門",
+  "雨",
+  "非",
+  "面",
+  "革",
+  "韋",
+  "音",
+  "頁",
+  "風",
+  "飛",
+  "食",
+  "首",
+  "香",
+  "馬",
+  "骨",
+  "高",
+  "鬥",
+  "鬼",
+  "魚",
+  "鳥",
+  "鹿",
+  "麥",
+  "麻",
+  "黃",
+  "黑",
+  "鼓",
+  "鼠",
+  "鼻",
+  "齊",
+  "齒",
+  "龍",
+  "龜",
+  "丁",
+  "七",
+  "丈",
+  "三",
+  "上",
+  "下",
+  "丌",
+  "不",
+  "丑",
+  "且",
+  "世",
+  "丘",
+  "丙",
+  "丟",
+  "並",
+  "中",
+  "串",
+  "丸",
+  "丹",
+  "主",
+  "乃",
+  "久",
+  "么",
+  "之",
+  "乎",
+  "乏",
+  "乖",
+  "乘",
+  "九",
+  "也",
+  "乾",
+  "亂",
+  "了",
+  "予",
+  "事",
+  "于",
+  "云",
+  "互",
+  "五",
+  "井",
+  "些",
+  "亞",
+  "亡",
+  "交",
+  "亥",
+  "亦",
+  "亨",
+  "享",
+  "京",
+  "亮",
+  "什",
+  "仁",
+  "仇",
+  "今",
+  "介",
+  "仍",
+  "仔",
+  "他",
+  "付",
+  "仙",
+  "代",
+  "令",
+  "以",
+  "仰",
+  "仲",
+  "件",
+  "任",
+  "份",
+  "企",
+  "伊",
+  "伍",
+  "伐",
+  "休",
+  "伙",
+  "伯",
+  "估",
+  "伴",
+  "伸",
+  "似",
+  "伽",
+  "但",
+  "佈",
+  "佉",
+  "位",
+  "低",
+  "住",
+  "佔",
+  "何",
+  "余",
+  "佛",
+  "作",
+  "你",
+  "佩",
+  "佳",
+  "使",
+  "來",
+  "例",
+  "供",
+  "依",
+  "侯",
+  "侵",
+  "便",
+  "係",
+  "促",
+  "俄",
+  "俊",
+  "俗",
+  "保",
+  "俠",
+  "信",
+  "修",
+  "俱",
+  "俾",
+  "個",
+  "倍",
+  "們",
+  "倒",
+  "候",
+  "倚",
+  "借",
+  "倫",
+  "值",
+  "假",
+  "偉",
+  "偏",
+  "做",
+  "停",
+  "健",
+  "側",
+  "偵",
+  "偶",
+  "偷",
+  "傑",
+  "備",
+  "傢",
+  "傣",
+  "傲",
+  "傳",
+  "傷",
+  "傻",
+  "傾",
+  "僅",
+  "像",
+  "僑",
+  "僧",
+  "價",
+  "儀",
+  "億",
+  "儒",
+  "儘",
+  "優",
+  "允",
+  "元",
+  "兄",
+  "充",
+  "兇",
+  "先",
+  "光",
+  "克",
+  "免",
+  "兒",
+  "兔",
+  "內",
+  "全",
+  "兩",
+  "公",
+  "六",
+  "兮",
+  "共",
+  "兵",
+  "其",
+  "具",
+  "典",
+  "兼",
+  "冊",
+  "再",
+  "冒",
+  "冠",
+  "冬",
+  "冰",
+  "冷",
+  "准",
+  "凌",
+  "凝",
+  "凡",
+  "凰",
+  "凱",
+  "出",
+  "函",
+  "分",
+  "切",
+  "刊",
+  "列",
+  "初",
+  "判",
+  "別",
+  "利",
+  "刪",
+  "到",
+  "制",
+  "刷",
+  "刺",
+  "刻",
+  "則",
+  "剌",
+  "前",
+  "剛",
+  "剩",
+  "剪",
+  "副",
+  "割",
+  "創",
+  "劃",
+  "劇",
+  "劉",
+  "劍",
+  "功",
+  "加",
+  "助",
+  "努",
+  "劫",
+  "勁",
+  "勇",
+  "勉",
+  "勒",
+  "動",
+  "務",
+  "勝",
+  "勞",
+  "勢",
+  "勤",
+  "勵",
+  "勸",
+  "勿",
+  "包",
+  "匈",
+  "化",
+  "北",
+  "匹",
+  "區",
+  "千",
+  "升",
+  "午",
+  "半",
+  "卒",
+  "卓",
+  "協",
+  "南",
+  "博",
+  "卡",
+  "卯",
+  "印",
+  "危",
+  "即",
+  "卷",
+  "卻",
+  "厄",
+  "厘",
+  "厚",
+  "原",
+  "厭",
+  "厲",
+  "去",
+  "參",
+  "及",
+  "友",
+  "反",
+  "叔",
+  "取",
+  "受",
+  "古",
+  "句",
+  "另",
+  "只",
+  "叫",
+  "召",
+  "叭",
+  "可",
+  "台",
+  "史",
+  "右",
+  "司",
+  "吃",
+  "各",
+  "合",
+  "吉",
+  "吊",
+  "同",
+  "名",
+  "后",
+  "吐",
+  "向",
+  "吒",
+  "君",
+  "吝",
+  "吞",
+  "吟",
+  "吠",
+  "否",
+  "吧",
+  "含",
+  "吳",
+  "吵",
+  "吸",
+  "吹",
+  "吾",
+  "呀",
+  "呂",
+  "呆",
+  "告",
+  "呢",
+  "周",
+  "味",
+  "呵",
+  "呼",
+  "命",
+  "和",
+  "咖",
+  "咦",
+  "咧",
+  "咪",
+  "咬",
+  "咱",
+  "哀",
+  "品",
+  "哇",
+  "哈",
+  "哉",
+  "哎",
+  "員",
+  "哥",
+  "哦",
+  "哩",
+  "哪",
+  "哭",
+  "哲",
+  "唉",
+  "唐",
+  "唔",
+  "唬",
+  "售",
+  "唯",
+  "唱",
+  "唷",
+  "唸",
+  "商",
+  "啊",
+  "問",
+  "啟",
+  "啡",
+  "啥",
+  "啦",
+  "啪",
+  "喀",
+  "喂",
+  "善",
+  "喇",
+  "喊",
+  "喔",
+  "喜",
+  "喝",
+  "喬",
+  "單",
+  "喵",
+  "嗎",
+  "嗚",
+  "嗨",
+  "嗯",
+  "嘆",
+  "嘉",
+  "嘗",
+  "嘛",
+  "嘴",
+  "嘻",
+  "嘿",
+  "器",
+  "噴",
+  "嚇",
+  "嚴",
+  "囉",
+  "四",
+  "回",
+  "因",
+  "困",
+  "固",
+  "圈",
+  "國",
+  "圍",
+  "園",
+  "圓",
+  "圖",
+  "團",
+  "圜",
+  "在",
+  "圭",
+  "地",
+  "圾",
+  "址",
+  "均",
+  "坎",
+  "坐",
+  "坡",
+  "坤",
+  "坦",
+  "坪",
+  "垂",
+  "垃",
+  "型",
+  "埃",
+  "城",
+  "埔",
+  "域",
+  "執",
+  "培",
+  "基",
+  "堂",
+  "堅",
+  "堆",
+  "堡",
+  "堪",
+  "報",
+  "場",
+  "塊",
+  "塔",
+  "塗",
+  "塞",
+  "填",
+  "塵",
+  "境",
+  "增",
+  "墨",
+  "墮",
+  "壁",
+  "壇",
+  "壓",
+  "壘",
+  "壞",
+  "壢",
+  "壬",
+  "壯",
+  "壽",
+  "夏",
+  "外",
+  "多",
+  "夜",
+  "夠",
+  "夢",
+  "夥",
+  "天",
+  "太",
+  "夫",
+  "央",
+  "失",
+  "夷",
+  "夸",
+  "夾",
+  "奇",
+  "奈",
+  "奉",
+  "奎",
+  "奏",
+  "契",
+  "奔",
+  "套",
+  "奧",
+  "奪",
+  "奮",
+  "奴",
+  "奶",
+  "她",
+  "好",
+  "如",
+  "妙",
+  "妝",
+  "妥",
+  "妨",
+  "妮",
+  "妳",
+  "妹",
+  "妻",
+  "姆",
+  "姊",
+  "始",
+  "姐",
+  "姑",
+  "姓",
+  "委",
+  "姿",
+  "威",
+  "娃",
+  "娘",
+  "娛",
+  "婁",
+  "婆",
+  "婚",
+  "婦",
+  "媒",
+  "媽",
+  "嫌",
+  "嫩",
+  "孔",
+  "字",
+  "存",
+  "孝",
+  "孟",
+  "季",
+  "孤",
+  "孩",
+  "孫",
+  "學",
+  "它",
+  "宅",
+  "宇",
+  "守",
+  "安",
+  "宋",
+  "完",
+  "宏",
+  "宗",
+  "官",
+  "宙",
+  "定",
+  "宛",
+  "宜",
+  "客",
+  "宣",
+  "室",
+  "宮",
+  "害",
+  "家",
+  "容",
+  "宿",
+  "寂",
+  "寄",
+  "寅",
+  "密",
+  "富",
+  "寒",
+  "寞",
+  "察",
+  "寢",
+  "實",
+  "寧",
+  "寨",
+  "審",
+  "寫",
+  "寬",
+  "寮",
+  "寵",
+  "寶",
+  "封",
+  "射",
+  "將",
+  "專",
+  "尊",
+  "尋",
+  "對",
+  "導",
+  "少",
+  "尖",
+  "尚",
+  "尤",
+  "就",
+  "尺",
+  "尼",
+  "尾",
+  "局",
+  "屁",
+  "居",
+  "屆",
+  "屋",
+  "屏",
+  "展",
+  "屠",
+  "層",
+  "屬",
+  "岡",
+  "岩",
+  "岸",
+  "峰",
+  "島",
+  "峽",
+  "崇",
+  "崙",
+  "崴",
+  "嵐",
+  "嶺",
+  "川",
+  "州",
+  "巡",
+  "左",
+  "巧",
+  "巨",
+  "巫",
+  "差",
+  "已",
+  "巳",
+  "巴",
+  "巷",
+  "市",
+  "布",
+  "希",
+  "帕",
+  "帖",
+  "帛",
+  "帝",
+  "帥",
+  "師",
+  "席",
+  "帳",
+  "帶",
+  "常",
+  "帽",
+  "幅",
+  "幕",
+  "幣",
+  "幫",
+  "平",
+  "年",
+  "幸",
+  "幹",
+  "幻",
+  "幼",
+  "幽",
+  "幾",
+  "庇",
+  "床",
+  "序",
+  "底",
+  "店",
+  "庚",
+  "府",
+  "度",
+  "座",
+  "庫",
+  "庭",
+  "康",
+  "庸",
+  "廉",
+  "廖",
+  "廠",
+  "廢",
+  "廣",
+  "廳",
+  "延",
+  "廷",
+  "建",
+  "弄",
+  "式",
+  "引",
+  "弗",
+  "弘",
+  "弟",
+  "弦",
+  "弱",
+  "張",
+  "強",
+  "彈",
+  "彊",
+  "彌",
+  "彎",
+  "彝",
+  "彞",
+  "形",
+  "彥",
+  "彩",
+  "彬",
+  "彭",
+  "彰",
+  "影",
+  "役",
+  "彼",
+  "往",
+  "征",
+  "待",
+  "很",
+  "律",
+  "後",
+  "徐",
+  "徑",
+  "徒",
+  "得",
+  "從",
+  "復",
+  "微",
+  "徵",
+  "德",
+  "徹",
+  "必",
+  "忌",
+  "忍",
+  "志",
+  "忘",
+  "忙",
+  "忠",
+  "快",
+  "念",
+  "忽",
+  "怎",
+  "怒",
+  "怕",
+  "怖",
+  "思",
+  "怡",
+  "急",
+  "性",
+  "怨",
+  "怪",
+  "恆",
+  "恐",
+  "恢",
+  "恥",
+  "恨",
+  "恩",
+  "恭",
+  "息",
+  "恰",
+  "悅",
+  "悉",
+  "悔",
+  "悟",
+  "悠",
+  "您",
+  "悲",
+  "悶",
+  "情",
+  "惑",
+  "惜",
+  "惠",
+  "惡",
+  "惱",
+  "想",
+  "惹",
+  "愁",
+  "愈",
+  "愉",
+  "意",
+  "愚",
+  "愛",
+  "感",
+  "慈",
+  "態",
+  "慕",
+  "慘",
+  "慢",
+  "慣",
+  "慧",
+  "慮",
+  "慰",
+  "慶",
+  "慾",
+  "憂",
+  "憐",
+  "憑",
+  "憲",
+  "憶",
+  "憾",
+  "懂",
+  "應",
+  "懶",
+  "懷",
+  "懼",
+  "戀",
+  "戊",
+  "戌",
+  "成",
+  "我",
+  "戒",
+  "或",
+  "截",
+  "戰",
+  "戲",
+  "戴",
+  "房",
+  "所",
+  "扁",
+  "扇",
+  "才",
+  "扎",
+  "打",
+  "托",
+  "扣",
+  "扥",
+  "扭",
+  "扯",
+  "批",
+  "找",
+  "承",
+  "技",
+  "抄",
+  "把",
+  "抓",
+  "投",
+  "抗",
+  "折",
+  "披",
+  "抬",
+  "抱",
+  "抵",
+  "抹",
+  "抽",
+  "拆",
+  "拉",
+  "拋",
+  "拍",
+  "拏",
+  "拒",
+  "拔",
+  "拖",
+  "招",
+  "拜",
+  "括",
+  "拳",
+  "拼",
+  "拾",
+  "拿",
+  "持",
+  "指",
+  "按",
+  "挑",
+  "挖",
+  "挪",
+  "振",
+  "挺",
+  "捐",
+  "捕",
+  "捨",
+  "捲",
+  "捷",
+  "掃",
+  "授",
+  "掉",
+  "掌",
+  "排",
+  "掛",
+  "採",
+  "探",
+  "接",
+  "控",
+  "推",
+  "措",
+  "描",
+  "提",
+  "插",
+  "揚",
+  "換",
+  "握",
+  "揮",
+  "援",
+  "損",
+  "搖",
+  "搜",
+  "搞",
+  "搬",
+  "搭",
+  "搶",
+  "摘",
+  "摩",
+  "摸",
+  "撐",
+  "撒",
+  "撞",
+  "撣",
+  "撥",
+  "播",
+  "撾",
+  "撿",
+  "擁",
+  "擇",
+  "擊",
+  "擋",
+  "操",
+  "擎",
+  "擔",
+  "據",
+  "擠",
+  "擦",
+  "擬",
+  "擴",
+  "擺",
+  "擾",
+  "攝",
+  "收",
+  "改",
+  "攻",
+  "放",
+  "政",
+  "故",
+  "效",
+  "敍",
+  "敏",
+  "救",
+  "敗",
+  "敘",
+  "教",
+  "敝",
+  "敢",
+  "散",
+  "敦",
+  "敬",
+  "整",
+  "敵",
+  "數",
+  "斐",
+  "料",
+  "斯",
+  "新",
+  "斷",
+  "於",
+  "施",
+  "旁",
+  "旅",
+  "旋",
+  "族",
+  "旗",
+  "既",
+  "旦",
+  "早",
+  "旭",
+  "旺",
+  "昂",
+  "昆",
+  "昇",
+  "昌",
+  "明",
+  "昏",
+  "易",
+  "星",
+  "映",
+  "春",
+  "昨",
+  "昭",
+  "是",
+  "時",
+  "晉",
+  "晒",
+  "晚",
+  "晨",
+  "普",
+  "景",
+  "晴",
+  "晶",
+  "智",
+  "暑",
+  "暖",
+  "暗",
+  "暫",
+  "暴",
+  "曆",
+  "曉",
+  "曲",
+  "更",
+  "書",
+  "曼",
+  "曾",
+  "替",
+  "最",
+  "會",
+  "有",
+  "朋",
+  "服",
+  "朗",
+  "望",
+  "朝",
+  "期",
+  "未",
+  "末",
+  "本",
+  "札",
+  "朱",
+  "朵",
+  "杉",
+  "李",
+  "材",
+  "村",
+  "杜",
+  "束",
+  "杯",
+  "杰",
+  "東",
+  "松",
+  "板",
+  "析",
+  "林",
+  "果",
+  "枝",
+  "架",
+  "柏",
+  "某",
+  "染",
+  "柔",
+  "查",
+  "柬",
+  "柯",
+  "柳",
+  "柴",
+  "校",
+  "核",
+  "根",
+  "格",
+  "桃",
+  "案",
+  "桌",
+  "桑",
+  "梁",
+  "梅",
+  "條",
+  "梨",
+  "梯",
+  "械",
+  "梵",
+  "棄",
+  "棉",
+  "棋",
+  "棒",
+  "棚",
+  "森",
+  "椅",
+  "植",
+  "椰",
+  "楊",
+  "楓",
+  "楚",
+  "業",
+  "極",
+  "概",
+  "榜",
+  "榮",
+  "構",
+  "槍",
+  "樂",
+  "樓",
+  "標",
+  "樞",
+  "模",
+  "樣",
+  "樹",
+  "橋",
+  "機",
+  "橫",
+  "檀",
+  "檔",
+  "檢",
+  "欄",
+  "權",
+  "次",
+  "欣",
+  "欲",
+  "欺",
+  "欽",
+  "款",
+  "歉",
+  "歌",
+  "歐",
+  "歡",
+  "正",
+  "此",
+  "步",
+  "武",
+  "歲",
+  "歷",
+  "歸",
+  "死",
+  "殊",
+  "殘",
+  "段",
+  "殺",
+  "殼",
+  "毀",
+  "毅",
+  "母",
+  "每",
+  "毒",
+  "毫",
+  "民",
+  "氣",
+  "永",
+  "求",
+  "汗",
+  "汝",
+  "江",
+  "池",
+  "污",
+  "汪",
+  "汶",
+  "決",
+  "汽",
+  "沃",
+  "沈",
+  "沉",
+  "沒",
+  "沖",
+  "沙",
+  "河",
+  "油",
+  "治",
+  "沿",
+  "況",
+  "泉",
+  "泊",
+  "法",
+  "泡",
+  "波",
+  "泥",
+  "注",
+  "泰",
+  "泳",
+  "洋",
+  "洗",
+  "洛",
+  "洞",
+  "洩",
+  "洪",
+  "洲",
+  "活",
+  "洽",
+  "派",
+  "流",
+  "浦",
+  "浩",
+  "浪",
+  "浮",
+  "海",
+  "涇",
+  "消",
+  "涉",
+  "涯",
+  "液",
+  "涵",
+  "涼",
+  "淑",
+  "淚",
+  "淡",
+  "淨",
+  "深",
+  "混",
+  "淺",
+  "清",
+  "減",
+  "渡",
+  "測",
+  "港",
+  "游",
+  "湖",
+  "湯",
+  "源",
+  "準",
+  "溝",
+  "溪",
+  "溫",
+  "滄",
+  "滅",
+  "滋",
+  "滑",
+  "滴",
+  "滾",
+  "滿",
+  "漂",
+  "漏",
+  "演",
+  "漠",
+  "漢",
+  "漫",
+  "漲",
+  "漸",
+  "潔",
+  "潘",
+  "潛",
+  "潮",
+  "澤",
+  "澳",
+  "激",
+  "濃",
+  "濟",
+  "濤",
+  "濫",
+  "濱",
+  "瀏",
+  "灌",
+  "灣",
+  "灰",
+  "災",
+  "炎",
+  "炮",
+  "炸",
+  "為",
+  "烈",
+  "烏",
+  "烤",
+  "無",
+  "焦",
+  "然",
+  "煙",
+  "煞",
+  "照",
+  "煩",
+  "熊",
+  "熟",
+  "熱",
+  "燃",
+  "燈",
+  "燒",
+  "營",
+  "爆",
+  "爐",
+  "爛",
+  "爬",
+  "爭",
+  "爵",
+  "爸",
+  "爺",
+  "爽",
+  "爾",
+  "牆",
+  "版",
+  "牌",
+  "牠",
+  "牧",
+  "物",
+  "牲",
+  "特",
+  "牽",
+  "犧",
+  "犯",
+  "狀",
+  "狂",
+  "狐",
+  "狗",
+  "狠",
+  "狼",
+  "猛",
+  "猜",
+  "猴",
+  "猶",
+  "獄",
+  "獅",
+  "獎",
+  "獨",
+  "獲",
+  "獸",
+  "獻",
+  "率",
+  "王",
+  "玩",
+  "玫",
+  "玲",
+  "玻",
+  "珊",
+  "珍",
+  "珠",
+  "珥",
+  "班",
+  "現",
+  "球",
+  "理",
+  "琉",
+  "琪",
+  "琴",
+  "瑙",
+  "瑜",
+  "瑞",
+  "瑟",
+  "瑤",
+  "瑪",
+  "瑰",
+  "環",
+  "瓶",
+  "甚",
+  "甜",
+  "產",
+  "由",
+  "甲",
+  "申",
+  "男",
+  "甸",
+  "界",
+  "留",
+  "畢",
+  "略",
+  "番",
+  "畫",
+  "異",
+  "當",
+  "疆",
+  "疏",
+  "疑",
+  "疼",
+  "病",
+  "痕",
+  "痛",
+  "痴",
+  "瘋",
+  "療",
+  "癡",
+  "癸",
+  "登",
+  "發",
+  "百",
+  "的",
+  "皆",
+  "皇",
+  "盃",
+  "益",
+  "盛",
+  "盜",
+  "盟",
+  "盡",
+  "監",
+  "盤",
+  "盧",
+  "盲",
+  "直",
+  "相",
+  "盼",
+  "盾",
+  "省",
+  "眉",
+  "看",
+  "真",
+  "眠",
+  "眼",
+  "眾",
+  "睛",
+  "睡",
+  "督",
+  "瞧",
+  "瞭",
+  "矣",
+  "知",
+  "短",
+  "砂",
+  "砍",
+  "研",
+  "砲",
+  "破",
+  "硬",
+  "碎",
+  "碗",
+  "碟",
+  "碧",
+  "碩",
+  "碰",
+  "確",
+  "碼",
+  "磁",
+  "磨",
+  "磯",
+  "礎",
+  "礙",
+  "社",
+  "祕",
+  "祖",
+  "祚",
+  "祛",
+  "祝",
+  "神",
+  "祥",
+  "票",
+  "祿",
+  "禁",
+  "禍",
+  "禎",
+  "福",
+  "禪",
+  "禮",
+  "秀",
+  "私",
+  "秋",
+  "科",
+  "秒",
+  "秘",
+  "租",
+  "秤",
+  "秦",
+  "移",
+  "稅",
+  "程",
+  "稍",
+  "種",
+  "稱",
+  "稿",
+  "穆",
+  "穌",
+  "積",
+  "穩",
+  "究",
+  "穹",
+  "空",
+  "穿",
+  "突",
+  "窗",
+  "窩",
+  "窮",
+  "窶",
+  "站",
+  "竟",
+  "章",
+  "童",
+  "端",
+  "競",
+  "笑",
+  "笛",
+  "符",
+  "笨",
+  "第",
+  "筆",
+  "等",
+  "筋",
+  "答",
+  "策",
+  "算",
+  "管",
+  "箭",
+  "箱",
+  "節",
+  "範",
+  "篇",
+  "築",
+  "簡",
+  "簫",
+  "簽",
+  "簿",
+  "籃",
+  "籌",
+  "籍",
+  "籤",
+  "粉",
+  "粗",
+  "粵",
+  "精",
+  "糊",
+  "糕",
+  "糟",
+  "系",
+  "糾",
+  "紀",
+  "約",
+  "紅",
+  "納",
+  "紐",
+  "純",
+  "紙",
+  "級",
+  "紛",
+  "素",
+  "索",
+  "紫",
+  "累",
+  "細",
+  "紹",
+  "終",
+  "組",
+  "結",
+  "絕",
+  "絡",
+  "給",
+  "統",
+  "絲",
+  "經",
+  "綜",
+  "綠",
+  "維",
+  "綱",
+  "網",
+  "緊",
+  "緒",
+  "線",
+  "緣",
+  "編",
+  "緩",
+  "緬",
+  "緯",
+  "練",
+  "縛",
+  "縣",
+  "縮",
+  "縱",
+  "總",
+  "績",
+  "繁",
+  "繆",
+  "織",
+  "繞",
+  "繪",
+  "繳",
+  "繼",
+  "續",
+  "缸",
+  "缺",
+  "罕",
+  "罪",
+  "置",
+  "罰",
+  "署",
+  "罵",
+  "罷",
+  "羅",
+  "美",
+  "羞",
+  "群",
+  "義",
+  "翁",
+  "習",
+  "翔",
+  "翰",
+  "翹",
+  "翻",
+  "翼",
+  "耀",
+  "考",
+  "者",
+  "耍",
+  "耐",
+  "耗",
+  "耶",
+  "聊",
+  "聖",
+  "聚",
+  "聞",
+  "聯",
+  "聰",
+  "聲",
+  "職",
+  "聽",
+  "肚",
+  "股",
+  "肥",
+  "肩",
+  "肯",
+  "育",
+  "背",
+  "胎",
+  "胖",
+  "胞",
+  "胡",
+  "胸",
+  "能",
+  "脆",
+  "脫",
+  "腓",
+  "腔",
+  "腦",
+  "腰",
+  "腳",
+  "腿",
+  "膽",
+  "臉",
+  "臘",
+  "臥",
+  "臨",
+  "臭",
+  "致",
+  "臺",
+  "與",
+  "興",
+  "舉",
+  "舊",
+  "舍",
+  "舒",
+  "舞",
+  "航",
+  "般",
+  "船",
+  "艦",
+  "良",
+  "艾",
+  "芝",
+  "芬",
+  "花",
+  "芳",
+  "若",
+  "苦",
+  "英",
+  "茅",
+  "茫",
+  "茲",
+  "茶",
+  "草",
+  "荒",
+  "荷",
+  "荼",
+  "莉",
+  "莊",
+  "莎",
+  "莫",
+  "菜",
+  "菩",
+  "華",
+  "菲",
+  "萄",
+  "萊",
+  "萬",
+  "落",
+  "葉",
+  "著",
+  "葛",
+  "葡",
+  "蒂",
+  "蒙",
+  "蒲",
+  "蒼",
+  "蓋",
+  "蓮",
+  "蔕",
+  "蔡",
+  "蔣",
+  "蕭",
+  "薄",
+  "薦",
+  "薩",
+  "薪",
+  "藉",
+  "藍",
+  "藏",
+  "藝",
+  "藤",
+  "藥",
+  "蘆",
+  "蘇",
+  "蘭",
+  "虎",
+  "處",
+  "虛",
+  "號",
+  "虧",
+  "蛇",
+  "蛋",
+  "蛙",
+  "蜂",
+  "蜜",
+  "蝶",
+  "融",
+  "螢",
+  "蟲",
+  "蟹",
+  "蠍",
+  "蠻",
+  "術",
+  "街",
+  "衛",
+  "衝",
+  "衡",
+  "表",
+  "袋",
+  "被",
+  "裁",
+  "裂",
+  "裕",
+  "補",
+  "裝",
+  "裡",
+  "製",
+  "複",
+  "褲",
+  "西",
+  "要",
+  "覆",
+  "規",
+  "視",
+  "親",
+  "覺",
+  "覽",
+  "觀",
+  "解",
+  "觸",
+  "訂",
+  "計",
+  "訊",
+  "討",
+  "訓",
+  "託",
+  "記",
+  "訥",
+  "訪",
+  "設",
+  "許",
+  "訴",
+  "註",
+  "証",
+  "評",
+  "詞",
+  "詢",
+  "試",
+  "詩",
+  "話",
+  "該",
+  "詳",
+  "誇",
+  "誌",
+  "認",
+  "誓",
+  "誕",
+  "語",
+  "誠",
+  "誤",
+  "說",
+  "誰",
+  "課",
+  "誼",
+  "調",
+  "談",
+  "請",
+  "諒",
+  "論",
+  "諸",
+  "諺",
+  "諾",
+  "謀",
+  "謂",
+  "講",
+  "謝",
+  "證",
+  "識",
+  "譜",
+  "警",
+  "譯",
+  "議",
+  "護",
+  "譽",
+  "讀",
+  "變",
+  "讓",
+  "讚",
+  "豈",
+  "豐",
+  "象",
+  "豪",
+  "豬",
+  "貌",
+  "貓",
+  "貞",
+  "負",
+  "財",
+  "貢",
+  "貨",
+  "貪",
+  "貫",
+  "責",
+  "貴",
+  "買",
+  "費",
+  "貼",
+  "賀",
+  "資",
+  "賈",
+  "賓",
+  "賜",
+  "賞",
+  "賢",
+  "賣",
+  "賤",
+  "賦",
+  "質",
+  "賭",
+  "賴",
+  "賺",
+  "購",
+  "賽",
+  "贈",
+  "贊",
+  "贏",
+  "赫",
+  "起",
+  "超",
+  "越",
+  "趕",
+  "趙",
+  "趣",
+  "趨",
+  "跌",
+  "跎",
+  "跑",
+  "距",
+  "跟",
+  "跡",
+  "路",
+  "跳",
+  "踏",
+  "踢",
+  "蹟",
+  "蹤",
+  "躍",
+  "躲",
+  "軌",
+  "軍",
+  "軒",
+  "軟",
+  "較",
+  "載",
+  "輔",
+  "輕",
+  "輛",
+  "輝",
+  "輩",
+  "輪",
+  "輯",
+  "輸",
+  "轉",
+  "轟",
+  "辦",
+  "辨",
+  "辭",
+  "辯",
+  "辱",
+  "農",
+  "迅",
+  "迎",
+  "近",
+  "返",
+  "迦",
+  "迪",
+  "迫",
+  "述",
+  "迴",
+  "迷",
+  "追",
+  "退",
+  "送",
+  "逃",
+  "逆",
+  "透",
+  "逐",
+  "途",
+  "這",
+  "通",
+  "逛",
+  "逝",
+  "速",
+  "造",
+  "逢",
+  "連",
+  "週",
+  "進",
+  "逸",
+  "逼",
+  "遇",
+  "遊",
+  "運",
+  "遍",
+  "過",
+  "道",
+  "達",
+  "違",
+  "遙",
+  "遜",
+  "遠",
+  "適",
+  "遭",
+  "遮",
+  "遲",
+  "遷",
+  "選",
+  "遺",
+  "避",
+  "邀",
+  "邁",
+  "還",
+  "邊",
+  "邏",
+  "那",
+  "邦",
+  "邪",
+  "邱",
+  "郎",
+  "部",
+  "郭",
+  "郵",
+  "都",
+  "鄂",
+  "鄉",
+  "鄭",
+  "鄰",
+  "配",
+  "酒",
+  "酷",
+  "酸",
+  "醉",
+  "醒",
+  "醜",
+  "醫",
+  "采",
+  "釋",
+  "重",
+  "野",
+  "量",
+  "針",
+  "釣",
+  "鈴",
+  "鉢",
+  "銀",
+  "銅",
+  "銖",
+  "銘",
+  "銳",
+  "銷",
+  "鋒",
+  "鋼",
+  "錄",
+  "錢",
+  "錦",
+  "錫",
+  "錯",
+  "鍋",
+  "鍵",
+  "鍾",
+  "鎊",
+  "鎖",
+  "鎮",
+  "鏡",
+  "鐘",
+  "鐵",
+  "鑑",
+  "閃",
+  "閉",
+  "開",
+  "閏",
+  "閒",
+  "間",
+  "閣",
+  "閱",
+  "闆",
+  "闊",
+  "闍",
+  "闐",
+  "關",
+  "闡",
+  "防",
+  "阻",
+  "阿",
+  "陀",
+  "附",
+  "降",
+  "限",
+  "院",
+  "陣",
+  "除",
+  "陪",
+  "陰",
+  "陳",
+  "陵",
+  "陶",
+  "陷",
+  "陸",
+  "陽",
+  "隆",
+  "隊",
+  "階",
+  "隔",
+  "際",
+  "障",
+  "隨",
+  "險",
+  "隱",
+  "隻",
+  "雄",
+  "雅",
+  "集",
+  "雉",
+  "雖",
+  "雙",
+  "雜",
+  "雞",
+  "離",
+  "難",
+  "雪",
+  "雲",
+  "零",
+  "雷",
+  "電",
+  "需",
+  "震",
+  "霍",
+  "霧",
+  "露",
+  "霸",
+  "霹",
+  "靂",
+  "靈",
+  "青",
+  "靖",
+  "靜",
+  "靠",
+  "靼",
+  "鞋",
+  "韃",
+  "韓",
+  "韻",
+  "響",
+  "頂",
+  "項",
+  "順",
+  "須",
+  "預",
+  "頑",
+  "頓",
+  "頗",
+  "領",
+  "頞",
+  "頭",
+  "頻",
+  "顆",
+  "題",
+  "額",
+  "顏",
+  "願",
+  "類",
+  "顧",
+  "顯",
+  "飄",
+  "飯",
+  "飲",
+  "飽",
+  "飾",
+  "餅",
+  "養",
+  "餐",
+  "餘",
+  "館",
+  "駐",
+  "駕",
+  "駛",
+  "騎",
+  "騙",
+  "騷",
+  "驅",
+  "驗",
+  "驚",
+  "體",
+  "髮",
+  "鬆",
+  "鬧",
+  "鬱",
+  "魁",
+  "魂",
+  "魅",
+  "魔",
+  "魯",
+  "鮮",
+  "鳳",
+  "鳴",
+  "鴻",
+  "鵝",
+  "鷹",
+  "麗",
+  "麵",
+  "麼",
+  "黎",
+  "默",
+  "點",
+  "黨",
+  "齋",
+  "齡",
+};
+const char *ALPHA_337_LOWER[] = {
+  "一",
+  "乙",
+  "二",
+  "人",
+  "入",
+  "八",
+  "刀",
+  "力",
+  "十",
+  "卜",
+  "又",
+  "口",
+  "土",
+  "士",
+  "夕",
+  "大",
+  "女",
+  "子",
+  "小",
+  "山",
+  "工",
+  "己",
+  "干",
+  "心",
+  "戈",
+  "戶",
+  "手",
+  "支",
+  "文",
+  "斗",
+  "方",
+  "日",
+  "曰",
+  "月",
+  "木",
+  "止",
+  "比",
+  "毛",
+  "氏",
+  "水",
+  "火",
+  "爪",
+  "父",
+  "片",
+  "牙",
+  "牛",
+  "玄",
+  "玉",
+  "瓜",
+  "瓦",
+  "甘",
+  "生",
+  "用",
+  "田",
+  "白",
+  "皮",
+  "目",
+  "矛",
+  "石",
+  "示",
+  "立",
+  "竹",
+  "米",
+  "羊",
+  "羽",
+  "老",
+  "而",
+  "耳",
+  "肉",
+  "臣",
+  "自",
+  "至",
+  "舌",
+  "舟",
+  "色",
+  "血",
+  "行",
+  "衣",
+  "見",
+  "角",
+  "言",
+  "谷",
+  "豆",
+  "貝",
+  "赤",
+  "走",
+  "足",
+  "身",
+  "車",
+  "辛",
+  "辰",
+  "酉",
+  "里",
+  "金",
+  "長",
+  "門",
+  "雨",
+  "非",
+  "面",
+  "革",
+  "韋",
+  "音",
+  "頁",
+  "風",
+  "飛",
+  "食",
+  "首",
+  "香",
+  "馬",
+  "骨",
+  "高",
+  "鬥",
+  "鬼",
+  "魚",
+  "鳥",
+  "鹿",
+  "麥",
+  "麻",
+  "黃",
+  "黑",
+  "鼓",
+  "鼠",
+  "鼻",
+  "齊",
+  "齒",
+  "龍",
+  "龜",
+  "丁",
+  "七",
+  "丈",
+  "三",
+  "上",
+  "下",
+  "丌",
+  "不",
+  "丑",
+  "且",
+  "世",
+  "丘",
+  "丙",
+  "丟",
+  "並",
+  "中",
+  "串",
+  "丸",
+  "丹",
+  "主",
+  "乃",
+  "久",
+  "么",
+  "之",
+  "乎",
+  "乏",
+  "乖",
+  "乘",
+  "九",
+  "也",
+  "乾",
+  "亂",
+  "了",
+  "予",
+  "事",
+  "于",
+  "云",
+  "互",
+  "五",
+  "井",
+  "些",
+  "亞",
+  "亡",
+  "交",
+  "亥",
+  "亦",
+  "亨",
+  "享",
+  "京",
+  "亮",
+  "什",
+  "仁",
+  "仇",
+  "今",
+  "介",
+  "仍",
+  "仔",
+  "他",
+  "付",
+  "仙",
+  "代",
+  "令",
+  "以",
+  "仰",
+  "仲",
+  "件",
+  "任",
+  "份",
+  "企",
+  "伊",
+  "伍",
+  "伐",
+  "休",
+  "伙",
+  "伯",
+  "估",
+  "伴",
+  "伸",
+  "似",
+  "伽",
+  "但",
+  "佈",
+  "佉",
+  "位",
+  "低",
+  "住",
+  "佔",
+  "何",
+  "余",
+  "佛",
+  "作",
+  "你",
+  "佩",
+  "佳",
+  "使",
+  "來",
+  "例",
+  "供",
+  "依",
+  "侯",
+  "侵",
+  "便",
+  "係",
+  "促",
+  "俄",
+  "俊",
+  "俗",
+  "保",
+  "俠",
+  "信",
+  "修",
+  "俱",
+  "俾",
+  "個",
+  "倍",
+  "們",
+  "倒",
+  "候",
+  "倚",
+  "借",
+  "倫",
+  "值",
+  "假",
+  "偉",
+  "偏",
+  "做",
+  "停",
+  "健",
+  "側",
+  "偵",
+  "偶",
+  "偷",
+  "傑",
+  "備",
+  "傢",
+  "傣",
+  "傲",
+  "傳",
+  "傷",
+  "傻",
+  "傾",
+  "僅",
+  "像",
+  "僑",
+  "僧",
+  "價",
+  "儀",
+  "億",
+  "儒",
+  "儘",
+  "優",
+  "允",
+  "元",
+  "兄",
+  "充",
+  "兇",
+  "先",
+  "光",
+  "克",
+  "免",
+  "兒",
+  "兔",
+  "內",
+  "全",
+  "兩",
+  "公",
+  "六",
+  "兮",
+  "共",
+  "兵",
+  "其",
+  "具",
+  "典",
+  "兼",
+  "冊",
+  "再",
+  "冒",
+  "冠",
+  "冬",
+  "冰",
+  "冷",
+  "准",
+  "凌",
+  "凝",
+  "凡",
+  "凰",
+  "凱",
+  "出",
+  "函",
+  "分",
+  "切",
+  "刊",
+  "列",
+  "初",
+  "判",
+  "別",
+  "利",
+  "刪",
+  "到",
+  "制",
+  "刷",
+  "刺",
+  "刻",
+  "則",
+  "剌",
+  "前",
+  "剛",
+  "剩",
+  "剪",
+  "副",
+  "割",
+  "創",
+  "劃",
+  "劇",
+  "劉",
+  "劍",
+  "功",
+  "加",
+  "助",
+  "努",
+  "劫",
+  "勁",
+  "勇",
+  "勉",
+  "勒",
+  "動",
+  "務",
+  "勝",
+  "勞",
+  "勢",
+  "勤",
+  "勵",
+  "勸",
+  "勿",
+  "包",
+  "匈",
+  "化",
+  "北",
+  "匹",
+  "區",
+  "千",
+  "升",
+  "午",
+  "半",
+  "卒",
+  "卓",
+  "協",
+  "南",
+  "博",
+  "卡",
+  "卯",
+  "印",
+  "危",
+  "即",
+  "卷",
+  "卻",
+  "厄",
+  "厘",
+  "厚",
+  "原",
+  "厭",
+  "厲",
+  "去",
+  "參",
+  "及",
+  "友",
+  "反",
+  "叔",
+  "取",
+  "受",
+  "古",
+  "句",
+  "另",
+  "只",
+  "叫",
+  "召",
+  "叭",
+  "可",
+  "台",
+  "史",
+  "右",
+  "司",
+  "吃",
+  "各",
+  "合",
+  "吉",
+  "吊",
+  "同",
+  "名",
+  "后",
+  "吐",
+  "向",
+  "吒",
+  "君",
+  "吝",
+  "吞",
+  "吟",
+  "吠",
+  "否",
+  "吧",
+  "含",
+  "吳",
+  "吵",
+  "吸",
+  "吹",
+  "吾",
+  "呀",
+  "呂",
+  "呆",
+  "告",
+  "呢",
+  "周",
+  "味",
+  "呵",
+  "呼",
+  "命",
+  "和",
+  "咖",
+  "咦",
+  "咧",
+  "咪",
+  "咬",
+  "咱",
+  "哀",
+  "品",
+  "哇",
+  "哈",
+  "哉",
+  "哎",
+  "員",
+  "哥",
+  "哦",
+  "哩",
+  "哪",
+  "哭",
+  "哲",
+  "唉",
+  "唐",
+  "唔",
+  "唬",
+  "售",
+  "唯",
+  "唱",
+  "唷",
+  "唸",
+  "商",
+  "啊",
+  "問",
+  "啟",
+  "啡",
+  "啥",
+  "啦",
+  "啪",
+  "喀",
+  "喂",
+  "善",
+  "喇",
+  "喊",
+  "喔",
+  "喜",
+  "喝",
+  "喬",
+  "單",
+  "喵",
+  "嗎",
+  "嗚",
+  "嗨",
+  "嗯",
+  "嘆",
+  "嘉",
+  "嘗",
+  "嘛",
+  "嘴",
+  "嘻",
+  "嘿",
+  "器",
+  "噴",
+  "嚇",
+  "嚴",
+  "囉",
+  "四",
+  "回",
+  "因",
+  "困",
+  "固",
+  "圈",
+  "國",
+  "圍",
+  "園",
+  "圓",
+  "圖",
+  "團",
+  "圜",
+  "在",
+  "圭",
+  "地",
+  "圾",
+  "址",
+  "均",
+  "坎",
+  "坐",
+  "坡",
+  "坤",
+  "坦",
+  "坪",
+  "垂",
+  "垃",
+  "型",
+  "埃",
+  "城",
+  "埔",
+  "域",
+  "執",
+  "培",
+  "基",
+  "堂",
+  "堅",
+  "堆",
+  "堡",
+  "堪",
+  "報",
+  "場",
+  "塊",
+  "塔",
+  "塗",
+  "塞",
+  "填",
+  "塵",
+  "境",
+  "增",
+  "墨",
+  "墮",
+  "壁",
+  "壇",
+  "壓",
+  "壘",
+  "壞",
+  "壢",
+  "壬",
+  "壯",
+  "壽",
+  "夏",
+  "外",
+  "多",
+  "夜",
+  "夠",
+  "夢",
+  "夥",
+  "天",
+  "太",
+  "夫",
+  "央",
+  "失",
+  "夷",
+  "夸",
+  "夾",
+  "奇",
+  "奈",
+  "奉",
+  "奎",
+  "奏",
+  "契",
+  "奔",
+  "套",
+  "奧",
+  "奪",
+  "奮",
+  "奴",
+  "奶",
+  "她",
+  "好",
+  "如",
+  "妙",
+  "妝",
+  "妥",
+  "妨",
+  "妮",
+  "妳",
+  "妹",
+  "妻",
+  "姆",
+  "姊",
+  "始",
+  "姐",
+  "姑",
+  "姓",
+  "委",
+  "姿",
+  "威",
+  "娃",
+  "娘",
+  "娛",
+  "婁",
+  "婆",
+  "婚",
+  "婦",
+  "媒",
+  "媽",
+  "嫌",
+  "嫩",
+  "孔",
+  "字",
+  "存",
+  "孝",
+  "孟",
+  "季",
+  "孤",
+  "孩",
+  "孫",
+  "學",
+  "它",
+  "宅",
+  "宇",
+  "守",
+  "安",
+  "宋",
+  "完",
+  "宏",
+  "宗",
+  "官",
+  "宙",
+  "定",
+  "宛",
+  "宜",
+  "客",
+  "宣",
+  "室",
+  "宮",
+  "害",
+  "家",
+  "容",
+  "宿",
+  "寂",
+  "寄",
+  "寅",
+  "密",
+  "富",
+  "寒",
+  "寞",
+  "察",
+  "寢",
+  "實",
+  "寧",
+  "寨",
+  "審",
+  "寫",
+  "寬",
+  "寮",
+  "寵",
+  "寶",
+  "封",
+  "射",
+  "將",
+  "專",
+  "尊",
+  "尋",
+  "對",
+  "導",
+  "少",
+  "尖",
+  "尚",
+  "尤",
+  "就",
+  "尺",
+  "尼",
+  "尾",
+  "局",
+  "屁",
+  "居",
+  "屆",
+  "屋",
+  "屏",
+  "展",
+  "屠",
+  "層",
+  "屬",
+  "岡",
+  "岩",
+  "岸",
+  "峰",
+  "島",
+  "峽",
+  "崇",
+  "崙",
+  "崴",
+  "嵐",
+  "嶺",
+  "川",
+  "州",
+  "巡",
+  "左",
+  "巧",
+  "巨",
+  "巫",
+  "差",
+  "已",
+  "巳",
+  "巴",
+  "巷",
+  "市",
+  "布",
+  "希",
+  "帕",
+  "帖",
+  "帛",
+  "帝",
+  "帥",
+  "師",
+  "席",
+  "帳",
+  "帶",
+  "常",
+  "帽",
+  "幅",
+  "幕",
+  "幣",
+  "幫",
+  "平",
+  "年",
+  "幸",
+  "幹",
+  "幻",
+  "幼",
+  "幽",
+  "幾",
+  "庇",
+  "床",
+  "序",
+  "底",
+  "店",
+  "庚",
+  "府",
+  "度",
+  "座",
+  "庫",
+  "庭",
+  "康",
+  "庸",
+  "廉",
+  "廖",
+  "廠",
+  "廢",
+  "廣",
+  "廳",
+  "延",
+  "廷",
+  "建",
+  "弄",
+  "式",
+  "引",
+  "弗",
+  "弘",
+  "弟",
+  "弦",
+  "弱",
+  "張",
+  "強",
+  "彈",
+  "彊",
+  "彌",
+  "彎",
+  "彝",
+  "彞",
+  "形",
+  "彥",
+  "彩",
+  "彬",
+  "彭",
+  "彰",
+  "影",
+  "役",
+  "彼",
+  "往",
+  "征",
+  "待",
+  "很",
+  "律",
+  "後",
+  "徐",
+  "徑",
+  "徒",
+  "得",
+  "從",
+  "復",
+  "微",
+  "徵",
+  "德",
+  "徹",
+  "必",
+  "忌",
+  "忍",
+  "志",
+  "忘",
+  "忙",
+  "忠",
+  "快",
+  "念",
+  "忽",
+  "怎",
+  "怒",
+  "怕",
+  "怖",
+  "思",
+  "怡",
+  "急",
+  "性",
+  "怨",
+  "怪",
+  "恆",
+  "恐",
+  "恢",
+  "恥",
+  "恨",
+  "恩",
+  "恭",
+  "息",
+  "恰",
+  "悅",
+  "悉",
+  "悔",
+  "悟",
+  "悠",
+  "您",
+  "悲",
+  "悶",
+  "情",
+  "惑",
+  "惜",
+  "惠",
+  "惡",
+  "惱",
+  "想",
+  "惹",
+  "愁",
+  "愈",
+  "愉",
+  "意",
+  "愚",
+  "愛",
+  "感",
+  "慈",
+  "態",
+  "慕",
+  "慘",
+  "慢",
+  "慣",
+  "慧",
+  "慮",
+  "慰",
+  "慶",
+  "慾",
+  "憂",
+  "憐",
+  "憑",
+  "憲",
+  "憶",
+  "憾",
+  "懂",
+  "應",
+  "懶",
+  "懷",
+  "懼",
+  "戀",
+  "戊",
+  "戌",
+  "成",
+  "我",
+  "戒",
+  "或",
+  "截",
+  "戰",
+  "戲",
+  "戴",
+  "房",
+  "所",
+  "扁",
+  "扇",
+  "才",
+  "扎",
+  "打",
+  "托",
+  "扣",
+  "扥",
+  "扭",
+  "扯",
+  "批",
+  "找",
+  "承",
+  "技",
+  "抄",
+  "把",
+  "抓",
+  "投",
+  "抗",
+  "折",
+  "披",
+  "抬",
+  "抱",
+  "抵",
+  "抹",
+  "抽",
+  "拆",
+  "拉",
+  "拋",
+  "拍",
+  "拏",
+  "拒",
+  "拔",
+  "拖",
+  "招",
+  "拜",
+  "括",
+  "拳",
+  "拼",
+  "拾",
+  "拿",
+  "持",
+  "指",
+  "按",
+  "挑",
+  "挖",
+  "挪",
+  "振",
+  "挺",
+  "捐",
+  "捕",
+  "捨",
+  "捲",
+  "捷",
+  "掃",
+  "授",
+  "掉",
+  "掌",
+  "排",
+  "掛",
+  "採",
+  "探",
+  "接",
+  "控",
+  "推",
+  "措",
+  "描",
+  "提",
+  "插",
+  "揚",
+  "換",
+  "握",
+  "揮",
+  "援",
+  "損",
+  "搖",
+  "搜",
+  "搞",
+  "搬",
+  "搭",
+  "搶",
+  "摘",
+  "摩",
+  "摸",
+  "撐",
+  "撒",
+  "撞",
+  "撣",
+  "撥",
+  "播",
+  "撾",
+  "撿",
+  "擁",
+  "擇",
+  "擊",
+  "擋",
+  "操",
+  "擎",
+  "擔",
+  "據",
+  "擠",
+  "擦",
+  "擬",
+  "擴",
+  "擺",
+  "擾",
+  "攝",
+  "收",
+  "改",
+  "攻",
+  "放",
+  "政",
+  "故",
+  "效",
+  "敍",
+  "敏",
+  "救",
+  "敗",
+  "敘",
+  "教",
+  "敝",
+  "敢",
+  "散",
+  "敦",
+  "敬",
+  "整",
+  "敵",
+  "數",
+  "斐",
+  "料",
+  "斯",
+  "新",
+  "斷",
+  "於",
+  "施",
+  "旁",
+  "旅",
+  "旋",
+  "族",
+  "旗",
+  "既",
+  "旦",
+  "早",
+  "旭",
+  "旺",
+  "昂",
+  "昆",
+  "昇",
+  "昌",
+  "明",
+  "昏",
+  "易",
+  "星",
+  "映",
+  "春",
+  "昨",
+  "昭",
+  "是",
+  "時",
+  "晉",
+  "晒",
+  "晚",
+  "晨",
+  "普",
+  "景",
+  "晴",
+  "晶",
+  "智",
+  "暑",
+  "暖",
+  "暗",
+  "暫",
+  "暴",
+  "曆",
+  "曉",
+  "曲",
+  "更",
+  "書",
+  "曼",
+  "曾",
+  "替",
+  "最",
+  "會",
+  "有",
+  "朋",
+  "服",
+  "朗",
+  "望",
+  "朝",
+  "期",
+  "未",
+  "末",
+  "本",
+  "札",
+  "朱",
+  "朵",
+  "杉",
+  "李",
+  "材",
+  "村",
+  "杜",
+  "束",
+  "杯",
+  "杰",
+  "東",
+  "松",
+  "板",
+  "析",
+  "林",
+  "果",
+  "枝",
+  "架",
+  "柏",
+  "某",
+  "染",
+  "柔",
+  "查",
+  "柬",
+  "柯",
+  "柳",
+  "柴",
+  "校",
+  "核",
+  "根",
+  "格",
+  "桃",
+  "案",
+  "桌",
+  "桑",
+  "梁",
+  "梅",
+  "條",
+  "梨",
+  "梯",
+  "械",
+  "梵",
+  "棄",
+  "棉",
+  "棋",
+  "棒",
+  "棚",
+  "森",
+  "椅",
+  "植",
+  "椰",
+  "楊",
+  "楓",
+  "楚",
+  "業",
+  "極",
+  "概",
+  "榜",
+  "榮",
+  "構",
+  "槍",
+  "樂",
+  "樓",
+  "標",
+  "樞",
+  "模",
+  "樣",
+  "樹",
+  "橋",
+  "機",
+  "橫",
+  "檀",
+  "檔",
+  "檢",
+  "欄",
+  "權",
+  "次",
+  "欣",
+  "欲",
+  "欺",
+  "欽",
+  "款",
+  "歉",
+  "歌",
+  "歐",
+  "歡",
+  "正",
+  "此",
+  "步",
+  "武",
+  "歲",
+  "歷",
+  "歸",
+  "死",
+  "殊",
+  "殘",
+  "段",
+  "殺",
+  "殼",
+  "毀",
+  "毅",
+  "母",
+  "每",
+  "毒",
+  "毫",
+  "民",
+  "氣",
+  "永",
+  "求",
+  "汗",
+  "汝",
+  "江",
+  "池",
+  "污",
+  "汪",
+  "汶",
+  "決",
+  "汽",
+  "沃",
+  "沈",
+  "沉",
+  "沒",
+  "沖",
+  "沙",
+  "河",
+  "油",
+  "治",
+  "沿",
+  "況",
+  "泉",
+  "泊",
+  "法",
+  "泡",
+  "波",
+  "泥",
+  "注",
+  "泰",
+  "泳",
+  "洋",
+  "洗",
+  "洛",
+  "洞",
+  "洩",
+  "洪",
+  "洲",
+  "活",
+  "洽",
+  "派",
+  "流",
+  "浦",
+  "浩",
+  "浪",
+  "浮",
+  "海",
+  "涇",
+  "消",
+  "涉",
+  "涯",
+  "液",
+  "涵",
+  "涼",
+  "淑",
+  "淚",
+  "淡",
+  "淨",
+  "深",
+  "混",
+  "淺",
+  "清",
+  "減",
+  "渡",
+  "測",
+  "港",
+  "游",
+  "湖",
+  "湯",
+  "源",
+  "準",
+  "溝",
+  "溪",
+  "溫",
+  "滄",
+  "滅",
+  "滋",
+  "滑",
+  "滴",
+  "滾",
+  "滿",
+  "漂",
+  "漏",
+  "演",
+  "漠",
+  "漢",
+  "漫",
+  "漲",
+  "漸",
+  "潔",
+  "潘",
+  "潛",
+  "潮",
+  "澤",
+  "澳",
+  "激",
+  "濃",
+  "濟",
+  "濤",
+  "濫",
+  "濱",
+  "瀏",
+  "灌",
+  "灣",
+  "灰",
+  "災",
+  "炎",
+  "炮",
+  "炸",
+  "為",
+  "烈",
+  "烏",
+  "烤",
+  "無",
+  "焦",
+  "然",
+  "煙",
+  "煞",
+  "照",
+  "煩",
+  "熊",
+  "熟",
+  "熱",
+  "燃",
+  "燈",
+  "燒",
+  "營",
+  "爆",
+  "爐",
+  "爛",
+  "爬",
+  "爭",
+  "爵",
+  "爸",
+  "爺",
+  "爽",
+  "爾",
+  "牆",
+  "版",
+  "牌",
+  "牠",
+  "牧",
+  "物",
+  "牲",
+  "特",
+  "牽",
+  "犧",
+  "犯",
+  "狀",
+  "狂",
+  "狐",
+  "狗",
+  "狠",
+  "狼",
+  "猛",
+  "猜",
+  "猴",
+  "猶",
+  "獄",
+  "獅",
+  "獎",
+  "獨",
+  "獲",
+  "獸",
+  "獻",
+  "率",
+  "王",
+  "玩",
+  "玫",
+  "玲",
+  "玻",
+  "珊",
+  "珍",
+  "珠",
+  "珥",
+  "班",
+  "現",
+  "球",
+  "理",
+  "琉",
+  "琪",
+  "琴",
+  "瑙",
+  "瑜",
+  "瑞",
+  "瑟",
+  "瑤",
+  "瑪",
+  "瑰",
+  "環",
+  "瓶",
+  "甚",
+  "甜",
+  "產",
+  "由",
+  "甲",
+  "申",
+  "男",
+  "甸",
+  "界",
+  "留",
+  "畢",
+  "略",
+  "番",
+  "畫",
+  "異",
+  "當",
+  "疆",
+  "疏",
+  "疑",
+  "疼",
+  "病",
+  "痕",
+  "痛",
+  "痴",
+  "瘋",
+  "療",
+  "癡",
+  "癸",
+  "登",
+  "發",
+  "百",
+  "的",
+  "皆",
+  "皇",
+  "盃",
+  "益",
+  "盛",
+  "盜",
+  "盟",
+  "盡",
+  "監",
+  "盤",
+  "盧",
+  "盲",
+  "直",
+  "相",
+  "盼",
+  "盾",
+  "省",
+  "眉",
+  "看",
+  "真",
+  "眠",
+  "眼",
+  "眾",
+  "睛",
+  "睡",
+  "督",
+  "瞧",
+  "瞭",
+  "矣",
+  "知",
+  "短",
+  "砂",
+  "砍",
+  "研",
+  "砲",
+  "破",
+  "硬",
+  "碎",
+  "碗",
+  "碟",
+  "碧",
+  "碩",
+  "碰",
+  "確",
+  "碼",
+  "磁",
+  "磨",
+  "磯",
+  "礎",
+  "礙",
+  "社",
+  "祕",
+  "祖",
+  "祚",
+  "祛",
+  "祝",
+  "神",
+  "祥",
+  "票",
+  "祿",
+  "禁",
+  "禍",
+  "禎",
+  "福",
+  "禪",
+  "禮",
+  "秀",
+  "私",
+  "秋",
+  "科",
+  "秒",
+  "秘",
+  "租",
+  "秤",
+  "秦",
+  "移",
+  "稅",
+  "程",
+  "稍",
+  "種",
+  "稱",
+  "稿",
+  "穆",
+  "穌",
+  "積",
+  "穩",
+  "究",
+  "穹",
+  "空",
+  "穿",
+  "突",
+  "窗",
+  "窩",
+  "窮",
+  "窶",
+  "站",
+  "竟",
+  "章",
+  "童",
+  "端",
+  "競",
+  "笑",
+  "笛",
+  "符",
+  "笨",
+  "第",
+  "筆",
+  "等",
+  "筋",
+  "答",
+  "策",
+  "算",
+  "管",
+  "箭",
+  "箱",
+  "節",
+  "範",
+  "篇",
+  "築",
+  "簡",
+  "簫",
+  "簽",
+  "簿",
+  "籃",
+  "籌",
+  "籍",
+  "籤",
+  "粉",
+  "粗",
+  "粵",
+  "精",
+  "糊",
+  "糕",
+  "糟",
+  "系",
+  "糾",
+  "紀",
+  "約",
+  "紅",
+  "納",
+  "紐",
+  "純",
+  "紙",
+  "級",
+  "紛",
+  "素",
+  "索",
+  "紫",
+  "累",
+  "細",
+  "紹",
+  "終",
+  "組",
+  "結",
+  "絕",
+  "絡",
+  "給",
+  "統",
+  "絲",
+  "經",
+  "綜",
+  "綠",
+  "維",
+  "綱",
+  "網",
+  "緊",
+  "緒",
+  "線",
+  "緣",
+  "編",
+  "緩",
+  "緬",
+  "緯",
+  "練",
+  "縛",
+  "縣",
+  "縮",
+  "縱",
+  "總",
+  "績",
+  "繁",
+  "繆",
+  "織",
+  "繞",
+  "繪",
+  "繳",
+  "繼",
+  "續",
+  "缸",
+  "缺",
+  "罕",
+  "罪",
+  "置",
+  "罰",
+  "署",
+  "罵",
+  "罷",
+  "羅",
+  "美",
+  "羞",
+  "群",
+  "義",
+  "翁",
+  "習",
+  "翔",
+  "翰",
+  "翹",
+  "翻",
+  "翼",
+  "耀",
+  "考",
+  "者",
+  "耍",
+  "耐",
+  "耗",
+  "耶",
+  "聊",
+  "聖",
+  "聚",
+  "聞",
+  "聯",
+  "聰",
+  "聲",
+  "職",
+  "聽",
+  "肚",
+  "股",
+  "肥",
+  "肩",
+  "肯",
+  "育",
+  "背",
+  "胎",
+  "胖",
+  "胞",
+  "胡",
+  "胸",
+  "能",
+  "脆",
+  "脫",
+  "腓",
+  "腔",
+  "腦",
+  "腰",
+  "腳",
+  "腿",
+  "膽",
+  "臉",
+  "臘",
+  "臥",
+  "臨",
+  "臭",
+  "致",
+  "臺",
+  "與",
+  "興",
+  "舉",
+  "舊",
+  "舍",
+  "舒",
+  "舞",
+  "航",
+  "般",
+  "船",
+  "艦",
+  "良",
+  "艾",
+  "芝",
+  "芬",
+  "花",
+  "芳",
+  "若",
+  "苦",
+  "英",
+  "茅",
+  "茫",
+  "茲",
+  "茶",
+  "草",
+  "荒",
+  "荷",
+  "荼",
+  "莉",
+  "莊",
+  "莎",
+  "莫",
+  "菜",
+  "菩",
+  "華",
+  "菲",
+  "萄",
+  "萊",
+  "萬",
+  "落",
+  "葉",
+  "著",
+  "葛",
+  "葡",
+  "蒂",
+  "蒙",
+  "蒲",
+  "蒼",
+  "蓋",
+  "蓮",
+  "蔕",
+  "蔡",
+  "蔣",
+  "蕭",
+  "薄",
+  "薦",
+  "薩",
+  "薪",
+  "藉",
+  "藍",
+  "藏",
+  "藝",
+  "藤",
+  "藥",
+  "蘆",
+  "蘇",
+  "蘭",
+  "虎",
+  "處",
+  "虛",
+  "號",
+  "虧",
+  "蛇",
+  "蛋",
+  "蛙",
+  "蜂",
+  "蜜",
+  "蝶",
+  "融",
+  "螢",
+  "蟲",
+  "蟹",
+  "蠍",
+  "蠻",
+  "術",
+  "街",
+  "衛",
+  "衝",
+  "衡",
+  "表",
+  "袋",
+  "被",
+  "裁",
+  "裂",
+  "裕",
+  "補",
+  "裝",
+  "裡",
+  "製",
+  "複",
+  "褲",
+  "西",
+  "要",
+  "覆",
+  "規",
+  "視",
+  "親",
+  "覺",
+  "覽",
+  "觀",
+  "解",
+  "觸",
+  "訂",
+  "計",
+  "訊",
+  "討",
+  "訓",
+  "託",
+  "記",
+  "訥",
+  "訪",
+  "設",
+  "許",
+  "訴",
+  "註",
+  "証",
+  "評",
+  "詞",
+  "詢",
+  "試",
+  "詩",
+  "話",
+  "該",
+  "詳",
+  "誇",
+  "誌",
+  "認",
+  "誓",
+  "誕",
+  "語",
+  "誠",
+  "誤",
+  "說",
+  "誰",
+  "課",
+  "誼",
+  "調",
+  "談",
+  "請",
+  "諒",
+  "論",
+  "諸",
+  "諺",
+  "諾",
+  "謀",
+  "謂",
+  "講",
+  "謝",
+  "證",
+  "識",
+  "譜",
+  "警",
+  "譯",
+  "議",
+  "護",
+  "譽",
+  "讀",
+  "變",
+  "讓",
+  "讚",
+  "豈",
+  "豐",
+  "象",
+  "豪",
+  "豬",
+  "貌",
+  "貓",
+  "貞",
+  "負",
+  "財",
+  "貢",
+  "貨",
+  "貪",
+  "貫",
+  "責",
+  "貴",
+  "買",
+  "費",
+  "貼",
+  "賀",
+  "資",
+  "賈",
+  "賓",
+  "賜",
+  "賞",
+  "賢",
+  "賣",
+  "賤",
+  "賦",
+  "質",
+  "賭",
+  "賴",
+  "賺",
+  "購",
+  "賽",
+  "贈",
+  "贊",
+  "贏",
+  "赫",
+  "起",
+  "超",
+  "越",
+  "趕",
+  "趙",
+  "趣",
+  "趨",
+  "跌",
+  "跎",
+  "跑",
+  "距",
+  "跟",
+  "跡",
+  "路",
+  "跳",
+  "踏",
+  "踢",
+  "蹟",
+  "蹤",
+  "躍",
+  "躲",
+  "軌",
+  "軍",
+  "軒",
+  "軟",
+  "較",
+  "載",
+  "輔",
+  "輕",
+  "輛",
+  "輝",
+  "輩",
+  "輪",
+  "輯",
+  "輸",
+  "轉",
+  "轟",
+  "辦",
+  "辨",
+  "辭",
+  "辯",
+  "辱",
+  "農",
+  "迅",
+  "迎",
+  "近",
+  "返",
+  "迦",
+  "迪",
+  "迫",
+  "述",
+  "迴",
+  "迷",
+  "追",
+  "退",
+  "送",
+  "逃",
+  "逆",
+  "透",
+  "逐",
+  "途",
+  "這",
+  "通",
+  "逛",
+  "逝",
+  "速",
+  "造",
+  "逢",
+  "連",
+  "週",
+  "進",
+  "逸",
+  "逼",
+  "遇",
+  "遊",
+  "運",
+  "遍",
+  "過",
+  "道",
+  "達",
+  "違",
+  "遙",
+  "遜",
+  "遠",
+  "適",
+  "遭",
+  "遮",
+  "遲",
+  "遷",
+  "選",
+  "遺",
+  "避",
+  "邀",
+  "邁",
+  "還",
+  "邊",
+  "邏",
+  "那",
+  "邦",
+  "邪",
+  "邱",
+  "郎",
+  "部",
+  "郭",
+  "郵",
+  "都",
+  "鄂",
+  "鄉",
+  "鄭",
+  "鄰",
+  "配",
+  "酒",
+  "酷",
+  "酸",
+  "醉",
+  "醒",
+  "醜",
+  "醫",
+  "采",
+  "釋",
+  "重",
+  "野",
+  "量",
+  "針",
+  "釣",
+  "鈴",
+  "鉢",
+  "銀",
+  "銅",
+  "銖",
+  "銘",
+  "銳",
+  "銷",
+  "鋒",
+  "鋼",
+  "錄",
+  "錢",
+  "錦",
+  "錫",
+  "錯",
+  "鍋",
+  "鍵",
+  "鍾",
+  "鎊",
+  "鎖",
+  "鎮",
+  "鏡",
+  "鐘",
+  "鐵",
+  "鑑",
+  "閃",
+  "閉",
+  "開",
+  "閏",
+  "閒",
+  "間",
+  "閣",
+  "閱",
+  "闆",
+  "闊",
+  "闍",
+  "闐",
+  "關",
+  "闡",
+  "防",
+  "阻",
+  "阿",
+  "陀",
+  "附",
+  "降",
+  "限",
+  "院",
+  "陣",
+  "除",
+  "陪",
+  "陰",
+  "陳",
+  "陵",
+  "陶",
+  "陷",
+  "陸",
+  "陽",
+  "隆",
+  "隊",
+  "階",
+  "隔",
+  "際",
+  "障",
+  "隨",
+  "險",
+  "隱",
+  "隻",
+  "雄",
+  "雅",
+  "集",
+  "雉",
+  "雖",
+  "雙",
+  "雜",
+  "雞",
+  "離",
+  "難",
+  "雪",
+  "雲",
+  "零",
+  "雷",
+  "電",
+  "需",
+  "震",
+  "霍",
+  "霧",
+  "露",
+  "霸",
+  "霹",
+  "靂",
+  "靈",
+  "青",
+  "靖",
+  "靜",
+  "靠",
+  "靼",
+  "鞋",
+  "韃",
+  "韓",
+  "韻",
+  "響",
+  "頂",
+  "項",
+  "順",
+  "須",
+  "預",
+  "頑",
+  "頓",
+  "頗",
+  "領",
+  "頞",
+  "頭",
+  "頻",
+  "顆",
+  "題",
+  "額",
+  "顏",
+  "願",
+  "類",
+  "顧",
+  "顯",
+  "飄",
+  "飯",
+  "飲",
+  "飽",
+  "飾",
+  "餅",
+  "養",
+  "餐",
+  "餘",
+  "館",
+  "駐",
+  "駕",
+  "駛",
+  "騎",
+  "騙",
+  "騷",
+  "驅",
+  "驗",
+  "驚",
+  "體",
+  "髮",
+  "鬆",
+  "鬧",
+  "鬱",
+  "魁",
+  "魂",
+  "魅",
+  "魔",
+  "魯",
+  "鮮",
+  "鳳",
+  "鳴",
+  "鴻",
+  "鵝",
+  "鷹",
+  "麗",
+  "麵",
+  "麼",
+  "黎",
+  "默",
+  "點",
+  "黨",
+  "齋",
+  "齡",
+};
+const char *ALPHA_337_DIGITS[] = {
+};
+const uint32_t ALPHA_337_UPPER_CPS[] = {
+  19968, 19969, 19971, 19976, 19977, 19978, 19979, 19980, 19981, 19985, 19988, 19990, 19992, 19993, 19999, 20006,
+  20013, 20018, 20024, 20025, 20027, 20035, 20037, 20040, 20043, 20046, 20047, 20054, 20056, 20057, 20061, 20063,
+  20094, 20098, 20102, 20104, 20107, 20108, 20110, 20113, 20114, 20116, 20117, 20123, 20126, 20129, 20132, 20133,
+  20134, 20136, 20139, 20140, 20142, 20154, 20160, 20161, 20167, 20170, 20171, 20173, 20180, 20182, 20184, 20185,
+  20195, 20196, 20197, 20208, 20210, 20214, 20219, 20221, 20225, 20234, 20237, 20240, 20241, 20249, 20271, 20272,
+  20276, 20280, 20284, 20285, 20294, 20296, 20297, 20301, 20302, 20303, 20308, 20309, 20313, 20315, 20316, 20320,
+  20329, 20339, 20351, 20358, 20363, 20379, 20381, 20399, 20405, 20415, 20418, 20419, 20420, 20426, 20439, 20445,
+  20448, 20449, 20462, 20465, 20478, 20491, 20493, 20497, 20498, 20505, 20506, 20511, 20523, 20540, 20551, 20553,
+  20559, 20570, 20572, 20581, 20596, 20597, 20598, 20599, 20625, 20633, 20642, 20643, 20658, 20659, 20663, 20667,
+  20670, 20677, 20687, 20689, 20711, 20729, 20736, 20740, 20754, 20760, 20778, 20801, 20803, 20804, 20805, 20807,
+  20808, 20809, 20811, 20813, 20818, 20820, 20837, 20839, 20840, 20841, 20843, 20844, 20845, 20846, 20849, 20853,
+  20854, 20855, 20856, 20860, 20874, 20877, 20882, 20896, 20908, 20912, 20919, 20934, 20940, 20957, 20961, 20976,
+  20977, 20986, 20989, 20992, 20998, 20999, 21002, 21015, 21021, 21028, 21029, 21033, 21034, 21040, 21046, 21047,
+  21050, 21051, 21063, 21068, 21069, 21083, 21097, 21098, 21103, 21106, 21109, 21123, 21127, 21129, 21133, 21147,
+  21151, 21152, 21161, 21162, 21163, 21185, 21191, 21193, 21202, 21205, 21209, 21213, 21214, 21218, 21220, 21237,
+  21240, 21247, 21253, 21256, 21270, 21271, 21305, 21312, 21313, 21315, 21319, 21320, 21322, 21330, 21331, 21332,
+  21335, 21338, 21340, 21345, 21359, 21360, 21361, 21363, 21367, 21371, 21380, 21400, 21402, 21407, 21421, 21426,
+  21435, 21443, 21448, 21450, 21451, 21453, 21460, 21462, 21463, 21475, 21476, 21477, 21478, 21482, 21483, 21484,
+  21485, 21487, 21488, 21490, 21491, 21496, 21507, 21508, 21512, 21513, 21514, 21516, 21517, 21518, 21520, 21521,
+  21522, 21531, 21533, 21534, 21535, 21536, 21542, 21543, 21547, 21555, 21557, 21560, 21561, 21566, 21568, 21570,
+  21574, 21578, 21602, 21608, 21619, 21621, 21628, 21629, 21644, 21654, 21670, 21671, 21674, 21676, 21681, 21696,
+  21697, 21703, 21704, 21705, 21710, 21729, 21733, 21734, 21737, 21738, 21741, 21746, 21769, 21776, 21780, 21804,
+  21806, 21807, 21809, 21815, 21816, 21830, 21834, 21839, 21855, 21857, 21861, 21862, 21866, 21888, 21890, 21892,
+  21895, 21898, 21908, 21916, 21917, 21932, 21934, 21941, 21966, 21978, 21992, 21999, 22022, 22025, 22039, 22043,
+  22068, 22075, 22079, 22120, 22132, 22151, 22196, 22217, 22235, 22238, 22240, 22256, 22266, 22280, 22283, 22285,
+  22290, 22291, 22294, 22296, 22300, 22303, 22312, 22317, 22320, 22334, 22336, 22343, 22350, 22352, 22369, 22372,
+  22374, 22378, 22402, 22403, 22411, 22467, 22478, 22484, 22495, 22519, 22521, 22522, 22530, 22533, 22534, 22561,
+  22570, 22577, 22580, 22602, 22612, 22615, 22622, 22635, 22645, 22659, 22686, 22696, 22702, 22721, 22727, 22739,
+  22744, 22750, 22754, 22763, 22764, 22767, 22781, 22799, 22805, 22806, 22810, 22812, 22816, 22818, 22821, 22823,
+  22825, 22826, 22827, 22830, 22833, 22839, 22840, 22846, 22855, 22856, 22857, 22862, 22863, 22865, 22868, 22871,
+  22887, 22890, 22894, 22899, 22900, 22902, 22905, 22909, 22914, 22937, 22941, 22949, 22952, 22958, 22963, 22969,
+  22971, 22982, 22986, 22987, 22992, 22993, 22995, 22996, 23039, 23041, 23043, 23064, 23067, 23105, 23110, 23130,
+  23142, 23186, 23229, 23244, 23273, 23376, 23380, 23383, 23384, 23389, 23391, 23395, 23396, 23401, 23403, 23416,
+  23427, 23429, 23431, 23432, 23433, 23435, 23436, 23439, 23447, 23448, 23449, 23450, 23451, 23452, 23458, 23459,
+  23460, 23470, 23475, 23478, 23481, 23487, 23490, 23492, 23493, 23494, 23500, 23506, 23518, 23519, 23522, 23526,
+  23527, 23528, 23529, 23531, 23532, 23534, 23541, 23542, 23553, 23556, 23559, 23560, 23562, 23563, 23565, 23566,
+  23567, 23569, 23574, 23578, 23588, 23601, 23610, 23612, 23614, 23616, 23617, 23621, 23622, 23627, 23631, 23637,
+  23648, 23652, 23660, 23665, 23713, 23721, 23736, 23792, 23798, 23805, 23815, 23833, 23860, 23888, 23994, 24029,
+  24030, 24033, 24037, 24038, 24039, 24040, 24043, 24046, 24049, 24050, 24051, 24052, 24055, 24066, 24067, 24076,
+  24085, 24086, 24091, 24093, 24101, 24107, 24109, 24115, 24118, 24120, 24125, 24133, 24149, 24163, 24171, 24178,
+  24179, 24180, 24184, 24185, 24187, 24188, 24189, 24190, 24199, 24202, 24207, 24213, 24215, 24218, 24220, 24230,
+  24231, 24235, 24237, 24247, 24248, 24265, 24278, 24288, 24290, 24291, 24307, 24310, 24311, 24314, 24324, 24335,
+  24341, 24343, 24344, 24351, 24358, 24369, 24373, 24375, 24392, 24394, 24396, 24398, 24413, 24414, 24418, 24421,
+  24425, 24428, 24429, 24432, 24433, 24441, 24444, 24448, 24449, 24453, 24456, 24459, 24460, 24464, 24465, 24466,
+  24471, 24478, 24489, 24494, 24501, 24503, 24505, 24515, 24517, 24524, 24525, 24535, 24536, 24537, 24544, 24555,
+  24565, 24573, 24590, 24594, 24597, 24598, 24605, 24609, 24613, 24615, 24616, 24618, 24646, 24656, 24674, 24677,
+  24680, 24681, 24685, 24687, 24688, 24709, 24713, 24724, 24735, 24736, 24744, 24754, 24758, 24773, 24785, 24796,
+  24800, 24801, 24817, 24819, 24825, 24833, 24840, 24841, 24847, 24858, 24859, 24863, 24904, 24907, 24917, 24920,
+  24930, 24931, 24935, 24942, 24944, 24950, 24958, 24962, 24976, 24977, 25010, 25014, 25022, 25026, 25033, 25078,
+  25079, 25084, 25088, 25096, 25098, 25100, 25104, 25105, 25106, 25110, 25130, 25136, 25138, 25140, 25142, 25151,
+  25152, 25153, 25159, 25163, 25165, 25166, 25171, 25176, 25187, 25189, 25197, 25199, 25209, 25214, 25215, 25216,
+  25220, 25226, 25235, 25237, 25239, 25240, 25259, 25260, 25265, 25269, 25273, 25277, 25286, 25289, 25291, 25293,
+  25295, 25298, 25300, 25302, 25307, 25308, 25324, 25331, 25340, 25342, 25343, 25345, 25351, 25353, 25361, 25366,
+  25386, 25391, 25402, 25424, 25429, 25448, 25458, 25463, 25475, 25480, 25481, 25484, 25490, 25499, 25505, 25506,
+  25509, 25511, 25512, 25514, 25551, 25552, 25554, 25562, 25563, 25569, 25582, 25588, 25613, 25622, 25628, 25630,
+  25644, 25645, 25654, 25688, 25705, 25720, 25744, 25746, 25758, 25763, 25765, 25773, 25790, 25791, 25793, 25799,
+  25802, 25803, 25805, 25806, 25812, 25818, 25824, 25830, 25836, 25844, 25850, 25854, 25885, 25903, 25910, 25913,
+  25915, 25918, 25919, 25925, 25928, 25933, 25935, 25937, 25943, 25944, 25945, 25949, 25954, 25955, 25958, 25964,
+  25972, 25973, 25976, 25991, 26000, 26007, 26009, 26031, 26032, 26039, 26041, 26044, 26045, 26049, 26053, 26059,
+  26063, 26071, 26082, 26085, 26086, 26089, 26093, 26106, 26114, 26118, 26119, 26124, 26126, 26127, 26131, 26143,
+  26144, 26149, 26152, 26157, 26159, 26178, 26185, 26194, 26202, 26216, 26222, 26223, 26228, 26230, 26234, 26257,
+  26262, 26263, 26283, 26292, 26310, 26313, 26352, 26354, 26356, 26360, 26364, 26366, 26367, 26368, 26371, 26376,
+  26377, 26379, 26381, 26391, 26395, 26397, 26399, 26408, 26410, 26411, 26412, 26413, 26417, 26421, 26441, 26446,
+  26448, 26449, 26460, 26463, 26479, 26480, 26481, 26494, 26495, 26512, 26519, 26524, 26525, 26550, 26575, 26576,
+  26579, 26580, 26597, 26604, 26607, 26611, 26612, 26657, 26680, 26681, 26684, 26691, 26696, 26700, 26705, 26753,
+  26757, 26781, 26792, 26799, 26800, 26805, 26820, 26825, 26827, 26834, 26842, 26862, 26885, 26893, 26928, 26954,
+  26963, 26970, 26989, 26997, 27010, 27036, 27054, 27083, 27085, 27138, 27155, 27161, 27166, 27169, 27171, 27193,
+  27211, 27231, 27243, 27264, 27284, 27298, 27396, 27402, 27425, 27427, 27442, 27450, 27453, 27454, 27465, 27468,
+  27472, 27489, 27490, 27491, 27492, 27493, 27494, 27506, 27511, 27512, 27515, 27530, 27544, 27573, 27578, 27580,
+  27584, 27589, 27597, 27599, 27602, 27604, 27611, 27627, 27663, 27665, 27683, 27700, 27704, 27714, 27735, 27741,
+  27743, 27744, 27745, 27754, 27766, 27770, 27773, 27779, 27784, 27785, 27794, 27798, 27801, 27827, 27833, 27835,
+  27839, 27841, 27849, 27850, 27861, 27873, 27874, 27877, 27880, 27888, 27891, 27915, 27927, 27931, 27934, 27945,
+  27946, 27954, 27963, 27965, 27966, 27969, 28006, 28009, 28010, 28014, 28023, 28039, 28040, 28041, 28079, 28082,
+  28085, 28092, 28113, 28122, 28129, 28136, 28145, 28151, 28154, 28165, 28187, 28193, 28204, 28207, 28216, 28246,
+  28271, 28304, 28310, 28317, 28330, 28331, 28356, 28357, 28363, 28369, 28404, 28414, 28415, 28418, 28431, 28436,
+  28448, 28450, 28459, 28466, 28472, 28500, 28504, 28507, 28526, 28580, 28595, 28608, 28611, 28639, 28644, 28651,
+  28657, 28687, 28748, 28771, 28779, 28784, 28797, 28814, 28846, 28856, 28858, 28872, 28879, 28900, 28961, 28966,
+  28982, 29017, 29022, 29031, 29033, 29066, 29087, 29105, 29123, 29128, 29138, 29151, 29190, 29200, 29211, 29226,
+  29228, 29229, 29237, 29238, 29240, 29242, 29245, 29246, 29254, 29255, 29256, 29260, 29273, 29275, 29280, 29287,
+  29289, 29298, 29305, 29309, 29351, 29359, 29376, 29378, 29392, 29399, 29408, 29436, 29467, 29468, 29492, 29494,
+  29508, 29509, 29518, 29544, 29554, 29560, 29563, 29572, 29575, 29577, 29579, 29609, 29611, 29618, 29627, 29642,
+  29645, 29664, 29669, 29677, 29694, 29699, 29702, 29705, 29738, 29748, 29785, 29788, 29790, 29791, 29796, 29802,
+  29808, 29872, 29916, 29926, 29942, 29976, 29978, 29980, 29983, 29986, 29992, 30000, 30001, 30002, 30003, 30007,
+  30008, 30028, 30041, 30050, 30053, 30058, 30059, 30064, 30070, 30086, 30095, 30097, 30140, 30149, 30165, 30171,
+  30196, 30219, 30274, 30305, 30328, 30331, 30332, 30333, 30334, 30340, 30342, 30343, 30382, 30403, 30410, 30427,
+  30428, 30431, 30433, 30435, 30436, 30439, 30446, 30450, 30452, 30456, 30460, 30462, 30465, 30473, 30475, 30495,
+  30496, 30524, 30526, 30555, 30561, 30563, 30631, 30637, 30683, 30691, 30693, 30701, 30707, 30722, 30733, 30740,
+  30770, 30772, 30828, 30862, 30871, 30879, 30887, 30889, 30896, 30906, 30908, 30913, 30952, 30959, 30990, 31001,
+  31034, 31038, 31061, 31062, 31066, 31067, 31069, 31070, 31077, 31080, 31103, 31105, 31117, 31118, 31119, 31146,
+  31150, 31168, 31169, 31179, 31185, 31186, 31192, 31199, 31204, 31206, 31227, 31237, 31243, 31245, 31278, 31281,
+  31295, 31302, 31308, 31309, 31337, 31350, 31353, 31354, 31359, 31361, 31383, 31401, 31406, 31414, 31435, 31449,
+  31455, 31456, 31461, 31471, 31478, 31481, 31505, 31515, 31526, 31528, 31532, 31558, 31561, 31563, 31572, 31574,
+  31639, 31649, 31661, 31665, 31680, 31684, 31687, 31689, 31777, 31787, 31805, 31807, 31811, 31820, 31821, 31844,
+  31859, 31881, 31895, 31925, 31934, 31946, 31957, 31967, 31995, 31998, 32000, 32004, 32005, 32013, 32016, 32020,
+  32025, 32026, 32027, 32032, 32034, 32043, 32047, 32048, 32057, 32066, 32068, 32080, 32085, 32097, 32102, 32113,
+  32114, 32147, 32156, 32160, 32173, 32177, 32178, 32202, 32210, 32218, 32227, 32232, 32233, 32236, 32239, 32244,
+  32283, 32291, 32302, 32305, 32317, 32318, 32321, 32326, 32340, 32350, 32362, 32371, 32380, 32396, 32568, 32570,
+  32597, 32618, 32622, 32624, 32626, 32629, 32631, 32645, 32650, 32654, 32670, 32676, 32681, 32701, 32705, 32722,
+  32724, 32752, 32761, 32763, 32764, 32768, 32769, 32771, 32773, 32780, 32781, 32784, 32791, 32819, 32822, 32842,
+  32854, 32858, 32862, 32879, 32880, 32882, 32887, 32893, 32905, 32922, 32929, 32933, 32937, 32943, 32946, 32972,
+  32974, 32982, 32990, 32993, 33016, 33021, 33030, 33067, 33107, 33108, 33126, 33136, 33139, 33151, 33213, 33225,
+  33240, 33251, 33253, 33256, 33258, 33261, 33267, 33268, 33274, 33287, 33288, 33289, 33290, 33292, 33293, 33298,
+  33310, 33311, 33322, 33324, 33337, 33382, 33391, 33394, 33406, 33437, 33452, 33457, 33459, 33509, 33510, 33521,
+  33541, 33579, 33586, 33590, 33609, 33618, 33655, 33660, 33673, 33674, 33678, 33707, 33756, 33769, 33775, 33778,
+  33796, 33802, 33836, 33853, 33865, 33879, 33883, 33889, 33922, 33945, 33970, 33980, 33995, 34030, 34069, 34081,
+  34083, 34157, 34180, 34214, 34217, 34218, 34249, 34253, 34255, 34269, 34276, 34277, 34310, 34311, 34349, 34382,
+  34389, 34395, 34399, 34407, 34503, 34507, 34521, 34562, 34588, 34678, 34701, 34722, 34802, 34809, 34829, 34875,
+  34880, 34892, 34899, 34903, 34907, 34909, 34913, 34915, 34920, 34955, 34987, 35009, 35010, 35029, 35036, 35037,
+  35041, 35069, 35079, 35122, 35199, 35201, 35206, 35211, 35215, 35222, 35242, 35258, 35261, 35264, 35282, 35299,
+  35320, 35328, 35330, 35336, 35338, 35342, 35347, 35351, 35352, 35365, 35370, 35373, 35377, 35380, 35387, 35388,
+  35413, 35422, 35426, 35430, 35433, 35441, 35442, 35443, 35463, 35468, 35469, 35475, 35477, 35486, 35488, 35492,
+  35498, 35504, 35506, 35516, 35519, 35527, 35531, 35538, 35542, 35576, 35578, 35582, 35584, 35586, 35611, 35613,
+  35657, 35672, 35676, 35686, 35695, 35696, 35703, 35709, 35712, 35722, 35731, 35738, 35895, 35910, 35912, 35920,
+  35937, 35946, 35948, 35980, 35987, 35997, 35998, 36000, 36001, 36002, 36008, 36010, 36011, 36012, 36020, 36023,
+  36027, 36028, 36032, 36039, 36040, 36051, 36060, 36062, 36066, 36067, 36068, 36070, 36074, 36077, 36084, 36090,
+  36092, 36093, 36104, 36106, 36111, 36196, 36203, 36208, 36215, 36229, 36234, 36245, 36249, 36259, 36264, 36275,
+  36300, 36302, 36305, 36317, 36319, 36321, 36335, 36339, 36367, 36386, 36447, 36452, 36493, 36523, 36530, 36554,
+  36556, 36557, 36562, 36575, 36611, 36617, 36628, 36629, 36635, 36637, 36649, 36650, 36655, 36664, 36681, 36703,
+  36763, 36774, 36776, 36781, 36783, 36784, 36785, 36786, 36805, 36814, 36817, 36820, 36838, 36842, 36843, 36848,
+  36852, 36855, 36861, 36864, 36865, 36867, 36870, 36879, 36880, 36884, 36889, 36890, 36891, 36893, 36895, 36896,
+  36898, 36899, 36913, 36914, 36920, 36924, 36935, 36938, 36939, 36941, 36942, 36947, 36948, 36949, 36953, 36956,
+  36960, 36969, 36973, 36974, 36978, 36983, 36984, 36986, 36991, 36992, 36993, 36996, 37002, 37007, 37027, 37030,
+  37034, 37041, 37070, 37096, 37101, 37109, 37117, 37122, 37129, 37165, 37168, 37193, 37197, 37202, 37239, 37240,
+  37257, 37266, 37276, 37291, 37319, 37323, 37324, 37325, 37326, 37327, 37329, 37341, 37347, 37428, 37474, 37504,
+  37509, 37526, 37528, 37555, 37559, 37586, 37628, 37636, 37666, 37670, 37675, 37679, 37707, 37749, 37758, 37770,
+  37782, 37806, 37857, 37912, 37941, 37969, 38263, 38272, 38275, 38281, 38283, 38287, 38290, 38291, 38307, 38321,
+  38342, 38346, 38349, 38352, 38364, 38369, 38450, 38459, 38463, 38464, 38468, 38477, 38480, 38498, 38499, 38500,
+  38506, 38512, 38515, 38517, 38518, 38519, 38520, 38525, 38534, 38538, 38542, 38548, 38555, 38556, 38568, 38570,
+  38577, 38587, 38596, 38597, 38598, 38601, 38614, 38617, 38620, 38622, 38626, 38627, 38632, 38634, 38642, 38646,
+  38647, 38651, 38656, 38663, 38669, 38695, 38706, 38712, 38713, 38722, 38728, 38738, 38742, 38748, 38750, 38752,
+  38754, 38761, 38780, 38795, 38851, 38859, 38867, 38899, 38907, 38911, 38913, 38914, 38917, 38918, 38920, 38928,
+  38929, 38931, 38935, 38936, 38942, 38957, 38971, 38982, 38988, 38989, 38991, 39000, 39006, 39015, 39023, 39080,
+  39108, 39131, 39135, 39151, 39154, 39165, 39166, 39173, 39178, 39184, 39192, 39208, 39318, 39321, 39340, 39376,
+  39381, 39387, 39438, 39449, 39479, 39493, 39511, 39514, 39592, 39636, 39640, 39662, 39686, 39717, 39719, 39729,
+  39740, 39745, 39746, 39749, 39764, 39770, 39791, 39854, 40165, 40179, 40180, 40251, 40285, 40441, 40575, 40599,
+  40613, 40629, 40635, 40636, 40643, 40654, 40657, 40664, 40670, 40680, 40723, 40736, 40763, 40778, 40779, 40786,
+  40801, 40845, 40860,
+};
+const uint32_t ALPHA_337_LOWER_CPS[] = {
+  19968, 19969, 19971, 19976, 19977, 19978, 19979, 19980, 19981, 19985, 19988, 19990, 19992, 19993, 19999, 20006,
+  20013, 20018, 20024, 20025, 20027, 20035, 20037, 20040, 20043, 20046, 20047, 20054, 20056, 20057, 20061, 20063,
+  20094, 20098, 20102, 20104, 20107, 20108, 20110, 20113, 20114, 20116, 20117, 20123, 20126, 20129, 20132, 20133,
+  20134, 20136, 20139, 20140, 20142, 20154, 20160, 20161, 20167, 20170, 20171, 20173, 20180, 20182, 20184, 20185,
+  20195, 20196, 20197, 20208, 20210, 20214, 20219, 20221, 20225, 20234, 20237, 20240, 20241, 20249, 20271, 20272,
+  20276, 20280, 20284, 20285, 20294, 20296, 20297, 20301, 20302, 20303, 20308, 20309, 20313, 20315, 20316, 20320,
+  20329, 20339, 20351, 20358, 20363, 20379, 20381, 20399, 20405, 20415, 20418, 20419, 20420, 20426, 20439, 20445,
+  20448, 20449, 20462, 20465, 20478, 20491, 20493, 20497, 20498, 20505, 20506, 20511, 20523, 20540, 20551, 20553,
+  20559, 20570, 20572, 20581, 20596, 20597, 20598, 20599, 20625, 20633, 20642, 20643, 20658, 20659, 20663, 20667,
+  20670, 20677, 20687, 20689, 20711, 20729, 20736, 20740, 20754, 20760, 20778, 20801, 20803, 20804, 20805, 20807,
+  20808, 20809, 20811, 20813, 20818, 20820, 20837, 20839, 20840, 20841, 20843, 20844, 20845, 20846, 20849, 20853,
+  20854, 20855, 20856, 20860, 20874, 20877, 20882, 20896, 20908, 20912, 20919, 20934, 20940, 20957, 20961, 20976,
+  20977, 20986, 20989, 20992, 20998, 20999, 21002, 21015, 21021, 21028, 21029, 21033, 21034, 21040, 21046, 21047,
+  21050, 21051, 21063, 21068, 21069, 21083, 21097, 21098, 21103, 21106, 21109, 21123, 21127, 21129, 21133, 21147,
+  21151, 21152, 21161, 21162, 21163, 21185, 21191, 21193, 21202, 21205, 21209, 21213, 21214, 21218, 21220, 21237,
+  21240, 21247, 21253, 21256, 21270, 21271, 21305, 21312, 21313, 21315, 21319, 21320, 21322, 21330, 21331, 21332,
+  21335, 21338, 21340, 21345, 21359, 21360, 21361, 21363, 21367, 21371, 21380, 21400, 21402, 21407, 21421, 21426,
+  21435, 21443, 21448, 21450, 21451, 21453, 21460, 21462, 21463, 21475, 21476, 21477, 21478, 21482, 21483, 21484,
+  21485, 21487, 21488, 21490, 21491, 21496, 21507, 21508, 21512, 21513, 21514, 21516, 21517, 21518, 21520, 21521,
+  21522, 21531, 21533, 21534, 21535, 21536, 21542, 21543, 21547, 21555, 21557, 21560, 21561, 21566, 21568, 21570,
+  21574, 21578, 21602, 21608, 21619, 21621, 21628, 21629, 21644, 21654, 21670, 21671, 21674, 21676, 21681, 21696,
+  21697, 21703, 21704, 21705, 21710, 21729, 21733, 21734, 21737, 21738, 21741, 21746, 21769, 21776, 21780, 21804,
+  21806, 21807, 21809, 21815, 21816, 21830, 21834, 21839, 21855, 21857, 21861, 21862, 21866, 21888, 21890, 21892,
+  21895, 21898, 21908, 21916, 21917, 21932, 21934, 21941, 21966, 21978, 21992, 21999, 22022, 22025, 22039, 22043,
+  22068, 22075, 22079, 22120, 22132, 22151, 22196, 22217, 22235, 22238, 22240, 22256, 22266, 22280, 22283, 22285,
+  22290, 22291, 22294, 22296, 22300, 22303, 22312, 22317, 22320, 22334, 22336, 22343, 22350, 22352, 22369, 22372,
+  22374, 22378, 22402, 22403, 22411, 22467, 22478, 22484, 22495, 22519, 22521, 22522, 22530, 22533, 22534, 22561,
+  22570, 22577, 22580, 22602, 22612, 22615, 22622, 22635, 22645, 22659, 22686, 22696, 22702, 22721, 22727, 22739,
+  22744, 22750, 22754, 22763, 22764, 22767, 22781, 22799, 22805, 22806, 22810, 22812, 22816, 22818, 22821, 22823,
+  22825, 22826, 22827, 22830, 22833, 22839, 22840, 22846, 22855, 22856, 22857, 22862, 22863, 22865, 22868, 22871,
+  22887, 22890, 22894, 22899, 22900, 22902, 22905, 22909, 22914, 22937, 22941, 22949, 22952, 22958, 22963, 22969,
+  22971, 22982, 22986, 22987, 22992, 22993, 22995, 22996, 23039, 23041, 23043, 23064, 23067, 23105, 23110, 23130,
+  23142, 23186, 23229, 23244, 23273, 23376, 23380, 23383, 23384, 23389, 23391, 23395, 23396, 23401, 23403, 23416,
+  23427, 23429, 23431, 23432, 23433, 23435, 23436, 23439, 23447, 23448, 23449, 23450, 23451, 23452, 23458, 23459,
+  23460, 23470, 23475, 23478, 23481, 23487, 23490, 23492, 23493, 23494, 23500, 23506, 23518, 23519, 23522, 23526,
+  23527, 23528, 23529, 23531, 23532, 23534, 23541, 23542, 23553, 23556, 23559, 23560, 23562, 23563, 23565, 23566,
+  23567, 23569, 23574, 23578, 23588, 23601, 23610, 23612, 23614, 23616, 23617, 23621, 23622, 23627, 23631, 23637,
+  23648, 23652, 23660, 23665, 23713, 23721, 23736, 23792, 23798, 23805, 23815, 23833, 23860, 23888, 23994, 24029,
+  24030, 24033, 24037, 24038, 24039, 24040, 24043, 24046, 24049, 24050, 24051, 24052, 24055, 24066, 24067, 24076,
+  24085, 24086, 24091, 24093, 24101, 24107, 24109, 24115, 24118, 24120, 24125, 24133, 24149, 24163, 24171, 24178,
+  24179, 24180, 24184, 24185, 24187, 24188, 24189, 24190, 24199, 24202, 24207, 24213, 24215, 24218, 24220, 24230,
+  24231, 24235, 24237, 24247, 24248, 24265, 24278, 24288, 24290, 24291, 24307, 24310, 24311, 24314, 24324, 24335,
+  24341, 24343, 24344, 24351, 24358, 24369, 24373, 24375, 24392, 24394, 24396, 24398, 24413, 24414, 24418, 24421,
+  24425, 24428, 24429, 24432, 24433, 24441, 24444, 24448, 24449, 24453, 24456, 24459, 24460, 24464, 24465, 24466,
+  24471, 24478, 24489, 24494, 24501, 24503, 24505, 24515, 24517, 24524, 24525, 24535, 24536, 24537, 24544, 24555,
+  24565, 24573, 24590, 24594, 24597, 24598, 24605, 24609, 24613, 24615, 24616, 24618, 24646, 24656, 24674, 24677,
+  24680, 24681, 24685, 24687, 24688, 24709, 24713, 24724, 24735, 24736, 24744, 24754, 24758, 24773, 24785, 24796,
+  24800, 24801, 24817, 24819, 24825, 24833, 24840, 24841, 24847, 24858, 24859, 24863, 24904, 24907, 24917, 24920,
+  24930, 24931, 24935, 24942, 24944, 24950, 24958, 24962, 24976, 24977, 25010, 25014, 25022, 25026, 25033, 25078,
+  25079, 25084, 25088, 25096, 25098, 25100, 25104, 25105, 25106, 25110, 25130, 25136, 25138, 25140, 25142, 25151,
+  25152, 25153, 25159, 25163, 25165, 25166, 25171, 25176, 25187, 25189, 25197, 25199, 25209, 25214, 25215, 25216,
+  25220, 25226, 25235, 25237, 25239, 25240, 25259, 25260, 25265, 25269, 25273, 25277, 25286, 25289, 25291, 25293,
+  25295, 25298, 25300, 25302, 25307, 25308, 25324, 25331, 25340, 25342, 25343, 25345, 25351, 25353, 25361, 25366,
+  25386, 25391, 25402, 25424, 25429, 25448, 25458, 25463, 25475, 25480, 25481, 25484, 25490, 25499, 25505, 25506,
+  25509, 25511, 25512, 25514, 25551, 25552, 25554, 25562, 25563, 25569, 25582, 25588, 25613, 25622, 25628, 25630,
+  25644, 25645, 25654, 25688, 25705, 25720, 25744, 25746, 25758, 25763, 25765, 25773, 25790, 25791, 25793, 25799,
+  25802, 25803, 25805, 25806, 25812, 25818, 25824, 25830, 25836, 25844, 25850, 25854, 25885, 25903, 25910, 25913,
+  25915, 25918, 25919, 25925, 25928, 25933, 25935, 25937, 25943, 25944, 25945, 25949, 25954, 25955, 25958, 25964,
+  25972, 25973, 25976, 25991, 26000, 26007, 26009, 26031, 26032, 26039, 26041, 26044, 26045, 26049, 26053, 26059,
+  26063, 26071, 26082, 26085, 26086, 26089, 26093, 26106, 26114, 26118, 26119, 26124, 26126, 26127, 26131, 26143,
+  26144, 26149, 26152, 26157, 26159, 26178, 26185, 26194, 26202, 26216, 26222, 26223, 26228, 26230, 26234, 26257,
+  26262, 26263, 26283, 26292, 26310, 26313, 26352, 26354, 26356, 26360, 26364, 26366, 26367, 26368, 26371, 26376,
+  26377, 26379, 26381, 26391, 26395, 26397, 26399, 26408, 26410, 26411, 26412, 26413, 26417, 26421, 26441, 26446,
+  26448, 26449, 26460, 26463, 26479, 26480, 26481, 26494, 26495, 26512, 26519, 26524, 26525, 26550, 26575, 26576,
+  26579, 26580, 26597, 26604, 26607, 26611, 26612, 26657, 26680, 26681, 26684, 26691, 26696, 26700, 26705, 26753,
+  26757, 26781, 26792, 26799, 26800, 26805, 26820, 26825, 26827, 26834, 26842, 26862, 26885, 26893, 26928, 26954,
+  26963, 26970, 26989, 26997, 27010, 27036, 27054, 27083, 27085, 27138, 27155, 27161, 27166, 27169, 27171, 27193,
+  27211, 27231, 27243, 27264, 27284, 27298, 27396, 27402, 27425, 27427, 27442, 27450, 27453, 27454, 27465, 27468,
+  27472, 27489, 27490, 27491, 27492, 27493, 27494, 27506, 27511, 27512, 27515, 27530, 27544, 27573, 27578, 27580,
+  27584, 27589, 27597, 27599, 27602, 27604, 27611, 27627, 27663, 27665, 27683, 27700, 27704, 27714, 27735, 27741,
+  27743, 27744, 27745, 27754, 27766, 27770, 27773, 27779, 27784, 27785, 27794, 27798, 27801, 27827, 27833, 27835,
+  27839, 27841, 27849, 27850, 27861, 27873, 27874, 27877, 27880, 27888, 27891, 27915, 27927, 27931, 27934, 27945,
+  27946, 27954, 27963, 27965, 27966, 27969, 28006, 28009, 28010, 28014, 28023, 28039, 28040, 28041, 28079, 28082,
+  28085, 28092, 28113, 28122, 28129, 28136, 28145, 28151, 28154, 28165, 28187, 28193, 28204, 28207, 28216, 28246,
+  28271, 28304, 28310, 28317, 28330, 28331, 28356, 28357, 28363, 28369, 28404, 28414, 28415, 28418, 28431, 28436,
+  28448, 28450, 28459, 28466, 28472, 28500, 28504, 28507, 28526, 28580, 28595, 28608, 28611, 28639, 28644, 28651,
+  28657, 28687, 28748, 28771, 28779, 28784, 28797, 28814, 28846, 28856, 28858, 28872, 28879, 28900, 28961, 28966,
+  28982, 29017, 29022, 29031, 29033, 29066, 29087, 29105, 29123, 29128, 29138, 29151, 29190, 29200, 29211, 29226,
+  29228, 29229, 29237, 29238, 29240, 29242, 29245, 29246, 29254, 29255, 29256, 29260, 29273, 29275, 29280, 29287,
+  29289, 29298, 29305, 29309, 29351, 29359, 29376, 29378, 29392, 29399, 29408, 29436, 29467, 29468, 29492, 29494,
+  29508, 29509, 29518, 29544, 29554, 29560, 29563, 29572, 29575, 29577, 29579, 29609, 29611, 29618, 29627, 29642,
+  29645, 29664, 29669, 29677, 29694, 29699, 29702, 29705, 29738, 29748, 29785, 29788, 29790, 29791, 29796, 29802,
+  29808, 29872, 29916, 29926, 29942, 29976, 29978, 29980, 29983, 29986, 29992, 30000, 30001, 30002, 30003, 30007,
+  30008, 30028, 30041, 30050, 30053, 30058, 30059, 30064, 30070, 30086, 30095, 30097, 30140, 30149, 30165, 30171,
+  30196, 30219, 30274, 30305, 30328, 30331, 30332, 30333, 30334, 30340, 30342, 30343, 30382, 30403, 30410, 30427,
+  30428, 30431, 30433, 30435, 30436, 30439, 30446, 30450, 30452, 30456, 30460, 30462, 30465, 30473, 30475, 30495,
+  30496, 30524, 30526, 30555, 30561, 30563, 30631, 30637, 30683, 30691, 30693, 30701, 30707, 30722, 30733, 30740,
+  30770, 30772, 30828, 30862, 30871, 30879, 30887, 30889, 30896, 30906, 30908, 30913, 30952, 30959, 30990, 31001,
+  31034, 31038, 31061, 31062, 31066, 31067, 31069, 31070, 31077, 31080, 31103, 31105, 31117, 31118, 31119, 31146,
+  31150, 31168, 31169, 31179, 31185, 31186, 31192, 31199, 31204, 31206, 31227, 31237, 31243, 31245, 31278, 31281,
+  31295, 31302, 31308, 31309, 31337, 31350, 31353, 31354, 31359, 31361, 31383, 31401, 31406, 31414, 31435, 31449,
+  31455, 31456, 31461, 31471, 31478, 31481, 31505, 31515, 31526, 31528, 31532, 31558, 31561, 31563, 31572, 31574,
+  31639, 31649, 31661, 31665, 31680, 31684, 31687, 31689, 31777, 31787, 31805, 31807, 31811, 31820, 31821, 31844,
+  31859, 31881, 31895, 31925, 31934, 31946, 31957, 31967, 31995, 31998, 32000, 32004, 32005, 32013, 32016, 32020,
+  32025, 32026, 32027, 32032, 32034, 32043, 32047, 32048, 32057, 32066, 32068, 32080, 32085, 32097, 32102, 32113,
+  32114, 32147, 32156, 32160, 32173, 32177, 32178, 32202, 32210, 32218, 32227, 32232, 32233, 32236, 32239, 32244,
+  32283, 32291, 32302, 32305, 32317, 32318, 32321, 32326, 32340, 32350, 32362, 32371, 32380, 32396, 32568, 32570,
+  32597, 32618, 32622, 32624, 32626, 32629, 32631, 32645, 32650, 32654, 32670, 32676, 32681, 32701, 32705, 32722,
+  32724, 32752, 32761, 32763, 32764, 32768, 32769, 32771, 32773, 32780, 32781, 32784, 32791, 32819, 32822, 32842,
+  32854, 32858, 32862, 32879, 32880, 32882, 32887, 32893, 32905, 32922, 32929, 32933, 32937, 32943, 32946, 32972,
+  32974, 32982, 32990, 32993, 33016, 33021, 33030, 33067, 33107, 33108, 33126, 33136, 33139, 33151, 33213, 33225,
+  33240, 33251, 33253, 33256, 33258, 33261, 33267, 33268, 33274, 33287, 33288, 33289, 33290, 33292, 33293, 33298,
+  33310, 33311, 33322, 33324, 33337, 33382, 33391, 33394, 33406, 33437, 33452, 33457, 33459, 33509, 33510, 33521,
+  33541, 33579, 33586, 33590, 33609, 33618, 33655, 33660, 33673, 33674, 33678, 33707, 33756, 33769, 33775, 33778,
+  33796, 33802, 33836, 33853, 33865, 33879, 33883, 33889, 33922, 33945, 33970, 33980, 33995, 34030, 34069, 34081,
+  34083, 34157, 34180, 34214, 34217, 34218, 34249, 34253, 34255, 34269, 34276, 34277, 34310, 34311, 34349, 34382,
+  34389, 34395, 34399, 34407, 34503, 34507, 34521, 34562, 34588, 34678, 34701, 34722, 34802, 34809, 34829, 34875,
+  34880, 34892, 34899, 34903, 34907, 34909, 34913, 34915, 34920, 34955, 34987, 35009, 35010, 35029, 35036, 35037,
+  35041, 35069, 35079, 35122, 35199, 35201, 35206, 35211, 35215, 35222, 35242, 35258, 35261, 35264, 35282, 35299,
+  35320, 35328, 35330, 35336, 35338, 35342, 35347, 35351, 35352, 35365, 35370, 35373, 35377, 35380, 35387, 35388,
+  35413, 35422, 35426, 35430, 35433, 35441, 35442, 35443, 35463, 35468, 35469, 35475, 35477, 35486, 35488, 35492,
+  35498, 35504, 35506, 35516, 35519, 35527, 35531, 35538, 35542, 35576, 35578, 35582, 35584, 35586, 35611, 35613,
+  35657, 35672, 35676, 35686, 35695, 35696, 35703, 35709, 35712, 35722, 35731, 35738, 35895, 35910, 35912, 35920,
+  35937, 35946, 35948, 35980, 35987, 35997, 35998, 36000, 36001, 36002, 36008, 36010, 36011, 36012, 36020, 36023,
+  36027, 36028, 36032, 36039, 36040, 36051, 36060, 36062, 36066, 36067, 36068, 36070, 36074, 36077, 36084, 36090,
+  36092, 36093, 36104, 36106, 36111, 36196, 36203, 36208, 36215, 36229, 36234, 36245, 36249, 36259, 36264, 36275,
+  36300, 36302, 36305, 36317, 36319, 36321, 36335, 36339, 36367, 36386, 36447, 36452, 36493, 36523, 36530, 36554,
+  36556, 36557, 36562, 36575, 36611, 36617, 36628, 36629, 36635, 36637, 36649, 36650, 36655, 36664, 36681, 36703,
+  36763, 36774, 36776, 36781, 36783, 36784, 36785, 36786, 36805, 36814, 36817, 36820, 36838, 36842, 36843, 36848,
+  36852, 36855, 36861, 36864, 36865, 36867, 36870, 36879, 36880, 36884, 36889, 36890, 36891, 36893, 36895, 36896,
+  36898, 36899, 36913, 36914, 36920, 36924, 36935, 36938, 36939, 36941, 36942, 36947, 36948, 36949, 36953, 36956,
+  36960, 36969, 36973, 36974, 36978, 36983, 36984, 36986, 36991, 36992, 36993, 36996, 37002, 37007, 37027, 37030,
+  37034, 37041, 37070, 37096, 37101, 37109, 37117, 37122, 37129, 37165, 37168, 37193, 37197, 37202, 37239, 37240,
+  37257, 37266, 37276, 37291, 37319, 37323, 37324, 37325, 37326, 37327, 37329, 37341, 37347, 37428, 37474, 37504,
+  37509, 37526, 37528, 37555, 37559, 37586, 37628, 37636, 37666, 37670, 37675, 37679, 37707, 37749, 37758, 37770,
+  37782, 37806, 37857, 37912, 37941, 37969, 38263, 38272, 38275, 38281, 38283, 38287, 38290, 38291, 38307, 38321,
+  38342, 38346, 38349, 38352, 38364, 38369, 38450, 38459, 38463, 38464, 38468, 38477, 38480, 38498, 38499, 38500,
+  38506, 38512, 38515, 38517, 38518, 38519, 38520, 38525, 38534, 38538, 38542, 38548, 38555, 38556, 38568, 38570,
+  38577, 38587, 38596, 38597, 38598, 38601, 38614, 38617, 38620, 38622, 38626, 38627, 38632, 38634, 38642, 38646,
+  38647, 38651, 38656, 38663, 38669, 38695, 38706, 38712, 38713, 38722, 38728, 38738, 38742, 38748, 38750, 38752,
+  38754, 38761, 38780, 38795, 38851, 38859, 38867, 38899, 38907, 38911, 38913, 38914, 38917, 38918, 38920, 38928,
+  38929, 38931, 38935, 38936, 38942, 38957, 38971, 38982, 38988, 38989, 38991, 39000, 39006, 39015, 39023, 39080,
+  39108, 39131, 39135, 39151, 39154, 39165, 39166, 39173, 39178, 39184, 39192, 39208, 39318, 39321, 39340, 39376,
+  39381, 39387, 39438, 39449, 39479, 39493, 39511, 39514, 39592, 39636, 39640, 39662, 39686, 39717, 39719, 39729,
+  39740, 39745, 39746, 39749, 39764, 39770, 39791, 39854, 40165, 40179, 40180, 40251, 40285, 40441, 40575, 40599,
+  40613, 40629, 40635, 40636, 40643, 40654, 40657, 40664, 40670, 40680, 40723, 40736, 40763, 40778, 40779, 40786,
+  40801, 40845, 40860,
+};
+const uint32_t ALPHA_337_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_337_FREQ[] = {
+  { "一", 0.01230000 },
+  { "乙", 0.00010000 },
+  { "二", 0.00200000 },
+  { "人", 0.00830000 },
+  { "入", 0.00210000 },
+  { "八", 0.00060000 },
+  { "刀", 0.00010000 },
+  { "力", 0.00170000 },
+  { "十", 0.00180000 },
+  { "卜", 0.00010000 },
+  { "又", 0.00090000 },
+  { "口", 0.00160000 },
+  { "土", 0.00060000 },
+  { "士", 0.00170000 },
+  { "夕", 0.00000000 },
+  { "大", 0.00800000 },
+  { "女", 0.00110000 },
+  { "子", 0.00270000 },
+  { "小", 0.00200000 },
+  { "山", 0.00210000 },
+  { "工", 0.00190000 },
+  { "己", 0.00050000 },
+  { "干", 0.00020000 },
+  { "心", 0.00120000 },
+  { "戈", 0.00010000 },
+  { "戶", 0.00020000 },
+  { "手", 0.00110000 },
+  { "支", 0.00080000 },
+  { "文", 0.00270000 },
+  { "斗", 0.00010000 },
+  { "方", 0.00320000 },
+  { "日", 0.00550000 },
+  { "曰", 0.00000000 },
+  { "月", 0.00520000 },
+  { "木", 0.00040000 },
+  { "止", 0.00040000 },
+  { "比", 0.00160000 },
+  { "毛", 0.00030000 },
+  { "氏", 0.00040000 },
+  { "水", 0.00140000 },
+  { "火", 0.00060000 },
+  { "爪", 0.00000000 },
+  { "父", 0.00040000 },
+  { "片", 0.00070000 },
+  { "牙", 0.00040000 },
+  { "牛", 0.00020000 },
+  { "玄", 0.00010000 },
+  { "玉", 0.00020000 },
+  { "瓜", 0.00010000 },
+  { "瓦", 0.00040000 },
+  { "甘", 0.00010000 },
+  { "生", 0.00380000 },
+  { "用", 0.00350000 },
+  { "田", 0.00050000 },
+  { "白", 0.00070000 },
+  { "皮", 0.00030000 },
+  { "目", 0.00160000 },
+  { "矛", 0.00000000 },
+  { "石", 0.00080000 },
+  { "示", 0.00080000 },
+  { "立", 0.00220000 },
+  { "竹", 0.00010000 },
+  { "米", 0.00150000 },
+  { "羊", 0.00010000 },
+  { "羽", 0.00010000 },
+  { "老", 0.00040000 },
+  { "而", 0.00330000 },
+  { "耳", 0.00020000 },
+  { "肉", 0.00010000 },
+  { "臣", 0.00020000 },
+  { "自", 0.00260000 },
+  { "至", 0.00220000 },
+  { "舌", 0.00000000 },
+  { "舟", 0.00000000 },
+  { "色", 0.00120000 },
+  { "血", 0.00020000 },
+  { "行", 0.00420000 },
+  { "衣", 0.00010000 },
+  { "見", 0.00040000 },
+  { "角", 0.00070000 },
+  { "言", 0.00060000 },
+  { "谷", 0.00020000 },
+  { "豆", 0.00010000 },
+  { "貝", 0.00020000 },
+  { "赤", 0.00030000 },
+  { "走", 0.00030000 },
+  { "足", 0.00070000 },
+  { "身", 0.00100000 },
+  { "車", 0.00110000 },
+  { "辛", 0.00010000 },
+  { "辰", 0.00000000 },
+  { "酉", 0.00000000 },
+  { "里", 0.00230000 },
+  { "金", 0.00140000 },
+  { "長", 0.00160000 },
+  { "門", 0.00070000 },
+  { "雨", 0.00020000 },
+  { "非", 0.00080000 },
+  { "面", 0.00210000 },
+  { "革", 0.00040000 },
+  { "韋", 0.00010000 },
+  { "音", 0.00110000 },
+  { "頁", 0.00010000 },
+  { "風", 0.00050000 },
+  { "飛", 0.00040000 },
+  { "食", 0.00050000 },
+  { "首", 0.00130000 },
+  { "香", 0.00120000 },
+  { "馬", 0.00100000 },
+  { "骨", 0.00020000 },
+  { "高", 0.00240000 },
+  { "鬥", 0.00020000 },
+  { "鬼", 0.00010000 },
+  { "魚", 0.00040000 },
+  { "鳥", 0.00010000 },
+  { "鹿", 0.00010000 },
+  { "麥", 0.00020000 },
+  { "麻", 0.00010000 },
+  { "黃", 0.00030000 },
+  { "黑", 0.00050000 },
+  { "鼓", 0.00010000 },
+  { "鼠", 0.00010000 },
+  { "鼻", 0.00010000 },
+  { "齊", 0.00010000 },
+  { "齒", 0.00010000 },
+  { "龍", 0.00070000 },
+  { "龜", 0.00000000 },
+  { "丁", 0.00030000 },
+  { "七", 0.00050000 },
+  { "丈", 0.00010000 },
+  { "三", 0.00230000 },
+  { "上", 0.00460000 },
+  { "下", 0.00310000 },
+  { "丌", 0.00000000 },
+  { "不", 0.00430000 },
+  { "丑", 0.00000000 },
+  { "且", 0.00070000 },
+  { "世", 0.00220000 },
+  { "丘", 0.00010000 },
+  { "丙", 0.00010000 },
+  { "丟", 0.00000000 },
+  { "並", 0.00160000 },
+  { "中", 0.01020000 },
+  { "串", 0.00010000 },
+  { "丸", 0.00000000 },
+  { "丹", 0.00030000 },
+  { "主", 0.00360000 },
+  { "乃", 0.00010000 },
+  { "久", 0.00030000 },
+  { "么", 0.00010000 },
+  { "之", 0.00410000 },
+  { "乎", 0.00020000 },
+  { "乏", 0.00010000 },
+  { "乖", 0.00000000 },
+  { "乘", 0.00020000 },
+  { "九", 0.00060000 },
+  { "也", 0.00240000 },
+  { "乾", 0.00010000 },
+  { "亂", 0.00010000 },
+  { "了", 0.00540000 },
+  { "予", 0.00020000 },
+  { "事", 0.00200000 },
+  { "于", 0.00350000 },
+  { "云", 0.00020000 },
+  { "互", 0.00020000 },
+  { "五", 0.00090000 },
+  { "井", 0.00010000 },
+  { "些", 0.00110000 },
+  { "亞", 0.00120000 },
+  { "亡", 0.00030000 },
+  { "交", 0.00110000 },
+  { "亥", 0.00000000 },
+  { "亦", 0.00070000 },
+  { "亨", 0.00010000 },
+  { "享", 0.00010000 },
+  { "京", 0.00090000 },
+  { "亮", 0.00010000 },
+  { "什", 0.00020000 },
+  { "仁", 0.00020000 },
+  { "仇", 0.00000000 },
+  { "今", 0.00080000 },
+  { "介", 0.00020000 },
+  { "仍", 0.00050000 },
+  { "仔", 0.00010000 },
+  { "他", 0.00420000 },
+  { "付", 0.00010000 },
+  { "仙", 0.00010000 },
+  { "代", 0.00260000 },
+  { "令", 0.00060000 },
+  { "以", 0.00600000 },
+  { "仰", 0.00010000 },
+  { "仲", 0.00010000 },
+  { "件", 0.00080000 },
+  { "任", 0.00250000 },
+  { "份", 0.00060000 },
+  { "企", 0.00020000 },
+  { "伊", 0.00060000 },
+  { "伍", 0.00010000 },
+  { "伐", 0.00010000 },
+  { "休", 0.00020000 },
+  { "伙", 0.00000000 },
+  { "伯", 0.00050000 },
+  { "估", 0.00010000 },
+  { "伴", 0.00010000 },
+  { "伸", 0.00010000 },
+  { "似", 0.00030000 },
+  { "伽", 0.00000000 },
+  { "但", 0.00200000 },
+  { "佈", 0.00020000 },
+  { "佉", 0.00000000 },
+  { "位", 0.00330000 },
+  { "低", 0.00040000 },
+  { "住", 0.00040000 },
+  { "佔", 0.00020000 },
+  { "何", 0.00040000 },
+  { "余", 0.00020000 },
+  { "佛", 0.00040000 },
+  { "作", 0.00360000 },
+  { "你", 0.00010000 },
+  { "佩", 0.00010000 },
+  { "佳", 0.00030000 },
+  { "使", 0.00190000 },
+  { "來", 0.00170000 },
+  { "例", 0.00060000 },
+  { "供", 0.00060000 },
+  { "依", 0.00030000 },
+  { "侯", 0.00010000 },
+  { "侵", 0.00020000 },
+  { "便", 0.00050000 },
+  { "係", 0.00020000 },
+  { "促", 0.00010000 },
+  { "俄", 0.00040000 },
+  { "俊", 0.00010000 },
+  { "俗", 0.00010000 },
+  { "保", 0.00100000 },
+  { "俠", 0.00000000 },
+  { "信", 0.00080000 },
+  { "修", 0.00060000 },
+  { "俱", 0.00010000 },
+  { "俾", 0.00000000 },
+  { "個", 0.00260000 },
+  { "倍", 0.00010000 },
+  { "們", 0.00080000 },
+  { "倒", 0.00010000 },
+  { "候", 0.00030000 },
+  { "倚", 0.00000000 },
+  { "借", 0.00010000 },
+  { "倫", 0.00030000 },
+  { "值", 0.00040000 },
+  { "假", 0.00030000 },
+  { "偉", 0.00010000 },
+  { "偏", 0.00010000 },
+  { "做", 0.00040000 },
+  { "停", 0.00030000 },
+  { "健", 0.00010000 },
+  { "側", 0.00010000 },
+  { "偵", 0.00000000 },
+  { "偶", 0.00010000 },
+  { "偷", 0.00000000 },
+  { "傑", 0.00010000 },
+  { "備", 0.00030000 },
+  { "傢", 0.00000000 },
+  { "傣", 0.00000000 },
+  { "傲", 0.00000000 },
+  { "傳", 0.00060000 },
+  { "傷", 0.00020000 },
+  { "傻", 0.00000000 },
+  { "傾", 0.00000000 },
+  { "僅", 0.00020000 },
+  { "像", 0.00040000 },
+  { "僑", 0.00000000 },
+  { "僧", 0.00010000 },
+  { "價", 0.00020000 },
+  { "儀", 0.00010000 },
+  { "億", 0.00010000 },
+  { "儒", 0.00010000 },
+  { "儘", 0.00000000 },
+  { "優", 0.00020000 },
+  { "允", 0.00010000 },
+  { "元", 0.00140000 },
+  { "兄", 0.00010000 },
+  { "充", 0.00020000 },
+  { "兇", 0.00000000 },
+  { "先", 0.00080000 },
+  { "光", 0.00090000 },
+  { "克", 0.00210000 },
+  { "免", 0.00020000 },
+  { "兒", 0.00030000 },
+  { "兔", 0.00000000 },
+  { "內", 0.00110000 },
+  { "全", 0.00180000 },
+  { "兩", 0.00100000 },
+  { "公", 0.00430000 },
+  { "六", 0.00060000 },
+  { "兮", 0.00000000 },
+  { "共", 0.00160000 },
+  { "兵", 0.00070000 },
+  { "其", 0.00360000 },
+  { "具", 0.00060000 },
+  { "典", 0.00040000 },
+  { "兼", 0.00020000 },
+  { "冊", 0.00010000 },
+  { "再", 0.00070000 },
+  { "冒", 0.00000000 },
+  { "冠", 0.00040000 },
+  { "冬", 0.00010000 },
+  { "冰", 0.00010000 },
+  { "冷", 0.00010000 },
+  { "准", 0.00030000 },
+  { "凌", 0.00010000 },
+  { "凝", 0.00000000 },
+  { "凡", 0.00010000 },
+  { "凰", 0.00000000 },
+  { "凱", 0.00010000 },
+  { "出", 0.00420000 },
+  { "函", 0.00010000 },
+  { "分", 0.00360000 },
+  { "切", 0.00030000 },
+  { "刊", 0.00020000 },
+  { "列", 0.00120000 },
+  { "初", 0.00070000 },
+  { "判", 0.00030000 },
+  { "別", 0.00050000 },
+  { "利", 0.00230000 },
+  { "刪", 0.00000000 },
+  { "到", 0.00340000 },
+  { "制", 0.00130000 },
+  { "刷", 0.00000000 },
+  { "刺", 0.00020000 },
+  { "刻", 0.00020000 },
+  { "則", 0.00080000 },
+  { "剌", 0.00000000 },
+  { "前", 0.00250000 },
+  { "剛", 0.00010000 },
+  { "剩", 0.00010000 },
+  { "剪", 0.00000000 },
+  { "副", 0.00040000 },
+  { "割", 0.00010000 },
+  { "創", 0.00040000 },
+  { "劃", 0.00030000 },
+  { "劇", 0.00050000 },
+  { "劉", 0.00020000 },
+  { "劍", 0.00010000 },
+  { "功", 0.00060000 },
+  { "加", 0.00240000 },
+  { "助", 0.00050000 },
+  { "努", 0.00010000 },
+  { "劫", 0.00000000 },
+  { "勁", 0.00000000 },
+  { "勇", 0.00010000 },
+  { "勉", 0.00000000 },
+  { "勒", 0.00040000 },
+  { "動", 0.00150000 },
+  { "務", 0.00070000 },
+  { "勝", 0.00030000 },
+  { "勞", 0.00010000 },
+  { "勢", 0.00020000 },
+  { "勤", 0.00010000 },
+  { "勵", 0.00000000 },
+  { "勸", 0.00000000 },
+  { "勿", 0.00000000 },
+  { "包", 0.00110000 },
+  { "匈", 0.00010000 },
+  { "化", 0.00190000 },
+  { "北", 0.00240000 },
+  { "匹", 0.00010000 },
+  { "區", 0.00160000 },
+  { "千", 0.00040000 },
+  { "升", 0.00050000 },
+  { "午", 0.00010000 },
+  { "半", 0.00050000 },
+  { "卒", 0.00010000 },
+  { "卓", 0.00010000 },
+  { "協", 0.00030000 },
+  { "南", 0.00270000 },
+  { "博", 0.00050000 },
+  { "卡", 0.00090000 },
+  { "卯", 0.00000000 },
+  { "印", 0.00050000 },
+  { "危", 0.00010000 },
+  { "即", 0.00080000 },
+  { "卷", 0.00020000 },
+  { "卻", 0.00020000 },
+  { "厄", 0.00010000 },
+  { "厘", 0.00010000 },
+  { "厚", 0.00010000 },
+  { "原", 0.00160000 },
+  { "厭", 0.00000000 },
+  { "厲", 0.00000000 },
+  { "去", 0.00070000 },
+  { "參", 0.00060000 },
+  { "及", 0.00340000 },
+  { "友", 0.00030000 },
+  { "反", 0.00090000 },
+  { "叔", 0.00010000 },
+  { "取", 0.00090000 },
+  { "受", 0.00110000 },
+  { "古", 0.00100000 },
+  { "句", 0.00010000 },
+  { "另", 0.00060000 },
+  { "只", 0.00090000 },
+  { "叫", 0.00020000 },
+  { "召", 0.00020000 },
+  { "叭", 0.00000000 },
+  { "可", 0.00290000 },
+  { "台", 0.00210000 },
+  { "史", 0.00100000 },
+  { "右", 0.00030000 },
+  { "司", 0.00150000 },
+  { "吃", 0.00010000 },
+  { "各", 0.00090000 },
+  { "合", 0.00200000 },
+  { "吉", 0.00050000 },
+  { "吊", 0.00000000 },
+  { "同", 0.00280000 },
+  { "名", 0.00390000 },
+  { "后", 0.00230000 },
+  { "吐", 0.00010000 },
+  { "向", 0.00110000 },
+  { "吒", 0.00000000 },
+  { "君", 0.00020000 },
+  { "吝", 0.00000000 },
+  { "吞", 0.00000000 },
+  { "吟", 0.00000000 },
+  { "吠", 0.00000000 },
+  { "否", 0.00020000 },
+  { "吧", 0.00000000 },
+  { "含", 0.00030000 },
+  { "吳", 0.00010000 },
+  { "吵", 0.00000000 },
+  { "吸", 0.00020000 },
+  { "吹", 0.00000000 },
+  { "吾", 0.00000000 },
+  { "呀", 0.00000000 },
+  { "呂", 0.00000000 },
+  { "呆", 0.00000000 },
+  { "告", 0.00040000 },
+  { "呢", 0.00000000 },
+  { "周", 0.00050000 },
+  { "味", 0.00010000 },
+  { "呵", 0.00000000 },
+  { "呼", 0.00010000 },
+  { "命", 0.00090000 },
+  { "和", 0.00610000 },
+  { "咖", 0.00000000 },
+  { "咦", 0.00000000 },
+  { "咧", 0.00000000 },
+  { "咪", 0.00000000 },
+  { "咬", 0.00000000 },
+  { "咱", 0.00000000 },
+  { "哀", 0.00000000 },
+  { "品", 0.00100000 },
+  { "哇", 0.00000000 },
+  { "哈", 0.00050000 },
+  { "哉", 0.00000000 },
+  { "哎", 0.00000000 },
+  { "員", 0.00130000 },
+  { "哥", 0.00040000 },
+  { "哦", 0.00000000 },
+  { "哩", 0.00000000 },
+  { "哪", 0.00000000 },
+  { "哭", 0.00000000 },
+  { "哲", 0.00010000 },
+  { "唉", 0.00000000 },
+  { "唐", 0.00030000 },
+  { "唔", 0.00000000 },
+  { "唬", 0.00000000 },
+  { "售", 0.00030000 },
+  { "唯", 0.00020000 },
+  { "唱", 0.00040000 },
+  { "唷", 0.00000000 },
+  { "唸", 0.00000000 },
+  { "商", 0.00080000 },
+  { "啊", 0.00000000 },
+  { "問", 0.00030000 },
+  { "啟", 0.00010000 },
+  { "啡", 0.00000000 },
+  { "啥", 0.00000000 },
+  { "啦", 0.00000000 },
+  { "啪", 0.00000000 },
+  { "喀", 0.00010000 },
+  { "喂", 0.00000000 },
+  { "善", 0.00020000 },
+  { "喇", 0.00000000 },
+  { "喊", 0.00000000 },
+  { "喔", 0.00000000 },
+  { "喜", 0.00020000 },
+  { "喝", 0.00000000 },
+  { "喬", 0.00010000 },
+  { "單", 0.00060000 },
+  { "喵", 0.00000000 },
+  { "嗎", 0.00000000 },
+  { "嗚", 0.00000000 },
+  { "嗨", 0.00000000 },
+  { "嗯", 0.00000000 },
+  { "嘆", 0.00000000 },
+  { "嘉", 0.00030000 },
+  { "嘗", 0.00000000 },
+  { "嘛", 0.00000000 },
+  { "嘴", 0.00010000 },
+  { "嘻", 0.00000000 },
+  { "嘿", 0.00000000 },
+  { "器", 0.00080000 },
+  { "噴", 0.00000000 },
+  { "嚇", 0.00000000 },
+  { "嚴", 0.00010000 },
+  { "囉", 0.00000000 },
+  { "四", 0.00140000 },
+  { "回", 0.00080000 },
+  { "因", 0.00230000 },
+  { "困", 0.00010000 },
+  { "固", 0.00020000 },
+  { "圈", 0.00010000 },
+  { "國", 0.00480000 },
+  { "圍", 0.00030000 },
+  { "園", 0.00030000 },
+  { "圓", 0.00010000 },
+  { "圖", 0.00040000 },
+  { "團", 0.00070000 },
+  { "圜", 0.00000000 },
+  { "在", 0.01200000 },
+  { "圭", 0.00000000 },
+  { "地", 0.00470000 },
+  { "圾", 0.00000000 },
+  { "址", 0.00020000 },
+  { "均", 0.00050000 },
+  { "坎", 0.00010000 },
+  { "坐", 0.00020000 },
+  { "坡", 0.00020000 },
+  { "坤", 0.00000000 },
+  { "坦", 0.00030000 },
+  { "坪", 0.00010000 },
+  { "垂", 0.00010000 },
+  { "垃", 0.00000000 },
+  { "型", 0.00120000 },
+  { "埃", 0.00030000 },
+  { "城", 0.00150000 },
+  { "埔", 0.00010000 },
+  { "域", 0.00060000 },
+  { "執", 0.00020000 },
+  { "培", 0.00020000 },
+  { "基", 0.00150000 },
+  { "堂", 0.00050000 },
+  { "堅", 0.00010000 },
+  { "堆", 0.00000000 },
+  { "堡", 0.00030000 },
+  { "堪", 0.00000000 },
+  { "報", 0.00040000 },
+  { "場", 0.00120000 },
+  { "塊", 0.00010000 },
+  { "塔", 0.00050000 },
+  { "塗", 0.00000000 },
+  { "塞", 0.00040000 },
+  { "填", 0.00010000 },
+  { "塵", 0.00000000 },
+  { "境", 0.00050000 },
+  { "增", 0.00050000 },
+  { "墨", 0.00010000 },
+  { "墮", 0.00000000 },
+  { "壁", 0.00010000 },
+  { "壇", 0.00010000 },
+  { "壓", 0.00020000 },
+  { "壘", 0.00000000 },
+  { "壞", 0.00010000 },
+  { "壢", 0.00000000 },
+  { "壬", 0.00000000 },
+  { "壯", 0.00000000 },
+  { "壽", 0.00010000 },
+  { "夏", 0.00030000 },
+  { "外", 0.00200000 },
+  { "多", 0.00290000 },
+  { "夜", 0.00020000 },
+  { "夠", 0.00010000 },
+  { "夢", 0.00010000 },
+  { "夥", 0.00000000 },
+  { "天", 0.00190000 },
+  { "太", 0.00100000 },
+  { "夫", 0.00080000 },
+  { "央", 0.00040000 },
+  { "失", 0.00050000 },
+  { "夷", 0.00010000 },
+  { "夸", 0.00000000 },
+  { "夾", 0.00000000 },
+  { "奇", 0.00040000 },
+  { "奈", 0.00010000 },
+  { "奉", 0.00020000 },
+  { "奎", 0.00000000 },
+  { "奏", 0.00010000 },
+  { "契", 0.00010000 },
+  { "奔", 0.00000000 },
+  { "套", 0.00010000 },
+  { "奧", 0.00040000 },
+  { "奪", 0.00020000 },
+  { "奮", 0.00000000 },
+  { "奴", 0.00010000 },
+  { "奶", 0.00000000 },
+  { "她", 0.00070000 },
+  { "好", 0.00060000 },
+  { "如", 0.00140000 },
+  { "妙", 0.00000000 },
+  { "妝", 0.00000000 },
+  { "妥", 0.00000000 },
+  { "妨", 0.00000000 },
+  { "妮", 0.00010000 },
+  { "妳", 0.00000000 },
+  { "妹", 0.00010000 },
+  { "妻", 0.00010000 },
+  { "姆", 0.00040000 },
+  { "姊", 0.00000000 },
+  { "始", 0.00120000 },
+  { "姐", 0.00010000 },
+  { "姑", 0.00000000 },
+  { "姓", 0.00020000 },
+  { "委", 0.00090000 },
+  { "姿", 0.00000000 },
+  { "威", 0.00060000 },
+  { "娃", 0.00000000 },
+  { "娘", 0.00000000 },
+  { "娛", 0.00010000 },
+  { "婁", 0.00000000 },
+  { "婆", 0.00000000 },
+  { "婚", 0.00020000 },
+  { "婦", 0.00010000 },
+  { "媒", 0.00020000 },
+  { "媽", 0.00000000 },
+  { "嫌", 0.00000000 },
+  { "嫩", 0.00000000 },
+  { "孔", 0.00010000 },
+  { "字", 0.00100000 },
+  { "存", 0.00060000 },
+  { "孝", 0.00010000 },
+  { "孟", 0.00010000 },
+  { "季", 0.00060000 },
+  { "孤", 0.00010000 },
+  { "孩", 0.00010000 },
+  { "孫", 0.00010000 },
+  { "學", 0.00250000 },
+  { "它", 0.00100000 },
+  { "宅", 0.00010000 },
+  { "宇", 0.00020000 },
+  { "守", 0.00030000 },
+  { "安", 0.00150000 },
+  { "宋", 0.00030000 },
+  { "完", 0.00070000 },
+  { "宏", 0.00010000 },
+  { "宗", 0.00060000 },
+  { "官", 0.00090000 },
+  { "宙", 0.00010000 },
+  { "定", 0.00190000 },
+  { "宛", 0.00000000 },
+  { "宜", 0.00010000 },
+  { "客", 0.00060000 },
+  { "宣", 0.00050000 },
+  { "室", 0.00040000 },
+  { "宮", 0.00020000 },
+  { "害", 0.00020000 },
+  { "家", 0.00310000 },
+  { "容", 0.00050000 },
+  { "宿", 0.00010000 },
+  { "寂", 0.00000000 },
+  { "寄", 0.00010000 },
+  { "寅", 0.00000000 },
+  { "密", 0.00060000 },
+  { "富", 0.00030000 },
+  { "寒", 0.00010000 },
+  { "寞", 0.00000000 },
+  { "察", 0.00040000 },
+  { "寢", 0.00000000 },
+  { "實", 0.00060000 },
+  { "寧", 0.00010000 },
+  { "寨", 0.00000000 },
+  { "審", 0.00010000 },
+  { "寫", 0.00030000 },
+  { "寬", 0.00010000 },
+  { "寮", 0.00000000 },
+  { "寵", 0.00000000 },
+  { "寶", 0.00020000 },
+  { "封", 0.00030000 },
+  { "射", 0.00050000 },
+  { "將", 0.00120000 },
+  { "專", 0.00050000 },
+  { "尊", 0.00010000 },
+  { "尋", 0.00010000 },
+  { "對", 0.00140000 },
+  { "導", 0.00050000 },
+  { "少", 0.00090000 },
+  { "尖", 0.00010000 },
+  { "尚", 0.00030000 },
+  { "尤", 0.00020000 },
+  { "就", 0.00130000 },
+  { "尺", 0.00020000 },
+  { "尼", 0.00120000 },
+  { "尾", 0.00030000 },
+  { "局", 0.00070000 },
+  { "屁", 0.00000000 },
+  { "居", 0.00060000 },
+  { "屆", 0.00020000 },
+  { "屋", 0.00020000 },
+  { "屏", 0.00010000 },
+  { "展", 0.00090000 },
+  { "屠", 0.00000000 },
+  { "層", 0.00030000 },
+  { "屬", 0.00070000 },
+  { "岡", 0.00010000 },
+  { "岩", 0.00020000 },
+  { "岸", 0.00030000 },
+  { "峰", 0.00020000 },
+  { "島", 0.00060000 },
+  { "峽", 0.00000000 },
+  { "崇", 0.00010000 },
+  { "崙", 0.00000000 },
+  { "崴", 0.00000000 },
+  { "嵐", 0.00000000 },
+  { "嶺", 0.00000000 },
+  { "川", 0.00050000 },
+  { "州", 0.00170000 },
+  { "巡", 0.00020000 },
+  { "左", 0.00030000 },
+  { "巧", 0.00010000 },
+  { "巨", 0.00020000 },
+  { "巫", 0.00000000 },
+  { "差", 0.00020000 },
+  { "已", 0.00110000 },
+  { "巳", 0.00000000 },
+  { "巴", 0.00130000 },
+  { "巷", 0.00000000 },
+  { "市", 0.00270000 },
+  { "布", 0.00140000 },
+  { "希", 0.00060000 },
+  { "帕", 0.00020000 },
+  { "帖", 0.00000000 },
+  { "帛", 0.00000000 },
+  { "帝", 0.00070000 },
+  { "帥", 0.00000000 },
+  { "師", 0.00050000 },
+  { "席", 0.00040000 },
+  { "帳", 0.00000000 },
+  { "帶", 0.00050000 },
+  { "常", 0.00130000 },
+  { "帽", 0.00000000 },
+  { "幅", 0.00010000 },
+  { "幕", 0.00020000 },
+  { "幣", 0.00010000 },
+  { "幫", 0.00010000 },
+  { "平", 0.00210000 },
+  { "年", 0.01620000 },
+  { "幸", 0.00010000 },
+  { "幹", 0.00010000 },
+  { "幻", 0.00010000 },
+  { "幼", 0.00010000 },
+  { "幽", 0.00000000 },
+  { "幾", 0.00020000 },
+  { "庇", 0.00000000 },
+  { "床", 0.00010000 },
+  { "序", 0.00030000 },
+  { "底", 0.00040000 },
+  { "店", 0.00030000 },
+  { "庚", 0.00000000 },
+  { "府", 0.00140000 },
+  { "度", 0.00200000 },
+  { "座", 0.00070000 },
+  { "庫", 0.00020000 },
+  { "庭", 0.00020000 },
+  { "康", 0.00040000 },
+  { "庸", 0.00000000 },
+  { "廉", 0.00010000 },
+  { "廖", 0.00000000 },
+  { "廠", 0.00020000 },
+  { "廢", 0.00010000 },
+  { "廣", 0.00060000 },
+  { "廳", 0.00010000 },
+  { "延", 0.00030000 },
+  { "廷", 0.00020000 },
+  { "建", 0.00230000 },
+  { "弄", 0.00000000 },
+  { "式", 0.00180000 },
+  { "引", 0.00070000 },
+  { "弗", 0.00020000 },
+  { "弘", 0.00010000 },
+  { "弟", 0.00030000 },
+  { "弦", 0.00000000 },
+  { "弱", 0.00010000 },
+  { "張", 0.00050000 },
+  { "強", 0.00040000 },
+  { "彈", 0.00030000 },
+  { "彊", 0.00000000 },
+  { "彌", 0.00000000 },
+  { "彎", 0.00000000 },
+  { "彝", 0.00000000 },
+  { "彞", 0.00000000 },
+  { "形", 0.00110000 },
+  { "彥", 0.00000000 },
+  { "彩", 0.00010000 },
+  { "彬", 0.00000000 },
+  { "彭", 0.00010000 },
+  { "彰", 0.00000000 },
+  { "影", 0.00120000 },
+  { "役", 0.00030000 },
+  { "彼", 0.00010000 },
+  { "往", 0.00070000 },
+  { "征", 0.00020000 },
+  { "待", 0.00010000 },
+  { "很", 0.00070000 },
+  { "律", 0.00040000 },
+  { "後", 0.00320000 },
+  { "徐", 0.00010000 },
+  { "徑", 0.00010000 },
+  { "徒", 0.00020000 },
+  { "得", 0.00220000 },
+  { "從", 0.00070000 },
+  { "復", 0.00020000 },
+  { "微", 0.00030000 },
+  { "徵", 0.00010000 },
+  { "德", 0.00220000 },
+  { "徹", 0.00000000 },
+  { "必", 0.00030000 },
+  { "忌", 0.00000000 },
+  { "忍", 0.00000000 },
+  { "志", 0.00040000 },
+  { "忘", 0.00000000 },
+  { "忙", 0.00000000 },
+  { "忠", 0.00010000 },
+  { "快", 0.00030000 },
+  { "念", 0.00040000 },
+  { "忽", 0.00000000 },
+  { "怎", 0.00000000 },
+  { "怒", 0.00000000 },
+  { "怕", 0.00000000 },
+  { "怖", 0.00000000 },
+  { "思", 0.00040000 },
+  { "怡", 0.00000000 },
+  { "急", 0.00010000 },
+  { "性", 0.00160000 },
+  { "怨", 0.00000000 },
+  { "怪", 0.00010000 },
+  { "恆", 0.00010000 },
+  { "恐", 0.00010000 },
+  { "恢", 0.00010000 },
+  { "恥", 0.00000000 },
+  { "恨", 0.00000000 },
+  { "恩", 0.00030000 },
+  { "恭", 0.00000000 },
+  { "息", 0.00040000 },
+  { "恰", 0.00000000 },
+  { "悅", 0.00000000 },
+  { "悉", 0.00010000 },
+  { "悔", 0.00000000 },
+  { "悟", 0.00000000 },
+  { "悠", 0.00000000 },
+  { "您", 0.00000000 },
+  { "悲", 0.00000000 },
+  { "悶", 0.00000000 },
+  { "情", 0.00070000 },
+  { "惑", 0.00000000 },
+  { "惜", 0.00000000 },
+  { "惠", 0.00010000 },
+  { "惡", 0.00010000 },
+  { "惱", 0.00000000 },
+  { "想", 0.00040000 },
+  { "惹", 0.00000000 },
+  { "愁", 0.00000000 },
+  { "愈", 0.00000000 },
+  { "愉", 0.00000000 },
+  { "意", 0.00120000 },
+  { "愚", 0.00000000 },
+  { "愛", 0.00040000 },
+  { "感", 0.00040000 },
+  { "慈", 0.00010000 },
+  { "態", 0.00020000 },
+  { "慕", 0.00010000 },
+  { "慘", 0.00000000 },
+  { "慢", 0.00010000 },
+  { "慣", 0.00000000 },
+  { "慧", 0.00010000 },
+  { "慮", 0.00000000 },
+  { "慰", 0.00000000 },
+  { "慶", 0.00010000 },
+  { "慾", 0.00000000 },
+  { "憂", 0.00000000 },
+  { "憐", 0.00000000 },
+  { "憑", 0.00000000 },
+  { "憲", 0.00010000 },
+  { "憶", 0.00010000 },
+  { "憾", 0.00000000 },
+  { "懂", 0.00000000 },
+  { "應", 0.00050000 },
+  { "懶", 0.00000000 },
+  { "懷", 0.00010000 },
+  { "懼", 0.00000000 },
+  { "戀", 0.00010000 },
+  { "戊", 0.00000000 },
+  { "戌", 0.00000000 },
+  { "成", 0.00490000 },
+  { "我", 0.00050000 },
+  { "戒", 0.00010000 },
+  { "或", 0.00140000 },
+  { "截", 0.00010000 },
+  { "戰", 0.00140000 },
+  { "戲", 0.00040000 },
+  { "戴", 0.00010000 },
+  { "房", 0.00030000 },
+  { "所", 0.00250000 },
+  { "扁", 0.00000000 },
+  { "扇", 0.00000000 },
+  { "才", 0.00050000 },
+  { "扎", 0.00010000 },
+  { "打", 0.00060000 },
+  { "托", 0.00040000 },
+  { "扣", 0.00000000 },
+  { "扥", 0.00000000 },
+  { "扭", 0.00000000 },
+  { "扯", 0.00000000 },
+  { "批", 0.00030000 },
+  { "找", 0.00020000 },
+  { "承", 0.00040000 },
+  { "技", 0.00050000 },
+  { "抄", 0.00000000 },
+  { "把", 0.00040000 },
+  { "抓", 0.00000000 },
+  { "投", 0.00060000 },
+  { "抗", 0.00030000 },
+  { "折", 0.00010000 },
+  { "披", 0.00000000 },
+  { "抬", 0.00000000 },
+  { "抱", 0.00000000 },
+  { "抵", 0.00020000 },
+  { "抹", 0.00000000 },
+  { "抽", 0.00010000 },
+  { "拆", 0.00010000 },
+  { "拉", 0.00180000 },
+  { "拋", 0.00000000 },
+  { "拍", 0.00020000 },
+  { "拏", 0.00000000 },
+  { "拒", 0.00010000 },
+  { "拔", 0.00030000 },
+  { "拖", 0.00000000 },
+  { "招", 0.00010000 },
+  { "拜", 0.00020000 },
+  { "括", 0.00080000 },
+  { "拳", 0.00010000 },
+  { "拼", 0.00010000 },
+  { "拾", 0.00000000 },
+  { "拿", 0.00030000 },
+  { "持", 0.00090000 },
+  { "指", 0.00110000 },
+  { "按", 0.00020000 },
+  { "挑", 0.00010000 },
+  { "挖", 0.00000000 },
+  { "挪", 0.00010000 },
+  { "振", 0.00010000 },
+  { "挺", 0.00000000 },
+  { "捐", 0.00010000 },
+  { "捕", 0.00020000 },
+  { "捨", 0.00000000 },
+  { "捲", 0.00000000 },
+  { "捷", 0.00010000 },
+  { "掃", 0.00000000 },
+  { "授", 0.00040000 },
+  { "掉", 0.00010000 },
+  { "掌", 0.00010000 },
+  { "排", 0.00040000 },
+  { "掛", 0.00000000 },
+  { "採", 0.00020000 },
+  { "探", 0.00020000 },
+  { "接", 0.00120000 },
+  { "控", 0.00040000 },
+  { "推", 0.00060000 },
+  { "措", 0.00010000 },
+  { "描", 0.00020000 },
+  { "提", 0.00130000 },
+  { "插", 0.00010000 },
+  { "揚", 0.00010000 },
+  { "換", 0.00020000 },
+  { "握", 0.00010000 },
+  { "揮", 0.00010000 },
+  { "援", 0.00020000 },
+  { "損", 0.00010000 },
+  { "搖", 0.00000000 },
+  { "搜", 0.00010000 },
+  { "搞", 0.00000000 },
+  { "搬", 0.00010000 },
+  { "搭", 0.00010000 },
+  { "搶", 0.00000000 },
+  { "摘", 0.00000000 },
+  { "摩", 0.00030000 },
+  { "摸", 0.00000000 },
+  { "撐", 0.00000000 },
+  { "撒", 0.00010000 },
+  { "撞", 0.00010000 },
+  { "撣", 0.00000000 },
+  { "撥", 0.00000000 },
+  { "播", 0.00060000 },
+  { "撾", 0.00000000 },
+  { "撿", 0.00000000 },
+  { "擁", 0.00020000 },
+  { "擇", 0.00010000 },
+  { "擊", 0.00060000 },
+  { "擋", 0.00000000 },
+  { "操", 0.00020000 },
+  { "擎", 0.00010000 },
+  { "擔", 0.00030000 },
+  { "據", 0.00040000 },
+  { "擠", 0.00000000 },
+  { "擦", 0.00000000 },
+  { "擬", 0.00010000 },
+  { "擴", 0.00010000 },
+  { "擺", 0.00000000 },
+  { "擾", 0.00000000 },
+  { "攝", 0.00010000 },
+  { "收", 0.00070000 },
+  { "改", 0.00130000 },
+  { "攻", 0.00060000 },
+  { "放", 0.00080000 },
+  { "政", 0.00290000 },
+  { "故", 0.00050000 },
+  { "效", 0.00040000 },
+  { "敍", 0.00000000 },
+  { "敏", 0.00010000 },
+  { "救", 0.00020000 },
+  { "敗", 0.00030000 },
+  { "敘", 0.00000000 },
+  { "教", 0.00210000 },
+  { "敝", 0.00000000 },
+  { "敢", 0.00000000 },
+  { "散", 0.00020000 },
+  { "敦", 0.00020000 },
+  { "敬", 0.00010000 },
+  { "整", 0.00050000 },
+  { "敵", 0.00010000 },
+  { "數", 0.00100000 },
+  { "斐", 0.00000000 },
+  { "料", 0.00040000 },
+  { "斯", 0.00370000 },
+  { "新", 0.00250000 },
+  { "斷", 0.00020000 },
+  { "於", 0.00490000 },
+  { "施", 0.00040000 },
+  { "旁", 0.00010000 },
+  { "旅", 0.00030000 },
+  { "旋", 0.00020000 },
+  { "族", 0.00080000 },
+  { "旗", 0.00030000 },
+  { "既", 0.00010000 },
+  { "旦", 0.00010000 },
+  { "早", 0.00060000 },
+  { "旭", 0.00000000 },
+  { "旺", 0.00010000 },
+  { "昂", 0.00010000 },
+  { "昆", 0.00010000 },
+  { "昇", 0.00000000 },
+  { "昌", 0.00020000 },
+  { "明", 0.00140000 },
+  { "昏", 0.00000000 },
+  { "易", 0.00050000 },
+  { "星", 0.00140000 },
+  { "映", 0.00020000 },
+  { "春", 0.00030000 },
+  { "昨", 0.00000000 },
+  { "昭", 0.00010000 },
+  { "是", 0.01120000 },
+  { "時", 0.00320000 },
+  { "晉", 0.00010000 },
+  { "晒", 0.00000000 },
+  { "晚", 0.00030000 },
+  { "晨", 0.00010000 },
+  { "普", 0.00070000 },
+  { "景", 0.00040000 },
+  { "晴", 0.00000000 },
+  { "晶", 0.00010000 },
+  { "智", 0.00020000 },
+  { "暑", 0.00000000 },
+  { "暖", 0.00000000 },
+  { "暗", 0.00010000 },
+  { "暫", 0.00010000 },
+  { "暴", 0.00020000 },
+  { "曆", 0.00010000 },
+  { "曉", 0.00000000 },
+  { "曲", 0.00080000 },
+  { "更", 0.00100000 },
+  { "書", 0.00060000 },
+  { "曼", 0.00040000 },
+  { "曾", 0.00110000 },
+  { "替", 0.00020000 },
+  { "最", 0.00260000 },
+  { "會", 0.00280000 },
+  { "有", 0.00790000 },
+  { "朋", 0.00010000 },
+  { "服", 0.00060000 },
+  { "朗", 0.00030000 },
+  { "望", 0.00030000 },
+  { "朝", 0.00090000 },
+  { "期", 0.00200000 },
+  { "未", 0.00070000 },
+  { "末", 0.00030000 },
+  { "本", 0.00310000 },
+  { "札", 0.00000000 },
+  { "朱", 0.00020000 },
+  { "朵", 0.00000000 },
+  { "杉", 0.00010000 },
+  { "李", 0.00060000 },
+  { "材", 0.00020000 },
+  { "村", 0.00060000 },
+  { "杜", 0.00020000 },
+  { "束", 0.00030000 },
+  { "杯", 0.00010000 },
+  { "杰", 0.00010000 },
+  { "東", 0.00120000 },
+  { "松", 0.00020000 },
+  { "板", 0.00020000 },
+  { "析", 0.00010000 },
+  { "林", 0.00120000 },
+  { "果", 0.00070000 },
+  { "枝", 0.00010000 },
+  { "架", 0.00030000 },
+  { "柏", 0.00020000 },
+  { "某", 0.00020000 },
+  { "染", 0.00010000 },
+  { "柔", 0.00010000 },
+  { "查", 0.00050000 },
+  { "柬", 0.00000000 },
+  { "柯", 0.00010000 },
+  { "柳", 0.00010000 },
+  { "柴", 0.00010000 },
+  { "校", 0.00100000 },
+  { "核", 0.00030000 },
+  { "根", 0.00070000 },
+  { "格", 0.00130000 },
+  { "桃", 0.00010000 },
+  { "案", 0.00050000 },
+  { "桌", 0.00000000 },
+  { "桑", 0.00010000 },
+  { "梁", 0.00020000 },
+  { "梅", 0.00030000 },
+  { "條", 0.00050000 },
+  { "梨", 0.00000000 },
+  { "梯", 0.00010000 },
+  { "械", 0.00010000 },
+  { "梵", 0.00000000 },
+  { "棄", 0.00010000 },
+  { "棉", 0.00000000 },
+  { "棋", 0.00010000 },
+  { "棒", 0.00010000 },
+  { "棚", 0.00000000 },
+  { "森", 0.00040000 },
+  { "椅", 0.00000000 },
+  { "植", 0.00040000 },
+  { "椰", 0.00000000 },
+  { "楊", 0.00010000 },
+  { "楓", 0.00000000 },
+  { "楚", 0.00010000 },
+  { "業", 0.00100000 },
+  { "極", 0.00030000 },
+  { "概", 0.00020000 },
+  { "榜", 0.00010000 },
+  { "榮", 0.00010000 },
+  { "構", 0.00030000 },
+  { "槍", 0.00020000 },
+  { "樂", 0.00070000 },
+  { "樓", 0.00020000 },
+  { "標", 0.00050000 },
+  { "樞", 0.00000000 },
+  { "模", 0.00050000 },
+  { "樣", 0.00030000 },
+  { "樹", 0.00010000 },
+  { "橋", 0.00020000 },
+  { "機", 0.00130000 },
+  { "橫", 0.00010000 },
+  { "檀", 0.00000000 },
+  { "檔", 0.00010000 },
+  { "檢", 0.00010000 },
+  { "欄", 0.00000000 },
+  { "權", 0.00040000 },
+  { "次", 0.00190000 },
+  { "欣", 0.00000000 },
+  { "欲", 0.00010000 },
+  { "欺", 0.00000000 },
+  { "欽", 0.00000000 },
+  { "款", 0.00020000 },
+  { "歉", 0.00000000 },
+  { "歌", 0.00070000 },
+  { "歐", 0.00040000 },
+  { "歡", 0.00010000 },
+  { "正", 0.00140000 },
+  { "此", 0.00220000 },
+  { "步", 0.00040000 },
+  { "武", 0.00070000 },
+  { "歲", 0.00030000 },
+  { "歷", 0.00040000 },
+  { "歸", 0.00010000 },
+  { "死", 0.00060000 },
+  { "殊", 0.00010000 },
+  { "殘", 0.00010000 },
+  { "段", 0.00060000 },
+  { "殺", 0.00030000 },
+  { "殼", 0.00000000 },
+  { "毀", 0.00010000 },
+  { "毅", 0.00000000 },
+  { "母", 0.00050000 },
+  { "每", 0.00070000 },
+  { "毒", 0.00020000 },
+  { "毫", 0.00010000 },
+  { "民", 0.00270000 },
+  { "氣", 0.00040000 },
+  { "永", 0.00030000 },
+  { "求", 0.00050000 },
+  { "汗", 0.00010000 },
+  { "汝", 0.00000000 },
+  { "江", 0.00100000 },
+  { "池", 0.00010000 },
+  { "污", 0.00010000 },
+  { "汪", 0.00000000 },
+  { "汶", 0.00000000 },
+  { "決", 0.00040000 },
+  { "汽", 0.00020000 },
+  { "沃", 0.00020000 },
+  { "沈", 0.00010000 },
+  { "沉", 0.00010000 },
+  { "沒", 0.00050000 },
+  { "沖", 0.00000000 },
+  { "沙", 0.00050000 },
+  { "河", 0.00110000 },
+  { "油", 0.00030000 },
+  { "治", 0.00130000 },
+  { "沿", 0.00020000 },
+  { "況", 0.00020000 },
+  { "泉", 0.00010000 },
+  { "泊", 0.00010000 },
+  { "法", 0.00280000 },
+  { "泡", 0.00000000 },
+  { "波", 0.00080000 },
+  { "泥", 0.00010000 },
+  { "注", 0.00030000 },
+  { "泰", 0.00040000 },
+  { "泳", 0.00010000 },
+  { "洋", 0.00040000 },
+  { "洗", 0.00010000 },
+  { "洛", 0.00050000 },
+  { "洞", 0.00010000 },
+  { "洩", 0.00000000 },
+  { "洪", 0.00020000 },
+  { "洲", 0.00090000 },
+  { "活", 0.00080000 },
+  { "洽", 0.00000000 },
+  { "派", 0.00060000 },
+  { "流", 0.00110000 },
+  { "浦", 0.00010000 },
+  { "浩", 0.00010000 },
+  { "浪", 0.00010000 },
+  { "浮", 0.00010000 },
+  { "海", 0.00240000 },
+  { "涇", 0.00000000 },
+  { "消", 0.00040000 },
+  { "涉", 0.00010000 },
+  { "涯", 0.00010000 },
+  { "液", 0.00010000 },
+  { "涵", 0.00000000 },
+  { "涼", 0.00000000 },
+  { "淑", 0.00000000 },
+  { "淚", 0.00000000 },
+  { "淡", 0.00010000 },
+  { "淨", 0.00000000 },
+  { "深", 0.00050000 },
+  { "混", 0.00020000 },
+  { "淺", 0.00000000 },
+  { "清", 0.00080000 },
+  { "減", 0.00010000 },
+  { "渡", 0.00010000 },
+  { "測", 0.00020000 },
+  { "港", 0.00160000 },
+  { "游", 0.00040000 },
+  { "湖", 0.00060000 },
+  { "湯", 0.00010000 },
+  { "源", 0.00060000 },
+  { "準", 0.00020000 },
+  { "溝", 0.00000000 },
+  { "溪", 0.00020000 },
+  { "溫", 0.00020000 },
+  { "滄", 0.00000000 },
+  { "滅", 0.00010000 },
+  { "滋", 0.00000000 },
+  { "滑", 0.00010000 },
+  { "滴", 0.00000000 },
+  { "滾", 0.00000000 },
+  { "滿", 0.00020000 },
+  { "漂", 0.00000000 },
+  { "漏", 0.00000000 },
+  { "演", 0.00110000 },
+  { "漠", 0.00000000 },
+  { "漢", 0.00030000 },
+  { "漫", 0.00020000 },
+  { "漲", 0.00000000 },
+  { "漸", 0.00010000 },
+  { "潔", 0.00000000 },
+  { "潘", 0.00010000 },
+  { "潛", 0.00010000 },
+  { "潮", 0.00020000 },
+  { "澤", 0.00010000 },
+  { "澳", 0.00040000 },
+  { "激", 0.00020000 },
+  { "濃", 0.00000000 },
+  { "濟", 0.00020000 },
+  { "濤", 0.00000000 },
+  { "濫", 0.00000000 },
+  { "濱", 0.00010000 },
+  { "瀏", 0.00000000 },
+  { "灌", 0.00010000 },
+  { "灣", 0.00100000 },
+  { "灰", 0.00010000 },
+  { "災", 0.00010000 },
+  { "炎", 0.00010000 },
+  { "炮", 0.00010000 },
+  { "炸", 0.00020000 },
+  { "為", 0.00640000 },
+  { "烈", 0.00020000 },
+  { "烏", 0.00010000 },
+  { "烤", 0.00000000 },
+  { "無", 0.00070000 },
+  { "焦", 0.00010000 },
+  { "然", 0.00120000 },
+  { "煙", 0.00010000 },
+  { "煞", 0.00000000 },
+  { "照", 0.00030000 },
+  { "煩", 0.00000000 },
+  { "熊", 0.00010000 },
+  { "熟", 0.00010000 },
+  { "熱", 0.00030000 },
+  { "燃", 0.00010000 },
+  { "燈", 0.00010000 },
+  { "燒", 0.00010000 },
+  { "營", 0.00030000 },
+  { "爆", 0.00020000 },
+  { "爐", 0.00000000 },
+  { "爛", 0.00000000 },
+  { "爬", 0.00000000 },
+  { "爭", 0.00040000 },
+  { "爵", 0.00020000 },
+  { "爸", 0.00000000 },
+  { "爺", 0.00000000 },
+  { "爽", 0.00000000 },
+  { "爾", 0.00130000 },
+  { "牆", 0.00000000 },
+  { "版", 0.00090000 },
+  { "牌", 0.00030000 },
+  { "牠", 0.00010000 },
+  { "牧", 0.00010000 },
+  { "物", 0.00230000 },
+  { "牲", 0.00000000 },
+  { "特", 0.00250000 },
+  { "牽", 0.00000000 },
+  { "犧", 0.00000000 },
+  { "犯", 0.00010000 },
+  { "狀", 0.00020000 },
+  { "狂", 0.00000000 },
+  { "狐", 0.00000000 },
+  { "狗", 0.00010000 },
+  { "狠", 0.00000000 },
+  { "狼", 0.00000000 },
+  { "猛", 0.00000000 },
+  { "猜", 0.00000000 },
+  { "猴", 0.00000000 },
+  { "猶", 0.00010000 },
+  { "獄", 0.00010000 },
+  { "獅", 0.00000000 },
+  { "獎", 0.00040000 },
+  { "獨", 0.00030000 },
+  { "獲", 0.00050000 },
+  { "獸", 0.00010000 },
+  { "獻", 0.00010000 },
+  { "率", 0.00060000 },
+  { "王", 0.00150000 },
+  { "玩", 0.00020000 },
+  { "玫", 0.00000000 },
+  { "玲", 0.00000000 },
+  { "玻", 0.00010000 },
+  { "珊", 0.00010000 },
+  { "珍", 0.00010000 },
+  { "珠", 0.00010000 },
+  { "珥", 0.00000000 },
+  { "班", 0.00050000 },
+  { "現", 0.00140000 },
+  { "球", 0.00210000 },
+  { "理", 0.00200000 },
+  { "琉", 0.00010000 },
+  { "琪", 0.00000000 },
+  { "琴", 0.00010000 },
+  { "瑙", 0.00000000 },
+  { "瑜", 0.00000000 },
+  { "瑞", 0.00030000 },
+  { "瑟", 0.00010000 },
+  { "瑤", 0.00000000 },
+  { "瑪", 0.00010000 },
+  { "瑰", 0.00000000 },
+  { "環", 0.00030000 },
+  { "瓶", 0.00000000 },
+  { "甚", 0.00030000 },
+  { "甜", 0.00000000 },
+  { "產", 0.00060000 },
+  { "由", 0.00330000 },
+  { "甲", 0.00040000 },
+  { "申", 0.00010000 },
+  { "男", 0.00040000 },
+  { "甸", 0.00010000 },
+  { "界", 0.00130000 },
+  { "留", 0.00040000 },
+  { "畢", 0.00020000 },
+  { "略", 0.00020000 },
+  { "番", 0.00010000 },
+  { "畫", 0.00050000 },
+  { "異", 0.00020000 },
+  { "當", 0.00140000 },
+  { "疆", 0.00010000 },
+  { "疏", 0.00010000 },
+  { "疑", 0.00010000 },
+  { "疼", 0.00000000 },
+  { "病", 0.00040000 },
+  { "痕", 0.00000000 },
+  { "痛", 0.00010000 },
+  { "痴", 0.00000000 },
+  { "瘋", 0.00000000 },
+  { "療", 0.00010000 },
+  { "癡", 0.00000000 },
+  { "癸", 0.00000000 },
+  { "登", 0.00040000 },
+  { "發", 0.00210000 },
+  { "百", 0.00050000 },
+  { "的", 0.03830000 },
+  { "皆", 0.00020000 },
+  { "皇", 0.00060000 },
+  { "盃", 0.00010000 },
+  { "益", 0.00020000 },
+  { "盛", 0.00020000 },
+  { "盜", 0.00000000 },
+  { "盟", 0.00050000 },
+  { "盡", 0.00010000 },
+  { "監", 0.00020000 },
+  { "盤", 0.00010000 },
+  { "盧", 0.00010000 },
+  { "盲", 0.00000000 },
+  { "直", 0.00110000 },
+  { "相", 0.00160000 },
+  { "盼", 0.00000000 },
+  { "盾", 0.00010000 },
+  { "省", 0.00130000 },
+  { "眉", 0.00000000 },
+  { "看", 0.00040000 },
+  { "真", 0.00040000 },
+  { "眠", 0.00000000 },
+  { "眼", 0.00020000 },
+  { "眾", 0.00030000 },
+  { "睛", 0.00000000 },
+  { "睡", 0.00000000 },
+  { "督", 0.00040000 },
+  { "瞧", 0.00000000 },
+  { "瞭", 0.00000000 },
+  { "矣", 0.00000000 },
+  { "知", 0.00070000 },
+  { "短", 0.00030000 },
+  { "砂", 0.00000000 },
+  { "砍", 0.00000000 },
+  { "研", 0.00080000 },
+  { "砲", 0.00010000 },
+  { "破", 0.00030000 },
+  { "硬", 0.00010000 },
+  { "碎", 0.00010000 },
+  { "碗", 0.00000000 },
+  { "碟", 0.00010000 },
+  { "碧", 0.00000000 },
+  { "碩", 0.00000000 },
+  { "碰", 0.00000000 },
+  { "確", 0.00020000 },
+  { "碼", 0.00020000 },
+  { "磁", 0.00010000 },
+  { "磨", 0.00000000 },
+  { "磯", 0.00000000 },
+  { "礎", 0.00010000 },
+  { "礙", 0.00000000 },
+  { "社", 0.00090000 },
+  { "祕", 0.00000000 },
+  { "祖", 0.00030000 },
+  { "祚", 0.00000000 },
+  { "祛", 0.00000000 },
+  { "祝", 0.00010000 },
+  { "神", 0.00080000 },
+  { "祥", 0.00010000 },
+  { "票", 0.00030000 },
+  { "祿", 0.00000000 },
+  { "禁", 0.00020000 },
+  { "禍", 0.00000000 },
+  { "禎", 0.00000000 },
+  { "福", 0.00060000 },
+  { "禪", 0.00000000 },
+  { "禮", 0.00020000 },
+  { "秀", 0.00020000 },
+  { "私", 0.00020000 },
+  { "秋", 0.00020000 },
+  { "科", 0.00170000 },
+  { "秒", 0.00010000 },
+  { "秘", 0.00020000 },
+  { "租", 0.00010000 },
+  { "秤", 0.00000000 },
+  { "秦", 0.00010000 },
+  { "移", 0.00040000 },
+  { "稅", 0.00010000 },
+  { "程", 0.00110000 },
+  { "稍", 0.00010000 },
+  { "種", 0.00100000 },
+  { "稱", 0.00110000 },
+  { "稿", 0.00010000 },
+  { "穆", 0.00020000 },
+  { "穌", 0.00000000 },
+  { "積", 0.00040000 },
+  { "穩", 0.00010000 },
+  { "究", 0.00070000 },
+  { "穹", 0.00000000 },
+  { "空", 0.00100000 },
+  { "穿", 0.00020000 },
+  { "突", 0.00030000 },
+  { "窗", 0.00010000 },
+  { "窩", 0.00000000 },
+  { "窮", 0.00000000 },
+  { "窶", 0.00000000 },
+  { "站", 0.00130000 },
+  { "竟", 0.00000000 },
+  { "章", 0.00030000 },
+  { "童", 0.00020000 },
+  { "端", 0.00030000 },
+  { "競", 0.00010000 },
+  { "笑", 0.00010000 },
+  { "笛", 0.00000000 },
+  { "符", 0.00020000 },
+  { "笨", 0.00000000 },
+  { "第", 0.00320000 },
+  { "筆", 0.00010000 },
+  { "等", 0.00250000 },
+  { "筋", 0.00000000 },
+  { "答", 0.00010000 },
+  { "策", 0.00030000 },
+  { "算", 0.00040000 },
+  { "管", 0.00090000 },
+  { "箭", 0.00010000 },
+  { "箱", 0.00010000 },
+  { "節", 0.00050000 },
+  { "範", 0.00020000 },
+  { "篇", 0.00020000 },
+  { "築", 0.00020000 },
+  { "簡", 0.00020000 },
+  { "簫", 0.00000000 },
+  { "簽", 0.00010000 },
+  { "簿", 0.00000000 },
+  { "籃", 0.00000000 },
+  { "籌", 0.00010000 },
+  { "籍", 0.00020000 },
+  { "籤", 0.00000000 },
+  { "粉", 0.00010000 },
+  { "粗", 0.00010000 },
+  { "粵", 0.00010000 },
+  { "精", 0.00040000 },
+  { "糊", 0.00000000 },
+  { "糕", 0.00000000 },
+  { "糟", 0.00000000 },
+  { "系", 0.00150000 },
+  { "糾", 0.00000000 },
+  { "紀", 0.00050000 },
+  { "約", 0.00090000 },
+  { "紅", 0.00030000 },
+  { "納", 0.00040000 },
+  { "紐", 0.00010000 },
+  { "純", 0.00010000 },
+  { "紙", 0.00010000 },
+  { "級", 0.00050000 },
+  { "紛", 0.00010000 },
+  { "素", 0.00040000 },
+  { "索", 0.00030000 },
+  { "紫", 0.00010000 },
+  { "累", 0.00010000 },
+  { "細", 0.00020000 },
+  { "紹", 0.00010000 },
+  { "終", 0.00030000 },
+  { "組", 0.00080000 },
+  { "結", 0.00060000 },
+  { "絕", 0.00020000 },
+  { "絡", 0.00010000 },
+  { "給", 0.00030000 },
+  { "統", 0.00080000 },
+  { "絲", 0.00010000 },
+  { "經", 0.00140000 },
+  { "綜", 0.00010000 },
+  { "綠", 0.00010000 },
+  { "維", 0.00050000 },
+  { "綱", 0.00010000 },
+  { "網", 0.00040000 },
+  { "緊", 0.00010000 },
+  { "緒", 0.00010000 },
+  { "線", 0.00100000 },
+  { "緣", 0.00010000 },
+  { "編", 0.00040000 },
+  { "緩", 0.00000000 },
+  { "緬", 0.00000000 },
+  { "緯", 0.00020000 },
+  { "練", 0.00020000 },
+  { "縛", 0.00000000 },
+  { "縣", 0.00070000 },
+  { "縮", 0.00010000 },
+  { "縱", 0.00000000 },
+  { "總", 0.00080000 },
+  { "績", 0.00010000 },
+  { "繁", 0.00010000 },
+  { "繆", 0.00000000 },
+  { "織", 0.00020000 },
+  { "繞", 0.00010000 },
+  { "繪", 0.00010000 },
+  { "繳", 0.00000000 },
+  { "繼", 0.00030000 },
+  { "續", 0.00040000 },
+  { "缸", 0.00000000 },
+  { "缺", 0.00020000 },
+  { "罕", 0.00010000 },
+  { "罪", 0.00020000 },
+  { "置", 0.00060000 },
+  { "罰", 0.00000000 },
+  { "署", 0.00020000 },
+  { "罵", 0.00000000 },
+  { "罷", 0.00000000 },
+  { "羅", 0.00080000 },
+  { "美", 0.00220000 },
+  { "羞", 0.00000000 },
+  { "群", 0.00050000 },
+  { "義", 0.00060000 },
+  { "翁", 0.00010000 },
+  { "習", 0.00020000 },
+  { "翔", 0.00000000 },
+  { "翰", 0.00020000 },
+  { "翹", 0.00000000 },
+  { "翻", 0.00020000 },
+  { "翼", 0.00020000 },
+  { "耀", 0.00010000 },
+  { "考", 0.00050000 },
+  { "者", 0.00170000 },
+  { "耍", 0.00000000 },
+  { "耐", 0.00000000 },
+  { "耗", 0.00010000 },
+  { "耶", 0.00020000 },
+  { "聊", 0.00000000 },
+  { "聖", 0.00030000 },
+  { "聚", 0.00020000 },
+  { "聞", 0.00020000 },
+  { "聯", 0.00090000 },
+  { "聰", 0.00000000 },
+  { "聲", 0.00030000 },
+  { "職", 0.00040000 },
+  { "聽", 0.00010000 },
+  { "肚", 0.00000000 },
+  { "股", 0.00030000 },
+  { "肥", 0.00010000 },
+  { "肩", 0.00000000 },
+  { "肯", 0.00010000 },
+  { "育", 0.00060000 },
+  { "背", 0.00020000 },
+  { "胎", 0.00010000 },
+  { "胖", 0.00000000 },
+  { "胞", 0.00010000 },
+  { "胡", 0.00020000 },
+  { "胸", 0.00000000 },
+  { "能", 0.00210000 },
+  { "脆", 0.00000000 },
+  { "脫", 0.00010000 },
+  { "腓", 0.00000000 },
+  { "腔", 0.00000000 },
+  { "腦", 0.00010000 },
+  { "腰", 0.00000000 },
+  { "腳", 0.00010000 },
+  { "腿", 0.00000000 },
+  { "膽", 0.00000000 },
+  { "臉", 0.00000000 },
+  { "臘", 0.00010000 },
+  { "臥", 0.00000000 },
+  { "臨", 0.00010000 },
+  { "臭", 0.00000000 },
+  { "致", 0.00050000 },
+  { "臺", 0.00030000 },
+  { "與", 0.00250000 },
+  { "興", 0.00030000 },
+  { "舉", 0.00050000 },
+  { "舊", 0.00020000 },
+  { "舍", 0.00010000 },
+  { "舒", 0.00010000 },
+  { "舞", 0.00020000 },
+  { "航", 0.00060000 },
+  { "般", 0.00040000 },
+  { "船", 0.00030000 },
+  { "艦", 0.00030000 },
+  { "良", 0.00020000 },
+  { "艾", 0.00030000 },
+  { "芝", 0.00010000 },
+  { "芬", 0.00010000 },
+  { "花", 0.00060000 },
+  { "芳", 0.00010000 },
+  { "若", 0.00020000 },
+  { "苦", 0.00010000 },
+  { "英", 0.00160000 },
+  { "茅", 0.00000000 },
+  { "茫", 0.00000000 },
+  { "茲", 0.00010000 },
+  { "茶", 0.00010000 },
+  { "草", 0.00040000 },
+  { "荒", 0.00010000 },
+  { "荷", 0.00020000 },
+  { "荼", 0.00000000 },
+  { "莉", 0.00010000 },
+  { "莊", 0.00010000 },
+  { "莎", 0.00010000 },
+  { "莫", 0.00030000 },
+  { "菜", 0.00010000 },
+  { "菩", 0.00000000 },
+  { "華", 0.00080000 },
+  { "菲", 0.00030000 },
+  { "萄", 0.00010000 },
+  { "萊", 0.00020000 },
+  { "萬", 0.00050000 },
+  { "落", 0.00050000 },
+  { "葉", 0.00020000 },
+  { "著", 0.00100000 },
+  { "葛", 0.00010000 },
+  { "葡", 0.00010000 },
+  { "蒂", 0.00020000 },
+  { "蒙", 0.00040000 },
+  { "蒲", 0.00000000 },
+  { "蒼", 0.00000000 },
+  { "蓋", 0.00010000 },
+  { "蓮", 0.00010000 },
+  { "蔕", 0.00000000 },
+  { "蔡", 0.00010000 },
+  { "蔣", 0.00010000 },
+  { "蕭", 0.00000000 },
+  { "薄", 0.00010000 },
+  { "薦", 0.00000000 },
+  { "薩", 0.00020000 },
+  { "薪", 0.00000000 },
+  { "藉", 0.00010000 },
+  { "藍", 0.00010000 },
+  { "藏", 0.00040000 },
+  { "藝", 0.00030000 },
+  { "藤", 0.00010000 },
+  { "藥", 0.00010000 },
+  { "蘆", 0.00000000 },
+  { "蘇", 0.00030000 },
+  { "蘭", 0.00070000 },
+  { "虎", 0.00010000 },
+  { "處", 0.00050000 },
+  { "虛", 0.00010000 },
+  { "號", 0.00090000 },
+  { "虧", 0.00000000 },
+  { "蛇", 0.00010000 },
+  { "蛋", 0.00010000 },
+  { "蛙", 0.00000000 },
+  { "蜂", 0.00000000 },
+  { "蜜", 0.00000000 },
+  { "蝶", 0.00000000 },
+  { "融", 0.00010000 },
+  { "螢", 0.00000000 },
+  { "蟲", 0.00010000 },
+  { "蟹", 0.00000000 },
+  { "蠍", 0.00000000 },
+  { "蠻", 0.00000000 },
+  { "術", 0.00040000 },
+  { "街", 0.00050000 },
+  { "衛", 0.00030000 },
+  { "衝", 0.00010000 },
+  { "衡", 0.00010000 },
+  { "表", 0.00170000 },
+  { "袋", 0.00000000 },
+  { "被", 0.00320000 },
+  { "裁", 0.00010000 },
+  { "裂", 0.00010000 },
+  { "裕", 0.00010000 },
+  { "補", 0.00010000 },
+  { "裝", 0.00040000 },
+  { "裡", 0.00030000 },
+  { "製", 0.00050000 },
+  { "複", 0.00010000 },
+  { "褲", 0.00000000 },
+  { "西", 0.00310000 },
+  { "要", 0.00230000 },
+  { "覆", 0.00010000 },
+  { "規", 0.00030000 },
+  { "視", 0.00070000 },
+  { "親", 0.00040000 },
+  { "覺", 0.00010000 },
+  { "覽", 0.00010000 },
+  { "觀", 0.00040000 },
+  { "解", 0.00080000 },
+  { "觸", 0.00010000 },
+  { "訂", 0.00010000 },
+  { "計", 0.00080000 },
+  { "訊", 0.00020000 },
+  { "討", 0.00010000 },
+  { "訓", 0.00010000 },
+  { "託", 0.00000000 },
+  { "記", 0.00040000 },
+  { "訥", 0.00000000 },
+  { "訪", 0.00010000 },
+  { "設", 0.00100000 },
+  { "許", 0.00040000 },
+  { "訴", 0.00010000 },
+  { "註", 0.00000000 },
+  { "証", 0.00000000 },
+  { "評", 0.00020000 },
+  { "詞", 0.00020000 },
+  { "詢", 0.00000000 },
+  { "試", 0.00020000 },
+  { "詩", 0.00010000 },
+  { "話", 0.00020000 },
+  { "該", 0.00070000 },
+  { "詳", 0.00010000 },
+  { "誇", 0.00000000 },
+  { "誌", 0.00010000 },
+  { "認", 0.00050000 },
+  { "誓", 0.00000000 },
+  { "誕", 0.00000000 },
+  { "語", 0.00080000 },
+  { "誠", 0.00000000 },
+  { "誤", 0.00010000 },
+  { "說", 0.00060000 },
+  { "誰", 0.00000000 },
+  { "課", 0.00010000 },
+  { "誼", 0.00000000 },
+  { "調", 0.00030000 },
+  { "談", 0.00010000 },
+  { "請", 0.00020000 },
+  { "諒", 0.00000000 },
+  { "論", 0.00040000 },
+  { "諸", 0.00010000 },
+  { "諺", 0.00000000 },
+  { "諾", 0.00020000 },
+  { "謀", 0.00010000 },
+  { "謂", 0.00010000 },
+  { "講", 0.00010000 },
+  { "謝", 0.00010000 },
+  { "證", 0.00020000 },
+  { "識", 0.00020000 },
+  { "譜", 0.00010000 },
+  { "警", 0.00030000 },
+  { "譯", 0.00020000 },
+  { "議", 0.00060000 },
+  { "護", 0.00030000 },
+  { "譽", 0.00010000 },
+  { "讀", 0.00020000 },
+  { "變", 0.00050000 },
+  { "讓", 0.00030000 },
+  { "讚", 0.00000000 },
+  { "豈", 0.00000000 },
+  { "豐", 0.00010000 },
+  { "象", 0.00040000 },
+  { "豪", 0.00010000 },
+  { "豬", 0.00000000 },
+  { "貌", 0.00010000 },
+  { "貓", 0.00010000 },
+  { "貞", 0.00000000 },
+  { "負", 0.00030000 },
+  { "財", 0.00010000 },
+  { "貢", 0.00010000 },
+  { "貨", 0.00010000 },
+  { "貪", 0.00000000 },
+  { "貫", 0.00010000 },
+  { "責", 0.00030000 },
+  { "貴", 0.00010000 },
+  { "買", 0.00010000 },
+  { "費", 0.00030000 },
+  { "貼", 0.00000000 },
+  { "賀", 0.00010000 },
+  { "資", 0.00060000 },
+  { "賈", 0.00000000 },
+  { "賓", 0.00010000 },
+  { "賜", 0.00000000 },
+  { "賞", 0.00010000 },
+  { "賢", 0.00000000 },
+  { "賣", 0.00010000 },
+  { "賤", 0.00000000 },
+  { "賦", 0.00000000 },
+  { "質", 0.00040000 },
+  { "賭", 0.00000000 },
+  { "賴", 0.00010000 },
+  { "賺", 0.00000000 },
+  { "購", 0.00020000 },
+  { "賽", 0.00120000 },
+  { "贈", 0.00000000 },
+  { "贊", 0.00010000 },
+  { "贏", 0.00010000 },
+  { "赫", 0.00020000 },
+  { "起", 0.00130000 },
+  { "超", 0.00060000 },
+  { "越", 0.00050000 },
+  { "趕", 0.00000000 },
+  { "趙", 0.00010000 },
+  { "趣", 0.00010000 },
+  { "趨", 0.00000000 },
+  { "跌", 0.00000000 },
+  { "跎", 0.00000000 },
+  { "跑", 0.00010000 },
+  { "距", 0.00030000 },
+  { "跟", 0.00020000 },
+  { "跡", 0.00000000 },
+  { "路", 0.00200000 },
+  { "跳", 0.00010000 },
+  { "踏", 0.00000000 },
+  { "踢", 0.00000000 },
+  { "蹟", 0.00000000 },
+  { "蹤", 0.00000000 },
+  { "躍", 0.00000000 },
+  { "躲", 0.00000000 },
+  { "軌", 0.00010000 },
+  { "軍", 0.00180000 },
+  { "軒", 0.00000000 },
+  { "軟", 0.00020000 },
+  { "較", 0.00040000 },
+  { "載", 0.00020000 },
+  { "輔", 0.00010000 },
+  { "輕", 0.00020000 },
+  { "輛", 0.00010000 },
+  { "輝", 0.00010000 },
+  { "輩", 0.00000000 },
+  { "輪", 0.00020000 },
+  { "輯", 0.00030000 },
+  { "輸", 0.00010000 },
+  { "轉", 0.00050000 },
+  { "轟", 0.00010000 },
+  { "辦", 0.00040000 },
+  { "辨", 0.00000000 },
+  { "辭", 0.00010000 },
+  { "辯", 0.00000000 },
+  { "辱", 0.00000000 },
+  { "農", 0.00020000 },
+  { "迅", 0.00010000 },
+  { "迎", 0.00010000 },
+  { "近", 0.00080000 },
+  { "返", 0.00020000 },
+  { "迦", 0.00000000 },
+  { "迪", 0.00040000 },
+  { "迫", 0.00020000 },
+  { "述", 0.00040000 },
+  { "迴", 0.00010000 },
+  { "迷", 0.00010000 },
+  { "追", 0.00020000 },
+  { "退", 0.00030000 },
+  { "送", 0.00030000 },
+  { "逃", 0.00020000 },
+  { "逆", 0.00010000 },
+  { "透", 0.00020000 },
+  { "逐", 0.00030000 },
+  { "途", 0.00020000 },
+  { "這", 0.00160000 },
+  { "通", 0.00180000 },
+  { "逛", 0.00000000 },
+  { "逝", 0.00010000 },
+  { "速", 0.00060000 },
+  { "造", 0.00090000 },
+  { "逢", 0.00010000 },
+  { "連", 0.00050000 },
+  { "週", 0.00010000 },
+  { "進", 0.00120000 },
+  { "逸", 0.00000000 },
+  { "逼", 0.00000000 },
+  { "遇", 0.00020000 },
+  { "遊", 0.00040000 },
+  { "運", 0.00080000 },
+  { "遍", 0.00010000 },
+  { "過", 0.00120000 },
+  { "道", 0.00210000 },
+  { "達", 0.00090000 },
+  { "違", 0.00000000 },
+  { "遙", 0.00000000 },
+  { "遜", 0.00010000 },
+  { "遠", 0.00020000 },
+  { "適", 0.00010000 },
+  { "遭", 0.00020000 },
+  { "遮", 0.00000000 },
+  { "遲", 0.00000000 },
+  { "遷", 0.00010000 },
+  { "選", 0.00090000 },
+  { "遺", 0.00010000 },
+  { "避", 0.00010000 },
+  { "邀", 0.00010000 },
+  { "邁", 0.00000000 },
+  { "還", 0.00040000 },
+  { "邊", 0.00030000 },
+  { "邏", 0.00000000 },
+  { "那", 0.00050000 },
+  { "邦", 0.00030000 },
+  { "邪", 0.00000000 },
+  { "邱", 0.00000000 },
+  { "郎", 0.00020000 },
+  { "部", 0.00390000 },
+  { "郭", 0.00010000 },
+  { "郵", 0.00000000 },
+  { "都", 0.00170000 },
+  { "鄂", 0.00000000 },
+  { "鄉", 0.00020000 },
+  { "鄭", 0.00010000 },
+  { "鄰", 0.00010000 },
+  { "配", 0.00040000 },
+  { "酒", 0.00030000 },
+  { "酷", 0.00000000 },
+  { "酸", 0.00020000 },
+  { "醉", 0.00000000 },
+  { "醒", 0.00000000 },
+  { "醜", 0.00000000 },
+  { "醫", 0.00020000 },
+  { "采", 0.00020000 },
+  { "釋", 0.00010000 },
+  { "重", 0.00170000 },
+  { "野", 0.00030000 },
+  { "量", 0.00130000 },
+  { "針", 0.00010000 },
+  { "釣", 0.00000000 },
+  { "鈴", 0.00000000 },
+  { "鉢", 0.00000000 },
+  { "銀", 0.00040000 },
+  { "銅", 0.00010000 },
+  { "銖", 0.00000000 },
+  { "銘", 0.00000000 },
+  { "銳", 0.00000000 },
+  { "銷", 0.00020000 },
+  { "鋒", 0.00010000 },
+  { "鋼", 0.00010000 },
+  { "錄", 0.00040000 },
+  { "錢", 0.00010000 },
+  { "錦", 0.00010000 },
+  { "錫", 0.00010000 },
+  { "錯", 0.00010000 },
+  { "鍋", 0.00000000 },
+  { "鍵", 0.00010000 },
+  { "鍾", 0.00000000 },
+  { "鎊", 0.00000000 },
+  { "鎖", 0.00000000 },
+  { "鎮", 0.00030000 },
+  { "鏡", 0.00010000 },
+  { "鐘", 0.00010000 },
+  { "鐵", 0.00050000 },
+  { "鑑", 0.00000000 },
+  { "閃", 0.00000000 },
+  { "閉", 0.00010000 },
+  { "開", 0.00150000 },
+  { "閏", 0.00000000 },
+  { "閒", 0.00000000 },
+  { "間", 0.00130000 },
+  { "閣", 0.00010000 },
+  { "閱", 0.00000000 },
+  { "闆", 0.00000000 },
+  { "闊", 0.00000000 },
+  { "闍", 0.00000000 },
+  { "闐", 0.00000000 },
+  { "關", 0.00070000 },
+  { "闡", 0.00000000 },
+  { "防", 0.00040000 },
+  { "阻", 0.00010000 },
+  { "阿", 0.00110000 },
+  { "陀", 0.00000000 },
+  { "附", 0.00040000 },
+  { "降", 0.00040000 },
+  { "限", 0.00050000 },
+  { "院", 0.00150000 },
+  { "陣", 0.00020000 },
+  { "除", 0.00060000 },
+  { "陪", 0.00000000 },
+  { "陰", 0.00010000 },
+  { "陳", 0.00030000 },
+  { "陵", 0.00020000 },
+  { "陶", 0.00010000 },
+  { "陷", 0.00010000 },
+  { "陸", 0.00040000 },
+  { "陽", 0.00030000 },
+  { "隆", 0.00030000 },
+  { "隊", 0.00110000 },
+  { "階", 0.00020000 },
+  { "隔", 0.00010000 },
+  { "際", 0.00040000 },
+  { "障", 0.00010000 },
+  { "隨", 0.00030000 },
+  { "險", 0.00010000 },
+  { "隱", 0.00010000 },
+  { "隻", 0.00010000 },
+  { "雄", 0.00030000 },
+  { "雅", 0.00030000 },
+  { "集", 0.00110000 },
+  { "雉", 0.00000000 },
+  { "雖", 0.00030000 },
+  { "雙", 0.00030000 },
+  { "雜", 0.00020000 },
+  { "雞", 0.00000000 },
+  { "離", 0.00040000 },
+  { "難", 0.00020000 },
+  { "雪", 0.00020000 },
+  { "雲", 0.00020000 },
+  { "零", 0.00010000 },
+  { "雷", 0.00050000 },
+  { "電", 0.00140000 },
+  { "需", 0.00050000 },
+  { "震", 0.00010000 },
+  { "霍", 0.00020000 },
+  { "霧", 0.00000000 },
+  { "露", 0.00020000 },
+  { "霸", 0.00010000 },
+  { "霹", 0.00000000 },
+  { "靂", 0.00000000 },
+  { "靈", 0.00020000 },
+  { "青", 0.00050000 },
+  { "靖", 0.00010000 },
+  { "靜", 0.00010000 },
+  { "靠", 0.00010000 },
+  { "靼", 0.00000000 },
+  { "鞋", 0.00000000 },
+  { "韃", 0.00000000 },
+  { "韓", 0.00020000 },
+  { "韻", 0.00000000 },
+  { "響", 0.00030000 },
+  { "頂", 0.00010000 },
+  { "項", 0.00030000 },
+  { "順", 0.00010000 },
+  { "須", 0.00020000 },
+  { "預", 0.00020000 },
+  { "頑", 0.00000000 },
+  { "頓", 0.00030000 },
+  { "頗", 0.00000000 },
+  { "領", 0.00050000 },
+  { "頞", 0.00000000 },
+  { "頭", 0.00050000 },
+  { "頻", 0.00010000 },
+  { "顆", 0.00010000 },
+  { "題", 0.00040000 },
+  { "額", 0.00010000 },
+  { "顏", 0.00010000 },
+  { "願", 0.00010000 },
+  { "類", 0.00070000 },
+  { "顧", 0.00010000 },
+  { "顯", 0.00020000 },
+  { "飄", 0.00000000 },
+  { "飯", 0.00000000 },
+  { "飲", 0.00000000 },
+  { "飽", 0.00000000 },
+  { "飾", 0.00010000 },
+  { "餅", 0.00000000 },
+  { "養", 0.00010000 },
+  { "餐", 0.00010000 },
+  { "餘", 0.00020000 },
+  { "館", 0.00030000 },
+  { "駐", 0.00010000 },
+  { "駕", 0.00010000 },
+  { "駛", 0.00010000 },
+  { "騎", 0.00010000 },
+  { "騙", 0.00000000 },
+  { "騷", 0.00000000 },
+  { "驅", 0.00010000 },
+  { "驗", 0.00020000 },
+  { "驚", 0.00000000 },
+  { "體", 0.00120000 },
+  { "髮", 0.00000000 },
+  { "鬆", 0.00000000 },
+  { "鬧", 0.00000000 },
+  { "鬱", 0.00000000 },
+  { "魁", 0.00000000 },
+  { "魂", 0.00000000 },
+  { "魅", 0.00000000 },
+  { "魔", 0.00020000 },
+  { "魯", 0.00020000 },
+  { "鮮", 0.00010000 },
+  { "鳳", 0.00010000 },
+  { "鳴", 0.00000000 },
+  { "鴻", 0.00000000 },
+  { "鵝", 0.00000000 },
+  { "鷹", 0.00000000 },
+  { "麗", 0.00020000 },
+  { "麵", 0.00000000 },
+  { "麼", 0.00010000 },
+  { "黎", 0.00020000 },
+  { "默", 0.00010000 },
+  { "點", 0.00050000 },
+  { "黨", 0.00050000 },
+  { "齋", 0.00000000 },
+  { "齡", 0.00010000 },
+};
+
+const wa_cp_freq ALPHA_337_FREQ_CPS[] = {
+  { 0x4E00u, 0.01230000 },
+  { 0x4E01u, 0.00030000 },
+  { 0x4E03u, 0.00050000 },
+  { 0x4E08u, 0.00010000 },
+  { 0x4E09u, 0.00230000 },
+  { 0x4E0Au, 0.00460000 },
+  { 0x4E0Bu, 0.00310000 },
+  { 0x4E0Cu, 0.00000000 },
+  { 0x4E0Du, 0.00430000 },
+  { 0x4E11u, 0.00000000 },
+  { 0x4E14u, 0.00070000 },
+  { 0x4E16u, 0.00220000 },
+  { 0x4E18u, 0.00010000 },
+  { 0x4E19u, 0.00010000 },
+  { 0x4E1Fu, 0.00000000 },
+  { 0x4E26u, 0.00160000 },
+  { 0x4E2Du, 0.01020000 },
+  { 0x4E32u, 0.00010000 },
+  { 0x4E38u, 0.00000000 },
+  { 0x4E39u, 0.00030000 },
+  { 0x4E3Bu, 0.00360000 },
+  { 0x4E43u, 0.00010000 },
+  { 0x4E45u, 0.00030000 },
+  { 0x4E48u, 0.00010000 },
+  { 0x4E4Bu, 0.00410000 },
+  { 0x4E4Eu, 0.00020000 },
+  { 0x4E4Fu, 0.00010000 },
+  { 0x4E56u, 0.00000000 },
+  { 0x4E58u, 0.00020000 },
+  { 0x4E59u, 0.00010000 },
+  { 0x4E5Du, 0.00060000 },
+  { 0x4E5Fu, 0.00240000 },
+  { 0x4E7Eu, 0.00010000 },
+  { 0x4E82u, 0.00010000 },
+  { 0x4E86u, 0.00540000 },
+  { 0x4E88u, 0.00020000 },
+  { 0x4E8Bu, 0.00200000 },
+  { 0x4E8Cu, 0.00200000 },
+  { 0x4E8Eu, 0.00350000 },
+  { 0x4E91u, 0.00020000 },
+  { 0x4E92u, 0.00020000 },
+  { 0x4E94u, 0.00090000 },
+  { 0x4E95u, 0.00010000 },
+  { 0x4E9Bu, 0.00110000 },
+  { 0x4E9Eu, 0.00120000 },
+  { 0x4EA1u, 0.00030000 },
+  { 0x4EA4u, 0.00110000 },
+  { 0x4EA5u, 0.00000000 },
+  { 0x4EA6u, 0.00070000 },
+  { 0x4EA8u, 0.00010000 },
+  { 0x4EABu, 0.00010000 },
+  { 0x4EACu, 0.00090000 },
+  { 0x4EAEu, 0.00010000 },
+  { 0x4EBAu, 0.00830000 },
+  { 0x4EC0u, 0.00020000 },
+  { 0x4EC1u, 0.00020000 },
+  { 0x4EC7u, 0.00000000 },
+  { 0x4ECAu, 0.00080000 },
+  { 0x4ECBu, 0.00020000 },
+  { 0x4ECDu, 0.00050000 },
+  { 0x4ED4u, 0.00010000 },
+  { 0x4ED6u, 0.00420000 },
+  { 0x4ED8u, 0.00010000 },
+  { 0x4ED9u, 0.00010000 },
+  { 0x4EE3u, 0.00260000 },
+  { 0x4EE4u, 0.00060000 },
+  { 0x4EE5u, 0.00600000 },
+  { 0x4EF0u, 0.00010000 },
+  { 0x4EF2u, 0.00010000 },
+  { 0x4EF6u, 0.00080000 },
+  { 0x4EFBu, 0.00250000 },
+  { 0x4EFDu, 0.00060000 },
+  { 0x4F01u, 0.00020000 },
+  { 0x4F0Au, 0.00060000 },
+  { 0x4F0Du, 0.00010000 },
+  { 0x4F10u, 0.00010000 },
+  { 0x4F11u, 0.00020000 },
+  { 0x4F19u, 0.00000000 },
+  { 0x4F2Fu, 0.00050000 },
+  { 0x4F30u, 0.00010000 },
+  { 0x4F34u, 0.00010000 },
+  { 0x4F38u, 0.00010000 },
+  { 0x4F3Cu, 0.00030000 },
+  { 0x4F3Du, 0.00000000 },
+  { 0x4F46u, 0.00200000 },
+  { 0x4F48u, 0.00020000 },
+  { 0x4F49u, 0.00000000 },
+  { 0x4F4Du, 0.00330000 },
+  { 0x4F4Eu, 0.00040000 },
+  { 0x4F4Fu, 0.00040000 },
+  { 0x4F54u, 0.00020000 },
+  { 0x4F55u, 0.00040000 },
+  { 0x4F59u, 0.00020000 },
+  { 0x4F5Bu, 0.00040000 },
+  { 0x4F5Cu, 0.00360000 },
+  { 0x4F60u, 0.00010000 },
+  { 0x4F69u, 0.00010000 },
+  { 0x4F73u, 0.00030000 },
+  { 0x4F7Fu, 0.00190000 },
+  { 0x4F86u, 0.00170000 },
+  { 0x4F8Bu, 0.00060000 },
+  { 0x4F9Bu, 0.00060000 },
+  { 0x4F9Du, 0.00030000 },
+  { 0x4FAFu, 0.00010000 },
+  { 0x4FB5u, 0.00020000 },
+  { 0x4FBFu, 0.00050000 },
+  { 0x4FC2u, 0.00020000 },
+  { 0x4FC3u, 0.00010000 },
+  { 0x4FC4u, 0.00040000 },
+  { 0x4FCAu, 0.00010000 },
+  { 0x4FD7u, 0.00010000 },
+  { 0x4FDDu, 0.00100000 },
+  { 0x4FE0u, 0.00000000 },
+  { 0x4FE1u, 0.00080000 },
+  { 0x4FEEu, 0.00060000 },
+  { 0x4FF1u, 0.00010000 },
+  { 0x4FFEu, 0.00000000 },
+  { 0x500Bu, 0.00260000 },
+  { 0x500Du, 0.00010000 },
+  { 0x5011u, 0.00080000 },
+  { 0x5012u, 0.00010000 },
+  { 0x5019u, 0.00030000 },
+  { 0x501Au, 0.00000000 },
+  { 0x501Fu, 0.00010000 },
+  { 0x502Bu, 0.00030000 },
+  { 0x503Cu, 0.00040000 },
+  { 0x5047u, 0.00030000 },
+  { 0x5049u, 0.00010000 },
+  { 0x504Fu, 0.00010000 },
+  { 0x505Au, 0.00040000 },
+  { 0x505Cu, 0.00030000 },
+  { 0x5065u, 0.00010000 },
+  { 0x5074u, 0.00010000 },
+  { 0x5075u, 0.00000000 },
+  { 0x5076u, 0.00010000 },
+  { 0x5077u, 0.00000000 },
+  { 0x5091u, 0.00010000 },
+  { 0x5099u, 0.00030000 },
+  { 0x50A2u, 0.00000000 },
+  { 0x50A3u, 0.00000000 },
+  { 0x50B2u, 0.00000000 },
+  { 0x50B3u, 0.00060000 },
+  { 0x50B7u, 0.00020000 },
+  { 0x50BBu, 0.00000000 },
+  { 0x50BEu, 0.00000000 },
+  { 0x50C5u, 0.00020000 },
+  { 0x50CFu, 0.00040000 },
+  { 0x50D1u, 0.00000000 },
+  { 0x50E7u, 0.00010000 },
+  { 0x50F9u, 0.00020000 },
+  { 0x5100u, 0.00010000 },
+  { 0x5104u, 0.00010000 },
+  { 0x5112u, 0.00010000 },
+  { 0x5118u, 0.00000000 },
+  { 0x512Au, 0.00020000 },
+  { 0x5141u, 0.00010000 },
+  { 0x5143u, 0.00140000 },
+  { 0x5144u, 0.00010000 },
+  { 0x5145u, 0.00020000 },
+  { 0x5147u, 0.00000000 },
+  { 0x5148u, 0.00080000 },
+  { 0x5149u, 0.00090000 },
+  { 0x514Bu, 0.00210000 },
+  { 0x514Du, 0.00020000 },
+  { 0x5152u, 0.00030000 },
+  { 0x5154u, 0.00000000 },
+  { 0x5165u, 0.00210000 },
+  { 0x5167u, 0.00110000 },
+  { 0x5168u, 0.00180000 },
+  { 0x5169u, 0.00100000 },
+  { 0x516Bu, 0.00060000 },
+  { 0x516Cu, 0.00430000 },
+  { 0x516Du, 0.00060000 },
+  { 0x516Eu, 0.00000000 },
+  { 0x5171u, 0.00160000 },
+  { 0x5175u, 0.00070000 },
+  { 0x5176u, 0.00360000 },
+  { 0x5177u, 0.00060000 },
+  { 0x5178u, 0.00040000 },
+  { 0x517Cu, 0.00020000 },
+  { 0x518Au, 0.00010000 },
+  { 0x518Du, 0.00070000 },
+  { 0x5192u, 0.00000000 },
+  { 0x51A0u, 0.00040000 },
+  { 0x51ACu, 0.00010000 },
+  { 0x51B0u, 0.00010000 },
+  { 0x51B7u, 0.00010000 },
+  { 0x51C6u, 0.00030000 },
+  { 0x51CCu, 0.00010000 },
+  { 0x51DDu, 0.00000000 },
+  { 0x51E1u, 0.00010000 },
+  { 0x51F0u, 0.00000000 },
+  { 0x51F1u, 0.00010000 },
+  { 0x51FAu, 0.00420000 },
+  { 0x51FDu, 0.00010000 },
+  { 0x5200u, 0.00010000 },
+  { 0x5206u, 0.00360000 },
+  { 0x5207u, 0.00030000 },
+  { 0x520Au, 0.00020000 },
+  { 0x5217u, 0.00120000 },
+  { 0x521Du, 0.00070000 },
+  { 0x5224u, 0.00030000 },
+  { 0x5225u, 0.00050000 },
+  { 0x5229u, 0.00230000 },
+  { 0x522Au, 0.00000000 },
+  { 0x5230u, 0.00340000 },
+  { 0x5236u, 0.00130000 },
+  { 0x5237u, 0.00000000 },
+  { 0x523Au, 0.00020000 },
+  { 0x523Bu, 0.00020000 },
+  { 0x5247u, 0.00080000 },
+  { 0x524Cu, 0.00000000 },
+  { 0x524Du, 0.00250000 },
+  { 0x525Bu, 0.00010000 },
+  { 0x5269u, 0.00010000 },
+  { 0x526Au, 0.00000000 },
+  { 0x526Fu, 0.00040000 },
+  { 0x5272u, 0.00010000 },
+  { 0x5275u, 0.00040000 },
+  { 0x5283u, 0.00030000 },
+  { 0x5287u, 0.00050000 },
+  { 0x5289u, 0.00020000 },
+  { 0x528Du, 0.00010000 },
+  { 0x529Bu, 0.00170000 },
+  { 0x529Fu, 0.00060000 },
+  { 0x52A0u, 0.00240000 },
+  { 0x52A9u, 0.00050000 },
+  { 0x52AAu, 0.00010000 },
+  { 0x52ABu, 0.00000000 },
+  { 0x52C1u, 0.00000000 },
+  { 0x52C7u, 0.00010000 },
+  { 0x52C9u, 0.00000000 },
+  { 0x52D2u, 0.00040000 },
+  { 0x52D5u, 0.00150000 },
+  { 0x52D9u, 0.00070000 },
+  { 0x52DDu, 0.00030000 },
+  { 0x52DEu, 0.00010000 },
+  { 0x52E2u, 0.00020000 },
+  { 0x52E4u, 0.00010000 },
+  { 0x52F5u, 0.00000000 },
+  { 0x52F8u, 0.00000000 },
+  { 0x52FFu, 0.00000000 },
+  { 0x5305u, 0.00110000 },
+  { 0x5308u, 0.00010000 },
+  { 0x5316u, 0.00190000 },
+  { 0x5317u, 0.00240000 },
+  { 0x5339u, 0.00010000 },
+  { 0x5340u, 0.00160000 },
+  { 0x5341u, 0.00180000 },
+  { 0x5343u, 0.00040000 },
+  { 0x5347u, 0.00050000 },
+  { 0x5348u, 0.00010000 },
+  { 0x534Au, 0.00050000 },
+  { 0x5352u, 0.00010000 },
+  { 0x5353u, 0.00010000 },
+  { 0x5354u, 0.00030000 },
+  { 0x5357u, 0.00270000 },
+  { 0x535Au, 0.00050000 },
+  { 0x535Cu, 0.00010000 },
+  { 0x5361u, 0.00090000 },
+  { 0x536Fu, 0.00000000 },
+  { 0x5370u, 0.00050000 },
+  { 0x5371u, 0.00010000 },
+  { 0x5373u, 0.00080000 },
+  { 0x5377u, 0.00020000 },
+  { 0x537Bu, 0.00020000 },
+  { 0x5384u, 0.00010000 },
+  { 0x5398u, 0.00010000 },
+  { 0x539Au, 0.00010000 },
+  { 0x539Fu, 0.00160000 },
+  { 0x53ADu, 0.00000000 },
+  { 0x53B2u, 0.00000000 },
+  { 0x53BBu, 0.00070000 },
+  { 0x53C3u, 0.00060000 },
+  { 0x53C8u, 0.00090000 },
+  { 0x53CAu, 0.00340000 },
+  { 0x53CBu, 0.00030000 },
+  { 0x53CDu, 0.00090000 },
+  { 0x53D4u, 0.00010000 },
+  { 0x53D6u, 0.00090000 },
+  { 0x53D7u, 0.00110000 },
+  { 0x53E3u, 0.00160000 },
+  { 0x53E4u, 0.00100000 },
+  { 0x53E5u, 0.00010000 },
+  { 0x53E6u, 0.00060000 },
+  { 0x53EAu, 0.00090000 },
+  { 0x53EBu, 0.00020000 },
+  { 0x53ECu, 0.00020000 },
+  { 0x53EDu, 0.00000000 },
+  { 0x53EFu, 0.00290000 },
+  { 0x53F0u, 0.00210000 },
+  { 0x53F2u, 0.00100000 },
+  { 0x53F3u, 0.00030000 },
+  { 0x53F8u, 0.00150000 },
+  { 0x5403u, 0.00010000 },
+  { 0x5404u, 0.00090000 },
+  { 0x5408u, 0.00200000 },
+  { 0x5409u, 0.00050000 },
+  { 0x540Au, 0.00000000 },
+  { 0x540Cu, 0.00280000 },
+  { 0x540Du, 0.00390000 },
+  { 0x540Eu, 0.00230000 },
+  { 0x5410u, 0.00010000 },
+  { 0x5411u, 0.00110000 },
+  { 0x5412u, 0.00000000 },
+  { 0x541Bu, 0.00020000 },
+  { 0x541Du, 0.00000000 },
+  { 0x541Eu, 0.00000000 },
+  { 0x541Fu, 0.00000000 },
+  { 0x5420u, 0.00000000 },
+  { 0x5426u, 0.00020000 },
+  { 0x5427u, 0.00000000 },
+  { 0x542Bu, 0.00030000 },
+  { 0x5433u, 0.00010000 },
+  { 0x5435u, 0.00000000 },
+  { 0x5438u, 0.00020000 },
+  { 0x5439u, 0.00000000 },
+  { 0x543Eu, 0.00000000 },
+  { 0x5440u, 0.00000000 },
+  { 0x5442u, 0.00000000 },
+  { 0x5446u, 0.00000000 },
+  { 0x544Au, 0.00040000 },
+  { 0x5462u, 0.00000000 },
+  { 0x5468u, 0.00050000 },
+  { 0x5473u, 0.00010000 },
+  { 0x5475u, 0.00000000 },
+  { 0x547Cu, 0.00010000 },
+  { 0x547Du, 0.00090000 },
+  { 0x548Cu, 0.00610000 },
+  { 0x5496u, 0.00000000 },
+  { 0x54A6u, 0.00000000 },
+  { 0x54A7u, 0.00000000 },
+  { 0x54AAu, 0.00000000 },
+  { 0x54ACu, 0.00000000 },
+  { 0x54B1u, 0.00000000 },
+  { 0x54C0u, 0.00000000 },
+  { 0x54C1u, 0.00100000 },
+  { 0x54C7u, 0.00000000 },
+  { 0x54C8u, 0.00050000 },
+  { 0x54C9u, 0.00000000 },
+  { 0x54CEu, 0.00000000 },
+  { 0x54E1u, 0.00130000 },
+  { 0x54E5u, 0.00040000 },
+  { 0x54E6u, 0.00000000 },
+  { 0x54E9u, 0.00000000 },
+  { 0x54EAu, 0.00000000 },
+  { 0x54EDu, 0.00000000 },
+  { 0x54F2u, 0.00010000 },
+  { 0x5509u, 0.00000000 },
+  { 0x5510u, 0.00030000 },
+  { 0x5514u, 0.00000000 },
+  { 0x552Cu, 0.00000000 },
+  { 0x552Eu, 0.00030000 },
+  { 0x552Fu, 0.00020000 },
+  { 0x5531u, 0.00040000 },
+  { 0x5537u, 0.00000000 },
+  { 0x5538u, 0.00000000 },
+  { 0x5546u, 0.00080000 },
+  { 0x554Au, 0.00000000 },
+  { 0x554Fu, 0.00030000 },
+  { 0x555Fu, 0.00010000 },
+  { 0x5561u, 0.00000000 },
+  { 0x5565u, 0.00000000 },
+  { 0x5566u, 0.00000000 },
+  { 0x556Au, 0.00000000 },
+  { 0x5580u, 0.00010000 },
+  { 0x5582u, 0.00000000 },
+  { 0x5584u, 0.00020000 },
+  { 0x5587u, 0.00000000 },
+  { 0x558Au, 0.00000000 },
+  { 0x5594u, 0.00000000 },
+  { 0x559Cu, 0.00020000 },
+  { 0x559Du, 0.00000000 },
+  { 0x55ACu, 0.00010000 },
+  { 0x55AEu, 0.00060000 },
+  { 0x55B5u, 0.00000000 },
+  { 0x55CEu, 0.00000000 },
+  { 0x55DAu, 0.00000000 },
+  { 0x55E8u, 0.00000000 },
+  { 0x55EFu, 0.00000000 },
+  { 0x5606u, 0.00000000 },
+  { 0x5609u, 0.00030000 },
+  { 0x5617u, 0.00000000 },
+  { 0x561Bu, 0.00000000 },
+  { 0x5634u, 0.00010000 },
+  { 0x563Bu, 0.00000000 },
+  { 0x563Fu, 0.00000000 },
+  { 0x5668u, 0.00080000 },
+  { 0x5674u, 0.00000000 },
+  { 0x5687u, 0.00000000 },
+  { 0x56B4u, 0.00010000 },
+  { 0x56C9u, 0.00000000 },
+  { 0x56DBu, 0.00140000 },
+  { 0x56DEu, 0.00080000 },
+  { 0x56E0u, 0.00230000 },
+  { 0x56F0u, 0.00010000 },
+  { 0x56FAu, 0.00020000 },
+  { 0x5708u, 0.00010000 },
+  { 0x570Bu, 0.00480000 },
+  { 0x570Du, 0.00030000 },
+  { 0x5712u, 0.00030000 },
+  { 0x5713u, 0.00010000 },
+  { 0x5716u, 0.00040000 },
+  { 0x5718u, 0.00070000 },
+  { 0x571Cu, 0.00000000 },
+  { 0x571Fu, 0.00060000 },
+  { 0x5728u, 0.01200000 },
+  { 0x572Du, 0.00000000 },
+  { 0x5730u, 0.00470000 },
+  { 0x573Eu, 0.00000000 },
+  { 0x5740u, 0.00020000 },
+  { 0x5747u, 0.00050000 },
+  { 0x574Eu, 0.00010000 },
+  { 0x5750u, 0.00020000 },
+  { 0x5761u, 0.00020000 },
+  { 0x5764u, 0.00000000 },
+  { 0x5766u, 0.00030000 },
+  { 0x576Au, 0.00010000 },
+  { 0x5782u, 0.00010000 },
+  { 0x5783u, 0.00000000 },
+  { 0x578Bu, 0.00120000 },
+  { 0x57C3u, 0.00030000 },
+  { 0x57CEu, 0.00150000 },
+  { 0x57D4u, 0.00010000 },
+  { 0x57DFu, 0.00060000 },
+  { 0x57F7u, 0.00020000 },
+  { 0x57F9u, 0.00020000 },
+  { 0x57FAu, 0.00150000 },
+  { 0x5802u, 0.00050000 },
+  { 0x5805u, 0.00010000 },
+  { 0x5806u, 0.00000000 },
+  { 0x5821u, 0.00030000 },
+  { 0x582Au, 0.00000000 },
+  { 0x5831u, 0.00040000 },
+  { 0x5834u, 0.00120000 },
+  { 0x584Au, 0.00010000 },
+  { 0x5854u, 0.00050000 },
+  { 0x5857u, 0.00000000 },
+  { 0x585Eu, 0.00040000 },
+  { 0x586Bu, 0.00010000 },
+  { 0x5875u, 0.00000000 },
+  { 0x5883u, 0.00050000 },
+  { 0x589Eu, 0.00050000 },
+  { 0x58A8u, 0.00010000 },
+  { 0x58AEu, 0.00000000 },
+  { 0x58C1u, 0.00010000 },
+  { 0x58C7u, 0.00010000 },
+  { 0x58D3u, 0.00020000 },
+  { 0x58D8u, 0.00000000 },
+  { 0x58DEu, 0.00010000 },
+  { 0x58E2u, 0.00000000 },
+  { 0x58EBu, 0.00170000 },
+  { 0x58ECu, 0.00000000 },
+  { 0x58EFu, 0.00000000 },
+  { 0x58FDu, 0.00010000 },
+  { 0x590Fu, 0.00030000 },
+  { 0x5915u, 0.00000000 },
+  { 0x5916u, 0.00200000 },
+  { 0x591Au, 0.00290000 },
+  { 0x591Cu, 0.00020000 },
+  { 0x5920u, 0.00010000 },
+  { 0x5922u, 0.00010000 },
+  { 0x5925u, 0.00000000 },
+  { 0x5927u, 0.00800000 },
+  { 0x5929u, 0.00190000 },
+  { 0x592Au, 0.00100000 },
+  { 0x592Bu, 0.00080000 },
+  { 0x592Eu, 0.00040000 },
+  { 0x5931u, 0.00050000 },
+  { 0x5937u, 0.00010000 },
+  { 0x5938u, 0.00000000 },
+  { 0x593Eu, 0.00000000 },
+  { 0x5947u, 0.00040000 },
+  { 0x5948u, 0.00010000 },
+  { 0x5949u, 0.00020000 },
+  { 0x594Eu, 0.00000000 },
+  { 0x594Fu, 0.00010000 },
+  { 0x5951u, 0.00010000 },
+  { 0x5954u, 0.00000000 },
+  { 0x5957u, 0.00010000 },
+  { 0x5967u, 0.00040000 },
+  { 0x596Au, 0.00020000 },
+  { 0x596Eu, 0.00000000 },
+  { 0x5973u, 0.00110000 },
+  { 0x5974u, 0.00010000 },
+  { 0x5976u, 0.00000000 },
+  { 0x5979u, 0.00070000 },
+  { 0x597Du, 0.00060000 },
+  { 0x5982u, 0.00140000 },
+  { 0x5999u, 0.00000000 },
+  { 0x599Du, 0.00000000 },
+  { 0x59A5u, 0.00000000 },
+  { 0x59A8u, 0.00000000 },
+  { 0x59AEu, 0.00010000 },
+  { 0x59B3u, 0.00000000 },
+  { 0x59B9u, 0.00010000 },
+  { 0x59BBu, 0.00010000 },
+  { 0x59C6u, 0.00040000 },
+  { 0x59CAu, 0.00000000 },
+  { 0x59CBu, 0.00120000 },
+  { 0x59D0u, 0.00010000 },
+  { 0x59D1u, 0.00000000 },
+  { 0x59D3u, 0.00020000 },
+  { 0x59D4u, 0.00090000 },
+  { 0x59FFu, 0.00000000 },
+  { 0x5A01u, 0.00060000 },
+  { 0x5A03u, 0.00000000 },
+  { 0x5A18u, 0.00000000 },
+  { 0x5A1Bu, 0.00010000 },
+  { 0x5A41u, 0.00000000 },
+  { 0x5A46u, 0.00000000 },
+  { 0x5A5Au, 0.00020000 },
+  { 0x5A66u, 0.00010000 },
+  { 0x5A92u, 0.00020000 },
+  { 0x5ABDu, 0.00000000 },
+  { 0x5ACCu, 0.00000000 },
+  { 0x5AE9u, 0.00000000 },
+  { 0x5B50u, 0.00270000 },
+  { 0x5B54u, 0.00010000 },
+  { 0x5B57u, 0.00100000 },
+  { 0x5B58u, 0.00060000 },
+  { 0x5B5Du, 0.00010000 },
+  { 0x5B5Fu, 0.00010000 },
+  { 0x5B63u, 0.00060000 },
+  { 0x5B64u, 0.00010000 },
+  { 0x5B69u, 0.00010000 },
+  { 0x5B6Bu, 0.00010000 },
+  { 0x5B78u, 0.00250000 },
+  { 0x5B83u, 0.00100000 },
+  { 0x5B85u, 0.00010000 },
+  { 0x5B87u, 0.00020000 },
+  { 0x5B88u, 0.00030000 },
+  { 0x5B89u, 0.00150000 },
+  { 0x5B8Bu, 0.00030000 },
+  { 0x5B8Cu, 0.00070000 },
+  { 0x5B8Fu, 0.00010000 },
+  { 0x5B97u, 0.00060000 },
+  { 0x5B98u, 0.00090000 },
+  { 0x5B99u, 0.00010000 },
+  { 0x5B9Au, 0.00190000 },
+  { 0x5B9Bu, 0.00000000 },
+  { 0x5B9Cu, 0.00010000 },
+  { 0x5BA2u, 0.00060000 },
+  { 0x5BA3u, 0.00050000 },
+  { 0x5BA4u, 0.00040000 },
+  { 0x5BAEu, 0.00020000 },
+  { 0x5BB3u, 0.00020000 },
+  { 0x5BB6u, 0.00310000 },
+  { 0x5BB9u, 0.00050000 },
+  { 0x5BBFu, 0.00010000 },
+  { 0x5BC2u, 0.00000000 },
+  { 0x5BC4u, 0.00010000 },
+  { 0x5BC5u, 0.00000000 },
+  { 0x5BC6u, 0.00060000 },
+  { 0x5BCCu, 0.00030000 },
+  { 0x5BD2u, 0.00010000 },
+  { 0x5BDEu, 0.00000000 },
+  { 0x5BDFu, 0.00040000 },
+  { 0x5BE2u, 0.00000000 },
+  { 0x5BE6u, 0.00060000 },
+  { 0x5BE7u, 0.00010000 },
+  { 0x5BE8u, 0.00000000 },
+  { 0x5BE9u, 0.00010000 },
+  { 0x5BEBu, 0.00030000 },
+  { 0x5BECu, 0.00010000 },
+  { 0x5BEEu, 0.00000000 },
+  { 0x5BF5u, 0.00000000 },
+  { 0x5BF6u, 0.00020000 },
+  { 0x5C01u, 0.00030000 },
+  { 0x5C04u, 0.00050000 },
+  { 0x5C07u, 0.00120000 },
+  { 0x5C08u, 0.00050000 },
+  { 0x5C0Au, 0.00010000 },
+  { 0x5C0Bu, 0.00010000 },
+  { 0x5C0Du, 0.00140000 },
+  { 0x5C0Eu, 0.00050000 },
+  { 0x5C0Fu, 0.00200000 },
+  { 0x5C11u, 0.00090000 },
+  { 0x5C16u, 0.00010000 },
+  { 0x5C1Au, 0.00030000 },
+  { 0x5C24u, 0.00020000 },
+  { 0x5C31u, 0.00130000 },
+  { 0x5C3Au, 0.00020000 },
+  { 0x5C3Cu, 0.00120000 },
+  { 0x5C3Eu, 0.00030000 },
+  { 0x5C40u, 0.00070000 },
+  { 0x5C41u, 0.00000000 },
+  { 0x5C45u, 0.00060000 },
+  { 0x5C46u, 0.00020000 },
+  { 0x5C4Bu, 0.00020000 },
+  { 0x5C4Fu, 0.00010000 },
+  { 0x5C55u, 0.00090000 },
+  { 0x5C60u, 0.00000000 },
+  { 0x5C64u, 0.00030000 },
+  { 0x5C6Cu, 0.00070000 },
+  { 0x5C71u, 0.00210000 },
+  { 0x5CA1u, 0.00010000 },
+  { 0x5CA9u, 0.00020000 },
+  { 0x5CB8u, 0.00030000 },
+  { 0x5CF0u, 0.00020000 },
+  { 0x5CF6u, 0.00060000 },
+  { 0x5CFDu, 0.00000000 },
+  { 0x5D07u, 0.00010000 },
+  { 0x5D19u, 0.00000000 },
+  { 0x5D34u, 0.00000000 },
+  { 0x5D50u, 0.00000000 },
+  { 0x5DBAu, 0.00000000 },
+  { 0x5DDDu, 0.00050000 },
+  { 0x5DDEu, 0.00170000 },
+  { 0x5DE1u, 0.00020000 },
+  { 0x5DE5u, 0.00190000 },
+  { 0x5DE6u, 0.00030000 },
+  { 0x5DE7u, 0.00010000 },
+  { 0x5DE8u, 0.00020000 },
+  { 0x5DEBu, 0.00000000 },
+  { 0x5DEEu, 0.00020000 },
+  { 0x5DF1u, 0.00050000 },
+  { 0x5DF2u, 0.00110000 },
+  { 0x5DF3u, 0.00000000 },
+  { 0x5DF4u, 0.00130000 },
+  { 0x5DF7u, 0.00000000 },
+  { 0x5E02u, 0.00270000 },
+  { 0x5E03u, 0.00140000 },
+  { 0x5E0Cu, 0.00060000 },
+  { 0x5E15u, 0.00020000 },
+  { 0x5E16u, 0.00000000 },
+  { 0x5E1Bu, 0.00000000 },
+  { 0x5E1Du, 0.00070000 },
+  { 0x5E25u, 0.00000000 },
+  { 0x5E2Bu, 0.00050000 },
+  { 0x5E2Du, 0.00040000 },
+  { 0x5E33u, 0.00000000 },
+  { 0x5E36u, 0.00050000 },
+  { 0x5E38u, 0.00130000 },
+  { 0x5E3Du, 0.00000000 },
+  { 0x5E45u, 0.00010000 },
+  { 0x5E55u, 0.00020000 },
+  { 0x5E63u, 0.00010000 },
+  { 0x5E6Bu, 0.00010000 },
+  { 0x5E72u, 0.00020000 },
+  { 0x5E73u, 0.00210000 },
+  { 0x5E74u, 0.01620000 },
+  { 0x5E78u, 0.00010000 },
+  { 0x5E79u, 0.00010000 },
+  { 0x5E7Bu, 0.00010000 },
+  { 0x5E7Cu, 0.00010000 },
+  { 0x5E7Du, 0.00000000 },
+  { 0x5E7Eu, 0.00020000 },
+  { 0x5E87u, 0.00000000 },
+  { 0x5E8Au, 0.00010000 },
+  { 0x5E8Fu, 0.00030000 },
+  { 0x5E95u, 0.00040000 },
+  { 0x5E97u, 0.00030000 },
+  { 0x5E9Au, 0.00000000 },
+  { 0x5E9Cu, 0.00140000 },
+  { 0x5EA6u, 0.00200000 },
+  { 0x5EA7u, 0.00070000 },
+  { 0x5EABu, 0.00020000 },
+  { 0x5EADu, 0.00020000 },
+  { 0x5EB7u, 0.00040000 },
+  { 0x5EB8u, 0.00000000 },
+  { 0x5EC9u, 0.00010000 },
+  { 0x5ED6u, 0.00000000 },
+  { 0x5EE0u, 0.00020000 },
+  { 0x5EE2u, 0.00010000 },
+  { 0x5EE3u, 0.00060000 },
+  { 0x5EF3u, 0.00010000 },
+  { 0x5EF6u, 0.00030000 },
+  { 0x5EF7u, 0.00020000 },
+  { 0x5EFAu, 0.00230000 },
+  { 0x5F04u, 0.00000000 },
+  { 0x5F0Fu, 0.00180000 },
+  { 0x5F15u, 0.00070000 },
+  { 0x5F17u, 0.00020000 },
+  { 0x5F18u, 0.00010000 },
+  { 0x5F1Fu, 0.00030000 },
+  { 0x5F26u, 0.00000000 },
+  { 0x5F31u, 0.00010000 },
+  { 0x5F35u, 0.00050000 },
+  { 0x5F37u, 0.00040000 },
+  { 0x5F48u, 0.00030000 },
+  { 0x5F4Au, 0.00000000 },
+  { 0x5F4Cu, 0.00000000 },
+  { 0x5F4Eu, 0.00000000 },
+  { 0x5F5Du, 0.00000000 },
+  { 0x5F5Eu, 0.00000000 },
+  { 0x5F62u, 0.00110000 },
+  { 0x5F65u, 0.00000000 },
+  { 0x5F69u, 0.00010000 },
+  { 0x5F6Cu, 0.00000000 },
+  { 0x5F6Du, 0.00010000 },
+  { 0x5F70u, 0.00000000 },
+  { 0x5F71u, 0.00120000 },
+  { 0x5F79u, 0.00030000 },
+  { 0x5F7Cu, 0.00010000 },
+  { 0x5F80u, 0.00070000 },
+  { 0x5F81u, 0.00020000 },
+  { 0x5F85u, 0.00010000 },
+  { 0x5F88u, 0.00070000 },
+  { 0x5F8Bu, 0.00040000 },
+  { 0x5F8Cu, 0.00320000 },
+  { 0x5F90u, 0.00010000 },
+  { 0x5F91u, 0.00010000 },
+  { 0x5F92u, 0.00020000 },
+  { 0x5F97u, 0.00220000 },
+  { 0x5F9Eu, 0.00070000 },
+  { 0x5FA9u, 0.00020000 },
+  { 0x5FAEu, 0.00030000 },
+  { 0x5FB5u, 0.00010000 },
+  { 0x5FB7u, 0.00220000 },
+  { 0x5FB9u, 0.00000000 },
+  { 0x5FC3u, 0.00120000 },
+  { 0x5FC5u, 0.00030000 },
+  { 0x5FCCu, 0.00000000 },
+  { 0x5FCDu, 0.00000000 },
+  { 0x5FD7u, 0.00040000 },
+  { 0x5FD8u, 0.00000000 },
+  { 0x5FD9u, 0.00000000 },
+  { 0x5FE0u, 0.00010000 },
+  { 0x5FEBu, 0.00030000 },
+  { 0x5FF5u, 0.00040000 },
+  { 0x5FFDu, 0.00000000 },
+  { 0x600Eu, 0.00000000 },
+  { 0x6012u, 0.00000000 },
+  { 0x6015u, 0.00000000 },
+  { 0x6016u, 0.00000000 },
+  { 0x601Du, 0.00040000 },
+  { 0x6021u, 0.00000000 },
+  { 0x6025u, 0.00010000 },
+  { 0x6027u, 0.00160000 },
+  { 0x6028u, 0.00000000 },
+  { 0x602Au, 0.00010000 },
+  { 0x6046u, 0.00010000 },
+  { 0x6050u, 0.00010000 },
+  { 0x6062u, 0.00010000 },
+  { 0x6065u, 0.00000000 },
+  { 0x6068u, 0.00000000 },
+  { 0x6069u, 0.00030000 },
+  { 0x606Du, 0.00000000 },
+  { 0x606Fu, 0.00040000 },
+  { 0x6070u, 0.00000000 },
+  { 0x6085u, 0.00000000 },
+  { 0x6089u, 0.00010000 },
+  { 0x6094u, 0.00000000 },
+  { 0x609Fu, 0.00000000 },
+  { 0x60A0u, 0.00000000 },
+  { 0x60A8u, 0.00000000 },
+  { 0x60B2u, 0.00000000 },
+  { 0x60B6u, 0.00000000 },
+  { 0x60C5u, 0.00070000 },
+  { 0x60D1u, 0.00000000 },
+  { 0x60DCu, 0.00000000 },
+  { 0x60E0u, 0.00010000 },
+  { 0x60E1u, 0.00010000 },
+  { 0x60F1u, 0.00000000 },
+  { 0x60F3u, 0.00040000 },
+  { 0x60F9u, 0.00000000 },
+  { 0x6101u, 0.00000000 },
+  { 0x6108u, 0.00000000 },
+  { 0x6109u, 0.00000000 },
+  { 0x610Fu, 0.00120000 },
+  { 0x611Au, 0.00000000 },
+  { 0x611Bu, 0.00040000 },
+  { 0x611Fu, 0.00040000 },
+  { 0x6148u, 0.00010000 },
+  { 0x614Bu, 0.00020000 },
+  { 0x6155u, 0.00010000 },
+  { 0x6158u, 0.00000000 },
+  { 0x6162u, 0.00010000 },
+  { 0x6163u, 0.00000000 },
+  { 0x6167u, 0.00010000 },
+  { 0x616Eu, 0.00000000 },
+  { 0x6170u, 0.00000000 },
+  { 0x6176u, 0.00010000 },
+  { 0x617Eu, 0.00000000 },
+  { 0x6182u, 0.00000000 },
+  { 0x6190u, 0.00000000 },
+  { 0x6191u, 0.00000000 },
+  { 0x61B2u, 0.00010000 },
+  { 0x61B6u, 0.00010000 },
+  { 0x61BEu, 0.00000000 },
+  { 0x61C2u, 0.00000000 },
+  { 0x61C9u, 0.00050000 },
+  { 0x61F6u, 0.00000000 },
+  { 0x61F7u, 0.00010000 },
+  { 0x61FCu, 0.00000000 },
+  { 0x6200u, 0.00010000 },
+  { 0x6208u, 0.00010000 },
+  { 0x620Au, 0.00000000 },
+  { 0x620Cu, 0.00000000 },
+  { 0x6210u, 0.00490000 },
+  { 0x6211u, 0.00050000 },
+  { 0x6212u, 0.00010000 },
+  { 0x6216u, 0.00140000 },
+  { 0x622Au, 0.00010000 },
+  { 0x6230u, 0.00140000 },
+  { 0x6232u, 0.00040000 },
+  { 0x6234u, 0.00010000 },
+  { 0x6236u, 0.00020000 },
+  { 0x623Fu, 0.00030000 },
+  { 0x6240u, 0.00250000 },
+  { 0x6241u, 0.00000000 },
+  { 0x6247u, 0.00000000 },
+  { 0x624Bu, 0.00110000 },
+  { 0x624Du, 0.00050000 },
+  { 0x624Eu, 0.00010000 },
+  { 0x6253u, 0.00060000 },
+  { 0x6258u, 0.00040000 },
+  { 0x6263u, 0.00000000 },
+  { 0x6265u, 0.00000000 },
+  { 0x626Du, 0.00000000 },
+  { 0x626Fu, 0.00000000 },
+  { 0x6279u, 0.00030000 },
+  { 0x627Eu, 0.00020000 },
+  { 0x627Fu, 0.00040000 },
+  { 0x6280u, 0.00050000 },
+  { 0x6284u, 0.00000000 },
+  { 0x628Au, 0.00040000 },
+  { 0x6293u, 0.00000000 },
+  { 0x6295u, 0.00060000 },
+  { 0x6297u, 0.00030000 },
+  { 0x6298u, 0.00010000 },
+  { 0x62ABu, 0.00000000 },
+  { 0x62ACu, 0.00000000 },
+  { 0x62B1u, 0.00000000 },
+  { 0x62B5u, 0.00020000 },
+  { 0x62B9u, 0.00000000 },
+  { 0x62BDu, 0.00010000 },
+  { 0x62C6u, 0.00010000 },
+  { 0x62C9u, 0.00180000 },
+  { 0x62CBu, 0.00000000 },
+  { 0x62CDu, 0.00020000 },
+  { 0x62CFu, 0.00000000 },
+  { 0x62D2u, 0.00010000 },
+  { 0x62D4u, 0.00030000 },
+  { 0x62D6u, 0.00000000 },
+  { 0x62DBu, 0.00010000 },
+  { 0x62DCu, 0.00020000 },
+  { 0x62ECu, 0.00080000 },
+  { 0x62F3u, 0.00010000 },
+  { 0x62FCu, 0.00010000 },
+  { 0x62FEu, 0.00000000 },
+  { 0x62FFu, 0.00030000 },
+  { 0x6301u, 0.00090000 },
+  { 0x6307u, 0.00110000 },
+  { 0x6309u, 0.00020000 },
+  { 0x6311u, 0.00010000 },
+  { 0x6316u, 0.00000000 },
+  { 0x632Au, 0.00010000 },
+  { 0x632Fu, 0.00010000 },
+  { 0x633Au, 0.00000000 },
+  { 0x6350u, 0.00010000 },
+  { 0x6355u, 0.00020000 },
+  { 0x6368u, 0.00000000 },
+  { 0x6372u, 0.00000000 },
+  { 0x6377u, 0.00010000 },
+  { 0x6383u, 0.00000000 },
+  { 0x6388u, 0.00040000 },
+  { 0x6389u, 0.00010000 },
+  { 0x638Cu, 0.00010000 },
+  { 0x6392u, 0.00040000 },
+  { 0x639Bu, 0.00000000 },
+  { 0x63A1u, 0.00020000 },
+  { 0x63A2u, 0.00020000 },
+  { 0x63A5u, 0.00120000 },
+  { 0x63A7u, 0.00040000 },
+  { 0x63A8u, 0.00060000 },
+  { 0x63AAu, 0.00010000 },
+  { 0x63CFu, 0.00020000 },
+  { 0x63D0u, 0.00130000 },
+  { 0x63D2u, 0.00010000 },
+  { 0x63DAu, 0.00010000 },
+  { 0x63DBu, 0.00020000 },
+  { 0x63E1u, 0.00010000 },
+  { 0x63EEu, 0.00010000 },
+  { 0x63F4u, 0.00020000 },
+  { 0x640Du, 0.00010000 },
+  { 0x6416u, 0.00000000 },
+  { 0x641Cu, 0.00010000 },
+  { 0x641Eu, 0.00000000 },
+  { 0x642Cu, 0.00010000 },
+  { 0x642Du, 0.00010000 },
+  { 0x6436u, 0.00000000 },
+  { 0x6458u, 0.00000000 },
+  { 0x6469u, 0.00030000 },
+  { 0x6478u, 0.00000000 },
+  { 0x6490u, 0.00000000 },
+  { 0x6492u, 0.00010000 },
+  { 0x649Eu, 0.00010000 },
+  { 0x64A3u, 0.00000000 },
+  { 0x64A5u, 0.00000000 },
+  { 0x64ADu, 0.00060000 },
+  { 0x64BEu, 0.00000000 },
+  { 0x64BFu, 0.00000000 },
+  { 0x64C1u, 0.00020000 },
+  { 0x64C7u, 0.00010000 },
+  { 0x64CAu, 0.00060000 },
+  { 0x64CBu, 0.00000000 },
+  { 0x64CDu, 0.00020000 },
+  { 0x64CEu, 0.00010000 },
+  { 0x64D4u, 0.00030000 },
+  { 0x64DAu, 0.00040000 },
+  { 0x64E0u, 0.00000000 },
+  { 0x64E6u, 0.00000000 },
+  { 0x64ECu, 0.00010000 },
+  { 0x64F4u, 0.00010000 },
+  { 0x64FAu, 0.00000000 },
+  { 0x64FEu, 0.00000000 },
+  { 0x651Du, 0.00010000 },
+  { 0x652Fu, 0.00080000 },
+  { 0x6536u, 0.00070000 },
+  { 0x6539u, 0.00130000 },
+  { 0x653Bu, 0.00060000 },
+  { 0x653Eu, 0.00080000 },
+  { 0x653Fu, 0.00290000 },
+  { 0x6545u, 0.00050000 },
+  { 0x6548u, 0.00040000 },
+  { 0x654Du, 0.00000000 },
+  { 0x654Fu, 0.00010000 },
+  { 0x6551u, 0.00020000 },
+  { 0x6557u, 0.00030000 },
+  { 0x6558u, 0.00000000 },
+  { 0x6559u, 0.00210000 },
+  { 0x655Du, 0.00000000 },
+  { 0x6562u, 0.00000000 },
+  { 0x6563u, 0.00020000 },
+  { 0x6566u, 0.00020000 },
+  { 0x656Cu, 0.00010000 },
+  { 0x6574u, 0.00050000 },
+  { 0x6575u, 0.00010000 },
+  { 0x6578u, 0.00100000 },
+  { 0x6587u, 0.00270000 },
+  { 0x6590u, 0.00000000 },
+  { 0x6597u, 0.00010000 },
+  { 0x6599u, 0.00040000 },
+  { 0x65AFu, 0.00370000 },
+  { 0x65B0u, 0.00250000 },
+  { 0x65B7u, 0.00020000 },
+  { 0x65B9u, 0.00320000 },
+  { 0x65BCu, 0.00490000 },
+  { 0x65BDu, 0.00040000 },
+  { 0x65C1u, 0.00010000 },
+  { 0x65C5u, 0.00030000 },
+  { 0x65CBu, 0.00020000 },
+  { 0x65CFu, 0.00080000 },
+  { 0x65D7u, 0.00030000 },
+  { 0x65E2u, 0.00010000 },
+  { 0x65E5u, 0.00550000 },
+  { 0x65E6u, 0.00010000 },
+  { 0x65E9u, 0.00060000 },
+  { 0x65EDu, 0.00000000 },
+  { 0x65FAu, 0.00010000 },
+  { 0x6602u, 0.00010000 },
+  { 0x6606u, 0.00010000 },
+  { 0x6607u, 0.00000000 },
+  { 0x660Cu, 0.00020000 },
+  { 0x660Eu, 0.00140000 },
+  { 0x660Fu, 0.00000000 },
+  { 0x6613u, 0.00050000 },
+  { 0x661Fu, 0.00140000 },
+  { 0x6620u, 0.00020000 },
+  { 0x6625u, 0.00030000 },
+  { 0x6628u, 0.00000000 },
+  { 0x662Du, 0.00010000 },
+  { 0x662Fu, 0.01120000 },
+  { 0x6642u, 0.00320000 },
+  { 0x6649u, 0.00010000 },
+  { 0x6652u, 0.00000000 },
+  { 0x665Au, 0.00030000 },
+  { 0x6668u, 0.00010000 },
+  { 0x666Eu, 0.00070000 },
+  { 0x666Fu, 0.00040000 },
+  { 0x6674u, 0.00000000 },
+  { 0x6676u, 0.00010000 },
+  { 0x667Au, 0.00020000 },
+  { 0x6691u, 0.00000000 },
+  { 0x6696u, 0.00000000 },
+  { 0x6697u, 0.00010000 },
+  { 0x66ABu, 0.00010000 },
+  { 0x66B4u, 0.00020000 },
+  { 0x66C6u, 0.00010000 },
+  { 0x66C9u, 0.00000000 },
+  { 0x66F0u, 0.00000000 },
+  { 0x66F2u, 0.00080000 },
+  { 0x66F4u, 0.00100000 },
+  { 0x66F8u, 0.00060000 },
+  { 0x66FCu, 0.00040000 },
+  { 0x66FEu, 0.00110000 },
+  { 0x66FFu, 0.00020000 },
+  { 0x6700u, 0.00260000 },
+  { 0x6703u, 0.00280000 },
+  { 0x6708u, 0.00520000 },
+  { 0x6709u, 0.00790000 },
+  { 0x670Bu, 0.00010000 },
+  { 0x670Du, 0.00060000 },
+  { 0x6717u, 0.00030000 },
+  { 0x671Bu, 0.00030000 },
+  { 0x671Du, 0.00090000 },
+  { 0x671Fu, 0.00200000 },
+  { 0x6728u, 0.00040000 },
+  { 0x672Au, 0.00070000 },
+  { 0x672Bu, 0.00030000 },
+  { 0x672Cu, 0.00310000 },
+  { 0x672Du, 0.00000000 },
+  { 0x6731u, 0.00020000 },
+  { 0x6735u, 0.00000000 },
+  { 0x6749u, 0.00010000 },
+  { 0x674Eu, 0.00060000 },
+  { 0x6750u, 0.00020000 },
+  { 0x6751u, 0.00060000 },
+  { 0x675Cu, 0.00020000 },
+  { 0x675Fu, 0.00030000 },
+  { 0x676Fu, 0.00010000 },
+  { 0x6770u, 0.00010000 },
+  { 0x6771u, 0.00120000 },
+  { 0x677Eu, 0.00020000 },
+  { 0x677Fu, 0.00020000 },
+  { 0x6790u, 0.00010000 },
+  { 0x6797u, 0.00120000 },
+  { 0x679Cu, 0.00070000 },
+  { 0x679Du, 0.00010000 },
+  { 0x67B6u, 0.00030000 },
+  { 0x67CFu, 0.00020000 },
+  { 0x67D0u, 0.00020000 },
+  { 0x67D3u, 0.00010000 },
+  { 0x67D4u, 0.00010000 },
+  { 0x67E5u, 0.00050000 },
+  { 0x67ECu, 0.00000000 },
+  { 0x67EFu, 0.00010000 },
+  { 0x67F3u, 0.00010000 },
+  { 0x67F4u, 0.00010000 },
+  { 0x6821u, 0.00100000 },
+  { 0x6838u, 0.00030000 },
+  { 0x6839u, 0.00070000 },
+  { 0x683Cu, 0.00130000 },
+  { 0x6843u, 0.00010000 },
+  { 0x6848u, 0.00050000 },
+  { 0x684Cu, 0.00000000 },
+  { 0x6851u, 0.00010000 },
+  { 0x6881u, 0.00020000 },
+  { 0x6885u, 0.00030000 },
+  { 0x689Du, 0.00050000 },
+  { 0x68A8u, 0.00000000 },
+  { 0x68AFu, 0.00010000 },
+  { 0x68B0u, 0.00010000 },
+  { 0x68B5u, 0.00000000 },
+  { 0x68C4u, 0.00010000 },
+  { 0x68C9u, 0.00000000 },
+  { 0x68CBu, 0.00010000 },
+  { 0x68D2u, 0.00010000 },
+  { 0x68DAu, 0.00000000 },
+  { 0x68EEu, 0.00040000 },
+  { 0x6905u, 0.00000000 },
+  { 0x690Du, 0.00040000 },
+  { 0x6930u, 0.00000000 },
+  { 0x694Au, 0.00010000 },
+  { 0x6953u, 0.00000000 },
+  { 0x695Au, 0.00010000 },
+  { 0x696Du, 0.00100000 },
+  { 0x6975u, 0.00030000 },
+  { 0x6982u, 0.00020000 },
+  { 0x699Cu, 0.00010000 },
+  { 0x69AEu, 0.00010000 },
+  { 0x69CBu, 0.00030000 },
+  { 0x69CDu, 0.00020000 },
+  { 0x6A02u, 0.00070000 },
+  { 0x6A13u, 0.00020000 },
+  { 0x6A19u, 0.00050000 },
+  { 0x6A1Eu, 0.00000000 },
+  { 0x6A21u, 0.00050000 },
+  { 0x6A23u, 0.00030000 },
+  { 0x6A39u, 0.00010000 },
+  { 0x6A4Bu, 0.00020000 },
+  { 0x6A5Fu, 0.00130000 },
+  { 0x6A6Bu, 0.00010000 },
+  { 0x6A80u, 0.00000000 },
+  { 0x6A94u, 0.00010000 },
+  { 0x6AA2u, 0.00010000 },
+  { 0x6B04u, 0.00000000 },
+  { 0x6B0Au, 0.00040000 },
+  { 0x6B21u, 0.00190000 },
+  { 0x6B23u, 0.00000000 },
+  { 0x6B32u, 0.00010000 },
+  { 0x6B3Au, 0.00000000 },
+  { 0x6B3Du, 0.00000000 },
+  { 0x6B3Eu, 0.00020000 },
+  { 0x6B49u, 0.00000000 },
+  { 0x6B4Cu, 0.00070000 },
+  { 0x6B50u, 0.00040000 },
+  { 0x6B61u, 0.00010000 },
+  { 0x6B62u, 0.00040000 },
+  { 0x6B63u, 0.00140000 },
+  { 0x6B64u, 0.00220000 },
+  { 0x6B65u, 0.00040000 },
+  { 0x6B66u, 0.00070000 },
+  { 0x6B72u, 0.00030000 },
+  { 0x6B77u, 0.00040000 },
+  { 0x6B78u, 0.00010000 },
+  { 0x6B7Bu, 0.00060000 },
+  { 0x6B8Au, 0.00010000 },
+  { 0x6B98u, 0.00010000 },
+  { 0x6BB5u, 0.00060000 },
+  { 0x6BBAu, 0.00030000 },
+  { 0x6BBCu, 0.00000000 },
+  { 0x6BC0u, 0.00010000 },
+  { 0x6BC5u, 0.00000000 },
+  { 0x6BCDu, 0.00050000 },
+  { 0x6BCFu, 0.00070000 },
+  { 0x6BD2u, 0.00020000 },
+  { 0x6BD4u, 0.00160000 },
+  { 0x6BDBu, 0.00030000 },
+  { 0x6BEBu, 0.00010000 },
+  { 0x6C0Fu, 0.00040000 },
+  { 0x6C11u, 0.00270000 },
+  { 0x6C23u, 0.00040000 },
+  { 0x6C34u, 0.00140000 },
+  { 0x6C38u, 0.00030000 },
+  { 0x6C42u, 0.00050000 },
+  { 0x6C57u, 0.00010000 },
+  { 0x6C5Du, 0.00000000 },
+  { 0x6C5Fu, 0.00100000 },
+  { 0x6C60u, 0.00010000 },
+  { 0x6C61u, 0.00010000 },
+  { 0x6C6Au, 0.00000000 },
+  { 0x6C76u, 0.00000000 },
+  { 0x6C7Au, 0.00040000 },
+  { 0x6C7Du, 0.00020000 },
+  { 0x6C83u, 0.00020000 },
+  { 0x6C88u, 0.00010000 },
+  { 0x6C89u, 0.00010000 },
+  { 0x6C92u, 0.00050000 },
+  { 0x6C96u, 0.00000000 },
+  { 0x6C99u, 0.00050000 },
+  { 0x6CB3u, 0.00110000 },
+  { 0x6CB9u, 0.00030000 },
+  { 0x6CBBu, 0.00130000 },
+  { 0x6CBFu, 0.00020000 },
+  { 0x6CC1u, 0.00020000 },
+  { 0x6CC9u, 0.00010000 },
+  { 0x6CCAu, 0.00010000 },
+  { 0x6CD5u, 0.00280000 },
+  { 0x6CE1u, 0.00000000 },
+  { 0x6CE2u, 0.00080000 },
+  { 0x6CE5u, 0.00010000 },
+  { 0x6CE8u, 0.00030000 },
+  { 0x6CF0u, 0.00040000 },
+  { 0x6CF3u, 0.00010000 },
+  { 0x6D0Bu, 0.00040000 },
+  { 0x6D17u, 0.00010000 },
+  { 0x6D1Bu, 0.00050000 },
+  { 0x6D1Eu, 0.00010000 },
+  { 0x6D29u, 0.00000000 },
+  { 0x6D2Au, 0.00020000 },
+  { 0x6D32u, 0.00090000 },
+  { 0x6D3Bu, 0.00080000 },
+  { 0x6D3Du, 0.00000000 },
+  { 0x6D3Eu, 0.00060000 },
+  { 0x6D41u, 0.00110000 },
+  { 0x6D66u, 0.00010000 },
+  { 0x6D69u, 0.00010000 },
+  { 0x6D6Au, 0.00010000 },
+  { 0x6D6Eu, 0.00010000 },
+  { 0x6D77u, 0.00240000 },
+  { 0x6D87u, 0.00000000 },
+  { 0x6D88u, 0.00040000 },
+  { 0x6D89u, 0.00010000 },
+  { 0x6DAFu, 0.00010000 },
+  { 0x6DB2u, 0.00010000 },
+  { 0x6DB5u, 0.00000000 },
+  { 0x6DBCu, 0.00000000 },
+  { 0x6DD1u, 0.00000000 },
+  { 0x6DDAu, 0.00000000 },
+  { 0x6DE1u, 0.00010000 },
+  { 0x6DE8u, 0.00000000 },
+  { 0x6DF1u, 0.00050000 },
+  { 0x6DF7u, 0.00020000 },
+  { 0x6DFAu, 0.00000000 },
+  { 0x6E05u, 0.00080000 },
+  { 0x6E1Bu, 0.00010000 },
+  { 0x6E21u, 0.00010000 },
+  { 0x6E2Cu, 0.00020000 },
+  { 0x6E2Fu, 0.00160000 },
+  { 0x6E38u, 0.00040000 },
+  { 0x6E56u, 0.00060000 },
+  { 0x6E6Fu, 0.00010000 },
+  { 0x6E90u, 0.00060000 },
+  { 0x6E96u, 0.00020000 },
+  { 0x6E9Du, 0.00000000 },
+  { 0x6EAAu, 0.00020000 },
+  { 0x6EABu, 0.00020000 },
+  { 0x6EC4u, 0.00000000 },
+  { 0x6EC5u, 0.00010000 },
+  { 0x6ECBu, 0.00000000 },
+  { 0x6ED1u, 0.00010000 },
+  { 0x6EF4u, 0.00000000 },
+  { 0x6EFEu, 0.00000000 },
+  { 0x6EFFu, 0.00020000 },
+  { 0x6F02u, 0.00000000 },
+  { 0x6F0Fu, 0.00000000 },
+  { 0x6F14u, 0.00110000 },
+  { 0x6F20u, 0.00000000 },
+  { 0x6F22u, 0.00030000 },
+  { 0x6F2Bu, 0.00020000 },
+  { 0x6F32u, 0.00000000 },
+  { 0x6F38u, 0.00010000 },
+  { 0x6F54u, 0.00000000 },
+  { 0x6F58u, 0.00010000 },
+  { 0x6F5Bu, 0.00010000 },
+  { 0x6F6Eu, 0.00020000 },
+  { 0x6FA4u, 0.00010000 },
+  { 0x6FB3u, 0.00040000 },
+  { 0x6FC0u, 0.00020000 },
+  { 0x6FC3u, 0.00000000 },
+  { 0x6FDFu, 0.00020000 },
+  { 0x6FE4u, 0.00000000 },
+  { 0x6FEBu, 0.00000000 },
+  { 0x6FF1u, 0.00010000 },
+  { 0x700Fu, 0.00000000 },
+  { 0x704Cu, 0.00010000 },
+  { 0x7063u, 0.00100000 },
+  { 0x706Bu, 0.00060000 },
+  { 0x7070u, 0.00010000 },
+  { 0x707Du, 0.00010000 },
+  { 0x708Eu, 0.00010000 },
+  { 0x70AEu, 0.00010000 },
+  { 0x70B8u, 0.00020000 },
+  { 0x70BAu, 0.00640000 },
+  { 0x70C8u, 0.00020000 },
+  { 0x70CFu, 0.00010000 },
+  { 0x70E4u, 0.00000000 },
+  { 0x7121u, 0.00070000 },
+  { 0x7126u, 0.00010000 },
+  { 0x7136u, 0.00120000 },
+  { 0x7159u, 0.00010000 },
+  { 0x715Eu, 0.00000000 },
+  { 0x7167u, 0.00030000 },
+  { 0x7169u, 0.00000000 },
+  { 0x718Au, 0.00010000 },
+  { 0x719Fu, 0.00010000 },
+  { 0x71B1u, 0.00030000 },
+  { 0x71C3u, 0.00010000 },
+  { 0x71C8u, 0.00010000 },
+  { 0x71D2u, 0.00010000 },
+  { 0x71DFu, 0.00030000 },
+  { 0x7206u, 0.00020000 },
+  { 0x7210u, 0.00000000 },
+  { 0x721Bu, 0.00000000 },
+  { 0x722Au, 0.00000000 },
+  { 0x722Cu, 0.00000000 },
+  { 0x722Du, 0.00040000 },
+  { 0x7235u, 0.00020000 },
+  { 0x7236u, 0.00040000 },
+  { 0x7238u, 0.00000000 },
+  { 0x723Au, 0.00000000 },
+  { 0x723Du, 0.00000000 },
+  { 0x723Eu, 0.00130000 },
+  { 0x7246u, 0.00000000 },
+  { 0x7247u, 0.00070000 },
+  { 0x7248u, 0.00090000 },
+  { 0x724Cu, 0.00030000 },
+  { 0x7259u, 0.00040000 },
+  { 0x725Bu, 0.00020000 },
+  { 0x7260u, 0.00010000 },
+  { 0x7267u, 0.00010000 },
+  { 0x7269u, 0.00230000 },
+  { 0x7272u, 0.00000000 },
+  { 0x7279u, 0.00250000 },
+  { 0x727Du, 0.00000000 },
+  { 0x72A7u, 0.00000000 },
+  { 0x72AFu, 0.00010000 },
+  { 0x72C0u, 0.00020000 },
+  { 0x72C2u, 0.00000000 },
+  { 0x72D0u, 0.00000000 },
+  { 0x72D7u, 0.00010000 },
+  { 0x72E0u, 0.00000000 },
+  { 0x72FCu, 0.00000000 },
+  { 0x731Bu, 0.00000000 },
+  { 0x731Cu, 0.00000000 },
+  { 0x7334u, 0.00000000 },
+  { 0x7336u, 0.00010000 },
+  { 0x7344u, 0.00010000 },
+  { 0x7345u, 0.00000000 },
+  { 0x734Eu, 0.00040000 },
+  { 0x7368u, 0.00030000 },
+  { 0x7372u, 0.00050000 },
+  { 0x7378u, 0.00010000 },
+  { 0x737Bu, 0.00010000 },
+  { 0x7384u, 0.00010000 },
+  { 0x7387u, 0.00060000 },
+  { 0x7389u, 0.00020000 },
+  { 0x738Bu, 0.00150000 },
+  { 0x73A9u, 0.00020000 },
+  { 0x73ABu, 0.00000000 },
+  { 0x73B2u, 0.00000000 },
+  { 0x73BBu, 0.00010000 },
+  { 0x73CAu, 0.00010000 },
+  { 0x73CDu, 0.00010000 },
+  { 0x73E0u, 0.00010000 },
+  { 0x73E5u, 0.00000000 },
+  { 0x73EDu, 0.00050000 },
+  { 0x73FEu, 0.00140000 },
+  { 0x7403u, 0.00210000 },
+  { 0x7406u, 0.00200000 },
+  { 0x7409u, 0.00010000 },
+  { 0x742Au, 0.00000000 },
+  { 0x7434u, 0.00010000 },
+  { 0x7459u, 0.00000000 },
+  { 0x745Cu, 0.00000000 },
+  { 0x745Eu, 0.00030000 },
+  { 0x745Fu, 0.00010000 },
+  { 0x7464u, 0.00000000 },
+  { 0x746Au, 0.00010000 },
+  { 0x7470u, 0.00000000 },
+  { 0x74B0u, 0.00030000 },
+  { 0x74DCu, 0.00010000 },
+  { 0x74E6u, 0.00040000 },
+  { 0x74F6u, 0.00000000 },
+  { 0x7518u, 0.00010000 },
+  { 0x751Au, 0.00030000 },
+  { 0x751Cu, 0.00000000 },
+  { 0x751Fu, 0.00380000 },
+  { 0x7522u, 0.00060000 },
+  { 0x7528u, 0.00350000 },
+  { 0x7530u, 0.00050000 },
+  { 0x7531u, 0.00330000 },
+  { 0x7532u, 0.00040000 },
+  { 0x7533u, 0.00010000 },
+  { 0x7537u, 0.00040000 },
+  { 0x7538u, 0.00010000 },
+  { 0x754Cu, 0.00130000 },
+  { 0x7559u, 0.00040000 },
+  { 0x7562u, 0.00020000 },
+  { 0x7565u, 0.00020000 },
+  { 0x756Au, 0.00010000 },
+  { 0x756Bu, 0.00050000 },
+  { 0x7570u, 0.00020000 },
+  { 0x7576u, 0.00140000 },
+  { 0x7586u, 0.00010000 },
+  { 0x758Fu, 0.00010000 },
+  { 0x7591u, 0.00010000 },
+  { 0x75BCu, 0.00000000 },
+  { 0x75C5u, 0.00040000 },
+  { 0x75D5u, 0.00000000 },
+  { 0x75DBu, 0.00010000 },
+  { 0x75F4u, 0.00000000 },
+  { 0x760Bu, 0.00000000 },
+  { 0x7642u, 0.00010000 },
+  { 0x7661u, 0.00000000 },
+  { 0x7678u, 0.00000000 },
+  { 0x767Bu, 0.00040000 },
+  { 0x767Cu, 0.00210000 },
+  { 0x767Du, 0.00070000 },
+  { 0x767Eu, 0.00050000 },
+  { 0x7684u, 0.03830000 },
+  { 0x7686u, 0.00020000 },
+  { 0x7687u, 0.00060000 },
+  { 0x76AEu, 0.00030000 },
+  { 0x76C3u, 0.00010000 },
+  { 0x76CAu, 0.00020000 },
+  { 0x76DBu, 0.00020000 },
+  { 0x76DCu, 0.00000000 },
+  { 0x76DFu, 0.00050000 },
+  { 0x76E1u, 0.00010000 },
+  { 0x76E3u, 0.00020000 },
+  { 0x76E4u, 0.00010000 },
+  { 0x76E7u, 0.00010000 },
+  { 0x76EEu, 0.00160000 },
+  { 0x76F2u, 0.00000000 },
+  { 0x76F4u, 0.00110000 },
+  { 0x76F8u, 0.00160000 },
+  { 0x76FCu, 0.00000000 },
+  { 0x76FEu, 0.00010000 },
+  { 0x7701u, 0.00130000 },
+  { 0x7709u, 0.00000000 },
+  { 0x770Bu, 0.00040000 },
+  { 0x771Fu, 0.00040000 },
+  { 0x7720u, 0.00000000 },
+  { 0x773Cu, 0.00020000 },
+  { 0x773Eu, 0.00030000 },
+  { 0x775Bu, 0.00000000 },
+  { 0x7761u, 0.00000000 },
+  { 0x7763u, 0.00040000 },
+  { 0x77A7u, 0.00000000 },
+  { 0x77ADu, 0.00000000 },
+  { 0x77DBu, 0.00000000 },
+  { 0x77E3u, 0.00000000 },
+  { 0x77E5u, 0.00070000 },
+  { 0x77EDu, 0.00030000 },
+  { 0x77F3u, 0.00080000 },
+  { 0x7802u, 0.00000000 },
+  { 0x780Du, 0.00000000 },
+  { 0x7814u, 0.00080000 },
+  { 0x7832u, 0.00010000 },
+  { 0x7834u, 0.00030000 },
+  { 0x786Cu, 0.00010000 },
+  { 0x788Eu, 0.00010000 },
+  { 0x7897u, 0.00000000 },
+  { 0x789Fu, 0.00010000 },
+  { 0x78A7u, 0.00000000 },
+  { 0x78A9u, 0.00000000 },
+  { 0x78B0u, 0.00000000 },
+  { 0x78BAu, 0.00020000 },
+  { 0x78BCu, 0.00020000 },
+  { 0x78C1u, 0.00010000 },
+  { 0x78E8u, 0.00000000 },
+  { 0x78EFu, 0.00000000 },
+  { 0x790Eu, 0.00010000 },
+  { 0x7919u, 0.00000000 },
+  { 0x793Au, 0.00080000 },
+  { 0x793Eu, 0.00090000 },
+  { 0x7955u, 0.00000000 },
+  { 0x7956u, 0.00030000 },
+  { 0x795Au, 0.00000000 },
+  { 0x795Bu, 0.00000000 },
+  { 0x795Du, 0.00010000 },
+  { 0x795Eu, 0.00080000 },
+  { 0x7965u, 0.00010000 },
+  { 0x7968u, 0.00030000 },
+  { 0x797Fu, 0.00000000 },
+  { 0x7981u, 0.00020000 },
+  { 0x798Du, 0.00000000 },
+  { 0x798Eu, 0.00000000 },
+  { 0x798Fu, 0.00060000 },
+  { 0x79AAu, 0.00000000 },
+  { 0x79AEu, 0.00020000 },
+  { 0x79C0u, 0.00020000 },
+  { 0x79C1u, 0.00020000 },
+  { 0x79CBu, 0.00020000 },
+  { 0x79D1u, 0.00170000 },
+  { 0x79D2u, 0.00010000 },
+  { 0x79D8u, 0.00020000 },
+  { 0x79DFu, 0.00010000 },
+  { 0x79E4u, 0.00000000 },
+  { 0x79E6u, 0.00010000 },
+  { 0x79FBu, 0.00040000 },
+  { 0x7A05u, 0.00010000 },
+  { 0x7A0Bu, 0.00110000 },
+  { 0x7A0Du, 0.00010000 },
+  { 0x7A2Eu, 0.00100000 },
+  { 0x7A31u, 0.00110000 },
+  { 0x7A3Fu, 0.00010000 },
+  { 0x7A46u, 0.00020000 },
+  { 0x7A4Cu, 0.00000000 },
+  { 0x7A4Du, 0.00040000 },
+  { 0x7A69u, 0.00010000 },
+  { 0x7A76u, 0.00070000 },
+  { 0x7A79u, 0.00000000 },
+  { 0x7A7Au, 0.00100000 },
+  { 0x7A7Fu, 0.00020000 },
+  { 0x7A81u, 0.00030000 },
+  { 0x7A97u, 0.00010000 },
+  { 0x7AA9u, 0.00000000 },
+  { 0x7AAEu, 0.00000000 },
+  { 0x7AB6u, 0.00000000 },
+  { 0x7ACBu, 0.00220000 },
+  { 0x7AD9u, 0.00130000 },
+  { 0x7ADFu, 0.00000000 },
+  { 0x7AE0u, 0.00030000 },
+  { 0x7AE5u, 0.00020000 },
+  { 0x7AEFu, 0.00030000 },
+  { 0x7AF6u, 0.00010000 },
+  { 0x7AF9u, 0.00010000 },
+  { 0x7B11u, 0.00010000 },
+  { 0x7B1Bu, 0.00000000 },
+  { 0x7B26u, 0.00020000 },
+  { 0x7B28u, 0.00000000 },
+  { 0x7B2Cu, 0.00320000 },
+  { 0x7B46u, 0.00010000 },
+  { 0x7B49u, 0.00250000 },
+  { 0x7B4Bu, 0.00000000 },
+  { 0x7B54u, 0.00010000 },
+  { 0x7B56u, 0.00030000 },
+  { 0x7B97u, 0.00040000 },
+  { 0x7BA1u, 0.00090000 },
+  { 0x7BADu, 0.00010000 },
+  { 0x7BB1u, 0.00010000 },
+  { 0x7BC0u, 0.00050000 },
+  { 0x7BC4u, 0.00020000 },
+  { 0x7BC7u, 0.00020000 },
+  { 0x7BC9u, 0.00020000 },
+  { 0x7C21u, 0.00020000 },
+  { 0x7C2Bu, 0.00000000 },
+  { 0x7C3Du, 0.00010000 },
+  { 0x7C3Fu, 0.00000000 },
+  { 0x7C43u, 0.00000000 },
+  { 0x7C4Cu, 0.00010000 },
+  { 0x7C4Du, 0.00020000 },
+  { 0x7C64u, 0.00000000 },
+  { 0x7C73u, 0.00150000 },
+  { 0x7C89u, 0.00010000 },
+  { 0x7C97u, 0.00010000 },
+  { 0x7CB5u, 0.00010000 },
+  { 0x7CBEu, 0.00040000 },
+  { 0x7CCAu, 0.00000000 },
+  { 0x7CD5u, 0.00000000 },
+  { 0x7CDFu, 0.00000000 },
+  { 0x7CFBu, 0.00150000 },
+  { 0x7CFEu, 0.00000000 },
+  { 0x7D00u, 0.00050000 },
+  { 0x7D04u, 0.00090000 },
+  { 0x7D05u, 0.00030000 },
+  { 0x7D0Du, 0.00040000 },
+  { 0x7D10u, 0.00010000 },
+  { 0x7D14u, 0.00010000 },
+  { 0x7D19u, 0.00010000 },
+  { 0x7D1Au, 0.00050000 },
+  { 0x7D1Bu, 0.00010000 },
+  { 0x7D20u, 0.00040000 },
+  { 0x7D22u, 0.00030000 },
+  { 0x7D2Bu, 0.00010000 },
+  { 0x7D2Fu, 0.00010000 },
+  { 0x7D30u, 0.00020000 },
+  { 0x7D39u, 0.00010000 },
+  { 0x7D42u, 0.00030000 },
+  { 0x7D44u, 0.00080000 },
+  { 0x7D50u, 0.00060000 },
+  { 0x7D55u, 0.00020000 },
+  { 0x7D61u, 0.00010000 },
+  { 0x7D66u, 0.00030000 },
+  { 0x7D71u, 0.00080000 },
+  { 0x7D72u, 0.00010000 },
+  { 0x7D93u, 0.00140000 },
+  { 0x7D9Cu, 0.00010000 },
+  { 0x7DA0u, 0.00010000 },
+  { 0x7DADu, 0.00050000 },
+  { 0x7DB1u, 0.00010000 },
+  { 0x7DB2u, 0.00040000 },
+  { 0x7DCAu, 0.00010000 },
+  { 0x7DD2u, 0.00010000 },
+  { 0x7DDAu, 0.00100000 },
+  { 0x7DE3u, 0.00010000 },
+  { 0x7DE8u, 0.00040000 },
+  { 0x7DE9u, 0.00000000 },
+  { 0x7DECu, 0.00000000 },
+  { 0x7DEFu, 0.00020000 },
+  { 0x7DF4u, 0.00020000 },
+  { 0x7E1Bu, 0.00000000 },
+  { 0x7E23u, 0.00070000 },
+  { 0x7E2Eu, 0.00010000 },
+  { 0x7E31u, 0.00000000 },
+  { 0x7E3Du, 0.00080000 },
+  { 0x7E3Eu, 0.00010000 },
+  { 0x7E41u, 0.00010000 },
+  { 0x7E46u, 0.00000000 },
+  { 0x7E54u, 0.00020000 },
+  { 0x7E5Eu, 0.00010000 },
+  { 0x7E6Au, 0.00010000 },
+  { 0x7E73u, 0.00000000 },
+  { 0x7E7Cu, 0.00030000 },
+  { 0x7E8Cu, 0.00040000 },
+  { 0x7F38u, 0.00000000 },
+  { 0x7F3Au, 0.00020000 },
+  { 0x7F55u, 0.00010000 },
+  { 0x7F6Au, 0.00020000 },
+  { 0x7F6Eu, 0.00060000 },
+  { 0x7F70u, 0.00000000 },
+  { 0x7F72u, 0.00020000 },
+  { 0x7F75u, 0.00000000 },
+  { 0x7F77u, 0.00000000 },
+  { 0x7F85u, 0.00080000 },
+  { 0x7F8Au, 0.00010000 },
+  { 0x7F8Eu, 0.00220000 },
+  { 0x7F9Eu, 0.00000000 },
+  { 0x7FA4u, 0.00050000 },
+  { 0x7FA9u, 0.00060000 },
+  { 0x7FBDu, 0.00010000 },
+  { 0x7FC1u, 0.00010000 },
+  { 0x7FD2u, 0.00020000 },
+  { 0x7FD4u, 0.00000000 },
+  { 0x7FF0u, 0.00020000 },
+  { 0x7FF9u, 0.00000000 },
+  { 0x7FFBu, 0.00020000 },
+  { 0x7FFCu, 0.00020000 },
+  { 0x8000u, 0.00010000 },
+  { 0x8001u, 0.00040000 },
+  { 0x8003u, 0.00050000 },
+  { 0x8005u, 0.00170000 },
+  { 0x800Cu, 0.00330000 },
+  { 0x800Du, 0.00000000 },
+  { 0x8010u, 0.00000000 },
+  { 0x8017u, 0.00010000 },
+  { 0x8033u, 0.00020000 },
+  { 0x8036u, 0.00020000 },
+  { 0x804Au, 0.00000000 },
+  { 0x8056u, 0.00030000 },
+  { 0x805Au, 0.00020000 },
+  { 0x805Eu, 0.00020000 },
+  { 0x806Fu, 0.00090000 },
+  { 0x8070u, 0.00000000 },
+  { 0x8072u, 0.00030000 },
+  { 0x8077u, 0.00040000 },
+  { 0x807Du, 0.00010000 },
+  { 0x8089u, 0.00010000 },
+  { 0x809Au, 0.00000000 },
+  { 0x80A1u, 0.00030000 },
+  { 0x80A5u, 0.00010000 },
+  { 0x80A9u, 0.00000000 },
+  { 0x80AFu, 0.00010000 },
+  { 0x80B2u, 0.00060000 },
+  { 0x80CCu, 0.00020000 },
+  { 0x80CEu, 0.00010000 },
+  { 0x80D6u, 0.00000000 },
+  { 0x80DEu, 0.00010000 },
+  { 0x80E1u, 0.00020000 },
+  { 0x80F8u, 0.00000000 },
+  { 0x80FDu, 0.00210000 },
+  { 0x8106u, 0.00000000 },
+  { 0x812Bu, 0.00010000 },
+  { 0x8153u, 0.00000000 },
+  { 0x8154u, 0.00000000 },
+  { 0x8166u, 0.00010000 },
+  { 0x8170u, 0.00000000 },
+  { 0x8173u, 0.00010000 },
+  { 0x817Fu, 0.00000000 },
+  { 0x81BDu, 0.00000000 },
+  { 0x81C9u, 0.00000000 },
+  { 0x81D8u, 0.00010000 },
+  { 0x81E3u, 0.00020000 },
+  { 0x81E5u, 0.00000000 },
+  { 0x81E8u, 0.00010000 },
+  { 0x81EAu, 0.00260000 },
+  { 0x81EDu, 0.00000000 },
+  { 0x81F3u, 0.00220000 },
+  { 0x81F4u, 0.00050000 },
+  { 0x81FAu, 0.00030000 },
+  { 0x8207u, 0.00250000 },
+  { 0x8208u, 0.00030000 },
+  { 0x8209u, 0.00050000 },
+  { 0x820Au, 0.00020000 },
+  { 0x820Cu, 0.00000000 },
+  { 0x820Du, 0.00010000 },
+  { 0x8212u, 0.00010000 },
+  { 0x821Eu, 0.00020000 },
+  { 0x821Fu, 0.00000000 },
+  { 0x822Au, 0.00060000 },
+  { 0x822Cu, 0.00040000 },
+  { 0x8239u, 0.00030000 },
+  { 0x8266u, 0.00030000 },
+  { 0x826Fu, 0.00020000 },
+  { 0x8272u, 0.00120000 },
+  { 0x827Eu, 0.00030000 },
+  { 0x829Du, 0.00010000 },
+  { 0x82ACu, 0.00010000 },
+  { 0x82B1u, 0.00060000 },
+  { 0x82B3u, 0.00010000 },
+  { 0x82E5u, 0.00020000 },
+  { 0x82E6u, 0.00010000 },
+  { 0x82F1u, 0.00160000 },
+  { 0x8305u, 0.00000000 },
+  { 0x832Bu, 0.00000000 },
+  { 0x8332u, 0.00010000 },
+  { 0x8336u, 0.00010000 },
+  { 0x8349u, 0.00040000 },
+  { 0x8352u, 0.00010000 },
+  { 0x8377u, 0.00020000 },
+  { 0x837Cu, 0.00000000 },
+  { 0x8389u, 0.00010000 },
+  { 0x838Au, 0.00010000 },
+  { 0x838Eu, 0.00010000 },
+  { 0x83ABu, 0.00030000 },
+  { 0x83DCu, 0.00010000 },
+  { 0x83E9u, 0.00000000 },
+  { 0x83EFu, 0.00080000 },
+  { 0x83F2u, 0.00030000 },
+  { 0x8404u, 0.00010000 },
+  { 0x840Au, 0.00020000 },
+  { 0x842Cu, 0.00050000 },
+  { 0x843Du, 0.00050000 },
+  { 0x8449u, 0.00020000 },
+  { 0x8457u, 0.00100000 },
+  { 0x845Bu, 0.00010000 },
+  { 0x8461u, 0.00010000 },
+  { 0x8482u, 0.00020000 },
+  { 0x8499u, 0.00040000 },
+  { 0x84B2u, 0.00000000 },
+  { 0x84BCu, 0.00000000 },
+  { 0x84CBu, 0.00010000 },
+  { 0x84EEu, 0.00010000 },
+  { 0x8515u, 0.00000000 },
+  { 0x8521u, 0.00010000 },
+  { 0x8523u, 0.00010000 },
+  { 0x856Du, 0.00000000 },
+  { 0x8584u, 0.00010000 },
+  { 0x85A6u, 0.00000000 },
+  { 0x85A9u, 0.00020000 },
+  { 0x85AAu, 0.00000000 },
+  { 0x85C9u, 0.00010000 },
+  { 0x85CDu, 0.00010000 },
+  { 0x85CFu, 0.00040000 },
+  { 0x85DDu, 0.00030000 },
+  { 0x85E4u, 0.00010000 },
+  { 0x85E5u, 0.00010000 },
+  { 0x8606u, 0.00000000 },
+  { 0x8607u, 0.00030000 },
+  { 0x862Du, 0.00070000 },
+  { 0x864Eu, 0.00010000 },
+  { 0x8655u, 0.00050000 },
+  { 0x865Bu, 0.00010000 },
+  { 0x865Fu, 0.00090000 },
+  { 0x8667u, 0.00000000 },
+  { 0x86C7u, 0.00010000 },
+  { 0x86CBu, 0.00010000 },
+  { 0x86D9u, 0.00000000 },
+  { 0x8702u, 0.00000000 },
+  { 0x871Cu, 0.00000000 },
+  { 0x8776u, 0.00000000 },
+  { 0x878Du, 0.00010000 },
+  { 0x87A2u, 0.00000000 },
+  { 0x87F2u, 0.00010000 },
+  { 0x87F9u, 0.00000000 },
+  { 0x880Du, 0.00000000 },
+  { 0x883Bu, 0.00000000 },
+  { 0x8840u, 0.00020000 },
+  { 0x884Cu, 0.00420000 },
+  { 0x8853u, 0.00040000 },
+  { 0x8857u, 0.00050000 },
+  { 0x885Bu, 0.00030000 },
+  { 0x885Du, 0.00010000 },
+  { 0x8861u, 0.00010000 },
+  { 0x8863u, 0.00010000 },
+  { 0x8868u, 0.00170000 },
+  { 0x888Bu, 0.00000000 },
+  { 0x88ABu, 0.00320000 },
+  { 0x88C1u, 0.00010000 },
+  { 0x88C2u, 0.00010000 },
+  { 0x88D5u, 0.00010000 },
+  { 0x88DCu, 0.00010000 },
+  { 0x88DDu, 0.00040000 },
+  { 0x88E1u, 0.00030000 },
+  { 0x88FDu, 0.00050000 },
+  { 0x8907u, 0.00010000 },
+  { 0x8932u, 0.00000000 },
+  { 0x897Fu, 0.00310000 },
+  { 0x8981u, 0.00230000 },
+  { 0x8986u, 0.00010000 },
+  { 0x898Bu, 0.00040000 },
+  { 0x898Fu, 0.00030000 },
+  { 0x8996u, 0.00070000 },
+  { 0x89AAu, 0.00040000 },
+  { 0x89BAu, 0.00010000 },
+  { 0x89BDu, 0.00010000 },
+  { 0x89C0u, 0.00040000 },
+  { 0x89D2u, 0.00070000 },
+  { 0x89E3u, 0.00080000 },
+  { 0x89F8u, 0.00010000 },
+  { 0x8A00u, 0.00060000 },
+  { 0x8A02u, 0.00010000 },
+  { 0x8A08u, 0.00080000 },
+  { 0x8A0Au, 0.00020000 },
+  { 0x8A0Eu, 0.00010000 },
+  { 0x8A13u, 0.00010000 },
+  { 0x8A17u, 0.00000000 },
+  { 0x8A18u, 0.00040000 },
+  { 0x8A25u, 0.00000000 },
+  { 0x8A2Au, 0.00010000 },
+  { 0x8A2Du, 0.00100000 },
+  { 0x8A31u, 0.00040000 },
+  { 0x8A34u, 0.00010000 },
+  { 0x8A3Bu, 0.00000000 },
+  { 0x8A3Cu, 0.00000000 },
+  { 0x8A55u, 0.00020000 },
+  { 0x8A5Eu, 0.00020000 },
+  { 0x8A62u, 0.00000000 },
+  { 0x8A66u, 0.00020000 },
+  { 0x8A69u, 0.00010000 },
+  { 0x8A71u, 0.00020000 },
+  { 0x8A72u, 0.00070000 },
+  { 0x8A73u, 0.00010000 },
+  { 0x8A87u, 0.00000000 },
+  { 0x8A8Cu, 0.00010000 },
+  { 0x8A8Du, 0.00050000 },
+  { 0x8A93u, 0.00000000 },
+  { 0x8A95u, 0.00000000 },
+  { 0x8A9Eu, 0.00080000 },
+  { 0x8AA0u, 0.00000000 },
+  { 0x8AA4u, 0.00010000 },
+  { 0x8AAAu, 0.00060000 },
+  { 0x8AB0u, 0.00000000 },
+  { 0x8AB2u, 0.00010000 },
+  { 0x8ABCu, 0.00000000 },
+  { 0x8ABFu, 0.00030000 },
+  { 0x8AC7u, 0.00010000 },
+  { 0x8ACBu, 0.00020000 },
+  { 0x8AD2u, 0.00000000 },
+  { 0x8AD6u, 0.00040000 },
+  { 0x8AF8u, 0.00010000 },
+  { 0x8AFAu, 0.00000000 },
+  { 0x8AFEu, 0.00020000 },
+  { 0x8B00u, 0.00010000 },
+  { 0x8B02u, 0.00010000 },
+  { 0x8B1Bu, 0.00010000 },
+  { 0x8B1Du, 0.00010000 },
+  { 0x8B49u, 0.00020000 },
+  { 0x8B58u, 0.00020000 },
+  { 0x8B5Cu, 0.00010000 },
+  { 0x8B66u, 0.00030000 },
+  { 0x8B6Fu, 0.00020000 },
+  { 0x8B70u, 0.00060000 },
+  { 0x8B77u, 0.00030000 },
+  { 0x8B7Du, 0.00010000 },
+  { 0x8B80u, 0.00020000 },
+  { 0x8B8Au, 0.00050000 },
+  { 0x8B93u, 0.00030000 },
+  { 0x8B9Au, 0.00000000 },
+  { 0x8C37u, 0.00020000 },
+  { 0x8C46u, 0.00010000 },
+  { 0x8C48u, 0.00000000 },
+  { 0x8C50u, 0.00010000 },
+  { 0x8C61u, 0.00040000 },
+  { 0x8C6Au, 0.00010000 },
+  { 0x8C6Cu, 0.00000000 },
+  { 0x8C8Cu, 0.00010000 },
+  { 0x8C93u, 0.00010000 },
+  { 0x8C9Du, 0.00020000 },
+  { 0x8C9Eu, 0.00000000 },
+  { 0x8CA0u, 0.00030000 },
+  { 0x8CA1u, 0.00010000 },
+  { 0x8CA2u, 0.00010000 },
+  { 0x8CA8u, 0.00010000 },
+  { 0x8CAAu, 0.00000000 },
+  { 0x8CABu, 0.00010000 },
+  { 0x8CACu, 0.00030000 },
+  { 0x8CB4u, 0.00010000 },
+  { 0x8CB7u, 0.00010000 },
+  { 0x8CBBu, 0.00030000 },
+  { 0x8CBCu, 0.00000000 },
+  { 0x8CC0u, 0.00010000 },
+  { 0x8CC7u, 0.00060000 },
+  { 0x8CC8u, 0.00000000 },
+  { 0x8CD3u, 0.00010000 },
+  { 0x8CDCu, 0.00000000 },
+  { 0x8CDEu, 0.00010000 },
+  { 0x8CE2u, 0.00000000 },
+  { 0x8CE3u, 0.00010000 },
+  { 0x8CE4u, 0.00000000 },
+  { 0x8CE6u, 0.00000000 },
+  { 0x8CEAu, 0.00040000 },
+  { 0x8CEDu, 0.00000000 },
+  { 0x8CF4u, 0.00010000 },
+  { 0x8CFAu, 0.00000000 },
+  { 0x8CFCu, 0.00020000 },
+  { 0x8CFDu, 0.00120000 },
+  { 0x8D08u, 0.00000000 },
+  { 0x8D0Au, 0.00010000 },
+  { 0x8D0Fu, 0.00010000 },
+  { 0x8D64u, 0.00030000 },
+  { 0x8D6Bu, 0.00020000 },
+  { 0x8D70u, 0.00030000 },
+  { 0x8D77u, 0.00130000 },
+  { 0x8D85u, 0.00060000 },
+  { 0x8D8Au, 0.00050000 },
+  { 0x8D95u, 0.00000000 },
+  { 0x8D99u, 0.00010000 },
+  { 0x8DA3u, 0.00010000 },
+  { 0x8DA8u, 0.00000000 },
+  { 0x8DB3u, 0.00070000 },
+  { 0x8DCCu, 0.00000000 },
+  { 0x8DCEu, 0.00000000 },
+  { 0x8DD1u, 0.00010000 },
+  { 0x8DDDu, 0.00030000 },
+  { 0x8DDFu, 0.00020000 },
+  { 0x8DE1u, 0.00000000 },
+  { 0x8DEFu, 0.00200000 },
+  { 0x8DF3u, 0.00010000 },
+  { 0x8E0Fu, 0.00000000 },
+  { 0x8E22u, 0.00000000 },
+  { 0x8E5Fu, 0.00000000 },
+  { 0x8E64u, 0.00000000 },
+  { 0x8E8Du, 0.00000000 },
+  { 0x8EABu, 0.00100000 },
+  { 0x8EB2u, 0.00000000 },
+  { 0x8ECAu, 0.00110000 },
+  { 0x8ECCu, 0.00010000 },
+  { 0x8ECDu, 0.00180000 },
+  { 0x8ED2u, 0.00000000 },
+  { 0x8EDFu, 0.00020000 },
+  { 0x8F03u, 0.00040000 },
+  { 0x8F09u, 0.00020000 },
+  { 0x8F14u, 0.00010000 },
+  { 0x8F15u, 0.00020000 },
+  { 0x8F1Bu, 0.00010000 },
+  { 0x8F1Du, 0.00010000 },
+  { 0x8F29u, 0.00000000 },
+  { 0x8F2Au, 0.00020000 },
+  { 0x8F2Fu, 0.00030000 },
+  { 0x8F38u, 0.00010000 },
+  { 0x8F49u, 0.00050000 },
+  { 0x8F5Fu, 0.00010000 },
+  { 0x8F9Bu, 0.00010000 },
+  { 0x8FA6u, 0.00040000 },
+  { 0x8FA8u, 0.00000000 },
+  { 0x8FADu, 0.00010000 },
+  { 0x8FAFu, 0.00000000 },
+  { 0x8FB0u, 0.00000000 },
+  { 0x8FB1u, 0.00000000 },
+  { 0x8FB2u, 0.00020000 },
+  { 0x8FC5u, 0.00010000 },
+  { 0x8FCEu, 0.00010000 },
+  { 0x8FD1u, 0.00080000 },
+  { 0x8FD4u, 0.00020000 },
+  { 0x8FE6u, 0.00000000 },
+  { 0x8FEAu, 0.00040000 },
+  { 0x8FEBu, 0.00020000 },
+  { 0x8FF0u, 0.00040000 },
+  { 0x8FF4u, 0.00010000 },
+  { 0x8FF7u, 0.00010000 },
+  { 0x8FFDu, 0.00020000 },
+  { 0x9000u, 0.00030000 },
+  { 0x9001u, 0.00030000 },
+  { 0x9003u, 0.00020000 },
+  { 0x9006u, 0.00010000 },
+  { 0x900Fu, 0.00020000 },
+  { 0x9010u, 0.00030000 },
+  { 0x9014u, 0.00020000 },
+  { 0x9019u, 0.00160000 },
+  { 0x901Au, 0.00180000 },
+  { 0x901Bu, 0.00000000 },
+  { 0x901Du, 0.00010000 },
+  { 0x901Fu, 0.00060000 },
+  { 0x9020u, 0.00090000 },
+  { 0x9022u, 0.00010000 },
+  { 0x9023u, 0.00050000 },
+  { 0x9031u, 0.00010000 },
+  { 0x9032u, 0.00120000 },
+  { 0x9038u, 0.00000000 },
+  { 0x903Cu, 0.00000000 },
+  { 0x9047u, 0.00020000 },
+  { 0x904Au, 0.00040000 },
+  { 0x904Bu, 0.00080000 },
+  { 0x904Du, 0.00010000 },
+  { 0x904Eu, 0.00120000 },
+  { 0x9053u, 0.00210000 },
+  { 0x9054u, 0.00090000 },
+  { 0x9055u, 0.00000000 },
+  { 0x9059u, 0.00000000 },
+  { 0x905Cu, 0.00010000 },
+  { 0x9060u, 0.00020000 },
+  { 0x9069u, 0.00010000 },
+  { 0x906Du, 0.00020000 },
+  { 0x906Eu, 0.00000000 },
+  { 0x9072u, 0.00000000 },
+  { 0x9077u, 0.00010000 },
+  { 0x9078u, 0.00090000 },
+  { 0x907Au, 0.00010000 },
+  { 0x907Fu, 0.00010000 },
+  { 0x9080u, 0.00010000 },
+  { 0x9081u, 0.00000000 },
+  { 0x9084u, 0.00040000 },
+  { 0x908Au, 0.00030000 },
+  { 0x908Fu, 0.00000000 },
+  { 0x90A3u, 0.00050000 },
+  { 0x90A6u, 0.00030000 },
+  { 0x90AAu, 0.00000000 },
+  { 0x90B1u, 0.00000000 },
+  { 0x90CEu, 0.00020000 },
+  { 0x90E8u, 0.00390000 },
+  { 0x90EDu, 0.00010000 },
+  { 0x90F5u, 0.00000000 },
+  { 0x90FDu, 0.00170000 },
+  { 0x9102u, 0.00000000 },
+  { 0x9109u, 0.00020000 },
+  { 0x912Du, 0.00010000 },
+  { 0x9130u, 0.00010000 },
+  { 0x9149u, 0.00000000 },
+  { 0x914Du, 0.00040000 },
+  { 0x9152u, 0.00030000 },
+  { 0x9177u, 0.00000000 },
+  { 0x9178u, 0.00020000 },
+  { 0x9189u, 0.00000000 },
+  { 0x9192u, 0.00000000 },
+  { 0x919Cu, 0.00000000 },
+  { 0x91ABu, 0.00020000 },
+  { 0x91C7u, 0.00020000 },
+  { 0x91CBu, 0.00010000 },
+  { 0x91CCu, 0.00230000 },
+  { 0x91CDu, 0.00170000 },
+  { 0x91CEu, 0.00030000 },
+  { 0x91CFu, 0.00130000 },
+  { 0x91D1u, 0.00140000 },
+  { 0x91DDu, 0.00010000 },
+  { 0x91E3u, 0.00000000 },
+  { 0x9234u, 0.00000000 },
+  { 0x9262u, 0.00000000 },
+  { 0x9280u, 0.00040000 },
+  { 0x9285u, 0.00010000 },
+  { 0x9296u, 0.00000000 },
+  { 0x9298u, 0.00000000 },
+  { 0x92B3u, 0.00000000 },
+  { 0x92B7u, 0.00020000 },
+  { 0x92D2u, 0.00010000 },
+  { 0x92FCu, 0.00010000 },
+  { 0x9304u, 0.00040000 },
+  { 0x9322u, 0.00010000 },
+  { 0x9326u, 0.00010000 },
+  { 0x932Bu, 0.00010000 },
+  { 0x932Fu, 0.00010000 },
+  { 0x934Bu, 0.00000000 },
+  { 0x9375u, 0.00010000 },
+  { 0x937Eu, 0.00000000 },
+  { 0x938Au, 0.00000000 },
+  { 0x9396u, 0.00000000 },
+  { 0x93AEu, 0.00030000 },
+  { 0x93E1u, 0.00010000 },
+  { 0x9418u, 0.00010000 },
+  { 0x9435u, 0.00050000 },
+  { 0x9451u, 0.00000000 },
+  { 0x9577u, 0.00160000 },
+  { 0x9580u, 0.00070000 },
+  { 0x9583u, 0.00000000 },
+  { 0x9589u, 0.00010000 },
+  { 0x958Bu, 0.00150000 },
+  { 0x958Fu, 0.00000000 },
+  { 0x9592u, 0.00000000 },
+  { 0x9593u, 0.00130000 },
+  { 0x95A3u, 0.00010000 },
+  { 0x95B1u, 0.00000000 },
+  { 0x95C6u, 0.00000000 },
+  { 0x95CAu, 0.00000000 },
+  { 0x95CDu, 0.00000000 },
+  { 0x95D0u, 0.00000000 },
+  { 0x95DCu, 0.00070000 },
+  { 0x95E1u, 0.00000000 },
+  { 0x9632u, 0.00040000 },
+  { 0x963Bu, 0.00010000 },
+  { 0x963Fu, 0.00110000 },
+  { 0x9640u, 0.00000000 },
+  { 0x9644u, 0.00040000 },
+  { 0x964Du, 0.00040000 },
+  { 0x9650u, 0.00050000 },
+  { 0x9662u, 0.00150000 },
+  { 0x9663u, 0.00020000 },
+  { 0x9664u, 0.00060000 },
+  { 0x966Au, 0.00000000 },
+  { 0x9670u, 0.00010000 },
+  { 0x9673u, 0.00030000 },
+  { 0x9675u, 0.00020000 },
+  { 0x9676u, 0.00010000 },
+  { 0x9677u, 0.00010000 },
+  { 0x9678u, 0.00040000 },
+  { 0x967Du, 0.00030000 },
+  { 0x9686u, 0.00030000 },
+  { 0x968Au, 0.00110000 },
+  { 0x968Eu, 0.00020000 },
+  { 0x9694u, 0.00010000 },
+  { 0x969Bu, 0.00040000 },
+  { 0x969Cu, 0.00010000 },
+  { 0x96A8u, 0.00030000 },
+  { 0x96AAu, 0.00010000 },
+  { 0x96B1u, 0.00010000 },
+  { 0x96BBu, 0.00010000 },
+  { 0x96C4u, 0.00030000 },
+  { 0x96C5u, 0.00030000 },
+  { 0x96C6u, 0.00110000 },
+  { 0x96C9u, 0.00000000 },
+  { 0x96D6u, 0.00030000 },
+  { 0x96D9u, 0.00030000 },
+  { 0x96DCu, 0.00020000 },
+  { 0x96DEu, 0.00000000 },
+  { 0x96E2u, 0.00040000 },
+  { 0x96E3u, 0.00020000 },
+  { 0x96E8u, 0.00020000 },
+  { 0x96EAu, 0.00020000 },
+  { 0x96F2u, 0.00020000 },
+  { 0x96F6u, 0.00010000 },
+  { 0x96F7u, 0.00050000 },
+  { 0x96FBu, 0.00140000 },
+  { 0x9700u, 0.00050000 },
+  { 0x9707u, 0.00010000 },
+  { 0x970Du, 0.00020000 },
+  { 0x9727u, 0.00000000 },
+  { 0x9732u, 0.00020000 },
+  { 0x9738u, 0.00010000 },
+  { 0x9739u, 0.00000000 },
+  { 0x9742u, 0.00000000 },
+  { 0x9748u, 0.00020000 },
+  { 0x9752u, 0.00050000 },
+  { 0x9756u, 0.00010000 },
+  { 0x975Cu, 0.00010000 },
+  { 0x975Eu, 0.00080000 },
+  { 0x9760u, 0.00010000 },
+  { 0x9762u, 0.00210000 },
+  { 0x9769u, 0.00040000 },
+  { 0x977Cu, 0.00000000 },
+  { 0x978Bu, 0.00000000 },
+  { 0x97C3u, 0.00000000 },
+  { 0x97CBu, 0.00010000 },
+  { 0x97D3u, 0.00020000 },
+  { 0x97F3u, 0.00110000 },
+  { 0x97FBu, 0.00000000 },
+  { 0x97FFu, 0.00030000 },
+  { 0x9801u, 0.00010000 },
+  { 0x9802u, 0.00010000 },
+  { 0x9805u, 0.00030000 },
+  { 0x9806u, 0.00010000 },
+  { 0x9808u, 0.00020000 },
+  { 0x9810u, 0.00020000 },
+  { 0x9811u, 0.00000000 },
+  { 0x9813u, 0.00030000 },
+  { 0x9817u, 0.00000000 },
+  { 0x9818u, 0.00050000 },
+  { 0x981Eu, 0.00000000 },
+  { 0x982Du, 0.00050000 },
+  { 0x983Bu, 0.00010000 },
+  { 0x9846u, 0.00010000 },
+  { 0x984Cu, 0.00040000 },
+  { 0x984Du, 0.00010000 },
+  { 0x984Fu, 0.00010000 },
+  { 0x9858u, 0.00010000 },
+  { 0x985Eu, 0.00070000 },
+  { 0x9867u, 0.00010000 },
+  { 0x986Fu, 0.00020000 },
+  { 0x98A8u, 0.00050000 },
+  { 0x98C4u, 0.00000000 },
+  { 0x98DBu, 0.00040000 },
+  { 0x98DFu, 0.00050000 },
+  { 0x98EFu, 0.00000000 },
+  { 0x98F2u, 0.00000000 },
+  { 0x98FDu, 0.00000000 },
+  { 0x98FEu, 0.00010000 },
+  { 0x9905u, 0.00000000 },
+  { 0x990Au, 0.00010000 },
+  { 0x9910u, 0.00010000 },
+  { 0x9918u, 0.00020000 },
+  { 0x9928u, 0.00030000 },
+  { 0x9996u, 0.00130000 },
+  { 0x9999u, 0.00120000 },
+  { 0x99ACu, 0.00100000 },
+  { 0x99D0u, 0.00010000 },
+  { 0x99D5u, 0.00010000 },
+  { 0x99DBu, 0.00010000 },
+  { 0x9A0Eu, 0.00010000 },
+  { 0x9A19u, 0.00000000 },
+  { 0x9A37u, 0.00000000 },
+  { 0x9A45u, 0.00010000 },
+  { 0x9A57u, 0.00020000 },
+  { 0x9A5Au, 0.00000000 },
+  { 0x9AA8u, 0.00020000 },
+  { 0x9AD4u, 0.00120000 },
+  { 0x9AD8u, 0.00240000 },
+  { 0x9AEEu, 0.00000000 },
+  { 0x9B06u, 0.00000000 },
+  { 0x9B25u, 0.00020000 },
+  { 0x9B27u, 0.00000000 },
+  { 0x9B31u, 0.00000000 },
+  { 0x9B3Cu, 0.00010000 },
+  { 0x9B41u, 0.00000000 },
+  { 0x9B42u, 0.00000000 },
+  { 0x9B45u, 0.00000000 },
+  { 0x9B54u, 0.00020000 },
+  { 0x9B5Au, 0.00040000 },
+  { 0x9B6Fu, 0.00020000 },
+  { 0x9BAEu, 0.00010000 },
+  { 0x9CE5u, 0.00010000 },
+  { 0x9CF3u, 0.00010000 },
+  { 0x9CF4u, 0.00000000 },
+  { 0x9D3Bu, 0.00000000 },
+  { 0x9D5Du, 0.00000000 },
+  { 0x9DF9u, 0.00000000 },
+  { 0x9E7Fu, 0.00010000 },
+  { 0x9E97u, 0.00020000 },
+  { 0x9EA5u, 0.00020000 },
+  { 0x9EB5u, 0.00000000 },
+  { 0x9EBBu, 0.00010000 },
+  { 0x9EBCu, 0.00010000 },
+  { 0x9EC3u, 0.00030000 },
+  { 0x9ECEu, 0.00020000 },
+  { 0x9ED1u, 0.00050000 },
+  { 0x9ED8u, 0.00010000 },
+  { 0x9EDEu, 0.00050000 },
+  { 0x9EE8u, 0.00050000 },
+  { 0x9F13u, 0.00010000 },
+  { 0x9F20u, 0.00010000 },
+  { 0x9F3Bu, 0.00010000 },
+  { 0x9F4Au, 0.00010000 },
+  { 0x9F4Bu, 0.00000000 },
+  { 0x9F52u, 0.00010000 },
+  { 0x9F61u, 0.00010000 },
+  { 0x9F8Du, 0.00070000 },
+  { 0x9F9Cu, 0.00000000 },
+};
+
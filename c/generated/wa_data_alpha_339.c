@@ -0,0 +1,9139 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_339_UPPER[] = {
+  "阿",
+  "啊",
+  "哎",
+  "哀",
+  "唉",
+  "埃",
+  "艾",
+  "爱",
+  "碍",
+  "安",
+  "岸",
+  "按",
+  "案",
+  "暗",
+  "昂",
+  "傲",
+  "奥",
+  "澳",
+  "八",
+  "巴",
+  "叭",
+  "芭",
+  "拔",
+  "把",
+  "爸",
+  "罢",
+  "霸",
+  "吧",
+  "白",
+  "百",
+  "柏",
+  "摆",
+  "败",
+  "拜",
+  "班",
+  "般",
+  "搬",
+  "板",
+  "版",
+  "办",
+  "半",
+  "伴",
+  "扮",
+  "邦",
+  "帮",
+  "榜",
+  "棒",
+  "磅",
+  "包",
+  "胞",
+  "薄",
+  "宝",
+  "饱",
+  "保",
+  "堡",
+  "报",
+  "抱",
+  "暴",
+  "爆",
+  "杯",
+  "悲",
+  "北",
+  "贝",
+  "备",
+  "背",
+  "倍",
+  "被",
+  "辈",
+  "奔",
+  "本",
+  "笨",
+  "崩",
+  "逼",
+  "鼻",
+  "比",
+  "彼",
+  "俾",
+  "笔",
+  "币",
+  "必",
+  "毕",
+  "闭",
+  "敝",
+  "弊",
+  "碧",
+  "壁",
+  "避",
+  "臂",
+  "边",
+  "编",
+  "扁",
+  "变",
+  "便",
+  "遍",
+  "辨",
+  "辩",
+  "标",
+  "飙",
+  "表",
+  "别",
+  "宾",
+  "彬",
+  "滨",
+  "冰",
+  "兵",
+  "丙",
+  "饼",
+  "并",
+  "病",
+  "拨",
+  "波",
+  "玻",
+  "播",
+  "伯",
+  "博",
+  "补",
+  "捕",
+  "不",
+  "布",
+  "步",
+  "怖",
+  "埔",
+  "部",
+  "簿",
+  "擦",
+  "猜",
+  "才",
+  "材",
+  "财",
+  "裁",
+  "采",
+  "彩",
+  "踩",
+  "菜",
+  "蔡",
+  "参",
+  "餐",
+  "残",
+  "惨",
+  "灿",
+  "沧",
+  "苍",
+  "藏",
+  "操",
+  "曹",
+  "草",
+  "册",
+  "侧",
+  "测",
+  "策",
+  "层",
+  "曾",
+  "叉",
+  "插",
+  "查",
+  "茶",
+  "察",
+  "差",
+  "拆",
+  "柴",
+  "禅",
+  "缠",
+  "产",
+  "阐",
+  "昌",
+  "尝",
+  "常",
+  "厂",
+  "场",
+  "畅",
+  "唱",
+  "抄",
+  "超",
+  "朝",
+  "潮",
+  "吵",
+  "车",
+  "扯",
+  "彻",
+  "尘",
+  "臣",
+  "沉",
+  "辰",
+  "陈",
+  "晨",
+  "趁",
+  "称",
+  "成",
+  "呈",
+  "承",
+  "诚",
+  "城",
+  "乘",
+  "程",
+  "秤",
+  "吃",
+  "痴",
+  "池",
+  "迟",
+  "持",
+  "尺",
+  "齿",
+  "斥",
+  "赤",
+  "翅",
+  "充",
+  "冲",
+  "虫",
+  "崇",
+  "抽",
+  "仇",
+  "愁",
+  "筹",
+  "丑",
+  "臭",
+  "出",
+  "初",
+  "除",
+  "础",
+  "储",
+  "楚",
+  "处",
+  "川",
+  "穿",
+  "传",
+  "船",
+  "串",
+  "窗",
+  "床",
+  "创",
+  "吹",
+  "垂",
+  "春",
+  "纯",
+  "蠢",
+  "词",
+  "茨",
+  "慈",
+  "辞",
+  "磁",
+  "此",
+  "次",
+  "刺",
+  "赐",
+  "匆",
+  "聪",
+  "从",
+  "粗",
+  "促",
+  "催",
+  "脆",
+  "粹",
+  "翠",
+  "村",
+  "存",
+  "寸",
+  "措",
+  "错",
+  "嗒",
+  "搭",
+  "达",
+  "答",
+  "靼",
+  "鞑",
+  "打",
+  "大",
+  "呆",
+  "代",
+  "带",
+  "待",
+  "袋",
+  "戴",
+  "丹",
+  "单",
+  "担",
+  "胆",
+  "掸",
+  "旦",
+  "但",
+  "诞",
+  "弹",
+  "淡",
+  "蛋",
+  "当",
+  "挡",
+  "党",
+  "档",
+  "刀",
+  "导",
+  "岛",
+  "到",
+  "倒",
+  "道",
+  "得",
+  "德",
+  "地",
+  "的",
+  "灯",
+  "登",
+  "等",
+  "邓",
+  "低",
+  "滴",
+  "迪",
+  "敌",
+  "笛",
+  "底",
+  "抵",
+  "弟",
+  "帝",
+  "递",
+  "第",
+  "蒂",
+  "典",
+  "点",
+  "电",
+  "甸",
+  "店",
+  "吊",
+  "钓",
+  "调",
+  "掉",
+  "跌",
+  "碟",
+  "蝶",
+  "丁",
+  "顶",
+  "订",
+  "定",
+  "丢",
+  "东",
+  "冬",
+  "懂",
+  "动",
+  "栋",
+  "洞",
+  "都",
+  "斗",
+  "豆",
+  "督",
+  "毒",
+  "独",
+  "读",
+  "赌",
+  "杜",
+  "肚",
+  "度",
+  "渡",
+  "端",
+  "短",
+  "段",
+  "断",
+  "堆",
+  "队",
+  "对",
+  "兑",
+  "敦",
+  "盾",
+  "顿",
+  "多",
+  "夺",
+  "朵",
+  "躲",
+  "堕",
+  "俄",
+  "莪",
+  "鹅",
+  "额",
+  "厄",
+  "恶",
+  "鄂",
+  "恩",
+  "儿",
+  "而",
+  "尔",
+  "耳",
+  "二",
+  "发",
+  "乏",
+  "伐",
+  "罚",
+  "法",
+  "番",
+  "翻",
+  "凡",
+  "烦",
+  "繁",
+  "反",
+  "返",
+  "犯",
+  "泛",
+  "饭",
+  "范",
+  "贩",
+  "梵",
+  "方",
+  "芳",
+  "防",
+  "妨",
+  "房",
+  "仿",
+  "访",
+  "放",
+  "飞",
+  "非",
+  "啡",
+  "菲",
+  "肥",
+  "腓",
+  "斐",
+  "废",
+  "费",
+  "分",
+  "纷",
+  "芬",
+  "氛",
+  "粉",
+  "份",
+  "奋",
+  "丰",
+  "风",
+  "枫",
+  "封",
+  "疯",
+  "峰",
+  "锋",
+  "蜂",
+  "逢",
+  "凤",
+  "奉",
+  "缶",
+  "否",
+  "夫",
+  "肤",
+  "弗",
+  "伏",
+  "佛",
+  "服",
+  "浮",
+  "符",
+  "幅",
+  "福",
+  "府",
+  "辅",
+  "腐",
+  "父",
+  "付",
+  "妇",
+  "负",
+  "附",
+  "复",
+  "副",
+  "富",
+  "赋",
+  "腹",
+  "覆",
+  "该",
+  "改",
+  "盖",
+  "概",
+  "甘",
+  "敢",
+  "感",
+  "干",
+  "冈",
+  "刚",
+  "纲",
+  "缸",
+  "钢",
+  "岗",
+  "港",
+  "高",
+  "糕",
+  "搞",
+  "稿",
+  "告",
+  "戈",
+  "咯",
+  "哥",
+  "割",
+  "歌",
+  "阁",
+  "革",
+  "格",
+  "葛",
+  "隔",
+  "个",
+  "各",
+  "给",
+  "根",
+  "跟",
+  "庚",
+  "更",
+  "工",
+  "公",
+  "功",
+  "攻",
+  "供",
+  "恭",
+  "共",
+  "贡",
+  "勾",
+  "沟",
+  "狗",
+  "构",
+  "购",
+  "够",
+  "估",
+  "姑",
+  "孤",
+  "古",
+  "谷",
+  "股",
+  "骨",
+  "鼓",
+  "固",
+  "故",
+  "顾",
+  "瓜",
+  "寡",
+  "乖",
+  "怪",
+  "关",
+  "观",
+  "官",
+  "冠",
+  "馆",
+  "管",
+  "贯",
+  "惯",
+  "灌",
+  "罐",
+  "光",
+  "广",
+  "逛",
+  "归",
+  "圭",
+  "龟",
+  "规",
+  "瑰",
+  "轨",
+  "癸",
+  "鬼",
+  "贵",
+  "郭",
+  "锅",
+  "国",
+  "果",
+  "过",
+  "哈",
+  "嗨",
+  "还",
+  "孩",
+  "海",
+  "亥",
+  "害",
+  "含",
+  "函",
+  "涵",
+  "寒",
+  "韩",
+  "罕",
+  "喊",
+  "汉",
+  "汗",
+  "憾",
+  "翰",
+  "航",
+  "毫",
+  "豪",
+  "好",
+  "号",
+  "浩",
+  "耗",
+  "呵",
+  "喝",
+  "合",
+  "何",
+  "和",
+  "河",
+  "核",
+  "荷",
+  "盒",
+  "贺",
+  "赫",
+  "鹤",
+  "黑",
+  "嘿",
+  "痕",
+  "很",
+  "狠",
+  "恨",
+  "亨",
+  "衡",
+  "轰",
+  "弘",
+  "红",
+  "宏",
+  "洪",
+  "虹",
+  "鸿",
+  "侯",
+  "猴",
+  "后",
+  "厚",
+  "後",
+  "候",
+  "乎",
+  "呼",
+  "忽",
+  "狐",
+  "胡",
+  "湖",
+  "糊",
+  "虎",
+  "唬",
+  "互",
+  "户",
+  "护",
+  "花",
+  "华",
+  "滑",
+  "化",
+  "划",
+  "画",
+  "话",
+  "怀",
+  "欢",
+  "环",
+  "缓",
+  "幻",
+  "唤",
+  "换",
+  "患",
+  "荒",
+  "皇",
+  "凰",
+  "黄",
+  "煌",
+  "晃",
+  "灰",
+  "恢",
+  "挥",
+  "辉",
+  "回",
+  "悔",
+  "汇",
+  "会",
+  "绘",
+  "惠",
+  "慧",
+  "昏",
+  "婚",
+  "浑",
+  "魂",
+  "混",
+  "活",
+  "火",
+  "伙",
+  "夥",
+  "或",
+  "货",
+  "获",
+  "祸",
+  "惑",
+  "霍",
+  "丌",
+  "击",
+  "圾",
+  "机",
+  "矶",
+  "鸡",
+  "积",
+  "基",
+  "激",
+  "及",
+  "吉",
+  "级",
+  "即",
+  "极",
+  "急",
+  "疾",
+  "集",
+  "辑",
+  "藉",
+  "籍",
+  "几",
+  "己",
+  "挤",
+  "计",
+  "记",
+  "纪",
+  "忌",
+  "技",
+  "际",
+  "剂",
+  "季",
+  "既",
+  "济",
+  "继",
+  "寂",
+  "寄",
+  "绩",
+  "加",
+  "夹",
+  "伽",
+  "佳",
+  "迦",
+  "家",
+  "嘉",
+  "甲",
+  "贾",
+  "假",
+  "价",
+  "驾",
+  "架",
+  "嫁",
+  "尖",
+  "坚",
+  "间",
+  "肩",
+  "兼",
+  "监",
+  "柬",
+  "捡",
+  "减",
+  "剪",
+  "检",
+  "简",
+  "见",
+  "件",
+  "建",
+  "剑",
+  "荐",
+  "贱",
+  "健",
+  "舰",
+  "渐",
+  "键",
+  "箭",
+  "江",
+  "将",
+  "疆",
+  "讲",
+  "奖",
+  "蒋",
+  "降",
+  "交",
+  "胶",
+  "焦",
+  "角",
+  "缴",
+  "叫",
+  "较",
+  "教",
+  "阶",
+  "皆",
+  "接",
+  "街",
+  "节",
+  "劫",
+  "杰",
+  "结",
+  "捷",
+  "截",
+  "羯",
+  "姐",
+  "解",
+  "介",
+  "戒",
+  "界",
+  "借",
+  "今",
+  "金",
+  "津",
+  "筋",
+  "仅",
+  "尽",
+  "紧",
+  "谨",
+  "锦",
+  "劲",
+  "近",
+  "进",
+  "晋",
+  "禁",
+  "京",
+  "经",
+  "晶",
+  "睛",
+  "精",
+  "井",
+  "景",
+  "警",
+  "径",
+  "竞",
+  "竟",
+  "敬",
+  "靖",
+  "境",
+  "静",
+  "镜",
+  "究",
+  "九",
+  "久",
+  "酒",
+  "旧",
+  "救",
+  "就",
+  "居",
+  "拘",
+  "局",
+  "举",
+  "巨",
+  "句",
+  "拒",
+  "具",
+  "俱",
+  "剧",
+  "惧",
+  "据",
+  "距",
+  "聚",
+  "娟",
+  "捐",
+  "卷",
+  "倦",
+  "决",
+  "绝",
+  "觉",
+  "爵",
+  "军",
+  "君",
+  "均",
+  "俊",
+  "咖",
+  "喀",
+  "卡",
+  "开",
+  "凯",
+  "刊",
+  "堪",
+  "坎",
+  "砍",
+  "看",
+  "康",
+  "抗",
+  "考",
+  "拷",
+  "烤",
+  "靠",
+  "柯",
+  "科",
+  "颗",
+  "可",
+  "渴",
+  "克",
+  "刻",
+  "客",
+  "课",
+  "肯",
+  "坑",
+  "空",
+  "孔",
+  "恐",
+  "控",
+  "口",
+  "扣",
+  "寇",
+  "哭",
+  "苦",
+  "库",
+  "裤",
+  "酷",
+  "夸",
+  "块",
+  "快",
+  "宽",
+  "款",
+  "狂",
+  "况",
+  "框",
+  "亏",
+  "愧",
+  "坤",
+  "昆",
+  "困",
+  "扩",
+  "括",
+  "阔",
+  "垃",
+  "拉",
+  "喇",
+  "腊",
+  "啦",
+  "来",
+  "莱",
+  "赖",
+  "兰",
+  "岚",
+  "拦",
+  "栏",
+  "蓝",
+  "篮",
+  "览",
+  "懒",
+  "烂",
+  "滥",
+  "郎",
+  "狼",
+  "朗",
+  "浪",
+  "劳",
+  "牢",
+  "老",
+  "乐",
+  "了",
+  "勒",
+  "雷",
+  "镭",
+  "垒",
+  "类",
+  "累",
+  "冷",
+  "哩",
+  "离",
+  "璃",
+  "黎",
+  "礼",
+  "李",
+  "里",
+  "理",
+  "力",
+  "历",
+  "厉",
+  "立",
+  "丽",
+  "利",
+  "励",
+  "坜",
+  "例",
+  "莉",
+  "粒",
+  "雳",
+  "俩",
+  "连",
+  "莲",
+  "联",
+  "廉",
+  "脸",
+  "练",
+  "恋",
+  "链",
+  "良",
+  "梁",
+  "两",
+  "亮",
+  "谅",
+  "辆",
+  "量",
+  "疗",
+  "聊",
+  "料",
+  "廖",
+  "咧",
+  "列",
+  "劣",
+  "烈",
+  "裂",
+  "邻",
+  "林",
+  "临",
+  "淋",
+  "琳",
+  "霖",
+  "吝",
+  "灵",
+  "玲",
+  "凌",
+  "铃",
+  "陵",
+  "零",
+  "龄",
+  "领",
+  "令",
+  "另",
+  "溜",
+  "刘",
+  "浏",
+  "流",
+  "留",
+  "柳",
+  "六",
+  "龙",
+  "隆",
+  "娄",
+  "楼",
+  "漏",
+  "卢",
+  "芦",
+  "炉",
+  "鲁",
+  "陆",
+  "录",
+  "鹿",
+  "路",
+  "露",
+  "旅",
+  "律",
+  "虑",
+  "率",
+  "绿",
+  "乱",
+  "略",
+  "伦",
+  "轮",
+  "论",
+  "罗",
+  "逻",
+  "洛",
+  "络",
+  "落",
+  "妈",
+  "麻",
+  "马",
+  "玛",
+  "码",
+  "吗",
+  "嘛",
+  "埋",
+  "买",
+  "迈",
+  "麦",
+  "卖",
+  "蛮",
+  "满",
+  "曼",
+  "慢",
+  "漫",
+  "忙",
+  "芒",
+  "茫",
+  "毛",
+  "矛",
+  "卯",
+  "茂",
+  "冒",
+  "贸",
+  "帽",
+  "貌",
+  "么",
+  "没",
+  "玫",
+  "眉",
+  "梅",
+  "媒",
+  "每",
+  "美",
+  "妹",
+  "魅",
+  "门",
+  "闷",
+  "们",
+  "盟",
+  "蒙",
+  "猛",
+  "孟",
+  "梦",
+  "咪",
+  "弥",
+  "迷",
+  "谜",
+  "米",
+  "秘",
+  "密",
+  "蜜",
+  "眠",
+  "绵",
+  "棉",
+  "免",
+  "勉",
+  "缅",
+  "面",
+  "喵",
+  "苗",
+  "描",
+  "秒",
+  "妙",
+  "庙",
+  "灭",
+  "蔑",
+  "民",
+  "敏",
+  "名",
+  "明",
+  "鸣",
+  "铭",
+  "命",
+  "摸",
+  "模",
+  "摩",
+  "磨",
+  "魔",
+  "抹",
+  "末",
+  "莫",
+  "寞",
+  "漠",
+  "墨",
+  "默",
+  "谋",
+  "某",
+  "母",
+  "牡",
+  "姆",
+  "木",
+  "目",
+  "牧",
+  "幕",
+  "慕",
+  "暮",
+  "穆",
+  "拿",
+  "哪",
+  "那",
+  "呐",
+  "纳",
+  "娜",
+  "乃",
+  "奶",
+  "奈",
+  "耐",
+  "男",
+  "南",
+  "难",
+  "恼",
+  "脑",
+  "瑙",
+  "闹",
+  "讷",
+  "呢",
+  "内",
+  "嫩",
+  "能",
+  "嗯",
+  "妮",
+  "尼",
+  "泥",
+  "你",
+  "拟",
+  "逆",
+  "年",
+  "念",
+  "娘",
+  "鸟",
+  "涅",
+  "您",
+  "宁",
+  "凝",
+  "牛",
+  "扭",
+  "纽",
+  "农",
+  "侬",
+  "浓",
+  "弄",
+  "奴",
+  "努",
+  "怒",
+  "女",
+  "暖",
+  "挪",
+  "诺",
+  "喏",
+  "喔",
+  "哦",
+  "欧",
+  "偶",
+  "啪",
+  "爬",
+  "帕",
+  "怕",
+  "拍",
+  "排",
+  "牌",
+  "派",
+  "潘",
+  "盘",
+  "判",
+  "盼",
+  "彷",
+  "庞",
+  "旁",
+  "胖",
+  "跑",
+  "泡",
+  "炮",
+  "陪",
+  "培",
+  "赔",
+  "佩",
+  "配",
+  "喷",
+  "朋",
+  "彭",
+  "棚",
+  "蓬",
+  "澎",
+  "碰",
+  "批",
+  "披",
+  "霹",
+  "皮",
+  "疲",
+  "匹",
+  "屁",
+  "偏",
+  "篇",
+  "片",
+  "骗",
+  "飘",
+  "票",
+  "漂",
+  "拼",
+  "频",
+  "品",
+  "聘",
+  "平",
+  "评",
+  "凭",
+  "坪",
+  "屏",
+  "瓶",
+  "萍",
+  "坡",
+  "泊",
+  "颇",
+  "婆",
+  "迫",
+  "珀",
+  "破",
+  "扑",
+  "菩",
+  "葡",
+  "浦",
+  "普",
+  "谱",
+  "铺",
+  "七",
+  "妻",
+  "期",
+  "欺",
+  "齐",
+  "其",
+  "奇",
+  "骑",
+  "棋",
+  "琪",
+  "旗",
+  "企",
+  "岂",
+  "启",
+  "起",
+  "气",
+  "弃",
+  "汽",
+  "泣",
+  "契",
+  "器",
+  "恰",
+  "洽",
+  "千",
+  "迁",
+  "牵",
+  "签",
+  "前",
+  "钱",
+  "乾",
+  "潜",
+  "浅",
+  "欠",
+  "歉",
+  "枪",
+  "强",
+  "抢",
+  "悄",
+  "敲",
+  "乔",
+  "侨",
+  "桥",
+  "瞧",
+  "巧",
+  "翘",
+  "且",
+  "切",
+  "亲",
+  "侵",
+  "钦",
+  "秦",
+  "琴",
+  "勤",
+  "寝",
+  "青",
+  "轻",
+  "倾",
+  "清",
+  "情",
+  "晴",
+  "擎",
+  "请",
+  "庆",
+  "穷",
+  "穹",
+  "琼",
+  "丘",
+  "邱",
+  "秋",
+  "求",
+  "酋",
+  "球",
+  "区",
+  "曲",
+  "驱",
+  "趋",
+  "取",
+  "去",
+  "趣",
+  "圈",
+  "全",
+  "权",
+  "泉",
+  "拳",
+  "劝",
+  "券",
+  "缺",
+  "却",
+  "确",
+  "群",
+  "然",
+  "燃",
+  "染",
+  "壤",
+  "让",
+  "绕",
+  "惹",
+  "热",
+  "人",
+  "仁",
+  "壬",
+  "忍",
+  "认",
+  "任",
+  "仍",
+  "日",
+  "荣",
+  "容",
+  "蓉",
+  "融",
+  "柔",
+  "肉",
+  "如",
+  "儒",
+  "汝",
+  "辱",
+  "入",
+  "阮",
+  "软",
+  "瑞",
+  "闰",
+  "若",
+  "偌",
+  "弱",
+  "撒",
+  "萨",
+  "塞",
+  "赛",
+  "三",
+  "散",
+  "桑",
+  "丧",
+  "骚",
+  "扫",
+  "色",
+  "瑟",
+  "森",
+  "僧",
+  "杀",
+  "沙",
+  "砂",
+  "莎",
+  "煞",
+  "啥",
+  "傻",
+  "晒",
+  "山",
+  "杉",
+  "珊",
+  "闪",
+  "扇",
+  "善",
+  "伤",
+  "商",
+  "赏",
+  "上",
+  "尚",
+  "烧",
+  "稍",
+  "少",
+  "绍",
+  "舌",
+  "蛇",
+  "舍",
+  "厍",
+  "设",
+  "社",
+  "射",
+  "涉",
+  "摄",
+  "谁",
+  "申",
+  "伸",
+  "身",
+  "深",
+  "什",
+  "神",
+  "沈",
+  "审",
+  "甚",
+  "慎",
+  "升",
+  "生",
+  "声",
+  "牲",
+  "省",
+  "圣",
+  "胜",
+  "盛",
+  "剩",
+  "失",
+  "师",
+  "诗",
+  "施",
+  "狮",
+  "十",
+  "石",
+  "时",
+  "识",
+  "实",
+  "拾",
+  "食",
+  "史",
+  "使",
+  "始",
+  "驶",
+  "士",
+  "氏",
+  "世",
+  "市",
+  "示",
+  "式",
+  "事",
+  "势",
+  "视",
+  "试",
+  "饰",
+  "室",
+  "是",
+  "适",
+  "逝",
+  "释",
+  "誓",
+  "匙",
+  "收",
+  "手",
+  "守",
+  "首",
+  "寿",
+  "受",
+  "兽",
+  "售",
+  "授",
+  "书",
+  "叔",
+  "枢",
+  "殊",
+  "淑",
+  "疏",
+  "舒",
+  "输",
+  "熟",
+  "属",
+  "暑",
+  "署",
+  "鼠",
+  "术",
+  "束",
+  "述",
+  "树",
+  "数",
+  "刷",
+  "耍",
+  "摔",
+  "帅",
+  "双",
+  "爽",
+  "水",
+  "税",
+  "睡",
+  "顺",
+  "说",
+  "硕",
+  "丝",
+  "司",
+  "私",
+  "思",
+  "斯",
+  "死",
+  "巳",
+  "四",
+  "似",
+  "松",
+  "宋",
+  "送",
+  "搜",
+  "苏",
+  "稣",
+  "俗",
+  "诉",
+  "素",
+  "速",
+  "宿",
+  "塑",
+  "酸",
+  "算",
+  "虽",
+  "随",
+  "岁",
+  "碎",
+  "孙",
+  "损",
+  "缩",
+  "所",
+  "索",
+  "锁",
+  "他",
+  "它",
+  "她",
+  "塔",
+  "踏",
+  "胎",
+  "台",
+  "抬",
+  "太",
+  "态",
+  "泰",
+  "贪",
+  "摊",
+  "坛",
+  "谈",
+  "檀",
+  "坦",
+  "叹",
+  "探",
+  "汤",
+  "唐",
+  "堂",
+  "糖",
+  "涛",
+  "逃",
+  "桃",
+  "陶",
+  "淘",
+  "萄",
+  "讨",
+  "套",
+  "特",
+  "疼",
+  "腾",
+  "藤",
+  "梯",
+  "踢",
+  "提",
+  "题",
+  "体",
+  "替",
+  "天",
+  "添",
+  "田",
+  "甜",
+  "填",
+  "挑",
+  "条",
+  "跳",
+  "帖",
+  "贴",
+  "铁",
+  "厅",
+  "听",
+  "廷",
+  "庭",
+  "停",
+  "挺",
+  "通",
+  "同",
+  "铜",
+  "童",
+  "统",
+  "痛",
+  "偷",
+  "头",
+  "投",
+  "透",
+  "突",
+  "图",
+  "徒",
+  "途",
+  "屠",
+  "土",
+  "吐",
+  "兔",
+  "团",
+  "推",
+  "腿",
+  "退",
+  "托",
+  "拖",
+  "脱",
+  "陀",
+  "妥",
+  "挖",
+  "蛙",
+  "娃",
+  "瓦",
+  "佤",
+  "哇",
+  "歪",
+  "崴",
+  "外",
+  "弯",
+  "湾",
+  "丸",
+  "完",
+  "玩",
+  "顽",
+  "宛",
+  "晚",
+  "碗",
+  "万",
+  "汪",
+  "亡",
+  "王",
+  "网",
+  "往",
+  "忘",
+  "旺",
+  "望",
+  "危",
+  "威",
+  "微",
+  "韦",
+  "围",
+  "违",
+  "唯",
+  "维",
+  "伟",
+  "尾",
+  "委",
+  "卫",
+  "为",
+  "未",
+  "位",
+  "味",
+  "谓",
+  "喂",
+  "慰",
+  "温",
+  "文",
+  "闻",
+  "雯",
+  "吻",
+  "稳",
+  "问",
+  "汶",
+  "翁",
+  "挝",
+  "窝",
+  "我",
+  "沃",
+  "握",
+  "乌",
+  "污",
+  "呜",
+  "巫",
+  "屋",
+  "无",
+  "吾",
+  "五",
+  "午",
+  "伍",
+  "武",
+  "舞",
+  "勿",
+  "务",
+  "戊",
+  "物",
+  "误",
+  "悟",
+  "雾",
+  "夕",
+  "兮",
+  "吸",
+  "西",
+  "希",
+  "析",
+  "息",
+  "牺",
+  "悉",
+  "惜",
+  "稀",
+  "溪",
+  "锡",
+  "嘻",
+  "习",
+  "席",
+  "袭",
+  "洗",
+  "喜",
+  "戏",
+  "系",
+  "细",
+  "虾",
+  "侠",
+  "峡",
+  "下",
+  "吓",
+  "夏",
+  "仙",
+  "先",
+  "鲜",
+  "闲",
+  "弦",
+  "贤",
+  "嫌",
+  "显",
+  "险",
+  "县",
+  "岘",
+  "现",
+  "线",
+  "限",
+  "宪",
+  "陷",
+  "献",
+  "乡",
+  "相",
+  "香",
+  "箱",
+  "详",
+  "祥",
+  "翔",
+  "享",
+  "响",
+  "想",
+  "向",
+  "巷",
+  "项",
+  "象",
+  "像",
+  "消",
+  "萧",
+  "销",
+  "小",
+  "晓",
+  "孝",
+  "肖",
+  "效",
+  "校",
+  "笑",
+  "些",
+  "协",
+  "邪",
+  "胁",
+  "斜",
+  "鞋",
+  "写",
+  "械",
+  "谢",
+  "蟹",
+  "心",
+  "辛",
+  "欣",
+  "新",
+  "薪",
+  "馨",
+  "信",
+  "星",
+  "刑",
+  "行",
+  "形",
+  "型",
+  "醒",
+  "兴",
+  "姓",
+  "幸",
+  "性",
+  "兄",
+  "匈",
+  "胸",
+  "雄",
+  "熊",
+  "休",
+  "修",
+  "羞",
+  "秀",
+  "戌",
+  "须",
+  "需",
+  "徐",
+  "许",
+  "旭",
+  "序",
+  "叙",
+  "绪",
+  "续",
+  "轩",
+  "宣",
+  "玄",
+  "旋",
+  "选",
+  "学",
+  "雪",
+  "血",
+  "勋",
+  "寻",
+  "巡",
+  "询",
+  "循",
+  "训",
+  "讯",
+  "迅",
+  "逊",
+  "压",
+  "鸭",
+  "牙",
+  "琊",
+  "涯",
+  "雅",
+  "亚",
+  "呀",
+  "延",
+  "严",
+  "言",
+  "沿",
+  "炎",
+  "研",
+  "掩",
+  "眼",
+  "演",
+  "厌",
+  "宴",
+  "验",
+  "燕",
+  "央",
+  "扬",
+  "羊",
+  "阳",
+  "杨",
+  "洋",
+  "仰",
+  "养",
+  "样",
+  "妖",
+  "腰",
+  "邀",
+  "瑶",
+  "咬",
+  "药",
+  "要",
+  "耀",
+  "椰",
+  "爷",
+  "耶",
+  "也",
+  "野",
+  "业",
+  "叶",
+  "页",
+  "夜",
+  "液",
+  "一",
+  "伊",
+  "衣",
+  "医",
+  "依",
+  "仪",
+  "夷",
+  "宜",
+  "怡",
+  "咦",
+  "移",
+  "遗",
+  "疑",
+  "彝",
+  "乙",
+  "已",
+  "以",
+  "矣",
+  "蚁",
+  "倚",
+  "椅",
+  "义",
+  "亿",
+  "忆",
+  "艺",
+  "议",
+  "亦",
+  "异",
+  "役",
+  "抑",
+  "译",
+  "易",
+  "益",
+  "谊",
+  "逸",
+  "意",
+  "毅",
+  "翼",
+  "因",
+  "阴",
+  "音",
+  "吟",
+  "寅",
+  "银",
+  "引",
+  "饮",
+  "隐",
+  "印",
+  "应",
+  "英",
+  "樱",
+  "鹰",
+  "迎",
+  "盈",
+  "萤",
+  "营",
+  "赢",
+  "影",
+  "映",
+  "硬",
+  "哟",
+  "唷",
+  "拥",
+  "庸",
+  "永",
+  "泳",
+  "勇",
+  "用",
+  "优",
+  "忧",
+  "呦",
+  "幽",
+  "悠",
+  "尤",
+  "由",
+  "犹",
+  "邮",
+  "油",
+  "游",
+  "友",
+  "有",
+  "酉",
+  "又",
+  "右",
+  "幼",
+  "佑",
+  "于",
+  "余",
+  "於",
+  "鱼",
+  "娱",
+  "愉",
+  "愚",
+  "瑜",
+  "与",
+  "予",
+  "宇",
+  "羽",
+  "雨",
+  "语",
+  "玉",
+  "育",
+  "狱",
+  "浴",
+  "预",
+  "域",
+  "欲",
+  "喻",
+  "裕",
+  "遇",
+  "愈",
+  "誉",
+  "元",
+  "员",
+  "园",
+  "原",
+  "圆",
+  "援",
+  "缘",
+  "源",
+  "远",
+  "怨",
+  "院",
+  "曰",
+  "约",
+  "月",
+  "岳",
+  "阅",
+  "跃",
+  "粤",
+  "越",
+  "云",
+  "允",
+  "孕",
+  "运",
+  "杂",
+  "哉",
+  "再",
+  "在",
+  "载",
+  "咱",
+  "暂",
+  "赞",
+  "遭",
+  "糟",
+  "早",
+  "造",
+  "则",
+  "择",
+  "泽",
+  "责",
+  "贼",
+  "怎",
+  "增",
+  "赠",
+  "扎",
+  "渣",
+  "札",
+  "乍",
+  "炸",
+  "斋",
+  "摘",
+  "寨",
+  "展",
+  "占",
+  "战",
+  "站",
+  "张",
+  "章",
+  "彰",
+  "长",
+  "涨",
+  "掌",
+  "丈",
+  "帐",
+  "障",
+  "招",
+  "昭",
+  "爪",
+  "找",
+  "召",
+  "兆",
+  "赵",
+  "照",
+  "遮",
+  "折",
+  "哲",
+  "者",
+  "这",
+  "浙",
+  "着",
+  "贞",
+  "针",
+  "侦",
+  "珍",
+  "真",
+  "祯",
+  "圳",
+  "阵",
+  "振",
+  "镇",
+  "震",
+  "争",
+  "征",
+  "整",
+  "正",
+  "证",
+  "郑",
+  "政",
+  "之",
+  "支",
+  "芝",
+  "枝",
+  "知",
+  "织",
+  "执",
+  "直",
+  "值",
+  "职",
+  "植",
+  "止",
+  "只",
+  "旨",
+  "址",
+  "纸",
+  "指",
+  "徵",
+  "至",
+  "志",
+  "制",
+  "治",
+  "质",
+  "秩",
+  "致",
+  "智",
+  "置",
+  "雉",
+  "中",
+  "忠",
+  "终",
+  "钟",
+  "锺",
+  "种",
+  "仲",
+  "众",
+  "重",
+  "州",
+  "舟",
+  "周",
+  "洲",
+  "宙",
+  "骤",
+  "朱",
+  "珠",
+  "诸",
+  "猪",
+  "铢",
+  "竹",
+  "逐",
+  "主",
+  "煮",
+  "住",
+  "助",
+  "注",
+  "驻",
+  "祝",
+  "著",
+  "筑",
+  "抓",
+  "专",
+  "转",
+  "赚",
+  "装",
+  "壮",
+  "状",
+  "撞",
+  "追",
+  "准",
+  "捉",
+  "桌",
+  "卓",
+  "孜",
+  "兹",
+  "咨",
+  "姿",
+  "资",
+  "滋",
+  "子",
+  "仔",
+  "姊",
+  "紫",
+  "字",
+  "自",
+  "宗",
+  "综",
+  "总",
+  "纵",
+  "走",
+  "奏",
+  "租",
+  "足",
+  "卒",
+  "族",
+  "阻",
+  "组",
+  "祖",
+  "钻",
+  "嘴",
+  "最",
+  "罪",
+  "醉",
+  "尊",
+  "遵",
+  "昨",
+  "左",
+  "佐",
+  "作",
+  "坐",
+  "祚",
+  "座",
+  "做",
+};
+const char *ALPHA_339_LOWER[] = {
+  "阿",
+  "啊",
+  "哎",
+  "哀",
+  "唉",
+  "埃",
+  "艾",
+  "爱",
+  "碍",
+  "安",
+  "岸",
+  "按",
+  "案",
+  "暗",
+  "昂",
+  "傲",
+  "奥",
+  "澳",
+  "八",
+  "巴",
+  "叭",
+  "芭",
+  "拔",
+  "把",
+  "爸",
+  "罢",
+  "霸",
+  "吧",
+  "白",
+  "百",
+  "柏",
+  "摆",
+  "败",
+  "拜",
+  "班",
+  "般",
+  "搬",
+  "板",
+  "版",
+  "办",
+  "半",
+  "伴",
+  "扮",
+  "邦",
+  "帮",
+  "榜",
+  "棒",
+  "磅",
+  "包",
+  "胞",
+  "薄",
+  "宝",
+  "饱",
+  "保",
+  "堡",
+  "报",
+  "抱",
+  "暴",
+  "爆",
+  "杯",
+  "悲",
+  "北",
+  "贝",
+  "备",
+  "背",
+  "倍",
+  "被",
+  "辈",
+  "奔",
+  "本",
+  "笨",
+  "崩",
+  "逼",
+  "鼻",
+  "比",
+  "彼",
+  "俾",
+  "笔",
+  "币",
+  "必",
+  "毕",
+  "闭",
+  "敝",
+  "弊",
+  "碧",
+  "壁",
+  "避",
+  "臂",
+  "边",
+  "编",
+  "扁",
+  "变",
+  "便",
+  "遍",
+  "辨",
+  "辩",
+  "标",
+  "飙",
+  "表",
+  "别",
+  "宾",
+  "彬",
+  "滨",
+  "冰",
+  "兵",
+  "丙",
+  "饼",
+  "并",
+  "病",
+  "拨",
+  "波",
+  "玻",
+  "播",
+  "伯",
+  "博",
+  "补",
+  "捕",
+  "不",
+  "布",
+  "步",
+  "怖",
+  "埔",
+  "部",
+  "簿",
+  "擦",
+  "猜",
+  "才",
+  "材",
+  "财",
+  "裁",
+  "采",
+  "彩",
+  "踩",
+  "菜",
+  "蔡",
+  "参",
+  "餐",
+  "残",
+  "惨",
+  "灿",
+  "沧",
+  "苍",
+  "藏",
+  "操",
+  "曹",
+  "草",
+  "册",
+  "侧",
+  "测",
+  "策",
+  "层",
+  "曾",
+  "叉",
+  "插",
+  "查",
+  "茶",
+  "察",
+  "差",
+  "拆",
+  "柴",
+  "禅",
+  "缠",
+  "产",
+  "阐",
+  "昌",
+  "尝",
+  "常",
+  "厂",
+  "场",
+  "畅",
+  "唱",
+  "抄",
+  "超",
+  "朝",
+  "潮",
+  "吵",
+  "车",
+  "扯",
+  "彻",
+  "尘",
+  "臣",
+  "沉",
+  "辰",
+  "陈",
+  "晨",
+  "趁",
+  "称",
+  "成",
+  "呈",
+  "承",
+  "诚",
+  "城",
+  "乘",
+  "程",
+  "秤",
+  "吃",
+  "痴",
+  "池",
+  "迟",
+  "持",
+  "尺",
+  "齿",
+  "斥",
+  "赤",
+  "翅",
+  "充",
+  "冲",
+  "虫",
+  "崇",
+  "抽",
+  "仇",
+  "愁",
+  "筹",
+  "丑",
+  "臭",
+  "出",
+  "初",
+  "除",
+  "础",
+  "储",
+  "楚",
+  "处",
+  "川",
+  "穿",
+  "传",
+  "船",
+  "串",
+  "窗",
+  "床",
+  "创",
+  "吹",
+  "垂",
+  "春",
+  "纯",
+  "蠢",
+  "词",
+  "茨",
+  "慈",
+  "辞",
+  "磁",
+  "此",
+  "次",
+  "刺",
+  "赐",
+  "匆",
+  "聪",
+  "从",
+  "粗",
+  "促",
+  "催",
+  "脆",
+  "粹",
+  "翠",
+  "村",
+  "存",
+  "寸",
+  "措",
+  "错",
+  "嗒",
+  "搭",
+  "达",
+  "答",
+  "靼",
+  "鞑",
+  "打",
+  "大",
+  "呆",
+  "代",
+  "带",
+  "待",
+  "袋",
+  "戴",
+  "丹",
+  "单",
+  "担",
+  "胆",
+  "掸",
+  "旦",
+  "但",
+  "诞",
+  "弹",
+  "淡",
+  "蛋",
+  "当",
+  "挡",
+  "党",
+  "档",
+  "刀",
+  "导",
+  "岛",
+  "到",
+  "倒",
+  "道",
+  "得",
+  "德",
+  "地",
+  "的",
+  "灯",
+  "登",
+  "等",
+  "邓",
+  "低",
+  "滴",
+  "迪",
+  "敌",
+  "笛",
+  "底",
+  "抵",
+  "弟",
+  "帝",
+  "递",
+  "第",
+  "蒂",
+  "典",
+  "点",
+  "电",
+  "甸",
+  "店",
+  "吊",
+  "钓",
+  "调",
+  "掉",
+  "跌",
+  "碟",
+  "蝶",
+  "丁",
+  "顶",
+  "订",
+  "定",
+  "丢",
+  "东",
+  "冬",
+  "懂",
+  "动",
+  "栋",
+  "洞",
+  "都",
+  "斗",
+  "豆",
+  "督",
+  "毒",
+  "独",
+  "读",
+  "赌",
+  "杜",
+  "肚",
+  "度",
+  "渡",
+  "端",
+  "短",
+  "段",
+  "断",
+  "堆",
+  "队",
+  "对",
+  "兑",
+  "敦",
+  "盾",
+  "顿",
+  "多",
+  "夺",
+  "朵",
+  "躲",
+  "堕",
+  "俄",
+  "莪",
+  "鹅",
+  "额",
+  "厄",
+  "恶",
+  "鄂",
+  "恩",
+  "儿",
+  "而",
+  "尔",
+  "耳",
+  "二",
+  "发",
+  "乏",
+  "伐",
+  "罚",
+  "法",
+  "番",
+  "翻",
+  "凡",
+  "烦",
+  "繁",
+  "反",
+  "返",
+  "犯",
+  "泛",
+  "饭",
+  "范",
+  "贩",
+  "梵",
+  "方",
+  "芳",
+  "防",
+  "妨",
+  "房",
+  "仿",
+  "访",
+  "放",
+  "飞",
+  "非",
+  "啡",
+  "菲",
+  "肥",
+  "腓",
+  "斐",
+  "废",
+  "费",
+  "分",
+  "纷",
+  "芬",
+  "氛",
+  "粉",
+  "份",
+  "奋",
+  "丰",
+  "风",
+  "枫",
+  "封",
+  "疯",
+  "峰",
+  "锋",
+  "蜂",
+  "逢",
+  "凤",
+  "奉",
+  "缶",
+  "否",
+  "夫",
+  "肤",
+  "弗",
+  "伏",
+  "佛",
+  "服",
+  "浮",
+  "符",
+  "幅",
+  "福",
+  "府",
+  "辅",
+  "腐",
+  "父",
+  "付",
+  "妇",
+  "负",
+  "附",
+  "复",
+  "副",
+  "富",
+  "赋",
+  "腹",
+  "覆",
+  "该",
+  "改",
+  "盖",
+  "概",
+  "甘",
+  "敢",
+  "感",
+  "干",
+  "冈",
+  "刚",
+  "纲",
+  "缸",
+  "钢",
+  "岗",
+  "港",
+  "高",
+  "糕",
+  "搞",
+  "稿",
+  "告",
+  "戈",
+  "咯",
+  "哥",
+  "割",
+  "歌",
+  "阁",
+  "革",
+  "格",
+  "葛",
+  "隔",
+  "个",
+  "各",
+  "给",
+  "根",
+  "跟",
+  "庚",
+  "更",
+  "工",
+  "公",
+  "功",
+  "攻",
+  "供",
+  "恭",
+  "共",
+  "贡",
+  "勾",
+  "沟",
+  "狗",
+  "构",
+  "购",
+  "够",
+  "估",
+  "姑",
+  "孤",
+  "古",
+  "谷",
+  "股",
+  "骨",
+  "鼓",
+  "固",
+  "故",
+  "顾",
+  "瓜",
+  "寡",
+  "乖",
+  "怪",
+  "关",
+  "观",
+  "官",
+  "冠",
+  "馆",
+  "管",
+  "贯",
+  "惯",
+  "灌",
+  "罐",
+  "光",
+  "广",
+  "逛",
+  "归",
+  "圭",
+  "龟",
+  "规",
+  "瑰",
+  "轨",
+  "癸",
+  "鬼",
+  "贵",
+  "郭",
+  "锅",
+  "国",
+  "果",
+  "过",
+  "哈",
+  "嗨",
+  "还",
+  "孩",
+  "海",
+  "亥",
+  "害",
+  "含",
+  "函",
+  "涵",
+  "寒",
+  "韩",
+  "罕",
+  "喊",
+  "汉",
+  "汗",
+  "憾",
+  "翰",
+  "航",
+  "毫",
+  "豪",
+  "好",
+  "号",
+  "浩",
+  "耗",
+  "呵",
+  "喝",
+  "合",
+  "何",
+  "和",
+  "河",
+  "核",
+  "荷",
+  "盒",
+  "贺",
+  "赫",
+  "鹤",
+  "黑",
+  "嘿",
+  "痕",
+  "很",
+  "狠",
+  "恨",
+  "亨",
+  "衡",
+  "轰",
+  "弘",
+  "红",
+  "宏",
+  "洪",
+  "虹",
+  "鸿",
+  "侯",
+  "猴",
+  "后",
+  "厚",
+  "後",
+  "候",
+  "乎",
+  "呼",
+  "忽",
+  "狐",
+  "胡",
+  "湖",
+  "糊",
+  "虎",
+  "唬",
+  "互",
+  "户",
+  "护",
+  "花",
+  "华",
+  "滑",
+  "化",
+  "划",
+  "画",
+  "话",
+  "怀",
+  "欢",
+  "环",
+  "缓",
+  "幻",
+  "唤",
+  "换",
+  "患",
+  "荒",
+  "皇",
+  "凰",
+  "黄",
+  "煌",
+  "晃",
+  "灰",
+  "恢",
+  "挥",
+  "辉",
+  "回",
+  "悔",
+  "汇",
+  "会",
+  "绘",
+  "惠",
+  "慧",
+  "昏",
+  "婚",
+  "浑",
+  "魂",
+  "混",
+  "活",
+  "火",
+  "伙",
+  "夥",
+  "或",
+  "货",
+  "获",
+  "祸",
+  "惑",
+  "霍",
+  "丌",
+  "击",
+  "圾",
+  "机",
+  "矶",
+  "鸡",
+  "积",
+  "基",
+  "激",
+  "及",
+  "吉",
+  "级",
+  "即",
+  "极",
+  "急",
+  "疾",
+  "集",
+  "辑",
+  "藉",
+  "籍",
+  "几",
+  "己",
+  "挤",
+  "计",
+  "记",
+  "纪",
+  "忌",
+  "技",
+  "际",
+  "剂",
+  "季",
+  "既",
+  "济",
+  "继",
+  "寂",
+  "寄",
+  "绩",
+  "加",
+  "夹",
+  "伽",
+  "佳",
+  "迦",
+  "家",
+  "嘉",
+  "甲",
+  "贾",
+  "假",
+  "价",
+  "驾",
+  "架",
+  "嫁",
+  "尖",
+  "坚",
+  "间",
+  "肩",
+  "兼",
+  "监",
+  "柬",
+  "捡",
+  "减",
+  "剪",
+  "检",
+  "简",
+  "见",
+  "件",
+  "建",
+  "剑",
+  "荐",
+  "贱",
+  "健",
+  "舰",
+  "渐",
+  "键",
+  "箭",
+  "江",
+  "将",
+  "疆",
+  "讲",
+  "奖",
+  "蒋",
+  "降",
+  "交",
+  "胶",
+  "焦",
+  "角",
+  "缴",
+  "叫",
+  "较",
+  "教",
+  "阶",
+  "皆",
+  "接",
+  "街",
+  "节",
+  "劫",
+  "杰",
+  "结",
+  "捷",
+  "截",
+  "羯",
+  "姐",
+  "解",
+  "介",
+  "戒",
+  "界",
+  "借",
+  "今",
+  "金",
+  "津",
+  "筋",
+  "仅",
+  "尽",
+  "紧",
+  "谨",
+  "锦",
+  "劲",
+  "近",
+  "进",
+  "晋",
+  "禁",
+  "京",
+  "经",
+  "晶",
+  "睛",
+  "精",
+  "井",
+  "景",
+  "警",
+  "径",
+  "竞",
+  "竟",
+  "敬",
+  "靖",
+  "境",
+  "静",
+  "镜",
+  "究",
+  "九",
+  "久",
+  "酒",
+  "旧",
+  "救",
+  "就",
+  "居",
+  "拘",
+  "局",
+  "举",
+  "巨",
+  "句",
+  "拒",
+  "具",
+  "俱",
+  "剧",
+  "惧",
+  "据",
+  "距",
+  "聚",
+  "娟",
+  "捐",
+  "卷",
+  "倦",
+  "决",
+  "绝",
+  "觉",
+  "爵",
+  "军",
+  "君",
+  "均",
+  "俊",
+  "咖",
+  "喀",
+  "卡",
+  "开",
+  "凯",
+  "刊",
+  "堪",
+  "坎",
+  "砍",
+  "看",
+  "康",
+  "抗",
+  "考",
+  "拷",
+  "烤",
+  "靠",
+  "柯",
+  "科",
+  "颗",
+  "可",
+  "渴",
+  "克",
+  "刻",
+  "客",
+  "课",
+  "肯",
+  "坑",
+  "空",
+  "孔",
+  "恐",
+  "控",
+  "口",
+  "扣",
+  "寇",
+  "哭",
+  "苦",
+  "库",
+  "裤",
+  "酷",
+  "夸",
+  "块",
+  "快",
+  "宽",
+  "款",
+  "狂",
+  "况",
+  "框",
+  "亏",
+  "愧",
+  "坤",
+  "昆",
+  "困",
+  "扩",
+  "括",
+  "阔",
+  "垃",
+  "拉",
+  "喇",
+  "腊",
+  "啦",
+  "来",
+  "莱",
+  "赖",
+  "兰",
+  "岚",
+  "拦",
+  "栏",
+  "蓝",
+  "篮",
+  "览",
+  "懒",
+  "烂",
+  "滥",
+  "郎",
+  "狼",
+  "朗",
+  "浪",
+  "劳",
+  "牢",
+  "老",
+  "乐",
+  "了",
+  "勒",
+  "雷",
+  "镭",
+  "垒",
+  "类",
+  "累",
+  "冷",
+  "哩",
+  "离",
+  "璃",
+  "黎",
+  "礼",
+  "李",
+  "里",
+  "理",
+  "力",
+  "历",
+  "厉",
+  "立",
+  "丽",
+  "利",
+  "励",
+  "坜",
+  "例",
+  "莉",
+  "粒",
+  "雳",
+  "俩",
+  "连",
+  "莲",
+  "联",
+  "廉",
+  "脸",
+  "练",
+  "恋",
+  "链",
+  "良",
+  "梁",
+  "两",
+  "亮",
+  "谅",
+  "辆",
+  "量",
+  "疗",
+  "聊",
+  "料",
+  "廖",
+  "咧",
+  "列",
+  "劣",
+  "烈",
+  "裂",
+  "邻",
+  "林",
+  "临",
+  "淋",
+  "琳",
+  "霖",
+  "吝",
+  "灵",
+  "玲",
+  "凌",
+  "铃",
+  "陵",
+  "零",
+  "龄",
+  "领",
+  "令",
+  "另",
+  "溜",
+  "刘",
+  "浏",
+  "流",
+  "留",
+  "柳",
+  "六",
+  "龙",
+  "隆",
+  "娄",
+  "楼",
+  "漏",
+  "卢",
+  "芦",
+  "炉",
+  "鲁",
+  "陆",
+  "录",
+  "鹿",
+  "路",
+  "露",
+  "旅",
+  "律",
+  "虑",
+  "率",
+  "绿",
+  "乱",
+  "略",
+  "伦",
+  "轮",
+  "论",
+  "罗",
+  "逻",
+  "洛",
+  "络",
+  "落",
+  "妈",
+  "麻",
+  "马",
+  "玛",
+  "码",
+  "吗",
+  "嘛",
+  "埋",
+  "买",
+  "迈",
+  "麦",
+  "卖",
+  "蛮",
+  "满",
+  "曼",
+  "慢",
+  "漫",
+  "忙",
+  "芒",
+  "茫",
+  "毛",
+  "矛",
+  "卯",
+  "茂",
+  "冒",
+  "贸",
+  "帽",
+  "貌",
+  "么",
+  "没",
+  "玫",
+  "眉",
+  "梅",
+  "媒",
+  "每",
+  "美",
+  "妹",
+  "魅",
+  "门",
+  "闷",
+  "们",
+  "盟",
+  "蒙",
+  "猛",
+  "孟",
+  "梦",
+  "咪",
+  "弥",
+  "迷",
+  "谜",
+  "米",
+  "秘",
+  "密",
+  "蜜",
+  "眠",
+  "绵",
+  "棉",
+  "免",
+  "勉",
+  "缅",
+  "面",
+  "喵",
+  "苗",
+  "描",
+  "秒",
+  "妙",
+  "庙",
+  "灭",
+  "蔑",
+  "民",
+  "敏",
+  "名",
+  "明",
+  "鸣",
+  "铭",
+  "命",
+  "摸",
+  "模",
+  "摩",
+  "磨",
+  "魔",
+  "抹",
+  "末",
+  "莫",
+  "寞",
+  "漠",
+  "墨",
+  "默",
+  "谋",
+  "某",
+  "母",
+  "牡",
+  "姆",
+  "木",
+  "目",
+  "牧",
+  "幕",
+  "慕",
+  "暮",
+  "穆",
+  "拿",
+  "哪",
+  "那",
+  "呐",
+  "纳",
+  "娜",
+  "乃",
+  "奶",
+  "奈",
+  "耐",
+  "男",
+  "南",
+  "难",
+  "恼",
+  "脑",
+  "瑙",
+  "闹",
+  "讷",
+  "呢",
+  "内",
+  "嫩",
+  "能",
+  "嗯",
+  "妮",
+  "尼",
+  "泥",
+  "你",
+  "拟",
+  "逆",
+  "年",
+  "念",
+  "娘",
+  "鸟",
+  "涅",
+  "您",
+  "宁",
+  "凝",
+  "牛",
+  "扭",
+  "纽",
+  "农",
+  "侬",
+  "浓",
+  "弄",
+  "奴",
+  "努",
+  "怒",
+  "女",
+  "暖",
+  "挪",
+  "诺",
+  "喏",
+  "喔",
+  "哦",
+  "欧",
+  "偶",
+  "啪",
+  "爬",
+  "帕",
+  "怕",
+  "拍",
+  "排",
+  "牌",
+  "派",
+  "潘",
+  "盘",
+  "判",
+  "盼",
+  "彷",
+  "庞",
+  "旁",
+  "胖",
+  "跑",
+  "泡",
+  "炮",
+  "陪",
+  "培",
+  "赔",
+  "佩",
+  "配",
+  "喷",
+  "朋",
+  "彭",
+  "棚",
+  "蓬",
+  "澎",
+  "碰",
+  "批",
+  "披",
+  "霹",
+  "皮",
+  "疲",
+  "匹",
+  "屁",
+  "偏",
+  "篇",
+  "片",
+  "骗",
+  "飘",
+  "票",
+  "漂",
+  "拼",
+  "频",
+  "品",
+  "聘",
+  "平",
+  "评",
+  "凭",
+  "坪",
+  "屏",
+  "瓶",
+  "萍",
+  "坡",
+  "泊",
+  "颇",
+  "婆",
+  "迫",
+  "珀",
+  "破",
+  "扑",
+  "菩",
+  "葡",
+  "浦",
+  "普",
+  "谱",
+  "铺",
+  "七",
+  "妻",
+  "期",
+  "欺",
+  "齐",
+  "其",
+  "奇",
+  "骑",
+  "棋",
+  "琪",
+  "旗",
+  "企",
+  "岂",
+  "启",
+  "起",
+  "气",
+  "弃",
+  "汽",
+  "泣",
+  "契",
+  "器",
+  "恰",
+  "洽",
+  "千",
+  "迁",
+  "牵",
+  "签",
+  "前",
+  "钱",
+  "乾",
+  "潜",
+  "浅",
+  "欠",
+  "歉",
+  "枪",
+  "强",
+  "抢",
+  "悄",
+  "敲",
+  "乔",
+  "侨",
+  "桥",
+  "瞧",
+  "巧",
+  "翘",
+  "且",
+  "切",
+  "亲",
+  "侵",
+  "钦",
+  "秦",
+  "琴",
+  "勤",
+  "寝",
+  "青",
+  "轻",
+  "倾",
+  "清",
+  "情",
+  "晴",
+  "擎",
+  "请",
+  "庆",
+  "穷",
+  "穹",
+  "琼",
+  "丘",
+  "邱",
+  "秋",
+  "求",
+  "酋",
+  "球",
+  "区",
+  "曲",
+  "驱",
+  "趋",
+  "取",
+  "去",
+  "趣",
+  "圈",
+  "全",
+  "权",
+  "泉",
+  "拳",
+  "劝",
+  "券",
+  "缺",
+  "却",
+  "确",
+  "群",
+  "然",
+  "燃",
+  "染",
+  "壤",
+  "让",
+  "绕",
+  "惹",
+  "热",
+  "人",
+  "仁",
+  "壬",
+  "忍",
+  "认",
+  "任",
+  "仍",
+  "日",
+  "荣",
+  "容",
+  "蓉",
+  "融",
+  "柔",
+  "肉",
+  "如",
+  "儒",
+  "汝",
+  "辱",
+  "入",
+  "阮",
+  "软",
+  "瑞",
+  "闰",
+  "若",
+  "偌",
+  "弱",
+  "撒",
+  "萨",
+  "塞",
+  "赛",
+  "三",
+  "散",
+  "桑",
+  "丧",
+  "骚",
+  "扫",
+  "色",
+  "瑟",
+  "森",
+  "僧",
+  "杀",
+  "沙",
+  "砂",
+  "莎",
+  "煞",
+  "啥",
+  "傻",
+  "晒",
+  "山",
+  "杉",
+  "珊",
+  "闪",
+  "扇",
+  "善",
+  "伤",
+  "商",
+  "赏",
+  "上",
+  "尚",
+  "烧",
+  "稍",
+  "少",
+  "绍",
+  "舌",
+  "蛇",
+  "舍",
+  "厍",
+  "设",
+  "社",
+  "射",
+  "涉",
+  "摄",
+  "谁",
+  "申",
+  "伸",
+  "身",
+  "深",
+  "什",
+  "神",
+  "沈",
+  "审",
+  "甚",
+  "慎",
+  "升",
+  "生",
+  "声",
+  "牲",
+  "省",
+  "圣",
+  "胜",
+  "盛",
+  "剩",
+  "失",
+  "师",
+  "诗",
+  "施",
+  "狮",
+  "十",
+  "石",
+  "时",
+  "识",
+  "实",
+  "拾",
+  "食",
+  "史",
+  "使",
+  "始",
+  "驶",
+  "士",
+  "氏",
+  "世",
+  "市",
+  "示",
+  "式",
+  "事",
+  "势",
+  "视",
+  "试",
+  "饰",
+  "室",
+  "是",
+  "适",
+  "逝",
+  "释",
+  "誓",
+  "匙",
+  "收",
+  "手",
+  "守",
+  "首",
+  "寿",
+  "受",
+  "兽",
+  "售",
+  "授",
+  "书",
+  "叔",
+  "枢",
+  "殊",
+  "淑",
+  "疏",
+  "舒",
+  "输",
+  "熟",
+  "属",
+  "暑",
+  "署",
+  "鼠",
+  "术",
+  "束",
+  "述",
+  "树",
+  "数",
+  "刷",
+  "耍",
+  "摔",
+  "帅",
+  "双",
+  "爽",
+  "水",
+  "税",
+  "睡",
+  "顺",
+  "说",
+  "硕",
+  "丝",
+  "司",
+  "私",
+  "思",
+  "斯",
+  "死",
+  "巳",
+  "四",
+  "似",
+  "松",
+  "宋",
+  "送",
+  "搜",
+  "苏",
+  "稣",
+  "俗",
+  "诉",
+  "素",
+  "速",
+  "宿",
+  "塑",
+  "酸",
+  "算",
+  "虽",
+  "随",
+  "岁",
+  "碎",
+  "孙",
+  "损",
+  "缩",
+  "所",
+  "索",
+  "锁",
+  "他",
+  "它",
+  "她",
+  "塔",
+  "踏",
+  "胎",
+  "台",
+  "抬",
+  "太",
+  "态",
+  "泰",
+  "贪",
+  "摊",
+  "坛",
+  "谈",
+  "檀",
+  "坦",
+  "叹",
+  "探",
+  "汤",
+  "唐",
+  "堂",
+  "糖",
+  "涛",
+  "逃",
+  "桃",
+  "陶",
+  "淘",
+  "萄",
+  "讨",
+  "套",
+  "特",
+  "疼",
+  "腾",
+  "藤",
+  "梯",
+  "踢",
+  "提",
+  "题",
+  "体",
+  "替",
+  "天",
+  "添",
+  "田",
+  "甜",
+  "填",
+  "挑",
+  "条",
+  "跳",
+  "帖",
+  "贴",
+  "铁",
+  "厅",
+  "听",
+  "廷",
+  "庭",
+  "停",
+  "挺",
+  "通",
+  "同",
+  "铜",
+  "童",
+  "统",
+  "痛",
+  "偷",
+  "头",
+  "投",
+  "透",
+  "突",
+  "图",
+  "徒",
+  "途",
+  "屠",
+  "土",
+  "吐",
+  "兔",
+  "团",
+  "推",
+  "腿",
+  "退",
+  "托",
+  "拖",
+  "脱",
+  "陀",
+  "妥",
+  "挖",
+  "蛙",
+  "娃",
+  "瓦",
+  "佤",
+  "哇",
+  "歪",
+  "崴",
+  "外",
+  "弯",
+  "湾",
+  "丸",
+  "完",
+  "玩",
+  "顽",
+  "宛",
+  "晚",
+  "碗",
+  "万",
+  "汪",
+  "亡",
+  "王",
+  "网",
+  "往",
+  "忘",
+  "旺",
+  "望",
+  "危",
+  "威",
+  "微",
+  "韦",
+  "围",
+  "违",
+  "唯",
+  "维",
+  "伟",
+  "尾",
+  "委",
+  "卫",
+  "为",
+  "未",
+  "位",
+  "味",
+  "谓",
+  "喂",
+  "慰",
+  "温",
+  "文",
+  "闻",
+  "雯",
+  "吻",
+  "稳",
+  "问",
+  "汶",
+  "翁",
+  "挝",
+  "窝",
+  "我",
+  "沃",
+  "握",
+  "乌",
+  "污",
+  "呜",
+  "巫",
+  "屋",
+  "无",
+  "吾",
+  "五",
+  "午",
+  "伍",
+  "武",
+  "舞",
+  "勿",
+  "务",
+  "戊",
+  "物",
+  "误",
+  "悟",
+  "雾",
+  "夕",
+  "兮",
+  "吸",
+  "西",
+  "希",
+  "析",
+  "息",
+  "牺",
+  "悉",
+  "惜",
+  "稀",
+  "溪",
+  "锡",
+  "嘻",
+  "习",
+  "席",
+  "袭",
+  "洗",
+  "喜",
+  "戏",
+  "系",
+  "细",
+  "虾",
+  "侠",
+  "峡",
+  "下",
+  "吓",
+  "夏",
+  "仙",
+  "先",
+  "鲜",
+  "闲",
+  "弦",
+  "贤",
+  "嫌",
+  "显",
+  "险",
+  "县",
+  "岘",
+  "现",
+  "线",
+  "限",
+  "宪",
+  "陷",
+  "献",
+  "乡",
+  "相",
+  "香",
+  "箱",
+  "详",
+  "祥",
+  "翔",
+  "享",
+  "响",
+  "想",
+  "向",
+  "巷",
+  "项",
+  "象",
+  "像",
+  "消",
+  "萧",
+  "销",
+  "小",
+  "晓",
+  "孝",
+  "肖",
+  "效",
+  "校",
+  "笑",
+  "些",
+  "协",
+  "邪",
+  "胁",
+  "斜",
+  "鞋",
+  "写",
+  "械",
+  "谢",
+  "蟹",
+  "心",
+  "辛",
+  "欣",
+  "新",
+  "薪",
+  "馨",
+  "信",
+  "星",
+  "刑",
+  "行",
+  "形",
+  "型",
+  "醒",
+  "兴",
+  "姓",
+  "幸",
+  "性",
+  "兄",
+  "匈",
+  "胸",
+  "雄",
+  "熊",
+  "休",
+  "修",
+  "羞",
+  "秀",
+  "戌",
+  "须",
+  "需",
+  "徐",
+  "许",
+  "旭",
+  "序",
+  "叙",
+  "绪",
+  "续",
+  "轩",
+  "宣",
+  "玄",
+  "旋",
+  "选",
+  "学",
+  "雪",
+  "血",
+  "勋",
+  "寻",
+  "巡",
+  "询",
+  "循",
+  "训",
+  "讯",
+  "迅",
+  "逊",
+  "压",
+  "鸭",
+  "牙",
+  "琊",
+  "涯",
+  "雅",
+  "亚",
+  "呀",
+  "延",
+  "严",
+  "言",
+  "沿",
+  "炎",
+  "研",
+  "掩",
+  "眼",
+  "演",
+  "厌",
+  "宴",
+  "验",
+  "燕",
+  "央",
+  "扬",
+  "羊",
+  "阳",
+  "杨",
+  "洋",
+  "仰",
+  "养",
+  "样",
+  "妖",
+  "腰",
+  "邀",
+  "瑶",
+  "咬",
+  "药",
+  "要",
+  "耀",
+  "椰",
+  "爷",
+  "耶",
+  "也",
+  "野",
+  "业",
+  "叶",
+  "页",
+  "夜",
+  "液",
+  "一",
+  "伊",
+  "衣",
+  "医",
+  "依",
+  "仪",
+  "夷",
+  "宜",
+  "怡",
+  "咦",
+  "移",
+  "遗",
+  "疑",
+  "彝",
+  "乙",
+  "已",
+  "以",
+  "矣",
+  "蚁",
+  "倚",
+  "椅",
+  "义",
+  "亿",
+  "忆",
+  "艺",
+  "议",
+  "亦",
+  "异",
+  "役",
+  "抑",
+  "译",
+  "易",
+  "益",
+  "谊",
+  "逸",
+  "意",
+  "毅",
+  "翼",
+  "因",
+  "阴",
+  "音",
+  "吟",
+  "寅",
+  "银",
+  "引",
+  "饮",
+  "隐",
+  "印",
+  "应",
+  "英",
+  "樱",
+  "鹰",
+  "迎",
+  "盈",
+  "萤",
+  "营",
+  "赢",
+  "影",
+  "映",
+  "硬",
+  "哟",
+  "唷",
+  "拥",
+  "庸",
+  "永",
+  "泳",
+  "勇",
+  "用",
+  "优",
+  "忧",
+  "呦",
+  "幽",
+  "悠",
+  "尤",
+  "由",
+  "犹",
+  "邮",
+  "油",
+  "游",
+  "友",
+  "有",
+  "酉",
+  "又",
+  "右",
+  "幼",
+  "佑",
+  "于",
+  "余",
+  "於",
+  "鱼",
+  "娱",
+  "愉",
+  "愚",
+  "瑜",
+  "与",
+  "予",
+  "宇",
+  "羽",
+  "雨",
+  "语",
+  "玉",
+  "育",
+  "狱",
+  "浴",
+  "预",
+  "域",
+  "欲",
+  "喻",
+  "裕",
+  "遇",
+  "愈",
+  "誉",
+  "元",
+  "员",
+  "园",
+  "原",
+  "圆",
+  "援",
+  "缘",
+  "源",
+  "远",
+  "怨",
+  "院",
+  "曰",
+  "约",
+  "月",
+  "岳",
+  "阅",
+  "跃",
+  "粤",
+  "越",
+  "云",
+  "允",
+  "孕",
+  "运",
+  "杂",
+  "哉",
+  "再",
+  "在",
+  "载",
+  "咱",
+  "暂",
+  "赞",
+  "遭",
+  "糟",
+  "早",
+  "造",
+  "则",
+  "择",
+  "泽",
+  "责",
+  "贼",
+  "怎",
+  "增",
+  "赠",
+  "扎",
+  "渣",
+  "札",
+  "乍",
+  "炸",
+  "斋",
+  "摘",
+  "寨",
+  "展",
+  "占",
+  "战",
+  "站",
+  "张",
+  "章",
+  "彰",
+  "长",
+  "涨",
+  "掌",
+  "丈",
+  "帐",
+  "障",
+  "招",
+  "昭",
+  "爪",
+  "找",
+  "召",
+  "兆",
+  "赵",
+  "照",
+  "遮",
+  "折",
+  "哲",
+  "者",
+  "这",
+  "浙",
+  "着",
+  "贞",
+  "针",
+  "侦",
+  "珍",
+  "真",
+  "祯",
+  "圳",
+  "阵",
+  "振",
+  "镇",
+  "震",
+  "争",
+  "征",
+  "整",
+  "正",
+  "证",
+  "郑",
+  "政",
+  "之",
+  "支",
+  "芝",
+  "枝",
+  "知",
+  "织",
+  "执",
+  "直",
+  "值",
+  "职",
+  "植",
+  "止",
+  "只",
+  "旨",
+  "址",
+  "纸",
+  "指",
+  "徵",
+  "至",
+  "志",
+  "制",
+  "治",
+  "质",
+  "秩",
+  "致",
+  "智",
+  "置",
+  "雉",
+  "中",
+  "忠",
+  "终",
+  "钟",
+  "锺",
+  "种",
+  "仲",
+  "众",
+  "重",
+  "州",
+  "舟",
+  "周",
+  "洲",
+  "宙",
+  "骤",
+  "朱",
+  "珠",
+  "诸",
+  "猪",
+  "铢",
+  "竹",
+  "逐",
+  "主",
+  "煮",
+  "住",
+  "助",
+  "注",
+  "驻",
+  "祝",
+  "著",
+  "筑",
+  "抓",
+  "专",
+  "转",
+  "赚",
+  "装",
+  "壮",
+  "状",
+  "撞",
+  "追",
+  "准",
+  "捉",
+  "桌",
+  "卓",
+  "孜",
+  "兹",
+  "咨",
+  "姿",
+  "资",
+  "滋",
+  "子",
+  "仔",
+  "姊",
+  "紫",
+  "字",
+  "自",
+  "宗",
+  "综",
+  "总",
+  "纵",
+  "走",
+  "奏",
+  "租",
+  "足",
+  "卒",
+  "族",
+  "阻",
+  "组",
+  "祖",
+  "钻",
+  "嘴",
+  "最",
+  "罪",
+  "醉",
+  "尊",
+  "遵",
+  "昨",
+  "左",
+  "佐",
+  "作",
+  "坐",
+  "祚",
+  "座",
+  "做",
+};
+const char *ALPHA_339_DIGITS[] = {
+};
+const uint32_t ALPHA_339_UPPER_CPS[] = {
+  19968, 19969, 19971, 19975, 19976, 19977, 19978, 19979, 19980, 19981, 19982, 19985, 19987, 19988, 19990, 19992,
+  19993, 19994, 19996, 19997, 20002, 20004, 20005, 20007, 20010, 20013, 20016, 20018, 20020, 20024, 20025, 20026,
+  20027, 20029, 20030, 20035, 20037, 20040, 20041, 20043, 20044, 20045, 20046, 20047, 20048, 20052, 20054, 20056,
+  20057, 20061, 20063, 20064, 20065, 20070, 20080, 20081, 20094, 20102, 20104, 20105, 20107, 20108, 20110, 20111,
+  20113, 20114, 20116, 20117, 20122, 20123, 20129, 20132, 20133, 20134, 20135, 20136, 20139, 20140, 20142, 20146,
+  20154, 20159, 20160, 20161, 20165, 20167, 20170, 20171, 20173, 20174, 20180, 20182, 20184, 20185, 20195, 20196,
+  20197, 20202, 20204, 20208, 20210, 20214, 20215, 20219, 20221, 20223, 20225, 20234, 20237, 20239, 20240, 20241,
+  20247, 20248, 20249, 20250, 20255, 20256, 20260, 20262, 20271, 20272, 20276, 20280, 20284, 20285, 20294, 20301,
+  20302, 20303, 20304, 20305, 20307, 20309, 20313, 20315, 20316, 20320, 20324, 20329, 20339, 20351, 20363, 20379,
+  20381, 20384, 20390, 20391, 20392, 20396, 20399, 20405, 20415, 20419, 20420, 20426, 20439, 20445, 20449, 20457,
+  20462, 20465, 20478, 20493, 20498, 20505, 20506, 20511, 20518, 20540, 20542, 20551, 20556, 20559, 20570, 20572,
+  20581, 20598, 20599, 20648, 20652, 20658, 20667, 20687, 20711, 20754, 20799, 20801, 20803, 20804, 20805, 20806,
+  20808, 20809, 20811, 20813, 20817, 20820, 20826, 20837, 20840, 20843, 20844, 20845, 20846, 20848, 20849, 20851,
+  20852, 20853, 20854, 20855, 20856, 20857, 20859, 20860, 20861, 20869, 20872, 20876, 20877, 20882, 20889, 20891,
+  20892, 20896, 20908, 20912, 20914, 20915, 20917, 20919, 20934, 20940, 20943, 20957, 20960, 20961, 20964, 20973,
+  20975, 20976, 20986, 20987, 20989, 20992, 20998, 20999, 21002, 21009, 21010, 21015, 21016, 21017, 21018, 21019,
+  21021, 21028, 21033, 21035, 21040, 21046, 21047, 21048, 21050, 21051, 21058, 21069, 21073, 21095, 21097, 21098,
+  21103, 21106, 21147, 21149, 21150, 21151, 21152, 21153, 21155, 21160, 21161, 21162, 21163, 21169, 21170, 21171,
+  21183, 21191, 21193, 21195, 21202, 21220, 21246, 21247, 21253, 21254, 21256, 21270, 21271, 21273, 21305, 21306,
+  21307, 21313, 21315, 21319, 21320, 21322, 21326, 21327, 21330, 21331, 21333, 21334, 21335, 21338, 21344, 21345,
+  21346, 21355, 21359, 21360, 21361, 21363, 21364, 21367, 21378, 21380, 21381, 21382, 21385, 21387, 21388, 21389,
+  21402, 21407, 21435, 21439, 21442, 21448, 21449, 21450, 21451, 21452, 21453, 21457, 21460, 21462, 21463, 21464,
+  21465, 21475, 21476, 21477, 21478, 21482, 21483, 21484, 21485, 21487, 21488, 21490, 21491, 21494, 21495, 21496,
+  21497, 21507, 21508, 21512, 21513, 21514, 21516, 21517, 21518, 21520, 21521, 21523, 21527, 21531, 21533, 21535,
+  21542, 21543, 21547, 21548, 21551, 21557, 21560, 21561, 21563, 21566, 21568, 21574, 21576, 21578, 21584, 21592,
+  21596, 21602, 21606, 21608, 21619, 21621, 21628, 21629, 21644, 21654, 21670, 21671, 21672, 21674, 21676, 21679,
+  21681, 21696, 21697, 21703, 21704, 21705, 21709, 21710, 21727, 21733, 21734, 21737, 21738, 21741, 21746, 21769,
+  21776, 21796, 21804, 21806, 21807, 21809, 21815, 21830, 21834, 21857, 21861, 21862, 21866, 21888, 21890, 21892,
+  21895, 21898, 21903, 21908, 21916, 21917, 21941, 21943, 21947, 21970, 21992, 21999, 22025, 22043, 22068, 22075,
+  22079, 22120, 22235, 22238, 22240, 22242, 22253, 22256, 22260, 22266, 22269, 22270, 22278, 22280, 22303, 22307,
+  22312, 22317, 22320, 22323, 22330, 22334, 22336, 22343, 22350, 22352, 22353, 22359, 22362, 22363, 22364, 22369,
+  22372, 22374, 22378, 22402, 22403, 22411, 22418, 22467, 22475, 22478, 22484, 22495, 22521, 22522, 22530, 22534,
+  22549, 22561, 22570, 22609, 22612, 22622, 22635, 22659, 22686, 22696, 22721, 22756, 22763, 22764, 22766, 22768,
+  22788, 22791, 22797, 22799, 22805, 22806, 22810, 22812, 22815, 22821, 22823, 22825, 22826, 22827, 22830, 22833,
+  22836, 22839, 22840, 22841, 22842, 22855, 22856, 22857, 22859, 22863, 22865, 22868, 22870, 22871, 22885, 22899,
+  22900, 22902, 22905, 22909, 22914, 22919, 22920, 22934, 22937, 22949, 22952, 22958, 22969, 22971, 22982, 22986,
+  22987, 22992, 22993, 22995, 22996, 23039, 23041, 23043, 23044, 23064, 23068, 23071, 23089, 23110, 23130, 23186,
+  23233, 23244, 23273, 23376, 23380, 23381, 23383, 23384, 23385, 23388, 23389, 23391, 23395, 23396, 23398, 23401,
+  23425, 23427, 23431, 23432, 23433, 23435, 23436, 23439, 23447, 23448, 23449, 23450, 23451, 23452, 23453, 23454,
+  23457, 23458, 23459, 23460, 23466, 23475, 23476, 23478, 23481, 23485, 23486, 23487, 23490, 23492, 23493, 23494,
+  23495, 23500, 23506, 23517, 23518, 23519, 23521, 23528, 23544, 23545, 23547, 23548, 23551, 23553, 23556, 23558,
+  23562, 23567, 23569, 23572, 23574, 23576, 23578, 23581, 23588, 23601, 23610, 23612, 23613, 23614, 23616, 23617,
+  23618, 23621, 23627, 23631, 23637, 23646, 23648, 23665, 23681, 23682, 23703, 23704, 23706, 23707, 23731, 23736,
+  23777, 23792, 23815, 23849, 23860, 24029, 24030, 24033, 24037, 24038, 24039, 24040, 24043, 24046, 24049, 24050,
+  24051, 24052, 24055, 24065, 24066, 24067, 24069, 24072, 24076, 24080, 24085, 24086, 24093, 24102, 24109, 24110,
+  24120, 24125, 24133, 24149, 24178, 24179, 24180, 24182, 24184, 24187, 24188, 24189, 24191, 24198, 24202, 24207,
+  24211, 24212, 24213, 24215, 24217, 24218, 24220, 24222, 24223, 24230, 24231, 24237, 24247, 24248, 24265, 24278,
+  24310, 24311, 24314, 24320, 24322, 24323, 24324, 24330, 24335, 24341, 24343, 24344, 24351, 24352, 24357, 24358,
+  24367, 24369, 24377, 24378, 24402, 24403, 24405, 24413, 24418, 24425, 24428, 24429, 24432, 24433, 24439, 24441,
+  24443, 24444, 24448, 24449, 24452, 24453, 24456, 24459, 24460, 24464, 24466, 24471, 24490, 24494, 24501, 24503,
+  24515, 24517, 24518, 24524, 24525, 24535, 24536, 24537, 24544, 24551, 24555, 24565, 24573, 24576, 24577, 24590,
+  24594, 24597, 24598, 24605, 24609, 24613, 24615, 24616, 24618, 24635, 24651, 24656, 24674, 24680, 24681, 24685,
+  24687, 24688, 24694, 24700, 24708, 24713, 24724, 24735, 24736, 24739, 24744, 24754, 24773, 24785, 24796, 24800,
+  24807, 24808, 24815, 24819, 24825, 24833, 24840, 24841, 24847, 24858, 24863, 24871, 24904, 24910, 24917, 24930,
+  24935, 24944, 25022, 25026, 25042, 25096, 25098, 25100, 25103, 25104, 25105, 25106, 25110, 25112, 25130, 25140,
+  25143, 25151, 25152, 25153, 25159, 25163, 25165, 25166, 25169, 25171, 25176, 25187, 25191, 25193, 25195, 25196,
+  25197, 25198, 25199, 25209, 25214, 25215, 25216, 25220, 25226, 25233, 25235, 25237, 25239, 25240, 25250, 25252,
+  25253, 25259, 25260, 25265, 25269, 25273, 25277, 25285, 25286, 25289, 25293, 25298, 25300, 25302, 25304, 25307,
+  25308, 25311, 25317, 25318, 25320, 25321, 25324, 25331, 25335, 25340, 25342, 25343, 25345, 25351, 25353, 25361,
+  25366, 25373, 25377, 25380, 25381, 25386, 25391, 25402, 25417, 25424, 25429, 25439, 25441, 25442, 25454, 25463,
+  25480, 25481, 25484, 25490, 25506, 25509, 25511, 25512, 25513, 25514, 25528, 25551, 25552, 25554, 25569, 25588,
+  25628, 25630, 25644, 25645, 25668, 25670, 25674, 25684, 25688, 25705, 25720, 25746, 25758, 25773, 25805, 25806,
+  25830, 25903, 25910, 25913, 25915, 25918, 25919, 25925, 25928, 25932, 25935, 25937, 25945, 25949, 25954, 25955,
+  25958, 25964, 25968, 25970, 25972, 25991, 25995, 26000, 26007, 26009, 26012, 26021, 26029, 26031, 26032, 26041,
+  26044, 26045, 26049, 26053, 26059, 26063, 26071, 26080, 26082, 26085, 26086, 26087, 26088, 26089, 26093, 26102,
+  26106, 26114, 26118, 26124, 26126, 26127, 26131, 26143, 26144, 26149, 26152, 26157, 26159, 26174, 26179, 26187,
+  26194, 26195, 26202, 26216, 26222, 26223, 26228, 26230, 26234, 26242, 26257, 26262, 26263, 26286, 26292, 26352,
+  26354, 26356, 26361, 26364, 26366, 26367, 26368, 26376, 26377, 26379, 26381, 26391, 26395, 26397, 26399, 26408,
+  26410, 26411, 26412, 26413, 26415, 26417, 26421, 26426, 26432, 26434, 26435, 26441, 26446, 26448, 26449, 26460,
+  26463, 26465, 26469, 26472, 26479, 26480, 26494, 26495, 26497, 26500, 26512, 26519, 26524, 26525, 26530, 26538,
+  26539, 26550, 26575, 26576, 26579, 26580, 26597, 26604, 26607, 26611, 26612, 26631, 26635, 26639, 26641, 26657,
+  26679, 26680, 26681, 26684, 26691, 26694, 26696, 26700, 26705, 26723, 26725, 26753, 26757, 26790, 26799, 26800,
+  26805, 26816, 26825, 26827, 26834, 26842, 26862, 26885, 26893, 26928, 26970, 27004, 27010, 27036, 27169, 27185,
+  27264, 27424, 27425, 27426, 27427, 27431, 27442, 27450, 27454, 27465, 27468, 27490, 27491, 27492, 27493, 27494,
+  27498, 27515, 27530, 27531, 27573, 27589, 27597, 27599, 27602, 27604, 27605, 27611, 27627, 27663, 27665, 27668,
+  27675, 27700, 27704, 27714, 27719, 27721, 27735, 27741, 27743, 27744, 27745, 27748, 27754, 27766, 27773, 27779,
+  27784, 27785, 27801, 27807, 27809, 27815, 27827, 27833, 27835, 27839, 27849, 27850, 27861, 27867, 27873, 27874,
+  27875, 27877, 27880, 27888, 27891, 27901, 27915, 27927, 27931, 27934, 27941, 27946, 27954, 27963, 27965, 27966,
+  27969, 27973, 27979, 27982, 27983, 27985, 27987, 27993, 28006, 28009, 28010, 28014, 28020, 28023, 28037, 28040,
+  28041, 28059, 28072, 28079, 28082, 28085, 28107, 28113, 28120, 28129, 28145, 28151, 28155, 28165, 28176, 28193,
+  28195, 28201, 28207, 28212, 28216, 28246, 28286, 28304, 28316, 28330, 28363, 28369, 28385, 28389, 28392, 28404,
+  28418, 28431, 28436, 28448, 28459, 28504, 28508, 28526, 28558, 28595, 28608, 28748, 28779, 28781, 28783, 28784,
+  28789, 28799, 28809, 28814, 28846, 28856, 28857, 28866, 28872, 28900, 28902, 28903, 28909, 28966, 28982, 29004,
+  29022, 29031, 29038, 29066, 29087, 29123, 29141, 29190, 29226, 29228, 29233, 29237, 29238, 29239, 29240, 29245,
+  29255, 29256, 29260, 29273, 29275, 29281, 29282, 29287, 29289, 29298, 29301, 29305, 29306, 29359, 29366, 29369,
+  29378, 29392, 29399, 29408, 29420, 29422, 29425, 29436, 29467, 29468, 29482, 29486, 29492, 29572, 29575, 29577,
+  29579, 29595, 29609, 29611, 29615, 29616, 29618, 29627, 29632, 29642, 29645, 29664, 29677, 29699, 29702, 29706,
+  29738, 29747, 29748, 29756, 29785, 29788, 29790, 29791, 29808, 29814, 29827, 29916, 29926, 29942, 29976, 29978,
+  29980, 29983, 29992, 30000, 30001, 30002, 30003, 30005, 30007, 30008, 30011, 30021, 30028, 30041, 30053, 30058,
+  30086, 30095, 30097, 30103, 30127, 30130, 30140, 30142, 30149, 30165, 30171, 30196, 30328, 30331, 30333, 30334,
+  30340, 30342, 30343, 30382, 30408, 30410, 30417, 30418, 30422, 30424, 30427, 30431, 30446, 30452, 30456, 30460,
+  30462, 30465, 30473, 30475, 30495, 30496, 30524, 30528, 30555, 30561, 30563, 30631, 30683, 30691, 30693, 30701,
+  30707, 30710, 30721, 30722, 30733, 30740, 30772, 30784, 30805, 30828, 30830, 30861, 30862, 30871, 30879, 30887,
+  30896, 30913, 30917, 30952, 31034, 31036, 31038, 31062, 31066, 31069, 31070, 31077, 31080, 31087, 31096, 31105,
+  31109, 31119, 31163, 31168, 31169, 31179, 31181, 31185, 31186, 31192, 31199, 31204, 31206, 31209, 31215, 31216,
+  31227, 31232, 31243, 31245, 31246, 31267, 31283, 31295, 31302, 31350, 31351, 31353, 31354, 31359, 31361, 31383,
+  31389, 31435, 31449, 31454, 31455, 31456, 31461, 31471, 31481, 31505, 31508, 31515, 31526, 31528, 31532, 31561,
+  31563, 31569, 31572, 31574, 31609, 31614, 31616, 31639, 31649, 31661, 31665, 31687, 31726, 31807, 31821, 31859,
+  31867, 31881, 31890, 31895, 31908, 31929, 31934, 31946, 31957, 31958, 31967, 31995, 32032, 32034, 32039, 32043,
+  32047, 32321, 32418, 32422, 32423, 32426, 32431, 32434, 32435, 32437, 32439, 32440, 32445, 32447, 32451, 32452,
+  32454, 32455, 32456, 32461, 32463, 32467, 32469, 32472, 32473, 32476, 32477, 32479, 32487, 32489, 32490, 32493,
+  32500, 32501, 32508, 32511, 32517, 32531, 32534, 32536, 32544, 32553, 32564, 32566, 32568, 32570, 32592, 32593,
+  32597, 32599, 32602, 32610, 32618, 32622, 32626, 32650, 32654, 32670, 32676, 32687, 32701, 32705, 32709, 32724,
+  32728, 32736, 32752, 32763, 32764, 32768, 32769, 32771, 32773, 32780, 32781, 32784, 32791, 32819, 32822, 32842,
+  32844, 32852, 32856, 32858, 32874, 32905, 32918, 32922, 32929, 32932, 32933, 32937, 32943, 32946, 32961, 32966,
+  32972, 32974, 32982, 32988, 32990, 32993, 33014, 33016, 33021, 33030, 33041, 33073, 33080, 33098, 33104, 33107,
+  33136, 33145, 33150, 33151, 33218, 33251, 33258, 33261, 33267, 33268, 33292, 33293, 33298, 33310, 33311, 33322,
+  33324, 33328, 33337, 33391, 33394, 33402, 33406, 33410, 33426, 33437, 33446, 33452, 33453, 33457, 33459, 33485,
+  33487, 33495, 33509, 33510, 33521, 33538, 33539, 33576, 33579, 33590, 33609, 33616, 33618, 33635, 33647, 33655,
+  33673, 33678, 33706, 33707, 33713, 33714, 33719, 33756, 33769, 33778, 33796, 33805, 33828, 33829, 33831, 33832,
+  33853, 33879, 33883, 33889, 33922, 33931, 33945, 33993, 34013, 34028, 34065, 34081, 34180, 34218, 34249, 34255,
+  34276, 34382, 34385, 34411, 34425, 34429, 34430, 34433, 34503, 34507, 34521, 34542, 34562, 34588, 34678, 34701,
+  34809, 34850, 34880, 34892, 34903, 34913, 34915, 34917, 34920, 34955, 34987, 34989, 35009, 35010, 35013, 35029,
+  35044, 35199, 35201, 35206, 35265, 35266, 35268, 35270, 35272, 35273, 35282, 35299, 35328, 35465, 35475, 35686,
+  35745, 35746, 35748, 35752, 35753, 35757, 35758, 35759, 35760, 35762, 35767, 35768, 35770, 35774, 35775, 35777,
+  35780, 35782, 35785, 35789, 35793, 35797, 35799, 35802, 35805, 35806, 35810, 35813, 35814, 35821, 35823, 35828,
+  35831, 35832, 35834, 35835, 35838, 35841, 35843, 35845, 35848, 35850, 35851, 35859, 35868, 35874, 35880, 35889,
+  35895, 35910, 35937, 35946, 35980, 36125, 36126, 36127, 36129, 36130, 36131, 36132, 36133, 36135, 36136, 36137,
+  36138, 36141, 36143, 36145, 36148, 36149, 36152, 36153, 36154, 36156, 36158, 36164, 36171, 36172, 36175, 36176,
+  36180, 36182, 36186, 36187, 36190, 36192, 36194, 36196, 36203, 36208, 36213, 36215, 36225, 36229, 36234, 36235,
+  36259, 36275, 36291, 36300, 36305, 36317, 36319, 36335, 36339, 36367, 36386, 36393, 36523, 36530, 36710, 36712,
+  36713, 36716, 36718, 36719, 36720, 36731, 36733, 36739, 36741, 36742, 36744, 36745, 36753, 36755, 36763, 36766,
+  36776, 36777, 36784, 36785, 36793, 36798, 36801, 36805, 36807, 36808, 36814, 36816, 36817, 36820, 36824, 36825,
+  36827, 36828, 36829, 36830, 36831, 36838, 36842, 36843, 36848, 36855, 36861, 36864, 36865, 36866, 36867, 36870,
+  36873, 36874, 36879, 36880, 36882, 36884, 36890, 36891, 36893, 36895, 36896, 36898, 36920, 36923, 36924, 36935,
+  36941, 36947, 36951, 36973, 36974, 36981, 36991, 36992, 37011, 37027, 37030, 37034, 37038, 37041, 37051, 37070,
+  37073, 37096, 37101, 37117, 37122, 37193, 37195, 37197, 37202, 37239, 37240, 37257, 37266, 37319, 37322, 37324,
+  37325, 37326, 37327, 37329, 38024, 38035, 38047, 38050, 38054, 38065, 38075, 38081, 38083, 38108, 38114, 38125,
+  38134, 38138, 38142, 38144, 38145, 38149, 38155, 38169, 38177, 38182, 38190, 38202, 38215, 38236, 38253, 38271,
+  38376, 38378, 38381, 38382, 38384, 38386, 38388, 38391, 38393, 38395, 38401, 38405, 38416, 38420, 38431, 38446,
+  38450, 38451, 38452, 38453, 38454, 38459, 38463, 38464, 38468, 38469, 38470, 38472, 38477, 38480, 38498, 38500,
+  38505, 38506, 38517, 38518, 38519, 38534, 38543, 38544, 38548, 38556, 38590, 38596, 38597, 38598, 38601, 38632,
+  38634, 38639, 38643, 38646, 38647, 38654, 38656, 38663, 38669, 38678, 38706, 38712, 38713, 38738, 38742, 38745,
+  38750, 38752, 38754, 38761, 38780, 38795, 38801, 38886, 38889, 38899, 39029, 39030, 39033, 39034, 39035, 39037,
+  39038, 39039, 39044, 39046, 39047, 39057, 39063, 39064, 39069, 39118, 39128, 39129, 39134, 39135, 39184, 39277,
+  39278, 39280, 39281, 39292, 39302, 39318, 39321, 39336, 39532, 39537, 39542, 39547, 39550, 39564, 39569, 39575,
+  39578, 39588, 39592, 39640, 39740, 39746, 39749, 39764, 40060, 40065, 40092, 40479, 40481, 40483, 40493, 40511,
+  40517, 40548, 40560, 40575, 40614, 40635, 40644, 40654, 40657, 40664, 40723, 40736, 40763, 40784, 40831, 40836,
+  40857, 40863,
+};
+const uint32_t ALPHA_339_LOWER_CPS[] = {
+  19968, 19969, 19971, 19975, 19976, 19977, 19978, 19979, 19980, 19981, 19982, 19985, 19987, 19988, 19990, 19992,
+  19993, 19994, 19996, 19997, 20002, 20004, 20005, 20007, 20010, 20013, 20016, 20018, 20020, 20024, 20025, 20026,
+  20027, 20029, 20030, 20035, 20037, 20040, 20041, 20043, 20044, 20045, 20046, 20047, 20048, 20052, 20054, 20056,
+  20057, 20061, 20063, 20064, 20065, 20070, 20080, 20081, 20094, 20102, 20104, 20105, 20107, 20108, 20110, 20111,
+  20113, 20114, 20116, 20117, 20122, 20123, 20129, 20132, 20133, 20134, 20135, 20136, 20139, 20140, 20142, 20146,
+  20154, 20159, 20160, 20161, 20165, 20167, 20170, 20171, 20173, 20174, 20180, 20182, 20184, 20185, 20195, 20196,
+  20197, 20202, 20204, 20208, 20210, 20214, 20215, 20219, 20221, 20223, 20225, 20234, 20237, 20239, 20240, 20241,
+  20247, 20248, 20249, 20250, 20255, 20256, 20260, 20262, 20271, 20272, 20276, 20280, 20284, 20285, 20294, 20301,
+  20302, 20303, 20304, 20305, 20307, 20309, 20313, 20315, 20316, 20320, 20324, 20329, 20339, 20351, 20363, 20379,
+  20381, 20384, 20390, 20391, 20392, 20396, 20399, 20405, 20415, 20419, 20420, 20426, 20439, 20445, 20449, 20457,
+  20462, 20465, 20478, 20493, 20498, 20505, 20506, 20511, 20518, 20540, 20542, 20551, 20556, 20559, 20570, 20572,
+  20581, 20598, 20599, 20648, 20652, 20658, 20667, 20687, 20711, 20754, 20799, 20801, 20803, 20804, 20805, 20806,
+  20808, 20809, 20811, 20813, 20817, 20820, 20826, 20837, 20840, 20843, 20844, 20845, 20846, 20848, 20849, 20851,
+  20852, 20853, 20854, 20855, 20856, 20857, 20859, 20860, 20861, 20869, 20872, 20876, 20877, 20882, 20889, 20891,
+  20892, 20896, 20908, 20912, 20914, 20915, 20917, 20919, 20934, 20940, 20943, 20957, 20960, 20961, 20964, 20973,
+  20975, 20976, 20986, 20987, 20989, 20992, 20998, 20999, 21002, 21009, 21010, 21015, 21016, 21017, 21018, 21019,
+  21021, 21028, 21033, 21035, 21040, 21046, 21047, 21048, 21050, 21051, 21058, 21069, 21073, 21095, 21097, 21098,
+  21103, 21106, 21147, 21149, 21150, 21151, 21152, 21153, 21155, 21160, 21161, 21162, 21163, 21169, 21170, 21171,
+  21183, 21191, 21193, 21195, 21202, 21220, 21246, 21247, 21253, 21254, 21256, 21270, 21271, 21273, 21305, 21306,
+  21307, 21313, 21315, 21319, 21320, 21322, 21326, 21327, 21330, 21331, 21333, 21334, 21335, 21338, 21344, 21345,
+  21346, 21355, 21359, 21360, 21361, 21363, 21364, 21367, 21378, 21380, 21381, 21382, 21385, 21387, 21388, 21389,
+  21402, 21407, 21435, 21439, 21442, 21448, 21449, 21450, 21451, 21452, 21453, 21457, 21460, 21462, 21463, 21464,
+  21465, 21475, 21476, 21477, 21478, 21482, 21483, 21484, 21485, 21487, 21488, 21490, 21491, 21494, 21495, 21496,
+  21497, 21507, 21508, 21512, 21513, 21514, 21516, 21517, 21518, 21520, 21521, 21523, 21527, 21531, 21533, 21535,
+  21542, 21543, 21547, 21548, 21551, 21557, 21560, 21561, 21563, 21566, 21568, 21574, 21576, 21578, 21584, 21592,
+  21596, 21602, 21606, 21608, 21619, 21621, 21628, 21629, 21644, 21654, 21670, 21671, 21672, 21674, 21676, 21679,
+  21681, 21696, 21697, 21703, 21704, 21705, 21709, 21710, 21727, 21733, 21734, 21737, 21738, 21741, 21746, 21769,
+  21776, 21796, 21804, 21806, 21807, 21809, 21815, 21830, 21834, 21857, 21861, 21862, 21866, 21888, 21890, 21892,
+  21895, 21898, 21903, 21908, 21916, 21917, 21941, 21943, 21947, 21970, 21992, 21999, 22025, 22043, 22068, 22075,
+  22079, 22120, 22235, 22238, 22240, 22242, 22253, 22256, 22260, 22266, 22269, 22270, 22278, 22280, 22303, 22307,
+  22312, 22317, 22320, 22323, 22330, 22334, 22336, 22343, 22350, 22352, 22353, 22359, 22362, 22363, 22364, 22369,
+  22372, 22374, 22378, 22402, 22403, 22411, 22418, 22467, 22475, 22478, 22484, 22495, 22521, 22522, 22530, 22534,
+  22549, 22561, 22570, 22609, 22612, 22622, 22635, 22659, 22686, 22696, 22721, 22756, 22763, 22764, 22766, 22768,
+  22788, 22791, 22797, 22799, 22805, 22806, 22810, 22812, 22815, 22821, 22823, 22825, 22826, 22827, 22830, 22833,
+  22836, 22839, 22840, 22841, 22842, 22855, 22856, 22857, 22859, 22863, 22865, 22868, 22870, 22871, 22885, 22899,
+  22900, 22902, 22905, 22909, 22914, 22919, 22920, 22934, 22937, 22949, 22952, 22958, 22969, 22971, 22982, 22986,
+  22987, 22992, 22993, 22995, 22996, 23039, 23041, 23043, 23044, 23064, 23068, 23071, 23089, 23110, 23130, 23186,
+  23233, 23244, 23273, 23376, 23380, 23381, 23383, 23384, 23385, 23388, 23389, 23391, 23395, 23396, 23398, 23401,
+  23425, 23427, 23431, 23432, 23433, 23435, 23436, 23439, 23447, 23448, 23449, 23450, 23451, 23452, 23453, 23454,
+  23457, 23458, 23459, 23460, 23466, 23475, 23476, 23478, 23481, 23485, 23486, 23487, 23490, 23492, 23493, 23494,
+  23495, 23500, 23506, 23517, 23518, 23519, 23521, 23528, 23544, 23545, 23547, 23548, 23551, 23553, 23556, 23558,
+  23562, 23567, 23569, 23572, 23574, 23576, 23578, 23581, 23588, 23601, 23610, 23612, 23613, 23614, 23616, 23617,
+  23618, 23621, 23627, 23631, 23637, 23646, 23648, 23665, 23681, 23682, 23703, 23704, 23706, 23707, 23731, 23736,
+  23777, 23792, 23815, 23849, 23860, 24029, 24030, 24033, 24037, 24038, 24039, 24040, 24043, 24046, 24049, 24050,
+  24051, 24052, 24055, 24065, 24066, 24067, 24069, 24072, 24076, 24080, 24085, 24086, 24093, 24102, 24109, 24110,
+  24120, 24125, 24133, 24149, 24178, 24179, 24180, 24182, 24184, 24187, 24188, 24189, 24191, 24198, 24202, 24207,
+  24211, 24212, 24213, 24215, 24217, 24218, 24220, 24222, 24223, 24230, 24231, 24237, 24247, 24248, 24265, 24278,
+  24310, 24311, 24314, 24320, 24322, 24323, 24324, 24330, 24335, 24341, 24343, 24344, 24351, 24352, 24357, 24358,
+  24367, 24369, 24377, 24378, 24402, 24403, 24405, 24413, 24418, 24425, 24428, 24429, 24432, 24433, 24439, 24441,
+  24443, 24444, 24448, 24449, 24452, 24453, 24456, 24459, 24460, 24464, 24466, 24471, 24490, 24494, 24501, 24503,
+  24515, 24517, 24518, 24524, 24525, 24535, 24536, 24537, 24544, 24551, 24555, 24565, 24573, 24576, 24577, 24590,
+  24594, 24597, 24598, 24605, 24609, 24613, 24615, 24616, 24618, 24635, 24651, 24656, 24674, 24680, 24681, 24685,
+  24687, 24688, 24694, 24700, 24708, 24713, 24724, 24735, 24736, 24739, 24744, 24754, 24773, 24785, 24796, 24800,
+  24807, 24808, 24815, 24819, 24825, 24833, 24840, 24841, 24847, 24858, 24863, 24871, 24904, 24910, 24917, 24930,
+  24935, 24944, 25022, 25026, 25042, 25096, 25098, 25100, 25103, 25104, 25105, 25106, 25110, 25112, 25130, 25140,
+  25143, 25151, 25152, 25153, 25159, 25163, 25165, 25166, 25169, 25171, 25176, 25187, 25191, 25193, 25195, 25196,
+  25197, 25198, 25199, 25209, 25214, 25215, 25216, 25220, 25226, 25233, 25235, 25237, 25239, 25240, 25250, 25252,
+  25253, 25259, 25260, 25265, 25269, 25273, 25277, 25285, 25286, 25289, 25293, 25298, 25300, 25302, 25304, 25307,
+  25308, 25311, 25317, 25318, 25320, 25321, 25324, 25331, 25335, 25340, 25342, 25343, 25345, 25351, 25353, 25361,
+  25366, 25373, 25377, 25380, 25381, 25386, 25391, 25402, 25417, 25424, 25429, 25439, 25441, 25442, 25454, 25463,
+  25480, 25481, 25484, 25490, 25506, 25509, 25511, 25512, 25513, 25514, 25528, 25551, 25552, 25554, 25569, 25588,
+  25628, 25630, 25644, 25645, 25668, 25670, 25674, 25684, 25688, 25705, 25720, 25746, 25758, 25773, 25805, 25806,
+  25830, 25903, 25910, 25913, 25915, 25918, 25919, 25925, 25928, 25932, 25935, 25937, 25945, 25949, 25954, 25955,
+  25958, 25964, 25968, 25970, 25972, 25991, 25995, 26000, 26007, 26009, 26012, 26021, 26029, 26031, 26032, 26041,
+  26044, 26045, 26049, 26053, 26059, 26063, 26071, 26080, 26082, 26085, 26086, 26087, 26088, 26089, 26093, 26102,
+  26106, 26114, 26118, 26124, 26126, 26127, 26131, 26143, 26144, 26149, 26152, 26157, 26159, 26174, 26179, 26187,
+  26194, 26195, 26202, 26216, 26222, 26223, 26228, 26230, 26234, 26242, 26257, 26262, 26263, 26286, 26292, 26352,
+  26354, 26356, 26361, 26364, 26366, 26367, 26368, 26376, 26377, 26379, 26381, 26391, 26395, 26397, 26399, 26408,
+  26410, 26411, 26412, 26413, 26415, 26417, 26421, 26426, 26432, 26434, 26435, 26441, 26446, 26448, 26449, 26460,
+  26463, 26465, 26469, 26472, 26479, 26480, 26494, 26495, 26497, 26500, 26512, 26519, 26524, 26525, 26530, 26538,
+  26539, 26550, 26575, 26576, 26579, 26580, 26597, 26604, 26607, 26611, 26612, 26631, 26635, 26639, 26641, 26657,
+  26679, 26680, 26681, 26684, 26691, 26694, 26696, 26700, 26705, 26723, 26725, 26753, 26757, 26790, 26799, 26800,
+  26805, 26816, 26825, 26827, 26834, 26842, 26862, 26885, 26893, 26928, 26970, 27004, 27010, 27036, 27169, 27185,
+  27264, 27424, 27425, 27426, 27427, 27431, 27442, 27450, 27454, 27465, 27468, 27490, 27491, 27492, 27493, 27494,
+  27498, 27515, 27530, 27531, 27573, 27589, 27597, 27599, 27602, 27604, 27605, 27611, 27627, 27663, 27665, 27668,
+  27675, 27700, 27704, 27714, 27719, 27721, 27735, 27741, 27743, 27744, 27745, 27748, 27754, 27766, 27773, 27779,
+  27784, 27785, 27801, 27807, 27809, 27815, 27827, 27833, 27835, 27839, 27849, 27850, 27861, 27867, 27873, 27874,
+  27875, 27877, 27880, 27888, 27891, 27901, 27915, 27927, 27931, 27934, 27941, 27946, 27954, 27963, 27965, 27966,
+  27969, 27973, 27979, 27982, 27983, 27985, 27987, 27993, 28006, 28009, 28010, 28014, 28020, 28023, 28037, 28040,
+  28041, 28059, 28072, 28079, 28082, 28085, 28107, 28113, 28120, 28129, 28145, 28151, 28155, 28165, 28176, 28193,
+  28195, 28201, 28207, 28212, 28216, 28246, 28286, 28304, 28316, 28330, 28363, 28369, 28385, 28389, 28392, 28404,
+  28418, 28431, 28436, 28448, 28459, 28504, 28508, 28526, 28558, 28595, 28608, 28748, 28779, 28781, 28783, 28784,
+  28789, 28799, 28809, 28814, 28846, 28856, 28857, 28866, 28872, 28900, 28902, 28903, 28909, 28966, 28982, 29004,
+  29022, 29031, 29038, 29066, 29087, 29123, 29141, 29190, 29226, 29228, 29233, 29237, 29238, 29239, 29240, 29245,
+  29255, 29256, 29260, 29273, 29275, 29281, 29282, 29287, 29289, 29298, 29301, 29305, 29306, 29359, 29366, 29369,
+  29378, 29392, 29399, 29408, 29420, 29422, 29425, 29436, 29467, 29468, 29482, 29486, 29492, 29572, 29575, 29577,
+  29579, 29595, 29609, 29611, 29615, 29616, 29618, 29627, 29632, 29642, 29645, 29664, 29677, 29699, 29702, 29706,
+  29738, 29747, 29748, 29756, 29785, 29788, 29790, 29791, 29808, 29814, 29827, 29916, 29926, 29942, 29976, 29978,
+  29980, 29983, 29992, 30000, 30001, 30002, 30003, 30005, 30007, 30008, 30011, 30021, 30028, 30041, 30053, 30058,
+  30086, 30095, 30097, 30103, 30127, 30130, 30140, 30142, 30149, 30165, 30171, 30196, 30328, 30331, 30333, 30334,
+  30340, 30342, 30343, 30382, 30408, 30410, 30417, 30418, 30422, 30424, 30427, 30431, 30446, 30452, 30456, 30460,
+  30462, 30465, 30473, 30475, 30495, 30496, 30524, 30528, 30555, 30561, 30563, 30631, 30683, 30691, 30693, 30701,
+  30707, 30710, 30721, 30722, 30733, 30740, 30772, 30784, 30805, 30828, 30830, 30861, 30862, 30871, 30879, 30887,
+  30896, 30913, 30917, 30952, 31034, 31036, 31038, 31062, 31066, 31069, 31070, 31077, 31080, 31087, 31096, 31105,
+  31109, 31119, 31163, 31168, 31169, 31179, 31181, 31185, 31186, 31192, 31199, 31204, 31206, 31209, 31215, 31216,
+  31227, 31232, 31243, 31245, 31246, 31267, 31283, 31295, 31302, 31350, 31351, 31353, 31354, 31359, 31361, 31383,
+  31389, 31435, 31449, 31454, 31455, 31456, 31461, 31471, 31481, 31505, 31508, 31515, 31526, 31528, 31532, 31561,
+  31563, 31569, 31572, 31574, 31609, 31614, 31616, 31639, 31649, 31661, 31665, 31687, 31726, 31807, 31821, 31859,
+  31867, 31881, 31890, 31895, 31908, 31929, 31934, 31946, 31957, 31958, 31967, 31995, 32032, 32034, 32039, 32043,
+  32047, 32321, 32418, 32422, 32423, 32426, 32431, 32434, 32435, 32437, 32439, 32440, 32445, 32447, 32451, 32452,
+  32454, 32455, 32456, 32461, 32463, 32467, 32469, 32472, 32473, 32476, 32477, 32479, 32487, 32489, 32490, 32493,
+  32500, 32501, 32508, 32511, 32517, 32531, 32534, 32536, 32544, 32553, 32564, 32566, 32568, 32570, 32592, 32593,
+  32597, 32599, 32602, 32610, 32618, 32622, 32626, 32650, 32654, 32670, 32676, 32687, 32701, 32705, 32709, 32724,
+  32728, 32736, 32752, 32763, 32764, 32768, 32769, 32771, 32773, 32780, 32781, 32784, 32791, 32819, 32822, 32842,
+  32844, 32852, 32856, 32858, 32874, 32905, 32918, 32922, 32929, 32932, 32933, 32937, 32943, 32946, 32961, 32966,
+  32972, 32974, 32982, 32988, 32990, 32993, 33014, 33016, 33021, 33030, 33041, 33073, 33080, 33098, 33104, 33107,
+  33136, 33145, 33150, 33151, 33218, 33251, 33258, 33261, 33267, 33268, 33292, 33293, 33298, 33310, 33311, 33322,
+  33324, 33328, 33337, 33391, 33394, 33402, 33406, 33410, 33426, 33437, 33446, 33452, 33453, 33457, 33459, 33485,
+  33487, 33495, 33509, 33510, 33521, 33538, 33539, 33576, 33579, 33590, 33609, 33616, 33618, 33635, 33647, 33655,
+  33673, 33678, 33706, 33707, 33713, 33714, 33719, 33756, 33769, 33778, 33796, 33805, 33828, 33829, 33831, 33832,
+  33853, 33879, 33883, 33889, 33922, 33931, 33945, 33993, 34013, 34028, 34065, 34081, 34180, 34218, 34249, 34255,
+  34276, 34382, 34385, 34411, 34425, 34429, 34430, 34433, 34503, 34507, 34521, 34542, 34562, 34588, 34678, 34701,
+  34809, 34850, 34880, 34892, 34903, 34913, 34915, 34917, 34920, 34955, 34987, 34989, 35009, 35010, 35013, 35029,
+  35044, 35199, 35201, 35206, 35265, 35266, 35268, 35270, 35272, 35273, 35282, 35299, 35328, 35465, 35475, 35686,
+  35745, 35746, 35748, 35752, 35753, 35757, 35758, 35759, 35760, 35762, 35767, 35768, 35770, 35774, 35775, 35777,
+  35780, 35782, 35785, 35789, 35793, 35797, 35799, 35802, 35805, 35806, 35810, 35813, 35814, 35821, 35823, 35828,
+  35831, 35832, 35834, 35835, 35838, 35841, 35843, 35845, 35848, 35850, 35851, 35859, 35868, 35874, 35880, 35889,
+  35895, 35910, 35937, 35946, 35980, 36125, 36126, 36127, 36129, 36130, 36131, 36132, 36133, 36135, 36136, 36137,
+  36138, 36141, 36143, 36145, 36148, 36149, 36152, 36153, 36154, 36156, 36158, 36164, 36171, 36172, 36175, 36176,
+  36180, 36182, 36186, 36187, 36190, 36192, 36194, 36196, 36203, 36208, 36213, 36215, 36225, 36229, 36234, 36235,
+  36259, 36275, 36291, 36300, 36305, 36317, 36319, 36335, 36339, 36367, 36386, 36393, 36523, 36530, 36710, 36712,
+  36713, 36716, 36718, 36719, 36720, 36731, 36733, 36739, 36741, 36742, 36744, 36745, 36753, 36755, 36763, 36766,
+  36776, 36777, 36784, 36785, 36793, 36798, 36801, 36805, 36807, 36808, 36814, 36816, 36817, 36820, 36824, 36825,
+  36827, 36828, 36829, 36830, 36831, 36838, 36842, 36843, 36848, 36855, 36861, 36864, 36865, 36866, 36867, 36870,
+  36873, 36874, 36879, 36880, 36882, 36884, 36890, 36891, 36893, 36895, 36896, 36898, 36920, 36923, 36924, 36935,
+  36941, 36947, 36951, 36973, 36974, 36981, 36991, 36992, 37011, 37027, 37030, 37034, 37038, 37041, 37051, 37070,
+  37073, 37096, 37101, 37117, 37122, 37193, 37195, 37197, 37202, 37239, 37240, 37257, 37266, 37319, 37322, 37324,
+  37325, 37326, 37327, 37329, 38024, 38035, 38047, 38050, 38054, 38065, 38075, 38081, 38083, 38108, 38114, 38125,
+  38134, 38138, 38142, 38144, 38145, 38149, 38155, 38169, 38177, 38182, 38190, 38202, 38215, 38236, 38253, 38271,
+  38376, 38378, 38381, 38382, 38384, 38386, 38388, 38391, 38393, 38395, 38401, 38405, 38416, 38420, 38431, 38446,
+  38450, 38451, 38452, 38453, 38454, 38459, 38463, 38464, 38468, 38469, 38470, 38472, 38477, 38480, 38498, 38500,
+  38505, 38506, 38517, 38518, 38519, 38534, 38543, 38544, 38548, 38556, 38590, 38596, 38597, 38598, 38601, 38632,
+  38634, 38639, 38643, 38646, 38647, 38654, 38656, 38663, 38669, 38678, 38706, 38712, 38713, 38738, 38742, 38745,
+  38750, 38752, 38754, 38761, 38780, 38795, 38801, 38886, 38889, 38899, 39029, 39030, 39033, 39034, 39035, 39037,
+  39038, 39039, 39044, 39046, 39047, 39057, 39063, 39064, 39069, 39118, 39128, 39129, 39134, 39135, 39184, 39277,
+  39278, 39280, 39281, 39292, 39302, 39318, 39321, 39336, 39532, 39537, 39542, 39547, 39550, 39564, 39569, 39575,
+  39578, 39588, 39592, 39640, 39740, 39746, 39749, 39764, 40060, 40065, 40092, 40479, 40481, 40483, 40493, 40511,
+  40517, 40548, 40560, 40575, 40614, 40635, 40644, 40654, 40657, 40664, 40723, 40736, 40763, 40784, 40831, 40836,
+  40857, 40863,
+};
+const uint32_t ALPHA_339_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_339_FREQ[] = {
+  { "蛇", 0.00010000 },
+  { "马", 0.00000000 },
+  { "丘", 0.00010000 },
+  { "筑", 0.00000000 },
+  { "到", 0.00720000 },
+  { "刷", 0.00010000 },
+  { "贼", 0.00000000 },
+  { "尽", 0.00000000 },
+  { "么", 0.00000000 },
+  { "一", 0.01920000 },
+  { "告", 0.00050000 },
+  { "寿", 0.00000000 },
+  { "妙", 0.00000000 },
+  { "酒", 0.00040000 },
+  { "稀", 0.00000000 },
+  { "逊", 0.00000000 },
+  { "溪", 0.00010000 },
+  { "扇", 0.00000000 },
+  { "粹", 0.00000000 },
+  { "银", 0.00000000 },
+  { "碍", 0.00000000 },
+  { "磨", 0.00010000 },
+  { "漂", 0.00000000 },
+  { "妮", 0.00000000 },
+  { "试", 0.00000000 },
+  { "时", 0.00000000 },
+  { "杯", 0.00010000 },
+  { "寨", 0.00010000 },
+  { "调", 0.00000000 },
+  { "呵", 0.00000000 },
+  { "忆", 0.00000000 },
+  { "旨", 0.00000000 },
+  { "独", 0.00000000 },
+  { "兑", 0.00000000 },
+  { "略", 0.00020000 },
+  { "仰", 0.00010000 },
+  { "普", 0.00070000 },
+  { "疏", 0.00010000 },
+  { "易", 0.00060000 },
+  { "副", 0.00040000 },
+  { "促", 0.00010000 },
+  { "幅", 0.00010000 },
+  { "滥", 0.00000000 },
+  { "棒", 0.00010000 },
+  { "尾", 0.00090000 },
+  { "乐", 0.00000000 },
+  { "扑", 0.00000000 },
+  { "姊", 0.00000000 },
+  { "暮", 0.00000000 },
+  { "洞", 0.00010000 },
+  { "旅", 0.00040000 },
+  { "训", 0.00000000 },
+  { "送", 0.00030000 },
+  { "神", 0.00080000 },
+  { "堂", 0.00070000 },
+  { "努", 0.00010000 },
+  { "谊", 0.00000000 },
+  { "沧", 0.00000000 },
+  { "曹", 0.00010000 },
+  { "天", 0.00230000 },
+  { "顾", 0.00000000 },
+  { "速", 0.00050000 },
+  { "妖", 0.00000000 },
+  { "鹰", 0.00000000 },
+  { "府", 0.00220000 },
+  { "猛", 0.00020000 },
+  { "较", 0.00000000 },
+  { "图", 0.00000000 },
+  { "张", 0.00000000 },
+  { "示", 0.00070000 },
+  { "迈", 0.00000000 },
+  { "屋", 0.00100000 },
+  { "刑", 0.00010000 },
+  { "悠", 0.00000000 },
+  { "降", 0.00030000 },
+  { "电", 0.00000000 },
+  { "后", 0.00030000 },
+  { "更", 0.00090000 },
+  { "勾", 0.00000000 },
+  { "需", 0.00040000 },
+  { "似", 0.00130000 },
+  { "港", 0.00910000 },
+  { "极", 0.00000000 },
+  { "迦", 0.00000000 },
+  { "德", 0.00170000 },
+  { "厅", 0.00000000 },
+  { "适", 0.00000000 },
+  { "陈", 0.00000000 },
+  { "土", 0.00070000 },
+  { "隆", 0.00020000 },
+  { "亥", 0.00000000 },
+  { "医", 0.00000000 },
+  { "已", 0.00150000 },
+  { "函", 0.00010000 },
+  { "搞", 0.00060000 },
+  { "彬", 0.00000000 },
+  { "趋", 0.00000000 },
+  { "答", 0.00010000 },
+  { "院", 0.00130000 },
+  { "常", 0.00150000 },
+  { "力", 0.00170000 },
+  { "蒙", 0.00020000 },
+  { "牙", 0.00060000 },
+  { "州", 0.00180000 },
+  { "露", 0.00020000 },
+  { "强", 0.00000000 },
+  { "殊", 0.00010000 },
+  { "困", 0.00010000 },
+  { "零", 0.00040000 },
+  { "灯", 0.00000000 },
+  { "翔", 0.00010000 },
+  { "辈", 0.00000000 },
+  { "哟", 0.00000000 },
+  { "诸", 0.00000000 },
+  { "李", 0.00090000 },
+  { "某", 0.00020000 },
+  { "务", 0.00000000 },
+  { "区", 0.00000000 },
+  { "座", 0.00100000 },
+  { "题", 0.00000000 },
+  { "入", 0.00420000 },
+  { "狠", 0.00000000 },
+  { "父", 0.00020000 },
+  { "书", 0.00000000 },
+  { "货", 0.00000000 },
+  { "基", 0.00190000 },
+  { "龄", 0.00000000 },
+  { "邮", 0.00000000 },
+  { "础", 0.00000000 },
+  { "行", 0.00500000 },
+  { "歌", 0.00140000 },
+  { "救", 0.00040000 },
+  { "节", 0.00000000 },
+  { "洪", 0.00010000 },
+  { "役", 0.00020000 },
+  { "在", 0.00100000 },
+  { "辆", 0.00000000 },
+  { "仔", 0.00150000 },
+  { "赤", 0.00020000 },
+  { "贴", 0.00000000 },
+  { "阅", 0.00000000 },
+  { "秒", 0.00010000 },
+  { "蔑", 0.00000000 },
+  { "积", 0.00000000 },
+  { "夕", 0.00010000 },
+  { "哎", 0.00000000 },
+  { "渡", 0.00020000 },
+  { "填", 0.00030000 },
+  { "复", 0.00000000 },
+  { "那", 0.00010000 },
+  { "视", 0.00000000 },
+  { "室", 0.00060000 },
+  { "风", 0.00000000 },
+  { "镭", 0.00000000 },
+  { "嫩", 0.00000000 },
+  { "沈", 0.00000000 },
+  { "回", 0.00050000 },
+  { "礼", 0.00000000 },
+  { "抵", 0.00010000 },
+  { "葡", 0.00020000 },
+  { "您", 0.00000000 },
+  { "星", 0.00200000 },
+  { "加", 0.00310000 },
+  { "畅", 0.00000000 },
+  { "挖", 0.00000000 },
+  { "赫", 0.00010000 },
+  { "既", 0.00010000 },
+  { "值", 0.00030000 },
+  { "祸", 0.00000000 },
+  { "幼", 0.00010000 },
+  { "酉", 0.00000000 },
+  { "狂", 0.00010000 },
+  { "只", 0.00120000 },
+  { "机", 0.00000000 },
+  { "晶", 0.00010000 },
+  { "苍", 0.00000000 },
+  { "浑", 0.00000000 },
+  { "掩", 0.00000000 },
+  { "至", 0.00280000 },
+  { "此", 0.00100000 },
+  { "非", 0.00100000 },
+  { "仍", 0.00030000 },
+  { "啦", 0.00010000 },
+  { "呐", 0.00000000 },
+  { "省", 0.00100000 },
+  { "苦", 0.00010000 },
+  { "厉", 0.00000000 },
+  { "亲", 0.00000000 },
+  { "觉", 0.00000000 },
+  { "蝶", 0.00010000 },
+  { "栋", 0.00000000 },
+  { "进", 0.00000000 },
+  { "吓", 0.00010000 },
+  { "气", 0.00000000 },
+  { "跌", 0.00010000 },
+  { "雯", 0.00000000 },
+  { "翰", 0.00010000 },
+  { "月", 0.00690000 },
+  { "焦", 0.00000000 },
+  { "人", 0.01290000 },
+  { "弯", 0.00000000 },
+  { "片", 0.00100000 },
+  { "别", 0.00000000 },
+  { "床", 0.00000000 },
+  { "永", 0.00030000 },
+  { "利", 0.00240000 },
+  { "阮", 0.00000000 },
+  { "末", 0.00020000 },
+  { "肖", 0.00000000 },
+  { "狱", 0.00000000 },
+  { "贵", 0.00000000 },
+  { "喝", 0.00000000 },
+  { "骗", 0.00000000 },
+  { "歪", 0.00000000 },
+  { "宪", 0.00000000 },
+  { "个", 0.00000000 },
+  { "枫", 0.00000000 },
+  { "拿", 0.00060000 },
+  { "朋", 0.00020000 },
+  { "伊", 0.00050000 },
+  { "饰", 0.00000000 },
+  { "莪", 0.00000000 },
+  { "舌", 0.00000000 },
+  { "庚", 0.00000000 },
+  { "尘", 0.00000000 },
+  { "农", 0.00000000 },
+  { "甲", 0.00050000 },
+  { "抬", 0.00000000 },
+  { "投", 0.00080000 },
+  { "誓", 0.00000000 },
+  { "棉", 0.00000000 },
+  { "选", 0.00000000 },
+  { "笑", 0.00010000 },
+  { "宾", 0.00000000 },
+  { "房", 0.00050000 },
+  { "免", 0.00030000 },
+  { "勉", 0.00000000 },
+  { "尖", 0.00030000 },
+  { "披", 0.00000000 },
+  { "止", 0.00050000 },
+  { "载", 0.00000000 },
+  { "忧", 0.00000000 },
+  { "萤", 0.00000000 },
+  { "寅", 0.00000000 },
+  { "旧", 0.00000000 },
+  { "版", 0.00110000 },
+  { "领", 0.00000000 },
+  { "减", 0.00000000 },
+  { "爽", 0.00000000 },
+  { "塔", 0.00030000 },
+  { "于", 0.00000000 },
+  { "令", 0.00130000 },
+  { "依", 0.00030000 },
+  { "吐", 0.00010000 },
+  { "哲", 0.00020000 },
+  { "车", 0.00000000 },
+  { "十", 0.00250000 },
+  { "姿", 0.00000000 },
+  { "察", 0.00030000 },
+  { "欺", 0.00000000 },
+  { "距", 0.00020000 },
+  { "泣", 0.00000000 },
+  { "摄", 0.00000000 },
+  { "里", 0.00140000 },
+  { "默", 0.00010000 },
+  { "首", 0.00150000 },
+  { "避", 0.00010000 },
+  { "挥", 0.00000000 },
+  { "桌", 0.00000000 },
+  { "归", 0.00000000 },
+  { "宇", 0.00020000 },
+  { "傲", 0.00000000 },
+  { "操", 0.00020000 },
+  { "郑", 0.00000000 },
+  { "液", 0.00010000 },
+  { "驾", 0.00000000 },
+  { "偏", 0.00010000 },
+  { "规", 0.00000000 },
+  { "聘", 0.00000000 },
+  { "雷", 0.00020000 },
+  { "逸", 0.00000000 },
+  { "尝", 0.00000000 },
+  { "现", 0.00000000 },
+  { "架", 0.00110000 },
+  { "呼", 0.00020000 },
+  { "鸭", 0.00000000 },
+  { "典", 0.00060000 },
+  { "税", 0.00000000 },
+  { "喻", 0.00000000 },
+  { "飘", 0.00000000 },
+  { "岛", 0.00000000 },
+  { "壤", 0.00000000 },
+  { "期", 0.00260000 },
+  { "卓", 0.00010000 },
+  { "中", 0.01120000 },
+  { "椰", 0.00000000 },
+  { "蓬", 0.00000000 },
+  { "可", 0.00460000 },
+  { "策", 0.00030000 },
+  { "习", 0.00000000 },
+  { "钓", 0.00000000 },
+  { "海", 0.00380000 },
+  { "和", 0.00140000 },
+  { "谋", 0.00000000 },
+  { "趣", 0.00010000 },
+  { "钻", 0.00000000 },
+  { "雾", 0.00000000 },
+  { "儒", 0.00010000 },
+  { "诗", 0.00000000 },
+  { "顽", 0.00000000 },
+  { "狮", 0.00000000 },
+  { "催", 0.00000000 },
+  { "帮", 0.00000000 },
+  { "还", 0.00000000 },
+  { "唬", 0.00000000 },
+  { "细", 0.00000000 },
+  { "遍", 0.00010000 },
+  { "牛", 0.00050000 },
+  { "卖", 0.00000000 },
+  { "孩", 0.00000000 },
+  { "币", 0.00000000 },
+  { "碧", 0.00010000 },
+  { "喀", 0.00000000 },
+  { "浴", 0.00000000 },
+  { "缘", 0.00000000 },
+  { "序", 0.00030000 },
+  { "份", 0.00120000 },
+  { "夜", 0.00040000 },
+  { "柬", 0.00000000 },
+  { "腊", 0.00000000 },
+  { "点", 0.00000000 },
+  { "馆", 0.00000000 },
+  { "箭", 0.00010000 },
+  { "缺", 0.00010000 },
+  { "威", 0.00060000 },
+  { "九", 0.00220000 },
+  { "直", 0.00160000 },
+  { "据", 0.00000000 },
+  { "丹", 0.00050000 },
+  { "娟", 0.00000000 },
+  { "级", 0.00000000 },
+  { "逐", 0.00020000 },
+  { "伦", 0.00000000 },
+  { "承", 0.00030000 },
+  { "由", 0.00500000 },
+  { "验", 0.00000000 },
+  { "卢", 0.00000000 },
+  { "胜", 0.00000000 },
+  { "伐", 0.00010000 },
+  { "督", 0.00040000 },
+  { "隔", 0.00040000 },
+  { "金", 0.00180000 },
+  { "糟", 0.00000000 },
+  { "硬", 0.00020000 },
+  { "约", 0.00000000 },
+  { "取", 0.00070000 },
+  { "终", 0.00000000 },
+  { "玉", 0.00010000 },
+  { "弊", 0.00000000 },
+  { "贯", 0.00000000 },
+  { "继", 0.00000000 },
+  { "弘", 0.00000000 },
+  { "符", 0.00030000 },
+  { "簿", 0.00000000 },
+  { "介", 0.00030000 },
+  { "超", 0.00080000 },
+  { "赐", 0.00000000 },
+  { "吸", 0.00030000 },
+  { "根", 0.00070000 },
+  { "菲", 0.00040000 },
+  { "软", 0.00000000 },
+  { "鼻", 0.00010000 },
+  { "石", 0.00100000 },
+  { "引", 0.00100000 },
+  { "毒", 0.00020000 },
+  { "盟", 0.00040000 },
+  { "任", 0.00170000 },
+  { "诚", 0.00000000 },
+  { "学", 0.00000000 },
+  { "踢", 0.00010000 },
+  { "呆", 0.00000000 },
+  { "季", 0.00050000 },
+  { "蟹", 0.00010000 },
+  { "正", 0.00170000 },
+  { "埋", 0.00490000 },
+  { "乘", 0.00050000 },
+  { "听", 0.00000000 },
+  { "曾", 0.00110000 },
+  { "嗒", 0.00000000 },
+  { "工", 0.00210000 },
+  { "箱", 0.00010000 },
+  { "吝", 0.00000000 },
+  { "追", 0.00020000 },
+  { "森", 0.00030000 },
+  { "鲜", 0.00000000 },
+  { "草", 0.00040000 },
+  { "虹", 0.00010000 },
+  { "满", 0.00000000 },
+  { "将", 0.00000000 },
+  { "酋", 0.00000000 },
+  { "潘", 0.00010000 },
+  { "员", 0.00000000 },
+  { "江", 0.00110000 },
+  { "境", 0.00060000 },
+  { "溜", 0.00000000 },
+  { "女", 0.00140000 },
+  { "缸", 0.00000000 },
+  { "询", 0.00000000 },
+  { "认", 0.00000000 },
+  { "渣", 0.00010000 },
+  { "帽", 0.00010000 },
+  { "丝", 0.00000000 },
+  { "砍", 0.00000000 },
+  { "篇", 0.00020000 },
+  { "方", 0.00430000 },
+  { "赋", 0.00000000 },
+  { "砂", 0.00000000 },
+  { "爱", 0.00000000 },
+  { "品", 0.00110000 },
+  { "冈", 0.00000000 },
+  { "丑", 0.00000000 },
+  { "反", 0.00090000 },
+  { "庭", 0.00020000 },
+  { "远", 0.00000000 },
+  { "为", 0.00000000 },
+  { "随", 0.00000000 },
+  { "愚", 0.00000000 },
+  { "薄", 0.00010000 },
+  { "甘", 0.00010000 },
+  { "龙", 0.00000000 },
+  { "除", 0.00080000 },
+  { "民", 0.00390000 },
+  { "克", 0.00110000 },
+  { "稍", 0.00000000 },
+  { "绍", 0.00000000 },
+  { "圈", 0.00020000 },
+  { "子", 0.00240000 },
+  { "不", 0.00230000 },
+  { "千", 0.00070000 },
+  { "条", 0.00000000 },
+  { "阻", 0.00010000 },
+  { "四", 0.00200000 },
+  { "慕", 0.00010000 },
+  { "城", 0.00210000 },
+  { "撒", 0.00010000 },
+  { "召", 0.00010000 },
+  { "残", 0.00000000 },
+  { "署", 0.00040000 },
+  { "意", 0.00190000 },
+  { "肯", 0.00010000 },
+  { "粤", 0.00000000 },
+  { "脑", 0.00000000 },
+  { "皆", 0.00010000 },
+  { "逝", 0.00010000 },
+  { "娃", 0.00010000 },
+  { "爪", 0.00010000 },
+  { "挤", 0.00000000 },
+  { "向", 0.00140000 },
+  { "恭", 0.00000000 },
+  { "泰", 0.00060000 },
+  { "成", 0.00710000 },
+  { "扣", 0.00000000 },
+  { "诺", 0.00000000 },
+  { "桥", 0.00000000 },
+  { "险", 0.00000000 },
+  { "幽", 0.00000000 },
+  { "羽", 0.00010000 },
+  { "湾", 0.00000000 },
+  { "坐", 0.00020000 },
+  { "处", 0.00000000 },
+  { "潮", 0.00030000 },
+  { "破", 0.00030000 },
+  { "姓", 0.00010000 },
+  { "堡", 0.00020000 },
+  { "宗", 0.00060000 },
+  { "昨", 0.00000000 },
+  { "鲁", 0.00000000 },
+  { "初", 0.00100000 },
+  { "王", 0.00130000 },
+  { "革", 0.00040000 },
+  { "众", 0.00000000 },
+  { "汗", 0.00010000 },
+  { "产", 0.00000000 },
+  { "解", 0.00110000 },
+  { "愁", 0.00000000 },
+  { "间", 0.00000000 },
+  { "忠", 0.00010000 },
+  { "竞", 0.00000000 },
+  { "哦", 0.00000000 },
+  { "骚", 0.00000000 },
+  { "吃", 0.00000000 },
+  { "巨", 0.00020000 },
+  { "能", 0.00160000 },
+  { "倒", 0.00020000 },
+  { "高", 0.00250000 },
+  { "排", 0.00070000 },
+  { "升", 0.00050000 },
+  { "惜", 0.00000000 },
+  { "疲", 0.00000000 },
+  { "译", 0.00000000 },
+  { "监", 0.00000000 },
+  { "射", 0.00040000 },
+  { "藉", 0.00010000 },
+  { "郭", 0.00010000 },
+  { "侦", 0.00000000 },
+  { "扭", 0.00000000 },
+  { "眠", 0.00000000 },
+  { "暑", 0.00000000 },
+  { "佳", 0.00030000 },
+  { "紧", 0.00000000 },
+  { "烧", 0.00000000 },
+  { "坪", 0.00010000 },
+  { "碎", 0.00010000 },
+  { "村", 0.00080000 },
+  { "於", 0.00370000 },
+  { "叹", 0.00000000 },
+  { "舞", 0.00020000 },
+  { "振", 0.00010000 },
+  { "辨", 0.00000000 },
+  { "申", 0.00020000 },
+  { "浏", 0.00000000 },
+  { "屠", 0.00010000 },
+  { "费", 0.00000000 },
+  { "状", 0.00000000 },
+  { "胖", 0.00000000 },
+  { "汪", 0.00010000 },
+  { "竹", 0.00020000 },
+  { "严", 0.00000000 },
+  { "置", 0.00060000 },
+  { "穹", 0.00000000 },
+  { "角", 0.00160000 },
+  { "择", 0.00000000 },
+  { "忙", 0.00010000 },
+  { "款", 0.00040000 },
+  { "维", 0.00000000 },
+  { "周", 0.00070000 },
+  { "汇", 0.00000000 },
+  { "煮", 0.00010000 },
+  { "订", 0.00000000 },
+  { "冲", 0.00000000 },
+  { "京", 0.00080000 },
+  { "两", 0.00000000 },
+  { "些", 0.00010000 },
+  { "地", 0.00720000 },
+  { "烂", 0.00000000 },
+  { "牲", 0.00000000 },
+  { "君", 0.00030000 },
+  { "年", 0.02040000 },
+  { "深", 0.00070000 },
+  { "秘", 0.00010000 },
+  { "瓦", 0.00020000 },
+  { "恐", 0.00010000 },
+  { "页", 0.00000000 },
+  { "足", 0.00100000 },
+  { "朗", 0.00040000 },
+  { "兵", 0.00040000 },
+  { "萨", 0.00000000 },
+  { "虎", 0.00030000 },
+  { "换", 0.00000000 },
+  { "阳", 0.00000000 },
+  { "元", 0.00170000 },
+  { "折", 0.00010000 },
+  { "播", 0.00080000 },
+  { "浪", 0.00020000 },
+  { "考", 0.00070000 },
+  { "股", 0.00040000 },
+  { "埃", 0.00010000 },
+  { "莫", 0.00040000 },
+  { "侠", 0.00000000 },
+  { "巴", 0.00300000 },
+  { "拼", 0.00020000 },
+  { "牧", 0.00010000 },
+  { "佐", 0.00020000 },
+  { "要", 0.00370000 },
+  { "垒", 0.00000000 },
+  { "尼", 0.00120000 },
+  { "激", 0.00020000 },
+  { "带", 0.00000000 },
+  { "肚", 0.00010000 },
+  { "蒋", 0.00000000 },
+  { "睛", 0.00000000 },
+  { "侨", 0.00000000 },
+  { "甜", 0.00010000 },
+  { "朵", 0.00000000 },
+  { "逼", 0.00010000 },
+  { "胆", 0.00000000 },
+  { "格", 0.00120000 },
+  { "俩", 0.00000000 },
+  { "侵", 0.00020000 },
+  { "走", 0.00050000 },
+  { "恼", 0.00000000 },
+  { "椅", 0.00010000 },
+  { "绩", 0.00000000 },
+  { "临", 0.00000000 },
+  { "锺", 0.00000000 },
+  { "厄", 0.00000000 },
+  { "吊", 0.00010000 },
+  { "招", 0.00020000 },
+  { "赢", 0.00000000 },
+  { "疼", 0.00000000 },
+  { "废", 0.00000000 },
+  { "充", 0.00010000 },
+  { "营", 0.00000000 },
+  { "坤", 0.00000000 },
+  { "翅", 0.00000000 },
+  { "黑", 0.00050000 },
+  { "迁", 0.00000000 },
+  { "扮", 0.00010000 },
+  { "霍", 0.00010000 },
+  { "匈", 0.00000000 },
+  { "寞", 0.00000000 },
+  { "碰", 0.00000000 },
+  { "支", 0.00100000 },
+  { "何", 0.00050000 },
+  { "司", 0.00230000 },
+  { "糕", 0.00000000 },
+  { "混", 0.00020000 },
+  { "辛", 0.00010000 },
+  { "柯", 0.00010000 },
+  { "母", 0.00200000 },
+  { "纲", 0.00000000 },
+  { "仿", 0.00010000 },
+  { "淑", 0.00000000 },
+  { "很", 0.00000000 },
+  { "轻", 0.00000000 },
+  { "兰", 0.00000000 },
+  { "旗", 0.00030000 },
+  { "跟", 0.00040000 },
+  { "泡", 0.00000000 },
+  { "瓶", 0.00000000 },
+  { "宙", 0.00010000 },
+  { "翁", 0.00000000 },
+  { "幸", 0.00000000 },
+  { "熊", 0.00020000 },
+  { "欧", 0.00000000 },
+  { "养", 0.00000000 },
+  { "钢", 0.00000000 },
+  { "械", 0.00010000 },
+  { "汉", 0.00000000 },
+  { "疾", 0.00000000 },
+  { "芦", 0.00000000 },
+  { "谅", 0.00000000 },
+  { "呦", 0.00000000 },
+  { "牡", 0.00000000 },
+  { "谱", 0.00000000 },
+  { "哭", 0.00000000 },
+  { "滑", 0.00010000 },
+  { "接", 0.00160000 },
+  { "培", 0.00020000 },
+  { "摩", 0.00030000 },
+  { "越", 0.00070000 },
+  { "完", 0.00070000 },
+  { "斜", 0.00010000 },
+  { "耳", 0.00030000 },
+  { "裤", 0.00000000 },
+  { "缩", 0.00000000 },
+  { "队", 0.00000000 },
+  { "罢", 0.00000000 },
+  { "荐", 0.00000000 },
+  { "万", 0.00000000 },
+  { "康", 0.00060000 },
+  { "课", 0.00000000 },
+  { "鹅", 0.00000000 },
+  { "墨", 0.00020000 },
+  { "搭", 0.00020000 },
+  { "施", 0.00040000 },
+  { "俄", 0.00030000 },
+  { "压", 0.00000000 },
+  { "爷", 0.00000000 },
+  { "挺", 0.00000000 },
+  { "丰", 0.00000000 },
+  { "商", 0.00130000 },
+  { "往", 0.00060000 },
+  { "存", 0.00050000 },
+  { "芭", 0.00010000 },
+  { "肥", 0.00010000 },
+  { "讷", 0.00000000 },
+  { "迷", 0.00020000 },
+  { "丈", 0.00000000 },
+  { "余", 0.00000000 },
+  { "守", 0.00030000 },
+  { "脱", 0.00000000 },
+  { "哇", 0.00000000 },
+  { "乙", 0.00010000 },
+  { "贪", 0.00000000 },
+  { "臣", 0.00030000 },
+  { "龟", 0.00000000 },
+  { "抽", 0.00010000 },
+  { "占", 0.00010000 },
+  { "功", 0.00060000 },
+  { "前", 0.00310000 },
+  { "荣", 0.00000000 },
+  { "鸣", 0.00000000 },
+  { "坚", 0.00000000 },
+  { "仇", 0.00000000 },
+  { "而", 0.00600000 },
+  { "枝", 0.00010000 },
+  { "嘴", 0.00020000 },
+  { "闭", 0.00000000 },
+  { "晋", 0.00000000 },
+  { "特", 0.00190000 },
+  { "霹", 0.00000000 },
+  { "弃", 0.00000000 },
+  { "求", 0.00050000 },
+  { "融", 0.00030000 },
+  { "丸", 0.00010000 },
+  { "程", 0.00130000 },
+  { "刊", 0.00020000 },
+  { "苏", 0.00000000 },
+  { "沉", 0.00010000 },
+  { "卒", 0.00000000 },
+  { "逆", 0.00000000 },
+  { "整", 0.00070000 },
+  { "涯", 0.00010000 },
+  { "才", 0.00010000 },
+  { "丁", 0.00180000 },
+  { "游", 0.00020000 },
+  { "葛", 0.00010000 },
+  { "谈", 0.00000000 },
+  { "托", 0.00020000 },
+  { "灵", 0.00000000 },
+  { "契", 0.00010000 },
+  { "计", 0.00000000 },
+  { "稣", 0.00000000 },
+  { "护", 0.00000000 },
+  { "类", 0.00000000 },
+  { "兮", 0.00000000 },
+  { "莱", 0.00000000 },
+  { "先", 0.00150000 },
+  { "耶", 0.00010000 },
+  { "管", 0.00100000 },
+  { "荷", 0.00030000 },
+  { "快", 0.00060000 },
+  { "瞧", 0.00000000 },
+  { "附", 0.00050000 },
+  { "茫", 0.00000000 },
+  { "咖", 0.00010000 },
+  { "设", 0.00000000 },
+  { "目", 0.00170000 },
+  { "突", 0.00030000 },
+  { "徐", 0.00010000 },
+  { "卡", 0.00070000 },
+  { "藏", 0.00020000 },
+  { "陵", 0.00010000 },
+  { "赔", 0.00000000 },
+  { "这", 0.00000000 },
+  { "旺", 0.00020000 },
+  { "差", 0.00050000 },
+  { "累", 0.00010000 },
+  { "琴", 0.00010000 },
+  { "琳", 0.00010000 },
+  { "喜", 0.00010000 },
+  { "把", 0.00010000 },
+  { "山", 0.00310000 },
+  { "源", 0.00060000 },
+  { "淘", 0.00000000 },
+  { "垂", 0.00000000 },
+  { "背", 0.00030000 },
+  { "逛", 0.00000000 },
+  { "迟", 0.00000000 },
+  { "朝", 0.00100000 },
+  { "盛", 0.00030000 },
+  { "眉", 0.00000000 },
+  { "旋", 0.00020000 },
+  { "宝", 0.00000000 },
+  { "际", 0.00000000 },
+  { "祥", 0.00010000 },
+  { "喇", 0.00010000 },
+  { "柏", 0.00020000 },
+  { "陀", 0.00000000 },
+  { "艺", 0.00000000 },
+  { "始", 0.00180000 },
+  { "移", 0.00040000 },
+  { "沿", 0.00020000 },
+  { "实", 0.00000000 },
+  { "收", 0.00120000 },
+  { "颗", 0.00000000 },
+  { "危", 0.00020000 },
+  { "闪", 0.00000000 },
+  { "夫", 0.00050000 },
+  { "绿", 0.00000000 },
+  { "核", 0.00030000 },
+  { "夸", 0.00000000 },
+  { "脆", 0.00000000 },
+  { "秀", 0.00030000 },
+  { "尔", 0.00000000 },
+  { "刻", 0.00020000 },
+  { "种", 0.00000000 },
+  { "悔", 0.00000000 },
+  { "概", 0.00050000 },
+  { "伏", 0.00010000 },
+  { "诞", 0.00000000 },
+  { "乖", 0.00000000 },
+  { "唱", 0.00090000 },
+  { "铜", 0.00000000 },
+  { "登", 0.00040000 },
+  { "环", 0.00000000 },
+  { "米", 0.00150000 },
+  { "步", 0.00040000 },
+  { "左", 0.00050000 },
+  { "爆", 0.00030000 },
+  { "少", 0.00160000 },
+  { "惠", 0.00020000 },
+  { "牌", 0.00060000 },
+  { "隐", 0.00000000 },
+  { "修", 0.00050000 },
+  { "亡", 0.00020000 },
+  { "蜂", 0.00000000 },
+  { "胡", 0.00020000 },
+  { "捡", 0.00000000 },
+  { "炮", 0.00010000 },
+  { "昭", 0.00010000 },
+  { "身", 0.00170000 },
+  { "拦", 0.00000000 },
+  { "丙", 0.00010000 },
+  { "述", 0.00020000 },
+  { "娘", 0.00010000 },
+  { "勇", 0.00010000 },
+  { "二", 0.00230000 },
+  { "坜", 0.00000000 },
+  { "阴", 0.00000000 },
+  { "但", 0.00280000 },
+  { "贝", 0.00000000 },
+  { "欲", 0.00000000 },
+  { "吹", 0.00010000 },
+  { "覆", 0.00010000 },
+  { "摊", 0.00000000 },
+  { "推", 0.00090000 },
+  { "欢", 0.00000000 },
+  { "散", 0.00030000 },
+  { "倍", 0.00010000 },
+  { "杨", 0.00000000 },
+  { "准", 0.00010000 },
+  { "哉", 0.00000000 },
+  { "道", 0.00320000 },
+  { "感", 0.00040000 },
+  { "凤", 0.00000000 },
+  { "乾", 0.00020000 },
+  { "予", 0.00000000 },
+  { "劲", 0.00000000 },
+  { "巧", 0.00010000 },
+  { "欣", 0.00010000 },
+  { "赏", 0.00000000 },
+  { "轨", 0.00000000 },
+  { "菜", 0.00020000 },
+  { "次", 0.00200000 },
+  { "彭", 0.00010000 },
+  { "趁", 0.00000000 },
+  { "又", 0.00260000 },
+  { "票", 0.00070000 },
+  { "祝", 0.00010000 },
+  { "凭", 0.00000000 },
+  { "却", 0.00000000 },
+  { "枢", 0.00000000 },
+  { "伸", 0.00020000 },
+  { "担", 0.00000000 },
+  { "窝", 0.00000000 },
+  { "铁", 0.00000000 },
+  { "婚", 0.00030000 },
+  { "话", 0.00000000 },
+  { "起", 0.00250000 },
+  { "雄", 0.00030000 },
+  { "帐", 0.00000000 },
+  { "鄂", 0.00000000 },
+  { "白", 0.00090000 },
+  { "闲", 0.00000000 },
+  { "被", 0.00150000 },
+  { "旁", 0.00010000 },
+  { "崴", 0.00000000 },
+  { "麻", 0.00030000 },
+  { "扎", 0.00000000 },
+  { "铢", 0.00000000 },
+  { "关", 0.00000000 },
+  { "停", 0.00040000 },
+  { "判", 0.00030000 },
+  { "章", 0.00040000 },
+  { "假", 0.00030000 },
+  { "闹", 0.00000000 },
+  { "泳", 0.00010000 },
+  { "量", 0.00140000 },
+  { "齐", 0.00000000 },
+  { "蓉", 0.00000000 },
+  { "新", 0.00390000 },
+  { "踩", 0.00000000 },
+  { "师", 0.00000000 },
+  { "生", 0.00440000 },
+  { "妥", 0.00000000 },
+  { "让", 0.00000000 },
+  { "急", 0.00020000 },
+  { "香", 0.00760000 },
+  { "贺", 0.00000000 },
+  { "照", 0.00030000 },
+  { "边", 0.00000000 },
+  { "桃", 0.00010000 },
+  { "循", 0.00010000 },
+  { "报", 0.00000000 },
+  { "唷", 0.00000000 },
+  { "驻", 0.00000000 },
+  { "呀", 0.00000000 },
+  { "算", 0.00050000 },
+  { "内", 0.00000000 },
+  { "迎", 0.00020000 },
+  { "派", 0.00080000 },
+  { "编", 0.00000000 },
+  { "赞", 0.00000000 },
+  { "罪", 0.00020000 },
+  { "育", 0.00060000 },
+  { "劫", 0.00000000 },
+  { "应", 0.00000000 },
+  { "翠", 0.00020000 },
+  { "拾", 0.00000000 },
+  { "额", 0.00000000 },
+  { "恋", 0.00000000 },
+  { "夹", 0.00000000 },
+  { "毫", 0.00020000 },
+  { "氏", 0.00040000 },
+  { "挪", 0.00010000 },
+  { "宽", 0.00000000 },
+  { "摆", 0.00000000 },
+  { "去", 0.00280000 },
+  { "忍", 0.00000000 },
+  { "宜", 0.00010000 },
+  { "布", 0.00080000 },
+  { "其", 0.00310000 },
+  { "央", 0.00040000 },
+  { "怖", 0.00000000 },
+  { "猴", 0.00010000 },
+  { "彷", 0.00000000 },
+  { "蛮", 0.00000000 },
+  { "昌", 0.00020000 },
+  { "河", 0.00100000 },
+  { "尚", 0.00010000 },
+  { "括", 0.00120000 },
+  { "对", 0.00000000 },
+  { "言", 0.00090000 },
+  { "览", 0.00000000 },
+  { "巳", 0.00000000 },
+  { "之", 0.00710000 },
+  { "损", 0.00000000 },
+  { "再", 0.00110000 },
+  { "纯", 0.00000000 },
+  { "衣", 0.00030000 },
+  { "益", 0.00020000 },
+  { "番", 0.00030000 },
+  { "悟", 0.00000000 },
+  { "裂", 0.00010000 },
+  { "社", 0.00100000 },
+  { "兴", 0.00000000 },
+  { "彰", 0.00000000 },
+  { "就", 0.00570000 },
+  { "青", 0.00090000 },
+  { "瑞", 0.00030000 },
+  { "构", 0.00000000 },
+  { "尊", 0.00010000 },
+  { "象", 0.00070000 },
+  { "探", 0.00010000 },
+  { "延", 0.00020000 },
+  { "的", 0.00150000 },
+  { "久", 0.00010000 },
+  { "景", 0.00050000 },
+  { "猪", 0.00000000 },
+  { "杰", 0.00000000 },
+  { "泉", 0.00010000 },
+  { "屏", 0.00010000 },
+  { "滨", 0.00000000 },
+  { "牵", 0.00000000 },
+  { "叶", 0.00000000 },
+  { "会", 0.00000000 },
+  { "寇", 0.00000000 },
+  { "共", 0.00210000 },
+  { "著", 0.00050000 },
+  { "矣", 0.00000000 },
+  { "躲", 0.00000000 },
+  { "配", 0.00060000 },
+  { "们", 0.00000000 },
+  { "希", 0.00060000 },
+  { "福", 0.00060000 },
+  { "都", 0.00630000 },
+  { "乏", 0.00000000 },
+  { "窗", 0.00000000 },
+  { "戏", 0.00000000 },
+  { "校", 0.00100000 },
+  { "部", 0.00380000 },
+  { "演", 0.00160000 },
+  { "兹", 0.00000000 },
+  { "貌", 0.00000000 },
+  { "耀", 0.00010000 },
+  { "坑", 0.00020000 },
+  { "怎", 0.00000000 },
+  { "昏", 0.00000000 },
+  { "娱", 0.00000000 },
+  { "外", 0.00270000 },
+  { "平", 0.00230000 },
+  { "责", 0.00000000 },
+  { "真", 0.00050000 },
+  { "杂", 0.00000000 },
+  { "忽", 0.00000000 },
+  { "扯", 0.00000000 },
+  { "针", 0.00000000 },
+  { "防", 0.00050000 },
+  { "综", 0.00000000 },
+  { "铺", 0.00000000 },
+  { "伟", 0.00000000 },
+  { "合", 0.00240000 },
+  { "叙", 0.00000000 },
+  { "达", 0.00000000 },
+  { "好", 0.00500000 },
+  { "拆", 0.00020000 },
+  { "沟", 0.00000000 },
+  { "仲", 0.00020000 },
+  { "群", 0.00040000 },
+  { "夺", 0.00000000 },
+  { "植", 0.00030000 },
+  { "敦", 0.00040000 },
+  { "称", 0.00000000 },
+  { "热", 0.00000000 },
+  { "续", 0.00000000 },
+  { "船", 0.00060000 },
+  { "样", 0.00000000 },
+  { "患", 0.00010000 },
+  { "顿", 0.00000000 },
+  { "夏", 0.00040000 },
+  { "她", 0.00000000 },
+  { "午", 0.00010000 },
+  { "遭", 0.00010000 },
+  { "戌", 0.00000000 },
+  { "烤", 0.00000000 },
+  { "肤", 0.00000000 },
+  { "台", 0.00280000 },
+  { "今", 0.00070000 },
+  { "妇", 0.00000000 },
+  { "宣", 0.00060000 },
+  { "啪", 0.00000000 },
+  { "傻", 0.00000000 },
+  { "岗", 0.00000000 },
+  { "食", 0.00130000 },
+  { "寒", 0.00000000 },
+  { "冬", 0.00020000 },
+  { "舒", 0.00010000 },
+  { "念", 0.00050000 },
+  { "捐", 0.00010000 },
+  { "哥", 0.00040000 },
+  { "串", 0.00150000 },
+  { "厚", 0.00010000 },
+  { "夥", 0.00000000 },
+  { "肩", 0.00000000 },
+  { "例", 0.00130000 },
+  { "羞", 0.00000000 },
+  { "茂", 0.00010000 },
+  { "病", 0.00050000 },
+  { "庸", 0.00000000 },
+  { "奥", 0.00000000 },
+  { "纷", 0.00000000 },
+  { "简", 0.00000000 },
+  { "拜", 0.00030000 },
+  { "提", 0.00130000 },
+  { "劳", 0.00000000 },
+  { "纸", 0.00000000 },
+  { "梯", 0.00010000 },
+  { "阁", 0.00000000 },
+  { "像", 0.00030000 },
+  { "链", 0.00000000 },
+  { "炸", 0.00010000 },
+  { "透", 0.00020000 },
+  { "辞", 0.00000000 },
+  { "伯", 0.00180000 },
+  { "错", 0.00000000 },
+  { "供", 0.00060000 },
+  { "北", 0.00330000 },
+  { "惹", 0.00000000 },
+  { "灭", 0.00000000 },
+  { "保", 0.00100000 },
+  { "场", 0.00000000 },
+  { "俊", 0.00010000 },
+  { "芒", 0.00000000 },
+  { "拳", 0.00010000 },
+  { "碗", 0.00000000 },
+  { "喂", 0.00000000 },
+  { "盒", 0.00000000 },
+  { "启", 0.00000000 },
+  { "劣", 0.00000000 },
+  { "萧", 0.00000000 },
+  { "酸", 0.00020000 },
+  { "艾", 0.00020000 },
+  { "伤", 0.00000000 },
+  { "安", 0.00140000 },
+  { "渴", 0.00000000 },
+  { "喏", 0.00000000 },
+  { "比", 0.00180000 },
+  { "过", 0.00000000 },
+  { "几", 0.00000000 },
+  { "涛", 0.00000000 },
+  { "邀", 0.00010000 },
+  { "胁", 0.00000000 },
+  { "靖", 0.00000000 },
+  { "扫", 0.00000000 },
+  { "叫", 0.00380000 },
+  { "密", 0.00050000 },
+  { "弗", 0.00000000 },
+  { "鼠", 0.00010000 },
+  { "夷", 0.00010000 },
+  { "纵", 0.00000000 },
+  { "靼", 0.00000000 },
+  { "魅", 0.00000000 },
+  { "愉", 0.00000000 },
+  { "纪", 0.00000000 },
+  { "绝", 0.00000000 },
+  { "性", 0.00140000 },
+  { "祖", 0.00030000 },
+  { "你", 0.00030000 },
+  { "灌", 0.00000000 },
+  { "鹿", 0.00010000 },
+  { "虑", 0.00000000 },
+  { "问", 0.00000000 },
+  { "烈", 0.00020000 },
+  { "弄", 0.00000000 },
+  { "池", 0.00020000 },
+  { "玩", 0.00040000 },
+  { "臂", 0.00000000 },
+  { "蜜", 0.00000000 },
+  { "估", 0.00020000 },
+  { "萍", 0.00000000 },
+  { "袭", 0.00000000 },
+  { "项", 0.00000000 },
+  { "奶", 0.00020000 },
+  { "嗯", 0.00000000 },
+  { "勒", 0.00030000 },
+  { "因", 0.00310000 },
+  { "赛", 0.00000000 },
+  { "印", 0.00080000 },
+  { "花", 0.00090000 },
+  { "峰", 0.00020000 },
+  { "手", 0.00160000 },
+  { "掌", 0.00010000 },
+  { "逻", 0.00000000 },
+  { "句", 0.00020000 },
+  { "字", 0.00620000 },
+  { "愧", 0.00000000 },
+  { "琪", 0.00010000 },
+  { "绪", 0.00000000 },
+  { "端", 0.00020000 },
+  { "替", 0.00020000 },
+  { "黄", 0.00000000 },
+  { "善", 0.00030000 },
+  { "味", 0.00020000 },
+  { "咦", 0.00000000 },
+  { "堆", 0.00010000 },
+  { "巷", 0.00000000 },
+  { "幻", 0.00010000 },
+  { "宏", 0.00000000 },
+  { "姆", 0.00010000 },
+  { "闰", 0.00000000 },
+  { "矛", 0.00000000 },
+  { "虫", 0.00000000 },
+  { "分", 0.00430000 },
+  { "滋", 0.00000000 },
+  { "雅", 0.00030000 },
+  { "案", 0.00060000 },
+  { "治", 0.00140000 },
+  { "它", 0.00010000 },
+  { "毛", 0.00040000 },
+  { "翘", 0.00000000 },
+  { "後", 0.00660000 },
+  { "跑", 0.00020000 },
+  { "嘿", 0.00000000 },
+  { "阵", 0.00000000 },
+  { "太", 0.00130000 },
+  { "经", 0.00000000 },
+  { "是", 0.00070000 },
+  { "挡", 0.00000000 },
+  { "兆", 0.00010000 },
+  { "交", 0.00150000 },
+  { "彝", 0.00000000 },
+  { "六", 0.00110000 },
+  { "邻", 0.00000000 },
+  { "做", 0.00490000 },
+  { "庞", 0.00000000 },
+  { "敌", 0.00000000 },
+  { "赵", 0.00000000 },
+  { "属", 0.00000000 },
+  { "单", 0.00000000 },
+  { "增", 0.00050000 },
+  { "榜", 0.00010000 },
+  { "面", 0.00500000 },
+  { "抱", 0.00000000 },
+  { "洲", 0.00220000 },
+  { "瑰", 0.00000000 },
+  { "画", 0.00000000 },
+  { "札", 0.00000000 },
+  { "从", 0.00000000 },
+  { "航", 0.00040000 },
+  { "讲", 0.00000000 },
+  { "昆", 0.00010000 },
+  { "尺", 0.00020000 },
+  { "鹤", 0.00000000 },
+  { "亨", 0.00010000 },
+  { "仅", 0.00000000 },
+  { "搜", 0.00010000 },
+  { "阶", 0.00000000 },
+  { "燕", 0.00010000 },
+  { "柳", 0.00000000 },
+  { "害", 0.00010000 },
+  { "暖", 0.00000000 },
+  { "剩", 0.00010000 },
+  { "竟", 0.00000000 },
+  { "惧", 0.00000000 },
+  { "沃", 0.00010000 },
+  { "氛", 0.00000000 },
+  { "绵", 0.00000000 },
+  { "莎", 0.00010000 },
+  { "双", 0.00000000 },
+  { "兼", 0.00040000 },
+  { "袋", 0.00010000 },
+  { "变", 0.00000000 },
+  { "吟", 0.00000000 },
+  { "返", 0.00100000 },
+  { "犹", 0.00000000 },
+  { "恢", 0.00010000 },
+  { "警", 0.00050000 },
+  { "材", 0.00020000 },
+  { "信", 0.00090000 },
+  { "发", 0.00000000 },
+  { "历", 0.00000000 },
+  { "硕", 0.00000000 },
+  { "腾", 0.00000000 },
+  { "吻", 0.00000000 },
+  { "违", 0.00000000 },
+  { "红", 0.00000000 },
+  { "乎", 0.00020000 },
+  { "苗", 0.00010000 },
+  { "汤", 0.00000000 },
+  { "途", 0.00030000 },
+  { "逃", 0.00010000 },
+  { "赖", 0.00000000 },
+  { "势", 0.00000000 },
+  { "晴", 0.00000000 },
+  { "咧", 0.00000000 },
+  { "禅", 0.00000000 },
+  { "借", 0.00020000 },
+  { "递", 0.00000000 },
+  { "划", 0.00000000 },
+  { "悲", 0.00000000 },
+  { "型", 0.00120000 },
+  { "乔", 0.00000000 },
+  { "嘻", 0.00000000 },
+  { "休", 0.00020000 },
+  { "虽", 0.00000000 },
+  { "事", 0.00210000 },
+  { "聪", 0.00000000 },
+  { "厌", 0.00000000 },
+  { "踏", 0.00000000 },
+  { "魔", 0.00010000 },
+  { "建", 0.00190000 },
+  { "阔", 0.00000000 },
+  { "世", 0.00330000 },
+  { "音", 0.00200000 },
+  { "阐", 0.00000000 },
+  { "多", 0.00490000 },
+  { "决", 0.00000000 },
+  { "知", 0.00080000 },
+  { "锡", 0.00000000 },
+  { "贩", 0.00000000 },
+  { "访", 0.00000000 },
+  { "羊", 0.00010000 },
+  { "咱", 0.00000000 },
+  { "舍", 0.00010000 },
+  { "动", 0.00000000 },
+  { "体", 0.00000000 },
+  { "犯", 0.00010000 },
+  { "抗", 0.00030000 },
+  { "难", 0.00000000 },
+  { "插", 0.00010000 },
+  { "付", 0.00010000 },
+  { "摔", 0.00010000 },
+  { "慎", 0.00000000 },
+  { "空", 0.00090000 },
+  { "疯", 0.00000000 },
+  { "韩", 0.00000000 },
+  { "塑", 0.00010000 },
+  { "篮", 0.00000000 },
+  { "他", 0.00130000 },
+  { "蛋", 0.00020000 },
+  { "优", 0.00000000 },
+  { "紫", 0.00020000 },
+  { "团", 0.00000000 },
+  { "佛", 0.00040000 },
+  { "军", 0.00000000 },
+  { "享", 0.00010000 },
+  { "皮", 0.00030000 },
+  { "钦", 0.00000000 },
+  { "怀", 0.00000000 },
+  { "冠", 0.00050000 },
+  { "珍", 0.00020000 },
+  { "敢", 0.00000000 },
+  { "晃", 0.00000000 },
+  { "打", 0.00160000 },
+  { "驱", 0.00000000 },
+  { "我", 0.00040000 },
+  { "铃", 0.00000000 },
+  { "贸", 0.00000000 },
+  { "奉", 0.00010000 },
+  { "集", 0.00130000 },
+  { "弥", 0.00000000 },
+  { "业", 0.00000000 },
+  { "偷", 0.00010000 },
+  { "娜", 0.00010000 },
+  { "血", 0.00030000 },
+  { "研", 0.00060000 },
+  { "翼", 0.00020000 },
+  { "店", 0.00040000 },
+  { "腰", 0.00010000 },
+  { "造", 0.00090000 },
+  { "憾", 0.00000000 },
+  { "蠢", 0.00000000 },
+  { "童", 0.00040000 },
+  { "勿", 0.00000000 },
+  { "结", 0.00000000 },
+  { "浙", 0.00010000 },
+  { "镜", 0.00000000 },
+  { "层", 0.00000000 },
+  { "法", 0.00370000 },
+  { "轩", 0.00000000 },
+  { "英", 0.00380000 },
+  { "祯", 0.00000000 },
+  { "度", 0.00320000 },
+  { "拥", 0.00000000 },
+  { "陶", 0.00010000 },
+  { "没", 0.00000000 },
+  { "圳", 0.00020000 },
+  { "通", 0.00270000 },
+  { "况", 0.00000000 },
+  { "擦", 0.00000000 },
+  { "岸", 0.00050000 },
+  { "圆", 0.00000000 },
+  { "樱", 0.00000000 },
+  { "寄", 0.00010000 },
+  { "拔", 0.00010000 },
+  { "倾", 0.00000000 },
+  { "街", 0.00130000 },
+  { "斐", 0.00000000 },
+  { "咨", 0.00000000 },
+  { "滴", 0.00000000 },
+  { "嫌", 0.00000000 },
+  { "效", 0.00040000 },
+  { "持", 0.00090000 },
+  { "敲", 0.00000000 },
+  { "未", 0.00080000 },
+  { "怨", 0.00000000 },
+  { "补", 0.00000000 },
+  { "者", 0.00300000 },
+  { "家", 0.00530000 },
+  { "奖", 0.00000000 },
+  { "谢", 0.00000000 },
+  { "梁", 0.00030000 },
+  { "指", 0.00310000 },
+  { "陷", 0.00010000 },
+  { "胎", 0.00010000 },
+  { "捕", 0.00020000 },
+  { "情", 0.00080000 },
+  { "戊", 0.00000000 },
+  { "暗", 0.00010000 },
+  { "旭", 0.00000000 },
+  { "儿", 0.00000000 },
+  { "映", 0.00020000 },
+  { "义", 0.00000000 },
+  { "定", 0.00230000 },
+  { "喊", 0.00000000 },
+  { "乱", 0.00000000 },
+  { "垃", 0.00000000 },
+  { "拒", 0.00010000 },
+  { "八", 0.00110000 },
+  { "跳", 0.00010000 },
+  { "腓", 0.00000000 },
+  { "甚", 0.00030000 },
+  { "斋", 0.00000000 },
+  { "雉", 0.00000000 },
+  { "茶", 0.00020000 },
+  { "鱼", 0.00000000 },
+  { "玛", 0.00000000 },
+  { "冒", 0.00010000 },
+  { "爵", 0.00020000 },
+  { "昂", 0.00010000 },
+  { "跃", 0.00000000 },
+  { "流", 0.00130000 },
+  { "各", 0.00110000 },
+  { "遵", 0.00000000 },
+  { "吗", 0.00000000 },
+  { "争", 0.00000000 },
+  { "门", 0.00000000 },
+  { "汽", 0.00020000 },
+  { "显", 0.00000000 },
+  { "匙", 0.00000000 },
+  { "倚", 0.00000000 },
+  { "叉", 0.00010000 },
+  { "干", 0.00010000 },
+  { "凌", 0.00010000 },
+  { "寸", 0.00000000 },
+  { "址", 0.00020000 },
+  { "敏", 0.00010000 },
+  { "笛", 0.00000000 },
+  { "掉", 0.00000000 },
+  { "健", 0.00020000 },
+  { "献", 0.00000000 },
+  { "最", 0.00410000 },
+  { "待", 0.00010000 },
+  { "遮", 0.00010000 },
+  { "头", 0.00000000 },
+  { "宿", 0.00020000 },
+  { "坡", 0.00030000 },
+  { "筹", 0.00000000 },
+  { "豆", 0.00010000 },
+  { "局", 0.00090000 },
+  { "慢", 0.00030000 },
+  { "药", 0.00000000 },
+  { "输", 0.00000000 },
+  { "佤", 0.00000000 },
+  { "宴", 0.00000000 },
+  { "亿", 0.00000000 },
+  { "蒂", 0.00010000 },
+  { "形", 0.00130000 },
+  { "欠", 0.00000000 },
+  { "立", 0.00280000 },
+  { "果", 0.00120000 },
+  { "井", 0.00010000 },
+  { "绘", 0.00000000 },
+  { "婆", 0.00020000 },
+  { "华", 0.00000000 },
+  { "彩", 0.00020000 },
+  { "涅", 0.00000000 },
+  { "拖", 0.00010000 },
+  { "啊", 0.00000000 },
+  { "泛", 0.00020000 },
+  { "厍", 0.00000000 },
+  { "眼", 0.00030000 },
+  { "致", 0.00040000 },
+  { "授", 0.00020000 },
+  { "第", 0.00410000 },
+  { "企", 0.00050000 },
+  { "餐", 0.00030000 },
+  { "邪", 0.00000000 },
+  { "丧", 0.00000000 },
+  { "睡", 0.00000000 },
+  { "闻", 0.00000000 },
+  { "自", 0.00340000 },
+  { "逢", 0.00010000 },
+  { "术", 0.00000000 },
+  { "活", 0.00090000 },
+  { "祚", 0.00000000 },
+  { "秋", 0.00020000 },
+  { "稳", 0.00000000 },
+  { "均", 0.00030000 },
+  { "泊", 0.00010000 },
+  { "织", 0.00000000 },
+  { "罐", 0.00000000 },
+  { "亮", 0.00010000 },
+  { "径", 0.00000000 },
+  { "武", 0.00060000 },
+  { "切", 0.00020000 },
+  { "罕", 0.00010000 },
+  { "邱", 0.00000000 },
+  { "雨", 0.00020000 },
+  { "精", 0.00040000 },
+  { "老", 0.00100000 },
+  { "摸", 0.00000000 },
+  { "甸", 0.00010000 },
+  { "联", 0.00000000 },
+  { "抹", 0.00000000 },
+  { "雪", 0.00020000 },
+  { "粗", 0.00010000 },
+  { "预", 0.00000000 },
+  { "震", 0.00020000 },
+  { "馨", 0.00000000 },
+  { "奏", 0.00010000 },
+  { "珀", 0.00000000 },
+  { "码", 0.00000000 },
+  { "劝", 0.00000000 },
+  { "互", 0.00030000 },
+  { "岁", 0.00000000 },
+  { "阿", 0.00290000 },
+  { "册", 0.00000000 },
+  { "负", 0.00000000 },
+  { "件", 0.00100000 },
+  { "川", 0.00030000 },
+  { "析", 0.00010000 },
+  { "转", 0.00000000 },
+  { "磁", 0.00010000 },
+  { "饮", 0.00000000 },
+  { "职", 0.00000000 },
+  { "创", 0.00000000 },
+  { "如", 0.00170000 },
+  { "疑", 0.00020000 },
+  { "击", 0.00000000 },
+  { "罚", 0.00000000 },
+  { "凡", 0.00010000 },
+  { "赚", 0.00000000 },
+  { "添", 0.00010000 },
+  { "见", 0.00000000 },
+  { "乍", 0.00000000 },
+  { "顶", 0.00000000 },
+  { "抢", 0.00000000 },
+  { "翻", 0.00020000 },
+  { "短", 0.00040000 },
+  { "痕", 0.00000000 },
+  { "练", 0.00000000 },
+  { "伍", 0.00010000 },
+  { "般", 0.00060000 },
+  { "西", 0.00410000 },
+  { "块", 0.00000000 },
+  { "禁", 0.00020000 },
+  { "败", 0.00000000 },
+  { "惯", 0.00000000 },
+  { "族", 0.00090000 },
+  { "观", 0.00000000 },
+  { "胸", 0.00010000 },
+  { "岂", 0.00000000 },
+  { "且", 0.00060000 },
+  { "弟", 0.00020000 },
+  { "幕", 0.00030000 },
+  { "恩", 0.00020000 },
+  { "展", 0.00150000 },
+  { "妹", 0.00010000 },
+  { "染", 0.00010000 },
+  { "孤", 0.00010000 },
+  { "糖", 0.00010000 },
+  { "济", 0.00000000 },
+  { "汶", 0.00010000 },
+  { "详", 0.00000000 },
+  { "舰", 0.00000000 },
+  { "芬", 0.00010000 },
+  { "轰", 0.00000000 },
+  { "丽", 0.00000000 },
+  { "放", 0.00090000 },
+  { "鸿", 0.00000000 },
+  { "喵", 0.00000000 },
+  { "崩", 0.00000000 },
+  { "呢", 0.00450000 },
+  { "赌", 0.00000000 },
+  { "飞", 0.00000000 },
+  { "蔡", 0.00010000 },
+  { "邓", 0.00000000 },
+  { "梅", 0.00020000 },
+  { "壁", 0.00010000 },
+  { "富", 0.00060000 },
+  { "记", 0.00000000 },
+  { "筋", 0.00000000 },
+  { "涵", 0.00000000 },
+  { "彼", 0.00000000 },
+  { "珊", 0.00010000 },
+  { "姐", 0.00020000 },
+  { "迫", 0.00010000 },
+  { "晚", 0.00040000 },
+  { "脸", 0.00000000 },
+  { "盈", 0.00010000 },
+  { "孕", 0.00000000 },
+  { "岘", 0.00000000 },
+  { "暴", 0.00030000 },
+  { "段", 0.00070000 },
+  { "频", 0.00000000 },
+  { "愈", 0.00000000 },
+  { "桑", 0.00010000 },
+  { "骤", 0.00000000 },
+  { "媒", 0.00030000 },
+  { "兔", 0.00010000 },
+  { "燃", 0.00010000 },
+  { "耍", 0.00000000 },
+  { "具", 0.00040000 },
+  { "名", 0.00450000 },
+  { "吉", 0.00030000 },
+  { "佩", 0.00010000 },
+  { "曲", 0.00090000 },
+  { "忌", 0.00000000 },
+  { "菩", 0.00000000 },
+  { "笨", 0.00000000 },
+  { "注", 0.00030000 },
+  { "并", 0.00000000 },
+  { "哪", 0.00000000 },
+  { "了", 0.00020000 },
+  { "娄", 0.00000000 },
+  { "班", 0.00090000 },
+  { "芳", 0.00010000 },
+  { "售", 0.00020000 },
+  { "叭", 0.00000000 },
+  { "乡", 0.00000000 },
+  { "楼", 0.00000000 },
+  { "键", 0.00000000 },
+  { "割", 0.00010000 },
+  { "数", 0.00000000 },
+  { "笔", 0.00000000 },
+  { "疗", 0.00000000 },
+  { "屁", 0.00000000 },
+  { "嘉", 0.00040000 },
+  { "封", 0.00040000 },
+  { "开", 0.00000000 },
+  { "宁", 0.00000000 },
+  { "无", 0.00000000 },
+  { "捷", 0.00010000 },
+  { "誉", 0.00000000 },
+  { "舟", 0.00000000 },
+  { "律", 0.00060000 },
+  { "饭", 0.00000000 },
+  { "固", 0.00020000 },
+  { "薪", 0.00000000 },
+  { "豪", 0.00030000 },
+  { "柔", 0.00010000 },
+  { "重", 0.00370000 },
+  { "上", 0.00590000 },
+  { "琊", 0.00000000 },
+  { "璃", 0.00010000 },
+  { "影", 0.00170000 },
+  { "彻", 0.00000000 },
+  { "价", 0.00000000 },
+  { "户", 0.00000000 },
+  { "顺", 0.00000000 },
+  { "消", 0.00050000 },
+  { "壮", 0.00000000 },
+  { "堪", 0.00000000 },
+  { "岚", 0.00000000 },
+  { "帖", 0.00000000 },
+  { "哩", 0.00010000 },
+  { "鼓", 0.00020000 },
+  { "懒", 0.00000000 },
+  { "吧", 0.00000000 },
+  { "仪", 0.00000000 },
+  { "刘", 0.00000000 },
+  { "聚", 0.00020000 },
+  { "春", 0.00030000 },
+  { "装", 0.00000000 },
+  { "买", 0.00000000 },
+  { "狐", 0.00010000 },
+  { "凯", 0.00000000 },
+  { "贤", 0.00000000 },
+  { "烦", 0.00000000 },
+  { "瑙", 0.00000000 },
+  { "曰", 0.00000000 },
+  { "寻", 0.00000000 },
+  { "歉", 0.00000000 },
+  { "够", 0.00000000 },
+  { "癸", 0.00000000 },
+  { "敝", 0.00000000 },
+  { "什", 0.00010000 },
+  { "改", 0.00180000 },
+  { "凝", 0.00000000 },
+  { "与", 0.00000000 },
+  { "盘", 0.00000000 },
+  { "谓", 0.00000000 },
+  { "胶", 0.00000000 },
+  { "化", 0.00210000 },
+  { "乃", 0.00010000 },
+  { "尤", 0.00020000 },
+  { "捉", 0.00020000 },
+  { "匆", 0.00000000 },
+  { "含", 0.00030000 },
+  { "或", 0.00270000 },
+  { "丌", 0.00000000 },
+  { "瓜", 0.00010000 },
+  { "妻", 0.00000000 },
+  { "恰", 0.00000000 },
+  { "用", 0.00570000 },
+  { "遇", 0.00010000 },
+  { "辱", 0.00000000 },
+  { "吵", 0.00000000 },
+  { "檀", 0.00000000 },
+  { "技", 0.00050000 },
+  { "讨", 0.00000000 },
+  { "赠", 0.00000000 },
+  { "券", 0.00010000 },
+  { "蚁", 0.00000000 },
+  { "玫", 0.00000000 },
+  { "服", 0.00110000 },
+  { "态", 0.00000000 },
+  { "传", 0.00000000 },
+  { "号", 0.00000000 },
+  { "雳", 0.00000000 },
+  { "异", 0.00000000 },
+  { "牢", 0.00000000 },
+  { "套", 0.00050000 },
+  { "狗", 0.00020000 },
+  { "偶", 0.00010000 },
+  { "坦", 0.00030000 },
+  { "协", 0.00000000 },
+  { "盾", 0.00000000 },
+  { "丢", 0.00000000 },
+  { "妨", 0.00000000 },
+  { "圭", 0.00000000 },
+  { "障", 0.00010000 },
+  { "孝", 0.00000000 },
+  { "络", 0.00000000 },
+  { "本", 0.00400000 },
+  { "鸡", 0.00000000 },
+  { "霸", 0.00010000 },
+  { "科", 0.00160000 },
+  { "钱", 0.00000000 },
+  { "帅", 0.00000000 },
+  { "油", 0.00050000 },
+  { "遗", 0.00000000 },
+  { "津", 0.00020000 },
+  { "博", 0.00050000 },
+  { "小", 0.00210000 },
+  { "污", 0.00010000 },
+  { "坎", 0.00010000 },
+  { "猜", 0.00000000 },
+  { "忘", 0.00000000 },
+  { "等", 0.00310000 },
+  { "繁", 0.00030000 },
+  { "钟", 0.00000000 },
+  { "磅", 0.00000000 },
+  { "失", 0.00040000 },
+  { "光", 0.00090000 },
+  { "仁", 0.00020000 },
+  { "究", 0.00060000 },
+  { "大", 0.01240000 },
+  { "志", 0.00040000 },
+  { "廖", 0.00000000 },
+  { "路", 0.00300000 },
+  { "微", 0.00030000 },
+  { "爬", 0.00010000 },
+  { "攻", 0.00030000 },
+  { "悉", 0.00010000 },
+  { "思", 0.00070000 },
+  { "贾", 0.00000000 },
+  { "语", 0.00000000 },
+  { "否", 0.00010000 },
+  { "盼", 0.00000000 },
+  { "树", 0.00000000 },
+  { "锋", 0.00000000 },
+  { "玻", 0.00010000 },
+  { "低", 0.00070000 },
+  { "给", 0.00000000 },
+  { "玲", 0.00010000 },
+  { "柴", 0.00020000 },
+  { "库", 0.00000000 },
+  { "痴", 0.00000000 },
+  { "陪", 0.00000000 },
+  { "爸", 0.00020000 },
+  { "郎", 0.00010000 },
+  { "鸟", 0.00000000 },
+  { "木", 0.00040000 },
+  { "懂", 0.00000000 },
+  { "证", 0.00000000 },
+  { "息", 0.00030000 },
+  { "呈", 0.00010000 },
+  { "刺", 0.00010000 },
+  { "刚", 0.00000000 },
+  { "统", 0.00000000 },
+  { "百", 0.00110000 },
+  { "剧", 0.00000000 },
+  { "慈", 0.00010000 },
+  { "枪", 0.00000000 },
+  { "疆", 0.00010000 },
+  { "查", 0.00040000 },
+  { "缓", 0.00000000 },
+  { "灰", 0.00020000 },
+  { "剪", 0.00000000 },
+  { "哈", 0.00030000 },
+  { "栏", 0.00000000 },
+  { "狼", 0.00010000 },
+  { "识", 0.00000000 },
+  { "死", 0.00100000 },
+  { "南", 0.00390000 },
+  { "哀", 0.00000000 },
+  { "财", 0.00000000 },
+  { "漫", 0.00030000 },
+  { "嗨", 0.00000000 },
+  { "牺", 0.00000000 },
+  { "灿", 0.00000000 },
+  { "板", 0.00020000 },
+  { "租", 0.00020000 },
+  { "峡", 0.00000000 },
+  { "荒", 0.00010000 },
+  { "飙", 0.00000000 },
+  { "辅", 0.00000000 },
+  { "球", 0.00280000 },
+  { "资", 0.00000000 },
+  { "便", 0.00090000 },
+  { "皇", 0.00080000 },
+  { "壬", 0.00000000 },
+  { "镇", 0.00000000 },
+  { "导", 0.00000000 },
+  { "五", 0.00140000 },
+  { "响", 0.00010000 },
+  { "矶", 0.00000000 },
+  { "崇", 0.00010000 },
+  { "委", 0.00080000 },
+  { "腿", 0.00000000 },
+  { "清", 0.00110000 },
+  { "绕", 0.00000000 },
+  { "心", 0.00180000 },
+  { "洗", 0.00010000 },
+  { "铭", 0.00000000 },
+  { "帝", 0.00090000 },
+  { "裁", 0.00020000 },
+  { "须", 0.00000000 },
+  { "戒", 0.00010000 },
+  { "纳", 0.00000000 },
+  { "然", 0.00170000 },
+  { "说", 0.00000000 },
+  { "浮", 0.00010000 },
+  { "籍", 0.00030000 },
+  { "渐", 0.00000000 },
+  { "莉", 0.00010000 },
+  { "剂", 0.00000000 },
+  { "退", 0.00040000 },
+  { "请", 0.00000000 },
+  { "浅", 0.00000000 },
+  { "洛", 0.00030000 },
+  { "洋", 0.00080000 },
+  { "庆", 0.00000000 },
+  { "汝", 0.00000000 },
+  { "琼", 0.00000000 },
+  { "韦", 0.00000000 },
+  { "系", 0.00130000 },
+  { "宛", 0.00000000 },
+  { "教", 0.00210000 },
+  { "唐", 0.00060000 },
+  { "乌", 0.00000000 },
+  { "掸", 0.00000000 },
+  { "巡", 0.00010000 },
+  { "器", 0.00080000 },
+  { "戴", 0.00010000 },
+  { "辩", 0.00000000 },
+  { "许", 0.00000000 },
+  { "政", 0.00400000 },
+  { "采", 0.00000000 },
+  { "骨", 0.00020000 },
+  { "士", 0.00350000 },
+  { "林", 0.00120000 },
+  { "近", 0.00140000 },
+  { "侧", 0.00000000 },
+  { "寝", 0.00000000 },
+  { "盖", 0.00000000 },
+  { "受", 0.00120000 },
+  { "也", 0.00020000 },
+  { "档", 0.00000000 },
+  { "佑", 0.00000000 },
+  { "怕", 0.00000000 },
+  { "暂", 0.00000000 },
+  { "锅", 0.00000000 },
+  { "曼", 0.00040000 },
+  { "瑶", 0.00000000 },
+  { "列", 0.00110000 },
+  { "底", 0.00070000 },
+  { "饼", 0.00000000 },
+  { "潜", 0.00000000 },
+  { "莲", 0.00000000 },
+  { "包", 0.00170000 },
+  { "恨", 0.00000000 },
+  { "客", 0.00120000 },
+  { "淡", 0.00010000 },
+  { "模", 0.00050000 },
+  { "卷", 0.00010000 },
+  { "驶", 0.00000000 },
+  { "姑", 0.00000000 },
+  { "质", 0.00000000 },
+  { "怪", 0.00010000 },
+  { "寂", 0.00000000 },
+  { "明", 0.00180000 },
+  { "侬", 0.00000000 },
+  { "弹", 0.00000000 },
+  { "主", 0.00490000 },
+  { "罗", 0.00000000 },
+  { "国", 0.00000000 },
+  { "亚", 0.00000000 },
+  { "拨", 0.00000000 },
+  { "私", 0.00030000 },
+  { "找", 0.00000000 },
+  { "羯", 0.00000000 },
+  { "诉", 0.00000000 },
+  { "留", 0.00050000 },
+  { "批", 0.00040000 },
+  { "玄", 0.00010000 },
+  { "嫁", 0.00000000 },
+  { "连", 0.00000000 },
+  { "扬", 0.00000000 },
+  { "醉", 0.00000000 },
+  { "毕", 0.00000000 },
+  { "浦", 0.00020000 },
+  { "相", 0.00160000 },
+  { "岳", 0.00000000 },
+  { "友", 0.00050000 },
+  { "淋", 0.00000000 },
+  { "原", 0.00230000 },
+  { "耐", 0.00030000 },
+  { "离", 0.00000000 },
+  { "断", 0.00000000 },
+  { "怡", 0.00010000 },
+  { "胞", 0.00010000 },
+  { "拷", 0.00000000 },
+  { "穆", 0.00010000 },
+  { "煌", 0.00000000 },
+  { "俾", 0.00090000 },
+  { "束", 0.00020000 },
+  { "标", 0.00000000 },
+  { "浓", 0.00000000 },
+  { "帕", 0.00010000 },
+  { "悄", 0.00000000 },
+  { "闷", 0.00000000 },
+  { "陆", 0.00000000 },
+  { "席", 0.00070000 },
+  { "孟", 0.00010000 },
+  { "文", 0.00570000 },
+  { "卯", 0.00000000 },
+  { "蛙", 0.00010000 },
+  { "澳", 0.00110000 },
+  { "及", 0.00200000 },
+  { "右", 0.00040000 },
+  { "拟", 0.00000000 },
+  { "虾", 0.00000000 },
+  { "摘", 0.00000000 },
+  { "稿", 0.00010000 },
+  { "着", 0.00020000 },
+  { "误", 0.00000000 },
+  { "域", 0.00060000 },
+  { "喷", 0.00000000 },
+  { "敬", 0.00010000 },
+  { "奋", 0.00000000 },
+  { "储", 0.00000000 },
+  { "挝", 0.00000000 },
+  { "粒", 0.00050000 },
+  { "扩", 0.00000000 },
+  { "茨", 0.00000000 },
+  { "伽", 0.00000000 },
+  { "霖", 0.00000000 },
+  { "锁", 0.00000000 },
+  { "坛", 0.00000000 },
+  { "党", 0.00000000 },
+  { "谁", 0.00000000 },
+  { "田", 0.00090000 },
+  { "市", 0.00330000 },
+  { "迅", 0.00010000 },
+  { "廷", 0.00020000 },
+  { "物", 0.00310000 },
+  { "咬", 0.00000000 },
+  { "腐", 0.00010000 },
+  { "扁", 0.00010000 },
+  { "喔", 0.00000000 },
+  { "晨", 0.00010000 },
+  { "贡", 0.00000000 },
+  { "徒", 0.00020000 },
+  { "倦", 0.00000000 },
+  { "限", 0.00070000 },
+  { "备", 0.00000000 },
+  { "辑", 0.00000000 },
+  { "词", 0.00000000 },
+  { "温", 0.00000000 },
+  { "鞑", 0.00000000 },
+  { "靠", 0.00020000 },
+  { "举", 0.00000000 },
+  { "涉", 0.00010000 },
+  { "秩", 0.00000000 },
+  { "叔", 0.00010000 },
+  { "描", 0.00010000 },
+  { "湖", 0.00040000 },
+  { "漏", 0.00000000 },
+  { "读", 0.00000000 },
+  { "素", 0.00070000 },
+  { "亦", 0.00370000 },
+  { "卫", 0.00000000 },
+  { "口", 0.00210000 },
+  { "惑", 0.00000000 },
+  { "徵", 0.00020000 },
+  { "剑", 0.00000000 },
+  { "黎", 0.00030000 },
+  { "冷", 0.00030000 },
+  { "慧", 0.00010000 },
+  { "俗", 0.00020000 },
+  { "弱", 0.00010000 },
+  { "毅", 0.00000000 },
+  { "式", 0.00200000 },
+  { "谜", 0.00000000 },
+  { "挑", 0.00010000 },
+  { "销", 0.00000000 },
+  { "锦", 0.00000000 },
+  { "偌", 0.00000000 },
+  { "堕", 0.00000000 },
+  { "惨", 0.00000000 },
+  { "助", 0.00050000 },
+  { "检", 0.00000000 },
+  { "鞋", 0.00000000 },
+  { "斯", 0.00200000 },
+  { "杜", 0.00020000 },
+  { "制", 0.00120000 },
+  { "奴", 0.00010000 },
+  { "县", 0.00000000 },
+  { "秤", 0.00000000 },
+  { "澎", 0.00000000 },
+  { "界", 0.00250000 },
+  { "腹", 0.00010000 },
+  { "评", 0.00000000 },
+  { "芝", 0.00010000 },
+  { "即", 0.00190000 },
+  { "迪", 0.00030000 },
+  { "碟", 0.00020000 },
+  { "庙", 0.00000000 },
+  { "勋", 0.00000000 },
+  { "孜", 0.00000000 },
+  { "测", 0.00000000 },
+  { "握", 0.00000000 },
+  { "半", 0.00090000 },
+  { "抑", 0.00000000 },
+  { "裕", 0.00010000 },
+  { "专", 0.00000000 },
+  { "奇", 0.00030000 },
+  { "谷", 0.00030000 },
+  { "撞", 0.00010000 },
+  { "魂", 0.00010000 },
+  { "穷", 0.00000000 },
+  { "声", 0.00000000 },
+  { "措", 0.00000000 },
+  { "萄", 0.00020000 },
+  { "杀", 0.00000000 },
+  { "朱", 0.00020000 },
+  { "每", 0.00110000 },
+  { "写", 0.00000000 },
+  { "控", 0.00040000 },
+  { "作", 0.00300000 },
+  { "静", 0.00000000 },
+  { "全", 0.00240000 },
+  { "智", 0.00020000 },
+  { "办", 0.00000000 },
+  { "梵", 0.00010000 },
+  { "论", 0.00000000 },
+  { "料", 0.00050000 },
+  { "恶", 0.00000000 },
+  { "斗", 0.00010000 },
+  { "表", 0.00190000 },
+  { "站", 0.00330000 },
+  { "伙", 0.00010000 },
+  { "唤", 0.00000000 },
+  { "确", 0.00000000 },
+  { "炉", 0.00000000 },
+  { "框", 0.00000000 },
+  { "啡", 0.00010000 },
+  { "权", 0.00000000 },
+  { "执", 0.00000000 },
+  { "想", 0.00060000 },
+  { "鬼", 0.00010000 },
+  { "良", 0.00020000 },
+  { "瑟", 0.00010000 },
+  { "弦", 0.00010000 },
+  { "有", 0.01530000 },
+  { "日", 0.00510000 },
+  { "兽", 0.00000000 },
+  { "下", 0.00350000 },
+  { "讯", 0.00000000 },
+  { "匹", 0.00010000 },
+  { "伴", 0.00010000 },
+  { "糊", 0.00010000 },
+  { "饱", 0.00000000 },
+  { "圣", 0.00000000 },
+  { "塞", 0.00030000 },
+  { "同", 0.01910000 },
+  { "水", 0.00260000 },
+  { "拉", 0.00300000 },
+  { "肉", 0.00030000 },
+  { "出", 0.00690000 },
+  { "索", 0.00020000 },
+  { "贞", 0.00000000 },
+  { "侯", 0.00010000 },
+  { "美", 0.00230000 },
+  { "签", 0.00000000 },
+  { "辉", 0.00000000 },
+  { "理", 0.00250000 },
+  { "以", 0.00930000 },
+  { "浩", 0.00010000 },
+  { "厂", 0.00000000 },
+  { "齿", 0.00000000 },
+  { "七", 0.00080000 },
+  { "居", 0.00080000 },
+  { "议", 0.00000000 },
+  { "候", 0.00050000 },
+  { "古", 0.00130000 },
+  { "臭", 0.00000000 },
+  { "长", 0.00000000 },
+  { "己", 0.00080000 },
+  { "棚", 0.00000000 },
+  { "晒", 0.00040000 },
+  { "录", 0.00000000 },
+  { "缠", 0.00000000 },
+  { "骑", 0.00000000 },
+  { "野", 0.00040000 },
+  { "代", 0.00380000 },
+  { "楚", 0.00020000 },
+  { "火", 0.00070000 },
+  { "泥", 0.00020000 },
+  { "奔", 0.00000000 },
+  { "妈", 0.00000000 },
+  { "贱", 0.00000000 },
+  { "棋", 0.00010000 },
+  { "命", 0.00080000 },
+  { "巫", 0.00000000 },
+  { "蓝", 0.00000000 },
+  { "耗", 0.00000000 },
+  { "缅", 0.00000000 },
+  { "戈", 0.00000000 },
+  { "抓", 0.00000000 },
+  { "粉", 0.00020000 },
+  { "沙", 0.00120000 },
+  { "秦", 0.00010000 },
+  { "啥", 0.00000000 },
+  { "网", 0.00000000 },
+  { "奈", 0.00010000 },
+  { "运", 0.00000000 },
+  { "邦", 0.00020000 },
+  { "色", 0.00150000 },
+  { "抄", 0.00000000 },
+  { "谨", 0.00000000 },
+  { "穿", 0.00020000 },
+  { "吾", 0.00000000 },
+  { "当", 0.00000000 },
+  { "组", 0.00000000 },
+  { "孙", 0.00000000 },
+  { "必", 0.00020000 },
+  { "衡", 0.00010000 },
+  { "若", 0.00020000 },
+  { "纽", 0.00000000 },
+  { "广", 0.00000000 },
+  { "炎", 0.00010000 },
+  { "则", 0.00000000 },
+  { "率", 0.00040000 },
+  { "截", 0.00010000 },
+  { "允", 0.00000000 },
+  { "廉", 0.00010000 },
+  { "俱", 0.00000000 },
+  { "得", 0.00250000 },
+  { "唉", 0.00000000 },
+  { "园", 0.00000000 },
+  { "故", 0.00040000 },
+  { "援", 0.00020000 },
+  { "战", 0.00000000 },
+  { "颇", 0.00000000 },
+  { "公", 0.00570000 },
+  { "史", 0.00110000 },
+  { "麦", 0.00000000 },
+  { "怒", 0.00000000 },
+  { "早", 0.00090000 },
+  { "痛", 0.00010000 },
+  { "圾", 0.00000000 },
+  { "波", 0.00090000 },
+  { "住", 0.00210000 },
+  { "参", 0.00000000 },
+  { "三", 0.00320000 },
+  { "所", 0.00330000 },
+  { "漠", 0.00010000 },
+  { "嘛", 0.00000000 },
+  { "望", 0.00040000 },
+  { "涨", 0.00000000 },
+  { "购", 0.00000000 },
+  { "范", 0.00000000 },
+  { "缶", 0.00000000 },
+  { "咯", 0.00000000 },
+  { "煞", 0.00000000 },
+  { "勤", 0.00010000 },
+  { "瑜", 0.00000000 },
+  { "征", 0.00010000 },
+  { "刀", 0.00010000 },
+  { "冰", 0.00020000 },
+  { "晓", 0.00000000 },
+  { "斥", 0.00000000 },
+  { "审", 0.00000000 },
+  { "珠", 0.00030000 },
+  { "酷", 0.00000000 },
+  { "围", 0.00000000 },
+  { "泽", 0.00000000 },
+  { "轮", 0.00000000 },
+  { "看", 0.00010000 },
+  { "洽", 0.00000000 },
+  { "兄", 0.00010000 },
+  { "按", 0.00020000 },
+  { "释", 0.00000000 },
+  { "来", 0.00000000 },
+  { "容", 0.00070000 },
+  { "聊", 0.00000000 },
+  { "僧", 0.00000000 },
+  { "梦", 0.00000000 },
+  { "凰", 0.00000000 },
+  { "孔", 0.00010000 },
+  { "东", 0.00000000 },
+  { "使", 0.00090000 },
+  { "旦", 0.00010000 },
+  { "线", 0.00000000 },
+  { "咪", 0.00010000 },
+  { "藤", 0.00010000 },
+  { "搬", 0.00030000 },
+  { "励", 0.00000000 },
+  { "仙", 0.00020000 },
+  { "辰", 0.00000000 },
+  { "唯", 0.00030000 },
+  { "宋", 0.00030000 },
+  { "获", 0.00000000 },
+  { "拘", 0.00000000 },
+  { "位", 0.00260000 },
+  { "杉", 0.00010000 },
+  { "熟", 0.00020000 },
+  { "缴", 0.00000000 },
+  { "官", 0.00110000 },
+  { "落", 0.00110000 },
+  { "慰", 0.00000000 },
+  { "松", 0.00020000 },
+  { "醒", 0.00000000 },
+  { "亏", 0.00000000 },
+  { "埔", 0.00040000 },
+  { "总", 0.00000000 },
+  { "拍", 0.00050000 },
+  { "擎", 0.00030000 },
+  { "该", 0.00000000 },
+  { "另", 0.00110000 },
+  { "呜", 0.00000000 },
+  { "云", 0.00000000 },
+  { "寡", 0.00000000 },
+  { "男", 0.00050000 },
+};
+
+const wa_cp_freq ALPHA_339_FREQ_CPS[] = {
+  { 0x4E00u, 0.01920000 },
+  { 0x4E01u, 0.00180000 },
+  { 0x4E03u, 0.00080000 },
+  { 0x4E07u, 0.00000000 },
+  { 0x4E08u, 0.00000000 },
+  { 0x4E09u, 0.00320000 },
+  { 0x4E0Au, 0.00590000 },
+  { 0x4E0Bu, 0.00350000 },
+  { 0x4E0Cu, 0.00000000 },
+  { 0x4E0Du, 0.00230000 },
+  { 0x4E0Eu, 0.00000000 },
+  { 0x4E11u, 0.00000000 },
+  { 0x4E13u, 0.00000000 },
+  { 0x4E14u, 0.00060000 },
+  { 0x4E16u, 0.00330000 },
+  { 0x4E18u, 0.00010000 },
+  { 0x4E19u, 0.00010000 },
+  { 0x4E1Au, 0.00000000 },
+  { 0x4E1Cu, 0.00000000 },
+  { 0x4E1Du, 0.00000000 },
+  { 0x4E22u, 0.00000000 },
+  { 0x4E24u, 0.00000000 },
+  { 0x4E25u, 0.00000000 },
+  { 0x4E27u, 0.00000000 },
+  { 0x4E2Au, 0.00000000 },
+  { 0x4E2Du, 0.01120000 },
+  { 0x4E30u, 0.00000000 },
+  { 0x4E32u, 0.00150000 },
+  { 0x4E34u, 0.00000000 },
+  { 0x4E38u, 0.00010000 },
+  { 0x4E39u, 0.00050000 },
+  { 0x4E3Au, 0.00000000 },
+  { 0x4E3Bu, 0.00490000 },
+  { 0x4E3Du, 0.00000000 },
+  { 0x4E3Eu, 0.00000000 },
+  { 0x4E43u, 0.00010000 },
+  { 0x4E45u, 0.00010000 },
+  { 0x4E48u, 0.00000000 },
+  { 0x4E49u, 0.00000000 },
+  { 0x4E4Bu, 0.00710000 },
+  { 0x4E4Cu, 0.00000000 },
+  { 0x4E4Du, 0.00000000 },
+  { 0x4E4Eu, 0.00020000 },
+  { 0x4E4Fu, 0.00000000 },
+  { 0x4E50u, 0.00000000 },
+  { 0x4E54u, 0.00000000 },
+  { 0x4E56u, 0.00000000 },
+  { 0x4E58u, 0.00050000 },
+  { 0x4E59u, 0.00010000 },
+  { 0x4E5Du, 0.00220000 },
+  { 0x4E5Fu, 0.00020000 },
+  { 0x4E60u, 0.00000000 },
+  { 0x4E61u, 0.00000000 },
+  { 0x4E66u, 0.00000000 },
+  { 0x4E70u, 0.00000000 },
+  { 0x4E71u, 0.00000000 },
+  { 0x4E7Eu, 0.00020000 },
+  { 0x4E86u, 0.00020000 },
+  { 0x4E88u, 0.00000000 },
+  { 0x4E89u, 0.00000000 },
+  { 0x4E8Bu, 0.00210000 },
+  { 0x4E8Cu, 0.00230000 },
+  { 0x4E8Eu, 0.00000000 },
+  { 0x4E8Fu, 0.00000000 },
+  { 0x4E91u, 0.00000000 },
+  { 0x4E92u, 0.00030000 },
+  { 0x4E94u, 0.00140000 },
+  { 0x4E95u, 0.00010000 },
+  { 0x4E9Au, 0.00000000 },
+  { 0x4E9Bu, 0.00010000 },
+  { 0x4EA1u, 0.00020000 },
+  { 0x4EA4u, 0.00150000 },
+  { 0x4EA5u, 0.00000000 },
+  { 0x4EA6u, 0.00370000 },
+  { 0x4EA7u, 0.00000000 },
+  { 0x4EA8u, 0.00010000 },
+  { 0x4EABu, 0.00010000 },
+  { 0x4EACu, 0.00080000 },
+  { 0x4EAEu, 0.00010000 },
+  { 0x4EB2u, 0.00000000 },
+  { 0x4EBAu, 0.01290000 },
+  { 0x4EBFu, 0.00000000 },
+  { 0x4EC0u, 0.00010000 },
+  { 0x4EC1u, 0.00020000 },
+  { 0x4EC5u, 0.00000000 },
+  { 0x4EC7u, 0.00000000 },
+  { 0x4ECAu, 0.00070000 },
+  { 0x4ECBu, 0.00030000 },
+  { 0x4ECDu, 0.00030000 },
+  { 0x4ECEu, 0.00000000 },
+  { 0x4ED4u, 0.00150000 },
+  { 0x4ED6u, 0.00130000 },
+  { 0x4ED8u, 0.00010000 },
+  { 0x4ED9u, 0.00020000 },
+  { 0x4EE3u, 0.00380000 },
+  { 0x4EE4u, 0.00130000 },
+  { 0x4EE5u, 0.00930000 },
+  { 0x4EEAu, 0.00000000 },
+  { 0x4EECu, 0.00000000 },
+  { 0x4EF0u, 0.00010000 },
+  { 0x4EF2u, 0.00020000 },
+  { 0x4EF6u, 0.00100000 },
+  { 0x4EF7u, 0.00000000 },
+  { 0x4EFBu, 0.00170000 },
+  { 0x4EFDu, 0.00120000 },
+  { 0x4EFFu, 0.00010000 },
+  { 0x4F01u, 0.00050000 },
+  { 0x4F0Au, 0.00050000 },
+  { 0x4F0Du, 0.00010000 },
+  { 0x4F0Fu, 0.00010000 },
+  { 0x4F10u, 0.00010000 },
+  { 0x4F11u, 0.00020000 },
+  { 0x4F17u, 0.00000000 },
+  { 0x4F18u, 0.00000000 },
+  { 0x4F19u, 0.00010000 },
+  { 0x4F1Au, 0.00000000 },
+  { 0x4F1Fu, 0.00000000 },
+  { 0x4F20u, 0.00000000 },
+  { 0x4F24u, 0.00000000 },
+  { 0x4F26u, 0.00000000 },
+  { 0x4F2Fu, 0.00180000 },
+  { 0x4F30u, 0.00020000 },
+  { 0x4F34u, 0.00010000 },
+  { 0x4F38u, 0.00020000 },
+  { 0x4F3Cu, 0.00130000 },
+  { 0x4F3Du, 0.00000000 },
+  { 0x4F46u, 0.00280000 },
+  { 0x4F4Du, 0.00260000 },
+  { 0x4F4Eu, 0.00070000 },
+  { 0x4F4Fu, 0.00210000 },
+  { 0x4F50u, 0.00020000 },
+  { 0x4F51u, 0.00000000 },
+  { 0x4F53u, 0.00000000 },
+  { 0x4F55u, 0.00050000 },
+  { 0x4F59u, 0.00000000 },
+  { 0x4F5Bu, 0.00040000 },
+  { 0x4F5Cu, 0.00300000 },
+  { 0x4F60u, 0.00030000 },
+  { 0x4F64u, 0.00000000 },
+  { 0x4F69u, 0.00010000 },
+  { 0x4F73u, 0.00030000 },
+  { 0x4F7Fu, 0.00090000 },
+  { 0x4F8Bu, 0.00130000 },
+  { 0x4F9Bu, 0.00060000 },
+  { 0x4F9Du, 0.00030000 },
+  { 0x4FA0u, 0.00000000 },
+  { 0x4FA6u, 0.00000000 },
+  { 0x4FA7u, 0.00000000 },
+  { 0x4FA8u, 0.00000000 },
+  { 0x4FACu, 0.00000000 },
+  { 0x4FAFu, 0.00010000 },
+  { 0x4FB5u, 0.00020000 },
+  { 0x4FBFu, 0.00090000 },
+  { 0x4FC3u, 0.00010000 },
+  { 0x4FC4u, 0.00030000 },
+  { 0x4FCAu, 0.00010000 },
+  { 0x4FD7u, 0.00020000 },
+  { 0x4FDDu, 0.00100000 },
+  { 0x4FE1u, 0.00090000 },
+  { 0x4FE9u, 0.00000000 },
+  { 0x4FEEu, 0.00050000 },
+  { 0x4FF1u, 0.00000000 },
+  { 0x4FFEu, 0.00090000 },
+  { 0x500Du, 0.00010000 },
+  { 0x5012u, 0.00020000 },
+  { 0x5019u, 0.00050000 },
+  { 0x501Au, 0.00000000 },
+  { 0x501Fu, 0.00020000 },
+  { 0x5026u, 0.00000000 },
+  { 0x503Cu, 0.00030000 },
+  { 0x503Eu, 0.00000000 },
+  { 0x5047u, 0.00030000 },
+  { 0x504Cu, 0.00000000 },
+  { 0x504Fu, 0.00010000 },
+  { 0x505Au, 0.00490000 },
+  { 0x505Cu, 0.00040000 },
+  { 0x5065u, 0.00020000 },
+  { 0x5076u, 0.00010000 },
+  { 0x5077u, 0.00010000 },
+  { 0x50A8u, 0.00000000 },
+  { 0x50ACu, 0.00000000 },
+  { 0x50B2u, 0.00000000 },
+  { 0x50BBu, 0.00000000 },
+  { 0x50CFu, 0.00030000 },
+  { 0x50E7u, 0.00000000 },
+  { 0x5112u, 0.00010000 },
+  { 0x513Fu, 0.00000000 },
+  { 0x5141u, 0.00000000 },
+  { 0x5143u, 0.00170000 },
+  { 0x5144u, 0.00010000 },
+  { 0x5145u, 0.00010000 },
+  { 0x5146u, 0.00010000 },
+  { 0x5148u, 0.00150000 },
+  { 0x5149u, 0.00090000 },
+  { 0x514Bu, 0.00110000 },
+  { 0x514Du, 0.00030000 },
+  { 0x5151u, 0.00000000 },
+  { 0x5154u, 0.00010000 },
+  { 0x515Au, 0.00000000 },
+  { 0x5165u, 0.00420000 },
+  { 0x5168u, 0.00240000 },
+  { 0x516Bu, 0.00110000 },
+  { 0x516Cu, 0.00570000 },
+  { 0x516Du, 0.00110000 },
+  { 0x516Eu, 0.00000000 },
+  { 0x5170u, 0.00000000 },
+  { 0x5171u, 0.00210000 },
+  { 0x5173u, 0.00000000 },
+  { 0x5174u, 0.00000000 },
+  { 0x5175u, 0.00040000 },
+  { 0x5176u, 0.00310000 },
+  { 0x5177u, 0.00040000 },
+  { 0x5178u, 0.00060000 },
+  { 0x5179u, 0.00000000 },
+  { 0x517Bu, 0.00000000 },
+  { 0x517Cu, 0.00040000 },
+  { 0x517Du, 0.00000000 },
+  { 0x5185u, 0.00000000 },
+  { 0x5188u, 0.00000000 },
+  { 0x518Cu, 0.00000000 },
+  { 0x518Du, 0.00110000 },
+  { 0x5192u, 0.00010000 },
+  { 0x5199u, 0.00000000 },
+  { 0x519Bu, 0.00000000 },
+  { 0x519Cu, 0.00000000 },
+  { 0x51A0u, 0.00050000 },
+  { 0x51ACu, 0.00020000 },
+  { 0x51B0u, 0.00020000 },
+  { 0x51B2u, 0.00000000 },
+  { 0x51B3u, 0.00000000 },
+  { 0x51B5u, 0.00000000 },
+  { 0x51B7u, 0.00030000 },
+  { 0x51C6u, 0.00010000 },
+  { 0x51CCu, 0.00010000 },
+  { 0x51CFu, 0.00000000 },
+  { 0x51DDu, 0.00000000 },
+  { 0x51E0u, 0.00000000 },
+  { 0x51E1u, 0.00010000 },
+  { 0x51E4u, 0.00000000 },
+  { 0x51EDu, 0.00000000 },
+  { 0x51EFu, 0.00000000 },
+  { 0x51F0u, 0.00000000 },
+  { 0x51FAu, 0.00690000 },
+  { 0x51FBu, 0.00000000 },
+  { 0x51FDu, 0.00010000 },
+  { 0x5200u, 0.00010000 },
+  { 0x5206u, 0.00430000 },
+  { 0x5207u, 0.00020000 },
+  { 0x520Au, 0.00020000 },
+  { 0x5211u, 0.00010000 },
+  { 0x5212u, 0.00000000 },
+  { 0x5217u, 0.00110000 },
+  { 0x5218u, 0.00000000 },
+  { 0x5219u, 0.00000000 },
+  { 0x521Au, 0.00000000 },
+  { 0x521Bu, 0.00000000 },
+  { 0x521Du, 0.00100000 },
+  { 0x5224u, 0.00030000 },
+  { 0x5229u, 0.00240000 },
+  { 0x522Bu, 0.00000000 },
+  { 0x5230u, 0.00720000 },
+  { 0x5236u, 0.00120000 },
+  { 0x5237u, 0.00010000 },
+  { 0x5238u, 0.00010000 },
+  { 0x523Au, 0.00010000 },
+  { 0x523Bu, 0.00020000 },
+  { 0x5242u, 0.00000000 },
+  { 0x524Du, 0.00310000 },
+  { 0x5251u, 0.00000000 },
+  { 0x5267u, 0.00000000 },
+  { 0x5269u, 0.00010000 },
+  { 0x526Au, 0.00000000 },
+  { 0x526Fu, 0.00040000 },
+  { 0x5272u, 0.00010000 },
+  { 0x529Bu, 0.00170000 },
+  { 0x529Du, 0.00000000 },
+  { 0x529Eu, 0.00000000 },
+  { 0x529Fu, 0.00060000 },
+  { 0x52A0u, 0.00310000 },
+  { 0x52A1u, 0.00000000 },
+  { 0x52A3u, 0.00000000 },
+  { 0x52A8u, 0.00000000 },
+  { 0x52A9u, 0.00050000 },
+  { 0x52AAu, 0.00010000 },
+  { 0x52ABu, 0.00000000 },
+  { 0x52B1u, 0.00000000 },
+  { 0x52B2u, 0.00000000 },
+  { 0x52B3u, 0.00000000 },
+  { 0x52BFu, 0.00000000 },
+  { 0x52C7u, 0.00010000 },
+  { 0x52C9u, 0.00000000 },
+  { 0x52CBu, 0.00000000 },
+  { 0x52D2u, 0.00030000 },
+  { 0x52E4u, 0.00010000 },
+  { 0x52FEu, 0.00000000 },
+  { 0x52FFu, 0.00000000 },
+  { 0x5305u, 0.00170000 },
+  { 0x5306u, 0.00000000 },
+  { 0x5308u, 0.00000000 },
+  { 0x5316u, 0.00210000 },
+  { 0x5317u, 0.00330000 },
+  { 0x5319u, 0.00000000 },
+  { 0x5339u, 0.00010000 },
+  { 0x533Au, 0.00000000 },
+  { 0x533Bu, 0.00000000 },
+  { 0x5341u, 0.00250000 },
+  { 0x5343u, 0.00070000 },
+  { 0x5347u, 0.00050000 },
+  { 0x5348u, 0.00010000 },
+  { 0x534Au, 0.00090000 },
+  { 0x534Eu, 0.00000000 },
+  { 0x534Fu, 0.00000000 },
+  { 0x5352u, 0.00000000 },
+  { 0x5353u, 0.00010000 },
+  { 0x5355u, 0.00000000 },
+  { 0x5356u, 0.00000000 },
+  { 0x5357u, 0.00390000 },
+  { 0x535Au, 0.00050000 },
+  { 0x5360u, 0.00010000 },
+  { 0x5361u, 0.00070000 },
+  { 0x5362u, 0.00000000 },
+  { 0x536Bu, 0.00000000 },
+  { 0x536Fu, 0.00000000 },
+  { 0x5370u, 0.00080000 },
+  { 0x5371u, 0.00020000 },
+  { 0x5373u, 0.00190000 },
+  { 0x5374u, 0.00000000 },
+  { 0x5377u, 0.00010000 },
+  { 0x5382u, 0.00000000 },
+  { 0x5384u, 0.00000000 },
+  { 0x5385u, 0.00000000 },
+  { 0x5386u, 0.00000000 },
+  { 0x5389u, 0.00000000 },
+  { 0x538Bu, 0.00000000 },
+  { 0x538Cu, 0.00000000 },
+  { 0x538Du, 0.00000000 },
+  { 0x539Au, 0.00010000 },
+  { 0x539Fu, 0.00230000 },
+  { 0x53BBu, 0.00280000 },
+  { 0x53BFu, 0.00000000 },
+  { 0x53C2u, 0.00000000 },
+  { 0x53C8u, 0.00260000 },
+  { 0x53C9u, 0.00010000 },
+  { 0x53CAu, 0.00200000 },
+  { 0x53CBu, 0.00050000 },
+  { 0x53CCu, 0.00000000 },
+  { 0x53CDu, 0.00090000 },
+  { 0x53D1u, 0.00000000 },
+  { 0x53D4u, 0.00010000 },
+  { 0x53D6u, 0.00070000 },
+  { 0x53D7u, 0.00120000 },
+  { 0x53D8u, 0.00000000 },
+  { 0x53D9u, 0.00000000 },
+  { 0x53E3u, 0.00210000 },
+  { 0x53E4u, 0.00130000 },
+  { 0x53E5u, 0.00020000 },
+  { 0x53E6u, 0.00110000 },
+  { 0x53EAu, 0.00120000 },
+  { 0x53EBu, 0.00380000 },
+  { 0x53ECu, 0.00010000 },
+  { 0x53EDu, 0.00000000 },
+  { 0x53EFu, 0.00460000 },
+  { 0x53F0u, 0.00280000 },
+  { 0x53F2u, 0.00110000 },
+  { 0x53F3u, 0.00040000 },
+  { 0x53F6u, 0.00000000 },
+  { 0x53F7u, 0.00000000 },
+  { 0x53F8u, 0.00230000 },
+  { 0x53F9u, 0.00000000 },
+  { 0x5403u, 0.00000000 },
+  { 0x5404u, 0.00110000 },
+  { 0x5408u, 0.00240000 },
+  { 0x5409u, 0.00030000 },
+  { 0x540Au, 0.00010000 },
+  { 0x540Cu, 0.01910000 },
+  { 0x540Du, 0.00450000 },
+  { 0x540Eu, 0.00030000 },
+  { 0x5410u, 0.00010000 },
+  { 0x5411u, 0.00140000 },
+  { 0x5413u, 0.00010000 },
+  { 0x5417u, 0.00000000 },
+  { 0x541Bu, 0.00030000 },
+  { 0x541Du, 0.00000000 },
+  { 0x541Fu, 0.00000000 },
+  { 0x5426u, 0.00010000 },
+  { 0x5427u, 0.00000000 },
+  { 0x542Bu, 0.00030000 },
+  { 0x542Cu, 0.00000000 },
+  { 0x542Fu, 0.00000000 },
+  { 0x5435u, 0.00000000 },
+  { 0x5438u, 0.00030000 },
+  { 0x5439u, 0.00010000 },
+  { 0x543Bu, 0.00000000 },
+  { 0x543Eu, 0.00000000 },
+  { 0x5440u, 0.00000000 },
+  { 0x5446u, 0.00000000 },
+  { 0x5448u, 0.00010000 },
+  { 0x544Au, 0.00050000 },
+  { 0x5450u, 0.00000000 },
+  { 0x5458u, 0.00000000 },
+  { 0x545Cu, 0.00000000 },
+  { 0x5462u, 0.00450000 },
+  { 0x5466u, 0.00000000 },
+  { 0x5468u, 0.00070000 },
+  { 0x5473u, 0.00020000 },
+  { 0x5475u, 0.00000000 },
+  { 0x547Cu, 0.00020000 },
+  { 0x547Du, 0.00080000 },
+  { 0x548Cu, 0.00140000 },
+  { 0x5496u, 0.00010000 },
+  { 0x54A6u, 0.00000000 },
+  { 0x54A7u, 0.00000000 },
+  { 0x54A8u, 0.00000000 },
+  { 0x54AAu, 0.00010000 },
+  { 0x54ACu, 0.00000000 },
+  { 0x54AFu, 0.00000000 },
+  { 0x54B1u, 0.00000000 },
+  { 0x54C0u, 0.00000000 },
+  { 0x54C1u, 0.00110000 },
+  { 0x54C7u, 0.00000000 },
+  { 0x54C8u, 0.00030000 },
+  { 0x54C9u, 0.00000000 },
+  { 0x54CDu, 0.00010000 },
+  { 0x54CEu, 0.00000000 },
+  { 0x54DFu, 0.00000000 },
+  { 0x54E5u, 0.00040000 },
+  { 0x54E6u, 0.00000000 },
+  { 0x54E9u, 0.00010000 },
+  { 0x54EAu, 0.00000000 },
+  { 0x54EDu, 0.00000000 },
+  { 0x54F2u, 0.00020000 },
+  { 0x5509u, 0.00000000 },
+  { 0x5510u, 0.00060000 },
+  { 0x5524u, 0.00000000 },
+  { 0x552Cu, 0.00000000 },
+  { 0x552Eu, 0.00020000 },
+  { 0x552Fu, 0.00030000 },
+  { 0x5531u, 0.00090000 },
+  { 0x5537u, 0.00000000 },
+  { 0x5546u, 0.00130000 },
+  { 0x554Au, 0.00000000 },
+  { 0x5561u, 0.00010000 },
+  { 0x5565u, 0.00000000 },
+  { 0x5566u, 0.00010000 },
+  { 0x556Au, 0.00000000 },
+  { 0x5580u, 0.00000000 },
+  { 0x5582u, 0.00000000 },
+  { 0x5584u, 0.00030000 },
+  { 0x5587u, 0.00010000 },
+  { 0x558Au, 0.00000000 },
+  { 0x558Fu, 0.00000000 },
+  { 0x5594u, 0.00000000 },
+  { 0x559Cu, 0.00010000 },
+  { 0x559Du, 0.00000000 },
+  { 0x55B5u, 0.00000000 },
+  { 0x55B7u, 0.00000000 },
+  { 0x55BBu, 0.00000000 },
+  { 0x55D2u, 0.00000000 },
+  { 0x55E8u, 0.00000000 },
+  { 0x55EFu, 0.00000000 },
+  { 0x5609u, 0.00040000 },
+  { 0x561Bu, 0.00000000 },
+  { 0x5634u, 0.00020000 },
+  { 0x563Bu, 0.00000000 },
+  { 0x563Fu, 0.00000000 },
+  { 0x5668u, 0.00080000 },
+  { 0x56DBu, 0.00200000 },
+  { 0x56DEu, 0.00050000 },
+  { 0x56E0u, 0.00310000 },
+  { 0x56E2u, 0.00000000 },
+  { 0x56EDu, 0.00000000 },
+  { 0x56F0u, 0.00010000 },
+  { 0x56F4u, 0.00000000 },
+  { 0x56FAu, 0.00020000 },
+  { 0x56FDu, 0.00000000 },
+  { 0x56FEu, 0.00000000 },
+  { 0x5706u, 0.00000000 },
+  { 0x5708u, 0.00020000 },
+  { 0x571Fu, 0.00070000 },
+  { 0x5723u, 0.00000000 },
+  { 0x5728u, 0.00100000 },
+  { 0x572Du, 0.00000000 },
+  { 0x5730u, 0.00720000 },
+  { 0x5733u, 0.00020000 },
+  { 0x573Au, 0.00000000 },
+  { 0x573Eu, 0.00000000 },
+  { 0x5740u, 0.00020000 },
+  { 0x5747u, 0.00030000 },
+  { 0x574Eu, 0.00010000 },
+  { 0x5750u, 0.00020000 },
+  { 0x5751u, 0.00020000 },
+  { 0x5757u, 0.00000000 },
+  { 0x575Au, 0.00000000 },
+  { 0x575Bu, 0.00000000 },
+  { 0x575Cu, 0.00000000 },
+  { 0x5761u, 0.00030000 },
+  { 0x5764u, 0.00000000 },
+  { 0x5766u, 0.00030000 },
+  { 0x576Au, 0.00010000 },
+  { 0x5782u, 0.00000000 },
+  { 0x5783u, 0.00000000 },
+  { 0x578Bu, 0.00120000 },
+  { 0x5792u, 0.00000000 },
+  { 0x57C3u, 0.00010000 },
+  { 0x57CBu, 0.00490000 },
+  { 0x57CEu, 0.00210000 },
+  { 0x57D4u, 0.00040000 },
+  { 0x57DFu, 0.00060000 },
+  { 0x57F9u, 0.00020000 },
+  { 0x57FAu, 0.00190000 },
+  { 0x5802u, 0.00070000 },
+  { 0x5806u, 0.00010000 },
+  { 0x5815u, 0.00000000 },
+  { 0x5821u, 0.00020000 },
+  { 0x582Au, 0.00000000 },
+  { 0x5851u, 0.00010000 },
+  { 0x5854u, 0.00030000 },
+  { 0x585Eu, 0.00030000 },
+  { 0x586Bu, 0.00030000 },
+  { 0x5883u, 0.00060000 },
+  { 0x589Eu, 0.00050000 },
+  { 0x58A8u, 0.00020000 },
+  { 0x58C1u, 0.00010000 },
+  { 0x58E4u, 0.00000000 },
+  { 0x58EBu, 0.00350000 },
+  { 0x58ECu, 0.00000000 },
+  { 0x58EEu, 0.00000000 },
+  { 0x58F0u, 0.00000000 },
+  { 0x5904u, 0.00000000 },
+  { 0x5907u, 0.00000000 },
+  { 0x590Du, 0.00000000 },
+  { 0x590Fu, 0.00040000 },
+  { 0x5915u, 0.00010000 },
+  { 0x5916u, 0.00270000 },
+  { 0x591Au, 0.00490000 },
+  { 0x591Cu, 0.00040000 },
+  { 0x591Fu, 0.00000000 },
+  { 0x5925u, 0.00000000 },
+  { 0x5927u, 0.01240000 },
+  { 0x5929u, 0.00230000 },
+  { 0x592Au, 0.00130000 },
+  { 0x592Bu, 0.00050000 },
+  { 0x592Eu, 0.00040000 },
+  { 0x5931u, 0.00040000 },
+  { 0x5934u, 0.00000000 },
+  { 0x5937u, 0.00010000 },
+  { 0x5938u, 0.00000000 },
+  { 0x5939u, 0.00000000 },
+  { 0x593Au, 0.00000000 },
+  { 0x5947u, 0.00030000 },
+  { 0x5948u, 0.00010000 },
+  { 0x5949u, 0.00010000 },
+  { 0x594Bu, 0.00000000 },
+  { 0x594Fu, 0.00010000 },
+  { 0x5951u, 0.00010000 },
+  { 0x5954u, 0.00000000 },
+  { 0x5956u, 0.00000000 },
+  { 0x5957u, 0.00050000 },
+  { 0x5965u, 0.00000000 },
+  { 0x5973u, 0.00140000 },
+  { 0x5974u, 0.00010000 },
+  { 0x5976u, 0.00020000 },
+  { 0x5979u, 0.00000000 },
+  { 0x597Du, 0.00500000 },
+  { 0x5982u, 0.00170000 },
+  { 0x5987u, 0.00000000 },
+  { 0x5988u, 0.00000000 },
+  { 0x5996u, 0.00000000 },
+  { 0x5999u, 0.00000000 },
+  { 0x59A5u, 0.00000000 },
+  { 0x59A8u, 0.00000000 },
+  { 0x59AEu, 0.00000000 },
+  { 0x59B9u, 0.00010000 },
+  { 0x59BBu, 0.00000000 },
+  { 0x59C6u, 0.00010000 },
+  { 0x59CAu, 0.00000000 },
+  { 0x59CBu, 0.00180000 },
+  { 0x59D0u, 0.00020000 },
+  { 0x59D1u, 0.00000000 },
+  { 0x59D3u, 0.00010000 },
+  { 0x59D4u, 0.00080000 },
+  { 0x59FFu, 0.00000000 },
+  { 0x5A01u, 0.00060000 },
+  { 0x5A03u, 0.00010000 },
+  { 0x5A04u, 0.00000000 },
+  { 0x5A18u, 0.00010000 },
+  { 0x5A1Cu, 0.00010000 },
+  { 0x5A1Fu, 0.00000000 },
+  { 0x5A31u, 0.00000000 },
+  { 0x5A46u, 0.00020000 },
+  { 0x5A5Au, 0.00030000 },
+  { 0x5A92u, 0.00030000 },
+  { 0x5AC1u, 0.00000000 },
+  { 0x5ACCu, 0.00000000 },
+  { 0x5AE9u, 0.00000000 },
+  { 0x5B50u, 0.00240000 },
+  { 0x5B54u, 0.00010000 },
+  { 0x5B55u, 0.00000000 },
+  { 0x5B57u, 0.00620000 },
+  { 0x5B58u, 0.00050000 },
+  { 0x5B59u, 0.00000000 },
+  { 0x5B5Cu, 0.00000000 },
+  { 0x5B5Du, 0.00000000 },
+  { 0x5B5Fu, 0.00010000 },
+  { 0x5B63u, 0.00050000 },
+  { 0x5B64u, 0.00010000 },
+  { 0x5B66u, 0.00000000 },
+  { 0x5B69u, 0.00000000 },
+  { 0x5B81u, 0.00000000 },
+  { 0x5B83u, 0.00010000 },
+  { 0x5B87u, 0.00020000 },
+  { 0x5B88u, 0.00030000 },
+  { 0x5B89u, 0.00140000 },
+  { 0x5B8Bu, 0.00030000 },
+  { 0x5B8Cu, 0.00070000 },
+  { 0x5B8Fu, 0.00000000 },
+  { 0x5B97u, 0.00060000 },
+  { 0x5B98u, 0.00110000 },
+  { 0x5B99u, 0.00010000 },
+  { 0x5B9Au, 0.00230000 },
+  { 0x5B9Bu, 0.00000000 },
+  { 0x5B9Cu, 0.00010000 },
+  { 0x5B9Du, 0.00000000 },
+  { 0x5B9Eu, 0.00000000 },
+  { 0x5BA1u, 0.00000000 },
+  { 0x5BA2u, 0.00120000 },
+  { 0x5BA3u, 0.00060000 },
+  { 0x5BA4u, 0.00060000 },
+  { 0x5BAAu, 0.00000000 },
+  { 0x5BB3u, 0.00010000 },
+  { 0x5BB4u, 0.00000000 },
+  { 0x5BB6u, 0.00530000 },
+  { 0x5BB9u, 0.00070000 },
+  { 0x5BBDu, 0.00000000 },
+  { 0x5BBEu, 0.00000000 },
+  { 0x5BBFu, 0.00020000 },
+  { 0x5BC2u, 0.00000000 },
+  { 0x5BC4u, 0.00010000 },
+  { 0x5BC5u, 0.00000000 },
+  { 0x5BC6u, 0.00050000 },
+  { 0x5BC7u, 0.00000000 },
+  { 0x5BCCu, 0.00060000 },
+  { 0x5BD2u, 0.00000000 },
+  { 0x5BDDu, 0.00000000 },
+  { 0x5BDEu, 0.00000000 },
+  { 0x5BDFu, 0.00030000 },
+  { 0x5BE1u, 0.00000000 },
+  { 0x5BE8u, 0.00010000 },
+  { 0x5BF8u, 0.00000000 },
+  { 0x5BF9u, 0.00000000 },
+  { 0x5BFBu, 0.00000000 },
+  { 0x5BFCu, 0.00000000 },
+  { 0x5BFFu, 0.00000000 },
+  { 0x5C01u, 0.00040000 },
+  { 0x5C04u, 0.00040000 },
+  { 0x5C06u, 0.00000000 },
+  { 0x5C0Au, 0.00010000 },
+  { 0x5C0Fu, 0.00210000 },
+  { 0x5C11u, 0.00160000 },
+  { 0x5C14u, 0.00000000 },
+  { 0x5C16u, 0.00030000 },
+  { 0x5C18u, 0.00000000 },
+  { 0x5C1Au, 0.00010000 },
+  { 0x5C1Du, 0.00000000 },
+  { 0x5C24u, 0.00020000 },
+  { 0x5C31u, 0.00570000 },
+  { 0x5C3Au, 0.00020000 },
+  { 0x5C3Cu, 0.00120000 },
+  { 0x5C3Du, 0.00000000 },
+  { 0x5C3Eu, 0.00090000 },
+  { 0x5C40u, 0.00090000 },
+  { 0x5C41u, 0.00000000 },
+  { 0x5C42u, 0.00000000 },
+  { 0x5C45u, 0.00080000 },
+  { 0x5C4Bu, 0.00100000 },
+  { 0x5C4Fu, 0.00010000 },
+  { 0x5C55u, 0.00150000 },
+  { 0x5C5Eu, 0.00000000 },
+  { 0x5C60u, 0.00010000 },
+  { 0x5C71u, 0.00310000 },
+  { 0x5C81u, 0.00000000 },
+  { 0x5C82u, 0.00000000 },
+  { 0x5C97u, 0.00000000 },
+  { 0x5C98u, 0.00000000 },
+  { 0x5C9Au, 0.00000000 },
+  { 0x5C9Bu, 0.00000000 },
+  { 0x5CB3u, 0.00000000 },
+  { 0x5CB8u, 0.00050000 },
+  { 0x5CE1u, 0.00000000 },
+  { 0x5CF0u, 0.00020000 },
+  { 0x5D07u, 0.00010000 },
+  { 0x5D29u, 0.00000000 },
+  { 0x5D34u, 0.00000000 },
+  { 0x5DDDu, 0.00030000 },
+  { 0x5DDEu, 0.00180000 },
+  { 0x5DE1u, 0.00010000 },
+  { 0x5DE5u, 0.00210000 },
+  { 0x5DE6u, 0.00050000 },
+  { 0x5DE7u, 0.00010000 },
+  { 0x5DE8u, 0.00020000 },
+  { 0x5DEBu, 0.00000000 },
+  { 0x5DEEu, 0.00050000 },
+  { 0x5DF1u, 0.00080000 },
+  { 0x5DF2u, 0.00150000 },
+  { 0x5DF3u, 0.00000000 },
+  { 0x5DF4u, 0.00300000 },
+  { 0x5DF7u, 0.00000000 },
+  { 0x5E01u, 0.00000000 },
+  { 0x5E02u, 0.00330000 },
+  { 0x5E03u, 0.00080000 },
+  { 0x5E05u, 0.00000000 },
+  { 0x5E08u, 0.00000000 },
+  { 0x5E0Cu, 0.00060000 },
+  { 0x5E10u, 0.00000000 },
+  { 0x5E15u, 0.00010000 },
+  { 0x5E16u, 0.00000000 },
+  { 0x5E1Du, 0.00090000 },
+  { 0x5E26u, 0.00000000 },
+  { 0x5E2Du, 0.00070000 },
+  { 0x5E2Eu, 0.00000000 },
+  { 0x5E38u, 0.00150000 },
+  { 0x5E3Du, 0.00010000 },
+  { 0x5E45u, 0.00010000 },
+  { 0x5E55u, 0.00030000 },
+  { 0x5E72u, 0.00010000 },
+  { 0x5E73u, 0.00230000 },
+  { 0x5E74u, 0.02040000 },
+  { 0x5E76u, 0.00000000 },
+  { 0x5E78u, 0.00000000 },
+  { 0x5E7Bu, 0.00010000 },
+  { 0x5E7Cu, 0.00010000 },
+  { 0x5E7Du, 0.00000000 },
+  { 0x5E7Fu, 0.00000000 },
+  { 0x5E86u, 0.00000000 },
+  { 0x5E8Au, 0.00000000 },
+  { 0x5E8Fu, 0.00030000 },
+  { 0x5E93u, 0.00000000 },
+  { 0x5E94u, 0.00000000 },
+  { 0x5E95u, 0.00070000 },
+  { 0x5E97u, 0.00040000 },
+  { 0x5E99u, 0.00000000 },
+  { 0x5E9Au, 0.00000000 },
+  { 0x5E9Cu, 0.00220000 },
+  { 0x5E9Eu, 0.00000000 },
+  { 0x5E9Fu, 0.00000000 },
+  { 0x5EA6u, 0.00320000 },
+  { 0x5EA7u, 0.00100000 },
+  { 0x5EADu, 0.00020000 },
+  { 0x5EB7u, 0.00060000 },
+  { 0x5EB8u, 0.00000000 },
+  { 0x5EC9u, 0.00010000 },
+  { 0x5ED6u, 0.00000000 },
+  { 0x5EF6u, 0.00020000 },
+  { 0x5EF7u, 0.00020000 },
+  { 0x5EFAu, 0.00190000 },
+  { 0x5F00u, 0.00000000 },
+  { 0x5F02u, 0.00000000 },
+  { 0x5F03u, 0.00000000 },
+  { 0x5F04u, 0.00000000 },
+  { 0x5F0Au, 0.00000000 },
+  { 0x5F0Fu, 0.00200000 },
+  { 0x5F15u, 0.00100000 },
+  { 0x5F17u, 0.00000000 },
+  { 0x5F18u, 0.00000000 },
+  { 0x5F1Fu, 0.00020000 },
+  { 0x5F20u, 0.00000000 },
+  { 0x5F25u, 0.00000000 },
+  { 0x5F26u, 0.00010000 },
+  { 0x5F2Fu, 0.00000000 },
+  { 0x5F31u, 0.00010000 },
+  { 0x5F39u, 0.00000000 },
+  { 0x5F3Au, 0.00000000 },
+  { 0x5F52u, 0.00000000 },
+  { 0x5F53u, 0.00000000 },
+  { 0x5F55u, 0.00000000 },
+  { 0x5F5Du, 0.00000000 },
+  { 0x5F62u, 0.00130000 },
+  { 0x5F69u, 0.00020000 },
+  { 0x5F6Cu, 0.00000000 },
+  { 0x5F6Du, 0.00010000 },
+  { 0x5F70u, 0.00000000 },
+  { 0x5F71u, 0.00170000 },
+  { 0x5F77u, 0.00000000 },
+  { 0x5F79u, 0.00020000 },
+  { 0x5F7Bu, 0.00000000 },
+  { 0x5F7Cu, 0.00000000 },
+  { 0x5F80u, 0.00060000 },
+  { 0x5F81u, 0.00010000 },
+  { 0x5F84u, 0.00000000 },
+  { 0x5F85u, 0.00010000 },
+  { 0x5F88u, 0.00000000 },
+  { 0x5F8Bu, 0.00060000 },
+  { 0x5F8Cu, 0.00660000 },
+  { 0x5F90u, 0.00010000 },
+  { 0x5F92u, 0.00020000 },
+  { 0x5F97u, 0.00250000 },
+  { 0x5FAAu, 0.00010000 },
+  { 0x5FAEu, 0.00030000 },
+  { 0x5FB5u, 0.00020000 },
+  { 0x5FB7u, 0.00170000 },
+  { 0x5FC3u, 0.00180000 },
+  { 0x5FC5u, 0.00020000 },
+  { 0x5FC6u, 0.00000000 },
+  { 0x5FCCu, 0.00000000 },
+  { 0x5FCDu, 0.00000000 },
+  { 0x5FD7u, 0.00040000 },
+  { 0x5FD8u, 0.00000000 },
+  { 0x5FD9u, 0.00010000 },
+  { 0x5FE0u, 0.00010000 },
+  { 0x5FE7u, 0.00000000 },
+  { 0x5FEBu, 0.00060000 },
+  { 0x5FF5u, 0.00050000 },
+  { 0x5FFDu, 0.00000000 },
+  { 0x6000u, 0.00000000 },
+  { 0x6001u, 0.00000000 },
+  { 0x600Eu, 0.00000000 },
+  { 0x6012u, 0.00000000 },
+  { 0x6015u, 0.00000000 },
+  { 0x6016u, 0.00000000 },
+  { 0x601Du, 0.00070000 },
+  { 0x6021u, 0.00010000 },
+  { 0x6025u, 0.00020000 },
+  { 0x6027u, 0.00140000 },
+  { 0x6028u, 0.00000000 },
+  { 0x602Au, 0.00010000 },
+  { 0x603Bu, 0.00000000 },
+  { 0x604Bu, 0.00000000 },
+  { 0x6050u, 0.00010000 },
+  { 0x6062u, 0.00010000 },
+  { 0x6068u, 0.00000000 },
+  { 0x6069u, 0.00020000 },
+  { 0x606Du, 0.00000000 },
+  { 0x606Fu, 0.00030000 },
+  { 0x6070u, 0.00000000 },
+  { 0x6076u, 0.00000000 },
+  { 0x607Cu, 0.00000000 },
+  { 0x6084u, 0.00000000 },
+  { 0x6089u, 0.00010000 },
+  { 0x6094u, 0.00000000 },
+  { 0x609Fu, 0.00000000 },
+  { 0x60A0u, 0.00000000 },
+  { 0x60A3u, 0.00010000 },
+  { 0x60A8u, 0.00000000 },
+  { 0x60B2u, 0.00000000 },
+  { 0x60C5u, 0.00080000 },
+  { 0x60D1u, 0.00000000 },
+  { 0x60DCu, 0.00000000 },
+  { 0x60E0u, 0.00020000 },
+  { 0x60E7u, 0.00000000 },
+  { 0x60E8u, 0.00000000 },
+  { 0x60EFu, 0.00000000 },
+  { 0x60F3u, 0.00060000 },
+  { 0x60F9u, 0.00000000 },
+  { 0x6101u, 0.00000000 },
+  { 0x6108u, 0.00000000 },
+  { 0x6109u, 0.00000000 },
+  { 0x610Fu, 0.00190000 },
+  { 0x611Au, 0.00000000 },
+  { 0x611Fu, 0.00040000 },
+  { 0x6127u, 0.00000000 },
+  { 0x6148u, 0.00010000 },
+  { 0x614Eu, 0.00000000 },
+  { 0x6155u, 0.00010000 },
+  { 0x6162u, 0.00030000 },
+  { 0x6167u, 0.00010000 },
+  { 0x6170u, 0.00000000 },
+  { 0x61BEu, 0.00000000 },
+  { 0x61C2u, 0.00000000 },
+  { 0x61D2u, 0.00000000 },
+  { 0x6208u, 0.00000000 },
+  { 0x620Au, 0.00000000 },
+  { 0x620Cu, 0.00000000 },
+  { 0x620Fu, 0.00000000 },
+  { 0x6210u, 0.00710000 },
+  { 0x6211u, 0.00040000 },
+  { 0x6212u, 0.00010000 },
+  { 0x6216u, 0.00270000 },
+  { 0x6218u, 0.00000000 },
+  { 0x622Au, 0.00010000 },
+  { 0x6234u, 0.00010000 },
+  { 0x6237u, 0.00000000 },
+  { 0x623Fu, 0.00050000 },
+  { 0x6240u, 0.00330000 },
+  { 0x6241u, 0.00010000 },
+  { 0x6247u, 0.00000000 },
+  { 0x624Bu, 0.00160000 },
+  { 0x624Du, 0.00010000 },
+  { 0x624Eu, 0.00000000 },
+  { 0x6251u, 0.00000000 },
+  { 0x6253u, 0.00160000 },
+  { 0x6258u, 0.00020000 },
+  { 0x6263u, 0.00000000 },
+  { 0x6267u, 0.00000000 },
+  { 0x6269u, 0.00000000 },
+  { 0x626Bu, 0.00000000 },
+  { 0x626Cu, 0.00000000 },
+  { 0x626Du, 0.00000000 },
+  { 0x626Eu, 0.00010000 },
+  { 0x626Fu, 0.00000000 },
+  { 0x6279u, 0.00040000 },
+  { 0x627Eu, 0.00000000 },
+  { 0x627Fu, 0.00030000 },
+  { 0x6280u, 0.00050000 },
+  { 0x6284u, 0.00000000 },
+  { 0x628Au, 0.00010000 },
+  { 0x6291u, 0.00000000 },
+  { 0x6293u, 0.00000000 },
+  { 0x6295u, 0.00080000 },
+  { 0x6297u, 0.00030000 },
+  { 0x6298u, 0.00010000 },
+  { 0x62A2u, 0.00000000 },
+  { 0x62A4u, 0.00000000 },
+  { 0x62A5u, 0.00000000 },
+  { 0x62ABu, 0.00000000 },
+  { 0x62ACu, 0.00000000 },
+  { 0x62B1u, 0.00000000 },
+  { 0x62B5u, 0.00010000 },
+  { 0x62B9u, 0.00000000 },
+  { 0x62BDu, 0.00010000 },
+  { 0x62C5u, 0.00000000 },
+  { 0x62C6u, 0.00020000 },
+  { 0x62C9u, 0.00300000 },
+  { 0x62CDu, 0.00050000 },
+  { 0x62D2u, 0.00010000 },
+  { 0x62D4u, 0.00010000 },
+  { 0x62D6u, 0.00010000 },
+  { 0x62D8u, 0.00000000 },
+  { 0x62DBu, 0.00020000 },
+  { 0x62DCu, 0.00030000 },
+  { 0x62DFu, 0.00000000 },
+  { 0x62E5u, 0.00000000 },
+  { 0x62E6u, 0.00000000 },
+  { 0x62E8u, 0.00000000 },
+  { 0x62E9u, 0.00000000 },
+  { 0x62ECu, 0.00120000 },
+  { 0x62F3u, 0.00010000 },
+  { 0x62F7u, 0.00000000 },
+  { 0x62FCu, 0.00020000 },
+  { 0x62FEu, 0.00000000 },
+  { 0x62FFu, 0.00060000 },
+  { 0x6301u, 0.00090000 },
+  { 0x6307u, 0.00310000 },
+  { 0x6309u, 0.00020000 },
+  { 0x6311u, 0.00010000 },
+  { 0x6316u, 0.00000000 },
+  { 0x631Du, 0.00000000 },
+  { 0x6321u, 0.00000000 },
+  { 0x6324u, 0.00000000 },
+  { 0x6325u, 0.00000000 },
+  { 0x632Au, 0.00010000 },
+  { 0x632Fu, 0.00010000 },
+  { 0x633Au, 0.00000000 },
+  { 0x6349u, 0.00020000 },
+  { 0x6350u, 0.00010000 },
+  { 0x6355u, 0.00020000 },
+  { 0x635Fu, 0.00000000 },
+  { 0x6361u, 0.00000000 },
+  { 0x6362u, 0.00000000 },
+  { 0x636Eu, 0.00000000 },
+  { 0x6377u, 0.00010000 },
+  { 0x6388u, 0.00020000 },
+  { 0x6389u, 0.00000000 },
+  { 0x638Cu, 0.00010000 },
+  { 0x6392u, 0.00070000 },
+  { 0x63A2u, 0.00010000 },
+  { 0x63A5u, 0.00160000 },
+  { 0x63A7u, 0.00040000 },
+  { 0x63A8u, 0.00090000 },
+  { 0x63A9u, 0.00000000 },
+  { 0x63AAu, 0.00000000 },
+  { 0x63B8u, 0.00000000 },
+  { 0x63CFu, 0.00010000 },
+  { 0x63D0u, 0.00130000 },
+  { 0x63D2u, 0.00010000 },
+  { 0x63E1u, 0.00000000 },
+  { 0x63F4u, 0.00020000 },
+  { 0x641Cu, 0.00010000 },
+  { 0x641Eu, 0.00060000 },
+  { 0x642Cu, 0.00030000 },
+  { 0x642Du, 0.00020000 },
+  { 0x6444u, 0.00000000 },
+  { 0x6446u, 0.00000000 },
+  { 0x644Au, 0.00000000 },
+  { 0x6454u, 0.00010000 },
+  { 0x6458u, 0.00000000 },
+  { 0x6469u, 0.00030000 },
+  { 0x6478u, 0.00000000 },
+  { 0x6492u, 0.00010000 },
+  { 0x649Eu, 0.00010000 },
+  { 0x64ADu, 0.00080000 },
+  { 0x64CDu, 0.00020000 },
+  { 0x64CEu, 0.00030000 },
+  { 0x64E6u, 0.00000000 },
+  { 0x652Fu, 0.00100000 },
+  { 0x6536u, 0.00120000 },
+  { 0x6539u, 0.00180000 },
+  { 0x653Bu, 0.00030000 },
+  { 0x653Eu, 0.00090000 },
+  { 0x653Fu, 0.00400000 },
+  { 0x6545u, 0.00040000 },
+  { 0x6548u, 0.00040000 },
+  { 0x654Cu, 0.00000000 },
+  { 0x654Fu, 0.00010000 },
+  { 0x6551u, 0.00040000 },
+  { 0x6559u, 0.00210000 },
+  { 0x655Du, 0.00000000 },
+  { 0x6562u, 0.00000000 },
+  { 0x6563u, 0.00030000 },
+  { 0x6566u, 0.00040000 },
+  { 0x656Cu, 0.00010000 },
+  { 0x6570u, 0.00000000 },
+  { 0x6572u, 0.00000000 },
+  { 0x6574u, 0.00070000 },
+  { 0x6587u, 0.00570000 },
+  { 0x658Bu, 0.00000000 },
+  { 0x6590u, 0.00000000 },
+  { 0x6597u, 0.00010000 },
+  { 0x6599u, 0.00050000 },
+  { 0x659Cu, 0.00010000 },
+  { 0x65A5u, 0.00000000 },
+  { 0x65ADu, 0.00000000 },
+  { 0x65AFu, 0.00200000 },
+  { 0x65B0u, 0.00390000 },
+  { 0x65B9u, 0.00430000 },
+  { 0x65BCu, 0.00370000 },
+  { 0x65BDu, 0.00040000 },
+  { 0x65C1u, 0.00010000 },
+  { 0x65C5u, 0.00040000 },
+  { 0x65CBu, 0.00020000 },
+  { 0x65CFu, 0.00090000 },
+  { 0x65D7u, 0.00030000 },
+  { 0x65E0u, 0.00000000 },
+  { 0x65E2u, 0.00010000 },
+  { 0x65E5u, 0.00510000 },
+  { 0x65E6u, 0.00010000 },
+  { 0x65E7u, 0.00000000 },
+  { 0x65E8u, 0.00000000 },
+  { 0x65E9u, 0.00090000 },
+  { 0x65EDu, 0.00000000 },
+  { 0x65F6u, 0.00000000 },
+  { 0x65FAu, 0.00020000 },
+  { 0x6602u, 0.00010000 },
+  { 0x6606u, 0.00010000 },
+  { 0x660Cu, 0.00020000 },
+  { 0x660Eu, 0.00180000 },
+  { 0x660Fu, 0.00000000 },
+  { 0x6613u, 0.00060000 },
+  { 0x661Fu, 0.00200000 },
+  { 0x6620u, 0.00020000 },
+  { 0x6625u, 0.00030000 },
+  { 0x6628u, 0.00000000 },
+  { 0x662Du, 0.00010000 },
+  { 0x662Fu, 0.00070000 },
+  { 0x663Eu, 0.00000000 },
+  { 0x6643u, 0.00000000 },
+  { 0x664Bu, 0.00000000 },
+  { 0x6652u, 0.00040000 },
+  { 0x6653u, 0.00000000 },
+  { 0x665Au, 0.00040000 },
+  { 0x6668u, 0.00010000 },
+  { 0x666Eu, 0.00070000 },
+  { 0x666Fu, 0.00050000 },
+  { 0x6674u, 0.00000000 },
+  { 0x6676u, 0.00010000 },
+  { 0x667Au, 0.00020000 },
+  { 0x6682u, 0.00000000 },
+  { 0x6691u, 0.00000000 },
+  { 0x6696u, 0.00000000 },
+  { 0x6697u, 0.00010000 },
+  { 0x66AEu, 0.00000000 },
+  { 0x66B4u, 0.00030000 },
+  { 0x66F0u, 0.00000000 },
+  { 0x66F2u, 0.00090000 },
+  { 0x66F4u, 0.00090000 },
+  { 0x66F9u, 0.00010000 },
+  { 0x66FCu, 0.00040000 },
+  { 0x66FEu, 0.00110000 },
+  { 0x66FFu, 0.00020000 },
+  { 0x6700u, 0.00410000 },
+  { 0x6708u, 0.00690000 },
+  { 0x6709u, 0.01530000 },
+  { 0x670Bu, 0.00020000 },
+  { 0x670Du, 0.00110000 },
+  { 0x6717u, 0.00040000 },
+  { 0x671Bu, 0.00040000 },
+  { 0x671Du, 0.00100000 },
+  { 0x671Fu, 0.00260000 },
+  { 0x6728u, 0.00040000 },
+  { 0x672Au, 0.00080000 },
+  { 0x672Bu, 0.00020000 },
+  { 0x672Cu, 0.00400000 },
+  { 0x672Du, 0.00000000 },
+  { 0x672Fu, 0.00000000 },
+  { 0x6731u, 0.00020000 },
+  { 0x6735u, 0.00000000 },
+  { 0x673Au, 0.00000000 },
+  { 0x6740u, 0.00000000 },
+  { 0x6742u, 0.00000000 },
+  { 0x6743u, 0.00000000 },
+  { 0x6749u, 0.00010000 },
+  { 0x674Eu, 0.00090000 },
+  { 0x6750u, 0.00020000 },
+  { 0x6751u, 0.00080000 },
+  { 0x675Cu, 0.00020000 },
+  { 0x675Fu, 0.00020000 },
+  { 0x6761u, 0.00000000 },
+  { 0x6765u, 0.00000000 },
+  { 0x6768u, 0.00000000 },
+  { 0x676Fu, 0.00010000 },
+  { 0x6770u, 0.00000000 },
+  { 0x677Eu, 0.00020000 },
+  { 0x677Fu, 0.00020000 },
+  { 0x6781u, 0.00000000 },
+  { 0x6784u, 0.00000000 },
+  { 0x6790u, 0.00010000 },
+  { 0x6797u, 0.00120000 },
+  { 0x679Cu, 0.00120000 },
+  { 0x679Du, 0.00010000 },
+  { 0x67A2u, 0.00000000 },
+  { 0x67AAu, 0.00000000 },
+  { 0x67ABu, 0.00000000 },
+  { 0x67B6u, 0.00110000 },
+  { 0x67CFu, 0.00020000 },
+  { 0x67D0u, 0.00020000 },
+  { 0x67D3u, 0.00010000 },
+  { 0x67D4u, 0.00010000 },
+  { 0x67E5u, 0.00040000 },
+  { 0x67ECu, 0.00000000 },
+  { 0x67EFu, 0.00010000 },
+  { 0x67F3u, 0.00000000 },
+  { 0x67F4u, 0.00020000 },
+  { 0x6807u, 0.00000000 },
+  { 0x680Bu, 0.00000000 },
+  { 0x680Fu, 0.00000000 },
+  { 0x6811u, 0.00000000 },
+  { 0x6821u, 0.00100000 },
+  { 0x6837u, 0.00000000 },
+  { 0x6838u, 0.00030000 },
+  { 0x6839u, 0.00070000 },
+  { 0x683Cu, 0.00120000 },
+  { 0x6843u, 0.00010000 },
+  { 0x6846u, 0.00000000 },
+  { 0x6848u, 0.00060000 },
+  { 0x684Cu, 0.00000000 },
+  { 0x6851u, 0.00010000 },
+  { 0x6863u, 0.00000000 },
+  { 0x6865u, 0.00000000 },
+  { 0x6881u, 0.00030000 },
+  { 0x6885u, 0.00020000 },
+  { 0x68A6u, 0.00000000 },
+  { 0x68AFu, 0.00010000 },
+  { 0x68B0u, 0.00010000 },
+  { 0x68B5u, 0.00010000 },
+  { 0x68C0u, 0.00000000 },
+  { 0x68C9u, 0.00000000 },
+  { 0x68CBu, 0.00010000 },
+  { 0x68D2u, 0.00010000 },
+  { 0x68DAu, 0.00000000 },
+  { 0x68EEu, 0.00030000 },
+  { 0x6905u, 0.00010000 },
+  { 0x690Du, 0.00030000 },
+  { 0x6930u, 0.00000000 },
+  { 0x695Au, 0.00020000 },
+  { 0x697Cu, 0.00000000 },
+  { 0x6982u, 0.00050000 },
+  { 0x699Cu, 0.00010000 },
+  { 0x6A21u, 0.00050000 },
+  { 0x6A31u, 0.00000000 },
+  { 0x6A80u, 0.00000000 },
+  { 0x6B20u, 0.00000000 },
+  { 0x6B21u, 0.00200000 },
+  { 0x6B22u, 0.00000000 },
+  { 0x6B23u, 0.00010000 },
+  { 0x6B27u, 0.00000000 },
+  { 0x6B32u, 0.00000000 },
+  { 0x6B3Au, 0.00000000 },
+  { 0x6B3Eu, 0.00040000 },
+  { 0x6B49u, 0.00000000 },
+  { 0x6B4Cu, 0.00140000 },
+  { 0x6B62u, 0.00050000 },
+  { 0x6B63u, 0.00170000 },
+  { 0x6B64u, 0.00100000 },
+  { 0x6B65u, 0.00040000 },
+  { 0x6B66u, 0.00060000 },
+  { 0x6B6Au, 0.00000000 },
+  { 0x6B7Bu, 0.00100000 },
+  { 0x6B8Au, 0.00010000 },
+  { 0x6B8Bu, 0.00000000 },
+  { 0x6BB5u, 0.00070000 },
+  { 0x6BC5u, 0.00000000 },
+  { 0x6BCDu, 0.00200000 },
+  { 0x6BCFu, 0.00110000 },
+  { 0x6BD2u, 0.00020000 },
+  { 0x6BD4u, 0.00180000 },
+  { 0x6BD5u, 0.00000000 },
+  { 0x6BDBu, 0.00040000 },
+  { 0x6BEBu, 0.00020000 },
+  { 0x6C0Fu, 0.00040000 },
+  { 0x6C11u, 0.00390000 },
+  { 0x6C14u, 0.00000000 },
+  { 0x6C1Bu, 0.00000000 },
+  { 0x6C34u, 0.00260000 },
+  { 0x6C38u, 0.00030000 },
+  { 0x6C42u, 0.00050000 },
+  { 0x6C47u, 0.00000000 },
+  { 0x6C49u, 0.00000000 },
+  { 0x6C57u, 0.00010000 },
+  { 0x6C5Du, 0.00000000 },
+  { 0x6C5Fu, 0.00110000 },
+  { 0x6C60u, 0.00020000 },
+  { 0x6C61u, 0.00010000 },
+  { 0x6C64u, 0.00000000 },
+  { 0x6C6Au, 0.00010000 },
+  { 0x6C76u, 0.00010000 },
+  { 0x6C7Du, 0.00020000 },
+  { 0x6C83u, 0.00010000 },
+  { 0x6C88u, 0.00000000 },
+  { 0x6C89u, 0.00010000 },
+  { 0x6C99u, 0.00120000 },
+  { 0x6C9Fu, 0.00000000 },
+  { 0x6CA1u, 0.00000000 },
+  { 0x6CA7u, 0.00000000 },
+  { 0x6CB3u, 0.00100000 },
+  { 0x6CB9u, 0.00050000 },
+  { 0x6CBBu, 0.00140000 },
+  { 0x6CBFu, 0.00020000 },
+  { 0x6CC9u, 0.00010000 },
+  { 0x6CCAu, 0.00010000 },
+  { 0x6CD5u, 0.00370000 },
+  { 0x6CDBu, 0.00020000 },
+  { 0x6CE1u, 0.00000000 },
+  { 0x6CE2u, 0.00090000 },
+  { 0x6CE3u, 0.00000000 },
+  { 0x6CE5u, 0.00020000 },
+  { 0x6CE8u, 0.00030000 },
+  { 0x6CF0u, 0.00060000 },
+  { 0x6CF3u, 0.00010000 },
+  { 0x6CFDu, 0.00000000 },
+  { 0x6D0Bu, 0.00080000 },
+  { 0x6D17u, 0.00010000 },
+  { 0x6D1Bu, 0.00030000 },
+  { 0x6D1Eu, 0.00010000 },
+  { 0x6D25u, 0.00020000 },
+  { 0x6D2Au, 0.00010000 },
+  { 0x6D32u, 0.00220000 },
+  { 0x6D3Bu, 0.00090000 },
+  { 0x6D3Du, 0.00000000 },
+  { 0x6D3Eu, 0.00080000 },
+  { 0x6D41u, 0.00130000 },
+  { 0x6D45u, 0.00000000 },
+  { 0x6D4Bu, 0.00000000 },
+  { 0x6D4Eu, 0.00000000 },
+  { 0x6D4Fu, 0.00000000 },
+  { 0x6D51u, 0.00000000 },
+  { 0x6D53u, 0.00000000 },
+  { 0x6D59u, 0.00010000 },
+  { 0x6D66u, 0.00020000 },
+  { 0x6D69u, 0.00010000 },
+  { 0x6D6Au, 0.00020000 },
+  { 0x6D6Eu, 0.00010000 },
+  { 0x6D74u, 0.00000000 },
+  { 0x6D77u, 0.00380000 },
+  { 0x6D85u, 0.00000000 },
+  { 0x6D88u, 0.00050000 },
+  { 0x6D89u, 0.00010000 },
+  { 0x6D9Bu, 0.00000000 },
+  { 0x6DA8u, 0.00000000 },
+  { 0x6DAFu, 0.00010000 },
+  { 0x6DB2u, 0.00010000 },
+  { 0x6DB5u, 0.00000000 },
+  { 0x6DCBu, 0.00000000 },
+  { 0x6DD1u, 0.00000000 },
+  { 0x6DD8u, 0.00000000 },
+  { 0x6DE1u, 0.00010000 },
+  { 0x6DF1u, 0.00070000 },
+  { 0x6DF7u, 0.00020000 },
+  { 0x6DFBu, 0.00010000 },
+  { 0x6E05u, 0.00110000 },
+  { 0x6E10u, 0.00000000 },
+  { 0x6E21u, 0.00020000 },
+  { 0x6E23u, 0.00010000 },
+  { 0x6E29u, 0.00000000 },
+  { 0x6E2Fu, 0.00910000 },
+  { 0x6E34u, 0.00000000 },
+  { 0x6E38u, 0.00020000 },
+  { 0x6E56u, 0.00040000 },
+  { 0x6E7Eu, 0.00000000 },
+  { 0x6E90u, 0.00060000 },
+  { 0x6E9Cu, 0.00000000 },
+  { 0x6EAAu, 0.00010000 },
+  { 0x6ECBu, 0.00000000 },
+  { 0x6ED1u, 0.00010000 },
+  { 0x6EE1u, 0.00000000 },
+  { 0x6EE5u, 0.00000000 },
+  { 0x6EE8u, 0.00000000 },
+  { 0x6EF4u, 0.00000000 },
+  { 0x6F02u, 0.00000000 },
+  { 0x6F0Fu, 0.00000000 },
+  { 0x6F14u, 0.00160000 },
+  { 0x6F20u, 0.00010000 },
+  { 0x6F2Bu, 0.00030000 },
+  { 0x6F58u, 0.00010000 },
+  { 0x6F5Cu, 0.00000000 },
+  { 0x6F6Eu, 0.00030000 },
+  { 0x6F8Eu, 0.00000000 },
+  { 0x6FB3u, 0.00110000 },
+  { 0x6FC0u, 0.00020000 },
+  { 0x704Cu, 0.00000000 },
+  { 0x706Bu, 0.00070000 },
+  { 0x706Du, 0.00000000 },
+  { 0x706Fu, 0.00000000 },
+  { 0x7070u, 0.00020000 },
+  { 0x7075u, 0.00000000 },
+  { 0x707Fu, 0.00000000 },
+  { 0x7089u, 0.00000000 },
+  { 0x708Eu, 0.00010000 },
+  { 0x70AEu, 0.00010000 },
+  { 0x70B8u, 0.00010000 },
+  { 0x70B9u, 0.00000000 },
+  { 0x70C2u, 0.00000000 },
+  { 0x70C8u, 0.00020000 },
+  { 0x70E4u, 0.00000000 },
+  { 0x70E6u, 0.00000000 },
+  { 0x70E7u, 0.00000000 },
+  { 0x70EDu, 0.00000000 },
+  { 0x7126u, 0.00000000 },
+  { 0x7136u, 0.00170000 },
+  { 0x714Cu, 0.00000000 },
+  { 0x715Eu, 0.00000000 },
+  { 0x7167u, 0.00030000 },
+  { 0x716Eu, 0.00010000 },
+  { 0x718Au, 0.00020000 },
+  { 0x719Fu, 0.00020000 },
+  { 0x71C3u, 0.00010000 },
+  { 0x71D5u, 0.00010000 },
+  { 0x7206u, 0.00030000 },
+  { 0x722Au, 0.00010000 },
+  { 0x722Cu, 0.00010000 },
+  { 0x7231u, 0.00000000 },
+  { 0x7235u, 0.00020000 },
+  { 0x7236u, 0.00020000 },
+  { 0x7237u, 0.00000000 },
+  { 0x7238u, 0.00020000 },
+  { 0x723Du, 0.00000000 },
+  { 0x7247u, 0.00100000 },
+  { 0x7248u, 0.00110000 },
+  { 0x724Cu, 0.00060000 },
+  { 0x7259u, 0.00060000 },
+  { 0x725Bu, 0.00050000 },
+  { 0x7261u, 0.00000000 },
+  { 0x7262u, 0.00000000 },
+  { 0x7267u, 0.00010000 },
+  { 0x7269u, 0.00310000 },
+  { 0x7272u, 0.00000000 },
+  { 0x7275u, 0.00000000 },
+  { 0x7279u, 0.00190000 },
+  { 0x727Au, 0.00000000 },
+  { 0x72AFu, 0.00010000 },
+  { 0x72B6u, 0.00000000 },
+  { 0x72B9u, 0.00000000 },
+  { 0x72C2u, 0.00010000 },
+  { 0x72D0u, 0.00010000 },
+  { 0x72D7u, 0.00020000 },
+  { 0x72E0u, 0.00000000 },
+  { 0x72ECu, 0.00000000 },
+  { 0x72EEu, 0.00000000 },
+  { 0x72F1u, 0.00000000 },
+  { 0x72FCu, 0.00010000 },
+  { 0x731Bu, 0.00020000 },
+  { 0x731Cu, 0.00000000 },
+  { 0x732Au, 0.00000000 },
+  { 0x732Eu, 0.00000000 },
+  { 0x7334u, 0.00010000 },
+  { 0x7384u, 0.00010000 },
+  { 0x7387u, 0.00040000 },
+  { 0x7389u, 0.00010000 },
+  { 0x738Bu, 0.00130000 },
+  { 0x739Bu, 0.00000000 },
+  { 0x73A9u, 0.00040000 },
+  { 0x73ABu, 0.00000000 },
+  { 0x73AFu, 0.00000000 },
+  { 0x73B0u, 0.00000000 },
+  { 0x73B2u, 0.00010000 },
+  { 0x73BBu, 0.00010000 },
+  { 0x73C0u, 0.00000000 },
+  { 0x73CAu, 0.00010000 },
+  { 0x73CDu, 0.00020000 },
+  { 0x73E0u, 0.00030000 },
+  { 0x73EDu, 0.00090000 },
+  { 0x7403u, 0.00280000 },
+  { 0x7406u, 0.00250000 },
+  { 0x740Au, 0.00000000 },
+  { 0x742Au, 0.00010000 },
+  { 0x7433u, 0.00010000 },
+  { 0x7434u, 0.00010000 },
+  { 0x743Cu, 0.00000000 },
+  { 0x7459u, 0.00000000 },
+  { 0x745Cu, 0.00000000 },
+  { 0x745Eu, 0.00030000 },
+  { 0x745Fu, 0.00010000 },
+  { 0x7470u, 0.00000000 },
+  { 0x7476u, 0.00000000 },
+  { 0x7483u, 0.00010000 },
+  { 0x74DCu, 0.00010000 },
+  { 0x74E6u, 0.00020000 },
+  { 0x74F6u, 0.00000000 },
+  { 0x7518u, 0.00010000 },
+  { 0x751Au, 0.00030000 },
+  { 0x751Cu, 0.00010000 },
+  { 0x751Fu, 0.00440000 },
+  { 0x7528u, 0.00570000 },
+  { 0x7530u, 0.00090000 },
+  { 0x7531u, 0.00500000 },
+  { 0x7532u, 0.00050000 },
+  { 0x7533u, 0.00020000 },
+  { 0x7535u, 0.00000000 },
+  { 0x7537u, 0.00050000 },
+  { 0x7538u, 0.00010000 },
+  { 0x753Bu, 0.00000000 },
+  { 0x7545u, 0.00000000 },
+  { 0x754Cu, 0.00250000 },
+  { 0x7559u, 0.00050000 },
+  { 0x7565u, 0.00020000 },
+  { 0x756Au, 0.00030000 },
+  { 0x7586u, 0.00010000 },
+  { 0x758Fu, 0.00010000 },
+  { 0x7591u, 0.00020000 },
+  { 0x7597u, 0.00000000 },
+  { 0x75AFu, 0.00000000 },
+  { 0x75B2u, 0.00000000 },
+  { 0x75BCu, 0.00000000 },
+  { 0x75BEu, 0.00000000 },
+  { 0x75C5u, 0.00050000 },
+  { 0x75D5u, 0.00000000 },
+  { 0x75DBu, 0.00010000 },
+  { 0x75F4u, 0.00000000 },
+  { 0x7678u, 0.00000000 },
+  { 0x767Bu, 0.00040000 },
+  { 0x767Du, 0.00090000 },
+  { 0x767Eu, 0.00110000 },
+  { 0x7684u, 0.00150000 },
+  { 0x7686u, 0.00010000 },
+  { 0x7687u, 0.00080000 },
+  { 0x76AEu, 0.00030000 },
+  { 0x76C8u, 0.00010000 },
+  { 0x76CAu, 0.00020000 },
+  { 0x76D1u, 0.00000000 },
+  { 0x76D2u, 0.00000000 },
+  { 0x76D6u, 0.00000000 },
+  { 0x76D8u, 0.00000000 },
+  { 0x76DBu, 0.00030000 },
+  { 0x76DFu, 0.00040000 },
+  { 0x76EEu, 0.00170000 },
+  { 0x76F4u, 0.00160000 },
+  { 0x76F8u, 0.00160000 },
+  { 0x76FCu, 0.00000000 },
+  { 0x76FEu, 0.00000000 },
+  { 0x7701u, 0.00100000 },
+  { 0x7709u, 0.00000000 },
+  { 0x770Bu, 0.00010000 },
+  { 0x771Fu, 0.00050000 },
+  { 0x7720u, 0.00000000 },
+  { 0x773Cu, 0.00030000 },
+  { 0x7740u, 0.00020000 },
+  { 0x775Bu, 0.00000000 },
+  { 0x7761u, 0.00000000 },
+  { 0x7763u, 0.00040000 },
+  { 0x77A7u, 0.00000000 },
+  { 0x77DBu, 0.00000000 },
+  { 0x77E3u, 0.00000000 },
+  { 0x77E5u, 0.00080000 },
+  { 0x77EDu, 0.00040000 },
+  { 0x77F3u, 0.00100000 },
+  { 0x77F6u, 0.00000000 },
+  { 0x7801u, 0.00000000 },
+  { 0x7802u, 0.00000000 },
+  { 0x780Du, 0.00000000 },
+  { 0x7814u, 0.00060000 },
+  { 0x7834u, 0.00030000 },
+  { 0x7840u, 0.00000000 },
+  { 0x7855u, 0.00000000 },
+  { 0x786Cu, 0.00020000 },
+  { 0x786Eu, 0.00000000 },
+  { 0x788Du, 0.00000000 },
+  { 0x788Eu, 0.00010000 },
+  { 0x7897u, 0.00000000 },
+  { 0x789Fu, 0.00020000 },
+  { 0x78A7u, 0.00010000 },
+  { 0x78B0u, 0.00000000 },
+  { 0x78C1u, 0.00010000 },
+  { 0x78C5u, 0.00000000 },
+  { 0x78E8u, 0.00010000 },
+  { 0x793Au, 0.00070000 },
+  { 0x793Cu, 0.00000000 },
+  { 0x793Eu, 0.00100000 },
+  { 0x7956u, 0.00030000 },
+  { 0x795Au, 0.00000000 },
+  { 0x795Du, 0.00010000 },
+  { 0x795Eu, 0.00080000 },
+  { 0x7965u, 0.00010000 },
+  { 0x7968u, 0.00070000 },
+  { 0x796Fu, 0.00000000 },
+  { 0x7978u, 0.00000000 },
+  { 0x7981u, 0.00020000 },
+  { 0x7985u, 0.00000000 },
+  { 0x798Fu, 0.00060000 },
+  { 0x79BBu, 0.00000000 },
+  { 0x79C0u, 0.00030000 },
+  { 0x79C1u, 0.00030000 },
+  { 0x79CBu, 0.00020000 },
+  { 0x79CDu, 0.00000000 },
+  { 0x79D1u, 0.00160000 },
+  { 0x79D2u, 0.00010000 },
+  { 0x79D8u, 0.00010000 },
+  { 0x79DFu, 0.00020000 },
+  { 0x79E4u, 0.00000000 },
+  { 0x79E6u, 0.00010000 },
+  { 0x79E9u, 0.00000000 },
+  { 0x79EFu, 0.00000000 },
+  { 0x79F0u, 0.00000000 },
+  { 0x79FBu, 0.00040000 },
+  { 0x7A00u, 0.00000000 },
+  { 0x7A0Bu, 0.00130000 },
+  { 0x7A0Du, 0.00000000 },
+  { 0x7A0Eu, 0.00000000 },
+  { 0x7A23u, 0.00000000 },
+  { 0x7A33u, 0.00000000 },
+  { 0x7A3Fu, 0.00010000 },
+  { 0x7A46u, 0.00010000 },
+  { 0x7A76u, 0.00060000 },
+  { 0x7A77u, 0.00000000 },
+  { 0x7A79u, 0.00000000 },
+  { 0x7A7Au, 0.00090000 },
+  { 0x7A7Fu, 0.00020000 },
+  { 0x7A81u, 0.00030000 },
+  { 0x7A97u, 0.00000000 },
+  { 0x7A9Du, 0.00000000 },
+  { 0x7ACBu, 0.00280000 },
+  { 0x7AD9u, 0.00330000 },
+  { 0x7ADEu, 0.00000000 },
+  { 0x7ADFu, 0.00000000 },
+  { 0x7AE0u, 0.00040000 },
+  { 0x7AE5u, 0.00040000 },
+  { 0x7AEFu, 0.00020000 },
+  { 0x7AF9u, 0.00020000 },
+  { 0x7B11u, 0.00010000 },
+  { 0x7B14u, 0.00000000 },
+  { 0x7B1Bu, 0.00000000 },
+  { 0x7B26u, 0.00030000 },
+  { 0x7B28u, 0.00000000 },
+  { 0x7B2Cu, 0.00410000 },
+  { 0x7B49u, 0.00310000 },
+  { 0x7B4Bu, 0.00000000 },
+  { 0x7B51u, 0.00000000 },
+  { 0x7B54u, 0.00010000 },
+  { 0x7B56u, 0.00030000 },
+  { 0x7B79u, 0.00000000 },
+  { 0x7B7Eu, 0.00000000 },
+  { 0x7B80u, 0.00000000 },
+  { 0x7B97u, 0.00050000 },
+  { 0x7BA1u, 0.00100000 },
+  { 0x7BADu, 0.00010000 },
+  { 0x7BB1u, 0.00010000 },
+  { 0x7BC7u, 0.00020000 },
+  { 0x7BEEu, 0.00000000 },
+  { 0x7C3Fu, 0.00000000 },
+  { 0x7C4Du, 0.00030000 },
+  { 0x7C73u, 0.00150000 },
+  { 0x7C7Bu, 0.00000000 },
+  { 0x7C89u, 0.00020000 },
+  { 0x7C92u, 0.00050000 },
+  { 0x7C97u, 0.00010000 },
+  { 0x7CA4u, 0.00000000 },
+  { 0x7CB9u, 0.00000000 },
+  { 0x7CBEu, 0.00040000 },
+  { 0x7CCAu, 0.00010000 },
+  { 0x7CD5u, 0.00000000 },
+  { 0x7CD6u, 0.00010000 },
+  { 0x7CDFu, 0.00000000 },
+  { 0x7CFBu, 0.00130000 },
+  { 0x7D20u, 0.00070000 },
+  { 0x7D22u, 0.00020000 },
+  { 0x7D27u, 0.00000000 },
+  { 0x7D2Bu, 0.00020000 },
+  { 0x7D2Fu, 0.00010000 },
+  { 0x7E41u, 0.00030000 },
+  { 0x7EA2u, 0.00000000 },
+  { 0x7EA6u, 0.00000000 },
+  { 0x7EA7u, 0.00000000 },
+  { 0x7EAAu, 0.00000000 },
+  { 0x7EAFu, 0.00000000 },
+  { 0x7EB2u, 0.00000000 },
+  { 0x7EB3u, 0.00000000 },
+  { 0x7EB5u, 0.00000000 },
+  { 0x7EB7u, 0.00000000 },
+  { 0x7EB8u, 0.00000000 },
+  { 0x7EBDu, 0.00000000 },
+  { 0x7EBFu, 0.00000000 },
+  { 0x7EC3u, 0.00000000 },
+  { 0x7EC4u, 0.00000000 },
+  { 0x7EC6u, 0.00000000 },
+  { 0x7EC7u, 0.00000000 },
+  { 0x7EC8u, 0.00000000 },
+  { 0x7ECDu, 0.00000000 },
+  { 0x7ECFu, 0.00000000 },
+  { 0x7ED3u, 0.00000000 },
+  { 0x7ED5u, 0.00000000 },
+  { 0x7ED8u, 0.00000000 },
+  { 0x7ED9u, 0.00000000 },
+  { 0x7EDCu, 0.00000000 },
+  { 0x7EDDu, 0.00000000 },
+  { 0x7EDFu, 0.00000000 },
+  { 0x7EE7u, 0.00000000 },
+  { 0x7EE9u, 0.00000000 },
+  { 0x7EEAu, 0.00000000 },
+  { 0x7EEDu, 0.00000000 },
+  { 0x7EF4u, 0.00000000 },
+  { 0x7EF5u, 0.00000000 },
+  { 0x7EFCu, 0.00000000 },
+  { 0x7EFFu, 0.00000000 },
+  { 0x7F05u, 0.00000000 },
+  { 0x7F13u, 0.00000000 },
+  { 0x7F16u, 0.00000000 },
+  { 0x7F18u, 0.00000000 },
+  { 0x7F20u, 0.00000000 },
+  { 0x7F29u, 0.00000000 },
+  { 0x7F34u, 0.00000000 },
+  { 0x7F36u, 0.00000000 },
+  { 0x7F38u, 0.00000000 },
+  { 0x7F3Au, 0.00010000 },
+  { 0x7F50u, 0.00000000 },
+  { 0x7F51u, 0.00000000 },
+  { 0x7F55u, 0.00010000 },
+  { 0x7F57u, 0.00000000 },
+  { 0x7F5Au, 0.00000000 },
+  { 0x7F62u, 0.00000000 },
+  { 0x7F6Au, 0.00020000 },
+  { 0x7F6Eu, 0.00060000 },
+  { 0x7F72u, 0.00040000 },
+  { 0x7F8Au, 0.00010000 },
+  { 0x7F8Eu, 0.00230000 },
+  { 0x7F9Eu, 0.00000000 },
+  { 0x7FA4u, 0.00040000 },
+  { 0x7FAFu, 0.00000000 },
+  { 0x7FBDu, 0.00010000 },
+  { 0x7FC1u, 0.00000000 },
+  { 0x7FC5u, 0.00000000 },
+  { 0x7FD4u, 0.00010000 },
+  { 0x7FD8u, 0.00000000 },
+  { 0x7FE0u, 0.00020000 },
+  { 0x7FF0u, 0.00010000 },
+  { 0x7FFBu, 0.00020000 },
+  { 0x7FFCu, 0.00020000 },
+  { 0x8000u, 0.00010000 },
+  { 0x8001u, 0.00100000 },
+  { 0x8003u, 0.00070000 },
+  { 0x8005u, 0.00300000 },
+  { 0x800Cu, 0.00600000 },
+  { 0x800Du, 0.00000000 },
+  { 0x8010u, 0.00030000 },
+  { 0x8017u, 0.00000000 },
+  { 0x8033u, 0.00030000 },
+  { 0x8036u, 0.00010000 },
+  { 0x804Au, 0.00000000 },
+  { 0x804Cu, 0.00000000 },
+  { 0x8054u, 0.00000000 },
+  { 0x8058u, 0.00000000 },
+  { 0x805Au, 0.00020000 },
+  { 0x806Au, 0.00000000 },
+  { 0x8089u, 0.00030000 },
+  { 0x8096u, 0.00000000 },
+  { 0x809Au, 0.00010000 },
+  { 0x80A1u, 0.00040000 },
+  { 0x80A4u, 0.00000000 },
+  { 0x80A5u, 0.00010000 },
+  { 0x80A9u, 0.00000000 },
+  { 0x80AFu, 0.00010000 },
+  { 0x80B2u, 0.00060000 },
+  { 0x80C1u, 0.00000000 },
+  { 0x80C6u, 0.00000000 },
+  { 0x80CCu, 0.00030000 },
+  { 0x80CEu, 0.00010000 },
+  { 0x80D6u, 0.00000000 },
+  { 0x80DCu, 0.00000000 },
+  { 0x80DEu, 0.00010000 },
+  { 0x80E1u, 0.00020000 },
+  { 0x80F6u, 0.00000000 },
+  { 0x80F8u, 0.00010000 },
+  { 0x80FDu, 0.00160000 },
+  { 0x8106u, 0.00000000 },
+  { 0x8111u, 0.00000000 },
+  { 0x8131u, 0.00000000 },
+  { 0x8138u, 0.00000000 },
+  { 0x814Au, 0.00000000 },
+  { 0x8150u, 0.00010000 },
+  { 0x8153u, 0.00000000 },
+  { 0x8170u, 0.00010000 },
+  { 0x8179u, 0.00010000 },
+  { 0x817Eu, 0.00000000 },
+  { 0x817Fu, 0.00000000 },
+  { 0x81C2u, 0.00000000 },
+  { 0x81E3u, 0.00030000 },
+  { 0x81EAu, 0.00340000 },
+  { 0x81EDu, 0.00000000 },
+  { 0x81F3u, 0.00280000 },
+  { 0x81F4u, 0.00040000 },
+  { 0x820Cu, 0.00000000 },
+  { 0x820Du, 0.00010000 },
+  { 0x8212u, 0.00010000 },
+  { 0x821Eu, 0.00020000 },
+  { 0x821Fu, 0.00000000 },
+  { 0x822Au, 0.00040000 },
+  { 0x822Cu, 0.00060000 },
+  { 0x8230u, 0.00000000 },
+  { 0x8239u, 0.00060000 },
+  { 0x826Fu, 0.00020000 },
+  { 0x8272u, 0.00150000 },
+  { 0x827Au, 0.00000000 },
+  { 0x827Eu, 0.00020000 },
+  { 0x8282u, 0.00000000 },
+  { 0x8292u, 0.00000000 },
+  { 0x829Du, 0.00010000 },
+  { 0x82A6u, 0.00000000 },
+  { 0x82ACu, 0.00010000 },
+  { 0x82ADu, 0.00010000 },
+  { 0x82B1u, 0.00090000 },
+  { 0x82B3u, 0.00010000 },
+  { 0x82CDu, 0.00000000 },
+  { 0x82CFu, 0.00000000 },
+  { 0x82D7u, 0.00010000 },
+  { 0x82E5u, 0.00020000 },
+  { 0x82E6u, 0.00010000 },
+  { 0x82F1u, 0.00380000 },
+  { 0x8302u, 0.00010000 },
+  { 0x8303u, 0.00000000 },
+  { 0x8328u, 0.00000000 },
+  { 0x832Bu, 0.00000000 },
+  { 0x8336u, 0.00020000 },
+  { 0x8349u, 0.00040000 },
+  { 0x8350u, 0.00000000 },
+  { 0x8352u, 0.00010000 },
+  { 0x8363u, 0.00000000 },
+  { 0x836Fu, 0.00000000 },
+  { 0x8377u, 0.00030000 },
+  { 0x8389u, 0.00010000 },
+  { 0x838Eu, 0.00010000 },
+  { 0x83AAu, 0.00000000 },
+  { 0x83ABu, 0.00040000 },
+  { 0x83B1u, 0.00000000 },
+  { 0x83B2u, 0.00000000 },
+  { 0x83B7u, 0.00000000 },
+  { 0x83DCu, 0.00020000 },
+  { 0x83E9u, 0.00000000 },
+  { 0x83F2u, 0.00040000 },
+  { 0x8404u, 0.00020000 },
+  { 0x840Du, 0.00000000 },
+  { 0x8424u, 0.00000000 },
+  { 0x8425u, 0.00000000 },
+  { 0x8427u, 0.00000000 },
+  { 0x8428u, 0.00000000 },
+  { 0x843Du, 0.00110000 },
+  { 0x8457u, 0.00050000 },
+  { 0x845Bu, 0.00010000 },
+  { 0x8461u, 0.00020000 },
+  { 0x8482u, 0.00010000 },
+  { 0x848Bu, 0.00000000 },
+  { 0x8499u, 0.00020000 },
+  { 0x84C9u, 0.00000000 },
+  { 0x84DDu, 0.00000000 },
+  { 0x84ECu, 0.00000000 },
+  { 0x8511u, 0.00000000 },
+  { 0x8521u, 0.00010000 },
+  { 0x8584u, 0.00010000 },
+  { 0x85AAu, 0.00000000 },
+  { 0x85C9u, 0.00010000 },
+  { 0x85CFu, 0.00020000 },
+  { 0x85E4u, 0.00010000 },
+  { 0x864Eu, 0.00030000 },
+  { 0x8651u, 0.00000000 },
+  { 0x866Bu, 0.00000000 },
+  { 0x8679u, 0.00010000 },
+  { 0x867Du, 0.00000000 },
+  { 0x867Eu, 0.00000000 },
+  { 0x8681u, 0.00000000 },
+  { 0x86C7u, 0.00010000 },
+  { 0x86CBu, 0.00020000 },
+  { 0x86D9u, 0.00010000 },
+  { 0x86EEu, 0.00000000 },
+  { 0x8702u, 0.00000000 },
+  { 0x871Cu, 0.00000000 },
+  { 0x8776u, 0.00010000 },
+  { 0x878Du, 0.00030000 },
+  { 0x87F9u, 0.00010000 },
+  { 0x8822u, 0.00000000 },
+  { 0x8840u, 0.00030000 },
+  { 0x884Cu, 0.00500000 },
+  { 0x8857u, 0.00130000 },
+  { 0x8861u, 0.00010000 },
+  { 0x8863u, 0.00030000 },
+  { 0x8865u, 0.00000000 },
+  { 0x8868u, 0.00190000 },
+  { 0x888Bu, 0.00010000 },
+  { 0x88ABu, 0.00150000 },
+  { 0x88ADu, 0.00000000 },
+  { 0x88C1u, 0.00020000 },
+  { 0x88C2u, 0.00010000 },
+  { 0x88C5u, 0.00000000 },
+  { 0x88D5u, 0.00010000 },
+  { 0x88E4u, 0.00000000 },
+  { 0x897Fu, 0.00410000 },
+  { 0x8981u, 0.00370000 },
+  { 0x8986u, 0.00010000 },
+  { 0x89C1u, 0.00000000 },
+  { 0x89C2u, 0.00000000 },
+  { 0x89C4u, 0.00000000 },
+  { 0x89C6u, 0.00000000 },
+  { 0x89C8u, 0.00000000 },
+  { 0x89C9u, 0.00000000 },
+  { 0x89D2u, 0.00160000 },
+  { 0x89E3u, 0.00110000 },
+  { 0x8A00u, 0.00090000 },
+  { 0x8A89u, 0.00000000 },
+  { 0x8A93u, 0.00000000 },
+  { 0x8B66u, 0.00050000 },
+  { 0x8BA1u, 0.00000000 },
+  { 0x8BA2u, 0.00000000 },
+  { 0x8BA4u, 0.00000000 },
+  { 0x8BA8u, 0.00000000 },
+  { 0x8BA9u, 0.00000000 },
+  { 0x8BADu, 0.00000000 },
+  { 0x8BAEu, 0.00000000 },
+  { 0x8BAFu, 0.00000000 },
+  { 0x8BB0u, 0.00000000 },
+  { 0x8BB2u, 0.00000000 },
+  { 0x8BB7u, 0.00000000 },
+  { 0x8BB8u, 0.00000000 },
+  { 0x8BBAu, 0.00000000 },
+  { 0x8BBEu, 0.00000000 },
+  { 0x8BBFu, 0.00000000 },
+  { 0x8BC1u, 0.00000000 },
+  { 0x8BC4u, 0.00000000 },
+  { 0x8BC6u, 0.00000000 },
+  { 0x8BC9u, 0.00000000 },
+  { 0x8BCDu, 0.00000000 },
+  { 0x8BD1u, 0.00000000 },
+  { 0x8BD5u, 0.00000000 },
+  { 0x8BD7u, 0.00000000 },
+  { 0x8BDAu, 0.00000000 },
+  { 0x8BDDu, 0.00000000 },
+  { 0x8BDEu, 0.00000000 },
+  { 0x8BE2u, 0.00000000 },
+  { 0x8BE5u, 0.00000000 },
+  { 0x8BE6u, 0.00000000 },
+  { 0x8BEDu, 0.00000000 },
+  { 0x8BEFu, 0.00000000 },
+  { 0x8BF4u, 0.00000000 },
+  { 0x8BF7u, 0.00000000 },
+  { 0x8BF8u, 0.00000000 },
+  { 0x8BFAu, 0.00000000 },
+  { 0x8BFBu, 0.00000000 },
+  { 0x8BFEu, 0.00000000 },
+  { 0x8C01u, 0.00000000 },
+  { 0x8C03u, 0.00000000 },
+  { 0x8C05u, 0.00000000 },
+  { 0x8C08u, 0.00000000 },
+  { 0x8C0Au, 0.00000000 },
+  { 0x8C0Bu, 0.00000000 },
+  { 0x8C13u, 0.00000000 },
+  { 0x8C1Cu, 0.00000000 },
+  { 0x8C22u, 0.00000000 },
+  { 0x8C28u, 0.00000000 },
+  { 0x8C31u, 0.00000000 },
+  { 0x8C37u, 0.00030000 },
+  { 0x8C46u, 0.00010000 },
+  { 0x8C61u, 0.00070000 },
+  { 0x8C6Au, 0.00030000 },
+  { 0x8C8Cu, 0.00000000 },
+  { 0x8D1Du, 0.00000000 },
+  { 0x8D1Eu, 0.00000000 },
+  { 0x8D1Fu, 0.00000000 },
+  { 0x8D21u, 0.00000000 },
+  { 0x8D22u, 0.00000000 },
+  { 0x8D23u, 0.00000000 },
+  { 0x8D24u, 0.00000000 },
+  { 0x8D25u, 0.00000000 },
+  { 0x8D27u, 0.00000000 },
+  { 0x8D28u, 0.00000000 },
+  { 0x8D29u, 0.00000000 },
+  { 0x8D2Au, 0.00000000 },
+  { 0x8D2Du, 0.00000000 },
+  { 0x8D2Fu, 0.00000000 },
+  { 0x8D31u, 0.00000000 },
+  { 0x8D34u, 0.00000000 },
+  { 0x8D35u, 0.00000000 },
+  { 0x8D38u, 0.00000000 },
+  { 0x8D39u, 0.00000000 },
+  { 0x8D3Au, 0.00000000 },
+  { 0x8D3Cu, 0.00000000 },
+  { 0x8D3Eu, 0.00000000 },
+  { 0x8D44u, 0.00000000 },
+  { 0x8D4Bu, 0.00000000 },
+  { 0x8D4Cu, 0.00000000 },
+  { 0x8D4Fu, 0.00000000 },
+  { 0x8D50u, 0.00000000 },
+  { 0x8D54u, 0.00000000 },
+  { 0x8D56u, 0.00000000 },
+  { 0x8D5Au, 0.00000000 },
+  { 0x8D5Bu, 0.00000000 },
+  { 0x8D5Eu, 0.00000000 },
+  { 0x8D60u, 0.00000000 },
+  { 0x8D62u, 0.00000000 },
+  { 0x8D64u, 0.00020000 },
+  { 0x8D6Bu, 0.00010000 },
+  { 0x8D70u, 0.00050000 },
+  { 0x8D75u, 0.00000000 },
+  { 0x8D77u, 0.00250000 },
+  { 0x8D81u, 0.00000000 },
+  { 0x8D85u, 0.00080000 },
+  { 0x8D8Au, 0.00070000 },
+  { 0x8D8Bu, 0.00000000 },
+  { 0x8DA3u, 0.00010000 },
+  { 0x8DB3u, 0.00100000 },
+  { 0x8DC3u, 0.00000000 },
+  { 0x8DCCu, 0.00010000 },
+  { 0x8DD1u, 0.00020000 },
+  { 0x8DDDu, 0.00020000 },
+  { 0x8DDFu, 0.00040000 },
+  { 0x8DEFu, 0.00300000 },
+  { 0x8DF3u, 0.00010000 },
+  { 0x8E0Fu, 0.00000000 },
+  { 0x8E22u, 0.00010000 },
+  { 0x8E29u, 0.00000000 },
+  { 0x8EABu, 0.00170000 },
+  { 0x8EB2u, 0.00000000 },
+  { 0x8F66u, 0.00000000 },
+  { 0x8F68u, 0.00000000 },
+  { 0x8F69u, 0.00000000 },
+  { 0x8F6Cu, 0.00000000 },
+  { 0x8F6Eu, 0.00000000 },
+  { 0x8F6Fu, 0.00000000 },
+  { 0x8F70u, 0.00000000 },
+  { 0x8F7Bu, 0.00000000 },
+  { 0x8F7Du, 0.00000000 },
+  { 0x8F83u, 0.00000000 },
+  { 0x8F85u, 0.00000000 },
+  { 0x8F86u, 0.00000000 },
+  { 0x8F88u, 0.00000000 },
+  { 0x8F89u, 0.00000000 },
+  { 0x8F91u, 0.00000000 },
+  { 0x8F93u, 0.00000000 },
+  { 0x8F9Bu, 0.00010000 },
+  { 0x8F9Eu, 0.00000000 },
+  { 0x8FA8u, 0.00000000 },
+  { 0x8FA9u, 0.00000000 },
+  { 0x8FB0u, 0.00000000 },
+  { 0x8FB1u, 0.00000000 },
+  { 0x8FB9u, 0.00000000 },
+  { 0x8FBEu, 0.00000000 },
+  { 0x8FC1u, 0.00000000 },
+  { 0x8FC5u, 0.00010000 },
+  { 0x8FC7u, 0.00000000 },
+  { 0x8FC8u, 0.00000000 },
+  { 0x8FCEu, 0.00020000 },
+  { 0x8FD0u, 0.00000000 },
+  { 0x8FD1u, 0.00140000 },
+  { 0x8FD4u, 0.00100000 },
+  { 0x8FD8u, 0.00000000 },
+  { 0x8FD9u, 0.00000000 },
+  { 0x8FDBu, 0.00000000 },
+  { 0x8FDCu, 0.00000000 },
+  { 0x8FDDu, 0.00000000 },
+  { 0x8FDEu, 0.00000000 },
+  { 0x8FDFu, 0.00000000 },
+  { 0x8FE6u, 0.00000000 },
+  { 0x8FEAu, 0.00030000 },
+  { 0x8FEBu, 0.00010000 },
+  { 0x8FF0u, 0.00020000 },
+  { 0x8FF7u, 0.00020000 },
+  { 0x8FFDu, 0.00020000 },
+  { 0x9000u, 0.00040000 },
+  { 0x9001u, 0.00030000 },
+  { 0x9002u, 0.00000000 },
+  { 0x9003u, 0.00010000 },
+  { 0x9006u, 0.00000000 },
+  { 0x9009u, 0.00000000 },
+  { 0x900Au, 0.00000000 },
+  { 0x900Fu, 0.00020000 },
+  { 0x9010u, 0.00020000 },
+  { 0x9012u, 0.00000000 },
+  { 0x9014u, 0.00030000 },
+  { 0x901Au, 0.00270000 },
+  { 0x901Bu, 0.00000000 },
+  { 0x901Du, 0.00010000 },
+  { 0x901Fu, 0.00050000 },
+  { 0x9020u, 0.00090000 },
+  { 0x9022u, 0.00010000 },
+  { 0x9038u, 0.00000000 },
+  { 0x903Bu, 0.00000000 },
+  { 0x903Cu, 0.00010000 },
+  { 0x9047u, 0.00010000 },
+  { 0x904Du, 0.00010000 },
+  { 0x9053u, 0.00320000 },
+  { 0x9057u, 0.00000000 },
+  { 0x906Du, 0.00010000 },
+  { 0x906Eu, 0.00010000 },
+  { 0x9075u, 0.00000000 },
+  { 0x907Fu, 0.00010000 },
+  { 0x9080u, 0.00010000 },
+  { 0x9093u, 0.00000000 },
+  { 0x90A3u, 0.00010000 },
+  { 0x90A6u, 0.00020000 },
+  { 0x90AAu, 0.00000000 },
+  { 0x90AEu, 0.00000000 },
+  { 0x90B1u, 0.00000000 },
+  { 0x90BBu, 0.00000000 },
+  { 0x90CEu, 0.00010000 },
+  { 0x90D1u, 0.00000000 },
+  { 0x90E8u, 0.00380000 },
+  { 0x90EDu, 0.00010000 },
+  { 0x90FDu, 0.00630000 },
+  { 0x9102u, 0.00000000 },
+  { 0x9149u, 0.00000000 },
+  { 0x914Bu, 0.00000000 },
+  { 0x914Du, 0.00060000 },
+  { 0x9152u, 0.00040000 },
+  { 0x9177u, 0.00000000 },
+  { 0x9178u, 0.00020000 },
+  { 0x9189u, 0.00000000 },
+  { 0x9192u, 0.00000000 },
+  { 0x91C7u, 0.00000000 },
+  { 0x91CAu, 0.00000000 },
+  { 0x91CCu, 0.00140000 },
+  { 0x91CDu, 0.00370000 },
+  { 0x91CEu, 0.00040000 },
+  { 0x91CFu, 0.00140000 },
+  { 0x91D1u, 0.00180000 },
+  { 0x9488u, 0.00000000 },
+  { 0x9493u, 0.00000000 },
+  { 0x949Fu, 0.00000000 },
+  { 0x94A2u, 0.00000000 },
+  { 0x94A6u, 0.00000000 },
+  { 0x94B1u, 0.00000000 },
+  { 0x94BBu, 0.00000000 },
+  { 0x94C1u, 0.00000000 },
+  { 0x94C3u, 0.00000000 },
+  { 0x94DCu, 0.00000000 },
+  { 0x94E2u, 0.00000000 },
+  { 0x94EDu, 0.00000000 },
+  { 0x94F6u, 0.00000000 },
+  { 0x94FAu, 0.00000000 },
+  { 0x94FEu, 0.00000000 },
+  { 0x9500u, 0.00000000 },
+  { 0x9501u, 0.00000000 },
+  { 0x9505u, 0.00000000 },
+  { 0x950Bu, 0.00000000 },
+  { 0x9519u, 0.00000000 },
+  { 0x9521u, 0.00000000 },
+  { 0x9526u, 0.00000000 },
+  { 0x952Eu, 0.00000000 },
+  { 0x953Au, 0.00000000 },
+  { 0x9547u, 0.00000000 },
+  { 0x955Cu, 0.00000000 },
+  { 0x956Du, 0.00000000 },
+  { 0x957Fu, 0.00000000 },
+  { 0x95E8u, 0.00000000 },
+  { 0x95EAu, 0.00000000 },
+  { 0x95EDu, 0.00000000 },
+  { 0x95EEu, 0.00000000 },
+  { 0x95F0u, 0.00000000 },
+  { 0x95F2u, 0.00000000 },
+  { 0x95F4u, 0.00000000 },
+  { 0x95F7u, 0.00000000 },
+  { 0x95F9u, 0.00000000 },
+  { 0x95FBu, 0.00000000 },
+  { 0x9601u, 0.00000000 },
+  { 0x9605u, 0.00000000 },
+  { 0x9610u, 0.00000000 },
+  { 0x9614u, 0.00000000 },
+  { 0x961Fu, 0.00000000 },
+  { 0x962Eu, 0.00000000 },
+  { 0x9632u, 0.00050000 },
+  { 0x9633u, 0.00000000 },
+  { 0x9634u, 0.00000000 },
+  { 0x9635u, 0.00000000 },
+  { 0x9636u, 0.00000000 },
+  { 0x963Bu, 0.00010000 },
+  { 0x963Fu, 0.00290000 },
+  { 0x9640u, 0.00000000 },
+  { 0x9644u, 0.00050000 },
+  { 0x9645u, 0.00000000 },
+  { 0x9646u, 0.00000000 },
+  { 0x9648u, 0.00000000 },
+  { 0x964Du, 0.00030000 },
+  { 0x9650u, 0.00070000 },
+  { 0x9662u, 0.00130000 },
+  { 0x9664u, 0.00080000 },
+  { 0x9669u, 0.00000000 },
+  { 0x966Au, 0.00000000 },
+  { 0x9675u, 0.00010000 },
+  { 0x9676u, 0.00010000 },
+  { 0x9677u, 0.00010000 },
+  { 0x9686u, 0.00020000 },
+  { 0x968Fu, 0.00000000 },
+  { 0x9690u, 0.00000000 },
+  { 0x9694u, 0.00040000 },
+  { 0x969Cu, 0.00010000 },
+  { 0x96BEu, 0.00000000 },
+  { 0x96C4u, 0.00030000 },
+  { 0x96C5u, 0.00030000 },
+  { 0x96C6u, 0.00130000 },
+  { 0x96C9u, 0.00000000 },
+  { 0x96E8u, 0.00020000 },
+  { 0x96EAu, 0.00020000 },
+  { 0x96EFu, 0.00000000 },
+  { 0x96F3u, 0.00000000 },
+  { 0x96F6u, 0.00040000 },
+  { 0x96F7u, 0.00020000 },
+  { 0x96FEu, 0.00000000 },
+  { 0x9700u, 0.00040000 },
+  { 0x9707u, 0.00020000 },
+  { 0x970Du, 0.00010000 },
+  { 0x9716u, 0.00000000 },
+  { 0x9732u, 0.00020000 },
+  { 0x9738u, 0.00010000 },
+  { 0x9739u, 0.00000000 },
+  { 0x9752u, 0.00090000 },
+  { 0x9756u, 0.00000000 },
+  { 0x9759u, 0.00000000 },
+  { 0x975Eu, 0.00100000 },
+  { 0x9760u, 0.00020000 },
+  { 0x9762u, 0.00500000 },
+  { 0x9769u, 0.00040000 },
+  { 0x977Cu, 0.00000000 },
+  { 0x978Bu, 0.00000000 },
+  { 0x9791u, 0.00000000 },
+  { 0x97E6u, 0.00000000 },
+  { 0x97E9u, 0.00000000 },
+  { 0x97F3u, 0.00200000 },
+  { 0x9875u, 0.00000000 },
+  { 0x9876u, 0.00000000 },
+  { 0x9879u, 0.00000000 },
+  { 0x987Au, 0.00000000 },
+  { 0x987Bu, 0.00000000 },
+  { 0x987Du, 0.00000000 },
+  { 0x987Eu, 0.00000000 },
+  { 0x987Fu, 0.00000000 },
+  { 0x9884u, 0.00000000 },
+  { 0x9886u, 0.00000000 },
+  { 0x9887u, 0.00000000 },
+  { 0x9891u, 0.00000000 },
+  { 0x9897u, 0.00000000 },
+  { 0x9898u, 0.00000000 },
+  { 0x989Du, 0.00000000 },
+  { 0x98CEu, 0.00000000 },
+  { 0x98D8u, 0.00000000 },
+  { 0x98D9u, 0.00000000 },
+  { 0x98DEu, 0.00000000 },
+  { 0x98DFu, 0.00130000 },
+  { 0x9910u, 0.00030000 },
+  { 0x996Du, 0.00000000 },
+  { 0x996Eu, 0.00000000 },
+  { 0x9970u, 0.00000000 },
+  { 0x9971u, 0.00000000 },
+  { 0x997Cu, 0.00000000 },
+  { 0x9986u, 0.00000000 },
+  { 0x9996u, 0.00150000 },
+  { 0x9999u, 0.00760000 },
+  { 0x99A8u, 0.00000000 },
+  { 0x9A6Cu, 0.00000000 },
+  { 0x9A71u, 0.00000000 },
+  { 0x9A76u, 0.00000000 },
+  { 0x9A7Bu, 0.00000000 },
+  { 0x9A7Eu, 0.00000000 },
+  { 0x9A8Cu, 0.00000000 },
+  { 0x9A91u, 0.00000000 },
+  { 0x9A97u, 0.00000000 },
+  { 0x9A9Au, 0.00000000 },
+  { 0x9AA4u, 0.00000000 },
+  { 0x9AA8u, 0.00020000 },
+  { 0x9AD8u, 0.00250000 },
+  { 0x9B3Cu, 0.00010000 },
+  { 0x9B42u, 0.00010000 },
+  { 0x9B45u, 0.00000000 },
+  { 0x9B54u, 0.00010000 },
+  { 0x9C7Cu, 0.00000000 },
+  { 0x9C81u, 0.00000000 },
+  { 0x9C9Cu, 0.00000000 },
+  { 0x9E1Fu, 0.00000000 },
+  { 0x9E21u, 0.00000000 },
+  { 0x9E23u, 0.00000000 },
+  { 0x9E2Du, 0.00000000 },
+  { 0x9E3Fu, 0.00000000 },
+  { 0x9E45u, 0.00000000 },
+  { 0x9E64u, 0.00000000 },
+  { 0x9E70u, 0.00000000 },
+  { 0x9E7Fu, 0.00010000 },
+  { 0x9EA6u, 0.00000000 },
+  { 0x9EBBu, 0.00030000 },
+  { 0x9EC4u, 0.00000000 },
+  { 0x9ECEu, 0.00030000 },
+  { 0x9ED1u, 0.00050000 },
+  { 0x9ED8u, 0.00010000 },
+  { 0x9F13u, 0.00020000 },
+  { 0x9F20u, 0.00010000 },
+  { 0x9F3Bu, 0.00010000 },
+  { 0x9F50u, 0.00000000 },
+  { 0x9F7Fu, 0.00000000 },
+  { 0x9F84u, 0.00000000 },
+  { 0x9F99u, 0.00000000 },
+  { 0x9F9Fu, 0.00000000 },
+};
+
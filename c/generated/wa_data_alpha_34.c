@@ -0,0 +1,233 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_34_UPPER[] = {
+  "অ",
+  "আ",
+  "ই",
+  "ঈ",
+  "উ",
+  "ঊ",
+  "ঋ",
+  "এ",
+  "ঐ",
+  "ও",
+  "ঔ",
+  "ক",
+  "খ",
+  "গ",
+  "ঘ",
+  "ঙ",
+  "চ",
+  "ছ",
+  "জ",
+  "ঝ",
+  "ঞ",
+  "ট",
+  "ঠ",
+  "ড",
+  "ঢ",
+  "ণ",
+  "ত",
+  "থ",
+  "দ",
+  "ধ",
+  "ন",
+  "প",
+  "ফ",
+  "ব",
+  "ভ",
+  "ম",
+  "য",
+  "র",
+  "ল",
+  "শ",
+  "ষ",
+  "স",
+  "হ",
+  "য়",
+  "ড়",
+  "ঢ়",
+  "ৎ",
+  "ঁ",
+  "ং",
+  "ঃ",
+  "্",
+};
+const char *ALPHA_34_LOWER[] = {
+  "অ",
+  "আ",
+  "ই",
+  "ঈ",
+  "উ",
+  "ঊ",
+  "ঋ",
+  "এ",
+  "ঐ",
+  "ও",
+  "ঔ",
+  "ক",
+  "খ",
+  "গ",
+  "ঘ",
+  "ঙ",
+  "চ",
+  "ছ",
+  "জ",
+  "ঝ",
+  "ঞ",
+  "ট",
+  "ঠ",
+  "ড",
+  "ঢ",
+  "ণ",
+  "ত",
+  "থ",
+  "দ",
+  "ধ",
+  "ন",
+  "প",
+  "ফ",
+  "ব",
+  "ভ",
+  "ম",
+  "য",
+  "র",
+  "ল",
+  "শ",
+  "ষ",
+  "স",
+  "হ",
+  "য়",
+  "ড়",
+  "ঢ়",
+  "ৎ",
+  "ঁ",
+  "ং",
+  "ঃ",
+  "্",
+};
+const char *ALPHA_34_DIGITS[] = {
+};
+const uint32_t ALPHA_34_UPPER_CPS[] = {
+  2433, 2434, 2435, 2437, 2438, 2439, 2440, 2441, 2442, 2443, 2447, 2448, 2451, 2452, 2453, 2454,
+  2455, 2456, 2457, 2458, 2459, 2460, 2461, 2462, 2463, 2464, 2465, 2466, 2467, 2468, 2469, 2470,
+  2471, 2472, 2474, 2475, 2476, 2477, 2478, 2479, 2480, 2482, 2486, 2487, 2488, 2489, 2509, 2510,
+  2524, 2525, 2527,
+};
+const uint32_t ALPHA_34_LOWER_CPS[] = {
+  2433, 2434, 2435, 2437, 2438, 2439, 2440, 2441, 2442, 2443, 2447, 2448, 2451, 2452, 2453, 2454,
+  2455, 2456, 2457, 2458, 2459, 2460, 2461, 2462, 2463, 2464, 2465, 2466, 2467, 2468, 2469, 2470,
+  2471, 2472, 2474, 2475, 2476, 2477, 2478, 2479, 2480, 2482, 2486, 2487, 2488, 2489, 2509, 2510,
+  2524, 2525, 2527,
+};
+const uint32_t ALPHA_34_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_34_FREQ[] = {
+  { "অ", 0.00680000 },
+  { "আ", 0.00550000 },
+  { "ই", 0.00860000 },
+  { "ঈ", 0.00010000 },
+  { "উ", 0.00430000 },
+  { "ঊ", 0.00000000 },
+  { "ঋ", 0.00000000 },
+  { "এ", 0.01270000 },
+  { "ঐ", 0.00020000 },
+  { "ও", 0.00520000 },
+  { "ঔ", 0.00000000 },
+  { "ক", 0.03950000 },
+  { "খ", 0.00520000 },
+  { "গ", 0.01080000 },
+  { "ঘ", 0.00120000 },
+  { "ঙ", 0.00140000 },
+  { "চ", 0.00750000 },
+  { "ছ", 0.00620000 },
+  { "জ", 0.01270000 },
+  { "ঝ", 0.00040000 },
+  { "ঞ", 0.00160000 },
+  { "ট", 0.01350000 },
+  { "ঠ", 0.00160000 },
+  { "ড", 0.00590000 },
+  { "ঢ", 0.00030000 },
+  { "ণ", 0.00510000 },
+  { "ত", 0.03540000 },
+  { "থ", 0.00680000 },
+  { "দ", 0.01740000 },
+  { "ধ", 0.00690000 },
+  { "ন", 0.04440000 },
+  { "প", 0.02270000 },
+  { "ফ", 0.00310000 },
+  { "ব", 0.03430000 },
+  { "ভ", 0.00720000 },
+  { "ম", 0.02510000 },
+  { "য", 0.03510000 },
+  { "র", 0.08450000 },
+  { "ল", 0.02560000 },
+  { "শ", 0.01230000 },
+  { "ষ", 0.00830000 },
+  { "স", 0.02950000 },
+  { "হ", 0.01510000 },
+  { "য়", 0.00000000 },
+  { "ড়", 0.00000000 },
+  { "ঢ়", 0.00000000 },
+  { "ৎ", 0.00080000 },
+  { "ঁ", 0.00160000 },
+  { "ং", 0.00720000 },
+  { "ঃ", 0.00040000 },
+  { "্", 0.06730000 },
+};
+
+const wa_cp_freq ALPHA_34_FREQ_CPS[] = {
+  { 0x981u, 0.00160000 },
+  { 0x982u, 0.00720000 },
+  { 0x983u, 0.00040000 },
+  { 0x985u, 0.00680000 },
+  { 0x986u, 0.00550000 },
+  { 0x987u, 0.00860000 },
+  { 0x988u, 0.00010000 },
+  { 0x989u, 0.00430000 },
+  { 0x98Au, 0.00000000 },
+  { 0x98Bu, 0.00000000 },
+  { 0x98Fu, 0.01270000 },
+  { 0x990u, 0.00020000 },
+  { 0x993u, 0.00520000 },
+  { 0x994u, 0.00000000 },
+  { 0x995u, 0.03950000 },
+  { 0x996u, 0.00520000 },
+  { 0x997u, 0.01080000 },
+  { 0x998u, 0.00120000 },
+  { 0x999u, 0.00140000 },
+  { 0x99Au, 0.00750000 },
+  { 0x99Bu, 0.00620000 },
+  { 0x99Cu, 0.01270000 },
+  { 0x99Du, 0.00040000 },
+  { 0x99Eu, 0.00160000 },
+  { 0x99Fu, 0.01350000 },
+  { 0x9A0u, 0.00160000 },
+  { 0x9A1u, 0.00590000 },
+  { 0x9A2u, 0.00030000 },
+  { 0x9A3u, 0.00510000 },
+  { 0x9A4u, 0.03540000 },
+  { 0x9A5u, 0.00680000 },
+  { 0x9A6u, 0.01740000 },
+  { 0x9A7u, 0.00690000 },
+  { 0x9A8u, 0.04440000 },
+  { 0x9AAu, 0.02270000 },
+  { 0x9ABu, 0.00310000 },
+  { 0x9ACu, 0.03430000 },
+  { 0x9ADu, 0.00720000 },
+  { 0x9AEu, 0.02510000 },
+  { 0x9AFu, 0.03510000 },
+  { 0x9B0u, 0.08450000 },
+  { 0x9B2u, 0.02560000 },
+  { 0x9B6u, 0.01230000 },
+  { 0x9B7u, 0.00830000 },
+  { 0x9B8u, 0.02950000 },
+  { 0x9B9u, 0.01510000 },
+  { 0x9CDu, 0.06730000 },
+  { 0x9CEu, 0.00080000 },
+  { 0x9DCu, 0.00000000 },
+  { 0x9DDu, 0.00000000 },
+  { 0x9DFu, 0.00000000 },
+};
+
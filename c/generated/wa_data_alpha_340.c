@@ -0,0 +1,219 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_340_UPPER[] = {
+  "꤀",
+  "꤁",
+  "꤂",
+  "꤃",
+  "꤄",
+  "꤅",
+  "꤆",
+  "꤇",
+  "꤈",
+  "꤉",
+  "ꤊ",
+  "ꤋ",
+  "ꤌ",
+  "ꤍ",
+  "ꤎ",
+  "ꤏ",
+  "ꤐ",
+  "ꤑ",
+  "ꤒ",
+  "ꤓ",
+  "ꤔ",
+  "ꤕ",
+  "ꤖ",
+  "ꤗ",
+  "ꤘ",
+  "ꤙ",
+  "ꤚ",
+  "ꤛ",
+  "ꤜ",
+  "ꤝ",
+  "ꤞ",
+  "ꤟ",
+  "ꤠ",
+  "ꤡ",
+  "ꤢ",
+  "ꤣ",
+  "ꤤ",
+  "ꤥ",
+  "ꤦ",
+  "ꤧ",
+  "ꤨ",
+  "ꤩ",
+  "ꤪ",
+  "꤫",
+  "꤬",
+  "꤭",
+  "꤮",
+  "꤯",
+};
+const char *ALPHA_340_LOWER[] = {
+  "꤀",
+  "꤁",
+  "꤂",
+  "꤃",
+  "꤄",
+  "꤅",
+  "꤆",
+  "꤇",
+  "꤈",
+  "꤉",
+  "ꤊ",
+  "ꤋ",
+  "ꤌ",
+  "ꤍ",
+  "ꤎ",
+  "ꤏ",
+  "ꤐ",
+  "ꤑ",
+  "ꤒ",
+  "ꤓ",
+  "ꤔ",
+  "ꤕ",
+  "ꤖ",
+  "ꤗ",
+  "ꤘ",
+  "ꤙ",
+  "ꤚ",
+  "ꤛ",
+  "ꤜ",
+  "ꤝ",
+  "ꤞ",
+  "ꤟ",
+  "ꤠ",
+  "ꤡ",
+  "ꤢ",
+  "ꤣ",
+  "ꤤ",
+  "ꤥ",
+  "ꤦ",
+  "ꤧ",
+  "ꤨ",
+  "ꤩ",
+  "ꤪ",
+  "꤫",
+  "꤬",
+  "꤭",
+  "꤮",
+  "꤯",
+};
+const char *ALPHA_340_DIGITS[] = {
+};
+const uint32_t ALPHA_340_UPPER_CPS[] = {
+  43264, 43265, 43266, 43267, 43268, 43269, 43270, 43271, 43272, 43273, 43274, 43275, 43276, 43277, 43278, 43279,
+  43280, 43281, 43282, 43283, 43284, 43285, 43286, 43287, 43288, 43289, 43290, 43291, 43292, 43293, 43294, 43295,
+  43296, 43297, 43298, 43299, 43300, 43301, 43302, 43303, 43304, 43305, 43306, 43307, 43308, 43309, 43310, 43311,
+};
+const uint32_t ALPHA_340_LOWER_CPS[] = {
+  43264, 43265, 43266, 43267, 43268, 43269, 43270, 43271, 43272, 43273, 43274, 43275, 43276, 43277, 43278, 43279,
+  43280, 43281, 43282, 43283, 43284, 43285, 43286, 43287, 43288, 43289, 43290, 43291, 43292, 43293, 43294, 43295,
+  43296, 43297, 43298, 43299, 43300, 43301, 43302, 43303, 43304, 43305, 43306, 43307, 43308, 43309, 43310, 43311,
+};
+const uint32_t ALPHA_340_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_340_FREQ[] = {
+  { "꤀", 0.00000000 },
+  { "꤁", 0.00000000 },
+  { "꤂", 0.00000000 },
+  { "꤃", 0.00000000 },
+  { "꤄", 0.00000000 },
+  { "꤅", 0.00000000 },
+  { "꤆", 0.00000000 },
+  { "꤇", 0.00000000 },
+  { "꤈", 0.00000000 },
+  { "꤉", 0.00000000 },
+  { "ꤊ", 0.00000000 },
+  { "ꤋ", 0.00000000 },
+  { "ꤌ", 0.00000000 },
+  { "ꤍ", 0.00000000 },
+  { "ꤎ", 0.00000000 },
+  { "ꤏ", 0.00000000 },
+  { "ꤐ", 0.00000000 },
+  { "ꤑ", 0.00000000 },
+  { "ꤒ", 0.00000000 },
+  { "ꤓ", 0.00000000 },
+  { "ꤔ", 0.00000000 },
+  { "ꤕ", 0.00000000 },
+  { "ꤖ", 0.00000000 },
+  { "ꤗ", 0.00000000 },
+  { "ꤘ", 0.00000000 },
+  { "ꤙ", 0.00000000 },
+  { "ꤚ", 0.00000000 },
+  { "ꤛ", 0.00000000 },
+  { "ꤜ", 0.00000000 },
+  { "ꤝ", 0.00000000 },
+  { "ꤞ", 0.00000000 },
+  { "ꤟ", 0.00000000 },
+  { "ꤠ", 0.00000000 },
+  { "ꤡ", 0.00000000 },
+  { "ꤢ", 0.00000000 },
+  { "ꤣ", 0.00000000 },
+  { "ꤤ", 0.00000000 },
+  { "ꤥ", 0.00000000 },
+  { "ꤦ", 0.00000000 },
+  { "ꤧ", 0.00000000 },
+  { "ꤨ", 0.00000000 },
+  { "ꤩ", 0.00000000 },
+  { "ꤪ", 0.00000000 },
+  { "꤫", 0.00000000 },
+  { "꤬", 0.00000000 },
+  { "꤭", 0.00000000 },
+  { "꤮", 0.00000000 },
+  { "꤯", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_340_FREQ_CPS[] = {
+  { 0xA900u, 0.00000000 },
+  { 0xA901u, 0.00000000 },
+  { 0xA902u, 0.00000000 },
+  { 0xA903u, 0.00000000 },
+  { 0xA904u, 0.00000000 },
+  { 0xA905u, 0.00000000 },
+  { 0xA906u, 0.00000000 },
+  { 0xA907u, 0.00000000 },
+  { 0xA908u, 0.00000000 },
+  { 0xA909u, 0.00000000 },
+  { 0xA90Au, 0.00000000 },
+  { 0xA90Bu, 0.00000000 },
+  { 0xA90Cu, 0.00000000 },
+  { 0xA90Du, 0.00000000 },
+  { 0xA90Eu, 0.00000000 },
+  { 0xA90Fu, 0.00000000 },
+  { 0xA910u, 0.00000000 },
+  { 0xA911u, 0.00000000 },
+  { 0xA912u, 0.00000000 },
+  { 0xA913u, 0.00000000 },
+  { 0xA914u, 0.00000000 },
+  { 0xA915u, 0.00000000 },
+  { 0xA916u, 0.00000000 },
+  { 0xA917u, 0.00000000 },
+  { 0xA918u, 0.00000000 },
+  { 0xA919u, 0.00000000 },
+  { 0xA91Au, 0.00000000 },
+  { 0xA91Bu, 0.00000000 },
+  { 0xA91Cu, 0.00000000 },
+  { 0xA91Du, 0.00000000 },
+  { 0xA91Eu, 0.00000000 },
+  { 0xA91Fu, 0.00000000 },
+  { 0xA920u, 0.00000000 },
+  { 0xA921u, 0.00000000 },
+  { 0xA922u, 0.00000000 },
+  { 0xA923u, 0.00000000 },
+  { 0xA924u, 0.00000000 },
+  { 0xA925u, 0.00000000 },
+  { 0xA926u, 0.00000000 },
+  { 0xA927u, 0.00000000 },
+  { 0xA928u, 0.00000000 },
+  { 0xA929u, 0.00000000 },
+  { 0xA92Au, 0.00000000 },
+  { 0xA92Bu, 0.00000000 },
+  { 0xA92Cu, 0.00000000 },
+  { 0xA92Du, 0.00000000 },
+  { 0xA92Eu, 0.00000000 },
+  { 0xA92Fu, 0.00000000 },
+};
+
@@ -0,0 +1,129 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_341_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+};
+const char *ALPHA_341_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+};
+const char *ALPHA_341_DIGITS[] = {
+};
+const uint32_t ALPHA_341_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90,
+};
+const uint32_t ALPHA_341_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122,
+};
+const uint32_t ALPHA_341_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_341_FREQ[] = {
+  { "a", 0.12680000 },
+  { "b", 0.02710000 },
+  { "c", 0.01120000 },
+  { "d", 0.02070000 },
+  { "e", 0.08290000 },
+  { "f", 0.01180000 },
+  { "g", 0.02790000 },
+  { "h", 0.04240000 },
+  { "i", 0.10880000 },
+  { "j", 0.00660000 },
+  { "k", 0.04480000 },
+  { "l", 0.05670000 },
+  { "m", 0.03750000 },
+  { "n", 0.08440000 },
+  { "o", 0.06190000 },
+  { "p", 0.01240000 },
+  { "q", 0.00380000 },
+  { "r", 0.02330000 },
+  { "s", 0.04280000 },
+  { "t", 0.03390000 },
+  { "u", 0.05890000 },
+  { "v", 0.00480000 },
+  { "w", 0.02380000 },
+  { "x", 0.00180000 },
+  { "y", 0.02030000 },
+  { "z", 0.02270000 },
+};
+
+const wa_cp_freq ALPHA_341_FREQ_CPS[] = {
+  { 0x61u, 0.12680000 },
+  { 0x62u, 0.02710000 },
+  { 0x63u, 0.01120000 },
+  { 0x64u, 0.02070000 },
+  { 0x65u, 0.08290000 },
+  { 0x66u, 0.01180000 },
+  { 0x67u, 0.02790000 },
+  { 0x68u, 0.04240000 },
+  { 0x69u, 0.10880000 },
+  { 0x6Au, 0.00660000 },
+  { 0x6Bu, 0.04480000 },
+  { 0x6Cu, 0.05670000 },
+  { 0x6Du, 0.03750000 },
+  { 0x6Eu, 0.08440000 },
+  { 0x6Fu, 0.06190000 },
+  { 0x70u, 0.01240000 },
+  { 0x71u, 0.00380000 },
+  { 0x72u, 0.02330000 },
+  { 0x73u, 0.04280000 },
+  { 0x74u, 0.03390000 },
+  { 0x75u, 0.05890000 },
+  { 0x76u, 0.00480000 },
+  { 0x77u, 0.02380000 },
+  { 0x78u, 0.00180000 },
+  { 0x79u, 0.02030000 },
+  { 0x7Au, 0.02270000 },
+};
+
@@ -0,0 +1,181 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_35_UPPER[] = {
+  "ཀ",
+  "ཁ",
+  "ག",
+  "ང",
+  "ཅ",
+  "ཆ",
+  "ཇ",
+  "ཉ",
+  "ཏ",
+  "ཐ",
+  "ད",
+  "ན",
+  "པ",
+  "ཕ",
+  "བ",
+  "མ",
+  "ཙ",
+  "ཚ",
+  "ཛ",
+  "ཝ",
+  "ཞ",
+  "ཟ",
+  "འ",
+  "ཡ",
+  "ར",
+  "ལ",
+  "ཤ",
+  "ས",
+  "ཧ",
+  "ཨ",
+  "ཊ",
+  "ཋ",
+  "ཌ",
+  "ཎ",
+  "ཥ",
+  "ཪ",
+};
+const char *ALPHA_35_LOWER[] = {
+  "ཀ",
+  "ཁ",
+  "ག",
+  "ང",
+  "ཅ",
+  "ཆ",
+  "ཇ",
+  "ཉ",
+  "ཏ",
+  "ཐ",
+  "ད",
+  "ན",
+  "པ",
+  "ཕ",
+  "བ",
+  "མ",
+  "ཙ",
+  "ཚ",
+  "ཛ",
+  "ཝ",
+  "ཞ",
+  "ཟ",
+  "འ",
+  "ཡ",
+  "ར",
+  "ལ",
+  "ཤ",
+  "ས",
+  "ཧ",
+  "ཨ",
+  "ཊ",
+  "ཋ",
+  "ཌ",
+  "ཎ",
+  "ཥ",
+  "ཪ",
+};
+const char *ALPHA_35_DIGITS[] = {
+  "༠",
+  "༡",
+  "༢",
+  "༣",
+  "༤",
+  "༥",
+  "༦",
+  "༧",
+  "༨",
+  "༩",
+};
+const uint32_t ALPHA_35_UPPER_CPS[] = {
+  3904, 3905, 3906, 3908, 3909, 3910, 3911, 3913, 3914, 3915, 3916, 3918, 3919, 3920, 3921, 3923,
+  3924, 3925, 3926, 3928, 3929, 3930, 3931, 3933, 3934, 3935, 3936, 3937, 3938, 3939, 3940, 3941,
+  3942, 3943, 3944, 3946,
+};
+const uint32_t ALPHA_35_LOWER_CPS[] = {
+  3904, 3905, 3906, 3908, 3909, 3910, 3911, 3913, 3914, 3915, 3916, 3918, 3919, 3920, 3921, 3923,
+  3924, 3925, 3926, 3928, 3929, 3930, 3931, 3933, 3934, 3935, 3936, 3937, 3938, 3939, 3940, 3941,
+  3942, 3943, 3944, 3946,
+};
+const uint32_t ALPHA_35_DIGITS_CPS[] = {
+  3872, 3873, 3874, 3875, 3876, 3877, 3878, 3879, 3880, 3881,
+};
+const wa_freq_entry ALPHA_35_FREQ[] = {
+  { "ཀ", 0.01570000 },
+  { "ཁ", 0.01550000 },
+  { "ག", 0.10020000 },
+  { "ང", 0.06770000 },
+  { "ཅ", 0.01010000 },
+  { "ཆ", 0.01460000 },
+  { "ཇ", 0.00340000 },
+  { "ཉ", 0.00690000 },
+  { "ཏ", 0.00800000 },
+  { "ཐ", 0.00960000 },
+  { "ད", 0.09340000 },
+  { "ན", 0.06530000 },
+  { "པ", 0.04250000 },
+  { "ཕ", 0.00970000 },
+  { "བ", 0.08410000 },
+  { "མ", 0.05600000 },
+  { "ཙ", 0.00370000 },
+  { "ཚ", 0.01120000 },
+  { "ཛ", 0.00410000 },
+  { "ཝ", 0.00050000 },
+  { "ཞ", 0.01590000 },
+  { "ཟ", 0.00730000 },
+  { "འ", 0.05250000 },
+  { "ཡ", 0.01770000 },
+  { "ར", 0.07760000 },
+  { "ལ", 0.05130000 },
+  { "ཤ", 0.00840000 },
+  { "ས", 0.14240000 },
+  { "ཧ", 0.00200000 },
+  { "ཨ", 0.00180000 },
+  { "ཊ", 0.00030000 },
+  { "ཋ", 0.00000000 },
+  { "ཌ", 0.00020000 },
+  { "ཎ", 0.00040000 },
+  { "ཥ", 0.00010000 },
+  { "ཪ", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_35_FREQ_CPS[] = {
+  { 0xF40u, 0.01570000 },
+  { 0xF41u, 0.01550000 },
+  { 0xF42u, 0.10020000 },
+  { 0xF44u, 0.06770000 },
+  { 0xF45u, 0.01010000 },
+  { 0xF46u, 0.01460000 },
+  { 0xF47u, 0.00340000 },
+  { 0xF49u, 0.00690000 },
+  { 0xF4Au, 0.00030000 },
+  { 0xF4Bu, 0.00000000 },
+  { 0xF4Cu, 0.00020000 },
+  { 0xF4Eu, 0.00040000 },
+  { 0xF4Fu, 0.00800000 },
+  { 0xF50u, 0.00960000 },
+  { 0xF51u, 0.09340000 },
+  { 0xF53u, 0.06530000 },
+  { 0xF54u, 0.04250000 },
+  { 0xF55u, 0.00970000 },
+  { 0xF56u, 0.08410000 },
+  { 0xF58u, 0.05600000 },
+  { 0xF59u, 0.00370000 },
+  { 0xF5Au, 0.01120000 },
+  { 0xF5Bu, 0.00410000 },
+  { 0xF5Du, 0.00050000 },
+  { 0xF5Eu, 0.01590000 },
+  { 0xF5Fu, 0.00730000 },
+  { 0xF60u, 0.05250000 },
+  { 0xF61u, 0.01770000 },
+  { 0xF62u, 0.07760000 },
+  { 0xF63u, 0.05130000 },
+  { 0xF64u, 0.00840000 },
+  { 0xF65u, 0.00010000 },
+  { 0xF66u, 0.14240000 },
+  { 0xF67u, 0.00200000 },
+  { 0xF68u, 0.00180000 },
+  { 0xF6Au, 0.00000000 },
+};
+
@@ -0,0 +1,133 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_36_UPPER[] = {
+  "A",
+  "B",
+  "D",
+  "E",
+  "Ê",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "Ñ",
+  "O",
+  "P",
+  "R",
+  "S",
+  "T",
+  "U",
+  "Ù",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+};
+const char *ALPHA_36_LOWER[] = {
+  "a",
+  "b",
+  "d",
+  "e",
+  "ê",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "ñ",
+  "o",
+  "p",
+  "r",
+  "s",
+  "t",
+  "u",
+  "ù",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+};
+const char *ALPHA_36_DIGITS[] = {
+};
+const uint32_t ALPHA_36_UPPER_CPS[] = {
+  65, 66, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 82,
+  83, 84, 85, 86, 87, 88, 89, 90, 202, 209, 217,
+};
+const uint32_t ALPHA_36_LOWER_CPS[] = {
+  97, 98, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 114,
+  115, 116, 117, 118, 119, 120, 121, 122, 234, 241, 249,
+};
+const uint32_t ALPHA_36_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_36_FREQ[] = {
+  { "o", 0.06670000 },
+  { "t", 0.05140000 },
+  { "u", 0.03910000 },
+  { "s", 0.03670000 },
+  { "k", 0.02100000 },
+  { "j", 0.00350000 },
+  { "w", 0.00680000 },
+  { "m", 0.02520000 },
+  { "a", 0.12800000 },
+  { "h", 0.03580000 },
+  { "r", 0.08000000 },
+  { "p", 0.01500000 },
+  { "d", 0.04140000 },
+  { "i", 0.05430000 },
+  { "ê", 0.00090000 },
+  { "z", 0.03150000 },
+  { "ù", 0.00700000 },
+  { "e", 0.14630000 },
+  { "ñ", 0.00780000 },
+  { "v", 0.02530000 },
+  { "y", 0.00390000 },
+  { "n", 0.07580000 },
+  { "b", 0.01880000 },
+  { "f", 0.00590000 },
+  { "l", 0.04330000 },
+  { "x", 0.00100000 },
+  { "g", 0.02760000 },
+};
+
+const wa_cp_freq ALPHA_36_FREQ_CPS[] = {
+  { 0x61u, 0.12800000 },
+  { 0x62u, 0.01880000 },
+  { 0x64u, 0.04140000 },
+  { 0x65u, 0.14630000 },
+  { 0x66u, 0.00590000 },
+  { 0x67u, 0.02760000 },
+  { 0x68u, 0.03580000 },
+  { 0x69u, 0.05430000 },
+  { 0x6Au, 0.00350000 },
+  { 0x6Bu, 0.02100000 },
+  { 0x6Cu, 0.04330000 },
+  { 0x6Du, 0.02520000 },
+  { 0x6Eu, 0.07580000 },
+  { 0x6Fu, 0.06670000 },
+  { 0x70u, 0.01500000 },
+  { 0x72u, 0.08000000 },
+  { 0x73u, 0.03670000 },
+  { 0x74u, 0.05140000 },
+  { 0x75u, 0.03910000 },
+  { 0x76u, 0.02530000 },
+  { 0x77u, 0.00680000 },
+  { 0x78u, 0.00100000 },
+  { 0x79u, 0.00390000 },
+  { 0x7Au, 0.03150000 },
+  { 0xEAu, 0.00090000 },
+  { 0xF1u, 0.00780000 },
+  { 0xF9u, 0.00700000 },
+};
+
@@ -0,0 +1,153 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_38_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+  "É",
+  "Ć",
+  "Č",
+  "Đ",
+  "Š",
+  "Ž",
+};
+const char *ALPHA_38_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+  "é",
+  "ć",
+  "č",
+  "đ",
+  "š",
+  "ž",
+};
+const char *ALPHA_38_DIGITS[] = {
+};
+const uint32_t ALPHA_38_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 201, 262, 268, 272, 352, 381,
+};
+const uint32_t ALPHA_38_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 233, 263, 269, 273, 353, 382,
+};
+const uint32_t ALPHA_38_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_38_FREQ[] = {
+  { "d", 0.03320000 },
+  { "r", 0.05420000 },
+  { "ž", 0.00460000 },
+  { "w", 0.00080000 },
+  { "n", 0.06590000 },
+  { "c", 0.01080000 },
+  { "o", 0.08910000 },
+  { "m", 0.03180000 },
+  { "đ", 0.00210000 },
+  { "p", 0.02790000 },
+  { "l", 0.03510000 },
+  { "v", 0.03310000 },
+  { "s", 0.04890000 },
+  { "y", 0.00100000 },
+  { "t", 0.04370000 },
+  { "q", 0.00010000 },
+  { "č", 0.00870000 },
+  { "f", 0.00430000 },
+  { "ć", 0.00430000 },
+  { "x", 0.00030000 },
+  { "b", 0.01530000 },
+  { "h", 0.00900000 },
+  { "u", 0.04260000 },
+  { "a", 0.11430000 },
+  { "e", 0.08860000 },
+  { "k", 0.03680000 },
+  { "š", 0.00690000 },
+  { "z", 0.01690000 },
+  { "i", 0.09890000 },
+  { "g", 0.01870000 },
+  { "é", 0.00010000 },
+  { "j", 0.05150000 },
+};
+
+const wa_cp_freq ALPHA_38_FREQ_CPS[] = {
+  { 0x61u, 0.11430000 },
+  { 0x62u, 0.01530000 },
+  { 0x63u, 0.01080000 },
+  { 0x64u, 0.03320000 },
+  { 0x65u, 0.08860000 },
+  { 0x66u, 0.00430000 },
+  { 0x67u, 0.01870000 },
+  { 0x68u, 0.00900000 },
+  { 0x69u, 0.09890000 },
+  { 0x6Au, 0.05150000 },
+  { 0x6Bu, 0.03680000 },
+  { 0x6Cu, 0.03510000 },
+  { 0x6Du, 0.03180000 },
+  { 0x6Eu, 0.06590000 },
+  { 0x6Fu, 0.08910000 },
+  { 0x70u, 0.02790000 },
+  { 0x71u, 0.00010000 },
+  { 0x72u, 0.05420000 },
+  { 0x73u, 0.04890000 },
+  { 0x74u, 0.04370000 },
+  { 0x75u, 0.04260000 },
+  { 0x76u, 0.03310000 },
+  { 0x77u, 0.00080000 },
+  { 0x78u, 0.00030000 },
+  { 0x79u, 0.00100000 },
+  { 0x7Au, 0.01690000 },
+  { 0xE9u, 0.00010000 },
+  { 0x107u, 0.00430000 },
+  { 0x10Du, 0.00870000 },
+  { 0x111u, 0.00210000 },
+  { 0x161u, 0.00690000 },
+  { 0x17Eu, 0.00460000 },
+};
+
@@ -0,0 +1,229 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_39_UPPER[] = {
+  "A",
+  "Á",
+  "Â",
+  "Ǎ",
+  "Ā",
+  "B",
+  "C",
+  "D",
+  "E",
+  "É",
+  "Ê",
+  "Ě",
+  "Ē",
+  "Ə",
+  "Ɛ",
+  "G",
+  "H",
+  "I",
+  "Í",
+  "Î",
+  "Ǐ",
+  "Ī",
+  "J",
+  "K",
+  "L",
+  "M",
+  "Ḿ",
+  "N",
+  "Ń",
+  "Ŋ",
+  "O",
+  "Ó",
+  "Ô",
+  "Ǒ",
+  "Ō",
+  "Ɔ",
+  "P",
+  "S",
+  "T",
+  "U",
+  "Ú",
+  "Û",
+  "Ǔ",
+  "Ū",
+  "W",
+  "Y",
+  "Z",
+  "ʼ",
+};
+const char *ALPHA_39_LOWER[] = {
+  "a",
+  "á",
+  "â",
+  "ǎ",
+  "ā",
+  "b",
+  "c",
+  "d",
+  "e",
+  "é",
+  "ê",
+  "ě",
+  "ē",
+  "ə",
+  "ɛ",
+  "g",
+  "h",
+  "i",
+  "í",
+  "î",
+  "ǐ",
+  "ī",
+  "j",
+  "k",
+  "l",
+  "m",
+  "ḿ",
+  "n",
+  "ń",
+  "ŋ",
+  "o",
+  "ó",
+  "ô",
+  "ǒ",
+  "ō",
+  "ɔ",
+  "p",
+  "s",
+  "t",
+  "u",
+  "ú",
+  "û",
+  "ǔ",
+  "ū",
+  "w",
+  "y",
+  "z",
+  "ʼ",
+};
+const char *ALPHA_39_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_39_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 83,
+  84, 85, 87, 89, 90, 193, 194, 201, 202, 205, 206, 211, 212, 218, 219, 256,
+  274, 282, 298, 323, 330, 332, 362, 390, 399, 400, 461, 463, 465, 467, 700, 7742,
+};
+const uint32_t ALPHA_39_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 115,
+  116, 117, 119, 121, 122, 225, 226, 233, 234, 237, 238, 243, 244, 250, 251, 257,
+  275, 283, 299, 324, 331, 333, 363, 462, 464, 466, 468, 596, 601, 603, 700, 7743,
+};
+const uint32_t ALPHA_39_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_39_FREQ[] = {
+  { "a", 0.00000000 },
+  { "á", 0.00000000 },
+  { "â", 0.00000000 },
+  { "ǎ", 0.00000000 },
+  { "ā", 0.00000000 },
+  { "b", 0.00000000 },
+  { "c", 0.00000000 },
+  { "d", 0.00000000 },
+  { "e", 0.00000000 },
+  { "é", 0.00000000 },
+  { "ê", 0.00000000 },
+  { "ě", 0.00000000 },
+  { "ē", 0.00000000 },
+  { "ə", 0.00000000 },
+  { "ɛ", 0.00000000 },
+  { "g", 0.00000000 },
+  { "h", 0.00000000 },
+  { "i", 0.00000000 },
+  { "í", 0.00000000 },
+  { "î", 0.00000000 },
+  { "ǐ", 0.00000000 },
+  { "ī", 0.00000000 },
+  { "j", 0.00000000 },
+  { "k", 0.00000000 },
+  { "l", 0.00000000 },
+  { "m", 0.00000000 },
+  { "ḿ", 0.00000000 },
+  { "n", 0.00000000 },
+  { "ń", 0.00000000 },
+  { "ŋ", 0.00000000 },
+  { "o", 0.00000000 },
+  { "ó", 0.00000000 },
+  { "ô", 0.00000000 },
+  { "ǒ", 0.00000000 },
+  { "ō", 0.00000000 },
+  { "ɔ", 0.00000000 },
+  { "p", 0.00000000 },
+  { "s", 0.00000000 },
+  { "t", 0.00000000 },
+  { "u", 0.00000000 },
+  { "ú", 0.00000000 },
+  { "û", 0.00000000 },
+  { "ǔ", 0.00000000 },
+  { "ū", 0.00000000 },
+  { "w", 0.00000000 },
+  { "y", 0.00000000 },
+  { "z", 0.00000000 },
+  { "ʼ", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_39_FREQ_CPS[] = {
+  { 0x61u, 0.00000000 },
+  { 0x62u, 0.00000000 },
+  { 0x63u, 0.00000000 },
+  { 0x64u, 0.00000000 },
+  { 0x65u, 0.00000000 },
+  { 0x67u, 0.00000000 },
+  { 0x68u, 0.00000000 },
+  { 0x69u, 0.00000000 },
+  { 0x6Au, 0.00000000 },
+  { 0x6Bu, 0.00000000 },
+  { 0x6Cu, 0.00000000 },
+  { 0x6Du, 0.00000000 },
+  { 0x6Eu, 0.00000000 },
+  { 0x6Fu, 0.00000000 },
+  { 0x70u, 0.00000000 },
+  { 0x73u, 0.00000000 },
+  { 0x74u, 0.00000000 },
+  { 0x75u, 0.00000000 },
+  { 0x77u, 0.00000000 },
+  { 0x79u, 0.00000000 },
+  { 0x7Au, 0.00000000 },
+  { 0xE1u, 0.00000000 },
+  { 0xE2u, 0.00000000 },
+  { 0xE9u, 0.00000000 },
+  { 0xEAu, 0.00000000 },
+  { 0xEDu, 0.00000000 },
+  { 0xEEu, 0.00000000 },
+  { 0xF3u, 0.00000000 },
+  { 0xF4u, 0.00000000 },
+  { 0xFAu, 0.00000000 },
+  { 0xFBu, 0.00000000 },
+  { 0x101u, 0.00000000 },
+  { 0x113u, 0.00000000 },
+  { 0x11Bu, 0.00000000 },
+  { 0x12Bu, 0.00000000 },
+  { 0x144u, 0.00000000 },
+  { 0x14Bu, 0.00000000 },
+  { 0x14Du, 0.00000000 },
+  { 0x16Bu, 0.00000000 },
+  { 0x1CEu, 0.00000000 },
+  { 0x1D0u, 0.00000000 },
+  { 0x1D2u, 0.00000000 },
+  { 0x1D4u, 0.00000000 },
+  { 0x254u, 0.00000000 },
+  { 0x259u, 0.00000000 },
+  { 0x25Bu, 0.00000000 },
+  { 0x2BCu, 0.00000000 },
+  { 0x1E3Fu, 0.00000000 },
+};
+
@@ -0,0 +1,229 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_4_UPPER[] = {
+  "A",
+  "À",
+  "Â",
+  "Ǎ",
+  "Ā",
+  "B",
+  "C",
+  "D",
+  "E",
+  "È",
+  "Ê",
+  "Ě",
+  "Ē",
+  "Ɛ",
+  "F",
+  "G",
+  "H",
+  "I",
+  "Ì",
+  "Î",
+  "Ǐ",
+  "Ī",
+  "Ɨ",
+  "K",
+  "L",
+  "M",
+  "N",
+  "Ŋ",
+  "O",
+  "Ò",
+  "Ô",
+  "Ǒ",
+  "Ō",
+  "Ɔ",
+  "P",
+  "S",
+  "T",
+  "U",
+  "Ù",
+  "Û",
+  "Ǔ",
+  "Ū",
+  "Ʉ",
+  "V",
+  "W",
+  "Y",
+  "Z",
+  "ʔ",
+};
+const char *ALPHA_4_LOWER[] = {
+  "a",
+  "à",
+  "â",
+  "ǎ",
+  "ā",
+  "b",
+  "c",
+  "d",
+  "e",
+  "è",
+  "ê",
+  "ě",
+  "ē",
+  "ɛ",
+  "f",
+  "g",
+  "h",
+  "i",
+  "ì",
+  "î",
+  "ǐ",
+  "ī",
+  "ɨ",
+  "k",
+  "l",
+  "m",
+  "n",
+  "ŋ",
+  "o",
+  "ò",
+  "ô",
+  "ǒ",
+  "ō",
+  "ɔ",
+  "p",
+  "s",
+  "t",
+  "u",
+  "ù",
+  "û",
+  "ǔ",
+  "ū",
+  "ʉ",
+  "v",
+  "w",
+  "y",
+  "z",
+  "ʔ",
+};
+const char *ALPHA_4_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_4_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 75, 76, 77, 78, 79, 80, 83,
+  84, 85, 86, 87, 89, 90, 192, 194, 200, 202, 204, 206, 210, 212, 217, 219,
+  256, 274, 282, 298, 330, 332, 362, 390, 400, 407, 461, 463, 465, 467, 580, 660,
+};
+const uint32_t ALPHA_4_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 107, 108, 109, 110, 111, 112, 115,
+  116, 117, 118, 119, 121, 122, 224, 226, 232, 234, 236, 238, 242, 244, 249, 251,
+  257, 275, 283, 299, 331, 333, 363, 462, 464, 466, 468, 596, 603, 616, 649, 660,
+};
+const uint32_t ALPHA_4_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_4_FREQ[] = {
+  { "a", 0.00000000 },
+  { "à", 0.00000000 },
+  { "â", 0.00000000 },
+  { "ǎ", 0.00000000 },
+  { "ā", 0.00000000 },
+  { "b", 0.00000000 },
+  { "c", 0.00000000 },
+  { "d", 0.00000000 },
+  { "e", 0.00000000 },
+  { "è", 0.00000000 },
+  { "ê", 0.00000000 },
+  { "ě", 0.00000000 },
+  { "ē", 0.00000000 },
+  { "ɛ", 0.00000000 },
+  { "f", 0.00000000 },
+  { "g", 0.00000000 },
+  { "h", 0.00000000 },
+  { "i", 0.00000000 },
+  { "ì", 0.00000000 },
+  { "î", 0.00000000 },
+  { "ǐ", 0.00000000 },
+  { "ī", 0.00000000 },
+  { "ɨ", 0.00000000 },
+  { "k", 0.00000000 },
+  { "l", 0.00000000 },
+  { "m", 0.00000000 },
+  { "n", 0.00000000 },
+  { "ŋ", 0.00000000 },
+  { "o", 0.00000000 },
+  { "ò", 0.00000000 },
+  { "ô", 0.00000000 },
+  { "ǒ", 0.00000000 },
+  { "ō", 0.00000000 },
+  { "ɔ", 0.00000000 },
+  { "p", 0.00000000 },
+  { "s", 0.00000000 },
+  { "t", 0.00000000 },
+  { "u", 0.00000000 },
+  { "ù", 0.00000000 },
+  { "û", 0.00000000 },
+  { "ǔ", 0.00000000 },
+  { "ū", 0.00000000 },
+  { "ʉ", 0.00000000 },
+  { "v", 0.00000000 },
+  { "w", 0.00000000 },
+  { "y", 0.00000000 },
+  { "z", 0.00000000 },
+  { "ʔ", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_4_FREQ_CPS[] = {
+  { 0x61u, 0.00000000 },
+  { 0x62u, 0.00000000 },
+  { 0x63u, 0.00000000 },
+  { 0x64u, 0.00000000 },
+  { 0x65u, 0.00000000 },
+  { 0x66u, 0.00000000 },
+  { 0x67u, 0.00000000 },
+  { 0x68u, 0.00000000 },
+  { 0x69u, 0.00000000 },
+  { 0x6Bu, 0.00000000 },
+  { 0x6Cu, 0.00000000 },
+  { 0x6Du, 0.00000000 },
+  { 0x6Eu, 0.00000000 },
+  { 0x6Fu, 0.00000000 },
+  { 0x70u, 0.00000000 },
+  { 0x73u, 0.00000000 },
+  { 0x74u, 0.00000000 },
+  { 0x75u, 0.00000000 },
+  { 0x76u, 0.00000000 },
+  { 0x77u, 0.00000000 },
+  { 0x79u, 0.00000000 },
+  { 0x7Au, 0.00000000 },
+  { 0xE0u, 0.00000000 },
+  { 0xE2u, 0.00000000 },
+  { 0xE8u, 0.00000000 },
+  { 0xEAu, 0.00000000 },
+  { 0xECu, 0.00000000 },
+  { 0xEEu, 0.00000000 },
+  { 0xF2u, 0.00000000 },
+  { 0xF4u, 0.00000000 },
+  { 0xF9u, 0.00000000 },
+  { 0xFBu, 0.00000000 },
+  { 0x101u, 0.00000000 },
+  { 0x113u, 0.00000000 },
+  { 0x11Bu, 0.00000000 },
+  { 0x12Bu, 0.00000000 },
+  { 0x14Bu, 0.00000000 },
+  { 0x14Du, 0.00000000 },
+  { 0x16Bu, 0.00000000 },
+  { 0x1CEu, 0.00000000 },
+  { 0x1D0u, 0.00000000 },
+  { 0x1D2u, 0.00000000 },
+  { 0x1D4u, 0.00000000 },
+  { 0x254u, 0.00000000 },
+  { 0x25Bu, 0.00000000 },
+  { 0x268u, 0.00000000 },
+  { 0x289u, 0.00000000 },
+  { 0x294u, 0.00000000 },
+};
+
@@ -0,0 +1,145 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_40_UPPER[] = {
+  "ᨀ",
+  "ᨁ",
+  "ᨂ",
+  "ᨃ",
+  "ᨄ",
+  "ᨅ",
+  "ᨆ",
+  "ᨇ",
+  "ᨈ",
+  "ᨉ",
+  "ᨊ",
+  "ᨋ",
+  "ᨌ",
+  "ᨍ",
+  "ᨎ",
+  "ᨏ",
+  "ᨐ",
+  "ᨑ",
+  "ᨒ",
+  "ᨓ",
+  "ᨔ",
+  "ᨕ",
+  "ᨖ",
+  "ᨗ",
+  "ᨘ",
+  "ᨙ",
+  "ᨚ",
+  "ᨛ",
+  "᨞",
+  "᨟",
+};
+const char *ALPHA_40_LOWER[] = {
+  "ᨀ",
+  "ᨁ",
+  "ᨂ",
+  "ᨃ",
+  "ᨄ",
+  "ᨅ",
+  "ᨆ",
+  "ᨇ",
+  "ᨈ",
+  "ᨉ",
+  "ᨊ",
+  "ᨋ",
+  "ᨌ",
+  "ᨍ",
+  "ᨎ",
+  "ᨏ",
+  "ᨐ",
+  "ᨑ",
+  "ᨒ",
+  "ᨓ",
+  "ᨔ",
+  "ᨕ",
+  "ᨖ",
+  "ᨗ",
+  "ᨘ",
+  "ᨙ",
+  "ᨚ",
+  "ᨛ",
+  "᨞",
+  "᨟",
+};
+const char *ALPHA_40_DIGITS[] = {
+};
+const uint32_t ALPHA_40_UPPER_CPS[] = {
+  6656, 6657, 6658, 6659, 6660, 6661, 6662, 6663, 6664, 6665, 6666, 6667, 6668, 6669, 6670, 6671,
+  6672, 6673, 6674, 6675, 6676, 6677, 6678, 6679, 6680, 6681, 6682, 6683, 6686, 6687,
+};
+const uint32_t ALPHA_40_LOWER_CPS[] = {
+  6656, 6657, 6658, 6659, 6660, 6661, 6662, 6663, 6664, 6665, 6666, 6667, 6668, 6669, 6670, 6671,
+  6672, 6673, 6674, 6675, 6676, 6677, 6678, 6679, 6680, 6681, 6682, 6683, 6686, 6687,
+};
+const uint32_t ALPHA_40_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_40_FREQ[] = {
+  { "ᨀ", 0.00010000 },
+  { "ᨁ", 0.00000000 },
+  { "ᨂ", 0.00000000 },
+  { "ᨃ", 0.00000000 },
+  { "ᨄ", 0.00010000 },
+  { "ᨅ", 0.00010000 },
+  { "ᨆ", 0.00010000 },
+  { "ᨇ", 0.00000000 },
+  { "ᨈ", 0.00010000 },
+  { "ᨉ", 0.00000000 },
+  { "ᨊ", 0.00010000 },
+  { "ᨋ", 0.00000000 },
+  { "ᨌ", 0.00000000 },
+  { "ᨍ", 0.00000000 },
+  { "ᨎ", 0.00000000 },
+  { "ᨏ", 0.00000000 },
+  { "ᨐ", 0.00000000 },
+  { "ᨑ", 0.00010000 },
+  { "ᨒ", 0.00010000 },
+  { "ᨓ", 0.00000000 },
+  { "ᨔ", 0.00020000 },
+  { "ᨕ", 0.00030000 },
+  { "ᨖ", 0.00000000 },
+  { "ᨗ", 0.00030000 },
+  { "ᨘ", 0.00010000 },
+  { "ᨙ", 0.00010000 },
+  { "ᨚ", 0.00010000 },
+  { "ᨛ", 0.00020000 },
+  { "᨞", 0.00000000 },
+  { "᨟", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_40_FREQ_CPS[] = {
+  { 0x1A00u, 0.00010000 },
+  { 0x1A01u, 0.00000000 },
+  { 0x1A02u, 0.00000000 },
+  { 0x1A03u, 0.00000000 },
+  { 0x1A04u, 0.00010000 },
+  { 0x1A05u, 0.00010000 },
+  { 0x1A06u, 0.00010000 },
+  { 0x1A07u, 0.00000000 },
+  { 0x1A08u, 0.00010000 },
+  { 0x1A09u, 0.00000000 },
+  { 0x1A0Au, 0.00010000 },
+  { 0x1A0Bu, 0.00000000 },
+  { 0x1A0Cu, 0.00000000 },
+  { 0x1A0Du, 0.00000000 },
+  { 0x1A0Eu, 0.00000000 },
+  { 0x1A0Fu, 0.00000000 },
+  { 0x1A10u, 0.00000000 },
+  { 0x1A11u, 0.00010000 },
+  { 0x1A12u, 0.00010000 },
+  { 0x1A13u, 0.00000000 },
+  { 0x1A14u, 0.00020000 },
+  { 0x1A15u, 0.00030000 },
+  { 0x1A16u, 0.00000000 },
+  { 0x1A17u, 0.00030000 },
+  { 0x1A18u, 0.00010000 },
+  { 0x1A19u, 0.00010000 },
+  { 0x1A1Au, 0.00010000 },
+  { 0x1A1Bu, 0.00020000 },
+  { 0x1A1Eu, 0.00000000 },
+  { 0x1A1Fu, 0.00000000 },
+};
+
@@ -0,0 +1,237 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_41_UPPER[] = {
+  "ᯀ",
+  "ᯁ",
+  "ᯂ",
+  "ᯃ",
+  "ᯄ",
+  "ᯅ",
+  "ᯆ",
+  "ᯇ",
+  "ᯈ",
+  "ᯉ",
+  "ᯊ",
+  "ᯋ",
+  "ᯌ",
+  "ᯍ",
+  "ᯎ",
+  "ᯏ",
+  "ᯐ",
+  "ᯑ",
+  "ᯒ",
+  "ᯓ",
+  "ᯔ",
+  "ᯕ",
+  "ᯖ",
+  "ᯗ",
+  "ᯘ",
+  "ᯙ",
+  "ᯚ",
+  "ᯛ",
+  "ᯜ",
+  "ᯝ",
+  "ᯞ",
+  "ᯟ",
+  "ᯠ",
+  "ᯡ",
+  "ᯢ",
+  "ᯣ",
+  "ᯤ",
+  "ᯥ",
+  "᯦",
+  "ᯧ",
+  "ᯨ",
+  "ᯩ",
+  "ᯪ",
+  "ᯫ",
+  "ᯬ",
+  "ᯭ",
+  "ᯮ",
+  "ᯯ",
+  "ᯰ",
+  "ᯱ",
+  "᯲",
+  "᯳",
+};
+const char *ALPHA_41_LOWER[] = {
+  "ᯀ",
+  "ᯁ",
+  "ᯂ",
+  "ᯃ",
+  "ᯄ",
+  "ᯅ",
+  "ᯆ",
+  "ᯇ",
+  "ᯈ",
+  "ᯉ",
+  "ᯊ",
+  "ᯋ",
+  "ᯌ",
+  "ᯍ",
+  "ᯎ",
+  "ᯏ",
+  "ᯐ",
+  "ᯑ",
+  "ᯒ",
+  "ᯓ",
+  "ᯔ",
+  "ᯕ",
+  "ᯖ",
+  "ᯗ",
+  "ᯘ",
+  "ᯙ",
+  "ᯚ",
+  "ᯛ",
+  "ᯜ",
+  "ᯝ",
+  "ᯞ",
+  "ᯟ",
+  "ᯠ",
+  "ᯡ",
+  "ᯢ",
+  "ᯣ",
+  "ᯤ",
+  "ᯥ",
+  "᯦",
+  "ᯧ",
+  "ᯨ",
+  "ᯩ",
+  "ᯪ",
+  "ᯫ",
+  "ᯬ",
+  "ᯭ",
+  "ᯮ",
+  "ᯯ",
+  "ᯰ",
+  "ᯱ",
+  "᯲",
+  "᯳",
+};
+const char *ALPHA_41_DIGITS[] = {
+};
+const uint32_t ALPHA_41_UPPER_CPS[] = {
+  7104, 7105, 7106, 7107, 7108, 7109, 7110, 7111, 7112, 7113, 7114, 7115, 7116, 7117, 7118, 7119,
+  7120, 7121, 7122, 7123, 7124, 7125, 7126, 7127, 7128, 7129, 7130, 7131, 7132, 7133, 7134, 7135,
+  7136, 7137, 7138, 7139, 7140, 7141, 7142, 7143, 7144, 7145, 7146, 7147, 7148, 7149, 7150, 7151,
+  7152, 7153, 7154, 7155,
+};
+const uint32_t ALPHA_41_LOWER_CPS[] = {
+  7104, 7105, 7106, 7107, 7108, 7109, 7110, 7111, 7112, 7113, 7114, 7115, 7116, 7117, 7118, 7119,
+  7120, 7121, 7122, 7123, 7124, 7125, 7126, 7127, 7128, 7129, 7130, 7131, 7132, 7133, 7134, 7135,
+  7136, 7137, 7138, 7139, 7140, 7141, 7142, 7143, 7144, 7145, 7146, 7147, 7148, 7149, 7150, 7151,
+  7152, 7153, 7154, 7155,
+};
+const uint32_t ALPHA_41_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_41_FREQ[] = {
+  { "ᯀ", 0.00000000 },
+  { "ᯁ", 0.00000000 },
+  { "ᯂ", 0.00000000 },
+  { "ᯃ", 0.00000000 },
+  { "ᯄ", 0.00000000 },
+  { "ᯅ", 0.00000000 },
+  { "ᯆ", 0.00000000 },
+  { "ᯇ", 0.00000000 },
+  { "ᯈ", 0.00000000 },
+  { "ᯉ", 0.00000000 },
+  { "ᯊ", 0.00000000 },
+  { "ᯋ", 0.00000000 },
+  { "ᯌ", 0.00000000 },
+  { "ᯍ", 0.00000000 },
+  { "ᯎ", 0.00000000 },
+  { "ᯏ", 0.00000000 },
+  { "ᯐ", 0.00000000 },
+  { "ᯑ", 0.00000000 },
+  { "ᯒ", 0.00000000 },
+  { "ᯓ", 0.00000000 },
+  { "ᯔ", 0.00000000 },
+  { "ᯕ", 0.00000000 },
+  { "ᯖ", 0.00000000 },
+  { "ᯗ", 0.00000000 },
+  { "ᯘ", 0.00000000 },
+  { "ᯙ", 0.00000000 },
+  { "ᯚ", 0.00000000 },
+  { "ᯛ", 0.00000000 },
+  { "ᯜ", 0.00000000 },
+  { "ᯝ", 0.00000000 },
+  { "ᯞ", 0.00000000 },
+  { "ᯟ", 0.00000000 },
+  { "ᯠ", 0.00000000 },
+  { "ᯡ", 0.00000000 },
+  { "ᯢ", 0.00000000 },
+  { "ᯣ", 0.00000000 },
+  { "ᯤ", 0.00000000 },
+  { "ᯥ", 0.00000000 },
+  { "᯦", 0.00000000 },
+  { "ᯧ", 0.00000000 },
+  { "ᯨ", 0.00000000 },
+  { "ᯩ", 0.00000000 },
+  { "ᯪ", 0.00000000 },
+  { "ᯫ", 0.00000000 },
+  { "ᯬ", 0.00000000 },
+  { "ᯭ", 0.00000000 },
+  { "ᯮ", 0.00000000 },
+  { "ᯯ", 0.00000000 },
+  { "ᯰ", 0.00000000 },
+  { "ᯱ", 0.00000000 },
+  { "᯲", 0.00000000 },
+  { "᯳", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_41_FREQ_CPS[] = {
+  { 0x1BC0u, 0.00000000 },
+  { 0x1BC1u, 0.00000000 },
+  { 0x1BC2u, 0.00000000 },
+  { 0x1BC3u, 0.00000000 },
+  { 0x1BC4u, 0.00000000 },
+  { 0x1BC5u, 0.00000000 },
+  { 0x1BC6u, 0.00000000 },
+  { 0x1BC7u, 0.00000000 },
+  { 0x1BC8u, 0.00000000 },
+  { 0x1BC9u, 0.00000000 },
+  { 0x1BCAu, 0.00000000 },
+  { 0x1BCBu, 0.00000000 },
+  { 0x1BCCu, 0.00000000 },
+  { 0x1BCDu, 0.00000000 },
+  { 0x1BCEu, 0.00000000 },
+  { 0x1BCFu, 0.00000000 },
+  { 0x1BD0u, 0.00000000 },
+  { 0x1BD1u, 0.00000000 },
+  { 0x1BD2u, 0.00000000 },
+  { 0x1BD3u, 0.00000000 },
+  { 0x1BD4u, 0.00000000 },
+  { 0x1BD5u, 0.00000000 },
+  { 0x1BD6u, 0.00000000 },
+  { 0x1BD7u, 0.00000000 },
+  { 0x1BD8u, 0.00000000 },
+  { 0x1BD9u, 0.00000000 },
+  { 0x1BDAu, 0.00000000 },
+  { 0x1BDBu, 0.00000000 },
+  { 0x1BDCu, 0.00000000 },
+  { 0x1BDDu, 0.00000000 },
+  { 0x1BDEu, 0.00000000 },
+  { 0x1BDFu, 0.00000000 },
+  { 0x1BE0u, 0.00000000 },
+  { 0x1BE1u, 0.00000000 },
+  { 0x1BE2u, 0.00000000 },
+  { 0x1BE3u, 0.00000000 },
+  { 0x1BE4u, 0.00000000 },
+  { 0x1BE5u, 0.00000000 },
+  { 0x1BE6u, 0.00000000 },
+  { 0x1BE7u, 0.00000000 },
+  { 0x1BE8u, 0.00000000 },
+  { 0x1BE9u, 0.00000000 },
+  { 0x1BEAu, 0.00000000 },
+  { 0x1BEBu, 0.00000000 },
+  { 0x1BECu, 0.00000000 },
+  { 0x1BEDu, 0.00000000 },
+  { 0x1BEEu, 0.00000000 },
+  { 0x1BEFu, 0.00000000 },
+  { 0x1BF0u, 0.00000000 },
+  { 0x1BF1u, 0.00000000 },
+  { 0x1BF2u, 0.00000000 },
+  { 0x1BF3u, 0.00000000 },
+};
+
@@ -0,0 +1,181 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_43_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+  "À",
+  "Ç",
+  "È",
+  "É",
+  "Í",
+  "Ï",
+  "Ò",
+  "Ó",
+  "Ú",
+  "Ü",
+};
+const char *ALPHA_43_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+  "à",
+  "ç",
+  "è",
+  "é",
+  "í",
+  "ï",
+  "ò",
+  "ó",
+  "ú",
+  "ü",
+};
+const char *ALPHA_43_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_43_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 192, 199, 200, 201, 205, 207,
+  210, 211, 218, 220,
+};
+const uint32_t ALPHA_43_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 224, 231, 232, 233, 237, 239,
+  242, 243, 250, 252,
+};
+const uint32_t ALPHA_43_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_43_FREQ[] = {
+  { "a", 0.12310000 },
+  { "b", 0.01510000 },
+  { "c", 0.03870000 },
+  { "d", 0.04400000 },
+  { "e", 0.12820000 },
+  { "f", 0.01040000 },
+  { "g", 0.01400000 },
+  { "h", 0.00780000 },
+  { "i", 0.07440000 },
+  { "j", 0.00290000 },
+  { "k", 0.00160000 },
+  { "l", 0.06700000 },
+  { "m", 0.03040000 },
+  { "n", 0.06540000 },
+  { "o", 0.04750000 },
+  { "p", 0.02760000 },
+  { "q", 0.00760000 },
+  { "r", 0.06900000 },
+  { "s", 0.07920000 },
+  { "t", 0.05960000 },
+  { "u", 0.03560000 },
+  { "v", 0.01570000 },
+  { "w", 0.00070000 },
+  { "x", 0.00450000 },
+  { "y", 0.00340000 },
+  { "z", 0.00160000 },
+  { "à", 0.00410000 },
+  { "ç", 0.00110000 },
+  { "è", 0.00290000 },
+  { "é", 0.00490000 },
+  { "í", 0.00320000 },
+  { "ï", 0.00050000 },
+  { "ò", 0.00210000 },
+  { "ó", 0.00500000 },
+  { "ú", 0.00080000 },
+  { "ü", 0.00040000 },
+};
+
+const wa_cp_freq ALPHA_43_FREQ_CPS[] = {
+  { 0x61u, 0.12310000 },
+  { 0x62u, 0.01510000 },
+  { 0x63u, 0.03870000 },
+  { 0x64u, 0.04400000 },
+  { 0x65u, 0.12820000 },
+  { 0x66u, 0.01040000 },
+  { 0x67u, 0.01400000 },
+  { 0x68u, 0.00780000 },
+  { 0x69u, 0.07440000 },
+  { 0x6Au, 0.00290000 },
+  { 0x6Bu, 0.00160000 },
+  { 0x6Cu, 0.06700000 },
+  { 0x6Du, 0.03040000 },
+  { 0x6Eu, 0.06540000 },
+  { 0x6Fu, 0.04750000 },
+  { 0x70u, 0.02760000 },
+  { 0x71u, 0.00760000 },
+  { 0x72u, 0.06900000 },
+  { 0x73u, 0.07920000 },
+  { 0x74u, 0.05960000 },
+  { 0x75u, 0.03560000 },
+  { 0x76u, 0.01570000 },
+  { 0x77u, 0.00070000 },
+  { 0x78u, 0.00450000 },
+  { 0x79u, 0.00340000 },
+  { 0x7Au, 0.00160000 },
+  { 0xE0u, 0.00410000 },
+  { 0xE7u, 0.00110000 },
+  { 0xE8u, 0.00290000 },
+  { 0xE9u, 0.00490000 },
+  { 0xEDu, 0.00320000 },
+  { 0xEFu, 0.00050000 },
+  { 0xF2u, 0.00210000 },
+  { 0xF3u, 0.00500000 },
+  { 0xFAu, 0.00080000 },
+  { 0xFCu, 0.00040000 },
+};
+
@@ -0,0 +1,155 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_44_UPPER[] = {
+  "A",
+  "Á",
+  "À",
+  "ː",
+  "B",
+  "C",
+  "H",
+  "ʼ",
+  "D",
+  "E",
+  "É",
+  "È",
+  "I",
+  "Í",
+  "Ì",
+  "K",
+  "M",
+  "N",
+  "O",
+  "Ó",
+  "Ò",
+  "P",
+  "S",
+  "T",
+  "U",
+  "Ú",
+  "Ù",
+  "W",
+  "Y",
+  "ˀ",
+};
+const char *ALPHA_44_LOWER[] = {
+  "a",
+  "á",
+  "à",
+  "ː",
+  "b",
+  "c",
+  "h",
+  "ʼ",
+  "d",
+  "e",
+  "é",
+  "è",
+  "i",
+  "í",
+  "ì",
+  "k",
+  "m",
+  "n",
+  "o",
+  "ó",
+  "ò",
+  "p",
+  "s",
+  "t",
+  "u",
+  "ú",
+  "ù",
+  "w",
+  "y",
+  "ˀ",
+};
+const char *ALPHA_44_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_44_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 72, 73, 75, 77, 78, 79, 80, 83, 84, 85, 87,
+  89, 192, 193, 200, 201, 204, 205, 210, 211, 217, 218, 700, 704, 720,
+};
+const uint32_t ALPHA_44_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 104, 105, 107, 109, 110, 111, 112, 115, 116, 117, 119,
+  121, 224, 225, 232, 233, 236, 237, 242, 243, 249, 250, 700, 704, 720,
+};
+const uint32_t ALPHA_44_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_44_FREQ[] = {
+  { "a", 0.00000000 },
+  { "á", 0.00000000 },
+  { "à", 0.00000000 },
+  { "ː", 0.00000000 },
+  { "b", 0.00000000 },
+  { "c", 0.00000000 },
+  { "h", 0.00000000 },
+  { "ʼ", 0.00000000 },
+  { "d", 0.00000000 },
+  { "e", 0.00000000 },
+  { "é", 0.00000000 },
+  { "è", 0.00000000 },
+  { "i", 0.00000000 },
+  { "í", 0.00000000 },
+  { "ì", 0.00000000 },
+  { "k", 0.00000000 },
+  { "m", 0.00000000 },
+  { "n", 0.00000000 },
+  { "o", 0.00000000 },
+  { "ó", 0.00000000 },
+  { "ò", 0.00000000 },
+  { "p", 0.00000000 },
+  { "s", 0.00000000 },
+  { "t", 0.00000000 },
+  { "u", 0.00000000 },
+  { "ú", 0.00000000 },
+  { "ù", 0.00000000 },
+  { "w", 0.00000000 },
+  { "y", 0.00000000 },
+  { "ˀ", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_44_FREQ_CPS[] = {
+  { 0x61u, 0.00000000 },
+  { 0x62u, 0.00000000 },
+  { 0x63u, 0.00000000 },
+  { 0x64u, 0.00000000 },
+  { 0x65u, 0.00000000 },
+  { 0x68u, 0.00000000 },
+  { 0x69u, 0.00000000 },
+  { 0x6Bu, 0.00000000 },
+  { 0x6Du, 0.00000000 },
+  { 0x6Eu, 0.00000000 },
+  { 0x6Fu, 0.00000000 },
+  { 0x70u, 0.00000000 },
+  { 0x73u, 0.00000000 },
+  { 0x74u, 0.00000000 },
+  { 0x75u, 0.00000000 },
+  { 0x77u, 0.00000000 },
+  { 0x79u, 0.00000000 },
+  { 0xE0u, 0.00000000 },
+  { 0xE1u, 0.00000000 },
+  { 0xE8u, 0.00000000 },
+  { 0xE9u, 0.00000000 },
+  { 0xECu, 0.00000000 },
+  { 0xEDu, 0.00000000 },
+  { 0xF2u, 0.00000000 },
+  { 0xF3u, 0.00000000 },
+  { 0xF9u, 0.00000000 },
+  { 0xFAu, 0.00000000 },
+  { 0x2BCu, 0.00000000 },
+  { 0x2C0u, 0.00000000 },
+  { 0x2D0u, 0.00000000 },
+};
+
@@ -0,0 +1,181 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_45_UPPER[] = {
+  "𑄃",
+  "𑄄",
+  "𑄅",
+  "𑄆",
+  "𑄇",
+  "𑄈",
+  "𑄉",
+  "𑄊",
+  "𑄋",
+  "𑄌",
+  "𑄍",
+  "𑄎",
+  "𑄏",
+  "𑄐",
+  "𑄑",
+  "𑄒",
+  "𑄓",
+  "𑄔",
+  "𑄕",
+  "𑄖",
+  "𑄗",
+  "𑄘",
+  "𑄙",
+  "𑄚",
+  "𑄛",
+  "𑄜",
+  "𑄝",
+  "𑄞",
+  "𑄟",
+  "𑄠",
+  "𑄡",
+  "𑄢",
+  "𑄣",
+  "𑄤",
+  "𑄥",
+  "𑄦",
+};
+const char *ALPHA_45_LOWER[] = {
+  "𑄃",
+  "𑄄",
+  "𑄅",
+  "𑄆",
+  "𑄇",
+  "𑄈",
+  "𑄉",
+  "𑄊",
+  "𑄋",
+  "𑄌",
+  "𑄍",
+  "𑄎",
+  "𑄏",
+  "𑄐",
+  "𑄑",
+  "𑄒",
+  "𑄓",
+  "𑄔",
+  "𑄕",
+  "𑄖",
+  "𑄗",
+  "𑄘",
+  "𑄙",
+  "𑄚",
+  "𑄛",
+  "𑄜",
+  "𑄝",
+  "𑄞",
+  "𑄟",
+  "𑄠",
+  "𑄡",
+  "𑄢",
+  "𑄣",
+  "𑄤",
+  "𑄥",
+  "𑄦",
+};
+const char *ALPHA_45_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_45_UPPER_CPS[] = {
+  69891, 69892, 69893, 69894, 69895, 69896, 69897, 69898, 69899, 69900, 69901, 69902, 69903, 69904, 69905, 69906,
+  69907, 69908, 69909, 69910, 69911, 69912, 69913, 69914, 69915, 69916, 69917, 69918, 69919, 69920, 69921, 69922,
+  69923, 69924, 69925, 69926,
+};
+const uint32_t ALPHA_45_LOWER_CPS[] = {
+  69891, 69892, 69893, 69894, 69895, 69896, 69897, 69898, 69899, 69900, 69901, 69902, 69903, 69904, 69905, 69906,
+  69907, 69908, 69909, 69910, 69911, 69912, 69913, 69914, 69915, 69916, 69917, 69918, 69919, 69920, 69921, 69922,
+  69923, 69924, 69925, 69926,
+};
+const uint32_t ALPHA_45_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_45_FREQ[] = {
+  { "𑄃", 0.00000000 },
+  { "𑄄", 0.00000000 },
+  { "𑄅", 0.00000000 },
+  { "𑄆", 0.00000000 },
+  { "𑄇", 0.00000000 },
+  { "𑄈", 0.00000000 },
+  { "𑄉", 0.00000000 },
+  { "𑄊", 0.00000000 },
+  { "𑄋", 0.00000000 },
+  { "𑄌", 0.00000000 },
+  { "𑄍", 0.00000000 },
+  { "𑄎", 0.00000000 },
+  { "𑄏", 0.00000000 },
+  { "𑄐", 0.00000000 },
+  { "𑄑", 0.00000000 },
+  { "𑄒", 0.00000000 },
+  { "𑄓", 0.00000000 },
+  { "𑄔", 0.00000000 },
+  { "𑄕", 0.00000000 },
+  { "𑄖", 0.00000000 },
+  { "𑄗", 0.00000000 },
+  { "𑄘", 0.00000000 },
+  { "𑄙", 0.00000000 },
+  { "𑄚", 0.00000000 },
+  { "𑄛", 0.00000000 },
+  { "𑄜", 0.00000000 },
+  { "𑄝", 0.00000000 },
+  { "𑄞", 0.00000000 },
+  { "𑄟", 0.00000000 },
+  { "𑄠", 0.00000000 },
+  { "𑄡", 0.00000000 },
+  { "𑄢", 0.00000000 },
+  { "𑄣", 0.00000000 },
+  { "𑄤", 0.00000000 },
+  { "𑄥", 0.00000000 },
+  { "𑄦", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_45_FREQ_CPS[] = {
+  { 0x11103u, 0.00000000 },
+  { 0x11104u, 0.00000000 },
+  { 0x11105u, 0.00000000 },
+  { 0x11106u, 0.00000000 },
+  { 0x11107u, 0.00000000 },
+  { 0x11108u, 0.00000000 },
+  { 0x11109u, 0.00000000 },
+  { 0x1110Au, 0.00000000 },
+  { 0x1110Bu, 0.00000000 },
+  { 0x1110Cu, 0.00000000 },
+  { 0x1110Du, 0.00000000 },
+  { 0x1110Eu, 0.00000000 },
+  { 0x1110Fu, 0.00000000 },
+  { 0x11110u, 0.00000000 },
+  { 0x11111u, 0.00000000 },
+  { 0x11112u, 0.00000000 },
+  { 0x11113u, 0.00000000 },
+  { 0x11114u, 0.00000000 },
+  { 0x11115u, 0.00000000 },
+  { 0x11116u, 0.00000000 },
+  { 0x11117u, 0.00000000 },
+  { 0x11118u, 0.00000000 },
+  { 0x11119u, 0.00000000 },
+  { 0x1111Au, 0.00000000 },
+  { 0x1111Bu, 0.00000000 },
+  { 0x1111Cu, 0.00000000 },
+  { 0x1111Du, 0.00000000 },
+  { 0x1111Eu, 0.00000000 },
+  { 0x1111Fu, 0.00000000 },
+  { 0x11120u, 0.00000000 },
+  { 0x11121u, 0.00000000 },
+  { 0x11122u, 0.00000000 },
+  { 0x11123u, 0.00000000 },
+  { 0x11124u, 0.00000000 },
+  { 0x11125u, 0.00000000 },
+  { 0x11126u, 0.00000000 },
+};
+
@@ -0,0 +1,173 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_46_UPPER[] = {
+  "А",
+  "Б",
+  "В",
+  "Г",
+  "Д",
+  "Е",
+  "Ё",
+  "Ж",
+  "З",
+  "И",
+  "К",
+  "Л",
+  "М",
+  "Н",
+  "О",
+  "П",
+  "Р",
+  "С",
+  "Т",
+  "У",
+  "Ф",
+  "Х",
+  "Ц",
+  "Ч",
+  "Ш",
+  "Щ",
+  "Ъ",
+  "Ы",
+  "Ь",
+  "Э",
+  "Ю",
+  "Я",
+  "Й",
+  "Ӏ",
+};
+const char *ALPHA_46_LOWER[] = {
+  "а",
+  "б",
+  "в",
+  "г",
+  "д",
+  "е",
+  "ё",
+  "ж",
+  "з",
+  "и",
+  "к",
+  "л",
+  "м",
+  "н",
+  "о",
+  "п",
+  "р",
+  "с",
+  "т",
+  "у",
+  "ф",
+  "х",
+  "ц",
+  "ч",
+  "ш",
+  "щ",
+  "ъ",
+  "ы",
+  "ь",
+  "э",
+  "ю",
+  "я",
+  "й",
+  "ӏ",
+};
+const char *ALPHA_46_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_46_UPPER_CPS[] = {
+  1025, 1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053, 1054,
+  1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069, 1070,
+  1071, 1216,
+};
+const uint32_t ALPHA_46_LOWER_CPS[] = {
+  1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080, 1081, 1082, 1083, 1084, 1085, 1086, 1087,
+  1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103,
+  1105, 1231,
+};
+const uint32_t ALPHA_46_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_46_FREQ[] = {
+  { "а", 0.20690000 },
+  { "б", 0.01840000 },
+  { "в", 0.01680000 },
+  { "г", 0.01990000 },
+  { "д", 0.03560000 },
+  { "е", 0.04340000 },
+  { "ё", 0.00000000 },
+  { "ж", 0.00430000 },
+  { "з", 0.00980000 },
+  { "и", 0.04480000 },
+  { "к", 0.03410000 },
+  { "л", 0.05750000 },
+  { "м", 0.02180000 },
+  { "н", 0.06050000 },
+  { "о", 0.04600000 },
+  { "п", 0.00400000 },
+  { "р", 0.04260000 },
+  { "с", 0.01910000 },
+  { "т", 0.03340000 },
+  { "у", 0.05150000 },
+  { "ф", 0.00060000 },
+  { "х", 0.06900000 },
+  { "ц", 0.02340000 },
+  { "ч", 0.01560000 },
+  { "ш", 0.03260000 },
+  { "щ", 0.00000000 },
+  { "ъ", 0.00960000 },
+  { "ы", 0.00020000 },
+  { "ь", 0.04510000 },
+  { "э", 0.00260000 },
+  { "ю", 0.00310000 },
+  { "я", 0.00330000 },
+  { "й", 0.02420000 },
+  { "ӏ", 0.00020000 },
+};
+
+const wa_cp_freq ALPHA_46_FREQ_CPS[] = {
+  { 0x430u, 0.20690000 },
+  { 0x431u, 0.01840000 },
+  { 0x432u, 0.01680000 },
+  { 0x433u, 0.01990000 },
+  { 0x434u, 0.03560000 },
+  { 0x435u, 0.04340000 },
+  { 0x436u, 0.00430000 },
+  { 0x437u, 0.00980000 },
+  { 0x438u, 0.04480000 },
+  { 0x439u, 0.02420000 },
+  { 0x43Au, 0.03410000 },
+  { 0x43Bu, 0.05750000 },
+  { 0x43Cu, 0.02180000 },
+  { 0x43Du, 0.06050000 },
+  { 0x43Eu, 0.04600000 },
+  { 0x43Fu, 0.00400000 },
+  { 0x440u, 0.04260000 },
+  { 0x441u, 0.01910000 },
+  { 0x442u, 0.03340000 },
+  { 0x443u, 0.05150000 },
+  { 0x444u, 0.00060000 },
+  { 0x445u, 0.06900000 },
+  { 0x446u, 0.02340000 },
+  { 0x447u, 0.01560000 },
+  { 0x448u, 0.03260000 },
+  { 0x449u, 0.00000000 },
+  { 0x44Au, 0.00960000 },
+  { 0x44Bu, 0.00020000 },
+  { 0x44Cu, 0.04510000 },
+  { 0x44Du, 0.00260000 },
+  { 0x44Eu, 0.00310000 },
+  { 0x44Fu, 0.00330000 },
+  { 0x451u, 0.00000000 },
+  { 0x4CFu, 0.00020000 },
+};
+
@@ -0,0 +1,101 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_47_UPPER[] = {
+  "A",
+  "B",
+  "D",
+  "E",
+  "G",
+  "H",
+  "I",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "R",
+  "S",
+  "T",
+  "U",
+  "W",
+  "Y",
+};
+const char *ALPHA_47_LOWER[] = {
+  "a",
+  "b",
+  "d",
+  "e",
+  "g",
+  "h",
+  "i",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "r",
+  "s",
+  "t",
+  "u",
+  "w",
+  "y",
+};
+const char *ALPHA_47_DIGITS[] = {
+};
+const uint32_t ALPHA_47_UPPER_CPS[] = {
+  65, 66, 68, 69, 71, 72, 73, 75, 76, 77, 78, 79, 80, 82, 83, 84,
+  85, 87, 89,
+};
+const uint32_t ALPHA_47_LOWER_CPS[] = {
+  97, 98, 100, 101, 103, 104, 105, 107, 108, 109, 110, 111, 112, 114, 115, 116,
+  117, 119, 121,
+};
+const uint32_t ALPHA_47_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_47_FREQ[] = {
+  { "a", 0.18940000 },
+  { "w", 0.00230000 },
+  { "t", 0.04010000 },
+  { "h", 0.02300000 },
+  { "n", 0.10350000 },
+  { "g", 0.04860000 },
+  { "d", 0.02110000 },
+  { "b", 0.00950000 },
+  { "e", 0.05820000 },
+  { "o", 0.06250000 },
+  { "p", 0.03320000 },
+  { "i", 0.07010000 },
+  { "k", 0.03620000 },
+  { "l", 0.02980000 },
+  { "m", 0.04930000 },
+  { "u", 0.05290000 },
+  { "s", 0.08180000 },
+  { "r", 0.04520000 },
+  { "y", 0.04330000 },
+};
+
+const wa_cp_freq ALPHA_47_FREQ_CPS[] = {
+  { 0x61u, 0.18940000 },
+  { 0x62u, 0.00950000 },
+  { 0x64u, 0.02110000 },
+  { 0x65u, 0.05820000 },
+  { 0x67u, 0.04860000 },
+  { 0x68u, 0.02300000 },
+  { 0x69u, 0.07010000 },
+  { 0x6Bu, 0.03620000 },
+  { 0x6Cu, 0.02980000 },
+  { 0x6Du, 0.04930000 },
+  { 0x6Eu, 0.10350000 },
+  { 0x6Fu, 0.06250000 },
+  { 0x70u, 0.03320000 },
+  { 0x72u, 0.04520000 },
+  { 0x73u, 0.08180000 },
+  { 0x74u, 0.04010000 },
+  { 0x75u, 0.05290000 },
+  { 0x77u, 0.00230000 },
+  { 0x79u, 0.04330000 },
+};
+
@@ -0,0 +1,123 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_5_UPPER[] = {
+  "A",
+  "B",
+  "D",
+  "E",
+  "Ɛ",
+  "F",
+  "G",
+  "H",
+  "I",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "Ɔ",
+  "P",
+  "R",
+  "S",
+  "T",
+  "U",
+  "W",
+  "Y",
+};
+const char *ALPHA_5_LOWER[] = {
+  "a",
+  "b",
+  "d",
+  "e",
+  "ɛ",
+  "f",
+  "g",
+  "h",
+  "i",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "ɔ",
+  "p",
+  "r",
+  "s",
+  "t",
+  "u",
+  "w",
+  "y",
+};
+const char *ALPHA_5_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_5_UPPER_CPS[] = {
+  65, 66, 68, 69, 70, 71, 72, 73, 75, 76, 77, 78, 79, 80, 82, 83,
+  84, 85, 87, 89, 390, 400,
+};
+const uint32_t ALPHA_5_LOWER_CPS[] = {
+  97, 98, 100, 101, 102, 103, 104, 105, 107, 108, 109, 110, 111, 112, 114, 115,
+  116, 117, 119, 121, 596, 603,
+};
+const uint32_t ALPHA_5_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_5_FREQ[] = {
+  { "a", 0.16190000 },
+  { "b", 0.02570000 },
+  { "d", 0.02480000 },
+  { "e", 0.08980000 },
+  { "ɛ", 0.02840000 },
+  { "f", 0.02080000 },
+  { "g", 0.01260000 },
+  { "h", 0.02660000 },
+  { "i", 0.06090000 },
+  { "k", 0.03370000 },
+  { "l", 0.01080000 },
+  { "m", 0.04610000 },
+  { "n", 0.11960000 },
+  { "o", 0.07860000 },
+  { "ɔ", 0.03370000 },
+  { "p", 0.01310000 },
+  { "r", 0.03590000 },
+  { "s", 0.04130000 },
+  { "t", 0.02570000 },
+  { "u", 0.04070000 },
+  { "w", 0.03690000 },
+  { "y", 0.03230000 },
+};
+
+const wa_cp_freq ALPHA_5_FREQ_CPS[] = {
+  { 0x61u, 0.16190000 },
+  { 0x62u, 0.02570000 },
+  { 0x64u, 0.02480000 },
+  { 0x65u, 0.08980000 },
+  { 0x66u, 0.02080000 },
+  { 0x67u, 0.01260000 },
+  { 0x68u, 0.02660000 },
+  { 0x69u, 0.06090000 },
+  { 0x6Bu, 0.03370000 },
+  { 0x6Cu, 0.01080000 },
+  { 0x6Du, 0.04610000 },
+  { 0x6Eu, 0.11960000 },
+  { 0x6Fu, 0.07860000 },
+  { 0x70u, 0.01310000 },
+  { 0x72u, 0.03590000 },
+  { 0x73u, 0.04130000 },
+  { 0x74u, 0.02570000 },
+  { 0x75u, 0.04070000 },
+  { 0x77u, 0.03690000 },
+  { 0x79u, 0.03230000 },
+  { 0x254u, 0.03370000 },
+  { 0x25Bu, 0.02840000 },
+};
+
@@ -0,0 +1,383 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_50_UPPER[] = {
+  "Ꭰ",
+  "Ꭱ",
+  "Ꭲ",
+  "Ꭳ",
+  "Ꭴ",
+  "Ꭵ",
+  "Ꭶ",
+  "Ꭷ",
+  "Ꭸ",
+  "Ꭹ",
+  "Ꭺ",
+  "Ꭻ",
+  "Ꭼ",
+  "Ꭽ",
+  "Ꭾ",
+  "Ꭿ",
+  "Ꮀ",
+  "Ꮁ",
+  "Ꮂ",
+  "Ꮃ",
+  "Ꮄ",
+  "Ꮅ",
+  "Ꮆ",
+  "Ꮇ",
+  "Ꮈ",
+  "Ꮉ",
+  "Ꮊ",
+  "Ꮋ",
+  "Ꮌ",
+  "Ꮍ",
+  "Ꮎ",
+  "Ꮏ",
+  "Ꮐ",
+  "Ꮑ",
+  "Ꮒ",
+  "Ꮓ",
+  "Ꮔ",
+  "Ꮕ",
+  "Ꮖ",
+  "Ꮗ",
+  "Ꮘ",
+  "Ꮙ",
+  "Ꮚ",
+  "Ꮛ",
+  "Ꮜ",
+  "Ꮝ",
+  "Ꮞ",
+  "Ꮟ",
+  "Ꮠ",
+  "Ꮡ",
+  "Ꮢ",
+  "Ꮣ",
+  "Ꮤ",
+  "Ꮥ",
+  "Ꮦ",
+  "Ꮧ",
+  "Ꮨ",
+  "Ꮩ",
+  "Ꮪ",
+  "Ꮫ",
+  "Ꮬ",
+  "Ꮭ",
+  "Ꮮ",
+  "Ꮯ",
+  "Ꮰ",
+  "Ꮱ",
+  "Ꮲ",
+  "Ꮳ",
+  "Ꮴ",
+  "Ꮵ",
+  "Ꮶ",
+  "Ꮷ",
+  "Ꮸ",
+  "Ꮹ",
+  "Ꮺ",
+  "Ꮻ",
+  "Ꮼ",
+  "Ꮽ",
+  "Ꮾ",
+  "Ꮿ",
+  "Ᏸ",
+  "Ᏹ",
+  "Ᏺ",
+  "Ᏻ",
+  "Ᏼ",
+};
+const char *ALPHA_50_LOWER[] = {
+  "ꭰ",
+  "ꭱ",
+  "ꭲ",
+  "ꭳ",
+  "ꭴ",
+  "ꭵ",
+  "ꭶ",
+  "ꭷ",
+  "ꭸ",
+  "ꭹ",
+  "ꭺ",
+  "ꭻ",
+  "ꭼ",
+  "ꭽ",
+  "ꭾ",
+  "ꭿ",
+  "ꮀ",
+  "ꮁ",
+  "ꮂ",
+  "ꮃ",
+  "ꮄ",
+  "ꮅ",
+  "ꮆ",
+  "ꮇ",
+  "ꮈ",
+  "ꮉ",
+  "ꮊ",
+  "ꮋ",
+  "ꮌ",
+  "ꮍ",
+  "ꮎ",
+  "ꮏ",
+  "ꮐ",
+  "ꮑ",
+  "ꮒ",
+  "ꮓ",
+  "ꮔ",
+  "ꮕ",
+  "ꮖ",
+  "ꮗ",
+  "ꮘ",
+  "ꮙ",
+  "ꮚ",
+  "ꮛ",
+  "ꮜ",
+  "ꮝ",
+  "ꮞ",
+  "ꮟ",
+  "ꮠ",
+  "ꮡ",
+  "ꮢ",
+  "ꮣ",
+  "ꮤ",
+  "ꮥ",
+  "ꮦ",
+  "ꮧ",
+  "ꮨ",
+  "ꮩ",
+  "ꮪ",
+  "ꮫ",
+  "ꮬ",
+  "ꮭ",
+  "ꮮ",
+  "ꮯ",
+  "ꮰ",
+  "ꮱ",
+  "ꮲ",
+  "ꮳ",
+  "ꮴ",
+  "ꮵ",
+  "ꮶ",
+  "ꮷ",
+  "ꮸ",
+  "ꮹ",
+  "ꮺ",
+  "ꮻ",
+  "ꮼ",
+  "ꮽ",
+  "ꮾ",
+  "ꮿ",
+  "ᏸ",
+  "ᏹ",
+  "ᏺ",
+  "ᏻ",
+  "ᏼ",
+};
+const char *ALPHA_50_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_50_UPPER_CPS[] = {
+  5024, 5025, 5026, 5027, 5028, 5029, 5030, 5031, 5032, 5033, 5034, 5035, 5036, 5037, 5038, 5039,
+  5040, 5041, 5042, 5043, 5044, 5045, 5046, 5047, 5048, 5049, 5050, 5051, 5052, 5053, 5054, 5055,
+  5056, 5057, 5058, 5059, 5060, 5061, 5062, 5063, 5064, 5065, 5066, 5067, 5068, 5069, 5070, 5071,
+  5072, 5073, 5074, 5075, 5076, 5077, 5078, 5079, 5080, 5081, 5082, 5083, 5084, 5085, 5086, 5087,
+  5088, 5089, 5090, 5091, 5092, 5093, 5094, 5095, 5096, 5097, 5098, 5099, 5100, 5101, 5102, 5103,
+  5104, 5105, 5106, 5107, 5108,
+};
+const uint32_t ALPHA_50_LOWER_CPS[] = {
+  5112, 5113, 5114, 5115, 5116, 43888, 43889, 43890, 43891, 43892, 43893, 43894, 43895, 43896, 43897, 43898,
+  43899, 43900, 43901, 43902, 43903, 43904, 43905, 43906, 43907, 43908, 43909, 43910, 43911, 43912, 43913, 43914,
+  43915, 43916, 43917, 43918, 43919, 43920, 43921, 43922, 43923, 43924, 43925, 43926, 43927, 43928, 43929, 43930,
+  43931, 43932, 43933, 43934, 43935, 43936, 43937, 43938, 43939, 43940, 43941, 43942, 43943, 43944, 43945, 43946,
+  43947, 43948, 43949, 43950, 43951, 43952, 43953, 43954, 43955, 43956, 43957, 43958, 43959, 43960, 43961, 43962,
+  43963, 43964, 43965, 43966, 43967,
+};
+const uint32_t ALPHA_50_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_50_FREQ[] = {
+  { "ꭰ", 0.00000000 },
+  { "ꭱ", 0.00000000 },
+  { "ꭲ", 0.00000000 },
+  { "ꭳ", 0.00000000 },
+  { "ꭴ", 0.00000000 },
+  { "ꭵ", 0.00000000 },
+  { "ꭶ", 0.00000000 },
+  { "ꭷ", 0.00000000 },
+  { "ꭸ", 0.00000000 },
+  { "ꭹ", 0.00000000 },
+  { "ꭺ", 0.00000000 },
+  { "ꭻ", 0.00000000 },
+  { "ꭼ", 0.00000000 },
+  { "ꭽ", 0.00000000 },
+  { "ꭾ", 0.00000000 },
+  { "ꭿ", 0.00000000 },
+  { "ꮀ", 0.00000000 },
+  { "ꮁ", 0.00000000 },
+  { "ꮂ", 0.00000000 },
+  { "ꮃ", 0.00000000 },
+  { "ꮄ", 0.00000000 },
+  { "ꮅ", 0.00000000 },
+  { "ꮆ", 0.00000000 },
+  { "ꮇ", 0.00000000 },
+  { "ꮈ", 0.00000000 },
+  { "ꮉ", 0.00000000 },
+  { "ꮊ", 0.00000000 },
+  { "ꮋ", 0.00000000 },
+  { "ꮌ", 0.00000000 },
+  { "ꮍ", 0.00000000 },
+  { "ꮎ", 0.00000000 },
+  { "ꮏ", 0.00000000 },
+  { "ꮐ", 0.00000000 },
+  { "ꮑ", 0.00000000 },
+  { "ꮒ", 0.00000000 },
+  { "ꮓ", 0.00000000 },
+  { "ꮔ", 0.00000000 },
+  { "ꮕ", 0.00000000 },
+  { "ꮖ", 0.00000000 },
+  { "ꮗ", 0.00000000 },
+  { "ꮘ", 0.00000000 },
+  { "ꮙ", 0.00000000 },
+  { "ꮚ", 0.00000000 },
+  { "ꮛ", 0.00000000 },
+  { "ꮜ", 0.00000000 },
+  { "ꮝ", 0.00000000 },
+  { "ꮞ", 0.00000000 },
+  { "ꮟ", 0.00000000 },
+  { "ꮠ", 0.00000000 },
+  { "ꮡ", 0.00000000 },
+  { "ꮢ", 0.00000000 },
+  { "ꮣ", 0.00000000 },
+  { "ꮤ", 0.00000000 },
+  { "ꮥ", 0.00000000 },
+  { "ꮦ", 0.00000000 },
+  { "ꮧ", 0.00000000 },
+  { "ꮨ", 0.00000000 },
+  { "ꮩ", 0.00000000 },
+  { "ꮪ", 0.00000000 },
+  { "ꮫ", 0.00000000 },
+  { "ꮬ", 0.00000000 },
+  { "ꮭ", 0.00000000 },
+  { "ꮮ", 0.00000000 },
+  { "ꮯ", 0.00000000 },
+  { "ꮰ", 0.00000000 },
+  { "ꮱ", 0.00000000 },
+  { "ꮲ", 0.00000000 },
+  { "ꮳ", 0.00000000 },
+  { "ꮴ", 0.00000000 },
+  { "ꮵ", 0.00000000 },
+  { "ꮶ", 0.00000000 },
+  { "ꮷ", 0.00000000 },
+  { "ꮸ", 0.00000000 },
+  { "ꮹ", 0.00000000 },
+  { "ꮺ", 0.00000000 },
+  { "ꮻ", 0.00000000 },
+  { "ꮼ", 0.00000000 },
+  { "ꮽ", 0.00000000 },
+  { "ꮾ", 0.00000000 },
+  { "ꮿ", 0.00000000 },
+  { "ᏸ", 0.00000000 },
+  { "ᏹ", 0.00000000 },
+  { "ᏺ", 0.00000000 },
+  { "ᏻ", 0.00000000 },
+  { "ᏼ", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_50_FREQ_CPS[] = {
+  { 0x13F8u, 0.00000000 },
+  { 0x13F9u, 0.00000000 },
+  { 0x13FAu, 0.00000000 },
+  { 0x13FBu, 0.00000000 },
+  { 0x13FCu, 0.00000000 },
+  { 0xAB70u, 0.00000000 },
+  { 0xAB71u, 0.00000000 },
+  { 0xAB72u, 0.00000000 },
+  { 0xAB73u, 0.00000000 },
+  { 0xAB74u, 0.00000000 },
+  { 0xAB75u, 0.00000000 },
+  { 0xAB76u, 0.00000000 },
+  { 0xAB77u, 0.00000000 },
+  { 0xAB78u, 0.00000000 },
+  { 0xAB79u, 0.00000000 },
+  { 0xAB7Au, 0.00000000 },
+  { 0xAB7Bu, 0.00000000 },
+  { 0xAB7Cu, 0.00000000 },
+  { 0xAB7Du, 0.00000000 },
+  { 0xAB7Eu, 0.00000000 },
+  { 0xAB7Fu, 0.00000000 },
+  { 0xAB80u, 0.00000000 },
+  { 0xAB81u, 0.00000000 },
+  { 0xAB82u, 0.00000000 },
+  { 0xAB83u, 0.00000000 },
+  { 0xAB84u, 0.00000000 },
+  { 0xAB85u, 0.00000000 },
+  { 0xAB86u, 0.00000000 },
+  { 0xAB87u, 0.00000000 },
+  { 0xAB88u, 0.00000000 },
+  { 0xAB89u, 0.00000000 },
+  { 0xAB8Au, 0.00000000 },
+  { 0xAB8Bu, 0.00000000 },
+  { 0xAB8Cu, 0.00000000 },
+  { 0xAB8Du, 0.00000000 },
+  { 0xAB8Eu, 0.00000000 },
+  { 0xAB8Fu, 0.00000000 },
+  { 0xAB90u, 0.00000000 },
+  { 0xAB91u, 0.00000000 },
+  { 0xAB92u, 0.00000000 },
+  { 0xAB93u, 0.00000000 },
+  { 0xAB94u, 0.00000000 },
+  { 0xAB95u, 0.00000000 },
+  { 0xAB96u, 0.00000000 },
+  { 0xAB97u, 0.00000000 },
+  { 0xAB98u, 0.00000000 },
+  { 0xAB99u, 0.00000000 },
+  { 0xAB9Au, 0.00000000 },
+  { 0xAB9Bu, 0.00000000 },
+  { 0xAB9Cu, 0.00000000 },
+  { 0xAB9Du, 0.00000000 },
+  { 0xAB9Eu, 0.00000000 },
+  { 0xAB9Fu, 0.00000000 },
+  { 0xABA0u, 0.00000000 },
+  { 0xABA1u, 0.00000000 },
+  { 0xABA2u, 0.00000000 },
+  { 0xABA3u, 0.00000000 },
+  { 0xABA4u, 0.00000000 },
+  { 0xABA5u, 0.00000000 },
+  { 0xABA6u, 0.00000000 },
+  { 0xABA7u, 0.00000000 },
+  { 0xABA8u, 0.00000000 },
+  { 0xABA9u, 0.00000000 },
+  { 0xABAAu, 0.00000000 },
+  { 0xABABu, 0.00000000 },
+  { 0xABACu, 0.00000000 },
+  { 0xABADu, 0.00000000 },
+  { 0xABAEu, 0.00000000 },
+  { 0xABAFu, 0.00000000 },
+  { 0xABB0u, 0.00000000 },
+  { 0xABB1u, 0.00000000 },
+  { 0xABB2u, 0.00000000 },
+  { 0xABB3u, 0.00000000 },
+  { 0xABB4u, 0.00000000 },
+  { 0xABB5u, 0.00000000 },
+  { 0xABB6u, 0.00000000 },
+  { 0xABB7u, 0.00000000 },
+  { 0xABB8u, 0.00000000 },
+  { 0xABB9u, 0.00000000 },
+  { 0xABBAu, 0.00000000 },
+  { 0xABBBu, 0.00000000 },
+  { 0xABBCu, 0.00000000 },
+  { 0xABBDu, 0.00000000 },
+  { 0xABBEu, 0.00000000 },
+  { 0xABBFu, 0.00000000 },
+};
+
@@ -0,0 +1,107 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_51_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "H",
+  "F",
+  "I",
+  "K",
+  "L",
+  "M",
+  "N",
+  "G",
+  "O",
+  "P",
+  "S",
+  "T",
+  "W",
+  "Y",
+  "ʼ",
+};
+const char *ALPHA_51_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "h",
+  "f",
+  "i",
+  "k",
+  "l",
+  "m",
+  "n",
+  "g",
+  "o",
+  "p",
+  "s",
+  "t",
+  "w",
+  "y",
+  "ʼ",
+};
+const char *ALPHA_51_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_51_UPPER_CPS[] = {
+  65, 66, 67, 70, 71, 72, 73, 75, 76, 77, 78, 79, 80, 83, 84, 87,
+  89, 700,
+};
+const uint32_t ALPHA_51_LOWER_CPS[] = {
+  97, 98, 99, 102, 103, 104, 105, 107, 108, 109, 110, 111, 112, 115, 116, 119,
+  121, 700,
+};
+const uint32_t ALPHA_51_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_51_FREQ[] = {
+  { "a", 0.00000000 },
+  { "b", 0.00000000 },
+  { "c", 0.00000000 },
+  { "h", 0.00000000 },
+  { "f", 0.00000000 },
+  { "i", 0.00000000 },
+  { "k", 0.00000000 },
+  { "l", 0.00000000 },
+  { "m", 0.00000000 },
+  { "n", 0.00000000 },
+  { "g", 0.00000000 },
+  { "o", 0.00000000 },
+  { "p", 0.00000000 },
+  { "s", 0.00000000 },
+  { "t", 0.00000000 },
+  { "w", 0.00000000 },
+  { "y", 0.00000000 },
+  { "ʼ", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_51_FREQ_CPS[] = {
+  { 0x61u, 0.00000000 },
+  { 0x62u, 0.00000000 },
+  { 0x63u, 0.00000000 },
+  { 0x66u, 0.00000000 },
+  { 0x67u, 0.00000000 },
+  { 0x68u, 0.00000000 },
+  { 0x69u, 0.00000000 },
+  { 0x6Bu, 0.00000000 },
+  { 0x6Cu, 0.00000000 },
+  { 0x6Du, 0.00000000 },
+  { 0x6Eu, 0.00000000 },
+  { 0x6Fu, 0.00000000 },
+  { 0x70u, 0.00000000 },
+  { 0x73u, 0.00000000 },
+  { 0x74u, 0.00000000 },
+  { 0x77u, 0.00000000 },
+  { 0x79u, 0.00000000 },
+  { 0x2BCu, 0.00000000 },
+};
+
@@ -0,0 +1,169 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_52_UPPER[] = {
+  "ئ",
+  "ا",
+  "ب",
+  "پ",
+  "ت",
+  "ج",
+  "چ",
+  "ح",
+  "خ",
+  "د",
+  "ر",
+  "ز",
+  "ڕ",
+  "ژ",
+  "س",
+  "ش",
+  "ع",
+  "غ",
+  "ف",
+  "ڤ",
+  "ق",
+  "ک",
+  "گ",
+  "ل",
+  "ڵ",
+  "م",
+  "ن",
+  "ه",
+  "ە",
+  "و",
+  "ۆ",
+  "ی",
+  "ێ",
+};
+const char *ALPHA_52_LOWER[] = {
+  "ئ",
+  "ا",
+  "ب",
+  "پ",
+  "ت",
+  "ج",
+  "چ",
+  "ح",
+  "خ",
+  "د",
+  "ر",
+  "ز",
+  "ڕ",
+  "ژ",
+  "س",
+  "ش",
+  "ع",
+  "غ",
+  "ف",
+  "ڤ",
+  "ق",
+  "ک",
+  "گ",
+  "ل",
+  "ڵ",
+  "م",
+  "ن",
+  "ه",
+  "ە",
+  "و",
+  "ۆ",
+  "ی",
+  "ێ",
+};
+const char *ALPHA_52_DIGITS[] = {
+  "٠",
+  "١",
+  "٢",
+  "٣",
+  "٤",
+  "٥",
+  "٦",
+  "٧",
+  "٨",
+  "٩",
+};
+const uint32_t ALPHA_52_UPPER_CPS[] = {
+  1574, 1575, 1576, 1578, 1580, 1581, 1582, 1583, 1585, 1586, 1587, 1588, 1593, 1594, 1601, 1602,
+  1604, 1605, 1606, 1607, 1608, 1662, 1670, 1685, 1688, 1700, 1705, 1711, 1717, 1734, 1740, 1742,
+  1749,
+};
+const uint32_t ALPHA_52_LOWER_CPS[] = {
+  1574, 1575, 1576, 1578, 1580, 1581, 1582, 1583, 1585, 1586, 1587, 1588, 1593, 1594, 1601, 1602,
+  1604, 1605, 1606, 1607, 1608, 1662, 1670, 1685, 1688, 1700, 1705, 1711, 1717, 1734, 1740, 1742,
+  1749,
+};
+const uint32_t ALPHA_52_DIGITS_CPS[] = {
+  1632, 1633, 1634, 1635, 1636, 1637, 1638, 1639, 1640, 1641,
+};
+const wa_freq_entry ALPHA_52_FREQ[] = {
+  { "ئ", 0.01490000 },
+  { "ا", 0.10410000 },
+  { "ب", 0.03610000 },
+  { "پ", 0.01090000 },
+  { "ت", 0.03610000 },
+  { "ج", 0.00500000 },
+  { "چ", 0.00500000 },
+  { "ح", 0.00200000 },
+  { "خ", 0.00730000 },
+  { "د", 0.03940000 },
+  { "ر", 0.05800000 },
+  { "ز", 0.01300000 },
+  { "ڕ", 0.00940000 },
+  { "ژ", 0.00610000 },
+  { "س", 0.02750000 },
+  { "ش", 0.01500000 },
+  { "ع", 0.00220000 },
+  { "غ", 0.00060000 },
+  { "ف", 0.00430000 },
+  { "ڤ", 0.00100000 },
+  { "ق", 0.00290000 },
+  { "ک", 0.04480000 },
+  { "گ", 0.01310000 },
+  { "ل", 0.02740000 },
+  { "ڵ", 0.01320000 },
+  { "م", 0.02830000 },
+  { "ن", 0.06720000 },
+  { "ه", 0.02570000 },
+  { "ە", 0.13400000 },
+  { "و", 0.08250000 },
+  { "ۆ", 0.02120000 },
+  { "ی", 0.11320000 },
+  { "ێ", 0.02830000 },
+};
+
+const wa_cp_freq ALPHA_52_FREQ_CPS[] = {
+  { 0x626u, 0.01490000 },
+  { 0x627u, 0.10410000 },
+  { 0x628u, 0.03610000 },
+  { 0x62Au, 0.03610000 },
+  { 0x62Cu, 0.00500000 },
+  { 0x62Du, 0.00200000 },
+  { 0x62Eu, 0.00730000 },
+  { 0x62Fu, 0.03940000 },
+  { 0x631u, 0.05800000 },
+  { 0x632u, 0.01300000 },
+  { 0x633u, 0.02750000 },
+  { 0x634u, 0.01500000 },
+  { 0x639u, 0.00220000 },
+  { 0x63Au, 0.00060000 },
+  { 0x641u, 0.00430000 },
+  { 0x642u, 0.00290000 },
+  { 0x644u, 0.02740000 },
+  { 0x645u, 0.02830000 },
+  { 0x646u, 0.06720000 },
+  { 0x647u, 0.02570000 },
+  { 0x648u, 0.08250000 },
+  { 0x67Eu, 0.01090000 },
+  { 0x686u, 0.00500000 },
+  { 0x695u, 0.00940000 },
+  { 0x698u, 0.00610000 },
+  { 0x6A4u, 0.00100000 },
+  { 0x6A9u, 0.04480000 },
+  { 0x6AFu, 0.01310000 },
+  { 0x6B5u, 0.01320000 },
+  { 0x6C6u, 0.02120000 },
+  { 0x6CCu, 0.11320000 },
+  { 0x6CEu, 0.02830000 },
+  { 0x6D5u, 0.13400000 },
+};
+
@@ -0,0 +1,151 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_53_UPPER[] = {
+  "A",
+  "B",
+  "D",
+  "E",
+  "F",
+  "H",
+  "I",
+  "J",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "Q",
+  "R",
+  "À",
+  "È",
+  "Ì",
+  "Ï",
+  "Ò",
+  "Ù",
+  "Ü",
+  "C",
+  "S",
+  "G",
+  "T",
+  "U",
+  "V",
+  "Z",
+};
+const char *ALPHA_53_LOWER[] = {
+  "a",
+  "b",
+  "d",
+  "e",
+  "f",
+  "h",
+  "i",
+  "j",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "q",
+  "r",
+  "à",
+  "è",
+  "ì",
+  "ï",
+  "ò",
+  "ù",
+  "ü",
+  "c",
+  "s",
+  "g",
+  "t",
+  "u",
+  "v",
+  "z",
+};
+const char *ALPHA_53_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_53_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 76, 77, 78, 79, 80, 81,
+  82, 83, 84, 85, 86, 90, 192, 200, 204, 207, 210, 217, 220,
+};
+const uint32_t ALPHA_53_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 108, 109, 110, 111, 112, 113,
+  114, 115, 116, 117, 118, 122, 224, 232, 236, 239, 242, 249, 252,
+};
+const uint32_t ALPHA_53_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_53_FREQ[] = {
+  { "a", 0.12190000 },
+  { "b", 0.00860000 },
+  { "d", 0.04010000 },
+  { "e", 0.06690000 },
+  { "f", 0.01140000 },
+  { "h", 0.02230000 },
+  { "i", 0.12530000 },
+  { "j", 0.00630000 },
+  { "l", 0.04490000 },
+  { "m", 0.02790000 },
+  { "n", 0.07390000 },
+  { "o", 0.03920000 },
+  { "p", 0.02780000 },
+  { "q", 0.00220000 },
+  { "r", 0.05850000 },
+  { "à", 0.00920000 },
+  { "è", 0.01420000 },
+  { "ì", 0.00320000 },
+  { "ï", 0.00000000 },
+  { "ò", 0.00230000 },
+  { "ù", 0.00310000 },
+  { "ü", 0.00000000 },
+  { "c", 0.05060000 },
+  { "s", 0.04980000 },
+  { "g", 0.01850000 },
+  { "t", 0.06300000 },
+  { "u", 0.08890000 },
+  { "v", 0.01200000 },
+  { "z", 0.00770000 },
+};
+
+const wa_cp_freq ALPHA_53_FREQ_CPS[] = {
+  { 0x61u, 0.12190000 },
+  { 0x62u, 0.00860000 },
+  { 0x63u, 0.05060000 },
+  { 0x64u, 0.04010000 },
+  { 0x65u, 0.06690000 },
+  { 0x66u, 0.01140000 },
+  { 0x67u, 0.01850000 },
+  { 0x68u, 0.02230000 },
+  { 0x69u, 0.12530000 },
+  { 0x6Au, 0.00630000 },
+  { 0x6Cu, 0.04490000 },
+  { 0x6Du, 0.02790000 },
+  { 0x6Eu, 0.07390000 },
+  { 0x6Fu, 0.03920000 },
+  { 0x70u, 0.02780000 },
+  { 0x71u, 0.00220000 },
+  { 0x72u, 0.05850000 },
+  { 0x73u, 0.04980000 },
+  { 0x74u, 0.06300000 },
+  { 0x75u, 0.08890000 },
+  { 0x76u, 0.01200000 },
+  { 0x7Au, 0.00770000 },
+  { 0xE0u, 0.00920000 },
+  { 0xE8u, 0.01420000 },
+  { 0xECu, 0.00320000 },
+  { 0xEFu, 0.00000000 },
+  { 0xF2u, 0.00230000 },
+  { 0xF9u, 0.00310000 },
+  { 0xFCu, 0.00000000 },
+};
+
@@ -0,0 +1,163 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_54_UPPER[] = {
+  "Ⲁ",
+  "Ⲃ",
+  "Ⲅ",
+  "Ⲇ",
+  "Ⲉ",
+  "Ⲋ",
+  "Ⲍ",
+  "Ⲏ",
+  "Ⲑ",
+  "Ⲓ",
+  "Ⲕ",
+  "Ⲗ",
+  "Ⲙ",
+  "Ⲛ",
+  "Ⲝ",
+  "Ⲟ",
+  "Ⲡ",
+  "Ⲣ",
+  "Ⲥ",
+  "Ⲧ",
+  "Ⲩ",
+  "Ⲫ",
+  "Ⲭ",
+  "Ⲯ",
+  "Ⲱ",
+  "Ϣ",
+  "Ϥ",
+  "Ϧ",
+  "Ϩ",
+  "Ϫ",
+  "Ϭ",
+  "Ϯ",
+};
+const char *ALPHA_54_LOWER[] = {
+  "ⲁ",
+  "ⲃ",
+  "ⲅ",
+  "ⲇ",
+  "ⲉ",
+  "ⲋ",
+  "ⲍ",
+  "ⲏ",
+  "ⲑ",
+  "ⲓ",
+  "ⲕ",
+  "ⲗ",
+  "ⲙ",
+  "ⲛ",
+  "ⲝ",
+  "ⲟ",
+  "ⲡ",
+  "ⲣ",
+  "ⲥ",
+  "ⲧ",
+  "ⲩ",
+  "ⲫ",
+  "ⲭ",
+  "ⲯ",
+  "ⲱ",
+  "ϣ",
+  "ϥ",
+  "ϧ",
+  "ϩ",
+  "ϫ",
+  "ϭ",
+  "ϯ",
+};
+const char *ALPHA_54_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_54_UPPER_CPS[] = {
+  994, 996, 998, 1000, 1002, 1004, 1006, 11392, 11394, 11396, 11398, 11400, 11402, 11404, 11406, 11408,
+  11410, 11412, 11414, 11416, 11418, 11420, 11422, 11424, 11426, 11428, 11430, 11432, 11434, 11436, 11438, 11440,
+};
+const uint32_t ALPHA_54_LOWER_CPS[] = {
+  995, 997, 999, 1001, 1003, 1005, 1007, 11393, 11395, 11397, 11399, 11401, 11403, 11405, 11407, 11409,
+  11411, 11413, 11415, 11417, 11419, 11421, 11423, 11425, 11427, 11429, 11431, 11433, 11435, 11437, 11439, 11441,
+};
+const uint32_t ALPHA_54_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_54_FREQ[] = {
+  { "ⲁ", 0.00000000 },
+  { "ⲃ", 0.00000000 },
+  { "ⲅ", 0.00000000 },
+  { "ⲇ", 0.00000000 },
+  { "ⲉ", 0.00000000 },
+  { "ⲋ", 0.00000000 },
+  { "ⲍ", 0.00000000 },
+  { "ⲏ", 0.00000000 },
+  { "ⲑ", 0.00000000 },
+  { "ⲓ", 0.00000000 },
+  { "ⲕ", 0.00000000 },
+  { "ⲗ", 0.00000000 },
+  { "ⲙ", 0.00000000 },
+  { "ⲛ", 0.00000000 },
+  { "ⲝ", 0.00000000 },
+  { "ⲟ", 0.00000000 },
+  { "ⲡ", 0.00000000 },
+  { "ⲣ", 0.00000000 },
+  { "ⲥ", 0.00000000 },
+  { "ⲧ", 0.00000000 },
+  { "ⲩ", 0.00000000 },
+  { "ⲫ", 0.00000000 },
+  { "ⲭ", 0.00000000 },
+  { "ⲯ", 0.00000000 },
+  { "ⲱ", 0.00000000 },
+  { "ϣ", 0.00000000 },
+  { "ϥ", 0.00000000 },
+  { "ϧ", 0.00000000 },
+  { "ϩ", 0.00000000 },
+  { "ϫ", 0.00000000 },
+  { "ϭ", 0.00000000 },
+  { "ϯ", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_54_FREQ_CPS[] = {
+  { 0x3E3u, 0.00000000 },
+  { 0x3E5u, 0.00000000 },
+  { 0x3E7u, 0.00000000 },
+  { 0x3E9u, 0.00000000 },
+  { 0x3EBu, 0.00000000 },
+  { 0x3EDu, 0.00000000 },
+  { 0x3EFu, 0.00000000 },
+  { 0x2C81u, 0.00000000 },
+  { 0x2C83u, 0.00000000 },
+  { 0x2C85u, 0.00000000 },
+  { 0x2C87u, 0.00000000 },
+  { 0x2C89u, 0.00000000 },
+  { 0x2C8Bu, 0.00000000 },
+  { 0x2C8Du, 0.00000000 },
+  { 0x2C8Fu, 0.00000000 },
+  { 0x2C91u, 0.00000000 },
+  { 0x2C93u, 0.00000000 },
+  { 0x2C95u, 0.00000000 },
+  { 0x2C97u, 0.00000000 },
+  { 0x2C99u, 0.00000000 },
+  { 0x2C9Bu, 0.00000000 },
+  { 0x2C9Du, 0.00000000 },
+  { 0x2C9Fu, 0.00000000 },
+  { 0x2CA1u, 0.00000000 },
+  { 0x2CA3u, 0.00000000 },
+  { 0x2CA5u, 0.00000000 },
+  { 0x2CA7u, 0.00000000 },
+  { 0x2CA9u, 0.00000000 },
+  { 0x2CABu, 0.00000000 },
+  { 0x2CADu, 0.00000000 },
+  { 0x2CAFu, 0.00000000 },
+  { 0x2CB1u, 0.00000000 },
+};
+
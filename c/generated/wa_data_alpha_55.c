@@ -0,0 +1,191 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_55_UPPER[] = {
+  "A",
+  "B",
+  "Č",
+  "D",
+  "E",
+  "F",
+  "G",
+  "C",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "Q",
+  "R",
+  "Ř",
+  "S",
+  "Š",
+  "T",
+  "U",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+  "Á",
+  "É",
+  "Í",
+  "Ó",
+  "Ú",
+  "Ý",
+  "Ď",
+  "Ě",
+  "Ň",
+  "Ť",
+  "Ů",
+  "Ž",
+};
+const char *ALPHA_55_LOWER[] = {
+  "a",
+  "b",
+  "č",
+  "d",
+  "e",
+  "f",
+  "g",
+  "c",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "q",
+  "r",
+  "ř",
+  "s",
+  "š",
+  "t",
+  "u",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+  "á",
+  "é",
+  "í",
+  "ó",
+  "ú",
+  "ý",
+  "ď",
+  "ě",
+  "ň",
+  "ť",
+  "ů",
+  "ž",
+};
+const char *ALPHA_55_DIGITS[] = {
+};
+const uint32_t ALPHA_55_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 193, 201, 205, 211, 218, 221,
+  268, 270, 282, 327, 344, 352, 356, 366, 381,
+};
+const uint32_t ALPHA_55_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 225, 233, 237, 243, 250, 253,
+  269, 271, 283, 328, 345, 353, 357, 367, 382,
+};
+const uint32_t ALPHA_55_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_55_FREQ[] = {
+  { "a", 0.07150000 },
+  { "b", 0.01780000 },
+  { "č", 0.00860000 },
+  { "d", 0.03380000 },
+  { "e", 0.07690000 },
+  { "f", 0.00430000 },
+  { "g", 0.00470000 },
+  { "c", 0.02630000 },
+  { "h", 0.02380000 },
+  { "i", 0.04580000 },
+  { "j", 0.01840000 },
+  { "k", 0.03820000 },
+  { "l", 0.04560000 },
+  { "m", 0.03090000 },
+  { "n", 0.06370000 },
+  { "o", 0.08250000 },
+  { "p", 0.03090000 },
+  { "q", 0.00010000 },
+  { "r", 0.04370000 },
+  { "ř", 0.01050000 },
+  { "s", 0.04790000 },
+  { "š", 0.00680000 },
+  { "t", 0.05080000 },
+  { "u", 0.03130000 },
+  { "v", 0.04470000 },
+  { "w", 0.00100000 },
+  { "x", 0.00100000 },
+  { "y", 0.01860000 },
+  { "z", 0.02060000 },
+  { "á", 0.02020000 },
+  { "é", 0.01210000 },
+  { "í", 0.02800000 },
+  { "ó", 0.00040000 },
+  { "ú", 0.00150000 },
+  { "ý", 0.00910000 },
+  { "ď", 0.00020000 },
+  { "ě", 0.01380000 },
+  { "ň", 0.00050000 },
+  { "ť", 0.00030000 },
+  { "ů", 0.00470000 },
+  { "ž", 0.00850000 },
+};
+
+const wa_cp_freq ALPHA_55_FREQ_CPS[] = {
+  { 0x61u, 0.07150000 },
+  { 0x62u, 0.01780000 },
+  { 0x63u, 0.02630000 },
+  { 0x64u, 0.03380000 },
+  { 0x65u, 0.07690000 },
+  { 0x66u, 0.00430000 },
+  { 0x67u, 0.00470000 },
+  { 0x68u, 0.02380000 },
+  { 0x69u, 0.04580000 },
+  { 0x6Au, 0.01840000 },
+  { 0x6Bu, 0.03820000 },
+  { 0x6Cu, 0.04560000 },
+  { 0x6Du, 0.03090000 },
+  { 0x6Eu, 0.06370000 },
+  { 0x6Fu, 0.08250000 },
+  { 0x70u, 0.03090000 },
+  { 0x71u, 0.00010000 },
+  { 0x72u, 0.04370000 },
+  { 0x73u, 0.04790000 },
+  { 0x74u, 0.05080000 },
+  { 0x75u, 0.03130000 },
+  { 0x76u, 0.04470000 },
+  { 0x77u, 0.00100000 },
+  { 0x78u, 0.00100000 },
+  { 0x79u, 0.01860000 },
+  { 0x7Au, 0.02060000 },
+  { 0xE1u, 0.02020000 },
+  { 0xE9u, 0.01210000 },
+  { 0xEDu, 0.02800000 },
+  { 0xF3u, 0.00040000 },
+  { 0xFAu, 0.00150000 },
+  { 0xFDu, 0.00910000 },
+  { 0x10Du, 0.00860000 },
+  { 0x10Fu, 0.00020000 },
+  { 0x11Bu, 0.01380000 },
+  { 0x148u, 0.00050000 },
+  { 0x159u, 0.01050000 },
+  { 0x161u, 0.00680000 },
+  { 0x165u, 0.00030000 },
+  { 0x16Fu, 0.00470000 },
+  { 0x17Eu, 0.00850000 },
+};
+
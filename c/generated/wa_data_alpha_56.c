@@ -0,0 +1,433 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_56_UPPER[] = {
+  "ᐁ",
+  "ᐃ",
+  "ᐄ",
+  "ᐅ",
+  "ᐆ",
+  "ᐊ",
+  "ᐋ",
+  "ᐍ",
+  "ᐏ",
+  "ᐑ",
+  "ᐓ",
+  "ᐕ",
+  "ᐘ",
+  "ᐚ",
+  "ᐟ",
+  "ᐠ",
+  "ᐢ",
+  "ᐣ",
+  "ᐤ",
+  "ᐦ",
+  "ᐨ",
+  "ᐯ",
+  "ᐱ",
+  "ᐲ",
+  "ᐳ",
+  "ᐴ",
+  "ᐸ",
+  "ᐹ",
+  "ᑊ",
+  "ᑌ",
+  "ᑎ",
+  "ᑏ",
+  "ᑐ",
+  "ᑑ",
+  "ᑕ",
+  "ᑖ",
+  "ᑫ",
+  "ᑭ",
+  "ᑮ",
+  "ᑯ",
+  "ᑰ",
+  "ᑲ",
+  "ᑳ",
+  "ᒉ",
+  "ᒋ",
+  "ᒌ",
+  "ᒍ",
+  "ᒎ",
+  "ᒐ",
+  "ᒑ",
+  "ᒣ",
+  "ᒥ",
+  "ᒦ",
+  "ᒧ",
+  "ᒨ",
+  "ᒪ",
+  "ᒫ",
+  "ᒼ",
+  "ᓀ",
+  "ᓂ",
+  "ᓃ",
+  "ᓄ",
+  "ᓅ",
+  "ᓇ",
+  "ᓈ",
+  "ᓓ",
+  "ᓕ",
+  "ᓖ",
+  "ᓗ",
+  "ᓘ",
+  "ᓚ",
+  "ᓛ",
+  "ᓫ",
+  "ᓭ",
+  "ᓯ",
+  "ᓰ",
+  "ᓱ",
+  "ᓲ",
+  "ᓴ",
+  "ᓵ",
+  "ᔦ",
+  "ᔨ",
+  "ᔩ",
+  "ᔪ",
+  "ᔫ",
+  "ᔭ",
+  "ᔮ",
+  "ᕀ",
+  "ᕃ",
+  "ᕆ",
+  "ᕇ",
+  "ᕈ",
+  "ᕉ",
+  "ᕋ",
+  "ᕌ",
+  "ᕑ",
+  "ᕽ",
+};
+const char *ALPHA_56_LOWER[] = {
+  "ᐁ",
+  "ᐃ",
+  "ᐄ",
+  "ᐅ",
+  "ᐆ",
+  "ᐊ",
+  "ᐋ",
+  "ᐍ",
+  "ᐏ",
+  "ᐑ",
+  "ᐓ",
+  "ᐕ",
+  "ᐘ",
+  "ᐚ",
+  "ᐟ",
+  "ᐠ",
+  "ᐢ",
+  "ᐣ",
+  "ᐤ",
+  "ᐦ",
+  "ᐨ",
+  "ᐯ",
+  "ᐱ",
+  "ᐲ",
+  "ᐳ",
+  "ᐴ",
+  "ᐸ",
+  "ᐹ",
+  "ᑊ",
+  "ᑌ",
+  "ᑎ",
+  "ᑏ",
+  "ᑐ",
+  "ᑑ",
+  "ᑕ",
+  "ᑖ",
+  "ᑫ",
+  "ᑭ",
+  "ᑮ",
+  "ᑯ",
+  "ᑰ",
+  "ᑲ",
+  "ᑳ",
+  "ᒉ",
+  "ᒋ",
+  "ᒌ",
+  "ᒍ",
+  "ᒎ",
+  "ᒐ",
+  "ᒑ",
+  "ᒣ",
+  "ᒥ",
+  "ᒦ",
+  "ᒧ",
+  "ᒨ",
+  "ᒪ",
+  "ᒫ",
+  "ᒼ",
+  "ᓀ",
+  "ᓂ",
+  "ᓃ",
+  "ᓄ",
+  "ᓅ",
+  "ᓇ",
+  "ᓈ",
+  "ᓓ",
+  "ᓕ",
+  "ᓖ",
+  "ᓗ",
+  "ᓘ",
+  "ᓚ",
+  "ᓛ",
+  "ᓫ",
+  "ᓭ",
+  "ᓯ",
+  "ᓰ",
+  "ᓱ",
+  "ᓲ",
+  "ᓴ",
+  "ᓵ",
+  "ᔦ",
+  "ᔨ",
+  "ᔩ",
+  "ᔪ",
+  "ᔫ",
+  "ᔭ",
+  "ᔮ",
+  "ᕀ",
+  "ᕃ",
+  "ᕆ",
+  "ᕇ",
+  "ᕈ",
+  "ᕉ",
+  "ᕋ",
+  "ᕌ",
+  "ᕑ",
+  "ᕽ",
+};
+const char *ALPHA_56_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_56_UPPER_CPS[] = {
+  5121, 5123, 5124, 5125, 5126, 5130, 5131, 5133, 5135, 5137, 5139, 5141, 5144, 5146, 5151, 5152,
+  5154, 5155, 5156, 5158, 5160, 5167, 5169, 5170, 5171, 5172, 5176, 5177, 5194, 5196, 5198, 5199,
+  5200, 5201, 5205, 5206, 5227, 5229, 5230, 5231, 5232, 5234, 5235, 5257, 5259, 5260, 5261, 5262,
+  5264, 5265, 5283, 5285, 5286, 5287, 5288, 5290, 5291, 5308, 5312, 5314, 5315, 5316, 5317, 5319,
+  5320, 5331, 5333, 5334, 5335, 5336, 5338, 5339, 5355, 5357, 5359, 5360, 5361, 5362, 5364, 5365,
+  5414, 5416, 5417, 5418, 5419, 5421, 5422, 5440, 5443, 5446, 5447, 5448, 5449, 5451, 5452, 5457,
+  5501,
+};
+const uint32_t ALPHA_56_LOWER_CPS[] = {
+  5121, 5123, 5124, 5125, 5126, 5130, 5131, 5133, 5135, 5137, 5139, 5141, 5144, 5146, 5151, 5152,
+  5154, 5155, 5156, 5158, 5160, 5167, 5169, 5170, 5171, 5172, 5176, 5177, 5194, 5196, 5198, 5199,
+  5200, 5201, 5205, 5206, 5227, 5229, 5230, 5231, 5232, 5234, 5235, 5257, 5259, 5260, 5261, 5262,
+  5264, 5265, 5283, 5285, 5286, 5287, 5288, 5290, 5291, 5308, 5312, 5314, 5315, 5316, 5317, 5319,
+  5320, 5331, 5333, 5334, 5335, 5336, 5338, 5339, 5355, 5357, 5359, 5360, 5361, 5362, 5364, 5365,
+  5414, 5416, 5417, 5418, 5419, 5421, 5422, 5440, 5443, 5446, 5447, 5448, 5449, 5451, 5452, 5457,
+  5501,
+};
+const uint32_t ALPHA_56_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_56_FREQ[] = {
+  { "ᐁ", 0.00000000 },
+  { "ᐃ", 0.00000000 },
+  { "ᐄ", 0.00000000 },
+  { "ᐅ", 0.00000000 },
+  { "ᐆ", 0.00000000 },
+  { "ᐊ", 0.00000000 },
+  { "ᐋ", 0.00000000 },
+  { "ᐍ", 0.00000000 },
+  { "ᐏ", 0.00000000 },
+  { "ᐑ", 0.00000000 },
+  { "ᐓ", 0.00000000 },
+  { "ᐕ", 0.00000000 },
+  { "ᐘ", 0.00000000 },
+  { "ᐚ", 0.00000000 },
+  { "ᐟ", 0.00000000 },
+  { "ᐠ", 0.00000000 },
+  { "ᐢ", 0.00000000 },
+  { "ᐣ", 0.00000000 },
+  { "ᐤ", 0.00000000 },
+  { "ᐦ", 0.00000000 },
+  { "ᐨ", 0.00000000 },
+  { "ᐯ", 0.00000000 },
+  { "ᐱ", 0.00000000 },
+  { "ᐲ", 0.00000000 },
+  { "ᐳ", 0.00000000 },
+  { "ᐴ", 0.00000000 },
+  { "ᐸ", 0.00000000 },
+  { "ᐹ", 0.00000000 },
+  { "ᑊ", 0.00000000 },
+  { "ᑌ", 0.00000000 },
+  { "ᑎ", 0.00000000 },
+  { "ᑏ", 0.00000000 },
+  { "ᑐ", 0.00000000 },
+  { "ᑑ", 0.00000000 },
+  { "ᑕ", 0.00000000 },
+  { "ᑖ", 0.00000000 },
+  { "ᑫ", 0.00000000 },
+  { "ᑭ", 0.00000000 },
+  { "ᑮ", 0.00000000 },
+  { "ᑯ", 0.00000000 },
+  { "ᑰ", 0.00000000 },
+  { "ᑲ", 0.00000000 },
+  { "ᑳ", 0.00000000 },
+  { "ᒉ", 0.00000000 },
+  { "ᒋ", 0.00000000 },
+  { "ᒌ", 0.00000000 },
+  { "ᒍ", 0.00000000 },
+  { "ᒎ", 0.00000000 },
+  { "ᒐ", 0.00000000 },
+  { "ᒑ", 0.00000000 },
+  { "ᒣ", 0.00000000 },
+  { "ᒥ", 0.00000000 },
+  { "ᒦ", 0.00000000 },
+  { "ᒧ", 0.00000000 },
+  { "ᒨ", 0.00000000 },
+  { "ᒪ", 0.00000000 },
+  { "ᒫ", 0.00000000 },
+  { "ᒼ", 0.00000000 },
+  { "ᓀ", 0.00000000 },
+  { "ᓂ", 0.00000000 },
+  { "ᓃ", 0.00000000 },
+  { "ᓄ", 0.00000000 },
+  { "ᓅ", 0.00000000 },
+  { "ᓇ", 0.00000000 },
+  { "ᓈ", 0.00000000 },
+  { "ᓓ", 0.00000000 },
+  { "ᓕ", 0.00000000 },
+  { "ᓖ", 0.00000000 },
+  { "ᓗ", 0.00000000 },
+  { "ᓘ", 0.00000000 },
+  { "ᓚ", 0.00000000 },
+  { "ᓛ", 0.00000000 },
+  { "ᓫ", 0.00000000 },
+  { "ᓭ", 0.00000000 },
+  { "ᓯ", 0.00000000 },
+  { "ᓰ", 0.00000000 },
+  { "ᓱ", 0.00000000 },
+  { "ᓲ", 0.00000000 },
+  { "ᓴ", 0.00000000 },
+  { "ᓵ", 0.00000000 },
+  { "ᔦ", 0.00000000 },
+  { "ᔨ", 0.00000000 },
+  { "ᔩ", 0.00000000 },
+  { "ᔪ", 0.00000000 },
+  { "ᔫ", 0.00000000 },
+  { "ᔭ", 0.00000000 },
+  { "ᔮ", 0.00000000 },
+  { "ᕀ", 0.00000000 },
+  { "ᕃ", 0.00000000 },
+  { "ᕆ", 0.00000000 },
+  { "ᕇ", 0.00000000 },
+  { "ᕈ", 0.00000000 },
+  { "ᕉ", 0.00000000 },
+  { "ᕋ", 0.00000000 },
+  { "ᕌ", 0.00000000 },
+  { "ᕑ", 0.00000000 },
+  { "ᕽ", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_56_FREQ_CPS[] = {
+  { 0x1401u, 0.00000000 },
+  { 0x1403u, 0.00000000 },
+  { 0x1404u, 0.00000000 },
+  { 0x1405u, 0.00000000 },
+  { 0x1406u, 0.00000000 },
+  { 0x140Au, 0.00000000 },
+  { 0x140Bu, 0.00000000 },
+  { 0x140Du, 0.00000000 },
+  { 0x140Fu, 0.00000000 },
+  { 0x1411u, 0.00000000 },
+  { 0x1413u, 0.00000000 },
+  { 0x1415u, 0.00000000 },
+  { 0x1418u, 0.00000000 },
+  { 0x141Au, 0.00000000 },
+  { 0x141Fu, 0.00000000 },
+  { 0x1420u, 0.00000000 },
+  { 0x1422u, 0.00000000 },
+  { 0x1423u, 0.00000000 },
+  { 0x1424u, 0.00000000 },
+  { 0x1426u, 0.00000000 },
+  { 0x1428u, 0.00000000 },
+  { 0x142Fu, 0.00000000 },
+  { 0x1431u, 0.00000000 },
+  { 0x1432u, 0.00000000 },
+  { 0x1433u, 0.00000000 },
+  { 0x1434u, 0.00000000 },
+  { 0x1438u, 0.00000000 },
+  { 0x1439u, 0.00000000 },
+  { 0x144Au, 0.00000000 },
+  { 0x144Cu, 0.00000000 },
+  { 0x144Eu, 0.00000000 },
+  { 0x144Fu, 0.00000000 },
+  { 0x1450u, 0.00000000 },
+  { 0x1451u, 0.00000000 },
+  { 0x1455u, 0.00000000 },
+  { 0x1456u, 0.00000000 },
+  { 0x146Bu, 0.00000000 },
+  { 0x146Du, 0.00000000 },
+  { 0x146Eu, 0.00000000 },
+  { 0x146Fu, 0.00000000 },
+  { 0x1470u, 0.00000000 },
+  { 0x1472u, 0.00000000 },
+  { 0x1473u, 0.00000000 },
+  { 0x1489u, 0.00000000 },
+  { 0x148Bu, 0.00000000 },
+  { 0x148Cu, 0.00000000 },
+  { 0x148Du, 0.00000000 },
+  { 0x148Eu, 0.00000000 },
+  { 0x1490u, 0.00000000 },
+  { 0x1491u, 0.00000000 },
+  { 0x14A3u, 0.00000000 },
+  { 0x14A5u, 0.00000000 },
+  { 0x14A6u, 0.00000000 },
+  { 0x14A7u, 0.00000000 },
+  { 0x14A8u, 0.00000000 },
+  { 0x14AAu, 0.00000000 },
+  { 0x14ABu, 0.00000000 },
+  { 0x14BCu, 0.00000000 },
+  { 0x14C0u, 0.00000000 },
+  { 0x14C2u, 0.00000000 },
+  { 0x14C3u, 0.00000000 },
+  { 0x14C4u, 0.00000000 },
+  { 0x14C5u, 0.00000000 },
+  { 0x14C7u, 0.00000000 },
+  { 0x14C8u, 0.00000000 },
+  { 0x14D3u, 0.00000000 },
+  { 0x14D5u, 0.00000000 },
+  { 0x14D6u, 0.00000000 },
+  { 0x14D7u, 0.00000000 },
+  { 0x14D8u, 0.00000000 },
+  { 0x14DAu, 0.00000000 },
+  { 0x14DBu, 0.00000000 },
+  { 0x14EBu, 0.00000000 },
+  { 0x14EDu, 0.00000000 },
+  { 0x14EFu, 0.00000000 },
+  { 0x14F0u, 0.00000000 },
+  { 0x14F1u, 0.00000000 },
+  { 0x14F2u, 0.00000000 },
+  { 0x14F4u, 0.00000000 },
+  { 0x14F5u, 0.00000000 },
+  { 0x1526u, 0.00000000 },
+  { 0x1528u, 0.00000000 },
+  { 0x1529u, 0.00000000 },
+  { 0x152Au, 0.00000000 },
+  { 0x152Bu, 0.00000000 },
+  { 0x152Du, 0.00000000 },
+  { 0x152Eu, 0.00000000 },
+  { 0x1540u, 0.00000000 },
+  { 0x1543u, 0.00000000 },
+  { 0x1546u, 0.00000000 },
+  { 0x1547u, 0.00000000 },
+  { 0x1548u, 0.00000000 },
+  { 0x1549u, 0.00000000 },
+  { 0x154Bu, 0.00000000 },
+  { 0x154Cu, 0.00000000 },
+  { 0x1551u, 0.00000000 },
+  { 0x157Du, 0.00000000 },
+};
+
@@ -0,0 +1,247 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_57_UPPER[] = {
+  "А",
+  "Б",
+  "В",
+  "Г",
+  "Д",
+  "Є",
+  "Ж",
+  "Ѕ",
+  "З",
+  "И",
+  "І",
+  "К",
+  "Л",
+  "М",
+  "Н",
+  "Ѻ",
+  "О",
+  "П",
+  "Р",
+  "С",
+  "Т",
+  "Ꙋ",
+  "Ф",
+  "Х",
+  "Ѡ",
+  "Ѿ",
+  "Ц",
+  "Ч",
+  "Ш",
+  "Щ",
+  "Ъ",
+  "Ы",
+  "Ь",
+  "Ѣ",
+  "Ю",
+  "Ѫ",
+  "Ꙗ",
+  "Ѧ",
+  "Ѯ",
+  "Ѱ",
+  "Ѳ",
+  "Ѵ",
+  "Е",
+  "Й",
+  "У",
+  "Ї",
+  "Ѷ",
+  "Ѽ",
+  "ⸯ",
+  "Ꙁ",
+  "Ꙍ",
+  "ꙿ",
+};
+const char *ALPHA_57_LOWER[] = {
+  "а",
+  "б",
+  "в",
+  "г",
+  "д",
+  "є",
+  "ж",
+  "ѕ",
+  "з",
+  "и",
+  "і",
+  "к",
+  "л",
+  "м",
+  "н",
+  "ѻ",
+  "о",
+  "п",
+  "р",
+  "с",
+  "т",
+  "ꙋ",
+  "ф",
+  "х",
+  "ѡ",
+  "ѿ",
+  "ц",
+  "ч",
+  "ш",
+  "щ",
+  "ъ",
+  "ы",
+  "ь",
+  "ѣ",
+  "ю",
+  "ѫ",
+  "ꙗ",
+  "ѧ",
+  "ѯ",
+  "ѱ",
+  "ѳ",
+  "ѵ",
+  "е",
+  "й",
+  "у",
+  "ї",
+  "ѷ",
+  "ѽ",
+  "ⸯ",
+  "ꙁ",
+  "ꙍ",
+  "ꙿ",
+};
+const char *ALPHA_57_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_57_UPPER_CPS[] = {
+  1028, 1029, 1030, 1031, 1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051,
+  1052, 1053, 1054, 1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066, 1067,
+  1068, 1070, 1120, 1122, 1126, 1130, 1134, 1136, 1138, 1140, 1142, 1146, 1148, 1150, 11823, 42560,
+  42570, 42572, 42582, 42623,
+};
+const uint32_t ALPHA_57_LOWER_CPS[] = {
+  1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080, 1081, 1082, 1083, 1084, 1085, 1086, 1087,
+  1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097, 1098, 1099, 1100, 1102, 1108, 1109,
+  1110, 1111, 1121, 1123, 1127, 1131, 1135, 1137, 1139, 1141, 1143, 1147, 1149, 1151, 11823, 42561,
+  42571, 42573, 42583, 42623,
+};
+const uint32_t ALPHA_57_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_57_FREQ[] = {
+  { "а", 0.08390000 },
+  { "б", 0.01950000 },
+  { "в", 0.03530000 },
+  { "г", 0.01750000 },
+  { "д", 0.03730000 },
+  { "є", 0.03570000 },
+  { "ж", 0.01210000 },
+  { "ѕ", 0.00010000 },
+  { "з", 0.00000000 },
+  { "и", 0.06880000 },
+  { "і", 0.00380000 },
+  { "к", 0.03520000 },
+  { "л", 0.04410000 },
+  { "м", 0.02470000 },
+  { "н", 0.05350000 },
+  { "ѻ", 0.00000000 },
+  { "о", 0.06970000 },
+  { "п", 0.01670000 },
+  { "р", 0.05150000 },
+  { "с", 0.07480000 },
+  { "т", 0.06190000 },
+  { "ꙋ", 0.00000000 },
+  { "ф", 0.00180000 },
+  { "х", 0.00570000 },
+  { "ѡ", 0.00520000 },
+  { "ѿ", 0.00000000 },
+  { "ц", 0.00650000 },
+  { "ч", 0.00770000 },
+  { "ш", 0.00400000 },
+  { "щ", 0.00330000 },
+  { "ъ", 0.06980000 },
+  { "ы", 0.00000000 },
+  { "ь", 0.05020000 },
+  { "ѣ", 0.03210000 },
+  { "ю", 0.00520000 },
+  { "ѫ", 0.00650000 },
+  { "ꙗ", 0.00920000 },
+  { "ѧ", 0.00650000 },
+  { "ѯ", 0.00060000 },
+  { "ѱ", 0.00000000 },
+  { "ѳ", 0.00070000 },
+  { "ѵ", 0.00210000 },
+  { "е", 0.00000000 },
+  { "й", 0.00000000 },
+  { "у", 0.01030000 },
+  { "ї", 0.01150000 },
+  { "ѷ", 0.00150000 },
+  { "ѽ", 0.00000000 },
+  { "ⸯ", 0.00000000 },
+  { "ꙁ", 0.01330000 },
+  { "ꙍ", 0.00000000 },
+  { "ꙿ", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_57_FREQ_CPS[] = {
+  { 0x430u, 0.08390000 },
+  { 0x431u, 0.01950000 },
+  { 0x432u, 0.03530000 },
+  { 0x433u, 0.01750000 },
+  { 0x434u, 0.03730000 },
+  { 0x435u, 0.00000000 },
+  { 0x436u, 0.01210000 },
+  { 0x437u, 0.00000000 },
+  { 0x438u, 0.06880000 },
+  { 0x439u, 0.00000000 },
+  { 0x43Au, 0.03520000 },
+  { 0x43Bu, 0.04410000 },
+  { 0x43Cu, 0.02470000 },
+  { 0x43Du, 0.05350000 },
+  { 0x43Eu, 0.06970000 },
+  { 0x43Fu, 0.01670000 },
+  { 0x440u, 0.05150000 },
+  { 0x441u, 0.07480000 },
+  { 0x442u, 0.06190000 },
+  { 0x443u, 0.01030000 },
+  { 0x444u, 0.00180000 },
+  { 0x445u, 0.00570000 },
+  { 0x446u, 0.00650000 },
+  { 0x447u, 0.00770000 },
+  { 0x448u, 0.00400000 },
+  { 0x449u, 0.00330000 },
+  { 0x44Au, 0.06980000 },
+  { 0x44Bu, 0.00000000 },
+  { 0x44Cu, 0.05020000 },
+  { 0x44Eu, 0.00520000 },
+  { 0x454u, 0.03570000 },
+  { 0x455u, 0.00010000 },
+  { 0x456u, 0.00380000 },
+  { 0x457u, 0.01150000 },
+  { 0x461u, 0.00520000 },
+  { 0x463u, 0.03210000 },
+  { 0x467u, 0.00650000 },
+  { 0x46Bu, 0.00650000 },
+  { 0x46Fu, 0.00060000 },
+  { 0x471u, 0.00000000 },
+  { 0x473u, 0.00070000 },
+  { 0x475u, 0.00210000 },
+  { 0x477u, 0.00150000 },
+  { 0x47Bu, 0.00000000 },
+  { 0x47Du, 0.00000000 },
+  { 0x47Fu, 0.00000000 },
+  { 0x2E2Fu, 0.00000000 },
+  { 0xA641u, 0.01330000 },
+  { 0xA64Bu, 0.00000000 },
+  { 0xA64Du, 0.00000000 },
+  { 0xA657u, 0.00920000 },
+  { 0xA67Fu, 0.00000000 },
+};
+
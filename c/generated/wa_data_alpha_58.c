@@ -0,0 +1,185 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_58_UPPER[] = {
+  "А",
+  "Ӑ",
+  "Б",
+  "В",
+  "Г",
+  "Д",
+  "Е",
+  "Ӗ",
+  "Ё",
+  "Ж",
+  "З",
+  "И",
+  "Й",
+  "К",
+  "Л",
+  "М",
+  "Н",
+  "О",
+  "П",
+  "Р",
+  "С",
+  "Ҫ",
+  "Т",
+  "У",
+  "Ӳ",
+  "Ф",
+  "Х",
+  "Ц",
+  "Ч",
+  "Ш",
+  "Щ",
+  "Ъ",
+  "Ы",
+  "Ь",
+  "Э",
+  "Ю",
+  "Я",
+};
+const char *ALPHA_58_LOWER[] = {
+  "а",
+  "ӑ",
+  "б",
+  "в",
+  "г",
+  "д",
+  "е",
+  "ӗ",
+  "ё",
+  "ж",
+  "з",
+  "и",
+  "й",
+  "к",
+  "л",
+  "м",
+  "н",
+  "о",
+  "п",
+  "р",
+  "с",
+  "ҫ",
+  "т",
+  "у",
+  "ӳ",
+  "ф",
+  "х",
+  "ц",
+  "ч",
+  "ш",
+  "щ",
+  "ъ",
+  "ы",
+  "ь",
+  "э",
+  "ю",
+  "я",
+};
+const char *ALPHA_58_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_58_UPPER_CPS[] = {
+  1025, 1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053, 1054,
+  1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069, 1070,
+  1071, 1194, 1232, 1238, 1266,
+};
+const uint32_t ALPHA_58_LOWER_CPS[] = {
+  1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080, 1081, 1082, 1083, 1084, 1085, 1086, 1087,
+  1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103,
+  1105, 1195, 1233, 1239, 1267,
+};
+const uint32_t ALPHA_58_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_58_FREQ[] = {
+  { "а", 0.11930000 },
+  { "ӑ", 0.00010000 },
+  { "б", 0.00530000 },
+  { "в", 0.03100000 },
+  { "г", 0.00620000 },
+  { "д", 0.00830000 },
+  { "е", 0.08400000 },
+  { "ӗ", 0.00020000 },
+  { "ё", 0.00050000 },
+  { "ж", 0.00140000 },
+  { "з", 0.00340000 },
+  { "и", 0.05810000 },
+  { "й", 0.01510000 },
+  { "к", 0.04150000 },
+  { "л", 0.06630000 },
+  { "м", 0.03440000 },
+  { "н", 0.09810000 },
+  { "о", 0.02530000 },
+  { "п", 0.03990000 },
+  { "р", 0.07570000 },
+  { "с", 0.04670000 },
+  { "ҫ", 0.00000000 },
+  { "т", 0.07020000 },
+  { "у", 0.04760000 },
+  { "ӳ", 0.00320000 },
+  { "ф", 0.00370000 },
+  { "х", 0.03340000 },
+  { "ц", 0.00340000 },
+  { "ч", 0.02410000 },
+  { "ш", 0.02030000 },
+  { "щ", 0.00030000 },
+  { "ъ", 0.00020000 },
+  { "ы", 0.01250000 },
+  { "ь", 0.00780000 },
+  { "э", 0.00230000 },
+  { "ю", 0.00310000 },
+  { "я", 0.00700000 },
+};
+
+const wa_cp_freq ALPHA_58_FREQ_CPS[] = {
+  { 0x430u, 0.11930000 },
+  { 0x431u, 0.00530000 },
+  { 0x432u, 0.03100000 },
+  { 0x433u, 0.00620000 },
+  { 0x434u, 0.00830000 },
+  { 0x435u, 0.08400000 },
+  { 0x436u, 0.00140000 },
+  { 0x437u, 0.00340000 },
+  { 0x438u, 0.05810000 },
+  { 0x439u, 0.01510000 },
+  { 0x43Au, 0.04150000 },
+  { 0x43Bu, 0.06630000 },
+  { 0x43Cu, 0.03440000 },
+  { 0x43Du, 0.09810000 },
+  { 0x43Eu, 0.02530000 },
+  { 0x43Fu, 0.03990000 },
+  { 0x440u, 0.07570000 },
+  { 0x441u, 0.04670000 },
+  { 0x442u, 0.07020000 },
+  { 0x443u, 0.04760000 },
+  { 0x444u, 0.00370000 },
+  { 0x445u, 0.03340000 },
+  { 0x446u, 0.00340000 },
+  { 0x447u, 0.02410000 },
+  { 0x448u, 0.02030000 },
+  { 0x449u, 0.00030000 },
+  { 0x44Au, 0.00020000 },
+  { 0x44Bu, 0.01250000 },
+  { 0x44Cu, 0.00780000 },
+  { 0x44Du, 0.00230000 },
+  { 0x44Eu, 0.00310000 },
+  { 0x44Fu, 0.00700000 },
+  { 0x451u, 0.00050000 },
+  { 0x4ABu, 0.00000000 },
+  { 0x4D1u, 0.00010000 },
+  { 0x4D7u, 0.00020000 },
+  { 0x4F3u, 0.00320000 },
+};
+
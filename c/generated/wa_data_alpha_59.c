@@ -0,0 +1,235 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_59_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "I",
+  "J",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "À",
+  "Á",
+  "Â",
+  "Ä",
+  "È",
+  "É",
+  "Ê",
+  "Ë",
+  "Ì",
+  "Í",
+  "Î",
+  "Ï",
+  "Ò",
+  "Ó",
+  "Ô",
+  "Ö",
+  "Ù",
+  "Ú",
+  "Û",
+  "Ü",
+  "Ý",
+  "Ÿ",
+  "Ŵ",
+  "Ŷ",
+  "Ẁ",
+  "Ẃ",
+  "Ẅ",
+  "Ỳ",
+  "R",
+  "S",
+  "T",
+  "H",
+  "U",
+  "W",
+  "Y",
+};
+const char *ALPHA_59_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "i",
+  "j",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "à",
+  "á",
+  "â",
+  "ä",
+  "è",
+  "é",
+  "ê",
+  "ë",
+  "ì",
+  "í",
+  "î",
+  "ï",
+  "ò",
+  "ó",
+  "ô",
+  "ö",
+  "ù",
+  "ú",
+  "û",
+  "ü",
+  "ý",
+  "ÿ",
+  "ŵ",
+  "ŷ",
+  "ẁ",
+  "ẃ",
+  "ẅ",
+  "ỳ",
+  "r",
+  "s",
+  "t",
+  "h",
+  "u",
+  "w",
+  "y",
+};
+const char *ALPHA_59_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_59_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 76, 77, 78, 79, 80, 82,
+  83, 84, 85, 87, 89, 192, 193, 194, 196, 200, 201, 202, 203, 204, 205, 206,
+  207, 210, 211, 212, 214, 217, 218, 219, 220, 221, 372, 374, 376, 7808, 7810, 7812,
+  7922,
+};
+const uint32_t ALPHA_59_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 108, 109, 110, 111, 112, 114,
+  115, 116, 117, 119, 121, 224, 225, 226, 228, 232, 233, 234, 235, 236, 237, 238,
+  239, 242, 243, 244, 246, 249, 250, 251, 252, 253, 255, 373, 375, 7809, 7811, 7813,
+  7923,
+};
+const uint32_t ALPHA_59_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_59_FREQ[] = {
+  { "a", 0.10100000 },
+  { "b", 0.01570000 },
+  { "c", 0.02880000 },
+  { "d", 0.09120000 },
+  { "e", 0.08240000 },
+  { "f", 0.03290000 },
+  { "g", 0.03770000 },
+  { "i", 0.06660000 },
+  { "j", 0.00090000 },
+  { "l", 0.05170000 },
+  { "m", 0.02490000 },
+  { "n", 0.08250000 },
+  { "o", 0.05660000 },
+  { "p", 0.00930000 },
+  { "à", 0.00000000 },
+  { "á", 0.00010000 },
+  { "â", 0.00090000 },
+  { "ä", 0.00000000 },
+  { "è", 0.00000000 },
+  { "é", 0.00020000 },
+  { "ê", 0.00020000 },
+  { "ë", 0.00000000 },
+  { "ì", 0.00000000 },
+  { "í", 0.00000000 },
+  { "î", 0.00010000 },
+  { "ï", 0.00010000 },
+  { "ò", 0.00000000 },
+  { "ó", 0.00000000 },
+  { "ô", 0.00140000 },
+  { "ö", 0.00010000 },
+  { "ù", 0.00000000 },
+  { "ú", 0.00000000 },
+  { "û", 0.00000000 },
+  { "ü", 0.00000000 },
+  { "ý", 0.00000000 },
+  { "ÿ", 0.00000000 },
+  { "ŵ", 0.00040000 },
+  { "ŷ", 0.00030000 },
+  { "ẁ", 0.00000000 },
+  { "ẃ", 0.00000000 },
+  { "ẅ", 0.00000000 },
+  { "ỳ", 0.00000000 },
+  { "r", 0.07710000 },
+  { "s", 0.03050000 },
+  { "t", 0.03000000 },
+  { "h", 0.03500000 },
+  { "u", 0.02530000 },
+  { "w", 0.03760000 },
+  { "y", 0.07830000 },
+};
+
+const wa_cp_freq ALPHA_59_FREQ_CPS[] = {
+  { 0x61u, 0.10100000 },
+  { 0x62u, 0.01570000 },
+  { 0x63u, 0.02880000 },
+  { 0x64u, 0.09120000 },
+  { 0x65u, 0.08240000 },
+  { 0x66u, 0.03290000 },
+  { 0x67u, 0.03770000 },
+  { 0x68u, 0.03500000 },
+  { 0x69u, 0.06660000 },
+  { 0x6Au, 0.00090000 },
+  { 0x6Cu, 0.05170000 },
+  { 0x6Du, 0.02490000 },
+  { 0x6Eu, 0.08250000 },
+  { 0x6Fu, 0.05660000 },
+  { 0x70u, 0.00930000 },
+  { 0x72u, 0.07710000 },
+  { 0x73u, 0.03050000 },
+  { 0x74u, 0.03000000 },
+  { 0x75u, 0.02530000 },
+  { 0x77u, 0.03760000 },
+  { 0x79u, 0.07830000 },
+  { 0xE0u, 0.00000000 },
+  { 0xE1u, 0.00010000 },
+  { 0xE2u, 0.00090000 },
+  { 0xE4u, 0.00000000 },
+  { 0xE8u, 0.00000000 },
+  { 0xE9u, 0.00020000 },
+  { 0xEAu, 0.00020000 },
+  { 0xEBu, 0.00000000 },
+  { 0xECu, 0.00000000 },
+  { 0xEDu, 0.00000000 },
+  { 0xEEu, 0.00010000 },
+  { 0xEFu, 0.00010000 },
+  { 0xF2u, 0.00000000 },
+  { 0xF3u, 0.00000000 },
+  { 0xF4u, 0.00140000 },
+  { 0xF6u, 0.00010000 },
+  { 0xF9u, 0.00000000 },
+  { 0xFAu, 0.00000000 },
+  { 0xFBu, 0.00000000 },
+  { 0xFCu, 0.00000000 },
+  { 0xFDu, 0.00000000 },
+  { 0xFFu, 0.00000000 },
+  { 0x175u, 0.00040000 },
+  { 0x177u, 0.00030000 },
+  { 0x1E81u, 0.00000000 },
+  { 0x1E83u, 0.00000000 },
+  { 0x1E85u, 0.00000000 },
+  { 0x1EF3u, 0.00000000 },
+};
+
@@ -0,0 +1,1195 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_6_UPPER[] = {
+  "ሀ",
+  "ለ",
+  "ሐ",
+  "መ",
+  "ሠ",
+  "ረ",
+  "ሰ",
+  "ሸ",
+  "ቀ",
+  "ቈ",
+  "በ",
+  "ቨ",
+  "ተ",
+  "ቸ",
+  "ኀ",
+  "ኈ",
+  "ነ",
+  "ኘ",
+  "አ",
+  "ከ",
+  "ኰ",
+  "ኸ",
+  "ወ",
+  "ዐ",
+  "ዘ",
+  "ዠ",
+  "የ",
+  "ደ",
+  "ጀ",
+  "ገ",
+  "ጐ",
+  "ጠ",
+  "ጨ",
+  "ጰ",
+  "ጸ",
+  "ፀ",
+  "ፈ",
+  "ፐ",
+  "ሁ",
+  "ሂ",
+  "ሃ",
+  "ሄ",
+  "ህ",
+  "ሆ",
+  "ሉ",
+  "ሊ",
+  "ላ",
+  "ሌ",
+  "ል",
+  "ሎ",
+  "ሏ",
+  "ሑ",
+  "ሒ",
+  "ሓ",
+  "ሔ",
+  "ሕ",
+  "ሖ",
+  "ሗ",
+  "ሙ",
+  "ሚ",
+  "ማ",
+  "ሜ",
+  "ም",
+  "ሞ",
+  "ሟ",
+  "ሡ",
+  "ሢ",
+  "ሣ",
+  "ሤ",
+  "ሥ",
+  "ሦ",
+  "ሧ",
+  "ሩ",
+  "ሪ",
+  "ራ",
+  "ሬ",
+  "ር",
+  "ሮ",
+  "ሯ",
+  "ሱ",
+  "ሲ",
+  "ሳ",
+  "ሴ",
+  "ስ",
+  "ሶ",
+  "ሷ",
+  "ሹ",
+  "ሺ",
+  "ሻ",
+  "ሼ",
+  "ሽ",
+  "ሾ",
+  "ሿ",
+  "ቁ",
+  "ቂ",
+  "ቃ",
+  "ቄ",
+  "ቅ",
+  "ቆ",
+  "ቊ",
+  "ቋ",
+  "ቌ",
+  "ቍ",
+  "ቡ",
+  "ቢ",
+  "ባ",
+  "ቤ",
+  "ብ",
+  "ቦ",
+  "ቧ",
+  "ቩ",
+  "ቪ",
+  "ቫ",
+  "ቬ",
+  "ቭ",
+  "ቮ",
+  "ቯ",
+  "ቱ",
+  "ቲ",
+  "ታ",
+  "ቴ",
+  "ት",
+  "ቶ",
+  "ቷ",
+  "ቹ",
+  "ቺ",
+  "ቻ",
+  "ቼ",
+  "ች",
+  "ቾ",
+  "ቿ",
+  "ኁ",
+  "ኂ",
+  "ኃ",
+  "ኄ",
+  "ኅ",
+  "ኆ",
+  "ኊ",
+  "ኋ",
+  "ኌ",
+  "ኍ",
+  "ኑ",
+  "ኒ",
+  "ና",
+  "ኔ",
+  "ን",
+  "ኖ",
+  "ኗ",
+  "ኙ",
+  "ኚ",
+  "ኛ",
+  "ኜ",
+  "ኝ",
+  "ኞ",
+  "ኟ",
+  "ኡ",
+  "ኢ",
+  "ኣ",
+  "ኤ",
+  "እ",
+  "ኦ",
+  "ኧ",
+  "ኩ",
+  "ኪ",
+  "ካ",
+  "ኬ",
+  "ክ",
+  "ኮ",
+  "ኲ",
+  "ኳ",
+  "ኴ",
+  "ኵ",
+  "ኹ",
+  "ኺ",
+  "ኻ",
+  "ኼ",
+  "ኽ",
+  "ኾ",
+  "ዉ",
+  "ዊ",
+  "ዋ",
+  "ዌ",
+  "ው",
+  "ዎ",
+  "ዑ",
+  "ዒ",
+  "ዓ",
+  "ዔ",
+  "ዕ",
+  "ዖ",
+  "ዙ",
+  "ዚ",
+  "ዛ",
+  "ዜ",
+  "ዝ",
+  "ዞ",
+  "ዟ",
+  "ዡ",
+  "ዢ",
+  "ዣ",
+  "ዤ",
+  "ዥ",
+  "ዦ",
+  "ዧ",
+  "ዩ",
+  "ዪ",
+  "ያ",
+  "ዬ",
+  "ይ",
+  "ዮ",
+  "ዱ",
+  "ዲ",
+  "ዳ",
+  "ዴ",
+  "ድ",
+  "ዶ",
+  "ዷ",
+  "ጁ",
+  "ጂ",
+  "ጃ",
+  "ጄ",
+  "ጅ",
+  "ጆ",
+  "ጇ",
+  "ጉ",
+  "ጊ",
+  "ጋ",
+  "ጌ",
+  "ግ",
+  "ጎ",
+  "ጒ",
+  "ጓ",
+  "ጔ",
+  "ጕ",
+  "ጡ",
+  "ጢ",
+  "ጣ",
+  "ጤ",
+  "ጥ",
+  "ጦ",
+  "ጧ",
+  "ጩ",
+  "ጪ",
+  "ጫ",
+  "ጬ",
+  "ጭ",
+  "ጮ",
+  "ጯ",
+  "ጱ",
+  "ጲ",
+  "ጳ",
+  "ጴ",
+  "ጵ",
+  "ጶ",
+  "ጷ",
+  "ጹ",
+  "ጺ",
+  "ጻ",
+  "ጼ",
+  "ጽ",
+  "ጾ",
+  "ጿ",
+  "ፁ",
+  "ፂ",
+  "ፃ",
+  "ፄ",
+  "ፅ",
+  "ፆ",
+  "ፉ",
+  "ፊ",
+  "ፋ",
+  "ፌ",
+  "ፍ",
+  "ፎ",
+  "ፏ",
+  "ፑ",
+  "ፒ",
+  "ፓ",
+  "ፔ",
+  "ፕ",
+  "ፖ",
+  "ፗ",
+};
+const char *ALPHA_6_LOWER[] = {
+  "ሀ",
+  "ለ",
+  "ሐ",
+  "መ",
+  "ሠ",
+  "ረ",
+  "ሰ",
+  "ሸ",
+  "ቀ",
+  "ቈ",
+  "በ",
+  "ቨ",
+  "ተ",
+  "ቸ",
+  "ኀ",
+  "ኈ",
+  "ነ",
+  "ኘ",
+  "አ",
+  "ከ",
+  "ኰ",
+  "ኸ",
+  "ወ",
+  "ዐ",
+  "ዘ",
+  "ዠ",
+  "የ",
+  "ደ",
+  "ጀ",
+  "ገ",
+  "ጐ",
+  "ጠ",
+  "ጨ",
+  "ጰ",
+  "ጸ",
+  "ፀ",
+  "ፈ",
+  "ፐ",
+  "ሁ",
+  "ሂ",
+  "ሃ",
+  "ሄ",
+  "ህ",
+  "ሆ",
+  "ሉ",
+  "ሊ",
+  "ላ",
+  "ሌ",
+  "ል",
+  "ሎ",
+  "ሏ",
+  "ሑ",
+  "ሒ",
+  "ሓ",
+  "ሔ",
+  "ሕ",
+  "ሖ",
+  "ሗ",
+  "ሙ",
+  "ሚ",
+  "ማ",
+  "ሜ",
+  "ም",
+  "ሞ",
+  "ሟ",
+  "ሡ",
+  "ሢ",
+  "ሣ",
+  "ሤ",
+  "ሥ",
+  "ሦ",
+  "ሧ",
+  "ሩ",
+  "ሪ",
+  "ራ",
+  "ሬ",
+  "ር",
+  "ሮ",
+  "ሯ",
+  "ሱ",
+  "ሲ",
+  "ሳ",
+  "ሴ",
+  "ስ",
+  "ሶ",
+  "ሷ",
+  "ሹ",
+  "ሺ",
+  "ሻ",
+  "ሼ",
+  "ሽ",
+  "ሾ",
+  "ሿ",
+  "ቁ",
+  "ቂ",
+  "ቃ",
+  "ቄ",
+  "ቅ",
+  "ቆ",
+  "ቊ",
+  "ቋ",
+  "ቌ",
+  "ቍ",
+  "ቡ",
+  "ቢ",
+  "ባ",
+  "ቤ",
+  "ብ",
+  "ቦ",
+  "ቧ",
+  "ቩ",
+  "ቪ",
+  "ቫ",
+  "ቬ",
+  "ቭ",
+  "ቮ",
+  "ቯ",
+  "ቱ",
+  "ቲ",
+  "ታ",
+  "ቴ",
+  "ት",
+  "ቶ",
+  "ቷ",
+  "ቹ",
+  "ቺ",
+  "ቻ",
+  "ቼ",
+  "ች",
+  "ቾ",
+  "ቿ",
+  "ኁ",
+  "ኂ",
+  "ኃ",
+  "ኄ",
+  "ኅ",
+  "ኆ",
+  "ኊ",
+  "ኋ",
+  "ኌ",
+  "ኍ",
+  "ኑ",
+  "ኒ",
+  "ና",
+  "ኔ",
+  "ን",
+  "ኖ",
+  "ኗ",
+  "ኙ",
+  "ኚ",
+  "ኛ",
+  "ኜ",
+  "ኝ",
+  "ኞ",
+  "ኟ",
+  "ኡ",
+  "ኢ",
+  "ኣ",
+  "ኤ",
+  "እ",
+  "ኦ",
+  "ኧ",
+  "ኩ",
+  "ኪ",
+  "ካ",
+  "ኬ",
+  "ክ",
+  "ኮ",
+  "ኲ",
+  "ኳ",
+  "ኴ",
+  "ኵ",
+  "ኹ",
+  "ኺ",
+  "ኻ",
+  "ኼ",
+  "ኽ",
+  "ኾ",
+  "ዉ",
+  "ዊ",
+  "ዋ",
+  "ዌ",
+  "ው",
+  "ዎ",
+  "ዑ",
+  "ዒ",
+  "ዓ",
+  "ዔ",
+  "ዕ",
+  "ዖ",
+  "ዙ",
+  "ዚ",
+  "ዛ",
+  "ዜ",
+  "ዝ",
+  "ዞ",
+  "ዟ",
+  "ዡ",
+  "ዢ",
+  "ዣ",
+  "ዤ",
+  "ዥ",
+  "ዦ",
+  "ዧ",
+  "ዩ",
+  "ዪ",
+  "ያ",
+  "ዬ",
+  "ይ",
+  "ዮ",
+  "ዱ",
+  "ዲ",
+  "ዳ",
+  "ዴ",
+  "ድ",
+  "ዶ",
+  "ዷ",
+  "ጁ",
+  "ጂ",
+  "ጃ",
+  "ጄ",
+  "ጅ",
+  "ጆ",
+  "ጇ",
+  "ጉ",
+  "ጊ",
+  "ጋ",
+  "ጌ",
+  "ግ",
+  "ጎ",
+  "ጒ",
+  "ጓ",
+  "ጔ",
+  "ጕ",
+  "ጡ",
+  "ጢ",
+  "ጣ",
+  "ጤ",
+  "ጥ",
+  "ጦ",
+  "ጧ",
+  "ጩ",
+  "ጪ",
+  "ጫ",
+  "ጬ",
+  "ጭ",
+  "ጮ",
+  "ጯ",
+  "ጱ",
+  "ጲ",
+  "ጳ",
+  "ጴ",
+  "ጵ",
+  "ጶ",
+  "ጷ",
+  "ጹ",
+  "ጺ",
+  "ጻ",
+  "ጼ",
+  "ጽ",
+  "ጾ",
+  "ጿ",
+  "ፁ",
+  "ፂ",
+  "ፃ",
+  "ፄ",
+  "ፅ",
+  "ፆ",
+  "ፉ",
+  "ፊ",
+  "ፋ",
+  "ፌ",
+  "ፍ",
+  "ፎ",
+  "ፏ",
+  "ፑ",
+  "ፒ",
+  "ፓ",
+  "ፔ",
+  "ፕ",
+  "ፖ",
+  "ፗ",
+};
+const char *ALPHA_6_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_6_UPPER_CPS[] = {
+  4608, 4609, 4610, 4611, 4612, 4613, 4614, 4616, 4617, 4618, 4619, 4620, 4621, 4622, 4623, 4624,
+  4625, 4626, 4627, 4628, 4629, 4630, 4631, 4632, 4633, 4634, 4635, 4636, 4637, 4638, 4639, 4640,
+  4641, 4642, 4643, 4644, 4645, 4646, 4647, 4648, 4649, 4650, 4651, 4652, 4653, 4654, 4655, 4656,
+  4657, 4658, 4659, 4660, 4661, 4662, 4663, 4664, 4665, 4666, 4667, 4668, 4669, 4670, 4671, 4672,
+  4673, 4674, 4675, 4676, 4677, 4678, 4680, 4682, 4683, 4684, 4685, 4704, 4705, 4706, 4707, 4708,
+  4709, 4710, 4711, 4712, 4713, 4714, 4715, 4716, 4717, 4718, 4719, 4720, 4721, 4722, 4723, 4724,
+  4725, 4726, 4727, 4728, 4729, 4730, 4731, 4732, 4733, 4734, 4735, 4736, 4737, 4738, 4739, 4740,
+  4741, 4742, 4744, 4746, 4747, 4748, 4749, 4752, 4753, 4754, 4755, 4756, 4757, 4758, 4759, 4760,
+  4761, 4762, 4763, 4764, 4765, 4766, 4767, 4768, 4769, 4770, 4771, 4772, 4773, 4774, 4775, 4776,
+  4777, 4778, 4779, 4780, 4781, 4782, 4784, 4786, 4787, 4788, 4789, 4792, 4793, 4794, 4795, 4796,
+  4797, 4798, 4808, 4809, 4810, 4811, 4812, 4813, 4814, 4816, 4817, 4818, 4819, 4820, 4821, 4822,
+  4824, 4825, 4826, 4827, 4828, 4829, 4830, 4831, 4832, 4833, 4834, 4835, 4836, 4837, 4838, 4839,
+  4840, 4841, 4842, 4843, 4844, 4845, 4846, 4848, 4849, 4850, 4851, 4852, 4853, 4854, 4855, 4864,
+  4865, 4866, 4867, 4868, 4869, 4870, 4871, 4872, 4873, 4874, 4875, 4876, 4877, 4878, 4880, 4882,
+  4883, 4884, 4885, 4896, 4897, 4898, 4899, 4900, 4901, 4902, 4903, 4904, 4905, 4906, 4907, 4908,
+  4909, 4910, 4911, 4912, 4913, 4914, 4915, 4916, 4917, 4918, 4919, 4920, 4921, 4922, 4923, 4924,
+  4925, 4926, 4927, 4928, 4929, 4930, 4931, 4932, 4933, 4934, 4936, 4937, 4938, 4939, 4940, 4941,
+  4942, 4943, 4944, 4945, 4946, 4947, 4948, 4949, 4950, 4951,
+};
+const uint32_t ALPHA_6_LOWER_CPS[] = {
+  4608, 4609, 4610, 4611, 4612, 4613, 4614, 4616, 4617, 4618, 4619, 4620, 4621, 4622, 4623, 4624,
+  4625, 4626, 4627, 4628, 4629, 4630, 4631, 4632, 4633, 4634, 4635, 4636, 4637, 4638, 4639, 4640,
+  4641, 4642, 4643, 4644, 4645, 4646, 4647, 4648, 4649, 4650, 4651, 4652, 4653, 4654, 4655, 4656,
+  4657, 4658, 4659, 4660, 4661, 4662, 4663, 4664, 4665, 4666, 4667, 4668, 4669, 4670, 4671, 4672,
+  4673, 4674, 4675, 4676, 4677, 4678, 4680, 4682, 4683, 4684, 4685, 4704, 4705, 4706, 4707, 4708,
+  4709, 4710, 4711, 4712, 4713, 4714, 4715, 4716, 4717, 4718, 4719, 4720, 4721, 4722, 4723, 4724,
+  4725, 4726, 4727, 4728, 4729, 4730, 4731, 4732, 4733, 4734, 4735, 4736, 4737, 4738, 4739, 4740,
+  4741, 4742, 4744, 4746, 4747, 4748, 4749, 4752, 4753, 4754, 4755, 4756, 4757, 4758, 4759, 4760,
+  4761, 4762, 4763, 4764, 4765, 4766, 4767, 4768, 4769, 4770, 4771, 4772, 4773, 4774, 4775, 4776,
+  4777, 4778, 4779, 4780, 4781, 4782, 4784, 4786, 4787, 4788, 4789, 4792, 4793, 4794, 4795, 4796,
+  4797, 4798, 4808, 4809, 4810, 4811, 4812, 4813, 4814, 4816, 4817, 4818, 4819, 4820, 4821, 4822,
+  4824, 4825, 4826, 4827, 4828, 4829, 4830, 4831, 4832, 4833, 4834, 4835, 4836, 4837, 4838, 4839,
+  4840, 4841, 4842, 4843, 4844, 4845, 4846, 4848, 4849, 4850, 4851, 4852, 4853, 4854, 4855, 4864,
+  4865, 4866, 4867, 4868, 4869, 4870, 4871, 4872, 4873, 4874, 4875, 4876, 4877, 4878, 4880, 4882,
+  4883, 4884, 4885, 4896, 4897, 4898, 4899, 4900, 4901, 4902, 4903, 4904, 4905, 4906, 4907, 4908,
+  4909, 4910, 4911, 4912, 4913, 4914, 4915, 4916, 4917, 4918, 4919, 4920, 4921, 4922, 4923, 4924,
+  4925, 4926, 4927, 4928, 4929, 4930, 4931, 4932, 4933, 4934, 4936, 4937, 4938, 4939, 4940, 4941,
+  4942, 4943, 4944, 4945, 4946, 4947, 4948, 4949, 4950, 4951,
+};
+const uint32_t ALPHA_6_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_6_FREQ[] = {
+  { "ሀ", 0.00090000 },
+  { "ለ", 0.02010000 },
+  { "ሐ", 0.00180000 },
+  { "መ", 0.02670000 },
+  { "ሠ", 0.00160000 },
+  { "ረ", 0.01250000 },
+  { "ሰ", 0.00820000 },
+  { "ሸ", 0.00100000 },
+  { "ቀ", 0.00820000 },
+  { "ቈ", 0.00000000 },
+  { "በ", 0.03730000 },
+  { "ቨ", 0.00020000 },
+  { "ተ", 0.02080000 },
+  { "ቸ", 0.00440000 },
+  { "ኀ", 0.00000000 },
+  { "ኈ", 0.00000000 },
+  { "ነ", 0.02230000 },
+  { "ኘ", 0.00090000 },
+  { "አ", 0.02620000 },
+  { "ከ", 0.01600000 },
+  { "ኰ", 0.00000000 },
+  { "ኸ", 0.00010000 },
+  { "ወ", 0.01070000 },
+  { "ዐ", 0.00020000 },
+  { "ዘ", 0.00620000 },
+  { "ዠ", 0.00010000 },
+  { "የ", 0.03150000 },
+  { "ደ", 0.01310000 },
+  { "ጀ", 0.00220000 },
+  { "ገ", 0.01250000 },
+  { "ጐ", 0.00010000 },
+  { "ጠ", 0.00540000 },
+  { "ጨ", 0.00170000 },
+  { "ጰ", 0.00000000 },
+  { "ጸ", 0.00070000 },
+  { "ፀ", 0.00040000 },
+  { "ፈ", 0.00460000 },
+  { "ፐ", 0.00010000 },
+  { "ሁ", 0.00370000 },
+  { "ሂ", 0.00030000 },
+  { "ሃ", 0.00210000 },
+  { "ሄ", 0.00090000 },
+  { "ህ", 0.00780000 },
+  { "ሆ", 0.00620000 },
+  { "ሉ", 0.00500000 },
+  { "ሊ", 0.00360000 },
+  { "ላ", 0.01350000 },
+  { "ሌ", 0.00280000 },
+  { "ል", 0.02320000 },
+  { "ሎ", 0.00310000 },
+  { "ሏ", 0.00030000 },
+  { "ሑ", 0.00020000 },
+  { "ሒ", 0.00010000 },
+  { "ሓ", 0.00020000 },
+  { "ሔ", 0.00040000 },
+  { "ሕ", 0.00170000 },
+  { "ሖ", 0.00000000 },
+  { "ሗ", 0.00000000 },
+  { "ሙ", 0.00280000 },
+  { "ሚ", 0.00830000 },
+  { "ማ", 0.01310000 },
+  { "ሜ", 0.00240000 },
+  { "ም", 0.02430000 },
+  { "ሞ", 0.00340000 },
+  { "ሟ", 0.00020000 },
+  { "ሡ", 0.00010000 },
+  { "ሢ", 0.00000000 },
+  { "ሣ", 0.00060000 },
+  { "ሤ", 0.00000000 },
+  { "ሥ", 0.00360000 },
+  { "ሦ", 0.00040000 },
+  { "ሧ", 0.00000000 },
+  { "ሩ", 0.00410000 },
+  { "ሪ", 0.00710000 },
+  { "ራ", 0.01060000 },
+  { "ሬ", 0.00190000 },
+  { "ር", 0.02960000 },
+  { "ሮ", 0.00430000 },
+  { "ሯ", 0.00020000 },
+  { "ሱ", 0.00240000 },
+  { "ሲ", 0.00530000 },
+  { "ሳ", 0.00590000 },
+  { "ሴ", 0.00150000 },
+  { "ስ", 0.02850000 },
+  { "ሶ", 0.00110000 },
+  { "ሷ", 0.00010000 },
+  { "ሹ", 0.00020000 },
+  { "ሺ", 0.00030000 },
+  { "ሻ", 0.00150000 },
+  { "ሼ", 0.00010000 },
+  { "ሽ", 0.00210000 },
+  { "ሾ", 0.00030000 },
+  { "ሿ", 0.00000000 },
+  { "ቁ", 0.00210000 },
+  { "ቂ", 0.00080000 },
+  { "ቃ", 0.00340000 },
+  { "ቄ", 0.00030000 },
+  { "ቅ", 0.00550000 },
+  { "ቆ", 0.00220000 },
+  { "ቊ", 0.00000000 },
+  { "ቋ", 0.00220000 },
+  { "ቌ", 0.00000000 },
+  { "ቍ", 0.00000000 },
+  { "ቡ", 0.00180000 },
+  { "ቢ", 0.00290000 },
+  { "ባ", 0.00890000 },
+  { "ቤ", 0.00250000 },
+  { "ብ", 0.01230000 },
+  { "ቦ", 0.00170000 },
+  { "ቧ", 0.00010000 },
+  { "ቩ", 0.00000000 },
+  { "ቪ", 0.00040000 },
+  { "ቫ", 0.00030000 },
+  { "ቬ", 0.00020000 },
+  { "ቭ", 0.00020000 },
+  { "ቮ", 0.00020000 },
+  { "ቯ", 0.00000000 },
+  { "ቱ", 0.00450000 },
+  { "ቲ", 0.00220000 },
+  { "ታ", 0.01040000 },
+  { "ቴ", 0.00140000 },
+  { "ት", 0.03580000 },
+  { "ቶ", 0.00350000 },
+  { "ቷ", 0.00040000 },
+  { "ቹ", 0.00120000 },
+  { "ቺ", 0.00010000 },
+  { "ቻ", 0.00170000 },
+  { "ቼ", 0.00010000 },
+  { "ች", 0.01200000 },
+  { "ቾ", 0.00010000 },
+  { "ቿ", 0.00000000 },
+  { "ኁ", 0.00000000 },
+  { "ኂ", 0.00000000 },
+  { "ኃ", 0.00040000 },
+  { "ኄ", 0.00000000 },
+  { "ኅ", 0.00060000 },
+  { "ኆ", 0.00000000 },
+  { "ኊ", 0.00000000 },
+  { "ኋ", 0.00140000 },
+  { "ኌ", 0.00000000 },
+  { "ኍ", 0.00000000 },
+  { "ኑ", 0.00230000 },
+  { "ኒ", 0.00180000 },
+  { "ና", 0.01490000 },
+  { "ኔ", 0.00130000 },
+  { "ን", 0.05150000 },
+  { "ኖ", 0.00350000 },
+  { "ኗ", 0.00030000 },
+  { "ኙ", 0.00060000 },
+  { "ኚ", 0.00010000 },
+  { "ኛ", 0.00590000 },
+  { "ኜ", 0.00000000 },
+  { "ኝ", 0.00200000 },
+  { "ኞ", 0.00040000 },
+  { "ኟ", 0.00000000 },
+  { "ኡ", 0.00040000 },
+  { "ኢ", 0.00330000 },
+  { "ኣ", 0.00020000 },
+  { "ኤ", 0.00240000 },
+  { "እ", 0.01670000 },
+  { "ኦ", 0.00080000 },
+  { "ኧ", 0.00000000 },
+  { "ኩ", 0.00160000 },
+  { "ኪ", 0.00110000 },
+  { "ካ", 0.00590000 },
+  { "ኬ", 0.00040000 },
+  { "ክ", 0.01050000 },
+  { "ኮ", 0.00180000 },
+  { "ኲ", 0.00000000 },
+  { "ኳ", 0.00050000 },
+  { "ኴ", 0.00000000 },
+  { "ኵ", 0.00000000 },
+  { "ኹ", 0.00000000 },
+  { "ኺ", 0.00000000 },
+  { "ኻ", 0.00000000 },
+  { "ኼ", 0.00000000 },
+  { "ኽ", 0.00000000 },
+  { "ኾ", 0.00000000 },
+  { "ዉ", 0.00060000 },
+  { "ዊ", 0.00380000 },
+  { "ዋ", 0.00490000 },
+  { "ዌ", 0.00030000 },
+  { "ው", 0.03020000 },
+  { "ዎ", 0.00330000 },
+  { "ዑ", 0.00020000 },
+  { "ዒ", 0.00000000 },
+  { "ዓ", 0.00480000 },
+  { "ዔ", 0.00000000 },
+  { "ዕ", 0.00270000 },
+  { "ዖ", 0.00010000 },
+  { "ዙ", 0.00140000 },
+  { "ዚ", 0.00400000 },
+  { "ዛ", 0.00230000 },
+  { "ዜ", 0.00190000 },
+  { "ዝ", 0.00430000 },
+  { "ዞ", 0.00050000 },
+  { "ዟ", 0.00010000 },
+  { "ዡ", 0.00000000 },
+  { "ዢ", 0.00010000 },
+  { "ዣ", 0.00010000 },
+  { "ዤ", 0.00000000 },
+  { "ዥ", 0.00040000 },
+  { "ዦ", 0.00000000 },
+  { "ዧ", 0.00000000 },
+  { "ዩ", 0.00150000 },
+  { "ዪ", 0.00000000 },
+  { "ያ", 0.01750000 },
+  { "ዬ", 0.00020000 },
+  { "ይ", 0.02070000 },
+  { "ዮ", 0.00420000 },
+  { "ዱ", 0.00170000 },
+  { "ዲ", 0.00340000 },
+  { "ዳ", 0.00520000 },
+  { "ዴ", 0.00090000 },
+  { "ድ", 0.01190000 },
+  { "ዶ", 0.00140000 },
+  { "ዷ", 0.00010000 },
+  { "ጁ", 0.00030000 },
+  { "ጂ", 0.00050000 },
+  { "ጃ", 0.00110000 },
+  { "ጄ", 0.00030000 },
+  { "ጅ", 0.00200000 },
+  { "ጆ", 0.00060000 },
+  { "ጇ", 0.00000000 },
+  { "ጉ", 0.00400000 },
+  { "ጊ", 0.00200000 },
+  { "ጋ", 0.00430000 },
+  { "ጌ", 0.00050000 },
+  { "ግ", 0.01260000 },
+  { "ጎ", 0.00170000 },
+  { "ጒ", 0.00000000 },
+  { "ጓ", 0.00050000 },
+  { "ጔ", 0.00000000 },
+  { "ጕ", 0.00000000 },
+  { "ጡ", 0.00080000 },
+  { "ጢ", 0.00020000 },
+  { "ጣ", 0.00380000 },
+  { "ጤ", 0.00040000 },
+  { "ጥ", 0.00860000 },
+  { "ጦ", 0.00110000 },
+  { "ጧ", 0.00000000 },
+  { "ጩ", 0.00010000 },
+  { "ጪ", 0.00010000 },
+  { "ጫ", 0.00110000 },
+  { "ጬ", 0.00000000 },
+  { "ጭ", 0.00100000 },
+  { "ጮ", 0.00020000 },
+  { "ጯ", 0.00000000 },
+  { "ጱ", 0.00000000 },
+  { "ጲ", 0.00000000 },
+  { "ጳ", 0.00020000 },
+  { "ጴ", 0.00000000 },
+  { "ጵ", 0.00210000 },
+  { "ጶ", 0.00000000 },
+  { "ጷ", 0.00000000 },
+  { "ጹ", 0.00020000 },
+  { "ጺ", 0.00000000 },
+  { "ጻ", 0.00140000 },
+  { "ጼ", 0.00030000 },
+  { "ጽ", 0.00210000 },
+  { "ጾ", 0.00010000 },
+  { "ጿ", 0.00000000 },
+  { "ፁ", 0.00000000 },
+  { "ፂ", 0.00000000 },
+  { "ፃ", 0.00020000 },
+  { "ፄ", 0.00020000 },
+  { "ፅ", 0.00030000 },
+  { "ፆ", 0.00010000 },
+  { "ፉ", 0.00070000 },
+  { "ፊ", 0.00180000 },
+  { "ፋ", 0.00220000 },
+  { "ፌ", 0.00030000 },
+  { "ፍ", 0.00640000 },
+  { "ፎ", 0.00070000 },
+  { "ፏ", 0.00010000 },
+  { "ፑ", 0.00010000 },
+  { "ፒ", 0.00050000 },
+  { "ፓ", 0.00090000 },
+  { "ፔ", 0.00020000 },
+  { "ፕ", 0.00100000 },
+  { "ፖ", 0.00070000 },
+  { "ፗ", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_6_FREQ_CPS[] = {
+  { 0x1200u, 0.00090000 },
+  { 0x1201u, 0.00370000 },
+  { 0x1202u, 0.00030000 },
+  { 0x1203u, 0.00210000 },
+  { 0x1204u, 0.00090000 },
+  { 0x1205u, 0.00780000 },
+  { 0x1206u, 0.00620000 },
+  { 0x1208u, 0.02010000 },
+  { 0x1209u, 0.00500000 },
+  { 0x120Au, 0.00360000 },
+  { 0x120Bu, 0.01350000 },
+  { 0x120Cu, 0.00280000 },
+  { 0x120Du, 0.02320000 },
+  { 0x120Eu, 0.00310000 },
+  { 0x120Fu, 0.00030000 },
+  { 0x1210u, 0.00180000 },
+  { 0x1211u, 0.00020000 },
+  { 0x1212u, 0.00010000 },
+  { 0x1213u, 0.00020000 },
+  { 0x1214u, 0.00040000 },
+  { 0x1215u, 0.00170000 },
+  { 0x1216u, 0.00000000 },
+  { 0x1217u, 0.00000000 },
+  { 0x1218u, 0.02670000 },
+  { 0x1219u, 0.00280000 },
+  { 0x121Au, 0.00830000 },
+  { 0x121Bu, 0.01310000 },
+  { 0x121Cu, 0.00240000 },
+  { 0x121Du, 0.02430000 },
+  { 0x121Eu, 0.00340000 },
+  { 0x121Fu, 0.00020000 },
+  { 0x1220u, 0.00160000 },
+  { 0x1221u, 0.00010000 },
+  { 0x1222u, 0.00000000 },
+  { 0x1223u, 0.00060000 },
+  { 0x1224u, 0.00000000 },
+  { 0x1225u, 0.00360000 },
+  { 0x1226u, 0.00040000 },
+  { 0x1227u, 0.00000000 },
+  { 0x1228u, 0.01250000 },
+  { 0x1229u, 0.00410000 },
+  { 0x122Au, 0.00710000 },
+  { 0x122Bu, 0.01060000 },
+  { 0x122Cu, 0.00190000 },
+  { 0x122Du, 0.02960000 },
+  { 0x122Eu, 0.00430000 },
+  { 0x122Fu, 0.00020000 },
+  { 0x1230u, 0.00820000 },
+  { 0x1231u, 0.00240000 },
+  { 0x1232u, 0.00530000 },
+  { 0x1233u, 0.00590000 },
+  { 0x1234u, 0.00150000 },
+  { 0x1235u, 0.02850000 },
+  { 0x1236u, 0.00110000 },
+  { 0x1237u, 0.00010000 },
+  { 0x1238u, 0.00100000 },
+  { 0x1239u, 0.00020000 },
+  { 0x123Au, 0.00030000 },
+  { 0x123Bu, 0.00150000 },
+  { 0x123Cu, 0.00010000 },
+  { 0x123Du, 0.00210000 },
+  { 0x123Eu, 0.00030000 },
+  { 0x123Fu, 0.00000000 },
+  { 0x1240u, 0.00820000 },
+  { 0x1241u, 0.00210000 },
+  { 0x1242u, 0.00080000 },
+  { 0x1243u, 0.00340000 },
+  { 0x1244u, 0.00030000 },
+  { 0x1245u, 0.00550000 },
+  { 0x1246u, 0.00220000 },
+  { 0x1248u, 0.00000000 },
+  { 0x124Au, 0.00000000 },
+  { 0x124Bu, 0.00220000 },
+  { 0x124Cu, 0.00000000 },
+  { 0x124Du, 0.00000000 },
+  { 0x1260u, 0.03730000 },
+  { 0x1261u, 0.00180000 },
+  { 0x1262u, 0.00290000 },
+  { 0x1263u, 0.00890000 },
+  { 0x1264u, 0.00250000 },
+  { 0x1265u, 0.01230000 },
+  { 0x1266u, 0.00170000 },
+  { 0x1267u, 0.00010000 },
+  { 0x1268u, 0.00020000 },
+  { 0x1269u, 0.00000000 },
+  { 0x126Au, 0.00040000 },
+  { 0x126Bu, 0.00030000 },
+  { 0x126Cu, 0.00020000 },
+  { 0x126Du, 0.00020000 },
+  { 0x126Eu, 0.00020000 },
+  { 0x126Fu, 0.00000000 },
+  { 0x1270u, 0.02080000 },
+  { 0x1271u, 0.00450000 },
+  { 0x1272u, 0.00220000 },
+  { 0x1273u, 0.01040000 },
+  { 0x1274u, 0.00140000 },
+  { 0x1275u, 0.03580000 },
+  { 0x1276u, 0.00350000 },
+  { 0x1277u, 0.00040000 },
+  { 0x1278u, 0.00440000 },
+  { 0x1279u, 0.00120000 },
+  { 0x127Au, 0.00010000 },
+  { 0x127Bu, 0.00170000 },
+  { 0x127Cu, 0.00010000 },
+  { 0x127Du, 0.01200000 },
+  { 0x127Eu, 0.00010000 },
+  { 0x127Fu, 0.00000000 },
+  { 0x1280u, 0.00000000 },
+  { 0x1281u, 0.00000000 },
+  { 0x1282u, 0.00000000 },
+  { 0x1283u, 0.00040000 },
+  { 0x1284u, 0.00000000 },
+  { 0x1285u, 0.00060000 },
+  { 0x1286u, 0.00000000 },
+  { 0x1288u, 0.00000000 },
+  { 0x128Au, 0.00000000 },
+  { 0x128Bu, 0.00140000 },
+  { 0x128Cu, 0.00000000 },
+  { 0x128Du, 0.00000000 },
+  { 0x1290u, 0.02230000 },
+  { 0x1291u, 0.00230000 },
+  { 0x1292u, 0.00180000 },
+  { 0x1293u, 0.01490000 },
+  { 0x1294u, 0.00130000 },
+  { 0x1295u, 0.05150000 },
+  { 0x1296u, 0.00350000 },
+  { 0x1297u, 0.00030000 },
+  { 0x1298u, 0.00090000 },
+  { 0x1299u, 0.00060000 },
+  { 0x129Au, 0.00010000 },
+  { 0x129Bu, 0.00590000 },
+  { 0x129Cu, 0.00000000 },
+  { 0x129Du, 0.00200000 },
+  { 0x129Eu, 0.00040000 },
+  { 0x129Fu, 0.00000000 },
+  { 0x12A0u, 0.02620000 },
+  { 0x12A1u, 0.00040000 },
+  { 0x12A2u, 0.00330000 },
+  { 0x12A3u, 0.00020000 },
+  { 0x12A4u, 0.00240000 },
+  { 0x12A5u, 0.01670000 },
+  { 0x12A6u, 0.00080000 },
+  { 0x12A7u, 0.00000000 },
+  { 0x12A8u, 0.01600000 },
+  { 0x12A9u, 0.00160000 },
+  { 0x12AAu, 0.00110000 },
+  { 0x12ABu, 0.00590000 },
+  { 0x12ACu, 0.00040000 },
+  { 0x12ADu, 0.01050000 },
+  { 0x12AEu, 0.00180000 },
+  { 0x12B0u, 0.00000000 },
+  { 0x12B2u, 0.00000000 },
+  { 0x12B3u, 0.00050000 },
+  { 0x12B4u, 0.00000000 },
+  { 0x12B5u, 0.00000000 },
+  { 0x12B8u, 0.00010000 },
+  { 0x12B9u, 0.00000000 },
+  { 0x12BAu, 0.00000000 },
+  { 0x12BBu, 0.00000000 },
+  { 0x12BCu, 0.00000000 },
+  { 0x12BDu, 0.00000000 },
+  { 0x12BEu, 0.00000000 },
+  { 0x12C8u, 0.01070000 },
+  { 0x12C9u, 0.00060000 },
+  { 0x12CAu, 0.00380000 },
+  { 0x12CBu, 0.00490000 },
+  { 0x12CCu, 0.00030000 },
+  { 0x12CDu, 0.03020000 },
+  { 0x12CEu, 0.00330000 },
+  { 0x12D0u, 0.00020000 },
+  { 0x12D1u, 0.00020000 },
+  { 0x12D2u, 0.00000000 },
+  { 0x12D3u, 0.00480000 },
+  { 0x12D4u, 0.00000000 },
+  { 0x12D5u, 0.00270000 },
+  { 0x12D6u, 0.00010000 },
+  { 0x12D8u, 0.00620000 },
+  { 0x12D9u, 0.00140000 },
+  { 0x12DAu, 0.00400000 },
+  { 0x12DBu, 0.00230000 },
+  { 0x12DCu, 0.00190000 },
+  { 0x12DDu, 0.00430000 },
+  { 0x12DEu, 0.00050000 },
+  { 0x12DFu, 0.00010000 },
+  { 0x12E0u, 0.00010000 },
+  { 0x12E1u, 0.00000000 },
+  { 0x12E2u, 0.00010000 },
+  { 0x12E3u, 0.00010000 },
+  { 0x12E4u, 0.00000000 },
+  { 0x12E5u, 0.00040000 },
+  { 0x12E6u, 0.00000000 },
+  { 0x12E7u, 0.00000000 },
+  { 0x12E8u, 0.03150000 },
+  { 0x12E9u, 0.00150000 },
+  { 0x12EAu, 0.00000000 },
+  { 0x12EBu, 0.01750000 },
+  { 0x12ECu, 0.00020000 },
+  { 0x12EDu, 0.02070000 },
+  { 0x12EEu, 0.00420000 },
+  { 0x12F0u, 0.01310000 },
+  { 0x12F1u, 0.00170000 },
+  { 0x12F2u, 0.00340000 },
+  { 0x12F3u, 0.00520000 },
+  { 0x12F4u, 0.00090000 },
+  { 0x12F5u, 0.01190000 },
+  { 0x12F6u, 0.00140000 },
+  { 0x12F7u, 0.00010000 },
+  { 0x1300u, 0.00220000 },
+  { 0x1301u, 0.00030000 },
+  { 0x1302u, 0.00050000 },
+  { 0x1303u, 0.00110000 },
+  { 0x1304u, 0.00030000 },
+  { 0x1305u, 0.00200000 },
+  { 0x1306u, 0.00060000 },
+  { 0x1307u, 0.00000000 },
+  { 0x1308u, 0.01250000 },
+  { 0x1309u, 0.00400000 },
+  { 0x130Au, 0.00200000 },
+  { 0x130Bu, 0.00430000 },
+  { 0x130Cu, 0.00050000 },
+  { 0x130Du, 0.01260000 },
+  { 0x130Eu, 0.00170000 },
+  { 0x1310u, 0.00010000 },
+  { 0x1312u, 0.00000000 },
+  { 0x1313u, 0.00050000 },
+  { 0x1314u, 0.00000000 },
+  { 0x1315u, 0.00000000 },
+  { 0x1320u, 0.00540000 },
+  { 0x1321u, 0.00080000 },
+  { 0x1322u, 0.00020000 },
+  { 0x1323u, 0.00380000 },
+  { 0x1324u, 0.00040000 },
+  { 0x1325u, 0.00860000 },
+  { 0x1326u, 0.00110000 },
+  { 0x1327u, 0.00000000 },
+  { 0x1328u, 0.00170000 },
+  { 0x1329u, 0.00010000 },
+  { 0x132Au, 0.00010000 },
+  { 0x132Bu, 0.00110000 },
+  { 0x132Cu, 0.00000000 },
+  { 0x132Du, 0.00100000 },
+  { 0x132Eu, 0.00020000 },
+  { 0x132Fu, 0.00000000 },
+  { 0x1330u, 0.00000000 },
+  { 0x1331u, 0.00000000 },
+  { 0x1332u, 0.00000000 },
+  { 0x1333u, 0.00020000 },
+  { 0x1334u, 0.00000000 },
+  { 0x1335u, 0.00210000 },
+  { 0x1336u, 0.00000000 },
+  { 0x1337u, 0.00000000 },
+  { 0x1338u, 0.00070000 },
+  { 0x1339u, 0.00020000 },
+  { 0x133Au, 0.00000000 },
+  { 0x133Bu, 0.00140000 },
+  { 0x133Cu, 0.00030000 },
+  { 0x133Du, 0.00210000 },
+  { 0x133Eu, 0.00010000 },
+  { 0x133Fu, 0.00000000 },
+  { 0x1340u, 0.00040000 },
+  { 0x1341u, 0.00000000 },
+  { 0x1342u, 0.00000000 },
+  { 0x1343u, 0.00020000 },
+  { 0x1344u, 0.00020000 },
+  { 0x1345u, 0.00030000 },
+  { 0x1346u, 0.00010000 },
+  { 0x1348u, 0.00460000 },
+  { 0x1349u, 0.00070000 },
+  { 0x134Au, 0.00180000 },
+  { 0x134Bu, 0.00220000 },
+  { 0x134Cu, 0.00030000 },
+  { 0x134Du, 0.00640000 },
+  { 0x134Eu, 0.00070000 },
+  { 0x134Fu, 0.00010000 },
+  { 0x1350u, 0.00010000 },
+  { 0x1351u, 0.00010000 },
+  { 0x1352u, 0.00050000 },
+  { 0x1353u, 0.00090000 },
+  { 0x1354u, 0.00020000 },
+  { 0x1355u, 0.00100000 },
+  { 0x1356u, 0.00070000 },
+  { 0x1357u, 0.00000000 },
+};
+
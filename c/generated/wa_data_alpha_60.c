@@ -0,0 +1,151 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_60_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+  "Æ",
+  "Ø",
+  "Å",
+};
+const char *ALPHA_60_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+  "æ",
+  "ø",
+  "å",
+};
+const char *ALPHA_60_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_60_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 197, 198, 216,
+};
+const uint32_t ALPHA_60_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 229, 230, 248,
+};
+const uint32_t ALPHA_60_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_60_FREQ[] = {
+  { "a", 0.06450000 },
+  { "b", 0.01880000 },
+  { "c", 0.00650000 },
+  { "d", 0.05870000 },
+  { "e", 0.15250000 },
+  { "f", 0.02590000 },
+  { "g", 0.03920000 },
+  { "h", 0.01790000 },
+  { "i", 0.06220000 },
+  { "j", 0.00570000 },
+  { "k", 0.03030000 },
+  { "l", 0.05130000 },
+  { "m", 0.03220000 },
+  { "n", 0.07790000 },
+  { "o", 0.05000000 },
+  { "p", 0.01560000 },
+  { "q", 0.00020000 },
+  { "r", 0.08530000 },
+  { "s", 0.06180000 },
+  { "t", 0.06820000 },
+  { "u", 0.01890000 },
+  { "v", 0.02310000 },
+  { "w", 0.00160000 },
+  { "x", 0.00050000 },
+  { "y", 0.00760000 },
+  { "z", 0.00080000 },
+  { "æ", 0.00730000 },
+  { "ø", 0.00760000 },
+  { "å", 0.00790000 },
+};
+
+const wa_cp_freq ALPHA_60_FREQ_CPS[] = {
+  { 0x61u, 0.06450000 },
+  { 0x62u, 0.01880000 },
+  { 0x63u, 0.00650000 },
+  { 0x64u, 0.05870000 },
+  { 0x65u, 0.15250000 },
+  { 0x66u, 0.02590000 },
+  { 0x67u, 0.03920000 },
+  { 0x68u, 0.01790000 },
+  { 0x69u, 0.06220000 },
+  { 0x6Au, 0.00570000 },
+  { 0x6Bu, 0.03030000 },
+  { 0x6Cu, 0.05130000 },
+  { 0x6Du, 0.03220000 },
+  { 0x6Eu, 0.07790000 },
+  { 0x6Fu, 0.05000000 },
+  { 0x70u, 0.01560000 },
+  { 0x71u, 0.00020000 },
+  { 0x72u, 0.08530000 },
+  { 0x73u, 0.06180000 },
+  { 0x74u, 0.06820000 },
+  { 0x75u, 0.01890000 },
+  { 0x76u, 0.02310000 },
+  { 0x77u, 0.00160000 },
+  { 0x78u, 0.00050000 },
+  { 0x79u, 0.00760000 },
+  { 0x7Au, 0.00080000 },
+  { 0xE5u, 0.00790000 },
+  { 0xE6u, 0.00730000 },
+  { 0xF8u, 0.00760000 },
+};
+
@@ -0,0 +1,155 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_62_UPPER[] = {
+  "A",
+  "Ä",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "Ö",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "SS",
+  "T",
+  "U",
+  "Ü",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+};
+const char *ALPHA_62_LOWER[] = {
+  "a",
+  "ä",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "ö",
+  "p",
+  "q",
+  "r",
+  "s",
+  "ß",
+  "t",
+  "u",
+  "ü",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+};
+const char *ALPHA_62_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_62_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 196, 214, 220,
+};
+const uint32_t ALPHA_62_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 223, 228, 246, 252,
+};
+const uint32_t ALPHA_62_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_62_FREQ[] = {
+  { "a", 0.05800000 },
+  { "ä", 0.00540000 },
+  { "b", 0.02120000 },
+  { "c", 0.02730000 },
+  { "d", 0.05100000 },
+  { "e", 0.16190000 },
+  { "f", 0.01700000 },
+  { "g", 0.03000000 },
+  { "h", 0.04110000 },
+  { "i", 0.07930000 },
+  { "j", 0.00270000 },
+  { "k", 0.01450000 },
+  { "l", 0.03790000 },
+  { "m", 0.02650000 },
+  { "n", 0.09620000 },
+  { "o", 0.02850000 },
+  { "ö", 0.00290000 },
+  { "p", 0.01050000 },
+  { "q", 0.00030000 },
+  { "r", 0.07730000 },
+  { "s", 0.06310000 },
+  { "ß", 0.00160000 },
+  { "t", 0.06210000 },
+  { "u", 0.03940000 },
+  { "ü", 0.00570000 },
+  { "v", 0.00980000 },
+  { "w", 0.01410000 },
+  { "x", 0.00080000 },
+  { "y", 0.00190000 },
+  { "z", 0.01200000 },
+};
+
+const wa_cp_freq ALPHA_62_FREQ_CPS[] = {
+  { 0x61u, 0.05800000 },
+  { 0x62u, 0.02120000 },
+  { 0x63u, 0.02730000 },
+  { 0x64u, 0.05100000 },
+  { 0x65u, 0.16190000 },
+  { 0x66u, 0.01700000 },
+  { 0x67u, 0.03000000 },
+  { 0x68u, 0.04110000 },
+  { 0x69u, 0.07930000 },
+  { 0x6Au, 0.00270000 },
+  { 0x6Bu, 0.01450000 },
+  { 0x6Cu, 0.03790000 },
+  { 0x6Du, 0.02650000 },
+  { 0x6Eu, 0.09620000 },
+  { 0x6Fu, 0.02850000 },
+  { 0x70u, 0.01050000 },
+  { 0x71u, 0.00030000 },
+  { 0x72u, 0.07730000 },
+  { 0x73u, 0.06310000 },
+  { 0x74u, 0.06210000 },
+  { 0x75u, 0.03940000 },
+  { 0x76u, 0.00980000 },
+  { 0x77u, 0.01410000 },
+  { 0x78u, 0.00080000 },
+  { 0x79u, 0.00190000 },
+  { 0x7Au, 0.01200000 },
+  { 0xDFu, 0.00160000 },
+  { 0xE4u, 0.00540000 },
+  { 0xF6u, 0.00290000 },
+  { 0xFCu, 0.00570000 },
+};
+
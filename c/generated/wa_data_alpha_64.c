@@ -0,0 +1,185 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_64_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "Č",
+  "Ć",
+  "D",
+  "E",
+  "Ě",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "Ł",
+  "L",
+  "M",
+  "N",
+  "Ń",
+  "O",
+  "Ó",
+  "P",
+  "Q",
+  "R",
+  "Ŕ",
+  "S",
+  "Š",
+  "Ś",
+  "T",
+  "U",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+  "Ž",
+  "Ź",
+};
+const char *ALPHA_64_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "č",
+  "ć",
+  "d",
+  "e",
+  "ě",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "ł",
+  "l",
+  "m",
+  "n",
+  "ń",
+  "o",
+  "ó",
+  "p",
+  "q",
+  "r",
+  "ŕ",
+  "s",
+  "š",
+  "ś",
+  "t",
+  "u",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+  "ž",
+  "ź",
+};
+const char *ALPHA_64_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_64_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 211, 262, 268, 282, 321, 323,
+  340, 346, 352, 377, 381,
+};
+const uint32_t ALPHA_64_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 243, 263, 269, 283, 322, 324,
+  341, 347, 353, 378, 382,
+};
+const uint32_t ALPHA_64_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_64_FREQ[] = {
+  { "a", 0.09540000 },
+  { "b", 0.01630000 },
+  { "c", 0.02600000 },
+  { "č", 0.00050000 },
+  { "ć", 0.00410000 },
+  { "d", 0.02650000 },
+  { "e", 0.07920000 },
+  { "ě", 0.01500000 },
+  { "f", 0.00400000 },
+  { "g", 0.01510000 },
+  { "h", 0.01240000 },
+  { "i", 0.05050000 },
+  { "j", 0.05520000 },
+  { "k", 0.04210000 },
+  { "ł", 0.01390000 },
+  { "l", 0.02720000 },
+  { "m", 0.03090000 },
+  { "n", 0.05930000 },
+  { "ń", 0.00270000 },
+  { "o", 0.08360000 },
+  { "ó", 0.01690000 },
+  { "p", 0.02620000 },
+  { "q", 0.00010000 },
+  { "r", 0.04510000 },
+  { "ŕ", 0.00040000 },
+  { "s", 0.04920000 },
+  { "š", 0.00950000 },
+  { "ś", 0.01130000 },
+  { "t", 0.04030000 },
+  { "u", 0.03510000 },
+  { "v", 0.00110000 },
+  { "w", 0.04860000 },
+  { "x", 0.00030000 },
+  { "y", 0.02340000 },
+  { "z", 0.01800000 },
+  { "ž", 0.00900000 },
+  { "ź", 0.00550000 },
+};
+
+const wa_cp_freq ALPHA_64_FREQ_CPS[] = {
+  { 0x61u, 0.09540000 },
+  { 0x62u, 0.01630000 },
+  { 0x63u, 0.02600000 },
+  { 0x64u, 0.02650000 },
+  { 0x65u, 0.07920000 },
+  { 0x66u, 0.00400000 },
+  { 0x67u, 0.01510000 },
+  { 0x68u, 0.01240000 },
+  { 0x69u, 0.05050000 },
+  { 0x6Au, 0.05520000 },
+  { 0x6Bu, 0.04210000 },
+  { 0x6Cu, 0.02720000 },
+  { 0x6Du, 0.03090000 },
+  { 0x6Eu, 0.05930000 },
+  { 0x6Fu, 0.08360000 },
+  { 0x70u, 0.02620000 },
+  { 0x71u, 0.00010000 },
+  { 0x72u, 0.04510000 },
+  { 0x73u, 0.04920000 },
+  { 0x74u, 0.04030000 },
+  { 0x75u, 0.03510000 },
+  { 0x76u, 0.00110000 },
+  { 0x77u, 0.04860000 },
+  { 0x78u, 0.00030000 },
+  { 0x79u, 0.02340000 },
+  { 0x7Au, 0.01800000 },
+  { 0xF3u, 0.01690000 },
+  { 0x107u, 0.00410000 },
+  { 0x10Du, 0.00050000 },
+  { 0x11Bu, 0.01500000 },
+  { 0x142u, 0.01390000 },
+  { 0x144u, 0.00270000 },
+  { 0x155u, 0.00040000 },
+  { 0x15Bu, 0.01130000 },
+  { 0x161u, 0.00950000 },
+  { 0x17Au, 0.00550000 },
+  { 0x17Eu, 0.00900000 },
+};
+
@@ -0,0 +1,121 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_66_UPPER[] = {
+  "ހ",
+  "ށ",
+  "ނ",
+  "ރ",
+  "ބ",
+  "ޅ",
+  "ކ",
+  "އ",
+  "ވ",
+  "މ",
+  "ފ",
+  "ދ",
+  "ތ",
+  "ލ",
+  "ގ",
+  "ޏ",
+  "ސ",
+  "ޑ",
+  "ޒ",
+  "ޓ",
+  "ޔ",
+  "ޕ",
+  "ޖ",
+  "ޗ",
+};
+const char *ALPHA_66_LOWER[] = {
+  "ހ",
+  "ށ",
+  "ނ",
+  "ރ",
+  "ބ",
+  "ޅ",
+  "ކ",
+  "އ",
+  "ވ",
+  "މ",
+  "ފ",
+  "ދ",
+  "ތ",
+  "ލ",
+  "ގ",
+  "ޏ",
+  "ސ",
+  "ޑ",
+  "ޒ",
+  "ޓ",
+  "ޔ",
+  "ޕ",
+  "ޖ",
+  "ޗ",
+};
+const char *ALPHA_66_DIGITS[] = {
+};
+const uint32_t ALPHA_66_UPPER_CPS[] = {
+  1920, 1921, 1922, 1923, 1924, 1925, 1926, 1927, 1928, 1929, 1930, 1931, 1932, 1933, 1934, 1935,
+  1936, 1937, 1938, 1939, 1940, 1941, 1942, 1943,
+};
+const uint32_t ALPHA_66_LOWER_CPS[] = {
+  1920, 1921, 1922, 1923, 1924, 1925, 1926, 1927, 1928, 1929, 1930, 1931, 1932, 1933, 1934, 1935,
+  1936, 1937, 1938, 1939, 1940, 1941, 1942, 1943,
+};
+const uint32_t ALPHA_66_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_66_FREQ[] = {
+  { "ހ", 0.04270000 },
+  { "ށ", 0.02570000 },
+  { "ނ", 0.11680000 },
+  { "ރ", 0.07540000 },
+  { "ބ", 0.03100000 },
+  { "ޅ", 0.01100000 },
+  { "ކ", 0.07020000 },
+  { "އ", 0.15520000 },
+  { "ވ", 0.07650000 },
+  { "މ", 0.07350000 },
+  { "ފ", 0.03290000 },
+  { "ދ", 0.04280000 },
+  { "ތ", 0.04640000 },
+  { "ލ", 0.03430000 },
+  { "ގ", 0.06870000 },
+  { "ޏ", 0.00020000 },
+  { "ސ", 0.03480000 },
+  { "ޑ", 0.01660000 },
+  { "ޒ", 0.00390000 },
+  { "ޓ", 0.01300000 },
+  { "ޔ", 0.01130000 },
+  { "ޕ", 0.00640000 },
+  { "ޖ", 0.00850000 },
+  { "ޗ", 0.00230000 },
+};
+
+const wa_cp_freq ALPHA_66_FREQ_CPS[] = {
+  { 0x780u, 0.04270000 },
+  { 0x781u, 0.02570000 },
+  { 0x782u, 0.11680000 },
+  { 0x783u, 0.07540000 },
+  { 0x784u, 0.03100000 },
+  { 0x785u, 0.01100000 },
+  { 0x786u, 0.07020000 },
+  { 0x787u, 0.15520000 },
+  { 0x788u, 0.07650000 },
+  { 0x789u, 0.07350000 },
+  { 0x78Au, 0.03290000 },
+  { 0x78Bu, 0.04280000 },
+  { 0x78Cu, 0.04640000 },
+  { 0x78Du, 0.03430000 },
+  { 0x78Eu, 0.06870000 },
+  { 0x78Fu, 0.00020000 },
+  { 0x790u, 0.03480000 },
+  { 0x791u, 0.01660000 },
+  { 0x792u, 0.00390000 },
+  { 0x793u, 0.01300000 },
+  { 0x794u, 0.01130000 },
+  { 0x795u, 0.00640000 },
+  { 0x796u, 0.00850000 },
+  { 0x797u, 0.00230000 },
+};
+
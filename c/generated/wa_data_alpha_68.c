@@ -0,0 +1,145 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_68_UPPER[] = {
+  "ཀ",
+  "ཁ",
+  "ག",
+  "ང",
+  "ཅ",
+  "ཆ",
+  "ཇ",
+  "ཉ",
+  "ཏ",
+  "ཐ",
+  "ད",
+  "ན",
+  "པ",
+  "ཕ",
+  "བ",
+  "མ",
+  "ཙ",
+  "ཚ",
+  "ཛ",
+  "ཝ",
+  "ཞ",
+  "ཟ",
+  "འ",
+  "ཡ",
+  "ར",
+  "ལ",
+  "ཤ",
+  "ས",
+  "ཧ",
+  "ཨ",
+};
+const char *ALPHA_68_LOWER[] = {
+  "ཀ",
+  "ཁ",
+  "ག",
+  "ང",
+  "ཅ",
+  "ཆ",
+  "ཇ",
+  "ཉ",
+  "ཏ",
+  "ཐ",
+  "ད",
+  "ན",
+  "པ",
+  "ཕ",
+  "བ",
+  "མ",
+  "ཙ",
+  "ཚ",
+  "ཛ",
+  "ཝ",
+  "ཞ",
+  "ཟ",
+  "འ",
+  "ཡ",
+  "ར",
+  "ལ",
+  "ཤ",
+  "ས",
+  "ཧ",
+  "ཨ",
+};
+const char *ALPHA_68_DIGITS[] = {
+};
+const uint32_t ALPHA_68_UPPER_CPS[] = {
+  3904, 3905, 3906, 3908, 3909, 3910, 3911, 3913, 3919, 3920, 3921, 3923, 3924, 3925, 3926, 3928,
+  3929, 3930, 3931, 3933, 3934, 3935, 3936, 3937, 3938, 3939, 3940, 3942, 3943, 3944,
+};
+const uint32_t ALPHA_68_LOWER_CPS[] = {
+  3904, 3905, 3906, 3908, 3909, 3910, 3911, 3913, 3919, 3920, 3921, 3923, 3924, 3925, 3926, 3928,
+  3929, 3930, 3931, 3933, 3934, 3935, 3936, 3937, 3938, 3939, 3940, 3942, 3943, 3944,
+};
+const uint32_t ALPHA_68_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_68_FREQ[] = {
+  { "ཀ", 0.01650000 },
+  { "ཁ", 0.01270000 },
+  { "ག", 0.13080000 },
+  { "ང", 0.06810000 },
+  { "ཅ", 0.01140000 },
+  { "ཆ", 0.01180000 },
+  { "ཇ", 0.00450000 },
+  { "ཉ", 0.00610000 },
+  { "ཏ", 0.00680000 },
+  { "ཐ", 0.00770000 },
+  { "ད", 0.09510000 },
+  { "ན", 0.05890000 },
+  { "པ", 0.03020000 },
+  { "ཕ", 0.00960000 },
+  { "བ", 0.07750000 },
+  { "མ", 0.04650000 },
+  { "ཙ", 0.00330000 },
+  { "ཚ", 0.01120000 },
+  { "ཛ", 0.00380000 },
+  { "ཝ", 0.00150000 },
+  { "ཞ", 0.01960000 },
+  { "ཟ", 0.00590000 },
+  { "འ", 0.05750000 },
+  { "ཡ", 0.03600000 },
+  { "ར", 0.07060000 },
+  { "ལ", 0.05090000 },
+  { "ཤ", 0.00740000 },
+  { "ས", 0.12970000 },
+  { "ཧ", 0.00120000 },
+  { "ཨ", 0.00720000 },
+};
+
+const wa_cp_freq ALPHA_68_FREQ_CPS[] = {
+  { 0xF40u, 0.01650000 },
+  { 0xF41u, 0.01270000 },
+  { 0xF42u, 0.13080000 },
+  { 0xF44u, 0.06810000 },
+  { 0xF45u, 0.01140000 },
+  { 0xF46u, 0.01180000 },
+  { 0xF47u, 0.00450000 },
+  { 0xF49u, 0.00610000 },
+  { 0xF4Fu, 0.00680000 },
+  { 0xF50u, 0.00770000 },
+  { 0xF51u, 0.09510000 },
+  { 0xF53u, 0.05890000 },
+  { 0xF54u, 0.03020000 },
+  { 0xF55u, 0.00960000 },
+  { 0xF56u, 0.07750000 },
+  { 0xF58u, 0.04650000 },
+  { 0xF59u, 0.00330000 },
+  { 0xF5Au, 0.01120000 },
+  { 0xF5Bu, 0.00380000 },
+  { 0xF5Du, 0.00150000 },
+  { 0xF5Eu, 0.01960000 },
+  { 0xF5Fu, 0.00590000 },
+  { 0xF60u, 0.05750000 },
+  { 0xF61u, 0.03600000 },
+  { 0xF62u, 0.07060000 },
+  { 0xF63u, 0.05090000 },
+  { 0xF64u, 0.00740000 },
+  { 0xF66u, 0.12970000 },
+  { 0xF67u, 0.00120000 },
+  { 0xF68u, 0.00720000 },
+};
+
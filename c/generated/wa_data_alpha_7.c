@@ -0,0 +1,163 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_7_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+  "Á",
+  "É",
+  "Í",
+  "Ó",
+  "Ú",
+  "Ü",
+};
+const char *ALPHA_7_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+  "á",
+  "é",
+  "í",
+  "ó",
+  "ú",
+  "ü",
+};
+const char *ALPHA_7_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_7_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 193, 201, 205, 211, 218, 220,
+};
+const uint32_t ALPHA_7_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 225, 233, 237, 243, 250, 252,
+};
+const uint32_t ALPHA_7_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_7_FREQ[] = {
+  { "a", 0.13270000 },
+  { "b", 0.01650000 },
+  { "c", 0.04780000 },
+  { "d", 0.04680000 },
+  { "e", 0.10540000 },
+  { "f", 0.00960000 },
+  { "g", 0.01220000 },
+  { "h", 0.01060000 },
+  { "i", 0.07320000 },
+  { "j", 0.00070000 },
+  { "k", 0.00280000 },
+  { "l", 0.04310000 },
+  { "m", 0.02820000 },
+  { "n", 0.07880000 },
+  { "o", 0.08480000 },
+  { "p", 0.02470000 },
+  { "q", 0.00580000 },
+  { "r", 0.06400000 },
+  { "s", 0.06620000 },
+  { "t", 0.05490000 },
+  { "u", 0.04000000 },
+  { "v", 0.00850000 },
+  { "w", 0.00060000 },
+  { "x", 0.00380000 },
+  { "y", 0.01770000 },
+  { "z", 0.00440000 },
+  { "á", 0.00230000 },
+  { "é", 0.00290000 },
+  { "í", 0.00310000 },
+  { "ó", 0.00730000 },
+  { "ú", 0.00030000 },
+  { "ü", 0.00020000 },
+};
+
+const wa_cp_freq ALPHA_7_FREQ_CPS[] = {
+  { 0x61u, 0.13270000 },
+  { 0x62u, 0.01650000 },
+  { 0x63u, 0.04780000 },
+  { 0x64u, 0.04680000 },
+  { 0x65u, 0.10540000 },
+  { 0x66u, 0.00960000 },
+  { 0x67u, 0.01220000 },
+  { 0x68u, 0.01060000 },
+  { 0x69u, 0.07320000 },
+  { 0x6Au, 0.00070000 },
+  { 0x6Bu, 0.00280000 },
+  { 0x6Cu, 0.04310000 },
+  { 0x6Du, 0.02820000 },
+  { 0x6Eu, 0.07880000 },
+  { 0x6Fu, 0.08480000 },
+  { 0x70u, 0.02470000 },
+  { 0x71u, 0.00580000 },
+  { 0x72u, 0.06400000 },
+  { 0x73u, 0.06620000 },
+  { 0x74u, 0.05490000 },
+  { 0x75u, 0.04000000 },
+  { 0x76u, 0.00850000 },
+  { 0x77u, 0.00060000 },
+  { 0x78u, 0.00380000 },
+  { 0x79u, 0.01770000 },
+  { 0x7Au, 0.00440000 },
+  { 0xE1u, 0.00230000 },
+  { 0xE9u, 0.00290000 },
+  { 0xEDu, 0.00310000 },
+  { 0xF3u, 0.00730000 },
+  { 0xFAu, 0.00030000 },
+  { 0xFCu, 0.00020000 },
+};
+
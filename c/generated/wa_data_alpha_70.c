@@ -0,0 +1,207 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_70_UPPER[] = {
+  "A",
+  "B",
+  "D",
+  "Ɖ",
+  "E",
+  "Ɛ",
+  "F",
+  "Ƒ",
+  "G",
+  "Ɣ",
+  "H",
+  "X",
+  "I",
+  "K",
+  "L",
+  "M",
+  "N",
+  "Ŋ",
+  "O",
+  "Ɔ",
+  "P",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "Ʋ",
+  "W",
+  "Y",
+  "Z",
+  "À",
+  "Á",
+  "Ã",
+  "È",
+  "É",
+  "Ì",
+  "Í",
+  "Ò",
+  "Ó",
+  "Õ",
+  "Ù",
+  "Ú",
+  "Ĩ",
+  "Ũ",
+  "Ẽ",
+};
+const char *ALPHA_70_LOWER[] = {
+  "a",
+  "b",
+  "d",
+  "ɖ",
+  "e",
+  "ɛ",
+  "f",
+  "ƒ",
+  "g",
+  "ɣ",
+  "h",
+  "x",
+  "i",
+  "k",
+  "l",
+  "m",
+  "n",
+  "ŋ",
+  "o",
+  "ɔ",
+  "p",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "ʋ",
+  "w",
+  "y",
+  "z",
+  "à",
+  "á",
+  "ã",
+  "è",
+  "é",
+  "ì",
+  "í",
+  "ò",
+  "ó",
+  "õ",
+  "ù",
+  "ú",
+  "ĩ",
+  "ũ",
+  "ẽ",
+};
+const char *ALPHA_70_DIGITS[] = {
+};
+const uint32_t ALPHA_70_UPPER_CPS[] = {
+  65, 66, 68, 69, 70, 71, 72, 73, 75, 76, 77, 78, 79, 80, 82, 83,
+  84, 85, 86, 87, 88, 89, 90, 192, 193, 195, 200, 201, 204, 205, 210, 211,
+  213, 217, 218, 296, 330, 360, 390, 393, 400, 401, 404, 434, 7868,
+};
+const uint32_t ALPHA_70_LOWER_CPS[] = {
+  97, 98, 100, 101, 102, 103, 104, 105, 107, 108, 109, 110, 111, 112, 114, 115,
+  116, 117, 118, 119, 120, 121, 122, 224, 225, 227, 232, 233, 236, 237, 242, 243,
+  245, 249, 250, 297, 331, 361, 402, 596, 598, 603, 611, 651, 7869,
+};
+const uint32_t ALPHA_70_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_70_FREQ[] = {
+  { "a", 0.11180000 },
+  { "b", 0.02660000 },
+  { "d", 0.03130000 },
+  { "ɖ", 0.01740000 },
+  { "e", 0.15540000 },
+  { "ɛ", 0.00100000 },
+  { "f", 0.01010000 },
+  { "ƒ", 0.01850000 },
+  { "g", 0.02470000 },
+  { "ɣ", 0.00300000 },
+  { "h", 0.01120000 },
+  { "x", 0.00610000 },
+  { "i", 0.05700000 },
+  { "k", 0.03590000 },
+  { "l", 0.05300000 },
+  { "m", 0.03410000 },
+  { "n", 0.04870000 },
+  { "ŋ", 0.00810000 },
+  { "o", 0.06790000 },
+  { "ɔ", 0.04290000 },
+  { "p", 0.01480000 },
+  { "r", 0.02000000 },
+  { "s", 0.03560000 },
+  { "t", 0.03460000 },
+  { "u", 0.03680000 },
+  { "v", 0.00850000 },
+  { "ʋ", 0.00240000 },
+  { "w", 0.03440000 },
+  { "y", 0.02730000 },
+  { "z", 0.01130000 },
+  { "à", 0.00010000 },
+  { "á", 0.00010000 },
+  { "ã", 0.00470000 },
+  { "è", 0.00020000 },
+  { "é", 0.00080000 },
+  { "ì", 0.00000000 },
+  { "í", 0.00040000 },
+  { "ò", 0.00080000 },
+  { "ó", 0.00010000 },
+  { "õ", 0.00000000 },
+  { "ù", 0.00000000 },
+  { "ú", 0.00010000 },
+  { "ĩ", 0.00010000 },
+  { "ũ", 0.00010000 },
+  { "ẽ", 0.00210000 },
+};
+
+const wa_cp_freq ALPHA_70_FREQ_CPS[] = {
+  { 0x61u, 0.11180000 },
+  { 0x62u, 0.02660000 },
+  { 0x64u, 0.03130000 },
+  { 0x65u, 0.15540000 },
+  { 0x66u, 0.01010000 },
+  { 0x67u, 0.02470000 },
+  { 0x68u, 0.01120000 },
+  { 0x69u, 0.05700000 },
+  { 0x6Bu, 0.03590000 },
+  { 0x6Cu, 0.05300000 },
+  { 0x6Du, 0.03410000 },
+  { 0x6Eu, 0.04870000 },
+  { 0x6Fu, 0.06790000 },
+  { 0x70u, 0.01480000 },
+  { 0x72u, 0.02000000 },
+  { 0x73u, 0.03560000 },
+  { 0x74u, 0.03460000 },
+  { 0x75u, 0.03680000 },
+  { 0x76u, 0.00850000 },
+  { 0x77u, 0.03440000 },
+  { 0x78u, 0.00610000 },
+  { 0x79u, 0.02730000 },
+  { 0x7Au, 0.01130000 },
+  { 0xE0u, 0.00010000 },
+  { 0xE1u, 0.00010000 },
+  { 0xE3u, 0.00470000 },
+  { 0xE8u, 0.00020000 },
+  { 0xE9u, 0.00080000 },
+  { 0xECu, 0.00000000 },
+  { 0xEDu, 0.00040000 },
+  { 0xF2u, 0.00080000 },
+  { 0xF3u, 0.00010000 },
+  { 0xF5u, 0.00000000 },
+  { 0xF9u, 0.00000000 },
+  { 0xFAu, 0.00010000 },
+  { 0x129u, 0.00010000 },
+  { 0x14Bu, 0.00810000 },
+  { 0x169u, 0.00010000 },
+  { 0x192u, 0.01850000 },
+  { 0x254u, 0.04290000 },
+  { 0x256u, 0.01740000 },
+  { 0x25Bu, 0.00100000 },
+  { 0x263u, 0.00300000 },
+  { 0x28Bu, 0.00240000 },
+  { 0x1EBDu, 0.00210000 },
+};
+
@@ -0,0 +1,171 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_71_UPPER[] = {
+  "Α",
+  "Β",
+  "Γ",
+  "Δ",
+  "Ε",
+  "Ζ",
+  "Η",
+  "Θ",
+  "Ι",
+  "Κ",
+  "Λ",
+  "Μ",
+  "Ν",
+  "Ξ",
+  "Ο",
+  "Π",
+  "Ρ",
+  "Σ",
+  "Σ",
+  "Τ",
+  "Υ",
+  "Φ",
+  "Χ",
+  "Ψ",
+  "Ω",
+  "Ϊ́",
+  "Ά",
+  "Έ",
+  "Ή",
+  "Ί",
+  "Ϋ́",
+  "Ϊ",
+  "Ϋ",
+  "Ό",
+  "Ύ",
+  "Ώ",
+};
+const char *ALPHA_71_LOWER[] = {
+  "α",
+  "β",
+  "γ",
+  "δ",
+  "ε",
+  "ζ",
+  "η",
+  "θ",
+  "ι",
+  "κ",
+  "λ",
+  "μ",
+  "ν",
+  "ξ",
+  "ο",
+  "π",
+  "ρ",
+  "ς",
+  "σ",
+  "τ",
+  "υ",
+  "φ",
+  "χ",
+  "ψ",
+  "ω",
+  "ΐ",
+  "ά",
+  "έ",
+  "ή",
+  "ί",
+  "ΰ",
+  "ϊ",
+  "ϋ",
+  "ό",
+  "ύ",
+  "ώ",
+};
+const char *ALPHA_71_DIGITS[] = {
+};
+const uint32_t ALPHA_71_UPPER_CPS[] = {
+  902, 904, 905, 906, 908, 910, 911, 913, 914, 915, 916, 917, 918, 919, 920, 921,
+  922, 923, 924, 925, 926, 927, 928, 929, 931, 932, 933, 934, 935, 936, 937, 938,
+  939,
+};
+const uint32_t ALPHA_71_LOWER_CPS[] = {
+  912, 940, 941, 942, 943, 944, 945, 946, 947, 948, 949, 950, 951, 952, 953, 954,
+  955, 956, 957, 958, 959, 960, 961, 962, 963, 964, 965, 966, 967, 968, 969, 970,
+  971, 972, 973, 974,
+};
+const uint32_t ALPHA_71_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_71_FREQ[] = {
+  { "α", 0.09440000 },
+  { "β", 0.00720000 },
+  { "γ", 0.01790000 },
+  { "δ", 0.01590000 },
+  { "ε", 0.06330000 },
+  { "ζ", 0.00330000 },
+  { "η", 0.03930000 },
+  { "θ", 0.01000000 },
+  { "ι", 0.06560000 },
+  { "κ", 0.04250000 },
+  { "λ", 0.02840000 },
+  { "μ", 0.03300000 },
+  { "ν", 0.06080000 },
+  { "ξ", 0.00340000 },
+  { "ο", 0.08530000 },
+  { "π", 0.03670000 },
+  { "ρ", 0.04520000 },
+  { "ς", 0.03470000 },
+  { "σ", 0.04440000 },
+  { "τ", 0.08580000 },
+  { "υ", 0.03360000 },
+  { "φ", 0.00830000 },
+  { "χ", 0.01200000 },
+  { "ψ", 0.00110000 },
+  { "ω", 0.01330000 },
+  { "ΐ", 0.00010000 },
+  { "ά", 0.01980000 },
+  { "έ", 0.01760000 },
+  { "ή", 0.01410000 },
+  { "ί", 0.02440000 },
+  { "ΰ", 0.00000000 },
+  { "ϊ", 0.00050000 },
+  { "ϋ", 0.00000000 },
+  { "ό", 0.02120000 },
+  { "ύ", 0.01000000 },
+  { "ώ", 0.00700000 },
+};
+
+const wa_cp_freq ALPHA_71_FREQ_CPS[] = {
+  { 0x390u, 0.00010000 },
+  { 0x3ACu, 0.01980000 },
+  { 0x3ADu, 0.01760000 },
+  { 0x3AEu, 0.01410000 },
+  { 0x3AFu, 0.02440000 },
+  { 0x3B0u, 0.00000000 },
+  { 0x3B1u, 0.09440000 },
+  { 0x3B2u, 0.00720000 },
+  { 0x3B3u, 0.01790000 },
+  { 0x3B4u, 0.01590000 },
+  { 0x3B5u, 0.06330000 },
+  { 0x3B6u, 0.00330000 },
+  { 0x3B7u, 0.03930000 },
+  { 0x3B8u, 0.01000000 },
+  { 0x3B9u, 0.06560000 },
+  { 0x3BAu, 0.04250000 },
+  { 0x3BBu, 0.02840000 },
+  { 0x3BCu, 0.03300000 },
+  { 0x3BDu, 0.06080000 },
+  { 0x3BEu, 0.00340000 },
+  { 0x3BFu, 0.08530000 },
+  { 0x3C0u, 0.03670000 },
+  { 0x3C1u, 0.04520000 },
+  { 0x3C2u, 0.03470000 },
+  { 0x3C3u, 0.04440000 },
+  { 0x3C4u, 0.08580000 },
+  { 0x3C5u, 0.03360000 },
+  { 0x3C6u, 0.00830000 },
+  { 0x3C7u, 0.01200000 },
+  { 0x3C8u, 0.00110000 },
+  { 0x3C9u, 0.01330000 },
+  { 0x3CAu, 0.00050000 },
+  { 0x3CBu, 0.00000000 },
+  { 0x3CCu, 0.02120000 },
+  { 0x3CDu, 0.01000000 },
+  { 0x3CEu, 0.00700000 },
+};
+
@@ -0,0 +1,139 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_72_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+};
+const char *ALPHA_72_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+};
+const char *ALPHA_72_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_72_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90,
+};
+const uint32_t ALPHA_72_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122,
+};
+const uint32_t ALPHA_72_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_72_FREQ[] = {
+  { "a", 0.08680000 },
+  { "b", 0.01490000 },
+  { "c", 0.03430000 },
+  { "d", 0.03910000 },
+  { "e", 0.12160000 },
+  { "f", 0.02300000 },
+  { "g", 0.01950000 },
+  { "h", 0.04750000 },
+  { "i", 0.07540000 },
+  { "j", 0.00190000 },
+  { "k", 0.00600000 },
+  { "l", 0.04240000 },
+  { "m", 0.02650000 },
+  { "n", 0.07340000 },
+  { "o", 0.07380000 },
+  { "p", 0.02130000 },
+  { "q", 0.00110000 },
+  { "r", 0.06630000 },
+  { "s", 0.06640000 },
+  { "t", 0.08600000 },
+  { "u", 0.02690000 },
+  { "v", 0.01060000 },
+  { "w", 0.01670000 },
+  { "x", 0.00200000 },
+  { "y", 0.01550000 },
+  { "z", 0.00130000 },
+};
+
+const wa_cp_freq ALPHA_72_FREQ_CPS[] = {
+  { 0x61u, 0.08680000 },
+  { 0x62u, 0.01490000 },
+  { 0x63u, 0.03430000 },
+  { 0x64u, 0.03910000 },
+  { 0x65u, 0.12160000 },
+  { 0x66u, 0.02300000 },
+  { 0x67u, 0.01950000 },
+  { 0x68u, 0.04750000 },
+  { 0x69u, 0.07540000 },
+  { 0x6Au, 0.00190000 },
+  { 0x6Bu, 0.00600000 },
+  { 0x6Cu, 0.04240000 },
+  { 0x6Du, 0.02650000 },
+  { 0x6Eu, 0.07340000 },
+  { 0x6Fu, 0.07380000 },
+  { 0x70u, 0.02130000 },
+  { 0x71u, 0.00110000 },
+  { 0x72u, 0.06630000 },
+  { 0x73u, 0.06640000 },
+  { 0x74u, 0.08600000 },
+  { 0x75u, 0.02690000 },
+  { 0x76u, 0.01060000 },
+  { 0x77u, 0.01670000 },
+  { 0x78u, 0.00200000 },
+  { 0x79u, 0.01550000 },
+  { 0x7Au, 0.00130000 },
+};
+
@@ -0,0 +1,137 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_73_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "Ĉ",
+  "D",
+  "E",
+  "F",
+  "G",
+  "Ĝ",
+  "H",
+  "Ĥ",
+  "I",
+  "J",
+  "Ĵ",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "R",
+  "S",
+  "Ŝ",
+  "T",
+  "U",
+  "Ŭ",
+  "V",
+  "Z",
+};
+const char *ALPHA_73_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "ĉ",
+  "d",
+  "e",
+  "f",
+  "g",
+  "ĝ",
+  "h",
+  "ĥ",
+  "i",
+  "j",
+  "ĵ",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "r",
+  "s",
+  "ŝ",
+  "t",
+  "u",
+  "ŭ",
+  "v",
+  "z",
+};
+const char *ALPHA_73_DIGITS[] = {
+};
+const uint32_t ALPHA_73_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  82, 83, 84, 85, 86, 90, 264, 284, 292, 308, 348, 364,
+};
+const uint32_t ALPHA_73_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  114, 115, 116, 117, 118, 122, 265, 285, 293, 309, 349, 365,
+};
+const uint32_t ALPHA_73_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_73_FREQ[] = {
+  { "a", 0.12780000 },
+  { "b", 0.01230000 },
+  { "c", 0.01240000 },
+  { "ĉ", 0.00370000 },
+  { "d", 0.03440000 },
+  { "e", 0.09340000 },
+  { "f", 0.01070000 },
+  { "g", 0.01510000 },
+  { "ĝ", 0.00750000 },
+  { "h", 0.00690000 },
+  { "ĥ", 0.00040000 },
+  { "i", 0.08290000 },
+  { "j", 0.03320000 },
+  { "ĵ", 0.00120000 },
+  { "k", 0.04020000 },
+  { "l", 0.06050000 },
+  { "m", 0.02840000 },
+  { "n", 0.07310000 },
+  { "o", 0.09550000 },
+  { "p", 0.02480000 },
+  { "r", 0.06170000 },
+  { "s", 0.05710000 },
+  { "ŝ", 0.00190000 },
+  { "t", 0.05700000 },
+  { "u", 0.03190000 },
+  { "ŭ", 0.00440000 },
+  { "v", 0.01550000 },
+  { "z", 0.00620000 },
+};
+
+const wa_cp_freq ALPHA_73_FREQ_CPS[] = {
+  { 0x61u, 0.12780000 },
+  { 0x62u, 0.01230000 },
+  { 0x63u, 0.01240000 },
+  { 0x64u, 0.03440000 },
+  { 0x65u, 0.09340000 },
+  { 0x66u, 0.01070000 },
+  { 0x67u, 0.01510000 },
+  { 0x68u, 0.00690000 },
+  { 0x69u, 0.08290000 },
+  { 0x6Au, 0.03320000 },
+  { 0x6Bu, 0.04020000 },
+  { 0x6Cu, 0.06050000 },
+  { 0x6Du, 0.02840000 },
+  { 0x6Eu, 0.07310000 },
+  { 0x6Fu, 0.09550000 },
+  { 0x70u, 0.02480000 },
+  { 0x72u, 0.06170000 },
+  { 0x73u, 0.05710000 },
+  { 0x74u, 0.05700000 },
+  { 0x75u, 0.03190000 },
+  { 0x76u, 0.01550000 },
+  { 0x7Au, 0.00620000 },
+  { 0x109u, 0.00370000 },
+  { 0x11Du, 0.00750000 },
+  { 0x125u, 0.00040000 },
+  { 0x135u, 0.00120000 },
+  { 0x15Du, 0.00190000 },
+  { 0x16Du, 0.00440000 },
+};
+
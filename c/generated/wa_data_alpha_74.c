@@ -0,0 +1,169 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_74_UPPER[] = {
+  "A",
+  "Á",
+  "B",
+  "C",
+  "D",
+  "E",
+  "É",
+  "F",
+  "G",
+  "H",
+  "I",
+  "Í",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "Ñ",
+  "O",
+  "Ó",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "Ú",
+  "Ü",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+};
+const char *ALPHA_74_LOWER[] = {
+  "a",
+  "á",
+  "b",
+  "c",
+  "d",
+  "e",
+  "é",
+  "f",
+  "g",
+  "h",
+  "i",
+  "í",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "ñ",
+  "o",
+  "ó",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "ú",
+  "ü",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+};
+const char *ALPHA_74_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_74_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 193, 201, 205, 209, 211, 218,
+  220,
+};
+const uint32_t ALPHA_74_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 225, 233, 237, 241, 243, 250,
+  252,
+};
+const uint32_t ALPHA_74_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_74_FREQ[] = {
+  { "a", 0.11890000 },
+  { "á", 0.00370000 },
+  { "b", 0.01340000 },
+  { "c", 0.04580000 },
+  { "d", 0.05260000 },
+  { "e", 0.12800000 },
+  { "é", 0.00290000 },
+  { "f", 0.00890000 },
+  { "g", 0.01270000 },
+  { "h", 0.00760000 },
+  { "i", 0.06590000 },
+  { "í", 0.00500000 },
+  { "j", 0.00420000 },
+  { "k", 0.00150000 },
+  { "l", 0.05900000 },
+  { "m", 0.02760000 },
+  { "n", 0.07170000 },
+  { "ñ", 0.00190000 },
+  { "o", 0.08200000 },
+  { "ó", 0.00800000 },
+  { "p", 0.02580000 },
+  { "q", 0.00590000 },
+  { "r", 0.06620000 },
+  { "s", 0.07030000 },
+  { "t", 0.04590000 },
+  { "u", 0.03800000 },
+  { "ú", 0.00130000 },
+  { "ü", 0.00010000 },
+  { "v", 0.00960000 },
+  { "w", 0.00080000 },
+  { "x", 0.00200000 },
+  { "y", 0.00880000 },
+  { "z", 0.00400000 },
+};
+
+const wa_cp_freq ALPHA_74_FREQ_CPS[] = {
+  { 0x61u, 0.11890000 },
+  { 0x62u, 0.01340000 },
+  { 0x63u, 0.04580000 },
+  { 0x64u, 0.05260000 },
+  { 0x65u, 0.12800000 },
+  { 0x66u, 0.00890000 },
+  { 0x67u, 0.01270000 },
+  { 0x68u, 0.00760000 },
+  { 0x69u, 0.06590000 },
+  { 0x6Au, 0.00420000 },
+  { 0x6Bu, 0.00150000 },
+  { 0x6Cu, 0.05900000 },
+  { 0x6Du, 0.02760000 },
+  { 0x6Eu, 0.07170000 },
+  { 0x6Fu, 0.08200000 },
+  { 0x70u, 0.02580000 },
+  { 0x71u, 0.00590000 },
+  { 0x72u, 0.06620000 },
+  { 0x73u, 0.07030000 },
+  { 0x74u, 0.04590000 },
+  { 0x75u, 0.03800000 },
+  { 0x76u, 0.00960000 },
+  { 0x77u, 0.00080000 },
+  { 0x78u, 0.00200000 },
+  { 0x79u, 0.00880000 },
+  { 0x7Au, 0.00400000 },
+  { 0xE1u, 0.00370000 },
+  { 0xE9u, 0.00290000 },
+  { 0xEDu, 0.00500000 },
+  { 0xF1u, 0.00190000 },
+  { 0xF3u, 0.00800000 },
+  { 0xFAu, 0.00130000 },
+  { 0xFCu, 0.00010000 },
+};
+
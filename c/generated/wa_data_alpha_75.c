@@ -0,0 +1,153 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_75_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "Š",
+  "Z",
+  "Ž",
+  "T",
+  "U",
+  "V",
+  "W",
+  "Õ",
+  "Ä",
+  "Ö",
+  "Ü",
+  "X",
+  "Y",
+};
+const char *ALPHA_75_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "q",
+  "r",
+  "s",
+  "š",
+  "z",
+  "ž",
+  "t",
+  "u",
+  "v",
+  "w",
+  "õ",
+  "ä",
+  "ö",
+  "ü",
+  "x",
+  "y",
+};
+const char *ALPHA_75_DIGITS[] = {
+};
+const uint32_t ALPHA_75_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 196, 213, 214, 220, 352, 381,
+};
+const uint32_t ALPHA_75_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 228, 245, 246, 252, 353, 382,
+};
+const uint32_t ALPHA_75_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_75_FREQ[] = {
+  { "a", 0.12640000 },
+  { "b", 0.00970000 },
+  { "c", 0.00300000 },
+  { "d", 0.03680000 },
+  { "e", 0.09960000 },
+  { "f", 0.00310000 },
+  { "g", 0.01890000 },
+  { "h", 0.01550000 },
+  { "i", 0.10120000 },
+  { "j", 0.01720000 },
+  { "k", 0.04450000 },
+  { "l", 0.06280000 },
+  { "m", 0.03530000 },
+  { "n", 0.05300000 },
+  { "o", 0.04580000 },
+  { "p", 0.01800000 },
+  { "q", 0.00010000 },
+  { "r", 0.03990000 },
+  { "s", 0.08880000 },
+  { "š", 0.00040000 },
+  { "z", 0.00070000 },
+  { "ž", 0.00020000 },
+  { "t", 0.07090000 },
+  { "u", 0.05370000 },
+  { "v", 0.02260000 },
+  { "w", 0.00090000 },
+  { "õ", 0.00960000 },
+  { "ä", 0.01070000 },
+  { "ö", 0.00230000 },
+  { "ü", 0.00690000 },
+  { "x", 0.00040000 },
+  { "y", 0.00110000 },
+};
+
+const wa_cp_freq ALPHA_75_FREQ_CPS[] = {
+  { 0x61u, 0.12640000 },
+  { 0x62u, 0.00970000 },
+  { 0x63u, 0.00300000 },
+  { 0x64u, 0.03680000 },
+  { 0x65u, 0.09960000 },
+  { 0x66u, 0.00310000 },
+  { 0x67u, 0.01890000 },
+  { 0x68u, 0.01550000 },
+  { 0x69u, 0.10120000 },
+  { 0x6Au, 0.01720000 },
+  { 0x6Bu, 0.04450000 },
+  { 0x6Cu, 0.06280000 },
+  { 0x6Du, 0.03530000 },
+  { 0x6Eu, 0.05300000 },
+  { 0x6Fu, 0.04580000 },
+  { 0x70u, 0.01800000 },
+  { 0x71u, 0.00010000 },
+  { 0x72u, 0.03990000 },
+  { 0x73u, 0.08880000 },
+  { 0x74u, 0.07090000 },
+  { 0x75u, 0.05370000 },
+  { 0x76u, 0.02260000 },
+  { 0x77u, 0.00090000 },
+  { 0x78u, 0.00040000 },
+  { 0x79u, 0.00110000 },
+  { 0x7Au, 0.00070000 },
+  { 0xE4u, 0.01070000 },
+  { 0xF5u, 0.00960000 },
+  { 0xF6u, 0.00230000 },
+  { 0xFCu, 0.00690000 },
+  { 0x161u, 0.00040000 },
+  { 0x17Eu, 0.00020000 },
+};
+
@@ -0,0 +1,137 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_76_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+  "Ç",
+  "Ñ",
+};
+const char *ALPHA_76_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+  "ç",
+  "ñ",
+};
+const char *ALPHA_76_DIGITS[] = {
+};
+const uint32_t ALPHA_76_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 199, 209,
+};
+const uint32_t ALPHA_76_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 231, 241,
+};
+const uint32_t ALPHA_76_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_76_FREQ[] = {
+  { "a", 0.14930000 },
+  { "b", 0.02710000 },
+  { "c", 0.00270000 },
+  { "d", 0.02970000 },
+  { "e", 0.13230000 },
+  { "f", 0.00480000 },
+  { "g", 0.02060000 },
+  { "h", 0.01200000 },
+  { "i", 0.08870000 },
+  { "j", 0.00280000 },
+  { "k", 0.05420000 },
+  { "l", 0.03080000 },
+  { "m", 0.01490000 },
+  { "n", 0.08230000 },
+  { "o", 0.05230000 },
+  { "p", 0.01290000 },
+  { "q", 0.00020000 },
+  { "r", 0.07860000 },
+  { "s", 0.02630000 },
+  { "t", 0.07510000 },
+  { "u", 0.04600000 },
+  { "v", 0.00120000 },
+  { "w", 0.00040000 },
+  { "x", 0.00530000 },
+  { "y", 0.00090000 },
+  { "z", 0.04840000 },
+  { "ç", 0.00000000 },
+  { "ñ", 0.00010000 },
+};
+
+const wa_cp_freq ALPHA_76_FREQ_CPS[] = {
+  { 0x61u, 0.14930000 },
+  { 0x62u, 0.02710000 },
+  { 0x63u, 0.00270000 },
+  { 0x64u, 0.02970000 },
+  { 0x65u, 0.13230000 },
+  { 0x66u, 0.00480000 },
+  { 0x67u, 0.02060000 },
+  { 0x68u, 0.01200000 },
+  { 0x69u, 0.08870000 },
+  { 0x6Au, 0.00280000 },
+  { 0x6Bu, 0.05420000 },
+  { 0x6Cu, 0.03080000 },
+  { 0x6Du, 0.01490000 },
+  { 0x6Eu, 0.08230000 },
+  { 0x6Fu, 0.05230000 },
+  { 0x70u, 0.01290000 },
+  { 0x71u, 0.00020000 },
+  { 0x72u, 0.07860000 },
+  { 0x73u, 0.02630000 },
+  { 0x74u, 0.07510000 },
+  { 0x75u, 0.04600000 },
+  { 0x76u, 0.00120000 },
+  { 0x77u, 0.00040000 },
+  { 0x78u, 0.00530000 },
+  { 0x79u, 0.00090000 },
+  { 0x7Au, 0.04840000 },
+  { 0xE7u, 0.00000000 },
+  { 0xF1u, 0.00010000 },
+};
+
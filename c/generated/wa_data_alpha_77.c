@@ -0,0 +1,229 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_77_UPPER[] = {
+  "A",
+  "Á",
+  "À",
+  "Â",
+  "Ǎ",
+  "B",
+  "D",
+  "Z",
+  "E",
+  "É",
+  "È",
+  "Ê",
+  "Ě",
+  "Ə",
+  "Ɛ",
+  "F",
+  "G",
+  "H",
+  "I",
+  "Í",
+  "Ì",
+  "Î",
+  "Ǐ",
+  "K",
+  "P",
+  "L",
+  "M",
+  "N",
+  "Ń",
+  "Ǹ",
+  "Ŋ",
+  "O",
+  "Ó",
+  "Ò",
+  "Ô",
+  "Ǒ",
+  "Ɔ",
+  "R",
+  "S",
+  "T",
+  "U",
+  "Ú",
+  "Ù",
+  "Û",
+  "Ǔ",
+  "V",
+  "W",
+  "Y",
+};
+const char *ALPHA_77_LOWER[] = {
+  "a",
+  "á",
+  "à",
+  "â",
+  "ǎ",
+  "b",
+  "d",
+  "z",
+  "e",
+  "é",
+  "è",
+  "ê",
+  "ě",
+  "ə",
+  "ɛ",
+  "f",
+  "g",
+  "h",
+  "i",
+  "í",
+  "ì",
+  "î",
+  "ǐ",
+  "k",
+  "p",
+  "l",
+  "m",
+  "n",
+  "ń",
+  "ǹ",
+  "ŋ",
+  "o",
+  "ó",
+  "ò",
+  "ô",
+  "ǒ",
+  "ɔ",
+  "r",
+  "s",
+  "t",
+  "u",
+  "ú",
+  "ù",
+  "û",
+  "ǔ",
+  "v",
+  "w",
+  "y",
+};
+const char *ALPHA_77_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_77_UPPER_CPS[] = {
+  65, 66, 68, 69, 70, 71, 72, 73, 75, 76, 77, 78, 79, 80, 82, 83,
+  84, 85, 86, 87, 89, 90, 192, 193, 194, 200, 201, 202, 204, 205, 206, 210,
+  211, 212, 217, 218, 219, 282, 323, 330, 390, 399, 400, 461, 463, 465, 467, 504,
+};
+const uint32_t ALPHA_77_LOWER_CPS[] = {
+  97, 98, 100, 101, 102, 103, 104, 105, 107, 108, 109, 110, 111, 112, 114, 115,
+  116, 117, 118, 119, 121, 122, 224, 225, 226, 232, 233, 234, 236, 237, 238, 242,
+  243, 244, 249, 250, 251, 283, 324, 331, 462, 464, 466, 468, 505, 596, 601, 603,
+};
+const uint32_t ALPHA_77_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_77_FREQ[] = {
+  { "a", 0.00000000 },
+  { "á", 0.00000000 },
+  { "à", 0.00000000 },
+  { "â", 0.00000000 },
+  { "ǎ", 0.00000000 },
+  { "b", 0.00000000 },
+  { "d", 0.00000000 },
+  { "z", 0.00000000 },
+  { "e", 0.00000000 },
+  { "é", 0.00000000 },
+  { "è", 0.00000000 },
+  { "ê", 0.00000000 },
+  { "ě", 0.00000000 },
+  { "ə", 0.00000000 },
+  { "ɛ", 0.00000000 },
+  { "f", 0.00000000 },
+  { "g", 0.00000000 },
+  { "h", 0.00000000 },
+  { "i", 0.00000000 },
+  { "í", 0.00000000 },
+  { "ì", 0.00000000 },
+  { "î", 0.00000000 },
+  { "ǐ", 0.00000000 },
+  { "k", 0.00000000 },
+  { "p", 0.00000000 },
+  { "l", 0.00000000 },
+  { "m", 0.00000000 },
+  { "n", 0.00000000 },
+  { "ń", 0.00000000 },
+  { "ǹ", 0.00000000 },
+  { "ŋ", 0.00000000 },
+  { "o", 0.00000000 },
+  { "ó", 0.00000000 },
+  { "ò", 0.00000000 },
+  { "ô", 0.00000000 },
+  { "ǒ", 0.00000000 },
+  { "ɔ", 0.00000000 },
+  { "r", 0.00000000 },
+  { "s", 0.00000000 },
+  { "t", 0.00000000 },
+  { "u", 0.00000000 },
+  { "ú", 0.00000000 },
+  { "ù", 0.00000000 },
+  { "û", 0.00000000 },
+  { "ǔ", 0.00000000 },
+  { "v", 0.00000000 },
+  { "w", 0.00000000 },
+  { "y", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_77_FREQ_CPS[] = {
+  { 0x61u, 0.00000000 },
+  { 0x62u, 0.00000000 },
+  { 0x64u, 0.00000000 },
+  { 0x65u, 0.00000000 },
+  { 0x66u, 0.00000000 },
+  { 0x67u, 0.00000000 },
+  { 0x68u, 0.00000000 },
+  { 0x69u, 0.00000000 },
+  { 0x6Bu, 0.00000000 },
+  { 0x6Cu, 0.00000000 },
+  { 0x6Du, 0.00000000 },
+  { 0x6Eu, 0.00000000 },
+  { 0x6Fu, 0.00000000 },
+  { 0x70u, 0.00000000 },
+  { 0x72u, 0.00000000 },
+  { 0x73u, 0.00000000 },
+  { 0x74u, 0.00000000 },
+  { 0x75u, 0.00000000 },
+  { 0x76u, 0.00000000 },
+  { 0x77u, 0.00000000 },
+  { 0x79u, 0.00000000 },
+  { 0x7Au, 0.00000000 },
+  { 0xE0u, 0.00000000 },
+  { 0xE1u, 0.00000000 },
+  { 0xE2u, 0.00000000 },
+  { 0xE8u, 0.00000000 },
+  { 0xE9u, 0.00000000 },
+  { 0xEAu, 0.00000000 },
+  { 0xECu, 0.00000000 },
+  { 0xEDu, 0.00000000 },
+  { 0xEEu, 0.00000000 },
+  { 0xF2u, 0.00000000 },
+  { 0xF3u, 0.00000000 },
+  { 0xF4u, 0.00000000 },
+  { 0xF9u, 0.00000000 },
+  { 0xFAu, 0.00000000 },
+  { 0xFBu, 0.00000000 },
+  { 0x11Bu, 0.00000000 },
+  { 0x144u, 0.00000000 },
+  { 0x14Bu, 0.00000000 },
+  { 0x1CEu, 0.00000000 },
+  { 0x1D0u, 0.00000000 },
+  { 0x1D2u, 0.00000000 },
+  { 0x1D4u, 0.00000000 },
+  { 0x1F9u, 0.00000000 },
+  { 0x254u, 0.00000000 },
+  { 0x259u, 0.00000000 },
+  { 0x25Bu, 0.00000000 },
+};
+
@@ -0,0 +1,179 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_78_UPPER[] = {
+  "آ",
+  "ا",
+  "ب",
+  "پ",
+  "ت",
+  "ث",
+  "ج",
+  "چ",
+  "ح",
+  "خ",
+  "د",
+  "ذ",
+  "ر",
+  "ز",
+  "ژ",
+  "س",
+  "ش",
+  "ص",
+  "ض",
+  "ط",
+  "ظ",
+  "ع",
+  "غ",
+  "ف",
+  "ق",
+  "ک",
+  "گ",
+  "ل",
+  "م",
+  "ن",
+  "و",
+  "ه",
+  "ی",
+  "ء",
+  "أ",
+  "ؤ",
+  "ئ",
+  "ة",
+};
+const char *ALPHA_78_LOWER[] = {
+  "آ",
+  "ا",
+  "ب",
+  "پ",
+  "ت",
+  "ث",
+  "ج",
+  "چ",
+  "ح",
+  "خ",
+  "د",
+  "ذ",
+  "ر",
+  "ز",
+  "ژ",
+  "س",
+  "ش",
+  "ص",
+  "ض",
+  "ط",
+  "ظ",
+  "ع",
+  "غ",
+  "ف",
+  "ق",
+  "ک",
+  "گ",
+  "ل",
+  "م",
+  "ن",
+  "و",
+  "ه",
+  "ی",
+  "ء",
+  "أ",
+  "ؤ",
+  "ئ",
+  "ة",
+};
+const char *ALPHA_78_DIGITS[] = {
+};
+const uint32_t ALPHA_78_UPPER_CPS[] = {
+  1569, 1570, 1571, 1572, 1574, 1575, 1576, 1577, 1578, 1579, 1580, 1581, 1582, 1583, 1584, 1585,
+  1586, 1587, 1588, 1589, 1590, 1591, 1592, 1593, 1594, 1601, 1602, 1604, 1605, 1606, 1607, 1608,
+  1662, 1670, 1688, 1705, 1711, 1740,
+};
+const uint32_t ALPHA_78_LOWER_CPS[] = {
+  1569, 1570, 1571, 1572, 1574, 1575, 1576, 1577, 1578, 1579, 1580, 1581, 1582, 1583, 1584, 1585,
+  1586, 1587, 1588, 1589, 1590, 1591, 1592, 1593, 1594, 1601, 1602, 1604, 1605, 1606, 1607, 1608,
+  1662, 1670, 1688, 1705, 1711, 1740,
+};
+const uint32_t ALPHA_78_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_78_FREQ[] = {
+  { "آ", 0.00820000 },
+  { "ا", 0.14630000 },
+  { "ب", 0.04370000 },
+  { "پ", 0.00790000 },
+  { "ت", 0.05030000 },
+  { "ث", 0.00280000 },
+  { "ج", 0.01030000 },
+  { "چ", 0.00330000 },
+  { "ح", 0.00740000 },
+  { "خ", 0.01120000 },
+  { "د", 0.06930000 },
+  { "ذ", 0.00140000 },
+  { "ر", 0.08760000 },
+  { "ز", 0.02110000 },
+  { "ژ", 0.00120000 },
+  { "س", 0.03840000 },
+  { "ش", 0.02660000 },
+  { "ص", 0.00490000 },
+  { "ض", 0.00180000 },
+  { "ط", 0.00550000 },
+  { "ظ", 0.00130000 },
+  { "ع", 0.01240000 },
+  { "غ", 0.00220000 },
+  { "ف", 0.01320000 },
+  { "ق", 0.01070000 },
+  { "ک", 0.02790000 },
+  { "گ", 0.01250000 },
+  { "ل", 0.02860000 },
+  { "م", 0.05170000 },
+  { "ن", 0.06870000 },
+  { "و", 0.06090000 },
+  { "ه", 0.06130000 },
+  { "ی", 0.09780000 },
+  { "ء", 0.00010000 },
+  { "أ", 0.00020000 },
+  { "ؤ", 0.00010000 },
+  { "ئ", 0.00120000 },
+  { "ة", 0.00010000 },
+};
+
+const wa_cp_freq ALPHA_78_FREQ_CPS[] = {
+  { 0x621u, 0.00010000 },
+  { 0x622u, 0.00820000 },
+  { 0x623u, 0.00020000 },
+  { 0x624u, 0.00010000 },
+  { 0x626u, 0.00120000 },
+  { 0x627u, 0.14630000 },
+  { 0x628u, 0.04370000 },
+  { 0x629u, 0.00010000 },
+  { 0x62Au, 0.05030000 },
+  { 0x62Bu, 0.00280000 },
+  { 0x62Cu, 0.01030000 },
+  { 0x62Du, 0.00740000 },
+  { 0x62Eu, 0.01120000 },
+  { 0x62Fu, 0.06930000 },
+  { 0x630u, 0.00140000 },
+  { 0x631u, 0.08760000 },
+  { 0x632u, 0.02110000 },
+  { 0x633u, 0.03840000 },
+  { 0x634u, 0.02660000 },
+  { 0x635u, 0.00490000 },
+  { 0x636u, 0.00180000 },
+  { 0x637u, 0.00550000 },
+  { 0x638u, 0.00130000 },
+  { 0x639u, 0.01240000 },
+  { 0x63Au, 0.00220000 },
+  { 0x641u, 0.01320000 },
+  { 0x642u, 0.01070000 },
+  { 0x644u, 0.02860000 },
+  { 0x645u, 0.05170000 },
+  { 0x646u, 0.06870000 },
+  { 0x647u, 0.06130000 },
+  { 0x648u, 0.06090000 },
+  { 0x67Eu, 0.00790000 },
+  { 0x686u, 0.00330000 },
+  { 0x698u, 0.00120000 },
+  { 0x6A9u, 0.02790000 },
+  { 0x6AFu, 0.01250000 },
+  { 0x6CCu, 0.09780000 },
+};
+
@@ -0,0 +1,141 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_79_UPPER[] = {
+  "𞤀",
+  "𞤛",
+  "𞤁",
+  "𞤂",
+  "𞤃",
+  "𞤄",
+  "𞤅",
+  "𞤆",
+  "𞤇",
+  "𞤈",
+  "𞤉",
+  "𞤊",
+  "𞤋",
+  "𞤌",
+  "𞤍",
+  "𞤎",
+  "𞤏",
+  "𞤐",
+  "𞤑",
+  "𞤒",
+  "𞤓",
+  "𞤔",
+  "𞤕",
+  "𞤖",
+  "𞤗",
+  "𞤘",
+  "𞤙",
+  "𞤚",
+  "𞥋",
+};
+const char *ALPHA_79_LOWER[] = {
+  "𞤢",
+  "𞤽",
+  "𞤣",
+  "𞤤",
+  "𞤥",
+  "𞤦",
+  "𞤧",
+  "𞤨",
+  "𞤩",
+  "𞤪",
+  "𞤫",
+  "𞤬",
+  "𞤭",
+  "𞤮",
+  "𞤯",
+  "𞤰",
+  "𞤱",
+  "𞤲",
+  "𞤳",
+  "𞤴",
+  "𞤵",
+  "𞤶",
+  "𞤷",
+  "𞤸",
+  "𞤹",
+  "𞤺",
+  "𞤻",
+  "𞤼",
+  "𞥋",
+};
+const char *ALPHA_79_DIGITS[] = {
+};
+const uint32_t ALPHA_79_UPPER_CPS[] = {
+  125184, 125185, 125186, 125187, 125188, 125189, 125190, 125191, 125192, 125193, 125194, 125195, 125196, 125197, 125198, 125199,
+  125200, 125201, 125202, 125203, 125204, 125205, 125206, 125207, 125208, 125209, 125210, 125211, 125259,
+};
+const uint32_t ALPHA_79_LOWER_CPS[] = {
+  125218, 125219, 125220, 125221, 125222, 125223, 125224, 125225, 125226, 125227, 125228, 125229, 125230, 125231, 125232, 125233,
+  125234, 125235, 125236, 125237, 125238, 125239, 125240, 125241, 125242, 125243, 125244, 125245, 125259,
+};
+const uint32_t ALPHA_79_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_79_FREQ[] = {
+  { "𞤢", 0.00000000 },
+  { "𞤽", 0.00000000 },
+  { "𞤣", 0.00000000 },
+  { "𞤤", 0.00000000 },
+  { "𞤥", 0.00000000 },
+  { "𞤦", 0.00000000 },
+  { "𞤧", 0.00000000 },
+  { "𞤨", 0.00000000 },
+  { "𞤩", 0.00000000 },
+  { "𞤪", 0.00000000 },
+  { "𞤫", 0.00000000 },
+  { "𞤬", 0.00000000 },
+  { "𞤭", 0.00000000 },
+  { "𞤮", 0.00000000 },
+  { "𞤯", 0.00000000 },
+  { "𞤰", 0.00000000 },
+  { "𞤱", 0.00000000 },
+  { "𞤲", 0.00000000 },
+  { "𞤳", 0.00000000 },
+  { "𞤴", 0.00000000 },
+  { "𞤵", 0.00000000 },
+  { "𞤶", 0.00000000 },
+  { "𞤷", 0.00000000 },
+  { "𞤸", 0.00000000 },
+  { "𞤹", 0.00000000 },
+  { "𞤺", 0.00000000 },
+  { "𞤻", 0.00000000 },
+  { "𞤼", 0.00000000 },
+  { "𞥋", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_79_FREQ_CPS[] = {
+  { 0x1E922u, 0.00000000 },
+  { 0x1E923u, 0.00000000 },
+  { 0x1E924u, 0.00000000 },
+  { 0x1E925u, 0.00000000 },
+  { 0x1E926u, 0.00000000 },
+  { 0x1E927u, 0.00000000 },
+  { 0x1E928u, 0.00000000 },
+  { 0x1E929u, 0.00000000 },
+  { 0x1E92Au, 0.00000000 },
+  { 0x1E92Bu, 0.00000000 },
+  { 0x1E92Cu, 0.00000000 },
+  { 0x1E92Du, 0.00000000 },
+  { 0x1E92Eu, 0.00000000 },
+  { 0x1E92Fu, 0.00000000 },
+  { 0x1E930u, 0.00000000 },
+  { 0x1E931u, 0.00000000 },
+  { 0x1E932u, 0.00000000 },
+  { 0x1E933u, 0.00000000 },
+  { 0x1E934u, 0.00000000 },
+  { 0x1E935u, 0.00000000 },
+  { 0x1E936u, 0.00000000 },
+  { 0x1E937u, 0.00000000 },
+  { 0x1E938u, 0.00000000 },
+  { 0x1E939u, 0.00000000 },
+  { 0x1E93Au, 0.00000000 },
+  { 0x1E93Bu, 0.00000000 },
+  { 0x1E93Cu, 0.00000000 },
+  { 0x1E93Du, 0.00000000 },
+  { 0x1E94Bu, 0.00000000 },
+};
+
@@ -0,0 +1,181 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_8_UPPER[] = {
+  "ا",
+  "ب",
+  "ت",
+  "ث",
+  "ج",
+  "ح",
+  "خ",
+  "د",
+  "ذ",
+  "ر",
+  "ز",
+  "س",
+  "ش",
+  "ص",
+  "ض",
+  "ط",
+  "ظ",
+  "ع",
+  "غ",
+  "ف",
+  "ق",
+  "ك",
+  "ل",
+  "م",
+  "ن",
+  "ه",
+  "و",
+  "ي",
+  "ء",
+  "آ",
+  "أ",
+  "ؤ",
+  "إ",
+  "ئ",
+  "ة",
+  "ى",
+};
+const char *ALPHA_8_LOWER[] = {
+  "ا",
+  "ب",
+  "ت",
+  "ث",
+  "ج",
+  "ح",
+  "خ",
+  "د",
+  "ذ",
+  "ر",
+  "ز",
+  "س",
+  "ش",
+  "ص",
+  "ض",
+  "ط",
+  "ظ",
+  "ع",
+  "غ",
+  "ف",
+  "ق",
+  "ك",
+  "ل",
+  "م",
+  "ن",
+  "ه",
+  "و",
+  "ي",
+  "ء",
+  "آ",
+  "أ",
+  "ؤ",
+  "إ",
+  "ئ",
+  "ة",
+  "ى",
+};
+const char *ALPHA_8_DIGITS[] = {
+  "٠",
+  "١",
+  "٢",
+  "٣",
+  "٤",
+  "٥",
+  "٦",
+  "٧",
+  "٨",
+  "٩",
+};
+const uint32_t ALPHA_8_UPPER_CPS[] = {
+  1569, 1570, 1571, 1572, 1573, 1574, 1575, 1576, 1577, 1578, 1579, 1580, 1581, 1582, 1583, 1584,
+  1585, 1586, 1587, 1588, 1589, 1590, 1591, 1592, 1593, 1594, 1601, 1602, 1603, 1604, 1605, 1606,
+  1607, 1608, 1609, 1610,
+};
+const uint32_t ALPHA_8_LOWER_CPS[] = {
+  1569, 1570, 1571, 1572, 1573, 1574, 1575, 1576, 1577, 1578, 1579, 1580, 1581, 1582, 1583, 1584,
+  1585, 1586, 1587, 1588, 1589, 1590, 1591, 1592, 1593, 1594, 1601, 1602, 1603, 1604, 1605, 1606,
+  1607, 1608, 1609, 1610,
+};
+const uint32_t ALPHA_8_DIGITS_CPS[] = {
+  1632, 1633, 1634, 1635, 1636, 1637, 1638, 1639, 1640, 1641,
+};
+const wa_freq_entry ALPHA_8_FREQ[] = {
+  { "ا", 0.14510000 },
+  { "ب", 0.03760000 },
+  { "ت", 0.04300000 },
+  { "ث", 0.00640000 },
+  { "ج", 0.01420000 },
+  { "ح", 0.01770000 },
+  { "خ", 0.00800000 },
+  { "د", 0.03190000 },
+  { "ذ", 0.00570000 },
+  { "ر", 0.04790000 },
+  { "ز", 0.00670000 },
+  { "س", 0.02630000 },
+  { "ش", 0.00960000 },
+  { "ص", 0.00910000 },
+  { "ض", 0.00560000 },
+  { "ط", 0.00940000 },
+  { "ظ", 0.00210000 },
+  { "ع", 0.03290000 },
+  { "غ", 0.00490000 },
+  { "ف", 0.02630000 },
+  { "ق", 0.02020000 },
+  { "ك", 0.02130000 },
+  { "ل", 0.11170000 },
+  { "م", 0.06560000 },
+  { "ن", 0.05200000 },
+  { "ه", 0.02430000 },
+  { "و", 0.05630000 },
+  { "ي", 0.08150000 },
+  { "ء", 0.00300000 },
+  { "آ", 0.00100000 },
+  { "أ", 0.01820000 },
+  { "ؤ", 0.00080000 },
+  { "إ", 0.00760000 },
+  { "ئ", 0.00370000 },
+  { "ة", 0.03410000 },
+  { "ى", 0.00840000 },
+};
+
+const wa_cp_freq ALPHA_8_FREQ_CPS[] = {
+  { 0x621u, 0.00300000 },
+  { 0x622u, 0.00100000 },
+  { 0x623u, 0.01820000 },
+  { 0x624u, 0.00080000 },
+  { 0x625u, 0.00760000 },
+  { 0x626u, 0.00370000 },
+  { 0x627u, 0.14510000 },
+  { 0x628u, 0.03760000 },
+  { 0x629u, 0.03410000 },
+  { 0x62Au, 0.04300000 },
+  { 0x62Bu, 0.00640000 },
+  { 0x62Cu, 0.01420000 },
+  { 0x62Du, 0.01770000 },
+  { 0x62Eu, 0.00800000 },
+  { 0x62Fu, 0.03190000 },
+  { 0x630u, 0.00570000 },
+  { 0x631u, 0.04790000 },
+  { 0x632u, 0.00670000 },
+  { 0x633u, 0.02630000 },
+  { 0x634u, 0.00960000 },
+  { 0x635u, 0.00910000 },
+  { 0x636u, 0.00560000 },
+  { 0x637u, 0.00940000 },
+  { 0x638u, 0.00210000 },
+  { 0x639u, 0.03290000 },
+  { 0x63Au, 0.00490000 },
+  { 0x641u, 0.02630000 },
+  { 0x642u, 0.02020000 },
+  { 0x643u, 0.02130000 },
+  { 0x644u, 0.11170000 },
+  { 0x645u, 0.06560000 },
+  { 0x646u, 0.05200000 },
+  { 0x647u, 0.02430000 },
+  { 0x648u, 0.05630000 },
+  { 0x649u, 0.00840000 },
+  { 0x64Au, 0.08150000 },
+};
+
@@ -0,0 +1,149 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_81_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+  "Å",
+  "Ä",
+  "Ö",
+  "Š",
+  "Ž",
+};
+const char *ALPHA_81_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+  "å",
+  "ä",
+  "ö",
+  "š",
+  "ž",
+};
+const char *ALPHA_81_DIGITS[] = {
+};
+const uint32_t ALPHA_81_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 196, 197, 214, 352, 381,
+};
+const uint32_t ALPHA_81_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 228, 229, 246, 353, 382,
+};
+const uint32_t ALPHA_81_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_81_FREQ[] = {
+  { "a", 0.12260000 },
+  { "b", 0.00330000 },
+  { "c", 0.00340000 },
+  { "d", 0.01100000 },
+  { "e", 0.07930000 },
+  { "f", 0.00220000 },
+  { "g", 0.00430000 },
+  { "h", 0.01900000 },
+  { "i", 0.10680000 },
+  { "j", 0.02080000 },
+  { "k", 0.04950000 },
+  { "l", 0.05870000 },
+  { "m", 0.03120000 },
+  { "n", 0.08780000 },
+  { "o", 0.05620000 },
+  { "p", 0.01880000 },
+  { "q", 0.00010000 },
+  { "r", 0.03000000 },
+  { "s", 0.07890000 },
+  { "t", 0.08520000 },
+  { "u", 0.05140000 },
+  { "v", 0.02220000 },
+  { "w", 0.00120000 },
+  { "x", 0.00030000 },
+  { "y", 0.01710000 },
+  { "z", 0.00060000 },
+  { "å", 0.00000000 },
+  { "ä", 0.03350000 },
+  { "ö", 0.00440000 },
+  { "š", 0.00020000 },
+  { "ž", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_81_FREQ_CPS[] = {
+  { 0x61u, 0.12260000 },
+  { 0x62u, 0.00330000 },
+  { 0x63u, 0.00340000 },
+  { 0x64u, 0.01100000 },
+  { 0x65u, 0.07930000 },
+  { 0x66u, 0.00220000 },
+  { 0x67u, 0.00430000 },
+  { 0x68u, 0.01900000 },
+  { 0x69u, 0.10680000 },
+  { 0x6Au, 0.02080000 },
+  { 0x6Bu, 0.04950000 },
+  { 0x6Cu, 0.05870000 },
+  { 0x6Du, 0.03120000 },
+  { 0x6Eu, 0.08780000 },
+  { 0x6Fu, 0.05620000 },
+  { 0x70u, 0.01880000 },
+  { 0x71u, 0.00010000 },
+  { 0x72u, 0.03000000 },
+  { 0x73u, 0.07890000 },
+  { 0x74u, 0.08520000 },
+  { 0x75u, 0.05140000 },
+  { 0x76u, 0.02220000 },
+  { 0x77u, 0.00120000 },
+  { 0x78u, 0.00030000 },
+  { 0x79u, 0.01710000 },
+  { 0x7Au, 0.00060000 },
+  { 0xE4u, 0.03350000 },
+  { 0xE5u, 0.00000000 },
+  { 0xF6u, 0.00440000 },
+  { 0x161u, 0.00020000 },
+  { 0x17Eu, 0.00000000 },
+};
+
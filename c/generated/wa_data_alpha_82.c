@@ -0,0 +1,141 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_82_UPPER[] = {
+  "A",
+  "Á",
+  "B",
+  "D",
+  "Ð",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "Í",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "Ó",
+  "P",
+  "R",
+  "S",
+  "T",
+  "U",
+  "Ú",
+  "V",
+  "Y",
+  "Ý",
+  "Æ",
+  "Ø",
+};
+const char *ALPHA_82_LOWER[] = {
+  "a",
+  "á",
+  "b",
+  "d",
+  "ð",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "í",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "ó",
+  "p",
+  "r",
+  "s",
+  "t",
+  "u",
+  "ú",
+  "v",
+  "y",
+  "ý",
+  "æ",
+  "ø",
+};
+const char *ALPHA_82_DIGITS[] = {
+};
+const uint32_t ALPHA_82_UPPER_CPS[] = {
+  65, 66, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 82,
+  83, 84, 85, 86, 89, 193, 198, 205, 208, 211, 216, 218, 221,
+};
+const uint32_t ALPHA_82_LOWER_CPS[] = {
+  97, 98, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 114,
+  115, 116, 117, 118, 121, 225, 230, 237, 240, 243, 248, 250, 253,
+};
+const uint32_t ALPHA_82_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_82_FREQ[] = {
+  { "a", 0.09520000 },
+  { "á", 0.01290000 },
+  { "b", 0.01260000 },
+  { "d", 0.02320000 },
+  { "ð", 0.02760000 },
+  { "e", 0.05720000 },
+  { "f", 0.02000000 },
+  { "g", 0.03700000 },
+  { "h", 0.01970000 },
+  { "i", 0.08890000 },
+  { "í", 0.01770000 },
+  { "j", 0.01000000 },
+  { "k", 0.03270000 },
+  { "l", 0.04480000 },
+  { "m", 0.03920000 },
+  { "n", 0.07990000 },
+  { "o", 0.03170000 },
+  { "ó", 0.01040000 },
+  { "p", 0.01020000 },
+  { "r", 0.09220000 },
+  { "s", 0.05450000 },
+  { "t", 0.06110000 },
+  { "u", 0.05300000 },
+  { "ú", 0.00510000 },
+  { "v", 0.03210000 },
+  { "y", 0.01290000 },
+  { "ý", 0.00270000 },
+  { "æ", 0.00420000 },
+  { "ø", 0.01150000 },
+};
+
+const wa_cp_freq ALPHA_82_FREQ_CPS[] = {
+  { 0x61u, 0.09520000 },
+  { 0x62u, 0.01260000 },
+  { 0x64u, 0.02320000 },
+  { 0x65u, 0.05720000 },
+  { 0x66u, 0.02000000 },
+  { 0x67u, 0.03700000 },
+  { 0x68u, 0.01970000 },
+  { 0x69u, 0.08890000 },
+  { 0x6Au, 0.01000000 },
+  { 0x6Bu, 0.03270000 },
+  { 0x6Cu, 0.04480000 },
+  { 0x6Du, 0.03920000 },
+  { 0x6Eu, 0.07990000 },
+  { 0x6Fu, 0.03170000 },
+  { 0x70u, 0.01020000 },
+  { 0x72u, 0.09220000 },
+  { 0x73u, 0.05450000 },
+  { 0x74u, 0.06110000 },
+  { 0x75u, 0.05300000 },
+  { 0x76u, 0.03210000 },
+  { 0x79u, 0.01290000 },
+  { 0xE1u, 0.01290000 },
+  { 0xE6u, 0.00420000 },
+  { 0xEDu, 0.01770000 },
+  { 0xF0u, 0.02760000 },
+  { 0xF3u, 0.01040000 },
+  { 0xF8u, 0.01150000 },
+  { 0xFAu, 0.00510000 },
+  { 0xFDu, 0.00270000 },
+};
+
@@ -0,0 +1,205 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_83_UPPER[] = {
+  "A",
+  "À",
+  "Â",
+  "Æ",
+  "B",
+  "C",
+  "Ç",
+  "D",
+  "E",
+  "É",
+  "È",
+  "Ê",
+  "Ë",
+  "F",
+  "G",
+  "H",
+  "I",
+  "Î",
+  "Ï",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "Ô",
+  "Œ",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "Ù",
+  "Û",
+  "Ü",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Ÿ",
+  "Z",
+};
+const char *ALPHA_83_LOWER[] = {
+  "a",
+  "à",
+  "â",
+  "æ",
+  "b",
+  "c",
+  "ç",
+  "d",
+  "e",
+  "é",
+  "è",
+  "ê",
+  "ë",
+  "f",
+  "g",
+  "h",
+  "i",
+  "î",
+  "ï",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "ô",
+  "œ",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "ù",
+  "û",
+  "ü",
+  "v",
+  "w",
+  "x",
+  "y",
+  "ÿ",
+  "z",
+};
+const char *ALPHA_83_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_83_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 192, 194, 198, 199, 200, 201,
+  202, 203, 206, 207, 212, 217, 219, 220, 338, 376,
+};
+const uint32_t ALPHA_83_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 224, 226, 230, 231, 232, 233,
+  234, 235, 238, 239, 244, 249, 251, 252, 255, 339,
+};
+const uint32_t ALPHA_83_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_83_FREQ[] = {
+  { "a", 0.07790000 },
+  { "à", 0.00450000 },
+  { "â", 0.00050000 },
+  { "æ", 0.00000000 },
+  { "b", 0.00990000 },
+  { "c", 0.03370000 },
+  { "ç", 0.00060000 },
+  { "d", 0.04210000 },
+  { "e", 0.14360000 },
+  { "é", 0.02440000 },
+  { "è", 0.00400000 },
+  { "ê", 0.00110000 },
+  { "ë", 0.00000000 },
+  { "f", 0.01100000 },
+  { "g", 0.01240000 },
+  { "h", 0.00960000 },
+  { "i", 0.07230000 },
+  { "î", 0.00040000 },
+  { "ï", 0.00020000 },
+  { "j", 0.00300000 },
+  { "k", 0.00160000 },
+  { "l", 0.05930000 },
+  { "m", 0.02820000 },
+  { "n", 0.07400000 },
+  { "o", 0.05420000 },
+  { "ô", 0.00050000 },
+  { "œ", 0.00020000 },
+  { "p", 0.02920000 },
+  { "q", 0.00830000 },
+  { "r", 0.06820000 },
+  { "s", 0.07710000 },
+  { "t", 0.06990000 },
+  { "u", 0.05480000 },
+  { "ù", 0.00030000 },
+  { "û", 0.00020000 },
+  { "ü", 0.00000000 },
+  { "v", 0.01270000 },
+  { "w", 0.00090000 },
+  { "x", 0.00420000 },
+  { "y", 0.00380000 },
+  { "ÿ", 0.00000000 },
+  { "z", 0.00110000 },
+};
+
+const wa_cp_freq ALPHA_83_FREQ_CPS[] = {
+  { 0x61u, 0.07790000 },
+  { 0x62u, 0.00990000 },
+  { 0x63u, 0.03370000 },
+  { 0x64u, 0.04210000 },
+  { 0x65u, 0.14360000 },
+  { 0x66u, 0.01100000 },
+  { 0x67u, 0.01240000 },
+  { 0x68u, 0.00960000 },
+  { 0x69u, 0.07230000 },
+  { 0x6Au, 0.00300000 },
+  { 0x6Bu, 0.00160000 },
+  { 0x6Cu, 0.05930000 },
+  { 0x6Du, 0.02820000 },
+  { 0x6Eu, 0.07400000 },
+  { 0x6Fu, 0.05420000 },
+  { 0x70u, 0.02920000 },
+  { 0x71u, 0.00830000 },
+  { 0x72u, 0.06820000 },
+  { 0x73u, 0.07710000 },
+  { 0x74u, 0.06990000 },
+  { 0x75u, 0.05480000 },
+  { 0x76u, 0.01270000 },
+  { 0x77u, 0.00090000 },
+  { 0x78u, 0.00420000 },
+  { 0x79u, 0.00380000 },
+  { 0x7Au, 0.00110000 },
+  { 0xE0u, 0.00450000 },
+  { 0xE2u, 0.00050000 },
+  { 0xE6u, 0.00000000 },
+  { 0xE7u, 0.00060000 },
+  { 0xE8u, 0.00400000 },
+  { 0xE9u, 0.02440000 },
+  { 0xEAu, 0.00110000 },
+  { 0xEBu, 0.00000000 },
+  { 0xEEu, 0.00040000 },
+  { 0xEFu, 0.00020000 },
+  { 0xF4u, 0.00050000 },
+  { 0xF9u, 0.00030000 },
+  { 0xFBu, 0.00020000 },
+  { 0xFCu, 0.00000000 },
+  { 0xFFu, 0.00000000 },
+  { 0x153u, 0.00020000 },
+};
+
@@ -0,0 +1,147 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_84_UPPER[] = {
+  "A",
+  "Å",
+  "Ä",
+  "Ā",
+  "B",
+  "C",
+  "D",
+  "Đ",
+  "E",
+  "Ē",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "Ö",
+  "P",
+  "R",
+  "S",
+  "T",
+  "U",
+  "Ü",
+  "W",
+};
+const char *ALPHA_84_LOWER[] = {
+  "a",
+  "å",
+  "ä",
+  "ā",
+  "b",
+  "c",
+  "d",
+  "đ",
+  "e",
+  "ē",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "ö",
+  "p",
+  "r",
+  "s",
+  "t",
+  "u",
+  "ü",
+  "w",
+};
+const char *ALPHA_84_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_84_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  82, 83, 84, 85, 87, 196, 197, 214, 220, 256, 272, 274,
+};
+const uint32_t ALPHA_84_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  114, 115, 116, 117, 119, 228, 229, 246, 252, 257, 273, 275,
+};
+const uint32_t ALPHA_84_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_84_FREQ[] = {
+  { "a", 0.09820000 },
+  { "å", 0.00930000 },
+  { "ä", 0.01520000 },
+  { "ā", 0.00020000 },
+  { "b", 0.01610000 },
+  { "c", 0.01370000 },
+  { "d", 0.04020000 },
+  { "đ", 0.00040000 },
+  { "e", 0.11260000 },
+  { "ē", 0.00020000 },
+  { "f", 0.02520000 },
+  { "g", 0.02010000 },
+  { "h", 0.02540000 },
+  { "i", 0.07180000 },
+  { "j", 0.01830000 },
+  { "k", 0.02870000 },
+  { "l", 0.03860000 },
+  { "m", 0.02670000 },
+  { "n", 0.09390000 },
+  { "o", 0.04300000 },
+  { "ö", 0.01580000 },
+  { "p", 0.01260000 },
+  { "r", 0.06800000 },
+  { "s", 0.06220000 },
+  { "t", 0.06810000 },
+  { "u", 0.04380000 },
+  { "ü", 0.01450000 },
+  { "w", 0.01740000 },
+};
+
+const wa_cp_freq ALPHA_84_FREQ_CPS[] = {
+  { 0x61u, 0.09820000 },
+  { 0x62u, 0.01610000 },
+  { 0x63u, 0.01370000 },
+  { 0x64u, 0.04020000 },
+  { 0x65u, 0.11260000 },
+  { 0x66u, 0.02520000 },
+  { 0x67u, 0.02010000 },
+  { 0x68u, 0.02540000 },
+  { 0x69u, 0.07180000 },
+  { 0x6Au, 0.01830000 },
+  { 0x6Bu, 0.02870000 },
+  { 0x6Cu, 0.03860000 },
+  { 0x6Du, 0.02670000 },
+  { 0x6Eu, 0.09390000 },
+  { 0x6Fu, 0.04300000 },
+  { 0x70u, 0.01260000 },
+  { 0x72u, 0.06800000 },
+  { 0x73u, 0.06220000 },
+  { 0x74u, 0.06810000 },
+  { 0x75u, 0.04380000 },
+  { 0x77u, 0.01740000 },
+  { 0xE4u, 0.01520000 },
+  { 0xE5u, 0.00930000 },
+  { 0xF6u, 0.01580000 },
+  { 0xFCu, 0.01450000 },
+  { 0x101u, 0.00020000 },
+  { 0x111u, 0.00040000 },
+  { 0x113u, 0.00020000 },
+};
+
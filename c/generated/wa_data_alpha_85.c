@@ -0,0 +1,185 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_85_UPPER[] = {
+  "A",
+  "À",
+  "Â",
+  "B",
+  "C",
+  "Ç",
+  "D",
+  "E",
+  "È",
+  "Ê",
+  "F",
+  "G",
+  "H",
+  "I",
+  "Ì",
+  "Î",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "Ò",
+  "Ô",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "Ù",
+  "Û",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+};
+const char *ALPHA_85_LOWER[] = {
+  "a",
+  "à",
+  "â",
+  "b",
+  "c",
+  "ç",
+  "d",
+  "e",
+  "è",
+  "ê",
+  "f",
+  "g",
+  "h",
+  "i",
+  "ì",
+  "î",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "ò",
+  "ô",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "ù",
+  "û",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+};
+const char *ALPHA_85_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_85_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 192, 194, 199, 200, 202, 204,
+  206, 210, 212, 217, 219,
+};
+const uint32_t ALPHA_85_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 224, 226, 231, 232, 234, 236,
+  238, 242, 244, 249, 251,
+};
+const uint32_t ALPHA_85_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_85_FREQ[] = {
+  { "a", 0.09660000 },
+  { "à", 0.00250000 },
+  { "â", 0.01320000 },
+  { "b", 0.00860000 },
+  { "c", 0.04730000 },
+  { "ç", 0.00170000 },
+  { "d", 0.04970000 },
+  { "e", 0.10620000 },
+  { "è", 0.00360000 },
+  { "ê", 0.00220000 },
+  { "f", 0.01290000 },
+  { "g", 0.01410000 },
+  { "h", 0.01260000 },
+  { "i", 0.11480000 },
+  { "ì", 0.00090000 },
+  { "î", 0.00250000 },
+  { "j", 0.01220000 },
+  { "k", 0.00100000 },
+  { "l", 0.06380000 },
+  { "m", 0.02560000 },
+  { "n", 0.07360000 },
+  { "o", 0.04810000 },
+  { "ò", 0.00060000 },
+  { "ô", 0.00340000 },
+  { "p", 0.02820000 },
+  { "q", 0.00030000 },
+  { "r", 0.05870000 },
+  { "s", 0.06890000 },
+  { "t", 0.06290000 },
+  { "u", 0.03560000 },
+  { "ù", 0.00020000 },
+  { "û", 0.00280000 },
+  { "v", 0.01590000 },
+  { "w", 0.00050000 },
+  { "x", 0.00050000 },
+  { "y", 0.00040000 },
+  { "z", 0.00710000 },
+};
+
+const wa_cp_freq ALPHA_85_FREQ_CPS[] = {
+  { 0x61u, 0.09660000 },
+  { 0x62u, 0.00860000 },
+  { 0x63u, 0.04730000 },
+  { 0x64u, 0.04970000 },
+  { 0x65u, 0.10620000 },
+  { 0x66u, 0.01290000 },
+  { 0x67u, 0.01410000 },
+  { 0x68u, 0.01260000 },
+  { 0x69u, 0.11480000 },
+  { 0x6Au, 0.01220000 },
+  { 0x6Bu, 0.00100000 },
+  { 0x6Cu, 0.06380000 },
+  { 0x6Du, 0.02560000 },
+  { 0x6Eu, 0.07360000 },
+  { 0x6Fu, 0.04810000 },
+  { 0x70u, 0.02820000 },
+  { 0x71u, 0.00030000 },
+  { 0x72u, 0.05870000 },
+  { 0x73u, 0.06890000 },
+  { 0x74u, 0.06290000 },
+  { 0x75u, 0.03560000 },
+  { 0x76u, 0.01590000 },
+  { 0x77u, 0.00050000 },
+  { 0x78u, 0.00050000 },
+  { 0x79u, 0.00040000 },
+  { 0x7Au, 0.00710000 },
+  { 0xE0u, 0.00250000 },
+  { 0xE2u, 0.01320000 },
+  { 0xE7u, 0.00170000 },
+  { 0xE8u, 0.00360000 },
+  { 0xEAu, 0.00220000 },
+  { 0xECu, 0.00090000 },
+  { 0xEEu, 0.00250000 },
+  { 0xF2u, 0.00060000 },
+  { 0xF4u, 0.00340000 },
+  { 0xF9u, 0.00020000 },
+  { 0xFBu, 0.00280000 },
+};
+
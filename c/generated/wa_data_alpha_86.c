@@ -0,0 +1,191 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_86_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "W",
+  "Z",
+  "Y",
+  "À",
+  "Á",
+  "Â",
+  "Ä",
+  "È",
+  "É",
+  "Ê",
+  "Ë",
+  "Í",
+  "Ï",
+  "Ó",
+  "Ô",
+  "Ö",
+  "Ú",
+  "Û",
+  "Ü",
+  "Ý",
+};
+const char *ALPHA_86_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "w",
+  "z",
+  "y",
+  "à",
+  "á",
+  "â",
+  "ä",
+  "è",
+  "é",
+  "ê",
+  "ë",
+  "í",
+  "ï",
+  "ó",
+  "ô",
+  "ö",
+  "ú",
+  "û",
+  "ü",
+  "ý",
+};
+const char *ALPHA_86_DIGITS[] = {
+};
+const uint32_t ALPHA_86_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  82, 83, 84, 85, 86, 87, 89, 90, 192, 193, 194, 196, 200, 201, 202, 203,
+  205, 207, 211, 212, 214, 218, 219, 220, 221,
+};
+const uint32_t ALPHA_86_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  114, 115, 116, 117, 118, 119, 121, 122, 224, 225, 226, 228, 232, 233, 234, 235,
+  237, 239, 243, 244, 246, 250, 251, 252, 253,
+};
+const uint32_t ALPHA_86_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_86_FREQ[] = {
+  { "a", 0.07790000 },
+  { "b", 0.01650000 },
+  { "c", 0.00940000 },
+  { "d", 0.05150000 },
+  { "e", 0.15800000 },
+  { "f", 0.02680000 },
+  { "g", 0.01860000 },
+  { "h", 0.01970000 },
+  { "i", 0.07310000 },
+  { "j", 0.01420000 },
+  { "k", 0.03330000 },
+  { "l", 0.03750000 },
+  { "m", 0.02580000 },
+  { "n", 0.09810000 },
+  { "o", 0.04500000 },
+  { "p", 0.01540000 },
+  { "r", 0.07130000 },
+  { "s", 0.05880000 },
+  { "t", 0.06860000 },
+  { "u", 0.01810000 },
+  { "v", 0.00360000 },
+  { "w", 0.01770000 },
+  { "z", 0.00360000 },
+  { "y", 0.02210000 },
+  { "à", 0.00000000 },
+  { "á", 0.00000000 },
+  { "â", 0.00390000 },
+  { "ä", 0.00000000 },
+  { "è", 0.00000000 },
+  { "é", 0.00010000 },
+  { "ê", 0.00300000 },
+  { "ë", 0.00010000 },
+  { "í", 0.00000000 },
+  { "ï", 0.00010000 },
+  { "ó", 0.00000000 },
+  { "ô", 0.00100000 },
+  { "ö", 0.00010000 },
+  { "ú", 0.00250000 },
+  { "û", 0.00430000 },
+  { "ü", 0.00010000 },
+  { "ý", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_86_FREQ_CPS[] = {
+  { 0x61u, 0.07790000 },
+  { 0x62u, 0.01650000 },
+  { 0x63u, 0.00940000 },
+  { 0x64u, 0.05150000 },
+  { 0x65u, 0.15800000 },
+  { 0x66u, 0.02680000 },
+  { 0x67u, 0.01860000 },
+  { 0x68u, 0.01970000 },
+  { 0x69u, 0.07310000 },
+  { 0x6Au, 0.01420000 },
+  { 0x6Bu, 0.03330000 },
+  { 0x6Cu, 0.03750000 },
+  { 0x6Du, 0.02580000 },
+  { 0x6Eu, 0.09810000 },
+  { 0x6Fu, 0.04500000 },
+  { 0x70u, 0.01540000 },
+  { 0x72u, 0.07130000 },
+  { 0x73u, 0.05880000 },
+  { 0x74u, 0.06860000 },
+  { 0x75u, 0.01810000 },
+  { 0x76u, 0.00360000 },
+  { 0x77u, 0.01770000 },
+  { 0x79u, 0.02210000 },
+  { 0x7Au, 0.00360000 },
+  { 0xE0u, 0.00000000 },
+  { 0xE1u, 0.00000000 },
+  { 0xE2u, 0.00390000 },
+  { 0xE4u, 0.00000000 },
+  { 0xE8u, 0.00000000 },
+  { 0xE9u, 0.00010000 },
+  { 0xEAu, 0.00300000 },
+  { 0xEBu, 0.00010000 },
+  { 0xEDu, 0.00000000 },
+  { 0xEFu, 0.00010000 },
+  { 0xF3u, 0.00000000 },
+  { 0xF4u, 0.00100000 },
+  { 0xF6u, 0.00010000 },
+  { 0xFAu, 0.00250000 },
+  { 0xFBu, 0.00430000 },
+  { 0xFCu, 0.00010000 },
+  { 0xFDu, 0.00000000 },
+};
+
@@ -0,0 +1,117 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_87_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "R",
+  "S",
+  "T",
+  "U",
+  "Á",
+  "É",
+  "Í",
+  "Ó",
+  "Ú",
+};
+const char *ALPHA_87_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "r",
+  "s",
+  "t",
+  "u",
+  "á",
+  "é",
+  "í",
+  "ó",
+  "ú",
+};
+const char *ALPHA_87_DIGITS[] = {
+};
+const uint32_t ALPHA_87_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 76, 77, 78, 79, 80, 82, 83,
+  84, 85, 193, 201, 205, 211, 218,
+};
+const uint32_t ALPHA_87_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 108, 109, 110, 111, 112, 114, 115,
+  116, 117, 225, 233, 237, 243, 250,
+};
+const uint32_t ALPHA_87_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_87_FREQ[] = {
+  { "a", 0.16120000 },
+  { "b", 0.02270000 },
+  { "c", 0.04490000 },
+  { "d", 0.03300000 },
+  { "e", 0.05540000 },
+  { "f", 0.01150000 },
+  { "g", 0.03300000 },
+  { "h", 0.07790000 },
+  { "i", 0.10300000 },
+  { "l", 0.04250000 },
+  { "m", 0.02470000 },
+  { "n", 0.08440000 },
+  { "o", 0.03850000 },
+  { "p", 0.00760000 },
+  { "r", 0.06190000 },
+  { "s", 0.05380000 },
+  { "t", 0.04790000 },
+  { "u", 0.02460000 },
+  { "á", 0.01850000 },
+  { "é", 0.01540000 },
+  { "í", 0.01900000 },
+  { "ó", 0.00970000 },
+  { "ú", 0.00880000 },
+};
+
+const wa_cp_freq ALPHA_87_FREQ_CPS[] = {
+  { 0x61u, 0.16120000 },
+  { 0x62u, 0.02270000 },
+  { 0x63u, 0.04490000 },
+  { 0x64u, 0.03300000 },
+  { 0x65u, 0.05540000 },
+  { 0x66u, 0.01150000 },
+  { 0x67u, 0.03300000 },
+  { 0x68u, 0.07790000 },
+  { 0x69u, 0.10300000 },
+  { 0x6Cu, 0.04250000 },
+  { 0x6Du, 0.02470000 },
+  { 0x6Eu, 0.08440000 },
+  { 0x6Fu, 0.03850000 },
+  { 0x70u, 0.00760000 },
+  { 0x72u, 0.06190000 },
+  { 0x73u, 0.05380000 },
+  { 0x74u, 0.04790000 },
+  { 0x75u, 0.02460000 },
+  { 0xE1u, 0.01850000 },
+  { 0xE9u, 0.01540000 },
+  { 0xEDu, 0.01900000 },
+  { 0xF3u, 0.00970000 },
+  { 0xFAu, 0.00880000 },
+};
+
@@ -0,0 +1,117 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_89_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "R",
+  "S",
+  "T",
+  "U",
+  "À",
+  "È",
+  "Ì",
+  "Ò",
+  "Ù",
+};
+const char *ALPHA_89_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "r",
+  "s",
+  "t",
+  "u",
+  "à",
+  "è",
+  "ì",
+  "ò",
+  "ù",
+};
+const char *ALPHA_89_DIGITS[] = {
+};
+const uint32_t ALPHA_89_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 76, 77, 78, 79, 80, 82, 83,
+  84, 85, 192, 200, 204, 210, 217,
+};
+const uint32_t ALPHA_89_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 108, 109, 110, 111, 112, 114, 115,
+  116, 117, 224, 232, 236, 242, 249,
+};
+const uint32_t ALPHA_89_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_89_FREQ[] = {
+  { "a", 0.19030000 },
+  { "b", 0.02480000 },
+  { "c", 0.04500000 },
+  { "d", 0.04400000 },
+  { "e", 0.06760000 },
+  { "f", 0.00930000 },
+  { "g", 0.03100000 },
+  { "h", 0.09490000 },
+  { "i", 0.09120000 },
+  { "l", 0.03940000 },
+  { "m", 0.02590000 },
+  { "n", 0.09840000 },
+  { "o", 0.03450000 },
+  { "p", 0.00650000 },
+  { "r", 0.05610000 },
+  { "s", 0.04830000 },
+  { "t", 0.04080000 },
+  { "u", 0.02830000 },
+  { "à", 0.00900000 },
+  { "è", 0.00300000 },
+  { "ì", 0.00400000 },
+  { "ò", 0.00450000 },
+  { "ù", 0.00320000 },
+};
+
+const wa_cp_freq ALPHA_89_FREQ_CPS[] = {
+  { 0x61u, 0.19030000 },
+  { 0x62u, 0.02480000 },
+  { 0x63u, 0.04500000 },
+  { 0x64u, 0.04400000 },
+  { 0x65u, 0.06760000 },
+  { 0x66u, 0.00930000 },
+  { 0x67u, 0.03100000 },
+  { 0x68u, 0.09490000 },
+  { 0x69u, 0.09120000 },
+  { 0x6Cu, 0.03940000 },
+  { 0x6Du, 0.02590000 },
+  { 0x6Eu, 0.09840000 },
+  { 0x6Fu, 0.03450000 },
+  { 0x70u, 0.00650000 },
+  { 0x72u, 0.05610000 },
+  { 0x73u, 0.04830000 },
+  { 0x74u, 0.04080000 },
+  { 0x75u, 0.02830000 },
+  { 0xE0u, 0.00900000 },
+  { 0xE8u, 0.00300000 },
+  { 0xECu, 0.00400000 },
+  { 0xF2u, 0.00450000 },
+  { 0xF9u, 0.00320000 },
+};
+
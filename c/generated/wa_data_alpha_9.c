@@ -0,0 +1,135 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_9_UPPER[] = {
+  "A",
+  "C",
+  "H",
+  "D",
+  "E",
+  "F",
+  "G",
+  "I",
+  "K",
+  "L",
+  "Ḻ",
+  "M",
+  "N",
+  "Ñ",
+  "Ṉ",
+  "O",
+  "P",
+  "R",
+  "S",
+  "T",
+  "Ṯ",
+  "U",
+  "Ü",
+  "W",
+  "Y",
+};
+const char *ALPHA_9_LOWER[] = {
+  "a",
+  "c",
+  "h",
+  "d",
+  "e",
+  "f",
+  "g",
+  "i",
+  "k",
+  "l",
+  "ḻ",
+  "m",
+  "n",
+  "ñ",
+  "ṉ",
+  "o",
+  "p",
+  "r",
+  "s",
+  "t",
+  "ṯ",
+  "u",
+  "ü",
+  "w",
+  "y",
+};
+const char *ALPHA_9_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_9_UPPER_CPS[] = {
+  65, 67, 68, 69, 70, 71, 72, 73, 75, 76, 77, 78, 79, 80, 82, 83,
+  84, 85, 87, 89, 209, 220, 7738, 7752, 7790,
+};
+const uint32_t ALPHA_9_LOWER_CPS[] = {
+  97, 99, 100, 101, 102, 103, 104, 105, 107, 108, 109, 110, 111, 112, 114, 115,
+  116, 117, 119, 121, 241, 252, 7739, 7753, 7791,
+};
+const uint32_t ALPHA_9_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_9_FREQ[] = {
+  { "a", 0.00000000 },
+  { "c", 0.00000000 },
+  { "h", 0.00000000 },
+  { "d", 0.00000000 },
+  { "e", 0.00000000 },
+  { "f", 0.00000000 },
+  { "g", 0.00000000 },
+  { "i", 0.00000000 },
+  { "k", 0.00000000 },
+  { "l", 0.00000000 },
+  { "ḻ", 0.00000000 },
+  { "m", 0.00000000 },
+  { "n", 0.00000000 },
+  { "ñ", 0.00000000 },
+  { "ṉ", 0.00000000 },
+  { "o", 0.00000000 },
+  { "p", 0.00000000 },
+  { "r", 0.00000000 },
+  { "s", 0.00000000 },
+  { "t", 0.00000000 },
+  { "ṯ", 0.00000000 },
+  { "u", 0.00000000 },
+  { "ü", 0.00000000 },
+  { "w", 0.00000000 },
+  { "y", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_9_FREQ_CPS[] = {
+  { 0x61u, 0.00000000 },
+  { 0x63u, 0.00000000 },
+  { 0x64u, 0.00000000 },
+  { 0x65u, 0.00000000 },
+  { 0x66u, 0.00000000 },
+  { 0x67u, 0.00000000 },
+  { 0x68u, 0.00000000 },
+  { 0x69u, 0.00000000 },
+  { 0x6Bu, 0.00000000 },
+  { 0x6Cu, 0.00000000 },
+  { 0x6Du, 0.00000000 },
+  { 0x6Eu, 0.00000000 },
+  { 0x6Fu, 0.00000000 },
+  { 0x70u, 0.00000000 },
+  { 0x72u, 0.00000000 },
+  { 0x73u, 0.00000000 },
+  { 0x74u, 0.00000000 },
+  { 0x75u, 0.00000000 },
+  { 0x77u, 0.00000000 },
+  { 0x79u, 0.00000000 },
+  { 0xF1u, 0.00000000 },
+  { 0xFCu, 0.00000000 },
+  { 0x1E3Bu, 0.00000000 },
+  { 0x1E49u, 0.00000000 },
+  { 0x1E6Fu, 0.00000000 },
+};
+
@@ -0,0 +1,865 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_90_UPPER[] = {
+  "ሀ",
+  "ሁ",
+  "ሂ",
+  "ሃ",
+  "ሄ",
+  "ህ",
+  "ሆ",
+  "ለ",
+  "ሉ",
+  "ሊ",
+  "ላ",
+  "ሌ",
+  "ል",
+  "ሎ",
+  "ሐ",
+  "ሑ",
+  "ሒ",
+  "ሓ",
+  "ሔ",
+  "ሕ",
+  "ሖ",
+  "መ",
+  "ሙ",
+  "ሚ",
+  "ማ",
+  "ሜ",
+  "ም",
+  "ሞ",
+  "ሠ",
+  "ሡ",
+  "ሢ",
+  "ሣ",
+  "ሤ",
+  "ሥ",
+  "ሦ",
+  "ረ",
+  "ሩ",
+  "ሪ",
+  "ራ",
+  "ሬ",
+  "ር",
+  "ሮ",
+  "ሰ",
+  "ሱ",
+  "ሲ",
+  "ሳ",
+  "ሴ",
+  "ስ",
+  "ሶ",
+  "ቀ",
+  "ቁ",
+  "ቂ",
+  "ቃ",
+  "ቄ",
+  "ቅ",
+  "ቆ",
+  "ቈ",
+  "ቊ",
+  "ቋ",
+  "ቌ",
+  "ቍ",
+  "በ",
+  "ቡ",
+  "ቢ",
+  "ባ",
+  "ቤ",
+  "ብ",
+  "ቦ",
+  "ተ",
+  "ቱ",
+  "ቲ",
+  "ታ",
+  "ቴ",
+  "ት",
+  "ቶ",
+  "ኀ",
+  "ኁ",
+  "ኂ",
+  "ኃ",
+  "ኄ",
+  "ኅ",
+  "ኆ",
+  "ኈ",
+  "ኊ",
+  "ኋ",
+  "ኌ",
+  "ኍ",
+  "ነ",
+  "ኑ",
+  "ኒ",
+  "ና",
+  "ኔ",
+  "ን",
+  "ኖ",
+  "አ",
+  "ኡ",
+  "ኢ",
+  "ኣ",
+  "ኤ",
+  "እ",
+  "ኦ",
+  "ከ",
+  "ኩ",
+  "ኪ",
+  "ካ",
+  "ኬ",
+  "ክ",
+  "ኮ",
+  "ኰ",
+  "ኲ",
+  "ኳ",
+  "ኴ",
+  "ኵ",
+  "ወ",
+  "ዉ",
+  "ዊ",
+  "ዋ",
+  "ዌ",
+  "ው",
+  "ዎ",
+  "ዐ",
+  "ዑ",
+  "ዒ",
+  "ዓ",
+  "ዔ",
+  "ዕ",
+  "ዖ",
+  "ዘ",
+  "ዙ",
+  "ዚ",
+  "ዛ",
+  "ዜ",
+  "ዝ",
+  "ዞ",
+  "የ",
+  "ዩ",
+  "ዪ",
+  "ያ",
+  "ዬ",
+  "ይ",
+  "ዮ",
+  "ደ",
+  "ዱ",
+  "ዲ",
+  "ዳ",
+  "ዴ",
+  "ድ",
+  "ዶ",
+  "ገ",
+  "ጉ",
+  "ጊ",
+  "ጋ",
+  "ጌ",
+  "ግ",
+  "ጎ",
+  "ጐ",
+  "ጒ",
+  "ጓ",
+  "ጔ",
+  "ጕ",
+  "ጠ",
+  "ጡ",
+  "ጢ",
+  "ጣ",
+  "ጤ",
+  "ጥ",
+  "ጦ",
+  "ጰ",
+  "ጱ",
+  "ጲ",
+  "ጳ",
+  "ጴ",
+  "ጵ",
+  "ጶ",
+  "ጸ",
+  "ጹ",
+  "ጺ",
+  "ጻ",
+  "ጼ",
+  "ጽ",
+  "ጾ",
+  "ፀ",
+  "ፁ",
+  "ፂ",
+  "ፃ",
+  "ፄ",
+  "ፅ",
+  "ፆ",
+  "ፈ",
+  "ፉ",
+  "ፊ",
+  "ፋ",
+  "ፌ",
+  "ፍ",
+  "ፎ",
+  "ፐ",
+  "ፑ",
+  "ፒ",
+  "ፓ",
+  "ፔ",
+  "ፕ",
+  "ፖ",
+};
+const char *ALPHA_90_LOWER[] = {
+  "ሀ",
+  "ሁ",
+  "ሂ",
+  "ሃ",
+  "ሄ",
+  "ህ",
+  "ሆ",
+  "ለ",
+  "ሉ",
+  "ሊ",
+  "ላ",
+  "ሌ",
+  "ል",
+  "ሎ",
+  "ሐ",
+  "ሑ",
+  "ሒ",
+  "ሓ",
+  "ሔ",
+  "ሕ",
+  "ሖ",
+  "መ",
+  "ሙ",
+  "ሚ",
+  "ማ",
+  "ሜ",
+  "ም",
+  "ሞ",
+  "ሠ",
+  "ሡ",
+  "ሢ",
+  "ሣ",
+  "ሤ",
+  "ሥ",
+  "ሦ",
+  "ረ",
+  "ሩ",
+  "ሪ",
+  "ራ",
+  "ሬ",
+  "ር",
+  "ሮ",
+  "ሰ",
+  "ሱ",
+  "ሲ",
+  "ሳ",
+  "ሴ",
+  "ስ",
+  "ሶ",
+  "ቀ",
+  "ቁ",
+  "ቂ",
+  "ቃ",
+  "ቄ",
+  "ቅ",
+  "ቆ",
+  "ቈ",
+  "ቊ",
+  "ቋ",
+  "ቌ",
+  "ቍ",
+  "በ",
+  "ቡ",
+  "ቢ",
+  "ባ",
+  "ቤ",
+  "ብ",
+  "ቦ",
+  "ተ",
+  "ቱ",
+  "ቲ",
+  "ታ",
+  "ቴ",
+  "ት",
+  "ቶ",
+  "ኀ",
+  "ኁ",
+  "ኂ",
+  "ኃ",
+  "ኄ",
+  "ኅ",
+  "ኆ",
+  "ኈ",
+  "ኊ",
+  "ኋ",
+  "ኌ",
+  "ኍ",
+  "ነ",
+  "ኑ",
+  "ኒ",
+  "ና",
+  "ኔ",
+  "ን",
+  "ኖ",
+  "አ",
+  "ኡ",
+  "ኢ",
+  "ኣ",
+  "ኤ",
+  "እ",
+  "ኦ",
+  "ከ",
+  "ኩ",
+  "ኪ",
+  "ካ",
+  "ኬ",
+  "ክ",
+  "ኮ",
+  "ኰ",
+  "ኲ",
+  "ኳ",
+  "ኴ",
+  "ኵ",
+  "ወ",
+  "ዉ",
+  "ዊ",
+  "ዋ",
+  "ዌ",
+  "ው",
+  "ዎ",
+  "ዐ",
+  "ዑ",
+  "ዒ",
+  "ዓ",
+  "ዔ",
+  "ዕ",
+  "ዖ",
+  "ዘ",
+  "ዙ",
+  "ዚ",
+  "ዛ",
+  "ዜ",
+  "ዝ",
+  "ዞ",
+  "የ",
+  "ዩ",
+  "ዪ",
+  "ያ",
+  "ዬ",
+  "ይ",
+  "ዮ",
+  "ደ",
+  "ዱ",
+  "ዲ",
+  "ዳ",
+  "ዴ",
+  "ድ",
+  "ዶ",
+  "ገ",
+  "ጉ",
+  "ጊ",
+  "ጋ",
+  "ጌ",
+  "ግ",
+  "ጎ",
+  "ጐ",
+  "ጒ",
+  "ጓ",
+  "ጔ",
+  "ጕ",
+  "ጠ",
+  "ጡ",
+  "ጢ",
+  "ጣ",
+  "ጤ",
+  "ጥ",
+  "ጦ",
+  "ጰ",
+  "ጱ",
+  "ጲ",
+  "ጳ",
+  "ጴ",
+  "ጵ",
+  "ጶ",
+  "ጸ",
+  "ጹ",
+  "ጺ",
+  "ጻ",
+  "ጼ",
+  "ጽ",
+  "ጾ",
+  "ፀ",
+  "ፁ",
+  "ፂ",
+  "ፃ",
+  "ፄ",
+  "ፅ",
+  "ፆ",
+  "ፈ",
+  "ፉ",
+  "ፊ",
+  "ፋ",
+  "ፌ",
+  "ፍ",
+  "ፎ",
+  "ፐ",
+  "ፑ",
+  "ፒ",
+  "ፓ",
+  "ፔ",
+  "ፕ",
+  "ፖ",
+};
+const char *ALPHA_90_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_90_UPPER_CPS[] = {
+  4608, 4609, 4610, 4611, 4612, 4613, 4614, 4616, 4617, 4618, 4619, 4620, 4621, 4622, 4624, 4625,
+  4626, 4627, 4628, 4629, 4630, 4632, 4633, 4634, 4635, 4636, 4637, 4638, 4640, 4641, 4642, 4643,
+  4644, 4645, 4646, 4648, 4649, 4650, 4651, 4652, 4653, 4654, 4656, 4657, 4658, 4659, 4660, 4661,
+  4662, 4672, 4673, 4674, 4675, 4676, 4677, 4678, 4680, 4682, 4683, 4684, 4685, 4704, 4705, 4706,
+  4707, 4708, 4709, 4710, 4720, 4721, 4722, 4723, 4724, 4725, 4726, 4736, 4737, 4738, 4739, 4740,
+  4741, 4742, 4744, 4746, 4747, 4748, 4749, 4752, 4753, 4754, 4755, 4756, 4757, 4758, 4768, 4769,
+  4770, 4771, 4772, 4773, 4774, 4776, 4777, 4778, 4779, 4780, 4781, 4782, 4784, 4786, 4787, 4788,
+  4789, 4808, 4809, 4810, 4811, 4812, 4813, 4814, 4816, 4817, 4818, 4819, 4820, 4821, 4822, 4824,
+  4825, 4826, 4827, 4828, 4829, 4830, 4840, 4841, 4842, 4843, 4844, 4845, 4846, 4848, 4849, 4850,
+  4851, 4852, 4853, 4854, 4872, 4873, 4874, 4875, 4876, 4877, 4878, 4880, 4882, 4883, 4884, 4885,
+  4896, 4897, 4898, 4899, 4900, 4901, 4902, 4912, 4913, 4914, 4915, 4916, 4917, 4918, 4920, 4921,
+  4922, 4923, 4924, 4925, 4926, 4928, 4929, 4930, 4931, 4932, 4933, 4934, 4936, 4937, 4938, 4939,
+  4940, 4941, 4942, 4944, 4945, 4946, 4947, 4948, 4949, 4950,
+};
+const uint32_t ALPHA_90_LOWER_CPS[] = {
+  4608, 4609, 4610, 4611, 4612, 4613, 4614, 4616, 4617, 4618, 4619, 4620, 4621, 4622, 4624, 4625,
+  4626, 4627, 4628, 4629, 4630, 4632, 4633, 4634, 4635, 4636, 4637, 4638, 4640, 4641, 4642, 4643,
+  4644, 4645, 4646, 4648, 4649, 4650, 4651, 4652, 4653, 4654, 4656, 4657, 4658, 4659, 4660, 4661,
+  4662, 4672, 4673, 4674, 4675, 4676, 4677, 4678, 4680, 4682, 4683, 4684, 4685, 4704, 4705, 4706,
+  4707, 4708, 4709, 4710, 4720, 4721, 4722, 4723, 4724, 4725, 4726, 4736, 4737, 4738, 4739, 4740,
+  4741, 4742, 4744, 4746, 4747, 4748, 4749, 4752, 4753, 4754, 4755, 4756, 4757, 4758, 4768, 4769,
+  4770, 4771, 4772, 4773, 4774, 4776, 4777, 4778, 4779, 4780, 4781, 4782, 4784, 4786, 4787, 4788,
+  4789, 4808, 4809, 4810, 4811, 4812, 4813, 4814, 4816, 4817, 4818, 4819, 4820, 4821, 4822, 4824,
+  4825, 4826, 4827, 4828, 4829, 4830, 4840, 4841, 4842, 4843, 4844, 4845, 4846, 4848, 4849, 4850,
+  4851, 4852, 4853, 4854, 4872, 4873, 4874, 4875, 4876, 4877, 4878, 4880, 4882, 4883, 4884, 4885,
+  4896, 4897, 4898, 4899, 4900, 4901, 4902, 4912, 4913, 4914, 4915, 4916, 4917, 4918, 4920, 4921,
+  4922, 4923, 4924, 4925, 4926, 4928, 4929, 4930, 4931, 4932, 4933, 4934, 4936, 4937, 4938, 4939,
+  4940, 4941, 4942, 4944, 4945, 4946, 4947, 4948, 4949, 4950,
+};
+const uint32_t ALPHA_90_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_90_FREQ[] = {
+  { "ሀ", 0.00000000 },
+  { "ሁ", 0.00000000 },
+  { "ሂ", 0.00000000 },
+  { "ሃ", 0.00000000 },
+  { "ሄ", 0.00000000 },
+  { "ህ", 0.00000000 },
+  { "ሆ", 0.00000000 },
+  { "ለ", 0.00000000 },
+  { "ሉ", 0.00000000 },
+  { "ሊ", 0.00000000 },
+  { "ላ", 0.00000000 },
+  { "ሌ", 0.00000000 },
+  { "ል", 0.00000000 },
+  { "ሎ", 0.00000000 },
+  { "ሐ", 0.00000000 },
+  { "ሑ", 0.00000000 },
+  { "ሒ", 0.00000000 },
+  { "ሓ", 0.00000000 },
+  { "ሔ", 0.00000000 },
+  { "ሕ", 0.00000000 },
+  { "ሖ", 0.00000000 },
+  { "መ", 0.00000000 },
+  { "ሙ", 0.00000000 },
+  { "ሚ", 0.00000000 },
+  { "ማ", 0.00000000 },
+  { "ሜ", 0.00000000 },
+  { "ም", 0.00000000 },
+  { "ሞ", 0.00000000 },
+  { "ሠ", 0.00000000 },
+  { "ሡ", 0.00000000 },
+  { "ሢ", 0.00000000 },
+  { "ሣ", 0.00000000 },
+  { "ሤ", 0.00000000 },
+  { "ሥ", 0.00000000 },
+  { "ሦ", 0.00000000 },
+  { "ረ", 0.00000000 },
+  { "ሩ", 0.00000000 },
+  { "ሪ", 0.00000000 },
+  { "ራ", 0.00000000 },
+  { "ሬ", 0.00000000 },
+  { "ር", 0.00000000 },
+  { "ሮ", 0.00000000 },
+  { "ሰ", 0.00000000 },
+  { "ሱ", 0.00000000 },
+  { "ሲ", 0.00000000 },
+  { "ሳ", 0.00000000 },
+  { "ሴ", 0.00000000 },
+  { "ስ", 0.00000000 },
+  { "ሶ", 0.00000000 },
+  { "ቀ", 0.00000000 },
+  { "ቁ", 0.00000000 },
+  { "ቂ", 0.00000000 },
+  { "ቃ", 0.00000000 },
+  { "ቄ", 0.00000000 },
+  { "ቅ", 0.00000000 },
+  { "ቆ", 0.00000000 },
+  { "ቈ", 0.00000000 },
+  { "ቊ", 0.00000000 },
+  { "ቋ", 0.00000000 },
+  { "ቌ", 0.00000000 },
+  { "ቍ", 0.00000000 },
+  { "በ", 0.00000000 },
+  { "ቡ", 0.00000000 },
+  { "ቢ", 0.00000000 },
+  { "ባ", 0.00000000 },
+  { "ቤ", 0.00000000 },
+  { "ብ", 0.00000000 },
+  { "ቦ", 0.00000000 },
+  { "ተ", 0.00000000 },
+  { "ቱ", 0.00000000 },
+  { "ቲ", 0.00000000 },
+  { "ታ", 0.00000000 },
+  { "ቴ", 0.00000000 },
+  { "ት", 0.00000000 },
+  { "ቶ", 0.00000000 },
+  { "ኀ", 0.00000000 },
+  { "ኁ", 0.00000000 },
+  { "ኂ", 0.00000000 },
+  { "ኃ", 0.00000000 },
+  { "ኄ", 0.00000000 },
+  { "ኅ", 0.00000000 },
+  { "ኆ", 0.00000000 },
+  { "ኈ", 0.00000000 },
+  { "ኊ", 0.00000000 },
+  { "ኋ", 0.00000000 },
+  { "ኌ", 0.00000000 },
+  { "ኍ", 0.00000000 },
+  { "ነ", 0.00000000 },
+  { "ኑ", 0.00000000 },
+  { "ኒ", 0.00000000 },
+  { "ና", 0.00000000 },
+  { "ኔ", 0.00000000 },
+  { "ን", 0.00000000 },
+  { "ኖ", 0.00000000 },
+  { "አ", 0.00000000 },
+  { "ኡ", 0.00000000 },
+  { "ኢ", 0.00000000 },
+  { "ኣ", 0.00000000 },
+  { "ኤ", 0.00000000 },
+  { "እ", 0.00000000 },
+  { "ኦ", 0.00000000 },
+  { "ከ", 0.00000000 },
+  { "ኩ", 0.00000000 },
+  { "ኪ", 0.00000000 },
+  { "ካ", 0.00000000 },
+  { "ኬ", 0.00000000 },
+  { "ክ", 0.00000000 },
+  { "ኮ", 0.00000000 },
+  { "ኰ", 0.00000000 },
+  { "ኲ", 0.00000000 },
+  { "ኳ", 0.00000000 },
+  { "ኴ", 0.00000000 },
+  { "ኵ", 0.00000000 },
+  { "ወ", 0.00000000 },
+  { "ዉ", 0.00000000 },
+  { "ዊ", 0.00000000 },
+  { "ዋ", 0.00000000 },
+  { "ዌ", 0.00000000 },
+  { "ው", 0.00000000 },
+  { "ዎ", 0.00000000 },
+  { "ዐ", 0.00000000 },
+  { "ዑ", 0.00000000 },
+  { "ዒ", 0.00000000 },
+  { "ዓ", 0.00000000 },
+  { "ዔ", 0.00000000 },
+  { "ዕ", 0.00000000 },
+  { "ዖ", 0.00000000 },
+  { "ዘ", 0.00000000 },
+  { "ዙ", 0.00000000 },
+  { "ዚ", 0.00000000 },
+  { "ዛ", 0.00000000 },
+  { "ዜ", 0.00000000 },
+  { "ዝ", 0.00000000 },
+  { "ዞ", 0.00000000 },
+  { "የ", 0.00000000 },
+  { "ዩ", 0.00000000 },
+  { "ዪ", 0.00000000 },
+  { "ያ", 0.00000000 },
+  { "ዬ", 0.00000000 },
+  { "ይ", 0.00000000 },
+  { "ዮ", 0.00000000 },
+  { "ደ", 0.00000000 },
+  { "ዱ", 0.00000000 },
+  { "ዲ", 0.00000000 },
+  { "ዳ", 0.00000000 },
+  { "ዴ", 0.00000000 },
+  { "ድ", 0.00000000 },
+  { "ዶ", 0.00000000 },
+  { "ገ", 0.00000000 },
+  { "ጉ", 0.00000000 },
+  { "ጊ", 0.00000000 },
+  { "ጋ", 0.00000000 },
+  { "ጌ", 0.00000000 },
+  { "ግ", 0.00000000 },
+  { "ጎ", 0.00000000 },
+  { "ጐ", 0.00000000 },
+  { "ጒ", 0.00000000 },
+  { "ጓ", 0.00000000 },
+  { "ጔ", 0.00000000 },
+  { "ጕ", 0.00000000 },
+  { "ጠ", 0.00000000 },
+  { "ጡ", 0.00000000 },
+  { "ጢ", 0.00000000 },
+  { "ጣ", 0.00000000 },
+  { "ጤ", 0.00000000 },
+  { "ጥ", 0.00000000 },
+  { "ጦ", 0.00000000 },
+  { "ጰ", 0.00000000 },
+  { "ጱ", 0.00000000 },
+  { "ጲ", 0.00000000 },
+  { "ጳ", 0.00000000 },
+  { "ጴ", 0.00000000 },
+  { "ጵ", 0.00000000 },
+  { "ጶ", 0.00000000 },
+  { "ጸ", 0.00000000 },
+  { "ጹ", 0.00000000 },
+  { "ጺ", 0.00000000 },
+  { "ጻ", 0.00000000 },
+  { "ጼ", 0.00000000 },
+  { "ጽ", 0.00000000 },
+  { "ጾ", 0.00000000 },
+  { "ፀ", 0.00000000 },
+  { "ፁ", 0.00000000 },
+  { "ፂ", 0.00000000 },
+  { "ፃ", 0.00000000 },
+  { "ፄ", 0.00000000 },
+  { "ፅ", 0.00000000 },
+  { "ፆ", 0.00000000 },
+  { "ፈ", 0.00000000 },
+  { "ፉ", 0.00000000 },
+  { "ፊ", 0.00000000 },
+  { "ፋ", 0.00000000 },
+  { "ፌ", 0.00000000 },
+  { "ፍ", 0.00000000 },
+  { "ፎ", 0.00000000 },
+  { "ፐ", 0.00000000 },
+  { "ፑ", 0.00000000 },
+  { "ፒ", 0.00000000 },
+  { "ፓ", 0.00000000 },
+  { "ፔ", 0.00000000 },
+  { "ፕ", 0.00000000 },
+  { "ፖ", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_90_FREQ_CPS[] = {
+  { 0x1200u, 0.00000000 },
+  { 0x1201u, 0.00000000 },
+  { 0x1202u, 0.00000000 },
+  { 0x1203u, 0.00000000 },
+  { 0x1204u, 0.00000000 },
+  { 0x1205u, 0.00000000 },
+  { 0x1206u, 0.00000000 },
+  { 0x1208u, 0.00000000 },
+  { 0x1209u, 0.00000000 },
+  { 0x120Au, 0.00000000 },
+  { 0x120Bu, 0.00000000 },
+  { 0x120Cu, 0.00000000 },
+  { 0x120Du, 0.00000000 },
+  { 0x120Eu, 0.00000000 },
+  { 0x1210u, 0.00000000 },
+  { 0x1211u, 0.00000000 },
+  { 0x1212u, 0.00000000 },
+  { 0x1213u, 0.00000000 },
+  { 0x1214u, 0.00000000 },
+  { 0x1215u, 0.00000000 },
+  { 0x1216u, 0.00000000 },
+  { 0x1218u, 0.00000000 },
+  { 0x1219u, 0.00000000 },
+  { 0x121Au, 0.00000000 },
+  { 0x121Bu, 0.00000000 },
+  { 0x121Cu, 0.00000000 },
+  { 0x121Du, 0.00000000 },
+  { 0x121Eu, 0.00000000 },
+  { 0x1220u, 0.00000000 },
+  { 0x1221u, 0.00000000 },
+  { 0x1222u, 0.00000000 },
+  { 0x1223u, 0.00000000 },
+  { 0x1224u, 0.00000000 },
+  { 0x1225u, 0.00000000 },
+  { 0x1226u, 0.00000000 },
+  { 0x1228u, 0.00000000 },
+  { 0x1229u, 0.00000000 },
+  { 0x122Au, 0.00000000 },
+  { 0x122Bu, 0.00000000 },
+  { 0x122Cu, 0.00000000 },
+  { 0x122Du, 0.00000000 },
+  { 0x122Eu, 0.00000000 },
+  { 0x1230u, 0.00000000 },
+  { 0x1231u, 0.00000000 },
+  { 0x1232u, 0.00000000 },
+  { 0x1233u, 0.00000000 },
+  { 0x1234u, 0.00000000 },
+  { 0x1235u, 0.00000000 },
+  { 0x1236u, 0.00000000 },
+  { 0x1240u, 0.00000000 },
+  { 0x1241u, 0.00000000 },
+  { 0x1242u, 0.00000000 },
+  { 0x1243u, 0.00000000 },
+  { 0x1244u, 0.00000000 },
+  { 0x1245u, 0.00000000 },
+  { 0x1246u, 0.00000000 },
+  { 0x1248u, 0.00000000 },
+  { 0x124Au, 0.00000000 },
+  { 0x124Bu, 0.00000000 },
+  { 0x124Cu, 0.00000000 },
+  { 0x124Du, 0.00000000 },
+  { 0x1260u, 0.00000000 },
+  { 0x1261u, 0.00000000 },
+  { 0x1262u, 0.00000000 },
+  { 0x1263u, 0.00000000 },
+  { 0x1264u, 0.00000000 },
+  { 0x1265u, 0.00000000 },
+  { 0x1266u, 0.00000000 },
+  { 0x1270u, 0.00000000 },
+  { 0x1271u, 0.00000000 },
+  { 0x1272u, 0.00000000 },
+  { 0x1273u, 0.00000000 },
+  { 0x1274u, 0.00000000 },
+  { 0x1275u, 0.00000000 },
+  { 0x1276u, 0.00000000 },
+  { 0x1280u, 0.00000000 },
+  { 0x1281u, 0.00000000 },
+  { 0x1282u, 0.00000000 },
+  { 0x1283u, 0.00000000 },
+  { 0x1284u, 0.00000000 },
+  { 0x1285u, 0.00000000 },
+  { 0x1286u, 0.00000000 },
+  { 0x1288u, 0.00000000 },
+  { 0x128Au, 0.00000000 },
+  { 0x128Bu, 0.00000000 },
+  { 0x128Cu, 0.00000000 },
+  { 0x128Du, 0.00000000 },
+  { 0x1290u, 0.00000000 },
+  { 0x1291u, 0.00000000 },
+  { 0x1292u, 0.00000000 },
+  { 0x1293u, 0.00000000 },
+  { 0x1294u, 0.00000000 },
+  { 0x1295u, 0.00000000 },
+  { 0x1296u, 0.00000000 },
+  { 0x12A0u, 0.00000000 },
+  { 0x12A1u, 0.00000000 },
+  { 0x12A2u, 0.00000000 },
+  { 0x12A3u, 0.00000000 },
+  { 0x12A4u, 0.00000000 },
+  { 0x12A5u, 0.00000000 },
+  { 0x12A6u, 0.00000000 },
+  { 0x12A8u, 0.00000000 },
+  { 0x12A9u, 0.00000000 },
+  { 0x12AAu, 0.00000000 },
+  { 0x12ABu, 0.00000000 },
+  { 0x12ACu, 0.00000000 },
+  { 0x12ADu, 0.00000000 },
+  { 0x12AEu, 0.00000000 },
+  { 0x12B0u, 0.00000000 },
+  { 0x12B2u, 0.00000000 },
+  { 0x12B3u, 0.00000000 },
+  { 0x12B4u, 0.00000000 },
+  { 0x12B5u, 0.00000000 },
+  { 0x12C8u, 0.00000000 },
+  { 0x12C9u, 0.00000000 },
+  { 0x12CAu, 0.00000000 },
+  { 0x12CBu, 0.00000000 },
+  { 0x12CCu, 0.00000000 },
+  { 0x12CDu, 0.00000000 },
+  { 0x12CEu, 0.00000000 },
+  { 0x12D0u, 0.00000000 },
+  { 0x12D1u, 0.00000000 },
+  { 0x12D2u, 0.00000000 },
+  { 0x12D3u, 0.00000000 },
+  { 0x12D4u, 0.00000000 },
+  { 0x12D5u, 0.00000000 },
+  { 0x12D6u, 0.00000000 },
+  { 0x12D8u, 0.00000000 },
+  { 0x12D9u, 0.00000000 },
+  { 0x12DAu, 0.00000000 },
+  { 0x12DBu, 0.00000000 },
+  { 0x12DCu, 0.00000000 },
+  { 0x12DDu, 0.00000000 },
+  { 0x12DEu, 0.00000000 },
+  { 0x12E8u, 0.00000000 },
+  { 0x12E9u, 0.00000000 },
+  { 0x12EAu, 0.00000000 },
+  { 0x12EBu, 0.00000000 },
+  { 0x12ECu, 0.00000000 },
+  { 0x12EDu, 0.00000000 },
+  { 0x12EEu, 0.00000000 },
+  { 0x12F0u, 0.00000000 },
+  { 0x12F1u, 0.00000000 },
+  { 0x12F2u, 0.00000000 },
+  { 0x12F3u, 0.00000000 },
+  { 0x12F4u, 0.00000000 },
+  { 0x12F5u, 0.00000000 },
+  { 0x12F6u, 0.00000000 },
+  { 0x1308u, 0.00000000 },
+  { 0x1309u, 0.00000000 },
+  { 0x130Au, 0.00000000 },
+  { 0x130Bu, 0.00000000 },
+  { 0x130Cu, 0.00000000 },
+  { 0x130Du, 0.00000000 },
+  { 0x130Eu, 0.00000000 },
+  { 0x1310u, 0.00000000 },
+  { 0x1312u, 0.00000000 },
+  { 0x1313u, 0.00000000 },
+  { 0x1314u, 0.00000000 },
+  { 0x1315u, 0.00000000 },
+  { 0x1320u, 0.00000000 },
+  { 0x1321u, 0.00000000 },
+  { 0x1322u, 0.00000000 },
+  { 0x1323u, 0.00000000 },
+  { 0x1324u, 0.00000000 },
+  { 0x1325u, 0.00000000 },
+  { 0x1326u, 0.00000000 },
+  { 0x1330u, 0.00000000 },
+  { 0x1331u, 0.00000000 },
+  { 0x1332u, 0.00000000 },
+  { 0x1333u, 0.00000000 },
+  { 0x1334u, 0.00000000 },
+  { 0x1335u, 0.00000000 },
+  { 0x1336u, 0.00000000 },
+  { 0x1338u, 0.00000000 },
+  { 0x1339u, 0.00000000 },
+  { 0x133Au, 0.00000000 },
+  { 0x133Bu, 0.00000000 },
+  { 0x133Cu, 0.00000000 },
+  { 0x133Du, 0.00000000 },
+  { 0x133Eu, 0.00000000 },
+  { 0x1340u, 0.00000000 },
+  { 0x1341u, 0.00000000 },
+  { 0x1342u, 0.00000000 },
+  { 0x1343u, 0.00000000 },
+  { 0x1344u, 0.00000000 },
+  { 0x1345u, 0.00000000 },
+  { 0x1346u, 0.00000000 },
+  { 0x1348u, 0.00000000 },
+  { 0x1349u, 0.00000000 },
+  { 0x134Au, 0.00000000 },
+  { 0x134Bu, 0.00000000 },
+  { 0x134Cu, 0.00000000 },
+  { 0x134Du, 0.00000000 },
+  { 0x134Eu, 0.00000000 },
+  { 0x1350u, 0.00000000 },
+  { 0x1351u, 0.00000000 },
+  { 0x1352u, 0.00000000 },
+  { 0x1353u, 0.00000000 },
+  { 0x1354u, 0.00000000 },
+  { 0x1355u, 0.00000000 },
+  { 0x1356u, 0.00000000 },
+};
+
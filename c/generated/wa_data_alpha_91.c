@@ -0,0 +1,163 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_91_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "Ñ",
+  "O",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+  "Á",
+  "É",
+  "Í",
+  "Ï",
+  "Ó",
+  "Ú",
+  "Ü",
+};
+const char *ALPHA_91_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "ñ",
+  "o",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+  "á",
+  "é",
+  "í",
+  "ï",
+  "ó",
+  "ú",
+  "ü",
+};
+const char *ALPHA_91_DIGITS[] = {
+};
+const uint32_t ALPHA_91_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 193, 201, 205, 207, 209, 211,
+  218, 220,
+};
+const uint32_t ALPHA_91_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 225, 233, 237, 239, 241, 243,
+  250, 252,
+};
+const uint32_t ALPHA_91_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_91_FREQ[] = {
+  { "a", 0.12340000 },
+  { "b", 0.01260000 },
+  { "c", 0.04590000 },
+  { "d", 0.05480000 },
+  { "e", 0.11390000 },
+  { "f", 0.01050000 },
+  { "g", 0.01160000 },
+  { "h", 0.00770000 },
+  { "i", 0.06910000 },
+  { "j", 0.00070000 },
+  { "k", 0.00160000 },
+  { "l", 0.03420000 },
+  { "m", 0.02870000 },
+  { "n", 0.07340000 },
+  { "ñ", 0.00240000 },
+  { "o", 0.10200000 },
+  { "p", 0.02650000 },
+  { "q", 0.00610000 },
+  { "r", 0.06680000 },
+  { "s", 0.07140000 },
+  { "t", 0.04920000 },
+  { "u", 0.03690000 },
+  { "v", 0.01000000 },
+  { "w", 0.00080000 },
+  { "x", 0.00810000 },
+  { "y", 0.00120000 },
+  { "z", 0.00390000 },
+  { "á", 0.00520000 },
+  { "é", 0.00510000 },
+  { "í", 0.00590000 },
+  { "ï", 0.00000000 },
+  { "ó", 0.00780000 },
+  { "ú", 0.00280000 },
+  { "ü", 0.00010000 },
+};
+
+const wa_cp_freq ALPHA_91_FREQ_CPS[] = {
+  { 0x61u, 0.12340000 },
+  { 0x62u, 0.01260000 },
+  { 0x63u, 0.04590000 },
+  { 0x64u, 0.05480000 },
+  { 0x65u, 0.11390000 },
+  { 0x66u, 0.01050000 },
+  { 0x67u, 0.01160000 },
+  { 0x68u, 0.00770000 },
+  { 0x69u, 0.06910000 },
+  { 0x6Au, 0.00070000 },
+  { 0x6Bu, 0.00160000 },
+  { 0x6Cu, 0.03420000 },
+  { 0x6Du, 0.02870000 },
+  { 0x6Eu, 0.07340000 },
+  { 0x6Fu, 0.10200000 },
+  { 0x70u, 0.02650000 },
+  { 0x71u, 0.00610000 },
+  { 0x72u, 0.06680000 },
+  { 0x73u, 0.07140000 },
+  { 0x74u, 0.04920000 },
+  { 0x75u, 0.03690000 },
+  { 0x76u, 0.01000000 },
+  { 0x77u, 0.00080000 },
+  { 0x78u, 0.00810000 },
+  { 0x79u, 0.00120000 },
+  { 0x7Au, 0.00390000 },
+  { 0xE1u, 0.00520000 },
+  { 0xE9u, 0.00510000 },
+  { 0xEDu, 0.00590000 },
+  { 0xEFu, 0.00000000 },
+  { 0xF1u, 0.00240000 },
+  { 0xF3u, 0.00780000 },
+  { 0xFAu, 0.00280000 },
+  { 0xFCu, 0.00010000 },
+};
+
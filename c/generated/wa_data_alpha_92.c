@@ -0,0 +1,141 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_92_UPPER[] = {
+  "A",
+  "Ã",
+  "C",
+  "E",
+  "Ẽ",
+  "H",
+  "I",
+  "Ĩ",
+  "J",
+  "K",
+  "L",
+  "M",
+  "B",
+  "Ñ",
+  "D",
+  "G",
+  "N",
+  "O",
+  "Õ",
+  "P",
+  "R",
+  "S",
+  "T",
+  "U",
+  "Ũ",
+  "V",
+  "Y",
+  "Ỹ",
+  "ʼ",
+};
+const char *ALPHA_92_LOWER[] = {
+  "a",
+  "ã",
+  "c",
+  "e",
+  "ẽ",
+  "h",
+  "i",
+  "ĩ",
+  "j",
+  "k",
+  "l",
+  "m",
+  "b",
+  "ñ",
+  "d",
+  "g",
+  "n",
+  "o",
+  "õ",
+  "p",
+  "r",
+  "s",
+  "t",
+  "u",
+  "ũ",
+  "v",
+  "y",
+  "ỹ",
+  "ʼ",
+};
+const char *ALPHA_92_DIGITS[] = {
+};
+const uint32_t ALPHA_92_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 82,
+  83, 84, 85, 86, 89, 195, 209, 213, 296, 360, 700, 7868, 7928,
+};
+const uint32_t ALPHA_92_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 114,
+  115, 116, 117, 118, 121, 227, 241, 245, 297, 361, 700, 7869, 7929,
+};
+const uint32_t ALPHA_92_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_92_FREQ[] = {
+  { "a", 0.15480000 },
+  { "ã", 0.00950000 },
+  { "c", 0.02060000 },
+  { "e", 0.11210000 },
+  { "ẽ", 0.00430000 },
+  { "h", 0.04310000 },
+  { "i", 0.06470000 },
+  { "ĩ", 0.00500000 },
+  { "j", 0.01550000 },
+  { "k", 0.02930000 },
+  { "l", 0.01580000 },
+  { "m", 0.03600000 },
+  { "b", 0.01630000 },
+  { "ñ", 0.01180000 },
+  { "d", 0.01790000 },
+  { "g", 0.02450000 },
+  { "n", 0.03200000 },
+  { "o", 0.08120000 },
+  { "õ", 0.00230000 },
+  { "p", 0.05070000 },
+  { "r", 0.06320000 },
+  { "s", 0.02340000 },
+  { "t", 0.04340000 },
+  { "u", 0.05940000 },
+  { "ũ", 0.00130000 },
+  { "v", 0.03310000 },
+  { "y", 0.02800000 },
+  { "ỹ", 0.00090000 },
+  { "ʼ", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_92_FREQ_CPS[] = {
+  { 0x61u, 0.15480000 },
+  { 0x62u, 0.01630000 },
+  { 0x63u, 0.02060000 },
+  { 0x64u, 0.01790000 },
+  { 0x65u, 0.11210000 },
+  { 0x67u, 0.02450000 },
+  { 0x68u, 0.04310000 },
+  { 0x69u, 0.06470000 },
+  { 0x6Au, 0.01550000 },
+  { 0x6Bu, 0.02930000 },
+  { 0x6Cu, 0.01580000 },
+  { 0x6Du, 0.03600000 },
+  { 0x6Eu, 0.03200000 },
+  { 0x6Fu, 0.08120000 },
+  { 0x70u, 0.05070000 },
+  { 0x72u, 0.06320000 },
+  { 0x73u, 0.02340000 },
+  { 0x74u, 0.04340000 },
+  { 0x75u, 0.05940000 },
+  { 0x76u, 0.03310000 },
+  { 0x79u, 0.02800000 },
+  { 0xE3u, 0.00950000 },
+  { 0xF1u, 0.01180000 },
+  { 0xF5u, 0.00230000 },
+  { 0x129u, 0.00500000 },
+  { 0x169u, 0.00130000 },
+  { 0x2BCu, 0.00000000 },
+  { 0x1EBDu, 0.00430000 },
+  { 0x1EF9u, 0.00090000 },
+};
+
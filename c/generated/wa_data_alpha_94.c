@@ -0,0 +1,229 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_94_UPPER[] = {
+  "અ",
+  "આ",
+  "ઇ",
+  "ઈ",
+  "ઉ",
+  "ઊ",
+  "ઋ",
+  "ઍ",
+  "એ",
+  "ઐ",
+  "ઑ",
+  "ઓ",
+  "ઔ",
+  "ક",
+  "ખ",
+  "ગ",
+  "ઘ",
+  "ઙ",
+  "ચ",
+  "છ",
+  "જ",
+  "ઝ",
+  "ઞ",
+  "ટ",
+  "ઠ",
+  "ડ",
+  "ઢ",
+  "ણ",
+  "ત",
+  "થ",
+  "દ",
+  "ધ",
+  "ન",
+  "પ",
+  "ફ",
+  "બ",
+  "ભ",
+  "મ",
+  "ય",
+  "ર",
+  "ઽ",
+  "ૐ",
+  "ૠ",
+  "લ",
+  "વ",
+  "શ",
+  "ષ",
+  "સ",
+  "હ",
+  "ળ",
+};
+const char *ALPHA_94_LOWER[] = {
+  "અ",
+  "આ",
+  "ઇ",
+  "ઈ",
+  "ઉ",
+  "ઊ",
+  "ઋ",
+  "ઍ",
+  "એ",
+  "ઐ",
+  "ઑ",
+  "ઓ",
+  "ઔ",
+  "ક",
+  "ખ",
+  "ગ",
+  "ઘ",
+  "ઙ",
+  "ચ",
+  "છ",
+  "જ",
+  "ઝ",
+  "ઞ",
+  "ટ",
+  "ઠ",
+  "ડ",
+  "ઢ",
+  "ણ",
+  "ત",
+  "થ",
+  "દ",
+  "ધ",
+  "ન",
+  "પ",
+  "ફ",
+  "બ",
+  "ભ",
+  "મ",
+  "ય",
+  "ર",
+  "ઽ",
+  "ૐ",
+  "ૠ",
+  "લ",
+  "વ",
+  "શ",
+  "ષ",
+  "સ",
+  "હ",
+  "ળ",
+};
+const char *ALPHA_94_DIGITS[] = {
+};
+const uint32_t ALPHA_94_UPPER_CPS[] = {
+  2693, 2694, 2695, 2696, 2697, 2698, 2699, 2701, 2703, 2704, 2705, 2707, 2708, 2709, 2710, 2711,
+  2712, 2713, 2714, 2715, 2716, 2717, 2718, 2719, 2720, 2721, 2722, 2723, 2724, 2725, 2726, 2727,
+  2728, 2730, 2731, 2732, 2733, 2734, 2735, 2736, 2738, 2739, 2741, 2742, 2743, 2744, 2745, 2749,
+  2768, 2784,
+};
+const uint32_t ALPHA_94_LOWER_CPS[] = {
+  2693, 2694, 2695, 2696, 2697, 2698, 2699, 2701, 2703, 2704, 2705, 2707, 2708, 2709, 2710, 2711,
+  2712, 2713, 2714, 2715, 2716, 2717, 2718, 2719, 2720, 2721, 2722, 2723, 2724, 2725, 2726, 2727,
+  2728, 2730, 2731, 2732, 2733, 2734, 2735, 2736, 2738, 2739, 2741, 2742, 2743, 2744, 2745, 2749,
+  2768, 2784,
+};
+const uint32_t ALPHA_94_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_94_FREQ[] = {
+  { "અ", 0.01500000 },
+  { "આ", 0.02320000 },
+  { "ઇ", 0.00510000 },
+  { "ઈ", 0.00260000 },
+  { "ઉ", 0.00540000 },
+  { "ઊ", 0.00040000 },
+  { "ઋ", 0.00010000 },
+  { "ઍ", 0.00010000 },
+  { "એ", 0.01270000 },
+  { "ઐ", 0.00010000 },
+  { "ઑ", 0.00010000 },
+  { "ઓ", 0.00710000 },
+  { "ઔ", 0.00010000 },
+  { "ક", 0.06440000 },
+  { "ખ", 0.01330000 },
+  { "ગ", 0.02810000 },
+  { "ઘ", 0.00390000 },
+  { "ઙ", 0.00000000 },
+  { "ચ", 0.01130000 },
+  { "છ", 0.01800000 },
+  { "જ", 0.03410000 },
+  { "ઝ", 0.00220000 },
+  { "ઞ", 0.00030000 },
+  { "ટ", 0.01920000 },
+  { "ઠ", 0.00160000 },
+  { "ડ", 0.01640000 },
+  { "ઢ", 0.00050000 },
+  { "ણ", 0.01340000 },
+  { "ત", 0.06730000 },
+  { "થ", 0.01560000 },
+  { "દ", 0.02120000 },
+  { "ધ", 0.01120000 },
+  { "ન", 0.08620000 },
+  { "પ", 0.04450000 },
+  { "ફ", 0.00580000 },
+  { "બ", 0.01510000 },
+  { "ભ", 0.01130000 },
+  { "મ", 0.07770000 },
+  { "ય", 0.04330000 },
+  { "ર", 0.09590000 },
+  { "ઽ", 0.00000000 },
+  { "ૐ", 0.00000000 },
+  { "ૠ", 0.00000000 },
+  { "લ", 0.04670000 },
+  { "વ", 0.06470000 },
+  { "શ", 0.01900000 },
+  { "ષ", 0.00570000 },
+  { "સ", 0.04230000 },
+  { "હ", 0.01980000 },
+  { "ળ", 0.00780000 },
+};
+
+const wa_cp_freq ALPHA_94_FREQ_CPS[] = {
+  { 0xA85u, 0.01500000 },
+  { 0xA86u, 0.02320000 },
+  { 0xA87u, 0.00510000 },
+  { 0xA88u, 0.00260000 },
+  { 0xA89u, 0.00540000 },
+  { 0xA8Au, 0.00040000 },
+  { 0xA8Bu, 0.00010000 },
+  { 0xA8Du, 0.00010000 },
+  { 0xA8Fu, 0.01270000 },
+  { 0xA90u, 0.00010000 },
+  { 0xA91u, 0.00010000 },
+  { 0xA93u, 0.00710000 },
+  { 0xA94u, 0.00010000 },
+  { 0xA95u, 0.06440000 },
+  { 0xA96u, 0.01330000 },
+  { 0xA97u, 0.02810000 },
+  { 0xA98u, 0.00390000 },
+  { 0xA99u, 0.00000000 },
+  { 0xA9Au, 0.01130000 },
+  { 0xA9Bu, 0.01800000 },
+  { 0xA9Cu, 0.03410000 },
+  { 0xA9Du, 0.00220000 },
+  { 0xA9Eu, 0.00030000 },
+  { 0xA9Fu, 0.01920000 },
+  { 0xAA0u, 0.00160000 },
+  { 0xAA1u, 0.01640000 },
+  { 0xAA2u, 0.00050000 },
+  { 0xAA3u, 0.01340000 },
+  { 0xAA4u, 0.06730000 },
+  { 0xAA5u, 0.01560000 },
+  { 0xAA6u, 0.02120000 },
+  { 0xAA7u, 0.01120000 },
+  { 0xAA8u, 0.08620000 },
+  { 0xAAAu, 0.04450000 },
+  { 0xAABu, 0.00580000 },
+  { 0xAACu, 0.01510000 },
+  { 0xAADu, 0.01130000 },
+  { 0xAAEu, 0.07770000 },
+  { 0xAAFu, 0.04330000 },
+  { 0xAB0u, 0.09590000 },
+  { 0xAB2u, 0.04670000 },
+  { 0xAB3u, 0.00780000 },
+  { 0xAB5u, 0.06470000 },
+  { 0xAB6u, 0.01900000 },
+  { 0xAB7u, 0.00570000 },
+  { 0xAB8u, 0.04230000 },
+  { 0xAB9u, 0.01980000 },
+  { 0xABDu, 0.00000000 },
+  { 0xAD0u, 0.00000000 },
+  { 0xAE0u, 0.00000000 },
+};
+
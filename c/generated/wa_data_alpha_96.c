@@ -0,0 +1,133 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_96_UPPER[] = {
+  "A",
+  "B",
+  "C",
+  "D",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "L",
+  "M",
+  "N",
+  "O",
+  "P",
+  "Q",
+  "R",
+  "S",
+  "T",
+  "U",
+  "V",
+  "W",
+  "X",
+  "Y",
+  "Z",
+  "Ç",
+};
+const char *ALPHA_96_LOWER[] = {
+  "a",
+  "b",
+  "c",
+  "d",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "l",
+  "m",
+  "n",
+  "o",
+  "p",
+  "q",
+  "r",
+  "s",
+  "t",
+  "u",
+  "v",
+  "w",
+  "x",
+  "y",
+  "z",
+  "ç",
+};
+const char *ALPHA_96_DIGITS[] = {
+};
+const uint32_t ALPHA_96_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 199,
+};
+const uint32_t ALPHA_96_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 231,
+};
+const uint32_t ALPHA_96_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_96_FREQ[] = {
+  { "a", 0.11560000 },
+  { "b", 0.01280000 },
+  { "c", 0.02690000 },
+  { "d", 0.02690000 },
+  { "e", 0.11490000 },
+  { "f", 0.00720000 },
+  { "g", 0.04010000 },
+  { "h", 0.07160000 },
+  { "i", 0.05240000 },
+  { "j", 0.00750000 },
+  { "k", 0.00850000 },
+  { "l", 0.04890000 },
+  { "m", 0.02250000 },
+  { "n", 0.08900000 },
+  { "o", 0.05610000 },
+  { "p", 0.00730000 },
+  { "q", 0.00070000 },
+  { "r", 0.06550000 },
+  { "s", 0.06560000 },
+  { "t", 0.04270000 },
+  { "u", 0.01710000 },
+  { "v", 0.01080000 },
+  { "w", 0.00430000 },
+  { "x", 0.00040000 },
+  { "y", 0.08030000 },
+  { "z", 0.00070000 },
+  { "ç", 0.00370000 },
+};
+
+const wa_cp_freq ALPHA_96_FREQ_CPS[] = {
+  { 0x61u, 0.11560000 },
+  { 0x62u, 0.01280000 },
+  { 0x63u, 0.02690000 },
+  { 0x64u, 0.02690000 },
+  { 0x65u, 0.11490000 },
+  { 0x66u, 0.00720000 },
+  { 0x67u, 0.04010000 },
+  { 0x68u, 0.07160000 },
+  { 0x69u, 0.05240000 },
+  { 0x6Au, 0.00750000 },
+  { 0x6Bu, 0.00850000 },
+  { 0x6Cu, 0.04890000 },
+  { 0x6Du, 0.02250000 },
+  { 0x6Eu, 0.08900000 },
+  { 0x6Fu, 0.05610000 },
+  { 0x70u, 0.00730000 },
+  { 0x71u, 0.00070000 },
+  { 0x72u, 0.06550000 },
+  { 0x73u, 0.06560000 },
+  { 0x74u, 0.04270000 },
+  { 0x75u, 0.01710000 },
+  { 0x76u, 0.01080000 },
+  { 0x77u, 0.00430000 },
+  { 0x78u, 0.00040000 },
+  { 0x79u, 0.08030000 },
+  { 0x7Au, 0.00070000 },
+  { 0xE7u, 0.00370000 },
+};
+
@@ -0,0 +1,133 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_97_UPPER[] = {
+  "A",
+  "B",
+  "Ɓ",
+  "C",
+  "D",
+  "Ɗ",
+  "E",
+  "F",
+  "G",
+  "H",
+  "I",
+  "J",
+  "K",
+  "Ƙ",
+  "L",
+  "M",
+  "N",
+  "O",
+  "R",
+  "S",
+  "T",
+  "U",
+  "W",
+  "Y",
+  "Ƴ",
+  "Z",
+  "ʼ",
+};
+const char *ALPHA_97_LOWER[] = {
+  "a",
+  "b",
+  "ɓ",
+  "c",
+  "d",
+  "ɗ",
+  "e",
+  "f",
+  "g",
+  "h",
+  "i",
+  "j",
+  "k",
+  "ƙ",
+  "l",
+  "m",
+  "n",
+  "o",
+  "r",
+  "s",
+  "t",
+  "u",
+  "w",
+  "y",
+  "ƴ",
+  "z",
+  "ʼ",
+};
+const char *ALPHA_97_DIGITS[] = {
+};
+const uint32_t ALPHA_97_UPPER_CPS[] = {
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 82,
+  83, 84, 85, 87, 89, 90, 385, 394, 408, 435, 700,
+};
+const uint32_t ALPHA_97_LOWER_CPS[] = {
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 114,
+  115, 116, 117, 119, 121, 122, 409, 436, 595, 599, 700,
+};
+const uint32_t ALPHA_97_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_97_FREQ[] = {
+  { "a", 0.26790000 },
+  { "b", 0.02100000 },
+  { "ɓ", 0.00050000 },
+  { "c", 0.01490000 },
+  { "d", 0.04360000 },
+  { "ɗ", 0.00170000 },
+  { "e", 0.03030000 },
+  { "f", 0.01040000 },
+  { "g", 0.01630000 },
+  { "h", 0.02640000 },
+  { "i", 0.08620000 },
+  { "j", 0.00730000 },
+  { "k", 0.05180000 },
+  { "ƙ", 0.00320000 },
+  { "l", 0.01930000 },
+  { "m", 0.04110000 },
+  { "n", 0.09200000 },
+  { "o", 0.02030000 },
+  { "r", 0.04870000 },
+  { "s", 0.04950000 },
+  { "t", 0.03180000 },
+  { "u", 0.05280000 },
+  { "w", 0.02270000 },
+  { "y", 0.03300000 },
+  { "ƴ", 0.00010000 },
+  { "z", 0.00730000 },
+  { "ʼ", 0.00000000 },
+};
+
+const wa_cp_freq ALPHA_97_FREQ_CPS[] = {
+  { 0x61u, 0.26790000 },
+  { 0x62u, 0.02100000 },
+  { 0x63u, 0.01490000 },
+  { 0x64u, 0.04360000 },
+  { 0x65u, 0.03030000 },
+  { 0x66u, 0.01040000 },
+  { 0x67u, 0.01630000 },
+  { 0x68u, 0.02640000 },
+  { 0x69u, 0.08620000 },
+  { 0x6Au, 0.00730000 },
+  { 0x6Bu, 0.05180000 },
+  { 0x6Cu, 0.01930000 },
+  { 0x6Du, 0.04110000 },
+  { 0x6Eu, 0.09200000 },
+  { 0x6Fu, 0.02030000 },
+  { 0x72u, 0.04870000 },
+  { 0x73u, 0.04950000 },
+  { 0x74u, 0.03180000 },
+  { 0x75u, 0.05280000 },
+  { 0x77u, 0.02270000 },
+  { 0x79u, 0.03300000 },
+  { 0x7Au, 0.00730000 },
+  { 0x199u, 0.00320000 },
+  { 0x1B4u, 0.00010000 },
+  { 0x253u, 0.00050000 },
+  { 0x257u, 0.00170000 },
+  { 0x2BCu, 0.00000000 },
+};
+
@@ -0,0 +1,107 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_98_UPPER[] = {
+  "A",
+  "Ā",
+  "E",
+  "Ē",
+  "I",
+  "Ī",
+  "O",
+  "Ō",
+  "U",
+  "Ū",
+  "H",
+  "K",
+  "L",
+  "M",
+  "N",
+  "P",
+  "W",
+  "ʻ",
+};
+const char *ALPHA_98_LOWER[] = {
+  "a",
+  "ā",
+  "e",
+  "ē",
+  "i",
+  "ī",
+  "o",
+  "ō",
+  "u",
+  "ū",
+  "h",
+  "k",
+  "l",
+  "m",
+  "n",
+  "p",
+  "w",
+  "ʻ",
+};
+const char *ALPHA_98_DIGITS[] = {
+  "0",
+  "1",
+  "2",
+  "3",
+  "4",
+  "5",
+  "6",
+  "7",
+  "8",
+  "9",
+};
+const uint32_t ALPHA_98_UPPER_CPS[] = {
+  65, 69, 72, 73, 75, 76, 77, 78, 79, 80, 85, 87, 256, 274, 298, 332,
+  362, 699,
+};
+const uint32_t ALPHA_98_LOWER_CPS[] = {
+  97, 101, 104, 105, 107, 108, 109, 110, 111, 112, 117, 119, 257, 275, 299, 333,
+  363, 699,
+};
+const uint32_t ALPHA_98_DIGITS_CPS[] = {
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+};
+const wa_freq_entry ALPHA_98_FREQ[] = {
+  { "a", 0.22370000 },
+  { "ā", 0.02920000 },
+  { "e", 0.08730000 },
+  { "ē", 0.00130000 },
+  { "i", 0.11070000 },
+  { "ī", 0.00110000 },
+  { "o", 0.08760000 },
+  { "ō", 0.00410000 },
+  { "u", 0.05740000 },
+  { "ū", 0.00320000 },
+  { "h", 0.03750000 },
+  { "k", 0.08440000 },
+  { "l", 0.07410000 },
+  { "m", 0.04910000 },
+  { "n", 0.07120000 },
+  { "p", 0.04160000 },
+  { "w", 0.01490000 },
+  { "ʻ", 0.02190000 },
+};
+
+const wa_cp_freq ALPHA_98_FREQ_CPS[] = {
+  { 0x61u, 0.22370000 },
+  { 0x65u, 0.08730000 },
+  { 0x68u, 0.03750000 },
+  { 0x69u, 0.11070000 },
+  { 0x6Bu, 0.08440000 },
+  { 0x6Cu, 0.07410000 },
+  { 0x6Du, 0.04910000 },
+  { 0x6Eu, 0.07120000 },
+  { 0x6Fu, 0.08760000 },
+  { 0x70u, 0.04160000 },
+  { 0x75u, 0.05740000 },
+  { 0x77u, 0.01490000 },
+  { 0x101u, 0.02920000 },
+  { 0x113u, 0.00130000 },
+  { 0x12Bu, 0.00110000 },
+  { 0x14Du, 0.00410000 },
+  { 0x16Bu, 0.00320000 },
+  { 0x2BBu, 0.02190000 },
+};
+
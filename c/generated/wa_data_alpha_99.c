@@ -0,0 +1,133 @@
+#include "worldalphabets_data.h"
+
+const char *ALPHA_99_UPPER[] = {
+  "א",
+  "ב",
+  "ג",
+  "ד",
+  "ה",
+  "ו",
+  "ז",
+  "ח",
+  "ט",
+  "י",
+  "כ",
+  "ל",
+  "מ",
+  "נ",
+  "ס",
+  "ע",
+  "פ",
+  "צ",
+  "ק",
+  "ר",
+  "ש",
+  "ת",
+  "ך",
+  "ם",
+  "ן",
+  "ף",
+  "ץ",
+};
+const char *ALPHA_99_LOWER[] = {
+  "א",
+  "ב",
+  "ג",
+  "ד",
+  "ה",
+  "ו",
+  "ז",
+  "ח",
+  "ט",
+  "י",
+  "כ",
+  "ל",
+  "מ",
+  "נ",
+  "ס",
+  "ע",
+  "פ",
+  "צ",
+  "ק",
+  "ר",
+  "ש",
+  "ת",
+  "ך",
+  "ם",
+  "ן",
+  "ף",
+  "ץ",
+};
+const char *ALPHA_99_DIGITS[] = {
+};
+const uint32_t ALPHA_99_UPPER_CPS[] = {
+  1488, 1489, 1490, 1491, 1492, 1493, 1494, 1495, 1496, 1497, 1498, 1499, 1500, 1501, 1502, 1503,
+  1504, 1505, 1506, 1507, 1508, 1509, 1510, 1511, 1512, 1513, 1514,
+};
+const uint32_t ALPHA_99_LOWER_CPS[] = {
+  1488, 1489, 1490, 1491, 1492, 1493, 1494, 1495, 1496, 1497, 1498, 1499, 1500, 1501, 1502, 1503,
+  1504, 1505, 1506, 1507, 1508, 1509, 1510, 1511, 1512, 1513, 1514,
+};
+const uint32_t ALPHA_99_DIGITS_CPS[] = {
+  0,
+};
+const wa_freq_entry ALPHA_99_FREQ[] = {
+  { "א", 0.04660000 },
+  { "ב", 0.05750000 },
+  { "ג", 0.01600000 },
+  { "ד", 0.02590000 },
+  { "ה", 0.08880000 },
+  { "ו", 0.11250000 },
+  { "ז", 0.00920000 },
+  { "ח", 0.02300000 },
+  { "ט", 0.01600000 },
+  { "י", 0.11360000 },
+  { "כ", 0.01970000 },
+  { "ל", 0.06450000 },
+  { "מ", 0.05160000 },
+  { "נ", 0.03740000 },
+  { "ס", 0.02150000 },
+  { "ע", 0.02660000 },
+  { "פ", 0.02260000 },
+  { "צ", 0.01330000 },
+  { "ק", 0.02450000 },
+  { "ר", 0.06150000 },
+  { "ש", 0.04470000 },
+  { "ת", 0.05620000 },
+  { "ך", 0.00390000 },
+  { "ם", 0.02620000 },
+  { "ן", 0.01300000 },
+  { "ף", 0.00230000 },
+  { "ץ", 0.00150000 },
+};
+
+const wa_cp_freq ALPHA_99_FREQ_CPS[] = {
+  { 0x5D0u, 0.04660000 },
+  { 0x5D1u, 0.05750000 },
+  { 0x5D2u, 0.01600000 },
+  { 0x5D3u, 0.02590000 },
+  { 0x5D4u, 0.08880000 },
+  { 0x5D5u, 0.11250000 },
+  { 0x5D6u, 0.00920000 },
+  { 0x5D7u, 0.02300000 },
+  { 0x5D8u, 0.01600000 },
+  { 0x5D9u, 0.11360000 },
+  { 0x5DAu, 0.00390000 },
+  { 0x5DBu, 0.01970000 },
+  { 0x5DCu, 0.06450000 },
+  { 0x5DDu, 0.02620000 },
+  { 0x5DEu, 0.05160000 },
+  { 0x5DFu, 0.01300000 },
+  { 0x5E0u, 0.03740000 },
+  { 0x5E1u, 0.02150000 },
+  { 0x5E2u, 0.02660000 },
+  { 0x5E3u, 0.00230000 },
+  { 0x5E4u, 0.02260000 },
+  { 0x5E5u, 0.00150000 },
+  { 0x5E6u, 0.01330000 },
+  { 0x5E7u, 0.02450000 },
+  { 0x5E8u, 0.06150000 },
+  { 0x5E9u, 0.04470000 },
+  { 0x5EAu, 0.05620000 },
+};
+
@@ -0,0 +1,6846 @@
+#include "worldalphabets_data.h"
+
+extern const char *ALPHA_0_UPPER[];
+extern const char *ALPHA_0_LOWER[];
+extern const char *ALPHA_0_DIGITS[];
+extern const wa_freq_entry ALPHA_0_FREQ[];
+extern const wa_cp_freq ALPHA_0_FREQ_CPS[];
+extern const uint32_t ALPHA_0_UPPER_CPS[];
+extern const uint32_t ALPHA_0_LOWER_CPS[];
+extern const uint32_t ALPHA_0_DIGITS_CPS[];
+extern const char *ALPHA_1_UPPER[];
+extern const char *ALPHA_1_LOWER[];
+extern const char *ALPHA_1_DIGITS[];
+extern const wa_freq_entry ALPHA_1_FREQ[];
+extern const wa_cp_freq ALPHA_1_FREQ_CPS[];
+extern const uint32_t ALPHA_1_UPPER_CPS[];
+extern const uint32_t ALPHA_1_LOWER_CPS[];
+extern const uint32_t ALPHA_1_DIGITS_CPS[];
+extern const char *ALPHA_2_UPPER[];
+extern const char *ALPHA_2_LOWER[];
+extern const char *ALPHA_2_DIGITS[];
+extern const wa_freq_entry ALPHA_2_FREQ[];
+extern const wa_cp_freq ALPHA_2_FREQ_CPS[];
+extern const uint32_t ALPHA_2_UPPER_CPS[];
+extern const uint32_t ALPHA_2_LOWER_CPS[];
+extern const uint32_t ALPHA_2_DIGITS_CPS[];
+extern const char *ALPHA_3_UPPER[];
+extern const char *ALPHA_3_LOWER[];
+extern const char *ALPHA_3_DIGITS[];
+extern const wa_freq_entry ALPHA_3_FREQ[];
+extern const wa_cp_freq ALPHA_3_FREQ_CPS[];
+extern const uint32_t ALPHA_3_UPPER_CPS[];
+extern const uint32_t ALPHA_3_LOWER_CPS[];
+extern const uint32_t ALPHA_3_DIGITS_CPS[];
+extern const char *ALPHA_4_UPPER[];
+extern const char *ALPHA_4_LOWER[];
+extern const char *ALPHA_4_DIGITS[];
+extern const wa_freq_entry ALPHA_4_FREQ[];
+extern const wa_cp_freq ALPHA_4_FREQ_CPS[];
+extern const uint32_t ALPHA_4_UPPER_CPS[];
+extern const uint32_t ALPHA_4_LOWER_CPS[];
+extern const uint32_t ALPHA_4_DIGITS_CPS[];
+extern const char *ALPHA_5_UPPER[];
+extern const char *ALPHA_5_LOWER[];
+extern const char *ALPHA_5_DIGITS[];
+extern const wa_freq_entry ALPHA_5_FREQ[];
+extern const wa_cp_freq ALPHA_5_FREQ_CPS[];
+extern const uint32_t ALPHA_5_UPPER_CPS[];
+extern const uint32_t ALPHA_5_LOWER_CPS[];
+extern const uint32_t ALPHA_5_DIGITS_CPS[];
+extern const char *ALPHA_6_UPPER[];
+extern const char *ALPHA_6_LOWER[];
+extern const char *ALPHA_6_DIGITS[];
+extern const wa_freq_entry ALPHA_6_FREQ[];
+extern const wa_cp_freq ALPHA_6_FREQ_CPS[];
+extern const uint32_t ALPHA_6_UPPER_CPS[];
+extern const uint32_t ALPHA_6_LOWER_CPS[];
+extern const uint32_t ALPHA_6_DIGITS_CPS[];
+extern const char *ALPHA_7_UPPER[];
+extern const char *ALPHA_7_LOWER[];
+extern const char *ALPHA_7_DIGITS[];
+extern const wa_freq_entry ALPHA_7_FREQ[];
+extern const wa_cp_freq ALPHA_7_FREQ_CPS[];
+extern const uint32_t ALPHA_7_UPPER_CPS[];
+extern const uint32_t ALPHA_7_LOWER_CPS[];
+extern const uint32_t ALPHA_7_DIGITS_CPS[];
+extern const char *ALPHA_8_UPPER[];
+extern const char *ALPHA_8_LOWER[];
+extern const char *ALPHA_8_DIGITS[];
+extern const wa_freq_entry ALPHA_8_FREQ[];
+extern const wa_cp_freq ALPHA_8_FREQ_CPS[];
+extern const uint32_t ALPHA_8_UPPER_CPS[];
+extern const uint32_t ALPHA_8_LOWER_CPS[];
+extern const uint32_t ALPHA_8_DIGITS_CPS[];
+extern const char *ALPHA_9_UPPER[];
+extern const char *ALPHA_9_LOWER[];
+extern const char *ALPHA_9_DIGITS[];
+extern const wa_freq_entry ALPHA_9_FREQ[];
+extern const wa_cp_freq ALPHA_9_FREQ_CPS[];
+extern const uint32_t ALPHA_9_UPPER_CPS[];
+extern const uint32_t ALPHA_9_LOWER_CPS[];
+extern const uint32_t ALPHA_9_DIGITS_CPS[];
+extern const char *ALPHA_10_UPPER[];
+extern const char *ALPHA_10_LOWER[];
+extern const char *ALPHA_10_DIGITS[];
+extern const wa_freq_entry ALPHA_10_FREQ[];
+extern const wa_cp_freq ALPHA_10_FREQ_CPS[];
+extern const uint32_t ALPHA_10_UPPER_CPS[];
+extern const uint32_t ALPHA_10_LOWER_CPS[];
+extern const uint32_t ALPHA_10_DIGITS_CPS[];
+extern const char *ALPHA_11_UPPER[];
+extern const char *ALPHA_11_LOWER[];
+extern const char *ALPHA_11_DIGITS[];
+extern const wa_freq_entry ALPHA_11_FREQ[];
+extern const wa_cp_freq ALPHA_11_FREQ_CPS[];
+extern const uint32_t ALPHA_11_UPPER_CPS[];
+extern const uint32_t ALPHA_11_LOWER_CPS[];
+extern const uint32_t ALPHA_11_DIGITS_CPS[];
+extern const char *ALPHA_12_UPPER[];
+extern const char *ALPHA_12_LOWER[];
+extern const char *ALPHA_12_DIGITS[];
+extern const wa_freq_entry ALPHA_12_FREQ[];
+extern const wa_cp_freq ALPHA_12_FREQ_CPS[];
+extern const uint32_t ALPHA_12_UPPER_CPS[];
+extern const uint32_t ALPHA_12_LOWER_CPS[];
+extern const uint32_t ALPHA_12_DIGITS_CPS[];
+extern const char *ALPHA_13_UPPER[];
+extern const char *ALPHA_13_LOWER[];
+extern const char *ALPHA_13_DIGITS[];
+extern const wa_freq_entry ALPHA_13_FREQ[];
+extern const wa_cp_freq ALPHA_13_FREQ_CPS[];
+extern const uint32_t ALPHA_13_UPPER_CPS[];
+extern const uint32_t ALPHA_13_LOWER_CPS[];
+extern const uint32_t ALPHA_13_DIGITS_CPS[];
+extern const char *ALPHA_14_UPPER[];
+extern const char *ALPHA_14_LOWER[];
+extern const char *ALPHA_14_DIGITS[];
+extern const wa_freq_entry ALPHA_14_FREQ[];
+extern const wa_cp_freq ALPHA_14_FREQ_CPS[];
+extern const uint32_t ALPHA_14_UPPER_CPS[];
+extern const uint32_t ALPHA_14_LOWER_CPS[];
+extern const uint32_t ALPHA_14_DIGITS_CPS[];
+extern const char *ALPHA_15_UPPER[];
+extern const char *ALPHA_15_LOWER[];
+extern const char *ALPHA_15_DIGITS[];
+extern const wa_freq_entry ALPHA_15_FREQ[];
+extern const wa_cp_freq ALPHA_15_FREQ_CPS[];
+extern const uint32_t ALPHA_15_UPPER_CPS[];
+extern const uint32_t ALPHA_15_LOWER_CPS[];
+extern const uint32_t ALPHA_15_DIGITS_CPS[];
+extern const char *ALPHA_16_UPPER[];
+extern const char *ALPHA_16_LOWER[];
+extern const char *ALPHA_16_DIGITS[];
+extern const wa_freq_entry ALPHA_16_FREQ[];
+extern const wa_cp_freq ALPHA_16_FREQ_CPS[];
+extern const uint32_t ALPHA_16_UPPER_CPS[];
+extern const uint32_t ALPHA_16_LOWER_CPS[];
+extern const uint32_t ALPHA_16_DIGITS_CPS[];
+extern const char *ALPHA_17_UPPER[];
+extern const char *ALPHA_17_LOWER[];
+extern const char *ALPHA_17_DIGITS[];
+extern const wa_freq_entry ALPHA_17_FREQ[];
+extern const wa_cp_freq ALPHA_17_FREQ_CPS[];
+extern const uint32_t ALPHA_17_UPPER_CPS[];
+extern const uint32_t ALPHA_17_LOWER_CPS[];
+extern const uint32_t ALPHA_17_DIGITS_CPS[];
+extern const char *ALPHA_18_UPPER[];
+extern const char *ALPHA_18_LOWER[];
+extern const char *ALPHA_18_DIGITS[];
+extern const wa_freq_entry ALPHA_18_FREQ[];
+extern const wa_cp_freq ALPHA_18_FREQ_CPS[];
+extern const uint32_t ALPHA_18_UPPER_CPS[];
+extern const uint32_t ALPHA_18_LOWER_CPS[];
+extern const uint32_t ALPHA_18_DIGITS_CPS[];
+extern const char *ALPHA_19_UPPER[];
+extern const char *ALPHA_19_LOWER[];
+extern const char *ALPHA_19_DIGITS[];
+extern const wa_freq_entry ALPHA_19_FREQ[];
+extern const wa_cp_freq ALPHA_19_FREQ_CPS[];
+extern const uint32_t ALPHA_19_UPPER_CPS[];
+extern const uint32_t ALPHA_19_LOWER_CPS[];
+extern const uint32_t ALPHA_19_DIGITS_CPS[];
+extern const char *ALPHA_20_UPPER[];
+extern const char *ALPHA_20_LOWER[];
+extern const char *ALPHA_20_DIGITS[];
+extern const wa_freq_entry ALPHA_20_FREQ[];
+extern const wa_cp_freq ALPHA_20_FREQ_CPS[];
+extern const uint32_t ALPHA_20_UPPER_CPS[];
+extern const uint32_t ALPHA_20_LOWER_CPS[];
+extern const uint32_t ALPHA_20_DIGITS_CPS[];
+extern const char *ALPHA_21_UPPER[];
+extern const char *ALPHA_21_LOWER[];
+extern const char *ALPHA_21_DIGITS[];
+extern const wa_freq_entry ALPHA_21_FREQ[];
+extern const wa_cp_freq ALPHA_21_FREQ_CPS[];
+extern const uint32_t ALPHA_21_UPPER_CPS[];
+extern const uint32_t ALPHA_21_LOWER_CPS[];
+extern const uint32_t ALPHA_21_DIGITS_CPS[];
+extern const char *ALPHA_22_UPPER[];
+extern const char *ALPHA_22_LOWER[];
+extern const char *ALPHA_22_DIGITS[];
+extern const wa_freq_entry ALPHA_22_FREQ[];
+extern const wa_cp_freq ALPHA_22_FREQ_CPS[];
+extern const uint32_t ALPHA_22_UPPER_CPS[];
+extern const uint32_t ALPHA_22_LOWER_CPS[];
+extern const uint32_t ALPHA_22_DIGITS_CPS[];
+extern const char *ALPHA_23_UPPER[];
+extern const char *ALPHA_23_LOWER[];
+extern const char *ALPHA_23_DIGITS[];
+extern const wa_freq_entry ALPHA_23_FREQ[];
+extern const wa_cp_freq ALPHA_23_FREQ_CPS[];
+extern const uint32_t ALPHA_23_UPPER_CPS[];
+extern const uint32_t ALPHA_23_LOWER_CPS[];
+extern const uint32_t ALPHA_23_DIGITS_CPS[];
+extern const char *ALPHA_24_UPPER[];
+extern const char *ALPHA_24_LOWER[];
+extern const char *ALPHA_24_DIGITS[];
+extern const wa_freq_entry ALPHA_24_FREQ[];
+extern const wa_cp_freq ALPHA_24_FREQ_CPS[];
+extern const uint32_t ALPHA_24_UPPER_CPS[];
+extern const uint32_t ALPHA_24_LOWER_CPS[];
+extern const uint32_t ALPHA_24_DIGITS_CPS[];
+extern const char *ALPHA_25_UPPER[];
+extern const char *ALPHA_25_LOWER[];
+extern const char *ALPHA_25_DIGITS[];
+extern const wa_freq_entry ALPHA_25_FREQ[];
+extern const wa_cp_freq ALPHA_25_FREQ_CPS[];
+extern const uint32_t ALPHA_25_UPPER_CPS[];
+extern const uint32_t ALPHA_25_LOWER_CPS[];
+extern const uint32_t ALPHA_25_DIGITS_CPS[];
+extern const char *ALPHA_26_UPPER[];
+extern const char *ALPHA_26_LOWER[];
+extern const char *ALPHA_26_DIGITS[];
+extern const wa_freq_entry ALPHA_26_FREQ[];
+extern const wa_cp_freq ALPHA_26_FREQ_CPS[];
+extern const uint32_t ALPHA_26_UPPER_CPS[];
+extern const uint32_t ALPHA_26_LOWER_CPS[];
+extern const uint32_t ALPHA_26_DIGITS_CPS[];
+extern const char *ALPHA_27_UPPER[];
+extern const char *ALPHA_27_LOWER[];
+extern const char *ALPHA_27_DIGITS[];
+extern const wa_freq_entry ALPHA_27_FREQ[];
+extern const wa_cp_freq ALPHA_27_FREQ_CPS[];
+extern const uint32_t ALPHA_27_UPPER_CPS[];
+extern const uint32_t ALPHA_27_LOWER_CPS[];
+extern const uint32_t ALPHA_27_DIGITS_CPS[];
+extern const char *ALPHA_28_UPPER[];
+extern const char *ALPHA_28_LOWER[];
+extern const char *ALPHA_28_DIGITS[];
+extern const wa_freq_entry ALPHA_28_FREQ[];
+extern const wa_cp_freq ALPHA_28_FREQ_CPS[];
+extern const uint32_t ALPHA_28_UPPER_CPS[];
+extern const uint32_t ALPHA_28_LOWER_CPS[];
+extern const uint32_t ALPHA_28_DIGITS_CPS[];
+extern const char *ALPHA_29_UPPER[];
+extern const char *ALPHA_29_LOWER[];
+extern const char *ALPHA_29_DIGITS[];
+extern const wa_freq_entry ALPHA_29_FREQ[];
+extern const wa_cp_freq ALPHA_29_FREQ_CPS[];
+extern const uint32_t ALPHA_29_UPPER_CPS[];
+extern const uint32_t ALPHA_29_LOWER_CPS[];
+extern const uint32_t ALPHA_29_DIGITS_CPS[];
+extern const char *ALPHA_30_UPPER[];
+extern const char *ALPHA_30_LOWER[];
+extern const char *ALPHA_30_DIGITS[];
+extern const wa_freq_entry ALPHA_30_FREQ[];
+extern const wa_cp_freq ALPHA_30_FREQ_CPS[];
+extern const uint32_t ALPHA_30_UPPER_CPS[];
+extern const uint32_t ALPHA_30_LOWER_CPS[];
+extern const uint32_t ALPHA_30_DIGITS_CPS[];
+extern const char *ALPHA_31_UPPER[];
+extern const char *ALPHA_31_LOWER[];
+extern const char *ALPHA_31_DIGITS[];
+extern const wa_freq_entry ALPHA_31_FREQ[];
+extern const wa_cp_freq ALPHA_31_FREQ_CPS[];
+extern const uint32_t ALPHA_31_UPPER_CPS[];
+extern const uint32_t ALPHA_31_LOWER_CPS[];
+extern const uint32_t ALPHA_31_DIGITS_CPS[];
+extern const char *ALPHA_32_UPPER[];
+extern const char *ALPHA_32_LOWER[];
+extern const char *ALPHA_32_DIGITS[];
+extern const wa_freq_entry ALPHA_32_FREQ[];
+extern const wa_cp_freq ALPHA_32_FREQ_CPS[];
+extern const uint32_t ALPHA_32_UPPER_CPS[];
+extern const uint32_t ALPHA_32_LOWER_CPS[];
+extern const uint32_t ALPHA_32_DIGITS_CPS[];
+extern const char *ALPHA_33_UPPER[];
+extern const char *ALPHA_33_LOWER[];
+extern const char *ALPHA_33_DIGITS[];
+extern const wa_freq_entry ALPHA_33_FREQ[];
+extern const wa_cp_freq ALPHA_33_FREQ_CPS[];
+extern const uint32_t ALPHA_33_UPPER_CPS[];
+extern const uint32_t ALPHA_33_LOWER_CPS[];
+extern const uint32_t ALPHA_33_DIGITS_CPS[];
+extern const char *ALPHA_34_UPPER[];
+extern const char *ALPHA_34_LOWER[];
+extern const char *ALPHA_34_DIGITS[];
+extern const wa_freq_entry ALPHA_34_FREQ[];
+extern const wa_cp_freq ALPHA_34_FREQ_CPS[];
+extern const uint32_t ALPHA_34_UPPER_CPS[];
+extern const uint32_t ALPHA_34_LOWER_CPS[];
+extern const uint32_t ALPHA_34_DIGITS_CPS[];
+extern const char *ALPHA_35_UPPER[];
+extern const char *ALPHA_35_LOWER[];
+extern const char *ALPHA_35_DIGITS[];
+extern const wa_freq_entry ALPHA_35_FREQ[];
+extern const wa_cp_freq ALPHA_35_FREQ_CPS[];
+extern const uint32_t ALPHA_35_UPPER_CPS[];
+extern const uint32_t ALPHA_35_LOWER_CPS[];
+extern const uint32_t ALPHA_35_DIGITS_CPS[];
+extern const char *ALPHA_36_UPPER[];
+extern const char *ALPHA_36_LOWER[];
+extern const char *ALPHA_36_DIGITS[];
+extern const wa_freq_entry ALPHA_36_FREQ[];
+extern const wa_cp_freq ALPHA_36_FREQ_CPS[];
+extern const uint32_t ALPHA_36_UPPER_CPS[];
+extern const uint32_t ALPHA_36_LOWER_CPS[];
+extern const uint32_t ALPHA_36_DIGITS_CPS[];
+extern const char *ALPHA_37_UPPER[];
+extern const char *ALPHA_37_LOWER[];
+extern const char *ALPHA_37_DIGITS[];
+extern const wa_freq_entry ALPHA_37_FREQ[];
+extern const wa_cp_freq ALPHA_37_FREQ_CPS[];
+extern const uint32_t ALPHA_37_UPPER_CPS[];
+extern const uint32_t ALPHA_37_LOWER_CPS[];
+extern const uint32_t ALPHA_37_DIGITS_CPS[];
+extern const char *ALPHA_38_UPPER[];
+extern const char *ALPHA_38_LOWER[];
+extern const char *ALPHA_38_DIGITS[];
+extern const wa_freq_entry ALPHA_38_FREQ[];
+extern const wa_cp_freq ALPHA_38_FREQ_CPS[];
+extern const uint32_t ALPHA_38_UPPER_CPS[];
+extern const uint32_t ALPHA_38_LOWER_CPS[];
+extern const uint32_t ALPHA_38_DIGITS_CPS[];
+extern const char *ALPHA_39_UPPER[];
+extern const char *ALPHA_39_LOWER[];
+extern const char *ALPHA_39_DIGITS[];
+extern const wa_freq_entry ALPHA_39_FREQ[];
+extern const wa_cp_freq ALPHA_39_FREQ_CPS[];
+extern const uint32_t ALPHA_39_UPPER_CPS[];
+extern const uint32_t ALPHA_39_LOWER_CPS[];
+extern const uint32_t ALPHA_39_DIGITS_CPS[];
+extern const char *ALPHA_40_UPPER[];
+extern const char *ALPHA_40_LOWER[];
+extern const char *ALPHA_40_DIGITS[];
+extern const wa_freq_entry ALPHA_40_FREQ[];
+extern const wa_cp_freq ALPHA_40_FREQ_CPS[];
+extern const uint32_t ALPHA_40_UPPER_CPS[];
+extern const uint32_t ALPHA_40_LOWER_CPS[];
+extern const uint32_t ALPHA_40_DIGITS_CPS[];
+extern const char *ALPHA_41_UPPER[];
+extern const char *ALPHA_41_LOWER[];
+extern const char *ALPHA_41_DIGITS[];
+extern const wa_freq_entry ALPHA_41_FREQ[];
+extern const wa_cp_freq ALPHA_41_FREQ_CPS[];
+extern const uint32_t ALPHA_41_UPPER_CPS[];
+extern const uint32_t ALPHA_41_LOWER_CPS[];
+extern const uint32_t ALPHA_41_DIGITS_CPS[];
+extern const char *ALPHA_42_UPPER[];
+extern const char *ALPHA_42_LOWER[];
+extern const char *ALPHA_42_DIGITS[];
+extern const wa_freq_entry ALPHA_42_FREQ[];
+extern const wa_cp_freq ALPHA_42_FREQ_CPS[];
+extern const uint32_t ALPHA_42_UPPER_CPS[];
+extern const uint32_t ALPHA_42_LOWER_CPS[];
+extern const uint32_t ALPHA_42_DIGITS_CPS[];
+extern const char *ALPHA_43_UPPER[];
+extern const char *ALPHA_43_LOWER[];
+extern const char *ALPHA_43_DIGITS[];
+extern const wa_freq_entry ALPHA_43_FREQ[];
+extern const wa_cp_freq ALPHA_43_FREQ_CPS[];
+extern const uint32_t ALPHA_43_UPPER_CPS[];
+extern const uint32_t ALPHA_43_LOWER_CPS[];
+extern const uint32_t ALPHA_43_DIGITS_CPS[];
+extern const char *ALPHA_44_UPPER[];
+extern const char *ALPHA_44_LOWER[];
+extern const char *ALPHA_44_DIGITS[];
+extern const wa_freq_entry ALPHA_44_FREQ[];
+extern const wa_cp_freq ALPHA_44_FREQ_CPS[];
+extern const uint32_t ALPHA_44_UPPER_CPS[];
+extern const uint32_t ALPHA_44_LOWER_CPS[];
+extern const uint32_t ALPHA_44_DIGITS_CPS[];
+extern const char *ALPHA_45_UPPER[];
+extern const char *ALPHA_45_LOWER[];
+extern const char *ALPHA_45_DIGITS[];
+extern const wa_freq_entry ALPHA_45_FREQ[];
+extern const wa_cp_freq ALPHA_45_FREQ_CPS[];
+extern const uint32_t ALPHA_45_UPPER_CPS[];
+extern const uint32_t ALPHA_45_LOWER_CPS[];
+extern const uint32_t ALPHA_45_DIGITS_CPS[];
+extern const char *ALPHA_46_UPPER[];
+extern const char *ALPHA_46_LOWER[];
+extern const char *ALPHA_46_DIGITS[];
+extern const wa_freq_entry ALPHA_46_FREQ[];
+extern const wa_cp_freq ALPHA_46_FREQ_CPS[];
+extern const uint32_t ALPHA_46_UPPER_CPS[];
+extern const uint32_t ALPHA_46_LOWER_CPS[];
+extern const uint32_t ALPHA_46_DIGITS_CPS[];
+extern const char *ALPHA_47_UPPER[];
+extern const char *ALPHA_47_LOWER[];
+extern const char *ALPHA_47_DIGITS[];
+extern const wa_freq_entry ALPHA_47_FREQ[];
+extern const wa_cp_freq ALPHA_47_FREQ_CPS[];
+extern const uint32_t ALPHA_47_UPPER_CPS[];
+extern const uint32_t ALPHA_47_LOWER_CPS[];
+extern const uint32_t ALPHA_47_DIGITS_CPS[];
+extern const char *ALPHA_48_UPPER[];
+extern const char *ALPHA_48_LOWER[];
+extern const char *ALPHA_48_DIGITS[];
+extern const wa_freq_entry ALPHA_48_FREQ[];
+extern const wa_cp_freq ALPHA_48_FREQ_CPS[];
+extern const uint32_t ALPHA_48_UPPER_CPS[];
+extern const uint32_t ALPHA_48_LOWER_CPS[];
+extern const uint32_t ALPHA_48_DIGITS_CPS[];
+extern const char *ALPHA_49_UPPER[];
+extern const char *ALPHA_49_LOWER[];
+extern const char *ALPHA_49_DIGITS[];
+extern const wa_freq_entry ALPHA_49_FREQ[];
+extern const wa_cp_freq ALPHA_49_FREQ_CPS[];
+extern const uint32_t ALPHA_49_UPPER_CPS[];
+extern const uint32_t ALPHA_49_LOWER_CPS[];
+extern const uint32_t ALPHA_49_DIGITS_CPS[];
+extern const char *ALPHA_50_UPPER[];
+extern const char *ALPHA_50_LOWER[];
+extern const char *ALPHA_50_DIGITS[];
+extern const wa_freq_entry ALPHA_50_FREQ[];
+extern const wa_cp_freq ALPHA_50_FREQ_CPS[];
+extern const uint32_t ALPHA_50_UPPER_CPS[];
+extern const uint32_t ALPHA_50_LOWER_CPS[];
+extern const uint32_t ALPHA_50_DIGITS_CPS[];
+extern const char *ALPHA_51_UPPER[];
+extern const char *ALPHA_51_LOWER[];
+extern const char *ALPHA_51_DIGITS[];
+extern const wa_freq_entry ALPHA_51_FREQ[];
+extern const wa_cp_freq ALPHA_51_FREQ_CPS[];
+extern const uint32_t ALPHA_51_UPPER_CPS[];
+extern const uint32_t ALPHA_51_LOWER_CPS[];
+extern const uint32_t ALPHA_51_DIGITS_CPS[];
+extern const char *ALPHA_52_UPPER[];
+extern const char *ALPHA_52_LOWER[];
+extern const char *ALPHA_52_DIGITS[];
+extern const wa_freq_entry ALPHA_52_FREQ[];
+extern const wa_cp_freq ALPHA_52_FREQ_CPS[];
+extern const uint32_t ALPHA_52_UPPER_CPS[];
+extern const uint32_t ALPHA_52_LOWER_CPS[];
+extern const uint32_t ALPHA_52_DIGITS_CPS[];
+extern const char *ALPHA_53_UPPER[];
+extern const char *ALPHA_53_LOWER[];
+extern const char *ALPHA_53_DIGITS[];
+extern const wa_freq_entry ALPHA_53_FREQ[];
+extern const wa_cp_freq ALPHA_53_FREQ_CPS[];
+extern const uint32_t ALPHA_53_UPPER_CPS[];
+extern const uint32_t ALPHA_53_LOWER_CPS[];
+extern const uint32_t ALPHA_53_DIGITS_CPS[];
+extern const char *ALPHA_54_UPPER[];
+extern const char *ALPHA_54_LOWER[];
+extern const char *ALPHA_54_DIGITS[];
+extern const wa_freq_entry ALPHA_54_FREQ[];
+extern const wa_cp_freq ALPHA_54_FREQ_CPS[];
+extern const uint32_t ALPHA_54_UPPER_CPS[];
+extern const uint32_t ALPHA_54_LOWER_CPS[];
+extern const uint32_t ALPHA_54_DIGITS_CPS[];
+extern const char *ALPHA_55_UPPER[];
+extern const char *ALPHA_55_LOWER[];
+extern const char *ALPHA_55_DIGITS[];
+extern const wa_freq_entry ALPHA_55_FREQ[];
+extern const wa_cp_freq ALPHA_55_FREQ_CPS[];
+extern const uint32_t ALPHA_55_UPPER_CPS[];
+extern const uint32_t ALPHA_55_LOWER_CPS[];
+extern const uint32_t ALPHA_55_DIGITS_CPS[];
+extern const char *ALPHA_56_UPPER[];
+extern const char *ALPHA_56_LOWER[];
+extern const char *ALPHA_56_DIGITS[];
+extern const wa_freq_entry ALPHA_56_FREQ[];
+extern const wa_cp_freq ALPHA_56_FREQ_CPS[];
+extern const uint32_t ALPHA_56_UPPER_CPS[];
+extern const uint32_t ALPHA_56_LOWER_CPS[];
+extern const uint32_t ALPHA_56_DIGITS_CPS[];
+extern const char *ALPHA_57_UPPER[];
+extern const char *ALPHA_57_LOWER[];
+extern const char *ALPHA_57_DIGITS[];
+extern const wa_freq_entry ALPHA_57_FREQ[];
+extern const wa_cp_freq ALPHA_57_FREQ_CPS[];
+extern const uint32_t ALPHA_57_UPPER_CPS[];
+extern const uint32_t ALPHA_57_LOWER_CPS[];
+extern const uint32_t ALPHA_57_DIGITS_CPS[];
+extern const char *ALPHA_58_UPPER[];
+extern const char *ALPHA_58_LOWER[];
+extern const char *ALPHA_58_DIGITS[];
+extern const wa_freq_entry ALPHA_58_FREQ[];
+extern const wa_cp_freq ALPHA_58_FREQ_CPS[];
+extern const uint32_t ALPHA_58_UPPER_CPS[];
+extern const uint32_t ALPHA_58_LOWER_CPS[];
+extern const uint32_t ALPHA_58_DIGITS_CPS[];
+extern const char *ALPHA_59_UPPER[];
+extern const char *ALPHA_59_LOWER[];
+extern const char *ALPHA_59_DIGITS[];
+extern const wa_freq_entry ALPHA_59_FREQ[];
+extern const wa_cp_freq ALPHA_59_FREQ_CPS[];
+extern const uint32_t ALPHA_59_UPPER_CPS[];
+extern const uint32_t ALPHA_59_LOWER_CPS[];
+extern const uint32_t ALPHA_59_DIGITS_CPS[];
+extern const char *ALPHA_60_UPPER[];
+extern const char *ALPHA_60_LOWER[];
+extern const char *ALPHA_60_DIGITS[];
+extern const wa_freq_entry ALPHA_60_FREQ[];
+extern const wa_cp_freq ALPHA_60_FREQ_CPS[];
+extern const uint32_t ALPHA_60_UPPER_CPS[];
+extern const uint32_t ALPHA_60_LOWER_CPS[];
+extern const uint32_t ALPHA_60_DIGITS_CPS[];
+extern const char *ALPHA_61_UPPER[];
+extern const char *ALPHA_61_LOWER[];
+extern const char *ALPHA_61_DIGITS[];
+extern const wa_freq_entry ALPHA_61_FREQ[];
+extern const wa_cp_freq ALPHA_61_FREQ_CPS[];
+extern const uint32_t ALPHA_61_UPPER_CPS[];
+extern const uint32_t ALPHA_61_LOWER_CPS[];
+extern const uint32_t ALPHA_61_DIGITS_CPS[];
+extern const char *ALPHA_62_UPPER[];
+extern const char *ALPHA_62_LOWER[];
+extern const char *ALPHA_62_DIGITS[];
+extern const wa_freq_entry ALPHA_62_FREQ[];
+extern const wa_cp_freq ALPHA_62_FREQ_CPS[];
+extern const uint32_t ALPHA_62_UPPER_CPS[];
+extern const uint32_t ALPHA_62_LOWER_CPS[];
+extern const uint32_t ALPHA_62_DIGITS_CPS[];
+extern const char *ALPHA_63_UPPER[];
+extern const char *ALPHA_63_LOWER[];
+extern const char *ALPHA_63_DIGITS[];
+extern const wa_freq_entry ALPHA_63_FREQ[];
+extern const wa_cp_freq ALPHA_63_FREQ_CPS[];
+extern const uint32_t ALPHA_63_UPPER_CPS[];
+extern const uint32_t ALPHA_63_LOWER_CPS[];
+extern const uint32_t ALPHA_63_DIGITS_CPS[];
+extern const char *ALPHA_64_UPPER[];
+extern const char *ALPHA_64_LOWER[];
+extern const char *ALPHA_64_DIGITS[];
+extern const wa_freq_entry ALPHA_64_FREQ[];
+extern const wa_cp_freq ALPHA_64_FREQ_CPS[];
+extern const uint32_t ALPHA_64_UPPER_CPS[];
+extern const uint32_t ALPHA_64_LOWER_CPS[];
+extern const uint32_t ALPHA_64_DIGITS_CPS[];
+extern const char *ALPHA_65_UPPER[];
+extern const char *ALPHA_65_LOWER[];
+extern const char *ALPHA_65_DIGITS[];
+extern const wa_freq_entry ALPHA_65_FREQ[];
+extern const wa_cp_freq ALPHA_65_FREQ_CPS[];
+extern const uint32_t ALPHA_65_UPPER_CPS[];
+extern const uint32_t ALPHA_65_LOWER_CPS[];
+extern const uint32_t ALPHA_65_DIGITS_CPS[];
+extern const char *ALPHA_66_UPPER[];
+extern const char *ALPHA_66_LOWER[];
+extern const char *ALPHA_66_DIGITS[];
+extern const wa_freq_entry ALPHA_66_FREQ[];
+extern const wa_cp_freq ALPHA_66_FREQ_CPS[];
+extern const uint32_t ALPHA_66_UPPER_CPS[];
+extern const uint32_t ALPHA_66_LOWER_CPS[];
+extern const uint32_t ALPHA_66_DIGITS_CPS[];
+extern const char *ALPHA_67_UPPER[];
+extern const char *ALPHA_67_LOWER[];
+extern const char *ALPHA_67_DIGITS[];
+extern const wa_freq_entry ALPHA_67_FREQ[];
+extern const wa_cp_freq ALPHA_67_FREQ_CPS[];
+extern const uint32_t ALPHA_67_UPPER_CPS[];
+extern const uint32_t ALPHA_67_LOWER_CPS[];
+extern const uint32_t ALPHA_67_DIGITS_CPS[];
+extern const char *ALPHA_68_UPPER[];
+extern const char *ALPHA_68_LOWER[];
+extern const char *ALPHA_68_DIGITS[];
+extern const wa_freq_entry ALPHA_68_FREQ[];
+extern const wa_cp_freq ALPHA_68_FREQ_CPS[];
+extern const uint32_t ALPHA_68_UPPER_CPS[];
+extern const uint32_t ALPHA_68_LOWER_CPS[];
+extern const uint32_t ALPHA_68_DIGITS_CPS[];
+extern const char *ALPHA_69_UPPER[];
+extern const char *ALPHA_69_LOWER[];
+extern const char *ALPHA_69_DIGITS[];
+extern const wa_freq_entry ALPHA_69_FREQ[];
+extern const wa_cp_freq ALPHA_69_FREQ_CPS[];
+extern const uint32_t ALPHA_69_UPPER_CPS[];
+extern const uint32_t ALPHA_69_LOWER_CPS[];
+extern const uint32_t ALPHA_69_DIGITS_CPS[];
+extern const char *ALPHA_70_UPPER[];
+extern const char *ALPHA_70_LOWER[];
+extern const char *ALPHA_70_DIGITS[];
+extern const wa_freq_entry ALPHA_70_FREQ[];
+extern const wa_cp_freq ALPHA_70_FREQ_CPS[];
+extern const uint32_t ALPHA_70_UPPER_CPS[];
+extern const uint32_t ALPHA_70_LOWER_CPS[];
+extern const uint32_t ALPHA_70_DIGITS_CPS[];
+extern const char *ALPHA_71_UPPER[];
+extern const char *ALPHA_71_LOWER[];
+extern const char *ALPHA_71_DIGITS[];
+extern const wa_freq_entry ALPHA_71_FREQ[];
+extern const wa_cp_freq ALPHA_71_FREQ_CPS[];
+extern const uint32_t ALPHA_71_UPPER_CPS[];
+extern const uint32_t ALPHA_71_LOWER_CPS[];
+extern const uint32_t ALPHA_71_DIGITS_CPS[];
+extern const char *ALPHA_72_UPPER[];
+extern const char *ALPHA_72_LOWER[];
+extern const char *ALPHA_72_DIGITS[];
+extern const wa_freq_entry ALPHA_72_FREQ[];
+extern const wa_cp_freq ALPHA_72_FREQ_CPS[];
+extern const uint32_t ALPHA_72_UPPER_CPS[];
+extern const uint32_t ALPHA_72_LOWER_CPS[];
+extern const uint32_t ALPHA_72_DIGITS_CPS[];
+extern const char *ALPHA_73_UPPER[];
+extern const char *ALPHA_73_LOWER[];
+extern const char *ALPHA_73_DIGITS[];
+extern const wa_freq_entry ALPHA_73_FREQ[];
+extern const wa_cp_freq ALPHA_73_FREQ_CPS[];
+extern const uint32_t ALPHA_73_UPPER_CPS[];
+extern const uint32_t ALPHA_73_LOWER_CPS[];
+extern const uint32_t ALPHA_73_DIGITS_CPS[];
+extern const char *ALPHA_74_UPPER[];
+extern const char *ALPHA_74_LOWER[];
+extern const char *ALPHA_74_DIGITS[];
+extern const wa_freq_entry ALPHA_74_FREQ[];
+extern const wa_cp_freq ALPHA_74_FREQ_CPS[];
+extern const uint32_t ALPHA_74_UPPER_CPS[];
+extern const uint32_t ALPHA_74_LOWER_CPS[];
+extern const uint32_t ALPHA_74_DIGITS_CPS[];
+extern const char *ALPHA_75_UPPER[];
+extern const char *ALPHA_75_LOWER[];
+extern const char *ALPHA_75_DIGITS[];
+extern const wa_freq_entry ALPHA_75_FREQ[];
+extern const wa_cp_freq ALPHA_75_FREQ_CPS[];
+extern const uint32_t ALPHA_75_UPPER_CPS[];
+extern const uint32_t ALPHA_75_LOWER_CPS[];
+extern const uint32_t ALPHA_75_DIGITS_CPS[];
+extern const char *ALPHA_76_UPPER[];
+extern const char *ALPHA_76_LOWER[];
+extern const char *ALPHA_76_DIGITS[];
+extern const wa_freq_entry ALPHA_76_FREQ[];
+extern const wa_cp_freq ALPHA_76_FREQ_CPS[];
+extern const uint32_t ALPHA_76_UPPER_CPS[];
+extern const uint32_t ALPHA_76_LOWER_CPS[];
+extern const uint32_t ALPHA_76_DIGITS_CPS[];
+extern const char *ALPHA_77_UPPER[];
+extern const char *ALPHA_77_LOWER[];
+extern const char *ALPHA_77_DIGITS[];
+extern const wa_freq_entry ALPHA_77_FREQ[];
+extern const wa_cp_freq ALPHA_77_FREQ_CPS[];
+extern const uint32_t ALPHA_77_UPPER_CPS[];
+extern const uint32_t ALPHA_77_LOWER_CPS[];
+extern const uint32_t ALPHA_77_DIGITS_CPS[];
+extern const char *ALPHA_78_UPPER[];
+extern const char *ALPHA_78_LOWER[];
+extern const char *ALPHA_78_DIGITS[];
+extern const wa_freq_entry ALPHA_78_FREQ[];
+extern const wa_cp_freq ALPHA_78_FREQ_CPS[];
+extern const uint32_t ALPHA_78_UPPER_CPS[];
+extern const uint32_t ALPHA_78_LOWER_CPS[];
+extern const uint32_t ALPHA_78_DIGITS_CPS[];
+extern const char *ALPHA_79_UPPER[];
+extern const char *ALPHA_79_LOWER[];
+extern const char *ALPHA_79_DIGITS[];
+extern const wa_freq_entry ALPHA_79_FREQ[];
+extern const wa_cp_freq ALPHA_79_FREQ_CPS[];
+extern const uint32_t ALPHA_79_UPPER_CPS[];
+extern const uint32_t ALPHA_79_LOWER_CPS[];
+extern const uint32_t ALPHA_79_DIGITS_CPS[];
+extern const char *ALPHA_80_UPPER[];
+extern const char *ALPHA_80_LOWER[];
+extern const char *ALPHA_80_DIGITS[];
+extern const wa_freq_entry ALPHA_80_FREQ[];
+extern const wa_cp_freq ALPHA_80_FREQ_CPS[];
+extern const uint32_t ALPHA_80_UPPER_CPS[];
+extern const uint32_t ALPHA_80_LOWER_CPS[];
+extern const uint32_t ALPHA_80_DIGITS_CPS[];
+extern const char *ALPHA_81_UPPER[];
+extern const char *ALPHA_81_LOWER[];
+extern const char *ALPHA_81_DIGITS[];
+extern const wa_freq_entry ALPHA_81_FREQ[];
+extern const wa_cp_freq ALPHA_81_FREQ_CPS[];
+extern const uint32_t ALPHA_81_UPPER_CPS[];
+extern const uint32_t ALPHA_81_LOWER_CPS[];
+extern const uint32_t ALPHA_81_DIGITS_CPS[];
+extern const char *ALPHA_82_UPPER[];
+extern const char *ALPHA_82_LOWER[];
+extern const char *ALPHA_82_DIGITS[];
+extern const wa_freq_entry ALPHA_82_FREQ[];
+extern const wa_cp_freq ALPHA_82_FREQ_CPS[];
+extern const uint32_t ALPHA_82_UPPER_CPS[];
+extern const uint32_t ALPHA_82_LOWER_CPS[];
+extern const uint32_t ALPHA_82_DIGITS_CPS[];
+extern const char *ALPHA_83_UPPER[];
+extern const char *ALPHA_83_LOWER[];
+extern const char *ALPHA_83_DIGITS[];
+extern const wa_freq_entry ALPHA_83_FREQ[];
+extern const wa_cp_freq ALPHA_83_FREQ_CPS[];
+extern const uint32_t ALPHA_83_UPPER_CPS[];
+extern const uint32_t ALPHA_83_LOWER_CPS[];
+extern const uint32_t ALPHA_83_DIGITS_CPS[];
+extern const char *ALPHA_84_UPPER[];
+extern const char *ALPHA_84_LOWER[];
+extern const char *ALPHA_84_DIGITS[];
+extern const wa_freq_entry ALPHA_84_FREQ[];
+extern const wa_cp_freq ALPHA_84_FREQ_CPS[];
+extern const uint32_t ALPHA_84_UPPER_CPS[];
+extern const uint32_t ALPHA_84_LOWER_CPS[];
+extern const uint32_t ALPHA_84_DIGITS_CPS[];
+extern const char *ALPHA_85_UPPER[];
+extern const char *ALPHA_85_LOWER[];
+extern const char *ALPHA_85_DIGITS[];
+extern const wa_freq_entry ALPHA_85_FREQ[];
+extern const wa_cp_freq ALPHA_85_FREQ_CPS[];
+extern const uint32_t ALPHA_85_UPPER_CPS[];
+extern const uint32_t ALPHA_85_LOWER_CPS[];
+extern const uint32_t ALPHA_85_DIGITS_CPS[];
+extern const char *ALPHA_86_UPPER[];
+extern const char *ALPHA_86_LOWER[];
+extern const char *ALPHA_86_DIGITS[];
+extern const wa_freq_entry ALPHA_86_FREQ[];
+extern const wa_cp_freq ALPHA_86_FREQ_CPS[];
+extern const uint32_t ALPHA_86_UPPER_CPS[];
+extern const uint32_t ALPHA_86_LOWER_CPS[];
+extern const uint32_t ALPHA_86_DIGITS_CPS[];
+extern const char *ALPHA_87_UPPER[];
+extern const char *ALPHA_87_LOWER[];
+extern const char *ALPHA_87_DIGITS[];
+extern const wa_freq_entry ALPHA_87_FREQ[];
+extern const wa_cp_freq ALPHA_87_FREQ_CPS[];
+extern const uint32_t ALPHA_87_UPPER_CPS[];
+extern const uint32_t ALPHA_87_LOWER_CPS[];
+extern const uint32_t ALPHA_87_DIGITS_CPS[];
+extern const char *ALPHA_88_UPPER[];
+extern const char *ALPHA_88_LOWER[];
+extern const char *ALPHA_88_DIGITS[];
+extern const wa_freq_entry ALPHA_88_FREQ[];
+extern const wa_cp_freq ALPHA_88_FREQ_CPS[];
+extern const uint32_t ALPHA_88_UPPER_CPS[];
+extern const uint32_t ALPHA_88_LOWER_CPS[];
+extern const uint32_t ALPHA_88_DIGITS_CPS[];
+extern const char *ALPHA_89_UPPER[];
+extern const char *ALPHA_89_LOWER[];
+extern const char *ALPHA_89_DIGITS[];
+extern const wa_freq_entry ALPHA_89_FREQ[];
+extern const wa_cp_freq ALPHA_89_FREQ_CPS[];
+extern const uint32_t ALPHA_89_UPPER_CPS[];
+extern const uint32_t ALPHA_89_LOWER_CPS[];
+extern const uint32_t ALPHA_89_DIGITS_CPS[];
+extern const char *ALPHA_90_UPPER[];
+extern const char *ALPHA_90_LOWER[];
+extern const char *ALPHA_90_DIGITS[];
+extern const wa_freq_entry ALPHA_90_FREQ[];
+extern const wa_cp_freq ALPHA_90_FREQ_CPS[];
+extern const uint32_t ALPHA_90_UPPER_CPS[];
+extern const uint32_t ALPHA_90_LOWER_CPS[];
+extern const uint32_t ALPHA_90_DIGITS_CPS[];
+extern const char *ALPHA_91_UPPER[];
+extern const char *ALPHA_91_LOWER[];
+extern const char *ALPHA_91_DIGITS[];
+extern const wa_freq_entry ALPHA_91_FREQ[];
+extern const wa_cp_freq ALPHA_91_FREQ_CPS[];
+extern const uint32_t ALPHA_91_UPPER_CPS[];
+extern const uint32_t ALPHA_91_LOWER_CPS[];
+extern const uint32_t ALPHA_91_DIGITS_CPS[];
+extern const char *ALPHA_92_UPPER[];
+extern const char *ALPHA_92_LOWER[];
+extern const char *ALPHA_92_DIGITS[];
+extern const wa_freq_entry ALPHA_92_FREQ[];
+extern const wa_cp_freq ALPHA_92_FREQ_CPS[];
+extern const uint32_t ALPHA_92_UPPER_CPS[];
+extern const uint32_t ALPHA_92_LOWER_CPS[];
+extern const uint32_t ALPHA_92_DIGITS_CPS[];
+extern const char *ALPHA_93_UPPER[];
+extern const char *ALPHA_93_LOWER[];
+extern const char *ALPHA_93_DIGITS[];
+extern const wa_freq_entry ALPHA_93_FREQ[];
+extern const wa_cp_freq ALPHA_93_FREQ_CPS[];
+extern const uint32_t ALPHA_93_UPPER_CPS[];
+extern const uint32_t ALPHA_93_LOWER_CPS[];
+extern const uint32_t ALPHA_93_DIGITS_CPS[];
+extern const char *ALPHA_94_UPPER[];
+extern const char *ALPHA_94_LOWER[];
+extern const char *ALPHA_94_DIGITS[];
+extern const wa_freq_entry ALPHA_94_FREQ[];
+extern const wa_cp_freq ALPHA_94_FREQ_CPS[];
+extern const uint32_t ALPHA_94_UPPER_CPS[];
+extern const uint32_t ALPHA_94_LOWER_CPS[];
+extern const uint32_t ALPHA_94_DIGITS_CPS[];
+extern const char *ALPHA_95_UPPER[];
+extern const char *ALPHA_95_LOWER[];
+extern const char *ALPHA_95_DIGITS[];
+extern const wa_freq_entry ALPHA_95_FREQ[];
+extern const wa_cp_freq ALPHA_95_FREQ_CPS[];
+extern const uint32_t ALPHA_95_UPPER_CPS[];
+extern const uint32_t ALPHA_95_LOWER_CPS[];
+extern const uint32_t ALPHA_95_DIGITS_CPS[];
+extern const char *ALPHA_96_UPPER[];
+extern const char *ALPHA_96_LOWER[];
+extern const char *ALPHA_96_DIGITS[];
+extern const wa_freq_entry ALPHA_96_FREQ[];
+extern const wa_cp_freq ALPHA_96_FREQ_CPS[];
+extern const uint32_t ALPHA_96_UPPER_CPS[];
+extern const uint32_t ALPHA_96_LOWER_CPS[];
+extern const uint32_t ALPHA_96_DIGITS_CPS[];
+extern const char *ALPHA_97_UPPER[];
+extern const char *ALPHA_97_LOWER[];
+extern const char *ALPHA_97_DIGITS[];
+extern const wa_freq_entry ALPHA_97_FREQ[];
+extern const wa_cp_freq ALPHA_97_FREQ_CPS[];
+extern const uint32_t ALPHA_97_UPPER_CPS[];
+extern const uint32_t ALPHA_97_LOWER_CPS[];
+extern const uint32_t ALPHA_97_DIGITS_CPS[];
+extern const char *ALPHA_98_UPPER[];
+extern const char *ALPHA_98_LOWER[];
+extern const char *ALPHA_98_DIGITS[];
+extern const wa_freq_entry ALPHA_98_FREQ[];
+extern const wa_cp_freq ALPHA_98_FREQ_CPS[];
+extern const uint32_t ALPHA_98_UPPER_CPS[];
+extern const uint32_t ALPHA_98_LOWER_CPS[];
+extern const uint32_t ALPHA_98_DIGITS_CPS[];
+extern const char *ALPHA_99_UPPER[];
+extern const char *ALPHA_99_LOWER[];
+extern const char *ALPHA_99_DIGITS[];
+extern const wa_freq_entry ALPHA_99_FREQ[];
+extern const wa_cp_freq ALPHA_99_FREQ_CPS[];
+extern const uint32_t ALPHA_99_UPPER_CPS[];
+extern const uint32_t ALPHA_99_LOWER_CPS[];
+extern const uint32_t ALPHA_99_DIGITS_CPS[];
+extern const char *ALPHA_100_UPPER[];
+extern const char *ALPHA_100_LOWER[];
+extern const char *ALPHA_100_DIGITS[];
+extern const wa_freq_entry ALPHA_100_FREQ[];
+extern const wa_cp_freq ALPHA_100_FREQ_CPS[];
+extern const uint32_t ALPHA_100_UPPER_CPS[];
+extern const uint32_t ALPHA_100_LOWER_CPS[];
+extern const uint32_t ALPHA_100_DIGITS_CPS[];
+extern const char *ALPHA_101_UPPER[];
+extern const char *ALPHA_101_LOWER[];
+extern const char *ALPHA_101_DIGITS[];
+extern const wa_freq_entry ALPHA_101_FREQ[];
+extern const wa_cp_freq ALPHA_101_FREQ_CPS[];
+extern const uint32_t ALPHA_101_UPPER_CPS[];
+extern const uint32_t ALPHA_101_LOWER_CPS[];
+extern const uint32_t ALPHA_101_DIGITS_CPS[];
+extern const char *ALPHA_102_UPPER[];
+extern const char *ALPHA_102_LOWER[];
+extern const char *ALPHA_102_DIGITS[];
+extern const wa_freq_entry ALPHA_102_FREQ[];
+extern const wa_cp_freq ALPHA_102_FREQ_CPS[];
+extern const uint32_t ALPHA_102_UPPER_CPS[];
+extern const uint32_t ALPHA_102_LOWER_CPS[];
+extern const uint32_t ALPHA_102_DIGITS_CPS[];
+extern const char *ALPHA_103_UPPER[];
+extern const char *ALPHA_103_LOWER[];
+extern const char *ALPHA_103_DIGITS[];
+extern const wa_freq_entry ALPHA_103_FREQ[];
+extern const wa_cp_freq ALPHA_103_FREQ_CPS[];
+extern const uint32_t ALPHA_103_UPPER_CPS[];
+extern const uint32_t ALPHA_103_LOWER_CPS[];
+extern const uint32_t ALPHA_103_DIGITS_CPS[];
+extern const char *ALPHA_104_UPPER[];
+extern const char *ALPHA_104_LOWER[];
+extern const char *ALPHA_104_DIGITS[];
+extern const wa_freq_entry ALPHA_104_FREQ[];
+extern const wa_cp_freq ALPHA_104_FREQ_CPS[];
+extern const uint32_t ALPHA_104_UPPER_CPS[];
+extern const uint32_t ALPHA_104_LOWER_CPS[];
+extern const uint32_t ALPHA_104_DIGITS_CPS[];
+extern const char *ALPHA_105_UPPER[];
+extern const char *ALPHA_105_LOWER[];
+extern const char *ALPHA_105_DIGITS[];
+extern const wa_freq_entry ALPHA_105_FREQ[];
+extern const wa_cp_freq ALPHA_105_FREQ_CPS[];
+extern const uint32_t ALPHA_105_UPPER_CPS[];
+extern const uint32_t ALPHA_105_LOWER_CPS[];
+extern const uint32_t ALPHA_105_DIGITS_CPS[];
+extern const char *ALPHA_106_UPPER[];
+extern const char *ALPHA_106_LOWER[];
+extern const char *ALPHA_106_DIGITS[];
+extern const wa_freq_entry ALPHA_106_FREQ[];
+extern const wa_cp_freq ALPHA_106_FREQ_CPS[];
+extern const uint32_t ALPHA_106_UPPER_CPS[];
+extern const uint32_t ALPHA_106_LOWER_CPS[];
+extern const uint32_t ALPHA_106_DIGITS_CPS[];
+extern const char *ALPHA_107_UPPER[];
+extern const char *ALPHA_107_LOWER[];
+extern const char *ALPHA_107_DIGITS[];
+extern const wa_freq_entry ALPHA_107_FREQ[];
+extern const wa_cp_freq ALPHA_107_FREQ_CPS[];
+extern const uint32_t ALPHA_107_UPPER_CPS[];
+extern const uint32_t ALPHA_107_LOWER_CPS[];
+extern const uint32_t ALPHA_107_DIGITS_CPS[];
+extern const char *ALPHA_108_UPPER[];
+extern const char *ALPHA_108_LOWER[];
+extern const char *ALPHA_108_DIGITS[];
+extern const wa_freq_entry ALPHA_108_FREQ[];
+extern const wa_cp_freq ALPHA_108_FREQ_CPS[];
+extern const uint32_t ALPHA_108_UPPER_CPS[];
+extern const uint32_t ALPHA_108_LOWER_CPS[];
+extern const uint32_t ALPHA_108_DIGITS_CPS[];
+extern const char *ALPHA_109_UPPER[];
+extern const char *ALPHA_109_LOWER[];
+extern const char *ALPHA_109_DIGITS[];
+extern const wa_freq_entry ALPHA_109_FREQ[];
+extern const wa_cp_freq ALPHA_109_FREQ_CPS[];
+extern const uint32_t ALPHA_109_UPPER_CPS[];
+extern const uint32_t ALPHA_109_LOWER_CPS[];
+extern const uint32_t ALPHA_109_DIGITS_CPS[];
+extern const char *ALPHA_110_UPPER[];
+extern const char *ALPHA_110_LOWER[];
+extern const char *ALPHA_110_DIGITS[];
+extern const wa_freq_entry ALPHA_110_FREQ[];
+extern const wa_cp_freq ALPHA_110_FREQ_CPS[];
+extern const uint32_t ALPHA_110_UPPER_CPS[];
+extern const uint32_t ALPHA_110_LOWER_CPS[];
+extern const uint32_t ALPHA_110_DIGITS_CPS[];
+extern const char *ALPHA_111_UPPER[];
+extern const char *ALPHA_111_LOWER[];
+extern const char *ALPHA_111_DIGITS[];
+extern const wa_freq_entry ALPHA_111_FREQ[];
+extern const wa_cp_freq ALPHA_111_FREQ_CPS[];
+extern const uint32_t ALPHA_111_UPPER_CPS[];
+extern const uint32_t ALPHA_111_LOWER_CPS[];
+extern const uint32_t ALPHA_111_DIGITS_CPS[];
+extern const char *ALPHA_112_UPPER[];
+extern const char *ALPHA_112_LOWER[];
+extern const char *ALPHA_112_DIGITS[];
+extern const wa_freq_entry ALPHA_112_FREQ[];
+extern const wa_cp_freq ALPHA_112_FREQ_CPS[];
+extern const uint32_t ALPHA_112_UPPER_CPS[];
+extern const uint32_t ALPHA_112_LOWER_CPS[];
+extern const uint32_t ALPHA_112_DIGITS_CPS[];
+extern const char *ALPHA_113_UPPER[];
+extern const char *ALPHA_113_LOWER[];
+extern const char *ALPHA_113_DIGITS[];
+extern const wa_freq_entry ALPHA_113_FREQ[];
+extern const wa_cp_freq ALPHA_113_FREQ_CPS[];
+extern const uint32_t ALPHA_113_UPPER_CPS[];
+extern const uint32_t ALPHA_113_LOWER_CPS[];
+extern const uint32_t ALPHA_113_DIGITS_CPS[];
+extern const char *ALPHA_114_UPPER[];
+extern const char *ALPHA_114_LOWER[];
+extern const char *ALPHA_114_DIGITS[];
+extern const wa_freq_entry ALPHA_114_FREQ[];
+extern const wa_cp_freq ALPHA_114_FREQ_CPS[];
+extern const uint32_t ALPHA_114_UPPER_CPS[];
+extern const uint32_t ALPHA_114_LOWER_CPS[];
+extern const uint32_t ALPHA_114_DIGITS_CPS[];
+extern const char *ALPHA_115_UPPER[];
+extern const char *ALPHA_115_LOWER[];
+extern const char *ALPHA_115_DIGITS[];
+extern const wa_freq_entry ALPHA_115_FREQ[];
+extern const wa_cp_freq ALPHA_115_FREQ_CPS[];
+extern const uint32_t ALPHA_115_UPPER_CPS[];
+extern const uint32_t ALPHA_115_LOWER_CPS[];
+extern const uint32_t ALPHA_115_DIGITS_CPS[];
+extern const char *ALPHA_116_UPPER[];
+extern const char *ALPHA_116_LOWER[];
+extern const char *ALPHA_116_DIGITS[];
+extern const wa_freq_entry ALPHA_116_FREQ[];
+extern const wa_cp_freq ALPHA_116_FREQ_CPS[];
+extern const uint32_t ALPHA_116_UPPER_CPS[];
+extern const uint32_t ALPHA_116_LOWER_CPS[];
+extern const uint32_t ALPHA_116_DIGITS_CPS[];
+extern const char *ALPHA_117_UPPER[];
+extern const char *ALPHA_117_LOWER[];
+extern const char *ALPHA_117_DIGITS[];
+extern const wa_freq_entry ALPHA_117_FREQ[];
+extern const wa_cp_freq ALPHA_117_FREQ_CPS[];
+extern const uint32_t ALPHA_117_UPPER_CPS[];
+extern const uint32_t ALPHA_117_LOWER_CPS[];
+extern const uint32_t ALPHA_117_DIGITS_CPS[];
+extern const char *ALPHA_118_UPPER[];
+extern const char *ALPHA_118_LOWER[];
+extern const char *ALPHA_118_DIGITS[];
+extern const wa_freq_entry ALPHA_118_FREQ[];
+extern const wa_cp_freq ALPHA_118_FREQ_CPS[];
+extern const uint32_t ALPHA_118_UPPER_CPS[];
+extern const uint32_t ALPHA_118_LOWER_CPS[];
+extern const uint32_t ALPHA_118_DIGITS_CPS[];
+extern const char *ALPHA_119_UPPER[];
+extern const char *ALPHA_119_LOWER[];
+extern const char *ALPHA_119_DIGITS[];
+extern const wa_freq_entry ALPHA_119_FREQ[];
+extern const wa_cp_freq ALPHA_119_FREQ_CPS[];
+extern const uint32_t ALPHA_119_UPPER_CPS[];
+extern const uint32_t ALPHA_119_LOWER_CPS[];
+extern const uint32_t ALPHA_119_DIGITS_CPS[];
+extern const char *ALPHA_120_UPPER[];
+extern const char *ALPHA_120_LOWER[];
+extern const char *ALPHA_120_DIGITS[];
+extern const wa_freq_entry ALPHA_120_FREQ[];
+extern const wa_cp_freq ALPHA_120_FREQ_CPS[];
+extern const uint32_t ALPHA_120_UPPER_CPS[];
+extern const uint32_t ALPHA_120_LOWER_CPS[];
+extern const uint32_t ALPHA_120_DIGITS_CPS[];
+extern const char *ALPHA_121_UPPER[];
+extern const char *ALPHA_121_LOWER[];
+extern const char *ALPHA_121_DIGITS[];
+extern const wa_freq_entry ALPHA_121_FREQ[];
+extern const wa_cp_freq ALPHA_121_FREQ_CPS[];
+extern const uint32_t ALPHA_121_UPPER_CPS[];
+extern const uint32_t ALPHA_121_LOWER_CPS[];
+extern const uint32_t ALPHA_121_DIGITS_CPS[];
+extern const char *ALPHA_122_UPPER[];
+extern const char *ALPHA_122_LOWER[];
+extern const char *ALPHA_122_DIGITS[];
+extern const wa_freq_entry ALPHA_122_FREQ[];
+extern const wa_cp_freq ALPHA_122_FREQ_CPS[];
+extern const uint32_t ALPHA_122_UPPER_CPS[];
+extern const uint32_t ALPHA_122_LOWER_CPS[];
+extern const uint32_t ALPHA_122_DIGITS_CPS[];
+extern const char *ALPHA_123_UPPER[];
+extern const char *ALPHA_123_LOWER[];
+extern const char *ALPHA_123_DIGITS[];
+extern const wa_freq_entry ALPHA_123_FREQ[];
+extern const wa_cp_freq ALPHA_123_FREQ_CPS[];
+extern const uint32_t ALPHA_123_UPPER_CPS[];
+extern const uint32_t ALPHA_123_LOWER_CPS[];
+extern const uint32_t ALPHA_123_DIGITS_CPS[];
+extern const char *ALPHA_124_UPPER[];
+extern const char *ALPHA_124_LOWER[];
+extern const char *ALPHA_124_DIGITS[];
+extern const wa_freq_entry ALPHA_124_FREQ[];
+extern const wa_cp_freq ALPHA_124_FREQ_CPS[];
+extern const uint32_t ALPHA_124_UPPER_CPS[];
+extern const uint32_t ALPHA_124_LOWER_CPS[];
+extern const uint32_t ALPHA_124_DIGITS_CPS[];
+extern const char *ALPHA_125_UPPER[];
+extern const char *ALPHA_125_LOWER[];
+extern const char *ALPHA_125_DIGITS[];
+extern const wa_freq_entry ALPHA_125_FREQ[];
+extern const wa_cp_freq ALPHA_125_FREQ_CPS[];
+extern const uint32_t ALPHA_125_UPPER_CPS[];
+extern const uint32_t ALPHA_125_LOWER_CPS[];
+extern const uint32_t ALPHA_125_DIGITS_CPS[];
+extern const char *ALPHA_126_UPPER[];
+extern const char *ALPHA_126_LOWER[];
+extern const char *ALPHA_126_DIGITS[];
+extern const wa_freq_entry ALPHA_126_FREQ[];
+extern const wa_cp_freq ALPHA_126_FREQ_CPS[];
+extern const uint32_t ALPHA_126_UPPER_CPS[];
+extern const uint32_t ALPHA_126_LOWER_CPS[];
+extern const uint32_t ALPHA_126_DIGITS_CPS[];
+extern const char *ALPHA_127_UPPER[];
+extern const char *ALPHA_127_LOWER[];
+extern const char *ALPHA_127_DIGITS[];
+extern const wa_freq_entry ALPHA_127_FREQ[];
+extern const wa_cp_freq ALPHA_127_FREQ_CPS[];
+extern const uint32_t ALPHA_127_UPPER_CPS[];
+extern const uint32_t ALPHA_127_LOWER_CPS[];
+extern const uint32_t ALPHA_127_DIGITS_CPS[];
+extern const char *ALPHA_128_UPPER[];
+extern const char *ALPHA_128_LOWER[];
+extern const char *ALPHA_128_DIGITS[];
+extern const wa_freq_entry ALPHA_128_FREQ[];
+extern const wa_cp_freq ALPHA_128_FREQ_CPS[];
+extern const uint32_t ALPHA_128_UPPER_CPS[];
+extern const uint32_t ALPHA_128_LOWER_CPS[];
+extern const uint32_t ALPHA_128_DIGITS_CPS[];
+extern const char *ALPHA_129_UPPER[];
+extern const char *ALPHA_129_LOWER[];
+extern const char *ALPHA_129_DIGITS[];
+extern const wa_freq_entry ALPHA_129_FREQ[];
+extern const wa_cp_freq ALPHA_129_FREQ_CPS[];
+extern const uint32_t ALPHA_129_UPPER_CPS[];
+extern const uint32_t ALPHA_129_LOWER_CPS[];
+extern const uint32_t ALPHA_129_DIGITS_CPS[];
+extern const char *ALPHA_130_UPPER[];
+extern const char *ALPHA_130_LOWER[];
+extern const char *ALPHA_130_DIGITS[];
+extern const wa_freq_entry ALPHA_130_FREQ[];
+extern const wa_cp_freq ALPHA_130_FREQ_CPS[];
+extern const uint32_t ALPHA_130_UPPER_CPS[];
+extern const uint32_t ALPHA_130_LOWER_CPS[];
+extern const uint32_t ALPHA_130_DIGITS_CPS[];
+extern const char *ALPHA_131_UPPER[];
+extern const char *ALPHA_131_LOWER[];
+extern const char *ALPHA_131_DIGITS[];
+extern const wa_freq_entry ALPHA_131_FREQ[];
+extern const wa_cp_freq ALPHA_131_FREQ_CPS[];
+extern const uint32_t ALPHA_131_UPPER_CPS[];
+extern const uint32_t ALPHA_131_LOWER_CPS[];
+extern const uint32_t ALPHA_131_DIGITS_CPS[];
+extern const char *ALPHA_132_UPPER[];
+extern const char *ALPHA_132_LOWER[];
+extern const char *ALPHA_132_DIGITS[];
+extern const wa_freq_entry ALPHA_132_FREQ[];
+extern const wa_cp_freq ALPHA_132_FREQ_CPS[];
+extern const uint32_t ALPHA_132_UPPER_CPS[];
+extern const uint32_t ALPHA_132_LOWER_CPS[];
+extern const uint32_t ALPHA_132_DIGITS_CPS[];
+extern const char *ALPHA_133_UPPER[];
+extern const char *ALPHA_133_LOWER[];
+extern const char *ALPHA_133_DIGITS[];
+extern const wa_freq_entry ALPHA_133_FREQ[];
+extern const wa_cp_freq ALPHA_133_FREQ_CPS[];
+extern const uint32_t ALPHA_133_UPPER_CPS[];
+extern const uint32_t ALPHA_133_LOWER_CPS[];
+extern const uint32_t ALPHA_133_DIGITS_CPS[];
+extern const char *ALPHA_134_UPPER[];
+extern const char *ALPHA_134_LOWER[];
+extern const char *ALPHA_134_DIGITS[];
+extern const wa_freq_entry ALPHA_134_FREQ[];
+extern const wa_cp_freq ALPHA_134_FREQ_CPS[];
+extern const uint32_t ALPHA_134_UPPER_CPS[];
+extern const uint32_t ALPHA_134_LOWER_CPS[];
+extern const uint32_t ALPHA_134_DIGITS_CPS[];
+extern const char *ALPHA_135_UPPER[];
+extern const char *ALPHA_135_LOWER[];
+extern const char *ALPHA_135_DIGITS[];
+extern const wa_freq_entry ALPHA_135_FREQ[];
+extern const wa_cp_freq ALPHA_135_FREQ_CPS[];
+extern const uint32_t ALPHA_135_UPPER_CPS[];
+extern const uint32_t ALPHA_135_LOWER_CPS[];
+extern const uint32_t ALPHA_135_DIGITS_CPS[];
+extern const char *ALPHA_136_UPPER[];
+extern const char *ALPHA_136_LOWER[];
+extern const char *ALPHA_136_DIGITS[];
+extern const wa_freq_entry ALPHA_136_FREQ[];
+extern const wa_cp_freq ALPHA_136_FREQ_CPS[];
+extern const uint32_t ALPHA_136_UPPER_CPS[];
+extern const uint32_t ALPHA_136_LOWER_CPS[];
+extern const uint32_t ALPHA_136_DIGITS_CPS[];
+extern const char *ALPHA_137_UPPER[];
+extern const char *ALPHA_137_LOWER[];
+extern const char *ALPHA_137_DIGITS[];
+extern const wa_freq_entry ALPHA_137_FREQ[];
+extern const wa_cp_freq ALPHA_137_FREQ_CPS[];
+extern const uint32_t ALPHA_137_UPPER_CPS[];
+extern const uint32_t ALPHA_137_LOWER_CPS[];
+extern const uint32_t ALPHA_137_DIGITS_CPS[];
+extern const char *ALPHA_138_UPPER[];
+extern const char *ALPHA_138_LOWER[];
+extern const char *ALPHA_138_DIGITS[];
+extern const wa_freq_entry ALPHA_138_FREQ[];
+extern const wa_cp_freq ALPHA_138_FREQ_CPS[];
+extern const uint32_t ALPHA_138_UPPER_CPS[];
+extern const uint32_t ALPHA_138_LOWER_CPS[];
+extern const uint32_t ALPHA_138_DIGITS_CPS[];
+extern const char *ALPHA_139_UPPER[];
+extern const char *ALPHA_139_LOWER[];
+extern const char *ALPHA_139_DIGITS[];
+extern const wa_freq_entry ALPHA_139_FREQ[];
+extern const wa_cp_freq ALPHA_139_FREQ_CPS[];
+extern const uint32_t ALPHA_139_UPPER_CPS[];
+extern const uint32_t ALPHA_139_LOWER_CPS[];
+extern const uint32_t ALPHA_139_DIGITS_CPS[];
+extern const char *ALPHA_140_UPPER[];
+extern const char *ALPHA_140_LOWER[];
+extern const char *ALPHA_140_DIGITS[];
+extern const wa_freq_entry ALPHA_140_FREQ[];
+extern const wa_cp_freq ALPHA_140_FREQ_CPS[];
+extern const uint32_t ALPHA_140_UPPER_CPS[];
+extern const uint32_t ALPHA_140_LOWER_CPS[];
+extern const uint32_t ALPHA_140_DIGITS_CPS[];
+extern const char *ALPHA_141_UPPER[];
+extern const char *ALPHA_141_LOWER[];
+extern const char *ALPHA_141_DIGITS[];
+extern const wa_freq_entry ALPHA_141_FREQ[];
+extern const wa_cp_freq ALPHA_141_FREQ_CPS[];
+extern const uint32_t ALPHA_141_UPPER_CPS[];
+extern const uint32_t ALPHA_141_LOWER_CPS[];
+extern const uint32_t ALPHA_141_DIGITS_CPS[];
+extern const char *ALPHA_142_UPPER[];
+extern const char *ALPHA_142_LOWER[];
+extern const char *ALPHA_142_DIGITS[];
+extern const wa_freq_entry ALPHA_142_FREQ[];
+extern const wa_cp_freq ALPHA_142_FREQ_CPS[];
+extern const uint32_t ALPHA_142_UPPER_CPS[];
+extern const uint32_t ALPHA_142_LOWER_CPS[];
+extern const uint32_t ALPHA_142_DIGITS_CPS[];
+extern const char *ALPHA_143_UPPER[];
+extern const char *ALPHA_143_LOWER[];
+extern const char *ALPHA_143_DIGITS[];
+extern const wa_freq_entry ALPHA_143_FREQ[];
+extern const wa_cp_freq ALPHA_143_FREQ_CPS[];
+extern const uint32_t ALPHA_143_UPPER_CPS[];
+extern const uint32_t ALPHA_143_LOWER_CPS[];
+extern const uint32_t ALPHA_143_DIGITS_CPS[];
+extern const char *ALPHA_144_UPPER[];
+extern const char *ALPHA_144_LOWER[];
+extern const char *ALPHA_144_DIGITS[];
+extern const wa_freq_entry ALPHA_144_FREQ[];
+extern const wa_cp_freq ALPHA_144_FREQ_CPS[];
+extern const uint32_t ALPHA_144_UPPER_CPS[];
+extern const uint32_t ALPHA_144_LOWER_CPS[];
+extern const uint32_t ALPHA_144_DIGITS_CPS[];
+extern const char *ALPHA_145_UPPER[];
+extern const char *ALPHA_145_LOWER[];
+extern const char *ALPHA_145_DIGITS[];
+extern const wa_freq_entry ALPHA_145_FREQ[];
+extern const wa_cp_freq ALPHA_145_FREQ_CPS[];
+extern const uint32_t ALPHA_145_UPPER_CPS[];
+extern const uint32_t ALPHA_145_LOWER_CPS[];
+extern const uint32_t ALPHA_145_DIGITS_CPS[];
+extern const char *ALPHA_146_UPPER[];
+extern const char *ALPHA_146_LOWER[];
+extern const char *ALPHA_146_DIGITS[];
+extern const wa_freq_entry ALPHA_146_FREQ[];
+extern const wa_cp_freq ALPHA_146_FREQ_CPS[];
+extern const uint32_t ALPHA_146_UPPER_CPS[];
+extern const uint32_t ALPHA_146_LOWER_CPS[];
+extern const uint32_t ALPHA_146_DIGITS_CPS[];
+extern const char *ALPHA_147_UPPER[];
+extern const char *ALPHA_147_LOWER[];
+extern const char *ALPHA_147_DIGITS[];
+extern const wa_freq_entry ALPHA_147_FREQ[];
+extern const wa_cp_freq ALPHA_147_FREQ_CPS[];
+extern const uint32_t ALPHA_147_UPPER_CPS[];
+extern const uint32_t ALPHA_147_LOWER_CPS[];
+extern const uint32_t ALPHA_147_DIGITS_CPS[];
+extern const char *ALPHA_148_UPPER[];
+extern const char *ALPHA_148_LOWER[];
+extern const char *ALPHA_148_DIGITS[];
+extern const wa_freq_entry ALPHA_148_FREQ[];
+extern const wa_cp_freq ALPHA_148_FREQ_CPS[];
+extern const uint32_t ALPHA_148_UPPER_CPS[];
+extern const uint32_t ALPHA_148_LOWER_CPS[];
+extern const uint32_t ALPHA_148_DIGITS_CPS[];
+extern const char *ALPHA_149_UPPER[];
+extern const char *ALPHA_149_LOWER[];
+extern const char *ALPHA_149_DIGITS[];
+extern const wa_freq_entry ALPHA_149_FREQ[];
+extern const wa_cp_freq ALPHA_149_FREQ_CPS[];
+extern const uint32_t ALPHA_149_UPPER_CPS[];
+extern const uint32_t ALPHA_149_LOWER_CPS[];
+extern const uint32_t ALPHA_149_DIGITS_CPS[];
+extern const char *ALPHA_150_UPPER[];
+extern const char *ALPHA_150_LOWER[];
+extern const char *ALPHA_150_DIGITS[];
+extern const wa_freq_entry ALPHA_150_FREQ[];
+extern const wa_cp_freq ALPHA_150_FREQ_CPS[];
+extern const uint32_t ALPHA_150_UPPER_CPS[];
+extern const uint32_t ALPHA_150_LOWER_CPS[];
+extern const uint32_t ALPHA_150_DIGITS_CPS[];
+extern const char *ALPHA_151_UPPER[];
+extern const char *ALPHA_151_LOWER[];
+extern const char *ALPHA_151_DIGITS[];
+extern const wa_freq_entry ALPHA_151_FREQ[];
+extern const wa_cp_freq ALPHA_151_FREQ_CPS[];
+extern const uint32_t ALPHA_151_UPPER_CPS[];
+extern const uint32_t ALPHA_151_LOWER_CPS[];
+extern const uint32_t ALPHA_151_DIGITS_CPS[];
+extern const char *ALPHA_152_UPPER[];
+extern const char *ALPHA_152_LOWER[];
+extern const char *ALPHA_152_DIGITS[];
+extern const wa_freq_entry ALPHA_152_FREQ[];
+extern const wa_cp_freq ALPHA_152_FREQ_CPS[];
+extern const uint32_t ALPHA_152_UPPER_CPS[];
+extern const uint32_t ALPHA_152_LOWER_CPS[];
+extern const uint32_t ALPHA_152_DIGITS_CPS[];
+extern const char *ALPHA_153_UPPER[];
+extern const char *ALPHA_153_LOWER[];
+extern const char *ALPHA_153_DIGITS[];
+extern const wa_freq_entry ALPHA_153_FREQ[];
+extern const wa_cp_freq ALPHA_153_FREQ_CPS[];
+extern const uint32_t ALPHA_153_UPPER_CPS[];
+extern const uint32_t ALPHA_153_LOWER_CPS[];
+extern const uint32_t ALPHA_153_DIGITS_CPS[];
+extern const char *ALPHA_154_UPPER[];
+extern const char *ALPHA_154_LOWER[];
+extern const char *ALPHA_154_DIGITS[];
+extern const wa_freq_entry ALPHA_154_FREQ[];
+extern const wa_cp_freq ALPHA_154_FREQ_CPS[];
+extern const uint32_t ALPHA_154_UPPER_CPS[];
+extern const uint32_t ALPHA_154_LOWER_CPS[];
+extern const uint32_t ALPHA_154_DIGITS_CPS[];
+extern const char *ALPHA_155_UPPER[];
+extern const char *ALPHA_155_LOWER[];
+extern const char *ALPHA_155_DIGITS[];
+extern const wa_freq_entry ALPHA_155_FREQ[];
+extern const wa_cp_freq ALPHA_155_FREQ_CPS[];
+extern const uint32_t ALPHA_155_UPPER_CPS[];
+extern const uint32_t ALPHA_155_LOWER_CPS[];
+extern const uint32_t ALPHA_155_DIGITS_CPS[];
+extern const char *ALPHA_156_UPPER[];
+extern const char *ALPHA_156_LOWER[];
+extern const char *ALPHA_156_DIGITS[];
+extern const wa_freq_entry ALPHA_156_FREQ[];
+extern const wa_cp_freq ALPHA_156_FREQ_CPS[];
+extern const uint32_t ALPHA_156_UPPER_CPS[];
+extern const uint32_t ALPHA_156_LOWER_CPS[];
+extern const uint32_t ALPHA_156_DIGITS_CPS[];
+extern const char *ALPHA_157_UPPER[];
+extern const char *ALPHA_157_LOWER[];
+extern const char *ALPHA_157_DIGITS[];
+extern const wa_freq_entry ALPHA_157_FREQ[];
+extern const wa_cp_freq ALPHA_157_FREQ_CPS[];
+extern const uint32_t ALPHA_157_UPPER_CPS[];
+extern const uint32_t ALPHA_157_LOWER_CPS[];
+extern const uint32_t ALPHA_157_DIGITS_CPS[];
+extern const char *ALPHA_158_UPPER[];
+extern const char *ALPHA_158_LOWER[];
+extern const char *ALPHA_158_DIGITS[];
+extern const wa_freq_entry ALPHA_158_FREQ[];
+extern const wa_cp_freq ALPHA_158_FREQ_CPS[];
+extern const uint32_t ALPHA_158_UPPER_CPS[];
+extern const uint32_t ALPHA_158_LOWER_CPS[];
+extern const uint32_t ALPHA_158_DIGITS_CPS[];
+extern const char *ALPHA_159_UPPER[];
+extern const char *ALPHA_159_LOWER[];
+extern const char *ALPHA_159_DIGITS[];
+extern const wa_freq_entry ALPHA_159_FREQ[];
+extern const wa_cp_freq ALPHA_159_FREQ_CPS[];
+extern const uint32_t ALPHA_159_UPPER_CPS[];
+extern const uint32_t ALPHA_159_LOWER_CPS[];
+extern const uint32_t ALPHA_159_DIGITS_CPS[];
+extern const char *ALPHA_160_UPPER[];
+extern const char *ALPHA_160_LOWER[];
+extern const char *ALPHA_160_DIGITS[];
+extern const wa_freq_entry ALPHA_160_FREQ[];
+extern const wa_cp_freq ALPHA_160_FREQ_CPS[];
+extern const uint32_t ALPHA_160_UPPER_CPS[];
+extern const uint32_t ALPHA_160_LOWER_CPS[];
+extern const uint32_t ALPHA_160_DIGITS_CPS[];
+extern const char *ALPHA_161_UPPER[];
+extern const char *ALPHA_161_LOWER[];
+extern const char *ALPHA_161_DIGITS[];
+extern const wa_freq_entry ALPHA_161_FREQ[];
+extern const wa_cp_freq ALPHA_161_FREQ_CPS[];
+extern const uint32_t ALPHA_161_UPPER_CPS[];
+extern const uint32_t ALPHA_161_LOWER_CPS[];
+extern const uint32_t ALPHA_161_DIGITS_CPS[];
+extern const char *ALPHA_162_UPPER[];
+extern const char *ALPHA_162_LOWER[];
+extern const char *ALPHA_162_DIGITS[];
+extern const wa_freq_entry ALPHA_162_FREQ[];
+extern const wa_cp_freq ALPHA_162_FREQ_CPS[];
+extern const uint32_t ALPHA_162_UPPER_CPS[];
+extern const uint32_t ALPHA_162_LOWER_CPS[];
+extern const uint32_t ALPHA_162_DIGITS_CPS[];
+extern const char *ALPHA_163_UPPER[];
+extern const char *ALPHA_163_LOWER[];
+extern const char *ALPHA_163_DIGITS[];
+extern const wa_freq_entry ALPHA_163_FREQ[];
+extern const wa_cp_freq ALPHA_163_FREQ_CPS[];
+extern const uint32_t ALPHA_163_UPPER_CPS[];
+extern const uint32_t ALPHA_163_LOWER_CPS[];
+extern const uint32_t ALPHA_163_DIGITS_CPS[];
+extern const char *ALPHA_164_UPPER[];
+extern const char *ALPHA_164_LOWER[];
+extern const char *ALPHA_164_DIGITS[];
+extern const wa_freq_entry ALPHA_164_FREQ[];
+extern const wa_cp_freq ALPHA_164_FREQ_CPS[];
+extern const uint32_t ALPHA_164_UPPER_CPS[];
+extern const uint32_t ALPHA_164_LOWER_CPS[];
+extern const uint32_t ALPHA_164_DIGITS_CPS[];
+extern const char *ALPHA_165_UPPER[];
+extern const char *ALPHA_165_LOWER[];
+extern const char *ALPHA_165_DIGITS[];
+extern const wa_freq_entry ALPHA_165_FREQ[];
+extern const wa_cp_freq ALPHA_165_FREQ_CPS[];
+extern const uint32_t ALPHA_165_UPPER_CPS[];
+extern const uint32_t ALPHA_165_LOWER_CPS[];
+extern const uint32_t ALPHA_165_DIGITS_CPS[];
+extern const char *ALPHA_166_UPPER[];
+extern const char *ALPHA_166_LOWER[];
+extern const char *ALPHA_166_DIGITS[];
+extern const wa_freq_entry ALPHA_166_FREQ[];
+extern const wa_cp_freq ALPHA_166_FREQ_CPS[];
+extern const uint32_t ALPHA_166_UPPER_CPS[];
+extern const uint32_t ALPHA_166_LOWER_CPS[];
+extern const uint32_t ALPHA_166_DIGITS_CPS[];
+extern const char *ALPHA_167_UPPER[];
+extern const char *ALPHA_167_LOWER[];
+extern const char *ALPHA_167_DIGITS[];
+extern const wa_freq_entry ALPHA_167_FREQ[];
+extern const wa_cp_freq ALPHA_167_FREQ_CPS[];
+extern const uint32_t ALPHA_167_UPPER_CPS[];
+extern const uint32_t ALPHA_167_LOWER_CPS[];
+extern const uint32_t ALPHA_167_DIGITS_CPS[];
+extern const char *ALPHA_168_UPPER[];
+extern const char *ALPHA_168_LOWER[];
+extern const char *ALPHA_168_DIGITS[];
+extern const wa_freq_entry ALPHA_168_FREQ[];
+extern const wa_cp_freq ALPHA_168_FREQ_CPS[];
+extern const uint32_t ALPHA_168_UPPER_CPS[];
+extern const uint32_t ALPHA_168_LOWER_CPS[];
+extern const uint32_t ALPHA_168_DIGITS_CPS[];
+extern const char *ALPHA_169_UPPER[];
+extern const char *ALPHA_169_LOWER[];
+extern const char *ALPHA_169_DIGITS[];
+extern const wa_freq_entry ALPHA_169_FREQ[];
+extern const wa_cp_freq ALPHA_169_FREQ_CPS[];
+extern const uint32_t ALPHA_169_UPPER_CPS[];
+extern const uint32_t ALPHA_169_LOWER_CPS[];
+extern const uint32_t ALPHA_169_DIGITS_CPS[];
+extern const char *ALPHA_170_UPPER[];
+extern const char *ALPHA_170_LOWER[];
+extern const char *ALPHA_170_DIGITS[];
+extern const wa_freq_entry ALPHA_170_FREQ[];
+extern const wa_cp_freq ALPHA_170_FREQ_CPS[];
+extern const uint32_t ALPHA_170_UPPER_CPS[];
+extern const uint32_t ALPHA_170_LOWER_CPS[];
+extern const uint32_t ALPHA_170_DIGITS_CPS[];
+extern const char *ALPHA_171_UPPER[];
+extern const char *ALPHA_171_LOWER[];
+extern const char *ALPHA_171_DIGITS[];
+extern const wa_freq_entry ALPHA_171_FREQ[];
+extern const wa_cp_freq ALPHA_171_FREQ_CPS[];
+extern const uint32_t ALPHA_171_UPPER_CPS[];
+extern const uint32_t ALPHA_171_LOWER_CPS[];
+extern const uint32_t ALPHA_171_DIGITS_CPS[];
+extern const char *ALPHA_172_UPPER[];
+extern const char *ALPHA_172_LOWER[];
+extern const char *ALPHA_172_DIGITS[];
+extern const wa_freq_entry ALPHA_172_FREQ[];
+extern const wa_cp_freq ALPHA_172_FREQ_CPS[];
+extern const uint32_t ALPHA_172_UPPER_CPS[];
+extern const uint32_t ALPHA_172_LOWER_CPS[];
+extern const uint32_t ALPHA_172_DIGITS_CPS[];
+extern const char *ALPHA_173_UPPER[];
+extern const char *ALPHA_173_LOWER[];
+extern const char *ALPHA_173_DIGITS[];
+extern const wa_freq_entry ALPHA_173_FREQ[];
+extern const wa_cp_freq ALPHA_173_FREQ_CPS[];
+extern const uint32_t ALPHA_173_UPPER_CPS[];
+extern const uint32_t ALPHA_173_LOWER_CPS[];
+extern const uint32_t ALPHA_173_DIGITS_CPS[];
+extern const char *ALPHA_174_UPPER[];
+extern const char *ALPHA_174_LOWER[];
+extern const char *ALPHA_174_DIGITS[];
+extern const wa_freq_entry ALPHA_174_FREQ[];
+extern const wa_cp_freq ALPHA_174_FREQ_CPS[];
+extern const uint32_t ALPHA_174_UPPER_CPS[];
+extern const uint32_t ALPHA_174_LOWER_CPS[];
+extern const uint32_t ALPHA_174_DIGITS_CPS[];
+extern const char *ALPHA_175_UPPER[];
+extern const char *ALPHA_175_LOWER[];
+extern const char *ALPHA_175_DIGITS[];
+extern const wa_freq_entry ALPHA_175_FREQ[];
+extern const wa_cp_freq ALPHA_175_FREQ_CPS[];
+extern const uint32_t ALPHA_175_UPPER_CPS[];
+extern const uint32_t ALPHA_175_LOWER_CPS[];
+extern const uint32_t ALPHA_175_DIGITS_CPS[];
+extern const char *ALPHA_176_UPPER[];
+extern const char *ALPHA_176_LOWER[];
+extern const char *ALPHA_176_DIGITS[];
+extern const wa_freq_entry ALPHA_176_FREQ[];
+extern const wa_cp_freq ALPHA_176_FREQ_CPS[];
+extern const uint32_t ALPHA_176_UPPER_CPS[];
+extern const uint32_t ALPHA_176_LOWER_CPS[];
+extern const uint32_t ALPHA_176_DIGITS_CPS[];
+extern const char *ALPHA_177_UPPER[];
+extern const char *ALPHA_177_LOWER[];
+extern const char *ALPHA_177_DIGITS[];
+extern const wa_freq_entry ALPHA_177_FREQ[];
+extern const wa_cp_freq ALPHA_177_FREQ_CPS[];
+extern const uint32_t ALPHA_177_UPPER_CPS[];
+extern const uint32_t ALPHA_177_LOWER_CPS[];
+extern const uint32_t ALPHA_177_DIGITS_CPS[];
+extern const char *ALPHA_178_UPPER[];
+extern const char *ALPHA_178_LOWER[];
+extern const char *ALPHA_178_DIGITS[];
+extern const wa_freq_entry ALPHA_178_FREQ[];
+extern const wa_cp_freq ALPHA_178_FREQ_CPS[];
+extern const uint32_t ALPHA_178_UPPER_CPS[];
+extern const uint32_t ALPHA_178_LOWER_CPS[];
+extern const uint32_t ALPHA_178_DIGITS_CPS[];
+extern const char *ALPHA_179_UPPER[];
+extern const char *ALPHA_179_LOWER[];
+extern const char *ALPHA_179_DIGITS[];
+extern const wa_freq_entry ALPHA_179_FREQ[];
+extern const wa_cp_freq ALPHA_179_FREQ_CPS[];
+extern const uint32_t ALPHA_179_UPPER_CPS[];
+extern const uint32_t ALPHA_179_LOWER_CPS[];
+extern const uint32_t ALPHA_179_DIGITS_CPS[];
+extern const char *ALPHA_180_UPPER[];
+extern const char *ALPHA_180_LOWER[];
+extern const char *ALPHA_180_DIGITS[];
+extern const wa_freq_entry ALPHA_180_FREQ[];
+extern const wa_cp_freq ALPHA_180_FREQ_CPS[];
+extern const uint32_t ALPHA_180_UPPER_CPS[];
+extern const uint32_t ALPHA_180_LOWER_CPS[];
+extern const uint32_t ALPHA_180_DIGITS_CPS[];
+extern const char *ALPHA_181_UPPER[];
+extern const char *ALPHA_181_LOWER[];
+extern const char *ALPHA_181_DIGITS[];
+extern const wa_freq_entry ALPHA_181_FREQ[];
+extern const wa_cp_freq ALPHA_181_FREQ_CPS[];
+extern const uint32_t ALPHA_181_UPPER_CPS[];
+extern const uint32_t ALPHA_181_LOWER_CPS[];
+extern const uint32_t ALPHA_181_DIGITS_CPS[];
+extern const char *ALPHA_182_UPPER[];
+extern const char *ALPHA_182_LOWER[];
+extern const char *ALPHA_182_DIGITS[];
+extern const wa_freq_entry ALPHA_182_FREQ[];
+extern const wa_cp_freq ALPHA_182_FREQ_CPS[];
+extern const uint32_t ALPHA_182_UPPER_CPS[];
+extern const uint32_t ALPHA_182_LOWER_CPS[];
+extern const uint32_t ALPHA_182_DIGITS_CPS[];
+extern const char *ALPHA_183_UPPER[];
+extern const char *ALPHA_183_LOWER[];
+extern const char *ALPHA_183_DIGITS[];
+extern const wa_freq_entry ALPHA_183_FREQ[];
+extern const wa_cp_freq ALPHA_183_FREQ_CPS[];
+extern const uint32_t ALPHA_183_UPPER_CPS[];
+extern const uint32_t ALPHA_183_LOWER_CPS[];
+extern const uint32_t ALPHA_183_DIGITS_CPS[];
+extern const char *ALPHA_184_UPPER[];
+extern const char *ALPHA_184_LOWER[];
+extern const char *ALPHA_184_DIGITS[];
+extern const wa_freq_entry ALPHA_184_FREQ[];
+extern const wa_cp_freq ALPHA_184_FREQ_CPS[];
+extern const uint32_t ALPHA_184_UPPER_CPS[];
+extern const uint32_t ALPHA_184_LOWER_CPS[];
+extern const uint32_t ALPHA_184_DIGITS_CPS[];
+extern const char *ALPHA_185_UPPER[];
+extern const char *ALPHA_185_LOWER[];
+extern const char *ALPHA_185_DIGITS[];
+extern const wa_freq_entry ALPHA_185_FREQ[];
+extern const wa_cp_freq ALPHA_185_FREQ_CPS[];
+extern const uint32_t ALPHA_185_UPPER_CPS[];
+extern const uint32_t ALPHA_185_LOWER_CPS[];
+extern const uint32_t ALPHA_185_DIGITS_CPS[];
+extern const char *ALPHA_186_UPPER[];
+extern const char *ALPHA_186_LOWER[];
+extern const char *ALPHA_186_DIGITS[];
+extern const wa_freq_entry ALPHA_186_FREQ[];
+extern const wa_cp_freq ALPHA_186_FREQ_CPS[];
+extern const uint32_t ALPHA_186_UPPER_CPS[];
+extern const uint32_t ALPHA_186_LOWER_CPS[];
+extern const uint32_t ALPHA_186_DIGITS_CPS[];
+extern const char *ALPHA_187_UPPER[];
+extern const char *ALPHA_187_LOWER[];
+extern const char *ALPHA_187_DIGITS[];
+extern const wa_freq_entry ALPHA_187_FREQ[];
+extern const wa_cp_freq ALPHA_187_FREQ_CPS[];
+extern const uint32_t ALPHA_187_UPPER_CPS[];
+extern const uint32_t ALPHA_187_LOWER_CPS[];
+extern const uint32_t ALPHA_187_DIGITS_CPS[];
+extern const char *ALPHA_188_UPPER[];
+extern const char *ALPHA_188_LOWER[];
+extern const char *ALPHA_188_DIGITS[];
+extern const wa_freq_entry ALPHA_188_FREQ[];
+extern const wa_cp_freq ALPHA_188_FREQ_CPS[];
+extern const uint32_t ALPHA_188_UPPER_CPS[];
+extern const uint32_t ALPHA_188_LOWER_CPS[];
+extern const uint32_t ALPHA_188_DIGITS_CPS[];
+extern const char *ALPHA_189_UPPER[];
+extern const char *ALPHA_189_LOWER[];
+extern const char *ALPHA_189_DIGITS[];
+extern const wa_freq_entry ALPHA_189_FREQ[];
+extern const wa_cp_freq ALPHA_189_FREQ_CPS[];
+extern const uint32_t ALPHA_189_UPPER_CPS[];
+extern const uint32_t ALPHA_189_LOWER_CPS[];
+extern const uint32_t ALPHA_189_DIGITS_CPS[];
+extern const char *ALPHA_190_UPPER[];
+extern const char *ALPHA_190_LOWER[];
+extern const char *ALPHA_190_DIGITS[];
+extern const wa_freq_entry ALPHA_190_FREQ[];
+extern const wa_cp_freq ALPHA_190_FREQ_CPS[];
+extern const uint32_t ALPHA_190_UPPER_CPS[];
+extern const uint32_t ALPHA_190_LOWER_CPS[];
+extern const uint32_t ALPHA_190_DIGITS_CPS[];
+extern const char *ALPHA_191_UPPER[];
+extern const char *ALPHA_191_LOWER[];
+extern const char *ALPHA_191_DIGITS[];
+extern const wa_freq_entry ALPHA_191_FREQ[];
+extern const wa_cp_freq ALPHA_191_FREQ_CPS[];
+extern const uint32_t ALPHA_191_UPPER_CPS[];
+extern const uint32_t ALPHA_191_LOWER_CPS[];
+extern const uint32_t ALPHA_191_DIGITS_CPS[];
+extern const char *ALPHA_192_UPPER[];
+extern const char *ALPHA_192_LOWER[];
+extern const char *ALPHA_192_DIGITS[];
+extern const wa_freq_entry ALPHA_192_FREQ[];
+extern const wa_cp_freq ALPHA_192_FREQ_CPS[];
+extern const uint32_t ALPHA_192_UPPER_CPS[];
+extern const uint32_t ALPHA_192_LOWER_CPS[];
+extern const uint32_t ALPHA_192_DIGITS_CPS[];
+extern const char *ALPHA_193_UPPER[];
+extern const char *ALPHA_193_LOWER[];
+extern const char *ALPHA_193_DIGITS[];
+extern const wa_freq_entry ALPHA_193_FREQ[];
+extern const wa_cp_freq ALPHA_193_FREQ_CPS[];
+extern const uint32_t ALPHA_193_UPPER_CPS[];
+extern const uint32_t ALPHA_193_LOWER_CPS[];
+extern const uint32_t ALPHA_193_DIGITS_CPS[];
+extern const char *ALPHA_194_UPPER[];
+extern const char *ALPHA_194_LOWER[];
+extern const char *ALPHA_194_DIGITS[];
+extern const wa_freq_entry ALPHA_194_FREQ[];
+extern const wa_cp_freq ALPHA_194_FREQ_CPS[];
+extern const uint32_t ALPHA_194_UPPER_CPS[];
+extern const uint32_t ALPHA_194_LOWER_CPS[];
+extern const uint32_t ALPHA_194_DIGITS_CPS[];
+extern const char *ALPHA_195_UPPER[];
+extern const char *ALPHA_195_LOWER[];
+extern const char *ALPHA_195_DIGITS[];
+extern const wa_freq_entry ALPHA_195_FREQ[];
+extern const wa_cp_freq ALPHA_195_FREQ_CPS[];
+extern const uint32_t ALPHA_195_UPPER_CPS[];
+extern const uint32_t ALPHA_195_LOWER_CPS[];
+extern const uint32_t ALPHA_195_DIGITS_CPS[];
+extern const char *ALPHA_196_UPPER[];
+extern const char *ALPHA_196_LOWER[];
+extern const char *ALPHA_196_DIGITS[];
+extern const wa_freq_entry ALPHA_196_FREQ[];
+extern const wa_cp_freq ALPHA_196_FREQ_CPS[];
+extern const uint32_t ALPHA_196_UPPER_CPS[];
+extern const uint32_t ALPHA_196_LOWER_CPS[];
+extern const uint32_t ALPHA_196_DIGITS_CPS[];
+extern const char *ALPHA_197_UPPER[];
+extern const char *ALPHA_197_LOWER[];
+extern const char *ALPHA_197_DIGITS[];
+extern const wa_freq_entry ALPHA_197_FREQ[];
+extern const wa_cp_freq ALPHA_197_FREQ_CPS[];
+extern const uint32_t ALPHA_197_UPPER_CPS[];
+extern const uint32_t ALPHA_197_LOWER_CPS[];
+extern const uint32_t ALPHA_197_DIGITS_CPS[];
+extern const char *ALPHA_198_UPPER[];
+extern const char *ALPHA_198_LOWER[];
+extern const char *ALPHA_198_DIGITS[];
+extern const wa_freq_entry ALPHA_198_FREQ[];
+extern const wa_cp_freq ALPHA_198_FREQ_CPS[];
+extern const uint32_t ALPHA_198_UPPER_CPS[];
+extern const uint32_t ALPHA_198_LOWER_CPS[];
+extern const uint32_t ALPHA_198_DIGITS_CPS[];
+extern const char *ALPHA_199_UPPER[];
+extern const char *ALPHA_199_LOWER[];
+extern const char *ALPHA_199_DIGITS[];
+extern const wa_freq_entry ALPHA_199_FREQ[];
+extern const wa_cp_freq ALPHA_199_FREQ_CPS[];
+extern const uint32_t ALPHA_199_UPPER_CPS[];
+extern const uint32_t ALPHA_199_LOWER_CPS[];
+extern const uint32_t ALPHA_199_DIGITS_CPS[];
+extern const char *ALPHA_200_UPPER[];
+extern const char *ALPHA_200_LOWER[];
+extern const char *ALPHA_200_DIGITS[];
+extern const wa_freq_entry ALPHA_200_FREQ[];
+extern const wa_cp_freq ALPHA_200_FREQ_CPS[];
+extern const uint32_t ALPHA_200_UPPER_CPS[];
+extern const uint32_t ALPHA_200_LOWER_CPS[];
+extern const uint32_t ALPHA_200_DIGITS_CPS[];
+extern const char *ALPHA_201_UPPER[];
+extern const char *ALPHA_201_LOWER[];
+extern const char *ALPHA_201_DIGITS[];
+extern const wa_freq_entry ALPHA_201_FREQ[];
+extern const wa_cp_freq ALPHA_201_FREQ_CPS[];
+extern const uint32_t ALPHA_201_UPPER_CPS[];
+extern const uint32_t ALPHA_201_LOWER_CPS[];
+extern const uint32_t ALPHA_201_DIGITS_CPS[];
+extern const char *ALPHA_202_UPPER[];
+extern const char *ALPHA_202_LOWER[];
+extern const char *ALPHA_202_DIGITS[];
+extern const wa_freq_entry ALPHA_202_FREQ[];
+extern const wa_cp_freq ALPHA_202_FREQ_CPS[];
+extern const uint32_t ALPHA_202_UPPER_CPS[];
+extern const uint32_t ALPHA_202_LOWER_CPS[];
+extern const uint32_t ALPHA_202_DIGITS_CPS[];
+extern const char *ALPHA_203_UPPER[];
+extern const char *ALPHA_203_LOWER[];
+extern const char *ALPHA_203_DIGITS[];
+extern const wa_freq_entry ALPHA_203_FREQ[];
+extern const wa_cp_freq ALPHA_203_FREQ_CPS[];
+extern const uint32_t ALPHA_203_UPPER_CPS[];
+extern const uint32_t ALPHA_203_LOWER_CPS[];
+extern const uint32_t ALPHA_203_DIGITS_CPS[];
+extern const char *ALPHA_204_UPPER[];
+extern const char *ALPHA_204_LOWER[];
+extern const char *ALPHA_204_DIGITS[];
+extern const wa_freq_entry ALPHA_204_FREQ[];
+extern const wa_cp_freq ALPHA_204_FREQ_CPS[];
+extern const uint32_t ALPHA_204_UPPER_CPS[];
+extern const uint32_t ALPHA_204_LOWER_CPS[];
+extern const uint32_t ALPHA_204_DIGITS_CPS[];
+extern const char *ALPHA_205_UPPER[];
+extern const char *ALPHA_205_LOWER[];
+extern const char *ALPHA_205_DIGITS[];
+extern const wa_freq_entry ALPHA_205_FREQ[];
+extern const wa_cp_freq ALPHA_205_FREQ_CPS[];
+extern const uint32_t ALPHA_205_UPPER_CPS[];
+extern const uint32_t ALPHA_205_LOWER_CPS[];
+extern const uint32_t ALPHA_205_DIGITS_CPS[];
+extern const char *ALPHA_206_UPPER[];
+extern const char *ALPHA_206_LOWER[];
+extern const char *ALPHA_206_DIGITS[];
+extern const wa_freq_entry ALPHA_206_FREQ[];
+extern const wa_cp_freq ALPHA_206_FREQ_CPS[];
+extern const uint32_t ALPHA_206_UPPER_CPS[];
+extern const uint32_t ALPHA_206_LOWER_CPS[];
+extern const uint32_t ALPHA_206_DIGITS_CPS[];
+extern const char *ALPHA_207_UPPER[];
+extern const char *ALPHA_207_LOWER[];
+extern const char *ALPHA_207_DIGITS[];
+extern const wa_freq_entry ALPHA_207_FREQ[];
+extern const wa_cp_freq ALPHA_207_FREQ_CPS[];
+extern const uint32_t ALPHA_207_UPPER_CPS[];
+extern const uint32_t ALPHA_207_LOWER_CPS[];
+extern const uint32_t ALPHA_207_DIGITS_CPS[];
+extern const char *ALPHA_208_UPPER[];
+extern const char *ALPHA_208_LOWER[];
+extern const char *ALPHA_208_DIGITS[];
+extern const wa_freq_entry ALPHA_208_FREQ[];
+extern const wa_cp_freq ALPHA_208_FREQ_CPS[];
+extern const uint32_t ALPHA_208_UPPER_CPS[];
+extern const uint32_t ALPHA_208_LOWER_CPS[];
+extern const uint32_t ALPHA_208_DIGITS_CPS[];
+extern const char *ALPHA_209_UPPER[];
+extern const char *ALPHA_209_LOWER[];
+extern const char *ALPHA_209_DIGITS[];
+extern const wa_freq_entry ALPHA_209_FREQ[];
+extern const wa_cp_freq ALPHA_209_FREQ_CPS[];
+extern const uint32_t ALPHA_209_UPPER_CPS[];
+extern const uint32_t ALPHA_209_LOWER_CPS[];
+extern const uint32_t ALPHA_209_DIGITS_CPS[];
+extern const char *ALPHA_210_UPPER[];
+extern const char *ALPHA_210_LOWER[];
+extern const char *ALPHA_210_DIGITS[];
+extern const wa_freq_entry ALPHA_210_FREQ[];
+extern const wa_cp_freq ALPHA_210_FREQ_CPS[];
+extern const uint32_t ALPHA_210_UPPER_CPS[];
+extern const uint32_t ALPHA_210_LOWER_CPS[];
+extern const uint32_t ALPHA_210_DIGITS_CPS[];
+extern const char *ALPHA_211_UPPER[];
+extern const char *ALPHA_211_LOWER[];
+extern const char *ALPHA_211_DIGITS[];
+extern const wa_freq_entry ALPHA_211_FREQ[];
+extern const wa_cp_freq ALPHA_211_FREQ_CPS[];
+extern const uint32_t ALPHA_211_UPPER_CPS[];
+extern const uint32_t ALPHA_211_LOWER_CPS[];
+extern const uint32_t ALPHA_211_DIGITS_CPS[];
+extern const char *ALPHA_212_UPPER[];
+extern const char *ALPHA_212_LOWER[];
+extern const char *ALPHA_212_DIGITS[];
+extern const wa_freq_entry ALPHA_212_FREQ[];
+extern const wa_cp_freq ALPHA_212_FREQ_CPS[];
+extern const uint32_t ALPHA_212_UPPER_CPS[];
+extern const uint32_t ALPHA_212_LOWER_CPS[];
+extern const uint32_t ALPHA_212_DIGITS_CPS[];
+extern const char *ALPHA_213_UPPER[];
+extern const char *ALPHA_213_LOWER[];
+extern const char *ALPHA_213_DIGITS[];
+extern const wa_freq_entry ALPHA_213_FREQ[];
+extern const wa_cp_freq ALPHA_213_FREQ_CPS[];
+extern const uint32_t ALPHA_213_UPPER_CPS[];
+extern const uint32_t ALPHA_213_LOWER_CPS[];
+extern const uint32_t ALPHA_213_DIGITS_CPS[];
+extern const char *ALPHA_214_UPPER[];
+extern const char *ALPHA_214_LOWER[];
+extern const char *ALPHA_214_DIGITS[];
+extern const wa_freq_entry ALPHA_214_FREQ[];
+extern const wa_cp_freq ALPHA_214_FREQ_CPS[];
+extern const uint32_t ALPHA_214_UPPER_CPS[];
+extern const uint32_t ALPHA_214_LOWER_CPS[];
+extern const uint32_t ALPHA_214_DIGITS_CPS[];
+extern const char *ALPHA_215_UPPER[];
+extern const char *ALPHA_215_LOWER[];
+extern const char *ALPHA_215_DIGITS[];
+extern const wa_freq_entry ALPHA_215_FREQ[];
+extern const wa_cp_freq ALPHA_215_FREQ_CPS[];
+extern const uint32_t ALPHA_215_UPPER_CPS[];
+extern const uint32_t ALPHA_215_LOWER_CPS[];
+extern const uint32_t ALPHA_215_DIGITS_CPS[];
+extern const char *ALPHA_216_UPPER[];
+extern const char *ALPHA_216_LOWER[];
+extern const char *ALPHA_216_DIGITS[];
+extern const wa_freq_entry ALPHA_216_FREQ[];
+extern const wa_cp_freq ALPHA_216_FREQ_CPS[];
+extern const uint32_t ALPHA_216_UPPER_CPS[];
+extern const uint32_t ALPHA_216_LOWER_CPS[];
+extern const uint32_t ALPHA_216_DIGITS_CPS[];
+extern const char *ALPHA_217_UPPER[];
+extern const char *ALPHA_217_LOWER[];
+extern const char *ALPHA_217_DIGITS[];
+extern const wa_freq_entry ALPHA_217_FREQ[];
+extern const wa_cp_freq ALPHA_217_FREQ_CPS[];
+extern const uint32_t ALPHA_217_UPPER_CPS[];
+extern const uint32_t ALPHA_217_LOWER_CPS[];
+extern const uint32_t ALPHA_217_DIGITS_CPS[];
+extern const char *ALPHA_218_UPPER[];
+extern const char *ALPHA_218_LOWER[];
+extern const char *ALPHA_218_DIGITS[];
+extern const wa_freq_entry ALPHA_218_FREQ[];
+extern const wa_cp_freq ALPHA_218_FREQ_CPS[];
+extern const uint32_t ALPHA_218_UPPER_CPS[];
+extern const uint32_t ALPHA_218_LOWER_CPS[];
+extern const uint32_t ALPHA_218_DIGITS_CPS[];
+extern const char *ALPHA_219_UPPER[];
+extern const char *ALPHA_219_LOWER[];
+extern const char *ALPHA_219_DIGITS[];
+extern const wa_freq_entry ALPHA_219_FREQ[];
+extern const wa_cp_freq ALPHA_219_FREQ_CPS[];
+extern const uint32_t ALPHA_219_UPPER_CPS[];
+extern const uint32_t ALPHA_219_LOWER_CPS[];
+extern const uint32_t ALPHA_219_DIGITS_CPS[];
+extern const char *ALPHA_220_UPPER[];
+extern const char *ALPHA_220_LOWER[];
+extern const char *ALPHA_220_DIGITS[];
+extern const wa_freq_entry ALPHA_220_FREQ[];
+extern const wa_cp_freq ALPHA_220_FREQ_CPS[];
+extern const uint32_t ALPHA_220_UPPER_CPS[];
+extern const uint32_t ALPHA_220_LOWER_CPS[];
+extern const uint32_t ALPHA_220_DIGITS_CPS[];
+extern const char *ALPHA_221_UPPER[];
+extern const char *ALPHA_221_LOWER[];
+extern const char *ALPHA_221_DIGITS[];
+extern const wa_freq_entry ALPHA_221_FREQ[];
+extern const wa_cp_freq ALPHA_221_FREQ_CPS[];
+extern const uint32_t ALPHA_221_UPPER_CPS[];
+extern const uint32_t ALPHA_221_LOWER_CPS[];
+extern const uint32_t ALPHA_221_DIGITS_CPS[];
+extern const char *ALPHA_222_UPPER[];
+extern const char *ALPHA_222_LOWER[];
+extern const char *ALPHA_222_DIGITS[];
+extern const wa_freq_entry ALPHA_222_FREQ[];
+extern const wa_cp_freq ALPHA_222_FREQ_CPS[];
+extern const uint32_t ALPHA_222_UPPER_CPS[];
+extern const uint32_t ALPHA_222_LOWER_CPS[];
+extern const uint32_t ALPHA_222_DIGITS_CPS[];
+extern const char *ALPHA_223_UPPER[];
+extern const char *ALPHA_223_LOWER[];
+extern const char *ALPHA_223_DIGITS[];
+extern const wa_freq_entry ALPHA_223_FREQ[];
+extern const wa_cp_freq ALPHA_223_FREQ_CPS[];
+extern const uint32_t ALPHA_223_UPPER_CPS[];
+extern const uint32_t ALPHA_223_LOWER_CPS[];
+extern const uint32_t ALPHA_223_DIGITS_CPS[];
+extern const char *ALPHA_224_UPPER[];
+extern const char *ALPHA_224_LOWER[];
+extern const char *ALPHA_224_DIGITS[];
+extern const wa_freq_entry ALPHA_224_FREQ[];
+extern const wa_cp_freq ALPHA_224_FREQ_CPS[];
+extern const uint32_t ALPHA_224_UPPER_CPS[];
+extern const uint32_t ALPHA_224_LOWER_CPS[];
+extern const uint32_t ALPHA_224_DIGITS_CPS[];
+extern const char *ALPHA_225_UPPER[];
+extern const char *ALPHA_225_LOWER[];
+extern const char *ALPHA_225_DIGITS[];
+extern const wa_freq_entry ALPHA_225_FREQ[];
+extern const wa_cp_freq ALPHA_225_FREQ_CPS[];
+extern const uint32_t ALPHA_225_UPPER_CPS[];
+extern const uint32_t ALPHA_225_LOWER_CPS[];
+extern const uint32_t ALPHA_225_DIGITS_CPS[];
+extern const char *ALPHA_226_UPPER[];
+extern const char *ALPHA_226_LOWER[];
+extern const char *ALPHA_226_DIGITS[];
+extern const wa_freq_entry ALPHA_226_FREQ[];
+extern const wa_cp_freq ALPHA_226_FREQ_CPS[];
+extern const uint32_t ALPHA_226_UPPER_CPS[];
+extern const uint32_t ALPHA_226_LOWER_CPS[];
+extern const uint32_t ALPHA_226_DIGITS_CPS[];
+extern const char *ALPHA_227_UPPER[];
+extern const char *ALPHA_227_LOWER[];
+extern const char *ALPHA_227_DIGITS[];
+extern const wa_freq_entry ALPHA_227_FREQ[];
+extern const wa_cp_freq ALPHA_227_FREQ_CPS[];
+extern const uint32_t ALPHA_227_UPPER_CPS[];
+extern const uint32_t ALPHA_227_LOWER_CPS[];
+extern const uint32_t ALPHA_227_DIGITS_CPS[];
+extern const char *ALPHA_228_UPPER[];
+extern const char *ALPHA_228_LOWER[];
+extern const char *ALPHA_228_DIGITS[];
+extern const wa_freq_entry ALPHA_228_FREQ[];
+extern const wa_cp_freq ALPHA_228_FREQ_CPS[];
+extern const uint32_t ALPHA_228_UPPER_CPS[];
+extern const uint32_t ALPHA_228_LOWER_CPS[];
+extern const uint32_t ALPHA_228_DIGITS_CPS[];
+extern const char *ALPHA_229_UPPER[];
+extern const char *ALPHA_229_LOWER[];
+extern const char *ALPHA_229_DIGITS[];
+extern const wa_freq_entry ALPHA_229_FREQ[];
+extern const wa_cp_freq ALPHA_229_FREQ_CPS[];
+extern const uint32_t ALPHA_229_UPPER_CPS[];
+extern const uint32_t ALPHA_229_LOWER_CPS[];
+extern const uint32_t ALPHA_229_DIGITS_CPS[];
+extern const char *ALPHA_230_UPPER[];
+extern const char *ALPHA_230_LOWER[];
+extern const char *ALPHA_230_DIGITS[];
+extern const wa_freq_entry ALPHA_230_FREQ[];
+extern const wa_cp_freq ALPHA_230_FREQ_CPS[];
+extern const uint32_t ALPHA_230_UPPER_CPS[];
+extern const uint32_t ALPHA_230_LOWER_CPS[];
+extern const uint32_t ALPHA_230_DIGITS_CPS[];
+extern const char *ALPHA_231_UPPER[];
+extern const char *ALPHA_231_LOWER[];
+extern const char *ALPHA_231_DIGITS[];
+extern const wa_freq_entry ALPHA_231_FREQ[];
+extern const wa_cp_freq ALPHA_231_FREQ_CPS[];
+extern const uint32_t ALPHA_231_UPPER_CPS[];
+extern const uint32_t ALPHA_231_LOWER_CPS[];
+extern const uint32_t ALPHA_231_DIGITS_CPS[];
+extern const char *ALPHA_232_UPPER[];
+extern const char *ALPHA_232_LOWER[];
+extern const char *ALPHA_232_DIGITS[];
+extern const wa_freq_entry ALPHA_232_FREQ[];
+extern const wa_cp_freq ALPHA_232_FREQ_CPS[];
+extern const uint32_t ALPHA_232_UPPER_CPS[];
+extern const uint32_t ALPHA_232_LOWER_CPS[];
+extern const uint32_t ALPHA_232_DIGITS_CPS[];
+extern const char *ALPHA_233_UPPER[];
+extern const char *ALPHA_233_LOWER[];
+extern const char *ALPHA_233_DIGITS[];
+extern const wa_freq_entry ALPHA_233_FREQ[];
+extern const wa_cp_freq ALPHA_233_FREQ_CPS[];
+extern const uint32_t ALPHA_233_UPPER_CPS[];
+extern const uint32_t ALPHA_233_LOWER_CPS[];
+extern const uint32_t ALPHA_233_DIGITS_CPS[];
+extern const char *ALPHA_234_UPPER[];
+extern const char *ALPHA_234_LOWER[];
+extern const char *ALPHA_234_DIGITS[];
+extern const wa_freq_entry ALPHA_234_FREQ[];
+extern const wa_cp_freq ALPHA_234_FREQ_CPS[];
+extern const uint32_t ALPHA_234_UPPER_CPS[];
+extern const uint32_t ALPHA_234_LOWER_CPS[];
+extern const uint32_t ALPHA_234_DIGITS_CPS[];
+extern const char *ALPHA_235_UPPER[];
+extern const char *ALPHA_235_LOWER[];
+extern const char *ALPHA_235_DIGITS[];
+extern const wa_freq_entry ALPHA_235_FREQ[];
+extern const wa_cp_freq ALPHA_235_FREQ_CPS[];
+extern const uint32_t ALPHA_235_UPPER_CPS[];
+extern const uint32_t ALPHA_235_LOWER_CPS[];
+extern const uint32_t ALPHA_235_DIGITS_CPS[];
+extern const char *ALPHA_236_UPPER[];
+extern const char *ALPHA_236_LOWER[];
+extern const char *ALPHA_236_DIGITS[];
+extern const wa_freq_entry ALPHA_236_FREQ[];
+extern const wa_cp_freq ALPHA_236_FREQ_CPS[];
+extern const uint32_t ALPHA_236_UPPER_CPS[];
+extern const uint32_t ALPHA_236_LOWER_CPS[];
+extern const uint32_t ALPHA_236_DIGITS_CPS[];
+extern const char *ALPHA_237_UPPER[];
+extern const char *ALPHA_237_LOWER[];
+extern const char *ALPHA_237_DIGITS[];
+extern const wa_freq_entry ALPHA_237_FREQ[];
+extern const wa_cp_freq ALPHA_237_FREQ_CPS[];
+extern const uint32_t ALPHA_237_UPPER_CPS[];
+extern const uint32_t ALPHA_237_LOWER_CPS[];
+extern const uint32_t ALPHA_237_DIGITS_CPS[];
+extern const char *ALPHA_238_UPPER[];
+extern const char *ALPHA_238_LOWER[];
+extern const char *ALPHA_238_DIGITS[];
+extern const wa_freq_entry ALPHA_238_FREQ[];
+extern const wa_cp_freq ALPHA_238_FREQ_CPS[];
+extern const uint32_t ALPHA_238_UPPER_CPS[];
+extern const uint32_t ALPHA_238_LOWER_CPS[];
+extern const uint32_t ALPHA_238_DIGITS_CPS[];
+extern const char *ALPHA_239_UPPER[];
+extern const char *ALPHA_239_LOWER[];
+extern const char *ALPHA_239_DIGITS[];
+extern const wa_freq_entry ALPHA_239_FREQ[];
+extern const wa_cp_freq ALPHA_239_FREQ_CPS[];
+extern const uint32_t ALPHA_239_UPPER_CPS[];
+extern const uint32_t ALPHA_239_LOWER_CPS[];
+extern const uint32_t ALPHA_239_DIGITS_CPS[];
+extern const char *ALPHA_240_UPPER[];
+extern const char *ALPHA_240_LOWER[];
+extern const char *ALPHA_240_DIGITS[];
+extern const wa_freq_entry ALPHA_240_FREQ[];
+extern const wa_cp_freq ALPHA_240_FREQ_CPS[];
+extern const uint32_t ALPHA_240_UPPER_CPS[];
+extern const uint32_t ALPHA_240_LOWER_CPS[];
+extern const uint32_t ALPHA_240_DIGITS_CPS[];
+extern const char *ALPHA_241_UPPER[];
+extern const char *ALPHA_241_LOWER[];
+extern const char *ALPHA_241_DIGITS[];
+extern const wa_freq_entry ALPHA_241_FREQ[];
+extern const wa_cp_freq ALPHA_241_FREQ_CPS[];
+extern const uint32_t ALPHA_241_UPPER_CPS[];
+extern const uint32_t ALPHA_241_LOWER_CPS[];
+extern const uint32_t ALPHA_241_DIGITS_CPS[];
+extern const char *ALPHA_242_UPPER[];
+extern const char *ALPHA_242_LOWER[];
+extern const char *ALPHA_242_DIGITS[];
+extern const wa_freq_entry ALPHA_242_FREQ[];
+extern const wa_cp_freq ALPHA_242_FREQ_CPS[];
+extern const uint32_t ALPHA_242_UPPER_CPS[];
+extern const uint32_t ALPHA_242_LOWER_CPS[];
+extern const uint32_t ALPHA_242_DIGITS_CPS[];
+extern const char *ALPHA_243_UPPER[];
+extern const char *ALPHA_243_LOWER[];
+extern const char *ALPHA_243_DIGITS[];
+extern const wa_freq_entry ALPHA_243_FREQ[];
+extern const wa_cp_freq ALPHA_243_FREQ_CPS[];
+extern const uint32_t ALPHA_243_UPPER_CPS[];
+extern const uint32_t ALPHA_243_LOWER_CPS[];
+extern const uint32_t ALPHA_243_DIGITS_CPS[];
+extern const char *ALPHA_244_UPPER[];
+extern const char *ALPHA_244_LOWER[];
+extern const char *ALPHA_244_DIGITS[];
+extern const wa_freq_entry ALPHA_244_FREQ[];
+extern const wa_cp_freq ALPHA_244_FREQ_CPS[];
+extern const uint32_t ALPHA_244_UPPER_CPS[];
+extern const uint32_t ALPHA_244_LOWER_CPS[];
+extern const uint32_t ALPHA_244_DIGITS_CPS[];
+extern const char *ALPHA_245_UPPER[];
+extern const char *ALPHA_245_LOWER[];
+extern const char *ALPHA_245_DIGITS[];
+extern const wa_freq_entry ALPHA_245_FREQ[];
+extern const wa_cp_freq ALPHA_245_FREQ_CPS[];
+extern const uint32_t ALPHA_245_UPPER_CPS[];
+extern const uint32_t ALPHA_245_LOWER_CPS[];
+extern const uint32_t ALPHA_245_DIGITS_CPS[];
+extern const char *ALPHA_246_UPPER[];
+extern const char *ALPHA_246_LOWER[];
+extern const char *ALPHA_246_DIGITS[];
+extern const wa_freq_entry ALPHA_246_FREQ[];
+extern const wa_cp_freq ALPHA_246_FREQ_CPS[];
+extern const uint32_t ALPHA_246_UPPER_CPS[];
+extern const uint32_t ALPHA_246_LOWER_CPS[];
+extern const uint32_t ALPHA_246_DIGITS_CPS[];
+extern const char *ALPHA_247_UPPER[];
+extern const char *ALPHA_247_LOWER[];
+extern const char *ALPHA_247_DIGITS[];
+extern const wa_freq_entry ALPHA_247_FREQ[];
+extern const wa_cp_freq ALPHA_247_FREQ_CPS[];
+extern const uint32_t ALPHA_247_UPPER_CPS[];
+extern const uint32_t ALPHA_247_LOWER_CPS[];
+extern const uint32_t ALPHA_247_DIGITS_CPS[];
+extern const char *ALPHA_248_UPPER[];
+extern const char *ALPHA_248_LOWER[];
+extern const char *ALPHA_248_DIGITS[];
+extern const wa_freq_entry ALPHA_248_FREQ[];
+extern const wa_cp_freq ALPHA_248_FREQ_CPS[];
+extern const uint32_t ALPHA_248_UPPER_CPS[];
+extern const uint32_t ALPHA_248_LOWER_CPS[];
+extern const uint32_t ALPHA_248_DIGITS_CPS[];
+extern const char *ALPHA_249_UPPER[];
+extern const char *ALPHA_249_LOWER[];
+extern const char *ALPHA_249_DIGITS[];
+extern const wa_freq_entry ALPHA_249_FREQ[];
+extern const wa_cp_freq ALPHA_249_FREQ_CPS[];
+extern const uint32_t ALPHA_249_UPPER_CPS[];
+extern const uint32_t ALPHA_249_LOWER_CPS[];
+extern const uint32_t ALPHA_249_DIGITS_CPS[];
+extern const char *ALPHA_250_UPPER[];
+extern const char *ALPHA_250_LOWER[];
+extern const char *ALPHA_250_DIGITS[];
+extern const wa_freq_entry ALPHA_250_FREQ[];
+extern const wa_cp_freq ALPHA_250_FREQ_CPS[];
+extern const uint32_t ALPHA_250_UPPER_CPS[];
+extern const uint32_t ALPHA_250_LOWER_CPS[];
+extern const uint32_t ALPHA_250_DIGITS_CPS[];
+extern const char *ALPHA_251_UPPER[];
+extern const char *ALPHA_251_LOWER[];
+extern const char *ALPHA_251_DIGITS[];
+extern const wa_freq_entry ALPHA_251_FREQ[];
+extern const wa_cp_freq ALPHA_251_FREQ_CPS[];
+extern const uint32_t ALPHA_251_UPPER_CPS[];
+extern const uint32_t ALPHA_251_LOWER_CPS[];
+extern const uint32_t ALPHA_251_DIGITS_CPS[];
+extern const char *ALPHA_252_UPPER[];
+extern const char *ALPHA_252_LOWER[];
+extern const char *ALPHA_252_DIGITS[];
+extern const wa_freq_entry ALPHA_252_FREQ[];
+extern const wa_cp_freq ALPHA_252_FREQ_CPS[];
+extern const uint32_t ALPHA_252_UPPER_CPS[];
+extern const uint32_t ALPHA_252_LOWER_CPS[];
+extern const uint32_t ALPHA_252_DIGITS_CPS[];
+extern const char *ALPHA_253_UPPER[];
+extern const char *ALPHA_253_LOWER[];
+extern const char *ALPHA_253_DIGITS[];
+extern const wa_freq_entry ALPHA_253_FREQ[];
+extern const wa_cp_freq ALPHA_253_FREQ_CPS[];
+extern const uint32_t ALPHA_253_UPPER_CPS[];
+extern const uint32_t ALPHA_253_LOWER_CPS[];
+extern const uint32_t ALPHA_253_DIGITS_CPS[];
+extern const char *ALPHA_254_UPPER[];
+extern const char *ALPHA_254_LOWER[];
+extern const char *ALPHA_254_DIGITS[];
+extern const wa_freq_entry ALPHA_254_FREQ[];
+extern const wa_cp_freq ALPHA_254_FREQ_CPS[];
+extern const uint32_t ALPHA_254_UPPER_CPS[];
+extern const uint32_t ALPHA_254_LOWER_CPS[];
+extern const uint32_t ALPHA_254_DIGITS_CPS[];
+extern const char *ALPHA_255_UPPER[];
+extern const char *ALPHA_255_LOWER[];
+extern const char *ALPHA_255_DIGITS[];
+extern const wa_freq_entry ALPHA_255_FREQ[];
+extern const wa_cp_freq ALPHA_255_FREQ_CPS[];
+extern const uint32_t ALPHA_255_UPPER_CPS[];
+extern const uint32_t ALPHA_255_LOWER_CPS[];
+extern const uint32_t ALPHA_255_DIGITS_CPS[];
+extern const char *ALPHA_256_UPPER[];
+extern const char *ALPHA_256_LOWER[];
+extern const char *ALPHA_256_DIGITS[];
+extern const wa_freq_entry ALPHA_256_FREQ[];
+extern const wa_cp_freq ALPHA_256_FREQ_CPS[];
+extern const uint32_t ALPHA_256_UPPER_CPS[];
+extern const uint32_t ALPHA_256_LOWER_CPS[];
+extern const uint32_t ALPHA_256_DIGITS_CPS[];
+extern const char *ALPHA_257_UPPER[];
+extern const char *ALPHA_257_LOWER[];
+extern const char *ALPHA_257_DIGITS[];
+extern const wa_freq_entry ALPHA_257_FREQ[];
+extern const wa_cp_freq ALPHA_257_FREQ_CPS[];
+extern const uint32_t ALPHA_257_UPPER_CPS[];
+extern const uint32_t ALPHA_257_LOWER_CPS[];
+extern const uint32_t ALPHA_257_DIGITS_CPS[];
+extern const char *ALPHA_258_UPPER[];
+extern const char *ALPHA_258_LOWER[];
+extern const char *ALPHA_258_DIGITS[];
+extern const wa_freq_entry ALPHA_258_FREQ[];
+extern const wa_cp_freq ALPHA_258_FREQ_CPS[];
+extern const uint32_t ALPHA_258_UPPER_CPS[];
+extern const uint32_t ALPHA_258_LOWER_CPS[];
+extern const uint32_t ALPHA_258_DIGITS_CPS[];
+extern const char *ALPHA_259_UPPER[];
+extern const char *ALPHA_259_LOWER[];
+extern const char *ALPHA_259_DIGITS[];
+extern const wa_freq_entry ALPHA_259_FREQ[];
+extern const wa_cp_freq ALPHA_259_FREQ_CPS[];
+extern const uint32_t ALPHA_259_UPPER_CPS[];
+extern const uint32_t ALPHA_259_LOWER_CPS[];
+extern const uint32_t ALPHA_259_DIGITS_CPS[];
+extern const char *ALPHA_260_UPPER[];
+extern const char *ALPHA_260_LOWER[];
+extern const char *ALPHA_260_DIGITS[];
+extern const wa_freq_entry ALPHA_260_FREQ[];
+extern const wa_cp_freq ALPHA_260_FREQ_CPS[];
+extern const uint32_t ALPHA_260_UPPER_CPS[];
+extern const uint32_t ALPHA_260_LOWER_CPS[];
+extern const uint32_t ALPHA_260_DIGITS_CPS[];
+extern const char *ALPHA_261_UPPER[];
+extern const char *ALPHA_261_LOWER[];
+extern const char *ALPHA_261_DIGITS[];
+extern const wa_freq_entry ALPHA_261_FREQ[];
+extern const wa_cp_freq ALPHA_261_FREQ_CPS[];
+extern const uint32_t ALPHA_261_UPPER_CPS[];
+extern const uint32_t ALPHA_261_LOWER_CPS[];
+extern const uint32_t ALPHA_261_DIGITS_CPS[];
+extern const char *ALPHA_262_UPPER[];
+extern const char *ALPHA_262_LOWER[];
+extern const char *ALPHA_262_DIGITS[];
+extern const wa_freq_entry ALPHA_262_FREQ[];
+extern const wa_cp_freq ALPHA_262_FREQ_CPS[];
+extern const uint32_t ALPHA_262_UPPER_CPS[];
+extern const uint32_t ALPHA_262_LOWER_CPS[];
+extern const uint32_t ALPHA_262_DIGITS_CPS[];
+extern const char *ALPHA_263_UPPER[];
+extern const char *ALPHA_263_LOWER[];
+extern const char *ALPHA_263_DIGITS[];
+extern const wa_freq_entry ALPHA_263_FREQ[];
+extern const wa_cp_freq ALPHA_263_FREQ_CPS[];
+extern const uint32_t ALPHA_263_UPPER_CPS[];
+extern const uint32_t ALPHA_263_LOWER_CPS[];
+extern const uint32_t ALPHA_263_DIGITS_CPS[];
+extern const char *ALPHA_264_UPPER[];
+extern const char *ALPHA_264_LOWER[];
+extern const char *ALPHA_264_DIGITS[];
+extern const wa_freq_entry ALPHA_264_FREQ[];
+extern const wa_cp_freq ALPHA_264_FREQ_CPS[];
+extern const uint32_t ALPHA_264_UPPER_CPS[];
+extern const uint32_t ALPHA_264_LOWER_CPS[];
+extern const uint32_t ALPHA_264_DIGITS_CPS[];
+extern const char *ALPHA_265_UPPER[];
+extern const char *ALPHA_265_LOWER[];
+extern const char *ALPHA_265_DIGITS[];
+extern const wa_freq_entry ALPHA_265_FREQ[];
+extern const wa_cp_freq ALPHA_265_FREQ_CPS[];
+extern const uint32_t ALPHA_265_UPPER_CPS[];
+extern const uint32_t ALPHA_265_LOWER_CPS[];
+extern const uint32_t ALPHA_265_DIGITS_CPS[];
+extern const char *ALPHA_266_UPPER[];
+extern const char *ALPHA_266_LOWER[];
+extern const char *ALPHA_266_DIGITS[];
+extern const wa_freq_entry ALPHA_266_FREQ[];
+extern const wa_cp_freq ALPHA_266_FREQ_CPS[];
+extern const uint32_t ALPHA_266_UPPER_CPS[];
+extern const uint32_t ALPHA_266_LOWER_CPS[];
+extern const uint32_t ALPHA_266_DIGITS_CPS[];
+extern const char *ALPHA_267_UPPER[];
+extern const char *ALPHA_267_LOWER[];
+extern const char *ALPHA_267_DIGITS[];
+extern const wa_freq_entry ALPHA_267_FREQ[];
+extern const wa_cp_freq ALPHA_267_FREQ_CPS[];
+extern const uint32_t ALPHA_267_UPPER_CPS[];
+extern const uint32_t ALPHA_267_LOWER_CPS[];
+extern const uint32_t ALPHA_267_DIGITS_CPS[];
+extern const char *ALPHA_268_UPPER[];
+extern const char *ALPHA_268_LOWER[];
+extern const char *ALPHA_268_DIGITS[];
+extern const wa_freq_entry ALPHA_268_FREQ[];
+extern const wa_cp_freq ALPHA_268_FREQ_CPS[];
+extern const uint32_t ALPHA_268_UPPER_CPS[];
+extern const uint32_t ALPHA_268_LOWER_CPS[];
+extern const uint32_t ALPHA_268_DIGITS_CPS[];
+extern const char *ALPHA_269_UPPER[];
+extern const char *ALPHA_269_LOWER[];
+extern const char *ALPHA_269_DIGITS[];
+extern const wa_freq_entry ALPHA_269_FREQ[];
+extern const wa_cp_freq ALPHA_269_FREQ_CPS[];
+extern const uint32_t ALPHA_269_UPPER_CPS[];
+extern const uint32_t ALPHA_269_LOWER_CPS[];
+extern const uint32_t ALPHA_269_DIGITS_CPS[];
+extern const char *ALPHA_270_UPPER[];
+extern const char *ALPHA_270_LOWER[];
+extern const char *ALPHA_270_DIGITS[];
+extern const wa_freq_entry ALPHA_270_FREQ[];
+extern const wa_cp_freq ALPHA_270_FREQ_CPS[];
+extern const uint32_t ALPHA_270_UPPER_CPS[];
+extern const uint32_t ALPHA_270_LOWER_CPS[];
+extern const uint32_t ALPHA_270_DIGITS_CPS[];
+extern const char *ALPHA_271_UPPER[];
+extern const char *ALPHA_271_LOWER[];
+extern const char *ALPHA_271_DIGITS[];
+extern const wa_freq_entry ALPHA_271_FREQ[];
+extern const wa_cp_freq ALPHA_271_FREQ_CPS[];
+extern const uint32_t ALPHA_271_UPPER_CPS[];
+extern const uint32_t ALPHA_271_LOWER_CPS[];
+extern const uint32_t ALPHA_271_DIGITS_CPS[];
+extern const char *ALPHA_272_UPPER[];
+extern const char *ALPHA_272_LOWER[];
+extern const char *ALPHA_272_DIGITS[];
+extern const wa_freq_entry ALPHA_272_FREQ[];
+extern const wa_cp_freq ALPHA_272_FREQ_CPS[];
+extern const uint32_t ALPHA_272_UPPER_CPS[];
+extern const uint32_t ALPHA_272_LOWER_CPS[];
+extern const uint32_t ALPHA_272_DIGITS_CPS[];
+extern const char *ALPHA_273_UPPER[];
+extern const char *ALPHA_273_LOWER[];
+extern const char *ALPHA_273_DIGITS[];
+extern const wa_freq_entry ALPHA_273_FREQ[];
+extern const wa_cp_freq ALPHA_273_FREQ_CPS[];
+extern const uint32_t ALPHA_273_UPPER_CPS[];
+extern const uint32_t ALPHA_273_LOWER_CPS[];
+extern const uint32_t ALPHA_273_DIGITS_CPS[];
+extern const char *ALPHA_274_UPPER[];
+extern const char *ALPHA_274_LOWER[];
+extern const char *ALPHA_274_DIGITS[];
+extern const wa_freq_entry ALPHA_274_FREQ[];
+extern const wa_cp_freq ALPHA_274_FREQ_CPS[];
+extern const uint32_t ALPHA_274_UPPER_CPS[];
+extern const uint32_t ALPHA_274_LOWER_CPS[];
+extern const uint32_t ALPHA_274_DIGITS_CPS[];
+extern const char *ALPHA_275_UPPER[];
+extern const char *ALPHA_275_LOWER[];
+extern const char *ALPHA_275_DIGITS[];
+extern const wa_freq_entry ALPHA_275_FREQ[];
+extern const wa_cp_freq ALPHA_275_FREQ_CPS[];
+extern const uint32_t ALPHA_275_UPPER_CPS[];
+extern const uint32_t ALPHA_275_LOWER_CPS[];
+extern const uint32_t ALPHA_275_DIGITS_CPS[];
+extern const char *ALPHA_276_UPPER[];
+extern const char *ALPHA_276_LOWER[];
+extern const char *ALPHA_276_DIGITS[];
+extern const wa_freq_entry ALPHA_276_FREQ[];
+extern const wa_cp_freq ALPHA_276_FREQ_CPS[];
+extern const uint32_t ALPHA_276_UPPER_CPS[];
+extern const uint32_t ALPHA_276_LOWER_CPS[];
+extern const uint32_t ALPHA_276_DIGITS_CPS[];
+extern const char *ALPHA_277_UPPER[];
+extern const char *ALPHA_277_LOWER[];
+extern const char *ALPHA_277_DIGITS[];
+extern const wa_freq_entry ALPHA_277_FREQ[];
+extern const wa_cp_freq ALPHA_277_FREQ_CPS[];
+extern const uint32_t ALPHA_277_UPPER_CPS[];
+extern const uint32_t ALPHA_277_LOWER_CPS[];
+extern const uint32_t ALPHA_277_DIGITS_CPS[];
+extern const char *ALPHA_278_UPPER[];
+extern const char *ALPHA_278_LOWER[];
+extern const char *ALPHA_278_DIGITS[];
+extern const wa_freq_entry ALPHA_278_FREQ[];
+extern const wa_cp_freq ALPHA_278_FREQ_CPS[];
+extern const uint32_t ALPHA_278_UPPER_CPS[];
+extern const uint32_t ALPHA_278_LOWER_CPS[];
+extern const uint32_t ALPHA_278_DIGITS_CPS[];
+extern const char *ALPHA_279_UPPER[];
+extern const char *ALPHA_279_LOWER[];
+extern const char *ALPHA_279_DIGITS[];
+extern const wa_freq_entry ALPHA_279_FREQ[];
+extern const wa_cp_freq ALPHA_279_FREQ_CPS[];
+extern const uint32_t ALPHA_279_UPPER_CPS[];
+extern const uint32_t ALPHA_279_LOWER_CPS[];
+extern const uint32_t ALPHA_279_DIGITS_CPS[];
+extern const char *ALPHA_280_UPPER[];
+extern const char *ALPHA_280_LOWER[];
+extern const char *ALPHA_280_DIGITS[];
+extern const wa_freq_entry ALPHA_280_FREQ[];
+extern const wa_cp_freq ALPHA_280_FREQ_CPS[];
+extern const uint32_t ALPHA_280_UPPER_CPS[];
+extern const uint32_t ALPHA_280_LOWER_CPS[];
+extern const uint32_t ALPHA_280_DIGITS_CPS[];
+extern const char *ALPHA_281_UPPER[];
+extern const char *ALPHA_281_LOWER[];
+extern const char *ALPHA_281_DIGITS[];
+extern const wa_freq_entry ALPHA_281_FREQ[];
+extern const wa_cp_freq ALPHA_281_FREQ_CPS[];
+extern const uint32_t ALPHA_281_UPPER_CPS[];
+extern const uint32_t ALPHA_281_LOWER_CPS[];
+extern const uint32_t ALPHA_281_DIGITS_CPS[];
+extern const char *ALPHA_282_UPPER[];
+extern const char *ALPHA_282_LOWER[];
+extern const char *ALPHA_282_DIGITS[];
+extern const wa_freq_entry ALPHA_282_FREQ[];
+extern const wa_cp_freq ALPHA_282_FREQ_CPS[];
+extern const uint32_t ALPHA_282_UPPER_CPS[];
+extern const uint32_t ALPHA_282_LOWER_CPS[];
+extern const uint32_t ALPHA_282_DIGITS_CPS[];
+extern const char *ALPHA_283_UPPER[];
+extern const char *ALPHA_283_LOWER[];
+extern const char *ALPHA_283_DIGITS[];
+extern const wa_freq_entry ALPHA_283_FREQ[];
+extern const wa_cp_freq ALPHA_283_FREQ_CPS[];
+extern const uint32_t ALPHA_283_UPPER_CPS[];
+extern const uint32_t ALPHA_283_LOWER_CPS[];
+extern const uint32_t ALPHA_283_DIGITS_CPS[];
+extern const char *ALPHA_284_UPPER[];
+extern const char *ALPHA_284_LOWER[];
+extern const char *ALPHA_284_DIGITS[];
+extern const wa_freq_entry ALPHA_284_FREQ[];
+extern const wa_cp_freq ALPHA_284_FREQ_CPS[];
+extern const uint32_t ALPHA_284_UPPER_CPS[];
+extern const uint32_t ALPHA_284_LOWER_CPS[];
+extern const uint32_t ALPHA_284_DIGITS_CPS[];
+extern const char *ALPHA_285_UPPER[];
+extern const char *ALPHA_285_LOWER[];
+extern const char *ALPHA_285_DIGITS[];
+extern const wa_freq_entry ALPHA_285_FREQ[];
+extern const wa_cp_freq ALPHA_285_FREQ_CPS[];
+extern const uint32_t ALPHA_285_UPPER_CPS[];
+extern const uint32_t ALPHA_285_LOWER_CPS[];
+extern const uint32_t ALPHA_285_DIGITS_CPS[];
+extern const char *ALPHA_286_UPPER[];
+extern const char *ALPHA_286_LOWER[];
+extern const char *ALPHA_286_DIGITS[];
+extern const wa_freq_entry ALPHA_286_FREQ[];
+extern const wa_cp_freq ALPHA_286_FREQ_CPS[];
+extern const uint32_t ALPHA_286_UPPER_CPS[];
+extern const uint32_t ALPHA_286_LOWER_CPS[];
+extern const uint32_t ALPHA_286_DIGITS_CPS[];
+extern const char *ALPHA_287_UPPER[];
+extern const char *ALPHA_287_LOWER[];
+extern const char *ALPHA_287_DIGITS[];
+extern const wa_freq_entry ALPHA_287_FREQ[];
+extern const wa_cp_freq ALPHA_287_FREQ_CPS[];
+extern const uint32_t ALPHA_287_UPPER_CPS[];
+extern const uint32_t ALPHA_287_LOWER_CPS[];
+extern const uint32_t ALPHA_287_DIGITS_CPS[];
+extern const char *ALPHA_288_UPPER[];
+extern const char *ALPHA_288_LOWER[];
+extern const char *ALPHA_288_DIGITS[];
+extern const wa_freq_entry ALPHA_288_FREQ[];
+extern const wa_cp_freq ALPHA_288_FREQ_CPS[];
+extern const uint32_t ALPHA_288_UPPER_CPS[];
+extern const uint32_t ALPHA_288_LOWER_CPS[];
+extern const uint32_t ALPHA_288_DIGITS_CPS[];
+extern const char *ALPHA_289_UPPER[];
+extern const char *ALPHA_289_LOWER[];
+extern const char *ALPHA_289_DIGITS[];
+extern const wa_freq_entry ALPHA_289_FREQ[];
+extern const wa_cp_freq ALPHA_289_FREQ_CPS[];
+extern const uint32_t ALPHA_289_UPPER_CPS[];
+extern const uint32_t ALPHA_289_LOWER_CPS[];
+extern const uint32_t ALPHA_289_DIGITS_CPS[];
+extern const char *ALPHA_290_UPPER[];
+extern const char *ALPHA_290_LOWER[];
+extern const char *ALPHA_290_DIGITS[];
+extern const wa_freq_entry ALPHA_290_FREQ[];
+extern const wa_cp_freq ALPHA_290_FREQ_CPS[];
+extern const uint32_t ALPHA_290_UPPER_CPS[];
+extern const uint32_t ALPHA_290_LOWER_CPS[];
+extern const uint32_t ALPHA_290_DIGITS_CPS[];
+extern const char *ALPHA_291_UPPER[];
+extern const char *ALPHA_291_LOWER[];
+extern const char *ALPHA_291_DIGITS[];
+extern const wa_freq_entry ALPHA_291_FREQ[];
+extern const wa_cp_freq ALPHA_291_FREQ_CPS[];
+extern const uint32_t ALPHA_291_UPPER_CPS[];
+extern const uint32_t ALPHA_291_LOWER_CPS[];
+extern const uint32_t ALPHA_291_DIGITS_CPS[];
+extern const char *ALPHA_292_UPPER[];
+extern const char *ALPHA_292_LOWER[];
+extern const char *ALPHA_292_DIGITS[];
+extern const wa_freq_entry ALPHA_292_FREQ[];
+extern const wa_cp_freq ALPHA_292_FREQ_CPS[];
+extern const uint32_t ALPHA_292_UPPER_CPS[];
+extern const uint32_t ALPHA_292_LOWER_CPS[];
+extern const uint32_t ALPHA_292_DIGITS_CPS[];
+extern const char *ALPHA_293_UPPER[];
+extern const char *ALPHA_293_LOWER[];
+extern const char *ALPHA_293_DIGITS[];
+extern const wa_freq_entry ALPHA_293_FREQ[];
+extern const wa_cp_freq ALPHA_293_FREQ_CPS[];
+extern const uint32_t ALPHA_293_UPPER_CPS[];
+extern const uint32_t ALPHA_293_LOWER_CPS[];
+extern const uint32_t ALPHA_293_DIGITS_CPS[];
+extern const char *ALPHA_294_UPPER[];
+extern const char *ALPHA_294_LOWER[];
+extern const char *ALPHA_294_DIGITS[];
+extern const wa_freq_entry ALPHA_294_FREQ[];
+extern const wa_cp_freq ALPHA_294_FREQ_CPS[];
+extern const uint32_t ALPHA_294_UPPER_CPS[];
+extern const uint32_t ALPHA_294_LOWER_CPS[];
+extern const uint32_t ALPHA_294_DIGITS_CPS[];
+extern const char *ALPHA_295_UPPER[];
+extern const char *ALPHA_295_LOWER[];
+extern const char *ALPHA_295_DIGITS[];
+extern const wa_freq_entry ALPHA_295_FREQ[];
+extern const wa_cp_freq ALPHA_295_FREQ_CPS[];
+extern const uint32_t ALPHA_295_UPPER_CPS[];
+extern const uint32_t ALPHA_295_LOWER_CPS[];
+extern const uint32_t ALPHA_295_DIGITS_CPS[];
+extern const char *ALPHA_296_UPPER[];
+extern const char *ALPHA_296_LOWER[];
+extern const char *ALPHA_296_DIGITS[];
+extern const wa_freq_entry ALPHA_296_FREQ[];
+extern const wa_cp_freq ALPHA_296_FREQ_CPS[];
+extern const uint32_t ALPHA_296_UPPER_CPS[];
+extern const uint32_t ALPHA_296_LOWER_CPS[];
+extern const uint32_t ALPHA_296_DIGITS_CPS[];
+extern const char *ALPHA_297_UPPER[];
+extern const char *ALPHA_297_LOWER[];
+extern const char *ALPHA_297_DIGITS[];
+extern const wa_freq_entry ALPHA_297_FREQ[];
+extern const wa_cp_freq ALPHA_297_FREQ_CPS[];
+extern const uint32_t ALPHA_297_UPPER_CPS[];
+extern const uint32_t ALPHA_297_LOWER_CPS[];
+extern const uint32_t ALPHA_297_DIGITS_CPS[];
+extern const char *ALPHA_298_UPPER[];
+extern const char *ALPHA_298_LOWER[];
+extern const char *ALPHA_298_DIGITS[];
+extern const wa_freq_entry ALPHA_298_FREQ[];
+extern const wa_cp_freq ALPHA_298_FREQ_CPS[];
+extern const uint32_t ALPHA_298_UPPER_CPS[];
+extern const uint32_t ALPHA_298_LOWER_CPS[];
+extern const uint32_t ALPHA_298_DIGITS_CPS[];
+extern const char *ALPHA_299_UPPER[];
+extern const char *ALPHA_299_LOWER[];
+extern const char *ALPHA_299_DIGITS[];
+extern const wa_freq_entry ALPHA_299_FREQ[];
+extern const wa_cp_freq ALPHA_299_FREQ_CPS[];
+extern const uint32_t ALPHA_299_UPPER_CPS[];
+extern const uint32_t ALPHA_299_LOWER_CPS[];
+extern const uint32_t ALPHA_299_DIGITS_CPS[];
+extern const char *ALPHA_300_UPPER[];
+extern const char *ALPHA_300_LOWER[];
+extern const char *ALPHA_300_DIGITS[];
+extern const wa_freq_entry ALPHA_300_FREQ[];
+extern const wa_cp_freq ALPHA_300_FREQ_CPS[];
+extern const uint32_t ALPHA_300_UPPER_CPS[];
+extern const uint32_t ALPHA_300_LOWER_CPS[];
+extern const uint32_t ALPHA_300_DIGITS_CPS[];
+extern const char *ALPHA_301_UPPER[];
+extern const char *ALPHA_301_LOWER[];
+extern const char *ALPHA_301_DIGITS[];
+extern const wa_freq_entry ALPHA_301_FREQ[];
+extern const wa_cp_freq ALPHA_301_FREQ_CPS[];
+extern const uint32_t ALPHA_301_UPPER_CPS[];
+extern const uint32_t ALPHA_301_LOWER_CPS[];
+extern const uint32_t ALPHA_301_DIGITS_CPS[];
+extern const char *ALPHA_302_UPPER[];
+extern const char *ALPHA_302_LOWER[];
+extern const char *ALPHA_302_DIGITS[];
+extern const wa_freq_entry ALPHA_302_FREQ[];
+extern const wa_cp_freq ALPHA_302_FREQ_CPS[];
+extern const uint32_t ALPHA_302_UPPER_CPS[];
+extern const uint32_t ALPHA_302_LOWER_CPS[];
+extern const uint32_t ALPHA_302_DIGITS_CPS[];
+extern const char *ALPHA_303_UPPER[];
+extern const char *ALPHA_303_LOWER[];
+extern const char *ALPHA_303_DIGITS[];
+extern const wa_freq_entry ALPHA_303_FREQ[];
+extern const wa_cp_freq ALPHA_303_FREQ_CPS[];
+extern const uint32_t ALPHA_303_UPPER_CPS[];
+extern const uint32_t ALPHA_303_LOWER_CPS[];
+extern const uint32_t ALPHA_303_DIGITS_CPS[];
+extern const char *ALPHA_304_UPPER[];
+extern const char *ALPHA_304_LOWER[];
+extern const char *ALPHA_304_DIGITS[];
+extern const wa_freq_entry ALPHA_304_FREQ[];
+extern const wa_cp_freq ALPHA_304_FREQ_CPS[];
+extern const uint32_t ALPHA_304_UPPER_CPS[];
+extern const uint32_t ALPHA_304_LOWER_CPS[];
+extern const uint32_t ALPHA_304_DIGITS_CPS[];
+extern const char *ALPHA_305_UPPER[];
+extern const char *ALPHA_305_LOWER[];
+extern const char *ALPHA_305_DIGITS[];
+extern const wa_freq_entry ALPHA_305_FREQ[];
+extern const wa_cp_freq ALPHA_305_FREQ_CPS[];
+extern const uint32_t ALPHA_305_UPPER_CPS[];
+extern const uint32_t ALPHA_305_LOWER_CPS[];
+extern const uint32_t ALPHA_305_DIGITS_CPS[];
+extern const char *ALPHA_306_UPPER[];
+extern const char *ALPHA_306_LOWER[];
+extern const char *ALPHA_306_DIGITS[];
+extern const wa_freq_entry ALPHA_306_FREQ[];
+extern const wa_cp_freq ALPHA_306_FREQ_CPS[];
+extern const uint32_t ALPHA_306_UPPER_CPS[];
+extern const uint32_t ALPHA_306_LOWER_CPS[];
+extern const uint32_t ALPHA_306_DIGITS_CPS[];
+extern const char *ALPHA_307_UPPER[];
+extern const char *ALPHA_307_LOWER[];
+extern const char *ALPHA_307_DIGITS[];
+extern const wa_freq_entry ALPHA_307_FREQ[];
+extern const wa_cp_freq ALPHA_307_FREQ_CPS[];
+extern const uint32_t ALPHA_307_UPPER_CPS[];
+extern const uint32_t ALPHA_307_LOWER_CPS[];
+extern const uint32_t ALPHA_307_DIGITS_CPS[];
+extern const char *ALPHA_308_UPPER[];
+extern const char *ALPHA_308_LOWER[];
+extern const char *ALPHA_308_DIGITS[];
+extern const wa_freq_entry ALPHA_308_FREQ[];
+extern const wa_cp_freq ALPHA_308_FREQ_CPS[];
+extern const uint32_t ALPHA_308_UPPER_CPS[];
+extern const uint32_t ALPHA_308_LOWER_CPS[];
+extern const uint32_t ALPHA_308_DIGITS_CPS[];
+extern const char *ALPHA_309_UPPER[];
+extern const char *ALPHA_309_LOWER[];
+extern const char *ALPHA_309_DIGITS[];
+extern const wa_freq_entry ALPHA_309_FREQ[];
+extern const wa_cp_freq ALPHA_309_FREQ_CPS[];
+extern const uint32_t ALPHA_309_UPPER_CPS[];
+extern const uint32_t ALPHA_309_LOWER_CPS[];
+extern const uint32_t ALPHA_309_DIGITS_CPS[];
+extern const char *ALPHA_310_UPPER[];
+extern const char *ALPHA_310_LOWER[];
+extern const char *ALPHA_310_DIGITS[];
+extern const wa_freq_entry ALPHA_310_FREQ[];
+extern const wa_cp_freq ALPHA_310_FREQ_CPS[];
+extern const uint32_t ALPHA_310_UPPER_CPS[];
+extern const uint32_t ALPHA_310_LOWER_CPS[];
+extern const uint32_t ALPHA_310_DIGITS_CPS[];
+extern const char *ALPHA_311_UPPER[];
+extern const char *ALPHA_311_LOWER[];
+extern const char *ALPHA_311_DIGITS[];
+extern const wa_freq_entry ALPHA_311_FREQ[];
+extern const wa_cp_freq ALPHA_311_FREQ_CPS[];
+extern const uint32_t ALPHA_311_UPPER_CPS[];
+extern const uint32_t ALPHA_311_LOWER_CPS[];
+extern const uint32_t ALPHA_311_DIGITS_CPS[];
+extern const char *ALPHA_312_UPPER[];
+extern const char *ALPHA_312_LOWER[];
+extern const char *ALPHA_312_DIGITS[];
+extern const wa_freq_entry ALPHA_312_FREQ[];
+extern const wa_cp_freq ALPHA_312_FREQ_CPS[];
+extern const uint32_t ALPHA_312_UPPER_CPS[];
+extern const uint32_t ALPHA_312_LOWER_CPS[];
+extern const uint32_t ALPHA_312_DIGITS_CPS[];
+extern const char *ALPHA_313_UPPER[];
+extern const char *ALPHA_313_LOWER[];
+extern const char *ALPHA_313_DIGITS[];
+extern const wa_freq_entry ALPHA_313_FREQ[];
+extern const wa_cp_freq ALPHA_313_FREQ_CPS[];
+extern const uint32_t ALPHA_313_UPPER_CPS[];
+extern const uint32_t ALPHA_313_LOWER_CPS[];
+extern const uint32_t ALPHA_313_DIGITS_CPS[];
+extern const char *ALPHA_314_UPPER[];
+extern const char *ALPHA_314_LOWER[];
+extern const char *ALPHA_314_DIGITS[];
+extern const wa_freq_entry ALPHA_314_FREQ[];
+extern const wa_cp_freq ALPHA_314_FREQ_CPS[];
+extern const uint32_t ALPHA_314_UPPER_CPS[];
+extern const uint32_t ALPHA_314_LOWER_CPS[];
+extern const uint32_t ALPHA_314_DIGITS_CPS[];
+extern const char *ALPHA_315_UPPER[];
+extern const char *ALPHA_315_LOWER[];
+extern const char *ALPHA_315_DIGITS[];
+extern const wa_freq_entry ALPHA_315_FREQ[];
+extern const wa_cp_freq ALPHA_315_FREQ_CPS[];
+extern const uint32_t ALPHA_315_UPPER_CPS[];
+extern const uint32_t ALPHA_315_LOWER_CPS[];
+extern const uint32_t ALPHA_315_DIGITS_CPS[];
+extern const char *ALPHA_316_UPPER[];
+extern const char *ALPHA_316_LOWER[];
+extern const char *ALPHA_316_DIGITS[];
+extern const wa_freq_entry ALPHA_316_FREQ[];
+extern const wa_cp_freq ALPHA_316_FREQ_CPS[];
+extern const uint32_t ALPHA_316_UPPER_CPS[];
+extern const uint32_t ALPHA_316_LOWER_CPS[];
+extern const uint32_t ALPHA_316_DIGITS_CPS[];
+extern const char *ALPHA_317_UPPER[];
+extern const char *ALPHA_317_LOWER[];
+extern const char *ALPHA_317_DIGITS[];
+extern const wa_freq_entry ALPHA_317_FREQ[];
+extern const wa_cp_freq ALPHA_317_FREQ_CPS[];
+extern const uint32_t ALPHA_317_UPPER_CPS[];
+extern const uint32_t ALPHA_317_LOWER_CPS[];
+extern const uint32_t ALPHA_317_DIGITS_CPS[];
+extern const char *ALPHA_318_UPPER[];
+extern const char *ALPHA_318_LOWER[];
+extern const char *ALPHA_318_DIGITS[];
+extern const wa_freq_entry ALPHA_318_FREQ[];
+extern const wa_cp_freq ALPHA_318_FREQ_CPS[];
+extern const uint32_t ALPHA_318_UPPER_CPS[];
+extern const uint32_t ALPHA_318_LOWER_CPS[];
+extern const uint32_t ALPHA_318_DIGITS_CPS[];
+extern const char *ALPHA_319_UPPER[];
+extern const char *ALPHA_319_LOWER[];
+extern const char *ALPHA_319_DIGITS[];
+extern const wa_freq_entry ALPHA_319_FREQ[];
+extern const wa_cp_freq ALPHA_319_FREQ_CPS[];
+extern const uint32_t ALPHA_319_UPPER_CPS[];
+extern const uint32_t ALPHA_319_LOWER_CPS[];
+extern const uint32_t ALPHA_319_DIGITS_CPS[];
+extern const char *ALPHA_320_UPPER[];
+extern const char *ALPHA_320_LOWER[];
+extern const char *ALPHA_320_DIGITS[];
+extern const wa_freq_entry ALPHA_320_FREQ[];
+extern const wa_cp_freq ALPHA_320_FREQ_CPS[];
+extern const uint32_t ALPHA_320_UPPER_CPS[];
+extern const uint32_t ALPHA_320_LOWER_CPS[];
+extern const uint32_t ALPHA_320_DIGITS_CPS[];
+extern const char *ALPHA_321_UPPER[];
+extern const char *ALPHA_321_LOWER[];
+extern const char *ALPHA_321_DIGITS[];
+extern const wa_freq_entry ALPHA_321_FREQ[];
+extern const wa_cp_freq ALPHA_321_FREQ_CPS[];
+extern const uint32_t ALPHA_321_UPPER_CPS[];
+extern const uint32_t ALPHA_321_LOWER_CPS[];
+extern const uint32_t ALPHA_321_DIGITS_CPS[];
+extern const char *ALPHA_322_UPPER[];
+extern const char *ALPHA_322_LOWER[];
+extern const char *ALPHA_322_DIGITS[];
+extern const wa_freq_entry ALPHA_322_FREQ[];
+extern const wa_cp_freq ALPHA_322_FREQ_CPS[];
+extern const uint32_t ALPHA_322_UPPER_CPS[];
+extern const uint32_t ALPHA_322_LOWER_CPS[];
+extern const uint32_t ALPHA_322_DIGITS_CPS[];
+extern const char *ALPHA_323_UPPER[];
+extern const char *ALPHA_323_LOWER[];
+extern const char *ALPHA_323_DIGITS[];
+extern const wa_freq_entry ALPHA_323_FREQ[];
+extern const wa_cp_freq ALPHA_323_FREQ_CPS[];
+extern const uint32_t ALPHA_323_UPPER_CPS[];
+extern const uint32_t ALPHA_323_LOWER_CPS[];
+extern const uint32_t ALPHA_323_DIGITS_CPS[];
+extern const char *ALPHA_324_UPPER[];
+extern const char *ALPHA_324_LOWER[];
+extern const char *ALPHA_324_DIGITS[];
+extern const wa_freq_entry ALPHA_324_FREQ[];
+extern const wa_cp_freq ALPHA_324_FREQ_CPS[];
+extern const uint32_t ALPHA_324_UPPER_CPS[];
+extern const uint32_t ALPHA_324_LOWER_CPS[];
+extern const uint32_t ALPHA_324_DIGITS_CPS[];
+extern const char *ALPHA_325_UPPER[];
+extern const char *ALPHA_325_LOWER[];
+extern const char *ALPHA_325_DIGITS[];
+extern const wa_freq_entry ALPHA_325_FREQ[];
+extern const wa_cp_freq ALPHA_325_FREQ_CPS[];
+extern const uint32_t ALPHA_325_UPPER_CPS[];
+extern const uint32_t ALPHA_325_LOWER_CPS[];
+extern const uint32_t ALPHA_325_DIGITS_CPS[];
+extern const char *ALPHA_326_UPPER[];
+extern const char *ALPHA_326_LOWER[];
+extern const char *ALPHA_326_DIGITS[];
+extern const wa_freq_entry ALPHA_326_FREQ[];
+extern const wa_cp_freq ALPHA_326_FREQ_CPS[];
+extern const uint32_t ALPHA_326_UPPER_CPS[];
+extern const uint32_t ALPHA_326_LOWER_CPS[];
+extern const uint32_t ALPHA_326_DIGITS_CPS[];
+extern const char *ALPHA_327_UPPER[];
+extern const char *ALPHA_327_LOWER[];
+extern const char *ALPHA_327_DIGITS[];
+extern const wa_freq_entry ALPHA_327_FREQ[];
+extern const wa_cp_freq ALPHA_327_FREQ_CPS[];
+extern const uint32_t ALPHA_327_UPPER_CPS[];
+extern const uint32_t ALPHA_327_LOWER_CPS[];
+extern const uint32_t ALPHA_327_DIGITS_CPS[];
+extern const char *ALPHA_328_UPPER[];
+extern const char *ALPHA_328_LOWER[];
+extern const char *ALPHA_328_DIGITS[];
+extern const wa_freq_entry ALPHA_328_FREQ[];
+extern const wa_cp_freq ALPHA_328_FREQ_CPS[];
+extern const uint32_t ALPHA_328_UPPER_CPS[];
+extern const uint32_t ALPHA_328_LOWER_CPS[];
+extern const uint32_t ALPHA_328_DIGITS_CPS[];
+extern const char *ALPHA_329_UPPER[];
+extern const char *ALPHA_329_LOWER[];
+extern const char *ALPHA_329_DIGITS[];
+extern const wa_freq_entry ALPHA_329_FREQ[];
+extern const wa_cp_freq ALPHA_329_FREQ_CPS[];
+extern const uint32_t ALPHA_329_UPPER_CPS[];
+extern const uint32_t ALPHA_329_LOWER_CPS[];
+extern const uint32_t ALPHA_329_DIGITS_CPS[];
+extern const char *ALPHA_330_UPPER[];
+extern const char *ALPHA_330_LOWER[];
+extern const char *ALPHA_330_DIGITS[];
+extern const wa_freq_entry ALPHA_330_FREQ[];
+extern const wa_cp_freq ALPHA_330_FREQ_CPS[];
+extern const uint32_t ALPHA_330_UPPER_CPS[];
+extern const uint32_t ALPHA_330_LOWER_CPS[];
+extern const uint32_t ALPHA_330_DIGITS_CPS[];
+extern const char *ALPHA_331_UPPER[];
+extern const char *ALPHA_331_LOWER[];
+extern const char *ALPHA_331_DIGITS[];
+extern const wa_freq_entry ALPHA_331_FREQ[];
+extern const wa_cp_freq ALPHA_331_FREQ_CPS[];
+extern const uint32_t ALPHA_331_UPPER_CPS[];
+extern const uint32_t ALPHA_331_LOWER_CPS[];
+extern const uint32_t ALPHA_331_DIGITS_CPS[];
+extern const char *ALPHA_332_UPPER[];
+extern const char *ALPHA_332_LOWER[];
+extern const char *ALPHA_332_DIGITS[];
+extern const wa_freq_entry ALPHA_332_FREQ[];
+extern const wa_cp_freq ALPHA_332_FREQ_CPS[];
+extern const uint32_t ALPHA_332_UPPER_CPS[];
+extern const uint32_t ALPHA_332_LOWER_CPS[];
+extern const uint32_t ALPHA_332_DIGITS_CPS[];
+extern const char *ALPHA_333_UPPER[];
+extern const char *ALPHA_333_LOWER[];
+extern const char *ALPHA_333_DIGITS[];
+extern const wa_freq_entry ALPHA_333_FREQ[];
+extern const wa_cp_freq ALPHA_333_FREQ_CPS[];
+extern const uint32_t ALPHA_333_UPPER_CPS[];
+extern const uint32_t ALPHA_333_LOWER_CPS[];
+extern const uint32_t ALPHA_333_DIGITS_CPS[];
+extern const char *ALPHA_334_UPPER[];
+extern const char *ALPHA_334_LOWER[];
+extern const char *ALPHA_334_DIGITS[];
+extern const wa_freq_entry ALPHA_334_FREQ[];
+extern const wa_cp_freq ALPHA_334_FREQ_CPS[];
+extern const uint32_t ALPHA_334_UPPER_CPS[];
+extern const uint32_t ALPHA_334_LOWER_CPS[];
+extern const uint32_t ALPHA_334_DIGITS_CPS[];
+extern const char *ALPHA_335_UPPER[];
+extern const char *ALPHA_335_LOWER[];
+extern const char *ALPHA_335_DIGITS[];
+extern const wa_freq_entry ALPHA_335_FREQ[];
+extern const wa_cp_freq ALPHA_335_FREQ_CPS[];
+extern const uint32_t ALPHA_335_UPPER_CPS[];
+extern const uint32_t ALPHA_335_LOWER_CPS[];
+extern const uint32_t ALPHA_335_DIGITS_CPS[];
+extern const char *ALPHA_336_UPPER[];
+extern const char *ALPHA_336_LOWER[];
+extern const char *ALPHA_336_DIGITS[];
+extern const wa_freq_entry ALPHA_336_FREQ[];
+extern const wa_cp_freq ALPHA_336_FREQ_CPS[];
+extern const uint32_t ALPHA_336_UPPER_CPS[];
+extern const uint32_t ALPHA_336_LOWER_CPS[];
+extern const uint32_t ALPHA_336_DIGITS_CPS[];
+extern const char *ALPHA_337_UPPER[];
+extern const char *ALPHA_337_LOWER[];
+extern const char *ALPHA_337_DIGITS[];
+extern const wa_freq_entry ALPHA_337_FREQ[];
+extern const wa_cp_freq ALPHA_337_FREQ_CPS[];
+extern const uint32_t ALPHA_337_UPPER_CPS[];
+extern const uint32_t ALPHA_337_LOWER_CPS[];
+extern const uint32_t ALPHA_337_DIGITS_CPS[];
+extern const char *ALPHA_338_UPPER[];
+extern const char *ALPHA_338_LOWER[];
+extern const char *ALPHA_338_DIGITS[];
+extern const wa_freq_entry ALPHA_338_FREQ[];
+extern const wa_cp_freq ALPHA_338_FREQ_CPS[];
+extern const uint32_t ALPHA_338_UPPER_CPS[];
+extern const uint32_t ALPHA_338_LOWER_CPS[];
+extern const uint32_t ALPHA_338_DIGITS_CPS[];
+extern const char *ALPHA_339_UPPER[];
+extern const char *ALPHA_339_LOWER[];
+extern const char *ALPHA_339_DIGITS[];
+extern const wa_freq_entry ALPHA_339_FREQ[];
+extern const wa_cp_freq ALPHA_339_FREQ_CPS[];
+extern const uint32_t ALPHA_339_UPPER_CPS[];
+extern const uint32_t ALPHA_339_LOWER_CPS[];
+extern const uint32_t ALPHA_339_DIGITS_CPS[];
+extern const char *ALPHA_340_UPPER[];
+extern const char *ALPHA_340_LOWER[];
+extern const char *ALPHA_340_DIGITS[];
+extern const wa_freq_entry ALPHA_340_FREQ[];
+extern const wa_cp_freq ALPHA_340_FREQ_CPS[];
+extern const uint32_t ALPHA_340_UPPER_CPS[];
+extern const uint32_t ALPHA_340_LOWER_CPS[];
+extern const uint32_t ALPHA_340_DIGITS_CPS[];
+extern const char *ALPHA_341_UPPER[];
+extern const char *ALPHA_341_LOWER[];
+extern const char *ALPHA_341_DIGITS[];
+extern const wa_freq_entry ALPHA_341_FREQ[];
+extern const wa_cp_freq ALPHA_341_FREQ_CPS[];
+extern const uint32_t ALPHA_341_UPPER_CPS[];
+extern const uint32_t ALPHA_341_LOWER_CPS[];
+extern const uint32_t ALPHA_341_DIGITS_CPS[];
+
+const wa_alphabet WA_ALPHABETS[] = {
+  {
+    "aa",
+    "Latn",
+    ALPHA_0_UPPER, 22u,
+    ALPHA_0_LOWER, 22u,
+    ALPHA_0_FREQ, 22u,
+    ALPHA_0_DIGITS, 10u,
+    ALPHA_0_UPPER_CPS, 22u,
+    ALPHA_0_LOWER_CPS, 22u,
+    ALPHA_0_DIGITS_CPS, 10u,
+    ALPHA_0_FREQ_CPS, 22u,
+  },
+  {
+    "ab",
+    "Cyrl",
+    ALPHA_1_UPPER, 40u,
+    ALPHA_1_LOWER, 40u,
+    ALPHA_1_FREQ, 40u,
+    ALPHA_1_DIGITS, 10u,
+    ALPHA_1_UPPER_CPS, 40u,
+    ALPHA_1_LOWER_CPS, 40u,
+    ALPHA_1_DIGITS_CPS, 10u,
+    ALPHA_1_FREQ_CPS, 40u,
+  },
+  {
+    "ady",
+    "Cyrl",
+    ALPHA_2_UPPER, 33u,
+    ALPHA_2_LOWER, 33u,
+    ALPHA_2_FREQ, 33u,
+    ALPHA_2_DIGITS, 10u,
+    ALPHA_2_UPPER_CPS, 33u,
+    ALPHA_2_LOWER_CPS, 33u,
+    ALPHA_2_DIGITS_CPS, 10u,
+    ALPHA_2_FREQ_CPS, 33u,
+  },
+  {
+    "af",
+    "Latn",
+    ALPHA_3_UPPER, 37u,
+    ALPHA_3_LOWER, 37u,
+    ALPHA_3_FREQ, 37u,
+    ALPHA_3_DIGITS, 10u,
+    ALPHA_3_UPPER_CPS, 37u,
+    ALPHA_3_LOWER_CPS, 37u,
+    ALPHA_3_DIGITS_CPS, 10u,
+    ALPHA_3_FREQ_CPS, 37u,
+  },
+  {
+    "agq",
+    "Latn",
+    ALPHA_4_UPPER, 48u,
+    ALPHA_4_LOWER, 48u,
+    ALPHA_4_FREQ, 48u,
+    ALPHA_4_DIGITS, 10u,
+    ALPHA_4_UPPER_CPS, 48u,
+    ALPHA_4_LOWER_CPS, 48u,
+    ALPHA_4_DIGITS_CPS, 10u,
+    ALPHA_4_FREQ_CPS, 48u,
+  },
+  {
+    "ak",
+    "Latn",
+    ALPHA_5_UPPER, 22u,
+    ALPHA_5_LOWER, 22u,
+    ALPHA_5_FREQ, 22u,
+    ALPHA_5_DIGITS, 10u,
+    ALPHA_5_UPPER_CPS, 22u,
+    ALPHA_5_LOWER_CPS, 22u,
+    ALPHA_5_DIGITS_CPS, 10u,
+    ALPHA_5_FREQ_CPS, 22u,
+  },
+  {
+    "am",
+    "Ethi",
+    ALPHA_6_UPPER, 282u,
+    ALPHA_6_LOWER, 282u,
+    ALPHA_6_FREQ, 282u,
+    ALPHA_6_DIGITS, 10u,
+    ALPHA_6_UPPER_CPS, 282u,
+    ALPHA_6_LOWER_CPS, 282u,
+    ALPHA_6_DIGITS_CPS, 10u,
+    ALPHA_6_FREQ_CPS, 282u,
+  },
+  {
+    "an",
+    "Latn",
+    ALPHA_7_UPPER, 32u,
+    ALPHA_7_LOWER, 32u,
+    ALPHA_7_FREQ, 32u,
+    ALPHA_7_DIGITS, 10u,
+    ALPHA_7_UPPER_CPS, 32u,
+    ALPHA_7_LOWER_CPS, 32u,
+    ALPHA_7_DIGITS_CPS, 10u,
+    ALPHA_7_FREQ_CPS, 32u,
+  },
+  {
+    "ar",
+    "Arab",
+    ALPHA_8_UPPER, 36u,
+    ALPHA_8_LOWER, 36u,
+    ALPHA_8_FREQ, 36u,
+    ALPHA_8_DIGITS, 10u,
+    ALPHA_8_UPPER_CPS, 36u,
+    ALPHA_8_LOWER_CPS, 36u,
+    ALPHA_8_DIGITS_CPS, 10u,
+    ALPHA_8_FREQ_CPS, 36u,
+  },
+  {
+    "arn",
+    "Latn",
+    ALPHA_9_UPPER, 25u,
+    ALPHA_9_LOWER, 25u,
+    ALPHA_9_FREQ, 25u,
+    ALPHA_9_DIGITS, 10u,
+    ALPHA_9_UPPER_CPS, 25u,
+    ALPHA_9_LOWER_CPS, 25u,
+    ALPHA_9_DIGITS_CPS, 10u,
+    ALPHA_9_FREQ_CPS, 25u,
+  },
+  {
+    "as",
+    "Beng",
+    ALPHA_10_UPPER, 44u,
+    ALPHA_10_LOWER, 44u,
+    ALPHA_10_FREQ, 44u,
+    ALPHA_10_DIGITS, 0u,
+    ALPHA_10_UPPER_CPS, 44u,
+    ALPHA_10_LOWER_CPS, 44u,
+    ALPHA_10_DIGITS_CPS, 0u,
+    ALPHA_10_FREQ_CPS, 44u,
+  },
+  {
+    "asa",
+    "Latn",
+    ALPHA_11_UPPER, 24u,
+    ALPHA_11_LOWER, 24u,
+    ALPHA_11_FREQ, 24u,
+    ALPHA_11_DIGITS, 10u,
+    ALPHA_11_UPPER_CPS, 24u,
+    ALPHA_11_LOWER_CPS, 24u,
+    ALPHA_11_DIGITS_CPS, 10u,
+    ALPHA_11_FREQ_CPS, 24u,
+  },
+  {
+    "ast",
+    "Latn",
+    ALPHA_12_UPPER, 32u,
+    ALPHA_12_LOWER, 32u,
+    ALPHA_12_FREQ, 32u,
+    ALPHA_12_DIGITS, 10u,
+    ALPHA_12_UPPER_CPS, 32u,
+    ALPHA_12_LOWER_CPS, 32u,
+    ALPHA_12_DIGITS_CPS, 10u,
+    ALPHA_12_FREQ_CPS, 32u,
+  },
+  {
+    "ay",
+    "Latn",
+    ALPHA_13_UPPER, 35u,
+    ALPHA_13_LOWER, 35u,
+    ALPHA_13_FREQ, 35u,
+    ALPHA_13_DIGITS, 0u,
+    ALPHA_13_UPPER_CPS, 35u,
+    ALPHA_13_LOWER_CPS, 35u,
+    ALPHA_13_DIGITS_CPS, 0u,
+    ALPHA_13_FREQ_CPS, 35u,
+  },
+  {
+    "az",
+    "Cyrl",
+    ALPHA_14_UPPER, 33u,
+    ALPHA_14_LOWER, 33u,
+    ALPHA_14_FREQ, 33u,
+    ALPHA_14_DIGITS, 10u,
+    ALPHA_14_UPPER_CPS, 33u,
+    ALPHA_14_LOWER_CPS, 33u,
+    ALPHA_14_DIGITS_CPS, 10u,
+    ALPHA_14_FREQ_CPS, 33u,
+  },
+  {
+    "az",
+    "Latn",
+    ALPHA_15_UPPER, 33u,
+    ALPHA_15_LOWER, 33u,
+    ALPHA_15_FREQ, 33u,
+    ALPHA_15_DIGITS, 10u,
+    ALPHA_15_UPPER_CPS, 32u,
+    ALPHA_15_LOWER_CPS, 32u,
+    ALPHA_15_DIGITS_CPS, 10u,
+    ALPHA_15_FREQ_CPS, 32u,
+  },
+  {
+    "ba",
+    "Cyrl",
+    ALPHA_16_UPPER, 42u,
+    ALPHA_16_LOWER, 42u,
+    ALPHA_16_FREQ, 42u,
+    ALPHA_16_DIGITS, 10u,
+    ALPHA_16_UPPER_CPS, 42u,
+    ALPHA_16_LOWER_CPS, 42u,
+    ALPHA_16_DIGITS_CPS, 10u,
+    ALPHA_16_FREQ_CPS, 42u,
+  },
+  {
+    "bal",
+    "Arab",
+    ALPHA_17_UPPER, 28u,
+    ALPHA_17_LOWER, 28u,
+    ALPHA_17_FREQ, 28u,
+    ALPHA_17_DIGITS, 10u,
+    ALPHA_17_UPPER_CPS, 28u,
+    ALPHA_17_LOWER_CPS, 28u,
+    ALPHA_17_DIGITS_CPS, 10u,
+    ALPHA_17_FREQ_CPS, 28u,
+  },
+  {
+    "bal",
+    "Latn",
+    ALPHA_18_UPPER, 26u,
+    ALPHA_18_LOWER, 26u,
+    ALPHA_18_FREQ, 26u,
+    ALPHA_18_DIGITS, 10u,
+    ALPHA_18_UPPER_CPS, 26u,
+    ALPHA_18_LOWER_CPS, 26u,
+    ALPHA_18_DIGITS_CPS, 10u,
+    ALPHA_18_FREQ_CPS, 26u,
+  },
+  {
+    "ban",
+    "Latn",
+    ALPHA_19_UPPER, 76u,
+    ALPHA_19_LOWER, 76u,
+    ALPHA_19_FREQ, 76u,
+    ALPHA_19_DIGITS, 0u,
+    ALPHA_19_UPPER_CPS, 76u,
+    ALPHA_19_LOWER_CPS, 76u,
+    ALPHA_19_DIGITS_CPS, 0u,
+    ALPHA_19_FREQ_CPS, 76u,
+  },
+  {
+    "bas",
+    "Latn",
+    ALPHA_20_UPPER, 55u,
+    ALPHA_20_LOWER, 55u,
+    ALPHA_20_FREQ, 55u,
+    ALPHA_20_DIGITS, 10u,
+    ALPHA_20_UPPER_CPS, 55u,
+    ALPHA_20_LOWER_CPS, 55u,
+    ALPHA_20_DIGITS_CPS, 10u,
+    ALPHA_20_FREQ_CPS, 55u,
+  },
+  {
+    "bax",
+    "Bamu",
+    ALPHA_21_UPPER, 80u,
+    ALPHA_21_LOWER, 80u,
+    ALPHA_21_FREQ, 80u,
+    ALPHA_21_DIGITS, 0u,
+    ALPHA_21_UPPER_CPS, 80u,
+    ALPHA_21_LOWER_CPS, 80u,
+    ALPHA_21_DIGITS_CPS, 0u,
+    ALPHA_21_FREQ_CPS, 80u,
+  },
+  {
+    "be",
+    "Cyrl",
+    ALPHA_22_UPPER, 32u,
+    ALPHA_22_LOWER, 32u,
+    ALPHA_22_FREQ, 32u,
+    ALPHA_22_DIGITS, 0u,
+    ALPHA_22_UPPER_CPS, 32u,
+    ALPHA_22_LOWER_CPS, 32u,
+    ALPHA_22_DIGITS_CPS, 0u,
+    ALPHA_22_FREQ_CPS, 32u,
+  },
+  {
+    "be",
+    "x-old",
+    ALPHA_23_UPPER, 32u,
+    ALPHA_23_LOWER, 32u,
+    ALPHA_23_FREQ, 32u,
+    ALPHA_23_DIGITS, 0u,
+    ALPHA_23_UPPER_CPS, 32u,
+    ALPHA_23_LOWER_CPS, 32u,
+    ALPHA_23_DIGITS_CPS, 0u,
+    ALPHA_23_FREQ_CPS, 32u,
+  },
+  {
+    "bem",
+    "Latn",
+    ALPHA_24_UPPER, 20u,
+    ALPHA_24_LOWER, 20u,
+    ALPHA_24_FREQ, 20u,
+    ALPHA_24_DIGITS, 10u,
+    ALPHA_24_UPPER_CPS, 20u,
+    ALPHA_24_LOWER_CPS, 20u,
+    ALPHA_24_DIGITS_CPS, 10u,
+    ALPHA_24_FREQ_CPS, 20u,
+  },
+  {
+    "bew",
+    "Latn",
+    ALPHA_25_UPPER, 29u,
+    ALPHA_25_LOWER, 29u,
+    ALPHA_25_FREQ, 29u,
+    ALPHA_25_DIGITS, 10u,
+    ALPHA_25_UPPER_CPS, 29u,
+    ALPHA_25_LOWER_CPS, 29u,
+    ALPHA_25_DIGITS_CPS, 10u,
+    ALPHA_25_FREQ_CPS, 29u,
+  },
+  {
+    "bez",
+    "Latn",
+    ALPHA_26_UPPER, 25u,
+    ALPHA_26_LOWER, 25u,
+    ALPHA_26_FREQ, 25u,
+    ALPHA_26_DIGITS, 10u,
+    ALPHA_26_UPPER_CPS, 25u,
+    ALPHA_26_LOWER_CPS, 25u,
+    ALPHA_26_DIGITS_CPS, 10u,
+    ALPHA_26_FREQ_CPS, 25u,
+  },
+  {
+    "bg",
+    "Cyrl",
+    ALPHA_27_UPPER, 30u,
+    ALPHA_27_LOWER, 30u,
+    ALPHA_27_FREQ, 30u,
+    ALPHA_27_DIGITS, 10u,
+    ALPHA_27_UPPER_CPS, 30u,
+    ALPHA_27_LOWER_CPS, 30u,
+    ALPHA_27_DIGITS_CPS, 10u,
+    ALPHA_27_FREQ_CPS, 30u,
+  },
+  {
+    "bgc",
+    "Deva",
+    ALPHA_28_UPPER, 44u,
+    ALPHA_28_LOWER, 44u,
+    ALPHA_28_FREQ, 44u,
+    ALPHA_28_DIGITS, 10u,
+    ALPHA_28_UPPER_CPS, 44u,
+    ALPHA_28_LOWER_CPS, 44u,
+    ALPHA_28_DIGITS_CPS, 10u,
+    ALPHA_28_FREQ_CPS, 44u,
+  },
+  {
+    "bgn",
+    "Arab",
+    ALPHA_29_UPPER, 37u,
+    ALPHA_29_LOWER, 37u,
+    ALPHA_29_FREQ, 37u,
+    ALPHA_29_DIGITS, 10u,
+    ALPHA_29_UPPER_CPS, 37u,
+    ALPHA_29_LOWER_CPS, 37u,
+    ALPHA_29_DIGITS_CPS, 10u,
+    ALPHA_29_FREQ_CPS, 37u,
+  },
+  {
+    "bho",
+    "Deva",
+    ALPHA_30_UPPER, 32u,
+    ALPHA_30_LOWER, 32u,
+    ALPHA_30_FREQ, 32u,
+    ALPHA_30_DIGITS, 10u,
+    ALPHA_30_UPPER_CPS, 32u,
+    ALPHA_30_LOWER_CPS, 32u,
+    ALPHA_30_DIGITS_CPS, 10u,
+    ALPHA_30_FREQ_CPS, 32u,
+  },
+  {
+    "bku",
+    "Latn",
+    ALPHA_31_UPPER, 20u,
+    ALPHA_31_LOWER, 20u,
+    ALPHA_31_FREQ, 20u,
+    ALPHA_31_DIGITS, 0u,
+    ALPHA_31_UPPER_CPS, 20u,
+    ALPHA_31_LOWER_CPS, 20u,
+    ALPHA_31_DIGITS_CPS, 0u,
+    ALPHA_31_FREQ_CPS, 20u,
+  },
+  {
+    "bm",
+    "Latn",
+    ALPHA_32_UPPER, 27u,
+    ALPHA_32_LOWER, 27u,
+    ALPHA_32_FREQ, 27u,
+    ALPHA_32_DIGITS, 10u,
+    ALPHA_32_UPPER_CPS, 27u,
+    ALPHA_32_LOWER_CPS, 27u,
+    ALPHA_32_DIGITS_CPS, 10u,
+    ALPHA_32_FREQ_CPS, 27u,
+  },
+  {
+    "bm",
+    "Nkoo",
+    ALPHA_33_UPPER, 27u,
+    ALPHA_33_LOWER, 27u,
+    ALPHA_33_FREQ, 27u,
+    ALPHA_33_DIGITS, 10u,
+    ALPHA_33_UPPER_CPS, 27u,
+    ALPHA_33_LOWER_CPS, 27u,
+    ALPHA_33_DIGITS_CPS, 10u,
+    ALPHA_33_FREQ_CPS, 27u,
+  },
+  {
+    "bn",
+    "Beng",
+    ALPHA_34_UPPER, 51u,
+    ALPHA_34_LOWER, 51u,
+    ALPHA_34_FREQ, 51u,
+    ALPHA_34_DIGITS, 0u,
+    ALPHA_34_UPPER_CPS, 51u,
+    ALPHA_34_LOWER_CPS, 51u,
+    ALPHA_34_DIGITS_CPS, 0u,
+    ALPHA_34_FREQ_CPS, 51u,
+  },
+  {
+    "bo",
+    "Tibt",
+    ALPHA_35_UPPER, 36u,
+    ALPHA_35_LOWER, 36u,
+    ALPHA_35_FREQ, 36u,
+    ALPHA_35_DIGITS, 10u,
+    ALPHA_35_UPPER_CPS, 36u,
+    ALPHA_35_LOWER_CPS, 36u,
+    ALPHA_35_DIGITS_CPS, 10u,
+    ALPHA_35_FREQ_CPS, 36u,
+  },
+  {
+    "br",
+    "Latn",
+    ALPHA_36_UPPER, 27u,
+    ALPHA_36_LOWER, 27u,
+    ALPHA_36_FREQ, 27u,
+    ALPHA_36_DIGITS, 0u,
+    ALPHA_36_UPPER_CPS, 27u,
+    ALPHA_36_LOWER_CPS, 27u,
+    ALPHA_36_DIGITS_CPS, 0u,
+    ALPHA_36_FREQ_CPS, 27u,
+  },
+  {
+    "brx",
+    "Deva",
+    ALPHA_37_UPPER, 45u,
+    ALPHA_37_LOWER, 45u,
+    ALPHA_37_FREQ, 45u,
+    ALPHA_37_DIGITS, 10u,
+    ALPHA_37_UPPER_CPS, 45u,
+    ALPHA_37_LOWER_CPS, 45u,
+    ALPHA_37_DIGITS_CPS, 10u,
+    ALPHA_37_FREQ_CPS, 45u,
+  },
+  {
+    "bs",
+    "Latn",
+    ALPHA_38_UPPER, 32u,
+    ALPHA_38_LOWER, 32u,
+    ALPHA_38_FREQ, 32u,
+    ALPHA_38_DIGITS, 0u,
+    ALPHA_38_UPPER_CPS, 32u,
+    ALPHA_38_LOWER_CPS, 32u,
+    ALPHA_38_DIGITS_CPS, 0u,
+    ALPHA_38_FREQ_CPS, 32u,
+  },
+  {
+    "bss",
+    "Latn",
+    ALPHA_39_UPPER, 48u,
+    ALPHA_39_LOWER, 48u,
+    ALPHA_39_FREQ, 48u,
+    ALPHA_39_DIGITS, 10u,
+    ALPHA_39_UPPER_CPS, 48u,
+    ALPHA_39_LOWER_CPS, 48u,
+    ALPHA_39_DIGITS_CPS, 10u,
+    ALPHA_39_FREQ_CPS, 48u,
+  },
+  {
+    "bug",
+    "Latn",
+    ALPHA_40_UPPER, 30u,
+    ALPHA_40_LOWER, 30u,
+    ALPHA_40_FREQ, 30u,
+    ALPHA_40_DIGITS, 0u,
+    ALPHA_40_UPPER_CPS, 30u,
+    ALPHA_40_LOWER_CPS, 30u,
+    ALPHA_40_DIGITS_CPS, 0u,
+    ALPHA_40_FREQ_CPS, 30u,
+  },
+  {
+    "bya",
+    "Latn",
+    ALPHA_41_UPPER, 52u,
+    ALPHA_41_LOWER, 52u,
+    ALPHA_41_FREQ, 52u,
+    ALPHA_41_DIGITS, 0u,
+    ALPHA_41_UPPER_CPS, 52u,
+    ALPHA_41_LOWER_CPS, 52u,
+    ALPHA_41_DIGITS_CPS, 0u,
+    ALPHA_41_FREQ_CPS, 52u,
+  },
+  {
+    "byn",
+    "Ethi",
+    ALPHA_42_UPPER, 288u,
+    ALPHA_42_LOWER, 288u,
+    ALPHA_42_FREQ, 288u,
+    ALPHA_42_DIGITS, 10u,
+    ALPHA_42_UPPER_CPS, 288u,
+    ALPHA_42_LOWER_CPS, 288u,
+    ALPHA_42_DIGITS_CPS, 10u,
+    ALPHA_42_FREQ_CPS, 288u,
+  },
+  {
+    "ca",
+    "Latn",
+    ALPHA_43_UPPER, 36u,
+    ALPHA_43_LOWER, 36u,
+    ALPHA_43_FREQ, 36u,
+    ALPHA_43_DIGITS, 10u,
+    ALPHA_43_UPPER_CPS, 36u,
+    ALPHA_43_LOWER_CPS, 36u,
+    ALPHA_43_DIGITS_CPS, 10u,
+    ALPHA_43_FREQ_CPS, 36u,
+  },
+  {
+    "cad",
+    "Latn",
+    ALPHA_44_UPPER, 30u,
+    ALPHA_44_LOWER, 30u,
+    ALPHA_44_FREQ, 30u,
+    ALPHA_44_DIGITS, 10u,
+    ALPHA_44_UPPER_CPS, 30u,
+    ALPHA_44_LOWER_CPS, 30u,
+    ALPHA_44_DIGITS_CPS, 10u,
+    ALPHA_44_FREQ_CPS, 30u,
+  },
+  {
+    "ccp",
+    "Cakm",
+    ALPHA_45_UPPER, 36u,
+    ALPHA_45_LOWER, 36u,
+    ALPHA_45_FREQ, 36u,
+    ALPHA_45_DIGITS, 10u,
+    ALPHA_45_UPPER_CPS, 36u,
+    ALPHA_45_LOWER_CPS, 36u,
+    ALPHA_45_DIGITS_CPS, 10u,
+    ALPHA_45_FREQ_CPS, 36u,
+  },
+  {
+    "ce",
+    "Cyrl",
+    ALPHA_46_UPPER, 34u,
+    ALPHA_46_LOWER, 34u,
+    ALPHA_46_FREQ, 34u,
+    ALPHA_46_DIGITS, 10u,
+    ALPHA_46_UPPER_CPS, 34u,
+    ALPHA_46_LOWER_CPS, 34u,
+    ALPHA_46_DIGITS_CPS, 10u,
+    ALPHA_46_FREQ_CPS, 34u,
+  },
+  {
+    "ceb",
+    "Latn",
+    ALPHA_47_UPPER, 19u,
+    ALPHA_47_LOWER, 19u,
+    ALPHA_47_FREQ, 19u,
+    ALPHA_47_DIGITS, 0u,
+    ALPHA_47_UPPER_CPS, 19u,
+    ALPHA_47_LOWER_CPS, 19u,
+    ALPHA_47_DIGITS_CPS, 0u,
+    ALPHA_47_FREQ_CPS, 19u,
+  },
+  {
+    "cgg",
+    "Latn",
+    ALPHA_48_UPPER, 26u,
+    ALPHA_48_LOWER, 26u,
+    ALPHA_48_FREQ, 26u,
+    ALPHA_48_DIGITS, 10u,
+    ALPHA_48_UPPER_CPS, 26u,
+    ALPHA_48_LOWER_CPS, 26u,
+    ALPHA_48_DIGITS_CPS, 10u,
+    ALPHA_48_FREQ_CPS, 26u,
+  },
+  {
+    "cho",
+    "Latn",
+    ALPHA_49_UPPER, 20u,
+    ALPHA_49_LOWER, 20u,
+    ALPHA_49_FREQ, 20u,
+    ALPHA_49_DIGITS, 10u,
+    ALPHA_49_UPPER_CPS, 20u,
+    ALPHA_49_LOWER_CPS, 20u,
+    ALPHA_49_DIGITS_CPS, 10u,
+    ALPHA_49_FREQ_CPS, 20u,
+  },
+  {
+    "chr",
+    "Cher",
+    ALPHA_50_UPPER, 85u,
+    ALPHA_50_LOWER, 85u,
+    ALPHA_50_FREQ, 85u,
+    ALPHA_50_DIGITS, 10u,
+    ALPHA_50_UPPER_CPS, 85u,
+    ALPHA_50_LOWER_CPS, 85u,
+    ALPHA_50_DIGITS_CPS, 10u,
+    ALPHA_50_FREQ_CPS, 85u,
+  },
+  {
+    "cic",
+    "Latn",
+    ALPHA_51_UPPER, 18u,
+    ALPHA_51_LOWER, 18u,
+    ALPHA_51_FREQ, 18u,
+    ALPHA_51_DIGITS, 10u,
+    ALPHA_51_UPPER_CPS, 18u,
+    ALPHA_51_LOWER_CPS, 18u,
+    ALPHA_51_DIGITS_CPS, 10u,
+    ALPHA_51_FREQ_CPS, 18u,
+  },
+  {
+    "ckb",
+    "Arab",
+    ALPHA_52_UPPER, 33u,
+    ALPHA_52_LOWER, 33u,
+    ALPHA_52_FREQ, 33u,
+    ALPHA_52_DIGITS, 10u,
+    ALPHA_52_UPPER_CPS, 33u,
+    ALPHA_52_LOWER_CPS, 33u,
+    ALPHA_52_DIGITS_CPS, 10u,
+    ALPHA_52_FREQ_CPS, 33u,
+  },
+  {
+    "co",
+    "Latn",
+    ALPHA_53_UPPER, 29u,
+    ALPHA_53_LOWER, 29u,
+    ALPHA_53_FREQ, 29u,
+    ALPHA_53_DIGITS, 10u,
+    ALPHA_53_UPPER_CPS, 29u,
+    ALPHA_53_LOWER_CPS, 29u,
+    ALPHA_53_DIGITS_CPS, 10u,
+    ALPHA_53_FREQ_CPS, 29u,
+  },
+  {
+    "cop",
+    "Copt",
+    ALPHA_54_UPPER, 32u,
+    ALPHA_54_LOWER, 32u,
+    ALPHA_54_FREQ, 32u,
+    ALPHA_54_DIGITS, 10u,
+    ALPHA_54_UPPER_CPS, 32u,
+    ALPHA_54_LOWER_CPS, 32u,
+    ALPHA_54_DIGITS_CPS, 10u,
+    ALPHA_54_FREQ_CPS, 32u,
+  },
+  {
+    "cs",
+    "Latn",
+    ALPHA_55_UPPER, 41u,
+    ALPHA_55_LOWER, 41u,
+    ALPHA_55_FREQ, 41u,
+    ALPHA_55_DIGITS, 0u,
+    ALPHA_55_UPPER_CPS, 41u,
+    ALPHA_55_LOWER_CPS, 41u,
+    ALPHA_55_DIGITS_CPS, 0u,
+    ALPHA_55_FREQ_CPS, 41u,
+  },
+  {
+    "csw",
+    "Cans",
+    ALPHA_56_UPPER, 97u,
+    ALPHA_56_LOWER, 97u,
+    ALPHA_56_FREQ, 97u,
+    ALPHA_56_DIGITS, 10u,
+    ALPHA_56_UPPER_CPS, 97u,
+    ALPHA_56_LOWER_CPS, 97u,
+    ALPHA_56_DIGITS_CPS, 10u,
+    ALPHA_56_FREQ_CPS, 97u,
+  },
+  {
+    "cu",
+    "Cyrl",
+    ALPHA_57_UPPER, 52u,
+    ALPHA_57_LOWER, 52u,
+    ALPHA_57_FREQ, 52u,
+    ALPHA_57_DIGITS, 10u,
+    ALPHA_57_UPPER_CPS, 52u,
+    ALPHA_57_LOWER_CPS, 52u,
+    ALPHA_57_DIGITS_CPS, 10u,
+    ALPHA_57_FREQ_CPS, 52u,
+  },
+  {
+    "cv",
+    "Cyrl",
+    ALPHA_58_UPPER, 37u,
+    ALPHA_58_LOWER, 37u,
+    ALPHA_58_FREQ, 37u,
+    ALPHA_58_DIGITS, 10u,
+    ALPHA_58_UPPER_CPS, 37u,
+    ALPHA_58_LOWER_CPS, 37u,
+    ALPHA_58_DIGITS_CPS, 10u,
+    ALPHA_58_FREQ_CPS, 37u,
+  },
+  {
+    "cy",
+    "Latn",
+    ALPHA_59_UPPER, 49u,
+    ALPHA_59_LOWER, 49u,
+    ALPHA_59_FREQ, 49u,
+    ALPHA_59_DIGITS, 10u,
+    ALPHA_59_UPPER_CPS, 49u,
+    ALPHA_59_LOWER_CPS, 49u,
+    ALPHA_59_DIGITS_CPS, 10u,
+    ALPHA_59_FREQ_CPS, 49u,
+  },
+  {
+    "da",
+    "Latn",
+    ALPHA_60_UPPER, 29u,
+    ALPHA_60_LOWER, 29u,
+    ALPHA_60_FREQ, 29u,
+    ALPHA_60_DIGITS, 10u,
+    ALPHA_60_UPPER_CPS, 29u,
+    ALPHA_60_LOWER_CPS, 29u,
+    ALPHA_60_DIGITS_CPS, 10u,
+    ALPHA_60_FREQ_CPS, 29u,
+  },
+  {
+    "dav",
+    "Latn",
+    ALPHA_61_UPPER, 24u,
+    ALPHA_61_LOWER, 24u,
+    ALPHA_61_FREQ, 24u,
+    ALPHA_61_DIGITS, 10u,
+    ALPHA_61_UPPER_CPS, 24u,
+    ALPHA_61_LOWER_CPS, 24u,
+    ALPHA_61_DIGITS_CPS, 10u,
+    ALPHA_61_FREQ_CPS, 24u,
+  },
+  {
+    "de",
+    "Latn",
+    ALPHA_62_UPPER, 30u,
+    ALPHA_62_LOWER, 30u,
+    ALPHA_62_FREQ, 30u,
+    ALPHA_62_DIGITS, 10u,
+    ALPHA_62_UPPER_CPS, 29u,
+    ALPHA_62_LOWER_CPS, 30u,
+    ALPHA_62_DIGITS_CPS, 10u,
+    ALPHA_62_FREQ_CPS, 30u,
+  },
+  {
+    "dje",
+    "Latn",
+    ALPHA_63_UPPER, 32u,
+    ALPHA_63_LOWER, 32u,
+    ALPHA_63_FREQ, 32u,
+    ALPHA_63_DIGITS, 10u,
+    ALPHA_63_UPPER_CPS, 32u,
+    ALPHA_63_LOWER_CPS, 32u,
+    ALPHA_63_DIGITS_CPS, 10u,
+    ALPHA_63_FREQ_CPS, 32u,
+  },
+  {
+    "dsb",
+    "Latn",
+    ALPHA_64_UPPER, 37u,
+    ALPHA_64_LOWER, 37u,
+    ALPHA_64_FREQ, 37u,
+    ALPHA_64_DIGITS, 10u,
+    ALPHA_64_UPPER_CPS, 37u,
+    ALPHA_64_LOWER_CPS, 37u,
+    ALPHA_64_DIGITS_CPS, 10u,
+    ALPHA_64_FREQ_CPS, 37u,
+  },
+  {
+    "dua",
+    "Latn",
+    ALPHA_65_UPPER, 32u,
+    ALPHA_65_LOWER, 32u,
+    ALPHA_65_FREQ, 32u,
+    ALPHA_65_DIGITS, 10u,
+    ALPHA_65_UPPER_CPS, 32u,
+    ALPHA_65_LOWER_CPS, 32u,
+    ALPHA_65_DIGITS_CPS, 10u,
+    ALPHA_65_FREQ_CPS, 32u,
+  },
+  {
+    "dv",
+    "Thaa",
+    ALPHA_66_UPPER, 24u,
+    ALPHA_66_LOWER, 24u,
+    ALPHA_66_FREQ, 24u,
+    ALPHA_66_DIGITS, 0u,
+    ALPHA_66_UPPER_CPS, 24u,
+    ALPHA_66_LOWER_CPS, 24u,
+    ALPHA_66_DIGITS_CPS, 0u,
+    ALPHA_66_FREQ_CPS, 24u,
+  },
+  {
+    "dyo",
+    "Latn",
+    ALPHA_67_UPPER, 32u,
+    ALPHA_67_LOWER, 32u,
+    ALPHA_67_FREQ, 32u,
+    ALPHA_67_DIGITS, 10u,
+    ALPHA_67_UPPER_CPS, 32u,
+    ALPHA_67_LOWER_CPS, 32u,
+    ALPHA_67_DIGITS_CPS, 10u,
+    ALPHA_67_FREQ_CPS, 32u,
+  },
+  {
+    "dz",
+    "Tibt",
+    ALPHA_68_UPPER, 30u,
+    ALPHA_68_LOWER, 30u,
+    ALPHA_68_FREQ, 30u,
+    ALPHA_68_DIGITS, 0u,
+    ALPHA_68_UPPER_CPS, 30u,
+    ALPHA_68_LOWER_CPS, 30u,
+    ALPHA_68_DIGITS_CPS, 0u,
+    ALPHA_68_FREQ_CPS, 30u,
+  },
+  {
+    "ebu",
+    "Latn",
+    ALPHA_69_UPPER, 28u,
+    ALPHA_69_LOWER, 28u,
+    ALPHA_69_FREQ, 28u,
+    ALPHA_69_DIGITS, 10u,
+    ALPHA_69_UPPER_CPS, 28u,
+    ALPHA_69_LOWER_CPS, 28u,
+    ALPHA_69_DIGITS_CPS, 10u,
+    ALPHA_69_FREQ_CPS, 28u,
+  },
+  {
+    "ee",
+    "Latn",
+    ALPHA_70_UPPER, 45u,
+    ALPHA_70_LOWER, 45u,
+    ALPHA_70_FREQ, 45u,
+    ALPHA_70_DIGITS, 0u,
+    ALPHA_70_UPPER_CPS, 45u,
+    ALPHA_70_LOWER_CPS, 45u,
+    ALPHA_70_DIGITS_CPS, 0u,
+    ALPHA_70_FREQ_CPS, 45u,
+  },
+  {
+    "el",
+    "Grek",
+    ALPHA_71_UPPER, 36u,
+    ALPHA_71_LOWER, 36u,
+    ALPHA_71_FREQ, 36u,
+    ALPHA_71_DIGITS, 0u,
+    ALPHA_71_UPPER_CPS, 33u,
+    ALPHA_71_LOWER_CPS, 36u,
+    ALPHA_71_DIGITS_CPS, 0u,
+    ALPHA_71_FREQ_CPS, 36u,
+  },
+  {
+    "en",
+    "Latn",
+    ALPHA_72_UPPER, 26u,
+    ALPHA_72_LOWER, 26u,
+    ALPHA_72_FREQ, 26u,
+    ALPHA_72_DIGITS, 10u,
+    ALPHA_72_UPPER_CPS, 26u,
+    ALPHA_72_LOWER_CPS, 26u,
+    ALPHA_72_DIGITS_CPS, 10u,
+    ALPHA_72_FREQ_CPS, 26u,
+  },
+  {
+    "eo",
+    "Latn",
+    ALPHA_73_UPPER, 28u,
+    ALPHA_73_LOWER, 28u,
+    ALPHA_73_FREQ, 28u,
+    ALPHA_73_DIGITS, 0u,
+    ALPHA_73_UPPER_CPS, 28u,
+    ALPHA_73_LOWER_CPS, 28u,
+    ALPHA_73_DIGITS_CPS, 0u,
+    ALPHA_73_FREQ_CPS, 28u,
+  },
+  {
+    "es",
+    "Latn",
+    ALPHA_74_UPPER, 33u,
+    ALPHA_74_LOWER, 33u,
+    ALPHA_74_FREQ, 33u,
+    ALPHA_74_DIGITS, 10u,
+    ALPHA_74_UPPER_CPS, 33u,
+    ALPHA_74_LOWER_CPS, 33u,
+    ALPHA_74_DIGITS_CPS, 10u,
+    ALPHA_74_FREQ_CPS, 33u,
+  },
+  {
+    "et",
+    "Latn",
+    ALPHA_75_UPPER, 32u,
+    ALPHA_75_LOWER, 32u,
+    ALPHA_75_FREQ, 32u,
+    ALPHA_75_DIGITS, 0u,
+    ALPHA_75_UPPER_CPS, 32u,
+    ALPHA_75_LOWER_CPS, 32u,
+    ALPHA_75_DIGITS_CPS, 0u,
+    ALPHA_75_FREQ_CPS, 32u,
+  },
+  {
+    "eu",
+    "Latn",
+    ALPHA_76_UPPER, 28u,
+    ALPHA_76_LOWER, 28u,
+    ALPHA_76_FREQ, 28u,
+    ALPHA_76_DIGITS, 0u,
+    ALPHA_76_UPPER_CPS, 28u,
+    ALPHA_76_LOWER_CPS, 28u,
+    ALPHA_76_DIGITS_CPS, 0u,
+    ALPHA_76_FREQ_CPS, 28u,
+  },
+  {
+    "ewo",
+    "Latn",
+    ALPHA_77_UPPER, 48u,
+    ALPHA_77_LOWER, 48u,
+    ALPHA_77_FREQ, 48u,
+    ALPHA_77_DIGITS, 10u,
+    ALPHA_77_UPPER_CPS, 48u,
+    ALPHA_77_LOWER_CPS, 48u,
+    ALPHA_77_DIGITS_CPS, 10u,
+    ALPHA_77_FREQ_CPS, 48u,
+  },
+  {
+    "fa",
+    "Arab",
+    ALPHA_78_UPPER, 38u,
+    ALPHA_78_LOWER, 38u,
+    ALPHA_78_FREQ, 38u,
+    ALPHA_78_DIGITS, 0u,
+    ALPHA_78_UPPER_CPS, 38u,
+    ALPHA_78_LOWER_CPS, 38u,
+    ALPHA_78_DIGITS_CPS, 0u,
+    ALPHA_78_FREQ_CPS, 38u,
+  },
+  {
+    "ff",
+    "Adlm",
+    ALPHA_79_UPPER, 29u,
+    ALPHA_79_LOWER, 29u,
+    ALPHA_79_FREQ, 29u,
+    ALPHA_79_DIGITS, 0u,
+    ALPHA_79_UPPER_CPS, 29u,
+    ALPHA_79_LOWER_CPS, 29u,
+    ALPHA_79_DIGITS_CPS, 0u,
+    ALPHA_79_FREQ_CPS, 29u,
+  },
+  {
+    "ff",
+    "Latn",
+    ALPHA_80_UPPER, 27u,
+    ALPHA_80_LOWER, 27u,
+    ALPHA_80_FREQ, 27u,
+    ALPHA_80_DIGITS, 0u,
+    ALPHA_80_UPPER_CPS, 27u,
+    ALPHA_80_LOWER_CPS, 27u,
+    ALPHA_80_DIGITS_CPS, 0u,
+    ALPHA_80_FREQ_CPS, 27u,
+  },
+  {
+    "fi",
+    "Latn",
+    ALPHA_81_UPPER, 31u,
+    ALPHA_81_LOWER, 31u,
+    ALPHA_81_FREQ, 31u,
+    ALPHA_81_DIGITS, 0u,
+    ALPHA_81_UPPER_CPS, 31u,
+    ALPHA_81_LOWER_CPS, 31u,
+    ALPHA_81_DIGITS_CPS, 0u,
+    ALPHA_81_FREQ_CPS, 31u,
+  },
+  {
+    "fo",
+    "Latn",
+    ALPHA_82_UPPER, 29u,
+    ALPHA_82_LOWER, 29u,
+    ALPHA_82_FREQ, 29u,
+    ALPHA_82_DIGITS, 0u,
+    ALPHA_82_UPPER_CPS, 29u,
+    ALPHA_82_LOWER_CPS, 29u,
+    ALPHA_82_DIGITS_CPS, 0u,
+    ALPHA_82_FREQ_CPS, 29u,
+  },
+  {
+    "fr",
+    "Latn",
+    ALPHA_83_UPPER, 42u,
+    ALPHA_83_LOWER, 42u,
+    ALPHA_83_FREQ, 42u,
+    ALPHA_83_DIGITS, 10u,
+    ALPHA_83_UPPER_CPS, 42u,
+    ALPHA_83_LOWER_CPS, 42u,
+    ALPHA_83_DIGITS_CPS, 10u,
+    ALPHA_83_FREQ_CPS, 42u,
+  },
+  {
+    "frr",
+    "Latn",
+    ALPHA_84_UPPER, 28u,
+    ALPHA_84_LOWER, 28u,
+    ALPHA_84_FREQ, 28u,
+    ALPHA_84_DIGITS, 10u,
+    ALPHA_84_UPPER_CPS, 28u,
+    ALPHA_84_LOWER_CPS, 28u,
+    ALPHA_84_DIGITS_CPS, 10u,
+    ALPHA_84_FREQ_CPS, 28u,
+  },
+  {
+    "fur",
+    "Latn",
+    ALPHA_85_UPPER, 37u,
+    ALPHA_85_LOWER, 37u,
+    ALPHA_85_FREQ, 37u,
+    ALPHA_85_DIGITS, 10u,
+    ALPHA_85_UPPER_CPS, 37u,
+    ALPHA_85_LOWER_CPS, 37u,
+    ALPHA_85_DIGITS_CPS, 10u,
+    ALPHA_85_FREQ_CPS, 37u,
+  },
+  {
+    "fy",
+    "Latn",
+    ALPHA_86_UPPER, 41u,
+    ALPHA_86_LOWER, 41u,
+    ALPHA_86_FREQ, 41u,
+    ALPHA_86_DIGITS, 0u,
+    ALPHA_86_UPPER_CPS, 41u,
+    ALPHA_86_LOWER_CPS, 41u,
+    ALPHA_86_DIGITS_CPS, 0u,
+    ALPHA_86_FREQ_CPS, 41u,
+  },
+  {
+    "ga",
+    "Latn",
+    ALPHA_87_UPPER, 23u,
+    ALPHA_87_LOWER, 23u,
+    ALPHA_87_FREQ, 23u,
+    ALPHA_87_DIGITS, 0u,
+    ALPHA_87_UPPER_CPS, 23u,
+    ALPHA_87_LOWER_CPS, 23u,
+    ALPHA_87_DIGITS_CPS, 0u,
+    ALPHA_87_FREQ_CPS, 23u,
+  },
+  {
+    "gaa",
+    "Latn",
+    ALPHA_88_UPPER, 26u,
+    ALPHA_88_LOWER, 26u,
+    ALPHA_88_FREQ, 26u,
+    ALPHA_88_DIGITS, 10u,
+    ALPHA_88_UPPER_CPS, 26u,
+    ALPHA_88_LOWER_CPS, 26u,
+    ALPHA_88_DIGITS_CPS, 10u,
+    ALPHA_88_FREQ_CPS, 26u,
+  },
+  {
+    "gd",
+    "Latn",
+    ALPHA_89_UPPER, 23u,
+    ALPHA_89_LOWER, 23u,
+    ALPHA_89_FREQ, 23u,
+    ALPHA_89_DIGITS, 0u,
+    ALPHA_89_UPPER_CPS, 23u,
+    ALPHA_89_LOWER_CPS, 23u,
+    ALPHA_89_DIGITS_CPS, 0u,
+    ALPHA_89_FREQ_CPS, 23u,
+  },
+  {
+    "gez",
+    "Ethi",
+    ALPHA_90_UPPER, 202u,
+    ALPHA_90_LOWER, 202u,
+    ALPHA_90_FREQ, 202u,
+    ALPHA_90_DIGITS, 10u,
+    ALPHA_90_UPPER_CPS, 202u,
+    ALPHA_90_LOWER_CPS, 202u,
+    ALPHA_90_DIGITS_CPS, 10u,
+    ALPHA_90_FREQ_CPS, 202u,
+  },
+  {
+    "gl",
+    "Latn",
+    ALPHA_91_UPPER, 34u,
+    ALPHA_91_LOWER, 34u,
+    ALPHA_91_FREQ, 34u,
+    ALPHA_91_DIGITS, 0u,
+    ALPHA_91_UPPER_CPS, 34u,
+    ALPHA_91_LOWER_CPS, 34u,
+    ALPHA_91_DIGITS_CPS, 0u,
+    ALPHA_91_FREQ_CPS, 34u,
+  },
+  {
+    "gn",
+    "Latn",
+    ALPHA_92_UPPER, 29u,
+    ALPHA_92_LOWER, 29u,
+    ALPHA_92_FREQ, 29u,
+    ALPHA_92_DIGITS, 0u,
+    ALPHA_92_UPPER_CPS, 29u,
+    ALPHA_92_LOWER_CPS, 29u,
+    ALPHA_92_DIGITS_CPS, 0u,
+    ALPHA_92_FREQ_CPS, 29u,
+  },
+  {
+    "gsw",
+    "Latn",
+    ALPHA_93_UPPER, 29u,
+    ALPHA_93_LOWER, 29u,
+    ALPHA_93_FREQ, 29u,
+    ALPHA_93_DIGITS, 10u,
+    ALPHA_93_UPPER_CPS, 29u,
+    ALPHA_93_LOWER_CPS, 29u,
+    ALPHA_93_DIGITS_CPS, 10u,
+    ALPHA_93_FREQ_CPS, 29u,
+  },
+  {
+    "gu",
+    "Gujr",
+    ALPHA_94_UPPER, 50u,
+    ALPHA_94_LOWER, 50u,
+    ALPHA_94_FREQ, 50u,
+    ALPHA_94_DIGITS, 0u,
+    ALPHA_94_UPPER_CPS, 50u,
+    ALPHA_94_LOWER_CPS, 50u,
+    ALPHA_94_DIGITS_CPS, 0u,
+    ALPHA_94_FREQ_CPS, 50u,
+  },
+  {
+    "guz",
+    "Latn",
+    ALPHA_95_UPPER, 24u,
+    ALPHA_95_LOWER, 24u,
+    ALPHA_95_FREQ, 24u,
+    ALPHA_95_DIGITS, 10u,
+    ALPHA_95_UPPER_CPS, 24u,
+    ALPHA_95_LOWER_CPS, 24u,
+    ALPHA_95_DIGITS_CPS, 10u,
+    ALPHA_95_FREQ_CPS, 24u,
+  },
+  {
+    "gv",
+    "Latn",
+    ALPHA_96_UPPER, 27u,
+    ALPHA_96_LOWER, 27u,
+    ALPHA_96_FREQ, 27u,
+    ALPHA_96_DIGITS, 0u,
+    ALPHA_96_UPPER_CPS, 27u,
+    ALPHA_96_LOWER_CPS, 27u,
+    ALPHA_96_DIGITS_CPS, 0u,
+    ALPHA_96_FREQ_CPS, 27u,
+  },
+  {
+    "ha",
+    "Latn",
+    ALPHA_97_UPPER, 27u,
+    ALPHA_97_LOWER, 27u,
+    ALPHA_97_FREQ, 27u,
+    ALPHA_97_DIGITS, 0u,
+    ALPHA_97_UPPER_CPS, 27u,
+    ALPHA_97_LOWER_CPS, 27u,
+    ALPHA_97_DIGITS_CPS, 0u,
+    ALPHA_97_FREQ_CPS, 27u,
+  },
+  {
+    "haw",
+    "Latn",
+    ALPHA_98_UPPER, 18u,
+    ALPHA_98_LOWER, 18u,
+    ALPHA_98_FREQ, 18u,
+    ALPHA_98_DIGITS, 10u,
+    ALPHA_98_UPPER_CPS, 18u,
+    ALPHA_98_LOWER_CPS, 18u,
+    ALPHA_98_DIGITS_CPS, 10u,
+    ALPHA_98_FREQ_CPS, 18u,
+  },
+  {
+    "he",
+    "Hebr",
+    ALPHA_99_UPPER, 27u,
+    ALPHA_99_LOWER, 27u,
+    ALPHA_99_FREQ, 27u,
+    ALPHA_99_DIGITS, 0u,
+    ALPHA_99_UPPER_CPS, 27u,
+    ALPHA_99_LOWER_CPS, 27u,
+    ALPHA_99_DIGITS_CPS, 0u,
+    ALPHA_99_FREQ_CPS, 27u,
+  },
+  {
+    "hi",
+    "Deva",
+    ALPHA_100_UPPER, 50u,
+    ALPHA_100_LOWER, 50u,
+    ALPHA_100_FREQ, 50u,
+    ALPHA_100_DIGITS, 10u,
+    ALPHA_100_UPPER_CPS, 50u,
+    ALPHA_100_LOWER_CPS, 50u,
+    ALPHA_100_DIGITS_CPS, 10u,
+    ALPHA_100_FREQ_CPS, 50u,
+  },
+  {
+    "hnn",
+    "Latn",
+    ALPHA_101_UPPER, 23u,
+    ALPHA_101_LOWER, 23u,
+    ALPHA_101_FREQ, 23u,
+    ALPHA_101_DIGITS, 0u,
+    ALPHA_101_UPPER_CPS, 23u,
+    ALPHA_101_LOWER_CPS, 23u,
+    ALPHA_101_DIGITS_CPS, 0u,
+    ALPHA_101_FREQ_CPS, 23u,
+  },
+  {
+    "hr",
+    "Latn",
+    ALPHA_102_UPPER, 34u,
+    ALPHA_102_LOWER, 34u,
+    ALPHA_102_FREQ, 34u,
+    ALPHA_102_DIGITS, 0u,
+    ALPHA_102_UPPER_CPS, 34u,
+    ALPHA_102_LOWER_CPS, 34u,
+    ALPHA_102_DIGITS_CPS, 0u,
+    ALPHA_102_FREQ_CPS, 34u,
+  },
+  {
+    "hsb",
+    "Latn",
+    ALPHA_103_UPPER, 36u,
+    ALPHA_103_LOWER, 36u,
+    ALPHA_103_FREQ, 36u,
+    ALPHA_103_DIGITS, 10u,
+    ALPHA_103_UPPER_CPS, 36u,
+    ALPHA_103_LOWER_CPS, 36u,
+    ALPHA_103_DIGITS_CPS, 10u,
+    ALPHA_103_FREQ_CPS, 36u,
+  },
+  {
+    "ht",
+    "Latn",
+    ALPHA_104_UPPER, 26u,
+    ALPHA_104_LOWER, 26u,
+    ALPHA_104_FREQ, 26u,
+    ALPHA_104_DIGITS, 0u,
+    ALPHA_104_UPPER_CPS, 26u,
+    ALPHA_104_LOWER_CPS, 26u,
+    ALPHA_104_DIGITS_CPS, 0u,
+    ALPHA_104_FREQ_CPS, 26u,
+  },
+  {
+    "hu",
+    "Latn",
+    ALPHA_105_UPPER, 32u,
+    ALPHA_105_LOWER, 32u,
+    ALPHA_105_FREQ, 32u,
+    ALPHA_105_DIGITS, 0u,
+    ALPHA_105_UPPER_CPS, 32u,
+    ALPHA_105_LOWER_CPS, 32u,
+    ALPHA_105_DIGITS_CPS, 0u,
+    ALPHA_105_FREQ_CPS, 32u,
+  },
+  {
+    "hy",
+    "Armn",
+    ALPHA_106_UPPER, 38u,
+    ALPHA_106_LOWER, 38u,
+    ALPHA_106_FREQ, 38u,
+    ALPHA_106_DIGITS, 0u,
+    ALPHA_106_UPPER_CPS, 38u,
+    ALPHA_106_LOWER_CPS, 38u,
+    ALPHA_106_DIGITS_CPS, 0u,
+    ALPHA_106_FREQ_CPS, 38u,
+  },
+  {
+    "ia",
+    "Latn",
+    ALPHA_107_UPPER, 26u,
+    ALPHA_107_LOWER, 26u,
+    ALPHA_107_FREQ, 26u,
+    ALPHA_107_DIGITS, 0u,
+    ALPHA_107_UPPER_CPS, 26u,
+    ALPHA_107_LOWER_CPS, 26u,
+    ALPHA_107_DIGITS_CPS, 0u,
+    ALPHA_107_FREQ_CPS, 26u,
+  },
+  {
+    "id",
+    "Latn",
+    ALPHA_108_UPPER, 26u,
+    ALPHA_108_LOWER, 26u,
+    ALPHA_108_FREQ, 26u,
+    ALPHA_108_DIGITS, 0u,
+    ALPHA_108_UPPER_CPS, 26u,
+    ALPHA_108_LOWER_CPS, 26u,
+    ALPHA_108_DIGITS_CPS, 0u,
+    ALPHA_108_FREQ_CPS, 26u,
+  },
+  {
+    "ie",
+    "Latn",
+    ALPHA_109_UPPER, 31u,
+    ALPHA_109_LOWER, 31u,
+    ALPHA_109_FREQ, 31u,
+    ALPHA_109_DIGITS, 0u,
+    ALPHA_109_UPPER_CPS, 31u,
+    ALPHA_109_LOWER_CPS, 31u,
+    ALPHA_109_DIGITS_CPS, 0u,
+    ALPHA_109_FREQ_CPS, 31u,
+  },
+  {
+    "ig",
+    "Latn",
+    ALPHA_110_UPPER, 28u,
+    ALPHA_110_LOWER, 28u,
+    ALPHA_110_FREQ, 28u,
+    ALPHA_110_DIGITS, 0u,
+    ALPHA_110_UPPER_CPS, 28u,
+    ALPHA_110_LOWER_CPS, 28u,
+    ALPHA_110_DIGITS_CPS, 0u,
+    ALPHA_110_FREQ_CPS, 28u,
+  },
+  {
+    "ii",
+    "Yiii",
+    ALPHA_111_UPPER, 1165u,
+    ALPHA_111_LOWER, 1165u,
+    ALPHA_111_FREQ, 1165u,
+    ALPHA_111_DIGITS, 0u,
+    ALPHA_111_UPPER_CPS, 1165u,
+    ALPHA_111_LOWER_CPS, 1165u,
+    ALPHA_111_DIGITS_CPS, 0u,
+    ALPHA_111_FREQ_CPS, 1165u,
+  },
+  {
+    "io",
+    "Latn",
+    ALPHA_112_UPPER, 26u,
+    ALPHA_112_LOWER, 26u,
+    ALPHA_112_FREQ, 26u,
+    ALPHA_112_DIGITS, 0u,
+    ALPHA_112_UPPER_CPS, 26u,
+    ALPHA_112_LOWER_CPS, 26u,
+    ALPHA_112_DIGITS_CPS, 0u,
+    ALPHA_112_FREQ_CPS, 26u,
+  },
+  {
+    "is",
+    "Latn",
+    ALPHA_113_UPPER, 32u,
+    ALPHA_113_LOWER, 32u,
+    ALPHA_113_FREQ, 32u,
+    ALPHA_113_DIGITS, 0u,
+    ALPHA_113_UPPER_CPS, 32u,
+    ALPHA_113_LOWER_CPS, 32u,
+    ALPHA_113_DIGITS_CPS, 0u,
+    ALPHA_113_FREQ_CPS, 32u,
+  },
+  {
+    "it",
+    "Latn",
+    ALPHA_114_UPPER, 32u,
+    ALPHA_114_LOWER, 32u,
+    ALPHA_114_FREQ, 32u,
+    ALPHA_114_DIGITS, 0u,
+    ALPHA_114_UPPER_CPS, 32u,
+    ALPHA_114_LOWER_CPS, 32u,
+    ALPHA_114_DIGITS_CPS, 0u,
+    ALPHA_114_FREQ_CPS, 32u,
+  },
+  {
+    "iu",
+    "Cans",
+    ALPHA_115_UPPER, 109u,
+    ALPHA_115_LOWER, 109u,
+    ALPHA_115_FREQ, 109u,
+    ALPHA_115_DIGITS, 0u,
+    ALPHA_115_UPPER_CPS, 109u,
+    ALPHA_115_LOWER_CPS, 109u,
+    ALPHA_115_DIGITS_CPS, 0u,
+    ALPHA_115_FREQ_CPS, 109u,
+  },
+  {
+    "iu",
+    "Latn",
+    ALPHA_116_UPPER, 16u,
+    ALPHA_116_LOWER, 16u,
+    ALPHA_116_FREQ, 16u,
+    ALPHA_116_DIGITS, 0u,
+    ALPHA_116_UPPER_CPS, 16u,
+    ALPHA_116_LOWER_CPS, 16u,
+    ALPHA_116_DIGITS_CPS, 0u,
+    ALPHA_116_FREQ_CPS, 16u,
+  },
+  {
+    "ja",
+    "Hira",
+    ALPHA_117_UPPER, 46u,
+    ALPHA_117_LOWER, 46u,
+    ALPHA_117_FREQ, 46u,
+    ALPHA_117_DIGITS, 0u,
+    ALPHA_117_UPPER_CPS, 46u,
+    ALPHA_117_LOWER_CPS, 46u,
+    ALPHA_117_DIGITS_CPS, 0u,
+    ALPHA_117_FREQ_CPS, 46u,
+  },
+  {
+    "ja",
+    "Jpan",
+    ALPHA_118_UPPER, 2311u,
+    ALPHA_118_LOWER, 2311u,
+    ALPHA_118_FREQ, 2311u,
+    ALPHA_118_DIGITS, 0u,
+    ALPHA_118_UPPER_CPS, 2311u,
+    ALPHA_118_LOWER_CPS, 2311u,
+    ALPHA_118_DIGITS_CPS, 0u,
+    ALPHA_118_FREQ_CPS, 2311u,
+  },
+  {
+    "ja",
+    "Kana",
+    ALPHA_119_UPPER, 46u,
+    ALPHA_119_LOWER, 46u,
+    ALPHA_119_FREQ, 46u,
+    ALPHA_119_DIGITS, 0u,
+    ALPHA_119_UPPER_CPS, 46u,
+    ALPHA_119_LOWER_CPS, 46u,
+    ALPHA_119_DIGITS_CPS, 0u,
+    ALPHA_119_FREQ_CPS, 46u,
+  },
+  {
+    "jbo",
+    "Latn",
+    ALPHA_120_UPPER, 24u,
+    ALPHA_120_LOWER, 24u,
+    ALPHA_120_FREQ, 24u,
+    ALPHA_120_DIGITS, 10u,
+    ALPHA_120_UPPER_CPS, 24u,
+    ALPHA_120_LOWER_CPS, 24u,
+    ALPHA_120_DIGITS_CPS, 10u,
+    ALPHA_120_FREQ_CPS, 24u,
+  },
+  {
+    "jgo",
+    "Latn",
+    ALPHA_121_UPPER, 39u,
+    ALPHA_121_LOWER, 39u,
+    ALPHA_121_FREQ, 39u,
+    ALPHA_121_DIGITS, 10u,
+    ALPHA_121_UPPER_CPS, 39u,
+    ALPHA_121_LOWER_CPS, 39u,
+    ALPHA_121_DIGITS_CPS, 10u,
+    ALPHA_121_FREQ_CPS, 39u,
+  },
+  {
+    "jv",
+    "Latn",
+    ALPHA_122_UPPER, 29u,
+    ALPHA_122_LOWER, 29u,
+    ALPHA_122_FREQ, 29u,
+    ALPHA_122_DIGITS, 0u,
+    ALPHA_122_UPPER_CPS, 29u,
+    ALPHA_122_LOWER_CPS, 29u,
+    ALPHA_122_DIGITS_CPS, 0u,
+    ALPHA_122_FREQ_CPS, 29u,
+  },
+  {
+    "ka",
+    "Geor",
+    ALPHA_123_UPPER, 33u,
+    ALPHA_123_LOWER, 33u,
+    ALPHA_123_FREQ, 33u,
+    ALPHA_123_DIGITS, 0u,
+    ALPHA_123_UPPER_CPS, 33u,
+    ALPHA_123_LOWER_CPS, 33u,
+    ALPHA_123_DIGITS_CPS, 0u,
+    ALPHA_123_FREQ_CPS, 33u,
+  },
+  {
+    "kaa",
+    "Cyrl",
+    ALPHA_124_UPPER, 41u,
+    ALPHA_124_LOWER, 41u,
+    ALPHA_124_FREQ, 41u,
+    ALPHA_124_DIGITS, 10u,
+    ALPHA_124_UPPER_CPS, 41u,
+    ALPHA_124_LOWER_CPS, 41u,
+    ALPHA_124_DIGITS_CPS, 10u,
+    ALPHA_124_FREQ_CPS, 41u,
+  },
+  {
+    "kaa",
+    "Latn",
+    ALPHA_125_UPPER, 32u,
+    ALPHA_125_LOWER, 32u,
+    ALPHA_125_FREQ, 32u,
+    ALPHA_125_DIGITS, 10u,
+    ALPHA_125_UPPER_CPS, 31u,
+    ALPHA_125_LOWER_CPS, 32u,
+    ALPHA_125_DIGITS_CPS, 10u,
+    ALPHA_125_FREQ_CPS, 32u,
+  },
+  {
+    "kab",
+    "Latn",
+    ALPHA_126_UPPER, 34u,
+    ALPHA_126_LOWER, 34u,
+    ALPHA_126_FREQ, 34u,
+    ALPHA_126_DIGITS, 10u,
+    ALPHA_126_UPPER_CPS, 34u,
+    ALPHA_126_LOWER_CPS, 34u,
+    ALPHA_126_DIGITS_CPS, 10u,
+    ALPHA_126_FREQ_CPS, 34u,
+  },
+  {
+    "kam",
+    "Latn",
+    ALPHA_127_UPPER, 27u,
+    ALPHA_127_LOWER, 27u,
+    ALPHA_127_FREQ, 27u,
+    ALPHA_127_DIGITS, 10u,
+    ALPHA_127_UPPER_CPS, 27u,
+    ALPHA_127_LOWER_CPS, 27u,
+    ALPHA_127_DIGITS_CPS, 10u,
+    ALPHA_127_FREQ_CPS, 27u,
+  },
+  {
+    "kde",
+    "Latn",
+    ALPHA_128_UPPER, 26u,
+    ALPHA_128_LOWER, 26u,
+    ALPHA_128_FREQ, 26u,
+    ALPHA_128_DIGITS, 10u,
+    ALPHA_128_UPPER_CPS, 26u,
+    ALPHA_128_LOWER_CPS, 26u,
+    ALPHA_128_DIGITS_CPS, 10u,
+    ALPHA_128_FREQ_CPS, 26u,
+  },
+  {
+    "kea",
+    "Latn",
+    ALPHA_129_UPPER, 24u,
+    ALPHA_129_LOWER, 24u,
+    ALPHA_129_FREQ, 24u,
+    ALPHA_129_DIGITS, 10u,
+    ALPHA_129_UPPER_CPS, 24u,
+    ALPHA_129_LOWER_CPS, 24u,
+    ALPHA_129_DIGITS_CPS, 10u,
+    ALPHA_129_FREQ_CPS, 24u,
+  },
+  {
+    "ken",
+    "Latn",
+    ALPHA_130_UPPER, 38u,
+    ALPHA_130_LOWER, 38u,
+    ALPHA_130_FREQ, 38u,
+    ALPHA_130_DIGITS, 10u,
+    ALPHA_130_UPPER_CPS, 38u,
+    ALPHA_130_LOWER_CPS, 38u,
+    ALPHA_130_DIGITS_CPS, 10u,
+    ALPHA_130_FREQ_CPS, 38u,
+  },
+  {
+    "kgp",
+    "Latn",
+    ALPHA_131_UPPER, 26u,
+    ALPHA_131_LOWER, 26u,
+    ALPHA_131_FREQ, 26u,
+    ALPHA_131_DIGITS, 10u,
+    ALPHA_131_UPPER_CPS, 26u,
+    ALPHA_131_LOWER_CPS, 26u,
+    ALPHA_131_DIGITS_CPS, 10u,
+    ALPHA_131_FREQ_CPS, 26u,
+  },
+  {
+    "khq",
+    "Latn",
+    ALPHA_132_UPPER, 32u,
+    ALPHA_132_LOWER, 32u,
+    ALPHA_132_FREQ, 32u,
+    ALPHA_132_DIGITS, 10u,
+    ALPHA_132_UPPER_CPS, 32u,
+    ALPHA_132_LOWER_CPS, 32u,
+    ALPHA_132_DIGITS_CPS, 10u,
+    ALPHA_132_FREQ_CPS, 32u,
+  },
+  {
+    "ki",
+    "Latn",
+    ALPHA_133_UPPER, 20u,
+    ALPHA_133_LOWER, 20u,
+    ALPHA_133_FREQ, 20u,
+    ALPHA_133_DIGITS, 0u,
+    ALPHA_133_UPPER_CPS, 20u,
+    ALPHA_133_LOWER_CPS, 20u,
+    ALPHA_133_DIGITS_CPS, 0u,
+    ALPHA_133_FREQ_CPS, 20u,
+  },
+  {
+    "kk",
+    "Cyrl",
+    ALPHA_134_UPPER, 42u,
+    ALPHA_134_LOWER, 42u,
+    ALPHA_134_FREQ, 42u,
+    ALPHA_134_DIGITS, 0u,
+    ALPHA_134_UPPER_CPS, 42u,
+    ALPHA_134_LOWER_CPS, 42u,
+    ALPHA_134_DIGITS_CPS, 0u,
+    ALPHA_134_FREQ_CPS, 42u,
+  },
+  {
+    "kkj",
+    "Latn",
+    ALPHA_135_UPPER, 43u,
+    ALPHA_135_LOWER, 43u,
+    ALPHA_135_FREQ, 43u,
+    ALPHA_135_DIGITS, 10u,
+    ALPHA_135_UPPER_CPS, 43u,
+    ALPHA_135_LOWER_CPS, 43u,
+    ALPHA_135_DIGITS_CPS, 10u,
+    ALPHA_135_FREQ_CPS, 43u,
+  },
+  {
+    "kl",
+    "Latn",
+    ALPHA_136_UPPER, 29u,
+    ALPHA_136_LOWER, 29u,
+    ALPHA_136_FREQ, 29u,
+    ALPHA_136_DIGITS, 0u,
+    ALPHA_136_UPPER_CPS, 29u,
+    ALPHA_136_LOWER_CPS, 29u,
+    ALPHA_136_DIGITS_CPS, 0u,
+    ALPHA_136_FREQ_CPS, 29u,
+  },
+  {
+    "km",
+    "Khmr",
+    ALPHA_137_UPPER, 47u,
+    ALPHA_137_LOWER, 47u,
+    ALPHA_137_FREQ, 47u,
+    ALPHA_137_DIGITS, 0u,
+    ALPHA_137_UPPER_CPS, 47u,
+    ALPHA_137_LOWER_CPS, 47u,
+    ALPHA_137_DIGITS_CPS, 0u,
+    ALPHA_137_FREQ_CPS, 47u,
+  },
+  {
+    "kn",
+    "Knda",
+    ALPHA_138_UPPER, 52u,
+    ALPHA_138_LOWER, 52u,
+    ALPHA_138_FREQ, 52u,
+    ALPHA_138_DIGITS, 0u,
+    ALPHA_138_UPPER_CPS, 52u,
+    ALPHA_138_LOWER_CPS, 52u,
+    ALPHA_138_DIGITS_CPS, 0u,
+    ALPHA_138_FREQ_CPS, 52u,
+  },
+  {
+    "ko",
+    "Hang",
+    ALPHA_139_UPPER, 24u,
+    ALPHA_139_LOWER, 24u,
+    ALPHA_139_FREQ, 24u,
+    ALPHA_139_DIGITS, 0u,
+    ALPHA_139_UPPER_CPS, 24u,
+    ALPHA_139_LOWER_CPS, 24u,
+    ALPHA_139_DIGITS_CPS, 0u,
+    ALPHA_139_FREQ_CPS, 24u,
+  },
+  {
+    "ko",
+    "Kore",
+    ALPHA_140_UPPER, 11172u,
+    ALPHA_140_LOWER, 11172u,
+    ALPHA_140_FREQ, 11172u,
+    ALPHA_140_DIGITS, 0u,
+    ALPHA_140_UPPER_CPS, 11172u,
+    ALPHA_140_LOWER_CPS, 11172u,
+    ALPHA_140_DIGITS_CPS, 0u,
+    ALPHA_140_FREQ_CPS, 11172u,
+  },
+  {
+    "kok",
+    "Deva",
+    ALPHA_141_UPPER, 50u,
+    ALPHA_141_LOWER, 50u,
+    ALPHA_141_FREQ, 50u,
+    ALPHA_141_DIGITS, 10u,
+    ALPHA_141_UPPER_CPS, 50u,
+    ALPHA_141_LOWER_CPS, 50u,
+    ALPHA_141_DIGITS_CPS, 10u,
+    ALPHA_141_FREQ_CPS, 50u,
+  },
+  {
+    "kok",
+    "Latn",
+    ALPHA_142_UPPER, 34u,
+    ALPHA_142_LOWER, 34u,
+    ALPHA_142_FREQ, 34u,
+    ALPHA_142_DIGITS, 10u,
+    ALPHA_142_UPPER_CPS, 34u,
+    ALPHA_142_LOWER_CPS, 34u,
+    ALPHA_142_DIGITS_CPS, 10u,
+    ALPHA_142_FREQ_CPS, 34u,
+  },
+  {
+    "kpe",
+    "Latn",
+    ALPHA_143_UPPER, 29u,
+    ALPHA_143_LOWER, 29u,
+    ALPHA_143_FREQ, 29u,
+    ALPHA_143_DIGITS, 10u,
+    ALPHA_143_UPPER_CPS, 29u,
+    ALPHA_143_LOWER_CPS, 29u,
+    ALPHA_143_DIGITS_CPS, 10u,
+    ALPHA_143_FREQ_CPS, 29u,
+  },
+  {
+    "ks",
+    "Arab",
+    ALPHA_144_UPPER, 46u,
+    ALPHA_144_LOWER, 46u,
+    ALPHA_144_FREQ, 46u,
+    ALPHA_144_DIGITS, 0u,
+    ALPHA_144_UPPER_CPS, 46u,
+    ALPHA_144_LOWER_CPS, 46u,
+    ALPHA_144_DIGITS_CPS, 0u,
+    ALPHA_144_FREQ_CPS, 46u,
+  },
+  {
+    "ks",
+    "Deva",
+    ALPHA_145_UPPER, 33u,
+    ALPHA_145_LOWER, 33u,
+    ALPHA_145_FREQ, 33u,
+    ALPHA_145_DIGITS, 0u,
+    ALPHA_145_UPPER_CPS, 33u,
+    ALPHA_145_LOWER_CPS, 33u,
+    ALPHA_145_DIGITS_CPS, 0u,
+    ALPHA_145_FREQ_CPS, 33u,
+  },
+  {
+    "ksb",
+    "Latn",
+    ALPHA_146_UPPER, 23u,
+    ALPHA_146_LOWER, 23u,
+    ALPHA_146_FREQ, 23u,
+    ALPHA_146_DIGITS, 10u,
+    ALPHA_146_UPPER_CPS, 23u,
+    ALPHA_146_LOWER_CPS, 23u,
+    ALPHA_146_DIGITS_CPS, 10u,
+    ALPHA_146_FREQ_CPS, 23u,
+  },
+  {
+    "ksf",
+    "Latn",
+    ALPHA_147_UPPER, 33u,
+    ALPHA_147_LOWER, 33u,
+    ALPHA_147_FREQ, 33u,
+    ALPHA_147_DIGITS, 10u,
+    ALPHA_147_UPPER_CPS, 33u,
+    ALPHA_147_LOWER_CPS, 33u,
+    ALPHA_147_DIGITS_CPS, 10u,
+    ALPHA_147_FREQ_CPS, 33u,
+  },
+  {
+    "ksh",
+    "Latn",
+    ALPHA_148_UPPER, 36u,
+    ALPHA_148_LOWER, 36u,
+    ALPHA_148_FREQ, 36u,
+    ALPHA_148_DIGITS, 0u,
+    ALPHA_148_UPPER_CPS, 35u,
+    ALPHA_148_LOWER_CPS, 35u,
+    ALPHA_148_DIGITS_CPS, 0u,
+    ALPHA_148_FREQ_CPS, 35u,
+  },
+  {
+    "ku",
+    "Latn",
+    ALPHA_149_UPPER, 31u,
+    ALPHA_149_LOWER, 31u,
+    ALPHA_149_FREQ, 31u,
+    ALPHA_149_DIGITS, 0u,
+    ALPHA_149_UPPER_CPS, 31u,
+    ALPHA_149_LOWER_CPS, 31u,
+    ALPHA_149_DIGITS_CPS, 0u,
+    ALPHA_149_FREQ_CPS, 31u,
+  },
+  {
+    "kw",
+    "Latn",
+    ALPHA_150_UPPER, 26u,
+    ALPHA_150_LOWER, 26u,
+    ALPHA_150_FREQ, 26u,
+    ALPHA_150_DIGITS, 0u,
+    ALPHA_150_UPPER_CPS, 26u,
+    ALPHA_150_LOWER_CPS, 26u,
+    ALPHA_150_DIGITS_CPS, 0u,
+    ALPHA_150_FREQ_CPS, 26u,
+  },
+  {
+    "kxv",
+    "Orya",
+    ALPHA_151_UPPER, 29u,
+    ALPHA_151_LOWER, 29u,
+    ALPHA_151_FREQ, 29u,
+    ALPHA_151_DIGITS, 10u,
+    ALPHA_151_UPPER_CPS, 29u,
+    ALPHA_151_LOWER_CPS, 29u,
+    ALPHA_151_DIGITS_CPS, 10u,
+    ALPHA_151_FREQ_CPS, 29u,
+  },
+  {
+    "ky",
+    "Cyrl",
+    ALPHA_152_UPPER, 31u,
+    ALPHA_152_LOWER, 31u,
+    ALPHA_152_FREQ, 31u,
+    ALPHA_152_DIGITS, 0u,
+    ALPHA_152_UPPER_CPS, 31u,
+    ALPHA_152_LOWER_CPS, 31u,
+    ALPHA_152_DIGITS_CPS, 0u,
+    ALPHA_152_FREQ_CPS, 31u,
+  },
+  {
+    "la",
+    "Latn",
+    ALPHA_153_UPPER, 26u,
+    ALPHA_153_LOWER, 26u,
+    ALPHA_153_FREQ, 26u,
+    ALPHA_153_DIGITS, 0u,
+    ALPHA_153_UPPER_CPS, 26u,
+    ALPHA_153_LOWER_CPS, 26u,
+    ALPHA_153_DIGITS_CPS, 0u,
+    ALPHA_153_FREQ_CPS, 26u,
+  },
+  {
+    "lag",
+    "Latn",
+    ALPHA_154_UPPER, 33u,
+    ALPHA_154_LOWER, 33u,
+    ALPHA_154_FREQ, 33u,
+    ALPHA_154_DIGITS, 10u,
+    ALPHA_154_UPPER_CPS, 33u,
+    ALPHA_154_LOWER_CPS, 33u,
+    ALPHA_154_DIGITS_CPS, 10u,
+    ALPHA_154_FREQ_CPS, 33u,
+  },
+  {
+    "lb",
+    "Latn",
+    ALPHA_155_UPPER, 29u,
+    ALPHA_155_LOWER, 29u,
+    ALPHA_155_FREQ, 29u,
+    ALPHA_155_DIGITS, 0u,
+    ALPHA_155_UPPER_CPS, 29u,
+    ALPHA_155_LOWER_CPS, 29u,
+    ALPHA_155_DIGITS_CPS, 0u,
+    ALPHA_155_FREQ_CPS, 29u,
+  },
+  {
+    "lep",
+    "Lepc",
+    ALPHA_156_UPPER, 59u,
+    ALPHA_156_LOWER, 59u,
+    ALPHA_156_FREQ, 59u,
+    ALPHA_156_DIGITS, 0u,
+    ALPHA_156_UPPER_CPS, 59u,
+    ALPHA_156_LOWER_CPS, 59u,
+    ALPHA_156_DIGITS_CPS, 0u,
+    ALPHA_156_FREQ_CPS, 59u,
+  },
+  {
+    "lg",
+    "Latn",
+    ALPHA_157_UPPER, 24u,
+    ALPHA_157_LOWER, 24u,
+    ALPHA_157_FREQ, 24u,
+    ALPHA_157_DIGITS, 0u,
+    ALPHA_157_UPPER_CPS, 24u,
+    ALPHA_157_LOWER_CPS, 24u,
+    ALPHA_157_DIGITS_CPS, 0u,
+    ALPHA_157_FREQ_CPS, 24u,
+  },
+  {
+    "lif",
+    "Deva",
+    ALPHA_158_UPPER, 56u,
+    ALPHA_158_LOWER, 56u,
+    ALPHA_158_FREQ, 44u,
+    ALPHA_158_DIGITS, 0u,
+    ALPHA_158_UPPER_CPS, 44u,
+    ALPHA_158_LOWER_CPS, 44u,
+    ALPHA_158_DIGITS_CPS, 0u,
+    ALPHA_158_FREQ_CPS, 44u,
+  },
+  {
+    "lij",
+    "Latn",
+    ALPHA_159_UPPER, 46u,
+    ALPHA_159_LOWER, 46u,
+    ALPHA_159_FREQ, 46u,
+    ALPHA_159_DIGITS, 10u,
+    ALPHA_159_UPPER_CPS, 46u,
+    ALPHA_159_LOWER_CPS, 46u,
+    ALPHA_159_DIGITS_CPS, 10u,
+    ALPHA_159_FREQ_CPS, 46u,
+  },
+  {
+    "lis",
+    "Lisu",
+    ALPHA_160_UPPER, 40u,
+    ALPHA_160_LOWER, 40u,
+    ALPHA_160_FREQ, 40u,
+    ALPHA_160_DIGITS, 0u,
+    ALPHA_160_UPPER_CPS, 40u,
+    ALPHA_160_LOWER_CPS, 40u,
+    ALPHA_160_DIGITS_CPS, 0u,
+    ALPHA_160_FREQ_CPS, 40u,
+  },
+  {
+    "lkt",
+    "Latn",
+    ALPHA_161_UPPER, 30u,
+    ALPHA_161_LOWER, 30u,
+    ALPHA_161_FREQ, 30u,
+    ALPHA_161_DIGITS, 10u,
+    ALPHA_161_UPPER_CPS, 30u,
+    ALPHA_161_LOWER_CPS, 30u,
+    ALPHA_161_DIGITS_CPS, 10u,
+    ALPHA_161_FREQ_CPS, 30u,
+  },
+  {
+    "lld",
+    "Latn",
+    ALPHA_162_UPPER, 41u,
+    ALPHA_162_LOWER, 41u,
+    ALPHA_162_FREQ, 41u,
+    ALPHA_162_DIGITS, 10u,
+    ALPHA_162_UPPER_CPS, 41u,
+    ALPHA_162_LOWER_CPS, 41u,
+    ALPHA_162_DIGITS_CPS, 10u,
+    ALPHA_162_FREQ_CPS, 41u,
+  },
+  {
+    "lmo",
+    "Latn",
+    ALPHA_163_UPPER, 26u,
+    ALPHA_163_LOWER, 26u,
+    ALPHA_163_FREQ, 26u,
+    ALPHA_163_DIGITS, 10u,
+    ALPHA_163_UPPER_CPS, 26u,
+    ALPHA_163_LOWER_CPS, 26u,
+    ALPHA_163_DIGITS_CPS, 10u,
+    ALPHA_163_FREQ_CPS, 26u,
+  },
+  {
+    "ln",
+    "Latn",
+    ALPHA_164_UPPER, 38u,
+    ALPHA_164_LOWER, 38u,
+    ALPHA_164_FREQ, 38u,
+    ALPHA_164_DIGITS, 0u,
+    ALPHA_164_UPPER_CPS, 38u,
+    ALPHA_164_LOWER_CPS, 38u,
+    ALPHA_164_DIGITS_CPS, 0u,
+    ALPHA_164_FREQ_CPS, 38u,
+  },
+  {
+    "lo",
+    "Laoo",
+    ALPHA_165_UPPER, 40u,
+    ALPHA_165_LOWER, 40u,
+    ALPHA_165_FREQ, 40u,
+    ALPHA_165_DIGITS, 0u,
+    ALPHA_165_UPPER_CPS, 40u,
+    ALPHA_165_LOWER_CPS, 40u,
+    ALPHA_165_DIGITS_CPS, 0u,
+    ALPHA_165_FREQ_CPS, 40u,
+  },
+  {
+    "lrc",
+    "Arab",
+    ALPHA_166_UPPER, 41u,
+    ALPHA_166_LOWER, 41u,
+    ALPHA_166_FREQ, 41u,
+    ALPHA_166_DIGITS, 10u,
+    ALPHA_166_UPPER_CPS, 41u,
+    ALPHA_166_LOWER_CPS, 41u,
+    ALPHA_166_DIGITS_CPS, 10u,
+    ALPHA_166_FREQ_CPS, 41u,
+  },
+  {
+    "lt",
+    "Latn",
+    ALPHA_167_UPPER, 32u,
+    ALPHA_167_LOWER, 32u,
+    ALPHA_167_FREQ, 32u,
+    ALPHA_167_DIGITS, 0u,
+    ALPHA_167_UPPER_CPS, 32u,
+    ALPHA_167_LOWER_CPS, 32u,
+    ALPHA_167_DIGITS_CPS, 0u,
+    ALPHA_167_FREQ_CPS, 32u,
+  },
+  {
+    "ltg",
+    "Latn",
+    ALPHA_168_UPPER, 35u,
+    ALPHA_168_LOWER, 35u,
+    ALPHA_168_FREQ, 35u,
+    ALPHA_168_DIGITS, 10u,
+    ALPHA_168_UPPER_CPS, 35u,
+    ALPHA_168_LOWER_CPS, 35u,
+    ALPHA_168_DIGITS_CPS, 10u,
+    ALPHA_168_FREQ_CPS, 35u,
+  },
+  {
+    "lu",
+    "Latn",
+    ALPHA_169_UPPER, 36u,
+    ALPHA_169_LOWER, 36u,
+    ALPHA_169_FREQ, 36u,
+    ALPHA_169_DIGITS, 0u,
+    ALPHA_169_UPPER_CPS, 36u,
+    ALPHA_169_LOWER_CPS, 36u,
+    ALPHA_169_DIGITS_CPS, 0u,
+    ALPHA_169_FREQ_CPS, 36u,
+  },
+  {
+    "luo",
+    "Latn",
+    ALPHA_170_UPPER, 23u,
+    ALPHA_170_LOWER, 23u,
+    ALPHA_170_FREQ, 23u,
+    ALPHA_170_DIGITS, 10u,
+    ALPHA_170_UPPER_CPS, 23u,
+    ALPHA_170_LOWER_CPS, 23u,
+    ALPHA_170_DIGITS_CPS, 10u,
+    ALPHA_170_FREQ_CPS, 23u,
+  },
+  {
+    "luy",
+    "Latn",
+    ALPHA_171_UPPER, 26u,
+    ALPHA_171_LOWER, 26u,
+    ALPHA_171_FREQ, 26u,
+    ALPHA_171_DIGITS, 10u,
+    ALPHA_171_UPPER_CPS, 26u,
+    ALPHA_171_LOWER_CPS, 26u,
+    ALPHA_171_DIGITS_CPS, 10u,
+    ALPHA_171_FREQ_CPS, 26u,
+  },
+  {
+    "lv",
+    "Latn",
+    ALPHA_172_UPPER, 33u,
+    ALPHA_172_LOWER, 33u,
+    ALPHA_172_FREQ, 33u,
+    ALPHA_172_DIGITS, 0u,
+    ALPHA_172_UPPER_CPS, 33u,
+    ALPHA_172_LOWER_CPS, 33u,
+    ALPHA_172_DIGITS_CPS, 0u,
+    ALPHA_172_FREQ_CPS, 33u,
+  },
+  {
+    "lzh",
+    "Hans",
+    ALPHA_173_UPPER, 2210u,
+    ALPHA_173_LOWER, 2210u,
+    ALPHA_173_FREQ, 2210u,
+    ALPHA_173_DIGITS, 0u,
+    ALPHA_173_UPPER_CPS, 2210u,
+    ALPHA_173_LOWER_CPS, 2210u,
+    ALPHA_173_DIGITS_CPS, 0u,
+    ALPHA_173_FREQ_CPS, 2210u,
+  },
+  {
+    "mai",
+    "Deva",
+    ALPHA_174_UPPER, 32u,
+    ALPHA_174_LOWER, 32u,
+    ALPHA_174_FREQ, 32u,
+    ALPHA_174_DIGITS, 10u,
+    ALPHA_174_UPPER_CPS, 32u,
+    ALPHA_174_LOWER_CPS, 32u,
+    ALPHA_174_DIGITS_CPS, 10u,
+    ALPHA_174_FREQ_CPS, 32u,
+  },
+  {
+    "mas",
+    "Latn",
+    ALPHA_175_UPPER, 46u,
+    ALPHA_175_LOWER, 46u,
+    ALPHA_175_FREQ, 46u,
+    ALPHA_175_DIGITS, 10u,
+    ALPHA_175_UPPER_CPS, 46u,
+    ALPHA_175_LOWER_CPS, 46u,
+    ALPHA_175_DIGITS_CPS, 10u,
+    ALPHA_175_FREQ_CPS, 46u,
+  },
+  {
+    "mdf",
+    "Cyrl",
+    ALPHA_176_UPPER, 33u,
+    ALPHA_176_LOWER, 33u,
+    ALPHA_176_FREQ, 33u,
+    ALPHA_176_DIGITS, 10u,
+    ALPHA_176_UPPER_CPS, 33u,
+    ALPHA_176_LOWER_CPS, 33u,
+    ALPHA_176_DIGITS_CPS, 10u,
+    ALPHA_176_FREQ_CPS, 33u,
+  },
+  {
+    "meh",
+    "Latn",
+    ALPHA_177_UPPER, 27u,
+    ALPHA_177_LOWER, 27u,
+    ALPHA_177_FREQ, 27u,
+    ALPHA_177_DIGITS, 10u,
+    ALPHA_177_UPPER_CPS, 27u,
+    ALPHA_177_LOWER_CPS, 27u,
+    ALPHA_177_DIGITS_CPS, 10u,
+    ALPHA_177_FREQ_CPS, 27u,
+  },
+  {
+    "mel",
+    "Latn",
+    ALPHA_178_UPPER, 24u,
+    ALPHA_178_LOWER, 24u,
+    ALPHA_178_FREQ, 24u,
+    ALPHA_178_DIGITS, 10u,
+    ALPHA_178_UPPER_CPS, 24u,
+    ALPHA_178_LOWER_CPS, 24u,
+    ALPHA_178_DIGITS_CPS, 10u,
+    ALPHA_178_FREQ_CPS, 24u,
+  },
+  {
+    "mer",
+    "Latn",
+    ALPHA_179_UPPER, 28u,
+    ALPHA_179_LOWER, 28u,
+    ALPHA_179_FREQ, 28u,
+    ALPHA_179_DIGITS, 10u,
+    ALPHA_179_UPPER_CPS, 28u,
+    ALPHA_179_LOWER_CPS, 28u,
+    ALPHA_179_DIGITS_CPS, 10u,
+    ALPHA_179_FREQ_CPS, 28u,
+  },
+  {
+    "mfe",
+    "Latn",
+    ALPHA_180_UPPER, 25u,
+    ALPHA_180_LOWER, 25u,
+    ALPHA_180_FREQ, 25u,
+    ALPHA_180_DIGITS, 10u,
+    ALPHA_180_UPPER_CPS, 25u,
+    ALPHA_180_LOWER_CPS, 25u,
+    ALPHA_180_DIGITS_CPS, 10u,
+    ALPHA_180_FREQ_CPS, 25u,
+  },
+  {
+    "mg",
+    "Latn",
+    ALPHA_181_UPPER, 32u,
+    ALPHA_181_LOWER, 32u,
+    ALPHA_181_FREQ, 32u,
+    ALPHA_181_DIGITS, 0u,
+    ALPHA_181_UPPER_CPS, 32u,
+    ALPHA_181_LOWER_CPS, 32u,
+    ALPHA_181_DIGITS_CPS, 0u,
+    ALPHA_181_FREQ_CPS, 32u,
+  },
+  {
+    "mgh",
+    "Latn",
+    ALPHA_182_UPPER, 24u,
+    ALPHA_182_LOWER, 24u,
+    ALPHA_182_FREQ, 24u,
+    ALPHA_182_DIGITS, 10u,
+    ALPHA_182_UPPER_CPS, 24u,
+    ALPHA_182_LOWER_CPS, 24u,
+    ALPHA_182_DIGITS_CPS, 10u,
+    ALPHA_182_FREQ_CPS, 24u,
+  },
+  {
+    "mgo",
+    "Latn",
+    ALPHA_183_UPPER, 31u,
+    ALPHA_183_LOWER, 31u,
+    ALPHA_183_FREQ, 31u,
+    ALPHA_183_DIGITS, 10u,
+    ALPHA_183_UPPER_CPS, 31u,
+    ALPHA_183_LOWER_CPS, 31u,
+    ALPHA_183_DIGITS_CPS, 10u,
+    ALPHA_183_FREQ_CPS, 31u,
+  },
+  {
+    "mhn",
+    "Latn",
+    ALPHA_184_UPPER, 37u,
+    ALPHA_184_LOWER, 37u,
+    ALPHA_184_FREQ, 37u,
+    ALPHA_184_DIGITS, 10u,
+    ALPHA_184_UPPER_CPS, 37u,
+    ALPHA_184_LOWER_CPS, 37u,
+    ALPHA_184_DIGITS_CPS, 10u,
+    ALPHA_184_FREQ_CPS, 37u,
+  },
+  {
+    "mi",
+    "Latn",
+    ALPHA_185_UPPER, 19u,
+    ALPHA_185_LOWER, 19u,
+    ALPHA_185_FREQ, 19u,
+    ALPHA_185_DIGITS, 10u,
+    ALPHA_185_UPPER_CPS, 19u,
+    ALPHA_185_LOWER_CPS, 19u,
+    ALPHA_185_DIGITS_CPS, 10u,
+    ALPHA_185_FREQ_CPS, 19u,
+  },
+  {
+    "mic",
+    "Latn",
+    ALPHA_186_UPPER, 22u,
+    ALPHA_186_LOWER, 22u,
+    ALPHA_186_FREQ, 22u,
+    ALPHA_186_DIGITS, 10u,
+    ALPHA_186_UPPER_CPS, 22u,
+    ALPHA_186_LOWER_CPS, 22u,
+    ALPHA_186_DIGITS_CPS, 10u,
+    ALPHA_186_FREQ_CPS, 22u,
+  },
+  {
+    "mid",
+    "Latn",
+    ALPHA_187_UPPER, 29u,
+    ALPHA_187_LOWER, 29u,
+    ALPHA_187_FREQ, 29u,
+    ALPHA_187_DIGITS, 0u,
+    ALPHA_187_UPPER_CPS, 29u,
+    ALPHA_187_LOWER_CPS, 29u,
+    ALPHA_187_DIGITS_CPS, 0u,
+    ALPHA_187_FREQ_CPS, 29u,
+  },
+  {
+    "mk",
+    "Cyrl",
+    ALPHA_188_UPPER, 31u,
+    ALPHA_188_LOWER, 31u,
+    ALPHA_188_FREQ, 31u,
+    ALPHA_188_DIGITS, 0u,
+    ALPHA_188_UPPER_CPS, 31u,
+    ALPHA_188_LOWER_CPS, 31u,
+    ALPHA_188_DIGITS_CPS, 0u,
+    ALPHA_188_FREQ_CPS, 31u,
+  },
+  {
+    "ml",
+    "Mlym",
+    ALPHA_189_UPPER, 49u,
+    ALPHA_189_LOWER, 49u,
+    ALPHA_189_FREQ, 49u,
+    ALPHA_189_DIGITS, 0u,
+    ALPHA_189_UPPER_CPS, 49u,
+    ALPHA_189_LOWER_CPS, 49u,
+    ALPHA_189_DIGITS_CPS, 0u,
+    ALPHA_189_FREQ_CPS, 49u,
+  },
+  {
+    "mmc",
+    "Latn",
+    ALPHA_190_UPPER, 46u,
+    ALPHA_190_LOWER, 46u,
+    ALPHA_190_FREQ, 46u,
+    ALPHA_190_DIGITS, 10u,
+    ALPHA_190_UPPER_CPS, 46u,
+    ALPHA_190_LOWER_CPS, 46u,
+    ALPHA_190_DIGITS_CPS, 10u,
+    ALPHA_190_FREQ_CPS, 46u,
+  },
+  {
+    "mn",
+    "Cyrl",
+    ALPHA_191_UPPER, 35u,
+    ALPHA_191_LOWER, 35u,
+    ALPHA_191_FREQ, 35u,
+    ALPHA_191_DIGITS, 0u,
+    ALPHA_191_UPPER_CPS, 35u,
+    ALPHA_191_LOWER_CPS, 35u,
+    ALPHA_191_DIGITS_CPS, 0u,
+    ALPHA_191_FREQ_CPS, 35u,
+  },
+  {
+    "mn",
+    "Mong",
+    ALPHA_192_UPPER, 35u,
+    ALPHA_192_LOWER, 35u,
+    ALPHA_192_FREQ, 35u,
+    ALPHA_192_DIGITS, 0u,
+    ALPHA_192_UPPER_CPS, 35u,
+    ALPHA_192_LOWER_CPS, 35u,
+    ALPHA_192_DIGITS_CPS, 0u,
+    ALPHA_192_FREQ_CPS, 35u,
+  },
+  {
+    "mni",
+    "Beng",
+    ALPHA_193_UPPER, 44u,
+    ALPHA_193_LOWER, 44u,
+    ALPHA_193_FREQ, 44u,
+    ALPHA_193_DIGITS, 10u,
+    ALPHA_193_UPPER_CPS, 44u,
+    ALPHA_193_LOWER_CPS, 44u,
+    ALPHA_193_DIGITS_CPS, 10u,
+    ALPHA_193_FREQ_CPS, 44u,
+  },
+  {
+    "mni",
+    "Mtei",
+    ALPHA_194_UPPER, 35u,
+    ALPHA_194_LOWER, 35u,
+    ALPHA_194_FREQ, 35u,
+    ALPHA_194_DIGITS, 10u,
+    ALPHA_194_UPPER_CPS, 35u,
+    ALPHA_194_LOWER_CPS, 35u,
+    ALPHA_194_DIGITS_CPS, 10u,
+    ALPHA_194_FREQ_CPS, 35u,
+  },
+  {
+    "mo",
+    "Latn",
+    ALPHA_195_UPPER, 31u,
+    ALPHA_195_LOWER, 31u,
+    ALPHA_195_FREQ, 31u,
+    ALPHA_195_DIGITS, 0u,
+    ALPHA_195_UPPER_CPS, 31u,
+    ALPHA_195_LOWER_CPS, 31u,
+    ALPHA_195_DIGITS_CPS, 0u,
+    ALPHA_195_FREQ_CPS, 31u,
+  },
+  {
+    "moh",
+    "Latn",
+    ALPHA_196_UPPER, 21u,
+    ALPHA_196_LOWER, 21u,
+    ALPHA_196_FREQ, 21u,
+    ALPHA_196_DIGITS, 10u,
+    ALPHA_196_UPPER_CPS, 21u,
+    ALPHA_196_LOWER_CPS, 21u,
+    ALPHA_196_DIGITS_CPS, 10u,
+    ALPHA_196_FREQ_CPS, 21u,
+  },
+  {
+    "mr",
+    "Deva",
+    ALPHA_197_UPPER, 49u,
+    ALPHA_197_LOWER, 49u,
+    ALPHA_197_FREQ, 49u,
+    ALPHA_197_DIGITS, 0u,
+    ALPHA_197_UPPER_CPS, 49u,
+    ALPHA_197_LOWER_CPS, 49u,
+    ALPHA_197_DIGITS_CPS, 0u,
+    ALPHA_197_FREQ_CPS, 49u,
+  },
+  {
+    "mr",
+    "Latn",
+    ALPHA_198_UPPER, 26u,
+    ALPHA_198_LOWER, 26u,
+    ALPHA_198_FREQ, 26u,
+    ALPHA_198_DIGITS, 0u,
+    ALPHA_198_UPPER_CPS, 26u,
+    ALPHA_198_LOWER_CPS, 26u,
+    ALPHA_198_DIGITS_CPS, 0u,
+    ALPHA_198_FREQ_CPS, 26u,
+  },
+  {
+    "ms",
+    "Latn",
+    ALPHA_199_UPPER, 26u,
+    ALPHA_199_LOWER, 26u,
+    ALPHA_199_FREQ, 26u,
+    ALPHA_199_DIGITS, 0u,
+    ALPHA_199_UPPER_CPS, 26u,
+    ALPHA_199_LOWER_CPS, 26u,
+    ALPHA_199_DIGITS_CPS, 0u,
+    ALPHA_199_FREQ_CPS, 26u,
+  },
+  {
+    "msi",
+    "Latn",
+    ALPHA_200_UPPER, 25u,
+    ALPHA_200_LOWER, 25u,
+    ALPHA_200_FREQ, 25u,
+    ALPHA_200_DIGITS, 10u,
+    ALPHA_200_UPPER_CPS, 25u,
+    ALPHA_200_LOWER_CPS, 25u,
+    ALPHA_200_DIGITS_CPS, 10u,
+    ALPHA_200_FREQ_CPS, 25u,
+  },
+  {
+    "mt",
+    "Latn",
+    ALPHA_201_UPPER, 33u,
+    ALPHA_201_LOWER, 33u,
+    ALPHA_201_FREQ, 33u,
+    ALPHA_201_DIGITS, 0u,
+    ALPHA_201_UPPER_CPS, 33u,
+    ALPHA_201_LOWER_CPS, 33u,
+    ALPHA_201_DIGITS_CPS, 0u,
+    ALPHA_201_FREQ_CPS, 33u,
+  },
+  {
+    "mua",
+    "Latn",
+    ALPHA_202_UPPER, 33u,
+    ALPHA_202_LOWER, 33u,
+    ALPHA_202_FREQ, 33u,
+    ALPHA_202_DIGITS, 10u,
+    ALPHA_202_UPPER_CPS, 33u,
+    ALPHA_202_LOWER_CPS, 33u,
+    ALPHA_202_DIGITS_CPS, 10u,
+    ALPHA_202_FREQ_CPS, 33u,
+  },
+  {
+    "mus",
+    "Latn",
+    ALPHA_203_UPPER, 21u,
+    ALPHA_203_LOWER, 21u,
+    ALPHA_203_FREQ, 21u,
+    ALPHA_203_DIGITS, 10u,
+    ALPHA_203_UPPER_CPS, 21u,
+    ALPHA_203_LOWER_CPS, 21u,
+    ALPHA_203_DIGITS_CPS, 10u,
+    ALPHA_203_FREQ_CPS, 21u,
+  },
+  {
+    "my",
+    "Mymr",
+    ALPHA_204_UPPER, 42u,
+    ALPHA_204_LOWER, 42u,
+    ALPHA_204_FREQ, 42u,
+    ALPHA_204_DIGITS, 0u,
+    ALPHA_204_UPPER_CPS, 42u,
+    ALPHA_204_LOWER_CPS, 42u,
+    ALPHA_204_DIGITS_CPS, 0u,
+    ALPHA_204_FREQ_CPS, 42u,
+  },
+  {
+    "myv",
+    "Cyrl",
+    ALPHA_205_UPPER, 33u,
+    ALPHA_205_LOWER, 33u,
+    ALPHA_205_FREQ, 33u,
+    ALPHA_205_DIGITS, 10u,
+    ALPHA_205_UPPER_CPS, 33u,
+    ALPHA_205_LOWER_CPS, 33u,
+    ALPHA_205_DIGITS_CPS, 10u,
+    ALPHA_205_FREQ_CPS, 33u,
+  },
+  {
+    "mzn",
+    "Arab",
+    ALPHA_206_UPPER, 38u,
+    ALPHA_206_LOWER, 38u,
+    ALPHA_206_FREQ, 38u,
+    ALPHA_206_DIGITS, 10u,
+    ALPHA_206_UPPER_CPS, 38u,
+    ALPHA_206_LOWER_CPS, 38u,
+    ALPHA_206_DIGITS_CPS, 10u,
+    ALPHA_206_FREQ_CPS, 38u,
+  },
+  {
+    "naq",
+    "Latn",
+    ALPHA_207_UPPER, 31u,
+    ALPHA_207_LOWER, 31u,
+    ALPHA_207_FREQ, 31u,
+    ALPHA_207_DIGITS, 10u,
+    ALPHA_207_UPPER_CPS, 31u,
+    ALPHA_207_LOWER_CPS, 31u,
+    ALPHA_207_DIGITS_CPS, 10u,
+    ALPHA_207_FREQ_CPS, 31u,
+  },
+  {
+    "nb",
+    "Latn",
+    ALPHA_208_UPPER, 34u,
+    ALPHA_208_LOWER, 34u,
+    ALPHA_208_FREQ, 34u,
+    ALPHA_208_DIGITS, 0u,
+    ALPHA_208_UPPER_CPS, 34u,
+    ALPHA_208_LOWER_CPS, 34u,
+    ALPHA_208_DIGITS_CPS, 0u,
+    ALPHA_208_FREQ_CPS, 34u,
+  },
+  {
+    "nd",
+    "Latn",
+    ALPHA_209_UPPER, 25u,
+    ALPHA_209_LOWER, 25u,
+    ALPHA_209_FREQ, 25u,
+    ALPHA_209_DIGITS, 0u,
+    ALPHA_209_UPPER_CPS, 25u,
+    ALPHA_209_LOWER_CPS, 25u,
+    ALPHA_209_DIGITS_CPS, 0u,
+    ALPHA_209_FREQ_CPS, 25u,
+  },
+  {
+    "nds",
+    "Latn",
+    ALPHA_210_UPPER, 30u,
+    ALPHA_210_LOWER, 30u,
+    ALPHA_210_FREQ, 30u,
+    ALPHA_210_DIGITS, 10u,
+    ALPHA_210_UPPER_CPS, 30u,
+    ALPHA_210_LOWER_CPS, 30u,
+    ALPHA_210_DIGITS_CPS, 10u,
+    ALPHA_210_FREQ_CPS, 30u,
+  },
+  {
+    "ne",
+    "Deva",
+    ALPHA_211_UPPER, 50u,
+    ALPHA_211_LOWER, 50u,
+    ALPHA_211_FREQ, 50u,
+    ALPHA_211_DIGITS, 0u,
+    ALPHA_211_UPPER_CPS, 50u,
+    ALPHA_211_LOWER_CPS, 50u,
+    ALPHA_211_DIGITS_CPS, 0u,
+    ALPHA_211_FREQ_CPS, 50u,
+  },
+  {
+    "nl",
+    "Latn",
+    ALPHA_212_UPPER, 36u,
+    ALPHA_212_LOWER, 36u,
+    ALPHA_212_FREQ, 36u,
+    ALPHA_212_DIGITS, 0u,
+    ALPHA_212_UPPER_CPS, 36u,
+    ALPHA_212_LOWER_CPS, 36u,
+    ALPHA_212_DIGITS_CPS, 0u,
+    ALPHA_212_FREQ_CPS, 36u,
+  },
+  {
+    "nmg",
+    "Latn",
+    ALPHA_213_UPPER, 53u,
+    ALPHA_213_LOWER, 53u,
+    ALPHA_213_FREQ, 53u,
+    ALPHA_213_DIGITS, 10u,
+    ALPHA_213_UPPER_CPS, 53u,
+    ALPHA_213_LOWER_CPS, 53u,
+    ALPHA_213_DIGITS_CPS, 10u,
+    ALPHA_213_FREQ_CPS, 53u,
+  },
+  {
+    "nn",
+    "Latn",
+    ALPHA_214_UPPER, 34u,
+    ALPHA_214_LOWER, 34u,
+    ALPHA_214_FREQ, 34u,
+    ALPHA_214_DIGITS, 0u,
+    ALPHA_214_UPPER_CPS, 34u,
+    ALPHA_214_LOWER_CPS, 34u,
+    ALPHA_214_DIGITS_CPS, 0u,
+    ALPHA_214_FREQ_CPS, 34u,
+  },
+  {
+    "nnh",
+    "Latn",
+    ALPHA_215_UPPER, 50u,
+    ALPHA_215_LOWER, 50u,
+    ALPHA_215_FREQ, 50u,
+    ALPHA_215_DIGITS, 10u,
+    ALPHA_215_UPPER_CPS, 50u,
+    ALPHA_215_LOWER_CPS, 50u,
+    ALPHA_215_DIGITS_CPS, 10u,
+    ALPHA_215_FREQ_CPS, 50u,
+  },
+  {
+    "no",
+    "Latn",
+    ALPHA_216_UPPER, 34u,
+    ALPHA_216_LOWER, 34u,
+    ALPHA_216_FREQ, 34u,
+    ALPHA_216_DIGITS, 0u,
+    ALPHA_216_UPPER_CPS, 34u,
+    ALPHA_216_LOWER_CPS, 34u,
+    ALPHA_216_DIGITS_CPS, 0u,
+    ALPHA_216_FREQ_CPS, 34u,
+  },
+  {
+    "nqo",
+    "Nkoo",
+    ALPHA_217_UPPER, 32u,
+    ALPHA_217_LOWER, 32u,
+    ALPHA_217_FREQ, 32u,
+    ALPHA_217_DIGITS, 10u,
+    ALPHA_217_UPPER_CPS, 32u,
+    ALPHA_217_LOWER_CPS, 32u,
+    ALPHA_217_DIGITS_CPS, 10u,
+    ALPHA_217_FREQ_CPS, 32u,
+  },
+  {
+    "nr",
+    "Latn",
+    ALPHA_218_UPPER, 25u,
+    ALPHA_218_LOWER, 25u,
+    ALPHA_218_FREQ, 25u,
+    ALPHA_218_DIGITS, 0u,
+    ALPHA_218_UPPER_CPS, 25u,
+    ALPHA_218_LOWER_CPS, 25u,
+    ALPHA_218_DIGITS_CPS, 0u,
+    ALPHA_218_FREQ_CPS, 25u,
+  },
+  {
+    "nso",
+    "Latn",
+    ALPHA_219_UPPER, 25u,
+    ALPHA_219_LOWER, 25u,
+    ALPHA_219_FREQ, 25u,
+    ALPHA_219_DIGITS, 10u,
+    ALPHA_219_UPPER_CPS, 25u,
+    ALPHA_219_LOWER_CPS, 25u,
+    ALPHA_219_DIGITS_CPS, 10u,
+    ALPHA_219_FREQ_CPS, 25u,
+  },
+  {
+    "nus",
+    "Latn",
+    ALPHA_220_UPPER, 34u,
+    ALPHA_220_LOWER, 34u,
+    ALPHA_220_FREQ, 34u,
+    ALPHA_220_DIGITS, 10u,
+    ALPHA_220_UPPER_CPS, 34u,
+    ALPHA_220_LOWER_CPS, 34u,
+    ALPHA_220_DIGITS_CPS, 10u,
+    ALPHA_220_FREQ_CPS, 34u,
+  },
+  {
+    "nv",
+    "Latn",
+    ALPHA_221_UPPER, 29u,
+    ALPHA_221_LOWER, 29u,
+    ALPHA_221_FREQ, 29u,
+    ALPHA_221_DIGITS, 10u,
+    ALPHA_221_UPPER_CPS, 29u,
+    ALPHA_221_LOWER_CPS, 29u,
+    ALPHA_221_DIGITS_CPS, 10u,
+    ALPHA_221_FREQ_CPS, 29u,
+  },
+  {
+    "ny",
+    "Latn",
+    ALPHA_222_UPPER, 24u,
+    ALPHA_222_LOWER, 24u,
+    ALPHA_222_FREQ, 24u,
+    ALPHA_222_DIGITS, 0u,
+    ALPHA_222_UPPER_CPS, 24u,
+    ALPHA_222_LOWER_CPS, 24u,
+    ALPHA_222_DIGITS_CPS, 0u,
+    ALPHA_222_FREQ_CPS, 24u,
+  },
+  {
+    "nyn",
+    "Latn",
+    ALPHA_223_UPPER, 26u,
+    ALPHA_223_LOWER, 26u,
+    ALPHA_223_FREQ, 26u,
+    ALPHA_223_DIGITS, 10u,
+    ALPHA_223_UPPER_CPS, 26u,
+    ALPHA_223_LOWER_CPS, 26u,
+    ALPHA_223_DIGITS_CPS, 10u,
+    ALPHA_223_FREQ_CPS, 26u,
+  },
+  {
+    "oc",
+    "Latn",
+    ALPHA_224_UPPER, 37u,
+    ALPHA_224_LOWER, 37u,
+    ALPHA_224_FREQ, 37u,
+    ALPHA_224_DIGITS, 0u,
+    ALPHA_224_UPPER_CPS, 37u,
+    ALPHA_224_LOWER_CPS, 37u,
+    ALPHA_224_DIGITS_CPS, 0u,
+    ALPHA_224_FREQ_CPS, 37u,
+  },
+  {
+    "om",
+    "Latn",
+    ALPHA_225_UPPER, 26u,
+    ALPHA_225_LOWER, 26u,
+    ALPHA_225_FREQ, 26u,
+    ALPHA_225_DIGITS, 0u,
+    ALPHA_225_UPPER_CPS, 26u,
+    ALPHA_225_LOWER_CPS, 26u,
+    ALPHA_225_DIGITS_CPS, 0u,
+    ALPHA_225_FREQ_CPS, 26u,
+  },
+  {
+    "or",
+    "Orya",
+    ALPHA_226_UPPER, 47u,
+    ALPHA_226_LOWER, 47u,
+    ALPHA_226_FREQ, 47u,
+    ALPHA_226_DIGITS, 0u,
+    ALPHA_226_UPPER_CPS, 47u,
+    ALPHA_226_LOWER_CPS, 47u,
+    ALPHA_226_DIGITS_CPS, 0u,
+    ALPHA_226_FREQ_CPS, 47u,
+  },
+  {
+    "os",
+    "Cyrl",
+    ALPHA_227_UPPER, 34u,
+    ALPHA_227_LOWER, 34u,
+    ALPHA_227_FREQ, 34u,
+    ALPHA_227_DIGITS, 0u,
+    ALPHA_227_UPPER_CPS, 34u,
+    ALPHA_227_LOWER_CPS, 34u,
+    ALPHA_227_DIGITS_CPS, 0u,
+    ALPHA_227_FREQ_CPS, 34u,
+  },
+  {
+    "osa",
+    "Osge",
+    ALPHA_228_UPPER, 36u,
+    ALPHA_228_LOWER, 36u,
+    ALPHA_228_FREQ, 36u,
+    ALPHA_228_DIGITS, 10u,
+    ALPHA_228_UPPER_CPS, 36u,
+    ALPHA_228_LOWER_CPS, 36u,
+    ALPHA_228_DIGITS_CPS, 10u,
+    ALPHA_228_FREQ_CPS, 36u,
+  },
+  {
+    "pa",
+    "Guru",
+    ALPHA_229_UPPER, 45u,
+    ALPHA_229_LOWER, 45u,
+    ALPHA_229_FREQ, 45u,
+    ALPHA_229_DIGITS, 0u,
+    ALPHA_229_UPPER_CPS, 45u,
+    ALPHA_229_LOWER_CPS, 45u,
+    ALPHA_229_DIGITS_CPS, 0u,
+    ALPHA_229_FREQ_CPS, 45u,
+  },
+  {
+    "pap",
+    "Latn",
+    ALPHA_230_UPPER, 31u,
+    ALPHA_230_LOWER, 31u,
+    ALPHA_230_FREQ, 31u,
+    ALPHA_230_DIGITS, 10u,
+    ALPHA_230_UPPER_CPS, 31u,
+    ALPHA_230_LOWER_CPS, 31u,
+    ALPHA_230_DIGITS_CPS, 10u,
+    ALPHA_230_FREQ_CPS, 31u,
+  },
+  {
+    "pcm",
+    "Latn",
+    ALPHA_231_UPPER, 31u,
+    ALPHA_231_LOWER, 31u,
+    ALPHA_231_FREQ, 31u,
+    ALPHA_231_DIGITS, 10u,
+    ALPHA_231_UPPER_CPS, 31u,
+    ALPHA_231_LOWER_CPS, 31u,
+    ALPHA_231_DIGITS_CPS, 10u,
+    ALPHA_231_FREQ_CPS, 31u,
+  },
+  {
+    "pis",
+    "Latn",
+    ALPHA_232_UPPER, 22u,
+    ALPHA_232_LOWER, 22u,
+    ALPHA_232_FREQ, 22u,
+    ALPHA_232_DIGITS, 9u,
+    ALPHA_232_UPPER_CPS, 22u,
+    ALPHA_232_LOWER_CPS, 22u,
+    ALPHA_232_DIGITS_CPS, 9u,
+    ALPHA_232_FREQ_CPS, 22u,
+  },
+  {
+    "pl",
+    "Latn",
+    ALPHA_233_UPPER, 32u,
+    ALPHA_233_LOWER, 32u,
+    ALPHA_233_FREQ, 32u,
+    ALPHA_233_DIGITS, 10u,
+    ALPHA_233_UPPER_CPS, 32u,
+    ALPHA_233_LOWER_CPS, 32u,
+    ALPHA_233_DIGITS_CPS, 10u,
+    ALPHA_233_FREQ_CPS, 32u,
+  },
+  {
+    "prg",
+    "Latn",
+    ALPHA_234_UPPER, 39u,
+    ALPHA_234_LOWER, 39u,
+    ALPHA_234_FREQ, 39u,
+    ALPHA_234_DIGITS, 10u,
+    ALPHA_234_UPPER_CPS, 39u,
+    ALPHA_234_LOWER_CPS, 39u,
+    ALPHA_234_DIGITS_CPS, 10u,
+    ALPHA_234_FREQ_CPS, 39u,
+  },
+  {
+    "ps",
+    "Arab",
+    ALPHA_235_UPPER, 50u,
+    ALPHA_235_LOWER, 50u,
+    ALPHA_235_FREQ, 50u,
+    ALPHA_235_DIGITS, 0u,
+    ALPHA_235_UPPER_CPS, 50u,
+    ALPHA_235_LOWER_CPS, 50u,
+    ALPHA_235_DIGITS_CPS, 0u,
+    ALPHA_235_FREQ_CPS, 50u,
+  },
+  {
+    "pt",
+    "Latn",
+    ALPHA_236_UPPER, 39u,
+    ALPHA_236_LOWER, 39u,
+    ALPHA_236_FREQ, 39u,
+    ALPHA_236_DIGITS, 0u,
+    ALPHA_236_UPPER_CPS, 39u,
+    ALPHA_236_LOWER_CPS, 39u,
+    ALPHA_236_DIGITS_CPS, 0u,
+    ALPHA_236_FREQ_CPS, 39u,
+  },
+  {
+    "qu",
+    "Latn",
+    ALPHA_237_UPPER, 17u,
+    ALPHA_237_LOWER, 17u,
+    ALPHA_237_FREQ, 17u,
+    ALPHA_237_DIGITS, 0u,
+    ALPHA_237_UPPER_CPS, 17u,
+    ALPHA_237_LOWER_CPS, 17u,
+    ALPHA_237_DIGITS_CPS, 0u,
+    ALPHA_237_FREQ_CPS, 17u,
+  },
+  {
+    "quc",
+    "Latn",
+    ALPHA_238_UPPER, 25u,
+    ALPHA_238_LOWER, 25u,
+    ALPHA_238_FREQ, 25u,
+    ALPHA_238_DIGITS, 10u,
+    ALPHA_238_UPPER_CPS, 25u,
+    ALPHA_238_LOWER_CPS, 25u,
+    ALPHA_238_DIGITS_CPS, 10u,
+    ALPHA_238_FREQ_CPS, 25u,
+  },
+  {
+    "raj",
+    "Deva",
+    ALPHA_239_UPPER, 34u,
+    ALPHA_239_LOWER, 34u,
+    ALPHA_239_FREQ, 34u,
+    ALPHA_239_DIGITS, 10u,
+    ALPHA_239_UPPER_CPS, 34u,
+    ALPHA_239_LOWER_CPS, 34u,
+    ALPHA_239_DIGITS_CPS, 10u,
+    ALPHA_239_FREQ_CPS, 34u,
+  },
+  {
+    "rej",
+    "Latn",
+    ALPHA_240_UPPER, 37u,
+    ALPHA_240_LOWER, 37u,
+    ALPHA_240_FREQ, 37u,
+    ALPHA_240_DIGITS, 0u,
+    ALPHA_240_UPPER_CPS, 37u,
+    ALPHA_240_LOWER_CPS, 37u,
+    ALPHA_240_DIGITS_CPS, 0u,
+    ALPHA_240_FREQ_CPS, 37u,
+  },
+  {
+    "rhg",
+    "Rohg",
+    ALPHA_241_UPPER, 35u,
+    ALPHA_241_LOWER, 35u,
+    ALPHA_241_FREQ, 35u,
+    ALPHA_241_DIGITS, 10u,
+    ALPHA_241_UPPER_CPS, 35u,
+    ALPHA_241_LOWER_CPS, 35u,
+    ALPHA_241_DIGITS_CPS, 10u,
+    ALPHA_241_FREQ_CPS, 35u,
+  },
+  {
+    "rm",
+    "Latn",
+    ALPHA_242_UPPER, 32u,
+    ALPHA_242_LOWER, 32u,
+    ALPHA_242_FREQ, 32u,
+    ALPHA_242_DIGITS, 0u,
+    ALPHA_242_UPPER_CPS, 32u,
+    ALPHA_242_LOWER_CPS, 32u,
+    ALPHA_242_DIGITS_CPS, 0u,
+    ALPHA_242_FREQ_CPS, 32u,
+  },
+  {
+    "rn",
+    "Latn",
+    ALPHA_243_UPPER, 26u,
+    ALPHA_243_LOWER, 26u,
+    ALPHA_243_FREQ, 26u,
+    ALPHA_243_DIGITS, 0u,
+    ALPHA_243_UPPER_CPS, 26u,
+    ALPHA_243_LOWER_CPS, 26u,
+    ALPHA_243_DIGITS_CPS, 0u,
+    ALPHA_243_FREQ_CPS, 26u,
+  },
+  {
+    "ro",
+    "Latn",
+    ALPHA_244_UPPER, 31u,
+    ALPHA_244_LOWER, 31u,
+    ALPHA_244_FREQ, 31u,
+    ALPHA_244_DIGITS, 0u,
+    ALPHA_244_UPPER_CPS, 31u,
+    ALPHA_244_LOWER_CPS, 31u,
+    ALPHA_244_DIGITS_CPS, 0u,
+    ALPHA_244_FREQ_CPS, 31u,
+  },
+  {
+    "ru",
+    "Cyrl",
+    ALPHA_245_UPPER, 33u,
+    ALPHA_245_LOWER, 33u,
+    ALPHA_245_FREQ, 33u,
+    ALPHA_245_DIGITS, 0u,
+    ALPHA_245_UPPER_CPS, 33u,
+    ALPHA_245_LOWER_CPS, 33u,
+    ALPHA_245_DIGITS_CPS, 0u,
+    ALPHA_245_FREQ_CPS, 33u,
+  },
+  {
+    "ruc",
+    "Latn",
+    ALPHA_246_UPPER, 24u,
+    ALPHA_246_LOWER, 24u,
+    ALPHA_246_FREQ, 24u,
+    ALPHA_246_DIGITS, 10u,
+    ALPHA_246_UPPER_CPS, 24u,
+    ALPHA_246_LOWER_CPS, 24u,
+    ALPHA_246_DIGITS_CPS, 10u,
+    ALPHA_246_FREQ_CPS, 24u,
+  },
+  {
+    "rw",
+    "Latn",
+    ALPHA_247_UPPER, 26u,
+    ALPHA_247_LOWER, 26u,
+    ALPHA_247_FREQ, 26u,
+    ALPHA_247_DIGITS, 0u,
+    ALPHA_247_UPPER_CPS, 26u,
+    ALPHA_247_LOWER_CPS, 26u,
+    ALPHA_247_DIGITS_CPS, 0u,
+    ALPHA_247_FREQ_CPS, 26u,
+  },
+  {
+    "rwk",
+    "Latn",
+    ALPHA_248_UPPER, 24u,
+    ALPHA_248_LOWER, 24u,
+    ALPHA_248_FREQ, 24u,
+    ALPHA_248_DIGITS, 10u,
+    ALPHA_248_UPPER_CPS, 24u,
+    ALPHA_248_LOWER_CPS, 24u,
+    ALPHA_248_DIGITS_CPS, 10u,
+    ALPHA_248_FREQ_CPS, 24u,
+  },
+  {
+    "sa",
+    "Deva",
+    ALPHA_249_UPPER, 50u,
+    ALPHA_249_LOWER, 50u,
+    ALPHA_249_FREQ, 50u,
+    ALPHA_249_DIGITS, 0u,
+    ALPHA_249_UPPER_CPS, 50u,
+    ALPHA_249_LOWER_CPS, 50u,
+    ALPHA_249_DIGITS_CPS, 0u,
+    ALPHA_249_FREQ_CPS, 50u,
+  },
+  {
+    "sah",
+    "Cyrl",
+    ALPHA_250_UPPER, 26u,
+    ALPHA_250_LOWER, 26u,
+    ALPHA_250_FREQ, 26u,
+    ALPHA_250_DIGITS, 10u,
+    ALPHA_250_UPPER_CPS, 26u,
+    ALPHA_250_LOWER_CPS, 26u,
+    ALPHA_250_DIGITS_CPS, 10u,
+    ALPHA_250_FREQ_CPS, 26u,
+  },
+  {
+    "sam",
+    "Latn",
+    ALPHA_251_UPPER, 61u,
+    ALPHA_251_LOWER, 61u,
+    ALPHA_251_FREQ, 61u,
+    ALPHA_251_DIGITS, 0u,
+    ALPHA_251_UPPER_CPS, 61u,
+    ALPHA_251_LOWER_CPS, 61u,
+    ALPHA_251_DIGITS_CPS, 0u,
+    ALPHA_251_FREQ_CPS, 61u,
+  },
+  {
+    "saq",
+    "Latn",
+    ALPHA_252_UPPER, 22u,
+    ALPHA_252_LOWER, 22u,
+    ALPHA_252_FREQ, 22u,
+    ALPHA_252_DIGITS, 10u,
+    ALPHA_252_UPPER_CPS, 22u,
+    ALPHA_252_LOWER_CPS, 22u,
+    ALPHA_252_DIGITS_CPS, 10u,
+    ALPHA_252_FREQ_CPS, 22u,
+  },
+  {
+    "sat",
+    "Deva",
+    ALPHA_253_UPPER, 26u,
+    ALPHA_253_LOWER, 26u,
+    ALPHA_253_FREQ, 26u,
+    ALPHA_253_DIGITS, 10u,
+    ALPHA_253_UPPER_CPS, 26u,
+    ALPHA_253_LOWER_CPS, 26u,
+    ALPHA_253_DIGITS_CPS, 10u,
+    ALPHA_253_FREQ_CPS, 26u,
+  },
+  {
+    "sat",
+    "Olck",
+    ALPHA_254_UPPER, 36u,
+    ALPHA_254_LOWER, 36u,
+    ALPHA_254_FREQ, 36u,
+    ALPHA_254_DIGITS, 10u,
+    ALPHA_254_UPPER_CPS, 36u,
+    ALPHA_254_LOWER_CPS, 36u,
+    ALPHA_254_DIGITS_CPS, 10u,
+    ALPHA_254_FREQ_CPS, 36u,
+  },
+  {
+    "saz",
+    "Saur",
+    ALPHA_255_UPPER, 51u,
+    ALPHA_255_LOWER, 51u,
+    ALPHA_255_FREQ, 51u,
+    ALPHA_255_DIGITS, 0u,
+    ALPHA_255_UPPER_CPS, 51u,
+    ALPHA_255_LOWER_CPS, 51u,
+    ALPHA_255_DIGITS_CPS, 0u,
+    ALPHA_255_FREQ_CPS, 51u,
+  },
+  {
+    "sbp",
+    "Latn",
+    ALPHA_256_UPPER, 22u,
+    ALPHA_256_LOWER, 22u,
+    ALPHA_256_FREQ, 22u,
+    ALPHA_256_DIGITS, 10u,
+    ALPHA_256_UPPER_CPS, 22u,
+    ALPHA_256_LOWER_CPS, 22u,
+    ALPHA_256_DIGITS_CPS, 10u,
+    ALPHA_256_FREQ_CPS, 22u,
+  },
+  {
+    "sc",
+    "Latn",
+    ALPHA_257_UPPER, 26u,
+    ALPHA_257_LOWER, 26u,
+    ALPHA_257_FREQ, 26u,
+    ALPHA_257_DIGITS, 0u,
+    ALPHA_257_UPPER_CPS, 26u,
+    ALPHA_257_LOWER_CPS, 26u,
+    ALPHA_257_DIGITS_CPS, 0u,
+    ALPHA_257_FREQ_CPS, 26u,
+  },
+  {
+    "scn",
+    "Latn",
+    ALPHA_258_UPPER, 33u,
+    ALPHA_258_LOWER, 33u,
+    ALPHA_258_FREQ, 33u,
+    ALPHA_258_DIGITS, 10u,
+    ALPHA_258_UPPER_CPS, 33u,
+    ALPHA_258_LOWER_CPS, 33u,
+    ALPHA_258_DIGITS_CPS, 10u,
+    ALPHA_258_FREQ_CPS, 33u,
+  },
+  {
+    "sd",
+    "Arab",
+    ALPHA_259_UPPER, 52u,
+    ALPHA_259_LOWER, 52u,
+    ALPHA_259_FREQ, 52u,
+    ALPHA_259_DIGITS, 0u,
+    ALPHA_259_UPPER_CPS, 52u,
+    ALPHA_259_LOWER_CPS, 52u,
+    ALPHA_259_DIGITS_CPS, 0u,
+    ALPHA_259_FREQ_CPS, 52u,
+  },
+  {
+    "sdh",
+    "Arab",
+    ALPHA_260_UPPER, 34u,
+    ALPHA_260_LOWER, 34u,
+    ALPHA_260_FREQ, 34u,
+    ALPHA_260_DIGITS, 10u,
+    ALPHA_260_UPPER_CPS, 34u,
+    ALPHA_260_LOWER_CPS, 34u,
+    ALPHA_260_DIGITS_CPS, 10u,
+    ALPHA_260_FREQ_CPS, 34u,
+  },
+  {
+    "se",
+    "Latn",
+    ALPHA_261_UPPER, 29u,
+    ALPHA_261_LOWER, 29u,
+    ALPHA_261_FREQ, 29u,
+    ALPHA_261_DIGITS, 0u,
+    ALPHA_261_UPPER_CPS, 29u,
+    ALPHA_261_LOWER_CPS, 29u,
+    ALPHA_261_DIGITS_CPS, 0u,
+    ALPHA_261_FREQ_CPS, 29u,
+  },
+  {
+    "seh",
+    "Latn",
+    ALPHA_262_UPPER, 39u,
+    ALPHA_262_LOWER, 39u,
+    ALPHA_262_FREQ, 39u,
+    ALPHA_262_DIGITS, 10u,
+    ALPHA_262_UPPER_CPS, 39u,
+    ALPHA_262_LOWER_CPS, 39u,
+    ALPHA_262_DIGITS_CPS, 10u,
+    ALPHA_262_FREQ_CPS, 39u,
+  },
+  {
+    "ses",
+    "Latn",
+    ALPHA_263_UPPER, 32u,
+    ALPHA_263_LOWER, 32u,
+    ALPHA_263_FREQ, 32u,
+    ALPHA_263_DIGITS, 10u,
+    ALPHA_263_UPPER_CPS, 32u,
+    ALPHA_263_LOWER_CPS, 32u,
+    ALPHA_263_DIGITS_CPS, 10u,
+    ALPHA_263_FREQ_CPS, 32u,
+  },
+  {
+    "sg",
+    "Latn",
+    ALPHA_264_UPPER, 34u,
+    ALPHA_264_LOWER, 34u,
+    ALPHA_264_FREQ, 34u,
+    ALPHA_264_DIGITS, 0u,
+    ALPHA_264_UPPER_CPS, 34u,
+    ALPHA_264_LOWER_CPS, 34u,
+    ALPHA_264_DIGITS_CPS, 0u,
+    ALPHA_264_FREQ_CPS, 34u,
+  },
+  {
+    "sh",
+    "Latn",
+    ALPHA_265_UPPER, 27u,
+    ALPHA_265_LOWER, 27u,
+    ALPHA_265_FREQ, 27u,
+    ALPHA_265_DIGITS, 0u,
+    ALPHA_265_UPPER_CPS, 27u,
+    ALPHA_265_LOWER_CPS, 27u,
+    ALPHA_265_DIGITS_CPS, 0u,
+    ALPHA_265_FREQ_CPS, 27u,
+  },
+  {
+    "shi",
+    "Latn",
+    ALPHA_266_UPPER, 31u,
+    ALPHA_266_LOWER, 31u,
+    ALPHA_266_FREQ, 31u,
+    ALPHA_266_DIGITS, 10u,
+    ALPHA_266_UPPER_CPS, 31u,
+    ALPHA_266_LOWER_CPS, 31u,
+    ALPHA_266_DIGITS_CPS, 10u,
+    ALPHA_266_FREQ_CPS, 31u,
+  },
+  {
+    "si",
+    "Sinh",
+    ALPHA_267_UPPER, 55u,
+    ALPHA_267_LOWER, 55u,
+    ALPHA_267_FREQ, 55u,
+    ALPHA_267_DIGITS, 0u,
+    ALPHA_267_UPPER_CPS, 55u,
+    ALPHA_267_LOWER_CPS, 55u,
+    ALPHA_267_DIGITS_CPS, 0u,
+    ALPHA_267_FREQ_CPS, 55u,
+  },
+  {
+    "sk",
+    "Latn",
+    ALPHA_268_UPPER, 43u,
+    ALPHA_268_LOWER, 43u,
+    ALPHA_268_FREQ, 43u,
+    ALPHA_268_DIGITS, 0u,
+    ALPHA_268_UPPER_CPS, 43u,
+    ALPHA_268_LOWER_CPS, 43u,
+    ALPHA_268_DIGITS_CPS, 0u,
+    ALPHA_268_FREQ_CPS, 43u,
+  },
+  {
+    "sl",
+    "Latn",
+    ALPHA_269_UPPER, 25u,
+    ALPHA_269_LOWER, 25u,
+    ALPHA_269_FREQ, 25u,
+    ALPHA_269_DIGITS, 0u,
+    ALPHA_269_UPPER_CPS, 25u,
+    ALPHA_269_LOWER_CPS, 25u,
+    ALPHA_269_DIGITS_CPS, 0u,
+    ALPHA_269_FREQ_CPS, 25u,
+  },
+  {
+    "sma",
+    "Latn",
+    ALPHA_270_UPPER, 24u,
+    ALPHA_270_LOWER, 24u,
+    ALPHA_270_FREQ, 24u,
+    ALPHA_270_DIGITS, 10u,
+    ALPHA_270_UPPER_CPS, 24u,
+    ALPHA_270_LOWER_CPS, 24u,
+    ALPHA_270_DIGITS_CPS, 10u,
+    ALPHA_270_FREQ_CPS, 24u,
+  },
+  {
+    "smj",
+    "Latn",
+    ALPHA_271_UPPER, 24u,
+    ALPHA_271_LOWER, 24u,
+    ALPHA_271_FREQ, 24u,
+    ALPHA_271_DIGITS, 10u,
+    ALPHA_271_UPPER_CPS, 24u,
+    ALPHA_271_LOWER_CPS, 24u,
+    ALPHA_271_DIGITS_CPS, 10u,
+    ALPHA_271_FREQ_CPS, 24u,
+  },
+  {
+    "smn",
+    "Latn",
+    ALPHA_272_UPPER, 31u,
+    ALPHA_272_LOWER, 31u,
+    ALPHA_272_FREQ, 31u,
+    ALPHA_272_DIGITS, 10u,
+    ALPHA_272_UPPER_CPS, 31u,
+    ALPHA_272_LOWER_CPS, 31u,
+    ALPHA_272_DIGITS_CPS, 10u,
+    ALPHA_272_FREQ_CPS, 31u,
+  },
+  {
+    "sms",
+    "Latn",
+    ALPHA_273_UPPER, 36u,
+    ALPHA_273_LOWER, 36u,
+    ALPHA_273_FREQ, 36u,
+    ALPHA_273_DIGITS, 10u,
+    ALPHA_273_UPPER_CPS, 36u,
+    ALPHA_273_LOWER_CPS, 36u,
+    ALPHA_273_DIGITS_CPS, 10u,
+    ALPHA_273_FREQ_CPS, 36u,
+  },
+  {
+    "sn",
+    "Latn",
+    ALPHA_274_UPPER, 24u,
+    ALPHA_274_LOWER, 24u,
+    ALPHA_274_FREQ, 24u,
+    ALPHA_274_DIGITS, 0u,
+    ALPHA_274_UPPER_CPS, 24u,
+    ALPHA_274_LOWER_CPS, 24u,
+    ALPHA_274_DIGITS_CPS, 0u,
+    ALPHA_274_FREQ_CPS, 24u,
+  },
+  {
+    "so",
+    "Latn",
+    ALPHA_275_UPPER, 18u,
+    ALPHA_275_LOWER, 18u,
+    ALPHA_275_FREQ, 18u,
+    ALPHA_275_DIGITS, 0u,
+    ALPHA_275_UPPER_CPS, 18u,
+    ALPHA_275_LOWER_CPS, 18u,
+    ALPHA_275_DIGITS_CPS, 0u,
+    ALPHA_275_FREQ_CPS, 18u,
+  },
+  {
+    "sq",
+    "Latn",
+    ALPHA_276_UPPER, 27u,
+    ALPHA_276_LOWER, 27u,
+    ALPHA_276_FREQ, 27u,
+    ALPHA_276_DIGITS, 0u,
+    ALPHA_276_UPPER_CPS, 27u,
+    ALPHA_276_LOWER_CPS, 27u,
+    ALPHA_276_DIGITS_CPS, 0u,
+    ALPHA_276_FREQ_CPS, 27u,
+  },
+  {
+    "sr",
+    "Cyrl",
+    ALPHA_277_UPPER, 30u,
+    ALPHA_277_LOWER, 30u,
+    ALPHA_277_FREQ, 30u,
+    ALPHA_277_DIGITS, 0u,
+    ALPHA_277_UPPER_CPS, 30u,
+    ALPHA_277_LOWER_CPS, 30u,
+    ALPHA_277_DIGITS_CPS, 0u,
+    ALPHA_277_FREQ_CPS, 30u,
+  },
+  {
+    "sr",
+    "Latn",
+    ALPHA_278_UPPER, 27u,
+    ALPHA_278_LOWER, 27u,
+    ALPHA_278_FREQ, 27u,
+    ALPHA_278_DIGITS, 0u,
+    ALPHA_278_UPPER_CPS, 27u,
+    ALPHA_278_LOWER_CPS, 27u,
+    ALPHA_278_DIGITS_CPS, 0u,
+    ALPHA_278_FREQ_CPS, 27u,
+  },
+  {
+    "ss",
+    "Latn",
+    ALPHA_279_UPPER, 26u,
+    ALPHA_279_LOWER, 26u,
+    ALPHA_279_FREQ, 26u,
+    ALPHA_279_DIGITS, 0u,
+    ALPHA_279_UPPER_CPS, 26u,
+    ALPHA_279_LOWER_CPS, 26u,
+    ALPHA_279_DIGITS_CPS, 0u,
+    ALPHA_279_FREQ_CPS, 26u,
+  },
+  {
+    "ssy",
+    "Latn",
+    ALPHA_280_UPPER, 22u,
+    ALPHA_280_LOWER, 22u,
+    ALPHA_280_FREQ, 22u,
+    ALPHA_280_DIGITS, 10u,
+    ALPHA_280_UPPER_CPS, 22u,
+    ALPHA_280_LOWER_CPS, 22u,
+    ALPHA_280_DIGITS_CPS, 10u,
+    ALPHA_280_FREQ_CPS, 22u,
+  },
+  {
+    "st",
+    "Latn",
+    ALPHA_281_UPPER, 22u,
+    ALPHA_281_LOWER, 22u,
+    ALPHA_281_FREQ, 22u,
+    ALPHA_281_DIGITS, 0u,
+    ALPHA_281_UPPER_CPS, 22u,
+    ALPHA_281_LOWER_CPS, 22u,
+    ALPHA_281_DIGITS_CPS, 0u,
+    ALPHA_281_FREQ_CPS, 22u,
+  },
+  {
+    "su",
+    "Latn",
+    ALPHA_282_UPPER, 27u,
+    ALPHA_282_LOWER, 27u,
+    ALPHA_282_FREQ, 27u,
+    ALPHA_282_DIGITS, 0u,
+    ALPHA_282_UPPER_CPS, 27u,
+    ALPHA_282_LOWER_CPS, 27u,
+    ALPHA_282_DIGITS_CPS, 0u,
+    ALPHA_282_FREQ_CPS, 27u,
+  },
+  {
+    "sv",
+    "Latn",
+    ALPHA_283_UPPER, 31u,
+    ALPHA_283_LOWER, 31u,
+    ALPHA_283_FREQ, 31u,
+    ALPHA_283_DIGITS, 0u,
+    ALPHA_283_UPPER_CPS, 31u,
+    ALPHA_283_LOWER_CPS, 31u,
+    ALPHA_283_DIGITS_CPS, 0u,
+    ALPHA_283_FREQ_CPS, 31u,
+  },
+  {
+    "sw",
+    "Latn",
+    ALPHA_284_UPPER, 24u,
+    ALPHA_284_LOWER, 24u,
+    ALPHA_284_FREQ, 24u,
+    ALPHA_284_DIGITS, 0u,
+    ALPHA_284_UPPER_CPS, 24u,
+    ALPHA_284_LOWER_CPS, 24u,
+    ALPHA_284_DIGITS_CPS, 0u,
+    ALPHA_284_FREQ_CPS, 24u,
+  },
+  {
+    "syr",
+    "Syrc",
+    ALPHA_285_UPPER, 22u,
+    ALPHA_285_LOWER, 22u,
+    ALPHA_285_FREQ, 22u,
+    ALPHA_285_DIGITS, 0u,
+    ALPHA_285_UPPER_CPS, 22u,
+    ALPHA_285_LOWER_CPS, 22u,
+    ALPHA_285_DIGITS_CPS, 0u,
+    ALPHA_285_FREQ_CPS, 22u,
+  },
+  {
+    "szl",
+    "Latn",
+    ALPHA_286_UPPER, 34u,
+    ALPHA_286_LOWER, 34u,
+    ALPHA_286_FREQ, 34u,
+    ALPHA_286_DIGITS, 10u,
+    ALPHA_286_UPPER_CPS, 34u,
+    ALPHA_286_LOWER_CPS, 34u,
+    ALPHA_286_DIGITS_CPS, 10u,
+    ALPHA_286_FREQ_CPS, 34u,
+  },
+  {
+    "ta",
+    "Taml",
+    ALPHA_287_UPPER, 35u,
+    ALPHA_287_LOWER, 35u,
+    ALPHA_287_FREQ, 35u,
+    ALPHA_287_DIGITS, 0u,
+    ALPHA_287_UPPER_CPS, 35u,
+    ALPHA_287_LOWER_CPS, 35u,
+    ALPHA_287_DIGITS_CPS, 0u,
+    ALPHA_287_FREQ_CPS, 35u,
+  },
+  {
+    "tbw",
+    "Latn",
+    ALPHA_288_UPPER, 18u,
+    ALPHA_288_LOWER, 18u,
+    ALPHA_288_FREQ, 18u,
+    ALPHA_288_DIGITS, 0u,
+    ALPHA_288_UPPER_CPS, 18u,
+    ALPHA_288_LOWER_CPS, 18u,
+    ALPHA_288_DIGITS_CPS, 0u,
+    ALPHA_288_FREQ_CPS, 18u,
+  },
+  {
+    "te",
+    "Telu",
+    ALPHA_289_UPPER, 51u,
+    ALPHA_289_LOWER, 51u,
+    ALPHA_289_FREQ, 51u,
+    ALPHA_289_DIGITS, 0u,
+    ALPHA_289_UPPER_CPS, 51u,
+    ALPHA_289_LOWER_CPS, 51u,
+    ALPHA_289_DIGITS_CPS, 0u,
+    ALPHA_289_FREQ_CPS, 51u,
+  },
+  {
+    "teo",
+    "Latn",
+    ALPHA_290_UPPER, 23u,
+    ALPHA_290_LOWER, 23u,
+    ALPHA_290_FREQ, 23u,
+    ALPHA_290_DIGITS, 10u,
+    ALPHA_290_UPPER_CPS, 23u,
+    ALPHA_290_LOWER_CPS, 23u,
+    ALPHA_290_DIGITS_CPS, 10u,
+    ALPHA_290_FREQ_CPS, 23u,
+  },
+  {
+    "tg",
+    "Cyrl",
+    ALPHA_291_UPPER, 35u,
+    ALPHA_291_LOWER, 35u,
+    ALPHA_291_FREQ, 35u,
+    ALPHA_291_DIGITS, 0u,
+    ALPHA_291_UPPER_CPS, 35u,
+    ALPHA_291_LOWER_CPS, 35u,
+    ALPHA_291_DIGITS_CPS, 0u,
+    ALPHA_291_FREQ_CPS, 35u,
+  },
+  {
+    "th",
+    "Thai",
+    ALPHA_292_UPPER, 57u,
+    ALPHA_292_LOWER, 57u,
+    ALPHA_292_FREQ, 57u,
+    ALPHA_292_DIGITS, 0u,
+    ALPHA_292_UPPER_CPS, 57u,
+    ALPHA_292_LOWER_CPS, 57u,
+    ALPHA_292_DIGITS_CPS, 0u,
+    ALPHA_292_FREQ_CPS, 57u,
+  },
+  {
+    "ti",
+    "Ethi",
+    ALPHA_293_UPPER, 300u,
+    ALPHA_293_LOWER, 300u,
+    ALPHA_293_FREQ, 300u,
+    ALPHA_293_DIGITS, 0u,
+    ALPHA_293_UPPER_CPS, 300u,
+    ALPHA_293_LOWER_CPS, 300u,
+    ALPHA_293_DIGITS_CPS, 0u,
+    ALPHA_293_FREQ_CPS, 300u,
+  },
+  {
+    "tig",
+    "Ethi",
+    ALPHA_294_UPPER, 421u,
+    ALPHA_294_LOWER, 421u,
+    ALPHA_294_FREQ, 421u,
+    ALPHA_294_DIGITS, 10u,
+    ALPHA_294_UPPER_CPS, 421u,
+    ALPHA_294_LOWER_CPS, 421u,
+    ALPHA_294_DIGITS_CPS, 10u,
+    ALPHA_294_FREQ_CPS, 421u,
+  },
+  {
+    "tk",
+    "Latn",
+    ALPHA_295_UPPER, 30u,
+    ALPHA_295_LOWER, 30u,
+    ALPHA_295_FREQ, 30u,
+    ALPHA_295_DIGITS, 0u,
+    ALPHA_295_UPPER_CPS, 30u,
+    ALPHA_295_LOWER_CPS, 30u,
+    ALPHA_295_DIGITS_CPS, 0u,
+    ALPHA_295_FREQ_CPS, 30u,
+  },
+  {
+    "tl",
+    "Latn",
+    ALPHA_296_UPPER, 20u,
+    ALPHA_296_LOWER, 20u,
+    ALPHA_296_FREQ, 20u,
+    ALPHA_296_DIGITS, 0u,
+    ALPHA_296_UPPER_CPS, 20u,
+    ALPHA_296_LOWER_CPS, 20u,
+    ALPHA_296_DIGITS_CPS, 0u,
+    ALPHA_296_FREQ_CPS, 20u,
+  },
+  {
+    "tn",
+    "Latn",
+    ALPHA_297_UPPER, 23u,
+    ALPHA_297_LOWER, 23u,
+    ALPHA_297_FREQ, 23u,
+    ALPHA_297_DIGITS, 0u,
+    ALPHA_297_UPPER_CPS, 23u,
+    ALPHA_297_LOWER_CPS, 23u,
+    ALPHA_297_DIGITS_CPS, 0u,
+    ALPHA_297_FREQ_CPS, 23u,
+  },
+  {
+    "to",
+    "Latn",
+    ALPHA_298_UPPER, 27u,
+    ALPHA_298_LOWER, 27u,
+    ALPHA_298_FREQ, 27u,
+    ALPHA_298_DIGITS, 0u,
+    ALPHA_298_UPPER_CPS, 27u,
+    ALPHA_298_LOWER_CPS, 27u,
+    ALPHA_298_DIGITS_CPS, 0u,
+    ALPHA_298_FREQ_CPS, 27u,
+  },
+  {
+    "tob",
+    "Latn",
+    ALPHA_299_UPPER, 32u,
+    ALPHA_299_LOWER, 32u,
+    ALPHA_299_FREQ, 32u,
+    ALPHA_299_DIGITS, 10u,
+    ALPHA_299_UPPER_CPS, 32u,
+    ALPHA_299_LOWER_CPS, 32u,
+    ALPHA_299_DIGITS_CPS, 10u,
+    ALPHA_299_FREQ_CPS, 32u,
+  },
+  {
+    "tok",
+    "Latn",
+    ALPHA_300_UPPER, 14u,
+    ALPHA_300_LOWER, 14u,
+    ALPHA_300_FREQ, 14u,
+    ALPHA_300_DIGITS, 9u,
+    ALPHA_300_UPPER_CPS, 14u,
+    ALPHA_300_LOWER_CPS, 14u,
+    ALPHA_300_DIGITS_CPS, 9u,
+    ALPHA_300_FREQ_CPS, 14u,
+  },
+  {
+    "top",
+    "Latn",
+    ALPHA_301_UPPER, 32u,
+    ALPHA_301_LOWER, 32u,
+    ALPHA_301_FREQ, 32u,
+    ALPHA_301_DIGITS, 10u,
+    ALPHA_301_UPPER_CPS, 32u,
+    ALPHA_301_LOWER_CPS, 32u,
+    ALPHA_301_DIGITS_CPS, 10u,
+    ALPHA_301_FREQ_CPS, 32u,
+  },
+  {
+    "tpi",
+    "Latn",
+    ALPHA_302_UPPER, 21u,
+    ALPHA_302_LOWER, 21u,
+    ALPHA_302_FREQ, 21u,
+    ALPHA_302_DIGITS, 10u,
+    ALPHA_302_UPPER_CPS, 21u,
+    ALPHA_302_LOWER_CPS, 21u,
+    ALPHA_302_DIGITS_CPS, 10u,
+    ALPHA_302_FREQ_CPS, 21u,
+  },
+  {
+    "tr",
+    "Latn",
+    ALPHA_303_UPPER, 30u,
+    ALPHA_303_LOWER, 30u,
+    ALPHA_303_FREQ, 30u,
+    ALPHA_303_DIGITS, 0u,
+    ALPHA_303_UPPER_CPS, 29u,
+    ALPHA_303_LOWER_CPS, 29u,
+    ALPHA_303_DIGITS_CPS, 0u,
+    ALPHA_303_FREQ_CPS, 29u,
+  },
+  {
+    "ts",
+    "Latn",
+    ALPHA_304_UPPER, 26u,
+    ALPHA_304_LOWER, 26u,
+    ALPHA_304_FREQ, 26u,
+    ALPHA_304_DIGITS, 0u,
+    ALPHA_304_UPPER_CPS, 26u,
+    ALPHA_304_LOWER_CPS, 26u,
+    ALPHA_304_DIGITS_CPS, 0u,
+    ALPHA_304_FREQ_CPS, 26u,
+  },
+  {
+    "tt",
+    "Cyrl",
+    ALPHA_305_UPPER, 39u,
+    ALPHA_305_LOWER, 39u,
+    ALPHA_305_FREQ, 39u,
+    ALPHA_305_DIGITS, 0u,
+    ALPHA_305_UPPER_CPS, 39u,
+    ALPHA_305_LOWER_CPS, 39u,
+    ALPHA_305_DIGITS_CPS, 0u,
+    ALPHA_305_FREQ_CPS, 39u,
+  },
+  {
+    "ttj",
+    "Latn",
+    ALPHA_306_UPPER, 25u,
+    ALPHA_306_LOWER, 25u,
+    ALPHA_306_FREQ, 25u,
+    ALPHA_306_DIGITS, 10u,
+    ALPHA_306_UPPER_CPS, 25u,
+    ALPHA_306_LOWER_CPS, 25u,
+    ALPHA_306_DIGITS_CPS, 10u,
+    ALPHA_306_FREQ_CPS, 25u,
+  },
+  {
+    "twq",
+    "Latn",
+    ALPHA_307_UPPER, 32u,
+    ALPHA_307_LOWER, 32u,
+    ALPHA_307_FREQ, 32u,
+    ALPHA_307_DIGITS, 10u,
+    ALPHA_307_UPPER_CPS, 32u,
+    ALPHA_307_LOWER_CPS, 32u,
+    ALPHA_307_DIGITS_CPS, 10u,
+    ALPHA_307_FREQ_CPS, 32u,
+  },
+  {
+    "tyv",
+    "Cyrl",
+    ALPHA_308_UPPER, 36u,
+    ALPHA_308_LOWER, 36u,
+    ALPHA_308_FREQ, 36u,
+    ALPHA_308_DIGITS, 10u,
+    ALPHA_308_UPPER_CPS, 36u,
+    ALPHA_308_LOWER_CPS, 36u,
+    ALPHA_308_DIGITS_CPS, 10u,
+    ALPHA_308_FREQ_CPS, 36u,
+  },
+  {
+    "tzm",
+    "Latn",
+    ALPHA_309_UPPER, 31u,
+    ALPHA_309_LOWER, 31u,
+    ALPHA_309_FREQ, 31u,
+    ALPHA_309_DIGITS, 10u,
+    ALPHA_309_UPPER_CPS, 31u,
+    ALPHA_309_LOWER_CPS, 31u,
+    ALPHA_309_DIGITS_CPS, 10u,
+    ALPHA_309_FREQ_CPS, 31u,
+  },
+  {
+    "ug",
+    "Arab",
+    ALPHA_310_UPPER, 34u,
+    ALPHA_310_LOWER, 34u,
+    ALPHA_310_FREQ, 34u,
+    ALPHA_310_DIGITS, 0u,
+    ALPHA_310_UPPER_CPS, 34u,
+    ALPHA_310_LOWER_CPS, 34u,
+    ALPHA_310_DIGITS_CPS, 0u,
+    ALPHA_310_FREQ_CPS, 34u,
+  },
+  {
+    "uk",
+    "Cyrl",
+    ALPHA_311_UPPER, 34u,
+    ALPHA_311_LOWER, 34u,
+    ALPHA_311_FREQ, 34u,
+    ALPHA_311_DIGITS, 0u,
+    ALPHA_311_UPPER_CPS, 34u,
+    ALPHA_311_LOWER_CPS, 34u,
+    ALPHA_311_DIGITS_CPS, 0u,
+    ALPHA_311_FREQ_CPS, 34u,
+  },
+  {
+    "ukv",
+    "Latn",
+    ALPHA_312_UPPER, 23u,
+    ALPHA_312_LOWER, 23u,
+    ALPHA_312_FREQ, 23u,
+    ALPHA_312_DIGITS, 10u,
+    ALPHA_312_UPPER_CPS, 23u,
+    ALPHA_312_LOWER_CPS, 23u,
+    ALPHA_312_DIGITS_CPS, 10u,
+    ALPHA_312_FREQ_CPS, 23u,
+  },
+  {
+    "ur",
+    "Arab",
+    ALPHA_313_UPPER, 38u,
+    ALPHA_313_LOWER, 38u,
+    ALPHA_313_FREQ, 38u,
+    ALPHA_313_DIGITS, 0u,
+    ALPHA_313_UPPER_CPS, 38u,
+    ALPHA_313_LOWER_CPS, 38u,
+    ALPHA_313_DIGITS_CPS, 0u,
+    ALPHA_313_FREQ_CPS, 38u,
+  },
+  {
+    "uz",
+    "Cyrl",
+    ALPHA_314_UPPER, 33u,
+    ALPHA_314_LOWER, 33u,
+    ALPHA_314_FREQ, 33u,
+    ALPHA_314_DIGITS, 0u,
+    ALPHA_314_UPPER_CPS, 33u,
+    ALPHA_314_LOWER_CPS, 33u,
+    ALPHA_314_DIGITS_CPS, 0u,
+    ALPHA_314_FREQ_CPS, 33u,
+  },
+  {
+    "uz",
+    "Latn",
+    ALPHA_315_UPPER, 27u,
+    ALPHA_315_LOWER, 27u,
+    ALPHA_315_FREQ, 27u,
+    ALPHA_315_DIGITS, 0u,
+    ALPHA_315_UPPER_CPS, 27u,
+    ALPHA_315_LOWER_CPS, 27u,
+    ALPHA_315_DIGITS_CPS, 0u,
+    ALPHA_315_FREQ_CPS, 27u,
+  },
+  {
+    "vai",
+    "Vaii",
+    ALPHA_316_UPPER, 274u,
+    ALPHA_316_LOWER, 274u,
+    ALPHA_316_FREQ, 274u,
+    ALPHA_316_DIGITS, 10u,
+    ALPHA_316_UPPER_CPS, 274u,
+    ALPHA_316_LOWER_CPS, 274u,
+    ALPHA_316_DIGITS_CPS, 10u,
+    ALPHA_316_FREQ_CPS, 274u,
+  },
+  {
+    "ve",
+    "Latn",
+    ALPHA_317_UPPER, 28u,
+    ALPHA_317_LOWER, 28u,
+    ALPHA_317_FREQ, 28u,
+    ALPHA_317_DIGITS, 0u,
+    ALPHA_317_UPPER_CPS, 28u,
+    ALPHA_317_LOWER_CPS, 28u,
+    ALPHA_317_DIGITS_CPS, 0u,
+    ALPHA_317_FREQ_CPS, 28u,
+  },
+  {
+    "vec",
+    "Latn",
+    ALPHA_318_UPPER, 29u,
+    ALPHA_318_LOWER, 29u,
+    ALPHA_318_FREQ, 29u,
+    ALPHA_318_DIGITS, 10u,
+    ALPHA_318_UPPER_CPS, 29u,
+    ALPHA_318_LOWER_CPS, 29u,
+    ALPHA_318_DIGITS_CPS, 10u,
+    ALPHA_318_FREQ_CPS, 29u,
+  },
+  {
+    "vi",
+    "Latn",
+    ALPHA_319_UPPER, 29u,
+    ALPHA_319_LOWER, 29u,
+    ALPHA_319_FREQ, 29u,
+    ALPHA_319_DIGITS, 10u,
+    ALPHA_319_UPPER_CPS, 29u,
+    ALPHA_319_LOWER_CPS, 29u,
+    ALPHA_319_DIGITS_CPS, 10u,
+    ALPHA_319_FREQ_CPS, 29u,
+  },
+  {
+    "vmw",
+    "Latn",
+    ALPHA_320_UPPER, 22u,
+    ALPHA_320_LOWER, 22u,
+    ALPHA_320_FREQ, 22u,
+    ALPHA_320_DIGITS, 10u,
+    ALPHA_320_UPPER_CPS, 22u,
+    ALPHA_320_LOWER_CPS, 22u,
+    ALPHA_320_DIGITS_CPS, 10u,
+    ALPHA_320_FREQ_CPS, 22u,
+  },
+  {
+    "vo",
+    "Latn",
+    ALPHA_321_UPPER, 27u,
+    ALPHA_321_LOWER, 27u,
+    ALPHA_321_FREQ, 27u,
+    ALPHA_321_DIGITS, 0u,
+    ALPHA_321_UPPER_CPS, 27u,
+    ALPHA_321_LOWER_CPS, 27u,
+    ALPHA_321_DIGITS_CPS, 0u,
+    ALPHA_321_FREQ_CPS, 27u,
+  },
+  {
+    "vun",
+    "Latn",
+    ALPHA_322_UPPER, 24u,
+    ALPHA_322_LOWER, 24u,
+    ALPHA_322_FREQ, 24u,
+    ALPHA_322_DIGITS, 10u,
+    ALPHA_322_UPPER_CPS, 24u,
+    ALPHA_322_LOWER_CPS, 24u,
+    ALPHA_322_DIGITS_CPS, 10u,
+    ALPHA_322_FREQ_CPS, 24u,
+  },
+  {
+    "wa",
+    "Latn",
+    ALPHA_323_UPPER, 43u,
+    ALPHA_323_LOWER, 43u,
+    ALPHA_323_FREQ, 43u,
+    ALPHA_323_DIGITS, 0u,
+    ALPHA_323_UPPER_CPS, 43u,
+    ALPHA_323_LOWER_CPS, 43u,
+    ALPHA_323_DIGITS_CPS, 0u,
+    ALPHA_323_FREQ_CPS, 43u,
+  },
+  {
+    "wae",
+    "Latn",
+    ALPHA_324_UPPER, 39u,
+    ALPHA_324_LOWER, 39u,
+    ALPHA_324_FREQ, 39u,
+    ALPHA_324_DIGITS, 10u,
+    ALPHA_324_UPPER_CPS, 39u,
+    ALPHA_324_LOWER_CPS, 39u,
+    ALPHA_324_DIGITS_CPS, 10u,
+    ALPHA_324_FREQ_CPS, 39u,
+  },
+  {
+    "wbp",
+    "Latn",
+    ALPHA_325_UPPER, 15u,
+    ALPHA_325_LOWER, 15u,
+    ALPHA_325_FREQ, 15u,
+    ALPHA_325_DIGITS, 10u,
+    ALPHA_325_UPPER_CPS, 15u,
+    ALPHA_325_LOWER_CPS, 15u,
+    ALPHA_325_DIGITS_CPS, 10u,
+    ALPHA_325_FREQ_CPS, 15u,
+  },
+  {
+    "wo",
+    "Latn",
+    ALPHA_326_UPPER, 29u,
+    ALPHA_326_LOWER, 29u,
+    ALPHA_326_FREQ, 29u,
+    ALPHA_326_DIGITS, 0u,
+    ALPHA_326_UPPER_CPS, 29u,
+    ALPHA_326_LOWER_CPS, 29u,
+    ALPHA_326_DIGITS_CPS, 0u,
+    ALPHA_326_FREQ_CPS, 29u,
+  },
+  {
+    "xh",
+    "Latn",
+    ALPHA_327_UPPER, 26u,
+    ALPHA_327_LOWER, 26u,
+    ALPHA_327_FREQ, 26u,
+    ALPHA_327_DIGITS, 0u,
+    ALPHA_327_UPPER_CPS, 26u,
+    ALPHA_327_LOWER_CPS, 26u,
+    ALPHA_327_DIGITS_CPS, 0u,
+    ALPHA_327_FREQ_CPS, 26u,
+  },
+  {
+    "xkl",
+    "Latn",
+    ALPHA_328_UPPER, 25u,
+    ALPHA_328_LOWER, 25u,
+    ALPHA_328_FREQ, 25u,
+    ALPHA_328_DIGITS, 10u,
+    ALPHA_328_UPPER_CPS, 25u,
+    ALPHA_328_LOWER_CPS, 25u,
+    ALPHA_328_DIGITS_CPS, 10u,
+    ALPHA_328_FREQ_CPS, 25u,
+  },
+  {
+    "xnr",
+    "Deva",
+    ALPHA_329_UPPER, 50u,
+    ALPHA_329_LOWER, 50u,
+    ALPHA_329_FREQ, 50u,
+    ALPHA_329_DIGITS, 10u,
+    ALPHA_329_UPPER_CPS, 50u,
+    ALPHA_329_LOWER_CPS, 50u,
+    ALPHA_329_DIGITS_CPS, 10u,
+    ALPHA_329_FREQ_CPS, 50u,
+  },
+  {
+    "xog",
+    "Latn",
+    ALPHA_330_UPPER, 26u,
+    ALPHA_330_LOWER, 26u,
+    ALPHA_330_FREQ, 26u,
+    ALPHA_330_DIGITS, 10u,
+    ALPHA_330_UPPER_CPS, 26u,
+    ALPHA_330_LOWER_CPS, 26u,
+    ALPHA_330_DIGITS_CPS, 10u,
+    ALPHA_330_FREQ_CPS, 26u,
+  },
+  {
+    "yav",
+    "Latn",
+    ALPHA_331_UPPER, 45u,
+    ALPHA_331_LOWER, 45u,
+    ALPHA_331_FREQ, 45u,
+    ALPHA_331_DIGITS, 10u,
+    ALPHA_331_UPPER_CPS, 45u,
+    ALPHA_331_LOWER_CPS, 45u,
+    ALPHA_331_DIGITS_CPS, 10u,
+    ALPHA_331_FREQ_CPS, 45u,
+  },
+  {
+    "yi",
+    "Hebr",
+    ALPHA_332_UPPER, 28u,
+    ALPHA_332_LOWER, 28u,
+    ALPHA_332_FREQ, 28u,
+    ALPHA_332_DIGITS, 0u,
+    ALPHA_332_UPPER_CPS, 28u,
+    ALPHA_332_LOWER_CPS, 28u,
+    ALPHA_332_DIGITS_CPS, 0u,
+    ALPHA_332_FREQ_CPS, 28u,
+  },
+  {
+    "yo",
+    "Latn",
+    ALPHA_333_UPPER, 37u,
+    ALPHA_333_LOWER, 37u,
+    ALPHA_333_FREQ, 37u,
+    ALPHA_333_DIGITS, 0u,
+    ALPHA_333_UPPER_CPS, 37u,
+    ALPHA_333_LOWER_CPS, 37u,
+    ALPHA_333_DIGITS_CPS, 0u,
+    ALPHA_333_FREQ_CPS, 37u,
+  },
+  {
+    "yrl",
+    "Latn",
+    ALPHA_334_UPPER, 21u,
+    ALPHA_334_LOWER, 21u,
+    ALPHA_334_FREQ, 21u,
+    ALPHA_334_DIGITS, 10u,
+    ALPHA_334_UPPER_CPS, 21u,
+    ALPHA_334_LOWER_CPS, 21u,
+    ALPHA_334_DIGITS_CPS, 10u,
+    ALPHA_334_FREQ_CPS, 21u,
+  },
+  {
+    "za",
+    "Latn",
+    ALPHA_335_UPPER, 26u,
+    ALPHA_335_LOWER, 26u,
+    ALPHA_335_FREQ, 26u,
+    ALPHA_335_DIGITS, 0u,
+    ALPHA_335_UPPER_CPS, 26u,
+    ALPHA_335_LOWER_CPS, 26u,
+    ALPHA_335_DIGITS_CPS, 0u,
+    ALPHA_335_FREQ_CPS, 26u,
+  },
+  {
+    "zh",
+    "Hans",
+    ALPHA_336_UPPER, 2210u,
+    ALPHA_336_LOWER, 2210u,
+    ALPHA_336_FREQ, 2210u,
+    ALPHA_336_DIGITS, 0u,
+    ALPHA_336_UPPER_CPS, 2210u,
+    ALPHA_336_LOWER_CPS, 2210u,
+    ALPHA_336_DIGITS_CPS, 0u,
+    ALPHA_336_FREQ_CPS, 2210u,
+  },
+  {
+    "zh",
+    "Hant",
+    ALPHA_337_UPPER, 2179u,
+    ALPHA_337_LOWER, 2179u,
+    ALPHA_337_FREQ, 2179u,
+    ALPHA_337_DIGITS, 0u,
+    ALPHA_337_UPPER_CPS, 2179u,
+    ALPHA_337_LOWER_CPS, 2179u,
+    ALPHA_337_DIGITS_CPS, 0u,
+    ALPHA_337_FREQ_CPS, 2179u,
+  },
+  {
+    "zh",
+    "min-nan-Hans",
+    ALPHA_338_UPPER, 2210u,
+    ALPHA_338_LOWER, 2210u,
+    ALPHA_338_FREQ, 2210u,
+    ALPHA_338_DIGITS, 0u,
+    ALPHA_338_UPPER_CPS, 2210u,
+    ALPHA_338_LOWER_CPS, 2210u,
+    ALPHA_338_DIGITS_CPS, 0u,
+    ALPHA_338_FREQ_CPS, 2210u,
+  },
+  {
+    "zh",
+    "yue-Hant",
+    ALPHA_339_UPPER, 2210u,
+    ALPHA_339_LOWER, 2210u,
+    ALPHA_339_FREQ, 2210u,
+    ALPHA_339_DIGITS, 0u,
+    ALPHA_339_UPPER_CPS, 2210u,
+    ALPHA_339_LOWER_CPS, 2210u,
+    ALPHA_339_DIGITS_CPS, 0u,
+    ALPHA_339_FREQ_CPS, 2210u,
+  },
+  {
+    "zra",
+    "Latn",
+    ALPHA_340_UPPER, 48u,
+    ALPHA_340_LOWER, 48u,
+    ALPHA_340_FREQ, 48u,
+    ALPHA_340_DIGITS, 0u,
+    ALPHA_340_UPPER_CPS, 48u,
+    ALPHA_340_LOWER_CPS, 48u,
+    ALPHA_340_DIGITS_CPS, 0u,
+    ALPHA_340_FREQ_CPS, 48u,
+  },
+  {
+    "zu",
+    "Latn",
+    ALPHA_341_UPPER, 26u,
+    ALPHA_341_LOWER, 26u,
+    ALPHA_341_FREQ, 26u,
+    ALPHA_341_DIGITS, 0u,
+    ALPHA_341_UPPER_CPS, 26u,
+    ALPHA_341_LOWER_CPS, 26u,
+    ALPHA_341_DIGITS_CPS, 0u,
+    ALPHA_341_FREQ_CPS, 26u,
+  },
+};
+
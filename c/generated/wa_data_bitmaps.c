@@ -0,0 +1,6931 @@
+#include "worldalphabets_data.h"
+
+const uint64_t WA_CP_BLOCKS[][4] = {
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x03BEFBFE03BEFBFEull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x03BEFBFE00000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0xFDFF19FFFDFF8000ull, 0x00000000800019FFull, 0xF0FC3300CC000000ull, 0x00C0000303000000ull },
+  { 0x0000003000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0xFDFF000000000000ull, 0x00000000800019FFull, 0xA0A8220088000000ull, 0x0080000202000000ull },
+  { 0x0000002000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0xFFFFFFFFFFFF0000ull, 0x000000000000FFFFull, 0x0000000000000000ull, 0x0000000000008001ull },
+  { 0xFFFF000000000000ull, 0x000000000000FFFFull, 0x0000000000000000ull, 0x0000000000008000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE07FFFFFEull, 0x0000000000000000ull, 0x0850CF060850CF06ull },
+  { 0x0000000000000000ull, 0x07FFFFFE00000000ull, 0x0000000000000000ull, 0x0850CF0600000000ull },
+  { 0x0000000000000000ull, 0x06F9FBFE06F9FBFEull, 0x0000000000000000ull, 0x0A1455050A145505ull },
+  { 0x00000C000C0C0003ull, 0x00000C0000003C00ull, 0x0000000000810040ull, 0x00000000001FE000ull },
+  { 0x0000000000000000ull, 0x0000010008100010ull, 0x0000000000100200ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x06F9FBFE00000000ull, 0x0000000000000000ull, 0x0A14550500000000ull },
+  { 0x0000080008080002ull, 0x0000080000002800ull, 0x0000000000000000ull, 0x0000000000154000ull },
+  { 0x0000000000000000ull, 0x0000010008100000ull, 0x0000000000100200ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x02BDFBF602BDFBF6ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000010040ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0000000008100000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x02BDFBF600000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0xFFFFFFFFFFFFFF7Full, 0xFFFFFFFF00003D7Full, 0x7F3D7FFFFFFF3D7Full, 0x00FF7FFFFF7F7F00ull },
+  { 0xFFFFFFFF003D7FFFull, 0x0000000000FFFF7Full, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE07FFFFFEull, 0x0000000000000000ull, 0x1408220214082202ull },
+  { 0x0000000000000000ull, 0x07FFFFFE00000000ull, 0x0000000000000000ull, 0x1408220200000000ull },
+  { 0x07FFFFFE00000000ull, 0x00000000000007FEull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x02BDFBFA02BDFBFAull, 0x0000000000000000ull, 0x1002000010020000ull },
+  { 0x0C00000000000000ull, 0x0000C00000000300ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x02BDFBFA00000000ull, 0x0000000000000000ull, 0x1002000000000000ull },
+  { 0x0800000000000000ull, 0x0000800000000200ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0x03C4FDFFFFF98FE0ull, 0x0003000000000000ull },
+  { 0x0000000000000000ull, 0x06FDFFFE06FDFFFEull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x06FDFFFE00000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x077FF3FE077FF3FEull, 0x0000000000000000ull, 0x140A2202140A2202ull },
+  { 0x00C0003000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x077FF3FE00000000ull, 0x0000000000000000ull, 0x140A220200000000ull },
+  { 0x0080002000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE07FFFFFEull, 0x0000000000000000ull, 0x140AA212140AA212ull },
+  { 0x0000000000000000ull, 0x07FFFFFE00000000ull, 0x0000000000000000ull, 0x140AA21200000000ull },
+  { 0xFFFF09BFFFFF0100ull, 0x00000000010009BFull, 0x0F00C000300C0000ull, 0x0000030003000000ull },
+  { 0xFFFF000000000000ull, 0x00000000010009BFull, 0x0A00800020080000ull, 0x0000020002000000ull },
+  { 0x0000000000000000ull, 0x077FFFFE077FFFFEull, 0x0000000000000000ull, 0x1040008010400080ull },
+  { 0x00030000C0000000ull, 0x00000000C0000000ull, 0x0000000000008000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0000000002000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x077FFFFE00000000ull, 0x0000000000000000ull, 0x1040008000000000ull },
+  { 0x0002000080000000ull, 0x0000000080000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0xFFFFFFFFFFFF0002ull, 0x000000000002FFFFull, 0x0C00CC0F030C0000ull, 0x0000030003000000ull },
+  { 0xFFFF000000000000ull, 0x000000000002FFFFull, 0x0800880A02080000ull, 0x0000020002000000ull },
+  { 0x001E95C400000000ull, 0x42000000000001F0ull, 0x0000820001020140ull, 0x0000000000045040ull },
+  { 0x0000000000000000ull, 0x06BDFFFE06BDFFFEull, 0x0000000000000000ull, 0x0008020200080202ull },
+  { 0x0000000000000000ull, 0x06BDFFFE00000000ull, 0x0000000000000000ull, 0x0008020200000000ull },
+  { 0xFFFFFFFFFFFFFFFFull, 0x0000000000000FFFull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x06FDFFFE06FDFFFEull, 0x0000000000000000ull, 0x0E1C77070E1C7707ull },
+  { 0x00000C000C0C0003ull, 0x00000C0000003C18ull, 0x0000000000010042ull, 0x03000000001FE000ull },
+  { 0x0000000000000000ull, 0x0000000008180000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x06FDFFFE00000000ull, 0x0000000000000000ull, 0x0E1C770700000000ull },
+  { 0x0000080008080002ull, 0x0000080000002810ull, 0x0000000000000000ull, 0x0200000000154000ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0xFFFFFFFF00000000ull, 0x0000FFFFFFFFFFFFull },
+  { 0xFEFFF9FFFEFF4042ull, 0x000000004042F9FFull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0xFEFF000000000000ull, 0x000000004042F9FFull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x02B9FFEE02B9FFEEull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x02B9FFEE00000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE07FFFFFEull, 0x0000000000000000ull, 0x0000030000000300ull },
+  { 0x0000000000300000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE00000000ull, 0x0000000000000000ull, 0x0000030000000000ull },
+  { 0x0000000000200000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x06FFFFFE06FFFFFEull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x06FFFFFE00000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0xFFFFD7FFFFFF0000ull, 0x000000000000D7FFull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0xFFFF000000000000ull, 0x000000000000D7FFull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x03E5FDFFFFF98FE0ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x05FEFDC400000000ull, 0x4200000000000176ull, 0x4000820001020140ull, 0x0000000000005040ull },
+  { 0x03E5FDFFFDE00000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x00000000000FFFFFull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x06BDFFFE06BDFFFEull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0000000000000C00ull, 0x0000000020010040ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0004000008100000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x06BDFFFE00000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0000000000000800ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000007EFFFDFC00ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0x03C5FDFFFFF98FEEull, 0x00000000B0006000ull },
+  { 0x0000000000000000ull, 0x000005FFEF7BDEF7ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x07FDFFF607FDFFF6ull, 0x0000000000000000ull, 0x0202040002020400ull },
+  { 0x0000000000000000ull, 0x07FDFFF600000000ull, 0x0000000000000000ull, 0x0202040000000000ull },
+  { 0x03EDFDFFFDFBA7E0ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE07FFFFFEull, 0x0000000000000000ull, 0x0000020000000200ull },
+  { 0x00000000000330C0ull, 0x6000000300000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE00000000ull, 0x0000000000000000ull, 0x0000020000000000ull },
+  { 0x0000000000022080ull, 0x4000000200000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x06B9FFBE06B9FFBEull, 0x0000000000000000ull, 0x0C1866060C186606ull },
+  { 0x00000C000C0C0003ull, 0x00000C0000003C18ull, 0x0000000000018040ull, 0x00000000001FE000ull },
+  { 0x0000000000000000ull, 0x000000000A100000ull, 0x1000000000000000ull, 0x0000000000000000ull },
+  { 0xC000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x06B9FFBE00000000ull, 0x0000000000000000ull, 0x0C18660600000000ull },
+  { 0x0000080008080002ull, 0x0000080000002810ull, 0x0000000000000000ull, 0x0000000000154000ull },
+  { 0x8000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x00000000CFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x000FFFFFFFFFFFFFull },
+  { 0xFFFFFF00FFFFFF7Full, 0xFFFFFFFF3D7F3D7Full, 0x7F3D7FFFFFFF3D7Full, 0x00FF7FFFFF7F7F3Dull },
+  { 0xFF00FFFFFF3D7FFFull, 0x0000000000FFFF00ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000780000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE07FFFFFEull, 0x0000000000000000ull, 0x140CA381140CA381ull },
+  { 0x0000000000000000ull, 0x07FFFFFE00000000ull, 0x0000000000000000ull, 0x140CA38100000000ull },
+  { 0x0000000000000000ull, 0x02B9EB3E02B9EB3Eull, 0x0000000000000000ull, 0x060C3303060C3303ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0x1000000000000000ull, 0x0000000000010001ull },
+  { 0x0000000000000000ull, 0x02B9EB3E00000000ull, 0x0000000000000000ull, 0x060C330300000000ull },
+  { 0x0000007FFFFFFFF8ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0xFFFFFFFFFFFF0002ull, 0x000000000002FFFFull, 0x0000000000000000ull, 0x0000000000008001ull },
+  { 0xFFFF000000000000ull, 0x000000000002FFFFull, 0x0000000000000000ull, 0x0000000000008000ull },
+  { 0x0000000000000000ull, 0x02BDFBB602BDFBB6ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x02BDFBB600000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE07FFFFFEull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE00000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x02F9FB6E02F9FB6Eull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0x0004000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000800ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x02F9FB6E00000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0xFFFFFFFF00000000ull, 0x1F1FFFFFFFFFFFFFull },
+  { 0x0000000000000000ull, 0xFFFF000000000000ull, 0xFFFFFFFFFFFFFFFFull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x1F00000000000000ull },
+  { 0x0000000000000000ull, 0x0299FBCE0299FBCEull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0x1000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0299FBCE00000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x061EF5C000000000ull, 0x40000000000001F6ull, 0x0020821001200040ull, 0x0000000000205040ull },
+  { 0x0000000000000000ull, 0x047FF7FE047FF7FEull, 0x0000000000000000ull, 0x1204910112049101ull },
+  { 0x0000000000000000ull, 0x047FF7FE00000000ull, 0x0000000000000000ull, 0x1204910100000000ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000FFFC00000000ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0x0003FFFFFFFFFFFFull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000AAA800000000ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0x0002AAAAAAAAAAAAull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE07FFFFFEull, 0x0000000000000000ull, 0x2408220224082202ull },
+  { 0x000000000C00F000ull, 0x6000C03303000180ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE00000000ull, 0x0000000000000000ull, 0x2408220200000000ull },
+  { 0x000000000800A000ull, 0x4000802202000100ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x031E815D852AAC7Aull, 0x000DE8000063D400ull, 0x10000DE800037A00ull, 0x0037A8000DE801BDull },
+  { 0x00006F4000000000ull, 0x2000000000021BC9ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0xFFFF5FFFFFFF00F0ull, 0xFCFFCCCF00F05FFFull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000800000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x8000000000C03C03ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0xFFFF000000000000ull, 0xA8AA888A00F05FFFull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x8000000000802802ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0xFFFFFFFFFFFF0002ull, 0x000000000002FFFFull, 0x00000C0000000000ull, 0x000C000000C30000ull },
+  { 0xFFFF000000000000ull, 0x000000000002FFFFull, 0x0000080000000000ull, 0x0008000000820000ull },
+  { 0x0000000000000000ull, 0x02BDF7FE02BDF7FEull, 0x0000000000000000ull, 0xBE5CFF173E5CFF17ull },
+  { 0x0000000000000000ull, 0x01F0000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0x000000000000003Full, 0x000C000000000000ull },
+  { 0x0000000000000000ull, 0x02BDF7FE00000000ull, 0x0000000000000000ull, 0xBE5CFF1700000000ull },
+  { 0x0000000000000000ull, 0x00A0000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0x000000000000002Aull, 0x0008000000000000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE07FFFFFEull, 0x0000000000000000ull, 0x0100006001000060ull },
+  { 0x0000000000000000ull, 0x07FFFFFE00000000ull, 0x0000000000000000ull, 0x0100006000000000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE07FFFFFEull, 0x0000000000000000ull, 0x1040001090400010ull },
+  { 0x0000000000000000ull, 0x07FFFFFE00000000ull, 0x0000000000000000ull, 0x1040001080000000ull },
+  { 0x0000000000000000ull, 0x07BFFFFE07BFFFFEull, 0x0000000000000000ull, 0x0020000800200008ull },
+  { 0x0000000000000000ull, 0x6000000300000C00ull, 0x0000000020000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0004000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0x3000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x07BFFFFE00000000ull, 0x0000000000000000ull, 0x0020000800000000ull },
+  { 0x0000000000000000ull, 0x4000000200000800ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0x2000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE07FFFFFEull, 0x0000000000000000ull, 0x0008000000080000ull },
+  { 0x000000000C0030C0ull, 0x660000030C30001Eull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE00000000ull, 0x0000000000000000ull, 0x0008000000000000ull },
+  { 0x0000000008002080ull, 0x4400000208200014ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x02BDFEFE02BDFEFEull, 0x0000000000000000ull, 0x0408220204082202ull },
+  { 0x0000000000000000ull, 0x00000C0000000C00ull, 0x0000000000010442ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0000000008980000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x02BDFEFE00000000ull, 0x0000000000000000ull, 0x0408220200000000ull },
+  { 0x0000000000000000ull, 0x0000080000000800ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000FFFFFFull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x03FFFFFE03FFFFFEull, 0x0000000000000000ull, 0x040A2202040A2202ull },
+  { 0x0000000000000000ull, 0x0000000000000C00ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x03FFFFFE00000000ull, 0x0000000000000000ull, 0x040A220200000000ull },
+  { 0x0000000000000000ull, 0x000001DFEF7B82F7ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000030000000000ull, 0x0000030000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000020000000000ull, 0x0000020000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x07FDFBF607FDFBF6ull, 0x0000000000000000ull, 0x062C330B062C330Bull },
+  { 0x0000030000000000ull, 0x0000030000000C00ull, 0x0004000000170240ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0000000808500000ull, 0x0000000000000800ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x07FDFBF600000000ull, 0x0000000000000000ull, 0x062C330B00000000ull },
+  { 0x0000020000000000ull, 0x0000020000000800ull, 0x0000000000040000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0xFFFFFFFBFFFFD740ull, 0x0000000000007FFFull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0xFFFFF00000010000ull, 0x0000000000007FFFull },
+  { 0x0000000000000000ull, 0x047DFFFE047DFFFEull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0030003030000300ull, 0x0000300030000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x047DFFFE00000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0020002020000200ull, 0x0000200020000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE07FFFFFEull, 0x0000000000000000ull, 0x140A2202140A2202ull },
+  { 0x0000000000000000ull, 0x07FFFFFE00000000ull, 0x0000000000000000ull, 0x140A220200000000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE07FFFFFEull, 0x0000000000000000ull, 0x1060001010600010ull },
+  { 0x0000000000000000ull, 0x6000000300000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE00000000ull, 0x0000000000000000ull, 0x1060001000000000ull },
+  { 0x0000000000000000ull, 0x4000000200000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE07FFFFFEull, 0x0000000000000000ull, 0x0002008000020080ull },
+  { 0x0000000000000000ull, 0x07FFFFFE00000000ull, 0x0000000000000000ull, 0x0002008000000000ull },
+  { 0x0000000000000000ull, 0x06FDFBF606FDFBF6ull, 0x0000000000000000ull, 0x0E1C77070E1C7707ull },
+  { 0x000000000C000000ull, 0x0000000000000C18ull, 0x0000000000018040ull, 0x03000000001FE000ull },
+  { 0x0000000000000000ull, 0x000000000A100000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x06FDFBF600000000ull, 0x0000000000000000ull, 0x0E1C770700000000ull },
+  { 0x0000000008000000ull, 0x0000000000000810ull, 0x0000000000000000ull, 0x0200000000154000ull },
+  { 0x07FFFFDE00000000ull, 0x40000000000001F6ull, 0x0000820001000040ull, 0x0000000000001000ull },
+  { 0x3FFFFFFC0FFFFFFFull, 0x0000000000000800ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x3FFFFFFC00000000ull, 0x0000000000000800ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x02BDFFFE02BDFFFEull, 0x0000000000000000ull, 0x0002000000020000ull },
+  { 0x0000000000000000ull, 0x0000000000000C00ull, 0x0018000000000402ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0000000000880000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x02BDFFFE00000000ull, 0x0000000000000000ull, 0x0002000000000000ull },
+  { 0x0000000000000000ull, 0x0000000000000800ull, 0x0010000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE07FFFFFEull, 0x0000000000000000ull, 0x0040003000400030ull },
+  { 0x0000000000000000ull, 0x07FFFFFE00000000ull, 0x0000000000000000ull, 0x0040003000000000ull },
+  { 0x0000000000000000ull, 0x027DFFF6027DFFF6ull, 0x0000000000000000ull, 0x2509204225092042ull },
+  { 0x0000000000000000ull, 0x027DFFF600000000ull, 0x0000000000000000ull, 0x2509204200000000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE07FFFFFEull, 0x0000000000000000ull, 0x9A10CFC51A10CFC5ull },
+  { 0x0000000000000000ull, 0x01000000000C0000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE00000000ull, 0x0000000000000000ull, 0x9A10CFC500000000ull },
+  { 0x0000000000000000ull, 0x0000000000080000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x00BDFFFE00BDFFFEull, 0x0000000000000000ull, 0x1040003010400030ull },
+  { 0x00000000000F0003ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x00BDFFFE00000000ull, 0x0000000000000000ull, 0x1040003000000000ull },
+  { 0x00000000000A0002ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE07FFFFFEull, 0x0000000000000000ull, 0x0A1455850A145585ull },
+  { 0x0000000000000000ull, 0x07FFFFFE00000000ull, 0x0000000000000000ull, 0x0A14558500000000ull },
+  { 0x0000000000000000ull, 0x06FDFFFE06FDFFFEull, 0x0000000000000000ull, 0x3C58AF173C58AF17ull },
+  { 0x0000000000000000ull, 0x06FDFFFE00000000ull, 0x0000000000000000ull, 0x3C58AF1700000000ull },
+  { 0x0000000000000000ull, 0x003DF3FE003DF3FEull, 0x0000000000000000ull, 0x0408220204082202ull },
+  { 0x0000000000000000ull, 0x003DF3FE00000000ull, 0x0000000000000000ull, 0x0408220200000000ull },
+  { 0x0000000000000000ull, 0x06FDFFF606FDFFF6ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0000000000000C00ull, 0x0000000000010040ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x06FDFFF600000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x003DF3FE003DF3FEull, 0x0000000000000000ull, 0x0204110102041101ull },
+  { 0x0000000000000000ull, 0x003DF3FE00000000ull, 0x0000000000000000ull, 0x0204110100000000ull },
+  { 0x007F7F7F7F7F7F7Full, 0x007F007F00003D7Full, 0x003D7F7F007F3D7Full, 0x007F7F007F7F7F00ull },
+  { 0x7F7F007F003D7F00ull, 0x00000000007F7F7Full, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE07FFFFFEull, 0x0000000000000000ull, 0x140AA202140AA202ull },
+  { 0x0000000000000000ull, 0x07FFFFFE00000000ull, 0x0000000000000000ull, 0x140AA20200000000ull },
+  { 0x0000000000000000ull, 0x027DFFBE027DFFBEull, 0x0000000000000000ull, 0x0022000800220008ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0x3000000000000000ull, 0x0300000000000000ull },
+  { 0x0000000000000000ull, 0x027DFFBE00000000ull, 0x0000000000000000ull, 0x0022000800000000ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0x2000000000000000ull, 0x0200000000000000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE07FFFFFEull, 0x0000000000000000ull, 0x1040001010400010ull },
+  { 0x0000000000000000ull, 0x07FFFFFE00000000ull, 0x0000000000000000ull, 0x1040001000000000ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0x23EDFDFFFFFBAFE0ull, 0x0000000100010000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE07FFFFFEull, 0x0000000000000000ull, 0x0000008000000080ull },
+  { 0x0000000000000000ull, 0x07FFFFFE00000000ull, 0x0000000000000000ull, 0x0000008000000000ull },
+  { 0x0000000000000000ull, 0x06BCFFFE06BCFFFEull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0x0018000003000402ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0000000000880000ull, 0x1000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x06BCFFFE00000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0x0010000002000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x00A1FB2200A1FB22ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x00000C00000C0003ull, 0x00000C0000003000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0x0800000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x00A1FB2200000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000080000080002ull, 0x0000080000002000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x000007FFFFFF0000ull },
+  { 0x23EDFDFFFFFBBFE0ull, 0x0000000000010000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x007FFFFF00000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE07FFFFFEull, 0x0000000000000000ull, 0x1000020210000202ull },
+  { 0x0000000000000000ull, 0x07FFFFFE00000000ull, 0x0000000000000000ull, 0x1000020200000000ull },
+  { 0x000000000C0030C0ull, 0x660000030300001Eull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000008002080ull, 0x4400000202000014ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x06FDFFFE06FDFFFEull, 0x0000000000000000ull, 0x0004010000040100ull },
+  { 0x0000000000000000ull, 0x06FDFFFE00000000ull, 0x0000000000000000ull, 0x0004010000000000ull },
+  { 0x0000000000000000ull, 0x067DFFFE067DFFFEull, 0x0000000000000000ull, 0x1448220214482202ull },
+  { 0x0000000000000000ull, 0x0003000000030000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x067DFFFE00000000ull, 0x0000000000000000ull, 0x1448220200000000ull },
+  { 0x0000000000000000ull, 0x0002000000020000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0xFFFE000000000000ull, 0xFFFFFFFE007FFFFFull, 0x000000000000007Full, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0xFFFFFFFE00000000ull, 0x000000000000007Full, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE07FFFFFEull, 0x0000000000000000ull, 0x0408220204082202ull },
+  { 0x0000000000000000ull, 0x07FFFFFE00000000ull, 0x0000000000000000ull, 0x0408220200000000ull },
+  { 0x0000000000000000ull, 0x0000000000000030ull, 0x0300000000000000ull, 0x0000003000003C00ull },
+  { 0x0000000000000000ull, 0x0000000000000020ull, 0x0200000000000000ull, 0x0000002000002800ull },
+  { 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull },
+  { 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x0000000000001FFFull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x037DFFF6037DFFF6ull, 0x0000000000000000ull, 0x6449224264492242ull },
+  { 0x0000000000000000ull, 0x037DFFF600000000ull, 0x0000000000000000ull, 0x6449224200000000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE07FFFFFEull, 0x0000000000000000ull, 0x0204130102041301ull },
+  { 0x0000000000000000ull, 0x07FFFFFE00000000ull, 0x0000000000000000ull, 0x0204130100000000ull },
+  { 0x031E000000000C78ull, 0x000DE0400063C200ull, 0x08000DE200037808ull, 0x003784000DE101BCull },
+  { 0x40006F0000000020ull, 0x8000000027E11BC0ull, 0x0000007F007E802Full, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x007E000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x007F7E82007F7E82ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0000000000000006ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x007F7E8200000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0000000000000004ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0xC924FD52AAAAAD54ull, 0x00000000000CBF57ull, 0x0000000000000000ull },
+  { 0x0000000000000020ull, 0xFFFFFFFFFFFFFFFEull, 0xFFFFFFFE600FFFFFull, 0x707FFFFFFFFFFFFFull },
+  { 0x1B04204203506F8Bull, 0x400A000062808020ull, 0x0400381210341B41ull, 0x0845403803608C02ull },
+  { 0x151080002403C002ull, 0x802800001229E040ull, 0x8060C00228002800ull, 0x052840022080040Cull },
+  { 0x0200081882042A00ull, 0x2070002010008200ull, 0x40A4100003022000ull, 0x000000800420A020ull },
+  { 0x0000040080040011ull, 0x11A2392004012B78ull, 0x00C0102102842460ull, 0x0740004220002050ull },
+  { 0x0FC10230208205C9ull, 0x0025803808402480ull, 0x4212060988000080ull, 0x40040094A32002A8ull },
+  { 0x8E00000100C00024ull, 0x013B0001059E058Aull, 0x0808000085000010ull, 0x018F983802D07D04ull },
+  { 0x030008408803F310ull, 0x3008050000000704ull, 0x2004000000001000ull, 0x0404000200000003ull },
+  { 0x40028000000100D0ull, 0x0000000000088040ull, 0x00400E0034000210ull, 0x0000000800000020ull },
+  { 0x0006000000000040ull, 0x0010010000000000ull, 0x0000000000000080ull, 0x240D00094C000000ull },
+  { 0x0001018080048000ull, 0x0000040000020484ull, 0x0000000800000804ull, 0x1680000080004800ull },
+  { 0x0012041000200065ull, 0x40000A0044920403ull, 0x4008010010880008ull, 0x0007480000001482ull },
+  { 0x00024E8414608200ull, 0x2018452000128380ull, 0x0A0011200240041Cull, 0x8800080000180A00ull },
+  { 0x0000800101000002ull, 0x8000004004000040ull, 0x0000000008040000ull, 0x0000000200001202ull },
+  { 0x0000000400000000ull, 0x0000085821910000ull, 0x8279401CBF8013A0ull, 0xC5004282A8041054ull },
+  { 0xFC0200000402CE56ull, 0x0002803040200D21ull, 0x0108120200010000ull, 0x0041000300000000ull },
+  { 0x0000020000404080ull, 0x0000000000010000ull, 0x0000000000000000ull, 0x480241EA60000000ull },
+  { 0x2109A8202000104Cull, 0x7B1C000800200020ull, 0x01C028C010A0840Aull, 0x04C0000000000608ull },
+  { 0x40A200E080398412ull, 0x12030A0402080000ull, 0x02184602008D1833ull, 0x0020080113803028ull },
+  { 0x000005A120440000ull, 0x0020A32800050800ull, 0x1004064980100000ull, 0x0009018010020020ull },
+  { 0x000000008C008202ull, 0x0041410C00205910ull, 0x4044129000004004ull, 0x0104000000010080ull },
+  { 0x8910804004070000ull, 0x8242000000282A81ull, 0x3222080051A20411ull, 0x40C830032B0D2220ull },
+  { 0x8000890082020082ull, 0x0800410010A00200ull, 0x000405A609041108ull, 0x041040020C018000ull },
+  { 0x4400300000002000ull, 0x0000820001000004ull, 0x0004401000000008ull, 0x0000104000002002ull },
+  { 0xCA00800000000000ull, 0x00B1100C02828020ull, 0x2201303012824280ull, 0x040013E400808820ull },
+  { 0x1000A1A1801840C0ull, 0x0050C20000000004ull, 0x0010484000C20082ull, 0xA314000010400080ull },
+  { 0x24123D00A8A02301ull, 0xC002802280030200ull, 0x0040800534A10000ull, 0x882A000000190010ull },
+  { 0x3300040200080018ull, 0x000000009002010Aull, 0x0001010000800020ull, 0x0400400084040810ull },
+  { 0x0000000010006020ull, 0x30A0200000000000ull, 0x0000000000000004ull, 0x2000000001000800ull },
+  { 0x0200060202000000ull, 0x0000000080000800ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x4404008300000010ull, 0x0818824C00081000ull, 0x8C30000000400E00ull, 0x0000000008146001ull },
+  { 0x4190000000828000ull, 0x2401000184804006ull, 0x9B08000602400108ull, 0x0009012E00201602ull },
+  { 0x4800042040800800ull, 0x0190444010000032ull, 0x1004800002000100ull, 0x0882080200020000ull },
+  { 0x0000924208080BA0ull, 0xC000808000400000ull, 0x0440000020410001ull, 0x0010000060020820ull },
+  { 0x0100180500108046ull, 0x0001401090100000ull, 0x0000000000000010ull, 0x000088000000000Bull },
+  { 0x0000100000000000ull, 0x2001880000000000ull, 0x0600200000004600ull, 0x0000000000000100ull },
+  { 0x1040004200000000ull, 0x0000428002004000ull, 0x0002000080000400ull, 0x0000002000000008ull },
+  { 0x2060040000000040ull, 0x020402800A000180ull, 0x0040900100000000ull, 0x0000320002000004ull },
+  { 0x8040480088000000ull, 0x0004000800000010ull, 0x0000020000000A90ull, 0x4000200100002000ull },
+  { 0x0010000000000048ull, 0x0000000100000000ull, 0x2001008000000008ull, 0x0040004000000000ull },
+  { 0x0C8F010885000000ull, 0x8009042032129000ull, 0x4004080000024000ull, 0x00100204092000A0ull },
+  { 0x0000000000002000ull, 0x6C00000000440004ull, 0x80004000000000D0ull, 0x4114401888800440ull },
+  { 0x1400000180001A02ull, 0x0000004A00000001ull, 0x0008300000000000ull, 0x0008A02408000000ull },
+  { 0x0014000000300004ull, 0x0000180020000000ull, 0x0400000000020002ull, 0x0000010000000002ull },
+  { 0x5400000000004002ull, 0x0000212060400300ull, 0x000000000000A022ull, 0x0801020081060803ull },
+  { 0xB004400004004800ull, 0x045008000000A005ull, 0x0000C000800C000Aull, 0x0240802110000800ull },
+  { 0x0000104008020000ull, 0x0000000000540A40ull, 0x0102000200800880ull, 0x0000001000000211ull },
+  { 0x8000000200000000ull, 0x0008000100002000ull, 0x4000008009840A00ull, 0x4900008000400000ull },
+  { 0x060988070E102831ull, 0x0262004240011014ull, 0x8806200006000000ull, 0x0810830104068400ull },
+  { 0x4000484008000012ull, 0x0001200000300402ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0040000000000000ull, 0x00A5440000000000ull, 0x2000031040004420ull, 0x1800000000041002ull },
+  { 0x0008000000A1002Aull, 0x0090000040400000ull, 0x0404862621401200ull, 0x2110000040005048ull },
+  { 0x000A0000040005A4ull, 0x0701080000214000ull, 0x0008010034000000ull, 0x1018250800080040ull },
+  { 0x02C01400C0805100ull, 0x0044804000000080ull, 0x210A800020000800ull, 0x0002006008800000ull },
+  { 0x0040010000004004ull, 0x0080000001040200ull, 0x0000000000000000ull, 0x0000800010081400ull },
+  { 0x2000000000004000ull, 0x0000100008800200ull, 0x0100000000000000ull, 0x0000000000000810ull },
+  { 0x2020000000020000ull, 0x0000000000000000ull, 0x00001C4000000010ull, 0x0800021000002000ull },
+  { 0x0000000000000000ull, 0x0200080054014000ull, 0x0000000000200400ull, 0x0000400000002080ull },
+  { 0x0000000010000004ull, 0x0000000000000000ull, 0x0000000000002000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0081010A28881041ull, 0x0000080000400800ull, 0x6100000010208026ull },
+  { 0x0000000000050080ull, 0x8004000080000000ull, 0x00080480044088C2ull, 0x0000004800040000ull },
+  { 0x141A24008188410Dull, 0x000F424940310000ull, 0x8005301141283280ull, 0x410060C000400880ull },
+  { 0x020000022A004013ull, 0x0085004011000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0080000000000000ull, 0x0000040204000440ull, 0x99909F8760001000ull, 0x100024455808049Dull },
+  { 0x0000000000000100ull, 0x0091005000000000ull, 0x0008000800000420ull, 0x0028800220000000ull },
+  { 0x0000040000008400ull, 0x0010000000000000ull, 0x0000080000002000ull, 0x2100000480043400ull },
+  { 0x0100060020000208ull, 0x0000000000000010ull, 0x1406000848000000ull, 0x2081280000124020ull },
+  { 0x01064009A419804Bull, 0x85A0620B10386CA4ull, 0x0100044800000010ull, 0x20A0210200004400ull },
+  { 0x0000000000000000ull, 0x01A0140400147000ull, 0x0100000010040000ull, 0x000000083002F180ull },
+  { 0x0010000000002000ull, 0x0002000408000010ull, 0x0000200001000029ull, 0x1008200000000000ull },
+  { 0x0004D04100000000ull, 0x0020000008000800ull, 0x0000400000401000ull, 0x0000000200000000ull },
+  { 0x0000000001000000ull, 0x0000000000020000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0080000000000000ull, 0x0004002C000A0A01ull, 0x0000000001000080ull },
+  { 0x0804040010000000ull, 0x2569043C08012010ull, 0x088000091A10C460ull, 0x08C5050C000210F0ull },
+  { 0x0004008010000481ull, 0x0010020442040000ull, 0x0000000000000000ull, 0x8808000000080000ull },
+  { 0x18003000010F016Cull, 0x0000008041307000ull, 0x0000010000000000ull, 0x7004800488000000ull },
+  { 0x0000010000081420ull, 0x0000000000000000ull, 0x0000100002400000ull, 0x0000000000050070ull },
+  { 0x00010000000C4000ull, 0x0000000004000000ull, 0x0100010000000000ull, 0x0000040001000010ull },
+  { 0x1002000000000000ull, 0x0000000004100024ull, 0x0000400000000000ull, 0x0000010000000000ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0010002000000000ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0x0010000000008000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x8000000000000000ull, 0x0C00004000880000ull, 0x0000000002040010ull },
+  { 0x0800000000080000ull, 0x0000000400000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0xAAAAAD5400000000ull, 0x000CBF57C924FD52ull },
+  { 0x0000000000000000ull, 0x077DFFFE077DFFFEull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x077DFFFE00000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x06F97FDE06F97FDEull, 0x0000000000000000ull, 0x0C0060060C006006ull },
+  { 0x0000000000000000ull, 0x0000000000000C18ull, 0x0000000000010040ull, 0x030000000019E000ull },
+  { 0x0000000000000000ull, 0x0000000008100010ull, 0x0000000000000200ull, 0x0000000000000000ull },
+  { 0xC000000000000000ull, 0x0000000000000000ull, 0x0000000000000030ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000001800ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x06F97FDE00000000ull, 0x0000000000000000ull, 0x0C00600600000000ull },
+  { 0x0000000000000000ull, 0x0000000000000810ull, 0x0000000000000000ull, 0x0200000000114000ull },
+  { 0x0000000000000000ull, 0x0000000008100000ull, 0x0000000000000200ull, 0x0000000000000000ull },
+  { 0x8000000000000000ull, 0x0000000000000000ull, 0x0000000000000020ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000001000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x02BDFFBE02BDFFBEull, 0x0000000000000000ull, 0x0204172402041724ull },
+  { 0x0000000000000000ull, 0x02BDFFBE00000000ull, 0x0000000000000000ull, 0x0204172400000000ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0001FFFFFFFF0000ull },
+  { 0xFFFFFFFFFFFF4002ull, 0x000000004002FFFFull, 0x000CC00C0C0C0000ull, 0x0000030003000000ull },
+  { 0xFFFF000000000000ull, 0x000000004002FFFFull, 0x0008800808080000ull, 0x0000020002000000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE07FFFFFEull, 0x0000000000000000ull, 0x0408000204080002ull },
+  { 0x0002000000000000ull, 0x0000000000000018ull, 0x0000000000000000ull, 0x0030000000000000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE00000000ull, 0x0000000000000000ull, 0x0408000200000000ull },
+  { 0x0002000000000000ull, 0x0000000000000010ull, 0x0000000000000000ull, 0x0020000000000000ull },
+  { 0x0000000000000000ull, 0x07BF7FFE07BF7FFEull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000003000ull, 0x0000000000000000ull, 0x0000000000110000ull, 0x000000C000000000ull },
+  { 0x0000000000000000ull, 0x0000000808000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000003000003000ull, 0x0000300C0C000000ull, 0x00000000000C0000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x07BF7FFE00000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000002000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000008000000000ull },
+  { 0x0000002000002000ull, 0x0000200808000000ull, 0x0000000000080000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x077DFFF6077DFFF6ull, 0x0000000000000000ull, 0x0002000000020000ull },
+  { 0x0000000000000000ull, 0x077DFFF600000000ull, 0x0000000000000000ull, 0x0002000000000000ull },
+  { 0x0000000000000000ull, 0x02BDEFFE02BDEFFEull, 0x0000000000000000ull, 0x060C0303060C0303ull },
+  { 0x000000000C000000ull, 0x0000000000000C00ull, 0x0000000000810040ull, 0x00000000001E6000ull },
+  { 0x0000000000000000ull, 0x0000010008100010ull, 0x0000000000000200ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x02BDEFFE00000000ull, 0x0000000000000000ull, 0x060C030300000000ull },
+  { 0x0000000008000000ull, 0x0000000000000800ull, 0x0000000000000000ull, 0x0000000000144000ull },
+  { 0x0000000000000000ull, 0x0000010008100000ull, 0x0000000000000200ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x027DEFE2027DEFE2ull, 0x0000000000000000ull, 0x0008020A0008020Aull },
+  { 0x0000000000000000ull, 0x027DEFE200000000ull, 0x0000000000000000ull, 0x0008020A00000000ull },
+  { 0x0000000000000000ull, 0x02B4EFBE02B4EFBEull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x02B4EFBE00000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0xFFFFFFFFFFFF0042ull, 0x000000000042FFFFull, 0x0C03C00C0C0C0000ull, 0x0000030003000000ull },
+  { 0xFFFF000000000000ull, 0x000000000042FFFFull, 0x0802800808080000ull, 0x0000020002000000ull },
+  { 0x0000000000000000ull, 0x02FDFFFE02FDFFFEull, 0x0000000000000000ull, 0x0E1C77070E1C7707ull },
+  { 0x0000000000000000ull, 0x0000000000000C00ull, 0x0000000000010442ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x02FDFFFE00000000ull, 0x0000000000000000ull, 0x0E1C770700000000ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0x000FFEE79FFFFFFFull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0x23EFFDFFFFFDDFE0ull, 0x0000000300000000ull },
+  { 0x0292000000000000ull, 0x0000000B18AAFDA6ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, 0x0000000FFFFFFFFFull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE07FFFFFEull, 0x0000000000000000ull, 0x0032048800320488ull },
+  { 0x0000030000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE00000000ull, 0x0000000000000000ull, 0x0032048800000000ull },
+  { 0x0000020000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x06F1FFF606F1FFF6ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000030000000ull, 0x0000000000000C00ull, 0x0000000020118042ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x000400080A180000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x06F1FFF600000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000020000000ull, 0x0000000000000800ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x07FFFD9F00000000ull, 0x4204000000000176ull, 0x4400820001020140ull, 0x0000000000041052ull },
+  { 0x0365DD739CEA87E0ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x06F9FFFE06F9FFFEull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x06F9FFFE00000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x06FDFFFE06FDFFFEull, 0x0000000000000000ull, 0x0408220204082202ull },
+  { 0x0000000000000000ull, 0x0000000000000C00ull, 0x0000000000014040ull, 0x0000000020000000ull },
+  { 0x0000000000000000ull, 0x06FDFFFE00000000ull, 0x0000000000000000ull, 0x0408220200000000ull },
+  { 0x0000000000000000ull, 0x0000000000000800ull, 0x0000000000000000ull, 0x0000000020000000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE07FFFFFEull, 0x0000000000000000ull, 0x1040087010400870ull },
+  { 0x0000000000C00000ull, 0x0000C000000C0000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE00000000ull, 0x0000000000000000ull, 0x1040087000000000ull },
+  { 0x0000000000800000ull, 0x0000800000080000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE07FFFFFEull, 0x0000000000000000ull, 0x0800448008004480ull },
+  { 0x0000000000000000ull, 0x00000000C0000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE00000000ull, 0x0000000000000000ull, 0x0800448000000000ull },
+  { 0x0000000000000000ull, 0x0000000080000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x030D555AD6A087E0ull, 0x0002000080000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0xFFFBEDAFFFFB0002ull, 0x000000000002EDAFull, 0x0000C00C00000000ull, 0x0000030000000000ull },
+  { 0xFFFB000000000000ull, 0x000000000002EDAFull, 0x0000800800000000ull, 0x0000020000000000ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000800000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0000010000000010ull, 0x0000000000000200ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0000010000000000ull, 0x0000000000000200ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE07FFFFFEull, 0x0000000000000000ull, 0x00000A1000000A10ull },
+  { 0x0000000000000000ull, 0x07FFFFFE00000000ull, 0x0000000000000000ull, 0x00000A1000000000ull },
+  { 0x00FFFFFFFFFFFFFFull, 0x000000000000E000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x06FDFEFE06FDFEFEull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x06FDFEFE00000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x00000FFF7FFFFFFFull, 0x0000000000000001ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE07FFFFFEull, 0x0000000000000000ull, 0x1A5EDFD51A5EDFD5ull },
+  { 0x0000000000000000ull, 0x07FFFFFE00000000ull, 0x0000000000000000ull, 0x1A5EDFD500000000ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x00FFFFFFFFFF0000ull },
+  { 0x0000000000000000ull, 0x06B9FBA606B9FBA6ull, 0x0000000000000000ull, 0x0408220204082202ull },
+  { 0x0000000000003000ull, 0x6000000300000C00ull, 0x0000000000000000ull, 0x000000C000000000ull },
+  { 0x00000000C0000000ull, 0x0000000000000000ull, 0x1000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x06B9FBA600000000ull, 0x0000000000000000ull, 0x0408220200000000ull },
+  { 0x0000000000002000ull, 0x4000000200000800ull, 0x0000000000000000ull, 0x0000008000000000ull },
+  { 0x0000000080000000ull, 0x0000000000000000ull, 0x1000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE07FFFFFEull, 0x0000000000000000ull, 0x14586F0714586F07ull },
+  { 0x00000000000000C0ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE00000000ull, 0x0000000000000000ull, 0x14586F0700000000ull },
+  { 0x0000000000000080ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x06FDFBFE06FDFBFEull, 0x0000000000000000ull, 0x0418660604186606ull },
+  { 0x000000000C000000ull, 0x0000000000000000ull, 0x0000000000010040ull, 0x000000000007E000ull },
+  { 0x0000000000000000ull, 0x06FDFBFE00000000ull, 0x0000000000000000ull, 0x0418660600000000ull },
+  { 0x0000000008000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000054000ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0x200DECAEFEF02596ull, 0x000000003000005Full },
+  { 0x27FFFDDC00000000ull, 0x4000000000000176ull, 0x4000821001000040ull, 0x0000000000201600ull },
+  { 0x0000000000000000ull, 0x067DFFFE067DFFFEull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000C00003C03030ull, 0x600C0C0300000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x067DFFFE00000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000800002802020ull, 0x4008080200000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x18C00C0C000C3003ull, 0x60000C0300003060ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x1080080800082002ull, 0x4000080200002040ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x06FBFFFE06FBFFFEull, 0x0000000000000000ull, 0x060C3303060C3303ull },
+  { 0x0000000000000000ull, 0x06FBFFFE00000000ull, 0x0000000000000000ull, 0x060C330300000000ull },
+  { 0x0000000000000000ull, 0x02FDFFFE02FDFFFEull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x02FDFFFE00000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x18C00C0C000C3003ull, 0x60000C0300000060ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x1080080800082002ull, 0x4000080200000040ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x6F1524B4375A7F8Bull, 0x40030043A351FB28ull, 0x840459F20C36DB40ull, 0xA8C5143803506CA3ull },
+  { 0x311180518783A402ull, 0x800802111A2BE040ull, 0x802091C128000800ull, 0x4002420220800418ull },
+  { 0x5000004086042000ull, 0x00C0002014009080ull, 0x0804110000000000ull, 0x0000008000008000ull },
+  { 0x8000000000040000ull, 0x3BFB792004122B7Aull, 0x00AD10011A043120ull, 0x2C01A01320009040ull },
+  { 0x0DC10A102F8604C1ull, 0x0004868000022004ull, 0x800E0F0BE8000000ull, 0xC000001000040A80ull },
+  { 0x0E00000002C00160ull, 0x009B880704ECC58Aull, 0x8800000084003A74ull, 0x03CDBC7803D23F04ull },
+  { 0x4B2098C0A88B7718ull, 0x3028014411010541ull, 0x000295C000401000ull, 0x0004266080006383ull },
+  { 0x0082D01000010200ull, 0x0000046200000440ull, 0x08A0000030108495ull, 0x0000810000040000ull },
+  { 0x8810000008000200ull, 0x0000010000000000ull, 0x0000000000000000ull, 0x6411200548000000ull },
+  { 0x4409210880000140ull, 0x000004521C834081ull, 0x000000000004080Cull, 0x0600000080104808ull },
+  { 0x0000040200200044ull, 0x0000080040120000ull, 0x0000010040000008ull, 0x0001581000000002ull },
+  { 0x07924EA09460A090ull, 0x2258002000D28B80ull, 0x0A00412002400184ull, 0x80000000001B0C40ull },
+  { 0x000200009100001Aull, 0x0000000004000040ull, 0x0000000000040000ull, 0x0000020000001002ull },
+  { 0x0000000000000000ull, 0x00000258B3B10000ull, 0xE258041E7F809B8Aull, 0x9B000102E00410F4ull },
+  { 0x7402001025528452ull, 0x0002000140208827ull, 0x010800000D800006ull, 0x0001000200000000ull },
+  { 0x0010020000000080ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x009E49E260000000ull },
+  { 0x210060402061112Eull, 0xB95C000000200020ull, 0x018020C0D6B88440ull, 0x04C0000000400200ull },
+  { 0x0602806181A0841Dull, 0x1A833204202C0000ull, 0x00A0440000851933ull, 0x2020088103803068ull },
+  { 0x080005A220644003ull, 0x1041A30400010800ull, 0x0004010980100210ull, 0x0208818110020020ull },
+  { 0x0000008084008302ull, 0x0001008400204100ull, 0x4000000000000000ull, 0x0000000000040004ull },
+  { 0x8090040001479500ull, 0xC200FA88010A6883ull, 0x2222183401AA0411ull, 0xD088136099542260ull },
+  { 0x0400843220420282ull, 0x0080400680210200ull, 0x010007A400041300ull, 0x0010000200058000ull },
+  { 0x0000300050000000ull, 0x0100020001100450ull, 0x0000200040040000ull, 0x0000004000006000ull },
+  { 0xCA40800000000000ull, 0x0015104C22029120ull, 0x3201A02012810880ull, 0x044023E500808822ull },
+  { 0x4000A1218008D044ull, 0x0450C100040C0808ull, 0x0010400000C20004ull, 0xD215000000000000ull },
+  { 0x0422BD00A8802B01ull, 0xC00181229003420Dull, 0x00400C0430810012ull, 0x0018902000198000ull },
+  { 0x1380000200028880ull, 0x0000002800021148ull, 0x0021804000000022ull, 0x0000400004040A01ull },
+  { 0x0001000000002020ull, 0x1000000004000000ull, 0x0000000010000004ull, 0x0000000000000000ull },
+  { 0x0002000200000000ull, 0x0000000000000000ull, 0x0000000000000001ull, 0x0000000000000000ull },
+  { 0x4404008F00000000ull, 0x0800047C00001200ull, 0x0020000000000C00ull, 0x000008000834A020ull },
+  { 0x0110000008128000ull, 0x20400413A0800284ull, 0x8A08008282000308ull, 0x2009012E08200600ull },
+  { 0x6804042048800800ull, 0x00904640020AC822ull, 0x0024810008000320ull, 0x0882000201020800ull },
+  { 0x0110820A00010020ull, 0x4000000000400000ull, 0x0000040010010000ull, 0x0010012200020800ull },
+  { 0x0000080100108004ull, 0x0000400011000000ull, 0x0008000000004000ull, 0x0000000000000001ull },
+  { 0x0000000000000000ull, 0x8021A80000001000ull, 0x0300400000004200ull, 0x000020D000000104ull },
+  { 0x0040004000000000ull, 0x0000408040001000ull, 0x0000000080000400ull, 0x0000000000200008ull },
+  { 0x21E2140000000040ull, 0x062402860A001180ull, 0x0240800000000000ull, 0x1002500100810004ull },
+  { 0x0010440018000000ull, 0x0000000000000000ull, 0x08058A0008000A90ull, 0x0000200100002401ull },
+  { 0x1018040000000448ull, 0x00410000D2000000ull, 0x0000000000000008ull, 0x0040004010000000ull },
+  { 0x09AF010095000000ull, 0x0000042002001020ull, 0x5004800000828040ull, 0x0010000008200020ull },
+  { 0x0000000000000000ull, 0x6900000000000000ull, 0x00004000000000D0ull, 0x5110400089460500ull },
+  { 0x1000000180000A02ull, 0x0000000A08000001ull, 0x0000008000000000ull, 0x0048202808000000ull },
+  { 0x0010000000102006ull, 0x0000500000200001ull, 0x0001008080806000ull, 0x0000010000000022ull },
+  { 0x5400000000000000ull, 0x0100812064400000ull, 0x0800000000008022ull, 0x0801825081062803ull },
+  { 0x8008000800006801ull, 0x86C0000000000040ull, 0x0000000020800002ull, 0x02008021C2000800ull },
+  { 0x0000114008120000ull, 0x4200000000520A00ull, 0x0002200200800001ull, 0x0000400000000080ull },
+  { 0x8000000000000000ull, 0x0808000000002000ull, 0x4200001000840200ull, 0x0800000080600400ull },
+  { 0x0000888500000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0000000000000002ull, 0xA1AC84C400000000ull, 0x90302680B328A1D8ull },
+  { 0x0550020101480020ull, 0x0004440404A30000ull, 0x2000801040004400ull, 0x1801000101100022ull },
+  { 0x004800000081302Bull, 0x0000040005101400ull, 0x0004823204400200ull, 0x2140000250405042ull },
+  { 0x0102000000020040ull, 0xC201000000090400ull, 0x0000000000000000ull, 0x0018240800000004ull },
+  { 0x02011400C0043000ull, 0x4404800000000000ull, 0x000A304020040004ull, 0x000200600080A000ull },
+  { 0x004009000000000Cull, 0x0080800800050200ull, 0x00860C0000004200ull, 0x0004020010000000ull },
+  { 0x200001B000002010ull, 0x0000000208800000ull, 0x0000000002000804ull, 0x0000100020000200ull },
+  { 0x0000000200020000ull, 0x0000000000000000ull, 0x0000040000000010ull, 0x0000001000008200ull },
+  { 0x0000000000000000ull, 0x6200080000024000ull, 0x0000000000000002ull, 0x0000400002000880ull },
+  { 0x0000000010000004ull, 0x0040000000000000ull, 0x0000000000002000ull, 0x0200000000000000ull },
+  { 0x0000000400000000ull, 0x0000012A00801001ull, 0x0000280000000800ull, 0x0000001000200026ull },
+  { 0x0000000000000000ull, 0x8000000000000000ull, 0x0000000000000042ull, 0x0000000800040356ull },
+  { 0x0000000000000001ull, 0x0000000000000000ull, 0x0000000000080200ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0000004000000000ull, 0xC585E31600000000ull, 0x4D90A06464A22252ull },
+  { 0x0082010410080D2Aull, 0x0000040200000040ull, 0x0000000000001000ull, 0x0000000000000000ull },
+  { 0x5732A7BEE0000000ull, 0x00A108154C519810ull, 0x0008000800000C22ull, 0x00088000A0021008ull },
+  { 0x0000020400008000ull, 0x0000000000000000ull, 0x0004080000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x2801D34000000000ull, 0x42030300480A0368ull, 0x20810C40FB1341A2ull },
+  { 0x19000005AC15864Full, 0x8020600000882080ull, 0x0802444800080001ull, 0x2000210000024000ull },
+  { 0x0000000000000004ull, 0x0180000000042A00ull, 0x0000000000040200ull, 0x000000000002F480ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0x0802004480080100ull, 0x444020041000000Aull },
+  { 0x0400404202000823ull, 0x8000200010000080ull, 0x0000000000000000ull, 0x0A95650000000000ull },
+  { 0x887C400080110022ull, 0x00E0061400012171ull, 0x4000000010118040ull, 0x40C8850000000270ull },
+  { 0x0304000000402081ull, 0x1000020542440000ull, 0x0000000000020800ull, 0x0008024000000000ull },
+  { 0x0000000000000000ull, 0xEE60000000000000ull, 0x00000000218200D0ull, 0x00000000C3004000ull },
+  { 0x0000000000010000ull, 0x1003600000000000ull, 0x0000010002400040ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x4842100000000000ull, 0x0000011004821000ull, 0x0000000001000000ull },
+  { 0x1000000000000000ull, 0x0000000000100024ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x1000000000000000ull, 0x0000000010000002ull, 0x0000000000000000ull },
+  { 0x8000200A80000000ull, 0x8001001000000020ull, 0x0800004000000000ull, 0x0000000001024010ull },
+  { 0x0800000100080000ull, 0x8000000000010000ull, 0x0000000082000010ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x02BDFFBE02BDFFBEull, 0x0000000000000000ull, 0x0E1C77070E1C7707ull },
+  { 0x00000C00000C0003ull, 0x00000C0000003C00ull, 0x0000000000810040ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x02BDFFBE00000000ull, 0x0000000000000000ull, 0x0E1C770700000000ull },
+  { 0x0000080000080002ull, 0x0000080000002800ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0xFFFFFFFFFFFF0002ull, 0x000000000002FFFFull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0xFFFF000000000000ull, 0x000000000002FFFFull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x037DFFFE037DFFFEull, 0x0000000000000000ull, 0x0402000204020002ull },
+  { 0x0000000000000000ull, 0x0000010000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x037DFFFE00000000ull, 0x0000000000000000ull, 0x0402000200000000ull },
+  { 0x0000000000000000ull, 0x07FDFFFE07FDFFFEull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x07FDFFFE00000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x065DFFF6065DFFF6ull, 0x0000000000000000ull, 0x0012DF050012DF05ull },
+  { 0x0000000000000000ull, 0x065DFFF600000000ull, 0x0000000000000000ull, 0x0012DF0500000000ull },
+  { 0x0000000000000000ull, 0x06BDEFFE06BDEFFEull, 0x0000000000000000ull, 0x0204110102041101ull },
+  { 0x0000000000000000ull, 0x0000000000000C00ull, 0x0000000000008040ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0000000002100000ull, 0x1000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x06BDEFFE00000000ull, 0x0000000000000000ull, 0x0204110100000000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE07FFFFFEull, 0x0000000000000000ull, 0x060C3B03060C3B03ull },
+  { 0x0000000000000000ull, 0x07FFFFFE00000000ull, 0x0000000000000000ull, 0x060C3B0300000000ull },
+  { 0x0000000000000000ull, 0x00B5EBA200B5EBA2ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x00B5EBA200000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x02BBFE2202BBFE22ull, 0x0000000000000000ull, 0x0408020204080202ull },
+  { 0x0000000000000000ull, 0x0000010000000000ull, 0x1000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x02BBFE2200000000ull, 0x0000000000000000ull, 0x0408020200000000ull },
+  { 0x0000000000000000ull, 0x000000004FFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0xFDFF01FFFDFF9728ull, 0x00000000972801FFull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0xFDFF000000000000ull, 0x00000000972801FFull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x03FFFDFFFFFDCFE0ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE07FFFFFEull, 0x0000000000000000ull, 0x1E5E7F171E5E7F17ull },
+  { 0x0000000000000000ull, 0x07FFFFFE00000000ull, 0x0000000000000000ull, 0x1E5E7F1700000000ull },
+  { 0xFFFFFFFFFFFF0002ull, 0x000000000002FFFFull, 0x0000C00000000000ull, 0x0000030000000000ull },
+  { 0xFFFF000000000000ull, 0x000000000002FFFFull, 0x0000800000000000ull, 0x0000020000000000ull },
+  { 0xFFFFFFFF00000000ull, 0x0000000000000007ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0x03C5FDFFFFF98FE0ull, 0x0002000000000000ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x00000007FFFFFFFFull },
+  { 0x0000000000000000ull, 0x07FFFFFE07FFFFFEull, 0x0000000000000000ull, 0x0000400400004004ull },
+  { 0x000000000000000Cull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x000000000F000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE00000000ull, 0x0000000000000000ull, 0x0000400400000000ull },
+  { 0x0000000000000008ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x000000000A000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x029CCB22029CCB22ull, 0x0000000000000000ull, 0x000C3303000C3303ull },
+  { 0x0000000000000000ull, 0x029CCB2200000000ull, 0x0000000000000000ull, 0x000C330300000000ull },
+  { 0x23EDFDFFFFFB9FE0ull, 0x0000000000010000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x05FFFFF605FFFFF6ull, 0x0000000000000000ull, 0x0204110102041101ull },
+  { 0x000000C300000C00ull, 0x1800000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x05FFFFF600000000ull, 0x0000000000000000ull, 0x0204110100000000ull },
+  { 0x0000008200000800ull, 0x1000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x06FDFFFE06FDFFFEull, 0x0000000000000000ull, 0x0020080800200808ull },
+  { 0x0000030000000000ull, 0x0000000000000C00ull, 0x0000000000004402ull, 0x0000000020000000ull },
+  { 0x0000000000000000ull, 0x3000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x06FDFFFE00000000ull, 0x0000000000000000ull, 0x0020080800000000ull },
+  { 0x0000020000000000ull, 0x0000000000000800ull, 0x0000000000000000ull, 0x0000000020000000ull },
+  { 0x0000000000000000ull, 0x2000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x02FDFB6A02FDFB6Aull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x00000000000C0000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x02FDFB6A00000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000080000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x800006FBFFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x07BFEBFE07BFEBFEull, 0x0000000000000000ull, 0x0810400408104004ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x000000000000000Full },
+  { 0x0000000000000000ull, 0x07BFEBFE00000000ull, 0x0000000000000000ull, 0x0810400400000000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE07FFFFFEull, 0x0000000000000000ull, 0x011C0261011C0261ull },
+  { 0x0000000000000000ull, 0x07FFFFFE00000000ull, 0x0000000000000000ull, 0x011C026100000000ull },
+  { 0x0000000000000000ull, 0x07FBFFFE07FBFFFEull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x07FBFFFE00000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE07FFFFFEull, 0x0000000000000000ull, 0x1040003010400030ull },
+  { 0x0000000000000000ull, 0x07FFFFFE00000000ull, 0x0000000000000000ull, 0x1040003000000000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE07FFFFFEull, 0x0000000000000000ull, 0x1448AA121448AA12ull },
+  { 0x0000000000000000ull, 0x07FFFFFE00000000ull, 0x0000000000000000ull, 0x1448AA1200000000ull },
+  { 0x0000000000000000ull, 0x02FDFFFE02FDFFFEull, 0x0000000000000000ull, 0x0C58E6160C58E616ull },
+  { 0x00000C000C0C0003ull, 0x00000C0000303C18ull, 0x0000000000014042ull, 0x00000000201FE000ull },
+  { 0x0000000000000000ull, 0x02FDFFFE00000000ull, 0x0000000000000000ull, 0x0C58E61600000000ull },
+  { 0x0000080008080002ull, 0x0000080000202810ull, 0x0000000000000000ull, 0x0000000020154000ull },
+  { 0x0000000000000000ull, 0x06F9FFFE06F9FFFEull, 0x0000000000000000ull, 0x8E1C37070E1C3707ull },
+  { 0x000000000C000000ull, 0x0100000000000C18ull, 0x0000000000010040ull, 0x00000000001E6000ull },
+  { 0x0000000000000000ull, 0x0000000008100010ull, 0x1000000000000200ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x06F9FFFE00000000ull, 0x0000000000000000ull, 0x8E1C370700000000ull },
+  { 0x0000000008000000ull, 0x0000000000000810ull, 0x0000000000000000ull, 0x0000000000144000ull },
+  { 0x0000000000000000ull, 0x0000000008100000ull, 0x1000000000000200ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x003000FFFFFFFC00ull },
+  { 0x0000000000000000ull, 0x03BDFFF603BDFFF6ull, 0x0000000000000000ull, 0x0010040000100400ull },
+  { 0x0000000000000000ull, 0x0000000300000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x03BDFFF600000000ull, 0x0000000000000000ull, 0x0010040000000000ull },
+  { 0x0000000000000000ull, 0x0000000200000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE07FFFFFEull, 0x0000000000000000ull, 0x0040881000408810ull },
+  { 0x0000000000000000ull, 0x0000000000000C00ull, 0x0000000000110040ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0000000808100000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE00000000ull, 0x0000000000000000ull, 0x0040881000000000ull },
+  { 0x0000000000000000ull, 0x0798FFBE0798FFBEull, 0x0000000000000000ull, 0x0008220200082202ull },
+  { 0x0000C00003000030ull, 0x0000000000000006ull, 0x0000000000000000ull, 0x00000C0000000000ull },
+  { 0x0000000000000000ull, 0x0798FFBE00000000ull, 0x0000000000000000ull, 0x0008220200000000ull },
+  { 0x0000800002000020ull, 0x0000000000000004ull, 0x0000000000000000ull, 0x0000080000000000ull },
+  { 0x0000000000000000ull, 0x0030000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0020000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE07FFFFFEull, 0x0000000000000000ull, 0x140CA383140CA383ull },
+  { 0x0000000000000000ull, 0x07FFFFFE00000000ull, 0x0000000000000000ull, 0x140CA38300000000ull },
+  { 0x03EDFDFFFFF98FE0ull, 0x0002000080000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0xFFFFFFFFFFFF0002ull, 0x000000000002FFFFull, 0x0000000000000000ull, 0x0000000000300000ull },
+  { 0xFFFF000000000000ull, 0x000000000002FFFFull, 0x0000000000000000ull, 0x0000000000200000ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0xFFFF000000000000ull, 0x0FFFFFFFFF0FFFFFull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0FFFFFFFFF000000ull },
+  { 0x0325FDFFFFF987E0ull, 0x001C000010000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE07FFFFFEull, 0x0000000000000000ull, 0x1206010012060100ull },
+  { 0x0000000000000000ull, 0x07FFFFFE00000000ull, 0x0000000000000000ull, 0x1206010000000000ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0x0300000000000000ull, 0x0000000000003000ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0x0200000000000000ull, 0x0000000000002000ull },
+  { 0x0000000000000000ull, 0x02FDFFF602FDFFF6ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x02FDFFF600000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x06BDFFFE06BDFFFEull, 0x0000000000000000ull, 0x0008000000080000ull },
+  { 0x00000000030000F0ull, 0x1E0000000C00001Eull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x06BDFFFE00000000ull, 0x0000000000000000ull, 0x0008000000000000ull },
+  { 0x00000000020000A0ull, 0x1400000008000014ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x00C00C0C000C0003ull, 0x60000C0300C03060ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x000000000C000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000030000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0080080800080002ull, 0x4000080200802040ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000008000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000020000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x07FFFFDE00000000ull, 0x50000000000005F6ull, 0x10008A0005480262ull, 0x0000000000013000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE07FFFFFEull, 0x0000000000000000ull, 0x043C268F043C268Full },
+  { 0x0000000000000000ull, 0x07FFFFFE00000000ull, 0x0000000000000000ull, 0x043C268F00000000ull },
+  { 0x0000000000000000ull, 0x02BB7B0A02BB7B0Aull, 0x0000000000000000ull, 0x0002000000020000ull },
+  { 0x0000000000000000ull, 0x02BB7B0A00000000ull, 0x0000000000000000ull, 0x0002000000000000ull },
+  { 0x0000000000000000ull, 0x07FFFF2E07FFFF2Eull, 0x0000000000000000ull, 0x0000001000000010ull },
+  { 0x0000000000000000ull, 0x07FFFF2E00000000ull, 0x0000000000000000ull, 0x0000001000000000ull },
+  { 0x03E5FDFFFFE00020ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0xFFFF000000000000ull, 0x00000000800FFFFFull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000FEFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x23EDFDFFFFF99FE0ull, 0x0000000300010000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0xFF1B38AFFF1B0000ull, 0x00000000000038AFull, 0x0C00C03000300000ull, 0x0000030000000000ull },
+  { 0xFF1B000000000000ull, 0x00000000000038AFull, 0x0800802000200000ull, 0x0000020000000000ull },
+  { 0x7FFF3FFFFFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x02FDFFBE02FDFFBEull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x02FDFFBE00000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0325D55AD4A88360ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x3FFFFFFFFC000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0xFFFFFFFFFFFC0000ull, 0x000000000000001Full },
+  { 0x0000000000000000ull, 0x02F9FFFE02F9FFFEull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x02F9FFFE00000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x047DF7FE047DF7FEull, 0x0000000000000000ull, 0x0204110102041101ull },
+  { 0x0000000000000000ull, 0x047DF7FE00000000ull, 0x0000000000000000ull, 0x0204110100000000ull },
+  { 0x0000000000000000ull, 0x047FF7FE047FF7FEull, 0x0000000000000000ull, 0x0A1455050A145505ull },
+  { 0x0000000000003000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x047FF7FE00000000ull, 0x0000000000000000ull, 0x0A14550500000000ull },
+  { 0x0000000000002000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x07FFFD8600000000ull, 0xEC000000000005F6ull, 0x480A86400200B4D9ull, 0x0000000000000000ull },
+  { 0x061EF5C000000000ull, 0x4000000000000176ull, 0x4020821001200040ull, 0x0000000000205440ull },
+  { 0x0000000000000000ull, 0x047DFFFE047DFFFEull, 0x0000000000000000ull, 0x0000000200000002ull },
+  { 0x0000000000033000ull, 0x600000C300000C00ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x047DFFFE00000000ull, 0x0000000000000000ull, 0x0000000200000000ull },
+  { 0x0000000000022000ull, 0x4000008200000800ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x06FDFFF606FDFFF6ull, 0x0000000000000000ull, 0x1A50CC141A50CC14ull },
+  { 0x0000000000000000ull, 0x06FDFFF600000000ull, 0x0000000000000000ull, 0x1A50CC1400000000ull },
+  { 0x0000000000000000ull, 0x07BE7FFE07BE7FFEull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000110000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0000000808000000ull, 0x0080000000000000ull, 0x0000000000000000ull },
+  { 0x0000003000003000ull, 0x0000300C0C000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x07BE7FFE00000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000002000002000ull, 0x0000200808000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0x2FFBFFBFFC7E3FE0ull, 0x000000000000007Full },
+  { 0x0000000000000000ull, 0x07FFFFFE07FFFFFEull, 0x0000000000000000ull, 0x2418221224182212ull },
+  { 0x660000000000F000ull, 0x6000003300300180ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE00000000ull, 0x0000000000000000ull, 0x2418221200000000ull },
+  { 0x440000000000A000ull, 0x4000002200200100ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000003000ull, 0x6000000300000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000002000ull, 0x4000000200000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x027DFFF6027DFFF6ull, 0x0000000000000000ull, 0x0040003000400030ull },
+  { 0x0000000000000000ull, 0x027DFFF600000000ull, 0x0000000000000000ull, 0x0040003000000000ull },
+  { 0x0000000000000000ull, 0x007DFFF6007DFFF6ull, 0x0000000000000000ull, 0x0000003200000032ull },
+  { 0x0000000000000000ull, 0x0000000000000018ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x007DFFF600000000ull, 0x0000000000000000ull, 0x0000003200000000ull },
+  { 0x0000000000000000ull, 0x0000000000000010ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x067DFFFE067DFFFEull, 0x0000000000000000ull, 0x0000001600000016ull },
+  { 0x0000000000033000ull, 0x6000000300000C00ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x067DFFFE00000000ull, 0x0000000000000000ull, 0x0000001600000000ull },
+  { 0x0000000000022000ull, 0x4000000200000800ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x047DFFFE047DFFFEull, 0x0000000000000000ull, 0x0020003400200034ull },
+  { 0x0000000000033000ull, 0x6000000300000C00ull, 0x0080000000000000ull, 0x0000C3F000000000ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000040000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x047DFFFE00000000ull, 0x0000000000000000ull, 0x0020003400000000ull },
+  { 0x0000000000022000ull, 0x4000000200000800ull, 0x0000000000000000ull, 0x000082A000000000ull },
+  { 0x0000000000000000ull, 0x039E7DDC039E7DDCull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x039E7DDC00000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x077FFFFE077FFFFEull, 0x0000000000000000ull, 0x0000088000000880ull },
+  { 0x0000000000000000ull, 0x077FFFFE00000000ull, 0x0000000000000000ull, 0x0000088000000000ull },
+  { 0xFDFF01FFFDFF8F04ull, 0x000000008F0401FFull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0xFDFF000000000000ull, 0x000000008F0401FFull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x02BFFFF602BFFFF6ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x02BFFFF600000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE07FFFFFEull, 0x0000000000000000ull, 0x0040023100400231ull },
+  { 0x0000000000000000ull, 0x07FFFFFE00000000ull, 0x0000000000000000ull, 0x0040023100000000ull },
+  { 0x00001F6FAFAD0000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x06BDFFFE06BDFFFEull, 0x0000000000000000ull, 0x0030000800300008ull },
+  { 0x00000000000000C0ull, 0x1E0000000C00F01Eull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x06BDFFFE00000000ull, 0x0000000000000000ull, 0x0030000800000000ull },
+  { 0x0000000000000080ull, 0x140000000800A014ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0x03BFC718D63DC7E8ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x000DDFFF00000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x03EFFDFFFFFDDFE0ull, 0x0000000300000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x03FDFFBE03FDFFBEull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x03FDFFBE00000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0xFFFFE5BFFFFF0002ull, 0x000000000002E5BFull, 0x00CC00000C0C0000ull, 0x0000C00C00000000ull },
+  { 0xFFFF000000000000ull, 0x000000000002E5BFull, 0x0088000008080000ull, 0x0000800800000000ull },
+  { 0x000DFFFFFFFFFFFEull, 0x000000000000007Full, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0xFFFFFFFFFFFFFF7Full, 0xFFFFFFFF3D7F3D7Full, 0x7F3D7FFFFFFF3D7Full, 0x00FF7FFFFF7F7F3Dull },
+  { 0xFFFFFFFF003D7FFFull, 0x0000000000FFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFF3D7F3DFFull, 0x7F3DFFFFFFFF3DFFull, 0xFFFFFFFFFF7FFF3Dull },
+  { 0xFFFFFFFFFF3DFFFFull, 0x0000000007FFFFFFull, 0x000000000000FFFFull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0x7F7F7F7F007FFFFFull, 0x000000007F7F7F7Full },
+  { 0x0000000000000000ull, 0x06BDFFF606BDFFF6ull, 0x0000000000000000ull, 0x3040009030400090ull },
+  { 0x0000000000000000ull, 0x60000000C0000180ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x06BDFFF600000000ull, 0x0000000000000000ull, 0x3040009000000000ull },
+  { 0x0000000000000000ull, 0x4000000080000100ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x00000000001FDFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x02BDFFF602BDFFF6ull, 0x0000000000000000ull, 0x0010040000100400ull },
+  { 0x0000000000000000ull, 0x02BDFFF600000000ull, 0x0000000000000000ull, 0x0010040000000000ull },
+  { 0x0000000000000000ull, 0x0079FBE20079FBE2ull, 0x0000000000000000ull, 0x0408220204082202ull },
+  { 0x0000000000000000ull, 0x0079FBE200000000ull, 0x0000000000000000ull, 0x0408220200000000ull },
+  { 0x0000000000000000ull, 0x077FFFFE077FFFFEull, 0x0000000000000000ull, 0xA00A2002200A2002ull },
+  { 0x0000000000000000ull, 0x0100000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0300000000000000ull },
+  { 0x0000000000000000ull, 0x077FFFFE00000000ull, 0x0000000000000000ull, 0xA00A200200000000ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0200000000000000ull },
+  { 0x0000000000000000ull, 0x00B9FE2200B9FE22ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x00B9FE2200000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE07FFFFFEull, 0x0000000000000000ull, 0x040A2202040A2202ull },
+  { 0x0000000000000000ull, 0x07FFFFFE00000000ull, 0x0000000000000000ull, 0x040A220200000000ull },
+  { 0x0000000000000000ull, 0x02BDFFF602BDFFF6ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x02BDFFF600000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x067DFFFE067DFFFEull, 0x0000000000000000ull, 0x1040008010400080ull },
+  { 0x00030000C0000000ull, 0x00000000C0000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x067DFFFE00000000ull, 0x0000000000000000ull, 0x1040008000000000ull },
+  { 0xFFFFFFFFFFFF0002ull, 0x000000000002FFFFull, 0x0C00C00C00C00000ull, 0x0000030003000000ull },
+  { 0xFFFF000000000000ull, 0x000000000002FFFFull, 0x0800800800800000ull, 0x0000020002000000ull },
+  { 0xFFFFFFFFFFFF0002ull, 0x000000000002FFFFull, 0x0000C00C00000000ull, 0x0000030000000000ull },
+  { 0xFFFF000000000000ull, 0x000000000002FFFFull, 0x0000800800000000ull, 0x0000020000000000ull },
+  { 0x041ED5C000000000ull, 0x40000000000007FEull, 0x4000A00001000040ull, 0x00000000002109C0ull },
+  { 0xFFFFD3FFFFFF00D0ull, 0x0000000000D0D3FFull, 0x0000000000030000ull, 0x0000000000000000ull },
+  { 0xFFFF000000000000ull, 0x0000000000D0D3FFull, 0x0000000000020000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x02BDFEBE02BDFEBEull, 0x0000000000000000ull, 0x0040000000400000ull },
+  { 0x0000000000000000ull, 0x0000000000000C00ull, 0x0000000020000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x02BDFEBE00000000ull, 0x0000000000000000ull, 0x0040000000000000ull },
+  { 0x07FFFD8200000000ull, 0x4200000000000176ull, 0x4000820001020140ull, 0x0000000000041002ull },
+  { 0xFFFFE5BFFFFF4002ull, 0x000000004002E5BFull, 0x000C00000C0C0000ull, 0x0000000000000000ull },
+  { 0xFFFF000000000000ull, 0x000000004002E5BFull, 0x0008000008080000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x077FFFFE077FFFFEull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0x1800000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x077FFFFE00000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x00000C0000071FFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x07FDFBF607FDFBF6ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x30000000000C0000ull, 0x0003000000000C30ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x07FDFBF600000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x2000000000080000ull, 0x0002000000000820ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x057DF7FE057DF7FEull, 0x0000000000000000ull, 0x020C1301020C1301ull },
+  { 0x0000000000000000ull, 0x057DF7FE00000000ull, 0x0000000000000000ull, 0x020C130100000000ull },
+  { 0x0000000000000000ull, 0x037FFBBE037FFBBEull, 0x0000000000000000ull, 0x0010040400100404ull },
+  { 0x000000000003000Cull, 0x0000000000000000ull, 0x0001800300000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x037FFBBE00000000ull, 0x0000000000000000ull, 0x0010040400000000ull },
+  { 0x0000000000020008ull, 0x0000000000000000ull, 0x0001000200000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x07FDFF6A07FDFF6Aull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x07FDFF6A00000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x077DFFFE077DFFFEull, 0x0000000000000000ull, 0x1040001010400010ull },
+  { 0x0000000000000000ull, 0x077DFFFE00000000ull, 0x0000000000000000ull, 0x1040001000000000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE07FFFFFEull, 0x0000000000000000ull, 0x9A10CFE51A10CFE5ull },
+  { 0x0000000000000000ull, 0x07FFFFFE00000000ull, 0x0000000000000000ull, 0x9A10CFE500000000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE07FFFFFEull, 0x0000000000000000ull, 0x1468221A1468221Aull },
+  { 0x0000000000003000ull, 0x0000030300000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x07FFFFFE00000000ull, 0x0000000000000000ull, 0x1468221A00000000ull },
+  { 0x0000000000002000ull, 0x0000020200000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x02B57E9202B57E92ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x02B57E9200000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x03BFFEFE03BFFEFEull, 0x0000000000000000ull, 0x000A0A01000A0A01ull },
+  { 0x0000000000000000ull, 0x03BFFEFE00000000ull, 0x0000000000000000ull, 0x000A0A0100000000ull },
+  { 0x0000000000000000ull, 0x0020001800200018ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x236DFDFFFFFBA7E0ull, 0x0000000000010000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0020001800000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x02F9FBFE02F9FBFEull, 0x0000000000000000ull, 0x0E1C73070E1C7307ull },
+  { 0x00000C0000000003ull, 0x00000C0000003C00ull, 0x0000000000010040ull, 0x00000000001E6000ull },
+  { 0x0000000000000000ull, 0x02F9FBFE00000000ull, 0x0000000000000000ull, 0x0E1C730700000000ull },
+  { 0x0000080000000002ull, 0x0000080000002800ull, 0x0000000000000000ull, 0x0000000000144000ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x000407FFFFFF0000ull },
+  { 0x0000000000000000ull, 0x02BDFFF602BDFFF6ull, 0x0000000000000000ull, 0x060C3303060C3303ull },
+  { 0x0000000000000000ull, 0x0000000000000018ull, 0x0000000000000000ull, 0x0300000000000000ull },
+  { 0xC000000000000000ull, 0x0000000C00000000ull, 0x0300000000000000ull, 0x0000000000003000ull },
+  { 0x0000000000000000ull, 0x02BDFFF600000000ull, 0x0000000000000000ull, 0x060C330300000000ull },
+  { 0x0000000000000000ull, 0x0000000000000010ull, 0x0000000000000000ull, 0x0200000000000000ull },
+  { 0x8000000000000000ull, 0x0000000800000000ull, 0x0200000000000000ull, 0x0000000000002000ull },
+  { 0x0000000000000000ull, 0x03BD6AB603BD6AB6ull, 0x0000000000000000ull, 0x0000000800000008ull },
+  { 0x0000000000000000ull, 0x03BD6AB600000000ull, 0x0000000000000000ull, 0x0000000800000000ull },
+  { 0x0B04204083523F0Bull, 0x40000000A340C928ull, 0x0400597248365944ull, 0x2845003803502C83ull },
+  { 0x3111800002032402ull, 0x800802011A30E340ull, 0x8020800028000840ull, 0x400240032080041Cull },
+  { 0x1000080086062800ull, 0x00F0002014008280ull, 0x488C000C02020000ull, 0x0200008000028020ull },
+  { 0x0000040001040011ull, 0x11E27BA000142BBAull, 0x0081100100042400ull, 0x2403000220001040ull },
+  { 0x0CC10630208004C1ull, 0x0024860008003080ull, 0x00000E0188002288ull, 0x8120001462240282ull },
+  { 0x0200000000C00120ull, 0x088B8002149C058Bull, 0x0804200085000010ull, 0x010DBC7800D02D08ull },
+  { 0x432808C1E8077718ull, 0x3028010400000445ull, 0x000214C000401000ull, 0x0004266200004383ull },
+  { 0x0182D00000110200ull, 0x0000046280008440ull, 0x0020500030100495ull, 0x0000810004004000ull },
+  { 0x8810000008800240ull, 0x0010010000000000ull, 0x0010000000000080ull, 0x0401000148000200ull },
+  { 0x40012100914C2900ull, 0x0000045200014081ull, 0x000000000000080Cull, 0x0680000080104008ull },
+  { 0x0012040200000064ull, 0x0020080040900400ull, 0x0000410040000008ull, 0x2000980441080082ull },
+  { 0x41824EA514608000ull, 0x225844800092C380ull, 0x0A08412022000004ull, 0x80000000001B0C40ull },
+  { 0x000000000900000Aull, 0x0000004004000042ull, 0x2000000000040000ull, 0x0000020000001000ull },
+  { 0x0000000000000000ull, 0x01000A18A1910000ull, 0x8248401C1F809BA8ull, 0x00605BC4C0041074ull },
+  { 0x540200100442ED92ull, 0x0002101100208863ull, 0x0100020200000000ull, 0x2041000000000000ull },
+  { 0x0010000002000080ull, 0x0000000000010000ull, 0x0400000000000000ull, 0x009E49E260000000ull },
+  { 0x214828202860100Cull, 0x7B1C080800200020ull, 0x018028C014A08480ull, 0x04C8000D00400200ull },
+  { 0x00A2004081A08010ull, 0x1203322460005500ull, 0x02A0420040871923ull, 0x2020080103803028ull },
+  { 0x000005A220644000ull, 0x0001A32400010040ull, 0x0044010180100220ull, 0x020A000310020020ull },
+  { 0x000000008C008302ull, 0x4041408C01200900ull, 0x4044000000030004ull, 0x10C0000000000204ull },
+  { 0x8055040000471501ull, 0xC200A02801086883ull, 0x2222180001A80411ull, 0xD00810001854AA40ull },
+  { 0x0400840000420282ull, 0x0084010000210000ull, 0x000005A608041308ull, 0x001040020C058000ull },
+  { 0x0040300050402000ull, 0x0100020001000000ull, 0xC000202840050000ull, 0x4410104104106C82ull },
+  { 0xCA40800020000000ull, 0x0130104C2382A120ull, 0x3281800002810080ull, 0x0400226400808822ull },
+  { 0x0000A1218008D0C4ull, 0x0450C10004040204ull, 0x0010080000C20000ull, 0xD115000000000240ull },
+  { 0x00223D00A8802B09ull, 0xC003800090034200ull, 0x0040000030810000ull, 0x0018902000198000ull },
+  { 0x1300000200000000ull, 0x0000000000021108ull, 0x0021810020000022ull, 0x0000400004040A10ull },
+  { 0x0001000000002020ull, 0x0020200004080400ull, 0x0000400010000004ull, 0x0000000000002800ull },
+  { 0x0200000A42080004ull, 0x0000080080000800ull, 0x0000000400100001ull, 0x0000000000000000ull },
+  { 0x6404000A00000410ull, 0x0984007E00011200ull, 0x1420000001000400ull, 0x000008000814A021ull },
+  { 0x0110000800028000ull, 0x24400403A0800004ull, 0x8A08000002440308ull, 0x0009012600200602ull },
+  { 0x6804060048800800ull, 0x0080464000000002ull, 0x1024800000000380ull, 0x0482010204020000ull },
+  { 0x0100900208000020ull, 0x0000800000400000ull, 0x00000C0020410000ull, 0xC010000000020830ull },
+  { 0x0104080500108004ull, 0x0000400009100000ull, 0x0008001000000000ull, 0x0002081080000009ull },
+  { 0x0000000000008000ull, 0x2001080800001000ull, 0x0500400000004000ull, 0x0000001000008100ull },
+  { 0x0040004200000000ull, 0x0000028042000000ull, 0x0002000080000400ull, 0x0000000080040108ull },
+  { 0x6560340008010040ull, 0x220402810A0011C0ull, 0x0000808000000000ull, 0x1000000100810005ull },
+  { 0x0050000018000000ull, 0x0904010000004030ull, 0x08040A0000000A90ull, 0x4000202100002400ull },
+  { 0x0010040000000248ull, 0x00010410D2000000ull, 0x0001000000000000ull, 0x0040004010000000ull },
+  { 0x018F010495000000ull, 0x00410C2402001000ull, 0x1000000000028040ull, 0x0010000008200020ull },
+  { 0x0000000000000800ull, 0x7900000200000004ull, 0x00004000000000D0ull, 0x5114409A98000408ull },
+  { 0x5000000180000A02ull, 0x0000000A08000000ull, 0x0000208000000000ull, 0x0008202808000000ull },
+  { 0x0014000000102004ull, 0x0000100000000000ull, 0x1401028080804000ull, 0x0000810000000002ull },
+  { 0x4400000002004000ull, 0x800001206C600000ull, 0x000044000000E002ull, 0x0800005081060803ull },
+  { 0x8002400000002820ull, 0x8640020000003040ull, 0x0040420000800002ull, 0x0240802182000800ull },
+  { 0x0000114008020000ull, 0x0000000000500A40ull, 0x0002200200800000ull, 0x0000000000000291ull },
+  { 0xA000080200000000ull, 0x0008001000003008ull, 0x4020000000800200ull, 0x4800000080200400ull },
+  { 0x020188050E112031ull, 0x0006004200210014ull, 0x0006200110080000ull, 0x0010930804040400ull },
+  { 0x6002400808000000ull, 0x1008040040100042ull, 0x0000000000001000ull, 0x0000000000000000ull },
+  { 0x0500000000000000ull, 0x00A5440000200000ull, 0x2000021040004420ull, 0x1A01000000140002ull },
+  { 0x004800000081302Bull, 0x2085800044400400ull, 0x0004822204000200ull, 0x2100000240405000ull },
+  { 0x0000080000000040ull, 0x8009004000180000ull, 0x2000000000000000ull, 0x0418252801000200ull },
+  { 0x02001400C0043780ull, 0x4004804000000000ull, 0x000A100020000000ull, 0x0002006000000000ull },
+  { 0x0044080000000020ull, 0x1080000000040200ull, 0x0000080000004600ull, 0x0004820010000000ull },
+  { 0x2000100000000410ull, 0x0000000208800200ull, 0x1004000002000004ull, 0x0000400000000800ull },
+  { 0x0000000A00200000ull, 0x0000200000000000ull, 0x0000064000000010ull, 0x000000302000A200ull },
+  { 0x00002000000000C0ull, 0x0000008088204000ull, 0x0000000000000000ull, 0x0000000002000880ull },
+  { 0x0000000010000004ull, 0x0040000000000000ull, 0x0000000400002000ull, 0x0204000000000000ull },
+  { 0x0800000000002000ull, 0x0000010A28881001ull, 0x0000080000000800ull, 0x2000000230200006ull },
+  { 0x0004000000000080ull, 0x8000000000000000ull, 0x2400040000408842ull, 0x0100000800040001ull },
+  { 0x1812242001884505ull, 0x000E024440200000ull, 0x9005041140283080ull, 0x4500000000440880ull },
+  { 0x0000000028000005ull, 0x2081804011000200ull, 0x0000000004080401ull, 0x0000000000000000ull },
+  { 0x0080000000000000ull, 0x0000140200010140ull, 0x18901D0760081000ull, 0x3410245C50080181ull },
+  { 0x0000000000008500ull, 0x0081081000000000ull, 0x0008010802200420ull, 0x00088002A0025000ull },
+  { 0x0000000400008000ull, 0x0000001080000000ull, 0x0004080000002000ull, 0x0000000080043400ull },
+  { 0x0100860028300208ull, 0x0000000080000200ull, 0x0007A14008000000ull, 0x20910C4000124020ull },
+  { 0x1106000DAE11804Bull, 0x8584620112386C80ull, 0x0002044800008413ull, 0x2020210000004000ull },
+  { 0x0001200000000204ull, 0x0180000000042200ull, 0x0000080010040200ull, 0x000000082002F880ull },
+  { 0x0010000000000000ull, 0x0000000400000000ull, 0x0088000001400021ull, 0x1000000000040000ull },
+  { 0x0000884400000010ull, 0x4020000000000800ull, 0x0000400000400400ull, 0x0000000200000000ull },
+  { 0x0020000001000000ull, 0x0000000000020000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0080000000000000ull, 0x00020008000C8A09ull, 0x0000000210012440ull },
+  { 0x8804000000000000ull, 0x21E9041C00012011ull, 0x0802050018104440ull, 0x08C4050C52400270ull },
+  { 0x0304008000002081ull, 0x1000020550440104ull, 0x0000000000000800ull, 0x8808000000080808ull },
+  { 0x08002000418B0166ull, 0x000080804100B040ull, 0x0000010000000000ull, 0x6004800088000010ull },
+  { 0x0000010001010420ull, 0x0000000000000000ull, 0x0000100002400000ull, 0x0000000008210000ull },
+  { 0x0080000002004000ull, 0x0000000004800020ull, 0x0000010000000000ull, 0x0000400001100000ull },
+  { 0x100200A000000040ull, 0x0000800004100026ull, 0x0000400000000000ull, 0x0000000000000000ull },
+  { 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0018002000000000ull },
+  { 0x0800000000000000ull, 0x0000000020000000ull, 0x0000000000000000ull, 0x0200000000000000ull },
+  { 0x0000000000000000ull, 0x8000000000000000ull, 0x1820002000800000ull, 0x0000010041024008ull },
+  { 0x0800000100080000ull, 0x0000000200040C00ull, 0x0000000010002000ull, 0x0000000000000000ull },
+  { 0x0000FFFFFFFFFFFFull, 0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull },
+};
+
+static const uint16_t WA_ALPHABET_BLOCK_INDEX[] = {
+  1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+  17, 18, 19, 20, 0, 19, 21, 22, 21, 22, 23, 24, 25, 25, 26, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 28, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 30, 30, 31, 32,
+  33, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 34, 35,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 36, 37, 38,
+  39, 40, 41, 42, 43, 44, 45, 43, 46, 47, 48, 48, 49, 50, 51, 51,
+  52, 53, 54, 55, 56, 54, 57, 57, 58, 59, 58, 59, 60, 61, 62, 63,
+  64, 65, 66, 67, 68, 69, 70, 70, 71, 71, 72, 72, 73, 73, 74, 75,
+  76, 77, 78, 76, 79, 79, 80, 80, 81, 81, 82, 83, 84, 84, 85, 86,
+  87, 88, 89, 90, 91, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  92, 93, 94, 91, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 95,
+  96, 96, 97, 97, 98, 99, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 100,
+  98, 99, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 100, 101, 102, 103, 0,
+  104, 105, 0, 104, 106, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116,
+  0, 115, 117, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 118, 119, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 118, 120, 0, 121, 122, 0, 121, 123, 123, 124, 125, 126, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 127, 128, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 129, 130, 131, 132, 133, 134, 135, 134, 135, 136, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 137, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 138, 139, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 137, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 140,
+  141, 142, 143, 144, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  145, 146, 147, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 148,
+  149, 150, 31, 32, 151, 152, 153, 154, 155, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 156, 157, 158, 155, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 166, 169, 169,
+  170, 171, 172, 78, 173, 173, 111, 174, 112, 175, 176, 177, 178, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 156, 179, 180, 178, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 159, 181, 182, 111, 112, 183, 184, 185, 186,
+  187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 197, 200, 200,
+  201, 202, 203, 204, 205, 206, 207, 205, 208, 190, 209, 192, 210, 211, 212, 213,
+  214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 19, 228,
+  78, 19, 229, 230, 231, 232, 231, 232, 233, 234, 235, 174, 121, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 236, 237, 175, 121, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 238, 239, 240, 241, 241, 31, 32, 242, 243,
+  244, 245, 246, 247, 248, 246, 249, 250, 251, 252, 253, 251, 254, 254, 255, 255,
+  256, 256, 257, 86, 258, 88, 160, 259, 162, 260, 261, 262, 263, 264, 265, 266,
+  267, 268, 111, 112, 111, 112, 269, 270, 226, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 271, 228, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 272, 273, 273, 273, 273, 274, 273, 273, 273, 273, 274,
+  111, 112, 275, 276, 277, 278, 279, 280, 281, 279, 280, 281, 282, 283, 284, 285,
+  286, 286, 287, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303,
+  304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319,
+  320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335,
+  336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 350, 351,
+  352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367,
+  368, 369, 287, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303,
+  304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319,
+  320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335,
+  336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 350, 351,
+  352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367,
+  368, 369, 370, 370, 371, 372, 373, 374, 375, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 376, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 377, 378, 379,
+  380, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 381, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 382, 383, 384, 385, 385, 386, 387, 388, 389, 390, 391,
+  392, 393, 394, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 395, 396,
+  397, 394, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 398, 66, 174,
+  67, 175, 111, 112, 399, 400, 401, 402, 403, 404, 405, 406, 407, 174, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 408, 175, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 238, 153, 154, 155, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 156, 157, 158, 155, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 159, 409, 174, 410, 175, 411, 412, 413, 414,
+  166, 415, 78, 166, 149, 150, 416, 416, 417, 417, 418, 418, 273, 273, 273, 273,
+  273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273,
+  273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273,
+  273, 273, 273, 273, 273, 273, 273, 419, 273, 273, 273, 273, 273, 273, 273, 273,
+  273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273,
+  273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273,
+  273, 273, 273, 419, 255, 255, 420, 421, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 156, 422, 423, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 159, 424, 425, 426, 427, 428, 426, 429, 429, 430, 430, 431, 432,
+  433, 434, 19, 435, 436, 19, 437, 438, 439, 440, 441, 442, 443, 444, 111, 112,
+  445, 445, 446, 447, 111, 112, 269, 448, 449, 270, 0, 450, 451, 452, 453, 453,
+  454, 171, 455, 78, 456, 456, 457, 458, 459, 459, 460, 461, 462, 463, 464, 465,
+  466, 467, 468, 469, 111, 112, 470, 471, 19, 472, 473, 19, 474, 474, 475, 475,
+  476, 477, 478, 479, 476, 480, 478, 481, 482, 18, 19, 483, 0, 19, 484, 485,
+  111, 112, 183, 486, 185, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497,
+  498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513,
+  514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529,
+  530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545,
+  546, 547, 548, 549, 550, 551, 552, 553, 554, 555, 0, 0, 556, 557, 558, 559,
+  560, 561, 562, 563, 564, 0, 565, 566, 488, 489, 490, 491, 492, 493, 494, 495,
+  496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511,
+  512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527,
+  528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543,
+  544, 545, 546, 547, 548, 549, 550, 551, 552, 553, 554, 555, 0, 0, 556, 557,
+  558, 559, 560, 561, 562, 563, 564, 0, 565, 566, 72, 72, 567, 568, 403, 569,
+  570, 406, 571, 572, 573, 448, 574, 575, 0, 574, 31, 32, 111, 174, 112, 175,
+  576, 577, 578, 579, 31, 32, 580, 581, 582, 583, 78, 582, 584, 585, 586, 250,
+  587, 253, 588, 448, 589, 590, 0, 589, 591, 591, 592, 593, 594, 594, 595, 596,
+  597, 598, 599, 599, 600, 600, 601, 601, 602, 603, 604, 605, 606, 607, 608, 0,
+  121, 609, 0, 121, 610, 610, 111, 112, 111, 112, 66, 67, 611, 612, 613, 614,
+  615, 616, 205, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 617, 618,
+  619, 205, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 620, 621, 622,
+  121, 623, 624, 121, 625, 625, 571, 572, 200, 200, 626, 627, 628, 627, 629, 630,
+  631, 632, 633, 634, 255, 255, 635, 636, 637, 638, 54, 639, 640, 54, 629, 630,
+  641, 642, 643, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 376, 644,
+  645, 646, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 381, 629, 630,
+  647, 647, 631, 632, 648, 649, 650, 651, 652, 653, 654, 655, 78, 654, 656, 657,
+  658, 659, 74, 660, 77, 661, 111, 112, 662, 663, 111, 112, 664, 664, 665, 666,
+  667, 668, 669, 669, 670, 671, 433, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 672, 435, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 673, 674, 675, 676, 677, 678, 679, 111, 680, 681, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 682, 112, 683, 684, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 685, 686, 686, 687, 688, 689, 0, 121, 690,
+  0, 121, 691, 0, 121, 692, 0, 121, 693, 693, 694, 694, 695, 695, 277, 278,
+  111, 112, 602, 603, 604, 605, 606, 607, 571, 572, 31, 32, 111, 112, 31, 32,
+  696, 696, 697, 698, 699, 699, 700, 701, 702, 702, 703, 703, 704, 704, 705, 706,
+  707, 708, 709, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  710, 711, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 712,
+  713, 713, 714, 714, 715, 716, 717, 718, 687, 688, 153, 154, 155, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 156, 157, 158, 155, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 159, 719, 720, 183, 86, 185, 88, 721, 722,
+  723, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 724, 725, 0, 723,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 726, 727, 727, 728, 729,
+  730, 731, 183, 732, 185, 733, 734, 735, 736, 737, 738, 739, 740, 741, 742, 743,
+  744, 745, 746, 747, 748, 746, 31, 32, 749, 750, 751, 752, 753, 754, 183, 86,
+  185, 88, 111, 112, 1, 2, 755, 756, 85, 87, 757, 758, 31, 32, 759, 759,
+  760, 761, 762, 763, 764, 764, 765, 765, 766, 766, 767, 768, 769, 770, 771, 771,
+  772, 773, 772, 773, 774, 775, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 776,
+  774, 775, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 776, 777, 778, 779, 780,
+  781, 781, 782, 783, 784, 250, 251, 785, 253, 251, 786, 787, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 788, 789, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 790, 791, 792, 793, 794, 795, 796, 797, 798,
+  799, 45, 111, 112, 800, 801, 576, 577, 153, 154, 155, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 156, 157, 158, 155, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 159, 802, 803, 721, 722, 723, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 724, 725, 0, 723, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 726, 804, 804, 121, 0, 805, 121, 0, 806, 807, 808,
+  155, 809, 78, 155, 810, 810, 811, 812, 813, 0, 814, 815, 0, 814, 273, 816,
+  273, 816, 817, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  818, 819, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 820,
+  821, 822, 823, 824, 825, 826, 827, 828, 829, 830, 31, 32, 831, 213, 832, 215,
+  833, 834, 835, 836, 837, 838, 839, 171, 840, 78, 111, 112, 576, 577, 841, 0,
+  0, 0, 0, 0, 0, 0, 0, 842, 843, 0, 0, 0, 0, 0, 0, 0,
+  0, 842, 111, 112, 844, 845, 19, 846, 847, 19, 848, 848, 849, 850, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 851, 852, 853, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 854, 855, 174, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 156, 856, 175, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 159, 111, 112, 488, 489, 490, 491, 492, 493,
+  494, 495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509,
+  510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525,
+  526, 527, 528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541,
+  542, 543, 544, 545, 546, 547, 548, 549, 550, 551, 552, 553, 554, 555, 0, 0,
+  556, 557, 558, 559, 560, 561, 562, 563, 564, 0, 565, 566, 488, 489, 490, 491,
+  492, 493, 494, 495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507,
+  508, 509, 510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523,
+  524, 525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539,
+  540, 541, 542, 543, 544, 545, 546, 547, 548, 549, 550, 551, 552, 553, 554, 555,
+  0, 0, 556, 557, 558, 559, 560, 561, 562, 563, 564, 0, 565, 566, 857, 858,
+  859, 860, 861, 862, 863, 864, 865, 866, 867, 868, 869, 870, 871, 872, 873, 874,
+  875, 876, 877, 878, 879, 880, 881, 882, 883, 884, 885, 886, 887, 888, 889, 890,
+  891, 892, 893, 894, 895, 896, 897, 898, 899, 900, 901, 902, 903, 904, 905, 906,
+  907, 908, 909, 910, 911, 912, 913, 914, 915, 916, 917, 918, 919, 920, 921, 922,
+  923, 924, 925, 926, 927, 928, 929, 930, 931, 932, 933, 934, 935, 936, 937, 938,
+  857, 858, 859, 860, 861, 862, 863, 864, 865, 866, 867, 868, 869, 870, 871, 872,
+  873, 874, 875, 876, 877, 878, 879, 880, 881, 882, 883, 884, 885, 886, 887, 888,
+  889, 890, 891, 892, 893, 894, 895, 896, 897, 898, 899, 900, 901, 902, 903, 904,
+  905, 906, 907, 908, 909, 910, 911, 912, 913, 914, 915, 916, 917, 918, 919, 920,
+  921, 922, 923, 924, 925, 926, 927, 928, 929, 930, 931, 932, 933, 934, 935, 936,
+  937, 938, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499, 500, 501,
+  502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 517,
+  518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531, 532, 533,
+  534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 547, 548, 549,
+  550, 551, 552, 553, 554, 555, 0, 0, 556, 557, 558, 559, 560, 561, 562, 563,
+  564, 0, 565, 566, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499,
+  500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515,
+  516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531,
+  532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 547,
+  548, 549, 550, 551, 552, 553, 554, 555, 0, 0, 556, 557, 558, 559, 560, 561,
+  562, 563, 564, 0, 565, 566, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497,
+  498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 513,
+  514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529,
+  530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543, 544, 545,
+  546, 547, 548, 549, 550, 551, 552, 553, 554, 555, 0, 0, 556, 557, 558, 559,
+  560, 561, 562, 563, 564, 0, 565, 566, 488, 489, 490, 491, 492, 493, 494, 495,
+  496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511,
+  512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527,
+  528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538, 539, 540, 541, 542, 543,
+  544, 545, 546, 547, 548, 549, 550, 551, 552, 553, 554, 555, 0, 0, 556, 557,
+  558, 559, 560, 561, 562, 563, 564, 0, 565, 566, 939, 939, 111, 112,
+};
+
+const wa_cp_bitmap WA_ALPHABET_LETTERS[] = {
+  { WA_ALPHABET_BLOCK_INDEX + 0, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2, 4u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 6, 4u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 8, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 10, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 16, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 22, 18u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 26, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 28, 6u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 30, 0u, 31u },
+  { WA_ALPHABET_BLOCK_INDEX + 92, 9u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 94, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 96, 0u, 31u },
+  { WA_ALPHABET_BLOCK_INDEX + 158, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 160, 4u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 162, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 168, 4u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 170, 6u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 172, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 174, 27u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 176, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 182, 166u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 184, 4u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 186, 4u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 188, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 190, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 194, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 196, 4u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 198, 9u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 200, 6u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 202, 9u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 204, 23u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 206, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 212, 7u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 214, 9u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 216, 15u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 218, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 220, 9u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 222, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 226, 0u, 31u },
+  { WA_ALPHABET_BLOCK_INDEX + 288, 26u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 290, 27u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 292, 18u, 28u },
+  { WA_ALPHABET_BLOCK_INDEX + 348, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 350, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 356, 273u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 358, 4u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 360, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 362, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 364, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 370, 19u, 153u },
+  { WA_ALPHABET_BLOCK_INDEX + 676, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 682, 6u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 684, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 686, 3u, 42u },
+  { WA_ALPHABET_BLOCK_INDEX + 770, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 774, 20u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 778, 4u, 163u },
+  { WA_ALPHABET_BLOCK_INDEX + 1104, 4u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1106, 0u, 31u },
+  { WA_ALPHABET_BLOCK_INDEX + 1168, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1170, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1172, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1174, 0u, 31u },
+  { WA_ALPHABET_BLOCK_INDEX + 1236, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 1240, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 1246, 7u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1248, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 1252, 15u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1254, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 1258, 0u, 31u },
+  { WA_ALPHABET_BLOCK_INDEX + 1320, 3u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1322, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1324, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 1328, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1330, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 1334, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1336, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 1342, 6u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1344, 489u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1346, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 1352, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 1356, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1358, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 1362, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 1366, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1368, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1370, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1372, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 1378, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1380, 18u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 1384, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1386, 0u, 31u },
+  { WA_ALPHABET_BLOCK_INDEX + 1448, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1450, 10u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1452, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1454, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1456, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 1462, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 1468, 5u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1470, 9u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1472, 23u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1474, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 1478, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 1482, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1484, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 1488, 5u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1490, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1492, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1494, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1496, 0u, 31u },
+  { WA_ALPHABET_BLOCK_INDEX + 1558, 160u, 5u },
+  { WA_ALPHABET_BLOCK_INDEX + 1568, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1570, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1572, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1574, 20u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 1580, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 1584, 48u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1586, 48u, 112u },
+  { WA_ALPHABET_BLOCK_INDEX + 1810, 48u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1812, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1814, 0u, 168u },
+  { WA_ALPHABET_BLOCK_INDEX + 2150, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2152, 16u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2154, 4u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2156, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 2160, 0u, 31u },
+  { WA_ALPHABET_BLOCK_INDEX + 2222, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 2226, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2228, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2230, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 2236, 0u, 31u },
+  { WA_ALPHABET_BLOCK_INDEX + 2298, 0u, 31u },
+  { WA_ALPHABET_BLOCK_INDEX + 2360, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 2364, 4u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2366, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 2372, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2374, 23u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2376, 12u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2378, 49u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2380, 172u, 44u },
+  { WA_ALPHABET_BLOCK_INDEX + 2468, 9u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2470, 0u, 31u },
+  { WA_ALPHABET_BLOCK_INDEX + 2532, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 2538, 6u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2540, 9u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2542, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2544, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 2550, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 2554, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 2558, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2560, 11u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2562, 4u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2564, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2566, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 2572, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2574, 28u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2576, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 2580, 25u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2582, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2584, 164u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2586, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 2592, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 2596, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2598, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 2604, 14u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2606, 6u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2608, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 2612, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 2616, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 2622, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2624, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2626, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 2630, 78u, 82u },
+  { WA_ALPHABET_BLOCK_INDEX + 2794, 9u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2796, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 2802, 4u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2804, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 2810, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2812, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 2816, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2818, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2820, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2822, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 2828, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2830, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 2834, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 2840, 8u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2842, 4u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2844, 13u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2846, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2848, 4u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2850, 24u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2852, 9u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2854, 171u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2856, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 2862, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 2868, 9u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2870, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2872, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2874, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2876, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 2880, 0u, 31u },
+  { WA_ALPHABET_BLOCK_INDEX + 2942, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 2948, 16u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2950, 4u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2952, 6u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2954, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 2958, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2960, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2962, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2964, 9u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2966, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2968, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 2974, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2976, 0u, 31u },
+  { WA_ALPHABET_BLOCK_INDEX + 3038, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3040, 7u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3042, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3044, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 3048, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 3054, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 3058, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 3062, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3064, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3066, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3068, 11u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3070, 4u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3072, 260u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3074, 10u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3076, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3078, 0u, 31u },
+  { WA_ALPHABET_BLOCK_INDEX + 3140, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3142, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 3146, 0u, 31u },
+  { WA_ALPHABET_BLOCK_INDEX + 3208, 6u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3210, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3212, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 3218, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 3224, 9u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3226, 169u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3228, 269u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3230, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3232, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3234, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 3240, 4u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3242, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3244, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3246, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3248, 9u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3250, 4u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3252, 8u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3254, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3256, 9u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3258, 28u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3260, 168u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3262, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3264, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3266, 0u, 31u },
+  { WA_ALPHABET_BLOCK_INDEX + 3328, 6u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3330, 6u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3332, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 3336, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3338, 0u, 31u },
+  { WA_ALPHABET_BLOCK_INDEX + 3400, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3402, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 3406, 0u, 31u },
+  { WA_ALPHABET_BLOCK_INDEX + 3468, 13u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3470, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 3474, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 3478, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3480, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 3484, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 3488, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 3494, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3496, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3498, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3500, 4u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3502, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 3506, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3508, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3510, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3512, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3514, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3516, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3518, 7u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3520, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 3524, 11u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3526, 23u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3528, 12u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3530, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3532, 4u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3534, 14u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3536, 18u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 3540, 18u, 28u },
+  { WA_ALPHABET_BLOCK_INDEX + 3596, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 3600, 23u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3602, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3604, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 3610, 0u, 31u },
+  { WA_ALPHABET_BLOCK_INDEX + 3672, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3674, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3676, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3678, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 3682, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3684, 4u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3686, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3688, 0u, 31u },
+  { WA_ALPHABET_BLOCK_INDEX + 3750, 4u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3752, 0u, 31u },
+  { WA_ALPHABET_BLOCK_INDEX + 3814, 6u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3816, 2u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 3822, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 3828, 6u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3830, 4u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3832, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 3838, 165u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 3842, 0u, 31u },
+  { WA_ALPHABET_BLOCK_INDEX + 3904, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3906, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 3910, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3912, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3914, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3916, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 3920, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 3924, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3926, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 3930, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3932, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3934, 0u, 10u },
+  { WA_ALPHABET_BLOCK_INDEX + 3954, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3956, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 3962, 5u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3964, 0u, 31u },
+  { WA_ALPHABET_BLOCK_INDEX + 4026, 0u, 31u },
+  { WA_ALPHABET_BLOCK_INDEX + 4088, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 4090, 78u, 82u },
+  { WA_ALPHABET_BLOCK_INDEX + 4254, 78u, 82u },
+  { WA_ALPHABET_BLOCK_INDEX + 4418, 78u, 82u },
+  { WA_ALPHABET_BLOCK_INDEX + 4582, 78u, 82u },
+  { WA_ALPHABET_BLOCK_INDEX + 4746, 169u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 4748, 0u, 1u },
+};
+
+const wa_cp_bitmap WA_ALPHABET_LOWERCASE[] = {
+  { WA_ALPHABET_BLOCK_INDEX + 1, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 4, 4u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 7, 4u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 9, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 13, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 19, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 24, 18u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 27, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 29, 6u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 61, 0u, 31u },
+  { WA_ALPHABET_BLOCK_INDEX + 93, 9u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 95, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 127, 0u, 31u },
+  { WA_ALPHABET_BLOCK_INDEX + 159, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 161, 4u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 165, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 169, 4u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 171, 6u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 173, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 175, 27u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 179, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 183, 166u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 185, 4u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 187, 4u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 189, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 192, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 195, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 197, 4u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 199, 9u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 201, 6u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 203, 9u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 205, 23u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 209, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 213, 7u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 215, 9u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 217, 15u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 219, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 221, 9u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 224, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 257, 0u, 31u },
+  { WA_ALPHABET_BLOCK_INDEX + 289, 26u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 291, 27u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 320, 18u, 28u },
+  { WA_ALPHABET_BLOCK_INDEX + 349, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 353, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 357, 273u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 359, 4u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 361, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 363, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 367, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 523, 19u, 153u },
+  { WA_ALPHABET_BLOCK_INDEX + 679, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 683, 6u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 685, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 728, 3u, 42u },
+  { WA_ALPHABET_BLOCK_INDEX + 772, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 776, 20u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 941, 4u, 163u },
+  { WA_ALPHABET_BLOCK_INDEX + 1105, 4u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1137, 0u, 31u },
+  { WA_ALPHABET_BLOCK_INDEX + 1169, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1171, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1173, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1205, 0u, 31u },
+  { WA_ALPHABET_BLOCK_INDEX + 1238, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 1243, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 1247, 7u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1250, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 1253, 15u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1256, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 1289, 0u, 31u },
+  { WA_ALPHABET_BLOCK_INDEX + 1321, 3u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1323, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1326, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 1329, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1332, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 1335, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1339, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 1343, 6u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1345, 489u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1349, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 1354, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 1357, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1360, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 1364, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 1367, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1369, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1371, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1375, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 1379, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1382, 18u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 1385, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1417, 0u, 31u },
+  { WA_ALPHABET_BLOCK_INDEX + 1449, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1451, 10u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1453, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1455, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1459, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 1465, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 1469, 5u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1471, 9u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1473, 23u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1476, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 1480, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 1483, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1486, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 1489, 5u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1491, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1493, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1495, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1527, 0u, 31u },
+  { WA_ALPHABET_BLOCK_INDEX + 1563, 160u, 5u },
+  { WA_ALPHABET_BLOCK_INDEX + 1569, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1571, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1573, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1577, 20u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 1582, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 1585, 48u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1698, 48u, 112u },
+  { WA_ALPHABET_BLOCK_INDEX + 1811, 48u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1813, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 1982, 0u, 168u },
+  { WA_ALPHABET_BLOCK_INDEX + 2151, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2153, 16u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2155, 4u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2158, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 2191, 0u, 31u },
+  { WA_ALPHABET_BLOCK_INDEX + 2224, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 2227, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2229, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2233, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 2267, 0u, 31u },
+  { WA_ALPHABET_BLOCK_INDEX + 2329, 0u, 31u },
+  { WA_ALPHABET_BLOCK_INDEX + 2362, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 2365, 4u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2369, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 2373, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2375, 23u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2377, 12u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2379, 49u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2424, 172u, 44u },
+  { WA_ALPHABET_BLOCK_INDEX + 2469, 9u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2501, 0u, 31u },
+  { WA_ALPHABET_BLOCK_INDEX + 2535, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 2539, 6u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2541, 9u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2543, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2547, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 2552, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 2556, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 2559, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2561, 11u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2563, 4u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2565, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2569, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 2573, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2575, 28u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2578, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 2581, 25u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2583, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2585, 164u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2589, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 2594, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 2597, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2601, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 2605, 14u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2607, 6u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2610, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 2614, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 2619, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 2623, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2625, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2628, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 2712, 78u, 82u },
+  { WA_ALPHABET_BLOCK_INDEX + 2795, 9u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2799, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 2803, 4u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2807, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 2811, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2814, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 2817, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2819, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2821, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2825, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 2829, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2832, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 2837, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 2841, 8u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2843, 4u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2845, 13u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2847, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2849, 4u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2851, 24u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2853, 9u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2855, 171u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2859, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 2865, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 2869, 9u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2871, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2873, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2875, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2878, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 2911, 0u, 31u },
+  { WA_ALPHABET_BLOCK_INDEX + 2945, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 2949, 16u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2951, 4u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2953, 6u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2956, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 2959, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2961, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2963, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2965, 9u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2967, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 2971, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 2975, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3007, 0u, 31u },
+  { WA_ALPHABET_BLOCK_INDEX + 3039, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3041, 7u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3043, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3046, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 3051, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 3056, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 3060, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 3063, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3065, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3067, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3069, 11u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3071, 4u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3073, 260u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3075, 10u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3077, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3109, 0u, 31u },
+  { WA_ALPHABET_BLOCK_INDEX + 3141, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3144, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 3177, 0u, 31u },
+  { WA_ALPHABET_BLOCK_INDEX + 3209, 6u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3211, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3215, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 3221, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 3225, 9u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3227, 169u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3229, 269u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3231, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3233, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3237, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 3241, 4u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3243, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3245, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3247, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3249, 9u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3251, 4u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3253, 8u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3255, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3257, 9u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3259, 28u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3261, 168u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3263, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3265, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3297, 0u, 31u },
+  { WA_ALPHABET_BLOCK_INDEX + 3329, 6u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3331, 6u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3334, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 3337, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3369, 0u, 31u },
+  { WA_ALPHABET_BLOCK_INDEX + 3401, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3404, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 3437, 0u, 31u },
+  { WA_ALPHABET_BLOCK_INDEX + 3469, 13u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3472, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 3476, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 3479, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3482, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 3486, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 3491, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 3495, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3497, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3499, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3501, 4u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3504, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 3507, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3509, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3511, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3513, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3515, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3517, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3519, 7u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3522, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 3525, 11u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3527, 23u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3529, 12u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3531, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3533, 4u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3535, 14u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3538, 18u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 3568, 18u, 28u },
+  { WA_ALPHABET_BLOCK_INDEX + 3598, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 3601, 23u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3603, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3607, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 3641, 0u, 31u },
+  { WA_ALPHABET_BLOCK_INDEX + 3673, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3675, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3677, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3680, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 3683, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3685, 4u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3687, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3719, 0u, 31u },
+  { WA_ALPHABET_BLOCK_INDEX + 3751, 4u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3783, 0u, 31u },
+  { WA_ALPHABET_BLOCK_INDEX + 3815, 6u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3819, 2u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 3825, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 3829, 6u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3831, 4u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3835, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 3840, 165u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 3873, 0u, 31u },
+  { WA_ALPHABET_BLOCK_INDEX + 3905, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3908, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 3911, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3913, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3915, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3918, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 3922, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 3925, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3928, 0u, 2u },
+  { WA_ALPHABET_BLOCK_INDEX + 3931, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3933, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3944, 0u, 10u },
+  { WA_ALPHABET_BLOCK_INDEX + 3955, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3959, 0u, 3u },
+  { WA_ALPHABET_BLOCK_INDEX + 3963, 5u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 3995, 0u, 31u },
+  { WA_ALPHABET_BLOCK_INDEX + 4057, 0u, 31u },
+  { WA_ALPHABET_BLOCK_INDEX + 4089, 0u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 4172, 78u, 82u },
+  { WA_ALPHABET_BLOCK_INDEX + 4336, 78u, 82u },
+  { WA_ALPHABET_BLOCK_INDEX + 4500, 78u, 82u },
+  { WA_ALPHABET_BLOCK_INDEX + 4664, 78u, 82u },
+  { WA_ALPHABET_BLOCK_INDEX + 4747, 169u, 1u },
+  { WA_ALPHABET_BLOCK_INDEX + 4749, 0u, 1u },
+};
+
+const uint64_t WA_LANG_SETS[][8] = {
+  { 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x40041440008060ull, 0x24020010400004ull, 0xA001000001000023ull, 0x808010000020200ull, 0x8000821015D0340ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x41000000000ull, 0x0ull, 0x1ull, 0x40000ull, 0x2000000000580040ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x810A0002420ull, 0x20220010804810ull, 0x100020001020020ull, 0x40060000ull, 0x2000020080100018ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x80000020ull, 0x0ull, 0x201ull, 0x0ull, 0x2000000000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x80000000ull, 0x2000000000ull, 0x221ull, 0x0ull, 0x2000000000100000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x1000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x2000000000580040ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x400C1481022020ull, 0x2402A850004894ull, 0xA101020003001021ull, 0x17060001200ull, 0x28100A4180D80A58ull, 0x1ull, 0x0ull, 0x0ull },
+  { 0x5490C14C002A440ull, 0x2BA008048DCull, 0x3020003021221ull, 0x3800003060041200ull, 0x28100A21C0D94050ull, 0x1ull, 0x0ull, 0x0ull },
+  { 0x40ull, 0x2000000800ull, 0x21ull, 0x0ull, 0x580008ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x490C142002B060ull, 0x2403E810C00804ull, 0x8103020003421023ull, 0x808011040061210ull, 0x28100A61815D4B54ull, 0x1ull, 0x0ull, 0x0ull },
+  { 0x490C14A002A060ull, 0x2483A810C00804ull, 0xA113020003021323ull, 0x800011040061210ull, 0x28100A61815D4B54ull, 0x1ull, 0x0ull, 0x0ull },
+  { 0x410C14A002B060ull, 0x24836810C00804ull, 0x103020003021123ull, 0x808011040061210ull, 0x28100A63815D4B5Cull, 0x1ull, 0x0ull, 0x0ull },
+  { 0x490C142002A060ull, 0x24022810C00804ull, 0x103020003421321ull, 0x808011040061200ull, 0x28100A21815D4B5Cull, 0x1ull, 0x0ull, 0x0ull },
+  { 0x410C142002B060ull, 0x2402A800C00800ull, 0x103020003021021ull, 0x808011040061200ull, 0x28100A21805D4354ull, 0x1ull, 0x0ull, 0x0ull },
+  { 0x490C142002A060ull, 0x24022810C00804ull, 0x103020003021021ull, 0x808011040061200ull, 0x28100261845D4B54ull, 0x1ull, 0x0ull, 0x0ull },
+  { 0x410C14A002A060ull, 0x2402A810C00804ull, 0x103020003020021ull, 0x808011040061200ull, 0x28100A21805D4B54ull, 0x1ull, 0x0ull, 0x0ull },
+  { 0x490C142002A060ull, 0x24032800C00804ull, 0x103020003020021ull, 0x800011040061200ull, 0x28100223805D4A14ull, 0x1ull, 0x0ull, 0x0ull },
+  { 0x400C142002B060ull, 0x2402A800C00800ull, 0x8103020003020321ull, 0x800011040061200ull, 0x28100221815D4B54ull, 0x1ull, 0x0ull, 0x0ull },
+  { 0x410C148002A060ull, 0x24022800800800ull, 0x2103020003020020ull, 0x800001040061200ull, 0x28000A21815D4A54ull, 0x1ull, 0x0ull, 0x0ull },
+  { 0x1000000400ull, 0x0ull, 0x20000000001ull, 0x1000ull, 0x10000000080000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0xBF8BB99DA0E77EB9ull, 0xDFF77BDE3DDFFBF6ull, 0x3FE57FE9F9EAE7F9ull, 0xF7E723B8EF87FBEFull, 0x3B7FFA96FF5A6FFFull, 0x1ull, 0x0ull, 0x0ull },
+  { 0xBF8BB99DA0E778B9ull, 0xDBF73BFE1DDFFBF6ull, 0x2FA41FE9F9EAE7F9ull, 0xF7E723B8EF87FBEFull, 0x3B77BA96F5422FFFull, 0x1ull, 0x0ull, 0x0ull },
+  { 0xBFCBBD9CA0E7FAB9ull, 0xDAF72BFE1DD7D9F2ull, 0x3BA51FE9F9CAE7E9ull, 0x36E723B8ED87FBEFull, 0x2BF7FA96D45A2FFFull, 0x1ull, 0x0ull, 0x0ull },
+  { 0xBF8B199DA0C77AB9ull, 0xDBF73BFE1DDFFBF6ull, 0x2FA41FE9F9CAE7F9ull, 0xF7E723B86F87FBEFull, 0x3BFFBA96F5422FFFull, 0x1ull, 0x0ull, 0x0ull },
+  { 0xBF8B399DA0E77AB9ull, 0xDFF53BFE3DDFFBF6ull, 0x1FE47FE9F9EAE7F9ull, 0xF7E723B8EF87FBEFull, 0x3B77FA96FF522FFFull, 0x1ull, 0x0ull, 0x0ull },
+  { 0xBF8BB89520E77AB9ull, 0xCFF73BFE1DDFFBF6ull, 0xBFA41FE1F9CAE7F9ull, 0xF7E703B86F87BBEFull, 0x2B77DA16F7586FFFull, 0x1ull, 0x0ull, 0x0ull },
+  { 0xBF8B989DA0E77AB9ull, 0xDFF77BFE1DDFFBF6ull, 0x2FA53FE9F9EAE7F9ull, 0xF7E723B86F87FBEFull, 0x3B7FBA96F74A2FFFull, 0x1ull, 0x0ull, 0x0ull },
+  { 0x9F8BB99DA0E77AB9ull, 0xDFF73BDE3DDFFBF6ull, 0x3FE43FE9F9EAE7F9ull, 0xF7E723B8EF87FBEFull, 0x2B77FA16F7422FFFull, 0x1ull, 0x0ull, 0x0ull },
+  { 0xBFCBBD9DA0E77AB9ull, 0xDFF77BDE3DDFFBF6ull, 0x3FE57FE9FBEAE7F9ull, 0xF7E723B8EF8FFBEFull, 0x3B7FFA96FF5A6FFFull, 0x1ull, 0x0ull, 0x0ull },
+  { 0xBF8B189DA0E768A8ull, 0xDFF77BFE1DCBF9F6ull, 0x2FA45FE9F9CAE7F8ull, 0xF7E723B8EF87FBEEull, 0x297FD296FD522F7Full, 0x1ull, 0x0ull, 0x0ull },
+  { 0xBF09B99D20E76AB9ull, 0xDFF77BDE3DCBFBF6ull, 0x3FE47FE9F9EAE7F8ull, 0xF7E123B8EF87FBEFull, 0x3B7FEA96FF522FFFull, 0x1ull, 0x0ull, 0x0ull },
+  { 0xBF8BB89DA0E77AB9ull, 0xC9F77BFE3DDFFBF6ull, 0x3FA457E9F9EAE7F8ull, 0xF7E723B8EF87FBEEull, 0x2B7FFA96FF422FFFull, 0x1ull, 0x0ull, 0x0ull },
+  { 0xBF8BB99DA0E77AB9ull, 0xDFF77BFE3DDFFBF6ull, 0x3FA57FE9F9EAE7F9ull, 0xF7E723B8EF87FBFFull, 0x3B7FFA96FF4A6FFFull, 0x1ull, 0x0ull, 0x0ull },
+  { 0xBF8BB99DA0E77EB9ull, 0xDFF77BFE3DDFFBF6ull, 0x3FE57FE9F9EAE7F9ull, 0xF7E723B8EF87FBEFull, 0x3B7FFA96FF522FFFull, 0x1ull, 0x0ull, 0x0ull },
+  { 0xBF8BB99DA0E77AB9ull, 0xDFD53BDE3DDFFBF6ull, 0x3FE47FE9F9EAE7F9ull, 0xF3E723B8EF87FBEFull, 0x2B77FA86FF522FFFull, 0x1ull, 0x0ull, 0x0ull },
+  { 0xBF8BB99DA0E77AB8ull, 0xCFF77BFE3DDFFBF6ull, 0x3FA57FE9F9EAE7F9ull, 0xF3E723B8EF87BBFFull, 0x3B7FFA86FF4A6F7Full, 0x1ull, 0x0ull, 0x0ull },
+  { 0x9D0A189400C270A9ull, 0x88F069C6094151D2ull, 0x7A45080A0C8E708ull, 0x14C40138E8873AAFull, 0x21362214940007D8ull, 0x1ull, 0x0ull, 0x0ull },
+  { 0xBF8B1895A0C77AA9ull, 0xDFF57BDE1DDFFBF6ull, 0x3FE43FE9D9CAE7A9ull, 0xF7E623B8EF87B2EBull, 0x397FFA96F5426FFFull, 0x1ull, 0x0ull, 0x0ull },
+  { 0xBF8BB99DA0E77AB9ull, 0xCFF77BDE1DDFFBF6ull, 0x3FE45FE9F9EAE7E9ull, 0xF7E723B8EF87FBEFull, 0x3B77FA96FF5A6FFFull, 0x1ull, 0x0ull, 0x0ull },
+  { 0xBF8BB99DA0E7FEF9ull, 0xDFF77BFE1DDFFBF6ull, 0xBFE57FE9FBEAE7F9ull, 0xF7E723B8EF87FBEFull, 0x3B7FFA96FF5A6FFFull, 0x1ull, 0x0ull, 0x0ull },
+  { 0xBF8A399DA0E7FAB9ull, 0xDFF77BDE3DDFFBF6ull, 0x3FA47DE9F9EAE7F8ull, 0xF7E723B8EF87BBEFull, 0x3BFFFA96FF522FFFull, 0x1ull, 0x0ull, 0x0ull },
+  { 0x974B389500C678B8ull, 0xC5D77BDE0DCB7BF6ull, 0x3FA417E1FBCAE7D9ull, 0xF36723B8EB873BEEull, 0x2367FA02D7520F77ull, 0x1ull, 0x0ull, 0x0ull },
+  { 0xBF89B99D20E72AB9ull, 0xDAF62BCE3D4BDBD6ull, 0x9FE47FC8E1EAE7F8ull, 0x15C123B8EF87FBEFull, 0x3B7F4896B95A2FCCull, 0x1ull, 0x0ull, 0x0ull },
+  { 0x9D491C85004070A9ull, 0x89B139E6094151D6ull, 0x5A411A082C8E728ull, 0x14C00138E8877AAFull, 0x3176FA16944A06D8ull, 0x1ull, 0x0ull, 0x0ull },
+  { 0xBF89B99D20E77AB9ull, 0xDFF73BDE1DCB7BD6ull, 0x1BE45FE8F9EAE7F8ull, 0x55C123B8EF87FBEFull, 0x3B7FEA96F5422FDDull, 0x1ull, 0x0ull, 0x0ull },
+  { 0x1F0B188DA0C778B8ull, 0x89F32BDE1D4B5BF6ull, 0xFA41FC1B9EAE7D8ull, 0x37E603B8ED87FBAFull, 0x2167DA16D5402F77ull, 0x1ull, 0x0ull, 0x0ull },
+  { 0xBF8BF99FA0E7FEFDull, 0xDFF77BFE3DDFFBF6ull, 0xBFF57FE9F9EAE7F9ull, 0xF7EF23FCEF8FFBFFull, 0x3B7FFAD6FFDE6FFFull, 0x1ull, 0x0ull, 0x0ull },
+  { 0xBF8BB99FA0E778B9ull, 0xDBF73BDE1DDFFBF6ull, 0x1FB51FE9F9EAE7F9ull, 0xF7E723BCEF87FBEFull, 0x3B77BAD6F5CE6FFFull, 0x1ull, 0x0ull, 0x0ull },
+  { 0xBF8BB99DA0E77ABDull, 0xDAF73BFE1DDFD9F2ull, 0x3BB51FE9F9CAE7E9ull, 0x36E723BCED87FBEFull, 0x2BF7FAD6D5CA2FFFull, 0x1ull, 0x0ull, 0x0ull },
+  { 0xBF8B599FA0C77EFDull, 0xDBF73BFE1DDFFBF6ull, 0xAFA51FE9F9CAE7F9ull, 0xF7EF23BC6F8FFBEFull, 0x3BFFBAD6F5DE2FFFull, 0x1ull, 0x0ull, 0x0ull },
+  { 0xBF8B799FA0E7FEFDull, 0xDFF53BFE3DDFFBFEull, 0xBFF57FE9FBEAE7F9ull, 0xF7E723FCEF87FBEFull, 0x3B77FAD6FFDA6FFFull, 0x1ull, 0x0ull, 0x0ull },
+  { 0xBF8BBC95A0E7FEFDull, 0xCFF73BDE1D5FFBF6ull, 0xBFA61FE1F9CAE7F9ull, 0xF7EF03BC6F8FBBEFull, 0x2B77FA56F7D82FFFull, 0x1ull, 0x0ull, 0x0ull },
+  { 0xBF8BD89FA0E7FAB9ull, 0xDFF77BFE1DDFFBF6ull, 0x2FB47FE9F9EAE7F9ull, 0xF7E723BC6F87FBEFull, 0x3B7FBA96F7DA6FFFull, 0x1ull, 0x0ull, 0x0ull },
+  { 0x9F8BF99FA0E77EFDull, 0xDFF73BFE3DDFFBFEull, 0xBFF53FE9F9EAE7F9ull, 0xF7E723FCEF87FBEFull, 0x2B77FA56F7CA2FFFull, 0x1ull, 0x0ull, 0x0ull },
+  { 0xBF8BF99FA0E7FEFDull, 0xDFFF7BFE3DDFFBFEull, 0xBFF57FE9FBEAE7F9ull, 0xF7E723FCEF8FFBEFull, 0x3B7FFAD6FFDE2FFFull, 0x1ull, 0x0ull, 0x0ull },
+  { 0xBF8B189D20E768ACull, 0xDFF77BDE1DCBF9F2ull, 0xFA45FE9F9CAE7F8ull, 0xF7E723BCEF87FBEEull, 0x297FF296FDC22F7Full, 0x1ull, 0x0ull, 0x0ull },
+  { 0xBF0BB99FA0E76ABDull, 0xDFF77BDE3DCBFBF6ull, 0xBFF57FE9F9EAE7F9ull, 0xF7E123BCEF87FBEFull, 0x3B7FEA96FFDE2FFFull, 0x1ull, 0x0ull, 0x0ull },
+  { 0xBF8BBC9FA0E7FABDull, 0xC9F77BFE3DDFFBF6ull, 0xBFB457E9F9EAE7F9ull, 0xF7E723BCEF87FBEEull, 0x2B7FFA96FFD22FFFull, 0x1ull, 0x0ull, 0x0ull },
+  { 0xBF8BB99FA0E77ABDull, 0xDFF77BDE3DDFFBF6ull, 0x3FB57FE9F9EAE7F9ull, 0xF7E723BCEF87FBEFull, 0x3B7FFAD6FFCE2FFFull, 0x1ull, 0x0ull, 0x0ull },
+  { 0xBF8BF99FA0E77EFDull, 0xDFF77BFE3DDFFBF6ull, 0xBFF57FE9FBEAE7F9ull, 0xF7EF23BCEF8FFBEFull, 0x3B7FFAD6FFDE2FFFull, 0x1ull, 0x0ull, 0x0ull },
+  { 0xBF8BFD9FA1E7FEFDull, 0xDFF53BFE3DDFFBFEull, 0xBFE77FE9F9EAE7F9ull, 0xF7EF23FCEF8FFBEFull, 0x2B77FAC6FFDE6FFFull, 0x1ull, 0x0ull, 0x0ull },
+  { 0xBF8BB99DA0E77EFCull, 0xCFF77BDE2DDFFBF6ull, 0xBFA57FE9F9EAE7F9ull, 0xF3E723BCEF87BBEFull, 0x3B7FFA86FFD26F7Full, 0x1ull, 0x0ull, 0x0ull },
+  { 0x9D0B189400C2F0A9ull, 0x88F069CE09C159D2ull, 0x7A45080A1C8E708ull, 0x14C40138E8872AAFull, 0x21362214940007D8ull, 0x1ull, 0x0ull, 0x0ull },
+  { 0xBF8B1897A0C7FAADull, 0xDFF57BFE1DDFFBF6ull, 0xBFF57FE9D9CAE7A9ull, 0xF7E623BCEF87B2EBull, 0x397FFA96F5DE6FFFull, 0x1ull, 0x0ull, 0x0ull },
+  { 0xBF8BB99FA0E77ABDull, 0xCFF77BFE1DDFFBFEull, 0xBFF55FE9F9EAE7E9ull, 0xF7E723BCEF87FBEFull, 0x3B77FAD6FFDE6FFFull, 0x1ull, 0x0ull, 0x0ull },
+  { 0xBF8BB99FA0E7FEBDull, 0xDFF77BFE1DDFFBFEull, 0xBFE57FE9F9EAE7F9ull, 0xF7E723FCEF87FBFFull, 0x3B7FFAD6FFDE6FFFull, 0x1ull, 0x0ull, 0x0ull },
+  { 0xBF8B799DA0E77ABDull, 0xDFF77BDE3DDFFBF6ull, 0x3FB57FE9F9EAE7F9ull, 0xF7E723FCEF87BBEFull, 0x3BFFFAD6FFCA6FFFull, 0x1ull, 0x0ull, 0x0ull },
+  { 0x970B7895A0C77ABCull, 0xC5F77BDE0DCB7BFEull, 0x3FA417E1F9CAE7F9ull, 0xF76723B8EB873BEEull, 0x2B67FA02F7960F77ull, 0x1ull, 0x0ull, 0x0ull },
+  { 0xBF89B99FA0E73EB9ull, 0xDAF63BFE3D4BFBD6ull, 0x3FE47FC8E1EAE7F9ull, 0x35C123BCEF87FBEFull, 0x3B7F6AD6F9CA2FCCull, 0x1ull, 0x0ull, 0x0ull },
+  { 0x9D091895804272ADull, 0x89B139CE09C151F6ull, 0x85A411A081C8E729ull, 0x14C0013CE8877AAFull, 0x3176FA16948206D8ull, 0x1ull, 0x0ull, 0x0ull },
+  { 0xBF89F99FA0E77ABDull, 0xDFF73BFE1DCB7BF6ull, 0x3BE45FE8F9EAE7F9ull, 0x55C123FCEF87FBEFull, 0x3B7FEAD6F5CA6FDDull, 0x1ull, 0x0ull, 0x0ull },
+  { 0x1F0B189DA0C7F8BCull, 0x89F72BDE1DCB5BF6ull, 0x2FA41FC1B9EAE7F8ull, 0x37E603BCED87FBAFull, 0x2967DA16D5C42F77ull, 0x1ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x1000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x400000ull, 0x0ull, 0x0ull, 0x4000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x40000000000000ull, 0x2000000000ull, 0x1001ull, 0x200ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x2000000ull, 0x0ull, 0x400000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x40040000000400ull, 0x0ull, 0x20000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x40041000000000ull, 0x4002800C00000ull, 0x20000000000ull, 0x60000ull, 0x10000000400000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x800000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x10000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x0ull, 0x1000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x2000000000ull, 0x1021ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x1000000020000ull, 0x0ull, 0x0ull, 0x200ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x82018000040010ull, 0x4200200000134204ull, 0x4441A0820480000ull, 0x46000820020382ull, 0xA12100000000400ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0xA088010800053088ull, 0x4612111200C62244ull, 0x44502821604080ull, 0x9060000021024160ull, 0xA04000016000001ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x80000800040018ull, 0x4006000000034200ull, 0x24020801480000ull, 0x144002020000141ull, 0x202200000000003ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x800000000000000ull, 0xC00000000800004ull, 0x800000000000008ull, 0xC0000020000000ull, 0x1004000400002000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x480000000002000ull, 0x1029080ull, 0x4000000088100ull, 0xD100000080002068ull, 0x4800000400403ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x100000000000000ull, 0x8004000000009000ull, 0x100ull, 0xC00000000000028Aull, 0x2000001000402ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x100000000000000ull, 0x8000100000006000ull, 0x80100ull, 0x282ull, 0x2000000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x41008000004000ull, 0x8014100ull, 0x80208ull, 0x40000020020000ull, 0x2000040400010ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x82018000440018ull, 0x4204200800134204ull, 0x4441A0820480000ull, 0x6000800820100ull, 0xA02100000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0xA088019C00453088ull, 0x4604311200464244ull, 0x4452082168C080ull, 0x10400008210243E2ull, 0xA16100012000600ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x81000900040018ull, 0x4004000000034200ull, 0x4020801480208ull, 0x144000020001140ull, 0x2200001000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x80000000000008ull, 0x24000ull, 0x804120000488100ull, 0x100000000002020ull, 0x12000000000010ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x82010000040010ull, 0x4004200000110204ull, 0x4441A0820080000ull, 0x6000800000100ull, 0xA00100000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0xA088018800043080ull, 0x4002131000462244ull, 0x44100821604080ull, 0x1040000021024160ull, 0xA04000016000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x81000800040018ull, 0x4002000000014200ull, 0x24020801480200ull, 0x104002000000041ull, 0x202000000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x82008000002008ull, 0x424000ull, 0x20000080000ull, 0x100000000022060ull, 0x2000000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x100000002004ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x8000000100003200ull, 0x100000000C00940ull, 0x4022000080008ull, 0x40800000ull, 0x10000014000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x82018000040010ull, 0x4204200800110204ull, 0x444180820080000ull, 0x46000820820382ull, 0xA00100000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0xB088018800053080ull, 0x4610111400462244ull, 0x44500821684080ull, 0x10400000250243E2ull, 0xA14100016000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x80000800040018ull, 0x4000000000034200ull, 0x4020801480008ull, 0x11440000200013C3ull, 0x202200001002000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x800000000000000ull, 0x800000000800084ull, 0x800000000000008ull, 0xC0000020000000ull, 0x4000400002002ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x480000000004008ull, 0x121001029080ull, 0x4000000480100ull, 0x4100000000002068ull, 0x4808040400400ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x80000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x100000000000000ull, 0x8000000000002000ull, 0x0ull, 0x282ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x82010100040010ull, 0x4204200000114204ull, 0x404180820080000ull, 0x106000800800100ull, 0xA02100000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0xA088018800043080ull, 0x4212111000462244ull, 0x4502821604080ull, 0x1040000021020160ull, 0xA04000012000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x81000800040018ull, 0x4002000000034200ull, 0x4000800080200ull, 0x104000000000141ull, 0x202000000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x482008000007280ull, 0x120142C0C0ull, 0x4000000480100ull, 0x100000000820028ull, 0x6800040400000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x88000000000000ull, 0x100000022000ull, 0x0ull, 0x1000000000000000ull, 0x4400000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x100000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x400000000000000ull, 0x0ull, 0x100ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x82018020040010ull, 0x4200220800134204ull, 0x4441A0820480000ull, 0x46000820020382ull, 0x2A12300000000400ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0xA088090880073088ull, 0x4612131200C62A44ull, 0x445028216040A0ull, 0x9060000061824160ull, 0x2A04200016000001ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x80001900040018ull, 0x4026000000834200ull, 0x24020801480000ull, 0x144012020000141ull, 0x202200040000003ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x800000000000000ull, 0xC00000000800004ull, 0x800000000000008ull, 0xC0002020000000ull, 0x1004200400002000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x480000000022000ull, 0x1029080ull, 0x8004000000088100ull, 0xD100000080002068ull, 0x4800000400403ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x100080000000000ull, 0x8004000000009000ull, 0x100ull, 0xC00000000000028Aull, 0x2000000000402ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x100000000000000ull, 0x8000100000006020ull, 0x80100ull, 0x4000000000000282ull, 0x2000000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x41089000004004ull, 0x8014100ull, 0x80208ull, 0x40000020020000ull, 0x2000040400010ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x82019020440018ull, 0x4204220800134204ull, 0x4451A0820480000ull, 0x6000800820120ull, 0xA02300000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0xA188099CA04730A8ull, 0x4624331A00C64A64ull, 0x44520821E8C080ull, 0x10400018618243E2ull, 0xA16300012000600ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x8100090004001Cull, 0x4004000000034200ull, 0x4020801480208ull, 0x144000020001140ull, 0x2200001000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x80001000000008ull, 0x24000ull, 0x804120000488100ull, 0x100000000002020ull, 0x12020000000010ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x82010000040010ull, 0x4004200000110204ull, 0x4441A0820480000ull, 0x6000800000100ull, 0x2A00300000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0xA088098800063080ull, 0x4002131000C62244ull, 0x441008216040A0ull, 0x1040000061024160ull, 0xA04200016000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x81000800040018ull, 0x4002000000814200ull, 0x24020801480200ull, 0x104002000000041ull, 0x202000000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x83088000022008ull, 0xC24000ull, 0x20000080000ull, 0x4100000000022260ull, 0x2000000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x100000002000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x8000000100003200ull, 0x100020000C00940ull, 0x4022000080008ull, 0x40800000ull, 0x10000014400000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x82018000040010ull, 0x4204200800110204ull, 0x444180821080000ull, 0x46000820820382ull, 0xA00300000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0xB088098800053080ull, 0x4610131400C62244ull, 0x44500821684080ull, 0x10400000650243E2ull, 0xA14300016000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x80000920040038ull, 0x4000000000034200ull, 0x4020801480008ull, 0x11440000200013C3ull, 0x202200001002000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x800000000000000ull, 0x800100000800084ull, 0x800000000000008ull, 0xC0000020000000ull, 0x4200400002002ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x480000000004008ull, 0x101001029080ull, 0x4000000480100ull, 0x4100000000002068ull, 0x4808040400400ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x100000000000000ull, 0x8000000000002020ull, 0x0ull, 0x282ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x82010100040010ull, 0x4204200000114204ull, 0x404180920080000ull, 0x106000800800100ull, 0xA02300000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0xA088018880043080ull, 0x4212131000C62244ull, 0x4502821604080ull, 0x1040000061020160ull, 0x2A04200012000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x81001900040018ull, 0x4002000000034200ull, 0x4000800080200ull, 0x104000000000141ull, 0x202000000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x4830890000072A0ull, 0x2120142C0C0ull, 0x4000000480100ull, 0x100000040820028ull, 0x2006810040400000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x88000000000000ull, 0x100000822000ull, 0x0ull, 0x1000000000000000ull, 0x200004400000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x80000000000000ull, 0x4000ull, 0x0ull, 0x100ull, 0x2000004000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x800040010ull, 0x20008000ull, 0x200910000000ull, 0x8000040ull, 0x200000002000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x800040010ull, 0x20008000ull, 0x200910000020ull, 0x8000040ull, 0x200000002000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x40000000000000ull, 0x0ull, 0x20000000000000ull, 0x2000000000ull, 0x200000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x8000000ull, 0x4004000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x20000ull, 0x0ull, 0x1000000008000000ull, 0x4004000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x1000000400000000ull, 0x600000000ull, 0x400000ull, 0x200000004000000ull, 0x2020ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x20ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x400000000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x1008000400000000ull, 0x20000600000000ull, 0x118200000ull, 0x3220000000000000ull, 0x4000000000023ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x1008000400020000ull, 0x20100600000000ull, 0x118200000ull, 0x3220000000000000ull, 0x2004000000000023ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x8000000000000ull, 0x0ull, 0x0ull, 0x1000000000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x400000000ull, 0x200008000ull, 0x0ull, 0x220000000000000ull, 0x200000000023ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x400000000ull, 0x100200008000ull, 0x0ull, 0x220000000000000ull, 0x200000000023ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x800040010ull, 0x20008000ull, 0x1000200910000000ull, 0x8000040ull, 0x2000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x800040010ull, 0x20008000ull, 0x1000200910002020ull, 0x8000040ull, 0x2000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x400000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x40000000400000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x8000100ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x20000ull, 0x0ull, 0x8000000ull, 0x4004000ull, 0x2000000000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x1008000800040010ull, 0x200000400000200ull, 0x1000000ull, 0x140ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x1048001800040010ull, 0x200000400000200ull, 0x1000000ull, 0x140ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x20ull, 0x10ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x4000ull, 0x0ull, 0x0ull, 0x0ull, 0x40000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x4004ull, 0x0ull, 0x0ull, 0x0ull, 0x40000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x110000000ull, 0x8000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x1440000000800006ull, 0x800008000000008ull, 0x0ull, 0x1000000000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x1440000000800006ull, 0x800008000000008ull, 0x0ull, 0x1000200000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x800040010ull, 0x20000000ull, 0x200910000000ull, 0x8000040ull, 0x200000002000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x800040010ull, 0x20000000ull, 0x200910000020ull, 0x8000040ull, 0x2200000002000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x8000000ull, 0x4000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x4004ull, 0x10000000000000ull, 0x0ull, 0x0ull, 0x40000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x100000000000ull, 0x110000000ull, 0x8000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x0ull, 0x1000000000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x110000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x1000000000000000ull, 0x400400000000ull, 0x0ull, 0x4004000ull, 0x2000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x1000000000020000ull, 0x400400000000ull, 0x0ull, 0x4004000ull, 0x2000100000002000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x1000000800040000ull, 0x12000400000200ull, 0x0ull, 0x8000000004000140ull, 0x800000000002000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x8000000000000ull, 0x0ull, 0x0ull, 0x1000000000000000ull, 0x400000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x8000000020000ull, 0x0ull, 0x0ull, 0x1000000000000000ull, 0x400000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0xA800000820040010ull, 0x4A02000000080A04ull, 0x800080800220090ull, 0xA0000000002140ull, 0x210008400000003ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0xA800001820040010ull, 0x4A02000000080A04ull, 0x800080800220090ull, 0xA0000000002140ull, 0x210008400000003ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x800040010ull, 0x20000000ull, 0x200810000000ull, 0x8000040ull, 0x200000002002000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x800040010ull, 0x100020000000ull, 0x200810000020ull, 0x8000040ull, 0x200000002002000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x2000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x20ull, 0x0ull, 0x2000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x1000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x4000ull, 0x100ull, 0x0ull, 0x2000000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x4000ull, 0x800100ull, 0x0ull, 0x2000000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x1000000000000000ull, 0x0ull, 0x0ull, 0x1000000000000040ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x0ull, 0x8000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x8000000000000ull, 0x400000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x8000000020000ull, 0x400000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x1000000000000000ull, 0x0ull, 0x0ull, 0x4000000ull, 0x2000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x1000000000020000ull, 0x0ull, 0x20ull, 0x4000000ull, 0x2000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x1000000004000ull, 0x0ull, 0x200ull, 0x0ull, 0x40400000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x1000000004004ull, 0x0ull, 0x200ull, 0x2000000000ull, 0x40400000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x1808000400000000ull, 0x800000600001080ull, 0x118200000ull, 0x32A0000008001000ull, 0x4000400000023ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x1808000400020000ull, 0x800000600001080ull, 0x118200000ull, 0x32A0000008001000ull, 0x4000401000023ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x0ull, 0x2000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x0ull, 0x20000000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x1440000000800006ull, 0x8000000000ull, 0x0ull, 0x1004000000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x1440100000800006ull, 0x8000000000ull, 0x0ull, 0x1004200000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x2000000800040010ull, 0x20000000ull, 0x200918000000ull, 0x8000040ull, 0x200000002000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x2000000800040010ull, 0x100020000000ull, 0x200918000000ull, 0x8000040ull, 0x200000002000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x8000000000000ull, 0x0ull, 0x100ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x8000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x80000000000000ull, 0x0ull, 0x0ull, 0x8000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x80000000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x1000000000000000ull, 0x400000000ull, 0x0ull, 0x4000000ull, 0x2000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x400000000000000ull, 0x4000000ull, 0x2000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x20000ull, 0x0ull, 0x400000000000000ull, 0x4000000ull, 0x2000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x1808000400000000ull, 0x800000600001080ull, 0x118200000ull, 0x32A0000008000000ull, 0x400400023ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x1808000400000000ull, 0x800000600001080ull, 0x118200000ull, 0x32A0000008000000ull, 0x2000000400400023ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x2000000000040000ull, 0x4000000010000800ull, 0x800000000000010ull, 0x40ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x2000000820040030ull, 0x4202000000080204ull, 0x80821000090ull, 0x2140ull, 0x200000000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x4ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x2000000000000000ull, 0x4000000010000800ull, 0x800000000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x800000000000080ull, 0x40ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x800004000ull, 0x200ull, 0x80000000010ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x2000000820040030ull, 0x4222000000080204ull, 0x821000090ull, 0x400000000002140ull, 0x200001000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x20000000000004ull, 0x10ull, 0x400000000002000ull, 0x1000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x10ull, 0x200000000000000ull, 0x402800004000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x10000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x800000020000000ull, 0x800000000000000ull, 0x10ull, 0x80000000000000ull, 0x8400000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x200000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x200000000000ull, 0x4ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x10000800ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x2ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x0ull, 0x1ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x800040010ull, 0x202000000000200ull, 0x1000000ull, 0x140ull, 0x200000000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x800040010ull, 0x202000000000200ull, 0x1000000ull, 0x140ull, 0x2200000000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x800040010ull, 0x2000000000200ull, 0x1000000ull, 0x40ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x800040010ull, 0x200000000000200ull, 0x1000000ull, 0x140ull, 0x200000000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x800040010ull, 0x202000000000200ull, 0x0ull, 0x140ull, 0x200000000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x20000000000000ull, 0x200000ull, 0x0ull, 0x2ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x0ull, 0x4000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x10000000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x40000ull, 0x2000000000200ull, 0x0ull, 0x0ull, 0x800000000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x20000000000000ull, 0x2000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x20000000000000ull, 0x2008000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x200000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x20000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x10ull, 0x202000000000000ull, 0x800004000ull, 0x100ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x10ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x0ull, 0x400000000000000ull, 0x1000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x20000000ull, 0x0ull, 0x0ull, 0x20002000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x810800000000ull, 0x10800800ull, 0x1040480000200000ull, 0xC0000100ull, 0x24000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x10000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x800200000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x1000000ull, 0x0ull, 0x800200000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x1000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x800004ull, 0x0ull, 0x0ull, 0x200000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x20ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x20ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x8ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x20000000000008ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x80000000ull, 0x8ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0xA0000020ull, 0x20000000000008ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x4000000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x40040000108000ull, 0x2010000000000000ull, 0x4008001000001000ull, 0x4000100000ull, 0x20900040000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x20ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x1000000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x20000000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x4000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x20000000000000ull, 0x0ull, 0x1000000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x20000000100000ull, 0x2000000000000000ull, 0x0ull, 0x0ull, 0x4000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x4000ull, 0x0ull, 0x1000000000000ull, 0x0ull, 0x20ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x1000000000000ull, 0x0ull, 0x20ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x100000ull, 0x10000000000000ull, 0x0ull, 0x0ull, 0x20000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x2ull, 0x0ull, 0x1000000000000ull, 0x0ull, 0x20ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x6004000110C006ull, 0x2010000000000000ull, 0x4009001000001000ull, 0x84000100000ull, 0x24900040020ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x6004000110C006ull, 0x2010000000000000ull, 0x4009001000000000ull, 0x4000100000ull, 0x24900040020ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x6004000110C006ull, 0x2010000000000000ull, 0x4009001000001000ull, 0x4000100000ull, 0x24900040020ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x6004000100C006ull, 0x2010000000000000ull, 0x4009001000001000ull, 0x84000100000ull, 0x24900040020ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x6004000110C004ull, 0x2010000000000000ull, 0x4008001000001000ull, 0x84000100000ull, 0x24900040000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x6004008110C006ull, 0x2010000000000000ull, 0x4009001000001020ull, 0x84000100000ull, 0x24900040020ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x6004000110C006ull, 0x2010000000000000ull, 0x4009001000001020ull, 0x4000100000ull, 0x24900040020ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x60040001108006ull, 0x2010000000000000ull, 0x4009001000000000ull, 0x4000100000ull, 0x4900000020ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x60040001008004ull, 0x2010000000000000ull, 0x4008001000000000ull, 0x4000100000ull, 0x4900000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x60040001008004ull, 0x2010000000000000ull, 0x4008001000001000ull, 0x4000100000ull, 0x20900040000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x6004000010C006ull, 0x2010000000000000ull, 0x4008001000001000ull, 0x84000100000ull, 0x900000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x60040001108006ull, 0x2010000000000000ull, 0x4008001000000000ull, 0x84000100000ull, 0x4900000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x40040000108004ull, 0x2010000000000000ull, 0x4008001000001000ull, 0x84000100000ull, 0x20900040000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x60040001108004ull, 0x2010000000000000ull, 0x4008001000001000ull, 0x4000100000ull, 0x24900040000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x40040001108004ull, 0x2010000000000000ull, 0x4008001000001000ull, 0x4000100000ull, 0x24900040000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x6004008110C006ull, 0x2010000000000000ull, 0x4009001000001000ull, 0x84000100000ull, 0x24900040020ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x6004000110C006ull, 0x2010000000000000ull, 0x4009001000001020ull, 0x84000100000ull, 0x24900040020ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x6004008100C006ull, 0x2010000000000000ull, 0x4009001000001020ull, 0x84000100000ull, 0x24900040020ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x6004000110C004ull, 0x2010000000000000ull, 0x4008001000001020ull, 0x84000100000ull, 0x24900040000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x60040001108006ull, 0x2010000000000000ull, 0x4009001000001020ull, 0x4000100000ull, 0x24900000020ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x6004008010C006ull, 0x2010000000000000ull, 0x4008001000001000ull, 0x84000100000ull, 0x4900000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x60040001108006ull, 0x2010000000000000ull, 0x4008001000001000ull, 0x84000100000ull, 0x4900000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x40040000108004ull, 0x2010000000000000ull, 0x4008001000001000ull, 0x84000100000ull, 0x24900040000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x40040001108004ull, 0x2010000000000000ull, 0x4008001000001020ull, 0x4000100000ull, 0x24900040000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x40040000108000ull, 0x2010000000000000ull, 0x4008001000001000ull, 0x4000100000ull, 0x24900040000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x20000000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x4000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0xC000ull, 0x2010000000000000ull, 0x0ull, 0x0ull, 0x20000040000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x0ull, 0x80000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x100000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x8000ull, 0x0ull, 0x0ull, 0x0ull, 0x100000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x8000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x2ull, 0x2010000000000000ull, 0x0ull, 0x0ull, 0x20000040000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x4000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x2ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x8000ull, 0x2010000000000000ull, 0x1000ull, 0x0ull, 0x900000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x40000000008000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0xC000ull, 0x2010000000000000ull, 0x8000000001000ull, 0x80000000000ull, 0x900000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x2000000000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x2ull, 0x10000000000000ull, 0x0ull, 0x0ull, 0x20000040000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x2ull, 0x0ull, 0x0ull, 0x0ull, 0x40000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0xC000ull, 0x2000000000000000ull, 0x0ull, 0x80000000000ull, 0x100000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x40000000004ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x40000000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x0ull, 0x100000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0xC002ull, 0x2010000000000000ull, 0x0ull, 0x0ull, 0x100000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x40000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x2000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x40000000ull, 0x0ull, 0x0ull, 0x400000000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x80000000ull, 0x40000000ull, 0x0ull, 0x0ull, 0x400000000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x400000000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x100ull, 0x400ull, 0x8000000000000220ull, 0x8000000000000ull, 0x12000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x100ull, 0x400ull, 0x20ull, 0x0ull, 0x10000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x20ull, 0x8000000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x10100ull, 0x400ull, 0x8000000000000020ull, 0x8000010000000ull, 0x10000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x4010100ull, 0x400ull, 0x8000000004000020ull, 0x8000010000000ull, 0x10000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x100ull, 0x400ull, 0x8000000004000020ull, 0x10000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x100ull, 0x400ull, 0x8000000004000020ull, 0x10000000ull, 0x10000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x100ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x1000004010100ull, 0x400ull, 0x8000000004000220ull, 0x18000010000000ull, 0x12000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x1000084010100ull, 0x400ull, 0x8000000004000220ull, 0x18000010000000ull, 0x12000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x80000100ull, 0x400ull, 0x8000000000000020ull, 0x10000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x4000100ull, 0x400ull, 0x8000000004000020ull, 0x8000010000000ull, 0x10000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x1000004000100ull, 0x400ull, 0x8000000004000220ull, 0x18000010000000ull, 0x10000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x1000004000100ull, 0x400ull, 0x8000000004000220ull, 0x18000010000000ull, 0x12000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x100ull, 0x400ull, 0x8000000004000020ull, 0x8000010000000ull, 0x10000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x1000080000100ull, 0x400ull, 0x8000000004000220ull, 0x18000010000000ull, 0x10000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x4000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x100ull, 0x400ull, 0x20ull, 0x10000000ull, 0x12000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x80000100ull, 0x400ull, 0x8000000000000220ull, 0x0ull, 0x12000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x1000000010100ull, 0x400ull, 0x8000000000000220ull, 0x18000010000000ull, 0x2000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x100ull, 0x0ull, 0x220ull, 0x10000000ull, 0x2000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x80000100ull, 0x400ull, 0x8000000000000020ull, 0x8000010000000ull, 0x12000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x100ull, 0x400ull, 0x8000000000000020ull, 0x0ull, 0x10000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x100ull, 0x0ull, 0x8000000000000020ull, 0x8000000000000ull, 0x10000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x100ull, 0x0ull, 0x20ull, 0x8000000000000ull, 0x10000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x100ull, 0x0ull, 0x8000000000000020ull, 0x0ull, 0x10000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x100ull, 0x0ull, 0x0ull, 0x0ull, 0x10000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x220ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x200ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x4010000ull, 0x0ull, 0x20ull, 0x0ull, 0x10000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x0ull, 0x8000000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x0ull, 0x10000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x1000004010000ull, 0x400ull, 0x8000000004000220ull, 0x18000010000000ull, 0x12000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x1000000000000ull, 0x0ull, 0x200ull, 0x10000000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x1000004010000ull, 0x400ull, 0x8000000004000220ull, 0x10000010000000ull, 0x12000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x1000000000000ull, 0x0ull, 0x4000200ull, 0x10000000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x1000004010000ull, 0x400ull, 0x8000000004000220ull, 0x18000010000000ull, 0x10000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x2000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x10000ull, 0x0ull, 0x20ull, 0x8000000000000ull, 0x10000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x4000000ull, 0x0ull, 0x4000220ull, 0x18000000000000ull, 0x12000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x1000004010000ull, 0x0ull, 0x220ull, 0x10000000000000ull, 0x2000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x4000000ull, 0x10000000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x20ull, 0x10000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x1000004010000ull, 0x0ull, 0x220ull, 0x10000000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x0ull, 0x10000000ull, 0x2000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x10000ull, 0x0ull, 0x20ull, 0x8000010000000ull, 0x10000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x10000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x20ull, 0x0ull, 0x10000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x1000000000000ull, 0x0ull, 0x8000000004000200ull, 0x10000000000000ull, 0x2000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x8000000000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x8000000000000020ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x1000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x4000000000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x20000000ull, 0x0ull, 0x0ull, 0x400ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x0ull, 0x400ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x0ull, 0x100000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x800000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x80000000ull, 0x0ull, 0x10ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x80000000ull, 0x20ull, 0x10ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x80000000ull, 0x0ull, 0x0ull, 0x10ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x20A000000ull, 0x80000000ull, 0x80000400000028ull, 0x440100000010ull, 0x80000000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x20A000000ull, 0x80000000ull, 0x80000000000028ull, 0x440000000010ull, 0x80000000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x20A000000ull, 0x80000000ull, 0x80000000000028ull, 0x40000000010ull, 0x80000000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x202000000ull, 0x80000000ull, 0x80000000000028ull, 0x40000000010ull, 0x80000000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x2000000ull, 0x80000000ull, 0x80000000000008ull, 0x40000000010ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x80000000ull, 0x80000000000008ull, 0x40000000010ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x200000000ull, 0x80000000ull, 0x8ull, 0x10ull, 0x80000000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x200000000ull, 0x80000000ull, 0x80000000000028ull, 0x10ull, 0x80000000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x202000000ull, 0x80000000ull, 0x80000000000008ull, 0x40000000010ull, 0x80000000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x20A000000ull, 0x80000000ull, 0x80000400000028ull, 0x40100000010ull, 0x80000000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x20A000000ull, 0x80000000ull, 0x80000400000008ull, 0x40100000010ull, 0x80000000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x2000000ull, 0x80000000ull, 0x80000000000008ull, 0x40100000010ull, 0x80000000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x20A000000ull, 0x80000000ull, 0x80000400000008ull, 0x440100000010ull, 0x80000000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x28A000000ull, 0x80000000ull, 0x80000400000028ull, 0x440100000010ull, 0x80000000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x200000000ull, 0x80000000ull, 0x80000000000008ull, 0x40000000010ull, 0x80000000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x28A000000ull, 0x80000000ull, 0x80000400000028ull, 0x40100000010ull, 0x80000000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x20A000000ull, 0x80000000ull, 0x80000400000028ull, 0x40100000010ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x80000000ull, 0x20ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x80000000ull, 0x80000000000008ull, 0x40000000010ull, 0x80000000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x80000000ull, 0x80000000ull, 0x20ull, 0x10ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x80000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x0ull, 0x40000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x40000400ull, 0x80000000ull, 0x20ull, 0x80010ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x0ull, 0x10ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x20ull, 0x10ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x40000400ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x40000400ull, 0x0ull, 0x10000000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x40000000ull, 0x0ull, 0x10000000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x40000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x400ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x400ull, 0x0ull, 0x10000000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x0ull, 0x400000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x2000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x0ull, 0x80000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x800ull, 0x80000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x4000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x10000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x2ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x2000000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x0ull, 0x800000000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x80000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x80000000ull, 0x0ull, 0x0ull, 0x0ull, 0x80000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x2000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x80000000ull, 0x1ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x2000000000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x8000000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x4000000040ull, 0x200000ull, 0x0ull, 0x0ull, 0x300000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x200000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x4000000040ull, 0x0ull, 0x0ull, 0x0ull, 0x300000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x40ull, 0x200000ull, 0x0ull, 0x0ull, 0x300000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x40ull, 0x0ull, 0x0ull, 0x0ull, 0x300000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x4000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x300000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x4000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x200000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x300000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x40ull, 0x0ull, 0x0ull, 0x0ull, 0x100000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x100000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x40ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x400000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x10000000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x10000000000000ull, 0x400000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x400000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x800000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x100000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x10000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x8000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x1ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x8000000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x40000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x1000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x20000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x2000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x10000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x0ull, 0x400000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x20000000000000ull, 0x0ull, 0x404000000000000ull, 0x1000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x20000000000000ull, 0x20ull, 0x404000000000000ull, 0x1000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x80000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x1000ull, 0x20000000000000ull, 0x0ull, 0x400000000000000ull, 0x1000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x1000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x200ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x800000000ull, 0x2000000000000ull, 0x0ull, 0x100ull, 0x800000000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x20000000000ull, 0x0ull, 0x0ull, 0x80000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x20000000000ull, 0x20ull, 0x0ull, 0x80000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x20000000000000ull, 0x0ull, 0x400000000000000ull, 0x1000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x20000000000000ull, 0x0ull, 0x400000000000000ull, 0x800001000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x20000000000000ull, 0x20ull, 0x400000000000000ull, 0x1000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x800000000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x80000000000000ull, 0x2000000000000ull, 0x0ull, 0x100ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x20000000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x20000000000ull, 0x0ull, 0x0ull, 0x200000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x20000000000ull, 0x0ull, 0x1000000ull, 0x800000000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x20000000000ull, 0x0ull, 0x1000000ull, 0x800200000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x800000000000000ull, 0xC00000000800004ull, 0x8ull, 0x80000000000000ull, 0x1000000400000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x800000000000000ull, 0xC00000000800004ull, 0x8ull, 0x80000000000000ull, 0x1000200400000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x80000000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x200000400000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x400000000800000ull, 0x0ull, 0x0ull, 0x4000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x400000000800000ull, 0x0ull, 0x0ull, 0x200004000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x80000000ull, 0x0ull, 0x1ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x8002000000000220ull, 0x80000ull, 0x10000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x2000000000020ull, 0x800000000000010ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x20000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x80000000ull, 0x10000000ull, 0x0ull, 0x0ull, 0x20000000100ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x10A0002420ull, 0x20010800800ull, 0x20000020000ull, 0x110400E0000ull, 0x81002008010001Cull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x0ull, 0x10000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x800000000000ull, 0x0ull, 0x0ull, 0x2000000000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x800000000000ull, 0x0ull, 0x0ull, 0x4000000000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x800000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x4ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x800000000000ull, 0x200000000ull, 0x0ull, 0x4000000000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x200000000ull, 0x0ull, 0x4000000000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x4000000000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x800000000000ull, 0x1000200000000ull, 0x0ull, 0x4000002000004200ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x80000000ull, 0x800000000000ull, 0x200000000ull, 0x0ull, 0x4000000000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x200000000ull, 0x0ull, 0x6000000000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x800000000000ull, 0x200000000ull, 0x0ull, 0x6000000000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x200000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x80000000ull, 0x0ull, 0x200000000ull, 0x0ull, 0x4000000000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x40000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x100000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x40000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x80000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x2000000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x0ull, 0x800000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x8000000000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x0ull, 0x200000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x10000000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x800000000000000ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x0ull, 0x200000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x0ull, 0x0ull, 0x400000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x20000000000ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+  { 0x0ull, 0x800ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull, 0x0ull },
+};
+
+const wa_cp_lang_range WA_CP_LANG_RANGES[] = {
+  {0x20u, 1}, {0x21u, 0}, {0x25u, 2}, {0x26u, 0}, {0x27u, 3}, {0x28u, 4},
+  {0x29u, 5}, {0x2Au, 0}, {0x2Cu, 6}, {0x2Du, 7}, {0x2Eu, 8}, {0x2Fu, 9},
+  {0x30u, 10}, {0x31u, 11}, {0x32u, 12}, {0x33u, 13}, {0x34u, 14}, {0x35u, 15},
+  {0x36u, 16}, {0x37u, 17}, {0x38u, 18}, {0x39u, 19}, {0x3Au, 20}, {0x3Bu, 0},
+  {0x41u, 21}, {0x42u, 22}, {0x43u, 23}, {0x44u, 24}, {0x45u, 25}, {0x46u, 26},
+  {0x47u, 27}, {0x48u, 28}, {0x49u, 29}, {0x4Au, 30}, {0x4Bu, 31}, {0x4Cu, 32},
+  {0x4Du, 33}, {0x4Eu, 34}, {0x4Fu, 35}, {0x50u, 36}, {0x51u, 37}, {0x52u, 38},
+  {0x53u, 39}, {0x54u, 40}, {0x55u, 41}, {0x56u, 42}, {0x57u, 43}, {0x58u, 44},
+  {0x59u, 45}, {0x5Au, 46}, {0x5Bu, 0}, {0x61u, 47}, {0x62u, 48}, {0x63u, 49},
+  {0x64u, 50}, {0x65u, 51}, {0x66u, 52}, {0x67u, 53}, {0x68u, 54}, {0x69u, 55},
+  {0x6Au, 56}, {0x6Bu, 57}, {0x6Cu, 58}, {0x6Du, 59}, {0x6Eu, 60}, {0x6Fu, 61},
+  {0x70u, 62}, {0x71u, 63}, {0x72u, 64}, {0x73u, 65}, {0x74u, 66}, {0x75u, 67},
+  {0x76u, 68}, {0x77u, 69}, {0x78u, 70}, {0x79u, 71}, {0x7Au, 72}, {0x7Bu, 0},
+  {0xA1u, 73}, {0xA2u, 0}, {0xAAu, 74}, {0xABu, 75}, {0xACu, 0}, {0xADu, 76},
+  {0xAEu, 0}, {0xB0u, 77}, {0xB1u, 0}, {0xB2u, 78}, {0xB3u, 0}, {0xB4u, 79},
+  {0xB5u, 80}, {0xB6u, 0}, {0xB9u, 81}, {0xBAu, 0}, {0xBBu, 82}, {0xBCu, 0},
+  {0xBDu, 83}, {0xBEu, 0}, {0xBFu, 83}, {0xC0u, 84}, {0xC1u, 85}, {0xC2u, 86},
+  {0xC3u, 87}, {0xC4u, 88}, {0xC5u, 89}, {0xC6u, 90}, {0xC7u, 91}, {0xC8u, 92},
+  {0xC9u, 93}, {0xCAu, 94}, {0xCBu, 95}, {0xCCu, 96}, {0xCDu, 97}, {0xCEu, 98},
+  {0xCFu, 99}, {0xD0u, 100}, {0xD1u, 101}, {0xD2u, 102}, {0xD3u, 103}, {0xD4u, 104},
+  {0xD5u, 105}, {0xD6u, 106}, {0xD7u, 107}, {0xD8u, 108}, {0xD9u, 109}, {0xDAu, 110},
+  {0xDBu, 111}, {0xDCu, 112}, {0xDDu, 113}, {0xDEu, 114}, {0xDFu, 115}, {0xE0u, 116},
+  {0xE1u, 117}, {0xE2u, 118}, {0xE3u, 119}, {0xE4u, 120}, {0xE5u, 121}, {0xE6u, 122},
+  {0xE7u, 123}, {0xE8u, 124}, {0xE9u, 125}, {0xEAu, 126}, {0xEBu, 127}, {0xECu, 128},
+  {0xEDu, 129}, {0xEEu, 130}, {0xEFu, 131}, {0xF0u, 132}, {0xF1u, 133}, {0xF2u, 134},
+  {0xF3u, 135}, {0xF4u, 136}, {0xF5u, 137}, {0xF6u, 138}, {0xF7u, 0}, {0xF8u, 139},
+  {0xF9u, 140}, {0xFAu, 141}, {0xFBu, 142}, {0xFCu, 143}, {0xFDu, 144}, {0xFEu, 114},
+  {0xFFu, 145}, {0x100u, 146}, {0x101u, 147}, {0x102u, 148}, {0x104u, 149}, {0x105u, 150},
+  {0x106u, 151}, {0x108u, 152}, {0x10Au, 153}, {0x10Cu, 154}, {0x10Du, 155}, {0x10Eu, 156},
+  {0x110u, 157}, {0x111u, 158}, {0x112u, 159}, {0x113u, 160}, {0x114u, 161}, {0x115u, 162},
+  {0x116u, 163}, {0x118u, 149}, {0x119u, 164}, {0x11Au, 165}, {0x11Bu, 166}, {0x11Cu, 167},
+  {0x11Eu, 168}, {0x11Fu, 169}, {0x120u, 153}, {0x122u, 170}, {0x124u, 152}, {0x126u, 153},
+  {0x128u, 171}, {0x129u, 172}, {0x12Au, 173}, {0x12Bu, 174}, {0x12Cu, 0}, {0x12Eu, 175},
+  {0x130u, 168}, {0x131u, 176}, {0x132u, 0}, {0x134u, 152}, {0x136u, 170}, {0x137u, 177},
+  {0x138u, 0}, {0x139u, 178}, {0x13Bu, 179}, {0x13Du, 178}, {0x13Fu, 0}, {0x141u, 180},
+  {0x142u, 181}, {0x143u, 182}, {0x145u, 170}, {0x147u, 183}, {0x148u, 184}, {0x149u, 0},
+  {0x14Au, 185}, {0x14Bu, 186}, {0x14Cu, 187}, {0x14Du, 188}, {0x14Eu, 189}, {0x14Fu, 190},
+  {0x150u, 191}, {0x152u, 192}, {0x153u, 193}, {0x154u, 194}, {0x156u, 195}, {0x158u, 196},
+  {0x159u, 197}, {0x15Au, 198}, {0x15Bu, 199}, {0x15Cu, 152}, {0x15Eu, 200}, {0x15Fu, 201},
+  {0x160u, 202}, {0x161u, 203}, {0x162u, 0}, {0x163u, 204}, {0x164u, 156}, {0x166u, 205},
+  {0x168u, 206}, {0x169u, 207}, {0x16Au, 208}, {0x16Bu, 209}, {0x16Cu, 152}, {0x16Eu, 210},
+  {0x170u, 191}, {0x172u, 211}, {0x174u, 212}, {0x176u, 213}, {0x178u, 145}, {0x179u, 214},
+  {0x17Bu, 215}, {0x17Cu, 216}, {0x17Du, 217}, {0x17Eu, 218}, {0x17Fu, 0}, {0x181u, 219},
+  {0x182u, 0}, {0x186u, 220}, {0x187u, 0}, {0x189u, 221}, {0x18Au, 222}, {0x18Bu, 0},
+  {0x18Eu, 223}, {0x18Fu, 224}, {0x190u, 225}, {0x191u, 221}, {0x193u, 0}, {0x194u, 226},
+  {0x195u, 0}, {0x197u, 227}, {0x198u, 228}, {0x19Au, 0}, {0x19Du, 229}, {0x19Eu, 0},
+  {0x1A0u, 230}, {0x1A2u, 0}, {0x1AFu, 230}, {0x1B1u, 0}, {0x1B2u, 231}, {0x1B3u, 232},
+  {0x1B5u, 0}, {0x1B7u, 233}, {0x1B8u, 0}, {0x1C0u, 234}, {0x1C4u, 0}, {0x1CDu, 235},
+  {0x1CEu, 236}, {0x1CFu, 237}, {0x1D1u, 238}, {0x1D3u, 239}, {0x1D5u, 0}, {0x1DDu, 223},
+  {0x1DEu, 0}, {0x1E4u, 233}, {0x1E6u, 240}, {0x1E8u, 233}, {0x1EAu, 241}, {0x1ECu, 0},
+  {0x1EEu, 233}, {0x1F0u, 0}, {0x1F4u, 242}, {0x1F6u, 0}, {0x1F8u, 243}, {0x1FAu, 0},
+  {0x218u, 244}, {0x21Au, 245}, {0x21Cu, 0}, {0x21Eu, 246}, {0x220u, 0}, {0x22Fu, 247},
+  {0x230u, 0}, {0x244u, 248}, {0x245u, 0}, {0x253u, 219}, {0x254u, 220}, {0x255u, 0},
+  {0x256u, 221}, {0x257u, 222}, {0x258u, 0}, {0x259u, 224}, {0x25Au, 0}, {0x25Bu, 225},
+  {0x25Cu, 0}, {0x263u, 226}, {0x264u, 0}, {0x268u, 227}, {0x269u, 0}, {0x272u, 229},
+  {0x273u, 0}, {0x289u, 248}, {0x28Au, 0}, {0x28Bu, 231}, {0x28Cu, 0}, {0x292u, 233},
+  {0x293u, 0}, {0x294u, 249}, {0x295u, 0}, {0x2B7u, 250}, {0x2B8u, 0}, {0x2BBu, 251},
+  {0x2BCu, 252}, {0x2BDu, 0}, {0x2C0u, 253}, {0x2C1u, 0}, {0x2D0u, 253}, {0x2D1u, 0},
+  {0x300u, 254}, {0x301u, 255}, {0x302u, 256}, {0x303u, 257}, {0x304u, 258}, {0x305u, 0},
+  {0x309u, 230}, {0x30Au, 0}, {0x30Cu, 256}, {0x30Du, 0}, {0x321u, 258}, {0x322u, 0},
+  {0x323u, 230}, {0x324u, 0}, {0x37Bu, 259}, {0x37Cu, 0}, {0x384u, 260}, {0x385u, 0},
+  {0x386u, 260}, {0x387u, 0}, {0x388u, 260}, {0x38Bu, 0}, {0x38Cu, 260}, {0x38Du, 0},
+  {0x38Eu, 260}, {0x393u, 261}, {0x394u, 262}, {0x395u, 260}, {0x3A2u, 0}, {0x3A3u, 260},
+  {0x3AFu, 262}, {0x3B0u, 260}, {0x3B1u, 262}, {0x3B2u, 260}, {0x3B3u, 261}, {0x3B4u, 260},
+  {0x3B5u, 263}, {0x3B6u, 260}, {0x3B7u, 262}, {0x3B8u, 260}, {0x3B9u, 262}, {0x3BBu, 260},
+  {0x3BCu, 262}, {0x3BDu, 260}, {0x3BFu, 262}, {0x3C0u, 260}, {0x3C1u, 262}, {0x3C2u, 260},
+  {0x3C4u, 262}, {0x3C5u, 260}, {0x3CFu, 0}, {0x3E2u, 264}, {0x3F0u, 0}, {0x401u, 265},
+  {0x402u, 266}, {0x403u, 267}, {0x404u, 268}, {0x405u, 269}, {0x406u, 270}, {0x407u, 268},
+  {0x408u, 271}, {0x409u, 272}, {0x40Bu, 266}, {0x40Cu, 267}, {0x40Du, 0}, {0x40Eu, 273},
+  {0x40Fu, 274}, {0x410u, 275}, {0x412u, 276}, {0x413u, 275}, {0x415u, 277}, {0x418u, 278},
+  {0x419u, 279}, {0x41Au, 275}, {0x420u, 280}, {0x421u, 275}, {0x424u, 281}, {0x425u, 275},
+  {0x426u, 282}, {0x427u, 275}, {0x428u, 277}, {0x429u, 283}, {0x42Au, 284}, {0x42Bu, 285},
+  {0x42Cu, 286}, {0x42Du, 287}, {0x42Eu, 288}, {0x42Fu, 289}, {0x430u, 280}, {0x431u, 290},
+  {0x432u, 277}, {0x433u, 275}, {0x434u, 291}, {0x435u, 280}, {0x436u, 275}, {0x437u, 277},
+  {0x438u, 292}, {0x439u, 293}, {0x43Au, 280}, {0x43Bu, 290}, {0x43Cu, 275}, {0x43Eu, 291},
+  {0x43Fu, 290}, {0x440u, 291}, {0x441u, 280}, {0x442u, 275}, {0x443u, 290}, {0x444u, 275},
+  {0x446u, 294}, {0x447u, 275}, {0x448u, 277}, {0x449u, 283}, {0x44Au, 284}, {0x44Bu, 295},
+  {0x44Cu, 296}, {0x44Du, 297}, {0x44Eu, 288}, {0x44Fu, 298}, {0x450u, 0}, {0x451u, 299},
+  {0x452u, 266}, {0x453u, 267}, {0x454u, 268}, {0x455u, 269}, {0x456u, 270}, {0x457u, 268},
+  {0x458u, 271}, {0x459u, 272}, {0x45Bu, 266}, {0x45Cu, 267}, {0x45Du, 0}, {0x45Eu, 273},
+  {0x45Fu, 274}, {0x460u, 300}, {0x464u, 0}, {0x466u, 300}, {0x468u, 0}, {0x46Au, 300},
+  {0x46Cu, 0}, {0x46Eu, 300}, {0x478u, 0}, {0x47Au, 300}, {0x480u, 0}, {0x490u, 301},
+  {0x492u, 302}, {0x494u, 303}, {0x496u, 304}, {0x497u, 305}, {0x498u, 306}, {0x49Au, 307},
+  {0x49Cu, 308}, {0x49Eu, 309}, {0x4A0u, 306}, {0x4A2u, 310}, {0x4A4u, 303}, {0x4A6u, 0},
+  {0x4A8u, 309}, {0x4AAu, 311}, {0x4ACu, 309}, {0x4AEu, 312}, {0x4B0u, 313}, {0x4B2u, 314},
+  {0x4B4u, 309}, {0x4B6u, 315}, {0x4B8u, 308}, {0x4BAu, 316}, {0x4BCu, 309}, {0x4C0u, 317},
+  {0x4C1u, 0}, {0x4CFu, 317}, {0x4D0u, 318}, {0x4D2u, 0}, {0x4D4u, 319}, {0x4D6u, 318},
+  {0x4D8u, 320}, {0x4DAu, 0}, {0x4E0u, 309}, {0x4E2u, 321}, {0x4E4u, 0}, {0x4E8u, 312},
+  {0x4EAu, 0}, {0x4EEu, 321}, {0x4F0u, 0}, {0x4F2u, 318}, {0x4F4u, 0}, {0x4F6u, 309},
+  {0x4F8u, 0}, {0x524u, 309}, {0x526u, 0}, {0x531u, 322}, {0x557u, 0}, {0x55Bu, 322},
+  {0x55Cu, 0}, {0x55Du, 322}, {0x55Fu, 0}, {0x561u, 322}, {0x588u, 0}, {0x589u, 322},
+  {0x58Au, 0}, {0x5D0u, 323}, {0x5DFu, 324}, {0x5E1u, 323}, {0x5EAu, 324}, {0x5EBu, 0},
+  {0x5F2u, 325}, {0x5F3u, 0}, {0x60Cu, 326}, {0x60Du, 0}, {0x619u, 258}, {0x61Au, 0},
+  {0x61Bu, 327}, {0x61Cu, 0}, {0x61Fu, 328}, {0x620u, 258}, {0x621u, 329}, {0x622u, 330},
+  {0x623u, 331}, {0x624u, 332}, {0x625u, 333}, {0x626u, 334}, {0x627u, 335}, {0x629u, 336},
+  {0x62Au, 335}, {0x62Bu, 337}, {0x62Cu, 335}, {0x62Du, 338}, {0x62Eu, 339}, {0x62Fu, 334},
+  {0x630u, 340}, {0x631u, 335}, {0x632u, 334}, {0x635u, 337}, {0x639u, 341}, {0x63Au, 339},
+  {0x63Bu, 0}, {0x63Du, 342}, {0x63Eu, 0}, {0x640u, 343}, {0x641u, 339}, {0x643u, 344},
+  {0x644u, 335}, {0x645u, 334}, {0x647u, 345}, {0x648u, 335}, {0x649u, 346}, {0x64Au, 347},
+  {0x64Bu, 348}, {0x64Cu, 333}, {0x64Du, 258}, {0x64Eu, 349}, {0x64Fu, 350}, {0x650u, 349},
+  {0x651u, 351}, {0x652u, 352}, {0x653u, 80}, {0x654u, 258}, {0x658u, 0}, {0x65Au, 258},
+  {0x65Cu, 0}, {0x65Du, 258}, {0x65Eu, 0}, {0x660u, 353}, {0x661u, 354}, {0x663u, 0},
+  {0x666u, 354}, {0x667u, 0}, {0x669u, 354}, {0x66Au, 0}, {0x66Eu, 258}, {0x66Fu, 0},
+  {0x670u, 328}, {0x671u, 0}, {0x672u, 258}, {0x673u, 0}, {0x674u, 258}, {0x675u, 0},
+  {0x679u, 355}, {0x67Au, 356}, {0x67Cu, 357}, {0x67Du, 356}, {0x67Eu, 358}, {0x67Fu, 356},
+  {0x681u, 357}, {0x682u, 0}, {0x683u, 356}, {0x685u, 357}, {0x686u, 358}, {0x687u, 356},
+  {0x688u, 355}, {0x689u, 357}, {0x68Au, 356}, {0x68Bu, 0}, {0x68Cu, 356}, {0x68Eu, 0},
+  {0x68Fu, 356}, {0x690u, 0}, {0x691u, 355}, {0x692u, 0}, {0x693u, 357}, {0x694u, 0},
+  {0x695u, 359}, {0x696u, 357}, {0x697u, 0}, {0x698u, 360}, {0x699u, 356}, {0x69Au, 357},
+  {0x69Bu, 0}, {0x6A4u, 361}, {0x6A5u, 0}, {0x6A6u, 356}, {0x6A7u, 0}, {0x6A9u, 362},
+  {0x6AAu, 356}, {0x6ABu, 357}, {0x6ACu, 0}, {0x6ADu, 363}, {0x6AEu, 0}, {0x6AFu, 358},
+  {0x6B0u, 0}, {0x6B1u, 356}, {0x6B2u, 0}, {0x6B3u, 356}, {0x6B4u, 0}, {0x6B5u, 359},
+  {0x6B6u, 0}, {0x6BAu, 364}, {0x6BBu, 356}, {0x6BCu, 357}, {0x6BDu, 0}, {0x6BEu, 365},
+  {0x6BFu, 0}, {0x6C1u, 364}, {0x6C2u, 0}, {0x6C4u, 258}, {0x6C6u, 366}, {0x6C7u, 363},
+  {0x6C9u, 342}, {0x6CAu, 367}, {0x6CBu, 363}, {0x6CCu, 362}, {0x6CDu, 368}, {0x6CEu, 369},
+  {0x6CFu, 0}, {0x6D0u, 370}, {0x6D1u, 0}, {0x6D2u, 371}, {0x6D3u, 372}, {0x6D4u, 373},
+  {0x6D5u, 374}, {0x6D6u, 0}, {0x6EAu, 258}, {0x6EBu, 0}, {0x6EFu, 258}, {0x6F0u, 375},
+  {0x6F3u, 376}, {0x6F5u, 375}, {0x6FAu, 0}, {0x710u, 377}, {0x711u, 0}, {0x712u, 377},
+  {0x714u, 0}, {0x715u, 377}, {0x716u, 0}, {0x717u, 377}, {0x71Cu, 0}, {0x71Du, 377},
+  {0x71Eu, 0}, {0x71Fu, 377}, {0x724u, 0}, {0x725u, 377}, {0x727u, 0}, {0x728u, 377},
+  {0x72Du, 0}, {0x780u, 378}, {0x798u, 0}, {0x7CAu, 379}, {0x7D1u, 380}, {0x7D2u, 379},
+  {0x7E0u, 380}, {0x7E1u, 379}, {0x7E7u, 380}, {0x7E8u, 0}, {0x7F4u, 380}, {0x7F6u, 0},
+  {0x800u, 381}, {0x82Eu, 0}, {0x830u, 381}, {0x83Fu, 0}, {0x840u, 382}, {0x85Cu, 0},
+  {0x85Eu, 382}, {0x85Fu, 0}, {0x901u, 383}, {0x902u, 384}, {0x903u, 385}, {0x904u, 0},
+  {0x905u, 386}, {0x906u, 387}, {0x907u, 388}, {0x908u, 387}, {0x90Au, 389}, {0x90Bu, 390},
+  {0x90Cu, 391}, {0x90Du, 392}, {0x90Eu, 258}, {0x90Fu, 387}, {0x910u, 389}, {0x911u, 393},
+  {0x912u, 0}, {0x913u, 387}, {0x914u, 394}, {0x915u, 386}, {0x916u, 395}, {0x917u, 386},
+  {0x918u, 396}, {0x919u, 397}, {0x91Au, 386}, {0x91Bu, 395}, {0x91Cu, 386}, {0x91Du, 396},
+  {0x91Eu, 398}, {0x91Fu, 386}, {0x920u, 395}, {0x921u, 386}, {0x922u, 396}, {0x923u, 386},
+  {0x924u, 399}, {0x925u, 395}, {0x926u, 399}, {0x927u, 395}, {0x928u, 399}, {0x929u, 0},
+  {0x92Au, 399}, {0x92Bu, 395}, {0x92Cu, 386}, {0x92Du, 395}, {0x92Eu, 386}, {0x92Fu, 399},
+  {0x931u, 0}, {0x932u, 386}, {0x933u, 400}, {0x934u, 0}, {0x935u, 386}, {0x936u, 401},
+  {0x937u, 402}, {0x938u, 399}, {0x939u, 386}, {0x93Au, 0}, {0x93Cu, 403}, {0x93Du, 404},
+  {0x93Eu, 405}, {0x940u, 384}, {0x943u, 383}, {0x944u, 0}, {0x945u, 258}, {0x947u, 405},
+  {0x948u, 384}, {0x949u, 403}, {0x94Au, 258}, {0x94Bu, 384}, {0x94Du, 405}, {0x94Eu, 0},
+  {0x950u, 404}, {0x951u, 0}, {0x952u, 258}, {0x953u, 0}, {0x95Eu, 406}, {0x95Fu, 0},
+  {0x960u, 407}, {0x962u, 0}, {0x964u, 408}, {0x965u, 0}, {0x966u, 409}, {0x967u, 410},
+  {0x968u, 409}, {0x96Bu, 410}, {0x96Du, 409}, {0x96Eu, 410}, {0x96Fu, 409}, {0x970u, 258},
+  {0x971u, 0}, {0x981u, 411}, {0x984u, 0}, {0x985u, 412}, {0x98Cu, 0}, {0x98Fu, 412},
+  {0x991u, 0}, {0x993u, 412}, {0x9A9u, 0}, {0x9AAu, 412}, {0x9B0u, 413}, {0x9B1u, 0},
+  {0x9B2u, 412}, {0x9B3u, 0}, {0x9B6u, 412}, {0x9BAu, 0}, {0x9BCu, 411}, {0x9BDu, 0},
+  {0x9BEu, 411}, {0x9C4u, 0}, {0x9C7u, 411}, {0x9C9u, 0}, {0x9CBu, 411}, {0x9CFu, 0},
+  {0x9DCu, 414}, {0x9DEu, 0}, {0x9DFu, 414}, {0x9E0u, 0}, {0x9E6u, 411}, {0x9F0u, 415},
+  {0x9F1u, 416}, {0x9F2u, 0}, {0xA05u, 417}, {0xA0Bu, 0}, {0xA0Fu, 417}, {0xA11u, 0},
+  {0xA13u, 417}, {0xA29u, 0}, {0xA2Au, 417}, {0xA31u, 0}, {0xA32u, 417}, {0xA33u, 0},
+  {0xA35u, 417}, {0xA36u, 0}, {0xA38u, 417}, {0xA3Au, 0}, {0xA5Cu, 417}, {0xA5Du, 0},
+  {0xA72u, 417}, {0xA75u, 0}, {0xA85u, 418}, {0xA8Cu, 0}, {0xA8Du, 418}, {0xA8Eu, 0},
+  {0xA8Fu, 418}, {0xA92u, 0}, {0xA93u, 418}, {0xAA9u, 0}, {0xAAAu, 418}, {0xAB1u, 0},
+  {0xAB2u, 418}, {0xAB4u, 0}, {0xAB5u, 418}, {0xABAu, 0}, {0xABDu, 418}, {0xABEu, 0},
+  {0xAD0u, 418}, {0xAD1u, 0}, {0xAE0u, 418}, {0xAE1u, 0}, {0xB01u, 419}, {0xB04u, 0},
+  {0xB05u, 420}, {0xB0Bu, 419}, {0xB0Cu, 0}, {0xB0Fu, 420}, {0xB10u, 419}, {0xB11u, 0},
+  {0xB13u, 419}, {0xB15u, 420}, {0xB16u, 419}, {0xB17u, 420}, {0xB18u, 419}, {0xB19u, 420},
+  {0xB1Bu, 419}, {0xB1Cu, 420}, {0xB1Du, 419}, {0xB1Eu, 420}, {0xB20u, 419}, {0xB21u, 420},
+  {0xB22u, 419}, {0xB23u, 420}, {0xB25u, 419}, {0xB26u, 420}, {0xB27u, 419}, {0xB28u, 420},
+  {0xB29u, 0}, {0xB2Au, 420}, {0xB2Bu, 419}, {0xB2Cu, 420}, {0xB2Du, 419}, {0xB2Eu, 420},
+  {0xB2Fu, 419}, {0xB30u, 420}, {0xB31u, 0}, {0xB32u, 420}, {0xB34u, 0}, {0xB35u, 419},
+  {0xB38u, 420}, {0xB3Au, 0}, {0xB3Cu, 419}, {0xB3Du, 0}, {0xB3Eu, 419}, {0xB44u, 0},
+  {0xB47u, 419}, {0xB49u, 0}, {0xB4Bu, 419}, {0xB4Eu, 0}, {0xB5Fu, 420}, {0xB60u, 0},
+  {0xB66u, 419}, {0xB70u, 0}, {0xB71u, 420}, {0xB72u, 0}, {0xB83u, 421}, {0xB84u, 0},
+  {0xB85u, 421}, {0xB8Bu, 0}, {0xB8Eu, 421}, {0xB91u, 0}, {0xB92u, 421}, {0xB96u, 0},
+  {0xB99u, 421}, {0xB9Bu, 0}, {0xB9Cu, 421}, {0xB9Du, 0}, {0xB9Eu, 421}, {0xBA0u, 0},
+  {0xBA3u, 421}, {0xBA5u, 0}, {0xBA8u, 421}, {0xBABu, 0}, {0xBAEu, 421}, {0xBB6u, 0},
+  {0xBB7u, 421}, {0xBBAu, 0}, {0xBBEu, 421}, {0xBC3u, 0}, {0xBC6u, 421}, {0xBC9u, 0},
+  {0xBCAu, 421}, {0xBCCu, 0}, {0xBCDu, 421}, {0xBCEu, 0}, {0xC02u, 422}, {0xC03u, 0},
+  {0xC05u, 422}, {0xC0Du, 0}, {0xC0Eu, 422}, {0xC11u, 0}, {0xC12u, 422}, {0xC29u, 0},
+  {0xC2Au, 422}, {0xC34u, 0}, {0xC35u, 422}, {0xC3Au, 0}, {0xC3Eu, 422}, {0xC44u, 0},
+  {0xC46u, 422}, {0xC49u, 0}, {0xC4Au, 422}, {0xC4Cu, 0}, {0xC4Du, 422}, {0xC4Eu, 0},
+  {0xC60u, 422}, {0xC62u, 0}, {0xC82u, 423}, {0xC84u, 0}, {0xC85u, 423}, {0xC8Du, 0},
+  {0xC8Eu, 423}, {0xC91u, 0}, {0xC92u, 423}, {0xCA9u, 0}, {0xCAAu, 423}, {0xCB4u, 0},
+  {0xCB5u, 423}, {0xCBAu, 0}, {0xCBDu, 423}, {0xCC4u, 0}, {0xCC6u, 423}, {0xCC9u, 0},
+  {0xCCAu, 423}, {0xCCEu, 0}, {0xCE0u, 423}, {0xCE2u, 0}, {0xCE6u, 423}, {0xCF0u, 0},
+  {0xD02u, 424}, {0xD03u, 0}, {0xD05u, 424}, {0xD0Cu, 0}, {0xD0Eu, 424}, {0xD11u, 0},
+  {0xD12u, 424}, {0xD29u, 0}, {0xD2Au, 424}, {0xD3Au, 0}, {0xD3Eu, 424}, {0xD44u, 0},
+  {0xD46u, 424}, {0xD49u, 0}, {0xD4Au, 424}, {0xD4Cu, 0}, {0xD4Du, 424}, {0xD4Eu, 0},
+  {0xD7Au, 424}, {0xD7Fu, 0}, {0xD82u, 425}, {0xD83u, 0}, {0xD85u, 425}, {0xD8Eu, 0},
+  {0xD91u, 425}, {0xD97u, 0}, {0xD9Au, 425}, {0xDA6u, 0}, {0xDA7u, 425}, {0xDB2u, 0},
+  {0xDB3u, 425}, {0xDBCu, 0}, {0xDBDu, 425}, {0xDBEu, 0}, {0xDC0u, 425}, {0xDC7u, 0},
+  {0xDCAu, 425}, {0xDCBu, 0}, {0xDCFu, 425}, {0xDD5u, 0}, {0xDD6u, 425}, {0xDD7u, 0},
+  {0xDD8u, 425}, {0xDDFu, 0}, {0xE01u, 426}, {0xE07u, 427}, {0xE08u, 426}, {0xE19u, 427},
+  {0xE1Au, 426}, {0xE23u, 427}, {0xE24u, 426}, {0xE2Du, 427}, {0xE2Eu, 426}, {0xE30u, 427},
+  {0xE31u, 426}, {0xE3Au, 0}, {0xE40u, 426}, {0xE4Au, 0}, {0xE4Cu, 426}, {0xE4Du, 0},
+  {0xE50u, 426}, {0xE51u, 0}, {0xE81u, 428}, {0xE83u, 0}, {0xE84u, 428}, {0xE85u, 0},
+  {0xE87u, 428}, {0xE89u, 0}, {0xE8Au, 428}, {0xE8Bu, 0}, {0xE8Du, 428}, {0xE8Eu, 0},
+  {0xE94u, 428}, {0xE98u, 0}, {0xE99u, 428}, {0xEA0u, 0}, {0xEA1u, 428}, {0xEA4u, 0},
+  {0xEA5u, 428}, {0xEA6u, 0}, {0xEA7u, 428}, {0xEA8u, 0}, {0xEAAu, 428}, {0xEACu, 0},
+  {0xEADu, 428}, {0xEBAu, 0}, {0xEBBu, 428}, {0xEBEu, 0}, {0xEC0u, 428}, {0xEC5u, 0},
+  {0xEC6u, 428}, {0xEC7u, 0}, {0xEC8u, 428}, {0xECAu, 0}, {0xECDu, 428}, {0xECEu, 0},
+  {0xEDCu, 428}, {0xEDEu, 0}, {0xF0Bu, 107}, {0xF0Fu, 0}, {0xF20u, 107}, {0xF2Au, 0},
+  {0xF32u, 107}, {0xF33u, 0}, {0xF3Cu, 107}, {0xF3Eu, 0}, {0xF40u, 429}, {0xF43u, 0},
+  {0xF44u, 429}, {0xF48u, 0}, {0xF49u, 429}, {0xF4Au, 107}, {0xF4Du, 0}, {0xF4Eu, 107},
+  {0xF4Fu, 429}, {0xF52u, 0}, {0xF53u, 429}, {0xF57u, 0}, {0xF58u, 429}, {0xF5Cu, 0},
+  {0xF5Du, 429}, {0xF65u, 107}, {0xF66u, 429}, {0xF69u, 0}, {0xF6Au, 107}, {0xF6Bu, 0},
+  {0xF71u, 107}, {0xF73u, 0}, {0xF74u, 107}, {0xF75u, 0}, {0xF7Au, 107}, {0xF7Bu, 0},
+  {0xF7Cu, 107}, {0xF7Du, 0}, {0xF90u, 107}, {0xF91u, 0}, {0xF92u, 107}, {0xF93u, 0},
+  {0xF94u, 107}, {0xF96u, 0}, {0xF97u, 107}, {0xF98u, 0}, {0xF99u, 107}, {0xF9Au, 0},
+  {0xF9Fu, 107}, {0xFA0u, 0}, {0xFA1u, 107}, {0xFA2u, 0}, {0xFA3u, 107}, {0xFA7u, 0},
+  {0xFA8u, 107}, {0xFAAu, 0}, {0xFABu, 107}, {0xFACu, 0}, {0xFADu, 107}, {0xFAEu, 0},
+  {0xFB1u, 107}, {0xFB4u, 0}, {0xFB7u, 107}, {0xFB8u, 0}, {0x1000u, 430}, {0x1022u, 0},
+  {0x1023u, 430}, {0x1028u, 0}, {0x1029u, 430}, {0x1034u, 0}, {0x1036u, 430}, {0x104Eu, 0},
+  {0x104Fu, 430}, {0x1050u, 0}, {0x105Au, 430}, {0x105Bu, 0}, {0x1061u, 430}, {0x1062u, 0},
+  {0x1064u, 430}, {0x1065u, 0}, {0x107Cu, 430}, {0x107Du, 0}, {0x107Eu, 430}, {0x1080u, 0},
+  {0x108Fu, 430}, {0x1090u, 0}, {0x1094u, 430}, {0x1096u, 0}, {0x10D0u, 431}, {0x10F4u, 0},
+  {0x1200u, 432}, {0x1207u, 433}, {0x1208u, 432}, {0x120Fu, 434}, {0x1210u, 432}, {0x1217u, 434},
+  {0x1218u, 432}, {0x121Fu, 434}, {0x1220u, 435}, {0x1227u, 436}, {0x1228u, 432}, {0x122Fu, 434},
+  {0x1230u, 432}, {0x1237u, 434}, {0x1240u, 432}, {0x1247u, 433}, {0x1248u, 432}, {0x1249u, 0},
+  {0x124Au, 432}, {0x124Eu, 0}, {0x1250u, 437}, {0x1257u, 0}, {0x1258u, 437}, {0x1259u, 0},
+  {0x125Au, 437}, {0x125Eu, 0}, {0x1260u, 432}, {0x1267u, 434}, {0x1270u, 432}, {0x1277u, 434},
+  {0x1280u, 432}, {0x1287u, 433}, {0x1288u, 432}, {0x1289u, 0}, {0x128Au, 432}, {0x128Eu, 0},
+  {0x1290u, 432}, {0x1297u, 434}, {0x12A0u, 432}, {0x12A7u, 434}, {0x12A8u, 432}, {0x12AFu, 433},
+  {0x12B0u, 432}, {0x12B1u, 0}, {0x12B2u, 432}, {0x12B6u, 0}, {0x12B8u, 434}, {0x12BFu, 0},
+  {0x12C0u, 437}, {0x12C1u, 0}, {0x12C2u, 437}, {0x12C6u, 0}, {0x12C8u, 432}, {0x12CFu, 433},
+  {0x12D0u, 432}, {0x12D7u, 0}, {0x12D8u, 432}, {0x12DFu, 434}, {0x12E8u, 432}, {0x12EFu, 433},
+  {0x12F0u, 432}, {0x12F7u, 434}, {0x12F8u, 433}, {0x1300u, 434}, {0x1308u, 432}, {0x130Fu, 433},
+  {0x1310u, 432}, {0x1311u, 0}, {0x1312u, 432}, {0x1316u, 0}, {0x1318u, 438}, {0x1320u, 432},
+  {0x1327u, 434}, {0x1330u, 435}, {0x1337u, 436}, {0x1338u, 432}, {0x133Fu, 434}, {0x1340u, 435},
+  {0x1347u, 439}, {0x1348u, 432}, {0x134Fu, 434}, {0x1350u, 432}, {0x1357u, 434}, {0x1358u, 433},
+  {0x135Bu, 0}, {0x1361u, 440}, {0x1365u, 441}, {0x1366u, 442}, {0x1367u, 0}, {0x1369u, 442},
+  {0x136Cu, 0}, {0x1380u, 433}, {0x1390u, 0}, {0x13A0u, 443}, {0x13F5u, 0}, {0x13F8u, 443},
+  {0x13FDu, 0}, {0x1401u, 444}, {0x1402u, 0}, {0x1403u, 445}, {0x1407u, 0}, {0x140Au, 445},
+  {0x140Cu, 0}, {0x140Du, 444}, {0x140Eu, 0}, {0x140Fu, 444}, {0x1410u, 0}, {0x1411u, 444},
+  {0x1412u, 0}, {0x1413u, 444}, {0x1414u, 0}, {0x1415u, 444}, {0x1416u, 0}, {0x1418u, 444},
+  {0x1419u, 0}, {0x141Au, 444}, {0x141Bu, 0}, {0x141Fu, 444}, {0x1421u, 0}, {0x1422u, 444},
+  {0x1425u, 0}, {0x1426u, 444}, {0x1427u, 0}, {0x1428u, 444}, {0x1429u, 0}, {0x142Fu, 444},
+  {0x1430u, 0}, {0x1431u, 445}, {0x1435u, 0}, {0x1438u, 445}, {0x143Au, 0}, {0x1449u, 446},
+  {0x144Au, 444}, {0x144Bu, 0}, {0x144Cu, 444}, {0x144Du, 0}, {0x144Eu, 445}, {0x1452u, 0},
+  {0x1455u, 445}, {0x1457u, 0}, {0x1466u, 446}, {0x1467u, 0}, {0x146Bu, 444}, {0x146Cu, 0},
+  {0x146Du, 445}, {0x1471u, 0}, {0x1472u, 445}, {0x1474u, 0}, {0x1483u, 446}, {0x1484u, 0},
+  {0x1489u, 444}, {0x148Au, 0}, {0x148Bu, 445}, {0x148Fu, 0}, {0x1490u, 445}, {0x1492u, 0},
+  {0x14A1u, 446}, {0x14A2u, 0}, {0x14A3u, 444}, {0x14A4u, 0}, {0x14A5u, 445}, {0x14A9u, 0},
+  {0x14AAu, 445}, {0x14ACu, 0}, {0x14BBu, 446}, {0x14BCu, 444}, {0x14BDu, 0}, {0x14C0u, 444},
+  {0x14C1u, 0}, {0x14C2u, 445}, {0x14C6u, 0}, {0x14C7u, 445}, {0x14C9u, 0}, {0x14D0u, 446},
+  {0x14D1u, 0}, {0x14D3u, 444}, {0x14D4u, 0}, {0x14D5u, 445}, {0x14D9u, 0}, {0x14DAu, 445},
+  {0x14DCu, 0}, {0x14EAu, 446}, {0x14EBu, 444}, {0x14ECu, 0}, {0x14EDu, 444}, {0x14EEu, 0},
+  {0x14EFu, 445}, {0x14F3u, 0}, {0x14F4u, 445}, {0x14F6u, 0}, {0x1505u, 446}, {0x1506u, 0},
+  {0x1526u, 444}, {0x1527u, 0}, {0x1528u, 445}, {0x152Cu, 0}, {0x152Du, 445}, {0x152Fu, 0},
+  {0x153Eu, 446}, {0x153Fu, 0}, {0x1540u, 444}, {0x1541u, 0}, {0x1543u, 444}, {0x1544u, 0},
+  {0x1546u, 445}, {0x154Au, 0}, {0x154Bu, 445}, {0x154Du, 0}, {0x1550u, 446}, {0x1551u, 444},
+  {0x1552u, 0}, {0x1555u, 446}, {0x155Bu, 0}, {0x155Du, 446}, {0x155Eu, 0}, {0x157Du, 444},
+  {0x157Eu, 0}, {0x157Fu, 446}, {0x1584u, 0}, {0x1585u, 446}, {0x1586u, 0}, {0x158Fu, 446},
+  {0x1590u, 0}, {0x1591u, 446}, {0x1597u, 0}, {0x15A0u, 446}, {0x15A7u, 0}, {0x1671u, 446},
+  {0x1677u, 0}, {0x1700u, 447}, {0x170Du, 0}, {0x170Eu, 447}, {0x1715u, 0}, {0x1720u, 448},
+  {0x1737u, 0}, {0x1740u, 449}, {0x1754u, 0}, {0x1760u, 450}, {0x176Du, 0}, {0x176Eu, 450},
+  {0x1771u, 0}, {0x1772u, 450}, {0x1774u, 0}, {0x1780u, 451}, {0x179Du, 0}, {0x179Fu, 451},
+  {0x17A4u, 0}, {0x17A5u, 451}, {0x17A8u, 0}, {0x17A9u, 451}, {0x17B4u, 0}, {0x17B6u, 451},
+  {0x17CEu, 0}, {0x17CFu, 451}, {0x17D1u, 0}, {0x17D2u, 451}, {0x17D3u, 0}, {0x17D4u, 451},
+  {0x17D5u, 0}, {0x17D6u, 451}, {0x17D8u, 0}, {0x17E0u, 451}, {0x17EAu, 0}, {0x1820u, 452},
+  {0x1843u, 0}, {0x1900u, 453}, {0x191Fu, 0}, {0x1920u, 453}, {0x192Cu, 0}, {0x1940u, 453},
+  {0x1941u, 0}, {0x1A00u, 454}, {0x1A1Cu, 0}, {0x1A1Eu, 454}, {0x1A20u, 0}, {0x1B00u, 455},
+  {0x1B4Cu, 0}, {0x1BC0u, 456}, {0x1BF4u, 0}, {0x1C00u, 457}, {0x1C38u, 0}, {0x1C4Du, 457},
+  {0x1C50u, 0}, {0x1C5Au, 458}, {0x1C7Eu, 0}, {0x1E0Cu, 459}, {0x1E0Du, 460}, {0x1E0Eu, 0},
+  {0x1E10u, 195}, {0x1E12u, 461}, {0x1E14u, 0}, {0x1E24u, 462}, {0x1E26u, 0}, {0x1E36u, 463},
+  {0x1E38u, 0}, {0x1E3Au, 464}, {0x1E3Cu, 461}, {0x1E3Eu, 465}, {0x1E40u, 0}, {0x1E44u, 466},
+  {0x1E45u, 467}, {0x1E46u, 0}, {0x1E48u, 464}, {0x1E4Au, 461}, {0x1E4Cu, 0}, {0x1E5Au, 468},
+  {0x1E5Cu, 0}, {0x1E62u, 469}, {0x1E64u, 0}, {0x1E6Cu, 468}, {0x1E6Du, 470}, {0x1E6Eu, 464},
+  {0x1E70u, 461}, {0x1E72u, 0}, {0x1E7Cu, 471}, {0x1E7Eu, 0}, {0x1E80u, 213}, {0x1E84u, 472},
+  {0x1E86u, 0}, {0x1E92u, 473}, {0x1E94u, 0}, {0x1EA1u, 474}, {0x1EA2u, 0}, {0x1EA3u, 230},
+  {0x1EA4u, 0}, {0x1EA5u, 230}, {0x1EA6u, 0}, {0x1EA7u, 230}, {0x1EA8u, 0}, {0x1EA9u, 230},
+  {0x1EAAu, 0}, {0x1EABu, 230}, {0x1EACu, 0}, {0x1EADu, 230}, {0x1EAEu, 0}, {0x1EAFu, 230},
+  {0x1EB0u, 0}, {0x1EB1u, 230}, {0x1EB2u, 0}, {0x1EB3u, 230}, {0x1EB4u, 0}, {0x1EB5u, 230},
+  {0x1EB6u, 0}, {0x1EB7u, 230}, {0x1EB8u, 475}, {0x1EB9u, 476}, {0x1EBAu, 0}, {0x1EBBu, 230},
+  {0x1EBCu, 477}, {0x1EBDu, 478}, {0x1EBEu, 0}, {0x1EBFu, 230}, {0x1EC0u, 0}, {0x1EC1u, 230},
+  {0x1EC2u, 0}, {0x1EC3u, 230}, {0x1EC4u, 0}, {0x1EC5u, 230}, {0x1EC6u, 0}, {0x1EC7u, 230},
+  {0x1EC8u, 0}, {0x1EC9u, 230}, {0x1ECAu, 247}, {0x1ECBu, 474}, {0x1ECCu, 475}, {0x1ECDu, 476},
+  {0x1ECEu, 0}, {0x1ECFu, 230}, {0x1ED0u, 0}, {0x1ED1u, 230}, {0x1ED2u, 0}, {0x1ED3u, 230},
+  {0x1ED4u, 0}, {0x1ED5u, 230}, {0x1ED6u, 0}, {0x1ED7u, 230}, {0x1ED8u, 0}, {0x1ED9u, 230},
+  {0x1EDAu, 0}, {0x1EDBu, 230}, {0x1EDCu, 0}, {0x1EDDu, 230}, {0x1EDEu, 0}, {0x1EDFu, 230},
+  {0x1EE0u, 0}, {0x1EE1u, 230}, {0x1EE2u, 0}, {0x1EE3u, 230}, {0x1EE4u, 247}, {0x1EE5u, 474},
+  {0x1EE6u, 0}, {0x1EE7u, 230}, {0x1EE8u, 0}, {0x1EE9u, 230}, {0x1EEAu, 0}, {0x1EEBu, 230},
+  {0x1EECu, 0}, {0x1EEDu, 230}, {0x1EEEu, 0}, {0x1EEFu, 230}, {0x1EF0u, 0}, {0x1EF1u, 230},
+  {0x1EF2u, 213}, {0x1EF3u, 479}, {0x1EF4u, 0}, {0x1EF7u, 230}, {0x1EF8u, 480}, {0x1EF9u, 481},
+  {0x1EFAu, 0}, {0x200Bu, 482}, {0x200Cu, 483}, {0x200Du, 484}, {0x200Eu, 0}, {0x2013u, 485},
+  {0x2014u, 0}, {0x2018u, 486}, {0x2019u, 487}, {0x201Au, 0}, {0x201Du, 79}, {0x201Eu, 0},
+  {0x2122u, 488}, {0x2123u, 0}, {0x2C80u, 264}, {0x2CB2u, 0}, {0x2D80u, 433}, {0x2D93u, 438},
+  {0x2D97u, 0}, {0x2DA0u, 433}, {0x2DA7u, 0}, {0x2DA8u, 433}, {0x2DAFu, 0}, {0x2DB0u, 433},
+  {0x2DB7u, 0}, {0x2DB8u, 433}, {0x2DBFu, 0}, {0x2DC0u, 433}, {0x2DC7u, 0}, {0x2DC8u, 433},
+  {0x2DCFu, 0}, {0x2DD0u, 433}, {0x2DD7u, 0}, {0x2DD8u, 433}, {0x2DDFu, 0}, {0x2E2Fu, 300},
+  {0x2E30u, 0}, {0x3001u, 489}, {0x3002u, 490}, {0x3003u, 0}, {0x3005u, 491}, {0x3006u, 0},
+  {0x300Cu, 491}, {0x300Eu, 0}, {0x3041u, 491}, {0x3094u, 0}, {0x309Du, 491}, {0x309Fu, 0},
+  {0x30A1u, 491}, {0x30F7u, 0}, {0x30FCu, 491}, {0x30FFu, 0}, {0x3131u, 492}, {0x3132u, 0},
+  {0x3134u, 492}, {0x3135u, 0}, {0x3137u, 492}, {0x3138u, 0}, {0x3139u, 492}, {0x313Au, 0},
+  {0x3141u, 492}, {0x3143u, 0}, {0x3145u, 492}, {0x3146u, 0}, {0x3147u, 492}, {0x3149u, 0},
+  {0x314Au, 492}, {0x3150u, 0}, {0x3151u, 492}, {0x3152u, 0}, {0x3153u, 492}, {0x3154u, 0},
+  {0x3155u, 492}, {0x3156u, 0}, {0x3157u, 492}, {0x3158u, 0}, {0x315Bu, 492}, {0x315Du, 0},
+  {0x3160u, 492}, {0x3162u, 0}, {0x3163u, 492}, {0x3164u, 0}, {0x4E00u, 493}, {0x4E02u, 0},
+  {0x4E03u, 493}, {0x4E04u, 0}, {0x4E07u, 493}, {0x4E0Cu, 494}, {0x4E0Du, 493}, {0x4E0Fu, 0},
+  {0x4E11u, 494}, {0x4E12u, 0}, {0x4E13u, 494}, {0x4E14u, 493}, {0x4E15u, 0}, {0x4E16u, 493},
+  {0x4E17u, 0}, {0x4E18u, 493}, {0x4E1Au, 494}, {0x4E1Bu, 0}, {0x4E1Cu, 494}, {0x4E1Eu, 0},
+  {0x4E1Fu, 495}, {0x4E20u, 0}, {0x4E21u, 491}, {0x4E22u, 494}, {0x4E23u, 0}, {0x4E24u, 494},
+  {0x4E26u, 490}, {0x4E27u, 494}, {0x4E28u, 0}, {0x4E2Au, 494}, {0x4E2Bu, 0}, {0x4E2Du, 493},
+  {0x4E2Eu, 0}, {0x4E30u, 494}, {0x4E31u, 0}, {0x4E32u, 493}, {0x4E33u, 0}, {0x4E34u, 494},
+  {0x4E35u, 0}, {0x4E38u, 493}, {0x4E3Au, 494}, {0x4E3Bu, 493}, {0x4E3Cu, 491}, {0x4E3Du, 494},
+  {0x4E3Fu, 0}, {0x4E43u, 494}, {0x4E44u, 0}, {0x4E45u, 493}, {0x4E46u, 0}, {0x4E48u, 494},
+  {0x4E4Au, 0}, {0x4E4Bu, 494}, {0x4E4Fu, 493}, {0x4E50u, 494}, {0x4E51u, 0}, {0x4E54u, 494},
+  {0x4E55u, 0}, {0x4E56u, 494}, {0x4E57u, 491}, {0x4E58u, 494}, {0x4E59u, 493}, {0x4E5Au, 0},
+  {0x4E5Du, 493}, {0x4E5Eu, 491}, {0x4E5Fu, 493}, {0x4E60u, 494}, {0x4E62u, 0}, {0x4E66u, 494},
+  {0x4E67u, 0}, {0x4E70u, 494}, {0x4E71u, 493}, {0x4E72u, 0}, {0x4E73u, 491}, {0x4E74u, 0},
+  {0x4E7Eu, 493}, {0x4E7Fu, 0}, {0x4E80u, 491}, {0x4E81u, 0}, {0x4E82u, 495}, {0x4E83u, 0},
+  {0x4E86u, 493}, {0x4E87u, 0}, {0x4E88u, 493}, {0x4E8Au, 0}, {0x4E8Bu, 493}, {0x4E8Du, 0},
+  {0x4E8Eu, 494}, {0x4E90u, 0}, {0x4E91u, 494}, {0x4E92u, 493}, {0x4E93u, 0}, {0x4E94u, 493},
+  {0x4E96u, 0}, {0x4E9Au, 494}, {0x4E9Cu, 491}, {0x4E9Du, 0}, {0x4E9Eu, 495}, {0x4E9Fu, 0},
+  {0x4EA1u, 493}, {0x4EA2u, 0}, {0x4EA4u, 493}, {0x4EA5u, 494}, {0x4EA9u, 0}, {0x4EABu, 493},
+  {0x4EADu, 491}, {0x4EAEu, 494}, {0x4EAFu, 0}, {0x4EB2u, 494}, {0x4EB3u, 0}, {0x4EBAu, 493},
+  {0x4EBBu, 0}, {0x4EBFu, 494}, {0x4EC1u, 493}, {0x4EC2u, 0}, {0x4EC5u, 494}, {0x4EC6u, 0},
+  {0x4EC7u, 494}, {0x4EC8u, 0}, {0x4ECAu, 493}, {0x4ECCu, 0}, {0x4ECDu, 494}, {0x4ECFu, 491},
+  {0x4ED0u, 0}, {0x4ED4u, 494}, {0x4ED5u, 491}, {0x4ED6u, 493}, {0x4ED7u, 0}, {0x4ED8u, 493},
+  {0x4EDAu, 0}, {0x4EE3u, 493}, {0x4EE6u, 0}, {0x4EEAu, 494}, {0x4EEBu, 0}, {0x4EECu, 494},
+  {0x4EEDu, 0}, {0x4EEEu, 491}, {0x4EEFu, 0}, {0x4EF0u, 493}, {0x4EF1u, 0}, {0x4EF2u, 493},
+  {0x4EF3u, 0}, {0x4EF6u, 493}, {0x4EF7u, 494}, {0x4EF8u, 0}, {0x4EFBu, 493}, {0x4EFCu, 0},
+  {0x4EFDu, 494}, {0x4EFEu, 0}, {0x4EFFu, 494}, {0x4F00u, 0}, {0x4F01u, 493}, {0x4F02u, 0},
+  {0x4F0Au, 494}, {0x4F0Bu, 0}, {0x4F0Du, 494}, {0x4F0Eu, 491}, {0x4F0Fu, 493}, {0x4F12u, 0},
+  {0x4F17u, 494}, {0x4F1Au, 493}, {0x4F1Bu, 0}, {0x4F1Du, 491}, {0x4F1Eu, 0}, {0x4F1Fu, 494},
+  {0x4F21u, 0}, {0x4F24u, 494}, {0x4F25u, 0}, {0x4F26u, 494}, {0x4F27u, 0}, {0x4F2Fu, 493},
+  {0x4F30u, 494}, {0x4F31u, 0}, {0x4F34u, 493}, {0x4F35u, 0}, {0x4F38u, 493}, {0x4F39u, 0},
+  {0x4F3Au, 491}, {0x4F3Bu, 0}, {0x4F3Cu, 493}, {0x4F3Du, 494}, {0x4F3Eu, 0}, {0x4F46u, 493},
+  {0x4F47u, 0}, {0x4F48u, 495}, {0x4F4Au, 0}, {0x4F4Du, 493}, {0x4F51u, 494}, {0x4F52u, 0},
+  {0x4F53u, 493}, {0x4F54u, 495}, {0x4F55u, 493}, {0x4F56u, 0}, {0x4F59u, 493}, {0x4F5Au, 0},
+  {0x4F5Bu, 494}, {0x4F5Cu, 493}, {0x4F5Du, 0}, {0x4F60u, 494}, {0x4F61u, 0}, {0x4F64u, 494},
+  {0x4F65u, 0}, {0x4F69u, 494}, {0x4F6Au, 0}, {0x4F73u, 493}, {0x4F74u, 0}, {0x4F75u, 491},
+  {0x4F76u, 0}, {0x4F7Fu, 493}, {0x4F80u, 0}, {0x4F86u, 495}, {0x4F87u, 0}, {0x4F8Bu, 493},
+  {0x4F8Cu, 0}, {0x4F8Du, 491}, {0x4F8Eu, 0}, {0x4F9Bu, 493}, {0x4F9Cu, 0}, {0x4F9Du, 493},
+  {0x4F9Eu, 0}, {0x4FA0u, 494}, {0x4FA1u, 491}, {0x4FA2u, 0}, {0x4FA6u, 494}, {0x4FA9u, 0},
+  {0x4FACu, 494}, {0x4FADu, 0}, {0x4FAEu, 491}, {0x4FAFu, 493}, {0x4FB0u, 0}, {0x4FB5u, 493},
+  {0x4FB6u, 491}, {0x4FB7u, 0}, {0x4FBFu, 493}, {0x4FC0u, 0}, {0x4FC2u, 490}, {0x4FC3u, 493},
+  {0x4FC4u, 494}, {0x4FC5u, 0}, {0x4FCAu, 493}, {0x4FCBu, 0}, {0x4FD7u, 493}, {0x4FD8u, 0},
+  {0x4FDDu, 493}, {0x4FDEu, 0}, {0x4FE0u, 495}, {0x4FE1u, 493}, {0x4FE2u, 0}, {0x4FE9u, 494},
+  {0x4FEAu, 0}, {0x4FEEu, 493}, {0x4FEFu, 0}, {0x4FF1u, 494}, {0x4FF2u, 0}, {0x4FF3u, 491},
+  {0x4FF4u, 0}, {0x4FF5u, 491}, {0x4FF6u, 0}, {0x4FF8u, 491}, {0x4FF9u, 0}, {0x4FFAu, 491},
+  {0x4FFBu, 0}, {0x4FFEu, 494}, {0x4FFFu, 0}, {0x5009u, 491}, {0x500Au, 0}, {0x500Bu, 490},
+  {0x500Cu, 0}, {0x500Du, 493}, {0x500Eu, 0}, {0x5011u, 495}, {0x5012u, 493}, {0x5013u, 0},
+  {0x5019u, 493}, {0x501Au, 494}, {0x501Bu, 0}, {0x501Fu, 493}, {0x5020u, 0}, {0x5023u, 491},
+  {0x5025u, 0}, {0x5026u, 494}, {0x5027u, 0}, {0x502Bu, 490}, {0x502Cu, 0}, {0x5039u, 491},
+  {0x503Au, 0}, {0x503Cu, 494}, {0x503Du, 0}, {0x503Eu, 494}, {0x503Fu, 0}, {0x5047u, 494},
+  {0x5048u, 0}, {0x5049u, 490}, {0x504Au, 0}, {0x504Cu, 494}, {0x504Du, 0}, {0x504Fu, 493},
+  {0x5050u, 0}, {0x505Au, 494}, {0x505Bu, 0}, {0x505Cu, 493}, {0x505Du, 0}, {0x5065u, 493},
+  {0x5066u, 0}, {0x5074u, 490}, {0x5076u, 493}, {0x5077u, 494}, {0x5078u, 0}, {0x507Du, 491},
+  {0x507Eu, 0}, {0x508Du, 491}, {0x508Eu, 0}, {0x5091u, 490}, {0x5092u, 0}, {0x5098u, 491},
+  {0x5099u, 490}, {0x509Au, 0}, {0x50A2u, 495}, {0x50A4u, 0}, {0x50A8u, 494}, {0x50A9u, 0},
+  {0x50ACu, 493}, {0x50ADu, 0}, {0x50B2u, 493}, {0x50B3u, 495}, {0x50B4u, 0}, {0x50B5u, 491},
+  {0x50B6u, 0}, {0x50B7u, 493}, {0x50B8u, 0}, {0x50BBu, 494}, {0x50BCu, 0}, {0x50BEu, 490},
+  {0x50BFu, 0}, {0x50C5u, 490}, {0x50C6u, 0}, {0x50CDu, 491}, {0x50CEu, 0}, {0x50CFu, 493},
+  {0x50D0u, 0}, {0x50D1u, 495}, {0x50D2u, 0}, {0x50D5u, 491}, {0x50D6u, 0}, {0x50DAu, 491},
+  {0x50DBu, 0}, {0x50E7u, 493}, {0x50E8u, 0}, {0x50F9u, 495}, {0x50FAu, 0}, {0x5100u, 490},
+  {0x5101u, 0}, {0x5104u, 490}, {0x5105u, 0}, {0x5112u, 493}, {0x5113u, 0}, {0x5118u, 495},
+  {0x5119u, 0}, {0x511Fu, 491}, {0x5120u, 0}, {0x512Au, 490}, {0x512Bu, 0}, {0x513Fu, 494},
+  {0x5140u, 0}, {0x5141u, 494}, {0x5142u, 0}, {0x5143u, 496}, {0x5144u, 493}, {0x5147u, 495},
+  {0x5148u, 493}, {0x514Au, 0}, {0x514Bu, 493}, {0x514Cu, 0}, {0x514Du, 493}, {0x514Eu, 0},
+  {0x5150u, 491}, {0x5151u, 494}, {0x5152u, 495}, {0x5153u, 0}, {0x5154u, 494}, {0x5155u, 0},
+  {0x515Au, 493}, {0x515Bu, 0}, {0x5165u, 493}, {0x5166u, 0}, {0x5167u, 495}, {0x5168u, 493},
+  {0x5169u, 495}, {0x516Au, 0}, {0x516Bu, 493}, {0x516Eu, 494}, {0x516Fu, 0}, {0x5170u, 494},
+  {0x5171u, 493}, {0x5172u, 0}, {0x5173u, 494}, {0x5175u, 493}, {0x5176u, 494}, {0x5177u, 493},
+  {0x5179u, 494}, {0x517Au, 0}, {0x517Bu, 494}, {0x517Cu, 493}, {0x517Du, 494}, {0x517Eu, 0},
+  {0x5185u, 493}, {0x5186u, 491}, {0x5187u, 0}, {0x5188u, 494}, {0x5189u, 0}, {0x518Au, 490},
+  {0x518Bu, 0}, {0x518Cu, 494}, {0x518Du, 493}, {0x518Eu, 0}, {0x5192u, 493}, {0x5193u, 0},
+  {0x5197u, 491}, {0x5198u, 0}, {0x5199u, 493}, {0x519Au, 0}, {0x519Bu, 494}, {0x519Du, 0},
+  {0x51A0u, 493}, {0x51A1u, 0}, {0x51A5u, 491}, {0x51A6u, 0}, {0x51ACu, 493}, {0x51ADu, 0},
+  {0x51B0u, 494}, {0x51B1u, 0}, {0x51B2u, 494}, {0x51B4u, 0}, {0x51B5u, 494}, {0x51B6u, 491},
+  {0x51B7u, 493}, {0x51B8u, 0}, {0x51C4u, 491}, {0x51C5u, 0}, {0x51C6u, 493}, {0x51C7u, 0},
+  {0x51CCu, 494}, {0x51CDu, 491}, {0x51CEu, 0}, {0x51CFu, 494}, {0x51D0u, 0}, {0x51DDu, 493},
+  {0x51DEu, 0}, {0x51E0u, 494}, {0x51E1u, 493}, {0x51E2u, 0}, {0x51E4u, 494}, {0x51E5u, 0},
+  {0x51E6u, 491}, {0x51E7u, 0}, {0x51EDu, 494}, {0x51EEu, 0}, {0x51EFu, 494}, {0x51F1u, 495},
+  {0x51F2u, 0}, {0x51F6u, 491}, {0x51F7u, 0}, {0x51F8u, 491}, {0x51FAu, 493}, {0x51FBu, 494},
+  {0x51FCu, 0}, {0x51FDu, 494}, {0x51FEu, 0}, {0x5200u, 493}, {0x5201u, 0}, {0x5203u, 491},
+  {0x5204u, 0}, {0x5206u, 493}, {0x5208u, 491}, {0x5209u, 0}, {0x520Au, 493}, {0x520Bu, 0},
+  {0x5211u, 493}, {0x5212u, 494}, {0x5213u, 0}, {0x5217u, 493}, {0x5218u, 494}, {0x521Cu, 0},
+  {0x521Du, 493}, {0x521Eu, 0}, {0x5224u, 493}, {0x5225u, 490}, {0x5226u, 0}, {0x5229u, 493},
+  {0x522Au, 495}, {0x522Bu, 494}, {0x522Cu, 0}, {0x5230u, 493}, {0x5231u, 0}, {0x5236u, 493},
+  {0x5239u, 491}, {0x523Au, 493}, {0x523Cu, 0}, {0x5242u, 494}, {0x5243u, 0}, {0x5247u, 490},
+  {0x5248u, 0}, {0x524Au, 491}, {0x524Bu, 0}, {0x524Cu, 495}, {0x524Du, 493}, {0x524Eu, 0},
+  {0x5251u, 494}, {0x5252u, 0}, {0x5256u, 491}, {0x5257u, 0}, {0x525Bu, 490}, {0x525Cu, 0},
+  {0x5263u, 491}, {0x5266u, 0}, {0x5267u, 494}, {0x5268u, 0}, {0x5269u, 494}, {0x526Bu, 0},
+  {0x526Fu, 493}, {0x5270u, 491}, {0x5271u, 0}, {0x5272u, 493}, {0x5273u, 0}, {0x5275u, 490},
+  {0x5276u, 0}, {0x5283u, 495}, {0x5284u, 0}, {0x5287u, 490}, {0x5288u, 0}, {0x5289u, 495},
+  {0x528Au, 0}, {0x528Du, 495}, {0x528Eu, 0}, {0x529Bu, 493}, {0x529Cu, 0}, {0x529Du, 494},
+  {0x529Fu, 493}, {0x52A1u, 494}, {0x52A2u, 0}, {0x52A3u, 493}, {0x52A4u, 0}, {0x52A8u, 494},
+  {0x52A9u, 493}, {0x52ABu, 494}, {0x52ACu, 0}, {0x52B1u, 493}, {0x52B2u, 494}, {0x52B4u, 491},
+  {0x52B5u, 0}, {0x52B9u, 491}, {0x52BAu, 0}, {0x52BEu, 491}, {0x52BFu, 494}, {0x52C0u, 0},
+  {0x52C1u, 495}, {0x52C2u, 0}, {0x52C3u, 491}, {0x52C4u, 0}, {0x52C5u, 491}, {0x52C6u, 0},
+  {0x52C7u, 493}, {0x52C8u, 0}, {0x52C9u, 493}, {0x52CAu, 0}, {0x52CBu, 494}, {0x52CCu, 0},
+  {0x52D2u, 494}, {0x52D3u, 0}, {0x52D5u, 490}, {0x52D6u, 0}, {0x52D8u, 491}, {0x52D9u, 490},
+  {0x52DAu, 0}, {0x52DDu, 490}, {0x52DEu, 495}, {0x52DFu, 491}, {0x52E0u, 0}, {0x52E2u, 490},
+  {0x52E3u, 0}, {0x52E4u, 493}, {0x52E5u, 0}, {0x52E7u, 491}, {0x52E8u, 0}, {0x52F2u, 491},
+  {0x52F3u, 0}, {0x52F5u, 495}, {0x52F6u, 0}, {0x52F8u, 495}, {0x52F9u, 0}, {0x52FEu, 493},
+  {0x52FFu, 494}, {0x5300u, 0}, {0x5302u, 491}, {0x5303u, 0}, {0x5305u, 493}, {0x5306u, 494},
+  {0x5307u, 0}, {0x5308u, 494}, {0x5309u, 0}, {0x5316u, 493}, {0x5318u, 0}, {0x5319u, 494},
+  {0x531Au, 0}, {0x5320u, 491}, {0x5321u, 0}, {0x5339u, 493}, {0x533Au, 497}, {0x533Bu, 493},
+  {0x533Cu, 0}, {0x533Fu, 491}, {0x5340u, 495}, {0x5341u, 493}, {0x5342u, 0}, {0x5343u, 493},
+  {0x5344u, 0}, {0x5347u, 493}, {0x5349u, 0}, {0x534Au, 493}, {0x534Bu, 0}, {0x534Eu, 494},
+  {0x5350u, 0}, {0x5351u, 491}, {0x5352u, 493}, {0x5354u, 490}, {0x5355u, 494}, {0x5357u, 493},
+  {0x5358u, 491}, {0x5359u, 0}, {0x535Au, 493}, {0x535Bu, 0}, {0x535Cu, 495}, {0x535Du, 0},
+  {0x5360u, 493}, {0x5361u, 494}, {0x5363u, 0}, {0x536Bu, 494}, {0x536Cu, 0}, {0x536Fu, 494},
+  {0x5370u, 493}, {0x5372u, 0}, {0x5373u, 493}, {0x5375u, 491}, {0x5376u, 0}, {0x5377u, 494},
+  {0x5378u, 491}, {0x5379u, 0}, {0x537Bu, 495}, {0x537Cu, 0}, {0x5382u, 494}, {0x5383u, 0},
+  {0x5384u, 493}, {0x5385u, 494}, {0x5387u, 0}, {0x5389u, 494}, {0x538Au, 0}, {0x538Bu, 494},
+  {0x538Eu, 0}, {0x5398u, 490}, {0x5399u, 0}, {0x539Au, 493}, {0x539Bu, 0}, {0x539Fu, 493},
+  {0x53A0u, 0}, {0x53ADu, 495}, {0x53AEu, 0}, {0x53B2u, 495}, {0x53B3u, 491}, {0x53B4u, 0},
+  {0x53BBu, 493}, {0x53BCu, 0}, {0x53BFu, 494}, {0x53C0u, 0}, {0x53C2u, 493}, {0x53C3u, 495},
+  {0x53C4u, 0}, {0x53C8u, 493}, {0x53C9u, 494}, {0x53CAu, 493}, {0x53CCu, 497}, {0x53CDu, 493},
+  {0x53CEu, 491}, {0x53CFu, 0}, {0x53D1u, 494}, {0x53D2u, 0}, {0x53D4u, 493}, {0x53D5u, 0},
+  {0x53D6u, 493}, {0x53D8u, 494}, {0x53D9u, 493}, {0x53DAu, 0}, {0x53E3u, 493}, {0x53E6u, 494},
+  {0x53E7u, 0}, {0x53EAu, 494}, {0x53EBu, 493}, {0x53EDu, 494}, {0x53EEu, 0}, {0x53EFu, 493},
+  {0x53F1u, 491}, {0x53F2u, 493}, {0x53F4u, 0}, {0x53F6u, 494}, {0x53F7u, 493}, {0x53F9u, 494},
+  {0x53FAu, 0}, {0x5403u, 494}, {0x5404u, 493}, {0x5405u, 0}, {0x5408u, 493}, {0x540Au, 494},
+  {0x540Bu, 0}, {0x540Cu, 493}, {0x540Fu, 491}, {0x5410u, 493}, {0x5412u, 495}, {0x5413u, 494},
+  {0x5414u, 0}, {0x5417u, 494}, {0x5418u, 0}, {0x541Bu, 493}, {0x541Cu, 0}, {0x541Du, 494},
+  {0x541Eu, 495}, {0x541Fu, 493}, {0x5420u, 495}, {0x5421u, 0}, {0x5426u, 493}, {0x5427u, 494},
+  {0x5428u, 0}, {0x542Bu, 493}, {0x542Cu, 494}, {0x542Du, 0}, {0x542Fu, 494}, {0x5430u, 0},
+  {0x5433u, 495}, {0x5434u, 0}, {0x5435u, 494}, {0x5436u, 0}, {0x5438u, 493}, {0x543Au, 0},
+  {0x543Bu, 494}, {0x543Cu, 0}, {0x543Eu, 494}, {0x543Fu, 0}, {0x5440u, 494}, {0x5441u, 0},
+  {0x5442u, 490}, {0x5443u, 0}, {0x5446u, 494}, {0x5447u, 0}, {0x5448u, 493}, {0x5449u, 491},
+  {0x544Au, 493}, {0x544Bu, 0}, {0x5450u, 494}, {0x5451u, 0}, {0x5458u, 494}, {0x5459u, 0},
+  {0x545Cu, 494}, {0x545Du, 0}, {0x5462u, 494}, {0x5463u, 0}, {0x5466u, 494}, {0x5467u, 0},
+  {0x5468u, 493}, {0x5469u, 0}, {0x546Au, 491}, {0x546Bu, 0}, {0x5473u, 493}, {0x5474u, 0},
+  {0x5475u, 494}, {0x5476u, 0}, {0x547Cu, 493}, {0x547Eu, 0}, {0x548Cu, 493}, {0x548Du, 0},
+  {0x5496u, 494}, {0x5497u, 0}, {0x54A6u, 494}, {0x54A9u, 0}, {0x54AAu, 494}, {0x54ABu, 0},
+  {0x54ACu, 494}, {0x54ADu, 0}, {0x54AFu, 494}, {0x54B0u, 0}, {0x54B1u, 494}, {0x54B2u, 491},
+  {0x54B3u, 0}, {0x54BDu, 491}, {0x54BEu, 0}, {0x54C0u, 493}, {0x54C2u, 0}, {0x54C7u, 494},
+  {0x54CAu, 0}, {0x54CDu, 494}, {0x54CFu, 0}, {0x54DFu, 494}, {0x54E0u, 0}, {0x54E1u, 490},
+  {0x54E2u, 0}, {0x54E5u, 494}, {0x54E7u, 0}, {0x54E9u, 494}, {0x54EBu, 0}, {0x54EDu, 494},
+  {0x54EEu, 0}, {0x54F2u, 493}, {0x54F3u, 0}, {0x54FAu, 491}, {0x54FBu, 0}, {0x5504u, 491},
+  {0x5505u, 0}, {0x5506u, 491}, {0x5508u, 0}, {0x5509u, 494}, {0x550Au, 0}, {0x5510u, 493},
+  {0x5511u, 0}, {0x5514u, 495}, {0x5515u, 0}, {0x5524u, 494}, {0x5525u, 0}, {0x552Cu, 494},
+  {0x552Du, 0}, {0x552Eu, 494}, {0x552Fu, 493}, {0x5530u, 0}, {0x5531u, 493}, {0x5532u, 0},
+  {0x5537u, 494}, {0x5538u, 495}, {0x5539u, 0}, {0x553Eu, 491}, {0x553Fu, 0}, {0x5546u, 493},
+  {0x5547u, 0}, {0x554Au, 494}, {0x554Bu, 0}, {0x554Fu, 490}, {0x5550u, 0}, {0x5553u, 491},
+  {0x5554u, 0}, {0x555Fu, 495}, {0x5560u, 0}, {0x5561u, 494}, {0x5562u, 0}, {0x5565u, 494},
+  {0x5567u, 0}, {0x556Au, 494}, {0x556Bu, 0}, {0x5580u, 494}, {0x5581u, 0}, {0x5582u, 494},
+  {0x5583u, 0}, {0x5584u, 493}, {0x5585u, 0}, {0x5587u, 494}, {0x5588u, 0}, {0x5589u, 491},
+  {0x558Au, 494}, {0x558Bu, 0}, {0x558Fu, 494}, {0x5590u, 0}, {0x5594u, 494}, {0x5595u, 0},
+  {0x559Au, 491}, {0x559Bu, 0}, {0x559Cu, 493}, {0x559Eu, 0}, {0x55A9u, 491}, {0x55ACu, 495},
+  {0x55ADu, 0}, {0x55AEu, 495}, {0x55AFu, 0}, {0x55B5u, 494}, {0x55B6u, 491}, {0x55B7u, 494},
+  {0x55B8u, 0}, {0x55BBu, 494}, {0x55BCu, 0}, {0x55C5u, 491}, {0x55C6u, 0}, {0x55CEu, 495},
+  {0x55CFu, 0}, {0x55D2u, 494}, {0x55D3u, 0}, {0x55DAu, 495}, {0x55DBu, 0}, {0x55E3u, 491},
+  {0x55E4u, 0}, {0x55E8u, 494}, {0x55E9u, 0}, {0x55EFu, 494}, {0x55F0u, 0}, {0x5606u, 490},
+  {0x5607u, 0}, {0x5609u, 494}, {0x560Au, 0}, {0x5617u, 495}, {0x5618u, 0}, {0x561Bu, 494},
+  {0x561Cu, 0}, {0x5631u, 491}, {0x5633u, 0}, {0x5634u, 494}, {0x5635u, 0}, {0x563Bu, 494},
+  {0x563Cu, 0}, {0x563Fu, 494}, {0x5640u, 0}, {0x5668u, 493}, {0x5669u, 0}, {0x5674u, 490},
+  {0x5675u, 0}, {0x5687u, 490}, {0x5688u, 0}, {0x56B4u, 495}, {0x56B5u, 0}, {0x56C9u, 495},
+  {0x56CAu, 0}, {0x56DAu, 491}, {0x56DBu, 493}, {0x56DCu, 0}, {0x56DEu, 493}, {0x56DFu, 0},
+  {0x56E0u, 493}, {0x56E1u, 0}, {0x56E2u, 494}, {0x56E3u, 491}, {0x56E4u, 0}, {0x56EDu, 494},
+  {0x56EEu, 0}, {0x56F0u, 493}, {0x56F1u, 0}, {0x56F2u, 491}, {0x56F4u, 494}, {0x56F5u, 0},
+  {0x56FAu, 493}, {0x56FBu, 0}, {0x56FDu, 493}, {0x56FEu, 494}, {0x56FFu, 0}, {0x5706u, 494},
+  {0x5707u, 0}, {0x5708u, 494}, {0x5709u, 0}, {0x570Bu, 495}, {0x570Cu, 0}, {0x570Du, 495},
+  {0x570Eu, 0}, {0x570Fu, 491}, {0x5710u, 0}, {0x5712u, 490}, {0x5713u, 495}, {0x5714u, 0},
+  {0x5716u, 495}, {0x5717u, 0}, {0x5718u, 495}, {0x5719u, 0}, {0x571Cu, 495}, {0x571Du, 0},
+  {0x571Fu, 493}, {0x5720u, 0}, {0x5723u, 494}, {0x5724u, 0}, {0x5727u, 491}, {0x5728u, 493},
+  {0x5729u, 0}, {0x572Du, 494}, {0x572Eu, 0}, {0x5730u, 493}, {0x5731u, 0}, {0x5733u, 494},
+  {0x5734u, 0}, {0x573Au, 494}, {0x573Bu, 0}, {0x573Eu, 494}, {0x573Fu, 0}, {0x5740u, 494},
+  {0x5741u, 0}, {0x5742u, 491}, {0x5743u, 0}, {0x5747u, 493}, {0x5748u, 0}, {0x574Au, 491},
+  {0x574Bu, 0}, {0x574Eu, 494}, {0x574Fu, 0}, {0x5750u, 494}, {0x5751u, 493}, {0x5752u, 0},
+  {0x5757u, 494}, {0x5758u, 0}, {0x575Au, 494}, {0x575Du, 0}, {0x5761u, 494}, {0x5762u, 0},
+  {0x5764u, 494}, {0x5765u, 0}, {0x5766u, 494}, {0x5767u, 0}, {0x576Au, 493}, {0x576Bu, 0},
+  {0x5782u, 493}, {0x5783u, 494}, {0x5784u, 0}, {0x578Bu, 493}, {0x578Cu, 0}, {0x5792u, 494},
+  {0x5793u, 0}, {0x57A3u, 491}, {0x57A4u, 0}, {0x57C3u, 494}, {0x57C4u, 0}, {0x57CBu, 493},
+  {0x57CCu, 0}, {0x57CEu, 493}, {0x57CFu, 0}, {0x57D4u, 494}, {0x57D5u, 0}, {0x57DFu, 493},
+  {0x57E0u, 0}, {0x57F7u, 490}, {0x57F8u, 0}, {0x57F9u, 493}, {0x57FBu, 0}, {0x57FCu, 491},
+  {0x57FDu, 0}, {0x5800u, 491}, {0x5801u, 0}, {0x5802u, 493}, {0x5803u, 0}, {0x5805u, 490},
+  {0x5806u, 493}, {0x5807u, 0}, {0x5815u, 493}, {0x5816u, 0}, {0x5821u, 494}, {0x5822u, 0},
+  {0x5824u, 491}, {0x5825u, 0}, {0x582Au, 493}, {0x582Bu, 0}, {0x5831u, 490}, {0x5832u, 0},
+  {0x5834u, 490}, {0x5835u, 0}, {0x5840u, 491}, {0x5842u, 0}, {0x584Au, 490}, {0x584Bu, 0},
+  {0x5851u, 493}, {0x5852u, 0}, {0x5854u, 493}, {0x5855u, 0}, {0x5857u, 490}, {0x5858u, 0},
+  {0x585Au, 491}, {0x585Bu, 0}, {0x585Eu, 493}, {0x585Fu, 0}, {0x5869u, 491}, {0x586Au, 0},
+  {0x586Bu, 493}, {0x586Cu, 0}, {0x5875u, 495}, {0x5876u, 0}, {0x587Eu, 491}, {0x587Fu, 0},
+  {0x5883u, 493}, {0x5884u, 0}, {0x5893u, 491}, {0x5894u, 0}, {0x5897u, 491}, {0x5898u, 0},
+  {0x589Cu, 491}, {0x589Du, 0}, {0x589Eu, 494}, {0x589Fu, 0}, {0x58A8u, 493}, {0x58A9u, 0},
+  {0x58AEu, 495}, {0x58AFu, 0}, {0x58B3u, 491}, {0x58B4u, 0}, {0x58BEu, 491}, {0x58BFu, 0},
+  {0x58C1u, 493}, {0x58C2u, 0}, {0x58C7u, 490}, {0x58C8u, 0}, {0x58CAu, 491}, {0x58CBu, 0},
+  {0x58CCu, 491}, {0x58CDu, 0}, {0x58D3u, 495}, {0x58D4u, 0}, {0x58D8u, 495}, {0x58D9u, 0},
+  {0x58DEu, 495}, {0x58DFu, 0}, {0x58E2u, 495}, {0x58E3u, 0}, {0x58E4u, 494}, {0x58E5u, 0},
+  {0x58EBu, 493}, {0x58ECu, 494}, {0x58EDu, 0}, {0x58EEu, 493}, {0x58EFu, 494}, {0x58F0u, 493},
+  {0x58F1u, 491}, {0x58F3u, 0}, {0x58FDu, 495}, {0x58FEu, 0}, {0x5904u, 494}, {0x5905u, 0},
+  {0x5907u, 494}, {0x5908u, 0}, {0x5909u, 491}, {0x590Au, 0}, {0x590Du, 494}, {0x590Eu, 0},
+  {0x590Fu, 493}, {0x5910u, 0}, {0x5915u, 493}, {0x5917u, 0}, {0x591Au, 493}, {0x591Bu, 0},
+  {0x591Cu, 493}, {0x591Du, 0}, {0x591Fu, 494}, {0x5920u, 495}, {0x5921u, 0}, {0x5922u, 490},
+  {0x5923u, 0}, {0x5925u, 494}, {0x5926u, 0}, {0x5927u, 497}, {0x5928u, 0}, {0x5929u, 493},
+  {0x592Cu, 0}, {0x592Eu, 493}, {0x592Fu, 0}, {0x5931u, 493}, {0x5932u, 0}, {0x5934u, 494},
+  {0x5935u, 0}, {0x5937u, 494}, {0x593Bu, 0}, {0x593Eu, 495}, {0x593Fu, 0}, {0x5947u, 493},
+  {0x594Au, 0}, {0x594Bu, 494}, {0x594Cu, 0}, {0x594Eu, 495}, {0x594Fu, 493}, {0x5950u, 0},
+  {0x5951u, 493}, {0x5952u, 0}, {0x5954u, 493}, {0x5955u, 0}, {0x5956u, 494}, {0x5958u, 0},
+  {0x5965u, 493}, {0x5966u, 0}, {0x5967u, 495}, {0x5968u, 491}, {0x5969u, 0}, {0x596Au, 490},
+  {0x596Bu, 0}, {0x596Eu, 490}, {0x596Fu, 0}, {0x5973u, 493}, {0x5975u, 0}, {0x5976u, 494},
+  {0x5977u, 0}, {0x5979u, 494}, {0x597Au, 0}, {0x597Du, 493}, {0x597Eu, 0}, {0x5982u, 493},
+  {0x5983u, 491}, {0x5985u, 0}, {0x5987u, 494}, {0x5989u, 0}, {0x598Au, 491}, {0x598Bu, 0},
+  {0x5996u, 493}, {0x5997u, 0}, {0x5999u, 493}, {0x599Au, 0}, {0x599Du, 495}, {0x599Eu, 0},
+  {0x59A5u, 493}, {0x59A6u, 0}, {0x59A8u, 493}, {0x59A9u, 0}, {0x59ACu, 491}, {0x59ADu, 0},
+  {0x59AEu, 494}, {0x59AFu, 0}, {0x59B3u, 495}, {0x59B4u, 0}, {0x59B9u, 493}, {0x59BAu, 0},
+  {0x59BBu, 493}, {0x59BCu, 0}, {0x59C6u, 494}, {0x59C7u, 0}, {0x59C9u, 491}, {0x59CAu, 494},
+  {0x59CBu, 493}, {0x59CCu, 0}, {0x59D0u, 494}, {0x59D2u, 0}, {0x59D3u, 493}, {0x59D5u, 0},
+  {0x59EBu, 491}, {0x59ECu, 0}, {0x59FBu, 491}, {0x59FCu, 0}, {0x59FFu, 493}, {0x5A00u, 0},
+  {0x5A01u, 493}, {0x5A02u, 0}, {0x5A03u, 494}, {0x5A05u, 0}, {0x5A18u, 493}, {0x5A19u, 0},
+  {0x5A1Bu, 495}, {0x5A1Cu, 494}, {0x5A1Du, 0}, {0x5A1Fu, 494}, {0x5A20u, 491}, {0x5A21u, 0},
+  {0x5A2Fu, 491}, {0x5A30u, 0}, {0x5A31u, 494}, {0x5A32u, 0}, {0x5A41u, 495}, {0x5A42u, 0},
+  {0x5A46u, 493}, {0x5A47u, 0}, {0x5A5Au, 493}, {0x5A5Bu, 0}, {0x5A66u, 490}, {0x5A67u, 0},
+  {0x5A7Fu, 491}, {0x5A80u, 0}, {0x5A92u, 493}, {0x5A93u, 0}, {0x5A9Bu, 491}, {0x5A9Cu, 0},
+  {0x5ABDu, 495}, {0x5ABEu, 0}, {0x5AC1u, 493}, {0x5AC2u, 0}, {0x5AC9u, 491}, {0x5ACAu, 0},
+  {0x5ACCu, 493}, {0x5ACDu, 0}, {0x5AE1u, 491}, {0x5AE2u, 0}, {0x5AE9u, 494}, {0x5AEAu, 0},
+  {0x5B22u, 491}, {0x5B23u, 0}, {0x5B50u, 493}, {0x5B51u, 0}, {0x5B54u, 493}, {0x5B55u, 494},
+  {0x5B56u, 0}, {0x5B57u, 493}, {0x5B59u, 494}, {0x5B5Au, 0}, {0x5B5Cu, 494}, {0x5B5Du, 493},
+  {0x5B5Eu, 0}, {0x5B5Fu, 494}, {0x5B60u, 0}, {0x5B63u, 493}, {0x5B65u, 0}, {0x5B66u, 493},
+  {0x5B67u, 0}, {0x5B69u, 494}, {0x5B6Au, 0}, {0x5B6Bu, 490}, {0x5B6Cu, 0}, {0x5B78u, 494},
+  {0x5B79u, 0}, {0x5B81u, 494}, {0x5B82u, 0}, {0x5B83u, 494}, {0x5B84u, 0}, {0x5B85u, 490},
+  {0x5B86u, 0}, {0x5B87u, 493}, {0x5B8Au, 0}, {0x5B8Bu, 494}, {0x5B8Cu, 493}, {0x5B8Du, 0},
+  {0x5B8Fu, 494}, {0x5B90u, 0}, {0x5B97u, 493}, {0x5B9Eu, 494}, {0x5B9Fu, 491}, {0x5BA0u, 0},
+  {0x5BA1u, 494}, {0x5BA2u, 493}, {0x5BA5u, 0}, {0x5BAAu, 494}, {0x5BABu, 0}, {0x5BAEu, 490},
+  {0x5BAFu, 0}, {0x5BB0u, 491}, {0x5BB1u, 0}, {0x5BB3u, 493}, {0x5BB5u, 491}, {0x5BB6u, 493},
+  {0x5BB7u, 0}, {0x5BB9u, 493}, {0x5BBAu, 0}, {0x5BBDu, 494}, {0x5BBFu, 493}, {0x5BC0u, 0},
+  {0x5BC2u, 493}, {0x5BC3u, 0}, {0x5BC4u, 493}, {0x5BC5u, 494}, {0x5BC6u, 493}, {0x5BC7u, 494},
+  {0x5BC8u, 0}, {0x5BCCu, 493}, {0x5BCDu, 0}, {0x5BD2u, 493}, {0x5BD3u, 0}, {0x5BDBu, 491},
+  {0x5BDCu, 0}, {0x5BDDu, 493}, {0x5BDEu, 494}, {0x5BDFu, 493}, {0x5BE0u, 0}, {0x5BE1u, 493},
+  {0x5BE2u, 495}, {0x5BE3u, 0}, {0x5BE6u, 495}, {0x5BE7u, 490}, {0x5BE8u, 494}, {0x5BE9u, 490},
+  {0x5BEAu, 0}, {0x5BEBu, 495}, {0x5BEDu, 0}, {0x5BEEu, 490}, {0x5BEFu, 0}, {0x5BF5u, 495},
+  {0x5BF7u, 0}, {0x5BF8u, 493}, {0x5BF9u, 494}, {0x5BFAu, 491}, {0x5BFBu, 494}, {0x5BFDu, 0},
+  {0x5BFEu, 491}, {0x5BFFu, 493}, {0x5C00u, 0}, {0x5C01u, 493}, {0x5C02u, 491}, {0x5C03u, 0},
+  {0x5C04u, 493}, {0x5C05u, 0}, {0x5C06u, 493}, {0x5C07u, 495}, {0x5C09u, 491}, {0x5C0Au, 493},
+  {0x5C0Bu, 490}, {0x5C0Cu, 0}, {0x5C0Du, 495}, {0x5C0Eu, 490}, {0x5C0Fu, 493}, {0x5C10u, 0},
+  {0x5C11u, 493}, {0x5C12u, 0}, {0x5C14u, 494}, {0x5C15u, 0}, {0x5C16u, 494}, {0x5C17u, 0},
+  {0x5C18u, 494}, {0x5C19u, 0}, {0x5C1Au, 493}, {0x5C1Bu, 0}, {0x5C1Du, 494}, {0x5C1Eu, 0},
+  {0x5C24u, 494}, {0x5C25u, 0}, {0x5C31u, 493}, {0x5C32u, 0}, {0x5C3Au, 493}, {0x5C3Bu, 491},
+  {0x5C3Cu, 493}, {0x5C3Fu, 491}, {0x5C40u, 493}, {0x5C41u, 494}, {0x5C43u, 0}, {0x5C45u, 493},
+  {0x5C46u, 495}, {0x5C47u, 0}, {0x5C48u, 491}, {0x5C49u, 0}, {0x5C4Au, 491}, {0x5C4Bu, 493},
+  {0x5C4Cu, 0}, {0x5C4Fu, 494}, {0x5C50u, 0}, {0x5C55u, 493}, {0x5C56u, 0}, {0x5C5Eu, 493},
+  {0x5C5Fu, 0}, {0x5C60u, 494}, {0x5C61u, 0}, {0x5C64u, 490}, {0x5C65u, 491}, {0x5C66u, 0},
+  {0x5C6Cu, 495}, {0x5C6Du, 0}, {0x5C6Fu, 491}, {0x5C70u, 0}, {0x5C71u, 493}, {0x5C72u, 0},
+  {0x5C81u, 494}, {0x5C83u, 0}, {0x5C90u, 491}, {0x5C91u, 0}, {0x5C97u, 494}, {0x5C99u, 0},
+  {0x5C9Au, 494}, {0x5C9Cu, 0}, {0x5CA1u, 490}, {0x5CA2u, 0}, {0x5CA9u, 490}, {0x5CAAu, 0},
+  {0x5CACu, 491}, {0x5CADu, 0}, {0x5CB3u, 493}, {0x5CB4u, 0}, {0x5CB8u, 493}, {0x5CB9u, 0},
+  {0x5CE0u, 491}, {0x5CE1u, 493}, {0x5CE2u, 0}, {0x5CF0u, 493}, {0x5CF1u, 0}, {0x5CF6u, 490},
+  {0x5CF7u, 0}, {0x5CFDu, 495}, {0x5CFEu, 0}, {0x5D07u, 493}, {0x5D08u, 0}, {0x5D0Eu, 491},
+  {0x5D0Fu, 0}, {0x5D16u, 491}, {0x5D17u, 0}, {0x5D19u, 495}, {0x5D1Au, 0}, {0x5D29u, 493},
+  {0x5D2Au, 0}, {0x5D34u, 494}, {0x5D35u, 0}, {0x5D50u, 490}, {0x5D51u, 0}, {0x5DBAu, 495},
+  {0x5DBBu, 0}, {0x5DDDu, 493}, {0x5DDFu, 0}, {0x5DE1u, 493}, {0x5DE2u, 0}, {0x5DE3u, 491},
+  {0x5DE4u, 0}, {0x5DE5u, 493}, {0x5DE9u, 0}, {0x5DEBu, 494}, {0x5DECu, 0}, {0x5DEEu, 493},
+  {0x5DEFu, 0}, {0x5DF1u, 493}, {0x5DF2u, 494}, {0x5DF5u, 0}, {0x5DF7u, 494}, {0x5DF8u, 0},
+  {0x5DFBu, 491}, {0x5DFCu, 0}, {0x5DFEu, 491}, {0x5DFFu, 0}, {0x5E01u, 494}, {0x5E02u, 493},
+  {0x5E04u, 0}, {0x5E05u, 494}, {0x5E06u, 491}, {0x5E07u, 0}, {0x5E08u, 494}, {0x5E09u, 0},
+  {0x5E0Cu, 493}, {0x5E0Du, 0}, {0x5E10u, 494}, {0x5E11u, 0}, {0x5E15u, 494}, {0x5E17u, 0},
+  {0x5E1Bu, 495}, {0x5E1Cu, 0}, {0x5E1Du, 493}, {0x5E1Eu, 0}, {0x5E25u, 490}, {0x5E26u, 494},
+  {0x5E27u, 0}, {0x5E2Bu, 490}, {0x5E2Cu, 0}, {0x5E2Du, 493}, {0x5E2Eu, 494}, {0x5E2Fu, 491},
+  {0x5E31u, 0}, {0x5E33u, 490}, {0x5E34u, 0}, {0x5E36u, 495}, {0x5E37u, 0}, {0x5E38u, 493},
+  {0x5E39u, 0}, {0x5E3Du, 493}, {0x5E3Eu, 0}, {0x5E45u, 493}, {0x5E46u, 0}, {0x5E55u, 493},
+  {0x5E56u, 0}, {0x5E63u, 490}, {0x5E64u, 0}, {0x5E6Bu, 495}, {0x5E6Cu, 0}, {0x5E72u, 493},
+  {0x5E75u, 0}, {0x5E76u, 494}, {0x5E77u, 0}, {0x5E78u, 493}, {0x5E79u, 490}, {0x5E7Au, 0},
+  {0x5E7Bu, 493}, {0x5E7Eu, 490}, {0x5E7Fu, 494}, {0x5E80u, 0}, {0x5E81u, 491}, {0x5E82u, 0},
+  {0x5E83u, 491}, {0x5E84u, 0}, {0x5E86u, 494}, {0x5E87u, 495}, {0x5E88u, 0}, {0x5E8Au, 493},
+  {0x5E8Bu, 0}, {0x5E8Fu, 493}, {0x5E90u, 0}, {0x5E93u, 494}, {0x5E95u, 493}, {0x5E96u, 0},
+  {0x5E97u, 493}, {0x5E98u, 0}, {0x5E99u, 494}, {0x5E9Bu, 0}, {0x5E9Cu, 493}, {0x5E9Du, 0},
+  {0x5E9Eu, 494}, {0x5EA0u, 0}, {0x5EA6u, 493}, {0x5EA8u, 0}, {0x5EABu, 490}, {0x5EACu, 0},
+  {0x5EADu, 493}, {0x5EAEu, 0}, {0x5EB6u, 491}, {0x5EB7u, 493}, {0x5EB9u, 0}, {0x5EC3u, 491},
+  {0x5EC4u, 0}, {0x5EC9u, 493}, {0x5ECAu, 491}, {0x5ECBu, 0}, {0x5ED6u, 494}, {0x5ED7u, 0},
+  {0x5EE0u, 495}, {0x5EE1u, 0}, {0x5EE2u, 495}, {0x5EE4u, 0}, {0x5EF3u, 495}, {0x5EF4u, 0},
+  {0x5EF6u, 493}, {0x5EF8u, 0}, {0x5EFAu, 493}, {0x5EFBu, 0}, {0x5F00u, 494}, {0x5F01u, 491},
+  {0x5F02u, 494}, {0x5F04u, 493}, {0x5F05u, 0}, {0x5F0Au, 493}, {0x5F0Bu, 0}, {0x5F0Fu, 493},
+  {0x5F10u, 491}, {0x5F11u, 0}, {0x5F13u, 491}, {0x5F15u, 493}, {0x5F16u, 0}, {0x5F17u, 494},
+  {0x5F19u, 0}, {0x5F1Fu, 493}, {0x5F20u, 494}, {0x5F21u, 0}, {0x5F25u, 493}, {0x5F27u, 491},
+  {0x5F28u, 0}, {0x5F2Fu, 494}, {0x5F30u, 0}, {0x5F31u, 493}, {0x5F32u, 0}, {0x5F35u, 490},
+  {0x5F36u, 0}, {0x5F37u, 490}, {0x5F38u, 0}, {0x5F39u, 494}, {0x5F3Bu, 0}, {0x5F3Eu, 491},
+  {0x5F3Fu, 0}, {0x5F48u, 495}, {0x5F49u, 0}, {0x5F4Au, 495}, {0x5F4Bu, 0}, {0x5F4Cu, 495},
+  {0x5F4Du, 0}, {0x5F4Eu, 495}, {0x5F4Fu, 0}, {0x5F52u, 494}, {0x5F53u, 493}, {0x5F54u, 0},
+  {0x5F55u, 494}, {0x5F56u, 0}, {0x5F59u, 491}, {0x5F5Au, 0}, {0x5F5Du, 494}, {0x5F5Eu, 495},
+  {0x5F5Fu, 0}, {0x5F62u, 493}, {0x5F63u, 0}, {0x5F65u, 495}, {0x5F66u, 0}, {0x5F69u, 493},
+  {0x5F6Au, 0}, {0x5F6Bu, 491}, {0x5F6Cu, 494}, {0x5F6Eu, 0}, {0x5F70u, 493}, {0x5F72u, 0},
+  {0x5F77u, 494}, {0x5F78u, 0}, {0x5F79u, 493}, {0x5F7Au, 0}, {0x5F7Bu, 494}, {0x5F7Cu, 493},
+  {0x5F7Du, 0}, {0x5F80u, 493}, {0x5F82u, 0}, {0x5F84u, 493}, {0x5F86u, 0}, {0x5F88u, 494},
+  {0x5F89u, 0}, {0x5F8Bu, 493}, {0x5F8Du, 0}, {0x5F90u, 493}, {0x5F91u, 495}, {0x5F92u, 493},
+  {0x5F93u, 491}, {0x5F94u, 0}, {0x5F97u, 493}, {0x5F98u, 0}, {0x5F9Eu, 494}, {0x5F9Fu, 0},
+  {0x5FA1u, 491}, {0x5FA2u, 0}, {0x5FA9u, 490}, {0x5FAAu, 493}, {0x5FABu, 0}, {0x5FAEu, 493},
+  {0x5FAFu, 0}, {0x5FB3u, 491}, {0x5FB5u, 494}, {0x5FB6u, 0}, {0x5FB7u, 494}, {0x5FB8u, 0},
+  {0x5FB9u, 490}, {0x5FBAu, 0}, {0x5FC3u, 493}, {0x5FC4u, 0}, {0x5FC5u, 493}, {0x5FC6u, 494},
+  {0x5FC7u, 0}, {0x5FCCu, 493}, {0x5FCEu, 0}, {0x5FD7u, 493}, {0x5FDAu, 0}, {0x5FDCu, 491},
+  {0x5FDDu, 0}, {0x5FE0u, 493}, {0x5FE1u, 0}, {0x5FE7u, 494}, {0x5FE8u, 0}, {0x5FEBu, 493},
+  {0x5FECu, 0}, {0x5FF5u, 493}, {0x5FF6u, 0}, {0x5FFDu, 494}, {0x5FFEu, 0}, {0x6000u, 494},
+  {0x6002u, 0}, {0x600Eu, 494}, {0x600Fu, 0}, {0x6012u, 493}, {0x6013u, 0}, {0x6015u, 494},
+  {0x6016u, 493}, {0x6017u, 0}, {0x601Du, 493}, {0x601Eu, 0}, {0x6020u, 491}, {0x6021u, 494},
+  {0x6022u, 0}, {0x6025u, 493}, {0x6026u, 0}, {0x6027u, 493}, {0x6029u, 0}, {0x602Au, 493},
+  {0x602Bu, 0}, {0x603Bu, 494}, {0x603Cu, 0}, {0x6046u, 495}, {0x6047u, 0}, {0x604Bu, 493},
+  {0x604Cu, 0}, {0x6050u, 493}, {0x6051u, 0}, {0x6052u, 491}, {0x6053u, 0}, {0x6062u, 494},
+  {0x6063u, 491}, {0x6064u, 0}, {0x6065u, 490}, {0x6066u, 0}, {0x6068u, 493}, {0x606Au, 0},
+  {0x606Du, 493}, {0x606Eu, 0}, {0x606Fu, 493}, {0x6070u, 494}, {0x6071u, 0}, {0x6075u, 491},
+  {0x6076u, 494}, {0x6077u, 0}, {0x607Cu, 494}, {0x607Du, 0}, {0x6084u, 494}, {0x6085u, 495},
+  {0x6086u, 0}, {0x6089u, 494}, {0x608Au, 0}, {0x6094u, 493}, {0x6095u, 0}, {0x609Fu, 493},
+  {0x60A1u, 0}, {0x60A3u, 493}, {0x60A4u, 0}, {0x60A6u, 491}, {0x60A7u, 0}, {0x60A8u, 494},
+  {0x60A9u, 491}, {0x60ABu, 0}, {0x60B2u, 493}, {0x60B3u, 0}, {0x60B6u, 495}, {0x60B7u, 0},
+  {0x60BCu, 491}, {0x60BDu, 0}, {0x60C5u, 493}, {0x60C6u, 0}, {0x60D1u, 493}, {0x60D2u, 0},
+  {0x60DCu, 493}, {0x60DDu, 0}, {0x60E0u, 494}, {0x60E1u, 495}, {0x60E2u, 0}, {0x60E7u, 493},
+  {0x60E9u, 0}, {0x60EFu, 494}, {0x60F0u, 491}, {0x60F1u, 495}, {0x60F2u, 0}, {0x60F3u, 493},
+  {0x60F4u, 0}, {0x60F9u, 494}, {0x60FAu, 0}, {0x6101u, 493}, {0x6102u, 0}, {0x6108u, 494},
+  {0x6109u, 493}, {0x610Au, 0}, {0x610Fu, 493}, {0x6110u, 0}, {0x611Au, 493}, {0x611Bu, 490},
+  {0x611Cu, 0}, {0x611Fu, 493}, {0x6120u, 0}, {0x6127u, 494}, {0x6128u, 0}, {0x6144u, 491},
+  {0x6145u, 0}, {0x6148u, 493}, {0x6149u, 0}, {0x614Bu, 490}, {0x614Cu, 491}, {0x614Du, 0},
+  {0x614Eu, 493}, {0x614Fu, 0}, {0x6155u, 493}, {0x6156u, 0}, {0x6158u, 495}, {0x6159u, 0},
+  {0x6162u, 493}, {0x6163u, 490}, {0x6164u, 0}, {0x6167u, 494}, {0x6168u, 491}, {0x6169u, 0},
+  {0x616Eu, 490}, {0x616Fu, 0}, {0x6170u, 493}, {0x6171u, 0}, {0x6176u, 490}, {0x6177u, 0},
+  {0x617Eu, 495}, {0x617Fu, 0}, {0x6182u, 490}, {0x6183u, 0}, {0x618Eu, 491}, {0x618Fu, 0},
+  {0x6190u, 495}, {0x6192u, 0}, {0x61A4u, 491}, {0x61A5u, 0}, {0x61A7u, 491}, {0x61A8u, 0},
+  {0x61A9u, 491}, {0x61AAu, 0}, {0x61ACu, 491}, {0x61ADu, 0}, {0x61B2u, 490}, {0x61B3u, 0},
+  {0x61B6u, 490}, {0x61B7u, 0}, {0x61BEu, 493}, {0x61BFu, 0}, {0x61C2u, 494}, {0x61C3u, 0},
+  {0x61C7u, 491}, {0x61C8u, 0}, {0x61C9u, 495}, {0x61CAu, 0}, {0x61D0u, 491}, {0x61D1u, 0},
+  {0x61D2u, 494}, {0x61D3u, 0}, {0x61F2u, 491}, {0x61F3u, 0}, {0x61F6u, 495}, {0x61F8u, 491},
+  {0x61F9u, 0}, {0x61FCu, 494}, {0x61FDu, 0}, {0x6200u, 495}, {0x6201u, 0}, {0x6208u, 494},
+  {0x6209u, 0}, {0x620Au, 494}, {0x620Bu, 0}, {0x620Cu, 494}, {0x620Du, 0}, {0x620Fu, 494},
+  {0x6210u, 493}, {0x6213u, 0}, {0x6216u, 494}, {0x6217u, 0}, {0x6218u, 494}, {0x6219u, 0},
+  {0x621Au, 491}, {0x621Bu, 0}, {0x6226u, 491}, {0x6227u, 0}, {0x622Au, 494}, {0x622Bu, 0},
+  {0x622Fu, 491}, {0x6230u, 495}, {0x6231u, 0}, {0x6232u, 495}, {0x6233u, 0}, {0x6234u, 493},
+  {0x6235u, 0}, {0x6236u, 495}, {0x6237u, 494}, {0x6238u, 491}, {0x6239u, 0}, {0x623Bu, 491},
+  {0x623Cu, 0}, {0x623Fu, 493}, {0x6241u, 494}, {0x6242u, 0}, {0x6247u, 493}, {0x6248u, 0},
+  {0x6249u, 491}, {0x624Au, 0}, {0x624Bu, 493}, {0x624Cu, 0}, {0x624Du, 493}, {0x624Eu, 494},
+  {0x624Fu, 0}, {0x6251u, 494}, {0x6252u, 0}, {0x6253u, 493}, {0x6254u, 0}, {0x6255u, 491},
+  {0x6256u, 0}, {0x6258u, 494}, {0x6259u, 0}, {0x6263u, 494}, {0x6264u, 0}, {0x6265u, 495},
+  {0x6266u, 0}, {0x6267u, 494}, {0x6268u, 0}, {0x6269u, 494}, {0x626Au, 0}, {0x626Bu, 494},
+  {0x6270u, 0}, {0x6271u, 491}, {0x6272u, 0}, {0x6276u, 491}, {0x6277u, 0}, {0x6279u, 493},
+  {0x627Au, 0}, {0x627Eu, 494}, {0x627Fu, 493}, {0x6281u, 0}, {0x6284u, 493}, {0x6285u, 0},
+  {0x628Au, 493}, {0x628Bu, 0}, {0x6291u, 493}, {0x6292u, 0}, {0x6293u, 494}, {0x6294u, 0},
+  {0x6295u, 493}, {0x6296u, 0}, {0x6297u, 493}, {0x6299u, 0}, {0x629Cu, 491}, {0x629Du, 0},
+  {0x629Eu, 491}, {0x629Fu, 0}, {0x62A2u, 494}, {0x62A3u, 0}, {0x62A4u, 494}, {0x62A6u, 0},
+  {0x62ABu, 493}, {0x62ACu, 494}, {0x62ADu, 0}, {0x62B1u, 493}, {0x62B2u, 0}, {0x62B5u, 493},
+  {0x62B6u, 0}, {0x62B9u, 493}, {0x62BAu, 0}, {0x62BCu, 491}, {0x62BDu, 493}, {0x62BEu, 0},
+  {0x62C5u, 493}, {0x62C6u, 494}, {0x62C7u, 0}, {0x62C9u, 493}, {0x62CAu, 0}, {0x62CBu, 495},
+  {0x62CCu, 0}, {0x62CDu, 493}, {0x62CEu, 0}, {0x62CFu, 495}, {0x62D0u, 491}, {0x62D1u, 0},
+  {0x62D2u, 493}, {0x62D3u, 491}, {0x62D4u, 494}, {0x62D5u, 0}, {0x62D6u, 494}, {0x62D7u, 0},
+  {0x62D8u, 493}, {0x62D9u, 491}, {0x62DAu, 0}, {0x62DBu, 493}, {0x62DCu, 494}, {0x62DDu, 491},
+  {0x62DEu, 0}, {0x62DFu, 494}, {0x62E0u, 491}, {0x62E2u, 0}, {0x62E5u, 494}, {0x62E7u, 0},
+  {0x62E8u, 494}, {0x62EAu, 0}, {0x62ECu, 493}, {0x62EDu, 491}, {0x62EEu, 0}, {0x62F3u, 493},
+  {0x62F4u, 0}, {0x62F6u, 491}, {0x62F7u, 493}, {0x62F8u, 0}, {0x62FCu, 498}, {0x62FDu, 0},
+  {0x62FEu, 493}, {0x62FFu, 494}, {0x6300u, 0}, {0x6301u, 493}, {0x6302u, 0}, {0x6307u, 493},
+  {0x6308u, 0}, {0x6309u, 494}, {0x630Au, 0}, {0x6311u, 493}, {0x6312u, 0}, {0x6316u, 494},
+  {0x6317u, 0}, {0x6319u, 491}, {0x631Au, 0}, {0x631Du, 494}, {0x631Eu, 0}, {0x631Fu, 491},
+  {0x6320u, 0}, {0x6321u, 494}, {0x6322u, 0}, {0x6324u, 494}, {0x6326u, 0}, {0x6328u, 491},
+  {0x6329u, 0}, {0x632Au, 494}, {0x632Bu, 491}, {0x632Cu, 0}, {0x632Fu, 493}, {0x6330u, 0},
+  {0x633Au, 494}, {0x633Bu, 0}, {0x633Fu, 491}, {0x6340u, 0}, {0x6349u, 493}, {0x634Au, 0},
+  {0x6350u, 494}, {0x6351u, 0}, {0x6355u, 493}, {0x6356u, 0}, {0x6357u, 491}, {0x6358u, 0},
+  {0x635Cu, 491}, {0x635Du, 0}, {0x635Fu, 494}, {0x6360u, 0}, {0x6361u, 494}, {0x6363u, 0},
+  {0x6368u, 490}, {0x6369u, 0}, {0x636Eu, 493}, {0x636Fu, 0}, {0x6372u, 495}, {0x6373u, 0},
+  {0x6377u, 494}, {0x6378u, 0}, {0x637Bu, 491}, {0x637Cu, 0}, {0x6383u, 490}, {0x6384u, 0},
+  {0x6388u, 493}, {0x6389u, 494}, {0x638Au, 0}, {0x638Cu, 493}, {0x638Du, 0}, {0x6392u, 493},
+  {0x6393u, 0}, {0x6398u, 491}, {0x6399u, 0}, {0x639Bu, 490}, {0x639Cu, 0}, {0x63A1u, 490},
+  {0x63A2u, 493}, {0x63A3u, 0}, {0x63A5u, 493}, {0x63A6u, 0}, {0x63A7u, 493}, {0x63A9u, 494},
+  {0x63AAu, 493}, {0x63ABu, 0}, {0x63B2u, 491}, {0x63B3u, 0}, {0x63B8u, 494}, {0x63B9u, 0},
+  {0x63CFu, 493}, {0x63D1u, 0}, {0x63D2u, 494}, {0x63D3u, 0}, {0x63DAu, 490}, {0x63DCu, 0},
+  {0x63E1u, 493}, {0x63E2u, 0}, {0x63EEu, 490}, {0x63EFu, 0}, {0x63F4u, 493}, {0x63F5u, 0},
+  {0x63FAu, 491}, {0x63FBu, 0}, {0x640Du, 490}, {0x640Eu, 0}, {0x6416u, 495}, {0x6417u, 0},
+  {0x641Cu, 494}, {0x641Du, 0}, {0x641Eu, 494}, {0x641Fu, 0}, {0x642Cu, 493}, {0x642Eu, 0},
+  {0x6436u, 495}, {0x6437u, 0}, {0x643Au, 491}, {0x643Bu, 0}, {0x643Eu, 491}, {0x643Fu, 0},
+  {0x6442u, 491}, {0x6443u, 0}, {0x6444u, 494}, {0x6445u, 0}, {0x6446u, 494}, {0x6447u, 0},
+  {0x644Au, 494}, {0x644Bu, 0}, {0x6454u, 494}, {0x6455u, 0}, {0x6458u, 493}, {0x6459u, 0},
+  {0x6469u, 493}, {0x646Au, 0}, {0x646Fu, 491}, {0x6470u, 0}, {0x6478u, 494}, {0x6479u, 0},
+  {0x6483u, 491}, {0x6484u, 0}, {0x6490u, 495}, {0x6491u, 0}, {0x6492u, 494}, {0x6493u, 0},
+  {0x649Eu, 494}, {0x649Fu, 0}, {0x64A3u, 495}, {0x64A4u, 491}, {0x64A5u, 495}, {0x64A6u, 0},
+  {0x64ADu, 494}, {0x64AEu, 491}, {0x64AFu, 0}, {0x64B2u, 491}, {0x64B3u, 0}, {0x64BEu, 495},
+  {0x64C0u, 0}, {0x64C1u, 490}, {0x64C2u, 0}, {0x64C7u, 495}, {0x64C8u, 0}, {0x64CAu, 495},
+  {0x64CCu, 0}, {0x64CDu, 493}, {0x64CEu, 494}, {0x64CFu, 0}, {0x64D4u, 495}, {0x64D5u, 0},
+  {0x64DAu, 495}, {0x64DBu, 0}, {0x64E0u, 495}, {0x64E1u, 0}, {0x64E6u, 493}, {0x64E7u, 0},
+  {0x64ECu, 490}, {0x64EDu, 0}, {0x64F4u, 495}, {0x64F5u, 0}, {0x64FAu, 495}, {0x64FBu, 0},
+  {0x64FEu, 495}, {0x64FFu, 0}, {0x651Du, 495}, {0x651Eu, 0}, {0x652Fu, 493}, {0x6530u, 0},
+  {0x6536u, 494}, {0x6537u, 0}, {0x6539u, 493}, {0x653Au, 0}, {0x653Bu, 493}, {0x653Cu, 0},
+  {0x653Eu, 493}, {0x653Fu, 499}, {0x6540u, 0}, {0x6545u, 493}, {0x6546u, 0}, {0x6548u, 494},
+  {0x6549u, 0}, {0x654Cu, 494}, {0x654Du, 495}, {0x654Eu, 0}, {0x654Fu, 493}, {0x6550u, 0},
+  {0x6551u, 493}, {0x6552u, 0}, {0x6557u, 490}, {0x6558u, 495}, {0x6559u, 499}, {0x655Au, 0},
+  {0x655Du, 494}, {0x655Eu, 0}, {0x6562u, 493}, {0x6564u, 0}, {0x6566u, 494}, {0x6567u, 0},
+  {0x656Cu, 493}, {0x656Du, 0}, {0x6570u, 493}, {0x6571u, 0}, {0x6572u, 494}, {0x6573u, 0},
+  {0x6574u, 493}, {0x6576u, 0}, {0x6577u, 491}, {0x6578u, 495}, {0x6579u, 0}, {0x6587u, 493},
+  {0x6588u, 0}, {0x6589u, 491}, {0x658Au, 0}, {0x658Bu, 494}, {0x658Cu, 0}, {0x658Eu, 491},
+  {0x658Fu, 0}, {0x6590u, 494}, {0x6591u, 491}, {0x6592u, 0}, {0x6597u, 493}, {0x6598u, 0},
+  {0x6599u, 493}, {0x659Au, 0}, {0x659Cu, 493}, {0x659Du, 0}, {0x65A4u, 491}, {0x65A5u, 493},
+  {0x65A6u, 0}, {0x65ACu, 491}, {0x65ADu, 493}, {0x65AEu, 0}, {0x65AFu, 494}, {0x65B0u, 493},
+  {0x65B1u, 0}, {0x65B7u, 495}, {0x65B8u, 0}, {0x65B9u, 493}, {0x65BAu, 0}, {0x65BCu, 494},
+  {0x65BDu, 493}, {0x65BEu, 0}, {0x65C1u, 494}, {0x65C2u, 0}, {0x65C5u, 493}, {0x65C6u, 0},
+  {0x65CBu, 493}, {0x65CCu, 0}, {0x65CFu, 493}, {0x65D0u, 0}, {0x65D7u, 493}, {0x65D8u, 0},
+  {0x65E0u, 494}, {0x65E1u, 0}, {0x65E2u, 493}, {0x65E3u, 0}, {0x65E5u, 493}, {0x65EAu, 0},
+  {0x65ECu, 491}, {0x65EDu, 494}, {0x65EEu, 0}, {0x65F6u, 494}, {0x65F7u, 0}, {0x65FAu, 493},
+  {0x65FBu, 0}, {0x6602u, 494}, {0x6603u, 0}, {0x6606u, 493}, {0x6607u, 490}, {0x6608u, 0},
+  {0x660Cu, 494}, {0x660Du, 0}, {0x660Eu, 493}, {0x660Fu, 494}, {0x6610u, 0}, {0x6613u, 493},
+  {0x6614u, 491}, {0x6615u, 0}, {0x661Fu, 493}, {0x6621u, 0}, {0x6625u, 493}, {0x6626u, 0},
+  {0x6627u, 491}, {0x6628u, 493}, {0x6629u, 0}, {0x662Du, 493}, {0x662Eu, 0}, {0x662Fu, 493},
+  {0x6630u, 0}, {0x663Cu, 491}, {0x663Du, 0}, {0x663Eu, 494}, {0x663Fu, 0}, {0x6642u, 490},
+  {0x6643u, 494}, {0x6644u, 0}, {0x6649u, 495}, {0x664Au, 0}, {0x664Bu, 494}, {0x664Cu, 0},
+  {0x6652u, 494}, {0x6654u, 0}, {0x665Au, 494}, {0x665Bu, 0}, {0x6668u, 494}, {0x6669u, 491},
+  {0x666Au, 0}, {0x666Eu, 493}, {0x6670u, 0}, {0x6674u, 493}, {0x6675u, 0}, {0x6676u, 493},
+  {0x6677u, 0}, {0x667Au, 494}, {0x667Bu, 0}, {0x6681u, 491}, {0x6682u, 494}, {0x6683u, 0},
+  {0x6687u, 491}, {0x6688u, 0}, {0x6691u, 493}, {0x6692u, 0}, {0x6696u, 493}, {0x6698u, 0},
+  {0x66A6u, 491}, {0x66A7u, 0}, {0x66ABu, 490}, {0x66ACu, 0}, {0x66AEu, 493}, {0x66AFu, 0},
+  {0x66B4u, 493}, {0x66B5u, 0}, {0x66C6u, 495}, {0x66C7u, 491}, {0x66C8u, 0}, {0x66C9u, 495},
+  {0x66CAu, 0}, {0x66D6u, 491}, {0x66D7u, 0}, {0x66DCu, 491}, {0x66DDu, 0}, {0x66F0u, 494},
+  {0x66F1u, 0}, {0x66F2u, 493}, {0x66F3u, 0}, {0x66F4u, 493}, {0x66F5u, 0}, {0x66F8u, 490},
+  {0x66F9u, 493}, {0x66FAu, 0}, {0x66FCu, 494}, {0x66FDu, 491}, {0x66FEu, 494}, {0x66FFu, 493},
+  {0x6701u, 0}, {0x6703u, 495}, {0x6704u, 0}, {0x6708u, 493}, {0x670Au, 0}, {0x670Bu, 494},
+  {0x670Cu, 0}, {0x670Du, 493}, {0x670Eu, 0}, {0x6715u, 491}, {0x6716u, 0}, {0x6717u, 493},
+  {0x6718u, 0}, {0x671Bu, 493}, {0x671Cu, 0}, {0x671Du, 493}, {0x671Eu, 0}, {0x671Fu, 493},
+  {0x6720u, 0}, {0x6728u, 493}, {0x6729u, 0}, {0x672Au, 493}, {0x672Eu, 0}, {0x672Fu, 494},
+  {0x6730u, 0}, {0x6731u, 493}, {0x6732u, 0}, {0x6734u, 491}, {0x6735u, 494}, {0x6736u, 0},
+  {0x673Au, 493}, {0x673Bu, 0}, {0x673Du, 491}, {0x673Eu, 0}, {0x6740u, 494}, {0x6741u, 0},
+  {0x6742u, 494}, {0x6744u, 0}, {0x6749u, 493}, {0x674Au, 0}, {0x674Eu, 494}, {0x674Fu, 0},
+  {0x6750u, 493}, {0x6752u, 0}, {0x675Cu, 494}, {0x675Du, 0}, {0x675Fu, 493}, {0x6760u, 0},
+  {0x6761u, 493}, {0x6762u, 0}, {0x6765u, 493}, {0x6766u, 0}, {0x6768u, 494}, {0x6769u, 0},
+  {0x676Fu, 493}, {0x6770u, 494}, {0x6771u, 490}, {0x6772u, 0}, {0x677Eu, 493}, {0x6780u, 0},
+  {0x6781u, 494}, {0x6782u, 0}, {0x6784u, 494}, {0x6785u, 0}, {0x6790u, 493}, {0x6791u, 0},
+  {0x6795u, 491}, {0x6796u, 0}, {0x6797u, 493}, {0x6798u, 0}, {0x679Au, 491}, {0x679Bu, 0},
+  {0x679Cu, 493}, {0x679Eu, 0}, {0x67A0u, 491}, {0x67A1u, 0}, {0x67A2u, 493}, {0x67A3u, 0},
+  {0x67AAu, 494}, {0x67ACu, 0}, {0x67AFu, 491}, {0x67B0u, 0}, {0x67B6u, 493}, {0x67B7u, 0},
+  {0x67C4u, 491}, {0x67C5u, 0}, {0x67CFu, 494}, {0x67D0u, 493}, {0x67D1u, 0}, {0x67D3u, 493},
+  {0x67D5u, 0}, {0x67E5u, 494}, {0x67E6u, 0}, {0x67ECu, 494}, {0x67EDu, 0}, {0x67EFu, 494},
+  {0x67F0u, 0}, {0x67F1u, 491}, {0x67F2u, 0}, {0x67F3u, 493}, {0x67F4u, 494}, {0x67F5u, 491},
+  {0x67F6u, 0}, {0x67FBu, 491}, {0x67FCu, 0}, {0x67FFu, 491}, {0x6800u, 0}, {0x6803u, 491},
+  {0x6805u, 0}, {0x6807u, 494}, {0x6808u, 0}, {0x680Bu, 494}, {0x680Cu, 0}, {0x680Fu, 494},
+  {0x6810u, 0}, {0x6811u, 494}, {0x6812u, 0}, {0x6813u, 491}, {0x6814u, 0}, {0x6821u, 493},
+  {0x6822u, 0}, {0x682Au, 491}, {0x682Bu, 0}, {0x6837u, 494}, {0x6838u, 493}, {0x683Au, 0},
+  {0x683Cu, 493}, {0x683Du, 491}, {0x683Eu, 0}, {0x6841u, 491}, {0x6842u, 0}, {0x6843u, 493},
+  {0x6844u, 0}, {0x6846u, 494}, {0x6847u, 0}, {0x6848u, 493}, {0x6849u, 0}, {0x684Cu, 494},
+  {0x684Du, 0}, {0x6851u, 493}, {0x6852u, 0}, {0x685Cu, 491}, {0x685Du, 0}, {0x685Fu, 491},
+  {0x6860u, 0}, {0x6863u, 494}, {0x6864u, 0}, {0x6865u, 494}, {0x6866u, 0}, {0x6881u, 494},
+  {0x6882u, 0}, {0x6885u, 493}, {0x6886u, 0}, {0x6897u, 491}, {0x6898u, 0}, {0x689Du, 495},
+  {0x689Eu, 0}, {0x68A6u, 494}, {0x68A7u, 0}, {0x68A8u, 490}, {0x68A9u, 0}, {0x68AFu, 494},
+  {0x68B0u, 493}, {0x68B1u, 0}, {0x68B5u, 494}, {0x68B6u, 0}, {0x68C0u, 494}, {0x68C1u, 0},
+  {0x68C4u, 490}, {0x68C5u, 0}, {0x68C9u, 494}, {0x68CAu, 0}, {0x68CBu, 493}, {0x68CCu, 0},
+  {0x68D2u, 493}, {0x68D3u, 0}, {0x68DAu, 493}, {0x68DBu, 0}, {0x68DFu, 491}, {0x68E0u, 0},
+  {0x68EEu, 493}, {0x68EFu, 0}, {0x68FAu, 491}, {0x68FBu, 0}, {0x6905u, 493}, {0x6906u, 0},
+  {0x690Du, 493}, {0x690Eu, 491}, {0x690Fu, 0}, {0x691Cu, 491}, {0x691Du, 0}, {0x6930u, 494},
+  {0x6931u, 0}, {0x694Au, 495}, {0x694Bu, 0}, {0x6953u, 495}, {0x6954u, 0}, {0x695Au, 494},
+  {0x695Bu, 0}, {0x696Du, 490}, {0x696Eu, 0}, {0x6975u, 490}, {0x6976u, 0}, {0x6977u, 491},
+  {0x6978u, 0}, {0x697Cu, 493}, {0x697Du, 491}, {0x697Eu, 0}, {0x6982u, 493}, {0x6983u, 0},
+  {0x699Cu, 494}, {0x699Du, 0}, {0x69AEu, 495}, {0x69AFu, 0}, {0x69CBu, 490}, {0x69CCu, 0},
+  {0x69CDu, 495}, {0x69CEu, 0}, {0x69D8u, 491}, {0x69D9u, 0}, {0x69FDu, 491}, {0x69FEu, 0},
+  {0x6A02u, 495}, {0x6A03u, 0}, {0x6A13u, 495}, {0x6A14u, 0}, {0x6A19u, 490}, {0x6A1Au, 0},
+  {0x6A1Eu, 495}, {0x6A1Fu, 0}, {0x6A21u, 493}, {0x6A22u, 0}, {0x6A23u, 495}, {0x6A24u, 0},
+  {0x6A29u, 491}, {0x6A2Bu, 0}, {0x6A31u, 494}, {0x6A32u, 0}, {0x6A39u, 490}, {0x6A3Au, 0},
+  {0x6A4Bu, 490}, {0x6A4Cu, 0}, {0x6A5Fu, 490}, {0x6A60u, 0}, {0x6A6Bu, 495}, {0x6A6Cu, 0},
+  {0x6A80u, 494}, {0x6A81u, 0}, {0x6A94u, 495}, {0x6A95u, 0}, {0x6AA2u, 495}, {0x6AA3u, 0},
+  {0x6B04u, 490}, {0x6B05u, 0}, {0x6B0Au, 495}, {0x6B0Bu, 0}, {0x6B20u, 493}, {0x6B22u, 494},
+  {0x6B24u, 0}, {0x6B27u, 493}, {0x6B28u, 0}, {0x6B32u, 493}, {0x6B33u, 0}, {0x6B3Au, 493},
+  {0x6B3Bu, 0}, {0x6B3Du, 495}, {0x6B3Eu, 493}, {0x6B3Fu, 0}, {0x6B49u, 494}, {0x6B4Au, 0},
+  {0x6B4Cu, 493}, {0x6B4Du, 0}, {0x6B50u, 495}, {0x6B51u, 0}, {0x6B53u, 491}, {0x6B54u, 0},
+  {0x6B61u, 495}, {0x6B62u, 493}, {0x6B64u, 494}, {0x6B66u, 493}, {0x6B67u, 0}, {0x6B69u, 491},
+  {0x6B6Au, 494}, {0x6B6Bu, 0}, {0x6B6Fu, 491}, {0x6B70u, 0}, {0x6B72u, 494}, {0x6B73u, 491},
+  {0x6B75u, 0}, {0x6B77u, 495}, {0x6B79u, 0}, {0x6B7Bu, 493}, {0x6B7Cu, 0}, {0x6B89u, 491},
+  {0x6B8Au, 493}, {0x6B8Cu, 0}, {0x6B96u, 491}, {0x6B97u, 0}, {0x6B98u, 495}, {0x6B99u, 0},
+  {0x6BB4u, 491}, {0x6BB5u, 493}, {0x6BB6u, 0}, {0x6BBAu, 490}, {0x6BBBu, 491}, {0x6BBCu, 495},
+  {0x6BBDu, 0}, {0x6BBFu, 491}, {0x6BC0u, 490}, {0x6BC1u, 0}, {0x6BC5u, 494}, {0x6BC6u, 0},
+  {0x6BCDu, 493}, {0x6BCEu, 491}, {0x6BCFu, 494}, {0x6BD0u, 0}, {0x6BD2u, 493}, {0x6BD3u, 0},
+  {0x6BD4u, 493}, {0x6BD5u, 494}, {0x6BD6u, 0}, {0x6BDBu, 493}, {0x6BDCu, 0}, {0x6BEBu, 494},
+  {0x6BECu, 0}, {0x6C0Fu, 493}, {0x6C10u, 0}, {0x6C11u, 493}, {0x6C12u, 0}, {0x6C14u, 494},
+  {0x6C15u, 0}, {0x6C17u, 491}, {0x6C18u, 0}, {0x6C1Bu, 494}, {0x6C1Cu, 0}, {0x6C23u, 495},
+  {0x6C24u, 0}, {0x6C34u, 493}, {0x6C35u, 0}, {0x6C37u, 491}, {0x6C38u, 493}, {0x6C39u, 0},
+  {0x6C3Eu, 491}, {0x6C3Fu, 0}, {0x6C41u, 491}, {0x6C42u, 493}, {0x6C43u, 0}, {0x6C47u, 494},
+  {0x6C48u, 0}, {0x6C49u, 494}, {0x6C4Au, 0}, {0x6C4Eu, 491}, {0x6C4Fu, 0}, {0x6C57u, 493},
+  {0x6C58u, 0}, {0x6C5Au, 491}, {0x6C5Bu, 0}, {0x6C5Du, 494}, {0x6C5Eu, 0}, {0x6C5Fu, 493},
+  {0x6C61u, 494}, {0x6C62u, 0}, {0x6C64u, 494}, {0x6C65u, 0}, {0x6C6Au, 494}, {0x6C6Bu, 0},
+  {0x6C70u, 491}, {0x6C71u, 0}, {0x6C76u, 494}, {0x6C77u, 0}, {0x6C7Au, 490}, {0x6C7Bu, 0},
+  {0x6C7Du, 493}, {0x6C7Eu, 0}, {0x6C83u, 493}, {0x6C84u, 0}, {0x6C88u, 493}, {0x6C89u, 494},
+  {0x6C8Au, 0}, {0x6C92u, 495}, {0x6C93u, 0}, {0x6C96u, 490}, {0x6C97u, 0}, {0x6C99u, 493},
+  {0x6C9Au, 0}, {0x6C9Fu, 494}, {0x6CA0u, 0}, {0x6CA1u, 493}, {0x6CA2u, 491}, {0x6CA3u, 0},
+  {0x6CA7u, 494}, {0x6CA8u, 0}, {0x6CB3u, 493}, {0x6CB4u, 0}, {0x6CB8u, 491}, {0x6CB9u, 493},
+  {0x6CBAu, 0}, {0x6CBBu, 493}, {0x6CBCu, 491}, {0x6CBDu, 0}, {0x6CBFu, 493}, {0x6CC0u, 0},
+  {0x6CC1u, 490}, {0x6CC2u, 0}, {0x6CC9u, 493}, {0x6CCBu, 0}, {0x6CCCu, 491}, {0x6CCDu, 0},
+  {0x6CD5u, 493}, {0x6CD6u, 0}, {0x6CDBu, 494}, {0x6CDCu, 0}, {0x6CE1u, 493}, {0x6CE4u, 0},
+  {0x6CE5u, 493}, {0x6CE6u, 0}, {0x6CE8u, 493}, {0x6CE9u, 0}, {0x6CF0u, 493}, {0x6CF1u, 0},
+  {0x6CF3u, 493}, {0x6CF4u, 0}, {0x6CFDu, 494}, {0x6CFEu, 0}, {0x6D0Bu, 493}, {0x6D0Cu, 0},
+  {0x6D17u, 493}, {0x6D18u, 0}, {0x6D1Bu, 494}, {0x6D1Cu, 0}, {0x6D1Eu, 493}, {0x6D1Fu, 0},
+  {0x6D25u, 493}, {0x6D26u, 0}, {0x6D29u, 495}, {0x6D2Au, 493}, {0x6D2Bu, 0}, {0x6D32u, 494},
+  {0x6D33u, 0}, {0x6D3Bu, 493}, {0x6D3Cu, 0}, {0x6D3Du, 494}, {0x6D3Eu, 493}, {0x6D3Fu, 0},
+  {0x6D41u, 493}, {0x6D42u, 0}, {0x6D44u, 491}, {0x6D45u, 493}, {0x6D46u, 0}, {0x6D4Bu, 494},
+  {0x6D4Cu, 0}, {0x6D4Eu, 494}, {0x6D50u, 0}, {0x6D51u, 494}, {0x6D52u, 0}, {0x6D53u, 494},
+  {0x6D54u, 0}, {0x6D59u, 494}, {0x6D5Au, 0}, {0x6D5Cu, 491}, {0x6D5Du, 0}, {0x6D66u, 493},
+  {0x6D67u, 0}, {0x6D69u, 494}, {0x6D6Au, 493}, {0x6D6Bu, 0}, {0x6D6Eu, 493}, {0x6D6Fu, 0},
+  {0x6D74u, 493}, {0x6D75u, 0}, {0x6D77u, 493}, {0x6D78u, 491}, {0x6D79u, 0}, {0x6D85u, 494},
+  {0x6D86u, 0}, {0x6D87u, 495}, {0x6D88u, 493}, {0x6D89u, 494}, {0x6D8Au, 0}, {0x6D99u, 491},
+  {0x6D9Au, 0}, {0x6D9Bu, 494}, {0x6D9Cu, 0}, {0x6DA8u, 494}, {0x6DA9u, 0}, {0x6DAFu, 493},
+  {0x6DB0u, 0}, {0x6DB2u, 493}, {0x6DB3u, 0}, {0x6DB5u, 494}, {0x6DB6u, 0}, {0x6DBCu, 490},
+  {0x6DBDu, 0}, {0x6DCBu, 494}, {0x6DCCu, 0}, {0x6DD1u, 493}, {0x6DD2u, 0}, {0x6DD8u, 494},
+  {0x6DD9u, 0}, {0x6DDAu, 495}, {0x6DDBu, 0}, {0x6DE1u, 493}, {0x6DE2u, 0}, {0x6DE8u, 495},
+  {0x6DE9u, 0}, {0x6DEBu, 491}, {0x6DECu, 0}, {0x6DF1u, 493}, {0x6DF2u, 0}, {0x6DF7u, 493},
+  {0x6DF8u, 0}, {0x6DFAu, 495}, {0x6DFBu, 493}, {0x6DFCu, 0}, {0x6E05u, 493}, {0x6E06u, 0},
+  {0x6E07u, 491}, {0x6E0Au, 0}, {0x6E0Bu, 491}, {0x6E0Cu, 0}, {0x6E10u, 494}, {0x6E11u, 0},
+  {0x6E13u, 491}, {0x6E14u, 0}, {0x6E1Bu, 490}, {0x6E1Cu, 0}, {0x6E21u, 493}, {0x6E22u, 0},
+  {0x6E23u, 494}, {0x6E24u, 0}, {0x6E26u, 491}, {0x6E27u, 0}, {0x6E29u, 493}, {0x6E2Au, 0},
+  {0x6E2Cu, 490}, {0x6E2Du, 0}, {0x6E2Fu, 493}, {0x6E30u, 0}, {0x6E34u, 494}, {0x6E35u, 0},
+  {0x6E38u, 494}, {0x6E39u, 0}, {0x6E56u, 493}, {0x6E57u, 0}, {0x6E67u, 491}, {0x6E68u, 0},
+  {0x6E6Fu, 490}, {0x6E70u, 0}, {0x6E7Eu, 493}, {0x6E7Fu, 491}, {0x6E81u, 0}, {0x6E90u, 493},
+  {0x6E91u, 0}, {0x6E96u, 490}, {0x6E97u, 0}, {0x6E9Cu, 494}, {0x6E9Du, 490}, {0x6E9Eu, 0},
+  {0x6EAAu, 494}, {0x6EABu, 495}, {0x6EACu, 0}, {0x6EB6u, 491}, {0x6EB7u, 0}, {0x6EBAu, 491},
+  {0x6EBBu, 0}, {0x6EC4u, 495}, {0x6EC5u, 490}, {0x6EC6u, 0}, {0x6ECBu, 493}, {0x6ECCu, 0},
+  {0x6ED1u, 493}, {0x6ED2u, 0}, {0x6EDDu, 491}, {0x6EDFu, 0}, {0x6EE1u, 494}, {0x6EE2u, 0},
+  {0x6EE5u, 494}, {0x6EE6u, 0}, {0x6EE8u, 494}, {0x6EE9u, 0}, {0x6EF4u, 493}, {0x6EF5u, 0},
+  {0x6EFEu, 495}, {0x6F00u, 0}, {0x6F01u, 491}, {0x6F02u, 493}, {0x6F03u, 0}, {0x6F06u, 491},
+  {0x6F07u, 0}, {0x6F0Fu, 493}, {0x6F10u, 0}, {0x6F14u, 493}, {0x6F15u, 0}, {0x6F20u, 493},
+  {0x6F21u, 0}, {0x6F22u, 490}, {0x6F23u, 0}, {0x6F2Bu, 493}, {0x6F2Cu, 491}, {0x6F2Du, 0},
+  {0x6F32u, 495}, {0x6F33u, 0}, {0x6F38u, 490}, {0x6F39u, 0}, {0x6F54u, 490}, {0x6F55u, 0},
+  {0x6F58u, 494}, {0x6F59u, 0}, {0x6F5Bu, 495}, {0x6F5Cu, 493}, {0x6F5Du, 0}, {0x6F5Fu, 491},
+  {0x6F60u, 0}, {0x6F64u, 491}, {0x6F65u, 0}, {0x6F6Eu, 493}, {0x6F6Fu, 0}, {0x6F70u, 491},
+  {0x6F71u, 0}, {0x6F84u, 491}, {0x6F85u, 0}, {0x6F8Eu, 494}, {0x6F8Fu, 0}, {0x6FA4u, 495},
+  {0x6FA5u, 0}, {0x6FB3u, 494}, {0x6FB4u, 0}, {0x6FC0u, 493}, {0x6FC1u, 491}, {0x6FC2u, 0},
+  {0x6FC3u, 490}, {0x6FC4u, 0}, {0x6FDFu, 495}, {0x6FE0u, 0}, {0x6FE4u, 495}, {0x6FE5u, 0},
+  {0x6FEBu, 490}, {0x6FECu, 0}, {0x6FEFu, 491}, {0x6FF0u, 0}, {0x6FF1u, 495}, {0x6FF2u, 0},
+  {0x700Fu, 495}, {0x7010u, 0}, {0x702Cu, 491}, {0x702Du, 0}, {0x704Cu, 494}, {0x704Du, 0},
+  {0x7063u, 495}, {0x7064u, 0}, {0x706Bu, 493}, {0x706Cu, 0}, {0x706Du, 494}, {0x706Eu, 0},
+  {0x706Fu, 493}, {0x7071u, 0}, {0x7075u, 494}, {0x7076u, 0}, {0x707Du, 490}, {0x707Eu, 0},
+  {0x707Fu, 494}, {0x7080u, 0}, {0x7089u, 493}, {0x708Au, 491}, {0x708Bu, 0}, {0x708Eu, 493},
+  {0x708Fu, 0}, {0x70ADu, 491}, {0x70AEu, 494}, {0x70AFu, 0}, {0x70B8u, 494}, {0x70B9u, 493},
+  {0x70BBu, 0}, {0x70C2u, 494}, {0x70C3u, 0}, {0x70C8u, 493}, {0x70C9u, 0}, {0x70CFu, 495},
+  {0x70D0u, 0}, {0x70E4u, 494}, {0x70E5u, 0}, {0x70E6u, 494}, {0x70E8u, 0}, {0x70EDu, 494},
+  {0x70EEu, 0}, {0x7121u, 490}, {0x7122u, 0}, {0x7126u, 493}, {0x7127u, 0}, {0x7136u, 493},
+  {0x7137u, 0}, {0x713Cu, 491}, {0x713Du, 0}, {0x714Cu, 494}, {0x714Du, 0}, {0x714Eu, 491},
+  {0x714Fu, 0}, {0x7159u, 490}, {0x715Au, 0}, {0x715Eu, 494}, {0x715Fu, 0}, {0x7167u, 493},
+  {0x7168u, 0}, {0x7169u, 490}, {0x716Au, 0}, {0x716Eu, 493}, {0x716Fu, 0}, {0x718Au, 493},
+  {0x718Bu, 0}, {0x719Fu, 493}, {0x71A0u, 0}, {0x71B1u, 490}, {0x71B2u, 0}, {0x71C3u, 493},
+  {0x71C4u, 0}, {0x71C8u, 495}, {0x71C9u, 0}, {0x71D2u, 495}, {0x71D3u, 0}, {0x71D5u, 494},
+  {0x71D6u, 0}, {0x71DFu, 495}, {0x71E0u, 0}, {0x71E5u, 491}, {0x71E6u, 0}, {0x7206u, 493},
+  {0x7207u, 0}, {0x7210u, 495}, {0x7211u, 0}, {0x721Bu, 495}, {0x721Cu, 0}, {0x722Au, 493},
+  {0x722Bu, 0}, {0x722Cu, 494}, {0x722Du, 495}, {0x722Eu, 0}, {0x7231u, 494}, {0x7232u, 0},
+  {0x7235u, 493}, {0x7237u, 494}, {0x7239u, 0}, {0x723Au, 495}, {0x723Bu, 0}, {0x723Du, 493},
+  {0x723Eu, 495}, {0x723Fu, 0}, {0x7246u, 495}, {0x7247u, 493}, {0x7249u, 0}, {0x724Cu, 494},
+  {0x724Du, 0}, {0x7259u, 493}, {0x725Au, 0}, {0x725Bu, 493}, {0x725Cu, 0}, {0x7260u, 495},
+  {0x7261u, 494}, {0x7263u, 0}, {0x7267u, 493}, {0x7268u, 0}, {0x7269u, 493}, {0x726Au, 0},
+  {0x7272u, 493}, {0x7273u, 0}, {0x7275u, 494}, {0x7276u, 0}, {0x7279u, 493}, {0x727Au, 494},
+  {0x727Bu, 0}, {0x727Du, 495}, {0x727Eu, 0}, {0x72A0u, 491}, {0x72A1u, 0}, {0x72A7u, 495},
+  {0x72A8u, 0}, {0x72ACu, 491}, {0x72ADu, 0}, {0x72AFu, 493}, {0x72B0u, 0}, {0x72B6u, 493},
+  {0x72B7u, 0}, {0x72B9u, 494}, {0x72BAu, 0}, {0x72C0u, 495}, {0x72C1u, 0}, {0x72C2u, 493},
+  {0x72C3u, 0}, {0x72D0u, 494}, {0x72D1u, 0}, {0x72D7u, 494}, {0x72D8u, 0}, {0x72D9u, 491},
+  {0x72DAu, 0}, {0x72E0u, 494}, {0x72E1u, 0}, {0x72E9u, 491}, {0x72EAu, 0}, {0x72ECu, 497},
+  {0x72EDu, 491}, {0x72EEu, 494}, {0x72EFu, 0}, {0x72F1u, 494}, {0x72F2u, 0}, {0x72FCu, 494},
+  {0x72FDu, 0}, {0x731Bu, 493}, {0x731Cu, 494}, {0x731Du, 0}, {0x731Fu, 491}, {0x7320u, 0},
+  {0x732Au, 494}, {0x732Bu, 491}, {0x732Cu, 0}, {0x732Eu, 493}, {0x732Fu, 0}, {0x7334u, 494},
+  {0x7335u, 0}, {0x7336u, 490}, {0x7337u, 0}, {0x733Fu, 491}, {0x7340u, 0}, {0x7344u, 490},
+  {0x7345u, 495}, {0x7346u, 0}, {0x734Eu, 495}, {0x734Fu, 0}, {0x7363u, 491}, {0x7364u, 0},
+  {0x7368u, 495}, {0x7369u, 0}, {0x7372u, 490}, {0x7373u, 0}, {0x7378u, 495}, {0x7379u, 0},
+  {0x737Bu, 495}, {0x737Cu, 0}, {0x7384u, 493}, {0x7385u, 0}, {0x7387u, 493}, {0x7388u, 0},
+  {0x7389u, 493}, {0x738Au, 0}, {0x738Bu, 493}, {0x738Cu, 0}, {0x739Bu, 494}, {0x739Cu, 0},
+  {0x73A9u, 493}, {0x73AAu, 0}, {0x73ABu, 494}, {0x73ACu, 0}, {0x73AFu, 494}, {0x73B1u, 0},
+  {0x73B2u, 494}, {0x73B3u, 0}, {0x73BBu, 494}, {0x73BCu, 0}, {0x73C0u, 494}, {0x73C1u, 0},
+  {0x73CAu, 494}, {0x73CBu, 0}, {0x73CDu, 493}, {0x73CEu, 0}, {0x73E0u, 493}, {0x73E1u, 0},
+  {0x73E5u, 495}, {0x73E6u, 0}, {0x73EDu, 493}, {0x73EEu, 0}, {0x73FEu, 490}, {0x73FFu, 0},
+  {0x7403u, 493}, {0x7404u, 0}, {0x7406u, 493}, {0x7407u, 0}, {0x7409u, 495}, {0x740Au, 494},
+  {0x740Bu, 0}, {0x742Au, 494}, {0x742Bu, 0}, {0x7433u, 494}, {0x7434u, 493}, {0x7435u, 0},
+  {0x743Cu, 494}, {0x743Du, 0}, {0x7459u, 494}, {0x745Au, 0}, {0x745Cu, 494}, {0x745Du, 0},
+  {0x745Eu, 494}, {0x7460u, 491}, {0x7461u, 0}, {0x7464u, 495}, {0x7465u, 0}, {0x746Au, 495},
+  {0x746Bu, 0}, {0x7470u, 494}, {0x7471u, 0}, {0x7476u, 494}, {0x7477u, 0}, {0x7483u, 493},
+  {0x7484u, 0}, {0x74A7u, 491}, {0x74A8u, 0}, {0x74B0u, 490}, {0x74B1u, 0}, {0x74BDu, 491},
+  {0x74BEu, 0}, {0x74DCu, 494}, {0x74DDu, 0}, {0x74E6u, 493}, {0x74E7u, 0}, {0x74F6u, 493},
+  {0x74F7u, 0}, {0x7518u, 493}, {0x7519u, 0}, {0x751Au, 493}, {0x751Bu, 0}, {0x751Cu, 494},
+  {0x751Du, 0}, {0x751Fu, 493}, {0x7520u, 0}, {0x7522u, 495}, {0x7523u, 491}, {0x7524u, 0},
+  {0x7528u, 493}, {0x7529u, 0}, {0x7530u, 493}, {0x7534u, 0}, {0x7535u, 494}, {0x7536u, 0},
+  {0x7537u, 493}, {0x7538u, 494}, {0x7539u, 0}, {0x753Au, 491}, {0x753Bu, 493}, {0x753Cu, 0},
+  {0x7545u, 494}, {0x7546u, 0}, {0x754Cu, 493}, {0x754Du, 0}, {0x754Fu, 491}, {0x7550u, 0},
+  {0x7551u, 491}, {0x7552u, 0}, {0x7554u, 491}, {0x7555u, 0}, {0x7559u, 493}, {0x755Au, 0},
+  {0x755Cu, 491}, {0x755Eu, 0}, {0x7562u, 495}, {0x7563u, 0}, {0x7565u, 493}, {0x7566u, 0},
+  {0x756Au, 493}, {0x756Bu, 495}, {0x756Cu, 0}, {0x7570u, 490}, {0x7571u, 0}, {0x7573u, 491},
+  {0x7574u, 0}, {0x7576u, 495}, {0x7577u, 0}, {0x757Fu, 491}, {0x7580u, 0}, {0x7586u, 494},
+  {0x7587u, 0}, {0x758Eu, 491}, {0x758Fu, 494}, {0x7590u, 0}, {0x7591u, 493}, {0x7592u, 0},
+  {0x7597u, 494}, {0x7598u, 0}, {0x75ABu, 491}, {0x75ACu, 0}, {0x75AFu, 494}, {0x75B0u, 0},
+  {0x75B2u, 493}, {0x75B3u, 0}, {0x75BCu, 494}, {0x75BDu, 0}, {0x75BEu, 493}, {0x75BFu, 0},
+  {0x75C5u, 493}, {0x75C6u, 0}, {0x75C7u, 491}, {0x75C8u, 0}, {0x75D5u, 493}, {0x75D6u, 0},
+  {0x75D8u, 491}, {0x75D9u, 0}, {0x75DBu, 493}, {0x75DCu, 0}, {0x75E2u, 491}, {0x75E3u, 0},
+  {0x75E9u, 491}, {0x75EAu, 0}, {0x75F4u, 493}, {0x75F5u, 0}, {0x760Bu, 495}, {0x760Cu, 0},
+  {0x760Du, 491}, {0x760Eu, 0}, {0x7642u, 490}, {0x7643u, 0}, {0x7652u, 491}, {0x7653u, 0},
+  {0x7656u, 491}, {0x7657u, 0}, {0x7661u, 495}, {0x7662u, 0}, {0x7678u, 494}, {0x7679u, 0},
+  {0x767Au, 491}, {0x767Bu, 493}, {0x767Cu, 495}, {0x767Du, 493}, {0x767Fu, 0}, {0x7684u, 493},
+  {0x7685u, 0}, {0x7686u, 493}, {0x7688u, 0}, {0x76AEu, 493}, {0x76AFu, 0}, {0x76BFu, 491},
+  {0x76C0u, 0}, {0x76C3u, 495}, {0x76C4u, 0}, {0x76C6u, 491}, {0x76C7u, 0}, {0x76C8u, 494},
+  {0x76C9u, 0}, {0x76CAu, 493}, {0x76CBu, 0}, {0x76D1u, 494}, {0x76D3u, 0}, {0x76D6u, 494},
+  {0x76D7u, 491}, {0x76D8u, 494}, {0x76D9u, 0}, {0x76DBu, 493}, {0x76DCu, 495}, {0x76DDu, 0},
+  {0x76DFu, 493}, {0x76E0u, 0}, {0x76E1u, 495}, {0x76E2u, 0}, {0x76E3u, 490}, {0x76E5u, 0},
+  {0x76E7u, 495}, {0x76E8u, 0}, {0x76EEu, 493}, {0x76EFu, 0}, {0x76F2u, 490}, {0x76F3u, 0},
+  {0x76F4u, 493}, {0x76F5u, 0}, {0x76F8u, 493}, {0x76F9u, 0}, {0x76FCu, 494}, {0x76FDu, 0},
+  {0x76FEu, 493}, {0x76FFu, 0}, {0x7701u, 493}, {0x7702u, 0}, {0x7709u, 493}, {0x770Au, 0},
+  {0x770Bu, 493}, {0x770Cu, 491}, {0x770Du, 0}, {0x771Fu, 493}, {0x7721u, 0}, {0x773Au, 491},
+  {0x773Bu, 0}, {0x773Cu, 493}, {0x773Du, 0}, {0x773Eu, 495}, {0x773Fu, 0}, {0x7740u, 493},
+  {0x7741u, 0}, {0x775Bu, 494}, {0x775Cu, 0}, {0x7761u, 493}, {0x7762u, 0}, {0x7763u, 493},
+  {0x7764u, 0}, {0x7766u, 491}, {0x7767u, 0}, {0x77A7u, 494}, {0x77A8u, 0}, {0x77ACu, 491},
+  {0x77ADu, 490}, {0x77AEu, 0}, {0x77B3u, 491}, {0x77B4u, 0}, {0x77DBu, 493}, {0x77DCu, 0},
+  {0x77E2u, 491}, {0x77E3u, 494}, {0x77E4u, 0}, {0x77E5u, 493}, {0x77E6u, 0}, {0x77EDu, 493},
+  {0x77EEu, 0}, {0x77EFu, 491}, {0x77F0u, 0}, {0x77F3u, 493}, {0x77F4u, 0}, {0x77F6u, 494},
+  {0x77F7u, 0}, {0x7801u, 494}, {0x7802u, 493}, {0x7803u, 0}, {0x780Du, 494}, {0x780Eu, 0},
+  {0x7814u, 493}, {0x7815u, 491}, {0x7816u, 0}, {0x7832u, 490}, {0x7833u, 0}, {0x7834u, 493},
+  {0x7835u, 0}, {0x7840u, 494}, {0x7841u, 0}, {0x7855u, 494}, {0x7856u, 0}, {0x785Du, 491},
+  {0x785Eu, 0}, {0x786Bu, 491}, {0x786Cu, 493}, {0x786Du, 0}, {0x786Eu, 494}, {0x786Fu, 0},
+  {0x7881u, 491}, {0x7882u, 0}, {0x788Du, 494}, {0x788Fu, 0}, {0x7891u, 491}, {0x7892u, 0},
+  {0x7897u, 494}, {0x7898u, 0}, {0x789Fu, 494}, {0x78A0u, 0}, {0x78A7u, 494}, {0x78A8u, 0},
+  {0x78A9u, 495}, {0x78AAu, 0}, {0x78B0u, 494}, {0x78B1u, 0}, {0x78BAu, 490}, {0x78BBu, 0},
+  {0x78BCu, 495}, {0x78BDu, 0}, {0x78C1u, 493}, {0x78C2u, 0}, {0x78C5u, 494}, {0x78C6u, 0},
+  {0x78E8u, 493}, {0x78E9u, 0}, {0x78EFu, 495}, {0x78F0u, 0}, {0x7901u, 491}, {0x7902u, 0},
+  {0x790Eu, 490}, {0x790Fu, 0}, {0x7919u, 495}, {0x791Au, 0}, {0x793Au, 493}, {0x793Bu, 0},
+  {0x793Cu, 493}, {0x793Du, 0}, {0x793Eu, 493}, {0x793Fu, 0}, {0x7948u, 491}, {0x794Au, 0},
+  {0x7955u, 495}, {0x7956u, 493}, {0x7957u, 0}, {0x795Au, 494}, {0x795Bu, 495}, {0x795Cu, 0},
+  {0x795Du, 493}, {0x795Fu, 0}, {0x7965u, 493}, {0x7966u, 0}, {0x7968u, 493}, {0x7969u, 0},
+  {0x796Du, 491}, {0x796Eu, 0}, {0x796Fu, 494}, {0x7970u, 0}, {0x7978u, 494}, {0x7979u, 0},
+  {0x797Fu, 495}, {0x7980u, 0}, {0x7981u, 493}, {0x7982u, 0}, {0x7985u, 493}, {0x7986u, 0},
+  {0x798Du, 490}, {0x798Eu, 495}, {0x798Fu, 493}, {0x7990u, 0}, {0x79AAu, 495}, {0x79ABu, 0},
+  {0x79AEu, 495}, {0x79AFu, 0}, {0x79BBu, 494}, {0x79BCu, 0}, {0x79C0u, 493}, {0x79C2u, 0},
+  {0x79CBu, 493}, {0x79CCu, 0}, {0x79CDu, 494}, {0x79CEu, 0}, {0x79D1u, 493}, {0x79D3u, 0},
+  {0x79D8u, 493}, {0x79D9u, 0}, {0x79DFu, 493}, {0x79E0u, 0}, {0x79E4u, 494}, {0x79E5u, 0},
+  {0x79E6u, 494}, {0x79E7u, 0}, {0x79E9u, 493}, {0x79EAu, 0}, {0x79EFu, 494}, {0x79F0u, 493},
+  {0x79F1u, 0}, {0x79FBu, 493}, {0x79FCu, 0}, {0x7A00u, 494}, {0x7A01u, 0}, {0x7A05u, 495},
+  {0x7A06u, 0}, {0x7A0Bu, 493}, {0x7A0Cu, 0}, {0x7A0Du, 494}, {0x7A0Eu, 493}, {0x7A0Fu, 0},
+  {0x7A1Au, 491}, {0x7A1Bu, 0}, {0x7A23u, 494}, {0x7A24u, 0}, {0x7A2Eu, 490}, {0x7A2Fu, 0},
+  {0x7A31u, 495}, {0x7A32u, 491}, {0x7A33u, 494}, {0x7A34u, 0}, {0x7A3Cu, 491}, {0x7A3Eu, 0},
+  {0x7A3Fu, 493}, {0x7A40u, 491}, {0x7A41u, 0}, {0x7A42u, 491}, {0x7A43u, 0}, {0x7A46u, 494},
+  {0x7A47u, 0}, {0x7A4Cu, 495}, {0x7A4Du, 490}, {0x7A4Eu, 0}, {0x7A4Fu, 491}, {0x7A50u, 0},
+  {0x7A69u, 495}, {0x7A6Au, 0}, {0x7A6Bu, 491}, {0x7A6Cu, 0}, {0x7A74u, 491}, {0x7A75u, 0},
+  {0x7A76u, 493}, {0x7A77u, 494}, {0x7A78u, 0}, {0x7A79u, 494}, {0x7A7Au, 493}, {0x7A7Bu, 0},
+  {0x7A7Fu, 494}, {0x7A80u, 0}, {0x7A81u, 493}, {0x7A82u, 0}, {0x7A83u, 491}, {0x7A84u, 0},
+  {0x7A92u, 491}, {0x7A94u, 0}, {0x7A97u, 494}, {0x7A98u, 0}, {0x7A9Du, 494}, {0x7A9Eu, 0},
+  {0x7A9Fu, 491}, {0x7AA0u, 0}, {0x7AA9u, 495}, {0x7AAAu, 0}, {0x7AAEu, 490}, {0x7AAFu, 491},
+  {0x7AB0u, 0}, {0x7AB6u, 495}, {0x7AB7u, 0}, {0x7ACBu, 497}, {0x7ACCu, 0}, {0x7AD9u, 494},
+  {0x7ADAu, 0}, {0x7ADCu, 491}, {0x7ADDu, 0}, {0x7ADEu, 494}, {0x7AE0u, 493}, {0x7AE1u, 0},
+  {0x7AE5u, 493}, {0x7AE6u, 0}, {0x7AEFu, 493}, {0x7AF0u, 0}, {0x7AF6u, 490}, {0x7AF7u, 0},
+  {0x7AF9u, 493}, {0x7AFAu, 0}, {0x7B11u, 493}, {0x7B12u, 0}, {0x7B14u, 494}, {0x7B15u, 0},
+  {0x7B1Bu, 493}, {0x7B1Cu, 0}, {0x7B26u, 493}, {0x7B27u, 0}, {0x7B28u, 494}, {0x7B29u, 0},
+  {0x7B2Cu, 493}, {0x7B2Du, 0}, {0x7B46u, 490}, {0x7B47u, 0}, {0x7B49u, 493}, {0x7B4Au, 0},
+  {0x7B4Bu, 493}, {0x7B4Cu, 0}, {0x7B51u, 494}, {0x7B52u, 491}, {0x7B53u, 0}, {0x7B54u, 493},
+  {0x7B55u, 0}, {0x7B56u, 493}, {0x7B57u, 0}, {0x7B79u, 494}, {0x7B7Au, 0}, {0x7B7Eu, 494},
+  {0x7B7Fu, 0}, {0x7B80u, 494}, {0x7B81u, 0}, {0x7B87u, 491}, {0x7B88u, 0}, {0x7B8Bu, 491},
+  {0x7B8Cu, 0}, {0x7B97u, 493}, {0x7B98u, 0}, {0x7BA1u, 493}, {0x7BA2u, 0}, {0x7BADu, 494},
+  {0x7BAEu, 0}, {0x7BB1u, 493}, {0x7BB2u, 0}, {0x7BB8u, 491}, {0x7BB9u, 0}, {0x7BC0u, 490},
+  {0x7BC1u, 0}, {0x7BC4u, 490}, {0x7BC5u, 0}, {0x7BC6u, 500}, {0x7BC7u, 494}, {0x7BC8u, 0},
+  {0x7BC9u, 490}, {0x7BCAu, 0}, {0x7BE4u, 491}, {0x7BE5u, 0}, {0x7BEEu, 494}, {0x7BEFu, 0},
+  {0x7C21u, 490}, {0x7C22u, 0}, {0x7C2Bu, 495}, {0x7C2Cu, 0}, {0x7C3Du, 495}, {0x7C3Eu, 0},
+  {0x7C3Fu, 493}, {0x7C40u, 0}, {0x7C43u, 495}, {0x7C44u, 0}, {0x7C4Cu, 495}, {0x7C4Du, 493},
+  {0x7C4Eu, 0}, {0x7C60u, 491}, {0x7C61u, 0}, {0x7C64u, 495}, {0x7C65u, 0}, {0x7C73u, 493},
+  {0x7C74u, 0}, {0x7C7Bu, 494}, {0x7C7Cu, 0}, {0x7C89u, 493}, {0x7C8Au, 0}, {0x7C8Bu, 491},
+  {0x7C8Cu, 0}, {0x7C92u, 493}, {0x7C93u, 0}, {0x7C97u, 493}, {0x7C98u, 491}, {0x7C99u, 0},
+  {0x7C9Bu, 491}, {0x7C9Cu, 0}, {0x7CA4u, 494}, {0x7CA5u, 0}, {0x7CA7u, 491}, {0x7CA8u, 0},
+  {0x7CB5u, 495}, {0x7CB6u, 0}, {0x7CB9u, 494}, {0x7CBAu, 0}, {0x7CBEu, 493}, {0x7CBFu, 0},
+  {0x7CCAu, 494}, {0x7CCBu, 0}, {0x7CD5u, 494}, {0x7CD6u, 493}, {0x7CD7u, 0}, {0x7CDFu, 494},
+  {0x7CE0u, 0}, {0x7CE7u, 491}, {0x7CE8u, 0}, {0x7CF8u, 491}, {0x7CF9u, 0}, {0x7CFBu, 493},
+  {0x7CFCu, 0}, {0x7CFEu, 490}, {0x7CFFu, 0}, {0x7D00u, 490}, {0x7D01u, 0}, {0x7D04u, 490},
+  {0x7D06u, 0}, {0x7D0Bu, 491}, {0x7D0Cu, 0}, {0x7D0Du, 490}, {0x7D0Eu, 0}, {0x7D10u, 495},
+  {0x7D11u, 0}, {0x7D14u, 490}, {0x7D15u, 0}, {0x7D19u, 490}, {0x7D1Cu, 0}, {0x7D20u, 493},
+  {0x7D21u, 491}, {0x7D22u, 493}, {0x7D23u, 0}, {0x7D27u, 494}, {0x7D28u, 0}, {0x7D2Bu, 493},
+  {0x7D2Cu, 0}, {0x7D2Fu, 493}, {0x7D30u, 490}, {0x7D31u, 0}, {0x7D33u, 491}, {0x7D34u, 0},
+  {0x7D39u, 490}, {0x7D3Au, 491}, {0x7D3Bu, 0}, {0x7D42u, 490}, {0x7D43u, 0}, {0x7D44u, 490},
+  {0x7D45u, 0}, {0x7D4Cu, 491}, {0x7D4Du, 0}, {0x7D50u, 490}, {0x7D51u, 0}, {0x7D55u, 495},
+  {0x7D56u, 0}, {0x7D5Eu, 491}, {0x7D5Fu, 0}, {0x7D61u, 490}, {0x7D62u, 0}, {0x7D66u, 490},
+  {0x7D67u, 0}, {0x7D71u, 490}, {0x7D72u, 495}, {0x7D73u, 0}, {0x7D75u, 491}, {0x7D77u, 0},
+  {0x7D79u, 491}, {0x7D7Au, 0}, {0x7D93u, 495}, {0x7D94u, 0}, {0x7D99u, 491}, {0x7D9Bu, 0},
+  {0x7D9Cu, 495}, {0x7D9Du, 0}, {0x7DA0u, 495}, {0x7DA1u, 0}, {0x7DADu, 490}, {0x7DAEu, 0},
+  {0x7DB1u, 490}, {0x7DB3u, 0}, {0x7DBBu, 491}, {0x7DBCu, 0}, {0x7DBFu, 491}, {0x7DC0u, 0},
+  {0x7DCAu, 490}, {0x7DCBu, 0}, {0x7DCFu, 491}, {0x7DD0u, 0}, {0x7DD1u, 491}, {0x7DD2u, 490},
+  {0x7DD3u, 0}, {0x7DDAu, 490}, {0x7DDBu, 0}, {0x7DE0u, 491}, {0x7DE1u, 0}, {0x7DE3u, 495},
+  {0x7DE4u, 0}, {0x7DE8u, 490}, {0x7DEAu, 0}, {0x7DECu, 495}, {0x7DEDu, 0}, {0x7DEFu, 490},
+  {0x7DF0u, 0}, {0x7DF4u, 490}, {0x7DF5u, 0}, {0x7DFBu, 491}, {0x7DFCu, 0}, {0x7E01u, 491},
+  {0x7E02u, 0}, {0x7E04u, 491}, {0x7E05u, 0}, {0x7E1Bu, 490}, {0x7E1Cu, 0}, {0x7E23u, 495},
+  {0x7E24u, 0}, {0x7E26u, 491}, {0x7E27u, 0}, {0x7E2Bu, 491}, {0x7E2Cu, 0}, {0x7E2Eu, 490},
+  {0x7E2Fu, 0}, {0x7E31u, 495}, {0x7E32u, 0}, {0x7E3Du, 495}, {0x7E3Eu, 490}, {0x7E3Fu, 0},
+  {0x7E41u, 493}, {0x7E42u, 0}, {0x7E46u, 495}, {0x7E47u, 0}, {0x7E4Au, 491}, {0x7E4Bu, 0},
+  {0x7E54u, 490}, {0x7E55u, 491}, {0x7E56u, 0}, {0x7E5Eu, 495}, {0x7E5Fu, 0}, {0x7E6Au, 495},
+  {0x7E6Bu, 0}, {0x7E6Du, 491}, {0x7E6Eu, 0}, {0x7E70u, 491}, {0x7E71u, 0}, {0x7E73u, 495},
+  {0x7E74u, 0}, {0x7E7Cu, 495}, {0x7E7Du, 0}, {0x7E8Cu, 495}, {0x7E8Du, 0}, {0x7EA2u, 494},
+  {0x7EA3u, 0}, {0x7EA6u, 494}, {0x7EA8u, 0}, {0x7EAAu, 494}, {0x7EABu, 0}, {0x7EAFu, 494},
+  {0x7EB0u, 0}, {0x7EB2u, 494}, {0x7EB4u, 0}, {0x7EB5u, 494}, {0x7EB6u, 0}, {0x7EB7u, 494},
+  {0x7EB9u, 0}, {0x7EBDu, 494}, {0x7EBEu, 0}, {0x7EBFu, 494}, {0x7EC0u, 0}, {0x7EC3u, 494},
+  {0x7EC5u, 0}, {0x7EC6u, 494}, {0x7EC9u, 0}, {0x7ECDu, 494}, {0x7ECEu, 0}, {0x7ECFu, 494},
+  {0x7ED0u, 0}, {0x7ED3u, 494}, {0x7ED4u, 0}, {0x7ED5u, 494}, {0x7ED6u, 0}, {0x7ED8u, 494},
+  {0x7EDAu, 0}, {0x7EDCu, 494}, {0x7EDEu, 0}, {0x7EDFu, 494}, {0x7EE0u, 0}, {0x7EE7u, 494},
+  {0x7EE8u, 0}, {0x7EE9u, 494}, {0x7EEBu, 0}, {0x7EEDu, 494}, {0x7EEEu, 0}, {0x7EF4u, 494},
+  {0x7EF6u, 0}, {0x7EFCu, 494}, {0x7EFDu, 0}, {0x7EFFu, 494}, {0x7F00u, 0}, {0x7F05u, 494},
+  {0x7F06u, 0}, {0x7F13u, 494}, {0x7F14u, 0}, {0x7F16u, 494}, {0x7F17u, 0}, {0x7F18u, 494},
+  {0x7F19u, 0}, {0x7F20u, 494}, {0x7F21u, 0}, {0x7F29u, 494}, {0x7F2Au, 0}, {0x7F34u, 494},
+  {0x7F35u, 0}, {0x7F36u, 493}, {0x7F37u, 0}, {0x7F38u, 494}, {0x7F39u, 0}, {0x7F3Au, 494},
+  {0x7F3Bu, 0}, {0x7F50u, 494}, {0x7F52u, 0}, {0x7F55u, 494}, {0x7F56u, 0}, {0x7F57u, 494},
+  {0x7F58u, 0}, {0x7F5Au, 494}, {0x7F5Bu, 0}, {0x7F62u, 494}, {0x7F63u, 0}, {0x7F6Au, 493},
+  {0x7F6Bu, 0}, {0x7F6Eu, 493}, {0x7F6Fu, 0}, {0x7F70u, 490}, {0x7F71u, 0}, {0x7F72u, 493},
+  {0x7F73u, 0}, {0x7F75u, 490}, {0x7F76u, 0}, {0x7F77u, 490}, {0x7F78u, 0}, {0x7F85u, 490},
+  {0x7F86u, 0}, {0x7F8Au, 493}, {0x7F8Bu, 0}, {0x7F8Eu, 493}, {0x7F8Fu, 0}, {0x7F9Eu, 493},
+  {0x7F9Fu, 0}, {0x7FA4u, 493}, {0x7FA5u, 0}, {0x7FA8u, 491}, {0x7FA9u, 490}, {0x7FAAu, 0},
+  {0x7FAFu, 494}, {0x7FB0u, 0}, {0x7FBDu, 493}, {0x7FBEu, 0}, {0x7FC1u, 493}, {0x7FC2u, 0},
+  {0x7FC5u, 494}, {0x7FC6u, 0}, {0x7FCCu, 491}, {0x7FCDu, 0}, {0x7FD2u, 490}, {0x7FD3u, 0},
+  {0x7FD4u, 494}, {0x7FD5u, 0}, {0x7FD8u, 494}, {0x7FD9u, 0}, {0x7FE0u, 494}, {0x7FE1u, 0},
+  {0x7FF0u, 494}, {0x7FF1u, 0}, {0x7FF9u, 495}, {0x7FFAu, 0}, {0x7FFBu, 493}, {0x7FFDu, 0},
+  {0x8000u, 494}, {0x8001u, 493}, {0x8002u, 0}, {0x8003u, 493}, {0x8004u, 0}, {0x8005u, 493},
+  {0x8006u, 0}, {0x800Cu, 494}, {0x800Eu, 0}, {0x8010u, 493}, {0x8011u, 0}, {0x8015u, 491},
+  {0x8016u, 0}, {0x8017u, 493}, {0x8018u, 0}, {0x8033u, 493}, {0x8034u, 0}, {0x8036u, 494},
+  {0x8037u, 0}, {0x804Au, 494}, {0x804Bu, 0}, {0x804Cu, 494}, {0x804Du, 0}, {0x8054u, 494},
+  {0x8055u, 0}, {0x8056u, 490}, {0x8057u, 0}, {0x8058u, 494}, {0x8059u, 0}, {0x805Au, 494},
+  {0x805Bu, 0}, {0x805Eu, 490}, {0x805Fu, 0}, {0x806Au, 494}, {0x806Bu, 0}, {0x806Fu, 495},
+  {0x8071u, 0}, {0x8072u, 495}, {0x8073u, 0}, {0x8074u, 491}, {0x8075u, 0}, {0x8077u, 490},
+  {0x8078u, 0}, {0x807Du, 495}, {0x807Eu, 0}, {0x8089u, 493}, {0x808Au, 0}, {0x808Cu, 491},
+  {0x808Du, 0}, {0x8096u, 493}, {0x8097u, 0}, {0x8098u, 491}, {0x8099u, 0}, {0x809Au, 494},
+  {0x809Bu, 0}, {0x809Du, 491}, {0x809Eu, 0}, {0x80A1u, 493}, {0x80A2u, 491}, {0x80A3u, 0},
+  {0x80A4u, 494}, {0x80A5u, 493}, {0x80A6u, 0}, {0x80A9u, 493}, {0x80AAu, 491}, {0x80ABu, 0},
+  {0x80AFu, 493}, {0x80B0u, 0}, {0x80B2u, 493}, {0x80B3u, 0}, {0x80BAu, 491}, {0x80BBu, 0},
+  {0x80C1u, 494}, {0x80C2u, 0}, {0x80C3u, 491}, {0x80C4u, 0}, {0x80C6u, 493}, {0x80C7u, 0},
+  {0x80CCu, 493}, {0x80CDu, 0}, {0x80CEu, 493}, {0x80CFu, 0}, {0x80D6u, 494}, {0x80D7u, 0},
+  {0x80DCu, 494}, {0x80DDu, 0}, {0x80DEu, 493}, {0x80DFu, 0}, {0x80E1u, 494}, {0x80E2u, 0},
+  {0x80F4u, 491}, {0x80F5u, 0}, {0x80F6u, 494}, {0x80F7u, 0}, {0x80F8u, 493}, {0x80F9u, 0},
+  {0x80FDu, 493}, {0x80FEu, 0}, {0x8102u, 491}, {0x8103u, 0}, {0x8105u, 491}, {0x8106u, 494},
+  {0x8107u, 491}, {0x8109u, 0}, {0x810Au, 491}, {0x810Bu, 0}, {0x8111u, 494}, {0x8112u, 0},
+  {0x811Au, 491}, {0x811Bu, 0}, {0x812Bu, 495}, {0x812Cu, 0}, {0x8131u, 493}, {0x8132u, 0},
+  {0x8133u, 491}, {0x8134u, 0}, {0x8138u, 494}, {0x8139u, 0}, {0x814Au, 494}, {0x814Bu, 0},
+  {0x814Eu, 491}, {0x814Fu, 0}, {0x8150u, 493}, {0x8151u, 0}, {0x8153u, 494}, {0x8154u, 495},
+  {0x8155u, 491}, {0x8156u, 0}, {0x8166u, 495}, {0x8167u, 0}, {0x816Bu, 491}, {0x816Cu, 0},
+  {0x8170u, 493}, {0x8171u, 0}, {0x8173u, 495}, {0x8174u, 0}, {0x8178u, 491}, {0x8179u, 493},
+  {0x817Au, 491}, {0x817Bu, 0}, {0x817Eu, 494}, {0x8180u, 0}, {0x819Au, 491}, {0x819Bu, 0},
+  {0x819Cu, 491}, {0x819Eu, 0}, {0x81A8u, 491}, {0x81A9u, 0}, {0x81B3u, 491}, {0x81B4u, 0},
+  {0x81BDu, 495}, {0x81BEu, 0}, {0x81C2u, 494}, {0x81C3u, 0}, {0x81C6u, 491}, {0x81C7u, 0},
+  {0x81C9u, 495}, {0x81CAu, 0}, {0x81D3u, 491}, {0x81D4u, 0}, {0x81D8u, 495}, {0x81D9u, 0},
+  {0x81E3u, 493}, {0x81E4u, 0}, {0x81E5u, 495}, {0x81E6u, 0}, {0x81E8u, 490}, {0x81E9u, 0},
+  {0x81EAu, 493}, {0x81EBu, 0}, {0x81EDu, 493}, {0x81EEu, 0}, {0x81F3u, 493}, {0x81F5u, 0},
+  {0x81FAu, 495}, {0x81FBu, 0}, {0x81FCu, 491}, {0x81FDu, 0}, {0x8207u, 494}, {0x8208u, 490},
+  {0x8209u, 495}, {0x820Bu, 0}, {0x820Cu, 493}, {0x820Du, 494}, {0x820Eu, 491}, {0x820Fu, 0},
+  {0x8212u, 494}, {0x8213u, 0}, {0x8217u, 491}, {0x8218u, 0}, {0x821Eu, 493}, {0x8220u, 0},
+  {0x822Au, 493}, {0x822Bu, 0}, {0x822Cu, 493}, {0x822Du, 0}, {0x8230u, 494}, {0x8231u, 0},
+  {0x8236u, 491}, {0x8238u, 0}, {0x8239u, 493}, {0x823Au, 0}, {0x8247u, 491}, {0x8248u, 0},
+  {0x8266u, 490}, {0x8267u, 0}, {0x826Fu, 493}, {0x8270u, 0}, {0x8272u, 493}, {0x8273u, 0},
+  {0x8276u, 491}, {0x8277u, 0}, {0x827Au, 494}, {0x827Bu, 0}, {0x827Eu, 494}, {0x827Fu, 0},
+  {0x8282u, 494}, {0x8283u, 0}, {0x828Bu, 491}, {0x828Cu, 0}, {0x8292u, 494}, {0x8293u, 0},
+  {0x829Du, 493}, {0x829Eu, 0}, {0x82A6u, 494}, {0x82A7u, 0}, {0x82ACu, 494}, {0x82AEu, 0},
+  {0x82AFu, 491}, {0x82B0u, 0}, {0x82B1u, 493}, {0x82B2u, 0}, {0x82B3u, 493}, {0x82B4u, 0},
+  {0x82B8u, 491}, {0x82B9u, 0}, {0x82BDu, 491}, {0x82BEu, 0}, {0x82CDu, 494}, {0x82CEu, 0},
+  {0x82CFu, 494}, {0x82D0u, 0}, {0x82D7u, 493}, {0x82D8u, 0}, {0x82DBu, 491}, {0x82DCu, 0},
+  {0x82E5u, 493}, {0x82E7u, 0}, {0x82F1u, 493}, {0x82F2u, 0}, {0x8302u, 493}, {0x8303u, 494},
+  {0x8304u, 0}, {0x8305u, 495}, {0x8306u, 0}, {0x830Eu, 491}, {0x830Fu, 0}, {0x8328u, 493},
+  {0x8329u, 0}, {0x832Bu, 494}, {0x832Cu, 0}, {0x8332u, 495}, {0x8333u, 0}, {0x8336u, 493},
+  {0x8337u, 0}, {0x8349u, 493}, {0x834Au, 0}, {0x8350u, 494}, {0x8351u, 0}, {0x8352u, 493},
+  {0x8353u, 0}, {0x8358u, 491}, {0x8359u, 0}, {0x8363u, 494}, {0x8364u, 0}, {0x836Fu, 494},
+  {0x8370u, 0}, {0x8377u, 493}, {0x8378u, 0}, {0x837Cu, 495}, {0x837Du, 0}, {0x8389u, 494},
+  {0x838Au, 495}, {0x838Bu, 0}, {0x838Eu, 494}, {0x838Fu, 0}, {0x83AAu, 494}, {0x83ACu, 0},
+  {0x83B1u, 494}, {0x83B3u, 0}, {0x83B7u, 494}, {0x83B8u, 0}, {0x83CAu, 491}, {0x83CBu, 0},
+  {0x83CCu, 491}, {0x83CDu, 0}, {0x83D3u, 491}, {0x83D4u, 0}, {0x83DCu, 493}, {0x83DDu, 0},
+  {0x83E9u, 494}, {0x83EAu, 0}, {0x83EFu, 490}, {0x83F0u, 0}, {0x83F2u, 494}, {0x83F3u, 0},
+  {0x8404u, 494}, {0x8405u, 0}, {0x840Au, 495}, {0x840Bu, 0}, {0x840Du, 494}, {0x840Eu, 491},
+  {0x840Fu, 0}, {0x8424u, 494}, {0x8426u, 0}, {0x8427u, 494}, {0x8429u, 0}, {0x842Cu, 495},
+  {0x842Du, 0}, {0x843Du, 493}, {0x843Eu, 0}, {0x8449u, 490}, {0x844Au, 0}, {0x8457u, 493},
+  {0x8458u, 0}, {0x845Bu, 493}, {0x845Cu, 0}, {0x8461u, 494}, {0x8462u, 0}, {0x846Cu, 491},
+  {0x846Du, 0}, {0x8482u, 494}, {0x8483u, 0}, {0x848Bu, 494}, {0x848Cu, 0}, {0x8499u, 494},
+  {0x849Au, 0}, {0x84B2u, 495}, {0x84B3u, 0}, {0x84B8u, 491}, {0x84B9u, 0}, {0x84BCu, 495},
+  {0x84BDu, 0}, {0x84C4u, 491}, {0x84C5u, 0}, {0x84C9u, 494}, {0x84CAu, 0}, {0x84CBu, 490},
+  {0x84CCu, 0}, {0x84DDu, 494}, {0x84DEu, 0}, {0x84ECu, 494}, {0x84EDu, 0}, {0x84EEu, 495},
+  {0x84EFu, 0}, {0x8511u, 493}, {0x8512u, 0}, {0x8515u, 495}, {0x8516u, 0}, {0x8521u, 494},
+  {0x8522u, 0}, {0x8523u, 495}, {0x8524u, 0}, {0x8535u, 491}, {0x8536u, 0}, {0x853Du, 491},
+  {0x853Eu, 0}, {0x856Du, 495}, {0x856Eu, 0}, {0x8584u, 493}, {0x8585u, 0}, {0x85A6u, 490},
+  {0x85A7u, 0}, {0x85A9u, 495}, {0x85AAu, 493}, {0x85ABu, 491}, {0x85ADu, 0}, {0x85C9u, 494},
+  {0x85CAu, 0}, {0x85CDu, 490}, {0x85CEu, 0}, {0x85CFu, 501}, {0x85D0u, 0}, {0x85DDu, 495},
+  {0x85DEu, 0}, {0x85E4u, 493}, {0x85E5u, 495}, {0x85E6u, 0}, {0x85E9u, 491}, {0x85EAu, 0},
+  {0x85FBu, 491}, {0x85FCu, 0}, {0x8606u, 495}, {0x8608u, 0}, {0x862Du, 495}, {0x862Eu, 0},
+  {0x864Eu, 493}, {0x864Fu, 0}, {0x8650u, 491}, {0x8651u, 494}, {0x8652u, 0}, {0x8655u, 495},
+  {0x8656u, 0}, {0x865Au, 491}, {0x865Bu, 495}, {0x865Cu, 491}, {0x865Du, 0}, {0x865Eu, 491},
+  {0x865Fu, 495}, {0x8660u, 0}, {0x8667u, 495}, {0x8668u, 0}, {0x866Bu, 493}, {0x866Cu, 0},
+  {0x8679u, 493}, {0x867Au, 0}, {0x867Du, 494}, {0x867Fu, 0}, {0x8681u, 494}, {0x8682u, 0},
+  {0x868Au, 491}, {0x868Bu, 0}, {0x8695u, 491}, {0x8696u, 0}, {0x86C7u, 493}, {0x86C8u, 0},
+  {0x86CBu, 494}, {0x86CCu, 0}, {0x86CDu, 491}, {0x86CEu, 0}, {0x86D9u, 494}, {0x86DAu, 0},
+  {0x86EEu, 493}, {0x86EFu, 0}, {0x8702u, 493}, {0x8703u, 0}, {0x871Cu, 493}, {0x871Du, 0},
+  {0x8776u, 494}, {0x8777u, 0}, {0x878Du, 493}, {0x878Eu, 0}, {0x87A2u, 495}, {0x87A3u, 0},
+  {0x87F2u, 494}, {0x87F3u, 0}, {0x87F9u, 494}, {0x87FAu, 0}, {0x880Du, 495}, {0x880Eu, 0},
+  {0x8822u, 494}, {0x8823u, 0}, {0x883Bu, 495}, {0x883Cu, 0}, {0x8840u, 493}, {0x8841u, 0},
+  {0x8846u, 491}, {0x8847u, 0}, {0x884Cu, 493}, {0x884Du, 0}, {0x8853u, 490}, {0x8854u, 0},
+  {0x8857u, 493}, {0x8858u, 0}, {0x885Bu, 490}, {0x885Cu, 0}, {0x885Du, 490}, {0x885Eu, 0},
+  {0x8861u, 493}, {0x8862u, 0}, {0x8863u, 493}, {0x8864u, 0}, {0x8865u, 494}, {0x8866u, 0},
+  {0x8868u, 493}, {0x8869u, 0}, {0x8870u, 491}, {0x8871u, 0}, {0x8877u, 491}, {0x8878u, 0},
+  {0x888Bu, 493}, {0x888Cu, 0}, {0x8896u, 491}, {0x8897u, 0}, {0x88ABu, 493}, {0x88ACu, 0},
+  {0x88ADu, 494}, {0x88AEu, 0}, {0x88C1u, 493}, {0x88C3u, 0}, {0x88C5u, 493}, {0x88C6u, 0},
+  {0x88CFu, 490}, {0x88D0u, 0}, {0x88D5u, 493}, {0x88D6u, 0}, {0x88DCu, 490}, {0x88DDu, 495},
+  {0x88DEu, 0}, {0x88E1u, 495}, {0x88E2u, 0}, {0x88E4u, 494}, {0x88E5u, 0}, {0x88F8u, 491},
+  {0x88F9u, 0}, {0x88FDu, 490}, {0x88FEu, 491}, {0x88FFu, 0}, {0x8907u, 490}, {0x8908u, 0},
+  {0x8910u, 491}, {0x8911u, 0}, {0x8912u, 491}, {0x8913u, 0}, {0x8932u, 495}, {0x8933u, 0},
+  {0x895Fu, 491}, {0x8960u, 0}, {0x8972u, 491}, {0x8973u, 0}, {0x897Fu, 497}, {0x8980u, 0},
+  {0x8981u, 493}, {0x8982u, 0}, {0x8986u, 493}, {0x8987u, 491}, {0x8988u, 0}, {0x898Bu, 490},
+  {0x898Cu, 0}, {0x898Fu, 490}, {0x8990u, 0}, {0x8996u, 490}, {0x8997u, 0}, {0x899Au, 491},
+  {0x899Bu, 0}, {0x89A7u, 491}, {0x89A8u, 0}, {0x89AAu, 493}, {0x89ABu, 0}, {0x89B3u, 491},
+  {0x89B4u, 0}, {0x89BAu, 495}, {0x89BBu, 0}, {0x89BDu, 495}, {0x89BEu, 0}, {0x89C0u, 495},
+  {0x89C1u, 494}, {0x89C3u, 0}, {0x89C4u, 494}, {0x89C5u, 0}, {0x89C6u, 494}, {0x89C7u, 0},
+  {0x89C8u, 494}, {0x89CAu, 0}, {0x89D2u, 493}, {0x89D3u, 0}, {0x89E3u, 493}, {0x89E4u, 0},
+  {0x89E6u, 491}, {0x89E7u, 0}, {0x89F8u, 495}, {0x89F9u, 0}, {0x8A00u, 493}, {0x8A01u, 0},
+  {0x8A02u, 490}, {0x8A03u, 491}, {0x8A04u, 0}, {0x8A08u, 490}, {0x8A09u, 0}, {0x8A0Au, 495},
+  {0x8A0Bu, 0}, {0x8A0Eu, 490}, {0x8A0Fu, 0}, {0x8A13u, 490}, {0x8A14u, 0}, {0x8A17u, 490},
+  {0x8A19u, 0}, {0x8A1Fu, 491}, {0x8A20u, 0}, {0x8A25u, 495}, {0x8A26u, 0}, {0x8A2Au, 490},
+  {0x8A2Bu, 0}, {0x8A2Du, 490}, {0x8A2Eu, 0}, {0x8A31u, 490}, {0x8A32u, 0}, {0x8A33u, 491},
+  {0x8A34u, 490}, {0x8A35u, 0}, {0x8A3Au, 491}, {0x8A3Bu, 495}, {0x8A3Cu, 490}, {0x8A3Du, 0},
+  {0x8A50u, 491}, {0x8A51u, 0}, {0x8A54u, 491}, {0x8A55u, 490}, {0x8A56u, 0}, {0x8A5Eu, 490},
+  {0x8A5Fu, 0}, {0x8A60u, 491}, {0x8A61u, 0}, {0x8A62u, 495}, {0x8A63u, 491}, {0x8A64u, 0},
+  {0x8A66u, 490}, {0x8A67u, 0}, {0x8A69u, 490}, {0x8A6Au, 0}, {0x8A6Eu, 491}, {0x8A6Fu, 0},
+  {0x8A70u, 491}, {0x8A71u, 490}, {0x8A74u, 0}, {0x8A87u, 490}, {0x8A88u, 0}, {0x8A89u, 493},
+  {0x8A8Au, 0}, {0x8A8Cu, 490}, {0x8A8Eu, 0}, {0x8A93u, 493}, {0x8A94u, 0}, {0x8A95u, 490},
+  {0x8A96u, 0}, {0x8A98u, 491}, {0x8A99u, 0}, {0x8A9Eu, 490}, {0x8A9Fu, 0}, {0x8AA0u, 490},
+  {0x8AA1u, 0}, {0x8AA4u, 490}, {0x8AA5u, 0}, {0x8AAAu, 495}, {0x8AABu, 0}, {0x8AACu, 491},
+  {0x8AAEu, 0}, {0x8AB0u, 490}, {0x8AB1u, 0}, {0x8AB2u, 490}, {0x8AB3u, 0}, {0x8ABCu, 495},
+  {0x8ABDu, 0}, {0x8ABFu, 490}, {0x8AC0u, 0}, {0x8AC7u, 490}, {0x8AC8u, 0}, {0x8ACBu, 490},
+  {0x8ACCu, 0}, {0x8AD2u, 495}, {0x8AD3u, 0}, {0x8AD6u, 490}, {0x8AD7u, 0}, {0x8AE6u, 491},
+  {0x8AE8u, 0}, {0x8AEDu, 491}, {0x8AEFu, 0}, {0x8AF8u, 490}, {0x8AF9u, 0}, {0x8AFAu, 495},
+  {0x8AFBu, 0}, {0x8AFEu, 490}, {0x8AFFu, 0}, {0x8B00u, 490}, {0x8B01u, 491}, {0x8B02u, 495},
+  {0x8B03u, 0}, {0x8B04u, 491}, {0x8B05u, 0}, {0x8B0Eu, 491}, {0x8B0Fu, 0}, {0x8B19u, 491},
+  {0x8B1Au, 0}, {0x8B1Bu, 490}, {0x8B1Cu, 0}, {0x8B1Du, 490}, {0x8B1Eu, 0}, {0x8B21u, 491},
+  {0x8B22u, 0}, {0x8B39u, 491}, {0x8B3Au, 0}, {0x8B49u, 495}, {0x8B4Au, 0}, {0x8B58u, 490},
+  {0x8B59u, 0}, {0x8B5Cu, 490}, {0x8B5Du, 0}, {0x8B66u, 493}, {0x8B67u, 0}, {0x8B6Fu, 495},
+  {0x8B70u, 490}, {0x8B71u, 0}, {0x8B72u, 491}, {0x8B73u, 0}, {0x8B77u, 490}, {0x8B78u, 0},
+  {0x8B7Du, 495}, {0x8B7Eu, 0}, {0x8B80u, 495}, {0x8B81u, 0}, {0x8B8Au, 495}, {0x8B8Bu, 0},
+  {0x8B93u, 495}, {0x8B94u, 0}, {0x8B9Au, 495}, {0x8B9Bu, 0}, {0x8BA1u, 494}, {0x8BA3u, 0},
+  {0x8BA4u, 494}, {0x8BA5u, 0}, {0x8BA8u, 494}, {0x8BAAu, 0}, {0x8BADu, 494}, {0x8BB1u, 0},
+  {0x8BB2u, 494}, {0x8BB3u, 0}, {0x8BB7u, 494}, {0x8BB9u, 0}, {0x8BBAu, 494}, {0x8BBBu, 0},
+  {0x8BBEu, 494}, {0x8BC0u, 0}, {0x8BC1u, 494}, {0x8BC2u, 0}, {0x8BC4u, 494}, {0x8BC5u, 0},
+  {0x8BC6u, 494}, {0x8BC7u, 0}, {0x8BC9u, 494}, {0x8BCAu, 0}, {0x8BCDu, 494}, {0x8BCEu, 0},
+  {0x8BD1u, 494}, {0x8BD2u, 0}, {0x8BD5u, 494}, {0x8BD6u, 0}, {0x8BD7u, 494}, {0x8BD8u, 0},
+  {0x8BDAu, 494}, {0x8BDBu, 0}, {0x8BDDu, 494}, {0x8BDFu, 0}, {0x8BE2u, 494}, {0x8BE3u, 0},
+  {0x8BE5u, 494}, {0x8BE7u, 0}, {0x8BEDu, 501}, {0x8BEEu, 0}, {0x8BEFu, 494}, {0x8BF0u, 0},
+  {0x8BF4u, 494}, {0x8BF5u, 0}, {0x8BF7u, 494}, {0x8BF9u, 0}, {0x8BFAu, 494}, {0x8BFCu, 0},
+  {0x8BFEu, 494}, {0x8BFFu, 0}, {0x8C01u, 494}, {0x8C02u, 0}, {0x8C03u, 494}, {0x8C04u, 0},
+  {0x8C05u, 494}, {0x8C06u, 0}, {0x8C08u, 494}, {0x8C09u, 0}, {0x8C0Au, 494}, {0x8C0Cu, 0},
+  {0x8C13u, 494}, {0x8C14u, 0}, {0x8C1Cu, 494}, {0x8C1Du, 0}, {0x8C22u, 494}, {0x8C23u, 0},
+  {0x8C28u, 494}, {0x8C29u, 0}, {0x8C31u, 494}, {0x8C32u, 0}, {0x8C37u, 493}, {0x8C38u, 0},
+  {0x8C46u, 493}, {0x8C47u, 0}, {0x8C48u, 495}, {0x8C49u, 0}, {0x8C4Au, 491}, {0x8C4Bu, 0},
+  {0x8C50u, 495}, {0x8C51u, 0}, {0x8C55u, 500}, {0x8C56u, 0}, {0x8C5Au, 491}, {0x8C5Bu, 0},
+  {0x8C61u, 493}, {0x8C62u, 0}, {0x8C6Au, 493}, {0x8C6Bu, 0}, {0x8C6Cu, 495}, {0x8C6Du, 0},
+  {0x8C8Cu, 493}, {0x8C8Du, 0}, {0x8C93u, 495}, {0x8C94u, 0}, {0x8C9Du, 490}, {0x8C9Fu, 0},
+  {0x8CA0u, 490}, {0x8CA3u, 0}, {0x8CA7u, 491}, {0x8CA8u, 490}, {0x8CA9u, 491}, {0x8CAAu, 490},
+  {0x8CADu, 0}, {0x8CAFu, 491}, {0x8CB0u, 0}, {0x8CB4u, 490}, {0x8CB5u, 0}, {0x8CB7u, 490},
+  {0x8CB8u, 491}, {0x8CB9u, 0}, {0x8CBBu, 490}, {0x8CBDu, 0}, {0x8CBFu, 491}, {0x8CC0u, 490},
+  {0x8CC1u, 0}, {0x8CC2u, 491}, {0x8CC5u, 0}, {0x8CC7u, 490}, {0x8CC8u, 495}, {0x8CC9u, 0},
+  {0x8CCAu, 491}, {0x8CCBu, 0}, {0x8CD3u, 490}, {0x8CD4u, 0}, {0x8CDBu, 491}, {0x8CDCu, 490},
+  {0x8CDDu, 0}, {0x8CDEu, 490}, {0x8CDFu, 0}, {0x8CE0u, 491}, {0x8CE1u, 0}, {0x8CE2u, 490},
+  {0x8CE3u, 495}, {0x8CE5u, 0}, {0x8CE6u, 490}, {0x8CE7u, 0}, {0x8CEAu, 490}, {0x8CEBu, 0},
+  {0x8CEDu, 490}, {0x8CEEu, 0}, {0x8CF4u, 495}, {0x8CF5u, 0}, {0x8CFAu, 495}, {0x8CFBu, 0},
+  {0x8CFCu, 490}, {0x8CFDu, 495}, {0x8CFEu, 0}, {0x8D08u, 490}, {0x8D09u, 0}, {0x8D0Au, 495},
+  {0x8D0Bu, 0}, {0x8D0Fu, 495}, {0x8D10u, 0}, {0x8D1Du, 494}, {0x8D20u, 0}, {0x8D21u, 494},
+  {0x8D26u, 0}, {0x8D27u, 494}, {0x8D2Bu, 0}, {0x8D2Du, 494}, {0x8D2Eu, 0}, {0x8D2Fu, 494},
+  {0x8D30u, 0}, {0x8D31u, 494}, {0x8D32u, 0}, {0x8D34u, 494}, {0x8D36u, 0}, {0x8D38u, 494},
+  {0x8D3Bu, 0}, {0x8D3Cu, 494}, {0x8D3Du, 0}, {0x8D3Eu, 494}, {0x8D3Fu, 0}, {0x8D44u, 494},
+  {0x8D45u, 0}, {0x8D4Bu, 494}, {0x8D4Du, 0}, {0x8D4Fu, 494}, {0x8D51u, 0}, {0x8D54u, 494},
+  {0x8D55u, 0}, {0x8D56u, 494}, {0x8D57u, 0}, {0x8D5Au, 494}, {0x8D5Cu, 0}, {0x8D5Eu, 494},
+  {0x8D5Fu, 0}, {0x8D60u, 494}, {0x8D61u, 0}, {0x8D62u, 494}, {0x8D63u, 0}, {0x8D64u, 493},
+  {0x8D65u, 0}, {0x8D66u, 491}, {0x8D67u, 0}, {0x8D6Bu, 494}, {0x8D6Cu, 0}, {0x8D70u, 493},
+  {0x8D71u, 0}, {0x8D74u, 491}, {0x8D75u, 498}, {0x8D76u, 0}, {0x8D77u, 493}, {0x8D78u, 0},
+  {0x8D81u, 494}, {0x8D82u, 0}, {0x8D85u, 493}, {0x8D86u, 0}, {0x8D8Au, 493}, {0x8D8Bu, 494},
+  {0x8D8Cu, 0}, {0x8D95u, 495}, {0x8D96u, 0}, {0x8D99u, 495}, {0x8D9Au, 0}, {0x8DA3u, 493},
+  {0x8DA4u, 0}, {0x8DA8u, 495}, {0x8DA9u, 0}, {0x8DB3u, 493}, {0x8DB4u, 0}, {0x8DC3u, 494},
+  {0x8DC4u, 0}, {0x8DCCu, 494}, {0x8DCDu, 0}, {0x8DCEu, 495}, {0x8DCFu, 0}, {0x8DD1u, 494},
+  {0x8DD2u, 0}, {0x8DDDu, 493}, {0x8DDEu, 0}, {0x8DDFu, 494}, {0x8DE0u, 0}, {0x8DE1u, 490},
+  {0x8DE2u, 0}, {0x8DEFu, 493}, {0x8DF0u, 0}, {0x8DF3u, 493}, {0x8DF4u, 0}, {0x8DF5u, 491},
+  {0x8DF6u, 0}, {0x8E0Au, 491}, {0x8E0Bu, 0}, {0x8E0Fu, 493}, {0x8E10u, 0}, {0x8E22u, 494},
+  {0x8E23u, 0}, {0x8E29u, 494}, {0x8E2Au, 491}, {0x8E2Bu, 0}, {0x8E5Fu, 495}, {0x8E60u, 0},
+  {0x8E64u, 495}, {0x8E65u, 0}, {0x8E74u, 491}, {0x8E75u, 0}, {0x8E8Du, 490}, {0x8E8Eu, 0},
+  {0x8EABu, 493}, {0x8EACu, 0}, {0x8EB2u, 494}, {0x8EB3u, 0}, {0x8ECAu, 490}, {0x8ECBu, 0},
+  {0x8ECCu, 490}, {0x8ECEu, 0}, {0x8ED2u, 490}, {0x8ED3u, 0}, {0x8EDFu, 490}, {0x8EE0u, 0},
+  {0x8EE2u, 491}, {0x8EE3u, 0}, {0x8EF8u, 491}, {0x8EF9u, 0}, {0x8EFDu, 491}, {0x8EFEu, 0},
+  {0x8F03u, 490}, {0x8F04u, 0}, {0x8F09u, 490}, {0x8F0Au, 0}, {0x8F14u, 495}, {0x8F16u, 0},
+  {0x8F1Bu, 495}, {0x8F1Cu, 0}, {0x8F1Du, 490}, {0x8F1Eu, 0}, {0x8F29u, 490}, {0x8F2Bu, 0},
+  {0x8F2Fu, 495}, {0x8F30u, 0}, {0x8F38u, 490}, {0x8F39u, 0}, {0x8F44u, 491}, {0x8F45u, 0},
+  {0x8F49u, 495}, {0x8F4Au, 0}, {0x8F5Fu, 495}, {0x8F60u, 0}, {0x8F66u, 494}, {0x8F67u, 0},
+  {0x8F68u, 494}, {0x8F6Au, 0}, {0x8F6Cu, 494}, {0x8F6Du, 0}, {0x8F6Eu, 494}, {0x8F71u, 0},
+  {0x8F7Bu, 494}, {0x8F7Cu, 0}, {0x8F7Du, 494}, {0x8F7Eu, 0}, {0x8F83u, 494}, {0x8F84u, 0},
+  {0x8F85u, 494}, {0x8F87u, 0}, {0x8F88u, 494}, {0x8F8Au, 0}, {0x8F91u, 494}, {0x8F92u, 0},
+  {0x8F93u, 494}, {0x8F94u, 0}, {0x8F9Bu, 493}, {0x8F9Cu, 0}, {0x8F9Eu, 493}, {0x8F9Fu, 0},
+  {0x8FA3u, 491}, {0x8FA4u, 0}, {0x8FA6u, 495}, {0x8FA7u, 0}, {0x8FA8u, 494}, {0x8FAAu, 0},
+  {0x8FADu, 495}, {0x8FAEu, 0}, {0x8FAFu, 495}, {0x8FB0u, 494}, {0x8FB1u, 493}, {0x8FB2u, 490},
+  {0x8FB3u, 0}, {0x8FB9u, 494}, {0x8FBAu, 491}, {0x8FBBu, 0}, {0x8FBCu, 491}, {0x8FBDu, 0},
+  {0x8FBEu, 494}, {0x8FBFu, 0}, {0x8FC1u, 494}, {0x8FC2u, 0}, {0x8FC5u, 493}, {0x8FC6u, 0},
+  {0x8FC7u, 494}, {0x8FC9u, 0}, {0x8FCEu, 493}, {0x8FCFu, 0}, {0x8FD0u, 494}, {0x8FD1u, 493},
+  {0x8FD2u, 0}, {0x8FD4u, 493}, {0x8FD5u, 0}, {0x8FD8u, 494}, {0x8FDAu, 0}, {0x8FDBu, 494},
+  {0x8FE0u, 0}, {0x8FE6u, 494}, {0x8FE7u, 0}, {0x8FEAu, 494}, {0x8FEBu, 493}, {0x8FECu, 0},
+  {0x8FEDu, 491}, {0x8FEEu, 0}, {0x8FF0u, 493}, {0x8FF1u, 0}, {0x8FF4u, 495}, {0x8FF5u, 0},
+  {0x8FF7u, 493}, {0x8FF8u, 0}, {0x8FFDu, 493}, {0x8FFEu, 0}, {0x9000u, 493}, {0x9002u, 494},
+  {0x9003u, 493}, {0x9004u, 0}, {0x9006u, 493}, {0x9007u, 0}, {0x9009u, 494}, {0x900Bu, 0},
+  {0x900Fu, 493}, {0x9011u, 0}, {0x9012u, 494}, {0x9013u, 491}, {0x9014u, 493}, {0x9015u, 0},
+  {0x9019u, 495}, {0x901Au, 493}, {0x901Bu, 494}, {0x901Cu, 0}, {0x901Du, 493}, {0x901Eu, 0},
+  {0x901Fu, 493}, {0x9021u, 0}, {0x9022u, 494}, {0x9023u, 490}, {0x9024u, 0}, {0x902Eu, 491},
+  {0x902Fu, 0}, {0x9031u, 490}, {0x9033u, 0}, {0x9038u, 493}, {0x9039u, 0}, {0x903Bu, 494},
+  {0x903Du, 0}, {0x9042u, 491}, {0x9043u, 0}, {0x9045u, 491}, {0x9046u, 0}, {0x9047u, 493},
+  {0x9048u, 0}, {0x904Au, 490}, {0x904Cu, 0}, {0x904Du, 493}, {0x904Eu, 490}, {0x904Fu, 0},
+  {0x9053u, 499}, {0x9054u, 493}, {0x9055u, 490}, {0x9056u, 0}, {0x9057u, 494}, {0x9058u, 0},
+  {0x9059u, 495}, {0x905Au, 0}, {0x905Cu, 490}, {0x905Du, 0}, {0x9060u, 490}, {0x9061u, 491},
+  {0x9062u, 0}, {0x9063u, 491}, {0x9064u, 0}, {0x9069u, 490}, {0x906Au, 0}, {0x906Du, 493},
+  {0x906Fu, 0}, {0x9072u, 495}, {0x9073u, 0}, {0x9075u, 493}, {0x9076u, 0}, {0x9077u, 490},
+  {0x9079u, 0}, {0x907Au, 490}, {0x907Bu, 0}, {0x907Fu, 493}, {0x9080u, 494}, {0x9081u, 495},
+  {0x9082u, 0}, {0x9084u, 490}, {0x9085u, 0}, {0x908Au, 495}, {0x908Bu, 0}, {0x908Fu, 495},
+  {0x9090u, 0}, {0x9093u, 494}, {0x9094u, 0}, {0x90A3u, 493}, {0x90A4u, 0}, {0x90A6u, 493},
+  {0x90A7u, 0}, {0x90AAu, 493}, {0x90ABu, 0}, {0x90AEu, 494}, {0x90AFu, 0}, {0x90B1u, 494},
+  {0x90B2u, 0}, {0x90B8u, 491}, {0x90B9u, 0}, {0x90BBu, 494}, {0x90BCu, 0}, {0x90CAu, 491},
+  {0x90CBu, 0}, {0x90CEu, 493}, {0x90CFu, 0}, {0x90D1u, 494}, {0x90D2u, 0}, {0x90E1u, 491},
+  {0x90E2u, 0}, {0x90E8u, 493}, {0x90E9u, 0}, {0x90EDu, 493}, {0x90EEu, 0}, {0x90F5u, 490},
+  {0x90F6u, 0}, {0x90F7u, 491}, {0x90F8u, 0}, {0x90FDu, 493}, {0x90FEu, 0}, {0x9102u, 494},
+  {0x9103u, 0}, {0x9109u, 495}, {0x910Au, 0}, {0x912Du, 495}, {0x912Eu, 0}, {0x9130u, 495},
+  {0x9131u, 0}, {0x9149u, 494}, {0x914Au, 0}, {0x914Bu, 494}, {0x914Cu, 491}, {0x914Du, 493},
+  {0x914Eu, 491}, {0x914Fu, 0}, {0x9152u, 493}, {0x9153u, 0}, {0x9154u, 491}, {0x9155u, 0},
+  {0x9162u, 491}, {0x9163u, 0}, {0x916Au, 491}, {0x916Bu, 0}, {0x916Cu, 491}, {0x916Du, 0},
+  {0x9175u, 491}, {0x9176u, 0}, {0x9177u, 493}, {0x9179u, 0}, {0x9189u, 494}, {0x918Au, 0},
+  {0x9192u, 493}, {0x9193u, 0}, {0x919Cu, 490}, {0x919Du, 0}, {0x91ABu, 495}, {0x91ACu, 0},
+  {0x91B8u, 491}, {0x91B9u, 0}, {0x91C7u, 493}, {0x91C8u, 491}, {0x91C9u, 0}, {0x91CAu, 494},
+  {0x91CBu, 495}, {0x91CCu, 493}, {0x91D0u, 0}, {0x91D1u, 493}, {0x91D2u, 0}, {0x91DCu, 491},
+  {0x91DDu, 490}, {0x91DEu, 0}, {0x91E3u, 490}, {0x91E4u, 0}, {0x920Du, 491}, {0x920Eu, 0},
+  {0x9234u, 490}, {0x9235u, 0}, {0x9244u, 491}, {0x9245u, 0}, {0x925Bu, 491}, {0x925Cu, 0},
+  {0x9262u, 490}, {0x9263u, 0}, {0x9271u, 491}, {0x9272u, 0}, {0x9280u, 490}, {0x9281u, 0},
+  {0x9283u, 491}, {0x9284u, 0}, {0x9285u, 490}, {0x9286u, 0}, {0x9296u, 495}, {0x9297u, 0},
+  {0x9298u, 490}, {0x9299u, 0}, {0x92ADu, 491}, {0x92AEu, 0}, {0x92B3u, 495}, {0x92B4u, 0},
+  {0x92B7u, 495}, {0x92B8u, 0}, {0x92D2u, 495}, {0x92D3u, 0}, {0x92EDu, 491}, {0x92EEu, 0},
+  {0x92F3u, 491}, {0x92F4u, 0}, {0x92FCu, 490}, {0x92FDu, 0}, {0x9304u, 495}, {0x9305u, 0},
+  {0x9320u, 491}, {0x9321u, 0}, {0x9322u, 495}, {0x9323u, 0}, {0x9326u, 490}, {0x9327u, 0},
+  {0x932Bu, 495}, {0x932Cu, 491}, {0x932Du, 0}, {0x932Eu, 491}, {0x932Fu, 490}, {0x9330u, 0},
+  {0x9332u, 491}, {0x9333u, 0}, {0x934Bu, 490}, {0x934Cu, 0}, {0x935Bu, 491}, {0x935Cu, 0},
+  {0x9375u, 490}, {0x9376u, 0}, {0x937Eu, 495}, {0x937Fu, 0}, {0x938Au, 495}, {0x938Bu, 0},
+  {0x938Cu, 491}, {0x938Du, 0}, {0x9396u, 490}, {0x9397u, 0}, {0x93AEu, 490}, {0x93AFu, 0},
+  {0x93E1u, 490}, {0x93E2u, 0}, {0x9418u, 490}, {0x9419u, 0}, {0x9435u, 495}, {0x9436u, 0},
+  {0x9451u, 490}, {0x9452u, 0}, {0x9488u, 494}, {0x9489u, 0}, {0x9493u, 494}, {0x9494u, 0},
+  {0x949Fu, 494}, {0x94A0u, 0}, {0x94A2u, 494}, {0x94A3u, 0}, {0x94A6u, 494}, {0x94A7u, 0},
+  {0x94B1u, 494}, {0x94B2u, 0}, {0x94BBu, 494}, {0x94BCu, 0}, {0x94C1u, 494}, {0x94C2u, 0},
+  {0x94C3u, 494}, {0x94C4u, 0}, {0x94DCu, 494}, {0x94DDu, 0}, {0x94E2u, 494}, {0x94E3u, 0},
+  {0x94EDu, 494}, {0x94EEu, 0}, {0x94F6u, 494}, {0x94F7u, 0}, {0x94FAu, 494}, {0x94FBu, 0},
+  {0x94FEu, 494}, {0x94FFu, 0}, {0x9500u, 494}, {0x9502u, 0}, {0x9505u, 494}, {0x9506u, 0},
+  {0x950Bu, 494}, {0x950Cu, 0}, {0x9519u, 494}, {0x951Au, 0}, {0x9521u, 494}, {0x9522u, 0},
+  {0x9526u, 494}, {0x9527u, 0}, {0x952Eu, 494}, {0x952Fu, 0}, {0x953Au, 494}, {0x953Bu, 0},
+  {0x9547u, 494}, {0x9548u, 0}, {0x955Cu, 494}, {0x955Du, 0}, {0x956Du, 494}, {0x956Eu, 0},
+  {0x9577u, 490}, {0x9578u, 0}, {0x957Fu, 494}, {0x9580u, 490}, {0x9581u, 0}, {0x9583u, 495},
+  {0x9584u, 0}, {0x9589u, 490}, {0x958Au, 0}, {0x958Bu, 490}, {0x958Cu, 0}, {0x958Fu, 495},
+  {0x9590u, 0}, {0x9591u, 491}, {0x9592u, 495}, {0x9593u, 490}, {0x9594u, 0}, {0x95A2u, 491},
+  {0x95A3u, 490}, {0x95A4u, 0}, {0x95A5u, 491}, {0x95A6u, 0}, {0x95B1u, 495}, {0x95B2u, 491},
+  {0x95B3u, 0}, {0x95C6u, 495}, {0x95C7u, 491}, {0x95C8u, 0}, {0x95CAu, 495}, {0x95CBu, 0},
+  {0x95CDu, 495}, {0x95CEu, 0}, {0x95D0u, 495}, {0x95D1u, 0}, {0x95D8u, 491}, {0x95D9u, 0},
+  {0x95DCu, 495}, {0x95DDu, 0}, {0x95E1u, 495}, {0x95E2u, 0}, {0x95E8u, 494}, {0x95E9u, 0},
+  {0x95EAu, 494}, {0x95EBu, 0}, {0x95EDu, 494}, {0x95EFu, 0}, {0x95F0u, 494}, {0x95F1u, 0},
+  {0x95F2u, 494}, {0x95F3u, 0}, {0x95F4u, 494}, {0x95F5u, 0}, {0x95F7u, 494}, {0x95F8u, 0},
+  {0x95F9u, 494}, {0x95FAu, 0}, {0x95FBu, 494}, {0x95FCu, 0}, {0x9601u, 494}, {0x9602u, 0},
+  {0x9605u, 494}, {0x9606u, 0}, {0x9610u, 494}, {0x9611u, 0}, {0x9614u, 494}, {0x9615u, 0},
+  {0x961Cu, 491}, {0x961Du, 0}, {0x961Fu, 494}, {0x9620u, 0}, {0x962Au, 491}, {0x962Bu, 0},
+  {0x962Eu, 494}, {0x962Fu, 0}, {0x9632u, 493}, {0x9633u, 494}, {0x9637u, 0}, {0x963Bu, 493},
+  {0x963Cu, 0}, {0x963Fu, 494}, {0x9641u, 0}, {0x9644u, 493}, {0x9645u, 494}, {0x9647u, 0},
+  {0x9648u, 494}, {0x9649u, 0}, {0x964Du, 493}, {0x964Eu, 0}, {0x9650u, 493}, {0x9651u, 0},
+  {0x965Bu, 491}, {0x965Cu, 0}, {0x9662u, 493}, {0x9663u, 490}, {0x9664u, 493}, {0x9665u, 491},
+  {0x9666u, 0}, {0x9669u, 494}, {0x966Au, 493}, {0x966Bu, 0}, {0x9670u, 490}, {0x9671u, 0},
+  {0x9673u, 490}, {0x9674u, 0}, {0x9675u, 493}, {0x9677u, 494}, {0x9678u, 490}, {0x9679u, 0},
+  {0x967Au, 491}, {0x967Bu, 0}, {0x967Du, 490}, {0x967Eu, 0}, {0x9685u, 491}, {0x9686u, 493},
+  {0x9687u, 0}, {0x968Au, 490}, {0x968Bu, 0}, {0x968Eu, 490}, {0x968Fu, 493}, {0x9690u, 494},
+  {0x9691u, 0}, {0x9694u, 493}, {0x9695u, 0}, {0x9699u, 491}, {0x969Au, 0}, {0x969Bu, 490},
+  {0x969Cu, 493}, {0x969Du, 0}, {0x96A0u, 491}, {0x96A1u, 0}, {0x96A3u, 491}, {0x96A4u, 0},
+  {0x96A8u, 495}, {0x96A9u, 0}, {0x96AAu, 495}, {0x96ABu, 0}, {0x96B1u, 495}, {0x96B2u, 0},
+  {0x96B7u, 491}, {0x96B8u, 0}, {0x96BBu, 490}, {0x96BCu, 0}, {0x96BEu, 494}, {0x96BFu, 0},
+  {0x96C4u, 493}, {0x96C7u, 491}, {0x96C8u, 0}, {0x96C9u, 494}, {0x96CAu, 0}, {0x96CCu, 491},
+  {0x96CDu, 0}, {0x96D1u, 491}, {0x96D2u, 0}, {0x96D5u, 500}, {0x96D6u, 495}, {0x96D7u, 0},
+  {0x96D9u, 495}, {0x96DAu, 0}, {0x96DCu, 495}, {0x96DDu, 0}, {0x96DEu, 495}, {0x96DFu, 0},
+  {0x96E2u, 490}, {0x96E4u, 0}, {0x96E8u, 493}, {0x96E9u, 0}, {0x96EAu, 493}, {0x96EBu, 0},
+  {0x96EFu, 494}, {0x96F0u, 491}, {0x96F1u, 0}, {0x96F2u, 490}, {0x96F3u, 494}, {0x96F4u, 0},
+  {0x96F6u, 493}, {0x96F8u, 0}, {0x96FBu, 490}, {0x96FCu, 0}, {0x96FEu, 494}, {0x96FFu, 0},
+  {0x9700u, 493}, {0x9701u, 0}, {0x9707u, 493}, {0x9708u, 0}, {0x970Au, 491}, {0x970Bu, 0},
+  {0x970Du, 494}, {0x970Eu, 0}, {0x9716u, 494}, {0x9717u, 0}, {0x971Cu, 491}, {0x971Du, 0},
+  {0x9727u, 490}, {0x9728u, 0}, {0x9732u, 493}, {0x9733u, 0}, {0x9738u, 494}, {0x973Au, 0},
+  {0x9742u, 495}, {0x9743u, 0}, {0x9748u, 495}, {0x9749u, 0}, {0x9752u, 493}, {0x9753u, 0},
+  {0x9756u, 494}, {0x9757u, 0}, {0x9759u, 493}, {0x975Au, 0}, {0x975Cu, 495}, {0x975Du, 0},
+  {0x975Eu, 493}, {0x975Fu, 0}, {0x9760u, 494}, {0x9761u, 0}, {0x9762u, 493}, {0x9763u, 0},
+  {0x9769u, 493}, {0x976Au, 0}, {0x9774u, 491}, {0x9775u, 0}, {0x977Cu, 494}, {0x977Du, 0},
+  {0x978Bu, 494}, {0x978Cu, 0}, {0x9791u, 494}, {0x9792u, 0}, {0x97C3u, 495}, {0x97C4u, 0},
+  {0x97CBu, 495}, {0x97CCu, 0}, {0x97D3u, 490}, {0x97D4u, 0}, {0x97E6u, 494}, {0x97E7u, 0},
+  {0x97E9u, 494}, {0x97EAu, 0}, {0x97F3u, 499}, {0x97F4u, 0}, {0x97FBu, 490}, {0x97FCu, 0},
+  {0x97FFu, 490}, {0x9800u, 0}, {0x9801u, 495}, {0x9802u, 490}, {0x9803u, 491}, {0x9804u, 0},
+  {0x9805u, 490}, {0x9807u, 0}, {0x9808u, 490}, {0x9809u, 0}, {0x9810u, 490}, {0x9812u, 491},
+  {0x9813u, 490}, {0x9814u, 0}, {0x9817u, 495}, {0x9818u, 490}, {0x9819u, 0}, {0x981Eu, 495},
+  {0x981Fu, 0}, {0x982Cu, 491}, {0x982Du, 490}, {0x982Eu, 0}, {0x983Bu, 490}, {0x983Cu, 491},
+  {0x983Du, 0}, {0x9846u, 495}, {0x9847u, 0}, {0x984Cu, 490}, {0x984Eu, 491}, {0x984Fu, 495},
+  {0x9850u, 0}, {0x9854u, 491}, {0x9856u, 0}, {0x9858u, 490}, {0x9859u, 0}, {0x985Eu, 490},
+  {0x985Fu, 0}, {0x9867u, 490}, {0x9868u, 0}, {0x986Fu, 495}, {0x9870u, 0}, {0x9875u, 494},
+  {0x9877u, 0}, {0x9879u, 494}, {0x987Cu, 0}, {0x987Du, 494}, {0x9880u, 0}, {0x9884u, 494},
+  {0x9885u, 0}, {0x9886u, 494}, {0x9888u, 0}, {0x9891u, 494}, {0x9892u, 0}, {0x9897u, 494},
+  {0x9899u, 0}, {0x989Du, 494}, {0x989Eu, 0}, {0x98A8u, 490}, {0x98A9u, 0}, {0x98C4u, 495},
+  {0x98C5u, 0}, {0x98CEu, 494}, {0x98CFu, 0}, {0x98D8u, 494}, {0x98DAu, 0}, {0x98DBu, 490},
+  {0x98DCu, 0}, {0x98DEu, 494}, {0x98DFu, 493}, {0x98E0u, 0}, {0x98E2u, 491}, {0x98E3u, 0},
+  {0x98EFu, 490}, {0x98F0u, 0}, {0x98F2u, 490}, {0x98F3u, 0}, {0x98FCu, 491}, {0x98FDu, 490},
+  {0x98FFu, 0}, {0x9905u, 490}, {0x9906u, 0}, {0x990Au, 490}, {0x990Bu, 0}, {0x990Cu, 491},
+  {0x990Du, 0}, {0x9910u, 494}, {0x9911u, 0}, {0x9913u, 491}, {0x9914u, 0}, {0x9918u, 495},
+  {0x9919u, 0}, {0x9928u, 490}, {0x9929u, 0}, {0x996Du, 494}, {0x996Fu, 0}, {0x9970u, 494},
+  {0x9972u, 0}, {0x997Cu, 494}, {0x997Du, 0}, {0x9986u, 494}, {0x9987u, 0}, {0x9996u, 493},
+  {0x9997u, 0}, {0x9999u, 493}, {0x999Au, 0}, {0x99A8u, 494}, {0x99A9u, 0}, {0x99ACu, 490},
+  {0x99ADu, 0}, {0x99C4u, 491}, {0x99C7u, 0}, {0x99D0u, 490}, {0x99D1u, 0}, {0x99D2u, 491},
+  {0x99D3u, 0}, {0x99D5u, 495}, {0x99D6u, 0}, {0x99DBu, 495}, {0x99DCu, 0}, {0x9A0Eu, 490},
+  {0x9A0Fu, 0}, {0x9A12u, 491}, {0x9A14u, 0}, {0x9A19u, 495}, {0x9A1Au, 0}, {0x9A30u, 491},
+  {0x9A31u, 0}, {0x9A37u, 495}, {0x9A38u, 0}, {0x9A45u, 495}, {0x9A46u, 0}, {0x9A57u, 495},
+  {0x9A58u, 0}, {0x9A5Au, 490}, {0x9A5Bu, 0}, {0x9A6Cu, 494}, {0x9A6Du, 0}, {0x9A71u, 494},
+  {0x9A72u, 0}, {0x9A76u, 494}, {0x9A77u, 0}, {0x9A7Bu, 494}, {0x9A7Cu, 0}, {0x9A7Eu, 494},
+  {0x9A7Fu, 0}, {0x9A8Cu, 494}, {0x9A8Du, 0}, {0x9A91u, 494}, {0x9A92u, 0}, {0x9A97u, 494},
+  {0x9A98u, 0}, {0x9A9Au, 494}, {0x9A9Bu, 0}, {0x9AA4u, 494}, {0x9AA5u, 0}, {0x9AA8u, 493},
+  {0x9AA9u, 0}, {0x9AB8u, 491}, {0x9AB9u, 0}, {0x9AC4u, 491}, {0x9AC5u, 0}, {0x9AD4u, 495},
+  {0x9AD5u, 0}, {0x9AD8u, 493}, {0x9AD9u, 0}, {0x9AEAu, 491}, {0x9AEBu, 0}, {0x9AEEu, 495},
+  {0x9AEFu, 0}, {0x9B06u, 495}, {0x9B07u, 0}, {0x9B25u, 495}, {0x9B26u, 0}, {0x9B27u, 495},
+  {0x9B28u, 0}, {0x9B31u, 490}, {0x9B32u, 0}, {0x9B3Cu, 493}, {0x9B3Du, 0}, {0x9B41u, 495},
+  {0x9B42u, 493}, {0x9B43u, 0}, {0x9B45u, 493}, {0x9B46u, 0}, {0x9B54u, 493}, {0x9B55u, 0},
+  {0x9B5Au, 490}, {0x9B5Bu, 0}, {0x9B6Fu, 495}, {0x9B70u, 0}, {0x9BAEu, 490}, {0x9BAFu, 0},
+  {0x9BE8u, 491}, {0x9BE9u, 0}, {0x9C7Cu, 494}, {0x9C7Du, 0}, {0x9C81u, 494}, {0x9C82u, 0},
+  {0x9C9Cu, 494}, {0x9C9Du, 0}, {0x9CE5u, 490}, {0x9CE6u, 0}, {0x9CF3u, 495}, {0x9CF4u, 490},
+  {0x9CF5u, 0}, {0x9D3Bu, 495}, {0x9D3Cu, 0}, {0x9D5Du, 495}, {0x9D5Eu, 0}, {0x9D8Fu, 491},
+  {0x9D90u, 0}, {0x9DB4u, 491}, {0x9DB5u, 0}, {0x9DF9u, 495}, {0x9DFAu, 0}, {0x9E1Fu, 494},
+  {0x9E20u, 0}, {0x9E21u, 494}, {0x9E22u, 0}, {0x9E23u, 494}, {0x9E24u, 0}, {0x9E2Du, 494},
+  {0x9E2Eu, 0}, {0x9E3Fu, 494}, {0x9E40u, 0}, {0x9E45u, 494}, {0x9E46u, 0}, {0x9E64u, 494},
+  {0x9E65u, 0}, {0x9E70u, 494}, {0x9E71u, 0}, {0x9E7Fu, 493}, {0x9E80u, 0}, {0x9E93u, 491},
+  {0x9E94u, 0}, {0x9E97u, 490}, {0x9E98u, 0}, {0x9EA5u, 495}, {0x9EA6u, 493}, {0x9EA7u, 0},
+  {0x9EB5u, 495}, {0x9EB6u, 0}, {0x9EBAu, 491}, {0x9EBBu, 493}, {0x9EBCu, 495}, {0x9EBDu, 0},
+  {0x9EC3u, 495}, {0x9EC4u, 493}, {0x9EC5u, 0}, {0x9ECEu, 494}, {0x9ECFu, 0}, {0x9ED1u, 494},
+  {0x9ED2u, 491}, {0x9ED3u, 0}, {0x9ED8u, 494}, {0x9ED9u, 491}, {0x9EDAu, 0}, {0x9EDEu, 495},
+  {0x9EDFu, 0}, {0x9EE8u, 495}, {0x9EE9u, 0}, {0x9F13u, 493}, {0x9F14u, 0}, {0x9F20u, 494},
+  {0x9F21u, 0}, {0x9F3Bu, 493}, {0x9F3Cu, 0}, {0x9F4Au, 495}, {0x9F4Cu, 0}, {0x9F50u, 494},
+  {0x9F51u, 0}, {0x9F52u, 495}, {0x9F53u, 0}, {0x9F61u, 495}, {0x9F62u, 491}, {0x9F63u, 0},
+  {0x9F7Fu, 494}, {0x9F80u, 0}, {0x9F84u, 494}, {0x9F85u, 0}, {0x9F8Du, 495}, {0x9F8Eu, 0},
+  {0x9F99u, 494}, {0x9F9Au, 0}, {0x9F9Cu, 495}, {0x9F9Du, 0}, {0x9F9Fu, 494}, {0x9FA0u, 0},
+  {0xA000u, 502}, {0xA48Du, 0}, {0xA4D0u, 503}, {0xA4F8u, 0}, {0xA500u, 504}, {0xA60Du, 0},
+  {0xA610u, 504}, {0xA613u, 0}, {0xA62Au, 504}, {0xA62Cu, 0}, {0xA640u, 300}, {0xA642u, 0},
+  {0xA64Au, 300}, {0xA64Eu, 0}, {0xA656u, 300}, {0xA658u, 0}, {0xA67Fu, 300}, {0xA680u, 0},
+  {0xA6A0u, 505}, {0xA6F0u, 0}, {0xA78Bu, 506}, {0xA78Du, 0}, {0xA892u, 507}, {0xA8C5u, 0},
+  {0xA900u, 508}, {0xA930u, 509}, {0xA954u, 0}, {0xA95Fu, 509}, {0xA960u, 0}, {0xAB70u, 443},
+  {0xABC0u, 510}, {0xABE3u, 0}, {0xABF0u, 510}, {0xABF3u, 0}, {0xAC00u, 492}, {0xD7A4u, 0},
+  {0xF008u, 511}, {0xF009u, 0}, {0xF00Fu, 511}, {0xF010u, 0}, {0xF019u, 79}, {0xF01Au, 0},
+  {0xF023u, 511}, {0xF026u, 0}, {0xF028u, 511}, {0xF02Au, 0}, {0xFF08u, 489}, {0xFF0Au, 0},
+  {0xFF0Cu, 495}, {0xFF0Du, 0}, {0xFF11u, 491}, {0xFF13u, 0}, {0xFF1Au, 491}, {0xFF1Bu, 495},
+  {0xFF1Cu, 0}, {0xFF1Fu, 495}, {0xFF20u, 0}, {0x104B0u, 512}, {0x104D4u, 0}, {0x104D8u, 512},
+  {0x104FCu, 0}, {0x10D00u, 513}, {0x10D1Cu, 0}, {0x10D1Du, 513}, {0x10D24u, 0}, {0x11103u, 514},
+  {0x11127u, 0}, {0x1E900u, 515}, {0x1E91Cu, 0}, {0x1E922u, 515}, {0x1E93Eu, 0}, {0x1E94Bu, 515},
+  {0x1E94Cu, 0},
+};
+
+const char *WA_SCRIPT_CODES[] = {
+  "Adlm",
+  "Aghb",
+  "Ahom",
+  "Arab",
+  "Armi",
+  "Armn",
+  "Avst",
+  "Bali",
+  "Bamu",
+  "Bass",
+  "Batk",
+  "Beng",
+  "Berf",
+  "Bhks",
+  "Bopo",
+  "Brah",
+  "Brai",
+  "Bugi",
+  "Buhd",
+  "Cakm",
+  "Cans",
+  "Cari",
+  "Cham",
+  "Cher",
+  "Chrs",
+  "Copt",
+  "Cpmn",
+  "Cprt",
+  "Cyrl",
+  "Deva",
+  "Diak",
+  "Dogr",
+  "Dsrt",
+  "Dupl",
+  "Egyp",
+  "Elba",
+  "Elym",
+  "Ethi",
+  "Gara",
+  "Geor",
+  "Glag",
+  "Gong",
+  "Gonm",
+  "Goth",
+  "Gran",
+  "Grek",
+  "Gujr",
+  "Gukh",
+  "Guru",
+  "Hang",
+  "Hani",
+  "Hano",
+  "Hatr",
+  "Hebr",
+  "Hira",
+  "Hluw",
+  "Hmng",
+  "Hmnp",
+  "Hung",
+  "Ital",
+  "Java",
+  "Jurc",
+  "Kali",
+  "Kana",
+  "Kawi",
+  "Khar",
+  "Khmr",
+  "Khoj",
+  "Kits",
+  "Knda",
+  "Krai",
+  "Kthi",
+  "Lana",
+  "Laoo",
+  "Latn",
+  "Lepc",
+  "Limb",
+  "Lina",
+  "Linb",
+  "Lisu",
+  "Lyci",
+  "Lydi",
+  "Mahj",
+  "Maka",
+  "Mand",
+  "Mani",
+  "Marc",
+  "Medf",
+  "Mend",
+  "Merc",
+  "Mero",
+  "Mlym",
+  "Modi",
+  "Mong",
+  "Mroo",
+  "Mtei",
+  "Mult",
+  "Mymr",
+  "Nagm",
+  "Nand",
+  "Narb",
+  "Nbat",
+  "Newa",
+  "Nkoo",
+  "Nshu",
+  "Ogam",
+  "Olck",
+  "Onao",
+  "Orkh",
+  "Orya",
+  "Osge",
+  "Osma",
+  "Ougr",
+  "Palm",
+  "Pauc",
+  "Pcun",
+  "Perm",
+  "Phag",
+  "Phli",
+  "Phlp",
+  "Phnx",
+  "Plrd",
+  "Prti",
+  "Rjng",
+  "Rohg",
+  "Runr",
+  "Samr",
+  "Sarb",
+  "Saur",
+  "Seal",
+  "Sgnw",
+  "Shaw",
+  "Shrd",
+  "Sidd",
+  "Sidt",
+  "Sind",
+  "Sinh",
+  "Sogd",
+  "Sogo",
+  "Sora",
+  "Soyo",
+  "Sund",
+  "Sunu",
+  "Sylo",
+  "Syrc",
+  "Tagb",
+  "Takr",
+  "Tale",
+  "Talu",
+  "Taml",
+  "Tang",
+  "Tavt",
+  "Tayo",
+  "Telu",
+  "Tfng",
+  "Tglg",
+  "Thaa",
+  "Thai",
+  "Tibt",
+  "Tirh",
+  "Tnsa",
+  "Todr",
+  "Tols",
+  "Toto",
+  "Tutg",
+  "Ugar",
+  "Vaii",
+  "Vith",
+  "Wara",
+  "Wcho",
+  "Xpeo",
+  "Xsux",
+  "Yezi",
+  "Yiii",
+  "Zanb",
+  "Zinh",
+  "Zyyy",
+  "Zzzz",
+};
+
+const uint16_t WA_SCRIPT_STAGE1[] = {
+  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+  16, 17, 18, 19, 20, 20, 21, 22, 23, 24, 25, 26, 27, 28, 1, 29,
+  30, 31, 32, 32, 33, 32, 32, 32, 34, 32, 32, 35, 36, 37, 38, 39,
+  40, 41, 42, 43, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 45, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  46, 46, 46, 46, 47, 48, 49, 50, 51, 52, 53, 54, 17, 17, 17, 17,
+  17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+  17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+  17, 17, 17, 17, 17, 17, 17, 55, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 44, 57, 58, 59, 60, 61, 62,
+  63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78,
+  79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94,
+  95, 95, 95, 96, 95, 97, 98, 56, 56, 56, 56, 56, 56, 56, 56, 99,
+  100, 100, 100, 100, 101, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+  100, 100, 100, 102, 103, 103, 104, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 105, 56, 56, 56, 56, 56, 56, 106, 106, 107, 108, 56, 109, 110, 111,
+  112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112,
+  112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 113, 114, 115, 116, 116,
+  116, 117, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 118,
+  119, 120, 121, 56, 56, 56, 56, 56, 56, 56, 56, 56, 122, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 123, 32, 124, 125,
+  126, 127, 128, 129, 130, 131, 132, 133, 134, 134, 135, 136, 56, 56, 56, 137,
+  138, 139, 140, 56, 141, 142, 143, 144, 145, 146, 56, 56, 147, 148, 149, 56,
+  150, 151, 152, 32, 32, 32, 153, 154, 155, 32, 156, 157, 56, 56, 56, 56,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 158, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 159, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 160, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 161, 44, 44, 162, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 44, 44, 163, 56, 56, 56, 56, 56,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 164, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 165, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166,
+  166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166,
+  166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 167, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  168, 169, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+};
+
+const uint8_t WA_SCRIPT_STAGE2[] = {
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 176, 176, 176, 176, 176,
+  176, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 74, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 74, 176, 176, 176, 176, 176,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 176, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 176, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  74, 74, 74, 74, 74, 176, 176, 176, 176, 176, 14, 14, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+  175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+  175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+  175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+  175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+  175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+  175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+  45, 45, 45, 45, 176, 45, 45, 45, 177, 177, 45, 45, 45, 45, 176, 45,
+  177, 177, 177, 177, 45, 176, 45, 176, 45, 45, 45, 177, 45, 177, 45, 45,
+  45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+  45, 45, 177, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+  45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+  45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+  45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+  45, 45, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 175, 175, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  177, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+  5, 5, 5, 5, 5, 5, 5, 177, 5, 5, 5, 5, 5, 5, 5, 5,
+  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+  177, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+  53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+  53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+  53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 177, 177, 177, 177, 177, 177,
+  53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+  53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 177, 177, 177, 177, 53,
+  53, 53, 53, 53, 53, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  3, 3, 3, 3, 3, 176, 3, 3, 3, 3, 3, 3, 176, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 176, 3, 3, 3, 176,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  176, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 175, 175, 175, 175, 175,
+  175, 175, 175, 175, 175, 175, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  175, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 176, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 177, 144,
+  144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144,
+  144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144,
+  144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144,
+  144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 177, 177, 144, 144, 144,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156,
+  156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156,
+  156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156,
+  156, 156, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+  103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+  103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+  103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 177, 177, 103, 103, 103,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 177, 177,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 177,
+  84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+  84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 177, 177, 84, 177,
+  144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 144, 177, 177, 177, 177, 177,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 177, 177, 177, 177, 177, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 176, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+  29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+  29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+  29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+  29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+  29, 175, 175, 175, 175, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+  29, 29, 29, 29, 176, 176, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+  29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+  11, 11, 11, 11, 177, 11, 11, 11, 11, 11, 11, 11, 11, 177, 177, 11,
+  11, 177, 177, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 177, 11, 11, 11, 11, 11, 11,
+  11, 177, 11, 177, 177, 177, 11, 11, 11, 11, 177, 177, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 177, 177, 11, 11, 177, 177, 11, 11, 11, 11, 177,
+  177, 177, 177, 177, 177, 177, 177, 11, 177, 177, 177, 177, 11, 11, 177, 11,
+  11, 11, 11, 11, 177, 177, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 177,
+  177, 48, 48, 48, 177, 48, 48, 48, 48, 48, 48, 177, 177, 177, 177, 48,
+  48, 177, 177, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+  48, 48, 48, 48, 48, 48, 48, 48, 48, 177, 48, 48, 48, 48, 48, 48,
+  48, 177, 48, 48, 177, 48, 48, 177, 48, 48, 177, 177, 48, 177, 48, 48,
+  48, 48, 48, 177, 177, 177, 177, 48, 48, 177, 177, 48, 48, 48, 177, 177,
+  177, 48, 177, 177, 177, 177, 177, 177, 177, 48, 48, 48, 48, 177, 48, 177,
+  177, 177, 177, 177, 177, 177, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+  48, 48, 48, 48, 48, 48, 48, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 46, 46, 46, 177, 46, 46, 46, 46, 46, 46, 46, 46, 46, 177, 46,
+  46, 46, 177, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 46, 46, 46, 177, 46, 46, 46, 46, 46, 46,
+  46, 177, 46, 46, 177, 46, 46, 46, 46, 46, 177, 177, 46, 46, 46, 46,
+  46, 46, 46, 46, 46, 46, 177, 46, 46, 46, 177, 46, 46, 46, 177, 177,
+  46, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  46, 46, 46, 46, 177, 177, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+  46, 46, 177, 177, 177, 177, 177, 177, 177, 46, 46, 46, 46, 46, 46, 46,
+  177, 109, 109, 109, 177, 109, 109, 109, 109, 109, 109, 109, 109, 177, 177, 109,
+  109, 177, 177, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+  109, 109, 109, 109, 109, 109, 109, 109, 109, 177, 109, 109, 109, 109, 109, 109,
+  109, 177, 109, 109, 177, 109, 109, 109, 109, 109, 177, 177, 109, 109, 109, 109,
+  109, 109, 109, 109, 109, 177, 177, 109, 109, 177, 177, 109, 109, 109, 177, 177,
+  177, 177, 177, 109, 109, 109, 109, 109, 177, 177, 177, 177, 109, 109, 177, 109,
+  109, 109, 109, 109, 177, 177, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+  109, 109, 109, 109, 109, 109, 109, 109, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 149, 149, 177, 149, 149, 149, 149, 149, 149, 177, 177, 177, 149, 149,
+  149, 177, 149, 149, 149, 149, 177, 177, 177, 149, 149, 177, 149, 177, 149, 149,
+  177, 177, 177, 149, 149, 177, 177, 177, 149, 149, 149, 177, 177, 177, 149, 149,
+  149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 177, 177, 177, 177, 149, 149,
+  149, 149, 149, 177, 177, 177, 149, 149, 149, 177, 149, 149, 149, 149, 177, 177,
+  149, 177, 177, 177, 177, 177, 177, 149, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149,
+  149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 177, 177, 177, 177, 177,
+  153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 177, 153, 153,
+  153, 177, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153,
+  153, 153, 153, 153, 153, 153, 153, 153, 153, 177, 153, 153, 153, 153, 153, 153,
+  153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 177, 177, 153, 153, 153, 153,
+  153, 153, 153, 153, 153, 177, 153, 153, 153, 177, 153, 153, 153, 153, 177, 177,
+  177, 177, 177, 177, 177, 153, 153, 177, 153, 153, 153, 177, 153, 153, 177, 177,
+  153, 153, 153, 153, 177, 177, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153,
+  177, 177, 177, 177, 177, 177, 177, 153, 153, 153, 153, 153, 153, 153, 153, 153,
+  69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 177, 69, 69,
+  69, 177, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
+  69, 69, 69, 69, 69, 69, 69, 69, 69, 177, 69, 69, 69, 69, 69, 69,
+  69, 69, 69, 69, 177, 69, 69, 69, 69, 69, 177, 177, 69, 69, 69, 69,
+  69, 69, 69, 69, 69, 177, 69, 69, 69, 177, 69, 69, 69, 69, 177, 177,
+  177, 177, 177, 177, 177, 69, 69, 177, 177, 177, 177, 177, 69, 69, 69, 177,
+  69, 69, 69, 69, 177, 177, 69, 69, 69, 69, 69, 69, 69, 69, 69, 69,
+  177, 69, 69, 69, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 177, 91, 91,
+  91, 177, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91,
+  91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91,
+  91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91,
+  91, 91, 91, 91, 91, 177, 91, 91, 91, 177, 91, 91, 91, 91, 91, 91,
+  177, 177, 177, 177, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91,
+  91, 91, 91, 91, 177, 177, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91,
+  91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91,
+  177, 136, 136, 136, 177, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136,
+  136, 136, 136, 136, 136, 136, 136, 177, 177, 177, 136, 136, 136, 136, 136, 136,
+  136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136,
+  136, 136, 177, 136, 136, 136, 136, 136, 136, 136, 136, 136, 177, 136, 177, 177,
+  136, 136, 136, 136, 136, 136, 136, 177, 177, 177, 136, 177, 177, 177, 177, 136,
+  136, 136, 136, 136, 136, 177, 136, 177, 136, 136, 136, 136, 136, 136, 136, 136,
+  177, 177, 177, 177, 177, 177, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136,
+  177, 177, 136, 136, 136, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157,
+  157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157,
+  157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157,
+  157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 177, 177, 177, 177, 176,
+  157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157,
+  157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 157, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 73, 73, 177, 73, 177, 73, 73, 73, 73, 73, 177, 73, 73, 73, 73,
+  73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+  73, 73, 73, 73, 177, 73, 177, 73, 73, 73, 73, 73, 73, 73, 73, 73,
+  73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 177, 177,
+  73, 73, 73, 73, 73, 177, 73, 177, 73, 73, 73, 73, 73, 73, 73, 177,
+  73, 73, 73, 73, 73, 73, 73, 73, 73, 73, 177, 177, 73, 73, 73, 73,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158,
+  158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158,
+  158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158,
+  158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158,
+  158, 158, 158, 158, 158, 158, 158, 158, 177, 158, 158, 158, 158, 158, 158, 158,
+  158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158,
+  158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 177, 177, 177,
+  177, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158,
+  158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158,
+  158, 158, 158, 158, 158, 158, 158, 158, 177, 158, 158, 158, 158, 158, 158, 158,
+  158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158,
+  158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 177, 158, 158,
+  158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 177, 158, 158,
+  158, 158, 158, 158, 158, 176, 176, 176, 176, 158, 158, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+  97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+  97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+  97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+  97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+  97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+  97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+  97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+  97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+  97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+  39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+  39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+  39, 39, 39, 39, 39, 39, 177, 39, 177, 177, 177, 177, 177, 39, 177, 177,
+  39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+  39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+  39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 176, 39, 39, 39, 39,
+  49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+  49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+  49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+  49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+  49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+  49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+  49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+  49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+  49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+  49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+  49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+  49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+  49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+  49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+  49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+  49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+  37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+  37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+  37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+  37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+  37, 37, 37, 37, 37, 37, 37, 37, 37, 177, 37, 37, 37, 37, 177, 177,
+  37, 37, 37, 37, 37, 37, 37, 177, 37, 177, 37, 37, 37, 37, 177, 177,
+  37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+  37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+  37, 37, 37, 37, 37, 37, 37, 37, 37, 177, 37, 37, 37, 37, 177, 177,
+  37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+  37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+  37, 177, 37, 37, 37, 37, 177, 177, 37, 37, 37, 37, 37, 37, 37, 177,
+  37, 177, 37, 37, 37, 37, 177, 177, 37, 37, 37, 37, 37, 37, 37, 37,
+  37, 37, 37, 37, 37, 37, 37, 177, 37, 37, 37, 37, 37, 37, 37, 37,
+  37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+  37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+  37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+  37, 177, 37, 37, 37, 37, 177, 177, 37, 37, 37, 37, 37, 37, 37, 37,
+  37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+  37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+  37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+  37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 177, 177, 37, 37, 37,
+  37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+  37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 177, 177, 177,
+  37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+  37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 177, 177, 177, 177, 177, 177,
+  23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+  23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+  23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+  23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+  23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+  23, 23, 23, 23, 23, 23, 177, 177, 23, 23, 23, 23, 23, 23, 177, 177,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105,
+  105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 177, 177, 177,
+  125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+  125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+  125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+  125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+  125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 125, 176, 176, 176, 125, 125,
+  125, 125, 125, 125, 125, 125, 125, 125, 125, 177, 177, 177, 177, 177, 177, 177,
+  155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 155,
+  155, 155, 155, 155, 155, 155, 177, 177, 177, 177, 177, 177, 177, 177, 177, 155,
+  51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+  51, 51, 51, 51, 51, 176, 176, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 177, 145, 145,
+  145, 177, 145, 145, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+  66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+  66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+  66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+  66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+  66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 177, 177,
+  66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 177, 177, 177, 177, 177, 177,
+  66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 177, 177, 177, 177, 177, 177,
+  93, 93, 176, 176, 93, 176, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 177, 177, 177, 177, 177, 177,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 177, 177, 177, 177, 177, 177, 177,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 177, 177, 177, 177, 177,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  20, 20, 20, 20, 20, 20, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+  76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 177,
+  76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 177, 177, 177, 177,
+  76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 177, 177, 177, 177,
+  76, 177, 177, 177, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+  147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147,
+  147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 177, 177,
+  147, 147, 147, 147, 147, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148,
+  148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148,
+  148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 177, 177, 177, 177,
+  148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148,
+  148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 177, 177, 177, 177, 177, 177,
+  148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 177, 177, 177, 148, 148,
+  66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+  66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+  17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+  17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 177, 177, 17, 17,
+  72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+  72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+  72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+  72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 177,
+  72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72,
+  72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 177, 177, 72,
+  72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 177, 177, 177, 177, 177, 177,
+  72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 177, 177, 177, 177, 177, 177,
+  72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 177, 177,
+  175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+  175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+  175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+  175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+  175, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+  7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+  7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+  7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+  7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 177, 7, 7,
+  7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+  7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+  7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+  141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141,
+  141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141,
+  141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141,
+  141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141, 141,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 177, 177, 177, 177, 177, 177, 177, 177, 10, 10, 10, 10,
+  75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+  75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+  75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 75,
+  75, 75, 75, 75, 75, 75, 75, 75, 177, 177, 177, 75, 75, 75, 75, 75,
+  75, 75, 75, 75, 75, 75, 75, 75, 75, 75, 177, 177, 177, 75, 75, 75,
+  106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106,
+  106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106,
+  106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 177, 177, 177, 177, 177,
+  39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+  39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+  39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 177, 177, 39, 39, 39,
+  141, 141, 141, 141, 141, 141, 141, 141, 177, 177, 177, 177, 177, 177, 177, 177,
+  175, 175, 175, 176, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+  175, 176, 175, 175, 175, 175, 175, 175, 175, 176, 176, 176, 176, 175, 176, 176,
+  176, 176, 176, 176, 175, 176, 176, 176, 175, 175, 176, 177, 177, 177, 177, 177,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 45, 45, 45, 45, 45, 28, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 45, 45, 45,
+  45, 45, 74, 74, 74, 74, 45, 45, 45, 45, 45, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 28, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 45,
+  175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+  175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+  175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+  175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+  45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+  45, 45, 45, 45, 45, 45, 177, 177, 45, 45, 45, 45, 45, 45, 177, 177,
+  45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+  45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+  45, 45, 45, 45, 45, 45, 177, 177, 45, 45, 45, 45, 45, 45, 177, 177,
+  45, 45, 45, 45, 45, 45, 45, 45, 177, 45, 177, 45, 177, 45, 177, 45,
+  45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+  45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 177, 177,
+  45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+  45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+  45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+  45, 45, 45, 45, 45, 177, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+  45, 45, 45, 45, 45, 177, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+  45, 45, 45, 45, 177, 177, 45, 45, 45, 45, 45, 45, 177, 45, 45, 45,
+  45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+  177, 177, 45, 45, 45, 177, 45, 45, 45, 45, 45, 45, 45, 45, 45, 177,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 175, 175, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 177, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 74, 177, 177, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 74,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+  175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+  175, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 45, 176, 176, 176, 74, 74, 176, 176, 176, 176,
+  176, 176, 74, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 74, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 176, 176, 176, 177, 177, 177, 177,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+  16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+  16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+  16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+  16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+  16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+  16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+  16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+  16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+  16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+  16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+  16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+  16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+  16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+  16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+  16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 177, 177, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+  40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+  40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+  40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+  40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+  40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+  25, 25, 25, 25, 177, 177, 177, 177, 177, 25, 25, 25, 25, 25, 25, 25,
+  39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+  39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+  39, 39, 39, 39, 39, 39, 177, 39, 177, 177, 177, 177, 177, 39, 177, 177,
+  154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154,
+  154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154,
+  154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 154,
+  154, 154, 154, 154, 154, 154, 154, 154, 177, 177, 177, 177, 177, 177, 177, 154,
+  154, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 154,
+  37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+  37, 37, 37, 37, 37, 37, 37, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  37, 37, 37, 37, 37, 37, 37, 177, 37, 37, 37, 37, 37, 37, 37, 177,
+  37, 37, 37, 37, 37, 37, 37, 177, 37, 37, 37, 37, 37, 37, 37, 177,
+  37, 37, 37, 37, 37, 37, 37, 177, 37, 37, 37, 37, 37, 37, 37, 177,
+  37, 37, 37, 37, 37, 37, 37, 177, 37, 37, 37, 37, 37, 37, 37, 177,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 177, 177,
+  176, 176, 176, 176, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 177, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 50, 176, 50, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 50, 50, 50, 50, 50, 50, 50, 50, 50, 175, 175, 175, 175, 49, 49,
+  176, 176, 176, 176, 176, 176, 176, 176, 50, 50, 50, 50, 176, 176, 176, 176,
+  177, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 177, 177, 175, 175, 176, 176, 54, 54, 54,
+  176, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+  63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+  63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+  63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+  63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+  63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 176, 176, 63, 63, 63,
+  177, 177, 177, 177, 177, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+  14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+  14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+  177, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+  49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+  49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+  49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+  49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+  49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 177,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+  14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 177, 177, 177, 177, 177, 177, 177, 177, 177, 176,
+  63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+  49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+  49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 177,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+  49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+  63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+  63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 176,
+  63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+  63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+  63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+  63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+  63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+  63, 63, 63, 63, 63, 63, 63, 63, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173,
+  173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173,
+  173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173,
+  173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173,
+  173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173,
+  173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173,
+  173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173,
+  173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173,
+  173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173,
+  173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173,
+  173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173,
+  173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173,
+  173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173,
+  173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173,
+  173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173,
+  173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173,
+  173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173,
+  173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173,
+  173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173,
+  173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173,
+  173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173,
+  173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173,
+  173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173,
+  173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173,
+  173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 177, 177, 177,
+  173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173,
+  173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173,
+  173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173, 173,
+  173, 173, 173, 173, 173, 173, 173, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+  79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+  79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+  166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166,
+  166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166,
+  166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166,
+  166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166,
+  166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166,
+  166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166,
+  166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166,
+  166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166,
+  166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166,
+  166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166,
+  166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166,
+  166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166,
+  166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166,
+  166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166,
+  166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166,
+  166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166,
+  166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166,
+  166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166,
+  166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+  8, 8, 8, 8, 8, 8, 8, 8, 177, 177, 177, 177, 177, 177, 177, 177,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 176, 176, 176, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 177, 177,
+  177, 177, 74, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143,
+  143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143,
+  143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 143, 177, 177, 177,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 177, 177, 177, 177, 177, 177,
+  117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+  117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+  117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+  117, 117, 117, 117, 117, 117, 117, 117, 177, 177, 177, 177, 177, 177, 177, 177,
+  128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+  128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+  128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+  128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+  128, 128, 128, 128, 128, 128, 177, 177, 177, 177, 177, 177, 177, 177, 128, 128,
+  128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 177, 177, 177, 177, 177, 177,
+  29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+  29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62,
+  62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 176, 62,
+  123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123,
+  123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123,
+  123, 123, 123, 123, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 123,
+  49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+  49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 177, 177, 177,
+  60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+  60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+  60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+  60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+  60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 177, 176,
+  60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 177, 177, 177, 177, 60, 60,
+  97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+  97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 177,
+  22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+  22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+  22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+  22, 22, 22, 22, 22, 22, 22, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 177, 177,
+  22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 177, 177, 22, 22, 22, 22,
+  97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+  97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+  151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151,
+  151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151,
+  151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151,
+  151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151, 151,
+  151, 151, 151, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 151, 151, 151, 151, 151,
+  95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+  95, 95, 95, 95, 95, 95, 95, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 37, 37, 37, 37, 37, 37, 177, 177, 37, 37, 37, 37, 37, 37, 177,
+  177, 37, 37, 37, 37, 37, 37, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  37, 37, 37, 37, 37, 37, 37, 177, 37, 37, 37, 37, 37, 37, 37, 177,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 176, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 45, 74, 74, 74, 74, 176, 176, 74, 74, 177, 177,
+  23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+  23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+  23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+  23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+  23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+  95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+  95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+  95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 177, 177,
+  95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 177, 177, 177, 177, 177, 177,
+  49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+  49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+  49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+  49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+  49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+  49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+  49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+  49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+  49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+  49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+  49, 49, 49, 49, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+  49, 49, 49, 49, 49, 49, 49, 177, 177, 177, 177, 49, 49, 49, 49, 49,
+  49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+  49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+  49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 177, 177,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  74, 74, 74, 74, 74, 74, 74, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 5, 5, 5, 5, 5, 177, 177, 177, 177, 177, 53, 53, 53,
+  53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+  53, 53, 53, 53, 53, 53, 53, 177, 53, 53, 53, 53, 53, 177, 53, 177,
+  53, 53, 177, 53, 53, 177, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 176, 176,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 177, 177, 177, 177, 177, 177,
+  175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 28, 28,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 177, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 177, 176, 176, 176, 176, 177, 177, 177, 177,
+  3, 3, 3, 3, 3, 177, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 177, 177, 176,
+  177, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 176, 176, 176, 176, 176,
+  176, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+  176, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+  63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+  63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 176, 176,
+  49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+  49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 177,
+  177, 177, 49, 49, 49, 49, 49, 49, 177, 177, 49, 49, 49, 49, 49, 49,
+  177, 177, 49, 49, 49, 49, 49, 49, 177, 177, 49, 49, 49, 177, 177, 177,
+  176, 176, 176, 176, 176, 176, 176, 177, 176, 176, 176, 176, 176, 176, 176, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 176, 176, 176, 176, 176, 177, 177,
+  78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 177, 78, 78, 78,
+  78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+  78, 78, 78, 78, 78, 78, 78, 177, 78, 78, 78, 78, 78, 78, 78, 78,
+  78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 177, 78, 78, 177, 78,
+  78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 177, 177,
+  78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+  78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+  78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+  78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+  78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+  78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+  78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+  78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 177, 177, 177, 177, 177,
+  176, 176, 176, 177, 177, 177, 177, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 177, 177, 177, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+  45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+  45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+  45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+  45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 177,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 177, 177, 177,
+  45, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 175, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 177, 177, 177,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+  21, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  175, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 177, 177, 177, 177,
+  59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+  59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+  59, 59, 59, 59, 177, 177, 177, 177, 177, 177, 177, 177, 177, 59, 59, 59,
+  43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43,
+  43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 177, 177, 177, 177, 177,
+  116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
+  116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
+  116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 177, 177, 177, 177, 177,
+  165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165,
+  165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 177, 165,
+  170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 177, 177, 177, 177, 170, 170, 170, 170, 170, 170, 170, 170,
+  170, 170, 170, 170, 170, 170, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+  131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+  131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+  131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131, 131,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 177, 177,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 177, 177, 177, 177, 177, 177,
+  110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110,
+  110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110,
+  110, 110, 110, 110, 177, 177, 177, 177, 110, 110, 110, 110, 110, 110, 110, 110,
+  110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110,
+  110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 177, 177, 177, 177,
+  35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+  35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+  35, 35, 35, 35, 35, 35, 35, 35, 177, 177, 177, 177, 177, 177, 177, 177,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 1,
+  167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 177, 167, 167, 167, 167,
+  167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 177, 167, 167, 167, 167,
+  167, 167, 167, 177, 167, 167, 177, 167, 167, 167, 167, 167, 167, 167, 167, 167,
+  167, 167, 177, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167,
+  167, 167, 177, 167, 167, 167, 167, 167, 167, 167, 177, 167, 167, 177, 177, 177,
+  161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161,
+  161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161,
+  161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161,
+  161, 161, 161, 161, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+  77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+  77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+  77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+  77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+  77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+  77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+  77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+  77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+  77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+  77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+  77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+  77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+  77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+  77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+  77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+  77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+  77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+  77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+  77, 77, 77, 77, 77, 77, 77, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+  77, 77, 77, 77, 77, 77, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  77, 77, 77, 77, 77, 77, 77, 77, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  74, 74, 74, 74, 74, 74, 177, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 177, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  27, 27, 27, 27, 27, 27, 177, 177, 27, 177, 27, 27, 27, 27, 27, 27,
+  27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+  27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+  27, 27, 27, 27, 27, 27, 177, 27, 27, 177, 177, 177, 27, 177, 177, 27,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 177, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113,
+  113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113,
+  101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+  101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 177,
+  177, 177, 177, 177, 177, 177, 177, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+  52, 52, 52, 177, 52, 52, 177, 177, 177, 177, 177, 52, 52, 52, 52, 52,
+  120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120,
+  120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 177, 177, 177, 120,
+  81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+  81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 177, 177, 177, 177, 177, 81,
+  134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134,
+  134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90,
+  90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90, 90,
+  89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89,
+  89, 89, 89, 89, 89, 89, 89, 89, 177, 177, 177, 177, 89, 89, 89, 89,
+  89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89,
+  177, 177, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89,
+  89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89,
+  89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89,
+  65, 65, 65, 65, 177, 65, 65, 177, 177, 177, 177, 177, 65, 65, 65, 65,
+  65, 65, 65, 65, 177, 65, 65, 65, 177, 65, 65, 65, 65, 65, 65, 65,
+  65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+  65, 65, 65, 65, 65, 65, 177, 177, 65, 65, 65, 177, 177, 177, 177, 65,
+  65, 65, 65, 65, 65, 65, 65, 65, 65, 177, 177, 177, 177, 177, 177, 177,
+  65, 65, 65, 65, 65, 65, 65, 65, 65, 177, 177, 177, 177, 177, 177, 177,
+  127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
+  127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
+  100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+  100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 177, 177, 177, 177, 85, 85, 85, 85, 85,
+  85, 85, 85, 85, 85, 85, 85, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 177, 177, 177, 6, 6, 6, 6, 6, 6, 6,
+  122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
+  122, 122, 122, 122, 122, 122, 177, 177, 122, 122, 122, 122, 122, 122, 122, 122,
+  118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118,
+  118, 118, 118, 177, 177, 177, 177, 177, 118, 118, 118, 118, 118, 118, 118, 118,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119, 177, 177, 177, 177, 177, 177, 177, 119, 119, 119, 119, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 119, 119, 119, 119, 119, 119, 119,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+  108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+  108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+  108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+  108, 108, 108, 108, 108, 108, 108, 108, 108, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+  58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+  58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+  58, 58, 58, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+  58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+  58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+  58, 58, 58, 177, 177, 177, 177, 177, 177, 177, 58, 58, 58, 58, 58, 58,
+  124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124,
+  124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 124,
+  124, 124, 124, 124, 124, 124, 124, 124, 177, 177, 177, 177, 177, 177, 177, 177,
+  124, 124, 124, 124, 124, 124, 124, 124, 124, 124, 177, 177, 177, 177, 177, 177,
+  38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+  38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+  38, 38, 38, 38, 38, 38, 177, 177, 177, 38, 38, 38, 38, 38, 38, 38,
+  38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+  38, 38, 38, 38, 38, 38, 177, 177, 177, 177, 177, 177, 177, 177, 38, 38,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 177,
+  172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172,
+  172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172,
+  172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 177, 172, 172, 172, 177, 177,
+  172, 172, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 3, 3, 3, 3, 3, 3, 177, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 177,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138,
+  138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138, 138,
+  138, 138, 138, 138, 138, 138, 138, 138, 177, 177, 177, 177, 177, 177, 177, 177,
+  137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137,
+  137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 137,
+  137, 137, 137, 137, 137, 137, 137, 137, 137, 137, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112,
+  112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+  24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+  15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+  15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+  15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+  15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 177, 177,
+  177, 177, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+  15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+  15, 15, 15, 15, 15, 15, 177, 177, 177, 177, 177, 177, 177, 177, 177, 15,
+  71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+  71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+  71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+  71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+  71, 71, 71, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 71, 177, 177,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 139,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 177, 177, 177, 177, 177, 177, 177,
+  139, 139, 139, 139, 139, 139, 139, 139, 139, 139, 177, 177, 177, 177, 177, 177,
+  19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+  19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+  19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+  19, 19, 19, 19, 19, 177, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+  19, 19, 19, 19, 19, 19, 19, 19, 177, 177, 177, 177, 177, 177, 177, 177,
+  82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+  82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82, 82,
+  82, 82, 82, 82, 82, 82, 82, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132,
+  132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132,
+  132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132,
+  132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132,
+  132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132,
+  132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132,
+  177, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136,
+  136, 136, 136, 136, 136, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+  67, 67, 177, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+  67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+  67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+  67, 67, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  96, 96, 96, 96, 96, 96, 96, 177, 96, 177, 96, 96, 96, 96, 177, 96,
+  96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 177, 96,
+  96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 177, 177, 177, 177, 177, 177,
+  135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135,
+  135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135,
+  135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135,
+  135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 177, 177, 177, 177, 177,
+  135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 177, 177, 177, 177, 177, 177,
+  44, 44, 44, 44, 177, 44, 44, 44, 44, 44, 44, 44, 44, 177, 177, 44,
+  44, 177, 177, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 44, 44, 44, 44, 177, 44, 44, 44, 44, 44, 44,
+  44, 177, 44, 44, 177, 44, 44, 44, 44, 44, 177, 175, 44, 44, 44, 44,
+  44, 44, 44, 44, 44, 177, 177, 44, 44, 177, 177, 44, 44, 44, 177, 177,
+  44, 177, 177, 177, 177, 177, 177, 44, 177, 177, 177, 177, 177, 44, 44, 44,
+  44, 44, 44, 44, 177, 177, 44, 44, 44, 44, 44, 44, 44, 177, 177, 177,
+  44, 44, 44, 44, 44, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 177, 164, 177, 177, 164, 177,
+  164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164,
+  164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164,
+  164, 164, 164, 164, 164, 164, 177, 164, 164, 164, 164, 164, 164, 164, 164, 164,
+  164, 177, 164, 177, 177, 164, 177, 164, 164, 164, 164, 177, 164, 164, 164, 164,
+  164, 164, 164, 164, 164, 164, 177, 164, 164, 177, 177, 177, 177, 177, 177, 177,
+  177, 164, 164, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+  102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 177, 102, 102, 102,
+  102, 102, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159,
+  159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159,
+  159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159,
+  159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159,
+  159, 159, 159, 159, 159, 159, 159, 159, 177, 177, 177, 177, 177, 177, 177, 177,
+  159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+  133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+  133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+  133, 133, 133, 133, 133, 133, 177, 177, 133, 133, 133, 133, 133, 133, 133, 133,
+  133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+  133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92,
+  92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92,
+  92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92,
+  92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92,
+  92, 92, 92, 92, 92, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 177, 177, 177, 177, 177, 177,
+  93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+  146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+  146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+  146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 177, 177, 177, 177, 177, 177,
+  146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 177, 177, 177, 177, 177, 177,
+  97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+  97, 97, 97, 97, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 177, 177, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 177, 177, 177, 177,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+  31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+  31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+  31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168,
+  168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168,
+  168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168,
+  168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168,
+  168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168,
+  168, 168, 168, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 168,
+  30, 30, 30, 30, 30, 30, 30, 177, 177, 30, 177, 177, 30, 30, 30, 30,
+  30, 30, 30, 30, 177, 30, 30, 177, 30, 30, 30, 30, 30, 30, 30, 30,
+  30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+  30, 30, 30, 30, 30, 30, 177, 30, 30, 177, 177, 30, 30, 30, 30, 30,
+  30, 30, 30, 30, 30, 30, 30, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  99, 99, 99, 99, 99, 99, 99, 99, 177, 177, 99, 99, 99, 99, 99, 99,
+  99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+  99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+  99, 99, 99, 99, 99, 99, 99, 99, 177, 177, 99, 99, 99, 99, 99, 99,
+  99, 99, 99, 99, 99, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174,
+  174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174,
+  174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174,
+  174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174,
+  174, 174, 174, 174, 174, 174, 174, 174, 177, 177, 177, 177, 177, 177, 177, 177,
+  140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+  140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+  140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+  140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+  140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140, 140,
+  140, 140, 140, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114,
+  114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114,
+  114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114,
+  114, 114, 114, 114, 114, 114, 114, 114, 114, 177, 177, 177, 177, 177, 177, 177,
+  29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  132, 132, 132, 132, 132, 132, 132, 132, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+  142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+  142, 142, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 177, 177, 177, 177, 177, 177,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 177, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 177, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 177, 177, 177,
+  86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86,
+  86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86,
+  177, 177, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86, 86,
+  86, 86, 86, 86, 86, 86, 86, 86, 177, 86, 86, 86, 86, 86, 86, 86,
+  86, 86, 86, 86, 86, 86, 86, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  42, 42, 42, 42, 42, 42, 42, 177, 42, 42, 177, 42, 42, 42, 42, 42,
+  42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+  42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+  42, 42, 42, 42, 42, 42, 42, 177, 177, 177, 42, 177, 42, 42, 177, 42,
+  42, 42, 42, 42, 42, 42, 42, 42, 177, 177, 177, 177, 177, 177, 177, 177,
+  42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 177, 177, 177, 177, 177, 177,
+  41, 41, 41, 41, 41, 41, 177, 41, 41, 177, 41, 41, 41, 41, 41, 41,
+  41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+  41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 177,
+  41, 41, 177, 41, 41, 41, 41, 41, 41, 177, 177, 177, 177, 177, 177, 177,
+  41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 177, 177, 177, 177, 177, 177,
+  162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162,
+  162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162,
+  162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 177, 177, 177, 177,
+  162, 162, 162, 162, 162, 162, 162, 162, 162, 162, 177, 177, 177, 177, 177, 177,
+  11, 11, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83,
+  83, 83, 83, 83, 83, 83, 83, 83, 83, 177, 177, 177, 177, 177, 177, 177,
+  64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+  64, 177, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+  64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+  64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 177, 177, 177, 64, 64,
+  64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+  64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  79, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149,
+  149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149,
+  149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149, 149,
+  149, 149, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 149,
+  171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+  171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+  171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+  171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+  171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+  171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+  171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+  171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+  171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+  171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+  171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+  171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+  171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+  171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+  171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+  171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+  171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+  171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+  171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+  171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+  171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+  171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+  171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+  171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+  171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+  171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+  171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+  171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+  171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+  171, 171, 171, 171, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+  171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+  171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+  171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+  171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+  171, 171, 171, 171, 171, 171, 171, 171, 115, 115, 115, 115, 115, 115, 115, 115,
+  115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115,
+  115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115,
+  115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115,
+  115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115,
+  115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115,
+  115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115,
+  115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115,
+  115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115,
+  115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115,
+  115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 171, 171, 171, 171,
+  171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+  171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+  171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+  171, 171, 171, 171, 171, 171, 171, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+  26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+  26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+  26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+  26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+  26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+  26, 26, 26, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+  34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 177, 177, 177, 177, 177,
+  55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+  55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+  55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+  55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+  55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+  55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+  55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+  55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+  55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+  55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+  55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+  55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+  55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+  55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+  55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+  55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+  55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+  55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+  55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+  55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+  55, 55, 55, 55, 55, 55, 55, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+  47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+  8, 8, 8, 8, 8, 8, 8, 8, 8, 177, 177, 177, 177, 177, 177, 177,
+  94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94,
+  94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 177,
+  94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 177, 177, 177, 177, 94, 94,
+  160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160,
+  160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160,
+  160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160,
+  160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160,
+  160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 177,
+  160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 177, 177, 177, 177, 177, 177,
+  9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+  9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 177, 177,
+  9, 9, 9, 9, 9, 9, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 177, 56, 56, 56, 56, 56,
+  56, 56, 177, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 177, 177, 177, 177, 177, 56, 56, 56,
+  56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56, 56,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
+  70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
+  70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 70,
+  70, 70, 70, 70, 70, 70, 70, 70, 70, 70, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+  87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+  87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+  87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+  87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87,
+  87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 177, 177, 177, 177, 177,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 177, 177, 12, 12, 12, 12, 12,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  12, 12, 12, 12, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+  121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+  121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+  121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+  121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 177, 177, 177, 177, 121,
+  121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+  121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+  121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+  121, 121, 121, 121, 121, 121, 121, 121, 177, 177, 177, 177, 177, 177, 177, 121,
+  121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  150, 104, 50, 50, 68, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  50, 50, 50, 50, 50, 50, 50, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150,
+  150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150,
+  150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150,
+  150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150,
+  150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150,
+  150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150,
+  150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150,
+  150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150,
+  150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150,
+  150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150,
+  150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150,
+  150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150,
+  150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150,
+  150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150,
+  150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150,
+  150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150,
+  68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+  68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+  68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+  68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+  68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+  68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+  68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+  68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+  68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+  68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+  68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+  68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+  68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+  68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+  68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+  68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+  68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+  68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+  68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+  68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+  68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+  68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+  68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+  68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+  68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+  68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+  68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+  68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+  68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+  68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 68,
+  150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150,
+  150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150,
+  150, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150,
+  150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150,
+  150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150,
+  150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150,
+  150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150,
+  150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150,
+  150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150, 150,
+  150, 150, 150, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+  61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+  61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+  61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+  61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+  61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+  61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+  61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+  61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+  61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+  61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+  61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+  61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+  61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+  61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+  61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+  61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+  61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+  61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+  61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+  61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+  61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+  61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+  61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+  61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+  61, 61, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+  61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+  61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+  61, 61, 61, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  63, 63, 63, 63, 177, 63, 63, 63, 63, 63, 63, 63, 177, 63, 63, 177,
+  63, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+  63, 63, 63, 54, 63, 63, 63, 63, 63, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 54, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  54, 54, 54, 177, 177, 63, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 63, 63, 63, 63, 63, 177, 177, 177, 177, 177, 177, 177,
+  104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+  104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+  104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+  104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+  104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+  104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+  104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+  104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+  104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+  104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+  104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+  104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+  104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+  104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+  104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+  104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+  104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+  104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+  104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+  104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+  104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+  104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+  104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+  104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+  104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 177, 177, 177, 177,
+  33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+  33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+  33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+  33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+  33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+  33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+  33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 177, 177, 177, 177, 177,
+  33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 177, 177, 177,
+  33, 33, 33, 33, 33, 33, 33, 33, 33, 177, 177, 177, 177, 177, 177, 177,
+  33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 177, 177, 33, 33, 33, 33,
+  176, 176, 176, 176, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 177, 177, 177,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 177, 177, 177, 177, 177, 177, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 177, 176, 176, 176, 177, 177, 177, 177, 177, 177, 177, 177, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 177, 177,
+  175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+  175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+  175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 177, 177,
+  175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+  175, 175, 175, 175, 175, 175, 175, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 175, 175, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 175, 175, 175, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 175, 175, 175, 175, 175,
+  175, 175, 175, 176, 176, 175, 175, 175, 175, 175, 175, 175, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 175, 175, 175, 175, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+  45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+  45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+  45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+  45, 45, 45, 45, 45, 45, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 175, 175, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 177, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 177, 176, 176,
+  177, 177, 176, 177, 177, 176, 176, 177, 177, 176, 176, 176, 176, 177, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 177, 176, 177, 176, 176, 176,
+  176, 176, 176, 176, 177, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 177, 176, 176, 176, 176, 177, 177, 176, 176, 176,
+  176, 176, 176, 176, 176, 177, 176, 176, 176, 176, 176, 176, 176, 177, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 177, 176, 176, 176, 176, 177,
+  176, 176, 176, 176, 176, 177, 176, 177, 177, 177, 176, 176, 176, 176, 176, 176,
+  176, 177, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 177, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 177, 177, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130,
+  130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130,
+  130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130,
+  130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130,
+  130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130,
+  130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130,
+  130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130,
+  130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130,
+  130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130,
+  130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130,
+  130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130,
+  130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130,
+  130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130,
+  130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130,
+  130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130,
+  130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130,
+  130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130,
+  130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130,
+  130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130,
+  130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130,
+  130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130,
+  130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130,
+  130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130,
+  130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130,
+  130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 130, 130, 130, 130, 130,
+  177, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  74, 74, 74, 74, 74, 74, 74, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  74, 74, 74, 45, 45, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74,
+  40, 40, 40, 40, 40, 40, 40, 177, 40, 40, 40, 40, 40, 40, 40, 40,
+  40, 40, 40, 40, 40, 40, 40, 40, 40, 177, 177, 40, 40, 40, 40, 40,
+  40, 40, 177, 40, 40, 177, 40, 40, 40, 40, 40, 177, 177, 177, 177, 177,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 28,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+  57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57,
+  57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 177, 177, 177,
+  57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 177, 177,
+  57, 57, 57, 57, 57, 57, 57, 57, 57, 57, 177, 177, 177, 177, 57, 57,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163,
+  163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+  169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+  169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 169,
+  169, 169, 169, 169, 169, 169, 169, 169, 169, 169, 177, 177, 177, 177, 177, 169,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98,
+  98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98,
+  98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+  107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 177, 177, 177, 177, 107,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152,
+  152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 177,
+  152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152, 152,
+  152, 152, 152, 152, 152, 152, 177, 177, 177, 177, 177, 177, 177, 177, 152, 152,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  37, 37, 37, 37, 37, 37, 37, 177, 37, 37, 37, 37, 177, 37, 37, 177,
+  37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 177,
+  88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+  88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+  88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+  88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+  88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+  88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+  88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+  88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+  88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+  88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+  88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+  88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+  88, 88, 88, 88, 88, 177, 177, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+  88, 88, 88, 88, 88, 88, 88, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 177, 177, 177, 177,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 177, 177, 177, 177, 0, 0,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  3, 3, 3, 3, 177, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  177, 3, 3, 177, 3, 177, 177, 3, 177, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 177, 3, 3, 3, 3, 177, 3, 177, 3, 177, 177, 177, 177,
+  177, 177, 3, 177, 177, 177, 177, 3, 177, 3, 177, 3, 177, 3, 3, 3,
+  177, 3, 3, 177, 3, 177, 177, 3, 177, 3, 177, 3, 177, 3, 177, 3,
+  177, 3, 3, 177, 3, 177, 177, 3, 3, 3, 3, 177, 3, 3, 3, 3,
+  3, 3, 3, 177, 3, 3, 3, 3, 177, 3, 3, 3, 3, 177, 3, 177,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 177, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 177, 177, 177, 177,
+  177, 3, 3, 3, 177, 3, 3, 3, 3, 3, 177, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  3, 3, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 177, 177, 177, 177,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 177,
+  177, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  177, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  177, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  54, 176, 176, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 177, 177, 177, 177,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 177, 177, 177, 177, 177, 177, 177,
+  176, 176, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  176, 176, 176, 176, 176, 176, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 177, 177, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 177, 177, 177,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 177, 177, 177,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 177, 177, 177, 177,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 177, 177, 177, 177,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 177, 177, 177, 177,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 177, 177, 177, 177, 177, 177, 177, 177,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 177, 177, 177, 177, 177, 177,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 177, 177, 177, 177, 177, 177, 177, 177,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 177, 177,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 177, 177, 177, 177,
+  176, 176, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 177, 177, 177, 177, 177, 177, 177, 177,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 177, 177,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 177, 177, 177,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 177, 176, 177, 177, 177, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 177, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 177, 177, 177, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 177, 177, 177, 177, 177,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 177, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 177, 177, 177, 177, 177,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 177,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 177, 177,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 177, 177, 177, 177, 177,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+  50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129,
+  129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129,
+  129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129,
+  129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129,
+  129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129,
+  129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129,
+  129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129,
+  129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129,
+  129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129,
+  129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129,
+  129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129,
+  129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129,
+  129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129,
+  129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129,
+  129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129,
+  129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129,
+  129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129,
+  129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129,
+  129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129,
+  129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 176, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176, 176,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+  175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+  175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+  175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+  175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+  175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+  175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+  175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+  175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+  175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+  175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+  175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+  175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+  175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+  175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+  175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175, 175,
+  177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177, 177,
+};
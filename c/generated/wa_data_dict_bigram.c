@@ -0,0 +1,3215 @@
+#include "worldalphabets_data.h"
+
+static const uint32_t WA_BIGRAM_DICT_SLOTS[] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1118, 0, 1431, 0, 0, 0, 0,
+  1066, 2429, 0, 1222, 0, 0, 106, 0, 0, 0, 401, 0, 0, 0, 2383, 837,
+  1873, 0, 0, 234, 0, 979, 1244, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  844, 0, 0, 0, 0, 0, 607, 736, 0, 0, 0, 679, 0, 0, 0, 0,
+  0, 1221, 0, 0, 1268, 0, 0, 1546, 0, 0, 0, 0, 0, 53, 0, 0,
+  1128, 0, 0, 0, 0, 540, 2004, 0, 0, 0, 613, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 2059, 0, 0, 799, 0, 0, 854, 0,
+  0, 0, 0, 0, 1071, 225, 0, 0, 0, 0, 346, 0, 0, 108, 1132, 0,
+  92, 762, 372, 0, 0, 0, 0, 0, 843, 1017, 0, 0, 0, 1699, 0, 0,
+  0, 0, 0, 2072, 0, 503, 1861, 0, 2352, 0, 0, 0, 0, 1385, 0, 0,
+  0, 0, 1085, 2184, 1033, 622, 0, 0, 93, 1615, 0, 0, 0, 0, 0, 0,
+  0, 1247, 0, 0, 0, 1509, 0, 0, 1869, 0, 0, 594, 0, 0, 0, 635,
+  0, 0, 0, 0, 437, 0, 0, 528, 0, 0, 1048, 1786, 0, 0, 0, 0,
+  827, 98, 0, 134, 0, 0, 0, 1712, 0, 0, 0, 0, 0, 1646, 0, 0,
+  0, 0, 0, 0, 0, 1099, 0, 1642, 0, 0, 0, 0, 2051, 0, 1384, 0,
+  0, 0, 0, 0, 2446, 126, 69, 1124, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 1233, 420, 25, 0, 364, 0, 0, 0, 0, 0, 0,
+  488, 0, 902, 105, 2474, 0, 0, 0, 0, 0, 2376, 0, 0, 0, 965, 0,
+  0, 291, 0, 0, 2368, 0, 864, 1256, 1693, 0, 2456, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 950, 0, 0, 830, 0, 0, 828, 0, 0,
+  1671, 0, 0, 0, 639, 1820, 0, 1625, 151, 1780, 0, 0, 383, 2306, 0, 0,
+  1082, 0, 77, 502, 1716, 0, 310, 240, 0, 0, 0, 0, 88, 0, 0, 1063,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 371, 0, 1977, 0,
+  0, 0, 0, 0, 0, 0, 0, 555, 1054, 0, 0, 0, 1437, 1630, 823, 2064,
+  0, 1692, 2133, 0, 0, 0, 967, 0, 0, 1411, 0, 0, 0, 0, 0, 0,
+  0, 0, 2164, 1706, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  713, 0, 0, 1961, 0, 0, 0, 150, 0, 0, 1800, 0, 0, 0, 1985, 0,
+  0, 120, 0, 0, 0, 1138, 0, 0, 0, 692, 0, 0, 0, 0, 0, 0,
+  0, 1007, 191, 0, 1155, 494, 0, 0, 0, 0, 0, 1394, 617, 0, 0, 0,
+  1072, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 149, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 1828, 2281, 0, 2286, 0, 0, 1453, 0, 0, 0, 2443,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 1438, 1874, 742, 0, 495, 0, 0, 377, 1337, 0, 0, 0, 0, 0, 0,
+  0, 0, 2221, 2356, 0, 0, 0, 118, 0, 0, 0, 0, 0, 0, 0, 566,
+  1832, 1879, 0, 0, 2022, 733, 2263, 0, 0, 1147, 0, 770, 0, 160, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 100, 997, 0, 0,
+  0, 0, 0, 220, 1391, 0, 0, 0, 0, 0, 284, 1404, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 735, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2471,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 216,
+  564, 0, 0, 0, 0, 0, 0, 956, 0, 2374, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 1942, 0, 0, 0, 0, 1542, 886, 0,
+  0, 0, 0, 0, 0, 0, 1361, 1553, 589, 608, 0, 2172, 0, 0, 717, 0,
+  0, 994, 718, 1153, 0, 0, 0, 0, 0, 0, 1499, 99, 1891, 0, 1069, 2346,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 477, 1473, 0, 1400, 934, 1096,
+  2142, 2442, 0, 0, 0, 962, 0, 0, 1239, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 2005, 2193, 0, 0, 1979, 1678, 184, 0, 0, 0, 0, 0,
+  0, 0, 0, 826, 0, 935, 0, 0, 0, 2259, 409, 279, 0, 1200, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 1517, 399, 0, 0,
+  743, 0, 0, 0, 0, 0, 1951, 992, 0, 0, 0, 0, 0, 0, 0, 168,
+  0, 0, 1824, 1609, 0, 0, 0, 1657, 41, 1356, 1884, 0, 0, 0, 0, 2469,
+  1106, 0, 0, 1330, 0, 460, 0, 2351, 957, 1967, 0, 0, 891, 0, 539, 976,
+  0, 0, 147, 0, 0, 0, 0, 0, 0, 0, 0, 109, 0, 0, 1061, 0,
+  0, 0, 0, 0, 0, 1858, 0, 0, 0, 333, 0, 0, 916, 0, 0, 0,
+  1579, 0, 0, 0, 0, 0, 0, 0, 1836, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 1867, 0, 0, 1029, 1521, 0, 0, 0, 103, 1435,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 68, 928, 0, 0, 0, 0, 0, 1025, 1044, 1179,
+  2290, 0, 0, 910, 0, 0, 0, 177, 2284, 0, 1098, 0, 0, 347, 0, 0,
+  0, 0, 0, 1495, 0, 0, 0, 0, 0, 1392, 810, 0, 0, 973, 314, 2099,
+  767, 793, 0, 0, 489, 0, 0, 1767, 0, 0, 0, 1740, 0, 0, 0, 633,
+  0, 0, 974, 0, 0, 0, 1952, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 1916, 1390, 408, 0, 2120, 2372, 452, 164, 0, 0, 0, 0, 0,
+  1959, 0, 0, 0, 722, 0, 0, 1695, 0, 0, 0, 0, 0, 0, 1822, 0,
+  0, 0, 1497, 0, 1522, 0, 0, 0, 0, 107, 655, 874, 2247, 1123, 1573, 1523,
+  0, 0, 0, 0, 0, 1770, 0, 1586, 0, 0, 0, 202, 259, 1207, 0, 0,
+  0, 0, 1863, 0, 1757, 0, 0, 2460, 0, 0, 738, 0, 0, 0, 889, 0,
+  1715, 427, 1605, 0, 0, 0, 574, 0, 937, 1643, 0, 0, 0, 0, 0, 0,
+  0, 0, 2404, 0, 0, 771, 0, 0, 0, 0, 583, 0, 520, 1059, 350, 306,
+  2245, 1797, 0, 0, 1602, 0, 0, 906, 0, 0, 0, 0, 176, 0, 562, 0,
+  987, 0, 0, 1086, 0, 0, 0, 920, 1984, 0, 74, 0, 0, 0, 0, 0,
+  1898, 0, 0, 0, 0, 0, 0, 0, 0, 2427, 0, 0, 0, 0, 0, 0,
+  0, 0, 1024, 1537, 2407, 0, 0, 0, 0, 0, 0, 1273, 0, 1230, 0, 301,
+  0, 0, 981, 0, 0, 2337, 2406, 0, 995, 0, 0, 199, 0, 1323, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 2288, 0, 0, 0, 0, 197, 0,
+  0, 1871, 14, 829, 1451, 0, 2077, 179, 0, 0, 0, 2194, 2326, 0, 0, 0,
+  0, 604, 0, 0, 0, 0, 2369, 1868, 0, 0, 0, 0, 0, 1094, 0, 1570,
+  1775, 0, 0, 0, 0, 0, 0, 0, 0, 2107, 0, 0, 0, 0, 0, 2165,
+  2036, 0, 0, 0, 0, 0, 0, 2378, 0, 0, 0, 1157, 0, 690, 0, 0,
+  0, 1172, 1774, 0, 0, 0, 0, 774, 699, 991, 859, 2320, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 772, 11, 61, 700, 2067, 2215, 2305, 2316, 278, 0, 0,
+  0, 0, 0, 0, 274, 0, 0, 0, 2106, 0, 0, 0, 0, 2299, 0, 0,
+  1042, 0, 0, 0, 367, 1456, 0, 0, 0, 0, 0, 0, 0, 0, 1934, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1367, 0, 0, 0,
+  936, 0, 0, 0, 0, 0, 0, 0, 0, 1014, 0, 0, 0, 0, 0, 0,
+  0, 2224, 0, 0, 0, 1794, 0, 0, 0, 0, 0, 0, 892, 0, 501, 0,
+  0, 1919, 0, 2465, 558, 1160, 114, 0, 1009, 0, 0, 0, 1334, 0, 0, 0,
+  139, 0, 0, 0, 0, 754, 1548, 2140, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 1527, 0, 2363, 0, 0, 447, 0, 0, 0, 0,
+  0, 0, 2254, 0, 0, 0, 0, 0, 493, 0, 0, 982, 1428, 1697, 0, 0,
+  0, 777, 0, 0, 1396, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1290, 1746, 0, 0, 358, 0, 0, 0, 792, 0, 1126, 209, 0, 0,
+  0, 0, 0, 0, 378, 0, 0, 0, 0, 1600, 0, 0, 0, 1694, 0, 0,
+  0, 0, 0, 0, 414, 2162, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1784, 0, 739, 0, 544, 1798, 0,
+  0, 0, 0, 0, 381, 0, 0, 0, 1669, 0, 0, 0, 2350, 0, 0, 0,
+  0, 0, 749, 0, 0, 0, 1745, 0, 0, 2220, 0, 786, 1986, 695, 1340, 0,
+  500, 0, 0, 0, 0, 0, 1016, 1941, 0, 1591, 2414, 236, 0, 0, 0, 0,
+  0, 2412, 1393, 2169, 0, 228, 1010, 0, 0, 0, 1031, 0, 878, 2386, 0, 1449,
+  0, 831, 905, 1520, 1481, 2476, 1627, 1355, 0, 0, 1298, 0, 0, 0, 67, 369,
+  1899, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 996, 0, 0, 0,
+  0, 0, 643, 1511, 2207, 0, 0, 0, 0, 1317, 731, 0, 0, 0, 0, 0,
+  1855, 1883, 0, 0, 283, 0, 0, 0, 1732, 0, 1604, 0, 0, 1613, 0, 0,
+  0, 0, 0, 0, 1741, 0, 0, 0, 0, 2371, 1023, 0, 0, 0, 0, 642,
+  0, 1519, 0, 0, 0, 0, 0, 1748, 0, 1963, 2317, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1973, 1320, 0, 472,
+  933, 2206, 853, 2053, 0, 0, 0, 0, 0, 0, 2007, 2457, 285, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1907, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 1251, 0, 0, 0, 2105, 0, 0, 1541, 0, 993, 0, 0, 368,
+  2296, 0, 839, 0, 0, 0, 0, 2028, 1803, 1258, 2086, 2217, 211, 2191, 0, 0,
+  326, 0, 2292, 1030, 517, 1599, 1856, 1032, 2160, 0, 0, 0, 0, 0, 499, 0,
+  0, 2084, 0, 204, 1540, 0, 0, 0, 0, 2114, 0, 475, 0, 0, 0, 0,
+  2349, 0, 0, 0, 0, 1592, 0, 0, 0, 0, 0, 214, 2145, 0, 440, 0,
+  0, 444, 0, 0, 0, 0, 1758, 140, 0, 0, 0, 0, 2078, 0, 1726, 0,
+  0, 1514, 2045, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 413, 0, 0,
+  0, 0, 0, 1559, 681, 2071, 0, 704, 1696, 0, 0, 2179, 1996, 1164, 0, 2048,
+  0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 1368, 0, 0, 0, 0, 0,
+  0, 0, 0, 817, 1339, 871, 1992, 0, 1336, 0, 0, 0, 1974, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 744, 421, 1167, 1345, 0, 0, 332,
+  352, 0, 1422, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 882,
+  2177, 2185, 0, 0, 0, 1789, 0, 198, 1922, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 1659, 0, 659, 0, 210, 0, 56, 572, 0, 0, 0, 0, 0,
+  0, 0, 0, 257, 0, 2199, 2098, 1261, 0, 1809, 0, 0, 0, 0, 0, 116,
+  858, 1539, 2096, 0, 469, 0, 0, 1271, 2255, 0, 0, 0, 0, 0, 0, 123,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 1895, 261, 2439, 0, 0, 0, 47, 0, 0, 1046, 1994, 0, 0, 1372, 0,
+  0, 0, 0, 0, 515, 0, 0, 0, 0, 1101, 0, 0, 0, 0, 0, 0,
+  2335, 0, 0, 0, 1004, 1939, 2029, 0, 0, 0, 0, 1175, 0, 0, 443, 657,
+  0, 0, 0, 63, 111, 789, 0, 0, 0, 719, 0, 0, 0, 203, 504, 0,
+  0, 0, 0, 1894, 1402, 0, 0, 1608, 329, 0, 0, 0, 1928, 0, 0, 0,
+  0, 0, 0, 0, 2056, 0, 0, 0, 0, 1772, 2424, 1616, 0, 618, 697, 1295,
+  247, 2079, 0, 0, 0, 0, 0, 237, 0, 0, 125, 0, 2300, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 1015, 1171, 207, 1590, 0, 0, 1766, 0, 0,
+  0, 0, 0, 0, 0, 0, 341, 0, 0, 1906, 0, 0, 0, 0, 1954, 0,
+  0, 0, 2380, 478, 0, 0, 1463, 0, 0, 342, 0, 0, 0, 0, 0, 0,
+  1902, 0, 0, 1311, 869, 0, 0, 0, 1127, 0, 0, 1174, 1681, 542, 0, 0,
+  0, 1582, 1859, 0, 0, 0, 2235, 0, 705, 0, 0, 0, 0, 0, 0, 0,
+  31, 978, 0, 0, 0, 0, 0, 2410, 0, 0, 0, 0, 0, 2137, 142, 1065,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2242, 0, 0, 0, 0, 1655,
+  0, 0, 0, 553, 1331, 449, 685, 825, 0, 0, 1752, 0, 1140, 549, 0, 0,
+  313, 0, 0, 0, 0, 0, 0, 0, 0, 4, 1487, 0, 286, 0, 918, 0,
+  1373, 2287, 1081, 1496, 0, 807, 1926, 1957, 0, 0, 0, 0, 0, 2149, 0, 919,
+  1465, 233, 394, 1508, 2100, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 1068, 2015, 0, 0, 0, 0, 0, 0, 614, 0, 0,
+  1792, 857, 0, 230, 0, 0, 0, 0, 24, 0, 0, 1785, 2444, 0, 0, 0,
+  1177, 0, 0, 0, 0, 0, 1568, 280, 0, 0, 879, 2010, 0, 0, 0, 0,
+  0, 0, 0, 1359, 0, 0, 0, 862, 0, 0, 0, 1597, 0, 0, 0, 0,
+  464, 0, 1815, 322, 1833, 0, 1955, 0, 791, 2203, 0, 1208, 0, 0, 0, 0,
+  0, 0, 0, 2027, 757, 1178, 2082, 0, 1853, 0, 44, 0, 2170, 1309, 0, 0,
+  0, 1956, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 605, 81,
+  330, 0, 0, 0, 0, 855, 0, 0, 0, 0, 1936, 0, 0, 0, 0, 0,
+  76, 0, 0, 0, 0, 0, 559, 0, 1151, 1187, 519, 0, 0, 0, 1550, 0,
+  0, 0, 95, 1493, 1623, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1940, 1304,
+  0, 1890, 0, 0, 308, 0, 0, 2334, 0, 0, 0, 534, 833, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 548, 615, 0, 0, 0, 0, 0, 1280, 1279,
+  1510, 2251, 0, 0, 0, 0, 816, 0, 0, 2409, 113, 262, 389, 2275, 2452, 0,
+  0, 0, 0, 0, 465, 0, 0, 0, 543, 0, 0, 0, 0, 0, 0, 0,
+  1534, 2109, 0, 0, 0, 0, 0, 0, 0, 0, 1051, 0, 0, 0, 0, 467,
+  1733, 0, 1441, 1640, 0, 264, 0, 127, 0, 0, 0, 2112, 0, 1231, 0, 0,
+  0, 0, 0, 0, 0, 1291, 761, 0, 0, 727, 1702, 0, 0, 0, 0, 1494,
+  0, 1418, 0, 0, 0, 2366, 1326, 0, 1887, 0, 29, 1556, 0, 927, 0, 1409,
+  0, 0, 0, 0, 0, 0, 2119, 0, 0, 0, 0, 0, 0, 0, 1272, 0,
+  0, 0, 2052, 0, 0, 2459, 0, 0, 752, 0, 1112, 0, 0, 390, 0, 0,
+  0, 0, 2233, 0, 2110, 0, 0, 0, 896, 0, 0, 0, 0, 0, 1580, 0,
+  0, 0, 0, 0, 1471, 0, 0, 1012, 0, 0, 89, 1360, 94, 931, 1379, 926,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 698, 1639, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1049, 1976, 0, 1728, 0, 253, 556, 1783, 632, 0, 0, 0,
+  0, 0, 0, 1486, 0, 1468, 0, 0, 0, 949, 0, 2009, 0, 0, 315, 0,
+  0, 0, 0, 0, 0, 1475, 2370, 0, 463, 0, 0, 0, 0, 0, 292, 0,
+  0, 0, 2428, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 805, 0,
+  0, 603, 0, 457, 165, 737, 0, 0, 265, 0, 428, 181, 174, 403, 728, 2260,
+  0, 0, 524, 0, 0, 1257, 0, 0, 402, 1292, 2190, 2283, 161, 2196, 0, 0,
+  1760, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1618, 0, 0, 26, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 1648, 0, 0, 1333, 1932, 0, 0, 0, 0,
+  0, 0, 0, 523, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 115, 0, 0, 0, 0, 0, 1439, 0, 0, 0, 445, 2477, 1035, 0,
+  1193, 0, 0, 0, 0, 0, 860, 0, 51, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 2403, 0, 0, 1249, 2321, 82, 0, 0, 526, 759, 1562, 1653, 1206, 2411,
+  1948, 0, 0, 1498, 0, 670, 0, 0, 0, 716, 0, 2155, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1350, 1425, 1113, 0, 436, 0, 0,
+  0, 0, 2434, 0, 0, 0, 0, 0, 0, 0, 0, 117, 1100, 1736, 0, 0,
+  0, 0, 0, 0, 1401, 0, 0, 0, 0, 1764, 0, 0, 1321, 1679, 0, 0,
+  0, 0, 0, 1998, 1414, 1176, 0, 208, 0, 0, 0, 0, 2062, 0, 0, 0,
+  0, 0, 0, 0, 466, 0, 0, 1731, 0, 0, 0, 0, 0, 0, 2057, 0,
+  0, 0, 0, 2166, 1594, 0, 0, 1972, 0, 0, 0, 1448, 0, 2085, 1377, 1424,
+  0, 0, 0, 19, 0, 0, 581, 0, 0, 435, 0, 0, 0, 0, 0, 2375,
+  0, 1788, 0, 0, 0, 550, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1762, 723, 2264, 0, 0, 232, 0, 0, 0, 0, 1849, 0,
+  0, 0, 0, 0, 0, 0, 0, 1267, 1312, 1490, 0, 0, 0, 1937, 1219, 0,
+  0, 2390, 0, 781, 1450, 1380, 0, 899, 0, 1078, 1817, 2136, 2101, 922, 2237, 0,
+  867, 432, 0, 0, 0, 0, 0, 2076, 0, 1738, 0, 0, 0, 2144, 0, 0,
+  0, 1351, 1564, 1875, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 474, 2091, 0, 0, 809, 2113, 0, 1768, 0, 0, 0, 0, 2416, 0, 0,
+  2481, 0, 0, 2361, 0, 1595, 0, 541, 2312, 1383, 573, 2047, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 66, 1624, 1877, 0, 0, 0, 0, 0, 1927, 0, 1241,
+  2441, 0, 0, 0, 0, 0, 1077, 1265, 2002, 0, 0, 0, 0, 0, 0, 509,
+  0, 0, 0, 0, 1005, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  48, 0, 0, 0, 0, 1964, 1254, 2258, 0, 2339, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 2216, 0, 1412, 1192, 666, 0, 0, 0, 1538, 0, 0, 0, 1708,
+  2311, 0, 0, 0, 1607, 1983, 0, 59, 0, 0, 686, 0, 0, 158, 0, 0,
+  0, 0, 0, 0, 0, 0, 512, 0, 514, 0, 1303, 0, 0, 0, 0, 1923,
+  0, 319, 1277, 0, 0, 0, 894, 2241, 0, 1512, 0, 0, 0, 0, 0, 1778,
+  0, 0, 0, 0, 0, 0, 0, 2089, 0, 0, 0, 0, 0, 0, 0, 0,
+  2214, 0, 0, 0, 0, 804, 0, 0, 0, 0, 628, 0, 945, 1444, 392, 903,
+  0, 0, 258, 0, 0, 2466, 0, 866, 0, 167, 0, 0, 1872, 0, 0, 1477,
+  327, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1040, 0, 193, 785, 269,
+  0, 2202, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1447, 942, 1682,
+  0, 0, 1121, 0, 0, 171, 0, 1850, 0, 1622, 1142, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 1944, 0, 0, 0, 0, 2163, 2479, 0, 0, 0,
+  2279, 0, 0, 275, 65, 0, 0, 0, 960, 0, 298, 580, 0, 0, 838, 256,
+  373, 606, 0, 0, 0, 0, 1711, 0, 0, 0, 0, 0, 0, 2396, 0, 0,
+  0, 2467, 0, 0, 0, 0, 0, 773, 1885, 0, 0, 0, 1270, 0, 0, 188,
+  0, 0, 1933, 1805, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1395, 0, 311, 565, 0, 1719, 0, 0, 0, 0, 0, 0, 0, 0, 470, 0,
+  0, 0, 0, 0, 1406, 1593, 1848, 1749, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 2000, 2313, 0, 0, 0, 2037, 0, 0, 0,
+  0, 223, 2276, 0, 0, 847, 0, 144, 0, 2026, 0, 0, 192, 0, 0, 0,
+  0, 0, 190, 0, 2432, 0, 652, 2272, 0, 0, 0, 0, 1214, 0, 0, 23,
+  0, 0, 0, 0, 0, 0, 1561, 747, 944, 0, 0, 2138, 0, 0, 0, 0,
+  0, 0, 0, 0, 1013, 0, 1150, 0, 2148, 0, 1139, 0, 0, 2065, 0, 0,
+  0, 1921, 0, 0, 0, 895, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2362, 0, 0, 0, 0, 0, 295, 0, 0, 0, 0, 0, 0, 0, 1710, 1433,
+  365, 49, 1779, 0, 0, 0, 0, 1978, 0, 0, 1516, 0, 0, 1021, 554, 2222,
+  0, 0, 0, 0, 1845, 0, 0, 0, 0, 0, 0, 0, 0, 0, 510, 0,
+  0, 0, 252, 0, 0, 0, 0, 0, 0, 0, 0, 0, 801, 0, 1459, 0,
+  0, 0, 0, 0, 627, 0, 0, 0, 0, 2455, 1781, 0, 0, 0, 0, 1676,
+  0, 0, 0, 2447, 86, 1603, 2161, 0, 1220, 162, 1791, 925, 2399, 0, 2228, 1761,
+  0, 1091, 0, 0, 0, 0, 0, 64, 0, 1079, 473, 0, 0, 0, 0, 0,
+  0, 2080, 2253, 0, 0, 0, 0, 0, 0, 1045, 0, 0, 497, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 741, 0, 1480, 0, 0, 2128, 2173, 0, 0,
+  0, 0, 2017, 1375, 299, 0, 0, 0, 0, 1115, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 425, 0, 0, 0, 0, 2470, 442, 990, 1452, 0, 0, 746,
+  0, 1834, 2181, 0, 0, 0, 1543, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1097, 1847, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 0, 0, 0,
+  0, 0, 1162, 0, 0, 0, 0, 0, 0, 0, 396, 112, 0, 0, 148, 0,
+  0, 0, 0, 0, 0, 0, 0, 1881, 0, 0, 0, 0, 0, 0, 0, 620,
+  476, 0, 0, 0, 2426, 2295, 883, 1027, 0, 1776, 0, 1329, 0, 0, 0, 0,
+  0, 1535, 450, 0, 0, 0, 0, 1666, 1223, 640, 1358, 2262, 0, 0, 0, 0,
+  0, 1588, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 345, 0, 1003, 0, 2413, 0, 0, 0, 0, 2358, 0, 0,
+  0, 0, 0, 0, 0, 1677, 0, 448, 0, 2408, 2094, 709, 0, 0, 845, 0,
+  0, 0, 1621, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 2379, 0, 0, 0, 0, 0, 1769, 0, 0, 0, 0,
+  1578, 0, 0, 206, 0, 1811, 96, 1189, 0, 0, 0, 0, 0, 0, 1275, 0,
+  0, 0, 36, 235, 0, 1469, 596, 1619, 0, 0, 0, 1084, 0, 0, 0, 0,
+  0, 2189, 1198, 0, 0, 0, 0, 0, 0, 0, 0, 0, 244, 1250, 2104, 0,
+  0, 0, 0, 0, 483, 885, 923, 0, 0, 0, 0, 0, 0, 1234, 0, 0,
+  380, 1089, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1491, 0,
+  267, 1688, 1882, 0, 0, 0, 0, 0, 0, 0, 1374, 1598, 0, 0, 0, 0,
+  0, 1525, 297, 0, 1651, 0, 0, 0, 1744, 1958, 1152, 1165, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 1386, 0, 579, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 1751, 0, 1018, 0, 0, 2182, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2291, 0, 0, 0, 0, 0,
+  0, 0, 2278, 0, 0, 270, 0, 0, 877, 219, 1211, 0, 0, 569, 0, 0,
+  0, 0, 0, 0, 62, 0, 2108, 0, 0, 1466, 136, 0, 0, 2187, 0, 1043,
+  948, 0, 0, 0, 0, 0, 441, 454, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 451, 0, 0, 0, 0, 0, 0, 0, 1574, 0, 0, 0, 1300, 0, 1742,
+  0, 1504, 1909, 0, 0, 595, 0, 0, 784, 0, 0, 0, 0, 215, 653, 1028,
+  0, 1893, 0, 778, 0, 625, 2131, 0, 0, 0, 0, 0, 0, 0, 1195, 0,
+  0, 0, 0, 980, 0, 0, 0, 317, 884, 2054, 0, 0, 1053, 0, 468, 1489,
+  2192, 0, 0, 0, 0, 0, 0, 760, 1116, 651, 194, 947, 1501, 0, 1663, 0,
+  712, 0, 0, 0, 0, 2055, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1354, 0, 0, 0, 0, 0, 2445, 0, 0, 351, 0, 0, 0, 122, 954, 0,
+  1479, 872, 1807, 1092, 969, 1191, 1730, 975, 1232, 1560, 1987, 2090, 2213, 180, 491, 0,
+  0, 0, 0, 1434, 0, 1675, 1159, 0, 0, 0, 0, 0, 0, 687, 0, 0,
+  0, 0, 0, 0, 382, 1274, 1577, 1606, 0, 1645, 0, 0, 0, 0, 0, 0,
+  0, 0, 318, 0, 0, 740, 1322, 0, 0, 0, 0, 0, 0, 0, 1285, 1596,
+  0, 1293, 2176, 0, 2420, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 1318, 1472, 0, 0, 0, 2060, 0, 0, 0, 0, 2130, 630, 0, 0, 0,
+  0, 0, 0, 0, 0, 1111, 0, 362, 1569, 1698, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 1852, 0, 397, 0, 0, 0, 374, 0, 0,
+  0, 2355, 0, 0, 0, 0, 0, 157, 0, 0, 0, 0, 0, 1804, 0, 0,
+  0, 0, 0, 1288, 0, 0, 0, 0, 0, 693, 1962, 0, 0, 683, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 1170, 0, 0, 0, 0, 0, 0, 0, 0,
+  941, 1122, 0, 138, 0, 0, 529, 1212, 0, 0, 0, 0, 0, 0, 0, 412,
+  2061, 0, 0, 0, 0, 1638, 0, 897, 849, 880, 1215, 1259, 0, 0, 0, 0,
+  796, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1148, 0,
+  0, 1183, 1725, 0, 141, 0, 1897, 0, 0, 2342, 0, 0, 0, 0, 0, 0,
+  798, 1080, 0, 953, 0, 641, 0, 0, 0, 439, 0, 0, 0, 328, 1398, 0,
+  0, 2030, 0, 0, 0, 0, 133, 1846, 2134, 0, 0, 1665, 1838, 1918, 0, 0,
+  0, 769, 0, 0, 0, 0, 1483, 0, 0, 506, 0, 0, 623, 959, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1070, 1870, 0,
+  758, 1131, 1576, 1747, 2218, 0, 563, 964, 1357, 1755, 0, 0, 1946, 2231, 0, 0,
+  0, 0, 0, 0, 0, 1995, 0, 0, 0, 0, 0, 0, 1163, 0, 0, 0,
+  0, 0, 1264, 0, 0, 0, 0, 320, 988, 0, 0, 0, 0, 0, 977, 0,
+  577, 0, 0, 2436, 0, 0, 0, 0, 0, 0, 619, 0, 0, 0, 0, 0,
+  296, 2156, 0, 0, 0, 0, 0, 0, 0, 268, 0, 0, 2049, 0, 0, 0,
+  0, 0, 0, 0, 395, 0, 0, 1658, 0, 0, 584, 1866, 0, 1709, 0, 1950,
+  0, 0, 0, 0, 0, 0, 0, 0, 1103, 0, 1672, 0, 0, 1737, 78, 0,
+  9, 2440, 1185, 0, 415, 0, 887, 0, 0, 0, 0, 0, 0, 1975, 0, 1301,
+  753, 1720, 0, 0, 0, 2124, 0, 537, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 2310, 0, 0, 0, 0, 0, 0, 0, 2063, 0, 0, 0, 1238,
+  0, 0, 0, 2336, 0, 0, 0, 0, 0, 0, 707, 2268, 0, 0, 0, 1644,
+  0, 2328, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1673, 0, 1462,
+  1980, 0, 0, 0, 0, 0, 0, 0, 0, 1255, 0, 0, 0, 0, 0, 0,
+  1670, 0, 0, 0, 2174, 0, 0, 0, 2367, 0, 0, 0, 0, 2252, 0, 222,
+  0, 0, 0, 1662, 0, 0, 0, 2236, 1186, 0, 0, 756, 2201, 0, 0, 0,
+  0, 0, 0, 0, 1310, 490, 0, 0, 221, 0, 0, 0, 0, 1034, 484, 1210,
+  600, 2092, 1912, 1533, 1704, 0, 0, 0, 0, 0, 0, 1585, 0, 2327, 602, 2274,
+  0, 0, 0, 0, 0, 0, 730, 0, 0, 0, 8, 2198, 0, 0, 0, 0,
+  0, 1332, 0, 0, 498, 0, 0, 0, 0, 776, 0, 0, 0, 0, 0, 511,
+  0, 2454, 0, 213, 248, 2232, 0, 0, 932, 2458, 1281, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 2421, 0, 0, 0, 0, 0, 70, 1572, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 154, 1844, 0,
+  0, 0, 0, 1075, 0, 0, 0, 271, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 1203, 1990, 229, 612, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2330, 0, 405, 0, 0, 0, 0, 246, 0, 0, 0, 658, 0, 0, 521, 0,
+  0, 0, 0, 1415, 294, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1647,
+  1584, 0, 0, 0, 1141, 2008, 2025, 0, 0, 0, 0, 0, 0, 591, 0, 0,
+  822, 1196, 0, 1217, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 943, 0, 0, 0, 0, 1446, 0, 0, 0, 0, 0, 0, 0, 6, 104,
+  434, 0, 2121, 0, 0, 0, 2016, 0, 1492, 2230, 0, 0, 0, 0, 0, 763,
+  0, 2011, 0, 0, 0, 0, 0, 0, 0, 2302, 0, 0, 0, 0, 1601, 1421,
+  1925, 0, 0, 0, 0, 0, 621, 0, 0, 0, 818, 0, 0, 152, 0, 0,
+  0, 0, 0, 939, 0, 0, 0, 0, 370, 0, 0, 1389, 0, 456, 1055, 1067,
+  0, 338, 1713, 1432, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 582,
+  0, 0, 0, 0, 0, 1935, 2146, 0, 0, 1467, 0, 0, 672, 0, 0, 0,
+  0, 0, 0, 1799, 0, 0, 1636, 1864, 0, 0, 0, 0, 0, 2081, 411, 1904,
+  0, 0, 0, 1194, 0, 0, 0, 0, 0, 0, 0, 0, 1110, 0, 0, 1218,
+  0, 0, 0, 1137, 0, 0, 0, 1876, 0, 0, 0, 0, 0, 0, 0, 2289,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1182, 1020, 1947, 1430, 0, 0, 1202,
+  930, 0, 1506, 2240, 0, 748, 0, 0, 0, 0, 2248, 22, 842, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1408, 0, 1610, 0, 1756,
+  846, 379, 0, 0, 0, 0, 288, 0, 0, 0, 0, 0, 0, 0, 708, 780,
+  802, 1299, 1629, 870, 0, 0, 1777, 2462, 0, 1739, 0, 0, 0, 2125, 0, 766,
+  2088, 0, 2435, 966, 971, 0, 0, 637, 400, 0, 0, 1988, 2013, 1169, 0, 0,
+  0, 0, 0, 0, 2229, 52, 2034, 2183, 0, 0, 0, 1062, 1612, 2115, 492, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 72, 0, 0, 1201, 0,
+  2266, 2373, 703, 0, 684, 0, 7, 2024, 0, 0, 1825, 0, 0, 0, 0, 0,
+  2225, 0, 0, 0, 597, 2035, 0, 0, 0, 0, 337, 50, 0, 0, 0, 1654,
+  601, 676, 272, 1229, 1296, 1403, 384, 1457, 1813, 2014, 2353, 0, 2270, 0, 0, 1370,
+  1567, 0, 0, 398, 0, 0, 0, 1294, 1915, 2315, 0, 407, 0, 0, 0, 0,
+  0, 172, 0, 2069, 0, 0, 2354, 71, 0, 661, 0, 83, 0, 557, 968, 0,
+  0, 0, 0, 0, 0, 0, 0, 1878, 0, 0, 0, 1119, 0, 0, 0, 0,
+  0, 0, 0, 1690, 530, 1969, 0, 578, 302, 1587, 1905, 2461, 1052, 0, 0, 0,
+  57, 0, 1445, 0, 1416, 0, 0, 0, 0, 0, 1500, 0, 0, 2297, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1143, 0, 0, 0, 907, 2324, 0, 0, 1953, 39, 226, 376, 755, 808, 917, 1831,
+  2043, 0, 2239, 0, 0, 0, 0, 2158, 0, 0, 0, 0, 0, 0, 300, 0,
+  0, 0, 0, 0, 1363, 1166, 0, 1287, 0, 0, 0, 0, 0, 0, 0, 800,
+  1228, 0, 1837, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1209, 323, 940, 0,
+  673, 0, 0, 0, 0, 663, 0, 0, 0, 55, 532, 0, 1686, 249, 0, 0,
+  0, 0, 726, 0, 0, 1464, 1262, 1810, 2159, 1225, 0, 803, 0, 2298, 2437, 0,
+  0, 0, 0, 0, 0, 0, 0, 242, 0, 0, 0, 1158, 0, 0, 0, 0,
+  1366, 0, 0, 0, 0, 2280, 873, 1802, 2418, 1443, 1829, 0, 1364, 1136, 2180, 0,
+  0, 0, 0, 2464, 0, 0, 0, 1743, 0, 131, 0, 0, 251, 0, 0, 0,
+  1369, 0, 0, 58, 0, 0, 0, 0, 533, 0, 0, 0, 0, 2038, 0, 344,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1266, 0, 0, 0, 1938, 0, 0,
+  0, 0, 170, 388, 0, 0, 0, 0, 0, 0, 0, 1965, 3, 2117, 1325, 876,
+  2126, 1269, 2127, 0, 2243, 0, 0, 2097, 0, 0, 0, 1687, 0, 0, 0, 0,
+  1263, 0, 2472, 0, 0, 0, 2042, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1544, 0, 0, 811, 0, 325, 1242, 904, 1205, 2323, 97, 2360, 0, 0,
+  0, 0, 0, 0, 0, 0, 1056, 0, 0, 0, 0, 0, 205, 239, 1971, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 782, 787, 0, 0, 0, 0,
+  0, 0, 0, 0, 570, 525, 1381, 2450, 0, 42, 516, 241, 1565, 1656, 0, 0,
+  0, 0, 1410, 0, 0, 0, 0, 2050, 0, 0, 187, 1253, 1518, 1910, 1557, 0,
+  1282, 1426, 2389, 33, 0, 0, 0, 0, 0, 0, 0, 0, 834, 1001, 0, 0,
+  0, 0, 0, 0, 691, 0, 0, 2039, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 2171, 0, 0, 0, 0, 0, 0, 0, 2012, 1276, 0, 1125, 1248, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 634, 0, 0, 0,
+  255, 130, 1843, 0, 0, 0, 0, 0, 0, 0, 1808, 2139, 0, 0, 243, 1474,
+  339, 0, 0, 2293, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 1632, 821, 0, 0, 273, 485, 701, 1036,
+  725, 0, 0, 0, 0, 0, 0, 0, 998, 0, 0, 0, 0, 1801, 2377, 0,
+  0, 2058, 0, 0, 481, 1685, 0, 0, 0, 0, 688, 0, 303, 0, 0, 0,
+  0, 0, 0, 0, 0, 645, 0, 0, 1924, 0, 677, 662, 0, 1216, 0, 0,
+  832, 0, 0, 0, 0, 0, 0, 551, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 710, 0, 1107, 0, 1135, 2074,
+  0, 1680, 1461, 0, 0, 0, 321, 2226, 0, 0, 2001, 0, 0, 0, 1108, 2325,
+  0, 1563, 675, 1245, 2020, 1022, 0, 419, 0, 0, 0, 0, 0, 527, 1144, 0,
+  0, 0, 0, 546, 0, 0, 0, 0, 0, 2480, 0, 1184, 1826, 0, 0, 0,
+  1684, 0, 0, 0, 0, 0, 1782, 0, 647, 1047, 0, 0, 0, 2195, 0, 276,
+  0, 0, 0, 0, 0, 0, 0, 1993, 0, 0, 0, 0, 841, 2205, 0, 0,
+  0, 575, 0, 0, 1790, 2304, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1865, 0, 1348, 0, 0, 0, 455, 0, 0, 0, 38, 422,
+  1819, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 0,
+  0, 0, 1816, 1721, 0, 0, 0, 0, 0, 1507, 0, 0, 0, 0, 624, 1011,
+  0, 101, 196, 714, 2197, 951, 2309, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  446, 0, 0, 795, 0, 0, 2394, 238, 304, 531, 1093, 0, 0, 0, 0, 186,
+  1037, 0, 0, 0, 0, 552, 0, 0, 1019, 0, 1088, 0, 0, 386, 1727, 1633,
+  0, 0, 0, 861, 28, 54, 656, 0, 0, 1074, 2365, 0, 0, 0, 0, 1917,
+  2423, 0, 0, 0, 0, 0, 0, 1324, 0, 0, 2282, 0, 1297, 0, 129, 0,
+  1283, 2147, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1886, 1246, 664, 576, 0,
+  0, 0, 0, 0, 1841, 0, 0, 1650, 0, 0, 2422, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 156, 336, 538, 0, 0, 1689, 0, 0, 0, 0, 0, 0,
+  0, 0, 2075, 0, 0, 0, 0, 0, 480, 626, 0, 0, 0, 1352, 0, 0,
+  0, 0, 0, 505, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 814,
+  0, 0, 1087, 0, 1427, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1880, 1455, 1943, 0, 609, 0, 669, 0, 0, 0, 438, 0, 507, 1968,
+  0, 43, 0, 0, 0, 0, 0, 1313, 153, 0, 0, 0, 0, 0, 145, 2332,
+  0, 0, 250, 598, 0, 0, 0, 1328, 0, 2154, 0, 0, 0, 0, 2040, 0,
+  0, 0, 0, 0, 289, 1237, 660, 1102, 0, 0, 1342, 0, 0, 1470, 0, 0,
+  732, 0, 0, 0, 0, 0, 1750, 1305, 0, 0, 0, 1714, 0, 0, 0, 406,
+  0, 1006, 1989, 2250, 0, 1130, 0, 0, 0, 1649, 2307, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 1724, 1812, 260, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1620, 0, 0, 665, 888, 0, 0,
+  0, 0, 0, 0, 0, 2150, 0, 1840, 0, 355, 1547, 0, 0, 0, 638, 0,
+  0, 0, 2402, 1735, 2186, 1754, 2167, 2415, 2157, 2347, 0, 462, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 361, 1641, 0, 2451, 305, 1105, 0, 0, 0,
+  0, 0, 848, 0, 912, 0, 914, 2453, 32, 0, 1668, 0, 0, 0, 2129, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 720, 2200, 0, 0, 1224,
+  1717, 0, 0, 0, 0, 0, 0, 0, 0, 646, 2227, 2343, 0, 0, 0, 0,
+  0, 0, 0, 1703, 750, 0, 2344, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 486, 1038, 0,
+  0, 0, 0, 0, 1691, 0, 0, 1552, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 1536, 1981, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 5, 410, 0, 0, 0, 0, 702, 2256, 20, 694, 2385, 0, 0, 678,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 961, 0, 0, 1050, 0, 0,
+  0, 745, 0, 536, 0, 0, 0, 353, 0, 0, 586, 721, 0, 0, 0, 0,
+  90, 1064, 0, 1419, 0, 0, 0, 0, 592, 0, 2210, 0, 0, 0, 610, 631,
+  2381, 0, 0, 124, 0, 0, 0, 357, 535, 547, 0, 2152, 0, 0, 0, 0,
+  0, 0, 0, 644, 0, 0, 2234, 1660, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1827, 0, 0, 0, 0, 0, 0, 0, 0, 851, 0, 0, 0, 0,
+  929, 1129, 1806, 1991, 0, 0, 287, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 1503, 0, 0, 0, 0, 0, 0, 0, 0, 856, 0, 0, 0,
+  0, 290, 343, 0, 0, 0, 0, 0, 0, 0, 2087, 0, 0, 0, 0, 85,
+  0, 0, 0, 0, 0, 1156, 0, 0, 0, 0, 2211, 0, 0, 0, 0, 0,
+  0, 836, 0, 1149, 819, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 1476, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 335, 0, 0, 143,
+  0, 0, 0, 1793, 1026, 0, 0, 0, 1900, 75, 649, 0, 0, 0, 0, 0,
+  0, 1341, 1842, 0, 35, 0, 0, 0, 0, 0, 0, 1970, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 813, 0, 0, 0, 0, 0, 0, 0, 0, 1344,
+  0, 324, 0, 1347, 1966, 2244, 0, 0, 0, 0, 0, 1458, 0, 2387, 0, 128,
+  0, 1181, 366, 0, 1154, 806, 901, 0, 1197, 706, 2032, 0, 0, 0, 0, 1554,
+  0, 0, 0, 0, 1289, 0, 0, 0, 0, 0, 0, 0, 588, 1524, 0, 0,
+  0, 0, 1145, 0, 0, 0, 2398, 0, 0, 1252, 715, 254, 561, 1892, 1920, 2103,
+  0, 0, 0, 518, 0, 0, 0, 2122, 0, 852, 0, 2033, 0, 1278, 1851, 0,
+  0, 1814, 0, 0, 340, 0, 0, 0, 0, 0, 0, 970, 2066, 0, 0, 0,
+  0, 0, 312, 0, 0, 0, 102, 2178, 0, 1701, 0, 0, 0, 2249, 0, 0,
+  0, 417, 0, 119, 0, 1314, 1723, 418, 522, 0, 0, 0, 0, 110, 0, 0,
+  0, 0, 1488, 0, 0, 0, 0, 913, 1530, 0, 0, 1823, 137, 218, 0, 2041,
+  1382, 0, 0, 0, 0, 590, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21,
+  1911, 0, 0, 0, 0, 0, 0, 0, 1319, 0, 0, 0, 0, 227, 0, 0,
+  0, 0, 1397, 1722, 0, 0, 0, 0, 1407, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 1429, 0, 0, 0, 0, 0, 0, 1839, 1908, 0, 0, 0, 696,
+  0, 0, 40, 611, 0, 0, 1929, 955, 1000, 1387, 1440, 1634, 1896, 1707, 393, 0,
+  0, 0, 155, 2003, 0, 0, 0, 0, 0, 0, 0, 0, 0, 404, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1667, 0, 0, 0, 0, 1773,
+  0, 545, 0, 0, 911, 1227, 1041, 0, 0, 0, 0, 166, 0, 0, 0, 1315,
+  175, 724, 2019, 1109, 0, 0, 0, 0, 1997, 0, 0, 0, 568, 1286, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 1399, 2143, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 15, 0, 0, 0, 0, 1058, 0, 671, 0, 0, 1571, 0, 0,
+  1683, 835, 173, 983, 1549, 1830, 1346, 0, 1436, 0, 0, 0, 0, 391, 200, 0,
+  0, 0, 0, 0, 2006, 0, 0, 711, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 461, 0, 0, 1531, 0, 921, 0, 0, 571, 1960, 1057, 0, 1338, 1575, 0,
+  0, 0, 0, 479, 0, 0, 0, 946, 0, 0, 2073, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 963, 0, 0, 0, 0, 0, 2301, 0, 989,
+  0, 0, 0, 0, 0, 1307, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 1734, 2468, 2294, 0, 0, 0, 0, 0, 2175, 1888, 0, 0, 2277, 0, 972,
+  2308, 0, 1388, 0, 0, 87, 1835, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 375, 0, 0, 0, 900, 2438, 0, 0, 0, 0, 0, 865, 0, 1199, 2208,
+  0, 0, 45, 0, 185, 0, 764, 0, 0, 46, 1999, 0, 0, 0, 1763, 2401,
+  0, 0, 0, 794, 433, 2269, 2314, 17, 0, 0, 0, 0, 0, 0, 0, 0,
+  2359, 0, 0, 0, 0, 0, 163, 0, 0, 0, 1306, 1529, 1558, 1117, 1753, 1002,
+  2188, 0, 471, 2204, 0, 0, 0, 1854, 0, 0, 0, 1949, 293, 0, 0, 0,
+  1413, 0, 850, 924, 0, 0, 0, 0, 0, 0, 2357, 0, 430, 0, 183, 0,
+  0, 1631, 2405, 0, 0, 616, 0, 0, 0, 1316, 0, 0, 0, 0, 0, 0,
+  0, 0, 2031, 132, 0, 0, 431, 0, 0, 2046, 0, 2083, 0, 1420, 1635, 0,
+  0, 0, 0, 2023, 1982, 0, 0, 0, 0, 2141, 689, 0, 0, 0, 0, 0,
+  0, 1213, 0, 0, 2168, 0, 0, 0, 0, 0, 0, 80, 281, 2093, 668, 1664,
+  0, 1335, 0, 0, 2068, 0, 0, 1302, 0, 0, 0, 654, 0, 0, 0, 0,
+  0, 0, 1120, 0, 349, 1090, 2348, 599, 0, 0, 0, 0, 0, 593, 0, 0,
+  0, 0, 0, 0, 0, 729, 0, 0, 0, 0, 482, 0, 1945, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 354, 0, 0, 316, 1901, 0, 0, 0, 0, 1114,
+  1821, 0, 0, 359, 0, 0, 0, 496, 0, 2433, 0, 0, 1353, 0, 0, 0,
+  0, 0, 1478, 0, 0, 1180, 2340, 0, 0, 0, 0, 1818, 0, 0, 0, 868,
+  0, 0, 2400, 0, 0, 0, 0, 0, 0, 0, 0, 1362, 0, 0, 0, 0,
+  1551, 0, 0, 0, 0, 0, 0, 0, 2267, 0, 0, 0, 0, 0, 0, 0,
+  0, 1700, 1860, 0, 1566, 2331, 0, 0, 0, 1343, 2116, 1378, 0, 0, 0, 0,
+  0, 0, 0, 0, 2209, 2118, 0, 0, 0, 0, 0, 0, 0, 0, 1060, 0,
+  0, 0, 0, 0, 2257, 0, 1502, 169, 1284, 0, 0, 0, 1104, 2044, 0, 0,
+  0, 0, 2341, 0, 0, 0, 0, 0, 0, 0, 0, 189, 0, 0, 0, 0,
+  0, 0, 309, 0, 1423, 1240, 908, 2246, 0, 0, 585, 0, 0, 682, 0, 0,
+  0, 0, 1073, 629, 2095, 680, 0, 212, 0, 2417, 1405, 0, 0, 0, 0, 0,
+  0, 0, 0, 356, 0, 0, 2382, 0, 0, 0, 1327, 1484, 424, 0, 0, 2425,
+  0, 0, 0, 0, 0, 1173, 331, 0, 2364, 2392, 0, 0, 1674, 0, 0, 0,
+  0, 567, 0, 0, 0, 307, 385, 1583, 0, 1614, 0, 0, 1505, 2395, 0, 0,
+  217, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 788, 0, 0,
+  0, 416, 2018, 0, 2388, 0, 0, 0, 1528, 2391, 0, 0, 423, 1243, 2153, 0,
+  0, 0, 0, 2219, 2135, 2463, 0, 0, 0, 0, 0, 2319, 1204, 560, 2473, 0,
+  0, 0, 0, 91, 1513, 779, 0, 0, 0, 0, 1039, 245, 0, 0, 0, 0,
+  0, 10, 0, 2478, 0, 0, 0, 0, 37, 0, 0, 790, 2475, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 797, 363, 952, 812, 2322, 0, 0, 2212, 1,
+  0, 0, 135, 0, 0, 2273, 0, 0, 0, 0, 0, 824, 0, 453, 0, 426,
+  0, 1485, 0, 0, 0, 30, 1661, 0, 0, 0, 893, 2261, 0, 201, 348, 1617,
+  277, 0, 0, 0, 0, 1532, 0, 909, 2333, 0, 0, 0, 0, 0, 0, 650,
+  2123, 0, 0, 0, 0, 0, 0, 387, 0, 1442, 2111, 984, 0, 1626, 0, 999,
+  0, 1235, 0, 1076, 334, 0, 2318, 0, 0, 0, 0, 0, 1095, 0, 1482, 0,
+  0, 1454, 0, 0, 1460, 1652, 0, 0, 0, 0, 0, 0, 0, 487, 0, 0,
+  0, 587, 1236, 1308, 0, 0, 636, 2070, 2303, 0, 0, 0, 0, 0, 0, 224,
+  1526, 0, 195, 0, 0, 0, 0, 0, 2338, 0, 1903, 0, 0, 0, 0, 0,
+  0, 0, 0, 2223, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 121, 459, 263, 508, 0, 0, 0, 0, 0, 0, 0, 667, 1260, 0, 0,
+  0, 0, 986, 0, 0, 0, 0, 0, 1226, 429, 1417, 2271, 0, 0, 0, 1190,
+  0, 0, 1515, 875, 1931, 0, 0, 1545, 0, 0, 0, 0, 0, 1796, 0, 0,
+  0, 0, 985, 0, 0, 840, 0, 2449, 0, 1188, 1008, 2151, 2431, 0, 0, 890,
+  0, 0, 0, 0, 0, 0, 1581, 0, 0, 0, 0, 1718, 0, 0, 1083, 0,
+  0, 0, 0, 0, 84, 2021, 182, 0, 768, 0, 0, 73, 159, 2102, 0, 0,
+  0, 0, 0, 178, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1376, 0, 0, 1889, 0, 0, 2393, 0, 2329, 0, 0, 1930, 0, 0, 0, 0,
+  0, 0, 1168, 1913, 0, 938, 820, 1161, 1705, 2419, 0, 0, 0, 266, 0, 1365,
+  0, 751, 0, 0, 0, 1349, 2397, 2430, 0, 0, 0, 0, 0, 958, 0, 0,
+  0, 0, 0, 1795, 0, 0, 0, 0, 513, 1589, 1765, 2238, 0, 1914, 863, 0,
+  0, 1371, 0, 0, 0, 0, 765, 146, 0, 0, 0, 775, 34, 1146, 0, 1857,
+  0, 881, 0, 674, 0, 0, 0, 0, 0, 79, 898, 2448, 0, 0, 1133, 0,
+  0, 0, 0, 282, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 648, 0, 0, 0, 0, 458, 0, 0, 0, 0, 0, 734, 0, 0,
+  0, 1729, 0, 2384, 0, 783, 0, 0, 0, 0, 0, 0, 0, 0, 2132, 0,
+  2345, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 60, 0, 0, 0,
+  1134, 0, 1787, 0, 0, 0, 0, 0, 1555, 2, 231, 0, 0, 0, 0, 0,
+  0, 2285, 0, 0, 2265, 0, 0, 0, 0, 0, 360, 815, 915, 1862, 0, 0,
+  1611, 1771, 0, 1759, 0, 0, 0, 0, 1628, 1637, 0, 0, 0, 0, 0, 0,
+};
+
+static const wa_bigram_entry WA_BIGRAM_DICT_ENTRIES[] = {
+  { 0x30A2000030F3ull, 0u, 1u },
+  { 0x30EA000030A2ull, 1u, 1u },
+  { 0x5F150000304Dull, 2u, 1u },
+  { 0x53D60000308Aull, 3u, 1u },
+  { 0x30A2000030FCull, 4u, 1u },
+  { 0x630100003061ull, 5u, 1u },
+  { 0x4E0A00003052ull, 6u, 1u },
+  { 0x30A4000030A2ull, 7u, 1u },
+  { 0x30A2000030A4ull, 8u, 1u },
+  { 0x30420000308Aull, 9u, 1u },
+  { 0x3051000030A2ull, 10u, 1u },
+  { 0x751F0000304Dull, 11u, 1u },
+  { 0x90230000308Cull, 12u, 1u },
+  { 0x53D700003051ull, 13u, 1u },
+  { 0x307E0000308Aull, 14u, 1u },
+  { 0x30A2000030ECull, 15u, 1u },
+  { 0x6BBA00003057ull, 16u, 1u },
+  { 0x30A2000030EAull, 17u, 1u },
+  { 0x308A0000304Cull, 18u, 1u },
+  { 0x304200003093ull, 19u, 1u },
+  { 0x697D00003057ull, 20u, 1u },
+  { 0x959300009055ull, 21u, 1u },
+  { 0x521D00003081ull, 22u, 1u },
+  { 0x624B00004F1Dull, 23u, 1u },
+  { 0x4ED800003051ull, 24u, 1u },
+  { 0x30420000305Full, 25u, 1u },
+  { 0x4ED80000304Dull, 26u, 1u },
+  { 0x8A7100003057ull, 27u, 1u },
+  { 0x5F530000305Full, 28u, 1u },
+  { 0x30E9000030A4ull, 29u, 1u },
+  { 0x51650000308Aull, 30u, 1u },
+  { 0x30A4000030EAull, 31u, 1u },
+  { 0x30C7000030A3ull, 32u, 1u },
+  { 0x30B8000030E5ull, 33u, 1u },
+  { 0x305F0000308Aull, 34u, 1u },
+  { 0x7ACB00003061ull, 35u, 1u },
+  { 0x304200003042ull, 36u, 1u },
+  { 0x4EBA000077E5ull, 37u, 1u },
+  { 0x5F5300006642ull, 38u, 1u },
+  { 0x304C00003068ull, 39u, 1u },
+  { 0x51FA00006765ull, 40u, 1u },
+  { 0x5165000096FBull, 41u, 1u },
+  { 0x540C00003058ull, 42u, 1u },
+  { 0x51650000308Cull, 43u, 1u },
+  { 0x6B6200003081ull, 44u, 1u },
+  { 0x8D7700003053ull, 45u, 1u },
+  { 0x98DF00003079ull, 46u, 1u },
+  { 0x4EBA00004E0Bull, 47u, 1u },
+  { 0x4F1D00003048ull, 48u, 1u },
+  { 0x54110000304Bull, 49u, 1u },
+  { 0x30420000308Bull, 50u, 1u },
+  { 0x30EA000030ABull, 51u, 1u },
+  { 0x4F5300005927ull, 52u, 1u },
+  { 0x843D00003061ull, 53u, 1u },
+  { 0x306100007740ull, 54u, 1u },
+  { 0x304200003063ull, 55u, 1u },
+  { 0x59270000304Dull, 56u, 1u },
+  { 0x4E0A0000624Bull, 57u, 1u },
+  { 0x308A00008FD1ull, 58u, 1u },
+  { 0x30930000306Aull, 59u, 1u },
+  { 0x59CB0000307Eull, 60u, 1u },
+  { 0x304200003089ull, 61u, 1u },
+  { 0x306E00005B50ull, 62u, 1u },
+  { 0x308C00008B66ull, 63u, 1u },
+  { 0x305700003066ull, 64u, 1u },
+  { 0x99AC00009E7Full, 65u, 1u },
+  { 0x964D0000308Aull, 66u, 1u },
+  { 0x308A00005927ull, 67u, 1u },
+  { 0x8FD100003065ull, 68u, 1u },
+  { 0x5C0F00003055ull, 69u, 1u },
+  { 0x774000003051ull, 70u, 1u },
+  { 0x712100003057ull, 71u, 1u },
+  { 0x4EBA0000671Full, 72u, 1u },
+  { 0x65E500004ED8ull, 73u, 1u },
+  { 0x30C3000030AFull, 74u, 1u },
+  { 0x4EE30000308Full, 75u, 1u },
+  { 0x4E0A0000304Cull, 76u, 1u },
+  { 0x6C7A0000307Eull, 77u, 1u },
+  { 0x884C0000304Dull, 78u, 1u },
+  { 0x304D00005408ull, 79u, 1u },
+  { 0x51FA00004F1Aull, 80u, 1u },
+  { 0x77E50000308Aull, 81u, 1u },
+  { 0x308A00005408ull, 82u, 1u },
+  { 0x540800003044ull, 83u, 1u },
+  { 0x8A9E000030A2ull, 84u, 1u },
+  { 0x304B0000308Aull, 85u, 1u },
+  { 0x898B00005F35ull, 86u, 1u },
+  { 0x652F00006255ull, 87u, 1u },
+  { 0x77E500003089ull, 88u, 1u },
+  { 0x306600004E0Aull, 89u, 1u },
+  { 0x8868000073FEull, 90u, 1u },
+  { 0x30A2000030C3ull, 91u, 1u },
+  { 0x30CB000030A2ull, 92u, 1u },
+  { 0x30EA000030FCull, 93u, 1u },
+  { 0x30EA000030B9ull, 94u, 1u },
+  { 0x30E5000030EAull, 95u, 1u },
+  { 0x30DE000030F3ull, 96u, 1u },
+  { 0x4E1600004EE3ull, 97u, 1u },
+  { 0x51FA000058F2ull, 98u, 1u },
+  { 0x30A4000030B9ull, 99u, 1u },
+  { 0x624000006301ull, 100u, 1u },
+  { 0x5F1500003063ull, 101u, 1u },
+  { 0x4E0B0000308Dull, 102u, 1u },
+  { 0x4EBA00009032ull, 103u, 1u },
+  { 0x30DE000030EAull, 104u, 1u },
+  { 0x4E570000308Aull, 105u, 1u },
+  { 0x7D9A0000304Dull, 106u, 1u },
+  { 0x308A00005F15ull, 107u, 1u },
+  { 0x71210000304Full, 108u, 1u },
+  { 0x52D50000624Bull, 109u, 1u },
+  { 0x30A2000030EBull, 110u, 1u },
+  { 0x30D0000030A4ull, 111u, 1u },
+  { 0x30A2000030D5ull, 112u, 1u },
+  { 0x308A0000610Full, 113u, 1u },
+  { 0x90010000308Aull, 114u, 1u },
+  { 0x30C3000030C8ull, 115u, 1u },
+  { 0x300100003002ull, 116u, 1u },
+  { 0x300200004F55ull, 117u, 1u },
+  { 0x4F5500003042ull, 118u, 1u },
+  { 0x30420000306Aull, 119u, 1u },
+  { 0x306A0000305Full, 120u, 1u },
+  { 0x305F00008A00ull, 121u, 1u },
+  { 0x8A000000884Cull, 122u, 1u },
+  { 0x884C00004EBAull, 123u, 1u },
+  { 0x77E50000FF09ull, 124u, 1u },
+  { 0xFF090000FF08ull, 125u, 1u },
+  { 0xFF0800004E8Bull, 126u, 1u },
+  { 0x4E8B00005F7Cull, 127u, 1u },
+  { 0x5F7C00005973ull, 128u, 1u },
+  { 0x59730000304Aull, 129u, 1u },
+  { 0x304A0000524Dull, 130u, 1u },
+  { 0x524D00008A71ull, 131u, 1u },
+  { 0x8A7100006765ull, 132u, 1u },
+  { 0x676500005206ull, 133u, 1u },
+  { 0x52060000304Bull, 134u, 1u },
+  { 0x304B00008005ull, 135u, 1u },
+  { 0x80050000805Eull, 136u, 1u },
+  { 0x805E00006B7Bull, 137u, 1u },
+  { 0x6B7B00006642ull, 138u, 1u },
+  { 0x664200003042ull, 139u, 1u },
+  { 0x304200006BBAull, 140u, 1u },
+  { 0x6BBA0000524Dull, 141u, 1u },
+  { 0x524D00004E2Dull, 142u, 1u },
+  { 0x4E2D00009054ull, 143u, 1u },
+  { 0x905400005FC5ull, 144u, 1u },
+  { 0x5FC500008981ull, 145u, 1u },
+  { 0x898100003042ull, 146u, 1u },
+  { 0x30420000306Eull, 147u, 1u },
+  { 0x306E00006C17ull, 148u, 1u },
+  { 0x6C1700005927ull, 149u, 1u },
+  { 0x592700004E08ull, 150u, 1u },
+  { 0x4E080000592Bull, 151u, 1u },
+  { 0x592B0000300Dull, 152u, 1u },
+  { 0x300D0000300Cull, 153u, 1u },
+  { 0x300C000081EAull, 154u, 1u },
+  { 0x81EA00005206ull, 155u, 1u },
+  { 0x520600006301ull, 156u, 1u },
+  { 0x63010000672Cull, 157u, 1u },
+  { 0x672C00005F53ull, 158u, 1u },
+  { 0x664200009593ull, 159u, 1u },
+  { 0x959300006211ull, 160u, 1u },
+  { 0x621100003005ull, 161u, 1u },
+  { 0x300500004E00ull, 162u, 1u },
+  { 0x4E0000007684ull, 163u, 1u },
+  { 0x768400007121ull, 164u, 1u },
+  { 0x712100003042ull, 165u, 1u },
+  { 0x306800003046ull, 166u, 1u },
+  { 0x304600005BB6ull, 167u, 1u },
+  { 0x5BB600004F1Aull, 168u, 1u },
+  { 0x4F1A000065E5ull, 169u, 1u },
+  { 0x65E500005E74ull, 170u, 1u },
+  { 0x5E7400004ED5ull, 171u, 1u },
+  { 0x4ED500004E8Bull, 172u, 1u },
+  { 0x4E8B0000624Bull, 173u, 1u },
+  { 0x624B00004E00ull, 174u, 1u },
+  { 0x4E0000007DD2ull, 175u, 1u },
+  { 0x7DD200005F8Cull, 176u, 1u },
+  { 0x5F8C000051FAull, 177u, 1u },
+  { 0x676500004ED6ull, 178u, 1u },
+  { 0x4ED600005165ull, 179u, 1u },
+  { 0x96FB00008A71ull, 180u, 1u },
+  { 0x8A71000076EEull, 181u, 1u },
+  { 0x76EE000069D8ull, 182u, 1u },
+  { 0x69D800005206ull, 183u, 1u },
+  { 0x520600008ECAull, 184u, 1u },
+  { 0x8ECA00006240ull, 185u, 1u },
+  { 0x624000003042ull, 186u, 1u },
+  { 0x30930000305Full, 187u, 1u },
+  { 0x305F00005EA6ull, 188u, 1u },
+  { 0x5EA60000540Cull, 189u, 1u },
+  { 0x305800005834ull, 190u, 1u },
+  { 0x583400006240ull, 191u, 1u },
+  { 0x62400000554Full, 192u, 1u },
+  { 0x554F0000984Cull, 193u, 1u },
+  { 0x984C00005B50ull, 194u, 1u },
+  { 0x5B5000004F9Bull, 195u, 1u },
+  { 0x4F9B0000611Bull, 196u, 1u },
+  { 0x611B000091D1ull, 197u, 1u },
+  { 0x91D10000540Dull, 198u, 1u },
+  { 0x540D0000524Dull, 199u, 1u },
+  { 0x524D00005B50ull, 200u, 1u },
+  { 0x5B5000004FE1ull, 201u, 1u },
+  { 0x4FE100003055ull, 202u, 1u },
+  { 0x305500003042ull, 203u, 1u },
+  { 0x304200005C11ull, 204u, 1u },
+  { 0x5C1100003057ull, 205u, 1u },
+  { 0x305700004F7Full, 206u, 1u },
+  { 0x4F7F00005168ull, 207u, 1u },
+  { 0x516800003066ull, 208u, 1u },
+  { 0x306600004E16ull, 209u, 1u },
+  { 0x4E160000754Cull, 210u, 1u },
+  { 0x754C00006559ull, 211u, 1u },
+  { 0x655900003048ull, 212u, 1u },
+  { 0x30480000901Aull, 213u, 1u },
+  { 0x901A0000308Aull, 214u, 1u },
+  { 0x308A00006765ull, 215u, 1u },
+  { 0x67650000308Bull, 216u, 1u },
+  { 0x308B00004E0Aull, 217u, 1u },
+  { 0x4E0A00005165ull, 218u, 1u },
+  { 0x308C00004EBAull, 219u, 1u },
+  { 0x4EBA00009593ull, 220u, 1u },
+  { 0x95930000884Cull, 221u, 1u },
+  { 0x884C00003051ull, 222u, 1u },
+  { 0x305100004ECAull, 223u, 1u },
+  { 0x4ECA000065E5ull, 224u, 1u },
+  { 0x65E500007269ull, 225u, 1u },
+  { 0x726900005973ull, 226u, 1u },
+  { 0x59730000547Cull, 227u, 1u },
+  { 0x547C0000751Full, 228u, 1u },
+  { 0x304D00003042ull, 229u, 1u },
+  { 0x30420000308Cull, 230u, 1u },
+  { 0x308C00003058ull, 231u, 1u },
+  { 0x305800003083ull, 232u, 1u },
+  { 0x308300003042ull, 233u, 1u },
+  { 0x304200006B62ull, 234u, 1u },
+  { 0x308100005FC3ull, 235u, 1u },
+  { 0x5FC30000914Dull, 236u, 1u },
+  { 0x914D00006BCDull, 237u, 1u },
+  { 0x6BCD00009023ull, 238u, 1u },
+  { 0x308C000095A2ull, 239u, 1u },
+  { 0x95A200004FC2ull, 240u, 1u },
+  { 0x4FC200005916ull, 241u, 1u },
+  { 0x591600005BB6ull, 242u, 1u },
+  { 0x5BB6000065CFull, 243u, 1u },
+  { 0x65CF00008D77ull, 244u, 1u },
+  { 0x8D770000304Dull, 245u, 1u },
+  { 0x304D0000610Full, 246u, 1u },
+  { 0x610F00005473ull, 247u, 1u },
+  { 0x54730000795Eull, 248u, 1u },
+  { 0x795E00008B66ull, 249u, 1u },
+  { 0x8B6600005BDFull, 250u, 1u },
+  { 0x5BDF0000529Bull, 251u, 1u },
+  { 0x529B00006700ull, 252u, 1u },
+  { 0x670000005F8Cull, 253u, 1u },
+  { 0x5F8C00004F5Cull, 254u, 1u },
+  { 0x4F5C00006B21ull, 255u, 1u },
+  { 0x6B210000606Full, 256u, 1u },
+  { 0x606F00005B50ull, 257u, 1u },
+  { 0x5B50000053D6ull, 258u, 1u },
+  { 0x53D600005168ull, 259u, 1u },
+  { 0x5168000090E8ull, 260u, 1u },
+  { 0x90E800009593ull, 261u, 1u },
+  { 0x9593000066F8ull, 262u, 1u },
+  { 0x66F80000635Cull, 263u, 1u },
+  { 0x635C000067FBull, 264u, 1u },
+  { 0x67FB00008D77ull, 265u, 1u },
+  { 0x3053000056DEull, 266u, 1u },
+  { 0x56DE00005225ull, 267u, 1u },
+  { 0x5225000060C5ull, 268u, 1u },
+  { 0x60C500005831ull, 269u, 1u },
+  { 0x583100007406ull, 270u, 1u },
+  { 0x740600007531ull, 271u, 1u },
+  { 0x753100006570ull, 272u, 1u },
+  { 0x657000004E00ull, 273u, 1u },
+  { 0x4E0000004EBAull, 274u, 1u },
+  { 0x4EBA000090E8ull, 275u, 1u },
+  { 0x90E800005C4Bull, 276u, 1u },
+  { 0x5C4B00004EE5ull, 277u, 1u },
+  { 0x4EE500004E0Aull, 278u, 1u },
+  { 0x4E0A00004EBAull, 279u, 1u },
+  { 0x4EBA0000751Full, 280u, 1u },
+  { 0x751F00006025ull, 281u, 1u },
+  { 0x6025000098DFull, 282u, 1u },
+  { 0x307900005973ull, 283u, 1u },
+  { 0x597300006027ull, 284u, 1u },
+  { 0x602700007D9Aull, 285u, 1u },
+  { 0x7D9A00003051ull, 286u, 1u },
+  { 0x305100004E8Bull, 287u, 1u },
+  { 0x4E8B00004EF6ull, 288u, 1u },
+  { 0x4EF6000059CBull, 289u, 1u },
+  { 0x59CB00003081ull, 290u, 1u },
+  { 0x308100006700ull, 291u, 1u },
+  { 0x67000000521Dull, 292u, 1u },
+  { 0x521D00009023ull, 293u, 1u },
+  { 0x902300007D61ull, 294u, 1u },
+  { 0x7D610000307Eull, 295u, 1u },
+  { 0x307E00003042ull, 296u, 1u },
+  { 0x304200008ABFull, 297u, 1u },
+  { 0x8ABF00003079ull, 298u, 1u },
+  { 0x307900005B89ull, 299u, 1u },
+  { 0x5B8900005168ull, 300u, 1u },
+  { 0x516800004E0Bull, 301u, 1u },
+  { 0x4E0B00003055ull, 302u, 1u },
+  { 0x30550000697Dull, 303u, 1u },
+  { 0x305700006BBAull, 304u, 1u },
+  { 0x6BBA00004EBAull, 305u, 1u },
+  { 0x4E0B00004E07ull, 306u, 1u },
+  { 0x4E07000053CBull, 307u, 1u },
+  { 0x53CB00009054ull, 308u, 1u },
+  { 0x905400007D04ull, 309u, 1u },
+  { 0x7D040000675Full, 310u, 1u },
+  { 0x675F00004E8Cull, 311u, 1u },
+  { 0x4E8C00007D50ull, 312u, 1u },
+  { 0x7D5000005A5Aull, 313u, 1u },
+  { 0x5A5A00007121ull, 314u, 1u },
+  { 0x712100007406ull, 315u, 1u },
+  { 0x74060000611Full, 316u, 1u },
+  { 0x611F00003058ull, 317u, 1u },
+  { 0x305800005F97ull, 318u, 1u },
+  { 0x5F9700006700ull, 319u, 1u },
+  { 0x670000009AD8ull, 320u, 1u },
+  { 0x9AD800009001ull, 321u, 1u },
+  { 0x900100008A08ull, 322u, 1u },
+  { 0x8A080000753Bull, 323u, 1u },
+  { 0x753B00004EF2ull, 324u, 1u },
+  { 0x4EF200009593ull, 325u, 1u },
+  { 0x959300005148ull, 326u, 1u },
+  { 0x5148000053EFull, 327u, 1u },
+  { 0x53EF000080FDull, 328u, 1u },
+  { 0x80FD00003042ull, 329u, 1u },
+  { 0x304200003044ull, 330u, 1u },
+  { 0x304400003064ull, 331u, 1u },
+  { 0x306400003042ull, 332u, 1u },
+  { 0x304200003068ull, 333u, 1u },
+  { 0x30680000660Eull, 334u, 1u },
+  { 0x660E000065E5ull, 335u, 1u },
+  { 0x65E500005909ull, 336u, 1u },
+  { 0x59090000308Full, 337u, 1u },
+  { 0x308F0000805Eull, 338u, 1u },
+  { 0x805E00003053ull, 339u, 1u },
+  { 0x305300003048ull, 340u, 1u },
+  { 0x3048000078BAull, 341u, 1u },
+  { 0x78BA00008A8Dull, 342u, 1u },
+  { 0x8A8D0000547Dull, 343u, 1u },
+  { 0x547D00007740ull, 344u, 1u },
+  { 0x774000004E0Eull, 345u, 1u },
+  { 0x4E0E00003048ull, 346u, 1u },
+  { 0x304800005168ull, 347u, 1u },
+  { 0x5168000054E1ull, 348u, 1u },
+  { 0x54E1000052D5ull, 349u, 1u },
+  { 0x52D500007406ull, 350u, 1u },
+  { 0x7406000089E3ull, 351u, 1u },
+  { 0x89E300004E8Cull, 352u, 1u },
+  { 0x4E8C00004EBAull, 353u, 1u },
+  { 0x4EBA0000958Bull, 354u, 1u },
+  { 0x958B00003051ull, 355u, 1u },
+  { 0x3051000053CBull, 356u, 1u },
+  { 0x53CB00004EBAull, 357u, 1u },
+  { 0x4EBA00006A5Full, 358u, 1u },
+  { 0x6A5F00004E0Dull, 359u, 1u },
+  { 0x4E0D00003042ull, 360u, 1u },
+  { 0x304200003052ull, 361u, 1u },
+  { 0x3052000096E2ull, 362u, 1u },
+  { 0x96E20000308Cull, 363u, 1u },
+  { 0x308C00006226ull, 364u, 1u },
+  { 0x622600005148ull, 365u, 1u },
+  { 0x51480000751Full, 366u, 1u },
+  { 0x751F00008A00ull, 367u, 1u },
+  { 0x8A0000003048ull, 368u, 1u },
+  { 0x304800008CEAull, 369u, 1u },
+  { 0x8CEA0000554Full, 370u, 1u },
+  { 0x554F00007F6Eull, 371u, 1u },
+  { 0x7F6E000072AFull, 372u, 1u },
+  { 0x72AF00004EBAull, 373u, 1u },
+  { 0x4EBA000053D7ull, 374u, 1u },
+  { 0x30510000611Full, 375u, 1u },
+  { 0x611F00007B2Cull, 376u, 1u },
+  { 0x7B2C00003042ull, 377u, 1u },
+  { 0x304200003041ull, 378u, 1u },
+  { 0x304100004F1Dull, 379u, 1u },
+  { 0x304800007D20ull, 380u, 1u },
+  { 0x7D2000006674ull, 381u, 1u },
+  { 0x667400003089ull, 382u, 1u },
+  { 0x308900003057ull, 383u, 1u },
+  { 0x3057000030C9ull, 384u, 1u },
+  { 0x30C9000030A2ull, 385u, 1u },
+  { 0x30A20000672Cull, 386u, 1u },
+  { 0x672C00004E57ull, 387u, 1u },
+  { 0x4E5700007528ull, 388u, 1u },
+  { 0x75280000611Full, 389u, 1u },
+  { 0x611F00008B1Dull, 390u, 1u },
+  { 0x8B1D00006B63ull, 391u, 1u },
+  { 0x6B6300003057ull, 392u, 1u },
+  { 0x305700008A00ull, 393u, 1u },
+  { 0x8A0000008449ull, 394u, 1u },
+  { 0x844900005927ull, 395u, 1u },
+  { 0x592700007ACBull, 396u, 1u },
+  { 0x7ACB00005199ull, 397u, 1u },
+  { 0x51990000771Full, 398u, 1u },
+  { 0x771F0000FF12ull, 399u, 1u },
+  { 0xFF1200004EBAull, 400u, 1u },
+  { 0x4EBA00008AACull, 401u, 1u },
+  { 0x8AAC0000660Eull, 402u, 1u },
+  { 0x660E0000535Aull, 403u, 1u },
+  { 0x535A000058EBull, 404u, 1u },
+  { 0x58EB00005F37ull, 405u, 1u },
+  { 0x5F3700007D76ull, 406u, 1u },
+  { 0x7D7600005BFEull, 407u, 1u },
+  { 0x5BFE00005EA7ull, 408u, 1u },
+  { 0x5EA7000056FDull, 409u, 1u },
+  { 0x56FD00005411ull, 410u, 1u },
+  { 0x304B0000540Dull, 411u, 1u },
+  { 0x540D00003042ull, 412u, 1u },
+  { 0x308B000091CEull, 413u, 1u },
+  { 0x91CE000090CEull, 414u, 1u },
+  { 0x90CE0000756Aull, 415u, 1u },
+  { 0x756A00004E00ull, 416u, 1u },
+  { 0x4E000000756Aull, 417u, 1u },
+  { 0x756A000091CDull, 418u, 1u },
+  { 0x91CD00008981ull, 419u, 1u },
+  { 0x8981000072B6ull, 420u, 1u },
+  { 0x72B600006CC1ull, 421u, 1u },
+  { 0x6CC100005143ull, 422u, 1u },
+  { 0x514300006C17ull, 423u, 1u },
+  { 0x6C1700006C34ull, 424u, 1u },
+  { 0x6C3400005909ull, 425u, 1u },
+  { 0x590900003048ull, 426u, 1u },
+  { 0x304800005341ull, 427u, 1u },
+  { 0x534100005206ull, 428u, 1u },
+  { 0x520600009031ull, 429u, 1u },
+  { 0x903100009593ull, 430u, 1u },
+  { 0x959300003084ull, 431u, 1u },
+  { 0x308400003042ull, 432u, 1u },
+  { 0x304200007236ull, 433u, 1u },
+  { 0x7236000089AAull, 434u, 1u },
+  { 0x89AA00009593ull, 435u, 1u },
+  { 0x905500003044ull, 436u, 1u },
+  { 0x30440000738Bull, 437u, 1u },
+  { 0x738B00004E86ull, 438u, 1u },
+  { 0x4E86000089E3ull, 439u, 1u },
+  { 0x89E3000076F8ull, 440u, 1u },
+  { 0x76F80000624Bull, 441u, 1u },
+  { 0x624B000054E1ull, 442u, 1u },
+  { 0x54E1000058F0ull, 443u, 1u },
+  { 0x58F000004F1Aull, 444u, 1u },
+  { 0x4F1A00003048ull, 445u, 1u },
+  { 0x3048000097F3ull, 446u, 1u },
+  { 0x97F30000591Aull, 447u, 1u },
+  { 0x591A0000304Full, 448u, 1u },
+  { 0x304F00006D88ull, 449u, 1u },
+  { 0x6D8800003048ull, 450u, 1u },
+  { 0x304800004F1Aull, 451u, 1u },
+  { 0x4F1A0000793Eull, 452u, 1u },
+  { 0x793E00007C21ull, 453u, 1u },
+  { 0x7C2100005358ull, 454u, 1u },
+  { 0x535800009078ull, 455u, 1u },
+  { 0x907800006B8Bull, 456u, 1u },
+  { 0x6B8B00005FF5ull, 457u, 1u },
+  { 0x5FF5000081EAull, 458u, 1u },
+  { 0x81EA00007531ull, 459u, 1u },
+  { 0x7531000081EAull, 460u, 1u },
+  { 0x81EA00008EABull, 461u, 1u },
+  { 0x8EAB00007B49ull, 462u, 1u },
+  { 0x7B4900004E00ull, 463u, 1u },
+  { 0x4E0000004F53ull, 464u, 1u },
+  { 0x4F5300004EBAull, 465u, 1u },
+  { 0x4EBA00003005ull, 466u, 1u },
+  { 0x300500005831ull, 467u, 1u },
+  { 0x58310000544Aull, 468u, 1u },
+  { 0x544A00008AADull, 469u, 1u },
+  { 0x8AAD0000904Eull, 470u, 1u },
+  { 0x904E0000304Eull, 471u, 1u },
+  { 0x304E0000901Aull, 472u, 1u },
+  { 0x901A000030A2ull, 473u, 1u },
+  { 0x30A2000030E1ull, 474u, 1u },
+  { 0x30E1000030EAull, 475u, 1u },
+  { 0x30AB00005143ull, 476u, 1u },
+  { 0x51430000547Dull, 477u, 1u },
+  { 0x547D00004EE4ull, 478u, 1u },
+  { 0x4EE400009AD8ull, 479u, 1u },
+  { 0x9AD800004F53ull, 480u, 1u },
+  { 0x592700007D71ull, 481u, 1u },
+  { 0x7D7100009818ull, 482u, 1u },
+  { 0x981800006708ull, 483u, 1u },
+  { 0x670800008B66ull, 484u, 1u },
+  { 0x8B6600005B98ull, 485u, 1u },
+  { 0x5B9800008A9Eull, 486u, 1u },
+  { 0x8A9E00005B66ull, 487u, 1u },
+  { 0x5B6600006821ull, 488u, 1u },
+  { 0x682100005BFEull, 489u, 1u },
+  { 0x5BFE00006C7Aull, 490u, 1u },
+  { 0x6C7A00003081ull, 491u, 1u },
+  { 0x30810000771Full, 492u, 1u },
+  { 0x771F00005B9Full, 493u, 1u },
+  { 0x5B9F0000521Dull, 494u, 1u },
+  { 0x308100003066ull, 495u, 1u },
+  { 0x3066000053E3ull, 496u, 1u },
+  { 0x53E300005927ull, 497u, 1u },
+  { 0x592700005909ull, 498u, 1u },
+  { 0x590900008981ull, 499u, 1u },
+  { 0x898100005909ull, 500u, 1u },
+  { 0x590900006226ull, 501u, 1u },
+  { 0x622600004E89ull, 502u, 1u },
+  { 0x4E8900005B66ull, 503u, 1u },
+  { 0x5B6600003042ull, 504u, 1u },
+  { 0x30420000305Dull, 505u, 1u },
+  { 0x305D00003053ull, 506u, 1u },
+  { 0x305300006B66ull, 507u, 1u },
+  { 0x6B6600005668ull, 508u, 1u },
+  { 0x566800005E97ull, 509u, 1u },
+  { 0x5E9700006BCDull, 510u, 1u },
+  { 0x6BCD000089AAull, 511u, 1u },
+  { 0x89AA00005211ull, 512u, 1u },
+  { 0x521100004E8Bull, 513u, 1u },
+  { 0x4E8B00006C17ull, 514u, 1u },
+  { 0x6C1700006301ull, 515u, 1u },
+  { 0x306100009593ull, 516u, 1u },
+  { 0x90550000904Bull, 517u, 1u },
+  { 0x904B00008A18ull, 518u, 1u },
+  { 0x8A1800009332ull, 519u, 1u },
+  { 0x933200005149ull, 520u, 1u },
+  { 0x51490000624Bull, 521u, 1u },
+  { 0x4F1D00006DF1ull, 522u, 1u },
+  { 0x6DF10000843Dull, 523u, 1u },
+  { 0x774000005B58ull, 524u, 1u },
+  { 0x5B5800005728ull, 525u, 1u },
+  { 0x572800005B9Full, 526u, 1u },
+  { 0x5B9F00005F79ull, 527u, 1u },
+  { 0x5F79000075C5ull, 528u, 1u },
+  { 0x75C500009662ull, 529u, 1u },
+  { 0x966200004F4Full, 530u, 1u },
+  { 0x4F4F00008CACull, 531u, 1u },
+  { 0x8CAC00004EFBull, 532u, 1u },
+  { 0x4EFB00003042ull, 533u, 1u },
+  { 0x30630000666Eull, 534u, 1u },
+  { 0x666E0000901Aull, 535u, 1u },
+  { 0x901A0000884Cull, 536u, 1u },
+  { 0x884C000052D5ull, 537u, 1u },
+  { 0x52D500005927ull, 538u, 1u },
+  { 0x304D0000306Aull, 539u, 1u },
+  { 0x306A000076E3ull, 540u, 1u },
+  { 0x76E300008996ull, 541u, 1u },
+  { 0x899600005354ull, 542u, 1u },
+  { 0x53540000529Bull, 543u, 1u },
+  { 0x529B0000591Aull, 544u, 1u },
+  { 0x591A00005206ull, 545u, 1u },
+  { 0x520600005B9Full, 546u, 1u },
+  { 0x5B9F0000969Bull, 547u, 1u },
+  { 0x969B00008DB3ull, 548u, 1u },
+  { 0x8DB300005730ull, 549u, 1u },
+  { 0x573000007403ull, 550u, 1u },
+  { 0x74030000751Full, 551u, 1u },
+  { 0x751F00006D3Bull, 552u, 1u },
+  { 0x6D3B00004EFBull, 553u, 1u },
+  { 0x4EFB0000305Bull, 554u, 1u },
+  { 0x305B00006C17ull, 555u, 1u },
+  { 0x6C1700005206ull, 556u, 1u },
+  { 0x5206000089E3ull, 557u, 1u },
+  { 0x89E300006C7Aull, 558u, 1u },
+  { 0x6C7A00007D50ull, 559u, 1u },
+  { 0x7D500000679Cull, 560u, 1u },
+  { 0x679C00008ABFull, 561u, 1u },
+  { 0x8ABF000067FBull, 562u, 1u },
+  { 0x67FB00007814ull, 563u, 1u },
+  { 0x781400007A76ull, 564u, 1u },
+  { 0x7A7600004F55ull, 565u, 1u },
+  { 0x4F55000051E6ull, 566u, 1u },
+  { 0x51E60000767Aull, 567u, 1u },
+  { 0x767A0000898Bull, 568u, 1u },
+  { 0x898B00005834ull, 569u, 1u },
+  { 0x583400005927ull, 570u, 1u },
+  { 0x592700004E8Bull, 571u, 1u },
+  { 0x4E8B00006B62ull, 572u, 1u },
+  { 0x6B620000307Eull, 573u, 1u },
+  { 0x307E00008208ull, 574u, 1u },
+  { 0x820800005473ull, 575u, 1u },
+  { 0x547300005927ull, 576u, 1u },
+  { 0x304D0000751Full, 577u, 1u },
+  { 0x751F0000306Aull, 578u, 1u },
+  { 0x306A00003042ull, 579u, 1u },
+  { 0x30420000904Bull, 580u, 1u },
+  { 0x904B00008EE2ull, 581u, 1u },
+  { 0x8EE2000030F6ull, 582u, 1u },
+  { 0x30F600006708ull, 583u, 1u },
+  { 0x67080000591Aull, 584u, 1u },
+  { 0x591A0000FF11ull, 585u, 1u },
+  { 0xFF1100004EBAull, 586u, 1u },
+  { 0x4EBA0000756Aull, 587u, 1u },
+  { 0x756A000053F7ull, 588u, 1u },
+  { 0x53F7000072B6ull, 589u, 1u },
+  { 0x72B60000614Bull, 590u, 1u },
+  { 0x614B00006765ull, 591u, 1u },
+  { 0x676500003044ull, 592u, 1u },
+  { 0x30440000958Bull, 593u, 1u },
+  { 0x958B00004E0Aull, 594u, 1u },
+  { 0x624B00006E08ull, 595u, 1u },
+  { 0x6E0800005834ull, 596u, 1u },
+  { 0x583400005408ull, 597u, 1u },
+  { 0x540800005211ull, 598u, 1u },
+  { 0x5211000052D9ull, 599u, 1u },
+  { 0x52D900004ECAull, 600u, 1u },
+  { 0x4ECA00005EA6ull, 601u, 1u },
+  { 0x5EA600004EE5ull, 602u, 1u },
+  { 0x4EE500005916ull, 603u, 1u },
+  { 0x59160000671Dull, 604u, 1u },
+  { 0x671D000098DBull, 605u, 1u },
+  { 0x98DB0000884Cull, 606u, 1u },
+  { 0x884C00003042ull, 607u, 1u },
+  { 0x30420000307Eull, 608u, 1u },
+  { 0x8FD10000304Full, 609u, 1u },
+  { 0x304F00005F8Cull, 610u, 1u },
+  { 0x5F8C0000308Dull, 611u, 1u },
+  { 0x308D000076EEull, 612u, 1u },
+  { 0x76EE00007684ull, 613u, 1u },
+  { 0x768400006B4Cull, 614u, 1u },
+  { 0x6B4C00009762ull, 615u, 1u },
+  { 0x97620000767Dull, 616u, 1u },
+  { 0x767D00005F01ull, 617u, 1u },
+  { 0x5F0100008B77ull, 618u, 1u },
+  { 0x8B7700005BA2ull, 619u, 1u },
+  { 0x5BA2000058F2ull, 620u, 1u },
+  { 0x58F200007279ull, 621u, 1u },
+  { 0x727900005225ull, 622u, 1u },
+  { 0x522500006628ull, 623u, 1u },
+  { 0x6628000065E5ull, 624u, 1u },
+  { 0x65E500005C11ull, 625u, 1u },
+  { 0x5C110000306Aull, 626u, 1u },
+  { 0x306A00008A8Dull, 627u, 1u },
+  { 0x8A8D00003081ull, 628u, 1u },
+  { 0x308100006B7Bull, 629u, 1u },
+  { 0x6B7B00004F53ull, 630u, 1u },
+  { 0x4F530000533Bull, 631u, 1u },
+  { 0x533B00008005ull, 632u, 1u },
+  { 0x8005000088C5ull, 633u, 1u },
+  { 0x88C500007F6Eull, 634u, 1u },
+  { 0x7F6E00005171ull, 635u, 1u },
+  { 0x51710000552Full, 636u, 1u },
+  { 0x552F00004E00ull, 637u, 1u },
+  { 0x4E0000003042ull, 638u, 1u },
+  { 0x306A00004E0Dull, 639u, 1u },
+  { 0x4E0D0000660Eull, 640u, 1u },
+  { 0x660E00009650ull, 641u, 1u },
+  { 0x96500000308Aull, 642u, 1u },
+  { 0x308A00004FE1ull, 643u, 1u },
+  { 0x4FE100007528ull, 644u, 1u },
+  { 0x752800007F8Eull, 645u, 1u },
+  { 0x7F8E00003057ull, 646u, 1u },
+  { 0x305700007528ull, 647u, 1u },
+  { 0x75280000610Full, 648u, 1u },
+  { 0x610F00008A71ull, 649u, 1u },
+  { 0x8A710000305Bull, 650u, 1u },
+  { 0x305B000079FBull, 651u, 1u },
+  { 0x79FB000052D5ull, 652u, 1u },
+  { 0x52D500006620ull, 653u, 1u },
+  { 0x66200000753Bull, 654u, 1u },
+  { 0x753B00007F8Eull, 655u, 1u },
+  { 0x7F8E000054B2ull, 656u, 1u },
+  { 0x54B2000053D6ull, 657u, 1u },
+  { 0x53D600005F15ull, 658u, 1u },
+  { 0x5F1500006700ull, 659u, 1u },
+  { 0x670000008FD1ull, 660u, 1u },
+  { 0x8FD1000073FEull, 661u, 1u },
+  { 0x73FE00005834ull, 662u, 1u },
+  { 0x583400004E8Bull, 663u, 1u },
+  { 0x4E8B00006545ull, 664u, 1u },
+  { 0x654500009023ull, 665u, 1u },
+  { 0x902300004E2Dull, 666u, 1u },
+  { 0x4E2D0000904Eull, 667u, 1u },
+  { 0x904E000053BBull, 668u, 1u },
+  { 0x53BB00005168ull, 669u, 1u },
+  { 0x51680000304Full, 670u, 1u },
+  { 0x304F00009078ull, 671u, 1u },
+  { 0x90780000629Eull, 672u, 1u },
+  { 0x629E00005B8Cull, 673u, 1u },
+  { 0x5B8C00005168ull, 674u, 1u },
+  { 0x516800004FE1ull, 675u, 1u },
+  { 0x4FE100003058ull, 676u, 1u },
+  { 0x305800004FE1ull, 677u, 1u },
+  { 0x4FE10000983Cull, 678u, 1u },
+  { 0x983C0000753Aull, 679u, 1u },
+  { 0x753A00004F55ull, 680u, 1u },
+  { 0x4F5500006545ull, 681u, 1u },
+  { 0x6545000059CBull, 682u, 1u },
+  { 0x307E00007CBEull, 683u, 1u },
+  { 0x7CBE0000795Eull, 684u, 1u },
+  { 0x795E00004ED8ull, 685u, 1u },
+  { 0x305100003042ull, 686u, 1u },
+  { 0x308900005973ull, 687u, 1u },
+  { 0x59730000306Eull, 688u, 1u },
+  { 0x5B5000006C17ull, 689u, 1u },
+  { 0x6C1700003065ull, 690u, 1u },
+  { 0x306500008A18ull, 691u, 1u },
+  { 0x8A18000061B6ull, 692u, 1u },
+  { 0x61B600009811ull, 693u, 1u },
+  { 0x981100005F35ull, 694u, 1u },
+  { 0x5F3500000032ull, 695u, 1u },
+  { 0x003200004EBAull, 696u, 1u },
+  { 0x4EBA00007D20ull, 697u, 1u },
+  { 0x7D2000006575ull, 698u, 1u },
+  { 0x657500008EABull, 699u, 1u },
+  { 0x8EAB00004FA1ull, 700u, 1u },
+  { 0x4FA100005024ull, 701u, 1u },
+  { 0x502400006709ull, 702u, 1u },
+  { 0x67090000975Eull, 703u, 1u },
+  { 0x975E00005E38ull, 704u, 1u },
+  { 0x5E3800004E09ull, 705u, 1u },
+  { 0x4E0900006700ull, 706u, 1u },
+  { 0x670000003082ull, 707u, 1u },
+  { 0x308200004E21ull, 708u, 1u },
+  { 0x4E21000089AAull, 709u, 1u },
+  { 0x89AA00004EBAull, 710u, 1u },
+  { 0x4EBA00007269ull, 711u, 1u },
+  { 0x72690000751Full, 712u, 1u },
+  { 0x751F0000307Eull, 713u, 1u },
+  { 0x307E0000308Cull, 714u, 1u },
+  { 0x8B6600005099ull, 715u, 1u },
+  { 0x509900004EE5ull, 716u, 1u },
+  { 0x4EE50000524Dull, 717u, 1u },
+  { 0x524D00007121ull, 718u, 1u },
+  { 0x712100004E8Bull, 719u, 1u },
+  { 0x4E8B0000805Eull, 720u, 1u },
+  { 0x805E00003051ull, 721u, 1u },
+  { 0x305100006C7Aull, 722u, 1u },
+  { 0x6C7A00003057ull, 723u, 1u },
+  { 0x306600009280ull, 724u, 1u },
+  { 0x92800000884Cull, 725u, 1u },
+  { 0x884C000099ACull, 726u, 1u },
+  { 0x9E7F000088C1ull, 727u, 1u },
+  { 0x88C100005224ull, 728u, 1u },
+  { 0x52240000964Dull, 729u, 1u },
+  { 0x592700005B66ull, 730u, 1u },
+  { 0x5B6600005DDEull, 731u, 1u },
+  { 0x5DDE00004ECAull, 732u, 1u },
+  { 0x4ECA000056DEull, 733u, 1u },
+  { 0x56DE00007A7Aull, 734u, 1u },
+  { 0x7A7A00007D4Cull, 735u, 1u },
+  { 0x7D4C00009A13ull, 736u, 1u },
+  { 0x9A130000672Cull, 737u, 1u },
+  { 0x672C00007269ull, 738u, 1u },
+  { 0x7269000090E8ull, 739u, 1u },
+  { 0x90E800005316ull, 740u, 1u },
+  { 0x53160000672Aull, 741u, 1u },
+  { 0x672A00006765ull, 742u, 1u },
+  { 0x676500006B63ull, 743u, 1u },
+  { 0x6B63000076F4ull, 744u, 1u },
+  { 0x76F400005E74ull, 745u, 1u },
+  { 0x5E7400009593ull, 746u, 1u },
+  { 0x959300007121ull, 747u, 1u },
+  { 0x7121000099C4ull, 748u, 1u },
+  { 0x99C4000073FEull, 749u, 1u },
+  { 0x73FE0000308Cull, 750u, 1u },
+  { 0x308C00005CF6ull, 751u, 1u },
+  { 0x5CF6000075C5ull, 752u, 1u },
+  { 0x75C500006C17ull, 753u, 1u },
+  { 0x6C1700005185ull, 754u, 1u },
+  { 0x5185000098A8ull, 755u, 1u },
+  { 0x98A800007D50ull, 756u, 1u },
+  { 0x7D50000069CBull, 757u, 1u },
+  { 0x69CB00006CBBull, 758u, 1u },
+  { 0x6CBB00007642ull, 759u, 1u },
+  { 0x764200004E88ull, 760u, 1u },
+  { 0x4E8800005B9Aull, 761u, 1u },
+  { 0x5B9A000070B9ull, 762u, 1u },
+  { 0x70B900000031ull, 763u, 1u },
+  { 0x003100004EBAull, 764u, 1u },
+  { 0x4EBA00008A31ull, 765u, 1u },
+  { 0x8A31000053EFull, 766u, 1u },
+  { 0x53EF000052C7ull, 767u, 1u },
+  { 0x52C700006C17ull, 768u, 1u },
+  { 0x6C1700006700ull, 769u, 1u },
+  { 0x6700000060AAull, 770u, 1u },
+  { 0x60AA0000672Cull, 771u, 1u },
+  { 0x672C00006C17ull, 772u, 1u },
+  { 0x6C1700005168ull, 773u, 1u },
+  { 0x516800007136ull, 774u, 1u },
+  { 0x713600004EFBull, 775u, 1u },
+  { 0x4EFB000052D9ull, 776u, 1u },
+  { 0x52D9000065E5ull, 777u, 1u },
+  { 0x65E50000672Cull, 778u, 1u },
+  { 0x672C00004F5Cull, 779u, 1u },
+  { 0x4F5C00006226ull, 780u, 1u },
+  { 0x622600006210ull, 781u, 1u },
+  { 0x62100000529Full, 782u, 1u },
+  { 0x529F00009032ull, 783u, 1u },
+  { 0x903200008FD1ull, 784u, 1u },
+  { 0x3065000054C1ull, 785u, 1u },
+  { 0x54C100006D88ull, 786u, 1u },
+  { 0x6D8800005C0Full, 787u, 1u },
+  { 0x30550000306Aull, 788u, 1u },
+  { 0x306A000079D1ull, 789u, 1u },
+  { 0x79D100005B66ull, 790u, 1u },
+  { 0x5B660000653Eull, 791u, 1u },
+  { 0x653E00005411ull, 792u, 1u },
+  { 0x541100003053ull, 793u, 1u },
+  { 0x305300003046ull, 794u, 1u },
+  { 0x304600004E8Bull, 795u, 1u },
+  { 0x4E8B00005B9Full, 796u, 1u },
+  { 0x5B9F000098DFull, 797u, 1u },
+  { 0x98DF000095A2ull, 798u, 1u },
+  { 0x95A200006226ull, 799u, 1u },
+  { 0x622600003044ull, 800u, 1u },
+  { 0x304400005C11ull, 801u, 1u },
+  { 0x5C1100005E74ull, 802u, 1u },
+  { 0x5E7400007206ull, 803u, 1u },
+  { 0x72060000767Aull, 804u, 1u },
+  { 0x767A000073FEull, 805u, 1u },
+  { 0x73FE00005B9Full, 806u, 1u },
+  { 0x5B9F00004FDDull, 807u, 1u },
+  { 0x4FDD00008B77ull, 808u, 1u },
+  { 0x8B7700005730ull, 809u, 1u },
+  { 0x573000004E0Bull, 810u, 1u },
+  { 0x4E0B0000968Aull, 811u, 1u },
+  { 0x968A00005730ull, 812u, 1u },
+  { 0x573000005225ull, 813u, 1u },
+  { 0x52250000308Cull, 814u, 1u },
+  { 0x308C00006642ull, 815u, 1u },
+  { 0x664200004EE3ull, 816u, 1u },
+  { 0x4EE300004F7Full, 817u, 1u },
+  { 0x4F7F00003048ull, 818u, 1u },
+  { 0x304800007D44ull, 819u, 1u },
+  { 0x7D4400007E54ull, 820u, 1u },
+  { 0x7E5400005F0Full, 821u, 1u },
+  { 0x5F0F0000843Dull, 822u, 1u },
+  { 0x3051000052D5ull, 823u, 1u },
+  { 0x52D500007269ull, 824u, 1u },
+  { 0x726900007121ull, 825u, 1u },
+  { 0x305700004E0Bull, 826u, 1u },
+  { 0x4E0B0000304Cull, 827u, 1u },
+  { 0x304C00006280ull, 828u, 1u },
+  { 0x628000008853ull, 829u, 1u },
+  { 0x88530000500Bull, 830u, 1u },
+  { 0x500B00004EBAull, 831u, 1u },
+  { 0x671F00005F85ull, 832u, 1u },
+  { 0x5F8500008ABFull, 833u, 1u },
+  { 0x8ABF00005B50ull, 834u, 1u },
+  { 0x5B5000007DDAull, 835u, 1u },
+  { 0x7DDA00005C40ull, 836u, 1u },
+  { 0x5C4000005229ull, 837u, 1u },
+  { 0x522900007528ull, 838u, 1u },
+  { 0x752800004E3Bull, 839u, 1u },
+  { 0x4E3B00004EBAull, 840u, 1u },
+  { 0x4EBA00009928ull, 841u, 1u },
+  { 0x992800006BCEull, 842u, 1u },
+  { 0x6BCE000065E5ull, 843u, 1u },
+  { 0x4ED800005F53ull, 844u, 1u },
+  { 0x5F5300007136ull, 845u, 1u },
+  { 0x7136000060A3ull, 846u, 1u },
+  { 0x60A300008005ull, 847u, 1u },
+  { 0x800500005168ull, 848u, 1u },
+  { 0x516800004ECAull, 849u, 1u },
+  { 0x4ECA0000671Dull, 850u, 1u },
+  { 0x671D0000904Eull, 851u, 1u },
+  { 0x904E00003054ull, 852u, 1u },
+  { 0x3054000099ACull, 853u, 1u },
+  { 0x99AC00003042ull, 854u, 1u },
+  { 0x3042000030FCull, 855u, 1u },
+  { 0x30FC00003042ull, 856u, 1u },
+  { 0x305F00003057ull, 857u, 1u },
+  { 0x305700007ACBull, 858u, 1u },
+  { 0x7ACB00003066ull, 859u, 1u },
+  { 0x306600005730ull, 860u, 1u },
+  { 0x573000007344ull, 861u, 1u },
+  { 0x73440000FF1Aull, 862u, 1u },
+  { 0xFF1A00005408ull, 863u, 1u },
+  { 0x540800007D9Aull, 864u, 1u },
+  { 0x7D9A0000965Bull, 865u, 1u },
+  { 0x965B00004E0Bull, 866u, 1u },
+  { 0x4E0B00005C0Full, 867u, 1u },
+  { 0x30550000706Bull, 868u, 1u },
+  { 0x706B00005E73ull, 869u, 1u },
+  { 0x5E7300006C17ull, 870u, 1u },
+  { 0x6C1700004E16ull, 871u, 1u },
+  { 0x4E1600008A71ull, 872u, 1u },
+  { 0x8A71000080FDull, 873u, 1u },
+  { 0x80FD0000529Bull, 874u, 1u },
+  { 0x529B00007406ull, 875u, 1u },
+  { 0x740600005B50ull, 876u, 1u },
+  { 0x5B500000691Cull, 877u, 1u },
+  { 0x691C000067FBull, 878u, 1u },
+  { 0x67FB000030A2ull, 879u, 1u },
+  { 0x30EC000030C3ull, 880u, 1u },
+  { 0x30AF000030B9ull, 881u, 1u },
+  { 0x30B900006728ull, 882u, 1u },
+  { 0x6728000053F7ull, 883u, 1u },
+  { 0x53F700005C71ull, 884u, 1u },
+  { 0x5C71000089E3ull, 885u, 1u },
+  { 0x89E300008B66ull, 886u, 1u },
+  { 0x8B66000090E8ull, 887u, 1u },
+  { 0x90E8000098DFull, 888u, 1u },
+  { 0x98DF00004E8Bull, 889u, 1u },
+  { 0x4E8B00005E78ull, 890u, 1u },
+  { 0x5E780000904Bull, 891u, 1u },
+  { 0x904B000069CBull, 892u, 1u },
+  { 0x69CB00004FB5ull, 893u, 1u },
+  { 0x4FB500005165ull, 894u, 1u },
+  { 0x5165000099C4ull, 895u, 1u },
+  { 0x99C4000076EEull, 896u, 1u },
+  { 0x76EE00007DCAull, 897u, 1u },
+  { 0x7DCA00006025ull, 898u, 1u },
+  { 0x6025000089AAull, 899u, 1u },
+  { 0x89AA00007236ull, 900u, 1u },
+  { 0x723600006C17ull, 901u, 1u },
+  { 0x6C1700004ED8ull, 902u, 1u },
+  { 0x4ED800004E3Bull, 903u, 1u },
+  { 0x4E3B0000901Full, 904u, 1u },
+  { 0x901F00004EE3ull, 905u, 1u },
+  { 0x308F0000308Aull, 906u, 1u },
+  { 0x308A00004F11ull, 907u, 1u },
+  { 0x4F110000539Full, 908u, 1u },
+  { 0x539F000056E0ull, 909u, 1u },
+  { 0x56E000008B66ull, 910u, 1u },
+  { 0x8B660000544Aull, 911u, 1u },
+  { 0x544A00005C71ull, 912u, 1u },
+  { 0x5C71000091CCull, 913u, 1u },
+  { 0x91CC00007279ull, 914u, 1u },
+  { 0x72790000306Bull, 915u, 1u },
+  { 0x306B000090E8ull, 916u, 1u },
+  { 0x90E800004E0Bull, 917u, 1u },
+  { 0x4E0B0000904Bull, 918u, 1u },
+  { 0x904B0000547Dull, 919u, 1u },
+  { 0x547D00005230ull, 920u, 1u },
+  { 0x523000007740ull, 921u, 1u },
+  { 0x7740000081EAull, 922u, 1u },
+  { 0x81EA00006BBAull, 923u, 1u },
+  { 0x6BBA00005C4Bull, 924u, 1u },
+  { 0x5C4B000073FEull, 925u, 1u },
+  { 0x73FE00005728ull, 926u, 1u },
+  { 0x572800004E00ull, 927u, 1u },
+  { 0x4E00000090E8ull, 928u, 1u },
+  { 0x90E80000884Cull, 929u, 1u },
+  { 0x884C000070BAull, 930u, 1u },
+  { 0x70BA0000907Aull, 931u, 1u },
+  { 0x907A00004F53ull, 932u, 1u },
+  { 0x592700005207ull, 933u, 1u },
+  { 0x5207000095A2ull, 934u, 1u },
+  { 0x95A20000308Full, 935u, 1u },
+  { 0x308F00005E38ull, 936u, 1u },
+  { 0x5E380000611Full, 937u, 1u },
+  { 0x611F000060C5ull, 938u, 1u },
+  { 0x60C500005915ull, 939u, 1u },
+  { 0x5915000098DFull, 940u, 1u },
+  { 0x98DF0000661Full, 941u, 1u },
+  { 0x661F00009054ull, 942u, 1u },
+  { 0x905400004E5Full, 943u, 1u },
+  { 0x4E5F0000624Bull, 944u, 1u },
+  { 0x624B00007D19ull, 945u, 1u },
+  { 0x7D1900006DF7ull, 946u, 1u },
+  { 0x6DF700004E71ull, 947u, 1u },
+  { 0x4E710000652Full, 948u, 1u },
+  { 0x652F0000914Dull, 949u, 1u },
+  { 0x914D00005F71ull, 950u, 1u },
+  { 0x5F71000097FFull, 951u, 1u },
+  { 0x97FF000053D7ull, 952u, 1u },
+  { 0x305100005165ull, 953u, 1u },
+  { 0x308C000077E5ull, 954u, 1u },
+  { 0x77E50000308Cull, 955u, 1u },
+  { 0x308C0000884Cull, 956u, 1u },
+  { 0x884C000065B9ull, 957u, 1u },
+  { 0x65B900005C11ull, 958u, 1u },
+  { 0x5C1100005973ull, 959u, 1u },
+  { 0x597300004F4Dull, 960u, 1u },
+  { 0x4F4D0000534Aull, 961u, 1u },
+  { 0x534A00005206ull, 962u, 1u },
+  { 0x520600008A95ull, 963u, 1u },
+  { 0x8A950000751Full, 964u, 1u },
+  { 0x751F00008D85ull, 965u, 1u },
+  { 0x8D85000065BDull, 966u, 1u },
+  { 0x65BD00008A2Dull, 967u, 1u },
+  { 0x8A2D00006BBAull, 968u, 1u },
+  { 0x6BBA0000305Bull, 969u, 1u },
+  { 0x305B00005411ull, 970u, 1u },
+  { 0x541100003051ull, 971u, 1u },
+  { 0x305100006A5Full, 972u, 1u },
+  { 0x6A5F00004F1Aull, 973u, 1u },
+  { 0x4F1A00004EBAull, 974u, 1u },
+  { 0x4EBA0000985Eull, 975u, 1u },
+  { 0x985E00006B63ull, 976u, 1u },
+  { 0x6B63000078BAull, 977u, 1u },
+  { 0x78BA00008272ull, 978u, 1u },
+  { 0x827200003005ull, 979u, 1u },
+  { 0x300500006D3Bull, 980u, 1u },
+  { 0x6D3B000052D5ull, 981u, 1u },
+  { 0x52D500006599ull, 982u, 1u },
+  { 0x659900007406ull, 983u, 1u },
+  { 0x740600008981ull, 984u, 1u },
+  { 0x898100006C42ull, 985u, 1u },
+  { 0x6C420000518Dull, 986u, 1u },
+  { 0x518D00006307ull, 987u, 1u },
+  { 0x63070000793Aull, 988u, 1u },
+  { 0x793A000090E8ull, 989u, 1u },
+  { 0x90E80000968Aull, 990u, 1u },
+  { 0x968A00004F55ull, 991u, 1u },
+  { 0x4F5500008005ull, 992u, 1u },
+  { 0x8005000097F3ull, 993u, 1u },
+  { 0x97F30000697Dull, 994u, 1u },
+  { 0x697D00004E0Aull, 995u, 1u },
+  { 0x305200007BA1ull, 996u, 1u },
+  { 0x7BA100007406ull, 997u, 1u },
+  { 0x740600006620ull, 998u, 1u },
+  { 0x6620000050CFull, 999u, 1u },
+  { 0x1782000017BAull, 1000u, 1u },
+  { 0x1791000017C5ull, 1001u, 1u },
+  { 0x17E1000017E0ull, 1002u, 1u },
+  { 0x1796000017B8ull, 1003u, 1u },
+  { 0x17E1000017E2ull, 1004u, 1u },
+  { 0x1781000017C2ull, 1005u, 1u },
+  { 0x17E1000017E5ull, 1006u, 1u },
+  { 0x179A000017BAull, 1007u, 1u },
+  { 0x17E1000017E1ull, 1008u, 1u },
+  { 0x1791000017B8ull, 1009u, 1u },
+  { 0x17E20000002Dull, 1010u, 1u },
+  { 0x1782000017C1ull, 1011u, 1u },
+  { 0x1787000017B6ull, 1012u, 1u },
+  { 0x17E1000017E3ull, 1013u, 1u },
+  { 0x17950000179Bull, 1014u, 1u },
+  { 0x1793000017C5ull, 1015u, 1u },
+  { 0x17E30000002Dull, 1016u, 1u },
+  { 0x179F0000002Eull, 1017u, 1u },
+  { 0x17E10000002Dull, 1018u, 1u },
+  { 0x17E1000017E4ull, 1019u, 1u },
+  { 0x17E1000017E9ull, 1020u, 1u },
+  { 0x17E2000017E0ull, 1021u, 1u },
+  { 0x1790000017B6ull, 1022u, 1u },
+  { 0x17E40000002Dull, 1023u, 1u },
+  { 0x178F000017BEull, 1024u, 1u },
+  { 0x17E1000017E6ull, 1025u, 1u },
+  { 0x17E2000017E1ull, 1026u, 1u },
+  { 0x17E2000017E4ull, 1027u, 1u },
+  { 0x1791000017C1ull, 1028u, 1u },
+  { 0x1793000017C3ull, 1029u, 1u },
+  { 0x17E1000017E8ull, 1030u, 1u },
+  { 0x178200001798ull, 1031u, 1u },
+  { 0x1794000017BEull, 1032u, 1u },
+  { 0x17E2000017E5ull, 1033u, 1u },
+  { 0x179B000017BEull, 1034u, 1u },
+  { 0x17E2000017E3ull, 1035u, 1u },
+  { 0x17E2000017E6ull, 1036u, 1u },
+  { 0x17E3000017E0ull, 1037u, 1u },
+  { 0x17820000002Eull, 1038u, 1u },
+  { 0x178700001793ull, 1039u, 1u },
+  { 0x179500001784ull, 1040u, 1u },
+  { 0x179C000017B6ull, 1041u, 1u },
+  { 0x17E1000017E7ull, 1042u, 1u },
+  { 0x17E2000017E2ull, 1043u, 1u },
+  { 0x17E2000017E7ull, 1044u, 1u },
+  { 0x17E2000017E9ull, 1045u, 1u },
+  { 0x1782000017BCull, 1046u, 1u },
+  { 0x178E000017B6ull, 1047u, 1u },
+  { 0x17E0000017E0ull, 1048u, 1u },
+  { 0x17E2000017E8ull, 1049u, 1u },
+  { 0x17E600000025ull, 1050u, 1u },
+  { 0x004100000044ull, 1051u, 1u },
+  { 0x00700000002Eull, 1052u, 1u },
+  { 0x178A00001780ull, 1053u, 1u },
+  { 0x1790000017C3ull, 1054u, 1u },
+  { 0x179A0000002Eull, 1055u, 1u },
+  { 0x17E200000025ull, 1056u, 1u },
+  { 0x17E3000017E4ull, 1057u, 1u },
+  { 0x17E50000002Dull, 1058u, 1u },
+  { 0x17E5000017E0ull, 1059u, 1u },
+  { 0x17E60000002Dull, 1060u, 1u },
+  { 0x17E70000002Dull, 1061u, 1u },
+  { 0x004100000042ull, 1062u, 1u },
+  { 0x004200000043ull, 1063u, 1u },
+  { 0x004200000045ull, 1064u, 1u },
+  { 0x004200000047ull, 1065u, 1u },
+  { 0x004300000046ull, 1066u, 1u },
+  { 0x004700000045ull, 1067u, 1u },
+  { 0x004F00000043ull, 1068u, 1u },
+  { 0x005600000042ull, 1069u, 1u },
+  { 0x006200000079ull, 1070u, 1u },
+  { 0x006F00000066ull, 1071u, 3u },
+  { 0x17800000002Eull, 1074u, 1u },
+  { 0x178A000017C1ull, 1075u, 1u },
+  { 0x178F000017C2ull, 1076u, 1u },
+  { 0x1793000017B6ull, 1077u, 1u },
+  { 0x179400001780ull, 1078u, 1u },
+  { 0x17960000002Eull, 1079u, 1u },
+  { 0x17980000002Eull, 1080u, 1u },
+  { 0x179800001780ull, 1081u, 1u },
+  { 0x1798000017D4ull, 1082u, 1u },
+  { 0x179B000017B8ull, 1083u, 1u },
+  { 0xC5B40000C694ull, 1084u, 1u },
+  { 0xB2C80000B2E4ull, 1085u, 1u },
+  { 0xC5440000B2C8ull, 1086u, 1u },
+  { 0xC0AC0000B78Cull, 1087u, 1u },
+  { 0xC0DD0000AC01ull, 1088u, 1u },
+  { 0xD5580000B294ull, 1089u, 1u },
+  { 0xC7960000C544ull, 1090u, 1u },
+  { 0xC5440000C694ull, 1091u, 1u },
+  { 0xC9C00000B9CCull, 1092u, 1u },
+  { 0xB2F90000C2E0ull, 1093u, 1u },
+  { 0xC7740000C57Cull, 1094u, 1u },
+  { 0xC2B50000B2C8ull, 1095u, 1u },
+  { 0xC1380000C694ull, 1096u, 1u },
+  { 0xB4E40000C774ull, 1097u, 1u },
+  { 0xC5C80000C5B4ull, 1098u, 1u },
+  { 0xC73C0000B85Cull, 1099u, 1u },
+  { 0xD5580000C9C0ull, 1100u, 1u },
+  { 0xD5740000C694ull, 1101u, 1u },
+  { 0xB2940000B370ull, 1102u, 1u },
+  { 0xC7880000C5C8ull, 1103u, 1u },
+  { 0xBAA80000B974ull, 1104u, 1u },
+  { 0xAC700000C57Cull, 1105u, 1u },
+  { 0xADF80000B807ull, 1106u, 1u },
+  { 0xC5580000C5B4ull, 1107u, 1u },
+  { 0xADF80000B7ECull, 1108u, 1u },
+  { 0xB77C0000ACE0ull, 1109u, 1u },
+  { 0xC5D00000AC8Cull, 1110u, 1u },
+  { 0xC5D00000C11Cull, 1111u, 1u },
+  { 0xC6B00000B9ACull, 1112u, 1u },
+  { 0xC5EC0000AE30ull, 1113u, 1u },
+  { 0xD55C0000D14Cull, 1114u, 1u },
+  { 0xB2E40000ACE0ull, 1115u, 1u },
+  { 0xB4E40000C5B4ull, 1116u, 1u },
+  { 0xB9D00000C774ull, 1117u, 1u },
+  { 0xC5D00000C694ull, 1118u, 1u },
+  { 0xD5880000C5B4ull, 1119u, 1u },
+  { 0xB2C80000AE4Cull, 1120u, 1u },
+  { 0xD5440000C694ull, 1121u, 1u },
+  { 0xB2E40000BA74ull, 1122u, 1u },
+  { 0xC7740000C5D0ull, 1123u, 1u },
+  { 0xC5440000C774ull, 1124u, 1u },
+  { 0xD5580000ACE0ull, 1125u, 1u },
+  { 0xC5C40000B9C8ull, 1126u, 1u },
+  { 0xC7740000ADF8ull, 1127u, 1u },
+  { 0xD5580000B098ull, 1128u, 1u },
+  { 0xC5440000BB34ull, 1129u, 1u },
+  { 0xC5980000AE30ull, 1130u, 1u },
+  { 0xCE5C0000AD6Cull, 1131u, 1u },
+  { 0xACA00000C5B4ull, 1132u, 1u },
+  { 0xC7740000C9C0ull, 1133u, 1u },
+  { 0xB4E40000C744ull, 1134u, 1u },
+  { 0xC7880000B294ull, 1135u, 1u },
+  { 0xC88B0000C544ull, 1136u, 1u },
+  { 0xB2940000C544ull, 1137u, 1u },
+  { 0xC77C0000C774ull, 1138u, 1u },
+  { 0xC54C0000C558ull, 1139u, 1u },
+  { 0xC6940000ADF8ull, 1140u, 1u },
+  { 0xB78C0000B4E4ull, 1141u, 1u },
+  { 0xC1380000C0C1ull, 1142u, 1u },
+  { 0xADF80000B140ull, 1143u, 1u },
+  { 0xADF80000B4E4ull, 1144u, 1u },
+  { 0xBBF80000C548ull, 1145u, 1u },
+  { 0xB4E40000C740ull, 1146u, 1u },
+  { 0xC7900000B124ull, 1147u, 1u },
+  { 0xB9740000ACA0ull, 1148u, 1u },
+  { 0xC5440000BC84ull, 1149u, 1u },
+  { 0xBC840000C9C0ull, 1150u, 1u },
+  { 0xC0AC0000B791ull, 1151u, 1u },
+  { 0xAE4C0000C9C0ull, 1152u, 1u },
+  { 0xB9D00000D558ull, 1153u, 1u },
+  { 0xADF80000B798ull, 1154u, 1u },
+  { 0xC7880000C5B4ull, 1155u, 1u },
+  { 0xC6940000C788ull, 1156u, 1u },
+  { 0xB9AC0000AC00ull, 1157u, 1u },
+  { 0xC9C00000AE08ull, 1158u, 1u },
+  { 0xAD1C0000CC2Eull, 1159u, 1u },
+  { 0xBAA80000B450ull, 1160u, 1u },
+  { 0xC5B40000C11Cull, 1161u, 1u },
+  { 0xC7740000AC70ull, 1162u, 1u },
+  { 0xC5B40000B514ull, 1163u, 1u },
+  { 0xC7880000C744ull, 1164u, 1u },
+  { 0xC5440000BE60ull, 1165u, 1u },
+  { 0xC6940000C774ull, 1166u, 1u },
+  { 0xC7880000B2E4ull, 1167u, 1u },
+  { 0xBB500000B77Cull, 1168u, 1u },
+  { 0xD5690000B2C8ull, 1169u, 1u },
+  { 0xC2DC0000AC04ull, 1170u, 1u },
+  { 0xBB380000C81Cull, 1171u, 1u },
+  { 0xC73C0000BA74ull, 1172u, 1u },
+  { 0xB0980000C694ull, 1173u, 1u },
+  { 0xC5D00000C544ull, 1174u, 1u },
+  { 0xB9AC0000B97Cull, 1175u, 1u },
+  { 0xB2040000AD6Cull, 1176u, 1u },
+  { 0xC9C00000C544ull, 1177u, 1u },
+  { 0xD55C0000B2E4ull, 1178u, 1u },
+  { 0xB1240000C694ull, 1179u, 1u },
+  { 0xACA00000C9C0ull, 1180u, 1u },
+  { 0xB3C40000C640ull, 1181u, 1u },
+  { 0xADF80000AC83ull, 1182u, 1u },
+  { 0xB3CC0000C544ull, 1183u, 1u },
+  { 0xB9AC0000ACE0ull, 1184u, 1u },
+  { 0xC8150000B9D0ull, 1185u, 1u },
+  { 0xC5C60000C5B4ull, 1186u, 1u },
+  { 0xC2E00000C774ull, 1187u, 1u },
+  { 0xB2E40000C2DCull, 1188u, 1u },
+  { 0xACE00000C544ull, 1189u, 1u },
+  { 0xC54C0000C544ull, 1190u, 1u },
+  { 0xAC190000C740ull, 1191u, 1u },
+  { 0xC7740000D558ull, 1192u, 1u },
+  { 0xC8040000C5D0ull, 1193u, 1u },
+  { 0xAC830000B3C4ull, 1194u, 1u },
+  { 0xB3000000D55Cull, 1195u, 1u },
+  { 0xC7900000AE30ull, 1196u, 1u },
+  { 0xD5580000BA74ull, 1197u, 1u },
+  { 0xC6940000D574ull, 1198u, 1u },
+  { 0xC57C0000C788ull, 1199u, 1u },
+  { 0xC7400000B370ull, 1200u, 1u },
+  { 0xC1200000C0DDull, 1201u, 1u },
+  { 0xB2E40000C74Cull, 1202u, 1u },
+  { 0xAC8C0000B9D0ull, 1203u, 1u },
+  { 0xB9D00000D574ull, 1204u, 1u },
+  { 0xC5EC0000C790ull, 1205u, 1u },
+  { 0xB1080000D76Cull, 1206u, 1u },
+  { 0xC9C00000B098ull, 1207u, 1u },
+  { 0xAC000000C694ull, 1208u, 1u },
+  { 0xC6940000C5B4ull, 1209u, 1u },
+  { 0xC7440000B9C8ull, 1210u, 1u },
+  { 0xC54C0000ACA0ull, 1211u, 1u },
+  { 0xAE300000B2E4ull, 1212u, 1u },
+  { 0xB2E40000C788ull, 1213u, 1u },
+  { 0xB2940000C9C0ull, 1214u, 1u },
+  { 0xB3000000B85Cull, 1215u, 1u },
+  { 0xB0A80000C790ull, 1216u, 1u },
+  { 0xC18C0000B9ACull, 1217u, 1u },
+  { 0xCC980000C74Cull, 1218u, 1u },
+  { 0xC7740000B984ull, 1219u, 1u },
+  { 0xC5440000B2CCull, 1220u, 1u },
+  { 0xB0980000AC00ull, 1221u, 1u },
+  { 0xC5C60000B2E4ull, 1222u, 1u },
+  { 0xC9C00000AC00ull, 1223u, 1u },
+  { 0xC2180000C220ull, 1224u, 1u },
+  { 0xC9000000BE44ull, 1225u, 1u },
+  { 0xC7850000B2C8ull, 1226u, 1u },
+  { 0xC7440000C788ull, 1227u, 1u },
+  { 0xB2040000AD70ull, 1228u, 1u },
+  { 0xAE300000B97Cull, 1229u, 1u },
+  { 0xAE300000AC00ull, 1230u, 1u },
+  { 0xAC000000C544ull, 1231u, 1u },
+  { 0xBA380000B9ACull, 1232u, 1u },
+  { 0xD6580000C790ull, 1233u, 1u },
+  { 0xB9CC0000B098ull, 1234u, 1u },
+  { 0xC9C00000D558ull, 1235u, 1u },
+  { 0xB2E40000B9ACull, 1236u, 1u },
+  { 0xC5600000B4E4ull, 1237u, 1u },
+  { 0xC5440000C11Cull, 1238u, 1u },
+  { 0xB9C80000C74Cull, 1239u, 1u },
+  { 0xADF80000B7ACull, 1240u, 1u },
+  { 0xC7740000D574ull, 1241u, 1u },
+  { 0xB3700000C694ull, 1242u, 1u },
+  { 0xC7900000B294ull, 1243u, 1u },
+  { 0xAE300000C5B5ull, 1244u, 1u },
+  { 0xB2940000AC70ull, 1245u, 1u },
+  { 0xC6940000C0ACull, 1246u, 1u },
+  { 0xC5BC0000AD74ull, 1247u, 1u },
+  { 0xBD800000D130ull, 1248u, 1u },
+  { 0xB0B40000AC00ull, 1249u, 1u },
+  { 0xADF80000B9ACull, 1250u, 1u },
+  { 0xC7740000B2E4ull, 1251u, 1u },
+  { 0xADF80000B7F0ull, 1252u, 1u },
+  { 0xC11C0000ADF8ull, 1253u, 1u },
+  { 0xB8070000AC8Cull, 1254u, 1u },
+  { 0xBAA80000B4E0ull, 1255u, 1u },
+  { 0xC6080000C694ull, 1256u, 1u },
+  { 0xC7400000C624ull, 1257u, 1u },
+  { 0xC6240000B298ull, 1258u, 1u },
+  { 0xC5440000C9C1ull, 1259u, 1u },
+  { 0xC9C40000C9DCull, 1260u, 1u },
+  { 0xACE00000C774ull, 1261u, 1u },
+  { 0xC5B40000C54Aull, 1262u, 1u },
+  { 0xC54A0000C544ull, 1263u, 1u },
+  { 0xB78C0000C774ull, 1264u, 1u },
+  { 0xC5480000B155ull, 1265u, 1u },
+  { 0xAC190000C544ull, 1266u, 1u },
+  { 0xB2940000ADF8ull, 1267u, 1u },
+  { 0xD5740000C544ull, 1268u, 1u },
+  { 0xC7A00000AE50ull, 1269u, 1u },
+  { 0xAC000000C11Cull, 1270u, 1u },
+  { 0xAC000000C790ull, 1271u, 1u },
+  { 0xC6940000C544ull, 1272u, 1u },
+  { 0xBAB00000B77Cull, 1273u, 1u },
+  { 0xC2E00000C758ull, 1274u, 1u },
+  { 0xADF80000B9CCull, 1275u, 1u },
+  { 0xBB540000AC00ull, 1276u, 1u },
+  { 0xB2C80000B77Cull, 1277u, 1u },
+  { 0xAC700000AE30ull, 1278u, 1u },
+  { 0xB2C80000AC00ull, 1279u, 1u },
+  { 0xC6940000C790ull, 1280u, 1u },
+  { 0xAC000000C9C0ull, 1281u, 1u },
+  { 0xACE00000ADF8ull, 1282u, 1u },
+  { 0xB4100000C5B4ull, 1283u, 1u },
+  { 0xC5440000B9C8ull, 1284u, 1u },
+  { 0xC7400000C598ull, 1285u, 1u },
+  { 0xD5740000C57Cull, 1286u, 1u },
+  { 0xB3D90000C548ull, 1287u, 1u },
+  { 0xC2F60000C5B4ull, 1288u, 1u },
+  { 0xAD6C0000B4E4ull, 1289u, 1u },
+  { 0xC0AC0000C2E4ull, 1290u, 1u },
+  { 0xB3700000C0DDull, 1291u, 1u },
+  { 0xC0DD0000B2D8ull, 1292u, 1u },
+  { 0xBB3C0000B860ull, 1293u, 1u },
+  { 0xB4180000B294ull, 1294u, 1u },
+  { 0xC7880000C73Cull, 1295u, 1u },
+  { 0xC7740000C0C1ull, 1296u, 1u },
+  { 0xAC700000B77Cull, 1297u, 1u },
+  { 0xB3C40000C6C0ull, 1298u, 1u },
+  { 0xC8C40000C1A1ull, 1299u, 1u },
+  { 0xC5B40000AC00ull, 1300u, 1u },
+  { 0xC6940000C54Cull, 1301u, 1u },
+  { 0xC8FC0000C138ull, 1302u, 1u },
+  { 0xAC830000C774ull, 1303u, 1u },
+  { 0xAC830000C740ull, 1304u, 1u },
+  { 0xAC010000D588ull, 1305u, 1u },
+  { 0xD5740000C11Cull, 1306u, 1u },
+  { 0xB85C0000C544ull, 1307u, 1u },
+  { 0xC9C00000C788ull, 1308u, 1u },
+  { 0xB2E40000B294ull, 1309u, 1u },
+  { 0xC6940000B108ull, 1310u, 1u },
+  { 0xC7740000C8E0ull, 1311u, 1u },
+  { 0xC54A0000C558ull, 1312u, 1u },
+  { 0xC6940000C8FDull, 1313u, 1u },
+  { 0xB2E40000B54Cull, 1314u, 1u },
+  { 0xACE00000C5B4ull, 1315u, 1u },
+  { 0xB2F90000C5F0ull, 1316u, 1u },
+  { 0xC54A0000B294ull, 1317u, 1u },
+  { 0xC11C0000C774ull, 1318u, 1u },
+  { 0xC57C0000AE30ull, 1319u, 1u },
+  { 0xC7900000AC00ull, 1320u, 1u },
+  { 0xC7740000C5B4ull, 1321u, 1u },
+  { 0xC6940000AC74ull, 1322u, 1u },
+  { 0xBB500000D558ull, 1323u, 1u },
+  { 0xAD700000AC00ull, 1324u, 1u },
+  { 0xD5880000C796ull, 1325u, 1u },
+  { 0xC7740000C720ull, 1326u, 1u },
+  { 0xD5580000AC8Cull, 1327u, 1u },
+  { 0xB9AC0000C5D0ull, 1328u, 1u },
+  { 0xC8000000D76Cull, 1329u, 1u },
+  { 0xC7440000AC70ull, 1330u, 1u },
+  { 0xC7900000C2E0ull, 1331u, 1u },
+  { 0xAC000000C774ull, 1332u, 1u },
+  { 0xC5440000B4E4ull, 1333u, 1u },
+  { 0xBC290000BC95ull, 1334u, 1u },
+  { 0xACE00000B9D9ull, 1335u, 1u },
+  { 0xC77C0000C5B4ull, 1336u, 1u },
+  { 0xC7740000AC83ull, 1337u, 1u },
+  { 0xC7440000C544ull, 1338u, 1u },
+  { 0xCC3E0000C544ull, 1339u, 1u },
+  { 0xAE4C0000C694ull, 1340u, 1u },
+  { 0xC6940000C800ull, 1341u, 1u },
+  { 0xB2E40000B9C8ull, 1342u, 1u },
+  { 0xB9CC0000B4E4ull, 1343u, 1u },
+  { 0xC7A00000C2DCull, 1344u, 1u },
+  { 0xACF30000C5D0ull, 1345u, 1u },
+  { 0xC7440000ADF8ull, 1346u, 1u },
+  { 0xAC8C0000C544ull, 1347u, 1u },
+  { 0xAC010000D558ull, 1348u, 1u },
+  { 0xC7900000B97Cull, 1349u, 1u },
+  { 0xC8150000B3C4ull, 1350u, 1u },
+  { 0xC73C0000B2C8ull, 1351u, 1u },
+  { 0xB2E40000AE30ull, 1352u, 1u },
+  { 0xB1880000B4E4ull, 1353u, 1u },
+  { 0xC5D00000C774ull, 1354u, 1u },
+  { 0xC5B40000BA38ull, 1355u, 1u },
+  { 0xBA380000B2C8ull, 1356u, 1u },
+  { 0xC88B0000ACA0ull, 1357u, 1u },
+  { 0xAC780000B85Cull, 1358u, 1u },
+  { 0xB3C40000C544ull, 1359u, 1u },
+  { 0xACE00000C694ull, 1360u, 1u },
+  { 0xC9180000C694ull, 1361u, 1u },
+  { 0xB97C0000C5B4ull, 1362u, 1u },
+  { 0xAC000000C871ull, 1363u, 1u },
+  { 0xC5440000AC00ull, 1364u, 1u },
+  { 0xAC8C0000C694ull, 1365u, 1u },
+  { 0xC5440000AE30ull, 1366u, 1u },
+  { 0xBCD10000C6D0ull, 1367u, 1u },
+  { 0xD5740000C918ull, 1368u, 1u },
+  { 0xC7880000ACA0ull, 1369u, 1u },
+  { 0xB41C0000B2E4ull, 1370u, 1u },
+  { 0xC7740000B294ull, 1371u, 1u },
+  { 0xC7900000ACE0ull, 1372u, 1u },
+  { 0xC5440000B0B4ull, 1373u, 1u },
+  { 0xBCF40000B2E4ull, 1374u, 1u },
+  { 0xC6940000C6D0ull, 1375u, 1u },
+  { 0xC8FD0000C774ull, 1376u, 1u },
+  { 0xAC000000C838ull, 1377u, 1u },
+  { 0xC2E00000B4E4ull, 1378u, 1u },
+  { 0xB85C0000ADF8ull, 1379u, 1u },
+  { 0xB2940000B2E4ull, 1380u, 1u },
+  { 0xC7900000B9ACull, 1381u, 1u },
+  { 0xBABB0000D558ull, 1382u, 1u },
+  { 0xB9D00000D588ull, 1383u, 1u },
+  { 0xAC830000B4E4ull, 1384u, 1u },
+  { 0xB9CC0000C788ull, 1385u, 1u },
+  { 0xC2EC0000C7A5ull, 1386u, 1u },
+  { 0xC7740000C544ull, 1387u, 1u },
+  { 0xB7980000B97Cull, 1388u, 1u },
+  { 0xAC000000ADF8ull, 1389u, 1u },
+  { 0xC5B40000C65Cull, 1390u, 1u },
+  { 0xBB340000C2A8ull, 1391u, 1u },
+  { 0xD55C0000D558ull, 1392u, 1u },
+  { 0xC5B40000B5BBull, 1393u, 1u },
+  { 0xB5BB0000AC8Cull, 1394u, 1u },
+  { 0xADF80000B7FCull, 1395u, 1u },
+  { 0xAC8C0000C788ull, 1396u, 1u },
+  { 0xC81C0000AC00ull, 1397u, 1u },
+  { 0xC7740000C81Cull, 1398u, 1u },
+  { 0xB1240000AC00ull, 1399u, 1u },
+  { 0xC8000000C6B0ull, 1400u, 1u },
+  { 0xAC8C0000B2E4ull, 1401u, 1u },
+  { 0xB0980000B3C4ull, 1402u, 1u },
+  { 0xC6940000B2F9ull, 1403u, 1u },
+  { 0xC7400000C544ull, 1404u, 1u },
+  { 0xC88B0000C740ull, 1405u, 1u },
+  { 0xB0980000B294ull, 1406u, 1u },
+  { 0xAC190000C774ull, 1407u, 1u },
+  { 0xAC8C0000C5C6ull, 1408u, 1u },
+  { 0xCC2E0000C544ull, 1409u, 1u },
+  { 0xB9D00000C544ull, 1410u, 1u },
+  { 0xC5480000B3FCull, 1411u, 1u },
+  { 0xAE300000C11Cull, 1412u, 1u },
+  { 0xC7040000D574ull, 1413u, 1u },
+  { 0xD5740000D574ull, 1414u, 1u },
+  { 0xC9C00000C5C4ull, 1415u, 1u },
+  { 0xBC140000B85Cull, 1416u, 1u },
+  { 0xB85C0000AC00ull, 1417u, 1u },
+  { 0xB3700000C54Cull, 1418u, 1u },
+  { 0xB9AC0000C788ull, 1419u, 1u },
+  { 0xC7880000C2B5ull, 1420u, 1u },
+  { 0xC5B40000C544ull, 1421u, 1u },
+  { 0xC5BC0000B9C8ull, 1422u, 1u },
+  { 0xC81C0000BC1Cull, 1423u, 1u },
+  { 0xC7880000C9C0ull, 1424u, 1u },
+  { 0xAC810000B2C8ull, 1425u, 1u },
+  { 0xB2E40000C5B4ull, 1426u, 1u },
+  { 0xB9AC0000B294ull, 1427u, 1u },
+  { 0xC2E00000C744ull, 1428u, 1u },
+  { 0xC7440000C790ull, 1429u, 1u },
+  { 0xADF80000AC78ull, 1430u, 1u },
+  { 0xB54C0000BB38ull, 1431u, 1u },
+  { 0xB3000000D574ull, 1432u, 1u },
+  { 0xC9D10000C5D0ull, 1433u, 1u },
+  { 0xC9C00000C77Cull, 1434u, 1u },
+  { 0xB8070000C9C0ull, 1435u, 1u },
+  { 0xB9CC0000C57Dull, 1436u, 1u },
+  { 0xC8000000AE30ull, 1437u, 1u },
+  { 0xACE00000B9C8ull, 1438u, 1u },
+  { 0xB9C80000C6CCull, 1439u, 1u },
+  { 0xC6CC0000C694ull, 1440u, 1u },
+  { 0xB3FC0000C694ull, 1441u, 1u },
+  { 0xC6940000AC70ull, 1442u, 1u },
+  { 0xB9DE0000C544ull, 1443u, 1u },
+  { 0xC6400000ADF8ull, 1444u, 1u },
+  { 0xADF80000AC70ull, 1445u, 1u },
+  { 0xB9D00000C744ull, 1446u, 1u },
+  { 0xC5C60000B294ull, 1447u, 1u },
+  { 0xD5580000C138ull, 1448u, 1u },
+  { 0xB7EC0000B2C8ull, 1449u, 1u },
+  { 0xAC000000ACE0ull, 1450u, 1u },
+  { 0xB9CC0000D588ull, 1451u, 1u },
+  { 0xC7740000AC78ull, 1452u, 1u },
+  { 0xC7740000C774ull, 1453u, 1u },
+  { 0xC7740000BBF8ull, 1454u, 1u },
+  { 0xC7740000BD10ull, 1455u, 1u },
+  { 0xBD100000C544ull, 1456u, 1u },
+  { 0xB3700000C544ull, 1457u, 1u },
+  { 0xC0C10000C5D0ull, 1458u, 1u },
+  { 0xC5D00000C788ull, 1459u, 1u },
+  { 0xACE00000C788ull, 1460u, 1u },
+  { 0xC7880000ACE0ull, 1461u, 1u },
+  { 0xC8080000B300ull, 1462u, 1u },
+  { 0xC57C0000B2F9ull, 1463u, 1u },
+  { 0xB7980000B3C4ull, 1464u, 1u },
+  { 0xB3C40000B300ull, 1465u, 1u },
+  { 0xD55C0000B9D0ull, 1466u, 1u },
+  { 0xB9D00000C740ull, 1467u, 1u },
+  { 0xAC000000AC08ull, 1468u, 1u },
+  { 0xAC080000C54Aull, 1469u, 1u },
+  { 0xC5480000D574ull, 1470u, 1u },
+  { 0xAC830000C744ull, 1471u, 1u },
+  { 0xC7440000C5ECull, 1472u, 1u },
+  { 0xAC100000C0ACull, 1473u, 1u },
+  { 0xC5B40000B54Cull, 1474u, 1u },
+  { 0xB0980000B97Cull, 1475u, 1u },
+  { 0xC7880000C796ull, 1476u, 1u },
+  { 0xC5440000C800ull, 1477u, 1u },
+  { 0xAC000000BD10ull, 1478u, 1u },
+  { 0xBD100000C694ull, 1479u, 1u },
+  { 0xC54A0000C744ull, 1480u, 1u },
+  { 0xC6440000C804ull, 1481u, 1u },
+  { 0xC5480000C5D0ull, 1482u, 1u },
+  { 0xB2E40000C0ACull, 1483u, 1u },
+  { 0xD55C0000BC88ull, 1484u, 1u },
+  { 0xB3000000CCB4ull, 1485u, 1u },
+  { 0xAC010000D574ull, 1486u, 1u },
+  { 0xD63C0000C790ull, 1487u, 1u },
+  { 0xB2940000B9D0ull, 1488u, 1u },
+  { 0xC7740000B9ACull, 1489u, 1u },
+  { 0xAE500000B9CCull, 1490u, 1u },
+  { 0xC2EB0000C5B4ull, 1491u, 1u },
+  { 0xC6940000D55Cull, 1492u, 1u },
+  { 0xD5740000C774ull, 1493u, 1u },
+  { 0xC5440000B294ull, 1494u, 1u },
+  { 0xB2940000B108ull, 1495u, 1u },
+  { 0xC0C80000B85Cull, 1496u, 1u },
+  { 0xC6540000C5B4ull, 1497u, 1u },
+  { 0xB3C40000AC00ull, 1498u, 1u },
+  { 0xAE300000C5D0ull, 1499u, 1u },
+  { 0xC6D00000D558ull, 1500u, 1u },
+  { 0xC6940000B3C4ull, 1501u, 1u },
+  { 0xC6940000BAA8ull, 1502u, 1u },
+  { 0xC54C0000C9C0ull, 1503u, 1u },
+  { 0xBC160000C5D0ull, 1504u, 1u },
+  { 0xC7880000B098ull, 1505u, 1u },
+  { 0xD5580000C8E0ull, 1506u, 1u },
+  { 0xC8E00000D588ull, 1507u, 1u },
+  { 0xD5880000B294ull, 1508u, 1u },
+  { 0xC7740000C788ull, 1509u, 1u },
+  { 0xC6940000AC16ull, 1510u, 1u },
+  { 0xC11C0000AC83ull, 1511u, 1u },
+  { 0xC7740000B098ull, 1512u, 1u },
+  { 0xC9110000C5D0ull, 1513u, 1u },
+  { 0xC6940000B9C8ull, 1514u, 1u },
+  { 0xC5B80000C81Cull, 1515u, 1u },
+  { 0xD5880000C9C0ull, 1516u, 1u },
+  { 0xBD240000C5B4ull, 1517u, 1u },
+  { 0xC11C0000C2DCull, 1518u, 1u },
+  { 0xB9C80000C9C0ull, 1519u, 1u },
+  { 0xC9C00000B9C9ull, 1520u, 1u },
+  { 0xC65C0000B0D0ull, 1521u, 1u },
+  { 0xC5C40000CCADull, 1522u, 1u },
+  { 0xC6240000B798ull, 1523u, 1u },
+  { 0xB2E40000B824ull, 1524u, 1u },
+  { 0xC6940000C81Cull, 1525u, 1u },
+  { 0xB2C80000C9C0ull, 1526u, 1u },
+  { 0xBA740000BCF4ull, 1527u, 1u },
+  { 0xAC000000C788ull, 1528u, 1u },
+  { 0xB2940000B204ull, 1529u, 1u },
+  { 0xBCF40000C5ECull, 1530u, 1u },
+  { 0xC5EC0000B7ECull, 1531u, 1u },
+  { 0xC8040000D788ull, 1532u, 1u },
+  { 0xC5C60000C9C0ull, 1533u, 1u },
+  { 0xB4E40000ADF8ull, 1534u, 1u },
+  { 0xB9D00000B85Cull, 1535u, 1u },
+  { 0xC5EC0000BCF4ull, 1536u, 1u },
+  { 0xC8700000AE08ull, 1537u, 1u },
+  { 0xBCF40000C138ull, 1538u, 1u },
+  { 0xC11C0000B85Cull, 1539u, 1u },
+  { 0xB85C0000C548ull, 1540u, 1u },
+  { 0xB7910000D574ull, 1541u, 1u },
+  { 0xC2F60000C740ull, 1542u, 1u },
+  { 0xBFD00000C774ull, 1543u, 1u },
+  { 0xD6550000C2E4ull, 1544u, 1u },
+  { 0xC6940000C8C4ull, 1545u, 1u },
+  { 0xAE000000C384ull, 1546u, 1u },
+  { 0xB2940000D588ull, 1547u, 1u },
+  { 0xB0980000C758ull, 1548u, 1u },
+  { 0xC6940000C0DDull, 1549u, 1u },
+  { 0xB7EC0000C9C0ull, 1550u, 1u },
+  { 0xC9C00000B418ull, 1551u, 1u },
+  { 0xBA740000C544ull, 1552u, 1u },
+  { 0xB9C80000B3C4ull, 1553u, 1u },
+  { 0xC8040000D654ull, 1554u, 1u },
+  { 0xC5D00000B3C4ull, 1555u, 1u },
+  { 0xB3C40000AC83ull, 1556u, 1u },
+  { 0xCC980000B7FCull, 1557u, 1u },
+  { 0xCD5C0000ACE0ull, 1558u, 1u },
+  { 0xC7580000B9D0ull, 1559u, 1u },
+  { 0xAC740000AC00ull, 1560u, 1u },
+  { 0xC6940000C5C6ull, 1561u, 1u },
+  { 0xACE00000AC83ull, 1562u, 1u },
+  { 0xC7740000BC88ull, 1563u, 1u },
+  { 0xB9CC0000D574ull, 1564u, 1u },
+  { 0xAD6C0000C57Cull, 1565u, 1u },
+  { 0xC5C60000C5C8ull, 1566u, 1u },
+  { 0xC5B40000ADF8ull, 1567u, 1u },
+  { 0xC54C0000C796ull, 1568u, 1u },
+  { 0xBD840000BA85ull, 1569u, 1u },
+  { 0xAC710000C815ull, 1570u, 1u },
+  { 0xC8150000BCF4ull, 1571u, 1u },
+  { 0xBCF40000C790ull, 1572u, 1u },
+  { 0xC5440000CE68ull, 1573u, 1u },
+  { 0xC6940000B300ull, 1574u, 1u },
+  { 0xC7740000B2F9ull, 1575u, 1u },
+  { 0xC7880000B124ull, 1576u, 1u },
+  { 0xB1240000ADF8ull, 1577u, 1u },
+  { 0xB4E40000C758ull, 1578u, 1u },
+  { 0xBB540000B370ull, 1579u, 1u },
+  { 0xC5440000D558ull, 1580u, 1u },
+  { 0xB2940000CC3Eull, 1581u, 1u },
+  { 0xAC000000D544ull, 1582u, 1u },
+  { 0xC5D00000ADF8ull, 1583u, 1u },
+  { 0xC5C60000C796ull, 1584u, 1u },
+  { 0xACE00000AE30ull, 1585u, 1u },
+  { 0xAE300000BD84ull, 1586u, 1u },
+  { 0xBABB0000D574ull, 1587u, 1u },
+  { 0xAC8C0000AC00ull, 1588u, 1u },
+  { 0xBD840000C774ull, 1589u, 1u },
+  { 0xB9CC0000C694ull, 1590u, 1u },
+  { 0xAC8C0000D558ull, 1591u, 1u },
+  { 0xD5740000BD10ull, 1592u, 1u },
+  { 0xBC240000C5D0ull, 1593u, 1u },
+  { 0xC5D00000BBF8ull, 1594u, 1u },
+  { 0xC7980000BABBull, 1595u, 1u },
+  { 0xC5490000C544ull, 1596u, 1u },
+  { 0xAC190000B124ull, 1597u, 1u },
+  { 0xAC000000AC8Cull, 1598u, 1u },
+  { 0xB4E40000C5C8ull, 1599u, 1u },
+  { 0xC6940000B9CCull, 1600u, 1u },
+  { 0xB0980000C11Cull, 1601u, 1u },
+  { 0xC9C40000C815ull, 1602u, 1u },
+  { 0xC9C00000BC29ull, 1603u, 1u },
+  { 0xBC950000C744ull, 1604u, 1u },
+  { 0xD5580000B824ull, 1605u, 1u },
+  { 0xBA390000C744ull, 1606u, 1u },
+  { 0xC8700000C2ECull, 1607u, 1u },
+  { 0xC2EC0000D574ull, 1608u, 1u },
+  { 0xB5300000B77Cull, 1609u, 1u },
+  { 0xC5C80000B294ull, 1610u, 1u },
+  { 0xAE4C0000C598ull, 1611u, 1u },
+  { 0xD76C0000AC00ull, 1612u, 1u },
+  { 0xAE300000C694ull, 1613u, 1u },
+  { 0xB4200000AE4Cull, 1614u, 1u },
+  { 0xC2200000C744ull, 1615u, 1u },
+  { 0xBB380000C744ull, 1616u, 1u },
+  { 0xC9C00000C5B4ull, 1617u, 1u },
+  { 0xC5B40000B3C4ull, 1618u, 1u },
+  { 0xC7400000C0DDull, 1619u, 1u },
+  { 0xAC000000B054ull, 1620u, 1u },
+  { 0xB8080000C774ull, 1621u, 1u },
+  { 0xC74C0000C5D0ull, 1622u, 1u },
+  { 0xACE00000B4E4ull, 1623u, 1u },
+  { 0xB4E40000ACE0ull, 1624u, 1u },
+  { 0xB7AC0000C5B4ull, 1625u, 1u },
+  { 0xC5B40000CC28ull, 1626u, 1u },
+  { 0xC7740000AC00ull, 1627u, 1u },
+  { 0xD5580000C790ull, 1628u, 1u },
+  { 0xB2C80000C796ull, 1629u, 1u },
+  { 0xB97C0000C8FDull, 1630u, 1u },
+  { 0xC8FD0000C5C8ull, 1631u, 1u },
+  { 0xD55C0000C788ull, 1632u, 1u },
+  { 0xC9C00000C815ull, 1633u, 1u },
+  { 0xC8150000C2E0ull, 1634u, 1u },
+  { 0xC6940000D558ull, 1635u, 1u },
+  { 0xAE300000D68Cull, 1636u, 1u },
+  { 0xB97C0000ADF8ull, 1637u, 1u },
+  { 0xAC000000B3C4ull, 1638u, 1u },
+  { 0xC6400000C918ull, 1639u, 1u },
+  { 0xC55E0000C5D0ull, 1640u, 1u },
+  { 0xBB500000B4E0ull, 1641u, 1u },
+  { 0xC6240000B294ull, 1642u, 1u },
+  { 0xB8070000B2E4ull, 1643u, 1u },
+  { 0xD14C0000B2C8ull, 1644u, 1u },
+  { 0xB3C40000C694ull, 1645u, 1u },
+  { 0xBBFF0000C5B4ull, 1646u, 1u },
+  { 0xC18D0000C5D0ull, 1647u, 1u },
+  { 0xC2DC0000B9CCull, 1648u, 1u },
+  { 0xD5600000AC8Cull, 1649u, 1u },
+  { 0xAE300000B294ull, 1650u, 1u },
+  { 0xB2940000C5B8ull, 1651u, 1u },
+  { 0xC5B80000B2C8ull, 1652u, 1u },
+  { 0xAC080000AC8Cull, 1653u, 1u },
+  { 0xD5580000B8E8ull, 1654u, 1u },
+  { 0xAC000000B97Cull, 1655u, 1u },
+  { 0xC74C0000C744ull, 1656u, 1u },
+  { 0xC81C0000B294ull, 1657u, 1u },
+  { 0xC5C60000B124ull, 1658u, 1u },
+  { 0xB97C0000C0DDull, 1659u, 1u },
+  { 0xC9C00000BB50ull, 1660u, 1u },
+  { 0xC0C10000D669ull, 1661u, 1u },
+  { 0xD6540000B97Cull, 1662u, 1u },
+  { 0xBC880000C9F8ull, 1663u, 1u },
+  { 0xD5600000AE4Cull, 1664u, 1u },
+  { 0xC9110000C774ull, 1665u, 1u },
+  { 0xC5B40000C774ull, 1666u, 1u },
+  { 0xAC700000C9D3ull, 1667u, 1u },
+  { 0xC9D30000B9D0ull, 1668u, 1u },
+  { 0xC2E40000C740ull, 1669u, 1u },
+  { 0xC7400000BC1Bull, 1670u, 1u },
+  { 0xADF80000CE58ull, 1671u, 1u },
+  { 0xC7440000AE4Cull, 1672u, 1u },
+  { 0xAE4C0000C5B4ull, 1673u, 1u },
+  { 0xCC280000C5D0ull, 1674u, 1u },
+  { 0xB9740000C9C0ull, 1675u, 1u },
+  { 0xAC000000AE4Cull, 1676u, 1u },
+  { 0xB8600000C774ull, 1677u, 1u },
+  { 0xD5590000AD50ull, 1678u, 1u },
+  { 0xACBD0000CC30ull, 1679u, 1u },
+  { 0xC2280000C744ull, 1680u, 1u },
+  { 0xD5880000B2E4ull, 1681u, 1u },
+  { 0xB9CE0000C544ull, 1682u, 1u },
+  { 0xB5A80000C5B4ull, 1683u, 1u },
+  { 0xC7440000B9D0ull, 1684u, 1u },
+  { 0xB2940000B9CCull, 1685u, 1u },
+  { 0xD6540000AC00ull, 1686u, 1u },
+  { 0xCC3E0000C558ull, 1687u, 1u },
+  { 0xD7880000C544ull, 1688u, 1u },
+  { 0xC7440000C138ull, 1689u, 1u },
+  { 0xB2C80000C5C8ull, 1690u, 1u },
+  { 0xB9C80000C774ull, 1691u, 1u },
+  { 0xB9AC0000BB34ull, 1692u, 1u },
+  { 0xC7440000B9CCull, 1693u, 1u },
+  { 0xB2940000C5BCull, 1694u, 1u },
+  { 0xC0AC0000C9C4ull, 1695u, 1u },
+  { 0xC6D00000C5D0ull, 1696u, 1u },
+  { 0xB2E40000BC14ull, 1697u, 1u },
+  { 0xB2E40000C790ull, 1698u, 1u },
+  { 0xAC000000B9CCull, 1699u, 1u },
+  { 0xC5F00000D558ull, 1700u, 1u },
+  { 0xBCF40000C774ull, 1701u, 1u },
+  { 0xB1780000B798ull, 1702u, 1u },
+  { 0xACC40000D68Dull, 1703u, 1u },
+  { 0xC5D00000B410ull, 1704u, 1u },
+  { 0xC7880000AC70ull, 1705u, 1u },
+  { 0xAC700000B4E0ull, 1706u, 1u },
+  { 0xC2E40000C744ull, 1707u, 1u },
+  { 0xC6940000B204ull, 1708u, 1u },
+  { 0xD06C0000B9ACull, 1709u, 1u },
+  { 0xB9AC0000C2A4ull, 1710u, 1u },
+  { 0xAC140000C5B4ull, 1711u, 1u },
+  { 0xC7740000ACE0ull, 1712u, 1u },
+  { 0xACE00000C0C1ull, 1713u, 1u },
+  { 0xC0C10000AD00ull, 1714u, 1u },
+  { 0xC77C0000D558ull, 1715u, 1u },
+  { 0xC0AC0000AC74ull, 1716u, 1u },
+  { 0xC8E00000C544ull, 1717u, 1u },
+  { 0xAC000000AC00ull, 1718u, 1u },
+  { 0xB2E40000C2E0ull, 1719u, 1u },
+  { 0xC7740000B188ull, 1720u, 1u },
+  { 0xC7400000D558ull, 1721u, 1u },
+  { 0xC7580000C0ACull, 1722u, 1u },
+  { 0xBC150000C0ACull, 1723u, 1u },
+  { 0xC0AC0000B2D8ull, 1724u, 1u },
+  { 0xB2D80000B098ull, 1725u, 1u },
+  { 0xB2940000B538ull, 1726u, 1u },
+  { 0xBCF40000B0B4ull, 1727u, 1u },
+  { 0xC7780000C0DDull, 1728u, 1u },
+  { 0xB2940000C815ull, 1729u, 1u },
+  { 0xACE00000D55Cull, 1730u, 1u },
+  { 0xC5580000B2E4ull, 1731u, 1u },
+  { 0xC5C80000B2E4ull, 1732u, 1u },
+  { 0xB2E40000ACF3ull, 1733u, 1u },
+  { 0xC5C60000C73Cull, 1734u, 1u },
+  { 0xB9AC0000C640ull, 1735u, 1u },
+  { 0xC7740000C0ACull, 1736u, 1u },
+  { 0xC9C00000C774ull, 1737u, 1u },
+  { 0xC7740000CABDull, 1738u, 1u },
+  { 0xCABD0000C73Cull, 1739u, 1u },
+  { 0xC11C0000B4E4ull, 1740u, 1u },
+  { 0xAD700000C694ull, 1741u, 1u },
+  { 0xAC190000AD70ull, 1742u, 1u },
+  { 0xB6110000AC19ull, 1743u, 1u },
+  { 0xC7400000AC00ull, 1744u, 1u },
+  { 0xAC000000B2A5ull, 1745u, 1u },
+  { 0xC5440000D574ull, 1746u, 1u },
+  { 0xB77C0000B3C4ull, 1747u, 1u },
+  { 0xC6C00000C9C1ull, 1748u, 1u },
+  { 0xC7440000BAA8ull, 1749u, 1u },
+  { 0xACA00000B124ull, 1750u, 1u },
+  { 0xC6B80000B9CCull, 1751u, 1u },
+  { 0xB0A80000D3B8ull, 1752u, 1u },
+  { 0xD76C0000B4E4ull, 1753u, 1u },
+  { 0xB8240000C788ull, 1754u, 1u },
+  { 0xC7740000C5C6ull, 1755u, 1u },
+  { 0xC5480000D558ull, 1756u, 1u },
+  { 0xC11C0000CE5Cull, 1757u, 1u },
+  { 0xBB380000C774ull, 1758u, 1u },
+  { 0xB2EC0000B77Cull, 1759u, 1u },
+  { 0xC7740000B7ECull, 1760u, 1u },
+  { 0xC2DC0000C544ull, 1761u, 1u },
+  { 0xC5440000C57Cull, 1762u, 1u },
+  { 0xC2F60000C5C8ull, 1763u, 1u },
+  { 0xD5740000D558ull, 1764u, 1u },
+  { 0xB0980000B9CCull, 1765u, 1u },
+  { 0xB2940000AC8Cull, 1766u, 1u },
+  { 0xB2E40000C88Bull, 1767u, 1u },
+  { 0xB7980000BAA8ull, 1768u, 1u },
+  { 0xAC700000B2C8ull, 1769u, 1u },
+  { 0xACE00000AC70ull, 1770u, 1u },
+  { 0xB2940000C8FDull, 1771u, 1u },
+  { 0xB1400000C11Dull, 1772u, 1u },
+  { 0xBAB00000B790ull, 1773u, 1u },
+  { 0xB7900000C5B4ull, 1774u, 1u },
+  { 0xC88B0000B124ull, 1775u, 1u },
+  { 0xC7400000C0ACull, 1776u, 1u },
+  { 0xB4E40000C5D0ull, 1777u, 1u },
+  { 0xACA00000B2E4ull, 1778u, 1u },
+  { 0xAD000000C2ECull, 1779u, 1u },
+  { 0xC7740000C624ull, 1780u, 1u },
+  { 0xB0980000BA74ull, 1781u, 1u },
+  { 0xB0C40000C0C8ull, 1782u, 1u },
+  { 0xC7780000AC04ull, 1783u, 1u },
+  { 0xBC880000B3C4ull, 1784u, 1u },
+  { 0xB7EC0000B294ull, 1785u, 1u },
+  { 0xD6550000C778ull, 1786u, 1u },
+  { 0xB2CC0000AC00ull, 1787u, 1u },
+  { 0xB77C0000B294ull, 1788u, 1u },
+  { 0xD5600000C544ull, 1789u, 1u },
+  { 0xC7740000B4E4ull, 1790u, 1u },
+  { 0xC57C0000C120ull, 1791u, 1u },
+  { 0xB1240000C758ull, 1792u, 1u },
+  { 0xC54A0000C9C0ull, 1793u, 1u },
+  { 0xAC000000C9C8ull, 1794u, 1u },
+  { 0xACE00000C9C0ull, 1795u, 1u },
+  { 0xC7580000D574ull, 1796u, 1u },
+  { 0xAC040000C5D0ull, 1797u, 1u },
+  { 0xC5B40000D560ull, 1798u, 1u },
+  { 0xD5600000C2F6ull, 1799u, 1u },
+  { 0xC5480000C804ull, 1800u, 1u },
+  { 0xB97C0000D558ull, 1801u, 1u },
+  { 0xD30C0000D2F0ull, 1802u, 1u },
+  { 0xB3700000ADF8ull, 1803u, 1u },
+  { 0xBC840000B824ull, 1804u, 1u },
+  { 0xC9C40000C2ECull, 1805u, 1u },
+  { 0xC7A50000B2D8ull, 1806u, 1u },
+  { 0xBB340000AE30ull, 1807u, 1u },
+  { 0xC54A0000B098ull, 1808u, 1u },
+  { 0xB77C0000BA74ull, 1809u, 1u },
+  { 0xC7880000B2E8ull, 1810u, 1u },
+  { 0xAC740000C744ull, 1811u, 1u },
+  { 0xBB340000C11Cull, 1812u, 1u },
+  { 0xB9D00000C778ull, 1813u, 1u },
+  { 0xC7780000C9C0ull, 1814u, 1u },
+  { 0xC9C80000BB38ull, 1815u, 1u },
+  { 0xD55C0000B370ull, 1816u, 1u },
+  { 0xC5C60000B098ull, 1817u, 1u },
+  { 0xC2EC0000C774ull, 1818u, 1u },
+  { 0xC74C0000C5D4ull, 1819u, 1u },
+  { 0xC5B40000C82Full, 1820u, 1u },
+  { 0xC82F0000BC24ull, 1821u, 1u },
+  { 0xC7440000BC14ull, 1822u, 1u },
+  { 0xC8040000D558ull, 1823u, 1u },
+  { 0xB0980000BCF4ull, 1824u, 1u },
+  { 0xC8850000C77Cull, 1825u, 1u },
+  { 0xCD5C0000ADFCull, 1826u, 1u },
+  { 0xADF80000B09Cull, 1827u, 1u },
+  { 0xB09C0000B0B4ull, 1828u, 1u },
+  { 0xB0B40000C548ull, 1829u, 1u },
+  { 0xC5480000C218ull, 1830u, 1u },
+  { 0xC2180000C774ull, 1831u, 1u },
+  { 0xC7740000B124ull, 1832u, 1u },
+  { 0xB1240000AC70ull, 1833u, 1u },
+  { 0xC57C0000C880ull, 1834u, 1u },
+  { 0xC8800000ADF8ull, 1835u, 1u },
+  { 0xB7980000C788ull, 1836u, 1u },
+  { 0xC65C0000B354ull, 1837u, 1u },
+  { 0xB3540000ADF8ull, 1838u, 1u },
+  { 0xACE00000C6B0ull, 1839u, 1u },
+  { 0xB9AC0000B2E4ull, 1840u, 1u },
+  { 0xB2E40000BB34ull, 1841u, 1u },
+  { 0xC2A80000D55Cull, 1842u, 1u },
+  { 0xB9CC0000C798ull, 1843u, 1u },
+  { 0xC7980000C5B4ull, 1844u, 1u },
+  { 0xAC8C0000D560ull, 1845u, 1u },
+  { 0xD5600000ADF8ull, 1846u, 1u },
+  { 0xADF80000B0E5ull, 1847u, 1u },
+  { 0xB0E50000C815ull, 1848u, 1u },
+  { 0xB9D00000ADF8ull, 1849u, 1u },
+  { 0xB7FC0000AC83ull, 1850u, 1u },
+  { 0xAC830000AC8Cull, 1851u, 1u },
+  { 0xB2940000D574ull, 1852u, 1u },
+  { 0xD5740000C5ECull, 1853u, 1u },
+  { 0xAE300000B10Cull, 1854u, 1u },
+  { 0xB10C0000C81Cull, 1855u, 1u },
+  { 0xAC000000B0A0ull, 1856u, 1u },
+  { 0xB0A00000C6B0ull, 1857u, 1u },
+  { 0xAC000000AC74ull, 1858u, 1u },
+  { 0xAC740000C804ull, 1859u, 1u },
+  { 0xC8040000C774ull, 1860u, 1u },
+  { 0xC81C0000C9C0ull, 1861u, 1u },
+  { 0xAE080000ADF8ull, 1862u, 1u },
+  { 0xADF80000AC8Cull, 1863u, 1u },
+  { 0xAC8C0000AC78ull, 1864u, 1u },
+  { 0xAC780000AC70ull, 1865u, 1u },
+  { 0xAC700000C544ull, 1866u, 1u },
+  { 0xB2C80000B124ull, 1867u, 1u },
+  { 0xAC000000C5C6ull, 1868u, 1u },
+  { 0xC5B40000B3FCull, 1869u, 1u },
+  { 0xB3FC0000C800ull, 1870u, 1u },
+  { 0xC6B00000B9B0ull, 1871u, 1u },
+  { 0xB9B00000C81Cull, 1872u, 1u },
+  { 0xC81C0000BABBull, 1873u, 1u },
+  { 0xBABB0000C88Bull, 1874u, 1u },
+  { 0xC5440000B2F9ull, 1875u, 1u },
+  { 0xB2E40000B978ull, 1876u, 1u },
+  { 0xB9780000B098ull, 1877u, 1u },
+  { 0xB0980000ADF8ull, 1878u, 1u },
+  { 0xB7F00000ADF8ull, 1879u, 1u },
+  { 0xADF80000AC74ull, 1880u, 1u },
+  { 0xAC740000B108ull, 1881u, 1u },
+  { 0xB1080000BB34ull, 1882u, 1u },
+  { 0xBB340000ADF8ull, 1883u, 1u },
+  { 0xB7980000C11Cull, 1884u, 1u },
+  { 0xC2DC0000C774ull, 1885u, 1u },
+  { 0xC7740000AC74ull, 1886u, 1u },
+  { 0xAC740000C774ull, 1887u, 1u },
+  { 0xC7740000B7F0ull, 1888u, 1u },
+  { 0xB7F00000B098ull, 1889u, 1u },
+  { 0xB3C40000BAA8ull, 1890u, 1u },
+  { 0xB4E00000B2F9ull, 1891u, 1u },
+  { 0xC2E00000AC70ull, 1892u, 1u },
+  { 0xAC700000C608ull, 1893u, 1u },
+  { 0xC2E00000C740ull, 1894u, 1u },
+  { 0xC5440000C88Bull, 1895u, 1u },
+  { 0xC6240000B54Cull, 1896u, 1u },
+  { 0xB54C0000B108ull, 1897u, 1u },
+  { 0xB1080000D558ull, 1898u, 1u },
+  { 0xB2940000D558ull, 1899u, 1u },
+  { 0xC5440000B0D0ull, 1900u, 1u },
+  { 0xB0D00000B098ull, 1901u, 1u },
+  { 0xB2C80000C57Cull, 1902u, 1u },
+  { 0xC57C0000C54Cull, 1903u, 1u },
+  { 0xC5440000AC19ull, 1904u, 1u },
+  { 0xC7740000C751ull, 1905u, 1u },
+  { 0xC7510000C774ull, 1906u, 1u },
+  { 0xC7740000AC8Cull, 1907u, 1u },
+  { 0xC6940000AD1Cull, 1908u, 1u },
+  { 0xC5440000C624ull, 1909u, 1u },
+  { 0xB2980000B9D0ull, 1910u, 1u },
+  { 0xC57C0000C904ull, 1911u, 1u },
+  { 0xC9040000B610ull, 1912u, 1u },
+  { 0xB6100000B110ull, 1913u, 1u },
+  { 0xB1100000B204ull, 1914u, 1u },
+  { 0xB2040000AC00ull, 1915u, 1u },
+  { 0xAC000000C5B4ull, 1916u, 1u },
+  { 0xC5B40000B5A4ull, 1917u, 1u },
+  { 0xB5A40000C544ull, 1918u, 1u },
+  { 0xC5440000C8FCull, 1919u, 1u },
+  { 0xC8FC0000B9D0ull, 1920u, 1u },
+  { 0xC9C10000C548ull, 1921u, 1u },
+  { 0xB3FC0000C9C4ull, 1922u, 1u },
+  { 0xC9DC0000BAA8ull, 1923u, 1u },
+  { 0xB4500000B9C8ull, 1924u, 1u },
+  { 0xB9C80000AC19ull, 1925u, 1u },
+  { 0xC7400000C5ECull, 1926u, 1u },
+  { 0xC11C0000C5B4ull, 1927u, 1u },
+  { 0xADF80000B294ull, 1928u, 1u },
+  { 0xB2940000C704ull, 1929u, 1u },
+  { 0xC6940000C77Cull, 1930u, 1u },
+  { 0xB9C80000BC14ull, 1931u, 1u },
+  { 0xAC000000ADFCull, 1932u, 1u },
+  { 0xADFC0000B370ull, 1933u, 1u },
+  { 0xC54C0000ACE0ull, 1934u, 1u },
+  { 0xC7740000B807ull, 1935u, 1u },
+  { 0xAC8C0000BE68ull, 1936u, 1u },
+  { 0xBE680000B9ACull, 1937u, 1u },
+  { 0xB2E40000C774ull, 1938u, 1u },
+  { 0xAC700000C804ull, 1939u, 1u },
+  { 0xC5D00000C5B4ull, 1940u, 1u },
+  { 0xC5440000B1E8ull, 1941u, 1u },
+  { 0xB1E80000ACC4ull, 1942u, 1u },
+  { 0xACC40000C18Dull, 1943u, 1u },
+  { 0xC18D0000B2E5ull, 1944u, 1u },
+  { 0xB2E50000D130ull, 1945u, 1u },
+  { 0xD1300000C5BCull, 1946u, 1u },
+  { 0xB9C80000B098ull, 1947u, 1u },
+  { 0xB0980000B420ull, 1948u, 1u },
+  { 0xB4200000C54Cull, 1949u, 1u },
+  { 0xC5440000C81Cull, 1950u, 1u },
+  { 0xBC1C0000C788ull, 1951u, 1u },
+  { 0xC9C00000AC81ull, 1952u, 1u },
+  { 0xB5140000C0ACull, 1953u, 1u },
+  { 0xADF80000AC00ull, 1954u, 1u },
+  { 0xAC000000C548ull, 1955u, 1u },
+  { 0xB1550000C88Bull, 1956u, 1u },
+  { 0xC6940000AC19ull, 1957u, 1u },
+  { 0xC5440000C6B0ull, 1958u, 1u },
+  { 0xB7980000C694ull, 1959u, 1u },
+  { 0xC7900000ADF8ull, 1960u, 1u },
+  { 0xAC780000B450ull, 1961u, 1u },
+  { 0xB4500000C544ull, 1962u, 1u },
+  { 0xB2C80000C5D0ull, 1963u, 1u },
+  { 0xC7440000B54Cull, 1964u, 1u },
+  { 0xBB380000C5D0ull, 1965u, 1u },
+  { 0xC5D00000B300ull, 1966u, 1u },
+  { 0xBE600000BA87ull, 1967u, 1u },
+  { 0xBA870000C0ACull, 1968u, 1u },
+  { 0xB78C0000D588ull, 1969u, 1u },
+  { 0xC5B40000BB50ull, 1970u, 1u },
+  { 0xBB500000C57Cull, 1971u, 1u },
+  { 0xC57C0000C218ull, 1972u, 1u },
+  { 0xC2180000B3C4ull, 1973u, 1u },
+  { 0xB3C40000B9CEull, 1974u, 1u },
+  { 0xB9CE0000C774ull, 1975u, 1u },
+  { 0xC7740000C9D1ull, 1976u, 1u },
+  { 0xC5D00000AC70ull, 1977u, 1u },
+  { 0xAC700000C9C0ull, 1978u, 1u },
+  { 0xC77C0000C744ull, 1979u, 1u },
+  { 0xC7440000C800ull, 1980u, 1u },
+  { 0xC8000000B294ull, 1981u, 1u },
+  { 0xB2940000C74Cull, 1982u, 1u },
+  { 0xC74C0000ADF8ull, 1983u, 1u },
+  { 0xC9C00000D568ull, 1984u, 1u },
+  { 0xD5680000AED8ull, 1985u, 1u },
+  { 0xAED80000B9CCull, 1986u, 1u },
+  { 0xC57D0000D558ull, 1987u, 1u },
+  { 0xB0980000C800ull, 1988u, 1u },
+  { 0xAE300000ACE0ull, 1989u, 1u },
+  { 0xC6940000D56Dull, 1990u, 1u },
+  { 0xD56D0000C0C1ull, 1991u, 1u },
+  { 0xC0C10000B098ull, 1992u, 1u },
+  { 0xB0980000D55Cull, 1993u, 1u },
+  { 0xD14C0000C7A0ull, 1994u, 1u },
+  { 0xAE500000AC00ull, 1995u, 1u },
+  { 0xC11C0000AC00ull, 1996u, 1u },
+  { 0xAC000000C7A5ull, 1997u, 1u },
+  { 0xC7A50000B3FCull, 1998u, 1u },
+  { 0xAC700000C8E0ull, 1999u, 1u },
+  { 0xC8E00000AC00ull, 2000u, 1u },
+  { 0xC7900000B9DEull, 2001u, 1u },
+  { 0xC5440000BCF4ull, 2002u, 1u },
+  { 0xBCF40000ACE0ull, 2003u, 1u },
+  { 0xACE00000C640ull, 2004u, 1u },
+  { 0xAC700000B9D0ull, 2005u, 1u },
+  { 0xC7440000AD1Cull, 2006u, 1u },
+  { 0xBB340000B3C4ull, 2007u, 1u },
+  { 0xB3C40000C5C6ull, 2008u, 1u },
+  { 0xB2940000C548ull, 2009u, 1u },
+  { 0xB1550000D558ull, 2010u, 1u },
+  { 0xC6940000BAB0ull, 2011u, 1u },
+  { 0xB77C0000C77Cull, 2012u, 1u },
+  { 0xC77C0000B9CEull, 2013u, 1u },
+  { 0xB9CE0000C740ull, 2014u, 1u },
+  { 0xC7400000B2F9ull, 2015u, 1u },
+  { 0xC7580000C544ull, 2016u, 1u },
+  { 0xBB340000AC83ull, 2017u, 1u },
+  { 0xB3C40000ADF8ull, 2018u, 1u },
+  { 0xAE4C0000D070ull, 2019u, 1u },
+  { 0xD0700000C54Cull, 2020u, 1u },
+  { 0xADF80000C758ull, 2021u, 1u },
+  { 0xC7580000BB50ull, 2022u, 1u },
+  { 0xBB500000AC00ull, 2023u, 1u },
+  { 0xC6CC0000ADF8ull, 2024u, 1u },
+  { 0xC6940000C820ull, 2025u, 1u },
+  { 0xC8200000C7A5ull, 2026u, 1u },
+  { 0xC7A50000C0ACull, 2027u, 1u },
+  { 0xAC700000C5D0ull, 2028u, 1u },
+  { 0xAC780000ADF8ull, 2029u, 1u },
+  { 0xADF80000B7F4ull, 2030u, 1u },
+  { 0xB7F40000AC83ull, 2031u, 1u },
+  { 0xB3C40000B9D0ull, 2032u, 1u },
+  { 0xBBF80000C57Cull, 2033u, 1u },
+  { 0xC57C0000ADF8ull, 2034u, 1u },
+  { 0xADF80000B97Cull, 2035u, 1u },
+  { 0xB97C0000BB54ull, 2036u, 1u },
+  { 0xAC000000C628ull, 2037u, 1u },
+  { 0xC6280000C774ull, 2038u, 1u },
+  { 0xB2C80000BA74ull, 2039u, 1u },
+  { 0xBA740000AC19ull, 2040u, 1u },
+  { 0xB7F00000B370ull, 2041u, 1u },
+  { 0xB77C0000C138ull, 2042u, 1u },
+  { 0xACE00000BB50ull, 2043u, 1u },
+  { 0xACE00000C608ull, 2044u, 1u },
+  { 0xC6080000C808ull, 2045u, 1u },
+  { 0xB3000000B9D0ull, 2046u, 1u },
+  { 0xB9D00000C57Cull, 2047u, 1u },
+  { 0xB2F90000C7A5ull, 2048u, 1u },
+  { 0xC7A50000ADF8ull, 2049u, 1u },
+  { 0xC7400000AC70ull, 2050u, 1u },
+  { 0xAE300000C804ull, 2051u, 1u },
+  { 0xC8040000BD80ull, 2052u, 1u },
+  { 0xBD800000B458ull, 2053u, 1u },
+  { 0xB4580000ADF8ull, 2054u, 1u },
+  { 0xB1400000B294ull, 2055u, 1u },
+  { 0xB2940000B2C8ull, 2056u, 1u },
+  { 0xAE300000C788ull, 2057u, 1u },
+  { 0xC7880000C8E0ull, 2058u, 1u },
+  { 0xC8E00000D558ull, 2059u, 1u },
+  { 0xBA740000AC00ull, 2060u, 1u },
+  { 0xC9C00000ACE0ull, 2061u, 1u },
+  { 0xC7740000CC38ull, 2062u, 1u },
+  { 0xCC380000B108ull, 2063u, 1u },
+  { 0xB1080000B3C4ull, 2064u, 1u },
+  { 0xB3C40000B410ull, 2065u, 1u },
+  { 0xC5B40000BBF8ull, 2066u, 1u },
+  { 0xD5740000AC83ull, 2067u, 1u },
+  { 0xC5EC0000AE34ull, 2068u, 1u },
+  { 0xAE340000C544ull, 2069u, 1u },
+  { 0xBB340000C0ACull, 2070u, 1u },
+  { 0xB78C0000C740ull, 2071u, 1u },
+  { 0xC7400000AC10ull, 2072u, 1u },
+  { 0xC0AC0000D569ull, 2073u, 1u },
+  { 0xB2E40000B2E4ull, 2074u, 1u },
+  { 0xB2E40000B4E4ull, 2075u, 1u },
+  { 0xB54C0000C528ull, 2076u, 1u },
+  { 0xC5280000ACE7ull, 2077u, 1u },
+  { 0xACE70000C5C4ull, 2078u, 1u },
+  { 0xB9C80000AC00ull, 2079u, 1u },
+  { 0xAC000000B098ull, 2080u, 1u },
+  { 0xB97C0000C774ull, 2081u, 1u },
+  { 0xC7740000C820ull, 2082u, 1u },
+  { 0xC8200000C544ull, 2083u, 1u },
+  { 0x0EC300000E99ull, 2084u, 1u },
+  { 0x0EA100000EB5ull, 2085u, 1u },
+  { 0x0EA100000EB2ull, 2086u, 1u },
+  { 0x0E9700000EB5ull, 2087u, 1u },
+  { 0x0E9400000EA3ull, 2088u, 1u },
+  { 0x0E8100000ECDull, 2089u, 1u },
+  { 0x0E8800000EB0ull, 2090u, 1u },
+  { 0x0E9B00000EB5ull, 2091u, 1u },
+  { 0x0EC400000E9Bull, 2092u, 1u },
+  { 0x0E8400000EB3ull, 2093u, 1u },
+  { 0x0E9900000EB3ull, 2094u, 1u },
+  { 0x0E9400000EB5ull, 2095u, 1u },
+  { 0x0EC400000E8Aull, 2096u, 1u },
+  { 0x0E8400000EB7ull, 2097u, 1u },
+  { 0x0EAA00000EB0ull, 2098u, 1u },
+  { 0x0EAA00000EB2ull, 2099u, 1u },
+  { 0x0E9700000EB3ull, 2100u, 1u },
+  { 0x0EAA00000EB5ull, 2101u, 1u },
+  { 0x0E9B00000EB0ull, 2102u, 1u },
+  { 0x0EAD00000EB2ull, 2103u, 1u },
+  { 0x0EA100000EB0ull, 2104u, 1u },
+  { 0x0EAB00000EB2ull, 2105u, 1u },
+  { 0x0EA500000EB0ull, 2106u, 1u },
+  { 0x0EA100000EB7ull, 2107u, 1u },
+  { 0x0E9E00000EB0ull, 2108u, 1u },
+  { 0x0E8200000ECDull, 2109u, 1u },
+  { 0x0E9700000EB4ull, 2110u, 1u },
+  { 0x0EAA00000E88ull, 2111u, 1u },
+  { 0x0E8D00000EB0ull, 2112u, 1u },
+  { 0x0E9900000EB2ull, 2113u, 1u },
+  { 0x0EAA00000E9Bull, 2114u, 1u },
+  { 0x003100000030ull, 2115u, 2u },
+  { 0x0E9600000EB0ull, 2117u, 1u },
+  { 0x003100000035ull, 2118u, 2u },
+  { 0x0EA500000EB2ull, 2120u, 1u },
+  { 0x0EA500000EB5ull, 2121u, 1u },
+  { 0x0EC400000E82ull, 2122u, 1u },
+  { 0x0EAA00000EB8ull, 2123u, 1u },
+  { 0x003100000034ull, 2124u, 2u },
+  { 0x003100000036ull, 2126u, 2u },
+  { 0x003300000030ull, 2128u, 2u },
+  { 0x0E9900000EB0ull, 2130u, 1u },
+  { 0x0E9600000EB7ull, 2131u, 1u },
+  { 0x0EC300000E88ull, 2132u, 1u },
+  { 0x0EC300000E94ull, 2133u, 1u },
+  { 0x003100000031ull, 2134u, 2u },
+  { 0x003200000031ull, 2136u, 2u },
+  { 0x0E8100000EB2ull, 2138u, 1u },
+  { 0x0E8A00000EB5ull, 2139u, 1u },
+  { 0x003200000035ull, 2140u, 2u },
+  { 0x0E8400000EB0ull, 2142u, 1u },
+  { 0x0EA200000EB2ull, 2143u, 1u },
+  { 0x003100000033ull, 2144u, 2u },
+  { 0x0EC000000E8Aull, 2146u, 1u },
+  { 0x0EC400000E97ull, 2147u, 1u },
+  { 0x003100000032ull, 2148u, 2u },
+  { 0x003100000038ull, 2150u, 2u },
+  { 0x003200000030ull, 2152u, 2u },
+  { 0x0E9600000EB2ull, 2154u, 1u },
+  { 0x0EC200000E95ull, 2155u, 1u },
+  { 0x003200000037ull, 2156u, 2u },
+  { 0x003200000033ull, 2158u, 2u },
+  { 0x0E9500000EB0ull, 2160u, 1u },
+  { 0x003100000037ull, 2161u, 2u },
+  { 0x003200000038ull, 2163u, 2u },
+  { 0x003200000032ull, 2165u, 2u },
+  { 0x0EA700000EB4ull, 2167u, 1u },
+  { 0x0EC200000E94ull, 2168u, 1u },
+  { 0x0E8100000EB3ull, 2169u, 1u },
+  { 0x0E9500000EB5ull, 2170u, 1u },
+  { 0x003200000036ull, 2171u, 2u },
+  { 0x0E9500000EB2ull, 2173u, 1u },
+  { 0x0EC400000E9Eull, 2174u, 1u },
+  { 0x0E8200000EB0ull, 2175u, 1u },
+  { 0x00320000002Eull, 2176u, 2u },
+  { 0x0EA500000EB3ull, 2178u, 1u },
+  { 0x00330000002Eull, 2179u, 2u },
+  { 0x00340000002Eull, 2181u, 2u },
+  { 0x0E9400000EB2ull, 2183u, 1u },
+  { 0x0E9700000EB0ull, 2184u, 1u },
+  { 0x0EA500000EB4ull, 2185u, 1u },
+  { 0x003200000034ull, 2186u, 2u },
+  { 0x0E9B00000EB2ull, 2188u, 1u },
+  { 0x0EC300000E9Aull, 2189u, 1u },
+  { 0x0EA300000EB2ull, 2190u, 1u },
+  { 0x003000000036ull, 2191u, 2u },
+  { 0x003100000039ull, 2193u, 2u },
+  { 0x003200000039ull, 2195u, 2u },
+  { 0x0E8A00000EB2ull, 2197u, 1u },
+  { 0x0EAD00000EB5ull, 2198u, 1u },
+  { 0x003000000039ull, 2199u, 2u },
+  { 0x00310000002Eull, 2201u, 2u },
+  { 0x0EA200000EB9ull, 2203u, 1u },
+  { 0x003000000034ull, 2204u, 2u },
+  { 0x0E9A00000EB9ull, 2206u, 1u },
+  { 0x0EC200000EA5ull, 2207u, 1u },
+  { 0x0EC400000EA7ull, 2208u, 1u },
+  { 0x00350000002Eull, 2209u, 1u },
+  { 0x003000000031ull, 2210u, 2u },
+  { 0x0EC200000EADull, 2212u, 1u },
+  { 0x003000000037ull, 2213u, 2u },
+  { 0x0EC400000E9Full, 2215u, 1u },
+  { 0x0E8400000ECDull, 2216u, 1u },
+  { 0x003500000030ull, 2217u, 2u },
+  { 0x0E9A00000EB2ull, 2219u, 1u },
+  { 0x0EC200000E99ull, 2220u, 1u },
+  { 0x0E9900000EB5ull, 2221u, 1u },
+  { 0x0EC000000EADull, 2222u, 1u },
+  { 0x0EC200000EA3ull, 2223u, 1u },
+  { 0x003000000038ull, 2224u, 2u },
+  { 0x003300000031ull, 2226u, 2u },
+  { 0x0EAA00000EB3ull, 2228u, 1u },
+  { 0x003000000032ull, 2229u, 2u },
+  { 0x003000000035ull, 2231u, 2u },
+  { 0x0EC200000E81ull, 2233u, 1u },
+  { 0x0EC000000E99ull, 2234u, 1u },
+  { 0x0E8A00000EB0ull, 2235u, 1u },
+  { 0x0EC000000EA5ull, 2236u, 1u },
+  { 0x0E9A00000ECDull, 2237u, 1u },
+  { 0x0E9E00000EB2ull, 2238u, 1u },
+  { 0x0E9E00000ECDull, 2239u, 1u },
+  { 0x0E9500000EB4ull, 2240u, 1u },
+  { 0x0EAB00000EB0ull, 2241u, 1u },
+  { 0x0EC000000EA1ull, 2242u, 1u },
+  { 0x0EAB00000ECDull, 2243u, 1u },
+  { 0x0EC200000E97ull, 2244u, 1u },
+  { 0x0E8400000EB9ull, 2245u, 1u },
+  { 0x0E8800000EB8ull, 2246u, 1u },
+  { 0x0EC300000E9Cull, 2247u, 1u },
+  { 0x0EC400000E81ull, 2248u, 1u },
+  { 0x0E8100000EB4ull, 2249u, 1u },
+  { 0x0E9E00000EB4ull, 2250u, 1u },
+  { 0x00360000002Eull, 2251u, 1u },
+  { 0x0E8A00000EB9ull, 2252u, 1u },
+  { 0x0E9E00000EB9ull, 2253u, 1u },
+  { 0x0EC400000EA1ull, 2254u, 1u },
+  { 0x0E8100000EB9ull, 2255u, 1u },
+  { 0x003000000033ull, 2256u, 2u },
+  { 0x00370000002Eull, 2258u, 2u },
+  { 0x0E8A00000EB4ull, 2260u, 1u },
+  { 0x0EAD00000EB0ull, 2261u, 1u },
+  { 0x0EC400000E99ull, 2262u, 1u },
+  { 0x0EC400000EADull, 2263u, 1u },
+  { 0x0E8400000EB2ull, 2264u, 1u },
+  { 0x0E9C00000EB2ull, 2265u, 1u },
+  { 0x00380000002Eull, 2266u, 1u },
+  { 0x004900000058ull, 2267u, 1u },
+  { 0x0E8D00000EB2ull, 2268u, 1u },
+  { 0x0EC000000E95ull, 2269u, 1u },
+  { 0x003600000031ull, 2270u, 1u },
+  { 0x0E9700000EB2ull, 2271u, 1u },
+  { 0x104100001040ull, 2272u, 1u },
+  { 0x104200001040ull, 2273u, 1u },
+  { 0x104100001042ull, 2274u, 1u },
+  { 0x104100001045ull, 2275u, 1u },
+  { 0x101E00001030ull, 2276u, 1u },
+  { 0x104100001041ull, 2277u, 1u },
+  { 0x101F0000102Cull, 2278u, 1u },
+  { 0x104300001040ull, 2279u, 1u },
+  { 0x101C00001030ull, 2280u, 1u },
+  { 0x104100001044ull, 2281u, 1u },
+  { 0x10120000102Eull, 2282u, 1u },
+  { 0x104100001049ull, 2283u, 1u },
+  { 0x102600001038ull, 2284u, 1u },
+  { 0x104200001044ull, 2285u, 1u },
+  { 0x104100001043ull, 2286u, 1u },
+  { 0x104200001045ull, 2287u, 1u },
+  { 0x104100001048ull, 2288u, 1u },
+  { 0x104200001046ull, 2289u, 1u },
+  { 0x104100001046ull, 2290u, 1u },
+  { 0x104200001041ull, 2291u, 1u },
+  { 0x104100001047ull, 2292u, 1u },
+  { 0x104200001047ull, 2293u, 1u },
+  { 0x104200001048ull, 2294u, 1u },
+  { 0x10010000102Full, 2295u, 1u },
+  { 0x104200001043ull, 2296u, 1u },
+  { 0x104200001042ull, 2297u, 1u },
+  { 0x104200001049ull, 2298u, 1u },
+  { 0x104500001040ull, 2299u, 1u },
+  { 0x10190000103Eull, 2300u, 1u },
+  { 0x104300001041ull, 2301u, 1u },
+  { 0x10210000101Bull, 2302u, 1u },
+  { 0x101500001031ull, 2303u, 1u },
+  { 0x102100001016ull, 2304u, 1u },
+  { 0x101900001032ull, 2305u, 1u },
+  { 0x004D00000072ull, 2306u, 1u },
+  { 0x10410000101Dull, 2307u, 1u },
+  { 0x101500001032ull, 2308u, 1u },
+  { 0x104300001045ull, 2309u, 1u },
+  { 0x101900001031ull, 2310u, 1u },
+  { 0x104400001040ull, 2311u, 1u },
+  { 0x10110000102Dull, 2312u, 1u },
+  { 0x10120000102Bull, 2313u, 1u },
+  { 0x101F0000102Full, 2314u, 1u },
+  { 0x104700001046ull, 2315u, 1u },
+  { 0x004100000041ull, 2316u, 1u },
+  { 0x10060000102Full, 2317u, 1u },
+  { 0x101100001032ull, 2318u, 1u },
+  { 0x104400001045ull, 2319u, 1u },
+  { 0x104800001048ull, 2320u, 1u },
+  { 0x101B00001032ull, 2321u, 1u },
+  { 0x101E0000102Cull, 2322u, 1u },
+  { 0x104700001045ull, 2323u, 1u },
+  { 0x104800001040ull, 2324u, 1u },
+  { 0x006F0000006Eull, 2325u, 1u },
+  { 0x10150000102Bull, 2326u, 1u },
+  { 0x10410000104Bull, 2327u, 1u },
+  { 0x10420000101Dull, 2328u, 1u },
+  { 0x104300001047ull, 2329u, 1u },
+  { 0x104500001045ull, 2330u, 1u },
+  { 0x104400001046ull, 2331u, 1u },
+  { 0x104500001042ull, 2332u, 1u },
+  { 0x104900001040ull, 2333u, 1u },
+  { 0x10420000104Bull, 2334u, 1u },
+  { 0x104300001046ull, 2335u, 1u },
+  { 0x104300001049ull, 2336u, 1u },
+  { 0x10460000101Dull, 2337u, 1u },
+  { 0x104600001040ull, 2338u, 1u },
+  { 0x10010000102Bull, 2339u, 1u },
+  { 0x0E190000002Eull, 2340u, 1u },
+  { 0x0E1B00000E35ull, 2341u, 1u },
+  { 0x0E0400000E19ull, 2342u, 1u },
+  { 0x0E1E00000E25ull, 2343u, 1u },
+  { 0x0E2100000E35ull, 2344u, 1u },
+  { 0x0E4000000E21ull, 2345u, 1u },
+  { 0x0E1E00000E1Aull, 2346u, 1u },
+  { 0x0E4400000E1Bull, 2347u, 1u },
+  { 0x0E4300000E19ull, 2348u, 1u },
+  { 0x0E280000002Eull, 2349u, 1u },
+  { 0x0E220000002Eull, 2350u, 1u },
+  { 0x0E1400000E23ull, 2351u, 1u },
+  { 0x0E1C00000E1Aull, 2352u, 1u },
+  { 0x0E0800000E30ull, 2353u, 1u },
+  { 0x0E1400000E35ull, 2354u, 1u },
+  { 0x0E2100000E34ull, 2355u, 1u },
+  { 0x0E2100000E32ull, 2356u, 1u },
+  { 0x0E2300000E1Eull, 2357u, 1u },
+  { 0x0E040000002Eull, 2358u, 1u },
+  { 0x003400000030ull, 2359u, 1u },
+  { 0x0E1500000E23ull, 2360u, 1u },
+  { 0x0E0100000E47ull, 2361u, 1u },
+  { 0x0E2A00000E20ull, 2362u, 1u },
+  { 0x0E2300000E23ull, 2363u, 1u },
+  { 0x0E1C00000E2Dull, 2364u, 1u },
+  { 0x0E1900000E1Eull, 2365u, 1u },
+  { 0x0E0100000E01ull, 2366u, 1u },
+  { 0x0E2A00000E19ull, 2367u, 1u },
+  { 0x004D00000062ull, 2368u, 1u },
+  { 0x0E0100000E21ull, 2369u, 1u },
+  { 0x0E0B00000E35ull, 2370u, 1u },
+  { 0x003300000035ull, 2371u, 1u },
+  { 0x003800000030ull, 2372u, 1u },
+  { 0x0E2A00000E18ull, 2373u, 1u },
+  { 0x003700000030ull, 2374u, 1u },
+  { 0x0E1700000E33ull, 2375u, 1u },
+  { 0x0E0A00000E21ull, 2376u, 1u },
+  { 0x003500000034ull, 2377u, 1u },
+  { 0x0E2800000E1Eull, 2378u, 1u },
+  { 0x0E0800000E35ull, 2379u, 1u },
+  { 0x0E1A00000E01ull, 2380u, 1u },
+  { 0x0E2800000E18ull, 2381u, 1u },
+  { 0x0E0B00000E21ull, 2382u, 1u },
+  { 0x0E0400000E33ull, 2383u, 1u },
+  { 0x003400000034ull, 2384u, 1u },
+  { 0x003300000033ull, 2385u, 1u },
+  { 0x0E2300000E28ull, 2386u, 1u },
+  { 0x0E4300000E08ull, 2387u, 1u },
+  { 0x0E1A00000E0Aull, 2388u, 1u },
+  { 0x003400000033ull, 2389u, 1u },
+  { 0x0E2D00000E22ull, 2390u, 1u },
+  { 0x003500000033ull, 2391u, 1u },
+  { 0x004900000050ull, 2392u, 1u },
+  { 0x0E1C00000E21ull, 2393u, 1u },
+  { 0x0E0200000E2Dull, 2394u, 1u },
+  { 0x0E1400000E39ull, 2395u, 1u },
+  { 0x0E2100000E21ull, 2396u, 1u },
+  { 0x0E1900000E33ull, 2397u, 1u },
+  { 0x003600000030ull, 2398u, 1u },
+  { 0x0E2D00000E2Aull, 2399u, 1u },
+  { 0x0E0100000E2Dull, 2400u, 1u },
+  { 0x003500000032ull, 2401u, 1u },
+  { 0x0E2A00000E2Aull, 2402u, 1u },
+  { 0x003600000036ull, 2403u, 1u },
+  { 0x0E1E00000E17ull, 2404u, 1u },
+  { 0x0E4000000E2Dull, 2405u, 1u },
+  { 0x0E210000002Eull, 2406u, 1u },
+  { 0x0E2800000E2Dull, 2407u, 1u },
+  { 0x0E0400000E07ull, 2408u, 1u },
+  { 0x0E2A00000E35ull, 2409u, 1u },
+  { 0x004900000054ull, 2410u, 1u },
+  { 0x0E1C00000E28ull, 2411u, 1u },
+  { 0x0E2A0000002Eull, 2412u, 1u },
+  { 0x0E2A00000E27ull, 2413u, 1u },
+  { 0x0E1900000E28ull, 2414u, 1u },
+  { 0x0E2A00000E1Aull, 2415u, 1u },
+  { 0x0E1A00000E17ull, 2416u, 1u },
+  { 0x0E2B00000E32ull, 2417u, 1u },
+  { 0x0E1C00000E25ull, 2418u, 1u },
+  { 0x0E2300000E16ull, 2419u, 1u },
+  { 0x003300000032ull, 2420u, 1u },
+  { 0x0E2D0000002Eull, 2421u, 1u },
+  { 0x0E2500000E07ull, 2422u, 1u },
+  { 0x0E1E00000E2Dull, 2423u, 1u },
+  { 0x0E010000002Eull, 2424u, 1u },
+  { 0x0E140000002Eull, 2425u, 1u },
+  { 0x0E2500000E30ull, 2426u, 1u },
+  { 0x0E1700000E35ull, 2427u, 1u },
+  { 0x003400000035ull, 2428u, 1u },
+  { 0x003500000035ull, 2429u, 1u },
+  { 0x0E1B00000E20ull, 2430u, 1u },
+  { 0x0E2300000E2Dull, 2431u, 1u },
+  { 0x003700000039ull, 2432u, 1u },
+  { 0x003500000036ull, 2433u, 1u },
+  { 0x0E0100000E15ull, 2434u, 1u },
+  { 0x003300000036ull, 2435u, 1u },
+  { 0x0E2700000E18ull, 2436u, 1u },
+  { 0x0E1B00000E18ull, 2437u, 1u },
+  { 0x0E1B00000E39ull, 2438u, 1u },
+  { 0x003500000031ull, 2439u, 1u },
+  { 0x0E4000000E08ull, 2440u, 1u },
+  { 0x0E1900000E30ull, 2441u, 1u },
+  { 0x0E1E00000E0Dull, 2442u, 1u },
+  { 0x0E1E00000E35ull, 2443u, 1u },
+  { 0x0E1A00000E35ull, 2444u, 1u },
+  { 0x0E2700000E07ull, 2445u, 1u },
+  { 0x0E0800000E19ull, 2446u, 1u },
+  { 0x0E2100000E23ull, 2447u, 1u },
+  { 0x0E4300000E1Aull, 2448u, 1u },
+  { 0x003400000032ull, 2449u, 1u },
+  { 0x0E080000002Eull, 2450u, 1u },
+  { 0x0E2300000E1Aull, 2451u, 1u },
+  { 0x0E2500000E14ull, 2452u, 1u },
+  { 0x0E2D00000E35ull, 2453u, 1u },
+  { 0x003300000038ull, 2454u, 1u },
+  { 0x003900000030ull, 2455u, 1u },
+  { 0x003400000036ull, 2456u, 1u },
+  { 0xFF0C00004F46ull, 2457u, 1u },
+  { 0x4E0D000089C1ull, 2458u, 1u },
+  { 0x755900005728ull, 2459u, 1u },
+  { 0x572800009019ull, 2460u, 1u },
+  { 0x9019000088CFull, 2461u, 1u },
+  { 0x88CF00007B49ull, 2462u, 1u },
+  { 0x7B4900005979ull, 2463u, 1u },
+  { 0x597900003002ull, 2464u, 1u },
+  { 0x4ED600004EECull, 2465u, 1u },
+  { 0x4EEC00006709ull, 2466u, 1u },
+  { 0x67090000773Cull, 2467u, 1u },
+  { 0x773C0000775Bull, 2468u, 1u },
+  { 0x775B0000FF0Cull, 2469u, 1u },
+  { 0x4F460000770Bull, 2470u, 1u },
+  { 0x770B00004E0Dull, 2471u, 1u },
+  { 0x89C10000FF1Bull, 2472u, 1u },
+  { 0xFF1B00006709ull, 2473u, 1u },
+  { 0x670900008033ull, 2474u, 1u },
+  { 0x803300006735ull, 2475u, 1u },
+  { 0x67350000FF0Cull, 2476u, 1u },
+  { 0x4F460000542Cull, 2477u, 1u },
+  { 0x542C00004E0Dull, 2478u, 1u },
+  { 0x89C100003002ull, 2479u, 1u },
+  { 0x6E6F000059C6ull, 2480u, 1u },
+  { 0x59C600009072ull, 2481u, 1u },
+  { 0x9072000065E9ull, 2482u, 1u },
+  { 0x65E900006703ull, 2483u, 1u },
+  { 0x670300005F8Cull, 2484u, 1u },
+  { 0x5F8C00006094ull, 2485u, 1u },
+  { 0x609400003002ull, 2486u, 1u },
+  { 0x621100006B63ull, 2487u, 1u },
+  { 0x6B6300008981ull, 2488u, 1u },
+  { 0x8981000053BBull, 2489u, 1u },
+  { 0x53BB00005199ull, 2490u, 1u },
+  { 0x519900004E00ull, 2491u, 1u },
+  { 0x4E0000005C01ull, 2492u, 1u },
+  { 0x5C0100004FE1ull, 2493u, 1u },
+  { 0x4FE100003002ull, 2494u, 1u },
+  { 0x4ED60000518Dull, 2495u, 1u },
+  { 0x518D00006709ull, 2496u, 1u },
+  { 0x67090000500Bull, 2497u, 1u },
+  { 0x500B00009577ull, 2498u, 1u },
+  { 0x9577000077EDull, 2499u, 1u },
+  { 0x77ED0000FF0Cull, 2500u, 1u },
+  { 0xFF0C00009019ull, 2501u, 1u },
+  { 0x901900005BB6ull, 2502u, 1u },
+  { 0x5BB60000696Dull, 2503u, 1u },
+  { 0x696D00006015ull, 2504u, 1u },
+  { 0x601500004E0Dull, 2505u, 1u },
+  { 0x4E0D0000662Full, 2506u, 1u },
+  { 0x662F0000773Eull, 2507u, 1u },
+  { 0x773E000089AAull, 2508u, 1u },
+  { 0x89AA000065CFull, 2509u, 1u },
+  { 0x65CF00004E00ull, 2510u, 1u },
+  { 0x4E0000005206ull, 2511u, 1u },
+  { 0x52060000FF1Full, 2512u, 1u },
+  { 0x90A30000662Full, 2513u, 1u },
+  { 0x662F00004E0Bull, 2514u, 1u },
+  { 0x4E0B00004E2Aull, 2515u, 1u },
+  { 0x4E2A00006708ull, 2516u, 1u },
+  { 0x670800007684ull, 2517u, 1u },
+  { 0x768400004E8Bull, 2518u, 1u },
+  { 0x4E8B00003002ull, 2519u, 1u },
+};
+
+static const wa_token_posting WA_BIGRAM_DICT_POSTINGS[] = {
+  {70,0}, {70,1}, {70,2}, {70,3}, {70,4}, {70,5}, {70,6}, {70,7}, {70,8}, {70,9}, {70,10}, {70,11},
+  {70,12}, {70,13}, {70,14}, {70,15}, {70,16}, {70,17}, {70,18}, {70,19}, {70,20}, {70,21}, {70,22}, {70,23},
+  {70,24}, {70,25}, {70,26}, {70,27}, {70,28}, {70,29}, {70,30}, {70,31}, {70,32}, {70,33}, {70,34}, {70,35},
+  {70,36}, {70,37}, {70,38}, {70,39}, {70,40}, {70,41}, {70,42}, {70,43}, {70,44}, {70,45}, {70,46}, {70,47},
+  {70,48}, {70,49}, {70,50}, {70,51}, {70,52}, {70,53}, {70,54}, {70,55}, {70,56}, {70,57}, {70,58}, {70,59},
+  {70,60}, {70,61}, {70,62}, {70,63}, {70,64}, {70,65}, {70,66}, {70,67}, {70,68}, {70,69}, {70,70}, {70,71},
+  {70,72}, {70,73}, {70,74}, {70,75}, {70,76}, {70,77}, {70,78}, {70,79}, {70,80}, {70,81}, {70,82}, {70,83},
+  {70,84}, {70,85}, {70,86}, {70,87}, {70,88}, {70,89}, {70,90}, {70,91}, {70,92}, {70,93}, {70,94}, {70,95},
+  {70,96}, {70,97}, {70,98}, {70,99}, {70,100}, {70,101}, {70,102}, {70,103}, {70,104}, {70,105}, {70,106}, {70,107},
+  {70,108}, {70,109}, {70,110}, {70,111}, {70,112}, {70,113}, {70,114}, {70,115}, {70,116}, {70,117}, {70,118}, {70,119},
+  {70,120}, {70,121}, {70,122}, {70,123}, {70,124}, {70,125}, {70,126}, {70,127}, {70,128}, {70,129}, {70,130}, {70,131},
+  {70,132}, {70,133}, {70,134}, {70,135}, {70,136}, {70,137}, {70,138}, {70,139}, {70,140}, {70,141}, {70,142}, {70,143},
+  {70,144}, {70,145}, {70,146}, {70,147}, {70,148}, {70,149}, {70,150}, {70,151}, {70,152}, {70,153}, {70,154}, {70,155},
+  {70,156}, {70,157}, {70,158}, {70,159}, {70,160}, {70,161}, {70,162}, {70,163}, {70,164}, {70,165}, {70,166}, {70,167},
+  {70,168}, {70,169}, {70,170}, {70,171}, {70,172}, {70,173}, {70,174}, {70,175}, {70,176}, {70,177}, {70,178}, {70,179},
+  {70,180}, {70,181}, {70,182}, {70,183}, {70,184}, {70,185}, {70,186}, {70,187}, {70,188}, {70,189}, {70,190}, {70,191},
+  {70,192}, {70,193}, {70,194}, {70,195}, {70,196}, {70,197}, {70,198}, {70,199}, {70,200}, {70,201}, {70,202}, {70,203},
+  {70,204}, {70,205}, {70,206}, {70,207}, {70,208}, {70,209}, {70,210}, {70,211}, {70,212}, {70,213}, {70,214}, {70,215},
+  {70,216}, {70,217}, {70,218}, {70,219}, {70,220}, {70,221}, {70,222}, {70,223}, {70,224}, {70,225}, {70,226}, {70,227},
+  {70,228}, {70,229}, {70,230}, {70,231}, {70,232}, {70,233}, {70,234}, {70,235}, {70,236}, {70,237}, {70,238}, {70,239},
+  {70,240}, {70,241}, {70,242}, {70,243}, {70,244}, {70,245}, {70,246}, {70,247}, {70,248}, {70,249}, {70,250}, {70,251},
+  {70,252}, {70,253}, {70,254}, {70,255}, {70,256}, {70,257}, {70,258}, {70,259}, {70,260}, {70,261}, {70,262}, {70,263},
+  {70,264}, {70,265}, {70,266}, {70,267}, {70,268}, {70,269}, {70,270}, {70,271}, {70,272}, {70,273}, {70,274}, {70,275},
+  {70,276}, {70,277}, {70,278}, {70,279}, {70,280}, {70,281}, {70,282}, {70,283}, {70,284}, {70,285}, {70,286}, {70,287},
+  {70,288}, {70,289}, {70,290}, {70,291}, {70,292}, {70,293}, {70,294}, {70,295}, {70,296}, {70,297}, {70,298}, {70,299},
+  {70,300}, {70,301}, {70,302}, {70,303}, {70,304}, {70,305}, {70,306}, {70,307}, {70,308}, {70,309}, {70,310}, {70,311},
+  {70,312}, {70,313}, {70,314}, {70,315}, {70,316}, {70,317}, {70,318}, {70,319}, {70,320}, {70,321}, {70,322}, {70,323},
+  {70,324}, {70,325}, {70,326}, {70,327}, {70,328}, {70,329}, {70,330}, {70,331}, {70,332}, {70,333}, {70,334}, {70,335},
+  {70,336}, {70,337}, {70,338}, {70,339}, {70,340}, {70,341}, {70,342}, {70,343}, {70,344}, {70,345}, {70,346}, {70,347},
+  {70,348}, {70,349}, {70,350}, {70,351}, {70,352}, {70,353}, {70,354}, {70,355}, {70,356}, {70,357}, {70,358}, {70,359},
+  {70,360}, {70,361}, {70,362}, {70,363}, {70,364}, {70,365}, {70,366}, {70,367}, {70,368}, {70,369}, {70,370}, {70,371},
+  {70,372}, {70,373}, {70,374}, {70,375}, {70,376}, {70,377}, {70,378}, {70,379}, {70,380}, {70,381}, {70,382}, {70,383},
+  {70,384}, {70,385}, {70,386}, {70,387}, {70,388}, {70,389}, {70,390}, {70,391}, {70,392}, {70,393}, {70,394}, {70,395},
+  {70,396}, {70,397}, {70,398}, {70,399}, {70,400}, {70,401}, {70,402}, {70,403}, {70,404}, {70,405}, {70,406}, {70,407},
+  {70,408}, {70,409}, {70,410}, {70,411}, {70,412}, {70,413}, {70,414}, {70,415}, {70,416}, {70,417}, {70,418}, {70,419},
+  {70,420}, {70,421}, {70,422}, {70,423}, {70,424}, {70,425}, {70,426}, {70,427}, {70,428}, {70,429}, {70,430}, {70,431},
+  {70,432}, {70,433}, {70,434}, {70,435}, {70,436}, {70,437}, {70,438}, {70,439}, {70,440}, {70,441}, {70,442}, {70,443},
+  {70,444}, {70,445}, {70,446}, {70,447}, {70,448}, {70,449}, {70,450}, {70,451}, {70,452}, {70,453}, {70,454}, {70,455},
+  {70,456}, {70,457}, {70,458}, {70,459}, {70,460}, {70,461}, {70,462}, {70,463}, {70,464}, {70,465}, {70,466}, {70,467},
+  {70,468}, {70,469}, {70,470}, {70,471}, {70,472}, {70,473}, {70,474}, {70,475}, {70,476}, {70,477}, {70,478}, {70,479},
+  {70,480}, {70,481}, {70,482}, {70,483}, {70,484}, {70,485}, {70,486}, {70,487}, {70,488}, {70,489}, {70,490}, {70,491},
+  {70,492}, {70,493}, {70,494}, {70,495}, {70,496}, {70,497}, {70,498}, {70,499}, {70,500}, {70,501}, {70,502}, {70,503},
+  {70,504}, {70,505}, {70,506}, {70,507}, {70,508}, {70,509}, {70,510}, {70,511}, {70,512}, {70,513}, {70,514}, {70,515},
+  {70,516}, {70,517}, {70,518}, {70,519}, {70,520}, {70,521}, {70,522}, {70,523}, {70,524}, {70,525}, {70,526}, {70,527},
+  {70,528}, {70,529}, {70,530}, {70,531}, {70,532}, {70,533}, {70,534}, {70,535}, {70,536}, {70,537}, {70,538}, {70,539},
+  {70,540}, {70,541}, {70,542}, {70,543}, {70,544}, {70,545}, {70,546}, {70,547}, {70,548}, {70,549}, {70,550}, {70,551},
+  {70,552}, {70,553}, {70,554}, {70,555}, {70,556}, {70,557}, {70,558}, {70,559}, {70,560}, {70,561}, {70,562}, {70,563},
+  {70,564}, {70,565}, {70,566}, {70,567}, {70,568}, {70,569}, {70,570}, {70,571}, {70,572}, {70,573}, {70,574}, {70,575},
+  {70,576}, {70,577}, {70,578}, {70,579}, {70,580}, {70,581}, {70,582}, {70,583}, {70,584}, {70,585}, {70,586}, {70,587},
+  {70,588}, {70,589}, {70,590}, {70,591}, {70,592}, {70,593}, {70,594}, {70,595}, {70,596}, {70,597}, {70,598}, {70,599},
+  {70,600}, {70,601}, {70,602}, {70,603}, {70,604}, {70,605}, {70,606}, {70,607}, {70,608}, {70,609}, {70,610}, {70,611},
+  {70,612}, {70,613}, {70,614}, {70,615}, {70,616}, {70,617}, {70,618}, {70,619}, {70,620}, {70,621}, {70,622}, {70,623},
+  {70,624}, {70,625}, {70,626}, {70,627}, {70,628}, {70,629}, {70,630}, {70,631}, {70,632}, {70,633}, {70,634}, {70,635},
+  {70,636}, {70,637}, {70,638}, {70,639}, {70,640}, {70,641}, {70,642}, {70,643}, {70,644}, {70,645}, {70,646}, {70,647},
+  {70,648}, {70,649}, {70,650}, {70,651}, {70,652}, {70,653}, {70,654}, {70,655}, {70,656}, {70,657}, {70,658}, {70,659},
+  {70,660}, {70,661}, {70,662}, {70,663}, {70,664}, {70,665}, {70,666}, {70,667}, {70,668}, {70,669}, {70,670}, {70,671},
+  {70,672}, {70,673}, {70,674}, {70,675}, {70,676}, {70,677}, {70,678}, {70,679}, {70,680}, {70,681}, {70,682}, {70,683},
+  {70,684}, {70,685}, {70,686}, {70,687}, {70,688}, {70,689}, {70,690}, {70,691}, {70,692}, {70,693}, {70,694}, {70,695},
+  {70,696}, {70,697}, {70,698}, {70,699}, {70,700}, {70,701}, {70,702}, {70,703}, {70,704}, {70,705}, {70,706}, {70,707},
+  {70,708}, {70,709}, {70,710}, {70,711}, {70,712}, {70,713}, {70,714}, {70,715}, {70,716}, {70,717}, {70,718}, {70,719},
+  {70,720}, {70,721}, {70,722}, {70,723}, {70,724}, {70,725}, {70,726}, {70,727}, {70,728}, {70,729}, {70,730}, {70,731},
+  {70,732}, {70,733}, {70,734}, {70,735}, {70,736}, {70,737}, {70,738}, {70,739}, {70,740}, {70,741}, {70,742}, {70,743},
+  {70,744}, {70,745}, {70,746}, {70,747}, {70,748}, {70,749}, {70,750}, {70,751}, {70,752}, {70,753}, {70,754}, {70,755},
+  {70,756}, {70,757}, {70,758}, {70,759}, {70,760}, {70,761}, {70,762}, {70,763}, {70,764}, {70,765}, {70,766}, {70,767},
+  {70,768}, {70,769}, {70,770}, {70,771}, {70,772}, {70,773}, {70,774}, {70,775}, {70,776}, {70,777}, {70,778}, {70,779},
+  {70,780}, {70,781}, {70,782}, {70,783}, {70,784}, {70,785}, {70,786}, {70,787}, {70,788}, {70,789}, {70,790}, {70,791},
+  {70,792}, {70,793}, {70,794}, {70,795}, {70,796}, {70,797}, {70,798}, {70,799}, {70,800}, {70,801}, {70,802}, {70,803},
+  {70,804}, {70,805}, {70,806}, {70,807}, {70,808}, {70,809}, {70,810}, {70,811}, {70,812}, {70,813}, {70,814}, {70,815},
+  {70,816}, {70,817}, {70,818}, {70,819}, {70,820}, {70,821}, {70,822}, {70,823}, {70,824}, {70,825}, {70,826}, {70,827},
+  {70,828}, {70,829}, {70,830}, {70,831}, {70,832}, {70,833}, {70,834}, {70,835}, {70,836}, {70,837}, {70,838}, {70,839},
+  {70,840}, {70,841}, {70,842}, {70,843}, {70,844}, {70,845}, {70,846}, {70,847}, {70,848}, {70,849}, {70,850}, {70,851},
+  {70,852}, {70,853}, {70,854}, {70,855}, {70,856}, {70,857}, {70,858}, {70,859}, {70,860}, {70,861}, {70,862}, {70,863},
+  {70,864}, {70,865}, {70,866}, {70,867}, {70,868}, {70,869}, {70,870}, {70,871}, {70,872}, {70,873}, {70,874}, {70,875},
+  {70,876}, {70,877}, {70,878}, {70,879}, {70,880}, {70,881}, {70,882}, {70,883}, {70,884}, {70,885}, {70,886}, {70,887},
+  {70,888}, {70,889}, {70,890}, {70,891}, {70,892}, {70,893}, {70,894}, {70,895}, {70,896}, {70,897}, {70,898}, {70,899},
+  {70,900}, {70,901}, {70,902}, {70,903}, {70,904}, {70,905}, {70,906}, {70,907}, {70,908}, {70,909}, {70,910}, {70,911},
+  {70,912}, {70,913}, {70,914}, {70,915}, {70,916}, {70,917}, {70,918}, {70,919}, {70,920}, {70,921}, {70,922}, {70,923},
+  {70,924}, {70,925}, {70,926}, {70,927}, {70,928}, {70,929}, {70,930}, {70,931}, {70,932}, {70,933}, {70,934}, {70,935},
+  {70,936}, {70,937}, {70,938}, {70,939}, {70,940}, {70,941}, {70,942}, {70,943}, {70,944}, {70,945}, {70,946}, {70,947},
+  {70,948}, {70,949}, {70,950}, {70,951}, {70,952}, {70,953}, {70,954}, {70,955}, {70,956}, {70,957}, {70,958}, {70,959},
+  {70,960}, {70,961}, {70,962}, {70,963}, {70,964}, {70,965}, {70,966}, {70,967}, {70,968}, {70,969}, {70,970}, {70,971},
+  {70,972}, {70,973}, {70,974}, {70,975}, {70,976}, {70,977}, {70,978}, {70,979}, {70,980}, {70,981}, {70,982}, {70,983},
+  {70,984}, {70,985}, {70,986}, {70,987}, {70,988}, {70,989}, {70,990}, {70,991}, {70,992}, {70,993}, {70,994}, {70,995},
+  {70,996}, {70,997}, {70,998}, {70,999}, {78,11}, {78,18}, {78,22}, {78,26}, {78,27}, {78,30}, {78,38}, {78,45},
+  {78,46}, {78,47}, {78,48}, {78,49}, {78,50}, {78,51}, {78,53}, {78,57}, {78,58}, {78,63}, {78,65}, {78,66},
+  {78,67}, {78,68}, {78,72}, {78,73}, {78,78}, {78,90}, {78,91}, {78,92}, {78,101}, {78,105}, {78,113}, {78,118},
+  {78,125}, {78,133}, {78,160}, {78,165}, {78,166}, {78,167}, {78,169}, {78,172}, {78,183}, {78,189}, {78,199}, {78,202},
+  {78,203}, {78,204}, {78,222}, {78,241}, {78,280}, {78,282}, {78,283}, {78,284}, {78,295}, {78,333}, {78,340}, {78,381},
+  {78,420}, {78,421}, {78,422}, {78,423}, {78,424}, {78,425}, {78,429}, {78,441}, {78,442}, {78,443}, {78,446}, {78,452},
+  {78,456}, {78,461}, {78,462}, {78,465}, {112,742}, {162,500}, {78,481}, {78,649}, {78,676}, {78,723}, {78,751}, {78,806},
+  {78,847}, {78,848}, {78,879}, {78,909}, {80,0}, {80,1}, {80,2}, {80,3}, {80,4}, {80,5}, {80,6}, {80,7},
+  {80,8}, {80,9}, {80,10}, {80,11}, {80,12}, {80,13}, {80,14}, {80,15}, {80,16}, {80,17}, {80,18}, {80,19},
+  {80,20}, {80,21}, {80,22}, {80,23}, {80,24}, {80,25}, {80,26}, {80,27}, {80,28}, {80,29}, {80,30}, {80,31},
+  {80,32}, {80,33}, {80,34}, {80,35}, {80,36}, {80,37}, {80,38}, {80,39}, {80,40}, {80,41}, {80,42}, {80,43},
+  {80,44}, {80,45}, {80,46}, {80,47}, {80,48}, {80,49}, {80,50}, {80,51}, {80,52}, {80,53}, {80,54}, {80,55},
+  {80,56}, {80,57}, {80,58}, {80,59}, {80,60}, {80,61}, {80,62}, {80,63}, {80,64}, {80,65}, {80,66}, {80,67},
+  {80,68}, {80,69}, {80,70}, {80,71}, {80,72}, {80,73}, {80,74}, {80,75}, {80,76}, {80,77}, {80,78}, {80,79},
+  {80,80}, {80,81}, {80,82}, {80,83}, {80,84}, {80,85}, {80,86}, {80,87}, {80,88}, {80,89}, {80,90}, {80,91},
+  {80,92}, {80,93}, {80,94}, {80,95}, {80,96}, {80,97}, {80,98}, {80,99}, {80,100}, {80,101}, {80,102}, {80,103},
+  {80,104}, {80,105}, {80,106}, {80,107}, {80,108}, {80,109}, {80,110}, {80,111}, {80,112}, {80,113}, {80,114}, {80,115},
+  {80,116}, {80,117}, {80,118}, {80,119}, {80,120}, {80,121}, {80,122}, {80,123}, {80,124}, {80,125}, {80,126}, {80,127},
+  {80,128}, {80,129}, {80,130}, {80,131}, {80,132}, {80,133}, {80,134}, {80,135}, {80,136}, {80,137}, {80,138}, {80,139},
+  {80,140}, {80,141}, {80,142}, {80,143}, {80,144}, {80,145}, {80,146}, {80,147}, {80,148}, {80,149}, {80,150}, {80,151},
+  {80,152}, {80,153}, {80,154}, {80,155}, {80,156}, {80,157}, {80,158}, {80,159}, {80,160}, {80,161}, {80,162}, {80,163},
+  {80,164}, {80,165}, {80,166}, {80,167}, {80,168}, {80,169}, {80,170}, {80,171}, {80,172}, {80,173}, {80,174}, {80,175},
+  {80,176}, {80,177}, {80,178}, {80,179}, {80,180}, {80,181}, {80,182}, {80,183}, {80,184}, {80,185}, {80,186}, {80,187},
+  {80,188}, {80,189}, {80,190}, {80,191}, {80,192}, {80,193}, {80,194}, {80,195}, {80,196}, {80,197}, {80,198}, {80,199},
+  {80,200}, {80,201}, {80,202}, {80,203}, {80,204}, {80,205}, {80,206}, {80,207}, {80,208}, {80,209}, {80,210}, {80,211},
+  {80,212}, {80,213}, {80,214}, {80,215}, {80,216}, {80,217}, {80,218}, {80,219}, {80,220}, {80,221}, {80,222}, {80,223},
+  {80,224}, {80,225}, {80,226}, {80,227}, {80,228}, {80,229}, {80,230}, {80,231}, {80,232}, {80,233}, {80,234}, {80,235},
+  {80,236}, {80,237}, {80,238}, {80,239}, {80,240}, {80,241}, {80,242}, {80,243}, {80,244}, {80,245}, {80,246}, {80,247},
+  {80,248}, {80,249}, {80,250}, {80,251}, {80,252}, {80,253}, {80,254}, {80,255}, {80,256}, {80,257}, {80,258}, {80,259},
+  {80,260}, {80,261}, {80,262}, {80,263}, {80,264}, {80,265}, {80,266}, {80,267}, {80,268}, {80,269}, {80,270}, {80,271},
+  {80,272}, {80,273}, {80,274}, {80,275}, {80,276}, {80,277}, {80,278}, {80,279}, {80,280}, {80,281}, {80,282}, {80,283},
+  {80,284}, {80,285}, {80,286}, {80,287}, {80,288}, {80,289}, {80,290}, {80,291}, {80,292}, {80,293}, {80,294}, {80,295},
+  {80,296}, {80,297}, {80,298}, {80,299}, {80,300}, {80,301}, {80,302}, {80,303}, {80,304}, {80,305}, {80,306}, {80,307},
+  {80,308}, {80,309}, {80,310}, {80,311}, {80,312}, {80,313}, {80,314}, {80,315}, {80,316}, {80,317}, {80,318}, {80,319},
+  {80,320}, {80,321}, {80,322}, {80,323}, {80,324}, {80,325}, {80,326}, {80,327}, {80,328}, {80,329}, {80,330}, {80,331},
+  {80,332}, {80,333}, {80,334}, {80,335}, {80,336}, {80,337}, {80,338}, {80,339}, {80,340}, {80,341}, {80,342}, {80,343},
+  {80,344}, {80,345}, {80,346}, {80,347}, {80,348}, {80,349}, {80,350}, {80,351}, {80,352}, {80,353}, {80,354}, {80,355},
+  {80,356}, {80,357}, {80,358}, {80,359}, {80,360}, {80,361}, {80,362}, {80,363}, {80,364}, {80,365}, {80,366}, {80,367},
+  {80,368}, {80,369}, {80,370}, {80,371}, {80,372}, {80,373}, {80,374}, {80,375}, {80,376}, {80,377}, {80,378}, {80,379},
+  {80,380}, {80,381}, {80,382}, {80,383}, {80,384}, {80,385}, {80,386}, {80,387}, {80,388}, {80,389}, {80,390}, {80,391},
+  {80,392}, {80,393}, {80,394}, {80,395}, {80,396}, {80,397}, {80,398}, {80,399}, {80,400}, {80,401}, {80,402}, {80,403},
+  {80,404}, {80,405}, {80,406}, {80,407}, {80,408}, {80,409}, {80,410}, {80,411}, {80,412}, {80,413}, {80,414}, {80,415},
+  {80,416}, {80,417}, {80,418}, {80,419}, {80,420}, {80,421}, {80,422}, {80,423}, {80,424}, {80,425}, {80,426}, {80,427},
+  {80,428}, {80,429}, {80,430}, {80,431}, {80,432}, {80,433}, {80,434}, {80,435}, {80,436}, {80,437}, {80,438}, {80,439},
+  {80,440}, {80,441}, {80,442}, {80,443}, {80,444}, {80,445}, {80,446}, {80,447}, {80,448}, {80,449}, {80,450}, {80,451},
+  {80,452}, {80,453}, {80,454}, {80,455}, {80,456}, {80,457}, {80,458}, {80,459}, {80,460}, {80,461}, {80,462}, {80,463},
+  {80,464}, {80,465}, {80,466}, {80,467}, {80,468}, {80,469}, {80,470}, {80,471}, {80,472}, {80,473}, {80,474}, {80,475},
+  {80,476}, {80,477}, {80,478}, {80,479}, {80,480}, {80,481}, {80,482}, {80,483}, {80,484}, {80,485}, {80,486}, {80,487},
+  {80,488}, {80,489}, {80,490}, {80,491}, {80,492}, {80,493}, {80,494}, {80,495}, {80,496}, {80,497}, {80,498}, {80,499},
+  {80,500}, {80,501}, {80,502}, {80,503}, {80,504}, {80,505}, {80,506}, {80,507}, {80,508}, {80,509}, {80,510}, {80,511},
+  {80,512}, {80,513}, {80,514}, {80,515}, {80,516}, {80,517}, {80,518}, {80,519}, {80,520}, {80,521}, {80,522}, {80,523},
+  {80,524}, {80,525}, {80,526}, {80,527}, {80,528}, {80,529}, {80,530}, {80,531}, {80,532}, {80,533}, {80,534}, {80,535},
+  {80,536}, {80,537}, {80,538}, {80,539}, {80,540}, {80,541}, {80,542}, {80,543}, {80,544}, {80,545}, {80,546}, {80,547},
+  {80,548}, {80,549}, {80,550}, {80,551}, {80,552}, {80,553}, {80,554}, {80,555}, {80,556}, {80,557}, {80,558}, {80,559},
+  {80,560}, {80,561}, {80,562}, {80,563}, {80,564}, {80,565}, {80,566}, {80,567}, {80,568}, {80,569}, {80,570}, {80,571},
+  {80,572}, {80,573}, {80,574}, {80,575}, {80,576}, {80,577}, {80,578}, {80,579}, {80,580}, {80,581}, {80,582}, {80,583},
+  {80,584}, {80,585}, {80,586}, {80,587}, {80,588}, {80,589}, {80,590}, {80,591}, {80,592}, {80,593}, {80,594}, {80,595},
+  {80,596}, {80,597}, {80,598}, {80,599}, {80,600}, {80,601}, {80,602}, {80,603}, {80,604}, {80,605}, {80,606}, {80,607},
+  {80,608}, {80,609}, {80,610}, {80,611}, {80,612}, {80,613}, {80,614}, {80,615}, {80,616}, {80,617}, {80,618}, {80,619},
+  {80,620}, {80,621}, {80,622}, {80,623}, {80,624}, {80,625}, {80,626}, {80,627}, {80,628}, {80,629}, {80,630}, {80,631},
+  {80,632}, {80,633}, {80,634}, {80,635}, {80,636}, {80,637}, {80,638}, {80,639}, {80,640}, {80,641}, {80,642}, {80,643},
+  {80,644}, {80,645}, {80,646}, {80,647}, {80,648}, {80,649}, {80,650}, {80,651}, {80,652}, {80,653}, {80,654}, {80,655},
+  {80,656}, {80,657}, {80,658}, {80,659}, {80,660}, {80,661}, {80,662}, {80,663}, {80,664}, {80,665}, {80,666}, {80,667},
+  {80,668}, {80,669}, {80,670}, {80,671}, {80,672}, {80,673}, {80,674}, {80,675}, {80,676}, {80,677}, {80,678}, {80,679},
+  {80,680}, {80,681}, {80,682}, {80,683}, {80,684}, {80,685}, {80,686}, {80,687}, {80,688}, {80,689}, {80,690}, {80,691},
+  {80,692}, {80,693}, {80,694}, {80,695}, {80,696}, {80,697}, {80,698}, {80,699}, {80,700}, {80,701}, {80,702}, {80,703},
+  {80,704}, {80,705}, {80,706}, {80,707}, {80,708}, {80,709}, {80,710}, {80,711}, {80,712}, {80,713}, {80,714}, {80,715},
+  {80,716}, {80,717}, {80,718}, {80,719}, {80,720}, {80,721}, {80,722}, {80,723}, {80,724}, {80,725}, {80,726}, {80,727},
+  {80,728}, {80,729}, {80,730}, {80,731}, {80,732}, {80,733}, {80,734}, {80,735}, {80,736}, {80,737}, {80,738}, {80,739},
+  {80,740}, {80,741}, {80,742}, {80,743}, {80,744}, {80,745}, {80,746}, {80,747}, {80,748}, {80,749}, {80,750}, {80,751},
+  {80,752}, {80,753}, {80,754}, {80,755}, {80,756}, {80,757}, {80,758}, {80,759}, {80,760}, {80,761}, {80,762}, {80,763},
+  {80,764}, {80,765}, {80,766}, {80,767}, {80,768}, {80,769}, {80,770}, {80,771}, {80,772}, {80,773}, {80,774}, {80,775},
+  {80,776}, {80,777}, {80,778}, {80,779}, {80,780}, {80,781}, {80,782}, {80,783}, {80,784}, {80,785}, {80,786}, {80,787},
+  {80,788}, {80,789}, {80,790}, {80,791}, {80,792}, {80,793}, {80,794}, {80,795}, {80,796}, {80,797}, {80,798}, {80,799},
+  {80,800}, {80,801}, {80,802}, {80,803}, {80,804}, {80,805}, {80,806}, {80,807}, {80,808}, {80,809}, {80,810}, {80,811},
+  {80,812}, {80,813}, {80,814}, {80,815}, {80,816}, {80,817}, {80,818}, {80,819}, {80,820}, {80,821}, {80,822}, {80,823},
+  {80,824}, {80,825}, {80,826}, {80,827}, {80,828}, {80,829}, {80,830}, {80,831}, {80,832}, {80,833}, {80,834}, {80,835},
+  {80,836}, {80,837}, {80,838}, {80,839}, {80,840}, {80,841}, {80,842}, {80,843}, {80,844}, {80,845}, {80,846}, {80,847},
+  {80,848}, {80,849}, {80,850}, {80,851}, {80,852}, {80,853}, {80,854}, {80,855}, {80,856}, {80,857}, {80,858}, {80,859},
+  {80,860}, {80,861}, {80,862}, {80,863}, {80,864}, {80,865}, {80,866}, {80,867}, {80,868}, {80,869}, {80,870}, {80,871},
+  {80,872}, {80,873}, {80,874}, {80,875}, {80,876}, {80,877}, {80,878}, {80,879}, {80,880}, {80,881}, {80,882}, {80,883},
+  {80,884}, {80,885}, {80,886}, {80,887}, {80,888}, {80,889}, {80,890}, {80,891}, {80,892}, {80,893}, {80,894}, {80,895},
+  {80,896}, {80,897}, {80,898}, {80,899}, {80,900}, {80,901}, {80,902}, {80,903}, {80,904}, {80,905}, {80,906}, {80,907},
+  {80,908}, {80,909}, {80,910}, {80,911}, {80,912}, {80,913}, {80,914}, {80,915}, {80,916}, {80,917}, {80,918}, {80,919},
+  {80,920}, {80,921}, {80,922}, {80,923}, {80,924}, {80,925}, {80,926}, {80,927}, {80,928}, {80,929}, {80,930}, {80,931},
+  {80,932}, {80,933}, {80,934}, {80,935}, {80,936}, {80,937}, {80,938}, {80,939}, {80,940}, {80,941}, {80,942}, {80,943},
+  {80,944}, {80,945}, {80,946}, {80,947}, {80,948}, {80,949}, {80,950}, {80,951}, {80,952}, {80,953}, {80,954}, {80,955},
+  {80,956}, {80,957}, {80,958}, {80,959}, {80,960}, {80,961}, {80,962}, {80,963}, {80,964}, {80,965}, {80,966}, {80,967},
+  {80,968}, {80,969}, {80,970}, {80,971}, {80,972}, {80,973}, {80,974}, {80,975}, {80,976}, {80,977}, {80,978}, {80,979},
+  {80,980}, {80,981}, {80,982}, {80,983}, {80,984}, {80,985}, {80,986}, {80,987}, {80,988}, {80,989}, {80,990}, {80,991},
+  {80,992}, {80,993}, {80,994}, {80,995}, {80,996}, {80,997}, {80,998}, {80,999}, {91,2}, {91,6}, {91,16}, {91,18},
+  {91,21}, {91,22}, {91,26}, {91,32}, {91,36}, {91,41}, {91,54}, {91,77}, {91,87}, {91,88}, {91,89}, {91,90},
+  {91,107}, {91,109}, {91,116}, {91,131}, {91,150}, {91,151}, {91,154}, {91,157}, {91,166}, {91,186}, {91,198}, {91,202},
+  {91,205}, {91,208}, {91,212}, {91,221}, {162,23}, {91,237}, {91,240}, {162,39}, {91,243}, {91,244}, {91,247}, {91,250},
+  {91,264}, {162,42}, {91,268}, {162,49}, {91,270}, {162,97}, {91,276}, {91,285}, {91,288}, {91,289}, {91,292}, {162,38},
+  {91,295}, {162,48}, {91,301}, {91,303}, {91,311}, {162,37}, {91,314}, {91,317}, {91,318}, {162,46}, {91,324}, {91,325},
+  {91,326}, {162,117}, {91,330}, {162,13}, {91,331}, {162,35}, {91,333}, {91,335}, {91,337}, {162,44}, {91,340}, {162,56},
+  {91,342}, {91,343}, {162,32}, {91,344}, {162,45}, {91,348}, {162,138}, {91,354}, {91,361}, {91,362}, {91,366}, {91,375},
+  {162,135}, {91,378}, {91,386}, {91,391}, {91,395}, {162,191}, {91,397}, {91,409}, {162,290}, {91,414}, {162,522}, {91,415},
+  {91,417}, {91,424}, {91,440}, {162,43}, {91,443}, {91,448}, {91,457}, {91,471}, {162,854}, {91,482}, {162,54}, {91,483},
+  {162,51}, {91,488}, {91,491}, {91,502}, {162,649}, {91,527}, {162,158}, {91,534}, {91,538}, {162,853}, {91,540}, {91,549},
+  {91,550}, {91,551}, {91,566}, {162,783}, {91,570}, {91,571}, {162,798}, {91,577}, {91,579}, {91,583}, {162,103}, {91,599},
+  {91,601}, {91,609}, {91,613}, {91,614}, {91,617}, {162,799}, {91,618}, {162,64}, {91,623}, {91,625}, {162,965}, {91,626},
+  {162,926}, {91,641}, {91,655}, {91,667}, {91,678}, {91,702}, {91,715}, {91,727}, {91,738}, {91,743}, {91,748}, {91,761},
+  {91,764}, {91,787}, {91,788}, {91,804}, {91,805}, {91,809}, {91,818}, {91,834}, {91,839}, {91,843}, {91,850}, {91,852},
+  {91,864}, {162,841}, {91,866}, {162,880}, {91,869}, {91,903}, {91,909}, {91,928}, {91,932}, {91,941}, {91,953}, {91,954},
+  {91,958}, {91,972}, {91,978}, {91,987}, {112,24}, {112,30}, {112,33}, {112,35}, {112,37}, {112,43}, {112,46}, {112,47},
+  {112,56}, {112,57}, {112,58}, {112,59}, {112,63}, {112,67}, {112,68}, {112,69}, {112,72}, {112,82}, {112,86}, {112,91},
+  {112,94}, {112,104}, {112,115}, {112,116}, {112,117}, {112,120}, {112,128}, {112,144}, {112,173}, {112,200}, {112,224}, {112,227},
+  {112,229}, {112,262}, {112,299}, {112,338}, {112,347}, {112,386}, {112,429}, {112,441}, {112,474}, {112,506}, {112,570}, {112,580},
+  {112,582}, {112,592}, {112,598}, {112,625}, {112,626}, {112,650}, {112,654}, {112,665}, {112,666}, {112,670}, {112,697}, {112,734},
+  {112,735}, {112,737}, {112,738}, {112,809}, {112,810}, {112,811}, {112,907}, {112,908}, {112,909}, {112,911}, {112,912}, {112,932},
+  {162,0}, {162,6}, {162,7}, {162,28}, {162,41}, {162,47}, {162,59}, {162,65}, {162,71}, {162,75}, {162,89}, {162,98},
+  {162,99}, {162,105}, {162,110}, {162,112}, {162,118}, {162,119}, {162,121}, {162,125}, {162,127}, {162,136}, {162,142}, {162,146},
+  {162,147}, {162,149}, {162,163}, {162,167}, {162,168}, {162,179}, {162,180}, {162,200}, {162,203}, {162,204}, {162,207}, {162,208},
+  {162,215}, {162,216}, {162,231}, {162,246}, {162,259}, {162,261}, {162,263}, {162,268}, {162,270}, {162,291}, {162,298}, {162,305},
+  {162,309}, {162,311}, {162,344}, {162,362}, {162,366}, {162,373}, {162,378}, {162,381}, {162,388}, {162,404}, {162,434}, {162,436},
+  {162,450}, {162,463}, {162,479}, {162,499}, {162,502}, {162,517}, {162,519}, {162,538}, {162,546}, {162,563}, {162,571}, {162,573},
+  {162,575}, {162,576}, {162,606}, {162,610}, {162,615}, {162,646}, {162,655}, {162,657}, {162,659}, {162,671}, {162,695}, {162,704},
+  {162,711}, {162,712}, {162,715}, {162,722}, {162,733}, {162,734}, {162,736}, {162,748}, {162,760}, {162,779}, {162,807}, {162,815},
+  {162,824}, {162,848}, {162,849}, {162,857}, {162,864}, {162,894}, {162,895}, {162,896}, {162,922}, {162,924}, {162,930}, {162,934},
+  {162,937}, {162,940}, {162,941}, {162,946}, {162,947}, {162,975}, {162,981}, {162,982}, {162,993}, {191,0}, {191,1}, {191,2},
+  {191,3}, {191,4}, {191,5}, {191,6}, {191,7}, {191,8}, {191,9}, {191,10}, {191,11}, {191,12}, {191,13}, {191,14},
+  {191,15}, {191,16}, {191,17}, {191,18}, {191,19}, {191,20}, {191,21}, {191,22}, {191,23}, {191,24}, {191,25}, {191,26},
+  {191,27}, {191,28}, {191,29}, {191,30}, {191,31}, {191,32}, {191,33}, {191,34}, {191,35}, {191,36}, {191,37}, {191,38},
+  {191,39}, {191,40}, {191,41}, {191,42}, {191,43}, {191,44}, {191,45}, {191,46}, {191,47}, {191,48}, {191,49}, {191,50},
+  {191,51}, {191,52}, {191,53}, {191,54}, {191,55}, {191,56}, {191,57}, {191,58}, {191,59}, {191,60}, {191,61}, {191,62},
+};
+
+const wa_bigram_dict WA_BIGRAM_DICT = { WA_BIGRAM_DICT_SLOTS, WA_BIGRAM_DICT_ENTRIES, WA_BIGRAM_DICT_POSTINGS, 8191u };
@@ -0,0 +1,12702 @@
+#include "worldalphabets_data.h"
+
+const char *WA_FREQ_0_TOKENS[] = {
+  "сэ",
+  "ащ",
+  "тэ",
+  "ар",
+  "сыд",
+  "сыда",
+  "о",
+  "ыкӏи",
+  "мы",
+  "адыгэ",
+  "ахэр",
+  "ары",
+  "непэ",
+  "зы",
+  "ау",
+  "нахь",
+  "унэм",
+  "ахэмэ",
+  "фэдэ",
+  "ӏоф",
+  "дэгъоу",
+  "еджапӏэм",
+  "e",
+  "тыдэ",
+  "илъэсым",
+  "хэта",
+  "шӏу",
+  "неущ",
+  "дэгъу",
+  "сянэ",
+  "дахэ",
+  "ç",
+  "кӏалэхэр",
+  "лъэшэу",
+  "иӏ",
+  "чъыг",
+  "а",
+  "мэхъу",
+  "нанэ",
+  "тхьапша",
+  "дэжь",
+  "джыри",
+  "шъо",
+  "мыр",
+  "кӏымафэм",
+  "мыщ",
+  "мыекъуапэ",
+  "къалэм",
+  "анахь",
+  "se",
+  "бэрэ",
+  "фэдэу",
+  "е",
+  "псым",
+  "ыцӏэр",
+  "лъэпкъ",
+  "минрэ",
+  "псынкӏэу",
+  "цӏыф",
+  "ины",
+  "классым",
+  "ис",
+  "республикэм",
+  "илъэс",
+  "сятэ",
+  "мэзым",
+  "бэу",
+  "адыгэмэ",
+  "орэд",
+  "зэкӏэ",
+  "бжыхьэм",
+  "сыдэущтэу",
+  "фэда",
+  "ит",
+  "сыхьатыр",
+  "щагум",
+  "тучаным",
+  "кӏалэр",
+  "псы",
+  "дахэу",
+  "хъугъэ",
+  "пае",
+  "гъэмафэм",
+  "дэтых",
+  "апэрэ",
+  "нэнэжъ",
+  "хэт",
+  "чъыгым",
+  "тэкӏо",
+  "къэлэ",
+  "ин",
+  "кӏалэм",
+  "ащыщ",
+  "унэ",
+  "бзыу",
+  "ыгу",
+  "горэ",
+  "тыгъуасэ",
+  "o",
+  "псыхъом",
+  "ежь",
+  "фае",
+  "u",
+  "зыхъукӏэ",
+  "зэфэшъхьафхэр",
+  "aş",
+  "тет",
+  "хьау",
+  "мафэ",
+  "агу",
+  "шъибгъурэ",
+  "тхылъ",
+  "сиӏ",
+  "зэ",
+  "нахьи",
+  "янэ",
+  "джы",
+  "сшы",
+  "бэ",
+  "макӏох",
+  "чӏыпӏэ",
+  "цӏыфым",
+  "бзыухэр",
+  "сикӏас",
+  "ренэу",
+  "кӏэлэцӏыкӏухэр",
+  "сэкӏо",
+  "мафэм",
+  "сыхьат",
+  "мурат",
+  "иӏэх",
+  "дахэхэр",
+  "тадэжь",
+  "угу",
+  "щыт",
+  "чъыӏэ",
+  "сыдигъо",
+  "te",
+  "хьакӏэхэр",
+  "мафэр",
+  "ос",
+  "унэр",
+  "мыӏэрысэ",
+  "sıda",
+  "къэс",
+  "зэкӏэми",
+  "тэтэжъ",
+  "дунаим",
+  "сыгу",
+  "кӏалэхэм",
+  "ощх",
+  "нэмыкӏ",
+  "нэс",
+  "заур",
+  "столым",
+  "em",
+  "дэд",
+  "sıd",
+  "къэсыгъ",
+  "цӏыфмэ",
+  "мафэхэр",
+  "адыгэхэм",
+  "ешӏы",
+  "пшъэшъэжъыем",
+  "адыгеим",
+  "бзылъфыгъэ",
+  "сшыпхъу",
+  "осыр",
+  "тхьапэхэр",
+  "ık",
+  "ı",
+  "уиӏа",
+  "илъ",
+  "i",
+  "ятэ",
+  "сэри",
+  "дахэх",
+  "щэ",
+  "сыдэу",
+  "дэт",
+  "цӏыкӏу",
+  "фабэ",
+  "сыфай",
+  "макӏо",
+  "итых",
+  "рехьы",
+  "тикъалэ",
+  "паркым",
+  "ыӏуагъ",
+  "сабыир",
+  "щыӏэп",
+  "щытыгъ",
+  "ыӏуи",
+  "къуаджэм",
+  "садэжь",
+  "ts",
+  "цӏыфхэм",
+  "тыгъэр",
+  "жьэу",
+  "зи",
+  "зэфэшъхьафхэм",
+  "шъэожъыем",
+  "тхьапш",
+  "и",
+  "тӏокӏырэ",
+  "мэзыр",
+  "пэпчъ",
+  "тхылъым",
+  "пчэдыжьым",
+  "чэтыум",
+  "къэгъагъэхэр",
+  "ıç",
+  "гъэмафэр",
+  "сэры",
+  "тиӏэх",
+  "er",
+  "кӏэлэегъаджэм",
+  "фай",
+  "пчыхьэм",
+  "mı",
+  "къуаджэу",
+  "vo",
+  "цӏыфхэр",
+  "иных",
+  "иӏэп",
+  "апае",
+  "пшъашъэм",
+  "ахэм",
+  "кӏэлэегъэджэ",
+  "татэ",
+  "хэлъ",
+  "аслъан",
+  "къыщыхъугъ",
+  "мыхэр",
+  "къалэу",
+  "тетых",
+  "ядэжь",
+  "цӏыкӏур",
+  "телъ",
+  "yi",
+  "еджэ",
+  "этажым",
+  "нэбгырэ",
+  "зыгорэ",
+  "хы",
+  "бэдзэрым",
+  "фэдиз",
+  "тӏэкӏу",
+  "ar",
+  "еджапӏэр",
+  "яӏэх",
+  "джанэ",
+  "ятӏонэрэ",
+  "кӏэлэцӏыкӏухэм",
+  "ехъу",
+  "сурэт",
+  "сыдигъуи",
+  "чъыгхэр",
+  "хэс",
+  "гъатхэм",
+  "шы",
+  "лӏыжъым",
+  "икӏас",
+  "унагъом",
+  "ыуж",
+  "сэрырэ",
+  "шым",
+  "тимур",
+  "исых",
+  "цӏыкӏум",
+  "ӏэшӏу",
+  "сыщеджэ",
+  "гъогу",
+  "мыгъэ",
+  "шхъуантӏэ",
+  "хьакӏэм",
+  "псыр",
+  "тикласс",
+  "къабзэу",
+  "ş",
+  "бжыхьэр",
+  "еджакӏохэр",
+  "пшъэшъэжъыер",
+  "тиӏ",
+  "иӏэр",
+  "хым",
+  "горэм",
+  "дэдэу",
+  "университетым",
+  "кӏо",
+  "чылэм",
+  "ӏанэм",
+  "исхьакъ",
+  "пцэжъые",
+  "чэлэмэт",
+  "цыгъо",
+  "сэнэхьат",
+  "пшысэхэр",
+  "yêcap",
+  "блэкӏыгъэ",
+  "лъагэ",
+  "мэлхэр",
+  "ынэхэр",
+  "ӏанэр",
+  "къепсы",
+  "илъэсыр",
+  "къысэт",
+  "ӏус",
+  "аӏо",
+  "хатэм",
+  "мэз",
+  "ор",
+  "хэбзэ",
+  "тэри",
+  "чэтыур",
+  "тыгъужъыр",
+  "гъатхэр",
+  "къэкӏуагъ",
+  "ианахь",
+  "къаӏо",
+  "тхьаумафэм",
+  "тетэу",
+  "шыр",
+  "некӏо",
+  "гъэшӏэгъон",
+  "кӏощтых",
+  "кӏымэфэ",
+  "зэфэшъхьафыбэ",
+  "ыпэ",
+  "шъуадэжь",
+  "тиунагъо",
+  "бай",
+  "k",
+  "уянэ",
+  "маф",
+  "етӏанэ",
+  "кӏэлэ",
+  "опсэу",
+  "дэлъ",
+  "жъы",
+  "нурбый",
+  "гущыӏэ",
+  "макъэ",
+  "пшӏыкӏутӏу",
+  "хьакӏэщым",
+  "t",
+  "ашӏэрэр",
+  "чъыгыр",
+  "къэгъэгъэ",
+  "къушъхьэ",
+  "кинэум",
+  "мышъэр",
+  "тихэгъэгу",
+  "ешӏэ",
+  "кӏуагъэ",
+  "инэу",
+  "nêpe",
+  "çç",
+  "сыолъэӏу",
+  "ахьмэд",
+  "ешхы",
+  "фэдэха",
+  "мэфэ",
+  "кӏымафэр",
+  "москва",
+  "тиеджапӏэ",
+  "дэхэ",
+  "урамым",
+  "ex",
+  "дунаир",
+  "уц",
+  "щэпсэух",
+  "зиӏэ",
+  "еджакӏохэм",
+  "лъэпшъ",
+  "шъхьакӏэ",
+  "адыгабзэкӏэ",
+  "къеӏо",
+  "ятэрэ",
+  "тӏокӏитӏурэ",
+  "библиотекэм",
+  "къещхы",
+  "джэнэ",
+  "шъийрэ",
+  "иапэрэ",
+  "цӏыкӏухэр",
+  "пшъашъэхэр",
+  "загъорэ",
+  "тхылъыр",
+  "письмэ",
+  "гот",
+  "тиреспубликэ",
+  "музеим",
+  "щешӏэ",
+  "адыгэхэр",
+  "ӏазэм",
+  "гъэмэфэ",
+  "къэплъан",
+  "мо",
+  "щэпсэу",
+  "кӏэ",
+  "джэгу",
+  "тиунэ",
+  "къин",
+  "тхылъхэр",
+  "ащыгъум",
+  "пчэдыжь",
+  "чӏэс",
+  "ыныбжь",
+  "мыӏэрысэхэр",
+  "axer",
+  "марыет",
+  "унэгъо",
+  "заом",
+  "апэу",
+  "къэкӏо",
+  "пстэуми",
+  "тӏокӏищрэ",
+  "мэфэкӏ",
+  "бзыухэм",
+  "баджэм",
+  "шъэныкъорэ",
+  "чӏыпӏэр",
+  "ешӏых",
+  "сымэджэщым",
+  "ящэнэрэ",
+  "pş",
+  "чӏэт",
+  "ышъхьэ",
+  "зэхъум",
+  "oç",
+  "ныбжьыкӏэ",
+  "сэнэхьатыр",
+  "шэн",
+  "ишӏуагъэ",
+  "спортым",
+  "иунэ",
+  "якӏас",
+  "хъугъэх",
+  "щегъэжьагъэу",
+  "гу",
+  "ащи",
+  "фыжь",
+  "пщэрыхьапӏэм",
+  "шкафым",
+  "eu",
+  "хэсых",
+  "щеджэ",
+  "штэ",
+  "еджэпӏэ",
+  "дэгъухэр",
+  "тыкӏощт",
+  "тфырэ",
+  "дэдэ",
+  "щашӏэ",
+  "къогъум",
+  "орэдхэр",
+  "ащыщэу",
+  "ӏофшӏэныр",
+  "мэзэ",
+  "курсым",
+  "ныом",
+  "чэщ",
+  "адэжь",
+  "россием",
+  "ыпэкӏэ",
+  "хъумэ",
+  "театрам",
+  "уахътэм",
+  "игъогу",
+  "къыхэкӏэу",
+  "a",
+  "хъун",
+  "ашӏэ",
+  "исыр",
+  "хъущта",
+  "макӏэу",
+  "сцӏэр",
+  "лы",
+  "тэры",
+  "стадионым",
+  "тӏокӏиплӏрэ",
+  "инэп",
+  "ибрахьим",
+  "блым",
+  "khek",
+  "бгъум",
+  "классыр",
+  "джанэр",
+  "къесы",
+  "теуцожь",
+  "унэмкӏэ",
+  "жьы",
+  "чэтхэр",
+  "джыдэдэм",
+  "хэгъэгум",
+  "дэдэм",
+  "паркыр",
+  "зыр",
+  "щыӏ",
+  "alexer",
+  "мэхьанэшхо",
+  "xeta",
+  "хьэр",
+  "районым",
+  "пшъэшъэжъыехэм",
+  "заулэ",
+  "къазхэр",
+  "мазэм",
+  "хэгъэгу",
+  "ышӏэрэр",
+  "непэрэ",
+  "унагъо",
+  "ӏофэу",
+  "дэпкъым",
+  "дакӏом",
+  "кӏуагъэх",
+  "пӏомэ",
+  "мафэхэм",
+  "arı",
+  "zı",
+  "axeme",
+  "сэфэр",
+  "нурыет",
+  "адэ",
+  "игъо",
+  "спорт",
+  "тыдэкӏи",
+  "кӏэлэеджакӏохэр",
+  "къэкӏуагъэх",
+  "гъэшӏэгъонхэр",
+  "яӏ",
+  "псэушъхьэ",
+  "еӏо",
+  "шъукъакӏу",
+  "шъыпкъэ",
+  "of",
+  "хьакӏэр",
+  "губгъом",
+  "zeç",
+  "хьалыжъо",
+  "урокхэр",
+  "as",
+  "щыӏа",
+  "къэбар",
+  "осым",
+  "чӏыгур",
+  "ищыкӏагъ",
+  "еджэх",
+  "сис",
+  "чэщым",
+  "ныбжьыкӏэхэм",
+  "тэтэжърэ",
+  "якӏасэх",
+  "кум",
+  "исхэр",
+  "пшъашъэр",
+  "алый",
+  "мэдинэ",
+  "ыӏыгъэу",
+  "ятэхэм",
+  "матэм",
+  "амал",
+  "орырэ",
+  "республикэу",
+  "шъабэ",
+  "мэкъэ",
+  "къэкӏощт",
+  "хьэ",
+  "ина",
+  "плъэкӏыщт",
+  "сиунагъо",
+  "ныбджэгъубэ",
+  "жьыбгъэ",
+  "цӏыфыр",
+  "усэ",
+  "лъэпкъыр",
+  "уфаемэ",
+  "плъыжьы",
+  "сыщыӏагъ",
+  "пасэу",
+  "агъакӏо",
+  "лӏыжъыр",
+  "моу",
+  "мышӏэми",
+  "пшӏыкӏутф",
+  "чылэ",
+  "хъущтэп",
+  "къабзэ",
+  "дунэе",
+  "лӏыр",
+  "уасэ",
+  "километрэ",
+  "зэу",
+  "конфет",
+  "иӏэу",
+  "мары",
+  "гъэнэфагъэ",
+  "ешӏэх",
+  "tıde",
+  "nêuş",
+  "ӏофым",
+  "vunem",
+  "къыхэкӏы",
+  "nane",
+  "адрэр",
+  "хьамид",
+  "ыпашъхьэ",
+  "чэмыр",
+  "шхын",
+  "усэхэр",
+  "къаз",
+  "щыс",
+  "икӏалэ",
+  "студентхэр",
+  "хьакъу",
+  "шыкъухэр",
+  "хъущт",
+  "тикъуаджэ",
+  "сиӏэх",
+  "ныбджэгъу",
+  "шъхьэгуащэ",
+  "кӏэлэегъаджэр",
+  "тыркуем",
+  "акъыл",
+  "ацӏэхэр",
+  "телевизорым",
+  "ошӏэ",
+  "урокыр",
+  "ным",
+  "уӏукӏэмэ",
+  "кавказым",
+  "нан",
+  "değou",
+  "ӏанэ",
+  "ağ",
+  "къакӏо",
+  "алъэгъу",
+  "блырэ",
+  "уахътэр",
+  "кӏэлэеджакӏохэм",
+  "сигуапэ",
+  "гущыӏэхэр",
+  "мин",
+  "кӏасэу",
+  "дах",
+  "къыщегъэжьагъэу",
+  "сэлам",
+  "ежьырэу",
+  "къэбаскъи",
+  "пшы",
+  "къушъхьэм",
+  "бзэ",
+  "куп",
+  "шӏухьафтынхэр",
+  "дэгъур",
+  "зыпари",
+  "еоӏо",
+  "гъэшӏэгъонэу",
+  "анахьэу",
+  "жъогъо",
+  "mak",
+  "ox",
+  "театрэм",
+  "зэтегъэпсыхьагъ",
+  "oşt",
+  "пшъашъэхэм",
+  "сипшъэшъэгъу",
+  "сурэтым",
+  "тӏокӏиплӏырэ",
+  "къабзэх",
+  "псынкӏэ",
+  "хьалыгъур",
+  "гъогухэр",
+  "чӏыпӏэхэр",
+  "сянэжъ",
+  "мэбыбыжьых",
+  "тихэку",
+  "тыда",
+  "daxe",
+  "бзыур",
+  "им",
+  "я",
+  "лъэпкъым",
+  "игъом",
+  "хэкум",
+  "щамилэ",
+  "ӏофыр",
+  "умарэ",
+  "ищагу",
+  "лъагэу",
+  "сарыет",
+  "гъучӏ",
+  "янэрэ",
+  "дэдэх",
+  "орэдым",
+  "чэрэзыр",
+  "шӏуцӏэ",
+  "mır",
+  "нэӏуасэ",
+  "зыгъэпсэфыгъо",
+  "руслъан",
+  "макӏэ",
+  "кӏыхьэ",
+  "лагъэхэр",
+  "мэщбэшӏэ",
+  "охъу",
+  "теджэ",
+  "синыбджэгъу",
+  "емыкӏу",
+  "джанэхэр",
+  "сыдигъуа",
+  "усакӏу",
+  "нэмыкӏэу",
+  "бгъурэ",
+  "сыкъэкӏощт",
+  "ныӏэп",
+  "мэбыбы",
+  "дэс",
+  "ыӏэ",
+  "щэджагъом",
+  "нахьыжъхэм",
+  "ышыпхъу",
+  "къыщэкӏых",
+  "фабэхэм",
+  "дэмышӏэу",
+  "uağ",
+  "гухэлъ",
+  "охътэ",
+  "ıx",
+  "зэрэхабзэу",
+  "ççı",
+  "дэсых",
+  "укӏощта",
+  "зэрысыр",
+  "цэй",
+  "ибрахьимэ",
+  "бэмэ",
+  "нэмыкӏхэри",
+  "кӏэко",
+  "мэлахъом",
+  "мэчъые",
+  "апэ",
+  "лъэпкъэу",
+  "къызбэч",
+  "дахэр",
+  "биболэт",
+  "стол",
+  "къеджагъ",
+  "лэжьакӏохэм",
+  "псыхъоу",
+  "сэнэхьатэу",
+  "ӏут",
+  "чъыгмэ",
+  "ехьы",
+  "хоккей",
+  "цуакъэхэр",
+  "aler",
+  "солдатыр",
+  "бзыумэ",
+  "au",
+  "пстэури",
+  "нэмыкӏхэр",
+  "haç",
+  "лые",
+  "ımafem",
+  "elets",
+  "ış",
+  "exer",
+  "сипшъашъ",
+  "синыбджэгъухэр",
+  "si",
+  "маим",
+  "дэхэнагъо",
+  "коцыр",
+  "боу",
+  "метрэ",
+  "къыӏуагъ",
+  "лӏы",
+  "пчъэм",
+  "сян",
+  "усэр",
+  "шъуиӏэхэр",
+  "тхьауегъэпсэу",
+  "уатэ",
+  "къыблэм",
+  "урысыбзэр",
+  "гущыӏэм",
+  "пшӏыкӏузым",
+  "пхъэ",
+  "ышӏэрэп",
+  "дышъэ",
+  "насыпыр",
+  "хьацӏэ",
+  "сшӏоигъу",
+  "щишӏэрэр",
+  "фатимэ",
+  "ахъщэ",
+  "бзылъфыгъэм",
+  "хьакӏэу",
+  "хьэм",
+  "къепщэ",
+  "пшахъо",
+  "ыцӏэ",
+  "щэкӏ",
+  "фэдизэу",
+  "хьамзэт",
+  "зыми",
+  "сабыйхэр",
+  "зым",
+  "къэтэдж",
+  "щыгъын",
+  "узыфаер",
+  "шъоур",
+  "мачъэ",
+  "такъикъ",
+  "мыекъопэ",
+  "янэжъ",
+  "умар",
+  "тыгъэм",
+  "налбый",
+  "плъыжь",
+  "пылъагъ",
+  "тикъэралыгъо",
+  "итэу",
+  "сыныбжь",
+  "ti",
+  "şso",
+  "быракъ",
+  "бэлыджэр",
+  "илъэпкъ",
+  "чылэр",
+  "бзылъфыгъэхэм",
+  "тигъунэгъухэм",
+  "ошӏа",
+  "имызакъоу",
+  "шыхэр",
+  "шхъуантӏэх",
+  "иусэхэр",
+  "хашӏыкӏы",
+  "мэхьанэ",
+  "уиӏэр",
+  "сэшӏэ",
+  "хьэсанэ",
+  "тиӏагъ",
+  "пшӏэн",
+  "пхъэгулъ",
+  "илъэсыкӏэм",
+  "хэтэрыкӏхэр",
+  "укӏытэм",
+  "урокым",
+  "сикӏасэх",
+  "ма",
+  "ныбжьыкӏэхэр",
+  "гос",
+  "тхакӏом",
+  "нэнэжърэ",
+  "ори",
+  "цӏэ",
+  "сомэ",
+  "ащеджэх",
+  "ашӏых",
+  "чэмхэр",
+  "шӏэныгъэм",
+  "ya",
+  "lheşşeu",
+  "джащ",
+  "щыӏэх",
+  "зырэ",
+  "чъыгхэм",
+  "краснодар",
+  "гъэпсэфыгъо",
+  "хьаткъо",
+  "elo",
+  "икӏасэх",
+  "бзылъфыгъэмэ",
+  "щылэ",
+  "ӏэкӏыб",
+  "урыс",
+  "чӏым",
+  "feda",
+  "едых",
+  "къыхэкӏыкӏэ",
+  "ошъогум",
+  "тӏокӏищырэ",
+  "къушъхьэхэр",
+  "кӏасэ",
+  "къысфэгъэгъу",
+  "зыщагъэпсэфы",
+  "къихьагъ",
+  "илъэсхэм",
+  "щыр",
+  "мэл",
+  "машинэхэр",
+  "лагъэм",
+  "syane",
+  "телъа",
+  "кӏэлэеджакӏом",
+  "тӏокӏым",
+  "уиӏэха",
+  "пхъэшъхьэ",
+  "дэлъых",
+  "тхъуи",
+  "ицӏыкӏугъом",
+  "губжыгъэу",
+  "дэджэгу",
+  "осэӏо",
+  "ӏофшӏэнхэр",
+  "тефагъ",
+  "тхьапшым",
+  "хэлъэу",
+  "ӏэл",
+  "столыр",
+  "зэкӏэмэ",
+  "мэхъух",
+  "къысэтба",
+  "иурам",
+  "сэлъэгъу",
+  "щыщ",
+  "uxer",
+  "mexhu",
+  "афэгъэхьыгъэх",
+  "адэӏэпыӏэх",
+  "быбыжьыгъэх",
+  "библиотекам",
+  "акъылыр",
+  "тфы",
+  "фэбэ",
+  "нахьыжъым",
+  "мэджэгу",
+  "щырэ",
+  "жьым",
+  "зэкӏэри",
+  "мазэр",
+  "ахэлъ",
+  "илъэп",
+  "щэр",
+  "жьыр",
+  "ӏоныгъор",
+  "иӏэха",
+  "итыр",
+  "плъэкӏыщтыр",
+  "щесых",
+  "сикӏал",
+  "нахьыжъ",
+  "натрыф",
+  "зэтет",
+  "dej",
+  "гъэтхапэм",
+  "юрэ",
+  "тэшхы",
+  "мэзхэм",
+  "зэрэунагъоу",
+  "къыхьыгъ",
+  "джэгум",
+  "хъусен",
+  "типсыхъо",
+  "чыжьэу",
+  "хэлъыр",
+  "къэрэур",
+  "ытхыгъ",
+  "еджэныр",
+  "гъогум",
+  "тхылъэу",
+  "чӏыпӏэм",
+  "ягъо",
+  "экскурсие",
+  "нычэпэ",
+  "лъэныкъомкӏэ",
+  "нэшэбэгухэр",
+  "къэси",
+  "щэламэ",
+  "чан",
+  "псыхъо",
+  "yinı",
+  "зыгорэм",
+  "чъыгхатэм",
+  "кӏалэмэ",
+  "ныор",
+  "тиуниверситет",
+  "си",
+  "дэтыр",
+  "хэтэ",
+  "апшъэрэ",
+  "бзэр",
+  "тищагу",
+  "къэкӏох",
+  "адрэ",
+  "жъоныгъуакӏэм",
+  "сыщэпсэу",
+  "фэд",
+  "klassım",
+  "erer",
+  "надия",
+  "къыблэ",
+  "тиунагъокӏэ",
+  "физкультурэ",
+  "былым",
+  "къалэр",
+  "lh",
+};
+const uint16_t WA_FREQ_0_RANKS[] = {
+  485, 98, 0, 0, 654, 0, 136, 990, 260, 0, 951, 458, 881, 183, 0, 400,
+  543, 191, 784, 846, 749, 411, 242, 0, 0, 513, 0, 0, 673, 689, 0, 0,
+  0, 773, 0, 0, 0, 0, 0, 0, 82, 0, 0, 0, 0, 0, 409, 0,
+  0, 0, 73, 35, 325, 622, 721, 839, 0, 584, 0, 0, 0, 0, 0, 0,
+  0, 0, 291, 626, 90, 0, 256, 978, 0, 492, 0, 0, 0, 0, 318, 0,
+  0, 982, 0, 0, 0, 0, 298, 7, 736, 849, 0, 88, 713, 605, 43, 698,
+  870, 0, 0, 9, 422, 0, 0, 0, 329, 909, 0, 0, 0, 781, 0, 0,
+  0, 0, 521, 0, 924, 0, 0, 577, 328, 568, 506, 342, 624, 0, 300, 0,
+  762, 0, 0, 722, 0, 709, 245, 263, 358, 746, 755, 976, 938, 0, 46, 255,
+  344, 480, 0, 0, 141, 0, 933, 0, 0, 691, 0, 165, 64, 303, 147, 363,
+  466, 0, 920, 0, 139, 0, 0, 0, 312, 0, 94, 0, 0, 682, 436, 0,
+  0, 0, 0, 539, 671, 261, 686, 778, 270, 0, 628, 986, 0, 0, 0, 0,
+  0, 0, 39, 0, 486, 228, 142, 0, 0, 0, 0, 0, 0, 111, 0, 0,
+  0, 0, 0, 511, 0, 0, 0, 0, 0, 254, 0, 0, 0, 0, 0, 0,
+  258, 765, 497, 0, 135, 552, 0, 108, 828, 0, 0, 78, 477, 115, 856, 93,
+  276, 399, 0, 0, 571, 0, 241, 970, 0, 0, 137, 317, 760, 999, 0, 0,
+  600, 138, 748, 0, 0, 0, 253, 285, 0, 0, 362, 0, 0, 0, 0, 955,
+  0, 292, 79, 0, 0, 505, 0, 0, 0, 0, 205, 109, 811, 914, 0, 0,
+  0, 0, 0, 0, 0, 0, 26, 0, 0, 0, 150, 0, 0, 0, 0, 449,
+  538, 0, 375, 0, 0, 390, 0, 0, 815, 0, 0, 963, 981, 0, 659, 42,
+  697, 203, 0, 0, 0, 0, 0, 0, 816, 987, 0, 0, 0, 0, 0, 0,
+  0, 0, 660, 0, 0, 866, 0, 783, 0, 583, 271, 0, 837, 965, 0, 0,
+  504, 735, 0, 249, 146, 607, 667, 0, 37, 218, 531, 802, 0, 614, 0, 0,
+  0, 0, 704, 586, 0, 0, 0, 0, 0, 0, 0, 0, 116, 652, 853, 0,
+  0, 609, 972, 0, 0, 0, 908, 508, 0, 227, 0, 0, 821, 0, 0, 243,
+  639, 0, 69, 0, 0, 25, 259, 0, 0, 18, 769, 0, 0, 0, 974, 0,
+  0, 288, 0, 85, 0, 0, 0, 0, 0, 0, 0, 175, 0, 95, 470, 0,
+  0, 0, 549, 472, 0, 45, 732, 59, 225, 471, 594, 927, 210, 0, 0, 3,
+  0, 61, 0, 0, 179, 0, 566, 401, 0, 0, 0, 0, 419, 0, 0, 0,
+  379, 0, 0, 918, 716, 960, 0, 0, 0, 0, 24, 0, 0, 10, 230, 468,
+  0, 1000, 0, 0, 0, 642, 0, 0, 676, 714, 410, 0, 490, 729, 0, 398,
+  84, 327, 163, 478, 530, 387, 572, 833, 0, 0, 0, 0, 0, 96, 581, 0,
+  0, 223, 122, 267, 893, 0, 0, 0, 0, 0, 36, 357, 0, 304, 0, 0,
+  151, 606, 610, 204, 131, 459, 0, 0, 0, 0, 794, 0, 128, 290, 366, 89,
+  957, 0, 0, 0, 0, 0, 0, 316, 834, 953, 0, 0, 0, 861, 0, 0,
+  0, 0, 0, 0, 321, 0, 0, 0, 0, 364, 0, 266, 265, 0, 289, 852,
+  58, 0, 0, 0, 0, 779, 0, 0, 22, 0, 731, 83, 129, 417, 522, 633,
+  0, 656, 0, 602, 0, 0, 0, 301, 359, 0, 863, 0, 481, 0, 0, 0,
+  578, 0, 353, 454, 0, 268, 0, 0, 512, 0, 70, 0, 968, 0, 284, 0,
+  324, 441, 767, 326, 209, 0, 384, 515, 526, 567, 345, 527, 761, 824, 0, 0,
+  0, 0, 0, 0, 177, 523, 0, 916, 495, 0, 911, 474, 903, 876, 0, 0,
+  395, 0, 15, 859, 621, 348, 463, 813, 771, 351, 0, 0, 995, 0, 0, 0,
+  75, 0, 81, 0, 0, 0, 0, 0, 192, 4, 158, 257, 643, 708, 826, 827,
+  197, 959, 0, 0, 546, 0, 371, 354, 847, 181, 413, 855, 0, 0, 0, 16,
+  0, 923, 0, 0, 299, 438, 224, 928, 0, 0, 564, 0, 0, 715, 446, 0,
+  0, 356, 382, 532, 130, 757, 973, 296, 0, 234, 897, 836, 0, 0, 0, 0,
+  0, 0, 114, 741, 845, 278, 848, 750, 0, 0, 0, 0, 0, 145, 0, 0,
+  264, 0, 0, 127, 907, 148, 0, 372, 0, 0, 0, 0, 0, 0, 782, 0,
+  0, 0, 838, 0, 0, 0, 805, 764, 766, 97, 0, 341, 33, 0, 525, 625,
+  167, 0, 589, 831, 895, 0, 0, 0, 0, 0, 0, 41, 565, 585, 888, 14,
+  0, 99, 423, 829, 460, 871, 788, 0, 0, 0, 517, 0, 0, 211, 0, 0,
+  0, 670, 844, 0, 0, 883, 0, 0, 465, 0, 696, 0, 0, 935, 0, 5,
+  244, 650, 900, 934, 184, 917, 0, 323, 0, 0, 0, 273, 0, 0, 38, 0,
+  507, 0, 562, 885, 0, 161, 977, 889, 0, 66, 0, 0, 380, 0, 0, 0,
+  675, 533, 182, 780, 0, 0, 0, 0, 0, 0, 0, 0, 723, 0, 174, 408,
+  0, 0, 0, 0, 0, 374, 541, 534, 787, 335, 941, 878, 943, 206, 502, 295,
+  806, 579, 0, 0, 0, 0, 747, 0, 949, 0, 0, 0, 412, 887, 890, 236,
+  518, 598, 0, 969, 926, 0, 922, 0, 925, 0, 435, 187, 0, 0, 0, 0,
+  0, 415, 0, 0, 0, 77, 0, 0, 76, 0, 0, 0, 0, 0, 0, 0,
+  0, 809, 0, 0, 0, 0, 0, 62, 237, 958, 0, 499, 658, 0, 0, 0,
+  0, 0, 176, 51, 110, 501, 623, 840, 0, 0, 347, 726, 0, 545, 0, 956,
+  381, 717, 570, 739, 0, 0, 975, 0, 835, 307, 619, 0, 0, 0, 121, 964,
+  186, 0, 0, 0, 57, 0, 0, 91, 0, 677, 793, 812, 385, 157, 822, 0,
+  0, 0, 0, 0, 0, 0, 0, 361, 0, 0, 376, 0, 0, 688, 0, 0,
+  725, 985, 378, 599, 0, 0, 447, 0, 247, 332, 587, 105, 0, 0, 452, 0,
+  0, 0, 0, 0, 998, 0, 0, 0, 31, 48, 0, 0, 0, 0, 68, 473,
+  936, 0, 346, 427, 631, 988, 0, 0, 0, 199, 484, 681, 548, 617, 0, 80,
+  756, 679, 752, 966, 87, 405, 0, 0, 891, 0, 0, 0, 331, 573, 666, 424,
+  929, 0, 0, 0, 0, 286, 67, 630, 611, 0, 0, 160, 368, 0, 0, 0,
+  0, 0, 0, 0, 350, 0, 173, 738, 308, 702, 734, 867, 0, 946, 0, 0,
+  0, 0, 0, 0, 319, 772, 0, 0, 537, 0, 252, 313, 310, 678, 0, 0,
+  0, 0, 0, 0, 0, 0, 575, 314, 437, 451, 0, 683, 694, 808, 0, 912,
+  0, 705, 601, 0, 216, 0, 0, 0, 0, 593, 894, 615, 112, 641, 591, 616,
+  980, 0, 0, 155, 0, 0, 0, 311, 629, 872, 0, 0, 758, 785, 28, 0,
+  886, 0, 0, 0, 27, 0, 620, 645, 0, 0, 0, 0, 0, 277, 0, 0,
+  71, 159, 330, 369, 899, 0, 919, 0, 0, 464, 510, 132, 0, 0, 279, 0,
+  0, 0, 745, 0, 0, 763, 72, 0, 0, 462, 467, 0, 0, 786, 0, 0,
+  665, 0, 53, 55, 0, 636, 931, 305, 635, 875, 213, 370, 901, 476, 282, 489,
+  947, 0, 152, 535, 196, 520, 0, 0, 414, 429, 439, 334, 392, 634, 701, 185,
+  246, 590, 0, 0, 0, 239, 0, 169, 0, 0, 0, 0, 0, 0, 0, 0,
+  168, 664, 0, 0, 432, 0, 0, 0, 120, 0, 0, 882, 0, 854, 0, 0,
+  0, 536, 404, 0, 0, 613, 355, 0, 720, 759, 0, 823, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 743, 942, 792, 0, 21, 994, 0, 0, 819, 0, 596,
+  684, 740, 193, 0, 0, 0, 0, 662, 0, 0, 188, 251, 0, 143, 171, 0,
+  360, 74, 40, 800, 873, 0, 841, 0, 0, 0, 0, 0, 0, 491, 0, 0,
+  0, 0, 0, 0, 519, 884, 649, 804, 0, 0, 874, 661, 217, 0, 0, 0,
+  240, 557, 0, 0, 795, 208, 54, 349, 950, 0, 0, 807, 0, 0, 777, 0,
+  0, 456, 226, 672, 906, 0, 430, 0, 0, 0, 391, 30, 561, 754, 0, 0,
+  493, 86, 498, 663, 728, 706, 124, 524, 386, 107, 648, 406, 294, 352, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 817, 653, 0, 0,
+  479, 967, 397, 553, 297, 657, 0, 0, 948, 0, 123, 718, 434, 0, 0, 0,
+  103, 0, 699, 0, 0, 0, 0, 0, 0, 796, 0, 388, 540, 724, 0, 0,
+  651, 0, 0, 231, 799, 0, 559, 425, 0, 0, 0, 0, 864, 0, 0, 703,
+  991, 0, 862, 221, 0, 0, 727, 730, 0, 0, 125, 403, 461, 0, 0, 0,
+  8, 647, 0, 555, 0, 144, 0, 302, 373, 0, 198, 711, 0, 149, 220, 851,
+  603, 118, 433, 842, 904, 475, 529, 712, 269, 0, 0, 32, 153, 733, 910, 989,
+  60, 389, 814, 29, 569, 582, 753, 0, 0, 0, 0, 979, 0, 0, 0, 11,
+  189, 250, 0, 0, 0, 0, 0, 868, 0, 0, 0, 544, 803, 983, 12, 19,
+  0, 0, 0, 0, 952, 214, 272, 65, 820, 0, 687, 0, 0, 194, 280, 0,
+  0, 0, 516, 774, 913, 751, 0, 0, 0, 0, 0, 444, 275, 367, 215, 283,
+  801, 940, 0, 0, 448, 843, 443, 551, 597, 737, 488, 0, 0, 450, 49, 0,
+  13, 106, 646, 178, 877, 0, 0, 0, 0, 0, 393, 431, 394, 172, 50, 797,
+  195, 0, 0, 377, 961, 0, 407, 818, 0, 0, 0, 494, 0, 207, 287, 496,
+  134, 604, 825, 23, 235, 556, 880, 0, 0, 0, 0, 0, 102, 293, 0, 483,
+  453, 770, 939, 0, 202, 0, 0, 0, 996, 574, 500, 0, 860, 100, 101, 248,
+  528, 915, 0, 336, 190, 0, 0, 469, 0, 0, 0, 402, 0, 0, 0, 421,
+  0, 0, 0, 954, 554, 669, 238, 0, 0, 164, 0, 776, 0, 0, 0, 0,
+  905, 0, 0, 0, 0, 0, 707, 0, 0, 126, 343, 0, 0, 2, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 580, 0, 503, 180, 0, 0, 547, 0,
+  0, 0, 232, 315, 608, 710, 0, 0, 0, 0, 0, 0, 428, 0, 0, 0,
+  668, 0, 0, 0, 44, 865, 0, 0, 63, 274, 857, 113, 930, 156, 0, 0,
+  0, 0, 6, 944, 0, 0, 154, 0, 0, 832, 0, 0, 262, 0, 0, 0,
+  0, 0, 632, 896, 0, 0, 700, 56, 0, 309, 416, 320, 892, 0, 640, 932,
+  426, 542, 588, 0, 487, 810, 0, 0, 0, 0, 0, 17, 550, 0, 0, 20,
+  333, 0, 0, 0, 0, 576, 693, 0, 92, 0, 0, 0, 0, 0, 719, 0,
+  0, 791, 0, 0, 0, 0, 338, 0, 858, 420, 850, 0, 563, 898, 133, 233,
+  0, 0, 337, 0, 0, 0, 0, 0, 627, 674, 0, 0, 445, 482, 509, 595,
+  0, 0, 52, 455, 104, 962, 0, 0, 902, 0, 200, 170, 0, 0, 997, 638,
+  0, 0, 0, 0, 0, 339, 790, 992, 0, 0, 0, 0, 0, 0, 0, 0,
+  690, 0, 685, 0, 0, 0, 0, 162, 0, 0, 0, 592, 0, 1, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 340, 695, 119, 742, 0, 744,
+  0, 0, 0, 0, 0, 0, 644, 0, 0, 0, 0, 0, 322, 0, 879, 0,
+  0, 0, 0, 0, 212, 0, 612, 0, 0, 0, 0, 34, 365, 222, 0, 383,
+  0, 0, 0, 0, 0, 442, 0, 0, 945, 971, 0, 0, 768, 0, 0, 0,
+  0, 0, 0, 0, 281, 396, 0, 0, 937, 0, 0, 47, 0, 229, 798, 219,
+  0, 680, 921, 775, 0, 0, 0, 0, 457, 558, 0, 514, 560, 0, 0, 0,
+  0, 0, 0, 0, 166, 0, 0, 0, 0, 0, 0, 0, 984, 0, 440, 618,
+  201, 637, 655, 692, 789, 306, 418, 869, 993, 0, 140, 0, 0, 830, 117, 0,
+};
+
+const char *WA_FREQ_1_TOKENS[] = {
+  "die",
+  "nie",
+  "ek",
+  "is",
+  "het",
+  "jy",
+  "n",
+  "dit",
+  "my",
+  "en",
+  "ons",
+  "wat",
+  "jou",
+  "van",
+  "in",
+  "te",
+  "hy",
+  "vir",
+  "sy",
+  "maar",
+  "gaan",
+  "sal",
+  "kan",
+  "om",
+  "dis",
+  "so",
+  "u",
+  "met",
+  "dat",
+  "hulle",
+  "as",
+  "was",
+  "ja",
+  "kom",
+  "moet",
+  "nou",
+  "hier",
+  "daar",
+  "op",
+  "wil",
+  "na",
+  "hom",
+  "weet",
+  "haar",
+  "aan",
+  "wees",
+  "net",
+  "nee",
+  "doen",
+  "nog",
+  "goed",
+  "dan",
+  "hoe",
+  "ook",
+  "word",
+  "s",
+  "sien",
+  "julle",
+  "laat",
+  "by",
+  "al",
+  "sê",
+  "se",
+  "baie",
+  "hierdie",
+  "soos",
+  "maak",
+  "dink",
+  "of",
+  "toe",
+  "waar",
+  "oor",
+  "alles",
+  "een",
+  "niks",
+  "uit",
+  "hou",
+  "bly",
+  "iets",
+  "waarom",
+  "wie",
+  "meer",
+  "sou",
+  "kry",
+  "kyk",
+  "goeie",
+  "man",
+  "dankie",
+  "weer",
+  "deur",
+  "tog",
+  "praat",
+  "gee",
+  "dag",
+  "vertel",
+  "geen",
+  "werk",
+  "hê",
+  "weg",
+  "nooit",
+  "wel",
+  "almal",
+  "reg",
+  "kon",
+  "mense",
+  "lewe",
+  "wag",
+  "altyd",
+  "terug",
+  "wou",
+  "dood",
+  "sit",
+  "ma",
+  "daardie",
+  "moenie",
+  "o",
+  "gesê",
+  "bietjie",
+  "ander",
+  "saam",
+  "mooi",
+  "help",
+  "mag",
+  "vra",
+  "lyk",
+  "voor",
+  "majesteit",
+  "tyd",
+  "asseblief",
+  "vrou",
+  "ken",
+  "tot",
+  "god",
+  "regtig",
+  "iemand",
+  "groot",
+  "seker",
+  "neem",
+  "twee",
+  "want",
+  "eers",
+  "nodig",
+  "kind",
+  "af",
+  "jammer",
+  "miskien",
+  "hoor",
+  "beter",
+  "begin",
+  "gedoen",
+  "meneer",
+  "anders",
+  "jaar",
+  "gebeur",
+  "gesien",
+  "verstaan",
+  "los",
+  "pa",
+  "probeer",
+  "vader",
+  "huis",
+  "elke",
+  "natuurlik",
+  "omdat",
+  "moes",
+  "lank",
+  "mnr",
+  "môre",
+  "gelukkig",
+  "glo",
+  "gou",
+  "eerste",
+  "mens",
+  "alleen",
+  "kinders",
+  "naam",
+  "lief",
+  "speel",
+  "seun",
+  "genoeg",
+  "niemand",
+  "staan",
+  "gedink",
+  "sonder",
+  "vergeet",
+  "voel",
+  "slaap",
+  "luister",
+  "liefde",
+  "selfs",
+  "heer",
+  "klein",
+  "verkeerd",
+  "vandag",
+  "bedoel",
+  "nuwe",
+  "daarvan",
+  "soek",
+  "geld",
+  "teen",
+  "graag",
+  "hoekom",
+  "stop",
+  "t",
+  "self",
+  "onder",
+  "bring",
+  "ag",
+  "liewe",
+  "eet",
+  "onthou",
+  "ou",
+  "keer",
+  "gehad",
+  "de",
+  "vind",
+  "plek",
+  "land",
+  "moeder",
+  "wanneer",
+  "stil",
+  "dae",
+  "gekom",
+  "mamma",
+  "verskoon",
+  "geweet",
+  "skryf",
+  "sissi",
+  "gekry",
+  "ontmoet",
+  "lees",
+  "drink",
+  "gebruik",
+  "lekker",
+  "eie",
+  "nag",
+  "mekaar",
+  "kamer",
+  "totsiens",
+  "leer",
+  "geluk",
+  "watter",
+  "vriend",
+  "verloor",
+  "anna",
+  "paar",
+  "laaste",
+  "hele",
+  "bang",
+  "raak",
+  "later",
+  "pas",
+  "hart",
+  "alle",
+  "verander",
+  "gehoor",
+  "dalk",
+  "sing",
+  "wêreld",
+  "gemaak",
+  "volgende",
+  "hoop",
+  "beste",
+  "meisie",
+  "oë",
+  "dadelik",
+  "vriende",
+  "vat",
+  "veel",
+  "gek",
+  "kop",
+  "leef",
+  "madame",
+  "me",
+  "dinge",
+  "geword",
+  "gelede",
+  "loop",
+  "enige",
+  "dogter",
+  "oop",
+  "oupa",
+  "betaal",
+  "haal",
+  "trou",
+  "here",
+  "beteken",
+  "lê",
+  "stel",
+  "dokter",
+  "wys",
+  "ver",
+  "besoek",
+  "dieselfde",
+  "familie",
+  "verkoop",
+  "daarvoor",
+  "drie",
+  "behoort",
+  "maklik",
+  "gibbs",
+  "saak",
+  "siek",
+  "liewer",
+  "gereed",
+  "gevra",
+  "agter",
+  "huistoe",
+  "sleg",
+  "franz",
+  "daaroor",
+  "jong",
+  "hoogheid",
+  "geskryf",
+  "hand",
+  "the",
+  "klaar",
+  "deel",
+  "hande",
+  "kos",
+  "pad",
+  "verder",
+  "uur",
+  "vroue",
+  "verlaat",
+  "noem",
+  "dr",
+  "brief",
+  "suster",
+  "sulke",
+  "ooit",
+  "oorlog",
+  "trek",
+  "steeds",
+  "tussen",
+  "skuld",
+  "mos",
+  "verby",
+  "gevind",
+  "manne",
+  "haai",
+  "baas",
+  "dra",
+  "regte",
+  "myne",
+  "a",
+  "verwag",
+  "agent",
+  "aarde",
+  "lag",
+  "koning",
+  "geval",
+  "enigste",
+  "stuur",
+  "water",
+  "benodig",
+  "moeilik",
+  "reeds",
+  "sterf",
+  "daarmee",
+  "luitenant",
+  "graaf",
+  "vanaand",
+  "broer",
+  "binne",
+  "woord",
+  "eintlik",
+  "pappa",
+  "besluit",
+  "dus",
+  "gaaf",
+  "stem",
+  "oomblik",
+  "keiser",
+  "koffie",
+  "idee",
+  "gegee",
+  "musiek",
+  "volg",
+  "arme",
+  "wens",
+  "lig",
+  "ten",
+  "gesig",
+  "daarom",
+  "gepraat",
+  "val",
+  "heidi",
+  "dames",
+  "sorg",
+  "son",
+  "hulp",
+  "martin",
+  "dom",
+  "buite",
+  "eer",
+  "moontlik",
+  "bed",
+  "vertrou",
+  "prins",
+  "gehou",
+  "besig",
+  "antwoord",
+  "von",
+  "probleem",
+  "aanvaar",
+  "hoeveel",
+  "verdomp",
+  "welkom",
+  "skool",
+  "presies",
+  "geniet",
+  "rus",
+  "bel",
+  "vuur",
+  "mans",
+  "meisies",
+  "weke",
+  "naby",
+  "koop",
+  "keiserin",
+  "mev",
+  "eens",
+  "snaaks",
+  "anne",
+  "week",
+  "heel",
+  "verseker",
+  "gestuur",
+  "waarheid",
+  "gegaan",
+  "maal",
+  "mevrou",
+  "sommer",
+  "wonderlik",
+  "dame",
+  "jouself",
+  "vol",
+  "mcgee",
+  "asb",
+  "skilder",
+  "bemin",
+  "beweeg",
+  "he",
+  "ding",
+  "rede",
+  "daaraan",
+  "terugkom",
+  "voorstel",
+  "sodat",
+  "waarvoor",
+  "vertrek",
+  "tante",
+  "woon",
+  "dans",
+  "you",
+  "ouers",
+  "ernstig",
+  "haat",
+  "bestaan",
+  "bewys",
+  "myself",
+  "minste",
+  "swaar",
+  "schiller",
+  "huil",
+  "gebring",
+  "tony",
+  "geheim",
+  "manier",
+  "parys",
+  "gravin",
+  "terwyl",
+  "hul",
+  "slegte",
+  "oom",
+  "hemel",
+  "film",
+  "mee",
+  "moeg",
+  "tel",
+  "sterk",
+  "hoef",
+  "beloof",
+  "bo",
+  "nene",
+  "woorde",
+  "kwaad",
+  "ongelukkig",
+  "veg",
+  "versigtig",
+  "draai",
+  "trots",
+  "minute",
+  "warm",
+  "klink",
+  "ophou",
+  "minder",
+  "nê",
+  "peter",
+  "dikwels",
+  "waarvan",
+  "johannes",
+  "asof",
+  "per",
+  "storie",
+  "gewerk",
+  "ouma",
+  "hard",
+  "plan",
+  "darem",
+  "prinses",
+  "vas",
+  "alreeds",
+  "amper",
+  "homself",
+  "kort",
+  "heeltemal",
+  "oud",
+  "ry",
+  "bekommerd",
+  "red",
+  "onmoontlik",
+  "volgens",
+  "wonder",
+  "baba",
+  "rustig",
+  "lug",
+  "duidelik",
+  "marie",
+  "stad",
+  "joune",
+  "ziva",
+  "maande",
+  "hello",
+  "vier",
+  "vergewe",
+  "lang",
+  "ontvang",
+  "getroud",
+  "jare",
+  "geloof",
+  "franse",
+  "huwelik",
+  "gevoel",
+  "generaal",
+  "reis",
+  "albei",
+  "bevel",
+  "vry",
+  "albert",
+  "wyn",
+  "inger",
+  "russe",
+  "birkut",
+  "majoor",
+  "besef",
+  "byna",
+  "pragtige",
+  "ben",
+  "geleer",
+  "gewees",
+  "steek",
+  "gladnie",
+  "droom",
+  "verdien",
+  "vinnig",
+  "blomme",
+  "doodmaak",
+  "eenmaal",
+  "bos",
+  "klomp",
+  "breek",
+  "kameraad",
+  "totaal",
+  "pragtig",
+  "leopold",
+  "omtrent",
+  "fout",
+  "sekerlik",
+  "nuus",
+  "verduidelik",
+  "ryk",
+  "enigiets",
+  "sweer",
+  "gevaar",
+  "maand",
+  "don",
+  "grap",
+  "erken",
+  "doktor",
+  "roep",
+  "treurig",
+  "oral",
+  "dank",
+  "rok",
+  "dinozzo",
+  "kaptein",
+  "duitse",
+  "pyn",
+  "kolonel",
+  "einde",
+  "rooi",
+  "wenen",
+  "bereik",
+  "gilles",
+  "plesier",
+  "mis",
+  "charlotte",
+  "hare",
+  "slaan",
+  "gebou",
+  "herken",
+  "liefhet",
+  "nogal",
+  "kies",
+  "plaas",
+  "tuis",
+  "frankryk",
+  "dié",
+  "hoof",
+  "frank",
+  "sedert",
+  "rembrandt",
+  "orde",
+  "langs",
+  "aand",
+  "beskerm",
+  "gesondheid",
+  "stap",
+  "venster",
+  "vreugde",
+  "deer",
+  "chabert",
+  "glimlag",
+  "watse",
+  "daarna",
+  "duiwel",
+  "gesond",
+  "spel",
+  "kant",
+  "vrede",
+  "direkteur",
+  "wakker",
+  "hond",
+  "verdwyn",
+  "stilte",
+  "hof",
+  "bloed",
+  "soort",
+  "jan",
+  "mathieu",
+  "elkeen",
+  "skoon",
+  "gooi",
+  "voordat",
+  "genoem",
+  "gemors",
+  "aangaan",
+  "komaan",
+  "gister",
+  "belangrik",
+  "voort",
+  "skiet",
+  "teken",
+  "tafel",
+  "lei",
+  "min",
+  "tant",
+  "verlief",
+  "see",
+  "george",
+  "bier",
+  "ciske",
+  "belowe",
+  "soveel",
+  "monsieur",
+  "rond",
+  "staat",
+  "boeke",
+  "waaroor",
+  "veilig",
+  "lotte",
+  "boek",
+  "verkies",
+  "oostenryk",
+  "hitler",
+  "toekoms",
+  "soen",
+  "begryp",
+  "siedler",
+  "vyf",
+  "sophie",
+  "prokureur",
+  "muur",
+  "meester",
+  "werklik",
+  "tronk",
+  "soms",
+  "geneem",
+  "nelly",
+  "elk",
+  "gelees",
+  "mal",
+  "klara",
+  "hertog",
+  "engelse",
+  "oh",
+  "gaste",
+  "keith",
+  "vraag",
+  "melk",
+  "druk",
+  "germain",
+  "koningin",
+  "heen",
+  "caroline",
+  "klas",
+  "erg",
+  "gewoonlik",
+  "stalingrad",
+  "daarop",
+  "madam",
+  "vang",
+  "vrees",
+  "erger",
+  "gesoek",
+  "volk",
+  "hallo",
+  "grond",
+  "vermoor",
+  "verlede",
+  "perd",
+  "vryheid",
+  "ure",
+  "beide",
+  "vlieg",
+  "hiernatoe",
+  "bedank",
+  "wen",
+  "it",
+  "mammie",
+  "menere",
+  "liggaam",
+  "kans",
+  "bratek",
+  "dooie",
+  "ete",
+  "beveel",
+  "ses",
+  "i",
+  "koud",
+  "johan",
+  "beplan",
+  "verlore",
+  "duitsland",
+  "arm",
+  "werd",
+  "gebore",
+  "doodgaan",
+  "aanval",
+  "aandag",
+  "veral",
+  "vergeef",
+  "vlaandere",
+  "doel",
+  "alceste",
+  "donker",
+  "goue",
+  "jonk",
+  "spesiale",
+  "probleme",
+  "ruyter",
+  "swak",
+  "vrae",
+  "bou",
+  "jesus",
+  "ly",
+  "res",
+  "seer",
+  "geveg",
+  "klop",
+  "woonstel",
+  "ncis",
+  "party",
+  "vlug",
+  "eindelik",
+  "onderwyser",
+  "vinniger",
+  "asem",
+  "slag",
+  "honger",
+  "verdra",
+  "pak",
+  "liefie",
+  "slim",
+  "max",
+  "papa",
+  "more",
+  "gevolg",
+  "to",
+  "sand",
+  "spreek",
+  "minister",
+  "polisie",
+  "prys",
+  "dorp",
+  "belang",
+  "voorbeeld",
+  "anton",
+  "hel",
+  "regkom",
+  "juis",
+  "gedood",
+  "marianne",
+  "skip",
+  "verskoning",
+  "hang",
+  "verrassing",
+  "bravo",
+  "stadig",
+  "twak",
+  "teenoor",
+  "waarheen",
+  "tuin",
+  "saamgaan",
+  "gebreek",
+  "kalmeer",
+  "behandel",
+  "stuk",
+  "naand",
+  "gespeel",
+  "enkele",
+  "trein",
+  "eenvoudig",
+  "situasie",
+  "bal",
+  "hongarye",
+  "eendag",
+  "mond",
+  "behalwe",
+  "hoed",
+  "rol",
+  "als",
+  "boodskap",
+  "alweer",
+  "ontdek",
+  "gelyk",
+  "idioot",
+  "nader",
+  "eboshi",
+  "vreemd",
+  "skielik",
+  "geheime",
+  "daarin",
+  "lisa",
+  "grootste",
+  "lieflike",
+  "abby",
+  "ter",
+  "wit",
+  "gebel",
+  "wind",
+  "opdrag",
+  "klim",
+  "sluit",
+  "leër",
+  "moeite",
+  "swart",
+  "tas",
+  "markies",
+  "uitvind",
+  "sake",
+  "brand",
+  "ivan",
+  "siel",
+  "meeste",
+  "mej",
+  "verdedig",
+  "pos",
+  "langer",
+  "weggaan",
+  "vrolik",
+  "verdomde",
+  "and",
+  "ongeluk",
+  "nommer",
+  "gewone",
+  "fees",
+  "persoon",
+  "kasteel",
+  "vroeër",
+  "tee",
+  "gryp",
+  "punt",
+  "krag",
+  "waarskynlik",
+  "vroeg",
+  "begrawe",
+  "ruik",
+  "berlyn",
+  "verstand",
+  "hardloop",
+  "adres",
+  "groter",
+  "geskiedenis",
+  "aurore",
+  "hiervan",
+  "seuns",
+  "teruggaan",
+  "morange",
+  "geslaap",
+  "hospitaal",
+  "hoog",
+  "heilige",
+  "diep",
+  "graf",
+  "woud",
+  "uiteindelik",
+  "mikkel",
+  "chopin",
+  "kunstenaars",
+  "jag",
+  "smeek",
+  "cis",
+  "herr",
+  "vera",
+  "arms",
+  "weimar",
+  "vermy",
+  "bid",
+  "gesit",
+  "oortuig",
+  "russiese",
+  "moeilikheid",
+  "henrik",
+  "duur",
+  "kontak",
+  "twyfel",
+  "foto",
+  "karin",
+  "versoek",
+  "voer",
+  "platform",
+  "pérol",
+  "ware",
+  "bied",
+  "admiraal",
+  "professor",
+  "vorentoe",
+  "diens",
+  "weier",
+  "name",
+  "beslis",
+  "bevestig",
+  "verloof",
+  "materiaal",
+  "front",
+  "dankbaar",
+  "bespreek",
+  "perfek",
+  "vreemde",
+  "rug",
+  "verwyder",
+  "gebly",
+  "helder",
+  "m",
+  "gesteel",
+  "skoonheid",
+  "vorm",
+  "sin",
+  "straat",
+  "haastig",
+  "soldate",
+  "moed",
+  "mark",
+  "ondersoek",
+  "kar",
+  "miljoen",
+  "wells",
+  "blou",
+  "lot",
+  "gang",
+  "ring",
+  "derde",
+  "weermag",
+  "baron",
+  "torgny",
+  "skande",
+  "lewer",
+  "harte",
+  "voorheen",
+  "nooi",
+  "talent",
+  "moment",
+  "tevrede",
+  "skei",
+  "straf",
+  "gas",
+  "afspraak",
+};
+const uint16_t WA_FREQ_1_RANKS[] = {
+  0, 0, 0, 85, 0, 0, 155, 620, 682, 0, 696, 123, 342, 0, 171, 902,
+  31, 0, 0, 0, 351, 0, 0, 252, 326, 0, 0, 19, 757, 191, 0, 37,
+  630, 706, 0, 0, 0, 697, 689, 998, 0, 0, 0, 0, 0, 0, 448, 0,
+  0, 0, 419, 0, 0, 0, 0, 0, 114, 0, 564, 0, 484, 721, 0, 291,
+  0, 823, 0, 0, 661, 0, 0, 5, 266, 0, 270, 0, 589, 0, 794, 51,
+  0, 0, 0, 21, 658, 957, 771, 0, 468, 0, 0, 0, 0, 0, 0, 969,
+  0, 175, 376, 931, 0, 977, 281, 177, 0, 319, 380, 513, 0, 0, 552, 0,
+  0, 0, 664, 279, 338, 593, 0, 0, 0, 978, 875, 0, 0, 0, 0, 0,
+  901, 999, 837, 0, 72, 683, 80, 867, 893, 582, 904, 272, 0, 59, 595, 0,
+  0, 0, 0, 0, 221, 0, 83, 865, 68, 0, 0, 206, 0, 0, 0, 167,
+  208, 429, 467, 493, 710, 20, 341, 833, 913, 944, 0, 29, 868, 101, 949, 0,
+  0, 657, 462, 0, 521, 217, 226, 0, 0, 299, 375, 35, 797, 0, 0, 527,
+  796, 0, 0, 0, 0, 818, 0, 400, 747, 0, 0, 0, 0, 0, 0, 0,
+  0, 231, 0, 643, 548, 0, 607, 488, 0, 0, 0, 0, 0, 0, 118, 267,
+  541, 0, 676, 983, 98, 0, 0, 0, 800, 587, 371, 558, 0, 0, 0, 694,
+  784, 815, 847, 0, 185, 0, 745, 0, 822, 0, 621, 0, 0, 782, 424, 879,
+  536, 16, 405, 0, 0, 871, 0, 0, 0, 672, 679, 264, 183, 0, 0, 0,
+  0, 0, 0, 79, 735, 0, 478, 0, 0, 0, 0, 0, 128, 509, 722, 0,
+  888, 976, 556, 489, 599, 685, 0, 645, 700, 0, 0, 0, 0, 0, 729, 0,
+  201, 687, 853, 0, 286, 0, 0, 0, 632, 0, 0, 0, 0, 0, 0, 0,
+  739, 825, 0, 0, 0, 78, 0, 0, 594, 684, 439, 985, 314, 798, 895, 0,
+  249, 716, 793, 0, 0, 0, 581, 0, 0, 0, 0, 0, 103, 86, 186, 654,
+  0, 0, 243, 691, 73, 4, 225, 271, 569, 490, 749, 750, 974, 222, 866, 0,
+  0, 0, 398, 205, 903, 752, 577, 561, 889, 0, 0, 0, 918, 463, 0, 0,
+  0, 0, 198, 773, 296, 725, 14, 0, 0, 1000, 0, 758, 0, 437, 0, 136,
+  505, 0, 0, 0, 124, 619, 0, 160, 0, 0, 0, 646, 403, 636, 511, 207,
+  930, 544, 560, 274, 0, 0, 0, 0, 54, 97, 0, 736, 34, 334, 475, 571,
+  765, 832, 203, 346, 529, 671, 0, 0, 0, 0, 996, 236, 485, 0, 0, 0,
+  156, 277, 712, 0, 0, 0, 0, 971, 0, 0, 0, 692, 0, 353, 0, 0,
+  0, 402, 838, 0, 0, 0, 0, 614, 891, 0, 0, 0, 172, 0, 0, 0,
+  0, 681, 333, 269, 811, 214, 0, 795, 0, 0, 546, 0, 0, 140, 81, 0,
+  212, 0, 0, 0, 948, 0, 158, 0, 316, 0, 0, 0, 396, 562, 0, 0,
+  0, 0, 0, 0, 0, 127, 138, 369, 507, 534, 719, 100, 728, 11, 244, 755,
+  959, 772, 431, 0, 0, 0, 0, 0, 0, 0, 649, 33, 0, 0, 257, 0,
+  71, 916, 0, 336, 911, 0, 0, 0, 0, 0, 0, 617, 465, 554, 627, 0,
+  48, 519, 677, 0, 0, 318, 598, 0, 254, 77, 0, 12, 962, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 47, 628, 278, 382, 631, 907, 7,
+  908, 163, 0, 8, 588, 0, 0, 0, 0, 856, 0, 0, 194, 307, 422, 606,
+  912, 290, 0, 0, 0, 813, 0, 0, 0, 0, 876, 0, 0, 634, 760, 132,
+  452, 363, 896, 0, 0, 0, 0, 746, 0, 0, 0, 924, 455, 0, 0, 188,
+  443, 0, 115, 169, 416, 647, 0, 0, 0, 0, 89, 143, 414, 0, 0, 932,
+  523, 841, 324, 951, 613, 0, 0, 378, 0, 30, 0, 650, 981, 0, 176, 300,
+  597, 0, 0, 0, 41, 701, 596, 0, 776, 810, 0, 0, 660, 968, 843, 0,
+  839, 0, 0, 688, 987, 173, 0, 0, 0, 0, 242, 0, 846, 476, 87, 0,
+  0, 743, 919, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 284, 361, 0,
+  133, 530, 718, 844, 0, 604, 287, 515, 197, 0, 75, 473, 0, 0, 522, 434,
+  0, 0, 0, 0, 224, 0, 383, 150, 308, 451, 0, 0, 0, 704, 0, 0,
+  0, 0, 635, 129, 528, 555, 310, 0, 0, 0, 563, 609, 170, 0, 0, 0,
+  0, 0, 178, 0, 25, 1, 0, 0, 146, 543, 0, 997, 0, 0, 445, 283,
+  0, 0, 289, 580, 570, 942, 0, 0, 0, 0, 0, 0, 831, 273, 923, 0,
+  0, 116, 0, 0, 0, 961, 0, 442, 616, 0, 0, 992, 0, 517, 38, 469,
+  0, 816, 0, 990, 0, 0, 134, 592, 966, 821, 0, 0, 817, 0, 0, 95,
+  364, 436, 220, 496, 921, 0, 408, 651, 368, 547, 767, 60, 330, 835, 864, 953,
+  829, 0, 0, 304, 0, 0, 0, 0, 0, 0, 0, 157, 392, 497, 859, 862,
+  877, 686, 708, 0, 707, 0, 0, 0, 0, 809, 0, 0, 0, 0, 751, 6,
+  0, 0, 0, 0, 0, 0, 250, 652, 96, 925, 233, 0, 0, 0, 0, 982,
+  0, 0, 991, 610, 426, 884, 995, 0, 842, 67, 0, 0, 947, 863, 0, 0,
+  0, 0, 0, 0, 0, 0, 542, 568, 935, 209, 0, 0, 0, 525, 0, 0,
+  960, 0, 0, 0, 0, 0, 0, 0, 0, 0, 348, 74, 23, 0, 28, 0,
+  18, 0, 0, 518, 288, 874, 154, 662, 0, 943, 0, 0, 0, 0, 612, 0,
+  0, 0, 0, 193, 549, 557, 929, 984, 640, 174, 648, 135, 0, 0, 819, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 906, 565, 62, 0, 0, 328, 808,
+  938, 472, 979, 0, 0, 329, 377, 0, 611, 0, 0, 0, 769, 742, 253, 0,
+  397, 404, 151, 734, 99, 975, 988, 0, 0, 0, 0, 0, 0, 0, 0, 149,
+  812, 0, 84, 954, 0, 406, 713, 0, 0, 0, 321, 717, 989, 0, 17, 0,
+  362, 0, 575, 0, 0, 0, 0, 312, 603, 917, 56, 57, 182, 591, 703, 950,
+  963, 0, 204, 699, 350, 0, 514, 849, 0, 0, 0, 0, 0, 733, 153, 848,
+  0, 238, 495, 104, 540, 779, 0, 504, 958, 0, 0, 0, 0, 450, 0, 0,
+  0, 0, 360, 152, 711, 0, 764, 778, 970, 0, 168, 531, 872, 0, 0, 675,
+  357, 579, 0, 227, 93, 373, 690, 0, 0, 0, 0, 0, 0, 0, 413, 0,
+  0, 0, 0, 461, 532, 0, 0, 345, 69, 0, 0, 900, 639, 0, 756, 202,
+  260, 0, 218, 0, 0, 325, 0, 322, 791, 0, 0, 780, 423, 0, 0, 905,
+  0, 0, 180, 184, 0, 498, 137, 159, 0, 0, 374, 65, 46, 245, 0, 551,
+  915, 0, 0, 0, 0, 441, 0, 0, 678, 732, 785, 215, 24, 147, 295, 294,
+  301, 440, 572, 88, 339, 624, 637, 723, 727, 0, 0, 26, 881, 0, 0, 0,
+  709, 0, 370, 0, 0, 566, 928, 956, 0, 0, 936, 0, 857, 394, 313, 933,
+  790, 0, 0, 297, 117, 827, 0, 0, 223, 162, 744, 883, 973, 13, 601, 0,
+  0, 0, 0, 0, 42, 576, 0, 0, 0, 0, 0, 0, 105, 573, 0, 0,
+  741, 0, 0, 0, 196, 165, 663, 401, 892, 0, 0, 937, 0, 0, 0, 166,
+  0, 0, 0, 583, 724, 618, 726, 449, 0, 0, 0, 0, 45, 113, 0, 860,
+  878, 0, 494, 830, 666, 0, 0, 659, 828, 0, 0, 359, 0, 0, 0, 0,
+  0, 145, 332, 0, 0, 0, 0, 409, 0, 0, 52, 0, 955, 49, 0, 0,
+  0, 0, 774, 500, 667, 629, 0, 0, 44, 508, 586, 0, 0, 0, 0, 111,
+  0, 0, 653, 737, 240, 786, 302, 670, 781, 0, 0, 0, 358, 120, 0, 55,
+  0, 873, 0, 0, 0, 70, 0, 0, 0, 265, 58, 705, 337, 0, 0, 0,
+  0, 323, 0, 94, 327, 0, 0, 0, 477, 126, 674, 381, 3, 306, 384, 641,
+  665, 237, 939, 788, 200, 0, 894, 0, 481, 0, 0, 0, 0, 910, 0, 0,
+  0, 524, 0, 0, 0, 0, 0, 340, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 391, 61, 0, 0, 0, 0, 0, 263, 0, 181, 0, 0,
+  0, 0, 0, 0, 0, 516, 806, 887, 941, 0, 0, 0, 537, 730, 834, 415,
+  0, 0, 0, 446, 967, 0, 0, 0, 0, 0, 0, 0, 311, 584, 0, 731,
+  27, 487, 836, 880, 869, 0, 0, 0, 0, 0, 0, 0, 0, 789, 940, 0,
+  64, 0, 102, 276, 0, 0, 0, 50, 799, 0, 483, 783, 0, 0, 0, 824,
+  0, 759, 0, 385, 854, 0, 0, 0, 0, 189, 0, 365, 840, 0, 0, 0,
+  0, 0, 0, 673, 777, 0, 309, 0, 453, 804, 0, 251, 0, 897, 141, 213,
+  0, 608, 0, 0, 0, 0, 466, 427, 0, 0, 0, 0, 122, 331, 574, 0,
+  0, 0, 0, 92, 927, 190, 246, 298, 482, 642, 0, 0, 259, 0, 110, 0,
+  410, 456, 499, 738, 90, 0, 39, 503, 538, 457, 0, 82, 0, 0, 0, 354,
+  459, 486, 945, 0, 0, 0, 0, 0, 802, 845, 0, 335, 0, 239, 520, 0,
+  0, 0, 994, 139, 0, 107, 386, 0, 0, 0, 433, 0, 715, 479, 644, 0,
+  0, 600, 0, 0, 0, 0, 693, 0, 0, 0, 0, 9, 76, 0, 0, 0,
+  761, 0, 926, 0, 0, 0, 633, 980, 972, 0, 0, 0, 0, 0, 63, 474,
+  914, 0, 0, 112, 740, 36, 261, 909, 0, 0, 0, 0, 0, 480, 535, 0,
+  0, 807, 638, 0, 0, 890, 0, 0, 0, 228, 211, 262, 417, 0, 0, 0,
+  248, 0, 0, 32, 0, 0, 393, 235, 0, 0, 0, 470, 0, 0, 0, 0,
+  0, 256, 753, 748, 0, 0, 0, 0, 946, 993, 0, 870, 0, 0, 605, 0,
+  0, 0, 389, 199, 0, 0, 0, 0, 0, 0, 0, 0, 379, 454, 0, 0,
+  0, 0, 0, 0, 920, 0, 447, 882, 0, 0, 0, 425, 0, 0, 0, 0,
+  0, 0, 0, 460, 131, 502, 763, 491, 585, 0, 0, 801, 0, 0, 512, 0,
+  898, 0, 399, 0, 458, 0, 0, 0, 230, 0, 0, 0, 0, 195, 766, 0,
+  66, 285, 850, 119, 626, 280, 0, 0, 578, 768, 292, 0, 0, 0, 0, 0,
+  625, 10, 655, 0, 0, 0, 533, 258, 317, 0, 0, 428, 388, 0, 0, 0,
+  421, 229, 861, 899, 0, 356, 0, 395, 885, 234, 0, 0, 40, 0, 0, 0,
+  0, 0, 106, 0, 305, 435, 412, 0, 0, 559, 0, 0, 0, 0, 0, 602,
+  0, 0, 0, 0, 275, 805, 0, 121, 0, 420, 0, 590, 922, 0, 164, 669,
+  622, 792, 0, 0, 0, 210, 192, 714, 130, 615, 0, 0, 0, 510, 0, 0,
+  695, 0, 0, 0, 411, 668, 2, 0, 858, 0, 526, 820, 0, 501, 0, 0,
+  623, 0, 787, 0, 0, 0, 0, 355, 814, 0, 0, 0, 0, 0, 0, 803,
+  255, 762, 826, 0, 0, 550, 0, 567, 22, 0, 0, 0, 216, 0, 698, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 471, 539, 444, 0, 0,
+  775, 91, 0, 0, 320, 0, 0, 0, 986, 0, 0, 0, 347, 282, 0, 0,
+  390, 0, 0, 0, 0, 0, 492, 0, 464, 219, 0, 148, 438, 0, 0, 0,
+  303, 0, 0, 0, 352, 0, 0, 851, 430, 432, 15, 0, 952, 545, 0, 0,
+  770, 0, 0, 343, 0, 0, 43, 349, 232, 407, 0, 53, 0, 367, 934, 247,
+  108, 680, 0, 0, 0, 268, 179, 315, 720, 0, 0, 293, 0, 0, 0, 187,
+  241, 553, 344, 965, 109, 855, 0, 0, 0, 0, 0, 0, 0, 0, 886, 372,
+  0, 144, 0, 0, 142, 0, 0, 0, 0, 0, 0, 0, 161, 702, 964, 0,
+  0, 754, 506, 0, 0, 418, 0, 0, 366, 656, 852, 387, 125, 0, 0, 0,
+};
+
+const char *WA_FREQ_2_TOKENS[] = {
+  "a",
+  "no",
+  "ne",
+  "mu",
+  "na",
+  "yɛ",
+  "wɔ",
+  "ho",
+  "so",
+  "sɛ",
+  "kuro",
+  "de",
+  "yi",
+  "bi",
+  "yare",
+  "yε",
+  "pii",
+  "afe",
+  "wɔn",
+  "Gaana",
+  "nso",
+  "nea",
+  "bere",
+  "wͻ",
+  "Ghana",
+  "anaa",
+  "obi",
+  "nyinaa",
+  "fi",
+  "ma",
+  "ase",
+  "kosi",
+  "Nkrumah",
+  "Wɔ",
+  "ahorow",
+  "ba",
+  "nti",
+  "se",
+  "kasa",
+  "of",
+  "sε",
+  "kwan",
+  "saa",
+  "wͻn",
+  "awo",
+  "nnipa",
+  "Kofi",
+  "Eyi",
+  "biara",
+  "nsu",
+  "Annan",
+  "akyi",
+  "hɔ",
+  "wɔde",
+  "ɛwɔ",
+  "Ne",
+  "aman",
+  "ara",
+  "ka",
+  "kan",
+  "mmoawa",
+  "ɔman",
+  "ɔyɛ",
+  "din",
+  "Kofi Annan",
+  "di",
+  "wo",
+  "wͻde",
+  "nipa",
+  "and",
+  "ano",
+  "mma",
+  "N'ahenkuro",
+  "da",
+  "nnwom",
+  "te",
+  "afoforo",
+  "betumi",
+  "eyi",
+  "adwuma",
+  "ama",
+  "denam",
+  "dwuma",
+  "maa",
+  "mfe",
+  "nyinsɛn",
+  "kɔɔ",
+  "pa",
+  "u",
+  "abien",
+  "bɛyɛ",
+  "ye",
+  "yiye",
+  "aduonu",
+  "edi",
+  "nya",
+  "taa",
+  "the",
+  "Kwame",
+  "Na",
+  "Nea",
+  "kuw",
+  "man",
+  "nanso",
+  "nnuru",
+  "to",
+  "tumi",
+  "wɔfrɛ",
+  "aba",
+  "atiridii",
+  "dodow",
+  "nna",
+  "siw",
+  "Amu",
+  "United",
+  "adi",
+  "afa",
+  "ani",
+  "ansa",
+  "fie",
+  "nsɛm",
+  "Ephraim",
+  "Wɔwoo",
+  "Yare",
+  "ade",
+  "aduasa",
+  "biako",
+  "foforo",
+  "mmeae",
+  "mmere",
+  "won",
+  "Ephraim Amu",
+  "Kwame Nkrumah",
+  "aboa",
+  "anum",
+  "nyina",
+  "obiara",
+  "yɛɛ",
+  "ɛma",
+  "Danquah",
+  "School",
+  "aka",
+  "anya",
+  "fam",
+  "mmea",
+  "mogya",
+  "nnawɔtwe",
+  "wobetumi",
+  "ɔpepem",
+  "Afe",
+  "Bere",
+  "Huang",
+  "Nipa",
+  "bεyε",
+  "den",
+  "emu",
+  "fa",
+  "faahodie",
+  "mmoa",
+  "mpem",
+  "nkyekyem",
+  "ɔha",
+  "ɔwɔ",
+  "ɛyɛ",
+  "Akan",
+  "John",
+  "aduru",
+  "adwene",
+  "akwan",
+  "fii",
+  "papa",
+  "wiase",
+  "wͻanya",
+  "ɔbea",
+  "Afrika",
+  "Nyinsɛn",
+  "The",
+  "UN",
+  "aduanan",
+  "fo",
+  "kraman",
+  "nhyehyɛe",
+  "nyansa",
+  "sika",
+  "wonya",
+  "ɔde",
+  "Fi",
+  "States",
+  "Twi",
+  "Xianfan",
+  "ahenkuro",
+  "baabi",
+  "dua",
+  "frɛ",
+  "kasae",
+  "nka",
+  "nyaa",
+  "Vietnam",
+  "Wiase",
+  "Yurop",
+  "abiɛsa",
+  "afei",
+  "ayɛ",
+  "barima",
+  "bɔɔ",
+  "honam",
+  "hyɛɛ",
+  "in",
+  "nipadua",
+  "nkwa",
+  "ode",
+  "sen",
+  "sɛnea",
+  "ɛko",
+  "ɛto",
+  "Dea",
+  "Gaanani",
+  "Mpεn",
+  "Nkran",
+  "Saa",
+  "Switzerland",
+  "University",
+  "Wͻ",
+  "abu",
+  "adesua",
+  "ahanu",
+  "anan",
+  "baa",
+  "baako",
+  "esiane",
+  "mpo",
+  "nsεnkyerεnne",
+  "terɛw",
+  "tia",
+  "wom",
+  "wɔka",
+  "wɔsan",
+  "ɛno",
+  "εde",
+  "εyε",
+  "2012",
+  "Abere",
+  "Afei",
+  "Akwanhosan",
+  "Amɛrika",
+  "Ananse",
+  "Côte",
+  "Din",
+  "Gold",
+  "Nna",
+  "Poland",
+  "Wobetumi",
+  "abibiman",
+  "afi",
+  "afuw",
+  "awotwaa",
+  "bosome",
+  "d’Ivoire",
+  "efi",
+  "etumi",
+  "firi",
+  "gye",
+  "gyee",
+  "haw",
+  "hͻ",
+  "kae",
+  "ko",
+  "koro",
+  "kwata",
+  "kɔ",
+  "maame",
+  "mmofra",
+  "nipaduam",
+  "nni",
+  "nsonsono",
+  "nyinsɛntogu",
+  "paa",
+  "san",
+  "sukuu",
+  "wonni",
+  "wɔyɛ",
+  "Ɔde",
+  "ɛde",
+  "ͻpepem",
+  "Africa",
+  "Amsterdam",
+  "Coast",
+  "Kumasi",
+  "Limann",
+  "Ngyiresi",
+  "Nnipa",
+  "Sika",
+  "aban",
+  "aduonum",
+  "akokoaa",
+  "anosiw",
+  "are",
+  "asiw",
+  "bae",
+  "beae",
+  "gu",
+  "hokwan",
+  "hyɛ",
+  "is",
+  "kakra",
+  "kyerɛ",
+  "mmra",
+  "mmɔden",
+  "nan",
+  "ni",
+  "nkuran",
+  "nkutoo",
+  "nnwuma",
+  "nsa",
+  "nyarewa",
+  "odi",
+  "pɛ",
+  "titiriw",
+  "wanya",
+  "wɔfa",
+  "wɔma",
+  "wɔwɔ",
+  "yere",
+  "ɔmanpanyin",
+  "Akwan",
+  "Amerikaman",
+  "Amεrika",
+  "Awuah",
+  "Brazil",
+  "Britain",
+  "College",
+  "Da",
+  "Germany",
+  "Kufuor",
+  "Label",
+  "Music",
+  "Ode",
+  "Rɔhyea",
+  "Sɛ",
+  "Togo",
+  "Zika",
+  "abakɔsɛm",
+  "aborɔfo",
+  "akyiri",
+  "akɔ",
+  "asɔn",
+  "awotwe",
+  "biribi",
+  "bo",
+  "borɔfo",
+  "dumien",
+  "ebi",
+  "frɛɛ",
+  "koraa",
+  "mba",
+  "mmara",
+  "mpεn",
+  "nhwehwεmu",
+  "ntam",
+  "ntontom",
+  "paane",
+  "sa",
+  "sii",
+  "sukuupɔn",
+  "tena",
+  "tew",
+  "tiaa",
+  "wɔhyɛ",
+  "wͻwͻ",
+  "ɛfa",
+  "ͻha",
+  "εho",
+  "εne",
+  "2006",
+  "2014",
+  "Abibiman",
+  "Agyinamoa",
+  "Asante",
+  "Awo",
+  "FM",
+  "Italy",
+  "Mmere",
+  "Mpɛn",
+  "Science",
+  "UGCC",
+  "Yaa",
+  "abaduaba",
+  "abiesa",
+  "adwen",
+  "anka",
+  "asem",
+  "asi",
+  "asɛm",
+  "ayi",
+  "ayε",
+  "binom",
+  "bio",
+  "bεboro",
+  "dii",
+  "ebetumi",
+  "efiri",
+  "ekyi",
+  "enti",
+  "faa",
+  "kaa",
+  "kyerɛɛ",
+  "mmom",
+  "mpanyinfo",
+  "mpɔn",
+  "mpɛn",
+  "nkokoaa",
+  "nneyɛe",
+  "nnwontofo",
+  "nnyɛ",
+  "ntini",
+  "nwaw",
+  "oprehyen",
+  "si",
+  "sukuufo",
+  "tenten",
+  "ti",
+  "tow",
+  "waka",
+  "wode",
+  "wodi",
+  "wohu",
+  "wonyaa",
+  "wotumi",
+  "wƆ",
+  "yɛfrɛ",
+  "ƆBƆ",
+  "Ɔsan",
+  "ɛba",
+  "ɛho",
+  "ɛkɔ",
+  "ɛsɛ",
+  "1957",
+  "2007",
+  "2016",
+  "Achimota",
+  "African",
+  "Agyekum",
+  "Akanfo",
+  "Amerika",
+  "Asafo",
+  "Asia",
+  "Council",
+  "Esiane",
+  "FGM",
+  "Fathia",
+  "Guangxi",
+  "Hilla",
+  "Hilla Limann",
+  "Igyipt",
+  "London",
+  "Middle",
+  "Mpoano",
+  "Nana",
+  "Nnuru",
+  "Pagani",
+  "Peace",
+  "Peace FM",
+  "Sika Mpoano",
+  "Sudan",
+  "Technology",
+  "Turki",
+  "Wotumi",
+  "aduan",
+  "aduane",
+  "agu",
+  "akuafo",
+  "amansan",
+  "amanɔne",
+  "anigye",
+  "ankasa",
+  "asaase",
+  "asia",
+  "asɔre",
+  "atumi",
+  "awode",
+  "ayaresa",
+  "ayaresabea",
+  "babea",
+  "ban",
+  "be",
+  "benya",
+  "bra",
+  "bɛboro",
+  "du",
+  "dunum",
+  "dɛ",
+  "ebia",
+  "ebusua",
+  "ehia",
+  "esan",
+  "etwa",
+  "hia",
+  "hu",
+  "huu",
+  "hwee",
+  "kosii",
+  "kuku",
+  "kyeree",
+  "may",
+  "me",
+  "mogyatɔw",
+  "n'ahenkuro",
+  "nkoa",
+  "nkraman",
+  "ntaa",
+  "ntummoa",
+  "odii",
+  "ofi",
+  "ohene",
+  "owu",
+  "rockband",
+  "those",
+  "trεw",
+  "wɔtaa",
+  "wɔwoo",
+  "wͻfa",
+  "ya",
+  "yaw",
+  "Ɔwarr",
+  "ɔne",
+  "ɔyɛɛ",
+  "ɛka",
+  "ɛte",
+  "εka",
+  "εma",
+  "εwɔ",
+  "εwͻ",
+  "1930",
+  "1935",
+  "1954",
+  "1995",
+  "2013",
+  "2015",
+  "A",
+  "Aban",
+  "Adesua",
+  "Ahyehyεde",
+  "Ansa",
+  "Asanteman",
+  "Atiridii",
+  "Ayaresa",
+  "Bono",
+  "CPP",
+  "Casely",
+  "China",
+  "Convention",
+  "December",
+  "Ebinom",
+  "Ebola",
+  "Edweso",
+  "Efi",
+  "Fathia Nkrumah",
+  "Geneva",
+  "Guinea",
+  "Hayford",
+  "Hɔlan",
+  "Institute",
+  "International",
+  "Kwata",
+  "Ma",
+  "Mumu-Ɔpɛnimba",
+  "Nanso",
+  "New",
+  "Nsu",
+  "Ritz",
+  "Rotterdam",
+  "Se",
+  "Suapɔn",
+  "Wɔde",
+  "Wɔn",
+  "Wͻn",
+  "Yesu",
+  "abibifo",
+  "abiεsa",
+  "agye",
+  "ahaw",
+  "ahoroɔ",
+  "ahu",
+  "ahyia",
+  "ahyɛ",
+  "akrɔn",
+  "amanee",
+  "amantam",
+  "amma",
+  "anafo",
+  "anifurae",
+  "anohyeto",
+  "as",
+  "asetena",
+  "asram",
+  "ayaase",
+  "basabasayɛ",
+  "bebree",
+  "bedii",
+  "boaa",
+  "by",
+  "bɔ",
+  "bɔɔlɔ",
+  "bɛyɛɛ",
+  "dedaw",
+  "diarrhea",
+  "dwa",
+  "dwensͻ",
+  "edwumayɛ",
+  "efidie",
+  "egye",
+  "ekum",
+  "ewo",
+  "eye",
+  "for",
+  "frε",
+  "gyina",
+  "have",
+  "hwɛɛ",
+  "hɔn",
+  "kasaa",
+  "kokoo",
+  "koo",
+  "kum",
+  "kurow",
+  "kͻ",
+  "mmienu",
+  "mpontu",
+  "nko",
+  "nneɛma",
+  "ntɛm",
+  "oka",
+  "onipa",
+  "onnim",
+  "oponko",
+  "osuaa",
+  "panyin",
+  "pleya",
+  "president",
+  "professor",
+  "recommended",
+  "senea",
+  "su",
+  "tema",
+  "too",
+  "with",
+  "woyi",
+  "wɔanya",
+  "wɔbɔ",
+  "wɔbɛyɛ",
+  "wͻhwehwε",
+  "wͻsan",
+  "yie",
+  "yεε",
+  "Ɛwom",
+  "ɔbɔɔ",
+  "ɔhaw",
+  "ɔhwɛ",
+  "ɔkwan",
+  "ɛbɛma",
+  "ɛhɔ",
+  "ɛne",
+  "ɛtaa",
+  "ɛtɔ",
+  "13",
+  "1899",
+  "1926",
+  "1934",
+  "1937",
+  "1938",
+  "1946",
+  "1947",
+  "1958",
+  "2000",
+  "2004",
+  "21",
+  "31",
+  "8",
+  "Ade",
+  "Afurum",
+  "Aires",
+  "Aman",
+  "Asaase",
+  "Asantewaa",
+  "Asɛm",
+  "Atta",
+  "Austria",
+  "Beijing",
+  "Bosome",
+  "Buenos",
+  "C-section",
+  "Chan",
+  "Data",
+  "Dawurbɔ",
+  "Ehyia",
+  "Enyiresi",
+  "Europa",
+  "Facebook",
+  "Fante",
+  "Fida",
+  "Francis",
+  "Fulera",
+  "Fulera Limann",
+  "Fusui",
+  "Game",
+  "George",
+  "Ghanafo",
+  "Ghanaman",
+  "Guilin",
+  "Hansen",
+  "Ho",
+  "Holy",
+  "House",
+  "Igyiptni",
+  "In",
+  "Irak",
+  "Jerry",
+  "Jerry John Rawlings",
+  "John Kofi Agyekum Kufuor",
+  "King",
+  "Kraman",
+  "Kwaku",
+  "Larry",
+  "Lima",
+  "Lituania",
+  "Long",
+  "Mantam",
+  "Mfantsipim",
+  "Mfinimfini",
+  "Military",
+  "Mmoawa",
+  "N'awofo",
+  "Nations",
+  "Normal",
+  "Nsεnkyerεnne",
+  "Obi",
+  "Ohene",
+  "Okoh",
+  "Okonore",
+  "Owura",
+  "Patrick",
+  "Pokémon",
+  "Population",
+  "Presbyterian",
+  "Qusi",
+  "Rabies",
+  "Rawlings",
+  "Reggie",
+  "Reggie Rockstone",
+  "Republic",
+  "Rockstone",
+  "Seagal",
+  "Sekou",
+  "September",
+  "Skuul",
+  "Stockholm",
+  "Studies",
+  "Sukuupɔn",
+  "Sweden",
+  "Theodosia",
+  "Tokyo",
+  "Training",
+  "West",
+  "Wͻnam",
+  "Wͻyε",
+  "Yei",
+  "York",
+  "YouTube",
+  "Zonda",
+  "Zürich",
+  "abasobɔ",
+  "abasobɔde",
+  "abata",
+  "abofuw",
+  "abufuw",
+  "abusua",
+  "adu",
+  "aduokrͻn",
+  "aduruyɛ",
+  "afeha",
+  "afurum",
+  "ahobrɛase",
+  "ahokeka",
+  "ahoɔden",
+  "akwaa",
+  "akyɛ",
+  "also",
+  "amanfo",
+  "amansɛm",
+  "ampan",
+  "anaasɛ",
+  "annyɛ",
+  "anyinsɛn",
+  "apem",
+  "apue",
+  "asaasetaw",
+  "asan",
+  "asiane",
+  "asomdwee",
+  "asεm",
+  "at",
+  "atena",
+  "ato",
+  "atu",
+  "atukɔfo",
+  "awerehow",
+  "awu",
+  "ayamtu",
+  "aye",
+  "bammɔ",
+  "boa",
+  "bowel",
+  "bɛma",
+  "cases",
+  "dan",
+  "data",
+  "deɛ",
+  "dinn",
+  "do",
+  "dodoɔ",
+  "dompe",
+  "dumiɛnsa",
+  "dwumadi",
+  "eba",
+  "edwuma",
+  "efisɛ",
+  "ennu",
+  "fahodi",
+  "foto",
+  "history",
+  "hokani",
+  "hwehwɛɛ",
+  "hweree",
+  "kakraa",
+  "koboo",
+  "kor",
+  "kunu",
+  "kyerε",
+  "kyerεε",
+  "kɔpem",
+  "kɛse",
+  "mansotwe",
+  "mantam",
+  "mbaa",
+  "mewu",
+  "mfie",
+  "mmaatan",
+  "mmabun",
+  "mmae",
+  "mmfa",
+  "mmoadoma",
+  "mmoden",
+  "mpan",
+  "multibacillary",
+  "n'ani",
+  "n'edwuma",
+  "nensa",
+  "nhia",
+  "nhoma",
+  "nhyehyεe",
+  "nkorɔfo",
+  "nkyerɛkyerɛ",
+  "nnansa",
+  "nneema",
+  "nno",
+  "nnwomto",
+  "nnɔnhwerew",
+  "nnɛ",
+  "not",
+  "nsunsuanso",
+  "ntade",
+  "ntama",
+  "ntomtom",
+  "ntuboa",
+  "nuabea",
+  "number",
+  "nyimpa",
+  "ohia",
+  "on",
+  "one",
+  "onni",
+  "ontumi",
+  "otumi",
+  "owifo",
+  "owo",
+  "oye",
+  "panin",
+  "paucibacillary",
+  "pe",
+  "piee",
+  "pε",
+  "rabbies",
+  "rentumi",
+  "section",
+  "severe",
+  "sikasɛm",
+  "simma",
+  "soro",
+  "suaa",
+  "suapɔn",
+  "suban",
+  "sukuukɔ",
+  "sƐ",
+  "sεnea",
+  "tebea",
+  "tete",
+  "tuu",
+  "used",
+  "waree",
+  "wiee",
+  "woanya",
+  "wogye",
+  "women",
+  "wonnya",
+  "wosiw",
+  "wowo",
+  "wuee",
+  "wɔbɔɔ",
+  "wɔnhwɛ",
+  "wɔnom",
+  "wɔsɛe",
+  "wͻbͻ",
+  "wͻfrε",
+  "wͻhyε",
+  "wͻtete",
+  "yee",
+  "yii",
+  "Ɔkɔee",
+  "Ɔman",
+  "Ɛno",
+  "ɔfa",
+  "ɔfrɛɛ",
+  "ɔgyee",
+  "ɔkɔɔ",
+  "ɔmanpanin",
+  "ɔsan",
+  "ɔtee",
+  "ɔwarr",
+  "ɔyε",
+  "ɛbɔ",
+  "ɛbɛyɛ",
+  "ɛmma",
+  "ɛso",
+  "ɛyaw",
+  "ͻkwan",
+  "ͻwͻ",
+  "εno",
+  "εnyε",
+  "εpam",
+  "εsan",
+  "'se",
+  "11",
+  "12",
+  "1840",
+  "1917",
+  "1921",
+  "1944",
+  "1948",
+  "1960",
+  "1961",
+  "1962",
+  "1970",
+  "1971",
+  "1972",
+  "1974",
+  "1976",
+  "1978",
+  "1979",
+  "1980",
+  "1982",
+  "1990",
+  "1996",
+  "1997",
+  "1998",
+  "2001",
+  "2010",
+  "24",
+  "25",
+  "29",
+  "4",
+  "Abandze",
+  "Abasobɔde",
+  "Abidjan",
+  "Abrefa",
+  "Abuja",
+  "Act",
+  "Aduru",
+  "Afoforo",
+  "Afrane",
+  "Ahenni",
+  "Ahyehyεde(WHO",
+  "Akanfoɔ",
+  "Akim",
+  "Akropong",
+  "Akwidaa",
+  "Alegre",
+  "Amanɔne",
+  "America",
+  "Anaafo",
+  "Anafo",
+};
+const uint16_t WA_FREQ_2_RANKS[] = {
+  935, 847, 0, 0, 432, 0, 65, 0, 707, 0, 691, 303, 187, 0, 0, 0,
+  593, 58, 586, 0, 0, 281, 695, 660, 0, 0, 0, 0, 0, 0, 400, 56,
+  646, 927, 736, 969, 0, 0, 0, 0, 16, 35, 0, 562, 0, 0, 168, 0,
+  0, 0, 0, 490, 181, 0, 375, 405, 498, 789, 808, 589, 988, 0, 121, 27,
+  540, 659, 0, 0, 6, 55, 600, 407, 0, 0, 0, 0, 0, 265, 868, 0,
+  0, 0, 0, 380, 0, 450, 843, 857, 0, 0, 0, 0, 0, 0, 0, 0,
+  477, 0, 597, 0, 0, 0, 0, 0, 0, 0, 0, 273, 680, 906, 0, 0,
+  0, 0, 726, 0, 0, 0, 469, 222, 279, 504, 583, 0, 0, 0, 658, 663,
+  232, 880, 0, 0, 0, 0, 0, 4, 0, 0, 92, 180, 517, 548, 209, 28,
+  607, 698, 0, 0, 0, 0, 0, 240, 585, 476, 853, 888, 256, 713, 0, 0,
+  746, 0, 0, 0, 0, 0, 575, 807, 0, 0, 18, 690, 189, 626, 261, 139,
+  508, 568, 631, 471, 545, 640, 700, 332, 723, 948, 0, 0, 90, 41, 0, 878,
+  976, 0, 773, 823, 0, 0, 274, 0, 0, 0, 442, 478, 0, 361, 324, 0,
+  156, 0, 452, 0, 383, 551, 930, 0, 0, 0, 0, 0, 0, 382, 864, 710,
+  0, 0, 241, 923, 0, 0, 0, 0, 0, 0, 401, 0, 308, 717, 0, 0,
+  0, 0, 0, 928, 0, 185, 96, 0, 0, 355, 822, 993, 0, 0, 0, 0,
+  0, 76, 0, 0, 0, 0, 0, 604, 0, 0, 0, 0, 223, 740, 0, 0,
+  0, 0, 531, 0, 895, 0, 0, 704, 756, 0, 0, 0, 0, 0, 0, 578,
+  0, 0, 0, 339, 535, 0, 266, 0, 0, 0, 146, 841, 0, 0, 39, 34,
+  101, 532, 620, 643, 748, 0, 629, 787, 0, 715, 395, 0, 0, 0, 0, 0,
+  0, 0, 449, 184, 618, 0, 0, 0, 0, 0, 0, 0, 0, 171, 0, 100,
+  708, 772, 966, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 609, 796, 649,
+  295, 502, 661, 764, 844, 304, 338, 949, 0, 0, 877, 0, 0, 552, 128, 0,
+  0, 0, 0, 19, 445, 0, 0, 0, 0, 0, 920, 0, 0, 0, 0, 0,
+  0, 327, 460, 0, 0, 463, 31, 467, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 283, 294, 87, 0, 0, 0, 0, 0, 759, 0, 0, 0, 0,
+  455, 0, 0, 505, 0, 0, 44, 167, 344, 491, 0, 306, 237, 0, 0, 0,
+  0, 0, 0, 1, 952, 989, 0, 0, 359, 0, 0, 11, 45, 269, 349, 503,
+  549, 514, 0, 0, 610, 909, 0, 0, 182, 0, 0, 0, 23, 346, 438, 897,
+  207, 0, 0, 305, 0, 0, 199, 0, 482, 227, 0, 0, 0, 560, 0, 0,
+  961, 683, 0, 22, 0, 633, 0, 73, 337, 225, 684, 0, 0, 0, 0, 0,
+  0, 221, 37, 933, 858, 0, 88, 790, 98, 0, 696, 24, 444, 813, 0, 0,
+  0, 0, 0, 0, 0, 81, 0, 0, 916, 0, 0, 0, 0, 0, 0, 905,
+  0, 0, 791, 734, 0, 0, 319, 142, 29, 0, 558, 0, 662, 385, 62, 0,
+  0, 0, 886, 430, 0, 0, 136, 506, 894, 994, 556, 0, 0, 792, 0, 0,
+  0, 0, 0, 0, 0, 61, 0, 0, 0, 95, 366, 981, 323, 239, 0, 0,
+  206, 913, 307, 270, 867, 950, 321, 0, 0, 0, 0, 0, 0, 866, 0, 0,
+  0, 946, 77, 0, 0, 0, 114, 416, 0, 0, 342, 0, 127, 216, 410, 992,
+  0, 784, 0, 0, 737, 0, 509, 0, 0, 0, 765, 262, 0, 0, 0, 0,
+  0, 247, 0, 885, 0, 0, 0, 742, 0, 0, 0, 0, 252, 0, 0, 528,
+  0, 0, 301, 311, 718, 872, 236, 312, 174, 536, 124, 569, 0, 32, 0, 135,
+  778, 781, 0, 0, 859, 0, 0, 990, 754, 753, 0, 702, 0, 638, 116, 376,
+  983, 0, 0, 0, 5, 411, 942, 0, 0, 0, 388, 0, 389, 421, 0, 0,
+  0, 0, 591, 0, 0, 0, 519, 161, 458, 133, 576, 348, 739, 943, 103, 0,
+  0, 852, 363, 0, 555, 210, 427, 605, 0, 0, 632, 64, 119, 0, 0, 0,
+  767, 0, 0, 679, 881, 925, 334, 211, 272, 441, 712, 984, 0, 494, 333, 945,
+  166, 0, 0, 0, 0, 0, 0, 220, 0, 204, 0, 762, 287, 0, 0, 0,
+  0, 0, 0, 0, 582, 932, 0, 0, 0, 454, 0, 619, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 670, 277, 598, 443, 0, 529, 656, 148, 559, 0, 0,
+  496, 0, 0, 0, 157, 353, 0, 0, 72, 160, 0, 0, 0, 0, 921, 0,
+  78, 66, 798, 0, 0, 351, 0, 0, 0, 291, 0, 0, 0, 325, 622, 912,
+  462, 347, 0, 0, 0, 501, 0, 0, 0, 978, 68, 0, 0, 0, 0, 571,
+  0, 186, 0, 0, 893, 392, 0, 0, 995, 0, 149, 601, 824, 0, 856, 0,
+  0, 212, 919, 0, 0, 793, 0, 0, 655, 0, 397, 938, 980, 0, 0, 0,
+  271, 621, 0, 0, 0, 248, 224, 0, 0, 0, 0, 890, 0, 42, 783, 0,
+  650, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 567, 654,
+  800, 75, 727, 964, 599, 0, 0, 0, 0, 0, 0, 0, 336, 431, 493, 292,
+  0, 0, 0, 0, 260, 412, 314, 243, 581, 735, 982, 0, 699, 0, 0, 934,
+  0, 402, 0, 863, 0, 0, 729, 0, 403, 0, 373, 998, 60, 0, 358, 21,
+  190, 743, 0, 0, 0, 0, 0, 0, 0, 0, 795, 130, 86, 108, 782, 908,
+  0, 0, 674, 480, 0, 0, 0, 398, 0, 997, 0, 849, 0, 0, 368, 429,
+  0, 0, 0, 0, 0, 817, 231, 85, 110, 953, 550, 238, 0, 423, 472, 0,
+  0, 0, 0, 0, 896, 0, 0, 175, 839, 669, 0, 0, 0, 14, 420, 475,
+  46, 413, 709, 818, 0, 0, 0, 0, 0, 0, 0, 904, 0, 7, 0, 0,
+  0, 768, 0, 0, 0, 179, 500, 513, 687, 0, 0, 0, 217, 543, 0, 0,
+  0, 0, 937, 671, 0, 0, 0, 0, 0, 0, 0, 244, 297, 0, 229, 0,
+  0, 0, 0, 750, 0, 158, 218, 926, 0, 0, 59, 692, 0, 234, 0, 0,
+  0, 0, 0, 0, 0, 138, 3, 372, 788, 57, 968, 0, 951, 0, 0, 0,
+  546, 869, 884, 0, 0, 0, 0, 685, 0, 246, 91, 425, 825, 0, 99, 144,
+  242, 470, 479, 681, 0, 0, 0, 0, 0, 448, 0, 0, 0, 991, 0, 0,
+  0, 887, 523, 0, 418, 577, 197, 899, 40, 268, 527, 667, 862, 0, 0, 129,
+  0, 0, 0, 0, 0, 386, 827, 865, 451, 0, 803, 0, 751, 901, 917, 623,
+  0, 328, 0, 0, 0, 763, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  645, 533, 408, 965, 979, 0, 0, 0, 0, 0, 0, 12, 641, 0, 848, 0,
+  0, 0, 0, 329, 606, 354, 801, 830, 892, 999, 165, 9, 826, 151, 0, 113,
+  907, 0, 0, 26, 0, 0, 0, 794, 93, 871, 0, 587, 0, 0, 0, 0,
+  391, 0, 286, 176, 0, 0, 255, 172, 0, 0, 811, 288, 0, 0, 0, 833,
+  664, 219, 776, 0, 0, 0, 821, 235, 914, 434, 1000, 487, 0, 507, 0, 0,
+  0, 0, 215, 538, 0, 810, 0, 0, 0, 0, 0, 0, 464, 666, 0, 0,
+  122, 0, 0, 0, 111, 722, 766, 200, 285, 495, 956, 0, 30, 0, 0, 0,
+  137, 566, 711, 741, 774, 205, 0, 0, 590, 360, 0, 0, 0, 51, 120, 486,
+  0, 0, 0, 0, 0, 0, 253, 0, 624, 837, 815, 958, 0, 0, 0, 0,
+  0, 0, 947, 0, 689, 651, 797, 672, 831, 228, 80, 668, 0, 474, 52, 118,
+  203, 0, 530, 611, 697, 446, 977, 350, 547, 563, 0, 962, 0, 0, 0, 0,
+  0, 0, 0, 0, 941, 0, 882, 0, 0, 258, 300, 0, 0, 0, 155, 929,
+  362, 457, 553, 534, 814, 250, 694, 345, 499, 162, 836, 931, 0, 0, 0, 592,
+  13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 188, 71, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 918, 518, 0, 0, 0, 0, 0, 364, 0,
+  0, 936, 0, 580, 721, 0, 0, 682, 0, 861, 0, 0, 447, 0, 0, 0,
+  440, 510, 0, 0, 406, 36, 290, 770, 0, 117, 320, 771, 820, 17, 686, 0,
+  0, 0, 0, 0, 706, 369, 485, 0, 974, 213, 0, 0, 630, 719, 752, 0,
+  89, 134, 0, 579, 196, 299, 465, 497, 678, 0, 0, 725, 263, 0, 829, 194,
+  986, 159, 94, 150, 854, 0, 0, 732, 677, 0, 0, 855, 0, 747, 83, 0,
+  0, 0, 154, 0, 0, 0, 636, 0, 195, 226, 647, 922, 0, 635, 0, 0,
+  0, 0, 0, 0, 0, 745, 900, 613, 0, 0, 0, 0, 147, 282, 428, 484,
+  574, 0, 0, 0, 0, 642, 104, 0, 456, 0, 0, 193, 0, 0, 251, 0,
+  0, 0, 0, 123, 0, 267, 326, 0, 515, 744, 0, 0, 0, 0, 0, 0,
+  169, 198, 0, 0, 0, 145, 173, 565, 0, 109, 786, 0, 0, 0, 0, 0,
+  115, 0, 537, 758, 0, 0, 0, 0, 0, 97, 439, 0, 0, 0, 628, 971,
+  0, 0, 0, 627, 0, 0, 140, 973, 0, 0, 422, 0, 0, 125, 0, 0,
+  985, 396, 335, 0, 0, 0, 192, 0, 0, 761, 483, 0, 588, 0, 0, 112,
+  0, 0, 775, 0, 0, 0, 0, 0, 170, 554, 0, 0, 816, 390, 38, 564,
+  393, 910, 688, 0, 777, 481, 0, 0, 987, 0, 0, 728, 0, 414, 0, 0,
+  526, 230, 0, 0, 975, 0, 0, 437, 249, 541, 648, 0, 0, 903, 0, 0,
+  15, 834, 143, 544, 377, 799, 0, 0, 757, 0, 615, 0, 596, 0, 0, 0,
+  0, 0, 0, 254, 539, 780, 492, 838, 0, 214, 245, 387, 461, 785, 0, 0,
+  191, 731, 0, 0, 846, 693, 0, 0, 399, 653, 84, 511, 612, 809, 876, 0,
+  322, 0, 0, 0, 0, 50, 652, 131, 153, 177, 152, 701, 0, 0, 634, 459,
+  521, 891, 0, 8, 489, 657, 0, 0, 488, 49, 82, 106, 276, 0, 316, 870,
+  812, 573, 0, 370, 572, 584, 0, 0, 284, 0, 409, 0, 875, 0, 0, 0,
+  0, 0, 0, 703, 433, 522, 963, 0, 298, 371, 0, 0, 317, 365, 957, 0,
+  0, 0, 0, 54, 769, 0, 0, 289, 102, 0, 318, 0, 0, 257, 0, 132,
+  860, 0, 0, 419, 404, 0, 0, 0, 70, 105, 379, 79, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 525, 183, 163, 310, 639, 879, 0, 0,
+  0, 0, 542, 0, 944, 0, 0, 0, 0, 0, 415, 898, 614, 960, 840, 0,
+  0, 0, 67, 394, 309, 426, 570, 637, 378, 602, 0, 233, 557, 0, 520, 724,
+  0, 802, 0, 0, 0, 384, 996, 20, 381, 280, 714, 0, 0, 468, 0, 0,
+  0, 705, 0, 972, 625, 617, 264, 760, 955, 0, 275, 63, 341, 842, 69, 832,
+  48, 33, 436, 25, 603, 676, 845, 851, 0, 0, 0, 0, 0, 0, 0, 970,
+  0, 0, 0, 0, 0, 0, 959, 10, 367, 749, 828, 0, 74, 0, 616, 0,
+  902, 0, 302, 0, 331, 0, 0, 0, 954, 178, 675, 805, 164, 0, 889, 0,
+  0, 716, 850, 107, 417, 374, 644, 343, 594, 755, 924, 665, 940, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 208, 0, 730, 779, 0, 967,
+  883, 0, 43, 313, 0, 0, 0, 516, 278, 911, 0, 0, 0, 473, 126, 259,
+  608, 330, 595, 873, 424, 673, 340, 939, 0, 0, 47, 561, 0, 0, 0, 524,
+  0, 819, 0, 0, 804, 201, 0, 0, 0, 0, 0, 293, 356, 315, 733, 874,
+  0, 806, 141, 720, 738, 453, 0, 466, 0, 0, 0, 296, 0, 0, 53, 0,
+  0, 435, 915, 0, 0, 0, 0, 0, 357, 352, 512, 0, 0, 202, 2, 835,
+};
+
+const char *WA_FREQ_3_TOKENS[] = {
+  "ነው።",
+  "ላይ",
+  "እና",
+  "ውስጥ",
+  "ወደ",
+  "ነበር።",
+  "ዓ.ም.",
+  "እንደ",
+  "ሲሆን",
+  "ግን",
+  "ይህ",
+  "ቀን",
+  "ጊዜ",
+  "ወይም",
+  "ጋር",
+  "በኋላ",
+  "ደግሞ",
+  "እስከ",
+  "ዘመን",
+  "ነው",
+  "አንድ",
+  "ምሳሌ",
+  "ከተማ",
+  "የአማርኛ",
+  "ድረስ",
+  "ማለት",
+  "በዚህ",
+  "መንግሥት",
+  "ነገር",
+  "ብዙ",
+  "የኢትዮጵያ",
+  "ንጉሥ",
+  "ስም",
+  "በኢትዮጵያ",
+  "አገር",
+  "ልጅ",
+  "ብቻ",
+  "ሁሉ",
+  "ዋና",
+  "ሰው",
+  "ናቸው።",
+  "ከዚህ",
+  "በላይ",
+  "ጀምሮ",
+  "ኢትዮጵያ",
+  "ቤት",
+  "ሆኖ",
+  "ታሪክ",
+  "ሰዎች",
+  "እንዲሁም",
+  "ስለ",
+  "ዓመት",
+  "ዓ/ም",
+  "ያለው",
+  "ቁጥር",
+  "መካከል",
+  "አይነት",
+  "ዘንድ",
+  "ሁለት",
+  "በ",
+  "አዲስ",
+  "ነበር",
+  "አቆጣጠር",
+  "በዘመነ",
+  "ክፍል",
+  "የሚገኝ",
+  "ብሎ",
+  "ዓክልበ",
+  "ምክንያት",
+  "አበባ",
+  "ከፍተኛ",
+  "ሕዝብ",
+  "ቤተ",
+  "አንዱ",
+  "በፊት",
+  "ይህን",
+  "መንገድ",
+  "አሁን",
+  "ቋንቋ",
+  "ሁኔታ",
+  "ነበሩ።",
+  "ወቅት",
+  "ሆነ",
+  "እ.ኤ.አ.",
+  "ቦታ",
+  "ዓመታት",
+  "አመት",
+  "ሌላ",
+  "ምንም",
+  "በጣም",
+  "ሳይሆን",
+  "ይባላል።",
+  "ሌሎች",
+  "ህዝብ",
+  "ትምህርት",
+  "ነበረ።",
+  "ያለ",
+  "እንጂ",
+  "ሆነ።",
+  "ክፍለ",
+  "ጦርነት",
+  "ዛሬ",
+  "ብለው",
+  "ቅዱስ",
+  "ተብሎ",
+  "ደረጃ",
+  "እንዲህ",
+  "የሚል",
+  "ከዚያ",
+  "እጅግ",
+  "ሆኖም",
+  "ለምሳሌ",
+  "ልጆች",
+  "በአንድ",
+  "በእንግሊዝኛ",
+  "በተለይ",
+  "መንግስት",
+  "ቃል",
+  "መሆኑን",
+  "ወንዝ",
+  "ይህም",
+  "ልዩ",
+  "የሆነ",
+  "ክርስቲያን",
+  "እነዚህ",
+  "አካባቢ",
+  "ካሌንዳር",
+  "የ",
+  "በጎርጎርያን",
+  "ስለዚህ",
+  "የቀን",
+  "ምን",
+  "ክልል",
+  "ይገኛል።",
+  "እንደሆነ",
+  "ግዛት",
+  "ከ1892",
+  "2091",
+  "ዋና ከተማ",
+  "በኩል",
+  "1",
+  "ዓ.ም",
+  "ንጉስ",
+  "ጉዳይ",
+  "ስራ",
+  "ዕለት",
+  "በሙሉ",
+  "ስሙ",
+  "ኃይል",
+  "ወያኔ",
+  "ሆነው",
+  "ድርጅት",
+  "ትግል",
+  "ይታወቃል።",
+  "ታላቅ",
+  "ግንቦት",
+  "የነበረው",
+  "ግድም",
+  "የተለያዩ",
+  "አቶ",
+  "እንግሊዝኛ",
+  "ነገሥታት",
+  "አለም",
+  "አየር",
+  "በአሁኑ",
+  "ያህል",
+  "በሌላ",
+  "ዘመነ",
+  "መሠረት",
+  "2",
+  "7",
+  "ይችላል።",
+  "መጠን",
+  "ሲሆን፣",
+  "በዚሁ",
+  "መጽሐፍ",
+  "ቡድን",
+  "አለቃ",
+  "ሴት",
+  "ኳስ",
+  "ነገሮች",
+  "ሙሉ",
+  "በማለት",
+  "አባት",
+  "ዜና",
+  "አንዳንድ",
+  "እንደገና",
+  "ደቡብ",
+  "ሥራ",
+  "አካል",
+  "ዙሪያ",
+  "መጀመርያ",
+  "ጥናት",
+  "መሰረት",
+  "እምነት",
+  "3",
+  "ትልቅ",
+  "ዝርዝር",
+  "ሉቃስ",
+  "መሪ",
+  "ዓለም",
+  "ያለውን",
+  "ማቴዎስ",
+  "ሜትር",
+  "አዲስ አበባ",
+  "ከ",
+  "ወይንም",
+  "የሚለው",
+  "ሁሉም",
+  "ዉስጥ",
+  "መቶ",
+  "ወር",
+  "የወያኔ",
+  "አመታት",
+  "ምንጊዜም",
+  "በደቡብ",
+  "ኢትዮጵያዊ",
+  "ጥንታዊ",
+  "የሰው",
+  "በተለያዩ",
+  "አሉ።",
+  "መሆኑ",
+  "ራስ",
+  "ቋንቋዎች",
+  "ናት።",
+  "ስለሆነም",
+  "ነዉ።",
+  "የህዝብ",
+  "እኔ",
+  "የመጀመሪያው",
+  "ታዋቂ",
+  "ከዚያም",
+  "ወገን",
+  "ይሆናል።",
+  "ጦር",
+  "ወረዳ",
+  "ሀገር",
+  "ሺህ",
+  "ፓርቲ",
+  "ይላል።",
+  "ድል",
+  "ሚሊዮን",
+  "አባል",
+  "እግር",
+  "ፊደል",
+  "መሬት",
+  "ሥላሴ",
+  "በተጨማሪ",
+  "እጅ",
+  "ነው፡፡",
+  "መጨረሻ",
+  "ውጭ",
+  "ቢሆንም",
+  "አይደለም።",
+  "ስርዓት",
+  "አቀፍ",
+  "ይህንን",
+  "ይገኛሉ።",
+  "ዮሐንስ",
+  "የዚህ",
+  "ይቻላል።",
+  "ክርስቶስ",
+  "የዓለም",
+  "የአሜሪካ",
+  "አገሮች",
+  "ሲል",
+  "ሲሆኑ",
+  "ለዚህ",
+  "ብርሃን",
+  "ተመሳሳይ",
+  "እንኳን",
+  "ሠራዊት",
+  "በአዲስ",
+  "ትርጉም",
+  "የፖለቲካ",
+  "በዚያ",
+  "ትንሽ",
+  "ንጉሠ",
+  "አለው።",
+  "ብዛት",
+  "ስር",
+  "ያሉ",
+  "እናም",
+  "ክፍሎች",
+  "ምድር",
+  "በሚል",
+  "ውጤት",
+  "አፈ",
+  "መልኩ",
+  "ዓፄ",
+  "ጽሑፍ",
+  "ሥርወ",
+  "ቀናት",
+  "አፍሪካ",
+  "ሥፍራ",
+  "መሆን",
+  "ኗሪ",
+  "ግንኙነት",
+  "በመሆን",
+  "ኃይለ",
+  "አለ።",
+  "የተባለው",
+  "ምርጫ",
+  "የሚባል",
+  "በዚህም",
+  "አሜሪካ",
+  "እንግዲህ",
+  "ያላቸው",
+  "ዘንድ፣",
+  "አራት",
+  "ምኒልክ",
+  "ሊሆን",
+  "ምናልባት",
+  "በመሆኑ",
+  "በርካታ",
+  "አባላት",
+  "አገዛዝ",
+  "ሥልጣን",
+  "ኢትዮጵያን",
+  "የሙዚቃ",
+  "ማርያም",
+  "ጥቅም",
+  "ጥያቄ",
+  "ነጥብ",
+  "እንዴት",
+  "መረጃ",
+  "ሴቶች",
+  "እንደነበር",
+  "ዋጋ",
+  "የሆኑ",
+  "የነበሩት",
+  "ግዜ",
+  "ተግባር",
+  "ናቸው",
+  "ዘዴ",
+  "ገንዘብ",
+  "ጥሩ",
+  "ፊት",
+  "አድርጎ",
+  "ከላይ",
+  "በመባል",
+  "ከተማው",
+  "ገና",
+  "ማድረግ",
+  "ምክር",
+  "ሃይማኖት",
+  "ለውጥ",
+  "ሦስት",
+  "ችግር",
+  "መብት",
+  "ማርቆስና",
+  "10",
+  "ለማድረግ",
+  "አጼ",
+  "እግር ኳስ",
+  "4",
+  "ሰዓት",
+  "ቢሆን",
+  "ትውልድ",
+  "አገልግሎት",
+  "ዘመናዊ",
+  "ይመስላል።",
+  "ይገመታል።",
+  "አደጋ",
+  "እስካሁን",
+  "እዚህ",
+  "እግዚአብሔር",
+  "ባለ",
+  "ዓይነት",
+  "የሆነው",
+  "ሥነ",
+  "አምላክ",
+  "እንቅስቃሴ",
+  "የኤሌክትሪክ",
+  "ብሔራዊ",
+  "ተስፋ",
+  "ደብረ",
+  "ፍቅር",
+  "ህግ",
+  "የተባለ",
+  "የዓመቱ",
+  "ይልቅ",
+  "ስልጣን",
+  "በጥንታዊ",
+  "ይሄ",
+  "p.",
+  "መንግሥታት",
+  "ከአንድ",
+  "የጋራ",
+  "ያሉት",
+  "ሊቃውንት",
+  "አሁንም",
+  "ከተሞች",
+  "በማድረግ",
+  "5",
+  "መጀመሪያ",
+  "በብዙ",
+  "ተራራ",
+  "እኛ",
+  "ውድድር",
+  "የአየር",
+  "መጻሕፍት",
+  "ሶስት",
+  "ቤተክርስቲያን",
+  "በተለይም",
+  "እውነት",
+  "ሥርዓት",
+  "ሰራዊት",
+  "ቤቶች",
+  "ብር",
+  "ዓመቱ",
+  "ዘር",
+  "ቀጥሎ",
+  "አለ",
+  "አንድነት",
+  "የነበረ",
+  "የውጭ",
+  "ግብጽ",
+  "ምንጭ",
+  "የሕዝብ",
+  "የሚገኘው",
+  "የአንድ",
+  "ምልክት",
+  "እንኳ",
+  "ዜጎች",
+  "የተነሳ",
+  "ደሴት",
+  "ነጻነት",
+  "አልፎ",
+  "እያለ",
+  "የጦር",
+  "ድምጽ",
+  "መስከረም",
+  "ቅርስ",
+  "ቴዎድሮስ",
+  "አምስት",
+  "ከሆነ",
+  "ለመጀመሪያ",
+  "መሳሪያ",
+  "ኢየሱስ",
+  "ከሌሎች",
+  "ልክ",
+  "ሜዳ",
+  "የሚባለው",
+  "የነበረውን",
+  "ገጽ",
+  "ጠቅላይ",
+  "ከፍ",
+  "የነበሩ",
+  "ምዕራብ",
+  "ግሪክ",
+  "ጥቂት",
+  "ሁለተኛ",
+  "ሲሉ",
+  "ባለው",
+  "ነገሥቱ",
+  "እያንዳንዱ",
+  "የራሱ",
+  "ድርጅቶች",
+  "ጥረት",
+  "በዓለም",
+  "አቅም",
+  "of",
+  "አሉት።",
+  "የመጀመሪያ",
+  "ጊዮርጊስ",
+  "ጋራ",
+  "ፕሬዝዳንት",
+  "ሌላው",
+  "ወጣት",
+  "ውሃ",
+  "የግብጽ",
+  "ጽሕፈት",
+  "መስመር",
+  "ባሕር",
+  "ነገሥት",
+  "ፖለቲካ",
+  "ቃላት",
+  "በሁለት",
+  "ታሪካዊ",
+  "የሚኖርበት",
+  "ደም",
+  "መልክ",
+  "ስብስብ",
+  "መሪዎች",
+  "ተከታይ",
+  "ነጻ",
+  "ዘመቻ",
+  "የሚገኙ",
+  "ፈርዖን",
+  "ሃይል",
+  "ጉዳት",
+  "ፕሬዚዳንት",
+  "ሁለቱ",
+  "መንፈስ",
+  "በታሪክ",
+  "የኢትዮጵያን",
+  "ሂደት",
+  "አገራት",
+  "መዋዕል",
+  "እሱ",
+  "እኩል",
+  "የሚለውን",
+  "ህይወት",
+  "መኮንን",
+  "ስትሆን",
+  "ነዉ",
+  "እርስ",
+  "እንዲሆን",
+  "ሁለተኛው",
+  "ሰኔ",
+  "በአንዳንድ",
+  "ያ",
+  "ደራሲ",
+  "ጎን",
+  "ስሜት",
+  "ከኢትዮጵያ",
+  "ወንድ",
+  "መልስ",
+  "ሥር",
+  "በራሱ",
+  "የትምህርት",
+  "ጥቅምት",
+  "ስለሆነ",
+  "ቀይ",
+  "በመጨረሻ",
+  "በሰሜን",
+  "በሽታ",
+  "ቀዳማዊ",
+  "ቅርጽ",
+  "አስቀድሞ",
+  "የከተማው",
+  "ጌታ",
+  "ቀደም",
+  "ርቀት",
+  "ስሞች",
+  "እ.አ.አ.",
+  "ወዘተ",
+  "የለም።",
+  "ይዞ",
+  "አቅጣጫ",
+  "ኢትዮጵያውያን",
+  "ወርቅ",
+  "ሐምሌ",
+  "በአሜሪካ",
+  "አስተሳሰብ",
+  "አድርገው",
+  "ጥር",
+  "በኋላ፣",
+  "ትርጉሙ፡",
+  "አጠቃላይ",
+  "ዘርፍ",
+  "ይሁን",
+  "ገዥ",
+  "ምክንያቱም",
+  "በመጠቀም",
+  "ተራ",
+  "በሆነ",
+  "እርምጃ",
+  "እንዲሁ",
+  "ከነዚህ",
+  "የአፍሪካ",
+  "6",
+  "ቀድሞ",
+  "በተጨማሪም",
+  "ቤቱ",
+  "የእንግሊዝ",
+  "መጋቢት",
+  "በመቶ",
+  "በኋላም",
+  "ወታደሮች",
+  "ጥበብ",
+  "በሌሎች",
+  "ተብለው",
+  "አብዛኛው",
+  "ሕዝቦች",
+  "መልካም",
+  "ስምምነት",
+  "ቀላል",
+  "ታላቁ",
+  "አልፋቤት",
+  "ኦርቶዶክስ",
+  "ይችላሉ።",
+  "አበበ",
+  "ከሁሉ",
+  "ኪዳን",
+  "የመሬት",
+  "ይታመናል።",
+  "ዳር",
+  "ጎንደር",
+  "የደቡብ",
+  "ጨምሮ",
+  "ጨዋታ",
+  "ለማግኘት",
+  "ልጁ",
+  "ማለትም",
+  "ሰላም",
+  "ተደርጎ",
+  "ክብር",
+  "ወልደ",
+  "ፍላጎት",
+  "ፕሬዚደንት",
+  "ሆኑ።",
+  "ልብ",
+  "መኖር",
+  "ሚና",
+  "አስፈላጊ",
+  "እናት",
+  "ሚኒስቴር",
+  "ማርቆስ",
+  "በታች",
+  "አንጻር",
+  "እያሉ",
+  "ዘመናት",
+  "ገደማ",
+  "ሚስት",
+  "ስፋት",
+  "ነበር፤",
+  "ሆኗል።",
+  "ማዕረግ",
+  "ሰሜን",
+  "ቀለም",
+  "በቀላሉ",
+  "ተጨማሪ",
+  "ንቅናቄ",
+  "አስተዳደር",
+  "የበለጠ",
+  "ጉባኤ",
+  "ልዩነት",
+  "ጉዞ",
+  "መሰረታዊ",
+  "በር",
+  "ወራት",
+  "የካቲት",
+  "20",
+  "ለብዙ",
+  "ለኢትዮጵያ",
+  "ሚኒስትር",
+  "አንጄሎ",
+  "እራሱ",
+  "እርዳታ",
+  "የአዲስ",
+  "ድንግል",
+  "በብዛት",
+  "የሚታወቀው",
+  "የምትገኝ",
+  "ይሆናል",
+  "ጉልበት",
+  "ልማት",
+  "ሕገ",
+  "ሰባት",
+  "ሸዋ",
+  "ቋሚ",
+  "በይፋ",
+  "ትዕዛዝ",
+  "ነው፤",
+  "አይደለም",
+  "ጀመረ።",
+  "ሃሳብ",
+  "ሕዝባዊ",
+  "መጀመርያው",
+  "ሰፊ",
+  "በዋናነት",
+  "ባህር",
+  "ነሐሴ",
+  "ንግሥት",
+  "ጥሪ",
+  "ለ",
+  "ለመሆን",
+  "መንደር",
+  "በወቅቱ",
+  "በዚያው",
+  "ባለቤት",
+  "ቦታዎች",
+  "እርሱ",
+  "እሱም",
+  "ዋንጫ",
+  "ዘፍጥረት",
+  "የራሱን",
+  "የታሪክ",
+  "የግሪክ",
+  "በአለም",
+  "አቡነ",
+  "አቶማዊ",
+  "ኪሎ",
+  "ጸሐፊ",
+  "ፍጥነት",
+  "መኖሪያ",
+  "ሚያዝያ",
+  "ስለነበር",
+  "በርስ",
+  "በተባለ",
+  "በጥንት",
+  "ኅዳር",
+  "ንጉሱ",
+  "አውራጃ",
+  "አጠገብ",
+  "ከባድ",
+  "ዜናዊ",
+  "የአለም",
+  "ፍርድ",
+  "12",
+  "ሕግ",
+  "መቀመጫ",
+  "ሞት",
+  "ቅኝ",
+  "ብለን",
+  "አብሮ",
+  "ድጋፍ",
+  "8",
+  "The",
+  "ስሜን",
+  "በቂ",
+  "ጉዳዮች",
+  "ነበረች።",
+  "እኒህ",
+  "ዛሬም",
+  "የሚሰራ",
+  "የተፈጥሮ",
+  "ደጃዝማች",
+  "ማይክል",
+  "ሰነድ",
+  "በጋራ",
+  "ብሔር",
+  "ትልቁ",
+  "ኢትዮጵያዊያን",
+  "ወታደራዊ",
+  "የሚችል",
+  "የአገሪቱ",
+  "ዳግማዊ",
+  "ዴሞክራሲያዊ",
+  "ስራው",
+  "ቁጥሩም",
+  "በአፍሪካ",
+  "ኑሮ",
+  "ከዚህም",
+  "ክ.በ.",
+  "ውቅያኖስ",
+  "ይዘው",
+  "ግንብ",
+  "ምንጮች",
+  "በከፍተኛ",
+  "ተማሪዎች",
+  "አመራር",
+  "አስተያየት",
+  "እስር",
+  "እቴጌ",
+  "ወዲህ",
+  "የአካባቢውን",
+  "የእግር",
+  "ዶ/ር",
+  "ሕይወት",
+  "ሰላማዊ",
+  "ሲባል",
+  "ስፍራ",
+  "ቤተሰብ",
+  "ታኅሣሥ",
+  "ነፃ",
+  "እራሱን",
+  "የባቢሎን",
+  "የትግል",
+  "መቅደስ",
+  "ስድስት",
+  "በጊዜው",
+  "አላቸው።",
+  "የተገኘ",
+  "ገብረ",
+  "ጠላት",
+  "ሰወች",
+  "ስብሰባ",
+  "በአጠቃላይ",
+  "ቢያንስ",
+  "ነበር፣",
+  "አካላት",
+  "እንዳለ",
+  "ዕብራይስጥ",
+  "ዛፍ",
+  "የሆኑት",
+  "የለም",
+  "የምግብ",
+  "ይላሉ።",
+  "ጀርመን",
+  "ግ.",
+  "30",
+  "ሁለቱም",
+  "ሚካኤል",
+  "በአማርኛ",
+  "ቶሎ",
+  "ወረራ",
+  "የሚያሳይ",
+  "የስራ",
+  "የጀርመን",
+  "ጫፍ",
+  "15",
+  "ሃያ",
+  "ሙዚቃ",
+  "ርዝመት",
+  "ሱዳን",
+  "ኤርትራ",
+  "እንዳለው",
+  "ወገኖች",
+  "ግቢ",
+  "ጥቃት",
+  "ትውፊት",
+  "አስተዳዳሪ",
+  "ዘፋኝ",
+  "የንግድ",
+  "ይጠቀሳል።",
+  "ድንጋይ",
+  "ዶላር",
+  "ፈረንሳይኛ",
+  "13",
+  "ማንም",
+  "ስዕል",
+  "ስያሜ",
+  "እንግሊዝ",
+  "ይቀራሉ።",
+  "ፈቃድ",
+  "ሳርጎን",
+  "በተባለው",
+  "በወያኔ",
+  "ብሄራዊ",
+  "ተቋም",
+  "ነበሩ",
+  "አለበት።",
+  "አርበኞች",
+  "አዲሱ",
+  "ካሬ",
+  "ሲሆን፤",
+  "በዓል",
+  "ተከታዮች",
+  "ኃይሎች",
+  "አደረገ።",
+  "ክለብ",
+  "ዞን",
+  "የሆነውን",
+  "ጀመሩ።",
+  "ገበያ",
+  "ህዝባዊ",
+  "ለምን",
+  "ምስራቅ",
+  "ምክትል",
+  "በቅርቡ",
+  "ቡድኖች",
+  "አማርኛ",
+  "ኪ.ሜ.",
+  "ክፍላገር",
+  "ወይዘሮ",
+  "ወዲያው",
+  "ዓክልበ.",
+  "11",
+  "in",
+  "መሆናቸውን",
+  "መለስ",
+  "ሲገመት",
+  "በግብጽ",
+  "ተራሮች",
+  "አላማ",
+  "ዘመድ",
+  "የሌለው",
+  "የግል",
+  "ያለበት",
+  "ደብዳቤ",
+  "ጥቁር",
+  "ሊግ",
+  "መንግሥቱ",
+  "በስሜን",
+  "ታቦር",
+  "አምባ",
+  "እነዚህን",
+  "ወንጀል",
+  "ዓላማ",
+  "የዘር",
+  "ዴ",
+  "ድርጊት",
+  "ግንባር",
+  "ቀስ",
+  "በምዕራብ",
+  "በተሰኘው",
+  "በተደጋጋሚ",
+  "ትርጉም፦",
+  "አጭር",
+  "እድሜ",
+  "የሚሉ",
+  "የብርሃን",
+  "የተባለውን",
+  "ዲ",
+  "ፈረንሳይ",
+  "ፍልስፍና",
+  "፪",
+  "and",
+  "ለዚህም",
+  "በምድር",
+  "በግሪክ",
+  "ባለፉት",
+  "ተወለዱ።",
+  "ነገሮችን",
+  "አባባል",
+  "አገሩ",
+  "ከአዲስ",
+  "የተሰራ",
+  "ይታያል።",
+  "ይገባል።",
+  "ይገኙበታል።",
+  "ግማሽ",
+  "ቀመር",
+  "በማቅረብ",
+  "ተባለ።",
+  "ተከትሎ",
+  "ንግግር",
+  "ኛው",
+  "አውሮፕላን",
+  "ከሁለት",
+  "ክብ",
+  "ወያኔን",
+  "ዜጋ",
+  "የያዘ",
+  "፩",
+  "ልማድ",
+  "ልጁን",
+  "ችግሮች",
+  "ነጭ",
+  "አመጽ",
+  "አባ",
+  "አይነቶች",
+  "ከነዚህም",
+  "የአሦር",
+  "ግጭት",
+  "ሙከራ",
+  "ማን",
+  "ሠንጠረዥ",
+  "ስሙን",
+  "በአብዛኛው",
+  "ንብረት",
+  "እንዲያውም",
+  "ውሳኔ",
+  "የግዕዝ",
+  "ድረስ፣",
+  "፫",
+  "ሀገራት",
+  "ለማወቅ",
+  "ልደት",
+  "ልጅና",
+  "ማንኛውም",
+  "ቡና",
+  "ተከተለው።",
+  "ተጫዋች",
+  "ነው፣",
+  "አንድን",
+  "እድል",
+  "ወጣቶች",
+  "የቀድሞ",
+  "ድምፅ",
+  "ግልጽ",
+  "16",
+  "ለአንድ",
+  "መነሻ",
+  "መደብ",
+  "ምግብ",
+  "ረጅም",
+  "ረገድ",
+  "ሲጨምር",
+  "ሸንጎ",
+  "በቀጥታ",
+  "ተቋማት",
+  "ተዋሕዶ",
+  "ቻይና",
+  "ኋላ",
+  "እስያ",
+  "ያሳያል።",
+  "ይነገራል።",
+  "ደስታ",
+  "ደቂቃ",
+  "ዳሩ",
+  "ድንበር",
+  "ሃገር",
+  "መኪና",
+  "ማዕከል",
+  "ማየት",
+  "በሱመር",
+  "በአካባቢው",
+  "ነኝ",
+  "ኗሪዎች",
+  "አባቱ",
+  "አየርላንድ",
+  "እድገት",
+  "ወይ",
+  "የመንግስት",
+  "የትግራይ",
+  "ዩኒቨርሲቲ",
+  "ይችላል",
+  "ጠረፍ",
+  "ጣቢያ",
+  "ሕገ መንግሥት",
+  "ማኅበር",
+  "በአማራ",
+  "ተግባራዊ",
+  "እነ",
+  "የሱመር",
+  "የተለየ",
+};
+const uint16_t WA_FREQ_3_RANKS[] = {
+  0, 0, 0, 0, 486, 251, 0, 0, 0, 0, 587, 314, 0, 0, 522, 0,
+  0, 0, 48, 539, 0, 845, 867, 620, 230, 581, 309, 0, 0, 370, 0, 3,
+  533, 102, 754, 898, 0, 0, 0, 677, 0, 208, 84, 0, 903, 0, 0, 0,
+  896, 83, 363, 0, 0, 0, 661, 0, 603, 0, 299, 996, 291, 205, 541, 574,
+  0, 200, 760, 284, 248, 472, 897, 222, 0, 0, 89, 828, 122, 568, 521, 907,
+  0, 0, 0, 0, 0, 0, 457, 791, 0, 124, 0, 0, 434, 171, 0, 0,
+  0, 143, 270, 757, 998, 0, 0, 0, 0, 0, 0, 0, 919, 626, 934, 177,
+  0, 0, 0, 0, 753, 105, 0, 0, 285, 169, 683, 0, 0, 0, 0, 0,
+  286, 259, 0, 114, 154, 0, 485, 60, 38, 331, 402, 0, 0, 433, 0, 811,
+  27, 584, 844, 0, 0, 96, 358, 0, 51, 68, 0, 575, 932, 294, 0, 0,
+  0, 72, 123, 340, 943, 997, 628, 0, 520, 813, 0, 0, 0, 0, 948, 0,
+  0, 0, 873, 0, 0, 0, 59, 0, 0, 351, 0, 0, 0, 0, 0, 0,
+  0, 166, 0, 672, 792, 822, 0, 0, 401, 373, 0, 144, 0, 0, 325, 899,
+  947, 889, 0, 0, 591, 442, 131, 0, 146, 36, 0, 0, 0, 218, 750, 735,
+  0, 0, 245, 206, 272, 905, 280, 0, 0, 0, 0, 497, 12, 936, 0, 577,
+  0, 0, 0, 0, 0, 0, 0, 0, 646, 0, 0, 0, 448, 623, 669, 98,
+  719, 957, 0, 0, 569, 589, 85, 0, 0, 0, 0, 0, 0, 324, 855, 0,
+  0, 559, 824, 50, 715, 861, 0, 46, 100, 0, 0, 0, 0, 224, 17, 734,
+  821, 516, 406, 682, 748, 566, 887, 0, 0, 0, 0, 0, 189, 773, 0, 0,
+  0, 0, 0, 135, 52, 437, 6, 0, 0, 0, 0, 0, 13, 0, 0, 970,
+  118, 0, 0, 263, 0, 900, 605, 0, 0, 0, 0, 0, 0, 0, 55, 491,
+  617, 266, 688, 687, 412, 833, 0, 0, 732, 0, 556, 0, 113, 0, 848, 204,
+  0, 252, 768, 274, 583, 0, 0, 0, 0, 0, 277, 0, 0, 271, 967, 0,
+  0, 0, 590, 0, 465, 720, 0, 0, 482, 0, 439, 0, 0, 0, 959, 0,
+  0, 0, 0, 537, 0, 374, 0, 301, 364, 810, 633, 0, 0, 0, 0, 980,
+  782, 0, 493, 700, 0, 0, 0, 0, 0, 0, 978, 477, 509, 0, 0, 0,
+  193, 264, 960, 0, 600, 560, 0, 0, 976, 0, 276, 470, 0, 0, 346, 344,
+  859, 0, 0, 851, 275, 352, 49, 912, 774, 430, 0, 610, 807, 0, 0, 283,
+  631, 638, 0, 0, 456, 0, 0, 0, 0, 630, 676, 278, 0, 0, 742, 265,
+  0, 315, 0, 933, 372, 147, 445, 0, 0, 548, 197, 834, 86, 831, 0, 0,
+  0, 443, 655, 0, 0, 253, 961, 0, 0, 0, 0, 246, 0, 0, 386, 0,
+  0, 0, 0, 15, 459, 946, 0, 0, 0, 621, 0, 941, 0, 281, 489, 332,
+  0, 992, 0, 0, 168, 0, 594, 0, 0, 335, 0, 698, 0, 256, 10, 649,
+  656, 915, 0, 625, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 179, 939,
+  133, 914, 0, 764, 0, 840, 0, 0, 4, 16, 0, 0, 712, 142, 968, 74,
+  159, 376, 397, 480, 709, 847, 0, 744, 0, 292, 467, 797, 0, 0, 82, 841,
+  0, 0, 318, 361, 393, 0, 0, 0, 0, 297, 0, 54, 348, 762, 0, 723,
+  832, 0, 338, 383, 640, 0, 0, 0, 0, 717, 554, 983, 0, 0, 1, 0,
+  307, 199, 0, 0, 0, 704, 0, 0, 684, 254, 736, 0, 0, 40, 97, 151,
+  0, 0, 202, 0, 0, 0, 213, 696, 0, 0, 0, 0, 0, 343, 0, 0,
+  765, 0, 161, 58, 66, 330, 545, 0, 0, 0, 557, 43, 191, 313, 0, 769,
+  44, 0, 0, 0, 110, 231, 0, 0, 0, 624, 260, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 101, 138, 645, 0, 0, 0, 0, 0, 622, 0, 763, 0,
+  0, 221, 837, 0, 570, 0, 7, 0, 0, 0, 242, 0, 0, 902, 176, 531,
+  0, 0, 0, 311, 579, 846, 436, 0, 0, 0, 0, 647, 152, 0, 0, 514,
+  198, 220, 293, 0, 180, 958, 989, 408, 0, 0, 216, 405, 424, 250, 0, 377,
+  0, 305, 952, 862, 0, 0, 0, 0, 713, 0, 632, 0, 0, 0, 0, 1000,
+  249, 0, 779, 0, 0, 966, 0, 876, 0, 0, 119, 839, 953, 0, 11, 228,
+  333, 616, 0, 0, 0, 0, 0, 73, 0, 0, 0, 471, 0, 0, 0, 34,
+  0, 0, 945, 0, 0, 525, 0, 287, 664, 0, 0, 70, 721, 0, 240, 268,
+  886, 0, 849, 75, 45, 484, 279, 512, 881, 0, 0, 515, 0, 0, 642, 963,
+  972, 461, 0, 987, 211, 452, 0, 18, 190, 703, 0, 784, 0, 258, 0, 0,
+  0, 0, 0, 0, 0, 653, 316, 0, 0, 842, 0, 0, 635, 0, 0, 0,
+  0, 0, 0, 0, 0, 540, 611, 0, 0, 681, 0, 356, 0, 567, 0, 0,
+  0, 0, 0, 106, 0, 0, 0, 0, 0, 326, 781, 0, 329, 0, 282, 140,
+  0, 0, 0, 0, 215, 518, 670, 310, 0, 0, 0, 184, 375, 137, 504, 334,
+  576, 648, 428, 949, 0, 895, 0, 0, 0, 0, 0, 745, 0, 0, 0, 464,
+  0, 0, 910, 586, 0, 0, 387, 619, 207, 0, 0, 0, 0, 0, 33, 0,
+  451, 0, 0, 0, 0, 0, 0, 0, 5, 14, 149, 483, 658, 937, 0, 0,
+  0, 565, 838, 0, 479, 0, 0, 0, 0, 0, 0, 500, 0, 20, 0, 195,
+  0, 0, 56, 994, 0, 0, 0, 755, 0, 328, 0, 0, 665, 0, 0, 0,
+  0, 0, 247, 150, 298, 673, 695, 702, 731, 975, 0, 0, 892, 108, 0, 0,
+  507, 671, 775, 529, 0, 829, 241, 0, 0, 0, 0, 858, 0, 196, 0, 99,
+  503, 880, 962, 0, 0, 453, 389, 0, 227, 801, 0, 411, 431, 0, 0, 751,
+  0, 0, 0, 0, 0, 0, 167, 336, 0, 826, 0, 808, 790, 0, 400, 738,
+  644, 770, 918, 0, 0, 158, 534, 964, 2, 697, 739, 693, 0, 178, 79, 233,
+  0, 39, 0, 95, 0, 454, 341, 743, 0, 0, 0, 0, 0, 0, 0, 0,
+  495, 511, 229, 427, 262, 524, 894, 385, 396, 0, 379, 0, 0, 0, 188, 21,
+  181, 0, 0, 761, 0, 0, 0, 111, 217, 0, 172, 553, 0, 794, 803, 783,
+  0, 57, 0, 707, 549, 0, 0, 317, 0, 357, 0, 893, 0, 24, 458, 0,
+  0, 0, 0, 0, 0, 0, 0, 982, 463, 795, 662, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 29, 558, 366, 660, 0, 850, 0, 864, 789, 156, 0,
+  0, 120, 592, 0, 0, 0, 0, 752, 371, 0, 394, 865, 148, 290, 836, 468,
+  0, 0, 527, 0, 163, 212, 904, 0, 0, 0, 214, 0, 0, 487, 668, 0,
+  0, 0, 0, 0, 0, 766, 0, 513, 0, 0, 990, 679, 302, 0, 0, 0,
+  0, 0, 0, 304, 384, 532, 890, 0, 319, 563, 0, 0, 778, 0, 183, 488,
+  986, 413, 492, 0, 714, 969, 0, 236, 0, 0, 0, 8, 0, 0, 175, 0,
+  0, 0, 446, 136, 22, 571, 595, 0, 0, 999, 61, 0, 674, 857, 0, 800,
+  139, 0, 0, 0, 798, 804, 0, 988, 473, 0, 0, 0, 0, 174, 28, 911,
+  718, 913, 916, 0, 0, 0, 237, 0, 0, 530, 0, 0, 0, 0, 0, 816,
+  0, 650, 0, 780, 884, 0, 267, 203, 0, 269, 817, 901, 0, 580, 0, 922,
+  0, 0, 737, 440, 416, 417, 787, 796, 117, 561, 888, 928, 0, 0, 23, 407,
+  973, 447, 613, 365, 984, 0, 637, 103, 0, 0, 0, 0, 0, 814, 0, 0,
+  555, 942, 877, 0, 121, 0, 0, 0, 481, 985, 0, 490, 659, 0, 300, 0,
+  0, 421, 805, 104, 501, 823, 882, 906, 588, 578, 0, 0, 130, 0, 312, 993,
+  0, 0, 0, 0, 0, 0, 510, 234, 931, 0, 542, 0, 0, 0, 0, 170,
+  550, 0, 91, 602, 0, 0, 929, 0, 35, 0, 551, 0, 47, 0, 238, 0,
+  350, 0, 295, 0, 0, 399, 0, 0, 449, 536, 0, 940, 0, 0, 0, 381,
+  0, 663, 921, 0, 0, 0, 0, 367, 0, 609, 0, 185, 749, 878, 25, 141,
+  94, 593, 0, 0, 0, 494, 689, 728, 132, 759, 0, 0, 0, 0, 186, 0,
+  77, 88, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 145, 675, 0,
+  422, 0, 0, 710, 0, 0, 0, 0, 0, 0, 0, 667, 65, 0, 562, 979,
+  599, 0, 0, 288, 802, 0, 0, 0, 0, 0, 392, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 724, 474, 0, 339, 0, 0, 0, 398, 225,
+  419, 426, 0, 395, 235, 362, 0, 355, 320, 498, 691, 856, 0, 53, 0, 0,
+  469, 872, 0, 0, 0, 0, 0, 0, 0, 0, 544, 0, 863, 0, 771, 0,
+  657, 0, 0, 0, 0, 0, 785, 955, 523, 80, 429, 598, 788, 192, 506, 815,
+  455, 746, 432, 879, 0, 0, 322, 954, 257, 772, 868, 444, 499, 597, 974, 0,
+  0, 0, 0, 0, 368, 0, 0, 0, 63, 255, 971, 0, 0, 87, 0, 572,
+  977, 0, 164, 0, 0, 0, 0, 209, 546, 0, 173, 303, 31, 0, 0, 219,
+  0, 0, 0, 125, 378, 0, 786, 296, 62, 629, 519, 938, 289, 793, 462, 129,
+  615, 935, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 767, 666, 0, 0,
+  0, 0, 0, 337, 380, 78, 827, 573, 606, 0, 502, 0, 93, 0, 627, 0,
+  925, 182, 226, 0, 0, 0, 0, 0, 0, 0, 0, 67, 508, 0, 0, 273,
+  614, 692, 777, 870, 686, 926, 0, 0, 223, 820, 0, 0, 0, 991, 0, 0,
+  0, 0, 0, 0, 32, 741, 0, 409, 0, 0, 0, 0, 0, 0, 678, 0,
+  0, 809, 0, 239, 722, 0, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 547, 0, 866, 0, 0, 505, 607, 711, 81, 0, 0, 0, 0, 0, 0,
+  382, 0, 134, 128, 0, 0, 0, 652, 690, 0, 733, 0, 654, 354, 951, 0,
+  0, 92, 418, 466, 799, 874, 0, 0, 0, 0, 756, 806, 740, 924, 875, 0,
+  0, 126, 543, 612, 107, 643, 0, 0, 0, 0, 0, 0, 155, 636, 391, 651,
+  0, 729, 410, 0, 0, 435, 0, 641, 705, 0, 201, 0, 0, 244, 0, 475,
+  0, 727, 0, 0, 0, 0, 0, 726, 37, 891, 0, 0, 90, 830, 0, 0,
+  956, 30, 596, 0, 0, 0, 0, 0, 360, 71, 535, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 478, 0, 0, 0, 157, 0, 0, 69, 19, 64, 476,
+  345, 369, 538, 564, 347, 415, 608, 694, 818, 950, 0, 441, 917, 0, 853, 420,
+  869, 0, 0, 0, 747, 758, 41, 860, 0, 404, 526, 0, 685, 0, 0, 390,
+  0, 0, 0, 0, 162, 0, 0, 0, 0, 871, 0, 0, 0, 0, 923, 825,
+  716, 165, 243, 388, 604, 0, 0, 0, 0, 0, 0, 210, 0, 0, 0, 0,
+  0, 835, 423, 843, 819, 0, 187, 0, 0, 0, 0, 26, 0, 618, 306, 0,
+  528, 0, 308, 496, 42, 944, 194, 359, 349, 353, 908, 0, 0, 0, 0, 927,
+  930, 232, 0, 115, 0, 0, 0, 0, 0, 965, 327, 112, 812, 0, 403, 0,
+  708, 425, 909, 0, 0, 438, 450, 0, 725, 0, 852, 0, 552, 0, 0, 699,
+  0, 321, 0, 0, 0, 0, 0, 0, 0, 776, 0, 9, 981, 0, 0, 0,
+  0, 0, 0, 517, 0, 0, 0, 0, 585, 0, 0, 0, 995, 0, 0, 883,
+  885, 0, 0, 0, 153, 160, 0, 0, 601, 0, 0, 0, 582, 634, 0, 0,
+  0, 0, 639, 680, 730, 109, 920, 460, 0, 0, 0, 0, 0, 0, 0, 0,
+  701, 261, 0, 0, 0, 0, 0, 854, 706, 342, 414, 0, 0, 323, 127, 116,
+};
+
+const char *WA_FREQ_4_TOKENS[] = {
+  "،",
+  "لا",
+  "من",
+  "في",
+  "أن",
+  "هذا",
+  "على",
+  "ما",
+  "أنا",
+  "هل",
+  "و",
+  "يا",
+  "ذلك",
+  "لقد",
+  "لم",
+  "ماذا",
+  "كان",
+  "هنا",
+  "إلى",
+  "أنت",
+  "هو",
+  "هذه",
+  "عن",
+  "نعم",
+  "ان",
+  "هناك",
+  "كل",
+  "حسناً",
+  "ليس",
+  "كنت",
+  "فقط",
+  "شيء",
+  "الآن",
+  "مع",
+  "الذي",
+  "لكن",
+  "أجل",
+  "لك",
+  "يجب",
+  "لن",
+  "كيف",
+  "حسنا",
+  "انا",
+  "لي",
+  "إنه",
+  "سوف",
+  "نحن",
+  "إذا",
+  "كانت",
+  "عندما",
+  "أي",
+  "قد",
+  "لماذا",
+  "هي",
+  "الأمر",
+  "أنه",
+  "فى",
+  "حتى",
+  "بعد",
+  "كذلك",
+  "أو",
+  "ولكن",
+  "قبل",
+  "التي",
+  "انه",
+  "إنها",
+  "ـ",
+  "لو",
+  "ربما",
+  "أين",
+  "هيا",
+  "تلك",
+  "أعرف",
+  "الى",
+  "إن",
+  "يكون",
+  "بعض",
+  "أريد",
+  "أعتقد",
+  "انت",
+  "عليك",
+  "مثل",
+  "صحيح",
+  "به",
+  "أنك",
+  "الوقت",
+  "بخير",
+  "أعلم",
+  "أحد",
+  "شخص",
+  "جداً",
+  "رجل",
+  "شكراً",
+  "لذا",
+  "يمكن",
+  "كما",
+  "كلا",
+  "أكثر",
+  "يبدو",
+  "جيد",
+  "تكون",
+  "علي",
+  "اليوم",
+  "يمكنك",
+  "انها",
+  "أليس",
+  "مرحباً",
+  "لدي",
+  "عليه",
+  "آخر",
+  "لست",
+  "منذ",
+  "غير",
+  "أيها",
+  "لديك",
+  "حقاً",
+  "أنتِ",
+  "تريد",
+  "أستطيع",
+  "الرجل",
+  "تعرف",
+  "له",
+  "مرة",
+  "لدينا",
+  "أنها",
+  "يمكنني",
+  "بأن",
+  "واحد",
+  "أنني",
+  "أوه",
+  "سيكون",
+  "الناس",
+  "ليست",
+  "حدث",
+  "بها",
+  "أيضاً",
+  "أفضل",
+  "الكثير",
+  "علينا",
+  "سيدي",
+  "مكان",
+  "تفعل",
+  "وقت",
+  "يكن",
+  "ط",
+  "شئ",
+  "بهذا",
+  "وأنا",
+  "اذا",
+  "جدا",
+  "بي",
+  "أخرى",
+  "آسف",
+  "بك",
+  "رائع",
+  "بذلك",
+  "كم",
+  "إذاً",
+  "ثم",
+  "شيئاً",
+  "يوجد",
+  "واحدة",
+  "ولا",
+  "قلت",
+  "يحدث",
+  "بالطبع",
+  "شكرا",
+  "مرحبا",
+  "يوم",
+  "أبي",
+  "معك",
+  "لها",
+  "معي",
+  "سيد",
+  "تعلم",
+  "إذن",
+  "العمل",
+  "تم",
+  "المكان",
+  "الليلة",
+  "إلهي",
+  "لهذا",
+  "فعل",
+  "هكذا",
+  "أمي",
+  "لذلك",
+  "ألا",
+  "لـ",
+  "الان",
+  "حول",
+  "بما",
+  "حقا",
+  "الحقيقة",
+  "الجميع",
+  "يمكننا",
+  "بالتأكيد",
+  "لأن",
+  "لديه",
+  "لنا",
+  "خلال",
+  "ظ",
+  "بشكل",
+  "العالم",
+  "فحسب",
+  "حال",
+  "الذهاب",
+  "عليها",
+  "بـ",
+  "أعني",
+  "فعلت",
+  "قال",
+  "هم",
+  "المنزل",
+  "عنه",
+  "ها",
+  "بشأن",
+  "أفعل",
+  "أكون",
+  "اللعنة",
+  "للغاية",
+  "فيه",
+  "بين",
+  "أننا",
+  "منك",
+  "وهذا",
+  "لكِ",
+  "جيدة",
+  "يعني",
+  "مجرد",
+  "أظن",
+  "انك",
+  "مني",
+  "أنّ",
+  "بالنسبة",
+  "الأمور",
+  "فكرة",
+  "أم",
+  "متى",
+  "الشيء",
+  "المال",
+  "كنا",
+  "أقول",
+  "عمل",
+  "أبداً",
+  "ستكون",
+  "عليّ",
+  "أيّ",
+  "أمر",
+  "تقول",
+  "توقف",
+  "هؤلاء",
+  "السيد",
+  "انظر",
+  "لما",
+  "منه",
+  "الطريق",
+  "أشعر",
+  "حصلت",
+  "الحياة",
+  "أني",
+  "نفس",
+  "معه",
+  "بحاجة",
+  "بسبب",
+  "الذين",
+  "تستطيع",
+  "بأس",
+  "اي",
+  "بدون",
+  "لكم",
+  "تبدو",
+  "أرى",
+  "الجحيم",
+  "تكن",
+  "اعتقد",
+  "عند",
+  "آسفة",
+  "حيث",
+  "دائماً",
+  "وأنت",
+  "تحت",
+  "حسنًا",
+  "تعال",
+  "بالفعل",
+  "بل",
+  "فضلك",
+  "الأشياء",
+  "ليلة",
+  "نفسك",
+  "لكي",
+  "تعتقد",
+  "وهو",
+  "بحق",
+  "مشكلة",
+  "شيئا",
+  "أرجوك",
+  "أذهب",
+  "يريد",
+  "تماماً",
+  "الـ",
+  "الوحيد",
+  "قتل",
+  "إنهم",
+  "الشخص",
+  "رأيت",
+  "عزيزتي",
+  "طوال",
+  "بهذه",
+  "الشرطة",
+  "الأن",
+  "أحب",
+  "الذى",
+  "أيضا",
+  "بنا",
+  "أردت",
+  "أكن",
+  "كلّ",
+  "النار",
+  "سمعت",
+  "اجل",
+  "جميع",
+  "أَنْ",
+  "قليلاً",
+  "مالذي",
+  "بأنه",
+  "والآن",
+  "إلي",
+  "انتظر",
+  "فتاة",
+  "كبير",
+  "يعرف",
+  "او",
+  "فيها",
+  "حسنٌ",
+  "الرجال",
+  "اريد",
+  "لأنه",
+  "السبب",
+  "سنوات",
+  "الباب",
+  "نذهب",
+  "دون",
+  "حياتي",
+  "لابد",
+  "السيارة",
+  "تريدين",
+  "خارج",
+  "ومن",
+  "ثلاثة",
+  "فعله",
+  "تذهب",
+  "كانوا",
+  "اذهب",
+  "الحصول",
+  "يقول",
+  "الواقع",
+  "كثيراً",
+  "اعرف",
+  "أنهم",
+  "سبب",
+  "كبيرة",
+  "مما",
+  "أحتاج",
+  "قمت",
+  "إنّه",
+  "منها",
+  "كنتُ",
+  "للتو",
+  "استطيع",
+  "نوع",
+  "هنالك",
+  "تعرفين",
+  "جميلة",
+  "بكل",
+  "دولار",
+  "بأنك",
+  "لأنني",
+  "الأفضل",
+  "دائما",
+  "جديد",
+  "الامر",
+  "اين",
+  "بالضبط",
+  "جون",
+  "دعنا",
+  "أنظر",
+  "المدينة",
+  "الخاص",
+  "تعلمين",
+  "جميل",
+  "بسرعة",
+  "الأرض",
+  "لحظة",
+  "الطريقة",
+  "طريقة",
+  "رائعة",
+  "سعيد",
+  "دقيقة",
+  "لكنه",
+  "غرفة",
+  "إليه",
+  "التحدث",
+  "ثانية",
+  "دعني",
+  "لكنني",
+  "الفتاة",
+  "لمَ",
+  "ولم",
+  "أنتم",
+  "عظيم",
+  "انهم",
+  "اوه",
+  "جيداً",
+  "لديّ",
+  "بينما",
+  "نفسي",
+  "إليك",
+  "قام",
+  "لديها",
+  "عام",
+  "اعلم",
+  "يعمل",
+  "سأكون",
+  "عيد",
+  "رفاق",
+  "ألم",
+  "لهم",
+  "تعمل",
+  "تتحدث",
+  "القيام",
+  "الله",
+  "ساعة",
+  "المرة",
+  "هيّا",
+  "ترى",
+  "مهلاً",
+  "جاك",
+  "أنتَ",
+  "الخير",
+  "متأكد",
+  "جميعاً",
+  "أحاول",
+  "شيئ",
+  "الموت",
+  "رقم",
+  "منهم",
+  "سيارة",
+  "مجدداً",
+  "ايها",
+  "عنك",
+  "يفعل",
+  "فقد",
+  "ذهبت",
+  "المزيد",
+  "أتمنى",
+  "مات",
+  "يتم",
+  "لكني",
+  "طريق",
+  "وجدت",
+  "وقد",
+  "أول",
+  "معها",
+  "سعيدة",
+  "لدى",
+  "أقصد",
+  "إلا",
+  "صباح",
+  "الرئيس",
+  "احد",
+  "فرصة",
+  "الأولى",
+  "تباً",
+  "يرام",
+  "عليكِ",
+  "يكفي",
+  "علاقة",
+  "صغيرة",
+  "الأقل",
+  "لأنك",
+  "غريب",
+  "لنذهب",
+  "المدرسة",
+  "ــ",
+  "الصباح",
+  "أفهم",
+  "حين",
+  "صديقي",
+  "سأذهب",
+  "أنكِ",
+  "تأتي",
+  "الخاصة",
+  "أخبرني",
+  "تقوم",
+  "نستطيع",
+  "نفسه",
+  "التى",
+  "الأطفال",
+  "حالة",
+  "لى",
+  "هى",
+  "يستطيع",
+  "يجري",
+  "سنة",
+  "نفعل",
+  "أتعلم",
+  "نهاية",
+  "أفكر",
+  "أود",
+  "عشر",
+  "شىء",
+  "أقوم",
+  "الحب",
+  "أنّه",
+  "كنتِ",
+  "معاً",
+  "أى",
+  "انني",
+  "لديهم",
+  "جديدة",
+  "يعلم",
+  "قالت",
+  "بدأت",
+  "الأول",
+  "دقائق",
+  "عني",
+  "سيدة",
+  "حالك",
+  "إنني",
+  "عزيزي",
+  "رجال",
+  "نعرف",
+  "الجنس",
+  "؛",
+  "رؤية",
+  "ينبغي",
+  "الي",
+  "حصل",
+  "معنا",
+  "الطفل",
+  "وليس",
+  "كي",
+  "تحتاج",
+  "قليلا",
+  "حياة",
+  "اسمع",
+  "الساعة",
+  "أكبر",
+  "اليس",
+  "فهمت",
+  "عنها",
+  "أريدك",
+  "رجاءً",
+  "تفعله",
+  "وماذا",
+  "ظننت",
+  "سيدتي",
+  "البعض",
+  "الصغير",
+  "تعني",
+  "إنّها",
+  "البيت",
+  "رأيك",
+  "تكوني",
+  "هُنا",
+  "والدك",
+  "مهما",
+  "العودة",
+  "تماما",
+  "لطيف",
+  "يقوم",
+  "السجن",
+  "الليل",
+  "السيدة",
+  "أخي",
+  "بأنني",
+  "طويلة",
+  "والدي",
+  "وهي",
+  "حان",
+  "أقل",
+  "الهاتف",
+  "عبر",
+  "مهلا",
+  "ترجمة",
+  "نحتاج",
+  "أيتها",
+  "وما",
+  "اكثر",
+  "أتحدث",
+  "أيام",
+  "أحدهم",
+  "أولاً",
+  "الماضي",
+  "أحبك",
+  "الطعام",
+  "البقاء",
+  "معرفة",
+  "العام",
+  "أية",
+  "ل",
+  "أصبح",
+  "ذات",
+  "الجديد",
+  "مِنْ",
+  "لكنك",
+  "أبدا",
+  "وضع",
+  "ً",
+  "سيئة",
+  "طفل",
+  "فوق",
+  "حياتك",
+  "داخل",
+  "وكان",
+  "نكون",
+  "خطأ",
+  "سام",
+  "ونحن",
+  "منزل",
+  "تشعر",
+  "عليهم",
+  "المفترض",
+  "نتحدث",
+  "طويل",
+  "نصف",
+  "فريق",
+  "أخذ",
+  "الماء",
+  "لاحقاً",
+  "حق",
+  "يأتي",
+  "صديق",
+  "غداً",
+  "سأفعل",
+  "منا",
+  "الصغيرة",
+  "نريد",
+  "وانا",
+  "للمنزل",
+  "ايضا",
+  "آه",
+  "خذ",
+  "جزء",
+  "لكنها",
+  "جو",
+  "أشياء",
+  "كلمة",
+  "تفعلين",
+  "أعمل",
+  "يمكنه",
+  "الآخر",
+  "تحاول",
+  "هَلْ",
+  "صغير",
+  "لستُ",
+  "بخصوص",
+  "أخبرك",
+  "الحال",
+  "بأي",
+  "نظرة",
+  "لأجل",
+  "الخروج",
+  "تظن",
+  "النوم",
+  "الماضية",
+  "دكتور",
+  "المرأة",
+  "انظري",
+  "بد",
+  "لمدة",
+  "وجود",
+  "الحرب",
+  "ذا",
+  "تقلق",
+  "بلا",
+  "عرفت",
+  "ثلاث",
+  "هلا",
+  "أدري",
+  "اللعين",
+  "ذهب",
+  "الا",
+  "المشكلة",
+  "الأسبوع",
+  "الوحيدة",
+  "كله",
+  "تعالي",
+  "مايكل",
+  "إنك",
+  "كلاّ",
+  "حاولت",
+  "أهلاً",
+  "دعونا",
+  "اخرى",
+  "أنّك",
+  "وشك",
+  "فعلاً",
+  "وسوف",
+  "عائلة",
+  "افعل",
+  "عدم",
+  "أخبرتك",
+  "كثيرا",
+  "سيدى",
+  "رئيس",
+  "فأنا",
+  "الغرفة",
+  "وحسب",
+  "المساعدة",
+  "الخارج",
+  "بعيداً",
+  "أعطني",
+  "اذن",
+  "سيء",
+  "العديد",
+  "أصبحت",
+  "الطبيب",
+  "رسالة",
+  "خمسة",
+  "كَانَ",
+  "يذهب",
+  "العشاء",
+  "الفتيات",
+  "النساء",
+  "ضد",
+  "تحصل",
+  "نقوم",
+  "جيدا",
+  "يهم",
+  "بهم",
+  "الموضوع",
+  "وفي",
+  "الممكن",
+  "اخر",
+  "الفتى",
+  "مباشرة",
+  "بالأمر",
+  "أتذكر",
+  "بيت",
+  "مايك",
+  "لأني",
+  "بطريقة",
+  "ساعات",
+  "حينما",
+  "فترة",
+  "الأشخاص",
+  "نيويورك",
+  "أراك",
+  "أنتي",
+  "شكرًا",
+  "اسم",
+  "قصة",
+  "توجد",
+  "القادمة",
+  "امرأة",
+  "فتى",
+  "أَنا",
+  "افضل",
+  "حقيقي",
+  "بواسطة",
+  "مجنون",
+  "زوجتي",
+  "أهذا",
+  "متأكدة",
+  "ذاهب",
+  "يحصل",
+  "تحب",
+  "أتعرف",
+  "النهاية",
+  "مكتب",
+  "ولن",
+  "مثلك",
+  "اننا",
+  "بالخارج",
+  "لهذه",
+  "الحق",
+  "بلى",
+  "أصدق",
+  "أخر",
+  "آمل",
+  "اه",
+  "أنْ",
+  "الإطلاق",
+  "فرانك",
+  "طلب",
+  "بدأ",
+  "لعبة",
+  "مرحبًا",
+  "جورج",
+  "قريباً",
+  "اني",
+  "مجموعة",
+  "أمام",
+  "الحديث",
+  "جي",
+  "مساعدتك",
+  "حاول",
+  "شخصاً",
+  "حقيقة",
+  "جميعا",
+  "اللقاء",
+  "وبعد",
+  "مدى",
+  "صورة",
+  "بأنها",
+  "سوى",
+  "التفكير",
+  "الملك",
+  "الأخيرة",
+  "الثانية",
+  "فهو",
+  "مِن",
+  "تحدث",
+  "فيما",
+  "الوضع",
+  "عدد",
+  "حفلة",
+  "ولكني",
+  "لسنا",
+  "تبقى",
+  "بشيء",
+  "مدينة",
+  "كهذا",
+  "كلها",
+  "انتهى",
+  "كُلّ",
+  "يحاول",
+  "نحو",
+  "أشهر",
+  "مثير",
+  "شركة",
+  "تفهم",
+  "اسف",
+  "الجديدة",
+  "لكل",
+  "أصدقاء",
+  "النوع",
+  "الجيد",
+  "اى",
+  "إليها",
+  "بأني",
+  "ميت",
+  "بيننا",
+  "الرب",
+  "عملية",
+  "ذو",
+  "بيتر",
+  "بعضنا",
+  "القضية",
+  "وكل",
+  "أحضر",
+  "قيد",
+  "تشارلي",
+  "أخرج",
+  "قادم",
+  "الواضح",
+  "دعيني",
+  "تفضل",
+  "توم",
+  "أتيت",
+  "أيضًا",
+  "أسمع",
+  "تأخذ",
+  "قول",
+  "العائلة",
+  "بنفسك",
+  "موعد",
+  "عندي",
+  "أثناء",
+  "ممكن",
+  "تخبرني",
+  "إذًا",
+  "الكبير",
+  "صاح",
+  "إنتظر",
+  "الزواج",
+  "فعلته",
+  "بكِ",
+  "ولكنه",
+  "حبيبتي",
+  "تذكر",
+  "أمك",
+  "مستحيل",
+  "اعتقدت",
+  "مليون",
+  "إليّ",
+  "علم",
+  "قل",
+  "طلبت",
+  "ربّما",
+  "ذاك",
+  "حسن",
+  "الأخرى",
+  "يحتاج",
+  "تعود",
+  "الهي",
+  "زلت",
+  "نسيت",
+  "وصلت",
+  "انتظري",
+  "نعلم",
+  "أنّي",
+  "النظر",
+  "إذهب",
+  "أتريد",
+  "عدة",
+  "سيحدث",
+  "ابن",
+  "لديكِ",
+  "الصعب",
+  "تقريباً",
+  "الحظ",
+  "ألف",
+  "مساعدة",
+  "تصبح",
+  "سأقوم",
+  "جين",
+  "جئت",
+  "خلف",
+  "خمس",
+  "د",
+  "الحقيقي",
+  "منكم",
+  "دي",
+  "يمكنكِ",
+  "أربعة",
+  "القليل",
+  "يزال",
+  "الدم",
+  "إننا",
+  "أسرع",
+  "البداية",
+  "سأعود",
+  "صعب",
+  "بعيدا",
+  "كن",
+  "عرض",
+  "بكثير",
+  "وعندما",
+  "اسمه",
+  "تفكر",
+  "آنسة",
+  "تعتقدين",
+  "فقدت",
+  "مهم",
+  "يتحدث",
+  "بتلك",
+  "لأي",
+  "بعدها",
+  "يريدون",
+  "يوماً",
+  "يعود",
+  "جاء",
+  "هُناك",
+  "أتعلمين",
+  "ترك",
+  "المناسب",
+  "السؤال",
+  "اكون",
+  "الآخرين",
+  "تقصد",
+  "اتصل",
+  "تبدين",
+  "للعمل",
+  "معهم",
+  "التالي",
+  "شرطة",
+  "قط",
+  "جريمة",
+  "أبحث",
+  "توقفي",
+  "بنفسي",
+  "الشمس",
+  "فكرت",
+  "يفترض",
+  "السماء",
+  "الوصول",
+  "الجانب",
+  "أحصل",
+  "عشرة",
+  "معا",
+  "الداخل",
+  "أعود",
+  "المعلومات",
+  "تحمل",
+  "حَسناً",
+  "أطفال",
+  "الثاني",
+  "جيّد",
+  "هذة",
+  "ببعض",
+  "يارجل",
+  "ماري",
+  "بكم",
+  "وداعاً",
+  "يعد",
+  "الأيام",
+  "أسوأ",
+  "مشاكل",
+};
+const uint16_t WA_FREQ_4_RANKS[] = {
+  210, 640, 49, 704, 89, 0, 0, 510, 108, 963, 0, 0, 669, 922, 0, 0,
+  71, 232, 0, 112, 0, 561, 0, 0, 0, 0, 0, 0, 0, 0, 855, 636,
+  0, 968, 0, 743, 686, 0, 0, 0, 157, 0, 0, 0, 0, 412, 0, 0,
+  85, 849, 0, 724, 889, 646, 0, 0, 2, 767, 938, 0, 0, 0, 0, 107,
+  0, 352, 0, 0, 0, 0, 0, 0, 142, 154, 0, 0, 547, 711, 17, 0,
+  0, 0, 158, 307, 0, 0, 0, 0, 741, 0, 233, 0, 0, 0, 363, 738,
+  754, 999, 0, 0, 150, 0, 0, 0, 0, 873, 0, 31, 915, 45, 532, 0,
+  699, 0, 0, 0, 0, 719, 0, 0, 0, 193, 0, 0, 0, 0, 597, 0,
+  551, 0, 0, 0, 0, 0, 0, 0, 0, 910, 763, 0, 756, 824, 933, 0,
+  230, 411, 0, 0, 106, 266, 509, 180, 959, 0, 0, 0, 786, 951, 438, 0,
+  500, 227, 667, 987, 0, 0, 0, 200, 0, 334, 862, 0, 0, 0, 446, 448,
+  576, 770, 0, 0, 0, 0, 0, 521, 835, 365, 114, 241, 0, 0, 852, 969,
+  41, 125, 818, 327, 110, 950, 0, 556, 712, 0, 764, 0, 0, 0, 0, 0,
+  531, 0, 100, 525, 0, 0, 0, 305, 602, 0, 0, 0, 429, 697, 908, 511,
+  0, 0, 0, 867, 0, 0, 0, 0, 884, 0, 0, 0, 923, 0, 474, 255,
+  0, 0, 650, 785, 749, 197, 0, 121, 856, 888, 286, 0, 0, 854, 833, 603,
+  422, 765, 143, 0, 311, 807, 0, 727, 0, 0, 405, 0, 0, 0, 166, 677,
+  744, 0, 235, 0, 0, 0, 0, 0, 972, 0, 0, 0, 375, 580, 0, 0,
+  16, 0, 533, 0, 3, 723, 395, 20, 793, 0, 0, 0, 0, 701, 95, 907,
+  0, 0, 116, 803, 0, 0, 0, 384, 842, 292, 277, 0, 526, 370, 459, 0,
+  0, 630, 0, 0, 0, 303, 812, 30, 0, 0, 0, 177, 254, 0, 0, 0,
+  192, 529, 276, 991, 0, 632, 912, 0, 0, 245, 0, 0, 758, 32, 899, 821,
+  0, 0, 0, 0, 325, 0, 84, 605, 13, 231, 283, 299, 981, 0, 0, 921,
+  0, 0, 0, 37, 0, 185, 594, 0, 0, 0, 0, 0, 19, 642, 0, 762,
+  903, 72, 0, 0, 496, 709, 778, 992, 971, 0, 0, 0, 0, 268, 0, 535,
+  126, 0, 253, 220, 976, 619, 447, 828, 0, 0, 0, 139, 0, 0, 629, 262,
+  676, 568, 476, 357, 419, 641, 189, 905, 939, 46, 82, 789, 996, 897, 0, 0,
+  986, 616, 651, 0, 0, 0, 717, 0, 0, 0, 0, 0, 289, 967, 0, 0,
+  0, 120, 0, 0, 18, 224, 0, 0, 678, 0, 0, 43, 875, 0, 0, 0,
+  225, 443, 612, 0, 0, 0, 0, 0, 12, 0, 0, 0, 0, 0, 0, 0,
+  0, 722, 152, 201, 455, 498, 635, 313, 783, 0, 310, 779, 0, 0, 929, 0,
+  0, 274, 60, 51, 199, 331, 674, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  97, 0, 336, 670, 0, 0, 0, 0, 5, 134, 935, 482, 0, 0, 0, 853,
+  0, 0, 151, 364, 407, 0, 223, 0, 0, 0, 736, 410, 0, 942, 98, 339,
+  0, 115, 21, 287, 188, 354, 358, 346, 609, 373, 178, 675, 918, 614, 494, 936,
+  970, 332, 243, 104, 0, 0, 0, 0, 781, 0, 0, 0, 0, 0, 0, 176,
+  960, 0, 0, 0, 0, 0, 105, 195, 0, 0, 0, 0, 141, 0, 0, 859,
+  553, 583, 0, 0, 394, 414, 0, 0, 0, 0, 633, 219, 0, 643, 0, 590,
+  0, 0, 0, 0, 0, 401, 0, 198, 549, 728, 902, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 57, 0, 0, 0, 472, 834, 983, 0, 0, 0,
+  0, 117, 541, 0, 0, 0, 456, 123, 353, 478, 78, 93, 440, 615, 945, 0,
+  768, 774, 0, 0, 0, 490, 0, 813, 0, 163, 691, 847, 851, 0, 815, 0,
+  0, 0, 0, 99, 0, 435, 0, 634, 55, 748, 138, 204, 0, 38, 0, 0,
+  0, 452, 0, 0, 0, 706, 0, 926, 388, 0, 259, 539, 780, 349, 0, 309,
+  0, 0, 0, 252, 80, 88, 715, 975, 0, 0, 0, 0, 0, 0, 811, 0,
+  0, 374, 0, 0, 0, 0, 0, 102, 182, 257, 491, 814, 0, 581, 434, 209,
+  187, 0, 0, 0, 0, 0, 207, 865, 0, 545, 887, 586, 0, 0, 0, 94,
+  8, 0, 0, 0, 0, 0, 0, 0, 555, 0, 0, 593, 92, 949, 350, 658,
+  215, 113, 312, 70, 564, 997, 654, 0, 0, 0, 0, 0, 0, 221, 810, 0,
+  0, 0, 0, 0, 54, 0, 961, 0, 0, 298, 372, 338, 665, 0, 0, 0,
+  0, 0, 153, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 206,
+  0, 147, 0, 0, 702, 0, 258, 0, 920, 0, 973, 0, 0, 524, 0, 0,
+  0, 0, 0, 317, 0, 0, 408, 433, 0, 0, 0, 0, 0, 538, 0, 0,
+  0, 940, 906, 0, 0, 0, 0, 436, 0, 391, 0, 0, 156, 284, 0, 0,
+  392, 989, 621, 574, 610, 952, 990, 726, 0, 0, 0, 653, 0, 0, 0, 328,
+  477, 348, 708, 345, 0, 659, 0, 0, 0, 0, 0, 0, 0, 0, 0, 162,
+  0, 249, 191, 841, 0, 0, 0, 0, 0, 707, 469, 948, 0, 985, 0, 0,
+  0, 0, 0, 566, 572, 271, 366, 587, 611, 757, 381, 460, 914, 0, 463, 958,
+  0, 0, 0, 696, 0, 124, 606, 0, 0, 0, 0, 0, 506, 0, 0, 0,
+  0, 944, 0, 0, 0, 86, 623, 0, 0, 0, 0, 0, 957, 0, 694, 655,
+  721, 792, 428, 0, 0, 860, 160, 0, 0, 627, 608, 251, 355, 0, 772, 404,
+  7, 0, 0, 0, 260, 1000, 769, 0, 760, 0, 0, 0, 11, 0, 0, 746,
+  0, 0, 787, 822, 0, 0, 0, 333, 0, 0, 0, 0, 246, 0, 0, 344,
+  0, 896, 0, 0, 0, 544, 0, 569, 663, 63, 445, 644, 689, 83, 322, 137,
+  0, 0, 265, 0, 467, 0, 745, 0, 0, 0, 911, 149, 0, 877, 279, 0,
+  0, 788, 0, 0, 0, 0, 170, 451, 214, 656, 306, 962, 683, 0, 523, 993,
+  0, 0, 449, 356, 0, 0, 0, 0, 582, 0, 0, 0, 869, 771, 0, 588,
+  127, 155, 377, 0, 0, 79, 0, 0, 0, 415, 0, 0, 0, 0, 536, 934,
+  522, 0, 0, 0, 0, 216, 0, 0, 0, 0, 881, 0, 0, 516, 917, 979,
+  234, 795, 0, 601, 0, 0, 0, 0, 0, 882, 323, 514, 0, 140, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 376, 457, 495, 681, 48, 871, 52,
+  596, 248, 690, 0, 0, 0, 0, 554, 0, 0, 0, 0, 0, 0, 0, 0,
+  387, 740, 0, 386, 618, 730, 0, 0, 47, 528, 562, 0, 664, 316, 729, 135,
+  0, 0, 0, 0, 68, 930, 0, 0, 36, 380, 565, 628, 863, 977, 280, 980,
+  0, 0, 103, 244, 383, 733, 129, 165, 0, 0, 0, 0, 0, 0, 527, 718,
+  74, 0, 0, 0, 0, 0, 0, 685, 687, 0, 0, 0, 652, 0, 183, 64,
+  484, 0, 205, 0, 0, 790, 0, 65, 558, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 693, 181, 710, 941, 0, 0, 0, 222, 273, 518, 44, 742, 0, 502,
+  0, 0, 540, 0, 505, 827, 830, 848, 622, 0, 497, 517, 802, 361, 432, 638,
+  825, 0, 0, 662, 0, 0, 0, 0, 0, 0, 330, 0, 0, 0, 750, 0,
+  427, 0, 96, 168, 267, 0, 119, 179, 761, 0, 0, 579, 0, 840, 542, 784,
+  982, 368, 0, 0, 0, 0, 0, 0, 567, 0, 0, 0, 843, 857, 0, 0,
+  0, 173, 398, 890, 0, 0, 0, 0, 0, 0, 885, 0, 0, 0, 0, 0,
+  0, 0, 1, 0, 0, 0, 0, 6, 144, 321, 773, 0, 0, 0, 731, 0,
+  0, 335, 0, 866, 0, 269, 0, 0, 247, 275, 994, 0, 0, 620, 0, 0,
+  465, 0, 236, 382, 799, 0, 868, 0, 575, 0, 955, 0, 0, 0, 998, 637,
+  0, 0, 0, 237, 0, 0, 931, 0, 0, 23, 0, 0, 278, 916, 371, 552,
+  954, 739, 639, 0, 0, 892, 0, 831, 943, 0, 880, 519, 584, 0, 0, 343,
+  0, 0, 0, 796, 229, 0, 0, 904, 714, 823, 133, 974, 613, 0, 399, 695,
+  300, 0, 486, 515, 660, 0, 0, 0, 808, 0, 186, 692, 791, 837, 385, 752,
+  470, 927, 481, 705, 439, 0, 0, 462, 0, 753, 805, 0, 0, 0, 342, 0,
+  0, 0, 600, 0, 0, 0, 146, 878, 10, 883, 0, 413, 389, 578, 585, 0,
+  530, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 285, 400, 928, 599, 713,
+  0, 559, 145, 0, 0, 76, 0, 426, 171, 288, 50, 466, 441, 546, 624, 0,
+  0, 838, 913, 0, 0, 26, 196, 563, 320, 461, 295, 560, 175, 925, 0, 504,
+  0, 592, 0, 909, 0, 0, 326, 81, 988, 0, 0, 832, 0, 136, 40, 256,
+  272, 0, 0, 132, 483, 0, 0, 0, 0, 0, 577, 806, 296, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 671, 417, 0, 0, 0, 0, 0, 956, 0, 0,
+  0, 293, 0, 0, 0, 0, 0, 0, 0, 101, 24, 0, 0, 0, 270, 0,
+  0, 0, 0, 0, 406, 0, 0, 161, 208, 28, 570, 34, 263, 861, 864, 0,
+  218, 409, 302, 0, 684, 487, 688, 0, 0, 0, 0, 0, 0, 304, 148, 329,
+  53, 397, 747, 420, 0, 130, 454, 946, 0, 0, 557, 965, 0, 0, 0, 0,
+  0, 870, 0, 290, 294, 0, 817, 128, 217, 534, 829, 0, 0, 0, 468, 25,
+  418, 0, 431, 720, 213, 499, 666, 0, 0, 0, 442, 0, 0, 0, 0, 0,
+  0, 0, 512, 755, 0, 379, 318, 0, 0, 0, 416, 673, 573, 0, 0, 703,
+  751, 67, 69, 513, 537, 66, 591, 801, 953, 984, 0, 0, 0, 0, 61, 819,
+  0, 250, 360, 734, 291, 423, 648, 362, 264, 846, 0, 0, 0, 0, 737, 820,
+  0, 661, 0, 39, 369, 607, 716, 122, 261, 169, 924, 0, 0, 340, 0, 0,
+  493, 14, 0, 0, 735, 0, 75, 0, 0, 0, 0, 0, 0, 172, 337, 0,
+  0, 966, 0, 238, 794, 315, 0, 0, 393, 872, 0, 782, 548, 0, 0, 190,
+  319, 184, 0, 0, 0, 0, 430, 314, 0, 626, 42, 203, 800, 0, 0, 378,
+  0, 0, 131, 341, 836, 22, 680, 0, 0, 347, 0, 437, 228, 798, 839, 672,
+  571, 964, 995, 0, 0, 0, 700, 0, 0, 87, 0, 56, 0, 0, 359, 0,
+  0, 0, 4, 0, 58, 0, 0, 0, 301, 649, 479, 471, 480, 489, 0, 759,
+  174, 816, 978, 475, 464, 0, 0, 0, 0, 167, 35, 858, 891, 647, 0, 0,
+  809, 0, 0, 351, 0, 453, 0, 0, 645, 0, 0, 0, 0, 0, 0, 0,
+  0, 507, 0, 0, 725, 240, 444, 485, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 424, 0, 0, 425, 0, 77, 0, 0, 895, 0, 0,
+  390, 0, 604, 0, 0, 0, 0, 0, 0, 226, 598, 0, 0, 886, 0, 0,
+  0, 0, 0, 396, 324, 876, 367, 900, 844, 0, 15, 62, 595, 631, 59, 845,
+  589, 932, 0, 281, 159, 668, 90, 458, 508, 698, 421, 501, 520, 874, 879, 0,
+  0, 0, 202, 797, 164, 550, 679, 0, 0, 0, 0, 0, 0, 0, 901, 0,
+  0, 0, 0, 0, 111, 947, 0, 0, 0, 0, 0, 0, 29, 492, 450, 617,
+  625, 0, 0, 0, 0, 0, 0, 473, 898, 0, 0, 0, 776, 0, 488, 212,
+  297, 118, 282, 402, 0, 27, 893, 0, 0, 0, 0, 0, 0, 0, 0, 657,
+  0, 0, 503, 0, 919, 682, 403, 0, 0, 109, 543, 0, 73, 9, 0, 33,
+  826, 242, 766, 0, 775, 0, 804, 0, 937, 732, 0, 0, 0, 0, 194, 0,
+  0, 0, 0, 0, 239, 0, 91, 211, 0, 0, 777, 0, 0, 850, 308, 894,
+};
+
+const char *WA_FREQ_5_TOKENS[] = {
+  "ñi",
+  "mew",
+  "iñche",
+  "iael",
+  "feymew",
+  "kiñe",
+  "xokipeymi",
+  "ta",
+  "iñce",
+  "rvf",
+  "kvpa",
+  "putuafiel",
+  "kam",
+  "iney",
+  "pieymu",
+  "üy",
+  "küpange",
+  "liwen",
+  "wüle",
+  "fey",
+  "mülewe",
+  "trufür",
+  "takulefuy",
+  "ayüken",
+  "yafütual",
+  "füre",
+  "komke",
+  "narantü",
+  "ürkülen",
+  "müley",
+  "doy",
+  "umawtual",
+  "kimfiñ",
+  "chillkatufekalu",
+  "trafkintumum",
+  "ngelay",
+  "petu",
+  "ilan",
+  "weda",
+  "koneko",
+  "ngefuy",
+  "katrüyiñ",
+  "puke",
+  "aliwen",
+  "toki",
+};
+const uint16_t WA_FREQ_5_RANKS[] = {
+  0, 43, 0, 39, 0, 0, 0, 25, 22, 0, 33, 36, 0, 0, 0, 0,
+  24, 0, 0, 0, 15, 0, 0, 0, 0, 5, 0, 0, 0, 26, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 28, 0, 2, 0, 0, 0, 11, 16, 31,
+  6, 1, 7, 35, 0, 0, 0, 9, 3, 0, 0, 0, 0, 0, 0, 10,
+  0, 0, 0, 41, 42, 32, 0, 0, 0, 0, 0, 0, 45, 0, 27, 0,
+  0, 23, 0, 37, 0, 0, 38, 18, 19, 21, 0, 0, 0, 0, 12, 34,
+  0, 14, 8, 20, 0, 40, 0, 0, 13, 0, 29, 0, 0, 17, 0, 44,
+  0, 0, 0, 0, 30, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0,
+};
+
+const char *WA_FREQ_6_TOKENS[] = {
+  "আৰু",
+  "এই",
+  "হয়।",
+  "কৰা",
+  "কৰে।",
+  "পৰা",
+  "তেওঁ",
+  "চনত",
+  "কৰি",
+  "বাবে",
+  "চনৰ",
+  "ইয়াৰ",
+  "হয়",
+  "এটা",
+  "এক",
+  "হৈ",
+  "তেওঁৰ",
+  "বা",
+  "কৰিছিল।",
+  "আছিল",
+  "কৰে",
+  "হৈছিল।",
+  "আছিল।",
+  "বুলি",
+  "হৈছে",
+  "হিচাপে",
+  "প্ৰথম",
+  "লাভ",
+  "সেই",
+  "থকা",
+  "হোৱা",
+  "যে",
+  "বিভিন্ন",
+  "লগত",
+  "এখন",
+  "যায়।",
+  "অসমীয়া",
+  "কৰাৰ",
+  "কোনো",
+  "নাম",
+  "কৰিবলৈ",
+  "আছে।",
+  "অসমৰ",
+  "কিন্তু",
+  "হৈছে।",
+  "দিয়া",
+  "পিছত",
+  "আৰম্ভ",
+  "কৰিব",
+  "নামৰ",
+  "প্ৰায়",
+  "তাৰ",
+  "সময়ত",
+  "ব্যৱহাৰ",
+  "ভাৰতৰ",
+  "এজন",
+  "তেখেতৰ",
+  "ভাৰতীয়",
+  "অসম",
+  "আন",
+  "ই",
+  "পাছত",
+  "পোৱা",
+  "মাজত",
+  "আদি",
+  "প্ৰকাশ",
+  "লৈ",
+  "তেখেতে",
+  "নিজৰ",
+  "হৈছিল",
+  "কৰিছিল",
+  "ওপৰত",
+  "সৈতে",
+  "ৰ",
+  "ভিতৰত",
+  "দেখা",
+  "লগতে",
+  "যদিও",
+  "জন্ম",
+  "ইয়াক",
+  "কথা",
+  "কাম",
+  "দিয়ে।",
+  "দ্বাৰা",
+  "বছৰ",
+  "সকলো",
+  "ইয়াত",
+  "কৰিছে।",
+  "তেওঁক",
+  "গ্ৰহণ",
+  "হোৱাৰ",
+  "যায়",
+  "চলচ্চিত্ৰ",
+  "জিলাৰ",
+  "মতে",
+  "নিৰ্মাণ",
+  "হ’ল",
+  "প্ৰদান",
+  "শিক্ষা",
+  "নতুন",
+  "আছে",
+  "বঁটা",
+  "তেওঁলোকৰ",
+  "বৰ্তমান",
+  "উত্তৰ",
+  "of",
+  "সাহিত্য",
+  "দি",
+  "প্ৰতি",
+  "ছবি",
+  "যি",
+  "সৃষ্টি",
+  "বিশেষ",
+  "কোৱা",
+  "তথা",
+  "মূল",
+  "থাকে।",
+  "এগৰাকী",
+  "লগে",
+  "দ্বিতীয়",
+  "অভিনয়",
+  "দৰে",
+  "প্ৰধান",
+  "পাৰে।",
+  "ইংৰাজী",
+  "কিছুমান",
+  "দুটা",
+  "এনে",
+  "স্থান",
+  "কিছু",
+  "দ্য",
+  "ক্ষেত্ৰত",
+  "ৰচনা",
+  "সৰু",
+  "মৃত্যু",
+  "ধৰি",
+  "ফলত",
+  "লয়।",
+  "স্থাপন",
+  "সাধাৰণতে",
+  "ৰাষ্ট্ৰীয়",
+  "ভাৰত",
+  "উপৰিও",
+  "জাতীয়",
+  "পৰে।",
+  "বেছি",
+  "অনুসৰি",
+  "গঠন",
+  "পৰাই",
+  "অৱশ্যে",
+  "পায়।",
+  "অংশ",
+  "তাৰিখে",
+  "সংখ্যা",
+  "হ'ল",
+  "অধিক",
+  "নাছিল।",
+  "আহি",
+  "অতি",
+  "বহু",
+  "এটি",
+  "নামেৰে",
+  "মুঠ",
+  "and",
+  "আহোম",
+  "ৰাজ্যৰ",
+  "মানুহৰ",
+  "ৰজা",
+  "জীৱনৰ",
+  "জনা",
+  "অৱস্থিত।",
+  "লোৱা",
+  "কাৰণে",
+  "তেওঁলোকে",
+  "শেষ",
+  "কাৰণ",
+  "সংগীত",
+  "মাহত",
+  "অনুষ্ঠিত",
+  "বিষয়ে",
+  "উল্লেখ",
+  "বহুতো",
+  "দেশৰ",
+  "জন",
+  "সকলৰ",
+  "খন",
+  "মুক্তি",
+  "অন্যান্য",
+  "বোলা",
+  "সাধাৰণ",
+  "উচ্চ",
+  "ভাৱে",
+  "ভাষাৰ",
+  "১",
+  "পুনৰ",
+  "যেনে",
+  "জীৱন",
+  "যাৰ",
+  "দক্ষিণ",
+  "ভাষা",
+  "আই",
+  "হিচাবে",
+  "প্ৰতিষ্ঠা",
+  "গৈ",
+  "ত",
+  "দিয়ে",
+  "কম",
+  "ভাল",
+  "সময়ৰ",
+  "অৱস্থিত",
+  "দুই",
+  "সময়",
+  "পৰিচালনা",
+  "বৰুৱা",
+  "ভাষাত",
+  "কয়",
+  "গুৱাহাটী",
+  "হিন্দু",
+  "সক্ষম",
+  "জনপ্ৰিয়",
+  "ডাঙৰ",
+  "যোৰহাট",
+  "গীত",
+  "পালন",
+  "প্ৰকাশিত",
+  "বিজ্ঞান",
+  "তেতিয়া",
+  "টা",
+  "সেয়ে",
+  "চৰকাৰে",
+  "পাৰি।",
+  "অঞ্চলত",
+  "ভাগ",
+  "সমগ্ৰ",
+  "নহয়।",
+  "নিৰ্বাচিত",
+  "পায়",
+  "ৰাজ্য",
+  "অসমত",
+  "আহিছে।",
+  "লোক",
+  "ৰখা",
+  "জড়িত",
+  "শ্ৰেষ্ঠ",
+  "লগ",
+  "থাকে",
+  "গ্ৰন্থ",
+  "এ",
+  "পশ্চিম",
+  "ঠাইত",
+  "দিছিল।",
+  "উল্লেখযোগ্য",
+  "তেখেত",
+  "আধুনিক",
+  "ডিগ্ৰী",
+  "হ'ব",
+  "২০১২",
+  "অন্যতম",
+  "পৃথিৱীৰ",
+  "বিশ্ববিদ্যালয়ৰ",
+  "অন্য",
+  "সহায়",
+  "জিলা",
+  "পাৰে",
+  "সমূহ",
+  "হাতত",
+  "আহে।",
+  "কৰিছে",
+  "মৃত্যুৰ",
+  "ৰূপ",
+  "ধৰণৰ",
+  "সম্পূৰ্ণ",
+  "ঘোষণা",
+  "যোৱা",
+  "২০১১",
+  "আটাইতকৈ",
+  "কেৱল",
+  "ছবিৰ",
+  "সকলে",
+  "অফ",
+  "এণ্ড",
+  "ব্ৰিটিছ",
+  "দলৰ",
+  "মুখ্য",
+  "৫",
+  "২",
+  "আনহাতে",
+  "একে",
+  "বাংলা",
+  "প্ৰথমে",
+  "নদীৰ",
+  "অৰ্থ",
+  "ছবিখনৰ",
+  "সময়তে",
+  "ৰূপে",
+  "আদিৰ",
+  "লাগে।",
+  "নাই।",
+  "দখল",
+  "ৰাজনৈতিক",
+  "ব্যৱস্থা",
+  "নহয়",
+  "যোগ",
+  "অঞ্চলৰ",
+  "চৰকাৰী",
+  "বিশ্বাস",
+  "চৰকাৰৰ",
+  "চিকিৎসা",
+  "সলনি",
+  "বছৰৰ",
+  "বিশ্বৰ",
+  "সদস্য",
+  "আক্ৰমণ",
+  "তৈয়াৰ",
+  "ধৰা",
+  "পুত্ৰ",
+  "তাত",
+  "অহা",
+  "গুৱাহাটীৰ",
+  "তথ্য",
+  "কৰাত",
+  "দিবলৈ",
+  "কৰিলে।",
+  "সমূহৰ",
+  "ৰাজধানী",
+  "তিনি",
+  "হেৰী",
+  "অৱ",
+  "বেলেগ",
+  "The",
+  "অৰ্থাৎ",
+  "তিনিটা",
+  "দিয়াৰ",
+  "পানী",
+  "পৰিচালক",
+  "মান",
+  "সভাৰ",
+  "আকৌ",
+  "বি",
+  "কৰিলে",
+  "মাত্ৰ",
+  "নিৰ্মিত",
+  "মুকলি",
+  "কবিতা",
+  "বিশ্ব",
+  "লিখা",
+  "হ'ল।",
+  "কাহিনী",
+  "দেশ",
+  "প্ৰস্তুত",
+  "বৰ্তমানৰ",
+  "জৰিয়তে",
+  "বিখ্যাত",
+  "অধিকাৰ",
+  "চন্দ্ৰ",
+  "৪",
+  "সম্পাদক",
+  "পিছলৈ",
+  "বিহু",
+  "শতিকাৰ",
+  "অঞ্চল",
+  "কবি",
+  "তৃতীয়",
+  "গুৰুত্বপূৰ্ণ",
+  "পুৰণি",
+  "সাংস্কৃতিক",
+  "ড°",
+  "ভাৰতত",
+  "৬",
+  "কুমাৰ",
+  "ধৰ্ম",
+  "পৰীক্ষাত",
+  "যথেষ্ট",
+  "যিকোনো",
+  "আন্দোলনৰ",
+  "কালত",
+  "গৈছে।",
+  "চেষ্টা",
+  "পূব",
+  "এবিধ",
+  "পিতৃ",
+  "যোগদান",
+  "চলি",
+  "যেতিয়া",
+  "বিয়া",
+  "সন্মান",
+  "বৰুৱাৰ",
+  "সামাজিক",
+  "২০১০",
+  "অৱস্থাত",
+  "অনেক",
+  "আগতে",
+  "ইয়াৰে",
+  "ছবিখন",
+  "দিনা",
+  "অধীনত",
+  "কেন্দ্ৰ",
+  "শক্তি",
+  "প্ৰচলিত",
+  "প্ৰভাৱ",
+  "বিৰুদ্ধে",
+  "একমাত্ৰ",
+  "মানসিক",
+  "প্ৰাচীন",
+  "১০",
+  "ৰচিত",
+  "নামে",
+  "যুদ্ধৰ",
+  "সিদ্ধান্ত",
+  "স্থানীয়",
+  "১৫",
+  "ৰেল",
+  "উপন্যাস",
+  "তাক",
+  "চলচ্চিত্ৰৰ",
+  "in",
+  "আমেৰিকা",
+  "বৰ",
+  "শ্ৰী",
+  "বিবাহ",
+  "অলিম্পিক",
+  "কি",
+  "প্ৰাথমিক",
+  "অধ্যয়ন",
+  "যুদ্ধ",
+  "লক্ষ্য",
+  "স্বাধীনতা",
+  "গৈছিল।",
+  "মাহৰ",
+  "২০",
+  "৩",
+  "ৰূপত",
+  "ৰোগ",
+  "টকা",
+  "আহে",
+  "পৰে",
+  "দায়িত্ব",
+  "বয়সত",
+  "লয়",
+  "সভাপতি",
+  "থকাৰ",
+  "নিজ",
+  "দল",
+  "পাৰ",
+  "পি",
+  "প্ৰয়োগ",
+  "বৃদ্ধি",
+  "স্নাতক",
+  "ৰোগৰ",
+  "আইন",
+  "দুখন",
+  "কামত",
+  "মহিলা",
+  "চাহ",
+  "এৰি",
+  "ও",
+  "গান",
+  "পৰিয়ালৰ",
+  "১২",
+  "সুবিধা",
+  "অথবা",
+  "আয়োজন",
+  "ক্ৰমে",
+  "গৱেষণা",
+  "চহৰৰ",
+  "ভিতৰতে",
+  "নাছিল",
+  "ফুটবল",
+  "বিচাৰি",
+  "ক্ষমতা",
+  "নাটক",
+  "মাধ্যমিক",
+  "ওচৰত",
+  "দিন",
+  "পাৰি",
+  "বিজ্ঞানৰ",
+  "বিদ্যালয়",
+  "শব্দৰ",
+  "ডি",
+  "দিব",
+  "মই",
+  "সহায়ত",
+  "ধৰ্মৰ",
+  "বৰ্ণনা",
+  "সংস্কৃত",
+  "ব্যক্তি",
+  "কিঃমিঃ",
+  "কেইবাটাও",
+  "কেন্দ্ৰীয়",
+  "তলত",
+  "লৈছিল।",
+  "নাই",
+  "বিষয়ত",
+  "হ’ব",
+  "৩০",
+  "ঠাই",
+  "পূজা",
+  "বৃহৎ",
+  "ব্যৱহৃত",
+  "ভাগত",
+  "শিশু",
+  "সাহিত্যৰ",
+  "২০১৩",
+  "গঢ়ি",
+  "চি",
+  "নদী",
+  "বিভাগৰ",
+  "মানুহ",
+  "৮",
+  "পথ",
+  "বন্ধ",
+  "বুলিও",
+  "এম",
+  "ভাবে",
+  "যদি",
+  "অৰ্জন",
+  "আমাৰ",
+  "কেতিয়াবা",
+  "ঘৰ",
+  "তেখেতক",
+  "ধৰ্মীয়",
+  "সম্পৰ্কে",
+  "৭",
+  "ছাত্ৰ",
+  "দিশত",
+  "নগৰৰ",
+  "প্ৰয়োজন",
+  "হত্যা",
+  "হিন্দী",
+  "২০০৮",
+  "পাই",
+  "লগা",
+  "১৮",
+  "ৰজাৰ",
+  "গুৰুত্ব",
+  "বাস",
+  "শব্দ",
+  "ঘৰৰ",
+  "পটাৰ",
+  "পৰ্যন্ত",
+  "বৰুৱাই",
+  "মাৰ্চ",
+  "১৬",
+  "পৰৱৰ্তী",
+  "শিক্ষাৰ",
+  "নিৰ্দিষ্ট",
+  "মন্দিৰ",
+  "মাজেৰে",
+  "ফালে",
+  "বিশেষকৈ",
+  "শ্ৰেণীৰ",
+  "সি",
+  "ঘৰত",
+  "ধাৰণা",
+  "নিৰ্বাচন",
+  "১৪",
+  "২০০৯",
+  "২৫",
+  "the",
+  "লাহে",
+  "লোকৰ",
+  "শেষত",
+  "সফল",
+  "হোৱাত",
+  "কংগ্ৰেছ",
+  "গণ্য",
+  "ঘটে।",
+  "চনলৈ",
+  "নৃত্য",
+  "প্ৰতিটো",
+  "উত্তীৰ্ণ",
+  "এপ্ৰিল",
+  "পাইছিল।",
+  "পৰীক্ষা",
+  "বিক্ৰী",
+  "ভূমিকা",
+  "মাজৰ",
+  "মাতৃ",
+  "যুদ্ধত",
+  "অৰ্থনৈতিক",
+  "কামৰূপ",
+  "নিজে",
+  "২০০৬",
+  "৯",
+  "এইখন",
+  "ধৰে।",
+  "কংগ্ৰেছৰ",
+  "গাঁৱৰ",
+  "গৰাকী",
+  "শিল্পী",
+  "সন্তান",
+  "২০০৫",
+  "আলোচনা",
+  "কলেজৰ",
+  "খাদ্য",
+  "গতিকে",
+  "প্ৰচলন",
+  "মানুহে",
+  "সংখ্যক",
+  "সমাজ",
+  "২০০১",
+  "আমেৰিকাৰ",
+  "একেলগে",
+  "গঠিত",
+  "পিতৃৰ",
+  "প্ৰাকৃতিক",
+  "পৰিচালিত",
+  "ৰক্ষা",
+  "যাক",
+  "ইণ্ডিয়া",
+  "গতি",
+  "বিষয়",
+  "ব্যক্তিগত",
+  "১১",
+  "চৰিত্ৰ",
+  "ডিচেম্বৰ",
+  "দীঘল",
+  "প্ৰকৃত",
+  "মিটাৰ",
+  "২৬",
+  "ঘূৰি",
+  "বৰ্গ",
+  "মে",
+  "শিক্ষক",
+  "সংযোগ",
+  "সেৱা",
+  "p.",
+  "উৎসৱ",
+  "দেখি",
+  "মন",
+  "মহাবিদ্যালয়",
+  "শাসন",
+  "সৰ্বাধিক",
+  "খেলুৱৈ",
+  "জ্ঞান",
+  "পাছলৈ",
+  "য’ত",
+  "আগবঢ়োৱা",
+  "কি:মি",
+  "তাই",
+  "মানি",
+  "সাহিত্যিক",
+  "অনুষ্ঠান",
+  "কলা",
+  "ত্যাগ",
+  "প্ৰদেশৰ",
+  "ৰাখি",
+  "গীতৰ",
+  "পদত",
+  "মানৱ",
+  "শিৱসাগৰ",
+  "সংস্কৃতিৰ",
+  "অক্টোবৰ",
+  "জয়",
+  "বিদ্যালয়ৰ",
+  "তাৰোপৰি",
+  "য'ত",
+  "উৎপাদন",
+  "মোৰ",
+  "একক",
+  "গান্ধীৰ",
+  "জিলাত",
+  "বাতৰি",
+  "উপাধি",
+  "কম্পিউটাৰ",
+  "থাকি",
+  "পৰিচিত",
+  "বিদ্যালয়ত",
+  "বিশিষ্ট",
+  "২০০৭",
+  "ৰজাই",
+  "খেল",
+  "দিনত",
+  "প্ৰচাৰ",
+  "মাটিৰ",
+  "যাতে",
+  "স্বীকৃতি",
+  "বৈ",
+  "ভৰ্তি",
+  "সঙ্গীত",
+  "সমাজৰ",
+  "অন্তৰ্ভুক্ত",
+  "জুলাই",
+  "নিয়ম",
+  "প্ৰদৰ্শন",
+  "লাগে",
+  "হ’ল।",
+  "আমি",
+  "আমেৰিকান",
+  "জানুৱাৰী",
+  "জাৰ্মান",
+  "শিৱ",
+  "২০০৪",
+  "গঢ়",
+  "নগৰ",
+  "প্ৰৱেশ",
+  "মূলতঃ",
+  "থাকিব",
+  "দা",
+  "বিজয়ী",
+  "হাৰ",
+  "আৰ",
+  "কাল",
+  "ছবিত",
+  "জনাজাত",
+  "দৈনিক",
+  "নিৰ্মান",
+  "পদাৰ্থ",
+  "যোৱাৰ",
+  "অন্তৰ্গত",
+  "উপস্থিত",
+  "মিলিয়ন",
+  "অৱশেষত",
+  "আগত",
+  "উভতি",
+  "এটাৰ",
+  "কিতাপ",
+  "গান্ধীয়ে",
+  "বৈজ্ঞানিক",
+  "স্থানত",
+  "স্নাতকোত্তৰ",
+  "আন্তৰ্জাতিক",
+  "এতিয়াও",
+  "জনসংখ্যা",
+  "তেওঁলোক",
+  "নৈ",
+  "পদ্ধতি",
+  "অংশগ্ৰহণ",
+  "বাকী",
+  "ভ্ৰমণ",
+  "অনুবাদ",
+  "আগষ্টত",
+  "আন্দোলন",
+  "গোটেই",
+  "দশকত",
+  "দুয়ো",
+  "পুথি",
+  "পৰি",
+  "সভা",
+  "পত্নী",
+  "অভিনেতা",
+  "আখ্যা",
+  "তুলি",
+  "থৈ",
+  "পূৰ্ণ",
+  "বাবেই",
+  "মাটি",
+  "লিখি",
+  "সম্পৰ্ক",
+  "মহাবিদ্যালয়ৰ",
+  "যিয়ে",
+  "সেয়া",
+  "২৪",
+  "ৰাষ্ট্ৰপতি",
+  "ইষ্ট",
+  "গড়",
+  "দাবী",
+  "নিজকে",
+  "লাগি",
+  "উঠে।",
+  "এন",
+  "কটন",
+  "বিভাগত",
+  "লোকে",
+  "শতিকাত",
+  "১৩",
+  "২০০০",
+  "ঐতিহাসিক",
+  "গল্প",
+  "তেনে",
+  "নেতৃত্বত",
+  "পতাকা",
+  "প্ৰস্তাৱ",
+  "বস্তু",
+  "শেষৰ",
+  "সংৰক্ষিত",
+  "সামৰিক",
+  "কৰিবৰ",
+  "টি",
+  "ডিব্ৰুগড়",
+  "পাকিস্তানৰ",
+  "প্ৰশিক্ষণ",
+  "পৰিচয়",
+  "সম্পন্ন",
+  "অভিনয়ৰ",
+  "অলিম্পিকৰ",
+  "আগষ্ট",
+  "আনি",
+  "চাৰি",
+  "জগতত",
+  "তালিকাত",
+  "দাস",
+  "নং",
+  "নিৰ্মাণৰ",
+  "প্ৰতিষ্ঠান",
+  "প্ৰথমতে",
+  "মহাত্মা",
+  "অভিহিত",
+  "ইতিমধ্যে",
+  "চাৰিটা",
+  "দলে",
+  "নিউ",
+  "বিহুৰ",
+  "যিটো",
+  "যোৰহাটৰ",
+  "লেখক",
+  "শিৱৰ",
+  "সত্ৰ",
+  "১৯",
+  "New",
+  "ক",
+  "পূৰ্বৰ",
+  "পোৱাৰ",
+  "পৰিগণিত",
+  "বাৰ্ষিক",
+  "মন্ত্ৰী",
+  "শক্তিৰ",
+  "অৱস্থা",
+  "আগৰ",
+  "নানা",
+  "পিছৰ",
+  "বিকাশ",
+  "সমাজত",
+  "হাত",
+  "দেখিবলৈ",
+  "দেৱী",
+  "নিৰ্বাচনত",
+  "পৰাস্ত",
+  "সংগীতৰ",
+  "ৰাইজৰ",
+  "অলপ",
+  "এবাৰ",
+  "ওলাই",
+  "কন্যা",
+  "পদক",
+  "গ্ৰন্থৰ",
+  "চনলৈকে",
+  "তদুপৰি",
+  "ব্ৰহ্মপুত্ৰ",
+  "সিংহৰ",
+  "সৰ্বোচ্চ",
+  "A",
+  "উদ্দেশ্য",
+  "চন",
+  "চৰিত্ৰত",
+  "দিছিল",
+  "পাঁচ",
+  "পুৰস্কাৰ",
+  "প্ৰথমবাৰৰ",
+  "ফুট",
+  "বিমান",
+  "শক্তিশালী",
+  "১৭",
+  "২১",
+  "কালৰ",
+  "জানুৱাৰীত",
+  "তাইৰ",
+  "দৰ্শন",
+  "যোগেদি",
+  "সম্পাদনা",
+  "অনুষ্ঠানত",
+  "এদিন",
+  "গুৰু",
+  "প্ৰমাণ",
+  "যুগৰ",
+  "লোৱাৰ",
+  "হিছাপে",
+  "অংশত",
+  "ডিচেম্বৰত",
+  "বাহিৰেও",
+  "বোলে।",
+  "মোহন",
+  "শৰ্মা",
+  "সামগ্ৰী",
+  "আলোচনী",
+  "ইংৰাজ",
+  "পাছৰ",
+  "বিপৰীতে",
+  "বিষয়া",
+  "কলেজত",
+  "চতুৰ্থ",
+  "চুক্তি",
+  "বাধ্য",
+  "বাহিৰে",
+  "মুক্ত",
+  "শব্দটো",
+  "অনুযায়ী",
+  "উৎপত্তি",
+  "এল",
+  "কলিকতাৰ",
+  "কিছুদিন",
+  "চহৰ",
+  "জগতৰ",
+  "দেখুওৱা",
+  "নিযুক্ত",
+  "বিশ্ববিদ্যালয়",
+  "ব্যক্তিৰ",
+  "মুম্বাই",
+  "সম্প্ৰদায়ৰ",
+  "সমৰ্থন",
+  "হে",
+  "অনুভৱ",
+  "আন্তঃৰাষ্ট্ৰীয়",
+  "গ্ৰহন",
+  "চিত্ৰ",
+  "দেশত",
+  "পৰিকল্পনা",
+  "বছৰীয়া",
+  "বাংলাদেশৰ",
+  "ভিত্তি",
+  "শীৰ্ষক",
+  "১৯৪৭",
+  "জনগোষ্ঠীৰ",
+  "বৃহত্তম",
+  "মধ্য",
+  "মাৰ্চত",
+  "সংগ্ৰহ",
+  "সম্পৰ্কীয়",
+  "২২",
+  "অনা",
+  "কেইবাখনো",
+  "জুন",
+  "ঠাইৰ",
+  "দৈৰ্ঘ্য",
+  "পদ",
+  "পাতি",
+  "বৌদ্ধ",
+  "ভিন্ন",
+  "স্বাধীন",
+  "আহৰণ",
+  "কলেজ",
+  "কৃষি",
+  "গোৱা",
+  "ছোৱালী",
+  "তেজপুৰ",
+  "দিনৰ",
+  "প্ৰথমখন",
+  "পৰিছিল।",
+  "বিশ্বযুদ্ধৰ",
+  "বৰপেটা",
+  "মহাবিদ্যালয়ত",
+  "যাব",
+  "যেন",
+  "সকলোতকৈ",
+  "২০০২",
+  "২০০৩",
+  "উঠি",
+  "একোটা",
+  "চৰকাৰ",
+  "বিভক্ত",
+  "বিষয়ৰ",
+  "বোলছবি",
+  "মাতৃৰ",
+  "যোগান",
+  "স্কুল",
+  "আহিছিল।",
+  "এতিয়া",
+  "গছৰ",
+  "গুৱাহাটীত",
+  "ঘৰলৈ",
+  "ঠিক",
+  "পৰিৱেশ",
+  "সেয়েহে",
+  "ইতিহাস",
+  "ইত্যাদি",
+  "চনৰপৰা",
+  "জনপ্ৰিয়তা",
+  "তেতিয়াৰ",
+  "নেতা",
+  "পুৰুষ",
+  "পৃথক",
+  "বসবাস",
+  "সকল",
+  "ৰাম",
+  "অৱদান",
+  "এনেদৰে",
+  "গণেশ",
+  "গাঁৱত",
+  "থাকিবলৈ",
+  "দূৰত্ব",
+  "নাট",
+  "বাঁহৰ",
+  "বৈষ্ণৱ",
+  "মাজে",
+  "১৯৪৮",
+  "অধ্যাপক",
+  "আদিত",
+  "আধাৰত",
+  "কলকাতা",
+  "কাৰ্যনিৰ্বাহ",
+  "কৈছিল",
+  "তেওঁলোকক",
+  "ফেব্ৰুৱাৰী",
+  "বাধা",
+  "বেছিভাগ",
+  "সাজি",
+  "২৭",
+  "ৰাজ্যিক",
+  "উচ্চতৰ",
+  "এইটো",
+};
+const uint16_t WA_FREQ_6_RANKS[] = {
+  0, 0, 0, 355, 0, 0, 33, 0, 873, 0, 0, 0, 555, 0, 0, 228,
+  622, 78, 0, 218, 0, 0, 0, 0, 0, 728, 232, 0, 327, 0, 0, 382,
+  246, 542, 847, 0, 0, 905, 328, 0, 119, 291, 399, 406, 488, 644, 0, 313,
+  329, 0, 485, 0, 187, 0, 0, 0, 663, 0, 116, 991, 0, 0, 780, 726,
+  0, 0, 0, 574, 457, 535, 362, 0, 0, 0, 658, 58, 690, 581, 771, 0,
+  135, 836, 898, 146, 0, 584, 0, 0, 623, 971, 0, 0, 118, 0, 0, 506,
+  750, 103, 487, 974, 314, 975, 0, 0, 0, 0, 0, 0, 0, 717, 0, 0,
+  990, 0, 194, 467, 593, 290, 307, 359, 965, 671, 837, 859, 370, 0, 0, 0,
+  0, 0, 0, 34, 261, 310, 341, 776, 808, 812, 998, 198, 594, 216, 519, 961,
+  0, 325, 0, 0, 0, 640, 0, 27, 55, 0, 0, 0, 86, 0, 925, 195,
+  323, 0, 0, 0, 0, 0, 124, 815, 783, 0, 0, 510, 0, 0, 907, 937,
+  810, 706, 822, 938, 0, 0, 0, 396, 141, 351, 154, 494, 683, 0, 647, 29,
+  0, 0, 988, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 165, 0,
+  0, 0, 270, 940, 0, 677, 0, 0, 0, 283, 997, 0, 964, 757, 0, 909,
+  0, 0, 0, 350, 0, 0, 60, 0, 0, 0, 758, 0, 0, 0, 0, 220,
+  857, 0, 0, 374, 929, 0, 649, 641, 0, 548, 0, 525, 0, 0, 0, 170,
+  515, 633, 621, 667, 247, 68, 260, 557, 715, 724, 0, 0, 0, 0, 209, 241,
+  865, 54, 0, 0, 450, 0, 0, 0, 0, 157, 657, 140, 0, 0, 625, 918,
+  0, 0, 0, 0, 0, 0, 711, 11, 648, 0, 0, 0, 276, 240, 463, 0,
+  171, 0, 0, 0, 0, 0, 81, 0, 0, 0, 196, 293, 0, 0, 598, 0,
+  0, 520, 0, 0, 0, 0, 0, 0, 887, 0, 0, 590, 0, 262, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 36,
+  333, 0, 0, 455, 0, 0, 347, 906, 0, 258, 0, 0, 0, 122, 0, 0,
+  0, 0, 680, 741, 184, 764, 799, 983, 572, 0, 0, 0, 949, 0, 0, 0,
+  254, 317, 617, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 73, 0,
+  793, 233, 92, 21, 486, 878, 0, 0, 0, 0, 391, 982, 180, 501, 537, 969,
+  0, 567, 0, 534, 0, 0, 0, 0, 0, 440, 0, 190, 0, 0, 0, 0,
+  697, 0, 0, 0, 846, 0, 702, 682, 947, 955, 0, 243, 0, 932, 0, 0,
+  0, 0, 0, 0, 114, 400, 0, 874, 0, 0, 0, 0, 926, 826, 0, 0,
+  145, 0, 452, 0, 0, 134, 616, 516, 546, 785, 839, 512, 770, 862, 0, 0,
+  0, 0, 0, 12, 130, 0, 0, 0, 0, 0, 59, 725, 651, 0, 213, 627,
+  0, 275, 607, 592, 962, 0, 0, 0, 559, 591, 0, 0, 0, 223, 0, 0,
+  0, 0, 0, 348, 0, 707, 3, 0, 215, 0, 0, 16, 0, 178, 825, 142,
+  805, 712, 297, 105, 532, 784, 816, 0, 412, 558, 0, 774, 0, 528, 0, 408,
+  0, 0, 744, 0, 0, 167, 0, 806, 876, 595, 0, 0, 0, 587, 895, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 468, 225, 0, 0, 696, 384, 596,
+  0, 0, 903, 0, 0, 0, 403, 0, 0, 471, 99, 0, 754, 0, 0, 173,
+  0, 0, 0, 0, 804, 0, 0, 0, 109, 0, 503, 0, 0, 69, 324, 0,
+  201, 954, 0, 28, 0, 0, 800, 415, 605, 827, 0, 0, 454, 0, 0, 80,
+  6, 766, 42, 448, 863, 0, 0, 104, 540, 868, 0, 129, 226, 375, 17, 217,
+  502, 693, 751, 972, 968, 0, 0, 0, 655, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 624, 0, 32, 378, 0, 0, 393, 0, 14, 0, 139,
+  0, 0, 174, 390, 0, 0, 0, 0, 249, 0, 566, 0, 0, 0, 698, 824,
+  0, 714, 0, 439, 0, 745, 90, 721, 823, 357, 0, 66, 0, 0, 0, 0,
+  891, 0, 0, 0, 0, 0, 995, 736, 0, 981, 0, 0, 0, 919, 417, 0,
+  637, 880, 890, 94, 779, 0, 0, 0, 0, 0, 82, 0, 0, 0, 0, 394,
+  10, 854, 646, 0, 0, 0, 35, 87, 117, 604, 946, 0, 0, 0, 580, 0,
+  934, 0, 0, 0, 56, 459, 0, 0, 0, 0, 0, 0, 821, 0, 0, 0,
+  950, 0, 426, 219, 920, 0, 0, 738, 553, 0, 0, 356, 0, 0, 743, 0,
+  436, 0, 306, 879, 19, 0, 730, 582, 0, 161, 0, 0, 786, 0, 795, 0,
+  0, 0, 0, 5, 155, 121, 152, 705, 342, 523, 748, 777, 917, 64, 939, 536,
+  423, 318, 814, 931, 305, 383, 0, 716, 892, 589, 0, 289, 469, 331, 150, 361,
+  573, 845, 0, 0, 781, 0, 718, 0, 896, 0, 0, 830, 0, 0, 189, 615,
+  2, 101, 0, 0, 244, 552, 0, 0, 0, 0, 0, 389, 554, 346, 0, 0,
+  26, 40, 0, 0, 0, 292, 608, 668, 788, 0, 0, 0, 967, 0, 0, 0,
+  222, 316, 0, 629, 278, 828, 0, 634, 0, 127, 158, 0, 352, 0, 321, 0,
+  0, 0, 0, 0, 749, 0, 0, 0, 343, 930, 18, 0, 611, 52, 729, 0,
+  618, 0, 943, 0, 0, 0, 0, 46, 474, 484, 673, 746, 541, 0, 0, 0,
+  380, 0, 282, 0, 0, 0, 0, 381, 336, 0, 76, 0, 0, 0, 0, 95,
+  0, 0, 1, 0, 0, 0, 760, 0, 0, 0, 922, 30, 419, 0, 0, 0,
+  79, 456, 296, 0, 0, 0, 41, 0, 435, 169, 0, 0, 0, 0, 39, 0,
+  0, 832, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 451, 0,
+  0, 0, 497, 0, 53, 529, 0, 0, 0, 0, 385, 0, 0, 0, 300, 0,
+  672, 0, 933, 248, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 182, 259,
+  731, 500, 0, 0, 0, 588, 722, 656, 75, 685, 684, 0, 0, 0, 205, 654,
+  202, 0, 0, 0, 0, 941, 0, 0, 0, 894, 689, 0, 0, 999, 0, 0,
+  0, 0, 710, 0, 489, 199, 0, 353, 311, 578, 753, 527, 700, 916, 0, 978,
+  91, 610, 414, 337, 694, 735, 0, 599, 0, 0, 0, 236, 339, 0, 0, 0,
+  0, 0, 482, 0, 0, 993, 778, 952, 153, 444, 0, 0, 723, 207, 856, 987,
+  0, 872, 0, 0, 0, 970, 498, 901, 956, 295, 360, 570, 742, 875, 176, 945,
+  120, 0, 0, 0, 0, 0, 20, 425, 106, 0, 0, 577, 1000, 265, 0, 0,
+  0, 8, 734, 0, 0, 762, 0, 0, 0, 0, 0, 0, 97, 0, 0, 0,
+  0, 0, 0, 320, 871, 0, 245, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 522, 0, 0, 47, 0, 0, 0, 665, 159, 0, 0, 976, 0,
+  0, 0, 0, 0, 0, 371, 113, 583, 884, 0, 0, 280, 0, 0, 477, 285,
+  210, 0, 0, 899, 0, 0, 835, 420, 853, 882, 366, 791, 334, 0, 0, 0,
+  287, 996, 0, 332, 759, 0, 212, 100, 0, 0, 0, 0, 234, 322, 0, 465,
+  0, 0, 0, 413, 473, 221, 0, 0, 556, 0, 0, 701, 0, 0, 0, 678,
+  733, 266, 0, 0, 434, 0, 472, 0, 948, 0, 409, 0, 855, 492, 544, 818,
+  0, 461, 0, 674, 0, 0, 0, 986, 0, 756, 524, 0, 49, 309, 886, 0,
+  579, 0, 848, 0, 549, 0, 769, 31, 0, 340, 0, 0, 67, 614, 123, 449,
+  820, 0, 0, 0, 632, 460, 0, 0, 0, 0, 0, 0, 613, 0, 0, 424,
+  0, 0, 433, 235, 281, 0, 495, 0, 0, 0, 0, 526, 0, 372, 609, 0,
+  844, 0, 0, 704, 418, 98, 475, 638, 224, 132, 801, 294, 586, 636, 669, 851,
+  302, 852, 606, 923, 0, 0, 0, 0, 755, 0, 803, 543, 0, 0, 0, 504,
+  547, 0, 0, 149, 143, 0, 193, 0, 45, 315, 0, 214, 0, 319, 0, 126,
+  811, 0, 985, 0, 0, 108, 511, 877, 0, 0, 0, 727, 0, 44, 695, 0,
+  831, 0, 85, 0, 0, 181, 569, 0, 575, 953, 0, 410, 709, 538, 0, 0,
+  0, 0, 0, 422, 992, 0, 802, 0, 0, 571, 392, 944, 0, 0, 0, 0,
+  0, 0, 0, 264, 0, 789, 71, 0, 518, 908, 428, 0, 0, 432, 720, 0,
+  191, 0, 0, 0, 203, 0, 148, 0, 0, 509, 688, 747, 0, 0, 0, 0,
+  62, 645, 0, 0, 0, 692, 888, 273, 274, 913, 924, 561, 0, 4, 0, 0,
+  0, 935, 0, 0, 349, 0, 0, 900, 957, 38, 83, 531, 797, 0, 0, 0,
+  963, 37, 790, 0, 0, 0, 0, 326, 0, 829, 912, 600, 0, 0, 0, 231,
+  631, 51, 308, 545, 959, 0, 179, 897, 861, 0, 0, 0, 0, 112, 0, 0,
+  0, 0, 0, 643, 0, 0, 0, 0, 0, 0, 980, 0, 869, 0, 24, 7,
+  89, 819, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  335, 0, 0, 0, 238, 0, 0, 0, 0, 279, 0, 0, 445, 772, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 603, 792, 864, 915, 0, 0, 0, 0, 379,
+  0, 345, 977, 0, 841, 0, 443, 562, 681, 364, 881, 230, 437, 739, 237, 513,
+  936, 0, 0, 752, 0, 0, 0, 23, 0, 0, 48, 338, 642, 666, 910, 602,
+  0, 0, 0, 966, 0, 0, 65, 0, 0, 0, 0, 0, 363, 57, 453, 0,
+  0, 478, 257, 177, 377, 387, 376, 388, 530, 550, 858, 817, 902, 514, 0, 0,
+  0, 427, 984, 517, 0, 0, 0, 560, 687, 885, 0, 168, 796, 904, 269, 22,
+  271, 286, 299, 481, 564, 373, 765, 211, 850, 0, 0, 0, 0, 229, 107, 563,
+  0, 0, 737, 551, 661, 842, 0, 0, 256, 505, 740, 479, 883, 0, 0, 0,
+  612, 0, 0, 0, 255, 787, 838, 0, 0, 251, 0, 893, 0, 0, 77, 0,
+  0, 0, 0, 0, 441, 0, 242, 330, 533, 151, 156, 398, 480, 411, 653, 676,
+  833, 0, 0, 0, 0, 74, 111, 466, 664, 576, 204, 958, 72, 84, 565, 630,
+  860, 133, 284, 691, 0, 192, 0, 0, 0, 125, 628, 679, 0, 0, 102, 50,
+  239, 438, 719, 407, 597, 358, 843, 166, 0, 0, 834, 344, 163, 183, 0, 421,
+  499, 670, 0, 0, 252, 0, 0, 675, 386, 0, 298, 0, 13, 0, 0, 807,
+  160, 763, 0, 272, 0, 227, 367, 0, 164, 732, 405, 96, 0, 626, 960, 0,
+  0, 404, 0, 0, 0, 0, 401, 470, 660, 699, 288, 703, 0, 0, 0, 0,
+  0, 0, 162, 253, 0, 0, 0, 365, 397, 761, 0, 185, 402, 464, 867, 659,
+  914, 188, 927, 493, 849, 0, 43, 0, 635, 0, 0, 115, 0, 0, 312, 395,
+  446, 0, 88, 0, 0, 0, 0, 942, 0, 0, 0, 0, 0, 0, 250, 0,
+  713, 521, 773, 61, 0, 138, 110, 490, 0, 0, 0, 0, 0, 0, 0, 15,
+  483, 0, 0, 973, 0, 301, 0, 63, 442, 0, 0, 0, 206, 866, 197, 809,
+  9, 429, 708, 0, 431, 0, 768, 147, 304, 369, 620, 652, 0, 0, 0, 447,
+  303, 0, 619, 0, 0, 0, 775, 368, 0, 662, 0, 0, 0, 0, 686, 0,
+  131, 0, 650, 0, 928, 0, 496, 186, 172, 354, 137, 267, 0, 0, 0, 0,
+  0, 0, 430, 491, 25, 0, 0, 0, 0, 0, 416, 268, 70, 208, 994, 0,
+  0, 870, 794, 175, 840, 0, 0, 458, 0, 0, 0, 0, 0, 0, 0, 539,
+  585, 0, 508, 0, 0, 0, 0, 0, 601, 277, 979, 989, 0, 144, 0, 0,
+  0, 0, 136, 911, 93, 476, 798, 0, 767, 0, 0, 0, 0, 639, 0, 0,
+  0, 263, 889, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 813, 0,
+  507, 0, 782, 200, 462, 921, 0, 0, 0, 0, 0, 0, 0, 951, 568, 0,
+};
+
+const char *WA_FREQ_7_TOKENS[] = {
+  "en",
+  "la",
+  "ye",
+  "de",
+  "esti",
+  "qué",
+  "fais",
+  "ne",
+  "freba",
+  "barato",
+  "malta",
+  "tornóse",
+  "mebru",
+  "xe",
+  "mayo",
+  "2004",
+  "y",
+  "empezó",
+  "a",
+  "gastar",
+  "l",
+  "euru",
+  "como",
+  "moneda",
+  "2008",
+  "preguntáronse",
+  "ylu",
+  "d",
+  "otru",
+  "xeitu",
+  "tren",
+  "nun",
+  "para",
+  "equí",
+  "sígue",
+  "lu",
+  "sitiu",
+  "web",
+  "bien",
+  "útil",
+  "école",
+  "xuguemos",
+  "digo",
+  "hola",
+  "amiga",
+};
+const uint16_t WA_FREQ_7_RANKS[] = {
+  0, 0, 0, 0, 11, 0, 35, 41, 0, 12, 3, 15, 16, 36, 6, 40,
+  0, 10, 0, 39, 33, 0, 45, 0, 0, 0, 0, 4, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 34, 0, 7, 28, 43,
+  0, 0, 0, 19, 0, 25, 8, 30, 0, 17, 0, 0, 0, 0, 0, 13,
+  27, 0, 0, 0, 0, 0, 32, 0, 0, 0, 0, 0, 21, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 9, 38, 18, 22, 42, 0, 0, 14, 0, 0,
+  0, 0, 44, 26, 0, 0, 0, 0, 0, 0, 0, 20, 31, 0, 0, 5,
+  0, 1, 23, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 24, 37, 0,
+};
+
+const char *WA_FREQ_8_TOKENS[] = {
+  "jisk'a",
+  "suyuxa",
+  "de",
+  "suyu",
+  "aru",
+  "kastilla",
+  "jach'a",
+  "t'aqa",
+  "Distrito",
+  "Kamasqa",
+  "mara",
+  "Umalliq",
+  "phaxsi",
+  "mä",
+  "phaxsin",
+  "uru",
+  "San",
+  "Manuel",
+  "ukat",
+  "Piruwna",
+  "Provincia",
+  "suyuwa",
+  "janiw",
+  "Prado",
+  "jan",
+  "La",
+  "Jisk'a",
+  "marka",
+  "suyunaka",
+  "wali",
+  "Wankawillka",
+  "Hunin",
+  "Libertad",
+  "Ukat",
+  "sata",
+  "Chichu",
+  "qallta",
+  "Wanuku",
+  "Amarujawira",
+  "Awti",
+  "Martín",
+  "aka",
+  "Taypi",
+  "Jallu",
+  "ukax",
+  "Aka",
+  "Juyphi",
+  "markana",
+  "Fernando",
+  "Belaúnde",
+  "José",
+  "Odría",
+  "uka",
+  "Wuliwya",
+  "Luritu",
+  "taqi",
+  "Augusto",
+  "Leguía",
+  "Anata",
+  "Lampalliqi",
+  "pä",
+  "niya",
+  "5",
+  "jupanakax",
+  "Ankashu",
+  "Llamayu",
+  "Llamp'u",
+  "Piwra",
+  "Castilla",
+  "Uka",
+  "jacha",
+  "2",
+  "Pasqu",
+  "Ramón",
+  "Jach'a",
+  "Yapu",
+  "kuti",
+  "21",
+  "qulluwa",
+  "sapa",
+  "Pardo",
+  "apthapi",
+  "suma",
+  "utji",
+  "jisk’a",
+  "m",
+  "yaqha",
+  "Achuqa",
+  "walja",
+  "Santa",
+  "pacha",
+  "kimsa",
+  "kuna",
+  "14",
+  "El",
+  "Huillka",
+  "jach’a",
+  "jani",
+  "kunayman",
+  "maya",
+  "15",
+  "3",
+  "29",
+  "4",
+  "nayriri",
+  "Alberto",
+  "Benavides",
+  "Thaya",
+  "Martin",
+  "Ukayali",
+  "tunka",
+  "Luya",
+  "Oscar",
+  "Wankayu",
+  "30",
+  "Alan",
+  "Carrión",
+  "Fujimori",
+  "Uta",
+  "12",
+  "16",
+  "28",
+  "Chili",
+  "Patas",
+  "Tumpis",
+  "t'aqawa",
+  "ukaxa",
+  "18",
+  "20",
+  "22",
+  "García",
+  "11",
+  "1955",
+  "6",
+  "Mariscal",
+  "Yatiñ",
+  "kunatti",
+  "ukasti",
+  "Juan",
+  "Luis",
+  "jupax",
+  "maran",
+  "may",
+  "suyux",
+  "1964",
+  "26",
+  "7",
+  "Alto",
+  "Chachapuyas",
+  "Taqi",
+  "sum",
+  "uta",
+  "1",
+  "Santiago",
+  "Sánchez",
+  "jikxatasi",
+  "khunu",
+  "nayra",
+  "17",
+  "27",
+  "del",
+  "ukjam",
+  "10",
+  "13",
+  "1857",
+  "1920",
+  "1961",
+  "1984",
+  "Chiklayu",
+  "Jichhax",
+  "Jupanakax",
+  "Jusiya",
+  "Libertadur",
+  "Puerto",
+  "Wuliwar",
+  "jaqi",
+  "pusi",
+  "wila",
+  "1943",
+  "23",
+  "25",
+  "8",
+  "Francisco",
+  "Qusqu",
+  "arupi",
+  "markan",
+  "msnm",
+  "qullu",
+  "sasaw",
+  "sinti",
+  "uywa",
+  "wal",
+  "1825",
+  "1942",
+  "1944",
+  "31",
+  "Morales",
+  "Nayra",
+  "Uqshapampa",
+  "Waytara",
+  "jallu",
+  "jilata",
+  "paya",
+  "uma",
+  "1821",
+  "1954",
+  "24",
+  "9",
+  "Jaqi",
+  "Kunsipsyun",
+  "Mä",
+  "Qajamarka",
+  "Tayaqaqa",
+  "Trujillo",
+  "chiqa",
+  "kuns",
+  "sañ",
+  "yatipxi",
+  "19",
+  "1941",
+  "1956",
+  "1965",
+  "Bellavista",
+  "Cáceres",
+  "Mariano",
+  "Paz",
+  "Tarma",
+  "jila",
+  "jilïr",
+  "jiwat",
+  "kasta",
+  "qhipha",
+  "thaya",
+  "1962",
+  "Bolivia",
+  "Chile",
+  "Chuqlluqucha",
+  "Diosan",
+  "Maynas",
+  "Mendoza",
+  "Sapa",
+  "ch’uqi",
+  "jaqin",
+  "jaqinaka",
+  "mäkiw",
+  "sipan",
+  "uk",
+  "ukatx",
+  "warmi",
+  "1959",
+  "Daniel",
+  "Janiw",
+  "Lamas",
+  "Pedro",
+  "Punu",
+  "Quta",
+  "Rikina",
+  "Rodríguez",
+  "Simuna",
+  "Ukjamaraki",
+  "aski",
+  "asu",
+  "jaqinakax",
+  "jaqix",
+  "markar",
+  "nayrïr",
+  "patan",
+  "ukjax",
+  "1936",
+  "Anqara",
+  "Bermúdez",
+  "Bongara",
+  "Churkampa",
+  "Eduardo",
+  "Los",
+  "Miguel",
+  "Wila",
+  "Yawli",
+  "arut",
+  "aymar",
+  "chika",
+  "juk’amp",
+  "maraw",
+  "markat",
+  "patak",
+  "saraksnawa",
+  "suyun",
+  "ukjamaw",
+  "waka",
+  "Ayaquchu",
+  "Ayawaka",
+  "Bagua",
+  "Ch'uqiyapu",
+  "Lima",
+  "López",
+  "Murrupun",
+  "Sullana",
+  "Ukax",
+  "Ukjarux",
+  "Utusku",
+  "Wamali",
+  "achu",
+  "akax",
+  "akjam",
+  "machaq",
+  "qala",
+  "sas",
+  "ukanakax",
+  "Antonio",
+  "Aqupampa",
+  "Ariqipa",
+  "Balta",
+  "Jupax",
+  "Paita",
+  "Pikuta",
+  "Qullu",
+  "Rosa",
+  "Suyu",
+  "Vietnam",
+  "ancha",
+  "chacha",
+  "janirakiw",
+  "jawira",
+  "junt'u",
+  "kun",
+  "lurata",
+  "mar",
+  "marana",
+  "qillqata",
+  "tunk",
+  "ukjamarak",
+  "uraqi",
+  "uraqin",
+  "yapu",
+  "yaqhip",
+  "1986",
+  "1995",
+  "Akax",
+  "Alcides",
+  "Asqupi",
+  "Aymara",
+  "Chuku",
+  "Cruz",
+  "Ferreñafe",
+  "Pablo",
+  "Romaña",
+  "Santiagu",
+  "Satipu",
+  "Yaruwillka",
+  "arunak",
+  "khaysa",
+  "kunas",
+  "kunati",
+  "kunaymana",
+  "quri",
+  "qurpasi",
+  "taqpach",
+  "ukanak",
+  "ukjamarakiw",
+  "waranq",
+  "1861",
+  "1935",
+  "1952",
+  "2011-2014",
+  "Ampu",
+  "Andrés",
+  "Chanchamayu",
+  "Chipin",
+  "Coronel",
+  "Jan",
+  "Mama",
+  "Nicolás",
+  "Padre",
+  "Qullux",
+  "Rioja",
+  "Santo",
+  "Ukampirus",
+  "Willka",
+  "aycha",
+  "jawirawa",
+  "kullakanakax",
+  "maranakax",
+  "mayniw",
+  "phisqa",
+  "suyuna",
+  "ukan",
+  "ukapachax",
+  "ukjamak",
+  "ukjamaraki",
+  "ukjaxa",
+  "urux",
+  "usu",
+  "utan",
+  "utax",
+  "utjkiti",
+  "yati",
+  "yuriña",
+  "1876",
+  "1917",
+  "1985",
+  "1990",
+  "Datem",
+  "Grande",
+  "Inka",
+  "Jawirax",
+  "Kurakanaka",
+  "Leoncio",
+  "Nayriri",
+  "Nuevo",
+  "Sichura",
+  "Talara",
+  "Ukatakix",
+  "Ukjamïpan",
+  "Utkupampa",
+  "Wallaqa",
+  "ayllun",
+  "aymara",
+  "jakasirinakax",
+  "janchi",
+  "janq'u",
+  "janq’u",
+  "jaqinakaxa",
+  "jilat",
+  "juk’at",
+  "khaya",
+  "la",
+  "manqhana",
+  "mayj",
+  "maynix",
+  "qhipa",
+  "qutawa",
+  "sat",
+  "sañäni",
+  "siwa",
+  "tatax",
+  "tiwulax",
+  "tuqi",
+  "ukampins",
+  "ukata",
+  "ukjaw",
+  "uñjasax",
+  "waña",
+  "yuriwi",
+  "1835",
+  "1870",
+  "1946",
+  "1951",
+  "1957",
+  "1958",
+  "1960",
+  "1993",
+  "1994",
+  "Abad",
+  "Agustín",
+  "Amasuna",
+  "Andes",
+  "Bustamante",
+  "Chimú",
+  "China",
+  "Concepción",
+  "Domingo",
+  "Gran",
+  "Ignacio",
+  "Jehová",
+  "Las",
+  "Lawriqucha",
+  "Marañón",
+  "Niya",
+  "Nueva",
+  "Orbegoso",
+  "Pakasmayu",
+  "Piérola",
+  "Pottillo",
+  "Qutax",
+  "Salaverry",
+  "Taqna",
+  "Tukachi",
+  "Ukampins",
+  "Ukatx",
+  "Ukham",
+  "Universidad",
+  "arunxa",
+  "chinu",
+  "inti",
+  "iwij",
+  "jakasir",
+  "jaqina",
+  "jaqinak",
+  "jichhax",
+  "jichhu",
+  "jiwasax",
+  "juyphi",
+  "kamana",
+  "kunapachati",
+  "kunattï",
+  "kut",
+  "laq'a",
+  "maranakan",
+  "maranakanx",
+  "markawa",
+  "mayamp",
+  "pata",
+  "qhawqha",
+  "sapxiwa",
+  "sasin",
+  "suxta",
+  "suyumpiw",
+  "taypi",
+  "taypin",
+  "utjiri",
+  "1866",
+  "1896",
+  "1900",
+  "1906",
+  "1921",
+  "1933",
+  "1940",
+  "1987",
+  "1989",
+  "1992",
+  "Apurimaq",
+  "Atalaya",
+  "Belén",
+  "Bolívar",
+  "Buenos",
+  "Carlos",
+  "Dorado",
+  "Felipe",
+  "Hulkan",
+  "Ika",
+  "Ispaña",
+  "Iwrupa",
+  "Kunapachatix",
+  "Kunjamati",
+  "Lagunas",
+  "Magdalena",
+  "Muyupampa",
+  "Nayrïr",
+  "Niyak",
+  "Palenque-x",
+  "Papa",
+  "Pekin",
+  "Piruw",
+  "Pirwa",
+  "Porvenir",
+  "Remigio",
+  "Rusiya",
+  "Río",
+  "Saposoa",
+  "Sarumilla",
+  "Toledo",
+  "Ukapachparakiw",
+  "Waqaypampa",
+  "Yaqhip",
+  "akham",
+  "aliq",
+  "ar",
+  "arma",
+  "arunaka",
+  "arux",
+  "jasak",
+  "juyra",
+  "kast",
+  "khitis",
+  "manq'a",
+  "maranwa",
+  "muruq'u",
+  "muxsa",
+  "mäkirakiw",
+  "nayrar",
+  "nä",
+  "phaxs",
+  "phaxsit",
+  "phuthi",
+  "qullur",
+  "saraqataruw",
+  "siwar",
+  "siya",
+  "suni",
+  "sutini",
+  "tata",
+  "ukar",
+  "ukhamarak",
+  "urunakax",
+  "utjäna",
+  "uyu",
+  "uywat",
+  "wayn",
+  "yap",
+  "yaqhipanakax",
+  "yatiqañ",
+  "yatiñ",
+  "yä",
+  "yänaka",
+  "1907",
+  "1916",
+  "1918",
+  "1923",
+  "1925",
+  "1983",
+  "Aires",
+  "Altu",
+  "Ana",
+  "Anta",
+  "Aru",
+  "Contralmirante",
+  "Etén",
+  "Herrera",
+  "Illimani",
+  "Internet-an",
+  "Janq’u",
+  "Jawasa",
+  "Kimsa",
+  "Lurito",
+  "María",
+  "Muqiwa",
+  "Pachitiya",
+  "Pata",
+  "Qullasuyu",
+  "Thanh",
+  "Tingo",
+  "Ukaw",
+  "Vargas",
+  "Villar",
+  "Víctor",
+  "Wayna",
+  "Wiru",
+  "Yatich",
+  "achunak",
+  "aliqat",
+  "anch",
+  "arun",
+  "arunx",
+  "askipuniwa",
+  "ch'uñu",
+  "chhijchhis",
+  "ch’uqix",
+  "ch’uxña",
+  "isi",
+  "jall",
+  "janïr",
+  "jaqinakaw",
+  "jaya",
+  "jayp’ux",
+  "jutapxi",
+  "k'uchuni",
+  "kisus",
+  "kunaw",
+  "kusa",
+  "lurat",
+  "mamajax",
+  "marax",
+  "markam",
+  "markanx",
+  "mayja",
+  "muntanwa",
+  "nina",
+  "niy",
+  "pachaxa",
+  "qhirwa",
+  "rusi",
+  "sasina",
+  "saw",
+  "sullu",
+  "sutin",
+  "sï",
+  "taqin",
+  "ukakïkiti",
+  "ukapachparakiw",
+  "ukaruw",
+  "ukaw",
+  "ukham",
+  "ukjamarus",
+  "ukjamïpan",
+  "ukjarux",
+  "uraq",
+  "uraqinxa",
+  "utjaraki",
+  "uñjaña",
+  "walpun",
+  "y",
+  "yatiraki",
+  "yuku",
+  "yuritayna",
+  "ñuñuri",
+  "1834",
+  "1840",
+  "1855",
+  "1864",
+  "1874",
+  "1875",
+  "1886",
+  "1893",
+  "1905",
+  "1910",
+  "1912",
+  "1922",
+  "1927",
+  "1929",
+  "1932",
+  "1945",
+  "1953",
+  "1970",
+  "1980",
+  "1999",
+  "2000",
+  "2010",
+  "Acobamba",
+  "Akampix",
+  "Akjam",
+  "Alejandro",
+  "Amazonas",
+  "Asunsyun",
+  "Barranca",
+  "Biavo",
+  "Bolivia-n",
+  "Bolognesi",
+  "Catalina",
+  "Celendín",
+  "Cerro",
+  "Chico",
+  "Chukiyaw",
+  "Cristóbal",
+  "Cutervo",
+  "Elías",
+  "Esperanza",
+  "Evo",
+  "Gamarra",
+  "Gregorio",
+  "Guerra",
+  "Hermosa",
+  "Hunkariya",
+  "Iglesia",
+  "Inti",
+  "Iwrupapi",
+  "Jach’a",
+  "Jaén",
+  "Jorge",
+  "Kaman",
+  "Kunsijirunaka",
+  "Kunturkanki",
+  "Lonya",
+  "Manku",
+  "Marañun",
+  "Markus",
+  "Nayax",
+  "Pampa",
+  "Pampas",
+  "Phaxsi",
+  "Phransiya",
+  "Providencia",
+  "Pueblo",
+  "Punta",
+  "QULLA",
+  "Qalamarka",
+  "Qhanañchirinakapaxa",
+  "Rupa",
+  "Salitral",
+  "Sorata",
+  "Sucre",
+  "Tampu",
+  "Tata",
+  "Teniente",
+  "Tintay",
+  "Titiqaqa",
+  "Tomás",
+  "Tunka",
+  "Uk",
+  "Ukjam",
+  "Ukjamax",
+  "Uma",
+  "Umasuyu",
+  "Unidos",
+  "Unión",
+  "Unyun",
+  "Villa",
+  "Wallata",
+  "Yamakis",
+  "Yaqhipanakax",
+  "Yaqhippachax",
+  "Yunka",
+  "achunaka",
+  "akan",
+  "akjamanak",
+  "ali",
+  "anat",
+  "apnaqapxi",
+  "apthapiña",
+  "arst’äna",
+  "askinjam",
+  "awki",
+  "awtut",
+  "aymarat",
+  "ch'uqix",
+  "chakitilla",
+  "chaqan",
+  "chaqat",
+  "chhijchhi",
+  "imaña",
+  "jachiri",
+  "jakiri",
+  "janipuniw",
+  "janiwa",
+  "jaqir",
+  "jaqiw",
+  "jil",
+  "jilpachapinix",
+  "jiqxatasi",
+  "jiwasan",
+  "junt’u",
+  "jupanakar",
+  "jutir",
+  "jutiri",
+  "k'ullk'u",
+  "kawsay",
+  "khämar",
+  "kimsaqalq",
+  "lampa",
+  "liwru",
+  "lurapxi",
+  "luratawa",
+  "lurañ",
+  "machaqa",
+  "manqha",
+  "manqhancha",
+  "manqhankiri",
+  "mark",
+  "markanxa",
+  "markaxa",
+  "mayni",
+  "maynit",
+  "millón",
+  "muni",
+  "muniwa",
+  "nayax",
+  "nayraqatax",
+  "pachax",
+  "paqallqu",
+  "phisqha",
+  "pinyin",
+  "p’iqinchiri",
+  "q'ala",
+  "qachu",
+  "qalltañatakix",
+  "qalltäna",
+  "qaqa",
+  "samipax",
+  "sunkhan",
+  "suxu",
+  "tam",
+  "taqiniw",
+  "tawaqunakax",
+  "thuru",
+  "tuqin",
+  "tuqina",
+  "tuqiri",
+  "tuqirux",
+  "tuqit",
+  "ukampirus",
+  "ukanx",
+  "ukarux",
+  "ukatxa",
+  "ukhamaraki",
+  "ukhamaw",
+  "ukjamatwa",
+  "ukjanakaw",
+  "ukjanakax",
+  "ukjaruw",
+  "uksa",
+  "ukx",
+  "ukäk",
+  "umax",
+  "uraqina",
+  "uraqita",
+  "uraqpachan",
+  "uraqpachanxa",
+  "urkhu",
+  "urut",
+  "uruw",
+  "utjapxi",
+  "utjki",
+  "utjkänti",
+  "uñstawayi",
+  "uñt’at",
+  "wakiskiri",
+  "walpin",
+  "waranqh",
+  "warmix",
+  "waw",
+  "wawa",
+  "wawanak",
+  "wayna",
+  "willka",
+  "wislla",
+  "xeramanu",
+  "yänak",
+  "ñik'uta",
+  "180px",
+  "1862",
+  "1871",
+  "1879",
+  "1897",
+  "1908",
+  "1911",
+  "1914",
+  "1926",
+  "1928",
+  "1930",
+  "1950",
+  "1963",
+  "1968",
+  "1974",
+  "1982",
+  "1998",
+  "2.0",
+  "2013-2014",
+  "40",
+  "Achacachi",
+  "Akan",
+  "Akanakax",
+  "Akatakix",
+  "Akjan",
+  "Almazán",
+  "Antapampa",
+  "Arma",
+  "Arunak",
+  "Arunkirinakax",
+  "Arux",
+  "Askpachapinix",
+  "Asunción",
+  "Awya",
+  "Aymar",
+  "Aynacha",
+  "Ayni",
+  "Bach",
+  "Bautista",
+  "Baños",
+  "Biblia",
+  "Billinghurst",
+  "Birmingham",
+  "Cajas",
+  "Católica",
+  "Central",
+  "Ch'iyar",
+  "Ch'iyara",
+  "Chaka",
+  "Chincha",
+  "Chino",
+  "Chiqans",
+  "Chuqiyapu",
+  "Ch’uqi",
+  "Construyendo",
+  "Crus",
+  "Elecciones",
+  "Francesco",
+  "Garcia",
+  "Guillermo",
+  "Gálvez",
+  "Hoa",
+  "Hospital",
+  "Huwan",
+  "Inca",
+  "Inlis",
+  "Internet",
+  "Italiya",
+  "Janipuniw",
+  "Janïr",
+  "Jayu",
+  "Jerónimo",
+  "Jichhurunakanxa",
+  "Jichhürunakanx",
+  "Jilpachapinix",
+  "Johannes",
+  "Julio",
+  "Jupanakasti",
+  "K'ili",
+  "K'isi",
+  "Kastilla",
+  "Kunapachati",
+  "Kuns",
+  "Kusikusi",
+  "Laka",
+  "Lamara",
+  "Laq'u",
+  "Llumpaqa",
+  "Luzuriaga",
+  "Manq'a",
+  "Mara",
+  "Marcos",
+  "Masisea",
+  "Matawasi",
+  "Maysatx",
+  "Mitu",
+  "Moche",
+  "Movimiento",
+  "Nayraqata",
+  "P'allqa",
+  "P'allqamayu",
+  "P'iqi",
+  "Pachamamaru",
+};
+const uint16_t WA_FREQ_8_RANKS[] = {
+  106, 0, 0, 0, 85, 724, 0, 0, 0, 0, 157, 321, 288, 547, 0, 0,
+  675, 511, 613, 621, 0, 853, 987, 648, 0, 0, 0, 820, 0, 0, 0, 696,
+  704, 0, 0, 0, 0, 794, 183, 528, 893, 255, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 656, 0, 985, 0, 291, 0, 0, 370, 695, 382, 901, 0,
+  0, 0, 0, 323, 991, 0, 0, 994, 0, 187, 341, 0, 0, 0, 0, 295,
+  0, 0, 0, 653, 0, 212, 74, 768, 0, 177, 364, 484, 645, 147, 663, 720,
+  67, 928, 431, 552, 0, 0, 292, 871, 439, 409, 644, 668, 0, 0, 0, 0,
+  0, 711, 0, 0, 0, 0, 0, 23, 143, 0, 0, 709, 0, 0, 671, 0,
+  0, 0, 708, 190, 545, 878, 0, 0, 783, 0, 0, 0, 0, 0, 0, 0,
+  0, 445, 533, 590, 0, 0, 747, 575, 0, 40, 0, 0, 739, 238, 949, 0,
+  0, 0, 217, 0, 0, 0, 201, 226, 500, 0, 0, 525, 36, 209, 961, 0,
+  976, 0, 0, 0, 0, 0, 772, 0, 0, 0, 166, 0, 229, 627, 686, 690,
+  707, 725, 600, 904, 464, 199, 979, 986, 995, 0, 0, 651, 0, 801, 821, 316,
+  475, 179, 0, 0, 0, 0, 0, 0, 0, 0, 746, 521, 119, 826, 0, 0,
+  658, 0, 435, 619, 874, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 279,
+  0, 660, 0, 0, 0, 0, 0, 0, 0, 517, 932, 335, 0, 937, 0, 0,
+  0, 0, 96, 0, 0, 70, 0, 0, 0, 0, 0, 0, 989, 655, 946, 0,
+  0, 0, 272, 860, 0, 493, 225, 966, 0, 0, 0, 882, 716, 0, 391, 37,
+  827, 0, 558, 206, 632, 24, 657, 714, 0, 75, 0, 502, 859, 616, 604, 244,
+  0, 0, 0, 421, 865, 193, 0, 0, 0, 254, 0, 127, 594, 0, 0, 0,
+  0, 0, 0, 0, 159, 0, 959, 170, 386, 428, 0, 329, 0, 56, 310, 433,
+  465, 489, 0, 0, 0, 389, 732, 452, 413, 194, 562, 0, 414, 0, 0, 0,
+  0, 592, 154, 551, 557, 0, 584, 535, 811, 0, 0, 846, 0, 0, 0, 0,
+  524, 700, 875, 10, 343, 0, 0, 0, 258, 0, 0, 0, 0, 0, 520, 522,
+  777, 0, 408, 554, 0, 447, 0, 0, 0, 0, 507, 0, 0, 900, 0, 0,
+  0, 0, 0, 0, 315, 555, 614, 977, 0, 0, 832, 0, 0, 248, 0, 0,
+  0, 659, 0, 0, 740, 0, 633, 0, 537, 742, 441, 0, 305, 0, 0, 252,
+  963, 210, 0, 132, 163, 923, 317, 429, 276, 230, 631, 925, 0, 363, 915, 0,
+  454, 539, 0, 0, 0, 805, 0, 776, 0, 0, 0, 0, 136, 951, 213, 0,
+  39, 444, 885, 795, 0, 41, 610, 0, 0, 830, 142, 198, 55, 647, 970, 0,
+  234, 685, 185, 615, 0, 0, 0, 0, 0, 140, 392, 867, 947, 0, 760, 920,
+  529, 0, 0, 0, 0, 0, 0, 173, 275, 306, 418, 767, 73, 0, 636, 0,
+  0, 0, 0, 0, 567, 0, 635, 0, 0, 0, 456, 0, 721, 236, 0, 250,
+  679, 718, 953, 59, 373, 0, 0, 42, 89, 338, 670, 0, 0, 197, 628, 0,
+  0, 0, 436, 30, 7, 424, 749, 422, 895, 0, 488, 0, 0, 0, 0, 0,
+  814, 0, 0, 57, 0, 0, 26, 0, 0, 688, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 730, 0, 0, 0, 0, 0, 847, 0, 2, 0, 0, 0, 785,
+  470, 682, 948, 202, 0, 921, 0, 68, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 247, 784, 0, 0, 253, 0, 957, 0, 646, 0, 0, 898, 259, 0, 0,
+  982, 0, 327, 531, 587, 356, 665, 0, 0, 0, 897, 999, 0, 0, 0, 729,
+  0, 490, 941, 0, 0, 0, 0, 0, 0, 337, 467, 572, 0, 710, 0, 0,
+  0, 0, 837, 0, 543, 606, 0, 0, 77, 427, 0, 0, 0, 0, 478, 0,
+  440, 172, 0, 200, 240, 267, 318, 0, 0, 831, 684, 0, 863, 689, 0, 151,
+  137, 548, 0, 824, 180, 0, 0, 842, 261, 32, 779, 0, 0, 0, 0, 850,
+  0, 0, 442, 0, 667, 156, 300, 0, 241, 719, 339, 924, 0, 0, 530, 0,
+  0, 99, 566, 34, 532, 0, 0, 0, 354, 0, 891, 0, 0, 0, 0, 0,
+  0, 0, 0, 388, 400, 222, 246, 568, 781, 816, 822, 257, 849, 0, 342, 0,
+  269, 0, 469, 674, 926, 270, 383, 0, 0, 0, 415, 607, 0, 0, 0, 852,
+  697, 0, 802, 0, 0, 0, 640, 771, 861, 0, 0, 48, 296, 620, 748, 751,
+  0, 809, 293, 0, 0, 0, 66, 652, 325, 935, 58, 0, 0, 0, 836, 0,
+  0, 0, 0, 0, 0, 133, 390, 1, 184, 0, 0, 0, 211, 227, 0, 472,
+  676, 0, 0, 0, 733, 775, 798, 933, 0, 181, 544, 108, 115, 158, 626, 800,
+  0, 396, 0, 286, 135, 346, 25, 940, 0, 494, 0, 0, 129, 0, 0, 358,
+  0, 0, 0, 33, 205, 0, 0, 0, 793, 715, 0, 104, 0, 0, 0, 0,
+  221, 0, 0, 569, 141, 769, 0, 0, 0, 0, 0, 312, 126, 0, 0, 111,
+  761, 0, 0, 0, 43, 838, 0, 0, 0, 191, 0, 150, 11, 0, 231, 0,
+  0, 0, 0, 0, 82, 282, 419, 0, 0, 0, 107, 0, 0, 0, 0, 0,
+  381, 0, 165, 0, 0, 0, 92, 0, 0, 0, 0, 443, 0, 0, 0, 0,
+  251, 964, 922, 0, 0, 0, 16, 278, 649, 870, 49, 936, 495, 0, 430, 509,
+  0, 0, 0, 0, 0, 105, 412, 513, 485, 0, 0, 0, 841, 0, 774, 0,
+  0, 0, 706, 0, 0, 0, 974, 0, 0, 735, 712, 0, 13, 50, 144, 171,
+  765, 623, 0, 869, 536, 22, 120, 0, 0, 0, 459, 301, 51, 289, 680, 981,
+  992, 0, 819, 968, 0, 0, 0, 457, 0, 0, 178, 0, 0, 102, 0, 0,
+  0, 0, 0, 0, 877, 0, 0, 87, 705, 410, 174, 737, 176, 283, 496, 954,
+  787, 0, 0, 0, 0, 350, 612, 0, 0, 0, 873, 0, 357, 0, 0, 0,
+  0, 0, 265, 446, 455, 0, 637, 0, 299, 0, 0, 0, 232, 17, 0, 308,
+  395, 0, 738, 597, 0, 0, 432, 578, 0, 0, 387, 943, 0, 0, 577, 723,
+  0, 0, 0, 0, 0, 0, 0, 148, 0, 0, 0, 468, 0, 0, 0, 0,
+  477, 843, 868, 311, 0, 0, 0, 0, 0, 617, 792, 93, 872, 101, 601, 0,
+  336, 0, 553, 332, 0, 0, 91, 320, 438, 580, 0, 0, 0, 0, 271, 97,
+  280, 482, 0, 807, 0, 0, 0, 0, 263, 618, 906, 0, 0, 683, 586, 550,
+  960, 734, 322, 0, 0, 62, 0, 453, 0, 0, 694, 938, 360, 538, 0, 0,
+  0, 0, 512, 699, 884, 0, 810, 0, 0, 0, 407, 297, 351, 0, 374, 0,
+  931, 908, 103, 912, 0, 0, 0, 0, 128, 0, 0, 3, 763, 0, 0, 559,
+  268, 803, 384, 71, 0, 145, 64, 996, 0, 0, 28, 919, 53, 0, 0, 35,
+  355, 0, 0, 0, 0, 0, 0, 314, 417, 134, 260, 641, 681, 330, 744, 759,
+  256, 0, 0, 0, 0, 0, 0, 0, 799, 0, 0, 756, 0, 0, 0, 466,
+  0, 0, 817, 0, 0, 481, 581, 0, 0, 907, 813, 556, 834, 603, 845, 149,
+  285, 0, 109, 0, 54, 235, 835, 510, 0, 113, 379, 0, 298, 971, 0, 0,
+  0, 0, 0, 0, 0, 367, 515, 0, 0, 0, 752, 0, 0, 0, 773, 643,
+  0, 0, 542, 917, 0, 0, 0, 0, 476, 361, 492, 0, 0, 579, 862, 916,
+  15, 0, 0, 0, 0, 0, 461, 0, 372, 0, 376, 168, 0, 0, 0, 8,
+  116, 0, 549, 0, 0, 0, 31, 204, 0, 0, 0, 0, 797, 0, 844, 208,
+  0, 0, 0, 451, 782, 207, 0, 0, 0, 0, 0, 703, 910, 0, 0, 634,
+  563, 969, 216, 397, 0, 45, 0, 0, 404, 139, 894, 0, 352, 0, 0, 215,
+  0, 0, 757, 362, 0, 220, 0, 0, 1000, 189, 0, 0, 0, 0, 0, 72,
+  693, 855, 958, 955, 0, 0, 0, 406, 385, 880, 736, 0, 0, 61, 83, 952,
+  0, 0, 0, 0, 0, 0, 541, 0, 9, 281, 766, 815, 125, 883, 0, 0,
+  0, 0, 0, 887, 823, 0, 0, 0, 770, 741, 0, 214, 516, 622, 727, 153,
+  0, 0, 0, 755, 988, 0, 0, 929, 0, 0, 420, 0, 0, 851, 347, 369,
+  479, 0, 0, 86, 162, 60, 114, 564, 582, 506, 914, 0, 0, 0, 0, 0,
+  0, 0, 487, 182, 0, 0, 0, 790, 0, 0, 0, 0, 333, 0, 0, 0,
+  889, 0, 571, 0, 0, 0, 44, 505, 196, 243, 591, 0, 0, 0, 0, 0,
+  0, 0, 155, 264, 218, 0, 0, 0, 69, 0, 402, 560, 944, 0, 0, 0,
+  780, 0, 864, 63, 0, 0, 0, 273, 0, 0, 0, 0, 0, 411, 0, 0,
+  0, 0, 0, 394, 625, 0, 0, 0, 0, 0, 304, 950, 0, 888, 0, 0,
+  0, 328, 927, 565, 993, 0, 0, 121, 750, 245, 743, 0, 0, 0, 973, 0,
+  664, 186, 319, 570, 677, 956, 0, 0, 0, 81, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 540, 0, 0, 0, 434, 975, 462, 0, 965, 791, 0, 401,
+  0, 95, 762, 866, 0, 20, 0, 0, 0, 0, 192, 6, 497, 593, 0, 0,
+  403, 499, 0, 825, 896, 0, 0, 90, 0, 0, 945, 881, 639, 574, 903, 0,
+  692, 437, 698, 237, 0, 0, 0, 0, 0, 0, 523, 642, 972, 804, 0, 118,
+  130, 526, 930, 0, 638, 0, 0, 0, 0, 0, 0, 0, 274, 678, 666, 188,
+  0, 0, 0, 79, 94, 326, 393, 448, 463, 123, 514, 962, 585, 302, 0, 0,
+  886, 984, 833, 0, 0, 303, 47, 713, 758, 902, 0, 857, 786, 0, 0, 0,
+  309, 0, 471, 0, 998, 0, 0, 0, 0, 788, 598, 561, 611, 239, 754, 501,
+  416, 4, 796, 789, 812, 0, 152, 0, 287, 0, 27, 0, 0, 918, 0, 0,
+  340, 398, 80, 242, 331, 359, 458, 546, 818, 858, 890, 806, 0, 0, 0, 52,
+  0, 0, 0, 876, 425, 669, 0, 0, 504, 0, 324, 117, 0, 353, 0, 583,
+  595, 0, 0, 808, 588, 0, 0, 0, 0, 609, 0, 0, 0, 486, 249, 629,
+  0, 0, 672, 405, 726, 233, 829, 0, 596, 0, 365, 0, 138, 195, 828, 0,
+  0, 65, 650, 344, 0, 0, 88, 602, 624, 0, 745, 608, 378, 0, 0, 0,
+  290, 0, 0, 224, 856, 0, 29, 0, 480, 654, 839, 848, 0, 0, 0, 0,
+  0, 131, 0, 0, 0, 0, 673, 18, 0, 0, 0, 0, 0, 0, 228, 423,
+  879, 0, 0, 0, 161, 0, 474, 0, 764, 0, 702, 0, 167, 203, 576, 840,
+  219, 160, 0, 5, 0, 348, 0, 0, 146, 0, 978, 0, 0, 0, 294, 701,
+  0, 100, 0, 630, 0, 345, 0, 722, 911, 0, 110, 0, 0, 0, 0, 0,
+  0, 942, 0, 0, 519, 997, 0, 399, 0, 0, 0, 0, 112, 934, 0, 0,
+  84, 78, 0, 0, 0, 573, 0, 0, 0, 0, 0, 375, 0, 0, 0, 913,
+  0, 0, 0, 12, 0, 0, 223, 450, 899, 14, 21, 284, 426, 313, 262, 473,
+  980, 334, 728, 0, 0, 518, 277, 0, 380, 687, 0, 905, 491, 527, 0, 717,
+  778, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 164, 0, 0, 854, 0,
+  0, 0, 0, 0, 0, 0, 349, 731, 983, 0, 0, 0, 0, 0, 368, 0,
+  534, 0, 589, 599, 98, 605, 753, 0, 46, 0, 0, 0, 0, 0, 892, 0,
+  483, 0, 0, 38, 967, 449, 460, 0, 0, 0, 169, 175, 307, 371, 498, 0,
+  0, 0, 0, 0, 0, 76, 124, 691, 0, 662, 0, 0, 0, 0, 0, 0,
+  0, 122, 661, 909, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 939,
+  990, 0, 366, 377, 0, 0, 0, 0, 0, 0, 266, 19, 0, 0, 508, 503,
+};
+
+const char *WA_FREQ_9_TOKENS[] = {
+  "һәм",
+  "да",
+  "дә",
+  "бер",
+  "белән",
+  "км",
+  "менән",
+  "Йылға",
+  "ҡушыла",
+  "өҫтәрәк",
+  "ярына",
+  "тамағынан",
+  "йылғаһының",
+  "ул",
+  "бу",
+  "татар",
+  "дип",
+  "кеше",
+  "бар",
+  "Рәсәй",
+  "өчен",
+  "түгел",
+  "генә",
+  "бик",
+  "булып",
+  "ла",
+  "иде",
+  "йылғаһы",
+  "һул",
+  "уң",
+  "инде",
+  "итеп",
+  "Ул",
+  "алып",
+  "була",
+  "өсөн",
+  "ук",
+  "итә",
+  "күп",
+  "турында",
+  "шул",
+  "булган",
+  "ике",
+  "Ә",
+  "иң",
+  "тип",
+  "ауыл",
+  "буйынса",
+  "дәүләт",
+  "шулай",
+  "бит",
+  "булды",
+  "лә",
+  "Бу",
+  "Русия",
+  "Башҡортостандың",
+  "зур",
+  "ә",
+  "был",
+  "икән",
+  "тора",
+  "Татарстан",
+  "милли",
+  "эш",
+  "тә",
+  "та",
+  "килә",
+  "гына",
+  "әле",
+  "үз",
+  "Шулай",
+  "Был",
+  "ди",
+  "районындағы",
+  "хәбәр",
+  "ала",
+  "йылда",
+  "килгән",
+  "һәр",
+  "аның",
+  "бара",
+  "мөмкин",
+  "халыҡ",
+  "каршы",
+  "дигән",
+  "килеп",
+  "президенты",
+  "башка",
+  "мең",
+  "соң",
+  "ел",
+  "юк",
+  "кирәк",
+  "Башҡортостан",
+  "ғына",
+  "алар",
+  "иткән",
+  "итте",
+  "Татар",
+  "йыл",
+  "мин",
+  "уҡ",
+  "ни",
+  "уның",
+  "тиеш",
+  "ҙур",
+  "күрә",
+  "баш",
+  "булған",
+  "тиклем",
+  "Мин",
+  "көн",
+  "вакытта",
+  "арасында",
+  "үҙ",
+  "ил",
+  "Шул",
+  "башҡорт",
+  "торган",
+  "аны",
+  "төп",
+  "хәл",
+  "кем",
+  "халык",
+  "кенә",
+  "теле",
+  "хәрби",
+  "кешеләр",
+  "ҙа",
+  "булса",
+  "элек",
+  "йәшәй",
+  "аша",
+  "Мәскәү",
+  "яңа",
+  "Ләкин",
+  "без",
+  "Казан",
+  "Бер",
+  "беренче",
+  "ошо",
+  "тигән",
+  "тик",
+  "әлеге",
+  "кебек",
+  "төрлө",
+  "балалар",
+  "республика",
+  "йылға",
+  "президент",
+  "ҡала",
+  "диде",
+  "тураһында",
+  "елда",
+  "һуң",
+  "йылдың",
+  "Оло",
+  "безнең",
+  "Европа",
+  "телен",
+  "ул.",
+  "юл",
+  "Башҡорт",
+  "белдерде",
+  "килде",
+  "1",
+  "ине",
+  "кадәр",
+  "Дәүләт",
+  "анда",
+  "көнне",
+  "башҡа",
+  "бергә",
+  "кабул",
+  "һыу",
+  "төрле",
+  "улы",
+  "алыу",
+  "Алар",
+  "ҙә",
+  "Әмма",
+  "улар",
+  "АКШ",
+  "бирә",
+  "урынлашҡан",
+  "бәйле",
+  "белем",
+  "тагын",
+  "бала",
+  "уны",
+  "барып",
+  "башкорт",
+  "кире",
+  "үк",
+  "башлыгы",
+  "шушы",
+  "Рөстәм",
+  "махсус",
+  "менә",
+  "яңы",
+  "булыр",
+  "телендә",
+  "тыш",
+  "Әгәр",
+  "хәзер",
+  "урыс",
+  "элекке",
+  "юҡ",
+  "булырга",
+  "кеүек",
+  "әйтә",
+  "йәки",
+  "ителә",
+  "матур",
+  "Өфө",
+  "дәвам",
+  "безгә",
+  "исә",
+  "әллә",
+  "торған",
+  "бүген",
+  "туры",
+  "алды",
+  "араһында",
+  "ваҡыт",
+  "миллион",
+  "Әлеге",
+  "Аның",
+  "йылғы",
+  "ярдәм",
+  "рәсми",
+  "исеме",
+  "районы",
+  "тел",
+  "милләт",
+  "исемендәге",
+  "20",
+  "донъя",
+  "кешенең",
+  "сүз",
+  "һәлак",
+  "Уның",
+  "ителгән",
+  "3",
+  "тыуған",
+  "Казанда",
+  "бары",
+  "мөһим",
+  "Һәм",
+  "урын",
+  "үткән",
+  "2",
+  "Тик",
+  "буларак",
+  "кәрәк",
+  "ничек",
+  "артык",
+  "тәкъдим",
+  "берничә",
+  "булачак",
+  "ваҡытта",
+  "вәкиле",
+  "яхшы",
+  "акча",
+  "үзе",
+  "караганда",
+  "үтә",
+  "киң",
+  "белдерә",
+  "рус",
+  "хеҙмәт",
+  "көндә",
+  "эшләр",
+  "таба",
+  "нинди",
+  "Без",
+  "шундый",
+  "Ошо",
+  "хаҡында",
+  "береһе",
+  "аларның",
+  "иҫәбен",
+  "ләкин",
+  "Русиянең",
+  "район",
+  "бөтен",
+  "татарлар",
+  "эшләй",
+  "10",
+  "эше",
+  "янында",
+  "китә",
+  "биргән",
+  "2010",
+  "эшкә",
+  "министры",
+  "ҡаршы",
+  "Кесе",
+  "сәбәпле",
+  "Анда",
+  "Әммә",
+  "тарихи",
+  "юлы",
+  "Шуңа",
+  "соңгы",
+  "эшләгән",
+  "юғары",
+  "атом",
+  "буенча",
+  "шунда",
+  "Чөнки",
+  "аңа",
+  "йылдарҙа",
+  "үзенең",
+  "бөтә",
+  "урында",
+  "Русиядә",
+  "икенче",
+  "татарча",
+  "вакытында",
+  "ауылында",
+  "мәктәп",
+  "киткән",
+  "итү",
+  "туган",
+  "ҡабул",
+  "5",
+  "ислам",
+  "җитәкчесе",
+  "яки",
+  "4",
+  "әйтте",
+  "әмма",
+  "исемле",
+  "социаль",
+  "алган",
+  "Рәсәйҙәге",
+  "югары",
+  "тәүге",
+  "Улар",
+  "Һәр",
+  "уларҙың",
+  "Татарстанда",
+  "Менә",
+  "биш",
+  "йылдан",
+  "беренсе",
+  "дини",
+  "Милли",
+  "йәш",
+  "кала",
+  "итеү",
+  "чит",
+  "яҡшы",
+  "билдәле",
+  "нисә",
+  "китап",
+  "федераль",
+  "ҡына",
+  "Иран",
+  "үҙе",
+  "илдә",
+  "берсе",
+  "йә",
+  "чөнки",
+  "алдында",
+  "дин",
+  "халкы",
+  "иһә",
+  "аларны",
+  "күптән",
+  "тапҡыр",
+  "чыга",
+  "эшләп",
+  "барлыҡҡа",
+  "зыян",
+  "тейеш",
+  "Бүген",
+  "хужалығы",
+  "нефть",
+  "нәрсә",
+  "булуын",
+  "Иң",
+  "ниндәй",
+  "районының",
+  "якын",
+  "кешене",
+  "Яңы",
+  "елның",
+  "башында",
+  "әммә",
+  "ашыу",
+  "Безнең",
+  "хөкүмәт",
+  "өс",
+  "вәкилләре",
+  "йәшәгән",
+  "узган",
+  "булмаган",
+  "ай",
+  "тура",
+  "әйтеп",
+  "Аллаһ",
+  "30",
+  "булһа",
+  "эшләргә",
+  "ярҙам",
+  "алмый",
+  "эшли",
+  "Урал",
+  "үҙенең",
+  "чыкты",
+  "тапкыр",
+  "уҡыу",
+  "чыккан",
+  "автомобиль",
+  "ҡайһы",
+  "Азатлык",
+  "алған",
+  "дүрт",
+  "идем",
+  "уға",
+  "булмый",
+  "итәргә",
+  "беҙҙең",
+  "15",
+  "Башкортстан",
+  "12",
+  "кайбер",
+  "тарихы",
+  "сыға",
+  "мәгълүмат",
+  "районында",
+  "Хәзер",
+  "эшен",
+  "булуы",
+  "таләп",
+  "яктан",
+  "тағы",
+  "китте",
+  "сәяси",
+  "елларда",
+  "әлегә",
+  "икенсе",
+  "хезмәт",
+  "күбрәк",
+  "үтте",
+  "яҡын",
+  "бүгенге",
+  "кешегә",
+  "коммунала",
+  "монда",
+  "барган",
+  "Әле",
+  "өч",
+  "белә",
+  "Ике",
+  "күҙ",
+  "Медведев",
+  "тарафыннан",
+  "саны",
+  "башлай",
+  "булараҡ",
+  "хөкүмәте",
+  "хатта",
+  "урынына",
+  "кына",
+  "Башҡортостанда",
+  "игълан",
+  "тәшкил",
+  "нисек",
+  "халыкара",
+  "бирергә",
+  "6",
+  "кулга",
+  "Республика",
+  "рәисе",
+  "һүҙ",
+  "урта",
+  "изге",
+  "комитеты",
+  "искә",
+  "Хәмитов",
+  "мөселман",
+  "аларга",
+  "бай",
+  "исемен",
+  "уйлап",
+  "Татарстанның",
+  "башлап",
+  "ҡыҙы",
+  "булыуы",
+  "метр",
+  "Ислам",
+  "11",
+  "тарих",
+  "калган",
+  "әйтүенчә",
+  "мондый",
+  "хата",
+  "Салауат",
+  "ял",
+  "Шуға",
+  "эчендә",
+  "һайын",
+  "миллиард",
+  "яшьләр",
+  "тап",
+  "бөгөн",
+  "7",
+  "кайдан",
+  "күпме",
+  "рәвештә",
+  "2006",
+  "минем",
+  "җавап",
+  "ер",
+  "сүзләренчә",
+  "ун",
+  "төбәк",
+  "50",
+  "дөнья",
+  "бирелә",
+  "ҡалған",
+  "күреп",
+  "бәлки",
+  "урыны",
+  "тулы",
+  "хакта",
+  "арта",
+  "буйы",
+  "сөнки",
+  "25",
+  "тарафынан",
+  "саҡ",
+  "8",
+  "индексы",
+  "ауылы",
+  "рөхсәт",
+  "аҡ",
+  "аенда",
+  "билгеле",
+  "ҡара",
+  "алу",
+  "барлык",
+  "спорт",
+  "үлгән",
+  "коды",
+  "фән",
+  "саҡта",
+  "тормош",
+  "уку",
+  "һуңғы",
+  "Өфөлә",
+  "башлады",
+  "финанс",
+  "елдан",
+  "ти",
+  "шәһәр",
+  "даими",
+  "итегез",
+  "100",
+  "14",
+  "аҡса",
+  "дауам",
+  "дэ",
+  "фикер",
+  "Бөтә",
+  "дөрес",
+  "бирелгән",
+  "чаралары",
+  "итергә",
+  "Ни",
+  "авыл",
+  "күргән",
+  "Дмитрий",
+  "хәҙер",
+  "яши",
+  "рухи",
+  "авыр",
+  "мине",
+  "сез",
+  "буе",
+  "шәһәрендә",
+  "Бөгөн",
+  "уңышлы",
+  "һаман",
+  "алдан",
+  "ҡалаһында",
+  "балалары",
+  "аҙ",
+  "яшәгән",
+  "өлкәһе",
+  "карата",
+  "белэн",
+  "ята",
+  "инә",
+  "моны",
+  "уртаклашу",
+  "алынган",
+  "вакыт",
+  "килгәндә",
+  "халҡы",
+  "чын",
+  "министрлыгы",
+  "унда",
+  "бүлеге",
+  "чыгыш",
+  "илнең",
+  "йыш",
+  "Мәскәүдә",
+  "бүләк",
+  "Казанга",
+  "елга",
+  "шуңа",
+  "аерым",
+  "чыгып",
+  "оло",
+  "буйлап",
+  "көрәш",
+  "сайлау",
+  "газ",
+  "шәхси",
+  "Язмада",
+  "хәтта",
+  "чаралар",
+  "шактый",
+  "яшь",
+  "башлана",
+  "Сергей",
+  "тәҡдим",
+  "әйтергә",
+  "Александр",
+  "алга",
+  "биреп",
+  "республиканың",
+  "төрки",
+  "икәнен",
+  "күрсәгез",
+  "шуны",
+  "azatliq",
+  "Унда",
+  "керә",
+  "фәнни",
+  "rferl.org",
+  "18",
+  "ителде",
+  "әгәр",
+  "Мәҫәлән",
+  "ярашлы",
+  "Төркия",
+  "йорт",
+  "хәрәкәт",
+  "булмаған",
+  "нәтиҗәсендә",
+  "тырыша",
+  "турыда",
+  "бында",
+  "Владимир",
+  "йылы",
+  "саклау",
+  "турындагы",
+  "совет",
+  "үтеп",
+  "барыбер",
+  "сыҡҡан",
+  "театры",
+  "Германия",
+  "үзәге",
+  "белдергән",
+  "бирле",
+  "эшләү",
+  "16",
+  "дөйөм",
+  "аз",
+  "мөрәҗәгать",
+  "Рәсәйҙең",
+  "ҡалаһы",
+  "етәксеһе",
+  "йылдар",
+  "күңел",
+  "уларҙы",
+  "моңа",
+  "кергән",
+  "саен",
+  "тота",
+  "17",
+  "ана",
+  "сит",
+  "яза",
+  "Бик",
+  "урман",
+  "нигезендә",
+  "беҙ",
+  "университеты",
+  "Бөйөк",
+  "ут",
+  "барышында",
+  "алмай",
+  "һаны",
+  "Күп",
+  "13",
+  "яшәүче",
+  "ғилми",
+  "9",
+  "мәгариф",
+  "ҡарап",
+  "Путин",
+  "Совет",
+  "профессор",
+  "өлөшө",
+  "айырым",
+  "Тукай",
+  "тикшерү",
+  "мәдәният",
+  "хәзерге",
+  "Урта",
+  "сығып",
+  "һымаҡ",
+  "алдына",
+  "хакимият",
+  "үҙәге",
+  "Уфа",
+  "алырга",
+  "егет",
+  "тышкы",
+  "җир",
+  "Соңгы",
+  "хөкем",
+  "шуның",
+  "һөҗүм",
+  "Республикаһы",
+  "игътибар",
+  "ауыр",
+  "канун",
+  "асыҡ",
+  "хәрәкәте",
+  "һум",
+  "Президент",
+  "барысы",
+  "Йыл",
+  "19",
+  "май",
+  "аннан",
+  "иғтибар",
+  "очракта",
+  "өлкәсендә",
+  "өлеше",
+  "исем",
+  "мөмкинлеге",
+  "полиция",
+  "мәҙәниәт",
+  "саный",
+  "бейеклектә",
+  "булырға",
+  "үзенә",
+  "иҗтимагый",
+  "кимәленән",
+  "40",
+  "матбугат",
+  "халыкның",
+  "ижад",
+  "булмай",
+  "күпләп",
+  "тормошҡа",
+  "һаҡлау",
+  "Яңа",
+  "янына",
+  "бәләкәй",
+  "Франция",
+  "көчле",
+  "теленә",
+  "вафат",
+  "еллар",
+  "Ватан",
+  "Бүгенге",
+  "авторы",
+  "барған",
+  "биреү",
+  "әйткән",
+  "Берлеге",
+  "оешмасы",
+  "каршылык",
+  "җитәкчеләре",
+  "күренекле",
+  "мәктәбе",
+  "оҙонлоғо",
+  "Кытай",
+  "бүлкәтендә",
+  "и",
+  "тавыш",
+  "доллар",
+  "урынбасары",
+  "карап",
+  "белгән",
+  "китеп",
+  "рәйесе",
+  "эсендә",
+  "быуат",
+  "ғаилә",
+  "алты",
+  "гел",
+  "татарлары",
+  "бына",
+  "мәртәбә",
+  "UTC",
+  "Дингеҙ",
+  "байтаҡ",
+  "көнө",
+  "халыкка",
+  "гади",
+  "хәлдә",
+  "кереп",
+  "мәғлүмәт",
+  "идарәсе",
+  "карар",
+  "Саксония",
+  "иминлек",
+  "тимер",
+  "көч",
+  "эшләре",
+  "ачык",
+  "хакимияте",
+  "карамастан",
+  "халкының",
+  "үзләре",
+  "әфәнде",
+  "24",
+  "Обама",
+  "булмаса",
+  "интернет",
+  "Уларҙың",
+  "урнашкан",
+  "медицина",
+  "син",
+  "быел",
+  "ханым",
+  "исәптән",
+  "мәчет",
+  "һ.б.",
+  "Кеше",
+  "андый",
+  "Президенты",
+  "ағас",
+  "бирү",
+  "үзен",
+  "алда",
+  "сум",
+  "тарихын",
+  "эйә",
+  "хас",
+  "шуға",
+  "мөдире",
+  "йәшлек",
+  "яҡтан",
+  "Шушы",
+  "кешеләргә",
+  "чара",
+  "халыҡтың",
+  "мөмкинлек",
+  "электр",
+  "26",
+  "күренеш",
+  "нәкъ",
+  "халыкны",
+  "Алтын",
+  "Рәсәйҙә",
+  "дәрәҗәдә",
+  "шундай",
+  "Америка",
+  "күренә",
+  "язган",
+  "язылган",
+  "заман",
+  "катнашты",
+  "машина",
+  "хәҙерге",
+  "катнашкан",
+  "кешеләре",
+  "почта",
+  "һатып",
+  "үҫә",
+  "мәсьәлә",
+  "ғүмер",
+  "Әлбәттә",
+  "хокук",
+  "заманында",
+  "җирле",
+  "ерендәге",
+  "яуап",
+  "ҡарата",
+  "Уны",
+  "астында",
+  "бәйрәм",
+  "Хәҙер",
+  "көне",
+  "саклап",
+  "Британия",
+  "башлығы",
+  "урам",
+  "ваҡытында",
+  "ихтимал",
+  "миңа",
+  "бернинди",
+  "ныҡ",
+  "теләгән",
+  "шурасы",
+  "Германиялағы",
+  "башланды",
+  "рәүештә",
+  "төшә",
+  "22",
+  "Үрге",
+  "Белорет",
+  "Беҙ",
+  "институты",
+  "Көньяк",
+  "Миңнеханов",
+  "Сез",
+  "талап",
+  "йөрөй",
+  "калды",
+  "телгә",
+  "багышланган",
+  "безне",
+  "очен",
+  "йәштәр",
+  "азат",
+  "атала",
+  "аңлата",
+  "телне",
+  "шәхес",
+  "юкка",
+  "яшьләре",
+  "Күптән",
+  "башта",
+  "Ауыл",
+  "ниндидер",
+  "Аны",
+  "белеп",
+  "күз",
+  "ярым",
+  "27",
+  "Узган",
+  "мәктәптә",
+  "һава",
+  "Аларның",
+  "башлаган",
+  "Әхмәт",
+  "директоры",
+  "күрергә",
+  "су",
+  "таралған",
+  "Һуңғы",
+  "Михаил",
+  "нык",
+  "төркем",
+  "Дмитрий Медведев",
+  "сәнғәт",
+  "докторы",
+  "телле",
+  "күрше",
+  "ҡул",
+  "Бында",
+  "эчке",
+  "тәьмин",
+  "хезмәттәшлек",
+  "хәлләр",
+  "алалар",
+  "узды",
+  "сатып",
+  "сугыш",
+  "күберәк",
+  "көндәрҙә",
+  "ҡалала",
+  "ҡарай",
+  "һис",
+  "23",
+  "Ырымбур",
+  "барлыҡ",
+  "уртак",
+  "Почта",
+  "итәләр",
+  "хакында",
+  "йәғни",
+  "хат",
+  "ябай",
+  "йәшәү",
+  "катнаша",
+  "төзү",
+  "әйткәндә",
+  "тиҙ",
+  "эштәре",
+  "әйтелә",
+  "үҫтереү",
+  "28",
+  "алына",
+  "21",
+  "Бына",
+  "арасындагы",
+};
+const uint16_t WA_FREQ_9_RANKS[] = {
+  466, 0, 0, 694, 94, 995, 0, 0, 714, 380, 747, 321, 501, 0, 711, 0,
+  0, 0, 572, 568, 153, 300, 56, 0, 0, 0, 0, 0, 0, 222, 562, 0,
+  0, 0, 0, 0, 0, 0, 643, 0, 464, 589, 0, 0, 0, 525, 657, 0,
+  0, 349, 0, 0, 0, 0, 0, 720, 884, 0, 375, 927, 442, 770, 235, 0,
+  0, 0, 0, 0, 980, 0, 0, 0, 79, 445, 128, 463, 787, 0, 0, 529,
+  882, 932, 0, 517, 283, 522, 0, 0, 715, 0, 0, 109, 0, 510, 0, 801,
+  326, 581, 8, 113, 554, 956, 0, 540, 0, 0, 85, 863, 0, 0, 0, 0,
+  0, 0, 28, 0, 588, 221, 0, 282, 584, 0, 660, 21, 0, 0, 0, 0,
+  278, 797, 966, 0, 846, 298, 611, 487, 75, 247, 0, 0, 613, 87, 249, 0,
+  677, 0, 0, 0, 0, 107, 497, 0, 0, 0, 0, 0, 0, 609, 0, 179,
+  654, 41, 27, 266, 16, 469, 993, 0, 81, 106, 256, 385, 0, 394, 0, 559,
+  0, 0, 431, 0, 0, 0, 0, 875, 0, 624, 865, 0, 866, 914, 0, 294,
+  50, 590, 368, 850, 0, 681, 781, 0, 0, 360, 0, 0, 0, 399, 817, 0,
+  0, 0, 297, 947, 812, 0, 0, 0, 0, 0, 773, 989, 0, 188, 0, 0,
+  393, 126, 605, 896, 0, 122, 0, 0, 97, 0, 678, 0, 527, 639, 798, 0,
+  0, 726, 0, 0, 230, 0, 0, 0, 754, 0, 0, 500, 0, 0, 351, 0,
+  0, 700, 901, 0, 0, 89, 272, 712, 0, 0, 0, 0, 350, 0, 0, 0,
+  0, 975, 0, 0, 0, 0, 382, 0, 0, 0, 0, 0, 0, 985, 0, 0,
+  313, 0, 0, 582, 530, 0, 0, 0, 509, 826, 0, 0, 396, 647, 649, 0,
+  275, 0, 176, 0, 0, 736, 610, 0, 494, 356, 459, 857, 0, 0, 934, 0,
+  0, 194, 76, 201, 15, 260, 490, 108, 570, 687, 738, 818, 0, 424, 0, 0,
+  0, 0, 0, 0, 0, 367, 902, 0, 708, 0, 0, 0, 0, 0, 0, 0,
+  363, 939, 436, 98, 0, 440, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 427, 151, 37, 192, 270, 341, 112, 295, 408, 441, 149, 0, 0,
+  269, 0, 78, 0, 0, 0, 0, 48, 0, 0, 0, 44, 0, 0, 0, 0,
+  699, 0, 0, 0, 0, 521, 0, 0, 82, 913, 0, 0, 0, 744, 458, 0,
+  69, 234, 265, 656, 185, 831, 340, 503, 829, 55, 907, 241, 0, 619, 885, 169,
+  0, 809, 0, 495, 289, 0, 0, 0, 0, 0, 0, 0, 623, 217, 0, 0,
+  0, 0, 0, 5, 499, 538, 84, 592, 19, 52, 644, 936, 0, 933, 467, 0,
+  880, 0, 0, 0, 0, 0, 791, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  284, 164, 0, 0, 856, 0, 91, 148, 189, 271, 225, 413, 451, 679, 224, 587,
+  929, 0, 0, 314, 95, 258, 0, 886, 309, 479, 541, 0, 0, 545, 839, 867,
+  0, 0, 0, 819, 468, 616, 71, 860, 952, 508, 0, 346, 518, 0, 0, 154,
+  339, 0, 0, 790, 833, 478, 695, 0, 448, 0, 930, 146, 287, 364, 402, 810,
+  0, 0, 262, 0, 825, 0, 630, 0, 0, 0, 0, 17, 786, 887, 204, 0,
+  0, 303, 18, 749, 0, 547, 634, 976, 0, 895, 502, 0, 0, 0, 218, 555,
+  960, 0, 187, 473, 105, 415, 0, 937, 0, 0, 0, 0, 0, 733, 0, 248,
+  504, 668, 872, 0, 0, 693, 193, 0, 734, 0, 182, 93, 0, 948, 0, 0,
+  0, 354, 161, 0, 0, 0, 0, 0, 766, 0, 0, 0, 0, 365, 103, 717,
+  433, 0, 0, 0, 0, 0, 0, 0, 707, 92, 858, 546, 760, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 88, 0, 231, 983, 238, 526, 794, 293, 0,
+  0, 755, 0, 0, 0, 0, 0, 0, 0, 578, 935, 0, 0, 80, 507, 697,
+  0, 0, 0, 0, 0, 0, 0, 66, 276, 0, 0, 0, 0, 777, 0, 38,
+  994, 593, 0, 0, 978, 0, 0, 0, 730, 172, 261, 355, 585, 0, 0, 0,
+  493, 0, 962, 692, 574, 100, 893, 946, 162, 0, 0, 642, 0, 0, 0, 0,
+  0, 86, 131, 684, 243, 723, 638, 118, 842, 0, 0, 0, 0, 0, 0, 156,
+  0, 973, 0, 0, 242, 0, 0, 0, 0, 401, 22, 0, 0, 288, 64, 645,
+  764, 0, 6, 286, 950, 0, 0, 311, 0, 0, 0, 969, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 398, 0, 1, 90,
+  523, 0, 0, 0, 0, 0, 0, 0, 701, 0, 868, 0, 51, 450, 537, 0,
+  0, 0, 3, 104, 635, 132, 390, 343, 626, 658, 768, 776, 449, 127, 0, 0,
+  337, 0, 0, 0, 395, 102, 871, 955, 219, 533, 0, 404, 0, 369, 0, 0,
+  0, 0, 0, 0, 577, 0, 0, 0, 177, 215, 2, 512, 237, 0, 746, 721,
+  0, 737, 0, 0, 400, 878, 0, 0, 0, 0, 830, 331, 0, 11, 835, 739,
+  938, 0, 0, 0, 0, 601, 0, 0, 0, 0, 186, 0, 0, 0, 165, 997,
+  869, 250, 0, 515, 421, 0, 0, 96, 675, 488, 685, 60, 765, 0, 0, 567,
+  669, 915, 160, 178, 7, 73, 61, 439, 727, 751, 226, 319, 74, 724, 888, 921,
+  0, 0, 323, 0, 0, 480, 0, 0, 0, 883, 971, 0, 0, 0, 0, 461,
+  652, 322, 0, 979, 310, 0, 142, 435, 0, 0, 0, 0, 471, 0, 0, 0,
+  372, 0, 0, 0, 0, 672, 753, 299, 780, 57, 168, 844, 0, 197, 804, 0,
+  894, 489, 0, 722, 0, 757, 0, 0, 13, 0, 484, 0, 788, 0, 0, 472,
+  0, 0, 0, 0, 0, 706, 428, 443, 803, 0, 761, 0, 184, 0, 0, 35,
+  0, 0, 123, 308, 840, 704, 31, 796, 580, 762, 120, 874, 152, 14, 244, 0,
+  511, 0, 0, 0, 0, 0, 318, 0, 0, 0, 571, 0, 0, 418, 0, 855,
+  0, 338, 0, 0, 246, 815, 0, 23, 486, 0, 0, 566, 0, 227, 0, 0,
+  0, 0, 43, 854, 965, 891, 114, 531, 0, 0, 992, 631, 591, 391, 214, 0,
+  29, 0, 0, 919, 378, 911, 604, 0, 0, 476, 838, 0, 0, 0, 392, 279,
+  661, 0, 446, 141, 0, 111, 236, 0, 0, 0, 0, 0, 941, 596, 716, 0,
+  414, 852, 0, 0, 725, 0, 0, 228, 573, 851, 455, 0, 129, 426, 425, 438,
+  285, 359, 447, 579, 806, 513, 229, 789, 808, 405, 799, 411, 813, 845, 371, 916,
+  944, 745, 0, 0, 0, 682, 0, 0, 0, 53, 42, 325, 0, 196, 416, 139,
+  333, 953, 674, 0, 782, 240, 0, 0, 0, 550, 640, 0, 0, 0, 0, 0,
+  383, 663, 117, 255, 918, 0, 0, 0, 925, 0, 0, 0, 0, 72, 485, 598,
+  618, 0, 665, 719, 505, 683, 0, 0, 646, 305, 0, 595, 0, 0, 785, 0,
+  481, 710, 834, 0, 67, 977, 0, 0, 0, 0, 0, 332, 651, 0, 0, 0,
+  0, 0, 575, 0, 0, 334, 859, 0, 0, 474, 0, 0, 576, 0, 26, 800,
+  0, 0, 0, 0, 0, 0, 0, 353, 211, 63, 0, 0, 552, 0, 0, 0,
+  0, 0, 968, 0, 0, 0, 437, 841, 0, 133, 0, 0, 25, 0, 482, 0,
+  0, 600, 199, 922, 713, 864, 0, 0, 384, 0, 0, 0, 0, 358, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 816, 0, 957, 0, 0, 793, 320, 756, 377,
+  454, 516, 542, 195, 759, 0, 136, 0, 0, 0, 0, 628, 0, 0, 0, 212,
+  232, 709, 820, 832, 972, 342, 407, 0, 0, 116, 621, 0, 0, 0, 783, 0,
+  0, 0, 216, 0, 926, 827, 805, 0, 0, 0, 0, 0, 121, 964, 984, 705,
+  940, 0, 0, 0, 0, 828, 0, 0, 0, 330, 0, 0, 0, 0, 769, 0,
+  0, 0, 0, 0, 0, 420, 0, 352, 373, 456, 0, 0, 0, 0, 0, 0,
+  0, 0, 849, 987, 0, 686, 758, 0, 0, 0, 0, 544, 345, 296, 412, 252,
+  281, 0, 967, 0, 557, 0, 46, 558, 0, 0, 667, 137, 671, 775, 821, 198,
+  54, 981, 362, 900, 0, 0, 302, 632, 629, 0, 0, 767, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 335, 666, 386, 397, 452, 0, 166,
+  207, 0, 357, 0, 0, 0, 836, 0, 0, 0, 703, 410, 0, 0, 0, 0,
+  0, 119, 0, 0, 0, 999, 30, 0, 0, 20, 366, 0, 0, 774, 0, 0,
+  181, 301, 317, 536, 0, 650, 0, 0, 376, 0, 9, 906, 0, 0, 4, 636,
+  991, 0, 190, 470, 551, 569, 0, 0, 0, 0, 0, 0, 0, 0, 853, 0,
+  0, 125, 0, 0, 0, 268, 0, 0, 607, 0, 498, 655, 608, 752, 879, 0,
+  0, 627, 0, 327, 931, 0, 239, 0, 0, 0, 0, 0, 0, 0, 0, 65,
+  548, 0, 0, 0, 0, 0, 0, 532, 0, 0, 0, 0, 403, 251, 899, 519,
+  870, 910, 0, 0, 58, 155, 561, 620, 145, 673, 409, 923, 0, 264, 0, 0,
+  0, 0, 0, 0, 0, 0, 324, 124, 982, 0, 0, 970, 0, 0, 560, 208,
+  603, 171, 881, 890, 892, 0, 203, 959, 0, 0, 0, 59, 0, 45, 315, 329,
+  0, 259, 750, 903, 553, 0, 0, 0, 792, 0, 0, 0, 0, 811, 0, 0,
+  0, 690, 0, 0, 520, 0, 0, 0, 263, 814, 205, 0, 0, 483, 0, 0,
+  0, 641, 847, 0, 0, 157, 0, 0, 138, 417, 49, 728, 904, 528, 115, 312,
+  912, 771, 257, 0, 0, 0, 0, 344, 0, 0, 202, 328, 32, 0, 0, 273,
+  0, 99, 361, 379, 432, 563, 599, 586, 732, 200, 949, 0, 0, 622, 0, 0,
+  10, 0, 389, 0, 924, 163, 0, 290, 0, 0, 0, 0, 0, 0, 0, 889,
+  848, 942, 877, 475, 0, 0, 0, 909, 0, 0, 0, 130, 430, 688, 491, 0,
+  748, 0, 0, 0, 147, 173, 0, 0, 40, 144, 0, 689, 0, 0, 0, 220,
+  0, 612, 422, 564, 961, 0, 0, 0, 822, 0, 134, 0, 0, 406, 670, 0,
+  0, 429, 0, 0, 0, 539, 784, 0, 0, 174, 0, 0, 0, 0, 0, 0,
+  374, 534, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 594, 633,
+  0, 135, 0, 0, 0, 0, 0, 0, 740, 0, 0, 0, 0, 0, 0, 823,
+  0, 0, 0, 0, 0, 0, 140, 33, 159, 306, 0, 253, 807, 824, 963, 615,
+  62, 167, 524, 0, 0, 0, 614, 718, 1000, 0, 0, 47, 274, 0, 0, 974,
+  691, 0, 0, 143, 876, 898, 0, 958, 0, 0, 565, 0, 0, 0, 0, 0,
+  0, 496, 0, 0, 0, 625, 905, 908, 506, 0, 0, 0, 0, 0, 0, 0,
+  370, 742, 943, 0, 0, 0, 0, 150, 862, 183, 477, 336, 0, 802, 0, 0,
+  0, 0, 0, 0, 0, 0, 556, 36, 617, 381, 24, 696, 990, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 543, 0, 0, 0, 0, 0, 0, 0, 0, 267,
+  0, 998, 307, 729, 0, 0, 945, 637, 465, 0, 0, 662, 0, 0, 0, 77,
+  535, 0, 0, 0, 653, 0, 34, 0, 0, 12, 0, 837, 280, 434, 602, 0,
+  453, 698, 920, 779, 387, 0, 175, 68, 462, 423, 897, 988, 0, 0, 70, 39,
+  0, 170, 743, 795, 0, 514, 101, 0, 741, 210, 0, 702, 951, 731, 206, 233,
+  254, 419, 763, 843, 928, 0, 0, 597, 292, 648, 659, 735, 861, 954, 0, 180,
+  0, 0, 348, 0, 0, 209, 583, 0, 0, 676, 0, 158, 347, 304, 0, 606,
+  0, 492, 291, 0, 0, 0, 83, 0, 772, 0, 0, 0, 0, 0, 0, 0,
+  0, 664, 316, 0, 680, 0, 778, 0, 0, 460, 0, 0, 0, 0, 0, 277,
+  0, 110, 549, 996, 0, 0, 873, 917, 0, 0, 0, 0, 0, 388, 0, 0,
+  213, 245, 223, 0, 0, 457, 0, 0, 0, 0, 0, 986, 444, 0, 191, 0,
+};
+
+const char *WA_FREQ_10_TOKENS[] = {
+  "ا",
+  "نت",
+  "تو",
+  "ش",
+  "م",
+  "رگ",
+  "مزنیں",
+  "پ",
+  "ندے",
+  "جن",
+  "سل",
+  "اللهء",
+  "الیهء",
+  "وسلم",
+  "دیست",
+  "کنئے",
+  "کہ",
+  "اے",
+  "ٹ",
+  "وال",
+  "چوں",
+  "چ",
+  "ل",
+  "ایں",
+  "mubarak",
+  "besay",
+  "ٹوم",
+  "شر",
+  "گ",
+  "تگ",
+  "بیتگ",
+  "á",
+  "kojá",
+  "shotag",
+  "bar",
+  "gaa",
+  "vazar",
+  "الجیریاۓ",
+  "دودء",
+  "ربیدگ",
+  "باز",
+  "کج",
+  "ء",
+  "ت",
+  "ئے",
+  "man",
+  "sayyi",
+  "nayan",
+  "ke",
+  "ay",
+  "durusten",
+};
+const uint16_t WA_FREQ_10_RANKS[] = {
+  0, 0, 19, 0, 0, 14, 44, 31, 0, 0, 0, 41, 0, 0, 0, 18,
+  35, 0, 0, 0, 0, 25, 0, 0, 0, 0, 28, 0, 0, 0, 37, 0,
+  0, 0, 17, 0, 0, 0, 0, 0, 0, 9, 13, 16, 0, 0, 12, 33,
+  0, 0, 0, 15, 49, 30, 39, 0, 45, 0, 0, 32, 34, 0, 46, 0,
+  38, 0, 0, 48, 0, 10, 0, 0, 29, 36, 0, 5, 0, 0, 20, 0,
+  0, 2, 0, 23, 3, 0, 21, 42, 6, 0, 0, 0, 40, 0, 0, 0,
+  0, 4, 1, 50, 0, 7, 8, 26, 47, 0, 22, 0, 43, 0, 0, 24,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11, 51, 27,
+};
+
+const char *WA_FREQ_11_TOKENS[] = {
+  "ring",
+  "sané",
+  "punika",
+  "miwah",
+  "Bali",
+  "saking",
+  "antuk",
+  "warsa",
+  "dados",
+  "puniki",
+  "taler",
+  "ipun",
+  "utawi",
+  "tur",
+  "wénten",
+  "Ring",
+  "nénten",
+  "prasida",
+  "ida",
+  "olih",
+  "Ida",
+  "sampun",
+  "inggih",
+  "sareng",
+  "krama",
+  "désa",
+  "pinaka",
+  "mangda",
+  "akéh",
+  "mawit",
+  "wantah",
+  "I",
+  "lanang",
+  "nyané",
+  "pacang",
+  "danu",
+  "patut",
+  "ka",
+  "kirang",
+  "diri",
+  "mangkin",
+  "Dzisiaj",
+  "Mangku",
+  "Odwiedzający",
+  "Open",
+  "Wejścia",
+  "Zkouška",
+  "indik",
+  "istri",
+  "już",
+  "langkung",
+  "odwiedziło",
+  "ri",
+  "sang",
+  "sasih",
+  "silih",
+  "stronę",
+  "tutaj",
+  "Désa",
+  "adat",
+  "mawinan",
+  "sakadi",
+  "tunggil",
+  "wewidangan",
+  "11",
+  "anak",
+  "madué",
+  "mapidarta",
+  "pragina",
+  "sastra",
+  "sekadi",
+  "Indonésia",
+  "Jumping",
+  "nuju",
+  "para",
+  "Sudira",
+  "genah",
+  "malih",
+  "tatkala",
+  "Arja",
+  "Pastika-Puspayoga",
+  "becik",
+  "kalaksanayang",
+  "manados",
+  "nganggén",
+  "IGK",
+  "Maret",
+  "jagi",
+  "kasolahang",
+  "makarya",
+  "makudang-kudang",
+  "pateh",
+  "tanggal",
+  "tari",
+  "1",
+  "2016",
+  "4",
+  "Buyan",
+  "Cebur",
+  "Danu",
+  "Krama",
+  "Quilombola",
+  "duk",
+  "embas",
+  "kasub",
+  "kawéntenang",
+  "DIS",
+  "Madé",
+  "Sané",
+  "galah",
+  "kabaosang",
+  "lan",
+  "meneng",
+  "pinih",
+  "sumber",
+  "yusa",
+  "5",
+  "7.",
+  "Nénten",
+  "Sang",
+  "Wayan",
+  "brahmana",
+  "cihna",
+  "majeng",
+  "menawi",
+  "2",
+  "April",
+  "Bakta",
+  "Palmares",
+  "Součet",
+  "Univérsitas",
+  "dané",
+  "kakepah",
+  "karya",
+  "kepahan",
+  "ketah",
+  "magenah",
+  "napi",
+  "ngantos",
+  "ngranjing",
+  "pendidikan",
+  "seneng",
+  "seni",
+  "tiosan",
+  "utama",
+  "2020",
+  "3",
+  "Dané",
+  "Gianyar",
+  "ISBN",
+  "Ketut",
+  "Pendidikan",
+  "Pinaka",
+  "Pura",
+  "ageng",
+  "kaanggén",
+  "kalih",
+  "kantun",
+  "kruna",
+  "lianan",
+  "liyané",
+  "ngaptiang",
+  "nyarengin",
+  "pariwisata",
+  "pisan",
+  "sami",
+  "sanï¿½",
+  "sesolahan",
+  "tingkat",
+  "12",
+  "15",
+  "2010",
+  "3.",
+  "Brazil",
+  "Dipta",
+  "Déwa",
+  "Gusti",
+  "Hyang",
+  "Mawit",
+  "Nika",
+  "banjar",
+  "internasional",
+  "jadma",
+  "jagat",
+  "kadadosang",
+  "kualitas",
+  "maosang",
+  "masekolah",
+  "nanging",
+  "negara",
+  "ngawitin",
+  "nincapang",
+  "raja",
+  "sistem",
+  "suci",
+  "toya",
+  "upakara",
+  "1.",
+  "10",
+  "30",
+  "4.",
+  "6",
+  "Baliné",
+  "Belanda",
+  "Dalem",
+  "FKIP",
+  "Kasolahang",
+  "Madï¿½",
+  "Pakraman",
+  "Ritatkala",
+  "Sastra",
+  "Sidakarya",
+  "Taman",
+  "Tamblingan",
+  "Warsa",
+  "aab",
+  "basa",
+  "keamanan",
+  "manut",
+  "mapangapti",
+  "nentén",
+  "ngamedalang",
+  "ngamolihang",
+  "ngrereh",
+  "pangawi",
+  "rahina",
+  "rauh",
+  "sajebag",
+  "sarana",
+  "soroh",
+  "subak",
+  "tan",
+  "tetujon",
+  "unteng",
+  "uratian",
+  "100",
+  "5.",
+  "Bahasa",
+  "Banjar",
+  "Bondrés",
+  "Budaya",
+  "DOI",
+  "Dénpasar",
+  "Hindu",
+  "Igelan",
+  "Kaler",
+  "Kanikayang",
+  "Nasional",
+  "Ni",
+  "Nyoman",
+  "Portugis",
+  "Puri",
+  "Séptémber",
+  "Tilem",
+  "aksara",
+  "alas",
+  "an",
+  "anggén",
+  "dura",
+  "gamelan",
+  "grubug",
+  "idané",
+  "irika",
+  "jagaté",
+  "kagambarang",
+  "kapertama",
+  "kasenian",
+  "kawastanin",
+  "kawedar",
+  "kawéntenan",
+  "lakon",
+  "maarti",
+  "makasami",
+  "marupa",
+  "nangiang",
+  "nasional",
+  "ngambil",
+  "nganti",
+  "ngaryanin",
+  "ngawinang",
+  "nyingakin",
+  "nyolahang",
+  "polih",
+  "raga",
+  "raris",
+  "santukan",
+  "sepatu",
+  "soang-soang",
+  "sudra",
+  "tanah",
+  "tata",
+  "tinggi",
+  "téks",
+  "visi",
+  "widang",
+  "wikan",
+  "yéning",
+  "10.",
+  "18",
+  "2.",
+  "20",
+  "29",
+  "8",
+  "Asapunika",
+  "Balinï¿½",
+  "Duk",
+  "Gambuh",
+  "Gedé",
+  "Gubernur",
+  "IKIP",
+  "Januari",
+  "Jurusan",
+  "Keling",
+  "Manut",
+  "Negeri",
+  "Ngantos",
+  "Ostrava",
+  "Pastika",
+  "Présidén",
+  "Puniki",
+  "Rikala",
+  "SDM",
+  "Sadurung",
+  "Sasampun",
+  "Sasolahan",
+  "Satunggil",
+  "Singaraja",
+  "Sukawati",
+  "Taler",
+  "Tari",
+  "Undiksha",
+  "Universitas",
+  "Yadiastun",
+  "abad",
+  "akéhnyané",
+  "anyar",
+  "bebanyolan",
+  "bulan",
+  "cara",
+  "dinas",
+  "désané",
+  "dï¿½sa",
+  "gambuh",
+  "gering",
+  "guru",
+  "hukum",
+  "i",
+  "jatma",
+  "jinah",
+  "kasarengin",
+  "kasinahang",
+  "kesenian",
+  "kramané",
+  "kulawarga",
+  "lintang",
+  "lontar",
+  "maartos",
+  "mabuat",
+  "majalaran",
+  "makudang",
+  "makéh",
+  "mamurda",
+  "maswara",
+  "mawasta",
+  "ngajahin",
+  "nglimbak",
+  "ngwacén",
+  "ngwangun",
+  "nyurat",
+  "parerehan",
+  "pinanggal",
+  "pracaya",
+  "pranala",
+  "pt",
+  "pustaka",
+  "putih",
+  "quilombo",
+  "risampuné",
+  "s.d",
+  "sadurung",
+  "sayan-sayan",
+  "seda",
+  "sekolah",
+  "sensus",
+  "sepangan",
+  "setata",
+  "sisa",
+  "suratan",
+  "taman",
+  "tamat",
+  "tetep",
+  "tradisional",
+  "téater",
+  "upacara",
+  "urip",
+  "wantuan",
+  "yéh",
+  "19",
+  "1918",
+  "1946",
+  "1963",
+  "1993",
+  "2001",
+  "2013",
+  "22.",
+  "6.",
+  "7",
+  "8.",
+  "9.",
+  "Abu",
+  "Akéh",
+  "Antuk",
+  "Bagus",
+  "Bakar",
+  "Batur",
+  "Brawijaya",
+  "DPR",
+  "Denpasar",
+  "Drika",
+  "Duaning",
+  "Ganga",
+  "Génjék",
+  "Jalan",
+  "Jawa",
+  "Jimbar",
+  "Karang",
+  "Kementerian",
+  "Kuta",
+  "Langkawi",
+  "Lianan",
+  "Makasami",
+  "Mangkin",
+  "Manis",
+  "Menawi",
+  "Menteri",
+  "Mpu",
+  "Penarukan",
+  "Prof",
+  "Puspayoga",
+  "Putu",
+  "Péntozali",
+  "Ragané",
+  "Rai",
+  "Républik",
+  "SMA",
+  "Saking",
+  "Sakéwanten",
+  "Salanturnyané",
+  "Sampun",
+  "Suku",
+  "Supatra",
+  "Tinggi",
+  "Tiosan",
+  "Trudeau",
+  "UNUD",
+  "Udayana",
+  "Upakara",
+  "Widhi",
+  "Wénten",
+  "Zumba",
+  "Zumbi",
+  "ajeng",
+  "akedik",
+  "anggota",
+  "asasih",
+  "asiki",
+  "baga",
+  "balih-balihan",
+  "benang",
+  "berkas",
+  "bidang",
+  "cerpén",
+  "dan",
+  "daya",
+  "dramatari",
+  "duaning",
+  "dumunan",
+  "duranegara",
+  "galahé",
+  "genahnyané",
+  "gerak",
+  "ical",
+  "igel-igelan",
+  "igelan",
+  "isteri",
+  "jagadhita",
+  "jangkep",
+  "jimbar",
+  "kabakta",
+  "kabaos",
+  "kacawang",
+  "kacingak",
+  "kagabung",
+  "kairingin",
+  "kakaryanin",
+  "kakiang",
+  "kala",
+  "kalénder",
+  "kamargiang",
+  "kampus",
+  "kapademang",
+  "kapah",
+  "kapuputang",
+  "karahayuan",
+  "kari",
+  "karipta",
+  "kaunggahang",
+  "kauningin",
+  "kayun",
+  "keanggén",
+  "keni",
+  "konsultan",
+  "krana",
+  "kuliah",
+  "kuning",
+  "lakon-lakon",
+  "lantang",
+  "lembaga",
+  "madasar",
+  "makecos",
+  "makta",
+  "malajah",
+  "mamargi",
+  "manusa",
+  "manusia",
+  "manutin",
+  "masehi",
+  "maséhi",
+  "mawarna",
+  "medal",
+  "minab",
+  "mrasidayang",
+  "muputang",
+  "ngardi",
+  "ngicalang",
+  "nglanturang",
+  "ngulangunin",
+  "ngulati",
+  "nika",
+  "padem",
+  "paksi",
+  "palinggihan",
+  "pangiring",
+  "pangupadiri",
+  "pantaraning",
+  "papeson",
+  "payudan",
+  "pemilu",
+  "penghargaan",
+  "penyakit",
+  "perguruan",
+  "perjuangan",
+  "precaya",
+  "pribumi",
+  "puput",
+  "pura",
+  "rasa",
+  "rejang",
+  "ruh",
+  "rumasuk",
+  "saha",
+  "sajeroning",
+  "sasolahan",
+  "satua",
+  "satunggal",
+  "sawiréh",
+  "sembah",
+  "sex",
+  "sinamian",
+  "suling",
+  "swara",
+  "tatabuhan",
+  "tekén",
+  "tetamian",
+  "topeng",
+  "untat",
+  "utamannyané",
+  "utsaha",
+  "wagian",
+  "wentuk",
+  "wesya",
+  "woh-wohan",
+  "z",
+  "11.",
+  "13",
+  "16",
+  "17",
+  "1945",
+  "1962",
+  "1980",
+  "2004",
+  "2006",
+  "2014",
+  "2015",
+  "2019",
+  "23",
+  "24",
+  "732",
+  "81",
+  "886",
+  "9",
+  "97.",
+  "A.A.",
+  "Aceh-Nias",
+  "Adat",
+  "Afrika",
+  "Aga",
+  "Agama",
+  "Agung",
+  "Airi",
+  "Airlangga",
+  "Alit",
+  "Amerta",
+  "Amérika",
+  "Aqualtune",
+  "Atverstas",
+  "Aungan",
+  "Ayu",
+  "Bangli",
+  "Basa",
+  "Berkas",
+  "Besakih",
+  "Brahma",
+  "Brno",
+  "Bubníková",
+  "Buléléng",
+  "Dang",
+  "Daweg",
+  "Daérah",
+  "Denisa",
+  "Désak",
+  "Désémber",
+  "Déwi",
+  "Eksprési",
+  "Elsnicová",
+  "Fakultas",
+  "Gaguntangan",
+  "Galah",
+  "Ganésha",
+  "Geguritan",
+  "Geyser",
+  "Gradatie",
+  "Guru",
+  "Hautamäki",
+  "Hutan",
+  "Ilmu",
+  "International",
+  "Ipun",
+  "Irika",
+  "Jagaraga",
+  "Jakarta",
+  "Jelantik",
+  "Johor",
+  "Jumpai",
+  "Juni",
+  "Kabupatén",
+  "Kanada",
+  "Kapitu",
+  "Kartala",
+  "Kawéntenan",
+  "Kayu",
+  "Kebudayaan",
+  "Kebyar",
+  "Kecamatan",
+  "Kendran",
+  "Kerambitan",
+  "Kesiman",
+  "Ketah",
+  "Kota",
+  "Kuno",
+  "Lanus",
+  "Legong",
+  "Libéral",
+  "Majalaran",
+  "Malang",
+  "Malaysia",
+  "Malé",
+  "Mandara",
+  "Mantri",
+  "Melasti",
+  "Michaela",
+  "Médiaswari",
+  "Méi",
+  "Nanging",
+  "Nganti",
+  "Ngeninin",
+  "Ngurah",
+  "Oktober",
+  "Orti",
+  "PRI",
+  "Padang",
+  "Pak",
+  "Pamargi",
+  "Para",
+  "Parté",
+  "Patemon",
+  "Pemprov",
+  "Perguruan",
+  "Periode",
+  "Pidarta",
+  "Post",
+  "Pragina",
+  "Praktisi",
+  "Prasasti",
+  "Propinsi",
+  "Punika",
+  "Purnama",
+  "Purnama-Tilem",
+  "Pustaka",
+  "Péndidikan",
+  "RI",
+  "Rahwana",
+  "Raja",
+  "Rama",
+  "Rancage",
+  "Raris",
+  "Rejang",
+  "Rp50",
+  "Sanghyang",
+  "Sari",
+  "Satunggal",
+  "Seni",
+  "Sinah",
+  "Sioan",
+  "Siwa",
+  "Studi",
+  "Subak",
+  "Sugianto",
+  "Suwidja",
+  "Svatoňovice",
+  "Tatujon",
+  "Tel",
+  "The",
+  "Tjokorda",
+  "Téktékan",
+  "Třebíč",
+  "UB",
+  "URL",
+  "Vyno",
+  "Wakil",
+  "Warna",
+  "Wastan",
+  "Wewidangan",
+  "Wikipédia",
+  "Wimbakara",
+  "Wisnu",
+  "Yéning",
+  "a",
+  "akeh",
+  "aktif",
+  "alit",
+  "artos",
+  "asané",
+  "asapunika",
+  "asli",
+  "asri",
+  "bala",
+  "baos",
+  "bawi",
+  "baya",
+  "beburon",
+  "berkasnyané",
+  "bom",
+  "budaya",
+  "budayawan",
+  "buku",
+  "bupati",
+  "cakepan",
+  "campuhan",
+  "carita",
+  "cm",
+  "corah",
+  "cumpu",
+  "cutet",
+  "daerah",
+  "daging",
+  "dagingnyané",
+  "danau",
+  "data",
+  "dataran",
+  "de",
+  "di",
+  "digelis",
+  "digit",
+  "dingin",
+  "drama",
+  "drika",
+  "durung",
+  "gelah",
+  "génjék",
+  "géograpis",
+  "hak",
+  "ibunnyané",
+  "idup",
+  "ilmu",
+  "ineman",
+  "inggihnyané",
+  "inucap",
+  "janané",
+  "janma",
+  "jaran",
+  "jasa",
+  "jukut",
+  "juta",
+  "kaadegang",
+  "kabecikan",
+  "kaca",
+  "kacritayang",
+  "kadiksa",
+  "kadukung",
+  "kahanan",
+  "kaicalang",
+  "kaicénin",
+  "kaitung",
+  "kakawitin",
+  "kalanturang",
+  "kalindungin",
+  "kaloktah",
+  "kamodifikasi",
+  "kampanye",
+  "kapal",
+  "kapastika",
+  "kapikukuhang",
+  "kapilih",
+  "kaping",
+  "kapolihang",
+  "kapéndidikan",
+  "karang",
+  "karasukin",
+  "karauhan",
+  "kasatria",
+  "kasengguh",
+  "kasobyahang",
+  "kasumekenin",
+  "kasurat",
+  "katangiang",
+  "katutup",
+  "kaungguhang",
+  "kaweruhan",
+  "kawikanan",
+  "keanter",
+  "kedadosang",
+  "kelurahan",
+  "kembar",
+  "kemerdekaan",
+  "khas",
+  "klubas",
+  "km",
+  "lara",
+  "lebar",
+  "lingkungan",
+  "luas",
+  "lunak",
+  "lunga",
+  "lungsuran",
+  "lutung",
+  "luwih",
+  "mabaris",
+  "mabasa",
+  "mabusana",
+  "madaging",
+  "magingsir",
+  "makadi",
+  "makejang",
+  "malajahin",
+  "malancaran",
+  "malarapan",
+  "malinggih",
+  "mamanah",
+  "mangdané",
+  "margi",
+  "mas",
+  "masa",
+  "masaing",
+  "masan",
+  "masanding",
+  "matembang",
+  "matemu",
+  "matetujon",
+  "matuakan",
+  "mawali",
+  "mayuda",
+  "mbahak",
+  "medué",
+  "melajahin",
+  "mentas",
+  "merit",
+  "meuah",
+  "miara",
+  "milu",
+  "minakadi",
+  "miragiang",
+  "misinnyané",
+  "misinnyanï¿½",
+  "mlajah",
+  "modérn",
+  "muatang",
+  "méter",
+  "naenin",
+  "nampek",
+  "neatsako",
+  "negeri",
+  "nem",
+  "nerbitang",
+  "ngajeng",
+  "ngalaksanayang",
+  "ngamiletin",
+  "nganikayang",
+  "nganutin",
+  "ngaripta",
+  "ngawentuk",
+  "ngawit",
+  "ngelaksanayang",
+  "ngentosin",
+  "ngetisang",
+  "ngicénin",
+  "ngigel",
+  "nginem",
+  "nglaksanayang",
+  "nglawan",
+  "nglimbakang",
+  "ngripta",
+  "nguningin",
+  "ngwawa",
+  "nikayang",
+  "nincap",
+  "novél",
+  "nrima",
+  "nunas",
+  "nyalin",
+  "nyegah",
+  "nyengguh",
+  "nyihnayang",
+  "nï¿½nten",
+  "objek",
+  "pahpahan",
+  "paindikan",
+  "pakem",
+  "pakraman",
+  "palemahan",
+  "paling",
+  "pamahbah",
+  "pamilet",
+  "panganggén",
+  "pangapti",
+  "panitia",
+  "parekan",
+  "parerehanKaca",
+  "parilaksana",
+  "parinama",
+  "pasar",
+  "pasih",
+  "pasihé",
+  "pemangku",
+  "penerbitan",
+  "perangkat",
+  "perlu",
+  "perusahaan",
+  "petani",
+  "pidarta",
+  "pitutur",
+  "praginanyané",
+  "praginané",
+  "prefiks",
+  "program",
+  "promosi",
+  "puisi",
+  "puslapis",
+  "ragan",
+  "ragané",
+  "rasio",
+  "ratio",
+  "resmi",
+  "rusak",
+  "sadarana",
+  "sadurungné",
+  "sahananing",
+  "sai-sai",
+  "sakancan",
+  "salami",
+  "salanturnyané",
+  "satata",
+  "satia",
+  "sawatara",
+  "sayuwakti",
+  "secara",
+  "sesuratan",
+  "simbol",
+  "sios",
+  "siosan",
+  "sisi",
+  "situnggil",
+  "sor",
+  "stata",
+  "sulinggih",
+  "sumeken",
+  "sué",
+  "säv",
+  "séda",
+  "taru",
+};
+const uint16_t WA_FREQ_11_RANKS[] = {
+  869, 858, 0, 544, 540, 934, 0, 0, 609, 642, 0, 0, 903, 0, 0, 975,
+  988, 0, 0, 0, 482, 0, 0, 0, 0, 208, 0, 0, 0, 0, 236, 489,
+  590, 0, 0, 977, 369, 0, 0, 679, 666, 0, 125, 501, 0, 0, 388, 448,
+  185, 545, 552, 626, 417, 755, 593, 0, 0, 0, 0, 304, 354, 0, 256, 370,
+  651, 0, 0, 0, 578, 0, 0, 0, 430, 0, 915, 971, 111, 0, 0, 0,
+  926, 0, 0, 813, 566, 0, 0, 472, 0, 689, 0, 3, 0, 407, 622, 970,
+  0, 0, 0, 0, 0, 177, 0, 0, 0, 0, 0, 0, 610, 0, 0, 0,
+  636, 700, 0, 0, 63, 898, 0, 0, 128, 0, 0, 503, 537, 0, 296, 361,
+  475, 861, 0, 0, 0, 724, 392, 67, 91, 154, 483, 840, 936, 0, 0, 0,
+  0, 0, 0, 0, 0, 834, 0, 214, 336, 0, 0, 99, 0, 484, 0, 275,
+  0, 0, 138, 764, 141, 217, 553, 888, 0, 0, 157, 938, 0, 0, 0, 0,
+  0, 621, 605, 446, 572, 762, 0, 0, 0, 738, 0, 409, 54, 223, 0, 172,
+  105, 382, 389, 556, 802, 821, 0, 0, 0, 0, 0, 820, 0, 0, 0, 0,
+  0, 0, 173, 233, 158, 523, 539, 943, 0, 670, 0, 41, 0, 600, 46, 386,
+  634, 817, 957, 348, 297, 617, 804, 0, 151, 285, 376, 0, 810, 528, 0, 0,
+  557, 0, 0, 0, 0, 973, 0, 736, 0, 26, 0, 0, 451, 0, 752, 0,
+  0, 0, 780, 0, 0, 0, 161, 0, 188, 17, 0, 0, 876, 290, 760, 82,
+  0, 0, 0, 224, 452, 39, 295, 0, 431, 0, 654, 314, 220, 211, 433, 495,
+  753, 0, 551, 0, 232, 0, 778, 0, 0, 0, 956, 21, 824, 0, 663, 0,
+  0, 0, 0, 0, 0, 735, 0, 19, 508, 759, 0, 246, 0, 0, 0, 0,
+  515, 0, 101, 0, 460, 587, 624, 996, 0, 0, 108, 0, 0, 0, 908, 357,
+  0, 0, 0, 68, 0, 0, 928, 0, 0, 958, 0, 50, 506, 607, 374, 0,
+  0, 0, 0, 0, 0, 0, 0, 672, 542, 900, 0, 0, 0, 0, 0, 0,
+  0, 113, 0, 0, 0, 0, 0, 620, 0, 0, 0, 234, 573, 0, 10, 78,
+  277, 0, 702, 699, 777, 798, 905, 411, 0, 0, 0, 0, 143, 412, 0, 0,
+  727, 0, 0, 0, 75, 564, 575, 279, 884, 907, 930, 0, 271, 0, 160, 350,
+  0, 0, 0, 0, 0, 579, 0, 0, 0, 0, 0, 0, 0, 0, 708, 487,
+  502, 0, 44, 65, 199, 748, 998, 0, 646, 0, 0, 0, 0, 0, 895, 0,
+  0, 22, 0, 0, 696, 955, 0, 0, 0, 0, 0, 94, 0, 0, 231, 48,
+  492, 835, 0, 0, 0, 0, 0, 465, 445, 717, 425, 668, 549, 692, 979, 0,
+  589, 426, 12, 0, 0, 0, 0, 0, 176, 0, 0, 0, 0, 962, 0, 0,
+  851, 0, 131, 507, 360, 362, 815, 0, 0, 932, 250, 795, 859, 0, 0, 0,
+  0, 0, 0, 0, 685, 743, 0, 132, 24, 241, 254, 146, 653, 770, 288, 657,
+  179, 664, 872, 995, 0, 274, 0, 0, 0, 0, 531, 0, 0, 0, 0, 0,
+  92, 32, 832, 0, 897, 0, 0, 0, 878, 0, 961, 245, 567, 659, 726, 0,
+  486, 267, 0, 914, 0, 562, 0, 703, 306, 945, 0, 0, 0, 0, 0, 937,
+  187, 0, 0, 618, 488, 0, 197, 0, 0, 129, 687, 985, 739, 763, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 58, 201, 931, 0, 0, 767, 0, 980, 0,
+  0, 0, 927, 811, 514, 944, 0, 221, 0, 0, 0, 0, 0, 0, 0, 0,
+  784, 189, 0, 0, 0, 410, 0, 0, 805, 0, 0, 0, 0, 0, 0, 11,
+  520, 0, 0, 0, 255, 462, 935, 0, 316, 335, 0, 997, 0, 0, 0, 90,
+  7, 940, 461, 0, 538, 247, 265, 0, 0, 434, 144, 583, 880, 887, 0, 190,
+  228, 344, 972, 310, 0, 0, 0, 0, 0, 0, 0, 0, 0, 967, 0, 0,
+  0, 0, 629, 0, 596, 0, 0, 0, 0, 0, 178, 720, 0, 836, 0, 0,
+  273, 885, 331, 0, 0, 0, 533, 0, 0, 0, 0, 790, 509, 443, 582, 191,
+  0, 0, 385, 338, 827, 0, 0, 0, 0, 0, 0, 794, 652, 0, 340, 0,
+  0, 993, 120, 321, 464, 258, 72, 786, 852, 168, 0, 0, 0, 0, 0, 0,
+  0, 986, 0, 0, 0, 0, 0, 511, 0, 0, 614, 135, 628, 714, 307, 0,
+  0, 390, 0, 648, 0, 741, 712, 665, 0, 529, 453, 9, 152, 0, 0, 0,
+  0, 0, 0, 0, 281, 0, 0, 0, 0, 0, 305, 0, 0, 0, 0, 142,
+  916, 782, 0, 0, 159, 0, 0, 0, 0, 0, 98, 890, 421, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 558, 793, 373, 892, 200, 0, 0, 272, 0,
+  0, 0, 0, 0, 315, 799, 210, 0, 0, 0, 645, 0, 301, 355, 0, 608,
+  976, 0, 595, 0, 925, 983, 0, 730, 893, 0, 0, 97, 156, 395, 847, 981,
+  803, 0, 816, 0, 901, 0, 166, 0, 349, 0, 0, 480, 842, 0, 347, 359,
+  378, 746, 0, 0, 0, 149, 496, 89, 602, 0, 0, 0, 0, 655, 0, 0,
+  632, 894, 0, 0, 0, 122, 0, 60, 0, 0, 0, 525, 165, 0, 0, 658,
+  61, 788, 819, 0, 257, 286, 454, 114, 854, 0, 0, 0, 0, 0, 0, 688,
+  0, 397, 829, 974, 0, 239, 0, 76, 0, 479, 866, 0, 493, 13, 504, 754,
+  109, 662, 226, 0, 0, 435, 673, 34, 959, 0, 145, 341, 268, 467, 684, 0,
+  0, 153, 881, 1, 0, 0, 0, 215, 631, 723, 372, 844, 383, 686, 441, 918,
+  0, 0, 0, 0, 0, 0, 170, 276, 0, 0, 0, 0, 0, 218, 0, 0,
+  216, 0, 0, 678, 775, 0, 0, 606, 0, 0, 0, 0, 477, 147, 457, 731,
+  0, 0, 0, 195, 0, 656, 874, 406, 0, 225, 0, 0, 0, 0, 442, 0,
+  615, 0, 343, 725, 0, 0, 0, 107, 809, 0, 0, 0, 0, 0, 705, 0,
+  0, 0, 833, 400, 0, 270, 0, 0, 0, 0, 70, 0, 0, 0, 282, 0,
+  0, 320, 0, 263, 399, 612, 198, 982, 838, 853, 38, 0, 0, 53, 287, 541,
+  0, 0, 0, 27, 0, 0, 0, 0, 155, 289, 716, 0, 342, 560, 102, 110,
+  906, 0, 0, 0, 0, 0, 500, 0, 346, 0, 0, 0, 565, 171, 0, 259,
+  0, 499, 0, 64, 308, 476, 828, 85, 0, 0, 674, 0, 77, 468, 206, 230,
+  0, 0, 0, 761, 0, 0, 0, 0, 311, 0, 0, 0, 84, 439, 36, 368,
+  613, 136, 408, 849, 0, 15, 637, 751, 776, 0, 0, 857, 0, 55, 923, 0,
+  0, 86, 183, 0, 0, 0, 0, 0, 554, 774, 619, 0, 42, 0, 800, 0,
+  415, 52, 302, 490, 889, 992, 79, 0, 299, 0, 856, 781, 329, 18, 0, 704,
+  0, 0, 729, 174, 879, 0, 949, 83, 650, 0, 0, 0, 0, 0, 747, 823,
+  0, 0, 0, 0, 801, 0, 697, 405, 0, 202, 0, 0, 0, 0, 0, 0,
+  570, 438, 0, 580, 0, 0, 2, 0, 0, 0, 0, 0, 0, 536, 0, 978,
+  709, 630, 680, 0, 0, 291, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 728, 594, 0, 318, 0, 212, 0, 510, 0, 0, 0, 839, 0, 0, 0,
+  0, 242, 0, 0, 0, 0, 0, 0, 0, 193, 864, 0, 0, 0, 0, 0,
+  0, 133, 322, 353, 51, 423, 139, 455, 625, 706, 871, 933, 0, 0, 0, 0,
+  28, 676, 722, 106, 447, 103, 0, 0, 0, 0, 473, 0, 284, 81, 43, 886,
+  471, 251, 965, 0, 561, 4, 498, 534, 0, 960, 0, 182, 694, 0, 0, 521,
+  601, 283, 0, 402, 333, 485, 597, 0, 647, 0, 559, 0, 401, 701, 459, 0,
+  818, 964, 0, 0, 0, 0, 0, 649, 984, 0, 0, 0, 0, 0, 0, 0,
+  912, 0, 0, 115, 0, 0, 112, 266, 721, 768, 0, 0, 891, 0, 0, 126,
+  264, 0, 0, 56, 130, 432, 0, 180, 830, 948, 0, 379, 0, 0, 812, 769,
+  910, 0, 519, 0, 0, 0, 0, 0, 0, 0, 0, 375, 57, 209, 0, 0,
+  0, 0, 0, 691, 0, 73, 0, 124, 0, 0, 0, 0, 860, 675, 635, 95,
+  734, 598, 0, 0, 0, 0, 0, 711, 0, 0, 0, 0, 0, 0, 470, 0,
+  0, 0, 0, 991, 317, 252, 0, 59, 192, 0, 896, 0, 953, 0, 93, 235,
+  643, 0, 0, 237, 303, 745, 0, 0, 546, 0, 0, 0, 952, 0, 0, 0,
+  119, 0, 574, 0, 0, 911, 0, 599, 0, 437, 0, 789, 535, 845, 966, 127,
+  323, 987, 0, 548, 30, 922, 0, 0, 867, 69, 6, 494, 522, 677, 0, 0,
+  616, 0, 512, 117, 831, 877, 0, 0, 0, 356, 797, 524, 0, 718, 792, 416,
+  278, 0, 0, 0, 429, 0, 0, 0, 123, 904, 517, 204, 497, 681, 969, 280,
+  555, 0, 229, 865, 140, 0, 683, 586, 719, 765, 569, 469, 850, 951, 0, 330,
+  0, 0, 169, 351, 0, 855, 0, 0, 0, 0, 47, 568, 0, 45, 394, 0,
+  0, 0, 213, 14, 404, 0, 363, 0, 292, 732, 96, 0, 0, 0, 0, 367,
+  440, 0, 293, 0, 581, 0, 0, 0, 8, 550, 0, 946, 0, 0, 238, 0,
+  0, 384, 710, 427, 942, 100, 939, 0, 0, 391, 941, 0, 80, 0, 0, 0,
+  0, 456, 0, 137, 571, 0, 0, 458, 0, 33, 0, 0, 698, 779, 0, 737,
+  0, 0, 0, 883, 999, 222, 474, 695, 756, 787, 750, 909, 0, 0, 0, 31,
+  0, 0, 0, 0, 337, 403, 0, 0, 0, 0, 422, 682, 757, 0, 0, 807,
+  0, 638, 121, 0, 380, 294, 526, 822, 327, 862, 352, 0, 640, 0, 0, 785,
+  0, 449, 577, 0, 0, 0, 249, 611, 899, 848, 0, 0, 164, 0, 0, 148,
+  0, 0, 505, 0, 377, 0, 0, 1000, 0, 313, 846, 88, 0, 0, 0, 0,
+  924, 0, 742, 339, 0, 419, 990, 733, 227, 0, 0, 0, 25, 690, 0, 29,
+  0, 0, 563, 0, 371, 0, 0, 0, 902, 947, 968, 0, 0, 0, 0, 0,
+  312, 0, 0, 387, 0, 0, 0, 0, 0, 0, 843, 0, 66, 0, 825, 203,
+  806, 0, 413, 240, 913, 0, 0, 0, 667, 771, 516, 0, 0, 0, 205, 326,
+  0, 365, 0, 334, 0, 0, 491, 870, 0, 0, 0, 0, 0, 0, 0, 0,
+  71, 627, 633, 917, 518, 530, 950, 319, 328, 882, 623, 863, 219, 0, 0, 0,
+  0, 841, 0, 104, 116, 243, 194, 875, 0, 0, 671, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 450, 0, 0, 0, 0, 0, 0, 0, 641, 0, 20, 639,
+  398, 713, 920, 0, 0, 0, 0, 0, 253, 244, 0, 324, 0, 0, 0, 588,
+  954, 0, 463, 0, 300, 837, 0, 0, 0, 0, 167, 325, 345, 532, 0, 0,
+  0, 381, 715, 0, 0, 0, 0, 603, 0, 0, 0, 396, 0, 364, 0, 0,
+  207, 0, 994, 0, 181, 0, 0, 0, 0, 87, 963, 766, 0, 707, 0, 0,
+  0, 0, 0, 0, 513, 808, 0, 543, 0, 0, 196, 420, 481, 693, 428, 248,
+  0, 0, 0, 162, 414, 0, 0, 0, 0, 591, 0, 0, 62, 644, 791, 796,
+  49, 298, 744, 0, 0, 592, 0, 0, 0, 0, 0, 35, 585, 0, 269, 0,
+  0, 0, 0, 0, 0, 332, 393, 175, 436, 118, 773, 0, 0, 0, 0, 0,
+  0, 23, 740, 0, 309, 366, 478, 758, 358, 0, 0, 0, 989, 0, 0, 0,
+  0, 772, 873, 826, 40, 150, 0, 814, 527, 0, 0, 184, 260, 16, 261, 576,
+  604, 547, 783, 868, 921, 0, 37, 749, 0, 0, 0, 0, 0, 0, 418, 0,
+  669, 186, 0, 0, 74, 134, 424, 661, 262, 0, 0, 919, 0, 0, 0, 0,
+  0, 5, 444, 0, 0, 0, 0, 929, 0, 0, 0, 0, 163, 466, 584, 660,
+};
+
+const char *WA_FREQ_12_TOKENS[] = {
+  "да",
+  "е",
+  "не",
+  "се",
+  "и",
+  "на",
+  "си",
+  "за",
+  "ще",
+  "че",
+  "това",
+  "ли",
+  "в",
+  "ти",
+  "от",
+  "ми",
+  "с",
+  "какво",
+  "го",
+  "съм",
+  "но",
+  "аз",
+  "те",
+  "трябва",
+  "добре",
+  "ме",
+  "са",
+  "няма",
+  "може",
+  "ако",
+  "тук",
+  "така",
+  "а",
+  "ви",
+  "като",
+  "много",
+  "той",
+  "по",
+  "има",
+  "беше",
+  "нещо",
+  "му",
+  "как",
+  "защо",
+  "ни",
+  "я",
+  "знам",
+  "само",
+  "всичко",
+  "мен",
+  "сега",
+  "теб",
+  "тя",
+  "което",
+  "искам",
+  "мога",
+  "още",
+  "когато",
+  "до",
+  "ги",
+  "този",
+  "просто",
+  "сте",
+  "или",
+  "къде",
+  "би",
+  "тази",
+  "всички",
+  "благодаря",
+  "нали",
+  "сме",
+  "нищо",
+  "толкова",
+  "знаеш",
+  "един",
+  "защото",
+  "след",
+  "там",
+  "време",
+  "който",
+  "искаш",
+  "мисля",
+  "кой",
+  "малко",
+  "имам",
+  "преди",
+  "хайде",
+  "вече",
+  "тези",
+  "моля",
+  "о",
+  "някой",
+  "каза",
+  "него",
+  "наистина",
+  "ние",
+  "вие",
+  "които",
+  "й",
+  "повече",
+  "съжалявам",
+  "тогава",
+  "точно",
+  "става",
+  "все",
+  "можеш",
+  "една",
+  "имаш",
+  "към",
+  "без",
+  "колко",
+  "кажа",
+  "никога",
+  "при",
+  "човек",
+  "работа",
+  "им",
+  "ден",
+  "едно",
+  "бях",
+  "бъде",
+  "през",
+  "ето",
+  "значи",
+  "със",
+  "дори",
+  "хора",
+  "път",
+  "както",
+  "нас",
+  "г-н",
+  "години",
+  "бил",
+  "баща",
+  "правиш",
+  "която",
+  "разбира",
+  "също",
+  "мислиш",
+  "вас",
+  "ами",
+  "нея",
+  "направи",
+  "винаги",
+  "докато",
+  "имаме",
+  "виж",
+  "всеки",
+  "иска",
+  "майка",
+  "казах",
+  "нека",
+  "хората",
+  "хей",
+  "жена",
+  "видя",
+  "дали",
+  "във",
+  "никой",
+  "пак",
+  "тях",
+  "направя",
+  "неща",
+  "кажи",
+  "място",
+  "заради",
+  "прави",
+  "сър",
+  "можем",
+  "дяволите",
+  "изглежда",
+  "днес",
+  "кажеш",
+  "живота",
+  "трябваше",
+  "отново",
+  "татко",
+  "няколко",
+  "наред",
+  "боже",
+  "друг",
+  "здравей",
+  "затова",
+  "бих",
+  "доста",
+  "обичам",
+  "пари",
+  "знае",
+  "начин",
+  "моя",
+  "мислех",
+  "по-добре",
+  "нужда",
+  "сам",
+  "две",
+  "дойде",
+  "заедно",
+  "добър",
+  "ела",
+  "нямам",
+  "приятел",
+  "после",
+  "видим",
+  "правя",
+  "вечер",
+  "достатъчно",
+  "всъщност",
+  "исках",
+  "проблем",
+  "живот",
+  "нещата",
+  "под",
+  "каквото",
+  "говори",
+  "разбирам",
+  "сигурно",
+  "чакай",
+  "веднага",
+  "ей",
+  "три",
+  "какъв",
+  "казва",
+  "стана",
+  "утре",
+  "дай",
+  "добро",
+  "знаете",
+  "говоря",
+  "била",
+  "предвид",
+  "казвам",
+  "колата",
+  "имате",
+  "себе",
+  "момиче",
+  "мамо",
+  "стане",
+  "харесва",
+  "случи",
+  "нощ",
+  "било",
+  "работата",
+  "каква",
+  "говориш",
+  "бе",
+  "сигурен",
+  "искате",
+  "скъпа",
+  "пред",
+  "били",
+  "между",
+  "друго",
+  "моята",
+  "част",
+  "стига",
+  "направим",
+  "имаше",
+  "освен",
+  "мой",
+  "двамата",
+  "кога",
+  "бяха",
+  "върна",
+  "някои",
+  "мъж",
+  "момчета",
+  "бързо",
+  "където",
+  "извинете",
+  "името",
+  "виждам",
+  "у",
+  "бъда",
+  "парите",
+  "видях",
+  "хубаво",
+  "скоро",
+  "помогна",
+  "остави",
+  "дни",
+  "поне",
+  "такъв",
+  "здрасти",
+  "направиш",
+  "часа",
+  "два",
+  "брат",
+  "добра",
+  "ясно",
+  "знаех",
+  "радвам",
+  "нямаше",
+  "деца",
+  "взема",
+  "то",
+  "около",
+  "момче",
+  "щом",
+  "приятели",
+  "времето",
+  "минути",
+  "правим",
+  "колкото",
+  "първо",
+  "други",
+  "спри",
+  "страна",
+  "работи",
+  "помощ",
+  "могат",
+  "нито",
+  "върви",
+  "господи",
+  "твоя",
+  "предполагам",
+  "момент",
+  "направил",
+  "чудесно",
+  "година",
+  "здравейте",
+  "знаем",
+  "срещу",
+  "можете",
+  "главата",
+  "случай",
+  "имат",
+  "кажете",
+  "вътре",
+  "къщата",
+  "твърде",
+  "трудно",
+  "дома",
+  "пъти",
+  "дете",
+  "значение",
+  "означава",
+  "почти",
+  "идея",
+  "име",
+  "света",
+  "д-р",
+  "човече",
+  "дъщеря",
+  "децата",
+  "такива",
+  "въпрос",
+  "върху",
+  "мамка",
+  "голяма",
+  "казваш",
+  "страхотно",
+  "момента",
+  "давай",
+  "вероятно",
+  "говорим",
+  "прав",
+  "вкъщи",
+  "веднъж",
+  "какви",
+  "истината",
+  "сериозно",
+  "всяка",
+  "кого",
+  "идва",
+  "откъде",
+  "щеше",
+  "вървим",
+  "май",
+  "надявам",
+  "такова",
+  "виждаш",
+  "отида",
+  "семейството",
+  "обади",
+  "сестра",
+  "мама",
+  "понякога",
+  "мисли",
+  "вземи",
+  "над",
+  "направих",
+  "искаше",
+  "чувствам",
+  "каже",
+  "възможно",
+  "де",
+  "полицията",
+  "свят",
+  "среща",
+  "моят",
+  "земята",
+  "напълно",
+  "намери",
+  "лошо",
+  "вярно",
+  "даде",
+  "извинявай",
+  "седмица",
+  "мъртъв",
+  "видиш",
+  "чух",
+  "слушай",
+  "искал",
+  "бог",
+  "голям",
+  "казал",
+  "дам",
+  "твоята",
+  "час",
+  "града",
+  "сигурна",
+  "тръгваме",
+  "коя",
+  "всичките",
+  "готов",
+  "странно",
+  "някога",
+  "пък",
+  "вратата",
+  "цялата",
+  "сякаш",
+  "свърши",
+  "училище",
+  "по-късно",
+  "искат",
+  "моето",
+  "поговорим",
+  "такава",
+  "семейство",
+  "смъртта",
+  "сама",
+  "ръцете",
+  "разбираш",
+  "имах",
+  "вярвам",
+  "бяхме",
+  "син",
+  "очите",
+  "телефона",
+  "другите",
+  "нямаш",
+  "скъпи",
+  "моите",
+  "вижте",
+  "сърцето",
+  "мястото",
+  "бъдеш",
+  "зад",
+  "щях",
+  "разбрах",
+  "джон",
+  "месеца",
+  "проблеми",
+  "според",
+  "пет",
+  "мислите",
+  "прекалено",
+  "кола",
+  "двама",
+  "погледни",
+  "намеря",
+  "правят",
+  "дълго",
+  "някъде",
+  "г",
+  "някакъв",
+  "цялото",
+  "лесно",
+  "виждал",
+  "звучи",
+  "оттук",
+  "край",
+  "любов",
+  "онзи",
+  "дума",
+  "чао",
+  "кое",
+  "обратно",
+  "познавам",
+  "струва",
+  "шанс",
+  "някого",
+  "отколкото",
+  "друга",
+  "нашата",
+  "история",
+  "пътя",
+  "отиде",
+  "вода",
+  "същото",
+  "спокойно",
+  "получи",
+  "джак",
+  "случило",
+  "ало",
+  "връзка",
+  "помогне",
+  "долара",
+  "тялото",
+  "правите",
+  "стаята",
+  "право",
+  "късно",
+  "долу",
+  "нашите",
+  "превод",
+  "причина",
+  "бъдат",
+  "стая",
+  "къща",
+  "остана",
+  "затвора",
+  "отидем",
+  "намерим",
+  "супер",
+  "номер",
+  "важно",
+  "края",
+  "изглеждаш",
+  "ужасно",
+  "започна",
+  "приятно",
+  "помниш",
+  "искаме",
+  "цял",
+  "отивам",
+  "съвсем",
+  "някаква",
+  "живее",
+  "тръгвам",
+  "нямаме",
+  "бъди",
+  "въпреки",
+  "убие",
+  "идвам",
+  "глупости",
+  "стой",
+  "казват",
+  "изобщо",
+  "лицето",
+  "повярвам",
+  "види",
+  "нов",
+  "разбра",
+  "трябвало",
+  "целия",
+  "дойда",
+  "готови",
+  "седмици",
+  "работя",
+  "първи",
+  "против",
+  "що",
+  "снощи",
+  "жив",
+  "дойдеш",
+  "кръв",
+  "далеч",
+  "недей",
+  "пука",
+  "добри",
+  "права",
+  "зле",
+  "момичета",
+  "опитвам",
+  "двете",
+  "обадя",
+  "жени",
+  "явно",
+  "истински",
+  "мъже",
+  "сигурност",
+  "лека",
+  "обича",
+  "информация",
+  "върне",
+  "сутрин",
+  "правилно",
+  "дръж",
+  "късмет",
+  "сутринта",
+  "току-що",
+  "малка",
+  "страх",
+  "обичаш",
+  "мина",
+  "навън",
+  "знаят",
+  "сина",
+  "можеше",
+  "четири",
+  "случва",
+  "станало",
+  "човека",
+  "общо",
+  "иначе",
+  "утро",
+  "г-жо",
+  "нова",
+  "родителите",
+  "когото",
+  "грешка",
+  "пусни",
+  "горе",
+  "насам",
+  "ръката",
+  "почакай",
+  "агент",
+  "храна",
+  "нужно",
+  "чичо",
+  "секс",
+  "малък",
+  "харесвам",
+  "избор",
+  "имал",
+  "убия",
+  "определено",
+  "никого",
+  "очевидно",
+  "оставя",
+  "намерих",
+  "разбера",
+  "град",
+  "ню",
+  "близо",
+  "господа",
+  "вчера",
+  "можех",
+  "едва",
+  "направо",
+  "детето",
+  "забрави",
+  "вечеря",
+  "цяла",
+  "ок",
+  "убил",
+  "дошъл",
+  "вместо",
+  "онази",
+  "гледам",
+  "отвори",
+  "хареса",
+  "историята",
+  "игра",
+  "познаваш",
+  "първата",
+  "любовта",
+  "дом",
+  "браво",
+  "план",
+  "тръгна",
+  "гледай",
+  "особено",
+  "твоите",
+  "момичето",
+  "готова",
+  "дойдох",
+  "смисъл",
+  "истина",
+  "някакви",
+  "забавно",
+  "взе",
+  "майкъл",
+  "представа",
+  "отиваш",
+  "спрете",
+  "кафе",
+  "госпожо",
+  "излезе",
+  "твоето",
+  "върнем",
+  "война",
+  "дошли",
+  "чарли",
+  "съпруга",
+  "вид",
+  "ръка",
+  "честно",
+  "промени",
+  "шест",
+  "умре",
+  "джо",
+  "дядо",
+  "последните",
+  "животът",
+  "онова",
+  "врата",
+  "ръце",
+  "досега",
+  "нашия",
+  "господин",
+  "въпроса",
+  "върнеш",
+  "казаха",
+  "господине",
+  "живея",
+  "внимавай",
+  "навсякъде",
+  "мразя",
+  "смърт",
+  "хиляди",
+  "бога",
+  "помислих",
+  "голямо",
+  "трябват",
+  "месец",
+  "довиждане",
+  "невероятно",
+  "красива",
+  "върни",
+  "лично",
+  "казвай",
+  "та",
+  "наоколо",
+  "вашата",
+  "ваше",
+  "даже",
+  "покажа",
+  "назад",
+  "приятелка",
+  "кара",
+  "нощта",
+  "спаси",
+  "извън",
+  "довечера",
+  "въпроси",
+  "бива",
+  "възможност",
+  "онези",
+  "чувстваш",
+  "убийство",
+  "луд",
+  "пич",
+  "зная",
+  "напред",
+  "другата",
+  "бъдем",
+  "вземем",
+  "знаеше",
+  "интересува",
+  "помня",
+  "очи",
+  "тате",
+  "обещавам",
+  "ред",
+  "успокой",
+  "думи",
+  "тъй",
+  "помогнеш",
+  "отидеш",
+  "случая",
+  "бизнес",
+  "вземеш",
+  "тъкмо",
+  "момчето",
+  "грижа",
+  "опита",
+  "чу",
+  "повечето",
+  "внимание",
+  "капитане",
+  "тревожи",
+  "тип",
+  "отдавна",
+  "прекрасно",
+  "често",
+  "никакви",
+  "имало",
+  "вземе",
+  "г-жа",
+  "деня",
+  "чакам",
+  "започва",
+  "твой",
+  "по-бързо",
+  "ама",
+  "разбере",
+  "майк",
+  "оръжие",
+  "йорк",
+  "твоят",
+  "остане",
+  "откакто",
+  "том",
+  "разберем",
+  "леглото",
+  "човекът",
+  "кои",
+  "следващия",
+  "пише",
+  "държи",
+  "приятелите",
+  "всяко",
+  "чака",
+  "щастлив",
+  "някоя",
+  "сила",
+  "питам",
+  "отиваме",
+  "болницата",
+  "новини",
+  "боли",
+  "чуй",
+  "постоянно",
+  "работиш",
+  "по-малко",
+  "сара",
+  "прилича",
+  "използва",
+  "шефе",
+  "води",
+  "обикновено",
+  "пази",
+  "уби",
+  "нови",
+  "франк",
+  "ох",
+  "вашите",
+  "сами",
+  "ново",
+  "офиса",
+  "останалите",
+  "бебето",
+  "елате",
+  "коледа",
+  "чест",
+  "синът",
+  "реших",
+  "дами",
+  "играта",
+  "задник",
+  "престани",
+  "идват",
+  "сложи",
+  "жената",
+  "разбереш",
+  "мили",
+  "миналата",
+  "намериш",
+  "кажем",
+  "жените",
+  "връщам",
+  "бъдете",
+  "големи",
+  "водата",
+  "хубава",
+  "търся",
+  "идиот",
+  "направила",
+  "удоволствие",
+  "вярваш",
+  "мерси",
+  "взех",
+  "различни",
+  "единственият",
+  "искала",
+  "решение",
+  "ваша",
+  "филм",
+  "доктор",
+  "капитан",
+  "задника",
+  "гледаш",
+  "дейвид",
+  "полицай",
+  "къщи",
+  "търси",
+  "слушам",
+  "мое",
+  "докторе",
+  "рано",
+  "по-рано",
+  "говорите",
+  "нашият",
+  "млъкни",
+  "липсва",
+  "носи",
+  "накара",
+  "вземете",
+  "оправи",
+  "другото",
+  "съобщение",
+  "джордж",
+  "спре",
+  "чувства",
+  "детектив",
+  "малки",
+  "живееш",
+  "страната",
+  "седни",
+  "помогни",
+  "държа",
+  "парти",
+  "милиона",
+  "тръгвай",
+  "o",
+  "своя",
+  "помисли",
+  "оправя",
+  "казала",
+  "адвокат",
+  "видял",
+  "махни",
+  "краката",
+  "хенри",
+  "кораб",
+  "отива",
+  "убиец",
+  "куче",
+  "г-це",
+  "остава",
+  "първия",
+  "могъл",
+  "десет",
+  "видите",
+  "убийството",
+  "готово",
+  "копеле",
+  "помогнете",
+  "снимки",
+  "появи",
+  "чуваш",
+  "войната",
+  "проблемът",
+  "майната",
+  "обаче",
+  "държиш",
+  "бихте",
+  "махай",
+  "бяхте",
+  "подобно",
+  "отговори",
+  "дава",
+  "например",
+  "мила",
+  "ходя",
+  "бен",
+  "удари",
+  "глупак",
+  "кръвта",
+  "чрез",
+  "баба",
+  "секунда",
+  "последната",
+  "места",
+  "интересно",
+  "група",
+  "оставете",
+  "дани",
+  "лош",
+  "стар",
+  "завинаги",
+  "първият",
+  "идваш",
+  "нашето",
+  "джей",
+  "устата",
+  "снимка",
+  "опитва",
+  "компания",
+  "чакайте",
+  "бебе",
+  "дано",
+  "началото",
+  "абсолютно",
+  "лице",
+  "смешно",
+  "мислят",
+  "справя",
+  "останеш",
+  "питър",
+  "америка",
+  "дайте",
+  "мъртва",
+  "виновен",
+  "вижда",
+  "джеймс",
+  "минута",
+  "души",
+  "лъжа",
+  "секунди",
+  "следващата",
+  "контрол",
+  "тайна",
+  "изпрати",
+  "внимателно",
+  "виждате",
+  "макс",
+  "вината",
+  "опитах",
+  "оръжието",
+  "номера",
+  "накрая",
+  "притеснявай",
+  "неговата",
+  "единственото",
+  "опит",
+  "подарък",
+  "чуя",
+};
+const uint16_t WA_FREQ_12_RANKS[] = {
+  780, 800, 150, 863, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  194, 331, 248, 0, 0, 581, 0, 0, 689, 0, 692, 0, 604, 733, 874, 0,
+  0, 0, 183, 94, 542, 0, 0, 556, 596, 0, 0, 0, 0, 84, 0, 0,
+  0, 81, 794, 0, 0, 0, 0, 114, 821, 0, 0, 0, 0, 0, 0, 0,
+  0, 268, 660, 206, 209, 193, 108, 350, 489, 514, 765, 772, 812, 933, 992, 447,
+  21, 58, 756, 442, 778, 728, 423, 91, 862, 0, 758, 0, 0, 0, 0, 0,
+  615, 672, 884, 0, 901, 0, 415, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 36, 0, 0, 0, 0, 275, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 57, 149, 296, 713, 729, 548, 446, 982, 0, 549, 0, 0, 0,
+  507, 0, 0, 574, 530, 0, 0, 638, 0, 0, 0, 0, 0, 493, 0, 0,
+  0, 48, 0, 186, 0, 0, 332, 616, 922, 0, 526, 137, 529, 117, 357, 497,
+  64, 518, 641, 785, 793, 792, 140, 145, 154, 280, 261, 798, 850, 937, 0, 0,
+  0, 0, 0, 0, 0, 900, 0, 127, 795, 0, 338, 0, 0, 387, 69, 444,
+  881, 0, 0, 0, 0, 0, 0, 0, 83, 506, 0, 570, 477, 882, 0, 0,
+  0, 0, 0, 0, 920, 0, 0, 0, 0, 802, 858, 870, 969, 0, 852, 889,
+  637, 0, 745, 0, 0, 0, 0, 697, 0, 0, 0, 0, 833, 956, 690, 628,
+  0, 0, 623, 0, 0, 653, 763, 0, 0, 783, 823, 774, 0, 346, 0, 103,
+  269, 610, 0, 133, 0, 0, 711, 0, 315, 199, 0, 605, 0, 0, 265, 485,
+  995, 0, 0, 38, 0, 224, 0, 0, 0, 0, 0, 0, 104, 0, 0, 0,
+  222, 0, 481, 15, 179, 0, 498, 0, 0, 266, 0, 0, 7, 636, 142, 0,
+  0, 174, 439, 0, 0, 0, 0, 682, 0, 0, 703, 328, 0, 0, 0, 650,
+  364, 642, 0, 0, 813, 0, 0, 0, 0, 0, 0, 0, 0, 130, 371, 576,
+  0, 233, 270, 301, 468, 534, 19, 562, 33, 805, 972, 0, 0, 435, 0, 619,
+  250, 976, 958, 0, 0, 0, 0, 0, 891, 997, 107, 761, 0, 152, 392, 0,
+  0, 0, 0, 0, 894, 0, 0, 0, 865, 584, 0, 0, 282, 288, 290, 895,
+  986, 121, 566, 325, 408, 0, 0, 0, 0, 0, 320, 0, 0, 820, 734, 0,
+  0, 0, 0, 112, 0, 669, 666, 560, 456, 314, 0, 0, 0, 0, 76, 321,
+  335, 102, 409, 443, 565, 0, 101, 342, 273, 359, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 427, 0, 0, 397, 0, 0, 355, 0, 0, 739, 0, 0,
+  839, 844, 975, 500, 0, 0, 0, 0, 0, 178, 243, 253, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 316, 372, 201, 410, 378, 0, 0, 0, 512, 124, 588,
+  667, 890, 0, 293, 0, 0, 0, 122, 0, 0, 0, 0, 106, 221, 531, 0,
+  0, 0, 725, 495, 803, 0, 433, 0, 0, 0, 0, 0, 165, 670, 284, 180,
+  471, 475, 0, 5, 819, 606, 0, 24, 97, 0, 621, 0, 0, 699, 827, 860,
+  0, 391, 0, 0, 0, 96, 561, 0, 0, 871, 726, 0, 744, 825, 0, 691,
+  816, 790, 0, 695, 608, 0, 0, 0, 0, 0, 0, 979, 0, 0, 0, 0,
+  0, 62, 632, 0, 0, 0, 0, 0, 591, 239, 0, 0, 0, 164, 769, 797,
+  0, 144, 218, 655, 403, 297, 88, 0, 0, 0, 0, 0, 539, 0, 551, 0,
+  0, 770, 0, 0, 0, 0, 0, 0, 537, 0, 0, 0, 0, 0, 45, 484,
+  208, 786, 916, 0, 0, 0, 0, 0, 298, 460, 82, 993, 87, 0, 467, 784,
+  0, 0, 0, 0, 246, 421, 202, 0, 522, 731, 0, 893, 0, 0, 0, 0,
+  173, 533, 0, 609, 255, 999, 0, 79, 422, 721, 766, 482, 925, 990, 135, 141,
+  0, 341, 334, 873, 0, 0, 796, 714, 0, 238, 143, 0, 0, 0, 0, 943,
+  0, 0, 0, 0, 0, 981, 0, 0, 0, 0, 0, 0, 684, 854, 0, 991,
+  906, 0, 0, 0, 0, 0, 0, 0, 0, 806, 0, 0, 204, 0, 0, 0,
+  0, 0, 0, 840, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  510, 633, 0, 0, 0, 0, 0, 367, 136, 168, 791, 932, 0, 0, 0, 0,
+  902, 0, 0, 0, 0, 954, 0, 0, 448, 0, 578, 587, 0, 0, 0, 274,
+  868, 883, 930, 0, 309, 0, 0, 741, 67, 0, 0, 0, 0, 401, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 614, 0, 0, 252, 0,
+  0, 897, 0, 0, 0, 0, 0, 0, 285, 98, 0, 0, 974, 0, 0, 0,
+  0, 987, 0, 0, 0, 0, 0, 0, 0, 0, 0, 47, 0, 0, 0, 0,
+  330, 305, 869, 0, 0, 54, 71, 105, 0, 0, 1, 776, 0, 0, 0, 400,
+  593, 828, 968, 0, 0, 912, 125, 589, 413, 324, 949, 0, 0, 437, 464, 0,
+  0, 631, 0, 300, 0, 0, 0, 0, 73, 167, 0, 0, 0, 405, 886, 998,
+  851, 0, 0, 0, 0, 0, 0, 22, 286, 0, 0, 688, 0, 880, 329, 155,
+  61, 935, 978, 0, 352, 0, 0, 0, 0, 0, 0, 0, 163, 546, 25, 580,
+  0, 0, 407, 0, 569, 93, 0, 0, 0, 50, 160, 538, 123, 519, 52, 131,
+  234, 841, 198, 753, 909, 989, 0, 0, 600, 0, 166, 0, 212, 582, 836, 0,
+  0, 0, 0, 0, 0, 100, 808, 630, 8, 51, 236, 965, 0, 617, 0, 0,
+  622, 814, 0, 0, 0, 138, 0, 0, 0, 629, 980, 0, 0, 317, 0, 511,
+  872, 0, 0, 0, 12, 175, 370, 276, 644, 0, 964, 0, 0, 698, 172, 543,
+  717, 0, 260, 647, 227, 299, 0, 29, 0, 0, 0, 0, 214, 0, 0, 0,
+  226, 0, 0, 0, 702, 90, 520, 256, 945, 0, 0, 0, 0, 0, 450, 0,
+  366, 434, 170, 171, 0, 0, 0, 0, 207, 0, 0, 0, 16, 0, 271, 376,
+  0, 380, 671, 0, 0, 0, 528, 358, 915, 0, 344, 454, 0, 502, 496, 618,
+  944, 748, 830, 0, 0, 132, 740, 0, 0, 0, 903, 719, 41, 781, 195, 876,
+  393, 553, 595, 272, 848, 864, 474, 0, 952, 957, 0, 0, 0, 169, 0, 0,
+  678, 310, 941, 0, 0, 354, 887, 918, 182, 196, 323, 340, 177, 0, 0, 0,
+  0, 0, 0, 963, 0, 0, 322, 936, 960, 0, 0, 0, 0, 0, 0, 418,
+  0, 654, 0, 634, 0, 0, 0, 0, 0, 0, 11, 27, 601, 742, 0, 0,
+  0, 0, 568, 0, 651, 77, 78, 737, 0, 0, 0, 46, 625, 911, 942, 0,
+  0, 0, 0, 0, 49, 0, 327, 386, 523, 773, 262, 892, 0, 927, 0, 13,
+  68, 184, 675, 379, 445, 9, 360, 708, 710, 0, 362, 217, 547, 867, 303, 0,
+  0, 598, 705, 34, 0, 0, 0, 0, 0, 0, 0, 696, 0, 0, 501, 0,
+  0, 646, 0, 0, 30, 0, 0, 402, 0, 0, 479, 552, 701, 307, 680, 139,
+  948, 0, 44, 0, 0, 0, 0, 0, 0, 571, 277, 677, 674, 704, 0, 0,
+  658, 970, 2, 487, 879, 940, 80, 831, 971, 994, 394, 0, 0, 0, 0, 649,
+  0, 257, 0, 0, 0, 947, 0, 0, 0, 244, 856, 161, 0, 0, 235, 0,
+  0, 28, 0, 267, 0, 0, 681, 0, 0, 0, 885, 0, 709, 0, 0, 0,
+  0, 0, 0, 0, 304, 72, 259, 339, 590, 832, 74, 251, 962, 706, 0, 0,
+  707, 0, 0, 0, 0, 0, 0, 0, 572, 0, 0, 0, 363, 0, 373, 17,
+  859, 921, 86, 0, 0, 278, 396, 0, 0, 535, 390, 0, 0, 0, 643, 0,
+  928, 743, 0, 0, 0, 0, 0, 55, 60, 513, 351, 412, 381, 466, 431, 662,
+  263, 0, 0, 0, 0, 200, 657, 31, 0, 438, 0, 242, 751, 0, 463, 0,
+  0, 0, 295, 113, 452, 532, 577, 10, 0, 478, 0, 931, 0, 3, 0, 545,
+  782, 914, 0, 0, 612, 0, 14, 764, 855, 157, 0, 63, 39, 110, 787, 156,
+  983, 0, 0, 732, 824, 0, 0, 0, 0, 369, 0, 365, 414, 440, 913, 0,
+  0, 0, 0, 857, 85, 189, 988, 0, 0, 0, 0, 0, 0, 0, 458, 18,
+  554, 815, 0, 0, 0, 0, 377, 0, 0, 0, 0, 938, 0, 116, 326, 119,
+  384, 462, 162, 585, 829, 0, 147, 635, 0, 0, 686, 0, 0, 0, 0, 0,
+  0, 455, 0, 524, 525, 0, 480, 845, 0, 0, 0, 924, 0, 0, 0, 0,
+  383, 0, 0, 0, 0, 0, 192, 757, 0, 153, 490, 775, 241, 779, 0, 0,
+  687, 0, 0, 0, 0, 53, 0, 0, 0, 0, 0, 158, 191, 294, 0, 0,
+  835, 0, 0, 804, 0, 225, 0, 0, 428, 0, 620, 0, 0, 0, 361, 0,
+  0, 973, 0, 213, 404, 0, 348, 0, 0, 308, 0, 0, 0, 258, 240, 188,
+  472, 607, 727, 896, 985, 0, 0, 0, 0, 0, 0, 0, 111, 264, 353, 953,
+  961, 0, 0, 0, 99, 0, 249, 398, 592, 0, 966, 0, 399, 639, 219, 801,
+  0, 0, 0, 919, 0, 0, 0, 0, 0, 185, 0, 134, 197, 929, 563, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 594, 0, 319, 389,
+  0, 0, 517, 499, 771, 907, 488, 0, 0, 4, 898, 0, 313, 564, 0, 0,
+  343, 0, 0, 0, 220, 223, 0, 6, 430, 627, 0, 602, 469, 718, 0, 148,
+  521, 837, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 181, 736,
+  417, 905, 0, 491, 0, 0, 0, 0, 0, 347, 0, 0, 336, 762, 811, 599,
+  834, 875, 877, 984, 767, 0, 0, 40, 459, 453, 406, 0, 486, 42, 679, 0,
+  716, 0, 0, 0, 449, 685, 0, 0, 544, 457, 0, 0, 0, 0, 292, 0,
+  652, 0, 586, 0, 0, 967, 0, 746, 0, 0, 419, 289, 818, 0, 23, 0,
+  0, 0, 494, 648, 0, 0, 0, 0, 0, 0, 0, 0, 0, 959, 0, 66,
+  375, 0, 0, 0, 752, 0, 541, 20, 424, 92, 492, 817, 853, 0, 611, 0,
+  0, 722, 0, 0, 503, 0, 128, 0, 755, 624, 626, 789, 939, 0, 0, 476,
+  0, 640, 35, 0, 0, 0, 0, 0, 575, 211, 723, 923, 693, 700, 0, 0,
+  0, 0, 0, 451, 0, 0, 126, 420, 0, 0, 659, 0, 0, 0, 203, 0,
+  312, 382, 473, 573, 0, 0, 508, 826, 216, 465, 426, 536, 0, 0, 0, 0,
+  515, 0, 0, 996, 760, 738, 0, 0, 279, 281, 720, 0, 0, 0, 0, 0,
+  0, 550, 0, 694, 0, 0, 0, 0, 0, 129, 0, 0, 0, 429, 461, 0,
+  754, 0, 59, 0, 0, 1000, 395, 0, 888, 70, 558, 0, 306, 747, 768, 712,
+  0, 0, 676, 810, 849, 759, 0, 349, 318, 664, 0, 32, 0, 190, 0, 0,
+  0, 555, 977, 917, 0, 0, 337, 0, 750, 0, 0, 0, 505, 432, 388, 645,
+  878, 0, 0, 583, 603, 656, 441, 749, 838, 955, 0, 356, 724, 0, 557, 0,
+  0, 0, 26, 730, 843, 0, 0, 861, 0, 0, 0, 0, 115, 470, 908, 777,
+  527, 0, 205, 0, 559, 673, 0, 0, 0, 0, 0, 0, 146, 0, 151, 345,
+  822, 847, 368, 247, 385, 231, 411, 56, 540, 842, 579, 0, 0, 302, 416, 613,
+  0, 0, 0, 0, 0, 283, 788, 846, 683, 0, 0, 0, 0, 0, 245, 0,
+  946, 809, 0, 0, 0, 159, 910, 0, 89, 0, 75, 187, 866, 950, 0, 0,
+  210, 237, 0, 0, 0, 0, 0, 254, 0, 287, 37, 43, 228, 230, 483, 0,
+  661, 425, 665, 807, 0, 436, 0, 215, 516, 0, 333, 374, 0, 291, 229, 567,
+  735, 311, 0, 0, 951, 0, 0, 0, 0, 118, 109, 232, 715, 95, 0, 0,
+  0, 120, 504, 597, 668, 904, 509, 926, 663, 934, 899, 65, 799, 0, 0, 176,
+};
+
+const char *WA_FREQ_13_TOKENS[] = {
+  "क",
+  "र",
+  "म",
+  "त",
+  "ह",
+  "ब",
+  "ट",
+  "स",
+  "उ",
+  "ज",
+  "न",
+  "हवन",
+  "य",
+  "फ",
+  "छ",
+  "दई",
+  "ओह",
+  "गइल",
+  "गरज",
+  "नइख",
+  "यद",
+  "ओकर",
+  "मन",
+  "ख",
+  "भल",
+  "आदम",
+  "लग",
+  "एग",
+  "ग",
+  "इ",
+  "हम",
+  "उह",
+  "जन",
+  "च",
+  "अउर",
+  "इटल",
+  "सन",
+  "लल",
+  "ल",
+  "कड",
+  "हव",
+  "उर",
+  "ध",
+  "हइ",
+};
+const uint16_t WA_FREQ_13_RANKS[] = {
+  17, 21, 9, 33, 40, 3, 22, 0, 36, 0, 0, 0, 0, 0, 0, 13,
+  0, 0, 0, 15, 4, 34, 18, 0, 43, 0, 0, 0, 35, 0, 0, 0,
+  0, 0, 0, 0, 27, 0, 20, 0, 0, 0, 0, 37, 23, 7, 38, 0,
+  0, 0, 31, 0, 0, 0, 0, 0, 32, 0, 41, 0, 0, 0, 0, 0,
+  0, 42, 0, 0, 0, 0, 16, 0, 2, 0, 0, 0, 0, 0, 25, 0,
+  0, 0, 1, 39, 24, 10, 26, 29, 44, 0, 0, 0, 0, 0, 0, 6,
+  0, 0, 0, 0, 28, 0, 0, 19, 5, 8, 0, 0, 0, 0, 14, 0,
+  0, 0, 0, 0, 0, 0, 11, 0, 0, 0, 30, 0, 0, 0, 0, 12,
+};
+
+const char *WA_FREQ_14_TOKENS[] = {
+  "ka",
+  "bɛ",
+  "a",
+  "ye",
+  "la",
+  "ni",
+  "aw",
+  "na",
+  "o",
+  "kɛ",
+  "kan",
+  "se",
+  "min",
+  "ma",
+  "walima",
+  "u",
+  "don",
+  "ani",
+  "Ni",
+  "kɔnɔ",
+  "fɛ",
+  "tɛ",
+  "ko",
+  "minnu",
+  "sɔrɔ",
+  "A",
+  "dɔ",
+  "caman",
+  "bɛɛ",
+  "ɲɛ",
+  "Aw",
+  "mɔgɔ",
+  "in",
+  "O",
+  "den",
+  "i",
+  "fɔ",
+  "ta",
+  "dɔw",
+  "kelen",
+  "bɔ",
+  "bana",
+  "n’a",
+  "to",
+  "fura",
+  "de",
+  "taa",
+  "di",
+  "k’a",
+  "olu",
+  "san",
+  "an",
+  "fana",
+  "walasa",
+  "dumuni",
+  "tigi",
+  "yɔrɔ",
+  "da",
+  "ɲɔgɔn",
+  "bila",
+  "tile",
+  "ninnu",
+  "ji",
+  "tun",
+  "waati",
+  "dugu",
+  "yɛrɛ",
+  "nin",
+  "kɔ",
+  "lajɛ",
+  "b’a",
+  "sababu",
+  "kosɛbɛ",
+  "fɛn",
+  "hakɛ",
+  "furakɛ",
+  "nka",
+  "fo",
+  "kana",
+  "bolo",
+  "dɔn",
+  "wa",
+  "ca",
+  "muso",
+  "kɔfɛ",
+  "yen",
+  "wɛrɛw",
+  "mɔgɔw",
+  "sɛbɛn",
+  "Nin",
+  "kɔrɔ",
+  "wɛrɛ",
+  "baara",
+  "man",
+  "n",
+  "dimi",
+  "joli",
+  "cogo",
+  "jamana",
+  "Mali",
+  "tuma",
+  "dun",
+  "jira",
+  "cɛ",
+  "kalo",
+  "kɛra",
+  "fara",
+  "dɔɔni",
+  "bon",
+  "tali",
+  "sen",
+  "fɔlɔ",
+  "gɛlɛya",
+  "suguya",
+  "fila",
+  "kun",
+  "ba",
+  "tɛmɛ",
+  "k’u",
+  "kɛnɛya",
+  "minɛ",
+  "kalan",
+  "daminɛ",
+  "fari",
+  "fan",
+  "fanga",
+  "kuma",
+  "banabagatɔ",
+  "y’a",
+  "dɛmɛ",
+  "nafa",
+  "I",
+  "jɔ",
+  "dɔgɔtɔrɔso",
+  "sigi",
+  "ɲuman",
+  "bɛna",
+  "dɔrɔn",
+  "Nka",
+  "juguya",
+  "Walasa",
+  "kama",
+  "tɔgɔ",
+  "yɛlɛma",
+  "farikolo",
+  "furakɛli",
+  "be",
+  "pikiri",
+  "sin",
+  "2",
+  "gafe",
+  "joona",
+  "jugu",
+  "kɔnɔboli",
+  "sira",
+  "U",
+  "mako",
+  "si",
+  "An",
+  "taamasiɲɛ",
+  "bali",
+  "bawo",
+  "fiɲɛ",
+  "siɲɛ",
+  "mara",
+  "ja",
+  "nɔgɔya",
+  "Tuma",
+  "kɛlɛ",
+  "bɛka",
+  "n’o",
+  "caya",
+  "dɔgɔkun",
+  "wele",
+  "sani",
+  "barisa",
+  "gɛlɛn",
+  "teli",
+  "denw",
+  "faga",
+  "so",
+  "sigida",
+  "segin",
+  "k’o",
+  "nafama",
+  "hakili",
+  "ɲini",
+  "3",
+  "Mɔgɔ",
+  "kɛrɛnkɛrɛnnenya",
+  "n’u",
+  "1",
+  "banakisɛ",
+  "farigan",
+  "miligaramu",
+  "tata",
+  "yɛ",
+  "ban",
+  "Den",
+  "bε",
+  "tila",
+  "bɔra",
+  "Ka",
+  "furaw",
+  "nɔ",
+  "tɔw",
+  "Bana",
+  "kɛnɛ",
+  "lɛri",
+  "musow",
+  "fisa",
+  "lase",
+  "bonya",
+  "kunnafoni",
+  "laban",
+  "4",
+  "Fura",
+  "nɔnɔ",
+  "ninakili",
+  "du",
+  "taamasiɲɛw",
+  "banakɔtaa",
+  "jigin",
+  "sisan",
+  "tulu",
+  "dalen",
+  "dɔgɔya",
+  "Afrika",
+  "à",
+  "jiginni",
+  "miniti",
+  "banaw",
+  "bi",
+  "b’u",
+  "tanga",
+  "hali",
+  "balo",
+  "fini",
+  "jateminɛ",
+  "sigilen",
+  "6",
+  "fɔɔnɔ",
+  "jugumanba",
+  "jɔyɔrɔ",
+  "kofɔlen",
+  "kojugu",
+  "falen",
+  "dɔgɔtɔrɔ",
+  "denmisɛn",
+  "dilan",
+  "funu",
+  "joginda",
+  "senfɛ",
+  "sugu",
+  "tigɛ",
+  "sera",
+  "N",
+  "damadɔ",
+  "kɛlen",
+  "bɛn",
+  "furakisɛ",
+  "hakilina",
+  "jan",
+  "wari",
+  "basi",
+  "fa",
+  "nɔgɔ",
+  "sumaya",
+  "sɔgɔsɔgɔninjɛ",
+  "tɔ",
+  "bè",
+  "saba",
+  "su",
+  "ɲi",
+  "koli",
+  "kɔlɔsi",
+  "mɛn",
+  "nɛ",
+  "Bamakɔ",
+  "Misali",
+  "dumuniw",
+  "sama",
+  "bé",
+  "fitini",
+  "kunbɛn",
+  "Ɛntɛrinɛti",
+  "Muso",
+  "b’o",
+  "dunni",
+  "juguman",
+  "ne",
+  "5",
+  "kolo",
+  "yan",
+  "bɔli",
+  "fɛɛrɛ",
+  "musoya",
+  "10",
+  "kɛcogo",
+  "telefɔni",
+  "tuguni",
+  "Fasojamana",
+  "kura",
+  "mana",
+  "senw",
+  "worodugu",
+  "baga",
+  "dugukolo",
+  "jɛ",
+  "kisɛ",
+  "siri",
+  "dan",
+  "penisilini",
+  "teliya",
+  "ci",
+  "dama",
+  "diɲɛ",
+  "witamini",
+  "balodɛsɛ",
+  "do",
+  "saya",
+  "sɔgɔsɔgɔ",
+  "bangekɔlɔsi",
+  "demisɛnw",
+  "kari",
+  "tan",
+  "kulu",
+  "saniya",
+  "taabolo",
+  "taama",
+  "Hali",
+  "banakisɛfagalan",
+  "kilogaramu",
+  "nana",
+  "sogo",
+  "Ali",
+  "bɔlen",
+  "denmisɛnni",
+  "girinya",
+  "jija",
+  "San",
+  "basibɔn",
+  "duguw",
+  "janya",
+  "kuru",
+  "kɔnɔbara",
+  "sara",
+  "wolo",
+  "N’aw",
+  "k’i",
+  "tobi",
+  "ɛntɛrinɛti",
+  "Mansamara",
+  "datugu",
+  "fanba",
+  "kɔrɔn",
+  "labɛn",
+  "nu",
+  "taara",
+  "wuli",
+  "danbɔ",
+  "kɔn",
+  "kɛli",
+  "sɛnɛ",
+  "denmisɛnw",
+  "farati",
+  "sinji",
+  "sukaro",
+  "tulo",
+  "denmisɛnniw",
+  "dɛ",
+  "jamanaw",
+  "kɔlɔlɔ",
+  "sabati",
+  "senkɔrɔ",
+  "togodaw",
+  "Waati",
+  "bilen",
+  "farilajidɛsɛ",
+  "sa",
+  "tlebi",
+  "ŋɛɲɛ",
+  "15",
+  "Farafinna",
+  "Segu",
+  "k'a",
+  "kungolo",
+  "matarafa",
+  "t’a",
+  "yɔrɔw",
+  "Jamana",
+  "foyi",
+  "safinɛ",
+  "sanfɛ",
+  "dili",
+  "faaba",
+  "jate",
+  "sɔn",
+  "abada",
+  "baaraw",
+  "duguma",
+  "kafoɲɔgɔnya",
+  "kanw",
+  "kisi",
+  "Dumuni",
+  "donni",
+  "dɔnni",
+  "gɛlɛyaw",
+  "tumu",
+  "yé",
+  "ɲɛsin",
+  "Ale",
+  "Aller",
+  "Olu",
+  "jolidɛsɛ",
+  "kè",
+  "mu",
+  "mura",
+  "nafamaw",
+  "navigationAller",
+  "tɛka",
+  "Dugu",
+  "ale",
+  "dusukun",
+  "k’aw",
+  "labɔ",
+  "sidabana",
+  "12",
+  "30",
+  "N’a",
+  "degun",
+  "dɔgɔn",
+  "feere",
+  "furu",
+  "jɛlen",
+  "kabini",
+  "kalaya",
+  "litiri",
+  "mugu",
+  "saheli",
+  "sôrô",
+  "7",
+  "Sani",
+  "banakisɛw",
+  "bin",
+  "biɲɛ",
+  "digi",
+  "disi",
+  "foro",
+  "fô",
+  "jimafɛn",
+  "jɛnsɛn",
+  "kɔnɔta",
+  "kɛnɛyabaarakɛla",
+  "n’aw",
+  "tacogo",
+  "Ba",
+  "bamanankan",
+  "jiri",
+  "kɔnɔdimi",
+  "kɛmɛda",
+  "sunɔgɔ",
+  "sɔrɔli",
+  "sɛgɛn",
+  "Eropa",
+  "boli",
+  "dunia",
+  "duuru",
+  "furakɛcogo",
+  "janto",
+  "ku",
+  "mi",
+  "minu",
+  "nugu",
+  "tɛgɛ",
+  "ɲɛda",
+  "aka",
+  "baw",
+  "dô",
+  "fitiniw",
+  "fɔlɔw",
+  "jago",
+  "kaba",
+  "kataa",
+  "kirinni",
+  "k’an",
+  "lafiya",
+  "minɛn",
+  "senna",
+  "ɲagaminen",
+  "bandi",
+  "dabila",
+  "denso",
+  "jumɛn",
+  "kɛrɛ",
+  "tin",
+  "tiɲɛ",
+  "tɔn",
+  "ɲininka",
+  "Wa",
+  "bange",
+  "bara",
+  "jeni",
+  "kinni",
+  "kɔnɔna",
+  "kɔrɔta",
+  "mankan",
+  "mansamara",
+  "misali",
+  "nataw",
+  "sango",
+  "suma",
+  "sumayabana",
+  "tansiyɔn",
+  "ten",
+  "yeelen",
+  "Don",
+  "Ji",
+  "bala",
+  "diya",
+  "dɛsɛ",
+  "fin",
+  "jɛgɛ",
+  "kuntaala",
+  "kɔkɔ",
+  "kɛrɛfɛ",
+  "kɛrɛnkɛrɛnnen",
+  "nɔgɔn",
+  "tugun",
+  "tε",
+  "waleya",
+  "ya",
+  "ɲɛfɔ",
+  "40",
+  "8",
+  "Walima",
+  "asipirini",
+  "baganw",
+  "donna",
+  "dɔnniya",
+  "furudimi",
+  "fɔlen",
+  "kabɔ",
+  "mago",
+  "shɛfan",
+  "tɛna",
+  "ɲagami",
+  "ɲɛfɔlen",
+  "ɲɛgɛnɛ",
+  "Mɔgɔw",
+  "b'a",
+  "bangera",
+  "bolow",
+  "demisɛn",
+  "denyɛrɛni",
+  "kanjabana",
+  "naani",
+  "n’i",
+  "sugunɛ",
+  "suman",
+  "sɔmiɲɛ",
+  "Fɛn",
+  "Kongo",
+  "baro",
+  "b’i",
+  "jikalan",
+  "kɛnɛyaji",
+  "sanuman",
+  "tasuma",
+  "togodala",
+  "tugu",
+  "tɛmɛna",
+  "Kalo",
+  "Kɔnɔboli",
+  "Tile",
+  "anpisilini",
+  "bɔn",
+  "b’aw",
+  "filanan",
+  "finimugu",
+  "forow",
+  "fugulan",
+  "funteni",
+  "jɛkulu",
+  "kungo",
+  "kɔnɔma",
+  "mg",
+  "seko",
+  "tiɲɛni",
+  "wati",
+  "y'a",
+  "ɲɛgɛn",
+  "20",
+  "Ani",
+  "Atlantik",
+  "Franse",
+  "Fɔ",
+  "Gine",
+  "Tlebi",
+  "baliku",
+  "banakisɛfagalanw",
+  "barajuru",
+  "bulu",
+  "cogoya",
+  "cɛya",
+  "dala",
+  "d’a",
+  "faralen",
+  "fɛnw",
+  "garamu",
+  "kalanso",
+  "kɔnɔmaya",
+  "mada",
+  "mɛnna",
+  "nɛnɛ",
+  "recherche",
+  "sosow",
+  "tilancɛ",
+  "tɔɔrɔ",
+  "yeli",
+  "Kε",
+  "Ne",
+  "bisi",
+  "dafalen",
+  "dara",
+  "denba",
+  "dɔnnen",
+  "filɛ",
+  "gansan",
+  "jɛman",
+  "kɔnɔtiɲɛ",
+  "meleke",
+  "mun",
+  "sigira",
+  "tubabukan",
+  "tɛmɛnen",
+  "yɔrɔnin",
+  "ɲɔ",
+  "ɲɛtaa",
+  "bagan",
+  "basigilen",
+  "bobara",
+  "dugubaw",
+  "fla",
+  "fɛɛrɛw",
+  "jɔsi",
+  "kinda",
+  "kungolodimi",
+  "kurukuru",
+  "kô",
+  "laada",
+  "musokɔnɔma",
+  "nga",
+  "surun",
+  "sɔngɔ",
+  "sɛgɛsɛgɛli",
+  "wale",
+  "wɔlɔkɔlen",
+  "y’o",
+  "ɲɛnamini",
+  "Sigida",
+  "c’a",
+  "dunta",
+  "farafinna",
+  "kalanko",
+  "karamɔgɔ",
+  "kera",
+  "kunnafoniw",
+  "lakɔli",
+  "là",
+  "mugan",
+  "musaka",
+  "nɛgɛ",
+  "shɔ",
+  "sɔrɔla",
+  "sɛnɛkɛlaw",
+  "tetarasikilini",
+  "woro",
+  "yɛrɛta",
+  "ɲumanw",
+  "ɲɛci",
+  "Bamanankan",
+  "Farikolo",
+  "Sikaso",
+  "anw",
+  "banna",
+  "bolokɔni",
+  "cogodi",
+  "fosi",
+  "fɛrɛ",
+  "inafo",
+  "jamanaden",
+  "jɔli",
+  "jɔnjɔn",
+  "kono",
+  "kunsɛmɛ",
+  "lafiɲɛ",
+  "mabɔ",
+  "mɔgɔkɔrɔbaw",
+  "mɔni",
+  "ntanya",
+  "te",
+  "waatiw",
+  "wali",
+  "50",
+  "Kati",
+  "Kɔgɔji",
+  "Ture",
+  "baarakɛ",
+  "bo",
+  "bɛrɛ",
+  "cayara",
+  "cɛsiri",
+  "faamu",
+  "fiyɛ",
+  "fogonfogon",
+  "kalanni",
+  "kow",
+  "kɔrɔlen",
+  "labaara",
+  "maga",
+  "ntolatan",
+  "sabanan",
+  "sanga",
+  "tora",
+  "tu",
+  "wasa",
+  "weele",
+  "Banabagatɔ",
+  "Saheli",
+  "ali",
+  "banakɔtaayɔrɔ",
+  "bii",
+  "cɛmancɛ",
+  "dayɛlɛ",
+  "furakisɛw",
+  "jatelen",
+  "jigi",
+  "joginni",
+  "kunkolo",
+  "kɛmɛ",
+  "sigiyɔrɔ",
+  "tle",
+  "wili",
+  "yaalata",
+  "ɲininkali",
+  "Bamako",
+  "Gara",
+  "N’i",
+  "Sisan",
+  "Sudan",
+  "belebele",
+  "boloci",
+  "cɛla",
+  "dɔlɔ",
+  "dɔnkili",
+  "finiw",
+  "jumɛnw",
+  "jɔlen",
+  "kasa",
+  "kin",
+  "kofɔlenw",
+  "mɔ",
+  "nɛn",
+  "sabu",
+  "sow",
+  "tigiw",
+  "tunu",
+  "Bangekɔlɔsi",
+  "Bi",
+  "Dimi",
+  "Gafe",
+  "Worodugu",
+  "Zezana",
+  "basigi",
+  "cɛw",
+  "fasa",
+  "gun",
+  "jiriden",
+  "jiridenw",
+  "kelenw",
+  "kolow",
+  "kunbɛnni",
+  "kuraw",
+  "kônô",
+  "kɔngɔ",
+  "kɛlɛli",
+  "kɛrɛnkɛrɛnnenw",
+  "kɛta",
+  "lamini",
+  "matarafali",
+  "miiri",
+  "mɔgɔkɔrɔba",
+  "nakɔfɛnw",
+  "pewu",
+  "siran",
+  "son",
+  "sɛnɛkɛla",
+  "taabolow",
+  "tonso",
+  "tɔnden",
+  "Amerika",
+  "Arabu",
+  "Cɛ",
+  "Diɲɛ",
+  "Kalan",
+  "Keita",
+  "Umar",
+  "balikukalan",
+  "balikuw",
+  "damajalan",
+  "dankan",
+  "dilannen",
+  "dita",
+  "faamuya",
+  "foroko",
+  "fu",
+  "furaji",
+  "fɔli",
+  "hadamadenya",
+  "karilen",
+  "lajɔ",
+  "lakalan",
+  "lakana",
+  "lakɔlidenw",
+  "minni",
+  "misɛnniw",
+  "musokɔnɔmaw",
+  "nafolo",
+  "nan",
+  "nɔnabila",
+  "sigidaw",
+  "sigili",
+  "siraw",
+  "talen",
+  "tariku",
+  "wo",
+  "yanni",
+  "yera",
+  "yiriwa",
+  "ɲɔgɔnna",
+  "200",
+  "500",
+  "A’",
+  "Minisiri",
+  "Se",
+  "Tɔn",
+  "bô",
+  "damadɔw",
+  "dibi",
+  "donnen",
+  "dumunikɛ",
+  "golo",
+  "kala",
+  "kalama",
+  "kumaɲɔgɔnya",
+  "kunda",
+  "k’olu",
+  "lawaji",
+  "lu",
+  "madɔnnen",
+  "magaya",
+  "sé",
+  "talikɛ",
+  "tobilen",
+  "ɲɔgɔnnaw",
+  "ɲɛw",
+  "11",
+  "14",
+  "Balodɛsɛ",
+  "Banakisɛfagalan",
+  "Dugukolo",
+  "Farigan",
+  "Joli",
+  "Jɛkulu",
+  "Kabini",
+  "Tumutu",
+  "Witamini",
+  "amɔkisisilini",
+  "a’",
+  "bannen",
+  "dana",
+  "deli",
+  "dimɔgɔ",
+  "dunbaliya",
+  "faritanabana",
+  "fili",
+  "fiyen",
+  "foroba",
+  "gosi",
+  "isoniyazidi",
+  "jaabi",
+  "jali",
+  "jama",
+  "joliw",
+  "kabila",
+  "kilomɛtɛrɛ",
+  "kirin",
+  "kunna",
+  "kɔlɔlɔw",
+  "n'a",
+  "nakɔfɛn",
+  "sabatili",
+  "sufɛ",
+  "sɛgɛsɛgɛ",
+  "tara",
+  "tigilamɔgɔ",
+  "tɔgɔtɔgɔnin",
+  "wulilen",
+  "yôrô",
+  "y’u",
+  "ɲimi",
+  "ɲɛnabɔ",
+  "25",
+  "Amadu",
+  "Ingliz",
+  "Kɛnɛya",
+  "Musow",
+  "N’o",
+  "Penisilini",
+  "Senegal",
+  "Sida",
+  "Telefɔni",
+  "banamisɛnniw",
+  "bilali",
+  "cogomin",
+  "daji",
+  "dingɛ",
+  "duman",
+  "dusu",
+  "dɔgɔ",
+  "dɔgɔtɔrɔw",
+  "dɔnnin",
+  "et",
+  "fali",
+  "farala",
+  "faratiba",
+  "foli",
+  "fε",
+  "fεn",
+  "geren",
+  "gɛnɛgɛnɛ",
+  "joginnen",
+  "jukɔrɔ",
+  "kabla",
+  "kalanden",
+  "kofɔ",
+  "komini",
+  "kunkan",
+  "lamɛn",
+  "milion",
+  "m’a",
+  "nali",
+  "nara",
+  "nɛrɛ",
+  "n’an",
+  "sanji",
+  "sanni",
+  "sɔmina",
+  "tako",
+  "tubabu",
+  "yɛlɛ",
+  "yɛlɛmani",
+  "yɛlɛn",
+  "ɲinw",
+  "ɲɛgɛnw",
+  "100",
+  "Dɔw",
+  "Fɔlɔ",
+  "Mediterane",
+  "Modibo",
+  "Sidabana",
+  "Sunjata",
+  "Sɔgɔsɔgɔninjɛ",
+  "Tal",
+  "adamaden",
+  "alikɔli",
+  "bolokɔniw",
+  "b’olu",
+  "daga",
+  "delila",
+  "denbaw",
+  "dila",
+  "diɲɛlatigɛ",
+  "farikoloɲɛnajɛ",
+  "faso",
+  "forokoni",
+  "fè",
+  "gɛlɛyaba",
+  "jalen",
+  "janko",
+  "jaw",
+  "kalolabɔ",
+  "kasɔrɔ",
+  "kunu",
+  "kɛnɛyaso",
+  "kɛɲɛ",
+  "malo",
+  "mina",
+  "minɛnw",
+};
+const uint16_t WA_FREQ_14_RANKS[] = {
+  0, 0, 0, 408, 858, 0, 0, 715, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 318, 856, 0, 24, 452, 88, 569, 763, 784, 603,
+  622, 674, 681, 844, 967, 0, 364, 611, 0, 801, 459, 0, 55, 0, 0, 0,
+  0, 0, 0, 0, 400, 0, 453, 536, 0, 629, 0, 0, 604, 0, 635, 939,
+  0, 843, 0, 0, 197, 956, 0, 0, 0, 0, 0, 155, 261, 602, 499, 0,
+  0, 546, 892, 0, 0, 919, 0, 902, 0, 0, 0, 0, 0, 442, 352, 423,
+  988, 424, 0, 0, 0, 0, 0, 438, 256, 941, 0, 0, 0, 496, 412, 413,
+  699, 679, 718, 812, 876, 29, 476, 0, 0, 0, 0, 0, 0, 661, 0, 386,
+  0, 0, 0, 257, 0, 0, 0, 417, 0, 0, 4, 78, 0, 304, 851, 0,
+  0, 209, 30, 112, 0, 0, 0, 0, 0, 0, 200, 0, 71, 0, 910, 685,
+  0, 754, 0, 67, 63, 716, 240, 81, 917, 0, 607, 676, 592, 0, 0, 0,
+  0, 0, 999, 620, 0, 122, 407, 0, 289, 0, 0, 0, 0, 0, 222, 475,
+  345, 524, 946, 973, 977, 747, 0, 500, 647, 479, 0, 0, 0, 0, 0, 0,
+  59, 574, 0, 0, 734, 0, 0, 0, 0, 0, 136, 624, 920, 0, 224, 639,
+  650, 0, 0, 0, 91, 0, 0, 0, 0, 0, 0, 0, 887, 0, 0, 0,
+  0, 0, 214, 60, 174, 0, 0, 445, 0, 0, 0, 0, 0, 267, 212, 0,
+  148, 702, 874, 0, 0, 0, 498, 0, 0, 286, 0, 0, 0, 190, 0, 0,
+  0, 580, 0, 0, 0, 0, 838, 0, 0, 0, 208, 54, 0, 64, 0, 0,
+  193, 0, 278, 0, 326, 420, 924, 922, 758, 0, 632, 714, 0, 0, 258, 760,
+  0, 0, 0, 273, 0, 0, 0, 875, 0, 76, 0, 0, 82, 505, 0, 0,
+  0, 0, 0, 210, 849, 606, 788, 972, 0, 0, 410, 0, 0, 645, 811, 820,
+  982, 0, 177, 0, 0, 0, 0, 0, 516, 0, 776, 831, 27, 642, 726, 873,
+  588, 908, 0, 0, 0, 0, 879, 0, 0, 0, 807, 0, 0, 0, 0, 0,
+  0, 525, 0, 470, 0, 713, 926, 0, 0, 0, 215, 0, 0, 204, 771, 303,
+  0, 0, 0, 733, 666, 0, 0, 0, 664, 0, 0, 0, 189, 0, 0, 0,
+  0, 0, 7, 0, 0, 705, 0, 0, 0, 353, 15, 376, 439, 842, 0, 0,
+  0, 0, 0, 0, 0, 248, 66, 92, 355, 238, 290, 371, 909, 987, 923, 0,
+  0, 0, 0, 3, 298, 868, 0, 265, 430, 0, 0, 495, 710, 0, 543, 0,
+  194, 0, 0, 0, 573, 225, 274, 149, 899, 56, 0, 0, 339, 823, 142, 818,
+  0, 0, 454, 98, 244, 456, 0, 0, 0, 0, 0, 0, 231, 0, 0, 727,
+  176, 563, 950, 0, 586, 0, 0, 0, 0, 104, 0, 0, 0, 553, 331, 239,
+  697, 0, 0, 813, 0, 0, 630, 605, 0, 0, 769, 595, 653, 802, 0, 0,
+  0, 0, 0, 175, 0, 665, 708, 0, 368, 126, 0, 399, 897, 0, 0, 97,
+  991, 0, 0, 614, 808, 901, 0, 436, 477, 0, 0, 166, 581, 700, 723, 736,
+  0, 101, 132, 704, 550, 855, 871, 872, 658, 971, 984, 0, 0, 0, 0, 0,
+  0, 0, 357, 582, 0, 347, 0, 0, 816, 0, 994, 692, 997, 464, 513, 0,
+  0, 0, 796, 69, 0, 387, 509, 0, 0, 0, 0, 0, 0, 0, 0, 22,
+  95, 514, 731, 232, 17, 450, 206, 682, 827, 865, 268, 300, 601, 748, 940, 570,
+  0, 0, 0, 0, 0, 0, 0, 0, 315, 829, 507, 0, 850, 0, 0, 123,
+  391, 317, 406, 478, 70, 490, 523, 565, 567, 695, 0, 0, 0, 0, 540, 0,
+  0, 433, 114, 0, 0, 599, 0, 770, 0, 839, 0, 835, 0, 860, 227, 781,
+  489, 0, 0, 791, 625, 0, 0, 0, 0, 0, 0, 0, 0, 178, 815, 0,
+  0, 0, 0, 379, 8, 783, 0, 451, 539, 309, 558, 167, 440, 395, 912, 933,
+  0, 0, 0, 745, 365, 431, 207, 640, 0, 0, 0, 0, 269, 65, 94, 0,
+  0, 0, 0, 0, 0, 0, 441, 913, 915, 0, 766, 375, 0, 0, 0, 0,
+  455, 750, 893, 0, 689, 657, 572, 684, 903, 0, 698, 667, 0, 711, 951, 506,
+  0, 128, 0, 0, 0, 0, 515, 0, 0, 0, 0, 255, 0, 361, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 943, 0, 0, 792, 409, 0,
+  0, 0, 0, 444, 0, 0, 276, 115, 501, 465, 526, 712, 828, 0, 0, 0,
+  0, 0, 0, 378, 266, 774, 316, 617, 116, 728, 468, 589, 626, 857, 144, 932,
+  963, 9, 48, 896, 0, 597, 129, 87, 0, 0, 171, 285, 0, 463, 0, 37,
+  0, 0, 0, 335, 517, 958, 0, 250, 703, 914, 990, 429, 351, 889, 0, 0,
+  0, 0, 195, 0, 0, 385, 263, 959, 0, 170, 594, 0, 593, 0, 100, 203,
+  542, 111, 288, 426, 484, 183, 110, 675, 945, 0, 652, 216, 768, 906, 0, 0,
+  247, 0, 57, 358, 583, 0, 0, 848, 388, 0, 0, 0, 0, 0, 36, 0,
+  0, 0, 89, 131, 654, 0, 0, 556, 0, 0, 668, 0, 165, 118, 434, 0,
+  853, 254, 934, 0, 161, 0, 0, 40, 0, 0, 402, 762, 646, 996, 822, 32,
+  389, 0, 346, 0, 52, 504, 787, 0, 0, 615, 0, 0, 0, 234, 0, 42,
+  0, 279, 0, 0, 0, 120, 0, 785, 690, 779, 0, 135, 11, 0, 545, 0,
+  75, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 145, 172, 307, 590,
+  0, 0, 0, 0, 0, 529, 0, 0, 0, 0, 85, 223, 669, 282, 746, 825,
+  295, 598, 466, 561, 834, 757, 99, 428, 809, 0, 0, 25, 576, 137, 0, 0,
+  0, 0, 38, 803, 0, 0, 0, 228, 686, 551, 264, 0, 0, 188, 233, 277,
+  0, 0, 486, 226, 587, 372, 0, 798, 0, 427, 0, 955, 0, 0, 0, 301,
+  520, 0, 0, 0, 531, 31, 461, 729, 805, 786, 0, 0, 612, 962, 627, 143,
+  0, 0, 0, 0, 0, 0, 0, 363, 753, 447, 578, 927, 644, 341, 0, 0,
+  911, 591, 0, 0, 0, 0, 833, 0, 0, 0, 1, 0, 0, 0, 293, 0,
+  0, 0, 765, 0, 0, 0, 291, 0, 0, 0, 0, 0, 10, 0, 185, 794,
+  0, 0, 0, 134, 0, 0, 0, 0, 0, 0, 28, 401, 0, 383, 446, 221,
+  780, 0, 538, 34, 314, 0, 0, 191, 0, 106, 0, 0, 0, 752, 0, 0,
+  0, 0, 0, 0, 158, 242, 260, 310, 0, 0, 575, 0, 0, 944, 0, 0,
+  0, 0, 0, 549, 0, 0, 0, 960, 0, 886, 0, 449, 0, 659, 0, 152,
+  296, 393, 0, 0, 229, 0, 0, 0, 651, 182, 493, 354, 370, 904, 552, 938,
+  907, 105, 992, 0, 0, 0, 0, 0, 0, 0, 0, 46, 2, 323, 350, 381,
+  621, 957, 0, 0, 510, 0, 0, 0, 0, 0, 448, 164, 181, 936, 0, 0,
+  283, 0, 0, 0, 0, 186, 719, 0, 0, 241, 0, 0, 80, 0, 0, 366,
+  21, 146, 616, 184, 0, 230, 328, 964, 396, 0, 782, 0, 0, 949, 0, 0,
+  179, 159, 0, 643, 693, 196, 217, 636, 0, 691, 730, 305, 251, 985, 0, 299,
+  219, 0, 0, 0, 369, 0, 0, 0, 0, 741, 0, 0, 306, 751, 0, 648,
+  0, 156, 0, 795, 113, 895, 151, 0, 0, 880, 0, 414, 14, 411, 491, 0,
+  0, 0, 534, 0, 0, 336, 0, 0, 0, 0, 954, 0, 0, 777, 571, 948,
+  0, 0, 0, 0, 0, 0, 929, 0, 995, 0, 312, 0, 930, 0, 0, 61,
+  262, 297, 663, 870, 0, 0, 0, 0, 0, 701, 201, 0, 249, 0, 0, 18,
+  0, 0, 0, 0, 0, 0, 725, 0, 0, 0, 0, 0, 0, 437, 800, 942,
+  0, 696, 721, 0, 0, 253, 473, 246, 773, 0, 0, 0, 0, 0, 35, 619,
+  380, 1000, 0, 0, 0, 568, 0, 471, 349, 481, 281, 891, 0, 976, 0, 150,
+  0, 72, 0, 0, 0, 749, 0, 0, 0, 0, 0, 0, 566, 512, 332, 0,
+  0, 0, 0, 360, 0, 0, 724, 213, 968, 0, 0, 0, 0, 49, 0, 0,
+  978, 0, 0, 0, 797, 862, 0, 327, 421, 0, 0, 0, 0, 0, 0, 192,
+  947, 0, 0, 0, 20, 117, 0, 359, 793, 0, 50, 457, 817, 0, 130, 377,
+  649, 0, 367, 0, 0, 147, 121, 343, 969, 140, 0, 0, 0, 0, 237, 83,
+  16, 738, 0, 535, 77, 0, 0, 458, 467, 472, 743, 141, 755, 0, 799, 0,
+  735, 0, 0, 806, 0, 0, 0, 0, 0, 979, 0, 0, 0, 0, 0, 403,
+  340, 162, 905, 0, 609, 961, 0, 737, 739, 124, 577, 511, 541, 596, 878, 0,
+  0, 0, 0, 292, 205, 275, 764, 45, 847, 53, 0, 0, 271, 0, 157, 198,
+  0, 0, 864, 610, 103, 62, 394, 0, 672, 0, 0, 720, 557, 854, 548, 0,
+  187, 405, 311, 460, 483, 23, 494, 168, 547, 600, 722, 866, 921, 937, 966, 981,
+  0, 390, 756, 0, 0, 0, 0, 0, 0, 0, 0, 883, 0, 0, 0, 0,
+  0, 732, 974, 662, 0, 0, 554, 0, 0, 47, 0, 0, 0, 0, 0, 0,
+  270, 280, 680, 671, 0, 0, 0, 585, 0, 0, 0, 0, 0, 160, 382, 398,
+  344, 709, 683, 73, 0, 0, 313, 169, 742, 814, 474, 810, 688, 821, 989, 0,
+  0, 0, 488, 502, 826, 832, 96, 384, 492, 0, 0, 0, 0, 0, 12, 0,
+  0, 199, 0, 0, 0, 0, 0, 0, 882, 43, 503, 0, 68, 0, 0, 0,
+  93, 641, 789, 322, 869, 0, 443, 0, 631, 0, 519, 618, 0, 0, 0, 0,
+  0, 0, 0, 422, 202, 497, 840, 673, 841, 462, 863, 898, 555, 0, 0, 0,
+  0, 0, 687, 0, 26, 0, 19, 859, 39, 633, 637, 0, 885, 109, 533, 925,
+  0, 0, 319, 325, 0, 0, 480, 418, 656, 0, 778, 0, 0, 707, 986, 0,
+  0, 0, 0, 0, 0, 0, 0, 245, 392, 0, 0, 0, 259, 211, 308, 435,
+  0, 0, 0, 220, 819, 0, 965, 138, 518, 218, 836, 44, 0, 0, 0, 772,
+  0, 522, 767, 485, 846, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 294, 469, 894, 532, 0, 0, 338, 133, 804, 333, 0, 0, 998, 0,
+  0, 0, 373, 952, 0, 544, 0, 0, 0, 0, 0, 334, 0, 419, 0, 852,
+  867, 0, 900, 0, 180, 0, 84, 0, 0, 0, 0, 235, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 861, 0, 0, 537, 6, 348, 425, 163, 584, 628, 102,
+  706, 916, 0, 0, 0, 0, 0, 0, 983, 579, 623, 0, 0, 0, 272, 562,
+  90, 0, 837, 845, 482, 830, 0, 928, 41, 0, 677, 404, 0, 0, 527, 0,
+  0, 0, 0, 560, 975, 13, 759, 487, 287, 329, 0, 0, 508, 877, 0, 86,
+  0, 0, 888, 980, 0, 0, 775, 0, 127, 744, 0, 0, 0, 931, 0, 0,
+  415, 0, 530, 0, 824, 0, 0, 660, 0, 0, 0, 0, 740, 993, 790, 302,
+  0, 890, 416, 0, 0, 0, 0, 0, 0, 356, 5, 0, 58, 678, 324, 0,
+  0, 0, 0, 0, 0, 528, 0, 330, 397, 634, 918, 0, 374, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 342, 0, 0, 0, 717, 321, 655, 362,
+  0, 0, 0, 0, 0, 0, 0, 0, 694, 564, 33, 935, 119, 953, 252, 284,
+  0, 0, 0, 0, 0, 0, 0, 0, 51, 0, 0, 0, 608, 74, 0, 337,
+  0, 638, 970, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  173, 320, 884, 0, 0, 0, 0, 125, 432, 670, 0, 0, 0, 0, 0, 79,
+  761, 0, 0, 0, 153, 0, 0, 139, 0, 0, 0, 559, 108, 0, 0, 0,
+  613, 0, 0, 521, 154, 107, 243, 236, 0, 0, 881, 0, 0, 0, 0, 0,
+};
+
@@ -0,0 +1,12608 @@
+#include "worldalphabets_data.h"
+
+const char *WA_FREQ_15_TOKENS[] = {
+  "ও",
+  "করে",
+  "থেকে",
+  "এ",
+  "এই",
+  "করা",
+  "এবং",
+  "না",
+  "জন্য",
+  "করতে",
+  "বলেন",
+  "তার",
+  "তিনি",
+  "নিয়ে",
+  "এক",
+  "না।",
+  "হয়।",
+  "আর",
+  "সঙ্গে",
+  "একটি",
+  "হয়েছে।",
+  "যে",
+  "হয়ে",
+  "হবে।",
+  "মধ্যে",
+  "কোনো",
+  "এর",
+  "আমার",
+  "আমি",
+  "পর",
+  "হয়",
+  "তাদের",
+  "কিন্তু",
+  "সময়",
+  "বলে",
+  "দিয়ে",
+  "কথা",
+  "আমাদের",
+  "আমরা",
+  "তবে",
+  "তা",
+  "হবে",
+  "হাজার",
+  "শুরু",
+  "বা",
+  "করার",
+  "হয়েছে",
+  "গত",
+  "কাজ",
+  "সব",
+  "ওই",
+  "এখন",
+  "দেওয়া",
+  "কিছু",
+  "অনেক",
+  "দুই",
+  "সেই",
+  "তারা",
+  "দেশের",
+  "সে",
+  "ছিল",
+  "করেন।",
+  "বিভিন্ন",
+  "হিসেবে",
+  "আগে",
+  "প্রথম",
+  "বাংলাদেশ",
+  "বছর",
+  "করেন",
+  "আরও",
+  "আজ",
+  "বেশি",
+  "নতুন",
+  "তাঁর",
+  "পর্যন্ত",
+  "করে।",
+  "দেখা",
+  "মনে",
+  "কাছে",
+  "টাকা",
+  "একটা",
+  "হতে",
+  "কারণে",
+  "যায়",
+  "হলে",
+  "হচ্ছে",
+  "এমন",
+  "মতো",
+  "তাই",
+  "লাখ",
+  "দিতে",
+  "কি",
+  "বড়",
+  "দিকে",
+  "মাধ্যমে",
+  "দিন",
+  "শেষ",
+  "প্রায়",
+  "দেশে",
+  "সালে",
+  "বাংলাদেশের",
+  "বলা",
+  "জানান",
+  "ধরে",
+  "এসব",
+  "পরে",
+  "যায়।",
+  "মানুষের",
+  "আছে",
+  "কোটি",
+  "তৈরি",
+  "সালের",
+  "নেই।",
+  "ওপর",
+  "পুলিশ",
+  "জাতীয়",
+  "করেছেন",
+  "গতকাল",
+  "বিষয়ে",
+  "বিরুদ্ধে",
+  "করেছে",
+  "যা",
+  "ভালো",
+  "ঢাকা",
+  "তখন",
+  "তাকে",
+  "হচ্ছে।",
+  "তো",
+  "বছরের",
+  "মানুষ",
+  "ছাড়া",
+  "পারে।",
+  "একজন",
+  "আবার",
+  "ধরনের",
+  "যদি",
+  "প্রতি",
+  "অভিযোগ",
+  "তিন",
+  "শুধু",
+  "হলো",
+  "কেউ",
+  "হওয়ার",
+  "সাধারণ",
+  "মো",
+  "শেখ",
+  "কারণ",
+  "এতে",
+  "সরকার",
+  "প্রধান",
+  "নিজের",
+  "আওয়ামী",
+  "পাওয়া",
+  "আছে।",
+  "তথ্য",
+  "রয়েছে।",
+  "জানা",
+  "জন",
+  "গেছে",
+  "ক্ষেত্রে",
+  "সেখানে",
+  "করেছে।",
+  "কী",
+  "বন্ধ",
+  "ফলে",
+  "তিনি।",
+  "পারে",
+  "নিতে",
+  "খুব",
+  "নেওয়া",
+  "গেছে।",
+  "করেছেন।",
+  "টিকা",
+  "নাম",
+  "বিশ্ববিদ্যালয়ের",
+  "রহমান",
+  "১০",
+  "ইসলাম",
+  "গিয়ে",
+  "বেশ",
+  "নয়।",
+  "অন্য",
+  "করোনা",
+  "ব্যবহার",
+  "ছিলেন",
+  "বিশেষ",
+  "নয়",
+  "দেওয়ার",
+  "একই",
+  "রয়েছে",
+  "বলেছেন",
+  "১",
+  "এটি",
+  "সরকারের",
+  "এটা",
+  "ব্যবস্থা",
+  "প্রকাশ",
+  "যেন",
+  "যেতে",
+  "দলের",
+  "যখন",
+  "চলে",
+  "এবার",
+  "তুলে",
+  "হোসেন",
+  "উপজেলার",
+  "চেষ্টা",
+  "তাঁদের",
+  "দাবি",
+  "নির্বাচন",
+  "ঘোষণা",
+  "থাকা",
+  "সামনে",
+  "স্থানীয়",
+  "পাশাপাশি",
+  "সরকারি",
+  "নানা",
+  "কর্মকর্তা",
+  "ছিল।",
+  "নামে",
+  "এরপর",
+  "নিশ্চিত",
+  "সুযোগ",
+  "বিষয়টি",
+  "শতাংশ",
+  "জেলা",
+  "কোন",
+  "আমাকে",
+  "কে",
+  "সম্পাদক",
+  "থাকে।",
+  "ফেব্রুয়ারি",
+  "ঘটনা",
+  "সিদ্ধান্ত",
+  "উপজেলা",
+  "বাংলা",
+  "অংশ",
+  "মামলা",
+  "এলাকায়",
+  "বের",
+  "দুটি",
+  "ওর",
+  "সাবেক",
+  "দেশ",
+  "হলেও",
+  "থেকেই",
+  "হাতে",
+  "মঙ্গলবার",
+  "হাত",
+  "আন্তর্জাতিক",
+  "লীগের",
+  "পরীক্ষা",
+  "আগামী",
+  "যাবে",
+  "থাকে",
+  "সাথে",
+  "এসে",
+  "সময়ে",
+  "হাসপাতালে",
+  "শিক্ষা",
+  "সবচেয়ে",
+  "সদস্য",
+  "মার্চ",
+  "যারা",
+  "পড়ে",
+  "হয়নি।",
+  "স্বাস্থ্য",
+  "দেখে",
+  "সভাপতি",
+  "৫",
+  "নারী",
+  "রাতে",
+  "কেন",
+  "বিভাগের",
+  "সামাজিক",
+  "২",
+  "করোনার",
+  "ঠিক",
+  "এখনো",
+  "দেন।",
+  "নেই",
+  "সোমবার",
+  "তাহলে",
+  "কম",
+  "ভারতের",
+  "করছে",
+  "দ্বিতীয়",
+  "আক্রান্ত",
+  "প্রধানমন্ত্রী",
+  "থাকতে",
+  "রাখতে",
+  "চেয়ে",
+  "আপনার",
+  "তাঁরা",
+  "ঘটনায়",
+  "অনুযায়ী",
+  "শেষে",
+  "হওয়া",
+  "একটু",
+  "চেয়ারম্যান",
+  "মারা",
+  "২০",
+  "বলতে",
+  "দল",
+  "গ্রহণ",
+  "গ্রামের",
+  "ছিলেন।",
+  "বুধবার",
+  "নির্বাচনে",
+  "সেটা",
+  "নেওয়ার",
+  "জানতে",
+  "পরিচালক",
+  "করছে।",
+  "খবর",
+  "অনুষ্ঠিত",
+  "দেখতে",
+  "রেখে",
+  "সংবাদ",
+  "রাখা",
+  "চার",
+  "বঙ্গবন্ধু",
+  "যাওয়ার",
+  "তদন্ত",
+  "সবাই",
+  "দায়িত্ব",
+  "উদ্ধার",
+  "৩",
+  "পুলিশের",
+  "করলে",
+  "পাঁচ",
+  "আইন",
+  "যাচ্ছে",
+  "বাইরে",
+  "তাঁকে",
+  "মাস",
+  "দেন",
+  "বাংলাদেশে",
+  "অর্থ",
+  "এখানে",
+  "সমস্যা",
+  "এগিয়ে",
+  "ড.",
+  "পরিবারের",
+  "অবস্থায়",
+  "প্রতিষ্ঠান",
+  "উপস্থিত",
+  "ব্যাংক",
+  "ভোট",
+  "যাবে।",
+  "বর্তমানে",
+  "সম্পর্কে",
+  "সংখ্যা",
+  "বিশ্ববিদ্যালয়",
+  "করছেন",
+  "বিশ্বের",
+  "এম",
+  "কিংবা",
+  "বিএনপির",
+  "মোহাম্মদ",
+  "ছবি",
+  "রাজনৈতিক",
+  "পালন",
+  "পেয়ে",
+  "প্রশ্ন",
+  "মাত্র",
+  "মা",
+  "অনুষ্ঠানে",
+  "বাড়ি",
+  "সম্ভব",
+  "কাজে",
+  "কয়েক",
+  "ব্যাংকের",
+  "ভাষা",
+  "ভর্তি",
+  "অন্যান্য",
+  "যার",
+  "সকালে",
+  "মৃত্যু",
+  "১৫",
+  "থাকার",
+  "মুখে",
+  "গেলে",
+  "প্রেসিডেন্ট",
+  "ব্যাপারে",
+  "সারা",
+  "নিরাপত্তা",
+  "নিহত",
+  "ফিরে",
+  "গড়ে",
+  "আপনি",
+  "৩০",
+  "ছোট",
+  "রাত",
+  "এলাকার",
+  "অব",
+  "অধ্যাপক",
+  "দিনের",
+  "সবার",
+  "নিজেদের",
+  "সকাল",
+  "৪",
+  "সাড়ে",
+  "দাম",
+  "দেয়।",
+  "গ্রেপ্তার",
+  "দিয়েছেন",
+  "শিক্ষার্থীদের",
+  "যাওয়া",
+  "অবস্থান",
+  "মোট",
+  "আরো",
+  "প্রার্থী",
+  "দ্রুত",
+  "খান",
+  "বিক্রি",
+  "যেমন",
+  "৬",
+  "বসে",
+  "পাশে",
+  "হক",
+  "বর্তমান",
+  "মাসে",
+  "বৃহস্পতিবার",
+  "এদিকে",
+  "দিয়েছে",
+  "করবে",
+  "করি",
+  "উঠে",
+  "কলেজ",
+  "জানুয়ারি",
+  "নামের",
+  "আবেদন",
+  "জানিয়েছেন",
+  "ডিজিটাল",
+  "মামলার",
+  "থানার",
+  "সৃষ্টি",
+  "উন্নয়ন",
+  "এত",
+  "টাকার",
+  "ঢাকার",
+  "ছেলে",
+  "পানি",
+  "হত্যা",
+  "আলোচনা",
+  "কমিটির",
+  "আহমেদ",
+  "শনিবার",
+  "পুরো",
+  "নম্বর",
+  "মার্কিন",
+  "২৫",
+  "আদালতে",
+  "আগের",
+  "হয়েছেন।",
+  "কেন্দ্রীয়",
+  "মৃত্যুর",
+  "কাছ",
+  "শিক্ষক",
+  "জানানো",
+  "উল্লেখ",
+  "দক্ষিণ",
+  "আর্থিক",
+  "শহীদ",
+  "আলী",
+  "সম্প্রতি",
+  "হয়েছিল",
+  "পদে",
+  "দশমিক",
+  "জীবন",
+  "বাবা",
+  "শুক্রবার",
+  "রাজধানীর",
+  "হন।",
+  "আহত",
+  "ঘরে",
+  "মামলায়",
+  "টাকা।",
+  "বক্তব্য",
+  "আশা",
+  "করছেন।",
+  "৭",
+  "যাচ্ছে।",
+  "হয়েছিল।",
+  "বিষয়",
+  "মূল",
+  "নেতা",
+  "নিজ",
+  "বাজারে",
+  "হয়তো",
+  "৫০",
+  "হয়েছেন",
+  "থাকলে",
+  "ঘটনার",
+  "হল",
+  "যান।",
+  "গুরুত্বপূর্ণ",
+  "অ্যান্ড",
+  "মেয়র",
+  "যুক্তরাষ্ট্রের",
+  "১১",
+  "ভূমিকা",
+  "দেশটির",
+  "পরিস্থিতি",
+  "পক্ষ",
+  "মাসের",
+  "দেয়",
+  "৮",
+  "চৌধুরী",
+  "খুলে",
+  "যোগ",
+  "জানিয়েছে",
+  "সেটি",
+  "সময়ের",
+  "আটক",
+  "২৪",
+  "থানায়",
+  "বছরে",
+  "১২",
+  "উত্তর",
+  "তারপর",
+  "বাড়িতে",
+  "সদর",
+  "পরিবর্তন",
+  "ইউনিয়নের",
+  "পরিকল্পনা",
+  "করবে।",
+  "পক্ষে",
+  "অতিরিক্ত",
+  "কার্যক্রম",
+  "স্ত্রী",
+  "তাতে",
+  "যোগাযোগ",
+  "অন্যতম",
+  "যাতে",
+  "৯",
+  "আগেই",
+  "পাঠানো",
+  "প্রতিবেদনে",
+  "মাঠে",
+  "হাসান",
+  "মাঝে",
+  "চালু",
+  "খাবার",
+  "নির্বাহী",
+  "বই",
+  "রোববার",
+  "সভায়",
+  "পথে",
+  "সড়ক",
+  "আলম",
+  "কখনো",
+  "কমিটি",
+  "সিটি",
+  "ঋণ",
+  "শিশু",
+  "চাইলে",
+  "প্রয়োজন",
+  "চিকিৎসা",
+  "চট্টগ্রাম",
+  "গেল",
+  "বিএনপি",
+  "লীগ",
+  "সংস্থা",
+  "প্রতিটি",
+  "বেড়ে",
+  "সেবা",
+  "আল",
+  "অবস্থা",
+  "পারেন।",
+  "জানায়",
+  "ব্যক্তি",
+  "যুক্ত",
+  "যেখানে",
+  "শিকার",
+  "থাকায়",
+  "বিয়ে",
+  "পণ্য",
+  "পরিমাণ",
+  "হওয়ায়",
+  "১৪",
+  "আবদুল",
+  "কাজের",
+  "কীভাবে",
+  "মধ্য",
+  "দিয়েছে।",
+  "ছয়",
+  "দিনে",
+  "পুলিশ।",
+  "হয়ে",
+  "আসা",
+  "চলছে।",
+  "দুপুরে",
+  "পরিষদের",
+  "ভারত",
+  "মেনে",
+  "মেডিকেল",
+  "বিশ্ব",
+  "থাকবে",
+  "কমে",
+  "রকম",
+  "ভাই",
+  "প্রতিবেদন",
+  "ছেড়ে",
+  "কয়েকটি",
+  "নিয়োগ",
+  "ফোন",
+  "নির্মাণ",
+  "বেসরকারি",
+  "দিয়ে",
+  "শহরের",
+  "দিয়েছেন।",
+  "উদ্দিন",
+  "ধরা",
+  "আসে",
+  "জাতির",
+  "পারেন",
+  "প্রাথমিক",
+  "উদ্যোগ",
+  "প্রকাশিত",
+  "আয়োজন",
+  "টেস্ট",
+  "১৮",
+  "ঘটে।",
+  "আলোকে",
+  "উপর",
+  "কিছুটা",
+  "বললেন",
+  "মুখ",
+  "খুবই",
+  "আসতে",
+  "তুমি",
+  "অবশ্য",
+  "লাশ",
+  "জন।",
+  "অভিযান",
+  "নির্দেশ",
+  "মুক্তি",
+  "অর্থনৈতিক",
+  "রাখার",
+  "সংশ্লিষ্ট",
+  "অন্তত",
+  "অর্থাৎ",
+  "প্রতিষ্ঠানের",
+  "আইনের",
+  "তোমার",
+  "তিনটি",
+  "ডিসেম্বর",
+  "অথচ",
+  "ধারণা",
+  "হন",
+  "অনেকেই",
+  "এমনকি",
+  "ক্ষমতা",
+  "পর্যায়ে",
+  "শিক্ষার্থী",
+  "ছড়িয়ে",
+  "ম্যাচে",
+  "আছেন",
+  "নিয়মিত",
+  "ক্রিকেট",
+  "জনের",
+  "হার",
+  "চালিয়ে",
+  "পাওয়ার",
+  "করি।",
+  "তৃতীয়",
+  "আহ্বান",
+  "বিপক্ষে",
+  "থাকলেও",
+  "অন্যদিকে",
+  "২০২০",
+  "বলছেন",
+  "বৃদ্ধি",
+  "বুঝতে",
+  "চলতি",
+  "স্বাধীনতার",
+  "২১",
+  "এসেছে",
+  "বাংলাদেশি",
+  "ছাত্র",
+  "ভিডিও",
+  "নিয়ে",
+  "ফল",
+  "জেলার",
+  "করবেন",
+  "পরীক্ষার",
+  "জানান।",
+  "১৭",
+  "নিজেকে",
+  "সুবিধা",
+  "নির্বাচনের",
+  "অর্জন",
+  "পেতে",
+  "বাসায়",
+  "লেখা",
+  "প্রদান",
+  "যেসব",
+  "কর্মসূচি",
+  "দীর্ঘ",
+  "মন্ত্রণালয়ের",
+  "লেখক",
+  "বিশ্বাস",
+  "সচিব",
+  "স্বাভাবিক",
+  "সহকারী",
+  "বলল",
+  "জমা",
+  "থাকবে।",
+  "ভাগ",
+  "ম্যাচ",
+  "রহমানের",
+  "যান",
+  "বললাম",
+  "প্রভাব",
+  "জীবনের",
+  "পরিচালনা",
+  "সম্পর্ক",
+  "বেশি।",
+  "কৃষি",
+  "ধীরে",
+  "১৩",
+  "আন্দোলন",
+  "করোনাভাইরাসের",
+  "জানিয়ে",
+  "বেলা",
+  "বঙ্গবন্ধুর",
+  "মানুষকে",
+  "তারা।",
+  "২০১৯",
+  "এভাবে",
+  "১৬",
+  "অবশ্যই",
+  "মোবাইল",
+  "এছাড়া",
+  "ভেঙে",
+  "করেছি।",
+  "নির্বাচিত",
+  "বয়স",
+  "সূত্রে",
+  "সাত",
+  "সামরিক",
+  "অধিকার",
+  "আসামি",
+  "সাংবাদিক",
+  "আসার",
+  "গবেষণা",
+  "ঢাকায়",
+  "হঠাৎ",
+  "অথবা",
+  "কেন্দ্র",
+  "যদিও",
+  "মাথায়",
+  "পান",
+  "ফেলে",
+  "বরং",
+  "অভিনয়",
+  "আদালত",
+  "পেছনে",
+  "অনেকে",
+  "বিচার",
+  "তেমন",
+  "পথ",
+  "আসে।",
+  "কত",
+  "মেয়ে",
+  "অভিযোগে",
+  "ব্যাপক",
+  "৪০",
+  "রায়",
+  "প্রথমে",
+  "২২",
+  "ভারতীয়",
+  "মধ্যেই",
+  "উপলক্ষে",
+  "করছি।",
+  "খেতে",
+  "রান",
+  "নাকি",
+  "সহায়তা",
+  "জরুরি",
+  "রাজশাহী",
+  "নারীর",
+  "ভ্যাকসিন",
+  "অত্যন্ত",
+  "জায়গা",
+  "পরিবেশ",
+  "সবাইকে",
+  "কারও",
+  "চাই",
+  "বলছে",
+  "রক্ষা",
+  "বাকি",
+  "বিভাগ",
+  "চাকরি",
+  "সম্মেলনে",
+  "হত্যার",
+  "উচ্চ",
+  "ফেসবুক",
+  "গেল।",
+  "হলো।",
+  "বাজার",
+  "এসেছে।",
+  "গান",
+  "পদক্ষেপ",
+  "পরবর্তী",
+  "বাস",
+  "জায়গায়",
+  "সংক্রমণ",
+  "২৮",
+  "প্রতিদিন",
+  "মত",
+  "আনা",
+  "সকল",
+  "পরিবার",
+  "মন্তব্য",
+  "স্থানে",
+  "করা।",
+  "সঠিক",
+  "ইউনিয়ন",
+  "মূলত",
+  "সুস্থ",
+  "নেমে",
+  "২০১৮",
+  "কারাগারে",
+  "সাল",
+  "আসলে",
+  "পরও",
+  "ভাষার",
+  "শরীরে",
+  "ওসি",
+  "যায়নি।",
+  "অনলাইন",
+  "সর্বোচ্চ",
+  "হারিয়ে",
+  "জেনারেল",
+  "কাদের",
+  "সাহায্য",
+  "হোক",
+  "করোনাভাইরাস",
+  "চলছে",
+  "প্রকল্প",
+  "খারাপ",
+  "সেরা",
+  "কেবল",
+  "লক্ষ্য",
+  "সংসদ",
+  "আয়",
+  "জয়",
+  "পরামর্শ",
+  "সৌদি",
+  "দিবস",
+  "লাভ",
+  "সংগ্রহ",
+  "খাতে",
+  "নেতৃত্বে",
+  "বলেন।",
+  "ভুল",
+  "আওতায়",
+  "দাবিতে",
+  "আবু",
+  "জন্য।",
+  "বিক্ষোভ",
+  "গঠন",
+  "হিসাবে",
+  "কার্যকর",
+  "পাকিস্তানের",
+  "চীনের",
+  "নিয়ন্ত্রণ",
+  "করুন।",
+  "ব্যবসা",
+  "দিক",
+  "করেই",
+  "প্রকল্পের",
+  "ভারপ্রাপ্ত",
+  "নিচে",
+  "হামলা",
+  "জনগণের",
+  "মুজিবুর",
+  "দূর",
+  "ওষুধ",
+  "গুরুত্ব",
+  "১৯",
+  "ভিত্তিতে",
+  "করেছিলেন",
+  "কয়েকজন",
+  "চান",
+  "জড়িত",
+  "পৃথিবীর",
+  "দিলে",
+  "গাড়ি",
+  "আদালতের",
+  "পড়ে।",
+  "জন্ম",
+  "প্রয়োজনীয়",
+  "ভেতরে",
+  "ঘরের",
+  "চাপ",
+  "পরিচয়",
+  "বাড়ির",
+  "প্রযুক্তি",
+  "উচিত",
+  "নির্দেশনা",
+  "সরাসরি",
+  "খেলা",
+  "বেগম",
+  "ডা",
+  "যেকোনো",
+  "হাসপাতালের",
+  "ব্যবস্থাপনা",
+  "পেয়েছেন",
+  "চোখ",
+  "মাথা",
+  "অনুমতি",
+  "২৬",
+  "দরকার",
+  "পা",
+  "বহু",
+  "জনপ্রিয়",
+  "পারি",
+  "উইকেট",
+  "কিছুই",
+  "থেকে।",
+  "কলেজের",
+  "দ্য",
+  "মন",
+  "স্বাধীনতা",
+  "এরই",
+  "মে",
+  "সূত্র",
+  "সরকার।",
+  "আবুল",
+  "আন্দোলনের",
+  "কেমন",
+  "পুরস্কার",
+  "আরেক",
+  "শিক্ষার্থীরা",
+  "প্রস্তাব",
+  "গল্প",
+  "প্রমাণ",
+  "মন্ত্রণালয়",
+  "পোশাক",
+  "চোখে",
+  "গ্রেফতার",
+  "পারবে",
+  "বাধা",
+  "বিশ্ববিদ্যালয়ে",
+  "শহরে",
+  "কেটে",
+  "অনুমোদন",
+  "এলাকা",
+  "শরীরের",
+  "২৩",
+  "চিন্তা",
+  "ছাত্রলীগের",
+  "একাধিক",
+  "প্রশাসন",
+  "বিকেলে",
+  "সুন্দর",
+  "যাদের",
+  "লাখ টাকা",
+  "খরচ",
+  "একে",
+  "প্রধানমন্ত্রীর",
+  "নদীর",
+  "পরিণত",
+  "ব্যক্তির",
+  "সাংবাদিকদের",
+  "সম্পন্ন",
+  "খুঁজে",
+  "রোগ",
+  "চিকিৎসক",
+  "প্রস্তুতি",
+  "অবৈধ",
+  "ঘণ্টা",
+  "আস্তে",
+  "কঠিন",
+  "উন্নত",
+  "ছবির",
+  "লক্ষ্যে",
+  "উৎপাদন",
+  "আলাদা",
+  "জীবনে",
+  "স্কুল",
+  "চূড়ান্ত",
+  "বিদেশি",
+  "লোকজন",
+  "ক্ষতি",
+  "স্বামী",
+  "ঘুরে",
+  "তালিকায়",
+  "হাসিনা",
+  "দেয়া",
+  "খাতের",
+  "ডলার",
+  "শিশুদের",
+  "সহযোগিতা",
+  "জানি",
+  "পয়েন্ট",
+};
+const uint16_t WA_FREQ_15_RANKS[] = {
+  473, 0, 0, 0, 0, 0, 63, 0, 0, 869, 114, 0, 0, 0, 0, 14,
+  0, 753, 0, 2, 342, 166, 776, 317, 834, 712, 0, 0, 556, 610, 771, 899,
+  255, 0, 331, 0, 561, 0, 0, 613, 0, 0, 0, 0, 160, 997, 493, 66,
+  87, 951, 422, 612, 639, 425, 598, 472, 168, 80, 197, 487, 451, 514, 653, 678,
+  686, 694, 739, 987, 805, 674, 99, 181, 659, 0, 982, 510, 0, 0, 529, 426,
+  379, 454, 0, 0, 0, 134, 537, 963, 930, 0, 0, 0, 0, 830, 0, 0,
+  0, 0, 0, 0, 440, 0, 0, 0, 215, 0, 0, 403, 494, 0, 0, 0,
+  0, 713, 192, 446, 0, 79, 0, 74, 991, 682, 887, 933, 857, 0, 0, 0,
+  0, 0, 0, 182, 644, 0, 0, 264, 672, 0, 0, 0, 0, 743, 278, 673,
+  0, 0, 0, 833, 0, 89, 0, 173, 968, 20, 0, 0, 0, 0, 844, 0,
+  423, 100, 196, 579, 855, 157, 139, 450, 226, 589, 617, 764, 0, 0, 0, 0,
+  0, 95, 594, 0, 0, 0, 0, 0, 0, 0, 353, 0, 0, 0, 0, 57,
+  456, 0, 770, 0, 0, 0, 0, 0, 992, 0, 0, 120, 0, 848, 185, 0,
+  435, 0, 641, 400, 790, 0, 0, 0, 0, 0, 69, 148, 802, 0, 538, 0,
+  187, 0, 0, 0, 0, 0, 0, 0, 0, 345, 0, 0, 0, 0, 0, 0,
+  131, 0, 0, 0, 513, 0, 0, 0, 0, 0, 0, 810, 908, 958, 0, 136,
+  767, 0, 635, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 952, 0, 0,
+  631, 0, 0, 0, 332, 871, 544, 709, 637, 0, 241, 0, 7, 0, 838, 728,
+  0, 0, 355, 0, 394, 470, 347, 0, 0, 424, 0, 722, 878, 273, 0, 979,
+  0, 0, 0, 0, 0, 327, 37, 890, 295, 325, 417, 152, 621, 0, 0, 0,
+  0, 184, 548, 778, 279, 829, 0, 563, 0, 0, 222, 683, 954, 740, 0, 0,
+  0, 375, 0, 0, 0, 0, 0, 0, 0, 0, 663, 913, 0, 0, 285, 562,
+  0, 0, 313, 0, 0, 0, 0, 0, 0, 535, 866, 932, 0, 6, 909, 0,
+  31, 0, 0, 322, 158, 370, 623, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 252, 381, 0, 0, 0, 0, 24, 0, 0, 0, 0, 0, 986,
+  368, 491, 711, 573, 785, 914, 267, 320, 0, 898, 55, 0, 384, 557, 736, 170,
+  203, 488, 625, 818, 860, 189, 688, 85, 0, 269, 103, 856, 433, 47, 942, 348,
+  896, 0, 495, 0, 0, 760, 0, 481, 442, 985, 583, 608, 695, 721, 0, 567,
+  643, 281, 0, 995, 0, 0, 843, 0, 846, 290, 0, 0, 0, 216, 0, 826,
+  0, 0, 0, 204, 797, 967, 141, 0, 0, 0, 0, 0, 994, 590, 0, 948,
+  0, 0, 0, 0, 54, 670, 0, 0, 0, 0, 484, 505, 903, 801, 0, 0,
+  0, 365, 864, 0, 553, 406, 735, 444, 0, 775, 0, 676, 16, 393, 0, 0,
+  129, 364, 565, 974, 0, 527, 162, 432, 0, 779, 0, 0, 0, 0, 837, 258,
+  706, 336, 307, 768, 970, 0, 232, 0, 0, 453, 0, 105, 151, 208, 445, 543,
+  791, 851, 0, 0, 0, 153, 601, 703, 897, 0, 881, 0, 0, 382, 0, 0,
+  0, 0, 511, 0, 0, 677, 0, 409, 0, 0, 0, 0, 466, 0, 0, 0,
+  0, 524, 0, 0, 699, 0, 421, 568, 902, 800, 260, 0, 0, 339, 299, 570,
+  620, 330, 0, 405, 0, 720, 730, 25, 959, 700, 998, 62, 525, 9, 253, 540,
+  150, 581, 190, 496, 714, 798, 227, 854, 949, 0, 0, 0, 0, 0, 431, 604,
+  718, 723, 154, 171, 478, 752, 893, 0, 960, 554, 0, 925, 0, 0, 0, 0,
+  0, 600, 660, 0, 936, 605, 0, 41, 757, 0, 0, 0, 809, 842, 371, 0,
+  0, 0, 0, 0, 0, 460, 587, 22, 207, 749, 0, 0, 0, 195, 588, 0,
+  0, 0, 18, 401, 449, 0, 0, 813, 0, 0, 0, 0, 310, 539, 0, 249,
+  766, 0, 0, 0, 0, 0, 597, 0, 839, 230, 0, 0, 188, 691, 19, 110,
+  112, 482, 499, 0, 239, 0, 213, 388, 817, 0, 0, 300, 783, 773, 0, 122,
+  577, 0, 0, 0, 667, 0, 961, 0, 0, 772, 989, 0, 0, 0, 0, 0,
+  551, 652, 679, 0, 873, 455, 52, 176, 231, 794, 0, 0, 0, 214, 0, 0,
+  254, 769, 955, 318, 520, 0, 0, 879, 142, 383, 0, 0, 761, 335, 0, 0,
+  697, 0, 847, 944, 0, 0, 0, 86, 807, 0, 0, 402, 0, 774, 475, 0,
+  0, 429, 593, 70, 704, 205, 0, 0, 781, 193, 191, 687, 0, 0, 115, 0,
+  71, 654, 0, 822, 0, 247, 237, 0, 229, 483, 937, 0, 0, 0, 841, 808,
+  209, 390, 0, 430, 867, 0, 717, 0, 0, 0, 0, 236, 0, 0, 0, 296,
+  0, 0, 950, 0, 758, 0, 0, 0, 978, 362, 920, 0, 636, 309, 0, 0,
+  5, 109, 147, 707, 420, 471, 0, 0, 0, 396, 777, 907, 0, 0, 0, 0,
+  174, 0, 0, 0, 0, 0, 0, 0, 303, 0, 372, 240, 377, 476, 0, 0,
+  0, 0, 0, 507, 233, 603, 0, 266, 0, 0, 0, 366, 546, 387, 386, 634,
+  628, 0, 0, 0, 0, 0, 0, 0, 286, 0, 45, 128, 912, 78, 996, 547,
+  0, 0, 198, 0, 238, 0, 780, 0, 96, 595, 0, 50, 750, 0, 0, 272,
+  0, 0, 0, 0, 0, 0, 0, 924, 0, 803, 77, 918, 0, 786, 0, 0,
+  0, 0, 0, 448, 437, 0, 0, 0, 0, 293, 0, 0, 398, 0, 0, 0,
+  895, 1, 0, 465, 719, 0, 607, 0, 0, 0, 133, 0, 0, 0, 26, 75,
+  169, 664, 0, 221, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 280,
+  956, 0, 759, 705, 337, 140, 0, 0, 83, 0, 0, 0, 0, 0, 0, 0,
+  344, 106, 0, 4, 0, 0, 0, 0, 352, 0, 0, 0, 0, 0, 0, 0,
+  389, 271, 194, 104, 840, 0, 0, 0, 650, 0, 0, 0, 130, 180, 656, 827,
+  725, 17, 572, 0, 984, 906, 0, 0, 0, 0, 929, 0, 574, 0, 0, 35,
+  123, 0, 0, 0, 0, 212, 224, 463, 0, 0, 517, 0, 0, 373, 787, 811,
+  0, 291, 245, 0, 51, 0, 0, 0, 0, 0, 0, 0, 973, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 532, 268, 284, 900, 0,
+  0, 228, 126, 315, 522, 602, 823, 850, 0, 894, 202, 378, 294, 467, 0, 0,
+  0, 434, 248, 121, 391, 441, 609, 0, 0, 0, 0, 0, 0, 0, 988, 0,
+  0, 0, 640, 0, 999, 49, 0, 116, 519, 0, 411, 0, 657, 0, 591, 0,
+  200, 0, 0, 155, 42, 0, 0, 0, 821, 0, 874, 0, 981, 716, 762, 825,
+  905, 861, 0, 0, 0, 0, 0, 40, 415, 0, 0, 21, 0, 0, 179, 0,
+  108, 756, 59, 0, 0, 111, 186, 235, 0, 0, 410, 0, 289, 0, 447, 270,
+  0, 0, 0, 0, 0, 0, 690, 0, 0, 0, 0, 497, 0, 0, 338, 0,
+  812, 888, 0, 117, 515, 0, 443, 73, 0, 76, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 159, 702, 0, 0, 582, 0, 0, 223, 414, 0, 615, 724,
+  980, 0, 0, 305, 0, 0, 91, 575, 326, 578, 234, 436, 976, 118, 0, 350,
+  0, 751, 219, 218, 0, 0, 0, 397, 0, 0, 0, 630, 210, 311, 314, 0,
+  0, 0, 0, 201, 0, 399, 407, 765, 940, 0, 0, 0, 727, 217, 502, 836,
+  0, 0, 0, 84, 0, 692, 0, 0, 626, 819, 922, 552, 820, 0, 559, 886,
+  0, 566, 0, 0, 0, 0, 392, 265, 0, 30, 408, 349, 0, 0, 0, 0,
+  0, 0, 745, 0, 0, 0, 0, 541, 363, 614, 645, 0, 0, 506, 0, 875,
+  0, 0, 0, 0, 858, 0, 0, 0, 863, 0, 0, 733, 43, 542, 0, 0,
+  0, 592, 0, 0, 747, 0, 0, 0, 0, 321, 225, 523, 0, 0, 966, 558,
+  638, 175, 793, 301, 804, 164, 934, 0, 0, 0, 0, 0, 0, 33, 0, 486,
+  65, 0, 859, 622, 464, 462, 746, 0, 0, 0, 571, 693, 132, 0, 0, 199,
+  334, 0, 0, 92, 0, 0, 32, 178, 534, 0, 508, 953, 480, 941, 0, 0,
+  0, 0, 119, 0, 0, 461, 0, 0, 0, 990, 149, 457, 124, 943, 0, 0,
+  799, 0, 0, 715, 0, 533, 865, 1000, 0, 29, 509, 549, 356, 915, 0, 0,
+  935, 658, 0, 0, 0, 0, 0, 211, 0, 0, 0, 0, 395, 828, 816, 0,
+  0, 0, 0, 0, 244, 263, 0, 48, 698, 490, 0, 0, 0, 0, 0, 0,
+  144, 39, 748, 0, 0, 872, 333, 13, 972, 0, 0, 0, 0, 0, 98, 306,
+  632, 0, 560, 485, 0, 0, 316, 732, 359, 0, 0, 0, 0, 438, 416, 0,
+  806, 911, 297, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 938, 0, 0, 88, 910, 0, 737, 564, 619, 824, 0, 0, 324, 0, 0,
+  0, 167, 0, 0, 0, 0, 0, 528, 0, 0, 891, 0, 0, 0, 0, 555,
+  0, 0, 0, 0, 0, 0, 0, 256, 0, 586, 0, 0, 0, 681, 939, 0,
+  0, 599, 0, 0, 0, 283, 304, 618, 0, 292, 0, 0, 0, 0, 412, 357,
+  427, 646, 3, 36, 146, 0, 67, 0, 282, 880, 477, 0, 0, 38, 474, 701,
+  0, 0, 917, 12, 351, 288, 0, 143, 0, 0, 0, 0, 458, 0, 0, 0,
+  0, 308, 156, 569, 137, 275, 754, 969, 0, 0, 0, 0, 367, 0, 647, 0,
+  0, 928, 44, 183, 298, 404, 971, 501, 27, 0, 0, 744, 0, 876, 276, 550,
+  633, 93, 977, 0, 0, 0, 0, 56, 58, 0, 0, 0, 0, 696, 341, 789,
+  710, 853, 0, 0, 0, 0, 883, 0, 0, 206, 0, 0, 0, 469, 726, 0,
+  518, 0, 0, 0, 0, 792, 0, 993, 0, 946, 661, 0, 755, 261, 113, 0,
+  0, 0, 0, 0, 0, 576, 340, 536, 360, 624, 346, 319, 832, 380, 629, 343,
+  669, 385, 796, 500, 862, 845, 889, 530, 531, 503, 0, 0, 312, 684, 0, 927,
+  0, 580, 852, 82, 0, 0, 0, 931, 0, 0, 0, 0, 0, 28, 0, 741,
+  0, 53, 0, 220, 0, 172, 0, 61, 0, 0, 584, 0, 0, 0, 0, 0,
+  90, 0, 0, 0, 101, 0, 0, 921, 0, 877, 46, 0, 0, 0, 0, 0,
+  795, 892, 919, 0, 0, 0, 0, 585, 138, 0, 177, 60, 161, 0, 0, 0,
+  0, 0, 0, 627, 0, 0, 655, 0, 648, 649, 964, 125, 0, 616, 413, 642,
+  975, 0, 94, 0, 0, 0, 0, 0, 479, 788, 0, 0, 0, 0, 8, 102,
+  0, 376, 329, 358, 369, 606, 651, 0, 0, 962, 882, 0, 0, 0, 262, 0,
+  0, 68, 734, 957, 983, 0, 0, 689, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 671, 0, 0, 0, 163, 361, 782, 0, 0, 0, 0, 0, 259, 257, 15,
+  0, 0, 0, 665, 815, 0, 0, 489, 0, 0, 287, 545, 611, 835, 884, 945,
+  0, 0, 243, 742, 165, 328, 0, 680, 0, 418, 916, 0, 0, 596, 459, 675,
+  504, 512, 0, 0, 0, 10, 0, 0, 0, 0, 831, 0, 135, 0, 0, 885,
+  926, 870, 0, 0, 814, 64, 0, 516, 439, 0, 107, 0, 0, 11, 34, 0,
+  0, 0, 302, 250, 0, 81, 0, 0, 0, 0, 901, 947, 0, 468, 0, 0,
+  23, 0, 354, 97, 251, 498, 277, 666, 868, 0, 0, 0, 0, 0, 145, 708,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 965, 0, 0, 0, 274, 784, 0,
+  0, 0, 668, 685, 849, 0, 0, 0, 452, 0, 0, 0, 72, 0, 0, 0,
+  662, 492, 904, 0, 0, 526, 127, 0, 419, 729, 738, 0, 428, 521, 0, 0,
+  0, 0, 0, 374, 0, 242, 0, 763, 923, 731, 0, 0, 0, 0, 246, 323,
+};
+
+const char *WA_FREQ_16_TOKENS[] = {
+  "དུང་དཀར་ཚིག་མཛོད་ཆེན་མོ་",
+  "༽ལས་བཏུས།",
+  "དེའི་རྒྱལ་ས་ནི་",
+  "་རྒྱལ་ས་རེད།",
+  "་རྒྱལ་ཁབ་ཞིག་རེད།",
+  "ལོ་རྒྱུས།",
+  "ད་དུང་གཟིགས།",
+  "༡",
+  "༽ནས་བཏུས།",
+  "ཟིན་ཐོ་འམ་དཔྱད་གཞི།",
+  "གསུང་རབ་ནང",
+  "་ཁབ་ཞིག་རེད།",
+  "དཔྱད་གཞིའི་དཀར་ཆག།",
+  "པར་རིས་བར་འཁྱམས།",
+  "༢",
+  "་གྲོང་རྡལ་ཞིག་རེད།",
+  "དབྱིན་ཇིའི་སྐད།",
+  "་རིགས་གཅིག་རེད།",
+  "་འཁོད།",
+  "་བུ་ཡིན་ཞེས་",
+  "༣",
+  "ཆོས་ལུགས།",
+  "ཐའེ་ལེན་གྱི",
+  "༤",
+  "དཔེར་ན།",
+  "མི་འབོར།",
+  "ཨ་ཧྥེ་རི་ཁའི་རྒྱལ",
+  "ཕྱི་ཕྱོགས་དྲ་མཐུད།",
+  "ས་ཁམས།",
+  "ཧྥ་རན་སིའི་སྐད།",
+  "འུ་འཐུང་སྲོག་ཆགས་ཀྱི",
+  "མིང་འབྱུང་ཚུལ།",
+  "རྒྱ་སྐད།",
+  "་རེད།",
+  "ཉི་ཧོང་སྐད།",
+  "ཚེས་",
+  "ཨ་མེ་རི་ཁ་རྒྱལ་ཕྲན་མཉམ་འབྲེལ་རྒྱལ་ཁབ་ཀྱི",
+  "༦",
+  "༥",
+  "ཟླ་",
+  "གསལ་བཤད།",
+  "ཨེ་ཤེ་ཡ་ཡི",
+  "ཕྱི་ལོ་",
+  "དཔལ་འབྱོར།",
+  "ཡོ་རོབ་གླིང་གི་རྒྱལ",
+  "༧",
+  "ཨ་མེ་རི་ཁ་གླིང་ཆེན་གྱི",
+  "༡༠",
+  "་གི་མི་སྣ་གཅིག་རེད།",
+  "༡༡",
+  "ཡི་ཏ་ལིའི་སྐད།",
+  "རྐྱ་མི་",
+  "་ཞིང་ཆེན་ཞིག་རེད།",
+  "་རི་མོ་མཁས་ཅན་ཞིག་རེད།",
+  "མི་ཚེ།",
+  "ཨི་ཏ་ལི་ཡི",
+  "རྒྱ་གར་གྱི",
+  "སྐྱེལ་འདྲེན།",
+  "་རྡལ་ཞིག་རེད།",
+  "རྡ་ས།",
+  "་ཆེན་ཞིག་རེད།",
+  "་པའི་མི་རིགས་ཀྱི་མི་རེད།",
+  "ཉི་ཧུང་གི",
+  "༩",
+  "་གཅིག་རེད།",
+  "༡༢",
+  "ཀྲུང་གོའི་ཞིང",
+  "ནས་",
+  "ཨ་རིའི་ཞིང་དུ་སླེབས་ན་རང་འགྲིགས་ཡིན།།",
+  "ཨི་ཏ་ལིའི་སྐད།",
+  "༨",
+  "ཨ་རབ་སྐད།",
+  "༡༣",
+  "་བེད་སྤྱོད་བྱེད།",
+  "༢༠༠༨",
+  "གླང་རྒོད།",
+  "དཔྱད་གཞིའི་དཀར་ཆག",
+  "ལས་རིགས་གཅིག",
+  "ཤིང་ཏོག་རིགས",
+  "༡༤",
+  "༢༠༠༩",
+  "གཙོོ་ངོས།",
+  "ཅིན་ཞེན་ཁྲུང་།",
+  "མཚོན་རྟགས།",
+  "རྒྱ་མཚོ་ཆེན་པོའི་གླིང་ཆེན་གྱི",
+  "ཤོག་ངོས་ཀྱི་ཁུངས།",
+  "༣༡",
+  "de",
+  "་གོམས་སྲོལ་གྱི་རིག་རྩལ་ལམ་སྒྱུ་རྩལ་ལོ།",
+  "་དགོན་སྡེ་གཅིག་རེད།",
+  "༡༥",
+  "ཆོས་རྗེ་སྨར་པའི་ཞབས་ལ་གསོལ་བ་འདེབས།",
+  "ནི་",
+  "ཟླ་བ་",
+  "ལྗོངས་རྒྱུ།",
+  "སྔོ་ཚལ་གྱི",
+  "དགེ་ལུགས་པའི་",
+  "མེ་ཏོག་གཅིག",
+  "སངས་རྒྱས་ཆོས་ལུགས་ཀྱི་བཤད་སྲོལ་ལ།",
+  "西藏独立",
+  "di",
+  "་ཆབ་སྲིད་མཁས་ཅན་ཞིག་རེད།",
+  "་སྟེ་",
+  "ཁོར་ཡུག",
+  "དུས་ཆེན།",
+  "མི་སྣ།",
+  "འགུལ་རིས།",
+  "རྩོམ་པ་པོ།",
+  "ཧྥ་རན་སིའི་གྲོང",
+  "་ཅན་ཞིག་རེད།",
+  "༢༠༠༦",
+  "དཀར་པོ་སྐྱ།",
+  "ཕྱི་ཕྱོགས་དྲྭ་མཐུད།",
+  "བྱས་པ།",
+  "མགྲོན་ཁང་།",
+  "རི་མོ་མཁས",
+  "ལེགས་སྦྱར་སྐད།",
+  "ལྟ་བུ།",
+  "་ལྟེ་བའི་གྲོང་ཁྱེར་རེད།",
+  "༤༢",
+  "ཀྲུང་ཧྭ་མི་དམངས་སྤྱི་མཐུན་རྒྱལ་ཁབ་ཞེས",
+  "གྲངས་ཞིག",
+  "ཟེར།",
+  "ཡང་ན།",
+  "སྐད་པར་ཕན་ཙེ་དབྱེ་བའི་དཀར་ཆག།",
+  "་རྗེས་མ་དང་",
+  "་རྩོམ་པ་པོ་ཞིག་རེད།",
+  "་སྔོན་དུ་ཡིན།",
+  "་སྡེ་གཅིག་རེད།",
+  "༡༦",
+  "༡༩",
+  "༥༢",
+  "དང་པོ།",
+  "མིང་ཐོགས་ཚུལ།",
+  "འབྲུག་ཡུལ་གྱི",
+  "ཡུལ་ཚོ།",
+  "སྤྱི་འཐུས་ལས་ཐོག",
+  "Dr",
+  "of",
+  "་གི་གལ་ཆེའི་མི་སྣ་རེད།",
+  "་ས་ཁོངས་གཅིག་རེད།",
+  "༢༠༡༠",
+  "༽ནང་གི་མི་སྣ་གཅིག་རེད།",
+  "ཀོ་མེ་དི་ཡ་དེལ་ཨར་ཏེའི་ནང",
+  "གཞན་བརྟེན་གནོད་འབུ།",
+  "གསུམ་པ།",
+  "མི་རིགས་ཡང་རྩེར་སོན་པའི་དན་རྟགས་ཡིན།།",
+  "ཡུལ་སྐོར།",
+  "རི་པིན་གྱིས",
+  "ལུས་རྩལ་གྱི",
+  "ལེགས",
+  "སྔོན་པོ་སྐྱ།",
+  "སྤྱི་ལོ་",
+  "ཧིན་དུ་ཡི་ལྷ་རེད",
+  "ཧྥ་རན་སིའི་",
+  "du",
+  "××××ལོའི་ཟླ××ཚེས××ལ།",
+  "་གཙོ་བོ་ཞིག་རེད།",
+  "་ཡིན།",
+  "་ཡོད།",
+  "་སྔོན་དུ་རེད།",
+  "་སྤྱོད་པའི་བོད་ཀྱི་ཡུལ་སྐད་གཅིག་ཡིན།",
+  "༡བར།",
+  "༢༡",
+  "༦༨",
+  "གཅིག",
+  "གཉིས་པ།",
+  "ངོ་སྤྲོད་མདོར་བསྡུས།",
+  "ཆུ་ངོགས་གཏམ་རྒྱུད་",
+  "ཏིན་ཏིན་གྱི་དཔའ་རྩལ་ནང",
+  "ནག་པོ་སྐྱ།",
+  "ནང་པ་སངས་རྒྱས་ཀྱི་ལྷ",
+  "བཀའ་བརྒྱུད་པའི་དགོན",
+  "མགུལ་རྒྱན།",
+  "རི་པིན་གྱི",
+  "རྒྱ་གར་དུ",
+  "རྒྱུ།",
+  "སུ་རུ་མེ་ཏོག་གིས་བསྒྲིགས།",
+  "ཧྥ་རན་སི་ཡི",
+  "Giovanni",
+  "and",
+  "e",
+  "i",
+  "་ཁུལ་དུ་བེད་སྤྱོད་བྱེད།",
+  "་དུང་",
+  "་པ་པོ་ཞིག་རེད།",
+  "་བ་རེད།",
+  "་བུད་མེད་ཆབ་སྲིད་མཁས་ཅན་ཞིག་རེད།",
+  "་མཚན་ཉིད་རིག་པ་ཞིག་རེད།",
+  "་རིགས་ཞིག་རེད།",
+  "་རྗེས་དང་",
+  "་སྙན་ངག་པ་ཞིག་རེད།",
+  "་སྲོལ་གྱི་རིག་རྩལ་ལམ་སྒྱུ་རྩལ་ལོ།",
+  "༡༠བར།",
+  "༡༧",
+  "༡༨",
+  "༢༧",
+  "༣༩",
+  "༥༧",
+  "གྲང་",
+  "དཔྱད་གཞི།",
+  "དབྱིན་ཇིའི་སྐད་དུ་",
+  "དེས་",
+  "པའི་ནང་ཞི་རྒོལ་ཐེངས་",
+  "པོ་",
+  "བར་",
+  "བལ་ཡུལ་དུ",
+  "བྷོ་ལི་ཝི་ཡ་གྱི",
+  "མཛད་པ་པོ།",
+  "འབྲུ་རིགས་གཅིག",
+  "འབྲུག་ཡུལ་ས",
+  "ཡོང་ཁུངས།",
+  "རང་རིགས་རྗེས་སུ་ལུས་པའི་དན་རྟགས་ཡིན།།",
+  "རྡོག་རྩ་གོང་བུ་གཅིག་སྒྲིལ་གནང་དང༌།།",
+  "ལམ།",
+  "ལྟ་བུའོ།",
+  "ལྡི་ལི།",
+  "ཤིང་གི",
+  "སྐྱུར་བ།",
+  "སྣ།",
+  "ཨ་རི།",
+  "大藏区",
+  "2",
+  "New",
+  "www",
+  "नास्ति",
+  "་གི་འཁྲབ་སྟོན་པ་གཅིག་རེད།",
+  "་གྲོང་རྡལ་གཅིག་རེད།",
+  "་ཆ་ཞིག་རེད།",
+  "་ཆོས་ལུགས་ཞིག་རེད།",
+  "་པ་རེད།",
+  "་ས་ཁུལ་དུ་བེད་སྤྱོད་བྱེད།",
+  "་སྤྱོད་པའི་བོད་ཀྱི་",
+  "༢༠",
+  "༢༠༠༣",
+  "༢༢",
+  "༢༩",
+  "༣༢",
+  "༣༦",
+  "༣༨",
+  "༥༠",
+  "༧༣",
+  "༼སྙུང་གཟུགས་བང་སོའི་འོག་གི་ཨི་ཇིབ།༽",
+  "ཀྱེ་ཨ་ཅག་ལགས།",
+  "ཁ་བ།",
+  "གཉིས།",
+  "གནང་བ་གཤམ་གསལ།",
+  "གྱུར།།",
+  "གློག་བརྙན་དཀར་ཆག་ཆ་ཚང་།",
+  "ཆུ།",
+  "ཐག་རྒུལ་འདྲ་གཟུགས་ཡིན",
+  "དགེ་འདུན་ཆོས་འཕེལ།",
+  "དགོང་པ་མའཚོམ།",
+  "དགོངས་ཞུ།",
+  "དང་",
+  "དང༌།",
+  "དངུལ།",
+  "དབུ་རྒྱན།",
+  "དབྱེ་ན།",
+  "དུས།",
+  "དེ་",
+  "དོ་ཤལ།",
+  "ནོར་བྷེལ་བྱ་དགའ་རག",
+  "ཕ་རན་སིའི་སྐད།",
+  "ཕལ་ཆེར་རྒྱལ་ཁང་རྩེ་པས་སྐུ་འཕྲེང་མང་ཙམ་ཞིག་བྱང་ཕྱོགས་ཧོར་གྱི་ཆ་ལས་ཁལ་ཁ་གཡས་རུ་ཛ་སག་ཐུ་ཁང་གི་ཨས་མག་གི་བླ་མར་་་་་",
+  "བཅོམ་ལྡན་འདས་",
+  "བའི་",
+  "བསོད་ནམས།",
+  "བསྐ་བ།",
+  "བོད་ལྗོངས",
+  "བྷོ་ལི་ཝི་ཡ་ཡི",
+  "མངོན་བརྗོད།",
+  "མར་ཟན།",
+  "མི་རིགས་དཔེ་སྐྲུན་ཁང་།",
+  "མིག་དང་།",
+  "ཙ",
+  "ཞེ་སྡང་།",
+  "ཟན་ཆང་།",
+  "འཇར་མན་སྐད།",
+  "ཡ་ཕེད།",
+  "ཡི་ལང་གི",
+  "ཡུལ་སྐད་གཅིག",
+  "ཡེ་ཤུའི་ཆོས་ལུགས་ཀྱི་དཔེ",
+  "རུས་པ།",
+  "རེད།",
+  "རྒྱ་ནག་གིས",
+  "རྒྱན་ཚིག",
+  "རྟགས་",
+  "རྩོམ་སྒྲིག་པ།",
+  "ལི་ཅུན་ཅི།",
+  "ལེའུ་དང་པོ།",
+  "ལོ་ཆུང་བྱིས་པའི་ཤེས་བྱའི་གཏེར་མཛོད།",
+  "ལྕེ།",
+  "ལྟ་བུ་སྟེ།",
+  "སེ་པན་སྐད།",
+  "སྒྲུང་།",
+  "སྤགས་ཆང་།",
+  "སྦེལ་ཀོབ།",
+  "སྨུག་",
+  "ཧ་ནུ་མན།",
+  "ཧམ་གྱི",
+  "ཨི་ཏ་ལིའི་གྲོང",
+  "City)ནི་",
+  "Islands)ནི་",
+  "Mr",
+  "Provincia",
+  "da",
+  "del",
+  "gwa'a",
+  "rupi",
+  "་ཁྱེར་ཞིག་རེད།",
+  "་གློག་བརྙན་འཁྲབ་སྟོན་པ་ཞིག་རེད།",
+  "་ཆེན་དགུའི་ནང་གི་ཡ་གྱལ་ཅིག་རེད།",
+  "་དང་",
+  "་མཚེའུ་ཞིག་རེད།",
+  "་རྒྱལ་ཁབ་ཡིན།",
+  "་སུ་བེད་སྤྱོད་བྱེད།",
+  "་སྐྱོང་ལྗོངས་ཞིག་རེད།",
+  "་སྲིད་མཁས་ཅན་ཞིག་རེད།",
+  "༡༡བར།",
+  "༡༩༩༢",
+  "༡༩༩༣",
+  "༡༩༩༧",
+  "༢༠༠༠",
+  "༢༠༡༡",
+  "༢༤",
+  "༢༥",
+  "༢༦",
+  "༣༠",
+  "༣༥",
+  "༣༧",
+  "༣༽",
+  "༤༥",
+  "༤༨",
+  "༥བར།",
+  "༦བར།",
+  "ཀྭ་ཡེ།",
+  "ཀྲུང་གོའི་གྲོང",
+  "ཀྲུང་གོའི་རང",
+  "ཁ་བའི་བུ་ངའི་རང་གཤིས་འགྱུར་མེད་ཡིན།།",
+  "ཁ།",
+  "ཁང་ཆེན་དམར་པོའི་རྨི་ལམ་",
+  "ཁམས་པ་སྐྱ།",
+  "ཁྱོད་ཀྱི་བཀའ་དྲིན་བརྗེད་ཐབས་མི་འདུག།",
+  "ཁྱོད་ཀྱི་བཀའ་དྲིན་ཡང་ཡང་དྲན་བྱུང༌།།",
+  "ཁྱོད་རང་དངོས་གནས་བོད་པ་ཡིན་ནམ།",
+  "ཁྱོད་ལ་ཕུལ་བ་བཟང་བྱུང༌།།",
+  "གནས་།",
+  "གཞན་",
+  "གའཀ",
+  "གསར་གཏོད།",
+  "གསུང་རབ།",
+  "གི་ཉོལ།",
+  "གྲུབ་མཐའ་",
+  "གླུ་གཞས།",
+  "ང་དང་གདོང་དམར་བོད་པའི།།",
+  "ང་རྒྱལ།",
+  "ངས་",
+  "ངོ་མ།",
+  "ཅང་སུའུ་ཞིང་ཆེན་གྱི",
+  "ཅིང་།",
+  "ཅིན་ཧྲེན་ཁྲུང་།",
+  "ཆབ་མདོ།",
+  "དཀར་མཛེས།",
+  "དགུང་ལོ།",
+  "དགེ་ལུགས་",
+  "དཔལ་དོན་གྲུབ་རྒྱལ།",
+  "དབང་ཕྱུག",
+  "དབྱིན་ཇི་མཉམ་འབྲེལ་ཡི",
+  "དུང་དཀར་བློ་བཟང་འཕྲིན་ལས།",
+  "དེའི་མཚན་ཉིད།",
+  "དོན་",
+  "དྲག་པོ།",
+  "དྲན་པ།",
+  "དྲི་བ།",
+  "ནུབ་ཕྱོགས་སུ་བསྐྱོད་པའི་རྣམ་ཐར་ནང",
+  "ནོ་ཨའི་གྱི",
+  "ནོའོ་བྷེལ་གྱི་བྱ་དགའ།",
+  "པར་རིས་མཛེས་ཁྱམས།",
+  "པི་པི་ལིང་།",
+  "ཕྱི་ལོ",
+  "བ་",
+  "བཀྲ་ཤིས་བདེ་ལེགས་གྲངས་མེད་ཞུ།",
+  "བད་ཀན།",
+  "བཞི།",
+  "བཞུགས་ཡུལ།",
+  "བར།",
+  "བརྒྱ་ཆ།",
+  "བརྡ་རྙིང་།",
+  "བསམ་ཚུལ།",
+  "བོད་ནང་།",
+  "བོད་ཡིག་སྦྱོངས་བའི་ཕྱི་རྒྱལ་བ།",
+  "བྱ་རིགས",
+  "བྱ།",
+  "བྱི་བ།",
+  "བྱིས་པ།",
+  "མགྲིན་པ།",
+  "མངའ་རིས།",
+  "མངར་བ།",
+  "མདོར་",
+  "མདོར་ན།",
+  "མཚན་གཞུང་།",
+  "མར།",
+  "མེ།",
+  "མེག་སི་ཀོ།ཀྱི",
+  "ཚ་",
+  "ཚ་བ།",
+  "ཝོ་ཁ་ལུ་ཟེ་ལེ",
+  "ཞི་བདེ་གསེར་གྱི་རྟགས་མ།།",
+  "ཞིག།",
+  "ཞེས་དང་།",
+  "ཟིན་ཐོའམ་དཔྱད་གཞི།",
+  "ཟེར་",
+  "ཟླ་བ།",
+  "འདས་པའི་དུས་ཡུན་རིང་པོའི་ནང་རྒྱ་ནག་ཏུ་ལས་དོན་སྒྲུབ་དེ་བསྡད་མྱོང་ཞིང་།",
+  "འདེབས་མཁན་",
+  "འབྲུག",
+  "འོ་མ།",
+  "འོད་གསལ།",
+  "ཡ་ཝན་གྱི",
+  "ཡང་།",
+  "ཡང་ན་",
+  "ཡུལ་སྐད་ཀྱི་ཁྱད་ཆོས།",
+  "ཡུལ་སྲོལ།",
+  "རང་བཞིན།",
+  "རྒྱ་ནག",
+  "རྒྱང་བཞུད་ཀྱི་ཁུ་ལོ་དྲན།",
+  "རྟ།",
+  "རྟེན།",
+  "རྣ་རྒྱན།",
+  "རྣ་སྤབས།",
+  "རྨ་ཆུ།",
+  "རྩོམ་པ་པོ་མི་གསལ།",
+  "རྩོམ་ཡིག་གི་ཁུལ།",
+  "རླུང་།",
+  "རླུང།",
+  "ལས་གནས།",
+  "ལས་ལ་བསྐོས་པའི་བུ་མོ།།",
+  "ལས།",
+  "ལུང་ཚན།",
+  "ལུས།",
+  "ལོ་རྒྱུས་",
+  "ལྔ།",
+  "ལྕེའི་རྣམ་ཤེས།",
+  "ཤེམ་",
+  "ཤེས་རབ།",
+  "ས་བཅད་དང་པོ།",
+  "སངས་རྒྱས་ཆོས་ལུགས་ཀྱི་གཞུང་ནས་བཤད་ཚུལ་ལ།",
+  "སངས་རྒྱས།",
+  "སི་ཁྲོན་ཞིང་ཆེན་བོད་ཡིག་སློབ་གྲྭ།",
+  "སི་ཅི་ལའི་སྐད།",
+  "སི་ཅི་ལིའི་ཞིང",
+  "སུད་སིའི་གྲོང",
+  "སོག་པོའི་སྐད།",
+  "སོག་རྫོང་།",
+  "སྐར་མ།",
+  "སྒྱུ་ལུས།",
+  "སྒྲ།",
+  "སྙན་རྒྱན།",
+  "སྟོད་ཆ།",
+  "སྡེ་དགེ",
+  "སྡོམ་པ།",
+  "སྣའི་རྣམ་ཤེས།",
+  "སྤྱིར་",
+  "སྤྲོ་སེམས་ཁོལ་བའི་ངང་ནས།།",
+  "ཧམ་དང",
+  "ཧྥ་རན་སིའི་གཞས",
+  "ཧྥ་རན་སིའི་ཆབ",
+  "ཧྥ་རན་སིའི་རྩོམ",
+  "ཧྥ་རན་སིའི་ལྷོ",
+  "ཧྥ་རན་སིའི་སྐད་ཡིག",
+  "ཧྥ་རིས་ད་ཀ་ལོ།",
+  "ཧྲུའུ།",
+  "ཨ་མི་རི་ཁ་བྱང་གླིང་།",
+  "ཨ་མེ་རི་ཁ་རྒྱལ་ཕྲན་མཉམ་འབྲེལ་རྒྱལ་ཁབ་ཡི",
+  "ཨ་ཧྥེ་རི་ཁ་གླིང་ཆེན།",
+  "ཨང་རིམ།",
+  "ཨི་ཏ་ལིའི་ཆུར",
+  "ཨུ་རུ་སུའི་སྐད།",
+  "ཨེ་ཤེ་ཡ་ཀྱི",
+  "ཨེ་ཤེ་ཡ་གླིང་ཆེན།",
+  "ཨོ་སི་ཁྲོལ་ལི་ཡ།",
+  "‘‘‘མགོ་འཛིན་པ།’’’",
+  "双语",
+  "1.",
+  "1916",
+  "2.",
+  "A.",
+  "Buthelezi",
+  "CPU",
+  "Cervus",
+  "Charlie",
+  "Congo)ནི་",
+  "Dzong",
+  "E-mail",
+  "George",
+  "I",
+  "India",
+  "John",
+  "José",
+  "La",
+  "Lake",
+  "Loten",
+  "MHNT",
+  "Macaca",
+  "Mangosuthu",
+  "Marino)ནི་",
+  "Namling",
+  "Noun",
+  "Oaxaca)ནི་",
+  "Ochotona",
+  "Paraguái",
+  "Paul",
+  "República",
+  "Salvador)ནི་",
+  "School",
+  "Springfield)ནི་",
+  "The",
+  "ZomBotany",
+  "a",
+  "by",
+  "gli",
+  "hannu",
+  "in",
+  "ka'agwy-rupi",
+  "la",
+  "republika)ནི་",
+  "turtur",
+  "Δημοκρατία)ནི་",
+  "και",
+  "με",
+  "Республикасы)ནི་",
+  "العربية",
+  "الكويت)ནི་",
+  "جيبوتي)ནི་",
+  "प्रदेश)ནི་",
+  "यः",
+  "་ཀྱི་ཆེས་ཆེ་བའི་གྲོང་ཁྱེར་དང་རྒྱལ་ས་ཡིན།",
+  "་ཁ་ཕྱོགས་མཚོན་བྱེད་ཞིག་རེད།",
+  "་ཁབ་ཀྱི་སྐད་ཡིག་རེད།",
+  "་གནས་ཞིང་",
+  "་གི་",
+  "་གིས་རང་ལ་གླུུ་གར་གྱི་རྒྱ་མཚོ་ཞེས་འབོད་པ་ལྟར།",
+  "་གྲོང་རྟལ་ཤར་མཐའ་སན་ཏ་ཀུ་རུ་སི་དེ་པར་ཏ་མེན་ཏོ་ཞིག་རེད།",
+  "་དགེ་ཕྲུག་གསུམ་ནང་གི་ཡ་གྱལ་ཅིག་རེད།",
+  "་པ་དང་",
+  "་པའི་",
+  "་བེད་སྤྱོད་བྱེད་མཁན་གྱི་རི་མོའི་སྒྲུང་དེབ་གྱི་རྩོམ་པ་པོ་ཞིག་རེད།",
+  "་ཞི་ཡིན་པ་རེད།",
+  "་ཞིག་རེད།",
+  "་ཟེར།",
+  "་རེའུ་མིག",
+  "་ལག་གི་སྡེ་ཆུང་ཞིག་རེད།",
+  "་ལག་ཞིག་སྟེ་",
+  "་ལེབ་རེད།",
+  "་སྔ་དུས་ཀྱི་ཆོས་ཁ་ཞིག་ཡིན་།",
+  "།༣",
+  "།དབུ་མ་ལ་འཇུག་པ་ལས།",
+  "།ཡང་ན།",
+  "༡༠༠པའི",
+  "༡༠པའི",
+  "༡༩༨༠",
+  "༡༩༨༦",
+  "༡༩༩༥",
+  "༡༩༩༦",
+  "༡༩༩༨",
+  "༡༩༩༩",
+  "༢༠༠༡",
+  "༢༠༠༥",
+  "༢༣",
+  "༢༨",
+  "༣བར།",
+  "༤༧",
+  "༥༡",
+  "༥༤",
+  "༥༦",
+  "༦༡",
+  "༧༨",
+  "༨༩",
+  "༨བར།",
+  "ཀ",
+  "ཀ་ལིའི་རྒྱབ་ཀྱི་ཀླད་པ་འགུལ་སྐྱོད་འབྱུང་ཡུལ།",
+  "ཀེ་རི་སིའི་གྲོང",
+  "ཀོང་གོ་མི་དམངས་དམངས་གཙོ་ཡི",
+  "ཀྱང་",
+  "ཀྱེ་ཀྱེ།",
+  "ཀྱེ་བུ་མོ་ལགས།",
+  "ཀྲུང་གོའི་ཀྲུའུ",
+  "ཀྲེ་ཅང་ཞིང་ཆེན་གྱི",
+  "ཀླུ་འབུམ།",
+  "ཀླུང་ཆུ།",
+  "ཁ་ན་ཌ་ཀྱི",
+  "ཁ་རག་བྲག་དཀར་པོའི་བར་ཆུ་ཤུར་གྱི་ས་ཁོངས་སུ་རྩིས།",
+  "ཁ་སང་ཕྱི་ཚེས་",
+  "ཁང་བའི་ཀ་བ།",
+  "ཁམས་པའི་གསར་འགྱུར་དྲ་བའི་ལེ་ཚན།",
+  "ཁམས་འཛུམ་གྲོལ་གྱིས་གཙོ་བསྒྲིག་བྱས།",
+  "ཁའེ་ས།",
+  "ཁས་ལེན་པ།",
+  "ཁུ་བ།",
+  "ཁུ་རན་གསུང་རབ།",
+  "ཁེ་ནི་ཡ་ཡི",
+  "ཁོ་བོ་ནི་",
+  "ཁོ་མོར་སྤྱི་ལོ་༡༩༧༦ལོར་ནོའོ་བྷེལ་བྱ་དགའ་རག་པ་རེད།",
+  "ཁོང་གཉིས་ཀྱིས་ཧུར་ཐག་བྱེད་ཀྱིན་འདུག",
+  "ཁོང་གི་ཅ་ལག།",
+  "ཁྱི།",
+  "ཁྱེད་ཀྱི་རི་མོ་གང་རུང་བཤུས་བཀོད་བྱས་ཏེ་བདག་གི་དེབ་ནང་དུ་བཀོད་ཆོག་གམ།",
+  "ཁྱེད་ཀྱི་རྒྱུ་ནོར།",
+  "ཁྱེད་ཀྱི་ལག་པ།",
+  "ཁྲག་ཤེད་དང་ལུས་དྲོད་ཞན་ཞིང་ཁྲག་གི་འཁོར་རྒྱུག་དལ་བ་དང་ཡན་ལག་རྣམས་གྲང་འདར་བྱེད་པ་དང་གདོང་མདོག་སྐྱ་བོར་འགྱུར་ཞིང་ཤེས་པ་འཁྲུལ་བ་སོགས་ཀྱི་ནད་རྟགས་འབྱུང་བའི་བརྒྱལ་ཞིང་བོག་པའི་ནད་ཅིག་སྟེ།",
+  "ཁྲི་ཀ",
+  "གཉའ་ལམ་སྐལ་བཟང་ལྷུན་གྲུབ།",
+  "གཉིས་པ་ལས་སུ་བྱ་བ།",
+  "གཏི་མུག",
+  "གཏོང་བ་རྗེས་སུ་དྲན་པ།",
+  "གཏོར་མ།",
+  "གདངས་རྩོམ་མཁན",
+  "གདུ་བུ།",
+  "གདོང་རིས་སྣ་ཚོགས།",
+  "གནས་",
+  "གནས་དང་གཡོག་འཁོར།",
+  "གཞན་གྱི་སྨིན་མ།",
+  "གཞས་ཚིག་",
+  "གཞུང་སྒེར་གྱི་སྤྱི་རྫས།",
+  "གཞོན་ནུ།",
+  "གཟའ་ཕུར་བུ་ཡི",
+  "གཟའ་མིག་དམར་གྱི",
+  "གཟའ་ལྷག་པ་ཡི",
+  "གཟུགས་ཀྱི་མཐའ་སྟེ།",
+  "གཟུགས།",
+  "གཡུ་ཡི་ཕྲེང་བ།",
+  "གཡུ་ལོའི་ཁང་བཟང་མཛེས་པའི་ནགས་ཀླུང་དེར།།",
+  "གཡུལ་རྒྱལ།",
+  "གལ་སྲིད་དངུལ་བརྗེ་ལེན་གྱི་གོང་ཚད་དེ་ཡོ་སྒོར་༠",
+  "གསང་དང་མ་གསང་མི་འདུག།",
+  "གསང་སྔགས་དར་ཚུལ་སྒོ་ནས་གཉིས་སུ་དབྱེ།",
+  "གསར་འགོད་པ།",
+  "གསུང་རབ།ནང",
+  "གསུང་རྩོམ།",
+  "གསུམ་པ་བྱེད་སྒྲ།",
+  "གསུམ།",
+  "གསེར་དང་།",
+  "གུ་ཝ་ར་ནི་སྐད།",
+  "གུར་གྱི་ཆོན་ཐག།",
+  "གོ་དོན།",
+  "གོ་སྟེང་དགོན།",
+  "གོང་གི་རི་མོ་འདི་དག་གི་རྩོམ་པ་བོ་ཁྱེད་ཉིད་ཡིན་ནམ།",
+  "གོང་དུ་ཀ་སྡེའི་ནང་ཀརྨ་པ་སྐུ་ཕྲེང་རིམ་བྱོན་སྐབས་སུ་གསལ།",
+  "གོང་དུ་ཁ་སྡེའི་ནང་ཁྲི་ཆེན་སྐབས་སུ་གསལ།",
+  "གོང་ས་སྐྱབས་མགོན་ཏཱ་ལའི་བླ་མས།།",
+  "གྱིས་",
+  "གྲངས་",
+  "གྲོ་བོ་སྐྱ།",
+  "གྲོ་སྔོན་སྐྱ།",
+  "གླང་།",
+  "གླུ་གཞས་དང་ཆེས་བསྒྲིགས་",
+  "གླུ་གར་གྱི་ལམ་བུ་",
+  "གླུ་ལེན་གར་རྩེ་བྱེད།",
+  "གློག་འཕྲིན།",
+  "ང་ཚོ་བོད་པའི་རིགས་ལ།།",
+  "ངག་དབེན།",
+  "ངང་དཀར་",
+  "ངེས་པར་འབྱུང་བ།",
+  "ངེས་ཚིག",
+  "ངོ་མཚར་ཆེ་རྒྱུ་མི་འདུག།",
+  "ངོ་སྤྲོད་རགས་བསྡུས་",
+  "ངོ་སྤྲོད་རགས་བསྡུས།",
+  "ངོ་སྤྲོད།",
+  "ངྷ་ས།",
+  "ཅི་ཁེད།",
+  "ཅི་ལི་ཡི",
+  "ཅུང་ཟད་སྙམ་པའི་ང་རྒྱལ།",
+  "ཅེ་ཁེ་ཡི",
+  "ཅོ་ནེ།",
+  "ཆ་ཕྲ་བ།",
+  "ཆགས་ཡུལ་",
+  "ཆགས་སྦྱོར་བྱེད་པའི་སྐབས",
+  "ཆང་ལྟར་བསྙལ་ཏེ་ལངས་པའི་སྤགས།",
+  "ཆབ་མདོ་ས་ཁུལ།",
+  "ཆིན་དགུ་ནི།",
+  "ཆུ་རྒྱུན་དང",
+  "ཆོས་དཀོན་མཆོག",
+  "ཆོས་ཚོགས་ནར་མ་ལ་ཟླ་བ་བྱུང་ངོ་ཅོག་གི་ཚེས་ཉེར་ལྔ་ལ་ཚོགས་འཁོར་དང་།",
+  "ཆོས་རྗེས་སུ་དྲན་པ།",
+  "ཇི་བའོ་ཊི་",
+  "ཇི་ལྟར་འཇུག་བྱེད་ཅི་ཕྱིར་འཇུག།",
+  "ཉག་ཆུ།",
+  "ཉག་རོང་།",
+  "ཉག་རོང་རྫོང་ཁོངས།",
+  "ཉན་རང་།",
+  "ཉལ་ཐུལ་གྱི་ཕྱི་མ།",
+  "ཉི་མ།",
+  "ཉིན་",
+  "ཉིན་དགེ་རྒན་ཆེན་མོ་ཨེ་ལིའོ་ཊི་",
+  "ཉིན་ཕ་ཡུལ་ནང་ཆེན་ནས།",
+  "ཉིན་མཆོད་མེ་བོད་ཀྱི་རྩོམ་རིག་དྲ་བའི་པོད་ཁུག་(www",
+  "ཉིན་འདི་འགར་འདི་ལོའི་བོད་ཀྱི་མཛངས་མ་བསྟན་འཛིན་ནོར་འཛོམས་ལགས་ཀྱིས་རྒྱ་གར་ཡུལ་མི་བོད་དོན་རྒྱབ་སྐྱོར་བ་མཱ་ཧེ་ཞ་༲༲",
+  "ཉིན་ལྷོ་ཨ་ཧྥི་རི་ཀའི་གྲོས་ཚོགས་འཐུས་མི་རྒྱལ་སྲས་མན་གྷོ་སུ་ཐུ་བྷུ་ཐུ་ལེ་ཛི་",
+  "ཉིན་སྔ་དྲོའི་ཆུ་ཚོད་",
+  "ཉིན།",
+  "ཉེ་ཆར་བོད་ནང་གི་ཤེས་ལྡན་དོན་གཉེར་ཅན་སྐོར་ཞིག་གིས་༼",
+  "ཉེ་བར་སྟོན་པ།",
+  "ཉོན་དང་།",
+  "ཏཱ་ར་ནཱ་ཐ།",
+  "ཏིང་ངེ་འཛིན་གྱི་ཕུང་པོ།",
+  "ཏིང་ངེ་འཛིན།",
+  "ཏིང་འཛིན།",
+  "ཏེན་ཁེ།",
+  "ཐ་མལ་དུ་གནས་པའི་མི་དར་མའི་སྙིང་གི་ཕར་ཚད་ནི་དུས་ཚོད་སྐར་མ་གཅིག་ལ་ལན་གྲངས༦༠ནས༡༠༠བར་ཡིན་ཏེ།",
+  "ཐ་སྙད་ཚད་གྲུབ་འཇོག་ལ་བློ་མ་བདེ།",
+  "ཐང་རྒྱལ་རབས་ཀྱི",
+  "ཐའེ་ཝན་གྱི",
+  "ཐར་བའོ།",
+  "ཐི་ཧྥུ་ན་ཐི།",
+  "ཐིན་ཝེ།",
+  "ཐུགས་རྗེ་ཀུན་ཁྱབ་ཡེ་ཤེས་སོ།",
+  "ཐུན་མོང་མ་ཡིན་པ།",
+  "ཐུབ་བསྟན་བསམ་གྲུབ།",
+  "ཐེ་ཇི་བང་སོ།",
+  "ཐེ་བོ།",
+  "ཐེ་ཧྥུ།",
+  "ད་ཐེངས་རང་ཉིད་ཀྱིས་དུས་ཚོད་རིང་པོ་ཞིག་རིང་བསམ་བློ་བཏང་ནས།",
+  "ད་བཟའི་དུམ་བུ།",
+  "ད་ལོའི་༧གོང་ས་མཆོག་གི་ཞི་བདེ་གཟེངས་རྟགས་ཀྱི་ཉིན་མོ་དང་བསྟུན་ཏེ།",
+  "ད་ལྟ་རྒན་ཡོལ་བྱས་ཟིན་པའི་དབྱིན་ཇའི་ཕྱི་འབྲེལ་དཔོན་རིགས་ཁྲེམ་ཁའོ་",
+  "ད་ལྟའི་སྡོད་གནས།",
+  "དགུན་ནས།",
+  "དགེ་ཚུལ།",
+  "དགེ་འདུན་རྗེས་སུ་དྲན་པ།",
+  "དགོན་པའི་བྱུང་བ།",
+  "དགོན།",
+  "དགྲ་བོ་ཕུད་པའི་དུས་ལ་བབ་འདུག།",
+  "དང་པོ་ངོ་བོ་ཙམ་སྟོན་པ།",
+  "དངོས་གནས་བོད་པ་ཡིན་ན།",
+  "དངོས་པོ།",
+  "དཔའ་བོའི་མཆོན་ཆ།",
+  "དཔལ་འཁོར་གྱི་ཅ་ལག།",
+  "དཔལ་ཡུལ།",
+  "དཔལ་ལྡན་རྒྱལ།",
+  "དཔུང་རྒྱན།",
+  "དཔྱིད།",
+  "དབང་པོ་ཚང་བ།",
+  "དབང་པོའི་མངོན་སུམ།",
+  "དབུ་མཛད།",
+  "དབྱར།",
+  "དབྱིན་ཇི།",
+  "དབྱིན་ཡིག་གི་emailདེ་eནི་electronic",
+  "དབྱེ་བ།",
+  "དམར་པོ་སྐྱ།",
+  "དམྱལ་བ་དང་།",
+  "དར་རྩེ་མདོ།",
+  "དར་ལ་བབ་པ།",
+  "དུང་དཀར་ཚིག་མཛོད་འདི་གློག་ཀླད་ནང་བླུགས་ནས།",
+  "དུད་འགྲོ།",
+  "དེ་ནི་དམིགས་བསལ་གྱི་གྲངས་ཕྲེང་ཞིག་ཡིན་ཏེ།",
+  "དེ་ནི་བཀའ་བབས་ཀྱི་གདམས་པའི་རྒྱུད་འཛིན་པ་ཡིན་པས་བཀའ་བརྒྱུད་པ་ཞེས་གྲངས་ལ་དབྱེ་ན་གཉིས་ཏེ།",
+  "དེ་ནི་མཐོ་སྒང་གི་བྱང་སྣེར་ཆགས་ཏེ།",
+  "དེ་བཞིན་གཤེགས་པའི་རིགས།",
+  "དེ་རིང་ཕྱི་ཚེས་",
+  "དེ་ལ་དབྱེ་ན།",
+  "དེ་སྔོན་བོད་ས་གནས་སྲེད་གཞུང་སྐབས་དངུལ་བུན་བཏང་བའི་སྐྱེད་ཁ་ལ་རིགས་ཁ་ལ་རིགས་ཁ་ཤས་ཡོད་པའི་ནང་ནས་སྐྱེད་ཁ་མཐོ་ཤོས་ཏེ།",
+  "དེབ་ཐེར་དཀར་པོ།",
+  "དེབ་ཚད།",
+  "དེའི་ཕྱིར།",
+  "དེར་བརྟེན།",
+  "དེས་ན།",
+  "དྭགས་པོ་བཀའ་བརྒྱུད་དོ།",
+  "དྲང་བདེན་སྙིང་སྟོབས།",
+  "དྲི་ཆུ།",
+  "དྲི་ཆེན།",
+  "དྲུག་པ་འབྲེལ་སྒྲ།",
+  "དྲུགདུང་དཀར་ཚིག་མཛོད་ཆེན་མོ་",
+  "ན་ལེ་ཤམ།",
+  "ནག་ཆུ།",
+  "ནག་ཞུར་སྐྱ།",
+  "ནང་དོན་གནད་བསྡུས།",
+  "ནང་དོན།",
+  "ནང་བསྟན།",
+  "ནད་",
+  "ནམ་མཁའ།",
+  "ནས་ཟླ་",
+  "ནས།",
+  "ནཱ་ཐན་(נתן)ནི་",
+  "ནུབ་ཕྱོགས་སུ་བསྐྱོད་པའི་རྣམ་ཐར་",
+  "ནོར་གླིང་མཐོ་སློབ་འགན་འཛིན།",
+  "པ་ན་མ་(Panamá)ནི་",
+  "པ་སྡེ།",
+  "པའི་",
+  "པར་རིས་བར་ཁྱམས།",
+  "པལ་ཊིམ་གྱི",
+  "པུ་རུ་ཟིལ་",
+  "པུ་རུ་ཟིལ་གྱི",
+  "པུ་རུ་ཟིལ་རྒྱལ",
+  "ཕ་རན་སི།",
+  "ཕ་སྤྲེལ་རྒན་བྱང་ཆུབ་སེམས་པ་དང",
+  "ཕག་རྣམས་སོ།།",
+  "ཕུར་བུའི་དམར་ཐིག་ཆེན་པོ།",
+  "ཕྱག་གདུབ།",
+  "ཕྱག་ཕྲེང་།",
+  "ཕྱི་ཟླ་",
+  "ཕྱི་ལི་",
+  "ཕྱིན་ཅི་མ་ལོག་པ།",
+  "ཕྲ་ཕུང་གི་འཚོ་དབུགས་ཐོལ་གྱིས་ཉམས་པའི་རྐྱེན་ལས་བྱུང་བའོ།",
+  "བཅར་འདྲི།",
+  "བཅུད་ལེན།",
+  "བཅོ་ལྔའི་དུང་ཟླ་དཀར་པོ།།",
+  "བད་ཀན་",
+  "བདག་གི་ནོར།",
+  "བདག་གི་མགོ།",
+  "བདག་ནི་བོད་ནང་གི་རི་མོའི་དཔེ་དེབ་བསྒྲིགས་མཁན་ཞིག་ཡིན།",
+  "བདུད་འཇོམས་ཆོས་འབྱུང་།",
+  "བདུན་པ་གནས་གཞིའམ་རྟེན་གནས།",
+  "བདེ་བ་།",
+  "བདེ་བ་དང་།",
+  "བདེན་",
+  "བན་ཤུལ་འཁྱམ་བསེ་རུ་ནས།",
+  "བཙུན་པར་སྐྱེ་བ།",
+  "བཙུན་མོ།",
+  "བཞི་པ་དགོས་ཆེད།",
+  "བཞི་པ།",
+  "བཞི་བཅུའི་ཚེམས་དཀར་གངས་རིའི་ཕྲེང་བའི་སྤུན།།",
+  "བཞུགས།",
+  "བར་མཛོད།",
+  "བར་ལོ་གཉིས་རིང་ཟློས་དགེ་མི་གྲངས་",
+  "བར་ལོ་གསུམ་རིང་ཟློས་དགེ་མི་གྲངས་",
+  "བརྒྱད་པ་འབོད་སྒྲ་བཅས་ཡིན།།",
+  "བརྟན་པ།",
+  "བརྩོན་གྲུས།",
+  "བརྩོན་འགྲུས་རྩོམས་དང་མཁས་པར་འགྱུར།",
+  "བལ་ཡུལ།",
+  "བསམ་བློ།",
+  "བསམ་ཡས་ཆོས་ཀྱི་ཞིང་ས།།",
+  "བསོད་ནམས་རྒྱལ་མཚན།",
+  "བསྐྱེད་རིམ་གྱི་ལྷ་སྐུའི་སྒོམ་ཚུལ་ཞིག་སྟེ།",
+  "བུ་རམ།",
+  "བུ།",
+  "བུད་མེད་ཆབ",
+  "བུད་མེད།",
+  "བུམ་པ།",
+  "བེ་རི་འཇིགས་མེད་དབང་རྒྱལ།",
+  "བོད་",
+  "བོད་ཀྱི་སྐད་ཡིག་དྲ་ཚིགས།",
+  "བོད་ཀྱི་སྒྱུ་རྩལ།",
+  "བོད་དངུལ་སྲང་ལྔ་བཅུ་ཐམ་པ་སྤྲོད་དགོས་པ་དེར་བཅུ་སྐྱེད་ཟེར།",
+  "བོད་ཡུལ་ནི་ཆུ་ཀླུང་མང་པོའི་འབྱུང་ཁུངས་ཡིན།",
+  "བོད་རང",
+  "བོད་རང་སྐྱོང་ལྗོངས་",
+  "བོད་རང་སྐྱོང་ལྗོངས་ཏང་ཨུད་ཀྱི་རྒྱུན་ལས་ཨུ་ཡོན་དང་།",
+  "བོད་རང་སྐྱོང་ལྗོངས།",
+  "བྱ་བ་ལ་བསྐུལ་བའི་ཕྱིར་ན་ཡིག་གི་འཇུག་པ་དང་དོན་འདྲ་བར་གདམས་ངག་འདོམས་པའོ།",
+  "བྱང་ཆུབ་ཀྱི་སེམས།",
+  "བྱང་ཆུབ་སེམས་དཔའ་སེམས་དཔའ་ཆེན་པོ་འཕགས་པ་སྤྱན་རས་གཟིགས་",
+  "བྱུང༌།",
+  "བྲ་བོ་སྐྱ།",
+  "བྲག་གཡབ།",
+  "བླ་གོས་དང་།",
+  "བློ་བཟང་དཔལ་ལྡན།",
+  "བློན་པོ།",
+  "མ་",
+  "མ་བྱིན་པར་ལེན་པ།",
+  "མ་བྱིན་ལེན།",
+  "མ་འོངས་མི་རིགས་འདི་ཡི་བརྒྱུད་འཛིན་ཡིན།།",
+  "མ་རངས་པའི་ཚིག་ཤུགས་སྟོན་པའི་ཕྲད་གསུམ།",
+  "མ་རྙེད་པ།",
+  "མཁྲིས།",
+  "མང་དོན་མཚོངས་བར་བོད་འདི་ལ་གྱ་ནོམ་ཞིང་ཐུན་མོང་མ་ཡིན་པའི་གླུ་གར་གྱི་རིག་གནས་ལོ་རྒྱུས་རིང་པོ་ཞིག་ཡོད་དོ།",
+  "མངར་བ་དང་།",
+  "མངོན་ཤེས་བུལ་ལ་སླ་བ།",
+  "མངོན་ཤེས་མྱུར་ལ་དཀའ་བ།",
+  "མཆིལ་མ།",
+  "མཆོག",
+  "མཉེན་ཞིང་ལྕུག་པའི་ཉམས་འགྱུར་ཅི་ཡང་ངོམ་ཞིང་སྐྱེ་བོ་ཀུན་ལ་ཤེས་རབ་ཀྱི་མིག་སྤྱིན་པར་བྱེད་པ་དེ་དང་།",
+  "མཐང་གོས་དང་།",
+  "མཐའིཇོ་ནང་པའི་དགོན",
+  "མདངས་ཅན་ཉག་ག་ནི་རི་གཉིས་ཀྱི་དབྱེ་མཚམས་ཀྱི་ཐིག་ལེ་ཡིན།",
+  "མདོ་སྡེ་པའི་དབྱེ་བ་གཉིས་ཀྱི་ཡ་གྱལ་ཞིག་སྟེ།",
+  "མཚན་གཞི་ནི།",
+  "མཚན་མ་མེད་པ།",
+  "མཚར་ཆེ།",
+  "མཚོན་ཆ།",
+  "མཛད་གཙོ་རྣམ་པའི་ཕོག་དང་ཟུར་ཕོག་དང༌༎",
+  "མརྒད།",
+  "མི་",
+  "མི་ཉག་སྒྲོལ་མ་ཚེ་རིང༌།",
+  "མི་ཚེ་",
+  "མི་འདོད་པ་དང་།",
+  "མི་ཡིན་པ་དང་།",
+  "མི་རུ་སྐྱེས་པ་ཐམས་ཅད་མིར་བཟུང་ནས།།",
+  "མི་སྣང་བ།",
+  "མིག་གི་རྣམ་ཤེས་དང་།",
+  "མིག་འབྲས་སྒོར་ཞིང་མཛེས་ལ་འོད་འཁྱུག་པ།",
+  "མིག་རྣག",
+  "མིག།",
+  "མིང་།",
+  "མུ་ཏིག།",
+  "མུ་མེན།",
+  "མེག་སི་ཀོ་གསར་མ་གྱི",
+  "མེག་སི་ཀོ་ཡི",
+  "མོ་ན་ལི་ས།",
+  "མོ་ནད།",
+  "མྱ་ངན་འདས།",
+  "ཙམ་ཡོད།",
+  "ཙུང་ཀྲིན།",
+  "ཚངས་པ།",
+  "ཚན་དོ་དང་ཉེ་བའི་ཚན་དོ།",
+  "ཚིག་རྩོམ་མཁན།",
+  "ཚིགདུང་དཀར་ཚིག་མཛོད་ཆེན་མོ་",
+  "ཚིལ།",
+  "ཚུལ་ཁྲིམས་ཀྱི་ཕུང་པོ།",
+  "ཚུལ་ཁྲིམས་བློ་གྲོས།",
+  "ཚུལ་ཁྲིམས་རྗེས་སུ་དྲན་པ།",
+  "ཚེ་རིང་བ།",
+  "ཝེ་ཝེ།",
+  "ཞག་གསུམ།",
+  "ཞི་པན་ཡ་གྱི",
+  "ཞི་བ།",
+  "ཞི་བདེར་འཁྲེང་བའི་གངས་སྐྱེས་བུ་ཆུང་ངས།།",
+  "ཞི་མི།",
+  "ཞི་རྒོལ་ཆེན་མོ།",
+  "ཞིགདུང་དཀར་ཚིག་མཛོད་ཆེན་མོ་",
+  "ཞིང་དང་ཉེ་བའི་ཞིང།",
+  "ཞེ་ཁུ་སི་པེར​།",
+  "ཞེས་པ་གློག་གི་རྡུལ་མ་ལ་གོ་དགོས།",
+  "ཞེས་སོ།",
+  "ཞོ།",
+  "ཞོན་ཙང་",
+  "ཞོན་ཙང་གི",
+  "ཟག་པ།",
+  "ཟངས།",
+  "ཟམ་གྱི་ཀ་བ།",
+  "ཟས་",
+  "ཟིམ་ཐོའམ་དཔྱད་གཞི་",
+  "ཟུང་ཆུ།",
+  "ཟེར་རོ།",
+  "ཟླ་བ་དང་པོ།",
+  "ཟླ་འདིའི་ཕྱི་ཚེས་",
+  "ཟླ་འོག་ངོགས་སུ་བཞད་པའི་པཎ་ཆེན་བླ་མ།",
+  "ཟླ༤",
+  "ཟློས་གར་འགན་འཛིན་",
+  "ཟློས་གར།",
+  "འགྲོ་བ།",
+  "འཆད་པ།",
+  "འཆིང་བ།",
+  "འཇང་ས་དམ་དུ་དེའི་སྣེ་གཉིས་ལ་ཨུ་ཁུང་བརྟོལ་ནས་རོལ་ཆས་བྱེད།",
+  "འཇམ་དཔལ་གྱི་ལྕགས་སྨྱུག།",
+  "འཇམ་དབྱངས་ནོར་བུ།",
+  "འཇམ་པ།",
+  "འདི་གྱིས་དང་།",
+  "འདི་ནི།",
+  "འདོད་ཆགས་དང་།",
+  "འདོད་ཆགས།",
+  "འདོད་པའི་ཟག་པ།",
+  "འདོད་ལྷ།",
+  "འཕུར་ཤིག",
+  "འབར་མ་ཡི",
+  "འབོད་པ་གང་དེས་སྙིང་གི་རེ་སྨོན་བཅས།།",
+  "འབྱུང་འགྱུར་མི་རིགས་འདི་ཡི་བདག་པོ་ཡིན།།",
+  "འབྲས་བུ།",
+  "འབྲས་ལྗོངས།",
+  "འབྲི་རུ།",
+  "འབྲུ་རིགས་དང༌།",
+  "འབྲོག་པ།",
+  "འོན་ཀྱང་།",
+  "ཡང་ན་།",
+  "ཡང་བ།",
+  "ཡི་དྭགས།",
+  "ཡིད་ཀྱི་མངོན་སུམ།",
+  "ཡིད་ལ་ཟུངས་དང་རང་ལ་ཕན།",
+  "ཡིན་ན་ཡང་།",
+  "ཡིན།",
+  "ཡིའུ་ཐའེ་ཆོས་ལུགས།",
+  "ཡུམ་གྱི་རྒྱན་ཆ།",
+  "ཡུལ་དབུས་སུ་སྐྱེས་པ།",
+  "ཡུལ་སྐད།",
+  "ཡུལ།",
+  "ཡེ་ཤུའི་ཆོས་ལུགས་ཀྱི",
+  "ཡེ་ཤུའི་ཆོས་ལུགས།",
+  "ཡོ་རོབ་གླིང་གི",
+  "ཡོ་རོབ་གླིང་ཆེན།",
+  "ཡོངས་སུ་འཛིན་པ།",
+  "ཡོད།",
+  "ཡོས།",
+  "ར་ནོང་(ระนอง)ནི་",
+  "རག་དཀར་སྐྱ།",
+  "རང་བཙན་ལེན་པའི་དུས་ལ་བབ་འདུག།",
+  "རང་བཞིན་ལྷུན་གྲུབ་ཡེ་ཤེས།",
+  "རང་རིག་མངོན་སུམ་གྱི་ཚད་མ།",
+  "རབ་ཏུ་རྟོགས་པ།",
+  "རབ་མཛེས་ཞལ་རས་སྟོན་ཟླ་འཛུམ་པའི་གཉེན།།",
+  "རབ་རིབ།",
+  "རལ་གྲི།",
+  "རས་ཀྱི་ཁ་ཚར།",
+  "རི་དྭགས།",
+  "རི་པིན་དུ",
+  "རིག་གནས།",
+  "རིག་འཛིན་ཚངས་དབྱངས་རྒྱ་མཚོ།",
+  "རིགས་ལྔ།",
+  "རིགས།",
+  "རེག་བྱ།",
+};
+const uint16_t WA_FREQ_16_RANKS[] = {
+  446, 59, 112, 0, 0, 0, 279, 0, 441, 0, 0, 243, 0, 0, 701, 0,
+  0, 269, 0, 0, 0, 219, 781, 114, 583, 954, 591, 0, 484, 0, 0, 848,
+  0, 339, 0, 0, 0, 601, 0, 891, 548, 875, 554, 579, 0, 0, 0, 0,
+  371, 656, 0, 9, 0, 0, 0, 0, 0, 0, 0, 881, 0, 49, 0, 105,
+  340, 322, 949, 0, 0, 945, 884, 828, 0, 0, 165, 696, 594, 0, 0, 611,
+  366, 0, 0, 405, 634, 0, 0, 713, 916, 0, 0, 0, 783, 991, 0, 0,
+  0, 0, 835, 0, 0, 0, 450, 402, 638, 56, 798, 965, 651, 374, 140, 457,
+  860, 28, 0, 940, 992, 0, 707, 0, 0, 0, 577, 334, 541, 0, 824, 936,
+  0, 0, 993, 0, 0, 1, 0, 0, 199, 0, 578, 0, 210, 0, 0, 0,
+  0, 319, 193, 353, 962, 564, 838, 0, 0, 0, 3, 74, 944, 0, 0, 0,
+  233, 126, 240, 197, 0, 0, 623, 301, 0, 0, 291, 0, 727, 745, 908, 950,
+  224, 354, 298, 293, 556, 0, 0, 476, 575, 839, 0, 0, 0, 135, 128, 0,
+  395, 0, 0, 0, 305, 555, 0, 0, 0, 0, 2, 0, 0, 0, 0, 655,
+  33, 0, 0, 0, 0, 0, 715, 0, 0, 286, 815, 926, 0, 0, 946, 630,
+  801, 196, 470, 16, 537, 522, 580, 0, 0, 0, 0, 0, 0, 896, 328, 0,
+  0, 0, 0, 0, 0, 32, 0, 76, 871, 0, 933, 0, 0, 0, 791, 0,
+  0, 572, 981, 0, 90, 920, 0, 0, 55, 765, 0, 0, 562, 922, 528, 0,
+  0, 0, 830, 530, 0, 258, 987, 0, 0, 0, 357, 218, 372, 19, 861, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 494, 0, 882, 509, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 75, 0, 0, 162, 342, 924, 0, 615, 872, 0, 67,
+  0, 0, 722, 449, 843, 78, 459, 315, 863, 928, 0, 0, 0, 614, 816, 971,
+  0, 0, 0, 978, 0, 0, 0, 0, 552, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 514, 792, 0, 0, 443, 25, 0, 650, 0, 899, 0, 41, 0, 0,
+  0, 22, 0, 0, 0, 0, 0, 960, 0, 0, 883, 0, 226, 757, 951, 613,
+  0, 784, 0, 0, 847, 0, 774, 948, 0, 10, 0, 0, 0, 0, 0, 0,
+  683, 0, 0, 0, 0, 0, 0, 903, 0, 0, 0, 0, 0, 0, 0, 663,
+  152, 0, 0, 146, 571, 46, 674, 0, 0, 0, 0, 147, 311, 905, 0, 0,
+  0, 632, 364, 520, 796, 478, 0, 460, 0, 0, 0, 0, 718, 0, 0, 4,
+  525, 0, 0, 0, 343, 0, 0, 0, 390, 977, 0, 0, 0, 689, 0, 86,
+  122, 776, 0, 221, 932, 0, 826, 0, 0, 0, 0, 404, 829, 0, 771, 0,
+  657, 0, 0, 957, 0, 605, 0, 0, 0, 0, 566, 0, 0, 622, 732, 805,
+  188, 127, 479, 0, 0, 551, 0, 811, 14, 0, 980, 708, 0, 0, 93, 717,
+  985, 0, 469, 412, 0, 850, 344, 0, 0, 0, 0, 77, 68, 592, 0, 465,
+  0, 0, 0, 743, 0, 506, 121, 677, 892, 595, 546, 5, 39, 369, 539, 968,
+  0, 419, 497, 666, 760, 0, 300, 0, 302, 448, 678, 266, 0, 480, 0, 0,
+  0, 0, 201, 236, 0, 943, 501, 0, 0, 80, 0, 687, 0, 0, 232, 403,
+  0, 401, 0, 0, 0, 633, 202, 0, 0, 0, 0, 0, 0, 0, 647, 73,
+  0, 543, 748, 0, 0, 434, 0, 998, 0, 0, 0, 0, 0, 0, 435, 0,
+  0, 0, 0, 0, 327, 919, 0, 0, 0, 0, 0, 865, 377, 0, 0, 477,
+  888, 321, 0, 0, 96, 503, 0, 0, 0, 0, 0, 36, 0, 0, 0, 880,
+  0, 0, 665, 961, 160, 737, 0, 0, 0, 283, 596, 137, 346, 744, 352, 813,
+  0, 535, 542, 0, 20, 0, 0, 0, 714, 386, 0, 0, 758, 475, 228, 809,
+  0, 0, 0, 0, 0, 0, 565, 912, 652, 0, 445, 429, 597, 698, 764, 0,
+  0, 587, 329, 711, 110, 739, 845, 846, 0, 0, 529, 194, 0, 0, 439, 332,
+  582, 668, 753, 867, 915, 694, 0, 0, 0, 0, 281, 505, 964, 976, 111, 700,
+  794, 878, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 231,
+  499, 629, 0, 512, 350, 0, 0, 693, 285, 17, 0, 0, 589, 0, 621, 0,
+  0, 0, 0, 0, 0, 207, 237, 540, 761, 0, 0, 278, 455, 116, 164, 0,
+  427, 458, 763, 138, 0, 144, 756, 0, 430, 0, 52, 0, 0, 959, 0, 0,
+  534, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 483, 0,
+  0, 101, 0, 0, 795, 124, 0, 0, 0, 489, 0, 0, 0, 288, 0, 0,
+  0, 0, 109, 0, 0, 610, 935, 0, 0, 519, 697, 0, 0, 0, 0, 424,
+  588, 0, 0, 0, 0, 0, 0, 0, 0, 0, 115, 254, 521, 0, 606, 986,
+  0, 0, 0, 0, 0, 118, 0, 246, 0, 0, 0, 558, 21, 320, 440, 245,
+  387, 72, 0, 0, 870, 0, 0, 662, 0, 368, 600, 832, 0, 348, 103, 183,
+  495, 47, 259, 383, 533, 295, 643, 692, 706, 618, 837, 26, 742, 0, 532, 323,
+  454, 699, 730, 710, 844, 0, 0, 0, 142, 974, 0, 0, 0, 0, 355, 0,
+  0, 759, 100, 857, 0, 0, 0, 217, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 99, 384, 0, 0, 0, 0, 451, 0, 151, 603, 695, 640, 930,
+  394, 956, 988, 0, 284, 251, 0, 45, 335, 0, 0, 705, 0, 0, 12, 0,
+  812, 0, 0, 333, 200, 225, 527, 631, 161, 0, 0, 265, 0, 0, 0, 337,
+  680, 249, 381, 0, 0, 252, 359, 515, 120, 155, 0, 833, 500, 0, 0, 0,
+  0, 418, 0, 0, 0, 658, 0, 0, 0, 0, 273, 688, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 970, 0, 87, 0, 0, 901, 0, 0, 0, 841, 0,
+  54, 0, 0, 0, 170, 0, 0, 31, 209, 0, 0, 0, 0, 325, 396, 531,
+  751, 889, 358, 428, 559, 599, 0, 0, 911, 958, 0, 989, 775, 0, 0, 442,
+  802, 0, 408, 268, 271, 379, 485, 609, 670, 0, 0, 0, 0, 0, 171, 0,
+  803, 0, 134, 550, 0, 0, 391, 0, 0, 0, 0, 0, 253, 0, 602, 0,
+  0, 0, 0, 0, 0, 0, 0, 553, 902, 0, 0, 0, 0, 538, 0, 0,
+  416, 79, 0, 0, 0, 0, 0, 996, 0, 0, 0, 0, 0, 0, 0, 573,
+  624, 0, 0, 770, 0, 310, 0, 0, 106, 107, 139, 35, 205, 637, 289, 198,
+  398, 684, 735, 804, 851, 931, 0, 0, 0, 0, 15, 0, 724, 212, 145, 0,
+  234, 0, 0, 0, 0, 0, 6, 141, 682, 0, 671, 83, 619, 474, 725, 0,
+  0, 0, 0, 0, 0, 0, 0, 782, 0, 0, 0, 88, 175, 0, 0, 447,
+  0, 0, 664, 0, 0, 545, 0, 0, 607, 0, 511, 195, 222, 0, 508, 817,
+  0, 0, 0, 409, 731, 913, 0, 0, 917, 995, 984, 40, 858, 0, 0, 0,
+  0, 0, 859, 0, 186, 0, 0, 0, 0, 741, 779, 0, 0, 0, 57, 179,
+  437, 490, 653, 0, 893, 0, 0, 0, 267, 189, 0, 0, 616, 0, 149, 547,
+  0, 642, 0, 0, 29, 955, 361, 0, 0, 0, 0, 563, 942, 0, 0, 60,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 659, 0, 0, 0, 0, 868, 507,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 909, 0, 0, 422, 523, 0, 410,
+  750, 648, 840, 0, 0, 0, 0, 0, 351, 721, 0, 0, 0, 0, 0, 733,
+  11, 399, 0, 0, 703, 0, 842, 895, 0, 255, 297, 904, 0, 927, 378, 0,
+  0, 0, 923, 0, 312, 0, 0, 0, 918, 0, 799, 7, 0, 0, 309, 104,
+  720, 877, 628, 338, 0, 0, 0, 0, 0, 24, 95, 0, 248, 0, 438, 0,
+  0, 392, 113, 420, 0, 64, 0, 0, 0, 82, 0, 0, 0, 27, 654, 223,
+  157, 939, 598, 192, 788, 0, 0, 0, 0, 0, 0, 71, 0, 0, 0, 304,
+  62, 0, 0, 173, 0, 0, 0, 0, 0, 123, 0, 0, 0, 0, 0, 0,
+  691, 0, 84, 30, 347, 999, 910, 0, 0, 886, 0, 0, 800, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 331, 0, 754, 53, 0, 885, 517, 481, 818, 938,
+  0, 0, 510, 0, 496, 0, 0, 819, 456, 789, 0, 0, 324, 0, 0, 0,
+  216, 712, 0, 831, 303, 275, 823, 148, 204, 879, 734, 0, 37, 785, 0, 544,
+  906, 0, 0, 560, 0, 385, 154, 0, 570, 0, 18, 263, 0, 117, 191, 272,
+  380, 382, 728, 294, 0, 0, 214, 810, 0, 471, 276, 0, 0, 921, 38, 0,
+  42, 0, 180, 0, 0, 797, 0, 0, 0, 0, 0, 0, 0, 473, 593, 736,
+  365, 0, 0, 0, 639, 0, 247, 856, 0, 92, 0, 0, 262, 0, 626, 0,
+  900, 0, 326, 0, 349, 472, 983, 0, 0, 0, 0, 0, 887, 264, 356, 702,
+  466, 673, 849, 929, 0, 314, 0, 0, 0, 934, 0, 0, 373, 453, 296, 492,
+  585, 975, 274, 0, 502, 617, 627, 894, 190, 979, 0, 0, 0, 0, 89, 752,
+  0, 0, 0, 174, 773, 0, 467, 0, 0, 336, 852, 747, 0, 0, 345, 569,
+  864, 168, 790, 869, 0, 388, 444, 172, 625, 0, 0, 0, 947, 34, 63, 0,
+  257, 0, 0, 0, 44, 0, 130, 0, 0, 227, 669, 0, 0, 0, 0, 766,
+  0, 250, 376, 407, 425, 874, 0, 0, 982, 0, 0, 81, 0, 0, 972, 65,
+  0, 0, 0, 182, 426, 0, 672, 990, 143, 608, 169, 0, 0, 0, 0, 0,
+  167, 290, 890, 330, 584, 50, 244, 242, 876, 0, 131, 280, 898, 229, 491, 755,
+  914, 967, 158, 997, 0, 0, 0, 0, 834, 704, 0, 0, 746, 423, 0, 0,
+  0, 726, 363, 0, 0, 0, 925, 0, 464, 132, 0, 568, 0, 0, 0, 317,
+  0, 0, 581, 0, 0, 389, 685, 518, 777, 966, 0, 0, 211, 0, 0, 723,
+  176, 740, 0, 156, 431, 822, 0, 119, 0, 0, 0, 719, 604, 787, 897, 463,
+  0, 0, 0, 716, 85, 433, 0, 185, 0, 0, 0, 586, 827, 316, 66, 590,
+  98, 411, 820, 836, 660, 0, 230, 461, 486, 0, 0, 1000, 0, 0, 0, 561,
+  0, 0, 0, 0, 953, 177, 0, 0, 0, 406, 0, 0, 375, 452, 462, 667,
+  0, 0, 0, 793, 0, 0, 0, 0, 181, 341, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 260, 0, 0, 0, 178, 220, 0, 0, 0, 239, 270, 778, 636,
+  767, 150, 362, 256, 277, 308, 397, 853, 567, 907, 215, 0, 0, 807, 208, 370,
+  0, 0, 0, 557, 0, 421, 0, 0, 0, 0, 0, 963, 238, 0, 0, 159,
+  635, 786, 681, 0, 360, 487, 620, 855, 400, 8, 482, 513, 0, 937, 0, 94,
+  0, 0, 0, 649, 0, 0, 0, 0, 612, 97, 0, 0, 0, 0, 0, 0,
+  417, 0, 0, 0, 203, 0, 0, 0, 0, 0, 70, 493, 806, 0, 772, 0,
+  645, 51, 163, 313, 641, 318, 952, 0, 415, 306, 526, 576, 307, 661, 729, 0,
+  0, 679, 808, 814, 0, 0, 768, 0, 0, 0, 0, 206, 644, 61, 675, 762,
+  676, 58, 0, 0, 0, 0, 0, 153, 549, 738, 213, 48, 102, 282, 0, 0,
+  241, 0, 0, 0, 0, 0, 0, 0, 0, 709, 524, 0, 749, 235, 488, 187,
+  690, 866, 941, 13, 287, 133, 769, 91, 821, 498, 299, 0, 0, 536, 0, 0,
+  0, 862, 436, 0, 0, 0, 69, 468, 0, 0, 0, 0, 166, 184, 0, 0,
+  0, 0, 973, 0, 0, 825, 43, 136, 0, 0, 969, 0, 0, 0, 0, 0,
+  0, 0, 516, 780, 0, 0, 0, 292, 414, 432, 504, 0, 574, 125, 261, 686,
+  0, 854, 0, 108, 129, 367, 646, 873, 994, 0, 393, 0, 0, 413, 0, 23,
+};
+
+const char *WA_FREQ_17_TOKENS[] = {
+  "ar",
+  "eo",
+  "ket",
+  "h",
+  "c",
+  "da",
+  "an",
+  "a",
+  "e",
+  "ur",
+  "n",
+  "eus",
+  "ma",
+  "o",
+  "zo",
+  "ha",
+  "petra",
+  "gant",
+  "d",
+  "un",
+  "en",
+  "ne",
+  "din",
+  "oa",
+  "bet",
+  "ya",
+  "mat",
+  "se",
+  "ac",
+  "vo",
+  "on",
+  "teus",
+  "war",
+  "ho",
+  "m",
+  "mont",
+  "deus",
+  "amañ",
+  "hag",
+  "evit",
+  "ober",
+  "bezañ",
+  "ra",
+  "er",
+  "out",
+  "met",
+  "meus",
+  "dit",
+  "ken",
+  "neus",
+  "ran",
+  "hon",
+  "hoant",
+  "na",
+  "deomp",
+  "neuze",
+  "graet",
+  "mañ",
+  "ret",
+  "gwir",
+  "perak",
+  "all",
+  "oc",
+  "vit",
+  "me",
+  "gwelet",
+  "em",
+  "piv",
+  "re",
+  "te",
+  "hanon",
+  "rez",
+  "ebet",
+  "unan",
+  "pa",
+  "tra",
+  "al",
+  "lâret",
+  "anezhañ",
+  "vez",
+  "tu",
+  "pep",
+  "chom",
+  "pezh",
+  "ta",
+  "vont",
+  "soñj",
+  "pelec",
+  "penaos",
+  "hini",
+  "omp",
+  "peus",
+  "lâr",
+  "holl",
+  "anezho",
+  "pe",
+  "netra",
+  "traoù",
+  "setu",
+  "goût",
+  "deoc",
+  "he",
+  "oan",
+  "vefe",
+  "paotr",
+  "hoazh",
+  "kuit",
+  "letanant",
+  "ouzh",
+  "ganit",
+  "ni",
+  "rin",
+  "ganin",
+  "hor",
+  "ivez",
+  "digarez",
+  "dezhi",
+  "hanout",
+  "fell",
+  "lazhet",
+  "dezhañ",
+  "maout",
+  "marteze",
+  "bennak",
+  "kaoc",
+  "maon",
+  "dra",
+  "nemet",
+  "ez",
+  "bremañ",
+  "dre",
+  "kaout",
+  "deuet",
+  "moa",
+  "sell",
+  "ouzon",
+  "lec",
+  "vat",
+  "rit",
+  "den",
+  "vezañ",
+  "buan",
+  "ale",
+  "hast",
+  "dav",
+  "gwelloc",
+  "trugarez",
+  "tamm",
+  "paotred",
+  "int",
+  "kit",
+  "gantañ",
+  "sikour",
+  "amzer",
+  "dezho",
+  "aet",
+  "ok",
+  "am",
+  "dont",
+  "prest",
+  "fall",
+  "ezhomm",
+  "raio",
+  "laouen",
+  "easy",
+  "echu",
+  "tud",
+  "hep",
+  "maez",
+  "daou",
+  "oar",
+  "arc",
+  "ro",
+  "welet",
+  "gast",
+  "sur",
+  "tout",
+  "doue",
+  "komz",
+  "ul",
+  "anezhi",
+  "benn",
+  "kae",
+  "ri",
+  "kaset",
+  "anv",
+  "hanomp",
+  "faot",
+  "nann",
+  "az",
+  "marv",
+  "betek",
+  "eil",
+  "penn",
+  "paouez",
+  "klask",
+  "oas",
+  "peseurt",
+  "hed",
+  "kabiten",
+  "arabat",
+  "aotrou",
+  "kas",
+  "dud",
+  "soudarded",
+  "ouzhin",
+  "aze",
+  "hwi",
+  "hoarvezet",
+  "soudard",
+  "forzh",
+  "klevet",
+  "hant",
+  "dija",
+  "lakaat",
+  "het",
+  "stourm",
+  "aon",
+  "brezel",
+  "atav",
+  "zoken",
+  "gortoz",
+  "serjant",
+  "dreist",
+  "tont",
+  "company",
+  "gloazet",
+  "reomp",
+  "sot",
+  "hoari",
+  "banne",
+  "lazhañ",
+  "revr",
+  "peogwir",
+  "goude",
+  "gentañ",
+  "deuit",
+  "distreiñ",
+  "salud",
+  "iskis",
+  "fouzhañ",
+  "hanoc",
+  "toa",
+  "ganeoc",
+  "mamm",
+  "chomit",
+  "doa",
+  "lakaet",
+  "kevrenn",
+  "abaoe",
+  "brav",
+  "plac",
+  "roet",
+  "ganti",
+  "pad",
+  "baotred",
+  "kavet",
+  "tan",
+  "ganeomp",
+  "evel",
+  "sellet",
+  "merc",
+  "plijet",
+  "tapet",
+  "hañ",
+  "lez",
+  "wech",
+  "z",
+  "veg",
+  "eno",
+  "hell",
+  "i",
+  "bez",
+  "brein",
+  "labour",
+  "chef",
+  "emañ",
+  "hoc",
+  "vel",
+  "dalc",
+  "belec",
+  "nevez",
+  "kalz",
+  "kollet",
+  "kompren",
+  "deiz",
+  "paourkaezh",
+  "krediñ",
+  "marplij",
+  "serr",
+  "dirak",
+  "fin",
+  "buhez",
+  "blam",
+  "skarzh",
+  "soñjal",
+  "eñ",
+  "hellan",
+  "gêr",
+  "pebezh",
+  "cheñchet",
+  "bed",
+  "selaou",
+  "reiñ",
+  "reont",
+  "poent",
+  "gudenn",
+  "cheñch",
+  "kemer",
+  "edukatour",
+  "ganto",
+  "malarkey",
+  "bras",
+  "hi",
+  "goulenn",
+  "voc",
+  "morse",
+  "mignon",
+  "to",
+  "vi",
+  "gouzout",
+  "sioul",
+  "vimp",
+  "oamp",
+  "fenoz",
+  "devezh",
+  "kentañ",
+  "asambles",
+  "dispar",
+  "pell",
+  "peoc",
+  "ofiser",
+  "winters",
+  "gouest",
+  "de",
+  "hortoz",
+  "demat",
+  "oh",
+  "goap",
+  "po",
+  "lak",
+  "bev",
+  "rank",
+  "hel",
+  "joe",
+  "putenn",
+  "pich",
+  "plijus",
+  "nebeut",
+  "maomp",
+  "arme",
+  "noz",
+  "di",
+  "lerc",
+  "rae",
+  "gra",
+  "tapit",
+  "sellit",
+  "div",
+  "galloud",
+  "dok",
+  "seurt",
+  "kavout",
+  "halloud",
+  "jeu",
+  "klasket",
+  "dindan",
+  "sañset",
+  "giz",
+  "toull",
+  "dare",
+  "vidout",
+  "hit",
+  "vloaz",
+  "kerzh",
+  "chañs",
+  "hellez",
+  "tenn",
+  "tri",
+  "koant",
+  "goudor",
+  "geo",
+  "vamm",
+  "sapre",
+  "trawalc",
+  "hent",
+  "hoarvez",
+  "kendalc",
+  "sevel",
+  "blij",
+  "sac",
+  "vuhez",
+  "laeret",
+  "webster",
+  "azen",
+  "dec",
+  "batailhon",
+  "barzh",
+  "noa",
+  "plijout",
+  "dike",
+  "mignoned",
+  "memes",
+  "jentil",
+  "mervel",
+  "glask",
+  "vin",
+  "koronal",
+  "muioc",
+  "bern",
+  "plijadur",
+  "harr",
+  "nor",
+  "selaouit",
+  "digarezit",
+  "soñje",
+  "paket",
+  "diouzhtu",
+  "marvet",
+  "munisionoù",
+  "emaomp",
+  "bloaz",
+  "ouzhit",
+  "jezuz",
+  "kac",
+  "grit",
+  "tennañ",
+  "kudenn",
+  "rimp",
+  "gwellañ",
+  "woody",
+  "viz",
+  "outañ",
+  "adarre",
+  "boued",
+  "just",
+  "kasit",
+  "blithe",
+  "hepken",
+  "luz",
+  "armoù",
+  "vije",
+  "ranket",
+  "speirs",
+  "lipton",
+  "anavezout",
+  "trec",
+  "kozh",
+  "tad",
+  "lous",
+  "gav",
+  "tomm",
+  "bevañ",
+  "gourc",
+  "keta",
+  "hemennoù",
+  "guarnere",
+  "tadig",
+  "mersi",
+  "shaun",
+  "bihan",
+  "kroget",
+  "maoc",
+  "mo",
+  "dremenet",
+  "istitloù",
+  "soñjet",
+  "t",
+  "pegoulz",
+  "ti",
+  "lârez",
+  "kleiz",
+  "lâran",
+  "curtis",
+  "hiziv",
+  "spontus",
+  "polis",
+  "mije",
+  "plas",
+  "breur",
+  "gortozit",
+  "gorventenn",
+  "team",
+  "oant",
+  "kelly",
+  "veze",
+  "dilhad",
+  "emaon",
+  "start",
+  "lod",
+  "lavaret",
+  "raimp",
+  "nathan",
+  "skuizh",
+  "doare",
+  "voched",
+  "komzet",
+  "emaint",
+  "istor",
+  "gevier",
+  "hoarvezout",
+  "vidon",
+  "aes",
+  "nozvezh",
+  "istits",
+  "sutal",
+  "urzhioù",
+  "osterlich",
+  "chalet",
+  "sav",
+  "komprenet",
+  "distroet",
+  "goulennet",
+  "dehoù",
+  "afo",
+  "lârit",
+  "dispac",
+  "maint",
+  "disoñjet",
+  "mab",
+  "sobel",
+  "tony",
+  "medisin",
+  "zad",
+  "schultz",
+  "distro",
+  "skarzhit",
+  "sirius",
+  "ouzhpenn",
+  "linenn",
+  "poan",
+  "pellgomz",
+  "miz",
+  "touchañ",
+  "dazont",
+  "laerezh",
+  "mezeg",
+  "emaoc",
+  "babig",
+  "strollad",
+  "tremen",
+  "enebourien",
+  "plij",
+  "douar",
+  "gomz",
+  "vefes",
+  "diouzh",
+  "fiziañs",
+  "toye",
+  "lol",
+  "klevout",
+  "lezit",
+  "kement",
+  "alisha",
+  "greizenn",
+  "rafe",
+  "warc",
+  "raen",
+  "dramm",
+  "hitler",
+  "perconte",
+  "arm",
+  "kuzhet",
+  "eget",
+  "diwezhatoc",
+  "munutenn",
+  "jeneral",
+  "roit",
+  "horfoù",
+  "takad",
+  "fazi",
+  "hol",
+  "skoet",
+  "vro",
+  "kontañ",
+  "felle",
+  "bep",
+  "horonal",
+  "evezh",
+  "dour",
+  "tomania",
+  "nedeleg",
+  "eur",
+  "hall",
+  "talbenn",
+  "tost",
+  "bill",
+  "gellet",
+  "buck",
+  "sink",
+  "seblant",
+  "hynkel",
+  "pemp",
+  "digor",
+  "santout",
+  "du",
+  "santan",
+  "hwec",
+  "homandant",
+  "memestra",
+  "warnañ",
+  "etre",
+  "diwezhañ",
+  "heffron",
+  "teu",
+  "skarzhet",
+  "liebgott",
+  "dro",
+  "moarvat",
+  "alemañ",
+  "diwar",
+  "dad",
+  "hey",
+  "blev",
+  "ouiez",
+  "kentoc",
+  "welan",
+  "bezit",
+  "warnon",
+  "saveteiñ",
+  "jackson",
+  "faskourien",
+  "oac",
+  "bugel",
+  "alamaned",
+  "galloudoù",
+  "drol",
+  "bull",
+  "kaer",
+  "pet",
+  "dres",
+  "gompagnunezh",
+  "spered",
+  "lenn",
+  "krakoù",
+  "vervel",
+  "yaouank",
+  "diwelus",
+  "pegen",
+  "hennezh",
+  "nac",
+  "nixon",
+  "hat",
+  "bastogne",
+  "dal",
+  "tennet",
+  "moal",
+  "mui",
+  "neuz",
+  "lezel",
+  "bugale",
+  "milis",
+  "batrouilhenn",
+  "marc",
+  "mare",
+  "farsal",
+  "tro",
+  "digorit",
+  "evidon",
+  "krog",
+  "respont",
+  "ospital",
+  "harz",
+  "spi",
+  "dieub",
+  "buanoc",
+  "tec",
+  "alaman",
+  "diskouezh",
+  "divarvel",
+  "kont",
+  "izelvroioù",
+  "emzalc",
+  "rafen",
+  "shifty",
+  "afer",
+  "kredapl",
+  "diwall",
+  "añ",
+  "pc",
+  "fouzhet",
+  "sklaer",
+  "aotrounez",
+  "kemeret",
+  "leur",
+  "labourat",
+  "chomet",
+  "reoù",
+  "eurvezh",
+  "egile",
+  "rankout",
+  "biskoazh",
+  "ger",
+  "bobl",
+  "neañ",
+  "karout",
+  "enebour",
+  "gwech",
+  "redek",
+  "harzet",
+  "pelloc",
+  "combo",
+  "vint",
+  "gevrenn",
+  "sed",
+  "pichoù",
+  "tennit",
+  "erru",
+  "mignonez",
+  "bec",
+  "nemetken",
+  "skeiñ",
+  "saoz",
+  "pal",
+  "pevar",
+  "droch",
+  "gwashañ",
+  "hwitet",
+  "simon",
+  "mar",
+  "frankiz",
+  "lammat",
+  "normandi",
+  "kuzh",
+  "nemetañ",
+  "emgann",
+  "mod",
+  "naon",
+  "get",
+  "fas",
+  "napaloni",
+  "dick",
+  "rejimant",
+  "major",
+  "gell",
+  "taget",
+  "evañ",
+  "airborne",
+  "bil",
+  "kredet",
+  "paotrig",
+  "betra",
+  "nullet",
+  "hastit",
+  "van",
+  "vefemp",
+  "mestr",
+  "lakait",
+  "lorc",
+  "prizonidi",
+  "hir",
+  "taol",
+  "voe",
+  "boch",
+  "grevus",
+  "nebeutañ",
+  "gellout",
+  "posubl",
+  "vignonez",
+  "azez",
+  "gwall",
+  "do",
+  "skarzhomp",
+  "loen",
+  "bewech",
+  "hwezh",
+  "noazh",
+  "martin",
+  "grant",
+  "habiten",
+  "kuzhit",
+  "breudeur",
+  "diaes",
+  "tremenet",
+  "foutre",
+  "heul",
+  "bagad",
+  "lezet",
+  "pegement",
+  "gas",
+  "biken",
+  "fliked",
+  "rediet",
+  "kwelet",
+  "lip",
+  "servij",
+  "troet",
+  "varv",
+  "daoust",
+  "ennon",
+  "hervez",
+  "louskenn",
+  "poa",
+  "komandant",
+  "dedennet",
+  "koulskoude",
+  "drouk",
+  "tizhet",
+  "milk",
+  "estreget",
+  "kudennoù",
+  "vefen",
+  "tennoù",
+  "kousket",
+  "ennout",
+  "debret",
+  "zont",
+  "bastard",
+  "soñjan",
+  "muck",
+  "dennañ",
+  "poum",
+  "grede",
+  "har",
+  "nefe",
+  "p",
+  "nebeud",
+  "vezez",
+  "kennebeut",
+  "skol",
+  "vunutenn",
+  "stal",
+  "yuzevien",
+  "tapout",
+  "seblantout",
+  "hanter",
+  "barver",
+  "sikouret",
+  "tefe",
+  "troc",
+  "morfin",
+  "mcclung",
+  "kablus",
+  "farsadenn",
+  "el",
+  "derc",
+  "eugene",
+  "familh",
+  "renkañ",
+  "rafes",
+  "hellfe",
+  "nag",
+  "neketa",
+  "sigaretenn",
+  "dibabet",
+  "prenet",
+  "hellomp",
+  "stad",
+  "davet",
+  "prof",
+  "kenô",
+  "it",
+  "mankout",
+  "daouarn",
+  "red",
+  "heller",
+  "ba",
+  "fuzuilh",
+  "popeye",
+  "smell",
+  "ouie",
+  "outo",
+  "dorn",
+  "fiñv",
+  "kavit",
+  "dale",
+  "gwareziñ",
+  "vras",
+  "su",
+  "alc",
+  "keleier",
+  "gac",
+  "azezañ",
+  "emgav",
+  "rak",
+  "kemerit",
+  "houlenn",
+  "ranndi",
+  "kuitaat",
+  "gwaz",
+  "compton",
+  "sizhunvezh",
+  "goulennoù",
+  "babe",
+  "perzh",
+  "michañs",
+  "george",
+  "skoazell",
+  "hello",
+  "vrav",
+  "penkala",
+  "jones",
+  "kafe",
+  "aotre",
+  "hellit",
+  "kreñv",
+  "meehan",
+  "renket",
+  "warnout",
+  "kaoz",
+  "urzh",
+  "sam",
+  "kalon",
+  "stêr",
+  "farsus",
+  "politikel",
+  "brudet",
+  "leñvañ",
+  "torret",
+  "diskouez",
+  "gomprenan",
+  "null",
+  "loc",
+  "ziwezhat",
+  "disheñvel",
+  "pennoù",
+  "ruz",
+  "tap",
+  "madigoù",
+  "blanca",
+  "foy",
+  "tankoù",
+  "abeg",
+  "distruj",
+  "mezh",
+  "gouarnamant",
+  "labourerien",
+  "km",
+  "bremaik",
+  "gwad",
+  "baoe",
+  "sizhun",
+  "bronnoù",
+  "yuzev",
+  "jeep",
+  "vezomp",
+  "greunadennoù",
+  "evidomp",
+  "skarzhañ",
+  "alamagn",
+  "kenderc",
+  "gwarezet",
+  "abalamour",
+  "debriñ",
+  "rankomp",
+  "itron",
+  "yec",
+  "souezhet",
+  "ouien",
+  "skrivet",
+  "nec",
+  "difennet",
+  "doenn",
+  "zen",
+  "hoobler",
+  "gwisket",
+  "fenn",
+  "dibab",
+  "fiñval",
+  "hoarzhin",
+  "kregiñ",
+  "desket",
+  "hallan",
+  "dilezel",
+  "erruiñ",
+  "mammig",
+  "peurrest",
+  "alkol",
+  "soñjez",
+  "ec",
+  "vezer",
+  "welez",
+  "pouezus",
+  "gwashoc",
+  "johnny",
+  "echuiñ",
+  "zebriñ",
+  "ouzhoc",
+  "disoñjal",
+  "mann",
+  "prenañ",
+  "empenn",
+  "wir",
+  "lizhiri",
+  "fiñvit",
+  "renk",
+  "franco",
+  "blas",
+  "stanket",
+  "radio",
+  "europa",
+  "lamm",
+  "muntr",
+  "ofiserien",
+  "keuz",
+  "kompagnunezh",
+  "evidoc",
+  "masklet",
+  "butun",
+  "adkavout",
+};
+const uint16_t WA_FREQ_17_RANKS[] = {
+  0, 862, 0, 205, 0, 0, 706, 778, 0, 0, 0, 0, 524, 0, 373, 0,
+  27, 478, 0, 0, 60, 854, 0, 0, 0, 0, 58, 0, 562, 0, 399, 215,
+  822, 0, 0, 0, 0, 0, 0, 0, 120, 455, 535, 890, 0, 781, 19, 36,
+  208, 0, 0, 0, 0, 0, 575, 0, 548, 0, 0, 0, 702, 0, 0, 0,
+  0, 89, 0, 964, 0, 0, 0, 194, 216, 381, 0, 348, 681, 0, 107, 104,
+  653, 0, 647, 0, 0, 0, 608, 0, 522, 851, 0, 0, 993, 0, 271, 143,
+  835, 0, 0, 214, 414, 448, 586, 791, 923, 655, 351, 0, 0, 0, 177, 386,
+  0, 287, 464, 449, 565, 894, 0, 571, 182, 309, 365, 0, 0, 0, 260, 782,
+  780, 50, 741, 539, 0, 0, 0, 512, 0, 0, 955, 0, 437, 0, 0, 314,
+  0, 0, 315, 576, 945, 800, 0, 0, 164, 0, 423, 392, 761, 0, 0, 0,
+  103, 0, 0, 883, 714, 0, 0, 0, 0, 0, 0, 0, 0, 960, 0, 0,
+  202, 838, 459, 0, 152, 534, 0, 0, 0, 0, 162, 636, 483, 0, 0, 0,
+  0, 0, 0, 0, 101, 0, 0, 0, 0, 0, 0, 0, 0, 635, 427, 701,
+  837, 920, 209, 0, 695, 0, 124, 924, 0, 0, 729, 0, 0, 0, 533, 0,
+  212, 0, 0, 0, 0, 0, 403, 457, 581, 0, 362, 251, 814, 662, 0, 629,
+  784, 631, 721, 760, 772, 997, 312, 450, 0, 0, 819, 0, 136, 0, 0, 0,
+  0, 70, 266, 283, 0, 0, 0, 881, 73, 80, 887, 0, 280, 447, 727, 659,
+  603, 0, 0, 91, 426, 385, 785, 0, 528, 618, 991, 0, 689, 743, 0, 497,
+  0, 0, 966, 428, 258, 532, 183, 297, 673, 378, 0, 538, 119, 195, 658, 440,
+  560, 619, 979, 869, 981, 0, 273, 3, 599, 970, 304, 0, 0, 166, 0, 0,
+  0, 0, 0, 0, 0, 264, 0, 0, 0, 0, 0, 591, 523, 0, 279, 0,
+  0, 0, 0, 0, 974, 0, 0, 0, 0, 0, 0, 0, 934, 637, 81, 0,
+  163, 0, 0, 1, 41, 0, 809, 0, 0, 269, 170, 0, 0, 570, 0, 0,
+  0, 0, 302, 394, 318, 849, 121, 0, 0, 946, 275, 610, 0, 0, 0, 0,
+  0, 0, 0, 327, 630, 725, 745, 753, 0, 0, 0, 0, 256, 0, 0, 141,
+  247, 0, 0, 0, 983, 376, 499, 0, 0, 510, 0, 0, 0, 0, 116, 38,
+  39, 301, 940, 65, 561, 0, 0, 0, 841, 917, 932, 751, 566, 154, 229, 0,
+  0, 0, 967, 8, 461, 537, 123, 369, 144, 0, 0, 842, 0, 0, 193, 137,
+  818, 792, 68, 588, 1000, 0, 78, 0, 0, 0, 0, 0, 995, 0, 677, 0,
+  0, 0, 597, 0, 0, 0, 915, 0, 0, 24, 0, 951, 186, 0, 0, 0,
+  0, 0, 344, 557, 634, 648, 0, 0, 343, 0, 0, 281, 697, 238, 289, 42,
+  649, 0, 0, 0, 0, 0, 75, 0, 742, 0, 0, 793, 957, 0, 0, 114,
+  462, 210, 66, 0, 0, 617, 357, 391, 546, 374, 431, 664, 884, 0, 754, 0,
+  0, 675, 0, 0, 0, 0, 241, 975, 0, 0, 0, 0, 0, 0, 0, 0,
+  558, 0, 0, 0, 0, 696, 0, 0, 708, 0, 709, 856, 0, 876, 756, 0,
+  0, 0, 552, 485, 225, 113, 0, 0, 454, 0, 110, 0, 0, 0, 63, 286,
+  638, 831, 213, 0, 0, 0, 342, 220, 0, 0, 0, 0, 0, 368, 0, 11,
+  0, 115, 0, 48, 293, 0, 0, 836, 0, 843, 492, 222, 877, 236, 150, 891,
+  0, 130, 0, 0, 0, 199, 549, 72, 0, 0, 235, 71, 157, 0, 307, 356,
+  614, 227, 720, 666, 859, 0, 0, 612, 410, 912, 0, 419, 911, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 545, 916, 823, 0, 0, 850, 0,
+  0, 0, 0, 0, 0, 0, 100, 844, 998, 372, 832, 268, 0, 0, 0, 0,
+  179, 584, 324, 713, 54, 418, 919, 678, 0, 0, 438, 0, 470, 0, 871, 0,
+  879, 875, 0, 0, 615, 0, 0, 704, 719, 433, 628, 390, 863, 0, 798, 0,
+  0, 92, 718, 0, 0, 0, 420, 0, 0, 0, 441, 23, 0, 728, 0, 400,
+  802, 0, 0, 0, 0, 192, 942, 0, 0, 0, 0, 0, 0, 129, 278, 416,
+  421, 750, 567, 816, 855, 0, 83, 0, 0, 0, 0, 684, 0, 0, 0, 0,
+  0, 0, 0, 0, 145, 0, 651, 888, 0, 218, 0, 0, 783, 0, 383, 43,
+  69, 543, 853, 0, 904, 0, 0, 494, 903, 0, 935, 0, 0, 578, 811, 763,
+  0, 0, 517, 0, 0, 0, 0, 0, 0, 0, 0, 230, 0, 705, 0, 0,
+  0, 14, 88, 353, 0, 76, 219, 660, 294, 0, 0, 0, 555, 667, 0, 0,
+  931, 922, 0, 0, 0, 0, 0, 0, 228, 0, 0, 0, 491, 0, 0, 0,
+  0, 986, 0, 0, 0, 665, 0, 723, 812, 978, 0, 0, 320, 0, 0, 572,
+  389, 726, 0, 0, 333, 0, 0, 715, 117, 451, 474, 755, 336, 108, 765, 0,
+  463, 582, 338, 886, 0, 0, 885, 0, 0, 749, 411, 0, 161, 329, 272, 493,
+  0, 0, 0, 0, 0, 0, 97, 0, 0, 0, 529, 626, 766, 0, 0, 574,
+  0, 0, 0, 0, 0, 105, 395, 544, 880, 992, 417, 488, 0, 0, 160, 0,
+  878, 0, 0, 0, 7, 740, 985, 446, 824, 0, 773, 0, 503, 15, 0, 0,
+  0, 0, 0, 604, 276, 907, 963, 0, 0, 0, 0, 0, 913, 0, 46, 0,
+  486, 377, 311, 476, 481, 189, 223, 432, 59, 207, 542, 737, 956, 0, 0, 674,
+  950, 0, 0, 325, 0, 999, 0, 0, 0, 217, 733, 0, 0, 516, 0, 0,
+  764, 0, 484, 64, 0, 0, 813, 0, 0, 0, 190, 527, 0, 0, 204, 367,
+  600, 0, 85, 501, 633, 803, 694, 691, 0, 0, 0, 0, 663, 0, 224, 0,
+  556, 0, 0, 53, 436, 573, 396, 424, 347, 282, 384, 472, 0, 0, 0, 0,
+  0, 303, 805, 0, 487, 700, 710, 18, 317, 191, 255, 337, 613, 686, 759, 897,
+  0, 0, 906, 0, 0, 2, 767, 0, 563, 0, 0, 259, 789, 0, 703, 185,
+  690, 330, 468, 456, 587, 616, 0, 0, 0, 379, 0, 502, 559, 184, 248, 602,
+  941, 972, 412, 277, 393, 226, 22, 435, 788, 375, 442, 643, 0, 176, 445, 657,
+  0, 0, 0, 0, 0, 239, 0, 0, 0, 0, 288, 779, 848, 0, 122, 308,
+  95, 473, 490, 794, 0, 382, 274, 197, 0, 585, 0, 388, 181, 0, 0, 20,
+  525, 926, 0, 0, 0, 0, 0, 0, 598, 350, 0, 0, 0, 0, 821, 0,
+  0, 0, 506, 747, 0, 0, 0, 0, 0, 125, 0, 541, 982, 0, 0, 0,
+  0, 0, 0, 0, 44, 98, 0, 0, 0, 0, 29, 99, 0, 0, 0, 845,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 335, 0, 0, 925, 257,
+  265, 827, 0, 661, 0, 167, 0, 987, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 509, 744, 0, 156, 0, 0, 0, 0, 326, 622, 0, 0, 730, 0,
+  430, 0, 0, 253, 0, 17, 0, 0, 601, 61, 804, 757, 839, 893, 106, 504,
+  0, 0, 364, 775, 0, 0, 0, 968, 0, 0, 0, 0, 0, 0, 933, 0,
+  609, 305, 623, 852, 683, 650, 0, 295, 595, 0, 0, 0, 692, 980, 0, 471,
+  328, 0, 262, 151, 0, 0, 0, 12, 0, 405, 0, 0, 13, 738, 834, 731,
+  0, 0, 0, 206, 118, 0, 0, 0, 0, 776, 0, 0, 0, 0, 175, 554,
+  0, 0, 0, 25, 0, 0, 254, 817, 0, 0, 233, 0, 0, 688, 0, 0,
+  927, 0, 0, 0, 0, 0, 0, 0, 671, 0, 0, 0, 0, 407, 0, 444,
+  0, 0, 639, 112, 500, 905, 0, 128, 801, 949, 795, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 469, 0, 0, 0, 0, 0, 380, 402, 564, 0, 140, 829,
+  0, 231, 0, 221, 0, 0, 0, 732, 519, 873, 0, 746, 0, 482, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 899, 0, 0, 895, 0, 0, 0, 611,
+  0, 0, 322, 0, 0, 0, 0, 0, 0, 624, 758, 846, 232, 0, 47, 397,
+  0, 0, 0, 938, 508, 77, 540, 475, 0, 363, 290, 0, 0, 874, 646, 0,
+  0, 583, 0, 0, 0, 857, 0, 0, 0, 679, 930, 625, 452, 0, 422, 947,
+  0, 0, 0, 35, 249, 0, 680, 148, 943, 203, 901, 0, 644, 640, 0, 352,
+  0, 0, 0, 0, 0, 0, 0, 135, 188, 84, 996, 0, 0, 0, 699, 0,
+  770, 0, 0, 0, 0, 0, 0, 0, 769, 340, 909, 948, 354, 0, 797, 937,
+  0, 0, 0, 0, 0, 0, 0, 676, 0, 569, 0, 0, 0, 707, 988, 787,
+  505, 0, 0, 0, 0, 0, 0, 0, 0, 858, 771, 693, 149, 870, 33, 872,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 171, 0, 0, 0, 0, 0, 961,
+  0, 0, 45, 316, 349, 826, 959, 0, 0, 0, 0, 0, 172, 0, 299, 489,
+  90, 910, 32, 165, 0, 0, 0, 0, 825, 0, 0, 0, 0, 579, 0, 466,
+  526, 513, 734, 409, 460, 0, 0, 0, 698, 291, 37, 355, 0, 0, 627, 0,
+  0, 0, 0, 0, 536, 861, 0, 589, 0, 0, 496, 93, 0, 0, 0, 0,
+  0, 0, 670, 0, 0, 0, 645, 345, 810, 0, 0, 0, 0, 0, 0, 607,
+  682, 0, 0, 977, 0, 0, 0, 0, 0, 0, 0, 0, 0, 180, 28, 370,
+  306, 902, 0, 0, 0, 0, 0, 958, 944, 173, 0, 0, 799, 0, 889, 0,
+  133, 0, 310, 9, 131, 652, 716, 16, 0, 10, 656, 0, 0, 0, 0, 0,
+  285, 687, 739, 954, 0, 453, 768, 79, 0, 0, 169, 685, 0, 547, 168, 989,
+  0, 0, 0, 158, 0, 0, 668, 796, 939, 928, 196, 0, 0, 147, 971, 984,
+  245, 0, 0, 0, 592, 246, 593, 962, 736, 748, 0, 0, 0, 211, 641, 717,
+  0, 0, 0, 0, 0, 0, 55, 198, 387, 0, 0, 0, 0, 404, 434, 0,
+  94, 146, 174, 34, 49, 596, 606, 712, 284, 0, 57, 319, 0, 0, 0, 0,
+  914, 292, 521, 366, 520, 0, 0, 0, 551, 0, 0, 240, 0, 0, 620, 126,
+  815, 0, 0, 0, 40, 26, 323, 296, 331, 752, 515, 711, 866, 67, 0, 0,
+  0, 21, 82, 0, 918, 134, 976, 0, 267, 139, 590, 774, 0, 155, 0, 0,
+  0, 0, 0, 4, 0, 594, 847, 413, 830, 142, 360, 0, 359, 0, 990, 201,
+  252, 0, 0, 0, 465, 153, 806, 0, 0, 111, 965, 0, 0, 31, 580, 908,
+  0, 0, 439, 833, 929, 0, 0, 808, 0, 0, 864, 0, 0, 62, 187, 865,
+  896, 0, 0, 0, 0, 0, 0, 0, 242, 334, 0, 777, 0, 0, 0, 0,
+  458, 346, 358, 507, 867, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  577, 0, 642, 531, 0, 0, 234, 0, 270, 263, 0, 550, 159, 332, 860, 936,
+  0, 724, 0, 722, 0, 0, 0, 0, 0, 0, 0, 0, 250, 0, 0, 0,
+  0, 530, 0, 0, 0, 605, 0, 443, 994, 0, 51, 87, 6, 102, 200, 398,
+  892, 0, 0, 952, 0, 237, 0, 0, 467, 0, 371, 0, 313, 0, 96, 840,
+  0, 5, 0, 0, 790, 0, 0, 0, 300, 568, 425, 477, 243, 321, 361, 401,
+  132, 632, 953, 882, 973, 669, 0, 406, 109, 621, 921, 0, 900, 30, 479, 495,
+  244, 0, 0, 127, 0, 0, 74, 0, 0, 0, 0, 178, 0, 0, 807, 0,
+  0, 341, 429, 0, 0, 138, 0, 0, 0, 0, 0, 0, 0, 498, 0, 0,
+  0, 762, 480, 786, 0, 511, 0, 0, 0, 0, 0, 514, 553, 52, 0, 0,
+  0, 0, 0, 56, 339, 735, 969, 898, 0, 0, 0, 0, 820, 0, 0, 828,
+  518, 654, 868, 0, 0, 415, 0, 0, 0, 86, 298, 408, 261, 672, 0, 0,
+};
+
+const char *WA_FREQ_18_TOKENS[] = {
+  "म",
+  "थ",
+  "न",
+  "द",
+  "फ",
+  "यन",
+  "ब",
+  "य",
+  "आ",
+  "आयआ",
+  "ग",
+  "ज",
+  "हमन",
+  "ख",
+  "व",
+  "ma",
+  "kalamdwng",
+  "toma",
+  "table",
+  "ni",
+  "gahayao",
+  "gaoni",
+  "glasses",
+  "nagirgasinw",
+  "आफ",
+  "स",
+};
+const uint16_t WA_FREQ_18_RANKS[] = {
+  23, 0, 0, 0, 0, 1, 0, 0, 19, 0, 0, 0, 0, 4, 0, 8,
+  0, 0, 0, 0, 14, 11, 12, 6, 22, 20, 0, 2, 17, 0, 0, 7,
+  24, 0, 0, 13, 0, 0, 0, 0, 26, 0, 0, 0, 0, 0, 5, 9,
+  0, 0, 0, 0, 0, 0, 3, 21, 0, 25, 0, 15, 16, 0, 10, 18,
+};
+
+const char *WA_FREQ_19_TOKENS[] = {
+  "je",
+  "i",
+  "u",
+  "da",
+  "na",
+  "za",
+  "se",
+  "su",
+  "od",
+  "će",
+  "koji",
+  "a",
+  "iz",
+  "sa",
+  "BiH",
+  "o",
+  "bi",
+  "ne",
+  "što",
+  "do",
+  "ili",
+  "biti",
+  "kako",
+  "to",
+  "nije",
+  "kao",
+  "U",
+  "koje",
+  "te",
+  "godine",
+  "s",
+  "koja",
+  "ali",
+  "po",
+  "sve",
+  "više",
+  "nakon",
+  "dana",
+  "zbog",
+  "još",
+  "samo",
+  "jer",
+  "sam",
+  "smo",
+  "može",
+  "ima",
+  "danas",
+  "rekao",
+  "već",
+  "Na",
+  "bio",
+  "bilo",
+  "godina",
+  "ove",
+  "oko",
+  "kada",
+  "nisu",
+  "prije",
+  "protiv",
+  "mogu",
+  "prema",
+  "bez",
+  "dok",
+  "ga",
+  "jedan",
+  "tako",
+  "ljudi",
+  "li",
+  "sada",
+  "uz",
+  "tri",
+  "svoje",
+  "dva",
+  "KM",
+  "treba",
+  "kaže",
+  "pa",
+  "toga",
+  "nekoliko",
+  "Sarajevo",
+  "ih",
+  "kod",
+  "vrijeme",
+  "bila",
+  "kazao",
+  "neće",
+  "broj",
+  "Za",
+  "miliona",
+  "gdje",
+  "koju",
+  "ovog",
+  "nego",
+  "imaju",
+  "mu",
+  "nema",
+  "tokom",
+  "način",
+  "ugovora",
+  "dvije",
+  "ovaj",
+  "ako",
+  "bude",
+  "između",
+  "mi",
+  "Nakon",
+  "To",
+  "Prema",
+  "kojima",
+  "osoba",
+  "Kako",
+  "pod",
+  "I",
+  "ovom",
+  "prenosi",
+  "prvi",
+  "radi",
+  "nam",
+  "put",
+  "prava",
+  "Bosne",
+  "odnosno",
+  "posto",
+  "predmeta",
+  "sati",
+  "Sarajevu",
+  "svih",
+  "predsjednik",
+  "ni",
+  "puta",
+  "dan",
+  "oni",
+  "bili",
+  "uvijek",
+  "im",
+  "svi",
+  "tome",
+  "pomoć",
+  "svoj",
+  "pet",
+  "taj",
+  "svoju",
+  "ovo",
+  "Ako",
+  "Hercegovine",
+  "četiri",
+  "kojoj",
+  "zemlje",
+  "vam",
+  "nas",
+  "dio",
+  "mora",
+  "svojim",
+  "mjesto",
+  "nešto",
+  "njih",
+  "druge",
+  "ćemo",
+  "pomoći",
+  "kojem",
+  "kroz",
+  "strane",
+  "među",
+  "On",
+  "Srbije",
+  "Republike",
+  "dalje",
+  "tim",
+  "novi",
+  "drugi",
+  "preko",
+  "piše",
+  "jedna",
+  "području",
+  "pred",
+  "on",
+  "ste",
+  "izjavio",
+  "FBiH",
+  "jednom",
+  "pravo",
+  "šta",
+  "godinu",
+  "Da",
+  "kuće",
+  "vlasti",
+  "putem",
+  "dobro",
+  "tom",
+  "RS",
+  "vrlo",
+  "navodi",
+  "ona",
+  "imati",
+  "usluga",
+  "mnogo",
+  "dolara",
+  "čak",
+  "vozila",
+  "svim",
+  "svijeta",
+  "mjesta",
+  "VIDEO",
+  "smatra",
+  "svijetu",
+  "Srpske",
+  "eura",
+  "veliki",
+  "posebno",
+  "kad",
+  "također",
+  "život",
+  "osobe",
+  "lica",
+  "bit",
+  "pitanje",
+  "Od",
+  "postoji",
+  "vremena",
+  "mogao",
+  "šest",
+  "rad",
+  "EU",
+  "trebalo",
+  "možete",
+  "predsjednika",
+  "prošle",
+  "ova",
+  "sporazuma",
+  "joj",
+  "građana",
+  "vode",
+  "ovoj",
+  "Iako",
+  "A",
+  "Ali",
+  "opis",
+  "čega",
+  "jednog",
+  "Hrvatske",
+  "koliko",
+  "slučaju",
+  "manje",
+  "Vlade",
+  "II",
+  "mjestu",
+  "naše",
+  "Međutim",
+  "neki",
+  "Sarajeva",
+  "Sve",
+  "Kratak",
+  "Ne",
+  "rada",
+  "mogli",
+  "onda",
+  "grada",
+  "Ovo",
+  "ti",
+  "nad",
+  "drugih",
+  "sredstava",
+  "ono",
+  "ponuda",
+  "ovu",
+  "riječima",
+  "želi",
+  "poslije",
+  "ranije",
+  "poput",
+  "nove",
+  "svom",
+  "Vlada",
+  "kraja",
+  "svog",
+  "djecu",
+  "ništa",
+  "2012",
+  "zajedno",
+  "života",
+  "neke",
+  "Mjesto",
+  "stvari",
+  "istakao",
+  "Federacije",
+  "vas",
+  "S",
+  "zakona",
+  "mjeseci",
+  "veoma",
+  "mjeseca",
+  "tu",
+  "isporuke",
+  "prilikom",
+  "dodao",
+  "njega",
+  "žena",
+  "općine",
+  "tog",
+  "naroda",
+  "roba",
+  "budu",
+  "jednu",
+  "moraju",
+  "znači",
+  "nalazi",
+  "sedam",
+  "njegov",
+  "poslova",
+  "ovih",
+  "tek",
+  "tvrdi",
+  "ipak",
+  "Iz",
+  "10",
+  "najviše",
+  "kojeg",
+  "okvirnog",
+  "Kada",
+  "one",
+  "puno",
+  "kojih",
+  "zemalja",
+  "riječ",
+  "ministar",
+  "ponovo",
+  "niti",
+  "aktivnosti",
+  "pri",
+  "države",
+  "potrebno",
+  "kojim",
+  "ko",
+  "imao",
+  "učešće",
+  "Više",
+  "Zbog",
+  "problem",
+  "bolje",
+  "djece",
+  "kraju",
+  "ponude",
+  "svaki",
+  "svega",
+  "sebe",
+  "teško",
+  "Skupštine",
+  "2.",
+  "zemlji",
+  "direktor",
+  "pitanja",
+  "posao",
+  "potrebe",
+  "osam",
+  "rekla",
+  "20",
+  "Danas",
+  "30",
+  "sredstva",
+  "projekta",
+  "očekuje",
+  "problema",
+  "žene",
+  "malo",
+  "raka",
+  "ističe",
+  "trenutno",
+  "izvršenja",
+  "Mi",
+  "imali",
+  "centru",
+  "rata",
+  "1",
+  "Naime",
+  "svojih",
+  "skladu",
+  "osnovu",
+  "mogla",
+  "policije",
+  "Osim",
+  "podršku",
+  "informacije",
+  "ime",
+  "sezone",
+  "bh.",
+  "kantona",
+  "deset",
+  "dr",
+  "ja",
+  "moguće",
+  "godini",
+  "tada",
+  "utakmice",
+  "moći",
+  "potpuno",
+  "ovim",
+  "predstavlja",
+  "15",
+  "1.",
+  "iako",
+  "sutra",
+  "odmah",
+  "zaštite",
+  "ispred",
+  "ukoliko",
+  "minuta",
+  "ćete",
+  "bh",
+  "dovoljno",
+  "mediji",
+  "dobiti",
+  "neko",
+  "Bosni",
+  "Predsjednik",
+  "možemo",
+  "žele",
+  "zahtjev",
+  "FOTO",
+  "tijela",
+  "dobio",
+  "gotovo",
+  "ugovor",
+  "roku",
+  "okviru",
+  "2013",
+  "grupe",
+  "osim",
+  "upravo",
+  "imamo",
+  "možda",
+  "često",
+  "mogućnost",
+  "novih",
+  "država",
+  "najbolje",
+  "policija",
+  "RS-a",
+  "cijena",
+  "novog",
+  "Cazin",
+  "biće",
+  "Ovaj",
+  "stanje",
+  "zajednice",
+  "Autor",
+  "Ukoliko",
+  "gradu",
+  "pitanju",
+  "njegova",
+  "ministara",
+  "odnosu",
+  "Također",
+  "I.2",
+  "sedmice",
+  "kažu",
+  "rade",
+  "kluba",
+  "suda",
+  "zato",
+  "periodu",
+  "pored",
+  "nikada",
+  "cijene",
+  "odluku",
+  "grad",
+  "cilj",
+  "građani",
+  "Svi",
+  "Po",
+  "najmanje",
+  "O",
+  "Ipak",
+  "bolesti",
+  "izvođenja",
+  "čiji",
+  "Banja",
+  "vrijednosti",
+  "razvoj",
+  "prvom",
+  "Ona",
+  "Novi",
+  "SAD",
+  "velike",
+  "radnika",
+  "obzirom",
+  "odluke",
+  "proizvoda",
+  "veći",
+  "Oni",
+  "njima",
+  "sigurno",
+  "doći",
+  "iznosi",
+  "djela",
+  "područja",
+  "Naziv",
+  "kategorije",
+  "jedno",
+  "drugim",
+  "prvog",
+  "jako",
+  "svojoj",
+  "broja",
+  "vlada",
+  "razloga",
+  "radova",
+  "Tako",
+  "jedne",
+  "Hercegovini",
+  "3.",
+  "javnog",
+  "Kao",
+  "došlo",
+  "izbora",
+  "Nabavka",
+  "stranke",
+  "vezi",
+  "oblasti",
+  "najbolji",
+  "2014",
+  "hiljada",
+  "Ova",
+  "koristi",
+  "Facebook",
+  "početka",
+  "kasnije",
+  "Rok",
+  "radu",
+  "izgradnja",
+  "dokaz",
+  "onih",
+  "tvrde",
+  "rok",
+  "snage",
+  "Datum",
+  "novac",
+  "Kantona",
+  "čini",
+  "Luka",
+  "reprezentacije",
+  "odsto",
+  "odbora",
+  "Tuzla",
+  "naglasio",
+  "njegovim",
+  "priliku",
+  "banke",
+  "12",
+  "Uz",
+  "agencije",
+  "grupa",
+  "lige",
+  "metara",
+  "toliko",
+  "niko",
+  "mjere",
+  "zahtjeva",
+  "automobila",
+  "toku",
+  "kompanije",
+  "sistem",
+  "Općine",
+  "Hrvatska",
+  "centra",
+  "sva",
+  "istraživanja",
+  "iza",
+  "drugom",
+  "rezultat",
+  "njegove",
+  "ovdje",
+  "ekipa",
+  "agencija",
+  "lice",
+  "zaštitu",
+  "bih",
+  "prvo",
+  "sebi",
+  "vodi",
+  "korisnika",
+  "vlade",
+  "prva",
+  "ta",
+  "24sata.info",
+  "genocida",
+  "tijelo",
+  "zna",
+  "bile",
+  "mladih",
+  "sigurnosti",
+  "ekipe",
+  "premijer",
+  "Dodik",
+  "institucija",
+  "zaista",
+  "dijelu",
+  "ljudima",
+  "Mostar",
+  "sata",
+  "imala",
+  "ljude",
+  "Predsjedništva",
+  "igrača",
+  "jeste",
+  "članova",
+  "AA",
+  "postoje",
+  "Evrope",
+  "isti",
+  "baš",
+  "novca",
+  "novu",
+  "snaga",
+  "Nije",
+  "dati",
+  "reći",
+  "ću",
+  "usluge",
+  "govori",
+  "naš",
+  "odluka",
+  "2009",
+  "nemaju",
+  "SDA",
+  "2013.",
+  "najveći",
+  "biste",
+  "maraka",
+  "preduzeća",
+  "No",
+  "širom",
+  "Jedan",
+  "mogućnosti",
+  "član",
+  "njihove",
+  "priča",
+  "zatim",
+  "Do",
+  "Tokom",
+  "prve",
+  "moglo",
+  "nova",
+  "nisam",
+  "raditi",
+  "saopćeno",
+  "kazala",
+  "100",
+  "tih",
+  "izgleda",
+  "program",
+  "Ministarstva",
+  "prvenstva",
+  "toj",
+  "organizacija",
+  "trenutku",
+  "mnogi",
+  "trebao",
+  "iznos",
+  "nedavno",
+  "2012.",
+  "smatraju",
+  "posljednjih",
+  "riječi",
+  "proces",
+  "dolazi",
+  "uskoro",
+  "Srbija",
+  "dokumentaciji",
+  "Srbiji",
+  "vidjeti",
+  "drugog",
+  "jasno",
+  "nivou",
+  "predstavnici",
+  "povratak",
+  "rješenje",
+  "javlja",
+  "me",
+  "Banja Luka",
+  "takođe",
+  "prodaje",
+  "programa",
+  "ka",
+  "ukupno",
+  "film",
+  "no",
+  "članovi",
+  "čovjek",
+  "mjesec",
+  "rješenja",
+  "sud",
+  "Evropske",
+  "hrane",
+  "vrijednost",
+  "Sa",
+  "društva",
+  "reprezentacija",
+  "kuća",
+  "javne",
+  "kilometara",
+  "ulogu",
+  "50",
+  "kompanija",
+  "ispod",
+  "škole",
+  "Bosna",
+  "dijete",
+  "dostaviti",
+  "terenu",
+  "prostora",
+  "velika",
+  "glavni",
+  "Prvi",
+  "navode",
+  "jučer",
+  "potvrdio",
+  "kojom",
+  "Vijeća",
+  "živi",
+  "Počela",
+  "filma",
+  "zašto",
+  "poziv",
+  "sinoć",
+  "večeras",
+  "putu",
+  "stanju",
+  "4.",
+  "Prije",
+  "Naš",
+  "2",
+  "izbor",
+  "svakog",
+  "uglavnom",
+  "promjene",
+  "Ja",
+  "dobili",
+  "igra",
+  "Zakona",
+  "isto",
+  "petak",
+  "devet",
+  "juna",
+  "tenderskoj",
+  "klub",
+  "organizacije",
+  "Premijer",
+  "Ministarstvo",
+  "sami",
+  "centar",
+  "druga",
+  "sjednici",
+  "djelo",
+  "zakon",
+  "njihov",
+  "obzira",
+  "prijedlog",
+  "igrati",
+  "tima",
+  "objavio",
+  "jula",
+  "objekata",
+  "naveo",
+  "slučaj",
+  "prvaka",
+  "roditeljske",
+  "skoro",
+  "jutros",
+  "javnosti",
+  "veliku",
+  "daje",
+  "neka",
+  "oboljelu",
+  "smrti",
+  "potom",
+  "situacija",
+  "njen",
+  "dijela",
+  "maja",
+  "milijardi",
+  "utakmica",
+  "došao",
+  "II.4.b",
+  "dosta",
+  "zemlja",
+  "drugo",
+  "Turske",
+  "brzo",
+  "rezultate",
+  "međutim",
+  "člana",
+  "podataka",
+  "svijet",
+  "materijala",
+  "Hrvatskoj",
+  "održana",
+  "ide",
+  "odnose",
+  "sadrži",
+  "godinama",
+  "energije",
+  "3",
+  "ostali",
+  "dobar",
+  "navodno",
+  "kući",
+  "čemu",
+  "većina",
+  "žrtava",
+  "djelatnosti",
+  "sistema",
+  "zgrade",
+  "Udruženja",
+  "traži",
+  "tržištu",
+  "poplava",
+  "iznosu",
+  "nismo",
+  "porodice",
+  "akcije",
+  "bivši",
+  "uprave",
+  "postupak",
+  "životu",
+  "postupku",
+  "povodom",
+  "počinje",
+  "bismo",
+  "vjerovatno",
+  "5.",
+  "djeca",
+  "probleme",
+  "početkom",
+  "koriste",
+  "cijenu",
+  "zatvora",
+  "MUP-a",
+  "najavio",
+  "pažnju",
+  "žive",
+  "pola",
+  "kraj",
+  "podacima",
+  "uključujući",
+  "Brčko",
+  "noći",
+  "voda",
+  "New",
+  "informacija",
+  "poziva",
+  "period",
+  "istraživanje",
+  "napada",
+  "trebaju",
+  "naših",
+  "Grad",
+  "mene",
+  "d.o.o.",
+  "niz",
+  "svake",
+  "Anadolu",
+  "11",
+  "budžeta",
+  "pobjedu",
+  "11.",
+  "dobila",
+  "kandidata",
+  "predstavnika",
+  "tamo",
+  "Zato",
+  "Zenica",
+  "ostati",
+  "vrata",
+  "projekata",
+  "2011.",
+  "Objavljeno",
+  "nalaze",
+  "premijera",
+  "građanima",
+  "pravi",
+  "ostalih",
+  "pobjede",
+  "kulture",
+  "pokazuje",
+  "stoji",
+  "prijave",
+  "Agency",
+  "Mostaru",
+  "količina",
+  "početak",
+  "zdravlje",
+  "opreme",
+  "prenose",
+  "ponedjeljak",
+  "god",
+  "knjige",
+  "kome",
+  "Kad",
+  "čija",
+  "komisije",
+  "18",
+  "ostale",
+  "2011",
+  "zapravo",
+  "održavanje",
+  "političke",
+  "Broj",
+  "jednostavno",
+  "organa",
+  "10.",
+  "Sva",
+  "naučnici",
+  "osvojio",
+  "pristup",
+  "poručio",
+  "umjesto",
+  "Još",
+  "trebala",
+  "učiniti",
+  "5",
+  "porodica",
+  "vijeća",
+  "6.",
+  "Srebrenicu",
+  "nekih",
+  "njemu",
+  "našeg",
+  "ponuđača",
+  "našoj",
+  "čine",
+  "odbrane",
+  "kola",
+  "7.",
+  "pokazala",
+  "utakmicu",
+  "postao",
+  "imate",
+  "Mislim",
+  "primjer",
+  "izmjena",
+  "15.",
+  "poslove",
+  "vrste",
+  "nedjelju",
+  "institucije",
+  "mreže",
+  "40",
+  "općina",
+  "krajem",
+  "nivo",
+  "Univerziteta",
+  "izuzetno",
+  "počeo",
+  "direktora",
+  "dugo",
+  "javnost",
+  "marta",
+  "zajednica",
+  "fotografije",
+  "posla",
+  "subotu",
+  "8.",
+  "opet",
+  "troškove",
+  "njegovog",
+  "24",
+  "rast",
+  "prvenstvo",
+  "Pored",
+  "poena",
+  "posljednje",
+  "Duraković",
+  "svima",
+  "unije",
+  "službe",
+  "najboljih",
+  "nekim",
+  "počela",
+  "zločine",
+  "hvala",
+  "akcija",
+  "građane",
+  "mnoge",
+  "stranice",
+  "Beogradu",
+  "koristiti",
+  "2014.",
+  "turnira",
+  "25",
+  "imena",
+  "političkih",
+  "12.",
+  "Policija",
+  "Samo",
+  "bolji",
+  "nama",
+  "zemlju",
+  "novinarima",
+  "ponudu",
+  "prostor",
+};
+const uint16_t WA_FREQ_19_RANKS[] = {
+  792, 0, 492, 149, 730, 209, 924, 963, 473, 0, 0, 447, 0, 751, 0, 179,
+  379, 0, 94, 0, 86, 538, 0, 301, 743, 605, 0, 0, 0, 0, 506, 253,
+  647, 151, 534, 0, 229, 615, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  48, 481, 0, 501, 0, 873, 520, 957, 714, 967, 433, 536, 0, 775, 0, 0,
+  864, 74, 426, 482, 596, 181, 776, 787, 946, 0, 0, 28, 0, 135, 0, 0,
+  0, 0, 461, 0, 200, 49, 0, 968, 790, 879, 0, 930, 756, 215, 0, 0,
+  0, 0, 547, 0, 0, 0, 0, 0, 0, 0, 0, 286, 0, 715, 0, 0,
+  0, 0, 508, 0, 0, 0, 831, 0, 0, 0, 642, 318, 709, 0, 0, 320,
+  0, 0, 0, 0, 0, 470, 36, 95, 466, 682, 818, 0, 468, 0, 0, 618,
+  0, 524, 0, 0, 15, 0, 0, 0, 740, 0, 0, 684, 0, 0, 0, 732,
+  0, 254, 0, 11, 0, 0, 0, 771, 89, 0, 0, 970, 789, 294, 819, 0,
+  287, 848, 939, 0, 0, 0, 0, 184, 0, 431, 724, 93, 256, 0, 58, 0,
+  0, 360, 0, 0, 0, 0, 331, 421, 938, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 510, 754, 815, 852, 700, 0, 0, 519, 0, 70, 0, 404, 0, 0,
+  53, 750, 144, 136, 230, 278, 0, 0, 337, 892, 475, 0, 604, 859, 411, 0,
+  0, 0, 0, 84, 375, 696, 0, 0, 0, 220, 0, 0, 451, 0, 0, 0,
+  0, 29, 0, 19, 26, 893, 791, 0, 701, 909, 961, 0, 0, 0, 0, 0,
+  444, 0, 417, 486, 0, 0, 263, 685, 0, 123, 0, 0, 0, 293, 0, 0,
+  0, 692, 143, 0, 0, 446, 0, 948, 0, 0, 0, 0, 0, 472, 0, 0,
+  509, 654, 640, 8, 494, 133, 62, 664, 940, 992, 0, 0, 0, 0, 0, 572,
+  0, 307, 409, 837, 0, 908, 132, 0, 976, 0, 0, 0, 0, 0, 0, 50,
+  0, 35, 483, 894, 0, 0, 488, 842, 162, 223, 244, 0, 0, 0, 292, 608,
+  448, 476, 752, 0, 0, 0, 0, 875, 0, 0, 0, 0, 217, 0, 0, 23,
+  155, 511, 0, 0, 441, 0, 983, 459, 0, 0, 201, 0, 613, 0, 996, 414,
+  0, 0, 0, 140, 629, 0, 174, 0, 191, 345, 361, 0, 0, 0, 0, 601,
+  40, 187, 90, 432, 0, 702, 402, 463, 560, 711, 719, 804, 13, 826, 998, 0,
+  0, 0, 0, 678, 328, 0, 632, 739, 321, 469, 986, 269, 266, 971, 177, 240,
+  56, 376, 0, 12, 212, 315, 382, 107, 713, 862, 941, 158, 6, 0, 255, 916,
+  0, 271, 147, 767, 0, 972, 0, 0, 991, 0, 0, 0, 0, 0, 0, 0,
+  612, 576, 681, 820, 1000, 568, 0, 0, 0, 0, 0, 0, 0, 0, 0, 758,
+  0, 0, 0, 0, 0, 0, 0, 0, 616, 0, 0, 0, 112, 912, 0, 0,
+  0, 0, 206, 0, 0, 0, 77, 591, 953, 98, 82, 102, 193, 877, 0, 0,
+  227, 0, 0, 384, 157, 124, 208, 515, 0, 965, 0, 0, 0, 0, 185, 0,
+  0, 832, 0, 243, 464, 226, 766, 0, 166, 392, 91, 389, 478, 479, 542, 899,
+  994, 113, 0, 0, 324, 0, 75, 0, 0, 0, 61, 78, 109, 99, 500, 530,
+  531, 0, 620, 0, 270, 623, 0, 0, 0, 0, 545, 169, 786, 52, 395, 0,
+  115, 987, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 192, 0, 0, 33,
+  868, 652, 0, 990, 264, 381, 0, 935, 728, 0, 0, 0, 0, 0, 0, 808,
+  0, 0, 0, 646, 0, 0, 280, 783, 0, 569, 977, 0, 416, 0, 250, 0,
+  0, 0, 64, 0, 906, 0, 0, 0, 0, 0, 625, 0, 0, 0, 540, 0,
+  721, 0, 420, 699, 0, 0, 108, 898, 0, 0, 594, 915, 0, 0, 891, 0,
+  617, 415, 973, 25, 0, 0, 437, 0, 491, 0, 305, 0, 0, 856, 858, 0,
+  0, 423, 272, 566, 5, 0, 533, 0, 0, 0, 0, 0, 259, 0, 0, 0,
+  904, 150, 0, 159, 0, 850, 668, 849, 0, 0, 457, 0, 0, 312, 0, 0,
+  0, 0, 526, 539, 760, 0, 609, 0, 0, 0, 9, 778, 0, 671, 698, 0,
+  773, 656, 895, 42, 274, 813, 861, 347, 936, 228, 958, 0, 586, 0, 579, 260,
+  0, 0, 0, 914, 660, 0, 204, 268, 925, 0, 0, 643, 54, 0, 0, 0,
+  759, 0, 0, 0, 319, 0, 0, 0, 0, 0, 297, 47, 0, 833, 0, 630,
+  854, 628, 0, 247, 733, 0, 485, 317, 0, 744, 0, 669, 811, 262, 0, 0,
+  371, 0, 0, 0, 172, 0, 764, 0, 385, 304, 821, 0, 0, 0, 0, 0,
+  445, 16, 0, 0, 467, 480, 0, 0, 666, 890, 0, 0, 710, 0, 0, 0,
+  178, 592, 0, 0, 0, 211, 982, 527, 0, 989, 0, 358, 0, 330, 0, 0,
+  0, 407, 641, 85, 0, 0, 0, 0, 302, 0, 995, 945, 356, 0, 73, 0,
+  458, 753, 221, 310, 763, 0, 0, 0, 0, 649, 51, 0, 518, 827, 0, 0,
+  512, 0, 521, 0, 552, 0, 1, 362, 749, 0, 841, 0, 0, 0, 2, 0,
+  0, 0, 0, 0, 234, 195, 462, 0, 342, 729, 0, 0, 114, 691, 960, 0,
+  39, 344, 0, 0, 0, 148, 648, 0, 171, 0, 0, 0, 285, 0, 0, 588,
+  283, 0, 0, 0, 0, 273, 0, 0, 578, 0, 662, 795, 0, 556, 0, 0,
+  0, 0, 0, 603, 0, 207, 0, 635, 0, 363, 634, 477, 679, 690, 884, 0,
+  289, 680, 0, 0, 0, 0, 822, 365, 0, 0, 0, 0, 242, 291, 0, 0,
+  913, 658, 782, 639, 0, 0, 637, 499, 0, 505, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 651, 0, 0, 548, 644, 0, 806, 708, 549, 814, 984, 745, 0,
+  0, 0, 583, 403, 438, 835, 885, 735, 37, 372, 0, 0, 0, 17, 106, 802,
+  844, 0, 0, 0, 205, 917, 0, 923, 0, 0, 0, 0, 0, 0, 167, 0,
+  0, 0, 551, 557, 0, 0, 0, 0, 0, 138, 0, 0, 0, 582, 145, 199,
+  0, 0, 638, 165, 288, 537, 0, 186, 0, 0, 31, 0, 0, 357, 401, 0,
+  0, 0, 574, 0, 0, 0, 399, 46, 942, 71, 683, 103, 32, 611, 866, 0,
+  0, 676, 0, 0, 198, 0, 18, 0, 0, 0, 0, 68, 0, 0, 0, 0,
+  974, 0, 0, 0, 0, 0, 183, 246, 0, 0, 0, 0, 838, 398, 0, 0,
+  517, 0, 0, 154, 471, 738, 0, 258, 219, 0, 137, 303, 440, 689, 0, 0,
+  0, 834, 0, 0, 442, 543, 0, 152, 0, 0, 0, 900, 529, 0, 0, 189,
+  0, 0, 847, 369, 962, 0, 0, 66, 296, 0, 836, 0, 146, 435, 667, 394,
+  0, 335, 672, 0, 0, 927, 0, 975, 0, 175, 670, 781, 0, 380, 0, 0,
+  0, 0, 428, 0, 0, 352, 0, 559, 901, 855, 0, 354, 705, 0, 0, 0,
+  0, 134, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 367, 880, 999, 484,
+  325, 599, 0, 800, 0, 0, 0, 267, 0, 0, 0, 0, 0, 0, 931, 128,
+  0, 0, 0, 0, 309, 0, 0, 0, 0, 0, 0, 0, 0, 0, 799, 0,
+  0, 329, 535, 427, 0, 0, 532, 386, 633, 653, 141, 0, 0, 0, 0, 0,
+  350, 0, 0, 846, 0, 883, 950, 0, 0, 0, 0, 0, 0, 0, 703, 10,
+  0, 27, 0, 0, 0, 0, 196, 0, 921, 0, 570, 544, 0, 45, 0, 118,
+  514, 589, 777, 947, 0, 236, 762, 725, 949, 0, 0, 0, 0, 0, 97, 600,
+  0, 619, 0, 624, 0, 0, 0, 584, 528, 734, 131, 0, 218, 465, 650, 768,
+  393, 0, 439, 222, 430, 120, 0, 81, 0, 0, 673, 0, 0, 495, 0, 0,
+  0, 0, 0, 0, 0, 225, 966, 871, 0, 541, 0, 429, 645, 0, 0, 110,
+  555, 0, 0, 0, 55, 0, 0, 525, 907, 932, 0, 0, 516, 0, 0, 0,
+  14, 224, 300, 383, 388, 405, 747, 793, 0, 0, 251, 558, 0, 0, 0, 731,
+  0, 0, 0, 0, 955, 0, 0, 0, 0, 0, 101, 216, 0, 231, 0, 0,
+  694, 0, 0, 0, 0, 96, 774, 341, 780, 626, 878, 761, 918, 0, 550, 746,
+  0, 0, 116, 0, 0, 0, 0, 911, 0, 0, 704, 0, 0, 0, 396, 373,
+  693, 0, 0, 0, 0, 197, 0, 0, 0, 173, 928, 130, 0, 0, 0, 0,
+  993, 0, 0, 0, 0, 0, 0, 0, 657, 772, 0, 0, 0, 0, 0, 563,
+  3, 580, 100, 665, 281, 567, 830, 105, 153, 161, 0, 0, 872, 0, 0, 0,
+  0, 0, 0, 0, 0, 597, 0, 0, 0, 34, 0, 688, 779, 0, 0, 79,
+  418, 0, 0, 368, 621, 0, 0, 522, 0, 391, 0, 0, 474, 489, 0, 0,
+  0, 163, 455, 164, 573, 920, 951, 295, 377, 823, 0, 248, 863, 0, 0, 0,
+  119, 0, 0, 0, 0, 497, 0, 0, 0, 0, 0, 0, 553, 265, 607, 0,
+  0, 249, 0, 76, 554, 333, 0, 443, 0, 0, 922, 0, 0, 0, 449, 0,
+  0, 816, 0, 0, 0, 338, 755, 809, 937, 964, 0, 0, 0, 0, 0, 0,
+  0, 0, 425, 322, 614, 825, 88, 139, 919, 0, 0, 0, 896, 0, 0, 926,
+  0, 0, 0, 194, 0, 0, 0, 803, 370, 741, 784, 897, 0, 870, 0, 0,
+  0, 0, 824, 366, 0, 0, 0, 956, 233, 353, 577, 523, 687, 313, 314, 351,
+  828, 0, 0, 0, 0, 0, 0, 22, 0, 503, 0, 0, 0, 0, 7, 43,
+  0, 0, 0, 0, 0, 0, 0, 0, 38, 245, 876, 0, 606, 886, 0, 0,
+  902, 203, 412, 0, 0, 882, 0, 306, 311, 0, 0, 0, 0, 83, 126, 655,
+  0, 241, 0, 0, 0, 590, 952, 502, 723, 0, 0, 0, 424, 839, 0, 0,
+  41, 0, 0, 406, 235, 631, 675, 716, 0, 0, 0, 0, 0, 801, 65, 21,
+  0, 327, 0, 0, 0, 718, 87, 0, 805, 0, 0, 0, 323, 339, 168, 419,
+  279, 434, 237, 677, 575, 712, 943, 981, 0, 60, 0, 346, 812, 979, 0, 0,
+  282, 903, 80, 546, 663, 0, 0, 487, 104, 0, 765, 24, 436, 0, 490, 0,
+  0, 170, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 410, 0, 0, 0,
+  0, 845, 785, 874, 934, 0, 840, 0, 0, 0, 0, 252, 770, 0, 238, 364,
+  127, 853, 0, 0, 0, 722, 0, 0, 593, 0, 0, 0, 202, 0, 400, 0,
+  720, 0, 284, 316, 340, 387, 737, 422, 794, 867, 0, 0, 0, 562, 0, 0,
+  598, 0, 0, 0, 0, 0, 561, 0, 57, 129, 460, 239, 0, 176, 156, 210,
+  602, 453, 748, 182, 817, 742, 374, 0, 111, 627, 408, 788, 622, 92, 0, 72,
+  829, 0, 0, 0, 0, 160, 0, 0, 0, 0, 969, 378, 0, 0, 959, 985,
+  0, 0, 232, 0, 348, 0, 0, 707, 493, 343, 308, 595, 674, 798, 881, 843,
+  0, 929, 0, 661, 67, 213, 334, 275, 277, 978, 0, 0, 0, 69, 636, 0,
+  869, 0, 0, 0, 355, 0, 0, 0, 0, 0, 0, 142, 565, 0, 0, 214,
+  0, 188, 0, 0, 0, 0, 564, 0, 0, 0, 0, 0, 4, 30, 190, 290,
+  0, 299, 0, 0, 659, 0, 507, 0, 0, 0, 125, 0, 498, 0, 0, 0,
+  390, 697, 910, 988, 0, 0, 413, 59, 888, 0, 0, 0, 0, 63, 581, 397,
+  736, 905, 851, 887, 0, 0, 0, 0, 332, 757, 933, 0, 0, 276, 0, 0,
+  0, 717, 0, 0, 0, 0, 944, 585, 695, 0, 571, 0, 122, 456, 0, 261,
+  796, 180, 504, 954, 0, 587, 0, 0, 359, 0, 0, 0, 0, 513, 121, 257,
+  117, 20, 336, 889, 807, 298, 980, 0, 0, 860, 769, 0, 0, 0, 610, 0,
+  0, 727, 797, 0, 0, 0, 452, 0, 349, 726, 0, 326, 0, 0, 44, 0,
+  0, 496, 0, 0, 0, 0, 0, 0, 454, 706, 857, 810, 997, 865, 450, 686,
+};
+
+const char *WA_FREQ_20_TOKENS[] = {
+  "ri",
+  "iyanaritu",
+  "séuwa",
+  "Perancis",
+  "komun",
+  "déparetema",
+  "Allier",
+  "ténga",
+  "dalam",
+  "hari",
+  "tahun",
+  "sekitar",
+  "dan",
+  "adalah",
+  "mappunnai",
+  "sibawa",
+  "Agustus",
+  "Gregorian",
+  "di",
+  "kabisat",
+  "kalender",
+  "iana",
+  "seddi",
+  "jiwa",
+  "pendudukna",
+  "Jenie",
+  "Kota",
+  "éréngé",
+  "aloagen",
+  "dari",
+  "iye",
+  "béla",
+  "Indonesia",
+  "km²",
+  "pada",
+  "dengan",
+  "yang",
+  "bawah",
+  "polé",
+  "taun",
+  "wanua",
+  "éngka",
+  "Le",
+  "na",
+  "2001",
+  "2008",
+  "Asia",
+  "India",
+  "laleng",
+  "2010",
+  "Borromeus",
+  "Menurut",
+  "kadar",
+  "nomoro",
+  "La",
+  "Malaysia",
+  "band",
+  "basa",
+  "dua",
+  "sebagai",
+  "seorang",
+  "3",
+  "kajuru",
+  "naseng",
+  "proton",
+  "to",
+  "wanita",
+  "édé",
+  "6",
+  "Jepang",
+  "PL",
+  "Rezlan",
+  "Santo",
+  "esso",
+  "mancaji",
+  "maéga",
+  "rock",
+  "Ishar",
+  "anak",
+  "anu",
+  "ia",
+  "jumella",
+  "kappala",
+  "kota",
+  "kuta",
+  "lahir",
+  "taung",
+  "unsur",
+  "untuk",
+  "Atong",
+  "Said",
+  "Selatan",
+  "asengna",
+  "bancian",
+  "berusia",
+  "bilangan",
+  "bisa",
+  "duwa",
+  "dék",
+  "eppa",
+  "kebangsaan",
+  "kebisaan",
+  "kimia",
+  "lelaki",
+  "membaca",
+  "membaca.",
+  "merupakan",
+  "netron",
+  "olo",
+  "orang",
+  "partikel",
+  "pendidikan",
+  "pole",
+  "populasi",
+  "purata",
+  "sensus",
+  "seramai",
+  "wettu",
+  "éngkalinga",
+  "ᨑᨗ",
+  "1",
+  "2006",
+  "2007",
+  "21",
+  "4",
+  "7",
+  "Amerika",
+  "Banda",
+  "Bleu",
+  "Kappala",
+  "Kepangeranan",
+  "Pinisi",
+  "RS",
+  "Republik",
+  "Serikat",
+  "atong",
+  "dina",
+  "diplomat",
+  "fisika",
+  "ianaro",
+  "in",
+  "itu",
+  "iyyé",
+  "kepada",
+  "km",
+  "lima",
+  "lisěna",
+  "makkaseseng",
+  "materi",
+  "menjabat",
+  "minggu",
+  "mula",
+  "ni",
+  "paliŋ",
+  "pertama",
+  "riolli",
+  "saisa",
+  "sampai",
+  "sarta",
+  "sedi",
+  "sipak",
+  "telah",
+  "tempat",
+  "tidur",
+  "yero",
+  "ᨕᨗᨕᨊ",
+  "11",
+  "17",
+  "2",
+  "2000-na",
+  "30",
+  "31",
+  "58%",
+  "ASEAN",
+  "Adlinsjah",
+  "Alwi",
+  "Bandar",
+  "Bandung",
+  "Barat",
+  "Besar",
+  "Corbin",
+  "Dong",
+  "Duta",
+  "Elektron",
+  "Engka",
+  "Eropah",
+  "France",
+  "Gedung",
+  "Hoi",
+  "Ia",
+  "Ianae",
+  "Kamisi",
+  "Korea",
+  "Lovato",
+  "Luar",
+  "Rumah",
+  "Sakit",
+  "Sejak",
+  "Singapura",
+  "Tenggara",
+  "Udara",
+  "United",
+  "alang",
+  "aya",
+  "aŋgotana",
+  "bernama",
+  "biasa",
+  "dikaruniai",
+  "dunia",
+  "engka",
+  "fasilitas",
+  "from",
+  "ha",
+  "inti",
+  "iyanaréga",
+  "jurucakap",
+  "kabupateng",
+  "kemudian",
+  "kesehatan",
+  "kua",
+  "lanrek",
+  "layara",
+  "majjaji",
+  "maneng",
+  "manorang",
+  "mappattakaseng",
+  "mappunnangi",
+  "maprogram",
+  "mempunyai",
+  "menikah",
+  "meninggal",
+  "menjadi",
+  "menyediakan",
+  "merangkap",
+  "miboga",
+  "napa",
+  "ogé",
+  "pajjogé",
+  "pamula",
+  "pangissengeng",
+  "pasangan",
+  "pelakon",
+  "penyanyi",
+  "peragawati",
+  "pernah",
+  "popular",
+  "provinsi",
+  "pura",
+  "riobbi",
+  "riéja",
+  "sebuah",
+  "selalunya",
+  "si",
+  "sia",
+  "séddi",
+  "tanappa",
+  "tasi’é",
+  "tau",
+  "tellu",
+  "tersebut",
+  "warsih",
+  "yakni",
+  "yanaritu",
+  "Édé",
+  "énreŋé",
+  "ë",
+  "ëdé",
+  "12",
+  "12%",
+  "16%",
+  "1989",
+  "1998",
+  "20",
+  "20 Agustus",
+  "2012",
+  "27",
+  "28",
+  "2AM",
+  "40%",
+  "42%",
+  "60%",
+  "8850,3",
+  "A.Thirumuruganpoondi",
+  "A.Vellalapatti",
+  "Aadityana",
+  "Aga",
+  "Alamasia",
+  "Aléna",
+  "American",
+  "Amérika",
+  "Andorra",
+  "Ara",
+  "Araba",
+  "Berkuasa",
+  "Biasa",
+  "Borneo",
+  "Brunei",
+  "C",
+  "Ca",
+  "Carolus",
+  "Chailan",
+  "Chi",
+  "China",
+  "Demi",
+  "Des",
+  "Fisika",
+  "Hari",
+  "Ho",
+  "Iana",
+  "Internasional",
+  "Ireland",
+  "Isbandiyah",
+  "Italia",
+  "Iyana",
+  "Jawa",
+  "Juli",
+  "Kala",
+  "Kepulauan",
+  "Kingdom",
+  "Kiwari",
+  "Lantai",
+  "Libukeŋ",
+  "Long",
+  "Makassar",
+  "Maluku",
+  "Mau",
+  "Minangkabau",
+  "Minh",
+  "Monako",
+  "Moscow",
+  "Neira",
+  "New",
+  "November",
+  "Oblast",
+  "Pasukan",
+  "Penuh",
+  "Porovensi",
+  "Puranna",
+  "Queen",
+  "Rabaa",
+  "Ri",
+  "Rimaniaŋ",
+  "SGM",
+  "STR",
+  "Sadarijah",
+  "Sipak",
+  "Sjamsoe",
+  "Sulawesi",
+  "Sumatra",
+  "Tasik",
+  "Tawau",
+  "Teknologi",
+  "Thailand",
+  "Thanh",
+  "Timur",
+  "Ugi",
+  "United Kingdom",
+  "Upacara",
+  "Utara",
+  "Vietnam",
+  "Wikipedia",
+  "York",
+  "a",
+  "ajé",
+  "alliri",
+  "angka",
+  "anime",
+  "asal",
+  "atau",
+  "atawa",
+  "awa",
+  "baru",
+  "bawa",
+  "beberapa",
+  "biasana",
+  "boy",
+  "bulan",
+  "code-code",
+  "data",
+  "departemen",
+  "dilengkapi",
+  "dokumen",
+  "dunya",
+  "ede",
+  "elektron",
+  "elektronik",
+  "ensiklopedia",
+  "gare",
+  "garejana",
+  "gedung",
+  "genre",
+  "glipe",
+  "grup",
+  "hal",
+  "hardcore",
+  "hukum",
+  "iakia",
+  "iatu",
+  "ieu",
+  "iga-iga",
+  "information",
+  "ini",
+  "isotop",
+  "iyana",
+  "jokka’na",
+  "juga",
+  "juta",
+  "kareba",
+  "karena",
+  "kawasan",
+  "ke-214",
+  "ke-215",
+  "ke-216",
+  "ke-217",
+  "ke-218",
+  "ke-219",
+  "ke-220",
+  "ke-221",
+  "ke-222",
+  "ke-223",
+  "ke-224",
+  "ke-225",
+  "ke-226",
+  "ke-227",
+  "ke-228",
+  "ke-229",
+  "ke-230",
+  "ke-231",
+  "ke-232",
+  "ke-233",
+  "ke-234",
+  "ke-238",
+  "ke-239",
+  "ke-240",
+  "ke-241",
+  "ke-242",
+  "ke-243",
+  "ku",
+  "lebbi",
+  "linoë",
+  "mabbeda",
+  "maloppo",
+  "mancadi",
+  "mannguru",
+  "maprogram-e",
+  "maranéhanana",
+  "masih",
+  "matu",
+  "medis",
+  "melebihi",
+  "memulai",
+  "mesina",
+  "molekul",
+  "mulai",
+  "munri",
+  "munrinna",
+  "nainappa",
+  "nyaéta",
+  "objek",
+  "of",
+  "oleh",
+  "operasi",
+  "passabi",
+  "pelayanan",
+  "pembangunan",
+  "penumpang",
+  "peralatan",
+  "perang",
+  "perbandaran",
+  "perkataan",
+  "pesawat",
+  "pikeun",
+  "pinra",
+  "plas",
+  "positif",
+  "program",
+  "puna",
+  "punyana",
+  "putra",
+  "rawat",
+  "riolona",
+  "ripaké",
+  "rumah",
+  "sabua",
+  "sak",
+  "salah",
+  "sallatang",
+  "sehingga",
+  "selesai",
+  "sembajang",
+  "seni",
+  "seuwa",
+  "sibawaŋ",
+  "stabil",
+  "subatomik",
+  "séuwana",
+  "taale",
+  "tanggal",
+  "tapi",
+  "terletak",
+  "tewas",
+  "ti",
+  "unik",
+  "waé",
+  "wiki",
+  "Éropa",
+  "énrengé",
+  "éro",
+  "ᨆᨊᨛ",
+  "ᨍᨛᨄᨙᨕ",
+  "ᨓᨊᨘᨕ",
+  "ᨔᨘᨒᨄ",
+  "ᨙᨔᨕᨘᨓ",
+  "0,19%",
+  "1 Agustus",
+  "1.204.069",
+  "1.851.215",
+  "10",
+  "10 Agustus",
+  "10.925",
+  "103.069",
+  "11 Agustus",
+  "12 Agustus",
+  "121",
+  "129,000",
+  "13",
+  "13 Agustus",
+  "14",
+  "14 Agustus",
+  "140",
+  "140.787",
+  "146,77",
+  "15",
+  "15 Agustus",
+  "1500’na",
+  "150px",
+  "154,55",
+  "16",
+  "16 Agustus",
+  "17 Agustus",
+  "17.237",
+  "174",
+  "18",
+  "18 Agustus",
+  "18.459",
+  "180,963",
+  "183,000",
+  "19",
+  "19 Agustus",
+  "1927",
+  "193.069",
+  "1939",
+  "1959",
+  "1960-an",
+  "1972",
+  "1974",
+  "1980-an",
+  "1981",
+  "199.359",
+  "1990",
+  "1990-an",
+  "1990-na",
+  "1992",
+  "1999",
+  "2 Agustus",
+  "2.493",
+  "2000",
+  "2000na",
+  "2002",
+  "2004",
+  "2005",
+  "2009",
+  "200px",
+  "204.069",
+  "206",
+  "209,178",
+  "2096",
+  "21 Agustus",
+  "22",
+  "22 Agustus",
+  "24",
+  "240.000",
+  "25",
+  "25 Agustus",
+  "250,3",
+  "250px",
+  "251",
+  "26",
+  "26 Agustus",
+  "27 Agustus",
+  "28 Agustus",
+  "29",
+  "29 Agustus",
+  "295",
+  "2PM",
+  "3 Agustus",
+  "30 Agustus",
+  "30 Seconds to Mars",
+  "31 Agustus",
+  "320",
+  "33",
+  "350.000",
+  "350.069",
+  "36",
+  "36%%",
+  "370",
+  "371,30",
+  "393.244",
+  "4 Agustus",
+  "40",
+  "407",
+  "419",
+  "43%",
+  "435",
+  "437",
+  "44",
+  "497,57",
+  "5",
+  "5 Agustus",
+  "500",
+  "5000",
+  "503,3",
+  "503.421",
+  "53%",
+  "559.126",
+  "59.5%",
+  "6 Agustus",
+  "62%",
+  "625.395",
+  "63",
+  "64%%",
+  "657,33",
+  "69%",
+  "7 Agustus",
+  "7.068",
+  "7.103.069",
+  "718",
+  "72",
+  "72,000",
+  "726.223",
+  "782",
+  "8",
+  "8 Agustus",
+  "816",
+  "82.",
+  "8204.069",
+  "850",
+  "9",
+  "9 Agustus",
+  "940",
+  "A",
+  "Abrest",
+  "Abubakar",
+  "Afrika",
+  "Agonges",
+  "Ain",
+  "Ainay-le-Château",
+  "Aisjah",
+  "Aisne",
+  "Akkalarudduseng",
+  "Akta",
+  "Al",
+  "Alkitab",
+  "Ancajina",
+  "Andelaroche",
+  "Anggi",
+  "Angkatan",
+  "Antarabangsa",
+  "Aplikasi",
+  "April",
+  "Archignat",
+  "Arfeuilles",
+  "Argentina",
+  "Arpheuilles-Saint-Priest",
+  "Arronnes",
+  "Asas",
+  "Asenenge",
+  "Asenéŋë",
+  "Asih",
+  "Aubigny",
+  "Audes",
+  "Aurouër",
+  "Australia",
+  "Autry-Issards",
+  "Avermes",
+  "Avrilly",
+  "BCMC",
+  "BPPT",
+  "Badan",
+  "Bagneux",
+  "Bahama",
+  "Band-band",
+  "Bandara",
+  "Bank",
+  "Barberier",
+  "Barrais-Bussolles",
+  "Bayet",
+  "Beaulon",
+  "Beaune-d'Allier",
+  "Bell",
+  "Bellenaves",
+  "Bellerive-sur-Allier",
+  "Berikut",
+  "Berkas:Indonesian",
+  "Berkas:Museum",
+  "Berkas:SOTO",
+  "Bert",
+  "Bessay-sur-Allier",
+  "Besson",
+  "Billezois",
+  "Billy",
+  "Binh",
+  "Biozat",
+  "Birmawan",
+  "Bizeneuille",
+  "Bleach",
+  "Blomard",
+  "Bola-e",
+  "Bolana",
+  "Bone",
+  "Bost",
+  "Bouchaud",
+  "Boucé",
+  "Bourbon-l'Archambault",
+  "Braize",
+  "Bransat",
+  "Brasil",
+  "Brasilë",
+  "Bresnay",
+  "Bressolles",
+  "Brethon",
+  "Breuil",
+  "Brian",
+  "Brisbane",
+  "Britain",
+  "Broût-Vernet",
+  "Brugheas",
+  "Buddhis",
+  "Budi",
+  "Busset",
+  "Buxières-les-Mines",
+  "Bègues",
+  "Bézenet",
+  "Can't",
+  "Celle",
+  "Center",
+  "Cesset",
+  "Chabanne",
+  "Chamblet",
+  "Chambérat",
+  "Changmin.",
+  "Chantelle",
+  "Chapeau",
+  "Chapelaude",
+  "Chapelle",
+  "Chapelle-aux-Chasses",
+  "Chappes",
+  "Chareil-Cintrat",
+  "Charmeil",
+  "Charmes",
+  "Charroux",
+  "Chassenard",
+  "Chavenon",
+  "Chavroches",
+  "Chazemais",
+  "Chemilly",
+  "Chevagnes",
+  "Chezelle",
+  "Children",
+  "Chirat-l'Église",
+  "Chouvigny",
+  "Château-sur-Allier",
+  "Châtel-Montagne",
+  "Châtel-de-Neuvre",
+  "Châtelperron",
+  "Châtelus",
+  "Châtillon",
+  "Chézy",
+  "Cindré",
+  "Cinta",
+  "Cognat-Lyonne",
+  "Colombier",
+  "Command",
+  "Commentry",
+  "Contigny",
+  "Cosne-d'Allier",
+  "Coulandon",
+  "Coulanges",
+  "Couleuvre",
+  "Courçais",
+  "Coutansouze",
+  "Couzon",
+  "Cressanges",
+  "Creuzier-le-Neuf",
+  "Creuzier-le-Vieux",
+  "Créchy",
+  "Cusset",
+  "Cérilly",
+  "Dalam",
+  "Daung-daung",
+  "Day",
+  "Deacon",
+  "Demetria",
+  "Deneuille-les-Mines",
+  "Deneuille-lès-Chantelle",
+  "Dennis",
+  "Departemen",
+  "Deux-Chaises",
+  "Devonne",
+  "Dharma",
+  "Dia",
+  "Die",
+  "Diou",
+  "Djauharsjah",
+  "Dompierre-sur-Besbre",
+  "Domérat",
+  "Donjon",
+  "Doyet",
+  "Droiturier",
+  "Durdat-Larequille",
+  "Dé'na",
+  "Désertines",
+  "Ede",
+  "Egypt",
+  "Embrace",
+  "Emo",
+  "Engkana",
+  "England",
+  "Enon",
+  "Entertainment",
+  "Esbok",
+  "Escurolles",
+  "Eso",
+  "Espinasse-Vozelle",
+  "Estivareilles",
+  "Even",
+  "Eŋka",
+  "FOOD",
+  "Februari",
+  "Ferrières-sur-Sichon",
+  "Ferté-Hauterive",
+  "Fisikawan",
+  "Flag",
+  "Fleuriel",
+  "Fourilles",
+  "France.svg",
+  "Franchesse",
+  "Freddie",
+  "Führer",
+  "Gannat",
+  "Gannay-sur-Loire",
+  "Gareja",
+  "Garnat-sur-Engièvre",
+  "Generation",
+  "Gennetines",
+  "Gereja",
+  "Gipcy",
+  "Girl's",
+  "Gita",
+  "Givarlais",
+  "Go",
+  "Gouise",
+  "Gowa",
+  "Great",
+  "Guatemala",
+  "Guillermie",
+  "HTML",
+  "HTML-é",
+  "Hatta",
+  "Hauterive",
+  "Heiho",
+  "Hidrogen",
+  "Hirup",
+  "Hitler",
+  "Hongaria",
+  "Huriel",
+  "Hyds",
+  "Hérisson",
+  "I",
+  "II",
+  "Iakia",
+  "Iantai",
+  "If",
+  "Im",
+  "Indonésia",
+  "Indra",
+  "Inkigayo",
+  "Inris",
+  "Inrisi",
+  "Institut",
+  "Inti",
+  "Irawan",
+  "Irene",
+  "Islam",
+  "Isle-et-Bardais",
+  "Ismailia",
+  "Isserpent",
+  "Iyede",
+  "Iyye",
+  "Iyéwé",
+  "JENIE",
+  "JYP",
+  "Jaebeom",
+  "Jakarta",
+  "Jaligny-sur-Besbre",
+  "Jamaika",
+  "Januari",
+  "Japan",
+  "Java",
+  "Java-é",
+  "JavaScript",
+  "Jenzat",
+  "Jerman",
+  "Jinwoon",
+  "Jo",
+  "John",
+  "Julian",
+  "Jumplukan",
+  "KBS",
+  "Kabupateng",
+  "Kabébasan",
+  "Kacamata",
+  "Kanada",
+  "Kasih",
+  "Kemudian",
+  "Ken",
+  "Kepala",
+  "Kesatuan",
+  "Kidul",
+  "Kinabalu",
+  "Komputer",
+  "Komputer desktop",
+  "Komputer-é",
+  "Komunitas-komunitasnya",
+  "Kwon",
+  "Kyodan",
+  "Laboratories",
+  "Laféline",
+  "Lalizolle",
+  "Lamaids",
+  "Language",
+  "Langy",
+  "Lanka",
+  "Lapalisse",
+  "Lapangan",
+  "Laprugne",
+  "Laut",
+  "Lautan",
+  "Lavault-Sainte-Anne",
+  "Lavoine",
+  "Lenax",
+  "Let",
+  "Liernolles",
+  "Lignerolles",
+  "Lim",
+  "Limoise",
+  "Linux",
+  "Linuxë",
+  "Loddes",
+  "Lolobana",
+  "London",
+  "Loriges",
+  "Lotong",
+  "Louchy-Montfand",
+  "Louroux-Bourbonnais",
+  "Louroux-Hodement",
+  "Louroux-de-Beaune",
+  "Louroux-de-Bouble",
+  "Luneau",
+  "Lurcy-Lévis",
+  "Lusigny",
+  "Luttu",
+  "Luwu",
+  "Lételon",
+  "MIT",
+  "Magnet",
+  "Maillet",
+  "Makmur",
+  "Malicorne",
+  "Man",
+  "Maniang",
+  "Manusa",
+  "Mappasitinaja",
+  "Maranéhanana",
+  "Marcenat",
+  "Marcillat-en-Combraille",
+  "Maret",
+  "Maria",
+  "Marigny",
+  "Mariol",
+  "Maritim",
+  "Mars",
+  "Marusu",
+  "Massachusetts",
+  "Matematika",
+  "May",
+  "Mayet-d'École",
+  "Mayet-de-Montagne",
+  "Mazda6",
+  "Mazerier",
+};
+const uint16_t WA_FREQ_20_RANKS[] = {
+  0, 0, 7, 812, 940, 0, 0, 467, 0, 0, 0, 889, 973, 0, 374, 604,
+  0, 740, 369, 458, 818, 0, 0, 0, 0, 0, 405, 664, 0, 623, 0, 840,
+  876, 325, 530, 674, 279, 878, 256, 0, 700, 0, 0, 0, 855, 0, 0, 294,
+  687, 208, 0, 0, 657, 682, 375, 769, 0, 0, 0, 640, 859, 668, 0, 904,
+  833, 620, 655, 0, 0, 847, 0, 752, 318, 750, 871, 0, 0, 139, 482, 0,
+  852, 0, 819, 503, 509, 0, 206, 696, 0, 0, 214, 297, 672, 126, 785, 794,
+  624, 912, 993, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 323, 464, 20, 894, 929, 225, 708, 724, 996, 160, 230, 0, 0, 113,
+  299, 382, 723, 726, 641, 751, 928, 0, 0, 0, 410, 820, 721, 0, 0, 0,
+  832, 701, 0, 0, 0, 81, 6, 0, 0, 0, 0, 0, 0, 287, 0, 0,
+  0, 0, 0, 418, 112, 58, 0, 787, 0, 0, 712, 393, 0, 0, 288, 817,
+  332, 0, 0, 0, 0, 0, 667, 184, 0, 223, 650, 0, 0, 0, 574, 50,
+  204, 248, 0, 0, 977, 0, 0, 0, 0, 237, 359, 0, 0, 0, 0, 0,
+  0, 0, 895, 0, 774, 0, 0, 967, 508, 0, 0, 0, 0, 155, 0, 0,
+  497, 0, 275, 524, 573, 407, 857, 0, 0, 406, 0, 0, 0, 29, 577, 0,
+  0, 0, 0, 0, 0, 0, 158, 346, 656, 0, 0, 0, 0, 391, 0, 0,
+  0, 778, 685, 747, 0, 0, 262, 793, 0, 0, 0, 0, 540, 807, 0, 767,
+  0, 0, 0, 729, 247, 440, 475, 739, 490, 614, 810, 984, 0, 0, 0, 825,
+  0, 565, 822, 0, 0, 0, 0, 436, 74, 755, 457, 0, 376, 32, 471, 135,
+  0, 0, 0, 110, 0, 0, 0, 154, 0, 0, 522, 90, 183, 659, 0, 0,
+  383, 182, 585, 716, 168, 195, 863, 177, 148, 537, 118, 568, 0, 0, 0, 0,
+  234, 0, 0, 0, 260, 0, 0, 0, 0, 0, 329, 286, 97, 0, 0, 0,
+  0, 0, 0, 94, 795, 161, 952, 913, 0, 0, 0, 980, 733, 0, 0, 0,
+  753, 0, 0, 0, 0, 0, 0, 0, 710, 934, 146, 0, 0, 0, 563, 186,
+  255, 601, 0, 0, 669, 0, 0, 0, 384, 776, 0, 152, 491, 219, 201, 319,
+  91, 551, 869, 622, 0, 0, 643, 908, 0, 761, 0, 616, 0, 0, 0, 203,
+  479, 961, 232, 394, 545, 675, 380, 0, 0, 0, 0, 0, 0, 0, 100, 905,
+  0, 0, 0, 167, 363, 46, 455, 352, 518, 0, 0, 0, 2, 212, 673, 205,
+  0, 442, 0, 0, 0, 0, 0, 909, 0, 637, 0, 0, 123, 385, 988, 339,
+  0, 0, 0, 0, 935, 0, 0, 0, 64, 0, 0, 786, 0, 249, 0, 0,
+  381, 0, 0, 0, 0, 280, 0, 437, 0, 0, 0, 851, 628, 864, 0, 0,
+  0, 0, 0, 0, 0, 845, 0, 0, 0, 831, 0, 557, 127, 790, 0, 0,
+  0, 378, 638, 151, 313, 850, 887, 0, 781, 0, 801, 0, 0, 888, 923, 553,
+  770, 0, 0, 0, 519, 0, 0, 0, 939, 147, 602, 0, 0, 0, 0, 0,
+  0, 879, 0, 284, 843, 451, 0, 250, 809, 102, 756, 0, 0, 873, 903, 0,
+  692, 0, 0, 82, 0, 0, 55, 176, 964, 978, 416, 990, 0, 0, 481, 0,
+  197, 322, 0, 0, 684, 598, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 117, 173, 305, 334, 799, 989, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 529, 0, 131, 242, 344, 0, 357, 0, 868, 0, 0, 0, 0, 0, 57,
+  0, 709, 0, 600, 0, 0, 901, 0, 0, 0, 0, 0, 0, 911, 0, 686,
+  435, 846, 0, 0, 0, 0, 459, 282, 791, 0, 54, 725, 0, 321, 0, 0,
+  0, 0, 0, 0, 0, 937, 358, 0, 0, 0, 77, 0, 838, 0, 0, 392,
+  0, 900, 0, 763, 44, 586, 731, 0, 465, 0, 25, 0, 502, 0, 0, 792,
+  328, 0, 0, 0, 732, 0, 0, 0, 0, 0, 678, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 513, 971, 0, 291, 0, 521,
+  362, 0, 0, 377, 0, 0, 0, 0, 0, 159, 0, 96, 841, 983, 0, 401,
+  495, 216, 137, 244, 625, 694, 775, 749, 788, 875, 885, 76, 72, 916, 949, 981,
+  429, 0, 874, 0, 411, 238, 578, 596, 5, 434, 290, 782, 341, 715, 920, 0,
+  372, 450, 0, 0, 189, 469, 298, 0, 0, 0, 0, 942, 128, 354, 0, 0,
+  590, 0, 0, 886, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 975,
+  0, 19, 0, 969, 0, 0, 241, 494, 414, 520, 653, 858, 0, 995, 0, 0,
+  0, 0, 0, 0, 0, 0, 743, 0, 938, 583, 0, 171, 0, 0, 447, 409,
+  0, 0, 0, 0, 0, 0, 0, 536, 0, 0, 0, 979, 273, 948, 0, 917,
+  0, 0, 0, 619, 470, 221, 0, 0, 0, 211, 683, 125, 719, 424, 853, 33,
+  92, 789, 472, 0, 0, 0, 0, 0, 0, 229, 324, 439, 0, 707, 0, 0,
+  0, 0, 0, 0, 575, 0, 0, 120, 0, 370, 86, 4, 896, 0, 555, 427,
+  706, 955, 342, 0, 504, 0, 0, 0, 834, 0, 0, 196, 0, 17, 946, 136,
+  0, 163, 300, 356, 65, 823, 0, 326, 943, 0, 0, 0, 264, 505, 0, 0,
+  0, 0, 245, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 736, 0,
+  0, 0, 0, 0, 0, 0, 0, 68, 0, 0, 0, 0, 278, 0, 0, 998,
+  93, 84, 567, 910, 507, 954, 0, 0, 0, 0, 0, 259, 0, 0, 107, 661,
+  317, 982, 488, 71, 10, 138, 185, 188, 254, 268, 303, 697, 999, 0, 0, 777,
+  200, 0, 0, 156, 541, 745, 35, 228, 246, 446, 24, 512, 612, 62, 331, 633,
+  654, 67, 0, 867, 0, 693, 181, 108, 564, 220, 462, 918, 0, 0, 0, 0,
+  754, 0, 0, 309, 972, 0, 0, 0, 797, 0, 233, 355, 496, 0, 0, 98,
+  106, 175, 0, 680, 960, 194, 523, 140, 0, 21, 432, 968, 337, 466, 666, 0,
+  0, 3, 597, 468, 0, 0, 0, 0, 311, 348, 861, 0, 0, 1, 0, 0,
+  0, 546, 0, 265, 400, 0, 0, 263, 0, 0, 836, 0, 0, 0, 0, 741,
+  0, 0, 134, 39, 40, 0, 0, 0, 396, 580, 0, 174, 0, 533, 930, 0,
+  0, 0, 0, 0, 0, 699, 0, 0, 0, 0, 257, 532, 0, 0, 0, 0,
+  915, 0, 0, 0, 253, 561, 872, 0, 460, 907, 0, 0, 0, 0, 0, 0,
+  9, 891, 0, 0, 0, 0, 267, 0, 0, 0, 802, 0, 0, 0, 737, 0,
+  0, 0, 109, 559, 730, 0, 722, 566, 0, 0, 0, 0, 0, 828, 986, 0,
+  132, 718, 556, 592, 0, 0, 0, 0, 543, 805, 720, 663, 115, 0, 0, 0,
+  0, 0, 702, 0, 28, 539, 191, 387, 149, 594, 816, 921, 992, 0, 0, 0,
+  772, 150, 0, 608, 0, 0, 0, 53, 353, 69, 609, 727, 779, 0, 0, 0,
+  0, 0, 941, 0, 0, 0, 0, 0, 0, 192, 0, 0, 0, 0, 310, 343,
+  803, 926, 0, 449, 0, 0, 0, 235, 408, 883, 103, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 997, 525, 652, 0, 0, 630, 0, 0, 0, 0, 0,
+  734, 395, 0, 0, 0, 0, 0, 671, 965, 0, 0, 974, 0, 274, 759, 0,
+  37, 308, 610, 649, 307, 99, 703, 552, 0, 456, 714, 88, 0, 0, 0, 511,
+  0, 56, 85, 0, 662, 704, 757, 0, 0, 0, 13, 73, 87, 187, 476, 0,
+  0, 0, 958, 0, 105, 0, 0, 269, 611, 798, 0, 898, 0, 0, 404, 648,
+  677, 780, 0, 0, 0, 47, 581, 453, 587, 340, 582, 0, 0, 0, 0, 226,
+  41, 814, 0, 0, 371, 0, 0, 0, 0, 603, 0, 0, 365, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 438, 433, 932, 599, 312, 386, 0, 0, 169,
+  236, 0, 0, 646, 854, 0, 0, 0, 170, 0, 866, 0, 933, 129, 966, 0,
+  12, 835, 0, 899, 0, 0, 36, 0, 330, 0, 0, 412, 0, 261, 631, 947,
+  773, 0, 0, 953, 0, 0, 222, 0, 0, 0, 681, 0, 0, 0, 0, 121,
+  215, 258, 547, 11, 0, 0, 0, 0, 695, 0, 0, 281, 0, 0, 0, 860,
+  0, 0, 0, 0, 366, 0, 0, 881, 272, 422, 52, 856, 0, 0, 498, 0,
+  0, 0, 771, 642, 0, 0, 0, 209, 0, 0, 0, 0, 0, 660, 345, 0,
+  75, 0, 483, 593, 595, 0, 162, 0, 172, 218, 130, 691, 728, 95, 713, 417,
+  670, 0, 0, 31, 0, 0, 0, 562, 617, 0, 0, 61, 207, 606, 0, 441,
+  647, 60, 0, 78, 618, 143, 0, 0, 42, 0, 0, 0, 426, 492, 0, 0,
+  49, 0, 0, 806, 826, 0, 14, 0, 0, 705, 0, 59, 443, 0, 632, 0,
+  361, 327, 306, 420, 902, 104, 34, 193, 243, 487, 538, 796, 644, 0, 415, 403,
+  0, 70, 360, 83, 485, 0, 0, 0, 0, 0, 0, 808, 542, 0, 428, 314,
+  157, 202, 784, 837, 0, 0, 830, 0, 607, 270, 765, 970, 991, 0, 63, 454,
+  560, 605, 0, 501, 80, 473, 0, 0, 240, 283, 0, 0, 0, 0, 0, 0,
+  0, 116, 506, 0, 0, 0, 0, 0, 0, 0, 0, 239, 0, 0, 925, 0,
+  0, 550, 645, 0, 0, 0, 0, 0, 0, 423, 0, 0, 379, 936, 515, 516,
+  388, 579, 0, 842, 0, 0, 0, 0, 0, 880, 444, 500, 945, 0, 951, 0,
+  0, 0, 0, 528, 45, 963, 758, 213, 531, 690, 0, 0, 0, 956, 576, 0,
+  0, 477, 558, 0, 0, 0, 0, 0, 0, 302, 959, 738, 615, 0, 0, 0,
+  844, 0, 0, 165, 651, 665, 768, 0, 0, 145, 569, 892, 347, 0, 0, 0,
+  957, 0, 0, 0, 0, 0, 0, 862, 320, 425, 815, 431, 0, 350, 0, 639,
+  0, 0, 0, 0, 0, 0, 629, 0, 296, 0, 0, 0, 0, 0, 0, 0,
+  0, 251, 865, 0, 535, 762, 711, 950, 0, 448, 0, 66, 0, 210, 51, 0,
+  0, 445, 0, 0, 534, 0, 0, 0, 0, 0, 0, 0, 79, 0, 0, 0,
+  0, 364, 30, 166, 285, 897, 890, 877, 199, 613, 480, 0, 463, 486, 421, 882,
+  164, 517, 15, 591, 985, 292, 0, 0, 0, 839, 336, 870, 544, 0, 0, 635,
+  800, 0, 266, 461, 484, 0, 742, 119, 114, 493, 783, 919, 849, 413, 499, 0,
+  922, 0, 295, 0, 0, 0, 0, 621, 0, 153, 301, 338, 367, 351, 627, 744,
+  748, 0, 0, 0, 180, 190, 316, 390, 584, 698, 43, 18, 572, 0, 0, 0,
+  548, 276, 0, 0, 289, 0, 0, 478, 588, 489, 626, 688, 634, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 178, 0, 804, 0, 0, 0, 349,
+  821, 927, 0, 0, 271, 924, 0, 0, 0, 0, 0, 0, 0, 0, 144, 0,
+  0, 124, 0, 0, 717, 0, 679, 0, 89, 419, 398, 402, 430, 824, 293, 399,
+  231, 987, 389, 848, 0, 0, 0, 0, 0, 0, 101, 0, 0, 133, 0, 554,
+  527, 658, 676, 38, 746, 111, 0, 0, 0, 570, 884, 766, 994, 571, 962, 0,
+  0, 333, 906, 0, 0, 122, 0, 0, 0, 0, 224, 526, 549, 142, 0, 0,
+  0, 0, 764, 0, 0, 636, 227, 760, 0, 217, 141, 368, 1000, 474, 0, 0,
+  0, 0, 16, 0, 510, 0, 0, 0, 0, 48, 0, 0, 198, 0, 252, 397,
+  0, 735, 0, 0, 0, 0, 976, 0, 0, 827, 944, 829, 0, 689, 8, 589,
+  0, 0, 0, 0, 0, 0, 452, 0, 0, 893, 0, 0, 0, 23, 0, 0,
+  27, 277, 0, 0, 315, 0, 0, 931, 179, 335, 914, 0, 0, 0, 0, 0,
+  0, 0, 514, 0, 0, 813, 0, 0, 811, 0, 304, 373, 0, 0, 0, 0,
+};
+
+const char *WA_FREQ_21_TOKENS[] = {
+  "que",
+  "no",
+  "de",
+  "la",
+  "el",
+  "a",
+  "i",
+  "és",
+  "un",
+  "per",
+  "en",
+  "l",
+  "d",
+  "una",
+  "què",
+  "ho",
+  "ha",
+  "els",
+  "amb",
+  "va",
+  "això",
+  "si",
+  "com",
+  "les",
+  "em",
+  "m",
+  "hi",
+  "però",
+  "sí",
+  "bé",
+  "al",
+  "del",
+  "he",
+  "t",
+  "aquí",
+  "et",
+  "tu",
+  "més",
+  "es",
+  "jo",
+  "tot",
+  "vaig",
+  "està",
+  "ser",
+  "molt",
+  "meu",
+  "fer",
+  "has",
+  "ja",
+  "ara",
+  "aquest",
+  "aquesta",
+  "s",
+  "li",
+  "ens",
+  "quan",
+  "cap",
+  "res",
+  "n",
+  "meva",
+  "només",
+  "dir",
+  "on",
+  "sé",
+  "cosa",
+  "era",
+  "seu",
+  "qui",
+  "sóc",
+  "així",
+  "o",
+  "estic",
+  "ets",
+  "us",
+  "ell",
+  "teu",
+  "puc",
+  "mi",
+  "veure",
+  "perquè",
+  "seva",
+  "són",
+  "dels",
+  "vull",
+  "fet",
+  "acord",
+  "fa",
+  "hem",
+  "vas",
+  "han",
+  "mai",
+  "tinc",
+  "tots",
+  "té",
+  "gràcies",
+  "teva",
+  "estàs",
+  "estat",
+  "van",
+  "pot",
+  "senyor",
+  "saps",
+  "casa",
+  "home",
+  "tan",
+  "vols",
+  "alguna",
+  "tens",
+  "ella",
+  "temps",
+  "potser",
+  "se",
+  "pare",
+  "fins",
+  "encara",
+  "anar",
+  "dit",
+  "crec",
+  "pots",
+  "també",
+  "hola",
+  "dia",
+  "nit",
+  "dos",
+  "sobre",
+  "ni",
+  "vida",
+  "pel",
+  "déu",
+  "gent",
+  "sempre",
+  "després",
+  "vol",
+  "algú",
+  "als",
+  "sap",
+  "anys",
+  "havia",
+  "abans",
+  "passa",
+  "coses",
+  "nosaltres",
+  "mateix",
+  "mare",
+  "sense",
+  "sembla",
+  "millor",
+  "altre",
+  "estava",
+  "tant",
+  "parlar",
+  "llavors",
+  "tenim",
+  "allà",
+  "vostè",
+  "hauria",
+  "ningú",
+  "dona",
+  "sigui",
+  "estar",
+  "veritat",
+  "mica",
+  "bona",
+  "gran",
+  "haver",
+  "mort",
+  "lloc",
+  "mira",
+  "anem",
+  "sento",
+  "fora",
+  "doncs",
+  "me",
+  "plau",
+  "fill",
+  "podria",
+  "vinga",
+  "vist",
+  "oi",
+  "oh",
+  "vegada",
+  "moment",
+  "podem",
+  "seus",
+  "diu",
+  "estem",
+  "tenir",
+  "passat",
+  "altra",
+  "bon",
+  "estan",
+  "des",
+  "segur",
+  "prou",
+  "ells",
+  "te",
+  "clar",
+  "merda",
+  "tota",
+  "massa",
+  "homes",
+  "serà",
+  "nostre",
+  "ei",
+  "meus",
+  "manera",
+  "aquests",
+  "cop",
+  "tenia",
+  "deixa",
+  "passar",
+  "saber",
+  "fas",
+  "porta",
+  "món",
+  "volia",
+  "espera",
+  "tornar",
+  "tres",
+  "som",
+  "quin",
+  "primer",
+  "quina",
+  "aquestes",
+  "feina",
+  "nou",
+  "matar",
+  "trobar",
+  "nom",
+  "nostra",
+  "cada",
+  "sentit",
+  "nostres",
+  "agrada",
+  "rei",
+  "diners",
+  "part",
+  "raó",
+  "totes",
+  "escolta",
+  "deixar",
+  "germà",
+  "vam",
+  "amic",
+  "altres",
+  "qualsevol",
+  "mal",
+  "creus",
+  "uns",
+  "necessito",
+  "hora",
+  "fent",
+  "avui",
+  "família",
+  "dins",
+  "sol",
+  "policia",
+  "heu",
+  "ben",
+  "amor",
+  "seves",
+  "poder",
+  "noi",
+  "morir",
+  "durant",
+  "noia",
+  "greu",
+  "debò",
+  "tothom",
+  "terra",
+  "punt",
+  "idea",
+  "donar",
+  "teus",
+  "cotxe",
+  "problema",
+  "deu",
+  "sortir",
+  "aquell",
+  "entre",
+  "venir",
+  "algun",
+  "guerra",
+  "trobat",
+  "dic",
+  "ciutat",
+  "bo",
+  "tenen",
+  "collons",
+  "sang",
+  "pensar",
+  "vosaltres",
+  "dues",
+  "dius",
+  "faré",
+  "amics",
+  "seria",
+  "dies",
+  "contra",
+  "nois",
+  "sabia",
+  "demà",
+  "vegades",
+  "acabat",
+  "pas",
+  "pensava",
+  "ajuda",
+  "menjar",
+  "cal",
+  "eh",
+  "cas",
+  "por",
+  "nova",
+  "veig",
+  "quant",
+  "arribar",
+  "aviat",
+  "tard",
+  "filla",
+  "vingut",
+  "anat",
+  "senyora",
+  "entenc",
+  "mentre",
+  "importa",
+  "hauries",
+  "sentir",
+  "agradaria",
+  "sols",
+  "començar",
+  "vine",
+  "ah",
+  "faig",
+  "capità",
+  "mà",
+  "realment",
+  "favor",
+  "suposo",
+  "cara",
+  "sort",
+  "queda",
+  "ulls",
+  "puta",
+  "compte",
+  "veus",
+  "poden",
+  "aigua",
+  "sota",
+  "penso",
+  "tingut",
+  "persona",
+  "camí",
+  "moltes",
+  "fos",
+  "davant",
+  "vostre",
+  "història",
+  "penses",
+  "cinc",
+  "cert",
+  "pels",
+  "entrar",
+  "hagi",
+  "menys",
+  "primera",
+  "mes",
+  "fills",
+  "molts",
+  "portar",
+  "petit",
+  "costat",
+  "unes",
+  "posar",
+  "ajudar",
+  "cor",
+  "adéu",
+  "important",
+  "dones",
+  "tal",
+  "val",
+  "espero",
+  "veu",
+  "viu",
+  "gaire",
+  "aquella",
+  "dóna",
+  "nens",
+  "diuen",
+  "hagués",
+  "sou",
+  "persones",
+  "prendre",
+  "just",
+  "mans",
+  "perdut",
+  "fan",
+  "poc",
+  "creure",
+  "sabem",
+  "nen",
+  "junts",
+  "endavant",
+  "fem",
+  "única",
+  "hores",
+  "marxar",
+  "john",
+  "vostra",
+  "eren",
+  "malament",
+  "tornat",
+  "vés",
+  "únic",
+  "podia",
+  "perdre",
+  "aleshores",
+  "minuts",
+  "any",
+  "sent",
+  "tipus",
+  "mateixa",
+  "hauríem",
+  "meves",
+  "farà",
+  "treball",
+  "servir",
+  "força",
+  "paio",
+  "matí",
+  "col",
+  "marit",
+  "ls",
+  "forma",
+  "faci",
+  "problemes",
+  "deixat",
+  "quatre",
+  "habitació",
+  "parla",
+  "viure",
+  "ve",
+  "doctor",
+  "treure",
+  "quants",
+  "setmana",
+  "reina",
+  "estimo",
+  "fes",
+  "cos",
+  "ràpid",
+  "necessitem",
+  "exactament",
+  "nord",
+  "podries",
+  "parlant",
+  "necessita",
+  "digui",
+  "eres",
+  "oportunitat",
+  "pugui",
+  "set",
+  "facis",
+  "torna",
+  "tranquil",
+  "final",
+  "vell",
+  "conec",
+  "nena",
+  "poble",
+  "haurà",
+  "demanar",
+  "germana",
+  "buscar",
+  "foc",
+  "ns",
+  "culpa",
+  "acabar",
+  "prop",
+  "alguns",
+  "fort",
+  "seguretat",
+  "ahir",
+  "arribat",
+  "possible",
+  "genial",
+  "llit",
+  "realitat",
+  "jove",
+  "tampoc",
+  "telèfon",
+  "aconseguir",
+  "pensa",
+  "volen",
+  "pla",
+  "molta",
+  "papa",
+  "vostres",
+  "banda",
+  "darrere",
+  "farem",
+  "anava",
+  "donat",
+  "déus",
+  "igual",
+  "teniu",
+  "resta",
+  "estrany",
+  "llum",
+  "mesos",
+  "teves",
+  "oliver",
+  "haig",
+  "perdona",
+  "difícil",
+  "agent",
+  "fàcil",
+  "pregunta",
+  "açò",
+  "creu",
+  "agafar",
+  "segons",
+  "treballar",
+  "lluny",
+  "gairebé",
+  "qual",
+  "camp",
+  "sis",
+  "deia",
+  "acaba",
+  "mama",
+  "sola",
+  "pogut",
+  "morts",
+  "sopar",
+  "dormir",
+  "quelcom",
+  "última",
+  "feia",
+  "vós",
+  "tret",
+  "allò",
+  "esperar",
+  "assassinat",
+  "pensat",
+  "feliç",
+  "ordre",
+  "segura",
+  "mena",
+  "esteu",
+  "bret",
+  "recordes",
+  "conèixer",
+  "algunes",
+  "podríem",
+  "arma",
+  "diré",
+  "petita",
+  "passant",
+  "faria",
+  "portes",
+  "dur",
+  "cel",
+  "diferent",
+  "son",
+  "parell",
+  "probablement",
+  "nau",
+  "negre",
+  "últim",
+  "canvi",
+  "fi",
+  "seguir",
+  "agafa",
+  "assassí",
+  "salvar",
+  "quedar",
+  "altesa",
+  "festa",
+  "paraula",
+  "pau",
+  "aquells",
+  "dòlars",
+  "sigut",
+  "perill",
+  "escola",
+  "noies",
+  "dient",
+  "portat",
+  "lliure",
+  "segon",
+  "equip",
+  "stark",
+  "mig",
+  "enrere",
+  "presó",
+  "recordo",
+  "president",
+  "dalt",
+  "joc",
+  "sr",
+  "general",
+  "ací",
+  "lluitar",
+  "aniré",
+  "descomptat",
+  "país",
+  "posa",
+  "entens",
+  "pares",
+  "pitjor",
+  "secret",
+  "canviar",
+  "grans",
+  "número",
+  "estigui",
+  "diguis",
+  "missatge",
+  "sents",
+  "boig",
+  "faràs",
+  "simplement",
+  "buscant",
+  "estaves",
+  "exèrcit",
+  "parlat",
+  "surt",
+  "coneixes",
+  "estimada",
+  "sisplau",
+  "informació",
+  "podeu",
+  "dret",
+  "cul",
+  "necessites",
+  "pensant",
+  "digues",
+  "trucar",
+  "esperant",
+  "seré",
+  "voleu",
+  "paraules",
+  "matat",
+  "sabeu",
+  "pressa",
+  "troba",
+  "vaixell",
+  "calla",
+  "gos",
+  "explicar",
+  "vagi",
+  "armes",
+  "senyoreta",
+  "feu",
+  "sinó",
+  "parles",
+  "au",
+  "mirar",
+  "setmanes",
+  "volem",
+  "tracta",
+  "morta",
+  "siguis",
+  "lord",
+  "roba",
+  "estarà",
+  "tingui",
+  "comprar",
+  "hagut",
+  "senyors",
+  "futur",
+  "preguntes",
+  "vulguis",
+  "correcte",
+  "control",
+  "vau",
+  "segueix",
+  "havies",
+  "perfecte",
+  "walter",
+  "bastant",
+  "intel",
+  "para",
+  "posat",
+  "enviar",
+  "prova",
+  "broma",
+  "companyia",
+  "carrer",
+  "especial",
+  "hospital",
+  "intentar",
+  "classe",
+  "guàrdia",
+  "viatge",
+  "torni",
+  "llibre",
+  "bones",
+  "demanat",
+  "voldria",
+  "pagar",
+  "significa",
+  "oficina",
+  "milions",
+  "atac",
+  "jack",
+  "guanyar",
+  "comandant",
+  "sona",
+  "sala",
+  "veiem",
+  "mil",
+  "baix",
+  "entesos",
+  "bill",
+  "dolent",
+  "maleït",
+  "suposa",
+  "atenció",
+  "estimat",
+  "tornaré",
+  "llei",
+  "grup",
+  "error",
+  "honor",
+  "calma",
+  "sistema",
+  "oncle",
+  "gana",
+  "consell",
+  "falta",
+  "or",
+  "saben",
+  "quantes",
+  "estona",
+  "bonic",
+  "anirà",
+  "mary",
+  "recorda",
+  "prometo",
+  "boca",
+  "real",
+  "mar",
+  "canviat",
+  "conegut",
+  "acabo",
+  "mala",
+  "almenys",
+  "entendre",
+  "lannister",
+  "preparat",
+  "illa",
+  "ragnar",
+  "resposta",
+  "aconseguit",
+  "passarà",
+  "capaç",
+  "nano",
+  "disparar",
+  "tenies",
+  "queen",
+  "dolor",
+  "diria",
+  "notícies",
+  "somni",
+  "passi",
+  "professor",
+  "york",
+  "objectiu",
+  "xèrif",
+  "vista",
+  "dimonis",
+  "foto",
+  "funciona",
+  "oficial",
+  "servei",
+  "jemaine",
+  "llista",
+  "cavall",
+  "plaer",
+  "bonica",
+  "comença",
+  "charlie",
+  "idiota",
+  "agraden",
+  "pena",
+  "avió",
+  "ordres",
+  "faltar",
+  "vestit",
+  "treballant",
+  "vi",
+  "sarah",
+  "metge",
+  "alt",
+  "següent",
+  "perdó",
+  "hauràs",
+  "bons",
+  "personal",
+  "tornarà",
+  "relació",
+  "sa",
+  "trobes",
+  "situació",
+  "estaria",
+  "divertit",
+  "beure",
+  "espasa",
+  "espai",
+  "comte",
+  "mantenir",
+  "aneu",
+  "gust",
+  "vinc",
+  "meitat",
+  "sherlock",
+  "normal",
+  "sud",
+  "mestre",
+  "caure",
+  "increïble",
+  "ull",
+  "impossible",
+  "senyal",
+  "tornada",
+  "deixi",
+  "esperava",
+  "taula",
+  "trobo",
+  "il",
+  "voler",
+  "llarg",
+  "mireu",
+  "clau",
+  "govern",
+  "cafè",
+  "intentant",
+  "deixaré",
+  "cervell",
+  "millors",
+  "tinent",
+  "peter",
+  "the",
+  "salut",
+  "seràs",
+  "fantàstic",
+  "tarda",
+  "sortit",
+  "porto",
+  "tom",
+  "accident",
+  "minut",
+  "seguida",
+  "tracte",
+  "havien",
+  "missenyor",
+  "esta",
+  "rebut",
+  "fons",
+  "coll",
+  "riu",
+  "edifici",
+  "reunió",
+  "company",
+  "digue",
+  "gens",
+  "amiga",
+  "voltant",
+  "pogués",
+  "maleïda",
+  "darrera",
+  "suport",
+  "sheldon",
+  "majoria",
+  "mirant",
+  "pròpia",
+  "estaven",
+  "preguntar",
+  "truca",
+  "enviat",
+  "juro",
+  "frank",
+  "baixa",
+  "nomes",
+  "marxa",
+  "volies",
+  "confiar",
+  "cent",
+  "càrrec",
+  "propi",
+  "haurem",
+  "vides",
+  "be",
+  "rebre",
+  "trucat",
+  "trucada",
+  "parar",
+  "ensenyar",
+  "peus",
+  "robar",
+  "edat",
+  "coi",
+  "vostès",
+  "creia",
+  "miri",
+  "germans",
+  "perillós",
+  "música",
+  "aprendre",
+  "completament",
+  "escriure",
+  "escoltar",
+  "ple",
+  "córrer",
+  "regal",
+  "decisió",
+  "perdoni",
+  "enemic",
+  "quedat",
+  "mur",
+  "jugar",
+  "entra",
+  "respecte",
+  "qüestió",
+  "vuit",
+  "pobre",
+  "estaré",
+  "carrie",
+  "deus",
+  "soldats",
+  "costa",
+  "drogues",
+  "crim",
+  "vulgui",
+  "coneix",
+  "línia",
+  "murray",
+  "aire",
+  "meua",
+  "amable",
+  "molly",
+  "investigació",
+  "missió",
+  "carn",
+  "dubte",
+  "segona",
+  "hagis",
+  "batalla",
+  "ment",
+  "donaré",
+  "arreu",
+  "llibertat",
+  "varen",
+  "humà",
+  "ted",
+  "tocar",
+  "fred",
+  "parlem",
+  "suficient",
+  "proves",
+  "corre",
+  "llegir",
+  "través",
+  "tren",
+  "arriba",
+  "hotel",
+  "justícia",
+  "llest",
+  "protegir",
+  "energia",
+  "esquerra",
+  "reial",
+  "planeta",
+  "zona",
+  "lega",
+  "paper",
+  "dreta",
+  "centre",
+  "vendre",
+  "seran",
+  "vingui",
+  "banc",
+  "hauré",
+  "contacte",
+  "lluita",
+  "empresa",
+  "castell",
+  "pont",
+  "vius",
+  "prometre",
+  "silenci",
+  "infern",
+  "club",
+  "preu",
+  "alegro",
+  "cura",
+  "pres",
+  "atura",
+  "obrir",
+  "judici",
+};
+const uint16_t WA_FREQ_21_RANKS[] = {
+  710, 0, 124, 243, 0, 0, 0, 0, 0, 811, 0, 373, 0, 254, 490, 83,
+  0, 50, 0, 0, 921, 0, 0, 305, 664, 629, 0, 0, 0, 870, 0, 0,
+  0, 0, 0, 0, 0, 0, 165, 119, 0, 337, 689, 937, 0, 277, 13, 148,
+  643, 652, 650, 534, 577, 19, 232, 77, 218, 292, 422, 348, 770, 806, 887, 952,
+  583, 278, 15, 653, 747, 841, 568, 0, 0, 371, 110, 0, 0, 0, 0, 0,
+  0, 286, 0, 0, 0, 280, 80, 695, 0, 0, 0, 0, 866, 0, 994, 0,
+  5, 70, 746, 971, 989, 673, 0, 939, 476, 144, 677, 89, 221, 440, 0, 693,
+  0, 593, 241, 846, 878, 0, 0, 0, 0, 757, 313, 923, 936, 136, 982, 0,
+  275, 0, 736, 816, 206, 0, 0, 0, 0, 0, 0, 0, 294, 715, 590, 27,
+  799, 912, 0, 0, 536, 128, 390, 0, 0, 576, 0, 0, 229, 551, 606, 0,
+  681, 0, 626, 0, 0, 0, 0, 146, 581, 972, 0, 722, 154, 239, 766, 848,
+  0, 0, 537, 0, 0, 0, 184, 0, 310, 0, 0, 497, 290, 203, 454, 624,
+  0, 0, 854, 942, 0, 389, 510, 0, 0, 0, 525, 0, 706, 0, 0, 0,
+  93, 434, 728, 0, 0, 352, 639, 407, 672, 768, 0, 0, 0, 234, 0, 0,
+  0, 0, 121, 379, 0, 347, 0, 0, 0, 0, 0, 688, 0, 201, 0, 0,
+  0, 0, 0, 0, 189, 0, 0, 253, 55, 0, 993, 0, 0, 0, 0, 272,
+  0, 196, 0, 794, 0, 885, 0, 365, 0, 0, 0, 392, 0, 779, 503, 690,
+  0, 0, 0, 0, 480, 225, 0, 0, 0, 680, 0, 0, 0, 0, 0, 0,
+  817, 163, 555, 831, 105, 335, 960, 0, 0, 550, 943, 114, 101, 388, 0, 834,
+  871, 764, 0, 0, 0, 0, 0, 216, 0, 0, 622, 992, 0, 0, 631, 0,
+  0, 0, 985, 0, 409, 0, 282, 0, 0, 532, 0, 69, 0, 271, 496, 0,
+  683, 520, 0, 0, 0, 0, 538, 0, 0, 0, 0, 0, 0, 0, 37, 0,
+  0, 403, 0, 342, 149, 0, 0, 0, 756, 0, 153, 661, 964, 649, 0, 0,
+  675, 0, 285, 752, 0, 0, 0, 147, 369, 0, 796, 0, 0, 0, 819, 0,
+  743, 0, 488, 0, 861, 0, 66, 99, 383, 0, 0, 0, 0, 0, 115, 325,
+  10, 990, 0, 311, 682, 0, 557, 0, 0, 837, 602, 954, 464, 727, 925, 0,
+  193, 453, 259, 173, 721, 738, 776, 0, 0, 0, 0, 0, 0, 0, 0, 543,
+  0, 813, 0, 6, 0, 209, 526, 584, 832, 284, 0, 0, 224, 287, 308, 913,
+  930, 0, 955, 0, 0, 104, 0, 0, 88, 361, 412, 0, 614, 0, 202, 0,
+  0, 805, 151, 0, 0, 0, 0, 0, 0, 0, 0, 812, 0, 0, 0, 678,
+  863, 0, 0, 0, 327, 0, 0, 777, 572, 242, 0, 527, 73, 450, 934, 0,
+  0, 0, 0, 0, 582, 826, 569, 0, 170, 168, 632, 580, 843, 0, 0, 195,
+  0, 0, 0, 708, 494, 125, 767, 544, 828, 0, 0, 910, 0, 0, 0, 331,
+  616, 75, 877, 608, 0, 0, 0, 0, 539, 571, 191, 49, 735, 0, 734, 0,
+  0, 566, 0, 0, 830, 0, 0, 0, 0, 0, 0, 382, 238, 0, 731, 0,
+  0, 100, 0, 0, 0, 0, 0, 0, 309, 0, 57, 265, 252, 0, 857, 0,
+  0, 262, 720, 134, 0, 0, 0, 0, 0, 553, 822, 0, 0, 758, 793, 59,
+  479, 906, 406, 117, 980, 0, 52, 0, 0, 0, 840, 0, 0, 0, 932, 852,
+  465, 307, 493, 0, 0, 0, 0, 142, 0, 881, 938, 0, 0, 642, 965, 41,
+  0, 0, 742, 0, 0, 236, 0, 0, 0, 0, 0, 0, 656, 0, 298, 0,
+  0, 160, 814, 0, 394, 645, 0, 171, 0, 0, 0, 634, 0, 894, 0, 0,
+  56, 0, 0, 245, 0, 0, 0, 919, 803, 297, 0, 0, 491, 0, 304, 745,
+  506, 0, 516, 0, 0, 260, 0, 0, 788, 0, 0, 835, 333, 177, 0, 0,
+  0, 713, 0, 398, 0, 0, 0, 671, 159, 261, 199, 696, 0, 556, 384, 0,
+  0, 430, 475, 489, 692, 899, 628, 0, 875, 0, 0, 0, 0, 0, 20, 486,
+  135, 0, 0, 0, 107, 113, 0, 0, 0, 0, 563, 0, 92, 289, 0, 0,
+  0, 0, 0, 74, 0, 0, 0, 821, 0, 903, 916, 0, 0, 247, 0, 60,
+  0, 0, 0, 129, 0, 0, 0, 0, 0, 0, 827, 601, 733, 0, 0, 0,
+  0, 0, 0, 950, 0, 0, 0, 549, 902, 470, 0, 726, 0, 0, 502, 598,
+  685, 604, 860, 890, 87, 666, 970, 0, 744, 172, 24, 905, 0, 408, 0, 0,
+  0, 71, 800, 858, 0, 0, 0, 0, 0, 0, 740, 0, 0, 0, 0, 865,
+  0, 0, 269, 0, 0, 0, 0, 0, 0, 0, 774, 46, 789, 944, 0, 998,
+  0, 560, 561, 67, 233, 508, 765, 370, 0, 164, 326, 499, 637, 423, 395, 709,
+  791, 984, 322, 212, 456, 0, 625, 441, 0, 535, 0, 0, 0, 665, 220, 0,
+  0, 0, 180, 0, 0, 0, 276, 0, 0, 0, 0, 161, 23, 72, 7, 439,
+  478, 872, 0, 0, 0, 237, 452, 974, 880, 995, 0, 0, 818, 0, 0, 0,
+  36, 449, 647, 82, 186, 0, 182, 0, 0, 0, 484, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 999, 0, 230, 829, 214, 0, 0, 0, 0, 911,
+  825, 0, 0, 246, 426, 591, 0, 623, 0, 0, 515, 0, 529, 0, 0, 884,
+  0, 0, 466, 670, 859, 0, 0, 0, 924, 351, 0, 0, 983, 188, 0, 0,
+  0, 0, 0, 0, 0, 760, 644, 279, 358, 0, 0, 316, 0, 0, 962, 0,
+  574, 0, 314, 0, 0, 0, 264, 0, 0, 0, 0, 0, 0, 0, 896, 0,
+  0, 458, 0, 0, 0, 773, 0, 0, 0, 988, 0, 0, 42, 977, 255, 0,
+  748, 0, 217, 393, 0, 513, 844, 719, 417, 759, 0, 0, 318, 215, 0, 248,
+  91, 303, 567, 712, 0, 565, 586, 0, 847, 886, 312, 372, 207, 909, 958, 427,
+  473, 755, 0, 0, 739, 0, 0, 0, 0, 0, 53, 949, 152, 0, 801, 281,
+  612, 495, 34, 18, 448, 714, 833, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 58, 0, 94, 864, 0, 0, 0, 445, 178, 54, 0, 786, 39, 385,
+  781, 855, 29, 0, 0, 0, 0, 0, 0, 68, 438, 211, 931, 0, 194, 703,
+  353, 729, 258, 0, 638, 301, 324, 346, 474, 588, 918, 0, 0, 0, 231, 9,
+  299, 0, 686, 782, 22, 967, 0, 0, 0, 546, 554, 0, 0, 697, 0, 85,
+  850, 0, 1000, 0, 0, 0, 0, 0, 512, 0, 0, 547, 288, 98, 0, 332,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 897, 0, 0, 293, 469,
+  723, 0, 249, 482, 176, 323, 511, 531, 0, 839, 0, 3, 8, 619, 775, 0,
+  907, 38, 0, 155, 0, 319, 0, 0, 0, 798, 0, 0, 0, 167, 730, 0,
+  30, 410, 0, 291, 399, 138, 447, 0, 0, 436, 611, 641, 0, 517, 213, 0,
+  0, 0, 0, 0, 0, 0, 607, 0, 0, 0, 0, 0, 667, 0, 0, 0,
+  0, 0, 0, 0, 263, 648, 691, 716, 131, 0, 0, 700, 0, 0, 0, 0,
+  141, 235, 853, 338, 0, 0, 47, 0, 0, 0, 589, 340, 915, 0, 0, 0,
+  0, 0, 787, 437, 0, 633, 0, 0, 0, 0, 0, 0, 946, 0, 0, 0,
+  0, 0, 137, 0, 0, 315, 501, 0, 0, 111, 0, 166, 951, 662, 0, 0,
+  699, 109, 0, 978, 90, 350, 204, 48, 208, 762, 920, 997, 0, 0, 0, 504,
+  552, 0, 0, 842, 0, 0, 397, 0, 0, 0, 0, 0, 0, 0, 904, 0,
+  0, 0, 0, 268, 0, 0, 0, 0, 575, 0, 879, 519, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 968, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  761, 802, 987, 0, 0, 891, 374, 966, 0, 0, 431, 0, 0, 472, 594, 120,
+  869, 485, 684, 103, 851, 0, 0, 658, 0, 0, 509, 646, 0, 0, 578, 349,
+  411, 627, 836, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 205, 957,
+  771, 0, 0, 969, 564, 31, 763, 940, 928, 888, 711, 0, 336, 432, 0, 0,
+  377, 0, 609, 0, 0, 0, 0, 559, 428, 959, 668, 343, 420, 421, 471, 51,
+  359, 617, 630, 26, 792, 862, 893, 694, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 257, 368, 0, 0, 935, 0, 78, 95, 84, 986, 500, 0, 0, 468, 198,
+  772, 367, 0, 0, 492, 0, 0, 0, 0, 521, 917, 381, 849, 0, 654, 0,
+  892, 0, 0, 0, 0, 35, 0, 0, 704, 0, 0, 701, 725, 0, 0, 250,
+  0, 0, 0, 687, 0, 0, 0, 223, 0, 0, 0, 0, 0, 0, 0, 386,
+  414, 270, 102, 227, 732, 0, 0, 295, 0, 981, 0, 0, 0, 222, 0, 317,
+  595, 0, 14, 0, 0, 341, 375, 573, 0, 0, 415, 344, 838, 0, 0, 0,
+  405, 621, 274, 600, 0, 0, 867, 660, 947, 754, 0, 179, 174, 618, 605, 900,
+  0, 0, 481, 0, 636, 945, 0, 0, 460, 0, 929, 0, 0, 300, 143, 356,
+  463, 669, 783, 883, 807, 908, 200, 809, 895, 0, 0, 0, 0, 0, 459, 0,
+  698, 0, 320, 856, 21, 790, 0, 784, 0, 0, 533, 0, 0, 0, 778, 0,
+  0, 0, 0, 0, 991, 0, 0, 45, 0, 127, 425, 528, 62, 404, 112, 357,
+  874, 889, 518, 976, 0, 226, 663, 0, 122, 0, 0, 328, 0, 620, 0, 570,
+  585, 603, 973, 979, 914, 273, 363, 17, 416, 116, 400, 640, 0, 0, 0, 0,
+  108, 462, 724, 780, 366, 873, 81, 123, 183, 64, 387, 868, 321, 0, 0, 0,
+  823, 0, 596, 956, 44, 329, 0, 0, 0, 540, 0, 0, 0, 118, 190, 192,
+  737, 0, 0, 0, 457, 0, 0, 467, 0, 523, 0, 0, 181, 130, 0, 0,
+  926, 302, 0, 339, 498, 40, 455, 592, 599, 651, 741, 0, 0, 0, 446, 0,
+  542, 0, 898, 16, 0, 0, 0, 0, 795, 0, 43, 0, 0, 901, 0, 679,
+  587, 0, 876, 0, 354, 615, 0, 139, 0, 0, 0, 0, 28, 443, 0, 0,
+  0, 0, 187, 0, 0, 941, 435, 0, 0, 0, 0, 0, 996, 25, 659, 0,
+  0, 11, 0, 0, 0, 0, 0, 451, 522, 96, 0, 0, 0, 0, 0, 0,
+  0, 244, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 97, 0, 0, 0,
+  753, 0, 0, 0, 61, 256, 0, 0, 597, 126, 0, 0, 0, 63, 345, 808,
+  0, 0, 0, 0, 32, 391, 785, 360, 750, 418, 0, 0, 0, 797, 150, 579,
+  507, 882, 0, 0, 0, 0, 0, 0, 0, 676, 0, 0, 0, 419, 505, 705,
+  266, 749, 251, 0, 0, 0, 0, 0, 0, 0, 355, 562, 12, 530, 845, 718,
+  0, 362, 267, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 810, 156,
+  0, 185, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 433, 401, 541, 933,
+  0, 820, 0, 0, 0, 76, 0, 769, 296, 0, 4, 0, 0, 33, 0, 717,
+  0, 0, 0, 0, 210, 0, 0, 413, 424, 429, 219, 444, 0, 0, 477, 548,
+  0, 0, 402, 0, 0, 0, 483, 674, 0, 0, 0, 133, 0, 613, 558, 0,
+  0, 0, 0, 376, 0, 0, 524, 927, 1, 0, 0, 0, 0, 0, 132, 461,
+  922, 0, 283, 0, 0, 963, 0, 0, 79, 0, 162, 197, 655, 0, 334, 0,
+  0, 0, 0, 610, 707, 953, 378, 86, 0, 702, 240, 330, 0, 948, 65, 815,
+  169, 824, 0, 545, 0, 0, 487, 396, 0, 0, 0, 961, 0, 0, 0, 0,
+  175, 0, 0, 0, 158, 975, 0, 0, 364, 0, 0, 0, 0, 106, 145, 442,
+  228, 140, 657, 514, 751, 804, 306, 0, 0, 0, 0, 380, 0, 0, 2, 635,
+};
+
+const char *WA_FREQ_22_TOKENS[] = {
+  "эвла",
+  "юкъа",
+  "йогӀу",
+  "кӀоштан",
+  "областан",
+  "а",
+  "Российн",
+  "Федерацин",
+  "шарахь",
+  "Кирован",
+  "код",
+  "индекс",
+  "Почтан",
+  "ОКАТО",
+  "Нижегородан",
+  "адам",
+  "дукхалла",
+  "Бахархойн",
+  "Бахархойн дукхалла",
+  "ю",
+  "леррина",
+  "ГӀезалойчоьнан",
+  "ду",
+  "иза",
+  "Свердловскан",
+  "2010",
+  "бина",
+  "тӀаьххьара",
+  "ХӀокху",
+  "хийцамаш",
+  "Оренбурган",
+  "ГӀалин",
+  "агӀонна",
+  "гуо",
+  "ца",
+  "йолу",
+  "шеран",
+  "хӀоттам",
+  "2002",
+  "ларарца",
+  "Республикан",
+  "къаьмний",
+  "2009",
+  "Пензан",
+  "оьрсий",
+  "бу",
+  "Иза",
+  "Самаран",
+  "хилла",
+  "коьрта",
+  "шен",
+  "цуьнан",
+  "хуьлу",
+  "цо",
+  "цӀе",
+  "Нохчийн",
+  "Комийн",
+  "юрт",
+  "йу",
+  "шо",
+  "хенахь",
+  "тӀехь",
+  "уьш",
+  "Федераци",
+  "хьалхара",
+  "а.",
+  "долу",
+  "гӀала",
+  "Теллина",
+  "Российн Федераци",
+  "январь",
+  "дукха",
+  "2022",
+  "и",
+  "Бахархой",
+  "дакъа",
+  "вара",
+  "кхин",
+  "леррана",
+  "ву",
+  "ю.",
+  "гӀезалой",
+  "чохь",
+  "долуш",
+  "болх",
+  "аьлла",
+  "я",
+  "2023",
+  "Цо",
+  "Оцу",
+  "Ульяновскан",
+  "оцу",
+  "цунна",
+  "санна",
+  "яра",
+  "болу",
+  "гӀалин",
+  "ша",
+  "олу",
+  "кӀошт",
+  "олучу",
+  "бен",
+  "Городецан",
+  "меттиг",
+  "хилира",
+  "хьалха",
+  "1",
+  "нохчийн",
+  "кхаччалц",
+  "чуьра",
+  "йолуш",
+  "чу",
+  "цхьа",
+  "мотт",
+  "ткъа",
+  "Амма",
+  "эзар",
+  "тӀе",
+  "И",
+  "до",
+  "пачхьалкхан",
+  "иштта",
+  "цхьана",
+  "хьостан",
+  "Цуьнан",
+  "2012",
+  "амма",
+  "цара",
+  "бахьнехь",
+  "Иштта",
+  "хилар",
+  "хила",
+  "Республика",
+  "дуьйна",
+  "2013",
+  "тӀаьхьа",
+  "2011",
+  "церан",
+  "Архангельскан",
+  "сов",
+  "Вельскан",
+  "го",
+  "дара",
+  "ДегIастанан",
+  "чӀогӀа",
+  "декабрь",
+  "дика",
+  "йолчу",
+  "2021",
+  "Котельничан",
+  "км",
+  "украинаш",
+  "лаьтта",
+  "йа",
+  "дац",
+  "цхьаъ",
+  "шайн",
+  "шаран",
+  "2",
+  "14",
+  "тайп",
+  "лаьцна",
+  "болуш",
+  "Сокольскан",
+  "хи",
+  "2000",
+  "йара",
+  "Кирово-Чепецкан",
+  "августехь",
+  "дуьненан",
+  "царна",
+  "шерашкахь",
+  "маттахь",
+  "хин",
+  "башкираш",
+  "гуон",
+  "Чкаловскан",
+  "Оричин",
+  "йукъахь",
+  "йина",
+  "бара",
+  "барам",
+  "хан",
+  "стаг",
+  "массо",
+  "дӀатесна",
+  "нах",
+  "31",
+  "Афанасьеван",
+  "тукхум",
+  "5%",
+  "Нохчийн Республика",
+  "цуьна",
+  "догӀуш",
+  "казахаш",
+  "марийш",
+  "бос",
+  "ноябрь",
+  "10",
+  "5",
+  "Орлован",
+  "гергга",
+  "беш",
+  "23",
+  "кхечу",
+  "Слободскан",
+  "тӀеман",
+  "13",
+  "юкъ",
+  "деш",
+  "долчу",
+  "3",
+  "шена",
+  "Цу",
+  "Яранскан",
+  "цигахь",
+  "цунах",
+  "16",
+  "2008",
+  "6%",
+  "Шен",
+  "волу",
+  "цхьаьна",
+  "12",
+  "тайпа",
+  "уггаре",
+  "Ковернинан",
+  "11",
+  "да",
+  "йоккха",
+  "йукъара",
+  "керла",
+  "юккъера",
+  "пачхьалкх",
+  "шина",
+  "4",
+  "Богородскан",
+  "Подосиновецан",
+  "Санчурскан",
+  "тӀом",
+  "Цундела",
+  "Цул",
+  "йац",
+  "меттигаш",
+  "цу",
+  "8",
+  "Уьш",
+  "волуш",
+  "де",
+  "вайн",
+  "кхоьллина",
+  "цуо",
+  "масала",
+  "Шабалин",
+  "мохк",
+  "сурт",
+  "Ӏаьржа",
+  "9",
+  "дӀа",
+  "Воскресенскан",
+  "Лузан",
+  "Цуьна",
+  "ДегIастан",
+  "оьрсийн",
+  "юкъахь",
+  "15",
+  "бӀешо",
+  "меттиган",
+  "Даровскан",
+  "удмурташ",
+  "кепара",
+  "баттахь",
+  "бира",
+  "ло",
+  "лоруш",
+  "млн",
+  "30",
+  "йо",
+  "кӀант",
+  "тӀехьа",
+  "ши",
+  "аьтту",
+  "уггар",
+  "6",
+  "бух",
+  "тIехь",
+  "юха",
+  "Ветлуган",
+  "Советскан",
+  "тӀера",
+  "7%",
+  "Уржуман",
+  "Юрьян",
+  "жима",
+  "лелош",
+  "тарло",
+  "Пачхьалкхан",
+  "бахархойн",
+  "хуьлуш",
+  "4%",
+  "административни",
+  "агӀора",
+  "бохуш",
+  "бутт",
+  "дийнахь",
+  "коми",
+  "17",
+  "22",
+  "2007",
+  "Мамадышан",
+  "дина",
+  "тайп-тайпана",
+  "шиъ",
+  "Мухьаммад",
+  "хиларна",
+  "Арскан",
+  "Республикин",
+  "лела",
+  "еза",
+  "шира",
+  "7",
+  "Кукморан",
+  "декабрехь",
+  "июль",
+  "февралехь",
+  "Ӏаш",
+  "25",
+  "Кумёнан",
+  "20",
+  "июнь",
+  "меттехь",
+  "Вачан",
+  "доккха",
+  "дуккха",
+  "майхь",
+  "Кавказан",
+  "вина",
+  "гойту",
+  "йиш",
+  "хӀинца",
+  "хӀора",
+  "хӀордан",
+  "хӀума",
+  "1%",
+  "апрелехь",
+  "дахар",
+  "тиллина",
+  "юьртан",
+  "Ӏалашо",
+  "луш",
+  "8%",
+  "Высокогорскан",
+  "Нохч-ГӀалгӀайн",
+  "дан",
+  "май",
+  "январехь",
+  "йоцуш",
+  "лакхара",
+  "латта",
+  "2019",
+  "бо",
+  "цӀа",
+  "Челябинскан",
+  "28",
+  "Цигахь",
+  "деха",
+  "муниципальни",
+  "политикин",
+  "бахархой",
+  "2020",
+  "Къилбаседа",
+  "Ткъа",
+  "гӀо",
+  "йоцу",
+  "мартехь",
+  "21",
+  "Кстован",
+  "Пижанкан",
+  "аьлча",
+  "бан",
+  "болчу",
+  "волчу",
+  "дош",
+  "тера",
+  "Зеленодольскан",
+  "декъехь",
+  "26",
+  "Ирбит",
+  "дуьненахь",
+  "лору",
+  "нийса",
+  "совгӀат",
+  "тӀиера",
+  "цӀарах",
+  "Кильмезан",
+  "лерина",
+  "2014",
+  "Вайн",
+  "км²",
+  "ма",
+  "меттан",
+  "язйина",
+  "000",
+  "Дуьненан",
+  "Кхин",
+  "Талица",
+  "декъашхо",
+  "махкахь",
+  "яц",
+  "3%",
+  "2%",
+  "СССР",
+  "тIе",
+  "тайпана",
+  "2006",
+  "2015",
+  "Европин",
+  "заманахь",
+  "къоман",
+  "наггахь",
+  "хууш",
+  "хьал",
+  "юккъехь",
+  "Iаьржа",
+  "волавелира",
+  "дуьхьала",
+  "цхьацца",
+  "Малмыжан",
+  "къилбехьа",
+  "октябрь",
+  "бакъо",
+  "доза",
+  "кӀезиг",
+  "март",
+  "хийистехь",
+  "100",
+  "24",
+  "Лыскован",
+  "боху",
+  "бӀешеран",
+  "деза",
+  "дин",
+  "йира",
+  "цера",
+  "Кикнуран",
+  "Прилузски",
+  "боккха",
+  "некъ",
+  "юьртасоветан",
+  "ТӀаккха",
+  "куьйгалхо",
+  "кхоьчу",
+  "ницкъ",
+  "олуш",
+  "спортан",
+  "Альметьевскан",
+  "Верхняя",
+  "Россин",
+  "басахь",
+  "цул",
+  "11%",
+  "18",
+  "Варнавинан",
+  "Кизляран",
+  "Хьалхара",
+  "Цунна",
+  "йукъараллин",
+  "масех",
+  "маьӀна",
+  "халкъан",
+  "Уренан",
+  "делира",
+  "зуда",
+  "шуьйра",
+  "эрал",
+  "Нолинскан",
+  "кхаа",
+  "майда",
+  "царех",
+  "Арзамасан",
+  "Белинскан",
+  "Дукха",
+  "Мокшанан",
+  "Павлован",
+  "Цера",
+  "Цхьана",
+  "алсама",
+  "арахецна",
+  "бӀешарахь",
+  "мокха",
+  "хаза",
+  "19",
+  "Абу",
+  "Актанышан",
+  "Коьрта",
+  "къаьмнийн",
+  "Ӏедал",
+  "Буинскан",
+  "Краснобакин",
+  "бац",
+  "йогӀуш",
+  "лелайо",
+  "олхазар",
+  "таро",
+  "чемпион",
+  "10%",
+  "Арбажан",
+  "Баннаш",
+  "Масала",
+  "дахаран",
+  "кхоьллира",
+  "къилбаседехьа",
+  "меттигехь",
+  "миллион",
+  "февраль",
+  "ян",
+  "Итон-Кхаьллан",
+  "Теркан",
+  "Толстойн",
+  "Тукаевскан",
+  "Ша",
+  "апрель",
+  "исбаьхьаллин",
+  "олура",
+  "сентябрехь",
+  "Википеди",
+  "Галайн-ЧӀожан",
+  "Заинскан",
+  "кхочуш",
+  "къам",
+  "метр",
+  "элира",
+  "Ӏилманийн",
+  "2016",
+  "Верхошижемьен",
+  "Зуевкан",
+  "Лебяжьен",
+  "Чаплин",
+  "Шаранган",
+  "можа",
+  "Нагорскан",
+  "Сийлахь",
+  "июлехь",
+  "кхоллар",
+  "мел",
+  "муьрехь",
+  "октябрехь",
+  "фильм",
+  "Азнакаеван",
+  "Дальнеконстантинован",
+  "Спасскан",
+  "Сысольскан",
+  "ХӀиндин",
+  "ХӀинца",
+  "Цхьа",
+  "дира",
+  "йазйина",
+  "лаьттина",
+  "мах",
+  "ноябрехь",
+  "республикин",
+  "тӀаккха",
+  "27",
+  "Балтасин",
+  "июнехь",
+  "Ӏаламан",
+  "Алапаевское",
+  "Большие",
+  "Верхний",
+  "Википедин",
+  "Пестрецан",
+  "Тетюшин",
+  "гуш",
+  "деша",
+  "лело",
+  "хьалхарчу",
+  "цкъа",
+  "Ӏаткъам",
+  "Аксубаеван",
+  "Тахана",
+  "Толстойс",
+  "бетталуш",
+  "доцуш",
+  "йиллина",
+  "цIе",
+  "Верхнеуслонан",
+  "Нурлатан",
+  "Сарманован",
+  "динан",
+  "уллехь",
+  "хала",
+  "хиллачу",
+  "хьолахь",
+  "2005",
+  "Агрызан",
+  "Нижняя",
+  "Свечан",
+  "ТӀе",
+  "ХӀара",
+  "Церан",
+  "атта",
+  "елира",
+  "историн",
+  "йуккъера",
+  "ломан",
+  "оьрсаша",
+  "тӀемаш",
+  "Камышловскан",
+  "М.",
+  "Нохчийчоьнан",
+  "Россин Федераци",
+  "Усть-Куломан",
+  "беха",
+  "доьзна",
+  "нана",
+  "Апастован",
+  "Ардатован",
+  "Лаишеван",
+  "Починкин",
+  "Пышма",
+  "август",
+  "вахара",
+  "дуьхьало",
+  "масийтта",
+  "Верхнекамскан",
+  "Краснояран",
+  "Нобелин",
+  "Рыбно-Слободан",
+  "гена",
+  "массарелла",
+  "садолу",
+  "хиш",
+  "хьажорг",
+  "Бугурусланан",
+  "Бузулукан",
+  "Толстой",
+  "Тужан",
+  "Усть-Вымскан",
+  "жимма",
+  "хир",
+  "цакхочу",
+  "чехка",
+  "яккхира",
+  "Ӏаьрбийн",
+  "29",
+  "Муслюмован",
+  "Сосновскан",
+  "Сунан",
+  "дукхах",
+  "дуьххьара",
+  "йоу",
+  "кӀотар",
+  "мехкан",
+  "муниципалан",
+  "хӀумнаш",
+  "чувашаш",
+  "Ӏилманан",
+  "Кувандыкан",
+  "Мензелинскан",
+  "Саракташан",
+  "Халкъан",
+  "агӀо",
+  "аренашкахь",
+  "дерг",
+  "йоӀ",
+  "кеп",
+  "лекха",
+  "экономикин",
+  "86%",
+  "87%",
+  "Азербайджанан",
+  "Лениногорскан",
+  "Опарин",
+  "Пильнан",
+  "Слободскойн",
+  "барт",
+  "белхан",
+  "бухара",
+  "корта",
+  "нохчий",
+  "са",
+  "хаамаш",
+  "хӀуманаш",
+  "Ӏа",
+  "Малая",
+  "Севернин",
+  "Ставрополан",
+  "Тонкинан",
+  "Хьалха",
+  "ЦӀен",
+  "адамийн",
+  "акха",
+  "географин",
+  "12%",
+  "Гагинан",
+  "Йоккха",
+  "Нижний",
+  "Новосергиевкан",
+  "Похвистневан",
+  "лаьмнашкахь",
+  "наха",
+  "республика",
+  "со",
+  "тоьхна",
+  "хьаннашкахь",
+  "хьолехь",
+  "А.",
+  "Гари",
+  "Горноуральский",
+  "Красногвардейскан",
+  "Нижнекамскан",
+  "Новое",
+  "Оьрсаша",
+  "Туринскан",
+  "Цара",
+  "артист",
+  "дар",
+  "дукхаха",
+  "малхбалехьа",
+  "Корткеросан",
+  "Мурашин",
+  "Сабинскан",
+  "доккху",
+  "культуран",
+  "кхоъ",
+  "лаьттан",
+  "хаам",
+  "центр",
+  "чекхъяккхира",
+  "82%",
+  "Керла",
+  "Лукоянован",
+  "Сергачан",
+  "Старый",
+  "Чистополан",
+  "дела",
+  "дешнаш",
+  "дийцарехь",
+  "диллина",
+  "жоп",
+  "йоккху",
+  "йокха",
+  "охьа",
+  "реза",
+  "система",
+  "тӀедарчий",
+  "цундела",
+  "цуьнца",
+  "89%",
+  "XIX",
+  "Артёмовски",
+  "Старое",
+  "Тоншаеван",
+  "Унин",
+  "Цийн",
+  "адаман",
+  "арахийцира",
+  "аьлчи",
+  "кегийра",
+  "ойла",
+  "ойланаш",
+  "шайна",
+  "13%",
+  "°C",
+  "Алькееван",
+  "башха",
+  "доцу",
+  "кӀайн",
+  "ламанан",
+  "м",
+  "роль",
+  "тIедарчий",
+  "хьала",
+  "цӀераш",
+  "Бугульман",
+  "Кайбицкан",
+  "Каменскан",
+  "Каменскан гӀалин гуо",
+  "Княжпогостскан",
+  "Лакхара",
+  "Первомайскан",
+  "Удорскан",
+  "ХӀора",
+  "агӀор",
+  "аз",
+  "велира",
+  "даьлча",
+  "кириллицан",
+  "кхаьчча",
+  "кхуьу",
+  "немцой",
+  "сийлахь",
+  "сиха",
+  "халкъашна",
+  "хилча",
+  "хӀунда",
+  "Ӏедалан",
+  "83%",
+  "Грозный",
+  "Майнан",
+  "Ножин-Юртан",
+  "Сызранан",
+  "ал",
+  "ахча",
+  "бакъонаш",
+  "барз",
+  "вай",
+  "герга",
+  "йукъа",
+  "кхо",
+  "ладаме",
+  "пачхьалкхийн",
+  "Александровкан",
+  "Башмакован",
+  "Дала",
+  "Европехь",
+  "Земетчинан",
+  "Инзан",
+  "Княгининан",
+  "Колышлейн",
+  "Советан",
+  "бахьана",
+  "дийна",
+  "жигара",
+  "йаззам",
+  "категори",
+  "мегар",
+  "меттигашкахь",
+  "ненан",
+  "пачхьалкхаш",
+  "паччахь",
+  "паччахьан",
+  "тайпан",
+  "хьажа",
+  "Асекееван",
+  "Белая",
+  "Вознесенскан",
+  "Европан",
+  "Кавказехь",
+  "Малые",
+  "дацара",
+  "дерриг",
+  "кхочу",
+  "лаьтташ",
+  "Ӏам",
+  "91%",
+  "Алексеевскан",
+  "Делан",
+  "Перевозан",
+  "Соьлжа-ГӀалан",
+  "Тюлячин",
+  "Фалёнкин",
+  "Хасу-Эвлан",
+  "Шаткин",
+  "аса",
+  "герз",
+  "догӀу",
+  "дора",
+  "кхаьчна",
+  "лакхахь",
+  "лахара",
+  "область",
+  "яр",
+  "яш",
+  "2018",
+  "XX",
+  "Бен",
+  "Воротынецан",
+  "Тамалан",
+  "ХӀоьаш",
+  "Шаройн",
+  "административан",
+  "ан",
+  "билгало",
+  "бохург",
+  "гӀалан",
+  "йелла",
+  "йоза",
+  "когаш",
+  "кхузахь",
+  "сийна",
+  "тӀехула",
+  "хуьлура",
+  "хьо",
+  "цуьнга",
+  "14%",
+  "88%",
+  "АЦШ",
+  "Александровка",
+  "Ачит",
+  "Большеболдин",
+  "Верхотурье",
+  "Городищенан",
+  "Кинелан",
+  "Маркс",
+  "Нохчийчохь",
+  "Слободо-Турински",
+  "Сыктывдинскан",
+  "Черемшан",
+  "Шарлыкан",
+  "делла",
+  "диттийн",
+  "еш",
+  "мур",
+  "немцойн",
+  "пачхьалкхашкахь",
+  "терго",
+  "хенан",
+  "200",
+  "Байкалован",
+  "Байкалован кӀошт",
+  "Веданан",
+  "Волжскан",
+  "Каспий-хӀордан",
+  "Кошкинан",
+  "Оьрсийн",
+  "Сергиевскан",
+  "Уггаре",
+  "бераш",
+  "бердаца",
+  "букъ",
+  "гӀирс",
+  "ерриг",
+  "кхетам",
+  "лецира",
+  "могӀа",
+  "официалан",
+  "тIаьхьа",
+  "толам",
+  "хьаьжжина",
+  "хьост",
+  "юьртсоветан",
+  "1991",
+  "50",
+  "92%",
+  "Барышан",
+  "Бутурлин",
+  "Кхузахь",
+  "Мациев",
+  "Николаевкан",
+  "Омутнинскан",
+  "Пачхьалкх",
+  "ала",
+  "аьтто",
+  "бецан",
+  "боцуш",
+  "дешаран",
+  "диттан",
+  "доу",
+  "кӀай",
+  "лелайора",
+  "литературан",
+  "мехкайистан",
+  "нехан",
+  "оьшу",
+  "тайпанаш",
+  "тӀамехь",
+  "шаьш",
+  "шортта",
+  "2004",
+  "of",
+  "Америкин",
+  "Неман",
+  "Сосновка",
+  "Х.",
+  "Хи",
+  "гӀуллакх",
+  "догlуш",
+  "долахь",
+  "дуьненайукъара",
+  "йаьккхина",
+  "йистехь",
+  "къаьмнаш",
+  "президент",
+  "хьен",
+  "16%",
+  "78%",
+  "93%",
+  "Камско-Устьинскан",
+  "Навашинан",
+  "Сеченован",
+  "Соль-Илецкан",
+  "Тоцкан",
+  "адамаш",
+  "гойтуш",
+  "дов",
+  "долалуш",
+  "еха",
+  "климат",
+  "къобал",
+  "литературин",
+  "малхбузехьа",
+  "метта",
+  "нагахь",
+  "нахана",
+  "словарь",
+  "суна",
+  "температура",
+  "Ӏумар",
+  "15%",
+};
+const uint16_t WA_FREQ_22_RANKS[] = {
+  189, 0, 828, 0, 847, 707, 0, 484, 108, 688, 501, 0, 450, 988, 0, 0,
+  0, 242, 857, 902, 532, 0, 0, 0, 0, 630, 0, 0, 0, 350, 436, 867,
+  0, 0, 121, 803, 478, 0, 0, 625, 829, 0, 0, 0, 0, 724, 0, 0,
+  0, 0, 0, 0, 0, 452, 84, 397, 434, 461, 0, 0, 0, 0, 756, 0,
+  0, 0, 172, 0, 620, 627, 735, 0, 0, 0, 0, 372, 0, 714, 0, 0,
+  0, 0, 568, 139, 0, 0, 433, 0, 0, 0, 0, 239, 698, 13, 321, 788,
+  684, 0, 649, 0, 0, 0, 192, 173, 512, 0, 55, 167, 260, 865, 0, 697,
+  225, 197, 237, 635, 691, 506, 617, 58, 900, 913, 1, 203, 226, 962, 0, 0,
+  178, 209, 708, 379, 914, 0, 0, 267, 0, 0, 0, 0, 431, 0, 0, 214,
+  77, 456, 0, 0, 0, 0, 0, 716, 30, 0, 0, 115, 603, 8, 157, 427,
+  794, 808, 903, 413, 938, 0, 0, 334, 181, 451, 516, 98, 440, 0, 0, 0,
+  0, 72, 435, 930, 0, 0, 0, 0, 335, 338, 0, 0, 426, 611, 0, 26,
+  672, 0, 0, 0, 0, 31, 0, 0, 622, 946, 0, 0, 0, 0, 600, 388,
+  117, 0, 0, 0, 0, 0, 767, 0, 0, 0, 0, 0, 363, 615, 0, 893,
+  0, 407, 126, 541, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 333, 0,
+  0, 0, 0, 0, 12, 0, 0, 100, 0, 0, 0, 0, 0, 234, 0, 874,
+  619, 0, 0, 0, 0, 497, 0, 24, 322, 472, 540, 648, 665, 0, 0, 0,
+  0, 0, 485, 275, 0, 153, 271, 0, 7, 0, 124, 405, 887, 980, 0, 711,
+  0, 590, 0, 470, 0, 0, 0, 245, 0, 0, 0, 777, 770, 995, 0, 0,
+  0, 0, 11, 676, 0, 495, 712, 147, 0, 29, 0, 0, 411, 0, 0, 0,
+  0, 0, 804, 114, 46, 307, 943, 0, 0, 0, 0, 0, 927, 0, 967, 0,
+  560, 0, 0, 0, 0, 442, 125, 954, 0, 352, 818, 0, 304, 458, 0, 423,
+  570, 0, 637, 616, 816, 457, 59, 142, 6, 105, 269, 0, 0, 441, 0, 0,
+  0, 0, 89, 0, 0, 0, 95, 0, 0, 523, 263, 170, 812, 400, 259, 0,
+  0, 0, 268, 871, 0, 798, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 566, 0, 0, 0, 934, 0, 605, 293, 909, 373, 406, 240, 0, 0, 0,
+  0, 0, 0, 674, 0, 0, 0, 0, 0, 0, 0, 0, 793, 45, 693, 0,
+  572, 68, 0, 228, 199, 219, 0, 659, 310, 0, 0, 80, 90, 517, 869, 0,
+  0, 0, 0, 932, 466, 0, 0, 0, 0, 722, 705, 469, 309, 843, 0, 382,
+  0, 0, 346, 758, 0, 817, 998, 315, 0, 0, 0, 802, 989, 201, 859, 92,
+  0, 554, 0, 381, 0, 0, 702, 78, 345, 464, 520, 94, 164, 858, 0, 0,
+  2, 453, 834, 561, 0, 20, 264, 0, 831, 0, 0, 990, 0, 0, 510, 0,
+  685, 0, 41, 0, 963, 0, 0, 0, 0, 289, 0, 370, 0, 0, 0, 0,
+  0, 0, 0, 74, 479, 0, 0, 0, 0, 0, 0, 0, 933, 592, 0, 0,
+  0, 0, 0, 0, 0, 945, 0, 0, 0, 88, 385, 719, 860, 374, 0, 207,
+  256, 449, 699, 679, 701, 447, 790, 0, 757, 873, 776, 827, 0, 0, 0, 316,
+  262, 0, 700, 0, 0, 0, 0, 0, 0, 609, 644, 154, 710, 0, 0, 941,
+  0, 0, 0, 0, 0, 670, 0, 0, 0, 614, 658, 739, 486, 866, 792, 922,
+  0, 992, 0, 0, 0, 0, 633, 910, 0, 206, 526, 438, 281, 536, 854, 0,
+  0, 0, 769, 0, 0, 0, 797, 179, 0, 844, 0, 217, 0, 0, 221, 511,
+  0, 0, 358, 845, 0, 0, 0, 408, 99, 318, 628, 0, 0, 596, 276, 999,
+  0, 223, 0, 0, 131, 0, 454, 889, 412, 897, 599, 955, 175, 643, 367, 0,
+  0, 0, 0, 0, 66, 393, 760, 337, 85, 885, 928, 283, 285, 0, 0, 0,
+  0, 0, 0, 0, 204, 784, 0, 0, 0, 0, 0, 647, 584, 0, 0, 870,
+  531, 156, 113, 391, 21, 924, 985, 598, 0, 0, 331, 0, 583, 0, 0, 0,
+  0, 475, 499, 782, 879, 36, 937, 915, 34, 403, 0, 0, 0, 0, 261, 377,
+  0, 746, 0, 368, 0, 0, 765, 884, 323, 624, 106, 906, 0, 0, 0, 0,
+  0, 0, 151, 404, 0, 738, 233, 0, 0, 301, 689, 588, 959, 395, 953, 0,
+  0, 0, 773, 410, 931, 559, 0, 0, 302, 574, 0, 0, 0, 508, 0, 0,
+  0, 926, 0, 118, 904, 0, 0, 0, 548, 0, 398, 0, 0, 753, 918, 0,
+  49, 856, 294, 0, 0, 0, 634, 286, 0, 0, 920, 0, 195, 787, 754, 591,
+  815, 994, 0, 0, 37, 763, 894, 198, 781, 327, 535, 277, 0, 0, 0, 0,
+  235, 0, 0, 0, 0, 324, 0, 0, 547, 0, 229, 0, 329, 720, 491, 935,
+  929, 25, 360, 279, 522, 825, 0, 833, 878, 0, 0, 236, 306, 0, 0, 312,
+  546, 810, 0, 70, 0, 0, 0, 419, 846, 0, 0, 0, 965, 474, 0, 0,
+  0, 0, 0, 0, 0, 73, 354, 785, 0, 608, 0, 287, 706, 0, 661, 439,
+  852, 168, 158, 489, 86, 527, 951, 690, 632, 972, 514, 983, 886, 445, 0, 823,
+  0, 801, 0, 0, 862, 0, 0, 161, 0, 0, 0, 0, 0, 0, 328, 640,
+  970, 0, 0, 428, 664, 0, 822, 0, 0, 952, 0, 0, 0, 0, 0, 799,
+  759, 402, 0, 652, 0, 0, 766, 0, 0, 0, 0, 299, 0, 0, 0, 0,
+  0, 71, 166, 280, 734, 0, 0, 344, 602, 0, 0, 0, 0, 274, 0, 0,
+  22, 193, 0, 0, 0, 184, 224, 0, 0, 0, 23, 0, 0, 0, 774, 0,
+  515, 0, 79, 824, 0, 300, 0, 0, 0, 626, 864, 0, 0, 163, 212, 551,
+  606, 733, 383, 10, 877, 0, 504, 138, 669, 202, 215, 342, 0, 528, 662, 0,
+  0, 0, 32, 673, 0, 0, 969, 581, 380, 0, 0, 0, 0, 0, 0, 982,
+  0, 0, 0, 727, 0, 250, 0, 0, 0, 737, 850, 0, 97, 0, 0, 375,
+  695, 806, 0, 0, 247, 0, 968, 0, 0, 133, 895, 564, 0, 0, 0, 0,
+  0, 4, 0, 0, 361, 0, 343, 841, 162, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 891, 715, 0, 0, 0, 0, 266, 0, 0,
+  330, 667, 93, 155, 723, 740, 19, 0, 211, 0, 0, 171, 362, 231, 593, 899,
+  0, 0, 0, 0, 220, 726, 0, 129, 961, 40, 0, 681, 0, 0, 0, 0,
+  0, 853, 0, 0, 0, 270, 692, 0, 0, 0, 0, 87, 654, 0, 601, 631,
+  430, 0, 132, 0, 0, 0, 0, 249, 468, 0, 69, 141, 826, 567, 0, 0,
+  389, 0, 645, 0, 0, 744, 0, 0, 462, 471, 0, 0, 0, 371, 0, 732,
+  0, 0, 0, 0, 0, 863, 0, 888, 742, 0, 253, 585, 562, 417, 103, 251,
+  919, 0, 0, 0, 122, 0, 0, 0, 0, 284, 50, 0, 0, 0, 0, 0,
+  0, 359, 0, 0, 0, 282, 0, 0, 0, 493, 0, 925, 0, 0, 0, 0,
+  291, 351, 366, 984, 0, 0, 0, 0, 778, 38, 82, 101, 0, 549, 244, 587,
+  0, 0, 416, 255, 683, 736, 353, 752, 789, 830, 768, 424, 876, 0, 0, 54,
+  755, 0, 0, 678, 392, 0, 571, 814, 432, 0, 0, 898, 0, 144, 0, 0,
+  0, 0, 0, 500, 0, 0, 518, 81, 0, 83, 0, 618, 0, 0, 0, 0,
+  0, 0, 556, 0, 820, 0, 0, 0, 0, 687, 835, 0, 0, 558, 639, 0,
+  0, 186, 0, 365, 979, 0, 578, 694, 17, 0, 0, 0, 0, 729, 0, 258,
+  0, 0, 0, 0, 0, 437, 288, 0, 0, 63, 542, 881, 0, 0, 0, 216,
+  655, 104, 861, 0, 544, 991, 480, 0, 35, 901, 0, 0, 187, 356, 44, 183,
+  230, 0, 473, 0, 0, 0, 731, 33, 916, 0, 65, 0, 519, 595, 975, 159,
+  0, 0, 0, 418, 0, 0, 0, 1000, 0, 347, 0, 0, 0, 0, 743, 513,
+  196, 800, 0, 0, 448, 61, 529, 0, 414, 0, 0, 0, 62, 604, 966, 890,
+  0, 0, 311, 936, 0, 0, 0, 0, 0, 443, 483, 0, 0, 950, 0, 107,
+  0, 0, 0, 0, 0, 421, 981, 840, 222, 248, 0, 102, 0, 882, 0, 0,
+  612, 0, 53, 0, 0, 91, 0, 0, 0, 0, 0, 629, 0, 0, 213, 0,
+  610, 134, 940, 246, 0, 761, 0, 0, 0, 0, 0, 96, 265, 0, 190, 838,
+  848, 892, 0, 0, 390, 75, 111, 855, 188, 425, 807, 813, 978, 0, 0, 0,
+  0, 0, 140, 174, 977, 0, 623, 314, 444, 0, 477, 0, 488, 883, 0, 725,
+  0, 0, 0, 200, 0, 0, 0, 0, 646, 0, 849, 0, 0, 0, 0, 921,
+  0, 728, 0, 650, 0, 666, 0, 0, 0, 15, 0, 0, 0, 947, 0, 0,
+  0, 465, 482, 875, 0, 0, 796, 218, 555, 0, 837, 0, 177, 487, 0, 907,
+  671, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 357, 0, 0, 0, 530,
+  0, 0, 135, 0, 52, 399, 917, 238, 0, 976, 534, 0, 656, 0, 165, 292,
+  505, 0, 0, 0, 109, 839, 641, 747, 911, 703, 996, 0, 0, 0, 0, 0,
+  832, 0, 0, 446, 0, 0, 748, 0, 42, 0, 290, 18, 169, 0, 821, 0,
+  537, 942, 557, 613, 0, 0, 775, 149, 741, 0, 0, 0, 0, 997, 0, 308,
+  0, 0, 0, 0, 749, 0, 0, 0, 28, 576, 569, 819, 130, 401, 509, 680,
+  986, 686, 0, 160, 0, 0, 319, 0, 0, 0, 0, 0, 0, 180, 369, 348,
+  565, 0, 0, 0, 0, 185, 868, 771, 786, 0, 0, 272, 709, 0, 0, 0,
+  496, 651, 313, 320, 241, 386, 257, 145, 420, 39, 127, 533, 5, 780, 923, 232,
+  0, 463, 0, 956, 0, 3, 0, 0, 481, 128, 0, 0, 0, 0, 0, 502,
+  751, 842, 0, 0, 0, 0, 0, 0, 27, 0, 0, 295, 525, 621, 682, 0,
+  0, 137, 0, 580, 0, 0, 0, 0, 993, 872, 636, 0, 326, 0, 0, 0,
+  0, 677, 0, 0, 0, 0, 273, 339, 713, 182, 0, 0, 964, 0, 146, 278,
+  944, 0, 0, 0, 490, 642, 0, 60, 349, 552, 653, 905, 973, 912, 987, 791,
+  0, 0, 0, 116, 0, 0, 64, 152, 764, 0, 0, 0, 0, 0, 0, 0,
+  0, 298, 0, 56, 476, 0, 48, 0, 0, 0, 579, 0, 0, 0, 0, 696,
+  0, 660, 0, 0, 0, 0, 243, 0, 0, 0, 0, 0, 0, 896, 0, 0,
+  0, 0, 0, 0, 0, 0, 459, 0, 0, 455, 191, 668, 43, 730, 586, 0,
+  492, 563, 120, 0, 0, 0, 0, 974, 205, 119, 110, 387, 0, 0, 0, 0,
+  575, 0, 657, 0, 0, 112, 0, 296, 0, 779, 538, 0, 494, 143, 325, 0,
+  227, 0, 0, 210, 0, 136, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 376, 0, 0, 297, 341, 795, 597, 409, 0, 394, 0, 0, 14, 0, 0,
+  150, 550, 553, 948, 957, 0, 0, 305, 809, 0, 717, 317, 378, 539, 254, 745,
+  939, 176, 949, 0, 638, 0, 0, 0, 0, 960, 0, 0, 721, 594, 422, 0,
+  0, 0, 355, 0, 0, 415, 0, 0, 0, 0, 0, 208, 783, 0, 0, 0,
+  908, 0, 0, 0, 467, 51, 0, 0, 0, 545, 252, 607, 675, 704, 958, 0,
+  0, 0, 0, 47, 0, 0, 0, 0, 805, 0, 0, 0, 429, 0, 340, 498,
+  194, 811, 851, 396, 0, 0, 0, 123, 543, 303, 573, 582, 718, 772, 521, 836,
+  0, 0, 0, 503, 577, 663, 971, 16, 0, 750, 0, 0, 0, 0, 76, 0,
+  0, 364, 460, 0, 0, 0, 0, 336, 0, 0, 0, 589, 9, 148, 0, 0,
+  0, 0, 67, 57, 0, 0, 507, 880, 0, 524, 0, 384, 0, 0, 332, 762,
+};
+
+const char *WA_FREQ_23_TOKENS[] = {
+  "ni",
+  "nga",
+  "sa",
+  "maoy",
+  "kaliwatan",
+  "gihulagway",
+  "adtong",
+  "una",
+  "insekto",
+  "langaw",
+  "ug",
+  "bakukang",
+  "kaka",
+  "tanom",
+  "alasiwsiw",
+  "alibangbang",
+  "krustaseo",
+  "mga",
+  "isda",
+  "ang",
+  "buyog",
+  "asparagos",
+  "von",
+  "ulod",
+  "ka",
+  "Alexander",
+  "John",
+  "tungaw",
+  "William",
+  "holmigas",
+  "langgam",
+  "henero",
+  "tiladtilad",
+  "singsing",
+  "ngalan",
+  "hilahila",
+  "gihatagan",
+  "eksakto",
+  "Stefan",
+  "Thomas",
+  "Wilhelm",
+  "Breuning",
+  "mananap",
+  "Walker",
+  "Henry",
+  "banaog",
+  "Friedrich",
+  "Carl",
+  "1994",
+  "bulak",
+  "L.",
+  "1983",
+  "1998",
+  "1993",
+  "2004",
+  "1988",
+  "de",
+  "Hermann",
+  "1991",
+  "2000",
+  "1911",
+  "niini",
+  "1987",
+  "1908",
+  "D.",
+  "1992",
+  "1981",
+  "1965",
+  "kagaangan",
+  "1910",
+  "1995",
+  "2003",
+  "Heinrich",
+  "Edward",
+  "1990",
+  "1979",
+  "1938",
+  "1968",
+  "A.",
+  "1927",
+  "Johann",
+  "1984",
+  "baki",
+  "matang",
+  "2002",
+  "1999",
+  "1971",
+  "1986",
+  "reptil",
+  "1997",
+  "1915",
+  "1980",
+  "1964",
+  "1985",
+  "alindanaw",
+  "Ang",
+  "1978",
+  "1989",
+  "2006",
+  "1977",
+  "1924",
+  "J.",
+  "1967",
+  "1974",
+  "atong",
+  "1970",
+  "2005",
+  "1907",
+  "1906",
+  "Joseph",
+  "George",
+  "1962",
+  "1969",
+  "1996",
+  "1972",
+  "1982",
+  "1926",
+  "1936",
+  "lumot",
+  "M.",
+  "Smith",
+  "1934",
+  "1973",
+  "2007",
+  "sisi",
+  "Usa",
+  "1935",
+  "1960",
+  "1925",
+  "1939",
+  "Charles",
+  "1922",
+  "1929",
+  "og",
+  "1928",
+  "makita",
+  "2001",
+  "1961",
+  "1914",
+  "nahiubos",
+  "1902",
+  "na",
+  "iyang",
+  "1956",
+  "James",
+  "usa",
+  "1905",
+  "uk-ok",
+  "1959",
+  "1975",
+  "Simon",
+  "1913",
+  "1923",
+  "E.",
+  "1932",
+  "1963",
+  "1937",
+  "Louis",
+  "Christian",
+  "1904",
+  "ripolyo",
+  "1901",
+  "1903",
+  "1895",
+  "1976",
+  "S.",
+  "1921",
+  "1898",
+  "1957",
+  "1966",
+  "1941",
+  "W.",
+  "1917",
+  "1951",
+  "Jean",
+  "1955",
+  "Van",
+  "1954",
+  "1952",
+  "1953",
+  "Robert",
+  "1912",
+  "si",
+  "Karl",
+  "1900",
+  "1897",
+  "Cockerell",
+  "1940",
+  "R.",
+  "Pierre",
+  "uhong",
+  "1909",
+  "Ludwig",
+  "1918",
+  "1931",
+  "Henri",
+  "1899",
+  "1896",
+  "2008",
+  "1950",
+  "1894",
+  "dagat",
+  "1919",
+  "Günther",
+  "G.",
+  "1916",
+  "1930",
+  "C.",
+  "Meyrick",
+  "1958",
+  "Yang",
+  "F.",
+  "1933",
+  "1878",
+  "Peter",
+  "Paul",
+  "Gilbert",
+  "bitin",
+  "1889",
+  "Jean-Jacques",
+  "Kieffer",
+  "aluhipan",
+  "Chamberlin",
+  "1888",
+  "Albert",
+  "1863",
+  "Jr.",
+  "Francis",
+  "Linnaeus",
+  "1887",
+  "I.",
+  "Loew",
+  "Frederick",
+  "Maurice",
+  "1891",
+  "Fabricius",
+  "bayingbaying",
+  "De",
+  "1892",
+  "1890",
+  "1920",
+  "Rudolph",
+  "Edwards",
+  "Girault",
+  "1885",
+  "1942",
+  "bulí",
+  "mao",
+  "Georg",
+  "1838",
+  "1944",
+  "Saussure",
+  "Malloch",
+  "1865",
+  "1886",
+  "Cameron",
+  "1947",
+  "Onthophagus",
+  "Tipula",
+  "1868",
+  "Daniel",
+  "1858",
+  "1948",
+  "Thomson",
+  "1851",
+  "H.",
+  "1869",
+  "1943",
+  "1949",
+  "Gustav",
+  "Wang",
+  "1864",
+  "1882",
+  "Chen",
+  "Hans",
+  "1946",
+  "1758",
+  "David",
+  "Martin",
+  "Harris",
+  "Delong",
+  "Macquart",
+  "1859",
+  "1877",
+  "Bates",
+  "Lucas",
+  "1945",
+  "ukab-ukab",
+  "Arthur",
+  "2009",
+  "Moser",
+  "1830",
+  "O.",
+  "bakaybakay",
+  "1862",
+  "Hardy",
+  "Leconte",
+  "1893",
+  "1861",
+  "François",
+  "bituon",
+  "och",
+  "kini",
+  "Auguste",
+  "Fischer",
+  "pulgas",
+  "Mary",
+  "1855",
+  "mangungutkut",
+  "Ian",
+  "1857",
+  "in",
+  "Victor",
+  "1875",
+  "siya",
+  "niadtong",
+  "Becker",
+  "Boris",
+  "Baker",
+  "1853",
+  "Cresson",
+  "Casey",
+  "1846",
+  "1872",
+  "1852",
+  "Johannes",
+  "1871",
+  "Schmidt",
+  "1860",
+  "Bulbophyllum",
+  "pa",
+  "1873",
+  "Emery",
+  "1874",
+  "Verhoeff",
+  "Katherine",
+  "Curran",
+  "Franz",
+  "ilang",
+  "Frey",
+  "B.",
+  "Julius",
+  "Auguste-Henri",
+  "Forel",
+  "Martins",
+  "1866",
+  "August",
+  "Richard",
+  "P.",
+  "Leon",
+  "Meigen",
+  "1842",
+  "Alan",
+  "Brown",
+  "Banks",
+  "Lucien",
+  "liryo",
+  "Ronald",
+  "1849",
+  "Simulium",
+  "Otte",
+  "1850",
+  "Ashmead",
+  "Zhang",
+  "lingin",
+  "Fairmaire",
+  "Ernst",
+  "Mario",
+  "1867",
+  "Theodor",
+  "Mahunka",
+  "Sandór",
+  "Distant",
+  "Kini",
+  "Drosophila",
+  "1881",
+  "Gauld",
+  "Philip",
+  "Megachile",
+  "1879",
+  "Say",
+  "1883",
+  "Andrena",
+  "Tobias",
+  "Dall",
+  "Keith",
+  "Michael",
+  "Koch",
+  "Robineau-desvoidy",
+  "Lasioglossum",
+  "Strand",
+  "1856",
+  "1847",
+  "Jordan",
+  "Wiedemann",
+  "Martha",
+  "Schmid",
+  "Scott",
+  "Duzee",
+  "Bezzi",
+  "1834",
+  "1839",
+  "Brunner",
+  "Harold",
+  "1854",
+  "kay",
+  "1880",
+  "human",
+  "Maria",
+  "Megaselia",
+  "Platnick",
+  "Wattenwyl",
+  "Graf",
+  "1844",
+  "kinhason",
+  "Li",
+  "Lewis",
+  "Edgar",
+  "Samuel",
+  "Schltr",
+  "usab",
+  "1884",
+  "Sharp",
+  "Dworakowska",
+  "Tabanus",
+  "Irena",
+  "Norman",
+  "Attems",
+  "Marie",
+  "dakbayan",
+  "1848",
+  "Spencer",
+  "Otto",
+  "Carlo",
+  "Burmeister",
+  "Townes",
+  "Allen",
+  "Knight",
+  "Chopard",
+  "et",
+  "Enderlein",
+  "K.",
+  "Gordon",
+  "1835",
+  "Forster",
+  "Leonard",
+  "Boulenger",
+  "Ohaus",
+  "Blanchard",
+  "Navás",
+  "maong",
+  "Werner",
+  "1840",
+  "Sa",
+  "Oliver",
+  "gracilis",
+  "Adolf",
+  "1829",
+  "Pascoe",
+  "Polkinghorne",
+  "van",
+  "Culicoides",
+  "Linnavuori",
+  "Rauno",
+  "Wu",
+  "Ross",
+  "Wheeler",
+  "Wirth",
+  "Perkins",
+  "gikan",
+  "Gray",
+  "Friese",
+  "1870",
+  "Alfred",
+  "Melichar",
+  "Gupta",
+  "Pic",
+  "Borgmeier",
+  "dili",
+  "Linsley",
+  "mamipero",
+  "Z.",
+  "Andrey",
+  "Dasch",
+  "Malicky",
+  "Anomala",
+  "Thorell",
+  "1843",
+  "Clark",
+  "Townsend",
+  "Stål",
+  "Porter",
+  "Max",
+  "Young",
+  "1841",
+  "Matsumura",
+  "P.-cambridge",
+  "Hugo",
+  "Soika",
+  "Si",
+  "Zheng",
+  "Giordani",
+  "Willis",
+  "Hampson",
+  "1837",
+  "Antoine",
+  "Donald",
+  "Balogh",
+  "Augustus",
+  "Opius",
+  "Baptiste",
+  "Mitchell",
+  "Westwood",
+  "Hale",
+  "1824",
+  "Marius",
+  "Obadiah",
+  "Gorochov",
+  "1833",
+  "1876",
+  "Vasil'evich",
+  "Rehn",
+  "Aurivillius",
+  "Descamps",
+  "Walter",
+  "Hendel",
+  "Zetterstedt",
+  "Papp",
+  "Williams",
+  "N.",
+  "bicolor",
+  "Mason",
+  "Coquillett",
+  "aron",
+  "Nicholas",
+  "Holzschuh",
+  "René",
+  "Bolívar",
+  "Liu",
+  "1845",
+  "Ferdinand",
+  "Wilson",
+  "similis",
+  "André",
+  "Gertsch",
+  "tuig",
+  "Elix",
+  "Apanteles",
+  "Karsch",
+  "Arrow",
+  "lang",
+  "Flint",
+  "elegans",
+  "Christoph",
+  "Turner",
+  "sila",
+  "Sergey",
+  "Molophilus",
+  "Belokobylskij",
+  "Timberlake",
+  "Morgan",
+  "Marshall",
+  "Camponotus",
+  "Sarcophaga",
+  "may",
+  "Barnard",
+  "Anne",
+  "tawo",
+  "Forcipomyia",
+  "Axel",
+  "Sars",
+  "Filippo",
+  "Hebard",
+  "Sugbo",
+  "Octave",
+  "Aedes",
+  "2010",
+  "Parent",
+  "Cebu",
+  "Vladimir",
+  "Silvestri",
+  "Oswald",
+  "Evans",
+  "Lévi",
+  "Godfrey",
+  "Dendrobium",
+  "tungod",
+  "ngadto",
+  "Gahan",
+  "Muir",
+  "Jacobus",
+  "Fisher",
+  "White",
+  "kulaknit",
+  "duha",
+  "ning",
+  "Miller",
+  "Félix",
+  "Galileo",
+  "Wulp",
+  "Helena",
+  "Allium",
+  "kon",
+  "Barangay",
+  "o",
+  "Hammer",
+  "Müller",
+  "Redtenbacher",
+  "siyudad",
+  "1836",
+  "Ellsworth",
+  "Ephraim",
+  "Szepligeti",
+  "orientalis",
+  "Dicranomyia",
+  "wala",
+  "Ichneumon",
+  "Stein",
+  "Mello-leitao",
+  "of",
+  "Nielson",
+  "Pocock",
+  "T.",
+  "alas",
+  "Henrik",
+  "Fennah",
+  "man",
+  "Roger",
+  "Antonio",
+  "Bigot",
+  "Jacques-Marie-Frangile",
+  "1832",
+  "Chelonus",
+  "apan",
+  "Anthurium",
+  "Theodore",
+  "karon",
+  "Felt",
+  "australis",
+  "ubi",
+  "Jules",
+  "Melander",
+  "alang",
+  "Cook",
+  "Miklós",
+  "Keyserling",
+  "Douglas",
+  "Gravenhorst",
+  "minor",
+  "Phyllophaga",
+  "Brenske",
+  "didto",
+  "Bracon",
+  "Petrovich",
+  "hukal",
+  "Culex",
+  "garapata",
+  "Empis",
+  "Hall",
+  "Maximilian",
+  "Josef",
+  "Fritz",
+  "Lyman",
+  "Pterolophia",
+  "Fedotova",
+  "Lane",
+  "Meijere",
+  "affinis",
+  "Gmelin",
+  "Erich",
+  "Alexandre",
+  "lungsod",
+  "Xanthoparmelia",
+  "Achterberg",
+  "Conrad",
+  "simplex",
+  "City",
+  "Adrien",
+  "Pedro",
+  "Gressitt",
+  "Hesse",
+  "Moore",
+  "Reinhard",
+  "Enrico",
+  "Clinton",
+  "Bernard",
+  "biktima",
+  "Mesnil",
+  "Nixon",
+  "Peters",
+  "Linné",
+  "Achille",
+  "Emile",
+  "Pandanus",
+  "Blackburn",
+  "Hering",
+  "1775",
+  "Zhu",
+  "Randall",
+  "Peckham",
+  "1823",
+  "Adelelmo",
+  "Brunetti",
+  "Stephen",
+  "Mycetophila",
+  "wa",
+  "Santschi",
+  "Roewer",
+  "Nina",
+  "Reichenbach",
+  "1818",
+  "Karny",
+  "Richards",
+  "Philippi",
+  "He",
+  "Lindley",
+  "Nomada",
+  "Brues",
+  "minuta",
+  "Rothschild",
+  "hayop",
+  "Paulian",
+  "Huang",
+  "isip",
+  "Rudolf",
+  "Mesochorus",
+  "Uchida",
+  "Boucek",
+  "Lee",
+  "Empoasca",
+  "Duda",
+  "Andrew",
+  "Lawrence",
+  "Pieter",
+  "sabwag",
+  "Caporiacco",
+  "Lambert",
+  "Erichson",
+  "Selys",
+  "Hydraena",
+  "Kimmins",
+  "Johnson",
+  "Fowler",
+  "Giglio-tos",
+  "Péringuey",
+  "Olivier",
+  "niya",
+  "Enicospilus",
+  "Renaud",
+  "kagahapon",
+  "di",
+  "Uvarov",
+  "Warren",
+  "Anton",
+  "Wendell",
+  "Apan",
+  "Hamilton",
+  "Rhyacophila",
+  "Curtis",
+  "Lea",
+  "nigra",
+  "Jan",
+  "Mayr",
+  "Collin",
+  "Quate",
+  "J.A.G.",
+  "Dmitriy",
+  "Taylor",
+  "Theischinger",
+  "Tohru",
+  "Eduard",
+  "Mcalpine",
+  "Williston",
+  "Paramonov",
+  "Perdita",
+  "Felix",
+  "Michel",
+  "Schmitz",
+  "dihang",
+  "Freytag",
+  "Lallemand",
+  "Tokunaga",
+  "Fall",
+  "1789",
+  "1828",
+  "occidentalis",
+  "insularis",
+  "1820",
+  "Hansson",
+  "Patrick",
+  "Yin",
+  "Ossian",
+  "Phaonia",
+  "Dolichopus",
+  "Johan",
+  "Araneus",
+  "maculata",
+  "Noyes",
+  "Costa",
+  "Davao",
+  "kang",
+  "Gabriel",
+  "Eurytoma",
+  "Glenea",
+  "Levi",
+  "Lieftinck",
+  "Maurits",
+  "Disney",
+  "Niedbala",
+  "Verrill",
+  "Rhamphomyia",
+  "Sasa",
+  "Mamaev",
+  "uban",
+  "Fuller",
+  "Wojciech",
+  "1826",
+  "Hylaeus",
+  "Petrovitz",
+  "1825",
+  "Balthasar",
+  "1831",
+  "Bruce",
+  "Dioscorea",
+  "Mohrig",
+  "Wagner",
+  "Fraser",
+  "Beccari",
+  "Goldblatt",
+  "Odoardo",
+  "Marseul",
+  "Engler",
+  "Zaitzev",
+  "Horn",
+  "Sylvain",
+  "Theridion",
+  "gyud",
+  "Frank",
+  "Claude",
+  "Gould",
+  "Helina",
+  "la",
+  "Bartsch",
+  "Dyar",
+  "Koehler",
+  "nasod",
+  "Phytomyza",
+  "Osten",
+  "Kirby",
+  "Sacken",
+  "Xu",
+  "Leo",
+  "Mosely",
+  "Jones",
+  "V.",
+  "Gonomyia",
+  "D'orbigny",
+  "Ridley",
+  "Carlos",
+  "Ole",
+  "Ravenna",
+  "1822",
+  "Félice",
+  "Narendran",
+  "Pierfelice",
+  "Robinson",
+  "Chironomus",
+  "Holmgren",
+  "Kirkaldy",
+  "Watson",
+  "Ball",
+  "Camillo",
+  "Hull",
+  "Homoneura",
+  "Jason",
+  "adunay",
+  "sab",
+  "Heller",
+  "hok",
+  "A.M.Lopes",
+  "Butler",
+  "Guilherme",
+  "Kolbe",
+  "Temminck",
+  "kining",
+  "Seguy",
+  "pagi",
+  "Pheidole",
+  "Rondani",
+  "Roth",
+  "Roy",
+  "robusta",
+  "Haematopota",
+  "Yu",
+  "Loïc",
+  "Matile",
+  "Hubert",
+  "T.C.",
+  "Okada",
+  "Perez-gelabert",
+  "Song",
+  "apicalis",
+  "uhipan",
+  "Freeman",
+  "Villeneuve",
+  "Grootaert",
+  "Kasparyan",
+  "Lorenz",
+  "Pilsbry",
+  "Yves",
+  "Philipp",
+  "Sasakawa",
+  "2011",
+  "Dlabola",
+  "Mitsuhiro",
+  "Aldrich",
+  "Chimarra",
+  "Ivie",
+  "elongata",
+  "intermedia",
+  "Aubert",
+  "Giovanni",
+  "Edmund",
+  "Green",
+  "Beier",
+  "SuperBalita",
+  "Vachal",
+  "grandis",
+  "tabili",
+  "Ignaz",
+  "Mark",
+  "Platypalpus",
+  "Brian",
+  "Gerstaecker",
+  "Millidge",
+  "diin",
+  "Risbec",
+  "Bickel",
+  "Raymond",
+  "samtang",
+  "1804",
+  "Bactrocera",
+  "Graham",
+  "Krober",
+  "Carpenter",
+  "Pardosa",
+  "bahin",
+  "Howden",
+  "Howard",
+  "Hayden",
+  "Meyer",
+  "Bradysia",
+  "capensis",
+  "Hippa",
+  "Jacobi",
+  "Londt",
+  "anak",
+  "Al-shehbaz",
+  "montana",
+  "Croat",
+  "Davis",
+  "Edmond",
+  "Mikhail",
+  "Strobl",
+  "Wells",
+  "pallida",
+  "nukos",
+  "Cagayan",
+  "Viereck",
+  "Osborn",
+  "gabii",
+  "major",
+  "Fairfield",
+  "unicolor",
+  "Ahrens",
+  "Powell",
+  "Addison",
+  "japonica",
+  "obscura",
+  "Reitter",
+  "Warncke",
+  "Jean-Baptiste",
+  "Oro",
+  "Anopheles",
+  "Coelioxys",
+  "kaayo",
+  "Mclachlan",
+  "Baehr",
+  "kinsa",
+  "Sybra",
+  "Toyohi",
+  "Dasyhelea",
+  "Morawitz",
+  "Chemsak",
+  "Santos",
+  "Frederik",
+  "1817",
+  "Hancock",
+  "1790",
+  "Jacques",
+};
+const uint16_t WA_FREQ_23_RANKS[] = {
+  926, 999, 280, 0, 0, 0, 0, 970, 493, 0, 319, 223, 0, 0, 24, 617,
+  6, 346, 410, 841, 853, 0, 0, 0, 845, 291, 0, 759, 376, 0, 0, 120,
+  92, 182, 407, 0, 0, 925, 0, 0, 849, 0, 507, 714, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 769, 0, 671, 909, 181, 762, 70, 131, 380, 624,
+  861, 152, 945, 0, 0, 0, 626, 0, 879, 0, 0, 910, 0, 548, 0, 0,
+  0, 0, 622, 0, 503, 608, 0, 0, 789, 240, 672, 0, 0, 91, 450, 0,
+  0, 509, 578, 0, 0, 798, 0, 895, 0, 0, 0, 504, 601, 615, 843, 0,
+  0, 0, 0, 0, 17, 0, 0, 455, 565, 767, 0, 0, 0, 0, 0, 0,
+  231, 0, 0, 0, 0, 0, 780, 0, 0, 886, 718, 880, 594, 722, 484, 0,
+  0, 435, 473, 696, 0, 0, 0, 0, 0, 256, 0, 0, 0, 0, 0, 0,
+  0, 891, 593, 0, 505, 944, 0, 0, 0, 360, 634, 0, 0, 0, 0, 422,
+  0, 545, 666, 0, 662, 160, 0, 564, 761, 72, 241, 0, 334, 562, 373, 387,
+  401, 531, 52, 61, 577, 856, 866, 0, 20, 873, 0, 950, 0, 0, 0, 0,
+  0, 268, 371, 639, 488, 942, 977, 0, 0, 558, 0, 0, 5, 0, 0, 528,
+  0, 0, 0, 203, 775, 0, 0, 979, 389, 851, 0, 621, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 560, 289, 635, 188, 717, 0, 211, 212, 0, 0,
+  0, 625, 0, 0, 0, 35, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 557, 0, 0, 252, 0, 566, 0, 282, 196, 377, 0, 0, 65,
+  0, 0, 707, 178, 301, 0, 758, 226, 151, 931, 0, 0, 0, 0, 0, 0,
+  0, 0, 244, 349, 0, 820, 0, 632, 0, 679, 935, 963, 706, 0, 0, 0,
+  0, 0, 0, 0, 412, 235, 0, 837, 0, 0, 921, 969, 0, 397, 330, 0,
+  307, 165, 184, 812, 883, 732, 948, 49, 638, 47, 246, 10, 0, 22, 549, 0,
+  50, 0, 0, 0, 670, 45, 0, 0, 477, 573, 574, 0, 713, 933, 0, 0,
+  538, 155, 0, 741, 0, 0, 0, 0, 123, 0, 0, 0, 0, 0, 66, 0,
+  0, 0, 0, 522, 725, 174, 383, 461, 829, 959, 0, 0, 0, 327, 785, 946,
+  12, 0, 0, 0, 0, 971, 0, 426, 339, 442, 0, 0, 755, 937, 0, 643,
+  0, 938, 0, 0, 826, 0, 0, 0, 0, 0, 0, 902, 692, 899, 336, 0,
+  0, 316, 463, 586, 800, 199, 134, 288, 421, 0, 602, 368, 0, 179, 943, 431,
+  0, 598, 618, 0, 0, 227, 0, 0, 0, 0, 0, 0, 124, 409, 788, 749,
+  444, 0, 355, 833, 689, 765, 9, 425, 814, 439, 146, 265, 103, 350, 559, 805,
+  112, 0, 0, 0, 0, 0, 862, 848, 0, 727, 0, 0, 365, 433, 647, 0,
+  0, 337, 271, 0, 0, 392, 331, 486, 645, 736, 294, 2, 575, 870, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 406, 597, 653, 797, 7, 297, 968, 149,
+  0, 0, 0, 0, 0, 0, 266, 394, 793, 382, 939, 0, 59, 248, 0, 0,
+  0, 0, 0, 140, 556, 0, 815, 0, 81, 854, 19, 0, 395, 0, 0, 0,
+  988, 0, 0, 0, 0, 0, 0, 847, 877, 308, 583, 0, 0, 0, 258, 0,
+  0, 495, 0, 0, 341, 0, 225, 0, 0, 0, 0, 37, 0, 0, 192, 953,
+  912, 0, 0, 631, 205, 889, 984, 0, 0, 592, 141, 242, 857, 232, 0, 0,
+  0, 0, 0, 0, 0, 452, 704, 770, 920, 665, 0, 0, 388, 646, 0, 0,
+  0, 901, 997, 0, 0, 0, 733, 324, 0, 0, 0, 0, 0, 0, 0, 985,
+  0, 0, 0, 224, 0, 0, 335, 0, 0, 71, 0, 404, 581, 177, 512, 0,
+  0, 273, 0, 0, 0, 0, 14, 44, 534, 541, 0, 0, 748, 973, 0, 791,
+  738, 362, 792, 323, 142, 361, 462, 720, 838, 966, 0, 604, 0, 272, 479, 776,
+  0, 0, 0, 0, 0, 978, 763, 554, 683, 0, 734, 961, 998, 470, 627, 905,
+  0, 691, 304, 567, 980, 0, 0, 825, 965, 243, 929, 262, 0, 0, 772, 33,
+  254, 472, 774, 958, 0, 0, 0, 0, 317, 475, 795, 58, 0, 532, 21, 0,
+  27, 996, 0, 94, 0, 68, 510, 0, 0, 469, 0, 274, 521, 893, 517, 0,
+  118, 496, 0, 0, 949, 0, 0, 0, 0, 0, 0, 32, 0, 0, 0, 936,
+  132, 217, 698, 0, 0, 77, 0, 675, 0, 0, 0, 0, 0, 0, 0, 478,
+  357, 0, 0, 26, 0, 464, 0, 676, 0, 0, 0, 0, 121, 300, 0, 0,
+  852, 43, 605, 751, 0, 176, 0, 663, 285, 0, 0, 0, 0, 0, 0, 0,
+  0, 457, 711, 0, 0, 816, 0, 0, 0, 34, 0, 0, 0, 379, 591, 0,
+  863, 0, 0, 0, 0, 0, 0, 0, 745, 806, 0, 0, 0, 0, 0, 606,
+  0, 159, 518, 831, 884, 0, 0, 0, 874, 267, 513, 0, 0, 0, 0, 0,
+  144, 667, 786, 0, 451, 481, 220, 855, 391, 0, 320, 697, 0, 0, 0, 396,
+  898, 0, 345, 0, 309, 661, 0, 0, 0, 0, 0, 964, 0, 0, 115, 0,
+  440, 908, 0, 0, 0, 0, 0, 0, 794, 0, 0, 0, 539, 293, 0, 105,
+  0, 609, 311, 906, 41, 418, 437, 0, 0, 896, 0, 0, 649, 0, 0, 0,
+  237, 261, 731, 0, 0, 724, 0, 754, 0, 0, 0, 0, 0, 333, 0, 0,
+  0, 0, 0, 0, 0, 185, 0, 347, 657, 0, 0, 95, 599, 0, 0, 0,
+  74, 839, 60, 321, 0, 927, 967, 0, 0, 0, 482, 0, 0, 0, 0, 0,
+  0, 817, 0, 0, 0, 0, 0, 0, 0, 417, 546, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 253, 277, 0, 0, 0, 157, 0, 992, 356, 0, 260, 0,
+  23, 0, 0, 630, 150, 0, 650, 86, 563, 746, 0, 0, 471, 0, 375, 0,
+  0, 296, 476, 175, 803, 0, 0, 0, 991, 0, 721, 500, 0, 0, 0, 585,
+  684, 658, 0, 276, 0, 0, 0, 325, 0, 456, 0, 0, 332, 359, 494, 678,
+  799, 904, 514, 194, 0, 735, 315, 872, 0, 0, 25, 0, 0, 113, 0, 436,
+  0, 0, 0, 603, 0, 30, 0, 0, 193, 76, 844, 530, 932, 0, 0, 411,
+  930, 0, 441, 976, 636, 830, 0, 191, 0, 249, 447, 0, 674, 102, 119, 695,
+  88, 887, 458, 700, 166, 801, 928, 0, 0, 0, 73, 0, 501, 313, 378, 694,
+  0, 0, 0, 4, 183, 0, 269, 145, 620, 117, 0, 0, 0, 0, 0, 164,
+  0, 783, 0, 0, 0, 747, 823, 0, 344, 0, 147, 0, 419, 491, 740, 804,
+  0, 0, 198, 133, 547, 756, 782, 0, 681, 0, 0, 726, 781, 0, 490, 187,
+  834, 207, 104, 766, 0, 0, 619, 537, 807, 0, 0, 57, 443, 0, 0, 0,
+  0, 69, 0, 682, 0, 93, 0, 0, 0, 917, 126, 381, 0, 611, 0, 0,
+  888, 0, 613, 0, 0, 668, 38, 654, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 18, 0, 0, 628, 363, 911, 0, 384, 0, 0, 846, 787,
+  0, 0, 385, 914, 100, 0, 869, 0, 0, 135, 0, 0, 728, 0, 0, 0,
+  0, 0, 279, 525, 0, 0, 0, 15, 0, 0, 0, 170, 197, 483, 0, 398,
+  310, 612, 865, 0, 305, 167, 499, 526, 0, 214, 0, 229, 750, 0, 0, 0,
+  828, 648, 790, 892, 0, 0, 0, 130, 0, 299, 465, 693, 0, 0, 0, 553,
+  0, 414, 467, 0, 633, 0, 348, 0, 0, 940, 0, 82, 263, 994, 0, 0,
+  353, 0, 448, 0, 474, 0, 0, 257, 0, 0, 0, 122, 446, 875, 582, 303,
+  0, 0, 343, 54, 366, 897, 0, 110, 215, 236, 535, 106, 156, 424, 784, 0,
+  154, 710, 576, 0, 753, 0, 0, 0, 0, 402, 0, 0, 354, 0, 0, 0,
+  3, 270, 809, 127, 148, 171, 0, 0, 0, 245, 0, 0, 0, 0, 0, 0,
+  298, 614, 0, 0, 0, 415, 0, 882, 0, 292, 0, 0, 0, 0, 0, 11,
+  0, 0, 0, 987, 0, 162, 0, 275, 0, 743, 0, 230, 669, 13, 430, 498,
+  374, 239, 36, 616, 716, 51, 810, 822, 0, 0, 0, 213, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 283, 0, 915, 742, 951, 588, 0, 571, 0,
+  960, 0, 420, 125, 111, 0, 0, 322, 53, 0, 0, 0, 340, 0, 318, 0,
+  0, 0, 0, 894, 924, 234, 449, 623, 641, 715, 0, 919, 989, 0, 0, 579,
+  0, 0, 757, 0, 0, 0, 0, 428, 0, 0, 158, 367, 0, 868, 923, 0,
+  0, 0, 550, 0, 600, 31, 760, 0, 233, 703, 0, 0, 0, 542, 0, 429,
+  990, 0, 250, 922, 934, 0, 0, 0, 0, 0, 0, 0, 0, 0, 858, 0,
+  0, 0, 399, 281, 0, 0, 0, 0, 480, 0, 656, 659, 660, 995, 0, 48,
+  0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 0, 83, 0, 511, 326, 328,
+  0, 0, 0, 0, 832, 0, 699, 551, 0, 0, 864, 0, 0, 0, 42, 403,
+  778, 0, 777, 972, 0, 0, 527, 0, 0, 0, 0, 955, 468, 0, 0, 75,
+  982, 218, 460, 876, 508, 0, 0, 90, 434, 369, 0, 685, 56, 0, 0, 0,
+  0, 0, 506, 584, 168, 0, 40, 0, 835, 0, 0, 808, 0, 208, 64, 0,
+  255, 80, 219, 0, 0, 0, 0, 0, 0, 642, 0, 0, 0, 821, 0, 0,
+  859, 0, 432, 981, 0, 502, 28, 0, 0, 0, 0, 0, 0, 652, 569, 709,
+  372, 0, 0, 0, 137, 819, 0, 169, 0, 109, 773, 0, 0, 0, 0, 0,
+  0, 67, 0, 677, 0, 0, 0, 186, 918, 0, 0, 0, 0, 0, 0, 0,
+  629, 0, 0, 719, 0, 0, 101, 0, 867, 85, 153, 607, 136, 161, 686, 860,
+  487, 0, 0, 0, 338, 0, 0, 993, 0, 278, 0, 802, 836, 0, 0, 0,
+  916, 520, 651, 0, 0, 0, 238, 881, 974, 228, 492, 723, 264, 0, 0, 0,
+  0, 913, 0, 306, 204, 515, 589, 190, 764, 712, 952, 0, 0, 0, 416, 0,
+  108, 84, 523, 0, 46, 739, 0, 590, 0, 0, 0, 0, 543, 957, 0, 0,
+  0, 0, 0, 445, 0, 0, 87, 0, 206, 885, 637, 302, 251, 580, 284, 644,
+  907, 962, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 342, 0, 0,
+  0, 0, 0, 0, 195, 209, 497, 818, 351, 771, 975, 0, 0, 16, 370, 890,
+  708, 956, 0, 0, 0, 0, 0, 0, 247, 1, 570, 947, 0, 0, 0, 0,
+  0, 0, 0, 329, 163, 222, 358, 544, 572, 596, 180, 702, 138, 290, 438, 779,
+  459, 986, 259, 408, 0, 0, 900, 0, 390, 0, 0, 0, 0, 0, 0, 287,
+  690, 850, 0, 0, 0, 0, 0, 0, 78, 655, 216, 0, 0, 0, 0, 688,
+  62, 0, 941, 114, 98, 286, 489, 143, 173, 485, 533, 0, 0, 393, 0, 0,
+  0, 0, 0, 0, 0, 0, 552, 0, 29, 0, 0, 0, 0, 536, 0, 116,
+  903, 0, 0, 0, 0, 0, 128, 295, 0, 39, 842, 516, 954, 587, 752, 811,
+  221, 352, 0, 0, 0, 63, 813, 737, 453, 55, 201, 139, 555, 107, 172, 610,
+  796, 0, 0, 871, 0, 99, 413, 540, 680, 768, 524, 840, 0, 0, 0, 0,
+  664, 730, 0, 0, 0, 673, 0, 0, 0, 0, 312, 0, 0, 0, 79, 97,
+  400, 519, 640, 129, 0, 0, 0, 595, 454, 0, 0, 878, 0, 89, 1000, 0,
+  0, 0, 0, 0, 0, 210, 827, 701, 96, 983, 0, 189, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 423, 568, 202, 314, 824, 0, 687, 0, 0, 0, 0,
+  0, 200, 0, 0, 0, 0, 0, 0, 466, 364, 0, 0, 0, 0, 0, 561,
+  744, 0, 0, 529, 0, 0, 0, 0, 0, 0, 0, 405, 386, 427, 705, 729,
+};
+
+const char *WA_FREQ_24_TOKENS[] = {
+  "tuk",
+  "ailish",
+  "sʋ",
+  "chi",
+  "issi",
+  "nippi",
+  "hoponi",
+  "li",
+  "ʋllatek",
+  "ʋt",
+  "holissochi",
+  "impvt",
+  "kil",
+  "ilhkoli",
+  "himak",
+  "ninak",
+  "kucha",
+  "ya",
+  "omba",
+  "abeka",
+  "nayukpa",
+  "ohoyo",
+  "pʋt",
+  "holabi",
+  "sia",
+  "kiyo",
+  "kaa",
+  "yʋt",
+  "himona",
+  "yo",
+  "afʋmmi",
+  "katohmi",
+};
+const uint16_t WA_FREQ_24_RANKS[] = {
+  21, 0, 0, 0, 0, 0, 19, 0, 9, 3, 10, 15, 0, 2, 29, 0,
+  0, 0, 0, 0, 30, 0, 20, 0, 25, 28, 6, 0, 23, 0, 0, 0,
+  0, 0, 0, 0, 0, 4, 18, 0, 31, 24, 1, 12, 5, 0, 0, 32,
+  17, 26, 22, 0, 0, 0, 27, 11, 16, 7, 0, 8, 0, 13, 0, 14,
+};
+
+const char *WA_FREQ_25_TOKENS[] = {
+  "gvgeyuhi",
+  "denadagohvyu",
+  "ꭴᏺ",
+  "ꭰᏸꮆꮧ",
+  "ꮭ",
+  "ᏹꭺꮅꭶ",
+  "ᏹꭼꭺꮹꮨꭽ",
+  "ꭶꮅꭱꮅꭶ",
+  "ꮵꭼꭺꮹꮨꭽ",
+  "ꭷꮻ",
+  "ꭰꮖꮪꮅꭽ",
+};
+const uint16_t WA_FREQ_25_RANKS[] = {
+  0, 9, 5, 0, 0, 0, 0, 0, 0, 0, 11, 6, 1, 10, 0, 0,
+  0, 7, 4, 0, 0, 3, 2, 0, 0, 0, 0, 8, 0, 0, 0, 0,
+};
+
+const char *WA_FREQ_26_TOKENS[] = {
+  "û",
+  "bi",
+  "ji",
+  "xwe",
+  "ku",
+  "li",
+  "di",
+  "de",
+  "jî",
+  "wan",
+  "ï¿½",
+  "min",
+  "wî",
+  "ber",
+  "ya",
+  "ne",
+  "ew",
+  "vê",
+  "kirin",
+  "re",
+  "ser",
+  "wê",
+  "bo",
+  "din",
+  "ev",
+  "Di",
+  "Ji",
+  "ve",
+  "bê",
+  "ye",
+  "ez",
+  "Êzîdî",
+  "da",
+  "me",
+  "Êzîdîya",
+  "her",
+  "bikin",
+  "wek",
+  "tê",
+  "van",
+  "e",
+  "ke",
+  "em",
+  "te",
+  "nav",
+  "Bi",
+  "Ev",
+  "Li",
+  "zimanê",
+  "bû",
+  "civaka",
+  "dikin",
+  "tu",
+  "got",
+  "Ew",
+  "dest",
+  "Ez",
+  "yên",
+  "we",
+  "Kurdistanê",
+  "lê",
+  "mirov",
+  "ra",
+  "hev",
+  "hate",
+  "yê",
+  "wï¿½",
+  "kurdî",
+  "tenê",
+  "jibo",
+  "bike",
+  "kir",
+  "çi",
+  "vî",
+  "Kurd",
+  "kar",
+  "ti",
+  "yek",
+  "weke",
+  "Lê",
+  "bu",
+  "dike",
+  "heye",
+  "nava",
+  "e.",
+  "hatin",
+  "ê",
+  "be",
+  "bin",
+  "ên",
+  "destê",
+  "divê",
+  "xo",
+  "a",
+  "dan",
+  "gelek",
+  "niha",
+  "serê",
+  "hat",
+  "kurd",
+  "hezar",
+  "dema",
+  "gotin",
+  "mala",
+  "navê",
+  "rê",
+  "sala",
+  "bibe",
+  "hene",
+  "mezin",
+  "dibin",
+  "hember",
+  "ziman",
+  "dibe",
+  "heta",
+  "herî",
+  "kes",
+  "kesên",
+  "dê",
+  "hin",
+  "karê",
+  "navbera",
+  "yekê",
+  "du",
+  "berê",
+  "aliyê",
+  "gel",
+  "jï¿½",
+  "Kurdî",
+  "bibin",
+  "liser",
+  "ma",
+  "alîyê",
+  "welatê",
+  "bun",
+  "xwedî",
+  "Her",
+  "gelê",
+  "tên",
+  "vï¿½",
+  "Gava",
+  "cih",
+  "bikê",
+  "girtin",
+  "na",
+  "Piştî",
+  "an",
+  "in",
+  "pê",
+  "Em",
+  "cem",
+  "jê",
+  "kî",
+  "gotina",
+  "hatine",
+  "ola",
+  "jiber",
+  "kurdan",
+  "nû",
+  "bï¿½",
+  "va",
+  "2",
+  "bûn",
+  "dilê",
+  "gundê",
+  "hatina",
+  "hun",
+  "3",
+  "Jiber",
+  "xebatên",
+  "Divê",
+  "dikare",
+  "hemu",
+  "xwera",
+  "dijî",
+  "gava",
+  "salan",
+  "vir",
+  "xwedê",
+  "xwer",
+  "bên",
+  "cihê",
+  "hemû",
+  "Kurdan",
+  "ava",
+  "dikê",
+  "Û",
+  "FKÊ",
+  "awayekî",
+  "dayîk",
+  "herêma",
+  "rast",
+  "çend",
+  "jîyana",
+  "pîroz",
+  "rewşa",
+  "zarok",
+  "ta",
+  "Êzidiyan",
+  "Min",
+  "bajarê",
+  "deng",
+  "wiha",
+  "wisa",
+  "îro",
+  "berî",
+  "bibê",
+  "jiyana",
+  "keça",
+  "nê",
+  "azad",
+  "bavê",
+  "bikim",
+  "dixwazin",
+  "kurdên",
+  "mafê",
+  "nayê",
+  "bilind",
+  "bûne",
+  "dikir",
+  "ezê",
+  "hemî",
+  "mal",
+  "pêk",
+  "î",
+  "Elmanya",
+  "Kurdên",
+  "kirine",
+  "pir",
+  "awayî",
+  "hatiye",
+  "heger",
+  "kesî",
+  "siyasî",
+  "zêde",
+  "Gelê",
+  "bidin",
+  "derbas",
+  "roja",
+  "weha",
+  "yan",
+  "Êzidî",
+  "amade",
+  "berdewam",
+  "derket",
+  "herdu",
+  "rojê",
+  "Kurdistan",
+  "Zimanê",
+  "bash",
+  "bide",
+  "netewî",
+  "parastina",
+  "xelkê",
+  "êzîdî",
+  "bîr",
+  "cuda",
+  "dijîn",
+  "rastî",
+  "Ma",
+  "Xwedê",
+  "bav",
+  "demê",
+  "didin",
+  "ka",
+  "mîna",
+  "serokê",
+  "Alan",
+  "Hozan",
+  "Lewma",
+  "go",
+  "kirina",
+  "tevlî",
+  "teybetî",
+  "xweda",
+  "Eger",
+  "Wek",
+  "avakirina",
+  "baş",
+  "dinav",
+  "meriv",
+  "werin",
+  "zarokan",
+  "Êzîdiyan",
+  "4",
+  "Almanya",
+  "bona",
+  "civakê",
+  "civakî",
+  "devê",
+  "dil",
+  "gelekî",
+  "man",
+  "zimên",
+  "Êzdiyan",
+  "Heger",
+  "Iraqê",
+  "Mala",
+  "axa",
+  "bahwerîya",
+  "bidim",
+  "cara",
+  "eger",
+  "hem",
+  "roj",
+  "taybetî",
+  "çiqasî",
+  "Xweda",
+  "anjî",
+  "dawî",
+  "ket",
+  "lï¿½",
+  "welêt",
+  "xwede",
+  "Êzîdîyên",
+  "çavê",
+  "çawa",
+  "72",
+  "Heta",
+  "Navê",
+  "dîsa",
+  "emê",
+  "gorî",
+  "gund",
+  "kur",
+  "malên",
+  "serî",
+  "vekirî",
+  "xwere",
+  "xwestin",
+  "xwîya",
+  "zarokên",
+  "çavên",
+  "çêbu",
+  "Şingalê",
+  "Şêx",
+  "Ewropa",
+  "Mirov",
+  "dibê",
+  "dikirin",
+  "ewê",
+  "giştî",
+  "hêdî",
+  "hîn",
+  "malbata",
+  "malê",
+  "nêzîkî",
+  "revî",
+  "zimanekî",
+  "Êzîdatîyê",
+  "Kurdistana",
+  "Ne",
+  "bahsa",
+  "carek",
+  "derbarê",
+  "hêzên",
+  "mirovan",
+  "mixabin",
+  "nas",
+  "piştî",
+  "warê",
+  "welat",
+  "xebata",
+  "xebatê",
+  "zanistî",
+  "zanîn",
+  "Duhok",
+  "Jibo",
+  "Revî",
+  "dane",
+  "ol",
+  "rêvebirîya",
+  "salên",
+  "ticara",
+  "yekgirtî",
+  "Êzîd",
+  "Bahlul",
+  "Ya",
+  "bila",
+  "derê",
+  "dev",
+  "dirêj",
+  "dîrokî",
+  "encama",
+  "ewe",
+  "girêdayî",
+  "hetanî",
+  "hevalên",
+  "ketin",
+  "nivîsa",
+  "were",
+  "xwest",
+  "Êzdî",
+  "10",
+  "20",
+  "Wan",
+  "Wî",
+  "Yek",
+  "bîne",
+  "der",
+  "dikim",
+  "dora",
+  "kesê",
+  "misilman",
+  "nakin",
+  "olî",
+  "parastin",
+  "Dema",
+  "Kurdistanï¿½",
+  "Serhan",
+  "Weke",
+  "agir",
+  "bibînin",
+  "bingehîn",
+  "destên",
+  "dibistanê",
+  "dikarin",
+  "fahm",
+  "fermana",
+  "gerek",
+  "herdhej",
+  "hinek",
+  "kesa",
+  "kesan",
+  "kin",
+  "kom",
+  "lewma",
+  "pêwîst",
+  "rêya",
+  "serï¿½",
+  "tev",
+  "u",
+  "wekî",
+  "xebat",
+  "Gelo",
+  "Herêma",
+  "Niha",
+  "Rindo",
+  "anî",
+  "baweriya",
+  "beroşa",
+  "biryara",
+  "caran",
+  "cî",
+  "dem",
+  "hatîya",
+  "herêmê",
+  "merov",
+  "mirova",
+  "o",
+  "raya",
+  "shima",
+  "sê",
+  "xwazim",
+  "xwîna",
+  "yekemîn",
+  "çû",
+  "Bila",
+  "Ligorî",
+  "Tirkîyê",
+  "armanca",
+  "birin",
+  "bêne",
+  "dibêjin",
+  "dinyayê",
+  "dîroka",
+  "giring",
+  "gor",
+  "holê",
+  "hêla",
+  "jiyanê",
+  "konseyê",
+  "liber",
+  "mafên",
+  "reya",
+  "vala",
+  "xweş",
+  "Îro",
+  "çêkirin",
+  "Şengalê",
+  "Bremen",
+  "Cejna",
+  "Wï¿½",
+  "agahdarîyên",
+  "alîyên",
+  "av",
+  "berï¿½",
+  "bigirin",
+  "bîra",
+  "civak",
+  "dibîne",
+  "dide",
+  "dizanin",
+  "dûr",
+  "havalen",
+  "herin",
+  "hêvîya",
+  "kesekî",
+  "kurdï¿½",
+  "kuştin",
+  "le",
+  "mirovî",
+  "pirsa",
+  "pîreka",
+  "reng",
+  "tirk",
+  "yew",
+  "Êzîdîyan",
+  "12",
+  "Dê",
+  "Günay",
+  "Kurdîstanê",
+  "Netewa",
+  "Tu",
+  "amê",
+  "belê",
+  "bixwe",
+  "biyanî",
+  "bêjim",
+  "bûye",
+  "ciwan",
+  "danîn",
+  "dibînin",
+  "dihat",
+  "dîtin",
+  "erebî",
+  "fermî",
+  "gur",
+  "hatî",
+  "hêja",
+  "hên",
+  "kesek",
+  "keï¿½a",
+  "kirîye",
+  "lêkolînên",
+  "mirovên",
+  "neyê",
+  "olên",
+  "sal",
+  "seat",
+  "sed",
+  "tevlîbuna",
+  "welatî",
+  "xwedï¿½",
+  "xwîn",
+  "zikmakî",
+  "çima",
+  "êdî",
+  "êzidîyan",
+  "şerê",
+  "5",
+  "6",
+  "Cengiz",
+  "Herêmê",
+  "Ka",
+  "Kîwexê",
+  "Serokê",
+  "Xwedï¿½",
+  "Ziman",
+  "alî",
+  "bahlul",
+  "belav",
+  "belkî",
+  "berda",
+  "bersiva",
+  "bingeha",
+  "bêjê",
+  "bï¿½n",
+  "bûm",
+  "derbarên",
+  "dewletê",
+  "dikane",
+  "diçe",
+  "endamên",
+  "girt",
+  "gotinê",
+  "heft",
+  "hemberî",
+  "hemï¿½",
+  "hevdu",
+  "hê",
+  "jin",
+  "karibin",
+  "kelê",
+  "ki",
+  "ligor",
+  "nivîsên",
+  "nîne",
+  "pey",
+  "reş",
+  "rojan",
+  "serbixwe",
+  "shîkînê",
+  "temaşe",
+  "tirkî",
+  "xwînê",
+  "zimanï¿½",
+  "Îsmaîl",
+  "çand",
+  "çiqas",
+  "şer",
+  "şêr",
+  "Bexşî",
+  "Duhokê",
+  "Heke",
+  "Kurdistanî",
+  "Shîlanê",
+  "aborî",
+  "avê",
+  "berdin",
+  "careka",
+  "cihên",
+  "dayîka",
+  "dengê",
+  "destpêka",
+  "dewleta",
+  "dikanin",
+  "dixwaze",
+  "diyar",
+  "dost",
+  "dur",
+  "endamê",
+  "gelik",
+  "herdem",
+  "herdo",
+  "hew",
+  "him",
+  "jor",
+  "nikarin",
+  "perwerdeyî",
+  "pirs",
+  "pirsê",
+  "pirtûkê",
+  "pişta",
+  "pêdivî",
+  "rengê",
+  "rewşenbîr",
+  "tenï¿½",
+  "tevî",
+  "tifaq",
+  "xwedîyê",
+  "zimanên",
+  "zor",
+  "Çi",
+  "Çiyayê",
+  "çanda",
+  "çîya",
+  "Şingal",
+  "1",
+  "Beg",
+  "Civaka",
+  "Ewrupa",
+  "Gelek",
+  "Kurmancî",
+  "Lï¿½",
+  "Mîr",
+  "OpenOffice.org",
+  "alîkarîya",
+  "anîn",
+  "avakirin",
+  "bajar",
+  "bajêr",
+  "bavï¿½",
+  "bela",
+  "benda",
+  "bidê",
+  "bikï¿½",
+  "biryar",
+  "bînin",
+  "dawîya",
+  "daxwaza",
+  "dehan",
+  "derketina",
+  "derveyî",
+  "destpêkir",
+  "diçin",
+  "dît",
+  "dîtina",
+  "eve",
+  "gelo",
+  "giran",
+  "gotinên",
+  "gûnd",
+  "hebu",
+  "hebun",
+  "hebûn",
+  "hevalê",
+  "hewl",
+  "hewqas",
+  "hînî",
+  "kurda",
+  "kû",
+  "merdim",
+  "naskirin",
+  "pirsgirêkên",
+  "qewmê",
+  "rewşê",
+  "rexne",
+  "ro",
+  "rêxistin",
+  "rêxistinên",
+  "sor",
+  "tevahîya",
+  "tirs",
+  "têne",
+  "welatên",
+  "wir",
+  "zaravayê",
+  "zilm",
+  "Îraqê",
+  "şaş",
+  "11",
+  "9",
+  "Amedê",
+  "Barzanî",
+  "Dilsoz",
+  "Ezê",
+  "Hin",
+  "Me",
+  "Mezopotamya",
+  "Nienburg",
+  "TV",
+  "Xelîfe",
+  "aliyï¿½",
+  "alîkarî",
+  "ba",
+  "bala",
+  "baweriyên",
+  "berjewendiyên",
+  "bigrin",
+  "bikaranîn",
+  "cejna",
+  "cewaz",
+  "daxwaz",
+  "delal",
+  "dengên",
+  "dijmin",
+  "dinê",
+  "dixwazim",
+  "ezï¿½",
+  "gelkî",
+  "gûndê",
+  "hebûna",
+  "hemi",
+  "kenê",
+  "kurdï¿½n",
+  "kêm",
+  "lingê",
+  "meha",
+  "mir",
+  "nekin",
+  "nivîsandin",
+  "nîşan",
+  "sînor",
+  "wana",
+  "xaka",
+  "xwarin",
+  "zimanî",
+  "zorê",
+  "zêdeyî",
+  "çandî",
+  "ï¿½end",
+  "1.",
+  "2.",
+  "Carek",
+  "Celle",
+  "Dilpak",
+  "Hun",
+  "Hunermendên",
+  "Kur",
+  "Pishtî",
+  "Silo",
+  "Xidir",
+  "avêtin",
+  "bahr",
+  "bayê",
+  "bes",
+  "bêjin",
+  "bînim",
+  "ci",
+  "ciyê",
+  "dibêjim",
+  "dibînim",
+  "dihatin",
+  "dilï¿½",
+  "doza",
+  "dîn",
+  "endam",
+  "ewan",
+  "girêdayê",
+  "gotine",
+  "gï¿½ndï¿½",
+  "hatibu",
+  "hebû",
+  "hezaran",
+  "hêvî",
+  "im",
+  "kalamer",
+  "keno",
+  "kerîyên",
+  "ligorî",
+  "minra",
+  "mirinê",
+  "mirovê",
+  "nahbera",
+  "navnetewî",
+  "navï¿½",
+  "perwerde",
+  "pişt",
+  "pêş",
+  "qasî",
+  "reben",
+  "sazî",
+  "temam",
+  "ten",
+  "tişt",
+  "tiştê",
+  "vekirin",
+  "xirab",
+  "xistin",
+  "xwarina",
+  "xwediyê",
+  "xwendin",
+  "yo",
+  "zaf",
+  "zêdetir",
+  "Çiqasî",
+  "Êzîdiyatiyê",
+  "Êzîdîyê",
+  "Şengalîyan",
+  "Şerfedîn",
+  "3.",
+  "40",
+  "50",
+  "Başûr",
+  "Başûrê",
+  "Ezidî",
+  "Gelï¿½",
+  "Gûndê",
+  "Hemû",
+  "Hikumeta",
+  "Hikûmeta",
+  "Kirmanckî",
+  "Pîreka",
+  "Sarê",
+  "Wê",
+  "amo",
+  "axaftina",
+  "azadî",
+  "bahwer",
+  "bang",
+  "bas",
+  "bawer",
+  "bikaranîna",
+  "bikerê",
+  "birayên",
+  "birêvebir",
+  "buya",
+  "bêdeng",
+  "bîranîna",
+  "derkevin",
+  "derva",
+  "devera",
+  "dikeve",
+  "domanî",
+  "dï¿½",
+  "gotinek",
+  "goşt",
+  "hatibû",
+  "hebe",
+  "hejmara",
+  "hejî",
+  "herdhejêde",
+  "here",
+  "herkesî",
+  "herweha",
+  "hevîdarim",
+  "heya",
+  "kalan",
+  "kevir",
+  "kiriye",
+  "kê",
+  "latînî",
+  "nabe",
+  "nehat",
+  "nema",
+  "nirxên",
+  "pejirandin",
+  "pez",
+  "pirsgirêka",
+  "qedexe",
+  "qet",
+  "qirêj",
+  "rewşenbîrên",
+  "rojên",
+  "rojï¿½",
+  "rêxistinê",
+  "rûpelan",
+  "salaye",
+  "saziyên",
+  "sazîyê",
+  "sazîyên",
+  "sedema",
+  "sedemên",
+  "soz",
+  "taybet",
+  "tayê",
+  "ter",
+  "tim",
+  "tiştekî",
+  "winda",
+  "xemgîn",
+  "xortên",
+  "zelî",
+  "zimanan",
+  "çavan",
+  "êrîş",
+  "ï¿½awa",
+  "ï¿½i",
+  "Şêxanê",
+  "Şêşims",
+  "Ahmet",
+  "Berî",
+  "Demîrtaş",
+  "Dilgeş",
+  "Dîsa",
+  "Gundê",
+  "Gï¿½ndï¿½",
+  "Hunermend",
+  "Kurda",
+  "Laliş",
+  "Linux",
+  "Liser",
+  "Melek",
+  "Pêshîmam",
+  "Rojekê",
+  "Seba",
+  "Shîlan",
+  "Sê",
+  "Ti",
+  "Xelï¿½fe",
+  "agahdarî",
+  "anîbu",
+  "bahra",
+  "ben",
+  "beşa",
+  "bibim",
+  "biparêzin",
+  "biqasî",
+  "bira",
+  "bêrê",
+  "bînê",
+  "bûyî",
+  "carê",
+  "dar",
+  "dengan",
+  "derdora",
+  "derve",
+  "dezgehên",
+  "dimîne",
+  "dîrokê",
+  "ewqas",
+  "fêrî",
+  "gelên",
+  "girtina",
+  "girêdan",
+  "gotinan",
+  "gï¿½nd",
+  "halê",
+  "hatîye",
+  "he",
+  "hespê",
+  "hilbijartin",
+  "hinga",
+  "hêjî",
+  "hêviya",
+  "hûn",
+  "karim",
+  "karên",
+  "karï¿½",
+  "ketim",
+  "kevnare",
+  "keç",
+  "kim",
+  "komek",
+  "komîta",
+  "kurdistanê",
+  "kûştin",
+  "lawê",
+  "linga",
+  "malbat",
+  "mashika",
+  "mirovekî",
+  "mêvan",
+  "nasnameya",
+  "nebe",
+  "neda",
+  "nekir",
+  "netewa",
+  "nivîsandina",
+};
+const uint16_t WA_FREQ_26_RANKS[] = {
+  0, 773, 512, 0, 0, 0, 477, 452, 885, 435, 938, 960, 574, 87, 0, 0,
+  430, 504, 631, 393, 742, 839, 944, 967, 743, 325, 0, 467, 819, 0, 0, 352,
+  841, 0, 0, 998, 0, 383, 678, 462, 828, 948, 98, 0, 952, 137, 455, 530,
+  789, 423, 817, 11, 526, 192, 468, 752, 903, 607, 984, 0, 0, 454, 0, 682,
+  569, 981, 81, 275, 731, 814, 193, 0, 0, 0, 947, 236, 813, 797, 865, 974,
+  0, 811, 133, 381, 493, 64, 924, 994, 0, 206, 165, 675, 0, 444, 0, 0,
+  0, 0, 104, 629, 0, 0, 0, 330, 769, 880, 0, 0, 0, 648, 355, 134,
+  312, 458, 674, 859, 642, 0, 0, 0, 0, 76, 0, 0, 274, 232, 317, 0,
+  0, 0, 59, 0, 0, 9, 78, 0, 720, 199, 30, 183, 208, 466, 787, 0,
+  0, 547, 0, 0, 0, 596, 0, 158, 0, 251, 917, 940, 983, 465, 580, 666,
+  0, 49, 0, 341, 3, 589, 770, 837, 0, 0, 0, 0, 0, 919, 0, 382,
+  0, 0, 0, 0, 0, 443, 1, 879, 0, 0, 0, 843, 0, 993, 0, 0,
+  696, 22, 0, 0, 0, 925, 0, 653, 0, 0, 587, 345, 650, 0, 0, 0,
+  934, 0, 45, 832, 410, 671, 0, 515, 449, 844, 0, 593, 987, 0, 679, 67,
+  248, 812, 502, 676, 581, 0, 0, 572, 0, 0, 0, 890, 0, 0, 280, 461,
+  0, 362, 0, 379, 0, 0, 870, 89, 215, 397, 273, 495, 619, 705, 755, 799,
+  0, 44, 72, 0, 0, 0, 0, 0, 830, 0, 0, 313, 0, 0, 0, 0,
+  0, 0, 47, 0, 0, 0, 0, 0, 188, 614, 689, 0, 0, 0, 0, 384,
+  728, 287, 918, 0, 459, 904, 0, 0, 0, 798, 0, 439, 475, 898, 776, 976,
+  0, 294, 411, 0, 874, 0, 0, 311, 0, 0, 0, 0, 0, 0, 0, 0,
+  710, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 356, 906, 0,
+  851, 637, 818, 0, 0, 0, 0, 889, 216, 365, 385, 507, 140, 734, 53, 849,
+  0, 0, 860, 0, 0, 0, 897, 110, 0, 0, 220, 0, 0, 0, 0, 0,
+  0, 0, 0, 545, 0, 926, 0, 0, 354, 0, 0, 0, 0, 0, 303, 583,
+  0, 92, 711, 640, 0, 847, 40, 0, 846, 0, 0, 0, 0, 0, 187, 683,
+  56, 0, 546, 957, 707, 834, 0, 250, 0, 404, 0, 0, 125, 0, 0, 754,
+  0, 977, 945, 34, 371, 243, 718, 0, 327, 576, 842, 298, 426, 437, 0, 0,
+  0, 219, 785, 94, 204, 348, 394, 528, 625, 712, 953, 0, 23, 534, 970, 0,
+  0, 0, 0, 0, 0, 0, 0, 112, 304, 113, 600, 730, 0, 320, 0, 0,
+  0, 0, 0, 0, 0, 342, 0, 218, 0, 350, 950, 0, 0, 0, 0, 0,
+  0, 617, 0, 0, 0, 760, 62, 0, 0, 0, 670, 863, 654, 0, 0, 0,
+  0, 0, 0, 0, 827, 244, 0, 57, 989, 570, 0, 126, 0, 389, 866, 0,
+  0, 318, 281, 982, 366, 0, 0, 291, 181, 296, 85, 279, 604, 630, 239, 959,
+  214, 565, 0, 0, 0, 231, 836, 0, 0, 0, 665, 779, 0, 721, 724, 0,
+  0, 0, 0, 0, 0, 624, 868, 0, 431, 0, 810, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 205, 761, 0, 0, 558, 0, 0, 0, 0, 793, 0,
+  0, 0, 0, 0, 0, 0, 0, 322, 0, 0, 0, 0, 656, 0, 0, 0,
+  745, 0, 0, 0, 0, 783, 0, 0, 0, 553, 0, 306, 374, 36, 257, 396,
+  510, 0, 0, 0, 0, 247, 496, 613, 777, 102, 246, 525, 780, 973, 0, 535,
+  0, 0, 0, 608, 620, 200, 0, 478, 0, 446, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 360, 0, 344, 0, 0,
+  0, 955, 0, 756, 788, 0, 790, 0, 146, 0, 550, 554, 0, 894, 305, 0,
+  0, 0, 803, 131, 145, 17, 536, 750, 0, 0, 0, 0, 77, 483, 822, 252,
+  0, 359, 0, 0, 0, 719, 0, 0, 0, 0, 0, 862, 176, 127, 293, 154,
+  0, 0, 0, 508, 103, 284, 464, 0, 0, 893, 0, 24, 105, 996, 161, 514,
+  0, 364, 358, 941, 170, 985, 0, 0, 0, 0, 0, 0, 0, 31, 0, 447,
+  0, 702, 0, 0, 0, 0, 815, 612, 915, 603, 995, 0, 166, 223, 0, 0,
+  701, 845, 0, 0, 677, 0, 0, 0, 209, 740, 422, 0, 0, 0, 0, 20,
+  63, 90, 182, 221, 263, 537, 634, 18, 0, 0, 0, 598, 704, 0, 0, 159,
+  413, 0, 0, 0, 0, 0, 0, 895, 0, 0, 0, 0, 0, 541, 0, 0,
+  0, 7, 240, 450, 590, 440, 646, 538, 97, 626, 900, 0, 902, 627, 0, 0,
+  0, 0, 0, 115, 399, 328, 820, 638, 0, 0, 228, 616, 687, 108, 289, 669,
+  0, 0, 621, 739, 261, 0, 0, 736, 378, 873, 387, 0, 395, 107, 555, 0,
+  0, 0, 892, 0, 0, 0, 0, 28, 0, 0, 60, 285, 336, 0, 487, 0,
+  212, 167, 69, 266, 340, 390, 527, 716, 401, 762, 901, 65, 441, 936, 560, 986,
+  0, 652, 0, 0, 0, 0, 968, 878, 172, 927, 58, 585, 0, 0, 0, 0,
+  0, 0, 0, 714, 914, 0, 237, 0, 0, 14, 238, 690, 0, 0, 0, 0,
+  0, 0, 0, 920, 147, 301, 684, 0, 0, 0, 592, 0, 195, 380, 729, 0,
+  692, 0, 203, 0, 639, 775, 225, 0, 479, 111, 0, 907, 114, 0, 0, 0,
+  178, 96, 249, 0, 61, 519, 0, 0, 0, 0, 0, 84, 207, 0, 0, 0,
+  0, 0, 0, 632, 725, 0, 0, 0, 0, 400, 622, 0, 0, 722, 190, 858,
+  194, 662, 0, 0, 685, 0, 480, 509, 848, 0, 308, 453, 485, 611, 186, 921,
+  0, 0, 198, 276, 766, 0, 0, 0, 0, 0, 0, 0, 0, 2, 168, 368,
+  513, 333, 595, 0, 0, 795, 964, 979, 0, 0, 782, 332, 463, 299, 315, 601,
+  765, 757, 156, 0, 778, 767, 0, 0, 353, 0, 0, 0, 0, 643, 990, 0,
+  0, 0, 0, 101, 118, 262, 602, 633, 0, 809, 0, 0, 121, 0, 202, 0,
+  0, 0, 0, 0, 0, 0, 763, 929, 961, 0, 265, 323, 975, 0, 0, 357,
+  0, 0, 424, 429, 661, 0, 16, 189, 329, 681, 99, 6, 272, 997, 891, 0,
+  680, 0, 0, 0, 150, 288, 943, 38, 153, 438, 532, 490, 521, 806, 913, 946,
+  0, 0, 0, 0, 54, 831, 0, 659, 0, 0, 928, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 407, 372, 0, 0, 0, 567, 0, 0, 0, 0, 0, 0,
+  922, 0, 73, 175, 255, 618, 0, 703, 0, 226, 605, 0, 0, 0, 0, 0,
+  116, 965, 0, 511, 420, 853, 0, 781, 747, 0, 0, 0, 0, 405, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 436, 0, 0, 0, 8, 71, 0, 0, 196,
+  645, 599, 0, 335, 0, 0, 0, 0, 0, 0, 347, 106, 229, 253, 559, 0,
+  0, 0, 0, 0, 0, 0, 751, 0, 0, 552, 826, 0, 0, 667, 573, 242,
+  489, 933, 141, 0, 0, 0, 309, 0, 492, 0, 0, 708, 0, 999, 0, 0,
+  0, 0, 0, 0, 0, 0, 66, 0, 0, 74, 0, 0, 68, 544, 0, 516,
+  855, 0, 230, 0, 0, 157, 314, 840, 310, 753, 0, 0, 0, 615, 0, 0,
+  324, 0, 445, 0, 300, 0, 0, 792, 571, 723, 0, 0, 132, 185, 0, 908,
+  0, 0, 833, 0, 0, 0, 0, 0, 398, 155, 171, 888, 0, 0, 173, 0,
+  93, 856, 75, 0, 0, 0, 524, 0, 0, 0, 95, 0, 0, 0, 0, 588,
+  268, 876, 807, 0, 0, 0, 0, 128, 0, 0, 0, 0, 0, 0, 142, 575,
+  713, 561, 0, 0, 292, 0, 0, 0, 0, 0, 0, 469, 0, 0, 245, 910,
+  138, 0, 850, 0, 0, 506, 0, 0, 0, 391, 635, 0, 233, 694, 297, 972,
+  55, 0, 557, 149, 0, 0, 657, 5, 119, 791, 0, 0, 86, 0, 37, 123,
+  162, 597, 0, 0, 0, 0, 174, 370, 498, 821, 930, 0, 0, 0, 0, 0,
+  0, 417, 0, 0, 881, 339, 363, 886, 956, 486, 744, 774, 825, 0, 563, 0,
+  0, 0, 0, 0, 52, 197, 0, 0, 254, 658, 0, 0, 213, 610, 963, 649,
+  0, 0, 735, 130, 0, 726, 698, 0, 0, 0, 0, 10, 0, 0, 0, 896,
+  949, 286, 746, 606, 883, 88, 663, 0, 419, 0, 0, 0, 802, 523, 0, 0,
+  283, 432, 0, 499, 882, 923, 0, 361, 0, 808, 224, 577, 0, 0, 529, 0,
+  905, 0, 122, 0, 0, 0, 217, 732, 267, 264, 706, 415, 0, 829, 0, 481,
+  117, 978, 488, 0, 0, 0, 80, 668, 786, 0, 0, 0, 0, 0, 579, 691,
+  518, 772, 433, 551, 234, 448, 566, 651, 686, 969, 0, 695, 992, 0, 392, 0,
+  0, 418, 0, 0, 0, 191, 0, 129, 0, 0, 0, 877, 794, 326, 916, 0,
+  0, 0, 0, 857, 0, 0, 0, 26, 91, 0, 0, 0, 0, 875, 0, 0,
+  0, 0, 210, 951, 0, 0, 0, 260, 660, 32, 0, 0, 0, 0, 980, 474,
+  0, 0, 0, 169, 179, 160, 375, 476, 966, 0, 0, 13, 0, 0, 321, 0,
+  0, 0, 0, 0, 0, 442, 0, 456, 258, 0, 0, 738, 899, 0, 0, 0,
+  270, 0, 0, 427, 0, 0, 0, 0, 164, 0, 0, 184, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 403, 0, 854, 0, 139, 428, 412, 737, 758, 0, 0,
+  0, 0, 0, 409, 609, 0, 180, 319, 542, 568, 699, 0, 1000, 0, 0, 51,
+  0, 349, 501, 41, 644, 0, 0, 0, 0, 503, 727, 958, 0, 0, 0, 0,
+  688, 505, 768, 0, 0, 19, 816, 109, 0, 591, 222, 0, 500, 693, 0, 0,
+  259, 0, 0, 50, 21, 367, 414, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  932, 0, 911, 0, 0, 0, 316, 434, 0, 0, 0, 0, 0, 697, 909, 0,
+  0, 0, 451, 302, 491, 549, 120, 290, 655, 749, 0, 556, 0, 0, 277, 346,
+  473, 0, 0, 35, 124, 163, 867, 0, 27, 0, 0, 0, 0, 0, 48, 460,
+  0, 962, 562, 884, 307, 912, 871, 471, 256, 494, 0, 0, 548, 0, 0, 741,
+  0, 0, 241, 338, 0, 15, 800, 991, 0, 0, 0, 0, 0, 43, 864, 0,
+  271, 939, 709, 0, 0, 0, 0, 0, 0, 0, 201, 0, 0, 887, 0, 0,
+  0, 988, 771, 0, 0, 0, 0, 151, 0, 0, 70, 733, 0, 0, 0, 0,
+  0, 584, 0, 0, 824, 0, 641, 0, 0, 388, 673, 533, 0, 0, 0, 472,
+  0, 402, 408, 540, 0, 100, 717, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 25, 520, 0, 517, 497, 623, 0, 0, 0, 0, 177, 0, 0,
+  282, 0, 0, 0, 457, 12, 764, 869, 531, 406, 759, 937, 748, 83, 628, 0,
+  0, 935, 0, 0, 0, 838, 39, 0, 386, 594, 421, 0, 0, 0, 0, 0,
+  0, 942, 0, 0, 0, 0, 0, 0, 539, 0, 0, 0, 0, 0, 0, 0,
+  334, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 872, 33, 971, 0, 0,
+  0, 796, 0, 278, 672, 0, 377, 582, 227, 0, 0, 636, 373, 331, 0, 0,
+  143, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 82, 0,
+  211, 0, 0, 0, 0, 0, 823, 337, 369, 0, 148, 136, 0, 0, 0, 0,
+  351, 0, 0, 42, 0, 954, 0, 0, 700, 647, 295, 0, 0, 0, 801, 0,
+  715, 0, 0, 0, 0, 416, 470, 484, 522, 4, 482, 664, 835, 0, 0, 0,
+  0, 0, 152, 343, 0, 578, 564, 0, 0, 0, 0, 0, 0, 0, 0, 425,
+  269, 931, 0, 0, 29, 376, 135, 805, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 543, 79, 586, 0, 0, 784, 144, 235, 804, 852, 861, 0,
+};
+
+const char *WA_FREQ_27_TOKENS[] = {
+  "u",
+  "in",
+  "vogliu",
+  "chè",
+  "vo",
+  "sìate",
+  "casa",
+  "à",
+  "ott",
+  "ore",
+  "è",
+  "mezu",
+  "forma",
+  "benvenutu",
+  "bonghjornu",
+  "semu",
+  "famiti",
+  "burj",
+  "khalifa",
+  "hè",
+  "actualmente",
+  "grattacelu",
+  "più",
+  "altu",
+  "di",
+  "mondu",
+  "grazie",
+  "ùn",
+  "avemu",
+  "micca",
+  "un",
+  "papa",
+  "anch",
+  "eiu",
+  "vi",
+  "ringraziu",
+};
+const uint16_t WA_FREQ_27_RANKS[] = {
+  0, 0, 0, 4, 8, 0, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0,
+  0, 11, 18, 0, 0, 0, 0, 0, 15, 0, 0, 19, 29, 0, 0, 21,
+  0, 25, 26, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 5, 0, 0,
+  1, 0, 0, 0, 0, 6, 36, 0, 10, 27, 22, 30, 33, 0, 0, 17,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 3, 32, 35, 0,
+  0, 0, 20, 14, 12, 0, 23, 0, 0, 0, 0, 0, 34, 0, 28, 31,
+  0, 0, 0, 7, 16, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+const char *WA_FREQ_28_TOKENS[] = {
+  "to",
+  "se",
+  "je",
+  "a",
+  "že",
+  "jsem",
+  "na",
+  "co",
+  "v",
+  "si",
+  "tak",
+  "ale",
+  "ne",
+  "s",
+  "jsi",
+  "já",
+  "mi",
+  "mě",
+  "o",
+  "do",
+  "jak",
+  "ty",
+  "z",
+  "jo",
+  "jste",
+  "už",
+  "když",
+  "jen",
+  "jsme",
+  "jako",
+  "tu",
+  "za",
+  "ho",
+  "ti",
+  "by",
+  "tady",
+  "ano",
+  "pro",
+  "dobře",
+  "není",
+  "byl",
+  "tě",
+  "něco",
+  "proč",
+  "teď",
+  "no",
+  "k",
+  "tam",
+  "tohle",
+  "mám",
+  "jsou",
+  "ten",
+  "být",
+  "toho",
+  "bude",
+  "bych",
+  "vás",
+  "nic",
+  "takže",
+  "má",
+  "ve",
+  "vám",
+  "nebo",
+  "kdo",
+  "aby",
+  "tom",
+  "byla",
+  "ji",
+  "bylo",
+  "kde",
+  "ještě",
+  "i",
+  "po",
+  "pane",
+  "protože",
+  "než",
+  "můj",
+  "jeho",
+  "od",
+  "myslím",
+  "tím",
+  "jestli",
+  "máš",
+  "měl",
+  "vím",
+  "nás",
+  "všechno",
+  "možná",
+  "víš",
+  "nikdy",
+  "prosím",
+  "moc",
+  "mu",
+  "vy",
+  "ani",
+  "chci",
+  "taky",
+  "nevím",
+  "až",
+  "pokud",
+  "moje",
+  "tebe",
+  "pak",
+  "nám",
+  "ahoj",
+  "ta",
+  "jí",
+  "díky",
+  "říct",
+  "sem",
+  "máme",
+  "řekl",
+  "u",
+  "chceš",
+  "musím",
+  "budu",
+  "před",
+  "pořádku",
+  "jít",
+  "opravdu",
+  "on",
+  "někdo",
+  "tomu",
+  "asi",
+  "všichni",
+  "trochu",
+  "mít",
+  "hej",
+  "vážně",
+  "myslíš",
+  "dobrý",
+  "abych",
+  "pořád",
+  "který",
+  "mohl",
+  "měla",
+  "ze",
+  "bys",
+  "my",
+  "máte",
+  "rád",
+  "které",
+  "dělat",
+  "musíme",
+  "nemůžu",
+  "všechny",
+  "prostě",
+  "víc",
+  "den",
+  "chtěl",
+  "udělat",
+  "můžu",
+  "dva",
+  "stalo",
+  "mnou",
+  "jenom",
+  "kdy",
+  "jde",
+  "budeš",
+  "vaše",
+  "tvůj",
+  "další",
+  "ní",
+  "pojď",
+  "kvůli",
+  "měli",
+  "může",
+  "dost",
+  "jeden",
+  "oh",
+  "nikdo",
+  "bože",
+  "bez",
+  "ať",
+  "lidi",
+  "můžeš",
+  "své",
+  "dnes",
+  "víte",
+  "život",
+  "pár",
+  "tebou",
+  "právě",
+  "musí",
+  "dobrá",
+  "mně",
+  "jasně",
+  "děláš",
+  "sakra",
+  "děkuji",
+  "velmi",
+  "hodně",
+  "udělal",
+  "její",
+  "budeme",
+  "takhle",
+  "jim",
+  "věci",
+  "ses",
+  "hned",
+  "musíš",
+  "děje",
+  "proto",
+  "té",
+  "tvoje",
+  "říkal",
+  "vůbec",
+  "pravdu",
+  "nejsem",
+  "ona",
+  "nechci",
+  "zpátky",
+  "bychom",
+  "vědět",
+  "první",
+  "naše",
+  "místo",
+  "nemám",
+  "práci",
+  "byli",
+  "můžeme",
+  "práce",
+  "vypadá",
+  "řekla",
+  "přesně",
+  "chce",
+  "myslel",
+  "byste",
+  "něj",
+  "kam",
+  "let",
+  "kdyby",
+  "čas",
+  "tři",
+  "jejich",
+  "mé",
+  "svou",
+  "vždycky",
+  "dlouho",
+  "podívej",
+  "viděl",
+  "věc",
+  "domů",
+  "pryč",
+  "mluvit",
+  "zase",
+  "ním",
+  "dobré",
+  "tobě",
+  "sám",
+  "jdeme",
+  "sebe",
+  "chcete",
+  "někdy",
+  "promiň",
+  "abys",
+  "stejně",
+  "jednou",
+  "můžete",
+  "dál",
+  "ráda",
+  "která",
+  "ke",
+  "vlastně",
+  "vidět",
+  "mohla",
+  "peníze",
+  "cože",
+  "počkej",
+  "hele",
+  "omlouvám",
+  "každý",
+  "noc",
+  "dostat",
+  "lidé",
+  "nejlepší",
+  "fajn",
+  "spolu",
+  "určitě",
+  "poslední",
+  "váš",
+  "řekni",
+  "nějaké",
+  "večer",
+  "nebude",
+  "dej",
+  "chtěla",
+  "ráno",
+  "dítě",
+  "problém",
+  "budou",
+  "žádné",
+  "říká",
+  "mají",
+  "někoho",
+  "jistě",
+  "mezi",
+  "fakt",
+  "děti",
+  "paní",
+  "ok",
+  "také",
+  "přišel",
+  "nějaký",
+  "rychle",
+  "nech",
+  "podle",
+  "sis",
+  "znamená",
+  "budete",
+  "pravda",
+  "svůj",
+  "vše",
+  "kolik",
+  "zlato",
+  "dvě",
+  "mami",
+  "těch",
+  "lepší",
+  "chvíli",
+  "žádný",
+  "znovu",
+  "nebyl",
+  "pod",
+  "snad",
+  "kterou",
+  "otec",
+  "úplně",
+  "jedna",
+  "pohodě",
+  "lidí",
+  "při",
+  "promiňte",
+  "tenhle",
+  "samozřejmě",
+  "dokud",
+  "třeba",
+  "celý",
+  "najít",
+  "čem",
+  "jméno",
+  "ven",
+  "dát",
+  "jdu",
+  "myslíte",
+  "náš",
+  "stále",
+  "zrovna",
+  "tati",
+  "kurva",
+  "mohli",
+  "potom",
+  "žena",
+  "muž",
+  "dostal",
+  "přes",
+  "dělá",
+  "zítra",
+  "byly",
+  "člověk",
+  "dal",
+  "potřebuju",
+  "proti",
+  "mého",
+  "pomoc",
+  "vidím",
+  "jedno",
+  "myslela",
+  "nich",
+  "líto",
+  "dneska",
+  "nemůžeš",
+  "věděl",
+  "ví",
+  "děkuju",
+  "nemá",
+  "neměl",
+  "svého",
+  "jaký",
+  "pomoct",
+  "musíte",
+  "říkám",
+  "muset",
+  "auto",
+  "tvé",
+  "jdi",
+  "doma",
+  "doufám",
+  "oni",
+  "kdybych",
+  "abyste",
+  "jednu",
+  "štěstí",
+  "sama",
+  "vlastní",
+  "tolik",
+  "kteří",
+  "celou",
+  "sobě",
+  "tedy",
+  "nebudu",
+  "teda",
+  "vzít",
+  "pan",
+  "říkala",
+  "nechat",
+  "pojďme",
+  "vámi",
+  "běž",
+  "příliš",
+  "nejsou",
+  "řeknu",
+  "líbí",
+  "zabít",
+  "námi",
+  "toto",
+  "kámo",
+  "minut",
+  "uvidíme",
+  "našel",
+  "nebylo",
+  "jaké",
+  "slyšel",
+  "sebou",
+  "udělala",
+  "abychom",
+  "viděla",
+  "musel",
+  "zabil",
+  "všem",
+  "přece",
+  "matka",
+  "nemůže",
+  "táta",
+  "myslí",
+  "máma",
+  "tento",
+  "tyhle",
+  "chlap",
+  "přímo",
+  "což",
+  "přestaň",
+  "stát",
+  "nějak",
+  "podívejte",
+  "počkat",
+  "nejsi",
+  "nemáš",
+  "nebyla",
+  "miluju",
+  "vždy",
+  "včera",
+  "koho",
+  "nápad",
+  "pět",
+  "pozor",
+  "oba",
+  "vidíš",
+  "mou",
+  "pojďte",
+  "noci",
+  "skoro",
+  "kolem",
+  "jinak",
+  "později",
+  "buď",
+  "takový",
+  "ruce",
+  "zpět",
+  "času",
+  "správně",
+  "nad",
+  "chápu",
+  "srdce",
+  "zemi",
+  "jednoho",
+  "promluvit",
+  "ostatní",
+  "muže",
+  "tuhle",
+  "velký",
+  "života",
+  "mohu",
+  "haló",
+  "celé",
+  "dobrou",
+  "vrátit",
+  "cokoliv",
+  "dělám",
+  "číslo",
+  "šel",
+  "odsud",
+  "poslouchej",
+  "jiného",
+  "venku",
+  "docela",
+  "nemůžeme",
+  "děláte",
+  "dům",
+  "naší",
+  "jistý",
+  "všech",
+  "pozdě",
+  "více",
+  "tahle",
+  "dám",
+  "nějakou",
+  "skvělé",
+  "znám",
+  "skvělý",
+  "cítím",
+  "předtím",
+  "vždyť",
+  "dveře",
+  "brzy",
+  "stane",
+  "půjdu",
+  "přijde",
+  "zatím",
+  "dovnitř",
+  "zdá",
+  "vzal",
+  "svět",
+  "hodin",
+  "konec",
+  "zde",
+  "potřebujeme",
+  "nový",
+  "důvod",
+  "vaší",
+  "udělám",
+  "světě",
+  "svým",
+  "přišla",
+  "čím",
+  "špatně",
+  "čtyři",
+  "zbraň",
+  "žít",
+  "zní",
+  "někde",
+  "ni",
+  "aspoň",
+  "dokonce",
+  "dřív",
+  "super",
+  "dělal",
+  "jasný",
+  "dejte",
+  "zůstat",
+  "nechceš",
+  "ach",
+  "týden",
+  "holka",
+  "našli",
+  "jiný",
+  "páni",
+  "mohlo",
+  "konečně",
+  "vaši",
+  "svoje",
+  "nechte",
+  "žádná",
+  "nemáme",
+  "pocit",
+  "radši",
+  "rok",
+  "dolů",
+  "hrát",
+  "věcí",
+  "této",
+  "nemyslím",
+  "nejde",
+  "víme",
+  "smrti",
+  "čas.",
+  "něm",
+  "říkáš",
+  "daleko",
+  "nechal",
+  "těžké",
+  "kluk",
+  "možné",
+  "mrtvý",
+  "dobu",
+  "tělo",
+  "the",
+  "ženy",
+  "věřit",
+  "hlavu",
+  "potřebuji",
+  "tvá",
+  "nechtěl",
+  "dolarů",
+  "jediný",
+  "oči",
+  "muži",
+  "ně",
+  "potřebuje",
+  "chvilku",
+  "způsob",
+  "přijít",
+  "podívat",
+  "naši",
+  "chlape",
+  "tomhle",
+  "slečno",
+  "chtít",
+  "cestě",
+  "dny",
+  "roky",
+  "nemohl",
+  "mluvíš",
+  "takové",
+  "dělej",
+  "přítel",
+  "neměla",
+  "slovo",
+  "nyní",
+  "jídlo",
+  "syn",
+  "během",
+  "domu",
+  "strach",
+  "mnohem",
+  "policie",
+  "moji",
+  "čau",
+  "bůh",
+  "malý",
+  "šanci",
+  "problémy",
+  "věděla",
+  "cestu",
+  "místě",
+  "tvou",
+  "neřekl",
+  "tou",
+  "hodiny",
+  "tys",
+  "plán",
+  "doby",
+  "říkat",
+  "počkejte",
+  "jdeš",
+  "ženu",
+  "případ",
+  "otce",
+  "chtějí",
+  "jich",
+  "jistá",
+  "vězení",
+  "skvěle",
+  "doktore",
+  "nové",
+  "stačí",
+  "pěkně",
+  "mým",
+  "země",
+  "mimo",
+  "neviděl",
+  "auta",
+  "nejdřív",
+  "loď",
+  "snažím",
+  "prdele",
+  "pánové",
+  "doktor",
+  "dá",
+  "uh",
+  "odejít",
+  "řekněte",
+  "rozhodně",
+  "životě",
+  "dala",
+  "mojí",
+  "nahoru",
+  "stojí",
+  "rodina",
+  "potřebovat",
+  "velké",
+  "smysl",
+  "dne",
+  "copak",
+  "zdravím",
+  "pouze",
+  "drž",
+  "vypadáš",
+  "jasné",
+  "mluvil",
+  "chyba",
+  "krev",
+  "rozumím",
+  "dostala",
+  "madam",
+  "ruku",
+  "new",
+  "mělo",
+  "smrt",
+  "nemůžete",
+  "telefon",
+  "taková",
+  "přátelé",
+  "rodiče",
+  "šest",
+  "nikoho",
+  "ono",
+  "pracovat",
+  "jmenuje",
+  "tým",
+  "nimi",
+  "poprvé",
+  "začít",
+  "spát",
+  "uvnitř",
+  "seš",
+  "kdybys",
+  "nakonec",
+  "školy",
+  "mnoho",
+  "špatné",
+  "jiné",
+  "vezmu",
+  "jediná",
+  "začal",
+  "nevadí",
+  "lety",
+  "zeptat",
+  "dr.",
+  "spíš",
+  "holky",
+  "pomoci",
+  "příběh",
+  "svých",
+  "jaká",
+  "spoustu",
+  "zvláštní",
+  "naprosto",
+  "bratr",
+  "večeři",
+  "viděli",
+  "deset",
+  "šla",
+  "nemáte",
+  "syna",
+  "potřebuješ",
+  "kapitáne",
+  "případě",
+  "mém",
+  "půl",
+  "větší",
+  "našla",
+  "kluci",
+  "mých",
+  "nemusíš",
+  "aha",
+  "znáš",
+  "odtud",
+  "chceme",
+  "nechce",
+  "část",
+  "města",
+  "našeho",
+  "uděláme",
+  "město",
+  "vašeho",
+  "přišli",
+  "raději",
+  "zavolat",
+  "tvého",
+  "dole",
+  "nějaká",
+  "nejspíš",
+  "pokoj",
+  "zprávy",
+  "kromě",
+  "domě",
+  "důležité",
+  "myslet",
+  "mne",
+  "několik",
+  "neboj",
+  "udělali",
+  "všude",
+  "velká",
+  "jet",
+  "věřím",
+  "šlo",
+  "rodinu",
+  "nevíš",
+  "malá",
+  "zastavit",
+  "musela",
+  "říkají",
+  "alespoň",
+  "velice",
+  "bezpečí",
+  "slyšela",
+  "vidíte",
+  "takového",
+  "mrzí",
+  "chtěli",
+  "navíc",
+  "dní",
+  "klid",
+  "možnost",
+  "starý",
+  "tohoto",
+  "dostali",
+  "čeho",
+  "nedělej",
+  "snaží",
+  "uvěřit",
+  "čemu",
+  "nemohu",
+  "zavolám",
+  "udělej",
+  "zjistit",
+  "pamatuješ",
+  "t",
+  "téhle",
+  "líp",
+  "peněz",
+  "rádi",
+  "záleží",
+  "nebudeš",
+  "lidem",
+  "městě",
+  "světa",
+  "straně",
+  "dámy",
+  "tyto",
+  "mluví",
+  "slyšet",
+  "svém",
+  "hlavy",
+  "půjdeme",
+  "proboha",
+  "čeká",
+  "čekat",
+  "jděte",
+  "jakou",
+  "malé",
+  "pokoji",
+  "nevěděl",
+  "neví",
+  "ah",
+  "kterého",
+  "najednou",
+  "druhé",
+  "zbraně",
+  "dcera",
+  "špatný",
+  "půjde",
+  "vrátil",
+  "odkud",
+  "neměli",
+  "sestra",
+  "tajemství",
+  "zemřel",
+  "každou",
+  "cesty",
+  "škole",
+  "lépe",
+  "zbytek",
+  "tuto",
+  "sex",
+  "kým",
+  "támhle",
+  "dělají",
+  "nechápu",
+  "překlad",
+  "jakmile",
+  "dostane",
+  "okay",
+  "svoji",
+  "snažil",
+  "hrozně",
+  "vrátím",
+  "chodit",
+  "manžel",
+  "nejsme",
+  "neříkej",
+  "zprávu",
+  "chlapi",
+  "zůstaň",
+  "klidně",
+  "hlavní",
+  "místa",
+  "našich",
+  "vezmi",
+  "pana",
+  "ode",
+  "skutečnosti",
+  "hodinu",
+  "běžte",
+  "informace",
+  "však",
+  "srandu",
+  "nikomu",
+  "zatímco",
+  "začíná",
+  "šéfe",
+  "poslal",
+  "blízko",
+  "žádnou",
+  "náhodou",
+  "někam",
+  "celá",
+  "mysli",
+  "charlie",
+  "hlavně",
+  "nahoře",
+  "tomto",
+  "rukou",
+  "vede",
+  "vzala",
+  "skutečně",
+  "držet",
+  "vrátí",
+  "výborně",
+  "znáte",
+  "rande",
+  "druhý",
+  "někým",
+  "dostanu",
+  "vlasy",
+  "tudy",
+  "nechtěla",
+  "tato",
+  "takovou",
+  "slova",
+  "době",
+  "rozhodnutí",
+  "vedle",
+  "patří",
+  "žije",
+  "člověka",
+  "nohy",
+  "láska",
+  "prý",
+  "neudělal",
+  "velkou",
+  "řekli",
+  "naživu",
+  "nejste",
+  "rodiny",
+  "zachránit",
+  "policii",
+  "panebože",
+  "týdny",
+  "normální",
+  "mluvím",
+  "měsíc",
+  "tentokrát",
+  "největší",
+  "vrať",
+  "odešel",
+  "sami",
+  "ohledně",
+  "okamžitě",
+  "blázen",
+  "společnost",
+  "bejt",
+  "často",
+  "bojovat",
+  "blur0.7",
+  "právo",
+  "zač",
+  "úžasné",
+  "šance",
+  "ukaž",
+  "3ch0f0d15",
+  "těmi",
+  "pěkný",
+  "nemohla",
+  "němu",
+  "občas",
+  "představit",
+  "tisíc",
+  "prachy",
+  "lodi",
+  "přísahám",
+  "neřekla",
+  "otázka",
+  "věř",
+  "jménem",
+  "nebudeme",
+  "tehdy",
+  "poslouchejte",
+  "měsíce",
+  "strašně",
+  "jseš",
+  "sbohem",
+  "ztratil",
+  "cesta",
+  "stejné",
+  "cenu",
+  "starosti",
+  "joe",
+};
+const uint16_t WA_FREQ_28_RANKS[] = {
+  0, 0, 0, 0, 226, 0, 0, 0, 0, 0, 339, 0, 0, 0, 0, 319,
+  972, 99, 54, 290, 476, 651, 772, 102, 487, 558, 155, 373, 604, 778, 982, 968,
+  983, 0, 0, 966, 0, 0, 0, 0, 0, 0, 0, 0, 0, 183, 0, 785,
+  0, 0, 0, 30, 302, 768, 505, 998, 0, 0, 179, 538, 802, 352, 0, 202,
+  576, 0, 0, 0, 0, 0, 0, 0, 0, 566, 193, 0, 0, 0, 103, 0,
+  76, 0, 0, 898, 411, 0, 175, 0, 0, 58, 107, 310, 132, 0, 0, 12,
+  657, 850, 919, 0, 862, 0, 0, 0, 0, 0, 950, 0, 0, 0, 0, 851,
+  0, 0, 0, 0, 839, 498, 0, 0, 0, 36, 868, 0, 463, 0, 0, 0,
+  0, 798, 0, 659, 813, 0, 161, 93, 148, 109, 84, 613, 905, 0, 0, 393,
+  0, 467, 0, 96, 164, 909, 431, 0, 0, 986, 682, 177, 607, 736, 218, 45,
+  559, 881, 0, 0, 68, 311, 334, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 458, 582, 0, 0, 391, 44, 629, 828, 25, 258, 572, 598, 608,
+  782, 981, 0, 0, 287, 399, 156, 0, 975, 548, 800, 0, 0, 0, 0, 0,
+  191, 874, 494, 702, 336, 664, 51, 502, 493, 0, 0, 0, 0, 0, 875, 961,
+  821, 0, 0, 640, 0, 0, 0, 0, 0, 535, 684, 0, 770, 0, 0, 0,
+  29, 247, 826, 0, 0, 0, 524, 0, 229, 365, 0, 0, 0, 0, 0, 949,
+  0, 152, 74, 174, 187, 224, 225, 246, 471, 588, 661, 127, 268, 483, 869, 739,
+  0, 169, 549, 616, 143, 665, 707, 0, 0, 514, 0, 906, 176, 0, 0, 643,
+  0, 0, 446, 0, 351, 0, 0, 642, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 985, 0, 977, 646, 173, 753, 0, 0, 0, 212, 534, 0, 0, 0,
+  0, 0, 53, 49, 137, 314, 389, 88, 94, 675, 56, 685, 727, 853, 126, 886,
+  0, 0, 207, 478, 592, 841, 666, 597, 0, 934, 0, 0, 0, 0, 31, 0,
+  0, 0, 345, 0, 0, 0, 0, 0, 230, 199, 663, 0, 539, 620, 0, 135,
+  544, 633, 0, 0, 0, 0, 0, 656, 721, 0, 0, 0, 775, 0, 0, 0,
+  0, 0, 758, 0, 0, 0, 967, 0, 252, 973, 0, 0, 318, 0, 525, 895,
+  0, 0, 0, 80, 382, 0, 0, 0, 0, 0, 0, 0, 997, 0, 0, 0,
+  0, 835, 92, 359, 265, 760, 480, 234, 699, 926, 41, 419, 449, 729, 914, 517,
+  0, 978, 397, 4, 150, 180, 501, 260, 569, 67, 908, 28, 32, 526, 315, 379,
+  947, 969, 462, 350, 563, 516, 932, 320, 356, 773, 0, 141, 766, 550, 0, 0,
+  0, 769, 307, 0, 0, 0, 0, 0, 0, 0, 0, 691, 716, 596, 0, 0,
+  649, 0, 0, 98, 824, 0, 0, 0, 0, 0, 490, 308, 324, 241, 295, 903,
+  0, 167, 375, 0, 0, 0, 528, 652, 587, 0, 0, 0, 210, 0, 696, 0,
+  144, 920, 477, 0, 594, 327, 799, 0, 0, 0, 873, 0, 0, 0, 779, 0,
+  0, 232, 0, 486, 644, 0, 0, 0, 0, 0, 0, 694, 0, 0, 0, 0,
+  0, 680, 725, 746, 0, 0, 0, 554, 894, 0, 445, 223, 354, 435, 0, 0,
+  0, 0, 928, 0, 430, 0, 0, 0, 621, 440, 0, 0, 0, 935, 0, 422,
+  171, 617, 0, 0, 0, 0, 0, 108, 0, 811, 0, 0, 0, 256, 0, 0,
+  0, 0, 0, 876, 0, 0, 0, 0, 0, 837, 0, 0, 0, 0, 0, 418,
+  674, 931, 0, 658, 0, 0, 482, 0, 0, 790, 0, 0, 301, 901, 0, 952,
+  754, 595, 0, 195, 168, 0, 0, 0, 807, 0, 817, 408, 660, 0, 0, 198,
+  65, 75, 0, 415, 673, 693, 78, 752, 211, 374, 162, 341, 999, 0, 749, 178,
+  205, 780, 921, 0, 242, 0, 0, 0, 0, 0, 491, 23, 0, 456, 163, 157,
+  209, 0, 0, 827, 7, 845, 567, 795, 942, 387, 509, 117, 34, 111, 783, 0,
+  0, 0, 0, 0, 964, 0, 0, 0, 0, 0, 852, 0, 138, 0, 257, 48,
+  344, 313, 945, 946, 0, 0, 0, 0, 129, 63, 79, 82, 599, 715, 885, 0,
+  0, 0, 0, 0, 0, 208, 245, 645, 893, 717, 816, 0, 0, 0, 0, 472,
+  0, 0, 724, 0, 0, 0, 52, 570, 573, 857, 0, 0, 0, 0, 262, 610,
+  378, 710, 38, 303, 700, 0, 0, 0, 520, 641, 353, 927, 0, 0, 0, 0,
+  0, 0, 0, 216, 0, 0, 299, 953, 0, 43, 0, 0, 0, 0, 0, 0,
+  0, 912, 0, 593, 500, 0, 0, 747, 0, 0, 0, 0, 728, 764, 0, 0,
+  298, 19, 923, 300, 917, 0, 0, 0, 0, 0, 0, 0, 0, 625, 0, 400,
+  0, 189, 255, 872, 0, 0, 194, 0, 0, 991, 395, 0, 0, 0, 0, 510,
+  0, 0, 0, 0, 635, 124, 228, 532, 116, 280, 689, 35, 971, 0, 153, 632,
+  479, 936, 413, 705, 0, 140, 0, 61, 0, 0, 0, 0, 0, 122, 615, 85,
+  789, 488, 170, 40, 481, 519, 3, 91, 340, 384, 404, 306, 464, 609, 72, 288,
+  959, 159, 291, 238, 0, 499, 0, 0, 0, 0, 0, 871, 0, 312, 438, 803,
+  322, 865, 0, 858, 6, 0, 0, 0, 0, 0, 0, 0, 266, 0, 503, 0,
+  0, 297, 372, 653, 738, 0, 0, 0, 940, 583, 0, 119, 0, 0, 0, 762,
+  819, 0, 0, 791, 292, 321, 925, 474, 0, 0, 0, 459, 0, 0, 432, 788,
+  0, 0, 0, 0, 0, 0, 331, 648, 0, 0, 0, 506, 0, 0, 0, 748,
+  26, 475, 0, 233, 0, 0, 425, 0, 343, 0, 0, 0, 0, 394, 513, 0,
+  0, 0, 877, 815, 0, 0, 0, 584, 407, 0, 650, 0, 0, 0, 781, 0,
+  0, 279, 106, 555, 883, 222, 388, 434, 0, 0, 0, 368, 580, 0, 0, 787,
+  0, 0, 237, 240, 0, 0, 83, 115, 363, 0, 0, 0, 0, 669, 523, 0,
+  0, 0, 0, 0, 0, 0, 0, 201, 864, 401, 941, 655, 0, 741, 0, 0,
+  0, 437, 0, 0, 0, 0, 0, 0, 0, 0, 14, 910, 668, 0, 0, 0,
+  104, 151, 390, 820, 0, 0, 0, 0, 0, 731, 0, 55, 0, 0, 0, 0,
+  466, 0, 786, 371, 204, 412, 13, 304, 687, 284, 907, 470, 957, 381, 541, 989,
+  16, 0, 86, 0, 383, 128, 603, 0, 0, 774, 0, 0, 0, 0, 105, 22,
+  0, 606, 0, 0, 0, 0, 0, 0, 0, 0, 130, 392, 0, 0, 185, 0,
+  0, 0, 0, 911, 10, 0, 0, 154, 0, 0, 784, 0, 71, 987, 622, 66,
+  943, 0, 0, 0, 0, 0, 0, 0, 0, 533, 0, 0, 358, 110, 317, 638,
+  755, 847, 89, 0, 0, 703, 0, 0, 823, 188, 0, 441, 0, 0, 954, 0,
+  0, 0, 0, 916, 146, 420, 0, 619, 836, 206, 880, 332, 863, 0, 0, 560,
+  0, 0, 0, 0, 695, 275, 922, 0, 0, 0, 436, 366, 0, 0, 0, 0,
+  380, 0, 0, 0, 0, 0, 750, 0, 118, 0, 0, 0, 996, 0, 870, 976,
+  0, 21, 929, 0, 939, 323, 0, 0, 90, 184, 965, 0, 0, 518, 0, 0,
+  0, 0, 0, 0, 285, 243, 579, 956, 0, 251, 296, 553, 269, 958, 342, 0,
+  0, 860, 627, 0, 0, 0, 0, 203, 751, 737, 182, 951, 0, 357, 0, 0,
+  0, 0, 540, 0, 0, 0, 0, 712, 0, 0, 0, 9, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 369, 428, 0, 0, 992, 671, 697, 734, 854, 897, 0,
+  335, 0, 0, 667, 0, 8, 0, 293, 294, 62, 325, 521, 963, 0, 42, 0,
+  0, 455, 409, 930, 249, 0, 0, 0, 181, 530, 0, 414, 0, 0, 0, 95,
+  0, 0, 0, 0, 0, 0, 0, 0, 605, 0, 0, 962, 214, 0, 100, 0,
+  0, 0, 637, 0, 447, 0, 0, 0, 0, 0, 0, 0, 0, 0, 149, 220,
+  708, 0, 0, 0, 338, 0, 0, 585, 337, 515, 924, 0, 537, 825, 884, 0,
+  577, 0, 0, 918, 543, 57, 0, 0, 0, 0, 611, 330, 37, 254, 879, 360,
+  0, 0, 0, 0, 0, 497, 575, 0, 273, 970, 0, 355, 289, 720, 812, 794,
+  840, 259, 0, 756, 980, 0, 0, 0, 213, 0, 0, 856, 0, 492, 0, 347,
+  796, 0, 0, 690, 0, 846, 0, 123, 27, 329, 274, 771, 995, 744, 672, 713,
+  759, 0, 253, 0, 0, 0, 677, 0, 286, 0, 0, 0, 0, 662, 688, 0,
+  113, 0, 0, 0, 913, 0, 0, 17, 0, 0, 0, 0, 0, 120, 349, 0,
+  0, 0, 0, 0, 385, 0, 0, 0, 417, 73, 984, 723, 0, 0, 0, 0,
+  647, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 316, 0, 0, 511, 0,
+  0, 0, 0, 797, 0, 87, 0, 50, 0, 0, 264, 451, 0, 0, 683, 0,
+  0, 261, 405, 190, 424, 426, 507, 709, 239, 283, 0, 0, 0, 806, 219, 678,
+  743, 0, 0, 468, 730, 0, 0, 0, 0, 0, 618, 777, 0, 11, 0, 0,
+  0, 0, 0, 0, 0, 457, 0, 767, 843, 0, 0, 522, 552, 867, 0, 0,
+  899, 0, 0, 0, 0, 97, 614, 0, 861, 145, 955, 0, 0, 626, 890, 0,
+  0, 0, 0, 0, 410, 849, 0, 988, 0, 489, 0, 0, 0, 0, 39, 0,
+  719, 545, 960, 18, 423, 628, 361, 453, 1000, 485, 0, 139, 0, 0, 133, 0,
+  0, 0, 0, 0, 0, 565, 200, 571, 0, 235, 0, 0, 0, 0, 2, 844,
+  0, 416, 809, 0, 0, 0, 0, 0, 0, 0, 421, 452, 0, 386, 686, 0,
+  0, 0, 556, 0, 0, 0, 0, 0, 0, 215, 142, 0, 248, 765, 805, 887,
+  270, 706, 0, 0, 0, 0, 0, 0, 465, 305, 267, 855, 948, 0, 681, 244,
+  889, 0, 679, 0, 0, 0, 902, 0, 0, 776, 0, 77, 0, 166, 0, 0,
+  0, 578, 792, 0, 0, 0, 0, 0, 0, 574, 0, 0, 692, 0, 818, 0,
+  134, 236, 0, 0, 101, 24, 406, 878, 0, 0, 402, 0, 439, 531, 0, 70,
+  0, 0, 469, 33, 938, 0, 0, 15, 362, 278, 993, 1, 160, 376, 0, 0,
+  0, 326, 450, 704, 891, 590, 882, 937, 309, 427, 0, 0, 0, 0, 0, 0,
+  0, 900, 0, 612, 624, 0, 0, 0, 602, 0, 158, 0, 0, 0, 0, 0,
+  0, 0, 0, 639, 81, 763, 859, 0, 0, 0, 0, 0, 0, 0, 0, 59,
+  227, 568, 761, 742, 933, 512, 0, 0, 833, 0, 0, 0, 136, 0, 0, 842,
+  0, 0, 0, 0, 557, 495, 112, 591, 830, 281, 396, 542, 333, 121, 990, 47,
+  0, 370, 448, 0, 0, 0, 735, 0, 0, 718, 0, 994, 192, 0, 0, 346,
+  561, 896, 0, 0, 547, 804, 250, 733, 0, 0, 0, 0, 0, 0, 529, 0,
+  0, 546, 0, 0, 701, 0, 429, 461, 623, 634, 698, 0, 0, 0, 0, 444,
+  0, 165, 848, 186, 0, 0, 0, 0, 888, 527, 276, 377, 601, 0, 822, 654,
+  0, 196, 757, 711, 403, 564, 581, 722, 732, 600, 892, 0, 808, 866, 670, 217,
+  398, 810, 904, 0, 0, 0, 0, 484, 60, 0, 0, 147, 0, 131, 0, 589,
+  64, 0, 0, 915, 0, 0, 0, 0, 0, 0, 0, 0, 367, 0, 726, 832,
+  0, 562, 974, 272, 504, 979, 0, 508, 0, 0, 0, 473, 586, 838, 0, 0,
+  433, 0, 277, 328, 0, 0, 0, 348, 0, 0, 114, 0, 0, 0, 631, 0,
+  69, 172, 0, 263, 0, 197, 0, 0, 0, 0, 0, 0, 0, 125, 460, 829,
+  630, 5, 221, 271, 834, 0, 0, 551, 0, 0, 0, 442, 793, 0, 0, 0,
+  0, 20, 0, 0, 814, 0, 676, 0, 0, 0, 0, 0, 0, 636, 0, 0,
+  0, 0, 0, 0, 496, 714, 454, 0, 0, 944, 0, 0, 536, 745, 801, 443,
+  831, 0, 0, 0, 0, 0, 0, 0, 0, 282, 0, 364, 0, 231, 46, 740,
+};
+
+const char *WA_FREQ_29_TOKENS[] = {
+  "тата",
+  "çулта",
+  "çулхи",
+  "те",
+  "пулнă",
+  "Чăваш",
+  "та",
+  "вырнаçнă",
+  "вăл",
+  "çын",
+  "хыççăн",
+  "пулса",
+  "уйăхĕн",
+  "çул",
+  "ял",
+  "ăна",
+  "чăваш",
+  "çуралнă",
+  "пулать",
+  "тĕп",
+  "пур",
+  "чи",
+  "е",
+  "пĕр",
+  "вара",
+  "пин",
+  "районĕнчи",
+  "çулсенче",
+  "кĕнĕ",
+  "усă",
+  "çинче",
+  "патшалăх",
+  "кĕрет",
+  "çине",
+  "çак",
+  "унăн",
+  "ялĕнче",
+  "тухнă",
+  "Енĕн",
+  "пысăк",
+  "çултанпа",
+  "паллă",
+  "пĕрремĕш",
+  "шутне",
+  "халăх",
+  "икĕ",
+  "хăйĕн",
+  "туса",
+  "мар",
+  "тăрать",
+  "хула",
+  "пекех",
+  "Аслă",
+  "тăрăх",
+  "тесе",
+  "чухне",
+  "нумай",
+  "Вăл",
+  "илнĕ",
+  "Çак",
+  "пурăнать",
+  "хули",
+  "шутланать",
+  "ĕçленĕ",
+  "пурăннă",
+  "Раççей",
+  "питĕ",
+  "çĕр",
+  "панă",
+  "Ку",
+  "уйăхĕнче",
+  "кайнă",
+  "анчах",
+  "ку",
+  "ятлă",
+  "чĕлхи",
+  "хунă",
+  "тĕрлĕ",
+  "вĕсем",
+  "йышĕ",
+  "хушшинче",
+  "тăнă",
+  "пирки",
+  "яхăн",
+  "хăй",
+  "хулинче",
+  "1",
+  "çав",
+  "тунă",
+  "хут",
+  "çырнă",
+  "ытла",
+  "ертсе",
+  "пуçланă",
+  "ячĕ",
+  "районĕ",
+  "ятне",
+  "пынă",
+  "вăтам",
+  "кунта",
+  "СССР",
+  "пек",
+  "енче",
+  "çеç",
+  "вилнĕ",
+  "чылай",
+  "вăхăтра",
+  "халĕ",
+  "районне",
+  "пĕрле",
+  "темиçе",
+  "вĕренсе",
+  "ялĕ",
+  "2",
+  "пайĕ",
+  "кăна",
+  "хальхи",
+  "кĕртнĕ",
+  "валли",
+  "хĕрринче",
+  "3",
+  "ун",
+  "ытти",
+  "ĕмĕрте",
+  "тухать",
+  "шыв",
+  "авалхи",
+  "вырăс",
+  "вĕреннĕ",
+  "Тĕп",
+  "çинчен",
+  "пуш",
+  "Шупашкар",
+  "никĕсленĕ",
+  "çар",
+  "йĕркеленĕ",
+  "патĕнче",
+  "Халăх",
+  "вырăнне",
+  "юпа",
+  "пĕри",
+  "2006",
+  "лаптăкĕ",
+  "Унăн",
+  "М.",
+  "районĕн",
+  "пуçласа",
+  "ĕç",
+  "ытларах",
+  "çухрăм",
+  "пĕтĕм",
+  "Çĕнĕ",
+  "кăларнă",
+  "хирĕç",
+  "кĕрекен",
+  "кураççĕ",
+  "тытса",
+  "чукун",
+  "ячĕллĕ",
+  "вĕсен",
+  "çулчен",
+  "май",
+  "унта",
+  "шкул",
+  "малтан",
+  "Мускав",
+  "çĕнĕ",
+  "тĕл",
+  "облаçĕн",
+  "Хĕрлĕ",
+  "вăрçă",
+  "Республикин",
+  "Юханшыв",
+  "тĕпĕ",
+  "Пĕрремĕш",
+  "лартнă",
+  "çу",
+  "вĕсене",
+  "кайран",
+  "юханшыв",
+  "янă",
+  "Çурçĕр",
+  "Çавăн",
+  "пĕтернĕ",
+  "тивĕçлĕ",
+  "урăх",
+  "Хула",
+  "пирĕн",
+  "А.",
+  "ĕмĕр",
+  "юхса",
+  "йышăннă",
+  "тухса",
+  "урлă",
+  "вырăн",
+  "1927",
+  "Анчах",
+  "çаплах",
+  "кун",
+  "тума",
+  "Тăван",
+  "илсе",
+  "теççĕ",
+  "Çав",
+  "Элĕк",
+  "аслă",
+  "патне",
+  "енчен",
+  "ĕçлет",
+  "4",
+  "утă",
+  "педагогика",
+  "Район",
+  "кĕреççĕ",
+  "каять",
+  "чӳк",
+  "çм",
+  "ç.",
+  "пула",
+  "ĕçе",
+  "Совет",
+  "пулсан",
+  "хăйсен",
+  "юхать",
+  "5",
+  "В.",
+  "виçĕ",
+  "шутланнă",
+  "литература",
+  "куçса",
+  "юлнă",
+  "чух",
+  "2005",
+  "район",
+  "мĕш",
+  "иртнĕ",
+  "тĕлне",
+  "тепĕр",
+  "чĕлхипе",
+  "вырăнта",
+  "10",
+  "Мăн",
+  "пĕчĕк",
+  "Халĕ",
+  "вăхăтĕнче",
+  "тинĕс",
+  "авăн",
+  "пуçне",
+  "пырать",
+  "тăваççĕ",
+  "çук",
+  "таран",
+  "тенĕ",
+  "Ăна",
+  "енĕпе",
+  "пĕлӳ",
+  "Ял",
+  "çынсем",
+  "килнĕ",
+  "хутшăннă",
+  "пулаççĕ",
+  "тăрăхĕ",
+  "пултарать",
+  "кăнтăр",
+  "Чи",
+  "ака",
+  "тăван",
+  "куçарнă",
+  "уесĕн",
+  "ĕмĕрĕн",
+  "Халăх йышĕ",
+  "млн",
+  "20",
+  "çурла",
+  "пуçламăшĕнче",
+  "Хальхи",
+  "шучĕ",
+  "Кăнтăр",
+  "И.",
+  "Департамент",
+  "Хусан",
+  "çитнĕ",
+  "Ун",
+  "тĕслĕ",
+  "вулăсне",
+  "вырăнĕнче",
+  "шурă",
+  "ларать",
+  "Вĕсем",
+  "Кун-çулĕ",
+  "çултан",
+  "вăрçи",
+  "çырса",
+  "иккĕмĕш",
+  "кĕнеке",
+  "курнă",
+  "2000",
+  "культура",
+  "кăрлачăн",
+  "вырăнĕ",
+  "уçнă",
+  "уйрăм",
+  "çĕртме",
+  "çурçĕр",
+  "илет",
+  "пурĕ",
+  "кашни",
+  "АПШ",
+  "çĕре",
+  "çинчи",
+  "Малтан",
+  "тава",
+  "чĕлхе",
+  "эрăччен",
+  "6",
+  "вĕçĕнче",
+  "сахал",
+  "2002",
+  "Кунта",
+  "кăтартнă",
+  "хĕрлĕ",
+  "и",
+  "тĕнчери",
+  "Вăтам",
+  "Етĕрне",
+  "Районта",
+  "евĕр",
+  "Атăл",
+  "тытăннă",
+  "15",
+  "совет",
+  "палăртнă",
+  "çухрăмра",
+  "пулма",
+  "Франци",
+  "иçĕм",
+  "1917",
+  "Пирĕн",
+  "вăй",
+  "çарĕсем",
+  "курма",
+  "çитет",
+  "юнашар",
+  "вăхăт",
+  "XIX",
+  "Ялта",
+  "хушши",
+  "Пурнăçĕ",
+  "пуçлăхĕ",
+  "тĕнче",
+  "çавăн",
+  "хатĕрленĕ",
+  "ят",
+  "ĕçне",
+  "патша",
+  "чĕлхине",
+  "çапла",
+  "сарăлнă",
+  "çити",
+  "Чĕмпĕр",
+  "хулине",
+  "вĕренме",
+  "сăмах",
+  "7",
+  "ĕçĕсене",
+  "Истори",
+  "ертӳçи",
+  "кирлĕ",
+  "2004",
+  "вырăнти",
+  "2008",
+  "çулĕ",
+  "официаллă",
+  "пурăнакан",
+  "çумĕнчи",
+  "нимĕç",
+  "хулана",
+  "хушшинчи",
+  "хулара",
+  "Çĕр",
+  "ÇП",
+  "км",
+  "шкулта",
+  "йышăнать",
+  "лайăх",
+  "раштавăн",
+  "ĕнтĕ",
+  "Мари",
+  "1999",
+  "ĕçченĕ",
+  "хăйне",
+  "м",
+  "12",
+  "1918",
+  "8",
+  "иртет",
+  "пыракан",
+  "30",
+  "Канаш",
+  "анăç",
+  "Александр",
+  "1941",
+  "çĕрĕсем",
+  "ялта",
+  "чăвашсем",
+  "чĕлхин",
+  "Н.",
+  "çыхăннă",
+  "Пушкăрт",
+  "Унта",
+  "2003",
+  "ача",
+  "вырăна",
+  "çавăнпа",
+  "пурăнаççĕ",
+  "Кĕçĕн",
+  "Шупашкарта",
+  "шкулĕнче",
+  "2007",
+  "наци",
+  "ятпа",
+  "ĕçлеме",
+  "Хура",
+  "метр",
+  "пайĕнче",
+  "куçнă",
+  "тапхăрĕнче",
+  "юханшывĕ",
+  "ячĕпе",
+  "Çĕрпӳ",
+  "тăвакан",
+  "тăракан",
+  "ятарлă",
+  "Республикинчи",
+  "сулахай",
+  "ярса",
+  "2001",
+  "1991",
+  "Çапла",
+  "Ленин",
+  "каллех",
+  "çурчĕ",
+  "Анăç",
+  "кăрлач",
+  "пайташĕ",
+  "хăш",
+  "анлă",
+  "илеççĕ",
+  "пурăнма",
+  "хуçалăх",
+  "облаçĕнчи",
+  "пулин",
+  "тухăç",
+  "уйрăлса",
+  "ăслăлăх",
+  "сорчĕ",
+  "1990",
+  "варринче",
+  "Иккĕмĕш",
+  "пуçланать",
+  "тивĕçнĕ",
+  "халăхĕ",
+  "25",
+  "парать",
+  "шутĕнче",
+  "1920",
+  "нарăсăн",
+  "хăвăрт",
+  "шутра",
+  "14",
+  "ĕмĕрсенче",
+  "1944",
+  "каярах",
+  "редакторĕ",
+  "ушкăнĕ",
+  "чаплă",
+  "Вырăс",
+  "Пăлхар",
+  "Хулара",
+  "1945",
+  "Германи",
+  "Кайран",
+  "каялла",
+  "çумĕнче",
+  "Тĕнче",
+  "вăрман",
+  "уйрăмĕ",
+  "членĕ",
+  "1992",
+  "Тухăç",
+  "вĕсенчен",
+  "йывăç",
+  "юлашки",
+  "Мускавра",
+  "хаçат",
+  "малтанхи",
+  "тесен",
+  "университечĕн",
+  "Çĕршывăн",
+  "вăйлă",
+  "енчи",
+  "кил",
+  "статья",
+  "9",
+  "Иван",
+  "килет",
+  "раштав",
+  "1965",
+  "1989",
+  "000",
+  "1939",
+  "çапса",
+  "çыннисем",
+  "ĕçĕ",
+  "кăнтăралла",
+  "туртса",
+  "1940",
+  "ĕçĕсем",
+  "ларнă",
+  "чăвашла",
+  "çĕнсе",
+  "Рим",
+  "витĕр",
+  "пулас",
+  "тытăнать",
+  "Пĕр",
+  "пине",
+  "ту",
+  "тупнă",
+  "I",
+  "тăршшĕ",
+  "100",
+  "XX",
+  "çарĕ",
+  "çирĕплетнĕ",
+  "вĕрентнĕ",
+  "кĕрсе",
+  "каланă",
+  "Раççейре",
+  "çĕрте",
+  "пĕлтерет",
+  "1943",
+  "Шупашкарти",
+  "пайне",
+  "сылтăм",
+  "институтĕнче",
+  "Атăлçи",
+  "облаçĕ",
+  "Николай",
+  "Хăйĕн",
+  "шывĕпе",
+  "йышне",
+  "куçать",
+  "18",
+  "2009",
+  "1930",
+  "Мускаври",
+  "юппи",
+  "ӳнер",
+  "йывăр",
+  "шывĕ",
+  "Çавăнпа",
+  "Вăрçă",
+  "патнелле",
+  "С.",
+  "чиркӳ",
+  "16",
+  "акăлчан",
+  "вырăсла",
+  "ушкăнне",
+  "хими",
+  "ята",
+  "илме",
+  "Çаплах",
+  "çӳллĕ",
+  "Авалхи",
+  "Вăрнар",
+  "пулман",
+  "тĕсĕ",
+  "50",
+  "Пĕтĕм",
+  "евĕрлĕ",
+  "тăраççĕ",
+  "40",
+  "II",
+  "çула",
+  "Г.",
+  "кайăк",
+  "тытăнаççĕ",
+  "çумне",
+  "1996",
+  "çĕрĕ",
+  "Самар",
+  "кăтартать",
+  "Раççейри",
+  "тăрăхĕнче",
+  "Владимир",
+  "Тепĕр",
+  "Тутарстанăн",
+  "патши",
+  "Патшалăх",
+  "тăватă",
+  "тери",
+  "хура",
+  "1997",
+  "çапах",
+  "Администраци",
+  "хĕрарăм",
+  "Китай",
+  "вăхăтрах",
+  "пурăну",
+  "таса",
+  "ашшĕ",
+  "танлашать",
+  "тытăнса",
+  "1994",
+  "çынна",
+  "çĕрĕсене",
+  "Ытларах",
+  "ирттернĕ",
+  "тĕпчев",
+  "1942",
+  "çумĕ",
+  "яла",
+  "1919",
+  "1962",
+  "Çакăн",
+  "çакăн",
+  "административлă",
+  "хутчен",
+  "шутланă",
+  "11",
+  "XVIII",
+  "Пысăк",
+  "ирĕк",
+  "йĕркеленнĕ",
+  "каяççĕ",
+  "урамĕ",
+  "1935",
+  "майлă",
+  "пултараççĕ",
+  "пырса",
+  "тухаççĕ",
+  "Вĕсен",
+  "арçын",
+  "çăлкуçĕ",
+  "Раççейĕн",
+  "лекнĕ",
+  "хытă",
+  "1967",
+  "в",
+  "тутар",
+  "япала",
+  "17",
+  "1993",
+  "Британи",
+  "енне",
+  "кăларса",
+  "килсе",
+  "1938",
+  "политика",
+  "районĕнче",
+  "çулччен",
+  "центрĕ",
+  "1937",
+  "çывăх",
+  "Патăръел",
+  "паха",
+  "пулă",
+  "тĕрĕк",
+  "чĕлхинче",
+  "2010",
+  "Çапах",
+  "га",
+  "патĕнчи",
+  "театр",
+  "хурать",
+  "ывăлĕ",
+  "1921",
+  "1957",
+  "22",
+  "çамрăк",
+  "мĕншĕн",
+  "тăрăхра",
+  "тапăнса",
+  "хăварнă",
+  "хайланă",
+  "çапăçу",
+  "çм²",
+  "П.",
+  "Пăва",
+  "тан",
+  "шутласа",
+  "ыттисем",
+  "1929",
+  "1959",
+  "1970",
+  "1979",
+  "çывăхĕнче",
+  "çыранĕнче",
+  "Европа",
+  "ирĕклĕ",
+  "патшалăхĕ",
+  "1934",
+  "çурт",
+  "иккĕ",
+  "мĕнле",
+  "пултарнă",
+  "сăмахран",
+  "тăрăхĕн",
+  "13",
+  "1998",
+  "К.",
+  "Кивĕ",
+  "Хусанти",
+  "пичетленсе",
+  "пухнă",
+  "ялтан",
+  "1925",
+  "Тури",
+  "вĕренӳ",
+  "палăртаççĕ",
+  "пулнипе",
+  "XVII",
+  "çӳренĕ",
+  "ăнăçлă",
+  "тапхăрĕ",
+  "уйрăмах",
+  "1956",
+  "ăслăлăхĕсен",
+  "раççей",
+  "халăхĕн",
+  "хастар",
+  "Икĕ",
+  "асăннă",
+  "чикĕ",
+  "ют",
+  "1968",
+  "вăрçине",
+  "кĕме",
+  "тĕнне",
+  "франци",
+  "1926",
+  "амăшĕ",
+  "йĕркелесе",
+  "пĕлтернĕ",
+  "каласа",
+  "пĕрлешет",
+  "пичетленĕ",
+  "урам",
+  "1960",
+  "çулăн",
+  "çулсем",
+  "°C",
+  "çурçĕрелле",
+  "паракан",
+  "тĕнчере",
+  "яраççĕ",
+  "ӳснĕ",
+  "Енри",
+  "аллине",
+  "пушă",
+  "19",
+  "1932",
+  "1964",
+  "Республики",
+  "сасă",
+  "1-мĕшĕнче",
+  "1961",
+  "1995",
+  "XVI",
+  "çç",
+  "çарне",
+  "çырма",
+  "Патăрьел",
+  "вăрăм",
+  "пурнăç",
+  "сайра",
+  "уйăх",
+  "шкула",
+  "вĕçсе",
+  "институчĕн",
+  "çырать",
+  "Вĕсене",
+  "институтне",
+  "пуçлать",
+  "ӳсет",
+  "1928",
+  "1975",
+  "23",
+  "çĕрне",
+  "Атăлăн",
+  "Ен",
+  "илемлĕ",
+  "хăйсем",
+  "500",
+  "çапăçнă",
+  "Турци",
+  "Чулхула",
+  "йăхĕсем",
+  "нарăс",
+  "пулнине",
+  "самай",
+  "тапхăрта",
+  "Иванович",
+  "енĕ",
+  "кăлараççĕ",
+  "кайса",
+  "кӳлĕ",
+  "уçă",
+  "ярать",
+  "26",
+  "çĕнĕрен",
+  "аркатнă",
+  "ачасене",
+  "истори",
+  "кĕске",
+  "параççĕ",
+  "пуян",
+  "хулин",
+  "ылтăн",
+  "1972",
+  "çарпуçĕ",
+  "аталаннă",
+  "номерĕ",
+  "унпа",
+  "Елчĕк",
+  "Туçи",
+  "Шыв",
+  "иртсен",
+  "пуçлаççĕ",
+  "пынипе",
+  "тăвать",
+  "территоринче",
+  "укçа",
+  "Ылтăн",
+  "патшалăхĕн",
+  "тинĕсĕ",
+  "ялавĕ",
+  "1-мĕш",
+  "1963",
+  "çынсене",
+  "Красноармейски",
+  "урамĕсем",
+  "чăвашсен",
+  "1924",
+  "çĕрсене",
+  "çитме",
+  "еннелле",
+  "тăвас",
+  "уесне",
+  "хураççĕ",
+  "хута",
+  "чĕлхисен",
+  "шкулне",
+  "экономика",
+  "эрех",
+  "этем",
+  "ялсем",
+  "1977",
+  "27",
+  "ĕçлекен",
+  "РСФСР",
+  "уесĕнчи",
+  "унтан",
+  "1988",
+  "апат",
+  "виççĕмĕш",
+  "тăрăшнă",
+  "1973",
+  "Иванов",
+  "Каярах",
+  "артисчĕ",
+  "тулли",
+  "1946",
+  "Çар",
+  "АССР",
+  "медицина",
+  "филологи",
+  "шайне",
+  "24",
+  "Итали",
+  "Кашни",
+  "Пурĕ",
+  "Яковлев",
+  "Ялав",
+  "алă",
+  "качча",
+  "пĕтĕмпех",
+  "пама",
+  "см",
+  "танлаштарсан",
+  "тытнă",
+  "1950",
+  "1986",
+  "28",
+  "епле",
+  "1969",
+  "21",
+  "драма",
+  "пуçламăш",
+  "1974",
+  "Хĕвел",
+  "кĕнеки",
+  "малалла",
+  "музейĕ",
+  "патшалăхне",
+  "хăшпĕр",
+  "яланах",
+  "1982",
+  "лартаççĕ",
+  "пункчĕ",
+  "тĕс",
+  "тинĕсĕн",
+  "тухма",
+  "тухсан",
+  "ушкăн",
+  "хушă",
+  "чӳкĕн",
+  "шутлаççĕ",
+  "1980",
+  "Википедин",
+  "1922",
+  "1978",
+  "III",
+  "çĕрĕнче",
+  "çакна",
+  "Кейӳ",
+  "спорт",
+  "теме",
+  "200",
+  "Нумай",
+  "вĕлернĕ",
+  "пайланать",
+  "пыраççĕ",
+  "чикки",
+  "«Чăваш",
+  "çапăçура",
+  "Вĕсенчен",
+  "Йĕпреç",
+  "Юлашки",
+  "йышши",
+  "килĕшӳ",
+  "тарăн",
+  "университетĕнче",
+  "училищинче",
+  "факультетне",
+  "Анат",
+  "Тăвай",
+  "Францин",
+  "Ытти",
+  "вырăссем",
+  "каярахпа",
+  "пăрахнă",
+  "секретарĕ",
+  "тӳрех",
+  "уйăхěн",
+  "чул",
+  "çыравçисен",
+  "АССРĕн",
+  "Хăш",
+  "пĕрлĕ",
+  "пĕрлешĕвĕн",
+  "хаçатăн",
+  "ялĕнчен",
+  "1976",
+  "çыхăну",
+  "кĕртеççĕ",
+  "миллион",
+  "палли",
+  "пурнăçа",
+  "утрав",
+  "хушнă",
+  "чĕлхиллĕ",
+  "1923",
+  "çулсен",
+  "çурма",
+  "Михаил",
+  "Урал",
+  "Ячĕ",
+  "кандидачĕ",
+  "пĕрремеш",
+  "республика",
+  "температура",
+  "тытăмĕ",
+  "хыпар",
+  "эрехтăвакан",
+  "1981",
+  "Муркаш",
+  "Украина",
+  "Чылай",
+  "вăхăта",
+  "вылянă",
+  "илсен",
+  "умĕн",
+  "1948",
+  "Шкул",
+  "вĕрентекен",
+  "грек",
+  "ирĕке",
+};
+const uint16_t WA_FREQ_29_RANKS[] = {
+  246, 0, 0, 746, 0, 189, 442, 0, 0, 0, 0, 0, 779, 0, 0, 41,
+  0, 0, 976, 0, 757, 313, 666, 0, 0, 0, 0, 0, 0, 0, 532, 0,
+  921, 0, 570, 732, 0, 856, 0, 265, 0, 820, 0, 649, 405, 799, 934, 884,
+  0, 0, 0, 937, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 409, 71,
+  178, 352, 796, 925, 0, 0, 0, 0, 0, 0, 0, 20, 0, 307, 808, 0,
+  0, 0, 0, 0, 306, 0, 185, 0, 0, 577, 379, 0, 0, 364, 0, 762,
+  0, 614, 0, 911, 0, 0, 229, 0, 0, 0, 0, 0, 29, 0, 0, 183,
+  0, 0, 0, 131, 176, 0, 0, 459, 0, 0, 0, 0, 634, 0, 0, 0,
+  0, 0, 995, 999, 0, 0, 889, 772, 0, 335, 662, 882, 0, 14, 0, 116,
+  25, 378, 0, 0, 235, 0, 0, 84, 0, 0, 254, 0, 323, 904, 826, 0,
+  0, 53, 801, 872, 0, 541, 0, 0, 0, 0, 0, 0, 0, 417, 0, 0,
+  0, 737, 946, 0, 0, 0, 576, 607, 224, 411, 466, 267, 670, 502, 794, 672,
+  0, 0, 28, 733, 194, 0, 797, 69, 0, 198, 0, 0, 735, 0, 778, 0,
+  0, 542, 173, 341, 0, 0, 0, 0, 773, 0, 0, 0, 0, 0, 507, 0,
+  885, 0, 24, 230, 625, 374, 843, 568, 0, 766, 667, 0, 129, 0, 0, 612,
+  426, 855, 400, 0, 0, 118, 0, 0, 0, 10, 119, 517, 858, 420, 416, 0,
+  0, 197, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 192, 12, 0,
+  943, 0, 0, 0, 0, 0, 0, 302, 0, 664, 0, 59, 0, 818, 0, 548,
+  0, 0, 0, 0, 0, 0, 336, 421, 0, 0, 0, 534, 392, 702, 96, 0,
+  0, 0, 0, 0, 0, 0, 628, 780, 0, 0, 0, 0, 236, 381, 0, 0,
+  0, 0, 0, 0, 654, 124, 348, 847, 0, 0, 0, 528, 0, 0, 473, 0,
+  0, 412, 966, 0, 0, 0, 0, 616, 970, 622, 86, 727, 0, 0, 0, 922,
+  0, 436, 0, 0, 134, 838, 0, 0, 499, 520, 30, 0, 0, 948, 987, 804,
+  329, 531, 764, 403, 127, 0, 0, 786, 592, 749, 870, 877, 0, 0, 489, 5,
+  903, 0, 0, 0, 0, 166, 83, 406, 455, 450, 415, 355, 498, 559, 761, 942,
+  950, 0, 0, 0, 638, 580, 935, 311, 103, 219, 40, 642, 791, 931, 594, 708,
+  637, 115, 9, 647, 807, 0, 913, 0, 0, 362, 589, 671, 977, 538, 962, 0,
+  0, 0, 0, 632, 241, 371, 0, 494, 624, 0, 0, 291, 606, 986, 0, 18,
+  368, 952, 325, 0, 43, 879, 0, 563, 0, 372, 586, 39, 205, 363, 419, 674,
+  491, 906, 752, 595, 51, 914, 310, 795, 984, 0, 0, 0, 650, 525, 661, 0,
+  626, 0, 0, 0, 0, 0, 983, 261, 113, 0, 423, 689, 0, 0, 825, 0,
+  386, 989, 0, 0, 0, 0, 251, 0, 0, 0, 546, 668, 0, 0, 247, 0,
+  0, 518, 0, 932, 982, 0, 0, 0, 0, 485, 0, 0, 0, 0, 0, 696,
+  620, 407, 0, 322, 301, 193, 0, 0, 0, 47, 0, 0, 438, 456, 610, 222,
+  0, 530, 0, 477, 0, 478, 0, 0, 0, 0, 35, 0, 0, 0, 0, 837,
+  0, 973, 0, 0, 0, 0, 0, 0, 111, 187, 15, 731, 0, 130, 160, 745,
+  760, 0, 0, 0, 793, 0, 990, 0, 268, 145, 0, 0, 0, 768, 433, 0,
+  0, 0, 454, 648, 303, 343, 418, 694, 539, 0, 0, 0, 848, 533, 0, 829,
+  0, 0, 0, 0, 0, 0, 0, 65, 0, 0, 0, 658, 462, 705, 0, 868,
+  0, 0, 920, 0, 0, 0, 869, 560, 435, 366, 98, 543, 747, 929, 376, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 770, 0, 0, 0, 0, 64, 272,
+  181, 1, 42, 168, 286, 927, 959, 980, 76, 101, 453, 0, 0, 3, 0, 758,
+  0, 636, 0, 317, 514, 573, 0, 7, 164, 22, 598, 0, 0, 367, 0, 830,
+  669, 0, 718, 0, 790, 0, 0, 0, 144, 0, 383, 0, 609, 0, 0, 0,
+  424, 0, 0, 0, 0, 0, 0, 631, 349, 0, 2, 0, 0, 686, 800, 850,
+  0, 72, 558, 0, 350, 562, 0, 842, 510, 0, 0, 0, 0, 0, 133, 138,
+  524, 0, 346, 0, 552, 215, 508, 787, 0, 0, 633, 0, 0, 0, 338, 656,
+  782, 0, 382, 798, 888, 257, 332, 79, 0, 0, 136, 92, 148, 0, 373, 0,
+  923, 0, 0, 588, 814, 360, 660, 484, 57, 487, 742, 806, 0, 232, 282, 139,
+  483, 0, 0, 0, 238, 0, 0, 0, 320, 0, 0, 0, 77, 0, 0, 526,
+  972, 536, 0, 771, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  767, 0, 0, 0, 0, 978, 0, 31, 659, 463, 813, 398, 0, 998, 151, 646,
+  0, 688, 617, 0, 0, 0, 260, 785, 48, 557, 0, 0, 273, 0, 0, 0,
+  38, 0, 0, 209, 445, 0, 0, 444, 0, 540, 0, 210, 945, 153, 0, 0,
+  100, 729, 0, 365, 34, 854, 0, 0, 0, 431, 0, 0, 0, 0, 781, 673,
+  226, 223, 0, 629, 0, 0, 213, 0, 396, 684, 714, 161, 357, 460, 458, 822,
+  834, 915, 691, 207, 0, 0, 344, 0, 0, 851, 969, 0, 0, 0, 449, 0,
+  0, 0, 0, 0, 147, 0, 88, 347, 0, 107, 199, 467, 522, 0, 0, 0,
+  0, 501, 653, 0, 0, 0, 214, 397, 0, 422, 815, 0, 0, 0, 0, 0,
+  726, 0, 0, 0, 0, 0, 0, 434, 643, 0, 0, 266, 0, 0, 353, 242,
+  0, 0, 297, 792, 0, 0, 370, 0, 0, 0, 0, 0, 0, 0, 0, 334,
+  299, 940, 0, 158, 596, 217, 393, 551, 717, 109, 0, 0, 1000, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 665, 887, 177, 298, 121, 871, 186,
+  958, 0, 0, 0, 789, 0, 916, 389, 399, 824, 21, 756, 0, 0, 0, 544,
+  0, 0, 0, 0, 0, 289, 0, 0, 27, 99, 237, 0, 468, 443, 0, 0,
+  0, 835, 0, 578, 875, 0, 709, 0, 0, 0, 475, 0, 0, 0, 579, 905,
+  500, 827, 45, 394, 873, 0, 112, 710, 0, 0, 613, 0, 0, 898, 0, 180,
+  208, 227, 0, 0, 0, 0, 0, 587, 0, 698, 912, 993, 0, 308, 572, 874,
+  81, 0, 992, 759, 0, 853, 0, 0, 0, 0, 0, 0, 0, 330, 0, 191,
+  234, 895, 515, 0, 486, 775, 0, 250, 721, 991, 0, 195, 0, 0, 0, 0,
+  154, 0, 70, 0, 0, 0, 0, 716, 974, 743, 0, 288, 0, 0, 126, 0,
+  33, 0, 0, 755, 0, 0, 216, 182, 0, 0, 611, 0, 0, 0, 0, 0,
+  331, 981, 0, 695, 351, 621, 143, 0, 285, 0, 836, 275, 0, 0, 8, 651,
+  0, 556, 902, 0, 724, 0, 0, 876, 554, 0, 0, 687, 290, 725, 619, 212,
+  602, 677, 878, 0, 0, 728, 497, 765, 0, 0, 0, 263, 91, 523, 358, 305,
+  630, 933, 474, 0, 0, 0, 0, 56, 377, 315, 239, 206, 652, 0, 0, 0,
+  0, 333, 0, 0, 699, 0, 0, 36, 171, 94, 218, 0, 0, 0, 132, 0,
+  0, 683, 23, 271, 840, 204, 314, 860, 953, 488, 788, 685, 0, 857, 13, 0,
+  0, 159, 0, 123, 0, 930, 0, 0, 565, 61, 149, 0, 0, 439, 0, 0,
+  0, 340, 0, 748, 0, 679, 0, 0, 0, 248, 0, 512, 0, 89, 0, 0,
+  0, 135, 167, 390, 584, 0, 0, 511, 0, 106, 519, 414, 0, 300, 582, 0,
+  527, 221, 707, 802, 0, 0, 965, 0, 635, 0, 0, 996, 280, 0, 476, 0,
+  566, 384, 734, 0, 0, 0, 682, 0, 0, 0, 0, 704, 482, 715, 817, 504,
+  722, 0, 0, 655, 692, 496, 441, 881, 0, 0, 0, 697, 841, 0, 0, 0,
+  693, 0, 102, 451, 66, 253, 0, 0, 0, 46, 321, 730, 125, 513, 985, 0,
+  0, 0, 0, 50, 639, 388, 402, 0, 0, 0, 385, 0, 0, 0, 0, 114,
+  128, 170, 744, 678, 0, 211, 461, 0, 0, 0, 618, 0, 0, 0, 0, 0,
+  0, 0, 0, 750, 0, 0, 0, 892, 0, 74, 968, 816, 0, 561, 324, 0,
+  0, 0, 0, 55, 0, 0, 0, 0, 0, 0, 0, 506, 676, 0, 430, 87,
+  0, 184, 971, 0, 0, 0, 0, 0, 900, 0, 0, 979, 0, 0, 37, 274,
+  571, 599, 581, 356, 644, 0, 0, 85, 712, 0, 0, 493, 0, 901, 0, 0,
+  0, 0, 0, 249, 395, 404, 408, 0, 67, 0, 120, 964, 0, 0, 0, 0,
+  0, 6, 0, 0, 179, 0, 0, 0, 0, 516, 155, 0, 0, 0, 0, 0,
+  0, 0, 240, 0, 328, 359, 967, 0, 0, 0, 0, 0, 897, 777, 277, 0,
+  0, 0, 0, 225, 492, 867, 0, 0, 481, 0, 0, 105, 146, 956, 0, 0,
+  0, 919, 0, 0, 0, 0, 32, 0, 0, 0, 0, 0, 917, 0, 0, 49,
+  122, 675, 380, 283, 0, 0, 0, 567, 0, 640, 0, 0, 292, 0, 165, 0,
+  774, 0, 0, 0, 0, 0, 845, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  603, 864, 547, 700, 0, 823, 0, 0, 0, 0, 564, 0, 0, 886, 0, 256,
+  457, 464, 805, 0, 0, 623, 0, 605, 957, 0, 0, 0, 866, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 641, 0, 140, 0, 0, 0, 0, 828,
+  0, 196, 961, 95, 0, 0, 0, 0, 294, 0, 0, 960, 0, 447, 0, 681,
+  0, 0, 0, 269, 284, 296, 550, 429, 375, 585, 723, 593, 0, 0, 575, 78,
+  893, 90, 535, 428, 293, 258, 437, 470, 680, 819, 93, 190, 865, 0, 0, 0,
+  0, 80, 988, 703, 0, 0, 0, 0, 0, 0, 831, 245, 0, 427, 75, 844,
+  0, 0, 0, 16, 175, 0, 846, 0, 918, 318, 941, 975, 0, 0, 309, 601,
+  753, 319, 163, 947, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 137,
+  0, 316, 11, 0, 0, 432, 0, 0, 936, 537, 104, 0, 0, 0, 741, 0,
+  0, 0, 202, 0, 553, 569, 949, 0, 627, 0, 0, 0, 821, 0, 739, 0,
+  0, 169, 545, 0, 803, 0, 0, 0, 0, 0, 440, 0, 0, 0, 944, 401,
+  0, 0, 583, 0, 0, 0, 410, 188, 259, 361, 736, 0, 472, 0, 939, 264,
+  0, 157, 0, 0, 0, 73, 471, 663, 701, 117, 604, 754, 0, 0, 615, 0,
+  549, 231, 0, 327, 0, 0, 0, 413, 997, 243, 0, 0, 0, 928, 465, 574,
+  0, 0, 354, 270, 0, 150, 852, 0, 600, 0, 0, 0, 657, 880, 0, 0,
+  425, 706, 0, 0, 0, 0, 0, 0, 0, 479, 938, 0, 555, 769, 994, 0,
+  763, 52, 861, 909, 0, 783, 0, 0, 812, 0, 0, 0, 0, 110, 0, 480,
+  503, 0, 0, 0, 108, 0, 0, 690, 17, 244, 738, 0, 0, 262, 590, 0,
+  0, 312, 0, 591, 509, 883, 0, 337, 278, 862, 68, 304, 0, 0, 891, 0,
+  0, 281, 784, 899, 955, 529, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44,
+  276, 279, 255, 910, 0, 342, 751, 0, 0, 0, 0, 172, 490, 0, 0, 0,
+  832, 201, 391, 645, 907, 0, 0, 0, 339, 369, 0, 720, 0, 233, 811, 174,
+  0, 0, 162, 0, 0, 142, 156, 0, 0, 0, 0, 711, 890, 954, 0, 0,
+  0, 0, 0, 0, 0, 0, 521, 82, 833, 597, 0, 0, 97, 200, 152, 387,
+  776, 859, 908, 719, 924, 0, 740, 141, 0, 287, 505, 951, 0, 0, 809, 0,
+  295, 608, 469, 220, 63, 0, 62, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 60, 0, 0, 0, 0, 849, 228, 345, 810, 54, 0, 0, 0, 0,
+  0, 894, 896, 252, 448, 0, 0, 0, 0, 0, 0, 713, 963, 326, 452, 19,
+  926, 0, 446, 863, 0, 0, 0, 203, 0, 0, 0, 495, 58, 839, 0, 0,
+};
+
@@ -0,0 +1,14828 @@
+#include "worldalphabets_data.h"
+
+const char *WA_FREQ_150_TOKENS[] = {
+  "oo",
+  "ka",
+  "ku",
+  "ay",
+  "iyo",
+  "ah",
+  "in",
+  "u",
+  "ayaa",
+  "ee",
+  "la",
+  "uu",
+  "soo",
+  "lagu",
+  "sheegay",
+  "mid",
+  "kale",
+  "ugu",
+  "inay",
+  "waxaa",
+  "aan",
+  "loo",
+  "waxa",
+  "waxay",
+  "laga",
+  "si",
+  "waa",
+  "badan",
+  "dalka",
+  "wax",
+  "Muqdisho",
+  "kala",
+  "Somalia",
+  "wuxuu",
+  "ayuu",
+  "inuu",
+  "markii",
+  "yahay",
+  "ahaa",
+  "aad",
+  "tahay",
+  "iyadoo",
+  "Soomaaliya",
+  "dadka",
+  "uga",
+  "magaalada",
+  "yihiin",
+  "sida",
+  "waxaana",
+  "Puntland",
+  "ciidamada",
+  "isku",
+  "tirsan",
+  "maanta",
+  "Somaliland",
+  "hore",
+  "yiri",
+  "ma",
+  "dib",
+  "dhacay",
+  "sii",
+  "ama",
+  "ahaan",
+  "leh",
+  "looga",
+  "Madaxweynaha",
+  "isagoo",
+  "hadlay",
+  "Maxamed",
+  "Magaalada",
+  "kuwa",
+  "DF",
+  "isla",
+  "dad",
+  "wada",
+  "qof",
+  "loogu",
+  "Cali",
+  "Waxa",
+  "weyn",
+  "sugan",
+  "Sh",
+  "Waxaa",
+  "kaga",
+  "lahaa",
+  "jira",
+  "sidii",
+  "waxaan",
+  "Sheekh",
+  "kadib",
+  "Al-shabaab",
+  "inta",
+  "Gobolka",
+  "Axmed",
+  "Ciidamada",
+  "cusub",
+  "Soomaaliyeed",
+  "balse",
+  "isaga",
+  "kasoo",
+  "jiray",
+  "degmada",
+  "Ethiopia",
+  "socda",
+  "gobolka",
+  "gaar",
+  "ilaa",
+  "doono",
+  "iska",
+  "aysan",
+  "Shariif",
+  "marka",
+  "doonaan",
+  "kooxaha",
+  "ahayd",
+  "kula",
+  "Dowlada",
+  "Xasan",
+  "sidoo",
+  "labada",
+  "Madaxweyne",
+  "reer",
+  "dowlada",
+  "ayay",
+  "kuwo",
+  "qaaday",
+  "yidhi",
+  "duwan",
+  "ayna",
+  "meel",
+  "Wasiirka",
+  "haddii",
+  "markaana",
+  "dagaal",
+  "kuwaasoo",
+  "Waa",
+  "dowladda",
+  "Kenya",
+  "mar",
+  "shalay",
+  "Sidoo",
+  "maamulka",
+  "iyagoo",
+  "AMISOM",
+  "jiraan",
+  "laba",
+  "Dowladda",
+  "aanu",
+  "shacabka",
+  "ayaan",
+  "gacanta",
+  "Waxaan",
+  "sheegeen",
+  "karo",
+  "nin",
+  "dhan",
+  "ciidamo",
+  "halka",
+  "jirin",
+  "gudaha",
+  "isugu",
+  "Afrika",
+  "dagaalka",
+  "leeyahay",
+  "dhinaca",
+  "baxay",
+  "guud",
+  "walba",
+  "is",
+  "inaan",
+  "hadda",
+  "yar",
+  "hor",
+  "aanay",
+  "sheegey",
+  "waxayna",
+  "halkaas",
+  "Itoobiya",
+  "wuxuuna",
+  "Baydhabo",
+  "Yuusuf",
+  "ha",
+  "jirto",
+  "qaar",
+  "sheegtay",
+  "Jabuuti",
+  "gaaray",
+  "taas",
+  "kooxda",
+  "kasta",
+  "Hargeysa",
+  "muddo",
+  "wixii",
+  "iyada",
+  "weli",
+  "dhashay",
+  "Degmada",
+  "kusoo",
+  "horjeeda",
+  "galay",
+  "Baarlamaanka",
+  "qayb",
+  "Cadde",
+  "baahan",
+  "dilay",
+  "kuwaas",
+  "dhintay",
+  "Cabdi",
+  "KMG",
+  "Aadan",
+  "Cumar",
+  "dhawaan",
+  "ahayn",
+  "socday",
+  "qabtay",
+  "gacan",
+  "xalay",
+  "dhex",
+  "sare",
+  "Maamulka",
+  "laakiin",
+  "Dalka",
+  "Nuur",
+  "arrimaha",
+  "lala",
+  "deegaanka",
+  "kalena",
+  "intii",
+  "cid",
+  "ahaayeen",
+  "shirka",
+  "qaarkood",
+  "nabad",
+  "daray",
+  "Ma",
+  "dheer",
+  "amaanka",
+  "Mr",
+  "yimid",
+  "horay",
+  "Mareykanka",
+  "Ururka",
+  "dalalka",
+  "dawladda",
+  "dhow",
+  "ururka",
+  "Dr",
+  "sheegaya",
+  "Gudoomiyaha",
+  "tilmaamay",
+  "way",
+  "dhinac",
+  "baarlamaanka",
+  "Golaha",
+  "Dhinaca",
+  "jiro",
+  "xarunta",
+  "xoogan",
+  "nool",
+  "karin",
+  "dadkii",
+  "lahaayeen",
+  "Soomaalida",
+  "jirta",
+  "kaasoo",
+  "lahayn",
+  "wanaagsan",
+  "xusay",
+  "dhigay",
+  "qaban",
+  "noqon",
+  "leedahay",
+  "ahi",
+  "madaxda",
+  "leeyihiin",
+  "bulshada",
+  "Dadka",
+  "Islaamka",
+  "intaa",
+  "tan",
+  "Kismaayo",
+  "taasoo",
+  "dhanka",
+  "Xisbul",
+  "waayo",
+  "xilka",
+  "Daahir",
+  "dhowr",
+  "labaad",
+  "taagan",
+  "dambe",
+  "meesha",
+  "kooban",
+  "sidaa",
+  "dagaalada",
+  "isu",
+  "Wuxuu",
+  "aynu",
+  "halkaasi",
+  "hadii",
+  "golaha",
+  "saaray",
+  "saxaafada",
+  "baa",
+  "Garowe",
+  "DFKMG",
+  "iyaga",
+  "dhexe",
+  "ayey",
+  "Guddoomiyaha",
+  "hadal",
+  "In",
+  "sano",
+  "Midowga",
+  "jireen",
+  "dhacday",
+  "Ugu",
+  "iney",
+  "waxba",
+  "ciidanka",
+  "dhulka",
+  "uusan",
+  "mucaaradka",
+  "shir",
+  "wadanka",
+  "dhamaan",
+  "saabsan",
+  "dambeeyay",
+  "geystay",
+  "caalamka",
+  "ula",
+  "waana",
+  "xubno",
+  "Federaalka",
+  "Ra'iisul",
+  "Waxay",
+  "Banaadir",
+  "Xuseen",
+  "garoonka",
+  "intaas",
+  "hal",
+  "hubeysan",
+  "noqday",
+  "dhexeeya",
+  "Maraykanka",
+  "Maxkamadaha",
+  "sheegayaan",
+  "Sida",
+  "xubnaha",
+  "qaatay",
+  "warar",
+  "sababta",
+  "Maanta",
+  "xukuumada",
+  "hoose",
+  "jeediyay",
+  "Wararka",
+  "karaa",
+  "doorashada",
+  "kama",
+  "adag",
+  "yeeshee",
+  "qaado",
+  "dagaalo",
+  "eedeeyay",
+  "helay",
+  "Afhayeenka",
+  "Haddii",
+  "waxaanu",
+  "Hiiraan",
+  "kulan",
+  "qabto",
+  "qeyb",
+  "kooxo",
+  "baaqay",
+  "karaan",
+  "haya",
+  "Haddaba",
+  "Maxamuud",
+  "kii",
+  "kamid",
+  "doonto",
+  "sameeyay",
+  "goobta",
+  "keliya",
+  "Marka",
+  "Laakiin",
+  "doonaa",
+  "fara",
+  "lahayd",
+  "kor",
+  "kaas",
+  "kara",
+  "dhaqan",
+  "Uganda",
+  "lama",
+  "Ciraaq",
+  "keentay",
+  "Ciidamo",
+  "doona",
+  "Islam",
+  "maamul",
+  "inaysan",
+  "Oo",
+  "suuqa",
+  "Si",
+  "tiro",
+  "Dhanka",
+  "goobaha",
+  "gobolada",
+  "Yurub",
+  "isna",
+  "wasaaraha",
+  "magacaabay",
+  "weerar",
+  "beesha",
+  "fiican",
+  "haddana",
+  "waan",
+  "diyaar",
+  "war",
+  "jirtay",
+  "yaala",
+  "galeen",
+  "taasi",
+  "siyaasadeed",
+  "rayid",
+  "qofka",
+  "hayaan",
+  "kaloo",
+  "wadaan",
+  "doonayo",
+  "sharciga",
+  "xili",
+  "labo",
+  "Max'ed",
+  "awood",
+  "haatan",
+  "Xaaji",
+  "maalintii",
+  "saakay",
+  "hayo",
+  "Sidaa",
+  "kuwii",
+  "ii",
+  "dadku",
+  "darteed",
+  "Md",
+  "arimaha",
+  "Nairobi",
+  "wararka",
+  "jirey",
+  "madax",
+  "Muuse",
+  "Booliska",
+  "helo",
+  "lasoo",
+  "diiday",
+  "mana",
+  "Hase",
+  "dadweynaha",
+  "dhaawac",
+  "wado",
+  "Madaxda",
+  "culus",
+  "magacaabo",
+  "xoog",
+  "Soomaali",
+  "qaadeen",
+  "dhaawacmay",
+  "Ka",
+  "hubka",
+  "Arrimaha",
+  "sameeyo",
+  "diinta",
+  "hoos",
+  "wuu",
+  "Qaramada",
+  "ciidan",
+  "lacag",
+  "dhaceen",
+  "jooga",
+  "shaqo",
+  "Bakaaraha",
+  "dhaqaale",
+  "sharci",
+  "kuna",
+  "heshiis",
+  "Somalida",
+  "sugnaa",
+  "Isbitaalka",
+  "yeeshay",
+  "ahaatee",
+  "inaad",
+  "horey",
+  "dhaca",
+  "gaari",
+  "yaqaan",
+  "cad",
+  "warbaahinta",
+  "Midoobay",
+  "horeysay",
+  "gaareen",
+  "uuna",
+  "ammaanka",
+  "jeer",
+  "maadaama",
+  "dunida",
+  "dhibaato",
+  "iyana",
+  "xisbiga",
+  "aqoon",
+  "wasiirka",
+  "xigeenka",
+  "rasaas",
+  "Al-Shabaab",
+  "aadan",
+  "ruux",
+  "Dawladda",
+  "waxaad",
+  "shaqaalaha",
+  "aha",
+  "dhammaan",
+  "Waxaana",
+  "saddex",
+  "hada",
+  "Yusuf",
+  "bay",
+  "iyagu",
+  "Madoobe",
+  "noqotay",
+  "yaraan",
+  "Gen",
+  "Ibraahim",
+  "Jaamac",
+  "bixin",
+  "kana",
+  "Wasaaradda",
+  "qaadan",
+  "goob",
+  "Taliyaha",
+  "keenay",
+  "naga",
+  "Dheere",
+  "dal",
+  "dhibaatada",
+  "Somali",
+  "askari",
+  "Burco",
+  "dhaawacmeen",
+  "noo",
+  "maalin",
+  "Markii",
+  "Shabaab",
+  "dhinteen",
+  "gargaarka",
+  "maray",
+  "Mudane",
+  "hub",
+  "dhaqanka",
+  "gaadhay",
+  "xun",
+  "degmooyinka",
+  "siiyay",
+  "lagaga",
+  "siiyo",
+  "xaaladda",
+  "kulanka",
+  "afar",
+  "dhaliyay",
+  "xeebaha",
+  "xilli",
+  "iyaguna",
+  "waliba",
+  "Faarax",
+  "dhaqaalaha",
+  "noqdo",
+  "isagu",
+  "dhinacyada",
+  "gaadiidka",
+  "khasaare",
+  "kaliya",
+  "adduunka",
+  "biyaha",
+  "hadalka",
+  "Garoowe",
+  "arkay",
+  "beelaha",
+  "heli",
+  "UDUB",
+  "baxaan",
+  "qaadi",
+  "Hoose",
+  "Ismaaciil",
+  "S",
+  "baxeen",
+  "Haatuf",
+  "bishii",
+  "aheyd",
+  "karto",
+  "Mar",
+  "dibada",
+  "xukuumadda",
+  "isaguna",
+  "koox",
+  "dhaafay",
+  "burcad",
+  "kan",
+  "waaweyn",
+  "madaxa",
+  "cabsi",
+  "Kooxda",
+  "jeeda",
+  "markaa",
+  "odhan",
+  "Booliiska",
+  "ganacsiga",
+  "saraakiisha",
+  "sheegin",
+  "diyaaradaha",
+  "geeriyooday",
+  "weeraray",
+  "Bosaso",
+  "Kooxaha",
+  "Guud",
+  "kuma",
+  "xaalada",
+  "Wasaaraha",
+  "rag",
+  "timid",
+  "Madaxtooyada",
+  "dhici",
+  "madaxweynaha",
+  "sanadkii",
+  "saxaafadda",
+  "socdaan",
+  "tirada",
+  "gashay",
+  "saaka",
+  "tagay",
+  "Yemen",
+  "deg",
+  "waxey",
+  "doortay",
+  "sidaas",
+  "bilaabay",
+  "bilood",
+  "inkastoo",
+  "Bay",
+  "halkaa",
+  "Xildhibaan",
+  "rasmi",
+  "Suuqa",
+  "nahay",
+  "na",
+  "Col",
+  "Siciid",
+  "waday",
+  "daro",
+  "kaddib",
+  "buu",
+  "degan",
+  "diray",
+  "kulmay",
+  "maxaa",
+  "hase",
+  "Rayaale",
+  "taageero",
+  "ahna",
+  "howlaha",
+  "amniga",
+  "dhexmaray",
+  "maalinta",
+  "uma",
+  "afka",
+  "xaq",
+  "dilka",
+  "galaan",
+  "kuu",
+  "xal",
+  "Barre",
+  "muhiim",
+  "siyaasadda",
+  "Barlamanka",
+  "Ku",
+  "dagaalkii",
+  "degaanka",
+  "qabo",
+  "karta",
+  "dileen",
+  "doorashooyinka",
+  "mudo",
+  "socota",
+  "saaran",
+  "Aweys",
+  "Waxaanu",
+  "Islaamiga",
+  "halkaasoo",
+  "iminka",
+  "deegaanada",
+  "Alle",
+  "Boosaaso",
+  "Berbera",
+  "gaaraya",
+  "ganacsatada",
+  "igu",
+  "khilaafka",
+  "laabtay",
+  "sababay",
+  "sannadkii",
+  "Ingiriiska",
+  "bilowday",
+  "Gobalka",
+  "biyo",
+  "Dagaal",
+  "filayaa",
+  "una",
+  "codsaday",
+  "weerarka",
+  "Addis",
+  "shisheeye",
+  "kastaba",
+  "wayn",
+  "maalmood",
+  "Prof",
+  "Ababa",
+  "dagaalamay",
+  "yeesheen",
+  "Cismaan",
+  "Online",
+  "islamarkaana",
+  "caafimaadka",
+  "kuwaasi",
+  "wadaa",
+  "Muse",
+  "mudan",
+  "saaro",
+  "heshiisiinta",
+  "ogeyn",
+  "Geedi",
+  "degmadaas",
+  "lana",
+  "talo",
+  "tii",
+  "Qaranka",
+  "jaraa'id",
+  "ninka",
+  "gudoomiyaha",
+  "qabteen",
+  "wareegay",
+  "Shacabka",
+  "dhigo",
+  "khasaaraha",
+  "caafimaad",
+  "horeeyay",
+  "Warar",
+  "KULMIYE",
+  "weeraro",
+  "qarax",
+  "weliba",
+  "badda",
+  "gaarka",
+  "C/llaahi",
+  "saraakiil",
+  "Sool",
+  "magac",
+  "usoo",
+  "wadada",
+  "baxday",
+  "ciyaarta",
+  "doonayaan",
+  "xiran",
+  "Gaalkacyo",
+  "dhacey",
+  "guriga",
+  "yaal",
+  "Ciise",
+  "Talyaaniga",
+  "helaan",
+  "iga",
+  "kartaa",
+  "khilaaf",
+  "qaranka",
+  "waayay",
+  "C/laahi",
+  "danbe",
+  "dhowaan",
+  "joogaan",
+  "qaran",
+  "toos",
+  "weydiiyay",
+  "xiriir",
+  "Beesha",
+  "qaraxa",
+  "Africa",
+  "sameeyeen",
+  "Madaxa",
+  "qaabka",
+  "galo",
+  "xafiiska",
+  "ganacsi",
+  "guddiga",
+  "Ciidanka",
+  "Dad",
+  "Somaliya",
+  "madaxweyne",
+  "Xil",
+  "markaas",
+  "qabsaday",
+  "Ra’iisul",
+  "nolosha",
+  "Inta",
+  "Islaam",
+  "waxbarashada",
+  "xaqiijiyay",
+  "xoolaha",
+  "Gobolada",
+  "Rasuulka",
+  "shaqada",
+  "tegay",
+  "Iyo",
+  "aniga",
+  "heshiiska",
+  "ciidamadii",
+  "Eritrea",
+  "dhawaaqay",
+  "Carabta",
+  "wasaare",
+  "Faransiiska",
+  "lacagta",
+  "baxa",
+  "Jowhar",
+  "fudud",
+  "qaba",
+  "2",
+  "Xukuumada",
+  "shan",
+  "Gudaha",
+  "bisha",
+  "meelaha",
+  "qaataan",
+  "Lama",
+  "Asmara",
+  "shaqeeyaan",
+  "AllPuntland",
+  "ciyaaraha",
+  "dagaalku",
+  "Cabdullaahi",
+  "kaa",
+  "baan",
+  "badani",
+  "Baladweyne",
+  "geysteen",
+  "hadana",
+  "ummadda",
+  "xabsiga",
+  "caasimada",
+  "QM",
+  "agagaarka",
+  "J",
+  "dhaawacyo",
+  "Xildhibaanada",
+  "bixi",
+  "inoo",
+  "koobka",
+  "hadlayay",
+  "kulamo",
+  "Soomaliya",
+  "xiray",
+  "eego",
+  "waxana",
+  "IGAD",
+  "furay",
+  "qaabilsan",
+  "Deegaanka",
+  "mas'uul",
+  "been",
+  "uun",
+  "daran",
+  "hay'adaha",
+  "siin",
+  "magaciisa",
+  "nabadda",
+  "wasiirada",
+  "meelo",
+  "ahan",
+  "sarkaal",
+  "goor",
+  "wali",
+  "ururada",
+  "WFP",
+  "talada",
+  "3",
+  "dastuurka",
+  "caalamiga",
+  "raaciyay",
+  "rayidka",
+  "Wasiirada",
+  "Xaashi",
+  "Xoghayaha",
+  "doonin",
+  "haysta",
+  "heshiiskii",
+  "sheegayaa",
+  "Madiina",
+  "noqoto",
+  "dawlad",
+  "sabab",
+  "waxaase",
+  "muuqda",
+  "hadlo",
+  "muuqata",
+  "horumar",
+  "qabaan",
+  "magaca",
+  "waxyaabaha",
+  "keeni",
+  "taariikhda",
+  "Wasaarada",
+  "noqdaan",
+  "xoogaga",
+  "Isbahaysiga",
+  "awgeed",
+  "dhismaha",
+  "dhimasho",
+  "madaafiic",
+  "xil",
+  "Qaar",
+  "daba",
+  "wadamada",
+  "Boorama",
+  "Wasiir",
+  "baxaya",
+  "guul",
+  "oga",
+  "Dhexe",
+  "Ilaahay",
+  "hadlin",
+  "jir",
+  "joogay",
+  "Nin",
+  "Reer",
+  "wata",
+  "Maxamad",
+  "koowaad",
+  "socdo",
+  "London",
+  "intooda",
+  "kooxihii",
+  "socon",
+  "Siyaad",
+  "dhisay",
+  "halkii",
+  "labadii",
+  "Xukuumadda",
+  "dibadda",
+  "qoray",
+  "Dagaalka",
+  "qaateen",
+  "tiri",
+  "yimaadeen",
+  "dhab",
+  "kadibna",
+  "gaarsiiyay",
+  "hayay",
+  "muujiyay",
+  "shirkii",
+  "Maraykanku",
+  "haysto",
+  "shaqeyn",
+  "Xarunta",
+  "ahaanba",
+  "gool",
+  "May",
+  "dhawr",
+  "hadley",
+  "lagama",
+  "Cabdulahi",
+  "lug",
+  "nagu",
+  "beegsaday",
+  "la'aan",
+  "Jaamacadda",
+  "Mudug",
+  "scw",
+  "shaqeeya",
+  "C/raxmaan",
+  "magaalooyinka",
+  "maqan",
+  "qaybgalay",
+  "xukunka",
+  "DGPL",
+  "dhisan",
+  "dhuftay",
+  "UN-ka",
+  "filayo",
+  "markuu",
+  "saari",
+  "Madaxweynuhu",
+  "halis",
+};
+const uint16_t WA_FREQ_150_RANKS[] = {
+  0, 0, 59, 0, 763, 330, 907, 0, 0, 0, 60, 0, 0, 0, 0, 677,
+  0, 427, 932, 289, 114, 0, 554, 0, 124, 0, 499, 0, 0, 407, 571, 698,
+  801, 0, 392, 0, 817, 0, 0, 0, 870, 0, 0, 0, 369, 0, 0, 0,
+  88, 637, 0, 436, 0, 0, 590, 849, 923, 0, 0, 0, 0, 0, 0, 100,
+  0, 0, 0, 0, 767, 0, 0, 91, 399, 57, 0, 788, 804, 899, 880, 924,
+  0, 423, 576, 97, 257, 430, 0, 271, 424, 658, 0, 0, 0, 0, 921, 0,
+  287, 365, 521, 237, 277, 539, 0, 266, 0, 0, 122, 0, 222, 0, 0, 141,
+  0, 0, 401, 0, 0, 628, 357, 0, 0, 299, 604, 759, 37, 221, 974, 0,
+  0, 443, 735, 0, 0, 0, 0, 868, 0, 0, 0, 814, 0, 459, 480, 0,
+  0, 0, 0, 0, 0, 0, 0, 395, 145, 722, 582, 0, 0, 0, 0, 0,
+  716, 386, 618, 188, 364, 478, 134, 0, 518, 0, 245, 310, 0, 0, 428, 951,
+  595, 0, 636, 0, 0, 872, 0, 0, 0, 0, 265, 694, 585, 0, 194, 833,
+  0, 543, 0, 0, 238, 0, 0, 0, 0, 0, 0, 986, 805, 282, 0, 656,
+  0, 0, 0, 0, 0, 605, 0, 498, 25, 394, 0, 366, 485, 592, 673, 0,
+  855, 0, 875, 0, 0, 0, 0, 0, 144, 0, 486, 0, 160, 248, 192, 0,
+  787, 854, 0, 408, 0, 852, 0, 290, 0, 117, 0, 0, 0, 275, 0, 0,
+  411, 0, 0, 166, 201, 502, 0, 174, 0, 41, 938, 0, 0, 472, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 313, 633, 0, 0, 0, 0, 215, 937,
+  415, 0, 0, 0, 280, 0, 0, 348, 419, 883, 0, 0, 0, 599, 0, 0,
+  453, 0, 0, 494, 1, 928, 660, 846, 575, 312, 94, 966, 0, 0, 0, 0,
+  130, 0, 249, 0, 762, 337, 151, 538, 0, 675, 758, 0, 0, 178, 0, 0,
+  0, 0, 446, 31, 667, 0, 0, 0, 0, 732, 0, 0, 812, 977, 0, 229,
+  0, 0, 0, 0, 0, 169, 0, 0, 678, 0, 720, 659, 707, 0, 0, 0,
+  0, 213, 390, 774, 809, 0, 0, 0, 997, 109, 0, 346, 441, 433, 0, 0,
+  0, 291, 0, 0, 0, 0, 0, 456, 922, 0, 0, 635, 0, 0, 0, 823,
+  0, 307, 345, 799, 0, 0, 0, 16, 559, 0, 285, 454, 895, 580, 0, 513,
+  102, 947, 550, 341, 336, 0, 347, 615, 300, 961, 50, 0, 133, 219, 44, 526,
+  557, 729, 468, 254, 111, 0, 516, 0, 0, 0, 0, 0, 0, 0, 143, 885,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 267, 360, 380,
+  561, 882, 929, 34, 933, 0, 0, 0, 744, 0, 0, 0, 0, 0, 0, 0,
+  0, 896, 0, 0, 0, 0, 15, 262, 753, 955, 0, 492, 943, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 749, 691, 0, 87, 189, 371, 0, 0, 173,
+  353, 0, 0, 0, 0, 62, 0, 624, 129, 0, 873, 232, 0, 440, 0, 0,
+  175, 0, 0, 0, 0, 274, 384, 236, 481, 824, 0, 739, 253, 334, 442, 583,
+  616, 989, 0, 889, 0, 0, 243, 657, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 193, 0, 0, 0, 0, 95, 0, 0, 0, 0, 999, 0, 0,
+  0, 0, 0, 400, 533, 630, 0, 0, 323, 0, 0, 589, 908, 0, 836, 0,
+  388, 861, 0, 0, 0, 279, 772, 0, 0, 0, 484, 520, 416, 491, 688, 0,
+  0, 0, 5, 681, 0, 798, 0, 0, 995, 551, 0, 0, 0, 0, 0, 0,
+  864, 0, 139, 0, 0, 393, 970, 74, 0, 761, 263, 375, 810, 0, 0, 0,
+  0, 848, 0, 0, 988, 0, 0, 564, 0, 511, 140, 316, 931, 940, 0, 372,
+  578, 0, 0, 0, 0, 878, 0, 0, 0, 952, 0, 0, 587, 0, 0, 0,
+  27, 417, 0, 0, 600, 30, 47, 315, 655, 0, 325, 0, 350, 224, 500, 63,
+  663, 256, 0, 0, 0, 396, 0, 606, 0, 252, 158, 0, 652, 544, 620, 570,
+  0, 0, 61, 0, 207, 127, 363, 0, 886, 927, 270, 913, 0, 0, 718, 0,
+  0, 0, 0, 0, 231, 432, 841, 361, 969, 0, 0, 0, 466, 0, 0, 0,
+  0, 0, 0, 0, 584, 0, 0, 268, 528, 629, 662, 0, 0, 0, 0, 704,
+  0, 912, 65, 0, 529, 303, 209, 646, 410, 747, 979, 690, 728, 0, 70, 0,
+  0, 661, 649, 247, 742, 0, 0, 0, 0, 0, 0, 163, 670, 0, 309, 0,
+  0, 0, 0, 329, 33, 412, 452, 482, 0, 79, 993, 0, 779, 0, 0, 0,
+  448, 278, 0, 0, 0, 10, 679, 0, 942, 614, 910, 335, 276, 680, 0, 0,
+  666, 358, 150, 792, 0, 0, 764, 142, 185, 225, 712, 0, 685, 0, 0, 0,
+  0, 38, 0, 0, 0, 208, 0, 811, 736, 0, 0, 0, 0, 581, 471, 497,
+  503, 664, 0, 0, 0, 709, 398, 0, 228, 0, 750, 0, 105, 414, 461, 844,
+  85, 0, 0, 4, 771, 0, 0, 202, 321, 152, 220, 333, 778, 0, 0, 0,
+  28, 713, 331, 359, 978, 0, 541, 0, 0, 0, 930, 0, 0, 186, 190, 531,
+  0, 0, 0, 0, 76, 397, 542, 0, 0, 19, 0, 648, 455, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 598, 916, 0, 773, 120, 766, 0, 425, 115,
+  298, 12, 700, 429, 781, 0, 992, 17, 314, 73, 0, 0, 352, 66, 608, 693,
+  699, 106, 0, 0, 294, 540, 797, 751, 555, 881, 101, 0, 0, 926, 0, 0,
+  0, 164, 0, 0, 898, 0, 602, 0, 0, 891, 0, 56, 0, 404, 644, 306,
+  0, 0, 0, 0, 0, 0, 573, 0, 0, 246, 284, 0, 0, 0, 964, 0,
+  0, 0, 0, 0, 975, 0, 0, 162, 351, 639, 495, 1000, 0, 893, 0, 0,
+  0, 0, 0, 0, 0, 701, 0, 0, 0, 0, 0, 0, 0, 138, 0, 0,
+  0, 0, 0, 234, 748, 0, 0, 0, 0, 196, 328, 406, 813, 0, 195, 103,
+  650, 958, 0, 0, 903, 0, 0, 0, 641, 983, 479, 449, 13, 548, 0, 305,
+  856, 0, 0, 250, 755, 0, 317, 0, 962, 0, 2, 72, 0, 857, 925, 0,
+  251, 71, 546, 638, 92, 647, 381, 0, 0, 0, 0, 0, 0, 0, 170, 0,
+  786, 0, 770, 0, 0, 808, 0, 0, 871, 0, 176, 487, 721, 746, 0, 167,
+  776, 634, 653, 890, 956, 0, 0, 0, 504, 0, 765, 610, 672, 719, 297, 959,
+  894, 0, 850, 0, 26, 0, 819, 0, 0, 99, 900, 991, 264, 567, 0, 939,
+  547, 0, 0, 273, 697, 0, 838, 0, 0, 0, 837, 226, 0, 0, 0, 6,
+  355, 470, 640, 0, 686, 0, 0, 0, 0, 259, 572, 826, 0, 426, 464, 552,
+  0, 738, 0, 107, 0, 0, 0, 807, 853, 0, 0, 0, 0, 593, 724, 780,
+  205, 0, 0, 0, 0, 0, 0, 154, 0, 0, 112, 0, 496, 617, 865, 157,
+  342, 0, 18, 612, 963, 862, 0, 420, 296, 36, 0, 0, 200, 0, 0, 0,
+  0, 725, 0, 0, 0, 0, 0, 0, 0, 0, 632, 568, 0, 0, 0, 75,
+  642, 705, 0, 0, 0, 0, 973, 0, 135, 0, 0, 338, 9, 892, 0, 0,
+  0, 507, 727, 768, 0, 0, 0, 465, 519, 0, 0, 936, 0, 272, 0, 859,
+  0, 821, 0, 0, 0, 625, 877, 84, 795, 0, 794, 0, 21, 58, 0, 0,
+  0, 0, 0, 0, 0, 385, 0, 322, 789, 90, 0, 230, 444, 0, 269, 119,
+  295, 603, 944, 515, 905, 560, 971, 976, 0, 0, 0, 0, 0, 0, 0, 0,
+  757, 0, 367, 0, 0, 0, 0, 556, 674, 304, 676, 0, 527, 815, 510, 651,
+  0, 843, 0, 197, 0, 378, 867, 0, 0, 339, 597, 0, 0, 0, 0, 591,
+  935, 0, 261, 216, 439, 577, 0, 0, 214, 376, 669, 0, 0, 0, 0, 0,
+  0, 0, 391, 0, 0, 0, 0, 3, 168, 0, 0, 0, 0, 123, 711, 835,
+  0, 377, 594, 0, 609, 731, 0, 0, 0, 0, 0, 830, 301, 403, 695, 302,
+  68, 0, 0, 210, 0, 0, 887, 0, 0, 118, 493, 0, 0, 0, 0, 827,
+  0, 0, 0, 171, 522, 745, 803, 981, 0, 0, 0, 0, 0, 0, 98, 241,
+  0, 0, 0, 0, 0, 260, 462, 800, 0, 586, 204, 490, 901, 0, 110, 536,
+  784, 985, 0, 379, 409, 422, 0, 0, 0, 0, 286, 0, 149, 0, 0, 0,
+  8, 715, 0, 217, 619, 434, 24, 869, 954, 0, 450, 40, 534, 972, 457, 948,
+  0, 311, 0, 370, 0, 53, 203, 293, 631, 714, 0, 0, 0, 0, 613, 0,
+  437, 0, 475, 45, 467, 532, 89, 0, 483, 904, 387, 512, 128, 950, 741, 332,
+  915, 318, 179, 0, 919, 218, 840, 0, 0, 0, 0, 0, 842, 0, 421, 0,
+  0, 0, 0, 0, 86, 509, 601, 703, 769, 0, 957, 32, 0, 574, 0, 501,
+  818, 530, 717, 949, 0, 0, 0, 0, 858, 621, 654, 0, 69, 0, 382, 0,
+  0, 505, 0, 627, 623, 953, 0, 235, 920, 0, 418, 0, 645, 0, 0, 0,
+  0, 0, 354, 791, 917, 0, 0, 0, 116, 0, 0, 0, 0, 775, 579, 0,
+  0, 0, 349, 198, 23, 476, 558, 0, 0, 553, 0, 535, 0, 0, 0, 0,
+  0, 876, 0, 0, 0, 0, 545, 0, 0, 0, 0, 0, 860, 0, 460, 683,
+  0, 743, 0, 0, 258, 373, 562, 244, 0, 0, 0, 233, 0, 0, 0, 121,
+  668, 0, 0, 0, 340, 0, 327, 0, 0, 0, 451, 0, 155, 967, 987, 0,
+  0, 0, 569, 0, 0, 0, 0, 182, 165, 945, 0, 0, 0, 0, 565, 702,
+  0, 447, 0, 96, 508, 0, 148, 946, 692, 0, 131, 35, 80, 760, 994, 183,
+  108, 802, 0, 0, 884, 0, 0, 0, 0, 737, 0, 0, 180, 191, 212, 283,
+  851, 0, 458, 665, 125, 909, 0, 566, 0, 0, 0, 816, 0, 879, 0, 0,
+  0, 863, 0, 684, 184, 990, 0, 0, 0, 0, 181, 0, 0, 0, 473, 0,
+  488, 525, 796, 0, 82, 49, 463, 0, 0, 0, 0, 996, 0, 104, 866, 0,
+  0, 0, 0, 0, 93, 723, 0, 83, 982, 0, 52, 159, 611, 847, 888, 292,
+  0, 0, 0, 0, 0, 147, 54, 0, 0, 0, 438, 477, 782, 0, 0, 0,
+  14, 0, 0, 0, 0, 0, 20, 563, 832, 0, 0, 0, 146, 0, 0, 39,
+  0, 431, 0, 0, 0, 374, 0, 156, 153, 726, 0, 177, 413, 0, 22, 489,
+  0, 622, 0, 0, 0, 199, 126, 0, 687, 0, 0, 0, 0, 708, 752, 906,
+  682, 242, 0, 0, 607, 0, 0, 0, 0, 0, 783, 0, 0, 0, 0, 0,
+  941, 0, 0, 0, 211, 524, 0, 0, 0, 0, 0, 710, 0, 187, 806, 0,
+  0, 0, 29, 368, 0, 0, 255, 0, 0, 239, 0, 0, 0, 0, 696, 0,
+  288, 0, 0, 319, 320, 0, 0, 0, 77, 51, 227, 626, 0, 914, 706, 0,
+  0, 0, 0, 0, 48, 934, 0, 777, 998, 172, 0, 0, 911, 960, 845, 0,
+  0, 362, 897, 0, 0, 0, 0, 0, 326, 223, 11, 343, 344, 402, 517, 671,
+  829, 831, 0, 64, 356, 740, 67, 785, 81, 240, 0, 0, 0, 549, 0, 0,
+  0, 730, 0, 689, 474, 0, 0, 0, 0, 793, 0, 0, 0, 0, 0, 0,
+  0, 874, 0, 0, 137, 839, 0, 0, 0, 0, 7, 0, 0, 0, 820, 0,
+  0, 734, 506, 790, 825, 0, 46, 136, 0, 405, 281, 0, 0, 0, 0, 733,
+  435, 523, 754, 0, 0, 588, 918, 42, 0, 980, 445, 984, 308, 206, 0, 469,
+  596, 55, 0, 324, 383, 0, 0, 0, 0, 0, 0, 161, 965, 828, 968, 537,
+  0, 0, 0, 0, 0, 0, 0, 902, 0, 0, 113, 43, 834, 0, 0, 756,
+  0, 0, 0, 0, 0, 389, 514, 0, 643, 0, 78, 0, 0, 822, 0, 132,
+};
+
+const char *WA_FREQ_151_TOKENS[] = {
+  "të",
+  "e",
+  "në",
+  "i",
+  "dhe",
+  "për",
+  "me",
+  "që",
+  "një",
+  "se",
+  "nga",
+  "ka",
+  "është",
+  "më",
+  "nuk",
+  "do",
+  "së",
+  "te",
+  "edhe",
+  "si",
+  "u",
+  "janë",
+  "kanë",
+  "tij",
+  "shumë",
+  "këtë",
+  "ne",
+  "por",
+  "Në",
+  "duke",
+  "po",
+  "mund",
+  "ishte",
+  "tyre",
+  "ta",
+  "pas",
+  "duhet",
+  "parë",
+  "ai",
+  "dy",
+  "ku",
+  "prej",
+  "vetëm",
+  "saj",
+  "qe",
+  "kur",
+  "kjo",
+  "disa",
+  "bërë",
+  "gjithë",
+  "kishte",
+  "tha",
+  "gjatë",
+  "per",
+  "apo",
+  "Por",
+  "qenë",
+  "pa",
+  "jo",
+  "deri",
+  "jetë",
+  "fundit",
+  "para",
+  "Kosovës",
+  "tjetër",
+  "sa",
+  "mbi",
+  "pasi",
+  "ata",
+  "Sipas",
+  "cili",
+  "ajo",
+  "atë",
+  "mirë",
+  "nje",
+  "gjitha",
+  "këto",
+  "këtij",
+  "Kjo",
+  "Ai",
+  "ndaj",
+  "marrë",
+  "ky",
+  "Për",
+  "ndërsa",
+  "tjera",
+  "Një",
+  "kësaj",
+  "vitin",
+  "pak",
+  "pjesë",
+  "politike",
+  "rreth",
+  "shqiptare",
+  "sot",
+  "thotë",
+  "E",
+  "sipas",
+  "çdo",
+  "mes",
+  "mos",
+  "vend",
+  "ato",
+  "vitit",
+  "kemi",
+  "t’i",
+  "cila",
+  "ditë",
+  "eshte",
+  "Të",
+  "Berisha",
+  "ishin",
+  "ose",
+  "kohë",
+  "herë",
+  "kundër",
+  "sepse",
+  "cilat",
+  "na",
+  "madhe",
+  "Nuk",
+  "pasur",
+  "mënyrë",
+  "nëse",
+  "thënë",
+  "as",
+  "Me",
+  "Ky",
+  "ri",
+  "Ne",
+  "kam",
+  "ketë",
+  "Shqipërisë",
+  "vendit",
+  "madh",
+  "Shqipëri",
+  "tani",
+  "shqiptar",
+  "shkak",
+  "Më",
+  "ende",
+  "bëhet",
+  "asnjë",
+  "duket",
+  "pse",
+  "Nga",
+  "ashtu",
+  "re",
+  "vetë",
+  "Po",
+  "ju",
+  "brenda",
+  "fund",
+  "vendin",
+  "cilët",
+  "tek",
+  "gjë",
+  "I",
+  "Pas",
+  "dhënë",
+  "vjet",
+  "kaluar",
+  "tillë",
+  "lartë",
+  "Rama",
+  "Edhe",
+  "Tiranë",
+  "Kosovë",
+  "tre",
+  "kishin",
+  "ndryshme",
+  "Është",
+  "siç",
+  "Dhe",
+  "qeverisë",
+  "Tiranës",
+  "vit",
+  "tonë",
+  "mijë",
+  "Shqipëria",
+  "këtyre",
+  "tjerë",
+  "ana",
+  "milionë",
+  "dje",
+  "njohur",
+  "zgjedhjet",
+  "shtetit",
+  "dytë",
+  "unë",
+  "lidhje",
+  "Ajo",
+  "bëjnë",
+  "euro",
+  "ndonjë",
+  "tashmë",
+  "bën",
+  "politik",
+  "Ka",
+  "viti",
+  "aq",
+  "jenë",
+  "nën",
+  "qeveria",
+  "jemi",
+  "pritet",
+  "drejt",
+  "kështu",
+  "qind",
+  "vendosur",
+  "këtu",
+  "mëdha",
+  "rast",
+  "ditur",
+  "zgjedhjeve",
+  "jashtë",
+  "kërkuar",
+  "gjithashtu",
+  "2",
+  "reja",
+  "Kosova",
+  "shume",
+  "Si",
+  "fjalë",
+  "Ndërsa",
+  "Ata",
+  "vjen",
+  "1",
+  "policisë",
+  "shqiptarë",
+  "nisur",
+  "pranë",
+  "ti",
+  "iu",
+  "vendet",
+  "Gjatë",
+  "shprehur",
+  "t’u",
+  "vërtetë",
+  "tepër",
+  "ekonomike",
+  "10",
+  "Unë",
+  "bëri",
+  "Duke",
+  "arritur",
+  "rëndësishme",
+  "jetën",
+  "vendi",
+  "çështje",
+  "Socialiste",
+  "Ndërkohë",
+  "katër",
+  "bëjë",
+  "fakt",
+  "Partisë",
+  "ndodhur",
+  "shqiptarët",
+  "muaj",
+  "kete",
+  "20",
+  "Presidenti",
+  "cilën",
+  "çfarë",
+  "2009",
+  "2011",
+  "Kryeministri",
+  "lidhur",
+  "ia",
+  "qartë",
+  "mbetet",
+  "A",
+  "Nëse",
+  "persona",
+  "jam",
+  "Kështu",
+  "punë",
+  "hapur",
+  "policia",
+  "kërkon",
+  "cilin",
+  "3",
+  "shpreh",
+  "2010",
+  "vendeve",
+  "vet",
+  "jane",
+  "viteve",
+  "shqiptarëve",
+  "përpara",
+  "publike",
+  "Kur",
+  "lekë",
+  "zyrtare",
+  "vështirë",
+  "kryesore",
+  "5",
+  "mundur",
+  "atyre",
+  "ardhur",
+  "ndërkombëtare",
+  "vënë",
+  "a",
+  "pikë",
+  "vite",
+  "ndërkohë",
+  "atëherë",
+  "deklaruar",
+  "vende",
+  "opozitës",
+  "midis",
+  "mjaft",
+  "dalë",
+  "aty",
+  "theksoi",
+  "vitet",
+  "arsye",
+  "vjeç",
+  "vogël",
+  "rëndë",
+  "tilla",
+  "njerëz",
+  "lënë",
+  "4",
+  "përfshirë",
+  "deklaroi",
+  "kane",
+  "ndër",
+  "plotë",
+  "keq",
+  "Shqipërinë",
+  "vonë",
+  "Megjithatë",
+  "qytetit",
+  "bazë",
+  "di",
+  "sërish",
+  "asaj",
+  "BE",
+  "filluar",
+  "gjetur",
+  "njerëzit",
+  "thuhet",
+  "krijuar",
+  "marrin",
+  "thonë",
+  "Policia",
+  "punës",
+  "rrugë",
+  "Bashkuara",
+  "Këto",
+  "tej",
+  "Kosovën",
+  "tregon",
+  "përmes",
+  "Do",
+  "zgjedhje",
+  "fituar",
+  "botë",
+  "15",
+  "kryer",
+  "8",
+  "publik",
+  "bashku",
+  "vazhdon",
+  "drejtë",
+  "mori",
+  "Partia",
+  "30",
+  "fillim",
+  "madje",
+  "keni",
+  "Sali",
+  "nëpër",
+  "bë",
+  "kreu",
+  "gati",
+  "Edi",
+  "serbe",
+  "kaq",
+  "pikërisht",
+  "rritje",
+  "BE-së",
+  "pra",
+  "ministri",
+  "2008",
+  "Qeveria",
+  "Pra",
+  "mundësi",
+  "shpejt",
+  "6",
+  "Serbisë",
+  "përket",
+  "Ministria",
+  "rëndësishëm",
+  "mbetur",
+  "vendim",
+  "12",
+  "merr",
+  "lirë",
+  "gjendje",
+  "probleme",
+  "ligjit",
+  "rastin",
+  "shteti",
+  "tona",
+  "qytetarët",
+  "Evropian",
+  "qytetarëve",
+  "amerikane",
+  "takim",
+  "tri",
+  "t'i",
+  "menjëherë",
+  "orë",
+  "zhvilluar",
+  "proces",
+  "26",
+  "kenë",
+  "rrugën",
+  "raste",
+  "PS",
+  "PS-së",
+  "sidomos",
+  "shkuar",
+  "qytetin",
+  "punën",
+  "Demokratike",
+  "shtëpi",
+  "veçantë",
+  "ndryshe",
+  "pjesën",
+  "kohën",
+  "diçka",
+  "Kuvendit",
+  "amerikan",
+  "ditën",
+  "jep",
+  "veten",
+  "gjithmonë",
+  "emrin",
+  "qëllim",
+  "kohe",
+  "Europian",
+  "sikur",
+  "vetem",
+  "pesë",
+  "sjellë",
+  "Republikës",
+  "dorë",
+  "larg",
+  "nëpërmjet",
+  "mira",
+  "numër",
+  "aktualisht",
+  "pasojë",
+  "kryesisht",
+  "nevojë",
+  "njeri",
+  "shpesh",
+  "28",
+  "atij",
+  "them",
+  "gjithçka",
+  "vete",
+  "këta",
+  "kryeministri",
+  "rinj",
+  "lloj",
+  "paktën",
+  "humbur",
+  "mbajtur",
+  "kurrë",
+  "drejtim",
+  "krye",
+  "100",
+  "treguar",
+  "pastaj",
+  "dha",
+  "procesin",
+  "asgjë",
+  "kush",
+  "Gjithashtu",
+  "thirrje",
+  "problem",
+  "Serbia",
+  "Këtë",
+  "fare",
+  "kohës",
+  "njëjtën",
+  "numri",
+  "tretë",
+  "ardhshme",
+  "ndeshje",
+  "larta",
+  "politikë",
+  "luftës",
+  "kurse",
+  "thjesht",
+  "kthyer",
+  "kryetari",
+  "ardhmen",
+  "ndodh",
+  "Meta",
+  "javë",
+  "institucionet",
+  "bashkë",
+  "jetës",
+  "momentin",
+  "kryesor",
+  "pushtet",
+  "fortë",
+  "shtuar",
+  "duhej",
+  "Maqedonisë",
+  "partive",
+  "atje",
+  "vjetër",
+  "financiare",
+  "rritur",
+  "ndodhet",
+  "ndodhi",
+  "pari",
+  "botës",
+  "7",
+  "shënuar",
+  "dollarë",
+  "mua",
+  "Sot",
+  "pati",
+  "qendër",
+  "Topi",
+  "Që",
+  "Ministri",
+  "bëhen",
+  "theksuar",
+  "mendoj",
+  "vota",
+  "huaj",
+  "ndoshta",
+  "drejtuar",
+  "greke",
+  "shtet",
+  "faktin",
+  "qoftë",
+  "21",
+  "SHBA",
+  "fëmijët",
+  "janar",
+  "vendimin",
+  "Këshillit",
+  "11",
+  "procesi",
+  "njerëzve",
+  "sotme",
+  "mire",
+  "cilit",
+  "pranuar",
+  "Dy",
+  "marrëveshje",
+  "djeshme",
+  "partisë",
+  "opozita",
+  "Policisë",
+  "vijnë",
+  "qershor",
+  "Gjykata",
+  "bënë",
+  "Prishtinë",
+  "Gazeta",
+  "vrarë",
+  "kërkojnë",
+  "Sa",
+  "Vetëm",
+  "shumta",
+  "kombëtare",
+  "sesa",
+  "parti",
+  "lokale",
+  "ditës",
+  "Madje",
+  "popullit",
+  "institucioneve",
+  "ardhshëm",
+  "koha",
+  "puna",
+  "dhjetor",
+  "zgjidhje",
+  "çka",
+  "Ju",
+  "pavarësisht",
+  "lehtë",
+  "rezultat",
+  "poshtë",
+  "ndërkombëtar",
+  "mediat",
+  "PD-së",
+  "grup",
+  "banorë",
+  "dashur",
+  "fëmijë",
+  "emër",
+  "maj",
+  "ligjore",
+  "anë",
+  "moment",
+  "parlamentare",
+  "sigurisë",
+  "presidenti",
+  "tuaj",
+  "folur",
+  "politikës",
+  "dyja",
+  "pare",
+  "Zi",
+  "shkruar",
+  "forcat",
+  "hap",
+  "25",
+  "dërguar",
+  "afër",
+  "gjashtë",
+  "Aleksandër",
+  "tim",
+  "dot",
+  "ke",
+  "miliardë",
+  "akoma",
+  "vazhdojnë",
+  "ngritur",
+  "Shtetit",
+  "Thaçi",
+  "pune",
+  "bëjmë",
+  "minuta",
+  "duan",
+  "votimit",
+  "Ministrisë",
+  "shkon",
+  "serb",
+  "organizuar",
+  "përbashkët",
+  "Besnik",
+  "18",
+  "fuqi",
+  "gjithnjë",
+  "gjithe",
+  "familje",
+  "ligjin",
+  "Korrik",
+  "ndeshjen",
+  "Obama",
+  "bukur",
+  "parasysh",
+  "50",
+  "ligji",
+  "shkurt",
+  "zgjedhore",
+  "procesit",
+  "burg",
+  "U",
+  "kushtet",
+  "vendimi",
+  "Ilir",
+  "Ndërkaq",
+  "hedhur",
+  "punuar",
+  "rënë",
+  "grupit",
+  "Basha",
+  "familjes",
+  "bashkëpunim",
+  "Disa",
+  "zgjedhur",
+  "Komisioni",
+  "private",
+  "Maqedoni",
+  "partitë",
+  "përdorur",
+  "arriti",
+  "realizuar",
+  "nëntor",
+  "24",
+  "mars",
+  "ekonomik",
+  "problemet",
+  "Gjykatës",
+  "Kryetari",
+  "ngjarje",
+  "Presidentit",
+  "mban",
+  "Bashkimit",
+  "lindur",
+  "Janë",
+  "9",
+  "tetor",
+  "shtator",
+  "armë",
+  "ligj",
+  "politika",
+  "personave",
+  "Berishës",
+  "penale",
+  "Ishte",
+  "quajtur",
+  "botën",
+  "17",
+  "Komisionit",
+  "japin",
+  "vogla",
+  "14",
+  "italiane",
+  "përfunduar",
+  "kërkoi",
+  "histori",
+  "vitesh",
+  "zhvillimin",
+  "kisha",
+  "vdekur",
+  "tërë",
+  "presidentit",
+  "rolin",
+  "shtetërore",
+  "erdhi",
+  "Deri",
+  "thanë",
+  "pushtetit",
+  "Tirana",
+  "fushën",
+  "njeriut",
+  "plot",
+  "kuadër",
+  "situatë",
+  "Itali",
+  "arrestuar",
+  "kryeministrit",
+  "situata",
+  "radhë",
+  "Tani",
+  "historinë",
+  "shkaktuar",
+  "zoti",
+  "takon",
+  "përballë",
+  "muajin",
+  "qytet",
+  "shembull",
+  "del",
+  "Jo",
+  "merret",
+  "bere",
+  "rritjen",
+  "krejt",
+  "vizave",
+  "ditët",
+  "korrik",
+  "askush",
+  "13",
+  "ynë",
+  "situatën",
+  "sukses",
+  "zgjedhor",
+  "person",
+  "raport",
+  "ngjarjes",
+  "Duhet",
+  "evropiane",
+  "here",
+  "16",
+  "ate",
+  "dihet",
+  "ndërmjet",
+  "qeverinë",
+  "derisa",
+  "ushtarake",
+  "nevojshme",
+  "tregojnë",
+  "çështjen",
+  "qene",
+  "gjerë",
+  "Drejtor",
+  "caktuar",
+  "fshatin",
+  "gjermane",
+  "ndryshuar",
+  "përveç",
+  "jeni",
+  "duhur",
+  "tash",
+  "Pavarur",
+  "thjeshtë",
+  "Durrësit",
+  "Pasi",
+  "kryetar",
+  "filloi",
+  "Së",
+  "elektorale",
+  "bënte",
+  "votave",
+  "zonën",
+  "grupi",
+  "paraqitur",
+  "gjendet",
+  "fakti",
+  "NATO-s",
+  "pyetje",
+  "qeveri",
+  "Çipa",
+  "krizës",
+  "sistemit",
+  "skuadra",
+  "vlerë",
+  "Lartë",
+  "japë",
+  "kushte",
+  "rrugës",
+  "shprehet",
+  "2007",
+  "luajtur",
+  "Myftari",
+  "jetojnë",
+  "cilës",
+  "Zoti",
+  "Te",
+  "sociale",
+  "dhënave",
+  "shtoi",
+  "populli",
+  "Kam",
+  "rëndësi",
+  "demokratike",
+  "fundi",
+  "rajon",
+  "drejtën",
+  "prill",
+  "tanë",
+  "SHQIP",
+  "takimit",
+  "Kryeredaktor",
+  "milion",
+  "zyrtar",
+  "jete",
+  "pjesa",
+  "larguar",
+  "Zgjedhor",
+  "formë",
+  "Përditshme",
+  "Shtetet",
+  "megjithatë",
+  "veta",
+  "pavarësisë",
+  "banorët",
+  "ish",
+  "ekziston",
+  "vazhdojë",
+  "masa",
+  "fitoi",
+  "Shumë",
+  "plagosur",
+  "etj.",
+  "mundësinë",
+  "civile",
+  "fitore",
+  "vlerësuar",
+  "veri",
+  "duhen",
+  "Botërore",
+  "sigurt",
+  "time",
+  "përsëri",
+  "pavarur",
+  "kombëtar",
+  "periudhë",
+  "fëmijëve",
+  "energjisë",
+  "ja",
+  "tu",
+  "40",
+  "sistemin",
+  "ndërtuar",
+  "ndihmë",
+  "drejtuesit",
+  "zhvillohet",
+  "shpallur",
+  "ditëve",
+  "hyrë",
+  "besoj",
+  "historike",
+  "detyruar",
+  "dite",
+  "marrëdhëniet",
+  "grek",
+  "autoritetet",
+  "njeriu",
+  "Prandaj",
+  "Kreu",
+  "Home",
+  "numrin",
+  "rezultatin",
+  "22",
+  "shkruan",
+  "komuna",
+  "Drejtësisë",
+  "gjuhën",
+  "nxjerrë",
+  "Prishtinës",
+  "nivelin",
+  "keto",
+  "forcave",
+  "aspak",
+  "luftën",
+  "miratuar",
+  "qershorit",
+  "dalin",
+  "ndarë",
+  "media",
+  "shtetin",
+  "shumica",
+  "mësohet",
+  "jonë",
+  "NATO",
+  "kthehet",
+  "metra",
+  "kryetarit",
+  "mbyllur",
+  "mbështetjen",
+  "Ato",
+  "popullsisë",
+  "tjerët",
+  "mendon",
+  "dhënat",
+  "përfaqësues",
+  "bindur",
+  "ministrit",
+  "vendosi",
+  "orës",
+  "quhet",
+  "2012",
+  "im",
+  "njëri",
+  "qyteti",
+  "shqipe",
+  "flet",
+  "personale",
+  "Kombëtar",
+  "Burime",
+  "gjëra",
+  "23",
+  "vendos",
+  "sipërfaqe",
+  "parlamentar",
+  "PD",
+  "asnjëherë",
+  "siguruar",
+  "tjeter",
+  "Sepse",
+  "ujë",
+  "mënyrën",
+  "fillon",
+  "fjalën",
+  "shpejtë",
+  "personat",
+  "dua",
+  "Këshilli",
+  "Maqedonia",
+  "ma",
+  "thellë",
+  "shtyp",
+  "rastet",
+  "huaja",
+  "to",
+  "Financave",
+  "hetimet",
+  "brendshme",
+  "fat",
+  "ulët",
+  "vetme",
+  "korrupsionit",
+  "ndërtimin",
+  "Jam",
+  "europiane",
+  "Evropës",
+  "zyrtarisht",
+  "doli",
+  "botërore",
+  "përcaktuar",
+  "palët",
+  "përgjigje",
+  "Amerikës",
+  "akuzuar",
+  "anëtare",
+  "shoqërisë",
+  "fshatit",
+  "Bashkisë",
+  "ndodhë",
+  "herët",
+  "projekt",
+  "aktuale",
+  "Greqi",
+  "ndryshime",
+};
+const uint16_t WA_FREQ_151_RANKS[] = {
+  0, 0, 71, 0, 190, 105, 0, 578, 49, 258, 0, 806, 0, 532, 0, 67,
+  126, 275, 0, 0, 462, 107, 79, 36, 309, 46, 935, 53, 77, 0, 476, 130,
+  613, 634, 236, 0, 0, 0, 0, 0, 491, 0, 495, 160, 0, 851, 913, 0,
+  0, 918, 999, 0, 0, 213, 62, 251, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 706, 74, 0, 821, 676, 0, 0, 845, 0, 0, 0, 0, 14, 90, 653,
+  446, 128, 939, 0, 390, 161, 0, 405, 782, 0, 0, 839, 650, 525, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 142, 0, 788, 457, 836, 0,
+  742, 0, 0, 321, 0, 0, 553, 689, 906, 977, 953, 416, 0, 0, 0, 444,
+  343, 529, 998, 348, 385, 0, 0, 467, 346, 568, 0, 122, 437, 0, 0, 0,
+  197, 91, 719, 373, 0, 269, 0, 180, 0, 0, 0, 98, 565, 756, 659, 0,
+  0, 0, 521, 0, 184, 292, 413, 510, 959, 0, 0, 598, 954, 0, 124, 277,
+  917, 248, 327, 929, 0, 0, 166, 0, 0, 112, 820, 886, 0, 0, 0, 284,
+  350, 0, 0, 890, 0, 0, 580, 0, 0, 0, 0, 0, 0, 427, 498, 500,
+  551, 952, 0, 0, 216, 0, 0, 37, 367, 454, 784, 904, 0, 0, 893, 311,
+  0, 325, 938, 368, 810, 889, 0, 708, 776, 141, 238, 590, 937, 0, 0, 0,
+  0, 0, 441, 547, 567, 633, 830, 909, 790, 946, 0, 739, 799, 674, 0, 0,
+  778, 18, 352, 534, 0, 0, 0, 0, 0, 0, 0, 0, 988, 0, 980, 0,
+  0, 926, 0, 0, 0, 814, 0, 0, 0, 345, 384, 365, 663, 979, 226, 0,
+  0, 0, 0, 173, 994, 0, 351, 0, 0, 0, 0, 0, 82, 0, 0, 357,
+  125, 594, 0, 0, 295, 616, 768, 417, 712, 0, 335, 0, 0, 0, 0, 93,
+  572, 874, 647, 0, 707, 237, 504, 0, 0, 0, 570, 817, 0, 0, 0, 0,
+  0, 0, 0, 0, 235, 869, 0, 0, 0, 425, 0, 0, 137, 239, 877, 0,
+  0, 0, 0, 0, 0, 0, 0, 435, 131, 278, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 40, 732, 855, 0, 0, 0, 0, 0, 723, 246, 0, 0, 0,
+  0, 0, 0, 824, 0, 891, 0, 0, 725, 0, 0, 8, 470, 0, 0, 0,
+  54, 0, 0, 665, 63, 264, 655, 474, 912, 0, 296, 0, 0, 852, 0, 0,
+  171, 0, 0, 7, 522, 312, 70, 434, 933, 150, 867, 885, 0, 95, 0, 0,
+  658, 0, 0, 303, 242, 386, 376, 401, 552, 942, 0, 0, 0, 280, 608, 0,
+  0, 609, 0, 0, 0, 0, 0, 0, 0, 204, 0, 0, 751, 579, 818, 0,
+  289, 960, 973, 0, 0, 0, 0, 0, 448, 0, 257, 569, 802, 0, 1, 549,
+  0, 591, 736, 492, 0, 834, 827, 409, 469, 338, 0, 0, 0, 0, 0, 0,
+  0, 364, 0, 0, 0, 0, 58, 537, 825, 453, 0, 11, 557, 617, 875, 0,
+  0, 0, 0, 145, 0, 849, 892, 716, 73, 724, 0, 728, 0, 566, 0, 667,
+  0, 402, 186, 0, 0, 898, 287, 0, 0, 0, 304, 876, 178, 0, 0, 0,
+  996, 158, 0, 0, 685, 205, 925, 316, 607, 738, 767, 192, 648, 0, 0, 57,
+  930, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 47, 0, 0, 0, 692,
+  501, 87, 270, 489, 0, 0, 628, 704, 0, 0, 0, 0, 0, 0, 745, 693,
+  0, 0, 330, 0, 0, 0, 0, 0, 515, 113, 0, 0, 0, 0, 0, 0,
+  123, 0, 622, 340, 75, 974, 543, 0, 780, 593, 1000, 0, 298, 0, 0, 0,
+  78, 0, 0, 0, 0, 0, 92, 507, 0, 964, 433, 488, 0, 0, 231, 958,
+  0, 0, 0, 0, 0, 0, 0, 0, 452, 841, 688, 714, 0, 737, 0, 25,
+  789, 486, 15, 0, 0, 0, 0, 227, 0, 38, 0, 43, 250, 0, 0, 0,
+  232, 684, 702, 0, 119, 456, 902, 0, 0, 80, 804, 0, 233, 955, 0, 333,
+  0, 639, 808, 0, 772, 127, 395, 948, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 680, 563, 136, 203, 899, 0, 0, 585, 862, 0, 0, 0, 110, 0,
+  0, 0, 993, 559, 512, 614, 0, 0, 0, 293, 837, 0, 0, 211, 840, 0,
+  170, 0, 0, 0, 972, 0, 0, 0, 283, 174, 770, 0, 0, 0, 0, 987,
+  0, 863, 0, 431, 0, 0, 0, 372, 0, 0, 0, 165, 0, 0, 182, 148,
+  541, 871, 934, 519, 146, 157, 520, 646, 0, 866, 0, 0, 0, 0, 858, 0,
+  0, 208, 244, 0, 774, 0, 0, 466, 0, 0, 0, 13, 747, 0, 0, 0,
+  255, 336, 329, 0, 0, 0, 193, 0, 299, 0, 668, 83, 214, 0, 0, 0,
+  792, 0, 0, 0, 443, 0, 403, 0, 0, 619, 0, 369, 0, 337, 0, 388,
+  0, 0, 0, 897, 741, 514, 854, 0, 253, 699, 0, 0, 261, 0, 199, 0,
+  928, 0, 0, 0, 701, 0, 779, 822, 605, 0, 0, 324, 0, 0, 0, 0,
+  0, 187, 524, 370, 17, 349, 0, 581, 0, 0, 0, 76, 354, 0, 4, 0,
+  0, 0, 0, 632, 0, 0, 850, 527, 807, 0, 0, 65, 0, 0, 713, 0,
+  209, 149, 30, 0, 715, 0, 606, 436, 0, 0, 0, 0, 0, 116, 308, 442,
+  69, 0, 0, 0, 538, 0, 414, 465, 0, 0, 0, 0, 677, 0, 0, 691,
+  574, 620, 48, 260, 0, 0, 0, 0, 0, 306, 475, 734, 0, 997, 698, 0,
+  0, 169, 0, 0, 0, 0, 0, 0, 0, 274, 0, 61, 347, 378, 0, 0,
+  0, 0, 554, 638, 196, 941, 0, 0, 0, 783, 215, 816, 0, 503, 0, 542,
+  883, 631, 51, 177, 359, 478, 398, 846, 0, 0, 218, 0, 0, 189, 0, 0,
+  0, 517, 35, 764, 975, 0, 0, 314, 618, 623, 0, 0, 561, 282, 611, 859,
+  0, 0, 0, 511, 0, 710, 989, 0, 0, 0, 363, 947, 0, 0, 0, 771,
+  0, 22, 640, 727, 577, 85, 967, 0, 881, 0, 28, 140, 223, 224, 0, 0,
+  86, 720, 356, 705, 0, 0, 726, 621, 56, 317, 670, 831, 0, 0, 0, 544,
+  0, 0, 0, 220, 0, 0, 0, 571, 0, 412, 12, 445, 599, 129, 0, 383,
+  0, 0, 0, 0, 0, 0, 27, 0, 0, 0, 0, 0, 0, 558, 0, 430,
+  0, 0, 690, 332, 0, 556, 597, 0, 294, 0, 164, 315, 681, 360, 463, 0,
+  0, 263, 183, 0, 477, 0, 0, 0, 0, 0, 0, 0, 468, 990, 795, 0,
+  421, 686, 749, 419, 20, 464, 922, 0, 654, 880, 328, 210, 88, 970, 342, 0,
+  0, 0, 773, 595, 0, 0, 0, 0, 0, 0, 103, 188, 252, 828, 0, 482,
+  163, 576, 0, 0, 109, 596, 0, 649, 19, 0, 0, 0, 281, 344, 838, 429,
+  801, 0, 0, 0, 229, 0, 0, 0, 644, 908, 0, 422, 479, 588, 803, 0,
+  865, 382, 945, 0, 0, 0, 0, 0, 0, 662, 743, 951, 0, 0, 0, 0,
+  0, 0, 800, 50, 0, 428, 796, 181, 0, 391, 0, 0, 0, 481, 0, 0,
+  0, 380, 450, 0, 0, 914, 0, 234, 981, 0, 0, 0, 0, 0, 0, 0,
+  506, 0, 0, 0, 0, 0, 0, 815, 584, 781, 533, 931, 0, 0, 545, 0,
+  0, 0, 0, 387, 415, 656, 55, 809, 589, 358, 901, 410, 982, 0, 0, 962,
+  905, 661, 703, 0, 0, 0, 0, 968, 775, 0, 301, 0, 966, 139, 0, 965,
+  0, 484, 878, 957, 0, 625, 0, 0, 0, 0, 540, 307, 0, 0, 0, 331,
+  341, 271, 0, 0, 396, 0, 318, 0, 0, 835, 404, 0, 927, 0, 0, 0,
+  0, 0, 0, 0, 247, 459, 0, 0, 423, 0, 786, 0, 976, 0, 0, 695,
+  26, 530, 0, 610, 0, 683, 392, 986, 0, 0, 0, 0, 0, 424, 0, 0,
+  300, 81, 439, 449, 0, 42, 0, 0, 397, 985, 0, 84, 101, 212, 472, 528,
+  66, 0, 0, 0, 0, 0, 843, 41, 879, 0, 0, 0, 0, 432, 60, 219,
+  153, 152, 245, 366, 518, 555, 731, 0, 0, 0, 0, 144, 0, 0, 0, 760,
+  0, 195, 0, 175, 379, 0, 447, 0, 0, 0, 0, 0, 0, 694, 873, 0,
+  0, 0, 0, 319, 411, 0, 0, 0, 0, 310, 765, 0, 978, 916, 167, 228,
+  0, 374, 984, 0, 94, 0, 254, 0, 0, 458, 798, 793, 0, 643, 921, 23,
+  673, 0, 0, 0, 0, 0, 0, 0, 241, 762, 108, 490, 0, 0, 766, 0,
+  21, 279, 45, 362, 697, 750, 753, 0, 9, 0, 96, 0, 759, 0, 924, 29,
+  722, 132, 0, 0, 0, 0, 0, 179, 0, 31, 0, 120, 0, 0, 0, 0,
+  882, 0, 267, 0, 0, 0, 0, 0, 0, 0, 560, 0, 268, 0, 826, 202,
+  0, 6, 0, 297, 34, 217, 399, 134, 763, 0, 0, 0, 0, 420, 861, 0,
+  0, 0, 0, 0, 0, 451, 983, 225, 0, 0, 0, 629, 159, 963, 487, 0,
+  320, 672, 0, 536, 0, 0, 0, 496, 769, 480, 794, 777, 106, 206, 361, 502,
+  513, 592, 671, 811, 932, 485, 943, 394, 0, 172, 0, 0, 0, 0, 0, 0,
+  0, 833, 717, 0, 371, 535, 604, 499, 627, 0, 0, 32, 0, 0, 305, 0,
+  0, 0, 334, 326, 200, 353, 526, 600, 813, 0, 0, 0, 0, 322, 860, 0,
+  895, 0, 523, 564, 0, 0, 0, 0, 0, 0, 0, 0, 407, 355, 761, 0,
+  0, 0, 0, 0, 847, 426, 0, 0, 0, 0, 0, 669, 602, 0, 10, 471,
+  900, 0, 0, 679, 0, 24, 651, 721, 907, 33, 154, 787, 911, 0, 176, 240,
+  0, 0, 583, 2, 323, 711, 868, 156, 657, 944, 0, 735, 0, 0, 222, 746,
+  68, 586, 0, 0, 100, 919, 104, 0, 0, 276, 0, 406, 243, 995, 0, 0,
+  143, 493, 645, 635, 272, 797, 0, 0, 0, 0, 0, 0, 377, 0, 0, 0,
+  757, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 509, 624,
+  0, 0, 0, 516, 842, 59, 0, 888, 857, 0, 636, 718, 550, 102, 118, 0,
+  0, 266, 505, 0, 0, 0, 381, 0, 0, 575, 291, 971, 0, 0, 0, 0,
+  0, 121, 201, 168, 285, 0, 0, 696, 5, 0, 0, 483, 864, 0, 262, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 191, 0, 0, 641,
+  0, 0, 0, 0, 0, 0, 0, 729, 39, 473, 548, 660, 755, 832, 903, 949,
+  64, 162, 221, 256, 752, 0, 185, 531, 872, 887, 249, 0, 844, 0, 969, 791,
+  0, 0, 0, 0, 0, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 400, 748, 0, 0, 0, 0, 44, 823, 0, 265, 455, 0, 0,
+  0, 389, 0, 0, 0, 89, 494, 805, 418, 709, 0, 0, 155, 0, 812, 0,
+  0, 848, 0, 0, 700, 302, 0, 288, 637, 896, 0, 286, 630, 0, 273, 675,
+  259, 0, 0, 0, 936, 992, 0, 0, 497, 0, 562, 0, 0, 0, 0, 0,
+  0, 546, 0, 0, 0, 991, 0, 0, 0, 0, 961, 0, 0, 733, 0, 819,
+  0, 339, 207, 853, 147, 460, 0, 0, 0, 615, 440, 438, 0, 0, 138, 508,
+  194, 870, 0, 0, 0, 601, 539, 151, 582, 956, 894, 0, 0, 0, 0, 0,
+  0, 603, 730, 0, 0, 0, 290, 744, 0, 0, 0, 758, 0, 0, 0, 612,
+  587, 678, 785, 923, 0, 0, 0, 97, 0, 0, 0, 940, 0, 3, 0, 0,
+  0, 664, 0, 626, 0, 115, 0, 0, 573, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 856, 0, 0, 99, 133, 408, 754, 0, 0, 0, 0, 111, 114, 0,
+  72, 16, 950, 0, 0, 198, 0, 0, 0, 135, 0, 0, 0, 0, 652, 0,
+  0, 313, 461, 0, 642, 0, 740, 117, 666, 0, 0, 0, 0, 884, 0, 0,
+  375, 687, 910, 915, 0, 0, 52, 829, 0, 0, 0, 393, 0, 0, 920, 682,
+};
+
+const char *WA_FREQ_152_TOKENS[] = {
+  "da",
+  "je",
+  "ne",
+  "se",
+  "i",
+  "u",
+  "to",
+  "sam",
+  "na",
+  "ti",
+  "mi",
+  "za",
+  "si",
+  "li",
+  "šta",
+  "što",
+  "ja",
+  "ali",
+  "sa",
+  "su",
+  "nije",
+  "ovo",
+  "samo",
+  "me",
+  "te",
+  "od",
+  "a",
+  "ga",
+  "bi",
+  "kako",
+  "o",
+  "dobro",
+  "ako",
+  "sve",
+  "smo",
+  "kao",
+  "će",
+  "tako",
+  "znam",
+  "nisam",
+  "mogu",
+  "ste",
+  "ovde",
+  "pa",
+  "bio",
+  "zašto",
+  "s",
+  "on",
+  "još",
+  "nešto",
+  "bilo",
+  "redu",
+  "biti",
+  "koji",
+  "kad",
+  "vas",
+  "ću",
+  "hvala",
+  "iz",
+  "mislim",
+  "ima",
+  "ili",
+  "znaš",
+  "možda",
+  "ih",
+  "više",
+  "onda",
+  "sada",
+  "vam",
+  "zar",
+  "gde",
+  "да",
+  "do",
+  "bih",
+  "treba",
+  "moj",
+  "mu",
+  "rekao",
+  "bila",
+  "malo",
+  "kada",
+  "nema",
+  "ništa",
+  "nas",
+  "mene",
+  "ko",
+  "ona",
+  "је",
+  "tebe",
+  "molim",
+  "sad",
+  "ni",
+  "hajde",
+  "tamo",
+  "može",
+  "možeš",
+  "imam",
+  "zbog",
+  "vi",
+  "nam",
+  "želim",
+  "tu",
+  "hej",
+  "nisi",
+  "stvarno",
+  "jesi",
+  "jer",
+  "svi",
+  "po",
+  "zato",
+  "baš",
+  "ljudi",
+  "moram",
+  "koliko",
+  "ćemo",
+  "misliš",
+  "već",
+  "jedan",
+  "stvari",
+  "idemo",
+  "pre",
+  "moja",
+  "ćeš",
+  "nego",
+  "koje",
+  "dok",
+  "neće",
+  "uvek",
+  "bez",
+  "oh",
+  "naravno",
+  "toga",
+  "ono",
+  "imaš",
+  "mnogo",
+  "joj",
+  "možemo",
+  "ovaj",
+  "neko",
+  "oni",
+  "gospodine",
+  "vreme",
+  "taj",
+  "dana",
+  "kod",
+  "koja",
+  "tvoj",
+  "zdravo",
+  "reći",
+  "moje",
+  "znači",
+  "tome",
+  "posao",
+  "nikad",
+  "žao",
+  "hoćeš",
+  "rekla",
+  "bolje",
+  "godina",
+  "imamo",
+  "mogao",
+  "put",
+  "jeste",
+  "vidim",
+  "dan",
+  "mora",
+  "radi",
+  "izgleda",
+  "neću",
+  "moramo",
+  "želiš",
+  "nemoj",
+  "bude",
+  "bili",
+  "kažem",
+  "ovdje",
+  "radiš",
+  "meni",
+  "idem",
+  "bože",
+  "mama",
+  "не",
+  "moraš",
+  "ok",
+  "daj",
+  "dobar",
+  "tata",
+  "vidi",
+  "volim",
+  "се",
+  "im",
+  "у",
+  "život",
+  "kući",
+  "reci",
+  "и",
+  "svoje",
+  "dva",
+  "njega",
+  "trebalo",
+  "stvar",
+  "nisu",
+  "mislio",
+  "vremena",
+  "imao",
+  "evo",
+  "danas",
+  "znate",
+  "nikada",
+  "zna",
+  "odmah",
+  "tvoja",
+  "možete",
+  "toliko",
+  "neka",
+  "kaže",
+  "neki",
+  "video",
+  "tri",
+  "tim",
+  "tobom",
+  "čak",
+  "ime",
+  "veoma",
+  "то",
+  "koju",
+  "hoću",
+  "čemu",
+  "niko",
+  "oko",
+  "svoju",
+  "žena",
+  "tvoje",
+  "opet",
+  "upravo",
+  "svoj",
+  "mnom",
+  "jesam",
+  "ide",
+  "сам",
+  "nismo",
+  "idi",
+  "sigurno",
+  "vidimo",
+  "jednom",
+  "radim",
+  "ove",
+  "god",
+  "vidiš",
+  "postoji",
+  "nemam",
+  "gdje",
+  "otac",
+  "ta",
+  "kažeš",
+  "čovek",
+  "tebi",
+  "puno",
+  "znao",
+  "lepo",
+  "želi",
+  "puta",
+  "godine",
+  "čekaj",
+  "pravu",
+  "jako",
+  "prvi",
+  "novac",
+  "dovoljno",
+  "sutra",
+  "izvini",
+  "dalje",
+  "zajedno",
+  "dušo",
+  "sebe",
+  "drugi",
+  "njih",
+  "došao",
+  "dosta",
+  "problem",
+  "imate",
+  "g",
+  "prema",
+  "ova",
+  "odavde",
+  "mesto",
+  "koga",
+  "ovamo",
+  "slušaj",
+  "jedna",
+  "vrlo",
+  "drago",
+  "uradio",
+  "način",
+  "desilo",
+  "sranje",
+  "budem",
+  "pomoći",
+  "ponovo",
+  "ma",
+  "mogla",
+  "kroz",
+  "posle",
+  "nećeš",
+  "dobra",
+  "zaista",
+  "hteo",
+  "vrata",
+  "brzo",
+  "tko",
+  "njim",
+  "moju",
+  "pogledaj",
+  "siguran",
+  "dođi",
+  "neke",
+  "nekoliko",
+  "par",
+  "noć",
+  "dugo",
+  "verujem",
+  "pod",
+  "jednu",
+  "loše",
+  "previše",
+  "naš",
+  "ovog",
+  "večeras",
+  "mislila",
+  "на",
+  "trebao",
+  "mog",
+  "ovako",
+  "izvinite",
+  "vaš",
+  "ćete",
+  "gore",
+  "ovu",
+  "isto",
+  "pravo",
+  "nakon",
+  "teško",
+  "mogli",
+  "svaki",
+  "nama",
+  "prvo",
+  "nadam",
+  "protiv",
+  "super",
+  "čuo",
+  "mali",
+  "jedno",
+  "vama",
+  "prije",
+  "kasnije",
+  "niste",
+  "minuta",
+  "biće",
+  "l",
+  "unutra",
+  "pravi",
+  "sto",
+  "шта",
+  "znamo",
+  "dešava",
+  "momci",
+  "majka",
+  "ovom",
+  "osim",
+  "imala",
+  "ubio",
+  "sta",
+  "jednog",
+  "tom",
+  "ćao",
+  "sviđa",
+  "pomoć",
+  "ideš",
+  "dve",
+  "mislite",
+  "kuće",
+  "imaju",
+  "pusti",
+  "preko",
+  "ти",
+  "doći",
+  "vaše",
+  "naše",
+  "želite",
+  "one",
+  "verovatno",
+  "dakle",
+  "istina",
+  "veliki",
+  "ljude",
+  "čoveče",
+  "hoće",
+  "dogodilo",
+  "jel",
+  "kakav",
+  "за",
+  "budeš",
+  "njegov",
+  "ми",
+  "tačno",
+  "naći",
+  "budi",
+  "misli",
+  "razumem",
+  "zove",
+  "auto",
+  "imali",
+  "čini",
+  "uvijek",
+  "dolazi",
+  "radio",
+  "ići",
+  "dete",
+  "rekli",
+  "onaj",
+  "ли",
+  "deo",
+  "broj",
+  "nju",
+  "otišao",
+  "tog",
+  "ruke",
+  "dole",
+  "imati",
+  "uz",
+  "pet",
+  "zapravo",
+  "vezi",
+  "ја",
+  "sebi",
+  "života",
+  "mrtav",
+  "priča",
+  "veze",
+  "nekog",
+  "bismo",
+  "vrati",
+  "си",
+  "svog",
+  "dao",
+  "ipak",
+  "bar",
+  "novi",
+  "videla",
+  "drugo",
+  "posla",
+  "ovim",
+  "tip",
+  "svojim",
+  "prijatelj",
+  "vrijeme",
+  "vidite",
+  "dobio",
+  "stani",
+  "vaša",
+  "prestani",
+  "iza",
+  "sama",
+  "žene",
+  "znala",
+  "tvoju",
+  "odlično",
+  "skoro",
+  "sin",
+  "njima",
+  "govori",
+  "vratiti",
+  "pitanje",
+  "nazad",
+  "voli",
+  "uzmi",
+  "došli",
+  "srce",
+  "važno",
+  "dolara",
+  "njom",
+  "mom",
+  "njemu",
+  "pitam",
+  "morate",
+  "takođe",
+  "radimo",
+  "voleo",
+  "ce",
+  "jutro",
+  "najbolje",
+  "problema",
+  "oca",
+  "uskoro",
+  "sjajno",
+  "са",
+  "nekoga",
+  "jednostavno",
+  "gotovo",
+  "су",
+  "čega",
+  "trenutak",
+  "potpuno",
+  "drži",
+  "sigurna",
+  "tada",
+  "ovoga",
+  "uopšte",
+  "dobiti",
+  "briga",
+  "otići",
+  "njegova",
+  "brini",
+  "ranije",
+  "ju",
+  "stalno",
+  "došla",
+  "bog",
+  "našao",
+  "ponekad",
+  "kakva",
+  "strane",
+  "ljubav",
+  "moći",
+  "htela",
+  "sati",
+  "naša",
+  "nemaš",
+  "kuću",
+  "tek",
+  "osećam",
+  "valjda",
+  "noći",
+  "halo",
+  "želeo",
+  "spreman",
+  "životu",
+  "poput",
+  "lako",
+  "pričaš",
+  "devojka",
+  "između",
+  "uradim",
+  "morao",
+  "trebali",
+  "jedini",
+  "али",
+  "ideja",
+  "trebala",
+  "ženu",
+  "znati",
+  "ozbiljno",
+  "čudno",
+  "uh",
+  "nećemo",
+  "druge",
+  "pola",
+  "sat",
+  "prijatelji",
+  "videti",
+  "glavu",
+  "pretpostavljam",
+  "čoveka",
+  "hoćete",
+  "ubiti",
+  "svet",
+  "prava",
+  "zvuči",
+  "oči",
+  "živi",
+  "grad",
+  "mala",
+  "pored",
+  "dr",
+  "radite",
+  "draga",
+  "pred",
+  "rade",
+  "tvog",
+  "kraj",
+  "velika",
+  "biste",
+  "jasno",
+  "slučaj",
+  "ovoj",
+  "svih",
+  "gledaj",
+  "kažu",
+  "kola",
+  "najbolji",
+  "događa",
+  "voliš",
+  "brat",
+  "pazi",
+  "svetu",
+  "slučaju",
+  "ikada",
+  "sata",
+  "oprosti",
+  "mojoj",
+  "stari",
+  "e",
+  "ljudima",
+  "nemamo",
+  "osoba",
+  "čujem",
+  "polako",
+  "ruku",
+  "negde",
+  "učiniti",
+  "dvoje",
+  "blizu",
+  "kraju",
+  "četiri",
+  "odakle",
+  "prilično",
+  "nedelje",
+  "vratio",
+  "van",
+  "није",
+  "uradi",
+  "svega",
+  "што",
+  "ceo",
+  "moguće",
+  "znaju",
+  "svom",
+  "dati",
+  "laku",
+  "lice",
+  "smrt",
+  "gospođo",
+  "moji",
+  "izgledaš",
+  "videli",
+  "neku",
+  "vodi",
+  "raditi",
+  "plan",
+  "policija",
+  "smrti",
+  "sina",
+  "pojma",
+  "šanse",
+  "sobu",
+  "no",
+  "manje",
+  "nje",
+  "brod",
+  "daleko",
+  "novca",
+  "žele",
+  "netko",
+  "gospodo",
+  "ostati",
+  "vidjeti",
+  "sinoć",
+  "oprostite",
+  "svima",
+  "reč",
+  "само",
+  "momak",
+  "од",
+  "čula",
+  "našli",
+  "pitanja",
+  "važi",
+  "bile",
+  "mojim",
+  "drugog",
+  "razlog",
+  "dečko",
+  "га",
+  "vidio",
+  "napolje",
+  "potrebno",
+  "oružje",
+  "njen",
+  "pomognem",
+  "dragi",
+  "šest",
+  "ово",
+  "sobi",
+  "dođe",
+  "а",
+  "istinu",
+  "nemojte",
+  "uradila",
+  "otišla",
+  "pištolj",
+  "ispod",
+  "čim",
+  "mesta",
+  "izgubio",
+  "napravio",
+  "nekako",
+  "devojke",
+  "vode",
+  "kome",
+  "pošto",
+  "sećaš",
+  "uraditi",
+  "prijatelja",
+  "umro",
+  "о",
+  "jesu",
+  "sastanak",
+  "moglo",
+  "njoj",
+  "njegove",
+  "trebam",
+  "ме",
+  "zovem",
+  "aha",
+  "pričam",
+  "ljubavi",
+  "odem",
+  "ispred",
+  "telo",
+  "divno",
+  "tražim",
+  "jedino",
+  "piće",
+  "deca",
+  "sedi",
+  "zaboravi",
+  "veče",
+  "ikad",
+  "dođavola",
+  "govoriš",
+  "iako",
+  "gradu",
+  "govorim",
+  "dajte",
+  "decu",
+  "srećan",
+  "ostavi",
+  "učinio",
+  "krv",
+  "recite",
+  "mrzim",
+  "spremni",
+  "те",
+  "poruku",
+  "uzeo",
+  "san",
+  "nekim",
+  "би",
+  "telefon",
+  "razgovarati",
+  "igra",
+  "mestu",
+  "uradiš",
+  "sestra",
+  "sine",
+  "zvao",
+  "kuća",
+  "ha",
+  "kažete",
+  "tvom",
+  "ovih",
+  "pokušavam",
+  "ostani",
+  "ovome",
+  "oboje",
+  "volela",
+  "ovi",
+  "kapetane",
+  "takav",
+  "rat",
+  "sva",
+  "sećam",
+  "poslednji",
+  "sami",
+  "pogledajte",
+  "želimo",
+  "muž",
+  "deset",
+  "bojim",
+  "onog",
+  "како",
+  "svako",
+  "reči",
+  "zemlji",
+  "putu",
+  "bit",
+  "добро",
+  "смо",
+  "vratim",
+  "njegovo",
+  "razumeš",
+  "pitao",
+  "film",
+  "traži",
+  "budu",
+  "porodica",
+  "brate",
+  "ostavio",
+  "budemo",
+  "isti",
+  "cu",
+  "morati",
+  "kakve",
+  "svakog",
+  "svojoj",
+  "jedina",
+  "doktor",
+  "čuješ",
+  "dame",
+  "bok",
+  "razloga",
+  "svim",
+  "zemlju",
+  "smiri",
+  "eto",
+  "druga",
+  "hajdemo",
+  "ostali",
+  "pokušao",
+  "prva",
+  "isuse",
+  "našu",
+  "miru",
+  "odeš",
+  "napred",
+  "ако",
+  "pitanju",
+  "као",
+  "postoje",
+  "drugu",
+  "tražio",
+  "drugom",
+  "poslu",
+  "htio",
+  "све",
+  "otvori",
+  "boli",
+  "čeka",
+  "vašu",
+  "doktore",
+  "ah",
+  "napraviti",
+  "krevet",
+  "gdine",
+  "našeg",
+  "ће",
+  "ostalo",
+  "nitko",
+  "dobre",
+  "nikoga",
+  "čovjek",
+  "lepa",
+  "njegovu",
+  "nastavi",
+  "овде",
+  "lud",
+  "kim",
+  "večeru",
+  "сте",
+  "gđo",
+  "konačno",
+  "uzeti",
+  "sveta",
+  "kraja",
+  "obično",
+  "znali",
+  "tvojim",
+  "jutros",
+  "spremna",
+  "jedva",
+  "boga",
+  "smešno",
+  "koristi",
+  "školu",
+  "poziv",
+  "tih",
+  "piše",
+  "svakom",
+  "krvi",
+  "poslao",
+  "brata",
+  "zanima",
+  "mjesto",
+  "živ",
+  "dali",
+  "brže",
+  "kojoj",
+  "očigledno",
+  "počeo",
+  "posebno",
+  "priču",
+  "svakako",
+  "niti",
+  "odgovor",
+  "hoćemo",
+  "gospodin",
+  "тако",
+  "zaboravio",
+  "idite",
+  "shvatio",
+  "pomozi",
+  "nova",
+  "zemlje",
+  "strašno",
+  "sledeći",
+  "trebaš",
+  "dolazim",
+  "meseci",
+  "grada",
+  "ode",
+  "među",
+  "lijepo",
+  "barem",
+  "želela",
+  "savršeno",
+  "он",
+  "druže",
+  "stan",
+  "čuli",
+  "mrtva",
+  "kriv",
+  "devojku",
+  "noge",
+  "dobila",
+  "biću",
+  "vašeg",
+  "dobri",
+  "jebi",
+  "sreće",
+  "vesti",
+  "nećete",
+  "sasvim",
+  "dala",
+  "nosi",
+  "oče",
+  "red",
+  "prošle",
+  "pronaći",
+  "uradimo",
+  "roditelji",
+  "godinu",
+  "slušajte",
+  "tokom",
+  "nekad",
+  "dobili",
+  "time",
+  "velike",
+  "kasno",
+  "misle",
+  "ka",
+  "prošlo",
+  "k",
+  "majku",
+  "prijatelju",
+  "iskreno",
+  "bolji",
+  "trenutno",
+  "zbogom",
+  "često",
+  "inače",
+  "toj",
+  "kuda",
+  "ubistvo",
+  "nađem",
+  "živim",
+  "ubica",
+  "zabavno",
+  "odlazi",
+  "gledam",
+  "uradili",
+  "porodicu",
+  "izlazi",
+  "našla",
+  "sobom",
+  "postao",
+  "jebeni",
+  "stigao",
+  "godinama",
+  "kojeg",
+  "tvojoj",
+  "đavola",
+  "celu",
+  "dolaze",
+  "mojih",
+  "moraju",
+  "priliku",
+  "morala",
+  "pravila",
+  "požuri",
+  "jesmo",
+  "nemoguće",
+  "umesto",
+  "školi",
+  "idu",
+  "napolju",
+  "drugačije",
+  "sigurni",
+  "društvo",
+  "stavi",
+  "meseca",
+};
+const uint16_t WA_FREQ_152_RANKS[] = {
+  0, 528, 386, 69, 0, 234, 890, 0, 0, 0, 0, 732, 0, 547, 816, 0,
+  240, 789, 382, 0, 127, 413, 0, 89, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 120, 0, 628, 861, 0, 0, 0, 0, 679, 0, 0, 0, 0,
+  78, 806, 490, 266, 922, 308, 0, 857, 0, 0, 675, 268, 0, 0, 0, 579,
+  0, 0, 645, 0, 0, 340, 0, 0, 0, 0, 0, 125, 0, 191, 0, 0,
+  0, 0, 573, 0, 812, 117, 926, 391, 523, 705, 0, 0, 502, 786, 951, 350,
+  0, 0, 572, 896, 364, 0, 0, 378, 844, 0, 0, 56, 0, 0, 0, 0,
+  0, 0, 0, 0, 872, 0, 0, 0, 0, 995, 902, 725, 0, 0, 0, 390,
+  518, 0, 0, 0, 0, 241, 66, 77, 517, 195, 0, 938, 0, 0, 888, 0,
+  0, 0, 817, 0, 0, 0, 116, 0, 313, 339, 881, 0, 0, 0, 169, 562,
+  0, 661, 0, 54, 0, 0, 0, 996, 0, 981, 833, 0, 392, 697, 741, 0,
+  0, 0, 0, 998, 948, 0, 0, 0, 0, 959, 657, 124, 67, 0, 354, 0,
+  0, 0, 0, 0, 0, 0, 676, 499, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 606, 0, 0, 0, 0, 218, 590, 430, 0, 718, 540, 0,
+  159, 0, 0, 108, 136, 0, 0, 292, 0, 271, 0, 0, 163, 237, 418, 509,
+  803, 0, 703, 79, 0, 0, 0, 0, 0, 161, 0, 164, 980, 702, 455, 0,
+  0, 25, 667, 16, 36, 0, 0, 0, 0, 0, 0, 0, 379, 0, 0, 0,
+  0, 0, 0, 0, 0, 635, 133, 793, 0, 935, 0, 977, 0, 0, 0, 835,
+  519, 548, 22, 899, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 253, 0, 20, 671, 174, 129, 550, 955, 0, 0, 0, 443, 0, 0, 0,
+  0, 0, 269, 0, 0, 498, 140, 819, 933, 0, 0, 0, 0, 0, 0, 0,
+  0, 34, 310, 856, 947, 946, 580, 0, 522, 0, 779, 147, 185, 763, 102, 329,
+  759, 827, 923, 982, 0, 0, 0, 0, 406, 685, 0, 0, 0, 314, 0, 30,
+  50, 0, 0, 0, 358, 375, 621, 110, 0, 0, 485, 0, 0, 790, 345, 965,
+  0, 704, 475, 431, 0, 0, 619, 0, 275, 291, 607, 0, 865, 0, 0, 395,
+  49, 0, 252, 0, 0, 186, 211, 570, 581, 852, 0, 593, 59, 967, 0, 0,
+  0, 0, 0, 24, 0, 993, 0, 631, 258, 0, 0, 514, 0, 677, 42, 0,
+  81, 0, 0, 27, 193, 0, 0, 706, 0, 507, 669, 115, 12, 0, 343, 931,
+  932, 0, 468, 887, 0, 0, 0, 469, 780, 694, 745, 529, 673, 0, 0, 736,
+  0, 74, 563, 0, 113, 832, 0, 0, 0, 0, 874, 0, 0, 569, 0, 0,
+  0, 208, 0, 0, 0, 0, 0, 0, 149, 0, 0, 0, 322, 988, 0, 0,
+  0, 753, 0, 0, 0, 0, 44, 493, 889, 294, 145, 33, 87, 568, 608, 960,
+  937, 0, 0, 604, 399, 394, 500, 440, 556, 71, 560, 949, 0, 0, 381, 0,
+  0, 203, 0, 196, 647, 0, 629, 0, 0, 506, 226, 17, 178, 0, 0, 0,
+  319, 516, 895, 0, 0, 0, 75, 687, 724, 0, 132, 283, 777, 424, 898, 1000,
+  0, 738, 326, 727, 538, 0, 0, 0, 0, 0, 0, 448, 450, 51, 503, 553,
+  0, 376, 994, 425, 0, 0, 0, 0, 649, 692, 332, 717, 773, 0, 504, 18,
+  0, 0, 477, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  831, 575, 0, 0, 648, 989, 436, 0, 0, 0, 747, 0, 184, 652, 0, 0,
+  0, 0, 28, 0, 0, 799, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  304, 0, 458, 690, 866, 713, 973, 0, 0, 0, 0, 624, 839, 293, 0, 233,
+  57, 137, 351, 21, 659, 709, 730, 930, 243, 289, 151, 466, 206, 612, 849, 393,
+  770, 0, 627, 944, 9, 0, 0, 0, 0, 0, 0, 0, 10, 0, 0, 0,
+  432, 84, 917, 298, 0, 408, 0, 636, 927, 0, 0, 611, 461, 0, 0, 0,
+  0, 367, 355, 0, 0, 0, 800, 0, 0, 855, 26, 966, 0, 670, 757, 96,
+  248, 975, 0, 107, 497, 864, 0, 910, 0, 284, 853, 0, 0, 0, 637, 936,
+  398, 409, 417, 0, 0, 0, 90, 0, 601, 0, 0, 40, 247, 0, 0, 365,
+  871, 0, 0, 0, 0, 527, 0, 0, 400, 0, 232, 207, 0, 0, 0, 0,
+  0, 0, 916, 388, 804, 0, 0, 979, 0, 0, 767, 653, 0, 0, 0, 318,
+  0, 595, 333, 0, 877, 921, 584, 0, 407, 985, 0, 0, 0, 0, 0, 0,
+  0, 31, 0, 0, 43, 0, 238, 0, 494, 0, 0, 337, 0, 0, 0, 249,
+  0, 0, 0, 0, 0, 0, 0, 0, 479, 958, 525, 0, 0, 0, 0, 0,
+  809, 336, 708, 0, 620, 0, 822, 0, 795, 0, 72, 956, 99, 134, 198, 0,
+  862, 0, 681, 761, 0, 0, 907, 0, 0, 168, 45, 286, 867, 905, 0, 0,
+  0, 0, 130, 0, 783, 0, 2, 335, 411, 492, 557, 683, 762, 618, 5, 774,
+  854, 402, 0, 0, 0, 106, 209, 0, 0, 0, 838, 897, 368, 0, 451, 0,
+  98, 296, 457, 622, 754, 903, 876, 0, 372, 384, 0, 0, 0, 0, 101, 668,
+  119, 0, 0, 0, 0, 0, 0, 0, 435, 0, 0, 0, 0, 0, 0, 848,
+  0, 0, 0, 380, 0, 0, 0, 0, 0, 464, 565, 257, 179, 495, 863, 904,
+  175, 439, 486, 541, 445, 0, 0, 0, 401, 0, 0, 0, 596, 0, 0, 0,
+  0, 0, 278, 0, 0, 0, 0, 0, 0, 383, 811, 0, 791, 463, 0, 0,
+  0, 815, 837, 0, 421, 0, 638, 765, 0, 194, 768, 794, 0, 0, 0, 0,
+  0, 0, 254, 665, 742, 0, 0, 688, 341, 0, 0, 983, 0, 29, 0, 347,
+  787, 908, 0, 0, 0, 663, 0, 0, 0, 0, 0, 251, 0, 0, 272, 0,
+  914, 0, 0, 0, 939, 0, 0, 0, 564, 377, 0, 0, 404, 511, 820, 0,
+  447, 513, 0, 0, 0, 0, 0, 0, 0, 720, 47, 0, 807, 0, 270, 0,
+  615, 0, 630, 0, 0, 489, 558, 61, 0, 219, 924, 173, 146, 651, 950, 0,
+  843, 0, 0, 192, 222, 781, 3, 0, 0, 539, 700, 14, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 103, 752, 941, 141, 0, 0, 0, 312, 0, 363, 0,
+  433, 814, 0, 617, 751, 883, 0, 0, 204, 609, 152, 323, 976, 0, 0, 0,
+  0, 0, 0, 0, 13, 244, 0, 166, 0, 70, 0, 496, 88, 0, 0, 374,
+  0, 0, 0, 0, 397, 869, 972, 38, 199, 0, 63, 0, 491, 614, 0, 524,
+  841, 583, 0, 0, 0, 845, 0, 992, 305, 577, 76, 634, 656, 769, 0, 963,
+  0, 0, 235, 0, 0, 153, 642, 0, 0, 0, 0, 154, 0, 91, 0, 0,
+  0, 414, 0, 0, 0, 0, 0, 0, 587, 0, 0, 60, 459, 361, 488, 598,
+  878, 957, 0, 978, 826, 0, 0, 261, 0, 472, 846, 0, 0, 0, 0, 834,
+  105, 997, 0, 0, 0, 474, 0, 0, 0, 170, 0, 0, 672, 545, 984, 0,
+  0, 0, 0, 369, 650, 187, 481, 0, 0, 961, 143, 0, 0, 860, 920, 0,
+  0, 532, 633, 533, 0, 0, 422, 0, 0, 0, 0, 0, 0, 597, 0, 37,
+  0, 0, 0, 0, 0, 0, 135, 0, 796, 0, 710, 0, 300, 95, 0, 100,
+  189, 551, 678, 128, 576, 0, 0, 328, 808, 591, 0, 0, 0, 0, 370, 943,
+  0, 471, 0, 925, 0, 0, 0, 0, 0, 0, 165, 999, 250, 571, 0, 868,
+  0, 0, 0, 0, 64, 567, 131, 65, 360, 0, 171, 0, 307, 0, 0, 427,
+  0, 0, 0, 177, 0, 213, 0, 0, 810, 0, 0, 160, 847, 0, 662, 229,
+  605, 0, 0, 755, 230, 0, 0, 589, 0, 0, 0, 716, 0, 478, 0, 0,
+  19, 200, 223, 225, 574, 906, 940, 0, 715, 969, 0, 0, 0, 182, 0, 0,
+  0, 0, 600, 221, 320, 0, 385, 389, 0, 0, 138, 473, 859, 0, 0, 0,
+  0, 0, 0, 0, 39, 82, 641, 613, 0, 0, 0, 549, 900, 0, 0, 246,
+  728, 0, 267, 714, 830, 534, 0, 0, 0, 0, 691, 0, 0, 0, 452, 990,
+  0, 0, 0, 962, 259, 480, 0, 428, 0, 290, 0, 262, 183, 0, 0, 487,
+  766, 0, 0, 0, 0, 0, 0, 0, 331, 215, 227, 287, 776, 802, 756, 356,
+  6, 919, 0, 415, 316, 462, 0, 11, 302, 437, 454, 561, 655, 0, 0, 0,
+  0, 0, 476, 0, 0, 603, 0, 644, 334, 109, 303, 315, 851, 0, 405, 317,
+  0, 0, 0, 0, 733, 0, 0, 0, 918, 0, 0, 0, 0, 0, 664, 0,
+  660, 911, 588, 723, 797, 0, 0, 172, 928, 0, 0, 0, 559, 964, 0, 0,
+  162, 643, 801, 0, 0, 510, 552, 599, 658, 0, 0, 0, 829, 338, 0, 0,
+  0, 217, 325, 216, 214, 86, 543, 836, 321, 0, 0, 892, 0, 0, 512, 0,
+  0, 0, 0, 722, 882, 280, 281, 0, 0, 353, 686, 0, 0, 0, 0, 760,
+  974, 0, 610, 0, 0, 654, 0, 236, 701, 0, 505, 0, 442, 297, 0, 483,
+  265, 508, 0, 429, 0, 693, 0, 818, 412, 279, 798, 699, 0, 256, 52, 824,
+  894, 0, 537, 0, 0, 362, 0, 0, 346, 190, 441, 585, 873, 446, 666, 934,
+  0, 0, 721, 719, 737, 0, 0, 53, 330, 821, 0, 0, 0, 0, 4, 8,
+  264, 0, 0, 991, 740, 0, 707, 0, 144, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 139, 602, 850, 0, 0, 530, 758, 0, 0, 520, 0, 456, 324, 987,
+  0, 114, 0, 0, 0, 242, 546, 805, 875, 0, 0, 460, 0, 0, 0, 0,
+  23, 0, 0, 357, 682, 0, 953, 453, 0, 0, 0, 0, 0, 0, 118, 62,
+  0, 893, 0, 555, 0, 0, 423, 0, 0, 0, 828, 0, 158, 0, 220, 674,
+  273, 743, 0, 0, 150, 0, 0, 0, 0, 41, 0, 342, 0, 0, 684, 748,
+  788, 885, 0, 792, 986, 0, 371, 0, 542, 0, 970, 7, 387, 155, 419, 470,
+  640, 276, 680, 735, 255, 782, 823, 0, 772, 0, 0, 188, 449, 566, 971, 968,
+  0, 0, 0, 311, 0, 0, 0, 0, 536, 0, 0, 0, 0, 0, 80, 501,
+  586, 0, 0, 0, 0, 46, 696, 465, 775, 482, 750, 0, 531, 0, 731, 0,
+  212, 0, 0, 778, 945, 0, 0, 0, 0, 858, 0, 0, 0, 0, 416, 0,
+  0, 0, 0, 616, 0, 0, 0, 0, 202, 92, 0, 373, 711, 48, 277, 55,
+  285, 467, 880, 15, 104, 913, 952, 0, 582, 0, 0, 309, 0, 327, 0, 197,
+  544, 695, 0, 0, 0, 929, 0, 0, 0, 0, 93, 301, 729, 626, 639, 744,
+  0, 349, 698, 0, 749, 0, 0, 0, 0, 344, 306, 403, 181, 359, 825, 942,
+  0, 0, 0, 0, 112, 205, 594, 83, 444, 632, 366, 879, 0, 68, 438, 840,
+  94, 0, 0, 592, 157, 282, 0, 0, 0, 0, 0, 231, 771, 0, 554, 142,
+  0, 32, 121, 712, 0, 0, 0, 0, 0, 726, 0, 0, 1, 201, 224, 263,
+  623, 426, 0, 0, 0, 0, 0, 515, 156, 122, 526, 0, 352, 0, 410, 764,
+  625, 0, 0, 0, 0, 0, 870, 348, 288, 842, 886, 0, 0, 126, 0, 734,
+  884, 891, 0, 0, 0, 0, 0, 521, 0, 0, 0, 0, 0, 0, 0, 0,
+  180, 0, 0, 0, 0, 123, 0, 0, 746, 0, 176, 260, 739, 578, 0, 0,
+  0, 245, 535, 0, 0, 210, 148, 0, 434, 0, 0, 0, 0, 0, 0, 58,
+  97, 73, 167, 909, 228, 420, 912, 0, 274, 484, 901, 0, 0, 0, 111, 295,
+  0, 689, 239, 0, 0, 0, 0, 0, 784, 396, 785, 299, 0, 0, 35, 0,
+  0, 0, 0, 0, 0, 915, 0, 0, 85, 0, 0, 813, 0, 0, 646, 954,
+};
+
+const char *WA_FREQ_153_TOKENS[] = {
+  "kutsi",
+  "kanye",
+  "futsi",
+  "bantfu",
+  "kakhulu",
+  "kute",
+  "lapho",
+  "khona",
+  "kube",
+  "yetfu",
+  "Afrika",
+  "hulumende",
+  "luhlelo",
+  "Kodvwa",
+  "kahle",
+  "kumele",
+  "kwenta",
+  "wonkhe",
+  "yelinyenti",
+  "Loku",
+  "ncono",
+  "tetfu",
+  "bonkhe",
+  "tintfo",
+  "yakhe",
+  "kuba",
+  "wetfu",
+  "yini",
+  "kusho",
+  "ngayo",
+  "njengobe",
+  "nobe",
+  "sikhatsi",
+  "sonkhe",
+  "kwetfu",
+  "lamuhla",
+  "ngendlela",
+  "tonkhe",
+  "emhlabeni",
+  "konkhe",
+  "kwebantfu",
+  "labanyenti",
+  "letinyenti",
+  "natsi",
+  "nje",
+  "loko",
+  "ngalesikhatsi",
+  "wakhe",
+  "Kumele",
+  "eminyakeni",
+  "lomkhulu",
+  "umuntfu",
+  "yonkhe",
+  "abe",
+  "emandla",
+  "embili",
+  "endzaweni",
+  "indlela",
+  "kantsi",
+  "kodvwa",
+  "kufanele",
+  "kufundza",
+  "kulomnyaka",
+  "kuphela",
+  "kusebenta",
+  "lakho",
+  "loku",
+  "njalo",
+  "setfu",
+  "Kute",
+  "bakitsi",
+  "baseNingizimu",
+  "bese",
+  "emkhatsini",
+  "imisebenti",
+  "imphilo",
+  "indzawo",
+  "kulwa",
+  "kuze",
+  "leminyenti",
+  "letfu",
+  "live",
+  "nebugebengu",
+  "tinhlelo",
+  "tsine",
+  "yabo",
+  "yakho",
+  "Njengobe",
+  "ekhatsi",
+  "imali",
+  "imitamo",
+  "indlu",
+  "kancane",
+  "kubo",
+  "kucinisekisa",
+  "kutawuba",
+  "kwakhe",
+  "kwemnotfo",
+  "litfuba",
+  "lokukhulu",
+  "lokunyenti",
+  "na",
+  "naletinye",
+  "nekutsi",
+  "ngesikhatsi",
+  "ngete",
+  "sente",
+  "sichubeke",
+  "sikwati",
+  "simo",
+  "siphindze",
+  "wakho",
+  "Hulumende",
+  "Make",
+  "Nkulunkulu",
+  "Umtsetfosisekelo",
+  "babo",
+  "bantfwana",
+  "basemakhaya",
+  "batfole",
+  "betfu",
+  "ematfuba",
+  "emave",
+  "emazinga",
+  "emphakatsini",
+  "gezi",
+  "ingabe",
+  "inganekwane",
+  "intsandvo",
+  "kanjani",
+  "kepha",
+  "kukhona",
+  "kuphindze",
+  "kwabo",
+  "kwaloko",
+  "kwekutsi",
+  "lakitsi",
+  "lefanele",
+  "letinhle",
+  "letinye",
+  "libe",
+  "lilanga",
+  "nabo",
+  "nakangaka",
+  "nato",
+  "nenkhohlakalo",
+  "netinhlelo",
+  "ngaphandle",
+  "ngekutsi",
+  "ngobe",
+  "noma",
+  "nyalo",
+  "onkhe",
+  "sicinisekise",
+  "tahulumende",
+  "tetemnotfo",
+  "uma",
+  "umbono",
+  "wentsandvo",
+  "000",
+  "All",
+  "Bantfu",
+  "Futsi",
+  "Incwadzi",
+  "Intsandvo",
+  "Jesu",
+  "Khristu",
+  "Libhayibheli",
+  "Nanobe",
+  "Sicela",
+  "Tinanatelo",
+  "Uma",
+  "Umuntfu",
+  "Yemhlaba",
+  "babe",
+  "bafundzi",
+  "basekhaya",
+  "bhadza",
+  "bohulumende",
+  "buphuya",
+  "ekwenteni",
+  "ekwetfuleni",
+  "eliveni",
+  "emalungelo",
+  "emazingeni",
+  "emsebenti",
+  "emva",
+  "engcondvweni",
+  "esikhatsini",
+  "eveni",
+  "ezingeni",
+  "iNingizimu",
+  "iPhalamende",
+  "ibe",
+  "ikakhulukati",
+  "iminyaka",
+  "indvodza",
+  "indzima",
+  "kancono",
+  "kubantfu",
+  "kubonga",
+  "kubukana",
+  "kudla",
+  "kukusita",
+  "kulelive",
+  "kusebentisa",
+  "kusukela",
+  "kutfola",
+  "kuto",
+  "kuye",
+  "kwagezi",
+  "kwelizinga",
+  "kwemhlaba",
+  "kwemisebenti",
+  "kwentiwe",
+  "labahlala",
+  "labakhubatekile",
+  "labanye",
+  "labo",
+  "lafanele",
+  "lamabili",
+  "lebantfu",
+  "lekutsi",
+  "lelive",
+  "lendze",
+  "lenkhulu",
+  "lesibalulekile",
+  "lesihlanu",
+  "letako",
+  "letenteka",
+  "letibalulekile",
+  "letifanele",
+  "letinkinga",
+  "leyengcile",
+  "linyenti",
+  "liphindze",
+  "litsemba",
+  "lokuncono",
+  "lokutsite",
+  "lolukhulu",
+  "lonkhe",
+  "lulwimi",
+  "mayelana",
+  "nalabanye",
+  "nalamanye",
+  "ne",
+  "nekucinisa",
+  "nekusita",
+  "nekwenta",
+  "nemhlaba",
+  "ngaloluhlelo",
+  "ngaphansi",
+  "ngaso",
+  "ngawo",
+  "ngekubambisana",
+  "ngekunonopha",
+  "ngemuva",
+  "ngenca",
+  "ngoba",
+  "nguletinye",
+  "nome",
+  "reserved",
+  "sibe",
+  "sibongo",
+  "singenta",
+  "sisombululo",
+  "sitawucinisekisa",
+  "tabo",
+  "tiba",
+  "tidzingo",
+  "tindlela",
+  "tindzaba",
+  "tinyatselo",
+  "tive",
+  "ube",
+  "umhlaba",
+  "umnotfo",
+  "umshado",
+  "wa",
+  "wabo",
+  "wemhlaba",
+  "wemmango",
+  "yekutsi",
+  "yena",
+  "yetetimali",
+  "yimphumelelo",
+  "yincenye",
+  "2004",
+  "2008",
+  "Akekho",
+  "Buciko",
+  "Development",
+  "Eskom",
+  "Indvuna",
+  "Isita",
+  "Kantsi",
+  "Kepha",
+  "Kuko",
+  "Kuleminyaka",
+  "Kuletinye",
+  "Kuloku",
+  "Kunendzawo",
+  "Kwatsi",
+  "Leti",
+  "Lingasita",
+  "Lisiko",
+  "Livi",
+  "Mali",
+  "Mandela",
+  "Nga-1994",
+  "Ngalesikhatsi",
+  "Ngaloko",
+  "Ngalokunjalo",
+  "Ngekusebentisana",
+  "Ngicinisekile",
+  "Ngitsandza",
+  "Sibonga",
+  "Sitawuchubeka",
+  "Sitawucinisa",
+  "Siyachubeka",
+  "Siyati",
+  "Sonkhe",
+  "Tinhlelo",
+  "Turner",
+  "Wendzawo",
+  "Wendzebe",
+  "YaseMoretele",
+  "Yathishela",
+  "Yendzebe",
+  "afundzise",
+  "akhona",
+  "akusiko",
+  "angena",
+  "atewukhonta",
+  "babhali",
+  "bafundze",
+  "bagugile",
+  "bahlala",
+  "bahlali",
+  "bakhe",
+  "banematfuba",
+  "bangani",
+  "baseZimbabwe",
+  "batali",
+  "bayagula",
+  "bayibhala",
+  "bekati",
+  "belisetulu",
+  "belive",
+  "bemmango",
+  "betifundza",
+  "bo",
+  "bomake",
+  "buhlungu",
+  "e-Afrika",
+  "eMalunga",
+  "eNingizimu",
+  "edvute",
+  "ekhu",
+  "ekucindzeteleni",
+  "ekufezeni",
+  "ekukwati",
+  "ekulweni",
+  "ekusiseni",
+  "ekutsaneni",
+  "ekutseni",
+  "ekwandziseni",
+  "elugwini",
+  "elukhetfweni",
+  "emabhizinisi",
+  "emakhaya",
+  "emalunga",
+  "emanyuvesi",
+  "emkhankhasweni",
+  "emmangweni",
+  "emnyakeni",
+  "emphilweni",
+  "emuntfwini",
+  "endleleni",
+  "etikolweni",
+  "etimbonini",
+  "etindzaweni",
+  "etinhlelweni",
+  "etju",
+  "etulu",
+  "i-engineering",
+  "icalise",
+  "ihamba",
+  "imboni",
+  "imfundvo",
+  "imibono",
+  "imitsetfo",
+  "imphumelelo",
+  "inchubekelembili",
+  "indlovukati",
+  "indzaba",
+  "inkhululeko",
+  "kabanti",
+  "kabusha",
+  "kamhlope",
+  "kona",
+  "kubamba",
+  "kubona",
+  "kubuye",
+  "kukhula",
+  "kukhutsata",
+  "kuko",
+  "kulabasikati",
+  "kulendzawo",
+  "kuletinye",
+  "kulo",
+  "kuloko",
+  "kulombuso",
+  "kulowo",
+  "kuma",
+  "kungabata",
+  "kungenelela",
+  "kungunyalo",
+  "kunjalo",
+  "kuse-Ngobi",
+  "kusita",
+  "kusitwa",
+  "kusungula",
+  "kutawulunga",
+  "kutawumele",
+  "kutenhlalo",
+  "kutfolakala",
+  "kutinikela",
+  "kuvuselelwa",
+  "kuwo",
+  "kuyo",
+  "kwaMasipala",
+  "kwaba",
+  "kwabelanwa",
+  "kwahulumende",
+  "kwakha",
+  "kwefika",
+  "kwemandla",
+  "kwemphilo",
+  "kwemtsetfo",
+  "kwenu",
+  "kwesekela",
+  "kwetfulwa",
+  "kwetinsita",
+  "la",
+  "laHloniphekile",
+  "laMandela",
+  "laMengameli",
+  "labahlahla",
+  "labaphetse",
+  "labasha",
+  "labatsintsekako",
+  "labehlakaniphe",
+  "lalinganako",
+  "lami",
+  "lapha",
+  "lativa",
+  "leNingizimu",
+  "lebaluleke",
+  "lekutsiwa",
+  "lelikhulu",
+  "lelilanga",
+  "lembalwa",
+  "lemidlalo",
+  "lemphilo",
+  "lencono",
+  "lendlela",
+  "lenjabulo",
+  "lesifishane",
+  "letehlukahlukene",
+  "letikhungetse",
+  "letinkhulu",
+  "letintfo",
+  "letintsatfu",
+  "libhange",
+  "lifa",
+  "lihhovisi",
+  "liholo",
+  "likhulume",
+  "lincane",
+  "lingangiboleka",
+  "lisiko",
+  "lizinga",
+  "lizulu",
+  "lo",
+  "lobudlelwane",
+  "lobuhleliwe",
+  "lohlala",
+  "lokufanele",
+  "lokumele",
+  "lokwenta",
+  "lokwente",
+  "lokwentiwa",
+  "loluchaza",
+  "loluhlelo",
+  "lomake",
+  "lomunye",
+  "longete",
+  "lowadala",
+  "lowejwayelekile",
+  "lowengcile",
+  "luhlolo",
+  "lukhetfo",
+  "lusito",
+  "lwavelonkhe",
+  "lwekwenta",
+  "lwemfundvo",
+  "make",
+  "matima",
+  "mnyama",
+  "nahulumende",
+  "nakhona",
+  "nako",
+  "nalabo",
+  "nalenkinga",
+  "nalokhululekile",
+  "nalombono",
+  "nami",
+  "nangabe",
+  "nani",
+  "naseHammanskraal",
+  "nasemmangweni",
+  "nati",
+  "naye",
+  "ndzawonye",
+  "nebuphuya",
+  "nekubhala",
+  "nekucinisekisa",
+  "nekukhula",
+  "nekukhutsata",
+  "nekungalingani",
+  "nekwehla",
+  "nemave",
+  "nembala",
+  "nemiklamo",
+  "neminyaka",
+  "nesibopho",
+  "netindleko",
+  "netinsita",
+  "nga",
+  "nga-2014",
+  "ngabe",
+  "ngako",
+  "ngalokuyimphumelelo",
+  "ngekushesha",
+  "ngekuthula",
+  "ngenkhululeko",
+  "ngetimali",
+  "ngetintfo",
+  "ngigcizelele",
+  "ngingatfola",
+  "ngukuphi",
+  "ngukutsi",
+  "ngulelincono",
+  "ngulesikhatsi",
+  "ngumake",
+  "ngutiphi",
+  "nguye",
+  "njani",
+  "phansi",
+  "phela",
+  "rights",
+  "sabo",
+  "sakhamuti",
+  "sakhe",
+  "sandla",
+  "sayo",
+  "sebakhulile",
+  "sekutsi",
+  "senta",
+  "sesikhatsi",
+  "setenhlalo",
+  "setfule",
+  "setinchabhayi",
+  "siZulu",
+  "sibuka",
+  "sicelo",
+  "sifuna",
+  "sigcugcutele",
+  "sigweme",
+  "silungele",
+  "sisebenta",
+  "sitawusebentela",
+  "sitsatsa",
+  "sitsembele",
+  "sive",
+  "solomane",
+  "takhamiti",
+  "takhiwonchanti",
+  "tangembili",
+  "taseNingizimu",
+  "tasemakhaya",
+  "tebantfu",
+  "tekuhlala",
+  "tetembusave",
+  "tetintfo",
+  "tikhatsi",
+  "tikhungo",
+  "timo",
+  "timphilo",
+  "tincenye",
+  "tinchabhayi",
+  "tindlu",
+  "tindzawo",
+  "tinganekwane",
+  "tinhlaka",
+  "tinkhulumiswano",
+  "tisebenti",
+  "umdlalo",
+  "umfana",
+  "umfundzisi",
+  "umlayeto",
+  "umlilo",
+  "ummango",
+  "umphakatsi",
+  "utsandza",
+  "utsi",
+  "uvikela",
+  "vele",
+  "wababe",
+  "walenkhosi,yena",
+  "waleso",
+  "wamake",
+  "watsi",
+  "webantfu",
+  "wekwenta",
+  "welive",
+  "wenta",
+  "wona",
+  "ye-RDP",
+  "yebantfu",
+  "yekukhula",
+  "yekutsenga",
+  "yekwakha",
+  "yentsandvo",
+  "12",
+  "14",
+  "1920",
+  "1989",
+  "2010",
+  "25%",
+  "29",
+  "3.5",
+  "30",
+  "5-year",
+  "690",
+  "8",
+  "A",
+  "Abangacabangi",
+  "Agenda",
+  "Akunakungabata",
+  "Amadodana",
+  "Arms",
+  "Ase-Afrika",
+  "AseWesile",
+  "Asengiphindze",
+  "Asesichubele",
+  "Asisekele",
+  "Ayanda",
+  "Bakhatsatekile",
+  "Bakholwa",
+  "Bakujabulela",
+  "Balandzeli",
+  "Bantfwana",
+  "Baphenya",
+  "Batsi",
+  "Bebabase",
+  "Bekati",
+  "Bekubuholi",
+  "Bekumnyaka",
+  "Belumbi",
+  "Bra-Cat",
+  "Brooklyn",
+  "Budlelwane",
+  "CA",
+  "Charles",
+  "Cities",
+  "Declaration",
+  "Dickens",
+  "ECunu",
+  "EForesters",
+  "Ekugcineni",
+  "Eluhlelweni",
+  "Ema-Afrika",
+  "EmaZulu",
+  "Ematiko",
+  "Emazinga",
+  "Emhlanganweni",
+  "Emkhastini",
+  "Emkhatsini",
+  "Emnyakeni",
+  "Eningizimu",
+  "Epainette",
+  "Esigungu",
+  "Esikhundleni",
+  "Etinkhulumiswaneni",
+  "Fakazi",
+  "Fakazi baJehova",
+  "Foundation",
+  "G20",
+  "Goals",
+  "Gogo",
+  "Government",
+  "Gude",
+  "HIV",
+  "Hamba",
+  "I-Ephikhi",
+  "I-MWEB",
+  "INelson",
+  "Ibhalelwe",
+  "Ikhomishini",
+  "Imali",
+  "Imfundvo",
+  "Imibhalo",
+  "Imililo",
+  "Indlela",
+  "Industry",
+  "Indvodza",
+  "Inetikhatsi",
+  "Inhlaba",
+  "Inhloso",
+  "Inombolo",
+  "Isayensi",
+  "Itawuniketa",
+  "Jabulela",
+  "Jann",
+  "Kancane",
+  "Kepha-ke",
+  "Ketuvim",
+  "Kitsi",
+  "Kuba",
+  "Kubaluleke",
+  "Kubalulekile",
+  "Kubanjwa",
+  "Kubukwa",
+  "Kufi",
+  "Kugcila",
+  "Kugucugucuka",
+  "Kuhlupheka",
+  "Kukhutsata",
+  "Kulalela",
+  "Kulokunye",
+  "Kulomnyaka",
+  "Kungabe",
+  "Kusasa",
+  "Kushona",
+  "Kusukela",
+  "Kusungulwa",
+  "Kutakwakhela",
+  "Kute-ke",
+  "Kutinikela",
+  "Kuvela",
+  "Kuwa",
+  "Kuyacaca",
+  "Kuyajabulisa",
+  "Kuyakhanya",
+  "Kuyasijabulisa",
+  "Kuyintfokoto",
+  "Kuze",
+  "Kwadzingeka",
+  "Kwehla",
+  "Kwenta",
+  "Kwesihlanu",
+  "Kwesitsatfu",
+  "LaMengameli",
+  "Labadzala",
+  "Labahlali",
+  "Labanye",
+  "Labanyenti",
+  "LakaNgwane",
+  "Lapho",
+  "Lelicenjana",
+  "Leligama",
+  "Lelihhola",
+  "Lelihhotela",
+  "Lelikamelo",
+  "Lelingcwele",
+  "Lemibono",
+  "Lemisebenti",
+  "Lenchubo",
+  "Lengcwele",
+  "LeseNingizimu",
+  "Lesi-ke",
+  "Lesikwatiko",
+  "Lesimo",
+  "Lesitawubhekisa",
+  "Lesivumelwano",
+  "Letinyawo",
+  "Letinye",
+  "Letitimele",
+  "Leyetfulelwa",
+  "LiBhayibheli",
+  "Lidina",
+  "Limuva",
+  "Lindiwe",
+  "Linyenti",
+  "Litiko",
+  "Lobumatima",
+  "Local",
+  "Loko",
+  "Lokubaluleke",
+  "Lokudzingekako",
+  "Lokunye",
+  "Lokutawuchubeka",
+  "Lolufudvu",
+  "Loluhlelo",
+  "Loluhlobo",
+  "Lomake",
+  "Lomunye",
+  "Lowekunene",
+  "Lukholo",
+  "Luphawu",
+  "Lusuku",
+  "Lwavelonkhe",
+  "Lwekutfutfukisa",
+  "MaMofokeng",
+  "Madiba",
+  "Mayelana",
+  "Mbandzeni",
+  "Mbeki",
+  "Mengameli",
+  "Methodists",
+  "Mibhalo",
+  "Millennium",
+  "Mkhulu",
+  "Mnu",
+  "Motor",
+  "Nangekujabula",
+  "Nanoma",
+  "National",
+  "Nations",
+  "Nawufuna",
+  "Nekucecesha",
+  "Nekukhuluma",
+  "Nelihhovisi",
+  "Nembala",
+  "Nemsebenti",
+  "New",
+  "Nga-2009",
+  "Nga-2010",
+  "Ngako",
+  "Ngako-ke",
+  "Ngale",
+  "Ngalesento",
+  "Ngalokucacile",
+  "Ngebunyenti",
+  "Ngekubuka",
+  "Ngekuhambisana",
+  "Ngekusebentisa",
+  "Ngekusho",
+  "NgekweMtsetfosisekelo",
+  "Ngeliso",
+  "Ngeminyaka",
+  "Ngemuva",
+  "Ngenhlanhla",
+  "Ngenhlanhla-ke",
+  "Ngete",
+  "Ngetulu",
+  "Ngibala",
+  "Ngikhetse",
+  "Ngikhuluma",
+  "Ngilondvolote",
+  "Nginelitsemba",
+  "Ngiso",
+  "Ngitawuhlangana",
+  "Ngitfole",
+  "Ngitsatsa",
+  "Ngiyajabula",
+  "Ngiyambonga",
+  "Ngobe",
+  "Nguleto",
+  "Nguloku",
+  "Ngumhlaba",
+  "Nguye",
+  "Nitawukhumbula",
+  "Njengembuso",
+  "Njengencenye",
+  "Nkhosikati",
+  "Noma",
+  "Nyalo",
+  "Onkgopotse",
+  "Programme",
+  "Rick",
+  "Round",
+  "Sawobona",
+  "Sekukhishwe",
+  "Sendlale",
+  "Sendlulisa",
+  "Service",
+  "Sibeka",
+  "Sibungata",
+  "Sibuye",
+  "Sifisa",
+  "Sifuna",
+  "Sigcugcutelwa",
+  "Sigungu",
+  "Sihlaba",
+  "Sihlalo",
+  "Sihlangana",
+  "Sihlonishwe",
+  "Sikhulumi",
+  "Sikhutsatekile",
+  "Simema",
+  "Sinentfokoto",
+  "Singajabula",
+  "Singakhala",
+  "Singakwenta",
+  "Singasho",
+  "Singisi",
+  "Singuhulumende",
+  "Sisabuka",
+  "Sisasho",
+  "Sisebenta",
+  "Sisebentela",
+  "Sisebentisana",
+  "Sisungule",
+  "Sitawenyusa",
+  "Sitawetfula",
+  "Sitawubukana",
+  "Sitawucalisa",
+  "Sitawucinisekisa",
+  "Sitawulindzela",
+  "Sitawunonophisa",
+  "Sitawusita",
+  "Sitsatsa",
+  "Sitsintfwe",
+  "Sive",
+  "Siyabonga",
+  "Siyamenywa",
+  "Siyanicenga",
+  "Siyatfokota",
+  "Siyatitfoba",
+  "Strategic",
+  "Tahulumende",
+  "Takhamiti",
+  "Tale",
+  "Tasebentisa",
+  "Tata",
+  "Telkom",
+  "Thishela",
+  "Tiboshwa",
+  "Tihlobo",
+  "Tiro",
+  "Titfokotise",
+  "Tiyasebenta",
+  "Tlhagwana",
+  "Tomas",
+  "Transkei",
+  "Two",
+  "Ubhale",
+  "Ucale",
+  "Ucuketse",
+  "Ukhetsile",
+  "Ume",
+  "Umhlanga",
+  "Umndeni",
+  "Umphumela",
+  "Umsebenti",
+  "Umtamo",
+  "Ungabuta",
+  "Ungalilahli",
+  "Ungenta",
+  "United",
+  "Uphakamise",
+  "Uphindze",
+  "Utsandza",
+  "Utsi",
+  "Utsite",
+  "Uyati",
+  "Video",
+  "Vuswa",
+  "Wakhula",
+  "Wancuma",
+  "Watchtower",
+  "Watikhandza",
+  "Watsi",
+  "Wemajaha",
+  "Weva",
+  "Ye-FIFA",
+  "Yekutsintana",
+  "Yelibhola",
+  "Yelubumbano",
+  "Yemave",
+  "Yemfundzi",
+  "Yinhlanganisela",
+  "York",
+  "Youth",
+  "Zimbabwe",
+  "a",
+  "ababambisane",
+  "ababuyisele",
+  "abacocele",
+  "abakulungeli",
+  "abasibodvwa",
+  "abate",
+  "abefuna",
+  "abekuNkulunkulu",
+  "abelibele",
+  "abenguNkulunkulu",
+  "abeyintfombatana",
+};
+const uint16_t WA_FREQ_153_RANKS[] = {
+  0, 756, 788, 266, 407, 782, 446, 823, 970, 0, 0, 737, 0, 0, 0, 0,
+  0, 0, 0, 687, 0, 0, 191, 0, 510, 997, 0, 171, 0, 0, 6, 0,
+  915, 40, 983, 129, 0, 0, 747, 0, 0, 447, 0, 802, 0, 113, 825, 532,
+  147, 904, 971, 0, 0, 0, 775, 140, 186, 701, 809, 0, 75, 676, 0, 0,
+  0, 472, 0, 138, 719, 0, 0, 0, 0, 0, 0, 0, 0, 371, 0, 0,
+  0, 0, 109, 776, 498, 0, 0, 0, 0, 0, 601, 0, 905, 566, 0, 0,
+  262, 0, 0, 0, 400, 0, 0, 0, 0, 0, 0, 464, 0, 0, 0, 0,
+  0, 215, 373, 0, 803, 0, 0, 0, 0, 425, 0, 49, 967, 0, 10, 0,
+  753, 844, 0, 534, 478, 0, 145, 777, 743, 723, 453, 0, 0, 68, 654, 736,
+  770, 368, 30, 20, 864, 919, 0, 0, 0, 65, 19, 0, 0, 0, 933, 999,
+  766, 0, 751, 0, 988, 0, 672, 244, 627, 0, 293, 0, 0, 0, 492, 0,
+  838, 0, 578, 798, 0, 991, 0, 271, 0, 0, 638, 471, 558, 0, 0, 640,
+  0, 764, 0, 141, 159, 116, 519, 957, 0, 0, 206, 0, 790, 0, 0, 347,
+  0, 0, 174, 0, 832, 328, 277, 796, 0, 0, 0, 0, 0, 60, 0, 512,
+  955, 624, 0, 0, 0, 0, 0, 0, 591, 827, 0, 993, 888, 880, 0, 0,
+  0, 0, 0, 0, 535, 515, 927, 924, 0, 0, 0, 0, 0, 805, 0, 0,
+  0, 166, 732, 0, 0, 0, 149, 0, 0, 124, 643, 0, 410, 8, 509, 50,
+  301, 972, 0, 0, 0, 168, 0, 0, 0, 0, 0, 0, 377, 0, 0, 0,
+  0, 0, 0, 275, 496, 0, 0, 605, 563, 814, 0, 0, 0, 0, 0, 0,
+  89, 661, 0, 0, 0, 0, 53, 364, 912, 327, 162, 0, 279, 0, 932, 953,
+  170, 0, 893, 0, 0, 0, 0, 0, 21, 0, 79, 0, 0, 0, 629, 0,
+  628, 0, 0, 0, 674, 0, 0, 833, 0, 0, 0, 0, 901, 0, 0, 283,
+  0, 0, 482, 734, 879, 0, 0, 345, 132, 0, 696, 110, 537, 0, 0, 0,
+  0, 0, 0, 46, 550, 925, 819, 0, 0, 0, 0, 0, 0, 0, 189, 735,
+  0, 0, 0, 0, 0, 0, 615, 0, 874, 0, 733, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 315, 936, 0, 0, 272, 31,
+  435, 800, 154, 728, 0, 448, 245, 54, 947, 0, 0, 0, 0, 977, 0, 0,
+  427, 0, 0, 989, 100, 131, 289, 856, 428, 587, 468, 894, 352, 0, 0, 5,
+  0, 440, 489, 363, 0, 108, 341, 681, 851, 0, 169, 462, 994, 475, 528, 0,
+  263, 0, 0, 299, 0, 233, 0, 0, 0, 626, 830, 0, 0, 0, 0, 253,
+  974, 0, 0, 63, 575, 824, 559, 0, 0, 408, 695, 0, 678, 600, 713, 0,
+  0, 9, 0, 1, 0, 0, 0, 449, 4, 781, 398, 540, 754, 618, 834, 0,
+  0, 0, 0, 0, 226, 103, 241, 117, 175, 597, 66, 560, 861, 985, 221, 17,
+  0, 366, 0, 815, 0, 500, 0, 0, 0, 0, 0, 0, 405, 381, 321, 290,
+  873, 28, 0, 0, 577, 0, 0, 0, 0, 0, 64, 264, 0, 0, 0, 0,
+  0, 0, 0, 322, 0, 0, 470, 0, 480, 0, 0, 0, 0, 0, 0, 518,
+  0, 973, 0, 0, 0, 59, 12, 877, 0, 652, 0, 423, 0, 0, 669, 0,
+  0, 0, 0, 926, 0, 0, 817, 804, 891, 0, 0, 455, 0, 0, 631, 185,
+  992, 0, 0, 451, 45, 763, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 48, 0, 0, 0, 649, 82, 356, 899, 0, 0, 0, 0, 0, 209, 151,
+  251, 306, 438, 530, 741, 0, 0, 0, 0, 477, 0, 0, 0, 866, 820, 250,
+  340, 951, 0, 0, 0, 15, 731, 860, 192, 0, 0, 80, 0, 390, 0, 0,
+  0, 0, 0, 0, 102, 238, 852, 0, 0, 0, 153, 549, 0, 242, 257, 646,
+  0, 179, 0, 421, 586, 758, 0, 0, 0, 0, 0, 378, 0, 0, 0, 529,
+  981, 651, 862, 539, 0, 0, 0, 0, 0, 91, 0, 0, 0, 396, 0, 818,
+  986, 0, 0, 0, 0, 557, 0, 402, 160, 668, 0, 0, 0, 712, 984, 0,
+  0, 0, 641, 671, 0, 0, 437, 0, 0, 459, 0, 0, 0, 273, 274, 768,
+  72, 0, 0, 32, 406, 849, 729, 711, 0, 0, 590, 682, 0, 0, 0, 0,
+  0, 190, 403, 689, 795, 0, 172, 720, 0, 811, 0, 0, 0, 937, 385, 589,
+  0, 0, 0, 300, 316, 0, 0, 0, 0, 0, 0, 0, 374, 29, 703, 58,
+  69, 488, 0, 0, 0, 0, 0, 655, 204, 614, 656, 466, 297, 616, 114, 267,
+  0, 485, 0, 702, 0, 0, 744, 0, 173, 302, 730, 644, 716, 807, 727, 0,
+  0, 0, 579, 265, 0, 0, 0, 442, 0, 0, 0, 0, 517, 358, 308, 749,
+  0, 673, 0, 704, 0, 326, 0, 610, 0, 688, 750, 0, 0, 444, 0, 155,
+  458, 0, 0, 0, 391, 0, 0, 97, 664, 767, 921, 0, 0, 965, 0, 355,
+  650, 940, 0, 78, 372, 883, 0, 0, 205, 875, 23, 0, 0, 0, 0, 0,
+  599, 0, 0, 0, 184, 287, 705, 0, 531, 487, 845, 0, 0, 0, 0, 0,
+  0, 980, 568, 789, 207, 55, 411, 625, 441, 892, 211, 995, 740, 285, 0, 0,
+  0, 0, 0, 0, 913, 0, 87, 0, 0, 1000, 0, 886, 551, 0, 0, 0,
+  0, 573, 773, 779, 0, 0, 0, 0, 0, 0, 0, 722, 0, 0, 706, 665,
+  0, 0, 0, 0, 0, 0, 0, 0, 86, 0, 0, 0, 134, 598, 25, 667,
+  490, 295, 538, 841, 523, 958, 636, 760, 0, 778, 0, 0, 0, 725, 0, 890,
+  0, 194, 81, 677, 71, 320, 511, 11, 436, 769, 855, 882, 416, 976, 572, 249,
+  945, 996, 0, 0, 0, 858, 0, 0, 0, 0, 0, 0, 738, 683, 0, 0,
+  0, 164, 227, 710, 133, 0, 0, 670, 239, 698, 865, 846, 914, 203, 907, 0,
+  0, 0, 0, 545, 212, 294, 296, 657, 847, 0, 0, 829, 77, 0, 0, 0,
+  0, 93, 0, 0, 504, 0, 0, 548, 254, 592, 0, 0, 0, 0, 0, 0,
+  0, 0, 787, 473, 339, 0, 246, 0, 0, 248, 0, 0, 0, 0, 0, 0,
+  494, 508, 83, 542, 869, 0, 920, 231, 98, 0, 346, 507, 0, 0, 193, 208,
+  0, 0, 505, 0, 0, 0, 801, 943, 224, 393, 0, 0, 553, 0, 0, 0,
+  255, 660, 218, 675, 620, 0, 0, 968, 785, 417, 0, 679, 0, 0, 0, 486,
+  187, 808, 585, 0, 144, 85, 338, 857, 708, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 143, 0, 662, 0, 454, 0, 0, 0, 305, 653, 917, 0, 0,
+  0, 0, 642, 0, 822, 214, 323, 910, 911, 365, 543, 397, 780, 859, 0, 964,
+  513, 0, 235, 887, 521, 469, 792, 479, 810, 39, 67, 404, 813, 755, 898, 107,
+  121, 412, 948, 0, 0, 929, 0, 0, 33, 0, 309, 362, 949, 0, 0, 334,
+  216, 260, 0, 0, 0, 564, 595, 718, 0, 2, 959, 593, 567, 456, 148, 0,
+  0, 99, 336, 270, 765, 848, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 41, 896, 0, 0, 0, 0, 0, 329, 0, 0, 0, 0, 0, 467, 555,
+  617, 837, 243, 499, 582, 881, 690, 0, 188, 0, 0, 0, 0, 0, 0, 612,
+  318, 0, 645, 0, 0, 0, 0, 0, 0, 0, 240, 298, 0, 135, 0, 0,
+  258, 0, 84, 392, 684, 552, 74, 0, 0, 0, 429, 714, 413, 878, 0, 941,
+  176, 380, 312, 0, 0, 806, 0, 157, 210, 884, 0, 0, 0, 0, 0, 842,
+  7, 0, 0, 217, 0, 0, 433, 0, 399, 793, 0, 0, 0, 0, 223, 161,
+  94, 0, 0, 0, 0, 0, 0, 0, 0, 202, 337, 146, 812, 987, 686, 0,
+  0, 0, 0, 0, 0, 0, 139, 0, 0, 0, 382, 544, 581, 619, 868, 903,
+  0, 0, 0, 0, 0, 0, 0, 0, 268, 520, 659, 828, 0, 18, 419, 0,
+  0, 0, 0, 0, 0, 47, 369, 57, 0, 0, 0, 125, 183, 607, 939, 0,
+  0, 0, 0, 0, 569, 0, 0, 461, 0, 379, 386, 0, 348, 0, 0, 0,
+  37, 493, 0, 0, 484, 0, 0, 126, 0, 0, 0, 0, 0, 0, 136, 693,
+  0, 122, 633, 376, 0, 0, 42, 61, 88, 101, 111, 745, 0, 0, 0, 0,
+  0, 0, 0, 481, 261, 647, 0, 0, 533, 195, 574, 0, 0, 384, 276, 784,
+  944, 604, 0, 623, 0, 112, 0, 0, 0, 0, 73, 76, 502, 0, 387, 22,
+  0, 342, 0, 0, 0, 0, 772, 44, 0, 0, 0, 0, 0, 0, 0, 990,
+  501, 0, 0, 0, 0, 0, 0, 774, 0, 613, 0, 280, 0, 360, 547, 0,
+  120, 52, 115, 317, 0, 0, 843, 0, 0, 570, 0, 0, 561, 0, 928, 0,
+  0, 0, 0, 370, 0, 0, 0, 0, 51, 0, 0, 278, 602, 0, 0, 836,
+  897, 0, 14, 0, 946, 434, 0, 313, 0, 634, 304, 0, 0, 922, 0, 975,
+  799, 963, 982, 0, 0, 0, 0, 0, 27, 483, 908, 70, 92, 0, 0, 0,
+  330, 199, 152, 938, 0, 119, 663, 692, 90, 697, 876, 163, 0, 632, 0, 127,
+  541, 0, 105, 0, 247, 333, 0, 918, 0, 0, 0, 167, 491, 350, 895, 332,
+  0, 562, 0, 13, 62, 0, 783, 935, 142, 431, 0, 439, 0, 522, 707, 35,
+  821, 325, 420, 870, 942, 349, 0, 700, 426, 443, 389, 546, 0, 0, 96, 0,
+  0, 0, 0, 457, 286, 637, 450, 635, 596, 909, 0, 0, 0, 503, 934, 252,
+  0, 0, 0, 156, 0, 930, 0, 0, 0, 0, 506, 0, 36, 956, 889, 0,
+  0, 0, 0, 916, 474, 648, 0, 835, 106, 0, 0, 0, 0, 0, 0, 0,
+  344, 709, 527, 603, 430, 762, 979, 0, 571, 0, 0, 292, 0, 0, 220, 0,
+  902, 418, 0, 0, 0, 0, 0, 0, 414, 0, 0, 165, 0, 0, 0, 0,
+  0, 0, 95, 0, 0, 0, 236, 495, 0, 232, 759, 182, 452, 343, 606, 361,
+  742, 0, 0, 0, 0, 0, 335, 0, 197, 291, 0, 0, 0, 38, 158, 680,
+  969, 0, 0, 715, 0, 225, 281, 526, 739, 0, 0, 150, 0, 721, 0, 0,
+  282, 24, 230, 0, 630, 872, 717, 0, 0, 0, 966, 0, 0, 0, 0, 0,
+  0, 16, 962, 0, 0, 0, 0, 118, 863, 0, 34, 0, 748, 0, 906, 840,
+  0, 694, 691, 0, 584, 0, 0, 746, 0, 310, 0, 0, 0, 0, 826, 0,
+  43, 0, 200, 0, 0, 0, 137, 259, 314, 284, 771, 0, 0, 319, 409, 229,
+  622, 375, 0, 422, 0, 237, 353, 816, 234, 0, 367, 0, 536, 180, 104, 3,
+  0, 724, 666, 0, 0, 181, 923, 222, 0, 0, 791, 0, 525, 658, 0, 0,
+  685, 383, 0, 0, 639, 359, 424, 960, 415, 354, 0, 0, 0, 0, 0, 0,
+  786, 0, 0, 0, 0, 0, 0, 0, 394, 580, 388, 198, 269, 0, 556, 900,
+  465, 950, 0, 0, 0, 331, 853, 0, 0, 0, 201, 445, 794, 0, 0, 0,
+  0, 0, 0, 0, 0, 177, 0, 0, 324, 288, 565, 850, 178, 952, 0, 0,
+  0, 0, 0, 0, 0, 867, 497, 0, 0, 0, 0, 256, 0, 56, 611, 26,
+  0, 303, 0, 476, 583, 0, 0, 609, 0, 752, 196, 0, 0, 0, 0, 0,
+  931, 0, 0, 401, 0, 0, 0, 0, 395, 726, 0, 0, 0, 128, 0, 588,
+  219, 757, 311, 761, 0, 554, 0, 998, 0, 961, 0, 954, 576, 524, 460, 885,
+  594, 978, 0, 0, 0, 0, 351, 0, 213, 0, 123, 307, 357, 831, 797, 0,
+  0, 0, 608, 463, 0, 871, 0, 0, 0, 0, 130, 0, 621, 0, 432, 699,
+  0, 854, 0, 0, 514, 516, 0, 0, 839, 0, 0, 0, 228, 0, 0, 0,
+};
+
+const char *WA_FREQ_154_TOKENS[] = {
+  "ho",
+  "le",
+  "e",
+  "ya",
+  "ka",
+  "ba",
+  "a",
+  "o",
+  "tse",
+  "ke",
+  "tsa",
+  "wa",
+  "ha",
+  "di",
+  "sa",
+  "se",
+  "la",
+  "hore",
+  "re",
+  "mme",
+  "tla",
+  "kapa",
+  "bo",
+  "ne",
+  "Ho",
+  "na",
+  "bona",
+  "pele",
+  "ile",
+  "ena",
+  "eo",
+  "hae",
+  "etsa",
+  "yona",
+  "batho",
+  "nako",
+  "rona",
+  "Ka",
+  "Borwa",
+  "Ha",
+  "Afrika",
+  "bakeng",
+  "Ke",
+  "moo",
+  "jwalo",
+  "hao",
+  "empa",
+  "lokela",
+  "haholo",
+  "leng",
+  "teng",
+  "E",
+  "Modimo",
+  "O",
+  "Afrika Borwa",
+  "nngwe",
+  "mong",
+  "neng",
+  "ding",
+  "nang",
+  "feela",
+  "tsona",
+  "be",
+  "matla",
+  "lona",
+  "naha",
+  "yena",
+  "mo",
+  "motho",
+  "kgolo",
+  "ona",
+  "Re",
+  "bang",
+  "molao",
+  "fumana",
+  "ntle",
+  "tsohle",
+  "metsi",
+  "ntse",
+  "nna",
+  "bophelo",
+  "sena",
+  "tsena",
+  "seng",
+  "Mandela",
+  "tseo",
+  "hape",
+  "bana",
+  "lekgetho",
+  "tswa",
+  "Jesu",
+  "Morena",
+  "hobane",
+  "setjhaba",
+  "bohle",
+  "mora",
+  "feta",
+  "tsela",
+  "nka",
+  "selemo",
+  "tloha",
+  "mabapi",
+  "letsatsi",
+  "seo",
+  "bohlokwa",
+  "baka",
+  "ngata",
+  "Le",
+  "Di",
+  "hara",
+  "tlameha",
+  "karolo",
+  "dijo",
+  "dinonyana",
+  "hodimo",
+  "ea",
+  "mmoho",
+  "mosebetsi",
+  "sebetsa",
+  "hona",
+  "fana",
+  "maemo",
+  "nakong",
+  "mokgwa",
+  "sebaka",
+  "batla",
+  "dilemo",
+  "hantle",
+  "nale",
+  "Empa",
+  "mmuso",
+  "jwale",
+  "dula",
+  "Molao",
+  "mofuta",
+  "mang",
+  "ileng",
+  "hola",
+  "jwang",
+  "tseba",
+  "SARS",
+  "kopo",
+  "fihla",
+  "hlahisa",
+  "morao",
+  "leo",
+  "mesebetsi",
+  "mona",
+  "thusa",
+  "qala",
+  "Ba",
+  "hloka",
+  "rata",
+  "sebediswa",
+  "fihlela",
+  "efe",
+  "Aforika",
+  "etswa",
+  "lefatshe",
+  "nyane",
+  "tumelo",
+  "mmele",
+  "sebedisa",
+  "boleng",
+  "ebile",
+  "tlasa",
+  "lena",
+  "bobedi",
+  "boholo",
+  "kang",
+  "mefuta",
+  "tjhelete",
+  "fapaneng",
+  "Kreste",
+  "Sena",
+  "phela",
+  "bile",
+  "isa",
+  "lesedi",
+  "sona",
+  "ele",
+  "ja",
+  "kgwebo",
+  "lebaka",
+  "wena",
+  "A",
+  "veine",
+  "dibakeng",
+  "hoo",
+  "latela",
+  "moruo",
+  "bolela",
+  "fatshe",
+  "matsatsi",
+  "diphoofolo",
+  "jwaloka",
+  "oo",
+  "fumaneha",
+  "itseng",
+  "lefatsheng",
+  "mmala",
+  "tlhahiso",
+  "tswang",
+  "naheng",
+  "thepa",
+  "Jwale",
+  "boela",
+  "ditho",
+  "nnete",
+  "tsamaya",
+  "haufi",
+  "lefa",
+  "HIV",
+  "dintho",
+  "ra",
+  "tsamaiso",
+  "tshehadi",
+  "Sesotho",
+  "hodima",
+  "tlang",
+  "tlase",
+  "Molaotheo",
+  "Naha",
+  "ditjhelete",
+  "Haeba",
+  "kenya",
+  "yohle",
+  "bontsha",
+  "bua",
+  "eba",
+  "hangata",
+  "Lekgetho",
+  "hlaha",
+  "lekgotla",
+  "molemo",
+  "tle",
+  "kgona",
+  "dumela",
+  "fetang",
+  "hoba",
+  "tswela",
+  "u",
+  "kaofela",
+  "moya",
+  "taba",
+  "tokelo",
+  "dintlha",
+  "haeba",
+  "kereke",
+  "eng",
+  "etsang",
+  "latelang",
+  "mahe",
+  "motlakase",
+  "sebakeng",
+  "boloka",
+  "kgwedi",
+  "lefu",
+  "ntho",
+  "tshebetso",
+  "Eskom",
+  "Lekgotla",
+  "boima",
+  "dilemong",
+  "lebitso",
+  "lokelang",
+  "telele",
+  "Ntate",
+  "ebang",
+  "mathata",
+  "ofe",
+  "pakeng",
+  "puo",
+  "Na",
+  "kopa",
+  "netefatsa",
+  "sefate",
+  "tefo",
+  "Ebang",
+  "leha",
+  "Basotho",
+  "fetileng",
+  "thata",
+  "thibela",
+  "tona",
+  "fumanwa",
+  "hare",
+  "fela",
+  "hole",
+  "bao",
+  "basebetsi",
+  "bokgoni",
+  "thuto",
+  "Tse",
+  "motjha",
+  "motheo",
+  "1",
+  "bohloko",
+  "etsahala",
+  "kakaretso",
+  "kena",
+  "meutlanyana",
+  "phelang",
+  "fetisisa",
+  "kantle",
+  "maikutlo",
+  "oa",
+  "tshireletso",
+  "bonahala",
+  "dibaka",
+  "batsho",
+  "pedi",
+  "sehlopha",
+  "bonolo",
+  "kajeno",
+  "mafu",
+  "selemong",
+  "Nelson",
+  "amohela",
+  "ditaba",
+  "hlokomela",
+  "maoto",
+  "monna",
+  "utlwa",
+  "Mofuta",
+  "bangata",
+  "hlalosa",
+  "letho",
+  "meng",
+  "moholo",
+  "ntlo",
+  "provense",
+  "taolo",
+  "Kapa",
+  "Mme",
+  "bonnete",
+  "dife",
+  "dikgoho",
+  "entse",
+  "Motho",
+  "bongata",
+  "bosiu",
+  "mmutlanyana",
+  "tlowa",
+  "tshebetsong",
+  "Hona",
+  "Mmuso",
+  "Robben",
+  "bitswa",
+  "ditshebeletso",
+  "fa",
+  "kopana",
+  "tsebe",
+  "veini",
+  "etse",
+  "fumane",
+  "lehodimo",
+  "leka",
+  "letlalo",
+  "phahameng",
+  "tokoloho",
+  "tshwanang",
+  "tswala",
+  "amehang",
+  "atisa",
+  "boemo",
+  "leshome",
+  "mosadi",
+  "Batho",
+  "Mora",
+  "hang",
+  "kae",
+  "kgotso",
+  "nepahetseng",
+  "VAT",
+  "ana",
+  "ao",
+  "beha",
+  "ditokelo",
+  "entsweng",
+  "malapa",
+  "melao",
+  "sootho",
+  "habo",
+  "mobu",
+  "qetellong",
+  "tharo",
+  "tshepo",
+  "Island",
+  "Moya",
+  "ditholwana",
+  "eFiling",
+  "mahlo",
+  "nama",
+  "palo",
+  "tshwarwa",
+  "Molimo",
+  "bothata",
+  "botle",
+  "difate",
+  "kgetha",
+  "madi",
+  "masiba",
+  "ngwana",
+  "setho",
+  "thuso",
+  "tlhaho",
+  "Ya",
+  "bolelele",
+  "dinako",
+  "mekgwa",
+  "metsing",
+  "sebe",
+  "tshwanetse",
+  "tumellano",
+  "disebediswa",
+  "hammoho",
+  "mabedi",
+  "tsebahala",
+  "Dinonyana",
+  "Hape",
+  "araba",
+  "ebe",
+  "mengata",
+  "molaetsa",
+  "nne",
+  "nonyana",
+  "ntjha",
+  "qeto",
+  "Johanne",
+  "Seboka",
+  "kgubedu",
+  "kgutlela",
+  "lerato",
+  "mehla",
+  "monate",
+  "phuputso",
+  "sireletsa",
+  "tshwaetso",
+  "ANC",
+  "Nalane",
+  "bonyane",
+  "dikokonyana",
+  "mokgatlo",
+  "nahana",
+  "2",
+  "aha",
+  "botjha",
+  "kamehla",
+  "leboha",
+  "letsoho",
+  "ntlafatsa",
+  "thabo",
+  "tlwaelehileng",
+  "Cape",
+  "Fezekile",
+  "Iseraele",
+  "Kabinete",
+  "boemong",
+  "boikarabelo",
+  "borwa",
+  "dipakeng",
+  "hlahlobo",
+  "hlokahala",
+  "kgale",
+  "lehlakoreng",
+  "lekala",
+  "molato",
+  "monyetla",
+  "morabe",
+  "tshebediso",
+  "Rephaboliki",
+  "baholo",
+  "batjha",
+  "bolella",
+  "fuwa",
+  "keke",
+  "kgatello",
+  "kotsi",
+  "mahareng",
+  "makala",
+  "mantswe",
+  "ntseng",
+  "tatso",
+  "tshwara",
+  "wona",
+  "Ena",
+  "Moo",
+  "bone",
+  "hlano",
+  "hlooho",
+  "kenngwa",
+  "lentswe",
+  "mmuelli",
+  "mohau",
+  "morara",
+  "of",
+  "pelo",
+  "tshwana",
+  "tshweu",
+  "Halalelang",
+  "Lefapha",
+  "Leha",
+  "Magubane",
+  "Mokgatlo",
+  "Mopresidente",
+  "Peter",
+  "Pinot",
+  "basadi",
+  "bong",
+  "boo",
+  "dikgwedi",
+  "dipehelo",
+  "eketsa",
+  "kenyeletsa",
+  "lapeng",
+  "lekaneng",
+  "makgulo",
+  "mamela",
+  "metso",
+  "African",
+  "Selallo",
+  "and",
+  "bitswang",
+  "dibuka",
+  "ditokomane",
+  "esita",
+  "fokotsa",
+  "hlokang",
+  "kamoo",
+  "kgethollo",
+  "lelapa",
+  "leloko",
+  "qetela",
+  "shwa",
+  "theko",
+  "Boholo",
+  "Ie",
+  "Khomishene",
+  "bala",
+  "dihlopha",
+  "dimela",
+  "hlola",
+  "metse",
+  "mongobo",
+  "mosebetsing",
+  "ntshetsa",
+  "peo",
+  "phahlo",
+  "sebeletsa",
+  "tsebo",
+  "tshehetsa",
+  "Merara",
+  "National",
+  "amanang",
+  "batshwaruwa",
+  "hloko",
+  "hopola",
+  "kgahlanong",
+  "laola",
+  "lefe",
+  "mangata",
+  "matlo",
+  "mmalwa",
+  "motse",
+  "seabo",
+  "sebetsana",
+  "tshehetso",
+  "tswalo",
+  "2016",
+  "Hangata",
+  "Setjhaba",
+  "Tlhahiso",
+  "boetse",
+  "botho",
+  "dikgwebo",
+  "lekeno",
+  "sehlaha",
+  "sheba",
+  "thekiso",
+  "thoko",
+  "tsebahalang",
+  "tsebisa",
+  "000",
+  "behela",
+  "eka",
+  "kapele",
+  "karolong",
+  "kgone",
+  "matlafatsa",
+  "mehleng",
+  "mpe",
+  "ntshetsopele",
+  "ntwa",
+  "pela",
+  "phoofolo",
+  "qadile",
+  "qeta",
+  "sebediswang",
+  "sebetsang",
+  "sebopeho",
+  "Bohlokwa",
+  "Karolo",
+  "butswa",
+  "dikgetho",
+  "eleng",
+  "feleng",
+  "fetola",
+  "ikemetseng",
+  "kaba",
+  "kgahlano",
+  "kgetho",
+  "kgethwa",
+  "leboya",
+  "leeto",
+  "masole",
+  "mohla",
+  "noir",
+  "ruta",
+  "tsejwa",
+  "tshebeletso",
+  "Bana",
+  "Dr",
+  "Vaal",
+  "baahi",
+  "dikarolo",
+  "ditlhoko",
+  "fapana",
+  "fetoha",
+  "fihlella",
+  "hodisa",
+  "ithuta",
+  "kganya",
+  "kopano",
+  "maemong",
+  "merero",
+  "ngola",
+  "ohle",
+  "palesa",
+  "reng",
+  "sehla",
+  "tholwana",
+  "tlhahisoleseding",
+  "tlisa",
+  "Hlakola",
+  "batlang",
+  "batswadi",
+  "boitshwaro",
+  "bophara",
+  "eso",
+  "itshetlehile",
+  "jwalokaha",
+  "mabaka",
+  "mela",
+  "meroho",
+  "mofu",
+  "mohlala",
+  "mokitlane",
+  "nakwana",
+  "tshwanela",
+  "tsoma",
+  "Bajuda",
+  "Jesu Kreste",
+  "Keletso",
+  "South",
+  "Tsamaiso",
+  "fedisa",
+  "fofa",
+  "fokolang",
+  "hau",
+  "ikamahanya",
+  "kenyelletsa",
+  "ketsamolao",
+  "kgonang",
+  "lekgotleng",
+  "lokisa",
+  "mashome",
+  "mokete",
+  "molefalekgetho",
+  "sebetse",
+  "sekoloto",
+  "tlatsa",
+  "Johannesburg",
+  "baetapele",
+  "dihlahiswa",
+  "dulang",
+  "fepa",
+  "hase",
+  "hlahloba",
+  "ikatisa",
+  "ikgethang",
+  "kaha",
+  "lefifi",
+  "leshwa",
+  "lewatle",
+  "lokelwa",
+  "mane",
+  "mohlodi",
+  "morero",
+  "nehelana",
+  "seholo",
+  "30",
+  "Bili",
+  "Bophirima",
+  "Ebe",
+  "Metsi",
+  "Nako",
+  "bitsa",
+  "bopaki",
+  "bophelong",
+  "dinaha",
+  "diphetoho",
+  "dithuto",
+  "dule",
+  "entseng",
+  "hoja",
+  "kamora",
+  "kene",
+  "kganyang",
+  "mekgatlo",
+  "motle",
+  "motsho",
+  "moyeng",
+  "pale",
+  "potlako",
+  "pusetso",
+  "tlo",
+  "tlung",
+  "toka",
+  "10",
+  "ETI",
+  "Lekeno",
+  "bokaalo",
+  "bolaya",
+  "boraro",
+  "etela",
+  "haholoholo",
+  "hlahiswa",
+  "hloho",
+  "maholo",
+  "matsatsing",
+  "mehato",
+  "moetlo",
+  "monwana",
+  "sebele",
+  "tebileng",
+  "tjhankaneng",
+  "tletseng",
+  "tlwaelo",
+  "Hang",
+  "Keresemese",
+  "Lebitso",
+  "Nakong",
+  "Stellenbosch",
+  "VDP",
+  "bankakarolo",
+  "beng",
+  "bileng",
+  "bohareng",
+  "bolokwa",
+  "bontshang",
+  "buisana",
+  "dibe",
+  "ema",
+  "entswe",
+  "hloleha",
+  "hlwekisa",
+  "medimo",
+  "menyetla",
+  "mmedi",
+  "nkuwa",
+  "ntate",
+  "nyenyane",
+  "pula",
+  "qetella",
+  "semela",
+  "sephetho",
+  "temo",
+  "tsheletseng",
+  "3",
+  "Makgasi",
+  "Pele",
+  "bareki",
+  "bolelang",
+  "dipalesa",
+  "ditsela",
+  "eneji",
+  "etsahalang",
+  "fumanehang",
+  "kotlo",
+  "lenyalo",
+  "madinyane",
+  "mapheo",
+  "mobung",
+  "moedi",
+  "molaong",
+  "mopresidente",
+  "ntsha",
+  "phatlalatsa",
+  "reka",
+  "sehlekehlekeng",
+  "tlosa",
+  "tlotla",
+  "tseleng",
+  "Lefatshe",
+  "Mphalane",
+  "Se",
+  "Sebaka",
+  "bilione",
+  "bohlale",
+  "bulehileng",
+  "diboko",
+  "diketso",
+  "ditshwantsho",
+  "eme",
+  "hohle",
+  "katleho",
+  "leano",
+  "lehae",
+  "lengolo",
+  "mahlano",
+  "malwetse",
+  "matheba",
+  "moputso",
+  "motseng",
+  "ommeng",
+  "phahamisa",
+  "sekgahla",
+  "sekolo",
+  "theha",
+  "yang",
+  "2014",
+  "Bolaodi",
+  "Dintlha",
+  "Ditokelo",
+  "Leboya",
+  "Letona",
+  "Letsatsi",
+  "Mosebetsi",
+  "SVDP",
+  "baithuti",
+  "banna",
+  "bolele",
+  "bosweu",
+  "botlalo",
+  "bula",
+  "diketsahalo",
+  "dumele",
+  "enwa",
+  "hlokehang",
+  "hwa",
+  "kamohelo",
+  "kgutliso",
+  "kgweding",
+  "lenaneo",
+  "li",
+  "mabitso",
+  "mafolofolo",
+  "matjhaba",
+  "matsoho",
+  "mohatla",
+  "motswako",
+  "nkwa",
+  "phepo",
+  "rapela",
+  "robong",
+  "sehloohong",
+  "senya",
+  "shweleng",
+  "tlaase",
+  "tumello",
+  "ye",
+  "18",
+  "2015",
+  "Aids",
+  "Futhwa",
+  "New",
+  "Ntshetsopele",
+  "Phato",
+  "Zimbabwe",
+  "abo",
+  "amang",
+  "barutuwa",
+  "bobebe",
+  "boya",
+  "dibeke",
+  "dumellwa",
+  "eketsehileng",
+  "hlahelletseng",
+  "hlobo",
+  "hlwekileng",
+  "holang",
+  "ikemiseditse",
+  "kgethehileng",
+  "lehe",
+  "letsatsing",
+  "lohle",
+  "mehlodi",
+  "molomo",
+  "paka",
+  "phetha",
+  "pokello",
+  "puso",
+  "rarolla",
+  "romelwa",
+  "sefahleho",
+  "sehlekehleke",
+  "shebile",
+  "thaba",
+  "tjena",
+  "tlala",
+  "100",
+  "5",
+  "Bakeng",
+  "Bophelo",
+  "Jerusalema",
+  "Jwalo",
+  "Mokgwa",
+  "Tshitwe",
+  "banka",
+  "bonahalang",
+  "dihlabelo",
+  "ditshila",
+  "dumella",
+  "dutse",
+  "etswang",
+  "feletseng",
+  "hapa",
+  "he",
+  "hlokeha",
+  "hong",
+  "itse",
+  "jang",
+  "kappa",
+  "kateng",
+  "ketso",
+  "kotsing",
+  "lekana",
+  "letshwao",
+  "mongamosebetsi",
+  "morung",
+  "neha",
+  "nyewe",
+  "romela",
+  "thobalano",
+  "tsamaisa",
+  "tshepa",
+  "yaba",
+  "‘me",
+  "12",
+  "20",
+  "Bebele",
+  "Blanc",
+  "Diprovense",
+  "Ditshebeletso",
+  "Joshua",
+  "Lekgotleng",
+  "Thuto",
+  "beke",
+  "bodulo",
+  "bohobe",
+  "ditjeo",
+  "enngwe",
+  "foromo",
+  "fumanehe",
+  "hoseng",
+  "kabo",
+  "kula",
+  "leholo",
+  "leihlo",
+  "lenaneng",
+  "lokileng",
+  "matshwao",
+  "menyane",
+  "metsana",
+  "molala",
+  "morekisi",
+  "patsi",
+  "phethahala",
+  "phethahatso",
+  "qalong",
+  "ratang",
+  "sefateng",
+  "selehae",
+  "sephiri",
+  "setso",
+  "theoha",
+  "thuse",
+  "tlaleho",
+  "tlhokomelo",
+  "tokomane",
+  "tsebiso",
+  "wela",
+  "15",
+  "Etsa",
+  "Kopo",
+  "Menokotshwai",
+  "Noka",
+  "Paarl",
+  "Palamente",
+};
+const uint16_t WA_FREQ_154_RANKS[] = {
+  0, 356, 0, 199, 727, 206, 66, 0, 0, 0, 0, 719, 977, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 268, 0, 195, 0, 0, 809, 461,
+  542, 912, 0, 0, 964, 0, 541, 859, 0, 0, 0, 0, 226, 340, 0, 853,
+  0, 0, 0, 0, 467, 0, 832, 0, 0, 0, 618, 546, 83, 539, 0, 876,
+  0, 308, 0, 562, 0, 0, 0, 0, 0, 345, 605, 0, 0, 0, 95, 0,
+  875, 0, 0, 0, 0, 0, 0, 881, 154, 907, 37, 412, 0, 0, 0, 0,
+  0, 0, 279, 0, 0, 0, 155, 0, 115, 614, 792, 965, 0, 122, 0, 0,
+  0, 68, 0, 0, 0, 841, 0, 0, 98, 403, 701, 187, 957, 886, 0, 765,
+  0, 0, 896, 107, 175, 514, 29, 321, 518, 608, 758, 767, 11, 769, 872, 0,
+  0, 0, 456, 799, 0, 0, 0, 341, 747, 0, 510, 806, 845, 0, 326, 0,
+  0, 0, 600, 939, 880, 78, 0, 162, 178, 0, 231, 261, 0, 0, 0, 0,
+  577, 139, 431, 522, 679, 695, 721, 877, 621, 838, 212, 897, 961, 0, 0, 0,
+  0, 44, 525, 826, 0, 371, 0, 0, 474, 0, 0, 0, 993, 0, 0, 706,
+  999, 0, 0, 0, 0, 0, 740, 0, 786, 0, 262, 410, 0, 0, 0, 490,
+  346, 0, 138, 973, 223, 276, 0, 0, 578, 0, 735, 0, 923, 0, 0, 0,
+  0, 0, 0, 650, 800, 0, 0, 975, 0, 214, 911, 370, 0, 0, 0, 306,
+  0, 91, 0, 0, 0, 857, 871, 0, 0, 0, 355, 0, 0, 0, 0, 0,
+  0, 167, 534, 723, 0, 433, 140, 0, 0, 778, 0, 0, 0, 626, 794, 0,
+  472, 27, 810, 0, 0, 414, 372, 0, 0, 0, 922, 0, 0, 892, 0, 0,
+  0, 420, 0, 0, 197, 0, 0, 0, 0, 549, 430, 328, 12, 0, 132, 0,
+  563, 0, 432, 802, 0, 143, 0, 770, 0, 123, 124, 469, 0, 388, 486, 274,
+  73, 766, 861, 934, 235, 290, 0, 0, 0, 0, 0, 0, 909, 0, 0, 0,
+  241, 451, 931, 655, 675, 567, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 434, 0, 0, 404, 0, 0, 0, 251, 0, 0, 324, 0, 0, 394, 0,
+  48, 0, 0, 0, 386, 498, 645, 0, 413, 981, 0, 0, 0, 436, 903, 0,
+  0, 0, 0, 0, 377, 564, 825, 292, 0, 551, 0, 309, 914, 0, 0, 0,
+  0, 0, 777, 84, 272, 141, 493, 476, 0, 0, 0, 0, 0, 0, 0, 515,
+  757, 0, 0, 7, 220, 730, 0, 104, 470, 530, 741, 0, 23, 465, 475, 801,
+  0, 0, 0, 0, 0, 0, 906, 282, 0, 0, 0, 0, 265, 658, 382, 9,
+  53, 599, 0, 211, 516, 488, 947, 0, 789, 307, 554, 0, 0, 243, 0, 982,
+  0, 0, 0, 942, 0, 333, 390, 0, 0, 0, 0, 368, 0, 733, 449, 0,
+  427, 448, 0, 0, 0, 0, 0, 485, 33, 150, 0, 0, 71, 0, 0, 405,
+  0, 0, 0, 180, 0, 127, 250, 860, 409, 0, 72, 0, 0, 0, 219, 0,
+  0, 0, 0, 0, 0, 820, 0, 0, 0, 387, 0, 182, 335, 303, 460, 866,
+  0, 0, 0, 0, 421, 444, 302, 0, 0, 0, 0, 559, 983, 0, 0, 256,
+  501, 569, 814, 0, 0, 0, 0, 505, 0, 0, 0, 0, 0, 0, 0, 0,
+  499, 785, 0, 487, 0, 0, 0, 0, 0, 0, 0, 739, 0, 0, 0, 736,
+  557, 0, 0, 0, 0, 0, 0, 687, 0, 0, 784, 0, 0, 782, 0, 566,
+  508, 0, 0, 0, 0, 295, 0, 635, 210, 0, 0, 0, 0, 216, 233, 0,
+  0, 0, 0, 347, 0, 697, 0, 0, 821, 0, 0, 0, 0, 0, 0, 734,
+  844, 550, 674, 0, 0, 0, 0, 117, 184, 422, 855, 883, 0, 0, 0, 0,
+  596, 0, 0, 0, 391, 986, 0, 0, 0, 0, 0, 222, 775, 0, 0, 0,
+  415, 0, 0, 0, 26, 631, 985, 696, 0, 0, 0, 0, 339, 0, 97, 171,
+  0, 0, 837, 375, 0, 0, 401, 622, 389, 202, 724, 746, 813, 882, 787, 0,
+  642, 0, 0, 137, 0, 349, 668, 429, 863, 166, 42, 743, 972, 606, 102, 0,
+  0, 20, 0, 0, 0, 204, 254, 0, 521, 584, 0, 294, 365, 174, 381, 39,
+  82, 685, 249, 602, 126, 901, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 457, 58, 0, 0, 0, 0, 90, 627, 0, 0, 0, 0, 443, 0, 19,
+  22, 215, 89, 110, 623, 0, 0, 0, 238, 560, 172, 0, 624, 0, 59, 299,
+  463, 760, 0, 224, 270, 190, 351, 656, 0, 0, 289, 0, 742, 918, 980, 839,
+  0, 8, 14, 1000, 690, 0, 0, 200, 252, 0, 0, 0, 0, 354, 0, 587,
+  688, 40, 315, 704, 0, 0, 0, 588, 0, 519, 958, 702, 0, 0, 201, 681,
+  0, 0, 677, 0, 783, 0, 0, 0, 408, 0, 230, 156, 286, 157, 38, 585,
+  537, 951, 0, 555, 0, 720, 0, 0, 0, 0, 0, 478, 0, 0, 34, 795,
+  940, 411, 194, 255, 879, 0, 0, 613, 393, 0, 0, 0, 689, 267, 0, 990,
+  0, 0, 0, 291, 788, 619, 609, 28, 651, 816, 296, 978, 0, 0, 0, 0,
+  829, 228, 0, 287, 103, 213, 0, 548, 0, 0, 0, 319, 331, 425, 617, 177,
+  305, 713, 904, 0, 93, 0, 663, 0, 0, 441, 0, 0, 774, 0, 481, 88,
+  0, 0, 0, 920, 0, 0, 0, 509, 128, 361, 0, 0, 763, 0, 0, 0,
+  458, 147, 323, 0, 118, 455, 0, 772, 823, 919, 586, 0, 0, 198, 0, 0,
+  134, 545, 686, 607, 437, 0, 168, 47, 244, 383, 0, 18, 0, 0, 288, 418,
+  894, 205, 57, 225, 146, 652, 950, 77, 301, 51, 830, 854, 120, 790, 0, 603,
+  373, 0, 998, 527, 926, 0, 666, 41, 153, 511, 842, 568, 0, 780, 0, 193,
+  0, 665, 753, 764, 900, 995, 0, 0, 0, 698, 0, 0, 582, 0, 0, 0,
+  0, 248, 840, 362, 419, 0, 580, 967, 46, 0, 0, 0, 974, 0, 0, 0,
+  0, 0, 0, 311, 0, 31, 0, 593, 0, 0, 798, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 700, 0, 0, 257, 5, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 24, 221, 692, 717, 234, 725, 856, 0, 423, 0,
+  0, 445, 281, 453, 571, 0, 524, 45, 318, 678, 935, 862, 0, 994, 989, 987,
+  79, 526, 376, 54, 170, 592, 750, 0, 0, 0, 0, 0, 0, 991, 917, 338,
+  0, 0, 0, 0, 491, 0, 962, 96, 497, 0, 81, 0, 0, 0, 543, 0,
+  0, 0, 0, 378, 0, 0, 0, 729, 0, 0, 0, 0, 0, 0, 833, 165,
+  0, 94, 396, 711, 878, 86, 494, 0, 0, 0, 0, 0, 0, 0, 49, 0,
+  0, 0, 0, 0, 638, 0, 0, 0, 639, 489, 158, 260, 217, 558, 649, 873,
+  36, 304, 0, 0, 0, 0, 0, 0, 745, 885, 0, 0, 0, 0, 0, 835,
+  726, 0, 0, 0, 0, 0, 0, 0, 0, 0, 85, 601, 869, 776, 921, 0,
+  0, 0, 0, 0, 0, 0, 0, 573, 116, 594, 92, 898, 953, 0, 0, 0,
+  477, 657, 834, 0, 864, 312, 595, 916, 0, 667, 0, 0, 0, 0, 502, 0,
+  144, 0, 874, 0, 0, 0, 0, 0, 0, 0, 591, 0, 0, 135, 693, 712,
+  0, 0, 0, 266, 661, 996, 682, 884, 0, 749, 0, 946, 0, 62, 125, 32,
+  25, 400, 662, 495, 756, 831, 634, 737, 815, 890, 893, 310, 203, 417, 196, 0,
+  245, 0, 192, 579, 629, 0, 0, 0, 902, 0, 925, 0, 933, 0, 0, 0,
+  547, 0, 397, 0, 0, 342, 0, 0, 0, 0, 316, 74, 100, 350, 462, 955,
+  956, 0, 399, 0, 0, 35, 363, 0, 435, 507, 0, 0, 0, 0, 152, 738,
+  992, 0, 329, 0, 0, 0, 227, 480, 0, 565, 625, 744, 142, 754, 755, 932,
+  15, 385, 348, 533, 61, 843, 846, 0, 0, 191, 0, 337, 0, 0, 0, 320,
+  407, 446, 247, 367, 424, 161, 759, 941, 300, 0, 0, 0, 0, 0, 237, 0,
+  628, 0, 728, 0, 0, 503, 0, 0, 0, 482, 653, 852, 442, 803, 0, 56,
+  0, 647, 0, 447, 699, 0, 0, 0, 0, 0, 0, 0, 0, 232, 364, 297,
+  796, 0, 889, 761, 924, 6, 633, 0, 0, 930, 0, 151, 553, 148, 538, 314,
+  450, 731, 963, 70, 454, 63, 183, 572, 646, 938, 0, 817, 75, 136, 797, 905,
+  242, 492, 805, 0, 99, 0, 0, 479, 0, 236, 0, 229, 849, 0, 714, 520,
+  927, 691, 359, 0, 0, 703, 278, 0, 0, 129, 0, 847, 0, 0, 773, 0,
+  705, 0, 0, 352, 654, 0, 899, 0, 636, 808, 0, 0, 0, 327, 971, 0,
+  0, 0, 504, 913, 0, 64, 0, 471, 0, 121, 0, 0, 0, 528, 936, 0,
+  683, 0, 676, 966, 535, 0, 0, 0, 0, 0, 0, 0, 176, 284, 43, 379,
+  604, 0, 0, 0, 610, 0, 0, 109, 0, 0, 0, 670, 0, 188, 0, 512,
+  0, 0, 532, 0, 0, 0, 611, 0, 0, 0, 0, 0, 0, 812, 779, 643,
+  0, 708, 0, 0, 0, 0, 0, 0, 968, 954, 570, 673, 0, 0, 0, 722,
+  949, 332, 793, 641, 0, 0, 0, 0, 0, 0, 0, 374, 380, 581, 616, 660,
+  868, 0, 0, 0, 0, 648, 0, 0, 0, 0, 0, 0, 149, 970, 0, 80,
+  908, 811, 263, 0, 561, 944, 0, 0, 0, 0, 915, 680, 0, 189, 16, 0,
+  273, 55, 0, 0, 597, 0, 0, 979, 715, 0, 822, 0, 322, 0, 0, 671,
+  317, 2, 887, 3, 483, 531, 269, 13, 891, 910, 173, 540, 637, 664, 867, 997,
+  0, 640, 888, 895, 589, 0, 159, 406, 0, 0, 440, 285, 0, 952, 0, 402,
+  283, 452, 752, 684, 186, 960, 246, 0, 0, 0, 0, 0, 384, 0, 937, 0,
+  827, 0, 164, 0, 0, 0, 0, 976, 0, 280, 0, 0, 30, 239, 836, 762,
+  0, 366, 0, 0, 870, 0, 0, 0, 771, 0, 336, 313, 0, 0, 630, 330,
+  0, 768, 0, 1, 0, 0, 344, 632, 0, 0, 0, 0, 791, 87, 0, 208,
+  0, 0, 438, 807, 0, 0, 716, 0, 0, 0, 644, 0, 0, 0, 119, 111,
+  0, 0, 0, 0, 0, 4, 694, 0, 0, 218, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 556, 169, 0, 277, 163, 500, 848, 0, 484,
+  0, 0, 513, 0, 0, 293, 101, 113, 523, 858, 0, 0, 0, 0, 0, 0,
+  0, 439, 0, 0, 0, 253, 948, 0, 369, 0, 334, 828, 496, 0, 0, 536,
+  0, 0, 0, 264, 0, 0, 0, 0, 0, 67, 108, 945, 0, 0, 0, 145,
+  275, 459, 428, 0, 576, 131, 0, 0, 0, 0, 358, 598, 819, 0, 0, 0,
+  160, 114, 0, 0, 179, 0, 0, 0, 0, 50, 0, 416, 850, 0, 943, 0,
+  0, 0, 0, 0, 466, 0, 0, 0, 0, 0, 464, 732, 0, 133, 709, 0,
+  0, 0, 0, 0, 0, 0, 0, 76, 0, 130, 583, 615, 824, 0, 0, 0,
+  575, 0, 112, 0, 473, 710, 0, 0, 0, 0, 17, 0, 0, 929, 0, 0,
+  0, 0, 0, 0, 0, 865, 0, 959, 0, 0, 395, 0, 0, 0, 0, 0,
+  271, 398, 0, 259, 620, 928, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 52, 0, 804, 0, 0, 0, 258, 0, 517,
+  0, 0, 0, 10, 60, 851, 209, 69, 325, 468, 669, 672, 343, 529, 718, 574,
+  65, 360, 748, 181, 506, 185, 544, 552, 659, 105, 707, 612, 781, 969, 988, 0,
+  298, 0, 0, 392, 426, 0, 0, 0, 0, 0, 0, 207, 240, 0, 0, 818,
+  0, 0, 0, 0, 353, 0, 751, 0, 0, 106, 0, 0, 0, 357, 0, 21,
+  590, 984, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+const char *WA_FREQ_155_TOKENS[] = {
+  "元",
+  "nu",
+  "jeung",
+  "anu",
+  "di",
+  "dina",
+  "sarta",
+  "ku",
+  "ieu",
+  "ka",
+  "ti",
+  "pikeun",
+  "atawa",
+  "bisa",
+  "éta",
+  "aya",
+  "jadi",
+  "nyaéta",
+  "hiji",
+  "ogé",
+  "tina",
+  "taun",
+  "kana",
+  "teu",
+  "leuwih",
+  "geus",
+  "Dina",
+  "téh",
+  "keur",
+  "nya",
+  "nepi",
+  "basa",
+  "mah",
+  "tapi",
+  "mangrupa",
+  "disebut",
+  "dipaké",
+  "mangrupakeun",
+  "dua",
+  "minangka",
+  "henteu",
+  "urang",
+  "boga",
+  "sababaraha",
+  "miboga",
+  "yén",
+  "Di",
+  "nyaeta",
+  "wewengkon",
+  "sacara",
+  "ngaran",
+  "Sunda",
+  "deui",
+  "salaku",
+  "loba",
+  "kalayan",
+  "antara",
+  "nagara",
+  "bagian",
+  "kalawan",
+  "alatan",
+  "Jepang",
+  "sarua",
+  "waktu",
+  "manéhna",
+  "mimiti",
+  "cai",
+  "ngan",
+  "Basa",
+  "biasana",
+  "kasebut",
+  "cara",
+  "tempat",
+  "kecap",
+  "bakal",
+  "sabab",
+  "luhur",
+  "kota",
+  "nyieun",
+  "leutik",
+  "saperti",
+  "sahiji",
+  "Indonésia",
+  "salah",
+  "sok",
+  "ngabogaan",
+  "kaasup",
+  "oge",
+  "maké",
+  "kawas",
+  "dunya",
+  "pisan",
+  "tur",
+  "Tapi",
+  "mangsa",
+  "ngeunaan",
+  "kudu",
+  "lamun",
+  "para",
+  "kitu",
+  "nalika",
+  "dipake",
+  "hartina",
+  "Jawa",
+  "manusa",
+  "asalna",
+  "ngagunakeun",
+  "dijieun",
+  "tilu",
+  "hasil",
+  "ayana",
+  "kiwari",
+  "Ieu",
+  "sedengkeun",
+  "diwangun",
+  "masih",
+  "ayeuna",
+  "dumasar",
+  "jero",
+  "séjén",
+  "Aya",
+  "sanggeus",
+  "Indonesia",
+  "masarakat",
+  "Inggris",
+  "hal",
+  "utama",
+  "abad",
+  "sorangan",
+  "hirup",
+  "ngandung",
+  "ngarupakeun",
+  "sareng",
+  "saurang",
+  "anjeunna",
+  "tuluy",
+  "Ku",
+  "umum",
+  "Sanggeus",
+  "eta",
+  "ngahasilkeun",
+  "Bandung",
+  "2",
+  "lain",
+  "dan",
+  "teh",
+  "jaman",
+  "ngaliwatan",
+  "bahan",
+  "1",
+  "séjénna",
+  "sora",
+  "beulah",
+  "baris",
+  "meunang",
+  "make",
+  "kahiji",
+  "sahingga",
+  "anyar",
+  "na",
+  "wangun",
+  "boh",
+  "unggal",
+  "warna",
+  "handap",
+  "kira-kira",
+  "jalan",
+  "mibanda",
+  "lianna",
+  "jalma",
+  "Jakarta",
+  "panjang",
+  "saterusna",
+  "kaayaan",
+  "asup",
+  "rupa-rupa",
+  "rupa",
+  "sangkan",
+  "salila",
+  "bulan",
+  "taneuh",
+  "awak",
+  "sawatara",
+  "sél",
+  "kidul",
+  "utamana",
+  "béda",
+  "kituna",
+  "poé",
+  "mindeng",
+  "munggaran",
+  "sinyal",
+  "Nu",
+  "dianggap",
+  "lumangsung",
+  "Islam",
+  "kungsi",
+  "dipikawanoh",
+  "ngawengku",
+  "gedé",
+  "widang",
+  "maranéhanana",
+  "ukur",
+  "musik",
+  "carita",
+  "ilahar",
+  "sanajan",
+  "lantaran",
+  "kadua",
+  "langsung",
+  "mana",
+  "penting",
+  "data",
+  "kapanggih",
+  "luar",
+  "sistem",
+  "jumlah",
+  "anggota",
+  "kulon",
+  "Walanda",
+  "Sanajan",
+  "ngaranna",
+  "pohara",
+  "Kota",
+  "ngawangun",
+  "seni",
+  "3",
+  "Manéhna",
+  "ukuran",
+  "suku",
+  "bentuk",
+  "pulo",
+  "kurang",
+  "sistim",
+  "badag",
+  "méré",
+  "anak",
+  "Taun",
+  "tetep",
+  "Kabupatén",
+  "Pikeun",
+  "buah",
+  "opat",
+  "prosés",
+  "husus",
+  "jenis",
+  "perang",
+  "mangka",
+  "Ti",
+  "sagala",
+  "yen",
+  "fungsi",
+  "ngabalukarkeun",
+  "digunakeun",
+  "Cina",
+  "Hal",
+  "of",
+  "harita",
+  "kulawarga",
+  "mun",
+  "asam",
+  "bodas",
+  "salasahiji",
+  "Lamun",
+  "sajarah",
+  "tukang",
+  "kajadian",
+  "tanggal",
+  "babarengan",
+  "laut",
+  "sato",
+  "yang",
+  "kalér",
+  "barang",
+  "harti",
+  "waé",
+  "Gunung",
+  "jaringan",
+  "kacida",
+  "karajaan",
+  "biasa",
+  "beuki",
+  "beureum",
+  "Ngaran",
+  "sisi",
+  "tim",
+  "dibagi",
+  "spésiés",
+  "wétan",
+  "terus",
+  "cm",
+  "alus",
+  "raja",
+  "alam",
+  "pamaréntahan",
+  "sakabéh",
+  "Kidul",
+  "ampir",
+  "daun",
+  "ditulis",
+  "Amérika",
+  "dasar",
+  "kénéh",
+  "élmu",
+  "bari",
+  "imah",
+  "kahirupan",
+  "getih",
+  "datang",
+  "tengah",
+  "bangsa",
+  "Anjeunna",
+  "Karajaan",
+  "kulit",
+  "lila",
+  "puseur",
+  "tradisional",
+  "hurup",
+  "India",
+  "listrik",
+  "réa",
+  "budak",
+  "janten",
+  "kadaharan",
+  "deukeut",
+  "kali",
+  "umumna",
+  "dijadikeun",
+  "gumantung",
+  "lalaki",
+  "ahli",
+  "awal",
+  "alat",
+  "umur",
+  "gelombang",
+  "jalur",
+  "lagu",
+  "saeutik",
+  "Éropa",
+  "awéwé",
+  "tangkal",
+  "Hiji",
+  "saprak",
+  "hideung",
+  "istilah",
+  "5",
+  "jelema",
+  "tangtu",
+  "panas",
+  "tumuwuh",
+  "wangunan",
+  "ahir",
+  "4",
+  "naon",
+  "rada",
+  "Kulon",
+  "Sacara",
+  "balik",
+  "tutuwuhan",
+  "Arab",
+  "Prabu",
+  "budaya",
+  "resmi",
+  "Nalika",
+  "populasi",
+  "Raja",
+  "Basa Jepang",
+  "gunung",
+  "buku",
+  "gampang",
+  "Asia",
+  "Laut",
+  "informasi",
+  "ngagambarkeun",
+  "daérah",
+  "pondok",
+  "baheula",
+  "dayeuh",
+  "saméméh",
+  "Sababaraha",
+  "Sedengkeun",
+  "batan",
+  "katelah",
+  "warsih",
+  "10",
+  "contona",
+  "sakola",
+  "Yunani",
+  "antarana",
+  "mawa",
+  "tanpa",
+  "m",
+  "Nagara",
+  "atom",
+  "dingaranan",
+  "kuat",
+  "paling",
+  "km",
+  "rasa",
+  "walungan",
+  "ilaharna",
+  "lian",
+  "bumi",
+  "gaya",
+  "nulis",
+  "kolot",
+  "komunikasi",
+  "sipat",
+  "standar",
+  "kembang",
+  "dimimitian",
+  "usaha",
+  "wates",
+  "cukup",
+  "frékuénsi",
+  "pakakas",
+  "tingkat",
+  "Sajaba",
+  "batu",
+  "Perancis",
+  "diajar",
+  "karya",
+  "leungeun",
+  "ngalaman",
+  "robah",
+  "telepon",
+  "Perang",
+  "dihasilkeun",
+  "diri",
+  "gancang",
+  "golongan",
+  "pamaén",
+  "wilayah",
+  "kakawasaan",
+  "sumber",
+  "Barat",
+  "asal",
+  "lima",
+  "nyebutkeun",
+  "sabenerna",
+  "titik",
+  "dibéré",
+  "daya",
+  "kaluar",
+  "Contona",
+  "lahir",
+  "surat",
+  "Pulo",
+  "hayang",
+  "héjo",
+  "nangtukeun",
+  "lolobana",
+  "misalna",
+  "propinsi",
+  "II",
+  "hubungan",
+  "Alatan",
+  "Salian",
+  "lauk",
+  "manehna",
+  "gambar",
+  "kimia",
+  "tujuan",
+  "acara",
+  "jauh",
+  "laju",
+  "ngajadikeun",
+  "usum",
+  "katut",
+  "Kecap",
+  "Universitas",
+  "kusabab",
+  "diantarana",
+  "désa",
+  "manuk",
+  "Mun",
+  "Tengah",
+  "Urang",
+  "kasohor",
+  "2008",
+  "The",
+  "minyak",
+  "nempo",
+  "pamaréntah",
+  "sastra",
+  "upacara",
+  "lingkungan",
+  "moal",
+  "Ibu",
+  "barudak",
+  "basisir",
+  "leuweung",
+  "pangaruh",
+  "conto",
+  "masalah",
+  "radio",
+  "unsur",
+  "Afrika",
+  "ahirna",
+  "gerak",
+  "ngora",
+  "parobahan",
+  "agama",
+  "karakter",
+  "tungtung",
+  "2007",
+  "industri",
+  "jam",
+  "lega",
+  "mobil",
+  "molekul",
+  "Républik",
+  "internasional",
+  "kai",
+  "konéng",
+  "maén",
+  "mesin",
+  "tulisan",
+  "beda",
+  "perenahna",
+  "protéin",
+  "réaksi",
+  "sapanjang",
+  "7",
+  "Kiwari",
+  "bal",
+  "kabéh",
+  "rohangan",
+  "gede",
+  "nunjukkeun",
+  "Lastri",
+  "Muhammad",
+  "Tokyo",
+  "dipigawé",
+  "garis",
+  "jalu",
+  "kaulinan",
+  "Cirebon",
+  "Sang",
+  "dicokot",
+  "nasional",
+  "20",
+  "posisi",
+  "Butan",
+  "Dunya",
+  "kira",
+  "warnana",
+  "Anu",
+  "aturan",
+  "digital",
+  "méter",
+  "2005",
+  "2006",
+  "nilai",
+  "cahaya",
+  "hukum",
+  "sejen",
+  "tari",
+  "turunan",
+  "Teu",
+  "arah",
+  "atanapi",
+  "film",
+  "komputer",
+  "ngahontal",
+  "ngaluarkeun",
+  "panalungtikan",
+  "struktur",
+  "awakna",
+  "ngadegkeun",
+  "siki",
+  "Abas",
+  "naskah",
+  "satuluyna",
+  "gelar",
+  "kawentar",
+  "luyu",
+  "putra",
+  "saban",
+  "wayang",
+  "zat",
+  "Naruto",
+  "can",
+  "de",
+  "salajengna",
+  "teras",
+  "Kapuloan",
+  "juru",
+  "milih",
+  "pepelakan",
+  "pihak",
+  "sarupa",
+  "sumebar",
+  "Loba",
+  "meunangkeun",
+  "patali",
+  "sakabeh",
+  "dilaksanakeun",
+  "dipilih",
+  "manggihan",
+  "matak",
+  "pintonan",
+  "énergi",
+  "and",
+  "jiga",
+  "kayaning",
+  "the",
+  "I",
+  "wae",
+  "Saterusna",
+  "beurat",
+  "kagiatan",
+  "sakuliah",
+  "2009",
+  "6",
+  "Najan",
+  "buleud",
+  "daerah",
+  "endog",
+  "kasenian",
+  "rék",
+  "teuing",
+  "2004",
+  "Nasional",
+  "hadé",
+  "8",
+  "Romania",
+  "garing",
+  "gawé",
+  "jarak",
+  "kakuatan",
+  "kumaha",
+  "Biasana",
+  "juta",
+  "pausahaan",
+  "eusina",
+  "némbongkeun",
+  "Mesir",
+  "narima",
+  "sosial",
+  "Bumi",
+  "Jalan",
+  "asli",
+  "baku",
+  "bener",
+  "ngalawan",
+  "15",
+  "Dua",
+  "Istilah",
+  "Waktu",
+  "karbon",
+  "panyakit",
+  "suhu",
+  "Jadi",
+  "hawa",
+  "majalah",
+  "sejenna",
+  "statistik",
+  "tunggal",
+  "Agustus",
+  "handapeun",
+  "ngarasa",
+  "2000",
+  "bagéan",
+  "dieu",
+  "hareup",
+  "nyadiakeun",
+  "Ayeuna",
+  "Desa",
+  "aksara",
+  "beungeut",
+  "kotana",
+  "maot",
+  "per",
+  "program",
+  "Wewengkon",
+  "awi",
+  "baé",
+  "logam",
+  "dibandingkeun",
+  "dipikanyaho",
+  "ini",
+  "12",
+  "Si",
+  "bagean",
+  "campuran",
+  "ngalakonan",
+  "ngurangan",
+  "normal",
+  "panggedéna",
+  "silih",
+  "téknologi",
+  "x",
+  "cicing",
+  "euweuh",
+  "milu",
+  "ngarobah",
+  "tiis",
+  "Oktober",
+  "gula",
+  "ngahiji",
+  "nujul",
+  "Jalur",
+  "kandungan",
+  "resep",
+  "siga",
+  "tanda",
+  "30",
+  "adat",
+  "jiwa",
+  "mekar",
+  "produksi",
+  "wanoja",
+  "17",
+  "Amerika",
+  "Dumasar",
+  "Kalér",
+  "atikan",
+  "dirina",
+  "has",
+  "kapal",
+  "kelompok",
+  "maca",
+  "malah",
+  "massa",
+  "peuting",
+  "Latin",
+  "bareng",
+  "bikang",
+  "ibu",
+  "kanji",
+  "nyababkeun",
+  "tiasa",
+  "Bogor",
+  "dilakukeun",
+  "dinya",
+  "duanana",
+  "katuhu",
+  "nyaho",
+  "pinuh",
+  "sabagé",
+  "ubar",
+  "Cianjur",
+  "Garut",
+  "dengan",
+  "dimana",
+  "hujan",
+  "layanan",
+  "migunakeun",
+  "nomer",
+  "dipingpin",
+  "ngabentuk",
+  "Propinsi",
+  "Tuluy",
+  "pindah",
+  "sakumna",
+  "status",
+  "ékonomi",
+  "biola",
+  "katempo",
+  "produk",
+  "2010",
+  "Para",
+  "hésé",
+  "ngalakukeun",
+  "ninggalkeun",
+  "susunan",
+  "ukuranana",
+  "Romawi",
+  "Spanyol",
+  "disebutna",
+  "maranéhna",
+  "mimitina",
+  "organisasi",
+  "pati",
+  "variabel",
+  "éléktron",
+  "ambéh",
+  "ari",
+  "grup",
+  "iwal",
+  "kasus",
+  "ménta",
+  "satelit",
+  "umurna",
+  "April",
+  "Désa",
+  "Jl",
+  "alami",
+  "aliran",
+  "ciri",
+  "dari",
+  "kampung",
+  "kieu",
+  "mantuan",
+  "modél",
+  "pakarang",
+  "pasukan",
+  "putri",
+  "Britania",
+  "SM",
+  "gas",
+  "hirupna",
+  "kuring",
+  "pamingpin",
+  "panjangna",
+  "pasti",
+  "A",
+  "Al",
+  "Cara",
+  "Présidén",
+  "anakna",
+  "kadang",
+  "kalolobaan",
+  "lokal",
+  "ngajaga",
+  "pagunungan",
+  "panon",
+  "runtuyan",
+  "saméméhna",
+  "tinimbang",
+  "turun",
+  "Ngan",
+  "merlukeun",
+  "sakaligus",
+  "serangga",
+  "tempo",
+  "tujuh",
+  "Nya",
+  "Pandawa",
+  "bentukna",
+  "fisik",
+  "guru",
+  "nambahan",
+  "pangluhurna",
+  "rata-rata",
+  "sebaran",
+  "si",
+  "Nepi",
+  "TV",
+  "diperlukeun",
+  "gerakan",
+  "jumlahna",
+  "kaca",
+  "rahayat",
+  "vitamin",
+  "wanci",
+  "100",
+  "Keur",
+  "Pusat",
+  "beungkeut",
+  "desa",
+  "hususna",
+  "indungna",
+  "muka",
+  "nurutkeun",
+  "nyiptakeun",
+  "pola",
+  "Italia",
+  "Stasion",
+  "Wétan",
+  "basajan",
+  "béntang",
+  "inti",
+  "nembongkeun",
+  "semu",
+  "Sastra",
+  "diadegkeun",
+  "diayakeun",
+  "genep",
+  "jang",
+  "keneh",
+  "kénca",
+  "lajeng",
+  "ngayakeun",
+  "F1",
+  "Israél",
+  "Kusabab",
+  "Raya",
+  "Tina",
+  "daging",
+  "gé",
+  "katilu",
+  "tahun",
+  "wawatesan",
+  "Lian",
+  "Salah",
+  "Samudra",
+  "arus",
+  "didahar",
+  "indung",
+  "lokasi",
+  "modern",
+  "ngagabung",
+  "pada",
+  "pernah",
+  "saukur",
+  "Januari",
+  "Unggal",
+  "heula",
+  "pangaweruh",
+  "sabot",
+  "tipe",
+  "16",
+  "PT",
+  "Sawatara",
+  "diturunkeun",
+  "kabudayaan",
+  "kareta",
+  "nyaritakeun",
+  "C",
+  "Sarikat",
+  "Walungan",
+  "album",
+  "lapisan",
+  "taya",
+  "bapana",
+  "gitar",
+  "hayam",
+  "kapuloan",
+  "kasakit",
+  "masing-masing",
+  "olahraga",
+  "tradisi",
+  "Déwi",
+  "Maret",
+  "cairan",
+  "ditangtukeun",
+  "jalma-jalma",
+  "kumpulan",
+  "pamakéan",
+  "sadaya",
+  "udara",
+  "Alloh",
+  "Arjuna",
+  "Bagian",
+  "bébas",
+  "da",
+  "mangaruhan",
+  "ngalaksanakeun",
+  "pakait",
+  "perlu",
+  "rugbi",
+  "sagara",
+  "sampel",
+  "serat",
+  "tokoh",
+  "Bali",
+  "analog",
+  "cabang",
+  "dibawa",
+  "disebutkeun",
+  "emas",
+  "néangan",
+  "sering",
+  "wanda",
+  "9",
+  "Minangkabau",
+  "Pendidikan",
+  "Uni",
+  "lambang",
+  "nyokot",
+  "tulang",
+  "2002",
+  "beusi",
+  "kantor",
+  "partikel",
+  "sada",
+  "Nabi",
+  "Rusia",
+  "kelas",
+  "pupuhu",
+  "sakapeung",
+  "ulah",
+  "Galuh",
+  "Karna",
+  "Kresna",
+  "kamekaran",
+  "karéta",
+  "kelir",
+  "nagri",
+  "ngomong",
+  "sakumaha",
+  "sunda",
+  "yuta",
+  "Juli",
+  "Juni",
+  "Mimitina",
+  "Sasuke",
+  "Sri",
+  "Sumedang",
+  "batur",
+  "dipelak",
+  "pasagi",
+  "pasangan",
+  "prasasti",
+  "sawawa",
+  "tacan",
+  "11",
+  "2003",
+};
+const uint16_t WA_FREQ_155_RANKS[] = {
+  523, 0, 797, 0, 0, 185, 0, 0, 0, 0, 870, 256, 0, 295, 0, 669,
+  26, 508, 18, 890, 0, 0, 0, 0, 894, 0, 0, 0, 0, 0, 716, 848,
+  927, 576, 0, 208, 246, 207, 719, 0, 299, 0, 538, 659, 324, 448, 277, 655,
+  0, 0, 643, 0, 0, 304, 70, 547, 0, 356, 0, 648, 259, 454, 406, 171,
+  592, 661, 0, 155, 0, 0, 0, 717, 0, 0, 0, 0, 676, 0, 289, 0,
+  0, 0, 488, 0, 0, 0, 0, 0, 35, 0, 864, 0, 0, 524, 0, 0,
+  56, 0, 0, 0, 0, 0, 0, 0, 0, 969, 0, 906, 330, 348, 746, 0,
+  0, 0, 196, 297, 551, 790, 0, 0, 0, 0, 0, 411, 549, 665, 466, 507,
+  569, 802, 526, 828, 279, 836, 317, 581, 944, 402, 974, 0, 0, 211, 697, 0,
+  924, 0, 0, 379, 723, 814, 0, 159, 0, 0, 249, 917, 343, 0, 0, 0,
+  0, 355, 0, 362, 0, 32, 0, 288, 311, 0, 0, 780, 0, 976, 0, 0,
+  0, 0, 64, 0, 0, 81, 0, 0, 0, 1000, 0, 477, 0, 0, 0, 184,
+  16, 162, 762, 0, 0, 721, 0, 0, 0, 20, 347, 0, 0, 67, 913, 0,
+  571, 0, 0, 0, 121, 403, 591, 755, 89, 0, 275, 0, 0, 559, 0, 640,
+  965, 0, 942, 0, 0, 634, 692, 740, 748, 0, 0, 972, 0, 0, 0, 0,
+  399, 0, 951, 25, 380, 363, 30, 910, 0, 474, 0, 386, 0, 0, 220, 368,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 212, 0, 0, 0, 769, 233, 778,
+  154, 994, 409, 0, 0, 201, 563, 112, 587, 0, 0, 0, 0, 867, 200, 0,
+  689, 0, 0, 920, 113, 554, 919, 0, 0, 0, 0, 0, 107, 0, 0, 0,
+  0, 897, 0, 777, 0, 0, 912, 136, 0, 0, 0, 0, 0, 472, 0, 952,
+  91, 231, 0, 0, 714, 0, 0, 0, 0, 535, 0, 0, 0, 0, 0, 0,
+  0, 595, 0, 0, 688, 0, 305, 0, 0, 0, 0, 0, 14, 284, 0, 0,
+  264, 0, 0, 428, 0, 0, 68, 783, 408, 345, 0, 449, 152, 206, 0, 0,
+  440, 0, 0, 0, 0, 0, 0, 69, 242, 731, 438, 750, 451, 504, 998, 0,
+  0, 0, 0, 0, 565, 501, 335, 516, 527, 681, 0, 0, 226, 181, 292, 139,
+  453, 674, 857, 468, 99, 0, 856, 0, 0, 0, 0, 235, 254, 0, 0, 85,
+  578, 629, 0, 126, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 188, 0, 999, 385, 480, 825, 0, 0, 850, 0, 0, 400, 163, 600, 0,
+  0, 0, 510, 0, 0, 0, 823, 625, 0, 0, 0, 558, 506, 954, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 658, 0, 0, 0, 0, 55, 865,
+  879, 0, 0, 0, 0, 326, 153, 929, 395, 983, 0, 0, 0, 329, 852, 0,
+  487, 536, 933, 0, 0, 0, 228, 0, 607, 17, 583, 0, 491, 715, 0, 190,
+  0, 0, 0, 0, 158, 859, 0, 205, 133, 442, 747, 445, 0, 784, 0, 0,
+  934, 0, 182, 170, 53, 0, 0, 0, 0, 0, 519, 0, 0, 140, 0, 0,
+  88, 608, 109, 0, 40, 0, 0, 0, 0, 0, 0, 415, 238, 340, 632, 0,
+  79, 482, 620, 0, 0, 0, 0, 973, 518, 0, 0, 0, 0, 194, 349, 0,
+  166, 905, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 76, 0, 322, 0,
+  627, 585, 266, 633, 0, 36, 841, 888, 605, 988, 982, 0, 0, 0, 0, 0,
+  0, 465, 0, 0, 0, 0, 837, 493, 0, 638, 0, 0, 0, 872, 0, 722,
+  131, 271, 803, 0, 0, 0, 75, 0, 0, 0, 0, 0, 313, 0, 300, 0,
+  0, 0, 0, 0, 670, 679, 0, 0, 0, 0, 0, 567, 0, 0, 390, 977,
+  0, 0, 46, 915, 0, 0, 0, 0, 0, 0, 458, 555, 702, 203, 704, 0,
+  680, 0, 759, 0, 160, 0, 37, 0, 0, 788, 0, 0, 11, 0, 0, 0,
+  0, 333, 0, 0, 0, 0, 0, 94, 0, 0, 342, 742, 0, 0, 0, 0,
+  566, 0, 0, 0, 0, 164, 177, 0, 0, 0, 0, 0, 0, 354, 940, 0,
+  667, 0, 41, 180, 0, 0, 0, 0, 0, 7, 328, 393, 147, 729, 410, 191,
+  943, 0, 6, 218, 539, 637, 83, 0, 0, 0, 0, 0, 0, 0, 0, 43,
+  269, 321, 338, 743, 846, 853, 873, 0, 115, 0, 280, 301, 0, 0, 0, 245,
+  0, 130, 831, 0, 0, 0, 911, 58, 389, 947, 219, 959, 935, 0, 475, 0,
+  103, 945, 0, 700, 0, 0, 673, 0, 0, 975, 0, 294, 0, 209, 843, 0,
+  0, 5, 751, 0, 59, 0, 995, 0, 835, 1, 66, 696, 148, 467, 165, 776,
+  842, 901, 980, 0, 0, 316, 639, 854, 179, 287, 456, 708, 137, 613, 97, 116,
+  312, 672, 529, 561, 0, 0, 0, 0, 0, 0, 761, 0, 542, 478, 0, 0,
+  798, 0, 0, 0, 172, 0, 0, 0, 263, 574, 307, 353, 193, 0, 514, 123,
+  0, 0, 2, 12, 54, 726, 0, 476, 0, 0, 685, 71, 858, 0, 0, 0,
+  0, 187, 0, 0, 396, 0, 278, 734, 0, 13, 446, 420, 0, 236, 987, 230,
+  908, 0, 0, 0, 276, 124, 27, 612, 550, 102, 709, 572, 92, 660, 695, 921,
+  441, 73, 827, 736, 0, 0, 0, 771, 0, 0, 0, 0, 401, 0, 914, 699,
+  0, 0, 896, 0, 87, 603, 0, 0, 0, 0, 543, 0, 0, 0, 0, 900,
+  810, 0, 0, 703, 0, 74, 0, 0, 956, 0, 127, 744, 636, 946, 192, 388,
+  849, 78, 534, 663, 387, 918, 0, 0, 922, 909, 0, 0, 0, 199, 732, 840,
+  981, 0, 0, 320, 0, 341, 683, 541, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 866, 594, 618, 895, 498, 0, 202, 710, 931, 970, 227, 0, 424,
+  0, 521, 698, 773, 0, 240, 484, 597, 0, 0, 0, 499, 0, 0, 0, 0,
+  0, 515, 0, 885, 0, 416, 0, 0, 0, 0, 953, 684, 0, 0, 52, 733,
+  753, 822, 0, 0, 0, 176, 0, 350, 0, 0, 485, 0, 0, 0, 252, 0,
+  0, 829, 0, 247, 0, 0, 0, 29, 560, 635, 10, 331, 0, 0, 0, 0,
+  0, 0, 886, 815, 0, 0, 0, 0, 0, 0, 0, 33, 48, 0, 452, 0,
+  156, 883, 557, 22, 0, 370, 631, 735, 556, 813, 418, 0, 173, 647, 21, 845,
+  0, 0, 262, 0, 0, 701, 0, 0, 0, 0, 834, 868, 0, 383, 0, 357,
+  0, 0, 707, 229, 838, 0, 804, 351, 257, 898, 0, 430, 537, 645, 774, 0,
+  463, 0, 0, 0, 0, 0, 582, 19, 881, 0, 0, 662, 31, 494, 0, 724,
+  0, 0, 903, 0, 0, 678, 0, 0, 282, 0, 0, 0, 0, 0, 0, 0,
+  0, 210, 352, 653, 0, 573, 889, 0, 0, 49, 63, 367, 584, 434, 739, 855,
+  0, 628, 134, 100, 125, 0, 146, 0, 151, 0, 0, 0, 0, 0, 0, 575,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 615, 0, 0, 0, 0, 767, 296,
+  878, 129, 531, 0, 0, 141, 0, 0, 0, 244, 824, 174, 0, 0, 522, 0,
+  0, 118, 978, 283, 267, 421, 90, 45, 532, 0, 135, 241, 462, 0, 0, 0,
+  0, 336, 800, 334, 832, 0, 223, 641, 0, 0, 0, 375, 0, 0, 0, 0,
+  0, 0, 928, 315, 0, 0, 195, 483, 0, 293, 0, 0, 656, 0, 433, 0,
+  272, 0, 0, 0, 407, 642, 875, 0, 0, 261, 979, 497, 0, 0, 0, 877,
+  820, 0, 0, 0, 809, 0, 0, 720, 0, 492, 145, 577, 871, 0, 675, 0,
+  0, 0, 0, 0, 0, 0, 0, 738, 0, 963, 0, 167, 513, 432, 664, 763,
+  775, 308, 265, 937, 530, 371, 939, 253, 511, 610, 214, 957, 0, 0, 473, 86,
+  0, 332, 0, 0, 0, 0, 860, 0, 183, 0, 0, 749, 930, 138, 528, 0,
+  502, 0, 168, 435, 0, 0, 80, 8, 119, 217, 0, 0, 0, 469, 764, 143,
+  0, 0, 0, 691, 0, 0, 0, 0, 302, 0, 490, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 817, 0, 745, 0, 0, 255, 936, 0, 0, 372, 61, 384,
+  0, 0, 752, 847, 0, 0, 0, 0, 0, 601, 495, 819, 470, 314, 98, 150,
+  427, 590, 0, 884, 0, 0, 0, 318, 754, 0, 447, 323, 344, 108, 805, 0,
+  0, 489, 651, 285, 392, 405, 0, 787, 0, 0, 757, 772, 0, 794, 268, 225,
+  570, 677, 0, 626, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15,
+  51, 730, 169, 258, 785, 789, 793, 588, 907, 0, 0, 0, 0, 0, 364, 378,
+  786, 0, 596, 0, 0, 0, 0, 0, 0, 0, 0, 882, 281, 413, 0, 0,
+  0, 741, 0, 346, 564, 358, 0, 727, 0, 0, 243, 60, 105, 197, 517, 880,
+  0, 325, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 598, 274, 941, 650,
+  0, 376, 958, 0, 0, 0, 377, 47, 904, 799, 96, 0, 0, 0, 0, 966,
+  0, 62, 417, 985, 503, 0, 0, 0, 546, 887, 0, 0, 686, 186, 486, 42,
+  120, 545, 687, 93, 0, 646, 0, 0, 0, 0, 0, 3, 693, 0, 862, 114,
+  132, 0, 0, 0, 4, 0, 77, 725, 0, 95, 457, 765, 250, 0, 0, 0,
+  309, 339, 586, 0, 0, 0, 0, 0, 0, 239, 397, 533, 234, 414, 425, 0,
+  0, 0, 0, 589, 616, 737, 0, 0, 0, 423, 0, 0, 213, 0, 916, 0,
+  899, 0, 548, 0, 923, 0, 360, 443, 644, 455, 705, 706, 0, 361, 0, 0,
+  0, 0, 0, 0, 204, 0, 0, 821, 0, 0, 144, 0, 0, 0, 0, 844,
+  851, 892, 0, 0, 0, 178, 0, 0, 0, 0, 782, 0, 0, 621, 0, 0,
+  593, 0, 0, 694, 801, 781, 808, 0, 260, 398, 964, 0, 0, 0, 0, 711,
+  0, 770, 0, 0, 0, 0, 0, 161, 525, 0, 0, 718, 0, 0, 286, 0,
+  0, 0, 0, 72, 0, 654, 0, 481, 215, 0, 991, 0, 0, 993, 0, 310,
+  0, 431, 0, 0, 0, 0, 57, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 891, 630, 0, 0, 0, 0, 602, 237, 0, 0, 0,
+  373, 82, 792, 359, 874, 0, 0, 0, 291, 0, 0, 0, 84, 327, 0, 439,
+  337, 807, 0, 128, 0, 0, 0, 712, 0, 0, 0, 0, 0, 0, 0, 756,
+  444, 925, 0, 812, 949, 611, 520, 811, 365, 604, 459, 950, 0, 0, 34, 496,
+  806, 0, 0, 0, 426, 464, 216, 816, 0, 540, 796, 0, 0, 0, 0, 0,
+  0, 381, 0, 0, 986, 222, 826, 0, 0, 955, 0, 0, 614, 0, 0, 657,
+  366, 960, 0, 0, 766, 649, 961, 962, 0, 0, 0, 175, 0, 0, 0, 0,
+  0, 544, 690, 221, 622, 876, 971, 0, 0, 142, 617, 394, 833, 992, 713, 251,
+  461, 38, 0, 0, 0, 0, 0, 0, 149, 0, 0, 932, 0, 968, 0, 758,
+  0, 0, 0, 298, 28, 450, 0, 0, 599, 926, 682, 369, 0, 568, 818, 9,
+  157, 0, 0, 0, 0, 24, 50, 382, 101, 270, 500, 0, 938, 0, 0, 624,
+  671, 791, 0, 0, 0, 902, 768, 967, 0, 111, 117, 232, 419, 552, 623, 391,
+  0, 0, 0, 0, 0, 553, 479, 189, 989, 248, 996, 0, 0, 580, 0, 198,
+  303, 0, 0, 0, 760, 471, 505, 0, 863, 0, 437, 0, 0, 0, 0, 0,
+  0, 0, 830, 44, 0, 0, 869, 0, 273, 319, 110, 290, 0, 0, 0, 609,
+  0, 0, 0, 0, 429, 652, 0, 0, 122, 0, 0, 728, 668, 0, 997, 990,
+  0, 0, 0, 0, 984, 0, 412, 0, 0, 0, 0, 606, 374, 861, 0, 23,
+  224, 0, 0, 779, 104, 422, 509, 666, 436, 106, 839, 562, 404, 460, 579, 619,
+  65, 893, 512, 948, 795, 0, 0, 0, 306, 0, 0, 0, 0, 0, 0, 0,
+};
+
+const char *WA_FREQ_156_TOKENS[] = {
+  "jag",
+  "det",
+  "är",
+  "du",
+  "att",
+  "inte",
+  "en",
+  "och",
+  "har",
+  "vi",
+  "på",
+  "i",
+  "för",
+  "han",
+  "med",
+  "som",
+  "om",
+  "var",
+  "vad",
+  "mig",
+  "här",
+  "dig",
+  "så",
+  "den",
+  "kan",
+  "till",
+  "de",
+  "men",
+  "ett",
+  "ska",
+  "ni",
+  "av",
+  "hon",
+  "vill",
+  "ja",
+  "vet",
+  "nu",
+  "nej",
+  "bara",
+  "hur",
+  "min",
+  "kommer",
+  "där",
+  "måste",
+  "honom",
+  "gör",
+  "din",
+  "skulle",
+  "när",
+  "då",
+  "kom",
+  "ha",
+  "bra",
+  "får",
+  "man",
+  "vara",
+  "oss",
+  "ut",
+  "ta",
+  "er",
+  "göra",
+  "okej",
+  "eller",
+  "hade",
+  "från",
+  "varför",
+  "dem",
+  "alla",
+  "tror",
+  "sig",
+  "allt",
+  "henne",
+  "upp",
+  "sa",
+  "ingen",
+  "tack",
+  "gå",
+  "in",
+  "igen",
+  "få",
+  "nåt",
+  "se",
+  "går",
+  "mycket",
+  "hej",
+  "vem",
+  "kanske",
+  "lite",
+  "behöver",
+  "ser",
+  "mitt",
+  "aldrig",
+  "finns",
+  "än",
+  "inget",
+  "efter",
+  "blir",
+  "ju",
+  "hans",
+  "sen",
+  "bli",
+  "gjorde",
+  "två",
+  "nån",
+  "tillbaka",
+  "tar",
+  "mer",
+  "något",
+  "över",
+  "säger",
+  "fick",
+  "ditt",
+  "ge",
+  "väl",
+  "också",
+  "mina",
+  "åt",
+  "nog",
+  "fan",
+  "kunde",
+  "år",
+  "säga",
+  "någon",
+  "mamma",
+  "varit",
+  "ner",
+  "ville",
+  "vänta",
+  "mot",
+  "pappa",
+  "andra",
+  "borde",
+  "känner",
+  "rätt",
+  "vid",
+  "några",
+  "hela",
+  "såg",
+  "hit",
+  "prata",
+  "komma",
+  "låt",
+  "detta",
+  "gjort",
+  "blev",
+  "själv",
+  "tog",
+  "alltid",
+  "vår",
+  "utan",
+  "fel",
+  "hem",
+  "mr",
+  "dag",
+  "dina",
+  "liv",
+  "menar",
+  "verkligen",
+  "visst",
+  "va",
+  "förstår",
+  "sin",
+  "tid",
+  "trodde",
+  "gick",
+  "älskar",
+  "sätt",
+  "berätta",
+  "tänker",
+  "döda",
+  "veta",
+  "tre",
+  "många",
+  "folk",
+  "sluta",
+  "precis",
+  "inga",
+  "hennes",
+  "titta",
+  "innan",
+  "visste",
+  "gillar",
+  "barn",
+  "bättre",
+  "hjälpa",
+  "under",
+  "förlåt",
+  "gång",
+  "bort",
+  "hjälp",
+  "händer",
+  "just",
+  "helt",
+  "säg",
+  "tycker",
+  "första",
+  "död",
+  "håll",
+  "länge",
+  "hör",
+  "sett",
+  "ledsen",
+  "snälla",
+  "saker",
+  "hitta",
+  "fortfarande",
+  "står",
+  "pengar",
+  "god",
+  "samma",
+  "sir",
+  "ens",
+  "ursäkta",
+  "heter",
+  "håller",
+  "vilken",
+  "enda",
+  "gud",
+  "våra",
+  "hand",
+  "borta",
+  "mår",
+  "hallå",
+  "hände",
+  "ur",
+  "problem",
+  "vän",
+  "ger",
+  "stanna",
+  "sak",
+  "dom",
+  "försöker",
+  "låter",
+  "far",
+  "kvar",
+  "väg",
+  "annan",
+  "redan",
+  "längre",
+  "jävla",
+  "helvete",
+  "pratar",
+  "väldigt",
+  "åh",
+  "herregud",
+  "vart",
+  "dit",
+  "kväll",
+  "morgon",
+  "fått",
+  "snart",
+  "ute",
+  "fråga",
+  "sitt",
+  "tiden",
+  "kör",
+  "deras",
+  "tänkte",
+  "namn",
+  "verkar",
+  "tro",
+  "jo",
+  "varje",
+  "fram",
+  "bästa",
+  "fru",
+  "först",
+  "träffa",
+  "säkert",
+  "slut",
+  "sedan",
+  "hos",
+  "ingenting",
+  "därför",
+  "åka",
+  "visa",
+  "säker",
+  "lämna",
+  "börjar",
+  "vägen",
+  "genom",
+  "gav",
+  "härifrån",
+  "jobb",
+  "hålla",
+  "son",
+  "stor",
+  "vänner",
+  "hittade",
+  "annat",
+  "hoppas",
+  "sina",
+  "hörde",
+  "vilket",
+  "kolla",
+  "minns",
+  "ihop",
+  "rädd",
+  "sista",
+  "även",
+  "era",
+  "sex",
+  "vårt",
+  "kunna",
+  "ses",
+  "del",
+  "nästa",
+  "fem",
+  "livet",
+  "nya",
+  "människor",
+  "bilen",
+  "dö",
+  "riktigt",
+  "klarar",
+  "höra",
+  "tills",
+  "liten",
+  "betyder",
+  "tänk",
+  "tag",
+  "lyssna",
+  "polisen",
+  "ändå",
+  "sagt",
+  "hemma",
+  "sant",
+  "världen",
+  "fast",
+  "faktiskt",
+  "ligger",
+  "skit",
+  "idag",
+  "minuter",
+  "familj",
+  "runt",
+  "blivit",
+  "klart",
+  "fall",
+  "väntar",
+  "dog",
+  "fyra",
+  "dra",
+  "dollar",
+  "åker",
+  "kul",
+  "tala",
+  "illa",
+  "män",
+  "försökte",
+  "dödade",
+  "helst",
+  "annars",
+  "haft",
+  "sånt",
+  "nästan",
+  "ensam",
+  "inne",
+  "lika",
+  "lägg",
+  "hittar",
+  "redo",
+  "hämta",
+  "jobbar",
+  "dr",
+  "gången",
+  "båda",
+  "ny",
+  "denna",
+  "stora",
+  "plats",
+  "tur",
+  "börja",
+  "svårt",
+  "lugnt",
+  "långt",
+  "spelar",
+  "kvinna",
+  "känns",
+  "älskling",
+  "hänt",
+  "bil",
+  "emot",
+  "låta",
+  "tillsammans",
+  "öppna",
+  "släpp",
+  "hört",
+  "huset",
+  "senare",
+  "bror",
+  "ringer",
+  "lilla",
+  "be",
+  "rör",
+  "ibland",
+  "rädda",
+  "heller",
+  "fort",
+  "glad",
+  "gått",
+  "mellan",
+  "nära",
+  "ifrån",
+  "hus",
+  "vore",
+  "igenom",
+  "fler",
+  "s",
+  "kände",
+  "vilka",
+  "dotter",
+  "bryr",
+  "dagar",
+  "kille",
+  "tänka",
+  "bor",
+  "fattar",
+  "gärna",
+  "fanns",
+  "ber",
+  "började",
+  "killen",
+  "sitter",
+  "slå",
+  "ännu",
+  "tio",
+  "trevligt",
+  "vilja",
+  "gott",
+  "spela",
+  "bäst",
+  "chans",
+  "gånger",
+  "varandra",
+  "timmar",
+  "lever",
+  "pengarna",
+  "äta",
+  "handlar",
+  "natt",
+  "rum",
+  "klara",
+  "mor",
+  "gamla",
+  "ord",
+  "ihåg",
+  "reda",
+  "ringa",
+  "mannen",
+  "ert",
+  "dags",
+  "bakom",
+  "eftersom",
+  "gammal",
+  "jobbet",
+  "dörren",
+  "fara",
+  "känna",
+  "dessa",
+  "all",
+  "dör",
+  "sån",
+  "par",
+  "bad",
+  "hjälper",
+  "alls",
+  "tyst",
+  "egen",
+  "kommit",
+  "ringde",
+  "dagen",
+  "klar",
+  "galen",
+  "stan",
+  "leva",
+  "syster",
+  "oroa",
+  "mat",
+  "vapen",
+  "john",
+  "ring",
+  "skull",
+  "idé",
+  "stället",
+  "antar",
+  "tagit",
+  "vadå",
+  "sätta",
+  "stå",
+  "mrs",
+  "jaså",
+  "berättade",
+  "ganska",
+  "följer",
+  "klockan",
+  "tidigare",
+  "hittat",
+  "följa",
+  "räcker",
+  "fint",
+  "lätt",
+  "försöka",
+  "jack",
+  "lång",
+  "lovar",
+  "förut",
+  "jobba",
+  "självklart",
+  "skolan",
+  "iväg",
+  "letar",
+  "ikväll",
+  "flera",
+  "försök",
+  "mest",
+  "nytt",
+  "direkt",
+  "kvinnor",
+  "månader",
+  "utanför",
+  "stannar",
+  "sanningen",
+  "stämmer",
+  "lämnade",
+  "stort",
+  "lär",
+  "dödar",
+  "stoppa",
+  "pratade",
+  "talar",
+  "ben",
+  "new",
+  "undan",
+  "plan",
+  "killar",
+  "roligt",
+  "flytta",
+  "blod",
+  "perfekt",
+  "lära",
+  "vatten",
+  "val",
+  "skicka",
+  "hatar",
+  "kallar",
+  "föräldrar",
+  "flicka",
+  "vidare",
+  "före",
+  "lita",
+  "köra",
+  "skynda",
+  "alltså",
+  "uppe",
+  "gäller",
+  "använda",
+  "ont",
+  "huvudet",
+  "ursäkt",
+  "glöm",
+  "medan",
+  "betala",
+  "önskar",
+  "fin",
+  "herr",
+  "sent",
+  "miss",
+  "nere",
+  "igår",
+  "kapten",
+  "kärlek",
+  "roll",
+  "behövde",
+  "imorgon",
+  "kalla",
+  "arg",
+  "lugn",
+  "natten",
+  "lämnar",
+  "viktigt",
+  "sidan",
+  "tjej",
+  "the",
+  "fortsätt",
+  "vacker",
+  "hända",
+  "köpa",
+  "kompis",
+  "inom",
+  "idiot",
+  "satt",
+  "full",
+  "jaha",
+  "sätter",
+  "vissa",
+  "drar",
+  "tyvärr",
+  "nummer",
+  "tja",
+  "lägga",
+  "skriva",
+  "sova",
+  "förstå",
+  "snäll",
+  "veckor",
+  "älskade",
+  "visar",
+  "saken",
+  "snabbt",
+  "tyckte",
+  "ställe",
+  "gifta",
+  "mindre",
+  "enligt",
+  "undrar",
+  "tänkt",
+  "sida",
+  "tittar",
+  "resten",
+  "konstigt",
+  "äter",
+  "vecka",
+  "ok",
+  "typ",
+  "hjärta",
+  "frågor",
+  "misstag",
+  "grund",
+  "skydda",
+  "låg",
+  "följ",
+  "absolut",
+  "förklara",
+  "lät",
+  "svara",
+  "familjen",
+  "nå",
+  "nånsin",
+  "själva",
+  "berättar",
+  "ögon",
+  "möjligt",
+  "välkommen",
+  "varsågod",
+  "slår",
+  "sköt",
+  "goda",
+  "lugna",
+  "kort",
+  "person",
+  "hårt",
+  "sitta",
+  "pojke",
+  "höll",
+  "otroligt",
+  "allihop",
+  "fortsätta",
+  "tom",
+  "skyldig",
+  "använder",
+  "träffas",
+  "sju",
+  "toppen",
+  "barnen",
+  "träffade",
+  "exakt",
+  "tillräckligt",
+  "värre",
+  "egentligen",
+  "lycka",
+  "historia",
+  "skrev",
+  "stod",
+  "fungerar",
+  "fixa",
+  "åkte",
+  "jobbat",
+  "saknar",
+  "större",
+  "någonsin",
+  "såna",
+  "massa",
+  "bör",
+  "slog",
+  "hoppa",
+  "senaste",
+  "små",
+  "kropp",
+  "brukar",
+  "förrän",
+  "bo",
+  "trött",
+  "grabben",
+  "miljoner",
+  "sjuk",
+  "hämtar",
+  "förra",
+  "kära",
+  "käften",
+  "stick",
+  "hälsa",
+  "hemskt",
+  "sägs",
+  "aning",
+  "gift",
+  "frågar",
+  "dum",
+  "skada",
+  "dåligt",
+  "frågade",
+  "inför",
+  "bevis",
+  "lägger",
+  "kaffe",
+  "middag",
+  "oj",
+  "dess",
+  "synd",
+  "behöva",
+  "skjuta",
+  "förbi",
+  "charlie",
+  "åtta",
+  "york",
+  "order",
+  "leta",
+  "slutar",
+  "någonting",
+  "igång",
+  "strax",
+  "framför",
+  "skall",
+  "polis",
+  "annorlunda",
+  "ögonblick",
+  "läget",
+  "ofta",
+  "sam",
+  "dricka",
+  "tjänst",
+  "chefen",
+  "jorden",
+  "början",
+  "la",
+  "enkelt",
+  "ung",
+  "olika",
+  "stund",
+  "läsa",
+  "arbete",
+  "resa",
+  "david",
+  "land",
+  "skickade",
+  "eget",
+  "brukade",
+  "riktig",
+  "betalar",
+  "agent",
+  "orolig",
+  "mord",
+  "söker",
+  "frank",
+  "råd",
+  "dålig",
+  "sticker",
+  "må",
+  "funkar",
+  "tvungen",
+  "skriver",
+  "krig",
+  "joe",
+  "egna",
+  "huvud",
+  "händerna",
+  "överallt",
+  "smart",
+  "herrar",
+  "usa",
+  "spring",
+  "george",
+  "timme",
+  "fortsätter",
+  "samtal",
+  "ansikte",
+  "beklagar",
+  "jävel",
+  "ställa",
+  "allvar",
+  "kvällen",
+  "svar",
+  "telefon",
+  "slåss",
+  "rummet",
+  "menade",
+  "särskilt",
+  "doktorn",
+  "läkare",
+  "finnas",
+  "landet",
+  "a",
+  "ljuger",
+  "ögonen",
+  "barnet",
+  "fixar",
+  "största",
+  "förr",
+  "nånting",
+  "tv",
+  "mike",
+  "vinna",
+  "glömde",
+  "människa",
+  "körde",
+  "staden",
+  "herre",
+  "satte",
+  "veckan",
+  "lyssnar",
+  "sover",
+  "fantastiskt",
+  "chef",
+  "trots",
+  "kvinnan",
+  "omkring",
+  "åtminstone",
+  "fängelse",
+  "flickan",
+  "förlorade",
+  "michael",
+  "räddade",
+  "köpte",
+  "trevlig",
+  "värld",
+  "berättat",
+  "information",
+  "passar",
+  "äntligen",
+  "stark",
+  "fri",
+  "problemet",
+  "hund",
+  "nånstans",
+  "andas",
+  "skaffa",
+  "förlora",
+  "behövs",
+  "älska",
+  "skickar",
+  "rätta",
+  "allvarligt",
+  "röra",
+  "uppfattat",
+  "kallas",
+  "kroppen",
+  "kriget",
+  "max",
+  "peter",
+  "träffat",
+  "kläder",
+  "släppa",
+  "fart",
+  "advokat",
+  "istället",
+  "rakt",
+  "frågan",
+  "allting",
+  "ned",
+  "hel",
+  "skjuter",
+  "skiten",
+  "gett",
+  "sjukhuset",
+  "skjut",
+  "fred",
+  "vita",
+  "lnte",
+  "fbi",
+  "litar",
+  "sälja",
+  "dan",
+  "gillade",
+  "svart",
+  "bär",
+  "sättet",
+  "lycklig",
+  "intressant",
+  "förutom",
+  "pratat",
+  "tjejer",
+  "naturligtvis",
+  "kollar",
+  "nyheter",
+  "personer",
+  "tjejen",
+  "jösses",
+  "sekunder",
+  "levande",
+  "arbetar",
+  "guds",
+  "vinner",
+  "pågår",
+  "försiktig",
+  "planet",
+  "vattnet",
+  "stolt",
+  "fallet",
+  "tacka",
+  "mördare",
+  "döden",
+  "meddelande",
+  "javisst",
+  "beslut",
+  "förtjänar",
+  "james",
+  "öl",
+  "kontor",
+  "flesta",
+  "raring",
+  "anledning",
+  "mark",
+  "bland",
+  "vänster",
+  "litet",
+  "pojken",
+  "tidigt",
+  "skojar",
+  "vakna",
+  "film",
+  "plötsligt",
+  "jättebra",
+  "snygg",
+  "knappt",
+  "slutet",
+  "hår",
+  "försvann",
+  "fest",
+  "möte",
+  "riktiga",
+  "eld",
+  "skål",
+  "l",
+  "försökt",
+  "lärde",
+  "nio",
+  "affärer",
+  "hjälpte",
+  "ers",
+  "snackar",
+  "underbart",
+  "känt",
+  "tredje",
+  "damer",
+  "bok",
+  "dödat",
+  "djur",
+  "farbror",
+  "både",
+  "visade",
+  "oh",
+  "skönt",
+  "ordna",
+  "duktig",
+  "president",
+  "morse",
+  "delar",
+  "grattis",
+  "jobbade",
+  "tydligen",
+  "kontakt",
+  "farligt",
+  "alldeles",
+  "omöjligt",
+  "träffar",
+  "e",
+  "höger",
+  "världens",
+  "spel",
+  "mål",
+  "låtsas",
+  "glömma",
+  "välja",
+  "känslor",
+  "kallade",
+  "förlorat",
+  "fader",
+  "pa",
+  "ändra",
+  "leder",
+  "kung",
+  "lovade",
+  "sov",
+  "året",
+  "sticka",
+  "svarta",
+  "paul",
+  "fantastisk",
+  "högt",
+  "henry",
+};
+const uint16_t WA_FREQ_156_RANKS[] = {
+  0, 516, 0, 0, 0, 0, 0, 0, 599, 0, 375, 807, 0, 0, 139, 470,
+  479, 64, 515, 0, 608, 0, 0, 0, 547, 614, 0, 0, 0, 0, 0, 721,
+  0, 214, 303, 775, 444, 634, 794, 820, 72, 954, 0, 0, 0, 0, 537, 57,
+  563, 0, 0, 0, 0, 0, 18, 0, 284, 0, 484, 0, 0, 0, 0, 0,
+  0, 672, 0, 0, 0, 0, 0, 0, 0, 0, 901, 0, 486, 598, 836, 0,
+  0, 0, 274, 189, 0, 880, 0, 0, 0, 369, 0, 0, 720, 0, 0, 0,
+  244, 75, 494, 0, 0, 676, 832, 0, 673, 0, 0, 615, 0, 0, 0, 0,
+  0, 20, 939, 0, 0, 947, 982, 936, 440, 891, 0, 0, 872, 471, 978, 193,
+  0, 941, 0, 625, 0, 254, 423, 633, 877, 0, 0, 0, 344, 222, 984, 0,
+  0, 0, 0, 850, 0, 0, 593, 695, 0, 0, 0, 0, 0, 101, 473, 21,
+  583, 617, 752, 229, 824, 611, 737, 0, 0, 0, 0, 437, 0, 0, 0, 0,
+  0, 233, 116, 679, 983, 926, 636, 0, 0, 626, 0, 841, 858, 0, 327, 2,
+  0, 0, 0, 0, 405, 843, 390, 822, 0, 892, 0, 0, 452, 761, 875, 170,
+  0, 0, 0, 0, 0, 0, 0, 481, 0, 63, 694, 0, 490, 0, 0, 0,
+  0, 505, 691, 862, 630, 0, 0, 0, 0, 0, 0, 0, 9, 0, 158, 640,
+  0, 0, 258, 0, 0, 0, 310, 246, 212, 447, 569, 0, 0, 799, 187, 0,
+  46, 594, 693, 852, 319, 0, 0, 0, 0, 782, 0, 0, 417, 0, 0, 0,
+  0, 0, 0, 689, 399, 0, 97, 930, 478, 616, 248, 507, 996, 0, 681, 477,
+  922, 0, 0, 0, 0, 0, 993, 0, 889, 0, 0, 0, 829, 0, 0, 438,
+  0, 68, 383, 0, 675, 0, 0, 0, 403, 518, 392, 706, 0, 0, 0, 0,
+  328, 142, 772, 878, 0, 182, 666, 0, 180, 0, 0, 0, 0, 253, 0, 0,
+  311, 657, 123, 0, 931, 427, 867, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 308, 0, 391, 619, 959, 106, 0, 125, 305, 492, 345, 763, 787, 0, 0,
+  561, 664, 0, 0, 0, 167, 491, 0, 0, 0, 0, 0, 0, 49, 108, 871,
+  0, 472, 0, 0, 0, 0, 301, 0, 0, 0, 245, 378, 0, 0, 0, 439,
+  997, 469, 0, 632, 0, 0, 0, 0, 465, 0, 0, 0, 0, 0, 0, 237,
+  0, 0, 532, 0, 0, 0, 0, 0, 86, 705, 819, 0, 51, 849, 865, 243,
+  95, 502, 818, 802, 0, 309, 487, 0, 552, 44, 0, 0, 692, 0, 0, 550,
+  973, 0, 0, 0, 0, 304, 0, 162, 152, 0, 0, 0, 0, 0, 299, 708,
+  0, 0, 0, 0, 178, 15, 291, 722, 349, 580, 780, 974, 985, 0, 0, 164,
+  719, 0, 870, 174, 0, 0, 0, 184, 467, 776, 0, 0, 242, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 988, 0, 436, 584, 825, 0, 414, 606, 928, 0,
+  0, 0, 0, 725, 322, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 277, 149, 0, 0, 235, 94, 194, 285, 351, 527, 35, 590, 526, 280, 963,
+  0, 0, 264, 0, 0, 0, 450, 288, 395, 457, 398, 80, 748, 0, 0, 276,
+  176, 814, 0, 0, 0, 699, 0, 0, 0, 512, 0, 847, 0, 0, 653, 0,
+  0, 0, 0, 0, 890, 0, 0, 0, 0, 0, 173, 992, 234, 419, 879, 389,
+  0, 0, 810, 247, 0, 0, 0, 376, 0, 0, 0, 314, 221, 690, 0, 0,
+  99, 687, 0, 0, 373, 324, 117, 578, 869, 0, 0, 0, 624, 0, 531, 145,
+  0, 159, 0, 332, 991, 0, 135, 84, 568, 0, 0, 0, 0, 0, 0, 0,
+  0, 573, 0, 42, 0, 712, 223, 0, 0, 589, 202, 0, 239, 534, 406, 488,
+  540, 711, 828, 848, 269, 0, 0, 0, 0, 411, 0, 768, 0, 133, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 938, 459, 0, 146, 0, 0, 585, 0, 714,
+  688, 22, 296, 476, 635, 0, 0, 0, 0, 558, 0, 416, 0, 0, 55, 0,
+  0, 0, 0, 0, 0, 0, 631, 165, 498, 432, 0, 47, 0, 0, 160, 709,
+  209, 0, 0, 0, 0, 503, 581, 0, 0, 0, 0, 0, 0, 0, 136, 837,
+  881, 0, 155, 0, 124, 0, 750, 0, 0, 0, 0, 0, 0, 387, 205, 0,
+  429, 0, 0, 0, 929, 0, 0, 0, 0, 830, 0, 0, 893, 700, 582, 949,
+  370, 873, 0, 0, 331, 0, 0, 415, 109, 0, 426, 751, 781, 786, 0, 464,
+  495, 0, 0, 241, 300, 312, 334, 0, 0, 0, 0, 0, 1, 0, 0, 224,
+  857, 0, 0, 785, 0, 385, 0, 0, 0, 0, 0, 0, 0, 278, 650, 0,
+  0, 0, 0, 112, 904, 0, 377, 388, 564, 702, 83, 628, 0, 654, 0, 0,
+  381, 851, 896, 975, 767, 0, 161, 430, 130, 601, 960, 0, 10, 257, 0, 350,
+  207, 100, 418, 806, 999, 0, 544, 0, 232, 50, 282, 595, 845, 917, 16, 0,
+  0, 0, 37, 386, 900, 961, 0, 0, 62, 0, 0, 0, 339, 0, 12, 517,
+  215, 707, 759, 774, 779, 0, 171, 169, 894, 0, 40, 0, 0, 0, 0, 800,
+  0, 981, 0, 185, 0, 206, 749, 0, 0, 400, 421, 0, 0, 316, 0, 0,
+  0, 0, 0, 0, 462, 916, 0, 0, 148, 0, 0, 0, 0, 468, 528, 0,
+  0, 0, 0, 0, 823, 0, 0, 0, 0, 0, 760, 627, 25, 196, 290, 219,
+  0, 172, 493, 0, 13, 346, 404, 0, 846, 536, 28, 0, 0, 298, 902, 817,
+  413, 548, 0, 482, 0, 0, 0, 422, 979, 77, 0, 0, 542, 920, 0, 0,
+  0, 0, 460, 0, 0, 0, 0, 0, 0, 0, 0, 367, 0, 0, 362, 0,
+  320, 0, 59, 620, 0, 622, 629, 0, 307, 898, 0, 177, 0, 0, 0, 0,
+  466, 0, 0, 192, 431, 401, 0, 0, 315, 379, 0, 0, 791, 0, 602, 0,
+  0, 0, 0, 294, 0, 0, 0, 0, 966, 557, 919, 480, 0, 727, 103, 933,
+  0, 621, 0, 674, 685, 208, 0, 731, 0, 0, 409, 0, 812, 738, 0, 0,
+  0, 0, 0, 0, 964, 0, 0, 0, 0, 815, 0, 0, 435, 0, 0, 741,
+  510, 0, 0, 511, 906, 179, 295, 93, 128, 0, 0, 0, 0, 0, 81, 261,
+  0, 0, 0, 0, 0, 85, 0, 0, 0, 0, 283, 838, 0, 0, 70, 0,
+  0, 168, 977, 0, 144, 755, 969, 0, 0, 596, 899, 921, 953, 71, 0, 0,
+  333, 826, 553, 723, 842, 0, 765, 911, 0, 0, 600, 0, 0, 0, 670, 659,
+  948, 217, 736, 754, 513, 0, 0, 140, 236, 102, 538, 0, 0, 0, 744, 905,
+  0, 0, 0, 0, 60, 0, 0, 529, 23, 313, 428, 0, 190, 0, 784, 0,
+  854, 197, 732, 648, 757, 292, 0, 0, 0, 0, 0, 27, 17, 570, 0, 500,
+  402, 0, 266, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 914, 0,
+  0, 0, 330, 326, 968, 0, 0, 0, 642, 0, 0, 0, 0, 231, 0, 724,
+  0, 0, 0, 0, 0, 855, 0, 0, 576, 11, 0, 420, 506, 942, 0, 989,
+  355, 770, 0, 455, 0, 0, 864, 0, 451, 0, 0, 53, 0, 0, 0, 0,
+  0, 201, 0, 434, 0, 0, 0, 0, 256, 265, 655, 0, 0, 0, 0, 0,
+  0, 0, 67, 0, 958, 0, 0, 0, 935, 0, 0, 43, 0, 45, 717, 0,
+  952, 0, 604, 0, 0, 0, 0, 200, 0, 151, 533, 30, 0, 0, 0, 433,
+  638, 0, 0, 0, 14, 0, 0, 0, 0, 0, 733, 525, 882, 0, 424, 113,
+  971, 0, 0, 181, 859, 0, 0, 58, 0, 0, 0, 92, 26, 96, 0, 0,
+  497, 255, 0, 0, 656, 560, 0, 259, 556, 955, 0, 0, 0, 293, 166, 771,
+  485, 853, 860, 903, 678, 0, 0, 0, 0, 697, 756, 120, 443, 789, 24, 0,
+  74, 0, 0, 154, 335, 365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  317, 218, 127, 0, 0, 0, 0, 682, 0, 0, 0, 0, 856, 445, 990, 0,
+  0, 0, 0, 0, 0, 0, 0, 354, 586, 32, 887, 0, 514, 876, 0, 0,
+  0, 0, 932, 0, 286, 0, 0, 795, 0, 0, 66, 88, 0, 0, 0, 671,
+  641, 371, 571, 835, 0, 0, 0, 718, 0, 0, 0, 0, 0, 0, 0, 0,
+  778, 0, 0, 0, 509, 394, 137, 341, 551, 138, 0, 0, 0, 260, 0, 321,
+  0, 73, 646, 661, 555, 520, 122, 758, 821, 0, 0, 0, 0, 811, 0, 0,
+  0, 0, 612, 359, 0, 0, 0, 118, 87, 489, 0, 0, 318, 360, 669, 885,
+  0, 0, 6, 69, 216, 809, 766, 0, 475, 0, 644, 0, 0, 652, 0, 925,
+  0, 474, 0, 0, 0, 65, 651, 863, 703, 408, 796, 228, 572, 0, 0, 0,
+  729, 0, 0, 48, 0, 0, 0, 0, 0, 0, 910, 987, 735, 115, 363, 519,
+  813, 742, 970, 0, 0, 0, 0, 0, 250, 287, 522, 0, 747, 716, 0, 0,
+  0, 105, 353, 230, 667, 226, 696, 909, 110, 868, 923, 302, 210, 393, 54, 524,
+  944, 951, 962, 372, 980, 610, 972, 577, 645, 950, 0, 0, 410, 0, 0, 0,
+  801, 915, 0, 0, 0, 0, 683, 0, 273, 0, 0, 0, 338, 0, 743, 275,
+  957, 0, 157, 0, 790, 0, 0, 773, 0, 0, 0, 831, 726, 204, 357, 407,
+  805, 994, 39, 325, 358, 186, 566, 0, 0, 0, 342, 0, 0, 579, 82, 153,
+  739, 0, 0, 0, 0, 833, 986, 114, 0, 639, 0, 352, 0, 0, 0, 5,
+  0, 0, 0, 976, 150, 0, 240, 52, 336, 225, 660, 912, 956, 0, 384, 0,
+  888, 0, 382, 368, 289, 874, 0, 0, 0, 132, 0, 808, 188, 897, 0, 0,
+  0, 0, 0, 0, 90, 0, 0, 649, 0, 0, 107, 597, 753, 0, 199, 134,
+  554, 0, 56, 698, 804, 0, 3, 0, 0, 191, 508, 792, 998, 0, 0, 0,
+  0, 0, 713, 0, 840, 262, 251, 0, 0, 0, 0, 0, 0, 0, 574, 886,
+  0, 0, 374, 4, 663, 183, 592, 710, 839, 546, 0, 131, 686, 0, 0, 76,
+  0, 565, 0, 0, 0, 0, 0, 0, 213, 549, 0, 0, 0, 541, 0, 163,
+  0, 0, 607, 0, 0, 0, 587, 0, 0, 0, 0, 8, 129, 111, 521, 271,
+  545, 7, 0, 0, 0, 777, 195, 91, 0, 0, 0, 0, 0, 425, 783, 844,
+  0, 0, 0, 0, 0, 0, 0, 0, 442, 0, 323, 501, 588, 0, 539, 0,
+  0, 907, 1000, 0, 0, 198, 0, 0, 965, 31, 19, 454, 523, 0, 0, 0,
+  0, 0, 29, 861, 306, 0, 908, 347, 0, 0, 940, 684, 946, 461, 483, 603,
+  562, 456, 680, 764, 816, 995, 0, 0, 927, 0, 559, 0, 0, 535, 364, 504,
+  567, 918, 0, 715, 793, 41, 0, 637, 0, 34, 0, 36, 361, 943, 0, 0,
+  0, 0, 0, 0, 937, 0, 658, 380, 0, 0, 668, 0, 446, 396, 0, 0,
+  0, 0, 762, 89, 618, 827, 730, 866, 0, 746, 0, 677, 0, 337, 0, 0,
+  0, 0, 356, 0, 0, 662, 0, 0, 38, 740, 647, 745, 0, 499, 0, 0,
+  0, 147, 279, 496, 609, 0, 0, 98, 121, 175, 249, 252, 591, 270, 104, 728,
+  798, 0, 0, 701, 281, 0, 397, 238, 0, 0, 704, 734, 913, 0, 0, 0,
+  0, 0, 605, 143, 0, 203, 412, 0, 141, 0, 78, 0, 0, 0, 156, 575,
+  0, 0, 126, 343, 934, 0, 0, 0, 0, 0, 803, 0, 967, 449, 0, 788,
+  0, 0, 0, 0, 463, 220, 329, 272, 665, 769, 884, 297, 613, 530, 0, 797,
+  0, 0, 0, 366, 268, 263, 340, 119, 623, 883, 0, 0, 0, 33, 0, 267,
+  0, 0, 0, 0, 0, 0, 79, 0, 0, 643, 0, 448, 895, 945, 834, 441,
+  348, 0, 61, 0, 0, 458, 924, 0, 0, 0, 453, 543, 0, 211, 0, 227,
+};
+
+const char *WA_FREQ_157_TOKENS[] = {
+  "ya",
+  "na",
+  "wa",
+  "kwa",
+  "ni",
+  "katika",
+  "za",
+  "la",
+  "kuwa",
+  "kama",
+  "cha",
+  "hiyo",
+  "mwaka",
+  "yake",
+  "watu",
+  "kwenye",
+  "au",
+  "kwamba",
+  "vya",
+  "zaidi",
+  "wake",
+  "hivyo",
+  "lakini",
+  "wakati",
+  "alisema",
+  "pia",
+  "hii",
+  "nchi",
+  "huo",
+  "ili",
+  "Kwa",
+  "nchini",
+  "kutoka",
+  "kazi",
+  "baada",
+  "hilo",
+  "sasa",
+  "ambayo",
+  "pamoja",
+  "kila",
+  "moja",
+  "yao",
+  "hadi",
+  "sababu",
+  "hata",
+  "huu",
+  "ambao",
+  "kubwa",
+  "mara",
+  "serikali",
+  "Tanzania",
+  "ndani",
+  "sana",
+  "miaka",
+  "kwanza",
+  "tu",
+  "wananchi",
+  "wao",
+  "wengi",
+  "hali",
+  "kati",
+  "mbalimbali",
+  "kutokana",
+  "hayo",
+  "juu",
+  "kufanya",
+  "Katika",
+  "nyingi",
+  "lugha",
+  "siku",
+  "muda",
+  "hizo",
+  "hao",
+  "mtu",
+  "kuna",
+  "alikuwa",
+  "zao",
+  "huyo",
+  "nafasi",
+  "hasa",
+  "maisha",
+  "Afrika",
+  "bila",
+  "sehemu",
+  "ambaye",
+  "watoto",
+  "mmoja",
+  "Serikali",
+  "fedha",
+  "hili",
+  "wengine",
+  "kupata",
+  "chama",
+  "baadhi",
+  "eneo",
+  "mji",
+  "Alisema",
+  "Hata",
+  "ilikuwa",
+  "wote",
+  "chini",
+  "Rais",
+  "anasema",
+  "nyingine",
+  "ajili",
+  "CCM",
+  "hicho",
+  "Baada",
+  "mambo",
+  "kutoa",
+  "Ni",
+  "Mkuu",
+  "si",
+  "huku",
+  "viongozi",
+  "kuhusu",
+  "timu",
+  "maana",
+  "hatua",
+  "nje",
+  "Mwaka",
+  "njia",
+  "elimu",
+  "zake",
+  "hivi",
+  "jana",
+  "kawaida",
+  "idadi",
+  "Dar",
+  "aina",
+  "habari",
+  "wenye",
+  "zote",
+  "muhimu",
+  "kabla",
+  "mwa",
+  "kutumia",
+  "tofauti",
+  "sheria",
+  "taifa",
+  "ambapo",
+  "mkuu",
+  "es",
+  "upande",
+  "maeneo",
+  "kwani",
+  "Lakini",
+  "hapa",
+  "maji",
+  "tena",
+  "vile",
+  "mkubwa",
+  "shule",
+  "dhidi",
+  "wakazi",
+  "jamii",
+  "bado",
+  "ambazo",
+  "Salaam",
+  "kiasi",
+  "kundi",
+  "jina",
+  "biashara",
+  "uchaguzi",
+  "mbili",
+  "uwezo",
+  "yote",
+  "leo",
+  "kupitia",
+  "mpya",
+  "ndiyo",
+  "hizi",
+  "jambo",
+  "haki",
+  "bora",
+  "hapo",
+  "Waziri",
+  "huko",
+  "kwenda",
+  "Marekani",
+  "msingi",
+  "kabisa",
+  "tangu",
+  "nguvu",
+  "maendeleo",
+  "huduma",
+  "taarifa",
+  "mwingine",
+  "Watanzania",
+  "Mungu",
+  "asilimia",
+  "haya",
+  "mtoto",
+  "Makala",
+  "Kenya",
+  "yenye",
+  "ikiwa",
+  "kura",
+  "Wakati",
+  "pili",
+  "mengi",
+  "tatu",
+  "Dk",
+  "akiwa",
+  "kipindi",
+  "vizuri",
+  "vijana",
+  "ina",
+  "kadhaa",
+  "walikuwa",
+  "karibu",
+  "ndio",
+  "Bunge",
+  "mjini",
+  "hakuna",
+  "Pia",
+  "huwa",
+  "familia",
+  "yetu",
+  "lake",
+  "mujibu",
+  "lazima",
+  "milioni",
+  "tatizo",
+  "kuliko",
+  "Taifa",
+  "Kristo",
+  "mfano",
+  "kweli",
+  "mazingira",
+  "suala",
+  "mengine",
+  "matokeo",
+  "wanafunzi",
+  "wetu",
+  "kampuni",
+  "namna",
+  "baadaye",
+  "nini",
+  "ambalo",
+  "iko",
+  "wanawake",
+  "pekee",
+  "mwisho",
+  "mfumo",
+  "matumizi",
+  "mechi",
+  "Kama",
+  "tayari",
+  "mnamo",
+  "nyumba",
+  "kiwango",
+  "duniani",
+  "wabunge",
+  "siasa",
+  "vyama",
+  "yeye",
+  "inahusu",
+  "badala",
+  "kitu",
+  "shughuli",
+  "jijini",
+  "mbele",
+  "Zanzibar",
+  "jinsi",
+  "chake",
+  "dunia",
+  "makubwa",
+  "matatizo",
+  "Anasema",
+  "bali",
+  "uchumi",
+  "wana",
+  "mbali",
+  "mpaka",
+  "Kuna",
+  "wala",
+  "sawa",
+  "bidhaa",
+  "mrefu",
+  "wachezaji",
+  "mwenye",
+  "kilimo",
+  "mama",
+  "wale",
+  "wasemaji",
+  "wiki",
+  "umma",
+  "polisi",
+  "dawa",
+  "wazi",
+  "kuanzia",
+  "klabu",
+  "fulani",
+  "Hii",
+  "chakula",
+  "basi",
+  "gani",
+  "kuhakikisha",
+  "vita",
+  "awali",
+  "Kusini",
+  "kuona",
+  "Chadema",
+  "muziki",
+  "binafsi",
+  "ana",
+  "uongozi",
+  "nyumbani",
+  "umeme",
+  "kuanza",
+  "bei",
+  "vyombo",
+  "kusema",
+  "kuu",
+  "kimataifa",
+  "sekta",
+  "yako",
+  "nao",
+  "hawa",
+  "lengo",
+  "mabadiliko",
+  "pale",
+  "kuongeza",
+  "Na",
+  "soka",
+  "2011",
+  "Kikwete",
+  "Uingereza",
+  "kidogo",
+  "uhuru",
+  "Kuu",
+  "mchezo",
+  "wilaya",
+  "inaweza",
+  "mwezi",
+  "yoyote",
+  "kwake",
+  "damu",
+  "naye",
+  "wenyewe",
+  "imehesabiwa",
+  "mafuta",
+  "umri",
+  "binadamu",
+  "Mashariki",
+  "ile",
+  "kikubwa",
+  "kuendelea",
+  "afya",
+  "Kufuatana",
+  "mafanikio",
+  "saa",
+  "kujenga",
+  "siyo",
+  "michezo",
+  "tabia",
+  "ardhi",
+  "uainishaji",
+  "changamoto",
+  "mkutano",
+  "una",
+  "kisiasa",
+  "Chama",
+  "utawala",
+  "ugonjwa",
+  "maoni",
+  "mashindano",
+  "wako",
+  "ukweli",
+  "kiongozi",
+  "kufikia",
+  "gharama",
+  "hatari",
+  "Katiba",
+  "Simba",
+  "kuingia",
+  "inayozungumzwa",
+  "taasisi",
+  "Ulaya",
+  "ndogo",
+  "ambacho",
+  "maarufu",
+  "rasmi",
+  "Mwenyekiti",
+  "mbaya",
+  "Mkoa",
+  "hoja",
+  "hiki",
+  "sensa",
+  "mdogo",
+  "simu",
+  "filamu",
+  "yaani",
+  "mkoani",
+  "nzuri",
+  "sio",
+  "ndege",
+  "walimu",
+  "miongoni",
+  "ingawa",
+  "tarehe",
+  "mkono",
+  "ambako",
+  "kesi",
+  "mali",
+  "maneno",
+  "mpango",
+  "imani",
+  "wakiwa",
+  "yangu",
+  "nne",
+  "BK",
+  "zamani",
+  "Chuo",
+  "wamekuwa",
+  "ama",
+  "rais",
+  "iliyopita",
+  "amani",
+  "soko",
+  "wakulima",
+  "nyuma",
+  "kisha",
+  "utaratibu",
+  "wangu",
+  "Katibu",
+  "mahali",
+  "sita",
+  "fursa",
+  "masuala",
+  "jumla",
+  "karibuni",
+  "wazazi",
+  "karne",
+  "mwenyewe",
+  "barabara",
+  "haraka",
+  "asili",
+  "jimbo",
+  "mamlaka",
+  "wawili",
+  "kuweka",
+  "Polisi",
+  "uamuzi",
+  "kampeni",
+  "kushindwa",
+  "Home",
+  "10",
+  "ulikuwa",
+  "wimbo",
+  "tukio",
+  "utafiti",
+  "historia",
+  "kamati",
+  "kodi",
+  "kusababisha",
+  "dini",
+  "Watu",
+  "mkoa",
+  "2007",
+  "kupunguza",
+  "wanachama",
+  "imekuwa",
+  "Wilaya",
+  "Kamati",
+  "kujua",
+  "ndoa",
+  "ambavyo",
+  "kucheza",
+  "Kiswahili",
+  "wafanyakazi",
+  "baba",
+  "Aidha",
+  "masomo",
+  "Stars",
+  "kituo",
+  "ujenzi",
+  "2008",
+  "upinzani",
+  "mwili",
+  "ofisi",
+  "Arusha",
+  "kulingana",
+  "katiba",
+  "Hivyo",
+  "vitu",
+  "kina",
+  "Kanisa",
+  "Mbunge",
+  "kutosha",
+  "Mji",
+  "sifa",
+  "Yanga",
+  "ushindi",
+  "Jamhuri",
+  "ule",
+  "unaweza",
+  "rangi",
+  "huyu",
+  "Habari",
+  "kuchukua",
+  "vifaa",
+  "Kati",
+  "jeshi",
+  "moyo",
+  "ndugu",
+  "ajira",
+  "shirika",
+  "mwanamke",
+  "kiuchumi",
+  "kifo",
+  "juzi",
+  "kutafuta",
+  "aliyekuwa",
+  "kauli",
+  "kuishi",
+  "picha",
+  "anaweza",
+  "kile",
+  "rushwa",
+  "mikoa",
+  "viwanda",
+  "wasanii",
+  "kupiga",
+  "zetu",
+  "kanuni",
+  "Nyerere",
+  "husika",
+  "albamu",
+  "nyimbo",
+  "Mara",
+  "Pamoja",
+  "matibabu",
+  "kwao",
+  "mradi",
+  "bajeti",
+  "maalumu",
+  "mkataba",
+  "Hali",
+  "kutaka",
+  "madai",
+  "usiku",
+  "2006",
+  "kushiriki",
+  "ndiye",
+  "hawana",
+  "mbinu",
+  "sahihi",
+  "wapo",
+  "akili",
+  "faida",
+  "raia",
+  "wanyama",
+  "20",
+  "Kutokana",
+  "halisi",
+  "dola",
+  "walio",
+  "Uchaguzi",
+  "Umoja",
+  "ngazi",
+  "vitendo",
+  "wanaoishi",
+  "askari",
+  "mchakato",
+  "safari",
+  "kuwepo",
+  "uhusiano",
+  "ujumla",
+  "lilikuwa",
+  "Baadhi",
+  "msaada",
+  "wanaweza",
+  "waandishi",
+  "mapema",
+  "makundi",
+  "msimu",
+  "moto",
+  "kuleta",
+  "gari",
+  "kusini",
+  "magari",
+  "2005",
+  "dalili",
+  "mimi",
+  "umuhimu",
+  "licha",
+  "wadau",
+  "waliokuwa",
+  "utamaduni",
+  "The",
+  "2010",
+  "Kikuu",
+  "tano",
+  "taratibu",
+  "Ligi",
+  "mahitaji",
+  "usalama",
+  "bungeni",
+  "saba",
+  "chuo",
+  "2009",
+  "mafunzo",
+  "Ujerumani",
+  "Mkurugenzi",
+  "Mwalimu",
+  "kasi",
+  "miezi",
+  "Uganda",
+  "sera",
+  "Nigeria",
+  "itakuwa",
+  "rahisi",
+  "nayo",
+  "mahakama",
+  "sisi",
+  "2000",
+  "Shirika",
+  "mapato",
+  "uwanja",
+  "dakika",
+  "kali",
+  "gazeti",
+  "mingi",
+  "Desemba",
+  "Tangu",
+  "malengo",
+  "zenye",
+  "Oktoba",
+  "vingi",
+  "matukio",
+  "kusoma",
+  "yale",
+  "fainali",
+  "kuanzisha",
+  "neno",
+  "kitaifa",
+  "wanaume",
+  "Hivi",
+  "sauti",
+  "mzuri",
+  "humo",
+  "kocha",
+  "Kiingereza",
+  "nia",
+  "wajibu",
+  "mto",
+  "Akizungumza",
+  "kuzuia",
+  "chanzo",
+  "mipango",
+  "wapatao",
+  "Idadi",
+  "thamani",
+  "bilioni",
+  "ndipo",
+  "wafanyabiashara",
+  "Je",
+  "kukosa",
+  "kijamii",
+  "kisasa",
+  "Januari",
+  "Sheria",
+  "iliyofanyika",
+  "Baraza",
+  "ilivyo",
+  "ligi",
+  "majina",
+  "gesi",
+  "maslahi",
+  "rasilimali",
+  "John",
+  "mgombea",
+  "uchunguzi",
+  "wewe",
+  "Kila",
+  "uzalishaji",
+  "kumi",
+  "mazao",
+  "kusaidia",
+  "mashabiki",
+  "mchezaji",
+  "mahakamani",
+  "kijiji",
+  "maalum",
+  "mbunge",
+  "Profesa",
+  "takriban",
+  "vituo",
+  "hewa",
+  "ila",
+  "namba",
+  "miradi",
+  "kaskazini",
+  "huru",
+  "athari",
+  "kisheria",
+  "mwanzo",
+  "nani",
+  "mfupi",
+  "kutekeleza",
+  "mawazo",
+  "vyema",
+  "wadogo",
+  "kuboresha",
+  "Dodoma",
+  "wachache",
+  "heshima",
+  "vingine",
+  "Novemba",
+  "pesa",
+  "kutengeneza",
+  "kuonyesha",
+  "kushinda",
+  "uhakika",
+  "kutokea",
+  "miwili",
+  "kikao",
+  "kuangalia",
+  "of",
+  "bao",
+  "vitabu",
+  "viwango",
+  "maadili",
+  "yeyote",
+  "ajali",
+  "mataifa",
+  "Muungano",
+  "Jeshi",
+  "1",
+  "Kaskazini",
+  "mabao",
+  "TFF",
+  "maelezo",
+  "Kiniger-Kongo",
+  "benki",
+  "Kibantu",
+  "urais",
+  "kufika",
+  "Wizara",
+  "lenye",
+  "12",
+  "kuandika",
+  "15",
+  "juhudi",
+  "Nchi",
+  "kata",
+  "mawili",
+  "shaka",
+  "kote",
+  "Jina",
+  "makini",
+  "nusu",
+  "mtandao",
+  "umoja",
+  "wenzake",
+  "Sasa",
+  "amekuwa",
+  "Shule",
+  "kuuza",
+  "mazuri",
+  "zile",
+  "makuu",
+  "wowote",
+  "30",
+  "China",
+  "madini",
+  "Septemba",
+  "Kampuni",
+  "Kwanza",
+  "madaraka",
+  "wapi",
+  "Mahakama",
+  "nzima",
+  "CUF",
+  "wataalamu",
+  "hospitali",
+  "Uwanja",
+  "kumaliza",
+  "2",
+  "haina",
+  "mvua",
+  "kuacha",
+  "Ingawa",
+  "utekelezaji",
+  "miji",
+  "Siku",
+  "Dunia",
+  "mawasiliano",
+  "vyuo",
+  "upya",
+  "halafu",
+  "jukumu",
+  "barua",
+  "chache",
+  "maamuzi",
+  "vyote",
+  "Yesu",
+  "makosa",
+  "kitabu",
+  "kitendo",
+  "uwezekano",
+  "kikosi",
+  "kununua",
+  "Agosti",
+  "KK",
+  "michuano",
+  "sekondari",
+  "kukaa",
+  "wagombea",
+  "50",
+  "Juni",
+  "ujumbe",
+  "majukumu",
+  "baina",
+  "wakubwa",
+  "kikuu",
+  "Ufaransa",
+  "kinyume",
+  "yalikuwa",
+  "kutambua",
+  "magonjwa",
+  "makazi",
+  "madhara",
+  "Julai",
+  "iwe",
+  "madarakani",
+  "maandalizi",
+  "mke",
+  "mno",
+  "ikiwemo",
+  "joto",
+  "makala",
+  "ulinzi",
+  "mimba",
+  "silaha",
+  "yule",
+  "mfalme",
+  "wingi",
+  "wizara",
+  "mazoezi",
+  "Jumapili",
+  "macho",
+  "Ethiopia",
+  "kutumika",
+  "wajumbe",
+  "haja",
+  "vurugu",
+  "kusimamia",
+  "meli",
+  "hatimaye",
+  "kuonekana",
+  "zina",
+  "kujiunga",
+  "watumishi",
+  "Maendeleo",
+  "kuunda",
+  "hana",
+  "kupewa",
+  "kuzingatia",
+  "kuondoa",
+  "Aprili",
+  "Hakuna",
+  "misingi",
+  "Jimbo",
+  "Sudan",
+  "bahari",
+  "ngozi",
+  "tuzo",
+  "waziri",
+  "kuendeleza",
+  "lao",
+  "mitatu",
+  "wagonjwa",
+  "iwapo",
+  "mauaji",
+  "makao",
+  "Kombe",
+  "Mtwara",
+  "wilayani",
+  "kimoja",
+  "magharibi",
+  "mapenzi",
+  "ushahidi",
+  "alama",
+  "mshindi",
+  "nyota",
+  "zilikuwa",
+  "kosa",
+  "wanasiasa",
+  "chochote",
+  "jirani",
+  "kanisa",
+  "kurudi",
+  "letu",
+  "ngumu",
+  "utendaji",
+  "Kilimanjaro",
+  "Yeye",
+  "Shirikisho",
+  "akisema",
+  "kulikuwa",
+  "2002",
+  "kuwapa",
+  "zinaweza",
+  "kijijini",
+  "maswali",
+  "ushirikiano",
+  "Elimu",
+  "Machi",
+  "Tume",
+  "ahadi",
+  "kuelekea",
+  "ubora",
+  "yenyewe",
+  "maambukizi",
+  "Misri",
+  "Mapinduzi",
+  "lolote",
+  "watendaji",
+  "asubuhi",
+  "pengine",
+  "Bara",
+  "alitoa",
+  "halmashauri",
+  "lina",
+  "mwalimu",
+  "kike",
+  "siri",
+  "Mwanza",
+  "kujifunza",
+  "kuendesha",
+  "kulipa",
+  "CHADEMA",
+  "kula",
+  "Michezo",
+  "kupanda",
+  "Magharibi",
+  "mpira",
+  "vijijini",
+  "kijana",
+  "kamili",
+  "kupambana",
+  "zingine",
+  "iliyokuwa",
+  "kukabiliana",
+  "bara",
+  "ipo",
+  "sanaa",
+  "wakuu",
+  "amesema",
+  "mfululizo",
+  "11",
+  "katikati",
+  "mashirika",
+  "3",
+  "kufanyika",
+  "Slaa",
+  "huenda",
+  "kushirikiana",
+  "Mataifa",
+  "kesho",
+  "mashariki",
+  "wateja",
+  "mzima",
+  "ongezeko",
+  "18",
+  "msimamo",
+  "mwandishi",
+  "Mnamo",
+  "kuweza",
+  "dhana",
+  "Spika",
+  "vibaya",
+  "hisia",
+  "Naye",
+  "mikakati",
+  "Igunga",
+  "kipato",
+  "kupokea",
+  "bahati",
+  "Mbali",
+  "chombo",
+  "tiba",
+  "kufuata",
+  "kuamua",
+  "wastani",
+  "ubunge",
+  "United",
+  "100",
+  "mita",
+  "mwenyekiti",
+  "shida",
+  "watatu",
+  "Dola",
+  "pande",
+  "usafiri",
+  "Mei",
+  "Jaji",
+};
+const uint16_t WA_FREQ_157_RANKS[] = {
+  711, 0, 312, 0, 0, 0, 0, 0, 0, 0, 0, 476, 304, 689, 0, 161,
+  1000, 309, 0, 0, 391, 880, 0, 915, 0, 784, 0, 0, 0, 0, 991, 11,
+  0, 0, 647, 659, 851, 874, 81, 624, 982, 0, 0, 661, 0, 0, 0, 320,
+  562, 229, 0, 833, 821, 837, 655, 632, 935, 0, 0, 360, 550, 0, 0, 0,
+  0, 188, 40, 219, 454, 660, 942, 0, 0, 208, 0, 0, 0, 0, 0, 772,
+  963, 0, 0, 0, 84, 793, 0, 0, 226, 0, 0, 0, 0, 0, 0, 0,
+  993, 0, 488, 0, 0, 969, 0, 0, 611, 0, 934, 0, 0, 506, 187, 175,
+  0, 0, 159, 0, 548, 0, 612, 0, 0, 290, 0, 422, 733, 0, 310, 252,
+  742, 0, 0, 0, 0, 0, 347, 0, 300, 367, 0, 0, 0, 0, 0, 0,
+  0, 77, 0, 0, 0, 89, 0, 610, 649, 199, 600, 0, 0, 528, 0, 0,
+  0, 0, 0, 783, 0, 0, 0, 0, 438, 0, 0, 0, 0, 29, 849, 221,
+  986, 374, 552, 464, 778, 0, 52, 435, 99, 0, 359, 0, 172, 953, 0, 593,
+  693, 0, 0, 0, 994, 0, 0, 0, 0, 0, 0, 0, 106, 650, 0, 365,
+  0, 0, 751, 0, 800, 0, 0, 0, 0, 0, 807, 358, 572, 922, 0, 0,
+  567, 0, 0, 819, 503, 0, 0, 20, 361, 0, 176, 0, 0, 667, 0, 0,
+  524, 831, 0, 83, 0, 0, 0, 749, 243, 74, 0, 0, 0, 273, 0, 0,
+  0, 421, 0, 485, 0, 0, 0, 0, 22, 151, 261, 379, 951, 0, 0, 0,
+  691, 298, 0, 0, 0, 177, 0, 0, 965, 680, 738, 250, 306, 919, 989, 0,
+  481, 920, 0, 0, 0, 0, 0, 0, 855, 0, 0, 376, 753, 0, 196, 201,
+  137, 385, 0, 637, 0, 884, 0, 0, 0, 881, 164, 0, 3, 0, 0, 0,
+  0, 0, 0, 0, 0, 487, 683, 0, 0, 0, 0, 0, 847, 719, 857, 325,
+  575, 695, 163, 758, 722, 498, 712, 809, 607, 0, 0, 0, 856, 0, 56, 779,
+  0, 770, 0, 0, 0, 0, 0, 0, 0, 0, 629, 795, 0, 51, 670, 792,
+  0, 0, 0, 450, 0, 0, 0, 232, 808, 927, 0, 664, 276, 0, 0, 198,
+  372, 0, 836, 0, 0, 0, 93, 182, 508, 263, 589, 798, 470, 0, 0, 274,
+  499, 0, 319, 0, 0, 305, 256, 12, 393, 812, 413, 200, 864, 91, 609, 997,
+  0, 829, 0, 0, 652, 0, 672, 0, 166, 0, 891, 546, 0, 895, 0, 0,
+  512, 926, 0, 954, 67, 132, 331, 297, 449, 479, 0, 862, 7, 0, 382, 381,
+  0, 0, 139, 713, 636, 665, 940, 583, 752, 0, 0, 0, 461, 561, 10, 158,
+  598, 0, 0, 0, 734, 0, 0, 0, 0, 917, 0, 0, 0, 0, 254, 348,
+  591, 976, 590, 0, 651, 623, 0, 0, 0, 0, 0, 892, 0, 336, 397, 96,
+  540, 0, 103, 578, 0, 921, 0, 0, 0, 585, 516, 342, 775, 0, 791, 0,
+  443, 496, 0, 332, 0, 417, 967, 0, 0, 0, 0, 526, 0, 0, 0, 918,
+  0, 350, 690, 322, 0, 0, 0, 560, 843, 0, 0, 0, 64, 971, 248, 671,
+  13, 0, 0, 0, 754, 0, 0, 202, 86, 739, 0, 0, 121, 0, 335, 0,
+  869, 0, 0, 945, 0, 0, 0, 66, 313, 79, 456, 995, 0, 437, 0, 482,
+  998, 0, 0, 0, 0, 0, 0, 0, 510, 0, 0, 228, 653, 0, 0, 0,
+  238, 0, 241, 465, 497, 520, 0, 0, 0, 65, 112, 0, 0, 725, 627, 543,
+  987, 656, 0, 0, 120, 0, 330, 606, 741, 0, 0, 0, 0, 355, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 529, 17, 0, 170, 756,
+  0, 403, 0, 0, 0, 648, 155, 569, 0, 0, 352, 500, 0, 0, 0, 0,
+  406, 0, 0, 0, 0, 130, 162, 658, 0, 45, 0, 0, 0, 0, 16, 475,
+  0, 0, 0, 979, 2, 411, 905, 211, 0, 242, 0, 0, 0, 0, 0, 0,
+  786, 804, 0, 0, 97, 0, 247, 602, 178, 684, 323, 0, 384, 0, 698, 0,
+  119, 596, 203, 750, 0, 0, 832, 0, 0, 923, 0, 104, 654, 0, 0, 723,
+  0, 949, 507, 0, 0, 285, 0, 0, 0, 0, 0, 224, 0, 0, 0, 251,
+  673, 0, 0, 0, 316, 0, 0, 509, 0, 0, 0, 576, 551, 746, 536, 859,
+  194, 0, 55, 950, 0, 0, 0, 0, 0, 34, 732, 0, 0, 0, 0, 278,
+  0, 531, 0, 0, 0, 0, 747, 558, 827, 0, 0, 885, 0, 255, 554, 789,
+  0, 588, 0, 0, 105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  39, 0, 0, 0, 118, 210, 315, 688, 842, 622, 0, 439, 907, 0, 0, 0,
+  0, 0, 0, 32, 0, 0, 0, 0, 0, 218, 657, 766, 900, 981, 53, 0,
+  407, 0, 0, 448, 0, 0, 0, 0, 0, 31, 463, 502, 555, 153, 505, 676,
+  18, 15, 519, 977, 135, 839, 0, 0, 245, 0, 687, 0, 495, 0, 0, 59,
+  0, 894, 0, 0, 958, 961, 701, 0, 436, 619, 999, 0, 0, 389, 0, 635,
+  0, 0, 0, 790, 844, 662, 0, 0, 0, 0, 0, 966, 49, 788, 480, 813,
+  692, 947, 0, 0, 171, 271, 356, 216, 570, 805, 0, 0, 427, 0, 0, 197,
+  0, 87, 0, 0, 0, 727, 223, 616, 886, 0, 0, 0, 287, 0, 834, 0,
+  0, 0, 258, 78, 729, 771, 193, 909, 0, 308, 0, 0, 76, 0, 0, 318,
+  333, 131, 404, 773, 668, 984, 0, 0, 0, 0, 710, 259, 444, 246, 0, 762,
+  0, 0, 618, 0, 556, 0, 184, 115, 453, 0, 398, 0, 0, 0, 533, 0,
+  943, 0, 577, 581, 168, 0, 743, 0, 0, 36, 767, 0, 814, 0, 794, 0,
+  944, 0, 937, 236, 0, 190, 614, 82, 0, 0, 703, 815, 0, 63, 354, 669,
+  704, 957, 396, 0, 275, 0, 0, 0, 0, 0, 897, 0, 0, 195, 409, 0,
+  0, 0, 206, 893, 0, 0, 0, 138, 73, 863, 289, 902, 262, 292, 875, 845,
+  0, 0, 0, 835, 0, 0, 0, 0, 0, 492, 717, 565, 0, 0, 860, 956,
+  173, 538, 0, 62, 838, 0, 0, 0, 549, 445, 579, 0, 0, 796, 0, 0,
+  0, 9, 0, 458, 720, 0, 0, 0, 0, 806, 0, 0, 0, 0, 143, 222,
+  375, 0, 0, 0, 0, 0, 0, 0, 225, 0, 288, 75, 645, 745, 911, 0,
+  0, 326, 307, 472, 933, 748, 0, 0, 0, 0, 0, 0, 0, 0, 0, 80,
+  0, 0, 217, 268, 113, 394, 799, 0, 663, 721, 678, 0, 0, 25, 0, 0,
+  876, 0, 0, 169, 50, 183, 220, 293, 709, 841, 0, 282, 459, 0, 0, 865,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 735, 6, 214, 457,
+  0, 0, 0, 0, 679, 666, 0, 714, 968, 539, 303, 938, 0, 0, 0, 0,
+  0, 0, 0, 260, 405, 0, 493, 620, 697, 98, 755, 0, 147, 0, 133, 822,
+  0, 0, 167, 0, 494, 0, 0, 0, 0, 144, 0, 0, 0, 0, 215, 204,
+  866, 0, 625, 363, 0, 0, 916, 0, 910, 913, 0, 0, 0, 469, 0, 0,
+  0, 295, 0, 0, 0, 0, 0, 0, 682, 0, 0, 768, 929, 0, 634, 744,
+  474, 0, 0, 0, 0, 0, 0, 595, 0, 0, 0, 0, 341, 867, 114, 0,
+  0, 0, 0, 0, 0, 820, 0, 134, 0, 0, 0, 0, 35, 441, 0, 0,
+  0, 122, 249, 0, 0, 0, 0, 109, 180, 0, 0, 0, 0, 0, 0, 0,
+  370, 387, 0, 0, 759, 416, 0, 0, 811, 415, 0, 392, 535, 0, 334, 0,
+  0, 27, 240, 38, 573, 871, 302, 58, 239, 599, 0, 152, 0, 468, 0, 0,
+  371, 0, 0, 0, 0, 378, 124, 324, 534, 677, 88, 906, 928, 434, 0, 0,
+  0, 0, 854, 0, 0, 0, 0, 0, 189, 0, 426, 826, 0, 0, 0, 0,
+  400, 890, 0, 0, 0, 705, 0, 522, 46, 0, 0, 0, 0, 0, 0, 781,
+  0, 44, 192, 0, 889, 0, 0, 70, 265, 345, 700, 0, 337, 0, 924, 0,
+  0, 706, 0, 640, 0, 0, 0, 0, 402, 0, 0, 853, 0, 0, 0, 0,
+  0, 0, 0, 277, 0, 0, 517, 817, 868, 580, 490, 0, 547, 0, 0, 731,
+  828, 675, 0, 532, 0, 761, 0, 870, 0, 0, 0, 0, 0, 0, 0, 0,
+  707, 978, 0, 366, 617, 0, 0, 486, 824, 0, 0, 0, 0, 941, 299, 283,
+  145, 296, 460, 489, 621, 212, 0, 267, 0, 338, 280, 810, 48, 925, 0, 644,
+  0, 0, 0, 0, 0, 615, 0, 54, 0, 0, 0, 4, 0, 521, 764, 0,
+  0, 446, 0, 0, 545, 0, 339, 0, 0, 0, 0, 0, 484, 0, 0, 0,
+  279, 0, 419, 478, 718, 0, 0, 26, 179, 85, 626, 0, 467, 0, 0, 266,
+  0, 383, 0, 0, 69, 425, 0, 0, 0, 0, 0, 848, 0, 0, 0, 0,
+  0, 0, 362, 141, 638, 642, 930, 541, 972, 0, 42, 101, 235, 639, 803, 269,
+  0, 0, 451, 757, 0, 959, 0, 373, 471, 980, 0, 0, 0, 737, 386, 932,
+  244, 990, 0, 582, 0, 542, 983, 873, 432, 936, 0, 0, 0, 185, 154, 0,
+  28, 428, 264, 641, 964, 0, 0, 0, 715, 740, 68, 774, 908, 0, 872, 0,
+  0, 0, 628, 566, 0, 329, 0, 0, 0, 571, 314, 559, 699, 0, 0, 110,
+  233, 0, 23, 852, 797, 948, 960, 160, 0, 0, 846, 420, 996, 165, 0, 0,
+  0, 0, 970, 0, 0, 455, 0, 0, 0, 988, 0, 0, 0, 0, 0, 818,
+  0, 736, 0, 0, 0, 0, 410, 696, 0, 0, 0, 95, 126, 0, 0, 888,
+  0, 0, 0, 0, 0, 537, 564, 0, 433, 523, 0, 47, 0, 685, 0, 702,
+  769, 511, 311, 213, 107, 861, 111, 209, 514, 57, 896, 904, 0, 237, 0, 30,
+  181, 823, 0, 0, 530, 399, 518, 0, 0, 321, 0, 0, 0, 0, 0, 0,
+  0, 858, 0, 0, 0, 0, 0, 71, 592, 780, 0, 424, 0, 0, 43, 0,
+  0, 327, 234, 0, 0, 0, 0, 0, 0, 0, 0, 501, 0, 0, 0, 0,
+  0, 351, 0, 0, 0, 0, 90, 388, 887, 21, 0, 840, 0, 0, 61, 140,
+  0, 0, 390, 901, 0, 1, 0, 0, 0, 0, 879, 782, 19, 150, 462, 230,
+  0, 0, 0, 0, 466, 0, 802, 0, 0, 156, 0, 0, 0, 630, 726, 643,
+  423, 301, 343, 129, 0, 0, 317, 447, 477, 553, 0, 357, 0, 0, 0, 0,
+  0, 816, 0, 207, 0, 429, 0, 0, 974, 5, 0, 0, 0, 504, 513, 568,
+  0, 633, 0, 850, 0, 716, 0, 0, 785, 0, 0, 0, 603, 37, 601, 830,
+  973, 0, 0, 557, 380, 574, 418, 0, 349, 515, 0, 0, 344, 674, 24, 401,
+  730, 608, 0, 102, 604, 0, 0, 0, 0, 0, 473, 0, 284, 294, 0, 0,
+  231, 0, 0, 646, 205, 0, 0, 286, 346, 0, 0, 587, 776, 408, 0, 0,
+  903, 92, 0, 0, 291, 777, 992, 0, 825, 0, 0, 0, 985, 0, 0, 0,
+  0, 0, 882, 369, 442, 0, 631, 0, 0, 0, 8, 801, 0, 0, 72, 0,
+  0, 0, 0, 0, 0, 0, 728, 0, 0, 33, 41, 586, 946, 584, 0, 128,
+  898, 0, 227, 148, 525, 544, 912, 975, 0, 0, 694, 883, 368, 414, 0, 0,
+  0, 0, 127, 431, 100, 117, 174, 281, 681, 760, 395, 440, 0, 0, 0, 0,
+  899, 257, 353, 605, 877, 0, 686, 952, 0, 0, 0, 0, 527, 0, 0, 0,
+  191, 914, 270, 186, 253, 939, 931, 116, 955, 0, 0, 0, 125, 108, 340, 430,
+  0, 136, 0, 597, 412, 0, 0, 594, 0, 765, 0, 0, 0, 0, 0, 763,
+  613, 787, 0, 0, 0, 452, 0, 377, 0, 0, 14, 123, 149, 364, 142, 483,
+  328, 563, 708, 878, 94, 724, 0, 60, 0, 0, 146, 157, 962, 0, 491, 272,
+};
+
+const char *WA_FREQ_158_TOKENS[] = {
+  "to",
+  "niy",
+  "spuchła",
+  "mu",
+  "gymba",
+  "wszyjsko",
+  "mŏ",
+  "synsu",
+  "jego",
+  "auto",
+  "bōło",
+  "bezma",
+  "naprawione",
+  "dziołcha",
+  "skŏkŏ",
+  "tomowi",
+  "ma",
+  "strach",
+  "zrobić",
+  "zaś",
+  "przeczytej",
+  "te",
+  "dwa",
+  "zace",
+  "napij",
+  "sie",
+  "zy",
+  "mnōm",
+  "podwiela",
+  "żech",
+  "sam",
+  "je",
+  "ty",
+  "biygŏsz",
+  "ale",
+  "gibko",
+  "ze",
+  "kapsy",
+  "ci",
+  "blajsztyft",
+  "wystaje",
+  "szczyrknij",
+  "ku",
+  "mie",
+};
+const uint16_t WA_FREQ_158_RANKS[] = {
+  0, 22, 0, 0, 0, 0, 0, 4, 0, 0, 0, 23, 3, 25, 0, 5,
+  8, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0,
+  44, 30, 0, 0, 0, 0, 0, 0, 15, 34, 13, 0, 0, 0, 0, 0,
+  38, 0, 0, 19, 0, 0, 0, 0, 24, 0, 0, 0, 36, 14, 0, 0,
+  0, 0, 0, 29, 20, 37, 0, 0, 0, 6, 0, 1, 0, 0, 0, 33,
+  42, 0, 0, 21, 0, 0, 0, 43, 12, 9, 0, 0, 0, 0, 0, 31,
+  2, 35, 0, 18, 0, 28, 32, 10, 39, 27, 0, 0, 16, 40, 0, 0,
+  0, 0, 11, 0, 26, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 0,
+};
+
+const char *WA_FREQ_159_TOKENS[] = {
+  "ª",
+  "元",
+  "ஒரு",
+  "என்று",
+  "இந்த",
+  "மற்றும்",
+  "என்ற",
+  "வேண்டும்",
+  "இது",
+  "அவர்",
+  "அந்த",
+  "முதல்",
+  "தான்",
+  "என",
+  "ஆனால்",
+  "நான்",
+  "கொண்டு",
+  "பல",
+  "உள்ள",
+  "என்பது",
+  "அது",
+  "இருக்கும்",
+  "சில",
+  "இருந்து",
+  "இல்லை",
+  "உள்ளது",
+  "என்",
+  "விலை",
+  "செய்து",
+  "மேலும்",
+  "இருந்தது",
+  "வரும்",
+  "போது",
+  "மக்கள்",
+  "வந்து",
+  "நாள்",
+  "அல்லது",
+  "அரசு",
+  "இந்திய",
+  "வரை",
+  "கடந்த",
+  "இன்று",
+  "அவர்கள்",
+  "என்ன",
+  "அவன்",
+  "கோடி",
+  "தன்",
+  "ஆண்டு",
+  "மூலம்",
+  "அதன்",
+  "சென்னை",
+  "இரண்டு",
+  "புதிய",
+  "போன்ற",
+  "செய்த",
+  "தமிழ்",
+  "என்றும்",
+  "கூட",
+  "செய்ய",
+  "தொடர்ந்து",
+  "எந்த",
+  "பதிவு",
+  "தனது",
+  "இருந்த",
+  "IST",
+  "வருகிறது",
+  "மீது",
+  "எனக்கு",
+  "மத்திய",
+  "அவரது",
+  "சதவீதம்",
+  "பெரிய",
+  "பற்றி",
+  "ரூபாய்",
+  "இதில்",
+  "மட்டும்",
+  "வந்த",
+  "இருக்கிறது",
+  "மிகவும்",
+  "அவள்",
+  "நல்ல",
+  "நாம்",
+  "பிறகு",
+  "கொண்ட",
+  "போல",
+  "தலைவர்",
+  "இன்னும்",
+  "இதன்",
+  "அதை",
+  "ஆகும்",
+  "பக்கம்",
+  "குறித்து",
+  "பின்னர்",
+  "இதனால்",
+  "மட்டுமே",
+  "இவர்",
+  "சென்று",
+  "விட்டு",
+  "மீண்டும்",
+  "நேற்று",
+  "சேர்ந்த",
+  "தற்போது",
+  "முடியும்",
+  "வேலை",
+  "நிறுவனம்",
+  "நிலையில்",
+  "ஒன்று",
+  "ஆம்",
+  "வேறு",
+  "பின்",
+  "அளவில்",
+  "பேர்",
+  "மூன்று",
+  "விற்பனை",
+  "விட",
+  "எல்லாம்",
+  "லட்சம்",
+  "போல்",
+  "ஒரே",
+  "இப்போது",
+  "அடுத்த",
+  "2",
+  "உள்ளன",
+  "மிக",
+  "என்பதை",
+  "நேரம்",
+  "பல்வேறு",
+  "உற்பத்தி",
+  "முன்",
+  "அதிக",
+  "ஆகிய",
+  "வைத்து",
+  "எனவே",
+  "இங்கு",
+  "அதில்",
+  "நீ",
+  "அரசியல்",
+  "முடியாது",
+  "அதே",
+  "ஒவ்வொரு",
+  "இடம்",
+  "உண்டு",
+  "செய்தி",
+  "எப்படி",
+  "என்னும்",
+  "வகையில்",
+  "இந்தியா",
+  "முறை",
+  "மணி",
+  "வந்தது",
+  "நீங்கள்",
+  "காலத்தில்",
+  "நம்",
+  "சென்ற",
+  "அப்போது",
+  "காரணம்",
+  "பெண்",
+  "3",
+  "ஆயிரம்",
+  "தினமலர்",
+  "நிலை",
+  "தேதி",
+  "கொள்ள",
+  "மேல்",
+  "என்றார்",
+  "10",
+  "காரணமாக",
+  "என்றால்",
+  "இருக்க",
+  "செய்யும்",
+  "பெயர்",
+  "அங்கு",
+  "மும்பை",
+  "இரு",
+  "இதை",
+  "போய்",
+  "பங்கு",
+  "மாதம்",
+  "ஏன்",
+  "ஒருவர்",
+  "வெற்றி",
+  "அதற்கு",
+  "பகுதியில்",
+  "போலீசார்",
+  "கலந்து",
+  "இப்படி",
+  "பெரும்",
+  "முக்கிய",
+  "உங்கள்",
+  "உலக",
+  "பற்றிய",
+  "இலங்கை",
+  "அறிவிப்புகள்",
+  "அனைத்து",
+  "எடுத்து",
+  "சமையல்இலக்கியக்கட்டுரைகள்நகைச்சுவையும்",
+  "வித்தியாசமானவையும்கடிதங்கள்",
+  "காலை",
+  "முடிவு",
+  "இதற்கு",
+  "இந்தியாவில்",
+  "முதலில்",
+  "தமிழக",
+  "மற்ற",
+  "5",
+  "நிதி",
+  "வயது",
+  "பெற்ற",
+  "அமைச்சர்",
+  "என்னை",
+  "புள்ளிகள்",
+  "எல்லா",
+  "இந்தப்",
+  "தேசிய",
+  "பார்த்து",
+  "நாட்டின்",
+  "தங்கள்",
+  "அமெரிக்க",
+  "இதே",
+  "தவிர",
+  "ஓர்",
+  "வேண்டிய",
+  "காங்கிரஸ்",
+  "எம்",
+  "தொழில்",
+  "உள்ளிட்ட",
+  "பெண்கள்",
+  "கட்சி",
+  "கிடைக்கும்",
+  "2009",
+  "அவருக்கு",
+  "அதிகம்",
+  "மாதிரி",
+  "விட்டது",
+  "அணி",
+  "இல்",
+  "PM",
+  "மாவட்ட",
+  "காலம்",
+  "20",
+  "வளர்ச்சி",
+  "கைது",
+  "சொல்லி",
+  "இடத்தில்",
+  "நடந்த",
+  "சுமார்",
+  "தெரிவித்தார்",
+  "முழுவதும்",
+  "பணம்",
+  "தகவல்",
+  "நேரத்தில்",
+  "துறை",
+  "கொஞ்சம்",
+  "4",
+  "அவை",
+  "படம்",
+  "எண்ணெய்",
+  "இவர்கள்",
+  "அல்ல",
+  "நடந்து",
+  "சொல்ல",
+  "அம்மா",
+  "ஆண்டில்",
+  "வீட்டில்",
+  "இல்லாமல்",
+  "இந்தியாவின்",
+  "அவரை",
+  "அருகே",
+  "கார்",
+  "இவை",
+  "இருந்தாலும்",
+  "அன்று",
+  "நிறுவனங்கள்",
+  "நான்கு",
+  "பதில்",
+  "கருத்து",
+  "வருகின்றனர்",
+  "தேர்தல்",
+  "அப்படி",
+  "யார்",
+  "இந்தக்",
+  "பி",
+  "டி",
+  "இவ்வாறு",
+  "வங்கி",
+  "கூறினார்",
+  "அதனால்",
+  "பகுதி",
+  "எனது",
+  "போட்டு",
+  "அதிகரித்து",
+  "வெளியே",
+  "பார்க்க",
+  "பிரதமர்",
+  "எஸ்",
+  "கண்டு",
+  "உடல்",
+  "நடவடிக்கை",
+  "அளவு",
+  "கதை",
+  "நாங்கள்",
+  "அந்தப்",
+  "சந்தையில்",
+  "உன்",
+  "சரி",
+  "வீடு",
+  "சிறந்த",
+  "வந்தார்",
+  "ஆக",
+  "ஏற்படும்",
+  "செல்லும்",
+  "கோயில்",
+  "பெற்று",
+  "என்கிற",
+  "பாதுகாப்பு",
+  "ஏற்றுமதி",
+  "மாதத்தில்",
+  "இல்லாத",
+  "சிறப்பு",
+  "சிறு",
+  "முறையில்",
+  "1",
+  "ஏதோ",
+  "மக்களின்",
+  "புதுடில்லி",
+  "ஐந்து",
+  "எங்கள்",
+  "மனித",
+  "குறைந்து",
+  "இரவு",
+  "சந்தை",
+  "தேவை",
+  "மனம்",
+  "சர்வதேச",
+  "தி",
+  "பொருள்",
+  "பொது",
+  "கொடுத்து",
+  "அடிப்படையில்",
+  "இன்னொரு",
+  "மாநில",
+  "ஆறு",
+  "மனைவி",
+  "கல்வி",
+  "இதுவரை",
+  "உணவு",
+  "மாலை",
+  "நமது",
+  "செயலாளர்",
+  "15",
+  "சிறிய",
+  "குறிப்பிடத்தக்கது",
+  "அந்தக்",
+  "இன்றைய",
+  "தலைமை",
+  "இருந்தால்",
+  "6",
+  "இடங்களில்",
+  "நாடு",
+  "குறித்த",
+  "விசாரணை",
+  "போலீஸ்",
+  "வழி",
+  "ஆயிரத்து",
+  "கிலோ",
+  "இதனை",
+  "சார்பில்",
+  "ஏற்கனவே",
+  "மின்",
+  "நிறுவனத்தின்",
+  "ஆகியோர்",
+  "வர",
+  "எதுவும்",
+  "பொருளாதார",
+  "முதல்வர்",
+  "உள்ளே",
+  "நாட்டில்",
+  "30",
+  "நீர்",
+  "எனினும்",
+  "அவருடைய",
+  "இங்கே",
+  "இந்நிலையில்",
+  "முன்பு",
+  "கடன்",
+  "பிற",
+  "குழந்தை",
+  "தெரியும்",
+  "உடனே",
+  "திருமணம்",
+  "பழைய",
+  "அதாவது",
+  "துணை",
+  "அவர்களின்",
+  "தண்ணீர்",
+  "நின்று",
+  "தொடர்பாக",
+  "போதும்",
+  "விமான",
+  "எனும்",
+  "மே",
+  "சேர்ந்து",
+  "8",
+  "செய்திகள்",
+  "நிறைய",
+  "பங்குச்",
+  "கொண்டே",
+  "அவர்களுக்கு",
+  "கூடாது",
+  "அப்பா",
+  "நடத்தி",
+  "பலர்",
+  "வாழ்க்கை",
+  "உதவி",
+  "கருணாநிதி",
+  "நடந்தது",
+  "போட்டியில்",
+  "இவரது",
+  "மொழி",
+  "வாய்ப்பு",
+  "மார்ச்",
+  "மதுரை",
+  "வருகின்றன",
+  "எடுத்துக்",
+  "யாரும்",
+  "அதிகரித்துள்ளது",
+  "மதிப்பு",
+  "முன்னாள்",
+  "செல்ல",
+  "இரண்டாவது",
+  "கூட்டம்",
+  "பால்",
+  "50",
+  "கீழ்",
+  "ஜூன்",
+  "சார்ந்த",
+  "பெற",
+  "12",
+  "பொதுவாக",
+  "மாவட்டம்",
+  "போட்டி",
+  "அங்கே",
+  "குறைந்த",
+  "சென்னையில்",
+  "ஜனாதிபதி",
+  "கீழே",
+  "டாக்டர்",
+  "விழா",
+  "தரும்",
+  "அரசின்",
+  "இனி",
+  "அதிகமாக",
+  "தனியார்",
+  "சிலர்",
+  "பணி",
+  "மொத்த",
+  "கூடிய",
+  "எவ்வளவு",
+  "மகன்",
+  "தெரியவில்லை",
+  "ஜூலை",
+  "அருகில்",
+  "திட்டம்",
+  "சேர்த்து",
+  "ரூ.",
+  "7",
+  "மாவட்டத்தில்",
+  "அளவுக்கு",
+  "ஆய்வு",
+  "இருப்பது",
+  "கேள்வி",
+  "குறிப்பிட்ட",
+  "உயர்வு",
+  "தங்கம்",
+  "தேர்வு",
+  "அடுத்து",
+  "எண்",
+  "சி",
+  "வர்த்தக",
+  "சமூக",
+  "நோக்கி",
+  "நாட்டு",
+  "அதிகாரிகள்",
+  "கி",
+  "சிறிது",
+  "நம்பிக்கை",
+  "கேட்டு",
+  "நீண்ட",
+  "என்பதால்",
+  "தனி",
+  "தமிழகத்தில்",
+  "முடியாத",
+  "அதனை",
+  "ஆன்மிக",
+  "குறிப்பாக",
+  "ஏற்பட்ட",
+  "தமது",
+  "உள்ளனர்",
+  "கையில்",
+  "புரிந்து",
+  "இருவரும்",
+  "மழை",
+  "வேண்டாம்",
+  "நாட்கள்",
+  "போன",
+  "அவர்களை",
+  "வர்த்தகம்",
+  "சற்று",
+  "தமிழ்நாடு",
+  "வழக்கு",
+  "அனைவரும்",
+  "கொண்டது",
+  "உண்மை",
+  "வாங்கி",
+  "கால",
+  "ஏற்பட்டது",
+  "இடையே",
+  "நவம்பர்",
+  "முடியவில்லை",
+  "கூறப்படுகிறது",
+  "25",
+  "இருக்கலாம்",
+  "வெளிவந்த",
+  "நாடுகளில்",
+  "நடப்பு",
+  "அப்படியே",
+  "முதலீடு",
+  "விஷயம்",
+  "அமைப்பு",
+  "நமக்கு",
+  "எத்தனை",
+  "படத்தில்",
+  "தன்னை",
+  "தமிழில்",
+  "பகுதிகளில்",
+  "உயர்ந்துள்ளது",
+  "கடும்",
+  "முக்கியமான",
+  "பத்து",
+  "வரவேற்பு",
+  "மக்களுக்கு",
+  "தடை",
+  "உங்களுக்கு",
+  "தேவையான",
+  "வரி",
+  "விடும்",
+  "ago",
+  "இணைந்து",
+  "குழு",
+  "கிடையாது",
+  "செய்தார்",
+  "தொடர்பு",
+  "அவனுக்கு",
+  "குழந்தைகள்",
+  "மணிக்கு",
+  "பெயரில்",
+  "எண்ணிக்கை",
+  "சிகிச்சை",
+  "தானே",
+  "பாகிஸ்தான்",
+  "செப்டம்பர்",
+  "வகை",
+  "உயர்ந்து",
+  "செய்வது",
+  "வைத்துக்",
+  "அடி",
+  "எழுதிய",
+  "பஸ்",
+  "கொலை",
+  "நடக்கும்",
+  "சேவை",
+  "செய்தனர்",
+  "தேர்தலில்",
+  "உட்பட",
+  "நல்லது",
+  "விரைவில்",
+  "உலகம்",
+  "வருகிறார்",
+  "கொண்டிருந்த",
+  "சிறப்பாக",
+  "முடிந்தது",
+  "எதிராக",
+  "பயிற்சி",
+  "கொண்டார்",
+  "நடைபெற்ற",
+  "கல்லூரி",
+  "சரியான",
+  "படி",
+  "கூறி",
+  "ஆட்சி",
+  "ஏதாவது",
+  "மாணவர்கள்",
+  "முழு",
+  "ஒன்றை",
+  "அவனை",
+  "வாரம்",
+  "பிறந்த",
+  "டிசம்பர்",
+  "தெரிகிறது",
+  "நானும்",
+  "இரண்டாம்",
+  "பள்ளி",
+  "எதிரான",
+  "இந்து",
+  "ஜனவரி",
+  "குரல்",
+  "தேடி",
+  "வீட்டு",
+  "மேலே",
+  "அக்டோபர்",
+  "ரூபாயாக",
+  "அடிக்கடி",
+  "டன்",
+  "ஏப்ரல்",
+  "நாளை",
+  "11",
+  "100",
+  "சமயம்",
+  "காதல்",
+  "மிகுந்த",
+  "AM",
+  "கூடுதல்",
+  "பெற்றது",
+  "நோய்",
+  "சென்செக்ஸ்",
+  "இலக்கிய",
+  "லாபம்",
+  "மனதில்",
+  "சதவீத",
+  "கொள்ளும்",
+  "பொருட்கள்",
+  "பயணம்",
+  "நீங்க",
+  "இருப்பினும்",
+  "கிரிக்கெட்",
+  "எடுக்க",
+  "வெறும்",
+  "எதிர்",
+  "சதவீதமாக",
+  "போகும்",
+  "தெரிவித்துள்ளார்",
+  "நாடுகள்",
+  "பட்டது",
+  "அறிவியல்",
+  "கே",
+  "முயற்சி",
+  "ரொம்ப",
+  "என்றாலும்",
+  "எப்போதும்",
+  "கவிதை",
+  "ஆர்",
+  "நடைபெற்றது",
+  "போர்",
+  "அனுமதி",
+  "இருக்கின்றன",
+  "எழுதி",
+  "தெரிவித்துள்ளது",
+  "Report",
+  "இருந்தார்",
+  "Abuse",
+  "பேச்சு",
+  "வாழும்",
+  "கொடுக்க",
+  "வழங்க",
+  "9",
+  "கை",
+  "நூல்",
+  "நடைபெறும்",
+  "இயக்குனர்",
+  "மாற்றம்",
+  "போக",
+  "மருத்துவ",
+  "வழியாக",
+  "இசை",
+  "இத்தகைய",
+  "திமுக",
+  "குறைந்துள்ளது",
+  "தொடர்பான",
+  "போராட்டம்",
+  "உடனடியாக",
+  "கிராம்",
+  "தினமும்",
+  "அவனது",
+  "40",
+  "அதிகாரி",
+  "கருத்துக்கள்",
+  "முகம்",
+  "மேற்பட்ட",
+  "உலகின்",
+  "அமெரிக்கா",
+  "தம்",
+  "24",
+  "வசதி",
+  "தலைமையில்",
+  "கடல்",
+  "பார்த்துக்",
+  "தொகை",
+  "ஆனாலும்",
+  "அனுப்பி",
+  "உலகில்",
+  "அவசியம்",
+  "தீபாவளி",
+  "அவற்றை",
+  "ஐக்கிய",
+  "ஒன்றும்",
+  "தொடங்கி",
+  "காட்சி",
+  "தலை",
+  "நன்றாக",
+  "பெறும்",
+  "ஆசிரியர்",
+  "ஆண்டின்",
+  "18",
+  "உனக்கு",
+  "போக்குவரத்து",
+  "நன்கு",
+  "ஆகியவை",
+  "இறக்குமதி",
+  "குறியீட்டு",
+  "திறந்து",
+  "இருந்தன",
+  "திரு",
+  "கொண்டனர்",
+  "நவீன",
+  "மு",
+  "மாத",
+  "இருக்கு",
+  "பெரும்பாலும்",
+  "அளவிற்கு",
+  "ஆகஸ்ட்",
+  "இருப்பதால்",
+  "வாங்க",
+  "வட்டி",
+  "சுற்றி",
+  "கடைசி",
+  "எழுந்து",
+  "எனக்",
+  "உயர்",
+  "உயிர்",
+  "கொள்ளலாம்",
+  "செயல்",
+  "செய்யப்பட்டது",
+  "விட்டார்",
+  "சர்க்கரை",
+  "வீட்டுக்கு",
+  "தமிழ்த்",
+  "சொன்னார்",
+  "அறிமுகம்",
+  "அமைந்துள்ளது",
+  "ஊர்",
+  "தந்தை",
+  "இருப்பதாக",
+  "மத்தியில்",
+  "செய்தது",
+  "பிடித்து",
+  "பேச",
+  "மில்லியன்",
+  "மிகப்",
+  "கூட்டத்தில்",
+  "நகரில்",
+  "டாலர்",
+  "எனவும்",
+  "தாய்",
+  "க.",
+  "ஆண்டுகள்",
+  "இந்தத்",
+  "புகார்",
+  "பொழுது",
+  "14",
+  "16",
+  "சாதாரண",
+  "மற்றொரு",
+  "நன்றி",
+  "கலை",
+  "தெரியாது",
+  "உரிய",
+  "13",
+  "அமெரிக்காவில்",
+  "கூறியுள்ளார்",
+  "போன்று",
+  "பங்குச்சந்தை",
+  "உரிமை",
+  "வழக்கம்",
+  "தன்னுடைய",
+  "சமீபத்தில்",
+  "கொண்டிருக்கும்",
+  "அதிகரிக்கும்",
+  "போலவே",
+  "வரலாறு",
+  "மக்களை",
+  "பதவி",
+  "ஆண்டுகளுக்கு",
+  "சின்ன",
+  "ஒருநாள்",
+  "உறுதி",
+  "என்றே",
+  "ரூபாய்க்கு",
+  "எல்லோரும்",
+  "முடியாமல்",
+  "விவசாயிகள்",
+  "கவனம்",
+  "மொபைல்",
+  "கூட்டணி",
+  "தங்க",
+  "இறுதியில்",
+  "சொந்த",
+  "அவர்களது",
+  "இருக்கிறார்",
+  "தனக்கு",
+  "வீரர்கள்",
+  "வருடம்",
+  "பிப்ரவரி",
+  "ஆப்கானிஸ்தான்",
+  "அழைத்து",
+  "எதிர்ப்பு",
+  "அவளை",
+  "மாறி",
+  "திரும்பி",
+  "மலர்",
+  "மீதான",
+  "பட்ட",
+  "புது",
+  "கிழக்கு",
+  "பார்த்த",
+  "தென்",
+  "தர",
+  "அவளுக்கு",
+  "கொண்டிருந்தது",
+  "கோவில்",
+  "செய்யப்பட்ட",
+  "விடுதலை",
+  "இயற்கை",
+  "தெரிந்து",
+  "ஆதரவு",
+  "அடிப்படை",
+  "ஏற்பட்டுள்ளது",
+  "உங்க",
+  "காண",
+  "முந்தைய",
+  "22",
+  "அடையாளம்",
+  "முன்னால்",
+  "கோவை",
+  "வருவது",
+  "அதுவும்",
+  "கடவுள்",
+  "தொடர்",
+  "காட்டி",
+  "மிகப்பெரிய",
+  "வைக்க",
+  "கல்வியறிவு",
+  "பெரும்பாலான",
+  "இதுகுறித்து",
+  "ஏற்பாடு",
+  "கட்சியின்",
+  "இருக்கிறார்கள்",
+  "முன்னணி",
+  "வெள்ளி",
+  "அமைந்துள்ள",
+  "ஊழல்",
+  "காந்தி",
+  "நாட்களில்",
+  "வழங்கும்",
+  "மருந்து",
+  "விலையை",
+  "அதிமுக",
+  "கட்டி",
+  "செய்துள்ளது",
+  "மோட்டார்",
+  "தெரிய",
+  "கால்",
+  "சக்தி",
+  "சாலை",
+  "நாளில்",
+  "சட்டம்",
+  "இவ்வளவு",
+  "கேப்டன்",
+  "என்பதே",
+  "செலவு",
+  "சினிமா",
+  "பயன்படுத்தி",
+  "பலரும்",
+  "இளம்",
+  "சங்க",
+  "அதிபருக்கு",
+  "கடிதம்",
+  "தங்கத்தின்",
+  "சரியாக",
+  "போனது",
+  "ஆண்டுகளில்",
+  "காவல்",
+  "மஞ்சள்",
+  "அனைத்தும்",
+  "ஆண்",
+  "பேசி",
+  "இவன்",
+  "சிங்",
+  "நிகழ்ச்சி",
+  "அறிந்து",
+  "ரிசர்வ்",
+  "கண்",
+  "கொடுத்த",
+  "ஐரோப்பிய",
+  "பட்டம்",
+  "பாடல்",
+  "பங்குகள்",
+  "என்னுடைய",
+  "சொல்லும்",
+  "முறையாக",
+  "28",
+  "இறுதி",
+  "வந்தால்",
+  "நிலையம்",
+  "மின்சாரம்",
+  "விலையில்",
+  "மாநிலத்தில்",
+  "நடத்த",
+  "லட்சத்து",
+  "நிறுவன",
+  "ஜெயலலிதா",
+  "பார்க்கும்",
+  "துறையில்",
+  "வழியில்",
+  "போன்",
+  "முழுக்க",
+  "மூன்றாவது",
+  "ஏராளமான",
+  "இன்றும்",
+  "வருவாய்",
+  "அவற்றின்",
+  "ராஜா",
+  "திரும்ப",
+  "மேற்கு",
+  "வி",
+  "ஏனெனில்",
+  "ஏழு",
+  "சொன்ன",
+  "என்பதும்",
+  "தவறு",
+  "கேட்க",
+  "பின்னால்",
+  "அத்துடன்",
+  "தமிழர்கள்",
+  "எனப்படும்",
+  "மகள்",
+  "வந்தனர்",
+  "கூடும்",
+  "நடக்கிறது",
+  "நடிகர்",
+  "பெட்ரோல்",
+  "புகழ்",
+  "தமிழர்",
+  "பற்றியும்",
+  "17",
+  "சொல்",
+  "இதையடுத்து",
+  "பட்டு",
+  "விழாவில்",
+  "ஜி",
+  "தகவல்கள்",
+  "தீவிர",
+  "பிரிவு",
+  "அணு",
+  "என்பவர்",
+  "பெண்களின்",
+  "வயதில்",
+  "அண்ணா",
+  "மாதங்களில்",
+  "பணிகள்",
+  "அணியின்",
+  "எனக்குத்",
+  "செய்யப்படும்",
+  "அரிசி",
+  "அவரிடம்",
+  "கூறியதாவது",
+  "முன்னர்",
+  "இங்கிலாந்து",
+  "வெளி",
+  "அதிபர்",
+  "நிதியாண்டில்",
+  "உள்ளார்",
+  "புதிதாக",
+  "முகத்தில்",
+  "இலங்கையில்",
+  "February",
+  "தாக்கல்",
+  "2010",
+  "சம்பவம்",
+  "நம்ம",
+  "என்கிறார்",
+  "தாக்குதல்",
+  "பலி",
+  "மீட்டர்",
+  "பார்த்தால்",
+  "அதிகாலை",
+  "விருது",
+  "வட",
+  "விபத்து",
+  "பக்கத்தில்",
+  "பொதுமக்கள்",
+};
+const uint16_t WA_FREQ_159_RANKS[] = {
+  854, 456, 0, 201, 776, 720, 359, 888, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 542, 0, 236, 0, 763, 824, 0, 660, 90, 617,
+  139, 0, 0, 0, 751, 0, 463, 697, 0, 0, 0, 639, 0, 0, 884, 0,
+  0, 0, 35, 176, 0, 0, 184, 0, 0, 235, 811, 0, 974, 0, 251, 198,
+  415, 0, 0, 0, 174, 0, 927, 389, 0, 259, 0, 0, 1, 190, 693, 822,
+  0, 0, 740, 716, 562, 574, 40, 0, 377, 0, 0, 461, 781, 466, 421, 0,
+  0, 507, 0, 0, 360, 164, 818, 0, 447, 0, 707, 0, 168, 701, 135, 924,
+  827, 0, 0, 0, 0, 0, 295, 0, 0, 0, 0, 0, 106, 955, 0, 0,
+  0, 0, 0, 19, 231, 233, 760, 0, 0, 0, 157, 0, 187, 0, 0, 0,
+  29, 0, 0, 907, 778, 933, 647, 117, 621, 0, 0, 0, 208, 0, 0, 611,
+  177, 786, 0, 0, 0, 485, 0, 0, 0, 490, 926, 808, 598, 0, 0, 0,
+  0, 353, 0, 0, 0, 179, 0, 0, 0, 72, 440, 0, 0, 185, 0, 987,
+  982, 0, 0, 0, 0, 0, 0, 0, 0, 0, 333, 0, 0, 367, 0, 0,
+  335, 0, 0, 279, 282, 0, 0, 229, 0, 0, 0, 0, 76, 125, 161, 493,
+  981, 0, 0, 939, 0, 523, 0, 257, 0, 548, 0, 735, 0, 758, 0, 0,
+  94, 681, 993, 743, 196, 0, 209, 450, 0, 358, 445, 0, 0, 427, 0, 428,
+  0, 0, 0, 950, 0, 0, 580, 821, 416, 594, 0, 0, 0, 0, 0, 0,
+  0, 0, 795, 336, 0, 0, 14, 578, 13, 0, 0, 755, 838, 536, 248, 789,
+  823, 0, 0, 0, 0, 0, 0, 739, 0, 991, 0, 0, 0, 0, 0, 870,
+  0, 213, 482, 940, 0, 867, 0, 110, 0, 0, 0, 0, 0, 0, 20, 815,
+  392, 718, 664, 593, 203, 954, 0, 0, 0, 0, 0, 408, 344, 0, 0, 0,
+  0, 0, 92, 560, 849, 829, 0, 0, 0, 444, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 77, 0, 662, 990, 968, 0, 0, 517, 0, 0, 277, 228, 624,
+  0, 591, 0, 952, 307, 372, 0, 98, 732, 881, 0, 0, 308, 576, 736, 575,
+  948, 0, 0, 499, 38, 273, 566, 0, 906, 0, 0, 0, 0, 979, 0, 0,
+  0, 694, 0, 468, 0, 433, 0, 796, 183, 239, 423, 670, 535, 794, 845, 899,
+  956, 0, 0, 872, 0, 0, 0, 0, 320, 0, 241, 959, 116, 288, 791, 464,
+  928, 0, 0, 616, 166, 0, 620, 0, 0, 0, 0, 0, 0, 0, 869, 904,
+  364, 442, 0, 0, 0, 0, 0, 0, 0, 0, 297, 470, 627, 864, 975, 0,
+  934, 0, 0, 103, 0, 0, 0, 814, 243, 258, 0, 0, 0, 0, 81, 0,
+  0, 0, 63, 695, 828, 0, 481, 0, 0, 0, 0, 193, 0, 0, 0, 0,
+  0, 0, 0, 0, 634, 945, 0, 571, 0, 460, 0, 430, 453, 0, 0, 0,
+  0, 856, 0, 748, 0, 0, 0, 0, 541, 984, 194, 0, 274, 374, 923, 266,
+  59, 67, 734, 1000, 0, 0, 579, 0, 0, 0, 0, 426, 446, 0, 965, 159,
+  0, 0, 0, 0, 0, 0, 0, 573, 592, 947, 0, 0, 0, 552, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 882, 887, 997, 0, 826, 0, 0, 0, 0,
+  0, 70, 409, 883, 129, 0, 666, 525, 729, 0, 0, 386, 0, 58, 0, 631,
+  949, 99, 530, 719, 863, 0, 0, 650, 0, 366, 0, 0, 121, 0, 783, 744,
+  905, 0, 0, 0, 767, 0, 34, 0, 458, 0, 0, 636, 0, 0, 291, 866,
+  355, 371, 390, 127, 0, 0, 0, 0, 75, 0, 819, 0, 0, 0, 510, 0,
+  0, 0, 0, 0, 0, 404, 0, 495, 820, 561, 0, 513, 673, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 80, 245, 0, 0, 0, 107, 0, 0, 0,
+  874, 151, 0, 0, 648, 0, 12, 0, 0, 676, 0, 0, 0, 836, 0, 0,
+  46, 951, 996, 644, 0, 998, 324, 506, 309, 0, 0, 0, 328, 133, 178, 0,
+  0, 816, 0, 0, 0, 218, 0, 509, 0, 908, 0, 0, 0, 932, 0, 0,
+  0, 937, 0, 629, 0, 210, 0, 0, 272, 841, 0, 0, 679, 0, 0, 0,
+  0, 7, 394, 553, 4, 0, 0, 0, 0, 0, 0, 171, 817, 0, 321, 602,
+  672, 972, 0, 544, 207, 555, 929, 0, 0, 0, 0, 0, 387, 0, 0, 0,
+  0, 0, 0, 0, 590, 711, 250, 717, 532, 830, 749, 958, 346, 0, 596, 0,
+  0, 395, 0, 28, 689, 188, 0, 0, 79, 0, 172, 337, 0, 994, 0, 0,
+  437, 518, 801, 0, 0, 944, 0, 0, 0, 2, 23, 860, 930, 0, 316, 0,
+  0, 342, 197, 752, 491, 983, 0, 0, 0, 497, 521, 52, 378, 589, 730, 865,
+  144, 853, 685, 957, 0, 0, 405, 0, 556, 0, 0, 0, 240, 33, 0, 0,
+  0, 477, 0, 0, 577, 0, 0, 182, 119, 303, 878, 254, 150, 0, 914, 0,
+  0, 0, 44, 327, 810, 268, 391, 435, 0, 653, 454, 918, 0, 0, 45, 0,
+  0, 0, 192, 100, 581, 270, 880, 962, 0, 0, 304, 472, 687, 891, 704, 700,
+  784, 296, 478, 806, 961, 0, 0, 10, 0, 0, 0, 0, 6, 354, 93, 890,
+  397, 0, 585, 294, 545, 714, 112, 543, 0, 0, 225, 260, 967, 0, 85, 0,
+  0, 252, 0, 0, 540, 0, 0, 0, 0, 572, 0, 0, 104, 834, 637, 0,
+  0, 0, 0, 0, 494, 909, 0, 0, 0, 0, 84, 0, 537, 0, 0, 0,
+  0, 0, 0, 920, 0, 0, 242, 0, 0, 141, 0, 793, 111, 424, 465, 837,
+  469, 62, 200, 123, 343, 400, 140, 175, 278, 356, 438, 702, 317, 496, 844, 413,
+  977, 0, 65, 0, 0, 0, 0, 61, 162, 365, 607, 0, 0, 158, 253, 632,
+  558, 0, 292, 0, 0, 659, 901, 417, 97, 0, 0, 0, 0, 799, 0, 0,
+  879, 0, 0, 0, 0, 0, 0, 0, 0, 539, 143, 663, 0, 0, 434, 0,
+  0, 725, 0, 131, 516, 705, 74, 475, 17, 503, 839, 563, 911, 0, 0, 0,
+  0, 0, 0, 0, 898, 0, 0, 105, 73, 738, 0, 706, 50, 83, 0, 18,
+  0, 36, 985, 332, 318, 894, 32, 764, 0, 476, 626, 0, 0, 773, 0, 480,
+  263, 0, 206, 0, 0, 0, 170, 362, 792, 0, 136, 936, 0, 118, 130, 350,
+  570, 595, 160, 0, 0, 0, 221, 0, 0, 654, 0, 473, 436, 966, 0, 0,
+  0, 287, 803, 195, 375, 606, 0, 0, 726, 757, 512, 893, 892, 237, 935, 148,
+  999, 0, 0, 0, 0, 452, 349, 30, 418, 407, 101, 455, 557, 565, 396, 406,
+  0, 0, 223, 969, 0, 903, 262, 0, 0, 913, 0, 550, 479, 771, 0, 0,
+  724, 439, 78, 0, 0, 265, 0, 0, 713, 64, 347, 0, 0, 275, 855, 199,
+  0, 0, 0, 835, 0, 0, 443, 519, 0, 612, 457, 761, 514, 0, 284, 331,
+  683, 0, 0, 0, 651, 0, 338, 0, 599, 357, 779, 533, 0, 605, 0, 774,
+  564, 780, 0, 0, 675, 134, 271, 0, 0, 43, 137, 524, 619, 60, 768, 788,
+  785, 638, 886, 0, 0, 0, 941, 0, 0, 49, 432, 804, 113, 0, 0, 0,
+  0, 0, 0, 0, 728, 0, 0, 678, 529, 0, 0, 0, 0, 448, 53, 340,
+  709, 0, 300, 216, 0, 588, 0, 0, 0, 0, 0, 483, 71, 256, 790, 0,
+  0, 508, 661, 684, 0, 691, 618, 0, 797, 191, 0, 0, 0, 0, 0, 96,
+  868, 0, 186, 147, 551, 0, 0, 0, 114, 39, 0, 0, 0, 0, 0, 312,
+  0, 0, 0, 0, 843, 0, 0, 0, 0, 943, 986, 27, 919, 703, 0, 665,
+  246, 361, 498, 885, 946, 692, 549, 710, 753, 649, 897, 132, 0, 0, 708, 0,
+  528, 0, 623, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 812, 0,
+  0, 600, 15, 232, 895, 0, 0, 0, 0, 0, 597, 37, 393, 102, 741, 122,
+  0, 696, 0, 900, 587, 0, 0, 0, 462, 750, 754, 0, 721, 0, 87, 522,
+  0, 0, 0, 859, 220, 326, 655, 745, 861, 68, 0, 614, 0, 0, 765, 0,
+  167, 5, 204, 925, 0, 850, 0, 0, 0, 0, 832, 88, 916, 124, 0, 322,
+  0, 963, 31, 163, 341, 451, 873, 917, 0, 0, 0, 554, 669, 842, 0, 657,
+  502, 0, 329, 0, 180, 173, 505, 0, 0, 0, 0, 0, 615, 339, 0, 0,
+  0, 0, 0, 403, 0, 0, 3, 69, 547, 0, 0, 0, 330, 0, 0, 0,
+  0, 0, 0, 0, 156, 414, 642, 772, 0, 0, 0, 633, 0, 0, 249, 0,
+  0, 0, 21, 0, 0, 715, 0, 0, 0, 690, 601, 149, 217, 787, 0, 0,
+  0, 0, 686, 205, 306, 609, 0, 0, 0, 0, 55, 0, 0, 0, 988, 0,
+  384, 995, 0, 0, 0, 0, 0, 0, 0, 534, 0, 0, 630, 0, 0, 0,
+  0, 0, 0, 280, 603, 0, 953, 224, 48, 255, 569, 656, 770, 852, 0, 0,
+  165, 41, 970, 0, 0, 699, 731, 0, 0, 0, 0, 0, 500, 120, 8, 155,
+  376, 567, 0, 652, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 379, 0,
+  0, 313, 0, 383, 0, 0, 833, 0, 0, 0, 0, 0, 487, 109, 311, 511,
+  0, 0, 370, 422, 831, 0, 381, 0, 0, 0, 9, 181, 189, 323, 351, 0,
+  0, 489, 0, 857, 635, 153, 0, 0, 51, 0, 299, 640, 0, 0, 0, 840,
+  0, 0, 0, 0, 0, 425, 0, 410, 0, 0, 0, 520, 964, 722, 22, 399,
+  798, 0, 247, 769, 0, 0, 0, 0, 0, 0, 0, 942, 0, 0, 0, 0,
+  0, 0, 0, 128, 0, 0, 976, 0, 0, 646, 0, 0, 314, 0, 0, 0,
+  0, 0, 0, 319, 226, 402, 915, 0, 467, 501, 0, 0, 0, 0, 0, 215,
+  269, 922, 66, 388, 0, 0, 138, 0, 851, 0, 0, 0, 862, 0, 486, 756,
+  301, 980, 0, 0, 0, 0, 0, 0, 628, 0, 0, 0, 0, 825, 0, 0,
+  0, 0, 202, 459, 742, 0, 0, 0, 54, 368, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 385, 902, 0, 0, 766, 0, 261, 82, 782, 0, 762, 0, 0,
+  0, 0, 115, 0, 0, 488, 0, 641, 584, 807, 515, 293, 858, 960, 0, 345,
+  877, 658, 667, 912, 0, 380, 126, 238, 0, 26, 42, 0, 0, 0, 0, 419,
+  0, 604, 108, 0, 0, 0, 0, 0, 723, 0, 978, 0, 0, 0, 25, 938,
+  401, 0, 0, 583, 875, 680, 0, 0, 0, 0, 0, 0, 0, 0, 0, 848,
+  0, 24, 0, 0, 0, 373, 0, 86, 398, 0, 0, 348, 230, 420, 813, 0,
+  0, 474, 747, 538, 504, 0, 971, 0, 310, 0, 0, 47, 95, 0, 227, 0,
+  145, 526, 671, 0, 0, 802, 973, 0, 0, 267, 531, 546, 0, 668, 674, 0,
+  305, 586, 264, 0, 0, 484, 0, 0, 0, 0, 0, 244, 0, 727, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 276, 211, 0, 0, 0, 608,
+  0, 0, 0, 0, 0, 0, 0, 0, 369, 992, 152, 214, 290, 16, 441, 285,
+  643, 805, 0, 871, 0, 0, 0, 0, 0, 0, 283, 0, 0, 212, 429, 0,
+  0, 0, 0, 0, 0, 625, 449, 527, 91, 431, 613, 733, 746, 222, 777, 800,
+  57, 876, 896, 154, 775, 610, 921, 0, 0, 0, 56, 0, 0, 0, 363, 0,
+  0, 0, 698, 0, 0, 0, 0, 0, 11, 169, 286, 302, 847, 0, 0, 0,
+  89, 889, 298, 0, 645, 682, 0, 0, 382, 0, 0, 0, 0, 219, 0, 0,
+  0, 0, 0, 142, 931, 471, 0, 281, 0, 411, 334, 0, 0, 146, 568, 0,
+  0, 688, 492, 910, 0, 759, 712, 559, 622, 737, 0, 0, 0, 582, 289, 846,
+  989, 0, 315, 234, 809, 412, 0, 0, 0, 352, 0, 0, 0, 677, 325, 0,
+};
+
+const char *WA_FREQ_160_TOKENS[] = {
+  "ఈ",
+  "మరియు",
+  "ఒక",
+  "కూడా",
+  "ఆ",
+  "యొక్క",
+  "అని",
+  "లో",
+  "ఇది",
+  "తన",
+  "నుండి",
+  "ఉన్న",
+  "లేదా",
+  "ఉంది",
+  "చెందిన",
+  "నుంచి",
+  "చాలా",
+  "ద్వారా",
+  "అనే",
+  "ఆయన",
+  "ఉంటుంది",
+  "రెండు",
+  "తరువాత",
+  "ఉన్నాయి",
+  "వారు",
+  "అయితే",
+  "కొన్ని",
+  "ఆమె",
+  "వారి",
+  "కానీ",
+  "జిల్లా",
+  "తర్వాత",
+  "కోసం",
+  "తమ",
+  "మధ్య",
+  "వరకు",
+  "చేసిన",
+  "ఇతర",
+  "అనేక",
+  "అది",
+  "కలిగి",
+  "గురించి",
+  "వంటి",
+  "మంది",
+  "ప్రభుత్వం",
+  "మీద",
+  "లేదు",
+  "మన",
+  "మాత్రమే",
+  "ఏ",
+  "ప్రకారం",
+  "అతను",
+  "అతని",
+  "పెద్ద",
+  "ఉంటాయి",
+  "కాని",
+  "ప్రధాన",
+  "చేసి",
+  "ప్రతి",
+  "జనాభా",
+  "తెలుగు",
+  "చేశారు",
+  "అన్ని",
+  "ది",
+  "పేరు",
+  "ఎక్కువ",
+  "కాదు",
+  "మొదటి",
+  "సమయంలో",
+  "జరిగిన",
+  "ఆఫ్",
+  "మీ",
+  "ముందు",
+  "విధంగా",
+  "చిన్న",
+  "మూడు",
+  "గ్రామము",
+  "వలన",
+  "ను",
+  "భారత",
+  "అనేది",
+  "అంటే",
+  "మంచి",
+  "మాత్రం",
+  "వల్ల",
+  "వద్ద",
+  "గా",
+  "పాటు",
+  "ఇక్కడ",
+  "మండలానికి",
+  "కు",
+  "దాని",
+  "తిరిగి",
+  "ఓ",
+  "కి",
+  "మరో",
+  "కొత్త",
+  "అదే",
+  "చిత్రం",
+  "ఇంకా",
+  "వచ్చిన",
+  "నేను",
+  "చేసే",
+  "అయిన",
+  "మొత్తం",
+  "పార్టీ",
+  "చేసింది",
+  "దీని",
+  "సినిమా",
+  "దీనిని",
+  "నా",
+  "ఎక్కువగా",
+  "పని",
+  "ఏర్పాటు",
+  "ప్రస్తుతం",
+  "వివిధ",
+  "ప్రపంచ",
+  "బాగా",
+  "అభివృద్ధి",
+  "వారికి",
+  "ఇలా",
+  "రాష్ట్ర",
+  "సంస్థ",
+  "ఇప్పుడు",
+  "అలాగే",
+  "ఇవి",
+  "అమెరికా",
+  "సాధారణంగా",
+  "శాతం",
+  "కంటే",
+  "ప్రభుత్వ",
+  "ఉండే",
+  "ప్రత్యేక",
+  "రాజకీయ",
+  "కాలంలో",
+  "పై",
+  "చేయడం",
+  "అంటారు",
+  "గ్రామ",
+  "లోని",
+  "సంబంధించిన",
+  "తక్కువ",
+  "వచ్చింది",
+  "కారణంగా",
+  "కేవలం",
+  "ఒకటి",
+  "తో",
+  "కలిసి",
+  "కాంగ్రెస్",
+  "అవి",
+  "కొరకు",
+  "మరింత",
+  "కాకుండా",
+  "జరిగింది",
+  "దీనికి",
+  "ఇందులో",
+  "పలు",
+  "అవకాశం",
+  "జాతీయ",
+  "అవసరం",
+  "పూర్తి",
+  "అక్కడ",
+  "కలిగిన",
+  "జనవరి",
+  "నాలుగు",
+  "అత్యంత",
+  "లేకుండా",
+  "తెలంగాణ",
+  "ఉన్నారు",
+  "ప్రజలు",
+  "తాను",
+  "ఆర్థిక",
+  "వాటిని",
+  "విషయం",
+  "పేరుతో",
+  "వచ్చే",
+  "శ్రీ",
+  "వచ్చి",
+  "ఎంతో",
+  "ఎలా",
+  "అన్నాడు",
+  "దాదాపు",
+  "రోజు",
+  "వాటి",
+  "ముఖ్యంగా",
+  "అతి",
+  "కొంత",
+  "గల",
+  "విడుదల",
+  "తొలి",
+  "గత",
+  "కేంద్ర",
+  "మనం",
+  "ప్రముఖ",
+  "ఇక",
+  "వారిని",
+  "అంతర్జాతీయ",
+  "సంవత్సరం",
+  "ఉన్నది",
+  "వీరు",
+  "కారణం",
+  "లేని",
+  "ఆంధ్ర",
+  "కాలం",
+  "తయారు",
+  "అన్న",
+  "అండ్",
+  "అధిక",
+  "లేక",
+  "చెప్పారు",
+  "కనుక",
+  "2001",
+  "అలా",
+  "ఎంత",
+  "ఎన్నో",
+  "చేయడానికి",
+  "చేశాడు",
+  "రెండవ",
+  "ఒకే",
+  "సంవత్సరాల",
+  "సుమారు",
+  "ఇదే",
+  "పాత్ర",
+  "నాకు",
+  "వ్యక్తి",
+  "మంత్రి",
+  "తండ్రి",
+  "పూర్తిగా",
+  "దానిని",
+  "మా",
+  "ఉత్పత్తి",
+  "దేశంలో",
+  "విషయంలో",
+  "దక్షిణ",
+  "సాధారణ",
+  "భారతీయ",
+  "అన్నారు",
+  "చూసి",
+  "కథ",
+  "నీ",
+  "సంగీత",
+  "లెక్కల",
+  "దానికి",
+  "సందర్భంగా",
+  "ప్రాంతంలో",
+  "చైనా",
+  "అంటూ",
+  "చేస్తారు",
+  "పరిస్థితి",
+  "ఉంటే",
+  "తెలిపారు",
+  "వరకూ",
+  "ఉత్తర",
+  "ఇలాంటి",
+  "సంఖ్య",
+  "వెంటనే",
+  "మళ్లీ",
+  "డిసెంబర్",
+  "అప్పుడు",
+  "చివరి",
+  "మీరు",
+  "శక్తి",
+  "ప్రజల",
+  "విజయం",
+  "భాగం",
+  "2",
+  "భాగంగా",
+  "వ్యవస్థ",
+  "వున్న",
+  "అసలు",
+  "అర్థం",
+  "వుంది",
+  "ఎందుకంటే",
+  "ఒక్క",
+  "అయినా",
+  "చేస్తుంది",
+  "5",
+  "అందులో",
+  "వీటిని",
+  "ఫిబ్రవరి",
+  "అందుకే",
+  "కాబట్టి",
+  "మిగిలిన",
+  "10",
+  "తూర్పు",
+  "కొందరు",
+  "జరుగుతుంది",
+  "ఐదు",
+  "జరిగే",
+  "దేశ",
+  "ఉండేది",
+  "రకాల",
+  "వలె",
+  "గొప్ప",
+  "రెండో",
+  "పైగా",
+  "హైదరాబాద్",
+  "సంస్థలు",
+  "భారీ",
+  "చరిత్ర",
+  "సైతం",
+  "జట్టు",
+  "కోట్ల",
+  "చెప్పాడు",
+  "3",
+  "తనకు",
+  "ప్రభావం",
+  "ఎలాంటి",
+  "స్థానంలో",
+  "ఆధునిక",
+  "తప్ప",
+  "పట్ల",
+  "స్థాయిలో",
+  "దేశం",
+  "తల్లి",
+  "ఉన్నత",
+  "అనగా",
+  "వస్తుంది",
+  "కలిపి",
+  "ప్రాంతం",
+  "మార్చి",
+  "నీటి",
+  "లాంటి",
+  "20",
+  "పొందిన",
+  "ముఖ్యమైన",
+  "సామాజిక",
+  "యుద్ధం",
+  "శాఖ",
+  "ఉండాలి",
+  "లేదని",
+  "కాక",
+  "చర్యలు",
+  "పాకిస్తాన్",
+  "స్థానిక",
+  "ఆరు",
+  "ఆధారంగా",
+  "సమయం",
+  "వ.సంవత్సరం",
+  "ఉండి",
+  "ని",
+  "భారత్",
+  "నీరు",
+  "ముఖ్యమంత్రి",
+  "ఏడాది",
+  "రాష్ట్రంలో",
+  "4",
+  "అంత",
+  "1",
+  "విధానం",
+  "చేత",
+  "మానవ",
+  "సంబంధం",
+  "రాజు",
+  "పశ్చిమ",
+  "మరొక",
+  "నూతన",
+  "చేసారు",
+  "అధికారులు",
+  "లు",
+  "ఇద్దరు",
+  "భూమి",
+  "వైపు",
+  "నగరం",
+  "అమలు",
+  "గాని",
+  "గ్రామం",
+  "గుర్తింపు",
+  "అతడు",
+  "స్థాయి",
+  "ఉందని",
+  "దగ్గర",
+  "వీరి",
+  "ముందుకు",
+  "కూడ",
+  "చేస్తూ",
+  "మాట",
+  "అత్యధిక",
+  "పిల్లలు",
+  "అంతా",
+  "సంబంధించి",
+  "మనకు",
+  "తాము",
+  "6",
+  "ఏదో",
+  "క్రికెట్",
+  "పరుగులు",
+  "స్వామి",
+  "దాన్ని",
+  "భాష",
+  "కన్నా",
+  "12",
+  "మాజీ",
+  "ప్రస్తుత",
+  "బట్టి",
+  "నాటికి",
+  "ఉంటారు",
+  "కదా",
+  "పది",
+  "ముఖ్య",
+  "భార్య",
+  "వ్యతిరేకంగా",
+  "దీన్ని",
+  "కంపెనీ",
+  "అంచనా",
+  "సంవత్సరంలో",
+  "పోటీ",
+  "అతనికి",
+  "వ్యాధి",
+  "విద్యుత్",
+  "ఇటీవల",
+  "కాగా",
+  "చుట్టూ",
+  "కేంద్రం",
+  "ఉత్తమ",
+  "ఫలితంగా",
+  "ఎందుకు",
+  "15",
+  "చేయాలి",
+  "అలాంటి",
+  "వేల",
+  "స్థానం",
+  "వీటిలో",
+  "చెప్పవచ్చు",
+  "గతంలో",
+  "విషయాన్ని",
+  "గ్రామంలో",
+  "సమాచారం",
+  "ప్రజలకు",
+  "ఉదాహరణకు",
+  "మరి",
+  "చిత్రంలో",
+  "పైన",
+  "ఆస్ట్రేలియా",
+  "సమస్య",
+  "అందరూ",
+  "ఇప్పటికీ",
+  "నిర్మాణం",
+  "సాంకేతిక",
+  "అధ్యక్షుడు",
+  "కమిటీ",
+  "కూడిన",
+  "లక్షల",
+  "గోదావరి",
+  "7",
+  "రచయిత",
+  "8",
+  "అప్పటి",
+  "మే",
+  "సమస్యలు",
+  "వ్యాపార",
+  "దృష్టి",
+  "అవుతుంది",
+  "వ్యాసాలు",
+  "చేయాలని",
+  "ప్రదేశ్",
+  "సహా",
+  "రాత్రి",
+  "మాట్లాడుతూ",
+  "30",
+  "వుంటుంది",
+  "చేస్తున్న",
+  "కృషి",
+  "వైద్య",
+  "వ్యక్తం",
+  "రక్షణ",
+  "అయినప్పటికీ",
+  "ముందుగా",
+  "యునైటెడ్",
+  "చేస్తున్నారు",
+  "ఇన్",
+  "ఈయన",
+  "అమెరికన్",
+  "కనీసం",
+  "న",
+  "దూరంలో",
+  "దీంతో",
+  "రూపంలో",
+  "అధికంగా",
+  "మారింది",
+  "అనంతరం",
+  "పనులు",
+  "ఎంపిక",
+  "జిల్లాలో",
+  "జూలై",
+  "ల",
+  "దేశాల",
+  "హిందూ",
+  "పేర్కొన్నారు",
+  "డి",
+  "అందువల్ల",
+  "రోజులు",
+  "ఇచ్చిన",
+  "2009",
+  "ఉండటం",
+  "వివాహం",
+  "అందుకు",
+  "ఏప్రిల్",
+  "చట్టం",
+  "మానసిక",
+  "వెళ్ళి",
+  "నాటి",
+  "శిక్షణ",
+  "వంటివి",
+  "చేస్తే",
+  "ఎన్నికలలో",
+  "చికిత్స",
+  "రాష్ట్రం",
+  "కింద",
+  "జూన్",
+  "తీసుకుని",
+  "ఆర్ధిక",
+  "వేసి",
+  "సింగ్",
+  "విద్య",
+  "అతిపెద్ద",
+  "జీవితం",
+  "నమోదు",
+  "ఇండియా",
+  "సరైన",
+  "పాత",
+  "ప్రాంతాల్లో",
+  "నీవు",
+  "2010",
+  "నాయకులు",
+  "మీకు",
+  "పాఠశాల",
+  "తగిన",
+  "ఉండదు",
+  "తరచుగా",
+  "ఏదైనా",
+  "పదం",
+  "ఎటువంటి",
+  "ప్రపంచంలో",
+  "చిత్ర",
+  "అవసరమైన",
+  "నిర్ణయం",
+  "సంఘం",
+  "కనిపిస్తుంది",
+  "సభ్యులు",
+  "ఉపయోగిస్తారు",
+  "మార్పులు",
+  "మనిషి",
+  "పాటలు",
+  "2008",
+  "ఆమెకు",
+  "కుటుంబ",
+  "బ్రిటిష్",
+  "నగర",
+  "పెట్టి",
+  "తీవ్ర",
+  "వారిలో",
+  "వాటిలో",
+  "పోలీసులు",
+  "చిత్రాలు",
+  "సంవత్సరాలు",
+  "మార్పు",
+  "ఆంధ్ర ప్రదేశ్",
+  "పొందింది",
+  "దర్శకుడు",
+  "సైనిక",
+  "నన్ను",
+  "వ్యవసాయ",
+  "దేశాలు",
+  "రోజుల",
+  "ఆహార",
+  "మొదలైన",
+  "నెల",
+  "సంఖ్యలో",
+  "నగరంలో",
+  "చేసాడు",
+  "దాడి",
+  "లేవు",
+  "బయటకు",
+  "ఇటువంటి",
+  "విద్యార్థులు",
+  "విద్యా",
+  "నది",
+  "ప్రదర్శన",
+  "అందుబాటులో",
+  "ఒకరు",
+  "కొంతమంది",
+  "విదేశీ",
+  "రంగంలో",
+  "వ్యక్తిగత",
+  "ప్రత్యేకంగా",
+  "వాణిజ్య",
+  "ఆయనకు",
+  "ఇక్కడి",
+  "25",
+  "వీటి",
+  "వ",
+  "ఏడు",
+  "జిల్లాకు",
+  "అధ్యయనం",
+  "స్పష్టం",
+  "మాటలు",
+  "అతడి",
+  "సాధించిన",
+  "పాట",
+  "సార్లు",
+  "9",
+  "మొదట",
+  "మేరకు",
+  "ఆమెను",
+  "ఇంటి",
+  "ప్రేమ",
+  "11",
+  "డాక్టర్",
+  "బి",
+  "మధ్యలో",
+  "పరీక్ష",
+  "చెప్పిన",
+  "రాసిన",
+  "సంగీతం",
+  "18",
+  "ఆధారపడి",
+  "పరిచయం",
+  "కార్యక్రమం",
+  "వచ్చాయి",
+  "ప్రధానంగా",
+  "ప్రాథమిక",
+  "పి",
+  "అంతే",
+  "సాహిత్య",
+  "బాధ్యత",
+  "మిగతా",
+  "చేసేందుకు",
+  "అయింది",
+  "నేషనల్",
+  "మద్దతు",
+  "ప్రయత్నం",
+  "ఒప్పందం",
+  "ఉండగా",
+  "నిజానికి",
+  "రంగు",
+  "తను",
+  "మహిళా",
+  "50",
+  "పరిశోధన",
+  "ఆలయం",
+  "కార్యక్రమాలు",
+  "పిలుస్తారు",
+  "అన్నీ",
+  "ఆరోగ్య",
+  "కొద్ది",
+  "ఆయా",
+  "తక్కువగా",
+  "నీకు",
+  "కావడం",
+  "నిర్వహణ",
+  "భర్త",
+  "ప్రచారం",
+  "చెప్పి",
+  "సంబంధిత",
+  "దూరం",
+  "కథలు",
+  "ఈమె",
+  "గానీ",
+  "మార్గం",
+  "రవాణా",
+  "సి",
+  "మళ్ళీ",
+  "గుంటూరు",
+  "మూడవ",
+  "దీనిలో",
+  "తమకు",
+  "పోలీసు",
+  "వేరు",
+  "అధికార",
+  "వాడు",
+  "రెడ్డి",
+  "న్యూఢిల్లీ",
+  "ప్రాంతాలలో",
+  "భారతదేశంలో",
+  "మొట్టమొదటి",
+  "ఎప్పుడూ",
+  "16",
+  "ఆదివారం",
+  "అర్ధం",
+  "14",
+  "చేతిలో",
+  "నగర్",
+  "కె",
+  "నేపథ్యంలో",
+  "సంయుక్త",
+  "క్రితం",
+  "అన్నది",
+  "వెళ్లి",
+  "నాడు",
+  "ప్రక్రియ",
+  "నేడు",
+  "ఇప్పటికే",
+  "రైల్వే",
+  "చివరకు",
+  "ఉదయం",
+  "ఉన్నాడు",
+  "ఎస్",
+  "చూడండి",
+  "కవి",
+  "మహిళలు",
+  "పిల్లల",
+  "24",
+  "కంప్యూటర్",
+  "పద్ధతి",
+  "జీవితంలో",
+  "ఒకసారి",
+  "నిర్మించిన",
+  "ఉన్నా",
+  "ఉన్నప్పుడు",
+  "సాంస్కృతిక",
+  "రోజుల్లో",
+  "తెలుగులో",
+  "విశ్వవిద్యాలయం",
+  "అక్కడి",
+  "నిర్మాణ",
+  "పుస్తకం",
+  "నవంబర్",
+  "ఢిల్లీ",
+  "2007",
+  "సంగతి",
+  "ఏమీ",
+  "ఇందుకు",
+  "సెప్టెంబర్",
+  "ఏం",
+  "ముందే",
+  "జాతి",
+  "వెనుక",
+  "మార్కెట్",
+  "అక్టోబర్",
+  "ఇంటికి",
+  "సినీ",
+  "ఇంత",
+  "మ్యాచ్",
+  "ఆందోళన",
+  "చివరికి",
+  "లభించింది",
+  "అవకాశాలు",
+  "ఎనిమిది",
+  "ఎన్నికల",
+  "ఎవరు",
+  "కాదని",
+  "పురాతన",
+  "ప్రజా",
+  "ఎవరూ",
+  "ఎ",
+  "విలువ",
+  "దారి",
+  "యుద్ధ",
+  "అఫ్",
+  "ప్రసారం",
+  "గంటల",
+  "ప్రారంభ",
+  "కొనుగోలు",
+  "చూస్తే",
+  "కిలోమీటర్ల",
+  "ఇంట్లో",
+  "ధర",
+  "రైలు",
+  "13",
+  "అంశం",
+  "భక్తులు",
+  "తరచూ",
+  "వద్దకు",
+  "ఇచ్చారు",
+  "డబ్బు",
+  "అందరికీ",
+  "కృష్ణ",
+  "ప్రారంభించారు",
+  "ఇప్పటి",
+  "చేసుకుని",
+  "సేవలు",
+  "ప్రమాదం",
+  "సరఫరా",
+  "సొంత",
+  "కొత్తగా",
+  "పత్రిక",
+  "దూరంగా",
+  "చిత్రానికి",
+  "ఆంధ్రప్రదేశ్",
+  "ఉపయోగించి",
+  "ప్రాచీన",
+  "ఆహారం",
+  "సమావేశంలో",
+  "బృందం",
+  "వాటికి",
+  "వాతావరణం",
+  "తనను",
+  "ప్రభుత్వానికి",
+  "ప్రధాని",
+  "జాన్",
+  "తరగతి",
+  "విషయాలు",
+  "మంచిది",
+  "ఆసక్తి",
+  "మహా",
+  "వస్తే",
+  "రికార్డు",
+  "తమిళ",
+  "ఎన్ని",
+  "చిత్రాన్ని",
+  "సహజ",
+  "జారీ",
+  "రూపాయల",
+  "భాషా",
+  "ఉన్నప్పటికీ",
+  "అవార్డు",
+  "నేటి",
+  "వచ్చారు",
+  "తీవ్రంగా",
+  "జీవిత",
+  "మీడియా",
+  "ఎం",
+  "సముద్ర",
+  "సాధించింది",
+  "రకమైన",
+  "డిమాండ్",
+  "సహాయం",
+  "ఉండవచ్చు",
+  "నేరుగా",
+  "వృత్తి",
+  "2006",
+  "కాస్త",
+  "వాళ్ళు",
+  "చరిత్రలో",
+  "అనుమతి",
+  "మహబూబ్",
+  "బుధవారం",
+  "నాయకుడు",
+  "కుమారుడు",
+  "దేశానికి",
+  "రూపాయలు",
+  "గాంధీ",
+  "తీసుకొని",
+  "17",
+  "ఏర్పడింది",
+  "పైకి",
+  "లలో",
+  "ఇచ్చి",
+  "ఆట",
+  "పాత్రను",
+  "గ్రామానికి",
+  "మహబూబ్ నగర్",
+  "మూడో",
+  "రావడం",
+  "చాలామంది",
+  "మరీ",
+  "స్పష్టంగా",
+  "జనరల్",
+  "రంగారెడ్డి",
+  "మిలియన్",
+  "అదనపు",
+  "మొదలు",
+  "తదితర",
+  "నిర్వహించారు",
+  "నెలల",
+  "దేశాలలో",
+  "సమీపంలో",
+  "లక్షణాలు",
+  "చేస్తాయి",
+  "పారిశ్రామిక",
+  "ముగ్గురు",
+  "వివరాలు",
+  "కోర్టు",
+  "కుటుంబం",
+  "గాలి",
+  "కళాశాల",
+  "చెప్పింది",
+  "రేడియో",
+  "క్రింద",
+  "ప్రసిద్ధి",
+  "భాషలో",
+  "ధరలు",
+  "చక్కగా",
+  "భాగంలో",
+  "స్వయంగా",
+  "శాంతి",
+  "దాంతో",
+  "సంస్థల",
+  "అమెరికాలో",
+  "ఇండియన్",
+  "ప్రకృతి",
+  "ఉపయోగించే",
+  "వరుసగా",
+  "చేయబడింది",
+  "తరఫున",
+  "ప్రారంభం",
+  "ఆధ్వర్యంలో",
+  "సమాచార",
+  "ఏళ్ల",
+  "కార్యక్రమంలో",
+  "నీటిని",
+  "వేగంగా",
+  "ఉంటుందని",
+  "ఒకవేళ",
+  "ఇంగ్లాండ్",
+  "ఏది",
+  "గ్రామీణ",
+  "పిల్లలకు",
+  "21",
+  "ఆలోచన",
+  "పెరిగింది",
+  "పార్టీకి",
+  "ప్రకటించింది",
+  "వరల్డ్",
+  "శ్రీకాకుళం",
+  "లను",
+  "జరుగుతున్న",
+  "23",
+  "హిందీ",
+  "కొంచెం",
+  "తద్వారా",
+  "శతాబ్దం",
+  "న్యూ",
+  "మత",
+  "రాష్ట్రములోని",
+  "పెళ్లి",
+  "రాజధాని",
+  "తీవ్రమైన",
+  "రచన",
+  "రద్దు",
+  "ఉండడం",
+  "మండలము",
+  "అభిప్రాయం",
+  "చేయవచ్చు",
+  "రోజున",
+  "భారతదేశం",
+  "అవగాహన",
+  "క్రమంగా",
+  "ప్రకటన",
+  "ఖర్చు",
+  "చోటు",
+  "ఆసియా",
+  "వృద్ధి",
+  "సమాచారాన్ని",
+  "దశలో",
+  "నమ్మకం",
+  "దృష్టిలో",
+  "సినిమాలో",
+  "విభాగం",
+  "విధమైన",
+  "చర్చలు",
+  "మ్యాచ్‌లో",
+  "2013",
+  "విధానాన్ని",
+  "బంగారు",
+  "అంశాలు",
+  "ఎన్నికల్లో",
+  "జపాన్",
+  "బ్యాంక్",
+  "కావచ్చు",
+  "తెలుసు",
+  "బయట",
+  "ఎవరైనా",
+  "పెద్దగా",
+  "మేము",
+  "వేరే",
+  "ఇచ్చే",
+  "బ్యాంకు",
+  "అటువంటి",
+  "చూసిన",
+  "వున్నాయి",
+  "నిర్మాత",
+  "నటించిన",
+  "జీవన",
+  "పూర్వం",
+  "విశేషం",
+  "ఉండేవి",
+  "నిర్వహించిన",
+  "ఉద్యమం",
+  "దిశగా",
+  "పరిస్థితులు",
+  "పుట్టిన",
+  "చేసుకున్న",
+  "19",
+  "తెలిసిన",
+  "ప్రకటించారు",
+  "రావు",
+  "సమావేశం",
+  "నష్టం",
+  "ఆదాయం",
+  "40",
+  "సందర్భంలో",
+  "దర్శకత్వం",
+  "అధికారం",
+  "తెలుగుదేశం",
+  "తేదీన",
+  "కలదు",
+  "ఫ్రెంచ్",
+  "సినిమాలు",
+  "2011",
+  "అటు",
+  "ప్రభావితం",
+  "2004",
+  "అనుగుణంగా",
+  "ప్రాధాన్యత",
+  "వ్యక్తులు",
+  "దర్శకత్వంలో",
+  "నాటక",
+  "పడి",
+};
+const uint16_t WA_FREQ_160_RANKS[] = {
+  0, 0, 0, 0, 837, 0, 0, 537, 0, 0, 0, 789, 0, 188, 435, 289,
+  506, 367, 829, 924, 988, 0, 69, 82, 710, 0, 0, 717, 0, 690, 0, 0,
+  0, 0, 0, 0, 7, 0, 0, 0, 304, 0, 0, 206, 178, 0, 0, 332,
+  0, 0, 0, 0, 708, 0, 0, 216, 912, 905, 576, 0, 170, 403, 525, 154,
+  556, 719, 727, 853, 750, 0, 0, 0, 0, 0, 395, 884, 0, 0, 0, 280,
+  0, 0, 0, 0, 0, 0, 350, 428, 0, 68, 0, 0, 613, 445, 0, 0,
+  1, 736, 0, 0, 0, 168, 0, 0, 13, 0, 977, 110, 915, 0, 0, 0,
+  0, 0, 543, 850, 0, 0, 0, 0, 0, 0, 658, 0, 0, 0, 542, 406,
+  958, 0, 0, 351, 0, 490, 322, 176, 510, 657, 868, 0, 0, 0, 0, 0,
+  0, 353, 551, 579, 241, 696, 825, 878, 906, 804, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 196, 0, 0, 0, 0, 422, 930, 0, 768, 327, 0,
+  0, 0, 436, 0, 0, 375, 0, 0, 0, 0, 0, 609, 421, 946, 0, 524,
+  0, 489, 0, 0, 54, 0, 0, 0, 0, 0, 0, 0, 215, 279, 43, 141,
+  587, 0, 85, 217, 295, 0, 121, 648, 899, 945, 600, 0, 0, 0, 0, 0,
+  954, 623, 0, 58, 928, 787, 0, 0, 0, 0, 45, 0, 0, 0, 227, 0,
+  0, 0, 0, 131, 517, 984, 0, 964, 0, 0, 306, 0, 0, 66, 430, 0,
+  0, 0, 0, 0, 0, 9, 611, 0, 374, 429, 0, 0, 0, 0, 826, 88,
+  161, 0, 0, 0, 51, 667, 0, 527, 0, 278, 726, 0, 364, 749, 0, 0,
+  0, 0, 0, 508, 495, 389, 534, 992, 0, 0, 5, 70, 0, 259, 672, 691,
+  700, 0, 0, 0, 312, 338, 113, 201, 0, 193, 0, 383, 0, 37, 0, 976,
+  0, 0, 329, 298, 835, 923, 29, 256, 0, 150, 0, 0, 0, 0, 282, 0,
+  166, 0, 127, 501, 0, 0, 0, 0, 0, 0, 0, 97, 0, 0, 0, 0,
+  249, 337, 442, 621, 0, 129, 0, 0, 0, 0, 0, 0, 0, 86, 0, 902,
+  0, 0, 0, 402, 444, 699, 0, 286, 352, 0, 0, 0, 0, 0, 626, 0,
+  0, 231, 440, 299, 380, 180, 630, 735, 0, 0, 0, 799, 0, 0, 0, 288,
+  0, 0, 0, 109, 687, 151, 639, 702, 0, 0, 0, 0, 0, 0, 552, 358,
+  0, 25, 0, 236, 394, 413, 791, 409, 682, 852, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 20, 15, 197, 155, 284, 478, 545, 608, 0, 378, 0, 0, 555,
+  934, 0, 601, 0, 0, 0, 0, 0, 841, 0, 0, 0, 720, 0, 0, 0,
+  0, 0, 640, 160, 0, 0, 53, 0, 339, 514, 0, 0, 0, 0, 0, 254,
+  929, 0, 0, 0, 0, 0, 149, 622, 164, 519, 792, 0, 404, 985, 594, 257,
+  0, 0, 695, 779, 0, 0, 0, 0, 0, 0, 0, 0, 108, 0, 0, 839,
+  106, 0, 0, 0, 0, 0, 112, 115, 0, 761, 638, 449, 955, 0, 0, 0,
+  701, 631, 692, 323, 239, 195, 432, 617, 0, 0, 0, 697, 830, 0, 0, 387,
+  0, 207, 504, 0, 0, 0, 0, 0, 0, 0, 0, 0, 677, 0, 0, 356,
+  427, 437, 559, 935, 674, 0, 783, 0, 889, 0, 0, 0, 0, 618, 831, 0,
+  0, 21, 458, 0, 0, 0, 563, 0, 521, 751, 208, 203, 80, 880, 919, 0,
+  925, 754, 0, 0, 0, 643, 0, 0, 0, 0, 566, 0, 872, 0, 0, 0,
+  0, 0, 0, 385, 362, 0, 943, 838, 0, 0, 0, 0, 0, 564, 482, 0,
+  0, 676, 0, 189, 0, 0, 0, 936, 0, 0, 420, 927, 0, 114, 0, 0,
+  0, 0, 293, 891, 0, 46, 778, 220, 0, 765, 0, 0, 0, 0, 0, 265,
+  575, 742, 357, 0, 0, 219, 471, 0, 0, 0, 916, 175, 0, 263, 0, 0,
+  533, 0, 0, 52, 99, 0, 50, 921, 0, 806, 335, 388, 0, 461, 0, 0,
+  0, 637, 528, 746, 139, 233, 111, 718, 909, 646, 469, 971, 0, 951, 959, 0,
+  0, 656, 635, 644, 641, 757, 785, 730, 786, 981, 92, 986, 876, 0, 0, 540,
+  0, 753, 492, 0, 0, 0, 0, 800, 0, 862, 0, 232, 0, 390, 604, 758,
+  0, 0, 214, 253, 496, 803, 0, 397, 0, 907, 0, 0, 675, 456, 591, 0,
+  0, 47, 0, 137, 731, 0, 585, 0, 0, 0, 343, 0, 0, 0, 913, 386,
+  668, 140, 0, 0, 0, 0, 592, 296, 22, 614, 0, 0, 321, 560, 515, 660,
+  849, 0, 0, 0, 309, 821, 557, 0, 607, 0, 0, 0, 870, 589, 465, 199,
+  706, 0, 596, 903, 379, 549, 0, 896, 0, 74, 911, 0, 0, 770, 530, 811,
+  0, 94, 0, 0, 0, 477, 2, 796, 287, 590, 966, 460, 562, 0, 0, 567,
+  606, 860, 0, 0, 775, 0, 0, 0, 0, 0, 0, 355, 324, 723, 237, 893,
+  0, 0, 4, 202, 0, 463, 801, 130, 573, 0, 443, 347, 125, 0, 0, 0,
+  0, 0, 0, 0, 116, 0, 832, 0, 411, 359, 270, 0, 377, 0, 0, 965,
+  224, 72, 814, 96, 813, 0, 218, 0, 0, 0, 0, 0, 0, 0, 0, 932,
+  0, 0, 0, 0, 0, 0, 844, 0, 0, 0, 475, 0, 0, 0, 433, 39,
+  0, 348, 8, 472, 336, 491, 595, 855, 836, 78, 135, 0, 0, 593, 0, 0,
+  0, 0, 331, 0, 0, 0, 950, 405, 0, 0, 0, 0, 0, 416, 0, 0,
+  910, 0, 0, 0, 0, 0, 242, 0, 819, 0, 0, 802, 0, 396, 520, 582,
+  584, 133, 174, 820, 159, 898, 0, 0, 398, 457, 488, 523, 502, 759, 328, 0,
+  67, 100, 330, 724, 0, 0, 392, 532, 0, 0, 0, 0, 181, 0, 0, 41,
+  0, 0, 0, 511, 0, 0, 0, 0, 892, 0, 33, 0, 0, 305, 0, 0,
+  0, 0, 0, 920, 541, 0, 918, 0, 0, 340, 167, 144, 40, 0, 200, 713,
+  0, 134, 0, 102, 122, 0, 0, 743, 342, 370, 0, 0, 0, 0, 34, 473,
+  0, 580, 246, 0, 0, 0, 0, 0, 535, 628, 680, 728, 0, 0, 815, 0,
+  480, 261, 0, 145, 0, 0, 476, 0, 275, 0, 0, 0, 0, 0, 0, 0,
+  0, 124, 507, 194, 128, 138, 0, 0, 858, 0, 0, 0, 0, 438, 781, 662,
+  6, 366, 597, 0, 0, 996, 0, 454, 118, 18, 0, 71, 756, 418, 773, 0,
+  0, 464, 0, 0, 848, 0, 0, 962, 823, 177, 361, 0, 60, 0, 0, 879,
+  993, 431, 0, 0, 0, 942, 0, 0, 0, 31, 119, 27, 497, 856, 17, 937,
+  963, 283, 634, 0, 483, 213, 371, 642, 262, 0, 0, 0, 0, 846, 0, 0,
+  0, 38, 810, 0, 707, 229, 0, 0, 0, 0, 24, 276, 0, 0, 0, 565,
+  0, 0, 42, 341, 960, 0, 711, 16, 616, 157, 0, 0, 0, 315, 503, 0,
+  64, 143, 209, 0, 171, 0, 0, 372, 0, 0, 245, 0, 0, 0, 0, 513,
+  0, 264, 650, 0, 747, 0, 285, 187, 0, 384, 0, 62, 316, 373, 0, 705,
+  0, 0, 0, 451, 851, 603, 0, 0, 0, 0, 424, 0, 0, 0, 669, 23,
+  147, 172, 365, 243, 484, 0, 0, 684, 0, 307, 961, 558, 36, 522, 0, 0,
+  32, 0, 0, 769, 426, 0, 415, 0, 0, 238, 467, 0, 0, 0, 186, 360,
+  974, 0, 0, 0, 0, 0, 0, 0, 0, 0, 393, 0, 745, 0, 0, 0,
+  0, 0, 982, 1000, 0, 0, 500, 89, 741, 0, 0, 0, 0, 126, 252, 0,
+  0, 55, 0, 450, 0, 0, 0, 153, 807, 0, 318, 953, 401, 539, 598, 901,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 313, 414, 645, 782, 77,
+  136, 602, 479, 156, 103, 163, 599, 703, 90, 87, 0, 0, 764, 0, 0, 633,
+  881, 0, 0, 0, 0, 0, 0, 0, 0, 65, 0, 0, 0, 572, 882, 941,
+  980, 0, 226, 0, 0, 0, 0, 0, 0, 548, 0, 544, 240, 326, 983, 266,
+  0, 0, 173, 605, 0, 291, 0, 0, 0, 0, 721, 152, 0, 933, 859, 0,
+  0, 0, 0, 897, 381, 686, 722, 244, 198, 93, 230, 281, 0, 182, 0, 647,
+  474, 0, 485, 101, 0, 0, 248, 325, 788, 292, 818, 0, 0, 76, 0, 349,
+  105, 211, 780, 0, 0, 0, 0, 0, 399, 877, 185, 0, 0, 0, 0, 0,
+  0, 19, 267, 968, 973, 0, 0, 0, 0, 0, 308, 0, 0, 165, 0, 0,
+  0, 654, 0, 369, 447, 588, 938, 659, 410, 345, 455, 694, 553, 91, 499, 729,
+  808, 871, 895, 0, 0, 0, 627, 0, 0, 0, 0, 0, 14, 0, 11, 481,
+  610, 624, 0, 0, 0, 817, 0, 0, 0, 132, 391, 725, 812, 0, 0, 26,
+  0, 290, 0, 277, 423, 56, 978, 651, 434, 0, 28, 0, 273, 578, 0, 0,
+  95, 0, 847, 774, 192, 0, 0, 0, 0, 0, 0, 967, 795, 0, 0, 0,
+  763, 425, 698, 671, 885, 234, 526, 619, 678, 368, 772, 0, 0, 755, 0, 0,
+  998, 0, 0, 0, 0, 0, 0, 0, 0, 816, 0, 999, 777, 462, 843, 908,
+  0, 84, 547, 944, 0, 0, 0, 888, 0, 970, 468, 0, 0, 0, 158, 319,
+  0, 655, 0, 408, 0, 531, 117, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 509, 459, 883, 931, 0, 0, 0, 190, 0, 0, 63, 0, 83, 317,
+  947, 0, 0, 0, 0, 0, 0, 842, 0, 0, 952, 863, 0, 148, 0, 987,
+  0, 0, 169, 748, 737, 0, 776, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  311, 554, 0, 681, 212, 0, 204, 0, 0, 797, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 914, 0, 620, 0, 538, 0, 894, 0, 0, 0, 0, 875, 0,
+  0, 79, 0, 272, 57, 0, 0, 805, 0, 704, 833, 30, 0, 0, 561, 223,
+  505, 546, 649, 734, 827, 917, 0, 0, 107, 0, 865, 439, 354, 0, 0, 0,
+  333, 0, 98, 120, 268, 0, 0, 0, 205, 498, 314, 663, 712, 0, 146, 586,
+  225, 688, 991, 940, 794, 0, 0, 0, 104, 762, 867, 0, 0, 0, 957, 0,
+  0, 632, 0, 0, 0, 0, 0, 0, 142, 0, 767, 0, 0, 0, 0, 824,
+  857, 0, 793, 486, 81, 452, 0, 890, 995, 0, 73, 417, 979, 0, 487, 0,
+  0, 0, 210, 0, 48, 512, 0, 752, 784, 0, 301, 861, 869, 0, 344, 666,
+  61, 625, 529, 0, 0, 184, 0, 0, 0, 0, 0, 969, 0, 571, 0, 0,
+  419, 0, 0, 0, 577, 0, 0, 0, 685, 874, 0, 864, 269, 470, 0, 0,
+  0, 0, 0, 0, 581, 926, 0, 0, 446, 0, 0, 0, 494, 0, 568, 636,
+  570, 255, 59, 258, 260, 733, 744, 887, 975, 612, 0, 302, 583, 536, 0, 845,
+  0, 0, 0, 739, 294, 771, 679, 448, 0, 376, 873, 0, 0, 0, 0, 0,
+  453, 0, 828, 0, 274, 0, 300, 550, 904, 989, 0, 0, 0, 615, 972, 44,
+  653, 866, 900, 247, 0, 574, 886, 228, 670, 854, 0, 0, 0, 382, 652, 221,
+  661, 689, 997, 162, 0, 0, 310, 0, 714, 693, 493, 49, 732, 766, 948, 0,
+  407, 412, 0, 441, 922, 235, 0, 0, 123, 518, 994, 569, 0, 0, 0, 715,
+  400, 0, 0, 0, 0, 798, 822, 251, 466, 334, 629, 709, 673, 760, 0, 664,
+  0, 0, 840, 0, 0, 363, 0, 0, 0, 516, 738, 834, 0, 0, 0, 0,
+  0, 191, 0, 0, 0, 0, 12, 0, 949, 0, 809, 0, 0, 0, 271, 740,
+  222, 0, 346, 665, 0, 0, 0, 0, 75, 320, 0, 0, 0, 0, 0, 0,
+  3, 0, 0, 35, 183, 0, 0, 0, 0, 303, 939, 790, 990, 0, 0, 0,
+  0, 0, 0, 0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 956, 250,
+  0, 0, 683, 716, 0, 0, 0, 0, 0, 0, 179, 0, 0, 297, 0, 0,
+};
+
+const char *WA_FREQ_161_TOKENS[] = {
+  "дар",
+  "ба",
+  "ва",
+  "аз",
+  "ки",
+  "ин",
+  "бо",
+  "аст",
+  "Тоҷикистон",
+  "барои",
+  "Дар",
+  "як",
+  "он",
+  "соли",
+  "мо",
+  "то",
+  "карда",
+  "мешавад",
+  "шуд",
+  "кард",
+  "дигар",
+  "буд",
+  "ё",
+  "Ба",
+  "онҳо",
+  "Ин",
+  "дорад",
+  "ҳам",
+  "худ",
+  "шудааст",
+  "низ",
+  "кишвар",
+  "бояд",
+  "гуфт",
+  "мекунад",
+  "Русия",
+  "Ҷумҳурии",
+  "худро",
+  "мекунанд",
+  "Аз",
+  "ду",
+  "бар",
+  "ӯ",
+  "шаҳри",
+  "бошад",
+  "кор",
+  "Душанбе",
+  "Ҷумҳурии Тоҷикистон",
+  "нафар",
+  "нест",
+  "ман",
+  "шуда",
+  "мегӯяд",
+  "чунин",
+  "хоҳад",
+  "Аммо",
+  "шавад",
+  "сол",
+  "дода",
+  "бораи",
+  "кардааст",
+  "мебошад",
+  "кунад",
+  "рӯзи",
+  "на",
+  "ҳамин",
+  "доранд",
+  "қарор",
+  "кардани",
+  "даст",
+  "ҳар",
+  "пеш",
+  "карданд",
+  "хам",
+  "тоҷик",
+  "боз",
+  "агар",
+  "яке",
+  "Афғонистон",
+  "Амрико",
+  "дод",
+  "мардуми",
+  "чи",
+  "раиси",
+  "истифода",
+  "мақомоти",
+  "мардум",
+  "Эрон",
+  "мешаванд",
+  "вале",
+  "шудаанд",
+  "Агар",
+  "аммо",
+  "моҳи",
+  "шумо",
+  "кунанд",
+  "Бо",
+  "бештар",
+  "ягон",
+  "кишварҳои",
+  "зиёд",
+  "Ман",
+  "Барои",
+  "ҳама",
+  "давлатӣ",
+  "ҳазор",
+  "кардаанд",
+  "танҳо",
+  "онро",
+  "Шумо",
+  "гузашта",
+  "номи",
+  "шуданд",
+  "буданд",
+  "мавриди",
+  "давлат",
+  "Точикистон",
+  "имрӯз",
+  "вилояти",
+  "мегӯянд",
+  "ноҳияи",
+  "назар",
+  "Вале",
+  "тамоми",
+  "давлатии",
+  "гуфтаи",
+  "чанд",
+  "ташкил",
+  "Мо",
+  "кори",
+  "хеле",
+  "ҷумла",
+  "фаъолияти",
+  "дошт",
+  "ҷониби",
+  "шудани",
+  "медиҳад",
+  "и",
+  "гирифта",
+  "намудани",
+  "нав",
+  "Ва",
+  "мазкур",
+  "хуб",
+  "чӣ",
+  "сар",
+  "Раҳмон",
+  "надорад",
+  "Озодӣ",
+  "рушди",
+  "миёни",
+  "Эмомалӣ",
+  "корҳои",
+  "Қирғизистон",
+  "роҳи",
+  "се",
+  "байни",
+  "ҳол",
+  "миллион",
+  "пайдо",
+  "баъд",
+  "хамин",
+  "пас",
+  "гуна",
+  "дошта",
+  "давлати",
+  "буда",
+  "намуд",
+  "гардид",
+  "Вай",
+  "роҳ",
+  "ҳукумати",
+  "миллӣ",
+  "Ӯ",
+  "миллии",
+  "миллат",
+  "ba",
+  "нави",
+  "кишвари",
+  "баъди",
+  "забони",
+  "ҷо",
+  "беш",
+  "идома",
+  "кардан",
+  "метавонад",
+  "анҷом",
+  "ki",
+  "Эмомалӣ Раҳмон",
+  "оид",
+  "баргузор",
+  "тарафи",
+  "сари",
+  "ширкат",
+  "солҳои",
+  "рӯз",
+  "назди",
+  "ҳоло",
+  "ҳуқуқи",
+  "онхо",
+  "dar",
+  "хама",
+  "кунед",
+  "Узбакистон",
+  "сомонӣ",
+  "вай",
+  "кушта",
+  "1",
+  "ширкати",
+  "ҳамаи",
+  "Президенти",
+  "гуфта",
+  "Маҷлиси",
+  "Покистон",
+  "нишон",
+  "вақти",
+  "ҳамчунин",
+  "сурат",
+  "чун",
+  "ту",
+  "пешниҳод",
+  "Маскав",
+  "Вазорати",
+  "Як",
+  "кормандони",
+  "хабар",
+  "Сурия",
+  "az",
+  "мегирад",
+  "гирифт",
+  "онҳоро",
+  "аввал",
+  "намуда",
+  "балки",
+  "ИМА",
+  "умури",
+  "бошанд",
+  "рӯи",
+  "бе",
+  "гуфтааст",
+  "баланд",
+  "ро",
+  "хоҳанд",
+  "интихоботи",
+  "охир",
+  "мисли",
+  "Аврупо",
+  "кам",
+  "хориҷӣ",
+  "2",
+  "сиёсӣ",
+  "дасти",
+  "дигари",
+  "мегардад",
+  "муайян",
+  "қабул",
+  "баррасӣ",
+  "ворид",
+  "меравад",
+  "хар",
+  "менамояд",
+  "бисёр",
+  "20",
+  "додааст",
+  "ҳамчун",
+  "бор",
+  "маводи",
+  "асоси",
+  "сӯи",
+  "вазири",
+  "додани",
+  "мақоми",
+  "худи",
+  "va",
+  "гурӯҳи",
+  "таъмин",
+  "точик",
+  "моро",
+  "доллар",
+  "ҷаҳон",
+  "даъват",
+  "шаванд",
+  "ӯро",
+  "эълон",
+  "10",
+  "Ҳукумати",
+  "оғоз",
+  "вазъи",
+  "Чин",
+  "мекунам",
+  "Шӯрои",
+  "афзуд",
+  "касе",
+  "зери",
+  "мекард",
+  "Осиёи",
+  "амал",
+  "нерӯҳои",
+  "у",
+  "зидди",
+  "рӯ",
+  "зеро",
+  "вуҷуд",
+  "5",
+  "соҳаи",
+  "баъзе",
+  "маркази",
+  "хотири",
+  "замони",
+  "мешуд",
+  "Рӯзи",
+  "сатҳи",
+  "Созмони",
+  "3",
+  "кадом",
+  "2013",
+  "яъне",
+  "амнияти",
+  "доданд",
+  "ҳисоби",
+  "давраи",
+  "шароити",
+  "боздошт",
+  "оянда",
+  "фаъолият",
+  "Тоҷикистонро",
+  "медиҳанд",
+  "намояд",
+  "ҳангоми",
+  "тибқи",
+  "бахши",
+  "ҳанӯз",
+  "шаҳр",
+  "намояндагони",
+  "Зеро",
+  "таъмини",
+  "ҳастанд",
+  "Соли",
+  "Ном",
+  "ҳеҷ",
+  "ҳукумат",
+  "мебошанд",
+  "берун",
+  "Кумитаи",
+  "Радиои",
+  "Қонуни",
+  "боло",
+  "ҷорӣ",
+  "Худо",
+  "асосии",
+  "раҳбари",
+  "масъалаи",
+  "in",
+  "ҷумҳурӣ",
+  "минтақа",
+  "ёфт",
+  "маҳсулоти",
+  "кунем",
+  "То",
+  "Бонки",
+  "мубориза",
+  "Қазоқистон",
+  "Имрӯз",
+  "байналмилалӣ",
+  "алайҳи",
+  "будааст",
+  "сокинони",
+  "вазорати",
+  "аввали",
+  "таъкид",
+  "таври",
+  "ҳудуди",
+  "дорам",
+  "истифодаи",
+  "иқтисодӣ",
+  "намуданд",
+  "ҷои",
+  "СММ",
+  "кас",
+  "асари",
+  "4",
+  "сабаби",
+  "хориҷии",
+  "фикр",
+  "маълум",
+  "аъзои",
+  "ҳифзи",
+  "инчунин",
+  "надоранд",
+  "мумкин",
+  "маҳаллӣ",
+  "Мақомоти",
+  "нисбат",
+  "об",
+  "мекарданд",
+  "ҷавонон",
+  "намешавад",
+  "сиёсати",
+  "11",
+  "узви",
+  "замон",
+  "ном",
+  "амалӣ",
+  "озод",
+  "шояд",
+  "Онҳо",
+  "минтақаи",
+  "барномаи",
+  "таҳти",
+  "наздик",
+  "тавассути",
+  "ҳатто",
+  "мамлакат",
+  "иҷрои",
+  "мекунем",
+  "назари",
+  "баробари",
+  "доир",
+  "мулоқот",
+  "гирифтани",
+  "Июн",
+  "муҳтарам",
+  "ҷараёни",
+  "Соат",
+  "ҷиҳати",
+  "интихобот",
+  "Ҳоло",
+  "дунё",
+  "гирифтааст",
+  "маблағи",
+  "шахси",
+  "фикри",
+  "қонун",
+  "Раиси",
+  "вақт",
+  "ҳамон",
+  "Бино",
+  "доштанд",
+  "30",
+  "тақрибан",
+  "инсон",
+  "хел",
+  "муовини",
+  "метавонанд",
+  "Пешвои",
+  "бори",
+  "ҳизби",
+  "натиҷаи",
+  "Он",
+  "вобаста",
+  "гардида",
+  "не",
+  "хамаи",
+  "Радиои Озодӣ",
+  "сурати",
+  "интихоб",
+  "сӯҳбат",
+  "ҷойи",
+  "ҷаҳонӣ",
+  "чаро",
+  "иштирок",
+  "бозори",
+  "дорем",
+  "моҳ",
+  "таърихи",
+  "иҷро",
+  "зиндагӣ",
+  "ҳамкорӣ",
+  "дуруст",
+  "ҳоле",
+  "кулли",
+  "расид",
+  "ҳуқуқ",
+  "нашр",
+  "бархе",
+  "низоми",
+  "ҷумҳури",
+  "таъсис",
+  "Обама",
+  "равон",
+  "будани",
+  "пул",
+  "омад",
+  "намоянд",
+  "бузург",
+  "оварда",
+  "омода",
+  "Марказӣ",
+  "боиси",
+  "ахир",
+  "лозим",
+  "Худованд",
+  "гап",
+  "шурӯъ",
+  "қисми",
+  "шахсони",
+  "корӣ",
+  "Туркия",
+  "бора",
+  "Пас",
+  "шудан",
+  "миллати",
+  "доираи",
+  "дорои",
+  "мерасад",
+  "нисбати",
+  "Президенти Ҷумҳурии Тоҷикистон",
+  "Ҳизби",
+  "6",
+  "зиндагии",
+  "Маркази",
+  "омада",
+  "сокини",
+  "замин",
+  "барқ",
+  "раисиҷумҳури",
+  "муҳим",
+  "дохилӣ",
+  "шаҳрвандони",
+  "ҳамла",
+  "талаб",
+  "бидуни",
+  "ҷомеа",
+  "сафари",
+  "умумии",
+  "Осиёи Марказӣ",
+  "омадааст",
+  "изҳори",
+  "тартиби",
+  "табдил",
+  "15",
+  "баробар",
+  "шумораи",
+  "НАТО",
+  "бовар",
+  "хеч",
+  "имзо",
+  "диҳад",
+  "боқӣ",
+  "нашудааст",
+  "Хуҷанд",
+  "сохтмони",
+  "ҳолати",
+  "7",
+  "байналмилалии",
+  "нафари",
+  "зиёда",
+  "маълумоти",
+  "кишварро",
+  "сохта",
+  "Бадахшон",
+  "ҳисоб",
+  "расмӣ",
+  "раёсати",
+  "ноҳия",
+  "масъалаҳои",
+  "иҷтимоӣ",
+  "бунёди",
+  "додгоҳ",
+  "сафар",
+  "маҳкум",
+  "нишасти",
+  "Россия",
+  "ҳалли",
+  "ҷомеаи",
+  "мегиранд",
+  "зан",
+  "гардидааст",
+  "имкон",
+  "100",
+  "наметавонад",
+  "дур",
+  "меояд",
+  "Путин",
+  "бузурги",
+  "Хатлон",
+  "хамон",
+  "ёфтааст",
+  "гузошта",
+  "зиндон",
+  "Суғд",
+  "ислом",
+  "таҳсил",
+  "унвони",
+  "Тибқи",
+  "Ҳамчунин",
+  "болои",
+  "пайи",
+  "вуҷуди",
+  "ёфта",
+  "8",
+  "давоми",
+  "талаботи",
+  "иттилои",
+  "Тоҷикистону",
+  "рафта",
+  "ҷанги",
+  "вилоят",
+  "бурда",
+  "Кӯлоб",
+  "камтар",
+  "чизе",
+  "қавли",
+  "президент",
+  "пули",
+  "ҳайати",
+  "талош",
+  "бунёд",
+  "исломӣ",
+  "қаламрави",
+  "рад",
+  "мақомот",
+  "муассисаҳои",
+  "дида",
+  "иборат",
+  "Яъне",
+  "нигоҳ",
+  "инро",
+  "сад",
+  "тариқи",
+  "додаанд",
+  "истеҳсоли",
+  "ҳоли",
+  "амалиёти",
+  "Толибон",
+  "хаст",
+  "олии",
+  "танхо",
+  "ҳодиса",
+  "соҳиби",
+  "назорати",
+  "Бояд",
+  "афроди",
+  "пешбинӣ",
+  "Бар",
+  "маро",
+  "овард",
+  "асри",
+  "ҳукми",
+  "масъала",
+  "нархи",
+  "мебаранд",
+  "кӯмак",
+  "аксари",
+  "гурӯҳҳои",
+  "ҳолест",
+  "корхонаи",
+  "намудааст",
+  "Ислом",
+  "президенти",
+  "Миср",
+  "муқаррар",
+  "акнун",
+  "дохил",
+  "бинои",
+  "миллиард",
+  "дохилии",
+  "меёбад",
+  "намекунад",
+  "гуфтанд",
+  "мушкилоти",
+  "хона",
+  "қабл",
+  "Олии",
+  "амали",
+  "зарур",
+  "ҳамкории",
+  "беҳтар",
+  "робита",
+  "зикр",
+  "кадар",
+  "мехоҳад",
+  "вориди",
+  "истодааст",
+  "нестанд",
+  "пурра",
+  "амрикоӣ",
+  "12",
+  "оғози",
+  "тавр",
+  "суд",
+  "шаҳрванди",
+  "чоп",
+  "пойтахти",
+  "Озоди",
+  "ҳаст",
+  "дастаи",
+  "ояндаи",
+  "50",
+  "Исроил",
+  "сиёсии",
+  "азиз",
+  "барномаҳои",
+  "тасдиқ",
+  "изҳор",
+  "манъ",
+  "дини",
+  "роҳҳои",
+  "зимни",
+  "худаш",
+  "Ироқ",
+  "тарҳи",
+  "созмони",
+  "мушкил",
+  "менамоянд",
+  "ast",
+  "ҳуқуқӣ",
+  "Иттиҳоди",
+  "мактаби",
+  "нахустин",
+  "собиқ",
+  "кардем",
+  "парвандаи",
+  "ҳамкориҳои",
+  "низомии",
+  "моддаи",
+  "марбут",
+  "вақте",
+  "вазифаи",
+  "таъсири",
+  "аҳолӣ",
+  "гуногун",
+  "ҳаҷми",
+  "созмонҳои",
+  "ҳадафи",
+  "метр",
+  "низомӣ",
+  "зиёди",
+  "сифати",
+  "май",
+  "оби",
+  "муҳоҷирони",
+  "нақши",
+  "расмии",
+  "калон",
+  "қонунгузории",
+  "самти",
+  "тоҷикон",
+  "мусоидат",
+  "ҳамеша",
+  "даркор",
+  "аслии",
+  "мардумро",
+  "факат",
+  "рӯзҳои",
+  "набуд",
+  "хонаи",
+  "Донишгоҳи",
+  "мақсади",
+  "Оё",
+  "дигаре",
+  "имруз",
+  "дин",
+  "майдони",
+  "қарори",
+  "монда",
+  "фақат",
+  "дохили",
+  "Баъд",
+  "баён",
+  "mo",
+  "набояд",
+  "расидааст",
+  "охири",
+  "панҷ",
+  "сухан",
+  "масоили",
+  "Ҳукумати Ҷумҳурии Тоҷикистон",
+  "ҷой",
+  "ҳозир",
+  "қайд",
+  "Баъди",
+  "махсус",
+  "рост",
+  "миён",
+  "тонна",
+  "чои",
+  "Сарвари",
+  "намояндаи",
+  "рафт",
+  "идораи",
+  "рохи",
+  "ҳамлаи",
+  "Иттиҳодияи",
+  "шакли",
+  "Иёлоти",
+  "фароҳам",
+  "Роғун",
+  "маориф",
+  "иқтисодии",
+  "маротиба",
+  "занон",
+  "раҳбарони",
+  "мактаб",
+  "ҳаққи",
+  "радиои",
+  "Чаро",
+  "пойтахт",
+  "хукумат",
+  "сулҳу",
+  "арзёбӣ",
+  "тоҷикӣ",
+  "Фаронса",
+  "баргузории",
+  "байн",
+  "ҷавонони",
+  "дигарон",
+  "bo",
+  "Олмон",
+  "мемонад",
+  "оё",
+  "қариб",
+  "тан",
+  "қонуни",
+  "эътироф",
+  "кардам",
+  "Вазири",
+  "ёд",
+  "воқеъ",
+  "андоз",
+  "Додгоҳи",
+  "бад",
+  "муттаҳам",
+  "пешниҳоди",
+  "интиқоли",
+  "9",
+  "чо",
+  "даври",
+  "посух",
+  "фарҳанги",
+  "ошкор",
+  "доштани",
+  "дарсади",
+  "раванди",
+  "муносибати",
+  "руз",
+  "русӣ",
+  "ҷудо",
+  "созмон",
+  "25",
+  "деҳаи",
+  "чандин",
+  "баста",
+  "пеши",
+  "Бонди",
+  "иттилоъ",
+  "кишоварзӣ",
+  "фурудгоҳи",
+  "нахоҳад",
+  "ширкатҳои",
+  "ҳаёти",
+  "хориҷаи",
+  "фаро",
+  "Яке",
+  "дониста",
+  "медонад",
+  "бародар",
+  "аввалин",
+  "муроҷиат",
+  "бошед",
+  "Хоруғ",
+  "диҳанд",
+  "хориҷ",
+  "дарсад",
+  "руи",
+  "хастанд",
+  "масъулияти",
+  "татбиқи",
+  "муддати",
+  "афзоиш",
+  "мушкили",
+  "ҳизб",
+  "17",
+  "Ҳар",
+  "асосан",
+  "Албатта",
+  "мекунед",
+  "медонанд",
+  "чунки",
+  "шабакаи",
+  "ватан",
+  "кишварҳо",
+  "рус",
+  "таҳия",
+  "аҳолии",
+  "содир",
+  "Лекин",
+  "ташкили",
+  "корманди",
+  "бештари",
+  "16",
+  "апрел",
+  "Барак",
+  "устод",
+  "коҳиш",
+  "мебарад",
+  "молу",
+  "муносибатҳои",
+  "шикоят",
+  "забон",
+  "марказии",
+  "афзоиши",
+  "Владимир",
+  "лекин",
+  "ҳарбӣ",
+  "корхонаҳои",
+  "Шӯравӣ",
+  "фоиз",
+  "вакили",
+  "Украина",
+  "гузориши",
+  "ҷавон",
+  "қатъ",
+  "40",
+  "каме",
+  "зани",
+  "гирифтанд",
+  "корхона",
+  "чаҳор",
+  "машғул",
+  "нерӯи",
+  "теъдоди",
+  "дифоъ",
+  "поён",
+  "тасмим",
+  "назорат",
+  "000",
+  "миёна",
+  "таъсиси",
+  "Ҷаноби",
+  "овардани",
+  "даҳҳо",
+  "нафарро",
+  "Масалан",
+  "хизмат",
+  "кории",
+  "бемории",
+  "муҳими",
+  "пардохти",
+  "айни",
+  "Либия",
+  "ягона",
+  "Хадамоти",
+  "намекунанд",
+  "бино",
+  "гузошт",
+  "иваз",
+  "ҳуқуқии",
+  "ҷалб",
+  "айбдор",
+  "хизмати",
+  "чиз",
+  "озодии",
+  "бозӣ",
+  "будам",
+  "Ҳамин",
+  "паст",
+  "ҷиддӣ",
+  "набошад",
+  "хеш",
+  "сардори",
+  "зиндаги",
+  "модар",
+  "ҷанг",
+  "ҷамъ",
+  "хотир",
+  "гардад",
+  "ҳолатҳои",
+  "додгоҳи",
+  "баррасии",
+  "корро",
+  "200",
+  "вакт",
+  "миёнаи",
+  "18",
+  "амниятӣ",
+  "давлатҳои",
+  "далели",
+  "гуногуни",
+  "соҳаҳои",
+  "гуфтаанд",
+  "сулҳ",
+  "марзи",
+  "хохад",
+  "қабули",
+  "ҳал",
+  "ҳокимияти",
+  "март",
+  "Инчунин",
+  "уро",
+  "тайи",
+  "атрофи",
+  "манфиати",
+  "озоди",
+  "Ҳангоми",
+  "Вақте",
+  "мехоҳанд",
+  "рушд",
+  "имсол",
+  "зиёде",
+};
+const uint16_t WA_FREQ_161_RANKS[] = {
+  0, 0, 454, 0, 781, 0, 88, 0, 0, 378, 421, 593, 760, 0, 779, 0,
+  253, 0, 331, 0, 0, 0, 0, 0, 336, 0, 0, 337, 0, 0, 570, 642,
+  784, 0, 0, 0, 584, 0, 0, 0, 0, 922, 0, 616, 0, 0, 0, 192,
+  69, 0, 619, 407, 0, 0, 0, 988, 702, 163, 318, 445, 798, 255, 281, 92,
+  521, 557, 330, 173, 569, 886, 968, 995, 823, 0, 0, 0, 0, 0, 409, 489,
+  210, 0, 0, 0, 0, 0, 0, 0, 664, 559, 964, 97, 694, 544, 776, 0,
+  0, 0, 0, 200, 151, 214, 476, 505, 572, 865, 0, 0, 148, 518, 0, 376,
+  0, 289, 481, 519, 406, 761, 0, 0, 85, 355, 0, 183, 606, 0, 609, 0,
+  913, 0, 603, 0, 0, 0, 326, 0, 0, 0, 392, 822, 0, 146, 0, 0,
+  966, 0, 0, 0, 0, 0, 563, 167, 483, 916, 0, 0, 0, 0, 0, 52,
+  49, 743, 843, 841, 746, 393, 0, 0, 0, 0, 890, 976, 0, 0, 721, 343,
+  0, 0, 328, 125, 501, 0, 655, 0, 0, 942, 276, 0, 571, 0, 0, 0,
+  0, 0, 893, 0, 0, 202, 356, 672, 46, 777, 556, 0, 0, 772, 0, 0,
+  371, 10, 47, 598, 858, 667, 902, 0, 0, 0, 0, 0, 398, 0, 231, 0,
+  0, 0, 0, 0, 547, 0, 0, 0, 0, 241, 0, 475, 0, 0, 0, 8,
+  307, 15, 491, 915, 513, 0, 426, 0, 0, 0, 0, 0, 0, 0, 963, 0,
+  0, 115, 0, 0, 0, 900, 926, 0, 0, 271, 0, 482, 639, 848, 0, 0,
+  0, 0, 30, 195, 0, 0, 0, 235, 0, 0, 0, 788, 0, 0, 0, 930,
+  0, 0, 0, 0, 469, 0, 0, 405, 540, 974, 0, 0, 0, 897, 0, 0,
+  899, 765, 0, 112, 624, 985, 497, 565, 706, 147, 520, 0, 830, 221, 0, 0,
+  0, 0, 626, 0, 170, 873, 0, 627, 704, 0, 0, 220, 171, 507, 631, 747,
+  0, 0, 977, 0, 683, 736, 713, 753, 432, 574, 0, 636, 0, 0, 0, 414,
+  0, 0, 0, 0, 234, 0, 0, 0, 0, 0, 363, 905, 0, 0, 0, 950,
+  671, 0, 0, 0, 0, 0, 495, 883, 0, 928, 0, 0, 162, 473, 0, 0,
+  56, 0, 0, 0, 0, 575, 725, 168, 0, 0, 874, 0, 797, 0, 0, 936,
+  0, 306, 0, 0, 880, 689, 0, 120, 27, 972, 0, 0, 0, 0, 837, 0,
+  0, 522, 605, 632, 789, 366, 982, 984, 14, 36, 338, 438, 479, 0, 0, 0,
+  0, 548, 0, 399, 285, 717, 796, 0, 0, 0, 0, 877, 808, 940, 0, 0,
+  929, 0, 116, 0, 0, 629, 791, 35, 42, 833, 0, 710, 0, 0, 64, 149,
+  190, 817, 925, 617, 218, 727, 971, 0, 0, 0, 0, 0, 0, 2, 196, 387,
+  768, 795, 989, 860, 320, 0, 0, 111, 778, 246, 957, 141, 437, 477, 237, 20,
+  941, 365, 0, 0, 0, 0, 317, 735, 0, 0, 5, 133, 523, 592, 0, 350,
+  641, 0, 323, 0, 634, 845, 510, 866, 951, 0, 59, 0, 0, 0, 139, 818,
+  0, 0, 0, 138, 0, 0, 0, 0, 0, 0, 0, 0, 500, 0, 0, 582,
+  0, 0, 0, 757, 0, 613, 127, 61, 456, 461, 882, 0, 0, 0, 96, 0,
+  109, 0, 451, 596, 308, 969, 998, 0, 152, 73, 630, 967, 999, 851, 0, 0,
+  0, 0, 0, 0, 965, 0, 910, 165, 0, 0, 0, 75, 691, 158, 674, 700,
+  0, 0, 0, 862, 879, 0, 0, 718, 433, 209, 0, 422, 912, 257, 0, 0,
+  430, 0, 0, 0, 658, 0, 810, 176, 0, 0, 529, 0, 0, 0, 0, 0,
+  249, 84, 9, 566, 585, 0, 0, 0, 0, 0, 248, 351, 0, 17, 359, 673,
+  0, 0, 193, 701, 0, 0, 499, 0, 0, 0, 0, 0, 498, 184, 354, 0,
+  0, 201, 222, 0, 0, 282, 130, 754, 32, 854, 213, 212, 991, 40, 0, 0,
+  0, 0, 0, 0, 203, 949, 0, 0, 829, 83, 244, 0, 0, 175, 252, 533,
+  763, 670, 720, 118, 835, 0, 0, 0, 0, 321, 174, 266, 425, 645, 707, 933,
+  726, 876, 525, 303, 947, 0, 0, 0, 0, 0, 0, 0, 0, 0, 274, 0,
+  259, 0, 0, 0, 576, 264, 600, 680, 927, 0, 0, 448, 0, 0, 0, 0,
+  0, 0, 0, 0, 534, 436, 0, 0, 0, 0, 0, 0, 0, 207, 413, 0,
+  0, 0, 0, 0, 0, 0, 578, 95, 496, 692, 0, 668, 0, 0, 712, 0,
+  0, 227, 13, 0, 37, 0, 587, 485, 824, 62, 635, 637, 0, 0, 0, 0,
+  333, 369, 0, 50, 0, 558, 809, 911, 0, 0, 0, 0, 24, 0, 0, 0,
+  0, 0, 0, 0, 142, 0, 0, 0, 0, 0, 0, 0, 0, 74, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 622, 840, 638, 400, 186, 187, 439, 693,
+  191, 357, 462, 0, 236, 0, 698, 0, 0, 102, 324, 390, 263, 449, 654, 0,
+  0, 287, 742, 150, 329, 0, 688, 180, 827, 948, 0, 381, 675, 909, 0, 0,
+  0, 0, 0, 143, 0, 567, 633, 0, 0, 0, 783, 272, 0, 904, 0, 0,
+  715, 0, 532, 0, 0, 0, 0, 4, 0, 0, 153, 188, 945, 0, 0, 0,
+  0, 805, 807, 0, 814, 0, 0, 358, 89, 0, 159, 0, 0, 261, 0, 0,
+  468, 517, 420, 0, 0, 935, 382, 0, 300, 0, 0, 38, 44, 417, 842, 0,
+  0, 0, 0, 466, 0, 0, 0, 875, 601, 340, 0, 311, 440, 0, 121, 741,
+  0, 0, 72, 402, 541, 0, 0, 226, 894, 0, 131, 256, 0, 0, 374, 0,
+  946, 0, 0, 194, 0, 172, 242, 0, 0, 661, 0, 679, 199, 646, 166, 312,
+  105, 744, 380, 652, 769, 0, 678, 0, 0, 0, 41, 228, 238, 787, 644, 782,
+  0, 0, 550, 301, 0, 360, 740, 6, 79, 853, 0, 423, 690, 314, 0, 0,
+  0, 0, 0, 230, 994, 135, 0, 0, 0, 0, 524, 684, 78, 388, 545, 979,
+  292, 607, 90, 844, 0, 0, 21, 270, 503, 580, 751, 864, 254, 0, 564, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 124, 100, 247, 348,
+  855, 918, 0, 0, 0, 657, 0, 0, 0, 0, 0, 515, 514, 0, 934, 288,
+  0, 0, 0, 299, 7, 0, 0, 0, 404, 0, 0, 0, 568, 0, 0, 48,
+  0, 128, 508, 0, 0, 0, 87, 0, 0, 0, 0, 0, 0, 531, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 612, 0, 0, 0, 0, 0, 342, 871,
+  0, 108, 535, 0, 0, 375, 0, 0, 0, 0, 0, 0, 0, 373, 0, 224,
+  0, 0, 0, 0, 0, 431, 81, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 12, 465, 362, 589, 0, 0, 260, 0, 716, 419, 0, 0, 0, 0, 895,
+  0, 0, 852, 0, 0, 0, 659, 0, 901, 975, 86, 294, 0, 298, 280, 0,
+  0, 132, 134, 464, 546, 0, 0, 0, 0, 583, 0, 970, 554, 0, 245, 0,
+  0, 0, 0, 0, 349, 0, 295, 0, 0, 472, 509, 104, 708, 467, 0, 0,
+  621, 745, 800, 273, 459, 0, 762, 579, 944, 803, 0, 0, 780, 0, 0, 0,
+  0, 0, 268, 0, 0, 0, 0, 870, 0, 305, 492, 537, 0, 0, 0, 0,
+  640, 919, 334, 0, 0, 816, 0, 0, 0, 178, 0, 0, 0, 309, 850, 759,
+  0, 372, 411, 0, 0, 932, 0, 961, 0, 0, 0, 204, 0, 0, 0, 0,
+  395, 0, 914, 0, 0, 0, 0, 0, 0, 0, 0, 723, 0, 99, 122, 0,
+  0, 0, 18, 0, 0, 0, 790, 185, 0, 0, 182, 217, 0, 0, 0, 0,
+  189, 0, 0, 699, 77, 370, 403, 60, 734, 799, 113, 0, 0, 0, 91, 826,
+  0, 0, 729, 856, 813, 0, 335, 66, 322, 442, 164, 0, 0, 0, 0, 0,
+  240, 494, 0, 444, 0, 352, 0, 0, 457, 755, 0, 0, 57, 0, 0, 0,
+  0, 70, 16, 223, 391, 628, 943, 0, 506, 527, 831, 429, 677, 452, 0, 250,
+  0, 0, 892, 775, 990, 620, 887, 278, 412, 908, 0, 0, 0, 0, 0, 773,
+  458, 0, 0, 0, 34, 22, 0, 377, 0, 614, 0, 480, 0, 93, 394, 0,
+  0, 0, 313, 341, 265, 0, 293, 0, 861, 937, 455, 516, 756, 0, 26, 54,
+  71, 208, 446, 738, 980, 177, 0, 764, 0, 123, 653, 676, 82, 0, 0, 0,
+  0, 205, 486, 0, 573, 154, 258, 752, 539, 76, 0, 0, 490, 0, 719, 0,
+  0, 0, 28, 591, 832, 881, 0, 828, 416, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 669, 896, 58, 939, 0, 0, 206, 0, 0, 0, 0, 771, 526,
+  129, 758, 0, 0, 0, 33, 0, 211, 0, 0, 0, 0, 0, 0, 0, 0,
+  996, 0, 0, 304, 611, 838, 0, 0, 0, 427, 0, 552, 39, 144, 562, 618,
+  0, 384, 0, 0, 0, 0, 0, 0, 0, 0, 0, 685, 51, 367, 0, 0,
+  434, 705, 0, 45, 0, 649, 453, 586, 219, 728, 820, 891, 561, 0, 106, 0,
+  0, 0, 0, 997, 339, 696, 804, 577, 229, 283, 960, 599, 0, 0, 0, 597,
+  863, 953, 316, 610, 859, 0, 608, 157, 251, 0, 310, 0, 0, 0, 94, 225,
+  981, 0, 0, 0, 955, 0, 0, 0, 279, 0, 0, 938, 0, 0, 733, 0,
+  0, 983, 0, 0, 0, 267, 262, 103, 346, 156, 284, 878, 917, 0, 0, 0,
+  836, 794, 987, 0, 665, 0, 126, 65, 595, 0, 0, 0, 0, 114, 296, 361,
+  80, 424, 594, 31, 0, 651, 553, 724, 0, 802, 0, 839, 924, 815, 0, 0,
+  0, 117, 470, 695, 868, 0, 0, 0, 0, 0, 401, 731, 709, 786, 703, 0,
+  25, 345, 538, 504, 0, 647, 119, 549, 179, 460, 0, 0, 962, 0, 0, 155,
+  0, 615, 447, 0, 286, 0, 0, 0, 68, 590, 956, 0, 0, 0, 663, 0,
+  0, 98, 0, 0, 0, 530, 0, 0, 0, 0, 0, 0, 0, 0, 0, 463,
+  145, 0, 834, 0, 0, 0, 0, 0, 0, 0, 0, 0, 275, 0, 0, 0,
+  0, 931, 0, 0, 0, 907, 0, 110, 0, 0, 0, 792, 29, 0, 0, 906,
+  920, 885, 0, 0, 849, 0, 0, 542, 0, 0, 0, 0, 181, 379, 488, 857,
+  588, 0, 0, 0, 23, 137, 0, 19, 0, 0, 0, 0, 0, 711, 0, 198,
+  386, 846, 43, 290, 767, 898, 0, 0, 368, 487, 993, 347, 889, 0, 0, 0,
+  0, 0, 0, 660, 0, 0, 383, 0, 0, 0, 512, 169, 327, 493, 819, 0,
+  0, 0, 160, 0, 0, 0, 0, 53, 0, 344, 0, 625, 0, 0, 750, 0,
+  0, 0, 0, 0, 0, 0, 0, 291, 302, 385, 415, 11, 656, 0, 0, 140,
+  0, 682, 825, 67, 0, 0, 0, 604, 954, 441, 602, 662, 297, 396, 766, 681,
+  0, 0, 0, 0, 0, 0, 992, 0, 0, 867, 0, 474, 418, 737, 812, 888,
+  332, 0, 811, 0, 923, 197, 0, 0, 161, 0, 0, 0, 0, 0, 0, 581,
+  0, 666, 921, 978, 0, 770, 952, 0, 0, 0, 0, 233, 623, 774, 0, 0,
+  973, 0, 0, 687, 0, 986, 0, 63, 325, 650, 1, 397, 821, 0, 0, 793,
+  958, 0, 0, 0, 714, 0, 0, 806, 872, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 730, 543, 0, 0, 0, 0, 408, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 560, 0, 0, 215, 0, 528, 536, 353, 319, 903, 450, 239, 443,
+  748, 0, 136, 697, 364, 0, 0, 511, 0, 0, 847, 0, 0, 471, 502, 0,
+  0, 749, 0, 0, 551, 555, 0, 0, 0, 0, 739, 0, 0, 0, 0, 0,
+  101, 0, 0, 0, 0, 478, 643, 686, 315, 277, 243, 55, 232, 884, 0, 410,
+  0, 269, 3, 216, 0, 801, 0, 785, 435, 484, 732, 869, 959, 1000, 0, 648,
+  0, 0, 389, 107, 0, 0, 0, 0, 0, 0, 0, 0, 428, 722, 0, 0,
+};
+
+const char *WA_FREQ_162_TOKENS[] = {
+  "น.",
+  "2",
+  "วันที่",
+  "1",
+  "พ.ศ.",
+  "มกราคม",
+  "ปี",
+  "คน",
+  "2553",
+  "3",
+  "ที่",
+  "2554",
+  "เวลา",
+  "18",
+  "และ",
+  "มีนาคม",
+  "00:00",
+  "2552",
+  "2555",
+  "ธันวาคม",
+  "4",
+  "7",
+  "ตุลาคม",
+  "10",
+  "18 มกราคม",
+  "สิงหาคม",
+  "6",
+  "หรือ",
+  "พล",
+  "พ.ศ.2556",
+  "พฤศจิกายน",
+  "วันศุกร์ที่",
+  "17",
+  "2556",
+  "ๆ",
+  "20",
+  "พฤษภาคม",
+  "25",
+  "11",
+  "15",
+  "ณ",
+  "มี",
+  "14",
+  "24",
+  "27",
+  "28",
+  "13",
+  "เม",
+  "21",
+  "16",
+  "เมษายน",
+  "29",
+  "กล่าวว่า",
+  "ม.ค.",
+  "19",
+  "รายการ",
+  "23",
+  "วันนี้",
+  "ได้",
+  "พบ",
+  "เมื่อวันที่",
+  "แล้ว",
+  "อายุ",
+  "5",
+  "31",
+  "ไป",
+  "ให้",
+  "ผลการค้นหา",
+  "ครม",
+  "09:00",
+  "วันศุกร์",
+  "ใน",
+  "วัน",
+  "ค",
+  "แห่ง",
+  "ศ.",
+  "05:00",
+  "กทม",
+  "100",
+  "คือ",
+  "ว่า",
+  "ถึง",
+  "รมว",
+  "เป็น",
+  "แต่",
+  "วันพฤหัสบดี",
+  "17 มกราคม",
+  "ครั้ง",
+  "ค.ศ.",
+  "ย.",
+  "กัน",
+  "เช่น",
+  "เมื่อเวลา",
+  "พ",
+  "นี้",
+  "ล้านบาท",
+  "เดือน",
+  "30",
+  "ดร",
+  "ผบ",
+  "กันยายน",
+  "ไม่",
+  "จำนวน",
+  "50",
+  "ของ",
+  "จะ",
+  "การ",
+  "ราย",
+  "ในปี",
+  "กุมภาพันธ์",
+  "ดี",
+  "ทาง",
+  "มิ",
+  "9",
+  "8",
+  "กกต",
+  "นปช",
+  "12",
+  "มา",
+  "รพ",
+  "ในวันที่",
+  "ค.",
+  "วันพฤหัสบดีที่",
+  "ด้วย",
+  "บาท",
+  "40",
+  "วันอังคาร",
+  "ตร",
+  "กรกฎาคม",
+  "จาก",
+  "โดย",
+  "2550",
+  "วันจันทร์",
+  "กับ",
+  "200",
+  "26",
+  "ก็",
+  "อย่างไรก็ตาม",
+  "22",
+  "ขึ้น",
+  "เพราะ",
+  "วันอาทิตย์",
+  "สภ",
+  "2551",
+  "มิถุนายน",
+  "เมื่อ",
+  "รร",
+  "ผอ",
+  "ครั้งที่",
+  "นพ",
+  "อีก",
+  "นาย",
+  "ความ",
+  "เขต",
+  "วันพุธ",
+  "ปชป",
+  "ฉบับ",
+  "Post",
+  "1.",
+  "ข้อ",
+  "ทั่วประเทศ",
+  "นอกจากนี้",
+  "วันอังคารที่",
+  "กก",
+  "ทั้ง",
+  "เรื่อง",
+  "เล่ม",
+  "สน",
+  "Mb",
+  "ทุกแห่ง",
+  "เรา",
+  "ต้องได้",
+  "ทุกที่",
+  "หน้าแรก",
+  "ปตท",
+  "วันอาทิตย์ที่",
+  "นายกฯ",
+  "วันเสาร์",
+  "อบต",
+  "กม",
+  "ซี",
+  "ประจำวันที่",
+  "ดังนั้น",
+  "วันพุธที่",
+  "กว่า",
+  "ธปท",
+  "นายกรัฐมนตรี",
+  "05:01",
+  "ล้าน",
+  "2012",
+  "กสทช",
+  "2.",
+  "บริษัท",
+  "ต่อ",
+  "หน้า",
+  "เนื้อหาที่เกี่ยวข้อง",
+  "พ.ค.",
+  "จำกัด",
+  "ด้าน",
+  "20 มกราคม",
+  "35",
+  "อยู่",
+  "Created",
+  "80",
+  "สธ",
+  "ตัว",
+  "15 มกราคม",
+  "70",
+  "ทำ",
+  "ก.พ.",
+  "ต้อง",
+  "ไทย",
+  "2013",
+  "31 มีนาคม",
+  "รธน",
+  "ชม",
+  "54",
+  "งาน",
+  "ยัง",
+  "รวม",
+  "เผย",
+  "จยย",
+  "เกิด",
+  "เปิดเผยว่า",
+  "2549",
+  "ทั้งนี้",
+  "นั้น",
+  "มาร์ค",
+  "ธ.ค.",
+  "The",
+  "ผู้",
+  "ศพ",
+  "คดี",
+  "น",
+  "ก.ค.",
+  "ซึ่ง",
+  "ได้แก่",
+  "วันเสาร์ที่",
+  "ตั้งแต่",
+  "ส.ค.",
+  "14 มกราคม",
+  "ช่วง",
+  "รอง",
+  "วันจันทร์ที่",
+  "สมัคร",
+  "ชั้น",
+  "จี",
+  "ต.ค.",
+  "ส่วน",
+  "รับ",
+  "29 มีนาคม",
+  "คัน",
+  "3 มีนาคม",
+  "25 มีนาคม",
+  "1 ตุลาคม",
+  "11 มกราคม",
+  "ตำรวจ",
+  "ส",
+  "16 มกราคม",
+  "บก",
+  "ผกก",
+  "ศธ",
+  "ขณะที่",
+  "ซม",
+  "พ.ย.",
+  "ขอเชิญท่านสละเวลากรอกข้อมูล",
+  "เพื่อนำไปใช้ในเชิงวิจัยและพัฒนาเว็บไซต์ให้ดียิ่งขึ้น",
+  "ลำดับที่",
+  "คำ",
+  "แทน",
+  "44",
+  "28 มีนาคม",
+  "สหรัฐอเมริกา",
+  "อย่าง",
+  "19 มกราคม",
+  "ก.ย.",
+  "กทช",
+  "11 มีนาคม",
+  "23 มีนาคม",
+  "หลัง",
+  "อยุธยา",
+  "ชินวัตร",
+  "ภาค",
+  "24 มีนาคม",
+  "ศอฉ",
+  "เมตร",
+  "จุด",
+  "ตอบเมื่อ",
+  "ลูก",
+  "เกิดเมื่อวันที่",
+  "3.",
+  "33",
+  "1 มีนาคม",
+  "ที่ผ่านมา",
+  "13 มกราคม",
+  "2-3",
+  "ผู้สื่อข่าวรายงานว่า",
+  "เสธ",
+  "รศ",
+  "2 มีนาคม",
+  "ตาม",
+  "บมจ",
+  "วัย",
+  "รมช",
+  "ค่ำ",
+  "ใจ",
+  "18 มีนาคม",
+  "21 ธันวาคม",
+  "XXX",
+  "บช",
+  "17 มีนาคม",
+  "43",
+  "ชั่วโมง",
+  "ณ อยุธยา",
+  "ดังนี้",
+  "ฉบับที่",
+  "27 มีนาคม",
+  "14 มีนาคม",
+  "ออก",
+  "10 มีนาคม",
+  "27 เมษายน",
+  "ตอบทั้งหมด",
+  "สัปดาห์",
+  "โพสทั้งหมด",
+  "ททท",
+  "ทุก",
+  "ใหม่",
+  "7 ตุลาคม",
+  "ประมาณ",
+  "ประกอบด้วย",
+  "รู้",
+  "เข้า",
+  "ช่อง",
+  "จังหวัด",
+  "23 ธันวาคม",
+  "อะไร",
+  "10 มกราคม",
+  "10.00",
+  "7 มีนาคม",
+  "20 มีนาคม",
+  "กมธ",
+  "15 มีนาคม",
+  "16 ธันวาคม",
+  "หมื่นล้านบาท",
+  "อย",
+  "2009",
+  "มาก",
+  "เอฟ",
+  "1 มกราคม",
+  "ข่าว",
+  "ตอน",
+  "ผลการค้นหาคำว่า",
+  "7 มกราคม",
+  "สทศ",
+  "สำหรับ",
+  "10 ธันวาคม",
+  "17 ธันวาคม",
+  "24 ธันวาคม",
+  "11 สิงหาคม",
+  "21 มีนาคม",
+  "28 ธันวาคม",
+  "29 ธันวาคม",
+  "53",
+  "จากนั้น",
+  "ตั้ง",
+  "27 มกราคม",
+  "IP",
+  "ก่อน",
+  "รองนายกรัฐมนตรี",
+  "รายงานจาก",
+  "เวชชาชีวะ",
+  "15 ธันวาคม",
+  "27 ธันวาคม",
+  "ผม",
+  "หลาย",
+  "เพื่อ",
+  "แกนนำ",
+  "11 ธันวาคม",
+  "ขอ",
+  "ป",
+  "6 ตุลาคม",
+  "ดู",
+  "ต่อมา",
+  "ผบช",
+  "นัด",
+  "รอบ",
+  "10 ตุลาคม",
+  "ทอท",
+  "มม",
+  "ระหว่างวันที่",
+  "เจ็บ",
+  "เดอะ",
+  "ใช้",
+  "4 มีนาคม",
+  "25 ธันวาคม",
+  "2547",
+  "28 ตุลาคม",
+  "6 มกราคม",
+  "ชุด",
+  "ระบุ",
+  "0",
+  "1 พฤษภาคม",
+  "25 มกราคม",
+  "300",
+  "นำ",
+  "มีจำนวนทั้งหมด",
+  "05:30",
+  "๐",
+  "29 ตุลาคม",
+  "สพฐ",
+  "เมือง",
+  "ประเทศ",
+  "พาณิชย์",
+  "เสียชีวิต",
+  "16 สิงหาคม",
+  "หมู่",
+  "เห็น",
+  "10 สิงหาคม",
+  "100%",
+  "16 มีนาคม",
+  "17 สิงหาคม",
+  "20 ธันวาคม",
+  "ย.นี้",
+  "รมต",
+  "13 มีนาคม",
+  "2548",
+  "28 มกราคม",
+  "กลุ่ม",
+  "14 ธันวาคม",
+  "2 ธันวาคม",
+  "ขสมก",
+  "ทักษิณ",
+  "18 ธันวาคม",
+  "19 มีนาคม",
+  "60",
+  "คลัง",
+  "อส",
+  "แม่ทัพภาคที่",
+  "20 ตุลาคม",
+  "ตั้งแต่วันที่",
+  "บ้าน",
+  "อภิสิทธิ์",
+  "เสียง",
+  "ประธาน",
+  "มหาชน",
+  "เปิด",
+  "27 สิงหาคม",
+  "31 มกราคม",
+  "7 ธันวาคม",
+  "กลับ",
+  "กอ",
+  "จนท",
+  "บอกว่า",
+  "พุทธศักราช",
+  "พูด",
+  "รัก",
+  "โดยมี",
+  "21 สิงหาคม",
+  "6 พฤศจิกายน",
+  "คุณ",
+  "ชื่อ",
+  "อบจ",
+  "06:00",
+  "52",
+  "29 พฤศจิกายน",
+  "20 สิงหาคม",
+  "21 มกราคม",
+  "05:15",
+  "1 ธันวาคม",
+  "14 สิงหาคม",
+  "กรุงเทพฯ",
+  "11 ตุลาคม",
+  "19 ตุลาคม",
+  "เลย",
+  "1,000",
+  "2003",
+  "2010",
+  "ก",
+  "ฟรี",
+  "สส",
+  "แบบ",
+  "13 ธันวาคม",
+  "15 สิงหาคม",
+  "18 สิงหาคม",
+  "24 สิงหาคม",
+  "6 มีนาคม",
+  "ตาย",
+  "14 ตุลาคม",
+  "19 ธันวาคม",
+  "31 ธันวาคม",
+  "บาดเจ็บ",
+  "ประจำ",
+  "แสนล้านบาท",
+  "แอนด์",
+  "24 พฤศจิกายน",
+  "ถ้า",
+  "รุ่น",
+  "ร่วม",
+  "2001",
+  "66",
+  "of",
+  "ช่วย",
+  "พท",
+  "มัน",
+  "หญิง",
+  "ครับ",
+  "คำว่า",
+  "ท่าน",
+  "พระ",
+  "อดีต",
+  "แดง",
+  "โลก",
+  "กฟผ",
+  "คะแนน",
+  "ชาย",
+  "ส.ส.",
+  "สุเทพ",
+  "เอ",
+  "28 พฤศจิกายน",
+  "ม.",
+  "ใคร",
+  "13 ตุลาคม",
+  "4.",
+  "ผ่าน",
+  "รปภ",
+  "สกอ",
+  "17 พฤศจิกายน",
+  "19 สิงหาคม",
+  "2 ตุลาคม",
+  "2 พฤศจิกายน",
+  "25 พฤษภาคม",
+  "25 สิงหาคม",
+  "2546",
+  "27 พฤศจิกายน",
+  "27 พฤษภาคม",
+  "28 เมษายน",
+  "ถาม",
+  "นาที",
+  "ศอ",
+  "เขา",
+  "1 เมษายน",
+  "3 มกราคม",
+  "ชีวิต",
+  "สูง",
+  "31 ตุลาคม",
+  "ข่าวการเมือง",
+  "คง",
+  "ต่าง",
+  "ระหว่าง",
+  "สุด",
+  "21 ตุลาคม",
+  "23 พฤศจิกายน",
+  "4 มกราคม",
+  "จุลศักราช",
+  "มาตรา",
+  "ระนอง",
+  "ล้านคน",
+  "13 พฤศจิกายน",
+  "13.00",
+  "กรณ์",
+  "ผบก",
+  "วอชิงตัน",
+  "สาย",
+  "สี",
+  "11.00",
+  "15 พฤศจิกายน",
+  "4 ธันวาคม",
+  "นัก",
+  "สตช",
+  "1 สิงหาคม",
+  "31 สิงหาคม",
+  "IT",
+  "คณะ",
+  "ผศ",
+  "ภาพ",
+  "ส.",
+  "สว",
+  "สาว",
+  "เด็ก",
+  "ใหญ่",
+  "13 สิงหาคม",
+  "16 ตุลาคม",
+  "25 ตุลาคม",
+  "25 เมษายน",
+  "29 สิงหาคม",
+  "50%",
+  "500",
+  "ชี้",
+  "นายก",
+  "สั่ง",
+  "17 ตุลาคม",
+  "19 พฤศจิกายน",
+  "ถูก",
+  "ปชช",
+  "พระองค์",
+  "พร้อม",
+  "เริ่ม",
+  "18 พฤศจิกายน",
+  "20 พฤศจิกายน",
+  "23 สิงหาคม",
+  "2557",
+  "29 มกราคม",
+  "3 ธันวาคม",
+  "ค.นี้",
+  "คริสต์ศักราช",
+  "จริง",
+  "นศ",
+  "ประจำปี",
+  "ปีที่",
+  "ศาสตราจารย์",
+  "สบ",
+  "เคท",
+  "18 ตุลาคม",
+  "7 พฤษภาคม",
+  "คู่",
+  "บท",
+  "บอร์ด",
+  "พ.ต.ท.ทักษิณ",
+  "มิดเดิลตัน",
+  "4 ตุลาคม",
+  "PAT",
+  "คิด",
+  "คุย",
+  "ณ ระนอง",
+  "ตอนที่",
+  "ม",
+  "เป็นต้น",
+  "เรียน",
+  "1 พฤศจิกายน",
+  "ชาติ",
+  "ส่ง",
+  "อิสรภาพแห่งความคิด",
+  "เกิดวันที่",
+  "เดิน",
+  "2.5",
+  "7 พฤศจิกายน",
+  "รองนายกฯ",
+  "หนึ่ง",
+  "อาทิ",
+  "10 พฤศจิกายน",
+  "24 มกราคม",
+  "25 พฤศจิกายน",
+  "คาด",
+  "จัด",
+  "ตำแหน่ง",
+  "พรรค",
+  "หา",
+  "เชียงใหม่",
+  "ไม่ได้",
+  "09",
+  "11 พฤศจิกายน",
+  "14 พฤศจิกายน",
+  "19 พฤษภาคม",
+  "กล่าว",
+  "ขนาด",
+  "ผล",
+  "ภายใน",
+  "รถ",
+  "2540",
+  "32",
+  "6 พฤษภาคม",
+  "ปัจจุบัน",
+  "21 เมษายน",
+  "3 ตุลาคม",
+  "4 พฤศจิกายน",
+  "รฟม",
+  "ออสเตรเลีย",
+  "20 เมษายน",
+  "23 มกราคม",
+  "2544",
+  "3 พฤศจิกายน",
+  "อ.",
+  "อยาก",
+  "เทือกสุบรรณ",
+  "05:45",
+  "21 พฤศจิกายน",
+  "ดับ",
+  "ธอส",
+  "ปี.",
+  "เท่านั้น",
+  "เพิ่ม",
+  "24 พฤษภาคม",
+  "tags",
+  "จริงๆ",
+  "จับ",
+  "ปีมะโรง",
+  "ฝ่าย",
+  "หนังสือ",
+  "เอง",
+  "ไร่",
+  "11 พฤษภาคม",
+  "13 พฤษภาคม",
+  "1374",
+  "4 สิงหาคม",
+  "บาง",
+  "ลง",
+  "เคย",
+  "17 พฤษภาคม",
+  "2 มกราคม",
+  "22 มีนาคม",
+  "2543",
+  "กบง",
+  "ที่ทำเนียบรัฐบาล",
+  "บอก",
+  "พอ",
+  "เป็นเวลา",
+  "12 มกราคม",
+  "14 พฤษภาคม",
+  "2011",
+  "23 ตุลาคม",
+  "30 มีนาคม",
+  "ก.",
+  "ด.",
+  "ผวจ",
+  "พธม",
+  "ละ",
+  "โครงการ",
+  "ไทยโพสต์",
+  "24 ตุลาคม",
+  "May",
+  "ข่าวอาชญากรรม",
+  "คน.",
+  "ที",
+  "ที่ประชุม",
+  "อย่างไรก็ดี",
+  "ฯ",
+  "เม็ด",
+  "เสนอ",
+  "ไว้",
+  "15 ตุลาคม",
+  "2,000",
+  "28 สิงหาคม",
+  "400",
+  "45",
+  "55",
+  "6 สิงหาคม",
+  "ปภ",
+  "พรรคเพื่อไทย",
+  "มีผู้พูดทั้งหมด",
+  "ลงวันที่",
+  "สามัญชนคนสุดท้ายที่ได้เสกสมรสกับกษัตริย์อังกฤษ",
+  "10 พฤษภาคม",
+  "SMS",
+  "กนง",
+  "ทีมงาน",
+  "ทูตพณ",
+  "พนักงานสอบสวน",
+  "พันล้านบาท",
+  "รอ",
+  "รุ่นที่",
+  "หาก",
+  "เชื่อ",
+  "แสนบาท",
+  "09.00",
+  "1995",
+  "2542",
+  "27 ตุลาคม",
+  "28 พฤษภาคม",
+  "3 สิงหาคม",
+  "7 สิงหาคม",
+  "79",
+  "ครม.",
+  "ชาว",
+  "นายอภิสิทธิ์",
+  "พี่",
+  "สลด",
+  "เงิน",
+  "18 พฤษภาคม",
+  "6 ธันวาคม",
+  "GAT",
+  "กำลัง",
+  "ร",
+  "ระดับ",
+  "สถาบัน",
+  "เท่า",
+  "เหลือ",
+  "แรม",
+  "แสน",
+  "06.00",
+  "56",
+  "ตร.",
+  "อ.เมือง",
+  "แม่",
+  "01",
+  "16 พฤษภาคม",
+  "31 พฤษภาคม",
+  "กรรมการ",
+  "จารุพรรณ",
+  "ชุมชนไทยในต่างแดน",
+  "ที่กองบัญชาการตำรวจนครบาล",
+  "น.วันที่",
+  "นคร",
+  "ประเทศไทย",
+  "พรายแสง",
+  "รักษาพระองค์",
+  "หนังสือพิมพ์เสรีชัย",
+  "อันดับ",
+  "เพียง",
+  "07",
+  "08",
+  "15 พฤษภาคม",
+  "16 พฤศจิกายน",
+  "ปัญหา",
+  "ม.1",
+  "ล่าสุด",
+  "อยู่บ้านเลขที่",
+  "3 พฤษภาคม",
+  "กต",
+  "ช่อง3",
+  "ตรง",
+  "ปรับ",
+  "หมื่นล้าน",
+  "เจอ",
+  "2545",
+  "29บ/ด",
+  "36",
+  "4 พฤษภาคม",
+  "www.krobkruakao.com",
+  "กยศ",
+  "กระบอก",
+  "ข่าว3",
+  "ที่แม่นยำจากทีมข่าวมืออาชีพ",
+  "ปธน",
+  "ยัน",
+  "วธ",
+  "สมัย",
+  "เกาะติดทุกสถานการณ์ข่าว",
+  "เครื่อง",
+  "เรียก",
+  "โทร",
+  "2535",
+  "26 มีนาคม",
+  "ดีเอสไอ",
+  "ตลอด",
+  "ทหาร",
+  "บุคคลแนวหน้า",
+  "ปวช",
+  "ยืนยัน",
+  "อำเภอ",
+  "เอ็น",
+  "ไหน",
+  "03",
+  "29 พฤษภาคม",
+  "Monday",
+  "คอลัมน์",
+  "จุรินทร์",
+  "ทำให้",
+  "ปกติ",
+  "ปธ",
+  "ปู",
+  "พรรคประชาธิปัตย์",
+  "ยิ่งลักษณ์",
+  "สาหัส",
+  "04",
+  "06",
+  "2 พฤษภาคม",
+  "21 พฤษภาคม",
+  "51",
+  "กสท",
+  "นาน",
+  "บ้าง",
+  "ประกาศ",
+  "สปสช",
+  "หนุ่ม",
+  "เจ",
+  "เธอ",
+  "โฆษก",
+  "โรง",
+  "10%",
+  "20 พฤษภาคม",
+  "Tuesday",
+  "คนไทย",
+  "นสพ",
+  "เปอร์เซ็นต์",
+  "เพื่อน",
+  "เหตุ",
+  "2 สิงหาคม",
+  "2538",
+  "3.5",
+  "3จี",
+  "7.",
+  "ครบ",
+  "ที่ศาลาศิริราช",
+  "ประเด็น",
+  "พ.ค.นี้",
+  "อาคาร",
+  "เลือกตั้ง",
+  "23 พฤษภาคม",
+  "Wednesday",
+  "กิโลกรัม",
+  "ขวบ",
+  "ฉะนั้น",
+  "ถึงแก่กรรม",
+  "ที่สำนักงานตำรวจแห่งชาติ",
+  "นะ",
+  "พญ",
+  "พี",
+  "รัฐบาล",
+  "สสส",
+  "เศรษฐกิจ",
+  "แฟน",
+  "10.30",
+  "3-5",
+  "คนใหม่",
+  "ครบรอบ",
+  "ประชุม",
+  "พ.ย.นี้",
+  "พรรษา",
+  "ม.3",
+  "ม.ค.นี้",
+  "สุข",
+  "เป็นประธาน",
+  "ใช่",
+  "13.30",
+  "14.00",
+  "17 เมษายน",
+  "กรณี",
+  "ทปอ",
+  "ทีม",
+  "ที่ปรึกษา",
+  "นำโดย",
+  "น้อง",
+  "บี",
+  "ผู้ว่าฯ",
+  "วง",
+  "สอง",
+  "05",
+  "10:00",
+  "กทพ",
+  "กลาโหม",
+  "จน",
+  "นายสุเทพ",
+  "นี่",
+  "ป.ช.",
+  "มร",
+  "รฟท",
+  "สงกรานต์",
+  "ใบ",
+  "10 เมษายน",
+  "13 เมษายน",
+  "42",
+  "จ.",
+  "ญี่ปุ่น",
+  "ต้น",
+  "น่า",
+  "ม.4",
+  "รบ",
+  "ลด",
+  "สงคราม",
+  "สพท",
+  "สมาชิก",
+  "แค่",
+  "แรก",
+  "1.5",
+  "11 เมษายน",
+  "7 เมษายน",
+  "กองร้อย",
+  "การประชุม",
+  "ตลท",
+  "ทราบ",
+  "ผิด",
+  "พรหมพันธุ์",
+  "เลือก",
+  "เอา",
+  "โรงพยาบาลศิริราช",
+  "02",
+  "30 ตุลาคม",
+  "5,000",
+  "Friday",
+  "Thursday",
+  "กกท",
+  "ฉัน",
+  "มีผู้เสียชีวิต",
+  "มือ",
+  "ห้อง",
+  "อี",
+  "เลขาธิการ",
+  "110",
+  "19 เมษายน",
+  "20%",
+  "2007",
+  "38",
+  "90",
+  "March",
+  "ครู",
+  "ค่ะ",
+  "นายกิตติรัตน์",
+  "ศธ.",
+  "ส.ค.นี้",
+  "เพื่อชาติ",
+  "เอเชีย",
+  "09.30",
+  "3,000",
+  "46",
+  "ก.ย.นี้",
+  "คนที่",
+  "คมนาคม",
+  "คอป",
+  "จึง",
+  "ชนิด",
+};
+const uint16_t WA_FREQ_162_RANKS[] = {
+  0, 0, 363, 385, 0, 0, 0, 0, 0, 739, 0, 0, 0, 0, 816, 0,
+  0, 0, 307, 300, 408, 0, 634, 0, 898, 0, 772, 0, 0, 915, 79, 207,
+  660, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 324, 664, 0, 0, 0,
+  0, 0, 0, 244, 67, 0, 0, 0, 0, 0, 965, 102, 0, 920, 0, 492,
+  0, 587, 0, 644, 0, 0, 0, 504, 923, 0, 924, 0, 0, 226, 838, 986,
+  908, 0, 0, 0, 388, 459, 407, 611, 633, 260, 58, 787, 0, 22, 518, 875,
+  0, 0, 0, 16, 932, 0, 436, 860, 0, 0, 0, 0, 365, 252, 0, 0,
+  0, 0, 0, 0, 0, 869, 831, 0, 0, 63, 367, 720, 17, 910, 0, 0,
+  0, 0, 372, 89, 531, 861, 0, 562, 0, 127, 321, 0, 0, 80, 667, 320,
+  468, 0, 0, 635, 146, 0, 0, 0, 0, 0, 0, 0, 237, 308, 0, 957,
+  0, 0, 0, 685, 740, 0, 0, 0, 0, 0, 219, 218, 973, 0, 0, 225,
+  649, 668, 0, 141, 0, 105, 0, 0, 0, 476, 0, 0, 0, 823, 0, 477,
+  0, 0, 0, 254, 769, 87, 0, 0, 332, 0, 0, 0, 432, 413, 537, 899,
+  0, 642, 291, 956, 988, 235, 0, 681, 149, 885, 931, 727, 302, 0, 0, 0,
+  179, 826, 190, 0, 0, 461, 807, 0, 0, 0, 911, 0, 0, 0, 0, 0,
+  0, 0, 201, 718, 0, 0, 110, 0, 0, 0, 0, 0, 0, 0, 728, 0,
+  0, 0, 0, 0, 990, 305, 497, 599, 575, 186, 879, 391, 922, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 382, 0, 0, 0, 779, 0, 314, 516, 0,
+  615, 0, 0, 819, 187, 0, 0, 0, 0, 661, 199, 0, 0, 0, 673, 234,
+  889, 0, 116, 1000, 3, 0, 0, 214, 0, 0, 578, 647, 0, 0, 598, 251,
+  439, 373, 800, 394, 33, 366, 402, 671, 839, 0, 0, 955, 0, 0, 274, 0,
+  0, 651, 0, 377, 622, 696, 0, 515, 258, 188, 759, 0, 0, 0, 757, 0,
+  211, 356, 0, 0, 0, 0, 129, 239, 710, 0, 975, 0, 0, 573, 734, 592,
+  803, 0, 0, 833, 108, 446, 694, 0, 257, 730, 508, 0, 715, 954, 292, 535,
+  464, 906, 0, 0, 0, 120, 151, 859, 0, 0, 335, 0, 0, 76, 544, 42,
+  113, 934, 99, 960, 0, 104, 348, 18, 0, 135, 0, 271, 0, 387, 0, 0,
+  580, 134, 641, 904, 0, 0, 939, 0, 617, 606, 688, 0, 0, 156, 0, 0,
+  0, 846, 11, 39, 24, 782, 825, 0, 0, 0, 0, 406, 0, 0, 789, 619,
+  0, 0, 0, 0, 177, 273, 74, 437, 963, 0, 0, 0, 981, 0, 0, 972,
+  0, 0, 595, 717, 37, 0, 0, 708, 776, 768, 701, 896, 397, 862, 94, 0,
+  330, 0, 0, 318, 88, 0, 205, 421, 0, 0, 0, 0, 215, 249, 470, 830,
+  857, 95, 883, 0, 0, 0, 0, 0, 69, 0, 54, 0, 489, 509, 0, 0,
+  248, 376, 834, 0, 0, 0, 722, 267, 0, 0, 0, 0, 275, 184, 405, 989,
+  548, 894, 0, 0, 66, 41, 945, 0, 0, 0, 0, 270, 0, 0, 773, 147,
+  0, 0, 34, 0, 0, 0, 0, 0, 564, 662, 589, 457, 703, 101, 979, 0,
+  0, 0, 0, 0, 223, 484, 0, 0, 0, 96, 196, 350, 444, 0, 212, 222,
+  474, 559, 974, 0, 0, 0, 0, 0, 0, 0, 0, 0, 650, 775, 804, 0,
+  0, 227, 56, 0, 0, 0, 475, 0, 322, 523, 395, 631, 84, 0, 0, 0,
+  0, 0, 665, 0, 0, 195, 0, 0, 0, 0, 0, 233, 517, 543, 0, 0,
+  0, 0, 0, 0, 630, 255, 827, 0, 0, 0, 0, 0, 0, 513, 524, 0,
+  897, 0, 137, 232, 306, 586, 828, 0, 0, 755, 355, 152, 250, 689, 919, 0,
+  749, 288, 0, 0, 0, 771, 0, 793, 0, 327, 0, 0, 428, 0, 522, 86,
+  0, 191, 0, 0, 0, 0, 443, 0, 0, 0, 0, 0, 847, 961, 0, 926,
+  354, 927, 0, 256, 57, 692, 943, 0, 0, 0, 0, 0, 976, 465, 0, 0,
+  0, 0, 0, 0, 0, 496, 0, 0, 197, 454, 0, 0, 0, 280, 0, 264,
+  0, 744, 92, 176, 342, 0, 360, 265, 702, 905, 379, 585, 283, 843, 999, 0,
+  0, 0, 299, 0, 0, 550, 0, 172, 28, 68, 764, 276, 938, 153, 0, 0,
+  0, 0, 0, 0, 0, 683, 0, 0, 0, 0, 0, 0, 0, 808, 282, 0,
+  0, 0, 616, 5, 0, 0, 985, 502, 603, 876, 0, 0, 0, 478, 26, 588,
+  608, 309, 783, 0, 0, 0, 758, 0, 0, 417, 495, 0, 0, 0, 0, 0,
+  0, 310, 632, 0, 340, 0, 762, 542, 944, 144, 0, 173, 0, 0, 424, 590,
+  0, 0, 15, 835, 0, 928, 0, 396, 0, 38, 228, 98, 463, 766, 0, 0,
+  337, 0, 0, 0, 0, 0, 0, 0, 266, 0, 0, 200, 36, 325, 0, 821,
+  556, 0, 0, 0, 0, 0, 820, 801, 0, 0, 0, 21, 0, 438, 0, 0,
+  741, 0, 693, 0, 765, 48, 763, 220, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 142, 0, 0, 0, 0, 0, 0, 0, 398, 567, 0,
+  0, 0, 287, 712, 742, 0, 713, 0, 872, 0, 0, 81, 0, 0, 130, 231,
+  328, 0, 679, 0, 480, 418, 0, 0, 0, 0, 0, 982, 339, 0, 0, 0,
+  0, 0, 0, 0, 992, 112, 0, 469, 0, 0, 0, 0, 0, 493, 182, 0,
+  97, 0, 0, 107, 947, 657, 224, 700, 0, 0, 0, 0, 0, 0, 0, 0,
+  442, 0, 0, 0, 0, 748, 441, 790, 0, 868, 0, 594, 812, 0, 380, 0,
+  78, 0, 0, 0, 0, 0, 118, 690, 706, 0, 440, 806, 786, 837, 0, 0,
+  674, 0, 0, 0, 0, 0, 90, 429, 638, 901, 0, 0, 0, 10, 0, 0,
+  0, 614, 59, 0, 0, 269, 0, 272, 646, 0, 0, 0, 0, 672, 0, 0,
+  658, 997, 8, 845, 570, 0, 0, 12, 241, 0, 210, 31, 818, 870, 0, 754,
+  0, 0, 0, 998, 0, 0, 0, 0, 83, 384, 0, 574, 854, 0, 313, 554,
+  639, 0, 362, 0, 970, 319, 159, 400, 687, 180, 0, 0, 942, 0, 0, 0,
+  481, 0, 0, 0, 243, 0, 0, 0, 0, 357, 0, 0, 0, 0, 0, 707,
+  0, 392, 510, 338, 871, 0, 0, 0, 0, 0, 0, 35, 777, 40, 737, 0,
+  0, 0, 0, 0, 0, 842, 0, 0, 836, 0, 0, 456, 168, 547, 165, 0,
+  0, 82, 445, 625, 568, 930, 711, 577, 501, 423, 411, 909, 980, 209, 0, 698,
+  0, 0, 0, 0, 0, 557, 0, 167, 204, 451, 193, 534, 738, 721, 315, 551,
+  530, 774, 656, 912, 951, 767, 0, 0, 0, 0, 545, 0, 778, 221, 343, 716,
+  0, 426, 52, 0, 797, 326, 229, 0, 14, 7, 0, 132, 0, 0, 253, 0,
+  61, 913, 984, 0, 576, 0, 312, 386, 0, 0, 0, 0, 0, 0, 0, 0,
+  262, 301, 286, 0, 0, 13, 0, 0, 0, 27, 697, 856, 0, 723, 473, 70,
+  941, 462, 0, 431, 0, 73, 0, 732, 133, 645, 0, 0, 399, 0, 60, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 294, 0, 183, 111, 791, 0,
+  0, 0, 0, 341, 918, 0, 0, 0, 0, 0, 0, 0, 637, 403, 0, 479,
+  991, 370, 0, 0, 583, 0, 858, 145, 0, 0, 0, 0, 0, 0, 263, 0,
+  0, 0, 126, 393, 483, 505, 937, 0, 0, 0, 581, 795, 0, 0, 351, 745,
+  0, 0, 0, 0, 958, 0, 770, 419, 940, 966, 164, 628, 0, 512, 655, 946,
+  952, 62, 0, 0, 0, 0, 0, 0, 0, 123, 863, 77, 0, 0, 0, 114,
+  163, 572, 448, 629, 848, 44, 0, 756, 0, 964, 601, 0, 902, 158, 0, 0,
+  684, 652, 0, 259, 519, 553, 506, 525, 855, 0, 0, 0, 532, 117, 746, 0,
+  0, 851, 0, 0, 903, 0, 882, 0, 0, 0, 0, 0, 916, 297, 72, 2,
+  0, 0, 410, 430, 850, 977, 0, 678, 0, 30, 0, 0, 814, 0, 0, 0,
+  0, 799, 877, 0, 0, 0, 0, 0, 0, 336, 0, 174, 109, 331, 618, 0,
+  0, 0, 0, 281, 390, 6, 753, 864, 0, 0, 93, 0, 0, 0, 0, 4,
+  623, 0, 0, 0, 0, 0, 140, 216, 620, 933, 0, 527, 467, 675, 100, 747,
+  0, 604, 0, 368, 0, 0, 404, 0, 0, 561, 880, 0, 0, 724, 0, 452,
+  0, 0, 0, 115, 0, 0, 996, 0, 0, 936, 0, 0, 0, 0, 0, 0,
+  482, 279, 349, 824, 247, 844, 0, 0, 65, 455, 565, 969, 802, 0, 552, 0,
+  0, 0, 0, 0, 208, 0, 0, 138, 695, 0, 0, 549, 0, 841, 735, 0,
+  0, 0, 296, 64, 150, 0, 0, 0, 0, 0, 0, 0, 245, 0, 0, 677,
+  526, 794, 994, 0, 290, 0, 929, 0, 466, 0, 0, 0, 304, 0, 0, 0,
+  453, 25, 0, 261, 0, 733, 0, 50, 471, 917, 0, 0, 0, 0, 0, 293,
+  0, 121, 582, 0, 0, 626, 0, 0, 0, 726, 750, 119, 950, 0, 0, 203,
+  0, 959, 213, 53, 0, 0, 0, 0, 189, 181, 0, 433, 75, 0, 0, 0,
+  0, 995, 0, 0, 0, 0, 0, 0, 0, 170, 0, 0, 0, 352, 0, 0,
+  0, 171, 0, 0, 303, 731, 866, 0, 0, 0, 0, 131, 0, 0, 663, 0,
+  334, 353, 0, 383, 0, 157, 867, 725, 784, 284, 0, 447, 962, 175, 621, 139,
+  490, 0, 169, 0, 148, 240, 364, 298, 798, 381, 546, 788, 878, 0, 0, 0,
+  849, 921, 676, 43, 499, 624, 486, 761, 91, 0, 0, 0, 161, 0, 636, 978,
+  890, 0, 155, 751, 529, 485, 0, 0, 605, 311, 160, 178, 0, 538, 0, 458,
+  596, 892, 0, 1, 0, 0, 0, 0, 666, 0, 236, 278, 558, 566, 840, 0,
+  539, 0, 285, 0, 0, 0, 268, 627, 719, 487, 811, 829, 0, 0, 217, 317,
+  569, 344, 609, 852, 85, 0, 143, 230, 0, 0, 0, 0, 669, 659, 967, 0,
+  0, 563, 709, 0, 893, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 29, 648, 0, 0, 0, 0, 593, 0, 425, 32, 359,
+  0, 277, 185, 0, 0, 0, 971, 378, 0, 0, 643, 0, 369, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 653, 886, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 500, 736, 347, 914, 874, 0, 0, 0,
+  540, 23, 0, 0, 0, 607, 323, 760, 415, 0, 0, 0, 0, 0, 0, 780,
+  0, 0, 329, 0, 781, 128, 612, 422, 895, 0, 993, 19, 198, 346, 0, 0,
+  55, 45, 0, 0, 0, 0, 0, 0, 136, 0, 0, 0, 0, 0, 0, 0,
+  752, 434, 0, 0, 192, 0, 289, 528, 0, 0, 613, 0, 0, 0, 0, 389,
+  0, 533, 0, 0, 0, 0, 0, 0, 809, 494, 0, 333, 435, 414, 0, 536,
+  0, 49, 316, 401, 610, 729, 194, 154, 597, 817, 853, 420, 560, 796, 815, 0,
+  602, 0, 460, 0, 0, 0, 0, 0, 0, 0, 0, 124, 0, 699, 0, 0,
+  0, 0, 704, 705, 887, 0, 0, 0, 206, 0, 0, 0, 579, 0, 514, 0,
+  511, 0, 813, 0, 0, 242, 449, 714, 125, 0, 0, 47, 0, 202, 691, 680,
+  0, 0, 409, 450, 0, 987, 640, 0, 491, 743, 166, 361, 520, 865, 412, 785,
+  822, 9, 162, 498, 555, 670, 881, 949, 983, 0, 521, 0, 0, 122, 488, 0,
+  358, 584, 600, 106, 832, 0, 71, 884, 371, 507, 953, 374, 0, 891, 238, 571,
+  948, 968, 20, 103, 541, 345, 935, 0, 792, 0, 51, 416, 682, 873, 907, 0,
+  591, 46, 0, 0, 375, 472, 888, 427, 805, 0, 0, 925, 246, 686, 654, 0,
+  0, 0, 503, 900, 0, 810, 0, 0, 0, 0, 0, 0, 295, 0, 0, 0,
+};
+
+const char *WA_FREQ_163_TOKENS[] = {
+  "ኣብ",
+  "ድማ",
+  "እዩ፣",
+  "ናይ",
+  "እቲ",
+  "ኖርወይ",
+  "ካብ",
+  "ትምህርቲ",
+  "እዚ",
+  "ወይ",
+  "ቤት",
+  "ሓደ",
+  "ብዛዕባ",
+  "ምስ",
+  "ቋንቋ",
+  "ናብ",
+  "ግዜ",
+  "እዮም፣",
+  "ስራሕ",
+  "ግን",
+  "ማለት",
+  "ነቲ",
+  "ከም",
+  "እቶም",
+  "ዘሎ",
+  "ገለ",
+  "ከምኡውን",
+  "ክሳዕ",
+  "ሰብ",
+  "ኢዩ።",
+  "ብዙሓት",
+  "ዘለዎም",
+  "ዝኾነ",
+  "ህዝቢ",
+  "ኣገዳሲ",
+  "መንግስቲ",
+  "እዩ።",
+  "ገዛ",
+  "ሓገዝ",
+  "ቋንቛ",
+  "ካልኦት",
+  "ኢኹም፣",
+  "ቆልዓ",
+  "ከኣ",
+  "ትኽእሉ",
+  "ኣብዚ",
+  "እዞም",
+  "ይግባእ፣",
+  "ሃገር",
+  "ካልኣይ",
+  "ብዙሕ",
+  "ካልእ",
+  "ዓይነት",
+  "ኣደ",
+  "ዓመታት",
+  "ነዚ",
+  "እንታይ",
+  "ከባቢ",
+  "ክልተ",
+  "ይኽእሉ",
+  "ይኽእል",
+  "ገንዘብ",
+  "ፍቓድ",
+  "ቆልዑ",
+  "ዓመት",
+  "ሕብረተሰብ",
+  "መጽሓፍ",
+  "ስደተኛታት",
+  "ተባሂሉ",
+  "ክኸውን",
+  "ፍርዲ",
+  "ሓንቲ",
+  "ቋንቋ ኣደ",
+  "ኣዝዩ",
+  "እዩ",
+  "ኩሉ",
+  "ድሕሪ",
+  "ጥራይ",
+  "ናይቲ",
+  "እዋን",
+  "ዝምልከት",
+  "ጽቡቕ",
+  "ሃገራዊ",
+  "መሰል",
+  "ነገር",
+  "ኣብቲ",
+  "ዝውሃብ",
+  "ሰባት።",
+  "ንኣብነት",
+  "ክፋል",
+  "ላዕለዋይ",
+  "ምሉእ",
+  "ብዝያዳ",
+  "እኳ",
+  "ኮይኑ",
+  "ዕዮን",
+  "ዝመጹ",
+  "መታን",
+  "መንገዲ",
+  "መድሕን",
+  "ስልጠና",
+  "ስራሕን",
+  "ቋንቋታት",
+  "ትምህርታዊ",
+  "ነቶም",
+  "ኖርወይ።",
+  "ዓቢ",
+  "ሰባት",
+  "ቦታታት",
+  "ትምህርቲ።",
+  "ነይሩ፣",
+  "ክኾኑ",
+  "ዝርከብ",
+  "ዝተፈላለዩ",
+  "ሓላፍነት",
+  "ሓበሬታ",
+  "መዓልቲ",
+  "ቦታ",
+  "ኣለው፣",
+  "ከተንብቡ",
+  "ክሳብ",
+  "ዓይነታት",
+  "ፍልጠት",
+  "ህይወት",
+  "ሓድሽ",
+  "ምምሕዳር",
+  "ኣለዎም፣",
+  "ዓሳ",
+  "ደረጃ",
+  "ድሕነትን",
+  "ምዃኑ",
+  "ሰብኣዊ",
+  "ቀንዲ",
+  "ነይሮም፣",
+  "አብ",
+  "ኣበል",
+  "እዮም",
+  "ዌብሳይት",
+  "ዘለዎ",
+  "ዝስዕቡ",
+  "ምግፋፍ",
+  "ስደተኛታት።",
+  "ቅድሚ",
+  "እታ",
+  "ከምኡ",
+  "ክፍሊ",
+  "ኮይኖም",
+  "ወለዲ",
+  "ዝርከቡ",
+  "ጽሕፈት",
+  "ሃገራት",
+  "ሓረግ",
+  "መርበብ",
+  "ሳሚ",
+  "ሽሕ",
+  "ሽወደን",
+  "ቁጽሪ",
+  "ቅዱስ",
+  "ተመሃሮ",
+  "ተግባር",
+  "ኢሎም",
+  "ኣለዎ፣",
+  "እውን",
+  "ኩሎም",
+  "ዝኾኑ",
+  "Cappelens",
+  "ልዕሊ",
+  "ማእሰርቲ",
+  "ረቛሒታት",
+  "ታሪኽ",
+  "ንላዕሊ",
+  "እዩ፥",
+  "ካብቲ",
+  "ካብቶም",
+  "ዓለም",
+  "ዕዮ",
+  "መምህራን",
+  "መብዛሕቱ",
+  "መብዛሕቶም",
+  "መወዳእታ",
+  "ሳሚ።",
+  "ቈልዓ",
+  "ብሓደ",
+  "ነገራት",
+  "ኣብያተ-ትምህርቲ",
+  "ኣዋርሕ",
+  "ኣዋጅ",
+  "ጀሚሩ",
+  "1",
+  "ሕጂ",
+  "መንበሪ",
+  "መንጐ",
+  "ባሕሪ",
+  "ታሕተዋይ",
+  "ትምህርትን",
+  "ኣገባብ",
+  "ከምዚ",
+  "ክፍሊታት",
+  "ዘለው",
+  "ዝተፈላለየ",
+  "ግዜ።",
+  "ፈለማ",
+  "ፈተና",
+  "AS",
+  "Ansvarlig",
+  "Forlag",
+  "J.W.",
+  "disse",
+  "for",
+  "sidene",
+  "መርዓ",
+  "መሰረታዊ",
+  "ሰዓታት",
+  "በቲ",
+  "ብናጻ",
+  "ኖርዌጃውያን",
+  "ኣገልግሎት",
+  "ኤርትራ",
+  "እተን",
+  "ከሎ",
+  "ከመይ",
+  "ወርሒ",
+  "ዕረፍቲ",
+  "ዝሓለፈ",
+  "ደቆም",
+  "ጥዕና",
+  "ልክዕ",
+  "ሓጺር",
+  "መባእታን",
+  "መንገድታት",
+  "መዓልታት",
+  "መጽሓፍቲ",
+  "ማይ",
+  "ሰሜናዊ",
+  "ሰራሕተኛታት",
+  "ሰብ።",
+  "ስለ",
+  "ስለዚ",
+  "ስቶርቲንግ",
+  "ቆልዑ።",
+  "ቤተሰብ",
+  "ብተራድኦ",
+  "ብዝተፈላለየ",
+  "ትጽቢት",
+  "ናብዚ",
+  "ን",
+  "ኢዮም",
+  "ኣባላት",
+  "ኣብያተ",
+  "ኣካል",
+  "ኤውሮጳ",
+  "እንተ",
+  "ከተማ",
+  "ክፈልጡ",
+  "ወጻኢ",
+  "ዓቐን",
+  "ዕዳጋ",
+  "ዕድላት",
+  "ገዛእ",
+  "ጥንሲ",
+  "ጽሑፋት",
+  "ፍሉይ",
+  "ሕጊ",
+  "መመልከቲ",
+  "ማዕረ",
+  "ርእሲ",
+  "ሰለስተ",
+  "ሰነድ",
+  "ቈልዑ",
+  "ብቛንቋ",
+  "ብዓል-መዚ",
+  "ትካል",
+  "ነፍስወከፍ",
+  "ናይዚ",
+  "ንሓደ",
+  "ንኣሽቱ",
+  "ንኽረኽቡ",
+  "ኢዮም።",
+  "ኣርባዕተ",
+  "ኣርእስቲ",
+  "ኣንበሳ",
+  "እዚኦም",
+  "ክፋላት",
+  "ወለዲ።",
+  "ውሑድ",
+  "ዘለኩም",
+  "ዘይወግዓዊ",
+  "ዝበለ",
+  "ዝበሉ",
+  "ዝኸውን",
+  "ዝውነኑ",
+  "ዝግበር",
+  "ይነብሩ",
+  "ይኹን",
+  "ይግባይ",
+  "ደረጃን",
+  "ደቂ",
+  "ግዱድ",
+  "ግድነታዊ",
+  "ግድን",
+  "ፍርቂ",
+  "ህዝባዊ",
+  "ልቓሕ",
+  "መሰረት",
+  "መጀመርታ",
+  "ሰፊሕ",
+  "ስራሕ፤",
+  "ስደተኛ",
+  "ቀረባ",
+  "ብመንገዲ",
+  "ብውልቂ",
+  "ተማሃሮ",
+  "ተቐባልነት",
+  "ንምርካብ",
+  "ኢልና",
+  "ኢና፣",
+  "ኣሎዎም።",
+  "ኣሎዎ።",
+  "ኣሎ።",
+  "ኣሎ፣",
+  "ኣይኮነን፣",
+  "ከቢድ",
+  "ኩነታት",
+  "ኪዳን",
+  "ካብተን",
+  "ክህሉ",
+  "ክርስትና",
+  "ክገብሩ",
+  "ኸኣ",
+  "ውሽጢ",
+  "ዓውዲ",
+  "ዕድል",
+  "ዝልዓለ",
+  "ዝብል",
+  "ዝተሓተ",
+  "ዝነበረ",
+  "ዞባ",
+  "ይኽእሉ፣",
+  "ይጽዋዕ፣",
+  "ግብሪ",
+  "ግና",
+  "ጸቕጢ",
+  "ፕሮግራም",
+  "16",
+  "ሓሙሽተ",
+  "ሓደስቲ",
+  "ሓዲሽ",
+  "ሓፈሻዊ",
+  "ሕጋዊ",
+  "ሕግታትን",
+  "መምርሒታትን",
+  "መቕጻዕቲ",
+  "መንእሰያት",
+  "መንጎ",
+  "መከላኸሊ",
+  "መወሰኽታ",
+  "መዋእለ-ህጻናት",
+  "መግቢ",
+  "መጻኢ",
+  "ሞያዊ",
+  "ረቛሒታት።",
+  "ራብዓይ",
+  "ርእሱ",
+  "ሰልፊ",
+  "ሸነኽ",
+  "ቀዳማይ",
+  "ቀዳሞት",
+  "ብቕዓት",
+  "ብዝሒ",
+  "ተሞክሮ",
+  "ተራ",
+  "ተባዕታይ",
+  "ተኽእሎ",
+  "ትምህርቲ ቋንቋ ኣደ",
+  "ትምህርቲ፡",
+  "ነይረን፣",
+  "ናይ’ቲ",
+  "ናጻ",
+  "ንትምህርቲ",
+  "ንጥፈታት",
+  "ኢሉ",
+  "ኣስታት",
+  "ኣይሁድ",
+  "ኣደኦም",
+  "እንስሳታት",
+  "እንተኾነ።",
+  "ክረክብ",
+  "ክረኽቡ",
+  "ክንደይ",
+  "ክፍለ",
+  "ክፍሊት",
+  "ክፍልታት",
+  "ውግእ።",
+  "ዓመታት።",
+  "ዓበይቲ",
+  "ዘመን",
+  "ዘይሕጋዊ",
+  "ዘይምርድዳኣት",
+  "ዝዕድሚኦም",
+  "ዝጸንሐ",
+  "ይምሃሩ",
+  "ይጽበዩ",
+  "ደቂኣንስትዮ",
+  "ጀርመን",
+  "ጉዳይ",
+  "ግንቦት",
+  "ጓል",
+  "ጽሑፍ",
+  "18",
+  "4",
+  "NAV)።",
+  "ሓሳብ",
+  "ሕክምናዊ",
+  "መላእ",
+  "መምዘኒ",
+  "መሸጢ",
+  "መንግስታዊ",
+  "ማሕበራት",
+  "ማሕበር",
+  "ማዕከን",
+  "ምሕጋዝ",
+  "ምምዕባል",
+  "ምርምር",
+  "ምርግጋጽ",
+  "ምስዝኸውን።",
+  "ቀመምቲ",
+  "ቃል",
+  "ቘልዓ",
+  "ብሉይ",
+  "ብቐሊሉ",
+  "ብዝበለጸ",
+  "ተማሃሮ።",
+  "ተገይሩ፣",
+  "ነዞም",
+  "ነጥብታት",
+  "ንብረት",
+  "ንኽእል",
+  "ንግዲ",
+  "ኣርእስታት",
+  "ኣባይቲ",
+  "ኣብኡ",
+  "ኣነ",
+  "ኣኼባ",
+  "ኣደን",
+  "ኣደኡ",
+  "ኣገደስቲ",
+  "እትጽበዮም",
+  "እንሆ፥",
+  "እኹል",
+  "እዋን’ዚ",
+  "እዛ",
+  "እያ።",
+  "ከምቲ",
+  "ክህልዎ",
+  "ክምሃሩ",
+  "ክረምቲ",
+  "ክትርእዩ",
+  "ክውሃብ",
+  "ኵሉ",
+  "ወኻርያ",
+  "ወይስ",
+  "ውሑዳት",
+  "ውግእ",
+  "ዑቕባ",
+  "ዕሸል",
+  "ዘሎዎም",
+  "ዝበዝሐ",
+  "ዝተወስደ",
+  "ዝተፈላለያ",
+  "ዝኽፈል",
+  "ዝውነን",
+  "ዝዓበየ",
+  "ዝያዳ",
+  "የማናይ",
+  "ይኽእሉ።",
+  "ደው",
+  "ድሓር",
+  "ድዩ",
+  "ግቡእ",
+  "ጕጅለ",
+  "ጸገማት",
+  "ጽርግያታት",
+  "ፍርዲ።",
+  "10",
+  "3",
+  "300",
+  "NAV",
+  "ሃረም",
+  "ልሙድ",
+  "ሓበሬታ።",
+  "ሓባር",
+  "ሓታቲ",
+  "መምሃሪ",
+  "መምህር",
+  "መበቆል",
+  "መንበሪ።",
+  "ምስዝኸውን",
+  "ምንባብን",
+  "ምዃኖም",
+  "ሰልፍታት",
+  "ሰዓት",
+  "ስራሕ።",
+  "ስድራ-ቤታት",
+  "ሽዑ",
+  "ቅርጽን",
+  "ቅድመ-ትምህርትን",
+  "በዓል",
+  "በዚ",
+  "ባዕሎም",
+  "ብ",
+  "ብመልክዕ",
+  "ብምግባር",
+  "ብቑዓት",
+  "ብብዝሒ",
+  "ብፍላይ",
+  "ተማሃራይ",
+  "ተሰዲዶም",
+  "ተሳተፍቲ",
+  "ተወሳኺ",
+  "ቲንግ",
+  "ታሕቲ",
+  "ትሕቲ",
+  "ትርከብ።",
+  "ትኽክለኛ",
+  "ትግርኛ",
+  "ትጽቢታት",
+  "ነሓሰ",
+  "ነበሩ፣",
+  "ነዊሕ",
+  "ናጽነት",
+  "ንናይ",
+  "ንኣብነት።",
+  "ንኽምሃሩ",
+  "ንደቆም",
+  "ንግሆ",
+  "አስመራ",
+  "ኣለዋ፣",
+  "ኣርእስታት-ትምህርቲ",
+  "ኣቑሑ",
+  "ኣብነት",
+  "ኣናብስ",
+  "ኣናደይቲ",
+  "ኣንስተይቲ",
+  "ኣንጻር",
+  "ኣዝዮም",
+  "ኣደ፡",
+  "ኣገልግሎታት",
+  "እሞ",
+  "እዘን",
+  "እየን፣",
+  "ከምዚኦም",
+  "ከቢሩ",
+  "ካብዚ",
+  "ካብዞም",
+  "ክሮነር",
+  "ክሰርሑ",
+  "ክንዕድግ",
+  "ክእለት",
+  "ኮይኑ።",
+  "ውሑዳን",
+  "ውን",
+  "ውጥናት",
+  "ዑቕባ።",
+  "ዓበይቲ።",
+  "ዓይነትን",
+  "ዕለት",
+  "ዕድመ",
+  "ዘለና",
+  "ዝርከባ",
+  "ዝስዕብ",
+  "ዝበለጸ",
+  "ዝተኣሳሰሩ",
+  "ዝተፈልየ",
+  "ዝነበሩ",
+  "ዝዀነ",
+  "ይርከቡ፣",
+  "ይኸውን፣",
+  "ይኽእል፣",
+  "ይገብሮም፣",
+  "ይግብኦ፣",
+  "ይፈልጥ",
+  "ደለይቲ",
+  "ደቂኣንስትዮ።",
+  "ግን።",
+  "ግዜ፤",
+  "ጓልኣንስተይቲ",
+  "ጻዕሪ",
+  "1940",
+  "30",
+  "5",
+  "50,000",
+  "55",
+  "7",
+  "8",
+  "9",
+  "CV)።",
+  "ሃገርና",
+  "ሃገር።",
+  "ህዝብታት",
+  "ለይቲ",
+  "ላዕለዎት",
+  "ሎሚ",
+  "ሓይሊ",
+  "ሓገዝን",
+  "ሕሳብ",
+  "ሕቶ",
+  "ሕክምና",
+  "ሕጽረት",
+  "መሳርሒታት",
+  "መስከረም",
+  "መበል",
+  "መነባብሮ",
+  "መንእሰያትን",
+  "መድሃኒታትን",
+  "መጠናት።",
+  "ሙዚቃ",
+  "ምርኩስ",
+  "ምሳሕ",
+  "ምባል",
+  "ምእንቲ",
+  "ምጽሓፍን",
+  "ሞያ",
+  "ረብሓ",
+  "ርእሶም",
+  "ሰሙን",
+  "ሳምንታት",
+  "ስልጣን",
+  "ሽዱሽተ",
+  "ቀሊል",
+  "ቀስ",
+  "ቀይሕ",
+  "ቀደም",
+  "ቁጥዐ",
+  "ቁጽጽር",
+  "ቅቡል",
+  "ቆልዓ።",
+  "ቈልዓ፡",
+  "ቋንቋ-ኣደ",
+  "ቢልዮን",
+  "ባቡር",
+  "ባእታ",
+  "ቤተሰብ።",
+  "ቤት-ትምህርትን",
+  "ብሓባር",
+  "ብሕጊ",
+  "ብመሰረት",
+  "ብምሉእ",
+  "ብምኽንያት",
+  "ብቋንቛ",
+  "ብቐሊል",
+  "ብቐስ",
+  "ብቐጻሊ",
+  "ብኻልእ",
+  "ብዘየገድስ።",
+  "ብዝርከቡ",
+  "ተሌፎን",
+  "ተስፋታትኪ",
+  "ተኻዪዱ።",
+  "ተኽሊ",
+  "ተዘራረቡ፣",
+  "ትሕዝቶ",
+  "ነይሮም፥",
+  "ነገራት።",
+  "ናብራ",
+  "ናብቲ",
+  "ናዚ",
+  "ንተማሃሮ",
+  "ንነዊሕ",
+  "ንኖርወይ",
+  "ንእሽቶ",
+  "ንኹሉ",
+  "ንኽኣቱ።",
+  "ንውሓት",
+  "ኖርወይን",
+  "ኖርወጃውያን",
+  "ኢለ",
+  "ኣለው፥",
+  "ኣለዎም",
+  "ኣለዎም፥",
+  "ኣሎኒ፣",
+  "ኣርእስቲ፥",
+  "ኣስመራ",
+  "ኣብ'ዚ",
+  "ኣብተን",
+  "ኣተሓሳስባ",
+  "ኣይነበረን፣",
+  "ኣይኮነን",
+  "ኣጋጢሙኪ’ዶ",
+  "እምኒ",
+  "እትኽፈሎ",
+  "እንተኾኑ።",
+  "እንተኾይኑ።",
+  "እዚ።",
+  "እዮም፥",
+  "ኦስሎ",
+  "ከምዘይኮነ",
+  "ከምዝኽእል",
+  "ከምዝኾኑ",
+  "ከኣ፡",
+  "ከይተመርዓው",
+  "ኩለን",
+  "ካልኦትን",
+  "ክህልዎም",
+  "ክሕዝ",
+  "ክርስቶስ",
+  "ክስታት",
+  "ክተርፉ",
+  "ክትክእሉ",
+  "ክንዝርዝር",
+  "ክኸዱ",
+  "ክውሃበኩም",
+  "ክውሃቡ",
+  "ክግዝኡ",
+  "ክፉት",
+  "ኮሌጃትን",
+  "ኮፍ",
+  "ወለንታዊ",
+  "ወለድን",
+  "ወርሓዊ",
+  "ወነንቲ",
+  "ውሉዶም",
+  "ውልቃዊ",
+  "ዓማዊል",
+  "ዓሰርተ",
+  "ዓውድታት",
+  "ዓይኒ",
+  "ዕላማ",
+  "ዕረፍትን",
+  "ዘለወን",
+  "ዘለዋ",
+  "ዘርኢ",
+  "ዘይምርድዳእ",
+  "ዘይብሎም",
+  "ዝምልከቱ",
+  "ዝሰማማዕ",
+  "ዝብሃል",
+  "ዝተባህለ",
+  "ዝተዋህበ",
+  "ዝነብሩ",
+  "ዝኽእል",
+  "ዝውሃቡ",
+  "ዝደልዩ",
+  "ዩኒቨርሲታትን",
+  "ይሓስቡ፣",
+  "ይሰርሑ",
+  "ይሰርሑ፣",
+  "ይከኣል",
+  "ደቀባት",
+  "ደቀንስትዮ",
+  "ደቂተባዕትዮን",
+  "ደቂኣንስትዮን",
+  "ዳርጋ",
+  "ዳኛታት",
+  "ድሌት",
+  "ድራመን",
+  "ድርብ",
+  "ዶክተር",
+  "ጃንዳ",
+  "ገሊኦም",
+  "ገበን",
+  "ጉዳይ።",
+  "ጥንስቲ",
+  "ጸገም",
+  "ጸግዒ",
+  "ፈተና።",
+  "ፊደላት",
+  "ፍልጠትን",
+  "ፍርድን",
+  "ፖለቲካዊ",
+  "2",
+  "2000",
+  "2004",
+  "2007",
+  "40",
+  "40%",
+  "EEA",
+  "Intro።",
+  "NOKUT",
+  "W.",
+  "arkiv",
+  "tenants’",
+  "ሃዋሁ",
+  "ሃይማኖት",
+  "ሃገራትን",
+  "ህዝቢ።",
+  "ሆስፒታል",
+  "ልዑል",
+  "ሓለዋ",
+  "ሓሳባት",
+  "ሓቀኛ",
+  "ሓያሎ",
+  "ሓገዛት",
+  "ሓጋይ",
+  "ሕማቕ",
+  "ሕርሲ",
+  "ሕብረት",
+  "ሕቶታት",
+  "ሕግታት",
+  "መሬት",
+  "መርበባት",
+  "መሰላትን",
+  "መሰልን",
+  "መስመር",
+  "መቕጻዕቲ።",
+  "መበቆላዊ",
+  "መባእታዊ",
+  "መንእሰይ",
+  "መዝገብ",
+  "መድሓኒታትን",
+  "መጐዓዝያ",
+  "መፍትሒ",
+  "ሙሉእ",
+  "ማለት’ዩ።",
+  "ማሕበራዊ",
+  "ማንቲለ",
+  "ማእሰርቲ።",
+  "ማእከላይ",
+  "ምህላው",
+  "ምልክታት",
+  "ምርኣይ",
+  "ምርድኡ",
+  "ምሳይ",
+  "ምስዝኾኑ።",
+  "ምሸት",
+  "ምብራቕ",
+  "ምኽሪ",
+  "ምኽንያታት",
+  "ምኽንያት",
+  "ምውህሃድ",
+  "ምውህሃድን",
+  "ምዕባሌ",
+  "ምዝራብ",
+  "ምጅማር",
+  "ምግዳድ",
+  "ምጽዋዕ",
+  "ምፍጣር",
+  "ሞያተኛታት",
+  "ረቛሒታትን",
+  "ሩባታትን",
+  "ራዛ",
+  "ርእሳ",
+  "ርክብ",
+  "ሰልፍታት።",
+  "ሰራሕተኛታት።",
+  "ሰራሕተኛን",
+  "ሰፈራ",
+  "ስለዝነበረ።",
+  "ስፖርትን",
+  "ሸቶ",
+  "ሸቶታትን",
+  "ሸውዓተ",
+  "ሻዱሻይ",
+  "ሽግር",
+  "ቀልጢፎም",
+  "ቀዳመ-ሰንበት",
+  "ቀዳም",
+  "ቀጺሉ",
+  "ቁጠባዊ",
+  "ቃላት",
+  "ቅድመ",
+  "ቅድም",
+  "ቆልዑን",
+  "ቈልዑ፡",
+  "ቋንቋ-ሃገር",
+  "ቋንቋ/ታት",
+  "ቋንቋኦም",
+  "ቋንቛኦም",
+  "በረድ",
+  "ባህሊ",
+  "ባህልታት",
+  "ባህልን",
+  "ባንኪ",
+  "ባእታታት",
+  "ባዮሎጂ",
+  "ቤተ",
+  "ቤተሰቡን",
+  "ቤተሰቦምን",
+  "ቤተክርስትያን",
+  "ብሉጻት",
+  "ብሓቂ",
+  "ብመንግስቲ",
+  "ብማዕረ",
+  "ብምግባር።",
+  "ብርሃን",
+  "ብስቶርቲንግ",
+  "ብቐንዱ",
+  "ብቐጥታ",
+  "ብኣደ",
+  "ብኸመይ",
+  "ብኸምዚ",
+  "ብዘይ",
+  "ብዘይካ",
+  "ብዙሓን",
+  "ብዝሓሸ",
+  "ብዝተፈላለዩ",
+  "ቦታታትን",
+  "ተመክሮ",
+  "ተስፋ",
+  "ተቓውሞ",
+  "ተባሂሎም",
+  "ተኻረይቲ",
+  "ተኻፈልቲ",
+  "ተኽእሎታት",
+  "ተወከሱ፣",
+  "ተገይሩ።",
+  "ተገዳስነት",
+  "ትምህርቲ፤",
+  "ትራክ",
+  "ትራክ)።",
+  "ትእዛዝ",
+  "ትኸፍሉ",
+  "ነናይ",
+  "ነይሩ፥",
+  "ነገራትን",
+  "ነጥቢ",
+  "ናይዛ",
+  "ንሕና",
+  "ንምሃብ",
+  "ንምግባር",
+  "ንምፍላጥ",
+  "ንምፍታሕ",
+  "ንሳቶም",
+  "ንነፍስወከፍ",
+  "ንኣደ",
+  "ንኽህሉ",
+  "ንኽምርዖ",
+  "ንኽውድኡ",
+  "ንዓበይቲ",
+  "ንዝርከብ",
+  "ንዝተዋህቡ",
+  "ንዝያዳ",
+  "ንገዛእ-ርእሱን",
+  "ንግዱድ",
+  "ንጥንቃቐ",
+  "ኖርወይ፤",
+  "ኖርወይ፥",
+  "ኖርወጃዊ",
+  "ኖርዌጃውያን።",
+  "አዚ",
+  "ኢሉ።",
+  "ኢላ",
+  "ኢትኒካዊ",
+  "ኢዩ",
+  "ኣለርጂ",
+  "ኣምስዩ።",
+  "ኣርእስቲ።",
+  "ኣስራሒኹም",
+  "ኣቑሑን",
+  "ኣቢልና",
+  "ኣቢሎም",
+  "ኣባይቲ።",
+  "ኣብታ",
+  "ኣተሓሕዛ",
+  "ኣተሓሳስባን",
+  "ኣትዮም",
+  "ኣእምሮ",
+  "ኣኼባ'ዚ",
+  "ኣዋጅ።",
+  "ኣየር",
+  "ኣየናይ",
+  "ኣይኮኑን፣",
+  "ኣይኰነን።",
+  "ኣዲኦም",
+  "ኣድላዪ",
+  "ኣድራሻ",
+  "ኣግራብን",
+  "ኣጸቢቑ",
+  "እሓስብ፣",
+  "እምበር",
+  "እምነት",
+  "እትርከብ",
+  "እንስሳ",
+  "እዋን'ዚ",
+  "እዋን'ዚ።",
+  "እዚኣተን",
+  "እደሊ፣",
+  "ከለና።",
+  "ከለኻ",
+  "ከምዘለዎ",
+  "ከባቢኦም",
+  "ከተመልክቱ",
+  "ከተማታት",
+  "ኪ.ግ",
+  "ኪምሃሩ",
+  "ኪምህሩ",
+  "ካልእን",
+  "ካብታ",
+  "ካብኡ",
+  "ኬንያ",
+  "ክህቡ",
+  "ክልቲኦም",
+  "ክሓስቡ",
+  "ክርስትያን",
+  "ክስምዓ",
+  "ክብርን",
+  "ክታበት",
+  "ክትምሃር",
+  "ክትወስዱ",
+  "ክትፈልጡ",
+  "ክኽእሉን",
+};
+const uint16_t WA_FREQ_163_RANKS[] = {
+  0, 0, 0, 327, 472, 242, 498, 0, 0, 0, 0, 0, 604, 460, 782, 0,
+  0, 0, 281, 291, 370, 523, 226, 947, 0, 161, 417, 938, 941, 734, 50, 0,
+  0, 56, 739, 0, 775, 0, 0, 0, 0, 341, 634, 0, 377, 554, 801, 527,
+  0, 0, 0, 0, 0, 0, 517, 0, 0, 0, 0, 259, 408, 0, 0, 0,
+  559, 528, 828, 0, 0, 534, 0, 386, 0, 346, 117, 0, 680, 200, 441, 543,
+  0, 0, 0, 0, 726, 0, 133, 0, 0, 29, 0, 492, 355, 593, 0, 0,
+  513, 331, 557, 641, 862, 906, 222, 461, 925, 0, 0, 788, 88, 436, 177, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 715, 0, 679, 0, 317, 0, 0, 0,
+  68, 0, 0, 0, 0, 0, 357, 576, 0, 269, 0, 464, 0, 610, 985, 0,
+  195, 639, 140, 12, 319, 848, 187, 835, 237, 929, 176, 760, 0, 0, 0, 0,
+  0, 0, 561, 439, 453, 0, 584, 0, 0, 0, 0, 0, 0, 530, 723, 0,
+  0, 0, 0, 0, 0, 0, 258, 350, 671, 0, 0, 0, 0, 103, 703, 539,
+  888, 0, 0, 0, 0, 0, 3, 0, 0, 0, 220, 405, 0, 0, 0, 459,
+  477, 551, 0, 367, 0, 0, 0, 0, 566, 0, 757, 928, 0, 78, 216, 54,
+  0, 91, 537, 99, 0, 482, 205, 651, 954, 0, 152, 0, 0, 0, 0, 0,
+  398, 619, 0, 882, 43, 614, 949, 455, 46, 588, 0, 0, 0, 0, 221, 0,
+  532, 288, 556, 0, 0, 0, 118, 0, 0, 0, 127, 0, 625, 0, 16, 798,
+  0, 0, 830, 0, 0, 823, 879, 11, 390, 0, 0, 0, 762, 0, 0, 0,
+  0, 0, 0, 153, 711, 893, 0, 0, 0, 147, 0, 297, 0, 0, 0, 0,
+  0, 0, 0, 128, 65, 665, 914, 0, 0, 0, 0, 251, 282, 352, 872, 996,
+  427, 0, 290, 167, 519, 0, 0, 700, 0, 0, 0, 0, 0, 416, 0, 765,
+  0, 0, 0, 322, 0, 729, 0, 0, 0, 0, 0, 836, 0, 469, 546, 596,
+  684, 374, 0, 0, 0, 0, 0, 0, 663, 689, 0, 0, 0, 500, 76, 0,
+  0, 0, 0, 345, 982, 0, 0, 0, 843, 881, 0, 0, 0, 0, 407, 0,
+  0, 0, 0, 789, 0, 235, 468, 0, 0, 510, 0, 0, 0, 284, 964, 278,
+  404, 547, 0, 0, 621, 0, 0, 0, 0, 311, 885, 642, 704, 400, 0, 0,
+  0, 171, 202, 503, 615, 755, 0, 168, 49, 0, 0, 913, 932, 236, 783, 0,
+  0, 886, 860, 208, 484, 136, 901, 0, 931, 0, 0, 27, 196, 655, 419, 212,
+  403, 438, 0, 0, 0, 0, 170, 0, 0, 0, 0, 626, 306, 773, 0, 325,
+  735, 0, 0, 0, 5, 362, 834, 0, 0, 0, 0, 0, 55, 0, 0, 0,
+  568, 669, 635, 0, 0, 661, 0, 365, 247, 257, 445, 799, 0, 839, 790, 0,
+  0, 0, 0, 0, 0, 279, 721, 0, 376, 0, 249, 32, 0, 524, 0, 17,
+  0, 502, 0, 0, 480, 935, 0, 0, 598, 454, 0, 0, 347, 750, 20, 865,
+  0, 0, 0, 0, 0, 250, 0, 0, 0, 393, 190, 0, 239, 0, 0, 225,
+  0, 794, 381, 83, 644, 0, 25, 0, 273, 318, 868, 338, 0, 0, 87, 0,
+  898, 0, 0, 0, 0, 844, 725, 0, 163, 777, 429, 687, 733, 0, 0, 0,
+  541, 702, 0, 0, 0, 0, 633, 0, 0, 0, 0, 856, 0, 0, 0, 0,
+  0, 0, 0, 627, 0, 0, 0, 0, 260, 444, 0, 0, 0, 0, 151, 0,
+  272, 333, 0, 141, 95, 363, 542, 623, 983, 0, 411, 710, 737, 0, 0, 149,
+  526, 0, 156, 335, 832, 0, 0, 204, 412, 0, 0, 657, 425, 0, 0, 310,
+  0, 0, 0, 0, 787, 0, 23, 0, 540, 211, 371, 0, 0, 0, 191, 450,
+  612, 674, 64, 71, 228, 545, 583, 691, 808, 926, 296, 0, 430, 0, 0, 662,
+  0, 329, 0, 0, 0, 0, 0, 0, 373, 380, 0, 0, 0, 73, 0, 0,
+  0, 0, 382, 0, 0, 0, 0, 7, 0, 0, 986, 101, 0, 923, 0, 0,
+  0, 0, 0, 0, 0, 0, 727, 0, 360, 824, 0, 0, 34, 0, 354, 0,
+  0, 0, 0, 0, 0, 754, 0, 0, 0, 0, 0, 0, 802, 0, 0, 0,
+  0, 0, 0, 0, 0, 957, 0, 26, 0, 289, 764, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 302, 337, 456, 39, 0, 160,
+  0, 0, 0, 238, 0, 0, 0, 875, 42, 895, 478, 688, 423, 145, 0, 910,
+  0, 0, 0, 636, 924, 214, 399, 435, 585, 716, 696, 966, 0, 488, 0, 0,
+  915, 0, 489, 0, 724, 0, 178, 0, 0, 420, 421, 927, 0, 387, 72, 233,
+  192, 841, 742, 10, 827, 0, 0, 424, 613, 490, 0, 589, 0, 0, 806, 0,
+  658, 495, 0, 838, 0, 0, 0, 974, 0, 0, 0, 384, 0, 0, 353, 0,
+  313, 0, 0, 0, 0, 0, 0, 0, 299, 567, 845, 410, 981, 0, 0, 372,
+  980, 0, 0, 129, 428, 81, 582, 624, 0, 0, 248, 0, 465, 780, 0, 1,
+  0, 418, 0, 0, 139, 385, 681, 942, 188, 303, 0, 201, 0, 48, 104, 124,
+  586, 769, 0, 0, 0, 666, 0, 0, 0, 0, 112, 44, 989, 183, 0, 0,
+  562, 0, 155, 324, 558, 234, 873, 0, 741, 0, 0, 0, 0, 565, 712, 952,
+  846, 0, 245, 266, 0, 0, 0, 292, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 778, 0, 446, 0, 0, 0, 0, 970,
+  35, 850, 771, 0, 463, 0, 0, 0, 0, 293, 825, 605, 470, 911, 645, 0,
+  0, 342, 988, 0, 0, 548, 0, 730, 847, 0, 0, 0, 807, 0, 271, 0,
+  0, 0, 776, 521, 978, 0, 0, 9, 958, 69, 207, 0, 0, 485, 992, 0,
+  366, 781, 174, 0, 0, 301, 0, 0, 0, 0, 457, 0, 731, 0, 0, 812,
+  0, 0, 0, 0, 0, 0, 62, 0, 813, 0, 358, 0, 0, 0, 0, 0,
+  0, 0, 0, 199, 132, 164, 597, 617, 203, 632, 131, 481, 231, 512, 15, 309,
+  475, 230, 300, 497, 758, 917, 984, 0, 41, 422, 0, 572, 0, 751, 0, 0,
+  809, 817, 114, 8, 705, 0, 57, 19, 246, 270, 887, 677, 883, 137, 193, 975,
+  180, 496, 37, 698, 646, 945, 116, 600, 434, 759, 977, 0, 74, 295, 243, 912,
+  960, 0, 0, 552, 987, 0, 0, 643, 514, 501, 736, 916, 999, 0, 0, 0,
+  0, 394, 676, 0, 0, 0, 720, 0, 0, 0, 0, 0, 973, 0, 0, 0,
+  631, 800, 0, 0, 0, 85, 40, 59, 28, 591, 0, 0, 105, 863, 406, 61,
+  899, 0, 0, 0, 442, 0, 0, 90, 391, 378, 66, 388, 535, 0, 0, 0,
+  0, 0, 0, 479, 0, 930, 0, 814, 409, 0, 905, 518, 0, 110, 274, 820,
+  0, 0, 950, 0, 0, 607, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  186, 0, 0, 921, 877, 0, 0, 0, 0, 0, 0, 0, 0, 744, 0, 210,
+  0, 0, 0, 0, 286, 0, 837, 0, 0, 0, 0, 0, 0, 389, 0, 640,
+  746, 0, 0, 867, 0, 2, 0, 0, 462, 818, 0, 315, 0, 0, 0, 0,
+  0, 0, 976, 0, 0, 0, 0, 0, 150, 709, 0, 659, 0, 685, 603, 277,
+  0, 0, 0, 0, 0, 0, 476, 717, 515, 939, 0, 0, 0, 33, 0, 0,
+  0, 0, 774, 0, 0, 962, 0, 0, 0, 884, 516, 796, 182, 0, 0, 937,
+  943, 0, 648, 0, 0, 84, 616, 0, 682, 936, 348, 206, 0, 0, 253, 637,
+  753, 38, 880, 414, 0, 0, 402, 154, 0, 0, 0, 0, 0, 0, 0, 356,
+  595, 628, 630, 0, 0, 0, 0, 232, 664, 608, 506, 0, 0, 146, 466, 811,
+  0, 0, 368, 158, 283, 328, 713, 854, 75, 0, 0, 0, 0, 749, 878, 121,
+  797, 574, 555, 692, 810, 0, 0, 67, 0, 0, 963, 336, 620, 0, 0, 770,
+  0, 0, 0, 0, 0, 0, 871, 0, 0, 0, 320, 795, 0, 0, 0, 0,
+  0, 0, 0, 0, 972, 0, 166, 0, 0, 0, 0, 0, 0, 60, 364, 252,
+  606, 740, 990, 672, 0, 0, 332, 508, 142, 144, 433, 686, 900, 58, 0, 189,
+  197, 511, 654, 126, 833, 0, 0, 0, 979, 0, 0, 0, 0, 571, 0, 629,
+  330, 451, 533, 401, 708, 520, 486, 747, 0, 0, 0, 902, 0, 0, 14, 668,
+  718, 678, 94, 594, 198, 784, 908, 934, 994, 0, 0, 426, 113, 285, 0, 0,
+  961, 0, 0, 0, 0, 0, 840, 0, 0, 0, 0, 0, 560, 889, 0, 570,
+  609, 909, 138, 0, 0, 0, 125, 219, 803, 0, 0, 80, 51, 107, 122, 102,
+  592, 997, 0, 590, 748, 876, 181, 275, 577, 853, 971, 0, 0, 993, 0, 0,
+  0, 670, 321, 890, 0, 0, 522, 959, 0, 767, 0, 0, 0, 0, 0, 443,
+  0, 0, 276, 0, 0, 0, 111, 344, 379, 0, 0, 0, 106, 134, 896, 822,
+  968, 0, 413, 0, 0, 0, 36, 0, 0, 0, 0, 0, 0, 334, 0, 0,
+  0, 0, 0, 0, 0, 323, 673, 0, 0, 47, 98, 447, 998, 831, 0, 148,
+  0, 0, 0, 0, 0, 0, 316, 956, 0, 0, 0, 339, 135, 894, 969, 892,
+  0, 0, 0, 0, 415, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 573,
+  0, 549, 0, 0, 0, 0, 0, 0, 52, 308, 0, 743, 24, 432, 965, 0,
+  907, 109, 768, 967, 0, 96, 575, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 97, 305, 761, 656, 647, 550, 294, 816, 852, 918, 897, 0, 471, 0,
+  0, 0, 79, 343, 312, 714, 130, 874, 70, 298, 209, 653, 946, 0, 0, 0,
+  0, 0, 31, 694, 493, 940, 538, 0, 0, 0, 0, 0, 995, 0, 179, 0,
+  349, 0, 0, 261, 268, 805, 351, 1000, 0, 0, 855, 262, 509, 0, 0, 0,
+  395, 224, 903, 0, 244, 0, 0, 697, 0, 0, 0, 172, 0, 18, 0, 6,
+  650, 819, 369, 254, 564, 804, 0, 143, 0, 578, 0, 695, 0, 0, 4, 0,
+  474, 667, 218, 0, 0, 0, 638, 0, 0, 0, 45, 241, 491, 0, 0, 693,
+  752, 0, 0, 0, 0, 0, 255, 955, 0, 792, 920, 690, 948, 375, 108, 263,
+  602, 0, 0, 494, 0, 0, 706, 719, 722, 821, 175, 0, 63, 815, 267, 728,
+  0, 0, 0, 0, 553, 857, 0, 0, 0, 0, 0, 0, 953, 264, 93, 159,
+  359, 507, 649, 701, 919, 0, 483, 0, 280, 0, 162, 0, 86, 240, 922, 563,
+  864, 0, 287, 0, 0, 859, 119, 0, 314, 383, 0, 0, 0, 396, 0, 0,
+  123, 53, 0, 544, 756, 0, 531, 0, 487, 0, 0, 0, 0, 652, 397, 0,
+  793, 440, 0, 0, 870, 904, 891, 0, 227, 0, 0, 0, 0, 0, 861, 0,
+  0, 0, 0, 0, 256, 525, 89, 618, 307, 785, 0, 0, 449, 0, 185, 473,
+  165, 0, 194, 869, 0, 169, 452, 0, 100, 184, 581, 13, 0, 0, 0, 0,
+  265, 431, 437, 82, 458, 951, 0, 0, 0, 0, 223, 21, 213, 763, 0, 0,
+  77, 0, 0, 0, 0, 0, 304, 504, 0, 622, 772, 0, 529, 779, 0, 0,
+  0, 0, 933, 0, 0, 0, 0, 0, 0, 0, 745, 0, 0, 0, 611, 0,
+  0, 991, 599, 866, 217, 499, 157, 766, 0, 0, 0, 579, 660, 0, 0, 0,
+  0, 536, 0, 0, 0, 0, 115, 173, 229, 505, 699, 0, 0, 361, 569, 944,
+  0, 448, 683, 0, 0, 30, 0, 340, 392, 92, 786, 791, 851, 0, 215, 842,
+  601, 0, 0, 0, 858, 0, 0, 0, 732, 0, 326, 0, 0, 849, 0, 0,
+  0, 0, 0, 0, 0, 22, 467, 826, 0, 0, 707, 0, 0, 0, 0, 675,
+  0, 580, 0, 0, 587, 120, 738, 829, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+const char *WA_FREQ_164_TOKENS[] = {
+  "እግል",
+  "አነ",
+  "ቶም",
+  "ሙምር",
+  "ሰድመት",
+  "ጸብጠቱ",
+  "ሰዐር",
+  "ልብቀልቱ",
+  "አትመመያሁ",
+  "ፋድል",
+  "ኩሉ",
+  "ሓጃት",
+  "ልሕገል",
+  "ቀድር",
+  "ዝላም",
+  "ኢትዝለም",
+  "ደለትቼ",
+  "ነስአኮ",
+  "መድረሴት",
+  "ኢይፈቴኒ",
+  "ሎሀ",
+  "ወለት",
+  "ተአምረ",
+  "በዐል",
+  "ሰአዬት",
+  "ልፍሀም",
+  "ምንከ",
+  "ሐይስ",
+  "ዚሪ",
+  "እትለ",
+  "ልትገሴ",
+};
+const uint16_t WA_FREQ_164_RANKS[] = {
+  0, 0, 17, 9, 16, 20, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0,
+  0, 26, 0, 0, 0, 25, 13, 0, 3, 0, 7, 0, 0, 0, 6, 23,
+  0, 0, 22, 5, 15, 0, 1, 4, 30, 0, 0, 0, 0, 0, 11, 27,
+  8, 19, 21, 12, 28, 31, 0, 0, 24, 29, 0, 2, 10, 0, 14, 0,
+};
+
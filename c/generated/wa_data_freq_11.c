@@ -0,0 +1,13877 @@
+#include "worldalphabets_data.h"
+
+const char *WA_FREQ_165_TOKENS[] = {
+  "we",
+  "2",
+  "1",
+  "bilen",
+  "3",
+  "4",
+  "döwlet",
+  "10",
+  "türkmen",
+  "6",
+  "hem",
+  "sany",
+  "milli",
+  "üçin",
+  "Bu",
+  "adam",
+  "dili",
+  "gezek",
+  "2.",
+  "Türkmenistanyň",
+  "bolup",
+  "müň",
+  "täze",
+  "000",
+  "5",
+  "7",
+  "Ol",
+  "bagly",
+  "bir",
+  "mln",
+  "ybarat",
+  "1.",
+  "20",
+  "Türkmen",
+  "bar",
+  "bolupdyr",
+  "dilini",
+  "kabul",
+  "km",
+  "onuň",
+  "çenli",
+  "14",
+  "15",
+  "atly",
+  "diliniň",
+  "görnüşi",
+  "kämilleşdirmek",
+  "13",
+  "18",
+  "aýlyk",
+  "bolan",
+  "boýunça",
+  "bu",
+  "döwri",
+  "edildi",
+  "etdi",
+  "has",
+  "möhüm",
+  "n.ç.",
+  "okuw",
+  "orta",
+  "soň",
+  "ýylyň",
+  "ýüze",
+  "11",
+  "8",
+  "Garaşsyzlygymyzyň",
+  "aýlykda",
+  "baglanyşykly",
+  "bilýär",
+  "boldy",
+  "bolmagy",
+  "bolsa",
+  "edip",
+  "elipbiýe",
+  "elipbiýini",
+  "esasy",
+  "eýe",
+  "gowrak",
+  "gün",
+  "km²",
+  "meseleleriň",
+  "ony",
+  "Ýewropa",
+  "öz",
+  "ýaly",
+  "ýylda",
+  "ýyllyk",
+  "ýörite",
+  "Şeýle",
+  "12",
+  "16",
+  "2022-nji",
+  "3.",
+  "30",
+  "Döwlet",
+  "Gündogar",
+  "Meýdany",
+  "Russiýa",
+  "alnyp",
+  "aradan",
+  "barabar",
+  "barada",
+  "baradaky",
+  "berdi",
+  "berildi",
+  "birnäçe",
+  "dil",
+  "dilimiziň",
+  "diňe",
+  "elipbiýi",
+  "elipbiýimizi",
+  "ene",
+  "esaslanýan",
+  "golaý",
+  "günde",
+  "günden",
+  "hakynda",
+  "harplaryna",
+  "her",
+  "ilkinji",
+  "içmeli",
+  "iş",
+  "latyn",
+  "meýdany",
+  "müňe",
+  "oba",
+  "ol",
+  "palatasy",
+  "sagat",
+  "taryhy",
+  "tonna",
+  "to­par­ça­da",
+  "uly",
+  "urşy",
+  "wagtynda",
+  "Özbegistan",
+  "ähli",
+  "çykýar",
+  "çy­kyş",
+  "çäreler",
+  "öwrenmäge",
+  "öň",
+  "ýagny",
+  "ýaşynda",
+  "ýokary",
+  "ýurt",
+  "ýyla",
+  "ýyllar",
+  "ýyllarynda",
+  "Şu",
+  "1-5-nji",
+  "1429",
+  "2-3",
+  "21",
+  "25",
+  "25%",
+  "27",
+  "33",
+  "35",
+  "4.",
+  "5-10",
+  "Aziýa",
+  "Aziýada",
+  "Beýik",
+  "Cam",
+  "Elbetde",
+  "Esasy",
+  "Etrapda",
+  "Garaşsyz",
+  "Garaşsyzlyk",
+  "Günorta",
+  "Hemra",
+  "Hormatly",
+  "Ikinji",
+  "Ilaty",
+  "Karar",
+  "Keseliň",
+  "Lamine",
+  "Lýudowik",
+  "Maslahatda",
+  "Merkezi",
+  "Metallar",
+  "Onda",
+  "Orta",
+  "Prezidentimiziň",
+  "Prezidentiniň",
+  "Soňra",
+  "Täze",
+  "Uzynlygy",
+  "alymlary",
+  "alýan",
+  "amala",
+  "aralygynda",
+  "artdyryldy",
+  "asyrda",
+  "aýdyň",
+  "aýratyn",
+  "bashardy",
+  "berilmegi",
+  "berilýän",
+  "bolupdyr.",
+  "bolýar",
+  "bulgur",
+  "bölümden",
+  "degişli",
+  "dereje",
+  "dilimizi",
+  "dilinde",
+  "diline",
+  "diýip",
+  "doly",
+  "durmuşa",
+  "däl",
+  "döwründe",
+  "edilen",
+  "edilmegi",
+  "edilýär",
+  "edipdir",
+  "elipbiýde",
+  "esasan",
+  "esasynda",
+  "eýsem",
+  "gazanmakdan",
+  "gaýtadan",
+  "geçen",
+  "geçipdir",
+  "geçirilen",
+  "geçirmeleri",
+  "geçmek",
+  "geçýär",
+  "giň",
+  "gollanmalary",
+  "guraldy",
+  "gutarnykly",
+  "guşlaryň",
+  "görnüşden",
+  "göz",
+  "günbatar",
+  "gürrüň",
+  "hakyndaky",
+  "hepdä",
+  "hökmünde",
+  "inkubasion",
+  "içine",
+  "işgärleri",
+  "jemi",
+  "kanuny",
+  "kemeldi",
+  "kitap",
+  "konsul",
+  "maşgala",
+  "mekdebi",
+  "mekdeplerde",
+  "mesele",
+  "meseleleri",
+  "metbugatda",
+  "million",
+  "mil­li",
+  "minut",
+  "mln.",
+  "müñ",
+  "müňden",
+  "n.ç-ni",
+  "neşir",
+  "okuwlar",
+  "olaryň",
+  "ornaşdyrmak",
+  "oç­ko­sy",
+  "pul",
+  "resmi",
+  "sagatlaryň",
+  "sement",
+  "sogan",
+  "sorty",
+  "soňky",
+  "süýdemdirijileriň",
+  "tagta",
+  "tassyklanmagy",
+  "to­par",
+  "ugurda",
+  "wagtda",
+  "yashynda",
+  "Ýokary",
+  "Ýurdumyzyň",
+  "Ýustinanyň",
+  "ç.ç.",
+  "çaga",
+  "çak",
+  "çalt",
+  "çykan",
+  "çykdy",
+  "çykyşlar",
+  "örän",
+  "ösüşi",
+  "öwrenmek",
+  "öwretmek",
+  "üns",
+  "üstünde",
+  "üç",
+  "ýardam",
+  "ýazmaça",
+  "ýaşaýan",
+  "ýaşda",
+  "ýetirmek",
+  "ýeňil",
+  "ýok",
+  "ýurdumyzyň",
+  "ýy­gyn­dy",
+  "ýöriş",
+  "Şeý­le­lik­de",
+  "Şonuň",
+  "şu",
+  "şäherçe",
+  "0,5%",
+  "1,5",
+  "1-2",
+  "1-4",
+  "1-nji",
+  "10,8",
+  "12,7",
+  "1233",
+  "1337",
+  "1360",
+  "1369",
+  "1389",
+  "1415",
+  "1419-njy",
+  "1453",
+  "16 iýul",
+  "1621",
+  "17",
+  "17%",
+  "18 iýun",
+  "185",
+  "187",
+  "1872",
+  "19",
+  "1928",
+  "1950",
+  "1n",
+  "2%",
+  "2,1",
+  "2,5",
+  "2,8",
+  "2.3",
+  "20,7",
+  "2009ý.",
+  "203",
+  "22",
+  "23",
+  "2430",
+  "27%",
+  "27-29-njy",
+  "29",
+  "2912",
+  "3,5",
+  "3-5",
+  "300-den",
+  "31",
+  "3530",
+  "365",
+  "3690",
+  "37",
+  "420",
+  "46",
+  "4edil",
+  "5.",
+  "500",
+  "523",
+  "528",
+  "56%-Demirgazykda",
+  "570",
+  "587",
+  "7.",
+  "740",
+  "87,4",
+  "90%-I",
+  "909",
+  "967-971",
+  "968-969",
+  "Abhaziýanyň",
+  "Afrika",
+  "Aktokaý",
+  "Aldym-berdimli",
+  "Aleksandriýaly",
+  "Aleksandryñ",
+  "All",
+  "Amerikasy",
+  "Ame­ri­ka­dan",
+  "Ame­ri­ka­dan-da",
+  "Amundsen",
+  "Anyk",
+  "Arka",
+  "Arzuw,Ýaşlyk",
+  "Aslynda",
+  "AÖB",
+  "Aşaky",
+  "BABA",
+  "Bagabat",
+  "Bagşylar",
+  "Balkan",
+  "Banu",
+  "Baýdagy",
+  "Baýdak",
+  "Başlangyç",
+  "Bellenilişi",
+  "Beýik Britaniýa",
+  "Birinjiden",
+  "Birnäçe",
+  "Bitarap",
+  "Bolgariýa",
+  "Bra­zi­li­ýada",
+  "Bra­zi­li­ýa­nyň",
+  "Britaniýa",
+  "Bütin",
+  "Day",
+  "Dazzarkel",
+  "Demirgazyk",
+  "Demirgazyk.",
+  "De­mir­ga­zyk",
+  "Digestler",
+  "Dil",
+  "Dilde",
+  "Dilimize",
+  "Dilimiziň",
+  "Diňe",
+  "Dogurmaga",
+  "Dunaýda",
+  "Dün­ýä",
+  "Edwardian",
+  "Ekin",
+  "Emma",
+  "Engelbert",
+  "Ensiklopediýasy",
+  "Erjüment",
+  "Eýran",
+  "FK",
+  "Federasiýasy",
+  "Filmli",
+  "Gambiýada",
+  "Garaşsyzlygyny",
+  "Gary",
+  "Garylan",
+  "Garyp",
+  "Gazagystan",
+  "Gelmintozyň",
+  "Gerek",
+  "Germaniýa",
+  "Gizli",
+  "Goplit",
+  "Grawning",
+  "Gresiýasy",
+  "Guryýer",
+  "Gyrgyzystan",
+  "Gyzyl",
+  "Gökbogma",
+  "Görogly",
+  "Gün",
+  "Günbatar",
+  "Günde",
+  "Gü­nor­ta",
+  "HTTU",
+  "Halk",
+  "Hatyjadan",
+  "Hemişelik",
+  "Hindistan",
+  "Hindistanda",
+  "Hut",
+  "Hytaý",
+  "Häzirki",
+  "Hökümet",
+  "Hüýrlukga",
+  "IX",
+  "Ilatyň",
+  "Imperator",
+  "Imperiýanyň",
+  "Inder",
+  "Indi",
+  "Inkubasion",
+  "Institusiýalar",
+  "Is­pa­ni­ýa­nyň-da",
+  "Italiýa",
+  "Italiýada",
+  "Jogaplar",
+  "Jöweniň",
+  "Kanun",
+  "Kanuny",
+  "Kanunyň",
+  "Kararyna",
+  "Karoling",
+  "Kaufmanyň",
+  "Kawkazda",
+  "Kitabyň",
+  "Kiçi",
+  "Konserwatiw",
+  "Köne",
+  "Lankaster",
+  "Latyn",
+  "Magrib",
+  "Magtymgulynyň",
+  "Mahal",
+  "Marokko",
+  "Maryda",
+  "Maslahatçylar",
+  "Merwde",
+  "Meselem",
+  "Meseläni",
+  "Metbugatdaky",
+  "MitridatII-niň",
+  "Mukaddes",
+  "Munuň",
+  "Mysal",
+  "Mümtaz",
+  "Netijede",
+  "Ne­ti­je­de",
+  "Nowellalar",
+  "Oguz",
+  "Olar",
+  "Olarda",
+  "Olardan",
+  "Olary",
+  "Olaryň",
+  "Ondan",
+  "Onuň",
+  "Ony",
+  "Orta.",
+  "Owganystan",
+  "Oňa",
+  "Pac",
+  "Peloponnes",
+  "Pragada",
+  "Prezidentimiz",
+  "Progressiw",
+  "Pro­wan­syň",
+  "Pudak",
+  "Respublikasyna",
+  "Rezistansl",
+  "Rim",
+  "Rual",
+  "Ruhnamadaky",
+  "Rus",
+  "S",
+  "Sandun",
+  "Saýatly",
+  "Senatyň",
+  "Siriýa",
+  "Sisisliýa",
+  "Sowet",
+  "Soň",
+  "Soň­ra",
+  "Syýasat",
+  "Süými",
+  "Süýtemdirijileriň",
+  "Tahyr",
+  "Taýyarlamak",
+  "Tebigat",
+  "Teoriýasy",
+  "Theory",
+  "Tiresi",
+  "Tom",
+  "Tomus",
+  "To­par­lar",
+  "Tugrasy",
+  "Tupac",
+  "Täjigistan",
+  "Türkmen dili",
+  "Türkmenistan",
+  "Türkmenistanda",
+  "Türkmenistandan",
+  "Türkmenistanyñ",
+  "UV",
+  "Ulanylyşy",
+  "Uly",
+  "Umumy",
+  "Uniwersitetde",
+  "Urug­wa­ýyň",
+  "Uzdaily",
+  "Vol.",
+  "Wekiller",
+  "Witaminli",
+  "Wýetnamda",
+  "XIII",
+  "XIV",
+  "XX",
+  "Yan",
+  "Ylym",
+  "Ylymlar",
+  "Zöhre",
+  "adam/km²",
+  "adamly",
+  "ady",
+  "adyny",
+  "agalygyny",
+  "agram",
+  "agramly",
+  "agronom",
+  "agyr",
+  "agzalary",
+  "akademiýasynyň",
+  "alada",
+  "alamatlary",
+  "alamatlarynyň",
+  "alan",
+  "alanyňda",
+  "albomynda",
+  "alma",
+  "alymlarynyň",
+  "alymlaryň",
+  "alyn­ma­n",
+  "al­ma­na­hy­ny",
+  "alşyldy",
+  "amaly",
+  "amatlydygy",
+  "arassaçylygyna",
+  "arasynda",
+  "artandygy",
+  "ary",
+  "askaridozda",
+  "aslynda",
+  "assosiýasiýalary",
+  "astinom",
+  "asyryň",
+  "atlylary",
+  "atyldy",
+  "awnuk",
+  "awtomobili",
+  "awtorydyr",
+  "az",
+  "azdyr",
+  "açlykdan",
+  "aý",
+  "aýa",
+  "aýakgaplary",
+  "aýbaşy",
+  "aýdan",
+  "aýdym",
+  "aýdymlar",
+  "aýdýarlar",
+  "aýlanyňda",
+  "aýlary",
+  "aýlawynyň",
+  "aýtmaga",
+  "aýy",
+  "aýynda",
+  "aňladýan",
+  "aşyk",
+  "aşyrylmagyna",
+  "aỳ",
+  "babatdaky",
+  "badalga",
+  "bagtymyz",
+  "bahasyna",
+  "bakasyna",
+  "bal",
+  "balyklaryň",
+  "balyny",
+  "bapdan",
+  "barda",
+  "baryldy",
+  "barylmaga",
+  "barylmagyna",
+  "basseýniniň",
+  "bazar",
+  "bazasynda",
+  "baýlygymyz",
+  "baýlygynyň",
+  "baýramçylyk",
+  "baş",
+  "başga",
+  "başlamak",
+  "baştutanlyk",
+  "beg",
+  "belarus",
+  "belleýşi",
+  "berb",
+  "berkararlygynyň",
+  "berkeşen",
+  "berkitmek",
+  "bermek",
+  "berýän",
+  "berýärdi",
+  "beýleki",
+  "beýläk-de",
+  "beý­le­ki­le­rin­de",
+  "bilim",
+  "bilimimiziň",
+  "biliminiň",
+  "biliş",
+  "biljek",
+  "bilmegini",
+  "bil­me­ýär",
+  "binýatlaryny",
+  "biodürlüligi",
+  "biotoparynda",
+  "biri",
+  "biridir",
+  "birinde",
+  "birinji",
+  "birinjisi",
+  "birkemsiz",
+  "birligi",
+  "birlikde",
+  "bogyn",
+  "boldular",
+  "bolmadyk",
+  "bolmajak",
+  "bolmaly",
+  "bolup,öýlenmek",
+  "bolupdy",
+  "britaniyaň",
+  "burç",
+  "buýsanjymyz",
+  "buýsançly",
+  "bäsleşdi.",
+  "bölege",
+  "bölegi",
+  "böleginde",
+  "bölümi",
+  "bölüminde",
+  "bölünipdir",
+  "bölünýär",
+  "bütin",
+  "cykanson",
+  "cykyar",
+  "daglaryň",
+  "dar",
+  "daşarda",
+  "daşary",
+  "degişlidi",
+  "dekabryndaky",
+  "demine",
+  "derejesi",
+  "derejesinde",
+  "derejesine",
+  "derek",
+  "derman",
+  "dersler",
+  "derslerini",
+  "derwaýys",
+  "der­we­zä",
+  "dessanlary",
+  "deň",
+  "deňeşdirilende",
+  "dilimiz",
+  "dilçi",
+  "dissertasiýany",
+  "diwanyň",
+  "di­ňe",
+  "dogrydygyna",
+  "doktorçylyk",
+  "dolandyryşynyň",
+  "dollara",
+  "dowam",
+  "dowamynda",
+  "durlup",
+  "durmuşdaky",
+  "durmuşymyza",
+  "durmuşyň",
+  "durýar",
+  "duz",
+  "du­şu­şyk­lar­dan",
+  "duýulýar",
+  "dynç",
+  "dänelik",
+  "dördünjisi",
+  "döredi",
+  "döredildi",
+  "döretmek",
+  "döwletimiziň",
+  "döwletiň",
+  "döwür",
+  "döwürde",
+  "dünýäsi",
+  "dürli",
+  "dürs",
+  "düzgünler",
+  "düzlükler",
+  "düzmek",
+  "düzüminde",
+  "dü­şen",
+  "düýpgöter",
+  "düýpli",
+  "düşürmek",
+  "ebedilik",
+  "edarasynyň",
+  "eden",
+  "edilerdi",
+  "edilip",
+  "edil­ýär",
+  "edilýar",
+  "edinildi",
+  "ed­ýär",
+  "ed­ýär­ler",
+  "edýär",
+  "efemer",
+  "eken",
+  "ekeni",
+  "eklenipdir",
+  "ekmesine",
+  "eksport",
+  "el-Aksa",
+  "el-Magrib",
+  "elipbiý",
+  "elipbiýdäki",
+  "elipbiýinde",
+  "elipbiýiniň",
+  "elipbiýiň",
+  "ep-esli",
+  "erkek",
+  "erkin",
+  "esas",
+  "esasda",
+  "eseriň",
+  "etdirilýär",
+  "etmeli",
+  "etmän",
+  "eýelemegi",
+  "eýesi",
+  "filark",
+  "filýariozda",
+  "fizika-matematika",
+  "fulbelerde",
+  "ga",
+  "gadymy",
+  "galýar",
+  "gapyrgasy",
+  "garalyp",
+  "garamazdan",
+  "garaýyş",
+  "garaýyşlaryny",
+  "garaşylýar",
+  "garaşýar",
+  "garmaly",
+  "garyndaşlyk",
+  "garyp",
+  "garşylady",
+  "garşylapdyrlar",
+  "gaulo",
+  "gaçyp",
+  "gaýalarynda",
+  "gaýdyp",
+  "gaýnag",
+  "gektar",
+  "gektara",
+  "gelendiginden",
+  "gelindi",
+  "gelmek",
+  "gelýän",
+  "geneşlik",
+  "gerek",
+  "gerime",
+  "gerimli",
+  "gewel",
+  "geçenden",
+  "geçilýär",
+  "geçirildi",
+  "geçirilyär",
+  "geçirilýär",
+  "geçirmegiň",
+  "geçiryärler.",
+  "geçiş",
+  "geňeşi",
+  "geňeşiň",
+  "geňeşlik",
+  "gidipdir",
+  "gippark",
+  "girdi.",
+  "giripdir",
+  "girizilendir",
+  "girizmek",
+  "girýär",
+  "gi­riz­ýär",
+  "golaýy",
+  "goralan",
+  "goramak",
+  "gowky",
+  "gowragy",
+  "gowy",
+  "gozgalanyň",
+  "gozgalyp",
+  "goýberilen",
+  "goýmaly",
+  "goýnuň",
+  "goşalandyrdy",
+  "goşany",
+  "goşun",
+  "goşuna",
+  "goşunlara",
+  "goşunlaryna",
+  "gr",
+  "grek",
+  "gulaja",
+  "gullukda",
+  "gurluşyny",
+  "gurulýança",
+  "guzlaýar",
+  "guýup",
+  "guşluk",
+  "gymmatly",
+  "gysga",
+  "gyz",
+  "gyzyklanmanyň",
+  "gämisini",
+  "gök",
+  "görkezdi",
+  "görkeziji",
+  "görkezilipdir",
+  "görkezipdirler",
+  "görkezmesi",
+  "görmän",
+  "görnetin",
+  "görnüş",
+  "görä",
+  "göterýän",
+  "gözegçilik",
+  "gözlegçisi",
+  "göçürdi",
+  "gündelik",
+  "gündogar",
+  "gündogarynda",
+  "günleri",
+  "gününde",
+  "günüň",
+  "gürlügi",
+  "güýje",
+  "güýç",
+  "güýçlendirmek",
+  "güňden",
+  "habar",
+  "habaryna",
+  "hadysalar",
+  "halk",
+  "halkdan",
+  "halklaryň",
+  "halky",
+  "halkymyza",
+  "halkymyzyň",
+  "halkynda",
+  "halkynyň",
+  "halkyň",
+  "hamsanyň",
+  "hapgyrtma",
+  "harby",
+  "harplaryny",
+  "harplaryň",
+  "hasabat",
+  "hasap",
+  "hasaplamagy",
+  "hasda",
+  "hatarda",
+  "hataryna",
+  "hazynamyzdyr",
+  "ha­sa­ba",
+  "haýsy",
+  "haýwanlardyr",
+  "hem-de",
+  "hemişe",
+  "hemişelik",
+  "hemmem",
+  "hereket",
+  "hereketini",
+  "hloramin",
+  "hojalykçy",
+  "hormatly",
+  "howdany",
+  "hozunyň",
+  "hukugyna",
+  "hukugynda",
+  "hukugyny",
+  "hukuklary",
+  "hytaýly",
+  "hyzmat",
+  "häkimiýetiniň",
+  "höwürtgeläp",
+  "hünärdäki",
+  "hünärlerini",
+  "hünärmenleriň",
+  "hünärmentlerden",
+  "iki",
+  "ikinji",
+  "ikinjiden",
+  "ikinjisi",
+  "ilat",
+  "ilatdan",
+  "ilatly",
+  "ilaty",
+  "il­kin­ji",
+  "ilçileri",
+  "import",
+  "in",
+  "ingaliýasiýalaryny",
+  "institutynyň",
+  "institutyň",
+  "irimçik",
+  "içerki",
+  "içinde",
+  "içiň",
+  "iými",
+  "iýul",
+};
+const uint16_t WA_FREQ_165_RANKS[] = {
+  511, 318, 590, 245, 791, 0, 270, 203, 0, 377, 715, 0, 0, 0, 0, 0,
+  0, 901, 78, 0, 0, 0, 0, 0, 0, 0, 87, 738, 0, 879, 0, 0,
+  264, 665, 861, 0, 0, 0, 0, 0, 0, 0, 116, 343, 499, 0, 779, 139,
+  0, 0, 0, 0, 998, 0, 0, 438, 0, 0, 0, 422, 27, 462, 0, 0,
+  0, 369, 53, 943, 0, 0, 0, 624, 82, 283, 620, 950, 0, 0, 191, 0,
+  0, 0, 0, 0, 0, 0, 0, 628, 0, 0, 0, 0, 0, 26, 683, 0,
+  525, 0, 0, 219, 0, 0, 294, 0, 0, 0, 0, 0, 0, 0, 0, 587,
+  844, 931, 0, 0, 960, 0, 0, 409, 492, 331, 0, 733, 0, 0, 18, 121,
+  0, 893, 1, 655, 757, 818, 784, 639, 973, 0, 167, 0, 0, 554, 798, 0,
+  0, 0, 0, 0, 556, 0, 0, 359, 335, 0, 0, 0, 0, 510, 0, 0,
+  0, 941, 0, 0, 0, 0, 595, 208, 0, 15, 0, 262, 718, 188, 0, 0,
+  543, 303, 744, 0, 393, 0, 0, 0, 297, 0, 295, 258, 0, 249, 423, 677,
+  904, 0, 0, 172, 0, 553, 697, 0, 70, 479, 512, 0, 935, 0, 273, 647,
+  0, 0, 94, 348, 20, 145, 910, 0, 676, 0, 0, 0, 0, 0, 0, 0,
+  197, 932, 0, 454, 0, 246, 572, 937, 0, 0, 0, 0, 0, 198, 0, 562,
+  372, 751, 160, 0, 176, 271, 211, 71, 222, 446, 300, 682, 694, 826, 853, 653,
+  135, 111, 0, 0, 0, 0, 856, 617, 0, 132, 482, 544, 875, 0, 410, 0,
+  0, 577, 0, 643, 0, 0, 956, 0, 0, 0, 671, 557, 130, 0, 0, 0,
+  598, 0, 657, 0, 902, 634, 0, 0, 325, 356, 313, 0, 0, 0, 0, 0,
+  616, 0, 0, 662, 0, 0, 0, 59, 820, 837, 0, 0, 342, 473, 992, 880,
+  0, 0, 750, 872, 332, 592, 0, 0, 0, 0, 917, 0, 0, 0, 0, 0,
+  729, 0, 0, 0, 0, 0, 56, 569, 456, 0, 0, 0, 207, 0, 0, 0,
+  531, 148, 0, 430, 0, 0, 0, 0, 673, 930, 0, 0, 278, 322, 86, 470,
+  933, 576, 966, 796, 79, 307, 77, 354, 457, 205, 524, 827, 0, 0, 159, 0,
+  129, 971, 443, 0, 0, 749, 289, 0, 0, 0, 0, 0, 755, 184, 118, 217,
+  774, 214, 384, 0, 0, 110, 944, 0, 164, 0, 939, 0, 0, 181, 786, 0,
+  0, 241, 0, 959, 128, 0, 0, 488, 392, 535, 690, 990, 775, 0, 223, 0,
+  89, 320, 606, 65, 8, 0, 250, 476, 0, 234, 747, 0, 163, 299, 0, 0,
+  170, 601, 0, 288, 143, 552, 514, 864, 11, 243, 279, 945, 0, 0, 613, 113,
+  986, 0, 920, 0, 0, 0, 0, 0, 447, 0, 0, 0, 0, 843, 913, 0,
+  0, 787, 268, 0, 0, 0, 504, 0, 0, 520, 321, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 801, 0, 216, 895, 178, 0, 0, 0, 0, 0,
+  0, 380, 0, 0, 0, 0, 218, 108, 892, 0, 417, 669, 863, 0, 29, 134,
+  477, 0, 0, 0, 0, 341, 496, 635, 0, 0, 0, 714, 0, 0, 792, 688,
+  900, 336, 979, 0, 0, 247, 921, 908, 0, 0, 716, 239, 778, 0, 0, 699,
+  0, 0, 0, 542, 526, 995, 670, 0, 0, 136, 765, 982, 407, 989, 225, 625,
+  645, 0, 0, 428, 0, 444, 466, 649, 0, 977, 0, 0, 704, 551, 0, 811,
+  0, 0, 0, 166, 0, 0, 0, 0, 161, 857, 0, 0, 0, 120, 585, 260,
+  285, 0, 0, 0, 76, 0, 889, 0, 242, 149, 918, 0, 464, 712, 0, 0,
+  0, 0, 824, 259, 884, 415, 648, 337, 200, 835, 281, 926, 646, 642, 996, 426,
+  311, 589, 399, 850, 227, 405, 0, 603, 604, 463, 400, 813, 0, 474, 491, 0,
+  0, 727, 0, 885, 0, 0, 974, 212, 707, 0, 0, 0, 0, 0, 621, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 962, 0, 0, 0, 17, 739, 458,
+  923, 0, 567, 0, 351, 0, 0, 0, 0, 0, 0, 740, 394, 0, 0, 952,
+  0, 0, 333, 0, 0, 0, 44, 846, 0, 310, 637, 762, 280, 993, 0, 0,
+  0, 0, 0, 0, 0, 475, 0, 0, 24, 638, 650, 654, 0, 0, 0, 0,
+  0, 0, 157, 0, 0, 0, 0, 385, 252, 936, 0, 821, 0, 316, 0, 0,
+  0, 685, 748, 0, 0, 0, 0, 805, 97, 575, 0, 873, 0, 0, 292, 0,
+  0, 0, 538, 0, 0, 0, 0, 919, 0, 141, 46, 236, 265, 0, 0, 101,
+  357, 469, 0, 4, 0, 0, 0, 0, 0, 0, 0, 51, 0, 186, 0, 0,
+  0, 0, 0, 0, 847, 0, 131, 471, 503, 0, 84, 261, 660, 0, 237, 0,
+  0, 334, 0, 194, 777, 498, 0, 832, 0, 156, 287, 95, 189, 226, 419, 519,
+  631, 389, 0, 605, 0, 0, 0, 0, 0, 0, 441, 0, 33, 133, 0, 0,
+  0, 0, 0, 0, 0, 0, 296, 658, 68, 0, 0, 6, 494, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 125, 193, 378, 0,
+  0, 0, 0, 0, 0, 240, 0, 0, 548, 0, 0, 0, 0, 0, 550, 0,
+  36, 0, 0, 840, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 687, 0,
+  41, 717, 886, 564, 0, 0, 0, 0, 0, 0, 0, 0, 370, 849, 0, 305,
+  61, 404, 69, 421, 507, 0, 0, 0, 277, 972, 0, 0, 185, 721, 0, 272,
+  0, 1000, 459, 0, 412, 0, 7, 253, 513, 896, 0, 221, 347, 0, 678, 741,
+  0, 0, 0, 0, 0, 142, 911, 0, 0, 0, 0, 987, 541, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 91, 304, 0, 0, 629, 436, 789, 402, 478, 0,
+  0, 0, 0, 0, 386, 414, 493, 383, 693, 803, 949, 0, 735, 5, 0, 0,
+  909, 726, 0, 728, 522, 391, 776, 0, 0, 0, 903, 0, 238, 0, 0, 0,
+  795, 0, 925, 536, 0, 915, 0, 9, 0, 0, 0, 0, 0, 0, 433, 578,
+  35, 0, 867, 0, 0, 549, 0, 829, 0, 0, 0, 0, 0, 0, 0, 28,
+  0, 0, 0, 0, 0, 0, 32, 0, 495, 150, 518, 0, 546, 153, 768, 558,
+  0, 0, 0, 742, 396, 228, 656, 953, 0, 175, 180, 263, 0, 0, 684, 967,
+  31, 719, 871, 663, 890, 330, 555, 0, 381, 0, 0, 269, 609, 43, 344, 483,
+  326, 367, 501, 772, 869, 0, 0, 0, 0, 0, 808, 508, 0, 0, 720, 838,
+  0, 323, 429, 413, 379, 764, 465, 816, 854, 839, 99, 0, 958, 0, 306, 0,
+  0, 0, 599, 0, 0, 0, 0, 912, 0, 667, 0, 934, 460, 254, 515, 746,
+  831, 0, 833, 0, 851, 668, 0, 327, 0, 0, 0, 62, 0, 0, 220, 0,
+  0, 353, 355, 914, 754, 274, 0, 0, 49, 0, 0, 0, 848, 523, 708, 187,
+  72, 104, 112, 179, 841, 860, 817, 144, 349, 0, 0, 467, 0, 0, 0, 0,
+  0, 0, 870, 0, 0, 0, 0, 0, 0, 10, 75, 0, 0, 0, 0, 781,
+  138, 845, 0, 731, 0, 0, 397, 866, 58, 0, 233, 689, 0, 0, 0, 0,
+  395, 0, 0, 568, 152, 312, 951, 961, 352, 339, 487, 579, 0, 0, 725, 545,
+  0, 0, 0, 0, 0, 290, 710, 0, 0, 652, 736, 63, 644, 174, 905, 0,
+  0, 0, 938, 13, 293, 615, 619, 80, 622, 874, 891, 0, 0, 0, 0, 0,
+  0, 100, 611, 698, 0, 527, 0, 0, 0, 0, 822, 0, 21, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 57, 374, 664, 195, 182, 680, 266, 709, 907,
+  0, 0, 0, 0, 0, 0, 0, 0, 202, 105, 679, 828, 0, 0, 0, 0,
+  0, 0, 999, 868, 0, 0, 0, 0, 0, 0, 319, 788, 126, 0, 0, 114,
+  388, 0, 0, 0, 922, 0, 0, 0, 0, 0, 0, 0, 0, 0, 836, 109,
+  284, 291, 0, 453, 358, 702, 276, 597, 0, 0, 0, 0, 785, 793, 0, 2,
+  0, 955, 0, 0, 0, 812, 0, 0, 0, 0, 398, 964, 0, 0, 0, 794,
+  758, 852, 0, 640, 192, 692, 983, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 703, 102, 752, 834, 449, 0, 0, 0, 373, 954, 282, 0, 0, 0, 3,
+  309, 0, 0, 0, 0, 783, 0, 0, 0, 0, 0, 199, 661, 618, 0, 0,
+  807, 0, 0, 0, 947, 0, 0, 975, 387, 442, 183, 530, 0, 898, 0, 0,
+  706, 434, 0, 66, 368, 534, 67, 760, 0, 0, 957, 509, 691, 858, 916, 0,
+  0, 0, 927, 0, 0, 0, 594, 230, 360, 743, 626, 0, 0, 0, 0, 0,
+  0, 0, 0, 173, 403, 0, 0, 0, 607, 0, 34, 780, 147, 0, 0, 0,
+  0, 0, 154, 25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 641, 771,
+  0, 366, 636, 0, 0, 723, 0, 0, 0, 406, 124, 0, 244, 171, 401, 521,
+  929, 168, 745, 0, 948, 0, 81, 92, 894, 573, 602, 734, 695, 763, 0, 0,
+  0, 897, 540, 190, 0, 127, 106, 371, 484, 0, 0, 0, 0, 0, 231, 0,
+  0, 275, 0, 0, 965, 0, 800, 0, 0, 0, 0, 165, 0, 566, 769, 0,
+  0, 0, 301, 0, 255, 0, 364, 486, 0, 0, 0, 0, 591, 0, 539, 0,
+  0, 0, 0, 490, 506, 0, 432, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 561, 201, 981, 0, 563, 0, 0, 485, 528, 445, 632, 659, 722, 350,
+  0, 64, 88, 876, 256, 0, 700, 74, 547, 0, 0, 565, 0, 0, 0, 0,
+  0, 0, 0, 42, 0, 0, 0, 906, 151, 115, 0, 0, 298, 83, 40, 681,
+  50, 0, 0, 362, 963, 0, 107, 425, 612, 0, 204, 123, 328, 267, 365, 500,
+  883, 0, 0, 0, 0, 440, 862, 865, 0, 39, 137, 90, 119, 314, 431, 55,
+  215, 767, 806, 0, 0, 0, 0, 0, 623, 627, 0, 574, 103, 0, 0, 0,
+  705, 0, 0, 0, 461, 711, 582, 608, 177, 248, 235, 586, 980, 529, 537, 797,
+  988, 0, 560, 0, 0, 0, 0, 0, 489, 970, 213, 232, 0, 593, 0, 0,
+  0, 0, 0, 0, 0, 994, 0, 0, 0, 559, 759, 0, 666, 73, 0, 0,
+  0, 580, 0, 96, 0, 317, 0, 229, 0, 0, 0, 162, 0, 251, 0, 0,
+  809, 0, 881, 0, 0, 146, 610, 0, 448, 0, 0, 0, 0, 390, 766, 0,
+  0, 969, 0, 22, 0, 732, 308, 0, 730, 888, 978, 887, 0, 98, 882, 54,
+  0, 0, 0, 85, 257, 761, 584, 224, 570, 140, 942, 0, 814, 0, 382, 0,
+  0, 0, 0, 842, 859, 0, 0, 286, 0, 0, 0, 0, 0, 0, 0, 0,
+  338, 158, 830, 0, 686, 701, 420, 315, 345, 418, 968, 0, 0, 0, 0, 799,
+  0, 0, 0, 0, 19, 675, 0, 0, 0, 0, 0, 452, 0, 588, 0, 0,
+  0, 0, 0, 0, 0, 451, 753, 0, 737, 0, 0, 0, 0, 0, 815, 0,
+  0, 155, 0, 0, 0, 0, 0, 0, 878, 0, 0, 0, 0, 0, 427, 0,
+  0, 416, 614, 997, 0, 206, 117, 516, 696, 210, 505, 0, 324, 497, 517, 60,
+  0, 0, 976, 0, 0, 0, 0, 0, 0, 0, 37, 0, 756, 480, 0, 672,
+  674, 924, 0, 0, 0, 877, 571, 630, 782, 0, 0, 48, 38, 361, 47, 770,
+  0, 0, 329, 437, 583, 984, 122, 455, 946, 375, 991, 411, 468, 16, 533, 600,
+  363, 804, 0, 0, 0, 810, 819, 0, 0, 899, 93, 802, 0, 196, 209, 424,
+  302, 532, 773, 928, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 169, 855,
+  790, 940, 0, 30, 825, 346, 651, 12, 0, 0, 0, 985, 823, 23, 502, 408,
+  0, 340, 376, 581, 52, 596, 0, 0, 0, 439, 0, 481, 713, 472, 0, 0,
+  0, 724, 45, 0, 0, 0, 0, 0, 0, 0, 450, 633, 0, 0, 0, 435,
+};
+
+const char *WA_FREQ_166_TOKENS[] = {
+  "ang",
+  "sa",
+  "na",
+  "ng",
+  "mo",
+  "ko",
+  "hindi",
+  "ako",
+  "ka",
+  "at",
+  "mga",
+  "ay",
+  "lang",
+  "ba",
+  "ito",
+  "siya",
+  "kung",
+  "para",
+  "isang",
+  "si",
+  "ano",
+  "kayo",
+  "dito",
+  "alam",
+  "may",
+  "tayo",
+  "pero",
+  "lahat",
+  "pa",
+  "nga",
+  "gusto",
+  "oo",
+  "ni",
+  "niya",
+  "wala",
+  "natin",
+  "naman",
+  "o",
+  "ngayon",
+  "kami",
+  "sige",
+  "namin",
+  "sila",
+  "akong",
+  "kailangan",
+  "bakit",
+  "yan",
+  "kaya",
+  "nyo",
+  "ikaw",
+  "anong",
+  "di",
+  "akin",
+  "iyon",
+  "talaga",
+  "tao",
+  "kang",
+  "walang",
+  "sabihin",
+  "mong",
+  "isa",
+  "kong",
+  "nang",
+  "sya",
+  "yun",
+  "niyo",
+  "aking",
+  "dahil",
+  "nya",
+  "huwag",
+  "nasa",
+  "yung",
+  "iyo",
+  "sino",
+  "nila",
+  "kita",
+  "diyos",
+  "meron",
+  "sir",
+  "sabi",
+  "buhay",
+  "okay",
+  "saan",
+  "rin",
+  "salamat",
+  "wag",
+  "bang",
+  "to",
+  "siyang",
+  "kahit",
+  "umalis",
+  "dapat",
+  "din",
+  "iyong",
+  "araw",
+  "siguro",
+  "po",
+  "doon",
+  "eh",
+  "wood",
+  "iyan",
+  "nelson",
+  "paano",
+  "gawin",
+  "kay",
+  "kayong",
+  "noong",
+  "mundo",
+  "oh",
+  "hoy",
+  "iba",
+  "kaibigan",
+  "tama",
+  "tulad",
+  "pumunta",
+  "teka",
+  "nating",
+  "mr.",
+  "y",
+  "tapos",
+  "ibig",
+  "nakita",
+  "kapag",
+  "ginagawa",
+  "kasi",
+  "taon",
+  "nasaan",
+  "maging",
+  "mula",
+  "tingnan",
+  "mas",
+  "puwede",
+  "max",
+  "pala",
+  "bago",
+  "sinabi",
+  "itong",
+  "gabi",
+  "nandito",
+  "ating",
+  "muna",
+  "tungkol",
+  "kaniya",
+  "reggie",
+  "sana",
+  "bahay",
+  "magandang",
+  "totoo",
+  "oras",
+  "ninyo",
+  "parang",
+  "inyo",
+  "buong",
+  "kanya",
+  "sinasabi",
+  "kasama",
+  "ha",
+  "pangalan",
+  "ayaw",
+  "lamang",
+  "anak",
+  "inyong",
+  "igik",
+  "bilis",
+  "maganda",
+  "tubig",
+  "nito",
+  "galing",
+  "baka",
+  "rancho",
+  "pag",
+  "gagawin",
+  "bata",
+  "ibang",
+  "makita",
+  "ginawa",
+  "tayong",
+  "todd",
+  "ayos",
+  "maraming",
+  "yo",
+  "season",
+  "marami",
+  "pang",
+  "halika",
+  "bagay",
+  "mukhang",
+  "ah",
+  "bagong",
+  "lugar",
+  "kaming",
+  "palabas",
+  "nangyayari",
+  "nangyari",
+  "kanyang",
+  "panahon",
+  "sayo",
+  "rito",
+  "elliot",
+  "man",
+  "ngunit",
+  "talagang",
+  "pare",
+  "dalawa",
+  "sandali",
+  "loob",
+  "niyang",
+  "upang",
+  "patay",
+  "magiging",
+  "pwede",
+  "tingin",
+  "trabaho",
+  "mahal",
+  "pulis",
+  "aming",
+  "problema",
+  "kunin",
+  "diyan",
+  "silang",
+  "nakuha",
+  "papa",
+  "naming",
+  "lalaki",
+  "taong",
+  "malaman",
+  "patayin",
+  "labas",
+  "pupunta",
+  "sarili",
+  "mabuti",
+  "the",
+  "heto",
+  "party",
+  "amin",
+  "pumatay",
+  "sorry",
+  "ama",
+  "cyril",
+  "magaling",
+  "kilala",
+  "nakikita",
+  "raju",
+  "hanggang",
+  "dvd",
+  "makikita",
+  "duke",
+  "hey",
+  "akala",
+  "puso",
+  "pia",
+  "kaniyang",
+  "yeah",
+  "sumigaw",
+  "busan",
+  "habang",
+  "tulong",
+  "dalawang",
+  "zoobi",
+  "detective",
+  "kanila",
+  "doobi",
+  "uli",
+  "pakiusap",
+  "ilang",
+  "bukas",
+  "puwedeng",
+  "kamay",
+  "s",
+  "n",
+  "diba",
+  "tulungan",
+  "makinig",
+  "dumating",
+  "malaking",
+  "espada",
+  "kamusta",
+  "babae",
+  "pagkain",
+  "dati",
+  "shishio",
+  "medyo",
+  "dahilan",
+  "alis",
+  "hari",
+  "malapit",
+  "kapatid",
+  "nung",
+  "kailangang",
+  "wow",
+  "noon",
+  "tara",
+  "tumatawa",
+  "farhan",
+  "pagkatapos",
+  "aso",
+  "naging",
+  "sakin",
+  "j-cub",
+  "makakuha",
+  "narinig",
+  "hello",
+  "parati",
+  "susunod",
+  "ngayong",
+  "dwarf",
+  "i",
+  "pinto",
+  "bumalik",
+  "t",
+  "linggo",
+  "maaari",
+  "kelangan",
+  "masyadong",
+  "ganon",
+  "kasalanan",
+  "hayaan",
+  "bilisan",
+  "sasabihin",
+  "mamatay",
+  "daan",
+  "uh",
+  "atin",
+  "bilang",
+  "huli",
+  "gonna",
+  "umaga",
+  "hayop",
+  "tanga",
+  "kanilang",
+  "you",
+  "takbo",
+  "kumuha",
+  "paraan",
+  "takot",
+  "sikat",
+  "huling",
+  "ok",
+  "show",
+  "gasps",
+  "maghintay",
+  "beses",
+  "battosai",
+  "tatay",
+  "nakatira",
+  "lupa",
+  "bear",
+  "syang",
+  "gustong",
+  "yaon",
+  "maliit",
+  "nawala",
+  "mayroon",
+  "huy",
+  "minsan",
+  "dyan",
+  "lumabas",
+  "winters",
+  "miss",
+  "merong",
+  "bawat",
+  "kyoto",
+  "ganito",
+  "katulad",
+  "kundi",
+  "mukha",
+  "malaki",
+  "tumahimik",
+  "tren",
+  "kotse",
+  "opo",
+  "gamit",
+  "ivan",
+  "no",
+  "my",
+  "baby",
+  "magsalita",
+  "nakalimutan",
+  "kaysa",
+  "matagal",
+  "yes",
+  "of",
+  "tumingin",
+  "maaaring",
+  "sigurado",
+  "pumasok",
+  "ya",
+  "hangin",
+  "taas",
+  "masaya",
+  "tawagan",
+  "ilalim",
+  "natatakot",
+  "magagawa",
+  "well",
+  "yang",
+  "niyong",
+  "me",
+  "asawa",
+  "higit",
+  "dun",
+  "su-an",
+  "naku",
+  "barking",
+  "lalaking",
+  "gumawa",
+  "namang",
+  "sumama",
+  "nalaman",
+  "iniisip",
+  "j",
+  "nilang",
+  "kitang",
+  "bansa",
+  "bigyan",
+  "car",
+  "virus",
+  "gubat",
+  "ulo",
+  "makuha",
+  "ramone",
+  "ranchhoddas",
+  "cub",
+  "pano",
+  "pasensiya",
+  "eksena",
+  "manatili",
+  "maupo",
+  "gumagawa",
+  "naisip",
+  "makina",
+  "katie",
+  "tweet",
+  "buksan",
+  "likod",
+  "parehong",
+  "a",
+  "buwan",
+  "nandoon",
+  "minuto",
+  "mamaya",
+  "tumigil",
+  "makapaniwala",
+  "jeremy",
+  "namatay",
+  "pagkakataon",
+  "liwanag",
+  "guys",
+  "dumbo",
+  "kapwa",
+  "kausapin",
+  "parating",
+  "ability",
+  "kalokohan",
+  "kumusta",
+  "basta",
+  "ganyan",
+  "halos",
+  "pareho",
+  "nanay",
+  "wakas",
+  "ipakita",
+  "masama",
+  "kamahalan",
+  "pamilya",
+  "dugo",
+  "nitong",
+  "so",
+  "telepono",
+  "mali",
+  "boypren",
+  "siyempre",
+  "kenshin",
+  "pinatay",
+  "ganoon",
+  "nais",
+  "station",
+  "kanina",
+  "lungsod",
+  "tigil",
+  "thorin",
+  "mag-alala",
+  "chatur",
+  "agad",
+  "excuse",
+  "harap",
+  "kamatayan",
+  "kayang",
+  "pangako",
+  "dad",
+  "mabilis",
+  "kumain",
+  "hanapin",
+  "tawag",
+  "gobyerno",
+  "pakialam",
+  "katsuji",
+  "milyong",
+  "daejeon",
+  "ligtas",
+  "guwapo",
+  "laban",
+  "saki",
+  "ulit",
+  "card",
+  "mamamatay",
+  "episode",
+  "fresnoy",
+  "malakas",
+  "naiintindihan",
+  "enerhiya",
+  "maayos",
+  "unang",
+  "sighs",
+  "toddy",
+  "darating",
+  "tumawag",
+  "sinong",
+  "may-ari",
+  "kailan",
+  "makukuha",
+  "panoorin",
+  "m",
+  "kuha",
+  "grabe",
+  "kama",
+  "palagay",
+  "kuwarto",
+  "mama",
+  "mismo",
+  "ayokong",
+  "on",
+  "lagi",
+  "ibibigay",
+  "hirap",
+  "mahirap",
+  "puwet",
+  "babalik",
+  "sobrang",
+  "pera",
+  "aleman",
+  "kasal",
+  "huh",
+  "bilyong",
+  "tatlong",
+  "tahimik",
+  "kalimutan",
+  "lakas",
+  "uy",
+  "tanong",
+  "nagbibigay",
+  "engineer",
+  "salita",
+  "tignan",
+  "pagdating",
+  "sakit",
+  "dagat",
+  "panganib",
+  "magkaroon",
+  "subukan",
+  "hot",
+  "bahala",
+  "ganun",
+  "wangdu",
+  "tabi",
+  "ibigay",
+  "nahanap",
+  "aba",
+  "krus",
+  "chanchad",
+  "nyang",
+  "papunta",
+  "puno",
+  "mangyayari",
+  "please",
+  "galit",
+  "litrato",
+  "mahilig",
+  "dog",
+  "daw",
+  "maalala",
+  "bakla",
+  "iligtas",
+  "whoa",
+  "dragon",
+  "narito",
+  "mag",
+  "pamamagitan",
+  "nahuli",
+  "pum",
+  "kagabi",
+  "up",
+  "pagiging",
+  "control",
+  "tuwing",
+  "sina",
+  "honey",
+  "ayoko",
+  "sulat",
+  "naririnig",
+  "kada",
+  "ilog",
+  "hubad",
+  "tunay",
+  "handa",
+  "laman",
+  "susi",
+  "kesa",
+  "lawa",
+  "punta",
+  "good",
+  "kakaiba",
+  "bayag",
+  "dali",
+  "ilan",
+  "nagtatrabaho",
+  "katawan",
+  "bears",
+  "turbo",
+  "nakaraan",
+  "inumin",
+  "pabilis",
+  "buti",
+  "batang",
+  "hinahanap",
+  "lampin",
+  "gamitin",
+  "sugita",
+  "tandaan",
+  "katotohanan",
+  "orc",
+  "papatayin",
+  "sigaw",
+  "jin-hee",
+  "panginoon",
+  "sweetie",
+  "kailanman",
+  "estudyante",
+  "out",
+  "soo-an",
+  "muli",
+  "mahalaga",
+  "pasensya",
+  "guwapong",
+  "um",
+  "eto",
+  "sundalo",
+  "mata",
+  "pati",
+  "maari",
+  "zombie",
+  "gaya",
+  "are",
+  "malalaman",
+  "mangyari",
+  "butler",
+  "puro",
+  "kinuha",
+  "nakakatakot",
+  "kaarawan",
+  "nun",
+  "mabuhay",
+  "gaano",
+  "naaalala",
+  "pangunahing",
+  "patawarin",
+  "mona",
+  "planeta",
+  "ma",
+  "titi",
+  "uncensored",
+  "langis",
+  "baril",
+  "baba",
+  "kuya",
+  "nagkaroon",
+  "dalhin",
+  "tiwala",
+  "for",
+  "populasyon",
+  "phone",
+  "masamang",
+  "sarap",
+  "pagod",
+  "gayon",
+  "papuntang",
+  "naintindihan",
+  "mahusay",
+  "kaguluhan",
+  "ibinigay",
+  "gago",
+  "engineering",
+  "kim",
+  "mag-isa",
+  "itsura",
+  "kabundukan",
+  "pwedeng",
+  "pusa",
+  "bumili",
+  "natutuwa",
+  "libro",
+  "pasko",
+  "tuloy",
+  "ina",
+  "una",
+  "tumayo",
+  "sasama",
+  "magkita",
+  "facebook",
+  "nyong",
+  "palm",
+  "kwento",
+  "dadaan",
+  "simula",
+  "andito",
+  "contestant",
+  "bundok",
+  "extra",
+  "mahahanap",
+  "hi",
+  "hesus",
+  "himura",
+  "ganitong",
+  "tumakbo",
+  "chief",
+  "kalaban",
+  "tumabi",
+  "uri",
+  "yon",
+  "baliw",
+  "itlog",
+  "maintindihan",
+  "opisina",
+  "palakpakan",
+  "pag-ibig",
+  "lumaki",
+  "dating",
+  "aya",
+  "apoy",
+  "pen",
+  "wherethebearsare.tv",
+  "naalala",
+  "ring",
+  "nasan",
+  "kapoor",
+  "gutom",
+  "sexy",
+  "ate",
+  "gidget",
+  "emergency",
+  "gawa",
+  "kaoru",
+  "director",
+  "ulan",
+  "labi",
+  "inay",
+  "eagle",
+  "ice",
+  "huminahon",
+  "tiny",
+  "tapusin",
+  "mataas",
+  "ipapakita",
+  "yaman",
+  "naghahanap",
+  "ginagamit",
+  "sampung",
+  "mawala",
+  "lalo",
+  "naninirahan",
+  "panting",
+  "syudad",
+  "isipin",
+  "nakakatawa",
+  "exam",
+  "mabait",
+  "kahoy",
+  "sumunod",
+  "totoong",
+  "sapat",
+  "seryoso",
+  "masasabi",
+  "ding",
+  "dadalhin",
+  "pigilan",
+  "nagsimula",
+  "magaralgal",
+  "pranses",
+  "libo",
+  "viper",
+  "datu",
+  "pag-asa",
+  "mahanap",
+  "magnanakaw",
+  "itigil",
+  "time",
+  "makapaniwalang",
+  "karagatan",
+  "bilbo",
+  "tarantado",
+  "pong",
+  "sinira",
+  "plano",
+  "ibaba",
+  "lumayo",
+  "syempre",
+  "tong",
+  "nalalaman",
+  "nagiging",
+  "e-mail",
+  "carbon",
+  "nilalang",
+  "bola",
+  "ideya",
+  "mister",
+  "ginamit",
+  "paborito",
+  "ewan",
+  "pataas",
+  "sex",
+  "joy",
+  "halimbawa",
+  "itim",
+  "gotta",
+  "umupo",
+  "halaman",
+  "relasyon",
+  "hinihintay",
+  "suot",
+  "huminto",
+  "aalis",
+  "balita",
+  "sira",
+  "buddy",
+  "tatlo",
+  "klase",
+  "pagkakamali",
+  "natural",
+  "pool",
+  "tamang",
+  "binaril",
+  "sumasayaw",
+  "nilason",
+  "kalikasan",
+  "chuckles",
+  "misyon",
+  "yata",
+  "snowball",
+  "bosselet",
+  "alisin",
+  "naglagay",
+  "mahabang",
+  "kin",
+  "paalam",
+  "aktor",
+  "rastogi",
+  "nag",
+  "thanksgiving",
+  "dubai",
+  "tinatawag",
+  "cam",
+  "silencer",
+  "bumaba",
+  "nakilala",
+  "is",
+  "hingal",
+  "vacuum",
+  "siguradong",
+  "pagpunta",
+  "tagumpay",
+  "kuneho",
+  "dala",
+  "apat",
+  "ikot",
+  "malayo",
+  "bartender",
+  "iori",
+  "tanggapin",
+  "sama",
+  "limang",
+  "alalahanin",
+  "where",
+  "kainin",
+  "pabayaan",
+  "banda",
+  "pasok",
+  "bar",
+  "kili",
+  "sandata",
+  "gagawa",
+  "springs",
+  "boyfriend",
+  "danny",
+  "matapos",
+  "kayamanan",
+  "ingat",
+  "itay",
+  "rechampot",
+  "pantalon",
+  "nanalo",
+  "espesyal",
+  "linya",
+  "libong",
+  "maniwala",
+  "niyan",
+  "computer",
+  "grado",
+  "pansinin",
+  "gunggong",
+  "tugtog",
+  "pagkamatay",
+  "trainer",
+  "madali",
+  "karapatan",
+  "umaasa",
+  "pinili",
+  "pendleton",
+  "marahil",
+  "school",
+  "new",
+  "isda",
+  "pagdiriwang",
+  "scooter",
+  "halaga",
+  "kapangyarihan",
+  "raw",
+  "paggawa",
+  "martini",
+  "gumising",
+  "sala",
+  "nababaliw",
+  "hihinto",
+  "klima",
+  "umuwi",
+  "gabing",
+  "sigurong",
+  "tinitingnan",
+  "puntahan",
+  "nakakaraan",
+  "maligayang",
+  "hawak",
+  "isipol",
+  "impormasyon",
+  "nanganganib",
+  "pinadala",
+  "chloe",
+  "relo",
+  "lihim",
+  "butas",
+  "lumang",
+  "pinuno",
+  "espadang",
+  "makarating",
+  "okubo",
+  "sinubukan",
+  "nagawa",
+  "brad",
+  "web",
+  "nagtatago",
+  "bisita",
+  "college",
+  "utot",
+  "and",
+  "naglaro",
+  "laptop",
+  "importante",
+  "kakaibang",
+  "utos",
+  "nakakatuwa",
+  "tumakas",
+  "katapusan",
+  "in",
+  "san",
+  "binigyan",
+  "nakakita",
+  "magkano",
+  "birthday",
+  "pops",
+  "sumakay",
+  "kalahati",
+  "mawawala",
+  "tanungin",
+  "magalala",
+  "balik",
+  "asan",
+  "naiisip",
+  "maghanap",
+  "sitwasyon",
+  "utak",
+  "nawawala",
+  "species",
+  "ibon",
+  "boss",
+  "pintuan",
+  "tatawagin",
+  "ahas",
+  "non",
+  "isip",
+  "langit",
+  "bard",
+};
+const uint16_t WA_FREQ_166_RANKS[] = {
+  0, 165, 0, 386, 0, 305, 0, 0, 0, 588, 0, 497, 587, 787, 225, 365,
+  0, 702, 670, 0, 0, 139, 515, 923, 0, 0, 0, 0, 549, 0, 0, 0,
+  220, 355, 734, 415, 575, 280, 0, 518, 536, 0, 0, 0, 0, 0, 818, 0,
+  0, 70, 394, 608, 0, 0, 0, 693, 768, 0, 0, 0, 75, 597, 0, 860,
+  473, 335, 903, 408, 0, 0, 766, 0, 0, 704, 0, 833, 538, 0, 0, 0,
+  0, 116, 508, 0, 0, 0, 798, 0, 0, 479, 924, 0, 0, 767, 0, 0,
+  0, 0, 349, 0, 0, 0, 0, 0, 0, 941, 0, 0, 224, 762, 0, 0,
+  0, 5, 0, 0, 0, 0, 0, 0, 25, 0, 373, 993, 64, 0, 0, 0,
+  150, 0, 206, 442, 771, 488, 0, 0, 0, 126, 939, 0, 0, 789, 0, 720,
+  153, 511, 850, 0, 160, 0, 42, 703, 0, 864, 0, 654, 0, 41, 0, 0,
+  659, 0, 0, 389, 897, 810, 922, 0, 61, 0, 0, 0, 0, 0, 419, 90,
+  130, 0, 0, 66, 430, 0, 366, 113, 99, 170, 0, 85, 133, 0, 0, 378,
+  681, 524, 103, 562, 738, 871, 954, 666, 1, 0, 0, 384, 491, 0, 0, 0,
+  0, 140, 182, 969, 0, 0, 848, 0, 0, 0, 464, 0, 0, 0, 82, 0,
+  51, 0, 0, 0, 0, 990, 0, 0, 0, 425, 0, 321, 0, 0, 0, 0,
+  44, 221, 0, 0, 0, 782, 69, 299, 0, 0, 593, 0, 0, 400, 658, 0,
+  0, 0, 916, 483, 623, 0, 0, 316, 0, 152, 0, 0, 0, 0, 805, 0,
+  100, 0, 0, 0, 0, 959, 110, 605, 0, 308, 383, 577, 108, 482, 824, 999,
+  0, 0, 542, 0, 0, 454, 0, 0, 477, 823, 0, 0, 0, 0, 890, 0,
+  0, 0, 0, 0, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 361, 655,
+  0, 0, 967, 0, 0, 872, 429, 726, 866, 0, 0, 397, 0, 222, 606, 101,
+  87, 136, 0, 560, 0, 796, 0, 0, 589, 0, 0, 0, 0, 836, 0, 271,
+  0, 0, 0, 0, 0, 158, 839, 865, 0, 0, 0, 369, 204, 431, 337, 438,
+  50, 453, 729, 765, 0, 167, 351, 0, 0, 0, 502, 715, 0, 0, 633, 0,
+  0, 0, 0, 303, 971, 185, 690, 0, 0, 74, 0, 129, 0, 250, 0, 0,
+  0, 0, 0, 0, 18, 609, 377, 0, 265, 0, 700, 0, 0, 180, 0, 0,
+  0, 0, 0, 398, 713, 0, 0, 0, 320, 573, 784, 102, 198, 391, 486, 727,
+  601, 842, 0, 437, 791, 347, 548, 829, 0, 469, 0, 857, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 211, 246, 256, 0, 128, 496, 526, 554,
+  0, 0, 641, 716, 0, 0, 364, 0, 0, 0, 0, 812, 81, 590, 0, 630,
+  0, 895, 0, 281, 707, 0, 227, 0, 0, 0, 0, 0, 0, 628, 240, 752,
+  531, 0, 0, 242, 770, 0, 29, 660, 232, 0, 0, 8, 30, 0, 0, 0,
+  0, 0, 0, 166, 0, 238, 626, 0, 105, 413, 926, 426, 458, 830, 131, 837,
+  0, 0, 0, 0, 0, 252, 893, 0, 0, 0, 0, 49, 406, 0, 0, 0,
+  0, 672, 0, 43, 340, 0, 0, 0, 0, 0, 921, 610, 0, 0, 0, 799,
+  0, 0, 598, 427, 0, 0, 0, 914, 883, 0, 0, 0, 0, 274, 0, 0,
+  0, 62, 527, 0, 834, 485, 661, 0, 937, 0, 0, 0, 0, 0, 503, 270,
+  0, 0, 0, 859, 0, 0, 0, 0, 0, 651, 0, 0, 0, 0, 868, 828,
+  0, 696, 73, 134, 940, 996, 0, 0, 0, 0, 330, 124, 338, 0, 0, 0,
+  0, 772, 0, 0, 17, 67, 0, 490, 359, 925, 264, 0, 736, 648, 949, 0,
+  0, 0, 0, 0, 981, 0, 439, 0, 0, 0, 260, 0, 0, 0, 0, 896,
+  470, 0, 151, 662, 0, 0, 714, 0, 0, 202, 0, 267, 581, 0, 0, 934,
+  493, 363, 728, 867, 3, 880, 159, 0, 0, 0, 0, 59, 0, 53, 873, 0,
+  875, 0, 0, 0, 0, 0, 0, 0, 0, 0, 229, 0, 118, 0, 200, 0,
+  0, 862, 0, 694, 0, 0, 0, 0, 360, 284, 0, 93, 0, 381, 106, 0,
+  0, 564, 0, 0, 203, 0, 0, 0, 0, 0, 636, 0, 0, 0, 983, 0,
+  287, 0, 695, 446, 773, 600, 0, 776, 794, 748, 0, 822, 0, 417, 459, 827,
+  0, 0, 0, 870, 960, 978, 0, 582, 854, 0, 721, 0, 629, 0, 209, 0,
+  0, 0, 0, 595, 0, 578, 0, 519, 979, 0, 0, 551, 352, 691, 783, 411,
+  750, 980, 0, 0, 0, 0, 115, 0, 800, 0, 0, 24, 0, 259, 0, 0,
+  0, 38, 52, 0, 0, 421, 683, 424, 0, 685, 0, 0, 0, 478, 0, 471,
+  0, 535, 977, 933, 0, 226, 0, 0, 22, 0, 0, 0, 0, 0, 145, 811,
+  952, 0, 0, 0, 0, 0, 0, 0, 0, 0, 149, 441, 951, 930, 0, 0,
+  0, 0, 561, 680, 358, 433, 0, 199, 487, 0, 905, 0, 0, 215, 72, 216,
+  292, 183, 109, 12, 243, 354, 217, 611, 323, 840, 0, 816, 0, 0, 307, 245,
+  0, 604, 0, 0, 0, 0, 0, 96, 362, 0, 0, 994, 988, 289, 0, 0,
+  599, 0, 247, 0, 278, 481, 758, 235, 0, 756, 777, 948, 0, 0, 0, 0,
+  576, 282, 460, 0, 540, 814, 0, 0, 0, 89, 956, 0, 0, 107, 0, 0,
+  0, 0, 168, 317, 0, 998, 620, 642, 764, 0, 0, 0, 0, 698, 744, 751,
+  0, 0, 0, 0, 0, 0, 195, 0, 0, 0, 0, 0, 283, 0, 962, 0,
+  0, 0, 0, 304, 743, 785, 0, 0, 0, 0, 0, 0, 0, 879, 0, 803,
+  0, 646, 60, 501, 285, 947, 958, 0, 735, 0, 0, 0, 78, 0, 945, 0,
+  0, 936, 346, 516, 624, 878, 0, 0, 0, 414, 0, 0, 371, 0, 0, 0,
+  0, 0, 0, 975, 0, 0, 0, 0, 0, 0, 56, 0, 0, 965, 0, 0,
+  0, 0, 904, 0, 186, 788, 0, 0, 0, 0, 328, 48, 248, 891, 912, 213,
+  123, 277, 832, 98, 237, 94, 357, 370, 463, 565, 269, 625, 653, 708, 887, 931,
+  0, 0, 137, 310, 143, 333, 16, 344, 645, 0, 9, 26, 882, 0, 0, 495,
+  585, 0, 0, 257, 0, 0, 231, 0, 0, 476, 207, 627, 228, 802, 917, 276,
+  46, 580, 0, 0, 906, 553, 0, 0, 0, 0, 0, 484, 0, 0, 0, 0,
+  676, 28, 874, 57, 0, 0, 273, 114, 675, 819, 117, 0, 311, 0, 514, 0,
+  112, 522, 0, 0, 20, 440, 0, 0, 262, 382, 68, 111, 612, 472, 851, 189,
+  291, 968, 0, 0, 174, 34, 0, 0, 0, 0, 780, 388, 0, 0, 0, 188,
+  617, 0, 0, 0, 423, 0, 403, 0, 294, 0, 0, 293, 684, 849, 929, 0,
+  422, 0, 0, 0, 0, 596, 664, 0, 234, 416, 530, 399, 650, 571, 778, 212,
+  210, 541, 919, 10, 0, 0, 0, 420, 23, 0, 0, 468, 0, 0, 0, 0,
+  0, 935, 0, 241, 656, 761, 0, 717, 0, 119, 0, 0, 881, 0, 138, 499,
+  760, 0, 807, 385, 11, 663, 997, 986, 0, 0, 37, 405, 197, 517, 942, 643,
+  0, 0, 0, 0, 0, 0, 7, 692, 946, 0, 77, 0, 407, 409, 0, 591,
+  0, 0, 0, 0, 380, 334, 0, 0, 325, 428, 0, 566, 0, 233, 154, 671,
+  876, 0, 635, 686, 786, 0, 0, 583, 0, 0, 0, 0, 669, 0, 0, 0,
+  396, 444, 687, 737, 0, 0, 759, 753, 0, 0, 279, 920, 194, 733, 122, 899,
+  0, 0, 821, 0, 513, 932, 0, 0, 326, 230, 390, 0, 574, 0, 0, 0,
+  632, 0, 498, 0, 985, 506, 0, 0, 619, 315, 631, 0, 0, 461, 995, 0,
+  649, 0, 0, 84, 678, 301, 0, 0, 0, 0, 263, 395, 0, 0, 345, 801,
+  176, 368, 835, 894, 261, 739, 0, 0, 0, 844, 953, 0, 0, 0, 0, 0,
+  2, 187, 290, 569, 572, 0, 0, 0, 0, 682, 0, 0, 0, 0, 817, 0,
+  0, 0, 0, 236, 466, 877, 0, 0, 0, 0, 858, 869, 21, 0, 404, 0,
+  65, 809, 545, 0, 0, 83, 0, 0, 0, 0, 928, 976, 0, 544, 306, 0,
+  0, 218, 711, 35, 723, 0, 0, 0, 155, 0, 0, 0, 731, 602, 0, 0,
+  0, 0, 0, 27, 494, 14, 0, 135, 808, 0, 533, 0, 0, 505, 667, 843,
+  0, 0, 888, 523, 31, 0, 0, 550, 104, 579, 901, 141, 447, 863, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 177, 0, 0, 898, 0, 0, 0, 613, 0,
+  0, 336, 0, 449, 0, 0, 435, 0, 0, 97, 0, 0, 0, 0, 205, 0,
+  0, 0, 950, 0, 0, 790, 0, 724, 955, 1000, 0, 991, 586, 91, 0, 0,
+  15, 779, 0, 0, 0, 984, 0, 251, 0, 156, 288, 725, 343, 806, 436, 546,
+  909, 296, 0, 0, 0, 0, 0, 0, 0, 0, 657, 0, 0, 0, 644, 813,
+  0, 0, 268, 376, 639, 6, 705, 847, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 331, 884, 987, 457, 147, 534, 13, 673, 568, 719, 820, 592, 889, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 637, 0, 861, 0, 350, 910, 0,
+  0, 0, 0, 0, 208, 86, 0, 0, 0, 0, 0, 0, 957, 763, 616, 0,
+  0, 0, 0, 0, 45, 254, 178, 309, 0, 0, 0, 375, 0, 521, 0, 0,
+  525, 0, 120, 712, 367, 710, 615, 607, 634, 39, 443, 0, 618, 0, 0, 745,
+  0, 638, 697, 622, 0, 0, 556, 825, 0, 0, 0, 0, 0, 0, 302, 0,
+  668, 989, 567, 558, 0, 0, 0, 157, 462, 0, 0, 757, 127, 0, 0, 410,
+  855, 741, 393, 0, 0, 0, 0, 0, 0, 0, 679, 319, 0, 0, 58, 0,
+  0, 0, 0, 327, 132, 911, 0, 0, 332, 547, 0, 214, 175, 418, 701, 258,
+  510, 164, 539, 0, 272, 255, 0, 0, 0, 706, 0, 826, 0, 603, 0, 372,
+  324, 0, 0, 885, 0, 0, 0, 938, 944, 0, 298, 754, 0, 964, 432, 0,
+  0, 552, 190, 614, 0, 838, 892, 900, 0, 142, 0, 88, 489, 0, 191, 0,
+  0, 0, 297, 746, 0, 0, 0, 0, 0, 512, 0, 253, 161, 0, 0, 918,
+  961, 0, 47, 792, 0, 387, 927, 474, 915, 908, 0, 804, 0, 0, 0, 0,
+  845, 219, 0, 0, 677, 451, 339, 509, 0, 0, 0, 0, 0, 0, 0, 19,
+  755, 0, 0, 0, 570, 146, 0, 342, 963, 286, 769, 329, 0, 0, 172, 0,
+  40, 0, 0, 163, 181, 0, 0, 974, 0, 33, 0, 0, 455, 450, 532, 401,
+  0, 0, 0, 841, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 742, 162, 0, 774, 0, 193, 456, 0, 275, 0, 852, 555,
+  709, 125, 192, 992, 434, 0, 0, 201, 793, 341, 674, 781, 249, 448, 529, 797,
+  815, 846, 688, 0, 0, 0, 0, 0, 0, 492, 0, 0, 0, 465, 982, 475,
+  0, 0, 402, 0, 0, 148, 196, 313, 913, 0, 353, 740, 902, 0, 312, 95,
+  322, 563, 0, 0, 0, 223, 722, 0, 467, 300, 0, 0, 0, 0, 0, 0,
+  266, 71, 314, 500, 543, 4, 445, 0, 0, 0, 0, 0, 0, 0, 0, 665,
+  0, 732, 0, 0, 412, 239, 594, 379, 730, 0, 318, 0, 0, 0, 480, 184,
+  528, 0, 0, 0, 0, 392, 0, 0, 121, 144, 972, 0, 80, 689, 0, 559,
+  0, 943, 0, 171, 63, 0, 0, 647, 970, 973, 0, 0, 0, 775, 0, 0,
+  0, 0, 795, 0, 0, 640, 0, 0, 55, 507, 584, 452, 0, 966, 886, 718,
+  0, 504, 54, 36, 747, 831, 0, 557, 76, 356, 0, 295, 0, 0, 0, 853,
+  699, 244, 749, 0, 0, 0, 0, 0, 0, 169, 520, 856, 652, 0, 348, 0,
+  0, 173, 621, 0, 537, 0, 0, 92, 0, 907, 0, 179, 0, 79, 374, 0,
+};
+
+const char *WA_FREQ_167_TOKENS[] = {
+  "go",
+  "le",
+  "a",
+  "ba",
+  "ka",
+  "ya",
+  "e",
+  "mo",
+  "o",
+  "re",
+  "ke",
+  "di",
+  "gore",
+  "fa",
+  "se",
+  "wa",
+  "ga",
+  "tsa",
+  "ne",
+  "tse",
+  "sa",
+  "kwa",
+  "la",
+  "mme",
+  "bo",
+  "bone",
+  "jwa",
+  "nna",
+  "A",
+  "O",
+  "na",
+  "batho",
+  "fela",
+  "yo",
+  "gagwe",
+  "tla",
+  "jalo",
+  "dira",
+  "Go",
+  "Rre",
+  "thata",
+  "ntse",
+  "jaaka",
+  "bona",
+  "tlaa",
+  "teng",
+  "mongwe",
+  "Fa",
+  "gape",
+  "bangwe",
+  "Ke",
+  "bana",
+  "tswa",
+  "ene",
+  "Mme",
+  "neng",
+  "Ka",
+  "pele",
+  "rona",
+  "E",
+  "motho",
+  "Ba",
+  "puso",
+  "dingwe",
+  "nako",
+  "ngwaga",
+  "morago",
+  "Re",
+  "bua",
+  "yone",
+  "madi",
+  "sentle",
+  "Botswana",
+  "bile",
+  "eo",
+  "tshwanetse",
+  "motse",
+  "tiro",
+  "Mo",
+  "lefatshe",
+  "jaana",
+  "Modimo",
+  "itse",
+  "supa",
+  "thusa",
+  "tlhalosa",
+  "tsone",
+  "gone",
+  "tsaya",
+  "jo",
+  "jang",
+  "nne",
+  "twe",
+  "ntlha",
+  "ngwana",
+  "nngwe",
+  "Ga",
+  "kopa",
+  "setse",
+  "Setswana",
+  "kgotsa",
+  "batla",
+  "dingwaga",
+  "masome",
+  "Kgosi",
+  "lo",
+  "Batswana",
+  "metsi",
+  "tsena",
+  "leng",
+  "Le",
+  "boletse",
+  "sengwe",
+  "dilo",
+  "ditiro",
+  "kana",
+  "tota",
+  "rile",
+  "botlhokwa",
+  "mmogo",
+  "tsotlhe",
+  "one",
+  "ra",
+  "letsatsi",
+  "eng",
+  "batsadi",
+  "Borwa",
+  "tsela",
+  "banana",
+  "tswelela",
+  "gago",
+  "seemo",
+  "morafe",
+  "kgang",
+  "seo",
+  "godimo",
+  "ele",
+  "kgona",
+  "jaanong",
+  "bontsi",
+  "gongwe",
+  "ile",
+  "dirisa",
+  "tlhoka",
+  "Jesu",
+  "simolola",
+  "setshaba",
+  "tlase",
+  "bolela",
+  "sepe",
+  "kgaolo",
+  "tle",
+  "lone",
+  "sena",
+  "ntle",
+  "tsweletse",
+  "oo",
+  "ko",
+  "Se",
+  "feta",
+  "kgaolong",
+  "nang",
+  "raya",
+  "tlhalositse",
+  "kgone",
+  "motseng",
+  "sone",
+  "dijo",
+  "ebile",
+  "baithuti",
+  "mangwe",
+  "ja",
+  "lefoko",
+  "rotloetsa",
+  "botlhe",
+  "kae",
+  "lesome",
+  "dirwa",
+  "lephata",
+  "lenaneo",
+  "tona",
+  "botshelo",
+  "dikgang",
+  "banni",
+  "thuto",
+  "eno",
+  "ntsha",
+  "sekole",
+  "seng",
+  "bogolo",
+  "ise",
+  "Aforika",
+  "monna",
+  "leka",
+  "rata",
+  "utlwa",
+  "mabedi",
+  "reng",
+  "tseo",
+  "bobedi",
+  "kgwedi",
+  "gompieno",
+  "leno",
+  "sale",
+  "ditlhabololo",
+  "kgotla",
+  "kopile",
+  "seabe",
+  "mananeo",
+  "kgolo",
+  "leo",
+  "bao",
+  "leruo",
+  "lwa",
+  "dumela",
+  "lengwe",
+  "pedi",
+  "mosadi",
+  "ema",
+  "tlhola",
+  "dintsi",
+  "bongwe",
+  "akaretsa",
+  "rre",
+  "bosheng",
+  "mafoko",
+  "seka",
+  "kgosi",
+  "molao",
+  "ntswa",
+  "bomme",
+  "dirang",
+  "selo",
+  "Ya",
+  "dirisiwa",
+  "malatsi",
+  "tsamaya",
+  "me",
+  "dikgomo",
+  "tloga",
+  "supile",
+  "gae",
+  "setlhopha",
+  "tshwana",
+  "amogela",
+  "mararo",
+  "ope",
+  "komiti",
+  "lefatsheng",
+  "maemo",
+  "mogare",
+  "Fela",
+  "Gaborone",
+  "dinao",
+  "naga",
+  "dithuto",
+  "yoo",
+  "fitlhela",
+  "lemoga",
+  "palo",
+  "lefelo",
+  "ngwao",
+  "dire",
+  "ruta",
+  "moo",
+  "ditirelo",
+  "barutabana",
+  "badiri",
+  "pelo",
+  "wena",
+  "maikaelelo",
+  "sele",
+  "wela",
+  "ditsela",
+  "foo",
+  "santse",
+  "kgwebo",
+  "thuso",
+  "Batho",
+  "tshwara",
+  "nale",
+  "gare",
+  "ao",
+  "leina",
+  "matshelo",
+  "dirile",
+  "maduo",
+  "tlatsa",
+  "Mmamalome",
+  "farologana",
+  "koo",
+  "pula",
+  "tsenya",
+  "felela",
+  "Gape",
+  "be",
+  "fitlha",
+  "lehuma",
+  "direla",
+  "boela",
+  "mathata",
+  "tshela",
+  "baagi",
+  "aga",
+  "sebaka",
+  "tokafatsa",
+  "buile",
+  "leba",
+  "lona",
+  "tharo",
+  "dipalo",
+  "kile",
+  "lekgotla",
+  "ye",
+  "kgomo",
+  "ntsi",
+  "tirong",
+  "bolwetse",
+  "isa",
+  "Khama",
+  "botlhano",
+  "metse",
+  "Motswana",
+  "lebega",
+  "mapodisi",
+  "dikgwebo",
+  "Kwa",
+  "bantsi",
+  "bokgoni",
+  "sala",
+  "Bangwe",
+  "botsa",
+  "Tautona",
+  "gantsi",
+  "bidiwa",
+  "dikoloi",
+  "otlhe",
+  "tswang",
+  "borre",
+  "molato",
+  "puo",
+  "botlhoko",
+  "diatla",
+  "fitlhelela",
+  "masimo",
+  "temo",
+  "gakolola",
+  "kwala",
+  "itsholelo",
+  "simolotse",
+  "HIV",
+  "ithuta",
+  "kgotleng",
+  "maloko",
+  "banna",
+  "farologaneng",
+  "maloba",
+  "potlana",
+  "tlhabolola",
+  "tsamaiso",
+  "mowa",
+  "toropo",
+  "Aferika",
+  "araba",
+  "balemi",
+  "Tsa",
+  "ditlhopho",
+  "fetileng",
+  "kopana",
+  "mantsi",
+  "Tona",
+  "khansele",
+  "mmele",
+  "mopalamente",
+  "bojalwa",
+  "boleng",
+  "bong",
+  "nakong",
+  "nwa",
+  "phuthego",
+  "Jaanong",
+  "borukutlhi",
+  "buiwa",
+  "kereke",
+  "dithoto",
+  "lela",
+  "mafelo",
+  "tseleng",
+  "basadi",
+  "diphologolo",
+  "gona",
+  "Morago",
+  "botoka",
+  "karolo",
+  "netefatsa",
+  "nosi",
+  "tlogela",
+  "boraro",
+  "matlho",
+  "tsile",
+  "botsogo",
+  "metshameko",
+  "ntlo",
+  "sekoleng",
+  "sekolo",
+  "tlhokomela",
+  "dingwageng",
+  "goroga",
+  "Puso",
+  "gale",
+  "gola",
+  "koloi",
+  "tsene",
+  "Home",
+  "baya",
+  "bogosi",
+  "dikgwetlho",
+  "matlo",
+  "mmino",
+  "ditsha",
+  "mokgwa",
+  "tlhoko",
+  "Naledi",
+  "letlhoko",
+  "motlakase",
+  "2013",
+  "Mongwe",
+  "borwa",
+  "dinako",
+  "mosetsana",
+  "lwantsha",
+  "bosupa",
+  "gaufi",
+  "lema",
+  "lwapeng",
+  "mang",
+  "mogolo",
+  "batle",
+  "kgakala",
+  "maikutlo",
+  "YBB",
+  "dikereke",
+  "segolo",
+  "are",
+  "bonala",
+  "bonwa",
+  "maiteko",
+  "nnang",
+  "reka",
+  "thulaganyo",
+  "makgolo",
+  "ruri",
+  "Kgang",
+  "Mothusa",
+  "eme",
+  "bothata",
+  "lefelong",
+  "rekisa",
+  "Mahalapye",
+  "bophara",
+  "bosigo",
+  "molomo",
+  "maatla",
+  "gammogo",
+  "molemo",
+  "ofisi",
+  "tlhogo",
+  "dikobo",
+  "tlhabololo",
+  "ditlhare",
+  "monate",
+  "ntseng",
+  "Morena",
+  "beke",
+  "fokotsa",
+  "mabapi",
+  "nokeng",
+  "tseye",
+  "tshwanetseng",
+  "dikole",
+  "Mmualebe",
+  "beng",
+  "ee",
+  "motlhofo",
+  "nageng",
+  "Banni",
+  "kgatlhanong",
+  "leboga",
+  "nnile",
+  "tshwanela",
+  "yona",
+  "mengwe",
+  "setšhaba",
+  "tiriso",
+  "tletse",
+  "Phukwi",
+  "bagolo",
+  "boa",
+  "ipotsa",
+  "mogopolo",
+  "barui",
+  "mane",
+  "mmaagwe",
+  "nnete",
+  "Thuto",
+  "Tota",
+  "bolelela",
+  "lobaka",
+  "tlala",
+  "tlhole",
+  "tshwanelo",
+  "tÅ¡a",
+  "mokgatlho",
+  "Mma",
+  "Palapye",
+  "babedi",
+  "mosimane",
+  "nama",
+  "tautona",
+  "tlotla",
+  "ditlhopha",
+  "fatshe",
+  "phuthegong",
+  "bolelwa",
+  "golo",
+  "kete",
+  "tsebe",
+  "bathong",
+  "fetsa",
+  "lentswe",
+  "moletlo",
+  "mosola",
+  "boikarabelo",
+  "fenya",
+  "ikuela",
+  "lelwapa",
+  "Mopalamente",
+  "bofelo",
+  "bokone",
+  "gana",
+  "ge",
+  "tlhaloganya",
+  "Seretse",
+  "etela",
+  "lebaka",
+  "oketsa",
+  "tsere",
+  "fiwa",
+  "kakaretso",
+  "matlhano",
+  "sekai",
+  "Jaaka",
+  "Lephata",
+  "bagwebi",
+  "baka",
+  "mabele",
+  "mmalwa",
+  "palelwa",
+  "tshaba",
+  "Kana",
+  "batlang",
+  "boemong",
+  "mafatshe",
+  "natla",
+  "neela",
+  "tlang",
+  "tlhano",
+  "tsewa",
+  "yotlhe",
+  "didirisiwa",
+  "dumalana",
+  "gatelela",
+  "utlwala",
+  "Bontsi",
+  "bereka",
+  "dikgato",
+  "dipula",
+  "kgonang",
+  "tsala",
+  "2001",
+  "dilwana",
+  "godisa",
+  "ikonomi",
+  "tshwanelwa",
+  "Ipelegeng",
+  "Mogolwane",
+  "bogodu",
+  "dipuo",
+  "maikarabelo",
+  "tiragalo",
+  "tlhopha",
+  "Motho",
+  "bodiredi",
+  "fetola",
+  "lorato",
+  "mothusa",
+  "tlhaelo",
+  "tÅ¡e",
+  "Aferika Borwa",
+  "babereki",
+  "diragala",
+  "itseng",
+  "jone",
+  "lemogile",
+  "patlisiso",
+  "Sekgoa",
+  "abela",
+  "bala",
+  "SeswantÅ¡ho",
+  "ditlamelo",
+  "kabo",
+  "Pele",
+  "borataro",
+  "diragatsa",
+  "Article",
+  "duela",
+  "gonne",
+  "tshwenngwa",
+  "tsoga",
+  "Bokone",
+  "akanya",
+  "dibuka",
+  "ditsala",
+  "fale",
+  "jewa",
+  "lesego",
+  "monongwaga",
+  "tumelo",
+  "Sofi",
+  "bitsa",
+  "dithuso",
+  "fetoga",
+  "Bophirima",
+  "Letsatsi",
+  "ama",
+  "bane",
+  "dipotso",
+  "ntlong",
+  "sechaba",
+  "setso",
+  "tlamela",
+  "Israele",
+  "bogologolo",
+  "boitumelo",
+  "bonako",
+  "botlalo",
+  "kitso",
+  "latelang",
+  "letsogo",
+  "loso",
+  "malwetse",
+  "thusiwa",
+  "Maun",
+  "Yunibesiti",
+  "buang",
+  "bula",
+  "dijwalo",
+  "diphuthego",
+  "gaisa",
+  "ngogola",
+  "tirisong",
+  "tshameka",
+  "tshenyetso",
+  "tshwere",
+  "Modulasetilo",
+  "Serowe",
+  "basimane",
+  "dikgaolo",
+  "dile",
+  "ditshupo",
+  "itumelela",
+  "leitlho",
+  "matshwenyego",
+  "rena",
+  "rileng",
+  "tshwetso",
+  "Details",
+  "Polelo",
+  "bue",
+  "eletsa",
+  "Morwadi",
+  "kgothatsa",
+  "mokapelo",
+  "selekanyo",
+  "tlhokang",
+  "boimana",
+  "bolaya",
+  "diaparo",
+  "ditiragalo",
+  "gope",
+  "kgwele",
+  "kobo",
+  "molelo",
+  "ono",
+  "potso",
+  "Ra",
+  "boammaaruri",
+  "dikgosi",
+  "ditirong",
+  "kgweetsa",
+  "lebile",
+  "modulasetilo",
+  "of",
+  "tikologo",
+  "tlhalosetsa",
+  "AIDS",
+  "Tshireletso",
+  "itshetsa",
+  "lotlhe",
+  "malatsing",
+  "megopolo",
+  "mono",
+  "sekolong",
+  "tlhoma",
+  "tshegetsa",
+  "tshwarwa",
+  "Tori",
+  "boipelego",
+  "lerato",
+  "mafelong",
+  "maswe",
+  "motshameko",
+  "Ditiro",
+  "Letlhakeng",
+  "Molao",
+  "Yo",
+  "ano",
+  "boipuso",
+  "bojanala",
+  "diphetogo",
+  "dipodi",
+  "dirisana",
+  "dithutong",
+  "ditso",
+  "goga",
+  "gotlhelele",
+  "je",
+  "kaya",
+  "latela",
+  "metseng",
+  "ngwageng",
+  "ntlheng",
+  "solofela",
+  "thusang",
+  "thuse",
+  "000",
+  "Moruti",
+  "Nna",
+  "Tiro",
+  "botshelong",
+  "emisa",
+  "epe",
+  "kgonne",
+  "kokelong",
+  "lebogela",
+  "mabaka",
+  "magareng",
+  "maina",
+  "masika",
+  "merogo",
+  "ntwa",
+  "nyeletso",
+  "ratang",
+  "rotloeditse",
+  "selelo",
+  "tlisa",
+  "Lefoko",
+  "Local",
+  "Mokgatlho",
+  "dule",
+  "noka",
+  "phefo",
+  "phiri",
+  "senya",
+  "setseng",
+  "time",
+  "tseno",
+  "bega",
+  "dikolo",
+  "ditshwanelo",
+  "itirela",
+  "lephateng",
+  "madirelo",
+  "setshabeng",
+  "utlwe",
+  "Lefatshe",
+  "Master",
+  "bophirima",
+  "ela",
+  "farologanyeng",
+  "itaya",
+  "kaile",
+  "kankere",
+  "sekaseka",
+  "sepodisi",
+  "sireletsa",
+  "tsenwa",
+  "Lekgotla",
+  "Potso",
+  "Study",
+  "aba",
+  "bagodi",
+  "bonang",
+  "dikago",
+  "kagiso",
+  "kopo",
+  "lebala",
+  "marapo",
+  "molaong",
+  "Kanye",
+  "bolawa",
+  "dintlha",
+  "dirise",
+  "dirwang",
+  "kago",
+  "lekalana",
+  "letlalo",
+  "maoto",
+  "thuo",
+  "tlile",
+  "tshwerwe",
+  "tsibogela",
+  "2010",
+  "Dr",
+  "Lobatse",
+  "Ngwana",
+  "baeng",
+  "bokamoso",
+  "buisa",
+  "gopola",
+  "kompone",
+  "malwapeng",
+  "tswe",
+  "Francistown",
+  "buisana",
+  "gangwe",
+  "kare",
+  "melemo",
+  "mogolwane",
+  "semmuso",
+  "setlhare",
+  "Mokhanselara",
+  "Molepolole",
+  "bokete",
+  "dikotsi",
+  "dirileng",
+  "kalafi",
+  "maano",
+  "tlhomamisa",
+  "tsamaisa",
+  "Gompieno",
+  "Neo",
+  "amang",
+  "bofefo",
+  "inaakanya",
+  "kgwetlho",
+  "lenyalo",
+  "leuba",
+  "malwapa",
+  "motlhala",
+  "tsona",
+  "1",
+  "2012",
+  "Thamaga",
+  "and",
+  "felele",
+  "joo",
+  "maphata",
+  "mosepele",
+  "tshwanang",
+  "Baithuti",
+  "Monna",
+  "Superintendent",
+  "bararo",
+  "dikete",
+  "dipe",
+  "dirisang",
+  "eleng",
+  "gakolotse",
+  "maleba",
+  "melao",
+  "motheo",
+  "rraagwe",
+  "seno",
+  "thoko",
+  "tlhama",
+  "Dilo",
+  "baakanya",
+  "boroko",
+  "dikgaolong",
+  "diporojeke",
+  "dirisiwang",
+  "godile",
+  "lebelela",
+  "leloko",
+  "moruti",
+  "tlhako",
+  "boleletse",
+  "bonno",
+  "bontlha",
+  "gole",
+  "katlego",
+  "mafatsheng",
+  "pina",
+  "rapela",
+  "yang",
+  "2009",
+  "Gore",
+  "Puo",
+  "Tswapong",
+  "Zimbabwe",
+  "busetsa",
+  "dipatlisiso",
+  "kgaogana",
+  "latlhela",
+  "mafaratlhatlha",
+  "masimong",
+  "morwa",
+  "motsana",
+  "ntshitse",
+  "sepolotiki",
+  "seriti",
+  "setsha",
+  "tlhagisa",
+  "tsenelela",
+  "tsweng",
+  "Ge",
+  "Kutlwano",
+  "bogale",
+  "botlhale",
+  "lehumeng",
+  "molaetsa",
+  "moletlong",
+  "rwala",
+  "seatla",
+  "sebe",
+  "tsholofelo",
+  "tshwenya",
+  "Issue",
+  "Sekolo",
+  "Volume",
+  "boeteledipele",
+  "bonolo",
+  "dikgwedi",
+  "emela",
+  "itsiwe",
+  "matlalo",
+  "mong",
+  "mosong",
+  "ngongorega",
+  "rarabolola",
+  "siame",
+  "tlhaloganyo",
+  "Archives",
+  "Laboraro",
+  "Tutume",
+  "akgola",
+  "bonya",
+  "dikai",
+  "dipoelo",
+  "ipelela",
+  "itsise",
+  "konokono",
+  "laola",
+  "makhanselara",
+  "mokhanselara",
+  "opela",
+  "pego",
+  "reetsa",
+  "tswelele",
+  "bakgweetsi",
+  "bidiwang",
+  "bongaka",
+  "bontle",
+  "dimpho",
+  "isiwa",
+  "kalo",
+  "pharologanyo",
+  "tlhokafala",
+  "2008",
+  "Ghanzi",
+  "Kgalagadi",
+  "Motse",
+  "badimo",
+  "botho",
+  "dikomiti",
+  "dipalamo",
+  "diphuthegong",
+  "dituelo",
+  "fitlhelwa",
+  "kgala",
+  "merafe",
+  "motsadi",
+  "pusong",
+  "tlhokomelo",
+  "tsenye",
+  "Bakwena",
+  "Bana",
+  "Dithuto",
+  "Masire",
+};
+const uint16_t WA_FREQ_167_RANKS[] = {
+  0, 0, 0, 602, 779, 0, 453, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 708, 0, 0, 732, 0, 184, 308, 328, 950, 78, 336, 402,
+  428, 523, 542, 0, 0, 0, 949, 387, 0, 760, 0, 645, 751, 356, 450, 592,
+  899, 963, 904, 0, 0, 0, 299, 0, 0, 875, 871, 784, 109, 0, 0, 40,
+  0, 619, 0, 0, 0, 0, 0, 0, 869, 0, 0, 0, 0, 0, 913, 0,
+  0, 0, 0, 590, 0, 890, 383, 992, 0, 563, 59, 691, 983, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 643, 489, 467, 787, 250, 805, 733,
+  0, 8, 764, 0, 0, 170, 935, 367, 128, 236, 390, 454, 942, 0, 0, 122,
+  0, 0, 0, 836, 0, 0, 142, 0, 594, 934, 314, 854, 18, 946, 0, 0,
+  572, 451, 0, 0, 0, 0, 0, 0, 0, 0, 377, 358, 646, 908, 0, 989,
+  0, 0, 0, 0, 911, 108, 0, 373, 319, 0, 0, 413, 0, 0, 0, 893,
+  0, 0, 0, 0, 0, 649, 0, 0, 584, 634, 0, 0, 0, 101, 600, 823,
+  0, 255, 265, 622, 0, 0, 0, 0, 343, 0, 0, 0, 273, 0, 0, 0,
+  284, 0, 335, 540, 0, 0, 459, 0, 274, 485, 621, 429, 720, 798, 926, 0,
+  0, 500, 603, 863, 395, 0, 0, 0, 0, 0, 398, 0, 537, 0, 0, 208,
+  569, 0, 0, 408, 449, 556, 665, 0, 0, 509, 664, 0, 0, 397, 681, 440,
+  988, 145, 0, 0, 0, 0, 0, 0, 0, 607, 956, 0, 0, 415, 974, 0,
+  0, 699, 898, 492, 0, 0, 694, 0, 0, 346, 0, 0, 0, 0, 0, 0,
+  407, 44, 227, 73, 845, 76, 176, 0, 438, 666, 918, 0, 0, 422, 589, 0,
+  0, 564, 0, 0, 157, 316, 0, 1000, 411, 0, 0, 416, 16, 0, 551, 0,
+  418, 507, 0, 867, 0, 606, 379, 0, 0, 378, 421, 750, 616, 0, 0, 0,
+  0, 0, 0, 723, 212, 465, 776, 788, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 546, 0, 0, 574, 0, 0, 0, 596, 0, 0, 0, 0,
+  0, 719, 0, 539, 95, 744, 0, 232, 0, 940, 0, 196, 577, 0, 518, 669,
+  0, 0, 0, 209, 269, 0, 0, 0, 936, 370, 728, 0, 0, 63, 471, 852,
+  0, 0, 615, 0, 283, 166, 557, 329, 593, 741, 263, 446, 0, 0, 0, 0,
+  0, 0, 0, 189, 238, 617, 530, 0, 0, 0, 0, 0, 0, 0, 0, 482,
+  261, 510, 231, 3, 566, 980, 0, 135, 568, 856, 896, 382, 25, 0, 0, 0,
+  0, 0, 47, 0, 0, 247, 0, 368, 0, 0, 0, 0, 0, 0, 881, 20,
+  54, 82, 663, 839, 0, 0, 0, 0, 0, 0, 0, 0, 652, 696, 552, 763,
+  0, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 218, 726, 399, 0, 202,
+  81, 104, 731, 0, 877, 0, 0, 280, 0, 0, 72, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 125, 635, 0, 0, 0, 68, 650, 0, 598, 0, 0,
+  0, 0, 114, 0, 0, 701, 0, 0, 0, 310, 286, 172, 55, 251, 257, 533,
+  0, 0, 45, 0, 0, 0, 778, 799, 179, 613, 0, 0, 903, 0, 0, 0,
+  0, 0, 0, 0, 0, 516, 0, 0, 851, 0, 499, 0, 0, 126, 0, 466,
+  244, 488, 889, 0, 672, 807, 0, 0, 0, 0, 0, 0, 0, 0, 0, 544,
+  0, 0, 0, 0, 0, 312, 0, 0, 0, 0, 0, 419, 0, 612, 517, 0,
+  0, 901, 484, 0, 0, 0, 0, 0, 237, 259, 191, 758, 0, 360, 348, 420,
+  0, 0, 17, 591, 0, 502, 220, 914, 477, 0, 0, 795, 609, 816, 0, 687,
+  0, 578, 409, 113, 0, 0, 115, 177, 364, 180, 66, 545, 0, 84, 0, 0,
+  662, 0, 0, 900, 640, 0, 0, 0, 0, 0, 0, 0, 0, 0, 298, 711,
+  0, 753, 0, 0, 31, 0, 0, 0, 0, 0, 0, 0, 765, 0, 160, 683,
+  0, 0, 0, 0, 560, 0, 998, 571, 853, 0, 38, 117, 147, 393, 0, 0,
+  0, 0, 0, 0, 0, 0, 167, 0, 0, 0, 226, 0, 0, 878, 476, 0,
+  0, 24, 27, 0, 0, 353, 425, 0, 746, 0, 981, 262, 0, 0, 0, 127,
+  154, 0, 384, 0, 102, 0, 0, 849, 0, 0, 0, 0, 721, 0, 0, 0,
+  0, 0, 56, 0, 514, 610, 188, 53, 321, 479, 538, 866, 912, 952, 304, 10,
+  123, 0, 712, 289, 755, 824, 0, 0, 215, 350, 964, 624, 131, 924, 213, 240,
+  0, 0, 822, 301, 14, 739, 846, 0, 0, 841, 991, 0, 819, 0, 0, 0,
+  0, 9, 12, 49, 97, 483, 70, 249, 452, 648, 0, 13, 204, 692, 0, 633,
+  0, 106, 0, 0, 671, 118, 0, 0, 0, 0, 203, 505, 0, 599, 0, 0,
+  0, 0, 0, 89, 230, 414, 0, 0, 234, 327, 412, 151, 372, 192, 57, 330,
+  524, 627, 0, 0, 0, 0, 434, 565, 781, 0, 0, 938, 0, 802, 491, 0,
+  0, 0, 686, 519, 0, 0, 737, 0, 0, 0, 0, 0, 134, 0, 0, 995,
+  0, 0, 406, 433, 272, 174, 264, 58, 493, 960, 882, 532, 0, 0, 0, 714,
+  405, 525, 0, 558, 124, 351, 103, 0, 937, 831, 285, 919, 403, 256, 843, 74,
+  932, 0, 0, 0, 417, 0, 673, 0, 0, 0, 0, 0, 292, 570, 682, 52,
+  294, 713, 526, 0, 362, 443, 0, 389, 0, 0, 678, 0, 461, 0, 0, 64,
+  743, 193, 887, 780, 0, 0, 0, 0, 700, 290, 668, 0, 0, 0, 0, 0,
+  725, 0, 803, 833, 641, 0, 200, 830, 0, 0, 757, 0, 0, 0, 33, 197,
+  0, 0, 948, 0, 211, 0, 0, 0, 984, 46, 0, 0, 0, 529, 0, 820,
+  576, 0, 0, 554, 120, 0, 0, 0, 195, 355, 0, 0, 0, 0, 982, 522,
+  0, 219, 344, 0, 962, 239, 0, 0, 0, 0, 0, 684, 808, 0, 0, 0,
+  0, 790, 0, 870, 0, 0, 972, 611, 0, 0, 0, 738, 0, 0, 0, 0,
+  0, 233, 0, 0, 267, 75, 0, 772, 0, 0, 187, 444, 0, 0, 0, 0,
+  961, 119, 0, 295, 0, 0, 0, 0, 39, 201, 5, 401, 927, 670, 702, 214,
+  848, 0, 0, 0, 0, 0, 19, 148, 0, 581, 313, 0, 302, 441, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 579, 0, 0, 0, 886, 0, 0, 0,
+  42, 0, 0, 30, 0, 676, 749, 769, 797, 0, 0, 0, 0, 0, 50, 0,
+  0, 0, 0, 0, 0, 698, 427, 834, 703, 945, 0, 0, 0, 891, 0, 0,
+  0, 0, 0, 0, 386, 969, 0, 0, 0, 0, 0, 0, 0, 0, 0, 169,
+  291, 716, 814, 978, 0, 199, 0, 0, 0, 957, 0, 0, 0, 0, 0, 997,
+  0, 977, 0, 0, 0, 0, 86, 375, 990, 26, 0, 460, 0, 604, 0, 0,
+  65, 0, 897, 0, 275, 685, 955, 0, 0, 690, 0, 0, 242, 235, 0, 0,
+  0, 0, 354, 0, 704, 0, 0, 487, 792, 842, 245, 639, 902, 993, 0, 0,
+  0, 0, 0, 0, 432, 583, 0, 761, 921, 0, 473, 498, 287, 0, 0, 0,
+  825, 0, 827, 915, 0, 217, 223, 481, 747, 0, 0, 224, 637, 0, 153, 0,
+  0, 0, 140, 0, 0, 0, 0, 0, 697, 0, 0, 0, 0, 954, 503, 909,
+  0, 381, 0, 0, 0, 601, 288, 0, 0, 0, 0, 850, 657, 305, 838, 861,
+  906, 979, 0, 0, 707, 0, 366, 455, 0, 0, 693, 0, 338, 642, 0, 0,
+  0, 0, 149, 0, 0, 293, 339, 345, 588, 139, 894, 0, 91, 0, 0, 496,
+  541, 837, 0, 975, 501, 840, 0, 0, 0, 0, 380, 229, 614, 0, 0, 0,
+  0, 0, 0, 0, 0, 32, 521, 0, 0, 553, 276, 0, 0, 0, 0, 855,
+  410, 729, 535, 832, 0, 0, 0, 0, 0, 77, 0, 83, 806, 0, 357, 93,
+  21, 656, 895, 970, 920, 748, 785, 0, 0, 0, 0, 0, 0, 0, 132, 464,
+  161, 655, 812, 0, 303, 628, 0, 0, 508, 549, 730, 793, 727, 0, 138, 910,
+  0, 0, 0, 337, 463, 0, 470, 258, 782, 925, 756, 958, 0, 520, 0, 96,
+  0, 582, 0, 0, 0, 709, 860, 0, 0, 0, 724, 0, 880, 0, 315, 809,
+  654, 862, 0, 0, 0, 4, 0, 0, 528, 0, 424, 62, 0, 0, 752, 943,
+  469, 0, 0, 210, 0, 277, 296, 561, 595, 0, 0, 929, 436, 0, 0, 0,
+  559, 786, 0, 361, 430, 0, 0, 0, 922, 152, 515, 69, 736, 252, 680, 770,
+  966, 225, 817, 0, 0, 0, 777, 947, 0, 281, 0, 22, 271, 605, 506, 0,
+  0, 0, 0, 369, 0, 0, 462, 531, 888, 0, 0, 874, 0, 324, 706, 0,
+  0, 575, 156, 130, 973, 183, 0, 0, 0, 0, 141, 0, 331, 475, 0, 0,
+  0, 0, 0, 480, 0, 0, 631, 0, 0, 363, 0, 0, 0, 112, 51, 478,
+  0, 625, 0, 371, 317, 158, 0, 0, 623, 0, 735, 332, 0, 0, 0, 944,
+  0, 0, 0, 0, 0, 0, 0, 0, 222, 442, 801, 705, 928, 996, 0, 43,
+  365, 266, 426, 630, 661, 768, 965, 0, 0, 0, 0, 175, 253, 306, 144, 0,
+  0, 0, 0, 0, 775, 0, 0, 0, 445, 512, 759, 967, 490, 573, 774, 885,
+  0, 0, 0, 246, 0, 0, 0, 0, 660, 0, 0, 0, 85, 178, 396, 28,
+  374, 534, 715, 844, 868, 884, 892, 0, 0, 0, 0, 864, 771, 0, 15, 0,
+  105, 182, 282, 341, 567, 810, 773, 0, 0, 695, 651, 0, 818, 0, 0, 0,
+  0, 2, 99, 7, 311, 472, 580, 629, 0, 994, 136, 608, 0, 667, 0, 94,
+  717, 198, 268, 951, 165, 0, 80, 87, 278, 297, 67, 181, 659, 804, 0, 71,
+  41, 447, 0, 392, 29, 0, 0, 0, 0, 0, 0, 883, 0, 0, 88, 813,
+  0, 0, 376, 847, 0, 0, 0, 468, 0, 0, 0, 0, 916, 0, 0, 333,
+  835, 458, 163, 0, 0, 90, 190, 0, 0, 0, 0, 0, 821, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 228, 352, 0, 391, 457, 0, 513, 638, 164, 636,
+  829, 121, 791, 159, 796, 857, 789, 320, 497, 873, 766, 0, 0, 0, 0, 0,
+  859, 644, 0, 0, 0, 6, 754, 999, 0, 0, 0, 0, 0, 0, 742, 0,
+  1, 0, 0, 939, 0, 0, 359, 0, 0, 0, 762, 0, 0, 923, 959, 0,
+  0, 0, 0, 0, 173, 185, 318, 168, 679, 689, 815, 865, 0, 0, 0, 0,
+  0, 0, 0, 0, 34, 0, 0, 653, 279, 931, 0, 146, 0, 800, 79, 100,
+  0, 0, 241, 0, 0, 495, 400, 404, 0, 0, 111, 0, 907, 334, 0, 98,
+  143, 562, 647, 674, 326, 0, 0, 0, 783, 0, 194, 349, 221, 675, 0, 828,
+  0, 0, 0, 0, 0, 150, 0, 0, 0, 110, 543, 586, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 597, 186, 0, 0, 0, 0, 0, 0, 0,
+  0, 550, 206, 0, 0, 0, 658, 155, 0, 0, 930, 0, 0, 811, 0, 0,
+  632, 385, 347, 394, 437, 872, 248, 985, 0, 0, 23, 0, 0, 879, 0, 0,
+  0, 718, 933, 0, 0, 48, 905, 474, 0, 0, 260, 107, 0, 0, 0, 941,
+  0, 456, 0, 0, 722, 740, 0, 0, 626, 547, 0, 0, 0, 0, 0, 0,
+  486, 0, 0, 0, 0, 435, 536, 60, 968, 388, 0, 0, 620, 129, 216, 587,
+  323, 35, 133, 11, 162, 423, 504, 61, 917, 340, 0, 0, 618, 677, 0, 0,
+  309, 439, 325, 137, 322, 270, 494, 826, 0, 0, 0, 0, 0, 986, 548, 745,
+  0, 876, 307, 448, 92, 858, 688, 987, 0, 254, 0, 300, 205, 0, 0, 116,
+  794, 585, 767, 734, 527, 0, 0, 0, 0, 555, 710, 976, 0, 0, 0, 36,
+  342, 0, 0, 431, 0, 971, 953, 0, 171, 243, 207, 511, 0, 0, 0, 0,
+};
+
+const char *WA_FREQ_168_TOKENS[] = {
+  "da",
+  "na",
+  "nache",
+  "ca",
+  "ra",
+  "o",
+  "huo",
+  "so",
+  "qataq",
+  "a",
+  "ena",
+  "aca",
+  "l",
+  "aiem",
+  "eca",
+  "aýem",
+  "ana",
+  "cha",
+  "aye",
+  "ishet",
+  "que",
+  "aso",
+  "sa",
+  "cam",
+  "nam",
+  "yi",
+  "naxa",
+  "qaica",
+  "ima",
+  "qom",
+  "ne",
+  "nagui",
+  "enauac",
+  "maiche",
+  "onaxaic",
+  "qaq",
+  "n",
+  "no",
+  "ot",
+  "onatac",
+  "ýataqta",
+  "huoo",
+  "alhua",
+  "enaxat",
+  "t",
+  "hua",
+  "en",
+  "ye",
+  "eso",
+  "se",
+  "aja",
+  "qalaxaye",
+  "ñi",
+  "i",
+  "iataqta",
+  "can",
+  "ague",
+  "lo",
+  "ayem",
+  "eda",
+  "saishet",
+  "mashe",
+  "lla",
+  "lma",
+  "ýi",
+  "naua",
+  "dam",
+  "ñaq",
+  "dalaxaic",
+  "asa",
+  "qalota",
+  "cataq",
+  "qompi",
+  "imaa",
+  "chaco",
+  "qomi",
+  "e",
+  "at",
+  "aqtaqa",
+  "de",
+  "nataq",
+  "vi",
+  "añi",
+  "shiýaxauapi",
+  "saq",
+  "io",
+  "era",
+  "la",
+  "cheta",
+  "soua",
+  "ñaqpiolec",
+  "som",
+  "onataxanaxac",
+  "lta",
+  "llalaqpi",
+  "huetaigui",
+  "nallec",
+  "yim",
+  "argentina",
+  "qa",
+  "le",
+  "am",
+  "hueta",
+  "ogue",
+  "pi",
+  "shigaxauapi",
+  "doqshe",
+  "on",
+  "ña",
+  "eye",
+  "huotaique",
+  "pa",
+  "shiýaxaua",
+  "taq",
+  "maye",
+  "yiqopita",
+  "lenaxat",
+  "etaxat",
+  "shigaxaua",
+  "natannaxanaq",
+  "iotta",
+  "ilo",
+  "ram",
+  "saua",
+  "qauem",
+  "qai",
+  "camaye",
+  "ýotta",
+  "nataqa",
+  "te",
+  "ralaxaic",
+  "paxaguenaxaqui",
+  "auchiguiñi",
+  "ashaxac",
+  "ivita",
+  "onaxa",
+  "itauan",
+  "saxat",
+  "chaaye",
+  "iye",
+  "nanguishe",
+  "aq",
+  "anom",
+  "ýaýaten",
+  "iyi",
+  "axat",
+  "lataxac",
+  "buenos",
+  "aires",
+  "nvi",
+  "amaqten",
+  "qaca",
+  "hualoq",
+  "ñauochaxaua",
+  "alo",
+  "alom",
+  "ndotec",
+  "huetalec",
+  "olec",
+  "aiom",
+  "iuen",
+  "saiaten",
+  "yo",
+  "caica",
+  "qadma",
+  "lalamaqte",
+  "lasheue",
+  "onaxaiq",
+  "coma",
+  "teque",
+  "jec",
+  "ime",
+  "lata",
+  "ñauane",
+  "q",
+  "alpi",
+  "ma",
+  "sauotaique",
+  "aqtac",
+  "ottac",
+  "ñoqopita",
+  "lvique",
+  "axaixaatega",
+  "alua",
+  "lmalate",
+  "lai",
+  "enaua",
+  "ñeqopita",
+  "chalcata",
+  "oita",
+  "soota",
+  "lqalaic",
+  "nataqaen",
+  "ico",
+  "ac",
+  "ýaguec",
+  "do",
+  "lia",
+  "re",
+  "saýaten",
+  "ño",
+  "araic",
+  "au",
+  "lapat",
+  "qo",
+  "nasotaxac",
+  "lasotaxac",
+  "oonolec",
+  "yataqta",
+  "selota",
+  "nche",
+  "naa",
+  "ietaqta",
+  "shiguiac",
+  "sau",
+  "notaxaqui",
+  "huetauga",
+  "pasa",
+  "nañiguishe",
+  "aguet",
+  "naponaxac",
+  "ilomaxaqui",
+  "nataxala",
+  "roqshe",
+  "oc",
+  "qoianem",
+  "cocho",
+  "natannaxanaxaqui",
+  "qaiuen",
+  "sootaña",
+  "yem",
+  "lvigaxanaxac",
+  "lmenaxanaxaqui",
+  "lapo",
+  "paxaguenaxaquipi",
+  "co",
+  "ñiqopita",
+  "calaxaye",
+  "ñaqpioleq",
+  "ec",
+  "ilotague",
+  "ñaquitaxac",
+  "lamaic",
+  "ýit",
+  "ona",
+  "ýoqta",
+  "huaña",
+  "souaqta",
+  "ilotaique",
+  "choche",
+  "nvique",
+  "tau",
+  "qad",
+  "choxoraqpi",
+  "sauatton",
+  "oi",
+  "ñimeten",
+  "chaye",
+  "taýa",
+  "ialaqpi",
+  "auot",
+  "anac",
+  "mayi",
+  "axa",
+  "ñe",
+  "noýic",
+  "nacheso",
+  "qatac",
+  "axaiquipi",
+  "shiguiacpi",
+  "nlo",
+  "aloq",
+  "lalamaxat",
+  "atrec",
+  "qata",
+  "lomaxaqui",
+  "doqshec",
+  "añaxaic",
+  "napaxaguen",
+  "eeta",
+  "itaxaiaxaqui",
+  "semeteetac",
+  "shenapega",
+  "diez",
+  "shiaxauapi",
+  "sasaiaten",
+  "qan",
+  "aqtaxanaxac",
+  "qaio",
+  "iaguec",
+  "che",
+  "qailalec",
+  "lapel",
+  "qadhuo",
+  "pioq",
+  "taxaqui",
+  "oqchigui",
+  "dalaxaicpi",
+  "nachi",
+  "onataxan",
+  "dalaxaiq",
+  "taua",
+  "selo",
+  "laponaxac",
+  "pe",
+  "iatee",
+  "ñoqpita",
+  "piguem",
+  "nahua",
+  "nanaxanqa",
+  "adaic",
+  "sasaýaten",
+  "choxodaqpi",
+  "oguiaxac",
+  "aña",
+  "oq",
+  "nogotolec",
+  "auñi",
+  "naiaanecpi",
+  "eñe",
+  "mache",
+  "esoua",
+  "samachiguiñi",
+  "al",
+  "auaqpi",
+  "lcat",
+  "nata",
+  "lalolaxa",
+  "ýale",
+  "ro",
+  "enahuaq",
+  "messi",
+  "late",
+  "ntap",
+  "ai",
+  "ñauochaxauapi",
+  "lauoxo",
+  "lede",
+  "senat",
+  "yioqchigui",
+  "tahiaa",
+  "taia",
+  "anam",
+  "ýaýamaqchiguiñi",
+  "eta",
+  "qam",
+  "ýipi",
+  "laiaanec",
+  "lapaxaguenataxanaxac",
+  "yeqopita",
+  "qaiamaxalec",
+  "nma",
+  "aÿem",
+  "qarma",
+  "lalegue",
+  "sachec",
+  "ñaloqten",
+  "lamaxa",
+  "ashe",
+  "lquet",
+  "sanem",
+  "anoq",
+  "sotaa",
+  "inteligencia",
+  "artificial",
+  "iuennataxa",
+  "lahuo",
+  "ioqta",
+  "menaxanaxaqui",
+  "sano",
+  "meguesoxoche",
+  "maradona",
+  "ita",
+  "ioquiaxaneqpi",
+  "iottaa",
+  "enam",
+  "lya",
+  "semetetac",
+  "axac",
+  "lchec",
+  "qoýoqta",
+  "napo",
+  "lachoxoyec",
+  "naialec",
+  "sepeta",
+  "laipi",
+  "machiguiñi",
+  "lauo",
+  "otta",
+  "yoqopita",
+  "iahuo",
+  "ýachaxan",
+  "ltaunaxanaxac",
+  "lqochoxo",
+  "negue",
+  "añe",
+  "derqui",
+  "noýicpi",
+  "aviaq",
+  "ýanem",
+  "atec",
+  "naiaanec",
+  "ivira",
+  "naigui",
+  "ollaxa",
+  "saxaiet",
+  "oxodeetac",
+  "taqa",
+  "onaxan",
+  "onecpi",
+  "shiaxaua",
+  "saxanaxa",
+  "taigue",
+  "shiyaxauapi",
+  "naqaen",
+  "lmenec",
+  "asom",
+  "huetaña",
+  "aqtacpi",
+  "napaxaguenataxanaxaqui",
+  "saigue",
+  "imeetac",
+  "calye",
+  "iamaxaso",
+  "sauota",
+  "saatrañi",
+  "sonaqtaña",
+  "olloxochiyi",
+  "nachena",
+  "iot",
+  "naxate",
+  "calota",
+  "ilohogue",
+  "hueto",
+  "lalaxat",
+  "lamaxaigui",
+  "auaxai",
+  "lashaxaq",
+  "qaiachaigui",
+  "ipetaxa",
+  "eetapeguec",
+  "natrauo",
+  "ýaqto",
+  "iapaxaguetac",
+  "nsoxorpi",
+  "qarhuo",
+  "eetec",
+  "omaxa",
+  "nqo",
+  "iachaxan",
+  "ayi",
+  "iate",
+  "lacheugue",
+  "ndoteq",
+  "nalota",
+  "qalaq",
+  "seuen",
+  "chigaqaigui",
+  "naýajnecpi",
+  "cara",
+  "qaialoqta",
+  "ýihuo",
+  "ichoxot",
+  "enapi",
+  "siotauga",
+  "iuejlec",
+  "iaiaten",
+  "paatrec",
+  "sho",
+  "otapecna",
+  "ýalaqpi",
+  "ihuennataxa",
+  "maxaso",
+  "nmenqa",
+  "imetac",
+  "laue",
+  "qaiogoxona",
+  "naniguishe",
+  "onaxanaxac",
+  "noyicpi",
+  "qolloxochiyi",
+  "cataxa",
+  "natannaxaqui",
+  "iape",
+  "ape",
+  "ta",
+  "camachaqca",
+  "sacheta",
+  "napaxaiañi",
+  "sauga",
+  "ñamaqtac",
+  "iogo",
+  "lapagaxaic",
+  "azul",
+  "nogoxot",
+  "nnotaxaqui",
+  "catac",
+  "numeropi",
+  "naquitaxac",
+  "nta",
+  "sallaxanecpi",
+  "choxodaq",
+  "ipaca",
+  "qainat",
+  "nmalate",
+  "shenaqta",
+  "deco",
+  "aluaa",
+  "ñaxat",
+  "shexaua",
+  "ntaunaqte",
+  "sapiaqtalec",
+  "nquigaxac",
+  "naqa",
+  "luennataxa",
+  "iqataxac",
+  "naponaxaq",
+  "qoioqta",
+  "nalleq",
+  "ñivacacion",
+  "nanguishepi",
+  "ileetapigui",
+  "ýiuodhuapi",
+  "lache",
+  "ilalec",
+  "lenteq",
+  "qodom",
+  "huetaleq",
+  "ivitega",
+  "om",
+  "laýi",
+  "talec",
+  "ilota",
+  "ýapaxaguen",
+  "lqataxac",
+  "laýajnec",
+  "ñoxosheguem",
+  "otac",
+  "oxosheguem",
+  "ñaqpiolecpi",
+  "quiyoc",
+  "qomye",
+  "imeten",
+  "hualec",
+  "sañaloqten",
+  "qaimeten",
+  "coleetac",
+  "taqaen",
+  "qaishiiten",
+  "ihuo",
+  "ego",
+  "laleguepi",
+  "toue",
+  "qaiachegoxotaigui",
+  "nsoqolec",
+  "napaxaguenaxac",
+  "ivida",
+  "laloqo",
+  "saiviñi",
+  "uañe",
+  "agoxoic",
+  "dasot",
+  "namayipi",
+  "ralaxaicpi",
+  "deshiinaxana",
+  "yecopita",
+  "iañoqo",
+  "shíýaxauapi",
+  "alaqaic",
+  "patric",
+  "yoqchigue",
+  "yoqta",
+  "ñim",
+  "naýajnec",
+  "laiaxnec",
+  "an",
+  "nvigaxanaxac",
+  "onatacpi",
+  "ñimatec",
+  "oguet",
+  "ihuarpi",
+  "qanallec",
+  "acam",
+  "oxonnatac",
+  "onaxanaxaicpi",
+  "chita",
+  "ate",
+  "qaicaua",
+  "yaguec",
+  "qalaxayi",
+  "latomaxa",
+  "yocopita",
+  "oxoñi",
+  "huaqajñi",
+  "nqaic",
+  "ntaxaiaxaquipi",
+  "lairaxaic",
+  "huataxanaq",
+  "ýaqaýañicpi",
+  "ñicpi",
+  "ntonaqchet",
+  "imaqta",
+  "sacona",
+  "ñitonaxac",
+  "saañi",
+  "televisión",
+  "nmeena",
+  "meteteq",
+  "sheishet",
+  "inshetaque",
+  "ramaxasoxotac",
+  "chetaague",
+  "eco",
+  "nmejnapi",
+  "comi",
+  "ñitounaxac",
+  "huotel",
+  "caioqta",
+  "ñishitaique",
+  "loquiaxac",
+  "noxot",
+  "sauana",
+  "qoioqteua",
+  "ýachetac",
+  "shiguiaxauapi",
+  "queloque",
+  "netaña",
+  "ñamaqtega",
+  "ilotaque",
+  "chec",
+  "plata",
+  "sallaxanec",
+  "laỹi",
+  "qanalhua",
+  "onaxaiqa",
+  "machiguiñe",
+  "ya",
+  "iepi",
+  "nsoxoppi",
+  "iapaxaguen",
+  "aqtaxanem",
+  "noiec",
+  "chiguishe",
+  "qailo",
+  "qolleguesaq",
+  "iañoxoqui",
+  "seque",
+  "qaiauota",
+  "taxa",
+  "qocho",
+  "huaigui",
+  "llic",
+  "nachaso",
+  "axaia",
+  "enauaq",
+  "laqtaca",
+  "caipi",
+  "cos",
+  "lcheta",
+  "rato",
+  "lapa",
+  "iota",
+  "paxaguenaxaic",
+  "saqalota",
+  "huee",
+  "aiaten",
+  "taigui",
+  "et",
+  "enauacna",
+  "sedaxaatac",
+  "cad",
+  "seraxatac",
+  "hu",
+  "uaña",
+  "nena",
+  "nala",
+  "sishenaxana",
+  "repaqtaxalec",
+  "shegaxaua",
+  "choxoraq",
+  "shiyaxaua",
+  "5",
+  "nshiitenaxanaxac",
+  "sohua",
+  "naie",
+  "nahie",
+  "sauattonaq",
+  "ñatamnaqa",
+  "lqo",
+  "c",
+  "yioq",
+  "nqopita",
+  "lmenecpi",
+  "natannaxanaqte",
+  "ýañoqo",
+  "imen",
+  "noyecpi",
+  "naga",
+  "eesa",
+  "napaxaguenaxaqui",
+  "qoyalaqpi",
+  "ivitta",
+  "ionatac",
+  "ỹi",
+  "ñachaalataxac",
+  "naguie",
+  "nmenec",
+  "nacheca",
+  "nmenaxaqui",
+  "yimaye",
+  "lataxala",
+  "ashaxaicpi",
+  "nte",
+  "nuoduapi",
+  "nuoteeta",
+  "iactaqa",
+  "iqaia",
+  "chetague",
+  "onoleq",
+  "yale",
+  "ñimataxaqui",
+  "yetacta",
+  "shiguiaq",
+  "aloo",
+  "lalaqte",
+  "shi",
+  "itaxaýaxaqui",
+  "itaxaixaqui",
+  "siaxana",
+  "qollec",
+  "otaxac",
+  "ñaman",
+  "qaýoqta",
+  "ipoto",
+  "ñiqo",
+  "maxasoxoqui",
+  "doqshepi",
+  "nqa",
+  "ndootek",
+  "ñanaxauga",
+  "ayiem",
+  "caiocta",
+  "chochaq",
+  "taya",
+  "choxoracpi",
+  "name",
+  "nmejna",
+  "opi",
+  "iagueq",
+  "ila",
+  "lhuennataxa",
+  "ýahuo",
+  "damaxasoxootac",
+  "caihiaxanaque",
+  "nmenaxanaxaqui",
+  "lonataq",
+  "malate",
+  "auta",
+  "ýaýamaxaañi",
+  "lcote",
+  "latee",
+  "u",
+  "dalaxaiqpi",
+  "aalac",
+  "qaýachaxan",
+  "nacheda",
+  "lahie",
+  "satapegueua",
+  "saxaañi",
+  "auxa",
+  "ñishetaique",
+  "nquiaxac",
+  "salegaxaguet",
+  "onaxaatac",
+  "natannaxanaxatpi",
+  "ihuoroguapi",
+  "saýa",
+  "anaxat",
+  "qarapiaxalate",
+  "sasaianguet",
+  "pon",
+  "ivictapigui",
+  "nashaxac",
+  "qaiapaxaguen",
+  "chaqueño",
+  "palavecino",
+  "calya",
+  "lotaa",
+  "nqochenaxac",
+  "nolleq",
+  "lañaxataxa",
+  "samaiquingui",
+  "sapetalec",
+  "luenaxanaxa",
+  "shexauapi",
+  "m",
+  "ilotegue",
+  "laquip",
+  "layi",
+  "qac",
+  "ota",
+  "chigoqta",
+  "qailotalec",
+  "laýipi",
+  "yetaqta",
+  "qaiachegoxoto",
+  "nqochoxo",
+  "anacta",
+  "elec",
+  "iuetaique",
+  "nanerhuo",
+  "laiepi",
+  "ñisheguem",
+  "tauga",
+  "iauegueua",
+  "ýate",
+  "qoiañi",
+  "ie",
+  "si",
+  "qaioqta",
+  "chegaqaigui",
+  "huau",
+  "añaxaicpi",
+  "qaiqa",
+  "nenaxa",
+  "napaxaguena",
+  "cata",
+  "chegaqa",
+  "onataxanaxai",
+  "iqueroxonecpi",
+  "toguishec",
+  "ele",
+  "ialamaxat",
+  "lalo",
+  "qapiolec",
+  "nhuoshec",
+  "seuata",
+  "nacham",
+  "lhuoshec",
+  "lataxaqui",
+  "ltaa",
+  "napaxaguetac",
+  "tateua",
+  "ñapaxaguena",
+  "napaxagueetac",
+  "saia",
+  "sahua",
+  "iviteega",
+  "togoshaapec",
+  "daqat",
+  "nmenecpi",
+  "qanma",
+  "menec",
+  "nmatec",
+  "cada",
+  "nachera",
+  "cadaqtaca",
+  "lamgui",
+  "sootaigui",
+  "iaxattac",
+  "qaiaxana",
+  "qaralamaxat",
+  "qadvique",
+  "camaa",
+  "vique",
+  "ecpi",
+  "ýalamaqte",
+  "shegaxauapi",
+  "cinco",
+  "isheteuo",
+  "ogoxona",
+  "qaiahuo",
+  "noyic",
+  "alac",
+  "saigui",
+  "taaraiq",
+  "sotaña",
+  "seiotauga",
+  "ñatamnaxaua",
+  "sedenaqta",
+  "iasateguet",
+  "nayajnec",
+  "lapaxaguenataxanaxaco",
+  "nhuenaxanaxa",
+  "caua",
+  "acamaye",
+  "nmenguet",
+  "ada",
+  "nañiguise",
+  "cohiañe",
+  "qaiatannaxana",
+  "nan",
+  "sela",
+  "lvinaxanaxac",
+  "ajá",
+  "itaa",
+  "huachiguiñi",
+  "lanaxanqa",
+  "moqoit",
+  "iñi",
+  "seishet",
+  "sivita",
+  "ñeshetaique",
+  "enuac",
+  "caihuen",
+  "san",
+  "ñoxonnatac",
+  "iaqome",
+  "ilotalec",
+  "uo",
+  "nauana",
+  "diego",
+  "iuorhuapi",
+  "eetai",
+  "iboroguapi",
+  "aiamagreta",
+  "ntauaata",
+  "laqtaqa",
+  "ýita",
+  "nhuoshaxaqui",
+  "erangui",
+  "ýaqaýa",
+  "ñiqasoxoc",
+  "qoipaq",
+  "oto",
+  "natomchiguiñi",
+  "avit",
+  "ad",
+  "ihua",
+  "naq",
+  "llalec",
+  "ishe",
+  "mayepi",
+  "sayaten",
+  "itaiaxaqui",
+  "tahiaxaqui",
+  "qui",
+  "itchigui",
+  "celular",
+  "ividic",
+  "mañec",
+  "ale",
+  "qaiauot",
+  "senoxonec",
+  "saatañi",
+  "setaqtapoiguilo",
+  "ýaleeguet",
+  "qanmitaique",
+  "she",
+  "guitarra",
+  "sague",
+  "copita",
+  "qoyoqta",
+  "ñapaxaguen",
+  "ýapaxagueetac",
+  "qaioqtegue",
+  "tachigui",
+  "huaa",
+  "anogo",
+  "iapagaq",
+  "altemoi",
+  "tague",
+  "television",
+  "nqui",
+  "iaxat",
+  "sanaxañi",
+  "semen",
+  "ipacañi",
+  "caiyq",
+  "saqalaq",
+  "nataxan",
+  "cainat",
+  "qaiaxanot",
+  "laÿajnec",
+  "ýaýamaxañi",
+  "nachaalataxac",
+  "enaguaq",
+  "uoo",
+  "canoxosheguem",
+  "oxoosheguem",
+  "noieq",
+  "caientaxana",
+  "qaiabota",
+  "maya",
+  "saxañi",
+  "nqatec",
+  "nataxa",
+  "napaxaguenataxanaxac",
+  "camachaqcom",
+  "camachaca",
+  "ilogue",
+  "nalaxat",
+  "iet",
+  "ihuen",
+  "iaxana",
+  "iloxoq",
+  "caioxona",
+  "onataxanaxaiqa",
+  "enaham",
+  "nquia",
+};
+const uint16_t WA_FREQ_168_RANKS[] = {
+  0, 853, 276, 846, 0, 0, 0, 0, 390, 0, 0, 0, 0, 0, 0, 0,
+  157, 0, 116, 0, 0, 0, 0, 657, 756, 0, 558, 671, 0, 0, 0, 18,
+  0, 201, 556, 944, 0, 0, 0, 0, 0, 275, 740, 822, 0, 224, 0, 0,
+  59, 517, 40, 896, 507, 920, 0, 673, 0, 0, 0, 913, 0, 0, 560, 665,
+  0, 0, 0, 0, 0, 0, 0, 0, 218, 191, 323, 488, 0, 915, 843, 66,
+  144, 0, 0, 474, 623, 0, 949, 0, 0, 811, 362, 869, 0, 0, 277, 942,
+  301, 791, 0, 619, 0, 0, 0, 0, 0, 399, 739, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 635, 736, 989, 251, 0, 300, 497, 0, 0, 0,
+  0, 0, 0, 521, 0, 0, 0, 0, 0, 0, 48, 0, 0, 0, 206, 0,
+  0, 0, 260, 0, 196, 0, 111, 891, 436, 207, 875, 776, 738, 541, 798, 974,
+  321, 0, 0, 931, 0, 186, 0, 229, 0, 0, 783, 149, 423, 7, 198, 522,
+  857, 879, 0, 0, 0, 700, 340, 580, 0, 0, 649, 0, 0, 651, 0, 667,
+  0, 698, 0, 0, 0, 0, 0, 0, 0, 0, 231, 0, 400, 0, 337, 0,
+  0, 20, 368, 998, 0, 0, 0, 235, 0, 458, 0, 0, 0, 180, 242, 0,
+  391, 787, 945, 0, 205, 329, 496, 213, 607, 0, 0, 84, 0, 0, 104, 156,
+  823, 0, 0, 49, 448, 0, 0, 0, 0, 997, 81, 706, 821, 0, 0, 0,
+  0, 130, 0, 0, 950, 0, 0, 126, 0, 0, 468, 0, 0, 0, 136, 501,
+  638, 297, 291, 333, 729, 105, 212, 479, 370, 760, 810, 781, 847, 0, 754, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 342, 0, 0, 0, 0, 0, 52, 0,
+  544, 386, 36, 538, 663, 861, 284, 873, 0, 240, 0, 0, 0, 0, 0, 259,
+  0, 0, 0, 0, 0, 0, 0, 751, 0, 0, 0, 504, 0, 178, 0, 827,
+  0, 0, 0, 602, 0, 137, 89, 0, 0, 469, 0, 0, 0, 806, 0, 0,
+  0, 0, 0, 557, 0, 0, 642, 0, 633, 831, 0, 0, 270, 0, 0, 0,
+  0, 162, 0, 0, 536, 42, 0, 401, 0, 0, 0, 0, 588, 995, 0, 0,
+  0, 677, 0, 0, 0, 999, 87, 0, 0, 420, 691, 295, 0, 320, 155, 0,
+  0, 169, 836, 281, 0, 0, 0, 0, 0, 0, 0, 0, 780, 0, 0, 0,
+  549, 322, 578, 795, 854, 0, 0, 411, 583, 0, 0, 0, 0, 0, 394, 0,
+  0, 0, 0, 10, 0, 114, 978, 981, 789, 0, 0, 360, 0, 955, 60, 584,
+  0, 385, 0, 0, 951, 0, 0, 0, 670, 0, 0, 0, 0, 0, 0, 0,
+  0, 524, 0, 0, 970, 0, 0, 0, 0, 0, 247, 495, 0, 0, 0, 164,
+  219, 785, 0, 168, 0, 461, 620, 0, 579, 0, 0, 0, 0, 680, 676, 0,
+  529, 0, 0, 0, 0, 90, 112, 128, 0, 56, 0, 727, 61, 245, 0, 0,
+  0, 0, 0, 982, 0, 0, 816, 0, 272, 0, 910, 282, 0, 0, 317, 415,
+  0, 273, 0, 0, 115, 0, 518, 0, 44, 534, 0, 0, 0, 345, 0, 0,
+  119, 267, 0, 0, 0, 0, 0, 492, 244, 775, 0, 0, 678, 0, 0, 883,
+  0, 426, 0, 0, 0, 0, 0, 0, 467, 0, 0, 686, 0, 0, 225, 0,
+  170, 216, 0, 336, 0, 0, 0, 0, 921, 0, 0, 880, 0, 0, 0, 37,
+  0, 0, 0, 0, 0, 0, 0, 882, 898, 0, 0, 0, 0, 0, 0, 0,
+  0, 715, 0, 217, 312, 905, 0, 528, 192, 328, 772, 799, 745, 860, 0, 0,
+  0, 894, 0, 0, 444, 0, 472, 734, 0, 121, 512, 782, 203, 68, 131, 258,
+  91, 655, 922, 948, 237, 0, 0, 96, 0, 0, 0, 601, 794, 0, 0, 185,
+  343, 0, 941, 344, 167, 525, 585, 174, 809, 897, 918, 0, 0, 0, 233, 0,
+  125, 403, 0, 0, 2, 193, 482, 866, 0, 331, 3, 412, 711, 753, 820, 0,
+  0, 350, 478, 0, 0, 377, 0, 0, 719, 43, 877, 0, 491, 604, 895, 0,
+  261, 462, 0, 692, 0, 814, 0, 0, 388, 0, 0, 0, 694, 0, 0, 57,
+  456, 802, 535, 0, 9, 0, 188, 520, 766, 835, 0, 316, 0, 0, 0, 961,
+  475, 353, 0, 0, 253, 958, 0, 0, 0, 587, 0, 0, 0, 32, 387, 0,
+  0, 0, 0, 0, 0, 422, 0, 621, 865, 135, 286, 992, 215, 0, 0, 5,
+  199, 0, 0, 0, 477, 566, 689, 438, 55, 533, 709, 0, 0, 372, 943, 0,
+  0, 0, 341, 0, 326, 440, 0, 0, 0, 0, 932, 274, 490, 0, 0, 0,
+  0, 6, 0, 0, 117, 718, 514, 0, 0, 0, 0, 0, 0, 0, 0, 361,
+  606, 53, 58, 697, 278, 712, 299, 0, 0, 0, 0, 0, 380, 0, 0, 0,
+  0, 190, 912, 0, 0, 0, 0, 0, 72, 0, 746, 862, 82, 603, 631, 713,
+  0, 979, 487, 0, 0, 555, 226, 575, 1000, 0, 773, 0, 0, 0, 62, 92,
+  0, 0, 466, 0, 459, 0, 392, 0, 409, 41, 0, 239, 51, 16, 54, 429,
+  0, 374, 0, 0, 263, 842, 255, 0, 0, 0, 0, 0, 0, 0, 359, 0,
+  668, 658, 750, 768, 404, 611, 421, 0, 0, 0, 0, 696, 902, 0, 936, 406,
+  0, 0, 0, 0, 576, 622, 723, 0, 0, 0, 418, 935, 767, 0, 0, 0,
+  0, 0, 227, 0, 801, 364, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 327, 870, 0, 0, 0, 439, 416, 0, 592, 926, 639, 928, 777, 0, 561,
+  616, 35, 194, 407, 332, 485, 570, 828, 208, 849, 792, 0, 0, 985, 0, 0,
+  152, 334, 356, 67, 728, 381, 833, 645, 0, 0, 0, 850, 0, 0, 0, 435,
+  0, 0, 486, 0, 881, 0, 0, 660, 0, 0, 288, 956, 0, 0, 0, 959,
+  0, 397, 0, 0, 0, 0, 120, 0, 0, 0, 417, 598, 742, 264, 0, 0,
+  656, 0, 615, 0, 0, 0, 0, 0, 0, 0, 523, 0, 433, 0, 0, 0,
+  0, 303, 307, 0, 916, 0, 0, 0, 0, 65, 0, 0, 939, 878, 0, 450,
+  494, 971, 45, 909, 0, 0, 0, 29, 0, 0, 0, 609, 0, 672, 630, 0,
+  701, 0, 271, 0, 0, 0, 31, 249, 784, 0, 0, 248, 0, 0, 0, 27,
+  654, 0, 289, 0, 703, 987, 103, 147, 0, 937, 0, 0, 0, 0, 12, 0,
+  0, 0, 17, 872, 0, 0, 0, 354, 610, 617, 807, 0, 0, 0, 855, 977,
+  257, 653, 693, 0, 202, 710, 733, 819, 887, 0, 839, 0, 0, 0, 0, 0,
+  0, 0, 0, 829, 590, 0, 0, 0, 481, 516, 826, 0, 582, 279, 0, 0,
+  0, 0, 980, 0, 0, 0, 0, 0, 0, 0, 195, 97, 972, 0, 0, 446,
+  0, 0, 0, 0, 0, 0, 552, 0, 889, 405, 550, 80, 530, 983, 173, 0,
+  539, 0, 0, 69, 78, 189, 559, 293, 563, 886, 996, 8, 568, 0, 0, 95,
+  741, 14, 0, 0, 166, 659, 914, 0, 840, 0, 725, 901, 509, 234, 542, 269,
+  447, 0, 0, 0, 917, 160, 688, 30, 238, 146, 306, 848, 428, 867, 628, 938,
+  965, 845, 907, 0, 0, 0, 373, 0, 0, 0, 311, 503, 0, 0, 413, 704,
+  589, 720, 0, 0, 0, 0, 0, 0, 779, 473, 499, 838, 0, 0, 106, 0,
+  70, 0, 940, 0, 161, 0, 0, 0, 430, 743, 0, 0, 177, 0, 0, 25,
+  0, 63, 210, 797, 0, 0, 548, 0, 182, 0, 0, 0, 0, 593, 318, 0,
+  824, 83, 0, 0, 0, 236, 465, 0, 830, 0, 650, 369, 145, 241, 569, 988,
+  644, 183, 0, 0, 0, 0, 109, 443, 546, 366, 973, 532, 553, 884, 515, 624,
+  702, 730, 0, 0, 0, 246, 643, 181, 176, 441, 632, 837, 442, 764, 0, 0,
+  986, 0, 0, 393, 0, 571, 285, 551, 581, 669, 379, 71, 626, 641, 625, 708,
+  23, 172, 347, 924, 437, 0, 0, 0, 0, 0, 0, 133, 0, 431, 113, 0,
+  26, 0, 0, 0, 232, 771, 0, 0, 502, 976, 408, 903, 0, 308, 0, 221,
+  0, 0, 0, 0, 0, 0, 0, 993, 0, 0, 0, 899, 0, 396, 0, 0,
+  0, 493, 595, 352, 402, 324, 0, 355, 815, 0, 0, 74, 171, 0, 737, 0,
+  314, 252, 351, 0, 0, 0, 721, 0, 0, 0, 0, 0, 0, 254, 0, 0,
+  480, 0, 139, 796, 0, 0, 904, 220, 34, 371, 0, 0, 919, 758, 471, 4,
+  762, 885, 124, 200, 599, 640, 911, 0, 0, 0, 0, 0, 0, 0, 675, 0,
+  572, 0, 0, 376, 0, 0, 526, 968, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 79, 0, 140, 0, 0, 0, 0, 804, 0, 0, 0, 0, 0, 0, 929,
+  0, 0, 455, 682, 805, 975, 0, 0, 138, 0, 0, 383, 505, 705, 158, 339,
+  793, 22, 759, 774, 851, 0, 0, 0, 457, 129, 398, 953, 0, 0, 0, 0,
+  0, 586, 0, 0, 0, 0, 0, 0, 187, 0, 841, 283, 0, 0, 888, 952,
+  927, 0, 0, 597, 0, 0, 0, 0, 0, 0, 0, 256, 652, 0, 296, 153,
+  118, 0, 0, 594, 963, 0, 0, 449, 0, 0, 0, 24, 0, 0, 0, 527,
+  0, 0, 0, 0, 262, 634, 731, 0, 0, 893, 0, 100, 298, 852, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 464, 0, 0, 0, 463, 513, 856, 0,
+  0, 0, 614, 489, 817, 825, 266, 290, 591, 0, 765, 0, 0, 0, 50, 744,
+  0, 0, 722, 0, 859, 0, 864, 325, 0, 330, 410, 0, 348, 0, 98, 365,
+  908, 101, 0, 77, 0, 664, 0, 716, 0, 0, 0, 964, 0, 0, 0, 165,
+  957, 0, 574, 0, 0, 954, 46, 0, 0, 0, 159, 0, 0, 543, 0, 0,
+  923, 679, 0, 102, 357, 858, 0, 445, 500, 127, 250, 577, 384, 0, 0, 0,
+  0, 0, 732, 0, 0, 0, 204, 0, 636, 863, 674, 0, 11, 19, 0, 0,
+  0, 0, 0, 346, 460, 770, 991, 0, 0, 73, 0, 0, 0, 0, 0, 647,
+  0, 349, 0, 0, 0, 86, 0, 0, 890, 757, 612, 313, 778, 565, 934, 0,
+  0, 142, 946, 596, 99, 0, 0, 0, 0, 0, 141, 228, 0, 0, 761, 573,
+  0, 707, 818, 605, 0, 637, 0, 0, 666, 0, 382, 763, 0, 0, 962, 0,
+  699, 47, 947, 0, 0, 0, 0, 0, 335, 179, 414, 769, 0, 395, 0, 790,
+  0, 0, 0, 925, 0, 646, 0, 107, 222, 834, 0, 0, 0, 0, 0, 0,
+  434, 0, 0, 375, 163, 0, 0, 0, 0, 629, 661, 0, 0, 108, 687, 695,
+  154, 211, 304, 452, 627, 933, 0, 0, 148, 209, 498, 0, 110, 150, 454, 871,
+  76, 338, 717, 451, 892, 0, 0, 0, 0, 0, 175, 969, 0, 554, 990, 484,
+  0, 184, 315, 984, 613, 0, 786, 0, 0, 0, 389, 519, 13, 0, 0, 0,
+  0, 0, 547, 788, 844, 0, 230, 0, 0, 0, 537, 735, 747, 0, 0, 0,
+  75, 367, 470, 0, 0, 600, 724, 900, 531, 0, 0, 0, 123, 85, 223, 803,
+  94, 0, 0, 0, 868, 0, 648, 0, 363, 608, 88, 0, 1, 425, 39, 134,
+  378, 427, 748, 151, 268, 960, 540, 0, 0, 0, 545, 0, 567, 0, 305, 0,
+  0, 690, 93, 0, 214, 310, 684, 930, 122, 0, 132, 0, 0, 0, 0, 0,
+  808, 0, 0, 0, 508, 0, 714, 0, 21, 294, 800, 358, 683, 812, 0, 0,
+  243, 994, 0, 0, 0, 0, 685, 562, 287, 906, 0, 0, 0, 0, 64, 419,
+  424, 432, 511, 832, 0, 0, 0, 0, 319, 813, 0, 0, 0, 0, 0, 476,
+  0, 197, 15, 564, 681, 0, 0, 0, 0, 0, 0, 755, 309, 618, 302, 0,
+  874, 0, 967, 28, 876, 0, 662, 143, 453, 506, 752, 510, 0, 280, 33, 0,
+  0, 0, 0, 0, 966, 0, 0, 265, 292, 726, 0, 0, 749, 0, 38, 483,
+};
+
+const char *WA_FREQ_169_TOKENS[] = {
+  "li",
+  "e",
+  "jan",
+  "mi",
+  "ni",
+  "la",
+  "ona",
+  "lon",
+  "tawa",
+  "pi",
+  "toki",
+  "ala",
+  "sina",
+  "pona",
+  "o",
+  "mute",
+  "tenpo",
+  "kama",
+  "a",
+  "ken",
+  "sona",
+  "taso",
+  "tan",
+  "ma",
+  "wile",
+  "lili",
+  "ale",
+  "pilin",
+  "suli",
+  "ike",
+  "lukin",
+  "pali",
+  "nasin",
+  "ante",
+  "tomo",
+  "ijo",
+  "nimi",
+  "seme",
+  "lawa",
+  "pana",
+  "tu",
+  "kepeken",
+  "wan",
+  "sama",
+  "musi",
+  "jo",
+  "pini",
+  "awen",
+  "weka",
+  "wawa",
+  "kulupu",
+  "lipu",
+  "ilo",
+  "sewi",
+  "nanpa",
+  "telo",
+  "soweli",
+  "sin",
+  "sitelen",
+  "en",
+  "luka",
+  "kin",
+  "suno",
+  "kalama",
+  "kon",
+  "moku",
+  "kasi",
+  "nasa",
+  "pakala",
+  "moli",
+  "poka",
+  "utala",
+  "sike",
+  "anu",
+  "insa",
+  "olin",
+  "open",
+  "mu",
+  "anpa",
+  "mama",
+  "kute",
+  "n",
+  "kiwen",
+  "len",
+  "alasa",
+  "lape",
+  "linja",
+  "seli",
+  "waso",
+  "pimeja",
+  "sijelo",
+  "mani",
+  "meli",
+  "poki",
+  "suwi",
+  "monsuta",
+  "mun",
+  "sinpin",
+  "mije",
+  "lupa",
+  "supa",
+  "ko",
+  "uta",
+  "jaki",
+  "kule",
+  "kala",
+  "palisa",
+  "loje",
+  "akesi",
+  "pipi",
+  "nena",
+  "ali",
+  "esun",
+  "noka",
+  "walo",
+  "selo",
+  "lete",
+  "kili",
+  "oko",
+  "pan",
+  "laso",
+  "jelo",
+  "kijetesantakalu",
+  "monsi",
+  "kipisi",
+  "apeja",
+  "namako",
+  "pu",
+  "unpa",
+  "majuna",
+  "ku",
+  "leko",
+  "lanpan",
+  "pake",
+  "powe",
+  "po",
+  "tonsi",
+  "jasima",
+  "misikeke",
+  "kapesi",
+  "soko",
+  "su",
+  "san",
+  "meso",
+  "epiku",
+  "pata",
+  "tuli",
+  "unu",
+  "peta",
+  "kan",
+  "iki",
+  "kokosila",
+  "pasila",
+  "jalan",
+  "kapa",
+};
+const uint16_t WA_FREQ_169_RANKS[] = {
+  66, 0, 0, 21, 0, 102, 0, 30, 115, 147, 0, 0, 0, 0, 0, 0,
+  99, 116, 0, 153, 0, 145, 0, 0, 0, 0, 0, 0, 0, 0, 81, 107,
+  0, 64, 0, 0, 93, 47, 0, 0, 0, 0, 0, 0, 0, 0, 75, 0,
+  0, 0, 0, 65, 74, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+  85, 0, 0, 0, 0, 0, 108, 0, 0, 0, 0, 0, 11, 0, 0, 82,
+  112, 122, 0, 38, 56, 127, 0, 89, 0, 0, 0, 0, 114, 0, 0, 27,
+  0, 149, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 133, 152, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 105, 0, 78, 0, 0, 0, 0, 0, 101, 130, 0,
+  0, 0, 0, 0, 0, 13, 0, 0, 97, 0, 0, 0, 0, 144, 0, 0,
+  0, 0, 96, 140, 0, 135, 103, 0, 0, 0, 0, 0, 0, 94, 0, 0,
+  36, 0, 98, 0, 0, 46, 50, 0, 59, 52, 0, 0, 9, 88, 134, 91,
+  151, 0, 0, 0, 20, 8, 0, 0, 0, 63, 0, 0, 55, 0, 0, 87,
+  0, 71, 84, 0, 0, 128, 0, 0, 76, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 113, 0, 0, 0, 0, 0, 77, 0, 0,
+  0, 60, 0, 0, 0, 0, 0, 31, 14, 0, 25, 16, 24, 117, 0, 155,
+  0, 139, 141, 0, 0, 0, 0, 0, 54, 123, 0, 0, 0, 83, 0, 0,
+  0, 0, 0, 0, 0, 10, 0, 0, 0, 5, 0, 0, 45, 0, 0, 0,
+  0, 15, 0, 0, 23, 70, 0, 0, 0, 0, 0, 146, 154, 109, 0, 0,
+  0, 129, 0, 142, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 67, 0, 79, 119, 0, 3, 0, 0, 0, 0, 0, 80, 0, 0, 0,
+  61, 0, 0, 0, 0, 0, 86, 131, 132, 0, 0, 138, 0, 42, 41, 125,
+  0, 0, 0, 37, 40, 0, 120, 0, 51, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 12, 0, 6, 49, 0, 0, 0, 0,
+  0, 68, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 48, 0, 0, 0, 39, 0, 17, 53, 90, 0, 43, 0, 137, 0, 0,
+  0, 72, 118, 148, 0, 0, 0, 33, 28, 0, 0, 0, 150, 0, 0, 92,
+  0, 0, 0, 19, 0, 0, 95, 4, 143, 124, 0, 0, 0, 0, 35, 111,
+  0, 0, 0, 0, 0, 0, 0, 58, 0, 136, 0, 0, 26, 44, 18, 0,
+  0, 0, 0, 69, 104, 0, 73, 0, 0, 0, 0, 0, 0, 32, 0, 57,
+  62, 121, 100, 0, 0, 0, 0, 0, 0, 0, 0, 29, 0, 0, 0, 0,
+  0, 22, 126, 0, 0, 0, 0, 110, 0, 0, 0, 34, 7, 106, 0, 0,
+};
+
+const char *WA_FREQ_170_TOKENS[] = {
+  "ama",
+  "chi",
+  "nak",
+  "kin",
+  "chu",
+  "este",
+  "lata",
+  "ni",
+  "xlakata",
+  "xa",
+  "na",
+  "la",
+  "tlan",
+  "ana",
+  "akxni",
+  "y",
+  "akit",
+  "tuku",
+  "o",
+  "wa",
+  "nama",
+  "wanikan",
+  "tu",
+  "pus",
+  "min",
+  "ix",
+  "watiya",
+  "wi",
+  "pero",
+  "para",
+  "niku",
+  "porque",
+  "nitu",
+  "nachuna",
+  "nachu",
+  "nikula",
+  "ta",
+  "klakgati",
+  "tiku",
+  "an",
+  "pala",
+  "ne",
+  "snun",
+  "nema",
+  "lan",
+  "kit",
+  "pulataman",
+  "pues",
+  "chali",
+  "u",
+  "amá",
+  "chuna",
+  "ki",
+  "akin",
+  "kama",
+  "laktsu",
+  "xla",
+  "wakg",
+  "uyu",
+  "e",
+  "laktsukaman",
+  "pat",
+  "ju",
+  "ti",
+  "xak",
+  "wix",
+  "kiwi",
+  "ma",
+  "como",
+  "chuchut",
+  "namá",
+  "lama",
+  "katuwa",
+  "ka",
+  "nima",
+  "lhuwa",
+  "lipaxaw",
+  "aktsu",
+  "kan",
+  "mas",
+  "tipakgatsi",
+  "yan",
+  "wana",
+  "kinpulataman",
+  "kaman",
+  "pos",
+  "tlawakan",
+  "lak",
+  "taskujut",
+  "putlaw",
+  "tasi",
+  "chima",
+  "chiki",
+  "ja",
+  "wanikán",
+  "ya",
+  "tachiwin",
+  "watiyá",
+  "a",
+  "puro",
+  "mi",
+  "por",
+  "kilhtamaku",
+  "kawaniyan",
+  "tijia",
+  "tsina",
+  "tawa",
+  "nitlan",
+  "aná",
+  "wama",
+  "wali",
+  "tsuku",
+  "kuxi",
+  "pinpat",
+  "pukgalhtawakga",
+  "hasta",
+  "nikulá",
+  "wekg",
+  "stapu",
+  "skitit",
+  "con",
+  "xli",
+  "eso",
+  "kgalhi",
+  "chan",
+  "xlakan",
+  "pulh",
+  "kachikin",
+  "witi",
+  "xakata",
+  "wata",
+  "kata",
+  "makgan",
+  "pin",
+  "anan",
+  "lhakgat",
+  "makgasa",
+  "de",
+  "achu",
+  "tuwan",
+  "yaj",
+  "xtilan",
+  "kakxila",
+  "skuela",
+  "ay",
+  "lakgkgolon",
+  "nakan",
+  "siempre",
+  "li",
+  "kamaj",
+  "lanka",
+  "luwa",
+  "juu",
+  "lakchixkuwin",
+  "katukuxtu",
+  "pakglhcha",
+  "tlaway",
+  "totonaco",
+  "wili",
+  "likgaman",
+  "kawaniyán",
+  "kawanikan",
+  "tatat",
+  "kakilhtamaku",
+  "talamana",
+  "paxni",
+  "hora",
+  "aya",
+  "tlawa",
+  "jae",
+  "lakata",
+  "chatum",
+  "laklanka",
+  "skuja",
+  "kawani",
+  "bueno",
+  "kamanan",
+  "snapapa",
+  "axux",
+  "astan",
+  "nawan",
+  "wan",
+  "pi",
+  "paxkua",
+  "tachanan",
+  "talakgati",
+  "akxila",
+  "laktsumajan",
+  "tsu",
+  "taskuja",
+  "que",
+  "nila",
+  "xanat",
+  "xni",
+  "takgaman",
+  "chalí",
+  "cha",
+  "wax",
+  "porke",
+  "wachi",
+  "katsi",
+  "papa",
+  "tantli",
+  "tlawaya",
+  "luego",
+  "lakg",
+  "luwan",
+  "hacha",
+  "akgtun",
+  "mantika",
+  "un",
+  "aman",
+  "puxkga",
+  "xalak",
+  "pa",
+  "xlá",
+  "nik",
+  "makgat",
+  "tunu",
+  "wanchi",
+  "ktlaway",
+  "tumin",
+  "chow",
+  "kgalhwat",
+  "takgaxmati",
+  "chatunu",
+  "tipalhuwa",
+  "ktamaway",
+  "chaw",
+  "nachuná",
+  "tawilana",
+  "pusikulan",
+  "tiyat",
+  "katsiya",
+  "tanu",
+  "takgamanan",
+  "entonces",
+  "lajkgolon",
+  "kgaxmata",
+  "makgalhtawakgena",
+  "chuná",
+  "tsiyuna",
+  "kintachiwinkan",
+  "xwanit",
+  "makgalhtawakgenanin",
+  "wilakgolh",
+  "wine",
+  "cristianos",
+  "lixkajnit",
+  "lakgati",
+  "palhka",
+  "katunu",
+  "ktamawá",
+  "xlakgan",
+  "lhkaknan",
+  "cristiano",
+  "wilapa",
+  "sikulan",
+  "klakgatilh",
+  "latamat",
+  "lakgolon",
+  "takatsi",
+  "tamin",
+  "luxu",
+  "wati",
+  "putsakan",
+  "akgtum",
+  "talhtsi",
+  "walinikan",
+  "kgawit",
+  "puru",
+  "kgama",
+  "tatantli",
+  "motosierra",
+  "xala",
+  "tawan",
+  "tuxama",
+  "jkatsi",
+  "nikamaxananti",
+  "celular",
+  "mat",
+  "kuay",
+  "lakchajan",
+  "kinpulatamankan",
+  "tutunakú",
+  "pustan",
+  "talin",
+  "xawa",
+  "tlawan",
+  "más",
+  "alakatunu",
+  "kuali",
+  "amaka",
+  "matluk",
+  "tsukulh",
+  "lakchatin",
+  "pinila",
+  "ankan",
+  "sen",
+  "natlawaya",
+  "pula",
+  "chatun",
+  "kilhtamakú",
+  "itat",
+  "tayana",
+  "nipxi",
+  "tawani",
+  "nina",
+  "nin",
+  "chichi",
+  "taan",
+  "kuchina",
+  "tachiwinan",
+  "katlawa",
+  "je",
+  "kinchik",
+  "liway",
+  "papantla",
+  "sino",
+  "nawaliniya",
+  "xta",
+  "kawaní",
+  "lakgkgawasan",
+  "tapuwan",
+  "lin",
+  "xwati",
+  "sakgsi",
+  "tlakg",
+  "wankan",
+  "tsukswit",
+  "dios",
+  "tlawakán",
+  "hay",
+  "yantu",
+  "tachan",
+  "makni",
+  "tsumat",
+  "xanatikun",
+  "kamasinikan",
+  "tlawapat",
+  "mapakgsina",
+  "kgan",
+  "tastaka",
+  "kintse",
+  "tse",
+  "tamakgnin",
+  "kimakni",
+  "kgalhtuchokgo",
+  "natawila",
+  "kiwin",
+  "manta",
+  "chankat",
+  "wija",
+  "akxi",
+  "kintaskujut",
+  "niwatiya",
+  "primaria",
+  "xtawan",
+  "latapuli",
+  "chik",
+  "kuchu",
+  "lamanaw",
+  "akxní",
+  "takam",
+  "tawali",
+  "xpakgen",
+  "kualini",
+  "tatlawa",
+  "molino",
+  "likuchun",
+  "chixku",
+  "tantlin",
+  "tawila",
+  "tamaklakaskin",
+  "tlawayaw",
+  "kinana",
+  "talhakgan",
+  "max",
+  "compañeros",
+  "axni",
+  "tawá",
+  "chichini",
+  "kwi",
+  "katsinilh",
+  "akgatunu",
+  "nawi",
+  "lakgasut",
+  "muksun",
+  "latiya",
+  "litlawakan",
+  "lilakaputsa",
+  "ktanulh",
+  "kamani",
+  "kintiku",
+  "lhkaka",
+  "tatatla",
+  "kon",
+  "takglhuwit",
+  "san",
+  "kilitlakgni",
+  "kistankanin",
+  "walikan",
+  "niti",
+  "nix",
+  "ktijia",
+  "ku",
+  "kpaxa",
+  "jaxa",
+  "asta",
+  "chiwinan",
+  "litutunakú",
+  "nawanaw",
+  "nichuna",
+  "klakpuwan",
+  "kalitakgalhchiwinanan",
+  "takgalhchiwin",
+  "si",
+  "mak",
+  "lakapala",
+  "eh",
+  "lakgawasan",
+  "tanto",
+  "puntsu",
+  "neje",
+  "liwa",
+  "xlama",
+  "limunax",
+  "wayaw",
+  "tos",
+  "kga",
+  "tsukukan",
+  "tla",
+  "waya",
+  "jkawaniyan",
+  "kalh",
+  "kalakchikin",
+  "chuma",
+  "wakan",
+  "nata",
+  "wakax",
+  "anama",
+  "xlikana",
+  "mima",
+  "kilhakgat",
+  "kgawasa",
+  "alh",
+  "stakan",
+  "liquido",
+  "tlawama",
+  "stakli",
+  "mintaskujut",
+  "wak",
+  "ninin",
+  "akatunu",
+  "nachú",
+  "futbol",
+  "ktsu",
+  "kitsistankanin",
+  "jé",
+  "tahan",
+  "kgela",
+  "maski",
+  "escuela",
+  "kinka",
+  "kamuni",
+  "tutunaku",
+  "barrio",
+  "puklhni",
+  "maklakaskinkan",
+  "xwi",
+  "akgxtakga",
+  "puchiwin",
+  "kintsiyuna",
+  "lakchixkuwín",
+  "minacha",
+  "tsisa",
+  "kinatanatni",
+  "nana",
+  "nakatsiya",
+  "xkiwani",
+  "tsokgnan",
+  "lilakgastan",
+  "anu",
+  "natlan",
+  "liwaj",
+  "taputsa",
+  "tapakuwi",
+  "kilhwamanaw",
+  "militalakgapasni",
+  "es",
+  "takgalhi",
+  "talatapuli",
+  "sekgna",
+  "sarten",
+  "tachula",
+  "manteca",
+  "milh",
+  "kgalhnikan",
+  "tuwa",
+  "kaniwa",
+  "muxusipi",
+  "lonkgni",
+  "pupunu",
+  "tsakat",
+  "lakatsu",
+  "tsukuy",
+  "xchik",
+  "taxtuyacha",
+  "ixlakata",
+  "lay",
+  "kulanto",
+  "katsini",
+  "linkan",
+  "anán",
+  "chichí",
+  "lakpuwan",
+  "waliya",
+  "namujuniya",
+  "makgas",
+  "akgxni",
+  "tlawá",
+  "makxtum",
+  "tsankga",
+  "tasun",
+  "tlawanikan",
+  "takgachiwin",
+  "xkgakga",
+  "laxix",
+  "ktlawama",
+  "kgeskga",
+  "nikama",
+  "composta",
+  "lhakganan",
+  "jalanat",
+  "kukata",
+  "naskuja",
+  "lakgatiya",
+  "litlakgni",
+  "makgtakgalha",
+  "chatutu",
+  "suakaya",
+  "lajkgawasan",
+  "kalinkan",
+  "xtatlawa",
+  "kgalhiya",
+  "litalakgapasni",
+  "ankgan",
+  "masikan",
+  "tipatuy",
+  "latiyá",
+  "xakan",
+  "luwán",
+  "kilitalakgapasnikan",
+  "xaklakgati",
+  "titun",
+  "ktlawalh",
+  "naj",
+  "napina",
+  "tamakgxtakga",
+  "lax",
+  "lakatitun",
+  "nawaliya",
+  "olla",
+  "kuxí",
+  "chunama",
+  "kilatamatkan",
+  "kgalhiyaw",
+  "kawanti",
+  "nala",
+  "talakaskini",
+  "kuxmun",
+  "tsitsekge",
+  "tsilim",
+  "kamak",
+  "nawa",
+  "anís",
+  "kawat",
+  "smatanka",
+  "wit",
+  "sasti",
+  "kamakan",
+  "azúcar",
+  "gas",
+  "tajatat",
+  "nilay",
+  "nituwa",
+  "kuan",
+  "pulatamankan",
+  "akgtuy",
+  "xamana",
+  "titaxtuy",
+  "sputa",
+  "skgata",
+  "kgamanan",
+  "chakganan",
+  "swakgay",
+  "chilh",
+  "titaxtulh",
+  "makgtun",
+  "tatantlin",
+  "caporal",
+  "lichakgan",
+  "natlawayaw",
+  "chune",
+  "medio",
+  "amaj",
+  "pulhkuyat",
+  "kuxtalh",
+  "spitu",
+  "tatasamana",
+  "tlawamaka",
+  "chankan",
+  "mujukan",
+  "tsinaj",
+  "natlawakan",
+  "xan",
+  "nawana",
+  "tasí",
+  "staka",
+  "tlawalh",
+  "puchow",
+  "tlán",
+  "examen",
+  "tata",
+  "kakamasiniwi",
+  "takgaxmata",
+  "chamun",
+  "tataya",
+  "lápiz",
+  "kapit",
+  "maklakaskin",
+  "tsinksa",
+  "tsiyunajni",
+  "tukuya",
+  "klama",
+  "jkatachiwinan",
+  "taltsi",
+  "kgawasán",
+  "tlakga",
+  "klakpuwa",
+  "wakga",
+  "takilhtli",
+  "kinchatuykan",
+  "kinin",
+  "kiwí",
+  "likuchu",
+  "likan",
+  "xik",
+  "chichiní",
+  "pu",
+  "antes",
+  "klatapuli",
+  "smalankgan",
+  "tsiswan",
+  "tamana",
+  "pupunú",
+  "kiliktsu",
+  "litum",
+  "kanikxniwa",
+  "lakgmakgan",
+  "xtachiwin",
+  "kinatikun",
+  "naklakgati",
+  "kamawi",
+  "tilanka",
+  "kinkatukuxtu",
+  "kamanaw",
+  "poza",
+  "rica",
+  "naswakgaya",
+  "nalakchukuya",
+  "chalankga",
+  "chí",
+  "aver",
+  "lijikua",
+  "ver",
+  "waniputun",
+  "pinini",
+  "tatunu",
+  "xaliwa",
+  "tlana",
+  "way",
+  "kaxtlaway",
+  "al",
+  "kwalini",
+  "matsat",
+  "eye",
+  "skawawa",
+  "mano",
+  "tons",
+  "putlun",
+  "xama",
+  "talakpuwan",
+  "xtawa",
+  "xatatsili",
+  "mole",
+  "kamawikan",
+  "lakga",
+  "talaman",
+  "litakgachiwin",
+  "klichiwinan",
+  "xkgekga",
+  "stak",
+  "tasiw",
+  "namujuya",
+  "nakkinpulataman",
+  "kamatlawa",
+  "kuxtu",
+  "natawaya",
+  "kganan",
+  "tsukgawasa",
+  "nakx",
+  "puskat",
+  "lakxtun",
+  "tasilh",
+  "xalaktsu",
+  "xtalhakgan",
+  "xasnapapa",
+  "xalata",
+  "alakatanu",
+  "cuentaj",
+  "chiwix",
+  "makgaxilh",
+  "tlanya",
+  "makgtum",
+  "makgnilh",
+  "chayote",
+  "katsiyaw",
+  "taxtu",
+  "ktantli",
+  "kgatunu",
+  "laktsukamán",
+  "katla",
+  "kamakgtakgalha",
+  "kgati",
+  "komo",
+  "lichiwinan",
+  "xtaan",
+  "akgatsas",
+  "akgxakga",
+  "maxanana",
+  "tachiwinanpat",
+  "lakapastaka",
+  "pukgaman",
+  "likaman",
+  "wanican",
+  "kamana",
+  "wanamá",
+  "kalhi",
+  "makan",
+  "makán",
+  "xwanikan",
+  "tsankani",
+  "tachiwinkan",
+  "kamankan",
+  "kun",
+  "wilanaw",
+  "talichiwinan",
+  "kuentaja",
+  "tamakxtumit",
+  "puxku",
+  "tatitaxtumana",
+  "klakaskin",
+  "we",
+  "tlawanimaka",
+  "kgosnin",
+  "putun",
+  "tlakgnama",
+  "kawanimaka",
+  "tikukan",
+  "tatlaway",
+  "takatsin",
+  "nalinaw",
+  "chananankan",
+  "lakpuskanitni",
+  "tumaj",
+  "makgalakan",
+  "pukuchin",
+  "taliskuja",
+  "nita",
+  "tlakgtla",
+  "kuyu",
+  "kgatli",
+  "tunkan",
+  "jkgalhi",
+  "pasa",
+  "lhkgajni",
+  "mantajwa",
+  "kgankgatu",
+  "kstakli",
+  "estatal",
+  "xkin",
+  "wamá",
+  "chanit",
+  "tasakgni",
+  "nalin",
+  "wajka",
+  "muniya",
+  "kinkamasinimakan",
+  "tawi",
+  "k",
+  "nawankan",
+  "tarankga",
+  "lakgchiwit",
+  "tatlakgni",
+  "lawa",
+  "xtakgamanan",
+  "tankgololo",
+  "talikgamanan",
+  "caricatura",
+  "katakatsinilh",
+  "namuniya",
+  "natsiliya",
+  "namatiktiya",
+  "lakati",
+  "kamputum",
+  "kamputun",
+  "lonkgnan",
+  "nachulaya",
+  "xkamankan",
+  "namin",
+  "tadeo",
+  "kwili",
+  "minskgata",
+  "klin",
+  "kgawasan",
+  "kuanilh",
+  "mimakan",
+  "matlukg",
+  "matatat",
+  "má",
+  "pulhkni",
+  "kakilhtamakú",
+  "taanit",
+  "wate",
+  "mapachin",
+  "xkuti",
+  "uchu",
+  "lhkakastapu",
+  "xkiwatnan",
+  "chapanit",
+  "najkinpulataman",
+  "tlawayá",
+  "taskini",
+  "skujkan",
+  "takatsinimana",
+  "suero",
+  "lajgkgolon",
+  "xawat",
+  "xlin",
+  "sakgnan",
+  "tilankga",
+  "talila",
+  "aktsú",
+  "kinpapa",
+  "taway",
+  "kilhtin",
+  "jaxparay",
+  "castilla",
+  "tsokga",
+  "akgchaxan",
+  "akgspulamanaw",
+  "xakgeto",
+  "pukgaltawakga",
+  "kakxilhli",
+  "ktsukulh",
+  "xwakan",
+  "limakxtum",
+  "nawaniyan",
+  "xkimasini",
+  "kintapuwan",
+  "katsisni",
+  "wayaná",
+  "kana",
+  "kiwani",
+  "lakgapasnan",
+  "pueblillo",
+  "klakgapasnan",
+  "amigos",
+  "laki",
+  "latapulikan",
+  "chin",
+  "lipulay",
+  "jin",
+  "nooo",
+  "kanaw",
+  "klilamanaw",
+  "laklan",
+  "xi",
+  "wekgeta",
+  "natsukuya",
+  "xkgan",
+  "lhkuyat",
+  "makgapitsin",
+  "katachiwinan",
+  "kintijiakan",
+  "tsalanan",
+  "xmin",
+  "klakatí",
+  "paxawa",
+  "natachiwinana",
+  "anaw",
+  "ejemplo",
+  "katachiwinanti",
+  "lakgapasa",
+  "watiyata",
+  "nikxni",
+  "amigo",
+  "xlhakgatkan",
+  "xtakni",
+  "takgnu",
+  "lakglhkgomakan",
+  "makchaya",
+  "laktsupin",
+  "putum",
+  "tamaktin",
+  "waputun",
+  "xtlawakan",
+  "smukuku",
+  "tuma",
+  "niwi",
+  "tsitsa",
+  "langa",
+  "lankga",
+  "wakgoyaw",
+  "kimaknikan",
+  "tatsili",
+  "sikulán",
+  "asunción",
+  "limakxtun",
+  "makgán",
+  "kawayu",
+  "xpalakata",
+  "eee",
+  "nipara",
+  "lhkuyuyaw",
+  "paxialhnana",
+  "skin",
+  "kamasiniya",
+  "xtapuwan",
+  "pulaklh",
+  "katilanka",
+  "chalhuwa",
+  "nataspita",
+  "taki",
+  "nawaya",
+  "xkan",
+  "kintakam",
+  "kgalhí",
+  "kilakgoy",
+  "akgtutu",
+  "tsekan",
+  "tatanu",
+  "punchu",
+  "tasakua",
+  "tatsukulh",
+  "méxico",
+  "ixtse",
+  "tsukuka",
+  "xlimakgas",
+  "tatamakxtumi",
+  "laktsitsekgan",
+  "án",
+  "cultura",
+  "xakgspun",
+  "xalakg",
+  "najkgalhi",
+  "kamán",
+  "cebolla",
+  "kilimasakgsín",
+  "taskiní",
+  "kmaklakaskin",
+  "maklakaskinaw",
+  "laj",
+  "cocina",
+  "akchaniyan",
+  "kintuminkan",
+  "akinin",
+  "xkilhtun",
+  "tataju",
+  "limilh",
+  "metro",
+  "akan",
+  "tsetsekge",
+  "munikan",
+  "talhtsí",
+  "makgapala",
+  "xali",
+  "niwa",
+  "xu",
+  "tuk",
+  "lhpatekg",
+  "xakuanit",
+  "katukuxto",
+  "tapuwán",
+  "pín",
+  "senama",
+  "programa",
+  "klitanuy",
+  "kintaskujutkan",
+};
+const uint16_t WA_FREQ_170_RANKS[] = {
+  0, 0, 750, 0, 643, 645, 0, 0, 290, 240, 0, 0, 0, 0, 0, 0,
+  281, 0, 0, 893, 0, 0, 0, 0, 110, 0, 0, 0, 0, 0, 0, 197,
+  540, 0, 696, 0, 0, 487, 0, 785, 0, 707, 929, 0, 0, 0, 436, 0,
+  0, 0, 218, 0, 0, 0, 431, 408, 797, 927, 356, 677, 192, 784, 951, 657,
+  122, 0, 0, 0, 0, 0, 988, 0, 786, 0, 0, 0, 0, 0, 0, 335,
+  73, 386, 477, 911, 971, 0, 242, 312, 369, 97, 0, 0, 757, 0, 0, 0,
+  0, 0, 535, 0, 243, 751, 0, 0, 0, 0, 360, 0, 0, 648, 0, 336,
+  611, 908, 0, 0, 0, 0, 0, 0, 65, 0, 0, 130, 0, 863, 0, 0,
+  56, 583, 670, 764, 981, 67, 121, 400, 983, 357, 75, 802, 998, 0, 937, 828,
+  0, 0, 0, 581, 880, 817, 821, 609, 0, 442, 514, 709, 995, 0, 0, 0,
+  875, 659, 271, 376, 805, 921, 85, 0, 0, 0, 372, 445, 577, 0, 0, 0,
+  0, 0, 0, 0, 867, 0, 0, 329, 420, 878, 0, 378, 0, 454, 940, 636,
+  168, 966, 0, 0, 0, 918, 0, 307, 228, 843, 0, 615, 147, 364, 644, 711,
+  0, 0, 0, 0, 678, 650, 865, 961, 402, 199, 337, 77, 323, 646, 0, 0,
+  768, 835, 0, 803, 0, 681, 705, 894, 278, 0, 716, 0, 285, 0, 0, 0,
+  0, 673, 0, 123, 619, 0, 381, 134, 0, 665, 0, 526, 860, 83, 98, 0,
+  105, 358, 0, 0, 876, 89, 978, 722, 0, 669, 0, 0, 0, 0, 565, 0,
+  0, 0, 546, 433, 664, 183, 747, 0, 0, 0, 0, 0, 586, 0, 671, 652,
+  0, 165, 0, 308, 258, 173, 780, 0, 0, 931, 343, 604, 0, 84, 106, 390,
+  891, 917, 957, 0, 347, 0, 0, 0, 0, 413, 0, 0, 20, 437, 0, 672,
+  0, 563, 761, 0, 141, 713, 187, 0, 0, 0, 945, 87, 24, 202, 209, 588,
+  906, 0, 0, 373, 0, 0, 685, 720, 0, 0, 0, 0, 0, 0, 23, 637,
+  0, 13, 922, 0, 476, 0, 798, 0, 316, 441, 556, 632, 0, 616, 0, 0,
+  0, 714, 496, 781, 0, 0, 0, 523, 0, 0, 0, 813, 0, 0, 21, 0,
+  457, 558, 70, 507, 51, 0, 0, 287, 407, 319, 349, 938, 0, 502, 824, 823,
+  0, 156, 250, 430, 30, 481, 596, 806, 976, 0, 979, 0, 573, 0, 0, 0,
+  0, 482, 0, 0, 229, 234, 0, 0, 0, 816, 962, 424, 0, 0, 0, 0,
+  0, 0, 0, 99, 0, 0, 560, 493, 0, 320, 986, 0, 0, 0, 0, 829,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 538, 0, 0, 0, 0, 55, 345,
+  0, 0, 300, 982, 0, 0, 0, 661, 0, 135, 204, 0, 0, 0, 0, 0,
+  0, 0, 0, 690, 622, 0, 370, 484, 904, 0, 78, 131, 723, 570, 569, 43,
+  866, 0, 727, 475, 701, 0, 215, 660, 0, 451, 0, 340, 0, 0, 787, 0,
+  166, 629, 561, 694, 985, 1, 136, 635, 551, 974, 0, 0, 0, 0, 80, 0,
+  0, 0, 0, 0, 0, 799, 0, 0, 0, 0, 0, 94, 0, 809, 76, 0,
+  0, 920, 925, 111, 438, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 28, 0, 0, 260, 348, 587, 847, 0, 108, 404, 512, 0,
+  500, 0, 0, 950, 266, 0, 628, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 653, 0, 0, 0, 0, 0, 0, 153, 292, 503, 362, 527, 710, 0,
+  0, 0, 41, 688, 689, 0, 0, 0, 792, 741, 469, 350, 0, 683, 668, 0,
+  0, 0, 474, 0, 748, 549, 62, 365, 444, 352, 388, 282, 504, 928, 95, 0,
+  81, 116, 302, 740, 238, 919, 958, 0, 0, 272, 385, 0, 0, 600, 734, 0,
+  541, 733, 888, 322, 120, 0, 0, 0, 0, 934, 0, 0, 0, 0, 396, 0,
+  0, 0, 216, 91, 11, 198, 602, 578, 779, 241, 955, 984, 64, 54, 133, 992,
+  597, 0, 0, 0, 466, 72, 236, 128, 446, 997, 0, 0, 0, 391, 872, 744,
+  903, 993, 0, 0, 0, 0, 0, 0, 0, 0, 814, 0, 0, 0, 544, 0,
+  0, 0, 0, 0, 0, 501, 0, 49, 901, 531, 718, 0, 662, 889, 0, 777,
+  0, 288, 996, 196, 0, 0, 0, 0, 0, 0, 620, 359, 0, 0, 0, 0,
+  366, 405, 752, 189, 913, 0, 0, 0, 0, 0, 759, 0, 0, 0, 0, 184,
+  0, 0, 0, 0, 0, 0, 621, 0, 0, 0, 223, 704, 0, 0, 15, 0,
+  0, 3, 877, 0, 26, 351, 800, 0, 756, 513, 0, 585, 0, 656, 900, 0,
+  0, 19, 519, 972, 0, 2, 0, 472, 505, 858, 0, 0, 0, 0, 0, 0,
+  534, 820, 246, 882, 0, 0, 0, 0, 332, 161, 943, 0, 389, 0, 506, 0,
+  0, 0, 0, 0, 127, 0, 448, 0, 0, 0, 0, 0, 0, 825, 1000, 633,
+  93, 299, 886, 0, 0, 0, 0, 0, 363, 910, 0, 273, 219, 0, 822, 518,
+  0, 0, 0, 145, 158, 160, 185, 274, 315, 916, 339, 244, 844, 892, 952, 0,
+  0, 735, 897, 275, 304, 0, 0, 392, 311, 0, 269, 53, 172, 667, 0, 0,
+  0, 0, 0, 0, 151, 377, 0, 0, 0, 306, 429, 0, 0, 109, 698, 0,
+  355, 0, 0, 0, 40, 305, 379, 0, 915, 298, 0, 0, 301, 0, 0, 232,
+  0, 114, 712, 849, 944, 0, 0, 0, 0, 152, 795, 0, 79, 0, 375, 832,
+  0, 439, 0, 0, 170, 0, 0, 0, 0, 0, 0, 0, 0, 265, 0, 0,
+  0, 0, 0, 394, 480, 18, 0, 545, 559, 0, 411, 90, 818, 0, 0, 0,
+  949, 0, 0, 318, 220, 6, 262, 607, 440, 693, 0, 613, 0, 869, 0, 497,
+  270, 760, 37, 0, 0, 0, 0, 0, 142, 317, 0, 0, 0, 367, 0, 0,
+  154, 61, 162, 195, 0, 0, 0, 0, 0, 0, 595, 0, 0, 0, 782, 0,
+  608, 840, 0, 627, 0, 0, 0, 0, 0, 0, 102, 449, 0, 0, 766, 0,
+  0, 0, 0, 692, 0, 346, 721, 853, 947, 353, 0, 0, 280, 0, 0, 0,
+  0, 0, 419, 516, 0, 371, 263, 522, 0, 871, 74, 0, 213, 0, 104, 0,
+  193, 682, 0, 397, 0, 686, 42, 283, 231, 212, 521, 149, 666, 410, 490, 0,
+  294, 912, 416, 975, 0, 0, 0, 174, 0, 675, 525, 0, 119, 592, 0, 0,
+  743, 899, 14, 791, 0, 132, 794, 855, 933, 562, 374, 841, 0, 0, 0, 155,
+  211, 838, 873, 0, 417, 0, 0, 536, 0, 0, 395, 0, 164, 898, 59, 341,
+  259, 491, 0, 0, 617, 0, 0, 0, 0, 679, 0, 0, 227, 0, 0, 973,
+  0, 0, 0, 0, 0, 0, 222, 618, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 479, 808, 293, 426, 0, 138, 264, 857, 7, 297,
+  969, 0, 313, 344, 401, 543, 0, 0, 393, 697, 0, 163, 0, 0, 0, 0,
+  0, 0, 623, 0, 0, 0, 36, 0, 0, 16, 542, 0, 107, 0, 0, 0,
+  0, 0, 0, 453, 580, 926, 0, 470, 0, 468, 590, 924, 0, 819, 0, 594,
+  731, 0, 0, 0, 0, 624, 0, 0, 321, 0, 0, 427, 0, 0, 0, 0,
+  0, 796, 492, 486, 0, 0, 0, 0, 0, 0, 124, 0, 0, 0, 113, 0,
+  5, 0, 0, 46, 728, 548, 71, 610, 836, 555, 286, 850, 68, 0, 471, 0,
+  230, 0, 0, 235, 324, 0, 631, 0, 434, 626, 639, 0, 0, 0, 0, 0,
+  837, 0, 0, 0, 745, 967, 0, 0, 0, 140, 144, 804, 0, 658, 194, 0,
+  0, 0, 382, 638, 0, 0, 0, 0, 0, 103, 598, 10, 334, 833, 887, 0,
+  0, 625, 0, 0, 987, 0, 0, 418, 465, 0, 0, 0, 117, 0, 0, 0,
+  0, 32, 0, 463, 517, 207, 179, 208, 0, 180, 755, 0, 749, 762, 226, 0,
+  0, 0, 739, 0, 0, 27, 45, 406, 963, 989, 256, 930, 0, 0, 0, 0,
+  0, 214, 0, 0, 706, 284, 0, 0, 303, 0, 0, 0, 0, 368, 948, 715,
+  0, 0, 0, 0, 717, 44, 0, 0, 584, 414, 771, 0, 0, 815, 221, 605,
+  0, 0, 148, 0, 0, 684, 325, 0, 0, 0, 462, 0, 450, 746, 0, 0,
+  0, 143, 641, 29, 495, 190, 827, 249, 730, 895, 0, 182, 112, 205, 767, 0,
+  456, 0, 0, 0, 0, 0, 0, 0, 932, 0, 651, 0, 383, 0, 593, 92,
+  50, 552, 564, 86, 724, 810, 941, 101, 254, 923, 425, 539, 591, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 842, 845, 0,
+  0, 0, 0, 0, 428, 0, 0, 606, 0, 881, 115, 460, 509, 793, 0, 0,
+  942, 980, 990, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 459, 0,
+  0, 0, 0, 0, 0, 0, 409, 776, 0, 0, 100, 443, 0, 0, 737, 0,
+  0, 0, 0, 0, 171, 0, 0, 0, 0, 0, 485, 630, 0, 0, 567, 0,
+  0, 0, 0, 634, 0, 0, 0, 0, 328, 0, 0, 0, 0, 758, 0, 0,
+  830, 0, 0, 0, 890, 848, 387, 0, 0, 0, 566, 0, 175, 0, 695, 0,
+  0, 529, 0, 181, 483, 852, 964, 0, 0, 763, 0, 0, 0, 137, 200, 0,
+  0, 0, 0, 0, 0, 532, 589, 0, 0, 572, 225, 354, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 970, 0, 201, 0, 455, 118, 807, 935, 576, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 956, 0, 699, 999, 0, 309, 789, 129, 994,
+  255, 700, 0, 60, 0, 729, 0, 703, 33, 333, 488, 772, 959, 139, 338, 342,
+  655, 0, 0, 252, 571, 384, 210, 511, 614, 773, 883, 0, 0, 0, 960, 261,
+  0, 0, 489, 508, 0, 57, 314, 0, 856, 0, 176, 953, 0, 864, 0, 0,
+  0, 403, 146, 702, 0, 52, 0, 0, 186, 203, 0, 0, 0, 680, 0, 125,
+  467, 279, 854, 896, 494, 267, 0, 530, 902, 905, 0, 0, 423, 0, 0, 0,
+  0, 0, 537, 0, 0, 0, 0, 0, 0, 0, 0, 0, 310, 0, 0, 612,
+  0, 435, 330, 510, 0, 0, 0, 520, 17, 790, 295, 0, 0, 0, 0, 568,
+  0, 0, 82, 237, 0, 96, 965, 0, 0, 0, 676, 834, 991, 0, 0, 0,
+  327, 248, 533, 0, 0, 0, 0, 0, 0, 178, 268, 478, 0, 0, 0, 253,
+  0, 0, 415, 579, 0, 0, 0, 885, 66, 550, 0, 691, 217, 599, 603, 839,
+  0, 126, 0, 0, 0, 0, 0, 0, 0, 8, 663, 0, 0, 0, 738, 770,
+  801, 725, 811, 0, 0, 0, 0, 778, 31, 0, 0, 0, 291, 687, 732, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 34, 0, 788, 22, 642,
+  0, 150, 167, 515, 0, 25, 421, 528, 859, 0, 0, 245, 498, 654, 812, 257,
+  582, 736, 0, 719, 239, 0, 954, 0, 0, 159, 458, 907, 0, 9, 0, 0,
+  247, 326, 862, 0, 0, 0, 939, 0, 0, 0, 0, 554, 547, 601, 946, 0,
+  0, 0, 0, 0, 754, 0, 0, 846, 831, 0, 12, 331, 0, 553, 0, 861,
+  461, 464, 574, 0, 422, 674, 884, 63, 0, 0, 0, 0, 0, 47, 968, 296,
+  289, 398, 826, 868, 851, 0, 649, 726, 765, 914, 233, 0, 0, 0, 0, 473,
+  0, 0, 0, 0, 0, 0, 0, 0, 191, 251, 361, 412, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 783, 909, 0, 399, 0, 0, 0, 0, 870, 575, 0,
+  0, 39, 88, 188, 499, 557, 0, 276, 0, 38, 206, 277, 0, 936, 0, 0,
+  640, 0, 0, 0, 0, 157, 169, 224, 452, 447, 524, 35, 708, 774, 177, 4,
+  775, 874, 977, 0, 0, 380, 0, 769, 0, 58, 742, 753, 879, 0, 0, 432,
+  0, 69, 0, 0, 0, 0, 647, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+const char *WA_FREQ_171_TOKENS[] = {
+  "mi",
+  "no",
+  "long",
+  "gat",
+  "i",
+  "yu",
+  "nau",
+  "save",
+  "pikinini",
+  "hat",
+  "bilong",
+  "hia",
+  "yet",
+  "burj",
+  "khalifa",
+  "em",
+  "longpela",
+  "haus",
+  "go",
+  "antap",
+  "skai",
+  "graun",
+  "husat",
+  "tok",
+  "inglis",
+  "harim",
+  "tasol",
+  "ken",
+  "lukim",
+  "taim",
+  "pukpuk",
+  "nidim",
+  "laik",
+  "kar",
+  "klos",
+  "ol",
+  "tu",
+};
+const uint16_t WA_FREQ_171_RANKS[] = {
+  0, 7, 0, 0, 0, 0, 0, 0, 0, 27, 0, 0, 0, 0, 0, 0,
+  32, 6, 14, 0, 0, 0, 3, 0, 0, 0, 0, 15, 0, 0, 0, 0,
+  11, 0, 0, 0, 36, 0, 0, 0, 0, 0, 0, 24, 0, 22, 0, 0,
+  0, 0, 0, 0, 0, 23, 12, 1, 0, 0, 10, 17, 26, 30, 31, 33,
+  0, 0, 0, 0, 28, 0, 0, 0, 0, 18, 0, 0, 35, 0, 0, 0,
+  0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 8, 0, 0, 37, 0,
+  0, 0, 0, 0, 21, 0, 13, 20, 0, 0, 0, 0, 25, 16, 5, 0,
+  19, 4, 29, 0, 0, 0, 0, 0, 0, 34, 0, 0, 0, 0, 2, 0,
+};
+
+const char *WA_FREQ_172_TOKENS[] = {
+  "bir",
+  "bu",
+  "ne",
+  "ve",
+  "için",
+  "mi",
+  "de",
+  "o",
+  "ben",
+  "çok",
+  "ama",
+  "evet",
+  "var",
+  "da",
+  "mı",
+  "değil",
+  "şey",
+  "hayır",
+  "daha",
+  "sen",
+  "kadar",
+  "bana",
+  "gibi",
+  "yok",
+  "bunu",
+  "onu",
+  "iyi",
+  "tamam",
+  "beni",
+  "seni",
+  "her",
+  "benim",
+  "sana",
+  "ki",
+  "ya",
+  "neden",
+  "zaman",
+  "sadece",
+  "senin",
+  "burada",
+  "olduğunu",
+  "nasıl",
+  "hiç",
+  "sonra",
+  "şimdi",
+  "en",
+  "öyle",
+  "mu",
+  "şu",
+  "misin",
+  "önce",
+  "biraz",
+  "hadi",
+  "güzel",
+  "musun",
+  "oldu",
+  "yani",
+  "böyle",
+  "ona",
+  "İyi",
+  "lütfen",
+  "onun",
+  "bile",
+  "bak",
+  "çünkü",
+  "peki",
+  "eğer",
+  "artık",
+  "gerçekten",
+  "geri",
+  "biliyorum",
+  "istiyorum",
+  "kim",
+  "olarak",
+  "başka",
+  "belki",
+  "tek",
+  "doğru",
+  "büyük",
+  "olan",
+  "biri",
+  "olur",
+  "buraya",
+  "bay",
+  "in",
+  "olacak",
+  "adam",
+  "ile",
+  "hiçbir",
+  "biz",
+  "yardım",
+  "demek",
+  "hey",
+  "sanırım",
+  "ın",
+  "bilmiyorum",
+  "bunun",
+  "tüm",
+  "teşekkürler",
+  "fazla",
+  "yeni",
+  "gün",
+  "ederim",
+  "nerede",
+  "tanrım",
+  "a",
+  "şeyi",
+  "merhaba",
+  "efendim",
+  "orada",
+  "son",
+  "kötü",
+  "şeyler",
+  "gece",
+  "biliyor",
+  "sorun",
+  "iki",
+  "harika",
+  "gerek",
+  "et",
+  "tam",
+  "İşte",
+  "bütün",
+  "diye",
+  "hemen",
+  "siz",
+  "üzgünüm",
+  "ol",
+  "olabilir",
+  "i",
+  "olsun",
+  "küçük",
+  "size",
+  "yüzden",
+  "bayan",
+  "aynı",
+  "teşekkür",
+  "hakkında",
+  "tabii",
+  "gel",
+  "onları",
+  "kendi",
+  "kız",
+  "nin",
+  "devam",
+  "bize",
+  "e",
+  "oluyor",
+  "ver",
+  "izin",
+  "iş",
+  "bizi",
+  "buna",
+  "anne",
+  "selam",
+  "vardı",
+  "geldi",
+  "bizim",
+  "sizi",
+  "dur",
+  "kimse",
+  "göre",
+  "asla",
+  "özür",
+  "seninle",
+  "baba",
+  "değilim",
+  "aslında",
+  "önemli",
+  "tekrar",
+  "git",
+  "nın",
+  "yoksa",
+  "hala",
+  "işte",
+  "oh",
+  "benimle",
+  "içinde",
+  "mısın",
+  "yine",
+  "mü",
+  "bence",
+  "şekilde",
+  "olmak",
+  "bugün",
+  "söyle",
+  "birlikte",
+  "olmaz",
+  "pekala",
+  "uzun",
+  "lazım",
+  "biliyorsun",
+  "zaten",
+  "para",
+  "ilk",
+  "geliyor",
+  "onunla",
+  "gerçek",
+  "dostum",
+  "al",
+  "bakalım",
+  "onlar",
+  "haydi",
+  "birkaç",
+  "emin",
+  "üç",
+  "herkes",
+  "dakika",
+  "ı",
+  "söyledi",
+  "istiyorsun",
+  "pek",
+  "ister",
+  "saat",
+  "yapıyorsun",
+  "eve",
+  "yıl",
+  "miyim",
+  "çocuk",
+  "yer",
+  "hep",
+  "şunu",
+  "neler",
+  "dilerim",
+  "bekle",
+  "sizin",
+  "bırak",
+  "olduğu",
+  "ilgili",
+  "gidelim",
+  "yere",
+  "etmek",
+  "an",
+  "dan",
+  "nedir",
+  "un",
+  "nereye",
+  "hepsi",
+  "istemiyorum",
+  "olmalı",
+  "buradan",
+  "lanet",
+  "karşı",
+  "kaç",
+  "az",
+  "burası",
+  "hazır",
+  "fakat",
+  "eski",
+  "çocuklar",
+  "kendini",
+  "ediyorum",
+  "gerekiyor",
+  "benden",
+  "yapmak",
+  "kadın",
+  "söz",
+  "kesinlikle",
+  "zor",
+  "işe",
+  "anda",
+  "tane",
+  "diğer",
+  "dinle",
+  "bunlar",
+  "işi",
+  "kişi",
+  "görmek",
+  "kabul",
+  "niye",
+  "istiyor",
+  "seviyorum",
+  "aman",
+  "sağ",
+  "zorunda",
+  "misiniz",
+  "tanrı",
+  "yarın",
+  "kez",
+  "bundan",
+  "İki",
+  "elbette",
+  "falan",
+  "gidip",
+  "hem",
+  "yanlış",
+  "onlara",
+  "senden",
+  "hoş",
+  "doktor",
+  "tatlım",
+  "yapma",
+  "özel",
+  "yemek",
+  "hafta",
+  "kontrol",
+  "ediyor",
+  "gereken",
+  "yerde",
+  "oraya",
+  "hâlâ",
+  "geç",
+  "dedim",
+  "mutlu",
+  "ye",
+  "bazı",
+  "birini",
+  "ayrıca",
+  "ondan",
+  "eminim",
+  "nereden",
+  "etti",
+  "dışarı",
+  "beri",
+  "gitti",
+  "yalan",
+  "edin",
+  "bakın",
+  "yalnız",
+  "insan",
+  "gördüm",
+  "değildi",
+  "merak",
+  "insanlar",
+  "polis",
+  "ihtiyacım",
+  "erkek",
+  "görüşürüz",
+  "dün",
+  "ah",
+  "haber",
+  "la",
+  "musunuz",
+  "babam",
+  "gidiyor",
+  "pekâlâ",
+  "yi",
+  "olmuş",
+  "akşam",
+  "den",
+  "geçen",
+  "sakin",
+  "ha",
+  "sanki",
+  "beş",
+  "karar",
+  "nefret",
+  "sabah",
+  "yaptım",
+  "veya",
+  "dikkat",
+  "umarım",
+  "yerine",
+  "çabuk",
+  "etme",
+  "olması",
+  "farklı",
+  "değilsin",
+  "ay",
+  "sonunda",
+  "gördün",
+  "ettim",
+  "sence",
+  "fark",
+  "üzerinde",
+  "aptal",
+  "kendimi",
+  "tamamen",
+  "oldukça",
+  "su",
+  "boyunca",
+  "kendine",
+  "tarafından",
+  "yeter",
+  "dünya",
+  "u",
+  "yı",
+  "olduğumu",
+  "bunları",
+  "vardır",
+  "öldü",
+  "olursa",
+  "açık",
+  "neyse",
+  "annem",
+  "kes",
+  "İlk",
+  "istediğim",
+  "adı",
+  "dr.",
+  "yaptın",
+  "yap",
+  "hangi",
+  "olamaz",
+  "ancak",
+  "söyledim",
+  "görünüyor",
+  "dört",
+  "yüzünden",
+  "aldım",
+  "olsa",
+  "birşey",
+  "birisi",
+  "be",
+  "yoktu",
+  "kolay",
+  "dolar",
+  "dedi",
+  "sahip",
+  "ise",
+  "olmadığını",
+  "yanında",
+  "gelecek",
+  "adamı",
+  "bende",
+  "buldum",
+  "yol",
+  "geldim",
+  "bazen",
+  "konuşmak",
+  "başına",
+  "gitmek",
+  "anlıyorum",
+  "beraber",
+  "henüz",
+  "yapıyor",
+  "yolu",
+  "bitti",
+  "onların",
+  "cevap",
+  "evde",
+  "yardımcı",
+  "zamanı",
+  "almak",
+  "konusunda",
+  "genç",
+  "oldum",
+  "nun",
+  "takip",
+  "kal",
+  "öyleyse",
+  "kahretsin",
+  "durum",
+  "tabi",
+  "günü",
+  "ateş",
+  "adamın",
+  "muhtemelen",
+  "adım",
+  "istedim",
+  "söylemek",
+  "azından",
+  "düşündüm",
+  "le",
+  "yaptı",
+  "neredeyse",
+  "eder",
+  "olun",
+  "yeniden",
+  "düşünüyorsun",
+  "ciddi",
+  "vay",
+  "herhangi",
+  "ev",
+  "hızlı",
+  "sanmıyorum",
+  "süre",
+  "içeri",
+  "altında",
+  "mükemmel",
+  "göz",
+  "kan",
+  "düşünüyorum",
+  "ara",
+  "boş",
+  "miyiz",
+  "konuda",
+  "halde",
+  "duydum",
+  "oğlum",
+  "şeyin",
+  "uzak",
+  "gelen",
+  "aç",
+  "işin",
+  "hayatta",
+  "çıktı",
+  "sakın",
+  "saniye",
+  "yakın",
+  "anladım",
+  "garip",
+  "john",
+  "olduğuna",
+  "on",
+  "arada",
+  "hayal",
+  "gidiyorum",
+  "araba",
+  "çeviri",
+  "çalışıyorum",
+  "jack",
+  "söylüyor",
+  "sürü",
+  "hepimiz",
+  "kaldı",
+  "galiba",
+  "canım",
+  "hayatım",
+  "rahat",
+  "kimin",
+  "alo",
+  "olacağım",
+  "güçlü",
+  "savaş",
+  "verdi",
+  "ta",
+  "ortaya",
+  "şeye",
+  "bebeğim",
+  "başladı",
+  "dersin",
+  "gelip",
+  "hayat",
+  "bilirsin",
+  "çalışıyor",
+  "durumda",
+  "hatta",
+  "geldin",
+  "yaptığını",
+  "sende",
+  "olay",
+  "şeyleri",
+  "adamım",
+  "kesin",
+  "arasında",
+  "arkadaşım",
+  "hareket",
+  "altı",
+  "bebek",
+  "kardeşim",
+  "çocuğu",
+  "böylece",
+  "acaba",
+  "sürekli",
+  "bin",
+  "ihtiyacı",
+  "haklısın",
+  "soru",
+  "olmadan",
+  "hava",
+  "terk",
+  "silah",
+  "olacağını",
+  "yapacağım",
+  "gelir",
+  "varsa",
+  "komik",
+  "kısa",
+  "aynen",
+  "etmeye",
+  "üzerine",
+  "el",
+  "zarar",
+  "şaka",
+  "birinin",
+  "güle",
+  "zamanda",
+  "siktir",
+  "daki",
+  "acele",
+  "telefon",
+  "ait",
+  "gizli",
+  "oyun",
+  "kızı",
+  "şuna",
+  "diyorsun",
+  "yeterince",
+  "verdim",
+  "evlat",
+  "geçti",
+  "baban",
+  "olmayacak",
+  "dışında",
+  "yolunda",
+  "hepsini",
+  "uygun",
+  "dans",
+  "günaydın",
+  "kapıyı",
+  "olurdu",
+  "tuhaf",
+  "memnun",
+  "hissediyorum",
+  "fikir",
+  "yüksek",
+  "new",
+  "olmadı",
+  "beyler",
+  "tür",
+  "verin",
+  "değildir",
+  "korkunç",
+  "rahatsız",
+  "gidiyoruz",
+  "gerektiğini",
+  "geceler",
+  "aldı",
+  "gidiyorsun",
+  "iyiyim",
+  "kere",
+  "sanıyordum",
+  "eden",
+  "gelin",
+  "veriyorum",
+  "edecek",
+  "beyaz",
+  "yaşlı",
+  "mümkün",
+  "neyi",
+  "dolu",
+  "içine",
+  "çıkar",
+  "ölüm",
+  "sensin",
+  "nasılsın",
+  "bilmek",
+  "belli",
+  "sanıyorsun",
+  "sevindim",
+  "yakında",
+  "varmış",
+  "tahmin",
+  "sam",
+  "herif",
+  "durun",
+  "parayı",
+  "şöyle",
+  "yalnızca",
+  "vermek",
+  "biliyordum",
+  "ediyorsun",
+  "acı",
+  "yapamam",
+  "mısınız",
+  "yapmaya",
+  "neydi",
+  "hasta",
+  "üzere",
+  "yapacağız",
+  "istedi",
+  "çeneni",
+  "güvenlik",
+  "berbat",
+  "annen",
+  "bizimle",
+  "geliyorum",
+  "İçeri",
+  "yapacak",
+  "dair",
+  "başkan",
+  "dedin",
+  "neyin",
+  "sizinle",
+  "dikkatli",
+  "anladın",
+  "yapıyorum",
+  "ihtiyacın",
+  "olmayan",
+  "ihtiyacımız",
+  "ölü",
+  "aile",
+  "bırakın",
+  "birine",
+  "istediğini",
+  "tatlı",
+  "deli",
+  "milyon",
+  "normal",
+  "söyledin",
+  "dışarıda",
+  "insanların",
+  "diyorum",
+  "sefer",
+  "olup",
+  "pardon",
+  "otur",
+  "yemin",
+  "ana",
+  "te",
+  "keşke",
+  "ettin",
+  "dünyanın",
+  "şans",
+  "baş",
+  "affedersiniz",
+  "evine",
+  "biliyoruz",
+  "aşağı",
+  "yeri",
+  "İnsanlar",
+  "millet",
+  "aşk",
+  "bununla",
+  "çık",
+  "kapa",
+  "miydi",
+  "at",
+  "durumu",
+  "bilmem",
+  "arkadaş",
+  "kendisi",
+  "herkesin",
+  "kusura",
+  "doğum",
+  "yapar",
+  "charlie",
+  "isterim",
+  "istersen",
+  "yaşında",
+  "michael",
+  "cidden",
+  "oradan",
+  "the",
+  "kahve",
+  "hata",
+  "seks",
+  "kızlar",
+  "kaptan",
+  "yavaş",
+  "alıp",
+  "bakma",
+  "hayatını",
+  "dek",
+  "yeterli",
+  "mıydı",
+  "zamandır",
+  "asıl",
+  "bunların",
+  "hoşça",
+  "önünde",
+  "sessiz",
+  "kızım",
+  "frank",
+  "erken",
+  "aldın",
+  "york",
+  "sıcak",
+  "tehlikeli",
+  "amerika",
+  "düşünüyor",
+  "dön",
+  "bilgi",
+  "getir",
+  "güç",
+  "hak",
+  "ufak",
+  "buradayım",
+  "bilmiyor",
+  "cinayet",
+  "diyor",
+  "gelmiş",
+  "üstüne",
+  "mesaj",
+  "nefes",
+  "ele",
+  "birçok",
+  "olmasını",
+  "yüz",
+  "basit",
+  "yukarı",
+  "çek",
+  "olduğum",
+  "köpek",
+  "duydun",
+  "edeceğim",
+  "evi",
+  "gayet",
+  "şarkı",
+  "tıpkı",
+  "benziyor",
+  "anlaşıldı",
+  "inanamıyorum",
+  "olduğun",
+  "bulmak",
+  "söylüyorum",
+  "kızın",
+  "vakit",
+  "n",
+  "yıldır",
+  "görüyorum",
+  "haklı",
+  "ses",
+  "olsaydı",
+  "sonraki",
+  "konu",
+  "almaya",
+  "gitmem",
+  "işler",
+  "muhteşem",
+  "görünüyorsun",
+  "gidin",
+  "olacaksın",
+  "neye",
+  "dalga",
+  "film",
+  "adını",
+  "kimsenin",
+  "bi",
+  "yerinde",
+  "bayım",
+  "bilmiyordum",
+  "yapmam",
+  "yapacaksın",
+  "istediğin",
+  "koca",
+  "yu",
+  "buldun",
+  "olmalısın",
+  "ikinci",
+  "anlamıyorum",
+  "hatırlıyor",
+  "insanları",
+  "noel",
+  "acil",
+  "mike",
+  "parti",
+  "george",
+  "lan",
+  "sebebi",
+  "fena",
+  "söylemiştim",
+  "yedi",
+  "tom",
+  "joe",
+  "özellikle",
+  "zamanlar",
+  "yaptığı",
+  "bilir",
+  "yaparım",
+  "alabilir",
+  "birden",
+  "ajan",
+  "yanına",
+  "sebep",
+  "eğlenceli",
+  "dedektif",
+  "adına",
+  "düşün",
+  "rağmen",
+  "olmaya",
+  "tut",
+  "görünüşe",
+  "herhalde",
+  "söylüyorsun",
+  "yapalım",
+  "buradaki",
+  "yoktur",
+  "zavallı",
+  "david",
+  "yemeği",
+  "baksana",
+  "temiz",
+  "babası",
+  "arkadaşın",
+  "içki",
+  "söyleme",
+  "burda",
+  "İşe",
+  "allah",
+  "parçası",
+  "s",
+  "biriyle",
+  "üstünde",
+  "şeyden",
+  "istiyorsan",
+  "uyuşturucu",
+  "konuşma",
+  "olduğundan",
+  "öldürmek",
+  "sesini",
+  "bekliyor",
+  "suç",
+  "görüyor",
+  "gerçeği",
+  "alın",
+  "katil",
+  "sevgili",
+  "peter",
+  "yerini",
+  "defa",
+  "gerekir",
+  "müzik",
+  "kayıp",
+  "güvenli",
+  "tercih",
+  "patron",
+  "sayın",
+  "gerekiyordu",
+  "çoğu",
+  "değiliz",
+  "işim",
+  "geldik",
+  "kimseye",
+  "çoktan",
+  "dürüst",
+  "alacağım",
+  "eskiden",
+  "teklif",
+  "arkadaşı",
+  "dolayı",
+  "numara",
+  "sonsuza",
+  "geldiniz",
+  "bilemiyorum",
+  "sonu",
+  "olma",
+  "unutma",
+  "kırmızı",
+  "teslim",
+  "canlı",
+  "oda",
+  "yapan",
+  "saçma",
+  "işini",
+  "babamın",
+  "yaptığın",
+  "soğuk",
+  "verir",
+  "kimsin",
+  "bahsediyorsun",
+  "bağlı",
+  "yapabilirim",
+  "onlardan",
+  "bizden",
+  "süper",
+  "bulduk",
+  "hanımefendi",
+  "herşey",
+  "seviyor",
+  "alan",
+  "yaşıyor",
+  "olmasın",
+  "onlarla",
+  "davet",
+  "yapmış",
+  "ölmüş",
+  "yürü",
+  "sahibi",
+  "kalk",
+  "elinde",
+  "umurumda",
+  "sıra",
+  "istemiyor",
+  "çalışıyorsun",
+  "çocukları",
+  "tanıyor",
+  "burayı",
+  "görmeye",
+  "kalan",
+  "istiyoruz",
+  "sert",
+  "tamamdır",
+  "olası",
+  "fikrim",
+  "aşık",
+  "günler",
+  "adamlar",
+  "dava",
+  "sene",
+  "çekil",
+  "iyisi",
+  "sağol",
+  "bakayım",
+  "zorundayım",
+  "anlat",
+  "kavga",
+  "anlamı",
+  "İyiyim",
+  "alır",
+  "görmedim",
+  "kendime",
+  "kral",
+  "kalmak",
+  "geldiğini",
+  "okul",
+  "şehir",
+  "gitsin",
+  "park",
+  "bekleyin",
+  "gelmek",
+  "İş",
+  "kapı",
+  "yaptığım",
+  "anlamına",
+  "takım",
+  "yola",
+  "altına",
+  "kendim",
+};
+const uint16_t WA_FREQ_172_RANKS[] = {
+  487, 683, 963, 623, 0, 378, 0, 594, 436, 530, 65, 620, 251, 388, 419, 828,
+  721, 474, 726, 0, 659, 446, 136, 958, 0, 518, 0, 0, 596, 186, 204, 931,
+  0, 0, 0, 552, 797, 0, 366, 112, 0, 0, 762, 0, 0, 0, 627, 0,
+  0, 0, 661, 736, 791, 0, 13, 23, 73, 0, 0, 0, 0, 840, 625, 0,
+  0, 201, 2, 123, 0, 0, 0, 0, 0, 0, 0, 0, 0, 841, 930, 781,
+  953, 83, 994, 281, 947, 0, 0, 0, 0, 0, 0, 0, 0, 0, 740, 786,
+  563, 0, 0, 0, 0, 0, 26, 0, 0, 329, 515, 879, 0, 0, 0, 189,
+  555, 344, 0, 676, 613, 764, 951, 0, 401, 0, 0, 0, 0, 101, 0, 0,
+  0, 0, 939, 321, 0, 928, 88, 48, 363, 0, 305, 0, 75, 0, 336, 611,
+  759, 773, 0, 0, 0, 0, 0, 0, 0, 481, 0, 0, 915, 0, 532, 0,
+  0, 881, 0, 0, 0, 0, 213, 0, 0, 0, 408, 575, 0, 0, 0, 525,
+  0, 155, 460, 977, 0, 670, 933, 961, 0, 0, 0, 0, 0, 783, 92, 0,
+  0, 0, 413, 0, 0, 61, 848, 730, 0, 291, 0, 0, 315, 533, 0, 644,
+  0, 960, 0, 0, 400, 0, 0, 493, 607, 903, 0, 465, 0, 69, 216, 869,
+  976, 754, 326, 806, 304, 275, 715, 0, 694, 170, 0, 0, 557, 0, 0, 0,
+  0, 0, 774, 52, 47, 0, 0, 546, 0, 97, 206, 509, 0, 412, 0, 0,
+  0, 691, 0, 0, 0, 0, 0, 0, 0, 470, 829, 0, 0, 0, 559, 833,
+  0, 0, 382, 520, 891, 0, 807, 825, 0, 531, 0, 0, 421, 107, 0, 0,
+  263, 680, 124, 331, 309, 571, 761, 0, 579, 0, 49, 682, 0, 839, 907, 0,
+  449, 0, 0, 370, 799, 0, 0, 0, 798, 940, 0, 0, 0, 0, 0, 0,
+  0, 437, 936, 0, 0, 0, 0, 374, 0, 0, 521, 708, 752, 0, 0, 0,
+  243, 0, 453, 504, 776, 39, 955, 0, 0, 397, 576, 0, 0, 0, 190, 0,
+  0, 0, 849, 556, 0, 639, 0, 0, 0, 794, 0, 416, 253, 0, 541, 0,
+  0, 908, 0, 293, 615, 946, 475, 90, 778, 0, 157, 901, 214, 671, 801, 0,
+  0, 717, 0, 545, 0, 0, 185, 854, 0, 0, 0, 0, 30, 76, 512, 643,
+  739, 765, 787, 0, 194, 653, 0, 0, 0, 0, 616, 0, 0, 316, 0, 143,
+  0, 0, 9, 385, 128, 642, 0, 514, 405, 809, 371, 390, 592, 0, 0, 0,
+  0, 258, 0, 106, 733, 0, 956, 0, 80, 0, 0, 0, 0, 875, 0, 876,
+  0, 660, 150, 706, 248, 539, 888, 0, 285, 957, 98, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 646, 0, 0, 0, 0, 626, 0, 357,
+  0, 614, 0, 843, 0, 0, 0, 0, 0, 313, 461, 878, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 725, 0, 0, 0, 59, 0, 32, 0,
+  0, 0, 0, 351, 748, 11, 0, 0, 0, 0, 696, 716, 0, 0, 1, 591,
+  0, 808, 418, 0, 0, 0, 0, 949, 0, 0, 0, 652, 0, 751, 554, 731,
+  0, 0, 0, 137, 167, 439, 896, 0, 0, 0, 0, 0, 29, 750, 0, 0,
+  0, 0, 0, 0, 887, 286, 0, 0, 380, 647, 0, 0, 231, 300, 701, 800,
+  0, 657, 826, 0, 0, 0, 438, 688, 0, 0, 862, 116, 0, 0, 987, 790,
+  440, 0, 0, 0, 82, 855, 0, 0, 0, 0, 347, 484, 0, 31, 788, 867,
+  0, 223, 462, 925, 0, 165, 0, 929, 0, 0, 410, 0, 16, 0, 0, 0,
+  0, 0, 429, 0, 0, 0, 812, 513, 713, 0, 0, 244, 589, 458, 654, 909,
+  301, 649, 0, 0, 0, 0, 0, 492, 40, 499, 942, 0, 0, 0, 0, 483,
+  558, 0, 0, 763, 0, 0, 0, 0, 0, 373, 727, 66, 732, 0, 172, 547,
+  645, 409, 562, 824, 175, 71, 973, 262, 156, 0, 0, 60, 967, 0, 5, 44,
+  491, 796, 0, 180, 0, 573, 692, 0, 0, 729, 590, 360, 892, 140, 0, 121,
+  0, 467, 832, 0, 0, 0, 0, 893, 476, 523, 728, 983, 0, 10, 962, 0,
+  551, 0, 0, 0, 0, 0, 0, 307, 349, 0, 58, 0, 0, 227, 268, 0,
+  0, 602, 0, 441, 0, 54, 0, 490, 84, 970, 133, 238, 0, 0, 0, 902,
+  0, 308, 664, 0, 0, 0, 0, 235, 0, 0, 43, 0, 0, 0, 0, 707,
+  0, 0, 0, 0, 171, 122, 922, 0, 606, 0, 0, 0, 0, 0, 971, 0,
+  0, 0, 631, 0, 0, 0, 168, 0, 0, 0, 0, 0, 0, 712, 0, 667,
+  0, 8, 447, 375, 0, 0, 0, 0, 0, 188, 208, 383, 772, 877, 0, 860,
+  921, 723, 595, 0, 0, 0, 0, 587, 0, 0, 0, 0, 452, 341, 33, 0,
+  113, 0, 160, 0, 0, 528, 0, 0, 522, 0, 456, 0, 237, 0, 0, 115,
+  0, 20, 560, 0, 0, 0, 886, 4, 0, 0, 45, 0, 187, 0, 0, 0,
+  679, 463, 176, 359, 870, 984, 755, 0, 270, 0, 0, 252, 0, 0, 130, 0,
+  0, 494, 352, 387, 0, 0, 0, 249, 0, 0, 0, 34, 267, 230, 650, 0,
+  120, 549, 345, 395, 912, 914, 1000, 0, 0, 0, 318, 0, 0, 0, 282, 63,
+  0, 534, 818, 507, 233, 0, 0, 0, 813, 0, 0, 0, 0, 0, 496, 22,
+  0, 0, 0, 141, 0, 0, 0, 686, 298, 0, 0, 0, 18, 472, 544, 0,
+  0, 0, 0, 425, 0, 0, 0, 0, 0, 0, 346, 0, 0, 0, 320, 673,
+  600, 448, 601, 911, 0, 0, 0, 622, 0, 0, 0, 358, 656, 505, 700, 574,
+  985, 677, 0, 0, 899, 442, 0, 0, 0, 0, 245, 0, 581, 247, 479, 0,
+  882, 948, 517, 945, 24, 91, 0, 0, 0, 0, 0, 0, 0, 17, 810, 0,
+  265, 636, 0, 0, 0, 0, 0, 695, 0, 203, 0, 0, 229, 338, 471, 135,
+  348, 618, 621, 393, 0, 0, 0, 959, 0, 0, 232, 93, 0, 259, 0, 0,
+  0, 0, 477, 822, 0, 0, 444, 0, 67, 0, 873, 0, 290, 0, 162, 350,
+  913, 0, 749, 0, 0, 0, 0, 294, 353, 0, 0, 0, 0, 50, 367, 0,
+  434, 372, 666, 675, 0, 0, 3, 0, 125, 273, 276, 288, 538, 0, 0, 850,
+  25, 255, 918, 0, 356, 906, 935, 414, 384, 466, 565, 0, 0, 0, 310, 0,
+  974, 0, 690, 0, 816, 0, 271, 0, 0, 0, 0, 0, 0, 0, 705, 236,
+  459, 720, 817, 599, 718, 0, 0, 0, 0, 0, 938, 0, 0, 0, 0, 835,
+  0, 0, 0, 0, 0, 0, 0, 868, 0, 0, 0, 0, 0, 0, 0, 330,
+  426, 0, 582, 158, 119, 0, 803, 0, 0, 597, 769, 0, 0, 0, 0, 0,
+  51, 184, 0, 108, 277, 0, 593, 0, 0, 0, 0, 7, 992, 0, 578, 780,
+  0, 926, 978, 709, 954, 0, 0, 0, 431, 0, 0, 0, 842, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 21, 28, 0, 0, 0, 0, 0, 0, 846,
+  0, 0, 924, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 550, 629, 0,
+  368, 633, 864, 264, 937, 989, 0, 0, 995, 0, 0, 0, 0, 0, 0, 506,
+  159, 889, 0, 0, 0, 0, 0, 0, 0, 584, 0, 719, 0, 775, 814, 0,
+  0, 997, 0, 0, 0, 0, 0, 102, 535, 445, 608, 823, 0, 0, 0, 0,
+  118, 604, 0, 0, 0, 0, 0, 885, 897, 0, 598, 0, 428, 0, 0, 183,
+  0, 0, 0, 641, 0, 0, 0, 724, 339, 537, 234, 986, 27, 241, 972, 0,
+  68, 0, 952, 890, 430, 501, 365, 296, 634, 527, 0, 379, 0, 0, 665, 0,
+  0, 64, 361, 497, 169, 0, 381, 0, 0, 0, 0, 735, 0, 209, 0, 588,
+  0, 851, 0, 0, 450, 0, 482, 0, 72, 280, 333, 777, 0, 0, 340, 789,
+  396, 674, 845, 996, 0, 0, 830, 0, 225, 317, 468, 857, 0, 0, 302, 734,
+  337, 0, 104, 131, 306, 943, 0, 0, 287, 0, 0, 0, 297, 553, 0, 0,
+  0, 0, 0, 283, 982, 0, 0, 0, 0, 0, 0, 0, 228, 900, 0, 406,
+  543, 161, 697, 710, 111, 200, 0, 0, 126, 324, 0, 443, 0, 964, 0, 0,
+  669, 0, 0, 0, 295, 0, 0, 239, 0, 0, 177, 132, 0, 0, 218, 542,
+  489, 975, 651, 0, 0, 404, 0, 0, 0, 0, 0, 0, 871, 362, 0, 0,
+  376, 859, 0, 0, 354, 0, 0, 6, 109, 391, 883, 0, 0, 827, 920, 0,
+  0, 152, 993, 0, 0, 0, 0, 0, 0, 0, 78, 0, 966, 0, 0, 852,
+  386, 0, 0, 0, 424, 923, 182, 743, 303, 202, 524, 998, 0, 0, 617, 624,
+  804, 0, 0, 369, 0, 766, 134, 0, 0, 0, 0, 193, 779, 15, 148, 757,
+  711, 874, 567, 894, 0, 74, 0, 689, 858, 0, 968, 785, 0, 0, 508, 0,
+  0, 0, 0, 0, 0, 312, 0, 0, 0, 0, 0, 114, 0, 0, 455, 866,
+  0, 0, 0, 793, 0, 105, 197, 403, 0, 0, 904, 678, 0, 760, 0, 0,
+  0, 658, 0, 0, 0, 451, 503, 526, 838, 0, 210, 0, 41, 0, 173, 771,
+  256, 805, 0, 0, 0, 246, 548, 0, 738, 0, 0, 0, 0, 0, 86, 0,
+  0, 242, 0, 480, 42, 0, 0, 836, 0, 655, 744, 722, 784, 0, 0, 37,
+  0, 0, 57, 847, 0, 0, 687, 910, 969, 0, 610, 0, 0, 224, 540, 635,
+  685, 980, 0, 0, 853, 0, 0, 314, 323, 895, 0, 0, 144, 516, 0, 0,
+  0, 284, 454, 147, 417, 648, 0, 77, 343, 498, 0, 0, 0, 272, 0, 0,
+  0, 103, 394, 153, 905, 999, 0, 991, 0, 770, 0, 151, 0, 36, 221, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 941, 861, 0, 422, 457,
+  179, 311, 0, 0, 0, 0, 0, 142, 568, 698, 0, 377, 469, 257, 934, 12,
+  55, 0, 0, 488, 145, 195, 612, 758, 815, 0, 342, 154, 117, 274, 53, 435,
+  605, 768, 0, 0, 0, 0, 0, 0, 0, 0, 979, 0, 834, 0, 792, 0,
+  0, 0, 0, 856, 0, 0, 0, 196, 0, 138, 0, 0, 932, 0, 0, 0,
+  0, 0, 0, 756, 0, 35, 219, 747, 0, 289, 149, 0, 609, 211, 603, 364,
+  0, 46, 819, 0, 328, 580, 619, 0, 292, 146, 737, 0, 0, 0, 0, 811,
+  564, 837, 0, 0, 0, 0, 0, 0, 865, 94, 0, 319, 0, 0, 0, 199,
+  62, 0, 415, 0, 0, 917, 0, 0, 0, 0, 0, 0, 0, 139, 427, 495,
+  714, 0, 0, 500, 0, 0, 0, 402, 0, 299, 411, 423, 746, 821, 261, 334,
+  640, 745, 831, 464, 844, 0, 278, 703, 0, 585, 191, 0, 407, 583, 0, 100,
+  127, 502, 0, 0, 572, 884, 965, 0, 89, 0, 99, 110, 166, 0, 529, 0,
+  335, 950, 220, 0, 0, 0, 0, 0, 0, 704, 802, 0, 0, 782, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 226, 662, 0, 0, 0, 129, 56, 212, 536,
+  0, 174, 178, 566, 250, 699, 81, 880, 0, 0, 181, 279, 14, 332, 510, 898,
+  0, 0, 432, 95, 0, 0, 433, 322, 0, 684, 0, 0, 0, 0, 638, 198,
+  254, 672, 681, 753, 0, 569, 0, 0, 266, 702, 325, 164, 269, 872, 486, 0,
+  0, 0, 741, 192, 693, 820, 0, 19, 0, 927, 85, 163, 485, 87, 577, 990,
+  217, 0, 392, 0, 0, 327, 0, 240, 630, 0, 389, 222, 398, 38, 919, 0,
+  0, 0, 663, 767, 988, 0, 668, 0, 355, 0, 0, 0, 0, 0, 0, 207,
+  79, 420, 586, 637, 0, 0, 0, 473, 70, 511, 795, 944, 0, 0, 916, 0,
+  561, 0, 0, 0, 863, 0, 0, 0, 0, 0, 0, 981, 0, 96, 215, 632,
+  0, 0, 0, 519, 628, 742, 0, 0, 0, 0, 0, 478, 570, 205, 399, 260,
+};
+
+const char *WA_FREQ_173_TOKENS[] = {
+  "ku",
+  "hi",
+  "a",
+  "va",
+  "ya",
+  "na",
+  "wa",
+  "nga",
+  "ka",
+  "ta",
+  "eka",
+  "leswaku",
+  "ni",
+  "swi",
+  "ri",
+  "u",
+  "Xikwembu",
+  "yi",
+  "ra",
+  "xa",
+  "leswi",
+  "swa",
+  "yena",
+  "xi",
+  "vona",
+  "lava",
+  "Yesu",
+  "Hi",
+  "wu",
+  "leyi",
+  "loko",
+  "le",
+  "A",
+  "vanhu",
+  "hina",
+  "bya",
+  "yo",
+  "lowu",
+  "ti",
+  "i",
+  "ndzi",
+  "endla",
+  "e",
+  "loyi",
+  "kambe",
+  "kona",
+  "fanele",
+  "kutani",
+  "leri",
+  "wena",
+  "Loko",
+  "laha",
+  "lexi",
+  "ha",
+  "Ku",
+  "wo",
+  "munhu",
+  "nkarhi",
+  "no",
+  "tala",
+  "emahlweni",
+  "n’wi",
+  "kumbe",
+  "Kutani",
+  "U",
+  "swinene",
+  "swo",
+  "vutomi",
+  "ndlela",
+  "swona",
+  "hikuva",
+  "ma",
+  "matimba",
+  "mfumo",
+  "Hosi",
+  "mina",
+  "xona",
+  "nyika",
+  "sungula",
+  "kuma",
+  "I",
+  "lawa",
+  "leti",
+  "la",
+  "n'wi",
+  "tiko",
+  "hinkwavo",
+  "Eka",
+  "mi",
+  "naswona",
+  "vula",
+  "byi",
+  "yona",
+  "Kambe",
+  "ntirho",
+  "kota",
+  "fana",
+  "Xana",
+  "hinkwaswo",
+  "kahle",
+  "tlhela",
+  "nkoka",
+  "Leswi",
+  "eku",
+  "tani",
+  "yini",
+  "Va",
+  "misava",
+  "lembe",
+  "malembe",
+  "ro",
+  "to",
+  "karhi",
+  "tiva",
+  "n’wana",
+  "wona",
+  "Afrika",
+  "tirha",
+  "lebyi",
+  "vana",
+  "xo",
+  "swilo",
+  "1.",
+  "Xi",
+  "siku",
+  "lama",
+  "2.",
+  "xiyimo",
+  "tlula",
+  "vo",
+  "mhaka",
+  "ntsena",
+  "pfuna",
+  "henhla",
+  "loku",
+  "fika",
+  "hikwalaho",
+  "n'wana",
+  "Xifaniso",
+  "mintirho",
+  "ngopfu",
+  "vulavula",
+  "Ndzi",
+  "dyondzo",
+  "3.",
+  "humelela",
+  "amukela",
+  "nge",
+  "famba",
+  "Dzonga",
+  "ntiyiso",
+  "hanya",
+  "moya",
+  "tshama",
+  "huma",
+  "tirhisa",
+  "teka",
+  "hinkwayo",
+  "hosi",
+  "Yena",
+  "ikhonomi",
+  "kombisa",
+  "suka",
+  "hambi",
+  "ko",
+  "rhandza",
+  "byela",
+  "rixaka",
+  "mali",
+  "mati",
+  "Kriste",
+  "byo",
+  "pfumela",
+  "se",
+  "fikelela",
+  "lowo",
+  "hundza",
+  "exikarhi",
+  "Kreste",
+  "4.",
+  "aku",
+  "marito",
+  "tiyisisa",
+  "katsa",
+  "sweswi",
+  "nawu",
+  "yisa",
+  "Moya",
+  "komba",
+  "matiko",
+  "un’wana",
+  "hambana",
+  "heriki",
+  "xana",
+  "aka",
+  "nghena",
+  "hlayisa",
+  "tanihi",
+  "biha",
+  "Hikwalaho",
+  "kombela",
+  "nchumu",
+  "twa",
+  "Swi",
+  "endzhaku",
+  "ehansi",
+  "vatirhi",
+  "Vanhu",
+  "endlaka",
+  "swidyoho",
+  "5.",
+  "rito",
+  "van’wana",
+  "ke",
+  "kuya",
+  "sweswo",
+  "Mfumo",
+  "ehenhla",
+  "mani",
+  "Tatana",
+  "antswisa",
+  "hinkwawo",
+  "rona",
+  "faneleke",
+  "hlula",
+  "mitirho",
+  "xiyenge",
+  "Rixaka",
+  "etikweni",
+  "handle",
+  "taka",
+  "vaaki",
+  "wansati",
+  "khale",
+  "tumbuluxa",
+  "hava",
+  "nakambe",
+  "cinca",
+  "tshemba",
+  "vadyondzisiwa",
+  "2014",
+  "kulu",
+  "kwetsima",
+  "chava",
+  "dyondzisa",
+  "ringana",
+  "hansi",
+  "hlangana",
+  "khongela",
+  "kula",
+  "veka",
+  "vuswikoti",
+  "sukela",
+  "6.",
+  "Afrika-Dzonga",
+  "tidyondzo",
+  "mahungu",
+  "nwi",
+  "Comments",
+  "Off",
+  "ripfumelo",
+  "Israele",
+  "tano",
+  "tirhela",
+  "ve",
+  "Pawulo",
+  "nuna",
+  "emisaveni",
+  "languta",
+  "masiku",
+  "yingisa",
+  "lavaka",
+  "vito",
+  "landzelaka",
+  "si",
+  "swakudya",
+  "Rito",
+  "fa",
+  "timhaka",
+  "switirhisiwa",
+  "mbilu",
+  "rhula",
+  "rifu",
+  "hlamula",
+  "twisisa",
+  "Muxe",
+  "endleke",
+  "hlaya",
+  "vukorhokeri",
+  "swirho",
+  "Na",
+  "Nawu",
+  "endlile",
+  "gezi",
+  "misaveni",
+  "nhluvukiso",
+  "swin’wana",
+  "mayelana",
+  "hinkwato",
+  "milawu",
+  "ndhawu",
+  "n’wina",
+  "swiyimo",
+  "Xona",
+  "tirhisiwa",
+  "minkarhi",
+  "rirhandzu",
+  "tava",
+  "tintswalo",
+  "Xitsonga",
+  "miri",
+  "tindlela",
+  "tlhelo",
+  "ari",
+  "ponisiwa",
+  "vumbirhi",
+  "Israel",
+  "antswa",
+  "gandzela",
+  "hlamusela",
+  "hundzeke",
+  "khoma",
+  "rin’wana",
+  "vugevenga",
+  "Hikuva",
+  "leswo",
+  "te",
+  "tisa",
+  "vavasati",
+  "endliwa",
+  "fikela",
+  "mabindzu",
+  "mahlo",
+  "navela",
+  "nhlangano",
+  "timali",
+  "tindhawu",
+  "wanuna",
+  "xifaniso",
+  "Mintirho",
+  "Nhlangano",
+  "khensa",
+  "kuva",
+  "leha",
+  "ntlhanu",
+  "seketela",
+  "xin’wana",
+  "dlaya",
+  "fanela",
+  "landza",
+  "lwa",
+  "mamiliyoni",
+  "tlakusa",
+  "anga",
+  "lo",
+  "masungulo",
+  "vuya",
+  "Endzhaku",
+  "riki",
+  "vile",
+  "xikombiso",
+  "Ta",
+  "dyondza",
+  "engetela",
+  "nhlayo",
+  "tata",
+  "yindlu",
+  "yin’wana",
+  "7.",
+  "endleka",
+  "kasi",
+  "tona",
+  "un'wana",
+  "N’wana",
+  "xiphemu",
+  "Dyondzo",
+  "Phuresidente",
+  "Siku",
+  "Yohane",
+  "ava",
+  "endlela",
+  "hetelela",
+  "tikweni",
+  "yima",
+  "matsalwa",
+  "mpfuneto",
+  "namuntlha",
+  "xikombelo",
+  "Nhluvukiso",
+  "endle",
+  "mfanelo",
+  "dya",
+  "landzelela",
+  "miehleketo",
+  "pfuka",
+  "ponisa",
+  "ringeta",
+  "ririmi",
+  "tshika",
+  "xihatla",
+  "Yosefa",
+  "etilweni",
+  "hakela",
+  "hinkwerhu",
+  "maendlelo",
+  "matimu",
+  "pfumala",
+  "swiyenge",
+  "1",
+  "Wa",
+  "hetiseka",
+  "hlawuleka",
+  "humaka",
+  "nyikela",
+  "nyikiwa",
+  "nyiko",
+  "sungurile",
+  "tile",
+  "tlangela",
+  "tsakela",
+  "vulaka",
+  "Davida",
+  "Ha",
+  "ehleketa",
+  "hunguta",
+  "kereke",
+  "koti",
+  "muganga",
+  "nsati",
+  "tirhisana",
+  "vulawuri",
+  "Misava",
+  "kala",
+  "langutela",
+  "nongonoko",
+  "vantshwa",
+  "vilela",
+  "Bibele",
+  "Yi",
+  "kumeka",
+  "kusuhi",
+  "lulamisa",
+  "nandza",
+  "vavanuna",
+  "vuxaka",
+  "xidemokirasi",
+  "HIV",
+  "ehandle",
+  "saseka",
+  "tika",
+  "xiswona",
+  "Abrahama",
+  "Khabinete",
+  "Ndzawulo",
+  "endlwini",
+  "enhlokweni",
+  "herisa",
+  "minhlangano",
+  "muti",
+  "nyimpi",
+  "tekela",
+  "8.",
+  "Matimu",
+  "Yuda",
+  "hela",
+  "hundzuka",
+  "kumile",
+  "migingiriko",
+  "nghenelela",
+  "ntumbuluko",
+  "tilweni",
+  "tivisa",
+  "vudyoho",
+  "000",
+  "SAQA",
+  "Vanghana",
+  "Yobo",
+  "ekaya",
+  "hilaha",
+  "hinkwaro",
+  "kaya",
+  "malandza",
+  "mbirhi",
+  "swilaveko",
+  "swipimelo",
+  "tsaka",
+  "varhangeri",
+  "xikolo",
+  "Laha",
+  "Mariya",
+  "Ntirho",
+  "erivaleni",
+  "hanyaka",
+  "hanyisa",
+  "matirhelo",
+  "mavoko",
+  "mpimo",
+  "risima",
+  "tatana",
+  "vi",
+  "vuriwa",
+  "xava",
+  "xiboho",
+  "2011",
+  "2013",
+  "Hikokwalaho",
+  "Lembe",
+  "Naswona",
+  "kwalaho",
+  "kwalomu",
+  "ndyangu",
+  "ndzilo",
+  "ngati",
+  "tin’wana",
+  "vutihlamuleri",
+  "xikhongelo",
+  "xikongomelo",
+  "10.",
+  "AIDS",
+  "Hambi",
+  "Tani",
+  "hikokwalaho",
+  "kuri",
+  "mademona",
+  "rin'wana",
+  "tsakisa",
+  "tsundzuka",
+  "vutisa",
+  "2",
+  "Munhu",
+  "Samuel",
+  "huwelela",
+  "khume",
+  "murhangeri",
+  "nwana",
+  "swin’we",
+  "vadyondzi",
+  "vonakala",
+  "yile",
+  "Kwetsima",
+  "Mandela",
+  "Nhlayo",
+  "Ni",
+  "fuma",
+  "hlamarisa",
+  "leyo",
+  "mbuyelo",
+  "mune",
+  "nhloko",
+  "nyama",
+  "timfanelo",
+  "vu",
+  "vumbhoni",
+  "vusweti",
+  "wun’wana",
+  "xivangelo",
+  "endlelo",
+  "lulama",
+  "mahlori",
+  "miganga",
+  "ntwanano",
+  "sirhelela",
+  "timbilu",
+  "tiyisa",
+  "vonile",
+  "Petru",
+  "endzeni",
+  "feni",
+  "hlanganisa",
+  "hlawula",
+  "kurisa",
+  "landzela",
+  "lavo",
+  "makungu",
+  "nandzu",
+  "ntsumi",
+  "rila",
+  "tsandzeka",
+  "valala",
+  "vitana",
+  "vonaka",
+  "vutivi",
+  "Hambiswiritano",
+  "Varhoma",
+  "hoxa",
+  "humesa",
+  "lamanene",
+  "mbewu",
+  "minongonoko",
+  "ndlala",
+  "nhlengeletano",
+  "olova",
+  "onge",
+  "pfhumba",
+  "pfula",
+  "tinxaka",
+  "vanghana",
+  "wolowo",
+  "yimela",
+  "11.",
+  "Lexi",
+  "Swa",
+  "Tiko",
+  "Vumbiwa",
+  "kule",
+  "matshalatshala",
+  "mihandzu",
+  "pfuneta",
+  "rhangela",
+  "rhumela",
+  "tiphurojeke",
+  "vumaki",
+  "xikan’we",
+  "10",
+  "1994",
+  "9.",
+  "Daniel",
+  "Xa",
+  "hlongola",
+  "khomiwa",
+  "kotaka",
+  "kumekaka",
+  "kwala",
+  "mafambiselo",
+  "n'wina",
+  "sisiteme",
+  "susa",
+  "tekile",
+  "tingana",
+  "tivi",
+  "tlhelela",
+  "tsariwa",
+  "20",
+  "Egypta",
+  "Tanihi",
+  "fanelaka",
+  "kwihi",
+  "nharhu",
+  "swifaniso",
+  "vumbiwa",
+  "xidyoho",
+  "xihlawuhlawu",
+  "xikarhi",
+  "12",
+  "2012",
+  "Kasi",
+  "NQF",
+  "dzunisa",
+  "mabiliyoni",
+  "mambirhi",
+  "ntshuxeko",
+  "nyikile",
+  "swikongomelo",
+  "tindzimi",
+  "tiyimisela",
+  "vaakatiko",
+  "2010",
+  "Muhlonipheki",
+  "Xibalo",
+  "ala",
+  "endli",
+  "eneji",
+  "kombisile",
+  "lerisa",
+  "lwandle",
+  "magoza",
+  "mana",
+  "mimoya",
+  "mindyangu",
+  "mintlangu",
+  "ndlandlamuxa",
+  "ntsako",
+  "tiya",
+  "van'wana",
+  "xiviri",
+  "Lava",
+  "Mahungu",
+  "Muponisi",
+  "Nakambe",
+  "Nongonoko",
+  "Swirho",
+  "Tata",
+  "bindzu",
+  "evuton’wini",
+  "file",
+  "hlohlotela",
+  "kongoma",
+  "lero",
+  "ntlangu",
+  "swiboho",
+  "swikolo",
+  "tirhaka",
+  "tswariwa",
+  "voko",
+  "vukhongeri",
+  "vuleteri",
+  "wihi",
+  "yingisela",
+  "Adamu",
+  "Manana",
+  "Xiyimo",
+  "aki",
+  "hetisisa",
+  "makumu",
+  "mfumu",
+  "ntalo",
+  "pfumelela",
+  "pfuxa",
+  "swivilelo",
+  "tshamile",
+  "vuriwaka",
+  "ximoya",
+  "xitulu",
+  "yin’we",
+  "12.",
+  "Aug",
+  "Elisha",
+  "Loyi",
+  "Petro",
+  "dyambu",
+  "endleleni",
+  "fambisa",
+  "hinkwabyo",
+  "homboloka",
+  "humelelaka",
+  "humelerisa",
+  "manharhu",
+  "man’wana",
+  "pfumaleka",
+  "pfumelaka",
+  "rihanyo",
+  "swiphiqo",
+  "swivandla",
+  "teke",
+  "tsundzuxa",
+  "vava",
+  "vuntshwa",
+  "xandla",
+  "xaniseka",
+  "xibalo",
+  "xitori",
+  "xivutiso",
+  "2006",
+  "Genesa",
+  "Mi",
+  "NSB",
+  "Samsoni",
+  "Sathani",
+  "Saul",
+  "Swivilelo",
+  "Vito",
+  "akiwa",
+  "avanyisa",
+  "mahlweni",
+  "ndza",
+  "nghenisa",
+  "ntirhisano",
+  "ntlawa",
+  "sivela",
+  "tele",
+  "tsakelaka",
+  "vanga",
+  "vari",
+  "vatswari",
+  "vitaniwa",
+  "vumunhu",
+  "vuvekisi",
+  "xirho",
+  "18",
+  "Abraama",
+  "Eliya",
+  "Kereke",
+  "Mulavisisi",
+  "Mutshamaxitulu",
+  "Palamende",
+  "Paulo",
+  "Sweswi",
+  "Xipikara",
+  "buku",
+  "fanelanga",
+  "hakelo",
+  "heta",
+  "hluvukisa",
+  "humeleleke",
+  "leswinene",
+  "lonkulu",
+  "maAfrika-Dzonga",
+  "mahala",
+  "maxangu",
+  "ngopfu-ngopfu",
+  "nkateko",
+  "ntsaku",
+  "ntsongo",
+  "nyana",
+  "rivaleriwa",
+  "tsala",
+  "un’we",
+  "voni",
+  "vunharhu",
+  "vurimi",
+  "xikwembu",
+  "xivilelo",
+  "yaka",
+  "E",
+  "Jakobo",
+  "Nehemia",
+  "Vulawuri",
+  "amukerile",
+  "chavi",
+  "hinkwako",
+  "kondza",
+  "lavekaka",
+  "lowukulu",
+  "madzolonga",
+  "mimbuyelo",
+  "nala",
+  "ndzhaku",
+  "ndzhawu",
+  "nyangwa",
+  "nyikaka",
+  "of",
+  "pfuniwa",
+  "rivalela",
+  "sungule",
+  "swikwembu",
+  "vadyondzisi",
+  "vule",
+  "vumba",
+  "vusiku",
+  "xixima",
+  "yisiwa",
+  "11",
+  "14",
+  "Ndza",
+  "Sawulo",
+  "ba",
+  "khutaza",
+  "kongomisa",
+  "lahlekeriwa",
+  "leyintshwa",
+  "mavabyi",
+  "mavonelo",
+  "mintlhontlho",
+  "mphakelo",
+  "mukhuva",
+  "munyama",
+  "ndzhaka",
+  "njhani",
+  "nseketelo",
+  "tshuki",
+  "velekiwa",
+  "wela",
+  "xilaveko",
+  "Evhangeli",
+  "Gidiyoni",
+  "Huvo",
+  "INE",
+  "Matiko",
+  "Mina",
+  "Vayuda",
+  "embilwini",
+  "evutonwini",
+  "exihambanweni",
+  "hambanahambana",
+  "hatlisa",
+  "lavi",
+  "ndzeni",
+  "tekiwa",
+  "tihlanganisa",
+  "timbirhi",
+  "tinyungubyisa",
+  "tirheni",
+  "tiyisela",
+  "veke",
+  "vurhangeri",
+  "vusiwana",
+  "xanisa",
+  "ANC",
+  "ETQA",
+  "Eku",
+  "Giyani",
+  "Holobye",
+  "Mali",
+  "Mhaka",
+  "Nkarhi",
+  "Rhuti",
+  "amukeriwa",
+  "baleka",
+  "byona",
+  "feke",
+  "hlanganaka",
+  "komberile",
+  "kombisaka",
+  "languteni",
+  "masocha",
+  "milenge",
+  "nchavo",
+  "nene",
+  "ntshunxeko",
+  "nyike",
+  "thoriwa",
+  "tindzawulo",
+  "tinyiko",
+  "tivaka",
+  "vhiki",
+  "vurile",
+  "wakwe",
+  "xiku",
+  "xivumbeko",
+  "Dorah",
+  "N'wana",
+  "Ndlela",
+  "Nhlamulo",
+  "Ntlawa",
+  "Xiyenge",
+  "Yoshuwa",
+  "boha",
+  "byala",
+  "dyoho",
+  "emavokweni",
+  "endzela",
+  "hantlisa",
+  "hatlisisa",
+  "hleketa",
+  "khumba",
+  "kunga",
+  "lokukulu",
+  "lwela",
+  "lwisana",
+  "masingita",
+  "munghana",
+  "nghozi",
+  "nhlawulo",
+  "nomu",
+  "ntshikelelo",
+  "nyikiwaka",
+  "papila",
+  "rhandzaka",
+  "sunguleni",
+  "swin'wana",
+  "swisiwana",
+  "tihakelo",
+  "tihosi",
+  "tiphina",
+  "tiyimela",
+  "tlhele",
+  "tshamaka",
+  "tumbuluxiwa",
+  "vandla",
+  "vanuna",
+  "vuhlayiseki",
+  "vuli",
+  "vuvabyi",
+  "ximfumo",
+  "17",
+  "Languta",
+  "Luka",
+  "SARS",
+  "Van’wana",
+  "Vona",
+  "goza",
+  "hakona",
+  "hari",
+  "katekisa",
+  "langutana",
+  "languteka",
+  "lerisile",
+  "lulameke",
+  "masipala",
+  "mu",
+  "nkulu",
+  "rivoni",
+  "sala",
+  "sathana",
+  "simeka",
+  "swivutiso",
+  "tlakuka",
+  "vapfumeri",
+  "vuxokoxoko",
+  "xiphiqo",
+  "yexe",
+  "6",
+  "7",
+  "Hiloko",
+  "Hinkwerhu",
+  "Mukreste",
+  "Ri",
+  "Sep",
+  "TA",
+  "VAHLAYI",
+  "Vaholobye",
+  "Vantshwa",
+  "Yonasi",
+  "avelana",
+  "endliwile",
+  "etlhelo",
+  "fela",
+  "hambana-hambana",
+  "ivi",
+  "kambela",
+};
+const uint16_t WA_FREQ_173_RANKS[] = {
+  0, 0, 0, 273, 0, 392, 676, 826, 451, 0, 102, 0, 0, 335, 0, 0,
+  871, 0, 434, 274, 750, 304, 429, 875, 0, 0, 0, 654, 602, 688, 0, 0,
+  0, 0, 0, 329, 0, 998, 0, 0, 0, 182, 114, 414, 639, 279, 66, 509,
+  698, 0, 281, 510, 0, 0, 232, 241, 0, 0, 0, 0, 0, 876, 0, 0,
+  0, 0, 192, 0, 377, 825, 0, 0, 0, 0, 452, 528, 0, 399, 0, 0,
+  0, 157, 458, 675, 0, 239, 0, 0, 0, 290, 223, 0, 0, 849, 983, 0,
+  0, 0, 0, 0, 0, 0, 663, 677, 0, 0, 0, 0, 0, 0, 365, 0,
+  0, 162, 0, 671, 0, 828, 0, 742, 0, 0, 0, 0, 686, 338, 315, 569,
+  0, 0, 0, 73, 867, 0, 0, 970, 0, 524, 228, 14, 0, 367, 42, 2,
+  374, 271, 129, 667, 567, 292, 0, 0, 0, 0, 0, 0, 167, 0, 0, 0,
+  0, 0, 927, 0, 0, 198, 606, 850, 0, 0, 0, 517, 0, 0, 0, 0,
+  0, 0, 76, 877, 0, 0, 0, 312, 0, 402, 0, 616, 673, 0, 655, 657,
+  0, 0, 646, 926, 711, 164, 0, 410, 0, 0, 0, 0, 701, 196, 427, 699,
+  800, 391, 145, 852, 767, 322, 547, 941, 0, 0, 0, 0, 289, 0, 0, 492,
+  203, 440, 260, 645, 805, 0, 0, 0, 625, 0, 0, 0, 0, 0, 0, 0,
+  0, 175, 0, 544, 0, 0, 0, 526, 0, 358, 0, 521, 0, 0, 0, 0,
+  0, 327, 0, 545, 887, 0, 0, 770, 360, 85, 756, 0, 64, 373, 437, 533,
+  697, 672, 0, 0, 0, 0, 460, 0, 0, 0, 0, 0, 0, 575, 0, 222,
+  593, 0, 384, 0, 0, 0, 0, 249, 0, 0, 0, 0, 283, 264, 724, 886,
+  0, 0, 0, 0, 520, 0, 0, 0, 715, 0, 63, 888, 7, 108, 0, 0,
+  0, 0, 0, 0, 320, 630, 955, 461, 0, 0, 0, 0, 230, 498, 116, 291,
+  0, 0, 478, 0, 68, 240, 0, 615, 0, 534, 879, 0, 105, 0, 0, 581,
+  0, 513, 413, 842, 0, 0, 341, 0, 0, 777, 872, 0, 0, 0, 0, 0,
+  0, 0, 626, 31, 990, 0, 0, 205, 170, 0, 0, 950, 0, 0, 977, 0,
+  0, 666, 0, 0, 0, 336, 979, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  874, 0, 0, 44, 0, 82, 0, 0, 559, 0, 0, 0, 0, 0, 0, 161,
+  51, 0, 0, 932, 0, 958, 0, 516, 49, 0, 0, 0, 212, 0, 0, 448,
+  0, 0, 868, 3, 614, 832, 237, 597, 0, 0, 0, 693, 0, 45, 343, 511,
+  709, 0, 486, 0, 0, 0, 0, 579, 818, 0, 0, 356, 0, 911, 313, 0,
+  759, 0, 0, 681, 0, 0, 0, 0, 0, 830, 470, 350, 204, 591, 0, 442,
+  648, 0, 620, 70, 285, 0, 188, 0, 0, 0, 0, 419, 0, 794, 816, 0,
+  507, 0, 813, 0, 0, 150, 0, 0, 0, 788, 0, 8, 714, 0, 586, 0,
+  428, 0, 363, 739, 168, 0, 0, 762, 0, 503, 595, 0, 912, 95, 480, 495,
+  717, 0, 0, 0, 0, 632, 0, 195, 0, 0, 0, 0, 0, 185, 0, 0,
+  0, 81, 106, 0, 424, 420, 729, 732, 929, 0, 0, 140, 0, 309, 396, 0,
+  0, 134, 889, 0, 293, 407, 25, 482, 891, 381, 0, 847, 0, 0, 457, 103,
+  0, 918, 0, 0, 0, 0, 535, 0, 0, 0, 388, 379, 515, 0, 120, 0,
+  556, 0, 0, 0, 317, 554, 0, 702, 180, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 348, 0, 817, 0, 328, 226, 252, 0, 142, 0, 623, 965,
+  62, 288, 0, 190, 0, 761, 0, 308, 609, 494, 0, 0, 0, 0, 0, 0,
+  0, 0, 565, 430, 0, 0, 0, 0, 0, 0, 34, 118, 422, 583, 0, 0,
+  169, 564, 0, 689, 0, 100, 444, 0, 0, 468, 680, 580, 0, 441, 0, 0,
+  972, 954, 540, 731, 6, 908, 0, 0, 0, 0, 0, 0, 39, 0, 172, 455,
+  364, 156, 652, 974, 0, 126, 514, 0, 900, 0, 52, 0, 914, 306, 662, 307,
+  0, 741, 0, 802, 957, 0, 122, 477, 0, 0, 0, 0, 0, 0, 4, 334,
+  236, 552, 506, 707, 0, 0, 0, 0, 474, 568, 0, 0, 24, 179, 835, 0,
+  244, 508, 426, 885, 0, 0, 0, 0, 0, 0, 0, 90, 286, 0, 0, 627,
+  925, 0, 207, 295, 574, 730, 737, 815, 12, 999, 935, 48, 987, 0, 340, 19,
+  748, 791, 0, 0, 0, 0, 41, 484, 490, 859, 58, 0, 218, 370, 0, 0,
+  940, 966, 0, 0, 278, 819, 843, 0, 0, 259, 311, 546, 0, 459, 989, 0,
+  0, 747, 0, 0, 0, 0, 78, 557, 466, 0, 0, 0, 0, 0, 0, 0,
+  148, 355, 423, 723, 661, 782, 0, 0, 640, 882, 0, 0, 55, 532, 0, 0,
+  0, 0, 0, 178, 0, 803, 0, 0, 0, 0, 0, 0, 500, 560, 633, 883,
+  973, 251, 0, 0, 0, 0, 0, 265, 74, 844, 985, 0, 0, 0, 93, 342,
+  0, 0, 0, 0, 0, 0, 0, 0, 333, 0, 712, 921, 910, 837, 40, 0,
+  0, 525, 276, 206, 0, 0, 0, 0, 660, 760, 801, 726, 735, 378, 438, 933,
+  0, 201, 851, 0, 447, 0, 0, 0, 0, 332, 0, 964, 0, 0, 0, 523,
+  718, 840, 0, 28, 0, 0, 0, 0, 0, 225, 0, 0, 0, 0, 224, 0,
+  617, 978, 443, 527, 0, 189, 0, 0, 0, 359, 763, 30, 919, 0, 159, 243,
+  92, 0, 0, 0, 0, 733, 0, 0, 0, 694, 11, 47, 199, 0, 0, 0,
+  475, 96, 539, 0, 774, 0, 930, 153, 0, 0, 530, 0, 902, 0, 641, 997,
+  0, 0, 386, 572, 963, 0, 644, 0, 0, 0, 0, 0, 0, 349, 0, 0,
+  0, 0, 10, 773, 0, 0, 678, 117, 716, 0, 489, 0, 0, 1000, 704, 0,
+  0, 310, 0, 0, 0, 415, 0, 254, 0, 0, 67, 0, 0, 0, 643, 248,
+  147, 0, 0, 848, 0, 937, 0, 0, 659, 0, 0, 481, 576, 0, 0, 0,
+  0, 0, 0, 488, 0, 0, 0, 740, 0, 181, 0, 0, 197, 896, 582, 588,
+  550, 855, 986, 650, 0, 604, 123, 383, 960, 0, 9, 0, 0, 15, 256, 280,
+  71, 351, 610, 691, 790, 920, 971, 0, 944, 922, 0, 131, 0, 824, 0, 0,
+  807, 0, 907, 938, 0, 0, 0, 326, 796, 808, 325, 0, 0, 0, 0, 258,
+  456, 608, 21, 713, 771, 946, 0, 0, 215, 208, 469, 0, 0, 137, 0, 0,
+  300, 0, 257, 87, 275, 27, 149, 449, 821, 0, 0, 303, 91, 687, 0, 781,
+  943, 0, 462, 267, 745, 0, 0, 0, 398, 573, 799, 0, 531, 736, 61, 346,
+  403, 858, 0, 934, 0, 605, 0, 0, 538, 0, 0, 895, 864, 0, 0, 0,
+  0, 810, 0, 425, 0, 0, 0, 909, 769, 0, 0, 0, 0, 916, 0, 0,
+  0, 928, 353, 789, 695, 337, 727, 0, 0, 135, 0, 0, 282, 394, 776, 797,
+  822, 302, 841, 416, 0, 0, 0, 664, 0, 982, 331, 541, 0, 0, 0, 570,
+  752, 408, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 261, 0, 0, 0,
+  0, 0, 0, 890, 995, 366, 0, 906, 0, 101, 0, 863, 0, 952, 0, 234,
+  905, 0, 393, 870, 0, 0, 0, 263, 0, 0, 768, 0, 431, 324, 446, 0,
+  0, 65, 298, 0, 980, 0, 216, 0, 0, 0, 138, 589, 72, 380, 387, 690,
+  892, 0, 0, 397, 0, 522, 0, 0, 0, 0, 0, 857, 0, 262, 395, 0,
+  99, 121, 233, 612, 795, 0, 0, 29, 0, 734, 0, 0, 0, 0, 0, 418,
+  412, 0, 566, 247, 658, 903, 0, 0, 0, 0, 0, 20, 0, 0, 0, 0,
+  0, 0, 297, 318, 0, 622, 487, 0, 653, 700, 780, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 924, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 961, 354, 0, 1, 0, 0, 0, 0, 0, 0, 0, 529,
+  18, 0, 705, 0, 0, 838, 0, 125, 319, 611, 884, 901, 253, 0, 0, 0,
+  0, 0, 0, 0, 352, 0, 766, 0, 562, 0, 229, 904, 0, 0, 194, 551,
+  598, 0, 0, 0, 0, 0, 0, 242, 0, 721, 0, 0, 0, 594, 553, 409,
+  0, 0, 155, 0, 992, 836, 301, 294, 775, 22, 812, 792, 0, 115, 0, 0,
+  0, 160, 785, 0, 0, 0, 465, 0, 0, 0, 942, 339, 0, 210, 0, 0,
+  16, 0, 719, 128, 211, 0, 0, 89, 0, 0, 0, 0, 0, 193, 0, 584,
+  881, 846, 968, 0, 628, 0, 0, 994, 0, 287, 0, 0, 951, 787, 988, 0,
+  0, 0, 793, 227, 0, 0, 931, 865, 956, 0, 86, 0, 0, 221, 519, 894,
+  53, 866, 0, 853, 0, 0, 0, 0, 798, 97, 953, 0, 656, 166, 220, 861,
+  537, 949, 0, 77, 0, 0, 629, 674, 613, 266, 0, 433, 0, 445, 450, 512,
+  811, 0, 0, 171, 0, 165, 0, 599, 368, 831, 0, 401, 0, 0, 0, 0,
+  0, 0, 499, 0, 0, 0, 0, 0, 0, 141, 917, 246, 0, 88, 784, 898,
+  0, 390, 505, 635, 869, 0, 0, 0, 250, 751, 0, 0, 200, 110, 152, 104,
+  463, 542, 107, 191, 38, 637, 682, 725, 0, 827, 245, 0, 0, 124, 856, 0,
+  0, 0, 0, 421, 651, 685, 0, 587, 0, 0, 0, 0, 0, 0, 0, 969,
+  0, 0, 0, 0, 0, 744, 0, 0, 0, 436, 0, 0, 839, 0, 174, 758,
+  57, 0, 0, 755, 0, 0, 406, 0, 0, 111, 936, 0, 202, 0, 0, 382,
+  0, 32, 0, 43, 833, 649, 0, 54, 209, 665, 0, 0, 323, 0, 0, 0,
+  0, 706, 0, 996, 962, 269, 670, 0, 577, 862, 139, 113, 372, 878, 728, 330,
+  0, 549, 0, 0, 33, 0, 473, 268, 543, 809, 0, 173, 948, 496, 0, 548,
+  0, 967, 0, 0, 0, 0, 0, 0, 345, 344, 0, 0, 0, 0, 0, 0,
+  133, 502, 749, 0, 0, 0, 708, 0, 0, 0, 467, 684, 619, 0, 0, 0,
+  0, 504, 385, 0, 136, 0, 634, 501, 69, 563, 668, 35, 112, 555, 0, 0,
+  585, 592, 453, 476, 493, 913, 0, 814, 0, 144, 183, 746, 0, 0, 0, 435,
+  0, 0, 186, 0, 0, 5, 151, 299, 0, 0, 0, 119, 636, 571, 703, 109,
+  993, 98, 158, 497, 0, 0, 316, 0, 0, 0, 561, 873, 0, 0, 0, 0,
+  975, 177, 536, 757, 845, 692, 439, 783, 899, 976, 945, 235, 765, 696, 984, 642,
+  0, 0, 0, 683, 37, 94, 778, 213, 154, 13, 217, 464, 0, 0, 772, 0,
+  0, 0, 0, 0, 0, 710, 0, 60, 0, 23, 471, 36, 0, 0, 485, 0,
+  607, 753, 56, 176, 0, 0, 0, 786, 0, 0, 0, 0, 897, 284, 754, 0,
+  0, 187, 371, 0, 127, 0, 0, 0, 0, 0, 270, 17, 0, 0, 0, 0,
+  0, 432, 0, 0, 0, 0, 0, 0, 80, 0, 0, 0, 472, 669, 0, 860,
+  0, 0, 923, 0, 0, 0, 231, 0, 0, 0, 0, 722, 779, 0, 603, 0,
+  479, 823, 0, 362, 0, 0, 0, 0, 483, 0, 84, 0, 0, 0, 321, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 820, 0, 0, 296, 0, 0, 0,
+  305, 518, 578, 939, 558, 743, 959, 0, 79, 0, 0, 0, 764, 0, 0, 0,
+  0, 0, 454, 361, 143, 806, 163, 804, 404, 369, 647, 26, 132, 130, 277, 219,
+  601, 991, 0, 46, 214, 400, 0, 0, 0, 947, 238, 0, 0, 0, 357, 0,
+  0, 75, 255, 618, 621, 50, 417, 631, 829, 854, 0, 0, 0, 679, 0, 146,
+  834, 0, 0, 0, 0, 272, 491, 0, 0, 0, 0, 83, 389, 405, 184, 0,
+  0, 0, 0, 314, 981, 0, 590, 0, 0, 893, 0, 915, 0, 375, 347, 411,
+  738, 880, 376, 624, 638, 720, 0, 596, 0, 0, 0, 0, 0, 600, 59, 0,
+};
+
+const char *WA_FREQ_174_TOKENS[] = {
+  "һәм",
+  "белән",
+  "да",
+  "дип",
+  "дә",
+  "өчен",
+  "бу",
+  "буенча",
+  "ул",
+  "бер",
+  "Бу",
+  "татар",
+  "ук",
+  "иде",
+  "Татарстан",
+  "булган",
+  "турында",
+  "ТР",
+  "итә",
+  "ел",
+  "үз",
+  "кеше",
+  "зур",
+  "хәбәр",
+  "түгел",
+  "бар",
+  "Казан",
+  "булып",
+  "алып",
+  "бик",
+  "гына",
+  "елда",
+  "Ул",
+  "генә",
+  "аның",
+  "инде",
+  "беренче",
+  "шулай",
+  "кирәк",
+  "итеп",
+  "торган",
+  "яңа",
+  "күп",
+  "кадәр",
+  "иң",
+  "дигән",
+  "әлеге",
+  "башка",
+  "алар",
+  "ике",
+  "арасында",
+  "тиеш",
+  "соң",
+  "Бүген",
+  "шул",
+  "булды",
+  "дәүләт",
+  "белдерде",
+  "ди",
+  "Россия",
+  "вакытта",
+  "итү",
+  "итте",
+  "була",
+  "ә",
+  "каршы",
+  "эш",
+  "Русия",
+  "диде",
+  "кабул",
+  "Ә",
+  "мең",
+  "узган",
+  "тәкъдим",
+  "тора",
+  "исә",
+  "башлыгы",
+  "халык",
+  "төрле",
+  "Аның",
+  "милли",
+  "юк",
+  "Шулай",
+  "елның",
+  "республика",
+  "караганда",
+  "хезмәт",
+  "аны",
+  "ярдәм",
+  "килгән",
+  "Казанда",
+  "бүген",
+  "артык",
+  "тагын",
+  "ала",
+  "балалар",
+  "булачак",
+  "Алар",
+  "иткән",
+  "билгеләп",
+  "югары",
+  "кебек",
+  "килә",
+  "без",
+  "мөмкин",
+  "бара",
+  "икән",
+  "яхшы",
+  "тарафыннан",
+  "эшләр",
+  "барлык",
+  "Әлеге",
+  "тыш",
+  "дәвам",
+  "әле",
+  "та",
+  "Дәүләт",
+  "авыл",
+  "тә",
+  "төп",
+  "Татарстанда",
+  "булса",
+  "анда",
+  "Рөстәм",
+  "Татар",
+  "аларның",
+  "көнне",
+  "матбугат",
+  "Әмма",
+  "тапкыр",
+  "юл",
+  "шәһәр",
+  "үтте",
+  "хәл",
+  "Шул",
+  "алган",
+  "сум",
+  "җитәкчесе",
+  "шушы",
+  "буларак",
+  "икенче",
+  "безнең",
+  "саны",
+  "урнашкан",
+  "акча",
+  "берсе",
+  "күрә",
+  "бәйле",
+  "Без",
+  "якын",
+  "килеп",
+  "эшли",
+  "белем",
+  "бит",
+  "туры",
+  "алу",
+  "елга",
+  "Татарстанның",
+  "саклау",
+  "Анда",
+  "туган",
+  "баш",
+  "махсус",
+  "булырга",
+  "эшләре",
+  "хезмәте",
+  "хәзер",
+  "урынбасары",
+  "министры",
+  "итәргә",
+  "Президенты",
+  "ителгән",
+  "1",
+  "хакта",
+  "тәэмин",
+  "соңгы",
+  "яшь",
+  "рәисе",
+  "спорт",
+  "вакытында",
+  "федераль",
+  "берничә",
+  "ил",
+  "уку",
+  "мәгълүмат",
+  "сүз",
+  "бирү",
+  "менә",
+  "нче",
+  "үзенең",
+  "шундый",
+  "муниципаль",
+  "көндә",
+  "тәшкил",
+  "районы",
+  "Мәскәү",
+  "элек",
+  "яки",
+  "кенә",
+  "вәкилләре",
+  "чит",
+  "президенты",
+  "елларда",
+  "Миңнеханов",
+  "Казанның",
+  "аша",
+  "хакында",
+  "булуын",
+  "3",
+  "һәр",
+  "бүгенге",
+  "Түбән",
+  "миллион",
+  "көн",
+  "рәвештә",
+  "район",
+  "аларны",
+  "багышланган",
+  "идарәсе",
+  "министрлыгы",
+  "үзе",
+  "социаль",
+  "сүзләренә",
+  "мондый",
+  "катнаша",
+  "10",
+  "Шуңа",
+  "үзәге",
+  "хуҗалыгы",
+  "аерым",
+  "булмаган",
+  "чыккан",
+  "Яңа",
+  "2",
+  "сүзләренчә",
+  "бөтен",
+  "нигезендә",
+  "быел",
+  "РФ",
+  "теле",
+  "алды",
+  "мин",
+  "Рөстәм Миңнеханов",
+  "Мин",
+  "буе",
+  "Ләкин",
+  "үк",
+  "хәрби",
+  "ителә",
+  "кайбер",
+  "торак",
+  "алынган",
+  "бергә",
+  "кешеләр",
+  "турындагы",
+  "5",
+  "кала",
+  "фикер",
+  "чыгыш",
+  "гамәлгә",
+  "нинди",
+  "аңа",
+  "вәкиле",
+  "бәйрәм",
+  "Башкортстан",
+  "елдан",
+  "эчендә",
+  "республикада",
+  "районында",
+  "бирә",
+  "таба",
+  "яшьләр",
+  "дөнья",
+  "өч",
+  "мөрәҗәгать",
+  "Хәзер",
+  "булуы",
+  "күбрәк",
+  "саен",
+  "эше",
+  "урын",
+  "килде",
+  "узды",
+  "халыкара",
+  "20",
+  "ничек",
+  "билгеле",
+  "булыр",
+  "итәчәк",
+  "Узган",
+  "бала",
+  "игътибар",
+  "карата",
+  "4",
+  "мәдәният",
+  "тик",
+  "әмма",
+  "кысаларында",
+  "биредә",
+  "Моннан",
+  "республиканың",
+  "чаралар",
+  "кына",
+  "өлкәсендә",
+  "игълан",
+  "вакыт",
+  "безгә",
+  "елгы",
+  "су",
+  "рәсми",
+  "әйтте",
+  "аларга",
+  "калган",
+  "яшәүче",
+  "процентка",
+  "комитеты",
+  "халкы",
+  "Бүгенге",
+  "чөнки",
+  "чыга",
+  "бүлеге",
+  "мөһим",
+  "чыкты",
+  "җавап",
+  "шактый",
+  "Безнең",
+  "татарлар",
+  "мәктәп",
+  "ни",
+  "Чөнки",
+  "Быел",
+  "көтелә",
+  "шәһәре",
+  "Кама",
+  "фикеренчә",
+  "мәгариф",
+  "чаралары",
+  "ителде",
+  "15",
+  "хезмәткәрләре",
+  "иҗат",
+  "тикшерү",
+  "сатып",
+  "бары",
+  "көне",
+  "башлады",
+  "аенда",
+  "алга",
+  "алырга",
+  "ия",
+  "таләп",
+  "АКШ",
+  "ассызыклады",
+  "директоры",
+  "яктан",
+  "хокук",
+  "исемендәге",
+  "бирде",
+  "искә",
+  "2010",
+  "юлы",
+  "җәлеп",
+  "рус",
+  "Россиянең",
+  "30",
+  "идарә",
+  "Идел",
+  "зыян",
+  "барышында",
+  "өлеше",
+  "президент",
+  "сайлау",
+  "алганда",
+  "үстерү",
+  "сәбәпле",
+  "барган",
+  "әлегә",
+  "биргән",
+  "мөселман",
+  "карар",
+  "Хәзерге",
+  "сәнгать",
+  "телен",
+  "катнашты",
+  "җир",
+  "Фәрит",
+  "тиешле",
+  "шәһәрендә",
+  "җирле",
+  "дәвамында",
+  "кире",
+  "6",
+  "Шәймиев",
+  "ясады",
+  "телендә",
+  "очракта",
+  "саный",
+  "лаек",
+  "тормышка",
+  "яши",
+  "кем",
+  "хәзерге",
+  "Республика",
+  "Владимир",
+  "булмый",
+  "7",
+  "аеруча",
+  "нәтиҗәсендә",
+  "эшкә",
+  "медицина",
+  "Республикасы",
+  "процент",
+  "хезмәттәшлек",
+  "яшьлек",
+  "алмый",
+  "км",
+  "төзү",
+  "сәяси",
+  "ачык",
+  "Шушы",
+  "икътисади",
+  "әйтүенчә",
+  "кешенең",
+  "үсеш",
+  "Аларның",
+  "куелган",
+  "һәлак",
+  "үткән",
+  "узачак",
+  "урында",
+  "эшләргә",
+  "Европа",
+  "эчке",
+  "Казанга",
+  "авыр",
+  "алдында",
+  "төбәк",
+  "Бер",
+  "чыгып",
+  "Русиянең",
+  "сәүдә",
+  "Әгәр",
+  "бирелгән",
+  "көннәрдә",
+  "матур",
+  "шәхси",
+  "еллар",
+  "оештыру",
+  "барып",
+  "сәгать",
+  "танылган",
+  "җинаять",
+  "программасы",
+  "8",
+  "ачу",
+  "үзәк",
+  "закон",
+  "тавыш",
+  "барлыкка",
+  "Соңгы",
+  "исәптән",
+  "әйтә",
+  "кергән",
+  "җитәкчеләре",
+  "аз",
+  "нәрсә",
+  "иҗтимагый",
+  "Беренче",
+  "сул",
+  "карамастан",
+  "нефть",
+  "100",
+  "урыс",
+  "мәдәни",
+  "башлап",
+  "елгасының",
+  "эшен",
+  "Халыкара",
+  "эшләп",
+  "нәкъ",
+  "яклау",
+  "барысы",
+  "элекке",
+  "белдерә",
+  "Менә",
+  "Һәм",
+  "Милли",
+  "монда",
+  "12",
+  "Халык",
+  "Минтимер",
+  "сөйләде",
+  "Марат",
+  "бүләк",
+  "күрсәтү",
+  "урта",
+  "моңа",
+  "уртак",
+  "нәтиҗәләре",
+  "Иң",
+  "шуңа",
+  "катнашкан",
+  "ның",
+  "дин",
+  "алдыннан",
+  "актив",
+  "дини",
+  "Сергей",
+  "Советы",
+  "гаилә",
+  "дәрәҗәдә",
+  "уңай",
+  "министрлыгының",
+  "күздә",
+  "рәхмәт",
+  "уза",
+  "9",
+  "дөрес",
+  "Чаллы",
+  "исеме",
+  "тел",
+  "әзер",
+  "мөмкинлеге",
+  "яшәгән",
+  "хәзрәт",
+  "янында",
+  "ләкин",
+  "исемле",
+  "уңаеннан",
+  "ай",
+  "Мәскәүдә",
+  "киткән",
+  "башкорт",
+  "фән",
+  "оешмасы",
+  "Аны",
+  "тарихи",
+  "ислам",
+  "татарча",
+  "чара",
+  "катнашучылар",
+  "тулы",
+  "чын",
+  "Түбән Кама",
+  "тимер",
+  "ял",
+  "Президент",
+  "барлыгы",
+  "алачак",
+  "тулысынча",
+  "хәтта",
+  "Ислам",
+  "булу",
+  "йорт",
+  "үзәгендә",
+  "җитәкчелеге",
+  "оештырылган",
+  "тормыш",
+  "карап",
+  "аннан",
+  "төзелеш",
+  "миллиард",
+  "Биредә",
+  "меңнән",
+  "өстәмә",
+  "Татарстан Республикасы",
+  "аталган",
+  "булганча",
+  "төзелгән",
+  "күрсәтә",
+  "Югары",
+  "Тукай",
+  "итүче",
+  "Русиядә",
+  "мөмкинлек",
+  "11",
+  "шунда",
+  "моны",
+  "саклап",
+  "каралган",
+  "хакимияте",
+  "үзләре",
+  "уңышлы",
+  "бирелә",
+  "авылында",
+  "тышкы",
+  "чагыштырганда",
+  "ярдәме",
+  "эшләгән",
+  "арада",
+  "максаты",
+  "Төркия",
+  "китте",
+  "киләчәктә",
+  "Татар-информ",
+  "ягъни",
+  "көч",
+  "илнең",
+  "Россиядә",
+  "киң",
+  "өченче",
+  "көрәш",
+  "керә",
+  "проценты",
+  "машина",
+  "Мөхәммәтшин",
+  "Александр",
+  "финанс",
+  "Путин",
+  "әйтеп",
+  "бирле",
+  "килгәндә",
+  "даими",
+  "Минтимер Шәймиев",
+  "җитештерү",
+  "күләмендә",
+  "транспорт",
+  "халыкның",
+  "Бөтендөнья",
+  "милләт",
+  "көчле",
+  "башлаган",
+  "чыгару",
+  "күптән",
+  "Азатлык",
+  "газетасы",
+  "25",
+  "күләме",
+  "үткәрү",
+  "эшләү",
+  "Илдар",
+  "үзләренең",
+  "кул",
+  "авылы",
+  "йорты",
+  "Азия",
+  "өлкәсе",
+  "астында",
+  "бәйгесендә",
+  "хакимият",
+  "китә",
+  "Мондый",
+  "кешегә",
+  "илдә",
+  "китап",
+  "исәпкә",
+  "бирергә",
+  "50",
+  "утырышында",
+  "мәчет",
+  "халыкка",
+  "2013",
+  "үзгәрешләр",
+  "Универсиада",
+  "санала",
+  "урынга",
+  "Билгеле",
+  "үзенә",
+  "барды",
+  "үтә",
+  "идем",
+  "Бердәм",
+  "һава",
+  "киләчәк",
+  "тонна",
+  "күз",
+  "эшчәнлеге",
+  "халкының",
+  "Федераль",
+  "уртача",
+  "мәсьәлә",
+  "язылган",
+  "ханым",
+  "районының",
+  "фәнни",
+  "хакы",
+  "театры",
+  "эшне",
+  "улы",
+  "минем",
+  "урыны",
+  "Тик",
+  "ераклыкта",
+  "җитди",
+  "сәламәтлек",
+  "ашыру",
+  "кулга",
+  "14",
+  "биш",
+  "үсеше",
+  "бәйрәме",
+  "әзерлек",
+  "башлый",
+  "Аннан",
+  "әгъзалары",
+  "Елга",
+  "елны",
+  "булдыру",
+  "төркем",
+  "Ак",
+  "проекты",
+  "татарлары",
+  "18",
+  "Эчке",
+  "иткәнчә",
+  "ААҖ",
+  "башында",
+  "арта",
+  "яшьләре",
+  "хәлләр",
+  "заманча",
+  "органнары",
+  "Авыл",
+  "килешү",
+  "кешене",
+  "арасындагы",
+  "АКШта",
+  "нык",
+  "2011",
+  "чыгышында",
+  "генераль",
+  "2008",
+  "үзен",
+  "еш",
+  "калды",
+  "билгеләнгән",
+  "еллык",
+  "киләсе",
+  "16",
+  "халыклар",
+  "дүрт",
+  "Икенче",
+  "ярдәмендә",
+  "торучы",
+  "яңадан",
+  "кызыклы",
+  "Үзәк",
+  "берлеге",
+  "тиз",
+  "Хөкүмәте",
+  "кертү",
+  "тарихы",
+  "2009",
+  "агентлыгы",
+  "эшләүче",
+  "башкарма",
+  "әллә",
+  "мәсьәләләр",
+  "2007",
+  "командасы",
+  "эре",
+  "Медведев",
+  "Дмитрий",
+  "программа",
+  "куллану",
+  "чиратта",
+  "көннәрендә",
+  "өлкә",
+  "2012",
+  "яшәү",
+  "сайлап",
+  "йортында",
+  "бай",
+  "Равил",
+  "студентлар",
+  "оешмалары",
+  "министр",
+  "әзерләү",
+  "13",
+  "оешма",
+  "төркеме",
+  "белгечләр",
+  "андый",
+  "урынны",
+  "юкка",
+  "басым",
+  "кече",
+  "мәртәбә",
+  "сугыш",
+  "очрашу",
+  "тамагы",
+  "халыкны",
+  "гомуми",
+  "баручы",
+  "урынына",
+  "моның",
+  "Мәгариф",
+  "фонды",
+  "карарга",
+  "17",
+  "Елганың",
+  "сез",
+  "хөкем",
+  "турыда",
+  "ягыннан",
+  "озак",
+  "кереп",
+  "диярлек",
+  "бигрәк",
+  "күргән",
+  "атна",
+  "Монда",
+  "ясап",
+  "чакырды",
+  "ярыннан",
+  "2006",
+  "аркасында",
+  "мәктәбе",
+  "канун",
+  "бернинди",
+  "Ике",
+  "мәсьәләсе",
+  "кагылышлы",
+  "Кичә",
+  "сумга",
+  "бөтенләй",
+  "млн",
+  "ителәчәк",
+  "хәрәкәте",
+  "әфәнде",
+  "алдан",
+  "теркәлгән",
+  "Мисс",
+  "эшләрен",
+  "мәгълүм",
+  "шәһәрнең",
+  "40",
+  "нигез",
+  "төзелеше",
+  "мәҗбүр",
+  "май",
+  "кунаклар",
+  "гади",
+  "үзара",
+  "иттеләр",
+  "яза",
+  "театр",
+  "салым",
+  "Җыр-бию",
+  "Бөек",
+  "ясаган",
+  "җыелган",
+  "исемен",
+  "Башкортстанның",
+  "Әлбәттә",
+  "йөри",
+  "проект",
+  "иминлек",
+  "бүлеп",
+  "тота",
+  "чыгу",
+  "атнада",
+  "университеты",
+  "журналистлар",
+  "булсын",
+  "кызы",
+  "хөкүмәт",
+  "тапшыру",
+  "нчы",
+  "тотып",
+  "җиңел",
+  "сорау",
+  "19",
+  "Премьер-министры",
+  "бәя",
+  "Илсур",
+  "Иран",
+  "хәрәкәт",
+  "концерт",
+  "начар",
+  "Мәсәлән",
+  "үткәнчә",
+  "агымдагы",
+  "укырга",
+  "барырга",
+  "изге",
+  "язган",
+  "ага",
+  "тотыла",
+  "Уфада",
+  "мәхкәмә",
+  "арткан",
+  "җәмәгать",
+  "белгечләре",
+  "болай",
+  "карары",
+  "ачылды",
+  "үткәрелә",
+  "итегез",
+  "азык-төлек",
+  "гасыр",
+  "полиция",
+  "системасы",
+  "меңгә",
+  "каршында",
+  "эшләнгән",
+  "Әле",
+  "Нәтиҗәдә",
+  "шуны",
+  "балаларны",
+  "җанисәп",
+  "мәсьәләләре",
+  "вакыты",
+  "арттыру",
+  "шуның",
+  "Башкарма",
+  "рөхсәт",
+  "белдергән",
+  "Казандагы",
+  "куйган",
+  "оешмалар",
+  "кирәкле",
+  "өлешен",
+  "Зур",
+  "Мәдәният",
+  "балалары",
+  "утырышы",
+  "Балалар",
+  "Яшел",
+  "Метшин",
+  "Башкортстанда",
+  "куркыныч",
+  "укучылар",
+  "укучылары",
+  "Алабуга",
+  "ана",
+  "чираттагы",
+  "элемтә",
+  "янгын",
+  "рухи",
+  "территориясендә",
+  "Сез",
+  "җиткерде",
+  "алдына",
+  "электрон",
+  "биреп",
+  "21",
+  "ачылган",
+  "үлгән",
+  "әйтергә",
+  "Министрлар",
+  "комиссиясе",
+  "хата",
+  "катнашу",
+  "Ел",
+  "Яшьләр",
+  "идек",
+  "уен",
+  "бару",
+  "Айрат",
+  "22",
+  "куя",
+  "Татарстанга",
+  "Моңа",
+  "очрашуда",
+  "Моның",
+  "сөт",
+  "чорында",
+  "Кытай",
+  "һөнәри",
+  "ерак",
+  "компаниясе",
+  "күбесе",
+  "сезнең",
+  "Ватан",
+  "якынча",
+  "Әлмәт",
+  "нәтиҗәле",
+  "2002",
+  "дэ",
+  "җәмгыяте",
+  "60",
+  "ясый",
+  "кешеләрнең",
+  "техник",
+  "тапшырды",
+  "һ.б.",
+  "карый",
+  "белә",
+  "бюджет",
+  "үткәрелгән",
+  "безне",
+  "кертелгән",
+  "җыеп",
+  "башта",
+  "хокукларын",
+  "бирелде",
+  "итүгә",
+  "оештырыла",
+  "чарасы",
+  "шартлар",
+  "Хөкүмәт",
+  "24",
+  "Иске",
+  "әгъзасы",
+  "2005",
+  "өйрәнү",
+  "Шәһәр",
+  "вәгъдә",
+  "булмаса",
+};
+const uint16_t WA_FREQ_174_RANKS[] = {
+  785, 955, 998, 0, 0, 0, 0, 0, 342, 304, 471, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 160, 341, 0, 0, 0, 0, 0, 0, 0, 155, 472, 0,
+  0, 0, 885, 0, 0, 0, 603, 0, 0, 0, 0, 0, 0, 794, 0, 0,
+  468, 487, 0, 394, 0, 0, 0, 934, 0, 0, 424, 0, 203, 0, 620, 874,
+  0, 0, 0, 0, 0, 0, 0, 0, 210, 87, 254, 0, 0, 0, 911, 174,
+  0, 0, 0, 273, 527, 596, 0, 0, 295, 912, 0, 0, 0, 406, 665, 0,
+  718, 927, 0, 61, 0, 0, 0, 855, 0, 0, 46, 781, 990, 0, 0, 0,
+  0, 0, 966, 0, 821, 92, 744, 0, 388, 861, 0, 6, 0, 571, 984, 0,
+  896, 0, 711, 0, 723, 720, 531, 843, 24, 344, 992, 0, 434, 202, 486, 570,
+  670, 953, 0, 873, 0, 147, 60, 313, 175, 842, 991, 0, 0, 251, 598, 98,
+  724, 55, 14, 86, 12, 305, 514, 812, 106, 286, 421, 674, 787, 841, 857, 132,
+  0, 0, 0, 0, 0, 0, 0, 384, 0, 782, 0, 0, 0, 0, 0, 360,
+  38, 916, 317, 0, 0, 0, 0, 0, 980, 867, 0, 0, 615, 231, 712, 676,
+  807, 393, 425, 0, 595, 0, 0, 0, 0, 981, 690, 225, 0, 94, 0, 457,
+  326, 240, 220, 345, 382, 134, 759, 788, 99, 655, 0, 0, 681, 0, 567, 0,
+  0, 586, 0, 0, 89, 0, 0, 0, 0, 0, 0, 943, 0, 0, 257, 399,
+  0, 0, 0, 0, 0, 72, 193, 0, 898, 0, 0, 0, 0, 0, 549, 0,
+  0, 0, 243, 0, 0, 0, 208, 0, 492, 962, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 792, 708, 0, 0, 0, 582, 0, 0, 0, 200, 338, 921, 0,
+  261, 0, 79, 386, 635, 0, 0, 815, 552, 0, 752, 0, 0, 0, 709, 0,
+  0, 247, 95, 288, 7, 97, 381, 162, 443, 475, 790, 848, 960, 170, 192, 918,
+  0, 0, 0, 0, 0, 504, 553, 829, 609, 976, 0, 705, 0, 0, 0, 0,
+  146, 536, 277, 63, 909, 444, 593, 945, 0, 0, 0, 0, 0, 0, 0, 516,
+  774, 0, 0, 265, 0, 13, 363, 415, 533, 214, 409, 418, 510, 0, 0, 0,
+  484, 0, 90, 0, 0, 0, 0, 0, 0, 0, 0, 71, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 648, 0, 0, 105, 0, 0, 0, 0, 560, 0, 456,
+  115, 221, 521, 859, 0, 0, 0, 0, 0, 68, 426, 427, 0, 0, 845, 117,
+  903, 0, 0, 576, 226, 722, 732, 515, 772, 0, 0, 0, 446, 307, 818, 0,
+  967, 0, 0, 2, 224, 524, 66, 675, 26, 56, 730, 985, 749, 775, 303, 0,
+  0, 0, 0, 0, 0, 0, 458, 0, 0, 0, 872, 0, 0, 0, 0, 0,
+  440, 58, 362, 0, 420, 0, 20, 85, 130, 291, 0, 0, 895, 0, 0, 407,
+  0, 0, 0, 190, 617, 74, 750, 356, 8, 347, 496, 838, 0, 111, 650, 922,
+  0, 0, 0, 545, 309, 230, 83, 509, 491, 575, 902, 983, 235, 0, 0, 32,
+  0, 0, 0, 144, 0, 0, 853, 0, 0, 0, 0, 327, 610, 651, 0, 0,
+  0, 0, 263, 0, 668, 701, 508, 706, 0, 0, 0, 4, 808, 0, 189, 442,
+  860, 361, 22, 0, 0, 348, 939, 0, 0, 0, 546, 0, 880, 0, 76, 346,
+  0, 0, 153, 647, 52, 232, 770, 0, 0, 0, 0, 0, 0, 292, 915, 322,
+  267, 910, 877, 0, 0, 237, 391, 0, 0, 0, 0, 39, 0, 622, 0, 334,
+  0, 548, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 319, 329, 0,
+  269, 0, 0, 0, 0, 0, 0, 0, 540, 82, 573, 128, 179, 824, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 48, 0, 310, 0, 559, 308, 568, 378, 817,
+  0, 762, 826, 0, 957, 0, 0, 0, 805, 400, 656, 0, 0, 35, 272, 541,
+  919, 0, 0, 0, 0, 0, 0, 116, 149, 0, 0, 0, 0, 0, 0, 19,
+  525, 0, 0, 0, 0, 0, 0, 0, 905, 0, 0, 0, 0, 0, 0, 0,
+  994, 0, 847, 639, 118, 638, 0, 663, 131, 0, 0, 0, 0, 0, 0, 0,
+  0, 151, 197, 463, 172, 773, 0, 0, 0, 0, 0, 0, 0, 745, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 0, 0, 0, 67, 0,
+  0, 0, 236, 354, 416, 0, 0, 330, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 73, 835, 1, 53,
+  441, 584, 941, 964, 0, 0, 268, 0, 0, 601, 511, 917, 154, 643, 692, 844,
+  952, 997, 5, 721, 869, 936, 302, 121, 707, 557, 318, 999, 211, 248, 513, 0,
+  0, 0, 623, 544, 469, 886, 887, 0, 747, 627, 429, 365, 387, 452, 0, 0,
+  590, 0, 0, 0, 0, 799, 0, 0, 679, 0, 3, 698, 285, 0, 396, 640,
+  529, 819, 0, 0, 530, 502, 561, 0, 0, 0, 1000, 294, 563, 0, 0, 547,
+  0, 735, 0, 0, 783, 306, 398, 0, 961, 0, 148, 686, 646, 804, 282, 0,
+  0, 281, 0, 680, 661, 0, 737, 49, 465, 279, 499, 107, 587, 727, 748, 228,
+  258, 0, 383, 0, 59, 0, 75, 385, 892, 0, 213, 349, 389, 539, 974, 0,
+  0, 888, 532, 0, 0, 876, 0, 0, 0, 343, 606, 671, 758, 0, 0, 143,
+  554, 328, 852, 0, 577, 0, 0, 477, 0, 637, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 630, 397, 375, 0, 23, 44, 0, 801, 124, 935, 0,
+  264, 158, 0, 0, 0, 467, 632, 0, 0, 0, 379, 0, 959, 834, 0, 284,
+  0, 0, 0, 0, 0, 336, 377, 489, 702, 733, 618, 0, 270, 0, 0, 64,
+  0, 691, 401, 649, 977, 0, 36, 594, 435, 0, 88, 455, 69, 9, 209, 0,
+  0, 0, 0, 0, 0, 0, 141, 474, 0, 0, 337, 0, 0, 625, 448, 0,
+  0, 101, 0, 0, 91, 219, 0, 34, 763, 0, 736, 696, 970, 112, 0, 893,
+  0, 0, 50, 433, 340, 741, 51, 685, 0, 0, 0, 0, 451, 901, 445, 0,
+  0, 0, 0, 932, 54, 0, 543, 0, 0, 403, 461, 751, 923, 100, 0, 0,
+  159, 0, 278, 358, 0, 244, 357, 0, 0, 0, 0, 0, 628, 402, 493, 666,
+  616, 0, 0, 0, 0, 950, 298, 80, 0, 0, 274, 315, 133, 339, 797, 355,
+  216, 930, 975, 0, 0, 215, 187, 335, 0, 0, 290, 767, 0, 0, 624, 0,
+  0, 0, 0, 0, 0, 0, 411, 0, 0, 0, 16, 161, 948, 139, 0, 297,
+  438, 0, 0, 0, 535, 186, 816, 0, 0, 899, 0, 0, 0, 0, 0, 0,
+  500, 0, 135, 0, 204, 0, 0, 0, 982, 989, 0, 0, 0, 312, 578, 764,
+  0, 0, 0, 556, 0, 497, 591, 0, 703, 176, 0, 0, 0, 0, 0, 0,
+  316, 410, 786, 825, 103, 0, 0, 0, 849, 0, 229, 311, 592, 0, 367, 0,
+  0, 0, 800, 0, 697, 528, 814, 791, 823, 392, 894, 0, 753, 0, 0, 0,
+  0, 0, 0, 0, 938, 0, 566, 201, 462, 81, 694, 931, 184, 870, 925, 891,
+  756, 0, 710, 0, 0, 0, 351, 0, 0, 206, 0, 0, 28, 0, 359, 629,
+  604, 252, 188, 725, 480, 572, 754, 0, 0, 0, 0, 0, 0, 181, 0, 0,
+  366, 862, 0, 881, 713, 882, 0, 380, 0, 699, 166, 0, 168, 180, 658, 0,
+  287, 324, 827, 77, 585, 897, 246, 942, 0, 0, 0, 177, 0, 0, 0, 520,
+  597, 0, 779, 0, 205, 0, 0, 0, 0, 183, 372, 0, 0, 0, 0, 350,
+  0, 0, 114, 0, 0, 820, 778, 0, 0, 0, 0, 0, 120, 0, 207, 517,
+  0, 0, 0, 0, 0, 993, 619, 0, 450, 198, 949, 0, 0, 0, 0, 0,
+  0, 755, 0, 854, 626, 731, 884, 320, 875, 979, 0, 0, 0, 0, 633, 0,
+  865, 0, 0, 0, 0, 850, 0, 0, 503, 0, 0, 156, 689, 169, 323, 126,
+  234, 0, 413, 0, 266, 0, 0, 840, 631, 0, 677, 104, 165, 611, 580, 163,
+  11, 498, 644, 657, 890, 506, 537, 940, 965, 968, 900, 233, 986, 987, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 222, 717, 150, 488, 746, 837, 173,
+  483, 0, 645, 0, 0, 0, 238, 0, 0, 667, 314, 954, 0, 0, 0, 0,
+  0, 41, 0, 0, 0, 0, 0, 0, 0, 0, 436, 0, 495, 447, 704, 0,
+  129, 574, 0, 454, 0, 0, 0, 830, 368, 0, 0, 0, 299, 0, 10, 301,
+  0, 0, 798, 194, 518, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223, 0,
+  0, 199, 0, 0, 0, 600, 828, 0, 321, 333, 422, 408, 259, 490, 728, 0,
+  832, 325, 0, 256, 0, 0, 212, 423, 0, 0, 0, 0, 0, 0, 0, 119,
+  846, 0, 0, 0, 0, 784, 459, 481, 0, 0, 0, 0, 0, 428, 0, 0,
+  0, 0, 0, 300, 65, 602, 659, 662, 102, 664, 152, 729, 795, 145, 883, 889,
+  0, 0, 0, 555, 0, 0, 62, 78, 0, 0, 928, 283, 0, 0, 613, 331,
+  988, 127, 652, 929, 558, 0, 113, 0, 0, 933, 0, 0, 0, 45, 906, 138,
+  0, 182, 523, 766, 0, 0, 0, 0, 0, 0, 0, 858, 0, 833, 947, 973,
+  0, 414, 836, 0, 437, 0, 0, 0, 108, 0, 167, 757, 0, 0, 0, 550,
+  0, 0, 0, 0, 0, 0, 0, 0, 27, 810, 57, 460, 0, 542, 262, 951,
+  0, 621, 93, 0, 0, 0, 0, 485, 0, 0, 395, 538, 40, 0, 0, 110,
+  0, 125, 185, 688, 0, 0, 0, 583, 0, 0, 0, 0, 0, 738, 374, 0,
+  0, 0, 84, 0, 218, 780, 0, 280, 760, 0, 0, 0, 0, 0, 0, 0,
+  137, 0, 0, 687, 0, 0, 478, 0, 0, 969, 0, 122, 742, 926, 971, 0,
+  370, 839, 0, 0, 96, 253, 0, 0, 17, 47, 726, 0, 740, 0, 0, 924,
+  0, 494, 995, 0, 0, 0, 0, 0, 419, 0, 196, 0, 0, 431, 908, 0,
+  0, 250, 719, 0, 0, 464, 907, 0, 0, 70, 0, 714, 0, 0, 0, 0,
+  479, 856, 958, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 293, 607,
+  0, 42, 0, 0, 0, 0, 0, 642, 482, 0, 0, 0, 0, 0, 0, 581,
+  0, 599, 904, 0, 0, 0, 37, 33, 289, 432, 589, 682, 470, 0, 0, 501,
+  15, 353, 373, 260, 412, 695, 157, 0, 716, 0, 0, 693, 271, 0, 0, 0,
+  0, 0, 0, 296, 605, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 765,
+  879, 0, 0, 0, 0, 551, 0, 0, 562, 0, 739, 0, 743, 0, 0, 0,
+  217, 863, 734, 0, 0, 0, 0, 371, 522, 352, 178, 136, 0, 0, 796, 0,
+  0, 0, 0, 0, 0, 0, 417, 439, 608, 466, 30, 813, 0, 822, 0, 946,
+  565, 802, 0, 0, 777, 0, 0, 914, 0, 0, 0, 972, 0, 0, 0, 660,
+  678, 476, 700, 793, 913, 937, 0, 771, 0, 564, 0, 255, 588, 0, 944, 0,
+  239, 0, 0, 0, 868, 0, 29, 0, 0, 866, 654, 673, 612, 276, 789, 0,
+  369, 18, 376, 0, 715, 0, 0, 31, 569, 405, 579, 0, 0, 996, 21, 43,
+  669, 123, 519, 831, 0, 776, 242, 806, 0, 0, 0, 769, 0, 978, 473, 140,
+  171, 195, 0, 0, 653, 0, 803, 505, 641, 404, 453, 809, 878, 956, 0, 0,
+  0, 0, 507, 0, 0, 164, 245, 0, 871, 275, 0, 142, 864, 227, 0, 851,
+  0, 364, 526, 0, 0, 768, 963, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 430, 0, 0, 0, 0, 0, 0, 109, 512, 390, 920, 684, 0, 191,
+  614, 634, 534, 0, 0, 0, 672, 0, 683, 0, 0, 0, 0, 0, 0, 0,
+  249, 0, 241, 0, 0, 811, 0, 0, 332, 0, 0, 0, 0, 761, 449, 636,
+};
+
+const char *WA_FREQ_175_TOKENS[] = {
+  "n",
+  "mu",
+  "omu",
+  "obu",
+  "kandi",
+  "abantu",
+  "muno",
+  "ha",
+  "abaana",
+  "nk",
+  "habwokuba",
+  "nukwo",
+  "rundi",
+  "ebi",
+  "na",
+  "kicweka",
+  "x27",
+  "eby",
+  "ebintu",
+  "abandi",
+  "omuntu",
+  "amaizi",
+  "kurungi",
+  "eki",
+  "sente",
+  "emirimo",
+  "hamu",
+  "buli",
+  "ngu",
+  "ebyokulya",
+  "kurora",
+  "kuba",
+  "kyaitu",
+  "kyange",
+  "baitu",
+  "kukora",
+  "kikuru",
+  "y",
+  "nabo",
+  "omwana",
+  "nka",
+  "b",
+  "bw",
+  "kintu",
+  "ka",
+  "obwomeezi",
+  "abakazi",
+  "ky",
+  "ey",
+  "baabo",
+  "bwire",
+  "obwire",
+  "obulemeezi",
+  "ekitiinisa",
+  "amaani",
+  "yange",
+  "kiro",
+  "oburwaire",
+  "uganda",
+  "habw",
+  "ebindi",
+  "ebibi",
+  "oku",
+  "maka",
+  "by",
+  "kulya",
+  "ab",
+  "isomero",
+  "baine",
+  "enjura",
+  "endwaire",
+  "siliimu",
+  "maiso",
+  "obw",
+  "obundi",
+  "nkira",
+  "ogu",
+  "bantu",
+  "noosanga",
+  "masomero",
+  "ei",
+  "kutunga",
+  "omugaso",
+  "bwomeezi",
+  "okuba",
+  "abazaire",
+  "engoye",
+  "twine",
+  "nukwe",
+  "abaisiki",
+  "kimu",
+  "aba",
+  "obusinge",
+  "aine",
+  "basobole",
+  "nyowe",
+  "kusoma",
+  "omukazi",
+  "akahuka",
+  "emu",
+  "byabo",
+  "hati",
+  "abasaija",
+  "kakuba",
+  "amp",
+  "enyegesa",
+  "engeso",
+  "mba",
+  "gw",
+  "eka",
+  "bakuba",
+  "kyaro",
+  "obumu",
+  "asemeriire",
+  "emibazi",
+  "kiikaro",
+  "nkooku",
+  "ihanga",
+  "tusemeriire",
+  "oburungi",
+  "eky",
+  "hanyuma",
+  "abo",
+  "owaitu",
+  "ezi",
+  "nawe",
+  "ez",
+  "byaro",
+  "ebirungi",
+  "kugenda",
+  "abaingi",
+  "ngenda",
+  "yaitu",
+  "abeebembezi",
+  "basemeriire",
+  "bange",
+  "yabo",
+  "nibasobora",
+  "z",
+  "hali",
+  "kwikara",
+  "haihi",
+  "kirungi",
+  "obwisiki",
+  "omusaija",
+  "omwebembezi",
+  "bali",
+  "ensonga",
+  "aho",
+  "nambere",
+  "kukozesa",
+  "byaitu",
+  "nitusobora",
+  "baingi",
+  "nyingi",
+  "gaitu",
+  "kwetantara",
+  "obuhangwa",
+  "muntu",
+  "ekintu",
+  "kubi",
+  "ebizibu",
+  "omubiri",
+  "ya",
+  "oine",
+  "haroho",
+  "enda",
+  "kulinda",
+  "byona",
+  "abamu",
+  "ekyo",
+  "ekiro",
+  "ruhanga",
+  "ebihimba",
+  "nibyo",
+  "amaka",
+  "enungi",
+  "ebyo",
+  "kuruga",
+  "w",
+  "obwingi",
+  "bingi",
+  "binu",
+  "omuzaire",
+  "enkurakurana",
+  "bwaitu",
+  "ebitooke",
+  "endi",
+  "bwabo",
+  "amasomero",
+  "kulima",
+  "kara",
+  "emibu",
+  "bwingi",
+  "abakuru",
+  "gaabo",
+  "miringo",
+  "bagenzi",
+  "gavumenti",
+  "kunywa",
+  "ebikoosi",
+  "mbanza",
+  "naaba",
+  "akasumi",
+  "sukaali",
+  "kwekebeza",
+  "ebimera",
+  "emiringo",
+  "muka",
+  "amasanyarazi",
+  "obulema",
+  "okubanza",
+  "bato",
+  "okusoma",
+  "mirimo",
+  "ensinganto",
+  "bya",
+  "mbere",
+  "mubiri",
+  "mmara",
+  "irwarro",
+  "obugabe",
+  "kinu",
+  "we",
+  "okukora",
+  "bikoosi",
+  "abalimi",
+  "nikyo",
+  "kusaba",
+  "enju",
+  "bwange",
+  "tuba",
+  "be",
+  "okutunga",
+  "okukozesa",
+  "aboojo",
+  "akuba",
+  "bbiizinesi",
+  "kwegesa",
+  "bwa",
+  "g",
+  "baana",
+  "omulimo",
+  "ebitali",
+  "kw",
+  "ki",
+  "naiwe",
+  "ah",
+  "ebiri",
+  "naasobora",
+  "ntusobora",
+  "bicweka",
+  "kwerinda",
+  "ekindi",
+  "omulingo",
+  "kasumi",
+  "emiti",
+  "twina",
+  "bwawe",
+  "so",
+  "k",
+  "mmh",
+  "biki",
+  "kurabira",
+  "ebirimwa",
+  "abakaikuru",
+  "obuheereza",
+  "omulema",
+  "ebya",
+  "okunywa",
+  "boona",
+  "tibaine",
+  "ebiiruka",
+  "bazaana",
+  "emikono",
+  "amakuru",
+  "ebitebe",
+  "ntusemerra",
+  "oli",
+  "bakyali",
+  "kyona",
+  "musiri",
+  "ba",
+  "kuleeta",
+  "amata",
+  "abaine",
+  "okugenda",
+  "bwe",
+  "amagezi",
+  "basobora",
+  "amarungi",
+  "ebisoro",
+  "okulima",
+  "wiiki",
+  "ntaine",
+  "ndya",
+  "obuzibu",
+  "zaitu",
+  "kwoga",
+  "bisimba",
+  "etali",
+  "bitebe",
+  "omuka",
+  "kugonza",
+  "emizaano",
+  "tiivi",
+  "ediini",
+  "motoka",
+  "enguudo",
+  "tusobole",
+  "enkurato",
+  "abagurusi",
+  "tusobora",
+  "omwisiki",
+  "ekizibu",
+  "kukira",
+  "gwange",
+  "nsaba",
+  "abakozi",
+  "yoona",
+  "omupiira",
+  "emibiri",
+  "pikipiki",
+  "oba",
+  "nyenkya",
+  "lyaitu",
+  "mbyama",
+  "embabazi",
+  "kovidi",
+  "ali",
+  "ekicweka",
+  "obwa",
+  "egi",
+  "eba",
+  "mpurra",
+  "esimu",
+  "kujwara",
+  "bintu",
+  "kwega",
+  "omurungi",
+  "butandwa",
+  "kwetaba",
+  "oburofu",
+  "noosobora",
+  "ensi",
+  "habweki",
+  "hansi",
+  "baba",
+  "nooba",
+  "embuzi",
+  "bimu",
+  "nguudo",
+  "tukuba",
+  "omwani",
+  "ndinda",
+  "oburo",
+  "nyine",
+  "ndi",
+  "marwarro",
+  "ye",
+  "obunaku",
+  "nibaba",
+  "nubwo",
+  "niyo",
+  "ogw",
+  "nubo",
+  "mpero",
+  "omuhimbo",
+  "mara",
+  "nju",
+  "bakuru",
+  "gwa",
+  "kuraba",
+  "myaka",
+  "okwega",
+  "enkoko",
+  "ebijuma",
+  "eya",
+  "bwona",
+  "wenka",
+  "enu",
+  "obusuma",
+  "zange",
+  "okusaba",
+  "tuli",
+  "ku",
+  "ezo",
+  "mwingi",
+  "nkaba",
+  "ezindi",
+  "zimu",
+  "nyonjo",
+  "kukorra",
+  "nkuba",
+  "nuho",
+  "banu",
+  "asobole",
+  "kumaraho",
+  "nsobora",
+  "kiki",
+  "ag",
+  "gumu",
+  "butale",
+  "mulingo",
+  "okutema",
+  "okwekebeza",
+  "ebiikaro",
+  "kalimagezi",
+  "abeegi",
+  "obujanjabi",
+  "kya",
+  "banywani",
+  "waawe",
+  "nibakora",
+  "ago",
+  "ente",
+  "nyikarra",
+  "entaahya",
+  "okurora",
+  "saaha",
+  "itwe",
+  "ow",
+  "biri",
+  "bakora",
+  "kwija",
+  "obusera",
+  "ebyolooni",
+  "esabbuuni",
+  "gamu",
+  "obuyonjo",
+  "obujune",
+  "muhogo",
+  "ekyokulya",
+  "aah",
+  "nsonga",
+  "zaabo",
+  "eeh",
+  "barora",
+  "ondi",
+  "amaju",
+  "bonka",
+  "okulinda",
+  "aka",
+  "obugaali",
+  "ako",
+  "kutamu",
+  "entaito",
+  "okwerinda",
+  "asobora",
+  "kutwara",
+  "baawe",
+  "kumanya",
+  "kubeegesa",
+  "amadiini",
+  "mibiri",
+  "caayi",
+  "gaba",
+  "aheeru",
+  "omusana",
+  "kuyamba",
+  "fiizi",
+  "kuhuliiriza",
+  "enfuka",
+  "amahanga",
+  "ebitakuli",
+  "nsi",
+  "abasomere",
+  "ekya",
+  "enyingi",
+  "obujunaanizibwa",
+  "obutabanguko",
+  "obuhuka",
+  "ebicooli",
+  "nyina",
+  "ncumba",
+  "ndora",
+  "mukama",
+  "empunu",
+  "zinu",
+  "abakukira",
+  "ningenda",
+  "kwikarra",
+  "amasu",
+  "bwemeriire",
+  "abalema",
+  "enganikyo",
+  "ekyanyenkya",
+  "kwogya",
+  "mukuru",
+  "kuserra",
+  "endema",
+  "mbuga",
+  "kwombeka",
+  "gwawe",
+  "weena",
+  "abanyakwine",
+  "nibatunga",
+  "oihireho",
+  "obwojo",
+  "mbi",
+  "ebinyakuli",
+  "ndwaire",
+  "kahuka",
+  "burwaire",
+  "byange",
+  "kubyama",
+  "wange",
+  "burungi",
+  "naasemerra",
+  "abarwaire",
+  "omuswija",
+  "buhangwa",
+  "ebiro",
+  "ebitongole",
+  "birungi",
+  "okulya",
+  "baleke",
+  "nti",
+  "tikiri",
+  "obusumi",
+  "emyaka",
+  "bakira",
+  "haiguru",
+  "enjaahi",
+  "ekisaka",
+  "kiri",
+  "ebitabu",
+  "embi",
+  "iwe",
+  "batunga",
+  "nibatangatangana",
+  "nibasemerra",
+  "owaine",
+  "biine",
+  "habwaki",
+  "nikireeta",
+  "etaano",
+  "nyeyambisa",
+  "bagenda",
+  "ekipanga",
+  "nibalima",
+  "agatali",
+  "nimba",
+  "kuli",
+  "byokulya",
+  "tukira",
+  "kubaza",
+  "bataine",
+  "bumu",
+  "bakukora",
+  "mulimo",
+  "ebyetaago",
+  "okusanga",
+  "maduuka",
+  "ebizina",
+  "kumalirra",
+  "mpora",
+  "abato",
+  "akasente",
+  "endabada",
+  "kindi",
+  "aga",
+  "ebirukumara",
+  "ebikorwa",
+  "bakozere",
+  "businge",
+  "eri",
+  "okumanya",
+  "neegwa",
+  "ezitali",
+  "kweyambisa",
+  "ntakabyamire",
+  "mpuumuraho",
+  "nteekaho",
+  "ekyanda",
+  "itwena",
+  "kuswera",
+  "oraaba",
+  "akanwa",
+  "baruga",
+  "abajanjabi",
+  "okuleeta",
+  "gwaitu",
+  "misiri",
+  "ebigambo",
+  "bagende",
+  "bo",
+  "kubayamba",
+  "h",
+  "nibagenda",
+  "kunu",
+  "ebisimba",
+  "okuruga",
+  "bazaire",
+  "kusanga",
+  "kweta",
+  "kugira",
+  "habookuba",
+  "asomere",
+  "batungire",
+  "nibakira",
+  "then",
+  "nizo",
+  "ebilaaya",
+  "basoboire",
+  "nungi",
+  "arukuba",
+  "bwango",
+  "nibavuga",
+  "okwetantara",
+  "ga",
+  "nkasemererwa",
+  "ekirungi",
+  "yaawe",
+  "kujanjaaza",
+  "endwara",
+  "ntuba",
+  "okwikara",
+  "kusomesa",
+  "baatunga",
+  "ee",
+  "mutima",
+  "eteeka",
+  "obujwahi",
+  "nyehurraamu",
+  "mbigura",
+  "omukura",
+  "okutamu",
+  "ahurra",
+  "kaitu",
+  "doodo",
+  "enswiga",
+  "biro",
+  "kumara",
+  "abeegesa",
+  "naagenda",
+  "nibarora",
+  "engonzi",
+  "kufuna",
+  "kwetegereza",
+  "abataine",
+  "biikaro",
+  "mazire",
+  "ebimu",
+  "engaro",
+  "ajwaire",
+  "tauni",
+  "onu",
+  "mbyaramu",
+  "kusinga",
+  "muli",
+  "okutwara",
+  "barukuba",
+  "kuswerwa",
+  "kutangatangana",
+  "osobora",
+  "obutumwa",
+  "baraaba",
+  "obuli",
+  "abaali",
+  "munywani",
+  "ninsobora",
+  "buswere",
+  "kaire",
+  "omunywani",
+  "naitwe",
+  "ziri",
+  "nugo",
+  "tutakungaine",
+  "bikuru",
+  "garugireho",
+  "ekyokurorraaho",
+  "kubatamu",
+  "ekinunko",
+  "abatarukwesobora",
+  "amoogero",
+  "byo",
+  "omutima",
+  "noosemerra",
+  "bakatunga",
+  "obuhabuzi",
+  "mwana",
+  "bulemeezi",
+  "hagati",
+  "osemeriire",
+  "osanga",
+  "mali",
+  "ekiikaro",
+  "lya",
+  "kutangira",
+  "omubazi",
+  "kuteekaniza",
+  "nteekaniza",
+  "nyenkyakara",
+  "eyange",
+  "eyeetali",
+  "kuhuliriza",
+  "kitabu",
+  "ekitabu",
+  "rreediyo",
+  "nibeetaaga",
+  "kubaha",
+  "egyo",
+  "bagamba",
+  "eb",
+  "musana",
+  "hatali",
+  "maizi",
+  "mh",
+  "kasinga",
+  "habaho",
+  "nuwe",
+  "batunge",
+  "bunu",
+  "batangatangana",
+  "byawe",
+  "ebiteekerezo",
+  "okwegesa",
+  "nabyo",
+  "rulengo",
+  "abasomesa",
+  "okusemeza",
+  "beegesa",
+  "njura",
+  "bandi",
+  "twiha",
+  "kando",
+  "okwogya",
+  "okubayamba",
+  "kununka",
+  "neereeta",
+  "emiyembe",
+  "nunka",
+  "emikura",
+  "enyama",
+  "nikiyamba",
+  "kuguma",
+  "bata",
+  "mbaba",
+  "kuheereza",
+  "nkora",
+  "bamanye",
+  "bamazire",
+  "batandikireho",
+  "abanywani",
+  "za",
+  "obutaba",
+  "ebitokooza",
+  "amairungi",
+  "nibakozesa",
+  "tulya",
+  "ninkora",
+  "enjagi",
+  "tooro",
+  "kusamba",
+  "okuliisa",
+  "okukira",
+  "tugenda",
+  "kwe",
+  "kubanza",
+  "ekikuru",
+  "bukyali",
+  "esobora",
+  "kurubata",
+  "rw",
+  "munu",
+  "kireetaho",
+  "ninsagika",
+  "basomere",
+  "omwojo",
+  "bakaba",
+  "nikimanyisa",
+  "amarwarro",
+  "babe",
+  "amasimu",
+  "ninteekereza",
+  "aa",
+  "katimba",
+  "owaarukwonkya",
+  "orwaire",
+  "otaine",
+  "katale",
+  "itaka",
+  "ebirwaire",
+  "okuganyira",
+  "baikara",
+  "kuganikiza",
+  "kye",
+  "nsobole",
+  "kwiha",
+  "mihanda",
+  "nzirinda",
+  "nzigorra",
+  "orugoye",
+  "kusasurra",
+  "kugirra",
+  "okujwara",
+  "nibisobora",
+  "bisobora",
+  "okwombeka",
+  "kukura",
+  "osobole",
+  "obutoosa",
+  "abakuba",
+  "kugamba",
+  "barwaire",
+  "nitubaha",
+  "naakora",
+  "ebitasemeriire",
+  "nindora",
+  "nibeegesa",
+  "emisomo",
+  "kuha",
+  "taine",
+  "noikara",
+  "nakyo",
+  "bwongo",
+  "amarwa",
+  "malaaya",
+  "ekyaro",
+  "buleeteriize",
+  "kutandika",
+  "entahya",
+  "okurolerra",
+  "balengereho",
+  "nibafuuhirra",
+  "zoona",
+  "nibalinda",
+  "ngirinda",
+  "mbiteeka",
+  "omwingi",
+  "nyongera",
+  "abali",
+  "okuhuumura",
+  "ngonza",
+  "ebisisani",
+  "rwebagyo",
+  "kuhurra",
+  "okuteekamu",
+  "halimu",
+  "bateekereza",
+  "bajwara",
+  "tulinda",
+  "tukozesa",
+  "ebirugire",
+  "hara",
+  "ebisobora",
+  "kuhika",
+  "kugura",
+  "obusuubuzi",
+  "okugya",
+  "okujanjaaza",
+  "kumutwara",
+  "ebikwatwa",
+  "obusiihani",
+  "obutandwa",
+  "kufa",
+  "simu",
+  "ezimu",
+  "baali",
+  "nuko",
+  "natunga",
+  "ebikugenda",
+  "ekibi",
+  "obusobozi",
+  "ebisaka",
+  "gwe",
+  "anywe",
+  "mabeere",
+  "ge",
+  "nibiba",
+  "hakuba",
+  "kisemeriire",
+  "empindahinduka",
+  "ly",
+  "noobu",
+  "kubakoonyera",
+  "mulema",
+  "kwegesebwa",
+  "enyuma",
+  "orukuba",
+  "kibi",
+  "kuganyira",
+  "okubaha",
+  "okuraba",
+  "obulinzi",
+  "nanyowe",
+  "ntunga",
+  "negwa",
+  "neeyera",
+  "kwihamu",
+  "ntakarugire",
+  "nyimuka",
+  "kunaaba",
+  "amaino",
+  "agandi",
+  "kumanyisa",
+  "noogenda",
+  "nkozesa",
+  "ezirukumara",
+  "nitusemerra",
+  "okukorra",
+  "enanaasi",
+  "enjwara",
+  "ekatabangura",
+  "nsemeriire",
+  "emikubi",
+  "orukusanga",
+  "tu",
+  "omunywererro",
+  "nibasanga",
+  "enaku",
+  "kugya",
+  "okuzaara",
+  "nibamanya",
+  "bikorwa",
+  "basanga",
+  "tibaina",
+  "mbatangatangana",
+  "ebisale",
+  "mikura",
+  "kuteekaho",
+  "mbasobora",
+  "niba",
+  "kwihaho",
+  "kyawe",
+  "naatunga",
+  "nyikara",
+  "okw",
+  "kukorwa",
+  "mmmh",
+  "ngeso",
+  "nibamalirra",
+  "emisiri",
+  "ebinyansi",
+  "kucumba",
+  "kanisa",
+  "tubazaaho",
+  "maramizo",
+  "nteekamu",
+  "kyoto",
+  "omukubi",
+  "kuzaana",
+  "ezisobora",
+  "okweyohoza",
+  "bakurora",
+  "e",
+  "nguli",
+  "ntaito",
+  "kukozesebwa",
+  "okugura",
+  "bbaasi",
+  "bitaito",
+  "kayoora",
+  "okufa",
+  "nikisobora",
+  "bireesere",
+  "obutali",
+  "kubaho",
+  "gali",
+  "o",
+  "abarukukira",
+  "mukazi",
+  "ekigambo",
+  "obunyakuli",
+  "busaho",
+  "mutwe",
+  "abagenzi",
+  "noo",
+  "ebicweka",
+  "ni",
+  "naija",
+  "kwihayo",
+  "eh",
+  "orugabu",
+  "amajaani",
+  "kugema",
+  "kwita",
+  "mubazi",
+  "bataahi",
+  "okuyamba",
+  "emigaso",
+  "kaingi",
+  "kugikozesa",
+  "mmanyire",
+  "bakwetaaga",
+  "owaakusobiize",
+  "otungire",
+  "kiba",
+  "mutaahi",
+  "nturaba",
+  "omugaate",
+  "ekuba",
+  "haliyo",
+  "njwara",
+  "naho",
+  "ngisiimuura",
+  "kasasiro",
+  "mbyamaho",
+  "obwongo",
+};
+const uint16_t WA_FREQ_175_RANKS[] = {
+  33, 0, 0, 491, 998, 919, 391, 0, 214, 385, 793, 0, 0, 0, 0, 500,
+  272, 585, 0, 308, 142, 599, 633, 343, 592, 722, 833, 877, 922, 0, 0, 0,
+  0, 0, 102, 814, 0, 0, 0, 0, 0, 179, 0, 219, 304, 718, 745, 0,
+  0, 0, 0, 828, 0, 816, 0, 0, 0, 0, 85, 549, 601, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 794, 0, 0, 0, 0, 0, 0, 3, 61, 112,
+  566, 598, 95, 683, 849, 0, 0, 123, 0, 0, 0, 0, 213, 942, 0, 0,
+  0, 0, 861, 0, 280, 0, 648, 0, 50, 0, 0, 0, 76, 0, 0, 524,
+  86, 251, 588, 0, 781, 0, 629, 488, 929, 0, 0, 0, 0, 717, 944, 274,
+  0, 0, 224, 375, 775, 0, 697, 2, 572, 0, 360, 282, 455, 338, 520, 604,
+  623, 0, 0, 73, 670, 0, 653, 0, 0, 314, 340, 404, 132, 584, 949, 401,
+  536, 0, 926, 182, 237, 418, 0, 231, 956, 30, 0, 957, 0, 0, 191, 188,
+  0, 141, 68, 364, 12, 908, 0, 0, 974, 620, 0, 0, 0, 0, 0, 0,
+  0, 813, 933, 0, 525, 223, 863, 958, 350, 74, 827, 0, 203, 0, 0, 483,
+  100, 0, 380, 0, 0, 544, 0, 0, 284, 663, 0, 148, 0, 0, 0, 329,
+  0, 0, 286, 0, 163, 0, 0, 0, 24, 118, 0, 829, 702, 0, 0, 426,
+  18, 0, 0, 408, 57, 609, 431, 0, 227, 108, 242, 468, 606, 503, 709, 419,
+  822, 0, 0, 0, 0, 0, 0, 514, 0, 946, 13, 0, 526, 0, 760, 0,
+  289, 605, 987, 0, 0, 0, 98, 854, 688, 0, 0, 899, 0, 674, 0, 0,
+  201, 0, 0, 0, 459, 0, 0, 11, 498, 0, 0, 0, 337, 301, 486, 0,
+  865, 476, 0, 0, 976, 0, 0, 603, 0, 0, 0, 0, 791, 0, 0, 0,
+  302, 884, 0, 0, 0, 862, 0, 0, 0, 0, 232, 104, 114, 668, 0, 0,
+  105, 0, 0, 35, 607, 0, 0, 980, 0, 0, 0, 612, 0, 0, 909, 0,
+  0, 0, 0, 0, 0, 0, 0, 801, 357, 60, 851, 0, 306, 0, 0, 194,
+  0, 0, 0, 0, 0, 0, 818, 0, 129, 349, 400, 0, 0, 0, 0, 0,
+  757, 422, 0, 656, 0, 0, 0, 0, 0, 913, 982, 0, 0, 326, 346, 700,
+  972, 0, 0, 0, 0, 0, 740, 904, 281, 0, 0, 0, 841, 0, 0, 0,
+  704, 0, 0, 0, 0, 719, 390, 0, 0, 0, 367, 825, 0, 245, 362, 539,
+  0, 143, 388, 0, 433, 0, 0, 253, 0, 0, 71, 358, 587, 550, 295, 746,
+  890, 0, 0, 0, 0, 729, 0, 0, 435, 0, 0, 779, 552, 10, 199, 764,
+  0, 0, 288, 402, 429, 651, 895, 649, 932, 446, 770, 0, 207, 889, 952, 353,
+  485, 238, 0, 0, 0, 809, 0, 0, 0, 335, 769, 812, 320, 886, 0, 0,
+  0, 0, 518, 397, 639, 836, 682, 0, 684, 273, 0, 445, 0, 608, 742, 652,
+  835, 96, 180, 617, 493, 70, 438, 657, 774, 864, 0, 0, 0, 0, 0, 0,
+  0, 162, 0, 0, 62, 533, 0, 443, 554, 930, 0, 0, 204, 0, 398, 168,
+  815, 0, 193, 424, 0, 159, 474, 0, 0, 0, 0, 0, 0, 370, 541, 509,
+  0, 169, 42, 339, 394, 879, 0, 6, 0, 0, 535, 19, 867, 0, 205, 421,
+  923, 0, 713, 0, 978, 58, 0, 0, 0, 149, 0, 116, 0, 0, 0, 1,
+  330, 0, 0, 0, 0, 0, 0, 0, 0, 800, 0, 0, 0, 441, 0, 0,
+  259, 504, 363, 0, 267, 0, 461, 910, 448, 927, 969, 0, 174, 125, 416, 406,
+  567, 597, 506, 611, 0, 192, 495, 540, 0, 0, 578, 848, 0, 0, 411, 432,
+  0, 0, 655, 0, 0, 753, 0, 616, 645, 667, 0, 0, 0, 0, 502, 898,
+  75, 602, 687, 953, 975, 767, 158, 0, 726, 0, 444, 139, 737, 0, 0, 0,
+  634, 840, 876, 0, 15, 0, 0, 0, 690, 135, 0, 545, 0, 0, 677, 0,
+  0, 766, 736, 0, 0, 689, 0, 496, 928, 784, 0, 315, 0, 366, 0, 0,
+  0, 211, 470, 59, 0, 0, 0, 0, 172, 661, 699, 826, 915, 0, 0, 527,
+  0, 0, 665, 215, 556, 973, 0, 0, 842, 0, 720, 771, 0, 127, 0, 0,
+  0, 278, 439, 0, 0, 0, 996, 0, 300, 332, 568, 0, 0, 0, 0, 795,
+  0, 0, 389, 521, 0, 0, 0, 0, 0, 0, 0, 0, 0, 403, 562, 819,
+  83, 0, 247, 846, 0, 0, 136, 647, 529, 7, 317, 49, 321, 967, 0, 0,
+  0, 938, 0, 0, 0, 0, 0, 555, 0, 0, 482, 325, 590, 983, 0, 595,
+  838, 961, 0, 522, 0, 621, 748, 0, 0, 0, 532, 48, 965, 564, 945, 778,
+  733, 197, 434, 0, 20, 34, 244, 0, 0, 918, 323, 0, 165, 0, 56, 0,
+  0, 0, 0, 0, 615, 285, 636, 93, 0, 0, 334, 65, 154, 872, 731, 138,
+  0, 580, 559, 0, 0, 153, 0, 0, 0, 0, 131, 0, 0, 0, 0, 0,
+  0, 937, 21, 0, 0, 0, 0, 0, 796, 134, 447, 817, 837, 860, 276, 473,
+  669, 906, 883, 0, 0, 0, 0, 594, 941, 0, 77, 246, 369, 0, 0, 0,
+  765, 966, 847, 0, 147, 0, 479, 0, 0, 0, 0, 880, 0, 0, 157, 866,
+  449, 0, 0, 352, 0, 412, 0, 0, 0, 0, 23, 146, 410, 477, 457, 0,
+  0, 0, 0, 0, 0, 103, 0, 834, 379, 0, 0, 0, 0, 0, 0, 917,
+  0, 255, 0, 440, 297, 0, 614, 0, 0, 703, 110, 0, 0, 0, 0, 548,
+  0, 808, 723, 727, 0, 625, 0, 0, 137, 820, 710, 0, 0, 0, 0, 0,
+  716, 0, 0, 0, 0, 0, 0, 0, 0, 368, 464, 413, 635, 122, 619, 743,
+  0, 0, 0, 0, 662, 0, 0, 69, 0, 0, 63, 312, 381, 0, 0, 0,
+  0, 78, 210, 333, 442, 0, 0, 0, 0, 0, 0, 0, 0, 873, 383, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 654, 624, 0, 538, 252, 67, 935, 0,
+  0, 0, 0, 887, 249, 724, 492, 0, 0, 130, 0, 0, 0, 0, 0, 0,
+  569, 0, 0, 0, 0, 156, 113, 579, 430, 0, 45, 0, 0, 0, 0, 0,
+  111, 472, 995, 534, 0, 911, 0, 0, 405, 428, 0, 0, 0, 0, 0, 0,
+  5, 586, 685, 714, 981, 0, 875, 4, 0, 0, 0, 734, 797, 0, 0, 0,
+  0, 177, 294, 798, 968, 228, 0, 0, 216, 258, 939, 0, 72, 0, 852, 977,
+  0, 0, 0, 0, 0, 0, 551, 451, 0, 0, 0, 0, 475, 425, 0, 254,
+  787, 167, 510, 99, 0, 0, 0, 265, 0, 0, 222, 16, 596, 128, 741, 248,
+  783, 494, 821, 39, 543, 0, 0, 91, 0, 0, 106, 523, 0, 377, 407, 290,
+  0, 0, 0, 810, 0, 150, 761, 0, 176, 298, 646, 882, 209, 0, 235, 187,
+  29, 666, 747, 979, 262, 0, 0, 563, 0, 0, 0, 260, 291, 696, 0, 25,
+  84, 372, 0, 900, 0, 382, 0, 0, 0, 38, 658, 0, 0, 0, 853, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 453, 0, 0, 0, 613, 0, 0,
+  0, 0, 0, 414, 0, 0, 0, 109, 0, 0, 501, 0, 0, 0, 0, 0,
+  638, 0, 782, 0, 712, 0, 462, 490, 0, 0, 0, 871, 144, 0, 0, 0,
+  0, 0, 0, 0, 0, 322, 758, 0, 0, 0, 0, 0, 0, 671, 725, 992,
+  310, 160, 0, 0, 0, 28, 145, 133, 644, 189, 628, 0, 0, 186, 802, 0,
+  0, 570, 744, 0, 0, 0, 81, 755, 591, 0, 293, 858, 0, 792, 0, 870,
+  256, 988, 0, 347, 902, 243, 263, 359, 934, 989, 0, 0, 0, 456, 0, 706,
+  0, 0, 951, 0, 0, 0, 0, 905, 0, 0, 0, 914, 0, 0, 0, 0,
+  0, 319, 626, 0, 0, 0, 420, 901, 0, 212, 678, 0, 0, 0, 0, 0,
+  0, 0, 0, 275, 582, 0, 0, 386, 0, 0, 756, 0, 859, 0, 0, 0,
+  896, 270, 0, 0, 40, 107, 0, 0, 0, 0, 0, 0, 0, 804, 891, 986,
+  0, 0, 0, 0, 0, 0, 0, 0, 832, 0, 79, 469, 0, 754, 868, 920,
+  0, 0, 0, 0, 0, 739, 480, 931, 279, 0, 0, 0, 0, 119, 0, 0,
+  269, 0, 299, 458, 0, 283, 0, 963, 0, 0, 0, 0, 0, 0, 0, 730,
+  450, 0, 0, 751, 336, 233, 0, 0, 0, 305, 64, 27, 296, 0, 0, 0,
+  773, 0, 0, 0, 41, 0, 415, 436, 0, 707, 694, 0, 576, 0, 0, 0,
+  0, 571, 361, 845, 940, 0, 786, 0, 0, 528, 680, 0, 0, 54, 287, 807,
+  0, 0, 351, 0, 0, 0, 583, 0, 185, 0, 0, 0, 557, 0, 0, 0,
+  344, 0, 517, 888, 392, 531, 0, 151, 780, 0, 230, 0, 0, 0, 0, 43,
+  0, 0, 912, 962, 643, 0, 856, 0, 547, 0, 0, 0, 0, 0, 0, 94,
+  0, 225, 664, 955, 152, 512, 0, 417, 409, 0, 0, 0, 229, 487, 309, 497,
+  681, 728, 0, 0, 0, 324, 0, 0, 508, 92, 894, 26, 345, 0, 0, 0,
+  0, 181, 897, 0, 0, 0, 759, 0, 903, 0, 206, 0, 183, 0, 126, 264,
+  991, 708, 692, 924, 0, 0, 0, 0, 0, 997, 155, 218, 749, 805, 994, 936,
+  892, 878, 471, 803, 0, 630, 0, 0, 0, 701, 642, 0, 0, 0, 175, 0,
+  874, 120, 0, 0, 0, 0, 990, 0, 672, 839, 371, 0, 307, 66, 943, 0,
+  0, 0, 478, 0, 202, 17, 0, 0, 0, 0, 610, 0, 0, 0, 0, 0,
+  0, 0, 0, 947, 184, 0, 82, 8, 387, 460, 673, 0, 0, 166, 581, 0,
+  0, 0, 0, 0, 0, 0, 907, 0, 22, 561, 0, 0, 0, 0, 46, 921,
+  0, 0, 0, 0, 0, 575, 0, 0, 0, 0, 0, 0, 0, 0, 268, 768,
+  90, 627, 0, 560, 0, 0, 0, 0, 0, 0, 0, 948, 984, 916, 0, 507,
+  558, 811, 824, 0, 0, 0, 89, 121, 384, 396, 484, 631, 356, 640, 777, 44,
+  221, 292, 0, 0, 0, 0, 0, 0, 515, 0, 0, 117, 198, 0, 0, 0,
+  393, 0, 0, 0, 0, 0, 0, 115, 1000, 0, 721, 0, 0, 0, 161, 190,
+  0, 399, 0, 0, 354, 164, 574, 341, 565, 789, 855, 600, 463, 0, 0, 0,
+  0, 0, 0, 0, 857, 881, 0, 0, 0, 0, 960, 0, 0, 499, 650, 0,
+  47, 373, 513, 589, 454, 36, 0, 0, 0, 0, 234, 0, 0, 0, 0, 0,
+  553, 208, 750, 850, 0, 0, 637, 0, 0, 763, 200, 971, 830, 823, 0, 261,
+  226, 97, 546, 511, 51, 0, 0, 715, 0, 195, 316, 217, 0, 0, 0, 271,
+  0, 0, 250, 679, 0, 0, 893, 0, 0, 101, 970, 236, 693, 0, 618, 0,
+  0, 0, 0, 342, 376, 676, 0, 530, 593, 831, 348, 925, 0, 0, 0, 0,
+  0, 0, 0, 0, 53, 0, 0, 0, 0, 659, 0, 0, 0, 0, 0, 170,
+  452, 686, 365, 303, 0, 241, 0, 0, 173, 959, 80, 467, 691, 355, 732, 993,
+  0, 0, 0, 0, 0, 0, 423, 0, 0, 0, 0, 698, 0, 806, 542, 87,
+  0, 0, 641, 660, 735, 0, 0, 0, 0, 0, 622, 0, 0, 0, 0, 711,
+  785, 55, 0, 519, 0, 318, 505, 0, 327, 0, 489, 427, 0, 964, 196, 9,
+  32, 466, 843, 885, 0, 537, 0, 31, 0, 0, 240, 374, 0, 481, 0, 178,
+  0, 799, 0, 465, 675, 277, 869, 705, 0, 0, 52, 762, 0, 0, 0, 577,
+  0, 0, 88, 0, 0, 0, 0, 331, 772, 0, 0, 0, 950, 311, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 124, 790, 0, 328, 0, 220, 313, 0, 378,
+  257, 437, 0, 0, 0, 0, 0, 171, 0, 0, 37, 788, 266, 752, 954, 776,
+  985, 738, 632, 573, 999, 239, 0, 140, 516, 14, 395, 695, 844, 0, 0, 0,
+};
+
+const char *WA_FREQ_176_TOKENS[] = {
+  "мен",
+  "ол",
+  "бис",
+  "хөл",
+  "бо",
+  "кымыл",
+  "ону",
+  "азыравас",
+  "көк",
+  "сеңээ",
+  "чаа",
+  "машинамны",
+  "көргүзер",
+  "терең",
+  "номну",
+  "интернеттен",
+  "киирип",
+  "алдым",
+  "сами",
+  "сценага",
+  "танцычы",
+  "күзеп",
+  "чораан",
+  "кым",
+  "студент",
+  "аныяк",
+  "херээженге",
+  "ынакшаан",
+};
+const uint16_t WA_FREQ_176_RANKS[] = {
+  0, 0, 21, 22, 13, 20, 24, 0, 0, 0, 23, 0, 0, 0, 0, 0,
+  0, 18, 0, 9, 0, 0, 0, 0, 0, 1, 11, 10, 16, 19, 4, 27,
+  12, 0, 0, 0, 28, 0, 6, 0, 0, 15, 3, 2, 14, 0, 0, 0,
+  0, 0, 0, 26, 5, 7, 17, 8, 25, 0, 0, 0, 0, 0, 0, 0,
+};
+
+const char *WA_FREQ_177_TOKENS[] = {
+  "元",
+  "ۋە",
+  "بىر",
+  "بۇ",
+  "بىلەن",
+  "ئۇ",
+  "بولغان",
+  "ئۇيغۇر",
+  "دەپ",
+  "بولۇپ،",
+  "ياكى",
+  "ئۇنىڭ",
+  "ھەر",
+  "ئۈچۈن",
+  "بولىدۇ",
+  "مەن",
+  "كېرەك",
+  "بولۇپ",
+  "يەنە",
+  "ئەڭ",
+  "ئىككى",
+  "بار",
+  "شۇ",
+  "قىلىپ",
+  "قىلىش",
+  "قىلغان",
+  "باشقا",
+  "خەلق",
+  "ئۆز",
+  "كېيىن",
+  "بولسا",
+  "بويىچە",
+  "كۆپ",
+  "يىلى",
+  "مىڭ",
+  "دېگەن",
+  "ئېلىپ",
+  "چوڭ",
+  "ياخشى",
+  "قاتارلىق",
+  "ئىدى",
+  "بىز",
+  "خىتاي",
+  "ئارقىلىق",
+  "دۆلەت",
+  "ئۇلار",
+  "ماددا",
+  "خىل",
+  "يېڭى",
+  "ئۇلارنىڭ",
+  "مۇنداق",
+  "ئۇنى",
+  "قانداق",
+  "كەلگەن",
+  "ئىچىدە",
+  "يۇقىرى",
+  "يىل",
+  "ئىگە",
+  "شىنجاڭ",
+  "قىلىدۇ",
+  "مۇھىم",
+  "ھازىر",
+  "ئاپتونوم",
+  "قىلدى",
+  "سىز",
+  "قېتىم",
+  "قىلىپ،",
+  "يەر",
+  "ئادەم",
+  "ھەمدە",
+  "تېخىمۇ",
+  "قىلىنغان",
+  "باش",
+  "ناھايىتى",
+  "ئىش",
+  "بولدى",
+  "ھەم",
+  "كۈنى",
+  "دېدى",
+  "ئەمەس",
+  "ئەگەر",
+  "كېيىن،",
+  "مۇشۇ",
+  "ئەمما",
+  "قارشى",
+  "ئۇيغۇرلار",
+  "ئوخشاش",
+  "ئېلان",
+  "كىشى",
+  "ئىلگىرى",
+  "بۇنىڭ",
+  "زور",
+  "بىرى",
+  "بولسا،",
+  "سۇ",
+  "ئۆزىنىڭ",
+  "ھەققىدە",
+  "بۇنداق",
+  "يول",
+  "كىشىلەر",
+  "ئىنتايىن",
+  "جۇڭگو",
+  "ئۈچ",
+  "پۈتۈن",
+  "شۇڭا",
+  "توغرا",
+  "پەقەت",
+  "يوق",
+  "مەلۇم",
+  "تەلەپ",
+  "نىڭ",
+  "قالغان",
+  "نۇرغۇن",
+  "شەرقىي",
+  "مىللەت",
+  "قانۇن",
+  "مىليون",
+  "قوبۇل",
+  "ئۇيغۇرلارنىڭ",
+  "تەرەپ",
+  "نەچچە",
+  "يىللىق",
+  "ئىكەن",
+  "ئوتتۇرا",
+  "قاراپ",
+  "ئۇنىڭغا",
+  "دۇنيا",
+  "ئىبارەت",
+  "ئالاھىدە",
+  "ھالدا",
+  "نى",
+  "قىلىشقا",
+  "بەرگەن",
+  "بېرىش",
+  "مېنىڭ",
+  "يولغا",
+  "بەزى",
+  "مۇمكىن",
+  "ئامېرىكا",
+  "يۈز",
+  "خىزمەت",
+  "شۇنداق",
+  "شۇنىڭ",
+  "كېلىپ",
+  "ئاز",
+  "لېكىن",
+  "نوپۇس",
+  "بىزنىڭ",
+  "ھەممە",
+  "سوت",
+  "سۆز",
+  "تولۇق",
+  "قاتتىق",
+  "ئۆزى",
+  "يەردە",
+  "بولۇش",
+  "قايسى",
+  "تەرىپىدىن",
+  "مىللىي",
+  "قىلىدىغان",
+  "مەدەنىيەت",
+  "چىڭ",
+  "تۇنجى",
+  "ئۈستىگە",
+  "ھازىرقى",
+  "3",
+  "بولۇشى",
+  "كىچىك",
+  "10",
+  "بولمايدۇ",
+  "ئارتۇق",
+  "باشلاپ",
+  "قىسىم",
+  "كۈن",
+  "ئومۇمىي",
+  "بۇرۇن",
+  "ئاندىن",
+  "ياردەم",
+  "يەنى",
+  "بېرىپ",
+  "ئوتتۇرىغا",
+  "بار،",
+  "چىققان",
+  "چۈنكى",
+  "ئىشقا",
+  "يېقىن",
+  "شەھەر",
+  "بۇنىڭدىن",
+  "سىياسىي",
+  "كىشىلىك",
+  "بولسىمۇ،",
+  "يېزا",
+  "يىلدىن",
+  "پارتىيە",
+  "ئالدى",
+  "بارلىق",
+  "كۈچلۈك",
+  "سىزنىڭ",
+  "ئاساسەن",
+  "ئالغان",
+  "قانچە",
+  "ئورتاق",
+  "خىتاينىڭ",
+  "كىشىلەرنىڭ",
+  "ماڭا",
+  "نېمە",
+  "پۇل",
+  "ئەمەس،",
+  "ئۇنىڭدىن",
+  "توغرىسىدا",
+  "مۇۋاپىق",
+  "مەزكۇر",
+  "2",
+  "تۆۋەن",
+  "ئاساسىي",
+  "قاتناش",
+  "دىن",
+  "ھوقۇق",
+  "ئىجتىمائىي",
+  "كەڭ",
+  "ئالدىنقى",
+  "ئاينىڭ",
+  "كېلىدۇ",
+  "كېيىنكى",
+  "ئۇلارنى",
+  "بەردى",
+  "كەتكەن",
+  "1",
+  "ئىسلام",
+  "بەش",
+  "تىل",
+  "دەرىجىلىك",
+  "مىللەتلەر",
+  "ۋاقىت",
+  "تۇرۇپ",
+  "تىلى",
+  "ئېلىش",
+  "بېرىدۇ",
+  "خەلقئارا",
+  "ئۈرۈمچى",
+  "دىنىي",
+  "5",
+  "ئۈچۈن،",
+  "ئىچىدىكى",
+  "ئۇزۇن",
+  "قاتارلىقلار",
+  "تۈرلۈك",
+  "ئاق",
+  "ئېنىق",
+  "جەھەتتىن",
+  "ئىكەنلىكىنى",
+  "كەلدى",
+  "ھۆكۈمىتى",
+  "قىلىشى",
+  "پەيدا",
+  "ئۆزىگە",
+  "يەرلىك",
+  "سودا",
+  "ئۆزىنى",
+  "ئانا",
+  "مەكتەپ",
+  "ناھىيە",
+  "قەدەر",
+  "قەشقەر",
+  "ئالىي",
+  "شۇنداقلا",
+  "ئاشۇ",
+  "ئاسىيا",
+  "ئالدىدا",
+  "ئاتا",
+  "چىقىپ",
+  "تەسىر",
+  "ياۋروپا",
+  "تەرەققىي",
+  "ئورۇن",
+  "ئېغىر",
+  "بالىلار",
+  "جەھەتتە",
+  "چاغدا",
+  "ئىچىگە",
+  "ھەتتا",
+  "يېرىم",
+  "ئىشلار",
+  "بولۇپمۇ",
+  "لازىم",
+  "ئىلمىي",
+  "سېلىپ",
+  "قەدىمكى",
+  "ناھىيىسى",
+  "ئامېرىكىدا",
+  "بۇنى",
+  "غەربىي",
+  "بەك",
+  "تۆت",
+  "ئون",
+  "ئالاقىدار",
+  "ئىجرا",
+  "شىنجاڭنىڭ",
+  "قايتا",
+  "ـ",
+  "بىلەن،",
+  "مەبلەغ",
+  "شى",
+  "بولىدۇ،",
+  "داۋاملىق",
+  "تۈرك",
+  "رايونى",
+  "سائەت",
+  "قولغا",
+  "4",
+  "ئائىلە",
+  "بولمىغان",
+  "ناملىق",
+  "قارا",
+  "مۇناسىۋەتلىك",
+  "باشقۇرۇش",
+  "تۇرمۇش",
+  "قويۇپ",
+  "قىلىشنى",
+  "قىلىنىدۇ",
+  "تەتقىقات",
+  "چوڭقۇر",
+  "ئىقتىسادىي",
+  "كۆڭۈل",
+  "ھەل",
+  "ئاساس",
+  "بۇيان",
+  "20",
+  "شىركەت",
+  "تەرەققىيات",
+  "ھېسابلىنىدۇ",
+  "ئاساسلىق",
+  "ئۆي",
+  "مەخسۇس",
+  "ھەممىسى",
+  "تۇرىدۇ",
+  "سانى",
+  "دۆلەتنىڭ",
+  "يۈەن",
+  "گۈزەل",
+  "بېرىپ،",
+  "يولى",
+  "دەرىجىدە",
+  "شەھىرى",
+  "مۇشۇنداق",
+  "مەمۇرىي",
+  "چوقۇم",
+  "ئوقۇش",
+  "ئۆتكەن",
+  "ئەپەندى",
+  "بولغاچقا،",
+  "بايان",
+  "رايون",
+  "يەرگە",
+  "بىرەر",
+  "بىللە",
+  "كەتتى",
+  "ئىگىلىك",
+  "ئۇلارغا",
+  "مائارىپ",
+  "جازا",
+  "جەريانىدا",
+  "تىلغا",
+  "قالدى",
+  "ياش",
+  "ھەق",
+  "ئىشنى",
+  "ئارىسىدا",
+  "ئىككىنچى",
+  "خەۋەر",
+  "ئۈمىد",
+  "ھەققىدىكى",
+  "ئەمگەك",
+  "سۇلالىسى",
+  "قويغان",
+  "ئالىدۇ",
+  "ئويۇن",
+  "قۇرۇلۇش",
+  "مو",
+  "مەسئۇل",
+  "ۋاقىتتا",
+  "تۇرغان",
+  "قىلىش،",
+  "كۈچ",
+  "ئەمەلىي",
+  "كۆپرەك",
+  "مېنى",
+  "ئىلتىماس",
+  "مانا",
+  "ھەقىقىي",
+  "تۇتۇپ",
+  "30",
+  "بالا",
+  "قىسمى",
+  "دىنى",
+  "ھۆكۈمىتىنىڭ",
+  "ئىچكى",
+  "تەسىس",
+  "كىشىنىڭ",
+  "نوپۇسى",
+  "بۈگۈنكى",
+  "بىزگە",
+  "بولىدىغان",
+  "بېرىلىدۇ",
+  "جۇڭخۇا",
+  "ئۈستىدە",
+  "ئايرىم",
+  "كىتاب",
+  "قارار",
+  "تەكلىپ",
+  "رايونلۇق",
+  "ھېس",
+  "دەۋرىدە",
+  "تەڭ",
+  "قايتىپ",
+  "ئېدى",
+  "مەھكىمىسى",
+  "تەبىئىي",
+  "لىك",
+  "ئۇيغۇرچە",
+  "چەت",
+  "ھۆكۈم",
+  "كىلومېتىر",
+  "دۇنيادا",
+  "قىلسا",
+  "مۇئاۋىن",
+  "ئىشلارنى",
+  "ئۇزۇنلۇك",
+  "تاڭ",
+  "ۋاقتى",
+  "ۋاقتىدا",
+  "ئالدىغا",
+  "شىركىتى",
+  "قىزىل",
+  "بىرىنچى",
+  "گەپ",
+  "دۇنيادىكى",
+  "تېخنىكا",
+  "ئادەمنىڭ",
+  "تۇز",
+  "كېلىدىغان",
+  "مەسىلەن،",
+  "بەلكى",
+  "داڭلىق",
+  "كۇۋادىرات",
+  "خارىكى",
+  "خىمالىكاڭ",
+  "دىكىبىخاھار",
+  "ئادەتتە",
+  "مېتىر",
+  "500",
+  "تەرىپى",
+  "كۆز",
+  "ئۇيغۇرلارغا",
+  "تارتىپ",
+  "تىلىدا",
+  "تەخمىنەن",
+  "تەرجىمە",
+  "دەل",
+  "نوپۇسىبار،",
+  "جامائەت",
+  "تارىخىي",
+  "نى،",
+  "يەنىلا",
+  "ھەقتە",
+  "ئەينى",
+  "جەنۇبىي",
+  "قىز",
+  "دائىم",
+  "ھازىرغىچە",
+  "قېتىملىق",
+  "ھەرىكەت",
+  "خاس",
+  "دائىرائىقىدا",
+  "ھۆكۈمەت",
+  "ھەمكارلىق",
+  "ئۇيغۇرنىڭ",
+  "6",
+  "ئۆزلىرىنىڭ",
+  "جاۋاب",
+  "نەرسە",
+  "ھاسىل",
+  "تۇرۇش",
+  "ساياھەت",
+  "مەركىزىي",
+  "ئۇزاق",
+  "بەلگىلىمە",
+  "كۆرۈپ",
+  "ئايال",
+  "تور",
+  "ھوقۇقى",
+  "بالىلارنىڭ",
+  "تېز",
+  "رەئىسى",
+  "نامى",
+  "ئاي",
+  "بەلگىلەنگەن",
+  "ئۇنداق",
+  "سەن",
+  "سانلىق",
+  "بىرلىكتە",
+  "100",
+  "خېلى",
+  "قول",
+  "مەركىزى",
+  "ھەرقايسى",
+  "باج",
+  "گرام،",
+  "تەشكىل",
+  "دۇلات",
+  "كۈچى",
+  "سەنئەت",
+  "بۇنىڭغا",
+  "رول",
+  "تۈركىيە",
+  "يېرى",
+  "دۇنياغا",
+  "ئاللاھ",
+  "ئەل",
+  "جىنپىڭ",
+  "ئاتىلىدۇ",
+  "قان",
+  "رەت",
+  "سۈپىتىدە",
+  "قارايدۇ",
+  "ئەمەلگە",
+  "بارغان",
+  "جۇمھۇرىيىتى",
+  "پۈتۈنلەي",
+  "خەلقنىڭ",
+  "كۆرسىتىدۇ",
+  "يۇقىرىقى",
+  "تۇرۇپ،",
+  "15",
+  "دېڭىز",
+  "ساقلاپ",
+  "قويۇلغان",
+  "لېكىن،",
+  "ئاخىرقى",
+  "ئۇرۇش",
+  "بۈگۈن",
+  "قالىدۇ",
+  "قېتىمقى",
+  "نۆۋەتلىك",
+  "ئىنسان",
+  "بىۋاسىتە",
+  "تېخى",
+  "مال",
+  "مەۋجۇت",
+  "7",
+  "باشلىقى",
+  "قىلغۇچى",
+  "نۆۋەتتە",
+  "ھايات",
+  "بولسىمۇ",
+  "تۈركىستان",
+  "خۇددى",
+  "يازغان",
+  "مۇسۇلمان",
+  "تاغ",
+  "قۇرۇلغان",
+  "قەرز",
+  "كۈندىن",
+  "پارچە",
+  "خىزمىتىنى",
+  "قىلىۋاتقان",
+  "تاشقى",
+  "قۇرۇلۇشى",
+  "قەتئىي",
+  "زامان",
+  "ئەمدى",
+  "دەسلەپكى",
+  "قىلىندى",
+  "ئاخبارات",
+  "ئاقسۇ",
+  "ئىلى",
+  "ئۇلۇغ",
+  "بېرىلگەن",
+  "غا",
+  "مىقدارى",
+  "ئېرىشكەن",
+  "بۇرۇنقى",
+  "تەكشۈرۈش",
+  "دىققەت",
+  "دەيدۇ",
+  "باشلىدى",
+  "تېمپېراتۇرىسى",
+  "ئورنى",
+  "باشقىلار",
+  "يېتىپ",
+  "ئاياللار",
+  "ئوتتۇرىچە",
+  "قارىغان",
+  "چىقىش",
+  "ئۇچۇر",
+  "ئەمەلىيەتتە",
+  "باشقىلارنىڭ",
+  "ئوقۇپ",
+  "جايلاشقان",
+  "شىنجاڭدىكى",
+  "قويۇلىدۇ",
+  "پاي",
+  "ئىشلەپچىقىرىش",
+  "ئەسلى",
+  "كەسپىي",
+  "ئانچە",
+  "تاش",
+  "توي",
+  "خوتەن",
+  "قىلىمەن",
+  "د",
+  "قۇرۇلتىيى",
+  "باشقا،",
+  "بېرىشى",
+  "خەلقىنىڭ",
+  "شىمالىي",
+  "شۇنچە",
+  "قوغداش",
+  "كۋادرات",
+  "ھېچ",
+  "12",
+  "50",
+  "تارىخى",
+  "مىليارد",
+  "ئۇيغۇرلارنى",
+  "ق",
+  "كومىتېتى",
+  "كىرگەن",
+  "مەيلى",
+  "ناخشا",
+  "گەرچە",
+  "بىراق",
+  "جايلاخكان،",
+  "قاتناشقان",
+  "ئۇسۇلى",
+  "توپ",
+  "شۇنىڭدىن",
+  "ئەھۋال",
+  "بىلىم",
+  "بەزىلەر",
+  "مەشرەپ",
+  "چىن",
+  "كىشىنى",
+  "مايدانى",
+  "يېقىنقى",
+  "ئائىت",
+  "شىنجاڭغا",
+  "باھا",
+  "جازاسى",
+  "مەسىلە",
+  "ئورنىغا",
+  "ئېلىپ،",
+  "بولسۇن",
+  "بېرىشنى",
+  "داۋام",
+  "شەرقىي تۈركىستان",
+  "قارىغاندا",
+  "قوشۇمچە",
+  "كۆلىمى",
+  "كېلىپ،",
+  "مۇستەقىل",
+  "پەن",
+  "پەيغەمبەر",
+  "ئوت",
+  "ئوغلى",
+  "ئىزچىل",
+  "كومىتېتىنىڭ",
+  "ئېشىپ",
+  "بىكار",
+  "يەردىكى",
+  "ھوقۇقىنى",
+  "ئىشلىرى",
+  "بولغاندىن",
+  "بەزىدە",
+  "دائىرىسى",
+  "دۇنيانىڭ",
+  "يار",
+  "ئاخىرىدا",
+  "كېتىدۇ",
+  "ئىرقىي",
+  "ئۆگىنىش",
+  "ئەركىن",
+  "بولغاندا",
+  "تېلېفون",
+  "تەۋە",
+  "ھەربىي",
+  "ھەرقانداق",
+  "جەمئىيەت",
+  "كەنت",
+  "مەلۇمات",
+  "جىددىي",
+  "جەھەتتىكى",
+  "يېقىندا",
+  "كىلومېتىر،",
+  "تاماق",
+  "تەتقىق",
+  "دېھقانچىلىق",
+  "شىركەتنىڭ",
+  "نەشر",
+  "چۈشۈپ",
+  "8",
+  "ئۇسسۇل",
+  "تاپقان",
+  "تولىمۇ",
+  "تۇرىدىغان",
+  "دەرھال",
+  "قانۇنىي",
+  "ئۆتۈپ",
+  "بەرپا",
+  "جايلاخكان",
+  "دەرياسى",
+  "مۇلازىمەت",
+  "مۇناسىۋىتى",
+  "ئىجارە",
+  "ئىدارە",
+  "ساقچى",
+  "قارىتا",
+  "مەجبۇرىي",
+  "گېكتار",
+  "ئالدىنى",
+  "باي",
+  "قويۇش",
+  "توققۇز",
+  "خانىم",
+  "مەشھۇر",
+  "مەكتەپتە",
+  "ئاتالغان",
+  "ئومۇميۈزلۈك",
+  "ئەنئەنىۋى",
+  "جان",
+  "مەھكىمىسىگە",
+  "تۇتقۇن",
+  "خىزمىتى",
+  "نىشان",
+  "ئەتراپىدا",
+  "بارلىققا",
+  "بۇيان،",
+  "دۇچ",
+  "كاپالەتلىك",
+  "كىرىپ",
+  "كۈندە",
+  "مول",
+  "تۆمۈر",
+  "يەتتە",
+  "ھاۋالە",
+  "ئات",
+  "ئازراق",
+  "ئاساسى",
+  "مەملىكەتلىك",
+  "ئاخىرى",
+  "جىنايەت",
+  "رەسمىي",
+  "سىزنى",
+  "يىلدا",
+  "يېزىپ",
+  "تېگىشلىك",
+  "كېسىم",
+  "كەسىپ",
+  "كەلگەندە",
+  "چىقارغان",
+  "باشقىلارغا",
+  "دائىر",
+  "سان",
+  "سىزگە",
+  "شەكلى",
+  "قويۇپ،",
+  "كىلوگرام،",
+  "ھېچقانداق",
+  "2.",
+  "رولىنى",
+  "كىم",
+  "ئارا",
+  "ئەمما،",
+  "بازار",
+  "باشلىغان",
+  "شۇڭا،",
+  "قاراشلىق",
+  "قويدى",
+  "ھەرىكىتى",
+  "ۋاڭ",
+  "ئىچى",
+  "دەۋا",
+  "شىنجاڭ ئۇيغۇر",
+  "قويىدۇ",
+  "يۇمشاق",
+  "يۈەندىن",
+  "ئىسمى",
+  "ئەر",
+  "شەھىرىنىڭ",
+  "كەسپى",
+  "مەيدانغا",
+  "ئوخشىمىغان",
+  "ئىقتىدارى",
+  "ئەزاسى",
+  "توغرىسىدىكى",
+  "قوش",
+  "مۇھەممەد",
+  "نىسبەتەن",
+  "يوشۇرۇن",
+  "ھىچ",
+  "ئازراق،",
+  "ئاستىدا",
+  "سېلىپ،",
+  "قۇربان",
+  "نامايان",
+  "1.",
+  "ئادا",
+  "تىجارەت",
+  "قاماق",
+  "ئالتۇن",
+  "ئايدا",
+  "ئوقۇغان",
+  "ئەھمىيەت",
+  "دېگەندەك",
+  "ساقلاش",
+  "قىزغىن",
+  "مەملىكەت",
+  "ھەيران",
+  "ئارقىلىق،",
+  "ئۇزۇنلۇقى",
+  "كۆپلىگەن",
+  "ماس",
+  "مىللەتنىڭ",
+  "ئۇيغۇن",
+  "بىزنى",
+  "قانات",
+  "كېلىۋاتقان",
+  "نەرسىنى",
+  "يىپەك",
+  "يېزىلغان",
+  "تىن",
+  "تۇرپان",
+  "تەشكىلاتى",
+  "شەرت",
+  "كۆرسىتىپ",
+  "مۇددەتلىك",
+  "يىغىن",
+  "11",
+  "40",
+  "ئۆزلىرى",
+  "غەرب",
+  "كېرەك،",
+  "مەزگىل",
+  "ئامېرىكىدىكى",
+  "بۇلارنىڭ",
+  "تارمىقى",
+  "قوي",
+  "مەكتەپكە",
+  "نازارەت",
+  "يالغۇز",
+  "پايدىلىق",
+  "ئاشۇنداق",
+  "بۇلۇپ",
+  "جارى",
+  "سانائەت",
+  "قەدەم",
+  "كۆرگەن",
+  "ياسالغان",
+  "تاۋار",
+  "تىلنى",
+  "زۆرۈر",
+  "كەلمەكتە",
+  "مەڭگۈ",
+  "پائالىيەت",
+  "9",
+  "ئەتراپتىكى",
+  "دۆلەتلەر",
+  "قۇرۇپ",
+  "كۈچكە",
+  "چىقىدۇ",
+  "چىقىپ،",
+  "ئالتە",
+  "ئىلھام",
+  "ئىشلىتىش",
+  "ئېغىز",
+  "كونا",
+  "كۈرەش",
+  "نورمال",
+  "يىغىندا",
+  "پىكىر",
+  "گە",
+  "كىشىلەرنى",
+  "يۈرۈش",
+  "روھىي",
+  "كىيىن",
+  "مۇئامىلە",
+  "پۇلى",
+  "چىقتى",
+  "ئەزالىرى",
+  "ئەيسا",
+  "بېرىشكە",
+  "تەرەپكە",
+  "تەرەپنىڭ",
+  "زىيان",
+  "سېلىش",
+  "قىلىشىغا",
+  "ماقالە",
+  "يېڭىدىن",
+  "گۆش",
+  "ئايلىنىپ",
+  "ئېگىز",
+  "ئەنە",
+  "غۇلجا",
+  "تەرەپتىن",
+  "سۆزلەر",
+  "سەل",
+  "شىركىتىنىڭ",
+  "كەم",
+  "ۋاپات",
+  "ئوقۇغۇچىلار",
+  "ئېلىنغان",
+  "دولقۇن",
+  "دە",
+  "70",
+  "ئورۇندا",
+  "بولغاچقا",
+  "بىلدۈردى",
+  "بىلىدۇ",
+  "سەۋەب",
+  "قانچىلىك",
+  "قىرغىنچىلىق",
+  "كەلتۈرۈپ",
+  "مەسىلىسى",
+  "نىسبىتى",
+  "چېگرا",
+  "ھاۋا",
+  "300",
+  "ئوبدان",
+  "ئەرەب",
+  "بىرگە",
+  "مىنۇت",
+  "مۇتلەق",
+  "ئاستى",
+  "ئىبنى",
+  "بارلىقىنى",
+  "قانۇندا",
+  "قىلدىم",
+  "قىممىتى",
+  "يەنىمۇ",
+  "پۈتكۈل",
+  "ئالما",
+  "ئۆزئارا",
+  "ئۆزىڭىزنىڭ",
+  "ئەدەبىيات",
+  "شەھەرلىك",
+  "ئېتىقاد",
+  "بۇلار",
+  "ھۆكۈمەتنىڭ",
+  "بىرىگە",
+  "سۇلالىسىنىڭ",
+  "لى",
+  "چىقىرىش",
+  "ھەرگىزمۇ",
+  "تۇغۇلغان",
+  "تۈركىي",
+  "سەۋەبلىك",
+  "مۇزىكا",
+  "مەيدانى",
+  "يىللاردىن",
+  "ھۆددە",
+  "ھەرگىز",
+  "ئاسان",
+  "ئۈزلۈكسىز",
+  "بولىدىكەن",
+  "جاڭ",
+  "سۈپىتى",
+  "نام",
+  "نەپەر",
+  "ياۋرۇپا",
+  "ئارزۇ",
+  "بۇ،",
+  "جۇڭخۇا خەلق جۇمھۇرىيىتى",
+  "خىلاپلىق",
+  "سىرتىدا",
+  "كۇب",
+  "ئامېرىكىغا",
+  "ئاۋاز",
+  "ئىشلىرىنى",
+  "ئىشلەپ",
+  "ئىكەنلىكى",
+  "خەلقى",
+  "قىلغاندا",
+  "مەيدان",
+  "يىراق",
+  "يۈەنگە",
+  "تەكشۈرۈپ",
+  "دېمەك،",
+  "مەمۇرى",
+  "بولاتتى",
+  "بولمايدىغان",
+  "ئالاقە",
+  "ئوقۇغۇچى",
+  "ئوچۇق",
+  "ئۈنۈملۈك",
+  "ياشقا",
+  "ئىشلەش",
+  "ئۇنىڭدا",
+  "ئۈچىنچى",
+  "توك",
+  "تۇرۇشلۇق",
+};
+const uint16_t WA_FREQ_177_RANKS[] = {
+  0, 401, 554, 854, 0, 0, 0, 0, 0, 9, 754, 0, 455, 611, 0, 626,
+  35, 899, 0, 0, 0, 636, 480, 920, 0, 0, 0, 0, 497, 510, 279, 502,
+  802, 0, 0, 0, 0, 0, 449, 984, 232, 212, 356, 442, 764, 980, 670, 0,
+  0, 753, 0, 0, 0, 0, 0, 0, 0, 989, 347, 0, 0, 131, 674, 0,
+  0, 81, 451, 0, 643, 792, 263, 0, 0, 623, 0, 93, 0, 211, 192, 752,
+  0, 0, 0, 354, 104, 154, 336, 607, 487, 357, 0, 0, 467, 550, 22, 671,
+  895, 61, 657, 159, 493, 860, 266, 917, 544, 0, 0, 0, 0, 312, 0, 0,
+  0, 0, 886, 0, 118, 227, 556, 649, 813, 286, 853, 0, 0, 0, 445, 0,
+  0, 0, 0, 0, 66, 0, 0, 0, 527, 0, 0, 0, 391, 435, 468, 788,
+  0, 0, 0, 0, 0, 0, 290, 0, 0, 0, 133, 0, 0, 0, 0, 664,
+  951, 0, 181, 598, 703, 728, 345, 413, 676, 812, 167, 805, 844, 715, 254, 0,
+  0, 322, 0, 0, 0, 288, 0, 614, 370, 0, 42, 0, 0, 0, 128, 0,
+  78, 0, 765, 299, 0, 224, 0, 0, 0, 0, 887, 0, 311, 913, 947, 12,
+  974, 0, 0, 0, 0, 0, 757, 0, 540, 0, 0, 0, 925, 124, 0, 319,
+  0, 97, 840, 729, 0, 0, 0, 0, 161, 415, 306, 936, 0, 0, 0, 0,
+  77, 0, 0, 0, 0, 0, 0, 0, 0, 430, 0, 108, 173, 732, 780, 827,
+  44, 101, 794, 831, 423, 0, 0, 816, 566, 0, 0, 0, 450, 0, 276, 446,
+  0, 0, 295, 0, 0, 67, 0, 259, 0, 0, 748, 0, 0, 0, 0, 0,
+  0, 593, 0, 735, 0, 185, 158, 400, 0, 177, 363, 531, 0, 0, 866, 136,
+  252, 0, 304, 421, 0, 0, 988, 0, 0, 0, 0, 828, 0, 160, 948, 723,
+  993, 898, 0, 20, 690, 496, 0, 0, 0, 867, 489, 0, 0, 0, 62, 484,
+  269, 0, 172, 0, 0, 0, 0, 0, 0, 961, 819, 0, 0, 0, 0, 0,
+  0, 0, 111, 0, 0, 28, 696, 787, 0, 0, 0, 523, 0, 0, 0, 0,
+  157, 552, 0, 0, 289, 0, 645, 714, 969, 992, 933, 351, 265, 945, 0, 424,
+  309, 0, 0, 244, 791, 0, 0, 0, 0, 64, 0, 0, 0, 0, 734, 0,
+  0, 906, 0, 0, 0, 622, 0, 0, 0, 0, 0, 162, 338, 0, 0, 0,
+  0, 0, 982, 146, 666, 677, 481, 536, 0, 74, 749, 0, 0, 0, 0, 0,
+  0, 0, 0, 838, 169, 270, 956, 613, 627, 32, 915, 529, 707, 736, 861, 600,
+  0, 0, 826, 210, 0, 0, 0, 0, 313, 0, 0, 235, 644, 891, 0, 0,
+  0, 11, 516, 0, 0, 972, 0, 0, 740, 325, 782, 562, 808, 949, 0, 220,
+  418, 0, 0, 955, 824, 971, 0, 0, 0, 464, 0, 0, 0, 719, 0, 96,
+  0, 0, 847, 275, 698, 0, 0, 0, 0, 0, 587, 0, 8, 243, 0, 0,
+  0, 798, 558, 0, 0, 366, 997, 294, 458, 346, 546, 0, 273, 0, 0, 0,
+  0, 0, 938, 576, 0, 687, 264, 21, 448, 685, 661, 742, 373, 784, 814, 204,
+  0, 0, 717, 152, 0, 145, 0, 465, 882, 0, 0, 0, 153, 302, 0, 758,
+  0, 27, 634, 964, 52, 833, 0, 315, 737, 0, 1000, 954, 639, 0, 0, 0,
+  0, 720, 109, 0, 0, 0, 0, 278, 568, 0, 0, 0, 0, 507, 0, 0,
+  902, 50, 0, 0, 0, 0, 384, 0, 0, 0, 0, 0, 0, 332, 120, 150,
+  174, 0, 365, 0, 0, 830, 24, 0, 0, 0, 352, 280, 0, 0, 793, 0,
+  308, 904, 0, 509, 0, 0, 0, 171, 0, 0, 429, 706, 0, 207, 25, 307,
+  597, 909, 0, 0, 0, 73, 572, 609, 431, 820, 321, 0, 790, 0, 0, 0,
+  985, 0, 148, 187, 759, 941, 0, 0, 0, 602, 0, 0, 0, 0, 722, 939,
+  76, 0, 0, 0, 0, 0, 0, 0, 0, 986, 772, 0, 0, 488, 0, 126,
+  337, 494, 862, 0, 0, 113, 434, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 604, 973, 0, 0, 0, 0, 881, 0, 0, 0, 0, 0, 38, 0, 0,
+  518, 134, 616, 75, 0, 0, 916, 0, 222, 260, 0, 0, 0, 0, 0, 482,
+  0, 349, 411, 0, 603, 382, 463, 504, 694, 0, 0, 0, 660, 0, 0, 0,
+  0, 453, 314, 0, 0, 702, 0, 0, 0, 0, 778, 0, 0, 892, 0, 0,
+  282, 998, 0, 0, 379, 0, 200, 51, 0, 526, 0, 129, 371, 533, 747, 962,
+  0, 0, 369, 541, 0, 0, 0, 82, 594, 0, 524, 0, 0, 0, 103, 0,
+  596, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 528, 0, 68, 637, 0,
+  0, 0, 0, 87, 0, 0, 0, 0, 477, 386, 610, 392, 0, 0, 0, 17,
+  0, 408, 426, 859, 0, 0, 731, 632, 779, 0, 0, 121, 80, 328, 647, 0,
+  86, 0, 0, 376, 0, 422, 0, 417, 380, 0, 0, 310, 868, 6, 439, 967,
+  514, 199, 331, 713, 876, 0, 409, 629, 573, 0, 454, 0, 589, 374, 0, 0,
+  796, 0, 0, 324, 0, 953, 0, 834, 960, 999, 678, 0, 0, 0, 0, 0,
+  0, 165, 0, 512, 0, 608, 688, 0, 0, 755, 0, 358, 0, 0, 63, 958,
+  151, 0, 0, 0, 0, 659, 0, 691, 667, 877, 0, 628, 138, 963, 0, 680,
+  697, 786, 70, 0, 508, 0, 0, 874, 262, 733, 98, 140, 584, 721, 928, 0,
+  233, 545, 871, 0, 0, 950, 168, 582, 0, 835, 0, 946, 0, 565, 253, 410,
+  650, 673, 804, 875, 0, 0, 0, 0, 970, 0, 0, 0, 0, 0, 0, 864,
+  0, 0, 0, 561, 567, 0, 621, 0, 60, 251, 0, 869, 0, 944, 0, 0,
+  46, 188, 206, 297, 353, 399, 652, 803, 996, 0, 0, 0, 219, 166, 317, 689,
+  926, 0, 0, 208, 0, 0, 0, 0, 937, 0, 4, 684, 0, 0, 0, 0,
+  94, 475, 601, 599, 547, 889, 965, 389, 849, 143, 105, 979, 0, 0, 45, 268,
+  0, 427, 0, 605, 0, 0, 0, 115, 471, 0, 0, 665, 0, 0, 0, 0,
+  807, 0, 71, 95, 0, 114, 292, 806, 934, 225, 0, 0, 0, 836, 0, 0,
+  23, 0, 202, 330, 0, 0, 296, 724, 85, 0, 456, 0, 821, 0, 580, 0,
+  271, 0, 41, 255, 193, 110, 267, 40, 818, 0, 0, 0, 0, 534, 0, 832,
+  0, 444, 0, 0, 0, 0, 320, 0, 0, 0, 0, 0, 0, 0, 0, 396,
+  0, 0, 0, 0, 26, 0, 0, 0, 0, 846, 0, 0, 39, 0, 0, 683,
+  0, 237, 810, 189, 0, 215, 0, 0, 0, 385, 239, 500, 0, 0, 0, 857,
+  0, 708, 0, 472, 725, 362, 631, 897, 0, 404, 0, 149, 403, 0, 0, 848,
+  592, 850, 0, 0, 0, 0, 563, 491, 0, 0, 0, 930, 0, 799, 0, 414,
+  0, 0, 0, 0, 59, 459, 0, 0, 0, 0, 348, 776, 0, 0, 0, 870,
+  0, 957, 0, 43, 625, 0, 0, 0, 0, 478, 0, 503, 633, 339, 0, 0,
+  0, 0, 0, 741, 0, 72, 397, 761, 825, 447, 0, 0, 0, 538, 762, 0,
+  0, 822, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 530, 672, 37,
+  727, 910, 0, 0, 0, 0, 0, 65, 223, 858, 0, 0, 0, 0, 0, 0,
+  564, 0, 501, 575, 681, 767, 809, 0, 34, 0, 968, 0, 0, 0, 226, 0,
+  0, 182, 89, 839, 595, 0, 0, 692, 92, 815, 469, 383, 532, 896, 0, 571,
+  441, 699, 261, 0, 394, 785, 0, 30, 0, 0, 0, 0, 183, 0, 0, 0,
+  420, 843, 585, 0, 0, 0, 0, 0, 579, 0, 298, 476, 978, 0, 176, 301,
+  31, 542, 865, 195, 0, 555, 942, 522, 0, 0, 0, 743, 88, 0, 0, 0,
+  0, 0, 344, 0, 395, 0, 879, 0, 221, 490, 0, 0, 0, 682, 0, 0,
+  0, 0, 919, 959, 0, 900, 0, 368, 0, 905, 0, 0, 0, 0, 0, 213,
+  0, 272, 0, 0, 281, 0, 0, 0, 0, 0, 0, 0, 712, 783, 704, 0,
+  0, 0, 0, 0, 0, 0, 116, 0, 0, 0, 91, 112, 845, 119, 0, 402,
+  0, 0, 47, 201, 775, 0, 0, 817, 880, 890, 246, 635, 14, 884, 0, 228,
+  709, 0, 0, 0, 612, 0, 0, 0, 0, 654, 872, 492, 432, 0, 412, 0,
+  924, 0, 340, 333, 0, 0, 927, 0, 0, 0, 0, 0, 0, 656, 0, 0,
+  0, 0, 58, 701, 240, 907, 10, 548, 922, 122, 983, 852, 249, 479, 837, 653,
+  0, 473, 54, 0, 0, 0, 323, 231, 0, 766, 981, 393, 795, 191, 829, 0,
+  0, 437, 0, 0, 539, 914, 238, 0, 0, 0, 0, 0, 0, 679, 0, 0,
+  0, 590, 360, 29, 242, 760, 0, 797, 0, 0, 520, 0, 705, 387, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 2, 515, 425, 651, 841, 931, 198, 355, 390,
+  196, 398, 990, 0, 0, 0, 0, 0, 0, 0, 0, 256, 462, 18, 123, 203,
+  686, 0, 381, 495, 726, 0, 5, 190, 214, 746, 987, 137, 578, 0, 0, 0,
+  53, 147, 303, 343, 361, 486, 0, 132, 485, 248, 0, 443, 991, 197, 606, 0,
+  0, 0, 0, 0, 0, 0, 155, 0, 0, 0, 716, 0, 0, 0, 163, 537,
+  0, 0, 0, 0, 756, 619, 107, 617, 781, 0, 293, 0, 428, 0, 0, 0,
+  499, 888, 0, 0, 771, 0, 335, 0, 257, 873, 139, 0, 0, 560, 549, 0,
+  0, 577, 0, 0, 175, 229, 663, 744, 99, 377, 923, 0, 0, 0, 0, 557,
+  711, 0, 0, 0, 372, 0, 0, 0, 0, 0, 316, 0, 416, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 519, 0, 0, 0, 0, 630, 0, 0, 277, 0,
+  591, 300, 0, 0, 0, 0, 908, 0, 0, 574, 0, 0, 127, 0, 0, 457,
+  995, 0, 0, 0, 0, 0, 0, 236, 586, 0, 0, 0, 0, 535, 0, 0,
+  0, 0, 36, 521, 0, 334, 0, 470, 773, 0, 0, 0, 234, 433, 648, 83,
+  0, 911, 0, 247, 498, 0, 0, 0, 0, 0, 0, 0, 0, 0, 855, 218,
+  0, 932, 0, 551, 739, 0, 0, 461, 0, 48, 367, 0, 0, 0, 7, 789,
+  940, 102, 291, 695, 0, 0, 19, 0, 0, 0, 0, 0, 646, 0, 0, 117,
+  0, 16, 156, 342, 668, 49, 0, 0, 0, 250, 570, 0, 388, 0, 406, 559,
+  583, 0, 0, 0, 0, 655, 883, 903, 0, 894, 0, 283, 0, 0, 994, 0,
+  0, 0, 57, 0, 0, 460, 517, 375, 0, 718, 0, 774, 615, 0, 0, 543,
+  0, 0, 0, 751, 0, 0, 0, 0, 0, 0, 976, 205, 0, 0, 0, 90,
+  15, 194, 842, 943, 0, 0, 327, 935, 69, 164, 452, 620, 142, 700, 823, 901,
+  0, 0, 241, 0, 769, 230, 777, 0, 274, 0, 0, 0, 0, 0, 0, 0,
+  0, 588, 0, 738, 0, 0, 0, 0, 745, 750, 0, 0, 0, 0, 0, 56,
+  407, 466, 952, 284, 0, 0, 929, 975, 640, 0, 0, 768, 483, 0, 618, 642,
+  285, 0, 505, 0, 669, 0, 135, 0, 0, 341, 624, 178, 710, 0, 0, 144,
+  318, 0, 0, 0, 0, 0, 359, 801, 180, 305, 856, 811, 966, 0, 0, 0,
+  100, 0, 0, 0, 0, 0, 0, 641, 0, 0, 440, 863, 106, 921, 0, 0,
+  553, 179, 0, 287, 0, 0, 581, 79, 13, 0, 0, 0, 0, 0, 658, 730,
+  0, 525, 885, 0, 0, 216, 0, 0, 506, 675, 693, 770, 0, 0, 0, 0,
+  0, 513, 0, 0, 184, 0, 217, 0, 0, 0, 84, 800, 0, 0, 0, 0,
+  0, 0, 436, 3, 878, 258, 0, 0, 0, 0, 364, 851, 977, 130, 918, 893,
+  329, 405, 170, 569, 125, 245, 209, 350, 55, 511, 662, 378, 0, 763, 0, 638,
+  0, 141, 186, 438, 912, 0, 419, 0, 0, 0, 0, 33, 326, 474, 0, 0,
+};
+
+const char *WA_FREQ_178_TOKENS[] = {
+  "я",
+  "не",
+  "в",
+  "що",
+  "на",
+  "це",
+  "ти",
+  "что",
+  "так",
+  "у",
+  "і",
+  "ты",
+  "и",
+  "это",
+  "з",
+  "а",
+  "ми",
+  "все",
+  "тебе",
+  "він",
+  "як",
+  "за",
+  "ви",
+  "с",
+  "до",
+  "мене",
+  "он",
+  "мені",
+  "ні",
+  "але",
+  "мы",
+  "мне",
+  "да",
+  "как",
+  "просто",
+  "меня",
+  "нет",
+  "тут",
+  "для",
+  "його",
+  "п",
+  "о",
+  "вы",
+  "но",
+  "то",
+  "ну",
+  "знаю",
+  "про",
+  "нас",
+  "вас",
+  "вони",
+  "тебя",
+  "вона",
+  "она",
+  "тобі",
+  "ж",
+  "его",
+  "там",
+  "якщо",
+  "ще",
+  "та",
+  "добре",
+  "щоб",
+  "є",
+  "вам",
+  "по",
+  "нам",
+  "хочу",
+  "коли",
+  "если",
+  "бы",
+  "б",
+  "же",
+  "вже",
+  "було",
+  "її",
+  "був",
+  "они",
+  "може",
+  "чи",
+  "чтобы",
+  "дуже",
+  "від",
+  "хорошо",
+  "чому",
+  "буде",
+  "хто",
+  "есть",
+  "всё",
+  "давай",
+  "тому",
+  "де",
+  "здесь",
+  "треба",
+  "от",
+  "думаю",
+  "к",
+  "когда",
+  "из",
+  "того",
+  "їх",
+  "щось",
+  "гаразд",
+  "был",
+  "цього",
+  "только",
+  "зараз",
+  "было",
+  "может",
+  "нічого",
+  "моя",
+  "тільки",
+  "те",
+  "бути",
+  "один",
+  "уже",
+  "й",
+  "можу",
+  "тепер",
+  "мій",
+  "быть",
+  "ось",
+  "почему",
+  "дякую",
+  "раз",
+  "знаєш",
+  "вот",
+  "могу",
+  "через",
+  "нужно",
+  "всі",
+  "бо",
+  "кто",
+  "будет",
+  "правда",
+  "без",
+  "себе",
+  "більше",
+  "тоді",
+  "час",
+  "день",
+  "ладно",
+  "сейчас",
+  "можна",
+  "була",
+  "их",
+  "боже",
+  "еще",
+  "спасибо",
+  "или",
+  "будь",
+  "йому",
+  "где",
+  "лише",
+  "очень",
+  "была",
+  "ним",
+  "привіт",
+  "них",
+  "чем",
+  "навіть",
+  "ніколи",
+  "знаешь",
+  "этого",
+  "буду",
+  "би",
+  "её",
+  "зі",
+  "ее",
+  "мой",
+  "немає",
+  "ничего",
+  "хочеш",
+  "нього",
+  "цей",
+  "чого",
+  "життя",
+  "этом",
+  "теж",
+  "люди",
+  "твоя",
+  "со",
+  "потому",
+  "сказав",
+  "i",
+  "больше",
+  "теперь",
+  "ещё",
+  "людей",
+  "або",
+  "свою",
+  "привет",
+  "який",
+  "сюди",
+  "таке",
+  "даже",
+  "із",
+  "об",
+  "тобою",
+  "були",
+  "два",
+  "краще",
+  "пока",
+  "ему",
+  "завжди",
+  "хочешь",
+  "должен",
+  "багато",
+  "you",
+  "сьогодні",
+  "ей",
+  "точно",
+  "ласка",
+  "время",
+  "эй",
+  "той",
+  "себя",
+  "надо",
+  "сам",
+  "мною",
+  "тоже",
+  "этот",
+  "має",
+  "что-то",
+  "прошу",
+  "маю",
+  "сказал",
+  "мама",
+  "ли",
+  "зробити",
+  "сказати",
+  "сказала",
+  "назад",
+  "які",
+  "можеш",
+  "тобой",
+  "трохи",
+  "потрібно",
+  "ці",
+  "тогда",
+  "порядке",
+  "ага",
+  "саме",
+  "хотів",
+  "можешь",
+  "під",
+  "три",
+  "никогда",
+  "можете",
+  "років",
+  "собі",
+  "скажи",
+  "него",
+  "пане",
+  "робити",
+  "знову",
+  "твій",
+  "люблю",
+  "пожалуйста",
+  "наш",
+  "ни",
+  "сегодня",
+  "мной",
+  "потім",
+  "ніж",
+  "были",
+  "the",
+  "гей",
+  "дай",
+  "перед",
+  "завтра",
+  "вами",
+  "яка",
+  "одного",
+  "ваша",
+  "конечно",
+  "сделать",
+  "лучше",
+  "цьому",
+  "ваш",
+  "знаєте",
+  "цю",
+  "сказать",
+  "пам",
+  "ніхто",
+  "сюда",
+  "нами",
+  "можливо",
+  "після",
+  "значит",
+  "прямо",
+  "неї",
+  "скільки",
+  "одна",
+  "чудово",
+  "давайте",
+  "бачив",
+  "такий",
+  "кого",
+  "хтось",
+  "сер",
+  "їй",
+  "ця",
+  "мою",
+  "усе",
+  "разом",
+  "їм",
+  "чего",
+  "куди",
+  "звичайно",
+  "справді",
+  "поки",
+  "должны",
+  "всегда",
+  "делать",
+  "мої",
+  "дело",
+  "гроші",
+  "цим",
+  "міг",
+  "том",
+  "маєш",
+  "хіба",
+  "ней",
+  "твой",
+  "этим",
+  "повинен",
+  "друг",
+  "можно",
+  "дня",
+  "досить",
+  "можемо",
+  "зробив",
+  "много",
+  "хотел",
+  "над",
+  "должна",
+  "после",
+  "хоче",
+  "якби",
+  "могли",
+  "місце",
+  "всего",
+  "воно",
+  "часу",
+  "робиш",
+  "хлопці",
+  "вибачте",
+  "додому",
+  "весь",
+  "руки",
+  "ведь",
+  "из-за",
+  "ясно",
+  "возможно",
+  "вибач",
+  "такой",
+  "доктор",
+  "to",
+  "повинні",
+  "эти",
+  "говорить",
+  "мого",
+  "нема",
+  "нб",
+  "йди",
+  "думаешь",
+  "моей",
+  "немного",
+  "навіщо",
+  "господи",
+  "мабуть",
+  "жизнь",
+  "твою",
+  "зачем",
+  "чоловік",
+  "ходімо",
+  "лет",
+  "такое",
+  "случилось",
+  "звідси",
+  "слишком",
+  "мати",
+  "скажу",
+  "скоро",
+  "сталося",
+  "s",
+  "прости",
+  "нормально",
+  "здається",
+  "пані",
+  "a",
+  "всіх",
+  "також",
+  "вместе",
+  "кілька",
+  "брат",
+  "моє",
+  "подобається",
+  "чорт",
+  "сама",
+  "думаєш",
+  "во",
+  "потом",
+  "такого",
+  "казав",
+  "розумію",
+  "батько",
+  "отже",
+  "сделал",
+  "таким",
+  "могла",
+  "тим",
+  "швидше",
+  "жаль",
+  "туди",
+  "речі",
+  "знати",
+  "поэтому",
+  "мог",
+  "свої",
+  "хочете",
+  "помочь",
+  "одну",
+  "всех",
+  "который",
+  "им",
+  "ім",
+  "думав",
+  "можем",
+  "под",
+  "допомогти",
+  "ю",
+  "людина",
+  "куда",
+  "яку",
+  "правильно",
+  "давно",
+  "зовсім",
+  "при",
+  "всю",
+  "бачу",
+  "этой",
+  "снова",
+  "видел",
+  "думала",
+  "така",
+  "знав",
+  "йти",
+  "знайти",
+  "дещо",
+  "домой",
+  "нею",
+  "знає",
+  "наша",
+  "далі",
+  "усі",
+  "парень",
+  "слухай",
+  "ними",
+  "отец",
+  "делаешь",
+  "машину",
+  "нравится",
+  "дійсно",
+  "it",
+  "эту",
+  "мав",
+  "кто-то",
+  "звісно",
+  "вперед",
+  "разу",
+  "никто",
+  "мои",
+  "разве",
+  "сколько",
+  "отлично",
+  "человек",
+  "гадаю",
+  "тот",
+  "слова",
+  "звідки",
+  "шкода",
+  "справа",
+  "чим",
+  "ті",
+  "проти",
+  "похоже",
+  "мамо",
+  "піти",
+  "чарлі",
+  "свого",
+  "номер",
+  "справи",
+  "дома",
+  "пару",
+  "такі",
+  "знала",
+  "хотела",
+  "одно",
+  "тож",
+  "голову",
+  "знать",
+  "сім",
+  "нехай",
+  "понимаю",
+  "увазі",
+  "поговорить",
+  "знаете",
+  "фп",
+  "син",
+  "место",
+  "иди",
+  "бачиш",
+  "кажется",
+  "найти",
+  "свій",
+  "тобто",
+  "взагалі",
+  "пішли",
+  "сказали",
+  "ять",
+  "будешь",
+  "хочет",
+  "будеш",
+  "жизни",
+  "деньги",
+  "слушай",
+  "відбувається",
+  "розумієш",
+  "кбй",
+  "ме",
+  "эта",
+  "пішов",
+  "мистер",
+  "наші",
+  "якого",
+  "поговорити",
+  "порядку",
+  "что-нибудь",
+  "ой",
+  "думал",
+  "хоч",
+  "оу",
+  "ваше",
+  "тих",
+  "проблема",
+  "хотіла",
+  "роботу",
+  "ради",
+  "ох",
+  "будемо",
+  "двері",
+  "хлопець",
+  "потрібна",
+  "будем",
+  "стоит",
+  "знает",
+  "світ",
+  "чув",
+  "времени",
+  "майже",
+  "м",
+  "тату",
+  "можуть",
+  "именно",
+  "пора",
+  "зрозумів",
+  "насправді",
+  "своей",
+  "бачити",
+  "которые",
+  "швидко",
+  "тато",
+  "совсем",
+  "твої",
+  "всем",
+  "лишь",
+  "цих",
+  "говорил",
+  "бог",
+  "еянбй",
+  "кажу",
+  "наших",
+  "простите",
+  "схоже",
+  "права",
+  "своє",
+  "говорю",
+  "дом",
+  "чувак",
+  "сильно",
+  "піду",
+  "слово",
+  "раніше",
+  "ту",
+  "будуть",
+  "моего",
+  "потрібен",
+  "пґп",
+  "алло",
+  "питання",
+  "між",
+  "прийшов",
+  "доброго",
+  "тем",
+  "жінка",
+  "должно",
+  "знал",
+  "какой",
+  "смерть",
+  "b1",
+  "дітей",
+  "деле",
+  "добрий",
+  "шанс",
+  "нужна",
+  "одне",
+  "десь",
+  "сэр",
+  "колись",
+  "мало",
+  "означає",
+  "chffffff",
+  "черт",
+  "ніби",
+  "ваші",
+  "fntahoma",
+  "i0",
+  "твоей",
+  "fs52",
+  "говорити",
+  "друга",
+  "a2",
+  "происходит",
+  "геть",
+  "всього",
+  "that",
+  "варто",
+  "значить",
+  "яке",
+  "інші",
+  "and",
+  "досі",
+  "зв",
+  "раньше",
+  "руку",
+  "аби",
+  "туда",
+  "твоє",
+  "джон",
+  "маєте",
+  "занадто",
+  "хай",
+  "действительно",
+  "дві",
+  "маємо",
+  "план",
+  "in",
+  "уверен",
+  "пошли",
+  "чём",
+  "ден",
+  "довго",
+  "хватит",
+  "каже",
+  "своїх",
+  "кое-что",
+  "нашу",
+  "великий",
+  "нужен",
+  "побачити",
+  "щодо",
+  "біса",
+  "понял",
+  "ребята",
+  "папа",
+  "отсюда",
+  "несколько",
+  "біля",
+  "верно",
+  "жити",
+  "послухай",
+  "правду",
+  "we",
+  "идти",
+  "хороший",
+  "твои",
+  "негайно",
+  "ким",
+  "свои",
+  "уж",
+  "мать",
+  "пор",
+  "иб",
+  "говорила",
+  "оно",
+  "дела",
+  "хвилин",
+  "далеко",
+  "таких",
+  "вашу",
+  "мушу",
+  "свой",
+  "робота",
+  "t",
+  "работу",
+  "хотите",
+  "нее",
+  "усіх",
+  "будете",
+  "дайте",
+  "батька",
+  "убить",
+  "машина",
+  "важко",
+  "итак",
+  "твого",
+  "тех",
+  "легко",
+  "самом",
+  "очі",
+  "хоча",
+  "ко",
+  "кожен",
+  "спасибі",
+  "щойно",
+  "против",
+  "виду",
+  "имя",
+  "собою",
+  "курва",
+  "діти",
+  "цієї",
+  "вообще",
+  "світі",
+  "me",
+  "роботи",
+  "доведеться",
+  "погано",
+  "рада",
+  "понимаешь",
+  "готовий",
+  "ах",
+  "перший",
+  "вбити",
+  "працює",
+  "грошей",
+  "знайшов",
+  "робить",
+  "радий",
+  "кому",
+  "ніч",
+  "року",
+  "говори",
+  "момент",
+  "дивись",
+  "серйозно",
+  "напевно",
+  "такая",
+  "надеюсь",
+  "послушай",
+  "роки",
+  "землі",
+  "заради",
+  "стій",
+  "неё",
+  "проблем",
+  "честь",
+  "мпх",
+  "вітаю",
+  "ранку",
+  "говорит",
+  "телефон",
+  "зробили",
+  "вдома",
+  "равно",
+  "каждый",
+  "жить",
+  "будинок",
+  "брата",
+  "іди",
+  "король",
+  "бачили",
+  "круто",
+  "подожди",
+  "знаємо",
+  "будут",
+  "потрібні",
+  "сын",
+  "цій",
+  "нельзя",
+  "дам",
+  "смерті",
+  "возьми",
+  "знали",
+  "ноги",
+  "старий",
+  "моєї",
+  "убил",
+  "хотя",
+  "этих",
+  "когось",
+  "тихо",
+  "хоть",
+  "взяти",
+  "побачення",
+  "новий",
+  "проблеми",
+  "бувай",
+  "джек",
+  "місці",
+  "будто",
+  "сестра",
+  "моїх",
+  "містер",
+  "слід",
+  "бачила",
+  "стати",
+  "извини",
+  "наверное",
+  "готова",
+  "нашого",
+  "готов",
+  "видеть",
+  "этому",
+  "якось",
+  "пойду",
+  "прекрасно",
+  "джо",
+  "вся",
+  "отче",
+  "своего",
+  "посмотри",
+  "рік",
+  "бога",
+  "повинна",
+  "всім",
+  "другой",
+  "мала",
+  "зачекай",
+  "наче",
+  "наше",
+  "видела",
+  "откуда",
+  "кінець",
+  "чоловіка",
+  "знайшли",
+  "рядом",
+  "працювати",
+  "візьми",
+  "річ",
+  "дитина",
+  "he",
+  "сина",
+  "інших",
+  "нарешті",
+  "зовут",
+  "ночь",
+  "мам",
+  "двох",
+  "якийсь",
+  "смогу",
+  "здорово",
+  "надто",
+  "йде",
+  "пойти",
+  "вижу",
+  "of",
+  "мають",
+  "кажуть",
+  "мир",
+  "агов",
+  "абсолютно",
+  "чотири",
+  "звати",
+  "видишь",
+  "сделала",
+  "більш",
+  "прав",
+  "ночі",
+  "зрозуміло",
+  "m",
+  "нe",
+  "маленький",
+  "місто",
+  "достаточно",
+  "моїм",
+  "йдемо",
+  "лайно",
+  "часто",
+  "дні",
+  "впевнений",
+  "собираюсь",
+  "человека",
+  "моєму",
+  "стільки",
+  "зроблю",
+  "говорив",
+  "друже",
+  "йду",
+  "почти",
+  "ідея",
+  "днів",
+  "дати",
+  "людям",
+  "чуєш",
+  "інакше",
+  "минут",
+  "зможу",
+  "скажеш",
+  "месте",
+  "пан",
+  "ятаєш",
+  "вопрос",
+  "могут",
+  "между",
+  "дружина",
+  "світу",
+  "землю",
+  "говоришь",
+  "извините",
+  "кров",
+  "помощь",
+  "быстро",
+  "будинку",
+  "вашого",
+  "вірно",
+  "которая",
+  "десять",
+  "долго",
+  "твоего",
+  "вроде",
+  "ваших",
+  "no",
+  "вообще-то",
+  "вб",
+  "детей",
+  "люба",
+  "одним",
+  "смотри",
+  "вещи",
+  "what",
+  "яким",
+  "іншого",
+  "своїм",
+  "ятаю",
+  "важно",
+  "самого",
+  "розумієте",
+  "on",
+  "гарно",
+  "произошло",
+  "тримай",
+  "серце",
+  "забудь",
+  "более",
+  "хочуть",
+  "рад",
+  "собой",
+  "яких",
+  "нікого",
+  "справу",
+  "имею",
+  "цікаво",
+  "вчора",
+  "слышал",
+  "гарна",
+  "став",
+  "самое",
+  "житті",
+  "самі",
+  "любить",
+  "нашли",
+  "говорили",
+  "спати",
+  "знаем",
+  "друзі",
+  "уверена",
+  "рано",
+  "парня",
+  "поглянь",
+  "повернутися",
+  "увидеть",
+  "мило",
+  "дав",
+  "щo",
+  "отца",
+  "прийшли",
+  "вернуться",
+  "такие",
+  "інше",
+  "первый",
+  "вина",
+  "х",
+  "деякі",
+  "своих",
+  "помер",
+  "інший",
+  "зробила",
+};
+const uint16_t WA_FREQ_178_RANKS[] = {
+  935, 733, 966, 0, 631, 0, 449, 122, 0, 199, 293, 0, 0, 0, 213, 546,
+  219, 0, 547, 0, 0, 388, 241, 720, 806, 0, 0, 499, 0, 0, 19, 191,
+  482, 827, 970, 253, 282, 684, 0, 0, 913, 0, 554, 796, 0, 0, 0, 0,
+  0, 833, 0, 0, 838, 0, 0, 440, 0, 735, 0, 540, 352, 564, 0, 0,
+  0, 0, 362, 768, 0, 0, 0, 0, 375, 502, 832, 0, 598, 592, 662, 115,
+  44, 368, 0, 0, 843, 238, 522, 42, 301, 650, 439, 878, 46, 870, 0, 0,
+  0, 350, 862, 31, 0, 0, 67, 824, 256, 0, 0, 0, 0, 0, 0, 437,
+  133, 334, 0, 0, 0, 0, 0, 0, 0, 473, 331, 555, 0, 857, 788, 341,
+  892, 0, 584, 685, 475, 0, 0, 0, 0, 0, 992, 0, 478, 75, 677, 818,
+  0, 531, 667, 872, 688, 0, 0, 0, 70, 589, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 901, 246, 495, 174, 237, 865, 0, 0, 0, 69, 427, 0,
+  150, 0, 0, 321, 308, 952, 50, 0, 0, 0, 0, 434, 457, 0, 0, 0,
+  0, 0, 0, 0, 77, 0, 671, 73, 780, 162, 175, 314, 376, 232, 412, 630,
+  0, 116, 0, 0, 0, 149, 963, 578, 395, 982, 770, 274, 0, 0, 0, 0,
+  734, 0, 109, 0, 403, 399, 657, 0, 0, 0, 0, 0, 0, 0, 271, 277,
+  504, 800, 420, 0, 0, 361, 0, 146, 0, 0, 393, 0, 0, 0, 192, 923,
+  0, 0, 0, 0, 877, 942, 0, 0, 0, 353, 48, 759, 851, 443, 566, 212,
+  130, 472, 910, 424, 777, 694, 973, 0, 579, 0, 0, 0, 0, 455, 0, 0,
+  543, 0, 582, 66, 766, 0, 0, 0, 0, 485, 214, 0, 262, 563, 0, 544,
+  121, 0, 616, 95, 508, 856, 0, 479, 0, 0, 416, 107, 327, 0, 155, 195,
+  0, 0, 928, 0, 0, 0, 0, 0, 347, 689, 836, 596, 312, 941, 103, 453,
+  180, 577, 152, 990, 225, 0, 0, 0, 762, 0, 270, 110, 812, 49, 0, 0,
+  0, 39, 0, 587, 0, 432, 0, 206, 16, 286, 803, 372, 0, 0, 0, 0,
+  142, 0, 0, 0, 157, 333, 0, 0, 686, 0, 0, 273, 960, 0, 0, 54,
+  0, 0, 0, 676, 0, 0, 0, 309, 250, 0, 0, 0, 0, 0, 0, 602,
+  0, 0, 476, 0, 0, 363, 463, 802, 635, 702, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 737, 0, 890, 0, 0, 0, 144, 181, 536, 709, 0, 0, 189,
+  140, 556, 835, 392, 977, 571, 792, 0, 767, 283, 0, 0, 0, 0, 326, 723,
+  0, 0, 0, 164, 0, 65, 276, 0, 815, 998, 0, 801, 0, 0, 0, 0,
+  456, 537, 0, 0, 0, 0, 0, 944, 0, 834, 852, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 756, 0, 661, 0, 390, 0, 417, 0, 0, 0, 0,
+  881, 0, 230, 915, 0, 433, 0, 0, 267, 0, 0, 608, 235, 769, 997, 607,
+  0, 0, 0, 534, 886, 0, 0, 0, 0, 0, 0, 0, 871, 0, 0, 147,
+  0, 798, 0, 13, 389, 467, 340, 541, 0, 560, 0, 0, 0, 459, 127, 696,
+  805, 0, 0, 0, 99, 0, 0, 0, 345, 697, 0, 0, 0, 516, 604, 946,
+  0, 91, 645, 850, 0, 561, 978, 0, 585, 853, 258, 828, 0, 0, 0, 0,
+  995, 35, 172, 627, 0, 0, 0, 761, 0, 0, 0, 0, 454, 0, 0, 0,
+  0, 774, 0, 0, 0, 0, 0, 0, 0, 0, 847, 644, 72, 194, 526, 939,
+  0, 0, 450, 640, 0, 0, 188, 0, 0, 0, 0, 0, 0, 567, 261, 633,
+  738, 0, 781, 778, 675, 0, 0, 0, 41, 257, 295, 0, 784, 448, 0, 0,
+  908, 0, 0, 101, 0, 481, 338, 36, 47, 184, 572, 653, 841, 302, 223, 848,
+  790, 510, 999, 0, 0, 821, 0, 0, 0, 601, 829, 0, 0, 825, 0, 0,
+  38, 0, 533, 538, 30, 968, 0, 61, 994, 80, 318, 609, 40, 0, 562, 0,
+  436, 0, 0, 0, 0, 0, 0, 0, 248, 932, 691, 0, 0, 0, 0, 0,
+  744, 0, 0, 156, 0, 0, 15, 0, 0, 0, 0, 956, 329, 0, 0, 0,
+  0, 0, 0, 0, 0, 118, 0, 0, 0, 0, 0, 97, 461, 0, 888, 0,
+  732, 59, 736, 0, 0, 0, 0, 442, 742, 12, 0, 0, 985, 0, 0, 0,
+  0, 0, 0, 0, 0, 887, 0, 0, 0, 281, 0, 0, 795, 558, 400, 933,
+  0, 0, 27, 14, 0, 0, 222, 452, 369, 498, 673, 922, 991, 0, 0, 0,
+  159, 786, 597, 904, 154, 794, 0, 0, 660, 208, 0, 0, 346, 151, 929, 0,
+  648, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 83, 712, 32, 989,
+  0, 0, 0, 68, 0, 210, 678, 0, 0, 259, 783, 958, 0, 674, 305, 218,
+  406, 515, 588, 875, 931, 0, 18, 0, 0, 927, 33, 351, 0, 0, 898, 981,
+  0, 0, 55, 330, 606, 909, 751, 415, 855, 570, 962, 0, 0, 511, 722, 0,
+  0, 0, 889, 0, 139, 0, 0, 290, 470, 749, 0, 0, 0, 0, 185, 860,
+  0, 714, 0, 0, 0, 342, 705, 0, 201, 0, 0, 0, 0, 108, 324, 654,
+  0, 0, 310, 0, 0, 0, 600, 0, 0, 0, 0, 0, 0, 0, 62, 187,
+  0, 105, 126, 542, 729, 595, 730, 793, 0, 0, 0, 810, 0, 565, 0, 0,
+  137, 0, 0, 0, 861, 465, 0, 0, 0, 0, 765, 950, 431, 707, 0, 0,
+  153, 523, 911, 0, 964, 823, 0, 0, 22, 319, 489, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 245, 0, 0, 285, 292, 668, 936, 943, 0, 413, 0, 0,
+  252, 497, 316, 980, 229, 703, 797, 0, 0, 0, 882, 894, 0, 0, 0, 145,
+  545, 906, 0, 0, 509, 0, 0, 79, 0, 236, 0, 243, 423, 755, 0, 0,
+  409, 0, 0, 335, 557, 0, 183, 0, 0, 0, 0, 0, 641, 0, 787, 681,
+  876, 921, 0, 0, 26, 0, 0, 0, 0, 840, 0, 0, 17, 513, 228, 322,
+  813, 336, 85, 0, 628, 0, 0, 0, 0, 826, 387, 535, 0, 0, 0, 719,
+  402, 487, 141, 87, 356, 706, 918, 0, 0, 477, 0, 396, 743, 120, 0, 377,
+  4, 0, 280, 10, 132, 0, 0, 0, 444, 0, 0, 0, 0, 430, 300, 231,
+  471, 619, 775, 0, 831, 100, 819, 0, 249, 63, 0, 0, 161, 169, 200, 337,
+  612, 89, 679, 782, 0, 574, 0, 143, 0, 0, 315, 0, 914, 0, 0, 484,
+  576, 0, 0, 0, 125, 378, 410, 0, 869, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 64, 658, 58, 947, 0, 0, 0, 1, 791, 0, 0, 0,
+  799, 21, 974, 937, 279, 0, 0, 92, 483, 251, 0, 0, 0, 0, 503, 3,
+  763, 984, 0, 0, 529, 60, 173, 752, 0, 599, 56, 224, 264, 621, 0, 0,
+  0, 0, 0, 23, 0, 0, 468, 0, 0, 0, 0, 0, 0, 0, 0, 610,
+  289, 0, 0, 0, 0, 0, 0, 528, 0, 0, 0, 728, 205, 632, 265, 367,
+  0, 344, 451, 0, 0, 0, 754, 954, 404, 0, 385, 51, 0, 86, 625, 0,
+  0, 8, 753, 0, 514, 539, 0, 0, 428, 750, 725, 979, 0, 486, 28, 590,
+  466, 501, 647, 0, 698, 919, 255, 0, 268, 71, 926, 0, 808, 0, 313, 525,
+  986, 0, 682, 106, 343, 594, 0, 0, 0, 0, 637, 629, 0, 0, 0, 591,
+  0, 0, 0, 0, 0, 170, 284, 288, 93, 307, 320, 426, 804, 917, 580, 0,
+  0, 0, 0, 0, 0, 0, 0, 772, 0, 0, 0, 0, 299, 0, 0, 24,
+  275, 0, 384, 0, 0, 0, 0, 414, 294, 462, 669, 842, 0, 839, 0, 398,
+  179, 0, 0, 896, 976, 0, 0, 0, 0, 0, 0, 0, 0, 0, 401, 0,
+  386, 0, 374, 0, 0, 0, 822, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 45, 0, 611, 0, 405, 0, 837, 240, 0, 0, 863, 2, 227, 552,
+  0, 0, 0, 0, 586, 163, 7, 0, 649, 0, 0, 136, 0, 0, 0, 160,
+  407, 897, 953, 0, 0, 0, 306, 0, 0, 0, 458, 930, 0, 550, 198, 811,
+  0, 0, 907, 365, 0, 0, 254, 0, 226, 0, 0, 419, 244, 817, 773, 0,
+  311, 746, 221, 603, 0, 0, 0, 0, 0, 0, 0, 664, 0, 623, 332, 666,
+  0, 0, 0, 883, 298, 123, 0, 266, 0, 1000, 0, 0, 0, 0, 0, 0,
+  0, 717, 0, 0, 859, 0, 94, 0, 993, 757, 165, 446, 349, 0, 0, 421,
+  0, 0, 0, 961, 0, 380, 739, 955, 969, 325, 0, 260, 0, 636, 873, 983,
+  916, 0, 891, 287, 0, 0, 0, 0, 0, 0, 296, 0, 0, 114, 383, 0,
+  0, 0, 124, 207, 355, 269, 190, 492, 593, 959, 613, 429, 0, 102, 0, 0,
+  0, 0, 0, 0, 581, 741, 0, 0, 0, 0, 0, 0, 382, 6, 776, 0,
+  0, 11, 0, 0, 844, 0, 88, 708, 924, 905, 0, 148, 0, 90, 530, 177,
+  0, 209, 0, 0, 117, 0, 186, 573, 0, 507, 874, 987, 0, 119, 211, 716,
+  789, 0, 0, 0, 0, 0, 0, 303, 0, 167, 52, 104, 438, 884, 500, 945,
+  78, 494, 721, 0, 0, 0, 0, 0, 858, 182, 524, 0, 0, 0, 0, 521,
+  0, 0, 948, 0, 614, 0, 0, 0, 900, 920, 0, 0, 371, 491, 553, 618,
+  760, 0, 0, 0, 247, 0, 0, 5, 0, 816, 0, 158, 0, 196, 0, 0,
+  615, 820, 96, 239, 975, 0, 0, 518, 895, 0, 0, 0, 624, 646, 328, 0,
+  0, 0, 713, 0, 0, 0, 0, 480, 0, 0, 422, 642, 846, 957, 0, 323,
+  445, 0, 505, 0, 0, 0, 0, 0, 0, 569, 809, 0, 178, 460, 339, 0,
+  0, 0, 408, 699, 0, 0, 0, 0, 0, 740, 0, 0, 0, 171, 549, 0,
+  0, 693, 0, 0, 128, 0, 0, 474, 0, 0, 0, 354, 512, 138, 113, 551,
+  129, 0, 411, 0, 0, 0, 0, 0, 0, 168, 0, 53, 84, 0, 197, 166,
+  814, 0, 0, 0, 0, 0, 0, 0, 849, 0, 0, 359, 634, 0, 0, 0,
+  0, 771, 0, 0, 885, 925, 971, 202, 626, 683, 692, 0, 0, 710, 0, 0,
+  0, 0, 0, 0, 519, 0, 0, 0, 0, 575, 0, 0, 731, 37, 0, 0,
+  490, 972, 0, 520, 263, 527, 651, 695, 747, 785, 0, 0, 0, 0, 672, 291,
+  0, 745, 193, 879, 0, 496, 0, 0, 643, 779, 0, 379, 0, 0, 0, 934,
+  988, 0, 0, 0, 98, 715, 0, 0, 215, 233, 0, 0, 548, 951, 0, 0,
+  680, 0, 0, 517, 866, 0, 76, 176, 701, 0, 0, 903, 0, 617, 949, 394,
+  0, 0, 25, 9, 807, 726, 0, 0, 0, 0, 0, 272, 0, 297, 0, 0,
+  0, 217, 0, 81, 0, 135, 20, 0, 57, 0, 0, 447, 0, 111, 764, 220,
+  622, 868, 43, 965, 0, 0, 902, 0, 718, 940, 0, 0, 704, 0, 0, 559,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 74, 317, 880, 0, 0,
+  0, 0, 532, 670, 0, 0, 0, 358, 418, 360, 0, 441, 665, 854, 996, 0,
+  0, 912, 568, 727, 0, 0, 0, 0, 690, 0, 435, 0, 0, 0, 0, 0,
+  652, 0, 0, 0, 0, 0, 0, 0, 488, 687, 0, 0, 0, 0, 0, 0,
+  370, 112, 0, 278, 0, 700, 0, 0, 242, 830, 659, 0, 134, 655, 0, 0,
+  0, 0, 29, 0, 656, 0, 0, 469, 0, 845, 0, 893, 0, 0, 203, 0,
+  304, 0, 748, 0, 639, 364, 0, 0, 357, 397, 216, 34, 0, 583, 724, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 493, 605, 82, 425, 638, 0, 0, 0,
+  0, 0, 0, 0, 0, 131, 0, 0, 366, 234, 391, 663, 464, 864, 899, 204,
+  758, 711, 967, 373, 0, 0, 381, 938, 0, 0, 0, 620, 0, 506, 348, 867,
+};
+
+const char *WA_FREQ_179_TOKENS[] = {
+  "na",
+  "ko",
+  "a",
+  "lo",
+  "i",
+  "yi",
+  "ŋutu",
+  "ti",
+  "do",
+  "kulo",
+  "nan",
+  "ŋo",
+  "kune",
+  "kenda",
+  "di",
+  "ŋojik",
+  "but",
+  "ni",
+  "parik",
+  "gboŋ",
+  "nagon",
+  "naŋ",
+  "kode",
+  "kata",
+  "mede",
+  "ŋarakinda",
+  "de",
+  "liŋ",
+  "logon",
+  "anyen",
+  "yu",
+  "dok",
+  "tikinda",
+  "jore",
+  "lepeŋ",
+  "mugun",
+  "jur",
+  "sukulu",
+  "koko",
+  "kulya",
+  "kaŋ",
+  "loŋ",
+  "kilo",
+  "ka",
+  "diŋit",
+  "pirit",
+  "börik",
+  "pujö",
+  "gboke",
+  "ŋutuu",
+  "ret",
+  "ŋiro",
+  "kuwe",
+  "to",
+  "tu",
+  "ba",
+  "nagoŋ",
+  "bgoŋ",
+  "gbe",
+  "geleŋ",
+  "kase",
+  "denda",
+  "kita",
+  "nye",
+  "ma",
+  "bubulö",
+  "boŋ",
+  "togeleŋ",
+  "se",
+  "diŋitan",
+  "kule",
+  "n",
+  "bura",
+  "kine",
+  "niyo",
+  "konda",
+  "bakan",
+  "logoŋ",
+  "tinda",
+  "ban",
+  "nyanyar",
+  "bge",
+  "gurusu",
+  "yala",
+  "ŋwajik",
+  "köti",
+  "yani",
+  "si",
+  "kiko",
+  "wini",
+  "ta",
+  "nawate",
+  "wate",
+  "dik",
+  "da",
+  "kikolin",
+  "kodo",
+  "piyoŋ",
+  "moka",
+  "ama",
+  "kitajin",
+  "jonda",
+  "ködö",
+  "kega",
+  "aa",
+  "ya",
+  "mindi",
+  "nene",
+  "musala",
+  "meda",
+  "kikölin",
+  "kaaŋ",
+  "piöŋ",
+  "wörö",
+  "midijin",
+  "ee",
+  "ŋutulu",
+  "lakin",
+  "ŋerot",
+  "nyo",
+  "durjö",
+  "gboso",
+  "ke",
+  "busan",
+  "nayit",
+  "tindi",
+  "yesu",
+  "yilo",
+  "puji",
+  "jibitali",
+  "murek",
+  "nake",
+  "tomurek",
+  "nyesu",
+  "tiyana",
+  "ayan",
+  "perok",
+  "yapa",
+  "net",
+  "kadi",
+  "lele",
+  "kak",
+  "kinyo",
+  "um",
+  "ponda",
+  "deden",
+  "lu",
+  "toto",
+  "bgoke",
+  "kogboŋ",
+  "bulit",
+  "nu",
+  "pele",
+  "riŋit",
+  "yina",
+  "bulötö",
+  "yola",
+  "ki",
+  "den",
+  "deti",
+  "wasaka",
+  "niyaŋ",
+  "tiyanana",
+  "tiju",
+  "e",
+  "bulö",
+  "suluja",
+  "lor",
+  "piritön",
+  "koo",
+  "tiki",
+  "kokon",
+  "sukuluöt",
+  "ŋaŋarakinda",
+  "luwalet",
+  "luŋu",
+  "weweja",
+  "gurusutöt",
+  "an",
+  "jambu",
+  "wora",
+  "ŋun",
+  "miyen",
+  "nageleŋ",
+  "katani",
+  "möju",
+  "kuru",
+  "keriyat",
+  "gbeŋge",
+  "adi",
+  "aje",
+  "kulu",
+  "bo",
+  "nago",
+  "tikindi",
+  "mukök",
+  "bu",
+  "dolak",
+  "kinyotot",
+  "nyu",
+  "bijo",
+  "taliŋ",
+  "reto",
+  "asan",
+  "kenisa",
+  "sa",
+  "daŋin",
+  "let",
+  "kon",
+  "dit",
+  "beron",
+  "tokitaju",
+  "bgwoke",
+  "tema",
+  "kulye",
+  "bot",
+  "dukö",
+  "kpeja",
+  "lepeŋat",
+  "narok",
+  "lalaju",
+  "ku",
+  "nyen",
+  "naron",
+  "yeiyesi",
+  "todindö",
+  "yukan",
+  "sukuluwöt",
+  "ŋarakindi",
+  "gurut",
+  "bgenge",
+  "kayaŋ",
+  "manyen",
+  "ŋarju",
+  "kunu",
+  "barik",
+  "liyaŋ",
+  "döti",
+  "yapani",
+  "moga",
+  "miindi",
+  "gbon",
+  "ye",
+  "wo",
+  "kuku",
+  "kinyojin",
+  "ŋete",
+  "pupu",
+  "dinyo",
+  "molu",
+  "tokenda",
+  "tengu",
+  "ilo",
+  "yo",
+  "liyo",
+  "simu",
+  "tögu",
+  "burusut",
+  "ne",
+  "logo",
+  "toyiŋakin",
+  "bukan",
+  "waran",
+  "bi",
+  "kogwon",
+  "bgwoŋ",
+  "nase",
+  "dera",
+  "temba",
+  "so",
+  "du",
+  "kimaŋ",
+  "kiden",
+  "kimur",
+  "mimiyen",
+  "jibitalia",
+  "jondi",
+  "jujukin",
+  "kwakwadu",
+  "yiti",
+  "derja",
+  "deneden",
+  "ben",
+  "kudu",
+  "loputu",
+  "kobgoŋ",
+  "koŋon",
+  "pusök",
+  "yöyöŋesi",
+  "konye",
+  "kendi",
+  "rima",
+  "le",
+  "ropa",
+  "keri",
+  "loron",
+  "bayin",
+  "medda",
+  "kurundö",
+  "koke",
+  "duma",
+  "kukuwesi",
+  "kura",
+  "wulek",
+  "junya",
+  "momorani",
+  "kutuk",
+  "gari",
+  "kinyöjin",
+  "suluji",
+  "jujumbu",
+  "roba",
+  "jo",
+  "gbokiyot",
+  "loke",
+  "tojulin",
+  "tujarju",
+  "deyiye",
+  "nyesi",
+  "dendi",
+  "yinga",
+  "borik",
+  "petesi",
+  "könisi",
+  "kekenda",
+  "yeyesi",
+  "meta",
+  "winikö",
+  "monye",
+  "luwaliyan",
+  "momora",
+  "kikö",
+  "kiŋajin",
+  "medi",
+  "ann",
+  "jounda",
+  "gbanda",
+  "go",
+  "kinet",
+  "kayit",
+  "tina",
+  "yiŋga",
+  "toro",
+  "bula",
+  "saresi",
+  "poki",
+  "jibitaliya",
+  "nyarju",
+  "rinö",
+  "teŋgu",
+  "madaŋ",
+  "dedena",
+  "kaŋo",
+  "tikini",
+  "yesi",
+  "ŋaraki",
+  "rereŋgu",
+  "laliyan",
+  "un",
+  "nio",
+  "yuganda",
+  "lure",
+  "lemesia",
+  "kinyö",
+  "yöŋesi",
+  "po",
+  "kelan",
+  "yeyeesi",
+  "poonda",
+  "bulo",
+  "wa",
+  "tomusala",
+  "bubulo",
+  "mukö",
+  "pape",
+  "lut",
+  "nyena",
+  "nyona",
+  "rino",
+  "lyöŋön",
+  "leleŋesi",
+  "kolera",
+  "tetema",
+  "mimindi",
+  "könin",
+  "dutet",
+  "ayi",
+  "ŋaju",
+  "lorok",
+  "denesi",
+  "ŋote",
+  "kobgon",
+  "dani",
+  "kuwen",
+  "luduk",
+  "momoresi",
+  "gbiyari",
+  "pujo",
+  "suluwa",
+  "moju",
+  "lemesi",
+  "bitamen",
+  "totokitaju",
+  "deŋe",
+  "kpake",
+  "böriköt",
+  "lopeŋ",
+  "ge",
+  "bulöne",
+  "kitaesi",
+  "kogbon",
+  "bongolan",
+  "iti",
+  "pu",
+  "lukata",
+  "rerengu",
+  "kinyötöt",
+  "loki",
+  "dötilön",
+  "ako",
+  "kuwa",
+  "koŋön",
+  "gwiliŋet",
+  "mugunya",
+  "delani",
+  "koronyo",
+  "julin",
+  "soron",
+  "wowogu",
+  "birö",
+  "moyit",
+  "taba",
+  "jojo",
+  "liserit",
+  "janjaro",
+  "kuluk",
+  "toyinga",
+  "metet",
+  "dumunda",
+  "kamuka",
+  "pupujö",
+  "kasu",
+  "puru",
+  "sisi",
+  "yeyiyesi",
+  "gbak",
+  "kukunda",
+  "gwe",
+  "sayi",
+  "mogun",
+  "ayanyan",
+  "beret",
+  "yak",
+  "mata",
+  "waya",
+  "tom",
+  "yapato",
+  "wöröji",
+  "welun",
+  "ŋona",
+  "kirut",
+  "ga",
+  "dene",
+  "winiko",
+  "gaju",
+  "tokelan",
+  "ŋara",
+  "gwon",
+  "burön",
+  "miyö",
+  "muköni",
+  "malaria",
+  "tetenda",
+  "naga",
+  "dili",
+  "kukuju",
+  "yö",
+  "met",
+  "puwet",
+  "pölyölyö",
+  "totoni",
+  "paran",
+  "bgoso",
+  "maasika",
+  "kwe",
+  "lio",
+  "puwö",
+  "sondu",
+  "likaŋ",
+  "ina",
+  "könuk",
+  "töyili",
+  "tiinda",
+  "bak",
+  "yoŋesi",
+  "baŋ",
+  "metesi",
+  "wurjö",
+  "ŋaŋarakin",
+  "togo",
+  "wöröni",
+  "durji",
+  "todinesi",
+  "kona",
+  "liyöŋön",
+  "puundö",
+  "t",
+  "sasa",
+  "midijik",
+  "mamata",
+  "titimba",
+  "lakat",
+  "dur",
+  "ŋoji",
+  "sokan",
+  "suwe",
+  "wulundö",
+  "tandaruwa",
+  "gboŋge",
+  "diloŋ",
+  "kula",
+  "durjo",
+  "gbo",
+  "denunda",
+  "kadijin",
+  "kegga",
+  "nenut",
+  "konisi",
+  "najo",
+  "jon",
+  "kindu",
+  "kpiyesi",
+  "pajo",
+  "memeta",
+  "kana",
+  "puja",
+  "aaa",
+  "sida",
+  "tutu",
+  "jujuwesi",
+  "somot",
+  "konu",
+  "konin",
+  "juwe",
+  "iya",
+  "logoŋgiti",
+  "yolo",
+  "yobu",
+  "lokore",
+  "yeyeju",
+  "yela",
+  "rereŋo",
+  "lalane",
+  "mukanat",
+  "nikaŋ",
+  "sudan",
+  "kuwö",
+  "goŋ",
+  "töggu",
+  "welan",
+  "puwo",
+  "kunyarju",
+  "boŋgolan",
+  "nagoŋgiti",
+  "pokin",
+  "nyarnyar",
+  "ŋariyesi",
+  "lakadi",
+  "golesi",
+  "komonye",
+  "dela",
+  "kisum",
+  "yöŋit",
+  "yeyesu",
+  "tindu",
+  "wökön",
+  "porogo",
+  "yee",
+  "lose",
+  "puputuru",
+  "köyimöt",
+  "lilik",
+  "bongo",
+  "tokela",
+  "jambi",
+  "pioŋ",
+  "jöre",
+  "teŋ",
+  "dende",
+  "banjajin",
+  "lalayi",
+  "uganda",
+  "koloŋ",
+  "jowunda",
+  "giti",
+  "puwök",
+  "arabia",
+  "mokani",
+  "wöwöki",
+  "böböŋöji",
+  "kulayet",
+  "kaata",
+  "togu",
+  "biyet",
+  "konuk",
+  "tomorja",
+  "daki",
+  "kitani",
+  "duret",
+  "ŋarakin",
+  "joŋa",
+  "morakinda",
+  "tolomeran",
+  "todinö",
+  "depa",
+  "boŋgo",
+  "ŋor",
+  "bgeyari",
+  "diya",
+  "woro",
+  "taji",
+  "lisa",
+  "puö",
+  "mijö",
+  "mokim",
+  "gbeti",
+  "yesiyesu",
+  "tiyuni",
+  "wöwörö",
+  "kondi",
+  "worani",
+  "tökö",
+  "bijö",
+  "yawa",
+  "möji",
+  "puet",
+  "mokosi",
+  "nyar",
+  "kogon",
+  "durundö",
+  "kala",
+  "reja",
+  "gbege",
+  "ŋariesi",
+  "kukuna",
+  "kade",
+  "bulöndi",
+  "tukökindö",
+  "lotor",
+  "sobun",
+  "koju",
+  "mogga",
+  "duka",
+  "wöriet",
+  "pikipiki",
+  "wöriyet",
+  "jakinda",
+  "katodinok",
+  "temani",
+  "sukaria",
+  "soronyon",
+  "koropo",
+  "eee",
+  "kikita",
+  "jöjön",
+  "iloŋ",
+  "balaŋ",
+  "lewuda",
+  "welet",
+  "kölöki",
+  "tuka",
+  "kulon",
+  "tomoret",
+  "sasirik",
+  "ŋaŋarakindi",
+  "kadekade",
+  "kwinyit",
+  "nasu",
+  "nakye",
+  "rogu",
+  "gbong",
+  "yoyoŋesi",
+  "guwa",
+  "köju",
+  "jone",
+  "goliyesi",
+  "tin",
+  "luwalian",
+  "miidi",
+  "tiyanan",
+  "ajo",
+  "lakini",
+  "gbiliŋet",
+  "toyiŋga",
+  "dek",
+  "putut",
+  "liwaki",
+  "kö",
+  "kuya",
+  "jujukinda",
+  "teili",
+  "jurön",
+  "aan",
+  "man",
+  "katelok",
+  "puök",
+  "tujar",
+  "liwa",
+  "boka",
+  "miri",
+  "kulök",
+  "sala",
+  "gboja",
+  "joŋga",
+  "walai",
+  "abulöndi",
+  "geleng",
+  "jojon",
+  "ŋero",
+  "woriet",
+  "arabiya",
+  "yiyiŋga",
+  "duko",
+  "loŋiyo",
+  "nanakwan",
+  "tokitayi",
+  "wogu",
+  "kitesi",
+  "biriö",
+  "wu",
+  "nagongiti",
+  "be",
+  "nyoga",
+  "reregu",
+  "yik",
+  "yuddu",
+  "arabat",
+  "naa",
+  "lisörit",
+  "janjaru",
+  "böŋö",
+  "nanyit",
+  "ropani",
+  "tika",
+  "robba",
+  "yii",
+  "pondi",
+  "takinda",
+  "logongiti",
+  "köluk",
+  "sukul",
+  "kan",
+  "todindi",
+  "roko",
+  "dumundi",
+  "s",
+  "bogolan",
+  "nnyanyar",
+  "kye",
+  "pusok",
+  "yuŋundö",
+  "kiruk",
+  "ŋarakini",
+  "diri",
+  "kiteesi",
+  "konesi",
+  "minemi",
+  "deka",
+  "lon",
+  "modoŋ",
+  "tiyu",
+  "wöwöröni",
+  "mokot",
+  "mörö",
+  "mi",
+  "bong",
+  "möka",
+  "piritö",
+  "diniki",
+  "kolo",
+  "duröni",
+  "durö",
+  "ra",
+  "nyönyöyi",
+  "gbenge",
+  "bukuluŋ",
+  "kokuwe",
+  "lalaji",
+  "tandarua",
+  "bgokiyöt",
+  "titinda",
+  "nyei",
+  "totokela",
+  "logbon",
+  "lege",
+  "tugö",
+  "nyobulo",
+  "umm",
+  "köŋön",
+  "doru",
+  "matat",
+  "bijinesi",
+  "gown",
+  "dö",
+  "doladdu",
+  "weja",
+  "detilön",
+  "yayawun",
+  "kanisa",
+  "kokonda",
+  "kayuŋök",
+  "wole",
+  "kati",
+  "kukukinda",
+  "kenisi",
+  "koyo",
+  "lumurut",
+  "nyobulö",
+  "gege",
+  "totoyiŋakin",
+  "saser",
+  "dolanit",
+  "köbuŋöt",
+  "kolak",
+  "nyöbulö",
+  "gboro",
+  "retö",
+  "joundi",
+  "leleŋet",
+  "dena",
+  "niaŋ",
+  "tutunögu",
+  "yuyurö",
+  "luparate",
+  "dodo",
+  "nyönyö",
+  "kurunda",
+  "walayi",
+  "bugu",
+  "lokpe",
+  "oo",
+  "daŋ",
+  "ɲutu",
+  "nagan",
+  "mimiinikin",
+  "luŋaser",
+  "galaman",
+  "joŋani",
+  "dura",
+  "tuggö",
+  "bin",
+  "titikinda",
+  "tokena",
+  "yiŋa",
+  "su",
+  "lupundö",
+  "budök",
+  "logboŋ",
+  "je",
+  "kaŋö",
+  "luŋgu",
+  "yeŋesi",
+  "nabot",
+  "kenet",
+  "tetemakinda",
+  "muke",
+  "muk",
+  "mugö",
+  "ŋa",
+  "gnoŋ",
+  "jonga",
+  "lonyit",
+  "ken",
+  "kunök",
+  "bibilia",
+  "lokye",
+  "kuwo",
+  "puo",
+  "lenga",
+  "daet",
+  "yeŋit",
+  "jajambu",
+  "losu",
+  "jujuja",
+  "didik",
+  "tikin",
+  "ju",
+  "tukuruki",
+  "kebbu",
+  "tutungö",
+  "todinikindö",
+  "togeleng",
+  "ŋiyun",
+  "lupundi",
+  "pedi",
+  "tinate",
+  "puun",
+  "kulyaŋan",
+  "lalai",
+  "kokona",
+  "moret",
+  "moresi",
+  "yuŋö",
+  "gboge",
+  "wot",
+  "tokelani",
+  "roroga",
+  "medijin",
+  "denede",
+  "koluk",
+  "muda",
+  "rik",
+  "boga",
+  "naŋo",
+  "durök",
+  "mörju",
+  "asandi",
+  "luku",
+  "iye",
+  "loruwö",
+  "dute",
+  "ŋiŋira",
+  "kin",
+  "kudaraki",
+  "titi",
+  "berön",
+  "nyenyei",
+  "ns",
+  "nait",
+  "ii",
+  "kuga",
+  "katodinök",
+  "silim",
+  "yiyinga",
+  "ri",
+  "gugu",
+  "bulöni",
+  "lala",
+  "dukökindö",
+  "nakwan",
+  "tiyan",
+  "ja",
+  "soronyön",
+  "yoloni",
+  "kulyet",
+  "ruruköki",
+  "bit",
+  "mömörötu",
+  "gumba",
+  "kobuŋöt",
+  "likin",
+  "poponda",
+  "kayuŋölök",
+  "moit",
+  "bur",
+  "jibitalijin",
+  "biresi",
+  "guma",
+  "soro",
+  "yoyola",
+  "suket",
+  "lilija",
+  "nn",
+  "gayeresi",
+  "sorondu",
+  "salin",
+  "yurö",
+  "miret",
+  "metani",
+  "susuluji",
+  "gurustöt",
+  "kebu",
+  "ada",
+  "buŋan",
+  "bgoro",
+  "doro",
+  "kuwesi",
+  "galakinda",
+  "yut",
+  "yudu",
+  "kukula",
+  "bganda",
+  "koyimöt",
+  "puundi",
+  "bgwe",
+  "lika",
+  "doctor",
+  "koŋ",
+  "mine",
+  "böŋ",
+  "kurju",
+  "luŋasirik",
+  "gele",
+  "laga",
+  "bgwon",
+  "yaa",
+  "kotumolu",
+  "duddö",
+  "sikili",
+  "duköni",
+};
+const uint16_t WA_FREQ_179_RANKS[] = {
+  0, 0, 0, 0, 869, 0, 0, 0, 536, 787, 0, 189, 909, 543, 0, 0,
+  0, 118, 498, 854, 355, 188, 925, 312, 927, 0, 0, 49, 307, 403, 746, 398,
+  0, 0, 0, 221, 542, 0, 497, 570, 0, 0, 0, 134, 0, 0, 0, 246,
+  251, 67, 45, 128, 322, 574, 903, 0, 0, 0, 0, 236, 616, 532, 761, 900,
+  0, 0, 197, 810, 0, 0, 0, 0, 0, 490, 588, 0, 0, 0, 0, 0,
+  544, 554, 336, 0, 0, 0, 0, 0, 0, 0, 0, 257, 0, 947, 957, 339,
+  715, 762, 353, 0, 0, 500, 0, 0, 0, 0, 461, 82, 213, 628, 114, 687,
+  522, 816, 679, 980, 0, 0, 0, 0, 0, 0, 666, 0, 0, 0, 0, 0,
+  823, 0, 491, 0, 33, 299, 0, 0, 0, 0, 243, 141, 989, 0, 0, 608,
+  0, 0, 552, 0, 0, 0, 436, 767, 0, 306, 776, 0, 916, 0, 0, 0,
+  0, 0, 443, 991, 0, 79, 0, 0, 0, 0, 0, 0, 0, 0, 99, 389,
+  523, 97, 876, 75, 59, 296, 0, 0, 0, 0, 12, 0, 0, 597, 0, 467,
+  187, 474, 546, 449, 728, 0, 428, 771, 278, 958, 0, 0, 648, 924, 450, 0,
+  0, 0, 0, 0, 920, 414, 480, 678, 742, 994, 0, 0, 601, 696, 0, 495,
+  0, 93, 287, 685, 0, 0, 0, 720, 415, 690, 898, 0, 330, 288, 0, 945,
+  581, 0, 0, 0, 0, 0, 352, 851, 0, 0, 102, 0, 0, 0, 0, 0,
+  394, 83, 36, 149, 369, 280, 0, 0, 0, 0, 681, 14, 844, 282, 0, 0,
+  0, 489, 0, 455, 0, 0, 738, 890, 0, 0, 0, 0, 0, 0, 635, 460,
+  347, 858, 585, 697, 932, 364, 845, 0, 0, 0, 0, 644, 17, 698, 0, 0,
+  0, 0, 0, 380, 841, 855, 0, 0, 52, 0, 348, 0, 371, 0, 115, 0,
+  0, 370, 0, 0, 0, 48, 870, 0, 0, 0, 0, 96, 0, 0, 0, 0,
+  0, 0, 397, 0, 0, 0, 0, 0, 0, 0, 413, 781, 62, 0, 19, 55,
+  245, 281, 368, 382, 458, 965, 0, 838, 0, 427, 451, 0, 30, 0, 912, 0,
+  23, 317, 0, 623, 0, 476, 782, 981, 0, 0, 285, 367, 723, 0, 260, 303,
+  0, 0, 0, 127, 0, 0, 0, 113, 770, 0, 0, 0, 0, 0, 0, 632,
+  0, 0, 758, 0, 304, 0, 0, 356, 818, 362, 0, 0, 0, 0, 0, 891,
+  0, 0, 283, 173, 0, 0, 0, 395, 807, 499, 902, 0, 0, 0, 0, 0,
+  184, 327, 625, 3, 837, 0, 0, 13, 0, 0, 0, 0, 193, 488, 146, 0,
+  0, 0, 0, 334, 422, 0, 25, 78, 0, 984, 0, 0, 0, 0, 0, 0,
+  0, 584, 0, 378, 931, 0, 0, 174, 194, 447, 358, 41, 551, 0, 0, 191,
+  0, 0, 515, 0, 606, 0, 0, 0, 177, 897, 0, 593, 0, 0, 598, 0,
+  0, 0, 673, 241, 0, 0, 0, 0, 589, 0, 0, 7, 420, 680, 0, 199,
+  0, 0, 457, 799, 0, 100, 248, 560, 933, 0, 131, 0, 405, 0, 0, 0,
+  0, 161, 836, 0, 0, 0, 0, 0, 0, 0, 651, 120, 942, 656, 0, 0,
+  0, 0, 0, 0, 0, 796, 940, 972, 602, 328, 724, 0, 0, 0, 516, 0,
+  230, 747, 0, 605, 429, 0, 0, 0, 609, 0, 448, 0, 0, 0, 0, 0,
+  0, 563, 481, 788, 423, 0, 929, 0, 0, 139, 453, 693, 0, 569, 0, 72,
+  314, 977, 249, 210, 0, 180, 0, 0, 311, 81, 622, 0, 0, 0, 0, 0,
+  0, 0, 790, 884, 0, 595, 0, 0, 735, 0, 0, 0, 0, 801, 329, 401,
+  533, 731, 462, 0, 0, 0, 839, 921, 0, 0, 0, 510, 0, 454, 885, 85,
+  949, 0, 0, 28, 953, 0, 0, 0, 918, 0, 0, 0, 881, 147, 734, 0,
+  0, 0, 0, 939, 0, 0, 0, 0, 232, 663, 967, 182, 289, 319, 190, 0,
+  0, 0, 136, 0, 1, 834, 215, 0, 0, 503, 812, 784, 8, 160, 475, 760,
+  0, 579, 0, 0, 0, 151, 846, 892, 888, 373, 0, 990, 0, 430, 704, 860,
+  0, 808, 772, 592, 928, 0, 0, 0, 0, 0, 0, 0, 0, 0, 519, 0,
+  226, 0, 850, 0, 0, 0, 530, 0, 821, 934, 0, 21, 572, 39, 683, 661,
+  785, 337, 0, 520, 47, 335, 650, 392, 0, 425, 0, 0, 0, 0, 301, 913,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 729, 725, 514, 926, 0, 727,
+  751, 783, 0, 0, 0, 0, 0, 667, 0, 343, 672, 0, 0, 0, 0, 711,
+  0, 0, 266, 0, 0, 0, 0, 0, 0, 171, 710, 228, 795, 976, 0, 0,
+  0, 15, 636, 0, 103, 116, 484, 155, 0, 0, 0, 94, 0, 0, 825, 130,
+  992, 4, 0, 0, 0, 142, 126, 437, 0, 938, 655, 0, 0, 0, 284, 0,
+  0, 66, 513, 748, 509, 0, 0, 594, 0, 198, 0, 0, 0, 712, 797, 0,
+  0, 0, 974, 0, 34, 968, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 809, 152, 0, 0, 385, 859, 676, 384, 0, 0, 778, 0, 361, 5, 568,
+  979, 416, 0, 917, 0, 0, 207, 153, 237, 0, 511, 158, 610, 646, 524, 365,
+  0, 0, 0, 0, 0, 61, 0, 0, 0, 501, 0, 0, 109, 0, 0, 0,
+  0, 31, 459, 0, 179, 0, 10, 988, 0, 539, 0, 0, 580, 786, 0, 60,
+  0, 391, 0, 0, 0, 0, 0, 0, 848, 0, 349, 473, 700, 752, 478, 874,
+  0, 0, 0, 0, 0, 649, 0, 0, 51, 713, 0, 0, 0, 217, 0, 0,
+  971, 0, 0, 0, 0, 0, 0, 983, 0, 0, 722, 399, 0, 527, 0, 668,
+  0, 0, 252, 308, 829, 0, 0, 402, 0, 0, 0, 0, 0, 0, 0, 35,
+  150, 617, 91, 541, 0, 0, 0, 0, 0, 961, 0, 0, 0, 43, 264, 0,
+  0, 0, 37, 0, 0, 0, 0, 0, 0, 0, 596, 0, 0, 0, 0, 832,
+  619, 0, 0, 985, 0, 922, 0, 0, 561, 545, 954, 0, 0, 439, 633, 0,
+  0, 0, 295, 472, 0, 0, 29, 345, 0, 0, 756, 0, 424, 0, 0, 0,
+  0, 0, 507, 621, 642, 578, 144, 766, 894, 960, 44, 705, 0, 935, 780, 277,
+  0, 89, 421, 209, 0, 0, 259, 375, 0, 629, 0, 880, 166, 233, 426, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 613, 68, 38, 0, 400, 0, 341, 773,
+  849, 331, 0, 0, 0, 24, 0, 0, 699, 739, 0, 0, 16, 0, 0, 359,
+  0, 0, 0, 211, 88, 470, 852, 906, 0, 50, 0, 677, 0, 263, 0, 456,
+  92, 0, 0, 321, 0, 0, 0, 577, 0, 302, 419, 482, 326, 657, 417, 170,
+  0, 671, 768, 0, 0, 71, 0, 0, 0, 255, 218, 804, 0, 0, 791, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 27, 717, 0, 0, 615,
+  0, 0, 183, 998, 169, 548, 0, 0, 0, 0, 298, 270, 0, 320, 346, 163,
+  638, 718, 540, 0, 0, 316, 0, 0, 0, 0, 0, 0, 203, 101, 0, 0,
+  70, 154, 665, 0, 0, 769, 486, 0, 0, 745, 749, 0, 0, 0, 0, 684,
+  803, 0, 0, 275, 0, 792, 895, 555, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 701, 0, 0, 0, 0, 0, 0, 0, 0, 376, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 550, 0, 0, 0, 125, 0, 65, 76, 223, 689,
+  703, 0, 0, 0, 0, 0, 0, 496, 0, 0, 0, 0, 0, 0, 0, 0,
+  77, 432, 469, 0, 0, 0, 0, 730, 235, 390, 0, 256, 261, 0, 591, 408,
+  90, 172, 793, 0, 167, 204, 279, 381, 0, 0, 978, 181, 273, 406, 0, 0,
+  0, 494, 0, 176, 0, 0, 0, 0, 0, 0, 22, 695, 0, 706, 0, 0,
+  196, 0, 0, 0, 0, 0, 0, 64, 216, 0, 119, 379, 843, 875, 159, 0,
+  206, 344, 0, 944, 639, 276, 0, 222, 856, 0, 886, 240, 951, 388, 0, 0,
+  6, 0, 357, 0, 0, 0, 872, 0, 0, 647, 714, 0, 948, 468, 138, 682,
+  0, 905, 185, 73, 0, 445, 446, 0, 0, 0, 882, 0, 0, 899, 0, 754,
+  586, 212, 411, 0, 393, 664, 350, 192, 0, 871, 0, 0, 0, 534, 162, 763,
+  0, 0, 0, 0, 0, 56, 936, 0, 145, 0, 0, 0, 800, 662, 0, 0,
+  862, 0, 755, 444, 0, 732, 599, 653, 300, 826, 643, 750, 557, 806, 966, 195,
+  0, 0, 435, 0, 466, 315, 815, 775, 0, 0, 708, 604, 465, 861, 590, 910,
+  377, 502, 323, 941, 986, 0, 0, 0, 822, 366, 0, 407, 418, 0, 0, 0,
+  262, 0, 0, 919, 963, 0, 157, 733, 805, 0, 0, 0, 121, 0, 0, 404,
+  463, 779, 324, 943, 0, 86, 0, 0, 0, 0, 112, 0, 0, 268, 80, 716,
+  0, 0, 132, 117, 0, 0, 0, 0, 0, 573, 0, 641, 0, 744, 0, 0,
+  332, 383, 0, 0, 0, 2, 537, 694, 0, 325, 0, 637, 0, 820, 833, 973,
+  224, 205, 901, 995, 964, 0, 0, 0, 0, 0, 0, 789, 518, 0, 0, 108,
+  0, 0, 363, 0, 433, 0, 485, 0, 521, 0, 0, 0, 0, 0, 0, 794,
+  409, 0, 0, 0, 412, 0, 0, 0, 631, 26, 286, 452, 0, 0, 0, 802,
+  0, 0, 883, 0, 830, 0, 0, 618, 0, 0, 0, 164, 294, 819, 777, 565,
+  828, 0, 87, 372, 692, 156, 0, 0, 0, 674, 0, 0, 242, 40, 69, 220,
+  129, 148, 865, 492, 878, 0, 955, 53, 726, 512, 0, 0, 0, 0, 0, 0,
+  0, 293, 857, 165, 817, 354, 386, 0, 0, 0, 0, 58, 893, 186, 0, 0,
+  0, 0, 996, 0, 0, 640, 0, 962, 525, 0, 0, 0, 133, 0, 310, 743,
+  814, 265, 0, 269, 658, 227, 0, 0, 0, 0, 0, 442, 143, 558, 587, 0,
+  0, 0, 178, 0, 877, 124, 0, 291, 483, 831, 993, 0, 292, 0, 571, 0,
+  0, 0, 0, 0, 0, 313, 675, 911, 946, 0, 0, 0, 105, 583, 0, 721,
+  0, 669, 318, 271, 707, 873, 0, 0, 340, 267, 201, 54, 553, 612, 0, 0,
+  0, 567, 0, 0, 0, 229, 0, 0, 0, 879, 0, 0, 0, 904, 813, 137,
+  20, 219, 997, 0, 627, 106, 0, 234, 889, 0, 0, 0, 333, 864, 914, 140,
+  338, 626, 0, 0, 686, 0, 0, 670, 0, 0, 975, 659, 702, 0, 175, 970,
+  0, 847, 0, 0, 0, 0, 0, 547, 0, 0, 0, 0, 0, 0, 842, 737,
+  531, 493, 835, 908, 254, 258, 0, 0, 603, 18, 774, 0, 42, 0, 0, 0,
+  297, 0, 0, 440, 824, 867, 645, 999, 247, 98, 736, 360, 410, 508, 342, 896,
+  959, 305, 57, 244, 11, 274, 387, 969, 952, 582, 614, 868, 0, 135, 438, 0,
+  0, 0, 0, 309, 611, 982, 0, 110, 0, 0, 0, 0, 0, 0, 0, 866,
+  529, 600, 0, 0, 654, 104, 0, 0, 526, 709, 741, 688, 464, 107, 0, 0,
+  0, 396, 0, 225, 538, 549, 652, 0, 487, 0, 517, 0, 0, 0, 634, 0,
+  0, 0, 0, 0, 0, 0, 0, 477, 0, 556, 0, 0, 95, 620, 827, 937,
+  0, 0, 168, 719, 0, 0, 0, 239, 765, 471, 740, 887, 0, 0, 811, 0,
+  559, 0, 907, 753, 214, 0, 0, 0, 250, 253, 566, 0, 0, 32, 0, 505,
+  0, 0, 0, 431, 528, 506, 853, 0, 238, 0, 0, 0, 0, 374, 0, 0,
+  111, 290, 564, 123, 504, 575, 434, 0, 0, 0, 0, 0, 0, 0, 0, 630,
+  863, 0, 0, 0, 660, 757, 576, 764, 915, 0, 930, 0, 0, 0, 956, 84,
+  691, 9, 231, 840, 950, 0, 562, 0, 63, 0, 0, 0, 0, 0, 624, 535,
+  923, 0, 0, 122, 0, 0, 74, 0, 202, 0, 0, 759, 798, 200, 0, 351,
+  987, 0, 0, 0, 479, 272, 0, 1000, 0, 0, 0, 441, 607, 208, 0, 0,
+};
+
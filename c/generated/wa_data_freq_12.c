@@ -0,0 +1,10454 @@
+#include "worldalphabets_data.h"
+
+const char *WA_FREQ_180_TOKENS[] = {
+  "ہے",
+  "میں",
+  "،",
+  "کے",
+  "۔",
+  "نہیں",
+  "آپ",
+  "کی",
+  "ایک",
+  "سے",
+  "ہیں",
+  "کو",
+  "اس",
+  "نے",
+  "یہ",
+  "کیا",
+  "تم",
+  "اور",
+  "وہ",
+  "ہو",
+  "کر",
+  "ہم",
+  "کہ",
+  "لئے",
+  "پر",
+  "تھا",
+  "ہوں",
+  "کا",
+  "مجھے",
+  "بھی",
+  "تو",
+  "کرنے",
+  "رہے",
+  "ٹھیک",
+  "گا",
+  "کچھ",
+  "کوئی",
+  "رہا",
+  "سب",
+  "یہاں",
+  "ساتھ",
+  "ہاں",
+  "ان",
+  "گیا",
+  "اسے",
+  "اب",
+  "طرح",
+  "لیکن",
+  "سکتے",
+  "صرف",
+  "میرے",
+  "بہت",
+  "گے",
+  "؛",
+  "بات",
+  "سکتا",
+  "اپنے",
+  "زیادہ",
+  "جی",
+  "کسی",
+  "دیا",
+  "جاؤ",
+  "بارے",
+  "دو",
+  "کرنا",
+  "چلو",
+  "تھے",
+  "جا",
+  "میری",
+  "باہر",
+  "تمہیں",
+  "ضرورت",
+  "کہا",
+  "ہی",
+  "حاصل",
+  "کریں",
+  "جو",
+  "طور",
+  "جانتے",
+  "وہاں",
+  "چاہتے",
+  "وقت",
+  "جائے",
+  "پھر",
+  "اچھا",
+  "کام",
+  "کرتے",
+  "اگر",
+  "کیوں",
+  "یا",
+  "کرو",
+  "آ",
+  "تک",
+  "کس",
+  "چاہتا",
+  "کبھی",
+  "لے",
+  "انہوں",
+  "پہلے",
+  "جب",
+  "ہمارے",
+  "کہاں",
+  "واپس",
+  "لگتا",
+  "کرتا",
+  "ء",
+  "مل",
+  "ہمیں",
+  "ن",
+  "نہ",
+  "ہر",
+  "مجھ",
+  "پاس",
+  "طرف",
+  "لوگوں",
+  "تمام",
+  "ئ",
+  "اپنی",
+  "آدمی",
+  "تھی",
+  "کون",
+  "میرا",
+  "ایسا",
+  "پتہ",
+  "بعد",
+  "ہ",
+  "لوگ",
+  "دیکھ",
+  "مدد",
+  "شکریہ",
+  "گھر",
+  "بند",
+  "ارے",
+  "یقین",
+  "نام",
+  "دے",
+  "لیے",
+  "لیا",
+  "ظ",
+  "خ",
+  "گی",
+  "اوہ",
+  "جانا",
+  "والا",
+  "کوشش",
+  "ہوگا",
+  "ماں",
+  "ہوا",
+  "تلاش",
+  "خیال",
+  "جاتا",
+  "چھوڑ",
+  "ہج",
+  "رات",
+  "ش",
+  "وجہ",
+  "دن",
+  "بار",
+  "بس",
+  "دیکھو",
+  "ي",
+  "نیچے",
+  "خدا",
+  "چاہئے",
+  "کیلئے",
+  "جانے",
+  "تمہارے",
+  "دور",
+  "جگہ",
+  "دیکھا",
+  "رہی",
+  "انتظار",
+  "مطلب",
+  "دنیا",
+  "تیار",
+  "صاحب",
+  "جانتا",
+  "کرے",
+  "ابھی",
+  "استعمال",
+  "ہمیشہ",
+  "بالکل",
+  "ہونا",
+  "پاگل",
+  "ك",
+  "جنگ",
+  "والد",
+  "معلوم",
+  "گئے",
+  "سال",
+  "واقعی",
+  "ّ",
+  "آج",
+  "بغیر",
+  "شاید",
+  "زندگی",
+  "رکو",
+  "یاد",
+  "دیں",
+  "کیونکہ",
+  "ہماری",
+  "کم",
+  "سر",
+  "ضروری",
+  "نہيں",
+  "پیچھے",
+  "ہونے",
+  "پسند",
+  "کیسے",
+  "کہہ",
+  "سمجھ",
+  "فون",
+  "ختم",
+  "خود",
+  "رہو",
+  "چیز",
+  "سی",
+  "شروع",
+  "منٹ",
+  "ب",
+  "آئے",
+  "والے",
+  "اندر",
+  "نمبر",
+  "مر",
+  "قسم",
+  "مت",
+  "معاف",
+  "یہی",
+  "اچھی",
+  "َ",
+  "خوش",
+  "کروں",
+  "تمہاری",
+  "جس",
+  "د",
+  "بہتر",
+  "نظر",
+  "ہوئے",
+  "اہ",
+  "و",
+  "بن",
+  "انہیں",
+  "گئی",
+  "تین",
+  "دوست",
+  "ھ",
+  "صحیح",
+  "شہر",
+  "جیسے",
+  "پوشیدہ",
+  "مسئلہ",
+  "کہیں",
+  "دوسرے",
+  "آخر",
+  "مہربانی",
+  "وکٹر",
+  "موجود",
+  "بڑا",
+  "ویسے",
+  "منتقل",
+  "آیا",
+  "ہوتا",
+  "مار",
+  "ملا",
+  "محبت",
+  "سوچا",
+  "کافی",
+  "محفوظ",
+  "جہاں",
+  "آئی",
+  "بچے",
+  "براہ",
+  "چلا",
+  "سچ",
+  "لو",
+  "بھائی",
+  "ؤ",
+  "وعدہ",
+  "چاہیے",
+  "قتل",
+  "کہنا",
+  "ہيں",
+  "تمہارا",
+  "ڈاکٹر",
+  "چلے",
+  "امریکہ",
+  "دی",
+  "نظام",
+  "جان",
+  "شخص",
+  "ہاتھ",
+  "چلتے",
+  "ز",
+  "پروگرام",
+  "رہنے",
+  "جائیں",
+  "نا",
+  "اہم",
+  "اپنا",
+  "سا",
+  "تبدیل",
+  "تھوڑا",
+  "حملہ",
+  "بتا",
+  "ذریعے",
+  "رسائی",
+  "زمین",
+  "ملک",
+  "قابل",
+  "ہض",
+  "کہانی",
+  "دوبارہ",
+  "کل",
+  "ڈال",
+  "بتایا",
+  "ا",
+  "جلدی",
+  "پانچ",
+  "انسان",
+  "محسوس",
+  "ہیرو",
+  "بنجمن",
+  "پال",
+  "گولی",
+  "ہیک",
+  "برینڈن",
+  "درمیان",
+  "جنگل",
+  "کھانا",
+  "جناب",
+  "دروازے",
+  "ہیلو",
+  "لڑکی",
+  "اعتماد",
+  "ٹومی",
+  "ملے",
+  "خوبصورت",
+  "راستہ",
+  "پہ",
+  "ہا",
+  "آنے",
+  "گرد",
+  "مختلف",
+  "اے",
+  "بنا",
+  "ہوئی",
+  "زندہ",
+  "آخری",
+  "اتنا",
+  "گاڑی",
+  "آگے",
+  "اد",
+  "پولیس",
+  "غیر",
+  "پتا",
+  "ناورسکی",
+  "غلطی",
+  "غلط",
+  "بڑے",
+  "مکمل",
+  "ِ",
+  "خاندان",
+  "واضح",
+  "بے",
+  "پکڑ",
+  "لڑکے",
+  "سرور",
+  "بلیک",
+  "مسٹر",
+  "لینے",
+  "مقصد",
+  "لیں",
+  "مزید",
+  "آسان",
+  "امید",
+  "راستے",
+  "آتا",
+  "جواب",
+  "سپر",
+  "حقیقی",
+  "بڑی",
+  "پڑے",
+  "رکھنے",
+  "اط",
+  "دیکھنے",
+  "اوپر",
+  "عورت",
+  "خفیہ",
+  "پیدا",
+  "چیزیں",
+  "حق",
+  "اپ",
+  "معلومات",
+  "آرام",
+  "دونوں",
+  "دیر",
+  "افسوس",
+  "چل",
+  "قریب",
+  "جھوٹ",
+  "اتارنا",
+  "پیسے",
+  "خلاف",
+  "سکتی",
+  "آو",
+  "لگا",
+  "چار",
+  "حفاظت",
+  "رکھا",
+  "سانس",
+  "ہیکنگ",
+  "دادی",
+  "ہع",
+  "معذرت",
+  "داستان",
+  "جادو",
+  "چاہتی",
+  "پڑا",
+  "سپرمین",
+  "دوسری",
+  "ءِ",
+  "بیٹھ",
+  "رہنا",
+  "یار",
+  "ابو",
+  "کھو",
+  "دینے",
+  "سامنے",
+  "کار",
+  "لگ",
+  "اصل",
+  "ثابت",
+  "گندگی",
+  "خون",
+  "امتحان",
+  "پرواہ",
+  "امریکی",
+  "طریقہ",
+  "اجازت",
+  "فکر",
+  "ارد",
+  "چیزوں",
+  "ح",
+  "گر",
+  "کال",
+  "سن",
+  "مگر",
+  "تباہ",
+  "توڑ",
+  "سوال",
+  "بیٹا",
+  "اسی",
+  "عظیم",
+  "رہ",
+  "تحفظ",
+  "خاص",
+  "سوچ",
+  "گزشتہ",
+  "موت",
+  "رہتے",
+  "منصوبہ",
+  "کہتے",
+  "معافی",
+  "اچھے",
+  "چاہیئے",
+  "سیکورٹی",
+  "چھوٹے",
+  "ادا",
+  "صاف",
+  "لائن",
+  "برا",
+  "از",
+  "ہوائی",
+  "سنا",
+  "درست",
+  "توجہ",
+  "ہہ",
+  "دیتا",
+  "دوسروں",
+  "گائے",
+  "حکومت",
+  "سٹیفین",
+  "پوری",
+  "دل",
+  "کھانے",
+  "باقی",
+  "لہذا",
+  "جیک",
+  "گھنٹے",
+  "بادشاہ",
+  "لمحے",
+  "لادن",
+  "بھیجا",
+  "ُ",
+  "نکل",
+  "کمپیوٹر",
+  "تعلق",
+  "بننا",
+  "بچوں",
+  "ہمارا",
+  "زبان",
+  "فوری",
+  "سوالات",
+  "ورک",
+  "نیٹ",
+  "چوری",
+  "سائبر",
+  "مذاق",
+  "شادی",
+  "ہوشیار",
+  "جلد",
+  "حل",
+  "ناممکن",
+  "ہیکروں",
+  "بینک",
+  "آتے",
+  "چکا",
+  "سو",
+  "کمرے",
+  "خوشی",
+  "پہلی",
+  "تاکہ",
+  "دھوکہ",
+  "چال",
+  "فوج",
+  "بہترین",
+  "دیکھیں",
+  "ہلاک",
+  "والدین",
+  "حملے",
+  "ت",
+  "معمولی",
+  "چکے",
+  "روسی",
+  "دینا",
+  "تاریخ",
+  "سمجھتے",
+  "کھیل",
+  "بنایا",
+  "آمدید",
+  "چھوٹی",
+  "بنانے",
+  "ریکارڈ",
+  "یہیں",
+  "جہاز",
+  "پیغام",
+  "لانے",
+  "مشکل",
+  "بندی",
+  "لات",
+  "احمد",
+  "گروپ",
+  "بھول",
+  "ماہ",
+  "رکھیں",
+  "رکھتا",
+  "وہی",
+  "صبح",
+  "سیکنڈ",
+  "دوران",
+  "عجیب",
+  "حصہ",
+  "ظاہر",
+  "بیوی",
+  "پرواز",
+  "الوداع",
+  "داخل",
+  "عام",
+  "فیصلہ",
+  "پیش",
+  "ذرا",
+  "ہفتے",
+  "عمل",
+  "مٹی",
+  "جاؤں",
+  "چند",
+  "روکنے",
+  "دیکھنا",
+  "اکیلے",
+  "رکھو",
+  "رکھ",
+  "ٹیم",
+  "کمپنی",
+  "کراکوژیہ",
+  "مین",
+  "نئے",
+  "چھوٹا",
+  "ڈنگ",
+  "لی",
+  "ج",
+  "پی",
+  "جاو",
+  "باپ",
+  "طاقت",
+  "آہ",
+  "خنجر",
+  "بچہ",
+  "دیکھتے",
+  "ڈیٹا",
+  "ملین",
+  "کھڑے",
+  "تعمیر",
+  "گواہ",
+  "کیجئے",
+  "خبر",
+  "روک",
+  "ویڈیو",
+  "سودا",
+  "اگلے",
+  "بھیج",
+  "اتنی",
+  "حکم",
+  "سفر",
+  "رابطہ",
+  "مردہ",
+  "ذمہ",
+  "رکھتے",
+  "شامل",
+  "قبول",
+  "بنیامین",
+  "دیوار",
+  "فوجی",
+  "مرکزی",
+  "موقع",
+  "نکال",
+  "جاننا",
+  "پلیز",
+  "مقابلے",
+  "بیٹے",
+  "ث",
+  "جہنم",
+  "نیویارک",
+  "شمار",
+  "احساس",
+  "مردوں",
+  "ہتھیار",
+  "ار",
+  "ایسی",
+  "جاری",
+  "ڈر",
+  "ایسے",
+  "پوچھا",
+  "کب",
+  "اٹھو",
+  "دار",
+  "ہد",
+  "انٹرنیٹ",
+  "اگرچہ",
+  "کارڈ",
+  "سروس",
+  "پرسکون",
+  "ایڈ",
+  "حقیقت",
+  "کرنی",
+  "چکی",
+  "بتاو",
+  "سیم",
+  "ع",
+  "ہدایات",
+  "قیادت",
+  "پکڑو",
+  "کرتی",
+  "نوجوان",
+  "جاتے",
+  "تقریبا",
+  "سنو",
+  "فروخت",
+  "حال",
+  "مارا",
+  "وین",
+  "ملاقات",
+  "امیلیہ",
+  "دستخط",
+  "مافیا",
+  "مضبوط",
+  "نقصان",
+  "تصویر",
+  "ہْ",
+  "بیگ",
+  "سامنا",
+  "میل",
+  "اتنے",
+  "ض",
+  "لعنت",
+  "ہوتے",
+  "کوبا",
+  "دس",
+  "بھر",
+  "ممکن",
+  "طریقے",
+  "آگ",
+  "پانی",
+  "سفید",
+  "محترم",
+  "قسمت",
+  "مشین",
+  "بکری",
+  "لن",
+  "رہتا",
+  "جمع",
+  "چیک",
+  "نیا",
+  "خواہ",
+  "بلغارین",
+  "امن",
+  "ایس",
+  "ضرور",
+  "چھ",
+  "مطابق",
+  "دہشت",
+  "سماجی",
+  "پیار",
+  "جنس",
+  "رہیں",
+  "انٹیلی",
+  "والی",
+  "ریٹا",
+  "طویل",
+  "دفعہ",
+  "کتنے",
+  "پوچھ",
+  "ریت",
+  "این",
+  "ً",
+  "دوں",
+  "سییلی",
+  "پناہ",
+  "لڑکیوں",
+  "پکڑنے",
+  "بی",
+  "بتاؤ",
+  "ہیگ",
+  "ٹی",
+  "جیت",
+  "شکار",
+  "بلایا",
+  "رنگ",
+  "برائن",
+  "لطف",
+  "گڈ",
+  "خدمت",
+  "مشہور",
+  "صورت",
+  "قدم",
+  "میکس",
+  "فٹ",
+  "چلانے",
+  "ذاتی",
+  "ای",
+  "ثبوت",
+  "ق",
+  "ریاست",
+  "چھو",
+  "ناکام",
+  "رے",
+  "ڈالر",
+  "ہوگی",
+  "فراہم",
+  "فرق",
+  "نصف",
+  "پورے",
+  "فرینک",
+  "آزاد",
+  "اعداد",
+  "رقم",
+  "شناخت",
+  "بچانے",
+  "تحقیقات",
+  "پایا",
+  "بم",
+  "شام",
+  "اقدام",
+  "سارجنٹ",
+  "تیزی",
+  "بائیں",
+  "جسم",
+  "ہü",
+  "قائم",
+  "آنا",
+  "ہمت",
+  "قوانین",
+  "بدل",
+  "برانڈ",
+  "کئی",
+  "ایم",
+  "لفظ",
+  "پہلا",
+  "چوٹ",
+  "پوچھنا",
+  "درخواست",
+  "فہرست",
+  "لڑکوں",
+  "راست",
+  "جیسا",
+  "دروازہ",
+  "نجی",
+  "تاکنا",
+  "مستقبل",
+  "کتنا",
+  "مزہ",
+  "رکھنا",
+  "رب",
+  "چرایا",
+  "سڑک",
+  "ادویات",
+  "سونے",
+  "دھکا",
+  "پرانے",
+  "ڈوم",
+  "الموت",
+  "آدھی",
+  "بتانا",
+  "کاروبار",
+  "ذ",
+  "یقینی",
+  "پاکستان",
+  "خطرہ",
+  "تحت",
+  "چاہوں",
+  "لڑائی",
+  "ہاتھوں",
+  "نیو",
+  "موسیقی",
+  "جرمن",
+  "دیتے",
+  "آµ",
+  "بلکہ",
+  "ریڈار",
+  "غور",
+  "انجینئرنگ",
+  "آؤ",
+  "حیرت",
+  "عیسائی",
+  "ڈیسمنڈ",
+  "آپ",
+  "نو",
+  "اڈے",
+  "حضرات",
+  "مرنے",
+  "آتی",
+  "ہوتی",
+  "علاقے",
+  "اندازہ",
+  "چھپا",
+  "کارروائی",
+  "جیل",
+  "نفرت",
+  "پریشان",
+  "سات",
+  "اوکے",
+  "کہو",
+  "پہنچ",
+  "تر",
+  "چپ",
+  "جبکہ",
+  "لیتا",
+  "فی",
+  "بین",
+  "جانچ",
+  "ماسک",
+  "فیڈرل",
+  "آسمان",
+  "توقع",
+  "پورا",
+  "لگی",
+  "اینجل",
+  "عدالت",
+  "کیپٹن",
+  "ف",
+  "ھینی",
+  "بتائیں",
+  "خوف",
+  "مرد",
+  "اسکول",
+  "بیٹ",
+  "ٹروجن",
+  "سوچتا",
+  "مبارک",
+  "نئی",
+  "ساتھی",
+  "انکار",
+  "ملنے",
+  "کمزور",
+  "ہٹو",
+  "افراد",
+  "ہدف",
+  "سیاسی",
+  "کنٹرول",
+  "روز",
+  "آنکھیں",
+  "پھینک",
+  "لینا",
+  "اٹھا",
+  "اصلی",
+  "غائب",
+  "منگل",
+  "خارج",
+  "شہزادہ",
+  "آنکھوں",
+  "گھوڑے",
+  "ملازمین",
+  "انداز",
+  "آواز",
+  "پینا",
+  "کاٹ",
+  "سنوڈن",
+  "یارک",
+  "کتنی",
+  "بول",
+  "عالمی",
+  "چچا",
+  "جوتا",
+  "ـ",
+  "شدہ",
+  "پھاٹک",
+  "سیل",
+  "تجھے",
+  "معطل",
+  "واحد",
+  "بنائیں",
+  "سکیں",
+  "شہزادی",
+  "ماضی",
+  "خانے",
+  "عراق",
+  "مقدس",
+  "ٹھہرو",
+  "بیس",
+  "کیٹ",
+  "کانرائے",
+  "قانونی",
+  "پڑتا",
+  "ملنا",
+  "نپولین",
+  "ہیکر",
+  "ادءِ",
+  "بچا",
+  "معاملہ",
+  "اچانک",
+  "دھماکہ",
+  "علاوہ",
+  "چالوں",
+  "صدر",
+  "نکلنے",
+  "یو",
+  "اْس",
+  "واہ",
+  "دائیں",
+  "عمارت",
+  "ملتا",
+  "سنجیدگی",
+  "سیاہ",
+  "لگے",
+  "سخت",
+  "سرخ",
+  "سان",
+  "تیز",
+  "مقام",
+  "ایجنٹ",
+  "کتیا",
+  "تعریف",
+  "باکس",
+  "لڑکا",
+  "جوتے",
+  "پھنس",
+  "تجویز",
+  "ریمسی",
+  "سارہ",
+  "پوزیشن",
+  "سکے",
+  "جانتی",
+  "پتھر",
+  "دفن",
+  "ملیں",
+  "جنت",
+  "ادھر",
+  "موسم",
+  "اختیار",
+  "بھاڑ",
+  "انگریزی",
+  "چللا",
+  "اندوز",
+  "اترو",
+  "چلنا",
+  "برداشت",
+  "لڑنے",
+  "گپتا",
+  "سوچنے",
+  "زائد",
+  "چیخ",
+  "قانون",
+  "پڑتال",
+  "بتانے",
+  "کلاس",
+  "مواد",
+  "طاس",
+  "سرورز",
+  "اگلی",
+  "برائے",
+};
+const uint16_t WA_FREQ_180_RANKS[] = {
+  0, 0, 426, 677, 0, 0, 0, 0, 0, 0, 508, 450, 1, 236, 0, 354,
+  35, 752, 951, 0, 0, 864, 602, 807, 908, 0, 0, 0, 881, 0, 0, 294,
+  774, 0, 0, 0, 0, 0, 0, 0, 0, 0, 146, 892, 412, 0, 0, 411,
+  0, 0, 210, 0, 0, 77, 728, 0, 0, 0, 783, 28, 0, 0, 0, 279,
+  906, 0, 966, 0, 0, 989, 940, 9, 0, 314, 428, 484, 0, 266, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 418, 0, 0, 0, 680, 158, 174,
+  986, 509, 0, 0, 0, 0, 410, 0, 423, 0, 631, 503, 0, 0, 0, 0,
+  0, 0, 0, 625, 0, 141, 620, 0, 0, 0, 710, 0, 0, 16, 447, 0,
+  0, 0, 849, 0, 0, 0, 145, 532, 0, 0, 0, 647, 0, 0, 0, 0,
+  0, 0, 554, 80, 0, 0, 295, 370, 0, 324, 0, 214, 544, 590, 553, 0,
+  0, 0, 0, 963, 0, 0, 0, 0, 0, 0, 0, 496, 0, 789, 525, 0,
+  0, 0, 0, 0, 491, 943, 0, 0, 256, 572, 0, 265, 444, 0, 0, 0,
+  0, 0, 0, 0, 255, 0, 556, 128, 885, 847, 901, 97, 0, 0, 258, 0,
+  0, 0, 0, 0, 402, 0, 0, 0, 0, 0, 268, 0, 0, 0, 571, 0,
+  8, 170, 194, 0, 322, 604, 662, 0, 0, 740, 917, 0, 0, 0, 0, 0,
+  0, 73, 956, 186, 273, 246, 263, 0, 0, 0, 0, 0, 900, 11, 727, 561,
+  0, 499, 82, 0, 0, 222, 0, 0, 0, 0, 0, 0, 0, 355, 156, 88,
+  0, 0, 0, 0, 769, 100, 70, 180, 197, 975, 0, 337, 244, 400, 533, 137,
+  0, 0, 0, 0, 931, 961, 0, 598, 0, 0, 0, 795, 0, 64, 596, 369,
+  0, 0, 288, 0, 350, 0, 0, 0, 0, 0, 960, 0, 827, 0, 0, 0,
+  0, 399, 0, 0, 140, 0, 99, 538, 318, 0, 0, 0, 0, 0, 739, 0,
+  0, 575, 546, 470, 784, 813, 929, 999, 702, 0, 785, 453, 0, 0, 66, 905,
+  0, 130, 794, 0, 326, 0, 457, 375, 543, 605, 615, 909, 0, 0, 0, 0,
+  578, 0, 0, 0, 0, 0, 498, 56, 0, 0, 310, 0, 541, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 94, 629, 691, 868, 0,
+  0, 0, 821, 0, 0, 0, 0, 103, 0, 0, 586, 0, 0, 950, 970, 877,
+  0, 21, 0, 0, 915, 0, 858, 0, 0, 684, 0, 0, 368, 565, 419, 857,
+  0, 0, 867, 0, 0, 89, 726, 822, 0, 303, 0, 597, 0, 0, 599, 0,
+  0, 526, 0, 407, 0, 490, 203, 307, 536, 0, 559, 887, 339, 903, 0, 486,
+  42, 61, 592, 333, 879, 0, 0, 0, 0, 842, 0, 176, 871, 632, 0, 0,
+  0, 0, 139, 328, 0, 0, 4, 0, 522, 0, 946, 0, 0, 0, 0, 249,
+  26, 0, 277, 0, 0, 0, 0, 90, 245, 0, 0, 714, 0, 805, 0, 0,
+  0, 424, 501, 0, 422, 0, 0, 0, 0, 0, 656, 0, 594, 0, 624, 195,
+  800, 0, 0, 0, 0, 0, 0, 527, 143, 240, 362, 380, 296, 225, 359, 0,
+  421, 725, 0, 771, 0, 0, 530, 0, 191, 0, 17, 732, 991, 568, 0, 237,
+  0, 0, 427, 574, 756, 0, 0, 0, 91, 364, 0, 0, 535, 0, 19, 489,
+  0, 0, 0, 523, 558, 0, 733, 29, 0, 0, 0, 0, 0, 0, 0, 0,
+  734, 0, 478, 0, 31, 840, 718, 0, 0, 231, 0, 0, 0, 0, 0, 980,
+  755, 387, 891, 0, 0, 0, 0, 0, 0, 0, 0, 386, 463, 996, 441, 0,
+  189, 47, 157, 0, 0, 0, 403, 0, 0, 0, 190, 315, 264, 0, 557, 0,
+  0, 0, 0, 27, 452, 0, 132, 239, 788, 0, 25, 0, 286, 0, 0, 120,
+  716, 720, 458, 869, 777, 882, 0, 0, 570, 0, 0, 0, 0, 0, 0, 866,
+  0, 311, 0, 706, 0, 0, 0, 0, 0, 0, 0, 0, 297, 0, 0, 57,
+  181, 513, 0, 0, 623, 0, 780, 930, 0, 502, 779, 0, 0, 665, 953, 0,
+  0, 358, 880, 507, 0, 0, 0, 837, 0, 78, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 302, 0, 60, 63, 0, 342, 0, 0, 962, 472, 0, 0, 655,
+  798, 0, 274, 660, 171, 207, 0, 0, 0, 112, 212, 390, 404, 115, 977, 964,
+  0, 483, 118, 910, 0, 0, 482, 0, 0, 275, 694, 462, 567, 113, 257, 308,
+  0, 172, 0, 520, 581, 0, 0, 0, 0, 886, 0, 0, 671, 689, 724, 982,
+  654, 0, 0, 744, 775, 0, 169, 206, 637, 884, 918, 987, 652, 0, 0, 890,
+  0, 0, 0, 0, 0, 0, 0, 1000, 627, 0, 0, 0, 6, 0, 0, 0,
+  0, 0, 0, 133, 0, 0, 945, 0, 0, 348, 209, 415, 753, 0, 0, 587,
+  0, 542, 0, 208, 0, 0, 0, 0, 0, 455, 899, 0, 18, 698, 0, 0,
+  0, 723, 0, 196, 0, 776, 37, 0, 0, 0, 0, 217, 797, 0, 663, 135,
+  459, 582, 622, 588, 0, 0, 0, 0, 818, 0, 0, 0, 640, 396, 0, 487,
+  0, 0, 0, 679, 969, 0, 33, 773, 529, 782, 936, 984, 834, 924, 0, 0,
+  93, 361, 528, 356, 612, 754, 804, 829, 0, 22, 0, 213, 0, 0, 305, 0,
+  0, 0, 0, 0, 480, 0, 0, 397, 770, 616, 323, 686, 760, 45, 48, 0,
+  0, 287, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 835, 0, 0, 0, 0, 0, 260, 0, 148, 360, 0, 709, 0, 0, 0,
+  0, 50, 674, 0, 0, 0, 0, 863, 938, 828, 293, 500, 584, 668, 439, 792,
+  551, 0, 388, 0, 0, 968, 0, 116, 751, 0, 897, 0, 241, 46, 0, 0,
+  0, 0, 316, 317, 0, 0, 0, 220, 0, 859, 0, 0, 0, 87, 110, 0,
+  0, 0, 0, 7, 757, 102, 0, 0, 0, 0, 577, 766, 0, 365, 129, 124,
+  187, 0, 560, 52, 0, 0, 383, 0, 357, 705, 0, 0, 0, 474, 0, 0,
+  0, 431, 0, 0, 832, 292, 309, 0, 0, 979, 460, 376, 0, 0, 0, 494,
+  730, 409, 0, 366, 39, 0, 0, 0, 0, 0, 0, 0, 990, 242, 0, 0,
+  179, 0, 0, 933, 722, 874, 117, 119, 0, 993, 0, 0, 0, 0, 0, 184,
+  848, 875, 878, 51, 377, 0, 648, 0, 367, 731, 992, 0, 0, 0, 860, 0,
+  59, 335, 636, 672, 741, 0, 0, 269, 111, 0, 683, 0, 830, 935, 872, 0,
+  175, 41, 155, 391, 983, 0, 0, 0, 101, 327, 200, 814, 0, 0, 24, 927,
+  0, 889, 0, 201, 161, 0, 75, 645, 750, 550, 493, 259, 564, 131, 219, 248,
+  641, 347, 862, 0, 107, 0, 229, 0, 0, 353, 870, 0, 0, 0, 0, 0,
+  284, 0, 0, 0, 216, 13, 276, 0, 0, 0, 972, 0, 0, 0, 0, 0,
+  0, 223, 0, 0, 165, 0, 0, 0, 0, 0, 0, 0, 0, 0, 591, 58,
+  456, 566, 721, 211, 883, 0, 0, 682, 301, 432, 469, 62, 371, 768, 923, 978,
+  0, 0, 669, 0, 764, 0, 0, 0, 955, 895, 0, 0, 0, 911, 852, 0,
+  0, 0, 0, 0, 0, 831, 0, 687, 0, 0, 836, 0, 713, 0, 0, 0,
+  0, 0, 0, 0, 519, 372, 630, 0, 0, 0, 0, 0, 0, 65, 0, 374,
+  351, 628, 0, 0, 0, 820, 0, 205, 688, 861, 873, 341, 233, 799, 0, 0,
+  0, 30, 0, 0, 0, 0, 416, 0, 934, 958, 44, 0, 0, 0, 0, 345,
+  793, 0, 941, 0, 121, 0, 0, 192, 0, 585, 0, 0, 0, 434, 0, 0,
+  0, 0, 0, 461, 621, 0, 0, 0, 0, 0, 173, 437, 506, 0, 0, 425,
+  104, 658, 3, 717, 896, 902, 922, 552, 0, 0, 0, 0, 583, 0, 0, 473,
+  685, 0, 0, 0, 0, 0, 0, 589, 524, 325, 218, 642, 0, 0, 0, 893,
+  0, 81, 163, 913, 0, 681, 0, 0, 0, 0, 0, 576, 442, 250, 515, 666,
+  0, 0, 511, 907, 0, 198, 84, 394, 464, 633, 670, 74, 959, 562, 221, 272,
+  988, 0, 0, 816, 928, 765, 0, 0, 0, 675, 0, 0, 0, 0, 0, 844,
+  0, 659, 976, 747, 514, 232, 617, 758, 786, 912, 944, 981, 0, 0, 0, 806,
+  0, 0, 96, 331, 0, 379, 0, 0, 697, 802, 0, 0, 381, 0, 0, 745,
+  781, 0, 23, 164, 661, 55, 833, 0, 40, 0, 321, 650, 378, 971, 0, 0,
+  0, 0, 0, 0, 0, 547, 168, 635, 0, 657, 0, 0, 855, 0, 0, 0,
+  0, 393, 306, 921, 0, 0, 0, 215, 0, 0, 417, 676, 49, 997, 0, 0,
+  0, 0, 0, 92, 14, 0, 98, 0, 76, 438, 618, 468, 695, 0, 0, 0,
+  0, 0, 626, 0, 817, 0, 159, 0, 0, 0, 0, 0, 0, 0, 0, 736,
+  0, 0, 0, 0, 808, 0, 224, 154, 0, 548, 531, 320, 0, 479, 699, 947,
+  408, 0, 0, 0, 0, 278, 595, 261, 234, 600, 850, 967, 0, 0, 114, 252,
+  563, 894, 948, 0, 0, 0, 363, 0, 0, 471, 580, 312, 0, 926, 763, 888,
+  488, 0, 0, 0, 649, 270, 0, 0, 925, 0, 0, 0, 0, 0, 0, 144,
+  0, 0, 0, 53, 69, 445, 545, 812, 0, 0, 15, 809, 0, 579, 340, 634,
+  477, 823, 281, 995, 937, 300, 0, 0, 72, 0, 0, 0, 0, 0, 0, 549,
+  0, 853, 667, 569, 0, 0, 0, 0, 0, 105, 603, 83, 696, 0, 610, 738,
+  413, 824, 606, 0, 0, 36, 0, 920, 54, 0, 0, 0, 939, 810, 0, 43,
+  517, 651, 704, 973, 0, 0, 0, 664, 0, 68, 539, 0, 0, 446, 182, 79,
+  0, 703, 332, 653, 707, 0, 0, 0, 942, 0, 271, 336, 373, 521, 838, 251,
+  435, 555, 644, 914, 803, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  406, 448, 693, 123, 762, 0, 429, 0, 299, 719, 735, 436, 614, 149, 643, 420,
+  285, 700, 247, 151, 778, 512, 843, 401, 0, 0, 0, 678, 0, 608, 815, 0,
+  673, 226, 0, 204, 708, 0, 0, 690, 2, 0, 540, 0, 0, 466, 0, 0,
+  160, 0, 0, 298, 32, 0, 876, 0, 0, 0, 280, 384, 537, 0, 5, 0,
+  138, 202, 349, 759, 518, 854, 0, 346, 443, 593, 761, 451, 106, 841, 71, 856,
+  0, 319, 796, 826, 262, 0, 0, 919, 0, 898, 932, 0, 382, 0, 0, 0,
+  430, 712, 183, 449, 787, 0, 0, 0, 743, 0, 0, 313, 767, 0, 0, 0,
+  389, 0, 613, 0, 86, 338, 0, 329, 0, 646, 0, 0, 639, 0, 0, 534,
+  0, 0, 127, 12, 193, 0, 0, 692, 0, 0, 0, 865, 414, 0, 0, 495,
+  611, 167, 952, 985, 0, 142, 0, 846, 0, 0, 0, 0, 0, 0, 0, 0,
+  150, 243, 108, 344, 152, 467, 811, 0, 0, 0, 742, 0, 0, 0, 0, 746,
+  0, 282, 0, 0, 0, 0, 0, 454, 253, 998, 228, 607, 701, 398, 136, 949,
+  0, 0, 0, 0, 0, 0, 0, 711, 0, 177, 162, 267, 904, 790, 330, 954,
+  965, 475, 0, 0, 0, 0, 0, 0, 0, 38, 134, 392, 0, 0, 125, 573,
+  0, 352, 0, 638, 819, 34, 291, 85, 0, 166, 772, 0, 737, 0, 0, 0,
+  0, 0, 0, 289, 440, 0, 0, 497, 715, 147, 395, 516, 974, 126, 254, 851,
+  0, 334, 188, 839, 0, 619, 238, 0, 67, 0, 845, 0, 0, 0, 290, 122,
+  0, 230, 601, 10, 0, 109, 283, 385, 405, 481, 0, 0, 0, 0, 304, 0,
+  0, 0, 0, 0, 0, 0, 0, 791, 0, 0, 0, 0, 0, 0, 0, 185,
+  0, 0, 0, 0, 0, 609, 0, 153, 825, 749, 485, 748, 994, 729, 0, 235,
+  492, 476, 916, 178, 0, 0, 504, 343, 0, 0, 0, 0, 0, 510, 957, 0,
+  0, 0, 0, 0, 465, 0, 801, 0, 20, 0, 227, 0, 199, 505, 95, 433,
+};
+
+const char *WA_FREQ_181_TOKENS[] = {
+  "va",
+  "ва",
+  "bilan",
+  "билан",
+  "ҳам",
+  "ham",
+  "бу",
+  "учун",
+  "бир",
+  "nafar",
+  "qiladi",
+  "bir",
+  "uchun",
+  "Ўзбекистон",
+  "aholi",
+  "istiqomat",
+  "Бу",
+  "kishi",
+  "деб",
+  "эди",
+  "бўлган",
+  "2",
+  "bu",
+  "har",
+  "yoki",
+  "ўз",
+  "кўра",
+  "esa",
+  "бўлиб",
+  "олиб",
+  "шу",
+  "bor",
+  "дейди",
+  "йил",
+  "куни",
+  "эса",
+  "бор",
+  "2010",
+  "deb",
+  "boʻlgan",
+  "tashkil",
+  "у",
+  "b.",
+  "Bu",
+  "ҳақида",
+  "suv",
+  "km",
+  "бўйича",
+  "Озодлик",
+  "йўқ",
+  "uning",
+  "керак",
+  "katta",
+  "O‘zbekiston",
+  "мумкин",
+  "eng",
+  "унинг",
+  "Aholisi",
+  "mumkin",
+  "hamda",
+  "olib",
+  "boʻlib",
+  "shu",
+  "қилиб",
+  "бошқа",
+  "ega",
+  "zichligi",
+  "қилган",
+  "ming",
+  "joylashgan",
+  "томонидан",
+  "Aholi",
+  "ishlab",
+  "kvadrat",
+  "деган",
+  "1",
+  "кейин",
+  "kilometrga",
+  "tomonidan",
+  "эмас",
+  "yil",
+  "ҳар",
+  "davlat",
+  "u",
+  "икки",
+  "бўлди",
+  "Respublikasi",
+  "давлат",
+  "boshqa",
+  "қилиш",
+  "иш",
+  "ҳеч",
+  "Россия",
+  "яна",
+  "қилди",
+  "turli",
+  "asosiy",
+  "qilish",
+  "янги",
+  "sifatida",
+  "ўзбек",
+  "keng",
+  "iborat",
+  "muhim",
+  "yangi",
+  "пайтда",
+  "kabi",
+  "катта",
+  "ташкил",
+  "улар",
+  "Toshkent",
+  "Шу",
+  "жуда",
+  "АҚШ",
+  "амалга",
+  "Мен",
+  "энг",
+  "boʻladi",
+  "Ўзбекистонда",
+  "2000",
+  "y.",
+  "ikki",
+  "қарши",
+  "amalga",
+  "яхши",
+  "mavjud",
+  "edi",
+  "etilgan",
+  "ишлаб",
+  "3",
+  "У",
+  "бўлса",
+  "Тошкент",
+  "Oʻzbekiston",
+  "минг",
+  "қандай",
+  "qilib",
+  "ерда",
+  "халқаро",
+  "ўтган",
+  "qilgan",
+  "экан",
+  "barcha",
+  "biri",
+  "oʻz",
+  "мен",
+  "кўп",
+  "ҳамда",
+  "dan",
+  "Лекин",
+  "U",
+  "йилда",
+  "yirik",
+  "10",
+  "уни",
+  "йилнинг",
+  "hosil",
+  "бўлади",
+  "ga",
+  "ишлар",
+  "ta",
+  "барча",
+  "orqali",
+  "бири",
+  "уларнинг",
+  "нима",
+  "20",
+  "қилинган",
+  "одам",
+  "xalqaro",
+  "xalq",
+  "juda",
+  "yuqori",
+  "дея",
+  "shahar",
+  "milliy",
+  "Каримов",
+  "деди",
+  "2006",
+  "давом",
+  "yaqin",
+  "beradi",
+  "ularning",
+  "Ислом",
+  "қабул",
+  "каби",
+  "шундай",
+  "келиб",
+  "qabul",
+  "qilingan",
+  "Shu",
+  "qarshi",
+  "xizmat",
+  "shuningdek",
+  "биз",
+  "etgan",
+  "koʻp",
+  "Shundan",
+  "ёки",
+  "olish",
+  "ular",
+  "necha",
+  "биринчи",
+  "M.",
+  "birinchi",
+  "келган",
+  "иштирок",
+  "A.",
+  "etadi",
+  "hisoblanadi",
+  "haqida",
+  "қилади",
+  "asosan",
+  "пул",
+  "ilmiy",
+  "маълум",
+  "yana",
+  "хабар",
+  "4",
+  "берган",
+  "kuni",
+  "quruqlik",
+  "ish",
+  "1999",
+  "хам",
+  "5",
+  "alohida",
+  "uni",
+  "эълон",
+  "maydonidir",
+  "keyin",
+  "бўлиши",
+  "олган",
+  "emas",
+  "Бироқ",
+  "yaxshi",
+  "нарса",
+  "давомида",
+  "ўзи",
+  "qismi",
+  "Айни",
+  "bo‘lib",
+  "эга",
+  "asosida",
+  "олиш",
+  "m",
+  "Биз",
+  "kelib",
+  "Osiyo",
+  "yilda",
+  "olgan",
+  "яқин",
+  "ortiq",
+  "iqtisodiy",
+  "B.",
+  "ўтди",
+  "йили",
+  "ушбу",
+  "мамлакат",
+  "kelgan",
+  "шаҳар",
+  "орқали",
+  "Республикаси",
+  "umumiy",
+  "maxsus",
+  "бундай",
+  "etish",
+  "ўша",
+  "миллий",
+  "qayta",
+  "киши",
+  "Улар",
+  "этилган",
+  "Islom",
+  "неча",
+  "хизмат",
+  "markazi",
+  "xos",
+  "K.",
+  "беради",
+  "keladi",
+  "2005",
+  "сифатида",
+  "фақат",
+  "ҳуқуқ",
+  "davrida",
+  "нисбатан",
+  "ахборот",
+  "президент",
+  "bo‘lgan",
+  "xil",
+  "Uning",
+  "инсон",
+  "kerak",
+  "Мана",
+  "bosh",
+  "ким",
+  "этиш",
+  "2009",
+  "natijasida",
+  "ishtirok",
+  "holda",
+  "o‘z",
+  "бош",
+  "boʻyicha",
+  "кун",
+  "Агар",
+  "davom",
+  "та",
+  "олинган",
+  "yanada",
+  "қолган",
+  "одамлар",
+  "ҳозир",
+  "этди",
+  "Аммо",
+  "etdi",
+  "oid",
+  "ijtimoiy",
+  "30",
+  "Region.uz",
+  "асосий",
+  "yili",
+  "faqat",
+  "ўртасида",
+  "ning",
+  "шаҳрида",
+  "Марказий",
+  "S.",
+  "Бош",
+  "2004",
+  "orasida",
+  "ichki",
+  "T.",
+  "мана",
+  "paydo",
+  "президенти",
+  "Чунки",
+  "nisbatan",
+  "15",
+  "birga",
+  "уларни",
+  "йилдан",
+  "bo‘yicha",
+  "yerda",
+  "6",
+  "чиқиб",
+  "boʻlishi",
+  "q",
+  "унга",
+  "раҳбари",
+  "y.da",
+  "Oʻrta",
+  "ushbu",
+  "кунда",
+  "ishlari",
+  "Унинг",
+  "ичида",
+  "etildi",
+  "ҳукумати",
+  "oladi",
+  "йўл",
+  "Бир",
+  "жавоб",
+  "талаб",
+  "пахта",
+  "I.",
+  "янада",
+  "Қирғизистон",
+  "turi",
+  "ўзининг",
+  "вилоят",
+  "nomi",
+  "турли",
+  "2008",
+  "jumladan",
+  "ҳукумат",
+  "жорий",
+  "faoliyat",
+  "миллион",
+  "уч",
+  "Markaziy",
+  "ака",
+  "yillik",
+  "нафар",
+  "mamlakat",
+  "ташқари",
+  "балки",
+  "olingan",
+  "муҳим",
+  "бери",
+  "topgan",
+  "qildi",
+  "халқ",
+  "harbiy",
+  "12",
+  "Ular",
+  "kichik",
+  "siyosiy",
+  "sanoat",
+  "100",
+  "ishlar",
+  "берди",
+  "G.",
+  "Ҳозир",
+  "сўнг",
+  "тўғри",
+  "davomida",
+  "тўғрисида",
+  "орасида",
+  "вазири",
+  "Давлат",
+  "этган",
+  "Buxoro",
+  "tashqari",
+  "қўлга",
+  "иқтисодий",
+  "лекин",
+  "bogʻliq",
+  "viloyati",
+  "7",
+  "unga",
+  "da",
+  "koʻra",
+  "мазкур",
+  "qanday",
+  "soni",
+  "меҳнат",
+  "суд",
+  "ёрдам",
+  "болалар",
+  "tufayli",
+  "матбуот",
+  "ҳақда",
+  "вакиллари",
+  "qishloq",
+  "Ўртоқлашиш",
+  "ходимлари",
+  "ҳарбий",
+  "oliy",
+  "газ",
+  "энди",
+  "алоҳида",
+  "Rossiya",
+  "qolgan",
+  "қаердан",
+  "Бундан",
+  "сиёсий",
+  "Uznews.net",
+  "axborot",
+  "юзасидан",
+  "tabiiy",
+  "махсус",
+  "ортиқ",
+  "degan",
+  "marta",
+  "эътибор",
+  "дан",
+  "Шунинг",
+  "вилояти",
+  "содир",
+  "ҳолда",
+  "қадар",
+  "га",
+  "оид",
+  "келади",
+  "ҳақидаги",
+  "айтишича",
+  "Ўзбекистоннинг",
+  "ҳуқуқлари",
+  "Karimov",
+  "Ўзбекистонга",
+  "муаллиф",
+  "gaz",
+  "бугун",
+  "этилди",
+  "ҳамма",
+  "кенг",
+  "бориб",
+  "сув",
+  "inson",
+  "ularni",
+  "шунингдек",
+  "8",
+  "musiqa",
+  "битта",
+  "бугунги",
+  "O'zbekiston",
+  "Шунингдек",
+  "Осиё",
+  "Европа",
+  "Oʻzbekistonda",
+  "қишлоқ",
+  "боғлиқ",
+  "50",
+  "сони",
+  "Yevropa",
+  "hamkorlik",
+  "ишлари",
+  "маҳаллий",
+  "Ўзбекистондаги",
+  "tarqalgan",
+  "Davlat",
+  "tashqi",
+  "yilning",
+  "vujudga",
+  "chiqqan",
+  "ҳаракат",
+  "jahon",
+  "qancha",
+  "ëки",
+  "этади",
+  "butun",
+  "қилинди",
+  "savdo",
+  "қайта",
+  "jihatdan",
+  "turadi",
+  "zamonaviy",
+  "ayrim",
+  "odam",
+  "yer",
+  "Samarqand",
+  "кетган",
+  "mahalliy",
+  "марта",
+  "ayniqsa",
+  "chiqarish",
+  "собиқ",
+  "qator",
+  "oʻzbek",
+  "олдин",
+  "P.",
+  "ишга",
+  "y.dan",
+  "gacha",
+  "shunday",
+  "oʻrta",
+  "сабаб",
+  "Ushbu",
+  "tarixiy",
+  "бутун",
+  "Андижон",
+  "D.",
+  "Milliy",
+  "чиққан",
+  "айтди",
+  "расмий",
+  "qilindi",
+  "Тожикистон",
+  "ўзбекистонлик",
+  "ойида",
+  "Энди",
+  "maʼlum",
+  "ҳимоя",
+  "18",
+  "11",
+  "ўзига",
+  "мурожаат",
+  "бериш",
+  "bergan",
+  "бизнинг",
+  "иккинчи",
+  "ой",
+  "balki",
+  "lekin",
+  "гап",
+  "ўзини",
+  "бирга",
+  "hozirgi",
+  "Халқаро",
+  "Shuningdek",
+  "paytda",
+  "буни",
+  "асосида",
+  "ўтказилган",
+  "чиқариш",
+  "эканини",
+  "hech",
+  "qayd",
+  "13",
+  "юқори",
+  "вазирлиги",
+  "Yosh",
+  "berish",
+  "ilk",
+  "уларга",
+  "vakillari",
+  "Lekin",
+  "кўриб",
+  "16",
+  "elektr",
+  "9",
+  "ziyod",
+  "maqsadida",
+  "вакили",
+  "қарор",
+  "борасида",
+  "kuchli",
+  "ҳамкорлик",
+  "мақсадида",
+  "Олий",
+  "25",
+  "ёш",
+  "боис",
+  "badiiy",
+  "нинг",
+  "фаолият",
+  "Bunday",
+  "сўзларига",
+  "etib",
+  "yordam",
+  "ЎзА",
+  "q.",
+  "ҳал",
+  "kam",
+  "қатор",
+  "sport",
+  "жаҳон",
+  "хавфсизлик",
+  "туман",
+  "ahamiyatga",
+  "Тошкентда",
+  "билдирди",
+  "ochiq",
+  "kunda",
+  "qilinadi",
+  "harakat",
+  "yosh",
+  "mustaqil",
+  "boʻldi",
+  "аҳоли",
+  "Prezidenti",
+  "mazkur",
+  "taʼsir",
+  "ikkinchi",
+  "буён",
+  "Navoiy",
+  "zarur",
+  "rivojlantirish",
+  "oshirish",
+  "paxta",
+  "14",
+  "bunday",
+  "uchraydi",
+  "жумладан",
+  "joriy",
+  "AQSH",
+  "лозим",
+  "кўплаб",
+  "yarim",
+  "мустақил",
+  "олди",
+  "қолди",
+  "Har",
+  "ichida",
+  "Бугун",
+  "бўлгани",
+  "faoliyati",
+  "менинг",
+  "сўнгги",
+  "ижтимоий",
+  "ошириш",
+  "пайдо",
+  "Ўтган",
+  "сиз",
+  "jamoat",
+  "bolalar",
+  "хизмати",
+  "yoshlar",
+  "сўм",
+  "faol",
+  "Мазкур",
+  "mehnat",
+  "ўртасидаги",
+  "таклиф",
+  "қилишга",
+  "2007",
+  "ҳибсга",
+  "Ўша",
+  "madaniy",
+  "kun",
+  "yuksak",
+  "Ҳар",
+  "undan",
+  "ko‘ra",
+  "oʻziga",
+  "кетди",
+  "berilgan",
+  "кўпроқ",
+  "himoya",
+  "келди",
+  "mansub",
+  "турган",
+  "Сиз",
+  "доирасида",
+  "муҳокама",
+  "haqidagi",
+  "умуман",
+  "qarab",
+  "Oliy",
+  "бироқ",
+  "савдо",
+  "сотиб",
+  "200",
+  "hamma",
+  "намойиш",
+  "Bir",
+  "айтиб",
+  "қилмоқда",
+  "oʻzaro",
+  "Кейин",
+  "toʻgʻri",
+  "ravishda",
+  "озод",
+  "қонун",
+  "замонавий",
+  "ривожлантириш",
+  "Миллий",
+  "аниқ",
+  "оддий",
+  "анча",
+  "оммавий",
+  "rus",
+  "сайлов",
+  "O’zbekiston",
+  "Yer",
+  "ni",
+  "бундан",
+  "barpo",
+  "БМТ",
+  "диний",
+  "soʻng",
+  "айни",
+  "юз",
+  "mas",
+  "этиб",
+  "40",
+  "мавжуд",
+  "yaratilgan",
+  "туриб",
+  "ўқув",
+  "shahrida",
+  "aniq",
+  "Bosh",
+  "чоғида",
+  "yordamida",
+  "madaniyat",
+  "Ушбу",
+  "yildan",
+  "tizimi",
+  "17",
+  "Buyuk",
+  "ishlatiladi",
+  "yuz",
+  "Самарқанд",
+  "sanoati",
+  "muayyan",
+  "sabab",
+  "милиция",
+  "қанча",
+  "korxonalari",
+  "кейинги",
+  "таълим",
+  "b-n",
+  "ички",
+  "бағишланган",
+  "berdi",
+  "foydalanish",
+  "Москва",
+  "агар",
+  "беш",
+  "R.",
+  "бунинг",
+  "йилга",
+  "аввал",
+  "ана",
+  "ҳатто",
+  "спорт",
+  "turlari",
+  "mahsulotlari",
+  "V.",
+  "қайд",
+  "ancha",
+  "keldi",
+  "мажбур",
+  "телефон",
+  "tarixi",
+  "менга",
+  "Қозоғистон",
+  "oldi",
+  "айтади",
+  "boy",
+  "ўтиб",
+  "Уларнинг",
+  "Xitoy",
+  "ташкилоти",
+  "этмоқда",
+  "ярим",
+  "qiluvchi",
+  "Ўш",
+  "бўлмаган",
+  "boshlab",
+  "тан",
+  "yillarda",
+  "йирик",
+  "Xalqaro",
+  "ёшлар",
+  "Unda",
+  "зиёд",
+  "tegishli",
+  "nashr",
+  "Навоий",
+  "май",
+  "қўшимча",
+  "togʻ",
+  "яъни",
+  "kiradi",
+  "O‘zbekistonda",
+  "қўйилган",
+  "rivojlangan",
+  "tarkibida",
+  "ishlash",
+  "mashhur",
+  "viloyat",
+  "dengiz",
+  "Каримовнинг",
+  "asos",
+  "hal",
+  "oʻrtacha",
+  "раиси",
+  "Россияда",
+  "остида",
+  "shahri",
+  "F.",
+  "йиллик",
+  "жойлашган",
+  "маркази",
+  "turgan",
+  "N.",
+  "moddalar",
+  "Масалан",
+  "tomonlama",
+  "chuqur",
+  "бунга",
+  "олади",
+  "boʻlsa",
+  "Ўзбек",
+  "ҳали",
+  "deya",
+  "yaʼni",
+  "neft",
+  "олдида",
+  "lozim",
+  "xususiy",
+  "айрим",
+  "o‘tdi",
+  "жиддий",
+  "иборат",
+  "чиқиш",
+  "diniy",
+  "вилоятида",
+  "туфайли",
+  "J.",
+  "xabar",
+  "тегишли",
+  "айтган",
+  "davri",
+  "равишда",
+  "E.",
+  "бизга",
+  "таъминлаш",
+  "yerida",
+  "кам",
+  "оғир",
+  "fan",
+  "olinadi",
+  "бериб",
+  "bo‘ldi",
+  "бирор",
+  "Agar",
+  "олий",
+  "бошлади",
+  "бўлмайди",
+  "rahbari",
+  "yuzaga",
+  "шунақа",
+  "айнан",
+  "yoʻli",
+  "журналист",
+  "кириб",
+  "жалб",
+  "соат",
+  "устидан",
+  "ekan",
+  "qurilish",
+  "эдим",
+  "Бунинг",
+  "dastlabki",
+  "берилган",
+  "ataladi",
+  "qonun",
+  "60",
+  "расмийлари",
+  "ҳаммаси",
+  "vaqt",
+  "boshqalar",
+  "qadar",
+  "асосан",
+  "нарсани",
+  "Olmoniyaning",
+  "аммо",
+  "оқибатида",
+  "talab",
+  "албатта",
+  "chiqib",
+  "таъкидлади",
+  "Ayni",
+  "deydi",
+  "tili",
+  "doirasida",
+  "ommaviy",
+  "иккита",
+  "Toshkentda",
+  "24",
+  "республика",
+  "amaliy",
+  "қилаётган",
+  "taʼlim",
+  "йилги",
+  "нафақат",
+  "etiladi",
+  "Bundan",
+  "кичик",
+  "boʻlinadi",
+  "qismida",
+  "Бундай",
+  "2011",
+  "uch",
+  "бошлаб",
+  "o‘tgan",
+  "Yangi",
+  "asarlari",
+  "ҳисобланади",
+  "ёшли",
+  "ўзаро",
+  "aholisi",
+  "тарзда",
+  "qurilgan",
+  "тўғрисидаги",
+  "22",
+  "ishga",
+  "фоиз",
+  "av.",
+  "мени",
+  "вақт",
+  "madaniyati",
+  "500",
+  "Бугунги",
+  "Яна",
+  "мамлакатда",
+  "ўн",
+  "foydalaniladi",
+  "kimyoviy",
+  "Нима",
+  "тўрт",
+  "фикрича",
+  "yoʻl",
+  "турибди",
+  "oʻquv",
+  "даражада",
+  "aks",
+  "pul",
+  "Янги",
+  "пайтида",
+  "farq",
+  "жамоаси",
+  "зарур",
+  "иши",
+  "e’tibor",
+  "Хитой",
+  "million",
+  "фаолияти",
+  "ko‘p",
+  "uzoq",
+  "sohasida",
+  "Mazkur",
+  "erkin",
+  "yetakchi",
+  "300",
+  "Ularning",
+  "хил",
+  "hududida",
+  "ajralib",
+  "davrda",
+  "сўз",
+  "фикр",
+  "узоқ",
+  "bo'lib",
+  "markaziy",
+};
+const uint16_t WA_FREQ_181_RANKS[] = {
+  0, 0, 0, 515, 0, 0, 973, 0, 0, 220, 35, 197, 791, 673, 0, 0,
+  0, 0, 0, 694, 0, 0, 0, 0, 0, 0, 0, 659, 0, 0, 401, 204,
+  0, 11, 0, 0, 164, 200, 0, 0, 374, 0, 211, 0, 0, 0, 0, 0,
+  123, 0, 145, 376, 0, 0, 141, 456, 304, 530, 300, 0, 339, 365, 426, 307,
+  450, 461, 23, 958, 1000, 0, 0, 0, 825, 569, 648, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 126, 0, 0, 0, 0, 0, 421, 0, 0,
+  0, 0, 119, 735, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 0,
+  0, 0, 0, 466, 823, 62, 333, 852, 257, 0, 0, 772, 487, 0, 46, 318,
+  367, 725, 0, 0, 140, 74, 676, 0, 0, 652, 0, 0, 432, 0, 0, 209,
+  830, 357, 983, 0, 746, 105, 93, 273, 952, 196, 0, 0, 0, 0, 0, 0,
+  385, 827, 0, 0, 85, 521, 894, 0, 0, 44, 0, 0, 0, 21, 436, 91,
+  576, 808, 841, 322, 539, 869, 256, 621, 968, 634, 0, 982, 0, 0, 0, 38,
+  598, 0, 0, 4, 0, 0, 0, 0, 0, 889, 0, 0, 0, 0, 0, 498,
+  18, 372, 551, 0, 0, 114, 514, 0, 288, 651, 0, 0, 846, 0, 0, 0,
+  992, 512, 486, 0, 0, 554, 945, 0, 0, 0, 68, 0, 24, 106, 0, 542,
+  838, 649, 0, 0, 733, 0, 977, 0, 0, 0, 0, 0, 835, 0, 0, 0,
+  0, 0, 857, 0, 686, 0, 0, 0, 0, 0, 749, 214, 32, 935, 0, 0,
+  0, 315, 927, 347, 0, 99, 790, 765, 364, 492, 719, 971, 0, 0, 0, 544,
+  217, 503, 848, 0, 0, 0, 0, 0, 0, 0, 0, 0, 793, 785, 0, 0,
+  19, 921, 533, 0, 0, 0, 0, 0, 134, 0, 0, 0, 0, 0, 931, 128,
+  201, 535, 443, 0, 7, 752, 727, 0, 263, 646, 413, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 317, 707, 480, 585, 0, 0, 0, 0, 774, 0,
+  468, 559, 0, 0, 261, 388, 137, 435, 616, 0, 0, 9, 27, 283, 745, 960,
+  0, 0, 0, 0, 561, 0, 798, 0, 0, 0, 0, 0, 285, 0, 0, 0,
+  316, 0, 0, 249, 0, 0, 0, 387, 0, 0, 684, 166, 0, 294, 675, 0,
+  898, 0, 0, 0, 939, 495, 0, 0, 0, 279, 705, 843, 0, 0, 271, 0,
+  0, 362, 445, 829, 0, 0, 272, 237, 0, 543, 0, 628, 0, 0, 0, 0,
+  0, 0, 0, 557, 154, 375, 398, 528, 0, 950, 0, 0, 0, 734, 0, 0,
+  580, 0, 88, 162, 235, 0, 0, 0, 0, 394, 0, 15, 464, 566, 355, 678,
+  465, 944, 0, 0, 0, 708, 0, 760, 906, 243, 641, 717, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 926, 0, 0, 0, 0, 0, 0, 0, 966, 683,
+  0, 0, 0, 0, 0, 552, 0, 0, 0, 0, 0, 50, 248, 80, 454, 0,
+  173, 392, 212, 474, 669, 56, 702, 780, 627, 60, 930, 955, 136, 0, 12, 499,
+  644, 92, 736, 564, 0, 0, 378, 540, 230, 0, 653, 0, 0, 0, 0, 0,
+  0, 0, 0, 284, 922, 0, 788, 0, 207, 0, 0, 0, 0, 83, 630, 0,
+  655, 0, 0, 0, 0, 0, 520, 0, 31, 127, 0, 0, 0, 0, 321, 0,
+  0, 510, 812, 129, 255, 281, 656, 805, 770, 0, 0, 0, 759, 832, 0, 988,
+  0, 787, 0, 0, 404, 617, 637, 0, 155, 310, 110, 716, 408, 0, 0, 0,
+  70, 0, 0, 102, 607, 0, 0, 0, 0, 0, 0, 0, 58, 0, 0, 0,
+  275, 611, 159, 642, 831, 888, 893, 0, 907, 589, 351, 667, 779, 874, 0, 737,
+  0, 0, 210, 0, 0, 0, 824, 0, 40, 867, 693, 0, 505, 685, 886, 0,
+  0, 0, 0, 111, 311, 0, 0, 0, 961, 0, 0, 0, 0, 0, 996, 0,
+  547, 0, 0, 985, 0, 0, 0, 245, 309, 53, 0, 260, 578, 558, 0, 0,
+  0, 0, 0, 0, 0, 0, 202, 0, 0, 0, 37, 0, 66, 54, 0, 0,
+  599, 0, 0, 0, 0, 0, 0, 0, 291, 0, 0, 0, 0, 517, 1, 0,
+  541, 0, 0, 718, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  190, 292, 0, 0, 280, 972, 0, 0, 0, 455, 905, 51, 0, 259, 0, 0,
+  0, 0, 697, 61, 221, 0, 0, 0, 485, 861, 0, 382, 0, 104, 0, 0,
+  0, 0, 158, 0, 286, 0, 0, 0, 0, 0, 609, 0, 0, 0, 0, 0,
+  0, 0, 278, 0, 815, 817, 0, 63, 682, 0, 626, 302, 0, 0, 0, 0,
+  0, 0, 0, 0, 605, 681, 0, 0, 850, 663, 206, 0, 170, 225, 0, 0,
+  0, 781, 67, 0, 43, 0, 0, 620, 0, 603, 238, 320, 720, 896, 252, 0,
+  0, 0, 0, 747, 0, 0, 677, 163, 0, 0, 849, 55, 167, 834, 0, 0,
+  410, 0, 0, 3, 821, 0, 518, 470, 629, 41, 692, 219, 819, 596, 0, 0,
+  0, 0, 0, 425, 0, 192, 709, 782, 131, 381, 412, 801, 0, 418, 0, 361,
+  187, 236, 78, 49, 0, 458, 0, 803, 0, 638, 0, 0, 0, 0, 0, 0,
+  879, 0, 268, 855, 203, 534, 537, 590, 502, 976, 380, 0, 0, 0, 624, 0,
+  0, 390, 420, 0, 0, 276, 148, 483, 730, 146, 306, 602, 258, 679, 0, 152,
+  0, 0, 0, 0, 467, 472, 640, 871, 909, 39, 481, 786, 860, 878, 854, 371,
+  969, 0, 194, 0, 0, 0, 751, 71, 218, 0, 185, 383, 954, 0, 0, 913,
+  795, 974, 120, 500, 0, 360, 513, 0, 575, 0, 0, 0, 0, 920, 0, 0,
+  0, 0, 0, 94, 8, 563, 396, 0, 970, 0, 0, 740, 0, 0, 0, 0,
+  171, 433, 161, 688, 604, 763, 928, 0, 0, 750, 427, 386, 0, 130, 839, 967,
+  312, 511, 877, 358, 975, 0, 181, 224, 0, 482, 998, 847, 0, 0, 0, 0,
+  446, 0, 0, 0, 0, 962, 0, 352, 411, 934, 234, 0, 0, 0, 469, 613,
+  666, 0, 115, 0, 0, 807, 478, 0, 0, 0, 0, 0, 0, 417, 625, 916,
+  0, 0, 269, 0, 0, 0, 562, 0, 623, 0, 0, 0, 0, 0, 631, 842,
+  853, 0, 112, 42, 359, 662, 405, 0, 715, 504, 721, 840, 941, 103, 343, 924,
+  0, 109, 0, 0, 0, 600, 0, 0, 0, 0, 0, 732, 0, 340, 670, 864,
+  0, 0, 0, 0, 329, 319, 612, 784, 794, 397, 919, 948, 332, 0, 724, 0,
+  0, 0, 0, 0, 0, 0, 118, 0, 0, 674, 957, 0, 0, 0, 0, 0,
+  0, 98, 0, 493, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 991, 189, 506, 527, 574, 959, 34, 402, 122, 987, 546, 0, 0, 227, 0,
+  654, 0, 0, 264, 0, 444, 13, 175, 303, 556, 582, 0, 570, 65, 90, 622,
+  10, 298, 0, 48, 809, 943, 661, 0, 873, 965, 0, 0, 989, 0, 837, 0,
+  353, 820, 0, 592, 379, 290, 723, 856, 0, 346, 262, 0, 452, 0, 389, 77,
+  940, 890, 999, 799, 0, 116, 0, 875, 0, 680, 325, 459, 0, 739, 0, 403,
+  0, 933, 942, 0, 742, 139, 414, 572, 0, 72, 0, 595, 0, 0, 0, 0,
+  0, 851, 345, 153, 0, 0, 516, 690, 323, 370, 994, 81, 0, 0, 0, 0,
+  696, 151, 932, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 328, 0,
+  0, 0, 738, 865, 0, 0, 0, 806, 0, 335, 0, 0, 0, 0, 0, 89,
+  434, 0, 0, 0, 545, 714, 754, 882, 183, 0, 149, 695, 176, 0, 764, 0,
+  0, 553, 792, 0, 771, 0, 0, 0, 0, 768, 501, 0, 0, 0, 0, 26,
+  593, 0, 0, 0, 804, 925, 174, 0, 0, 0, 16, 430, 14, 424, 858, 0,
+  870, 0, 0, 475, 0, 0, 121, 0, 713, 0, 0, 0, 471, 125, 929, 0,
+  0, 0, 0, 0, 0, 0, 270, 0, 87, 0, 0, 195, 476, 132, 45, 22,
+  228, 431, 0, 407, 0, 150, 489, 722, 778, 953, 531, 0, 0, 0, 0, 453,
+  17, 507, 844, 845, 0, 117, 0, 250, 691, 0, 0, 633, 0, 706, 912, 0,
+  240, 479, 731, 377, 895, 0, 0, 0, 0, 0, 0, 0, 0, 0, 82, 76,
+  0, 0, 0, 0, 0, 0, 6, 0, 95, 0, 265, 647, 614, 963, 0, 0,
+  0, 0, 0, 124, 246, 369, 391, 990, 296, 193, 0, 0, 0, 253, 341, 0,
+  84, 872, 5, 59, 484, 828, 0, 334, 726, 0, 0, 0, 488, 0, 28, 743,
+  0, 519, 757, 338, 632, 490, 0, 0, 769, 0, 703, 0, 571, 0, 783, 744,
+  0, 0, 0, 0, 0, 573, 0, 0, 0, 704, 0, 496, 0, 0, 636, 0,
+  463, 0, 241, 226, 756, 165, 885, 0, 356, 0, 979, 660, 0, 0, 0, 0,
+  327, 997, 0, 532, 0, 0, 0, 0, 657, 0, 79, 0, 0, 0, 0, 0,
+  0, 0, 711, 0, 0, 184, 213, 191, 591, 0, 0, 0, 0, 0, 168, 107,
+  313, 526, 0, 0, 0, 0, 0, 0, 0, 20, 0, 866, 0, 0, 0, 0,
+  156, 0, 0, 0, 0, 0, 753, 775, 0, 0, 0, 0, 0, 917, 180, 251,
+  710, 0, 0, 0, 0, 0, 891, 100, 658, 0, 0, 0, 0, 699, 0, 0,
+  0, 0, 0, 0, 0, 762, 0, 344, 0, 308, 229, 157, 0, 610, 0, 0,
+  36, 826, 0, 0, 0, 29, 0, 0, 901, 0, 0, 0, 0, 497, 549, 700,
+  951, 645, 993, 577, 0, 0, 0, 0, 477, 701, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 439, 643, 0, 342, 0, 182, 0, 0, 277, 0, 441, 816, 0,
+  0, 0, 0, 0, 113, 0, 233, 460, 0, 0, 0, 384, 862, 0, 902, 0,
+  399, 859, 0, 0, 986, 232, 0, 687, 597, 47, 0, 777, 449, 548, 0, 579,
+  761, 822, 0, 0, 949, 143, 908, 565, 584, 758, 0, 0, 524, 0, 729, 0,
+  508, 0, 0, 52, 75, 586, 0, 33, 274, 0, 0, 0, 0, 0, 0, 366,
+  536, 938, 0, 0, 409, 0, 0, 0, 0, 915, 0, 964, 0, 0, 0, 0,
+  0, 73, 415, 0, 0, 172, 0, 354, 0, 86, 0, 525, 0, 336, 698, 650,
+  363, 748, 0, 0, 0, 0, 689, 0, 437, 0, 0, 741, 0, 494, 529, 0,
+  330, 606, 0, 639, 0, 984, 0, 491, 0, 0, 0, 813, 0, 0, 0, 560,
+  0, 0, 199, 160, 406, 587, 400, 802, 811, 884, 0, 0, 198, 555, 186, 448,
+  567, 881, 664, 618, 789, 981, 0, 0, 108, 728, 995, 348, 0, 0, 0, 416,
+  880, 911, 0, 923, 0, 205, 247, 101, 216, 326, 395, 419, 299, 668, 766, 712,
+  947, 0, 900, 0, 0, 0, 0, 289, 0, 30, 293, 349, 428, 188, 818, 429,
+  96, 897, 0, 0, 523, 0, 295, 0, 0, 0, 0, 635, 892, 0, 0, 797,
+  833, 0, 522, 0, 0, 0, 440, 64, 0, 0, 0, 215, 903, 918, 0, 0,
+  0, 978, 0, 608, 0, 314, 0, 133, 447, 0, 147, 0, 0, 980, 0, 0,
+  0, 0, 0, 223, 231, 615, 144, 914, 337, 936, 0, 0, 423, 0, 0, 0,
+  0, 373, 0, 568, 0, 473, 0, 0, 297, 331, 0, 305, 0, 69, 282, 266,
+  796, 800, 814, 0, 438, 179, 222, 324, 588, 583, 755, 244, 581, 57, 178, 904,
+  0, 242, 509, 301, 350, 0, 0, 0, 0, 0, 0, 135, 142, 287, 208, 0,
+  0, 0, 368, 0, 0, 538, 457, 863, 0, 0, 462, 0, 0, 422, 0, 0,
+  937, 0, 0, 393, 177, 910, 0, 0, 0, 0, 0, 773, 239, 0, 0, 0,
+  810, 0, 0, 0, 169, 619, 868, 876, 899, 836, 883, 601, 776, 550, 97, 138,
+  442, 946, 2, 594, 767, 0, 267, 0, 956, 0, 0, 0, 0, 671, 0, 0,
+  0, 0, 0, 672, 887, 0, 0, 0, 0, 0, 665, 0, 451, 0, 0, 0,
+};
+
+const char *WA_FREQ_182_TOKENS[] = {
+  "u",
+  "vha",
+  "na",
+  "a",
+  "ya",
+  "nga",
+  "kha",
+  "tshi",
+  "ha",
+  "uri",
+  "wa",
+  "ndi",
+  "ri",
+  "vho",
+  "o",
+  "dza",
+  "zwi",
+  "zwa",
+  "tsha",
+  "khou",
+  "Mudzimu",
+  "hu",
+  "i",
+  "sa",
+  "hone",
+  "ḓo",
+  "yo",
+  "vhathu",
+  "Ndi",
+  "do",
+  "ita",
+  "Ri",
+  "dzi",
+  "la",
+  "Yesu",
+  "ho",
+  "musi",
+  "U",
+  "amba",
+  "no",
+  "lwa",
+  "si",
+  "kana",
+  "vhona",
+  "ḽa",
+  "zwo",
+  "ni",
+  "vhe",
+  "Nga",
+  "bva",
+  "mu",
+  "thoma",
+  "zwine",
+  "tou",
+  "Tshipembe",
+  "tea",
+  "di",
+  "Kha",
+  "tshifhinga",
+  "Afurika",
+  "A",
+  "shango",
+  "ra",
+  "dovha",
+  "ine",
+  "Vho",
+  "dzo",
+  "kona",
+  "muthu",
+  "phanḓa",
+  "Vha",
+  "nahone",
+  "wo",
+  "fanela",
+  "muvhuso",
+  "I",
+  "wana",
+  "vhana",
+  "munwe",
+  "ane",
+  "itela",
+  "Afurika Tshipembe",
+  "vhane",
+  "munna",
+  "shuma",
+  "hune",
+  "songo",
+  "Musi",
+  "lushaka",
+  "O",
+  "swika",
+  "e",
+  "ḓi",
+  "murahu",
+  "fhasi",
+  "dzula",
+  "mishumo",
+  "vhu",
+  "isa",
+  "hafhu",
+  "fhedzi",
+  "li",
+  "tsho",
+  "ro",
+  "we",
+  "Tshifanyiso",
+  "zwe",
+  "re",
+  "ndila",
+  "arali",
+  "thusa",
+  "vhudza",
+  "maanda",
+  "mushumo",
+  "wawe",
+  "sumbedza",
+  "ngo",
+  "ene",
+  "pfi",
+  "vhuya",
+  "ndeme",
+  "vhothe",
+  "ikonomi",
+  "zwithu",
+  "Lushaka",
+  "yashu",
+  "da",
+  "vhanwe",
+  "lu",
+  "awe",
+  "vhone",
+  "divha",
+  "pfa",
+  "Ro",
+  "muṅwe",
+  "Hone",
+  "ralo",
+  "dzhia",
+  "ḽi",
+  "ngauri",
+  "fhiraho",
+  "mbo",
+  "toda",
+  "kale",
+  "hani",
+  "Hu",
+  "iyi",
+  "mafhungo",
+  "maanḓa",
+  "khosi",
+  "nḓila",
+  "pfunzo",
+  "phanda",
+  "Isiraele",
+  "tshitshavha",
+  "vhukati",
+  "Na",
+  "nda",
+  "yawe",
+  "fhethu",
+  "funa",
+  "havho",
+  "vhukuma",
+  "nwana",
+  "vhutshilo",
+  "Ni",
+  "tshine",
+  "Afrika",
+  "duvha",
+  "ngei",
+  "miṅwaha",
+  "nṱha",
+  "ye",
+  "itwa",
+  "musadzi",
+  "dzhena",
+  "kone",
+  "he",
+  "khotsi",
+  "zwone",
+  "shumisa",
+  "thetshelesa",
+  "zwino",
+  "Vhathu",
+  "zwothe",
+  "humbula",
+  "tshumelo",
+  "ṅwaha",
+  "Arali",
+  "ṱoḓa",
+  "tshithu",
+  "tsini",
+  "Vhavenda",
+  "mbekanyamushumo",
+  "pfanelo",
+  "shangoni",
+  "tenda",
+  "dzine",
+  "tshimbila",
+  "mini",
+  "tshe",
+  "Ho",
+  "fhambanaho",
+  "ḽashu",
+  "Fhedzi",
+  "ari",
+  "mme",
+  "vhanna",
+  "athu",
+  "humbela",
+  "mveledziso",
+  "vhanzhi",
+  "vhukoni",
+  "izwi",
+  "mulayo",
+  "nea",
+  "itshi",
+  "uyu",
+  "vhawe",
+  "vhoṱhe",
+  "musidzana",
+  "ngoho",
+  "fara",
+  "tshila",
+  "wanala",
+  "ḽo",
+  "ngomu",
+  "sedza",
+  "hayani",
+  "luambo",
+  "bveledza",
+  "fana",
+  "guda",
+  "wavho",
+  "yavho",
+  "Zwi",
+  "tama",
+  "Izwi",
+  "aluwa",
+  "avho",
+  "zwauri",
+  "Neo",
+  "huna",
+  "kwa",
+  "vhala",
+  "khulwane",
+  "sika",
+  "tshifanyiso",
+  "hezwi",
+  "lo",
+  "Muvhuso",
+  "bvelela",
+  "khathihi",
+  "vhashumi",
+  "Hezwi",
+  "fhaṱa",
+  "fhira",
+  "katela",
+  "maitele",
+  "ḓuvha",
+  "teaho",
+  "vhea",
+  "fa",
+  "hashu",
+  "ndivho",
+  "tsumbo",
+  "zwavhudi",
+  "fhedza",
+  "mvelaphanḓa",
+  "ndo",
+  "vhunga",
+  "ima",
+  "naho",
+  "sekithara",
+  "vhafumakadzi",
+  "1.",
+  "Khosi",
+  "Ndaulo",
+  "Ndo",
+  "dzavho",
+  "linwe",
+  "ngoma",
+  "maipfi",
+  "mulenzhe",
+  "thandela",
+  "une",
+  "vhulaha",
+  "zwavhuḓi",
+  "Naa",
+  "dzashu",
+  "khwinisa",
+  "lufuno",
+  "lwo",
+  "shela",
+  "vhaswa",
+  "zwinzhi",
+  "ḽifhasi",
+  "engedza",
+  "maḓi",
+  "washu",
+  "Ndalukano",
+  "bugu",
+  "masheleni",
+  "miḽioni",
+  "tevhelaho",
+  "itea",
+  "yone",
+  "zwivhi",
+  "Murena",
+  "Muthu",
+  "Sathane",
+  "funza",
+  "vhudzisa",
+  "Saulo",
+  "hetshi",
+  "minwaha",
+  "tshiṅwe",
+  "vhashu",
+  "Muya",
+  "Sa",
+  "nge",
+  "tangana",
+  "uya",
+  "vhupo",
+  "zwenezwo",
+  "Mushe",
+  "Yosefa",
+  "khwaṱhisa",
+  "mbofholowo",
+  "vhadzulapo",
+  "ḓaho",
+  "ṋetshedza",
+  "Kristo",
+  "muthihi",
+  "nyaluwo",
+  "tshelede",
+  "vhasidzana",
+  "Munna",
+  "dzinwe",
+  "khwine",
+  "mudi",
+  "mulandu",
+  "naa",
+  "ngeno",
+  "shumiswa",
+  "tshanduko",
+  "tshinwe",
+  "tshipiḓa",
+  "ṱuṱuwedza",
+  "Ngauralo",
+  "Tsha",
+  "hawe",
+  "madi",
+  "milayo",
+  "muhulwane",
+  "muḓagasi",
+  "sia",
+  "vhagudi",
+  "Mbekanyamushumo",
+  "ipfi",
+  "kushumele",
+  "lini",
+  "mabindu",
+  "maduvha",
+  "mufumakadzi",
+  "nnzhi",
+  "tamba",
+  "tevhela",
+  "tikedza",
+  "vuwa",
+  "zwiliwa",
+  "mashango",
+  "nnda",
+  "nnyi",
+  "ntha",
+  "shumela",
+  "swikelela",
+  "thaidzo",
+  "vhavhili",
+  "vhonala",
+  "Davida",
+  "HIV",
+  "fhindula",
+  "kule",
+  "kunda",
+  "mune",
+  "roṱhe",
+  "themamveledziso",
+  "wela",
+  "zwiṅwe",
+  "mavu",
+  "minzhi",
+  "mulalo",
+  "muya",
+  "nne",
+  "tadulu",
+  "tshikolo",
+  "uyo",
+  "Ha",
+  "Muphuresidennde",
+  "Venda",
+  "Yuda",
+  "fhano",
+  "fulufhela",
+  "hei",
+  "humela",
+  "mbeu",
+  "nndwa",
+  "rine",
+  "takala",
+  "tuwa",
+  "ḓivha",
+  "20",
+  "Mishumo",
+  "khae",
+  "muhulu",
+  "nae",
+  "Mudzulatshidulo",
+  "bebwa",
+  "koni",
+  "muri",
+  "mutheo",
+  "nduni",
+  "takalela",
+  "tshivhalo",
+  "vhabebi",
+  "2014",
+  "bvaho",
+  "fhambana",
+  "iyo",
+  "mbili",
+  "shumisana",
+  "tanganedza",
+  "thikhedzo",
+  "thomiwa",
+  "tshigwada",
+  "vhavho",
+  "wanga",
+  "2.",
+  "Abrahamu",
+  "Zwino",
+  "afho",
+  "bvela",
+  "dzothe",
+  "fhela",
+  "henefho",
+  "khaedu",
+  "muvhili",
+  "rumela",
+  "swikela",
+  "vhudi",
+  "vhutshinyi",
+  "vhuḓi",
+  "yothe",
+  "Dzikhonani",
+  "Naho",
+  "Pfunzo",
+  "Yobo",
+  "alusa",
+  "hoyu",
+  "iwe",
+  "iṅwe",
+  "mvelele",
+  "sina",
+  "tshothe",
+  "Mme",
+  "Petro",
+  "Zwenezwo",
+  "aya",
+  "khwaṱhisedza",
+  "lavhelesa",
+  "mutakalo",
+  "ntswa",
+  "ofha",
+  "vhidzwa",
+  "vhune",
+  "Dzangano",
+  "mbilu",
+  "nwala",
+  "zwiimiswa",
+  "ṱavhanya",
+  "000",
+  "Ipfi",
+  "Khotsi",
+  "Murwa",
+  "Nne",
+  "Sankambe",
+  "ino",
+  "inwe",
+  "katelwa",
+  "mmbi",
+  "zwikhala",
+  "zwoṱhe",
+  "ṋea",
+  "AIDS",
+  "Egipita",
+  "Zwo",
+  "fulufulu",
+  "mukalaha",
+  "mutukana",
+  "namusi",
+  "nyimele",
+  "tandulula",
+  "tshone",
+  "vhari",
+  "wane",
+  "Mveledziso",
+  "Samuele",
+  "Yunivesithi",
+  "dzina",
+  "izwo",
+  "ku",
+  "livhuwa",
+  "manwe",
+  "musanda",
+  "nndu",
+  "nthihi",
+  "nḓisedzo",
+  "shandukisa",
+  "tshiimo",
+  "vhidza",
+  "zwinwe",
+  "Abramu",
+  "Paulo",
+  "dze",
+  "linganaho",
+  "malugana",
+  "mona",
+  "nyambedzano",
+  "sala",
+  "vhuvhili",
+  "1",
+  "Vhana",
+  "Vhanwe",
+  "Zwa",
+  "ayo",
+  "dakalo",
+  "idzi",
+  "miṱanu",
+  "ngauralo",
+  "zwavho",
+  "Vho-Tshikonelo",
+  "demokirasi",
+  "dzawe",
+  "fhungudza",
+  "khagala",
+  "le",
+  "lothe",
+  "madzangano",
+  "mahayani",
+  "minwe",
+  "mulanda",
+  "mulilo",
+  "ngafhi",
+  "rabela",
+  "tshoṱhe",
+  "tsireledzo",
+  "vhushaka",
+  "zwikolo",
+  "Mufumakadzi",
+  "Mukhethwa",
+  "Mutheo",
+  "afha",
+  "avha",
+  "henefha",
+  "hothe",
+  "huwelela",
+  "khonani",
+  "lingedza",
+  "lwe",
+  "matshilisano",
+  "mbiluni",
+  "mihumbulo",
+  "ndalukano",
+  "nwaha",
+  "shavha",
+  "sokou",
+  "tshipida",
+  "ḽiṅwe",
+  "3.",
+  "Kapa",
+  "Mafhungo",
+  "anga",
+  "ano",
+  "dzhenisa",
+  "havha",
+  "muvhilini",
+  "nnḓa",
+  "siani",
+  "thi",
+  "thungo",
+  "tshivhi",
+  "ubva",
+  "vhuthihi",
+  "Dzina",
+  "Limpopo",
+  "Muhasho",
+  "Tshivenda",
+  "Ya",
+  "dzoṱhe",
+  "fha",
+  "lune",
+  "maAfurika",
+  "ngayo",
+  "tsheo",
+  "vhafunziwa",
+  "vhanga",
+  "vhugudisi",
+  "ḓa",
+  "Daniele",
+  "Makhado",
+  "Munwe",
+  "Yakobo",
+  "beba",
+  "dzhele",
+  "fulufhedzisa",
+  "ite",
+  "kholomo",
+  "khwaṱhaho",
+  "madekwana",
+  "maga",
+  "mivhili",
+  "mulambo",
+  "muthannga",
+  "muvhala",
+  "ne",
+  "othe",
+  "pfesesa",
+  "thuso",
+  "tsireledza",
+  "uno",
+  "vhusiku",
+  "wau",
+  "ṱangana",
+  "ṱanganedza",
+  "Shango",
+  "Tshi",
+  "Yo",
+  "fhata",
+  "imela",
+  "inwi",
+  "maṅwe",
+  "mbilaelo",
+  "mvelelo",
+  "mvula",
+  "ngani",
+  "nḓowetshumo",
+  "sumbe",
+  "tswikelelo",
+  "vhubindudzi",
+  "vula",
+  "ḽine",
+  "ṋamusi",
+  "Ene",
+  "Lethabo",
+  "Simisoni",
+  "dzhango",
+  "dzhiela",
+  "khetheaho",
+  "khombo",
+  "khulu",
+  "riṋe",
+  "sumbedzisa",
+  "tendelana",
+  "tshithihi",
+  "zwashu",
+  "zwitshavha",
+  "ḓisa",
+  "Mulayo",
+  "Mushumo",
+  "Pandelani",
+  "Sisanda",
+  "fhala",
+  "fumi",
+  "lingana",
+  "luvha",
+  "manzhi",
+  "mbekanyamaitele",
+  "migodi",
+  "miṅwahani",
+  "muhumbulo",
+  "navho",
+  "nayo",
+  "nazwo",
+  "ngudo",
+  "thendelano",
+  "tshikoloni",
+  "vhaṅwe",
+  "Ḽifhasi",
+  "Elia",
+  "Genesi",
+  "Huno",
+  "Maria",
+  "Mu",
+  "Thukile",
+  "Vhunzhi",
+  "ambara",
+  "disa",
+  "fhelisa",
+  "lila",
+  "maswina",
+  "ranga",
+  "sea",
+  "takadza",
+  "thundu",
+  "tsela",
+  "tshiga",
+  "tshihulwane",
+  "tshumisano",
+  "vhahulwane",
+  "vhalanda",
+  "vhugevhenga",
+  "ḓivhadza",
+  "2010",
+  "Filista",
+  "Gidioni",
+  "Ntha",
+  "ambiwa",
+  "biḽioni",
+  "bvelelaho",
+  "dziṅwe",
+  "engedzea",
+  "fanaho",
+  "fulufhelo",
+  "hulisa",
+  "hunwe",
+  "itwaho",
+  "khumbelo",
+  "miri",
+  "mudzimu",
+  "muswa",
+  "nungo",
+  "oṱhe",
+  "sinyuwa",
+  "tshawe",
+  "vhulunga",
+  "vhuthu",
+  "vhuvhi",
+  "wone",
+  "yunivesithi",
+  "2",
+  "Lili",
+  "Linwe",
+  "Mandela",
+  "angaredza",
+  "dzulela",
+  "gonya",
+  "lufu",
+  "lugisela",
+  "lwashu",
+  "malofha",
+  "mato",
+  "mulaedza",
+  "muta",
+  "mutani",
+  "mutuku",
+  "nanga",
+  "phukha",
+  "tavhanya",
+  "tshilapfu",
+  "tshiṋoni",
+  "uvhu",
+  "vhadededzi",
+  "vharema",
+  "vhumba",
+  "vhuḓifhinduleli",
+  "ṱhoho",
+  "4.",
+  "Adamu",
+  "Elisa",
+  "Ndayotewa",
+  "Nehemia",
+  "Ngauri",
+  "Wa",
+  "Yerusalema",
+  "bveledzwa",
+  "de",
+  "divhi",
+  "dzhenelela",
+  "heli",
+  "huno",
+  "khetho",
+  "kwama",
+  "litsha",
+  "naka",
+  "ndala",
+  "tendela",
+  "thandululo",
+  "thoho",
+  "tshanda",
+  "vhudavhidzani",
+  "zwiambaro",
+  "zwikili",
+  "Ṱhonifheaho",
+  "1994",
+  "Afha",
+  "Connection",
+  "Content-Length",
+  "Hope",
+  "Mudzhou",
+  "bvisa",
+  "close",
+  "dzingu",
+  "farwa",
+  "fhululedza",
+  "fulo",
+  "haya",
+  "hwala",
+  "lindela",
+  "line",
+  "masia",
+  "mimasipala",
+  "mitambo",
+  "miṱa",
+  "musuku",
+  "ngaha",
+  "sedzulusa",
+  "tshidza",
+  "tshikhala",
+  "tshithavhelo",
+  "vhatukana",
+  "vhunzhi",
+  "yoṱhe",
+  "zwifuwo",
+  "zwiḽiwa",
+  "11",
+  "Bugu",
+  "Date",
+  "GMT",
+  "Mbali",
+  "Mbalo",
+  "Miraḓo",
+  "Mulaedza",
+  "Murahu",
+  "Musidzana",
+  "NET",
+  "Sep",
+  "Tshumelo",
+  "Tsumbo",
+  "Yushua",
+  "Zimkhitha",
+  "ashu",
+  "dzule",
+  "edela",
+  "khayo",
+  "khunyeledza",
+  "luga",
+  "mirole",
+  "mitshelo",
+  "mudini",
+  "ndaka",
+  "ngazwo",
+  "nwa",
+  "pfala",
+  "renga",
+  "sedzana",
+  "shumana",
+  "sialala",
+  "tshifhiwa",
+  "vhalaho",
+  "vhushai",
+  "vhuswa",
+  "vhutsila",
+  "ḓiimisela",
+  "ḓorobo",
+  "ḽoṱhe",
+  "2013",
+  "3",
+  "6",
+  "African",
+  "Khabinete",
+  "Matshaya",
+  "Sat",
+  "Tshitshavha",
+  "bveledzisa",
+  "dzangano",
+  "dzhiiwa",
+  "fhedzisela",
+  "heyi",
+  "itelwa",
+  "khavho",
+  "khetha",
+  "lawe",
+  "lwawe",
+  "mahoḽa",
+  "midzimu",
+  "milenzhe",
+  "misi",
+  "ngaho",
+  "shanduka",
+  "sisteme",
+  "sumba",
+  "thanda",
+  "tharu",
+  "thuse",
+  "vhagudiswa",
+  "vhofha",
+  "vhurotho",
+  "yeneyo",
+  "zwanda",
+  "zwihulu",
+  "zwiito",
+  "zwivhuya",
+  "zwiṱori",
+  "ṱuwa",
+  "12",
+  "Ikonomi",
+  "Kamuzu",
+  "Kanana",
+  "Ketti",
+  "Wo",
+  "Zimbabwe",
+  "dorobo",
+  "dzudzanya",
+  "fhiwa",
+  "funi",
+  "idzo",
+  "ili",
+  "iḽi",
+  "lavhelela",
+  "lihulu",
+  "lwendo",
+  "makhulu",
+  "matshilo",
+  "mihasho",
+  "mirado",
+  "mugudi",
+  "muthelo",
+  "muṱa",
+  "nyambo",
+  "nṱhesa",
+  "pembelela",
+  "phuraivethe",
+  "vhahali",
+  "vhege",
+  "vhuimo",
+  "vhulimi",
+  "Ṅwaha",
+  "2009",
+  "Fhedziha",
+  "Mateo",
+  "Ruthe",
+  "Vhanna",
+  "Yona",
+  "anetshela",
+  "dalela",
+  "dzitshaka",
+  "fhirisa",
+  "hafha",
+  "kanzhi",
+  "khethululo",
+  "khwinifhadza",
+  "kuvhanganya",
+  "lovha",
+  "mahosi",
+  "matshudeni",
+  "mavhili",
+  "mbuelo",
+  "mikhwa",
+  "muyani",
+  "ndaela",
+  "ngau",
+  "ono",
+  "rembuluwa",
+  "rwa",
+  "sathu",
+  "seli",
+  "shume",
+  "thavha",
+  "thavhani",
+  "tshashu",
+  "tshavho",
+  "tshilaho",
+  "tshina",
+  "tshinya",
+  "vhararu",
+  "vhavhi",
+  "vhidzelela",
+  "vhofholowa",
+  "vhofholowaho",
+  "vhulwadze",
+  "vhusa",
+  "vhutanzi",
+  "vhutolo",
+  "vhutshiloni",
+  "yaho",
+  "yanu",
+  "zwiga",
+  "ṅwana",
+  "ṅwedzi",
+  "ṋaṅwaha",
+  "ṋewa",
+  "ṱhoḓea",
+  "10",
+  "2012",
+  "6.",
+  "Huna",
+  "Lavhelesani",
+  "Master",
+  "Mune",
+};
+const uint16_t WA_FREQ_182_RANKS[] = {
+  172, 508, 565, 0, 0, 278, 523, 790, 0, 958, 245, 0, 0, 225, 980, 367,
+  0, 0, 0, 0, 0, 510, 0, 0, 866, 0, 89, 0, 0, 0, 440, 85,
+  0, 0, 935, 0, 542, 786, 0, 0, 0, 0, 0, 0, 0, 0, 555, 0,
+  655, 703, 478, 0, 0, 546, 427, 22, 0, 0, 0, 299, 0, 494, 20, 388,
+  771, 0, 0, 936, 951, 0, 448, 643, 749, 609, 0, 0, 789, 0, 0, 0,
+  126, 891, 0, 169, 964, 259, 0, 0, 66, 0, 345, 0, 0, 0, 0, 0,
+  0, 0, 481, 0, 188, 284, 0, 0, 140, 763, 0, 999, 0, 812, 0, 236,
+  0, 0, 0, 834, 0, 387, 378, 710, 706, 0, 0, 603, 0, 0, 854, 309,
+  450, 0, 105, 0, 507, 709, 761, 51, 325, 404, 173, 0, 680, 0, 0, 0,
+  0, 0, 604, 0, 833, 0, 0, 0, 183, 410, 938, 0, 0, 0, 0, 781,
+  226, 764, 0, 185, 912, 0, 0, 0, 99, 960, 0, 249, 770, 196, 0, 0,
+  0, 0, 0, 0, 0, 316, 849, 237, 513, 165, 0, 0, 463, 784, 0, 714,
+  469, 227, 0, 0, 990, 0, 0, 774, 0, 623, 0, 684, 389, 620, 686, 628,
+  769, 328, 181, 580, 672, 0, 0, 0, 0, 0, 637, 350, 0, 291, 877, 0,
+  0, 0, 423, 400, 492, 594, 925, 961, 995, 0, 0, 0, 0, 0, 0, 760,
+  0, 704, 797, 813, 0, 0, 289, 0, 0, 0, 7, 0, 0, 77, 0, 0,
+  0, 72, 161, 0, 0, 0, 212, 0, 0, 211, 745, 982, 313, 0, 923, 0,
+  0, 0, 292, 0, 502, 287, 343, 963, 0, 163, 0, 634, 37, 705, 942, 0,
+  234, 52, 0, 0, 0, 0, 0, 221, 0, 578, 560, 0, 311, 0, 170, 0,
+  187, 986, 0, 0, 0, 0, 0, 138, 809, 0, 0, 256, 11, 280, 0, 0,
+  981, 376, 0, 247, 0, 480, 519, 582, 391, 853, 0, 0, 0, 645, 773, 157,
+  191, 954, 0, 0, 0, 0, 486, 795, 0, 0, 0, 0, 363, 0, 438, 0,
+  0, 975, 0, 88, 726, 97, 503, 0, 0, 0, 253, 0, 0, 335, 455, 0,
+  0, 746, 0, 0, 0, 0, 0, 0, 0, 0, 892, 979, 293, 864, 0, 0,
+  0, 98, 0, 0, 82, 596, 652, 0, 0, 537, 762, 557, 607, 0, 8, 242,
+  0, 0, 0, 0, 380, 552, 0, 96, 267, 525, 133, 971, 0, 0, 605, 0,
+  0, 0, 0, 0, 0, 0, 359, 176, 113, 577, 0, 0, 174, 966, 0, 0,
+  0, 0, 0, 4, 826, 159, 288, 337, 428, 993, 12, 994, 0, 285, 783, 0,
+  0, 0, 699, 876, 0, 0, 708, 0, 659, 101, 124, 0, 616, 332, 669, 118,
+  600, 48, 693, 985, 697, 991, 0, 0, 0, 479, 0, 231, 330, 522, 724, 880,
+  0, 0, 775, 216, 497, 0, 0, 650, 851, 370, 0, 69, 638, 800, 0, 678,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 264, 636, 992, 0,
+  0, 162, 561, 0, 0, 0, 310, 0, 0, 0, 901, 0, 527, 0, 0, 0,
+  0, 433, 351, 0, 0, 134, 0, 0, 0, 902, 0, 0, 466, 0, 0, 601,
+  0, 76, 898, 0, 0, 0, 0, 0, 493, 39, 0, 0, 0, 222, 941, 0,
+  198, 0, 19, 0, 0, 566, 915, 641, 937, 0, 0, 142, 0, 0, 190, 831,
+  489, 0, 0, 614, 0, 490, 164, 366, 0, 0, 449, 443, 622, 728, 780, 70,
+  0, 0, 0, 0, 295, 0, 83, 0, 768, 804, 945, 908, 0, 0, 0, 0,
+  0, 811, 430, 874, 0, 0, 0, 349, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 302, 0, 204, 0, 0, 14, 110, 315, 485, 569,
+  365, 362, 589, 685, 719, 0, 0, 0, 0, 0, 0, 381, 115, 129, 667, 0,
+  514, 0, 0, 0, 0, 444, 0, 847, 0, 0, 535, 677, 564, 0, 0, 909,
+  0, 0, 10, 788, 3, 0, 0, 562, 0, 17, 0, 0, 0, 0, 0, 0,
+  0, 56, 0, 618, 696, 0, 0, 446, 0, 610, 0, 0, 0, 0, 373, 358,
+  0, 224, 153, 0, 396, 806, 458, 631, 0, 0, 0, 0, 252, 0, 0, 593,
+  681, 207, 0, 0, 150, 0, 498, 141, 482, 870, 893, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 943, 273, 792, 955, 529, 0, 107, 64, 0, 369, 630,
+  112, 456, 0, 53, 0, 0, 0, 0, 279, 539, 0, 0, 32, 297, 0, 63,
+  108, 592, 799, 0, 49, 239, 520, 0, 461, 732, 474, 932, 0, 776, 271, 842,
+  0, 0, 0, 0, 263, 0, 0, 0, 0, 729, 385, 717, 843, 526, 549, 735,
+  875, 15, 57, 900, 920, 517, 307, 688, 848, 0, 268, 536, 644, 0, 752, 748,
+  321, 250, 171, 233, 179, 399, 543, 394, 506, 695, 0, 0, 208, 500, 45, 416,
+  484, 559, 567, 740, 473, 715, 750, 817, 599, 823, 205, 0, 413, 530, 844, 0,
+  0, 0, 0, 0, 329, 707, 0, 230, 0, 303, 0, 743, 929, 974, 0, 730,
+  0, 346, 317, 0, 613, 839, 0, 0, 597, 0, 736, 103, 0, 0, 23, 269,
+  872, 0, 0, 390, 0, 0, 0, 177, 336, 0, 334, 0, 0, 0, 0, 189,
+  805, 801, 896, 624, 382, 0, 409, 0, 0, 0, 0, 0, 0, 417, 488, 0,
+  405, 0, 742, 220, 472, 633, 257, 940, 319, 0, 0, 442, 0, 0, 661, 0,
+  691, 0, 698, 0, 0, 767, 26, 144, 0, 0, 0, 534, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 149, 758, 721, 0, 0, 0, 0, 0, 0, 619, 62,
+  863, 0, 0, 0, 0, 0, 0, 459, 0, 828, 0, 29, 860, 917, 612, 0,
+  886, 0, 0, 0, 987, 393, 906, 0, 357, 852, 0, 238, 0, 74, 300, 274,
+  0, 0, 86, 145, 640, 0, 0, 139, 168, 0, 0, 419, 0, 868, 0, 0,
+  0, 0, 0, 0, 80, 0, 0, 996, 0, 412, 167, 304, 0, 0, 0, 0,
+  352, 368, 0, 765, 0, 0, 0, 192, 0, 0, 0, 0, 372, 0, 824, 727,
+  997, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 664, 0,
+  0, 965, 0, 0, 0, 0, 276, 272, 575, 0, 0, 0, 0, 13, 339, 41,
+  0, 401, 0, 0, 712, 0, 626, 186, 702, 930, 0, 102, 130, 0, 301, 0,
+  0, 491, 364, 579, 563, 949, 0, 0, 701, 265, 0, 0, 0, 0, 0, 143,
+  666, 0, 0, 90, 392, 397, 436, 471, 608, 907, 751, 973, 235, 989, 0, 0,
+  894, 0, 496, 0, 42, 35, 0, 137, 0, 0, 905, 0, 651, 210, 218, 635,
+  0, 0, 551, 258, 0, 0, 0, 0, 0, 0, 312, 375, 0, 54, 323, 175,
+  653, 983, 0, 516, 246, 122, 194, 384, 883, 0, 415, 0, 0, 499, 904, 0,
+  0, 0, 0, 778, 87, 464, 548, 408, 821, 0, 0, 214, 675, 777, 0, 0,
+  0, 0, 759, 785, 0, 0, 0, 0, 0, 420, 308, 0, 128, 0, 524, 306,
+  0, 0, 432, 972, 0, 0, 0, 0, 465, 470, 744, 356, 869, 0, 33, 0,
+  689, 978, 0, 766, 429, 123, 956, 0, 341, 654, 0, 554, 0, 0, 948, 835,
+  46, 0, 720, 646, 0, 116, 31, 55, 0, 0, 0, 0, 0, 262, 755, 0,
+  0, 615, 240, 595, 687, 407, 953, 0, 0, 0, 0, 0, 229, 0, 0, 0,
+  0, 2, 38, 445, 700, 477, 0, 0, 810, 0, 0, 0, 0, 658, 0, 0,
+  202, 879, 927, 0, 627, 0, 0, 0, 0, 0, 910, 545, 531, 0, 0, 348,
+  0, 0, 340, 109, 504, 738, 0, 0, 0, 656, 570, 0, 147, 215, 0, 0,
+  0, 0, 418, 0, 0, 0, 457, 0, 322, 739, 0, 855, 0, 0, 425, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 639, 798, 950, 0, 0, 933,
+  0, 856, 197, 621, 120, 713, 0, 0, 0, 0, 403, 0, 0, 0, 0, 117,
+  24, 347, 0, 0, 0, 583, 0, 95, 512, 0, 209, 377, 67, 511, 674, 741,
+  857, 807, 897, 0, 0, 0, 0, 0, 0, 0, 0, 0, 584, 0, 0, 0,
+  0, 0, 0, 0, 213, 0, 793, 0, 0, 483, 0, 0, 0, 0, 0, 0,
+  0, 0, 266, 0, 0, 625, 0, 0, 0, 0, 832, 0, 0, 0, 0, 532,
+  475, 0, 0, 0, 571, 611, 682, 725, 0, 818, 0, 0, 0, 528, 670, 344,
+  487, 841, 270, 885, 18, 0, 0, 0, 0, 0, 0, 988, 668, 0, 0, 586,
+  1, 632, 467, 0, 0, 0, 0, 926, 0, 0, 0, 0, 0, 911, 0, 217,
+  398, 0, 541, 158, 0, 683, 0, 254, 0, 286, 890, 244, 81, 837, 521, 617,
+  573, 665, 671, 756, 881, 0, 0, 0, 0, 0, 79, 0, 0, 495, 338, 0,
+  0, 326, 0, 802, 0, 0, 962, 0, 836, 232, 379, 803, 903, 816, 0, 0,
+  0, 969, 0, 156, 598, 193, 65, 838, 0, 0, 371, 0, 0, 422, 754, 0,
+  0, 556, 0, 0, 0, 0, 0, 0, 298, 787, 0, 327, 0, 275, 791, 587,
+  0, 260, 324, 692, 305, 0, 0, 0, 0, 0, 0, 0, 509, 952, 0, 0,
+  44, 219, 867, 591, 998, 331, 830, 0, 0, 0, 0, 0, 0, 970, 0, 281,
+  318, 0, 0, 0, 0, 406, 0, 0, 241, 200, 660, 91, 476, 0, 0, 0,
+  0, 195, 858, 0, 135, 747, 944, 553, 248, 572, 75, 0, 111, 0, 0, 314,
+  0, 820, 0, 0, 58, 452, 673, 0, 0, 261, 934, 0, 957, 431, 538, 694,
+  0, 201, 435, 928, 0, 434, 16, 0, 0, 104, 0, 779, 184, 0, 160, 0,
+  0, 547, 0, 92, 0, 0, 0, 9, 0, 0, 0, 0, 0, 533, 862, 946,
+  968, 976, 0, 0, 0, 0, 629, 0, 355, 827, 0, 0, 888, 0, 814, 353,
+  0, 0, 0, 0, 61, 0, 166, 0, 0, 0, 414, 294, 277, 93, 447, 228,
+  386, 850, 454, 918, 977, 0, 0, 0, 0, 0, 146, 0, 0, 84, 0, 0,
+  0, 0, 0, 0, 540, 0, 0, 550, 1000, 50, 0, 0, 967, 0, 0, 733,
+  873, 0, 0, 36, 0, 0, 0, 882, 0, 0, 0, 426, 0, 0, 590, 421,
+  0, 0, 871, 0, 0, 984, 0, 283, 453, 78, 722, 0, 0, 0, 0, 0,
+  846, 0, 0, 0, 676, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 662, 437, 0, 0, 0, 0, 0, 0, 0, 558, 884, 0, 0,
+  180, 840, 0, 0, 878, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 899, 27, 753, 203, 374, 0, 25, 47, 21, 125, 402, 581, 0,
+  0, 0, 243, 0, 59, 255, 576, 924, 0, 0, 568, 0, 939, 0, 0, 0,
+  0, 0, 60, 73, 501, 718, 0, 0, 0, 947, 0, 0, 931, 0, 282, 361,
+  290, 460, 711, 716, 28, 121, 439, 815, 861, 151, 71, 737, 889, 0, 796, 648,
+  0, 132, 0, 829, 0, 0, 0, 0, 360, 0, 914, 0, 0, 0, 505, 0,
+  0, 0, 0, 0, 0, 199, 342, 919, 0, 0, 588, 913, 0, 0, 0, 0,
+  0, 441, 822, 424, 0, 0, 0, 152, 819, 0, 34, 0, 127, 131, 178, 606,
+  94, 468, 515, 757, 859, 354, 865, 916, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 544, 182, 333, 0, 0, 0, 296, 808, 0, 0, 574, 0, 690, 0, 0,
+  663, 0, 0, 0, 772, 0, 0, 462, 0, 0, 0, 0, 794, 0, 0, 0,
+  0, 0, 0, 68, 154, 0, 0, 0, 320, 723, 0, 921, 251, 959, 0, 0,
+  0, 411, 0, 0, 0, 0, 585, 0, 0, 679, 887, 0, 0, 518, 649, 895,
+  0, 30, 114, 647, 395, 451, 119, 0, 106, 0, 0, 657, 0, 0, 0, 43,
+  136, 0, 0, 206, 734, 0, 922, 845, 0, 0, 0, 0, 0, 782, 0, 602,
+  642, 383, 0, 0, 0, 148, 223, 731, 825, 100, 0, 0, 0, 0, 40, 155,
+};
+
+const char *WA_FREQ_183_TOKENS[] = {
+  "el",
+  "i",
+  "sì",
+  "ze",
+  "dazighe",
+  "nostri",
+  "conpliminti",
+  "al",
+  "shef",
+  "pian",
+  "bianco",
+  "par",
+  "piazer",
+  "vegnarò",
+  "co",
+  "vialtri",
+  "sio",
+  "stae",
+  "inpegnae",
+  "in",
+  "sti",
+  "ùltemi",
+  "tenpi",
+  "noialtri",
+  "no",
+  "semo",
+  "boni",
+  "de",
+  "védar",
+  "na",
+  "steła",
+  "sta",
+  "note",
+  "tom",
+  "stravacà",
+  "sol",
+  "divan",
+  "che",
+  "drio",
+  "vardar",
+  "ła",
+  "tv",
+  "valtri",
+  "me",
+  "gavio",
+  "cronpà",
+  "calcosa",
+  "siòparo",
+  "ga",
+  "fazesto",
+  "problemi",
+  "a",
+  "l",
+  "economia",
+  "nasionałe",
+  "schei",
+  "justa",
+  "tuto",
+  "lo",
+  "gało",
+  "canbià",
+};
+const uint16_t WA_FREQ_183_RANKS[] = {
+  10, 18, 47, 35, 0, 8, 24, 37, 32, 55, 13, 0, 0, 0, 0, 12,
+  0, 0, 38, 0, 60, 9, 15, 36, 0, 31, 40, 28, 22, 0, 0, 6,
+  51, 56, 0, 14, 30, 44, 16, 7, 0, 0, 20, 0, 0, 0, 0, 23,
+  50, 59, 0, 26, 52, 11, 0, 0, 0, 0, 41, 54, 57, 0, 0, 0,
+  0, 0, 0, 0, 4, 61, 0, 0, 5, 0, 0, 0, 53, 45, 0, 0,
+  0, 3, 42, 0, 0, 19, 48, 0, 0, 43, 0, 0, 0, 0, 0, 0,
+  1, 0, 0, 29, 0, 0, 21, 33, 0, 0, 0, 0, 0, 17, 2, 34,
+  58, 0, 49, 0, 0, 39, 46, 0, 0, 0, 0, 0, 0, 0, 25, 27,
+};
+
+const char *WA_FREQ_184_TOKENS[] = {
+  "tôi",
+  "không",
+  "là",
+  "anh",
+  "có",
+  "ta",
+  "của",
+  "đi",
+  "đã",
+  "đó",
+  "sẽ",
+  "chúng",
+  "gì",
+  "một",
+  "được",
+  "và",
+  "cô",
+  "làm",
+  "phải",
+  "rồi",
+  "người",
+  "này",
+  "cho",
+  "em",
+  "đây",
+  "con",
+  "sao",
+  "biết",
+  "ông",
+  "nói",
+  "nó",
+  "thể",
+  "với",
+  "cậu",
+  "thế",
+  "lại",
+  "ra",
+  "vậy",
+  "để",
+  "nào",
+  "ấy",
+  "cái",
+  "đang",
+  "muốn",
+  "trong",
+  "mà",
+  "như",
+  "nhưng",
+  "khi",
+  "những",
+  "đến",
+  "đâu",
+  "chuyện",
+  "chỉ",
+  "cả",
+  "về",
+  "thì",
+  "họ",
+  "giờ",
+  "thôi",
+  "thấy",
+  "còn",
+  "cũng",
+  "vào",
+  "các",
+  "bị",
+  "nghĩ",
+  "đấy",
+  "ai",
+  "thật",
+  "hắn",
+  "nếu",
+  "mình",
+  "việc",
+  "nữa",
+  "rất",
+  "vì",
+  "cần",
+  "chứ",
+  "à",
+  "điều",
+  "sự",
+  "tới",
+  "xin",
+  "thứ",
+  "chưa",
+  "nhà",
+  "lên",
+  "đúng",
+  "từ",
+  "mẹ",
+  "nghe",
+  "hơn",
+  "mọi",
+  "bạn",
+  "tớ",
+  "nên",
+  "chết",
+  "mày",
+  "ơn",
+  "đầu",
+  "đừng",
+  "tìm",
+  "tốt",
+  "tin",
+  "hãy",
+  "quá",
+  "nhiều",
+  "trước",
+  "cảm",
+  "bà",
+  "ý",
+  "hay",
+  "công",
+  "nhất",
+  "tao",
+  "bố",
+  "tất",
+  "bao",
+  "trên",
+  "tên",
+  "lỗi",
+  "tại",
+  "thành",
+  "sau",
+  "cháu",
+  "ngày",
+  "khác",
+  "xem",
+  "theo",
+  "chắc",
+  "gặp",
+  "bắt",
+  "yêu",
+  "cứ",
+  "qua",
+  "vẫn",
+  "cùng",
+  "ngay",
+  "thích",
+  "cách",
+  "nhìn",
+  "sống",
+  "bọn",
+  "lúc",
+  "giết",
+  "mới",
+  "quan",
+  "chào",
+  "đưa",
+  "lắm",
+  "gọi",
+  "hết",
+  "bảo",
+  "hai",
+  "rằng",
+  "ăn",
+  "giúp",
+  "hiểu",
+  "lấy",
+  "ngài",
+  "tự",
+  "lần",
+  "chính",
+  "tay",
+  "nhân",
+  "cuộc",
+  "bỏ",
+  "năm",
+  "mất",
+  "hả",
+  "vụ",
+  "xe",
+  "ngươi",
+  "nhận",
+  "cha",
+  "chúa",
+  "khỏi",
+  "nay",
+  "định",
+  "tiền",
+  "thời",
+  "cơ",
+  "nhé",
+  "do",
+  "trở",
+  "bé",
+  "mặt",
+  "đường",
+  "vâng",
+  "gái",
+  "luôn",
+  "mấy",
+  "gia",
+  "nhau",
+  "lời",
+  "nơi",
+  "chị",
+  "xuống",
+  "bây",
+  "thưa",
+  "số",
+  "động",
+  "đồ",
+  "ngoài",
+  "toàn",
+  "bất",
+  "sát",
+  "thực",
+  "từng",
+  "phòng",
+  "thằng",
+  "kẻ",
+  "hàng",
+  "bằng",
+  "chẳng",
+  "chút",
+  "nhớ",
+  "chú",
+  "nhiên",
+  "lý",
+  "chỗ",
+  "học",
+  "nhanh",
+  "quay",
+  "sĩ",
+  "cố",
+  "tuyệt",
+  "lẽ",
+  "chiến",
+  "hỏi",
+  "đại",
+  "tiếp",
+  "tình",
+  "ơi",
+  "bên",
+  "đồng",
+  "vui",
+  "ổn",
+  "gian",
+  "tâm",
+  "cứu",
+  "đề",
+  "i",
+  "sinh",
+  "trả",
+  "bộ",
+  "đều",
+  "máy",
+  "vài",
+  "vị",
+  "nước",
+  "giống",
+  "đánh",
+  "xảy",
+  "chơi",
+  "trai",
+  "tối",
+  "cảnh",
+  "câu",
+  "kia",
+  "ko",
+  "giữ",
+  "hành",
+  "vô",
+  "kết",
+  "bởi",
+  "hiện",
+  "giới",
+  "vừa",
+  "tiếng",
+  "báo",
+  "tưởng",
+  "chờ",
+  "lo",
+  "đẹp",
+  "hôm",
+  "viên",
+  "hình",
+  "đáng",
+  "vấn",
+  "trọng",
+  "bình",
+  "đủ",
+  "oh",
+  "cám",
+  "lớn",
+  "sáng",
+  "bác",
+  "lâu",
+  "thần",
+  "sợ",
+  "biệt",
+  "thông",
+  "cổ",
+  "giải",
+  "phụ",
+  "thường",
+  "thương",
+  "vẻ",
+  "cuối",
+  "rõ",
+  "cửa",
+  "hợp",
+  "trung",
+  "bản",
+  "dùng",
+  "ôi",
+  "tra",
+  "bắn",
+  "cầu",
+  "ba",
+  "hội",
+  "t",
+  "đội",
+  "tiên",
+  "thân",
+  "chạy",
+  "thêm",
+  "đứa",
+  "thay",
+  "mang",
+  "quân",
+  "xác",
+  "đời",
+  "ngủ",
+  "trời",
+  "đổi",
+  "nhỏ",
+  "liên",
+  "tội",
+  "nghĩa",
+  "an",
+  "điện",
+  "dù",
+  "bay",
+  "nữ",
+  "vệ",
+  "phát",
+  "đối",
+  "c",
+  "đêm",
+  "trẻ",
+  "bệnh",
+  "gần",
+  "hoàn",
+  "trường",
+  "đợi",
+  "tính",
+  "nhỉ",
+  "đất",
+  "đứng",
+  "ngồi",
+  "trông",
+  "chiếc",
+  "n",
+  "xa",
+  "coi",
+  "chứng",
+  "ảnh",
+  "kể",
+  "khó",
+  "quyết",
+  "chịu",
+  "năng",
+  "tập",
+  "súng",
+  "vọng",
+  "giá",
+  "hoặc",
+  "sắp",
+  "xong",
+  "tử",
+  "đàn",
+  "sẵn",
+  "kiểm",
+  "mở",
+  "cao",
+  "uống",
+  "chuyển",
+  "dừng",
+  "ít",
+  "dưới",
+  "đình",
+  "chủ",
+  "chọn",
+  "điên",
+  "vật",
+  "thử",
+  "thống",
+  "kiếm",
+  "mắt",
+  "trưởng",
+  "kế",
+  "phần",
+  "biến",
+  "lòng",
+  "sư",
+  "loại",
+  "mạnh",
+  "thuốc",
+  "đấu",
+  "thức",
+  "dễ",
+  "vợ",
+  "dụng",
+  "y",
+  "trái",
+  "quái",
+  "phía",
+  "tiến",
+  "đau",
+  "yeah",
+  "điểm",
+  "lực",
+  "sai",
+  "ng",
+  "tệ",
+  "chắn",
+  "quả",
+  "khốn",
+  "sàng",
+  "quên",
+  "là",
+  "phút",
+  "minh",
+  "gã",
+  "mừng",
+  "kỳ",
+  "hơi",
+  "a",
+  "chân",
+  "kinh",
+  "tuần",
+  "có",
+  "mua",
+  "thủ",
+  "đặc",
+  "may",
+  "duy",
+  "trí",
+  "tàu",
+  "sức",
+  "trò",
+  "quyền",
+  "kìa",
+  "mỗi",
+  "quý",
+  "phố",
+  "buổi",
+  "thư",
+  "hạ",
+  "bài",
+  "đặt",
+  "tháng",
+  "hôn",
+  "mai",
+  "tài",
+  "diễn",
+  "to",
+  "the",
+  "phép",
+  "nổi",
+  "pháp",
+  "khách",
+  "đôi",
+  "hiệu",
+  "mặc",
+  "vũ",
+  "yên",
+  "quốc",
+  "máu",
+  "hệ",
+  "đơn",
+  "khí",
+  "khiến",
+  "phá",
+  "tục",
+  "thú",
+  "tuổi",
+  "dân",
+  "chuẩn",
+  "tạo",
+  "cá",
+  "luật",
+  "dẫn",
+  "phục",
+  "m",
+  "nhiêu",
+  "mau",
+  "hiểm",
+  "bàn",
+  "hoàng",
+  "độ",
+  "mạng",
+  "sách",
+  "chó",
+  "tiêu",
+  "ư",
+  "phạm",
+  "chúc",
+  "nhiệm",
+  "thoại",
+  "tinh",
+  "tránh",
+  "gây",
+  "thúc",
+  "khu",
+  "danh",
+  "tranh",
+  "ổng",
+  "thắng",
+  "cây",
+  "xấu",
+  "you",
+  "xuất",
+  "áo",
+  "s",
+  "sếp",
+  "hy",
+  "tiệt",
+  "chí",
+  "cấp",
+  "giả",
+  "xử",
+  "tấn",
+  "mật",
+  "thiết",
+  "khá",
+  "liệu",
+  "địa",
+  "lạc",
+  "bán",
+  "trình",
+  "tượng",
+  "thoát",
+  "tạm",
+  "ngon",
+  "đoán",
+  "thiên",
+  "giáo",
+  "mời",
+  "rời",
+  "thanh",
+  "okay",
+  "dự",
+  "chàng",
+  "lệnh",
+  "l",
+  "hứa",
+  "nằm",
+  "sớm",
+  "hey",
+  "dối",
+  "dịch",
+  "viết",
+  "hoạch",
+  "vời",
+  "giữa",
+  "ma",
+  "bóng",
+  "hộ",
+  "nghỉ",
+  "sử",
+  "nạn",
+  "hại",
+  "căn",
+  "tim",
+  "nguy",
+  "hồ",
+  "dậy",
+  "băng",
+  "mục",
+  "phim",
+  "giỏi",
+  "viện",
+  "hướng",
+  "tế",
+  "tĩnh",
+  "thuật",
+  "nhóc",
+  "đọc",
+  "kiểu",
+  "trị",
+  "phản",
+  "giao",
+  "tù",
+  "rối",
+  "trốn",
+  "rượu",
+  "đá",
+  "bước",
+  "dấu",
+  "ngu",
+  "đức",
+  "cười",
+  "tư",
+  "cánh",
+  "vòng",
+  "mỹ",
+  "hoa",
+  "lập",
+  "lạ",
+  "tổng",
+  "ban",
+  "đóng",
+  "tác",
+  "hề",
+  "lượng",
+  "tụi",
+  "càng",
+  "thận",
+  "di",
+  "bánh",
+  "da",
+  "ngốc",
+  "án",
+  "đám",
+  "tham",
+  "tức",
+  "văn",
+  "mong",
+  "già",
+  "nghiệp",
+  "thuyền",
+  "bí",
+  "trang",
+  "nè",
+  "lũ",
+  "hồi",
+  "độc",
+  "hạnh",
+  "khỏe",
+  "hẹn",
+  "gửi",
+  "đùa",
+  "trừ",
+  "cáo",
+  "khoảng",
+  "nhảy",
+  "giác",
+  "thầy",
+  "đầy",
+  "khoan",
+  "món",
+  "khả",
+  "phi",
+  "nghiệm",
+  "hóa",
+  "cẩn",
+  "suy",
+  "đông",
+  "suốt",
+  "vua",
+  "kéo",
+  "chồng",
+  "thất",
+  "đô",
+  "nhật",
+  "nghi",
+  "khủng",
+  "tiếc",
+  "dành",
+  "thị",
+  "lái",
+  "tương",
+  "bữa",
+  "của",
+  "chả",
+  "kiếp",
+  "trận",
+  "im",
+  "bức",
+  "mãi",
+  "triệu",
+  "quanh",
+  "màu",
+  "buồn",
+  "chúng",
+  "đã",
+  "riêng",
+  "biển",
+  "nàng",
+  "dài",
+  "đỡ",
+  "sơ",
+  "ngờ",
+  "nổ",
+  "đạo",
+  "đem",
+  "linh",
+  "chức",
+  "chất",
+  "thẳng",
+  "chống",
+  "mơ",
+  "tổ",
+  "hoạt",
+  "gì",
+  "mắn",
+  "lịch",
+  "gắng",
+  "quen",
+  "chừng",
+  "thù",
+  "đó",
+  "sẽ",
+  "khóa",
+  "được",
+  "đuổi",
+  "nguyên",
+  "cầm",
+  "thuộc",
+  "lửa",
+  "uh",
+  "lính",
+  "ghét",
+  "dạy",
+  "ngăn",
+  "kiến",
+  "thả",
+  "thu",
+  "thiếu",
+  "ngôi",
+  "lợi",
+  "nam",
+  "chia",
+  "cắt",
+  "dây",
+  "lắng",
+  "thậm",
+  "sở",
+  "nhập",
+  "trách",
+  "ghi",
+  "đen",
+  "lão",
+  "cưới",
+  "hẳn",
+  "ly",
+  "âm",
+  "nghị",
+  "ngựa",
+  "binh",
+  "cũ",
+  "vàng",
+  "phân",
+  "hủy",
+  "phương",
+  "v",
+  "trợ",
+  "ngoại",
+  "tây",
+  "tòa",
+  "tai",
+  "truyền",
+  "đạn",
+  "kì",
+  "ký",
+  "nghiêm",
+  "tá",
+  "vết",
+  "nhắc",
+  "đảm",
+  "tiệc",
+  "dám",
+  "la",
+  "ok",
+  "quần",
+  "mối",
+  "chấp",
+  "phiền",
+  "th",
+  "và",
+  "đổ",
+  "lựa",
+  "ràng",
+  "nửa",
+  "lầm",
+  "chung",
+  "chế",
+  "ước",
+  "chi",
+  "một",
+  "cướp",
+  "hi",
+  "john",
+  "nhờ",
+  "rồi",
+  "này",
+  "bại",
+  "quỷ",
+  "huy",
+  "ch",
+  "đằng",
+  "tiểu",
+  "hát",
+  "cử",
+  "ca",
+  "cưng",
+  "mã",
+  "chuyến",
+  "thi",
+  "khăn",
+  "làm",
+  "phải",
+  "lễ",
+  "lai",
+  "vượt",
+  "lối",
+  "thuyết",
+  "tha",
+  "nóng",
+  "vùng",
+  "phúc",
+  "giấy",
+  "tích",
+  "người",
+  "thái",
+  "nhạc",
+  "tận",
+  "rắc",
+  "u",
+  "buộc",
+  "xét",
+  "kích",
+  "đoàn",
+  "tiết",
+  "thịt",
+  "tóc",
+  "trắng",
+  "thuận",
+  "phù",
+  "rơi",
+  "chăm",
+  "lạnh",
+  "cực",
+  "nhóm",
+  "kim",
+  "b",
+  "tỉnh",
+  "cộng",
+  "mái",
+  "ty",
+  "cung",
+  "săn",
+  "cuốn",
+  "tướng",
+  "dữ",
+  "giận",
+  "thượng",
+  "miệng",
+  "soát",
+  "sản",
+  "tăng",
+  "ứng",
+  "bắc",
+  "vi",
+  "trộm",
+  "phí",
+  "sửa",
+  "lệ",
+  "cà",
+  "lừa",
+  "mức",
+  "túi",
+  "thánh",
+  "đỏ",
+  "giây",
+  "hưởng",
+  "yếu",
+  "dõi",
+  "and",
+  "ích",
+  "trại",
+  "cơn",
+  "khai",
+  "sâu",
+  "vương",
+  "thở",
+  "jack",
+  "tí",
+  "ah",
+  "diện",
+  "hồn",
+  "hầu",
+  "đảo",
+  "tín",
+  "xúc",
+  "nỗi",
+  "phủ",
+  "biểu",
+  "hòa",
+  "loạn",
+  "nặng",
+  "tấm",
+  "lớp",
+  "bom",
+  "nh",
+  "chuyên",
+  "ác",
+  "bận",
+  "huynh",
+  "dĩ",
+  "chương",
+  "lí",
+  "chữa",
+  "lãnh",
+  "đột",
+  "kính",
+  "rút",
+  "phóng",
+  "ở",
+  "thỏa",
+  "khỉ",
+  "á",
+  "lộ",
+  "cạnh",
+  "kỹ",
+  "hậu",
+  "hùng",
+  "sang",
+  "thề",
+  "đoạn",
+  "sóc",
+  "khẩu",
+  "luyện",
+  "thăm",
+  "giản",
+  "sạch",
+  "frank",
+  "chim",
+  "xếp",
+  "nha",
+  "quán",
+  "mùi",
+  "nó",
+  "ánh",
+  "đón",
+  "biết",
+  "lá",
+  "tồi",
+  "phong",
+  "ngạc",
+  "giấu",
+  "thủy",
+  "quản",
+  "thuê",
+  "lành",
+  "tôn",
+  "tường",
+  "hỏng",
+  "thể",
+  "não",
+  "new",
+  "tầm",
+  "ê",
+  "vực",
+  "vậy",
+  "loài",
+  "hộp",
+  "xanh",
+  "tắm",
+  "tắt",
+  "ngừng",
+  "siêu",
+  "dọn",
+  "nhắn",
+  "ấn",
+  "thừa",
+  "ô",
+  "nguyện",
+  "dựng",
+  "sân",
+  "nói",
+  "thế",
+  "nợ",
+  "lặng",
+  "nội",
+  "mùa",
+  "it",
+  "đập",
+  "diệt",
+  "chà",
+  "tầng",
+  "hạn",
+  "kiện",
+  "mắc",
+  "trực",
+  "đài",
+  "muộn",
+  "bạc",
+  "sót",
+  "lưu",
+  "can",
+  "quà",
+  "say",
+  "đống",
+  "khắp",
+  "hút",
+};
+const uint16_t WA_FREQ_184_RANKS[] = {
+  648, 0, 0, 0, 0, 279, 711, 514, 0, 0, 0, 0, 0, 903, 203, 897,
+  957, 0, 0, 994, 734, 0, 205, 979, 0, 630, 118, 642, 968, 586, 755, 54,
+  176, 0, 902, 0, 0, 0, 0, 0, 172, 0, 434, 0, 0, 167, 927, 943,
+  0, 0, 0, 0, 243, 0, 0, 643, 839, 833, 563, 842, 871, 681, 905, 0,
+  381, 1000, 0, 91, 0, 0, 644, 0, 0, 0, 70, 87, 400, 672, 0, 379,
+  0, 0, 0, 633, 974, 0, 345, 607, 637, 764, 193, 250, 862, 0, 0, 0,
+  0, 0, 0, 144, 238, 695, 824, 848, 959, 0, 0, 323, 954, 105, 0, 0,
+  0, 0, 745, 0, 157, 0, 603, 284, 439, 0, 559, 668, 0, 75, 7, 329,
+  364, 256, 698, 0, 0, 0, 26, 301, 437, 593, 762, 802, 539, 552, 583, 656,
+  786, 0, 0, 0, 494, 0, 964, 618, 0, 38, 0, 0, 304, 233, 684, 914,
+  692, 165, 0, 502, 696, 808, 60, 202, 0, 0, 0, 458, 307, 619, 0, 0,
+  679, 230, 542, 561, 733, 896, 510, 989, 0, 71, 709, 35, 759, 884, 909, 922,
+  0, 958, 0, 0, 0, 0, 0, 0, 0, 0, 0, 614, 281, 347, 940, 424,
+  0, 0, 0, 412, 394, 440, 866, 787, 0, 93, 951, 0, 67, 0, 90, 545,
+  831, 911, 0, 390, 0, 297, 0, 0, 0, 855, 16, 0, 0, 0, 0, 0,
+  0, 282, 522, 521, 564, 631, 170, 0, 948, 338, 31, 556, 890, 937, 0, 0,
+  0, 0, 310, 0, 79, 0, 29, 0, 0, 0, 0, 0, 163, 0, 0, 0,
+  459, 0, 0, 0, 0, 0, 399, 0, 0, 0, 0, 0, 0, 0, 536, 0,
+  0, 0, 229, 0, 46, 620, 0, 0, 0, 0, 359, 483, 550, 499, 0, 0,
+  0, 218, 169, 220, 5, 305, 397, 66, 683, 0, 729, 272, 0, 42, 198, 415,
+  325, 247, 419, 900, 825, 0, 0, 590, 349, 0, 0, 195, 868, 302, 925, 0,
+  0, 32, 263, 408, 119, 0, 0, 0, 388, 0, 894, 0, 0, 0, 0, 96,
+  0, 395, 0, 20, 720, 730, 52, 467, 432, 49, 0, 0, 0, 0, 0, 0,
+  505, 4, 722, 135, 0, 0, 910, 0, 0, 0, 0, 571, 847, 154, 0, 0,
+  776, 0, 0, 575, 0, 0, 149, 0, 0, 0, 0, 737, 330, 0, 133, 601,
+  609, 482, 779, 468, 0, 0, 0, 0, 0, 254, 0, 0, 0, 0, 398, 628,
+  0, 0, 0, 369, 678, 838, 0, 72, 0, 68, 0, 0, 115, 0, 0, 996,
+  889, 566, 508, 431, 0, 0, 771, 651, 0, 0, 0, 557, 916, 741, 300, 0,
+  0, 155, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 775, 384, 650,
+  742, 0, 0, 0, 0, 0, 160, 0, 0, 444, 0, 43, 0, 173, 829, 0,
+  0, 0, 0, 0, 770, 0, 0, 0, 0, 0, 201, 481, 0, 0, 223, 519,
+  0, 81, 393, 21, 717, 869, 331, 0, 461, 995, 0, 0, 960, 930, 0, 0,
+  0, 963, 0, 456, 0, 0, 0, 0, 236, 0, 25, 0, 0, 0, 0, 174,
+  235, 0, 0, 0, 953, 268, 0, 58, 298, 0, 0, 332, 887, 0, 0, 0,
+  0, 0, 0, 327, 0, 0, 361, 0, 0, 0, 0, 0, 0, 0, 186, 320,
+  758, 0, 840, 0, 0, 0, 0, 0, 0, 0, 0, 270, 611, 659, 0, 0,
+  0, 0, 0, 626, 0, 0, 565, 0, 217, 780, 107, 0, 898, 487, 689, 245,
+  356, 277, 258, 0, 111, 469, 0, 0, 0, 0, 166, 0, 0, 0, 0, 0,
+  0, 0, 769, 0, 473, 0, 0, 0, 0, 784, 0, 0, 768, 0, 0, 920,
+  0, 986, 0, 0, 0, 472, 0, 932, 525, 782, 0, 164, 274, 248, 0, 0,
+  464, 0, 0, 228, 378, 246, 0, 946, 0, 0, 0, 0, 0, 0, 85, 0,
+  148, 0, 0, 0, 0, 0, 283, 703, 0, 207, 661, 89, 0, 226, 0, 126,
+  0, 114, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 765, 0, 861, 0,
+  0, 130, 204, 843, 864, 0, 0, 811, 454, 190, 386, 851, 687, 0, 0, 151,
+  86, 627, 221, 288, 0, 0, 0, 219, 0, 503, 315, 532, 895, 0, 0, 0,
+  849, 0, 757, 0, 0, 479, 667, 0, 0, 178, 606, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 486, 269, 0, 988, 336, 137, 818, 878, 131, 0, 210, 466,
+  490, 732, 0, 675, 0, 0, 0, 807, 0, 0, 0, 0, 125, 0, 0, 37,
+  477, 570, 753, 0, 182, 0, 0, 0, 358, 0, 317, 971, 0, 47, 0, 534,
+  0, 0, 402, 597, 216, 224, 95, 0, 0, 396, 990, 0, 0, 0, 406, 0,
+  371, 613, 798, 0, 608, 309, 576, 587, 783, 45, 0, 0, 306, 691, 699, 921,
+  744, 275, 529, 414, 122, 40, 0, 0, 88, 0, 0, 232, 0, 156, 99, 0,
+  0, 826, 0, 680, 0, 0, 0, 0, 0, 0, 874, 8, 237, 65, 858, 0,
+  0, 0, 0, 0, 0, 0, 443, 108, 227, 280, 342, 589, 969, 793, 0, 0,
+  0, 0, 285, 0, 0, 538, 0, 690, 991, 0, 778, 0, 0, 0, 244, 975,
+  0, 0, 0, 0, 0, 0, 266, 433, 0, 0, 470, 265, 0, 621, 0, 0,
+  0, 92, 562, 706, 674, 181, 735, 0, 0, 0, 0, 0, 206, 370, 463, 918,
+  531, 0, 749, 0, 333, 0, 259, 83, 0, 0, 0, 0, 0, 0, 0, 0,
+  82, 0, 0, 0, 231, 0, 392, 0, 0, 123, 0, 0, 0, 0, 497, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 260, 162, 373, 493, 112, 665, 766,
+  584, 0, 789, 0, 0, 0, 0, 484, 180, 816, 18, 912, 0, 253, 13, 445,
+  471, 0, 622, 0, 146, 664, 671, 926, 0, 0, 0, 882, 845, 478, 0, 788,
+  474, 0, 6, 36, 0, 0, 0, 264, 153, 0, 0, 0, 0, 639, 976, 0,
+  405, 0, 0, 0, 0, 0, 796, 997, 0, 9, 116, 0, 0, 645, 0, 0,
+  457, 0, 39, 120, 335, 0, 0, 0, 367, 143, 0, 553, 316, 761, 520, 0,
+  512, 0, 511, 0, 57, 0, 835, 0, 0, 209, 518, 0, 145, 0, 140, 448,
+  822, 853, 314, 569, 0, 53, 0, 673, 0, 640, 0, 377, 591, 748, 0, 0,
+  0, 475, 0, 0, 785, 0, 899, 0, 0, 0, 870, 0, 98, 0, 78, 403,
+  50, 977, 980, 372, 0, 0, 708, 740, 950, 0, 0, 0, 0, 340, 774, 844,
+  0, 0, 0, 0, 0, 526, 700, 0, 747, 595, 0, 0, 0, 0, 0, 0,
+  353, 885, 0, 0, 0, 0, 0, 0, 0, 0, 533, 0, 984, 693, 719, 0,
+  0, 0, 30, 127, 303, 677, 51, 0, 0, 287, 416, 773, 0, 0, 0, 814,
+  33, 366, 652, 883, 80, 255, 999, 0, 0, 0, 949, 660, 0, 249, 0, 0,
+  0, 418, 427, 0, 641, 792, 857, 0, 0, 0, 12, 0, 865, 0, 0, 906,
+  574, 189, 594, 877, 0, 0, 0, 0, 0, 0, 429, 0, 0, 714, 0, 0,
+  187, 225, 465, 1, 430, 551, 599, 554, 128, 407, 879, 0, 168, 654, 0, 0,
+  161, 852, 0, 0, 251, 150, 794, 425, 0, 0, 0, 987, 0, 0, 0, 0,
+  0, 142, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 124, 0,
+  981, 0, 0, 0, 0, 450, 0, 573, 0, 476, 891, 0, 0, 0, 528, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 535, 0, 0, 100, 560, 750, 598, 273,
+  726, 0, 731, 62, 0, 0, 967, 175, 0, 0, 955, 0, 139, 0, 222, 0,
+  0, 0, 0, 500, 907, 0, 0, 97, 0, 0, 746, 0, 0, 666, 939, 455,
+  0, 688, 934, 936, 0, 0, 0, 295, 339, 543, 663, 357, 0, 978, 0, 0,
+  0, 0, 138, 647, 0, 0, 636, 0, 0, 410, 0, 382, 0, 0, 0, 0,
+  0, 0, 0, 0, 682, 0, 0, 806, 0, 442, 572, 436, 0, 0, 0, 579,
+  0, 0, 0, 0, 0, 0, 707, 540, 617, 14, 938, 944, 0, 0, 0, 286,
+  0, 0, 0, 350, 0, 199, 387, 0, 56, 585, 0, 0, 438, 492, 781, 933,
+  0, 84, 0, 0, 0, 724, 11, 739, 772, 817, 64, 241, 159, 0, 0, 0,
+  662, 0, 147, 355, 544, 819, 942, 0, 961, 727, 0, 0, 0, 0, 360, 0,
+  820, 0, 0, 0, 0, 312, 0, 0, 712, 0, 915, 106, 103, 158, 276, 555,
+  453, 800, 805, 488, 421, 318, 524, 760, 935, 0, 0, 0, 322, 0, 351, 799,
+  653, 823, 547, 832, 0, 970, 213, 827, 541, 391, 0, 0, 0, 581, 941, 152,
+  0, 0, 0, 0, 0, 354, 101, 188, 582, 194, 0, 0, 872, 0, 0, 0,
+  0, 0, 0, 401, 0, 973, 278, 0, 0, 0, 0, 0, 0, 346, 676, 0,
+  76, 319, 0, 0, 0, 893, 0, 0, 0, 0, 74, 28, 129, 326, 507, 537,
+  605, 0, 0, 0, 0, 0, 0, 271, 422, 795, 0, 59, 841, 0, 588, 0,
+  0, 0, 257, 0, 924, 179, 262, 0, 0, 15, 334, 44, 0, 200, 0, 389,
+  892, 515, 0, 94, 41, 0, 0, 383, 23, 0, 0, 0, 0, 0, 294, 48,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 815, 0,
+  0, 0, 602, 860, 0, 813, 0, 506, 596, 109, 846, 548, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 966, 0, 0, 0, 0, 380, 192, 428, 10,
+  0, 592, 0, 0, 632, 0, 0, 0, 0, 121, 191, 240, 0, 0, 0, 0,
+  0, 0, 854, 0, 489, 962, 208, 947, 0, 441, 214, 0, 0, 324, 375, 634,
+  311, 501, 485, 791, 385, 0, 452, 972, 504, 113, 0, 725, 917, 63, 61, 435,
+  928, 956, 0, 888, 495, 836, 0, 901, 777, 790, 797, 0, 0, 801, 0, 0,
+  929, 0, 0, 0, 0, 0, 0, 0, 0, 736, 0, 0, 0, 0, 0, 0,
+  657, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 313, 604, 568, 694,
+  876, 0, 0, 908, 0, 0, 686, 0, 0, 0, 0, 141, 267, 292, 509, 886,
+  296, 2, 516, 752, 923, 0, 0, 0, 0, 0, 0, 460, 530, 34, 803, 136,
+  0, 600, 0, 0, 171, 837, 0, 27, 447, 0, 0, 413, 625, 308, 0, 513,
+  0, 0, 738, 0, 376, 411, 449, 558, 177, 646, 710, 0, 0, 24, 134, 743,
+  0, 0, 0, 0, 0, 0, 830, 0, 69, 998, 527, 0, 828, 0, 299, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 261, 873, 875, 0, 0, 0, 0, 697,
+  0, 0, 343, 0, 0, 0, 0, 705, 0, 670, 880, 0, 184, 352, 756, 0,
+  0, 0, 0, 577, 0, 480, 0, 0, 0, 0, 982, 0, 809, 110, 496, 754,
+  834, 856, 931, 0, 0, 0, 0, 0, 0, 0, 863, 716, 751, 945, 0, 881,
+  859, 0, 993, 655, 0, 0, 0, 0, 0, 0, 658, 0, 549, 0, 365, 669,
+  0, 0, 0, 0, 0, 239, 252, 337, 635, 810, 423, 0, 685, 0, 348, 0,
+  728, 0, 0, 0, 0, 0, 0, 491, 0, 0, 0, 0, 0, 0, 715, 293,
+  0, 0, 0, 0, 0, 242, 629, 983, 0, 0, 767, 0, 73, 615, 0, 913,
+  0, 567, 215, 420, 623, 417, 446, 19, 704, 919, 0, 0, 0, 0, 0, 0,
+  498, 341, 374, 616, 992, 0, 132, 850, 0, 612, 404, 713, 0, 0, 0, 211,
+  344, 723, 965, 291, 763, 290, 0, 0, 0, 0, 102, 77, 197, 517, 0, 22,
+  0, 0, 721, 985, 546, 638, 578, 867, 523, 0, 0, 0, 321, 0, 212, 426,
+  196, 368, 0, 0, 363, 0, 117, 702, 0, 0, 0, 0, 0, 624, 0, 409,
+  451, 185, 649, 821, 462, 0, 0, 3, 0, 0, 0, 0, 0, 580, 610, 0,
+  0, 55, 804, 0, 0, 0, 0, 0, 0, 0, 328, 0, 104, 718, 0, 0,
+  234, 0, 904, 701, 289, 0, 812, 0, 0, 0, 0, 952, 362, 183, 0, 0,
+};
+
+const char *WA_FREQ_185_TOKENS[] = {
+  "tomas",
+  "no",
+  "binom",
+  "etosi",
+  "nolob",
+  "kiöp",
+  "mon",
+  "et",
+  "ekömom",
+  "al",
+  "yufön",
+  "obes",
+  "el",
+  "tom",
+  "nelabom",
+  "kuradi",
+  "äklödom",
+  "obe",
+  "äbinom",
+  "flen",
+  "fiedik",
+  "änolob",
+  "das",
+  "nedom",
+  "dunön",
+  "ko",
+  "obs",
+  "nu",
+  "id",
+  "ob",
+  "logob",
+  "egegivofs",
+  "oni",
+  "bakan",
+  "binon",
+  "bäldik",
+  "buk",
+  "olik",
+  "is",
+};
+const uint16_t WA_FREQ_185_RANKS[] = {
+  8, 19, 0, 0, 0, 10, 26, 0, 0, 0, 0, 0, 0, 1, 20, 0,
+  21, 34, 0, 0, 0, 0, 23, 0, 25, 0, 0, 32, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 17, 0, 12, 0, 7, 0,
+  0, 0, 0, 11, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0,
+  0, 3, 36, 15, 0, 0, 33, 0, 0, 0, 0, 0, 18, 0, 0, 0,
+  0, 24, 27, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 35, 0,
+  13, 0, 28, 22, 0, 39, 0, 37, 38, 0, 0, 0, 0, 0, 9, 14,
+  0, 0, 0, 30, 0, 0, 0, 29, 0, 0, 0, 0, 0, 16, 2, 31,
+};
+
+const char *WA_FREQ_186_TOKENS[] = {
+  "ci",
+  "yi",
+  "ak",
+  "ko",
+  "bi",
+  "yu",
+  "di",
+  "na",
+  "bu",
+  "la",
+  "a",
+  "mu",
+  "ñu",
+  "gi",
+  "ca",
+  "ne",
+  "gu",
+  "ba",
+  "ay",
+  "lu",
+  "am",
+  "te",
+  "moo",
+  "woon",
+  "mooy",
+  "leen",
+  "mi",
+  "ngir",
+  "li",
+  "nag",
+  "moom",
+  "nga",
+  "nekk",
+  "mujj",
+  "Ci",
+  "ngi",
+  "ñeel",
+  "seen",
+  "xam",
+  "lay",
+  "ñi",
+  "def",
+  "ab",
+  "ag",
+  "fa",
+  "wii",
+  "wax",
+  "xët",
+  "jagleel",
+  "doon",
+  "man",
+  "won",
+  "ku",
+  "coppite",
+  "ni",
+  "xëtu",
+  "Wii",
+  "Coppite",
+  "lëkkalook",
+  "nu",
+  "nañu",
+  "gën",
+  "it",
+  "nit",
+  "ji",
+  "réew",
+  "walla",
+  "wi",
+  "benn",
+  "Yàlla",
+  "bari",
+  "koy",
+  "ma",
+  "ñoom",
+  "daa",
+  "muy",
+  "loolu",
+  "mag",
+  "xam-xam",
+  "ndax",
+  "dëkk",
+  "ya",
+  "bokk",
+  "wu",
+  "rekk",
+  "tax",
+  "Senegaal",
+  "du",
+  "ju",
+  "atum",
+  "fi",
+  "ñuy",
+  "waa",
+  "njëkk",
+  "ñoo",
+  "lañu",
+  "Tugal",
+  "yii",
+  "mbëj",
+  "nanu",
+  "daal",
+  "jamono",
+  "waaye",
+  "Afrig",
+  "diggante",
+  "bii",
+  "nekkoon",
+  "ciy",
+  "at",
+  "àdduna",
+  "ga",
+  "ñaari",
+  "war",
+  "biir",
+  "amoon",
+  "sax",
+  "sa",
+  "de",
+  "mel",
+  "Bu",
+  "gis",
+  "dul",
+  "yooyu",
+  "seeni",
+  "ëpp",
+  "dem",
+  "itam",
+  "si",
+  "koo",
+  "Almaañ",
+  "yeneen",
+  "naa",
+  "xare",
+  "yoon",
+  "baax",
+  "ki",
+  "nguur",
+  "noonu",
+  "jullit",
+  "su",
+  "dafa",
+  "kenn",
+  "jëm",
+  "boroom",
+  "daan",
+  "day",
+  "mbaa",
+  "suuf",
+  "reew",
+  "aki",
+  "làkk",
+  "jëfandikoo",
+  "da",
+  "sunu",
+  "loxo",
+  "Mu",
+  "solo",
+  "teg",
+  "Li",
+  "aw",
+  "defee",
+  "boobu",
+  "anam",
+  "xeex",
+  "cig",
+  "doole",
+  "diine",
+  "Fraans",
+  "Sëriñ",
+  "yépp",
+  "Itaali",
+  "Waaye",
+  "askan",
+  "ñooy",
+  "boppam",
+  "Faraas",
+  "gox",
+  "xeet",
+  "aju",
+  "bañ",
+  "yiy",
+  "ja",
+  "Otris",
+  "tudd",
+  "yàgg",
+  "liggéey",
+  "bind",
+  "maanaam",
+  "ànd",
+  "lépp",
+  "nangu",
+  "juroom",
+  "dawaan",
+  "gii",
+  "ginaaw",
+  "mbooleem",
+  "tey",
+  "fukk",
+  "bëgg",
+  "kon",
+  "lool",
+  "bees",
+  "jot",
+  "jii",
+  "niki",
+  "Moom",
+  "dañu",
+  "wa",
+  "nuy",
+  "Loolu",
+  "boole",
+  "mbir",
+  "yees",
+  "jox",
+  "way",
+  "mën",
+  "politig",
+  "buur",
+  "wolof",
+  "xam-xamu",
+  "kaw",
+  "Ca",
+  "dund",
+  "bopp",
+  "waral",
+  "xalaat",
+  "ame",
+  "j",
+  "jóge",
+  "may",
+  "sanc",
+  "tay",
+  "adduna",
+  "lislaam",
+  "wàll",
+  "Ñu",
+  "baat",
+  "Kon",
+  "Ndax",
+  "kanam",
+  "taxawal",
+  "dal",
+  "genn",
+  "Brusiya",
+  "dee",
+  "topp",
+  "ñàkk",
+  "amul",
+  "fay",
+  "indi",
+  "tekki",
+  "juge",
+  "jàng",
+  "sos",
+  "Yonnant",
+  "buy",
+  "fu",
+  "Te",
+  "dox",
+  "Britani",
+  "weer",
+  "wàllug",
+  "jël",
+  "naan",
+  "ñaar",
+  "Am",
+  "Man",
+  "dañoo",
+  "xarnu",
+  "googu",
+  "penku",
+  "àgg",
+  "fekk",
+  "jur",
+  "bàyyi",
+  "gëstu",
+  "g",
+  "kawe",
+  "dara",
+  "dañuy",
+  "ngeen",
+  "Amerig",
+  "dees",
+  "dugg",
+  "feeñ",
+  "reewi",
+  "tas",
+  "Bi",
+  "réewi",
+  "Afrik",
+  "boo",
+  "des",
+  "jiite",
+  "wàllu",
+  "1",
+  "tur",
+  "yor",
+  "nasaraanal",
+  "wër",
+  "Ba",
+  "Wolof",
+  "jumtukaay",
+  "yàlla",
+  "barab",
+  "jàpp",
+  "ngay",
+  "Lislaam",
+  "kat",
+  "lees",
+  "lii",
+  "sama",
+  "woy",
+  "Injiil",
+  "cee",
+  "nee",
+  "tudde",
+  "ña",
+  "ñëw",
+  "Lu",
+  "ndaw",
+  "njiitu",
+  "wone",
+  "ñépp",
+  "dina",
+  "ginnaaw",
+  "lanu",
+  "lenn",
+  "Ay",
+  "biy",
+  "jigéen",
+  "koom-koom",
+  "mbooloo",
+  "taxoon",
+  "wuute",
+  "xeetu",
+  "Angalteer",
+  "amal",
+  "amee",
+  "kër",
+  "làkku",
+  "aji",
+  "noppi",
+  "Boroom",
+  "Waa",
+  "araab",
+  "bëj-gànnaar",
+  "réewum",
+  "tollu",
+  "wéy",
+  "yenn",
+  "juddoo",
+  "jug",
+  "leeral",
+  "nasaraan",
+  "xel",
+  "beneen",
+  "nguuru",
+  "Bokk",
+  "bennoo",
+  "diiwaan",
+  "doomi",
+  "néew",
+  "tam",
+  "ñuul",
+  "bis",
+  "cib",
+  "ndox",
+  "tar",
+  "diiney",
+  "jublu",
+  "lim",
+  "rawati",
+  "sowwu",
+  "xale",
+  "Ku",
+  "Mali",
+  "Pël",
+  "àtte",
+  "Tuubaa",
+  "Wikipedia",
+  "bokkoon",
+  "defoon",
+  "doonoon",
+  "jàmm",
+  "seenug",
+  "Seex",
+  "bawoo",
+  "bépp",
+  "doxal",
+  "dëgg",
+  "jaam",
+  "jaar",
+  "soppi",
+  "sàkku",
+  "toolu",
+  "Lii",
+  "saa",
+  "sancu",
+  "tamit",
+  "Mi",
+  "Su",
+  "digg",
+  "nguurug",
+  "tollook",
+  "xaaj",
+  "bare",
+  "daanaka",
+  "gëm",
+  "àddina",
+  "cosaan",
+  "dooley",
+  "duggal",
+  "mii",
+  "tubaab",
+  "bijjaakon",
+  "joxe",
+  "jëf",
+  "kàttan",
+  "luy",
+  "yoonu",
+  "Isipt",
+  "doom",
+  "génne",
+  "leegi",
+  "lekk",
+  "xool",
+  "Ndakaaru",
+  "fukki",
+  "rafet",
+  "ragal",
+  "wuññi",
+  "xareb",
+  "Di",
+  "Jolof",
+  "dencukaay",
+  "dëppoo",
+  "jiitu",
+  "mat",
+  "turu",
+  "xam-xami",
+  "laaj",
+  "Asi",
+  "Wàll:Jëfandikukat",
+  "aar",
+  "dafay",
+  "dolli",
+  "génn",
+  "mboolaay",
+  "safaanu",
+  "yaram",
+  "yeek",
+  "ëmb",
+  "Aamerig",
+  "Napoleon",
+  "leer",
+  "tàmblee",
+  "woote",
+  "yuy",
+  "BOROOM",
+  "Nit",
+  "alal",
+  "bon",
+  "bëj-saalum",
+  "jëme",
+  "jëmm",
+  "téere",
+  "ñatti",
+  "akug",
+  "daldi",
+  "jawwu",
+  "miy",
+  "mukk",
+  "ne-ne",
+  "yaatu",
+  "yokk",
+  "2",
+  "Ab",
+  "Espaañ",
+  "dellu",
+  "léegi",
+  "fii",
+  "jukki",
+  "kàddu",
+  "taxaw",
+  "tegu",
+  "Looloo",
+  "Muhammad",
+  "Orob",
+  "Sëñ",
+  "jege",
+  "julli",
+  "katolig",
+  "mbind",
+  "rëy",
+  "saxal",
+  "sañ-sañ",
+  "weesu",
+  "xarnub",
+  "xibaar",
+  "diiwaanu",
+  "géej",
+  "mbooloom",
+  "mbootaay",
+  "toll",
+  "gëna",
+  "jàppe",
+  "làkki",
+  "léen",
+  "moomu",
+  "nii",
+  "sëriñ",
+  "yaa",
+  "yaxantu",
+  "Soxna",
+  "Séeréer",
+  "gannaaw",
+  "i",
+  "jaare",
+  "jële",
+  "looloo",
+  "sant",
+  "soo",
+  "tàmbalee",
+  "weñ",
+  "Waxtaani",
+  "defe",
+  "doomu",
+  "jamonoy",
+  "jariñu",
+  "jooju",
+  "ta",
+  "yoo",
+  "ñeenti",
+  "Jëf",
+  "Yonent",
+  "daje",
+  "tabax",
+  "tàmbli",
+  "wara",
+  "waxtu",
+  "Ak",
+  "Bëj-saalum",
+  "Mooy",
+  "Siin",
+  "guy",
+  "gënoon",
+  "lañuy",
+  "nañ",
+  "ndaje",
+  "sukkandiku",
+  "yam",
+  "Bennoo",
+  "Na",
+  "aada",
+  "neen",
+  "waraloon",
+  "Room",
+  "booba",
+  "bul",
+  "geneen",
+  "suqali",
+  "Benn",
+  "fan",
+  "faral",
+  "jant",
+  "màggal",
+  "woowu",
+  "xeeti",
+  "yaw",
+  "Kajoor",
+  "buuru",
+  "bés",
+  "faranse",
+  "fekkee",
+  "jikko",
+  "kuy",
+  "loo",
+  "wér",
+  "yepp",
+  "yewwute",
+  "Bismarck",
+  "Ngir",
+  "Wàdd",
+  "dajale",
+  "diggu",
+  "fipp",
+  "gaaw",
+  "guddi",
+  "judd",
+  "kàttanu",
+  "lepp",
+  "natt",
+  "soxla",
+  "Ñi",
+  "Ñoom",
+  "3",
+  "4",
+  "dawaanu",
+  "dugal",
+  "endustri",
+  "réy",
+  "tegoon",
+  "tukkee",
+  "woo",
+  "angale",
+  "askanu",
+  "dale",
+  "dégg",
+  "fànn",
+  "féete",
+  "gépp",
+  "jéem",
+  "kii",
+  "ndaxte",
+  "njiit",
+  "ron",
+  "tàmbali",
+  "tànn",
+  "yëngu-yëngu",
+  "dend",
+  "duñu",
+  "góor",
+  "jëkk",
+  "limu",
+  "moy",
+  "neex",
+  "njariñ",
+  "pexe",
+  "soppiku",
+  "wetu",
+  "Anta",
+  "Wante",
+  "bëggee",
+  "danoo",
+  "jàpple",
+  "kureel",
+  "saytu",
+  "sori",
+  "tedd",
+  "wenn",
+  "xeltu",
+  "xol",
+  "ñaareelu",
+  "ñeent",
+  "ñetti",
+  "daj",
+  "dëkke",
+  "faatu",
+  "fees",
+  "giy",
+  "laa",
+  "maa",
+  "ndeem",
+  "nettali",
+  "temb",
+  "weeru",
+  "yem",
+  "ñiy",
+  "Buur",
+  "Njaay",
+  "Réew",
+  "Yeesu",
+  "bëj-gànnaaru",
+  "doonte",
+  "doy",
+  "jenn",
+  "jàngoro",
+  "ligeey",
+  "maanaa",
+  "mbiri",
+  "mujjoon",
+  "ndam",
+  "rawatina",
+  "tool",
+  "xaalis",
+  "yoroon",
+  "doj",
+  "door",
+  "dunu",
+  "gàddaay",
+  "noste",
+  "sell",
+  "as",
+  "dañ",
+  "fal",
+  "g.j",
+  "jaamu",
+  "kilifa",
+  "km²",
+  "manul",
+  "màgg",
+  "nañoo",
+  "ray",
+  "sancaan",
+  "tuddoon",
+  "waxi",
+  "waxtaan",
+  "woowee",
+  "yamoo",
+  "Alxuraan",
+  "Atlas",
+  "Fuuta",
+  "Maa",
+  "baa",
+  "bennal",
+  "danu",
+  "daw",
+  "diwaan",
+  "jafe-jafe",
+  "say",
+  "seet",
+  "xew-xew",
+  "Rusi",
+  "dog",
+  "dëkku",
+  "foofu",
+  "mbay",
+  "ndawi",
+  "nekke",
+  "sabab",
+  "soxna",
+  "waxe",
+  "xarala",
+  "yittewoo",
+  "yonant",
+  "Japon",
+  "Ki",
+  "defar",
+  "deret",
+  "dex",
+  "digal",
+  "dimbali",
+  "jibal",
+  "kay",
+  "metti",
+  "nosteg",
+  "tuuti",
+  "xayma",
+  "yaakaar",
+  "Portigaal",
+  "Xibaaryi.com",
+  "daara",
+  "dëgër",
+  "dëkki",
+  "ibrë",
+  "indil",
+  "kontar",
+  "mbirum",
+  "nak",
+  "ndefar",
+  "ndombo",
+  "teewul",
+  "téy",
+  "xay",
+  "yaatal",
+  "yan",
+  "ñaaw",
+  "Ag",
+  "Ancos",
+  "Moo",
+  "Rom",
+  "Sàll",
+  "Yalla",
+  "arminaatu",
+  "defal",
+  "diir",
+  "diiwaani",
+  "doktoor",
+  "dëgëral",
+  "gaa",
+  "juddu",
+  "kilomet",
+  "làmmiñ",
+  "manees",
+  "matale",
+  "siiw",
+  "sotti",
+  "séddale",
+  "sépp",
+  "waxam",
+  "yeneeni",
+  "ñoñ",
+  "Màkka",
+  "Njiitu",
+  "Royuwaay:Jëfandikukat",
+  "Waalo",
+  "ati",
+  "añs",
+  "dikk",
+  "doxalukaay",
+  "gisoon",
+  "jàngu",
+  "séen",
+  "tee",
+  "woor",
+  "wuutu",
+  "wóor",
+  "y",
+  "àll",
+  "ñatt",
+  "5",
+  "Bang",
+  "Big",
+  "Diggu",
+  "Poloñ",
+  "baay",
+  "bëggoon",
+  "bëj-saalumu",
+  "doo",
+  "far",
+  "fas",
+  "feeñte",
+  "firi",
+  "gone",
+  "kiy",
+  "liy",
+  "misaal",
+  "nay",
+  "nite",
+  "nosukaay",
+  "siiwal",
+  "t",
+  "wàcc",
+  "yéene",
+  "ñaareel",
+  "End",
+  "Geres",
+  "Ginaaw",
+  "Yaw",
+  "biiram",
+  "demee",
+  "dig",
+  "doolerandu",
+  "doomam",
+  "dun",
+  "jaay",
+  "jàll",
+  "koor",
+  "lëmës",
+  "mbëjfepp",
+  "nan",
+  "sakkan",
+  "sosoo",
+  "tambalee",
+  "tàkk",
+  "yonent",
+  "2010",
+  "Amoon",
+  "Bëj-gànnaar",
+  "Holand",
+  "Ni",
+  "Piemonte",
+  "afrig",
+  "dana",
+  "feeñal",
+  "fiy",
+  "galag",
+  "gisiin",
+  "jeem",
+  "jëmale",
+  "lakk",
+  "man’a",
+  "njaboot",
+  "song",
+  "sàkk",
+  "tahaalaa",
+  "wut",
+  "xamal",
+  "xame",
+  "yomb",
+  "ñoñam",
+  "7",
+  "Dafa",
+  "Diiwaan",
+  "Dottub",
+  "Jàngu",
+  "Kirist",
+  "Mbay",
+  "Ndar",
+  "Pool",
+  "Réewum",
+  "Suuf",
+  "Taal",
+  "canc",
+  "cosaanu",
+  "fonk",
+  "goxi",
+  "jataay",
+  "laata",
+  "laman",
+  "mbëjfeppal",
+  "mucc",
+  "ngaa",
+  "niti",
+  "réewu",
+  "taariix",
+  "taw",
+  "tukki",
+  "weneen",
+  "yaatoo",
+  "yar",
+  "yëngu",
+  "Ahmadu",
+  "Faal",
+  "Jullit",
+  "Maki",
+  "Naka",
+  "Nu",
+  "Soo",
+  "Yawut",
+  "barabi",
+  "bisub",
+  "dib",
+  "faj",
+  "gan",
+  "genne",
+  "jimbulang",
+  "jubluwaay",
+  "kanamu",
+  "koom",
+  "loxoom",
+  "maam",
+  "mbëjbijjaakon",
+  "naka",
+  "ndajem",
+  "paj",
+  "teggin",
+  "woowe",
+  "yonnee",
+  "ñaan",
+  "Bii",
+  "Boo",
+  "Gànnaar",
+  "Nga",
+  "biti",
+  "dagaan",
+  "dëkkoon",
+  "garmi",
+  "giir",
+  "gisee",
+  "joge",
+  "jokkoo",
+  "junni",
+  "juróom",
+  "jëfe",
+  "mom",
+  "nataal",
+  "nos",
+  "senegaal",
+  "sosu",
+  "subhaanahu",
+  "sëñ",
+  "tomb",
+  "ubbi",
+  "yiw",
+  "ëppoon",
+  "20",
+  "Bul",
+  "Ginnaaw",
+  "M.",
+  "Ma",
+  "Mbàkke",
+  "Muy",
+  "Paab",
+  "Paris",
+  "Riisi",
+  "Sunu",
+  "asamaan",
+  "bay",
+  "caada",
+  "coona",
+  "daanu",
+  "diirub",
+  "dundal",
+  "dàq",
+  "faa",
+  "fee",
+  "fés",
+  "jeex",
+  "jàppale",
+  "latin",
+  "lijjanti",
+  "melokaan",
+  "moye",
+  "neew",
+  "njàng",
+  "rap",
+  "rax",
+  "rey",
+  "sonn",
+  "tabaski",
+  "teggiin",
+  "tànk",
+  "xanaa",
+  "yore",
+  "yàq",
+  "16",
+  "8",
+  "A.",
+  "Dëkk",
+};
+const uint16_t WA_FREQ_186_RANKS[] = {
+  0, 0, 913, 0, 562, 680, 691, 788, 0, 0, 884, 78, 486, 353, 696, 154,
+  438, 683, 931, 0, 72, 0, 0, 0, 846, 0, 0, 0, 540, 0, 98, 323,
+  356, 369, 419, 960, 752, 636, 0, 0, 564, 439, 0, 888, 735, 0, 550, 0,
+  0, 0, 688, 0, 0, 907, 0, 0, 0, 547, 0, 0, 0, 958, 0, 0,
+  0, 307, 9, 405, 944, 0, 0, 0, 770, 642, 378, 0, 0, 0, 0, 0,
+  0, 0, 350, 0, 86, 305, 979, 971, 0, 0, 56, 0, 0, 872, 0, 0,
+  0, 590, 632, 0, 454, 0, 0, 0, 0, 0, 618, 0, 0, 471, 347, 857,
+  0, 0, 0, 0, 737, 0, 446, 669, 69, 230, 95, 345, 398, 254, 449, 670,
+  222, 742, 891, 973, 794, 0, 0, 12, 217, 658, 0, 411, 0, 0, 0, 0,
+  184, 0, 0, 0, 977, 566, 0, 0, 664, 787, 54, 301, 0, 0, 0, 44,
+  994, 232, 0, 134, 65, 495, 675, 148, 536, 120, 0, 0, 0, 0, 813, 0,
+  678, 612, 412, 250, 902, 0, 0, 828, 0, 0, 478, 942, 227, 0, 521, 528,
+  702, 23, 684, 809, 212, 256, 396, 499, 519, 37, 581, 657, 717, 502, 807, 836,
+  530, 309, 840, 847, 0, 131, 897, 0, 648, 0, 0, 919, 0, 100, 609, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 145, 0, 384, 514, 764,
+  0, 358, 0, 0, 887, 0, 0, 0, 0, 0, 372, 0, 0, 0, 0, 0,
+  359, 22, 0, 332, 0, 574, 859, 0, 0, 352, 0, 0, 863, 57, 102, 775,
+  243, 687, 923, 425, 0, 0, 132, 339, 0, 108, 28, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 681, 0, 199, 0, 0, 0, 0, 0, 0, 0, 631, 0,
+  0, 638, 0, 140, 0, 0, 0, 0, 0, 662, 716, 366, 208, 0, 385, 0,
+  0, 0, 386, 66, 583, 0, 0, 0, 158, 0, 0, 298, 0, 0, 551, 553,
+  251, 868, 890, 0, 0, 415, 71, 179, 3, 0, 881, 90, 646, 0, 520, 0,
+  147, 399, 0, 0, 0, 0, 368, 899, 234, 0, 0, 267, 138, 0, 0, 0,
+  0, 0, 0, 911, 0, 193, 649, 0, 695, 0, 121, 13, 123, 0, 107, 466,
+  0, 905, 38, 106, 144, 258, 351, 355, 895, 0, 624, 0, 0, 823, 0, 0,
+  0, 0, 160, 0, 0, 0, 0, 0, 0, 777, 510, 488, 0, 0, 842, 0,
+  0, 952, 0, 0, 0, 0, 143, 0, 0, 538, 615, 697, 730, 371, 46, 0,
+  207, 114, 0, 11, 700, 0, 0, 0, 0, 268, 0, 30, 579, 0, 0, 626,
+  852, 173, 241, 582, 601, 176, 576, 280, 779, 789, 0, 0, 956, 949, 0, 613,
+  312, 858, 984, 316, 450, 760, 989, 0, 0, 526, 479, 0, 0, 0, 0, 0,
+  0, 0, 0, 327, 444, 0, 26, 170, 780, 0, 181, 633, 0, 0, 168, 0,
+  320, 904, 0, 0, 0, 0, 0, 0, 0, 643, 889, 32, 992, 0, 259, 513,
+  0, 893, 0, 0, 0, 0, 0, 0, 80, 734, 0, 0, 0, 0, 0, 0,
+  0, 489, 216, 663, 943, 966, 0, 166, 91, 485, 769, 182, 484, 532, 0, 448,
+  0, 0, 211, 843, 0, 0, 331, 122, 0, 394, 0, 413, 440, 116, 0, 802,
+  315, 558, 644, 951, 68, 0, 0, 497, 463, 587, 0, 603, 0, 0, 0, 819,
+  0, 0, 0, 395, 105, 516, 772, 875, 0, 0, 0, 0, 720, 810, 0, 537,
+  0, 0, 297, 0, 0, 800, 0, 150, 337, 690, 0, 464, 0, 918, 0, 281,
+  982, 0, 0, 498, 898, 0, 0, 0, 1, 81, 0, 0, 0, 838, 0, 218,
+  604, 917, 111, 755, 747, 457, 0, 231, 533, 712, 0, 0, 909, 766, 0, 0,
+  585, 0, 17, 389, 557, 0, 270, 288, 598, 0, 261, 792, 0, 20, 430, 25,
+  163, 568, 0, 263, 279, 342, 701, 0, 0, 0, 0, 0, 0, 0, 0, 278,
+  93, 401, 0, 0, 8, 47, 962, 0, 0, 0, 0, 0, 285, 0, 0, 0,
+  0, 832, 362, 0, 0, 0, 0, 988, 0, 0, 0, 0, 0, 387, 51, 346,
+  363, 493, 945, 0, 178, 0, 0, 0, 0, 0, 0, 152, 249, 0, 515, 667,
+  341, 390, 0, 0, 0, 0, 0, 0, 589, 142, 451, 0, 33, 826, 382, 0,
+  0, 910, 324, 104, 981, 853, 0, 0, 969, 0, 0, 0, 544, 383, 0, 0,
+  474, 778, 0, 0, 0, 248, 304, 214, 523, 424, 556, 621, 743, 839, 0, 606,
+  617, 993, 0, 480, 718, 865, 429, 934, 0, 0, 635, 0, 0, 0, 0, 228,
+  428, 749, 0, 125, 45, 238, 0, 0, 388, 0, 0, 0, 0, 748, 0, 736,
+  0, 7, 458, 0, 0, 0, 381, 0, 0, 0, 0, 0, 0, 190, 0, 0,
+  0, 41, 0, 0, 0, 0, 0, 0, 941, 741, 856, 0, 375, 0, 0, 0,
+  791, 0, 0, 224, 61, 0, 0, 0, 0, 0, 0, 0, 354, 608, 376, 957,
+  0, 575, 677, 0, 97, 0, 247, 0, 0, 0, 0, 597, 908, 0, 0, 0,
+  0, 348, 60, 19, 834, 921, 83, 187, 825, 611, 797, 0, 319, 0, 517, 0,
+  0, 980, 0, 0, 614, 0, 0, 171, 0, 133, 205, 136, 452, 475, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 225, 0, 0, 0,
+  318, 6, 0, 0, 0, 0, 0, 410, 0, 0, 0, 883, 0, 790, 0, 0,
+  972, 195, 0, 0, 0, 0, 0, 0, 0, 0, 0, 302, 393, 165, 864, 0,
+  0, 0, 0, 303, 421, 0, 0, 77, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 715, 937, 92, 203, 974, 59, 914, 276, 461, 239, 0, 654, 311, 610, 671,
+  0, 0, 0, 844, 506, 986, 0, 240, 0, 0, 0, 75, 0, 0, 936, 112,
+  708, 192, 531, 0, 0, 0, 0, 0, 367, 291, 0, 0, 0, 5, 286, 596,
+  694, 0, 274, 0, 0, 0, 710, 0, 0, 0, 0, 0, 722, 0, 210, 0,
+  661, 731, 586, 0, 0, 404, 0, 0, 0, 236, 175, 0, 290, 43, 0, 206,
+  970, 420, 559, 50, 0, 0, 0, 0, 0, 656, 876, 0, 522, 0, 0, 252,
+  189, 0, 822, 0, 861, 0, 0, 0, 0, 963, 0, 36, 426, 196, 321, 392,
+  215, 543, 35, 200, 223, 750, 16, 573, 903, 373, 441, 29, 443, 549, 0, 0,
+  877, 707, 950, 0, 194, 0, 149, 422, 916, 925, 0, 0, 0, 0, 436, 0,
+  0, 0, 445, 226, 0, 594, 434, 0, 0, 0, 0, 571, 0, 155, 157, 0,
+  804, 161, 507, 569, 128, 477, 622, 0, 0, 0, 0, 85, 0, 0, 403, 706,
+  0, 745, 391, 400, 0, 220, 0, 213, 0, 0, 591, 634, 406, 0, 0, 129,
+  0, 0, 0, 127, 0, 0, 0, 330, 48, 0, 167, 796, 0, 0, 0, 0,
+  0, 666, 0, 0, 0, 605, 0, 0, 0, 0, 0, 118, 0, 334, 567, 329,
+  0, 0, 418, 109, 924, 0, 0, 379, 0, 0, 983, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 798, 94, 0, 0, 0, 811, 0,
+  784, 928, 991, 0, 0, 0, 314, 0, 0, 0, 959, 873, 0, 692, 0, 0,
+  0, 0, 539, 867, 967, 0, 0, 0, 487, 525, 746, 948, 0, 0, 0, 0,
+  63, 39, 269, 600, 820, 467, 275, 723, 0, 727, 0, 491, 0, 482, 42, 177,
+  465, 647, 126, 460, 996, 892, 554, 0, 0, 0, 668, 830, 73, 76, 693, 0,
+  209, 0, 0, 0, 560, 831, 0, 0, 0, 0, 0, 729, 202, 306, 180, 417,
+  524, 768, 929, 0, 0, 0, 423, 58, 84, 260, 0, 0, 402, 357, 812, 442,
+  0, 0, 0, 0, 645, 62, 317, 0, 0, 322, 704, 0, 0, 785, 0, 0,
+  0, 0, 0, 0, 229, 455, 0, 282, 0, 0, 0, 0, 0, 0, 103, 542,
+  561, 0, 827, 0, 472, 0, 673, 0, 0, 0, 0, 655, 922, 0, 0, 409,
+  117, 0, 0, 0, 0, 0, 0, 53, 724, 672, 0, 0, 0, 782, 0, 476,
+  2, 0, 0, 0, 70, 504, 793, 0, 0, 0, 599, 492, 0, 639, 0, 709,
+  0, 602, 806, 0, 191, 508, 0, 0, 529, 565, 0, 435, 0, 0, 0, 534,
+  0, 0, 900, 753, 0, 0, 0, 0, 995, 776, 0, 0, 0, 0, 0, 295,
+  0, 0, 0, 0, 0, 18, 932, 0, 0, 541, 257, 300, 860, 0, 151, 244,
+  338, 799, 174, 453, 653, 414, 732, 714, 299, 848, 0, 0, 0, 665, 990, 15,
+  920, 124, 0, 998, 0, 0, 0, 27, 511, 682, 0, 0, 237, 0, 0, 67,
+  0, 0, 377, 0, 0, 954, 0, 0, 640, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 619, 874, 938, 0, 31, 264, 0, 0, 0, 0, 262, 0, 578,
+  0, 0, 0, 135, 801, 0, 0, 0, 0, 0, 0, 0, 0, 0, 113, 74,
+  0, 975, 0, 0, 0, 0, 255, 728, 0, 0, 0, 548, 14, 0, 0, 0,
+  380, 470, 325, 0, 0, 4, 689, 433, 818, 953, 630, 997, 0, 0, 0, 0,
+  0, 0, 473, 0, 0, 623, 0, 961, 0, 555, 0, 370, 99, 273, 824, 0,
+  552, 0, 0, 296, 964, 169, 0, 198, 0, 0, 0, 0, 201, 699, 245, 726,
+  870, 926, 0, 0, 0, 447, 740, 0, 162, 336, 674, 862, 744, 0, 0, 0,
+  0, 518, 0, 0, 333, 284, 242, 886, 0, 326, 137, 0, 0, 0, 0, 0,
+  0, 0, 349, 965, 0, 0, 0, 935, 481, 1000, 0, 293, 432, 156, 0, 0,
+  0, 829, 0, 0, 762, 0, 0, 0, 172, 272, 854, 933, 0, 0, 0, 0,
+  849, 940, 437, 459, 0, 186, 641, 751, 130, 758, 219, 79, 271, 0, 0, 0,
+  0, 0, 185, 512, 880, 505, 64, 985, 0, 0, 0, 87, 283, 416, 676, 328,
+  0, 0, 456, 21, 659, 685, 805, 851, 0, 0, 0, 287, 0, 292, 462, 814,
+  431, 894, 757, 733, 765, 0, 0, 0, 183, 0, 652, 0, 24, 759, 235, 570,
+  0, 879, 713, 767, 0, 0, 0, 52, 987, 0, 0, 427, 468, 786, 0, 0,
+  0, 0, 686, 88, 110, 0, 739, 0, 0, 0, 0, 855, 0, 0, 159, 0,
+  0, 0, 40, 912, 0, 866, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  535, 882, 756, 0, 0, 82, 0, 0, 0, 0, 774, 607, 637, 0, 711, 947,
+  0, 580, 0, 0, 0, 0, 0, 0, 0, 34, 869, 946, 0, 968, 0, 0,
+  0, 0, 0, 0, 781, 976, 698, 0, 0, 0, 483, 725, 833, 0, 577, 0,
+  115, 221, 407, 595, 620, 0, 0, 0, 0, 55, 0, 0, 0, 0, 361, 835,
+  503, 0, 0, 738, 0, 0, 0, 0, 509, 0, 978, 593, 719, 141, 628, 0,
+  101, 761, 0, 0, 841, 0, 0, 0, 815, 927, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 188, 0, 0, 546, 808, 233, 0, 0, 0, 0, 0, 365, 0,
+  0, 0, 0, 335, 0, 871, 246, 253, 0, 0, 0, 0, 0, 0, 343, 721,
+  845, 0, 0, 0, 0, 277, 527, 754, 501, 763, 885, 896, 901, 915, 266, 955,
+  164, 0, 773, 0, 500, 817, 0, 0, 119, 660, 10, 703, 153, 821, 0, 0,
+  0, 0, 0, 0, 783, 0, 878, 89, 490, 294, 360, 0, 0, 49, 0, 0,
+  0, 0, 0, 364, 0, 289, 308, 340, 374, 496, 0, 0, 0, 0, 771, 616,
+  0, 96, 0, 0, 0, 0, 0, 0, 0, 0, 0, 816, 837, 0, 999, 0,
+  0, 0, 397, 0, 0, 0, 344, 0, 0, 0, 651, 0, 0, 0, 204, 408,
+  0, 679, 939, 0, 0, 197, 265, 930, 0, 0, 0, 0, 545, 313, 795, 650,
+  0, 0, 0, 0, 0, 0, 0, 146, 563, 850, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 572, 627, 0, 906, 0, 705, 139, 0, 0, 0, 0, 584, 592,
+  629, 803, 625, 494, 0, 0, 0, 0, 588, 469, 0, 310, 0, 0, 0, 0,
+};
+
+const char *WA_FREQ_187_TOKENS[] = {
+  "andifuni",
+  "kufuneka",
+  "ndiye",
+  "ngoku",
+  "ngubani",
+  "ixesha",
+  "uyintombi",
+  "kodwa",
+  "unesibindi",
+  "khawuvale",
+  "ifestile",
+  "uyalikhumbula",
+  "igama",
+  "lakhe",
+  "le",
+  "dikshinari",
+  "yenzelwe",
+  "ukunceda",
+  "abantwana",
+  "abakwiminyaka",
+  "yabo",
+  "yokuqala",
+  "embalwa",
+  "yokufunda",
+  "isingesi",
+  "okanye",
+  "isizulu",
+  "njengolwimi",
+  "olongeziweyo",
+  "abafundi",
+  "abasixhenxe",
+  "bakhuphisana",
+  "kwitumente",
+  "yentenetya",
+  "ufuna",
+  "ilifti",
+  "hey",
+  "yintoni",
+  "enithetha",
+  "ngayo",
+};
+const uint16_t WA_FREQ_187_RANKS[] = {
+  0, 0, 0, 0, 0, 0, 0, 11, 0, 0, 31, 4, 37, 0, 0, 0,
+  0, 0, 40, 10, 0, 20, 7, 23, 0, 0, 2, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1, 8, 0, 26, 33, 0, 0, 3, 0, 0, 30, 0,
+  0, 0, 0, 0, 0, 39, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+  0, 0, 0, 0, 0, 0, 0, 0, 17, 19, 21, 16, 27, 28, 29, 34,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  24, 0, 0, 0, 12, 0, 0, 0, 18, 0, 0, 0, 0, 6, 0, 0,
+  0, 15, 0, 0, 0, 0, 14, 25, 32, 22, 35, 36, 9, 38, 13, 0,
+};
+
+const char *WA_FREQ_188_TOKENS[] = {
+  "na",
+  "um",
+  "ilu",
+  "un",
+  "ke",
+  "ake",
+  "ja",
+  "ti",
+  "yak",
+  "le",
+  "tai",
+  "ngan",
+  "tiga",
+  "ina",
+  "ia",
+  "pa",
+  "da",
+  "me",
+  "dalem",
+  "be",
+  "du",
+  "ca",
+  "ya",
+  "ida",
+  "dulu",
+  "an",
+  "pe",
+  "de",
+  "ka",
+  "kak",
+  "te",
+  "sukat",
+  "ne",
+  "re",
+  "inu",
+  "lepo",
+  "nta",
+  "pakai",
+  "a",
+  "anak",
+  "kelo",
+  "at",
+  "di",
+  "ni",
+  "ban",
+  "kado",
+  "la",
+  "sek",
+  "unclear",
+  "kuak",
+  "ta",
+  "buk",
+  "lu",
+  "ale",
+  "uban",
+  "ba",
+  "e",
+  "iu",
+  "lepa",
+  "sekula",
+  "nak",
+  "sik",
+  "memang",
+  "tisen",
+  "cin",
+  "tekak",
+  "edei",
+  "ini",
+  "ame",
+  "kimet",
+  "meka",
+  "main",
+  "tau",
+  "obak",
+  "teknologi",
+  "cen",
+  "ukok",
+  "udip",
+  "apan",
+  "atek",
+  "menjam",
+  "diak",
+  "ataupun",
+  "dalau",
+  "tei",
+  "kumbin",
+  "pasen",
+  "noise",
+  "tuk",
+  "nai",
+  "kerja",
+  "lah",
+  "ayen",
+  "masat",
+  "nakini",
+  "kelunan",
+  "bio",
+  "pekalai",
+  "mung",
+  "ji",
+  "kulu",
+  "beng",
+  "ko",
+  "layan",
+  "sin",
+  "awang",
+  "ki",
+  "lan",
+  "uman",
+  "talipon",
+  "perlu",
+  "bada",
+  "barang",
+  "bayan",
+  "ku",
+  "tu",
+  "uma",
+  "mudip",
+  "o",
+  "ek",
+  "tapi",
+  "amin",
+  "negara",
+  "paling",
+  "kidi",
+  "tega",
+  "tuak",
+  "kata",
+  "ngadan",
+  "kulo",
+  "atau",
+  "nggin",
+  "dau",
+  "neng",
+  "cuk",
+  "mik",
+  "jagak",
+  "je",
+  "kina",
+  "oban",
+  "penguman",
+  "senang",
+  "sungai",
+  "bo",
+  "isiu",
+  "bayak",
+  "to",
+  "eda",
+  "kenyah",
+  "ujan",
+  "singget",
+  "tuyang",
+  "gayeng",
+  "ma",
+  "edai",
+  "kaduk",
+  "mesti",
+  "sukan",
+  "tanak",
+  "ce",
+  "jadi",
+  "keluk",
+  "dumit",
+  "sio",
+  "latak",
+  "ut",
+  "ading",
+  "lok",
+  "toh",
+  "pemung",
+  "lebih",
+  "dini",
+  "belian",
+  "alak",
+  "oka",
+  "kini",
+  "kuman",
+  "i",
+  "uyan",
+  "pengelo",
+  "ngening",
+  "pisiu",
+  "sagak",
+  "muzik",
+  "pula",
+  "keto",
+  "bank",
+  "bu",
+  "sakit",
+  "mading",
+  "pekina",
+  "game",
+  "leto",
+  "tuhan",
+  "men",
+  "se",
+  "belajan",
+  "usa",
+  "serita",
+  "sampe",
+  "alik",
+  "janan",
+  "magat",
+  "asen",
+  "tengen",
+  "ukat",
+  "bok",
+  "adet",
+  "tusa",
+  "man",
+  "selalu",
+  "puyan",
+  "malai",
+  "pengudip",
+  "sengganak",
+  "ligit",
+  "cerita",
+  "uko",
+  "ang",
+  "kuma",
+  "okak",
+  "ulek",
+  "pita",
+  "abe",
+  "mencam",
+  "dua",
+  "warna",
+  "palai",
+  "untuk",
+  "ketai",
+  "kampung",
+  "dik",
+  "teneng",
+  "tepalai",
+  "bahasa",
+  "duktun",
+  "bek",
+  "beli",
+  "guru",
+  "seni",
+  "wayang",
+  "u",
+  "po",
+  "kadang",
+  "akan",
+  "baca",
+  "mek",
+  "kira",
+  "mula",
+  "jane",
+  "dagang",
+  "alek",
+  "au",
+  "masa",
+  "selamat",
+  "maong",
+  "bimbit",
+  "peketo",
+  "kad",
+  "ulu",
+  "pun",
+  "peniga",
+  "mateng",
+  "ai",
+  "panak",
+  "ujok",
+  "nu",
+  "dek",
+  "pekatuk",
+  "tubo",
+  "mutu",
+  "boka",
+  "pesak",
+  "sekolah",
+  "amik",
+  "dak",
+  "jok",
+  "daya",
+  "kedaya",
+  "pengelepo",
+  "penyakit",
+  "mo",
+  "pisu",
+  "en",
+  "pana",
+  "boleh",
+  "kereta",
+  "minat",
+  "gayak",
+  "njam",
+  "awai",
+  "dalam",
+  "anun",
+  "sa",
+  "nang",
+  "takut",
+  "idi",
+  "kek",
+  "taket",
+  "bunga",
+  "madung",
+  "tukang",
+  "ala",
+  "ikut",
+  "tapek",
+  "oyan",
+  "sen",
+  "senganak",
+  "muek",
+  "majan",
+  "kumin",
+  "pengalai",
+  "si",
+  "macam",
+  "mita",
+  "muat",
+  "keja",
+  "pernah",
+  "nawai",
+  "tading",
+  "jadek",
+  "dado",
+  "lau",
+  "pemanak",
+  "matai",
+  "program",
+  "nyi",
+  "masem",
+  "alem",
+  "ngata",
+  "nengayet",
+  "talian",
+  "sokat",
+  "manyi",
+  "langit",
+  "bulan",
+  "selem",
+  "meli",
+  "klinik",
+  "hobi",
+  "peng",
+  "kok",
+  "kua",
+  "ri",
+  "dei",
+  "wek",
+  "kembi",
+  "perinta",
+  "tawai",
+  "banget",
+  "selum",
+  "abun",
+  "are",
+  "kemudahan",
+  "maju",
+  "telu",
+  "lagu",
+  "tesen",
+  "badak",
+  "juan",
+  "online",
+  "dageng",
+  "kujau",
+  "amai",
+  "kadu",
+  "tung",
+  "iko",
+  "belajen",
+  "betuen",
+  "suti",
+  "kem",
+  "penisen",
+  "undi",
+  "ngen",
+  "kediut",
+  "pekaliu",
+  "kedai",
+  "surat",
+  "orang",
+  "katuk",
+  "penusa",
+  "kala",
+  "nulong",
+  "krismas",
+  "bil",
+  "ngimet",
+  "mok",
+  "metit",
+  "mukun",
+  "ojan",
+  "nyat",
+  "nyatung",
+  "taun",
+  "tulong",
+  "isu",
+  "biasa",
+  "ak",
+  "pu",
+  "badminton",
+  "teka",
+  "nading",
+  "tolong",
+  "adalah",
+  "dan",
+  "ngelinek",
+  "peteneng",
+  "silem",
+  "mentem",
+  "kawak",
+  "bup",
+  "artis",
+  "cara",
+  "oman",
+  "s",
+  "kumpin",
+  "melayu",
+  "lema",
+  "suka",
+  "minggu",
+  "talipun",
+  "pempet",
+  "sebayang",
+  "kredit",
+  "nyatong",
+  "jumpa",
+  "kawang",
+  "ilou",
+  "laki",
+  "rek",
+  "buek",
+  "denak",
+  "layak",
+  "ubi",
+  "menang",
+  "ngundi",
+  "ngena",
+  "cuma",
+  "keneng",
+  "tok",
+  "edi",
+  "laya",
+  "tusah",
+  "baluk",
+  "yang",
+  "pengeluk",
+  "musim",
+  "baru",
+  "tulung",
+  "sendiri",
+  "bi",
+  "tekek",
+  "atuk",
+  "yap",
+  "sukup",
+  "nyurat",
+  "nubo",
+  "talifon",
+  "guna",
+  "bagi",
+  "nyeng",
+  "kancet",
+  "naki",
+  "dai",
+  "naat",
+  "su",
+  "putek",
+  "ire",
+  "jak",
+  "saleng",
+  "alok",
+  "cung",
+  "talidio",
+  "projek",
+  "madang",
+  "negeri",
+  "kurang",
+  "lepah",
+  "pekimet",
+  "pulo",
+  "malaysia",
+  "pabe",
+  "midan",
+  "jaga",
+  "dunia",
+  "cikgu",
+  "cuti",
+  "pinjaman",
+  "bekading",
+  "telepon",
+  "no",
+  "ukuk",
+  "alut",
+  "kan",
+  "bola",
+  "do",
+  "pah",
+  "suwi",
+  "dema",
+  "majau",
+  "tv",
+  "leko",
+  "milek",
+  "bareng",
+  "telefon",
+  "cereta",
+  "makin",
+  "mungkin",
+  "tuyau",
+  "lo",
+  "sey",
+  "kena",
+  "jam",
+  "lemuto",
+  "engkin",
+  "bala",
+  "buak",
+  "dulue",
+  "putih",
+  "sedia",
+  "sapai",
+  "long",
+  "pengebio",
+  "berita",
+  "tabat",
+  "internet",
+  "passport",
+  "kejaie",
+  "demanai",
+  "lukte",
+  "kenggei",
+  "pak",
+  "batek",
+  "menat",
+  "adang",
+  "alat",
+  "penting",
+  "tua",
+  "lia",
+  "english",
+  "uk",
+  "video",
+  "baan",
+  "songai",
+  "urang",
+  "line",
+  "uleng",
+  "kecil",
+  "gelam",
+  "liwai",
+  "kasa",
+  "asu",
+  "bulen",
+  "pemuyan",
+  "ngeringa",
+  "tena",
+  "salau",
+  "idai",
+  "buin",
+  "liap",
+  "wat",
+  "pinut",
+  "lawyer",
+  "ubat",
+  "dia",
+  "kemajuan",
+  "gaya",
+  "mu",
+  "sape",
+  "ik",
+  "baya",
+  "pina",
+  "kebun",
+  "tegok",
+  "tana",
+  "bileng",
+  "cek",
+  "engke",
+  "kun",
+  "tekenak",
+  "cukup",
+  "dina",
+  "bak",
+  "sutok",
+  "matapelajaran",
+  "ic",
+  "kengke",
+  "kawan",
+  "kalung",
+  "enta",
+  "bali",
+  "ine",
+  "inou",
+  "cough",
+  "inah",
+  "ben",
+  "mew",
+  "pat",
+  "kesihatan",
+  "bah",
+  "keluarga",
+  "amek",
+  "jaat",
+  "peto",
+  "sengela",
+  "penyelum",
+  "taup",
+  "patut",
+  "lepau",
+  "diam",
+  "pilu",
+  "peresa",
+  "luntok",
+  "tajen",
+  "eno",
+  "lebo",
+  "perita",
+  "okat",
+  "matematik",
+  "agat",
+  "musik",
+  "suang",
+  "tentu",
+  "kelok",
+  "tagak",
+  "kumbi",
+  "matet",
+  "kempi",
+  "ok",
+  "mejam",
+  "ngasa",
+  "abek",
+  "pegayeng",
+  "raya",
+  "aung",
+  "kuching",
+  "asat",
+  "selai",
+  "meta",
+  "iri",
+  "nganak",
+  "lumit",
+  "menggin",
+  "leta",
+  "ketua",
+  "telipon",
+  "pengenjam",
+  "komuniti",
+  "pelita",
+  "penulong",
+  "tapung",
+  "penaru",
+  "datun",
+  "nembam",
+  "keriut",
+  "rasa",
+  "jo",
+  "pengelok",
+  "banking",
+  "kedi",
+  "iut",
+  "rei",
+  "nik",
+  "tasap",
+  "sada",
+  "laugh",
+  "kalau",
+  "sengim",
+  "denga",
+  "hospital",
+  "lamin",
+  "siget",
+  "ikem",
+  "nekini",
+  "beun",
+  "pekala",
+  "debit",
+  "sarawak",
+  "meken",
+  "tentang",
+  "exercise",
+  "odai",
+  "mampin",
+  "pembayaran",
+  "nya",
+  "jin",
+  "patai",
+  "perintah",
+  "bituen",
+  "mathew",
+  "adung",
+  "komputer",
+  "jan",
+  "soalan",
+  "jatung",
+  "pekalui",
+  "bang",
+  "jarang",
+  "bedagang",
+  "melai",
+  "jek",
+  "aki",
+  "tali",
+  "susah",
+  "berjaya",
+  "awak",
+  "oko",
+  "nan",
+  "selebriti",
+  "pelakun",
+  "tak",
+  "bangsa",
+  "pudip",
+  "mi",
+  "toyang",
+  "kadep",
+  "mepo",
+  "nyangen",
+  "mata",
+  "bayu",
+  "kelipau",
+  "luk",
+  "satu",
+  "tosa",
+  "ap",
+  "larui",
+  "taw",
+  "pengelepuk",
+  "petengen",
+  "tirak",
+  "palo",
+  "ngalung",
+  "kaba",
+  "nyak",
+  "sawit",
+  "ngau",
+  "kulong",
+  "pengelatak",
+  "penega",
+  "luar",
+  "pekalei",
+  "masih",
+  "cok",
+  "kayu",
+  "bungak",
+  "taru",
+  "perbankan",
+  "ae",
+  "modal",
+  "nem",
+  "belajak",
+  "taan",
+  "piyat",
+  "gap",
+  "utek",
+  "kristen",
+  "tenang",
+  "peti",
+  "bulok",
+  "buka",
+  "budaya",
+  "nyana",
+  "bisau",
+  "pedenak",
+  "telang",
+  "imak",
+  "petusa",
+  "jana",
+  "keliwa",
+  "ngajan",
+  "putik",
+  "tambah",
+  "nyulo",
+  "usen",
+  "mana",
+  "babui",
+  "suntok",
+  "mengin",
+  "sihat",
+  "jau",
+  "nei",
+  "ra",
+  "pengelepok",
+  "nempam",
+  "aya",
+  "radio",
+  "mopet",
+  "aong",
+  "pi",
+  "guaman",
+  "data",
+  "desa",
+  "sebarang",
+  "encam",
+  "sempa",
+  "masak",
+  "pekelet",
+  "badan",
+  "senaman",
+  "drama",
+  "tukeng",
+  "asing",
+  "jupak",
+  "contoh",
+  "youtube",
+  "perubahan",
+  "miko",
+  "teh",
+  "utung",
+  "paham",
+  "pet",
+  "utang",
+  "cuaca",
+  "ngelau",
+  "memudahkan",
+  "iya",
+  "pengejaat",
+  "ngendu",
+  "li",
+  "taga",
+  "mempam",
+  "ngebayak",
+  "bulu",
+  "kapan",
+  "pulok",
+  "peda",
+  "padai",
+  "bangen",
+  "urip",
+  "lemoto",
+  "tetap",
+  "nyelai",
+  "supaya",
+  "seken",
+  "nolong",
+  "dengan",
+  "ley",
+  "usan",
+  "ketei",
+  "dari",
+  "pelapah",
+  "murip",
+  "sekola",
+  "so",
+  "petubo",
+  "kuda",
+  "tem",
+  "ata",
+  "selawan",
+  "pengarap",
+  "singket",
+  "bandar",
+  "padang",
+  "dedo",
+  "tuing",
+  "utan",
+  "maung",
+  "mano",
+  "bimpin",
+  "metek",
+  "nilai",
+  "bolan",
+  "guitar",
+  "udok",
+  "nisep",
+  "muco",
+  "ubak",
+  "yek",
+  "nyukong",
+  "korea",
+  "whatsapp",
+  "pinang",
+  "hiasan",
+  "selepek",
+  "maan",
+  "mabi",
+  "kenai",
+  "putung",
+  "julud",
+  "nam",
+  "sosial",
+  "pake",
+  "baris",
+  "pengagat",
+  "moto",
+  "neh",
+  "malap",
+  "sedirik",
+  "basketball",
+  "kah",
+  "tempat",
+  "tek",
+  "lokte",
+  "penguyan",
+  "ngelinga",
+  "siuk",
+  "nga",
+  "edang",
+  "pan",
+  "p",
+  "aka",
+  "anu",
+  "tego",
+  "kinak",
+  "milik",
+  "jerusalem",
+  "pemudip",
+  "kenak",
+  "manai",
+  "petegok",
+  "pengamin",
+  "gan",
+  "mendem",
+  "segi",
+  "kelimpun",
+  "lempam",
+  "ngalang",
+  "gereja",
+  "kelas",
+  "belajar",
+  "eh",
+  "card",
+  "lesau",
+  "kanen",
+  "kraf",
+  "pen",
+  "sejarah",
+  "zaman",
+  "pelajaran",
+  "awen",
+  "we",
+  "biu",
+  "ngelan",
+  "am",
+  "buat",
+  "masuk",
+  "asal",
+  "biuk",
+  "jah",
+  "janji",
+  "aro",
+  "miri",
+  "up",
+  "laah",
+  "taro",
+  "canggih",
+  "keti",
+  "teranak",
+  "selita",
+  "takang",
+  "kelap",
+  "seluruh",
+  "misi",
+  "lio",
+  "ketenak",
+  "semba",
+  "lukis",
+  "jameng",
+  "ujo",
+  "rakyat",
+  "durat",
+  "chat",
+  "mei",
+  "bute",
+  "tebengang",
+  "temengang",
+  "tabung",
+  "walaupun",
+  "meng",
+  "music",
+  "saga",
+  "mengata",
+  "balau",
+  "adat",
+  "lasan",
+  "muda",
+  "kerita",
+  "tipu",
+  "lurat",
+  "sagun",
+  "sukma",
+  "pik",
+  "pedagang",
+  "balok",
+  "harus",
+  "hasil",
+  "entuk",
+  "lalem",
+  "tetaup",
+  "belas",
+  "ngam",
+  "kalek",
+  "jukok",
+  "opis",
+  "ngak",
+  "depan",
+  "sengket",
+  "lek",
+  "daduk",
+  "jukuk",
+  "t",
+};
+const uint16_t WA_FREQ_188_RANKS[] = {
+  0, 558, 193, 221, 483, 0, 0, 0, 0, 0, 0, 179, 749, 826, 0, 0,
+  512, 228, 131, 0, 449, 0, 996, 0, 0, 137, 0, 0, 0, 11, 823, 822,
+  0, 364, 0, 0, 338, 455, 467, 759, 0, 0, 0, 306, 0, 197, 934, 0,
+  0, 0, 571, 0, 0, 0, 0, 0, 0, 0, 80, 0, 441, 0, 0, 0,
+  0, 0, 188, 850, 0, 0, 25, 350, 319, 14, 601, 747, 0, 0, 531, 145,
+  0, 400, 333, 0, 0, 0, 0, 0, 0, 0, 0, 553, 0, 862, 0, 54,
+  0, 0, 139, 0, 0, 0, 452, 0, 0, 727, 979, 0, 0, 0, 0, 675,
+  0, 282, 0, 0, 0, 0, 0, 0, 0, 0, 703, 0, 0, 0, 0, 0,
+  140, 0, 930, 330, 986, 867, 0, 567, 245, 0, 575, 0, 0, 774, 213, 621,
+  200, 0, 0, 428, 356, 15, 856, 926, 0, 0, 0, 0, 0, 277, 390, 0,
+  0, 0, 0, 760, 100, 853, 0, 711, 0, 79, 0, 0, 0, 0, 314, 538,
+  947, 0, 0, 0, 0, 914, 0, 0, 920, 415, 609, 0, 69, 299, 0, 0,
+  784, 533, 0, 0, 0, 0, 0, 0, 219, 0, 0, 0, 510, 0, 0, 0,
+  446, 912, 0, 0, 0, 398, 726, 869, 0, 541, 0, 0, 0, 0, 712, 880,
+  0, 0, 111, 0, 0, 389, 0, 505, 381, 0, 518, 563, 782, 0, 0, 182,
+  655, 132, 363, 0, 0, 0, 684, 0, 0, 0, 317, 0, 0, 0, 0, 0,
+  0, 31, 0, 0, 0, 0, 0, 770, 0, 536, 0, 0, 0, 570, 476, 669,
+  882, 0, 308, 257, 0, 788, 623, 0, 0, 742, 0, 335, 0, 0, 0, 401,
+  0, 0, 0, 0, 320, 860, 0, 0, 627, 990, 0, 966, 0, 0, 550, 0,
+  0, 0, 0, 379, 465, 0, 0, 24, 919, 0, 87, 849, 915, 0, 19, 0,
+  0, 798, 321, 0, 0, 0, 0, 435, 0, 0, 0, 0, 0, 646, 0, 466,
+  696, 0, 0, 686, 0, 0, 0, 0, 397, 0, 0, 0, 0, 0, 116, 0,
+  0, 0, 902, 365, 592, 0, 12, 0, 0, 310, 0, 0, 0, 376, 0, 0,
+  819, 0, 0, 0, 0, 238, 0, 0, 409, 236, 0, 0, 666, 636, 775, 0,
+  0, 0, 0, 810, 222, 110, 588, 0, 0, 0, 339, 208, 240, 249, 0, 81,
+  852, 878, 0, 0, 0, 0, 0, 59, 0, 462, 565, 0, 0, 0, 0, 0,
+  129, 829, 595, 18, 937, 681, 0, 224, 721, 0, 0, 0, 0, 0, 180, 102,
+  0, 638, 910, 39, 0, 0, 0, 0, 0, 0, 0, 959, 144, 218, 148, 158,
+  956, 0, 286, 251, 559, 586, 908, 105, 212, 874, 0, 0, 736, 0, 0, 199,
+  0, 0, 436, 0, 55, 753, 644, 98, 634, 0, 198, 0, 0, 0, 0, 283,
+  237, 328, 0, 827, 0, 0, 0, 348, 0, 0, 0, 700, 0, 88, 164, 141,
+  761, 791, 892, 905, 969, 0, 16, 359, 0, 161, 0, 896, 420, 832, 916, 478,
+  813, 438, 0, 419, 507, 562, 804, 0, 549, 0, 0, 0, 0, 0, 94, 0,
+  773, 520, 705, 0, 938, 0, 250, 230, 291, 900, 816, 7, 755, 0, 0, 0,
+  0, 0, 311, 136, 688, 640, 0, 458, 0, 0, 0, 0, 0, 70, 0, 0,
+  0, 410, 323, 709, 0, 0, 0, 0, 305, 440, 825, 560, 0, 0, 247, 674,
+  3, 546, 0, 0, 0, 0, 0, 255, 0, 9, 0, 841, 0, 0, 0, 0,
+  0, 0, 302, 6, 78, 367, 500, 524, 701, 0, 0, 0, 824, 0, 0, 374,
+  602, 540, 857, 0, 0, 0, 496, 52, 342, 498, 708, 0, 628, 729, 0, 429,
+  276, 928, 0, 0, 0, 0, 597, 0, 0, 0, 0, 405, 253, 718, 792, 0,
+  932, 0, 0, 769, 557, 0, 0, 0, 0, 0, 0, 46, 0, 53, 125, 324,
+  0, 0, 0, 0, 0, 0, 0, 174, 0, 0, 0, 0, 0, 0, 0, 123,
+  612, 118, 0, 631, 1, 974, 0, 0, 0, 0, 0, 0, 8, 598, 945, 0,
+  0, 535, 0, 0, 0, 0, 0, 151, 526, 0, 0, 391, 0, 456, 210, 371,
+  413, 659, 96, 0, 0, 227, 0, 0, 214, 872, 175, 0, 534, 0, 0, 618,
+  481, 0, 211, 75, 336, 0, 0, 430, 0, 0, 0, 0, 183, 0, 0, 0,
+  0, 0, 581, 799, 288, 833, 899, 0, 0, 0, 233, 0, 0, 0, 0, 0,
+  358, 0, 134, 0, 331, 0, 431, 205, 642, 411, 836, 877, 981, 0, 0, 34,
+  447, 704, 781, 794, 859, 0, 0, 0, 0, 0, 0, 0, 0, 262, 0, 0,
+  0, 61, 0, 106, 0, 0, 0, 0, 578, 941, 0, 861, 615, 0, 225, 0,
+  811, 43, 119, 0, 0, 0, 0, 0, 0, 0, 0, 232, 873, 0, 0, 0,
+  0, 509, 0, 0, 0, 30, 0, 386, 622, 0, 0, 0, 427, 0, 345, 204,
+  741, 407, 0, 809, 223, 0, 692, 0, 639, 0, 522, 261, 0, 0, 653, 994,
+  733, 307, 329, 594, 0, 532, 417, 702, 49, 0, 97, 0, 0, 828, 0, 0,
+  0, 802, 267, 0, 256, 719, 138, 269, 898, 0, 0, 0, 0, 482, 178, 866,
+  797, 886, 803, 0, 0, 0, 349, 0, 303, 751, 909, 107, 0, 0, 0, 527,
+  0, 0, 0, 0, 508, 590, 0, 122, 351, 764, 973, 987, 0, 0, 0, 0,
+  847, 672, 890, 689, 26, 0, 130, 325, 0, 0, 0, 0, 185, 0, 0, 0,
+  0, 0, 318, 265, 192, 851, 0, 0, 0, 0, 0, 0, 493, 235, 0, 459,
+  577, 777, 948, 48, 837, 0, 0, 0, 0, 0, 195, 871, 649, 0, 0, 0,
+  875, 0, 0, 0, 0, 0, 0, 731, 737, 0, 632, 516, 274, 864, 0, 0,
+  0, 71, 347, 432, 461, 485, 772, 0, 511, 0, 0, 157, 298, 471, 529, 0,
+  0, 463, 51, 0, 0, 660, 0, 50, 0, 645, 717, 0, 0, 450, 0, 0,
+  931, 0, 812, 301, 0, 0, 593, 0, 0, 343, 962, 0, 0, 0, 0, 114,
+  0, 0, 341, 980, 0, 0, 0, 0, 0, 480, 815, 0, 0, 643, 0, 0,
+  723, 758, 0, 0, 0, 0, 0, 0, 0, 0, 414, 353, 72, 0, 0, 629,
+  0, 913, 715, 842, 1000, 160, 2, 177, 600, 91, 29, 596, 884, 344, 437, 943,
+  0, 0, 0, 172, 394, 0, 33, 234, 0, 670, 0, 445, 818, 750, 194, 0,
+  0, 0, 0, 41, 393, 0, 469, 346, 0, 244, 486, 569, 0, 939, 995, 603,
+  0, 0, 604, 746, 0, 128, 667, 0, 0, 190, 0, 0, 0, 0, 641, 4,
+  671, 0, 472, 537, 313, 316, 443, 542, 547, 0, 0, 0, 0, 0, 0, 369,
+  292, 556, 0, 0, 99, 682, 885, 0, 0, 0, 0, 0, 0, 652, 0, 0,
+  0, 0, 135, 0, 399, 0, 170, 0, 0, 530, 0, 0, 0, 0, 0, 162,
+  0, 0, 0, 0, 0, 0, 217, 0, 186, 0, 0, 28, 651, 0, 0, 728,
+  0, 0, 944, 42, 513, 573, 648, 807, 904, 112, 0, 360, 327, 843, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 395, 0, 585, 0, 881, 387, 384, 0,
+  0, 468, 0, 0, 0, 65, 953, 58, 215, 725, 848, 0, 0, 171, 0, 0,
+  0, 0, 0, 690, 0, 0, 0, 525, 0, 0, 0, 0, 95, 554, 0, 893,
+  0, 661, 907, 0, 0, 0, 608, 805, 0, 0, 152, 184, 0, 0, 0, 133,
+  126, 165, 167, 514, 203, 605, 765, 806, 545, 625, 422, 796, 154, 903, 561, 879,
+  372, 444, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 77, 425, 0, 0,
+  0, 0, 0, 589, 0, 0, 263, 0, 0, 0, 83, 404, 693, 888, 326, 949,
+  808, 0, 983, 0, 0, 0, 0, 117, 166, 142, 854, 0, 0, 0, 698, 176,
+  0, 582, 491, 0, 0, 0, 0, 0, 207, 0, 499, 268, 312, 0, 0, 258,
+  0, 0, 280, 968, 706, 159, 548, 0, 506, 0, 0, 0, 568, 0, 0, 362,
+  294, 0, 0, 0, 0, 0, 108, 115, 0, 0, 0, 694, 120, 460, 801, 0,
+  0, 0, 613, 687, 766, 951, 863, 971, 0, 0, 0, 150, 0, 0, 0, 0,
+  0, 380, 0, 0, 991, 488, 744, 835, 209, 720, 800, 743, 999, 0, 0, 0,
+  0, 0, 0, 724, 0, 0, 637, 101, 0, 0, 0, 0, 0, 76, 831, 0,
+  795, 73, 92, 845, 0, 56, 0, 680, 0, 67, 378, 657, 665, 921, 0, 202,
+  0, 0, 275, 0, 0, 20, 0, 876, 0, 0, 156, 0, 0, 187, 0, 22,
+  104, 242, 0, 0, 0, 0, 0, 484, 713, 0, 0, 408, 677, 0, 650, 576,
+  830, 231, 246, 658, 960, 0, 763, 0, 0, 243, 473, 0, 0, 946, 0, 0,
+  0, 0, 0, 0, 0, 366, 0, 997, 0, 0, 143, 0, 396, 383, 85, 352,
+  266, 519, 0, 0, 691, 402, 735, 0, 0, 0, 287, 0, 539, 0, 45, 0,
+  0, 0, 442, 0, 917, 0, 403, 591, 0, 416, 0, 226, 382, 113, 494, 865,
+  0, 0, 0, 90, 732, 103, 0, 0, 334, 0, 0, 940, 163, 63, 710, 754,
+  883, 0, 0, 448, 0, 0, 679, 0, 248, 0, 0, 0, 942, 0, 0, 544,
+  0, 0, 0, 0, 0, 895, 0, 0, 0, 0, 0, 0, 0, 722, 0, 572,
+  793, 0, 109, 322, 757, 155, 477, 584, 281, 901, 0, 0, 776, 0, 0, 0,
+  0, 924, 0, 734, 0, 0, 923, 0, 0, 124, 0, 0, 858, 580, 789, 290,
+  523, 927, 421, 0, 0, 216, 0, 0, 0, 62, 0, 0, 790, 889, 196, 0,
+  457, 0, 0, 0, 970, 127, 189, 278, 564, 976, 0, 0, 0, 0, 82, 0,
+  0, 10, 0, 57, 620, 673, 846, 340, 855, 891, 515, 611, 767, 93, 0, 492,
+  963, 599, 385, 935, 0, 297, 332, 0, 0, 0, 786, 0, 952, 0, 0, 355,
+  647, 0, 0, 933, 984, 0, 521, 624, 37, 787, 0, 434, 0, 146, 470, 0,
+  779, 998, 683, 0, 0, 0, 0, 738, 745, 13, 870, 0, 0, 296, 840, 0,
+  0, 0, 633, 412, 993, 153, 656, 975, 293, 739, 887, 957, 992, 988, 454, 574,
+  0, 304, 64, 21, 361, 260, 552, 579, 475, 635, 487, 147, 201, 958, 977, 716,
+  0, 0, 0, 0, 0, 0, 0, 0, 169, 0, 0, 0, 32, 40, 279, 583,
+  834, 748, 337, 839, 964, 23, 0, 60, 0, 617, 89, 0, 0, 555, 181, 630,
+  357, 284, 814, 868, 897, 978, 0, 0, 264, 0, 0, 0, 771, 780, 0, 406,
+  0, 0, 0, 0, 0, 464, 0, 0, 0, 0, 695, 0, 662, 0, 121, 785,
+  373, 0, 309, 768, 489, 0, 86, 587, 0, 44, 610, 0, 0, 762, 894, 259,
+  0, 0, 0, 0, 370, 377, 0, 273, 66, 375, 392, 439, 0, 0, 0, 0,
+  0, 0, 451, 0, 707, 756, 0, 0, 368, 0, 74, 922, 502, 663, 654, 844,
+  0, 0, 0, 0, 504, 528, 606, 918, 0, 0, 388, 239, 0, 955, 0, 0,
+  0, 0, 0, 0, 0, 270, 191, 501, 220, 272, 614, 699, 668, 664, 0, 0,
+  0, 0, 0, 0, 285, 0, 315, 423, 229, 821, 68, 911, 925, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 972, 950, 954, 47, 838, 17, 84, 551, 619,
+  783, 961, 965, 173, 0, 0, 685, 616, 0, 0, 479, 730, 0, 0, 27, 354,
+  0, 929, 0, 778, 0, 0, 0, 0, 0, 0, 0, 0, 0, 241, 289, 0,
+  0, 626, 0, 967, 0, 0, 418, 740, 0, 0, 936, 149, 252, 752, 0, 433,
+  0, 0, 453, 5, 168, 295, 424, 497, 989, 0, 985, 36, 543, 38, 714, 35,
+  906, 0, 254, 0, 0, 0, 474, 0, 0, 0, 0, 503, 271, 0, 517, 0,
+  0, 495, 0, 0, 0, 0, 426, 607, 0, 817, 820, 0, 300, 0, 0, 0,
+  0, 678, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 566, 0, 676, 0,
+  982, 0, 0, 0, 0, 0, 0, 697, 0, 0, 0, 206, 0, 0, 490, 0,
+};
+
+const char *WA_FREQ_189_TOKENS[] = {
+  "ni",
+  "ti",
+  "tí",
+  "ní",
+  "ó",
+  "a",
+  "o",
+  "ń",
+  "sí",
+  "je",
+  "àti",
+  "fi",
+  "to",
+  "yìí",
+  "náà",
+  "kan",
+  "awon",
+  "pé",
+  "wa",
+  "àwon",
+  "ati",
+  "si",
+  "fún",
+  "tó",
+  "bi",
+  "se",
+  "won",
+  "sì",
+  "láti",
+  "máa",
+  "bá",
+  "bí",
+  "ara",
+  "nínú",
+  "lo",
+  "kò",
+  "wà",
+  "èdè",
+  "won",
+  "wón",
+  "lati",
+  "n",
+  "pe",
+  "gba",
+  "mo",
+  "fun",
+  "ko",
+  "kí",
+  "di",
+  "ìlú",
+  "àwọn",
+  "re",
+  "se",
+  "gbogbo",
+  "wá",
+  "Ó",
+  "ninu",
+  "ohun",
+  "ló",
+  "le",
+  "jé",
+  "ba",
+  "ènìyàn",
+  "Yorùbá",
+  "lè",
+  "rí",
+  "tún",
+  "wọn",
+  "tàbí",
+  "ki",
+  "jẹ́",
+  "mi",
+  "rè",
+  "n",
+  "A",
+  "ile",
+  "so",
+  "yi",
+  "ṣe",
+  "so",
+  "èyí",
+  "orile-ede",
+  "àwon",
+  "gbé",
+  "ilé",
+  "tabi",
+  "lo",
+  "àwon",
+  "mú",
+  "O",
+  "ibi",
+  "nígbà",
+  "Ní",
+  "e",
+  "omo",
+  "i",
+  "dé",
+  "ju",
+  "ilẹ̀",
+  "í",
+  "nípa",
+  "yóò",
+  "wọ́n",
+  "Àwon",
+  "wón",
+  "se",
+  "ìgbà",
+  "ogun",
+  "òun",
+  "ìtàn",
+  "igba",
+  "wí",
+  "lórí",
+  "ilè",
+  "odun",
+  "Awon",
+  "de",
+  "á",
+  "lori",
+  "awọn",
+  "pa",
+  "ma",
+  "nítorí",
+  "pè",
+  "rẹ̀",
+  "kó",
+  "omo",
+  "ri",
+  "dá",
+  "Ebun",
+  "na",
+  "orin",
+  "osere",
+  "tun",
+  "Ni",
+  "rè",
+  "rè",
+  "eniyan",
+  "mu",
+  "Amerika",
+  "wo",
+  "ilu",
+  "pelu",
+  "gbà",
+  "naa",
+  "maa",
+  "gbólóhùn",
+  "ọmọ",
+  "Bí",
+  "pàtàkì",
+  "isé",
+  "da",
+  "nnkan",
+  "Àwọn",
+  "àdúgbò",
+  "lára",
+  "mìíràn",
+  "Nàìjíríà",
+  "inú",
+  "un",
+  "ayé",
+  "ede",
+  "yí",
+  "Nígbà",
+  "bíi",
+  "eyi",
+  "fa",
+  "je",
+  "wipe",
+  "é",
+  "Ohun",
+  "méjì",
+  "nipa",
+  "ìwé",
+  "béè",
+  "iye",
+  "jé",
+  "Obinrin",
+  "jé",
+  "ojoibi",
+  "yii",
+  "kì",
+  "títí",
+  "Akademi",
+  "lé",
+  "owó",
+  "won",
+  "wón",
+  "Èyí",
+  "be",
+  "eni",
+  "Osere",
+  "jẹ",
+  "kú",
+  "fe",
+  "ojú",
+  "gbe",
+  "oko",
+  "Aare",
+  "hàn",
+  "ise",
+  "lọ",
+  "Naijiria",
+  "akoko",
+  "gege",
+  "orí",
+  "lò",
+  "Yoruba",
+  "òrò",
+  "Odùduwà",
+  "bo",
+  "Mo",
+  "omi",
+  "bàbá",
+  "oba",
+  "àṣẹ",
+  "Gbogbo",
+  "jù",
+  "ò",
+  "ilè",
+  "tele",
+  "Wón",
+  "padà",
+  "Àmì",
+  "ọ̀pá",
+  "eni",
+  "odún",
+  "Èdè",
+  "December",
+  "lo",
+  "gégé",
+  "nkan",
+  "Ìtàn",
+  "Oba",
+  "yio",
+  "Tí",
+  "baba",
+  "miran",
+  "ojo",
+  "pín",
+  "dúró",
+  "kúrò",
+  "olórí",
+  "titi",
+  "ètò",
+  "òní",
+  "Ibujoko",
+  "inu",
+  "mo",
+  "la",
+  "Nínú",
+  "àwon",
+  "ọdún",
+  "jáde",
+  "ori",
+  "ìdí",
+  "irú",
+  "odún",
+  "owo",
+  "Àwon",
+  "Afrika",
+  "ka",
+  "nitori",
+  "oloselu",
+  "egbe",
+  "mó",
+  "orúko",
+  "sọ",
+  "sùgbón",
+  "Òun",
+  "On",
+  "by",
+  "yin",
+  "òkè",
+  "January",
+  "ará",
+  "igi",
+  "ọ̀rọ̀",
+  "aye",
+  "nínu",
+  "wònyí",
+  "ipo",
+  "oruko",
+  "omo",
+  "àkíyèsí",
+  "ìwádìí",
+  "Kò",
+  "ònà",
+  "kankan",
+  "tuntun",
+  "fé",
+  "so",
+  "Ìdí",
+  "ìyá",
+  "Keji",
+  "ijoba",
+  "isé",
+  "Nigeria",
+  "iru",
+  "oyè",
+  "tẹ́lẹ̀",
+  "Àwon",
+  "ìyísódì",
+  "meji",
+  "àsìkò",
+  "eré",
+  "kejì",
+  "leyin",
+  "mò",
+  "of",
+  "pèlú",
+  "2007",
+  "apá",
+  "bere",
+  "gan-an",
+  "ifá",
+  "nì",
+  "po",
+  "wò",
+  "ìyàwó",
+  "ku",
+  "nigba",
+  "pataki",
+  "ra",
+  "Ogun",
+  "báyìí",
+  "larin",
+  "láàrin",
+  "sílè",
+  "Oba",
+  "agbegbe",
+  "má",
+  "Didarajulo",
+  "Re",
+  "sile",
+  "Ile",
+  "gbó",
+  "sugbon",
+  "emi",
+  "fíìmù",
+  "ko",
+  "nìkan",
+  "obinrin",
+  "tán",
+  "Jèsà",
+  "November",
+  "October",
+  "tan",
+  "Ìpínlẹ̀",
+  "Akin",
+  "Ipinle",
+  "Won",
+  "nomba",
+  "sini",
+  "Ìjèbú",
+  "Ìlú",
+  "ńlá",
+  "agbègbè",
+  "apa",
+  "gidi",
+  "obìnrin",
+  "olori",
+  "wáyé",
+  "Ifá",
+  "July",
+  "dó",
+  "nìyí",
+  "àwon",
+  "Ẹ̀bùn",
+  "Gómìnà",
+  "Okùnrin",
+  "yen",
+  "ìjoba",
+  "Agba",
+  "agba",
+  "eto",
+  "lówó",
+  "oòrùn",
+  "Láti",
+  "bèrè",
+  "funfun",
+  "oro",
+  "ta",
+  "Nítorí",
+  "Todarajulo",
+  "ipò",
+  "julo",
+  "kokoro",
+  "kó",
+  "lowo",
+  "mọ",
+  "won",
+  "ìwà",
+  "Ẹ̀gbá",
+  "E",
+  "Olorun",
+  "bẹ́ẹ̀",
+  "ona",
+  "ojó",
+  "àìsàn",
+  "1",
+  "Awọn",
+  "Ifè",
+  "Orile-ede",
+  "Ti",
+  "ipinle",
+  "opo",
+  "pàápàá",
+  "pẹ̀lú",
+  "yàtò",
+  "Bi",
+  "Omo",
+  "Sùgbón",
+  "iwe",
+  "nibi",
+  "níbi",
+  "àlàyé",
+  "2010",
+  "2k",
+  "Fún",
+  "Nobel",
+  "Orímóògùnjé",
+  "Orímóògùnjẹ́",
+  "o.",
+  "sise",
+  "àgbà",
+  "Akádẹ́mì",
+  "Dídárajùlọ",
+  "Osu",
+  "ibe",
+  "ikan",
+  "latowo",
+  "láyé",
+  "pò",
+  "yoo",
+  "Òṣeré",
+  "2",
+  "agbara",
+  "bayi",
+  "ipa",
+  "òrò",
+  "Alakoso",
+  "August",
+  "ilè",
+  "kù",
+  "nigbati",
+  "waye",
+  "yan",
+  "èkó",
+  "òrìsà",
+  "òrò",
+  "òkan",
+  "ao",
+  "díè",
+  "han",
+  "nfa",
+  "oju",
+  "oun",
+  "sele",
+  "wón",
+  "àgbáyé",
+  "àwon",
+  "2009",
+  "Bákan",
+  "February",
+  "kuro",
+  "kékeré",
+  "méjèèjì",
+  "orílè-èdè",
+  "Ìgbà",
+  "èyà",
+  "17",
+  "Wón",
+  "agbára",
+  "awo",
+  "dara",
+  "dúdú",
+  "je",
+  "jo",
+  "koko",
+  "ká",
+  "lilo",
+  "là",
+  "nikan",
+  "osu",
+  "ran",
+  "ìhun",
+  "òwò",
+  "ó",
+  "ero",
+  "ewì",
+  "gun",
+  "ibè",
+  "ibè",
+  "jí",
+  "kìíní",
+  "mọ́",
+  "tì",
+  "ya",
+  "Eyi",
+  "Ilé-Ifè",
+  "May",
+  "Speak",
+  "Wón",
+  "You",
+  "fí",
+  "gbajumo",
+  "ja",
+  "jà",
+  "kókó",
+  "loni",
+  "odo",
+  "opin",
+  "pẹlu",
+  "re",
+  "rẹ",
+  "se",
+  "yo",
+  "yé",
+  "àkókò",
+  "ìlànà",
+  "16",
+  "Gégé",
+  "awon",
+  "bà",
+  "duro",
+  "gẹ́gẹ́",
+  "kún",
+  "ọba",
+  "die",
+  "odún",
+  "ro",
+  "san",
+  "sin",
+  "séèfù",
+  "ye",
+  "òfin",
+  "14",
+  "Benin",
+  "Orí",
+  "aisan",
+  "bii",
+  "fara",
+  "in",
+  "kókó",
+  "méta",
+  "oba",
+  "okan",
+  "pada",
+  "sun",
+  "àrùn",
+  "ònà",
+  "ẹni",
+  "13",
+  "Ajíbógun",
+  "Ilésanmí",
+  "Is",
+  "ariwa",
+  "gbangba",
+  "kìí",
+  "laarin",
+  "míràn",
+  "nip",
+  "ohùn",
+  "Ìkàré",
+  "11",
+  "29",
+  "Ibi",
+  "India",
+  "Leyin",
+  "ewu",
+  "ga",
+  "itan",
+  "kiri",
+  "lara",
+  "lónìí",
+  "orílẹ̀-èdè",
+  "pèlú",
+  "sílè",
+  "òpòlopò",
+  "Ọ̀yọ́",
+  "Ilé",
+  "Ninu",
+  "bèrè",
+  "dára",
+  "jo",
+  "ko",
+  "mimo",
+  "nibe",
+  "púpò",
+  "rárá",
+  "síwájú",
+  "èsìn",
+  "ìjà",
+  "ìlù",
+  "April",
+  "Everybody",
+  "Invited",
+  "N",
+  "September",
+  "igbó",
+  "iku",
+  "lasan",
+  "nnkan",
+  "okun",
+  "orundun",
+  "ojó",
+  "pupo",
+  "sá",
+  "15",
+  "1966",
+  "20",
+  "25",
+  "Fransi",
+  "June",
+  "Lára",
+  "Omo",
+  "aláwò",
+  "anafilasisi",
+  "and",
+  "dáadáa",
+  "eléyìí",
+  "jade",
+  "meta",
+  "mó",
+  "orílè",
+  "orúkọ",
+  "owó",
+  "Èkó",
+  "àbúrò",
+  "èrò",
+  "èka-èdè",
+  "ìbílè",
+  "ìpínlè",
+  "òrìsà",
+  "10",
+  "4",
+  "Ijoba",
+  "Olohun",
+  "gíga",
+  "idije",
+  "méje",
+  "ndun",
+  "odò",
+  "orun",
+  "orúko",
+  "rere",
+  "ye",
+  "Ìjèsà",
+  "ìlà",
+  "ọ̀nà",
+  "12",
+  "1995",
+  "Europe",
+  "Iroyin",
+  "Se",
+  "asa",
+  "atomu",
+  "bode",
+  "dandan",
+  "erú",
+  "guusu",
+  "ipele",
+  "iwoorun",
+  "lowolowo",
+  "lójú",
+  "mó",
+  "parí",
+  "pàdé",
+  "wípé",
+  "yòókù",
+  "Ìbàdàn",
+  "Òyó",
+  "à",
+  "àkókó",
+  "àsà",
+  "ìmò",
+  "ọjọ́",
+  "2006",
+  "Ilésà",
+  "Olominira",
+  "Sugbon",
+  "ayaba",
+  "bèrè",
+  "béè",
+  "eru",
+  "eni",
+  "egbé",
+  "ikú",
+  "iṣẹ́",
+  "kòòkan",
+  "labe",
+  "níbè",
+  "oye",
+  "sínú",
+  "Òra",
+  "èlò",
+  "APOR",
+  "Ara",
+  "Ilé-Ifè",
+  "abi",
+  "eko",
+  "fẹ́",
+  "imo",
+  "jọ",
+  "kà",
+  "káàkiri",
+  "lagbaye",
+  "máà",
+  "ofin",
+  "sa",
+  "tenis",
+  "yá",
+  "èèyàn",
+  "ìran",
+  "ìsòrí",
+  "ẹ̀kọ́",
+  "ọ̀kan",
+  "1976",
+  "2003",
+  "Aye",
+  "Baba",
+  "Brazil",
+  "C",
+  "Gama",
+  "March",
+  "Nov",
+  "an",
+  "asiko",
+  "bee",
+  "dà",
+  "eyin",
+  "fà",
+  "gégé",
+  "kii",
+  "ologun",
+  "oni",
+  "osù",
+  "pèlú",
+  "sinu",
+  "soro",
+  "tilè",
+  "wọ̀nyí",
+  "Àkàngbé",
+  "Òkè",
+  "àgbè",
+  "àríwá",
+  "ìdílé",
+  "19",
+  "Lati",
+  "Léyìn",
+  "eya",
+  "iná",
+  "lu",
+  "miiran",
+  "odidi",
+  "pato",
+  "planeti",
+  "rò",
+  "tèdó",
+  "Èkìtì",
+  "Ìjẹ̀sà",
+  "àpólà",
+  "ìbéèrè",
+  "2008",
+  "23",
+  "American",
+  "Britani",
+  "Do",
+  "Egbe",
+  "Geesi",
+  "Ki",
+  "Ko",
+  "Kí",
+  "Ojú-ìwé",
+  "arun",
+  "awujo",
+  "bakanna",
+  "bu",
+  "bò",
+  "enikan",
+  "gbo",
+  "gbọ́",
+  "gírámà",
+  "ibere",
+  "iwo",
+  "jé",
+  "keji",
+  "kọ",
+  "mí",
+  "mẹ́ta",
+  "npe",
+  "oke",
+  "opolopo",
+  "pàtó",
+  "rìn",
+  "sùgbón",
+  "wo",
+  "wón",
+  "Òjó",
+  "àpeere",
+  "ègbón",
+  "Ọwá",
+  "ọna-ọfun",
+  "31",
+  "Aláàfin",
+  "Grand",
+  "Nigba",
+  "Olódùmarè",
+  "Owá",
+  "Slam",
+  "abo",
+  "apilese",
+  "ayẹwo",
+  "boya",
+  "eyiti",
+  "gbódò",
+  "kọ̀ọ̀kan",
+  "mọ̀",
+  "okunfa",
+  "on",
+  "oogun",
+  "oorun",
+  "pọ̀",
+  "sùgbọ́n",
+  "sùgbón",
+  "yó",
+  "Àkúré",
+  "Ìyá",
+  "Ògún",
+  "èkejì",
+  "ìjọba",
+  "òde",
+  "Ọba",
+  "18",
+  "2005",
+  "24",
+  "3",
+  "7",
+  "Eko",
+  "Emi",
+  "John",
+  "Júpítérì",
+  "Olófìn-íntótó",
+  "School",
+  "Wọ́n",
+  "aami",
+  "aya",
+  "bóyá",
+  "fé",
+  "gidigidi",
+  "ida",
+  "ilaorun",
+  "iwájú",
+  "láàárín",
+  "mò",
+  "nọ́mbà",
+  "ode",
+  "olukowe",
+  "onimo",
+  "ode",
+  "pari",
+  "pé",
+  "tóbi",
+  "Àlàó",
+  "ìmò",
+  "ìró",
+  "òrò",
+  "2011",
+  "26",
+  "5",
+  "Afíríkà",
+  "Gomina",
+  "Irú",
+  "Isé",
+  "be",
+  "dí",
+  "ere",
+  "esin",
+  "ebí",
+  "fe",
+  "fé",
+  "gan",
+  "idi",
+  "kàn",
+  "lábé",
+  "orile",
+  "oríkì",
+  "papa",
+  "rin",
+  "rán",
+  "se",
+  "wonyi",
+  "yàtọ̀",
+  "Àjàpadá",
+  "Ìwé",
+  "àfikún",
+  "àwùjo",
+  "ìwò",
+  "ún",
+  "Allah",
+  "Bakanna",
+  "Bàbá",
+  "Eni",
+  "Jẹ̀ṣà",
+  "Olórí",
+  "Orin",
+  "Williams",
+  "Won",
+  "adé",
+  "filmu",
+  "gbigba",
+  "isé",
+  "jìnnà",
+  "kere",
+  "kúrùpù",
+  "léyìn",
+  "mo",
+  "márùn-ún",
+  "nitoripe",
+  "níbè",
+  "oluilu",
+  "olóyè",
+  "sii",
+  "sílè",
+  "sódì",
+  "te",
+  "the",
+  "tirè",
+  "télè",
+  "wọpọ",
+  "yo",
+  "yọ",
+  "Òyìnbó",
+  "òbí",
+  "òpìtàn",
+  "òyìnbó",
+  "ẹjẹ",
+  "Ọmọ",
+  "1975",
+  "1990",
+  "21",
+  "30",
+  "Agígírì",
+  "Dúró",
+  "Guusu",
+  "Ilu",
+  "Jemani",
+  "The",
+  "Tó",
+  "University",
+  "agbaye",
+  "arin",
+  "bẹ̀rẹ̀",
+  "dun",
+  "dàgbà",
+  "ebi",
+  "erekusu",
+  "f’oju",
+  "ile-ise",
+  "irin",
+  "jé",
+  "lásìkò",
+  "lówó",
+  "lọ́wọ́",
+  "ogún",
+  "osù",
+  "pin",
+  "pò",
+  "sàlàyé",
+  "sòrò",
+  "wu",
+  "wònyí",
+  "Ìjẹ̀bú",
+  "Ìjẹ̀ṣà",
+  "Ìpínlẹ̀ Ọ̀yọ́",
+  "àgbè",
+  "àkọ́kọ́",
+  "ààrin",
+  "òkú",
+  "òdò",
+  "ṣùgbọ́n",
+  "ẸI",
+  "1999",
+  "Alagba",
+  "Asofin",
+  "Ede",
+  "EI",
+  "Fun",
+  "Germany",
+  "Gèésì",
+  "Igi",
+  "Iwo",
+  "Jìjì",
+  "Khoisan",
+  "Odò",
+  "Oogun",
+  "abúlé",
+  "agbo",
+  "ejo",
+};
+const uint16_t WA_FREQ_189_RANKS[] = {
+  0, 833, 153, 422, 0, 0, 57, 491, 0, 0, 0, 698, 0, 0, 0, 0,
+  0, 33, 244, 0, 680, 0, 631, 0, 0, 0, 0, 276, 0, 0, 181, 0,
+  0, 0, 0, 751, 0, 0, 0, 0, 0, 0, 710, 426, 0, 966, 0, 0,
+  850, 110, 0, 0, 67, 621, 0, 0, 0, 750, 562, 0, 0, 0, 489, 0,
+  0, 0, 779, 0, 794, 0, 690, 587, 734, 895, 669, 970, 297, 813, 0, 0,
+  338, 0, 0, 0, 655, 191, 0, 812, 0, 0, 495, 0, 0, 839, 693, 396,
+  0, 0, 0, 0, 0, 0, 183, 0, 907, 0, 0, 0, 148, 258, 0, 0,
+  217, 45, 520, 24, 124, 956, 298, 951, 960, 502, 849, 961, 64, 701, 753, 784,
+  11, 0, 151, 231, 599, 0, 76, 139, 0, 0, 648, 985, 0, 0, 63, 0,
+  807, 0, 0, 169, 926, 102, 219, 632, 21, 738, 405, 0, 188, 112, 444, 977,
+  973, 853, 0, 0, 553, 0, 939, 0, 0, 0, 0, 0, 0, 270, 0, 782,
+  0, 36, 0, 0, 197, 880, 0, 0, 0, 570, 720, 0, 830, 0, 0, 418,
+  848, 792, 0, 0, 0, 0, 319, 0, 909, 0, 0, 0, 896, 947, 546, 643,
+  1000, 705, 0, 0, 0, 186, 0, 0, 450, 0, 0, 0, 329, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 521, 18, 440, 477, 0, 328, 61, 854, 350,
+  421, 918, 0, 0, 0, 996, 387, 331, 712, 968, 84, 288, 330, 706, 0, 0,
+  0, 0, 595, 563, 0, 0, 0, 433, 561, 89, 0, 0, 574, 147, 757, 0,
+  0, 0, 193, 986, 891, 0, 145, 0, 0, 934, 419, 628, 938, 134, 606, 667,
+  976, 0, 0, 0, 348, 776, 798, 0, 0, 0, 700, 0, 309, 0, 581, 756,
+  0, 0, 55, 0, 0, 386, 0, 852, 981, 0, 0, 0, 19, 715, 927, 254,
+  457, 788, 729, 0, 371, 472, 737, 627, 0, 412, 519, 0, 0, 593, 889, 0,
+  0, 719, 0, 0, 764, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 30,
+  355, 886, 0, 825, 484, 0, 0, 626, 0, 682, 0, 0, 343, 229, 638, 0,
+  0, 0, 108, 0, 923, 0, 0, 0, 0, 0, 0, 458, 0, 0, 184, 0,
+  164, 0, 0, 542, 0, 0, 0, 0, 162, 0, 0, 0, 641, 0, 0, 0,
+  373, 0, 0, 0, 453, 0, 0, 317, 0, 429, 0, 0, 0, 0, 0, 0,
+  0, 517, 635, 0, 0, 0, 510, 590, 0, 0, 0, 504, 0, 0, 420, 478,
+  929, 624, 496, 6, 566, 636, 326, 713, 765, 969, 0, 97, 118, 211, 466, 165,
+  475, 778, 0, 79, 226, 0, 0, 534, 204, 0, 0, 0, 312, 314, 689, 735,
+  0, 0, 0, 46, 0, 0, 564, 0, 0, 0, 843, 0, 0, 903, 0, 59,
+  417, 0, 109, 950, 0, 0, 0, 0, 997, 0, 0, 0, 877, 899, 506, 0,
+  0, 0, 0, 0, 0, 959, 121, 524, 243, 859, 928, 302, 140, 398, 634, 916,
+  560, 0, 0, 0, 0, 253, 0, 0, 0, 0, 334, 171, 0, 0, 0, 85,
+  0, 0, 0, 0, 0, 44, 467, 0, 12, 605, 0, 508, 284, 435, 413, 832,
+  0, 0, 671, 507, 694, 781, 0, 948, 0, 0, 0, 658, 0, 0, 375, 0,
+  182, 649, 333, 0, 0, 0, 351, 0, 780, 0, 311, 0, 0, 725, 0, 0,
+  142, 527, 342, 32, 0, 0, 0, 819, 0, 50, 0, 0, 0, 0, 0, 42,
+  0, 28, 0, 0, 525, 0, 0, 0, 0, 0, 0, 0, 327, 0, 0, 0,
+  214, 531, 0, 0, 818, 989, 0, 0, 490, 0, 201, 385, 0, 529, 389, 354,
+  0, 0, 572, 259, 0, 0, 0, 0, 0, 732, 0, 588, 0, 0, 0, 662,
+  0, 0, 0, 539, 982, 0, 200, 411, 69, 653, 785, 967, 0, 754, 0, 87,
+  0, 0, 454, 664, 476, 0, 0, 0, 600, 0, 0, 826, 0, 0, 4, 0,
+  0, 0, 0, 633, 131, 189, 228, 364, 442, 471, 603, 132, 2, 660, 696, 912,
+  0, 0, 0, 730, 766, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 703, 924, 91, 0, 0, 83, 0, 0, 0, 0, 0, 0, 37, 0,
+  0, 282, 0, 416, 704, 0, 0, 858, 0, 0, 0, 0, 0, 480, 990, 0,
+  842, 844, 240, 0, 275, 0, 0, 0, 0, 222, 0, 0, 0, 29, 17, 439,
+  727, 670, 38, 410, 464, 925, 0, 0, 0, 0, 293, 0, 991, 0, 105, 52,
+  324, 0, 0, 0, 0, 530, 724, 0, 414, 811, 0, 512, 697, 799, 0, 368,
+  0, 0, 0, 408, 167, 99, 281, 187, 345, 796, 0, 202, 0, 0, 130, 469,
+  0, 7, 49, 81, 695, 246, 760, 747, 864, 460, 0, 0, 0, 902, 0, 0,
+  0, 35, 0, 0, 0, 0, 810, 434, 65, 487, 613, 763, 806, 675, 374, 783,
+  943, 0, 740, 893, 0, 0, 0, 0, 0, 0, 988, 95, 272, 612, 0, 393,
+  0, 545, 0, 0, 0, 0, 370, 708, 0, 213, 0, 637, 0, 0, 300, 136,
+  0, 0, 0, 103, 0, 742, 10, 0, 0, 709, 0, 175, 791, 0, 96, 394,
+  0, 0, 0, 0, 459, 557, 210, 770, 493, 221, 223, 70, 378, 623, 721, 795,
+  919, 731, 0, 498, 0, 0, 225, 0, 0, 0, 0, 0, 230, 0, 73, 0,
+  672, 0, 0, 0, 728, 987, 565, 0, 285, 0, 0, 0, 0, 0, 0, 0,
+  227, 744, 436, 0, 733, 0, 358, 568, 0, 0, 0, 0, 16, 185, 0, 0,
+  0, 946, 359, 479, 470, 535, 0, 443, 0, 809, 0, 0, 0, 0, 831, 0,
+  602, 249, 92, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  485, 376, 914, 0, 150, 0, 652, 0, 0, 0, 194, 3, 0, 0, 0, 0,
+  978, 40, 383, 430, 607, 322, 549, 261, 447, 647, 803, 917, 407, 25, 585, 838,
+  196, 208, 906, 936, 940, 347, 678, 984, 0, 116, 0, 5, 0, 129, 0, 0,
+  257, 523, 802, 404, 0, 601, 829, 971, 0, 54, 0, 0, 127, 965, 137, 0,
+  0, 999, 769, 571, 687, 51, 86, 0, 0, 247, 427, 790, 921, 0, 178, 362,
+  428, 304, 0, 0, 0, 180, 591, 953, 0, 0, 262, 913, 0, 128, 68, 380,
+  516, 894, 168, 424, 465, 962, 0, 381, 384, 0, 0, 0, 0, 910, 541, 0,
+  340, 0, 9, 242, 323, 361, 473, 540, 154, 745, 0, 0, 0, 31, 115, 548,
+  610, 0, 0, 90, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 160,
+  0, 74, 536, 0, 22, 995, 0, 856, 310, 0, 0, 0, 232, 0, 509, 868,
+  0, 575, 0, 306, 714, 822, 0, 0, 0, 120, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 674, 114, 901, 0, 301, 0, 963, 0, 0, 0, 0, 0,
+  0, 280, 567, 104, 0, 0, 0, 0, 835, 207, 0, 117, 589, 462, 673, 0,
+  107, 192, 726, 481, 305, 723, 800, 866, 111, 251, 399, 77, 815, 159, 616, 615,
+  640, 646, 875, 316, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  449, 0, 555, 0, 0, 0, 974, 0, 20, 0, 0, 528, 0, 0, 0, 264,
+  0, 126, 216, 291, 82, 315, 403, 681, 688, 576, 0, 0, 0, 0, 0, 106,
+  550, 0, 0, 0, 0, 0, 0, 0, 0, 772, 0, 611, 515, 335, 650, 0,
+  657, 0, 0, 904, 0, 0, 0, 0, 0, 0, 0, 0, 122, 816, 0, 761,
+  0, 0, 0, 172, 0, 773, 0, 0, 0, 488, 0, 992, 0, 583, 0, 497,
+  758, 468, 0, 0, 455, 307, 157, 892, 349, 768, 972, 0, 0, 935, 177, 0,
+  163, 0, 0, 0, 0, 0, 461, 0, 0, 0, 876, 0, 0, 0, 0, 846,
+  0, 0, 0, 890, 814, 837, 0, 0, 0, 156, 746, 0, 0, 666, 0, 41,
+  289, 432, 526, 980, 198, 344, 614, 287, 677, 937, 0, 617, 0, 0, 0, 0,
+  711, 0, 0, 0, 0, 0, 0, 321, 239, 0, 308, 717, 0, 296, 0, 53,
+  78, 437, 979, 0, 0, 0, 0, 195, 0, 406, 0, 0, 582, 0, 0, 88,
+  0, 0, 0, 0, 691, 0, 0, 0, 855, 0, 0, 39, 14, 336, 0, 0,
+  0, 357, 762, 654, 0, 0, 0, 220, 0, 0, 441, 0, 789, 661, 0, 401,
+  0, 0, 930, 0, 0, 62, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 954, 0, 190, 0, 0, 513, 0, 0, 580, 0, 551, 0, 0,
+  0, 0, 0, 0, 0, 144, 292, 72, 299, 598, 0, 0, 0, 255, 269, 659,
+  0, 0, 0, 0, 0, 0, 23, 0, 805, 318, 0, 241, 0, 0, 0, 596,
+  0, 0, 0, 176, 0, 8, 0, 0, 0, 0, 0, 0, 425, 552, 0, 0,
+  0, 0, 0, 271, 445, 871, 975, 882, 58, 683, 0, 0, 0, 360, 179, 0,
+  0, 15, 0, 0, 0, 686, 0, 578, 0, 66, 881, 0, 0, 604, 0, 0,
+  804, 865, 824, 397, 841, 47, 0, 522, 203, 0, 0, 0, 125, 867, 0, 0,
+  0, 474, 0, 0, 665, 547, 932, 0, 0, 0, 0, 0, 0, 0, 931, 0,
+  0, 964, 900, 618, 0, 0, 0, 0, 0, 0, 0, 851, 847, 278, 0, 941,
+  873, 0, 0, 0, 0, 0, 878, 0, 630, 0, 0, 748, 337, 446, 639, 863,
+  0, 933, 862, 0, 0, 556, 0, 0, 0, 0, 0, 0, 205, 266, 0, 0,
+  388, 625, 0, 0, 0, 0, 0, 786, 0, 874, 0, 0, 245, 0, 26, 431,
+  0, 0, 0, 0, 0, 0, 0, 0, 409, 532, 0, 0, 584, 0, 0, 644,
+  0, 60, 0, 94, 538, 0, 0, 367, 415, 273, 743, 0, 887, 0, 0, 0,
+  0, 369, 0, 0, 0, 884, 123, 0, 0, 0, 793, 0, 0, 0, 100, 238,
+  277, 0, 0, 828, 75, 339, 135, 286, 905, 0, 0, 994, 482, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 80, 0, 146, 492, 279, 0, 0, 0,
+  0, 872, 0, 609, 0, 586, 915, 27, 313, 949, 0, 0, 879, 0, 0, 777,
+  392, 869, 771, 438, 119, 295, 303, 170, 382, 702, 341, 13, 174, 267, 692, 365,
+  736, 0, 283, 656, 0, 48, 0, 0, 722, 0, 0, 0, 0, 0, 537, 993,
+  0, 622, 448, 0, 0, 499, 642, 0, 236, 834, 0, 0, 0, 363, 0, 573,
+  0, 0, 0, 597, 0, 699, 808, 0, 0, 456, 0, 0, 0, 0, 922, 0,
+  0, 0, 0, 0, 377, 256, 260, 503, 494, 620, 0, 166, 352, 0, 0, 0,
+  0, 0, 0, 0, 518, 0, 0, 265, 0, 1, 0, 0, 206, 233, 212, 716,
+  452, 821, 897, 955, 594, 619, 501, 0, 0, 235, 741, 755, 463, 0, 0, 0,
+  676, 707, 141, 390, 749, 767, 0, 645, 592, 668, 870, 0, 0, 0, 0, 0,
+  379, 0, 0, 0, 559, 209, 0, 294, 0, 860, 237, 0, 0, 0, 0, 372,
+  0, 0, 0, 0, 857, 0, 0, 0, 0, 0, 0, 0, 0, 0, 113, 173,
+  500, 942, 0, 0, 952, 759, 0, 0, 56, 0, 883, 155, 861, 366, 274, 0,
+  0, 0, 0, 356, 885, 0, 143, 514, 332, 998, 250, 486, 152, 629, 93, 252,
+  263, 774, 801, 0, 0, 0, 0, 98, 944, 775, 983, 787, 101, 161, 43, 836,
+  0, 346, 505, 0, 718, 679, 0, 558, 0, 0, 423, 554, 797, 224, 0, 0,
+  0, 320, 0, 0, 34, 133, 663, 395, 685, 138, 544, 391, 0, 0, 0, 608,
+  0, 0, 353, 579, 215, 898, 0, 0, 533, 569, 840, 268, 888, 402, 290, 248,
+  920, 958, 0, 945, 0, 0, 0, 820, 325, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 684, 483, 0, 0, 577, 0, 0, 817, 0, 400,
+  651, 752, 845, 0, 0, 911, 0, 823, 0, 0, 158, 827, 0, 0, 149, 71,
+  0, 0, 0, 739, 511, 543, 908, 0, 0, 451, 957, 0, 199, 234, 0, 218,
+};
+
+const char *WA_FREQ_190_TOKENS[] = {
+  "dwg",
+  "cib",
+  "beij",
+  "aen",
+  "youq",
+  "miz",
+  "caeuq",
+  "hung",
+  "swhyienzsoq",
+  "bak",
+  "nyaeq",
+  "de",
+  "nienz",
+  "sam",
+  "cungj",
+  "De",
+  "seiq",
+  "caet",
+  "haj",
+  "bat",
+  "gouj",
+  "Bak",
+  "loeg",
+  "ngeih",
+  "guh",
+  "lai",
+  "gij",
+  "vunz",
+  "Cunghgoz",
+  "le",
+  "dih",
+  "goengleix",
+  "bingzfueng",
+  "yungh",
+  "Youq",
+  "Gijgvangj",
+  "neix",
+  "it",
+  "Vah",
+  "lij",
+  "Sawgun",
+  "baenz",
+  "ceiq",
+  "boux",
+  "youz",
+  "Bouxcuengh",
+  "guenj",
+  "guekgya",
+  "heuh",
+  "nyied",
+  "daih",
+  "ndaej",
+  "saw",
+  "Si",
+  "Gvangjsih",
+  "daeuj",
+  "Swcigih",
+  "lingz",
+  "sij",
+  "Yen",
+  "gvi",
+  "dieg",
+  "Gij",
+  "caueq",
+  "daengz",
+  "hag",
+  "mbouj",
+  "doenghduz",
+  "Ngeih",
+  "daengj",
+  "hawj",
+  "heuhguh",
+  "ndaw",
+  "ndeu",
+  "fanh",
+  "seizneix",
+  "Miz",
+  "couh",
+  "doiq",
+  "duzbya",
+  "hauh",
+  "nyinhnaeuz",
+  "Yinzminz",
+  "dengj",
+  "拼音",
+  "Fazgoz",
+  "haujlai",
+  "seng",
+  "Meijgoz",
+  "Gunghozgoz",
+  "Sawndip",
+  "dah",
+  "hix",
+  "lizsij",
+  "vah",
+  "deng",
+  "hoh",
+  "laux",
+  "song",
+  "ciengj",
+  "fatseng",
+  "geij",
+  "gwn",
+  "iq",
+  "rox",
+  "yenzgiu",
+  "yingjyangj",
+  "Seizneix",
+  "aeu",
+  "bae",
+  "biengz",
+  "doenggvaq",
+  "gonq",
+  "haeuj",
+  "maenz",
+  "raemx",
+  "sang",
+  "Aen",
+  "Cunghvaz",
+  "Seiq",
+  "Yinghgoz",
+  "doengh",
+  "gaenq",
+  "gwnz",
+  "seiz",
+  "yozbaij",
+  "1",
+  "4",
+  "5",
+  "7",
+  "8",
+  "Dah",
+  "Haijdai",
+  "Yiednamz",
+  "caemh",
+  "dawz",
+  "dox",
+  "ik",
+  "liux",
+  "raeuz",
+  "sojmiz",
+  "yiengh",
+  "Bat",
+  "Caet",
+  "Gouj",
+  "Haj",
+  "Hozciz",
+  "Loeg",
+  "Sam",
+  "Saw",
+  "baen",
+  "bi",
+  "bya",
+  "duh",
+  "gak",
+  "ok",
+  "sevei",
+  "10",
+  "Cib",
+  "Gungcanjdangj",
+  "Ndaw",
+  "Nditbonj",
+  "Nobel",
+  "Suhlienz",
+  "Yindu",
+  "cidu",
+  "cujyau",
+  "cungh",
+  "cwngci",
+  "dai",
+  "diuz",
+  "dungjci",
+  "faen",
+  "gvaq",
+  "itbuen",
+  "sigi",
+  "yindung",
+  "道教",
+  "6",
+  "Ahlahboz",
+  "Baekging",
+  "Vangz",
+  "Vunz",
+  "baiz",
+  "coenggyau",
+  "daengngoenz",
+  "dang",
+  "ginghci",
+  "guek",
+  "guenfueng",
+  "gunghozgoz",
+  "haenx",
+  "haij",
+  "laebbaenz",
+  "lo",
+  "loih",
+  "minzcuz",
+  "roxnaeuz",
+  "si",
+  "yinghgoz",
+  "youqgaenj",
+  "yozgoh",
+  "13",
+  "18",
+  "Aenvih",
+  "Cungzcoj",
+  "Cwngci",
+  "Doenghduz",
+  "Haij",
+  "Lij",
+  "Yenfanh",
+  "Yindi",
+  "aenvih",
+  "baez",
+  "bienq",
+  "caux",
+  "cujsiz",
+  "daih'it",
+  "danq",
+  "dauj",
+  "fatcanj",
+  "gag",
+  "gohyoz",
+  "gyoengqde",
+  "leu",
+  "liuzyozswngh",
+  "lwg",
+  "monz",
+  "naeuz",
+  "ndi",
+  "sawjyungh",
+  "swyouz",
+  "vunz,gag",
+  "19",
+  "3",
+  "Aij",
+  "Ausf",
+  "Boux",
+  "Doengnamzya",
+  "Fuzdauj",
+  "Isfara",
+  "Neix",
+  "Swci",
+  "Vahvuhswhbiedkez",
+  "Vuhwjduh",
+  "Xiàn",
+  "baugvaq",
+  "bonj",
+  "ciemq",
+  "cienz",
+  "coengz",
+  "daemq",
+  "dengjdengj",
+  "di",
+  "digiuz",
+  "giuznamh",
+  "gvihaeuj",
+  "gwzming",
+  "gyoengde",
+  "hai",
+  "haihij",
+  "lae",
+  "laeng",
+  "lauxsae",
+  "leabbean",
+  "lumj",
+  "mizmingz",
+  "ndei",
+  "raez",
+  "saek",
+  "sinyangj",
+  "veh",
+  "vih",
+  "vuengzdaeq",
+  "vunzlai",
+  "vwnzva",
+  "yinxhwnj",
+  "youh",
+  "11",
+  "12",
+  "2",
+  "20",
+  "9",
+  "Baksaek",
+  "Bi",
+  "Bya",
+  "Caiqlij",
+  "Cancwngh",
+  "Cimhlaeng",
+  "Cuenghhag",
+  "Cungguek",
+  "Cwngfuj",
+  "Daihhag",
+  "Dalai",
+  "Dayoz",
+  "Duzbya",
+  "Ezlozswh",
+  "Gyoengqvunz",
+  "Hanciuz",
+  "Itbuen",
+  "Jodan",
+  "Lozmaj",
+  "Majlaizsihya",
+  "Minzcuj",
+  "Soujduh",
+  "Swahili",
+  "Yacouh",
+  "Yesu",
+  "Youz",
+  "Zìzhìxiàn）gvi",
+  "a",
+  "and",
+  "baihbaek",
+  "baihnamz",
+  "beixnuengx",
+  "bonjgohswngh",
+  "caiqlij",
+  "cancwng",
+  "cancwngh",
+  "cauxbaenz",
+  "cenzhizciq",
+  "cien",
+  "ciengz",
+  "cin",
+  "cingsaenz",
+  "cujyao",
+  "daez",
+  "der",
+  "digih",
+  "dingzlai",
+  "doeklaeng",
+  "doenghgo",
+  "eiqsei",
+  "faex",
+  "gangj",
+  "giz",
+  "gizyawz",
+  "goenghleix",
+  "gojyij",
+  "guhhong",
+  "gunghvei",
+  "gyauqsiz",
+  "haeh",
+  "haehdungj",
+  "haeujvunz",
+  "hong",
+  "iek",
+  "laj",
+  "lenzmungz",
+  "lwgsai",
+  "ma",
+  "mauhgvaq",
+  "mboujdoengz",
+  "moux",
+  "ndaek",
+  "ndang",
+  "ngaiz",
+  "ranz",
+  "seiqgyaiq",
+  "seizdaih",
+  "soujduh",
+  "soujfuj",
+  "vaqhag",
+  "yawj",
+  "yenzgungh",
+  "yienh",
+  "yung",
+  "道",
+  "1949",
+  "2010",
+  "50",
+  "80",
+  "Aigib",
+  "Ausführung",
+  "Austria",
+  "Bazgveiq",
+  "Bohswh",
+  "Cihmeh",
+  "Daengx",
+  "Daj",
+  "Divwnq",
+  "Doeng",
+  "Dohraez",
+  "Dwzgoz",
+  "Fuzsuih",
+  "Ganghgoj",
+  "Gijgvangq",
+  "Gohyoz",
+  "Gonq",
+  "Haeujvunz",
+  "IV",
+  "Liuz",
+  "Majsazcuhsai",
+  "Mauz",
+  "Moq",
+  "Ndoenndok",
+  "Neican",
+  "Newton",
+  "Nozveih",
+  "Oucouh",
+  "Picasso",
+  "Sawcuengh",
+  "Swyouzcujyi",
+  "Vangzsingz、Yuzcaiz",
+  "Vwnzyoz",
+  "Xiàn）gvi",
+  "Yenqsanh",
+  "Yen（",
+  "Yindunizsihya",
+  "baeznaengz",
+  "baih",
+  "bienqbaenz",
+  "bouxmoh",
+  "bujbienq",
+  "canghdajveh",
+  "canjseng",
+  "ciep",
+  "cietyoz",
+  "cihciz",
+  "cij",
+  "cingq",
+  "ciuhgonq",
+  "codaeuz",
+  "cujciz",
+  "cunghgoz",
+  "cungsim",
+  "cunj",
+  "cwngfuj",
+  "cwngzsi",
+  "daej",
+  "daemx",
+  "daepnengq",
+  "daibyauj",
+  "daihngeih",
+  "dairaeg",
+  "daj",
+  "damqcaz",
+  "daqlix",
+  "daujyij",
+  "dayoz",
+  "dep",
+  "doeng",
+  "doengj'it",
+  "doq",
+  "doxdoengz",
+  "duzliz",
+  "fanh(2010",
+  "fuengmienh",
+  "gaemhgaj",
+  "gaijgwz",
+  "gien",
+  "gienzleih",
+  "gihgou",
+  "gimsug",
+  "giuz",
+  "goengqvunz",
+  "goj",
+  "guhbaenz",
+  "gungcanjcujyi",
+  "gunghoz",
+  "gunghswh",
+  "gvei",
+  "gyaj",
+  "gyamwngz",
+  "gyoengq",
+  "haengj",
+  "hatmaenj",
+  "hoeng",
+  "hwnj",
+  "laeb",
+  "leab",
+  "leix",
+  "lingjdauj",
+  "meh",
+  "mehmbwk",
+  "mingz",
+  "minzcuj",
+  "moix",
+  "ndiepdaih",
+  "nienzdaih",
+  "noix",
+  "okbanj",
+  "raixcaix",
+  "riengz",
+  "rin",
+  "rog",
+  "rongh",
+  "saenq",
+  "seiqhenz",
+  "sengj",
+  "sengmingh",
+  "singhaeh",
+  "sozswqyenzgiuqswngh",
+  "vahcoj",
+  "vuengzciuz",
+  "yauqgih,ciemq",
+  "yawjfap",
+  "yijcuz",
+  "yingzcangh",
+  "yozsoh",
+  "yozyen",
+  "1000",
+  "15",
+  "1935",
+  "2000",
+  "2007",
+  "200px",
+  "26",
+  "27",
+  "30",
+  "300px",
+  "Acacia",
+  "Ahkezbah",
+  "Aucouh",
+  "BC",
+  "Baez",
+  "Bahgihswhdanj",
+  "Bahwjgan",
+  "Bonj",
+  "Bouxdaez",
+  "Bouxvot",
+  "Breinigerberg",
+  "Buendauj",
+  "Buzveij",
+  "Caoqcwng",
+  "Ceizraemxrouh",
+  "Cenzgoz",
+  "Coengz",
+  "Cuenghyanghvuengz",
+  "Cunghyangh",
+  "Cwzdungh",
+  "Daengz",
+  "Daeqgoz",
+  "Dai",
+  "Daigoz",
+  "Daihbingz",
+  "Daihbingzyangz",
+  "Dangzciuz",
+  "Digoz",
+  "Doeklaeng",
+  "Doenghgiz",
+  "Gawq",
+  "Geidoekgauq",
+  "Gim",
+  "Giuznamh",
+  "Gyoengqde",
+  "H",
+  "Haijhaek",
+  "Han",
+  "Hanzgoz",
+  "Hezsangh",
+  "Hungary",
+  "Huz",
+  "Huznanz",
+  "Lama",
+  "Lauq",
+  "Linzgenj",
+  "Lozmax",
+  "Mak",
+  "Marx",
+  "Maxwell",
+  "Moksha",
+  "Monz",
+  "Ndigah",
+  "Ndoencag",
+  "New",
+  "Nyeiqswq",
+  "Panzer",
+  "Panzerkampfwagen",
+  "Saiwjveizya",
+  "Sanhcej",
+  "Sawyingh",
+  "Schopenhauer",
+  "Sei",
+  "Sengj",
+  "Sihbanhyaz",
+  "Taranto",
+  "Turkey",
+  "Vahgun",
+  "Veijyenzvei",
+  "Veiyi",
+  "Voltaire",
+  "War",
+  "Wałęsa",
+  "Yangz",
+  "Yauzcuz",
+  "Yijcuz",
+  "Yijhaeh",
+  "Yin-ouh",
+  "Yindu-yajlizan",
+  "Yungh",
+  "baengh",
+  "baengzdaengz",
+  "baenqluxsae",
+  "baenzaen",
+  "bahgungh",
+  "baihdoeng",
+  "baihsae",
+  "baj",
+  "beijbaenz",
+  "bet",
+  "bing",
+  "boh",
+  "bonjfaenh",
+  "bonjgohswngh、sozswqswngh、bozswqyenzgiuswngh",
+  "bouh",
+  "bouxciengqfwen",
+  "bouxdaeuz",
+  "bouxmo",
+  "bouxvunz",
+  "bozswqswngh",
+  "buet",
+  "by",
+  "byoenh",
+  "cangjcauxruz",
+  "ceij",
+  "cibfean",
+  "ciem",
+  "cienmonz",
+  "cijmiz",
+  "cinq",
+  "cinqsiuhswngh",
+  "ciq",
+  "ciusou",
+  "cix",
+  "conhyinq",
+  "copbaenz",
+  "cujyaoq",
+  "cunghyangh",
+  "cungjdungj",
+  "cunh",
+  "daengx",
+  "daih'ngeih",
+  "daixbaj",
+  "dan",
+  "dauq",
+  "dazyinx",
+  "denhdij",
+  "dingz",
+  "doenghgvaq",
+  "doengz",
+  "dohgyu",
+  "doi",
+  "doxdoiqlun",
+  "doxgaiq",
+  "doxlumj",
+  "duz",
+  "dw",
+  "faenbouh",
+  "faenh",
+  "fanh(2009",
+  "fat",
+  "fuengyenz",
+  "fuk",
+  "gaemh",
+  "gaenjmaed",
+  "gaenlaenz",
+  "gaggaj",
+  "gaj",
+  "gauqbaiq",
+  "giekdaej",
+  "gienz",
+  "gig",
+  "gijgvangj",
+  "gijmaz",
+  "ginggvaq",
+  "ginzdauj",
+  "gohyozgya",
+  "gou",
+  "gozgya",
+  "gungcanjdangj",
+  "gungh",
+  "gunghyez",
+  "gungyen",
+  "gvangvuz",
+  "gwnzbiengz",
+  "gya",
+  "gyaeraez",
+  "gyausou",
+  "gyoengqvunz",
+  "haenq",
+  "hah",
+  "haijyaz",
+  "hauq",
+  "he",
+  "heahdoengj",
+  "heiq",
+  "hoenxhingzgoz",
+  "hoiz",
+  "hozbingz",
+  "hozcoz",
+  "hwzdung",
+  "laebbaen",
+  "laebhwnj",
+  "lajbiengz",
+  "lajmbwn",
+  "leabbaenz",
+  "leabean",
+  "leixlun",
+  "leixlwnh",
+  "lisij",
+  "liuzlieng",
+  "lwgminz",
+  "mboujmiz",
+  "monznga",
+  "moq",
+  "naengz",
+  "namz",
+  "ndaundeiqbyaij",
+  "nengz",
+  "ngeihgaep",
+  "ngoenz",
+  "nyamhcij",
+  "okseng",
+  "rinmaeg",
+  "romh",
+  "sae",
+  "saedhengz",
+  "saehgienh",
+  "sawcuenh",
+  "seveicujyi",
+  "sigij",
+  "sim",
+  "sing",
+  "singzsi",
+  "soengq",
+  "sojyij",
+  "swhsiengj",
+  "swngj",
+  "vaiq",
+  "veiyenz",
+  "vuengzvih",
+  "vwnzmingz",
+  "yawjnaek",
+  "yendai",
+  "yendaih",
+  "yenhgiu",
+  "yiengq",
+  "yienzleix",
+  "yijcih",
+  "yijyenz",
+  "yinzminz",
+  "yisuz",
+  "yiyi",
+  "yozsuz",
+  "yozswngh",
+  "yungq",
+  "yungzheih",
+  "yw",
+  "yáozú",
+  "1.42",
+  "100",
+  "14",
+  "1687",
+  "17,075,400",
+  "1700",
+  "1861",
+  "1902",
+  "1911",
+  "1913",
+  "1919",
+  "1921",
+  "1939",
+  "1954",
+  "1955",
+  "196",
+  "1966",
+  "1967",
+  "1969",
+  "1980",
+  "1990",
+  "1991",
+  "1994",
+  "200",
+  "2003",
+  "2006",
+  "200pxIsaac",
+  "200pxOliver",
+  "200pxYiednamz",
+  "2012",
+  "21",
+  "24",
+  "28000",
+  "400",
+  "4000",
+  "422",
+  "5500",
+  "60",
+  "60%",
+  "6000",
+  "70",
+  "8.6%",
+  "83",
+  "A.",
+  "Adolf",
+  "Ahlahbozsugyauh",
+  "Aiwjlanzdauj",
+  "Alighieri",
+  "Armstrong",
+  "Audahleihya",
+  "Audaihleihya",
+  "Baek'iek",
+  "Bahswqlah",
+  "Baihnanz",
+  "Bakvied",
+  "Baltic",
+  "Bantu",
+  "Beethoven",
+  "Bering",
+  "Betgveiq",
+  "Bienhcingqfap",
+  "Bouxgun",
+  "Bouxmienh",
+  "Bouxmohlaujcuz",
+  "Bwzgingh",
+  "Caeuq",
+  "Can",
+  "Caoqcwng(赵政",
+  "Cauqgoz",
+  "Cauzsenh",
+  "Cengfuj",
+  "Cijranz",
+  "Cin",
+  "Cingsaenz",
+  "Coh",
+  "Cromwell",
+  "Cuengh",
+  "Cujyau",
+  "Cunghsigij",
+  "Cunghya",
+  "Cwngciyoz",
+  "Cwzyoz",
+  "D.",
+  "Daegoz",
+  "Daekgoz",
+  "Daengxgoz",
+  "Dahcangzgyangh",
+  "Dahcingh",
+  "Daibiuj",
+  "Daih'it",
+  "Daiqgwzwj",
+  "Daizvanh",
+  "Dante",
+  "Davei",
+  "Denhdwngj",
+  "Denyouz",
+  "Der",
+  "Diegguek",
+  "Dien'anmaenz",
+  "Dienguek",
+  "Dienhcwngz",
+  "Doengh",
+  "Doengouh",
+  "Doengzseiz",
+  "Doujduh",
+  "Dujwjgiz",
+  "Dunghlanz",
+  "Duzroeg",
+  "Eiqdaihleih",
+  "Elizabeth",
+  "F",
+  "Fennic",
+  "Ford",
+  "Fouzcwngfujcujyi",
+  "Freiburg",
+  "Freud",
+  "Fueng'an",
+  "Gaengawq",
+  "Gaenq",
+  "Gizdoh",
+  "Goengqvunz",
+  "Greek",
+  "Guj",
+  "Gujbah",
+  "Gungcanjcujyi",
+  "Gungjcij",
+  "Guǎngxī",
+  "Gvangyi)cihsiz",
+  "Gveiqlinz",
+  "Gwzdanswgwz",
+  "Gwzlujgizya",
+  "Gyah",
+  "Gyaz",
+  "Gyoengde",
+  "Gyongqde",
+  "Haekhaij",
+  "Haijbaz",
+  "Hekgya",
+  "Hoeng",
+  "Hojceh",
+  "Hopetoun",
+  "Hoysala",
+  "Hungz",
+  "Hwzlungzgyangh",
+  "I",
+  "ISBN",
+  "James",
+  "Jingzjing",
+  "Lahdinh",
+  "Laj",
+  "Lamanites",
+  "Lao",
+  "Laoq",
+  "Leopold",
+  "Lhamo",
+  "Lienzbangh",
+  "Lijhaij",
+  "Lozcwngz",
+  "Lun",
+  "Lungzcouh",
+  "Mbwnnamh",
+  "Minzgoz",
+  "Monznga",
+  "Movowj",
+  "Mwh",
+  "Namzbaej",
+  "Nanzfei",
+  "Ndang",
+  "Ndaundeiqsauqbaet",
+  "Ndei",
+  "Ndoengfaex",
+  "Newspaper",
+  "Nizbozwj",
+  "Nizgujdingh",
+  "Non",
+  "Norge",
+  "Norway",
+  "Nozbeiwj",
+  "October",
+  "Okhotsk",
+  "Opium",
+  "Ouhmungz",
+  "Paracel",
+  "Pasteur",
+  "Publishing",
+  "Queen",
+  "Raemxgiengh",
+  "Raemxmaeg",
+  "Raeuz",
+  "Ranzsaw",
+  "Rin",
+  "Roegga",
+  "Ruidenj",
+  "Ruiz",
+  "Ružička",
+  "Saami",
+  "Saelanz",
+  "Saen",
+  "Sang",
+  "Sawmingz",
+  "Schlangenberg",
+  "Schlomo",
+  "Seiqgaiq",
+  "Seiz",
+  "Seizde",
+  "Seng",
+  "Sihcang",
+  "Sinhaih",
+  "Sinhcuz",
+  "Sinhgyangh",
+  "Song",
+  "Stolberg",
+  "Sunhvuenz",
+  "Sweden",
+  "Swhfan",
+  "Swngjvei",
+  "The",
+  "Tiagpaen",
+  "Vahcoh",
+  "Vahcuengh",
+  "Vahnizbozwj",
+  "Vahtuj",
+  "Vaizcwx",
+  "Vangzsingz",
+  "Veh",
+  "Veiz",
+  "Veizgiek",
+  "Volga",
+  "Vuengz",
+  "Vuengzguek",
+  "Vujdaeq",
+  "Wolfgang",
+  "Yahben",
+  "Yenzgiu",
+  "Yenzlaiz",
+  "Yihsihlanzgauq",
+  "Yijcih",
+  "Yijheah",
+  "Yilangj",
+  "Yindu-yajlizanh",
+  "Yindu-yihlangj",
+  "Yindung",
+  "Yinzvwnz",
+  "Yinzvwnzcujyi",
+  "Yizbwnj",
+  "aen'vih",
+  "aiqgozyindung",
+  "baek",
+  "baenzdong",
+  "baenzmaz",
+};
+const uint16_t WA_FREQ_190_RANKS[] = {
+  0, 0, 0, 244, 0, 858, 0, 0, 0, 0, 0, 0, 609, 695, 669, 0,
+  0, 309, 831, 194, 0, 0, 0, 343, 165, 632, 787, 955, 547, 0, 58, 182,
+  24, 404, 752, 770, 209, 815, 927, 977, 855, 0, 471, 628, 698, 0, 0, 0,
+  0, 800, 738, 0, 0, 0, 349, 939, 920, 0, 0, 0, 461, 0, 0, 0,
+  0, 760, 0, 0, 0, 0, 161, 174, 735, 865, 0, 43, 0, 0, 0, 0,
+  414, 0, 0, 0, 553, 23, 240, 463, 627, 651, 802, 53, 0, 130, 184, 465,
+  44, 0, 0, 454, 713, 970, 734, 827, 286, 879, 0, 241, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 586, 406, 468, 514, 589, 712, 554, 537, 570, 0,
+  136, 238, 0, 673, 0, 0, 642, 0, 363, 19, 104, 466, 826, 0, 835, 0,
+  119, 0, 0, 426, 933, 0, 646, 270, 516, 998, 0, 0, 0, 0, 0, 521,
+  0, 0, 273, 0, 0, 26, 197, 718, 388, 0, 0, 0, 0, 0, 0, 0,
+  566, 0, 0, 714, 0, 0, 0, 391, 0, 775, 483, 284, 117, 0, 742, 370,
+  169, 603, 759, 0, 0, 953, 619, 0, 0, 0, 0, 924, 0, 0, 804, 0,
+  0, 0, 0, 0, 859, 400, 0, 0, 0, 0, 411, 135, 0, 233, 6, 440,
+  0, 0, 780, 761, 72, 507, 548, 840, 0, 0, 331, 0, 259, 0, 878, 684,
+  102, 134, 163, 598, 0, 664, 0, 0, 0, 180, 0, 0, 0, 0, 150, 563,
+  0, 0, 499, 0, 0, 638, 965, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  837, 211, 0, 200, 488, 0, 220, 0, 339, 0, 120, 362, 600, 971, 0, 833,
+  0, 107, 576, 442, 474, 764, 0, 0, 0, 0, 0, 0, 75, 383, 0, 0,
+  0, 0, 0, 467, 993, 214, 0, 0, 0, 847, 0, 2, 836, 175, 0, 352,
+  268, 540, 624, 0, 0, 0, 817, 0, 385, 957, 0, 0, 0, 0, 944, 487,
+  0, 0, 417, 0, 830, 886, 306, 773, 0, 0, 0, 0, 436, 76, 653, 490,
+  0, 0, 346, 141, 0, 0, 360, 0, 0, 909, 0, 0, 0, 0, 0, 28,
+  824, 0, 655, 298, 0, 342, 0, 808, 0, 0, 0, 907, 0, 95, 0, 301,
+  0, 699, 0, 0, 0, 0, 0, 8, 0, 0, 151, 0, 0, 0, 0, 0,
+  0, 602, 751, 0, 0, 290, 371, 201, 82, 221, 293, 157, 774, 964, 0, 0,
+  66, 0, 0, 88, 81, 0, 55, 0, 0, 0, 307, 0, 0, 0, 69, 0,
+  634, 501, 0, 279, 158, 227, 311, 336, 622, 792, 230, 972, 228, 573, 0, 0,
+  0, 260, 649, 919, 0, 0, 0, 0, 0, 721, 0, 0, 106, 506, 908, 903,
+  936, 412, 0, 0, 125, 922, 611, 0, 678, 0, 0, 0, 694, 729, 768, 0,
+  599, 0, 0, 57, 181, 0, 0, 0, 0, 0, 0, 431, 716, 0, 799, 568,
+  73, 198, 0, 0, 0, 0, 196, 155, 580, 164, 0, 0, 0, 11, 137, 980,
+  0, 0, 0, 861, 0, 0, 0, 0, 348, 806, 222, 0, 0, 0, 661, 999,
+  0, 168, 0, 902, 0, 854, 0, 0, 0, 890, 0, 0, 772, 0, 0, 278,
+  148, 895, 0, 966, 0, 700, 925, 942, 631, 0, 0, 0, 0, 0, 78, 0,
+  121, 0, 0, 0, 870, 828, 0, 0, 0, 987, 0, 0, 0, 706, 0, 876,
+  0, 0, 0, 13, 0, 934, 0, 0, 425, 437, 0, 683, 812, 0, 0, 0,
+  0, 0, 899, 80, 0, 0, 0, 0, 880, 0, 758, 798, 578, 0, 528, 0,
+  0, 533, 0, 0, 167, 217, 246, 445, 704, 0, 380, 0, 156, 0, 4, 556,
+  692, 249, 887, 961, 476, 0, 779, 0, 877, 0, 856, 0, 0, 0, 432, 0,
+  517, 989, 0, 0, 42, 0, 326, 285, 0, 0, 0, 0, 458, 952, 0, 0,
+  0, 0, 0, 0, 0, 0, 530, 0, 0, 0, 0, 177, 0, 0, 325, 327,
+  402, 486, 265, 101, 0, 304, 0, 917, 274, 565, 0, 0, 0, 0, 0, 358,
+  489, 663, 0, 560, 0, 658, 0, 0, 0, 0, 0, 433, 60, 0, 0, 0,
+  0, 0, 0, 0, 319, 0, 0, 0, 171, 931, 313, 0, 0, 0, 243, 723,
+  89, 0, 0, 0, 459, 975, 70, 978, 0, 0, 71, 0, 479, 397, 584, 359,
+  0, 645, 949, 0, 0, 626, 615, 672, 710, 0, 0, 0, 0, 478, 567, 0,
+  0, 0, 0, 582, 34, 0, 0, 0, 538, 0, 52, 0, 0, 0, 0, 0,
+  0, 0, 523, 361, 592, 674, 747, 98, 857, 83, 146, 5, 956, 0, 0, 0,
+  0, 0, 0, 0, 430, 356, 403, 0, 0, 766, 0, 954, 0, 0, 0, 607,
+  709, 254, 0, 0, 0, 765, 105, 544, 681, 86, 409, 872, 985, 637, 0, 0,
+  0, 195, 795, 0, 0, 0, 0, 0, 45, 711, 512, 510, 519, 210, 332, 29,
+  707, 719, 807, 496, 186, 452, 867, 460, 916, 923, 943, 613, 282, 0, 398, 0,
+  0, 0, 300, 0, 0, 0, 0, 94, 0, 677, 0, 128, 888, 0, 367, 421,
+  0, 928, 0, 0, 0, 693, 822, 969, 811, 0, 850, 0, 838, 0, 0, 0,
+  0, 0, 492, 625, 0, 801, 860, 261, 605, 984, 443, 0, 0, 0, 0, 0,
+  849, 0, 0, 0, 0, 345, 368, 422, 31, 0, 818, 559, 18, 0, 477, 0,
+  264, 350, 668, 330, 111, 0, 0, 574, 0, 0, 542, 551, 236, 853, 680, 558,
+  834, 864, 883, 958, 0, 0, 0, 0, 0, 0, 739, 99, 103, 176, 717, 898,
+  0, 0, 0, 484, 0, 90, 216, 0, 415, 803, 0, 0, 0, 0, 0, 0,
+  439, 0, 7, 318, 505, 744, 0, 17, 0, 328, 310, 0, 0, 118, 0, 0,
+  205, 0, 183, 606, 0, 0, 280, 0, 0, 0, 0, 884, 0, 0, 0, 387,
+  0, 170, 652, 33, 450, 820, 256, 257, 491, 722, 995, 0, 0, 152, 235, 502,
+  809, 0, 500, 317, 743, 522, 929, 0, 0, 832, 0, 0, 0, 0, 0, 0,
+  845, 0, 0, 675, 0, 375, 0, 0, 0, 0, 382, 54, 97, 545, 272, 561,
+  741, 0, 85, 275, 231, 379, 748, 160, 0, 0, 215, 143, 0, 0, 96, 0,
+  529, 0, 0, 0, 0, 0, 0, 0, 0, 47, 190, 202, 778, 62, 341, 229,
+  682, 316, 769, 852, 0, 0, 0, 0, 0, 866, 35, 951, 962, 0, 0, 671,
+  0, 84, 289, 679, 0, 0, 237, 248, 821, 138, 988, 790, 100, 503, 583, 823,
+  0, 708, 0, 266, 0, 0, 0, 0, 0, 557, 0, 0, 438, 0, 0, 0,
+  303, 594, 630, 0, 199, 308, 369, 524, 897, 67, 271, 93, 145, 930, 0, 247,
+  873, 0, 0, 144, 0, 0, 0, 372, 0, 0, 0, 0, 0, 51, 968, 0,
+  740, 0, 0, 0, 0, 0, 364, 689, 0, 659, 0, 0, 749, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 204, 0, 0, 12, 894, 0, 0, 0,
+  0, 0, 819, 912, 0, 242, 224, 543, 648, 703, 947, 315, 0, 0, 0, 0,
+  0, 0, 0, 384, 0, 122, 253, 715, 91, 179, 990, 0, 0, 0, 0, 0,
+  0, 0, 810, 869, 276, 324, 0, 793, 0, 0, 0, 0, 0, 0, 0, 418,
+  535, 0, 376, 536, 354, 829, 885, 900, 905, 0, 0, 0, 0, 0, 0, 0,
+  38, 480, 0, 0, 0, 0, 0, 0, 0, 0, 494, 767, 0, 0, 0, 0,
+  0, 287, 0, 0, 0, 762, 0, 374, 213, 408, 115, 593, 351, 0, 851, 0,
+  0, 469, 428, 534, 755, 982, 0, 763, 0, 757, 0, 0, 513, 796, 0, 0,
+  377, 162, 0, 601, 0, 0, 0, 0, 0, 0, 635, 0, 0, 0, 997, 0,
+  0, 0, 745, 983, 531, 0, 448, 355, 457, 868, 0, 334, 322, 892, 0, 283,
+  495, 10, 667, 485, 0, 782, 0, 0, 0, 926, 27, 0, 0, 0, 846, 333,
+  320, 786, 0, 0, 0, 915, 0, 0, 0, 656, 444, 0, 0, 0, 0, 456,
+  590, 147, 641, 416, 504, 277, 0, 0, 87, 0, 633, 0, 0, 0, 0, 281,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 419, 579, 423, 0, 640,
+  357, 572, 0, 0, 0, 595, 0, 0, 0, 0, 0, 0, 0, 0, 0, 395,
+  0, 0, 0, 0, 0, 0, 0, 65, 0, 0, 0, 901, 777, 981, 0, 127,
+  449, 621, 0, 0, 0, 0, 0, 948, 0, 0, 226, 789, 0, 0, 0, 0,
+  0, 0, 0, 0, 670, 0, 0, 750, 843, 340, 921, 0, 959, 0, 0, 0,
+  0, 639, 737, 131, 110, 299, 0, 0, 0, 0, 0, 0, 805, 0, 0, 0,
+  0, 378, 539, 733, 0, 0, 394, 321, 0, 0, 0, 0, 0, 0, 386, 688,
+  0, 0, 0, 49, 791, 0, 0, 974, 0, 643, 0, 1000, 0, 255, 0, 0,
+  64, 0, 0, 129, 0, 337, 0, 338, 0, 424, 441, 862, 555, 258, 288, 189,
+  0, 192, 9, 705, 650, 0, 945, 139, 113, 373, 392, 123, 527, 569, 720, 32,
+  0, 0, 596, 0, 0, 660, 784, 0, 0, 546, 0, 0, 250, 0, 297, 0,
+  960, 0, 994, 482, 0, 63, 159, 0, 20, 0, 59, 149, 296, 0, 37, 0,
+  0, 0, 0, 0, 0, 263, 0, 996, 0, 0, 399, 0, 736, 0, 0, 771,
+  875, 25, 0, 206, 687, 871, 0, 0, 756, 963, 562, 986, 0, 252, 0, 0,
+  597, 612, 585, 881, 413, 783, 0, 0, 1, 591, 904, 393, 526, 932, 0, 0,
+  68, 891, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 728, 564, 0, 14,
+  0, 0, 0, 520, 913, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 30, 239, 245, 746, 730, 753, 608, 434, 0, 407, 116, 79, 0, 294, 191,
+  366, 0, 40, 0, 0, 0, 918, 0, 0, 109, 292, 56, 77, 389, 114, 39,
+  497, 581, 732, 841, 0, 0, 666, 973, 604, 269, 950, 0, 0, 0, 0, 0,
+  142, 185, 208, 935, 0, 22, 0, 420, 662, 0, 941, 0, 188, 0, 0, 0,
+  498, 842, 0, 0, 0, 0, 16, 967, 0, 0, 0, 481, 727, 0, 0, 848,
+  0, 0, 0, 0, 0, 0, 36, 225, 893, 0, 0, 0, 41, 906, 0, 0,
+  154, 0, 0, 0, 0, 0, 0, 0, 696, 0, 0, 0, 0, 636, 0, 0,
+  0, 0, 0, 552, 0, 223, 475, 0, 0, 0, 0, 0, 0, 0, 0, 550,
+  0, 0, 0, 0, 0, 0, 314, 676, 724, 405, 813, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 940, 462, 657, 453, 312, 0, 0, 61, 816, 910, 644, 251,
+  0, 0, 429, 647, 785, 0, 347, 219, 435, 726, 173, 797, 410, 946, 455, 588,
+  0, 0, 353, 0, 0, 0, 0, 0, 0, 0, 617, 153, 464, 0, 0, 731,
+  234, 509, 21, 665, 937, 291, 979, 451, 508, 473, 620, 0, 549, 0, 0, 0,
+  0, 401, 0, 614, 702, 140, 839, 0, 178, 344, 518, 0, 0, 0, 0, 825,
+  0, 532, 0, 0, 0, 0, 0, 0, 396, 0, 697, 725, 788, 0, 0, 0,
+  0, 781, 381, 914, 0, 232, 3, 0, 0, 267, 0, 0, 470, 629, 882, 0,
+  0, 112, 193, 0, 295, 335, 0, 0, 0, 132, 690, 0, 0, 685, 218, 623,
+  212, 126, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 305,
+  515, 654, 992, 166, 991, 776, 0, 0, 541, 587, 616, 203, 618, 863, 0, 0,
+  262, 976, 0, 0, 0, 0, 0, 0, 0, 365, 0, 0, 0, 0, 794, 0,
+  0, 0, 0, 0, 390, 525, 686, 74, 0, 0, 0, 0, 323, 571, 844, 187,
+  0, 0, 0, 0, 493, 889, 896, 0, 124, 938, 15, 50, 172, 446, 48, 511,
+  427, 911, 754, 0, 0, 329, 0, 577, 0, 0, 0, 0, 0, 0, 0, 701,
+  447, 133, 610, 814, 575, 0, 0, 0, 0, 0, 0, 0, 0, 207, 0, 0,
+  0, 0, 302, 691, 108, 0, 874, 0, 0, 472, 0, 0, 0, 0, 0, 92,
+};
+
+const char *WA_FREQ_191_TOKENS[] = {
+  "，但",
+  "不见",
+  "留在",
+  "在這",
+  "這裏",
+  "裏等",
+  "等她",
+  "她。",
+  "他们",
+  "们有",
+  "有眼",
+  "眼睛",
+  "睛，",
+  "但看",
+  "看不",
+  "见；",
+  "；有",
+  "有耳",
+  "耳朵",
+  "朵，",
+  "但听",
+  "听不",
+  "见。",
+  "湯姆",
+  "姆遲",
+  "遲早",
+  "早會",
+  "會後",
+  "後悔",
+  "悔。",
+  "我正",
+  "正要",
+  "要去",
+  "去写",
+  "写一",
+  "一封",
+  "封信",
+  "信。",
+  "他再",
+  "再有",
+  "有個",
+  "個長",
+  "長短",
+  "短，",
+  "，這",
+  "這家",
+  "家業",
+  "業怕",
+  "怕不",
+  "不是",
+  "是眾",
+  "眾親",
+  "親族",
+  "族一",
+  "一分",
+  "分？",
+  "那是",
+  "是下",
+  "下个",
+  "个月",
+  "月的",
+  "的事",
+  "事。",
+};
+const uint16_t WA_FREQ_191_RANKS[] = {
+  36, 0, 0, 0, 0, 17, 0, 0, 0, 0, 39, 0, 41, 0, 0, 26,
+  0, 12, 63, 7, 0, 0, 0, 0, 0, 0, 0, 37, 31, 34, 0, 0,
+  0, 0, 0, 6, 32, 44, 0, 23, 19, 22, 60, 35, 9, 62, 0, 27,
+  49, 0, 4, 15, 53, 0, 0, 0, 0, 0, 0, 0, 16, 61, 0, 8,
+  40, 0, 0, 0, 0, 0, 0, 58, 0, 0, 2, 42, 0, 0, 3, 18,
+  29, 38, 1, 55, 20, 24, 11, 57, 54, 5, 52, 50, 21, 0, 0, 0,
+  0, 0, 0, 0, 0, 14, 51, 59, 45, 30, 56, 0, 0, 0, 33, 0,
+  25, 43, 0, 13, 47, 0, 28, 0, 46, 0, 0, 48, 0, 10, 0, 0,
+};
+
+const char *WA_FREQ_192_TOKENS[] = {
+  "ukuthi",
+  "kanye",
+  "noma",
+  "futhi",
+  "uma",
+  "ukuba",
+  "kodwa",
+  "lapho",
+  "abantu",
+  "kakhulu",
+  "ukuze",
+  "ngoba",
+  "khona",
+  "Uma",
+  "kumele",
+  "kusho",
+  "kufanele",
+  "umuntu",
+  "lokhu",
+  "nje",
+  "kube",
+  "na",
+  "kahle",
+  "wathi",
+  "phakathi",
+  "yakhe",
+  "Afrika",
+  "njengoba",
+  "zonke",
+  "isikhathi",
+  "bese",
+  "ngendlela",
+  "kanti",
+  "ngesikhathi",
+  "njalo",
+  "bonke",
+  "Lokhu",
+  "wakhe",
+  "umsebenzi",
+  "ngenxa",
+  "yini",
+  "ngokuthi",
+  "imali",
+  "ngokuba",
+  "ngaphandle",
+  "kuye",
+  "wonke",
+  "yakho",
+  "izinto",
+  "uNkulunkulu",
+  "kuphela",
+  "phansi",
+  "lokho",
+  "yonke",
+  "ngayo",
+  "Kodwa",
+  "konke",
+  "uthe",
+  "kepha",
+  "indlela",
+  "uhlelo",
+  "lakhe",
+  "yena",
+  "kanjani",
+  "ngaphansi",
+  "kwakhe",
+  "naye",
+  "lapha",
+  "ulwazi",
+  "lo",
+  "kukhona",
+  "endaweni",
+  "le",
+  "wakho",
+  "ngaphambi",
+  "uJehova",
+  "indawo",
+  "kubo",
+  "nokuthi",
+  "amandla",
+  "manje",
+  "labo",
+  "eziningi",
+  "zakhe",
+  "kulo",
+  "zabo",
+  "yami",
+  "sakhe",
+  "bakhe",
+  "phezu",
+  "ukwenza",
+  "kuze",
+  "Kepha",
+  "abanye",
+  "ngemuva",
+  "ukudla",
+  "isicelo",
+  "phambi",
+  "1",
+  "imisebenzi",
+  "uthi",
+  "uJesu",
+  "Uthe",
+  "ezweni",
+  "wami",
+  "2",
+  "mayelana",
+  "wena",
+  "into",
+  "yabo",
+  "nabo",
+  "ngabe",
+  "Ngokuba",
+  "3",
+  "phambili",
+  "emhlabeni",
+  "ngeke",
+  "amanzi",
+  "kuyo",
+  "kwakho",
+  "lokusebenza",
+  "kwabo",
+  "emva",
+  "4",
+  "mina",
+  "iqhaza",
+  "yethu",
+  "5",
+  "abaningi",
+  "ngakho",
+  "eNingizimu",
+  "8",
+  "isimo",
+  "abafundi",
+  "omunye",
+  "6",
+  "ngonyaka",
+  "igama",
+  "lowo",
+  "ukusebenza",
+  "lakho",
+  "kanjalo",
+  "7",
+  "kusukela",
+  "bathi",
+  "abe",
+  "wethu",
+  "9",
+  "ukuthola",
+  "umthetho",
+  "amabili",
+  "ekhaya",
+  "10",
+  "endlini",
+  "enkulu",
+  "kule",
+  "iminyaka",
+  "ke",
+  "ezindaweni",
+  "muntu",
+  "Abantu",
+  "12",
+  "umphakathi",
+  "zakho",
+  "impilo",
+  "inkosi",
+  "sakho",
+  "izwe",
+  "zethu",
+  "11",
+  "Noma",
+  "ngisho",
+  "yokuthi",
+  "lezi",
+  "lonke",
+  "iqembu",
+  "Lapho",
+  "sonke",
+  "ka",
+  "sokuthi",
+  "kwaba",
+  "ithuba",
+  "izingane",
+  "14",
+  "kokuba",
+  "izindawo",
+  "kimi",
+  "omkhulu",
+  "ezinye",
+  "sikhathi",
+  "ngalo",
+  "emuva",
+  "kuleli",
+  "13",
+  "kwabantu",
+  "Wathi",
+  "izinhlelo",
+  "15",
+  "lwakho",
+  "16",
+  "kokuthi",
+  "kuwo",
+  "lutho",
+  "nabantu",
+  "Kwathi",
+  "izindlela",
+  "wukuthi",
+  "akhe",
+  "kuzo",
+  "abo",
+  "kaNkulunkulu",
+  "kuwe",
+  "lesi",
+  "ngaphakathi",
+  "umhlaba",
+  "17",
+  "kwami",
+  "indodana",
+  "18",
+  "ingane",
+  "ngo",
+  "ethi",
+  "ikakhulukazi",
+  "kubantu",
+  "Lo",
+  "abasebenzi",
+  "leli",
+  "okumele",
+  "izinsuku",
+  "usho",
+  "ezimbili",
+  "lami",
+  "nayo",
+  "kancane",
+  "ibe",
+  "UJesu",
+  "ube",
+  "usizo",
+  "lokuthi",
+  "ku",
+  "nazo",
+  "Kumele",
+  "20",
+  "amathuba",
+  "19",
+  "kanje",
+  "kini",
+  "nezinye",
+  "lethu",
+  "ndawo",
+  "okufanele",
+  "wabo",
+  "Ngakho",
+  "amazwe",
+  "21",
+  "ngazo",
+  "amaningi",
+  "emsebenzini",
+  "Funda",
+  "uhulumeni",
+  "ngcono",
+  "efanele",
+  "Futhi",
+  "eside",
+  "isinqumo",
+  "Njengoba",
+  "kabusha",
+  "kuya",
+  "icala",
+  "ukwazi",
+  "edlule",
+  "izindaba",
+  "izwi",
+  "babe",
+  "kwethu",
+  "kwalokho",
+  "22",
+  "Le",
+  "ngaso",
+  "nami",
+  "emphakathini",
+  "leyo",
+  "ngokushesha",
+  "ukubona",
+  "ngosuku",
+  "ufuna",
+  "kumbe",
+  "indaba",
+  "Ngesikhathi",
+  "babo",
+  "of",
+  "yona",
+  "elikhulu",
+  "23",
+  "izinga",
+  "sengathi",
+  "nabanye",
+  "abesifazane",
+  "izidingo",
+  "ngamunye",
+  "lolu",
+  "amehlo",
+  "bakho",
+  "esikhathini",
+  "Umuntu",
+  "nawe",
+  "umoya",
+  "Kufanele",
+  "enye",
+  "24",
+  "Kukhona",
+  "zabantu",
+  "njani",
+  "thina",
+  "ngenhloso",
+  "waba",
+  "ngubani",
+  "abantwana",
+  "imithetho",
+  "lwakhe",
+  "kabi",
+  "25",
+  "kungenzeka",
+  "ezahlukene",
+  "ulimi",
+  "indlu",
+  "yayo",
+  "onke",
+  "bona",
+  "uphawu",
+  "usebenzise",
+  "entsha",
+  "imininingwane",
+  "Uhlelo",
+  "bethu",
+  "Bheka",
+  "ebusuku",
+  "hlelo",
+  "uMnuz",
+  "akho",
+  "kwenzeka",
+  "kwesikhathi",
+  "isandla",
+  "ngithi",
+  "usuku",
+  "ekuseni",
+  "eliphezulu",
+  "ezintathu",
+  "iNkosi",
+  "kwayo",
+  "kuqala",
+  "lona",
+  "ngabantu",
+  "okukhulu",
+  "laba",
+  "zami",
+  "ngempela",
+  "nalowo",
+  "kuthi",
+  "wenza",
+  "namuhla",
+  "phezulu",
+  "kwenziwe",
+  "sibe",
+  "ezimele",
+  "ukusebenzisa",
+  "amathathu",
+  "inani",
+  "udaba",
+  "sami",
+  "u",
+  "ezithile",
+  "impahla",
+  "kazwelonke",
+  "kahulumeni",
+  "Manje",
+  "imoto",
+  "no",
+  "Lezi",
+  "nalo",
+  "yeningi",
+  "amaphoyisa",
+  "ifayela",
+  "27",
+  "ekutheni",
+  "esikhundleni",
+  "la",
+  "nawo",
+  "ngalokho",
+  "bami",
+  "negama",
+  "UNkulunkulu",
+  "eThekwini",
+  "okuhle",
+  "amazwi",
+  "Nkosi",
+  "yabantu",
+  "Ngoba",
+  "eminingi",
+  "eminyakeni",
+  "26",
+  "amalungelo",
+  "zokusebenza",
+  "eyodwa",
+  "kungaba",
+  "kuthiwa",
+  "enkantolo",
+  "kuNkulunkulu",
+  "empilweni",
+  "inqubo",
+  "kwalo",
+  "izinkinga",
+  "yodaba",
+  "Emva",
+  "Lesi",
+  "omusha",
+  "ngawo",
+  "amalungu",
+  "Ngakho-ke",
+  "UJehova",
+  "Ukuze",
+  "izinhlobo",
+  "Mina",
+  "kulesi",
+  "wase",
+  "amagama",
+  "Umthetho",
+  "jikelele",
+  "ethile",
+  "Leli",
+  "esandleni",
+  "ezingeni",
+  "ubufakazi",
+  "30",
+  "bheka",
+  "esikoleni",
+  "omuhle",
+  "amaqembu",
+  "kubalulekile",
+  "angeke",
+  "emehlweni",
+  "uthole",
+  "incwadi",
+  "ukuya",
+  "ngqo",
+  "Ngabe",
+  "Vula",
+  "izimali",
+  "nakho",
+  "kaJehova",
+  "iqiniso",
+  "Kanti",
+  "lawo",
+  "ngenkathi",
+  "silandelwe",
+  "esikhulu",
+  "esingu",
+  "28",
+  "kangaka",
+  "ndawonye",
+  "nina",
+  "waya",
+  "Credit",
+  "ezifana",
+  "ukuqinisekisa",
+  "akukho",
+  "ethu",
+  "amanye",
+  "maqondana",
+  "ababili",
+  "impela",
+  "ngani",
+  "abadlali",
+  "kalula",
+  "zibe",
+  "ohlelweni",
+  "Yebo",
+  "ingxenye",
+  "Abanye",
+  "Umsebenzi",
+  "emibili",
+  "nathi",
+  "FM",
+  "29",
+  "enhle",
+  "nini",
+  "bakwazi",
+  "kuba",
+  "ukwakha",
+  "kwezinye",
+  "ngaye",
+  "isiqalo",
+  "leso",
+  "nendawo",
+  "zomphakathi",
+  "kwazo",
+  "msebenzi",
+  "Ngemuva",
+  "ezinkulu",
+  "ngale",
+  "kunjalo",
+  "Isibonelo",
+  "Lolu",
+  "hhayi",
+  "kohlelo",
+  "ngamandla",
+  "odlule",
+  "1.",
+  "Nkulunkulu",
+  "izinyathelo",
+  "kwenu",
+  "okubi",
+  "amakhono",
+  "indoda",
+  "loba",
+  "yokuqala",
+  "Ngaphandle",
+  "esigabeni",
+  "kulabo",
+  "imibuzo",
+  "Kungani",
+  "inkinga",
+  "ukukhuluma",
+  "athi",
+  "emzini",
+  "inhliziyo",
+  "kwawo",
+  "labantu",
+  "phela",
+  "umzimba",
+  "bakwa-Israyeli",
+  "encane",
+  "inzuzo",
+  "ukungena",
+  "Ngenxa",
+  "isibonelo",
+  "komsebenzi",
+  "ukufunda",
+  "kwenziwa",
+  "namandla",
+  "wenze",
+  "lezo",
+  "njengamanje",
+  "ukufinyelela",
+  "yomuntu",
+  "ukusiza",
+  "uqobo",
+  "yawo",
+  "abalimi",
+  "okunye",
+  "qembu",
+  "uyise",
+  "wayo",
+  "yilowo",
+  "eduze",
+  "kuJehova",
+  "wona",
+  "zenu",
+  "amadoda",
+  "sigaba",
+  "31",
+  "libe",
+  "Njalo",
+  "kanzima",
+  "yimuphi",
+  "iNingizimu",
+  "inhlangano",
+  "izandla",
+  "izindlu",
+  "nezidingo",
+  "akwazi",
+  "izindleko",
+  "yalo",
+  "Bonke",
+  "amakhulu",
+  "yize",
+  "layo",
+  "bantu",
+  "emthethweni",
+  "suku",
+  "yathi",
+  "amane",
+  "besifazane",
+  "Inkosi",
+  "emazweni",
+  "izimpahla",
+  "eceleni",
+  "ezayo",
+  "imvume",
+  "kuchaza",
+  "nemisebenzi",
+  "ubuso",
+  "zikahulumeni",
+  "izimo",
+  "izinqumo",
+  "kudingeka",
+  "nxa",
+  "uhlobo",
+  "wokuqala",
+  "32",
+  "ezintsha",
+  "nohlelo",
+  "sethu",
+  "kwenza",
+  "umbiko",
+  "baseNingizimu",
+  "kusuka",
+  "okuningi",
+  "zayo",
+  "nyaka",
+  "okwenza",
+  "imiphumela",
+  "nokwenza",
+  "izikhathi",
+  "kulezi",
+  "othile",
+  "wabe",
+  "esithi",
+  "ibhizinisi",
+  "lokuqala",
+  "namhlanje",
+  "wokuthi",
+  "ekuqaleni",
+  "izifundo",
+  "kungani",
+  "ilanga",
+  "Inhloso",
+  "nguye",
+  "abazali",
+  "base",
+  "kade",
+  "emhlabathini",
+  "isizwe",
+  "kabanzi",
+  "umndeni",
+  "yinto",
+  "Zonke",
+  "nalabo",
+  "elilodwa",
+  "kuphi",
+  "kunoma",
+  "nokunye",
+  "ami",
+  "Ngalokho",
+  "izincwadi",
+  "Konke",
+  "komhlaba",
+  "kwaze",
+  "Ezinye",
+  "Jehova",
+  "nanoma",
+  "unyaka",
+  "emithathu",
+  "ndlela",
+  "umbuso",
+  "yohlelo",
+  "okungenani",
+  "Khona",
+  "isidingo",
+  "omhlaba",
+  "zinto",
+  "endleleni",
+  "kwamanzi",
+  "kwathi",
+  "sokuba",
+  "imibono",
+  "kuso",
+  "Lokho",
+  "ezincane",
+  "ithi",
+  "igazi",
+  "kukho",
+  "uNksz",
+  "inyama",
+  "mdlalo",
+  "ngaphezulu",
+  "abasha",
+  "enze",
+  "kwazise",
+  "33",
+  "eminye",
+  "nalapho",
+  "ukuphila",
+  "eGoli",
+  "komthetho",
+  "athole",
+  "ikhanda",
+  "kaZwelonke",
+  "kithi",
+  "Indlela",
+  "benza",
+  "nani",
+  "nokuba",
+  "000",
+  "Nakuba",
+  "ngaleso",
+  "Omunye",
+  "Yize",
+  "iningi",
+  "ukusetshenziswa",
+  "ekhona",
+  "kangakanani",
+  "izolo",
+  "kulowo",
+  "kwenzeke",
+  "namanye",
+  "okuthile",
+  "zawo",
+  "Nokho",
+  "a",
+  "kuhle",
+  "ngaphezu",
+  "ezulwini",
+  "ngenyanga",
+  "ngokuphelele",
+  "ucwaningo",
+  "yomphakathi",
+  "Wena",
+  "lelo",
+  "ukuthuthukisa",
+  "nalokho",
+  "ngolwazi",
+  "amacala",
+  "ngezindlela",
+  "uphinde",
+  "Okunye",
+  "kangcono",
+  "oyedwa",
+  "izinsiza",
+  "kulokhu",
+  "nolwazi",
+  "sithi",
+  "benze",
+  "efanayo",
+  "ekugcineni",
+  "nezinto",
+  "waze",
+  "Play",
+  "ebalulekile",
+  "imiphakathi",
+  "umama",
+  "umuzi",
+  "waseNingizimu",
+  "daba",
+  "elinye",
+  "lomsebenzi",
+  "imibhalo",
+  "Uthi",
+  "ngokugcwele",
+  "amasha",
+  "ukufa",
+  "amalunga",
+  "nezingane",
+  "nokho",
+  "umculo",
+  "Mthetho",
+  "esibhedlela",
+  "izitshalo",
+  "uMnyango",
+  "Ingabe",
+  "amancane",
+  "kwamanye",
+  "bobabili",
+  "impi",
+  "ndaba",
+  "waqala",
+  "baba",
+  "ingozi",
+  "ilungelo",
+  "kwalokhu",
+  "Akukho",
+  "emihlanu",
+  "ezehlukene",
+  "imigomo",
+  "izimoto",
+  "nendlela",
+  "ngenhla",
+  "umnyango",
+  "Ngeke",
+  "Uhulumeni",
+  "Wonke",
+  "abamnyama",
+  "isivumelwano",
+  "izithombe",
+  "kusasa",
+  "ngemali",
+  "obala",
+  "Kristu",
+  "and",
+  "umbono",
+  "imidlalo",
+  "mali",
+  "nesimo",
+  "ngalokhu",
+  "uNkk",
+  "ukuhlala",
+  "izilwane",
+  "kuka",
+  "nomphakathi",
+  "ntambama",
+  "uba",
+  "indima",
+  "intuthuko",
+  "kwezimali",
+  "esihle",
+  "nomsebenzi",
+  "yenu",
+  "umdlalo",
+  "umhlangano",
+  "sabo",
+  "yazo",
+  "i",
+  "nto",
+  "34",
+  "e",
+  "ngesandla",
+  "ubaba",
+  "wabona",
+  "isib",
+  "uze",
+  "ngezikhathi",
+  "uthando",
+  "evela",
+  "ezikhona",
+  "kuzoba",
+  "nezinhlelo",
+  "owesifazane",
+  "umlomo",
+  "zombili",
+  "Kubalulekile",
+  "ezinhle",
+  "izilimi",
+  "kuleyo",
+  "sezulu",
+  "uDavide",
+  "umlando",
+  "bani",
+  "mhlawumbe",
+  "uMnu",
+  "izono",
+  "izinhlangano",
+  "kweminyaka",
+  "lula",
+  "bayo",
+  "eJerusalema",
+  "ngakho-ke",
+  "sayo",
+  "soMthetho",
+  "ngayinye",
+  "akekho",
+  "iyiphi",
+  "umphefumulo",
+  "Ngonyaka",
+  "esizayo",
+  "ukuthatha",
+  "yebo",
+  "Isithombe",
+  "Yini",
+  "bathole",
+  "izinguquko",
+  "yedwa",
+  "35",
+  "intsha",
+  "komunye",
+  "ngumuntu",
+  "ukuhamba",
+  "abadala",
+  "ekwenzeni",
+  "ezifanele",
+  "ugesi",
+  "usebenzisa",
+  "wahamba",
+  "Wayesethi",
+  "inkulumo",
+  "ukubhekana",
+  "Bathi",
+  "bakithi",
+  "isithombe",
+  "ithemba",
+  "kungekho",
+  "lomuntu",
+  "bethi",
+  "ebusweni",
+  "izicelo",
+  "phakade",
+  "sifuna",
+  "ukulwa",
+  "wezwe",
+  "izinyanga",
+  "ngokulandela",
+  "Base",
+  "ekhuluma",
+  "ozayo",
+  "umasipala",
+  "aphinde",
+  "baze",
+  "ukugcina",
+  "efuna",
+  "elihle",
+  "eya",
+  "neminye",
+  "ubani",
+  "yingxenye",
+  "ngamanzi",
+  "ngezinto",
+  "umbhalo",
+  "amasu",
+  "imizamo",
+  "uYehova",
+  "Abafundi",
+  "emkhakheni",
+  "ezine",
+  "umlilo",
+  "isiqiniseko",
+  "zalo",
+  "abalandeli",
+  "esisodwa",
+  "lokuba",
+  "wahlala",
+  "ayo",
+  "isigaba",
+  "izingubo",
+  "lwabo",
+  "esithile",
+  "isono",
+  "izikhungo",
+  "nakuba",
+  "nokusebenza",
+  "unina",
+  "Ngubani",
+  "emakhaya",
+  "ikhona",
+  "kuvela",
+  "nalokhu",
+  "ukuqhubeka",
+  "umhlabathi",
+  "yokwenza",
+  "36",
+  "akufanele",
+  "aze",
+  "inkantolo",
+  "mcimbi",
+  "ngalinye",
+  "omphakathi",
+  "uNgqongqoshe",
+  "uye",
+  "esiningi",
+  "kude",
+  "nomthelela",
+  "amadodana",
+  "likaJehova",
+  "ukuthula",
+  "zokuthi",
+  "abaholi",
+  "nezindlela",
+  "umqondo",
+  "umusa",
+  "Kusukela",
+  "kumuntu",
+  "abafana",
+  "ehlukene",
+  "ifa",
+  "ngokusebenzisa",
+  "Igama",
+  "enza",
+  "sikwazi",
+  "umsindo",
+  "wazi",
+  "zokuxhumana",
+  "kuyona",
+  "nomuntu",
+  "ukuhlola",
+  "Ake",
+  "ifomu",
+  "izithelo",
+  "ukuphatha",
+  "Africa",
+  "abahlala",
+  "kufike",
+  "masinyane",
+  "nesikhathi",
+  "okubalwa",
+  "okukhulunywa",
+  "umnotho",
+  "zazo",
+  "ikakhulu",
+  "lena",
+  "simo",
+  "ukhuluma",
+  "ukuxhumana",
+  "umfundi",
+  "ngasinye",
+  "ngomsebenzi",
+  "omncane",
+  "uhlaka",
+  "umuthi",
+  "yikuphi",
+  "Cha",
+  "Lapha",
+  "amazinga",
+};
+const uint16_t WA_FREQ_192_RANKS[] = {
+  378, 0, 0, 30, 629, 822, 634, 731, 56, 0, 0, 649, 950, 0, 938, 912,
+  473, 994, 0, 0, 947, 214, 432, 0, 0, 0, 0, 349, 705, 380, 393, 0,
+  600, 0, 0, 0, 485, 0, 958, 0, 560, 507, 0, 0, 602, 79, 0, 0,
+  687, 213, 736, 0, 396, 0, 0, 0, 616, 775, 0, 0, 708, 0, 357, 620,
+  621, 658, 0, 0, 615, 0, 0, 0, 0, 593, 539, 543, 0, 931, 0, 759,
+  297, 855, 943, 483, 976, 544, 936, 210, 965, 873, 915, 0, 0, 143, 442, 0,
+  944, 0, 901, 0, 0, 0, 0, 0, 416, 780, 953, 0, 0, 0, 332, 340,
+  998, 0, 0, 0, 683, 0, 0, 0, 0, 0, 0, 242, 374, 824, 0, 696,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 35, 0, 0,
+  0, 29, 55, 727, 0, 422, 0, 182, 246, 0, 588, 448, 0, 497, 934, 0,
+  0, 746, 646, 0, 0, 0, 345, 0, 0, 0, 0, 0, 0, 765, 0, 0,
+  0, 0, 125, 886, 720, 169, 909, 0, 0, 0, 809, 187, 628, 520, 845, 0,
+  0, 373, 757, 320, 365, 562, 0, 0, 450, 985, 0, 0, 0, 0, 0, 907,
+  440, 642, 0, 0, 330, 0, 0, 768, 823, 0, 0, 0, 0, 866, 0, 0,
+  91, 0, 0, 0, 0, 0, 0, 0, 0, 766, 392, 971, 86, 0, 25, 966,
+  0, 0, 862, 0, 0, 787, 925, 0, 549, 28, 0, 0, 859, 575, 147, 100,
+  963, 0, 0, 0, 0, 0, 0, 0, 933, 0, 0, 0, 0, 13, 784, 400,
+  807, 376, 987, 462, 0, 0, 0, 0, 0, 0, 0, 40, 0, 0, 0, 436,
+  0, 271, 329, 101, 97, 237, 461, 796, 293, 810, 783, 898, 0, 586, 201, 614,
+  196, 398, 619, 328, 552, 0, 0, 0, 0, 0, 287, 262, 425, 0, 0, 0,
+  797, 0, 0, 468, 216, 0, 885, 0, 864, 0, 92, 0, 0, 0, 527, 557,
+  281, 0, 995, 532, 0, 0, 428, 0, 0, 120, 0, 0, 220, 512, 347, 758,
+  176, 195, 303, 0, 171, 903, 0, 0, 71, 0, 675, 988, 0, 0, 0, 175,
+  585, 0, 0, 250, 633, 239, 0, 385, 0, 166, 455, 0, 0, 0, 680, 0,
+  0, 0, 524, 0, 0, 0, 0, 946, 0, 0, 830, 738, 960, 637, 0, 0,
+  686, 0, 644, 875, 0, 154, 0, 0, 258, 0, 471, 861, 0, 0, 0, 836,
+  397, 0, 0, 0, 0, 874, 896, 146, 926, 0, 0, 673, 0, 0, 888, 929,
+  0, 0, 0, 170, 59, 153, 630, 567, 710, 894, 0, 0, 151, 0, 0, 10,
+  503, 0, 881, 0, 75, 431, 0, 0, 222, 230, 0, 117, 0, 0, 829, 0,
+  364, 571, 744, 0, 0, 0, 0, 467, 312, 670, 288, 889, 0, 521, 515, 279,
+  892, 589, 0, 819, 72, 0, 178, 313, 564, 852, 0, 494, 0, 0, 0, 206,
+  531, 21, 770, 0, 0, 0, 801, 0, 0, 0, 444, 0, 192, 0, 0, 0,
+  0, 492, 188, 967, 0, 0, 0, 274, 102, 290, 141, 52, 699, 703, 880, 945,
+  260, 443, 0, 81, 254, 535, 495, 319, 902, 922, 942, 0, 0, 0, 0, 0,
+  0, 41, 0, 612, 0, 160, 918, 576, 0, 0, 51, 548, 825, 869, 0, 626,
+  0, 0, 0, 161, 0, 0, 0, 9, 478, 865, 674, 916, 395, 133, 554, 280,
+  481, 0, 817, 0, 0, 0, 0, 878, 0, 284, 0, 0, 749, 324, 989, 0,
+  0, 0, 0, 640, 0, 0, 0, 0, 0, 717, 0, 232, 406, 437, 715, 389,
+  42, 693, 0, 0, 20, 0, 211, 249, 806, 816, 804, 0, 0, 741, 0, 0,
+  0, 38, 0, 0, 0, 209, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3,
+  643, 0, 0, 0, 0, 0, 0, 0, 0, 0, 832, 18, 58, 145, 414, 813,
+  89, 487, 792, 831, 0, 23, 283, 354, 566, 0, 463, 0, 407, 155, 496, 0,
+  435, 0, 514, 0, 22, 180, 0, 0, 834, 928, 0, 0, 0, 95, 685, 788,
+  0, 0, 386, 0, 294, 191, 430, 555, 609, 838, 0, 726, 266, 388, 104, 911,
+  0, 0, 375, 0, 0, 0, 0, 570, 0, 0, 0, 0, 948, 429, 0, 728,
+  0, 300, 999, 0, 669, 0, 0, 269, 694, 0, 366, 441, 0, 0, 599, 94,
+  490, 77, 608, 0, 905, 0, 0, 0, 0, 415, 421, 716, 0, 0, 0, 0,
+  606, 721, 755, 0, 0, 0, 0, 610, 0, 978, 0, 0, 0, 844, 0, 0,
+  482, 0, 0, 0, 0, 0, 14, 504, 423, 660, 309, 769, 0, 0, 0, 0,
+  0, 0, 410, 724, 173, 0, 0, 0, 0, 0, 0, 282, 0, 16, 0, 60,
+  109, 0, 0, 843, 0, 0, 0, 0, 0, 0, 920, 0, 93, 805, 0, 207,
+  773, 70, 0, 0, 0, 449, 0, 0, 53, 322, 583, 434, 690, 712, 617, 317,
+  174, 681, 803, 986, 0, 0, 0, 459, 676, 0, 0, 0, 243, 799, 904, 811,
+  577, 0, 129, 228, 747, 325, 533, 897, 956, 0, 0, 124, 748, 734, 292, 126,
+  725, 895, 0, 0, 666, 0, 370, 66, 454, 0, 0, 0, 0, 0, 611, 812,
+  0, 793, 0, 0, 983, 0, 0, 0, 0, 0, 631, 833, 964, 0, 839, 580,
+  338, 456, 0, 0, 0, 0, 0, 0, 0, 331, 0, 0, 0, 0, 0, 0,
+  172, 0, 0, 0, 144, 632, 85, 185, 511, 33, 0, 0, 677, 475, 997, 251,
+  752, 910, 0, 0, 0, 0, 48, 289, 335, 197, 0, 0, 0, 0, 0, 315,
+  982, 24, 863, 996, 394, 0, 672, 0, 940, 604, 0, 350, 0, 0, 0, 453,
+  0, 383, 574, 0, 579, 951, 930, 0, 110, 0, 0, 0, 122, 678, 26, 0,
+  992, 301, 0, 0, 641, 0, 162, 740, 802, 0, 0, 534, 0, 0, 0, 0,
+  0, 235, 837, 0, 0, 0, 0, 27, 635, 598, 0, 553, 0, 114, 840, 0,
+  0, 241, 578, 0, 0, 0, 62, 0, 0, 0, 0, 341, 0, 0, 0, 0,
+  0, 261, 390, 402, 270, 774, 447, 0, 0, 0, 0, 0, 0, 0, 164, 0,
+  0, 0, 689, 152, 0, 0, 0, 0, 0, 0, 0, 849, 0, 0, 590, 592,
+  0, 234, 841, 921, 0, 377, 508, 786, 417, 307, 179, 981, 821, 0, 742, 298,
+  420, 0, 0, 0, 0, 0, 476, 0, 0, 0, 594, 304, 0, 0, 0, 974,
+  0, 112, 363, 0, 545, 0, 0, 622, 150, 318, 547, 0, 0, 198, 39, 761,
+  0, 0, 0, 419, 990, 0, 0, 729, 268, 98, 0, 0, 0, 0, 906, 0,
+  0, 0, 0, 0, 0, 877, 0, 0, 291, 0, 0, 800, 0, 0, 707, 0,
+  123, 140, 409, 83, 668, 671, 0, 358, 856, 0, 0, 0, 0, 962, 337, 0,
+  0, 460, 0, 111, 0, 156, 276, 636, 0, 470, 0, 814, 474, 0, 0, 404,
+  781, 0, 484, 61, 0, 0, 917, 0, 219, 0, 0, 273, 939, 493, 0, 0,
+  0, 0, 477, 0, 372, 528, 919, 0, 369, 116, 265, 624, 0, 650, 134, 737,
+  858, 0, 0, 0, 835, 0, 90, 0, 984, 136, 0, 0, 0, 0, 0, 0,
+  0, 820, 961, 0, 0, 203, 314, 639, 0, 2, 0, 0, 847, 68, 45, 399,
+  772, 0, 0, 165, 472, 411, 0, 743, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 667, 0, 0, 0, 0, 0, 204, 0, 0, 652, 0, 0, 972, 0, 0,
+  0, 0, 107, 0, 0, 891, 0, 977, 464, 0, 0, 587, 445, 0, 259, 0,
+  0, 127, 519, 0, 0, 0, 0, 0, 0, 403, 867, 0, 0, 0, 351, 0,
+  0, 36, 573, 76, 299, 957, 344, 0, 339, 871, 827, 0, 0, 523, 0, 0,
+  0, 0, 0, 506, 0, 0, 713, 5, 46, 486, 0, 828, 0, 0, 0, 148,
+  8, 247, 657, 272, 887, 310, 181, 0, 267, 0, 0, 0, 0, 0, 522, 0,
+  78, 208, 418, 424, 502, 664, 706, 868, 0, 682, 0, 0, 0, 0, 0, 221,
+  253, 0, 0, 0, 0, 0, 391, 240, 308, 0, 466, 530, 0, 860, 0, 106,
+  0, 0, 0, 44, 218, 84, 311, 607, 908, 248, 692, 795, 0, 0, 501, 0,
+  0, 0, 0, 0, 0, 199, 853, 0, 818, 0, 536, 719, 779, 882, 0, 0,
+  0, 0, 0, 735, 556, 842, 709, 0, 439, 662, 679, 941, 0, 0, 0, 99,
+  32, 0, 0, 0, 0, 0, 499, 0, 647, 0, 0, 0, 142, 540, 914, 0,
+  0, 778, 0, 798, 0, 0, 17, 665, 730, 408, 0, 1000, 346, 0, 782, 0,
+  371, 0, 0, 132, 295, 0, 0, 0, 0, 0, 0, 0, 0, 0, 215, 525,
+  850, 0, 0, 37, 0, 74, 233, 542, 336, 561, 31, 296, 0, 0, 0, 0,
+  0, 0, 0, 0, 11, 238, 0, 0, 603, 0, 973, 701, 756, 0, 0, 0,
+  480, 0, 0, 96, 128, 189, 229, 546, 0, 913, 0, 252, 323, 762, 0, 0,
+  0, 509, 0, 0, 451, 565, 0, 0, 224, 0, 0, 745, 529, 848, 0, 0,
+  0, 0, 653, 0, 777, 0, 0, 200, 121, 655, 879, 0, 0, 0, 0, 321,
+  826, 0, 0, 0, 0, 613, 0, 0, 559, 0, 0, 0, 0, 0, 225, 0,
+  0, 0, 851, 0, 0, 0, 697, 537, 0, 0, 0, 0, 326, 785, 306, 163,
+  413, 935, 764, 937, 367, 0, 0, 343, 43, 0, 949, 0, 0, 80, 0, 0,
+  0, 601, 776, 0, 0, 0, 597, 625, 0, 0, 0, 0, 0, 0, 0, 0,
+  137, 0, 0, 0, 0, 0, 0, 0, 0, 119, 558, 0, 0, 0, 0, 277,
+  0, 0, 6, 0, 342, 489, 0, 212, 0, 0, 0, 893, 0, 959, 0, 0,
+  0, 73, 605, 184, 815, 333, 876, 285, 927, 0, 0, 0, 0, 0, 0, 65,
+  890, 0, 0, 103, 135, 733, 648, 794, 969, 0, 0, 0, 491, 0, 952, 0,
+  0, 0, 0, 550, 0, 87, 751, 0, 302, 663, 0, 263, 0, 899, 0, 0,
+  69, 0, 0, 257, 202, 0, 0, 0, 702, 0, 0, 0, 656, 0, 505, 0,
+  0, 661, 0, 0, 0, 438, 955, 0, 704, 979, 0, 0, 0, 0, 0, 0,
+  0, 368, 167, 0, 993, 0, 518, 0, 654, 0, 596, 0, 226, 0, 618, 0,
+  0, 563, 0, 0, 975, 427, 348, 595, 0, 791, 0, 452, 334, 190, 684, 790,
+  0, 700, 718, 0, 0, 714, 34, 0, 0, 469, 50, 0, 0, 627, 0, 0,
+  0, 0, 0, 0, 0, 0, 569, 0, 0, 0, 568, 651, 355, 513, 541, 870,
+  193, 15, 0, 236, 0, 0, 0, 0, 205, 789, 970, 0, 0, 688, 264, 698,
+  0, 0, 0, 754, 0, 186, 0, 0, 0, 362, 0, 275, 0, 0, 0, 0,
+  0, 0, 0, 645, 0, 7, 12, 659, 177, 63, 278, 382, 0, 130, 0, 256,
+  245, 384, 526, 139, 0, 227, 0, 381, 401, 0, 0, 0, 0, 581, 0, 0,
+  0, 0, 113, 722, 0, 0, 0, 924, 0, 0, 105, 379, 767, 0, 0, 0,
+  0, 0, 115, 0, 1, 0, 0, 872, 457, 0, 0, 623, 0, 0, 0, 0,
+  0, 255, 954, 0, 356, 968, 465, 0, 0, 0, 0, 361, 118, 591, 551, 0,
+  0, 980, 0, 405, 695, 0, 168, 500, 286, 0, 387, 19, 316, 0, 0, 0,
+  0, 0, 753, 0, 360, 0, 0, 0, 0, 49, 88, 0, 0, 0, 0, 0,
+  0, 732, 217, 433, 760, 0, 0, 327, 0, 0, 0, 194, 0, 54, 763, 488,
+  0, 479, 0, 0, 0, 0, 0, 359, 808, 884, 157, 750, 149, 883, 0, 0,
+  991, 0, 0, 158, 0, 0, 244, 47, 0, 0, 691, 584, 723, 854, 0, 0,
+  82, 352, 0, 0, 446, 108, 223, 0, 0, 0, 0, 771, 932, 67, 231, 0,
+  0, 0, 0, 0, 538, 582, 0, 572, 0, 846, 0, 0, 131, 159, 183, 900,
+  0, 4, 458, 353, 0, 0, 0, 0, 0, 510, 64, 857, 0, 0, 0, 57,
+  0, 498, 739, 412, 638, 923, 0, 0, 0, 516, 517, 0, 426, 711, 138, 305,
+};
+
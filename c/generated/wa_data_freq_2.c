@@ -0,0 +1,13748 @@
+#include "worldalphabets_data.h"
+
+const char *WA_FREQ_30_TOKENS[] = {
+  "yn",
+  "n",
+  "dw",
+  "i",
+  "mae",
+  "r",
+  "hi",
+  "bwyta",
+  "afalau",
+  "aml",
+  "ty",
+  "fach",
+  "nid",
+  "yw",
+  "cymru",
+  "ar",
+  "werth",
+  "eisiau",
+  "bod",
+  "arwres",
+  "dwlu",
+  "dy",
+  "ardd",
+  "wnewch",
+  "chi",
+  "ail",
+  "adrodd",
+  "fwy",
+  "araf",
+  "os",
+  "gwelwch",
+  "dda",
+  "dyw",
+  "tom",
+  "ddim",
+  "gallu",
+  "gweithio",
+  "wythnos",
+  "yma",
+  "cymerwch",
+  "y",
+  "prawf",
+  "lliw",
+  "wrin",
+  "welaist",
+  "ti",
+  "ei",
+  "hwyneb",
+  "dysgu",
+  "cymraeg",
+};
+const uint16_t WA_FREQ_30_RANKS[] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 7,
+  0, 0, 0, 23, 0, 18, 47, 12, 0, 13, 0, 0, 0, 0, 0, 24,
+  0, 0, 0, 35, 0, 25, 29, 3, 0, 0, 50, 0, 46, 0, 0, 28,
+  0, 0, 0, 0, 0, 0, 0, 0, 42, 20, 26, 41, 43, 0, 0, 21,
+  0, 0, 0, 0, 0, 30, 0, 45, 0, 0, 10, 27, 48, 8, 0, 2,
+  11, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 36, 40, 0, 0, 0,
+  15, 0, 0, 16, 19, 5, 0, 0, 0, 0, 0, 0, 37, 0, 4, 6,
+  1, 33, 34, 22, 39, 32, 44, 49, 17, 0, 0, 0, 0, 0, 31, 38,
+};
+
+const char *WA_FREQ_31_TOKENS[] = {
+  "jeg",
+  "det",
+  "er",
+  "du",
+  "ikke",
+  "at",
+  "i",
+  "en",
+  "og",
+  "har",
+  "vi",
+  "til",
+  "på",
+  "hvad",
+  "med",
+  "så",
+  "for",
+  "mig",
+  "der",
+  "han",
+  "dig",
+  "de",
+  "den",
+  "kan",
+  "af",
+  "var",
+  "vil",
+  "her",
+  "et",
+  "skal",
+  "men",
+  "ved",
+  "om",
+  "nu",
+  "ja",
+  "som",
+  "hun",
+  "nej",
+  "min",
+  "noget",
+  "ham",
+  "være",
+  "bare",
+  "din",
+  "hvor",
+  "må",
+  "hvis",
+  "os",
+  "kom",
+  "ud",
+  "dem",
+  "godt",
+  "fra",
+  "have",
+  "ville",
+  "se",
+  "gør",
+  "okay",
+  "hvorfor",
+  "alle",
+  "lige",
+  "op",
+  "hende",
+  "sig",
+  "hvordan",
+  "tror",
+  "tak",
+  "gøre",
+  "kunne",
+  "lad",
+  "kommer",
+  "havde",
+  "eller",
+  "meget",
+  "nok",
+  "få",
+  "da",
+  "ingen",
+  "man",
+  "gå",
+  "går",
+  "hvem",
+  "bliver",
+  "efter",
+  "sagde",
+  "tilbage",
+  "når",
+  "alt",
+  "måske",
+  "også",
+  "jo",
+  "mit",
+  "ind",
+  "vores",
+  "hej",
+  "mere",
+  "hans",
+  "skulle",
+  "blev",
+  "nogen",
+  "lidt",
+  "aldrig",
+  "får",
+  "siger",
+  "selv",
+  "far",
+  "over",
+  "to",
+  "kun",
+  "sådan",
+  "ser",
+  "dit",
+  "jer",
+  "igen",
+  "mor",
+  "sammen",
+  "tager",
+  "mand",
+  "hele",
+  "deres",
+  "dag",
+  "tage",
+  "mine",
+  "sige",
+  "gjorde",
+  "fordi",
+  "end",
+  "undskyld",
+  "før",
+  "været",
+  "komme",
+  "hold",
+  "væk",
+  "dette",
+  "blive",
+  "år",
+  "ned",
+  "helt",
+  "fik",
+  "tid",
+  "denne",
+  "god",
+  "gang",
+  "laver",
+  "nogle",
+  "sted",
+  "mange",
+  "folk",
+  "dine",
+  "tale",
+  "mener",
+  "tag",
+  "ting",
+  "siden",
+  "finde",
+  "altid",
+  "brug",
+  "stadig",
+  "hjem",
+  "virkelig",
+  "åh",
+  "fint",
+  "anden",
+  "lille",
+  "kender",
+  "andre",
+  "elsker",
+  "liv",
+  "intet",
+  "tog",
+  "ret",
+  "gerne",
+  "uden",
+  "vent",
+  "hendes",
+  "vel",
+  "lide",
+  "hjælpe",
+  "set",
+  "mod",
+  "troede",
+  "tre",
+  "vide",
+  "gud",
+  "gik",
+  "klar",
+  "bedre",
+  "vej",
+  "gjort",
+  "sidste",
+  "sker",
+  "død",
+  "samme",
+  "vidste",
+  "sin",
+  "fanden",
+  "forstår",
+  "arbejde",
+  "nå",
+  "hør",
+  "første",
+  "giv",
+  "penge",
+  "hjælp",
+  "andet",
+  "hen",
+  "ven",
+  "giver",
+  "aften",
+  "blevet",
+  "jeres",
+  "give",
+  "burde",
+  "høre",
+  "taler",
+  "længe",
+  "eneste",
+  "morgen",
+  "endnu",
+  "under",
+  "holde",
+  "fandt",
+  "bruge",
+  "skat",
+  "synes",
+  "bedste",
+  "står",
+  "venner",
+  "fortælle",
+  "sikker",
+  "finder",
+  "vær",
+  "navn",
+  "skete",
+  "måde",
+  "tro",
+  "døde",
+  "sikkert",
+  "hos",
+  "selvfølgelig",
+  "holder",
+  "par",
+  "hedder",
+  "nødt",
+  "flere",
+  "fået",
+  "behøver",
+  "hver",
+  "først",
+  "engang",
+  "vist",
+  "verden",
+  "betyder",
+  "ude",
+  "ellers",
+  "snart",
+  "stop",
+  "stor",
+  "sir",
+  "bange",
+  "børn",
+  "næste",
+  "faktisk",
+  "gav",
+  "søn",
+  "pige",
+  "fyr",
+  "prøver",
+  "ked",
+  "derfor",
+  "hallo",
+  "familie",
+  "gange",
+  "gode",
+  "tiden",
+  "øjeblik",
+  "nye",
+  "store",
+  "lade",
+  "lave",
+  "ligesom",
+  "alene",
+  "mænd",
+  "møde",
+  "ihjel",
+  "skyld",
+  "sagt",
+  "gamle",
+  "dage",
+  "galt",
+  "mennesker",
+  "kone",
+  "mr",
+  "altså",
+  "ses",
+  "fundet",
+  "allerede",
+  "arbejder",
+  "grund",
+  "slags",
+  "stille",
+  "én",
+  "fem",
+  "hvornår",
+  "taget",
+  "ønsker",
+  "dø",
+  "rigtig",
+  "glad",
+  "orden",
+  "huske",
+  "længere",
+  "disse",
+  "farvel",
+  "slå",
+  "hørte",
+  "lyder",
+  "begge",
+  "bil",
+  "dræbe",
+  "hinanden",
+  "hørt",
+  "del",
+  "rigtigt",
+  "minutter",
+  "barn",
+  "politiet",
+  "fejl",
+  "s",
+  "senere",
+  "bilen",
+  "håber",
+  "kvinde",
+  "hører",
+  "haft",
+  "virker",
+  "herfra",
+  "fire",
+  "l",
+  "tænkte",
+  "kommet",
+  "sket",
+  "dør",
+  "helvede",
+  "hus",
+  "fortæl",
+  "rolig",
+  "venter",
+  "hurtigt",
+  "frem",
+  "klare",
+  "kører",
+  "ny",
+  "heller",
+  "spørgsmål",
+  "langt",
+  "rundt",
+  "bror",
+  "næsten",
+  "hvilken",
+  "byen",
+  "bliv",
+  "sandt",
+  "gået",
+  "livet",
+  "pas",
+  "leder",
+  "bør",
+  "indtil",
+  "fortalte",
+  "side",
+  "inden",
+  "hellere",
+  "ringer",
+  "bad",
+  "imod",
+  "videre",
+  "hey",
+  "tænker",
+  "lort",
+  "mr.",
+  "ingenting",
+  "mens",
+  "beklager",
+  "pis",
+  "sit",
+  "problem",
+  "ord",
+  "vejen",
+  "sød",
+  "ondt",
+  "dreng",
+  "sent",
+  "sjovt",
+  "sæt",
+  "klarer",
+  "lang",
+  "job",
+  "inde",
+  "datter",
+  "problemer",
+  "timer",
+  "hr",
+  "prøve",
+  "svært",
+  "køre",
+  "nogensinde",
+  "bag",
+  "lader",
+  "snakke",
+  "færdig",
+  "vise",
+  "stedet",
+  "ligner",
+  "ti",
+  "hr.",
+  "dræbte",
+  "egen",
+  "gammel",
+  "hjemme",
+  "ok",
+  "forbi",
+  "tænk",
+  "fantastisk",
+  "dog",
+  "bor",
+  "mad",
+  "fri",
+  "pengene",
+  "sidder",
+  "tænke",
+  "stoppe",
+  "john",
+  "gennem",
+  "føler",
+  "omkring",
+  "ad",
+  "ske",
+  "igennem",
+  "mellem",
+  "velkommen",
+  "kæft",
+  "måtte",
+  "ringe",
+  "hader",
+  "fat",
+  "jack",
+  "løb",
+  "stå",
+  "spise",
+  "vente",
+  "chance",
+  "flot",
+  "ligger",
+  "slet",
+  "nyt",
+  "slap",
+  "døren",
+  "våben",
+  "slår",
+  "kalder",
+  "husker",
+  "handler",
+  "ring",
+  "passer",
+  "hvilket",
+  "fortæller",
+  "beder",
+  "mest",
+  "lavet",
+  "huset",
+  "al",
+  "tæt",
+  "snakker",
+  "uge",
+  "seks",
+  "hovedet",
+  "spørge",
+  "hånd",
+  "søster",
+  "leve",
+  "plads",
+  "hjælper",
+  "redde",
+  "sgu",
+  "holdt",
+  "historie",
+  "sine",
+  "resten",
+  "ben",
+  "bruger",
+  "helst",
+  "fast",
+  "talte",
+  "dræbt",
+  "stort",
+  "glem",
+  "blod",
+  "live",
+  "nummer",
+  "the",
+  "kæreste",
+  "new",
+  "sandheden",
+  "sagen",
+  "jorden",
+  "begynder",
+  "måneder",
+  "tur",
+  "spille",
+  "kvinder",
+  "slog",
+  "nat",
+  "seng",
+  "lavede",
+  "valg",
+  "gift",
+  "skide",
+  "piger",
+  "ringede",
+  "prøv",
+  "fuld",
+  "time",
+  "alligevel",
+  "lære",
+  "idé",
+  "værsgo",
+  "vand",
+  "spiller",
+  "drenge",
+  "tænkt",
+  "tidligere",
+  "kort",
+  "mindre",
+  "besked",
+  "talt",
+  "rigtige",
+  "prøvede",
+  "præcis",
+  "foregår",
+  "læg",
+  "masse",
+  "øjne",
+  "klokken",
+  "forkert",
+  "hårdt",
+  "fedt",
+  "agent",
+  "dagen",
+  "smuk",
+  "kaptajn",
+  "øje",
+  "forstå",
+  "elskede",
+  "slut",
+  "forældre",
+  "lov",
+  "sætte",
+  "fortalt",
+  "muligt",
+  "kærlighed",
+  "lever",
+  "sam",
+  "mening",
+  "hvert",
+  "dr.",
+  "hjerte",
+  "chef",
+  "sætter",
+  "foran",
+  "vigtigt",
+  "ligeglad",
+  "arbejdet",
+  "sjov",
+  "perfekt",
+  "små",
+  "luk",
+  "uger",
+  "forstået",
+  "lover",
+  "aner",
+  "slip",
+  "sag",
+  "vis",
+  "lyst",
+  "viser",
+  "fred",
+  "dollars",
+  "værre",
+  "aftale",
+  "sidst",
+  "find",
+  "spørger",
+  "steder",
+  "tom",
+  "plan",
+  "rejse",
+  "udenfor",
+  "hente",
+  "svar",
+  "dræber",
+  "unge",
+  "ansigt",
+  "ej",
+  "held",
+  "købe",
+  "værd",
+  "betale",
+  "kendte",
+  "dårligt",
+  "klart",
+  "endelig",
+  "beskytte",
+  "findes",
+  "spil",
+  "roligt",
+  "let",
+  "sender",
+  "værelse",
+  "stod",
+  "fyre",
+  "dårlig",
+  "bede",
+  "land",
+  "henter",
+  "derude",
+  "oppe",
+  "begyndte",
+  "hoved",
+  "person",
+  "stykke",
+  "træt",
+  "by",
+  "manden",
+  "sex",
+  "sikke",
+  "natten",
+  "kære",
+  "sikkerhed",
+  "mødes",
+  "sove",
+  "ønske",
+  "skynd",
+  "idiot",
+  "fald",
+  "dr",
+  "tøj",
+  "miss",
+  "bo",
+  "mangler",
+  "hva",
+  "kaffe",
+  "sidde",
+  "føles",
+  "godmorgen",
+  "nede",
+  "frank",
+  "røven",
+  "lykke",
+  "millioner",
+  "mente",
+  "givet",
+  "derinde",
+  "jamen",
+  "dum",
+  "syg",
+  "søde",
+  "rart",
+  "mindste",
+  "kl",
+  "husk",
+  "kæmpe",
+  "hænder",
+  "mærke",
+  "rette",
+  "svin",
+  "lod",
+  "york",
+  "film",
+  "desværre",
+  "krig",
+  "tal",
+  "skrive",
+  "forhold",
+  "skade",
+  "herre",
+  "fængsel",
+  "spurgte",
+  "syv",
+  "større",
+  "familien",
+  "godnat",
+  "skyde",
+  "lig",
+  "øjnene",
+  "spiser",
+  "følge",
+  "følger",
+  "goddag",
+  "hund",
+  "herrer",
+  "vinder",
+  "godeste",
+  "træk",
+  "anderledes",
+  "kamp",
+  "uanset",
+  "blot",
+  "gider",
+  "sendte",
+  "drikke",
+  "travlt",
+  "charlie",
+  "vild",
+  "afsted",
+  "fest",
+  "tillykke",
+  "venstre",
+  "passe",
+  "betaler",
+  "læse",
+  "kør",
+  "dollar",
+  "skød",
+  "brugte",
+  "vred",
+  "stole",
+  "skole",
+  "joe",
+  "mike",
+  "højt",
+  "højre",
+  "bekymret",
+  "michael",
+  "tjeneste",
+  "tja",
+  "hertil",
+  "utroligt",
+  "straks",
+  "onkel",
+  "åbne",
+  "råd",
+  "kørte",
+  "telefon",
+  "skudt",
+  "fru",
+  "knægt",
+  "største",
+  "løbe",
+  "otte",
+  "skolen",
+  "sende",
+  "hår",
+  "forklare",
+  "dejligt",
+  "kontor",
+  "sendt",
+  "javel",
+  "eget",
+  "vejret",
+  "tingene",
+  "fbi",
+  "damer",
+  "pigen",
+  "ung",
+  "billede",
+  "lede",
+  "pistol",
+  "peter",
+  "david",
+  "børnene",
+  "mord",
+  "menneske",
+  "fandens",
+  "spor",
+  "normalt",
+  "dele",
+  "ende",
+  "bog",
+  "mødte",
+  "hvide",
+  "mødt",
+  "kigger",
+  "ægte",
+  "vinde",
+  "doktor",
+  "mistet",
+  "dyr",
+  "indenfor",
+  "sover",
+  "stopper",
+  "glemt",
+  "læge",
+  "skyder",
+  "bord",
+  "fyren",
+  "bedst",
+  "røv",
+  "elske",
+  "faldt",
+  "lys",
+  "slemt",
+  "lyver",
+  "george",
+  "begynde",
+  "ha",
+  "betjent",
+  "slået",
+  "sikre",
+  "forlade",
+  "advokat",
+  "ændre",
+  "beviser",
+  "aftes",
+  "fanget",
+  "telefonen",
+  "lærer",
+  "baby",
+  "kendt",
+  "dumme",
+  "overhovedet",
+  "sort",
+  "ene",
+  "usa",
+  "kalde",
+  "middag",
+  "herinde",
+  "forsøger",
+  "james",
+  "sekunder",
+  "født",
+  "skrev",
+  "kig",
+  "skriver",
+  "hænderne",
+  "selvom",
+  "nemlig",
+  "mistede",
+  "landet",
+  "arbejdede",
+  "tidspunkt",
+  "smukt",
+  "falder",
+  "flytte",
+  "hent",
+  "problemet",
+  "underligt",
+  "skylder",
+  "egne",
+  "brugt",
+  "oh",
+  "sad",
+  "smukke",
+  "fly",
+  "fare",
+  "rejser",
+  "umuligt",
+  "ærligt",
+  "ide",
+  "vildt",
+  "øl",
+  "prøvet",
+  "slippe",
+  "fuck",
+  "hospitalet",
+  "skyd",
+  "kende",
+  "tidligt",
+  "dame",
+  "skør",
+  "stolt",
+  "løber",
+  "fars",
+  "sat",
+  "lægge",
+  "rent",
+  "føle",
+  "enhver",
+  "netop",
+  "mund",
+  "makker",
+  "døden",
+  "drink",
+  "pokker",
+  "billeder",
+  "pris",
+  "alting",
+  "sælge",
+  "fange",
+  "reddede",
+  "ødelægge",
+  "vandet",
+  "stemme",
+  "kigge",
+  "tør",
+  "savner",
+  "sorte",
+  "løgn",
+  "gave",
+  "krop",
+  "kontakt",
+  "ringet",
+  "fortsæt",
+  "sur",
+  "stoler",
+  "ære",
+  "forsigtig",
+  "fleste",
+  "sid",
+  "starte",
+  "ordne",
+  "præsident",
+  "glemme",
+  "stærk",
+  "rør",
+  "miste",
+  "sang",
+  "stil",
+  "glemte",
+  "pænt",
+  "gutter",
+  "halv",
+  "åben",
+  "naturligvis",
+  "færdige",
+  "mrs",
+  "angreb",
+  "lægger",
+  "lkke",
+  "smule",
+  "ender",
+  "forkerte",
+  "fin",
+  "skidt",
+  "tony",
+  "lukket",
+  "pa",
+  "pludselig",
+  "hav",
+  "drøm",
+  "ryger",
+  "barnet",
+  "skål",
+  "stjal",
+  "syntes",
+  "følg",
+  "mary",
+  "midt",
+  "sulten",
+  "vender",
+  "følelser",
+  "hjalp",
+  "bestemt",
+  "direkte",
+  "øh",
+  "fortjener",
+  "starter",
+  "både",
+  "virkede",
+  "interessant",
+  "lejlighed",
+  "røvhul",
+  "vende",
+  "guds",
+  "henry",
+  "undskylde",
+  "overalt",
+  "paul",
+  "oberst",
+  "lært",
+  "derovre",
+  "ønskede",
+  "styr",
+  "masser",
+  "historien",
+  "nick",
+  "frue",
+  "tv",
+  "heldig",
+  "max",
+  "stykker",
+  "fører",
+  "køber",
+  "egentlig",
+  "sarah",
+  "mister",
+  "mål",
+  "kræver",
+  "ro",
+  "blå",
+  "jimmy",
+  "købte",
+  "sælger",
+  "a",
+  "værste",
+  "slipper",
+  "luften",
+  "forlod",
+  "minder",
+  "musik",
+};
+const uint16_t WA_FREQ_31_RANKS[] = {
+  0, 469, 169, 0, 605, 0, 0, 0, 500, 0, 0, 0, 0, 69, 0, 0,
+  0, 0, 0, 0, 231, 669, 151, 366, 534, 586, 634, 908, 525, 801, 963, 0,
+  0, 0, 931, 763, 115, 440, 356, 515, 977, 0, 0, 0, 645, 717, 616, 0,
+  0, 0, 0, 217, 0, 0, 26, 565, 0, 513, 526, 899, 0, 126, 0, 324,
+  0, 0, 0, 610, 0, 48, 0, 720, 893, 0, 964, 0, 483, 0, 0, 359,
+  0, 346, 0, 0, 0, 0, 0, 0, 495, 208, 819, 935, 0, 0, 352, 0,
+  161, 78, 0, 0, 219, 0, 0, 0, 832, 755, 732, 0, 0, 0, 0, 845,
+  0, 18, 0, 631, 0, 602, 92, 753, 795, 122, 322, 816, 75, 0, 0, 138,
+  467, 779, 0, 0, 0, 578, 0, 0, 0, 607, 123, 967, 723, 248, 320, 592,
+  0, 0, 0, 0, 918, 0, 0, 581, 813, 0, 684, 695, 0, 124, 186, 0,
+  131, 0, 116, 181, 414, 452, 923, 972, 982, 0, 0, 562, 0, 0, 911, 445,
+  944, 885, 0, 416, 96, 0, 451, 0, 0, 413, 0, 245, 428, 917, 761, 2,
+  980, 0, 261, 0, 345, 700, 938, 0, 0, 0, 557, 200, 0, 427, 748, 0,
+  0, 241, 712, 0, 0, 0, 0, 433, 0, 73, 310, 0, 449, 0, 58, 849,
+  379, 27, 143, 682, 894, 921, 206, 0, 172, 778, 0, 0, 10, 797, 572, 328,
+  850, 174, 0, 0, 0, 0, 0, 0, 0, 0, 0, 623, 0, 659, 0, 0,
+  0, 164, 0, 88, 253, 0, 311, 0, 439, 804, 0, 0, 426, 180, 398, 343,
+  458, 422, 636, 556, 74, 101, 589, 679, 721, 741, 752, 805, 815, 613, 0, 0,
+  703, 0, 0, 0, 727, 0, 0, 211, 276, 655, 0, 100, 0, 627, 271, 547,
+  0, 0, 473, 0, 0, 0, 234, 0, 0, 0, 374, 517, 0, 349, 606, 0,
+  681, 0, 0, 54, 0, 0, 0, 68, 0, 448, 857, 783, 940, 0, 176, 0,
+  991, 94, 990, 0, 539, 523, 661, 0, 529, 0, 0, 768, 733, 0, 0, 0,
+  0, 303, 671, 358, 858, 958, 0, 0, 332, 295, 0, 0, 0, 0, 0, 360,
+  0, 477, 0, 615, 0, 0, 926, 474, 0, 0, 188, 369, 621, 808, 0, 692,
+  882, 549, 554, 0, 0, 0, 0, 0, 0, 966, 960, 0, 0, 65, 0, 0,
+  968, 173, 408, 418, 728, 0, 543, 0, 375, 532, 625, 0, 0, 484, 654, 738,
+  198, 304, 490, 514, 520, 0, 0, 577, 872, 528, 566, 0, 49, 0, 0, 0,
+  370, 591, 257, 313, 994, 365, 9, 0, 0, 0, 0, 0, 649, 0, 390, 0,
+  0, 0, 0, 156, 0, 0, 705, 195, 491, 0, 608, 0, 0, 0, 665, 429,
+  823, 0, 0, 0, 0, 15, 301, 0, 434, 0, 824, 0, 0, 0, 0, 0,
+  0, 0, 0, 148, 350, 567, 0, 0, 0, 0, 368, 406, 0, 247, 0, 0,
+  0, 601, 228, 178, 0, 0, 937, 0, 501, 888, 856, 962, 0, 0, 238, 0,
+  0, 0, 0, 678, 0, 0, 0, 820, 863, 0, 0, 518, 0, 0, 0, 0,
+  0, 0, 873, 0, 431, 609, 0, 0, 0, 385, 279, 35, 130, 496, 900, 0,
+  0, 0, 0, 898, 0, 0, 0, 0, 0, 690, 354, 76, 598, 751, 827, 0,
+  0, 0, 0, 0, 442, 459, 961, 0, 60, 290, 0, 0, 0, 0, 479, 666,
+  612, 286, 57, 0, 0, 204, 372, 441, 163, 0, 0, 120, 106, 283, 604, 471,
+  626, 694, 762, 112, 838, 978, 995, 83, 0, 0, 954, 0, 949, 28, 0, 0,
+  97, 361, 953, 724, 0, 137, 0, 0, 0, 0, 0, 0, 421, 0, 843, 99,
+  466, 141, 745, 232, 974, 0, 499, 0, 648, 0, 855, 0, 0, 0, 0, 215,
+  560, 267, 405, 71, 842, 306, 0, 0, 0, 0, 0, 0, 269, 105, 691, 575,
+  680, 550, 714, 0, 0, 0, 0, 278, 785, 0, 0, 46, 892, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 716, 848, 603, 0, 0, 415, 0, 0, 0,
+  576, 21, 0, 766, 0, 383, 0, 0, 0, 0, 0, 0, 266, 381, 50, 79,
+  480, 698, 0, 0, 0, 0, 0, 462, 226, 476, 145, 44, 516, 0, 0, 82,
+  142, 0, 0, 113, 0, 0, 0, 582, 754, 0, 0, 0, 192, 0, 0, 553,
+  297, 758, 928, 0, 0, 281, 0, 773, 216, 362, 683, 747, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 402, 463, 0, 0, 0, 764, 355, 268, 618, 997, 653,
+  0, 0, 255, 0, 454, 0, 260, 0, 0, 0, 0, 0, 128, 530, 913, 242,
+  0, 0, 403, 331, 0, 0, 0, 689, 109, 0, 262, 456, 570, 465, 470, 574,
+  672, 296, 183, 673, 976, 487, 0, 540, 0, 722, 841, 0, 521, 533, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 638, 196, 158, 81, 455, 481, 930, 0, 0,
+  869, 0, 0, 357, 629, 0, 0, 453, 939, 0, 906, 633, 11, 0, 878, 0,
+  227, 0, 0, 0, 862, 860, 929, 0, 264, 0, 594, 133, 395, 909, 36, 307,
+  740, 37, 34, 338, 61, 308, 851, 0, 0, 0, 551, 0, 0, 0, 7, 0,
+  0, 973, 0, 0, 411, 0, 0, 292, 585, 0, 0, 866, 201, 0, 546, 0,
+  29, 552, 660, 0, 435, 0, 0, 0, 149, 309, 0, 969, 0, 0, 0, 0,
+  639, 0, 344, 0, 829, 298, 0, 924, 160, 0, 0, 0, 376, 0, 0, 0,
+  0, 0, 0, 0, 568, 0, 70, 0, 0, 0, 548, 0, 24, 52, 735, 919,
+  494, 182, 0, 0, 0, 0, 775, 0, 171, 89, 31, 437, 749, 656, 793, 686,
+  945, 0, 545, 464, 0, 0, 0, 0, 0, 19, 80, 0, 0, 0, 380, 254,
+  564, 0, 475, 0, 0, 0, 0, 584, 0, 139, 340, 0, 0, 614, 760, 0,
+  0, 446, 489, 312, 0, 299, 0, 205, 0, 300, 830, 0, 868, 628, 289, 914,
+  0, 0, 0, 0, 0, 0, 224, 0, 0, 0, 0, 0, 988, 0, 0, 0,
+  810, 0, 915, 0, 922, 0, 225, 213, 814, 0, 250, 378, 0, 0, 0, 0,
+  0, 0, 542, 512, 620, 696, 274, 409, 840, 0, 229, 329, 786, 0, 0, 410,
+  0, 719, 0, 890, 0, 981, 874, 0, 0, 0, 831, 674, 0, 0, 0, 502,
+  707, 870, 0, 0, 955, 0, 0, 821, 0, 0, 251, 0, 0, 904, 236, 0,
+  0, 212, 423, 497, 0, 95, 0, 391, 0, 0, 847, 42, 394, 731, 64, 401,
+  677, 651, 0, 0, 189, 875, 5, 0, 641, 0, 0, 0, 0, 0, 154, 0,
+  0, 436, 846, 210, 63, 713, 486, 742, 535, 537, 144, 544, 736, 912, 647, 595,
+  658, 0, 624, 975, 153, 887, 0, 0, 0, 125, 941, 0, 43, 0, 243, 920,
+  0, 0, 0, 0, 3, 373, 87, 999, 16, 280, 718, 0, 774, 482, 0, 0,
+  0, 0, 583, 317, 444, 134, 590, 667, 351, 979, 0, 22, 33, 272, 371, 377,
+  392, 852, 746, 6, 0, 347, 0, 599, 0, 342, 0, 420, 0, 0, 0, 0,
+  507, 0, 676, 511, 147, 984, 0, 0, 0, 0, 72, 86, 14, 127, 457, 663,
+  803, 0, 0, 0, 0, 0, 177, 0, 0, 13, 0, 0, 943, 0, 907, 0,
+  0, 341, 107, 118, 0, 0, 811, 0, 0, 0, 0, 364, 0, 0, 207, 0,
+  0, 527, 0, 643, 284, 0, 0, 0, 0, 0, 0, 822, 780, 0, 0, 0,
+  0, 0, 51, 146, 0, 0, 0, 0, 0, 580, 0, 0, 895, 0, 0, 0,
+  0, 0, 0, 743, 0, 688, 791, 561, 0, 0, 503, 0, 0, 952, 0, 0,
+  199, 685, 249, 0, 20, 0, 0, 0, 333, 704, 867, 0, 0, 0, 45, 285,
+  334, 640, 802, 769, 807, 864, 884, 478, 901, 246, 784, 84, 102, 504, 588, 0,
+  0, 275, 59, 218, 0, 0, 0, 485, 0, 0, 0, 0, 0, 0, 559, 834,
+  0, 709, 0, 488, 0, 0, 190, 214, 277, 129, 759, 828, 0, 93, 23, 0,
+  0, 0, 0, 121, 646, 175, 956, 0, 0, 0, 0, 0, 90, 0, 0, 0,
+  0, 184, 55, 0, 0, 389, 879, 750, 0, 282, 622, 0, 367, 0, 0, 675,
+  737, 934, 0, 0, 166, 230, 0, 302, 335, 0, 0, 0, 0, 587, 0, 0,
+  0, 202, 0, 244, 0, 472, 53, 970, 0, 0, 0, 757, 0, 0, 865, 0,
+  0, 0, 0, 0, 0, 0, 41, 396, 0, 0, 0, 0, 0, 0, 985, 0,
+  0, 0, 0, 0, 85, 0, 771, 425, 363, 0, 781, 240, 0, 0, 0, 152,
+  0, 776, 460, 0, 0, 790, 0, 0, 948, 0, 0, 0, 0, 730, 197, 662,
+  235, 896, 203, 861, 903, 0, 0, 0, 0, 0, 800, 0, 825, 0, 0, 0,
+  0, 265, 0, 66, 946, 0, 0, 541, 0, 0, 0, 0, 327, 0, 0, 438,
+  0, 0, 0, 32, 508, 384, 630, 573, 0, 0, 650, 0, 0, 0, 0, 0,
+  711, 0, 0, 98, 0, 0, 0, 0, 0, 0, 165, 0, 0, 632, 0, 971,
+  417, 0, 739, 325, 818, 889, 0, 0, 258, 0, 0, 0, 765, 67, 702, 794,
+  708, 826, 886, 0, 0, 294, 62, 387, 221, 397, 987, 461, 635, 0, 103, 619,
+  40, 916, 0, 509, 233, 0, 0, 0, 157, 0, 876, 693, 880, 0, 0, 0,
+  839, 104, 0, 0, 0, 0, 0, 983, 382, 0, 0, 0, 348, 611, 506, 0,
+  0, 0, 0, 0, 0, 468, 0, 729, 0, 0, 0, 734, 942, 0, 0, 0,
+  443, 0, 30, 193, 287, 220, 0, 337, 0, 0, 0, 0, 0, 637, 56, 293,
+  563, 792, 910, 386, 0, 0, 0, 0, 0, 187, 706, 492, 989, 522, 0, 0,
+  0, 0, 0, 687, 1000, 0, 0, 400, 806, 817, 0, 0, 0, 0, 191, 0,
+  119, 0, 319, 353, 0, 0, 0, 0, 0, 0, 17, 155, 0, 0, 399, 0,
+  0, 159, 809, 505, 111, 0, 222, 273, 132, 223, 726, 0, 770, 0, 0, 110,
+  947, 0, 0, 844, 0, 0, 0, 897, 305, 424, 0, 600, 936, 0, 0, 0,
+  0, 531, 853, 0, 0, 91, 256, 0, 0, 237, 597, 670, 715, 959, 316, 0,
+  0, 0, 0, 4, 0, 326, 833, 0, 787, 0, 0, 108, 664, 0, 0, 0,
+  0, 291, 933, 0, 0, 0, 0, 0, 318, 0, 0, 0, 891, 927, 0, 140,
+  0, 0, 0, 0, 0, 0, 0, 167, 0, 330, 194, 0, 0, 725, 0, 0,
+  0, 8, 117, 0, 536, 0, 925, 0, 404, 796, 0, 0, 0, 315, 998, 0,
+  0, 782, 0, 336, 0, 837, 0, 0, 0, 0, 0, 162, 0, 0, 498, 569,
+  0, 871, 788, 965, 0, 0, 0, 0, 0, 0, 0, 0, 0, 321, 0, 0,
+  0, 699, 0, 799, 323, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  657, 767, 993, 524, 0, 0, 0, 0, 1, 430, 905, 0, 0, 393, 596, 447,
+  756, 812, 0, 135, 652, 39, 744, 950, 986, 0, 0, 0, 339, 558, 0, 0,
+  252, 407, 0, 798, 0, 0, 0, 0, 0, 0, 412, 0, 388, 0, 951, 0,
+  0, 0, 772, 0, 0, 0, 450, 0, 0, 0, 0, 0, 996, 0, 0, 0,
+  0, 881, 957, 992, 0, 0, 0, 510, 38, 0, 0, 419, 77, 288, 0, 0,
+  0, 170, 0, 668, 0, 0, 0, 136, 12, 150, 877, 0, 644, 555, 0, 0,
+  0, 0, 0, 0, 0, 0, 270, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 836, 0, 0, 0, 0, 0, 538, 168, 179,
+  0, 0, 0, 0, 932, 0, 0, 0, 883, 314, 0, 0, 0, 0, 0, 0,
+  0, 0, 432, 0, 0, 0, 493, 239, 0, 0, 0, 0, 185, 579, 0, 0,
+  642, 835, 0, 0, 263, 0, 0, 0, 571, 0, 710, 0, 593, 0, 0, 0,
+  0, 25, 859, 854, 0, 47, 114, 0, 0, 0, 0, 0, 209, 0, 697, 0,
+  902, 789, 0, 0, 777, 0, 0, 0, 519, 0, 0, 0, 0, 259, 617, 701,
+};
+
+const char *WA_FREQ_32_TOKENS[] = {
+  "ich",
+  "sie",
+  "das",
+  "ist",
+  "du",
+  "nicht",
+  "die",
+  "es",
+  "und",
+  "der",
+  "wir",
+  "was",
+  "zu",
+  "er",
+  "ein",
+  "in",
+  "ja",
+  "mir",
+  "mit",
+  "wie",
+  "den",
+  "mich",
+  "auf",
+  "dass",
+  "aber",
+  "eine",
+  "so",
+  "hat",
+  "hier",
+  "haben",
+  "für",
+  "sind",
+  "war",
+  "von",
+  "wenn",
+  "dich",
+  "ihr",
+  "nein",
+  "habe",
+  "an",
+  "bin",
+  "noch",
+  "nur",
+  "da",
+  "dir",
+  "sich",
+  "einen",
+  "uns",
+  "hast",
+  "dem",
+  "kann",
+  "gut",
+  "auch",
+  "schon",
+  "als",
+  "sein",
+  "mal",
+  "jetzt",
+  "ihn",
+  "dann",
+  "aus",
+  "meine",
+  "um",
+  "im",
+  "wird",
+  "mein",
+  "bist",
+  "doch",
+  "alles",
+  "weiß",
+  "keine",
+  "oder",
+  "nach",
+  "s",
+  "nichts",
+  "man",
+  "muss",
+  "werden",
+  "will",
+  "ihnen",
+  "geht",
+  "wo",
+  "etwas",
+  "oh",
+  "mehr",
+  "bei",
+  "also",
+  "bitte",
+  "immer",
+  "hab",
+  "warum",
+  "vor",
+  "los",
+  "können",
+  "wieder",
+  "sagen",
+  "machen",
+  "danke",
+  "sehr",
+  "alle",
+  "denn",
+  "mann",
+  "tun",
+  "ihm",
+  "zum",
+  "gehen",
+  "sehen",
+  "vielleicht",
+  "einem",
+  "wer",
+  "ihre",
+  "diese",
+  "euch",
+  "einer",
+  "komm",
+  "über",
+  "gibt",
+  "okay",
+  "wissen",
+  "deine",
+  "müssen",
+  "soll",
+  "werde",
+  "nie",
+  "wirklich",
+  "hey",
+  "kein",
+  "viel",
+  "weg",
+  "würde",
+  "tut",
+  "am",
+  "des",
+  "einfach",
+  "leben",
+  "hatte",
+  "zeit",
+  "weil",
+  "willst",
+  "kommen",
+  "dein",
+  "heute",
+  "kommt",
+  "wollen",
+  "damit",
+  "ganz",
+  "wäre",
+  "wollte",
+  "weißt",
+  "ok",
+  "sicher",
+  "gesagt",
+  "frau",
+  "nun",
+  "bis",
+  "wurde",
+  "leid",
+  "na",
+  "kannst",
+  "macht",
+  "dieser",
+  "zurück",
+  "lassen",
+  "hallo",
+  "meinen",
+  "gott",
+  "seine",
+  "hätte",
+  "zwei",
+  "könnte",
+  "genau",
+  "waren",
+  "zur",
+  "lass",
+  "klar",
+  "morgen",
+  "leute",
+  "vater",
+  "schön",
+  "glaube",
+  "mr.",
+  "ab",
+  "gerade",
+  "tag",
+  "gesehen",
+  "reden",
+  "wohl",
+  "liebe",
+  "sollte",
+  "sagte",
+  "unsere",
+  "jemand",
+  "geld",
+  "durch",
+  "ob",
+  "keinen",
+  "mutter",
+  "raus",
+  "gemacht",
+  "paar",
+  "mach",
+  "passiert",
+  "dachte",
+  "besser",
+  "musst",
+  "wieso",
+  "sir",
+  "dieses",
+  "selbst",
+  "gehört",
+  "möchte",
+  "ohne",
+  "hör",
+  "her",
+  "sag",
+  "meiner",
+  "anderen",
+  "helfen",
+  "nacht",
+  "finden",
+  "diesen",
+  "gute",
+  "wirst",
+  "lange",
+  "natürlich",
+  "ach",
+  "meinem",
+  "gar",
+  "ins",
+  "sei",
+  "dort",
+  "weiter",
+  "geben",
+  "seit",
+  "gleich",
+  "sagt",
+  "recht",
+  "ihren",
+  "richtig",
+  "ordnung",
+  "vom",
+  "hören",
+  "sieht",
+  "davon",
+  "dafür",
+  "geh",
+  "diesem",
+  "wegen",
+  "hause",
+  "sollten",
+  "mädchen",
+  "hin",
+  "sollen",
+  "abend",
+  "haus",
+  "denke",
+  "viele",
+  "drei",
+  "deinen",
+  "freund",
+  "guten",
+  "unser",
+  "warte",
+  "machst",
+  "menschen",
+  "essen",
+  "angst",
+  "bleiben",
+  "zusammen",
+  "welt",
+  "unter",
+  "habt",
+  "schnell",
+  "andere",
+  "tot",
+  "getan",
+  "darf",
+  "erst",
+  "rein",
+  "stimmt",
+  "nehmen",
+  "kinder",
+  "eines",
+  "glauben",
+  "bringen",
+  "ganze",
+  "genug",
+  "scheiße",
+  "brauchen",
+  "gegen",
+  "moment",
+  "junge",
+  "steht",
+  "sonst",
+  "musik",
+  "arbeit",
+  "seid",
+  "ihrer",
+  "fragen",
+  "herr",
+  "dabei",
+  "heißt",
+  "familie",
+  "warten",
+  "niemand",
+  "sofort",
+  "bevor",
+  "jahre",
+  "einmal",
+  "problem",
+  "sohn",
+  "wann",
+  "brauche",
+  "fertig",
+  "halt",
+  "allein",
+  "beim",
+  "sprechen",
+  "beide",
+  "gefunden",
+  "hatten",
+  "sache",
+  "hilfe",
+  "verdammt",
+  "ne",
+  "jeder",
+  "warst",
+  "gern",
+  "konnte",
+  "darüber",
+  "halten",
+  "siehst",
+  "verstehe",
+  "jahren",
+  "kam",
+  "kind",
+  "wusste",
+  "wahr",
+  "seinen",
+  "dazu",
+  "bruder",
+  "daran",
+  "ihrem",
+  "denken",
+  "könnten",
+  "dank",
+  "würden",
+  "lieber",
+  "fall",
+  "deiner",
+  "sehe",
+  "egal",
+  "kennen",
+  "deinem",
+  "vergessen",
+  "frage",
+  "mache",
+  "komme",
+  "sage",
+  "mag",
+  "sieh",
+  "echt",
+  "gib",
+  "eigentlich",
+  "jeden",
+  "dad",
+  "gab",
+  "uhr",
+  "stadt",
+  "männer",
+  "baby",
+  "fahren",
+  "namen",
+  "bekommen",
+  "kopf",
+  "hi",
+  "gehe",
+  "kleine",
+  "später",
+  "glück",
+  "letzte",
+  "freunde",
+  "n",
+  "all",
+  "darauf",
+  "ende",
+  "dr.",
+  "bald",
+  "töten",
+  "dinge",
+  "meinst",
+  "toll",
+  "eins",
+  "minuten",
+  "vielen",
+  "bereit",
+  "weit",
+  "ahnung",
+  "seiner",
+  "bisschen",
+  "tür",
+  "auto",
+  "jungs",
+  "eure",
+  "augen",
+  "polizei",
+  "stehen",
+  "sterben",
+  "hätten",
+  "draußen",
+  "kenne",
+  "fast",
+  "runter",
+  "vorbei",
+  "treffen",
+  "gerne",
+  "dran",
+  "wurden",
+  "arbeiten",
+  "mom",
+  "verrückt",
+  "neue",
+  "ging",
+  "hinter",
+  "sorgen",
+  "einzige",
+  "jemanden",
+  "darum",
+  "tochter",
+  "braucht",
+  "idee",
+  "schwester",
+  "drin",
+  "ruhig",
+  "sah",
+  "ganzen",
+  "spät",
+  "ziemlich",
+  "solltest",
+  "name",
+  "sogar",
+  "kurz",
+  "kerl",
+  "frauen",
+  "liegt",
+  "suchen",
+  "finde",
+  "je",
+  "woher",
+  "lang",
+  "job",
+  "keiner",
+  "seinem",
+  "hört",
+  "verstehen",
+  "spielen",
+  "s.",
+  "überhaupt",
+  "teufel",
+  "verstanden",
+  "verloren",
+  "große",
+  "hand",
+  "grund",
+  "jahr",
+  "kommst",
+  "mama",
+  "ruhe",
+  "gewesen",
+  "tod",
+  "stunden",
+  "hoffe",
+  "denkst",
+  "oben",
+  "gestern",
+  "versuchen",
+  "art",
+  "letzten",
+  "schatz",
+  "endlich",
+  "he",
+  "nimm",
+  "etwa",
+  "erzählt",
+  "läuft",
+  "schwer",
+  "anders",
+  "miss",
+  "musste",
+  "fünf",
+  "wasser",
+  "lässt",
+  "erste",
+  "versucht",
+  "gekommen",
+  "geschichte",
+  "wenig",
+  "holen",
+  "bedeutet",
+  "nett",
+  "wahrheit",
+  "woche",
+  "bringt",
+  "deshalb",
+  "welche",
+  "bestimmt",
+  "hoch",
+  "alter",
+  "sagst",
+  "schau",
+  "ah",
+  "land",
+  "zimmer",
+  "wagen",
+  "vier",
+  "gefallen",
+  "spaß",
+  "niemals",
+  "schuld",
+  "getötet",
+  "wollten",
+  "verlassen",
+  "zeigen",
+  "beste",
+  "ernst",
+  "unserer",
+  "denen",
+  "ort",
+  "bleibt",
+  "würdest",
+  "manchmal",
+  "glaubst",
+  "seite",
+  "lasst",
+  "zwischen",
+  "eben",
+  "während",
+  "spiel",
+  "nehme",
+  "ersten",
+  "guter",
+  "chance",
+  "freundin",
+  "krieg",
+  "gefällt",
+  "kleinen",
+  "erzählen",
+  "anderes",
+  "tage",
+  "entschuldigen",
+  "wichtig",
+  "gehst",
+  "allen",
+  "bett",
+  "mrs.",
+  "sachen",
+  "the",
+  "schlecht",
+  "schule",
+  "entschuldigung",
+  "wort",
+  "john",
+  "hättest",
+  "wären",
+  "typ",
+  "schlafen",
+  "äh",
+  "tu",
+  "euer",
+  "captain",
+  "gesicht",
+  "falls",
+  "neuen",
+  "bloß",
+  "unten",
+  "teil",
+  "beiden",
+  "mensch",
+  "kleiner",
+  "stellen",
+  "oft",
+  "sorge",
+  "gedacht",
+  "tust",
+  "trinken",
+  "einige",
+  "dies",
+  "ding",
+  "unseren",
+  "kriegen",
+  "blut",
+  "ehrlich",
+  "eltern",
+  "scheint",
+  "herz",
+  "jack",
+  "glücklich",
+  "alte",
+  "alt",
+  "bleib",
+  "wiedersehen",
+  "frei",
+  "wen",
+  "drauf",
+  "möglich",
+  "irgendwie",
+  "reicht",
+  "fest",
+  "besten",
+  "waffe",
+  "kaum",
+  "irgendwas",
+  "klingt",
+  "platz",
+  "brauchst",
+  "rede",
+  "papa",
+  "falsch",
+  "sondern",
+  "alten",
+  "nummer",
+  "früher",
+  "jungen",
+  "wohin",
+  "außer",
+  "früh",
+  "setzen",
+  "zuerst",
+  "wahrscheinlich",
+  "dürfen",
+  "jede",
+  "arsch",
+  "telefon",
+  "tue",
+  "kennst",
+  "willkommen",
+  "plan",
+  "großen",
+  "retten",
+  "hierher",
+  "wär",
+  "bring",
+  "fehler",
+  "wollt",
+  "dollar",
+  "zehn",
+  "allem",
+  "pass",
+  "nächste",
+  "stunde",
+  "hände",
+  "gegeben",
+  "menge",
+  "langsam",
+  "bereits",
+  "wartet",
+  "sechs",
+  "lieben",
+  "meines",
+  "büro",
+  "nächsten",
+  "gebe",
+  "wochen",
+  "ruf",
+  "schaffen",
+  "leider",
+  "scheiß",
+  "hölle",
+  "trotzdem",
+  "doktor",
+  "tja",
+  "new",
+  "voll",
+  "film",
+  "überall",
+  "hund",
+  "geworden",
+  "direkt",
+  "wolltest",
+  "tat",
+  "denkt",
+  "schiff",
+  "neues",
+  "wem",
+  "könig",
+  "danach",
+  "funktioniert",
+  "hattest",
+  "lernen",
+  "deswegen",
+  "wow",
+  "nennen",
+  "hm",
+  "feuer",
+  "laufen",
+  "alleine",
+  "erinnern",
+  "völlig",
+  "kleines",
+  "könnt",
+  "stelle",
+  "kumpel",
+  "verlieren",
+  "probleme",
+  "spricht",
+  "kaffee",
+  "luft",
+  "fand",
+  "i",
+  "entschuldige",
+  "ziehen",
+  "verschwinden",
+  "könntest",
+  "seht",
+  "aufhören",
+  "eigenen",
+  "richtige",
+  "unserem",
+  "suche",
+  "zwar",
+  "groß",
+  "hol",
+  "buch",
+  "krank",
+  "fühle",
+  "jedes",
+  "verstehst",
+  "wert",
+  "arzt",
+  "froh",
+  "versuche",
+  "straße",
+  "rufen",
+  "heiraten",
+  "super",
+  "sam",
+  "lebt",
+  "gutes",
+  "lasse",
+  "onkel",
+  "total",
+  "gebracht",
+  "party",
+  "erklären",
+  "spielt",
+  "wahl",
+  "vertrauen",
+  "damals",
+  "tagen",
+  "leicht",
+  "nachdem",
+  "gegangen",
+  "gefühl",
+  "kaufen",
+  "geschafft",
+  "typen",
+  "interessiert",
+  "möchten",
+  "halte",
+  "hält",
+  "glaub",
+  "irgendwo",
+  "stück",
+  "genauso",
+  "kennt",
+  "genommen",
+  "zukunft",
+  "weniger",
+  "cool",
+  "licht",
+  "getroffen",
+  "himmel",
+  "nachricht",
+  "drüben",
+  "passt",
+  "sagten",
+  "kümmern",
+  "laut",
+  "vergiss",
+  "angerufen",
+  "sitzen",
+  "daß",
+  "erde",
+  "großer",
+  "schlüssel",
+  "rest",
+  "passieren",
+  "eher",
+  "gefragt",
+  "gefängnis",
+  "opfer",
+  "körper",
+  "solche",
+  "mist",
+  "mr",
+  "findet",
+  "schreiben",
+  "böse",
+  "gesprochen",
+  "versuch",
+  "vorstellen",
+  "wovon",
+  "sobald",
+  "nochmal",
+  "herren",
+  "sex",
+  "waffen",
+  "wohnung",
+  "weh",
+  "heißen",
+  "krankenhaus",
+  "bringe",
+  "höre",
+  "millionen",
+  "klasse",
+  "hart",
+  "worden",
+  "sinn",
+  "außerdem",
+  "verletzt",
+  "ändern",
+  "erfahren",
+  "tragen",
+  "wenigstens",
+  "vorsichtig",
+  "daddy",
+  "stolz",
+  "stark",
+  "fällt",
+  "möchtest",
+  "leuten",
+  "besonders",
+  "schöne",
+  "schicken",
+  "person",
+  "schätze",
+  "solange",
+  "länger",
+  "großartig",
+  "lacht",
+  "anrufen",
+  "stand",
+  "redest",
+  "fühlen",
+  "erwartet",
+  "boden",
+  "boss",
+  "stimme",
+  "glaubt",
+  "still",
+  "sicherheit",
+  "setz",
+  "ma",
+  "mund",
+  "kämpfen",
+  "wisst",
+  "lachen",
+  "hörst",
+  "zeug",
+  "lustig",
+  "umbringen",
+  "sollst",
+  "hasse",
+  "schlimm",
+  "o",
+  "unglaublich",
+  "wärst",
+  "laden",
+  "führen",
+  "gestorben",
+  "schauen",
+  "meinung",
+  "lesen",
+  "mörder",
+  "frank",
+  "ähm",
+  "geschehen",
+  "geschäft",
+  "idiot",
+  "verzeihung",
+  "fliegen",
+  "zeig",
+  "team",
+  "general",
+  "mike",
+  "aufs",
+  "york",
+  "vorher",
+  "schluss",
+  "schneller",
+  "liebt",
+  "verdient",
+  "mögen",
+  "meisten",
+  "denk",
+  "umgebracht",
+  "perfekt",
+  "versprochen",
+  "handy",
+  "hinten",
+  "monate",
+  "erinnere",
+  "acht",
+  "arbeitet",
+  "fallen",
+  "rufe",
+  "nötig",
+  "a",
+  "mord",
+  "heraus",
+  "tages",
+  "unmöglich",
+  "liebling",
+  "charlie",
+  "tatsächlich",
+  "folgen",
+  "bitten",
+  "behalten",
+  "nähe",
+  "arbeite",
+  "joe",
+  "verdammte",
+  "plötzlich",
+  "lebens",
+  "hole",
+  "tisch",
+  "michael",
+  "hörte",
+  "jemals",
+  "liegen",
+  "verkaufen",
+  "gefährlich",
+  "anfangen",
+  "bekommt",
+  "machte",
+  "ha",
+  "hotel",
+  "hilft",
+  "werdet",
+  "meister",
+  "kampf",
+  "antwort",
+  "konnten",
+  "geschickt",
+  "jedem",
+  "obwohl",
+  "sieben",
+  "komisch",
+  "gewinnen",
+  "ihres",
+  "bezahlt",
+  "you",
+  "voller",
+  "unterwegs",
+  "dumm",
+  "ärger",
+  "bild",
+  "george",
+  "neu",
+  "bezahlen",
+  "dagegen",
+  "seien",
+  "starb",
+  "tom",
+  "monaten",
+  "leiche",
+  "niemanden",
+  "auge",
+  "arschloch",
+  "verheiratet",
+  "peter",
+  "zieh",
+  "nimmt",
+  "gerettet",
+  "agent",
+  "traum",
+  "entscheidung",
+  "schlimmer",
+  "regeln",
+  "fenster",
+  "fangen",
+  "fort",
+  "ständig",
+  "findest",
+  "gefahr",
+  "absolut",
+  "mary",
+  "augenblick",
+  "bescheid",
+  "rum",
+  "gedanken",
+  "werd",
+  "ziel",
+  "benutzt",
+  "bewegung",
+  "jemandem",
+  "wünschte",
+  "worte",
+  "kamen",
+  "welcher",
+};
+const uint16_t WA_FREQ_32_RANKS[] = {
+  0, 0, 86, 375, 477, 532, 605, 0, 621, 0, 296, 360, 0, 0, 933, 0,
+  0, 0, 888, 889, 0, 0, 0, 0, 0, 0, 0, 0, 0, 332, 0, 29,
+  0, 0, 0, 0, 661, 646, 369, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 983, 495, 597, 322, 604, 878, 0, 0, 0, 0, 0, 729, 0, 0, 751,
+  0, 0, 0, 0, 0, 0, 640, 0, 0, 0, 0, 0, 136, 64, 0, 0,
+  0, 0, 0, 0, 239, 0, 0, 0, 0, 0, 0, 379, 276, 546, 304, 926,
+  0, 431, 0, 631, 686, 261, 0, 0, 298, 0, 0, 0, 0, 0, 0, 0,
+  0, 825, 0, 0, 0, 680, 19, 0, 636, 549, 583, 847, 0, 0, 0, 105,
+  0, 0, 0, 396, 565, 0, 0, 986, 0, 0, 0, 787, 645, 437, 346, 272,
+  376, 444, 842, 0, 391, 0, 0, 0, 514, 0, 0, 855, 4, 175, 0, 789,
+  357, 358, 882, 143, 333, 542, 216, 896, 67, 910, 668, 675, 979, 134, 993, 0,
+  0, 490, 894, 0, 0, 0, 805, 58, 831, 0, 0, 0, 141, 765, 883, 0,
+  0, 130, 222, 0, 676, 0, 289, 0, 0, 916, 620, 703, 714, 0, 0, 0,
+  30, 630, 0, 0, 0, 0, 0, 562, 323, 480, 615, 247, 817, 0, 118, 547,
+  377, 0, 0, 0, 0, 395, 455, 471, 416, 171, 386, 285, 764, 0, 0, 0,
+  0, 0, 0, 263, 75, 0, 271, 41, 0, 0, 870, 739, 0, 538, 523, 593,
+  283, 249, 515, 599, 0, 157, 70, 0, 0, 958, 0, 0, 0, 0, 451, 320,
+  0, 264, 365, 0, 877, 982, 674, 0, 229, 0, 66, 0, 0, 103, 0, 311,
+  0, 0, 0, 108, 0, 0, 0, 0, 173, 0, 0, 0, 0, 0, 164, 0,
+  0, 0, 653, 221, 669, 245, 87, 497, 766, 678, 469, 550, 775, 874, 0, 0,
+  287, 0, 560, 327, 564, 52, 0, 0, 234, 0, 0, 0, 0, 617, 577, 954,
+  232, 534, 666, 798, 0, 0, 0, 381, 0, 83, 0, 0, 301, 0, 568, 579,
+  0, 0, 0, 0, 69, 0, 618, 919, 335, 388, 501, 649, 0, 0, 576, 0,
+  88, 0, 0, 0, 760, 0, 246, 0, 0, 715, 612, 0, 313, 0, 364, 725,
+  0, 0, 153, 0, 761, 0, 0, 149, 223, 827, 242, 963, 992, 901, 0, 0,
+  548, 0, 0, 0, 11, 998, 0, 37, 893, 0, 752, 0, 0, 0, 758, 642,
+  899, 0, 0, 0, 961, 0, 0, 0, 0, 442, 387, 319, 491, 439, 117, 790,
+  0, 942, 0, 520, 908, 0, 527, 780, 49, 0, 0, 0, 0, 0, 0, 759,
+  453, 808, 0, 493, 0, 0, 0, 742, 0, 0, 746, 0, 0, 456, 0, 0,
+  905, 0, 0, 228, 378, 555, 0, 0, 0, 0, 373, 0, 0, 168, 0, 0,
+  801, 0, 60, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 502, 20, 104,
+  749, 741, 508, 195, 0, 0, 0, 0, 557, 696, 965, 202, 0, 0, 0, 784,
+  0, 0, 0, 887, 779, 898, 824, 286, 683, 0, 0, 732, 0, 654, 0, 0,
+  0, 704, 0, 541, 0, 0, 425, 0, 0, 928, 0, 17, 517, 0, 0, 0,
+  0, 0, 0, 0, 0, 297, 0, 0, 80, 629, 0, 581, 0, 51, 432, 498,
+  510, 535, 912, 705, 0, 257, 0, 0, 100, 337, 864, 0, 0, 0, 0, 0,
+  0, 0, 408, 710, 812, 0, 154, 0, 0, 0, 0, 0, 370, 0, 0, 383,
+  902, 0, 0, 0, 848, 0, 0, 852, 0, 0, 0, 0, 59, 214, 552, 0,
+  476, 0, 0, 0, 443, 0, 533, 876, 997, 0, 0, 0, 150, 315, 0, 275,
+  0, 0, 0, 635, 539, 0, 0, 366, 488, 0, 0, 0, 344, 0, 587, 0,
+  980, 446, 944, 575, 985, 0, 762, 0, 906, 389, 336, 208, 398, 0, 212, 689,
+  733, 897, 0, 563, 0, 0, 0, 0, 0, 281, 0, 0, 0, 15, 0, 251,
+  0, 0, 970, 0, 158, 18, 0, 608, 0, 115, 526, 0, 427, 968, 209, 0,
+  0, 0, 0, 0, 68, 845, 0, 0, 142, 772, 0, 0, 181, 707, 76, 799,
+  849, 0, 0, 0, 724, 0, 0, 0, 947, 0, 0, 189, 355, 382, 0, 0,
+  55, 677, 0, 0, 0, 504, 485, 0, 0, 217, 156, 274, 397, 785, 648, 966,
+  0, 922, 0, 0, 0, 0, 0, 0, 0, 659, 892, 940, 438, 57, 540, 900,
+  92, 521, 0, 147, 613, 0, 0, 0, 606, 721, 0, 884, 0, 972, 0, 0,
+  0, 334, 0, 0, 838, 7, 844, 973, 509, 0, 0, 0, 0, 0, 531, 586,
+  270, 483, 588, 652, 0, 0, 0, 0, 0, 0, 925, 0, 750, 0, 0, 403,
+  609, 404, 651, 662, 865, 0, 0, 655, 0, 0, 159, 394, 823, 22, 374, 829,
+  948, 572, 0, 0, 56, 122, 0, 454, 792, 0, 0, 0, 601, 0, 0, 0,
+  0, 0, 422, 0, 268, 36, 166, 368, 559, 0, 440, 492, 513, 657, 205, 722,
+  622, 0, 867, 991, 0, 500, 460, 578, 433, 0, 0, 93, 0, 0, 72, 91,
+  79, 238, 84, 348, 740, 891, 448, 402, 841, 0, 0, 0, 349, 628, 709, 0,
+  0, 0, 0, 0, 293, 0, 0, 0, 0, 0, 198, 0, 0, 923, 0, 781,
+  362, 956, 385, 452, 0, 0, 291, 0, 0, 0, 0, 135, 0, 0, 0, 321,
+  0, 324, 98, 434, 40, 248, 0, 0, 0, 0, 0, 913, 0, 345, 231, 279,
+  573, 953, 955, 1, 594, 0, 0, 0, 206, 0, 975, 0, 0, 39, 697, 0,
+  0, 125, 112, 0, 169, 788, 0, 0, 0, 0, 250, 664, 114, 218, 995, 479,
+  1000, 0, 401, 570, 0, 361, 144, 253, 611, 10, 0, 755, 227, 684, 0, 470,
+  393, 0, 457, 934, 866, 0, 290, 0, 0, 484, 0, 0, 459, 0, 0, 820,
+  638, 528, 172, 595, 177, 464, 445, 748, 904, 967, 380, 0, 0, 0, 816, 0,
+  34, 0, 0, 518, 129, 0, 0, 624, 0, 0, 0, 0, 0, 0, 145, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 203, 418, 0, 126, 151, 182, 796, 0,
+  267, 0, 0, 0, 163, 0, 0, 430, 0, 240, 74, 191, 187, 670, 192, 0,
+  0, 0, 415, 0, 0, 0, 63, 0, 0, 0, 0, 0, 569, 0, 0, 694,
+  0, 0, 233, 537, 0, 679, 325, 0, 312, 0, 28, 0, 0, 353, 8, 623,
+  0, 584, 589, 487, 0, 351, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 280, 0, 85, 0, 328, 429, 0, 0, 307, 204, 988, 0, 0,
+  0, 0, 771, 914, 0, 0, 0, 0, 0, 0, 671, 0, 0, 0, 0, 964,
+  421, 428, 512, 585, 797, 800, 306, 832, 949, 0, 196, 813, 0, 0, 174, 511,
+  529, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 449, 0,
+  0, 977, 48, 13, 113, 215, 516, 558, 197, 409, 743, 260, 303, 931, 210, 625,
+  0, 423, 574, 0, 282, 350, 0, 0, 0, 0, 0, 27, 650, 0, 716, 0,
+  819, 71, 723, 0, 763, 372, 0, 180, 354, 81, 0, 139, 553, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 851, 0, 0, 0, 839, 123, 0, 254,
+  0, 0, 343, 410, 0, 0, 969, 0, 0, 0, 0, 309, 0, 0, 673, 0,
+  0, 807, 783, 0, 0, 0, 0, 0, 0, 0, 162, 0, 102, 0, 0, 0,
+  0, 706, 50, 0, 2, 0, 0, 0, 0, 0, 690, 0, 853, 726, 0, 0,
+  0, 0, 0, 243, 0, 791, 561, 213, 472, 769, 672, 627, 744, 863, 946, 959,
+  821, 974, 727, 0, 0, 0, 0, 0, 0, 0, 0, 352, 0, 0, 0, 0,
+  0, 0, 0, 77, 971, 0, 417, 0, 0, 0, 0, 478, 0, 0, 0, 0,
+  536, 718, 0, 176, 190, 317, 544, 984, 0, 0, 0, 316, 545, 692, 886, 0,
+  120, 0, 0, 109, 0, 0, 0, 201, 0, 255, 698, 0, 543, 522, 21, 9,
+  90, 256, 691, 713, 0, 0, 937, 0, 0, 99, 0, 54, 338, 339, 0, 111,
+  367, 0, 981, 0, 392, 0, 225, 0, 435, 0, 0, 0, 0, 0, 0, 0,
+  0, 140, 6, 591, 0, 0, 405, 747, 0, 0, 0, 441, 0, 582, 843, 0,
+  0, 0, 0, 0, 0, 0, 73, 0, 0, 0, 0, 524, 685, 305, 989, 0,
+  0, 0, 330, 0, 0, 0, 0, 0, 160, 259, 717, 777, 47, 756, 860, 474,
+  0, 0, 699, 616, 61, 0, 0, 840, 0, 0, 363, 0, 0, 0, 0, 184,
+  774, 0, 220, 856, 915, 292, 0, 38, 665, 0, 0, 0, 407, 885, 0, 0,
+  0, 0, 0, 235, 0, 294, 127, 711, 35, 0, 486, 406, 116, 152, 0, 0,
+  506, 167, 667, 773, 818, 822, 0, 468, 643, 0, 0, 0, 0, 0, 0, 0,
+  610, 859, 0, 0, 0, 0, 835, 0, 0, 0, 0, 0, 0, 0, 33, 128,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 399, 600, 895, 0, 0,
+  462, 0, 0, 371, 0, 903, 200, 0, 0, 265, 804, 183, 0, 0, 0, 0,
+  0, 952, 0, 0, 0, 310, 3, 199, 426, 224, 450, 226, 466, 503, 598, 614,
+  806, 656, 811, 880, 950, 0, 0, 0, 0, 419, 850, 854, 0, 0, 592, 757,
+  868, 951, 0, 0, 347, 461, 46, 566, 632, 607, 0, 0, 0, 0, 0, 0,
+  976, 0, 834, 0, 178, 331, 571, 921, 911, 0, 767, 927, 0, 0, 0, 660,
+  110, 0, 300, 236, 237, 505, 688, 219, 708, 119, 530, 768, 45, 179, 556, 736,
+  262, 436, 795, 603, 131, 803, 826, 943, 0, 62, 211, 738, 0, 0, 0, 0,
+  0, 0, 0, 0, 295, 326, 996, 936, 0, 0, 0, 107, 475, 0, 507, 308,
+  712, 0, 815, 12, 0, 53, 0, 78, 314, 0, 0, 447, 0, 0, 0, 0,
+  782, 935, 43, 96, 132, 869, 0, 0, 0, 0, 0, 0, 0, 133, 0, 0,
+  987, 929, 0, 193, 0, 0, 0, 0, 0, 496, 0, 0, 0, 342, 0, 634,
+  647, 0, 0, 700, 828, 858, 26, 252, 590, 994, 0, 0, 0, 0, 121, 551,
+  0, 917, 999, 5, 0, 0, 695, 830, 0, 734, 932, 0, 0, 0, 318, 0,
+  945, 0, 0, 266, 359, 413, 930, 0, 0, 0, 0, 0, 0, 644, 0, 881,
+  0, 0, 0, 0, 658, 857, 0, 0, 0, 0, 0, 0, 138, 0, 0, 165,
+  230, 701, 0, 0, 754, 846, 0, 0, 0, 420, 0, 957, 0, 737, 519, 0,
+  241, 0, 619, 873, 0, 0, 693, 0, 89, 770, 990, 0, 862, 0, 0, 0,
+  101, 663, 0, 0, 0, 0, 0, 0, 0, 939, 918, 277, 94, 702, 0, 0,
+  0, 0, 0, 786, 390, 499, 682, 340, 278, 924, 0, 0, 0, 384, 0, 938,
+  802, 875, 82, 489, 814, 458, 0, 941, 302, 0, 0, 0, 0, 637, 0, 596,
+  0, 735, 411, 681, 269, 23, 124, 633, 0, 0, 244, 356, 299, 467, 155, 465,
+  0, 0, 0, 0, 861, 0, 0, 0, 0, 0, 0, 0, 0, 146, 0, 0,
+  0, 273, 909, 0, 0, 0, 719, 0, 0, 0, 0, 0, 97, 871, 0, 258,
+  567, 0, 0, 0, 0, 473, 836, 0, 778, 602, 0, 0, 44, 481, 106, 0,
+  833, 0, 0, 0, 0, 0, 148, 810, 0, 962, 728, 494, 879, 920, 753, 341,
+  95, 0, 0, 0, 0, 185, 194, 0, 0, 730, 25, 482, 794, 0, 731, 641,
+  0, 626, 720, 0, 0, 0, 0, 0, 0, 0, 16, 687, 0, 0, 0, 0,
+  0, 188, 0, 907, 0, 400, 525, 776, 0, 0, 161, 0, 745, 424, 0, 0,
+  288, 890, 0, 0, 65, 463, 412, 793, 978, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 42, 0, 872, 0, 554, 0, 960, 186, 137, 0, 580, 0,
+  639, 0, 0, 170, 0, 0, 809, 0, 0, 0, 0, 24, 0, 0, 284, 32,
+  329, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 414, 837, 207, 31, 0,
+};
+
+const char *WA_FREQ_33_TOKENS[] = {
+  "jo",
+  "njejo",
+  "mamy",
+  "rajs",
+  "trjebamy",
+  "kónje",
+  "cerkwja",
+  "tam",
+  "ma",
+  "bratša",
+  "abo",
+  "sotšu",
+  "witajśo",
+  "barliń",
+  "nimska",
+  "njejsy",
+  "głodna",
+  "wón",
+  "był",
+  "dobry",
+  "muzikaŕ",
+  "musym",
+  "hyś",
+  "do",
+  "šule",
+  "toś",
+  "ta",
+  "kócka",
+  "carna",
+};
+const uint16_t WA_FREQ_33_RANKS[] = {
+  28, 21, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 20, 0, 3, 0,
+  15, 19, 24, 0, 0, 0, 12, 11, 0, 0, 0, 0, 0, 4, 6, 0,
+  0, 13, 27, 16, 2, 29, 25, 26, 0, 0, 0, 0, 0, 0, 23, 0,
+  0, 10, 0, 0, 17, 1, 7, 0, 0, 0, 14, 0, 9, 5, 18, 8,
+};
+
+const char *WA_FREQ_34_TOKENS[] = {
+  "be",
+  "le",
+  "la",
+  "ɖe",
+  "si",
+  "me",
+  "ŋu",
+  "ƒe",
+  "nu",
+  "na",
+  "kple",
+  "siwo",
+  "dzi",
+  "nye",
+  "ame",
+  "eye",
+  "sia",
+  "wo",
+  "aɖe",
+  "wò",
+  "tso",
+  "hã",
+  "Mawu",
+  "Biblia",
+  "o",
+  "nya",
+  "ale",
+  "eƒe",
+  "ta",
+  "ɖo",
+  "ne",
+  "alo",
+  "gblɔ",
+  "ɖeka",
+  "Yehowa",
+  "Ne",
+  "o.",
+  "ene",
+  "Le",
+  "va",
+  "abe",
+  "dometɔ",
+  "katã",
+  "amewo",
+  "aɖewo",
+  "gbɔ",
+  "Yesu",
+  "edzi",
+  "geɖe",
+  "ate",
+  "Nu",
+  "ke",
+  "woƒe",
+  "eme",
+  "gbe",
+  "wu",
+  "ɖa",
+  "siawo",
+  "fia",
+  "esi",
+  "ŋutɔ",
+  "dze",
+  "to",
+  "Ame",
+  "kpɔ",
+  "dɔ",
+  "asi",
+  "se",
+  "ko",
+  "Eye",
+  "Ðe",
+  "yi",
+  "ye",
+  "enye",
+  "bubu",
+  "eŋu",
+  "nam",
+  "mɔ",
+  "nɛ",
+  "nɔ",
+  "Gake",
+  "susu",
+  "tae",
+  "wɔ",
+  "ma",
+  "ku",
+  "esia",
+  "dome",
+  "agbe",
+  "vevie",
+  "ɖi",
+  "kae",
+  "mí",
+  "nyui",
+  "te",
+  "do",
+  "bubuwo",
+  "afi",
+  "akpe",
+  "de",
+  "Ðasefowo",
+  "gake",
+  "tsɔ",
+  "gɔme",
+  "hafi",
+  "mía",
+  "Esi",
+  "nyuie",
+  "ana",
+  "ka",
+  "Yehowa Ðasefowo",
+  "míaƒe",
+  "akpa",
+  "ŋkɔ",
+  "kpe",
+  "wòle",
+  "eve",
+  "ƒo",
+  "ɣeyiɣi",
+  "ŋuwò",
+  "anyigba",
+  "anɔ",
+  "nɔnɔme",
+  "ya",
+  "anyi",
+  "dukɔwo",
+  "kpɔɖeŋu",
+  "Ke",
+  "xɔ",
+  "menye",
+  "teƒe",
+  "ele",
+  "elabena",
+  "geɖewo",
+  "zi",
+  "ŋku",
+  "ŋuti",
+  "mia",
+  "Eya",
+  "awɔ",
+  "nɔewo",
+  "Aleke",
+  "gome",
+  "mele",
+  "vi",
+  "eya",
+  "megbe",
+  "tsi",
+  "ŋkeke",
+  "ŋusẽ",
+  "koe",
+  "gɔ̃",
+  "dukɔ",
+  "ɖokuiwò",
+  "nɔa",
+  "dzidzɔ",
+  "tɔ",
+  "Esia",
+  "Nya",
+  "vevi",
+  "akpɔ",
+  "aɖeke",
+  "nàwɔ",
+  "nyawo",
+  "wole",
+  "agbagba",
+  "ŋutsu",
+  "Ƒe",
+  "ga",
+  "gbegbe",
+  "wònye",
+  "ŋgɔ",
+  "ŋunye",
+  "wɔwɔ",
+  "ade",
+  "li",
+  "yewo",
+  "ava",
+  "sɔ",
+  "aƒe",
+  "nuwo",
+  "xexea",
+  "go",
+  "miaƒe",
+  "wɔm",
+  "nanɔ",
+  "wɔa",
+  "David",
+  "boŋ",
+  "mi",
+  "ɖoɖo",
+  "dzesi",
+  "ŋkɔe",
+  "gbãtɔ",
+  "nyateƒe",
+  "vɔ̃",
+  "dzɔ",
+  "eɖokui",
+  "Kpɔ",
+  "fu",
+  "bɔbɔe",
+  "nyɔnu",
+  "srɔ̃",
+  "ʋu",
+  "agbalẽ",
+  "nenema",
+  "wowɔ",
+  "Ale",
+  "esime",
+  "faa",
+  "kpɔa",
+  "nana",
+  "ɣleti",
+  "gbɔna",
+  "doa",
+  "mawo",
+  "godoo",
+  "kpɔm",
+  "bena",
+  "dzo",
+  "etɔ̃",
+  "Kristo",
+  "woate",
+  "nàte",
+  "siaa",
+  "gã",
+  "Wo",
+  "blibo",
+  "ha",
+  "du",
+  "anye",
+  "aɖo",
+  "dziku",
+  "srɔ̃wò",
+  "nyaa",
+  "ɖea",
+  "ɖeɖe",
+  "wonye",
+  "Bu",
+  "Togbɔ",
+  "Wò",
+  "gbɔdɔdɔ",
+  "ge",
+  "vavã",
+  "ɖeko",
+  "atsɔ",
+  "kuxi",
+  "tututu",
+  "zu",
+  "amegbetɔwo",
+  "nane",
+  "viwòa",
+  "ɖee",
+  "gbɔgbɔ",
+  "ɖoa",
+  "ado",
+  "lae",
+  "wɔna",
+  "ɖokuinye",
+  "ayi",
+  "Ðasefo",
+  "àte",
+  "Egblɔ",
+  "fifia",
+  "woɖe",
+  "kɔ",
+  "Na",
+  "afia",
+  "ekema",
+  "wotsɔ",
+  "Elabena",
+  "alea",
+  "vovo",
+  "kpakple",
+  "sesẽ",
+  "viwo",
+  "zã",
+  "Ele",
+  "Eƒe",
+  "Fiaɖuƒea",
+  "akɔ",
+  "hã",
+  "nàkpɔ",
+  "Nye",
+  "bia",
+  "tsitre",
+  "aɖee",
+  "nyuiwo",
+  "vɔ",
+  "Fiaɖuƒe",
+  "Kristotɔwo",
+  "ase",
+  "da",
+  "gbã",
+  "lɔƒo",
+  "Àte",
+  "ɖokui",
+  "ɣesiaɣi",
+  "Europa",
+  "Israel",
+  "enu",
+  "kwasiɖa",
+  "yeƒe",
+  "Zi",
+  "dea",
+  "kuku",
+  "kura",
+  "nuwɔna",
+  "oa",
+  "woawɔ",
+  "èle",
+  "ɖokuiwo",
+  "dukɔa",
+  "mo",
+  "suku",
+  "ƒu",
+  "ɖevi",
+  "Ghana",
+  "hena",
+  "Amerika",
+  "dzea",
+  "dziƒo",
+  "xɔlɔ̃",
+  "ƒomea",
+  "adze",
+  "aɖewoe",
+  "dzilawo",
+  "lé",
+  "nèle",
+  "srɔ̃ɖeɖe",
+  "tɔwo",
+  "ŋkɔa",
+  "Afrika",
+  "Aƒetɔ",
+  "eyae",
+  "vovovowo",
+  "ɖekae",
+  "didi",
+  "dziwòlawo",
+  "alafa",
+  "kpli",
+  "sii",
+  "ƒomevi",
+  "afɔ",
+  "evɔ",
+  "gbɔe",
+  "nuɖuɖu",
+  "Mose",
+  "asa",
+  "egɔme",
+  "kee",
+  "woyɔna",
+  "yia",
+  "dzinye",
+  "egbea",
+  "gblẽ",
+  "lã",
+  "wɔe",
+  "Tso",
+  "asiwò",
+  "dɔa",
+  "mawɔ",
+  "srɔ̃a",
+  "tsia",
+  "wògblɔ",
+  "ŋkume",
+  "ŋutsuvi",
+  "ɖom",
+  "dziwò",
+  "evelia",
+  "loo",
+  "mate",
+  "srɔ̃nye",
+  "ŋutɔŋutɔ",
+  "elabe",
+  "nànɔ",
+  "ƒom",
+  "gãtɔ",
+  "kpɔe",
+  "mee",
+  "naneke",
+  "trɔ",
+  "wova",
+  "ɖeviwo",
+  "Enye",
+  "agblɔ",
+  "blema",
+  "bu",
+  "di",
+  "ema",
+  "gbegblẽ",
+  "vɛ",
+  "woanɔ",
+  "amea",
+  "kpena",
+  "lɔ̃",
+  "mekpɔ",
+  "sɔŋ",
+  "ƒoa",
+  "Susu",
+  "awu",
+  "aʋa",
+  "gblɔna",
+  "hiã",
+  "woɖo",
+  "ŋui",
+  "ɖem",
+  "Eʋegbe",
+  "agbenɔnɔ",
+  "egbɔ",
+  "gblɔm",
+  "kpekpeɖeŋu",
+  "mewɔ",
+  "nuwɔnawo",
+  "tea",
+  "tɔgbi",
+  "ŋlɔ",
+  "aƒo",
+  "emegbe",
+  "fe",
+  "kpɔkpɔ",
+  "woawo",
+  "ŋudzedze",
+  "ɖu",
+  "ɣeaɖewoɣi",
+  "Srɔ̃",
+  "anya",
+  "aɖaŋu",
+  "dzesii",
+  "eteƒe",
+  "kplii",
+  "mavɔ",
+  "sɔhɛ",
+  "wokpɔ",
+  "xoxo",
+  "yeye",
+  "Amewo",
+  "Xlẽ",
+  "atɔ̃",
+  "dziɖuɖu",
+  "kuxiwo",
+  "lɔlɔ̃",
+  "wòwɔ",
+  "Agbalẽ",
+  "Menye",
+  "asitelefon",
+  "dzie",
+  "gblɔe",
+  "míate",
+  "nɔnɔ",
+  "ƒome",
+  "Si",
+  "amegbetɔ",
+  "ehiã",
+  "kawoe",
+  "mɔ̃",
+  "pɛpɛpɛ",
+  "video",
+  "woatsɔ",
+  "ʋɛ",
+  "Kple",
+  "afɔku",
+  "aleke",
+  "lɔlɔ̃nu",
+  "nunana",
+  "nyati",
+  "nyo",
+  "tɔxɛ",
+  "woakpɔ",
+  "woaɖe",
+  "wòanɔ",
+  "Ðewohĩ",
+  "Ɣeaɖewoɣi",
+  "Yeye",
+  "fɔ",
+  "koŋ",
+  "míawɔ",
+  "míele",
+  "nenye",
+  "tsitsi",
+  "vɔ̃wo",
+  "ŋutifafa",
+  "Emegbe",
+  "Fia",
+  "ake",
+  "aɖu",
+  "kɔpiwɔwɔ",
+  "mea",
+  "nyea",
+  "nyuitɔ",
+  "nyɔnuvi",
+  "srɔ̃wòa",
+  "tiatiawo",
+  "tsoe",
+  "viwò",
+  "yeawɔ",
+  "ŋutilã",
+  "ɖaa",
+  "Yesu Kristo",
+  "ablɔɖe",
+  "awɔe",
+  "azã",
+  "bua",
+  "dzedzeme",
+  "he",
+  "nufiafia",
+  "nunya",
+  "nàdi",
+  "nànya",
+  "nàɖe",
+  "subɔsubɔha",
+  "tsɔa",
+  "wogblɔ",
+  "xɔse",
+  "Ðo",
+  "Hebrigbe",
+  "Woƒe",
+  "alɔ̃",
+  "axɔ",
+  "edziedzi",
+  "fiana",
+  "lém",
+  "nuku",
+  "nɔnɔmea",
+  "sue",
+  "tsã",
+  "vɔ̃ɖi",
+  "ŋue",
+  "ɖewohĩ",
+  "Abe",
+  "Azɔ",
+  "Dukɔ",
+  "dom",
+  "dua",
+  "manɔ",
+  "mawunyakpukpui",
+  "mede",
+  "nuto",
+  "sesĩe",
+  "yewoƒe",
+  "yɔ",
+  "1",
+  "Gɔmeɖeɖe",
+  "Kristotɔ",
+  "Me",
+  "gbogbo",
+  "gɔmesese",
+  "nawɔ",
+  "su",
+  "ŋugble",
+  "Dzi",
+  "Wɔla",
+  "adzɔ",
+  "agba",
+  "asrɔ̃",
+  "ati",
+  "dim",
+  "foto",
+  "gbeƒã",
+  "kaba",
+  "menya",
+  "tame",
+  "vevitɔ",
+  "vovovo",
+  "wodzi",
+  "wozã",
+  "woŋlɔ",
+  "wònɔ",
+  "ŋua",
+  "ŋutete",
+  "Adam",
+  "Afi",
+  "Se",
+  "Wɔ",
+  "agblẽ",
+  "aka",
+  "evea",
+  "katã",
+  "kekeake",
+  "kpo",
+  "meɖe",
+  "nava",
+  "nàtsɔ",
+  "tegbee",
+  "togbɔ",
+  "tẽe",
+  "vie",
+  "wowɔa",
+  "wòate",
+  "Be",
+  "De",
+  "Eʋeawo",
+  "Yohanes",
+  "Yudatɔwo",
+  "dzia",
+  "fofo",
+  "gbɔdɔnyawo",
+  "gbɔgblɔ",
+  "lãmesẽ",
+  "mɔfiame",
+  "nuwuwu",
+  "veve",
+  "wòawɔ",
+  "xexe",
+  "Ŋu",
+  "ŋugbe",
+  "ɖeke",
+  "Aɖaŋuɖoɖo",
+  "aɖaŋuɖoɖo",
+  "hamea",
+  "keŋkeŋ",
+  "miliɔn",
+  "seselelãme",
+  "tu",
+  "xɔe",
+  "ƒea",
+  "2016",
+  "JW",
+  "Sɔhɛ",
+  "amesiwo",
+  "bliboa",
+  "dzodzro",
+  "eva",
+  "fiaa",
+  "gaƒoƒo",
+  "hame",
+  "kɔkɔe",
+  "lia",
+  "mɔnu",
+  "nenemae",
+  "nua",
+  "srɔ̃ɖeɖea",
+  "teti",
+  "tom",
+  "tɔtrɔ",
+  "via",
+  "woana",
+  "Ðasefoawo",
+  "Ŋɔŋlɔawo",
+  "ɖewo",
+  "ɖoe",
+  "ɣemaɣi",
+  "Fofo",
+  "Mele",
+  "Nyateƒea",
+  "Xexe",
+  "bliboe",
+  "dada",
+  "fũu",
+  "medi",
+  "sɔhɛwo",
+  "taɖodzinu",
+  "vaseɖe",
+  "wodo",
+  "wonya",
+  "wòaɖe",
+  "wòva",
+  "xexlẽme",
+  "ƒãa",
+  "ɖua",
+  "ʋɔnu",
+  "Goliat",
+  "Togo",
+  "Tsɔ",
+  "United",
+  "Yerusalem",
+  "Yuda",
+  "abia",
+  "dzɔdzɔe",
+  "dɔwɔwɔ",
+  "egbe",
+  "egblɔ",
+  "gbeɖe",
+  "maɖe",
+  "menɔ",
+  "meva",
+  "míakpɔ",
+  "nuƒoƒo",
+  "nyabiase",
+  "nàgblɔ",
+  "sewo",
+  "wòanye",
+  "Ðeko",
+  "ɖɔ",
+  "Akpa",
+  "Anɔ",
+  "Edze",
+  "Eŋlisigbe",
+  "La",
+  "Paulo",
+  "abɔklugui",
+  "alé",
+  "etsɔ",
+  "ewɔ",
+  "fiaɖuƒe",
+  "gɔmeɖeɖe",
+  "kpekpe",
+  "lɔ̃a",
+  "mekpɔe",
+  "nanye",
+  "nàdze",
+  "nèdi",
+  "nènye",
+  "vaa",
+  "vevietɔ",
+  "yeyea",
+  "Ŋutsu",
+  "Ɛ̃",
+  "2",
+  "Babilon",
+  "Nenema",
+  "aha",
+  "alesi",
+  "amesi",
+  "asinye",
+  "azɔ",
+  "dzixɔsewo",
+  "game",
+  "gbegbɔgblɔ",
+  "hehe",
+  "lãwo",
+  "nutome",
+  "nàse",
+  "sea",
+  "tsɔtsɔ",
+  "wòana",
+  "Agbalẽ",
+  "Gbe",
+  "Mawunyakpukpui",
+  "Vi",
+  "avi",
+  "blanui",
+  "bubuawo",
+  "dukɔmenɔlawo",
+  "esiwo",
+  "kpui",
+  "menɔa",
+  "mexɔ",
+  "miele",
+  "mɔnukpɔkpɔ",
+  "nanewo",
+  "nudzɔdzɔ",
+  "sesẽwo",
+  "tre",
+  "woava",
+  "wonɔ",
+  "wòava",
+  "wòdze",
+  "wɔnɛ",
+  "yome",
+  "zazã",
+  "ƒometɔwo",
+  "ɣli",
+  "Abraham",
+  "Do",
+  "Helagbe",
+  "Oo",
+  "Saul",
+  "ami",
+  "atrɔ",
+  "daa",
+  "dzidzedze",
+  "dɔléle",
+  "dɔme",
+  "fofoa",
+  "luʋɔ",
+  "meli",
+  "nasu",
+  "nufiala",
+  "nusrɔ̃lawo",
+  "nɔvi",
+  "sukuviawo",
+  "vodadawo",
+  "xɔa",
+  "yele",
+  "ŋutinya",
+  "Ate",
+  "Bia",
+  "Lé",
+  "Mia",
+  "Sabat",
+  "Siwo",
+  "agbalẽwo",
+  "agu",
+  "ahe",
+  "atso",
+  "avuwo",
+  "bum",
+  "dina",
+  "dzena",
+  "dzinyelawo",
+  "enumake",
+  "gãwo",
+  "gɔmee",
+  "hea",
+  "kaka",
+  "kuxia",
+  "lɔ",
+  "mawu",
+  "nadze",
+  "naɖe",
+  "nusi",
+  "susuwo",
+  "woade",
+  "wode",
+  "wotsɔa",
+  "woƒo",
+  "wòtsɔ",
+  "ŋutɔwo",
+  "Ƒo",
+  "5",
+  "Abosam",
+  "Gregoria",
+  "Nubabla",
+  "Rawlings",
+  "Romatɔwo",
+  "To",
+  "Woɖe",
+  "anyra",
+  "dem",
+  "dziɖuɖua",
+  "dzre",
+  "edze",
+  "esiawo",
+  "etsɔme",
+  "ewo",
+  "gbedodoɖa",
+  "internet",
+  "keke",
+  "mailto",
+  "mesɔ",
+  "naa",
+  "nakpɔ",
+  "nufiafiawo",
+  "nusɔsrɔ̃",
+  "nutoa",
+  "sena",
+  "toa",
+  "tsa",
+  "viɖe",
+  "vovototo",
+  "wodze",
+  "wona",
+  "yim",
+  "yina",
+  "zãa",
+  "ŋutsuviwo",
+  "ŋutɔe",
+  "ɖum",
+  "7",
+  "Alo",
+  "Anyi",
+  "Asia",
+  "Gbã",
+  "Mateo",
+  "New",
+  "Nɔ",
+  "ameawo",
+  "anyo",
+  "asɔ",
+  "dugã",
+  "dzɔa",
+  "gbɔnye",
+  "gɔmedzedzea",
+  "kokoko",
+  "matsɔ",
+  "megblɔ",
+  "meka",
+  "nuwɔwɔ",
+  "nàna",
+  "nàƒo",
+  "nàɖo",
+  "vivi",
+  "wòhiã",
+  "xexeame",
+  "yeyewo",
+  "ŋɔŋlɔ",
+  "Akpata",
+  "Dze",
+  "Dzove",
+  "Gbɔ",
+  "Gã",
+  "Míaƒe",
+  "SI",
+  "adre",
+  "afã",
+  "asesẽ",
+  "azu",
+  "dzigbe",
+  "dɔe",
+  "eveawo",
+  "eyata",
+  "fiam",
+  "filmwo",
+  "fukpekpe",
+  "gblẽa",
+  "kplim",
+  "léa",
+  "makpɔ",
+  "mawusubɔsubɔ",
+  "medo",
+  "mekpɔa",
+  "miakpɔ",
+  "míawo",
+  "míenye",
+  "nyae",
+  "tata",
+  "viawo",
+  "vo",
+  "woabu",
+  "woaɖo",
+  "wòakpe",
+  "wòdo",
+  "ɖevia",
+  "Amu",
+  "Ao",
+  "Esiae",
+  "Ewɔ",
+  "Eyome",
+  "Fifia",
+  "Lododowo",
+  "alakpa",
+  "ametia",
+  "avu",
+  "deblibo",
+  "dzadzɛ",
+  "dzidzimeviwo",
+  "dzila",
+  "dɔwɔƒe",
+  "efia",
+  "futɔwo",
+  "gbɔgblɔm",
+  "kpee",
+  "kpuie",
+  "kua",
+  "lolo",
+  "maɖo",
+  "mete",
+  "meɖo",
+  "míade",
+  "nyɔnuviwo",
+  "nàsrɔ̃",
+  "subɔsubɔ",
+  "takpekpe",
+  "tameɖoɖo",
+  "vlo",
+  "wodea",
+  "wòanya",
+  "wɔadã",
+  "xe",
+  "yɔna",
+  "Ðetugbui",
+  "ɖesiaɖe",
+  "3",
+  "Atiglinyi",
+  "Ekema",
+  "Hafi",
+  "Israel-viwo",
+  "Mina",
+  "Nyɔnuvi",
+  "Nɔnɔme",
+  "Satana",
+  "States",
+  "United States",
+  "Yi",
+  "Zã",
+  "atsi",
+  "biabia",
+  "dzaa",
+  "dzem",
+  "dɔdɔ",
+  "enyi",
+  "fa",
+  "fofonye",
+  "goe",
+  "kakaɖedzi",
+  "kplikplikpli",
+  "kpɔtɔ",
+  "laa",
+  "lãme",
+  "mana",
+  "mayi",
+  "nenɔ",
+  "numame",
+  "nyena",
+  "nyɔnuwo",
+  "nàva",
+  "nàɖu",
+  "totro",
+  "vayi",
+  "veviwo",
+  "vodada",
+  "vɔvɔ̃",
+  "woe",
+  "wòna",
+  "wòtso",
+  "wɔlawo",
+  "yewoawɔ",
+  "èdi",
+  "ŋuɖoɖo",
+};
+const uint16_t WA_FREQ_34_RANKS[] = {
+  0, 362, 0, 0, 0, 711, 0, 0, 0, 0, 0, 987, 0, 0, 0, 274,
+  0, 0, 0, 0, 0, 0, 0, 104, 0, 78, 155, 0, 194, 0, 0, 36,
+  0, 0, 0, 0, 118, 327, 767, 488, 0, 0, 0, 0, 432, 692, 0, 0,
+  724, 189, 438, 599, 0, 113, 0, 463, 827, 0, 0, 0, 899, 0, 0, 49,
+  202, 0, 388, 377, 944, 44, 0, 656, 684, 0, 0, 0, 0, 875, 0, 0,
+  0, 0, 0, 0, 0, 641, 0, 0, 0, 136, 0, 0, 0, 251, 351, 27,
+  850, 0, 753, 0, 0, 0, 164, 0, 0, 172, 486, 0, 0, 0, 208, 495,
+  720, 213, 276, 314, 694, 947, 0, 254, 849, 0, 0, 354, 0, 0, 0, 929,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 73, 102, 496, 559, 839, 981,
+  0, 0, 0, 975, 0, 0, 151, 0, 556, 0, 236, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 922, 401, 461, 296, 239, 0, 0, 0, 710, 628, 913,
+  840, 856, 0, 0, 55, 0, 278, 580, 0, 0, 166, 0, 15, 163, 0, 0,
+  0, 0, 791, 788, 814, 0, 20, 0, 0, 0, 119, 382, 613, 993, 732, 0,
+  418, 0, 0, 890, 0, 894, 768, 952, 0, 458, 564, 416, 698, 0, 117, 0,
+  228, 112, 0, 0, 0, 0, 0, 0, 0, 43, 191, 0, 0, 378, 809, 330,
+  0, 889, 122, 440, 967, 198, 26, 655, 0, 589, 0, 0, 785, 0, 0, 0,
+  0, 95, 173, 404, 668, 0, 0, 0, 0, 167, 0, 707, 0, 0, 0, 0,
+  0, 0, 0, 566, 0, 116, 832, 0, 0, 0, 0, 792, 0, 0, 0, 0,
+  484, 0, 79, 0, 0, 0, 92, 231, 439, 0, 0, 600, 492, 0, 482, 574,
+  255, 135, 644, 343, 549, 0, 702, 0, 0, 0, 0, 0, 0, 0, 370, 953,
+  0, 819, 0, 0, 0, 0, 0, 621, 0, 0, 143, 426, 0, 76, 408, 267,
+  376, 469, 810, 608, 843, 750, 192, 186, 209, 323, 337, 911, 66, 0, 614, 0,
+  306, 713, 46, 834, 0, 0, 134, 0, 0, 0, 0, 0, 0, 0, 579, 0,
+  0, 400, 660, 0, 0, 0, 0, 0, 980, 0, 0, 374, 0, 0, 0, 307,
+  891, 620, 0, 0, 0, 0, 292, 0, 801, 901, 0, 0, 836, 0, 32, 215,
+  0, 924, 0, 0, 0, 0, 0, 344, 62, 0, 0, 23, 0, 547, 749, 976,
+  0, 0, 0, 6, 0, 816, 0, 41, 391, 0, 457, 148, 0, 256, 375, 736,
+  372, 752, 775, 860, 908, 0, 0, 817, 0, 0, 0, 511, 0, 609, 0, 0,
+  0, 640, 0, 88, 650, 659, 537, 0, 0, 0, 0, 585, 764, 0, 0, 38,
+  0, 0, 0, 0, 706, 0, 0, 0, 0, 309, 0, 0, 699, 939, 950, 863,
+  520, 543, 0, 0, 152, 0, 0, 0, 268, 0, 0, 0, 184, 544, 703, 311,
+  397, 751, 897, 0, 0, 0, 742, 516, 338, 956, 0, 733, 320, 846, 0, 386,
+  21, 825, 0, 603, 0, 0, 471, 8, 0, 0, 0, 0, 0, 865, 0, 0,
+  0, 606, 0, 0, 639, 754, 398, 576, 0, 211, 988, 250, 467, 0, 0, 0,
+  0, 0, 886, 0, 0, 0, 0, 974, 0, 441, 0, 0, 0, 855, 554, 0,
+  0, 0, 570, 0, 0, 0, 689, 0, 0, 0, 0, 0, 0, 0, 0, 424,
+  406, 874, 0, 263, 245, 266, 321, 358, 0, 0, 0, 0, 180, 0, 131, 201,
+  766, 219, 455, 485, 300, 0, 915, 34, 0, 0, 0, 652, 0, 0, 0, 0,
+  339, 42, 237, 522, 926, 507, 0, 0, 0, 743, 0, 0, 833, 0, 0, 0,
+  125, 0, 169, 793, 557, 0, 0, 0, 0, 0, 28, 348, 360, 550, 0, 0,
+  7, 759, 0, 0, 515, 0, 866, 363, 0, 983, 0, 607, 0, 0, 0, 653,
+  830, 0, 0, 472, 536, 879, 0, 774, 0, 0, 0, 454, 0, 0, 357, 882,
+  0, 83, 0, 0, 10, 325, 0, 0, 89, 637, 165, 517, 995, 0, 494, 0,
+  0, 415, 873, 429, 352, 336, 545, 0, 842, 0, 854, 409, 465, 540, 664, 0,
+  0, 612, 342, 748, 862, 972, 0, 0, 0, 0, 57, 345, 0, 270, 40, 594,
+  727, 394, 857, 0, 0, 0, 596, 0, 0, 906, 0, 141, 729, 0, 0, 0,
+  837, 513, 789, 937, 921, 960, 961, 510, 399, 50, 0, 0, 721, 917, 923, 493,
+  587, 12, 676, 638, 187, 0, 0, 0, 662, 0, 392, 0, 700, 0, 280, 719,
+  876, 0, 0, 288, 0, 0, 233, 604, 824, 615, 74, 927, 487, 959, 0, 0,
+  931, 0, 571, 0, 918, 973, 0, 0, 916, 0, 4, 0, 0, 0, 0, 0,
+  0, 25, 295, 389, 695, 433, 91, 528, 845, 932, 0, 871, 154, 361, 0, 475,
+  0, 0, 598, 0, 291, 996, 0, 0, 483, 0, 0, 474, 308, 955, 964, 0,
+  0, 0, 0, 0, 0, 67, 0, 0, 0, 451, 103, 0, 145, 0, 0, 920,
+  0, 0, 285, 464, 0, 0, 504, 0, 381, 0, 782, 0, 51, 737, 0, 71,
+  379, 670, 9, 444, 577, 140, 0, 0, 0, 0, 0, 417, 0, 0, 569, 0,
+  0, 531, 160, 0, 114, 623, 168, 592, 912, 982, 0, 0, 0, 740, 773, 179,
+  315, 888, 861, 0, 0, 0, 0, 0, 0, 0, 0, 277, 0, 0, 994, 0,
+  0, 586, 0, 0, 808, 636, 0, 476, 812, 0, 0, 0, 672, 0, 366, 697,
+  0, 0, 686, 645, 181, 718, 0, 142, 0, 951, 0, 633, 328, 0, 0, 0,
+  153, 725, 744, 864, 714, 0, 0, 0, 930, 0, 0, 218, 582, 290, 0, 0,
+  0, 807, 0, 0, 0, 0, 0, 310, 0, 0, 0, 120, 0, 757, 0, 0,
+  0, 868, 0, 0, 823, 0, 0, 0, 17, 590, 978, 761, 0, 0, 0, 0,
+  150, 716, 29, 437, 238, 779, 0, 333, 649, 0, 301, 934, 468, 938, 294, 529,
+  954, 390, 0, 0, 0, 646, 0, 0, 0, 765, 935, 224, 0, 84, 0, 355,
+  64, 521, 199, 0, 0, 0, 0, 0, 0, 546, 687, 452, 0, 0, 797, 0,
+  0, 0, 755, 0, 0, 859, 0, 282, 0, 30, 225, 93, 506, 253, 196, 756,
+  821, 159, 881, 0, 0, 0, 0, 0, 945, 0, 110, 70, 197, 283, 61, 410,
+  548, 0, 681, 37, 0, 0, 31, 0, 0, 674, 526, 176, 0, 0, 0, 0,
+  0, 0, 0, 0, 58, 0, 0, 0, 111, 0, 0, 0, 0, 630, 635, 130,
+  784, 984, 109, 0, 0, 948, 0, 567, 405, 0, 568, 0, 0, 0, 0, 0,
+  205, 207, 958, 0, 5, 47, 235, 244, 241, 904, 82, 481, 0, 0, 0, 634,
+  0, 0, 0, 0, 425, 562, 275, 877, 0, 0, 419, 24, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 431, 0, 317, 0, 412, 0, 264, 0,
+  0, 226, 302, 249, 269, 356, 872, 0, 0, 0, 0, 100, 350, 0, 0, 0,
+  0, 992, 0, 0, 0, 0, 977, 414, 0, 0, 0, 0, 0, 0, 682, 690,
+  731, 0, 651, 0, 287, 0, 0, 383, 747, 0, 0, 0, 783, 533, 13, 632,
+  680, 53, 216, 0, 605, 0, 177, 0, 0, 813, 806, 106, 0, 0, 0, 0,
+  829, 214, 149, 771, 466, 895, 907, 828, 242, 0, 648, 0, 940, 0, 442, 126,
+  563, 265, 0, 799, 0, 346, 760, 0, 0, 565, 35, 258, 555, 870, 247, 387,
+  161, 349, 673, 820, 822, 0, 0, 0, 0, 0, 798, 0, 85, 178, 0, 77,
+  0, 0, 0, 0, 0, 518, 541, 54, 624, 835, 33, 0, 0, 0, 0, 0,
+  478, 373, 0, 0, 0, 0, 0, 56, 538, 0, 0, 0, 0, 597, 763, 243,
+  532, 666, 0, 0, 722, 802, 262, 0, 0, 0, 0, 519, 0, 0, 341, 0,
+  0, 449, 0, 299, 0, 853, 0, 0, 0, 221, 858, 156, 240, 0, 0, 0,
+  123, 0, 683, 0, 0, 0, 0, 14, 340, 497, 800, 928, 941, 625, 780, 962,
+  259, 869, 0, 0, 852, 0, 0, 86, 281, 101, 0, 332, 220, 0, 0, 456,
+  72, 709, 0, 831, 500, 303, 0, 420, 593, 0, 0, 963, 0, 385, 0, 252,
+  0, 470, 601, 0, 0, 0, 0, 622, 0, 0, 0, 0, 0, 796, 0, 0,
+  0, 0, 0, 658, 712, 0, 642, 0, 0, 0, 477, 0, 0, 0, 0, 542,
+  575, 629, 335, 0, 0, 0, 0, 0, 0, 0, 200, 0, 892, 0, 411, 0,
+  0, 0, 499, 0, 203, 1, 769, 313, 0, 0, 657, 0, 0, 0, 0, 705,
+  0, 781, 87, 0, 715, 0, 998, 190, 524, 0, 0, 503, 696, 227, 558, 0,
+  985, 0, 0, 0, 0, 0, 0, 0, 647, 501, 627, 803, 0, 815, 0, 0,
+  0, 0, 0, 0, 0, 0, 851, 129, 182, 905, 0, 0, 0, 966, 986, 0,
+  790, 271, 0, 60, 80, 811, 1000, 447, 45, 553, 578, 297, 59, 677, 826, 903,
+  232, 902, 319, 588, 0, 0, 0, 0, 0, 0, 81, 272, 534, 0, 128, 0,
+  0, 0, 0, 0, 560, 69, 0, 0, 0, 0, 0, 0, 0, 946, 584, 127,
+  701, 723, 770, 0, 0, 0, 489, 0, 508, 0, 0, 0, 0, 0, 0, 0,
+  665, 0, 0, 0, 0, 0, 0, 581, 0, 65, 99, 617, 730, 867, 0, 990,
+  157, 107, 0, 0, 0, 0, 0, 693, 0, 0, 0, 885, 206, 175, 380, 0,
+  234, 0, 171, 0, 0, 0, 848, 971, 675, 0, 0, 445, 0, 0, 0, 0,
+  738, 0, 479, 331, 0, 0, 0, 0, 561, 0, 0, 0, 991, 880, 68, 170,
+  0, 0, 0, 0, 896, 204, 0, 0, 910, 0, 0, 0, 0, 772, 844, 407,
+  329, 2, 678, 490, 0, 0, 0, 229, 502, 0, 185, 0, 0, 0, 0, 552,
+  0, 279, 427, 551, 0, 0, 0, 0, 138, 898, 0, 0, 0, 0, 0, 0,
+  0, 0, 734, 98, 0, 286, 305, 631, 428, 0, 0, 0, 795, 691, 0, 887,
+  22, 0, 459, 0, 139, 0, 0, 0, 0, 188, 661, 0, 884, 0, 0, 421,
+  174, 446, 758, 762, 0, 0, 591, 0, 0, 523, 0, 0, 413, 936, 0, 0,
+  602, 0, 369, 230, 448, 0, 0, 108, 137, 450, 847, 63, 610, 0, 0, 0,
+  0, 0, 0, 460, 573, 893, 0, 97, 572, 883, 0, 75, 393, 539, 0, 0,
+  0, 94, 583, 0, 735, 124, 353, 364, 949, 0, 395, 48, 0, 0, 0, 298,
+  183, 778, 0, 0, 0, 435, 162, 289, 0, 273, 0, 212, 423, 403, 434, 0,
+  443, 0, 525, 919, 210, 0, 965, 0, 0, 0, 776, 0, 0, 0, 371, 0,
+  0, 0, 0, 0, 0, 217, 0, 671, 0, 914, 0, 667, 746, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 970, 717, 0, 616, 39, 90, 16, 0, 365, 158,
+  0, 0, 18, 193, 260, 997, 261, 480, 402, 619, 0, 0, 0, 0, 498, 704,
+  728, 0, 0, 334, 0, 0, 384, 0, 726, 669, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 368, 708, 512, 0, 0, 322, 0, 453, 0, 0, 530, 786, 0,
+  491, 422, 0, 318, 0, 611, 626, 0, 900, 0, 0, 0, 105, 745, 0, 0,
+  396, 0, 0, 0, 0, 0, 0, 246, 741, 144, 3, 223, 293, 304, 505, 688,
+  11, 878, 0, 0, 0, 0, 999, 0, 316, 0, 0, 989, 0, 0, 0, 0,
+  115, 0, 222, 0, 0, 0, 0, 0, 0, 514, 0, 0, 838, 0, 0, 0,
+  257, 0, 0, 0, 0, 0, 0, 654, 777, 0, 0, 0, 0, 347, 643, 618,
+  794, 436, 685, 52, 804, 909, 0, 0, 0, 195, 133, 121, 527, 595, 943, 430,
+  979, 0, 248, 132, 805, 933, 663, 968, 0, 0, 284, 0, 0, 0, 0, 312,
+  324, 96, 942, 0, 0, 367, 0, 0, 0, 509, 0, 473, 147, 0, 818, 146,
+  841, 679, 0, 0, 0, 0, 0, 462, 0, 0, 0, 0, 0, 739, 969, 957,
+  0, 787, 326, 925, 0, 0, 0, 19, 535, 359, 0, 0, 0, 0, 0, 0,
+};
+
+const char *WA_FREQ_35_TOKENS[] = {
+  "να",
+  "το",
+  "δεν",
+  "είναι",
+  "θα",
+  "και",
+  "μου",
+  "με",
+  "για",
+  "την",
+  "ο",
+  "η",
+  "τον",
+  "τα",
+  "που",
+  "σου",
+  "σε",
+  "αυτό",
+  "του",
+  "τι",
+  "ότι",
+  "από",
+  "στο",
+  "της",
+  "όχι",
+  "ναι",
+  "ένα",
+  "τη",
+  "αν",
+  "αλλά",
+  "εδώ",
+  "μια",
+  "σας",
+  "τους",
+  "ήταν",
+  "μας",
+  "πρέπει",
+  "είσαι",
+  "είμαι",
+  "οι",
+  "στην",
+  "πολύ",
+  "κι",
+  "γιατί",
+  "πως",
+  "τώρα",
+  "εγώ",
+  "εντάξει",
+  "κάτι",
+  "έχει",
+  "ξέρω",
+  "τις",
+  "έχω",
+  "δε",
+  "μην",
+  "έτσι",
+  "εσύ",
+  "καλά",
+  "αυτή",
+  "θέλω",
+  "όταν",
+  "στον",
+  "στη",
+  "μπορώ",
+  "ξέρεις",
+  "έχεις",
+  "κάνεις",
+  "μόνο",
+  "μαζί",
+  "εκεί",
+  "σαν",
+  "όλα",
+  "τίποτα",
+  "σ",
+  "ευχαριστώ",
+  "ή",
+  "πώς",
+  "κάνω",
+  "απ",
+  "τόσο",
+  "μπορεί",
+  "κάνει",
+  "ποτέ",
+  "απλά",
+  "αυτά",
+  "των",
+  "έλα",
+  "λοιπόν",
+  "στα",
+  "υπάρχει",
+  "ακόμα",
+  "μπορείς",
+  "μέσα",
+  "πάμε",
+  "σπίτι",
+  "αυτός",
+  "τότε",
+  "ίσως",
+  "έχουμε",
+  "γι",
+  "πιο",
+  "παρακαλώ",
+  "ένας",
+  "κύριε",
+  "πού",
+  "μετά",
+  "νομίζω",
+  "είμαστε",
+  "πριν",
+  "πάντα",
+  "πίσω",
+  "γεια",
+  "λίγο",
+  "πω",
+  "όπως",
+  "δουλειά",
+  "αλήθεια",
+  "ποιος",
+  "δύο",
+  "είπε",
+  "όλοι",
+  "είχε",
+  "ας",
+  "έναν",
+  "λες",
+  "παιδιά",
+  "άλλο",
+  "θέλεις",
+  "ζωή",
+  "κάνουμε",
+  "δω",
+  "πάω",
+  "μ",
+  "μη",
+  "έξω",
+  "καλό",
+  "είπα",
+  "μία",
+  "έχουν",
+  "επειδή",
+  "ήμουν",
+  "μέχρι",
+  "στις",
+  "έπρεπε",
+  "κοίτα",
+  "ώρα",
+  "πάνω",
+  "μένα",
+  "φορά",
+  "χρόνια",
+  "σένα",
+  "είστε",
+  "ήθελα",
+  "ούτε",
+  "σωστά",
+  "ωραία",
+  "όμως",
+  "κάποιος",
+  "μα",
+  "κάθε",
+  "πράγματα",
+  "πες",
+  "είχα",
+  "καλή",
+  "χωρίς",
+  "μέρα",
+  "κάτω",
+  "γυναίκα",
+  "μπορούμε",
+  "μόλις",
+  "κανείς",
+  "θες",
+  "έκανε",
+  "μαμά",
+  "ακριβώς",
+  "καλύτερα",
+  "αυτόν",
+  "πάει",
+  "σήμερα",
+  "αρέσει",
+  "θέλει",
+  "΄",
+  "λέει",
+  "πόσο",
+  "συγγνώμη",
+  "έκανα",
+  "φαίνεται",
+  "θεέ",
+  "φυσικά",
+  "λυπάμαι",
+  "μέρος",
+  "συμβαίνει",
+  "έγινε",
+  "ό",
+  "πας",
+  "εμένα",
+  "πεις",
+  "πολλά",
+  "όσο",
+  "στιγμή",
+  "κάποιον",
+  "λάθος",
+  "οπότε",
+  "πράγμα",
+  "έχετε",
+  "χρόνο",
+  "είπες",
+  "δυο",
+  "ω",
+  "γίνει",
+  "εσένα",
+  "κάποια",
+  "ως",
+  "ε",
+  "περίμενε",
+  "πρόβλημα",
+  "παιδί",
+  "ειναι",
+  "ήσουν",
+  "πραγματικά",
+  "πάλι",
+  "άλλη",
+  "απο",
+  "έκανες",
+  "οχι",
+  "όλο",
+  "χρειάζεται",
+  "βλέπω",
+  "μητέρα",
+  "υπάρχουν",
+  "πιστεύω",
+  "κυρία",
+  "δικό",
+  "ίδιο",
+  "φίλε",
+  "γρήγορα",
+  "στους",
+  "πάρει",
+  "σίγουρα",
+  "πάρω",
+  "αρκετά",
+  "μπαμπά",
+  "ιδέα",
+  "όλη",
+  "εσείς",
+  "λένε",
+  "λεφτά",
+  "γίνεται",
+  "νέα",
+  "λέω",
+  "ξέρει",
+  "πήγαινε",
+  "νομίζεις",
+  "φορές",
+  "δει",
+  "μάλλον",
+  "κ.",
+  "ήδη",
+  "είδα",
+  "σημαίνει",
+  "εμείς",
+  "ακόμη",
+  "όλους",
+  "πατέρας",
+  "οτι",
+  "κάνουν",
+  "καιρό",
+  "προς",
+  "εκτός",
+  "κόσμο",
+  "βράδυ",
+  "μωρό",
+  "συγνώμη",
+  "όνομα",
+  "πατέρα",
+  "βλέπεις",
+  "χαρά",
+  "αύριο",
+  "μπορούσα",
+  "σταμάτα",
+  "μπορείτε",
+  "μόνος",
+  "αυτές",
+  "νόμιζα",
+  "αγάπη",
+  "πρόκειται",
+  "τελευταία",
+  "άνθρωποι",
+  "πρώτη",
+  "πει",
+  "μεγάλη",
+  "ν",
+  "τί",
+  "καταλαβαίνω",
+  "ήξερα",
+  "δίκιο",
+  "απόψε",
+  "κανένα",
+  "συνέβη",
+  "μακριά",
+  "τέλος",
+  "ποιο",
+  "μπορούσε",
+  "απλώς",
+  "αμέσως",
+  "ξανά",
+  "πότε",
+  "τρόπο",
+  "πάρε",
+  "θέση",
+  "μήπως",
+  "αυτοί",
+  "ξέρετε",
+  "αυτούς",
+  "ήρθε",
+  "εαυτό",
+  "δική",
+  "ποια",
+  "αυτήν",
+  "μάλιστα",
+  "κάνετε",
+  "περισσότερο",
+  "κατά",
+  "πόλη",
+  "πια",
+  "κορίτσι",
+  "θέλετε",
+  "κάποιο",
+  "λεπτό",
+  "κοντά",
+  "χρειάζομαι",
+  "θέμα",
+  "μιλήσω",
+  "μέρες",
+  "είχες",
+  "τύπος",
+  "λεπτά",
+  "επίσης",
+  "χέρια",
+  "εκείνη",
+  "έρθει",
+  "βρω",
+  "τέτοιο",
+  "μερικές",
+  "πειράζει",
+  "βοήθεια",
+  "εννοώ",
+  "άνθρωπος",
+  "μεγάλο",
+  "βρούμε",
+  "ανθρώπους",
+  "δεις",
+  "καθόλου",
+  "εννοείς",
+  "ορίστε",
+  "αφού",
+  "πέρα",
+  "όπλο",
+  "σίγουρος",
+  "ιστορία",
+  "πήρε",
+  "δούμε",
+  "πρωί",
+  "ήθελε",
+  "ελπίζω",
+  "πόρτα",
+  "μάτια",
+  "κάνε",
+  "δρόμο",
+  "όλες",
+  "πιστεύεις",
+  "ομάδα",
+  "α",
+  "μπροστά",
+  "κακό",
+  "καλύτερο",
+  "σχέση",
+  "καλός",
+  "μόνη",
+  "ώρες",
+  "αστυνομία",
+  "φύγω",
+  "θυμάσαι",
+  "ευκαιρία",
+  "λόγο",
+  "τ",
+  "διάολο",
+  "βοηθήσω",
+  "χέρι",
+  "αμάξι",
+  "ώστε",
+  "νύχτα",
+  "χαίρομαι",
+  "κεφάλι",
+  "πήγε",
+  "φύγε",
+  "ξέρουμε",
+  "γραφείο",
+  "βρήκα",
+  "καν",
+  "τέλεια",
+  "γαμώτο",
+  "άλλα",
+  "ελάτε",
+  "δωμάτιο",
+  "μιλάς",
+  "ίδια",
+  "δώσε",
+  "κόρη",
+  "φίλος",
+  "όπου",
+  "κανέναν",
+  "αγαπώ",
+  "πρώτα",
+  "ψέματα",
+  "οικογένεια",
+  "καμία",
+  "πάρεις",
+  "χρήματα",
+  "vα",
+  "δηλαδή",
+  "ανησυχείς",
+  "αγόρι",
+  "τρεις",
+  "ενός",
+  "πέθανε",
+  "ωραίο",
+  "σοβαρά",
+  "αλλιώς",
+  "είχαμε",
+  "άντρας",
+  "τουλάχιστον",
+  "έρχεται",
+  "πάνε",
+  "μικρό",
+  "καρδιά",
+  "πήρα",
+  "δύσκολο",
+  "φύγουμε",
+  "πούμε",
+  "τηλέφωνο",
+  "λέμε",
+  "αργότερα",
+  "εάν",
+  "νερό",
+  "σχεδόν",
+  "τέτοια",
+  "είδες",
+  "κάπου",
+  "μεταξύ",
+  "χθες",
+  "νιώθω",
+  "ποιός",
+  "αντίο",
+  "υπόθεση",
+  "πέντε",
+  "δώσω",
+  "μήνες",
+  "μυαλό",
+  "τρία",
+  "θυμάμαι",
+  "συμβεί",
+  "κόσμος",
+  "θέλουν",
+  "ενα",
+  "αίμα",
+  "μικρή",
+  "ρε",
+  "πάρα",
+  "σχολείο",
+  "τρόπος",
+  "σύντομα",
+  "γυναίκες",
+  "καμιά",
+  "βέβαια",
+  "μπορούν",
+  "υποθέτω",
+  "θέλουμε",
+  "σκατά",
+  "ήθελες",
+  "μπαμπάς",
+  "είχαν",
+  "άλλος",
+  "μιλήσουμε",
+  "αυτο",
+  "αργά",
+  "εμάς",
+  "μερικά",
+  "άντρες",
+  "φίλοι",
+  "τρέχει",
+  "συνέχεια",
+  "φυλακή",
+  "σκέφτηκα",
+  "φύγει",
+  "ήρθες",
+  "πείτε",
+  "εκείνο",
+  "αφήσω",
+  "όσα",
+  "ήρθα",
+  "νεκρός",
+  "πλάκα",
+  "έρθεις",
+  "ποιον",
+  "σημασία",
+  "γύρω",
+  "βρεις",
+  "παιχνίδι",
+  "καλημέρα",
+  "χάρη",
+  "καταλαβαίνεις",
+  "έλεγα",
+  "κατάλαβα",
+  "σκοτώσει",
+  "ελα",
+  "σημαντικό",
+  "άσε",
+  "πολλές",
+  "πάρουμε",
+  "όνομά",
+  "συγχωρείτε",
+  "φύγεις",
+  "άντρα",
+  "κατάσταση",
+  "σκότωσε",
+  "εσάς",
+  "φαγητό",
+  "φοβάμαι",
+  "κορίτσια",
+  "ηταν",
+  "κοπέλα",
+  "βασικά",
+  "εμπρός",
+  "λόγος",
+  "αυτοκίνητο",
+  "κανένας",
+  "ζωής",
+  "πρώτο",
+  "γονείς",
+  "απόδοση",
+  "άλλους",
+  "θεός",
+  "αστείο",
+  "γλυκιά",
+  "πεθάνει",
+  "νοιάζει",
+  "μείνε",
+  "έφυγε",
+  "ενώ",
+  "σχέδιο",
+  "υπήρχε",
+  "δολάρια",
+  "έτοιμος",
+  "τύχη",
+  "αρχή",
+  "πόδια",
+  "έρθω",
+  "άσχημα",
+  "οποίο",
+  "σωστό",
+  "όμορφη",
+  "σίγουρη",
+  "τo",
+  "νέο",
+  "τελικά",
+  "άκουσα",
+  "προσπαθώ",
+  "βοηθήσει",
+  "κε",
+  "εχω",
+  "μοιάζει",
+  "φίλους",
+  "περίπου",
+  "μπορούσες",
+  "αφεντικό",
+  "χρειαζόμαστε",
+  "δύναμη",
+  "κάναμε",
+  "καλύτερη",
+  "μείνει",
+  "γειά",
+  "γη",
+  "έδωσε",
+  "βρήκες",
+  "περίπτωση",
+  "γιος",
+  "ραντεβού",
+  "ακούγεται",
+  "πάρτι",
+  "επόμενη",
+  "φέρω",
+  "κύριοι",
+  "ακούω",
+  "καλώς",
+  "περάσει",
+  "περιμένω",
+  "έι",
+  "μισό",
+  "επιλογή",
+  "σώμα",
+  "τύπο",
+  "δρ.",
+  "κύριος",
+  "βρει",
+  "χώρα",
+  "νοσοκομείο",
+  "μιας",
+  "τζακ",
+  "βιβλίο",
+  "πλέον",
+  "μπράβο",
+  "μάθω",
+  "μείνω",
+  "φίλο",
+  "αφήσεις",
+  "περισσότερα",
+  "ακούς",
+  "καφέ",
+  "έξι",
+  "όπλα",
+  "μήνυμα",
+  "πρόσεχε",
+  "γιο",
+  "ήμασταν",
+  "θ",
+  "κα",
+  "σχετικά",
+  "δεv",
+  "δείτε",
+  "χρειάζεσαι",
+  "διαλόγων",
+  "άρεσε",
+  "ταινία",
+  "εύκολο",
+  "αφήστε",
+  "αξίζει",
+  "πρόσωπο",
+  "καληνύχτα",
+  "σκέφτομαι",
+  "βρίσκεται",
+  "οτιδήποτε",
+  "άκου",
+  "περιμένετε",
+  "αρέσουν",
+  "άλλον",
+  "πήρες",
+  "πήγα",
+  "συμφωνία",
+  "o",
+  "σκοτώσω",
+  "κρεβάτι",
+  "είπαν",
+  "μιλάω",
+  "άλλες",
+  "ποτό",
+  "προφανώς",
+  "άφησε",
+  "ερώτηση",
+  "περιμένει",
+  "the",
+  "σεξ",
+  "ηρέμησε",
+  "δρ",
+  "δίπλα",
+  "άλλοι",
+  "αυτού",
+  "φίλη",
+  "σαμ",
+  "κάπως",
+  "ξέρουν",
+  "βάλω",
+  "σειρά",
+  "κοιτάξτε",
+  "ήξερε",
+  "τελευταίο",
+  "τζον",
+  "πραγματικότητα",
+  "παρά",
+  "λέτε",
+  "εδω",
+  "μείνεις",
+  "τελείωσε",
+  "έρχομαι",
+  "στ",
+  "ήξερες",
+  "έλεγε",
+  "γνωρίζω",
+  "γιατρός",
+  "πέρασε",
+  "ακούσει",
+  "έκαναν",
+  "δουλεύει",
+  "ρούχα",
+  "λέξη",
+  "στοιχεία",
+  "κάποιες",
+  "υπέροχο",
+  "παλιά",
+  "φωτιά",
+  "αδερφή",
+  "σημείο",
+  "ερωτήσεις",
+  "δες",
+  "πλευρά",
+  "εντελώς",
+  "δώσει",
+  "γίνω",
+  "δέκα",
+  "κομμάτι",
+  "άρα",
+  "δικά",
+  "γίνεις",
+  "περιοχή",
+  "φωτογραφία",
+  "πουθενά",
+  "λίγη",
+  "επάνω",
+  "μιλάμε",
+  "είδε",
+  "τελειώσει",
+  "εβδομάδα",
+  "βρήκαμε",
+  "μάθει",
+  "δείπνο",
+  "υπέροχα",
+  "προσοχή",
+  "πάτε",
+  "οικογένειά",
+  "περίεργο",
+  "βρήκε",
+  "μάθεις",
+  "περίμενα",
+  "είδους",
+  "προβλήματα",
+  "πληροφορίες",
+  "ημέρα",
+  "βοηθήσεις",
+  "πόσα",
+  "χριστέ",
+  "επιμέλεια",
+  "κάτσε",
+  "μιλήσει",
+  "μέλλον",
+  "μιλάει",
+  "πολλοί",
+  "ντε",
+  "ταξίδι",
+  "φύγετε",
+  "ετσι",
+  "είτε",
+  "άδεια",
+  "εχει",
+  "άτομο",
+  "οποία",
+  "προσπάθησε",
+  "εχεις",
+  "δείξω",
+  "θάνατο",
+  "μουσική",
+  "σκάφος",
+  "πόλεμο",
+  "σκέφτεσαι",
+  "κάποτε",
+  "τιμή",
+  "σκάσε",
+  "καθώς",
+  "γυρίσω",
+  "τόσα",
+  "γνώμη",
+  "επιτέλους",
+  "παντού",
+  "τμήμα",
+  "εναντίον",
+  "μακάρι",
+  "χάλια",
+  "υπό",
+  "έτοιμη",
+  "πάρτε",
+  "εκείνος",
+  "παίρνει",
+  "τζο",
+  "ρωτήσω",
+  "θεού",
+  "ασφάλεια",
+  "υποτίθεται",
+  "μήνα",
+  "νιώθεις",
+  "υπόσχομαι",
+  "πτώμα",
+  "είδος",
+  "συνήθως",
+  "έρχονται",
+  "μαλλιά",
+  "αλλα",
+  "σύστημα",
+  "ντετέκτιβ",
+  "γιατρέ",
+  "όντως",
+  "λίστα",
+  "έτοιμοι",
+  "αλλάξει",
+  "γάμο",
+  "κέντρο",
+  "αποστολή",
+  "φοβάσαι",
+  "οκ",
+  "φως",
+  "δώσεις",
+  "λίγα",
+  "μάικλ",
+  "δώρο",
+  "τον.",
+  "οταν",
+  "χρόνος",
+  "κυρίες",
+  "κατάλαβες",
+  "πρώτος",
+  "μέση",
+  "θεό",
+  "ενδιαφέρον",
+  "συνέχισε",
+  "καλύτερος",
+  "φωτογραφίες",
+  "άνθρωπο",
+  "όμορφο",
+  "άνδρες",
+  "βάλε",
+  "είvαι",
+  "τρελός",
+  "ευχαριστούμε",
+  "ισως",
+  "βδομάδα",
+  "χρειαστεί",
+  "έρευνα",
+  "φέρε",
+  "τσάρλι",
+  "εν",
+  "νόημα",
+  "δεσποινίς",
+  "λόγια",
+  "μπορούσαμε",
+  "τέλειο",
+  "αδελφή",
+  "λείπει",
+  "στόμα",
+  "καιρός",
+  "άκρη",
+  "ματιά",
+  "συγχωρείς",
+  "έμαθα",
+  "σταματήστε",
+  "σκεφτόμουν",
+  "έλεγχο",
+  "ακούστε",
+  "μυστικό",
+  "ίδιος",
+  "μιλήσεις",
+  "περιμένεις",
+  "άντε",
+  "κου",
+  "πρώην",
+  "παραπάνω",
+  "σταματήσει",
+  "εξαιτίας",
+  "λιγότερο",
+  "κράτα",
+  "επίθεση",
+  "περιμένουμε",
+  "σκοτώσεις",
+  "πλοίο",
+  "δίνει",
+  "έχασα",
+  "συχνά",
+  "αφορά",
+  "θύμα",
+  "παίρνεις",
+  "βάση",
+  "ατύχημα",
+  "παίζει",
+  "τομ",
+  "δολοφόνος",
+  "εκατομμύρια",
+  "ξενοδοχείο",
+  "βρείτε",
+  "ήρθατε",
+  "πηγαίνετε",
+  "βγει",
+  "έπεσε",
+  "δείχνει",
+  "αέρα",
+  "φρανκ",
+  "εισαι",
+  "μεγάλος",
+  "βλέπετε",
+  "τίποτε",
+  "μικρέ",
+  "βγάλω",
+  "παρελθόν",
+  "μένει",
+  "πάντων",
+  "ειλικρινά",
+  "δουλειές",
+  "δικός",
+  "ρα",
+  "λόγω",
+  "ανάγκη",
+  "δουλεύω",
+  "ξαφνικά",
+  "ανάμεσα",
+  "άτομα",
+  "ειμαι",
+  "φεύγω",
+  "κάντε",
+  "αφήσουμε",
+  "σάρα",
+  "άκουσες",
+  "μoυ",
+  "γραμμή",
+  "μισώ",
+  "ψηλά",
+  "αδερφός",
+  "απάντηση",
+  "χώρο",
+  "έλεγες",
+  "πόδι",
+  "ζωντανός",
+  "σκηνή",
+  "αισθάνομαι",
+  "εκ",
+  "τελείως",
+  "νωρίς",
+  "μάνα",
+  "πίστευα",
+  "δουλεύεις",
+  "παίρνω",
+  "γιαγιά",
+  "αγόρια",
+  "σκέψου",
+  "ζήτησε",
+  "κάνατε",
+  "παράξενο",
+  "πιστεύει",
+  "αγαπάς",
+  "παρέα",
+  "ορκίζομαι",
+  "έστειλε",
+  "χάρηκα",
+  "tι",
+  "τραγούδι",
+  "μπαρ",
+  "τραπέζι",
+  "εβδομάδες",
+  "πήγες",
+  "ναί",
+  "παλιό",
+  "σήμα",
+  "χιλιάδες",
+  "συγχαρητήρια",
+  "αντί",
+  "θανάτου",
+  "φωνή",
+  "μπάνιο",
+  "προσπαθεί",
+  "φαίνεσαι",
+  "έβαλε",
+  "ύπνο",
+  "επόμενο",
+  "δικαίωμα",
+  "λέγεται",
+  "τηλεόραση",
+  "τέσσερα",
+  "κάποιοι",
+  "επαφή",
+  "κλειδί",
+  "κρίμα",
+  "μικρός",
+  "πεθάνω",
+  "δώ",
+  "σύμφωνα",
+  "μάικ",
+  "ει",
+  "i",
+  "κ",
+  "διαφορετικά",
+  "s",
+  "λίγες",
+  "κίνηση",
+  "έδωσα",
+  "απόφαση",
+  "αεροπλάνο",
+  "μάχη",
+  "τρελό",
+  "χάσει",
+  "κοιτάς",
+  "ανήκει",
+  "εγω",
+  "μαγαζί",
+  "πρόγραμμα",
+  "λιγάκι",
+};
+const uint16_t WA_FREQ_35_RANKS[] = {
+  161, 0, 0, 895, 653, 199, 971, 663, 714, 0, 0, 0, 0, 486, 0, 142,
+  0, 0, 237, 83, 252, 862, 0, 0, 0, 0, 0, 0, 0, 0, 497, 398,
+  0, 574, 627, 233, 0, 330, 0, 0, 257, 299, 590, 0, 0, 0, 84, 662,
+  588, 256, 848, 0, 170, 0, 0, 156, 91, 157, 0, 132, 453, 0, 0, 673,
+  0, 0, 0, 0, 86, 0, 591, 0, 30, 0, 0, 208, 0, 0, 0, 80,
+  980, 0, 0, 0, 0, 0, 0, 0, 0, 320, 0, 0, 933, 0, 0, 394,
+  0, 0, 0, 0, 0, 0, 0, 313, 0, 0, 0, 875, 784, 0, 76, 472,
+  829, 399, 836, 798, 420, 694, 499, 61, 887, 0, 0, 779, 0, 858, 0, 0,
+  0, 0, 969, 0, 0, 203, 0, 0, 0, 218, 0, 0, 0, 0, 0, 0,
+  963, 0, 0, 0, 785, 424, 0, 0, 561, 0, 669, 22, 0, 0, 0, 0,
+  850, 0, 0, 393, 0, 984, 0, 0, 0, 0, 414, 67, 402, 463, 0, 0,
+  0, 425, 0, 4, 645, 580, 696, 897, 559, 680, 0, 0, 0, 165, 410, 633,
+  0, 0, 625, 690, 0, 0, 595, 651, 675, 640, 708, 0, 550, 0, 338, 706,
+  120, 262, 193, 324, 441, 323, 725, 835, 888, 355, 0, 0, 378, 0, 0, 0,
+  758, 381, 783, 0, 331, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 932,
+  573, 0, 973, 0, 0, 837, 0, 109, 395, 507, 0, 0, 0, 0, 73, 0,
+  0, 0, 0, 0, 380, 911, 0, 0, 0, 770, 116, 122, 484, 545, 386, 0,
+  49, 0, 97, 6, 51, 520, 0, 224, 0, 0, 0, 0, 171, 0, 0, 0,
+  814, 0, 699, 250, 0, 439, 52, 979, 261, 0, 0, 0, 0, 947, 0, 0,
+  0, 551, 0, 0, 0, 36, 310, 270, 791, 148, 521, 908, 0, 0, 455, 43,
+  865, 362, 577, 951, 294, 557, 0, 754, 568, 308, 364, 739, 0, 0, 0, 0,
+  832, 893, 988, 0, 0, 0, 0, 458, 0, 953, 0, 0, 664, 273, 952, 629,
+  490, 546, 305, 688, 0, 0, 0, 431, 864, 981, 556, 0, 468, 0, 0, 534,
+  960, 139, 765, 0, 0, 0, 0, 609, 795, 0, 0, 0, 0, 272, 0, 0,
+  292, 0, 162, 0, 778, 0, 473, 301, 0, 0, 817, 0, 356, 956, 0, 0,
+  0, 0, 0, 178, 0, 0, 319, 945, 0, 0, 0, 535, 377, 0, 0, 0,
+  0, 469, 471, 811, 229, 639, 0, 0, 5, 376, 350, 426, 522, 733, 0, 0,
+  344, 746, 962, 438, 0, 927, 0, 691, 206, 892, 563, 0, 0, 0, 251, 924,
+  0, 0, 0, 0, 0, 0, 0, 579, 481, 202, 0, 79, 409, 0, 0, 0,
+  687, 0, 0, 806, 0, 19, 0, 0, 511, 0, 0, 734, 0, 0, 0, 711,
+  0, 0, 891, 0, 0, 845, 0, 0, 642, 0, 508, 0, 0, 0, 0, 260,
+  0, 0, 0, 542, 646, 540, 0, 42, 661, 570, 35, 737, 0, 996, 101, 681,
+  0, 263, 144, 476, 615, 926, 0, 0, 731, 0, 134, 214, 543, 774, 828, 0,
+  0, 846, 592, 0, 0, 0, 0, 0, 348, 0, 612, 0, 0, 0, 0, 0,
+  0, 98, 859, 0, 0, 160, 0, 0, 0, 0, 0, 0, 0, 0, 602, 792,
+  152, 901, 0, 742, 906, 275, 0, 0, 0, 7, 1, 66, 0, 21, 0, 946,
+  0, 172, 613, 482, 815, 0, 0, 0, 0, 249, 340, 724, 668, 219, 600, 872,
+  771, 948, 0, 0, 0, 617, 0, 603, 0, 0, 0, 429, 238, 74, 280, 907,
+  0, 0, 158, 753, 899, 0, 0, 0, 805, 904, 0, 0, 0, 0, 210, 0,
+  0, 0, 0, 0, 166, 0, 54, 322, 432, 624, 0, 0, 0, 0, 750, 0,
+  0, 0, 0, 0, 0, 0, 0, 454, 672, 905, 470, 679, 745, 0, 0, 722,
+  0, 0, 0, 65, 769, 421, 0, 0, 0, 0, 328, 630, 0, 0, 0, 282,
+  60, 0, 231, 243, 0, 853, 281, 452, 248, 450, 775, 777, 703, 0, 0, 0,
+  159, 457, 0, 553, 0, 0, 0, 0, 271, 0, 12, 966, 0, 727, 605, 0,
+  0, 396, 0, 0, 512, 0, 0, 0, 871, 0, 0, 190, 0, 433, 867, 14,
+  0, 0, 916, 0, 404, 0, 0, 502, 0, 822, 288, 0, 838, 608, 0, 0,
+  0, 0, 515, 0, 0, 315, 345, 418, 0, 0, 885, 0, 667, 314, 0, 0,
+  347, 227, 849, 276, 333, 133, 45, 790, 934, 987, 0, 644, 0, 0, 0, 0,
+  387, 141, 0, 0, 0, 367, 0, 254, 155, 303, 533, 939, 0, 0, 92, 0,
+  100, 25, 358, 685, 799, 894, 99, 519, 64, 593, 0, 0, 0, 0, 0, 776,
+  0, 163, 650, 728, 913, 0, 0, 693, 341, 510, 604, 0, 0, 326, 339, 531,
+  269, 0, 0, 0, 0, 610, 0, 0, 0, 184, 713, 889, 0, 0, 0, 0,
+  0, 181, 0, 0, 0, 300, 0, 0, 0, 0, 0, 0, 221, 0, 55, 0,
+  0, 0, 585, 0, 0, 0, 0, 298, 710, 0, 766, 175, 0, 0, 0, 0,
+  0, 407, 311, 548, 209, 0, 743, 192, 0, 0, 0, 925, 0, 369, 983, 0,
+  0, 0, 744, 801, 702, 717, 32, 0, 623, 968, 537, 114, 0, 0, 0, 0,
+  0, 0, 0, 0, 768, 112, 207, 126, 71, 85, 291, 125, 212, 278, 374, 449,
+  632, 670, 720, 856, 240, 957, 228, 295, 0, 704, 312, 197, 804, 0, 0, 0,
+  478, 0, 860, 0, 130, 0, 285, 0, 0, 735, 0, 50, 115, 342, 495, 900,
+  289, 935, 824, 0, 0, 657, 0, 0, 230, 619, 647, 506, 807, 997, 0, 0,
+  0, 0, 0, 187, 527, 880, 0, 198, 0, 0, 195, 318, 665, 0, 220, 0,
+  0, 0, 719, 0, 536, 0, 179, 0, 812, 388, 910, 528, 0, 241, 751, 24,
+  869, 729, 767, 217, 365, 309, 990, 479, 0, 0, 11, 232, 442, 505, 958, 0,
+  0, 0, 879, 959, 0, 0, 0, 448, 343, 0, 730, 949, 0, 0, 0, 0,
+  18, 541, 435, 803, 0, 0, 0, 205, 0, 562, 37, 842, 110, 0, 740, 8,
+  0, 0, 0, 131, 0, 0, 446, 0, 0, 0, 279, 986, 0, 352, 761, 0,
+  0, 0, 0, 0, 201, 0, 0, 0, 0, 0, 978, 0, 13, 883, 145, 0,
+  884, 572, 0, 0, 0, 366, 0, 747, 0, 0, 762, 0, 0, 0, 368, 0,
+  0, 0, 0, 857, 0, 587, 335, 0, 0, 0, 306, 0, 0, 0, 31, 90,
+  0, 443, 0, 0, 759, 96, 0, 371, 0, 0, 0, 873, 0, 0, 995, 0,
+  0, 0, 0, 149, 0, 877, 0, 0, 882, 0, 999, 0, 0, 0, 287, 0,
+  0, 0, 0, 0, 0, 0, 757, 464, 0, 0, 0, 0, 415, 578, 242, 631,
+  0, 39, 565, 847, 370, 493, 286, 701, 852, 0, 0, 0, 0, 0, 597, 0,
+  0, 0, 153, 0, 0, 0, 0, 0, 0, 0, 0, 813, 0, 0, 0, 0,
+  0, 0, 361, 0, 692, 938, 0, 0, 0, 0, 0, 0, 265, 0, 756, 0,
+  475, 0, 539, 422, 494, 87, 0, 0, 0, 991, 0, 107, 128, 423, 736, 0,
+  0, 0, 0, 0, 0, 0, 474, 912, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 698, 0, 0, 0, 764, 944, 985, 0, 0, 0, 0, 247, 0, 0, 0,
+  0, 0, 0, 855, 34, 0, 0, 0, 0, 0, 0, 0, 0, 105, 0, 620,
+  695, 0, 0, 466, 0, 0, 549, 0, 0, 0, 0, 33, 0, 0, 0, 0,
+  0, 635, 781, 118, 634, 797, 146, 689, 715, 833, 26, 576, 723, 977, 81, 0,
+  20, 174, 354, 177, 491, 0, 566, 596, 800, 890, 0, 78, 304, 0, 0, 558,
+  0, 0, 0, 677, 88, 151, 349, 0, 0, 489, 524, 654, 3, 964, 0, 189,
+  15, 513, 127, 213, 599, 802, 928, 841, 0, 0, 796, 583, 0, 0, 445, 0,
+  0, 0, 0, 0, 0, 2, 1000, 0, 0, 0, 0, 970, 839, 444, 140, 447,
+  492, 851, 874, 0, 0, 0, 204, 0, 0, 881, 0, 194, 755, 246, 0, 200,
+  0, 0, 284, 526, 772, 75, 917, 0, 0, 0, 0, 0, 0, 0, 0, 267,
+  972, 384, 509, 0, 117, 823, 0, 93, 0, 0, 0, 0, 196, 411, 961, 0,
+  0, 487, 0, 293, 616, 918, 0, 0, 921, 682, 974, 0, 104, 571, 915, 0,
+  0, 459, 0, 903, 552, 0, 379, 0, 316, 589, 601, 0, 621, 738, 150, 0,
+  389, 0, 982, 525, 363, 0, 0, 154, 234, 749, 0, 0, 0, 0, 607, 143,
+  0, 296, 186, 332, 0, 0, 164, 0, 0, 0, 0, 0, 0, 0, 700, 0,
+  0, 0, 0, 216, 992, 0, 346, 0, 748, 103, 976, 0, 0, 0, 0, 0,
+  655, 0, 0, 831, 0, 0, 40, 0, 0, 283, 0, 649, 0, 0, 721, 264,
+  0, 215, 0, 955, 0, 0, 0, 854, 382, 712, 102, 0, 10, 626, 245, 0,
+  0, 0, 63, 0, 0, 786, 0, 843, 0, 0, 0, 413, 834, 0, 180, 0,
+  185, 0, 0, 436, 965, 0, 0, 0, 0, 0, 517, 920, 0, 501, 253, 0,
+  544, 0, 611, 0, 0, 0, 0, 417, 0, 0, 0, 0, 0, 0, 941, 0,
+  0, 0, 676, 168, 0, 0, 0, 0, 0, 0, 0, 59, 0, 0, 0, 0,
+  0, 138, 0, 0, 0, 0, 0, 0, 0, 0, 0, 638, 0, 931, 0, 0,
+  173, 307, 0, 0, 0, 0, 0, 0, 0, 373, 0, 0, 0, 0, 0, 477,
+  0, 993, 0, 106, 914, 0, 0, 594, 830, 0, 360, 465, 0, 606, 816, 942,
+  0, 0, 0, 176, 0, 0, 0, 636, 0, 456, 0, 89, 82, 0, 47, 113,
+  586, 0, 0, 0, 0, 0, 732, 0, 0, 752, 787, 0, 0, 967, 0, 111,
+  0, 0, 0, 569, 0, 259, 290, 683, 763, 0, 0, 0, 0, 637, 0, 255,
+  0, 0, 0, 70, 357, 876, 38, 538, 530, 500, 297, 392, 211, 496, 516, 614,
+  788, 810, 77, 564, 359, 575, 16, 718, 820, 827, 0, 235, 529, 0, 0, 618,
+  0, 383, 0, 0, 674, 726, 0, 41, 385, 467, 0, 0, 760, 0, 666, 0,
+  923, 868, 898, 909, 0, 239, 0, 419, 0, 844, 994, 0, 0, 0, 129, 0,
+  0, 0, 434, 390, 147, 483, 0, 0, 0, 866, 0, 0, 0, 0, 0, 0,
+  135, 191, 0, 0, 504, 0, 29, 27, 0, 0, 0, 0, 998, 0, 0, 94,
+  408, 0, 0, 0, 0, 0, 0, 0, 0, 0, 268, 0, 427, 922, 46, 0,
+  780, 0, 919, 375, 236, 686, 403, 0, 0, 0, 0, 567, 0, 0, 0, 0,
+  0, 0, 0, 641, 0, 0, 0, 878, 56, 274, 62, 0, 223, 401, 940, 0,
+  0, 0, 0, 0, 137, 0, 336, 819, 0, 321, 0, 0, 622, 124, 277, 0,
+  0, 716, 0, 0, 0, 0, 0, 0, 353, 975, 188, 0, 555, 705, 437, 560,
+  581, 0, 532, 896, 440, 943, 0, 0, 0, 317, 69, 302, 659, 741, 808, 44,
+  773, 23, 121, 598, 0, 0, 0, 826, 0, 0, 0, 503, 0, 0, 0, 554,
+  660, 825, 0, 0, 0, 584, 861, 0, 225, 0, 0, 325, 95, 169, 0, 0,
+  821, 0, 0, 697, 0, 0, 0, 886, 53, 0, 0, 0, 0, 0, 0, 0,
+  461, 658, 0, 0, 0, 397, 840, 0, 0, 671, 9, 707, 0, 0, 656, 0,
+  0, 48, 136, 0, 488, 0, 0, 0, 0, 0, 648, 793, 430, 0, 0, 0,
+  0, 0, 244, 0, 0, 0, 0, 58, 222, 68, 372, 405, 518, 782, 818, 123,
+  258, 28, 329, 391, 498, 523, 930, 950, 989, 334, 167, 57, 337, 514, 17, 582,
+  643, 400, 451, 652, 937, 0, 0, 0, 462, 902, 327, 936, 0, 0, 108, 460,
+  0, 351, 0, 0, 0, 794, 0, 0, 0, 480, 0, 954, 266, 929, 0, 0,
+  119, 428, 0, 0, 182, 870, 416, 0, 412, 0, 863, 0, 72, 406, 485, 0,
+  809, 183, 0, 0, 0, 226, 789, 0, 547, 678, 684, 709, 628, 0, 0, 0,
+};
+
+const char *WA_FREQ_36_TOKENS[] = {
+  "you",
+  "i",
+  "the",
+  "to",
+  "a",
+  "'s",
+  "it",
+  "and",
+  "that",
+  "'t",
+  "of",
+  "is",
+  "in",
+  "what",
+  "we",
+  "me",
+  "this",
+  "he",
+  "for",
+  "my",
+  "on",
+  "have",
+  "your",
+  "do",
+  "was",
+  "'m",
+  "no",
+  "not",
+  "be",
+  "are",
+  "don",
+  "'re",
+  "know",
+  "can",
+  "with",
+  "but",
+  "all",
+  "so",
+  "just",
+  "there",
+  "here",
+  "they",
+  "like",
+  "'ll",
+  "get",
+  "she",
+  "go",
+  "if",
+  "right",
+  "out",
+  "about",
+  "up",
+  "at",
+  "him",
+  "now",
+  "oh",
+  "one",
+  "come",
+  "well",
+  "her",
+  "how",
+  "yeah",
+  "'ve",
+  "will",
+  "got",
+  "want",
+  "think",
+  "as",
+  "see",
+  "did",
+  "good",
+  "who",
+  "why",
+  "from",
+  "let",
+  "his",
+  "yes",
+  "when",
+  "going",
+  "time",
+  "an",
+  "okay",
+  "back",
+  "look",
+  "us",
+  "would",
+  "them",
+  "where",
+  "were",
+  "take",
+  "then",
+  "had",
+  "or",
+  "been",
+  "our",
+  "gonna",
+  "tell",
+  "really",
+  "man",
+  "some",
+  "say",
+  "hey",
+  "could",
+  "'d",
+  "didn",
+  "by",
+  "need",
+  "something",
+  "has",
+  "too",
+  "more",
+  "way",
+  "down",
+  "make",
+  "very",
+  "never",
+  "only",
+  "people",
+  "over",
+  "because",
+  "little",
+  "please",
+  "love",
+  "should",
+  "mean",
+  "said",
+  "sorry",
+  "give",
+  "off",
+  "am",
+  "thank",
+  "any",
+  "two",
+  "even",
+  "much",
+  "doing",
+  "sure",
+  "thing",
+  "these",
+  "help",
+  "first",
+  "into",
+  "anything",
+  "still",
+  "find",
+  "life",
+  "nothing",
+  "sir",
+  "day",
+  "god",
+  "work",
+  "their",
+  "uh",
+  "again",
+  "maybe",
+  "must",
+  "before",
+  "other",
+  "wait",
+  "stop",
+  "call",
+  "after",
+  "won",
+  "talk",
+  "away",
+  "than",
+  "thought",
+  "home",
+  "night",
+  "put",
+  "great",
+  "those",
+  "last",
+  "better",
+  "everything",
+  "told",
+  "mr.",
+  "new",
+  "things",
+  "always",
+  "keep",
+  "long",
+  "years",
+  "leave",
+  "does",
+  "money",
+  "around",
+  "doesn",
+  "name",
+  "place",
+  "ever",
+  "feel",
+  "guys",
+  "father",
+  "guy",
+  "made",
+  "old",
+  "isn",
+  "which",
+  "big",
+  "lot",
+  "done",
+  "hello",
+  "nice",
+  "believe",
+  "girl",
+  "someone",
+  "fine",
+  "thanks",
+  "wanted",
+  "kind",
+  "coming",
+  "house",
+  "every",
+  "ok",
+  "through",
+  "being",
+  "course",
+  "stay",
+  "left",
+  "dad",
+  "enough",
+  "happened",
+  "came",
+  "may",
+  "mother",
+  "wrong",
+  "world",
+  "bad",
+  "might",
+  "three",
+  "today",
+  "listen",
+  "another",
+  "understand",
+  "hear",
+  "remember",
+  "ask",
+  "own",
+  "same",
+  "show",
+  "else",
+  "kill",
+  "talking",
+  "found",
+  "next",
+  "getting",
+  "care",
+  "car",
+  "looking",
+  "son",
+  "try",
+  "woman",
+  "went",
+  "hi",
+  "dead",
+  "many",
+  "mind",
+  "wasn",
+  "friend",
+  "best",
+  "mom",
+  "hell",
+  "morning",
+  "trying",
+  "boy",
+  "together",
+  "yourself",
+  "job",
+  "saw",
+  "family",
+  "real",
+  "without",
+  "baby",
+  "room",
+  "wouldn",
+  "already",
+  "move",
+  "most",
+  "seen",
+  "live",
+  "miss",
+  "actually",
+  "huh",
+  "shit",
+  "both",
+  "heard",
+  "once",
+  "ready",
+  "head",
+  "called",
+  "used",
+  "idea",
+  "knew",
+  "hold",
+  "happy",
+  "door",
+  "such",
+  "fuck",
+  "brother",
+  "also",
+  "pretty",
+  "bit",
+  "took",
+  "haven",
+  "yet",
+  "men",
+  "whole",
+  "start",
+  "use",
+  "while",
+  "since",
+  "wife",
+  "days",
+  "guess",
+  "tomorrow",
+  "matter",
+  "meet",
+  "bring",
+  "tonight",
+  "everyone",
+  "run",
+  "wanna",
+  "hard",
+  "ah",
+  "alone",
+  "myself",
+  "school",
+  "gone",
+  "um",
+  "end",
+  "saying",
+  "phone",
+  "play",
+  "looks",
+  "couldn",
+  "fucking",
+  "problem",
+  "few",
+  "friends",
+  "gotta",
+  "ago",
+  "open",
+  "anyone",
+  "killed",
+  "hope",
+  "face",
+  "until",
+  "lost",
+  "police",
+  "excuse",
+  "turn",
+  "business",
+  "case",
+  "wants",
+  "says",
+  "true",
+  "die",
+  "heart",
+  "soon",
+  "each",
+  "worry",
+  "later",
+  "year",
+  "watch",
+  "music",
+  "hand",
+  "having",
+  "probably",
+  "beautiful",
+  "doctor",
+  "sit",
+  "eat",
+  "thinking",
+  "young",
+  "second",
+  "working",
+  "water",
+  "person",
+  "part",
+  "kids",
+  "late",
+  "stuff",
+  "exactly",
+  "under",
+  "death",
+  "minute",
+  "pay",
+  "crazy",
+  "forget",
+  "everybody",
+  "kid",
+  "change",
+  "gave",
+  "happen",
+  "damn",
+  "five",
+  "drink",
+  "far",
+  "knows",
+  "its",
+  "whatever",
+  "eyes",
+  "shut",
+  "aren",
+  "hit",
+  "taking",
+  "easy",
+  "times",
+  "check",
+  "hands",
+  "minutes",
+  "deal",
+  "different",
+  "means",
+  "point",
+  "inside",
+  "makes",
+  "asked",
+  "somebody",
+  "mine",
+  "making",
+  "body",
+  "afraid",
+  "sleep",
+  "chance",
+  "dear",
+  "quite",
+  "four",
+  "anyway",
+  "close",
+  "ain",
+  "party",
+  "fun",
+  "against",
+  "word",
+  "comes",
+  "important",
+  "set",
+  "shall",
+  "story",
+  "number",
+  "daughter",
+  "least",
+  "waiting",
+  "hurt",
+  "wish",
+  "moment",
+  "fight",
+  "week",
+  "husband",
+  "girls",
+  "rest",
+  "married",
+  "fire",
+  "game",
+  "nobody",
+  "mr",
+  "children",
+  "side",
+  "stand",
+  "read",
+  "though",
+  "cut",
+  "started",
+  "sister",
+  "supposed",
+  "between",
+  "child",
+  "goes",
+  "hours",
+  "speak",
+  "women",
+  "behind",
+  "almost",
+  "truth",
+  "blood",
+  "able",
+  "lady",
+  "anymore",
+  "playing",
+  "gets",
+  "shot",
+  "reason",
+  "trouble",
+  "break",
+  "war",
+  "city",
+  "walk",
+  "town",
+  "trust",
+  "dr.",
+  "met",
+  "office",
+  "question",
+  "brought",
+  "yours",
+  "welcome",
+  "high",
+  "wow",
+  "couple",
+  "half",
+  "died",
+  "cool",
+  "free",
+  "either",
+  "seems",
+  "power",
+  "whoa",
+  "bye",
+  "buy",
+  "telling",
+  "honey",
+  "tried",
+  "front",
+  "team",
+  "answer",
+  "gun",
+  "boys",
+  "line",
+  "send",
+  "news",
+  "stupid",
+  "bed",
+  "hurry",
+  "full",
+  "months",
+  "save",
+  "sometimes",
+  "become",
+  "along",
+  "hate",
+  "food",
+  "outside",
+  "light",
+  "l",
+  "needs",
+  "dog",
+  "country",
+  "clear",
+  "order",
+  "em",
+  "fact",
+  "lord",
+  "captain",
+  "six",
+  "hot",
+  "funny",
+  "black",
+  "mrs.",
+  "alive",
+  "pick",
+  "feeling",
+  "living",
+  "cause",
+  "ahead",
+  "lose",
+  "king",
+  "plan",
+  "dinner",
+  "sighs",
+  "sort",
+  "leaving",
+  "shouldn",
+  "running",
+  "boss",
+  "alright",
+  "promise",
+  "taken",
+  "safe",
+  "ma",
+  "book",
+  "sent",
+  "white",
+  "hour",
+  "anybody",
+  "small",
+  "perfect",
+  "'cause",
+  "lives",
+  "special",
+  "parents",
+  "s",
+  "john",
+  "himself",
+  "perhaps",
+  "sounds",
+  "serious",
+  "sick",
+  "company",
+  "ha",
+  "scared",
+  "uncle",
+  "poor",
+  "red",
+  "past",
+  "earth",
+  "possible",
+  "shoot",
+  "touch",
+  "sound",
+  "top",
+  "ass",
+  "laughs",
+  "cannot",
+  "asking",
+  "win",
+  "glad",
+  "control",
+  "hmm",
+  "human",
+  "drive",
+  "hair",
+  "jack",
+  "bitch",
+  "luck",
+  "murder",
+  "happens",
+  "air",
+  "ten",
+  "daddy",
+  "finally",
+  "chuckles",
+  "fast",
+  "cold",
+  "seem",
+  "laughing",
+  "words",
+  "hospital",
+  "street",
+  "hang",
+  "dance",
+  "meeting",
+  "till",
+  "others",
+  "catch",
+  "follow",
+  "sense",
+  "sex",
+  "lie",
+  "evening",
+  "master",
+  "known",
+  "dream",
+  "write",
+  "million",
+  "voice",
+  "sweet",
+  "rather",
+  "felt",
+  "sign",
+  "lucky",
+  "somewhere",
+  "bet",
+  "o",
+  "jesus",
+  "longer",
+  "calling",
+  "worked",
+  "quiet",
+  "looked",
+  "less",
+  "pull",
+  "beat",
+  "careful",
+  "coffee",
+  "return",
+  "secret",
+  "weeks",
+  "weren",
+  "date",
+  "seeing",
+  "fall",
+  "given",
+  "ooh",
+  "fault",
+  "straight",
+  "takes",
+  "song",
+  "future",
+  "gentlemen",
+  "loved",
+  "changed",
+  "road",
+  "calm",
+  "wonderful",
+  "mad",
+  "turned",
+  "drop",
+  "ladies",
+  "learn",
+  "step",
+  "absolutely",
+  "early",
+  "explain",
+  "clean",
+  "piece",
+  "yesterday",
+  "throw",
+  "picture",
+  "land",
+  "feet",
+  "wonder",
+  "questions",
+  "speaking",
+  "worth",
+  "darling",
+  "dude",
+  "giving",
+  "president",
+  "eye",
+  "quick",
+  "moving",
+  "figure",
+  "state",
+  "strong",
+  "sam",
+  "none",
+  "amazing",
+  "ones",
+  "works",
+  "act",
+  "needed",
+  "weird",
+  "law",
+  "worried",
+  "report",
+  "goodbye",
+  "missing",
+  "choice",
+  "happening",
+  "chief",
+  "wedding",
+  "strange",
+  "general",
+  "pain",
+  "'am",
+  "kidding",
+  "decided",
+  "ya",
+  "pass",
+  "tired",
+  "class",
+  "officer",
+  "kept",
+  "wake",
+  "worse",
+  "busy",
+  "eh",
+  "mistake",
+  "kiss",
+  "court",
+  "building",
+  "finish",
+  "during",
+  "age",
+  "ship",
+  "caught",
+  "marry",
+  "meant",
+  "sell",
+  "dark",
+  "watching",
+  "system",
+  "suppose",
+  "evidence",
+  "movie",
+  "ride",
+  "t",
+  "completely",
+  "mouth",
+  "totally",
+  "birthday",
+  "tv",
+  "forgive",
+  "born",
+  "imagine",
+  "information",
+  "instead",
+  "definitely",
+  "security",
+  "certainly",
+  "film",
+  "month",
+  "lying",
+  "unless",
+  "train",
+  "seven",
+  "wear",
+  "clothes",
+  "michael",
+  "hotel",
+  "christmas",
+  "attack",
+  "hasn",
+  "round",
+  "expect",
+  "sing",
+  "terrible",
+  "george",
+  "bag",
+  "history",
+  "blue",
+  "near",
+  "broke",
+  "station",
+  "seriously",
+  "forever",
+  "david",
+  "frank",
+  "except",
+  "thinks",
+  "message",
+  "entire",
+  "joe",
+  "table",
+  "talked",
+  "across",
+  "rock",
+  "lovely",
+  "handle",
+  "middle",
+  "buddy",
+  "paid",
+  "protect",
+  "using",
+  "floor",
+  "ran",
+  "swear",
+  "spend",
+  "situation",
+  "ring",
+  "anywhere",
+  "dangerous",
+  "bill",
+  "york",
+  "army",
+  "lead",
+  "bought",
+  "finished",
+  "fair",
+  "sun",
+  "letter",
+  "fool",
+  "attention",
+  "club",
+  "simple",
+  "interesting",
+  "space",
+  "test",
+  "box",
+  "group",
+  "single",
+  "sitting",
+  "marriage",
+  "join",
+  "fear",
+  "d",
+  "peace",
+  "forgot",
+  "force",
+  "short",
+  "normal",
+  "charlie",
+  "present",
+  "enjoy",
+  "mike",
+  "crime",
+  "horse",
+  "ground",
+  "american",
+  "count",
+  "area",
+  "charge",
+  "honor",
+  "lunch",
+  "miles",
+  "radio",
+  "idiot",
+  "ball",
+  "surprise",
+  "paper",
+  "key",
+  "boat",
+  "quickly",
+  "gold",
+  "bar",
+  "fish",
+  "mark",
+  "tom",
+  "wearing",
+  "crying",
+  "accident",
+  "government",
+  "eight",
+  "fell",
+  "cover",
+  "certain",
+  "interested",
+  "deep",
+  "star",
+  "sea",
+  "agree",
+  "problems",
+  "detective",
+  "prison",
+  "major",
+  "stick",
+  "offer",
+  "difficult",
+  "smart",
+  "personal",
+  "record",
+  "stopped",
+  "hide",
+  "whether",
+  "bank",
+  "trip",
+  "relax",
+  "america",
+  "public",
+  "list",
+  "afternoon",
+  "brain",
+  "fix",
+  "bastard",
+  "proud",
+  "tea",
+  "service",
+  "screaming",
+  "forward",
+  "angry",
+  "park",
+  "soul",
+  "fighting",
+  "peter",
+  "rich",
+  "agent",
+  "blow",
+  "paul",
+  "dress",
+  "mary",
+  "missed",
+  "scene",
+  "killing",
+  "standing",
+  "saved",
+  "mm",
+  "respect",
+  "killer",
+  "ice",
+  "mess",
+  "tough",
+  "feels",
+  "church",
+  "sad",
+  "cell",
+  "drunk",
+  "share",
+  "camera",
+  "mm-hmm",
+  "within",
+  "card",
+  "fly",
+  "ben",
+  "girlfriend",
+  "laugh",
+  "smell",
+  "broken",
+  "mum",
+  "honest",
+  "often",
+  "starting",
+  "calls",
+  "y",
+  "spent",
+  "third",
+  "english",
+  "visit",
+  "mama",
+  "judge",
+  "window",
+  "hungry",
+  "dare",
+  "relationship",
+  "moved",
+  "prove",
+  "private",
+  "wall",
+  "seat",
+  "i-i",
+  "position",
+  "lieutenant",
+  "realize",
+  "lt",
+  "especially",
+  "machine",
+  "walking",
+  "art",
+  "pleasure",
+};
+const uint16_t WA_FREQ_36_RANKS[] = {
+  924, 107, 999, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 406, 0,
+  68, 681, 0, 0, 0, 994, 259, 663, 0, 0, 0, 0, 0, 234, 0, 35,
+  213, 873, 0, 122, 0, 982, 582, 680, 860, 0, 0, 0, 0, 0, 105, 858,
+  902, 0, 649, 0, 151, 381, 734, 0, 0, 757, 394, 0, 0, 484, 513, 0,
+  443, 603, 0, 0, 0, 988, 0, 0, 0, 0, 0, 268, 0, 402, 0, 0,
+  0, 699, 200, 833, 0, 162, 46, 407, 0, 727, 834, 270, 0, 303, 263, 0,
+  0, 0, 0, 593, 0, 592, 313, 857, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 225, 0, 0, 566, 0, 601, 0, 57,
+  0, 0, 15, 507, 845, 0, 0, 0, 0, 0, 421, 216, 172, 0, 145, 255,
+  912, 0, 461, 0, 0, 0, 526, 0, 383, 470, 0, 0, 0, 346, 0, 987,
+  0, 684, 410, 997, 426, 233, 0, 214, 0, 0, 0, 644, 0, 0, 250, 826,
+  297, 0, 157, 327, 622, 605, 0, 0, 48, 749, 0, 646, 516, 633, 647, 0,
+  333, 0, 0, 0, 870, 511, 631, 599, 0, 0, 729, 0, 0, 687, 463, 947,
+  989, 606, 348, 356, 0, 0, 0, 584, 0, 0, 45, 125, 745, 0, 82, 222,
+  0, 0, 326, 17, 0, 0, 0, 0, 0, 413, 0, 0, 0, 0, 558, 0,
+  0, 0, 722, 169, 0, 0, 247, 0, 278, 0, 846, 0, 0, 0, 0, 293,
+  67, 0, 0, 0, 0, 0, 0, 0, 0, 800, 0, 0, 0, 0, 6, 269,
+  390, 629, 382, 0, 0, 0, 731, 676, 783, 0, 0, 341, 324, 0, 0, 462,
+  863, 889, 0, 0, 0, 0, 0, 205, 446, 806, 927, 696, 36, 266, 726, 896,
+  0, 0, 560, 0, 41, 0, 301, 0, 0, 228, 501, 578, 0, 499, 540, 0,
+  265, 0, 0, 22, 993, 158, 0, 0, 0, 314, 894, 0, 821, 919, 0, 0,
+  0, 0, 0, 0, 0, 80, 0, 0, 694, 0, 0, 321, 0, 0, 0, 445,
+  0, 0, 755, 0, 0, 12, 0, 0, 0, 531, 0, 0, 0, 955, 137, 156,
+  0, 0, 524, 533, 720, 808, 856, 0, 0, 0, 0, 0, 0, 0, 474, 0,
+  0, 0, 280, 256, 0, 0, 0, 483, 0, 428, 469, 718, 0, 752, 0, 0,
+  940, 0, 801, 0, 715, 0, 0, 750, 229, 0, 796, 962, 839, 670, 691, 319,
+  702, 0, 965, 16, 630, 0, 0, 0, 0, 0, 492, 73, 521, 261, 0, 766,
+  0, 0, 160, 5, 69, 665, 0, 0, 0, 298, 0, 0, 0, 74, 529, 0,
+  0, 675, 0, 0, 0, 168, 302, 322, 0, 0, 0, 0, 0, 70, 0, 159,
+  688, 0, 0, 434, 550, 0, 0, 0, 0, 0, 770, 0, 946, 0, 0, 0,
+  716, 0, 0, 0, 0, 0, 0, 693, 0, 0, 661, 612, 0, 66, 219, 843,
+  366, 152, 467, 660, 190, 115, 430, 373, 3, 34, 481, 686, 762, 825, 959, 0,
+  0, 0, 0, 753, 736, 836, 0, 97, 0, 0, 0, 0, 0, 891, 175, 0,
+  0, 0, 855, 78, 0, 311, 435, 0, 844, 900, 0, 0, 0, 0, 0, 0,
+  0, 567, 0, 0, 0, 641, 0, 432, 929, 0, 359, 0, 0, 0, 93, 0,
+  0, 0, 0, 0, 613, 0, 121, 0, 888, 0, 404, 953, 0, 0, 0, 154,
+  473, 0, 0, 0, 823, 351, 0, 0, 0, 0, 570, 0, 399, 0, 0, 0,
+  0, 0, 774, 0, 31, 141, 803, 0, 0, 0, 231, 476, 414, 60, 76, 194,
+  0, 275, 0, 0, 0, 0, 0, 678, 0, 0, 0, 512, 215, 235, 365, 923,
+  0, 218, 477, 751, 0, 0, 281, 221, 282, 0, 0, 472, 698, 0, 692, 817,
+  728, 409, 850, 904, 0, 0, 0, 760, 0, 0, 211, 905, 0, 973, 0, 146,
+  91, 884, 0, 0, 0, 0, 0, 0, 0, 0, 129, 819, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 179, 0, 419, 615, 0, 0, 610, 0, 677, 0,
+  0, 557, 285, 928, 765, 0, 811, 0, 0, 0, 0, 0, 177, 238, 99, 0,
+  0, 0, 0, 0, 658, 914, 943, 871, 934, 597, 0, 183, 464, 77, 616, 0,
+  150, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 95, 0, 595, 741,
+  778, 0, 848, 85, 0, 0, 620, 0, 0, 0, 0, 239, 480, 797, 0, 23,
+  0, 721, 0, 0, 0, 0, 853, 0, 187, 899, 0, 117, 735, 572, 992, 0,
+  506, 0, 397, 197, 0, 358, 90, 747, 786, 935, 0, 184, 0, 0, 0, 0,
+  0, 0, 0, 0, 32, 0, 0, 565, 0, 0, 0, 818, 866, 0, 768, 0,
+  142, 655, 173, 831, 0, 0, 695, 706, 937, 400, 0, 0, 886, 54, 957, 602,
+  945, 0, 773, 0, 0, 0, 283, 0, 0, 0, 0, 376, 494, 0, 0, 0,
+  0, 0, 0, 604, 837, 0, 422, 885, 763, 317, 189, 106, 748, 922, 0, 0,
+  0, 868, 547, 0, 0, 714, 0, 0, 0, 0, 0, 528, 0, 0, 334, 243,
+  64, 455, 56, 71, 267, 296, 0, 0, 0, 0, 548, 532, 673, 0, 2, 377,
+  0, 395, 0, 457, 315, 380, 465, 519, 0, 0, 555, 576, 0, 0, 0, 201,
+  861, 0, 651, 0, 450, 0, 448, 951, 733, 608, 598, 0, 525, 0, 0, 424,
+  921, 196, 0, 0, 81, 961, 812, 0, 0, 286, 0, 708, 744, 703, 0, 0,
+  0, 897, 0, 0, 456, 0, 626, 539, 155, 0, 938, 403, 679, 0, 58, 493,
+  236, 0, 0, 0, 0, 83, 0, 0, 0, 0, 307, 292, 0, 374, 869, 0,
+  0, 0, 0, 545, 832, 0, 459, 0, 0, 0, 14, 794, 0, 0, 0, 662,
+  0, 0, 913, 0, 0, 123, 212, 704, 898, 49, 941, 0, 124, 253, 0, 925,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 468,
+  0, 340, 0, 39, 181, 227, 101, 355, 650, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 949, 0, 206, 645, 876, 102, 0, 412, 98, 880,
+  43, 166, 887, 127, 416, 976, 0, 0, 784, 0, 350, 30, 583, 0, 0, 118,
+  0, 0, 769, 0, 835, 986, 330, 0, 0, 0, 0, 88, 0, 0, 0, 932,
+  112, 543, 0, 0, 782, 505, 590, 979, 515, 0, 0, 0, 0, 0, 841, 0,
+  79, 28, 114, 128, 264, 952, 0, 0, 308, 0, 0, 490, 0, 87, 186, 202,
+  916, 0, 0, 0, 65, 944, 0, 793, 0, 0, 0, 0, 0, 0, 561, 577,
+  854, 357, 0, 864, 0, 0, 829, 0, 11, 370, 444, 0, 0, 0, 276, 890,
+  0, 0, 701, 0, 0, 0, 892, 0, 0, 0, 104, 375, 840, 0, 0, 325,
+  648, 0, 0, 0, 0, 199, 775, 0, 0, 523, 568, 0, 0, 337, 0, 0,
+  110, 0, 0, 596, 0, 0, 877, 0, 249, 433, 0, 0, 0, 956, 460, 328,
+  260, 874, 667, 53, 802, 948, 55, 0, 0, 0, 0, 38, 224, 0, 0, 820,
+  966, 653, 0, 0, 0, 0, 632, 226, 0, 975, 668, 0, 0, 331, 0, 0,
+  92, 0, 0, 26, 903, 479, 0, 0, 0, 0, 0, 0, 61, 86, 131, 0,
+  689, 0, 119, 246, 0, 0, 0, 0, 475, 495, 0, 0, 0, 0, 0, 842,
+  7, 895, 192, 0, 0, 0, 723, 244, 697, 594, 167, 72, 562, 343, 0, 0,
+  0, 0, 0, 0, 312, 10, 94, 290, 520, 671, 712, 393, 571, 0, 0, 0,
+  0, 437, 387, 814, 0, 498, 504, 950, 0, 0, 178, 273, 0, 191, 0, 0,
+  0, 496, 0, 654, 0, 0, 0, 109, 96, 0, 207, 960, 0, 0, 0, 0,
+  0, 0, 0, 936, 271, 299, 730, 0, 0, 0, 0, 0, 634, 0, 0, 143,
+  972, 0, 0, 0, 0, 0, 0, 514, 530, 707, 59, 138, 672, 709, 764, 139,
+  436, 223, 0, 0, 906, 0, 705, 0, 291, 89, 164, 0, 958, 335, 396, 332,
+  180, 411, 427, 500, 799, 209, 792, 0, 642, 0, 739, 120, 0, 0, 0, 0,
+  998, 0, 893, 0, 0, 995, 482, 318, 743, 360, 510, 0, 0, 0, 0, 0,
+  0, 0, 618, 758, 0, 0, 0, 0, 0, 607, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 969, 251, 0, 0, 824, 0, 0, 423, 0, 0, 0, 0, 0,
+  438, 0, 556, 0, 0, 0, 0, 0, 136, 362, 503, 971, 967, 963, 0, 0,
+  911, 776, 0, 0, 537, 29, 204, 538, 0, 287, 0, 198, 586, 522, 917, 780,
+  0, 0, 563, 0, 0, 0, 342, 666, 761, 767, 600, 388, 830, 867, 254, 657,
+  974, 1000, 364, 779, 0, 0, 401, 0, 111, 0, 849, 441, 485, 851, 0, 781,
+  738, 0, 0, 0, 0, 981, 368, 466, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 103, 0, 431, 656, 0, 379, 0, 502, 0, 0, 363, 732, 978, 487, 737,
+  170, 954, 0, 0, 0, 0, 0, 581, 452, 0, 0, 232, 140, 257, 883, 0,
+  0, 0, 50, 274, 996, 0, 859, 0, 816, 0, 0, 245, 627, 0, 309, 0,
+  0, 1, 635, 408, 391, 338, 546, 881, 0, 0, 0, 639, 52, 0, 0, 0,
+  0, 0, 907, 339, 0, 451, 0, 0, 0, 144, 534, 0, 0, 0, 84, 0,
+  497, 0, 0, 977, 488, 405, 0, 0, 0, 0, 0, 384, 0, 0, 0, 0,
+  0, 0, 0, 0, 320, 0, 0, 815, 0, 230, 0, 20, 541, 636, 791, 985,
+  389, 713, 134, 0, 0, 385, 0, 0, 0, 0, 0, 643, 882, 621, 970, 240,
+  458, 717, 910, 372, 0, 0, 471, 544, 369, 0, 0, 0, 0, 508, 203, 0,
+  33, 0, 0, 0, 0, 0, 0, 591, 0, 0, 589, 0, 220, 0, 0, 822,
+  0, 0, 875, 25, 0, 527, 0, 0, 0, 0, 19, 685, 0, 0, 0, 0,
+  454, 865, 0, 130, 0, 429, 182, 637, 295, 210, 983, 0, 809, 0, 185, 329,
+  347, 942, 0, 847, 0, 0, 0, 690, 294, 442, 518, 248, 862, 939, 805, 417,
+  813, 991, 579, 0, 336, 0, 0, 163, 272, 352, 0, 0, 0, 0, 0, 0,
+  0, 171, 353, 0, 0, 0, 0, 0, 0, 754, 852, 4, 659, 0, 0, 0,
+  0, 931, 0, 617, 0, 0, 0, 0, 0, 354, 746, 62, 40, 0, 619, 0,
+  0, 0, 0, 0, 0, 740, 306, 0, 0, 0, 449, 0, 0, 542, 901, 0,
+  47, 165, 174, 623, 683, 0, 241, 628, 798, 262, 0, 0, 0, 0, 0, 161,
+  0, 0, 0, 0, 0, 0, 0, 100, 8, 0, 0, 0, 0, 0, 878, 574,
+  0, 478, 0, 0, 0, 0, 804, 807, 415, 323, 710, 0, 242, 21, 771, 920,
+  0, 0, 0, 453, 990, 0, 0, 926, 0, 132, 930, 0, 133, 37, 711, 788,
+  63, 569, 810, 611, 0, 0, 237, 777, 652, 279, 0, 0, 0, 559, 573, 614,
+  0, 0, 208, 918, 344, 0, 0, 0, 0, 0, 0, 789, 193, 536, 386, 585,
+  759, 980, 551, 0, 0, 587, 0, 378, 575, 0, 0, 349, 108, 116, 392, 440,
+  756, 785, 909, 838, 968, 176, 0, 0, 719, 0, 0, 0, 564, 0, 153, 0,
+  0, 0, 0, 0, 0, 674, 147, 288, 0, 0, 828, 0, 44, 18, 795, 0,
+  0, 0, 0, 284, 361, 0, 0, 0, 0, 0, 984, 0, 879, 0, 0, 553,
+  0, 0, 0, 908, 300, 0, 609, 0, 418, 0, 0, 0, 0, 42, 0, 420,
+  0, 0, 0, 304, 535, 0, 669, 0, 0, 0, 13, 787, 0, 0, 554, 439,
+  664, 316, 724, 258, 486, 305, 915, 135, 398, 790, 425, 933, 345, 217, 772, 625,
+  113, 0, 0, 0, 0, 51, 367, 624, 509, 725, 0, 0, 195, 310, 0, 827,
+  580, 24, 742, 0, 0, 252, 489, 149, 640, 0, 0, 9, 188, 552, 0, 0,
+  0, 0, 0, 491, 588, 964, 0, 517, 0, 682, 700, 0, 872, 638, 0, 371,
+  0, 0, 289, 447, 549, 277, 0, 0, 0, 0, 0, 0, 126, 75, 27, 148,
+};
+
+const char *WA_FREQ_37_TOKENS[] = {
+  "la",
+  "mi",
+  "vi",
+  "ne",
+  "estas",
+  "kaj",
+  "ĉu",
+  "de",
+  "al",
+  "ni",
+  "en",
+  "li",
+  "ke",
+  "por",
+  "ĉi",
+  "tio",
+  "sed",
+  "ili",
+  "kiel",
+  "vin",
+  "tie",
+  "pri",
+  "min",
+  "jes",
+  "kio",
+  "mia",
+  "kun",
+  "estis",
+  "kion",
+  "ĝi",
+  "povas",
+  "kiu",
+  "via",
+  "tiu",
+  "ĝin",
+  "ŝi",
+  "bone",
+  "tion",
+  "se",
+  "volas",
+  "havas",
+  "do",
+  "pli",
+  "nur",
+  "oni",
+  "nun",
+  "scias",
+  "kial",
+  "devas",
+  "lin",
+  "el",
+  "kiam",
+  "unu",
+  "kie",
+  "ja",
+  "jam",
+  "jen",
+  "tiel",
+  "nu",
+  "da",
+  "sur",
+  "ankaŭ",
+  "pro",
+  "tre",
+  "per",
+  "ĉiuj",
+  "je",
+  "diris",
+  "aŭ",
+  "estos",
+  "ilin",
+  "ho",
+  "vian",
+  "tiun",
+  "iru",
+  "ĉar",
+  "nin",
+  "nia",
+  "plu",
+  "ĉio",
+  "dum",
+  "mian",
+  "sinjoro",
+  "ankoraŭ",
+  "dankon",
+  "vere",
+  "esti",
+  "eĉ",
+  "ĝis",
+  "neniam",
+  "venu",
+  "eble",
+  "diras",
+  "dio",
+  "ion",
+  "du",
+  "antaŭ",
+  "ĉe",
+  "ĉiam",
+  "tiuj",
+  "ol",
+  "post",
+  "iu",
+  "fari",
+  "tien",
+  "bezonas",
+  "plej",
+  "tiom",
+  "homoj",
+  "kia",
+  "ĉion",
+  "bona",
+  "certe",
+  "bonan",
+  "rigardu",
+  "faras",
+  "tuj",
+  "patro",
+  "faris",
+  "bonvolu",
+  "diru",
+  "sen",
+  "paĉjo",
+  "kiuj",
+  "pardonu",
+  "panjo",
+  "poste",
+  "lia",
+  "saluton",
+  "mem",
+  "vidis",
+  "tempo",
+  "vivo",
+  "tute",
+  "neniu",
+  "kiom",
+  "tro",
+  "ŝin",
+  "ek",
+  "pensas",
+  "kiun",
+  "laŭ",
+  "vidas",
+  "okazas",
+  "nenion",
+  "okazis",
+  "viaj",
+  "estu",
+  "multe",
+  "atendu",
+  "petas",
+  "hodiaŭ",
+  "faru",
+  "iom",
+  "diri",
+  "lasu",
+  "granda",
+  "komprenas",
+  "alia",
+  "homo",
+  "tiam",
+  "miaj",
+  "for",
+  "tamen",
+  "venis",
+  "mondo",
+  "ĉiu",
+  "estus",
+  "ha",
+  "io",
+  "kien",
+  "nenio",
+  "vidi",
+  "jaroj",
+  "rapide",
+  "iras",
+  "iri",
+  "ci",
+  "ŝatas",
+  "havis",
+  "denove",
+  "patrino",
+  "povus",
+  "tri",
+  "niaj",
+  "ajn",
+  "tagon",
+  "eblas",
+  "volis",
+  "parolas",
+  "donu",
+  "sia",
+  "aliaj",
+  "kredas",
+  "kontraŭ",
+  "ĝuste",
+  "aŭskultu",
+  "rajtas",
+  "unua",
+  "tia",
+  "sian",
+  "viajn",
+  "sin",
+  "prenu",
+  "sola",
+  "konas",
+  "kara",
+  "nek",
+  "morgaŭ",
+  "filo",
+  "bela",
+  "he",
+  "faros",
+  "tuta",
+  "ĉiujn",
+  "gravas",
+  "ŝajnas",
+  "infanoj",
+  "sinjorino",
+  "vidu",
+  "venas",
+  "trovis",
+  "nomo",
+  "alian",
+  "iros",
+  "kune",
+  "opinias",
+  "necesas",
+  "iam",
+  "timas",
+  "helpu",
+  "afero",
+  "venos",
+  "inter",
+  "sentas",
+  "tago",
+  "amas",
+  "baldaŭ",
+  "amiko",
+  "ekde",
+  "simple",
+  "povos",
+  "kompreneble",
+  "paroli",
+  "longe",
+  "preskaŭ",
+  "pensis",
+  "edzino",
+  "tero",
+  "foriru",
+  "fartas",
+  "bonege",
+  "mortis",
+  "ĉesu",
+  "frato",
+  "restu",
+  "ekzistas",
+  "tiujn",
+  "vivon",
+  "hej",
+  "tra",
+  "reĝo",
+  "sub",
+  "atentu",
+  "tutan",
+  "iun",
+  "aŭdis",
+  "haltu",
+  "milito",
+  "knabo",
+  "vera",
+  "domo",
+  "helpi",
+  "loko",
+  "aŭdas",
+  "vivas",
+  "povis",
+  "kvazaŭ",
+  "nian",
+  "bedaŭras",
+  "deziras",
+  "antaŭe",
+  "viro",
+  "aspektas",
+  "l",
+  "revenos",
+  "fratino",
+  "morto",
+  "unue",
+  "bonvole",
+  "ordo",
+  "sufiĉas",
+  "tempon",
+  "sciis",
+  "memoras",
+  "miajn",
+  "amo",
+  "gvidanto",
+  "hejmen",
+  "nova",
+  "sufiĉe",
+  "moŝto",
+  "laboro",
+  "ŝia",
+  "certas",
+  "kiujn",
+  "komprenis",
+  "iomete",
+  "devus",
+  "zorgu",
+  "amikoj",
+  "akvo",
+  "fino",
+  "signifas",
+  "malfermu",
+  "iris",
+  "sankta",
+  "ĵus",
+  "devos",
+  "kvin",
+  "virino",
+  "verŝajne",
+  "æu",
+  "lando",
+  "atendas",
+  "kapablas",
+  "koro",
+  "barono",
+  "scii",
+  "manĝi",
+  "damne",
+  "restos",
+  "lian",
+  "horo",
+  "monon",
+  "finfine",
+  "tial",
+  "almenaŭ",
+  "multaj",
+  "nokton",
+  "dek",
+  "mortos",
+  "mono",
+  "malbone",
+  "pretas",
+  "ilia",
+  "forgesis",
+  "restas",
+  "vojo",
+  "malpli",
+  "donis",
+  "okazos",
+  "lasta",
+  "ku",
+  "restis",
+  "decidis",
+  "malbona",
+  "ege",
+  "eniru",
+  "foriri",
+  "tagoj",
+  "apud",
+  "urbo",
+  "iŝan",
+  "perdis",
+  "knabino",
+  "grava",
+  "bonas",
+  "havi",
+  "kapo",
+  "mankas",
+  "niajn",
+  "parolu",
+  "ĉielo",
+  "okuloj",
+  "momenton",
+  "vidos",
+  "lernejo",
+  "temas",
+  "petis",
+  "sidiĝu",
+  "fakte",
+  "devis",
+  "alvenis",
+  "morti",
+  "nepre",
+  "siajn",
+  "trovi",
+  "jaro",
+  "pravas",
+  "diros",
+  "mortigi",
+  "tiaj",
+  "ŝipo",
+  "resti",
+  "grandan",
+  "kapitano",
+  "havos",
+  "pablo",
+  "homojn",
+  "hejme",
+  "traduko",
+  "chico",
+  "manĝu",
+  "nomiĝas",
+  "sukcesis",
+  "arbaro",
+  "avinjo",
+  "edzo",
+  "pordon",
+  "jarojn",
+  "haŭl",
+  "dua",
+  "same",
+  "kompreni",
+  "krom",
+  "infano",
+  "nederlanda",
+  "rigardas",
+  "kelkaj",
+  "liaj",
+  "permesu",
+  "æi",
+  "familio",
+  "mak",
+  "planedo",
+  "laboron",
+  "vivi",
+  "kvar",
+  "revenis",
+  "problemo",
+  "daŭre",
+  "novan",
+  "trovos",
+  "laboras",
+  "prenis",
+  "aferoj",
+  "silentu",
+  "veni",
+  "serĉas",
+  "loĝas",
+  "facile",
+  "rigardi",
+  "esperas",
+  "tenu",
+  "preni",
+  "vivu",
+  "minutoj",
+  "knaboj",
+  "provu",
+  "donos",
+  "eta",
+  "filino",
+  "kamarado",
+  "revenu",
+  "sukcesos",
+  "donas",
+  "nokto",
+  "billy",
+  "ambaŭ",
+  "neniun",
+  "juna",
+  "volus",
+  "ĉiun",
+  "parolis",
+  "manĝas",
+  "gepatroj",
+  "ŝatus",
+  "funkcias",
+  "trankviliĝu",
+  "momento",
+  "belega",
+  "manojn",
+  "pordo",
+  "multajn",
+  "fine",
+  "pardonon",
+  "foriris",
+  "sama",
+  "iliaj",
+  "muziko",
+  "sofi",
+  "nomon",
+  "stulta",
+  "malfrue",
+  "mej",
+  "ĉirkaŭ",
+  "prefere",
+  "ekstere",
+  "ricevis",
+  "diable",
+  "vesperon",
+  "prenos",
+  "ideo",
+  "eniri",
+  "celas",
+  "lokon",
+  "hieraŭ",
+  "ludi",
+  "matenon",
+  "akvon",
+  "mortigos",
+  "supre",
+  "manoj",
+  "foje",
+  "lo",
+  "princino",
+  "pastro",
+  "alportis",
+  "onklo",
+  "aliajn",
+  "fantoci",
+  "adiaŭ",
+  "daŭrigu",
+  "libro",
+  "macario",
+  "skribis",
+  "libera",
+  "frue",
+  "feliĉa",
+  "estro",
+  "trankvile",
+  "chu",
+  "eliru",
+  "kelkajn",
+  "stultulo",
+  "lumo",
+  "helpon",
+  "hejmo",
+  "labori",
+  "dormas",
+  "montru",
+  "kuru",
+  "mortigis",
+  "idioto",
+  "flugi",
+  "si",
+  "helpos",
+  "ofte",
+  "fojon",
+  "siaj",
+  "scipovas",
+  "suno",
+  "eliri",
+  "a",
+  "iuj",
+  "turf",
+  "metu",
+  "revido",
+  "similas",
+  "doloras",
+  "celo",
+  "peppino",
+  "rapidu",
+  "doni",
+  "reveni",
+  "virinoj",
+  "okulojn",
+  "forgesu",
+  "veron",
+  "vero",
+  "caro",
+  "intencas",
+  "ŝajne",
+  "viroj",
+  "infanojn",
+  "alvenas",
+  "staras",
+  "ĝojas",
+  "ekzemple",
+  "ve",
+  "elnederlandigis",
+  "korpo",
+  "aĉeti",
+  "kapon",
+  "preta",
+  "supren",
+  "vento",
+  "komencis",
+  "propra",
+  "aŭdi",
+  "animo",
+  "vojon",
+  "sekvu",
+  "ĉeestas",
+  "oro",
+  "arbo",
+  "kian",
+  "longa",
+  "sango",
+  "freneziĝis",
+  "alportu",
+  "sorĉistino",
+  "popolo",
+  "homa",
+  "tian",
+  "demandas",
+  "trajno",
+  "ricevos",
+  "terura",
+  "antaŭen",
+  "mondon",
+  "timo",
+  "rolo",
+  "ene",
+  "foriros",
+  "eminenco",
+  "klare",
+  "reĝa",
+  "ah",
+  "ulo",
+  "lasi",
+  "demandis",
+  "preferas",
+  "malfacile",
+  "profesoro",
+  "sal",
+  "dormis",
+  "lasis",
+  "stranga",
+  "ĉie",
+  "ludo",
+  "timu",
+  "aferojn",
+  "fajro",
+  "pensu",
+  "bonvenon",
+  "tria",
+  "sciu",
+  "alvenos",
+  "ranĉo",
+  "forlasis",
+  "ludas",
+  "jesuo",
+  "dreverhaven",
+  "sendis",
+  "ĉambro",
+  "savi",
+  "sinjoroj",
+  "skribi",
+  "dormi",
+  "mastro",
+  "paco",
+  "malaperis",
+  "foriras",
+  "nokte",
+  "haku",
+  "fek",
+  "ŝtelis",
+  "kies",
+  "demandi",
+  "patron",
+  "parto",
+  "legi",
+  "forta",
+  "lasos",
+  "atendi",
+  "maro",
+  "bebo",
+  "falis",
+  "terure",
+  "ia",
+  "atingis",
+  "plaĉas",
+  "karulo",
+  "anstataŭ",
+  "pafis",
+  "matene",
+  "kulpas",
+  "bonaj",
+  "malgranda",
+  "bele",
+  "mil",
+  "polico",
+  "eniris",
+  "festo",
+  "kristo",
+  "fraŭlino",
+  "malamas",
+  "dankas",
+  "kuracisto",
+  "horoj",
+  "diablo",
+  "aŭto",
+  "manon",
+  "speciala",
+  "grandaj",
+  "phil",
+  "unuan",
+  "domon",
+  "vizaĝo",
+  "petegas",
+  "ordonis",
+  "trafis",
+  "kaptu",
+  "sidas",
+  "finiĝis",
+  "koron",
+  "rekte",
+  "brave",
+  "ĉiutage",
+  "avino",
+  "naskiĝis",
+  "rakontis",
+  "montri",
+  "kiki",
+  "karlo",
+  "manĝaĵo",
+  "doktoro",
+  "cervo",
+  "iĝos",
+  "historio",
+  "direktoro",
+  "atingi",
+  "dubi",
+  "miĉjo",
+  "vortoj",
+  "atendis",
+  "finis",
+  "oficejo",
+  "patrick",
+  "uzi",
+  "aŭskultas",
+  "imagu",
+  "flugas",
+  "iĝis",
+  "vespere",
+  "propran",
+  "esperanto",
+  "ideon",
+  "danĝero",
+  "knabinoj",
+  "parolos",
+  "instruisto",
+  "ŝanĝi",
+  "zorgas",
+  "raĝu",
+  "entute",
+  "lingvo",
+  "kiaj",
+  "nomas",
+  "halo",
+  "kredis",
+  "filon",
+  "manĝis",
+  "demando",
+  "strange",
+  "taŭgas",
+  "ĝardeno",
+  "viĉjo",
+  "zubi",
+  "aĵoj",
+  "manĝos",
+  "instruis",
+  "birdo",
+  "mazi",
+  "portas",
+  "renkontis",
+  "viva",
+  "apartenas",
+  "fermu",
+  "bedaŭrinde",
+  "mano",
+  "farus",
+  "katadreuffe",
+  "kredi",
+  "serĉi",
+  "brazilo",
+  "hotelo",
+  "lumon",
+  "maljuna",
+  "ŝian",
+  "delonge",
+  "ie",
+  "kazaroza",
+  "lernis",
+  "korvaks",
+  "marko",
+  "pia",
+  "bonega",
+  "fiulo",
+  "militon",
+  "prave",
+  "kaptis",
+  "strato",
+  "malnova",
+  "troviĝas",
+  "provis",
+  "hm",
+  "trankvila",
+  "promesas",
+  "pafu",
+  "kaĉjo",
+  "ŝatis",
+  "plena",
+  "fojo",
+  "pablito",
+  "uzas",
+  "elektis",
+  "infero",
+  "forte",
+  "reĝino",
+  "ĝia",
+  "pasis",
+  "ruĝa",
+  "metis",
+  "proksime",
+  "pardonpetas",
+  "plene",
+  "po",
+  "princo",
+  "ses",
+  "ĝenas",
+  "tiajn",
+  "aŭton",
+  "apenaŭ",
+  "nekredeble",
+  "pensi",
+  "nigra",
+  "øi",
+  "trovu",
+  "morton",
+  "monatoj",
+  "sonas",
+  "aĥ",
+  "komprenu",
+  "violonisto",
+  "paŭleta",
+  "telefonis",
+  "vojaĝo",
+  "sep",
+  "malmulte",
+  "filmo",
+  "legis",
+  "alie",
+  "malantaŭ",
+  "karl",
+  "respondu",
+  "helpo",
+  "flanko",
+  "tuŝu",
+  "montros",
+  "kvankam",
+  "lerni",
+  "reiru",
+  "komenco",
+  "perfekta",
+  "ankoraŭfoje",
+  "gaj",
+  "pjel",
+  "naturo",
+  "atenton",
+  "komencu",
+  "demandu",
+  "precize",
+  "mortas",
+  "vizaĝon",
+  "gesinjoroj",
+  "homon",
+  "saman",
+  "kostas",
+  "moviĝu",
+  "hundo",
+  "aĉetis",
+  "memoru",
+  "tiru",
+  "aero",
+  "krome",
+  "persono",
+  "libron",
+  "forlasi",
+  "dank",
+  "radio",
+  "edzinon",
+  "kantas",
+  "promesis",
+  "rakontu",
+  "hastu",
+  "avo",
+  "gajnis",
+  "bezonos",
+  "freneza",
+  "ordono",
+  "helpas",
+  "indas",
+  "inklinalriks",
+  "steloj",
+  "punkto",
+  "aferon",
+  "supozas",
+  "savu",
+  "ricevas",
+  "klaso",
+  "mallumo",
+  "absolute",
+  "sole",
+  "donaco",
+  "nura",
+  "soldatoj",
+  "nomis",
+  "atendos",
+  "rekonas",
+  "brendano",
+  "ŝancon",
+  "subite",
+  "nenia",
+  "dudek",
+  "veturu",
+  "mortu",
+  "plian",
+  "korbin",
+  "malfruas",
+  "tano",
+  "sekundoj",
+  "rivero",
+  "kuras",
+  "lago",
+  "massarakŝ",
+  "trovas",
+  "reen",
+  "rimarkis",
+  "malsana",
+  "super",
+  "bestoj",
+  "armeo",
+  "ŝlosilon",
+  "konsentite",
+  "ian",
+  "skribu",
+  "libroj",
+  "ĉarma",
+  "horojn",
+  "farhan",
+  "problemojn",
+  "lastan",
+  "minuton",
+  "dume",
+  "totoro",
+  "portis",
+  "pagos",
+  "serioze",
+  "cxu",
+  "minutojn",
+  "ĝiĝi",
+  "havu",
+  "duono",
+  "fratoj",
+  "finu",
+  "unufoje",
+  "kelkfoje",
+  "laŭte",
+  "savis",
+  "porti",
+  "farita",
+  "mirinde",
+  "viziti",
+  "luno",
+  "vivos",
+  "malamiko",
+  "pura",
+  "veras",
+  "trinku",
+  "mortintoj",
+  "kamaradoj",
+  "spirito",
+  "ĝafaro",
+  "lara",
+  "nome",
+  "sukcesas",
+  "ricevi",
+  "legu",
+  "jaron",
+  "belan",
+  "kantu",
+  "dirus",
+  "malbono",
+  "kuŝas",
+  "belaj",
+  "feliĉaj",
+  "gardu",
+  "mortinta",
+  "provas",
+  "lito",
+  "imagas",
+  "sklavoj",
+  "alta",
+  "konsentas",
+  "muzikon",
+  "vivis",
+  "sentis",
+  "b",
+  "urbon",
+  "revenas",
+  "héctor",
+  "kalcifer",
+  "homaro",
+  "muso",
+  "junulo",
+  "serĉu",
+  "ŝanĝiĝis",
+};
+const uint16_t WA_FREQ_37_RANKS[] = {
+  0, 0, 874, 976, 984, 0, 0, 217, 0, 0, 0, 0, 0, 0, 0, 0,
+  56, 0, 0, 814, 0, 0, 0, 462, 897, 0, 0, 0, 0, 384, 0, 966,
+  850, 94, 905, 0, 751, 0, 179, 337, 437, 519, 0, 0, 0, 0, 107, 675,
+  998, 832, 992, 0, 898, 0, 97, 747, 952, 0, 0, 0, 0, 0, 99, 0,
+  0, 32, 780, 0, 0, 878, 0, 0, 0, 927, 777, 0, 0, 0, 0, 189,
+  0, 447, 0, 151, 0, 0, 40, 0, 0, 0, 0, 668, 0, 0, 0, 0,
+  51, 784, 579, 766, 0, 0, 278, 815, 767, 679, 685, 142, 803, 362, 644, 842,
+  892, 943, 0, 306, 653, 412, 52, 267, 593, 612, 300, 768, 801, 888, 0, 0,
+  471, 0, 0, 906, 0, 0, 0, 731, 978, 333, 0, 0, 199, 0, 872, 0,
+  0, 0, 672, 0, 581, 662, 0, 0, 0, 870, 251, 0, 0, 41, 234, 243,
+  0, 0, 0, 838, 111, 542, 0, 755, 775, 894, 712, 0, 871, 932, 128, 383,
+  611, 0, 161, 229, 249, 697, 66, 795, 819, 822, 816, 643, 961, 0, 484, 689,
+  533, 844, 960, 0, 0, 0, 0, 601, 0, 0, 0, 0, 0, 0, 845, 0,
+  0, 0, 0, 0, 0, 332, 721, 0, 0, 233, 376, 769, 580, 295, 0, 0,
+  206, 0, 589, 0, 0, 0, 658, 0, 0, 35, 918, 76, 470, 321, 398, 924,
+  0, 0, 0, 0, 0, 0, 0, 0, 494, 0, 600, 0, 0, 687, 291, 340,
+  778, 317, 922, 0, 0, 646, 0, 0, 0, 0, 0, 0, 224, 979, 0, 973,
+  208, 899, 0, 741, 671, 0, 0, 0, 0, 254, 634, 355, 0, 655, 0, 0,
+  0, 112, 0, 19, 0, 835, 5, 0, 986, 0, 858, 921, 0, 711, 541, 577,
+  821, 0, 0, 328, 0, 629, 220, 382, 0, 0, 0, 0, 669, 431, 890, 0,
+  393, 54, 710, 990, 175, 0, 45, 0, 0, 0, 0, 236, 263, 703, 0, 834,
+  113, 0, 143, 886, 692, 16, 0, 0, 0, 0, 320, 0, 0, 800, 0, 0,
+  133, 0, 0, 157, 436, 0, 682, 255, 492, 812, 105, 659, 0, 0, 0, 787,
+  0, 279, 529, 274, 613, 420, 0, 0, 0, 0, 706, 965, 0, 520, 284, 0,
+  385, 402, 159, 0, 430, 297, 0, 358, 0, 231, 0, 0, 0, 168, 311, 0,
+  65, 592, 903, 0, 521, 0, 0, 0, 0, 223, 730, 694, 0, 0, 0, 0,
+  0, 0, 443, 53, 101, 0, 957, 688, 0, 0, 0, 230, 338, 0, 896, 0,
+  0, 798, 950, 466, 130, 545, 728, 226, 0, 467, 553, 57, 0, 0, 0, 0,
+  604, 920, 0, 0, 0, 0, 0, 203, 0, 0, 336, 0, 564, 594, 81, 605,
+  758, 981, 0, 0, 0, 0, 0, 74, 0, 399, 0, 624, 252, 0, 0, 0,
+  0, 951, 158, 0, 396, 0, 656, 124, 0, 684, 0, 0, 0, 0, 700, 0,
+  714, 301, 329, 0, 201, 259, 647, 0, 0, 824, 660, 171, 934, 0, 0, 0,
+  0, 0, 0, 977, 0, 0, 724, 0, 0, 421, 0, 0, 0, 0, 0, 0,
+  0, 0, 282, 0, 0, 429, 908, 0, 0, 720, 665, 55, 0, 452, 540, 718,
+  852, 857, 999, 361, 0, 0, 750, 0, 368, 622, 0, 417, 0, 0, 0, 73,
+  504, 0, 640, 648, 851, 916, 722, 991, 0, 0, 0, 889, 323, 0, 754, 0,
+  948, 0, 743, 0, 183, 194, 46, 552, 0, 988, 0, 0, 409, 0, 218, 499,
+  0, 0, 901, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 191, 0, 0,
+  0, 0, 524, 395, 763, 944, 0, 0, 154, 178, 806, 0, 0, 517, 0, 0,
+  0, 0, 0, 0, 0, 34, 207, 525, 0, 342, 0, 303, 0, 931, 0, 0,
+  0, 0, 843, 0, 434, 456, 0, 0, 119, 0, 0, 357, 526, 808, 0, 0,
+  0, 0, 125, 0, 0, 0, 0, 0, 0, 0, 0, 701, 518, 0, 0, 0,
+  0, 0, 964, 0, 0, 0, 346, 145, 0, 242, 945, 246, 879, 0, 663, 0,
+  450, 373, 428, 575, 292, 0, 0, 0, 0, 0, 0, 0, 0, 141, 0, 510,
+  501, 536, 954, 962, 235, 389, 244, 415, 949, 543, 326, 0, 36, 0, 0, 0,
+  0, 29, 6, 0, 293, 62, 549, 582, 649, 817, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 752, 0, 0, 860, 883, 313, 0, 0, 807, 0,
+  0, 0, 63, 0, 374, 0, 0, 0, 0, 388, 503, 0, 0, 0, 95, 0,
+  827, 0, 343, 607, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 558, 149,
+  150, 280, 823, 0, 0, 737, 0, 0, 27, 0, 0, 266, 585, 17, 364, 676,
+  719, 760, 0, 0, 0, 261, 0, 15, 650, 79, 865, 0, 0, 356, 929, 0,
+  0, 506, 0, 0, 86, 637, 756, 0, 0, 0, 0, 0, 0, 761, 532, 508,
+  0, 0, 0, 0, 0, 0, 0, 245, 177, 936, 0, 0, 3, 446, 418, 695,
+  0, 122, 0, 0, 0, 683, 0, 571, 578, 0, 465, 620, 0, 726, 307, 0,
+  299, 0, 59, 0, 0, 785, 67, 0, 0, 196, 0, 0, 0, 953, 0, 955,
+  290, 474, 0, 0, 0, 0, 287, 0, 0, 0, 0, 680, 0, 348, 0, 0,
+  603, 182, 0, 90, 0, 0, 426, 464, 478, 0, 377, 129, 147, 367, 0, 315,
+  132, 771, 0, 0, 0, 33, 956, 666, 0, 0, 0, 0, 868, 92, 557, 0,
+  0, 162, 0, 0, 723, 0, 0, 0, 0, 0, 0, 0, 70, 215, 0, 0,
+  985, 64, 0, 0, 0, 0, 739, 911, 477, 928, 859, 225, 228, 502, 0, 0,
+  0, 0, 304, 454, 0, 941, 0, 0, 0, 0, 0, 0, 0, 435, 479, 0,
+  0, 591, 813, 0, 0, 0, 791, 0, 192, 459, 0, 902, 0, 0, 0, 0,
+  491, 0, 0, 959, 0, 0, 0, 528, 0, 0, 702, 0, 0, 0, 0, 219,
+  0, 0, 115, 0, 0, 0, 0, 0, 185, 818, 496, 880, 0, 0, 0, 0,
+  0, 240, 0, 776, 0, 500, 794, 0, 0, 0, 14, 677, 0, 940, 863, 0,
+  573, 0, 84, 0, 253, 0, 135, 0, 0, 0, 472, 0, 0, 349, 0, 0,
+  869, 0, 0, 0, 444, 947, 0, 0, 25, 184, 691, 626, 678, 200, 308, 831,
+  0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 441, 12, 497, 61, 137, 0,
+  0, 727, 126, 725, 0, 260, 404, 664, 893, 213, 0, 165, 830, 0, 0, 0,
+  0, 0, 0, 0, 440, 0, 0, 0, 0, 0, 0, 153, 0, 0, 0, 0,
+  24, 745, 0, 0, 117, 148, 537, 0, 0, 327, 0, 0, 0, 262, 410, 856,
+  0, 967, 0, 0, 0, 0, 555, 0, 0, 0, 0, 0, 0, 180, 681, 493,
+  610, 0, 783, 642, 837, 0, 0, 0, 933, 733, 849, 0, 0, 0, 0, 0,
+  654, 0, 0, 0, 0, 0, 0, 205, 606, 37, 250, 8, 89, 451, 507, 546,
+  48, 574, 608, 631, 820, 996, 0, 0, 0, 0, 0, 753, 0, 0, 0, 324,
+  618, 0, 0, 351, 614, 736, 0, 0, 0, 550, 825, 0, 392, 1000, 587, 0,
+  0, 0, 0, 0, 0, 0, 909, 103, 0, 0, 286, 0, 0, 0, 0, 615,
+  152, 22, 995, 174, 0, 0, 463, 0, 0, 0, 350, 0, 0, 633, 0, 0,
+  0, 925, 0, 352, 0, 0, 0, 334, 847, 891, 272, 913, 935, 0, 563, 853,
+  523, 0, 411, 0, 80, 498, 458, 221, 690, 0, 0, 0, 216, 0, 0, 264,
+  359, 486, 535, 0, 0, 0, 705, 0, 0, 0, 0, 0, 811, 0, 0, 0,
+  0, 900, 0, 0, 0, 829, 939, 635, 0, 21, 0, 0, 0, 0, 0, 176,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 609, 0, 20, 0, 0,
+  0, 735, 419, 0, 394, 0, 0, 372, 425, 551, 709, 114, 341, 160, 387, 335,
+  621, 982, 0, 693, 0, 371, 0, 841, 0, 0, 715, 0, 0, 0, 0, 0,
+  439, 547, 186, 836, 442, 98, 433, 88, 354, 509, 514, 310, 139, 366, 330, 277,
+  121, 166, 487, 657, 265, 344, 972, 0, 0, 602, 699, 0, 987, 309, 759, 0,
+  625, 0, 0, 0, 0, 0, 0, 792, 0, 0, 0, 0, 0, 764, 347, 408,
+  488, 0, 786, 0, 0, 9, 50, 227, 583, 405, 673, 742, 511, 0, 0, 0,
+  0, 0, 619, 281, 0, 0, 0, 595, 0, 628, 0, 0, 0, 930, 222, 257,
+  0, 749, 0, 204, 0, 0, 0, 0, 0, 0, 288, 0, 0, 275, 0, 993,
+  0, 877, 0, 0, 71, 968, 146, 2, 75, 365, 971, 958, 0, 0, 401, 636,
+  772, 0, 0, 91, 548, 0, 0, 740, 0, 810, 0, 862, 567, 0, 0, 31,
+  639, 69, 460, 475, 854, 144, 0, 316, 0, 104, 670, 590, 994, 0, 0, 0,
+  0, 0, 0, 485, 895, 0, 0, 779, 0, 0, 0, 0, 0, 0, 489, 0,
+  561, 0, 298, 539, 910, 190, 516, 83, 331, 0, 0, 140, 270, 202, 413, 512,
+  0, 942, 919, 468, 271, 568, 904, 0, 782, 7, 556, 0, 0, 379, 386, 926,
+  238, 846, 0, 134, 106, 717, 969, 974, 0, 538, 0, 0, 197, 0, 0, 0,
+  0, 167, 565, 0, 0, 198, 0, 576, 570, 28, 881, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 403, 505, 302, 0, 164, 734, 318, 0, 120, 256, 345, 544,
+  630, 738, 0, 68, 0, 0, 840, 0, 47, 276, 0, 744, 289, 0, 0, 0,
+  0, 0, 0, 970, 172, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 414,
+  85, 93, 0, 0, 0, 214, 0, 887, 353, 757, 861, 0, 77, 453, 0, 0,
+  0, 0, 483, 0, 391, 527, 0, 169, 0, 0, 0, 0, 397, 0, 0, 0,
+  0, 0, 0, 641, 0, 0, 0, 0, 26, 674, 163, 0, 422, 667, 0, 248,
+  0, 0, 44, 584, 0, 0, 0, 732, 0, 136, 848, 0, 515, 0, 82, 18,
+  0, 0, 0, 241, 490, 522, 560, 729, 632, 531, 770, 781, 209, 651, 638, 907,
+  937, 0, 0, 427, 424, 0, 181, 0, 748, 0, 0, 0, 696, 38, 100, 796,
+  0, 0, 0, 72, 96, 170, 0, 586, 597, 0, 773, 0, 481, 804, 0, 445,
+  746, 0, 0, 0, 0, 707, 268, 716, 884, 43, 864, 173, 0, 30, 0, 0,
+  432, 774, 0, 0, 0, 0, 0, 0, 0, 375, 0, 598, 0, 0, 0, 87,
+  0, 11, 305, 713, 0, 0, 455, 855, 0, 0, 0, 0, 0, 0, 187, 339,
+  370, 378, 866, 0, 0, 0, 789, 826, 110, 596, 156, 997, 0, 0, 416, 873,
+  210, 805, 0, 0, 0, 0, 0, 0, 0, 10, 0, 49, 569, 0, 828, 0,
+  0, 0, 513, 938, 0, 381, 0, 0, 0, 0, 0, 917, 0, 616, 239, 762,
+  0, 294, 0, 0, 0, 983, 0, 914, 0, 0, 0, 0, 0, 0, 0, 296,
+  0, 923, 476, 461, 554, 23, 360, 698, 58, 312, 363, 438, 285, 915, 989, 0,
+  0, 0, 0, 78, 109, 188, 0, 0, 0, 193, 559, 588, 788, 790, 0, 0,
+  793, 0, 138, 0, 0, 0, 0, 0, 617, 0, 380, 0, 0, 0, 867, 406,
+  0, 0, 123, 473, 0, 102, 0, 809, 839, 0, 1, 283, 60, 212, 449, 652,
+  0, 0, 0, 195, 0, 0, 797, 946, 0, 0, 0, 0, 0, 0, 0, 319,
+  0, 369, 448, 980, 0, 118, 0, 0, 0, 0, 0, 258, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 325, 623, 704, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 912, 534, 13, 599, 0, 0, 0, 833, 0, 0, 0, 0, 0, 963, 400,
+  572, 469, 566, 0, 155, 232, 457, 0, 0, 211, 0, 0, 0, 322, 765, 0,
+  0, 42, 423, 0, 0, 0, 0, 0, 0, 0, 0, 131, 247, 686, 875, 0,
+  975, 0, 0, 108, 116, 0, 0, 645, 708, 799, 480, 530, 273, 627, 127, 269,
+  495, 314, 237, 390, 562, 482, 661, 876, 407, 802, 882, 885, 0, 0, 0, 0,
+};
+
+const char *WA_FREQ_38_TOKENS[] = {
+  "de",
+  "que",
+  "no",
+  "a",
+  "la",
+  "el",
+  "y",
+  "es",
+  "en",
+  "lo",
+  "un",
+  "por",
+  "qué",
+  "me",
+  "una",
+  "los",
+  "se",
+  "te",
+  "con",
+  "para",
+  "está",
+  "mi",
+  "pero",
+  "sí",
+  "si",
+  "bien",
+  "eso",
+  "su",
+  "las",
+  "yo",
+  "del",
+  "como",
+  "aquí",
+  "tu",
+  "al",
+  "más",
+  "le",
+  "esto",
+  "todo",
+  "ya",
+  "estoy",
+  "ahora",
+  "muy",
+  "ha",
+  "esta",
+  "así",
+  "vamos",
+  "algo",
+  "hay",
+  "bueno",
+  "tengo",
+  "él",
+  "cuando",
+  "estás",
+  "sé",
+  "tú",
+  "nos",
+  "nada",
+  "cómo",
+  "este",
+  "o",
+  "he",
+  "ser",
+  "tiene",
+  "puedo",
+  "ella",
+  "quiero",
+  "hacer",
+  "fue",
+  "gracias",
+  "vez",
+  "era",
+  "soy",
+  "sólo",
+  "todos",
+  "porque",
+  "son",
+  "tienes",
+  "creo",
+  "voy",
+  "sabes",
+  "estaba",
+  "puede",
+  "eres",
+  "ese",
+  "usted",
+  "entonces",
+  "hola",
+  "solo",
+  "verdad",
+  "casa",
+  "tan",
+  "quién",
+  "sus",
+  "tiempo",
+  "dos",
+  "esa",
+  "nunca",
+  "dónde",
+  "va",
+  "oh",
+  "favor",
+  "mucho",
+  "mí",
+  "quieres",
+  "siento",
+  "señor",
+  "mejor",
+  "hace",
+  "has",
+  "decir",
+  "también",
+  "sobre",
+  "dios",
+  "sin",
+  "tenemos",
+  "están",
+  "ti",
+  "puedes",
+  "ver",
+  "hombre",
+  "vida",
+  "alguien",
+  "cosas",
+  "siempre",
+  "hasta",
+  "ahí",
+  "ir",
+  "años",
+  "antes",
+  "estar",
+  "ni",
+  "poco",
+  "día",
+  "uno",
+  "noche",
+  "hecho",
+  "mis",
+  "estamos",
+  "otra",
+  "acuerdo",
+  "trabajo",
+  "nosotros",
+  "parece",
+  "gente",
+  "sea",
+  "padre",
+  "mira",
+  "mismo",
+  "dijo",
+  "nadie",
+  "quiere",
+  "podría",
+  "hablar",
+  "vas",
+  "ellos",
+  "sr.",
+  "tal",
+  "pasa",
+  "fuera",
+  "después",
+  "han",
+  "desde",
+  "dinero",
+  "mundo",
+  "claro",
+  "momento",
+  "les",
+  "tener",
+  "estado",
+  "otro",
+  "había",
+  "mañana",
+  "tenía",
+  "madre",
+  "vale",
+  "lugar",
+  "haciendo",
+  "donde",
+  "seguro",
+  "sabe",
+  "podemos",
+  "tus",
+  "espera",
+  "nuevo",
+  "sido",
+  "cosa",
+  "hijo",
+  "allí",
+  "menos",
+  "tipo",
+  "amigo",
+  "gran",
+  "nuestro",
+  "mujer",
+  "mamá",
+  "luego",
+  "papá",
+  "días",
+  "dice",
+  "hoy",
+  "tres",
+  "buena",
+  "necesito",
+  "dije",
+  "oye",
+  "gusta",
+  "quería",
+  "será",
+  "haber",
+  "parte",
+  "todas",
+  "crees",
+  "buen",
+  "conmigo",
+  "nombre",
+  "mierda",
+  "nuestra",
+  "mal",
+  "debe",
+  "realmente",
+  "estas",
+  "aún",
+  "mío",
+  "toda",
+  "hacerlo",
+  "cada",
+  "visto",
+  "importa",
+  "contigo",
+  "tienen",
+  "hemos",
+  "razón",
+  "alguna",
+  "tanto",
+  "saber",
+  "hizo",
+  "veces",
+  "serio",
+  "ven",
+  "idea",
+  "eh",
+  "tarde",
+  "problema",
+  "hora",
+  "cierto",
+  "dicho",
+  "quien",
+  "demasiado",
+  "amor",
+  "entre",
+  "ve",
+  "pasado",
+  "familia",
+  "estos",
+  "policía",
+  "debería",
+  "ustedes",
+  "chica",
+  "esos",
+  "chicos",
+  "cuenta",
+  "haces",
+  "todavía",
+  "salir",
+  "algún",
+  "vaya",
+  "unos",
+  "veo",
+  "amigos",
+  "hermano",
+  "pensé",
+  "sabía",
+  "cabeza",
+  "ah",
+  "cariño",
+  "digo",
+  "van",
+  "hombres",
+  "buenas",
+  "somos",
+  "cualquier",
+  "forma",
+  "mientras",
+  "lado",
+  "debo",
+  "sería",
+  "caso",
+  "pueden",
+  "pasó",
+  "primera",
+  "genial",
+  "chico",
+  "supuesto",
+  "hice",
+  "pues",
+  "adiós",
+  "muchas",
+  "personas",
+  "señora",
+  "volver",
+  "esas",
+  "quizá",
+  "contra",
+  "camino",
+  "durante",
+  "hablando",
+  "manera",
+  "muerto",
+  "persona",
+  "rápido",
+  "cuál",
+  "ayuda",
+  "historia",
+  "iba",
+  "supongo",
+  "nueva",
+  "entiendo",
+  "dentro",
+  "casi",
+  "puerta",
+  "ves",
+  "pasar",
+  "primero",
+  "significa",
+  "semana",
+  "hacia",
+  "quizás",
+  "espero",
+  "juntos",
+  "año",
+  "niños",
+  "pronto",
+  "tío",
+  "suerte",
+  "ciudad",
+  "siquiera",
+  "feliz",
+  "venir",
+  "hija",
+  "gustaría",
+  "minutos",
+  "cuánto",
+  "os",
+  "hey",
+  "muerte",
+  "dejar",
+  "realidad",
+  "deja",
+  "problemas",
+  "vi",
+  "da",
+  "importante",
+  "dijiste",
+  "corazón",
+  "miedo",
+  "jefe",
+  "agua",
+  "haré",
+  "justo",
+  "horas",
+  "poder",
+  "buenos",
+  "esposa",
+  "manos",
+  "debes",
+  "viene",
+  "venga",
+  "nuestros",
+  "ojos",
+  "adelante",
+  "encontrar",
+  "mano",
+  "cinco",
+  "niño",
+  "ninguna",
+  "otros",
+  "cara",
+  "cuidado",
+  "bajo",
+  "cerca",
+  "viejo",
+  "déjame",
+  "noches",
+  "bastante",
+  "fin",
+  "tomar",
+  "único",
+  "misma",
+  "escucha",
+  "ningún",
+  "suficiente",
+  "punto",
+  "cuándo",
+  "sigue",
+  "haya",
+  "equipo",
+  "grande",
+  "necesita",
+  "llegar",
+  "incluso",
+  "algunos",
+  "doctor",
+  "difícil",
+  "aunque",
+  "hubiera",
+  "primer",
+  "coche",
+  "hago",
+  "clase",
+  "cuatro",
+  "mas",
+  "dices",
+  "pequeño",
+  "llama",
+  "toma",
+  "hiciste",
+  "allá",
+  "última",
+  "arriba",
+  "tierra",
+  "guerra",
+  "pensar",
+  "pueda",
+  "igual",
+  "loco",
+  "sangre",
+  "mujeres",
+  "vuelta",
+  "fui",
+  "trabajar",
+  "tenido",
+  "juego",
+  "deberías",
+  "cuerpo",
+  "e",
+  "algunas",
+  "entrar",
+  "cree",
+  "podía",
+  "debemos",
+  "oportunidad",
+  "teléfono",
+  "necesitamos",
+  "final",
+  "listo",
+  "fiesta",
+  "muchos",
+  "estabas",
+  "quieren",
+  "vete",
+  "auto",
+  "dar",
+  "vivir",
+  "posible",
+  "ok",
+  "hermana",
+  "número",
+  "meses",
+  "exactamente",
+  "culpa",
+  "abajo",
+  "escuela",
+  "ido",
+  "fuerte",
+  "diciendo",
+  "habla",
+  "esté",
+  "ello",
+  "pregunta",
+  "chicas",
+  "eran",
+  "unas",
+  "pasando",
+  "atrás",
+  "malo",
+  "capitán",
+  "sra.",
+  "bebé",
+  "segundo",
+  "sabemos",
+  "mayor",
+  "comida",
+  "morir",
+  "conozco",
+  "dame",
+  "fácil",
+  "comer",
+  "vino",
+  "lista",
+  "haga",
+  "necesitas",
+  "hijos",
+  "probablemente",
+  "padres",
+  "habitación",
+  "creer",
+  "pensando",
+  "fueron",
+  "dime",
+  "trata",
+  "buscando",
+  "tuve",
+  "tampoco",
+  "amo",
+  "joven",
+  "podrías",
+  "sola",
+  "par",
+  "única",
+  "hacen",
+  "seguir",
+  "dr.",
+  "simplemente",
+  "dicen",
+  "medio",
+  "puta",
+  "saben",
+  "sentido",
+  "hagas",
+  "segura",
+  "esperar",
+  "lejos",
+  "arma",
+  "alto",
+  "pequeña",
+  "dólares",
+  "seis",
+  "estaban",
+  "seguridad",
+  "maldita",
+  "estuvo",
+  "preocupes",
+  "palabra",
+  "esperando",
+  "queda",
+  "oficina",
+  "matar",
+  "iré",
+  "cama",
+  "además",
+  "último",
+  "oído",
+  "habría",
+  "estará",
+  "dio",
+  "recuerdo",
+  "siendo",
+  "acerca",
+  "tenga",
+  "luz",
+  "correcto",
+  "ud.",
+  "demonios",
+  "nuestras",
+  "verte",
+  "dormir",
+  "sitio",
+  "ayudar",
+  "conseguir",
+  "di",
+  "marido",
+  "paz",
+  "idiota",
+  "plan",
+  "dado",
+  "cuanto",
+  "peor",
+  "murió",
+  "pueblo",
+  "vivo",
+  "venido",
+  "john",
+  "basta",
+  "paso",
+  "deberíamos",
+  "música",
+  "diga",
+  "minuto",
+  "anoche",
+  "llamar",
+  "piensa",
+  "país",
+  "digas",
+  "rey",
+  "perdón",
+  "mucha",
+  "falta",
+  "pienso",
+  "diablos",
+  "perdido",
+  "niña",
+  "señorita",
+  "diez",
+  "lleva",
+  "hospital",
+  "grandes",
+  "maldito",
+  "otras",
+  "llamado",
+  "hacemos",
+  "llevar",
+  "fuego",
+  "aqui",
+  "tuvo",
+  "poner",
+  "calle",
+  "acaba",
+  "prueba",
+  "increíble",
+  "real",
+  "libro",
+  "orden",
+  "semanas",
+  "especial",
+  "mía",
+  "café",
+  "duro",
+  "empezar",
+  "afuera",
+  "queremos",
+  "perro",
+  "cielo",
+  "jack",
+  "puesto",
+  "viaje",
+  "detrás",
+  "cuarto",
+  "querida",
+  "haría",
+  "preguntas",
+  "piensas",
+  "querido",
+  "libre",
+  "buscar",
+  "cual",
+  "diré",
+  "suena",
+  "jugar",
+  "cambio",
+  "película",
+  "millones",
+  "habrá",
+  "llamada",
+  "resto",
+  "vemos",
+  "extraño",
+  "mala",
+  "presidente",
+  "srta.",
+  "irme",
+  "ropa",
+  "perder",
+  "vuelve",
+  "agente",
+  "palabras",
+  "información",
+  "raro",
+  "hará",
+  "entiendes",
+  "éste",
+  "trabajando",
+  "tratando",
+  "general",
+  "trato",
+  "usar",
+  "perfecto",
+  "derecho",
+  "modo",
+  "ayer",
+  "conoces",
+  "demás",
+  "quieras",
+  "podríamos",
+  "noticias",
+  "asesino",
+  "encontrado",
+  "control",
+  "odio",
+  "frente",
+  "sexo",
+  "decirle",
+  "estaré",
+  "divertido",
+  "armas",
+  "recuerdas",
+  "amiga",
+  "grupo",
+  "asunto",
+  "acabo",
+  "mensaje",
+  "encima",
+  "atención",
+  "diferente",
+  "uh",
+  "cállate",
+  "daño",
+  "sucede",
+  "cambiar",
+  "siguiente",
+  "sino",
+  "the",
+  "seas",
+  "médico",
+  "boca",
+  "dejó",
+  "error",
+  "jamás",
+  "largo",
+  "pena",
+  "voz",
+  "futuro",
+  "siente",
+  "secreto",
+  "baño",
+  "mil",
+  "decirte",
+  "sam",
+  "pensaba",
+  "novia",
+  "propia",
+  "sueño",
+  "haz",
+  "fuerza",
+  "deben",
+  "supone",
+  "estábamos",
+  "ambos",
+  "ay",
+  "estuve",
+  "encontré",
+  "vuelto",
+  "dolor",
+  "dile",
+  "encanta",
+  "edad",
+  "darle",
+  "pie",
+  "negro",
+  "ganar",
+  "york",
+  "aire",
+  "lamento",
+  "verlo",
+  "asesinato",
+  "vio",
+  "adónde",
+  "llegado",
+  "disculpe",
+  "s",
+  "cita",
+  "estaría",
+  "fuiste",
+  "sistema",
+  "gusto",
+  "pobre",
+  "negocio",
+  "mente",
+  "tuyo",
+  "campo",
+  "mire",
+  "situación",
+  "tras",
+  "hotel",
+  "vosotros",
+  "funciona",
+  "foto",
+  "abogado",
+  "loca",
+  "propio",
+  "alrededor",
+  "próxima",
+  "terminado",
+  "hablas",
+  "pagar",
+  "mató",
+  "llamo",
+  "personal",
+  "sientes",
+  "ocurre",
+  "ésta",
+  "recuerda",
+  "mitad",
+  "quiera",
+  "pelo",
+  "tenías",
+  "viste",
+  "oficial",
+  "llegó",
+  "compañía",
+  "relación",
+  "conoce",
+  "pase",
+  "montón",
+  "mejores",
+  "creí",
+  "cena",
+  "sentir",
+  "través",
+  "accidente",
+  "i",
+  "ellas",
+  "caja",
+  "tranquilo",
+  "bonito",
+  "eras",
+  "asi",
+  "pudo",
+  "vive",
+  "vista",
+  "estúpido",
+  "línea",
+  "caballeros",
+  "haremos",
+  "dan",
+  "quédate",
+  "tienda",
+  "comprar",
+  "entendido",
+  "centro",
+  "salvo",
+  "mes",
+  "joe",
+  "sol",
+  "tonto",
+  "hambre",
+  "michael",
+  "mesa",
+  "respuesta",
+  "completamente",
+  "david",
+  "carta",
+  "totalmente",
+  "imposible",
+  "pruebas",
+  "novio",
+  "normal",
+  "gustan",
+  "frank",
+  "pude",
+  "charlie",
+  "traje",
+  "dirección",
+  "siete",
+  "dijeron",
+  "placer",
+  "sean",
+  "tendrá",
+  "barco",
+  "blanco",
+  "tom",
+  "profesor",
+  "servicio",
+  "muchacho",
+  "reunión",
+  "dejado",
+  "ley",
+  "quisiera",
+  "hubo",
+  "george",
+  "programa",
+  "carrera",
+  "cumpleaños",
+  "muchachos",
+  "culo",
+  "canción",
+  "hermosa",
+  "universidad",
+  "boda",
+  "decirme",
+  "cualquiera",
+  "tengas",
+  "hacía",
+  "estés",
+  "sala",
+  "llevo",
+  "decisión",
+  "espere",
+  "don",
+  "necesario",
+  "sal",
+  "entra",
+  "prisa",
+  "carajo",
+  "embargo",
+  "interesante",
+  "tendrás",
+  "escuchar",
+  "abuela",
+  "hicieron",
+  "detective",
+  "horrible",
+  "suelo",
+  "fotos",
+  "cárcel",
+  "acá",
+  "io",
+  "mike",
+  "siéntate",
+  "decía",
+  "intentando",
+  "vámonos",
+  "maldición",
+  "silencio",
+  "muerta",
+  "capaz",
+  "salió",
+  "club",
+  "terminar",
+  "temo",
+  "broma",
+  "gobierno",
+  "prometo",
+  "cámara",
+  "media",
+  "terrible",
+  "llamó",
+  "regalo",
+  "amable",
+  "dulce",
+  "muertos",
+  "querías",
+  "ataque",
+  "das",
+  "navidad",
+  "negocios",
+  "pudiera",
+  "ocho",
+  "avión",
+  "investigación",
+  "acabó",
+  "juro",
+  "mantener",
+  "ejército",
+  "papel",
+  "partes",
+  "ten",
+  "gracioso",
+  "diría",
+  "principio",
+  "delante",
+  "teniente",
+  "deseo",
+  "vayas",
+  "nave",
+  "sale",
+  "basura",
+  "vine",
+  "contacto",
+  "esposo",
+  "tren",
+  "encontramos",
+  "dale",
+  "verdadero",
+  "tuya",
+  "alma",
+  "hazlo",
+  "disculpa",
+  "junto",
+  "anda",
+  "tendré",
+  "matrimonio",
+  "saberlo",
+  "locura",
+  "oro",
+  "permiso",
+  "director",
+  "peligro",
+  "libertad",
+  "alegro",
+  "baja",
+  "tendremos",
+  "derecha",
+  "encuentra",
+  "pies",
+  "segunda",
+  "maravilloso",
+  "espacio",
+  "rato",
+  "abuelo",
+  "esperaba",
+  "mirando",
+  "salud",
+  "sorpresa",
+  "ninguno",
+  "miren",
+  "triste",
+  "aun",
+  "pensado",
+  "maestro",
+  "según",
+  "infierno",
+  "podrían",
+  "tipos",
+  "tía",
+  "crimen",
+  "conocido",
+  "consejo",
+  "ante",
+  "iglesia",
+};
+const uint16_t WA_FREQ_38_RANKS[] = {
+  0, 864, 96, 0, 0, 0, 0, 0, 36, 223, 259, 0, 0, 0, 0, 0,
+  940, 777, 462, 430, 320, 562, 639, 906, 0, 0, 0, 145, 0, 0, 0, 0,
+  0, 546, 368, 0, 0, 0, 0, 266, 0, 102, 186, 459, 477, 615, 0, 545,
+  146, 986, 0, 0, 173, 324, 0, 810, 0, 0, 759, 0, 0, 955, 0, 0,
+  0, 314, 531, 655, 0, 344, 82, 580, 159, 381, 0, 0, 931, 0, 317, 410,
+  0, 843, 289, 0, 0, 251, 0, 0, 654, 374, 692, 917, 752, 0, 0, 0,
+  6, 0, 648, 669, 591, 79, 0, 0, 366, 388, 461, 155, 0, 0, 0, 192,
+  976, 220, 0, 0, 0, 0, 649, 0, 665, 421, 0, 211, 472, 0, 797, 938,
+  52, 167, 0, 542, 308, 0, 19, 739, 0, 861, 338, 0, 0, 0, 0, 778,
+  0, 989, 941, 0, 0, 0, 0, 560, 0, 0, 217, 0, 583, 0, 0, 316,
+  246, 942, 0, 0, 152, 0, 0, 0, 178, 0, 603, 0, 0, 0, 0, 330,
+  711, 949, 419, 469, 844, 845, 139, 972, 242, 0, 154, 0, 987, 640, 0, 0,
+  0, 414, 183, 0, 0, 0, 0, 0, 188, 926, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 228, 573, 0, 613, 0, 0, 0, 600, 0, 0,
+  0, 0, 88, 158, 576, 501, 688, 364, 625, 954, 0, 0, 703, 0, 0, 0,
+  0, 99, 0, 27, 475, 0, 645, 0, 0, 0, 181, 544, 424, 908, 0, 241,
+  0, 18, 0, 42, 231, 0, 0, 291, 71, 860, 180, 0, 0, 0, 596, 0,
+  0, 0, 0, 0, 668, 0, 201, 809, 920, 336, 910, 0, 165, 0, 0, 885,
+  837, 601, 210, 524, 92, 0, 222, 214, 226, 361, 835, 0, 0, 0, 0, 551,
+  172, 0, 0, 28, 418, 0, 594, 0, 0, 706, 0, 0, 0, 0, 0, 0,
+  0, 170, 156, 685, 587, 732, 400, 859, 0, 0, 0, 371, 426, 103, 694, 863,
+  0, 0, 0, 447, 758, 792, 607, 502, 0, 992, 961, 444, 963, 0, 34, 0,
+  571, 0, 124, 127, 0, 877, 401, 326, 990, 0, 0, 408, 660, 740, 951, 0,
+  899, 143, 811, 0, 723, 485, 189, 0, 258, 479, 498, 0, 0, 0, 0, 416,
+  610, 734, 663, 833, 785, 505, 72, 278, 927, 701, 0, 0, 0, 782, 0, 229,
+  271, 86, 123, 333, 20, 781, 260, 1000, 0, 0, 526, 0, 272, 0, 0, 853,
+  0, 0, 825, 14, 375, 0, 0, 427, 0, 945, 513, 0, 0, 0, 0, 303,
+  0, 0, 0, 4, 0, 80, 0, 0, 0, 0, 582, 0, 0, 0, 0, 543,
+  0, 0, 0, 0, 0, 0, 0, 115, 0, 0, 0, 0, 458, 0, 0, 0,
+  852, 847, 0, 547, 892, 0, 585, 200, 0, 0, 0, 0, 487, 0, 726, 0,
+  0, 0, 0, 0, 798, 0, 488, 0, 512, 0, 0, 285, 47, 708, 980, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 702, 144, 148, 215, 394, 999, 496, 0,
+  0, 0, 0, 741, 481, 113, 0, 0, 0, 0, 629, 790, 834, 0, 412, 948,
+  397, 0, 581, 26, 858, 869, 806, 0, 0, 0, 0, 0, 0, 273, 896, 0,
+  0, 619, 206, 442, 0, 0, 0, 0, 296, 0, 0, 636, 385, 0, 507, 399,
+  489, 0, 0, 0, 0, 54, 0, 190, 0, 0, 0, 319, 406, 0, 45, 0,
+  350, 362, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 631, 0, 971, 0,
+  0, 0, 0, 213, 879, 0, 534, 995, 0, 0, 0, 411, 680, 523, 978, 0,
+  445, 0, 373, 641, 874, 0, 0, 681, 866, 343, 568, 742, 46, 420, 456, 912,
+  134, 932, 0, 0, 0, 0, 359, 0, 0, 0, 724, 504, 689, 802, 959, 962,
+  126, 131, 0, 0, 328, 233, 0, 0, 0, 0, 891, 0, 768, 982, 0, 0,
+  379, 453, 552, 0, 0, 704, 0, 448, 569, 0, 0, 0, 81, 137, 331, 58,
+  690, 0, 257, 0, 0, 250, 0, 0, 0, 0, 0, 0, 118, 75, 0, 0,
+  0, 0, 0, 0, 205, 0, 0, 298, 0, 204, 0, 335, 455, 341, 637, 893,
+  0, 372, 0, 0, 440, 658, 483, 135, 0, 48, 433, 698, 0, 821, 100, 39,
+  0, 0, 0, 0, 234, 0, 0, 494, 0, 0, 0, 0, 633, 0, 0, 0,
+  312, 0, 0, 0, 554, 0, 471, 644, 794, 176, 937, 342, 198, 219, 109, 598,
+  725, 0, 0, 196, 0, 0, 0, 657, 857, 0, 203, 664, 0, 0, 0, 0,
+  0, 0, 774, 0, 871, 0, 865, 0, 267, 356, 105, 609, 309, 751, 754, 392,
+  509, 0, 0, 771, 0, 0, 0, 0, 0, 0, 168, 0, 820, 556, 503, 981,
+  112, 61, 561, 0, 0, 0, 0, 0, 904, 0, 705, 943, 946, 0, 98, 0,
+  0, 10, 0, 0, 856, 0, 722, 650, 151, 254, 108, 529, 727, 788, 365, 880,
+  486, 997, 0, 0, 0, 807, 0, 0, 697, 193, 332, 0, 29, 351, 875, 838,
+  0, 0, 826, 236, 0, 0, 0, 252, 0, 557, 0, 16, 548, 0, 0, 261,
+  876, 0, 101, 729, 0, 0, 244, 74, 452, 996, 0, 0, 0, 0, 801, 0,
+  0, 0, 199, 94, 684, 0, 0, 0, 0, 970, 0, 787, 0, 0, 393, 590,
+  0, 0, 0, 256, 0, 599, 0, 0, 0, 0, 357, 370, 465, 301, 0, 597,
+  0, 0, 0, 0, 0, 0, 627, 451, 0, 0, 0, 0, 0, 0, 0, 0,
+  549, 464, 0, 519, 377, 0, 0, 786, 0, 248, 0, 0, 185, 255, 500, 277,
+  608, 620, 719, 828, 909, 540, 0, 0, 0, 310, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 784, 367, 0, 0, 0, 0, 0, 0, 0, 0, 873, 0, 83,
+  307, 300, 901, 282, 717, 60, 484, 511, 528, 0, 0, 812, 0, 163, 0, 0,
+  0, 84, 274, 224, 0, 766, 925, 194, 306, 979, 0, 0, 0, 299, 889, 346,
+  0, 0, 184, 0, 0, 441, 191, 0, 0, 0, 0, 480, 907, 0, 0, 0,
+  0, 0, 450, 0, 0, 140, 0, 384, 0, 0, 12, 345, 0, 0, 0, 129,
+  635, 0, 0, 0, 142, 913, 0, 0, 525, 0, 750, 104, 884, 0, 428, 339,
+  969, 712, 0, 0, 0, 164, 0, 0, 0, 0, 0, 0, 0, 0, 0, 634,
+  443, 0, 0, 0, 0, 0, 0, 0, 0, 212, 0, 935, 0, 0, 8, 0,
+  0, 632, 24, 195, 0, 432, 761, 454, 983, 0, 592, 0, 0, 0, 0, 225,
+  770, 0, 0, 0, 0, 0, 817, 0, 0, 914, 0, 0, 933, 0, 89, 11,
+  227, 304, 322, 841, 25, 579, 515, 586, 911, 0, 939, 315, 0, 0, 0, 745,
+  851, 0, 842, 0, 0, 0, 0, 563, 457, 593, 0, 521, 0, 0, 0, 275,
+  0, 0, 0, 973, 431, 0, 0, 0, 297, 888, 0, 0, 0, 715, 0, 707,
+  276, 675, 0, 116, 466, 757, 0, 508, 0, 149, 555, 1, 829, 886, 0, 0,
+  0, 287, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 836, 0, 588, 0,
+  0, 294, 0, 423, 0, 0, 0, 0, 984, 7, 495, 676, 714, 470, 667, 964,
+  0, 0, 0, 0, 0, 0, 731, 0, 0, 0, 0, 616, 818, 493, 0, 264,
+  161, 0, 347, 0, 0, 670, 0, 0, 65, 64, 239, 57, 662, 506, 240, 604,
+  775, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 567, 0, 0, 0, 934, 0, 0, 791, 867, 0, 262, 43, 141, 218, 780,
+  922, 417, 894, 0, 713, 0, 0, 967, 449, 0, 0, 0, 286, 779, 848, 0,
+  974, 66, 0, 0, 162, 369, 661, 110, 0, 434, 815, 0, 735, 0, 0, 425,
+  0, 789, 840, 0, 921, 0, 0, 0, 0, 0, 0, 0, 0, 0, 647, 0,
+  0, 0, 0, 0, 0, 804, 0, 0, 327, 0, 0, 0, 0, 0, 0, 41,
+  0, 76, 334, 463, 618, 936, 67, 0, 0, 0, 0, 0, 0, 916, 0, 0,
+  733, 0, 617, 0, 0, 0, 764, 0, 0, 0, 0, 0, 0, 0, 622, 0,
+  0, 292, 396, 91, 947, 238, 253, 302, 348, 380, 993, 0, 682, 0, 0, 263,
+  208, 535, 491, 677, 696, 153, 895, 53, 902, 0, 290, 0, 0, 0, 516, 578,
+  748, 0, 125, 209, 77, 35, 769, 816, 919, 988, 642, 716, 0, 915, 405, 0,
+  674, 0, 0, 23, 900, 0, 550, 21, 360, 349, 0, 517, 175, 197, 656, 0,
+  0, 0, 0, 0, 755, 0, 0, 0, 0, 133, 130, 305, 56, 59, 744, 606,
+  957, 0, 0, 435, 0, 0, 70, 22, 589, 958, 0, 737, 0, 898, 97, 767,
+  95, 313, 0, 553, 0, 0, 0, 0, 387, 0, 0, 329, 0, 0, 0, 0,
+  230, 0, 0, 0, 0, 33, 391, 0, 956, 0, 883, 325, 0, 0, 720, 38,
+  0, 157, 559, 0, 0, 0, 0, 0, 626, 281, 69, 614, 659, 762, 805, 0,
+  673, 138, 538, 890, 288, 518, 128, 850, 991, 0, 0, 0, 584, 407, 868, 0,
+  0, 429, 15, 830, 905, 536, 216, 249, 323, 862, 0, 0, 595, 0, 0, 0,
+  533, 0, 0, 0, 0, 0, 539, 687, 721, 541, 765, 924, 0, 0, 0, 0,
+  0, 0, 415, 340, 0, 0, 0, 395, 93, 474, 872, 0, 0, 666, 0, 0,
+  564, 478, 473, 566, 293, 572, 577, 605, 628, 994, 0, 0, 0, 0, 0, 0,
+  0, 527, 651, 0, 0, 0, 985, 823, 795, 0, 0, 51, 106, 652, 827, 0,
+  0, 0, 318, 803, 90, 998, 575, 0, 0, 122, 0, 0, 510, 0, 17, 718,
+  0, 0, 0, 570, 0, 136, 295, 0, 0, 268, 0, 358, 0, 0, 0, 0,
+  0, 37, 0, 436, 0, 0, 0, 44, 0, 49, 944, 832, 0, 0, 490, 0,
+  0, 0, 117, 736, 822, 699, 0, 0, 0, 55, 0, 0, 0, 279, 808, 311,
+  0, 0, 0, 0, 63, 247, 0, 0, 0, 0, 50, 0, 612, 376, 532, 831,
+  0, 520, 169, 265, 467, 0, 0, 0, 0, 482, 0, 182, 0, 977, 0, 0,
+  756, 0, 383, 378, 738, 813, 0, 0, 611, 0, 558, 284, 814, 0, 0, 0,
+  522, 793, 177, 269, 85, 630, 897, 643, 679, 691, 800, 686, 965, 773, 0, 0,
+  0, 386, 0, 514, 0, 0, 0, 160, 398, 854, 171, 0, 0, 0, 382, 243,
+  0, 0, 87, 0, 0, 40, 119, 0, 783, 0, 120, 953, 975, 0, 476, 0,
+  0, 9, 0, 0, 0, 468, 0, 0, 923, 439, 0, 0, 0, 0, 0, 0,
+  0, 849, 0, 221, 638, 0, 499, 150, 930, 0, 446, 0, 0, 746, 13, 0,
+  0, 121, 0, 0, 30, 530, 824, 0, 0, 132, 0, 497, 0, 819, 207, 0,
+  855, 0, 0, 409, 31, 179, 78, 710, 363, 796, 166, 887, 0, 389, 728, 111,
+  760, 776, 839, 709, 960, 0, 0, 0, 0, 0, 574, 0, 0, 565, 0, 624,
+  0, 0, 245, 68, 390, 693, 966, 0, 0, 413, 602, 0, 0, 0, 0, 0,
+  0, 438, 0, 0, 623, 0, 0, 0, 0, 0, 0, 73, 337, 0, 0, 0,
+  0, 928, 0, 0, 0, 878, 0, 0, 881, 402, 0, 0, 283, 0, 695, 0,
+  492, 0, 0, 0, 0, 0, 460, 653, 0, 0, 5, 114, 352, 62, 237, 0,
+  0, 0, 0, 232, 235, 763, 0, 0, 0, 0, 202, 0, 0, 700, 0, 0,
+  0, 147, 870, 0, 0, 0, 678, 0, 672, 747, 0, 355, 354, 903, 918, 0,
+  0, 0, 0, 0, 0, 0, 0, 683, 2, 0, 437, 0, 0, 0, 0, 882,
+  321, 0, 422, 0, 0, 799, 846, 0, 107, 730, 743, 0, 0, 0, 0, 174,
+  0, 0, 621, 0, 0, 0, 0, 749, 0, 537, 0, 0, 671, 353, 187, 0,
+  0, 0, 0, 0, 0, 0, 0, 646, 0, 0, 0, 0, 0, 950, 753, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 952, 0, 0, 772, 270, 968, 280, 403,
+  0, 32, 0, 404, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 929,
+};
+
+const char *WA_FREQ_39_TOKENS[] = {
+  "on",
+  "ma",
+  "ei",
+  "sa",
+  "see",
+  "et",
+  "ja",
+  "ta",
+  "kui",
+  "seda",
+  "kas",
+  "me",
+  "mis",
+  "mida",
+  "pole",
+  "jah",
+  "aga",
+  "oma",
+  "siis",
+  "nii",
+  "olen",
+  "ära",
+  "oli",
+  "oled",
+  "mu",
+  "siin",
+  "kõik",
+  "nad",
+  "selle",
+  "midagi",
+  "mind",
+  "te",
+  "mul",
+  "mulle",
+  "minu",
+  "kes",
+  "su",
+  "nüüd",
+  "sind",
+  "kuidas",
+  "ole",
+  "ka",
+  "mitte",
+  "välja",
+  "tema",
+  "nagu",
+  "mina",
+  "sinu",
+  "miks",
+  "sulle",
+  "veel",
+  "või",
+  "meie",
+  "tagasi",
+  "sul",
+  "hea",
+  "küll",
+  "sina",
+  "väga",
+  "teda",
+  "saa",
+  "seal",
+  "teie",
+  "lihtsalt",
+  "üks",
+  "need",
+  "kus",
+  "oleks",
+  "palju",
+  "tea",
+  "teha",
+  "tead",
+  "siia",
+  "kuid",
+  "hästi",
+  "pärast",
+  "palun",
+  "tean",
+  "eest",
+  "olla",
+  "sellest",
+  "meil",
+  "tere",
+  "tule",
+  "juba",
+  "oleme",
+  "olgu",
+  "keegi",
+  "isa",
+  "ainult",
+  "peale",
+  "pean",
+  "tahad",
+  "neid",
+  "tahan",
+  "ju",
+  "talle",
+  "kunagi",
+  "sest",
+  "just",
+  "tänan",
+  "vaata",
+  "ema",
+  "mees",
+  "teed",
+  "tee",
+  "saab",
+  "tal",
+  "minema",
+  "asi",
+  "üle",
+  "maha",
+  "läbi",
+  "vaja",
+  "meid",
+  "enam",
+  "oh",
+  "teid",
+  "olnud",
+  "tõesti",
+  "arvan",
+  "vaid",
+  "kohe",
+  "läheb",
+  "koos",
+  "olete",
+  "pead",
+  "taha",
+  "enne",
+  "tuleb",
+  "vastu",
+  "hei",
+  "olema",
+  "võib",
+  "aega",
+  "aru",
+  "täna",
+  "mine",
+  "jumal",
+  "saan",
+  "anna",
+  "üles",
+  "minna",
+  "nende",
+  "kaks",
+  "peame",
+  "korras",
+  "sisse",
+  "öelda",
+  "isegi",
+  "olid",
+  "sinuga",
+  "ise",
+  "elu",
+  "end",
+  "kogu",
+  "ikka",
+  "kinni",
+  "vabandust",
+  "peaks",
+  "muidugi",
+  "jaoks",
+  "pea",
+  "valmis",
+  "teada",
+  "ütles",
+  "eks",
+  "rohkem",
+  "alati",
+  "teile",
+  "lähme",
+  "saad",
+  "saada",
+  "võta",
+  "ning",
+  "i",
+  "raha",
+  "lase",
+  "ütle",
+  "siit",
+  "kohta",
+  "praegu",
+  "liiga",
+  "sellega",
+  "minuga",
+  "oota",
+  "rääkida",
+  "alla",
+  "kurat",
+  "juurde",
+  "temaga",
+  "arvad",
+  "olin",
+  "sinna",
+  "tore",
+  "lahti",
+  "selles",
+  "aeg",
+  "kindel",
+  "näha",
+  "kuhu",
+  "teil",
+  "peab",
+  "parem",
+  "korda",
+  "iga",
+  "aitäh",
+  "juhtus",
+  "kuule",
+  "polnud",
+  "head",
+  "õigus",
+  "edasi",
+  "kõige",
+  "suur",
+  "meile",
+  "tegema",
+  "ütlesin",
+  "ette",
+  "teen",
+  "ega",
+  "inimesed",
+  "meeldib",
+  "nimi",
+  "ühe",
+  "teeb",
+  "kahju",
+  "surnud",
+  "tegelikult",
+  "koju",
+  "näinud",
+  "lähen",
+  "võin",
+  "noh",
+  "ilma",
+  "teinud",
+  "sain",
+  "räägi",
+  "kuni",
+  "teeme",
+  "kokku",
+  "saanud",
+  "päris",
+  "enda",
+  "näed",
+  "vist",
+  "toimub",
+  "asja",
+  "ennast",
+  "viga",
+  "arvasin",
+  "sama",
+  "kaasa",
+  "aastat",
+  "läks",
+  "kord",
+  "saame",
+  "naine",
+  "võid",
+  "tahab",
+  "tähendab",
+  "väike",
+  "härra",
+  "mingi",
+  "said",
+  "sai",
+  "kolm",
+  "las",
+  "mille",
+  "poleks",
+  "pane",
+  "äkki",
+  "hr",
+  "ongi",
+  "töö",
+  "neile",
+  "võib-olla",
+  "poiss",
+  "jälle",
+  "kallis",
+  "tegid",
+  "ütlesid",
+  "sõber",
+  "suuda",
+  "all",
+  "kaua",
+  "õige",
+  "aidata",
+  "terve",
+  "kena",
+  "usu",
+  "päeva",
+  "kindlasti",
+  "tuli",
+  "natuke",
+  "armastan",
+  "neil",
+  "kõike",
+  "ehk",
+  "tegi",
+  "kätte",
+  "üldse",
+  "tulla",
+  "selline",
+  "mõned",
+  "ajal",
+  "täpselt",
+  "millest",
+  "kedagi",
+  "ärge",
+  "kuradi",
+  "asju",
+  "hakkama",
+  "keda",
+  "tulen",
+  "tüdruk",
+  "päev",
+  "sellele",
+  "kust",
+  "söör",
+  "teine",
+  "endale",
+  "asjad",
+  "võtta",
+  "tundub",
+  "kuna",
+  "jäta",
+  "okei",
+  "vana",
+  "selleks",
+  "juures",
+  "mingit",
+  "tunne",
+  "ütlen",
+  "viis",
+  "tunnen",
+  "tegin",
+  "nägin",
+  "võiks",
+  "tahtsin",
+  "lõpeta",
+  "no",
+  "ilmselt",
+  "kuula",
+  "pidanud",
+  "kullake",
+  "auto",
+  "raske",
+  "abi",
+  "mõtlesin",
+  "sel",
+  "räägid",
+  "tööd",
+  "homme",
+  "elus",
+  "selge",
+  "sellepärast",
+  "näen",
+  "hiljem",
+  "saaks",
+  "alles",
+  "aitab",
+  "sinust",
+  "milline",
+  "hoia",
+  "poole",
+  "teate",
+  "järele",
+  "räägin",
+  "varem",
+  "osa",
+  "uuesti",
+  "peaksid",
+  "suurepärane",
+  "teab",
+  "läinud",
+  "eriti",
+  "millal",
+  "järgi",
+  "aasta",
+  "ees",
+  "taga",
+  "võimalik",
+  "lähed",
+  "peal",
+  "seega",
+  "tulge",
+  "vahel",
+  "jää",
+  "tappa",
+  "neist",
+  "mõtlen",
+  "maja",
+  "esimene",
+  "õhtul",
+  "minust",
+  "poolt",
+  "rääkima",
+  "parim",
+  "väljas",
+  "koht",
+  "teist",
+  "paar",
+  "ainus",
+  "sellist",
+  "uus",
+  "vähemalt",
+  "surma",
+  "kell",
+  "käia",
+  "samuti",
+  "poeg",
+  "kiiresti",
+  "võtan",
+  "eemale",
+  "sellel",
+  "täiesti",
+  "ilus",
+  "andeks",
+  "ah",
+  "tõsi",
+  "ümber",
+  "näe",
+  "maailma",
+  "loodan",
+  "tõsiselt",
+  "inimesi",
+  "leida",
+  "oleksin",
+  "piisavalt",
+  "pool",
+  "olemas",
+  "võime",
+  "sir",
+  "lapsed",
+  "kelle",
+  "jääb",
+  "peaaegu",
+  "tahtnud",
+  "panna",
+  "mehed",
+  "üksi",
+  "iganes",
+  "jack",
+  "vaadake",
+  "vajan",
+  "issand",
+  "tohi",
+  "saama",
+  "temast",
+  "veidi",
+  "eile",
+  "peaksin",
+  "lugu",
+  "lähe",
+  "võimalus",
+  "minge",
+  "näeme",
+  "lõpuks",
+  "oleksid",
+  "kõiki",
+  "aja",
+  "sõbrad",
+  "tehtud",
+  "võibolla",
+  "poisid",
+  "anda",
+  "tahaks",
+  "laps",
+  "heaks",
+  "vait",
+  "proua",
+  "sealt",
+  "viimane",
+  "öelnud",
+  "vabandage",
+  "vend",
+  "jääda",
+  "muretse",
+  "probleem",
+  "kuulnud",
+  "inimene",
+  "sees",
+  "hommikul",
+  "meeldi",
+  "hakkab",
+  "mõte",
+  "ütleb",
+  "paistab",
+  "täis",
+  "nalja",
+  "käes",
+  "muud",
+  "usun",
+  "ringi",
+  "tunned",
+  "jama",
+  "kodus",
+  "kuulsin",
+  "annan",
+  "kapten",
+  "tulid",
+  "sõna",
+  "varsti",
+  "juhtub",
+  "hoida",
+  "läheme",
+  "kõigest",
+  "mäletad",
+  "john",
+  "tänu",
+  "hetk",
+  "minutit",
+  "mõista",
+  "teadnud",
+  "tulin",
+  "niimoodi",
+  "meiega",
+  "tahate",
+  "teise",
+  "umbes",
+  "tuled",
+  "mõlemad",
+  "järgmine",
+  "nime",
+  "halb",
+  "pisut",
+  "otse",
+  "neetud",
+  "peaksime",
+  "võtke",
+  "mööda",
+  "teiega",
+  "üsna",
+  "teised",
+  "lasta",
+  "lahe",
+  "leidsin",
+  "tähtis",
+  "mõni",
+  "hull",
+  "armas",
+  "tulevad",
+  "tööle",
+  "mõtled",
+  "meest",
+  "rääkinud",
+  "pidi",
+  "neli",
+  "juhul",
+  "persse",
+  "peate",
+  "päeval",
+  "teame",
+  "politsei",
+  "otsa",
+  "too",
+  "kellegi",
+  "mehe",
+  "uue",
+  "vaadata",
+  "räägib",
+  "kadunud",
+  "jätta",
+  "ütlema",
+  "tundi",
+  "rääkis",
+  "näeb",
+  "linna",
+  "vaatame",
+  "saavad",
+  "õnnelik",
+  "nägid",
+  "halloo",
+  "saate",
+  "igal",
+  "uskuda",
+  "olevat",
+  "käed",
+  "dr",
+  "aita",
+  "nimel",
+  "kohal",
+  "pidin",
+  "unusta",
+  "ühel",
+  "õde",
+  "nõus",
+  "meist",
+  "kutt",
+  "mõtle",
+  "maa",
+  "tulnud",
+  "lihtne",
+  "haiget",
+  "laske",
+  "käest",
+  "kohale",
+  "kuulda",
+  "teadsin",
+  "hetkel",
+  "paremini",
+  "kuigi",
+  "hakka",
+  "jooksul",
+  "vaatan",
+  "kahe",
+  "oodake",
+  "ühte",
+  "niisiis",
+  "süüa",
+  "teete",
+  "räägime",
+  "teevad",
+  "saaksin",
+  "tahavad",
+  "võtab",
+  "andis",
+  "vale",
+  "tahtis",
+  "sobib",
+  "nendega",
+  "võttis",
+  "teel",
+  "päästa",
+  "suri",
+  "rahune",
+  "tahaksin",
+  "miski",
+  "kasutada",
+  "tubli",
+  "ööd",
+  "muidu",
+  "millega",
+  "ütled",
+  "käsi",
+  "ikkagi",
+  "istu",
+  "siiski",
+  "hommikust",
+  "teeks",
+  "vabanda",
+  "dollarit",
+  "ok",
+  "tõeline",
+  "valesti",
+  "küsimus",
+  "naljakas",
+  "iial",
+  "ükskõik",
+  "kellega",
+  "õnne",
+  "charlie",
+  "naise",
+  "kuradit",
+  "elada",
+  "loomulikult",
+  "olime",
+  "arva",
+  "suure",
+  "new",
+  "nemad",
+  "rahu",
+  "väärt",
+  "preili",
+  "kõigile",
+  "rääkisin",
+  "seotud",
+  "mõne",
+  "vahele",
+  "jumala",
+  "mõttes",
+  "vaatama",
+  "saime",
+  "võite",
+  "kardan",
+  "kuus",
+  "võivad",
+  "pihta",
+  "käib",
+  "olge",
+  "doktor",
+  "tulemast",
+  "oodata",
+  "töötab",
+  "võtma",
+  "uut",
+  "teadma",
+  "relv",
+  "jäi",
+  "andke",
+  "mõelnud",
+  "võtame",
+  "püha",
+  "kao",
+  "luba",
+  "pere",
+  "silmad",
+  "süü",
+  "tappis",
+  "semu",
+  "jäänud",
+  "tütar",
+  "viia",
+  "luban",
+  "kuuled",
+  "uks",
+  "vajab",
+  "kuud",
+  "kohtuda",
+  "nägu",
+  "mingeid",
+  "perse",
+  "ometi",
+  "aastal",
+  "silmas",
+  "milles",
+  "helistan",
+  "milleks",
+  "kõlab",
+  "plaan",
+  "ellu",
+  "moodi",
+  "kuidagi",
+  "mitu",
+  "peavad",
+  "näita",
+  "võtaks",
+  "annab",
+  "number",
+  "helista",
+  "kellelegi",
+  "kõigi",
+  "soovid",
+  "tunni",
+  "tahtsid",
+  "hakkame",
+  "tulema",
+  "jaa",
+  "lõbus",
+  "hakkan",
+  "lähedal",
+  "kutid",
+  "mõistan",
+  "suudad",
+  "kuu",
+  "sam",
+  "inimeste",
+  "soovin",
+  "hoopis",
+  "silma",
+  "öö",
+  "paha",
+  "suutnud",
+  "panen",
+  "jalga",
+  "küsida",
+  "ruttu",
+  "pealt",
+  "abikaasa",
+  "ootab",
+  "tehke",
+  "michael",
+  "tähelepanu",
+  "võiksid",
+  "aimugi",
+  "saaksid",
+  "uskumatu",
+  "oska",
+  "elab",
+  "minuti",
+  "leidsid",
+  "hilja",
+  "magama",
+  "kombes",
+  "vajame",
+  "appi",
+  "president",
+  "endast",
+  "polegi",
+  "püsti",
+  "näiteks",
+  "üleval",
+  "issi",
+  "onu",
+  "kuhugi",
+  "kooli",
+  "leia",
+  "kontrolli",
+  "mängida",
+  "maailmas",
+  "vajad",
+  "vaba",
+  "nägemist",
+  "mängu",
+  "ühtegi",
+  "toon",
+  "mäletan",
+  "ameerika",
+  "tuua",
+  "tüüp",
+  "kolme",
+  "mr",
+  "meeldiv",
+  "maailm",
+  "vii",
+  "nägi",
+  "lasen",
+  "rahule",
+  "korra",
+  "tüdrukud",
+  "vihkan",
+  "majas",
+  "õhtu",
+  "vanemad",
+  "vähem",
+  "pikk",
+  "arvates",
+  "alt",
+  "sellise",
+  "näete",
+  "oi",
+  "tavaliselt",
+  "ülejäänud",
+  "arust",
+  "võinud",
+  "meelde",
+  "tahame",
+  "poja",
+  "mõelda",
+  "asemel",
+  "proovi",
+  "kolonel",
+  "agent",
+  "suhtes",
+  "süüdi",
+  "pani",
+  "pealegi",
+  "juhtunud",
+  "mike",
+  "osta",
+  "meel",
+  "huvitav",
+  "haige",
+  "seepärast",
+  "minul",
+  "käinud",
+  "igatahes",
+  "tom",
+  "lapse",
+  "kiire",
+  "arvab",
+  "pähe",
+  "jään",
+  "mõistad",
+  "otsin",
+  "lõpp",
+  "lahku",
+  "kodu",
+  "koha",
+  "käi",
+  "jeesus",
+  "probleeme",
+  "naist",
+  "pagan",
+  "pange",
+  "muuta",
+  "mäleta",
+  "esimest",
+  "tegemist",
+  "imelik",
+  "kuningas",
+  "noor",
+  "läksid",
+  "lapsi",
+  "lahkuda",
+  "pr",
+  "vahet",
+  "õhku",
+  "endiselt",
+  "ohtlik",
+  "keha",
+  "päriselt",
+  "suu",
+  "mr.",
+  "loll",
+  "kuulsid",
+  "teadsid",
+  "leidma",
+  "aastaid",
+  "paneb",
+  "joe",
+  "frank",
+  "aus",
+  "idee",
+  "mõnikord",
+  "öösel",
+  "hakkas",
+  "s",
+  "huvita",
+  "kiiremini",
+  "vett",
+  "isand",
+  "arvatavasti",
+  "kaitsta",
+  "inimest",
+  "kohvi",
+  "pidu",
+  "teiste",
+  "jääd",
+  "värk",
+  "linnas",
+  "näidata",
+  "rääkisid",
+  "kõrvale",
+  "kuradima",
+  "ajast",
+  "lähevad",
+  "tõde",
+  "kohutav",
+  "võtsid",
+  "võimalust",
+  "nägema",
+  "hüvasti",
+  "võis",
+  "ammu",
+  "suurt",
+  "lõpetada",
+  "last",
+  "ukse",
+  "arvate",
+  "paari",
+  "taas",
+  "otsima",
+  "viin",
+  "oo",
+  "kindral",
+  "kahjuks",
+  "viimase",
+  "tapsid",
+  "tundma",
+  "raisk",
+  "teavad",
+  "meeldivad",
+  "au",
+  "meeles",
+  "järel",
+  "emme",
+  "hiljaks",
+  "aidake",
+  "sõda",
+  "läksin",
+  "hoidke",
+  "kõrval",
+  "leidnud",
+  "põhjus",
+  "üritan",
+  "kõvasti",
+  "puhas",
+  "suudan",
+  "ainuke",
+  "kellel",
+  "ühendust",
+  "boss",
+  "öelge",
+  "paljud",
+  "tõtt",
+  "äri",
+  "kõne",
+  "daamid",
+  "peter",
+  "ettevaatlik",
+  "relva",
+  "jätke",
+  "tegu",
+  "kellele",
+  "koer",
+  "ootan",
+  "d",
+  "oluline",
+  "david",
+  "kohtume",
+  "seekord",
+  "james",
+  "ajaks",
+  "imeline",
+  "üht",
+  "kaugele",
+  "soovite",
+  "väsinud",
+  "leiame",
+  "muutunud",
+  "jutt",
+  "saatis",
+  "ausalt",
+  "paigal",
+  "tohiks",
+  "mõnda",
+  "ajad",
+  "armastus",
+};
+const uint16_t WA_FREQ_39_RANKS[] = {
+  311, 66, 53, 342, 411, 308, 434, 383, 476, 294, 372, 558, 453, 623, 718, 880,
+  903, 0, 0, 0, 914, 0, 0, 512, 939, 0, 768, 0, 0, 698, 839, 0,
+  856, 0, 0, 0, 0, 0, 0, 677, 0, 186, 524, 0, 366, 784, 979, 0,
+  0, 190, 0, 0, 0, 0, 0, 129, 0, 0, 0, 0, 0, 0, 654, 286,
+  182, 547, 354, 921, 0, 0, 0, 0, 0, 125, 0, 0, 0, 651, 0, 0,
+  0, 456, 801, 0, 76, 0, 442, 841, 0, 0, 131, 774, 1000, 0, 0, 883,
+  0, 895, 0, 0, 0, 0, 785, 614, 716, 29, 0, 0, 0, 818, 925, 0,
+  0, 0, 0, 663, 0, 0, 0, 0, 65, 0, 107, 964, 349, 0, 414, 15,
+  813, 874, 0, 950, 106, 210, 296, 25, 62, 335, 138, 203, 496, 686, 236, 276,
+  650, 911, 934, 0, 119, 584, 0, 235, 0, 489, 704, 726, 907, 918, 732, 0,
+  563, 0, 827, 933, 756, 692, 0, 788, 89, 318, 869, 927, 0, 0, 857, 992,
+  0, 0, 47, 44, 74, 185, 368, 866, 0, 0, 0, 0, 0, 0, 0, 10,
+  452, 817, 192, 0, 710, 0, 0, 196, 0, 805, 0, 0, 0, 0, 333, 0,
+  0, 0, 0, 764, 783, 0, 761, 510, 597, 923, 0, 470, 0, 0, 851, 0,
+  966, 0, 108, 938, 143, 520, 854, 943, 0, 0, 0, 0, 0, 0, 309, 0,
+  0, 0, 0, 0, 0, 590, 0, 951, 0, 0, 215, 287, 0, 637, 178, 0,
+  0, 32, 271, 360, 480, 402, 672, 695, 706, 529, 819, 0, 0, 0, 0, 0,
+  0, 0, 0, 67, 0, 0, 248, 459, 198, 50, 528, 548, 617, 601, 566, 667,
+  481, 843, 52, 77, 214, 714, 441, 811, 879, 947, 978, 723, 400, 0, 0, 0,
+  0, 127, 169, 37, 188, 310, 516, 936, 628, 429, 0, 0, 823, 0, 0, 0,
+  842, 80, 542, 0, 416, 727, 711, 191, 0, 588, 791, 471, 0, 980, 171, 595,
+  277, 674, 0, 237, 438, 720, 0, 0, 331, 0, 0, 736, 0, 795, 0, 615,
+  0, 0, 0, 560, 361, 272, 130, 343, 133, 157, 405, 406, 431, 0, 202, 0,
+  274, 382, 604, 0, 280, 679, 901, 0, 315, 0, 591, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 786, 0, 90, 332, 0, 717, 0, 526, 419, 21, 589, 793,
+  0, 0, 207, 0, 546, 0, 0, 0, 0, 571, 20, 397, 931, 702, 957, 500,
+  0, 707, 969, 12, 0, 0, 121, 306, 490, 0, 0, 541, 0, 0, 0, 838,
+  946, 0, 0, 5, 0, 798, 0, 0, 0, 787, 0, 0, 0, 0, 0, 0,
+  998, 913, 0, 0, 251, 745, 495, 0, 0, 0, 437, 0, 853, 0, 0, 606,
+  379, 699, 691, 0, 0, 0, 0, 33, 399, 0, 0, 904, 0, 430, 0, 327,
+  0, 0, 0, 51, 0, 612, 0, 0, 314, 291, 445, 821, 767, 0, 733, 556,
+  0, 449, 0, 83, 0, 0, 0, 0, 298, 0, 68, 0, 569, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 149, 493, 0, 0, 502, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 16, 390, 392, 755, 975, 0, 230, 7, 876, 0, 0, 0,
+  0, 0, 0, 0, 797, 0, 364, 426, 0, 514, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 282, 607, 0, 345, 917, 0, 227,
+  380, 0, 0, 0, 559, 744, 0, 0, 0, 0, 0, 0, 0, 0, 329, 174,
+  539, 0, 0, 0, 0, 0, 814, 508, 775, 84, 777, 937, 0, 324, 483, 507,
+  576, 0, 0, 0, 0, 873, 163, 0, 0, 0, 122, 30, 153, 644, 673, 304,
+  668, 0, 0, 0, 887, 0, 0, 658, 0, 0, 0, 868, 897, 945, 812, 0,
+  0, 0, 0, 995, 0, 0, 0, 0, 0, 578, 0, 0, 0, 120, 0, 0,
+  0, 0, 622, 908, 0, 375, 0, 0, 676, 0, 989, 0, 0, 0, 337, 487,
+  915, 49, 0, 0, 0, 0, 0, 0, 0, 522, 0, 572, 0, 0, 509, 953,
+  0, 70, 109, 300, 527, 407, 0, 0, 0, 0, 0, 22, 221, 885, 0, 172,
+  681, 537, 587, 930, 256, 0, 0, 0, 0, 860, 0, 0, 0, 0, 782, 0,
+  955, 0, 0, 313, 0, 0, 0, 160, 725, 341, 0, 688, 0, 926, 553, 28,
+  0, 0, 0, 0, 0, 126, 0, 179, 0, 619, 260, 703, 0, 0, 0, 0,
+  0, 862, 87, 807, 239, 949, 0, 173, 585, 79, 9, 102, 183, 295, 17, 494,
+  948, 985, 0, 278, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 962, 0,
+  0, 0, 273, 0, 0, 0, 0, 0, 498, 0, 0, 675, 115, 809, 0, 0,
+  582, 0, 929, 0, 0, 0, 543, 746, 0, 0, 0, 0, 0, 0, 474, 0,
+  0, 0, 0, 0, 123, 348, 63, 629, 829, 0, 417, 0, 799, 0, 0, 974,
+  0, 0, 48, 643, 965, 110, 0, 0, 330, 443, 0, 0, 268, 448, 165, 312,
+  610, 57, 0, 0, 0, 0, 69, 0, 0, 0, 307, 0, 378, 690, 0, 0,
+  770, 0, 117, 0, 0, 0, 0, 347, 781, 0, 0, 0, 462, 678, 176, 338,
+  0, 721, 166, 771, 73, 881, 565, 0, 0, 0, 742, 0, 0, 0, 0, 0,
+  6, 0, 0, 0, 148, 0, 0, 0, 586, 603, 0, 440, 959, 0, 0, 0,
+  132, 177, 415, 680, 158, 687, 734, 299, 984, 0, 475, 259, 0, 270, 234, 712,
+  436, 540, 128, 642, 872, 0, 928, 825, 0, 0, 834, 0, 0, 599, 521, 0,
+  0, 685, 0, 91, 912, 468, 26, 753, 940, 0, 0, 519, 579, 0, 0, 381,
+  816, 0, 0, 0, 0, 748, 905, 973, 0, 0, 0, 0, 0, 252, 455, 469,
+  212, 0, 0, 0, 0, 554, 0, 222, 290, 159, 424, 433, 422, 533, 594, 0,
+  0, 325, 8, 624, 609, 701, 935, 232, 884, 0, 0, 0, 0, 0, 0, 660,
+  867, 103, 293, 100, 359, 0, 0, 0, 0, 0, 0, 93, 336, 499, 0, 0,
+  0, 0, 0, 401, 750, 0, 0, 0, 92, 111, 0, 824, 54, 365, 0, 0,
+  0, 0, 0, 435, 0, 0, 0, 0, 0, 0, 899, 0, 682, 164, 0, 0,
+  0, 0, 952, 0, 0, 0, 0, 0, 0, 564, 42, 988, 523, 0, 0, 0,
+  0, 0, 0, 960, 0, 0, 0, 0, 0, 0, 246, 0, 0, 800, 0, 0,
+  0, 362, 384, 740, 0, 0, 71, 835, 898, 423, 961, 326, 0, 0, 511, 0,
+  749, 447, 0, 0, 0, 0, 0, 0, 0, 0, 0, 636, 0, 0, 233, 669,
+  0, 151, 0, 653, 396, 0, 0, 205, 492, 0, 418, 0, 0, 739, 0, 849,
+  0, 244, 353, 0, 64, 0, 0, 886, 0, 0, 266, 409, 735, 398, 715, 420,
+  792, 808, 0, 0, 0, 0, 145, 152, 0, 0, 0, 0, 635, 141, 346, 993,
+  557, 0, 0, 941, 638, 58, 0, 142, 640, 0, 0, 0, 757, 0, 206, 24,
+  395, 647, 987, 0, 976, 334, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 696, 0, 75, 19, 249, 760, 450, 549, 844, 570, 155, 200, 275,
+  613, 780, 264, 855, 890, 0, 0, 625, 0, 0, 288, 0, 0, 833, 0, 0,
+  0, 0, 486, 0, 0, 0, 878, 0, 0, 0, 0, 0, 0, 0, 0, 864,
+  863, 916, 0, 0, 0, 356, 432, 223, 0, 482, 216, 611, 0, 0, 632, 0,
+  0, 0, 363, 0, 662, 201, 211, 491, 0, 593, 351, 350, 2, 738, 994, 0,
+  0, 184, 0, 0, 339, 0, 303, 806, 888, 689, 661, 0, 0, 0, 0, 0,
+  0, 555, 322, 552, 0, 0, 3, 0, 240, 574, 139, 458, 762, 0, 0, 719,
+  0, 0, 773, 971, 0, 255, 376, 693, 0, 0, 0, 0, 0, 358, 0, 0,
+  228, 0, 0, 958, 765, 0, 562, 659, 0, 0, 657, 722, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 35, 0, 0, 217, 0, 0, 568, 0, 134, 891, 0,
+  4, 0, 0, 580, 0, 0, 0, 0, 0, 645, 0, 848, 0, 0, 0, 0,
+  446, 0, 0, 0, 220, 425, 633, 0, 40, 0, 631, 374, 515, 305, 0, 708,
+  0, 0, 0, 219, 0, 140, 655, 902, 0, 112, 243, 0, 0, 0, 0, 0,
+  0, 213, 167, 0, 0, 0, 0, 577, 23, 465, 0, 0, 0, 369, 0, 0,
+  0, 501, 0, 385, 0, 0, 0, 461, 769, 0, 944, 0, 0, 0, 0, 0,
+  0, 247, 0, 0, 894, 0, 344, 478, 656, 11, 871, 0, 0, 0, 0, 743,
+  0, 0, 954, 525, 772, 982, 0, 0, 0, 0, 503, 0, 0, 840, 387, 94,
+  997, 0, 0, 116, 0, 0, 147, 0, 0, 0, 0, 0, 393, 932, 0, 0,
+  36, 0, 124, 404, 0, 0, 0, 463, 0, 0, 95, 889, 0, 99, 0, 0,
+  505, 253, 665, 815, 0, 0, 0, 187, 238, 652, 0, 0, 532, 180, 859, 0,
+  261, 13, 0, 0, 729, 0, 0, 0, 0, 0, 0, 0, 41, 0, 0, 0,
+  225, 847, 551, 0, 0, 0, 403, 0, 0, 0, 0, 0, 0, 0, 473, 0,
+  790, 649, 0, 0, 802, 18, 412, 0, 0, 0, 0, 822, 0, 242, 956, 231,
+  0, 391, 0, 104, 0, 0, 942, 0, 0, 0, 0, 0, 758, 0, 0, 0,
+  0, 81, 0, 0, 321, 0, 0, 0, 0, 0, 43, 98, 316, 598, 479, 752,
+  0, 0, 0, 0, 0, 627, 0, 713, 837, 892, 283, 763, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 428, 323, 0, 909, 0, 534, 776, 181,
+  517, 747, 751, 803, 0, 0, 0, 284, 536, 0, 451, 439, 0, 0, 0, 0,
+  0, 0, 796, 0, 0, 0, 0, 0, 877, 0, 0, 705, 0, 0, 538, 0,
+  484, 0, 0, 0, 161, 596, 388, 670, 0, 38, 0, 0, 0, 0, 408, 0,
+  0, 0, 0, 0, 820, 0, 0, 0, 0, 0, 0, 504, 56, 86, 826, 506,
+  981, 0, 0, 545, 620, 0, 457, 0, 0, 730, 592, 389, 575, 922, 55, 634,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 60, 241, 709, 477, 789, 466,
+  0, 0, 0, 101, 279, 646, 794, 831, 0, 0, 0, 0, 0, 724, 0, 0,
+  0, 257, 0, 488, 0, 804, 0, 0, 193, 218, 355, 836, 0, 0, 616, 0,
+  194, 983, 0, 367, 497, 97, 413, 810, 850, 113, 394, 0, 0, 919, 970, 78,
+  858, 269, 0, 832, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 267,
+  320, 694, 0, 861, 0, 0, 0, 0, 0, 0, 0, 583, 0, 0, 156, 550,
+  513, 664, 828, 581, 319, 14, 377, 731, 778, 0, 0, 0, 0, 1, 135, 754,
+  0, 639, 648, 967, 0, 0, 0, 530, 195, 175, 544, 600, 870, 285, 467, 0,
+  893, 991, 0, 136, 0, 0, 0, 0, 518, 0, 317, 573, 118, 0, 0, 386,
+  114, 137, 444, 920, 683, 977, 0, 0, 0, 258, 0, 0, 0, 0, 0, 0,
+  0, 72, 766, 0, 0, 972, 0, 204, 229, 0, 0, 0, 0, 0, 906, 0,
+  485, 370, 297, 224, 741, 845, 875, 0, 0, 846, 0, 0, 373, 0, 0, 0,
+  245, 0, 0, 0, 0, 0, 34, 0, 986, 199, 410, 0, 618, 146, 531, 82,
+  865, 0, 0, 621, 371, 0, 427, 96, 209, 0, 0, 0, 289, 700, 263, 0,
+  88, 0, 602, 59, 45, 281, 197, 105, 162, 154, 328, 0, 968, 666, 340, 605,
+  0, 0, 0, 0, 684, 464, 896, 0, 0, 170, 0, 226, 0, 0, 0, 208,
+  352, 254, 61, 31, 301, 963, 0, 0, 0, 0, 641, 0, 0, 0, 737, 189,
+  0, 0, 0, 567, 924, 759, 0, 0, 0, 46, 996, 0, 535, 0, 421, 0,
+  460, 150, 728, 830, 910, 990, 900, 0, 0, 671, 0, 0, 697, 0, 0, 608,
+  144, 250, 0, 0, 292, 0, 0, 357, 626, 0, 0, 999, 0, 0, 0, 39,
+  561, 0, 472, 779, 852, 0, 262, 454, 630, 882, 0, 302, 27, 265, 85, 168,
+};
+
+const char *WA_FREQ_40_TOKENS[] = {
+  "ez",
+  "da",
+  "eta",
+  "bat",
+  "dut",
+  "zer",
+  "egin",
+  "duzu",
+  "bai",
+  "nahi",
+  "du",
+  "behar",
+  "baina",
+  "hori",
+  "nire",
+  "naiz",
+  "izan",
+  "zure",
+  "esan",
+  "dago",
+  "zara",
+  "hau",
+  "ere",
+  "dugu",
+  "ari",
+  "zen",
+  "egiten",
+  "dira",
+  "hemen",
+  "zuen",
+  "egingo",
+  "ezin",
+  "nuen",
+  "ondo",
+  "oso",
+  "bere",
+  "zu",
+  "nik",
+  "uste",
+  "orain",
+  "al",
+  "izango",
+  "zergatik",
+  "joan",
+  "ongi",
+  "jauna",
+  "ni",
+  "asko",
+  "dute",
+  "beste",
+  "dizut",
+  "ikusi",
+  "hitz",
+  "gara",
+  "nola",
+  "edo",
+  "zaude",
+  "gure",
+  "zuk",
+  "ezer",
+  "nago",
+  "dena",
+  "eman",
+  "utzi",
+  "baino",
+  "dela",
+  "ezta",
+  "zerbait",
+  "kaixo",
+  "egon",
+  "non",
+  "bezala",
+  "etorri",
+  "hil",
+  "den",
+  "dakit",
+  "mesedez",
+  "gauza",
+  "bakarrik",
+  "gehiago",
+  "batean",
+  "bi",
+  "ditut",
+  "hartu",
+  "gero",
+  "goazen",
+  "ba",
+  "ona",
+  "barkatu",
+  "aita",
+  "entzun",
+  "hor",
+  "beharko",
+  "gabe",
+  "ikusten",
+  "tira",
+  "benetan",
+  "horrela",
+  "inoiz",
+  "badakit",
+  "zaitut",
+  "sentitzen",
+  "nor",
+  "begira",
+  "egun",
+  "nintzen",
+  "orduan",
+  "eskerrik",
+  "beti",
+  "bera",
+  "ama",
+  "esaten",
+  "gaur",
+  "badakizu",
+  "gizon",
+  "didazu",
+  "zenuen",
+  "daude",
+  "ematen",
+  "duzue",
+  "arte",
+  "ditu",
+  "gertatzen",
+  "sartu",
+  "urte",
+  "mila",
+  "diot",
+  "esker",
+  "beraz",
+  "egia",
+  "baten",
+  "lehen",
+  "oraindik",
+  "batek",
+  "bada",
+  "lan",
+  "ados",
+  "horrek",
+  "zait",
+  "baduzu",
+  "egongo",
+  "kaka",
+  "duen",
+  "berriz",
+  "alde",
+  "ezazu",
+  "zein",
+  "zuten",
+  "maite",
+  "duela",
+  "hain",
+  "ulertzen",
+  "dio",
+  "dituzu",
+  "nuke",
+  "neska",
+  "jakin",
+  "atera",
+  "zaitez",
+  "bizi",
+  "itxaron",
+  "esango",
+  "ezagutzen",
+  "guztiak",
+  "aurkitu",
+  "batzuk",
+  "ziren",
+  "diozu",
+  "zoaz",
+  "joango",
+  "daukat",
+  "ditugu",
+  "hemendik",
+  "guztia",
+  "jarri",
+  "gertatu",
+  "egiteko",
+  "horiek",
+  "hona",
+  "bila",
+  "zenbat",
+  "dit",
+  "berak",
+  "zaizu",
+  "zegoen",
+  "lasai",
+  "besterik",
+  "ahal",
+  "deitu",
+  "izena",
+  "niri",
+  "on",
+  "denbora",
+  "hala",
+  "lagun",
+  "zurekin",
+  "horixe",
+  "hasi",
+  "handia",
+  "agian",
+  "noski",
+  "etxera",
+  "eraman",
+  "itzuli",
+  "aurrera",
+  "nirekin",
+  "berriro",
+  "zela",
+  "gustatzen",
+  "han",
+  "hiru",
+  "honetan",
+  "prest",
+  "zatoz",
+  "emango",
+  "genuen",
+  "gaude",
+  "bizitza",
+  "ze",
+  "pentsatu",
+  "burua",
+  "inork",
+  "duzun",
+  "lagundu",
+  "azken",
+  "ea",
+  "buruz",
+  "ene",
+  "moduz",
+  "agur",
+  "batekin",
+  "ziur",
+  "dudan",
+  "zertan",
+  "dizu",
+  "galdu",
+  "ekarri",
+  "dirua",
+  "ibili",
+  "berri",
+  "azkar",
+  "zidan",
+  "nau",
+  "bakarra",
+  "nora",
+  "gauzak",
+  "zarete",
+  "aizu",
+  "zuri",
+  "bota",
+  "hara",
+  "begiratu",
+  "andrea",
+  "jo",
+  "pixka",
+  "bihar",
+  "maitea",
+  "nork",
+  "zinen",
+  "ikusiko",
+  "horregatik",
+  "batera",
+  "artean",
+  "dezagun",
+  "nahikoa",
+  "izatea",
+  "eskatu",
+  "gu",
+  "ederra",
+  "ote",
+  "nauzu",
+  "zuek",
+  "egitea",
+  "lana",
+  "geratu",
+  "lortu",
+  "zain",
+  "aurretik",
+  "zera",
+  "dituzte",
+  "sekula",
+  "nahiko",
+  "inor",
+  "a",
+  "axola",
+  "utziko",
+  "honek",
+  "ondoren",
+  "hauek",
+  "ederki",
+  "dakizu",
+  "zituen",
+  "etxean",
+  "emakume",
+  "geldi",
+  "bertan",
+  "baita",
+  "jakina",
+  "duzula",
+  "ahaztu",
+  "denak",
+  "gelditu",
+  "kontuz",
+  "iritsi",
+  "noa",
+  "denok",
+  "nion",
+  "lo",
+  "horretan",
+  "beharra",
+  "dudala",
+  "aukera",
+  "behin",
+  "ginen",
+  "zuretzat",
+  "zenuke",
+  "espero",
+  "dezaket",
+  "elkarrekin",
+  "pentsatzen",
+  "saiatu",
+  "biok",
+  "beharbada",
+  "berarekin",
+  "haren",
+  "kendu",
+  "hobe",
+  "zaitu",
+  "noiz",
+  "ia",
+  "jendea",
+  "amaitu",
+  "berehala",
+  "etorriko",
+  "norbait",
+  "polita",
+  "ezagutu",
+  "zarela",
+  "hartzen",
+  "bost",
+  "osoa",
+  "hura",
+  "dagoen",
+  "jarraitu",
+  "gaizki",
+  "onena",
+  "ala",
+  "gogoratzen",
+  "zaio",
+  "laztana",
+  "bizirik",
+  "leku",
+  "hartuko",
+  "gauean",
+  "doa",
+  "oraintxe",
+  "batez",
+  "entzuten",
+  "naizela",
+  "jende",
+  "bidali",
+  "omen",
+  "aurrean",
+  "dagoela",
+  "hobeto",
+  "nazazu",
+  "berria",
+  "irten",
+  "nizun",
+  "jan",
+  "daiteke",
+  "guk",
+  "tiro",
+  "horren",
+  "dezakezu",
+  "minutu",
+  "galdetu",
+  "laster",
+  "aitak",
+  "nituen",
+  "dirudi",
+  "niretzat",
+  "pertsona",
+  "gau",
+  "une",
+  "itzuliko",
+  "badu",
+  "eramango",
+  "gora",
+  "nengoen",
+  "iruditzen",
+  "ordu",
+  "aldatu",
+  "ihes",
+  "etxe",
+  "dauka",
+  "izateko",
+  "gizona",
+  "mutil",
+  "itxura",
+  "joaten",
+  "oh",
+  "o",
+  "hilko",
+  "neuk",
+  "laguntza",
+  "ireki",
+  "bezain",
+  "arrazoi",
+  "bati",
+  "luke",
+  "litzateke",
+  "harrapatu",
+  "etxea",
+  "horrekin",
+  "kontua",
+  "zuela",
+  "pozten",
+  "duten",
+  "semea",
+  "zion",
+  "kontu",
+  "diren",
+  "lagunak",
+  "gainean",
+  "jainkoa",
+  "beno",
+  "mundu",
+  "zoragarria",
+  "hilda",
+  "erakutsi",
+  "ideia",
+  "gabon",
+  "beldur",
+  "argi",
+  "sartzen",
+  "batzuetan",
+  "zaharra",
+  "berdin",
+  "lau",
+  "txarra",
+  "familia",
+  "hiltzen",
+  "barruan",
+  "bitartean",
+  "kezkatu",
+  "jartzen",
+  "diote",
+  "baietz",
+  "anaia",
+  "hainbeste",
+  "badut",
+  "ulertu",
+  "zaren",
+  "igo",
+  "daukazu",
+  "erantzun",
+  "eseri",
+  "atea",
+  "duk",
+  "benetako",
+  "atzera",
+  "direla",
+  "izaten",
+  "dizuet",
+  "aldiz",
+  "polizia",
+  "idatzi",
+  "irabazi",
+  "banoa",
+  "duena",
+  "heldu",
+  "laguna",
+  "galdera",
+  "gutxi",
+  "aterako",
+  "amak",
+  "diru",
+  "didate",
+  "emaztea",
+  "neure",
+  "behera",
+  "erabili",
+  "diogu",
+  "eskatzen",
+  "balio",
+  "kanpoan",
+  "deitzen",
+  "jada",
+  "erabaki",
+  "dolar",
+  "horri",
+  "balitz",
+  "segi",
+  "lagunduko",
+  "eutsi",
+  "dator",
+  "duzuna",
+  "pasa",
+  "primeran",
+  "itxi",
+  "elkar",
+  "jendeak",
+  "puta",
+  "uzten",
+  "dabil",
+  "mutilak",
+  "mugi",
+  "jaso",
+  "baizik",
+  "berandu",
+  "ezetz",
+  "alaba",
+  "txiki",
+  "handi",
+  "haiek",
+  "zeure",
+  "erosi",
+  "gehiegi",
+  "geratzen",
+  "bukatu",
+  "zaila",
+  "horrelako",
+  "jakingo",
+  "gainera",
+  "pozik",
+  "lehenago",
+  "seguru",
+  "lehenengo",
+  "bikaina",
+  "tipo",
+  "jarriko",
+  "jotzen",
+  "norbaitek",
+  "lanean",
+  "ostia",
+  "ume",
+  "zertarako",
+  "atzean",
+  "aski",
+  "dugun",
+  "daukagu",
+  "bestela",
+  "azkenean",
+  "ateratzen",
+  "moduan",
+  "gela",
+  "naizen",
+  "geratuko",
+  "honen",
+  "nahiago",
+  "gizonak",
+  "mugitu",
+  "osoan",
+  "inguruan",
+  "badago",
+  "tori",
+  "atzetik",
+  "gerra",
+  "egoera",
+  "edan",
+  "aurkituko",
+  "gai",
+  "ondoan",
+  "hutsa",
+  "ninduen",
+  "deituko",
+  "demontre",
+  "bide",
+  "ai",
+  "arazo",
+  "arraio",
+  "horra",
+  "jaunak",
+  "zaituzte",
+  "barru",
+  "falta",
+  "hortik",
+  "nirea",
+  "atsegin",
+  "goaz",
+  "modu",
+  "zuzen",
+  "ikasi",
+  "ikustera",
+  "kanpora",
+  "daki",
+  "sinetsi",
+  "buruan",
+  "ordaindu",
+  "hilabete",
+  "dezakegu",
+  "milesker",
+  "honekin",
+  "egotea",
+  "haien",
+  "ixo",
+  "gurekin",
+  "zituzten",
+  "saiatzen",
+  "e",
+  "irakurri",
+  "jaitsi",
+  "zabiltza",
+  "arraioa",
+  "egindako",
+  "beren",
+  "badugu",
+  "john",
+  "kontra",
+  "min",
+  "bezalakoa",
+  "arren",
+  "hurrengo",
+  "milioi",
+  "neu",
+  "merezi",
+  "egitera",
+  "sei",
+  "zaitezke",
+  "eduki",
+  "bigarren",
+  "joateko",
+  "moztu",
+  "edozein",
+  "ikus",
+  "errua",
+  "new",
+  "ukitu",
+  "bakean",
+  "kontatu",
+  "gertatuko",
+  "seme",
+  "zeren",
+  "zeuk",
+  "ospa",
+  "onartu",
+  "digu",
+  "goizean",
+  "esateko",
+  "sinesten",
+  "ezazue",
+  "zenidan",
+  "izugarri",
+  "lortuko",
+  "onak",
+  "eskerrak",
+  "erabiltzen",
+  "jaten",
+  "diet",
+  "horretaz",
+  "apur",
+  "nagusia",
+  "ergela",
+  "bazara",
+  "jarraitzen",
+  "ordua",
+  "aritu",
+  "toki",
+  "har",
+  "hobea",
+  "oker",
+  "autoa",
+  "erraza",
+  "aurka",
+  "pikutara",
+  "zaindu",
+  "erabat",
+  "bete",
+  "delako",
+  "gisa",
+  "dugula",
+  "aste",
+  "betiko",
+  "doktorea",
+  "agindu",
+  "txikia",
+  "neskak",
+  "nondik",
+  "dudana",
+  "arazoa",
+  "gertu",
+  "denek",
+  "bihurtu",
+  "bezalako",
+  "dizute",
+  "naute",
+  "genuke",
+  "begiak",
+  "nuela",
+  "ezkondu",
+  "eguna",
+  "esku",
+  "bihotza",
+  "lasaitu",
+  "denean",
+  "nagusi",
+  "esnatu",
+  "gaitezen",
+  "izana",
+  "zeu",
+  "garbi",
+  "atsegina",
+  "musika",
+  "eskuak",
+  "gogoko",
+  "atzo",
+  "nabil",
+  "borroka",
+  "gaitu",
+  "gogoan",
+  "hasiko",
+  "esaiozu",
+  "zurea",
+  "askoz",
+  "zutaz",
+  "askatu",
+  "gorroto",
+  "itxoin",
+  "nekien",
+  "talde",
+  "sartuko",
+  "nitaz",
+  "zinela",
+  "honi",
+  "bale",
+  "mundua",
+  "gogoratu",
+  "soilik",
+  "gezurra",
+  "pasatu",
+  "erori",
+  "sentitu",
+  "mina",
+  "zeuden",
+  "maitasuna",
+  "aurre",
+  "umeak",
+  "zenuela",
+  "utz",
+  "azpitituluak",
+  "gogorra",
+  "egizu",
+  "dadila",
+  "gazte",
+  "arma",
+  "naiteke",
+  "hartan",
+  "sortu",
+  "zaudete",
+  "dutela",
+  "huts",
+  "ura",
+  "arraroa",
+  "munduko",
+  "pare",
+  "harry",
+  "zorte",
+  "izen",
+  "pasatzen",
+  "jantzi",
+  "bart",
+  "halako",
+  "ikusteko",
+  "egina",
+  "argia",
+  "gaituzte",
+  "garrantzitsua",
+  "the",
+  "zin",
+  "gogor",
+  "dituen",
+  "aurkitzen",
+  "eh",
+  "itzazu",
+  "banekien",
+  "baliteke",
+  "zehar",
+  "saldu",
+  "anderea",
+  "bidean",
+  "laguntzen",
+  "salbatu",
+  "erre",
+  "bidea",
+  "egunero",
+  "zertaz",
+  "nintzela",
+  "horretarako",
+  "eskua",
+  "ordea",
+  "ezingo",
+  "prestatu",
+  "zaitezte",
+  "amets",
+  "aurpegia",
+  "esatea",
+  "ikustea",
+  "dezake",
+  "eraso",
+  "andereñoa",
+  "zitzaidan",
+  "senarra",
+  "banu",
+  "ekarriko",
+  "motel",
+  "gustatuko",
+  "izugarria",
+  "galtzen",
+  "emateko",
+  "etortzen",
+  "joatea",
+  "berriak",
+  "joe",
+  "hementxe",
+  "arazoak",
+  "jainkoak",
+  "bueno",
+  "zorionak",
+  "hark",
+  "gabeko",
+  "hauxe",
+  "hamar",
+  "bilatu",
+  "buruari",
+  "egunean",
+  "gustuko",
+  "txanda",
+  "mutiko",
+  "garbitu",
+  "ur",
+  "heriotza",
+  "genituen",
+  "libre",
+  "garai",
+  "behintzat",
+  "lapurtu",
+  "kasu",
+  "duzunean",
+  "dizkizut",
+  "arazorik",
+  "aipatu",
+  "liteke",
+  "azpian",
+  "edozer",
+  "madarikatua",
+  "dagoeneko",
+  "gorde",
+  "joko",
+  "inori",
+  "eginda",
+  "haserre",
+  "baldin",
+  "auto",
+  "begiratzen",
+  "hitza",
+  "laguntzarekin",
+  "bitxia",
+  "gutxiago",
+  "desagertu",
+  "isilik",
+  "batere",
+  "ezinezkoa",
+  "zegoela",
+  "erdi",
+  "asmatu",
+  "zaudela",
+  "kapitaina",
+  "konpondu",
+  "aukeratu",
+  "telefonoa",
+  "david",
+  "parte",
+  "batzuek",
+  "barre",
+  "jota",
+  "garela",
+  "zitzaion",
+  "botatzen",
+  "berean",
+  "esadazu",
+  "odola",
+  "aitaren",
+  "erakutsiko",
+  "hanka",
+  "george",
+  "ustez",
+  "hasten",
+  "idazten",
+  "kanpo",
+  "zintudan",
+  "diat",
+  "jainkoarren",
+  "jaio",
+  "berezia",
+  "ergel",
+  "batetik",
+  "liburu",
+  "zaitugu",
+  "bikain",
+  "zenean",
+  "egokia",
+  "hortxe",
+  "arteko",
+  "handiak",
+  "konturatu",
+  "erregea",
+  "zabaldu",
+  "zidaten",
+  "onartzen",
+  "hizkuntza",
+  "bizkor",
+  "zizun",
+  "ederto",
+  "gutxienez",
+  "hiri",
+  "zaituztet",
+  "eragin",
+  "osaba",
+  "nator",
+  "burutik",
+  "isildu",
+  "zaigu",
+  "konforme",
+  "eusko",
+  "badira",
+  "guztietan",
+  "berari",
+  "agertu",
+  "arabera",
+  "estatu",
+  "arrazoia",
+  "galdetzen",
+  "barrura",
+  "arropa",
+  "poliziak",
+  "ordainduko",
+  "badaki",
+  "umea",
+  "adi",
+  "max",
+  "mike",
+  "zahar",
+  "eramaten",
+  "harro",
+  "dituzue",
+  "zuzenean",
+  "beldurra",
+  "festa",
+  "beharrik",
+  "igaro",
+  "buruzko",
+  "dakigu",
+  "atxilotu",
+  "emadazu",
+  "luzea",
+  "urteko",
+  "jainko",
+  "goian",
+  "baduzue",
+  "inporta",
+  "historia",
+  "benga",
+  "jarraituko",
+  "guztiek",
+  "jokatu",
+  "biak",
+  "zelan",
+  "zioten",
+  "lortzen",
+  "gaitezke",
+  "errege",
+  "mota",
+  "txantxetan",
+  "eder",
+  "ordaintzen",
+  "digute",
+  "bidaia",
+  "gainetik",
+  "negar",
+  "hortaz",
+  "zaizkit",
+  "dizugu",
+  "itzultzen",
+  "dezala",
+  "urrun",
+  "bidaliko",
+  "hizketan",
+  "botako",
+  "hiltzeko",
+  "haur",
+  "datorren",
+  "astean",
+  "haiz",
+  "goiz",
+  "zor",
+  "zuena",
+  "zati",
+  "iritsiko",
+  "lekuan",
+};
+const uint16_t WA_FREQ_40_RANKS[] = {
+  0, 0, 0, 0, 580, 0, 721, 0, 0, 51, 413, 265, 641, 864, 0, 852,
+  0, 0, 0, 0, 0, 0, 0, 80, 0, 298, 768, 0, 0, 373, 305, 0,
+  965, 153, 0, 0, 0, 0, 263, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 143, 0, 408, 463, 664, 0, 0, 0, 0, 0, 0, 0, 0,
+  426, 962, 377, 130, 751, 788, 0, 575, 499, 584, 538, 597, 459, 0, 495, 724,
+  0, 0, 211, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 60, 684,
+  0, 0, 650, 141, 658, 0, 0, 0, 0, 520, 372, 786, 0, 0, 0, 283,
+  0, 0, 0, 0, 0, 20, 0, 0, 0, 0, 0, 873, 270, 0, 0, 294,
+  0, 0, 0, 0, 637, 950, 682, 0, 0, 0, 0, 0, 737, 360, 152, 293,
+  464, 748, 602, 912, 0, 186, 149, 72, 330, 569, 826, 999, 0, 0, 0, 0,
+  0, 0, 0, 857, 378, 559, 250, 0, 0, 0, 48, 518, 578, 618, 0, 714,
+  361, 203, 447, 734, 267, 132, 0, 473, 774, 0, 0, 239, 68, 941, 121, 0,
+  722, 411, 0, 0, 69, 0, 0, 352, 0, 0, 0, 419, 591, 83, 0, 70,
+  18, 927, 77, 42, 910, 375, 918, 609, 692, 248, 713, 0, 869, 0, 0, 0,
+  0, 0, 309, 397, 758, 287, 915, 0, 0, 0, 0, 0, 660, 0, 0, 0,
+  0, 0, 661, 180, 0, 0, 0, 39, 635, 0, 0, 0, 946, 0, 0, 0,
+  0, 0, 644, 0, 979, 974, 900, 0, 0, 886, 0, 0, 0, 563, 0, 0,
+  56, 58, 0, 0, 0, 0, 0, 0, 776, 870, 0, 0, 220, 0, 0, 953,
+  0, 0, 746, 0, 384, 620, 0, 0, 331, 690, 0, 723, 0, 0, 502, 0,
+  0, 0, 0, 0, 0, 0, 0, 957, 691, 443, 0, 0, 0, 0, 0, 0,
+  0, 718, 727, 508, 219, 363, 0, 995, 394, 289, 0, 245, 150, 0, 0, 0,
+  322, 0, 341, 241, 0, 0, 0, 606, 0, 0, 683, 0, 0, 535, 0, 0,
+  764, 304, 27, 0, 695, 161, 925, 0, 0, 879, 554, 0, 988, 0, 0, 780,
+  45, 327, 357, 207, 214, 0, 0, 0, 809, 0, 295, 0, 0, 0, 0, 528,
+  0, 0, 350, 332, 944, 0, 59, 0, 0, 0, 472, 0, 0, 286, 841, 355,
+  367, 0, 0, 0, 0, 0, 534, 622, 257, 303, 422, 486, 558, 600, 159, 200,
+  0, 849, 492, 311, 906, 0, 24, 0, 0, 398, 480, 0, 0, 0, 95, 455,
+  0, 0, 562, 284, 374, 916, 698, 0, 0, 0, 0, 0, 0, 0, 170, 532,
+  824, 0, 0, 0, 0, 0, 895, 517, 364, 510, 0, 307, 36, 739, 0, 228,
+  0, 651, 0, 0, 0, 985, 0, 0, 61, 0, 215, 961, 0, 0, 234, 897,
+  490, 799, 146, 832, 938, 201, 461, 613, 0, 0, 0, 0, 340, 789, 760, 0,
+  0, 0, 81, 204, 0, 801, 0, 63, 769, 792, 0, 0, 88, 0, 0, 92,
+  217, 196, 462, 686, 0, 111, 0, 0, 0, 0, 202, 278, 917, 0, 516, 346,
+  0, 0, 0, 0, 0, 524, 438, 757, 615, 0, 0, 0, 0, 3, 67, 99,
+  964, 967, 0, 97, 452, 336, 259, 471, 354, 729, 0, 0, 0, 733, 0, 0,
+  0, 0, 177, 382, 440, 604, 572, 738, 0, 0, 706, 0, 0, 0, 0, 743,
+  151, 482, 0, 0, 0, 0, 171, 0, 0, 448, 0, 994, 0, 652, 1000, 0,
+  0, 0, 0, 182, 91, 359, 984, 0, 0, 0, 0, 0, 0, 420, 0, 457,
+  530, 544, 716, 971, 0, 521, 617, 0, 875, 105, 453, 0, 0, 703, 0, 898,
+  0, 0, 0, 670, 0, 0, 342, 49, 319, 0, 0, 871, 261, 0, 0, 0,
+  0, 525, 268, 573, 0, 0, 0, 0, 0, 0, 187, 0, 0, 0, 0, 592,
+  712, 894, 128, 162, 0, 264, 765, 129, 829, 425, 356, 811, 198, 901, 655, 316,
+  890, 940, 0, 685, 0, 0, 0, 0, 909, 0, 140, 926, 0, 0, 0, 40,
+  0, 0, 0, 550, 190, 0, 0, 184, 43, 423, 28, 540, 681, 0, 0, 0,
+  0, 0, 0, 0, 0, 365, 353, 547, 0, 0, 0, 288, 0, 707, 860, 889,
+  349, 0, 0, 0, 656, 89, 119, 679, 390, 277, 747, 387, 756, 1, 392, 753,
+  466, 847, 0, 0, 719, 0, 0, 797, 0, 0, 0, 0, 0, 157, 163, 945,
+  636, 0, 74, 599, 0, 238, 301, 595, 775, 388, 0, 902, 235, 576, 0, 0,
+  0, 274, 511, 251, 444, 728, 793, 275, 0, 0, 0, 0, 523, 820, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 731, 65, 816, 0,
+  0, 403, 0, 608, 0, 0, 0, 977, 590, 0, 229, 539, 475, 300, 456, 642,
+  805, 308, 269, 694, 930, 693, 326, 783, 318, 442, 280, 603, 155, 271, 653, 876,
+  968, 0, 0, 30, 0, 279, 370, 907, 0, 197, 0, 0, 0, 766, 401, 922,
+  0, 0, 0, 855, 0, 134, 0, 0, 0, 0, 515, 0, 0, 0, 717, 846,
+  0, 828, 402, 432, 0, 0, 0, 449, 53, 677, 400, 854, 0, 0, 911, 0,
+  0, 0, 542, 0, 0, 0, 0, 0, 347, 266, 0, 0, 380, 990, 348, 102,
+  0, 893, 0, 0, 0, 0, 0, 551, 899, 689, 513, 956, 0, 543, 213, 0,
+  0, 0, 0, 0, 0, 0, 782, 0, 0, 0, 0, 0, 0, 0, 232, 485,
+  487, 501, 0, 5, 966, 0, 626, 0, 145, 233, 237, 951, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 522, 0, 0, 0, 0, 0, 0, 742, 0, 0,
+  0, 850, 0, 212, 0, 16, 0, 0, 0, 0, 0, 299, 851, 133, 421, 0,
+  0, 0, 0, 258, 0, 0, 0, 0, 0, 0, 819, 509, 179, 343, 859, 887,
+  0, 0, 446, 0, 0, 0, 282, 0, 0, 827, 574, 845, 896, 82, 935, 884,
+  500, 0, 227, 527, 0, 0, 531, 708, 0, 0, 0, 0, 189, 0, 0, 0,
+  881, 243, 0, 0, 0, 0, 46, 0, 0, 0, 493, 0, 32, 325, 541, 285,
+  996, 0, 888, 0, 0, 0, 0, 0, 0, 0, 0, 830, 992, 702, 376, 0,
+  807, 494, 623, 404, 955, 710, 0, 761, 0, 607, 0, 0, 0, 931, 908, 834,
+  477, 310, 0, 0, 0, 0, 796, 0, 29, 0, 0, 0, 0, 469, 484, 648,
+  699, 0, 552, 383, 0, 35, 0, 7, 0, 34, 771, 0, 659, 0, 0, 667,
+  813, 904, 0, 0, 0, 178, 0, 199, 0, 0, 0, 0, 0, 939, 555, 0,
+  0, 755, 0, 720, 0, 919, 0, 770, 0, 0, 0, 0, 0, 0, 0, 0,
+  120, 406, 0, 843, 0, 0, 0, 468, 164, 0, 639, 0, 0, 0, 0, 973,
+  321, 625, 803, 0, 665, 649, 0, 0, 222, 0, 0, 0, 433, 762, 784, 193,
+  750, 414, 537, 37, 588, 548, 790, 978, 0, 328, 0, 0, 0, 33, 0, 0,
+  174, 0, 730, 0, 937, 0, 8, 489, 256, 135, 389, 711, 498, 0, 577, 0,
+  0, 0, 418, 52, 329, 223, 794, 654, 362, 858, 0, 0, 0, 0, 0, 0,
+  0, 0, 593, 0, 71, 117, 0, 139, 226, 932, 514, 0, 0, 107, 124, 0,
+  583, 0, 0, 313, 785, 0, 0, 324, 0, 503, 952, 246, 767, 0, 0, 512,
+  0, 533, 0, 863, 815, 0, 0, 191, 0, 0, 9, 216, 993, 416, 745, 0,
+  959, 168, 0, 407, 0, 0, 0, 19, 0, 410, 0, 0, 0, 0, 0, 296,
+  0, 0, 0, 100, 878, 0, 208, 244, 0, 640, 465, 628, 598, 853, 0, 108,
+  616, 672, 0, 0, 210, 460, 0, 0, 185, 0, 0, 0, 31, 0, 546, 0,
+  0, 0, 0, 0, 0, 0, 0, 450, 566, 0, 0, 0, 104, 0, 0, 0,
+  0, 0, 0, 0, 0, 393, 0, 156, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 646, 921, 0, 224, 0, 557, 835, 75, 173,
+  627, 0, 0, 0, 0, 0, 136, 740, 172, 0, 158, 754, 868, 0, 0, 579,
+  478, 763, 0, 0, 0, 0, 0, 0, 0, 0, 676, 0, 0, 0, 368, 505,
+  949, 0, 744, 0, 963, 127, 57, 351, 969, 451, 337, 0, 0, 142, 0, 94,
+  79, 0, 0, 0, 0, 41, 73, 678, 536, 980, 0, 50, 439, 496, 506, 696,
+  823, 928, 0, 0, 0, 87, 934, 982, 0, 0, 0, 504, 596, 379, 777, 0,
+  808, 0, 0, 0, 386, 0, 292, 0, 0, 218, 488, 0, 497, 205, 662, 0,
+  335, 0, 643, 0, 165, 647, 339, 0, 0, 0, 0, 0, 0, 942, 0, 302,
+  0, 160, 874, 0, 924, 0, 0, 0, 169, 385, 883, 317, 395, 6, 987, 0,
+  0, 675, 903, 312, 885, 0, 802, 844, 0, 175, 0, 0, 0, 0, 435, 0,
+  85, 131, 704, 0, 0, 0, 0, 666, 880, 0, 986, 0, 0, 0, 0, 470,
+  821, 467, 0, 0, 0, 147, 0, 0, 0, 0, 0, 837, 0, 0, 668, 315,
+  798, 981, 705, 96, 749, 314, 0, 568, 10, 125, 138, 22, 882, 262, 923, 948,
+  0, 0, 0, 0, 0, 0, 0, 564, 4, 0, 122, 0, 0, 112, 441, 839,
+  0, 663, 391, 954, 0, 334, 701, 0, 0, 0, 0, 0, 0, 0, 230, 905,
+  0, 0, 0, 0, 0, 976, 23, 0, 0, 0, 0, 612, 715, 0, 276, 0,
+  0, 0, 0, 0, 62, 17, 0, 556, 814, 958, 55, 0, 0, 431, 0, 787,
+  454, 0, 0, 633, 167, 0, 594, 0, 15, 0, 428, 657, 0, 101, 545, 0,
+  0, 634, 106, 290, 0, 366, 560, 118, 624, 291, 998, 0, 0, 0, 0, 0,
+  0, 0, 0, 601, 810, 0, 0, 0, 817, 831, 76, 344, 507, 840, 0, 0,
+  26, 0, 0, 12, 0, 585, 0, 242, 0, 84, 920, 972, 0, 582, 0, 0,
+  0, 0, 0, 0, 260, 0, 0, 0, 0, 0, 759, 818, 638, 838, 872, 929,
+  975, 529, 736, 0, 0, 0, 989, 0, 936, 709, 0, 0, 381, 0, 66, 0,
+  0, 0, 0, 483, 0, 254, 0, 0, 114, 333, 14, 474, 804, 0, 0, 778,
+  0, 0, 865, 11, 0, 479, 0, 0, 424, 614, 0, 0, 0, 0, 0, 0,
+  0, 586, 0, 0, 0, 567, 0, 371, 671, 109, 369, 399, 773, 0, 0, 0,
+  0, 0, 412, 732, 621, 0, 0, 281, 430, 0, 0, 0, 0, 0, 526, 78,
+  619, 0, 0, 0, 116, 519, 549, 0, 570, 960, 0, 0, 0, 0, 0, 0,
+  0, 0, 867, 0, 0, 0, 0, 103, 0, 126, 247, 249, 38, 183, 323, 700,
+  0, 13, 589, 90, 0, 914, 0, 0, 0, 47, 236, 0, 0, 192, 0, 0,
+  0, 358, 836, 0, 0, 0, 338, 791, 0, 943, 561, 680, 781, 231, 800, 0,
+  0, 688, 697, 779, 0, 0, 0, 0, 0, 0, 772, 0, 206, 491, 54, 571,
+  0, 0, 0, 0, 148, 611, 415, 645, 437, 0, 0, 0, 825, 0, 115, 427,
+  806, 991, 409, 0, 0, 0, 0, 0, 221, 137, 176, 553, 848, 255, 856, 726,
+  877, 0, 0, 273, 481, 795, 64, 110, 0, 0, 195, 458, 188, 687, 822, 21,
+  320, 194, 0, 0, 812, 181, 0, 0, 0, 0, 0, 997, 2, 669, 0, 0,
+  892, 933, 0, 93, 630, 0, 0, 0, 0, 0, 123, 240, 632, 947, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 436, 629, 0, 725,
+  0, 752, 113, 0, 0, 673, 272, 0, 0, 0, 0, 434, 209, 833, 0, 0,
+  0, 0, 0, 0, 0, 429, 0, 0, 0, 0, 0, 735, 345, 565, 476, 0,
+  0, 0, 970, 0, 297, 0, 0, 0, 866, 0, 0, 154, 44, 0, 0, 0,
+  674, 86, 605, 0, 445, 0, 0, 253, 0, 0, 0, 225, 631, 0, 252, 581,
+  610, 306, 0, 25, 0, 405, 861, 983, 0, 396, 0, 0, 0, 0, 0, 0,
+  0, 417, 862, 0, 0, 0, 166, 842, 741, 0, 913, 98, 587, 891, 0, 0,
+};
+
+const char *WA_FREQ_41_TOKENS[] = {
+  "،",
+  "که",
+  "رو",
+  "من",
+  "به",
+  "و",
+  "تو",
+  "از",
+  "اون",
+  "اين",
+  "يه",
+  "مي",
+  "با",
+  "در",
+  "نه",
+  "ما",
+  "هم",
+  "بود",
+  "کنم",
+  "باشه",
+  "تا",
+  "ها",
+  "چي",
+  "بايد",
+  "خيلي",
+  "فکر",
+  "آره",
+  "یه",
+  "این",
+  "براي",
+  "خب",
+  "فقط",
+  "کن",
+  "می",
+  "شما",
+  "همه",
+  "اگه",
+  "داره",
+  "ديگه",
+  "شده",
+  "دارم",
+  "کار",
+  "اينجا",
+  "نيست",
+  "چه",
+  "پس",
+  "اما",
+  "ي",
+  "نمي",
+  "چرا",
+  "خوب",
+  "کنه",
+  "کردم",
+  "چيزي",
+  "کني",
+  "حالا",
+  "ولي",
+  "الان",
+  "توي",
+  "هر",
+  "اونا",
+  "اي",
+  "هاي",
+  "داري",
+  "شد",
+  "يک",
+  "اوه",
+  "منو",
+  "ميشه",
+  "بهت",
+  "بچه",
+  "هست",
+  "بهم",
+  "مثل",
+  "بهش",
+  "وقتي",
+  "دوست",
+  "دست",
+  "ميکنم",
+  "باید",
+  "خیلی",
+  "بده",
+  "کرد",
+  "حرف",
+  "چی",
+  "خونه",
+  "يا",
+  "کنيم",
+  "واسه",
+  "بله",
+  "کرده",
+  "سلام",
+  "کردن",
+  "خوبه",
+  "برای",
+  "چون",
+  "برو",
+  "را",
+  "چيه",
+  "اينکه",
+  "هيچ",
+  "اونجا",
+  "بعد",
+  "بودم",
+  "كه",
+  "انجام",
+  "درست",
+  "همين",
+  "هستم",
+  "پيدا",
+  "دو",
+  "داشته",
+  "ميکني",
+  "وقت",
+  "است",
+  "هي",
+  "بشه",
+  "دیگه",
+  "يکي",
+  "بيا",
+  "نداره",
+  "خودت",
+  "هنوز",
+  "منم",
+  "سر",
+  "ميخوام",
+  "کردي",
+  "نیست",
+  "روز",
+  "ميکنه",
+  "بيرون",
+  "کجا",
+  "مورد",
+  "اینجا",
+  "درسته",
+  "ولی",
+  "کسي",
+  "ممنون",
+  "واقعا",
+  "کي",
+  "تمام",
+  "راه",
+  "باش",
+  "پيش",
+  "ميدوني",
+  "تنها",
+  "مرد",
+  "داريم",
+  "شايد",
+  "چند",
+  "خودم",
+  "نظر",
+  "چيز",
+  "بوده",
+  "کاري",
+  "سال",
+  "کمک",
+  "بدم",
+  "بريم",
+  "روي",
+  "کنی",
+  "دوباره",
+  "مياد",
+  "چیزی",
+  "زندگي",
+  "نمی",
+  "گفتم",
+  "ميخواي",
+  "بگو",
+  "چطور",
+  "بگم",
+  "نگاه",
+  "اونو",
+  "هستي",
+  "توی",
+  "گفت",
+  "گوش",
+  "اينه",
+  "صحبت",
+  "پسر",
+  "قبل",
+  "آدم",
+  "برم",
+  "دارن",
+  "اينو",
+  "شروع",
+  "کنيد",
+  "هستن",
+  "دونم",
+  "خوام",
+  "ای",
+  "هميشه",
+  "بر",
+  "خانم",
+  "قرار",
+  "های",
+  "ام",
+  "حال",
+  "بي",
+  "تموم",
+  "پول",
+  "کنن",
+  "شدم",
+  "داشتم",
+  "خدا",
+  "نفر",
+  "بار",
+  "ميدونم",
+  "بيشتر",
+  "ببين",
+  "آقاي",
+  "باشم",
+  "میشه",
+  "صبر",
+  "درباره",
+  "همون",
+  "تونم",
+  "خاطر",
+  "امروز",
+  "داری",
+  "یک",
+  "شدن",
+  "وجود",
+  "قربان",
+  "شب",
+  "ازش",
+  "دختر",
+  "اگر",
+  "استفاده",
+  "داشت",
+  "باشي",
+  "ممکنه",
+  "خودش",
+  "مردم",
+  "بدون",
+  "البته",
+  "چيکار",
+  "وقتی",
+  "ـه",
+  "سه",
+  "مگه",
+  "کنیم",
+  "ساعت",
+  "باز",
+  "بزرگ",
+  "چقدر",
+  "حتي",
+  "بازي",
+  "ندارم",
+  "بودن",
+  "برات",
+  "خواهش",
+  "خوش",
+  "باهاش",
+  "خوبي",
+  "بدي",
+  "دنبال",
+  "اسم",
+  "نکن",
+  "کم",
+  "شو",
+  "نبود",
+  "پدر",
+  "بالا",
+  "متاسفم",
+  "آماده",
+  "یا",
+  "ازت",
+  "زنگ",
+  "بذار",
+  "میکنم",
+  "زنده",
+  "بابا",
+  "بخاطر",
+  "لعنتي",
+  "عزيزم",
+  "ميتونم",
+  "اول",
+  "داد",
+  "جا",
+  "مامان",
+  "ميتوني",
+  "زن",
+  "؛",
+  "کجاست",
+  "نميدونم",
+  "اینکه",
+  "او",
+  "واقعاً",
+  "کنار",
+  "دور",
+  "بعدش",
+  "ميگم",
+  "ست",
+  "داده",
+  "اونها",
+  "زود",
+  "تر",
+  "برام",
+  "خبر",
+  "بهتر",
+  "زمان",
+  "ببخشيد",
+  "منه",
+  "شهر",
+  "اتفاق",
+  "بودي",
+  "ميدم",
+  "باعث",
+  "اجازه",
+  "بزن",
+  "يعني",
+  "منظورم",
+  "طرف",
+  "نشون",
+  "لطفا",
+  "دکتر",
+  "چیه",
+  "هی",
+  "نگه",
+  "ببينم",
+  "نيستم",
+  "همین",
+  "پیدا",
+  "بهتره",
+  "نميتونم",
+  "آروم",
+  "مهم",
+  "سعي",
+  "یکی",
+  "اصلا",
+  "میکنی",
+  "لحظه",
+  "کردی",
+  "حالت",
+  "خداي",
+  "اش",
+  "دادم",
+  "بري",
+  "جواب",
+  "قراره",
+  "پشت",
+  "فرار",
+  "آب",
+  "خون",
+  "نجات",
+  "هیچ",
+  "صبح",
+  "ماشين",
+  "هفته",
+  "مال",
+  "کرديم",
+  "کنين",
+  "رفته",
+  "کارو",
+  "لازم",
+  "باور",
+  "بزنم",
+  "هيچي",
+  "بين",
+  "احساس",
+  "ميده",
+  "جايي",
+  "ادامه",
+  "بد",
+  "بره",
+  "کسی",
+  "اتاق",
+  "میکنه",
+  "دوني",
+  "داخل",
+  "گفتي",
+  "اشتباه",
+  "شدي",
+  "نگران",
+  "خانواده",
+  "مشکل",
+  "نميشه",
+  "ميکنيم",
+  "سمت",
+  "توني",
+  "هيچوقت",
+  "امشب",
+  "چطوري",
+  "اومده",
+  "بیرون",
+  "وارد",
+  "اومد",
+  "کی",
+  "میخوام",
+  "بیا",
+  "اتفاقي",
+  "انتخاب",
+  "شاید",
+  "ازدواج",
+  "گرفته",
+  "آه",
+  "زيادي",
+  "ميخواد",
+  "داریم",
+  "برنامه",
+  "خواي",
+  "کاری",
+  "جاي",
+  "ميگي",
+  "باهات",
+  "میدونی",
+  "چطوره",
+  "نياز",
+  "بهشون",
+  "ميتونه",
+  "اينا",
+  "پليس",
+  "نبايد",
+  "گفته",
+  "دادن",
+  "دقيقه",
+  "بکنم",
+  "دنيا",
+  "پیش",
+  "اره",
+  "ماه",
+  "حق",
+  "يالا",
+  "فردا",
+  "اندازه",
+  "دار",
+  "حمله",
+  "بشم",
+  "زياد",
+  "زمين",
+  "کدوم",
+  "ياد",
+  "پايين",
+  "شه",
+  "متوجه",
+  "مطمئن",
+  "رفت",
+  "مرگ",
+  "ميرم",
+  "نقشه",
+  "عوض",
+  "اعتماد",
+  "ميکنن",
+  "قول",
+  "تازه",
+  "جنگ",
+  "هستند",
+  "تماس",
+  "افتاده",
+  "ممنونم",
+  "انگار",
+  "بگي",
+  "حرکت",
+  "حس",
+  "ميکردم",
+  "بریم",
+  "موقع",
+  "مادر",
+  "آن",
+  "کارت",
+  "دروغ",
+  "روی",
+  "ميگه",
+  "گم",
+  "لباس",
+  "جور",
+  "گرفتم",
+  "بياد",
+  "رفيق",
+  "عشق",
+  "تونه",
+  "اولين",
+  "همچين",
+  "هرگز",
+  "جان",
+  "قبول",
+  "مرده",
+  "افتاد",
+  "ديدم",
+  "موضوع",
+  "اینه",
+  "میاد",
+  "ازم",
+  "براش",
+  "میخوای",
+  "عنوان",
+  "خود",
+  "هستيم",
+  "بهترين",
+  "حتما",
+  "بهتون",
+  "مشکلي",
+  "كنم",
+  "چیز",
+  "مجبور",
+  "زندگی",
+  "بقيه",
+  "شماره",
+  "منظورت",
+  "خواهد",
+  "منتظر",
+  "کننده",
+  "زده",
+  "عاليه",
+  "اومدم",
+  "گروه",
+  "نشده",
+  "جمع",
+  "عاشق",
+  "احمق",
+  "کنید",
+  "نيستي",
+  "اينکارو",
+  "بگير",
+  "گذشته",
+  "میدونم",
+  "روش",
+  "کاملا",
+  "پرونده",
+  "کل",
+  "مدرسه",
+  "هستی",
+  "اینو",
+  "همیشه",
+  "خوشحالم",
+  "بديم",
+  "بلند",
+  "پر",
+  "ده",
+  "اونم",
+  "رد",
+  "اسلحه",
+  "بیشتر",
+  "چیکار",
+  "آقا",
+  "سخت",
+  "بی",
+  "دادي",
+  "باشن",
+  "هايي",
+  "مطمئنم",
+  "نميخوام",
+  "باشيم",
+  "عقب",
+  "نمياد",
+  "زير",
+  "داستان",
+  "مون",
+  "ات",
+  "ميتونيم",
+  "نباش",
+  "خواد",
+  "باشی",
+  "انجامش",
+  "هستش",
+  "مدت",
+  "آخرين",
+  "درد",
+  "چشم",
+  "ببین",
+  "ميره",
+  "خواستم",
+  "جديد",
+  "کنند",
+  "فراموش",
+  "دلار",
+  "رفتن",
+  "راست",
+  "رئيس",
+  "خارج",
+  "بکني",
+  "حقيقت",
+  "سوال",
+  "همش",
+  "بشي",
+  "قبلا",
+  "توئه",
+  "نداري",
+  "کس",
+  "بسيار",
+  "نزديک",
+  "جدي",
+  "راجع",
+  "همينطور",
+  "خودمون",
+  "خوشحال",
+  "بدن",
+  "غذا",
+  "فكر",
+  "بعضي",
+  "ش",
+  "فيلم",
+  "بخش",
+  "دفعه",
+  "خفه",
+  "اصلاً",
+  "خوشم",
+  "قضيه",
+  "کشته",
+  "جون",
+  "يکم",
+  "طول",
+  "صورت",
+  "بهمون",
+  "زدن",
+  "خوبی",
+  "شبيه",
+  "ترک",
+  "بزار",
+  "قدرت",
+  "افراد",
+  "عالي",
+  "شرکت",
+  "داشتي",
+  "پنج",
+  "اه",
+  "توسط",
+  "دلم",
+  "اينطوري",
+  "حتی",
+  "کنترل",
+  "نميتوني",
+  "بدی",
+  "غير",
+  "تحت",
+  "بس",
+  "دوتا",
+  "خواب",
+  "راستش",
+  "بتونم",
+  "شانس",
+  "بگيرم",
+  "کيه",
+  "عکس",
+  "شليک",
+  "پدرم",
+  "برادر",
+  "اومدي",
+  "مراقب",
+  "اينقدر",
+  "آخر",
+  "بخير",
+  "زد",
+  "حساب",
+  "طور",
+  "كن",
+  "نميکنم",
+  "بدونم",
+  "اينجاست",
+  "بزني",
+  "اسمش",
+  "درک",
+  "خورده",
+  "موفق",
+  "زدم",
+  "واقعي",
+  "نکنم",
+  "گفتن",
+  "راحت",
+  "جلوي",
+  "داشتن",
+  "نکردم",
+  "مبارزه",
+  "زماني",
+  "نمیدونم",
+  "سريع",
+  "لطفاً",
+  "حداقل",
+  "خوبم",
+  "قتل",
+  "ديوونه",
+  "شون",
+  "انسان",
+  "بازم",
+  "ميريم",
+  "ديدي",
+  "پسرم",
+  "گرفتن",
+  "جدا",
+  "اينجوري",
+  "کتاب",
+  "توجه",
+  "صدا",
+  "لعنت",
+  "چهار",
+  "محافظت",
+  "بوديم",
+  "کافي",
+  "نامه",
+  "بازی",
+  "فوق",
+  "ميگن",
+  "تون",
+  "تصميم",
+  "اطلاعات",
+  "ملاقات",
+  "بسته",
+  "دوستت",
+  "شماها",
+  "میتونی",
+  "رابطه",
+  "باشيد",
+  "آقای",
+  "باهم",
+  "کوچولو",
+  "پيداش",
+  "بنظر",
+  "دارين",
+  "بزنه",
+  "آنها",
+  "ميري",
+  "گرفت",
+  "وايسا",
+  "گير",
+  "ميدي",
+  "واي",
+  "بريد",
+  "تغيير",
+  "مونده",
+  "اميدوارم",
+  "ميشم",
+  "تلفن",
+  "زندان",
+  "يادت",
+  "همينه",
+  "ميخواستم",
+  "رفتار",
+  "تيم",
+  "پدرت",
+  "میتونم",
+  "معذرت",
+  "شنيدم",
+  "احتياج",
+  "داريد",
+  "دختره",
+  "لعنتی",
+  "ميام",
+  "نیاز",
+  "بالاخره",
+  "علاقه",
+  "میدم",
+  "ترين",
+  "شکست",
+  "میگم",
+  "نابود",
+  "هدف",
+  "العاده",
+  "سگ",
+  "آيا",
+  "توش",
+  "تونيم",
+  "خسته",
+  "جلو",
+  "صداي",
+  "قسمت",
+  "رفتم",
+  "احتمالا",
+  "واقع",
+  "يارو",
+  "افتخار",
+  "كار",
+  "دقيقا",
+  "ببخشید",
+  "هزار",
+  "مواد",
+  "خراب",
+  "چيزيه",
+  "تکون",
+  "بودی",
+  "عزیزم",
+  "جک",
+  "اينطور",
+  "خداحافظ",
+  "هنوزم",
+  "پا",
+  "باهام",
+  "یعنی",
+  "ميشي",
+  "ميکرد",
+  "نداريم",
+  "ساله",
+  "بگيري",
+  "هات",
+  "ميشن",
+  "اوضاع",
+  "ديده",
+  "آزاد",
+  "نوشته",
+  "نظرت",
+  "کردیم",
+  "عجله",
+  "کامل",
+  "بری",
+  "قابل",
+  "دليل",
+  "همديگه",
+  "پرواز",
+  "بکنه",
+  "مسخره",
+  "عمل",
+  "بيام",
+  "بمون",
+  "بشين",
+  "مادرم",
+  "خط",
+  "نام",
+  "بيار",
+  "ماست",
+  "هاش",
+  "قانون",
+  "معلومه",
+  "پادشاه",
+  "امتحان",
+  "کمکم",
+  "زودباش",
+  "بشن",
+  "خواست",
+  "فرصت",
+  "حتماً",
+  "نباشه",
+  "خودتون",
+  "روشن",
+  "ميزنم",
+  "خطر",
+  "کشور",
+  "چکار",
+  "نیستم",
+  "كني",
+  "سعی",
+  "بياي",
+  "سوار",
+  "دستور",
+  "قلب",
+  "آخه",
+  "بيخيال",
+  "يك",
+  "شام",
+  "اس",
+  "م",
+  "بدست",
+  "لذت",
+  "يادم",
+  "اند",
+  "تلاش",
+  "میده",
+  "فهميدم",
+  "ت",
+  "نمیتونم",
+  "برگرد",
+  "کشتي",
+  "نزن",
+  "مادرت",
+  "شرمنده",
+  "همراه",
+  "جایی",
+  "کمکت",
+  "سرت",
+  "نکرده",
+  "فشار",
+  "دير",
+  "مهمه",
+  "تورو",
+  "گزارش",
+  "اينم",
+  "ترجمه",
+  "کلي",
+  "سري",
+  "داشتيم",
+  "نميتونه",
+  "حاضر",
+  "خبره",
+  "خودتو",
+  "چندتا",
+  "خانوم",
+  "خودشون",
+  "انتظار",
+  "جمهور",
+  "ميان",
+  "هيچکس",
+  "نداشتم",
+  "بزنيم",
+  "شديم",
+  "بین",
+  "جوري",
+  "بخواي",
+  "بگيره",
+  "حدس",
+  "هام",
+  "ببینم",
+  "تنگ",
+  "گرفتي",
+  "ان",
+  "خدايا",
+  "ناراحت",
+  "مامور",
+  "بدين",
+  "بکش",
+  "معامله",
+  "کلمه",
+  "بتونه",
+  "بکن",
+  "تبديل",
+  "دم",
+  "نمیشه",
+  "خوبيه",
+  "اونوقت",
+  "بياين",
+  "گفتی",
+  "حل",
+  "روح",
+  "برنده",
+  "نفس",
+  "دونه",
+  "ببيني",
+  "ببر",
+  "آينده",
+  "میکنیم",
+  "کند",
+  "سفر",
+  "نداشته",
+  "مردي",
+  "آتش",
+  "قبلاً",
+  "پيشنهاد",
+  "شوخي",
+  "سرم",
+  "قهوه",
+  "قاتل",
+  "ارزش",
+  "شرط",
+  "شدی",
+  "مواظب",
+  "چطوری",
+  "ول",
+  "مشروب",
+  "کنین",
+  "جشن",
+  "منطقه",
+  "مخفي",
+  "بکشه",
+  "نميکنه",
+  "متأسفم",
+  "کشتن",
+  "کردند",
+  "ماشین",
+  "نگو",
+  "درمورد",
+  "بگه",
+  "جو",
+  "قطع",
+  "ميرسه",
+  "ميزني",
+  "میکنن",
+  "هیچوقت",
+  "کاملاً",
+  "صدمه",
+  "مسابقه",
+  "اتفاقی",
+  "ساده",
+  "طبقه",
+  "مارو",
+  "حالش",
+  "اومدن",
+  "سخته",
+  "حرومزاده",
+  "شش",
+  "چک",
+  "جز",
+  "ثابت",
+  "وسط",
+  "باشين",
+  "بشيم",
+  "زنم",
+  "خدای",
+  "ارتش",
+  "بعدي",
+  "اینا",
+  "سکس",
+  "خوشت",
+  "بيدار",
+  "عوضي",
+  "داداش",
+  "کمي",
+  "کارم",
+  "تمومش",
+  "هیچی",
+  "نداشت",
+  "یکم",
+  "اينکار",
+  "خودشه",
+  "مطمئني",
+  "بيارم",
+  "زمین",
+  "اینکارو",
+  "دستت",
+  "قسم",
+  "نبوده",
+  "بيني",
+  "مراقبت",
+};
+const uint16_t WA_FREQ_41_RANKS[] = {
+  355, 318, 86, 402, 836, 14, 586, 970, 0, 0, 0, 441, 0, 0, 0, 266,
+  0, 210, 0, 0, 249, 0, 0, 790, 0, 0, 75, 0, 0, 434, 0, 909,
+  0, 166, 0, 0, 216, 0, 932, 530, 0, 656, 0, 0, 0, 67, 0, 0,
+  0, 189, 0, 0, 558, 950, 0, 408, 0, 0, 881, 0, 0, 0, 219, 518,
+  619, 0, 0, 598, 0, 0, 0, 21, 930, 521, 162, 292, 176, 784, 0, 0,
+  0, 0, 297, 0, 834, 0, 0, 0, 0, 887, 0, 0, 18, 281, 207, 753,
+  0, 585, 996, 0, 680, 63, 333, 234, 1000, 567, 489, 32, 0, 0, 466, 0,
+  0, 0, 0, 458, 0, 477, 606, 830, 0, 83, 572, 0, 0, 613, 810, 925,
+  126, 428, 299, 597, 0, 0, 848, 0, 227, 0, 0, 244, 782, 224, 933, 0,
+  446, 634, 0, 0, 0, 0, 0, 502, 785, 0, 243, 439, 488, 0, 450, 0,
+  0, 0, 0, 0, 0, 0, 421, 516, 0, 0, 826, 11, 919, 956, 0, 0,
+  363, 0, 0, 0, 0, 0, 0, 0, 98, 0, 465, 0, 0, 0, 0, 841,
+  955, 0, 991, 0, 642, 805, 683, 0, 0, 629, 0, 0, 271, 581, 735, 551,
+  0, 0, 0, 0, 596, 673, 0, 180, 554, 0, 717, 315, 57, 37, 195, 115,
+  302, 317, 389, 182, 305, 420, 457, 583, 594, 799, 587, 335, 672, 169, 969, 304,
+  0, 401, 0, 447, 277, 77, 650, 738, 0, 482, 0, 454, 160, 704, 0, 0,
+  0, 707, 114, 648, 0, 0, 636, 89, 0, 0, 493, 12, 595, 0, 0, 228,
+  0, 485, 0, 36, 0, 712, 0, 891, 0, 0, 81, 117, 0, 0, 0, 0,
+  307, 54, 70, 424, 4, 128, 783, 963, 0, 346, 898, 104, 241, 111, 294, 0,
+  812, 0, 781, 0, 0, 0, 0, 601, 0, 56, 177, 174, 496, 864, 923, 0,
+  472, 272, 0, 0, 0, 0, 517, 413, 0, 0, 0, 0, 0, 438, 202, 0,
+  0, 0, 0, 0, 0, 0, 122, 201, 0, 631, 0, 0, 0, 322, 0, 0,
+  519, 569, 0, 0, 0, 490, 5, 0, 0, 0, 93, 0, 0, 746, 0, 133,
+  0, 0, 0, 827, 658, 0, 341, 0, 711, 603, 94, 795, 936, 397, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 580, 0, 62, 908, 988,
+  95, 0, 0, 0, 0, 381, 862, 0, 0, 0, 0, 0, 0, 0, 453, 770,
+  535, 0, 0, 0, 0, 203, 58, 38, 419, 74, 721, 0, 0, 765, 0, 0,
+  0, 0, 0, 0, 0, 372, 0, 0, 0, 0, 504, 847, 0, 733, 0, 545,
+  0, 0, 757, 0, 0, 0, 125, 0, 0, 0, 348, 0, 0, 0, 0, 0,
+  323, 692, 0, 0, 376, 718, 0, 539, 87, 0, 0, 949, 293, 860, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 149, 0, 158, 0, 578, 977, 703,
+  163, 233, 0, 185, 0, 0, 0, 267, 0, 562, 0, 0, 888, 395, 0, 0,
+  620, 0, 96, 365, 776, 929, 0, 0, 0, 815, 0, 0, 0, 821, 396, 394,
+  0, 0, 199, 0, 0, 0, 0, 0, 352, 308, 416, 0, 0, 0, 0, 0,
+  0, 373, 0, 0, 0, 0, 0, 0, 0, 901, 91, 414, 0, 371, 0, 628,
+  872, 19, 30, 288, 801, 992, 731, 0, 252, 375, 0, 0, 0, 0, 758, 825,
+  0, 455, 173, 500, 560, 197, 940, 88, 561, 0, 0, 0, 822, 971, 0, 0,
+  0, 470, 0, 621, 7, 0, 120, 0, 0, 386, 467, 0, 525, 342, 0, 0,
+  0, 0, 0, 0, 987, 0, 0, 102, 719, 579, 743, 829, 0, 766, 26, 0,
+  0, 0, 398, 0, 461, 0, 0, 13, 813, 0, 156, 78, 135, 230, 611, 237,
+  380, 39, 960, 876, 863, 143, 986, 0, 0, 61, 529, 0, 106, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 137, 23, 0, 0, 623, 702, 0, 0,
+  900, 0, 242, 0, 0, 0, 0, 246, 0, 0, 0, 0, 849, 331, 0, 902,
+  255, 651, 134, 238, 910, 405, 570, 954, 0, 0, 0, 0, 0, 47, 0, 0,
+  0, 452, 896, 215, 0, 0, 359, 274, 0, 481, 646, 0, 0, 409, 262, 0,
+  0, 0, 522, 0, 593, 367, 0, 0, 817, 858, 183, 436, 573, 0, 0, 0,
+  209, 0, 0, 0, 0, 0, 445, 854, 0, 0, 324, 0, 654, 752, 0, 0,
+  16, 0, 0, 0, 0, 393, 886, 460, 0, 159, 178, 725, 952, 0, 994, 0,
+  22, 136, 432, 483, 625, 167, 350, 877, 945, 612, 0, 0, 865, 29, 283, 659,
+  0, 0, 110, 604, 116, 0, 0, 0, 0, 943, 0, 0, 0, 912, 0, 129,
+  918, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  557, 676, 774, 989, 0, 0, 0, 0, 568, 250, 732, 0, 0, 0, 0, 681,
+  0, 0, 0, 492, 0, 0, 0, 0, 0, 541, 92, 958, 0, 0, 0, 0,
+  0, 0, 196, 229, 497, 589, 0, 510, 0, 0, 715, 184, 640, 748, 0, 218,
+  807, 985, 0, 0, 0, 0, 109, 706, 837, 0, 0, 0, 287, 51, 905, 499,
+  937, 0, 599, 914, 0, 68, 0, 730, 0, 0, 0, 980, 0, 563, 0, 0,
+  794, 938, 0, 0, 146, 59, 0, 0, 0, 565, 0, 0, 321, 0, 0, 0,
+  0, 547, 0, 775, 0, 200, 407, 0, 675, 0, 540, 0, 755, 0, 999, 0,
+  415, 0, 0, 456, 0, 0, 0, 0, 750, 475, 339, 165, 382, 791, 0, 0,
+  915, 0, 754, 383, 0, 3, 0, 0, 464, 0, 0, 550, 369, 313, 724, 0,
+  0, 532, 948, 544, 484, 0, 508, 440, 615, 0, 0, 145, 614, 844, 0, 0,
+  0, 0, 0, 789, 0, 0, 0, 141, 0, 378, 0, 819, 6, 736, 875, 966,
+  662, 0, 0, 0, 0, 0, 0, 0, 0, 884, 347, 406, 935, 0, 0, 894,
+  657, 809, 698, 0, 0, 0, 0, 695, 35, 181, 150, 0, 0, 0, 0, 0,
+  0, 616, 696, 27, 0, 693, 0, 0, 0, 635, 0, 0, 749, 0, 0, 0,
+  0, 0, 0, 53, 329, 964, 0, 0, 24, 0, 0, 0, 0, 878, 301, 0,
+  0, 602, 0, 0, 0, 449, 154, 0, 254, 944, 240, 0, 76, 0, 0, 0,
+  344, 556, 257, 310, 147, 334, 778, 0, 0, 976, 0, 0, 0, 737, 0, 0,
+  0, 0, 494, 553, 0, 0, 0, 0, 0, 538, 811, 534, 0, 0, 0, 0,
+  786, 443, 697, 816, 0, 0, 873, 870, 0, 187, 0, 0, 0, 0, 0, 0,
+  498, 592, 311, 431, 609, 0, 0, 0, 0, 0, 946, 0, 0, 0, 0, 0,
+  0, 0, 0, 336, 48, 72, 191, 533, 542, 49, 0, 0, 0, 85, 275, 668,
+  429, 761, 0, 0, 0, 0, 0, 576, 0, 69, 327, 506, 655, 686, 904, 0,
+  0, 486, 349, 0, 132, 495, 839, 802, 265, 285, 524, 248, 564, 868, 851, 0,
+  473, 0, 0, 261, 0, 0, 0, 507, 0, 273, 0, 0, 0, 0, 0, 0,
+  0, 798, 269, 41, 247, 290, 523, 543, 907, 0, 536, 0, 0, 740, 286, 0,
+  527, 0, 198, 479, 788, 0, 0, 295, 537, 922, 0, 0, 0, 208, 0, 0,
+  0, 0, 734, 608, 469, 0, 471, 0, 0, 25, 360, 710, 682, 793, 727, 808,
+  0, 0, 0, 899, 638, 0, 0, 0, 0, 0, 906, 84, 356, 741, 0, 0,
+  0, 390, 0, 0, 0, 689, 385, 0, 0, 155, 503, 720, 853, 0, 0, 0,
+  0, 0, 144, 0, 0, 0, 548, 289, 282, 691, 0, 55, 892, 0, 0, 833,
+  0, 0, 0, 358, 701, 951, 0, 0, 590, 404, 998, 0, 549, 0, 0, 0,
+  0, 0, 773, 861, 0, 399, 0, 0, 797, 0, 973, 531, 40, 0, 0, 953,
+  787, 0, 1, 792, 0, 832, 46, 0, 0, 739, 0, 130, 713, 880, 73, 8,
+  685, 513, 984, 723, 442, 235, 575, 0, 0, 0, 175, 186, 968, 0, 0, 0,
+  0, 205, 10, 319, 0, 0, 889, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 546, 0, 726, 0, 0, 0, 661, 0, 0, 0, 418,
+  0, 0, 0, 101, 633, 526, 882, 0, 0, 514, 652, 0, 0, 0, 0, 142,
+  337, 632, 747, 961, 65, 253, 0, 857, 0, 0, 903, 161, 0, 0, 0, 217,
+  0, 0, 0, 705, 123, 268, 340, 0, 0, 90, 357, 0, 0, 0, 0, 258,
+  338, 0, 0, 0, 0, 0, 0, 82, 437, 859, 0, 0, 644, 0, 326, 0,
+  0, 0, 0, 0, 0, 0, 291, 330, 351, 361, 630, 600, 742, 744, 879, 0,
+  0, 0, 0, 607, 0, 665, 0, 0, 670, 0, 0, 264, 840, 444, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 108, 0, 0, 831,
+  0, 0, 0, 412, 927, 0, 627, 239, 97, 121, 172, 179, 99, 582, 164, 618,
+  639, 835, 0, 0, 0, 171, 124, 759, 425, 0, 0, 674, 276, 555, 0, 0,
+  0, 0, 708, 140, 0, 0, 206, 370, 0, 0, 0, 0, 0, 0, 314, 0,
+  2, 0, 0, 0, 66, 828, 931, 0, 0, 688, 0, 0, 0, 804, 0, 926,
+  387, 0, 883, 0, 0, 192, 0, 983, 0, 0, 0, 9, 842, 0, 942, 0,
+  0, 939, 866, 0, 0, 0, 0, 0, 0, 763, 924, 0, 354, 0, 0, 0,
+  0, 0, 671, 316, 364, 270, 459, 100, 917, 52, 501, 666, 451, 0, 105, 332,
+  279, 377, 588, 148, 138, 584, 328, 694, 911, 0, 80, 0, 756, 0, 663, 591,
+  0, 0, 300, 379, 0, 0, 325, 0, 284, 624, 411, 0, 213, 151, 637, 893,
+  0, 0, 856, 0, 0, 468, 44, 687, 0, 226, 214, 280, 306, 885, 824, 852,
+  0, 0, 220, 0, 0, 669, 0, 0, 28, 0, 780, 463, 0, 131, 577, 345,
+  426, 256, 664, 212, 667, 679, 0, 0, 0, 972, 993, 0, 0, 79, 0, 0,
+  0, 820, 0, 0, 0, 118, 990, 0, 0, 0, 0, 231, 814, 845, 392, 920,
+  965, 0, 0, 0, 0, 0, 309, 641, 699, 913, 0, 0, 0, 0, 236, 320,
+  768, 997, 0, 610, 374, 193, 660, 684, 50, 0, 0, 0, 0, 0, 64, 113,
+  0, 0, 0, 0, 0, 0, 867, 0, 0, 0, 491, 617, 225, 779, 0, 0,
+  298, 232, 260, 391, 478, 188, 764, 0, 0, 0, 700, 574, 921, 15, 0, 941,
+  0, 622, 343, 0, 559, 957, 0, 0, 0, 571, 0, 0, 312, 157, 0, 223,
+  42, 263, 0, 0, 119, 388, 0, 170, 0, 643, 245, 435, 771, 0, 112, 0,
+  0, 0, 0, 362, 0, 0, 0, 0, 0, 427, 448, 0, 153, 871, 0, 0,
+  0, 0, 962, 0, 0, 366, 0, 678, 0, 0, 0, 34, 806, 0, 430, 850,
+  0, 0, 0, 979, 869, 194, 995, 0, 0, 0, 709, 0, 690, 716, 751, 843,
+  384, 0, 474, 0, 0, 0, 0, 0, 0, 0, 0, 566, 31, 605, 874, 0,
+  947, 978, 0, 0, 0, 0, 895, 0, 0, 0, 0, 981, 509, 0, 0, 0,
+  400, 20, 296, 645, 433, 800, 959, 0, 33, 127, 278, 511, 653, 729, 928, 0,
+  512, 0, 0, 368, 0, 505, 168, 818, 0, 0, 417, 423, 767, 0, 103, 0,
+  0, 0, 403, 626, 0, 0, 0, 0, 0, 0, 515, 838, 0, 0, 0, 222,
+  974, 211, 0, 221, 0, 728, 0, 897, 0, 855, 0, 0, 45, 71, 722, 0,
+  0, 0, 0, 0, 0, 0, 43, 152, 422, 982, 0, 0, 796, 0, 476, 0,
+  714, 649, 916, 303, 0, 60, 0, 0, 0, 0, 410, 0, 769, 0, 0, 17,
+  0, 0, 677, 772, 251, 0, 0, 975, 0, 0, 0, 0, 760, 0, 528, 762,
+  0, 0, 0, 934, 353, 0, 0, 0, 0, 0, 0, 0, 0, 0, 190, 0,
+  259, 107, 204, 0, 0, 0, 487, 777, 647, 520, 846, 0, 0, 0, 823, 480,
+  0, 0, 0, 803, 139, 745, 552, 0, 0, 0, 0, 462, 0, 890, 0, 967,
+};
+
+const char *WA_FREQ_42_TOKENS[] = {
+  "e",
+  "ko",
+  "ɓe",
+  "o",
+  "leydi",
+  "Ko",
+  "makko",
+  "on",
+  "no",
+  "laamu",
+  "ɗum",
+  "mo",
+  "ɓen",
+  "ka",
+  "mum",
+  "kadi",
+  "haa",
+  "maɓɓe",
+  "hitaande",
+  "nder",
+  "nden",
+  "nde",
+  "maa",
+  "ngal",
+  "Fulɓe",
+  "woni",
+  "ina",
+  "E",
+  "Fuuta",
+  "fii",
+  "ndin",
+  "Gine",
+  "hino",
+  "kala",
+  "O",
+  "hakkunde",
+  "ngun",
+  "walla",
+  "ɓuri",
+  "ɗen",
+  "ɗin",
+  "en",
+  "fof",
+  "kono",
+  "non",
+  "ndee",
+  "to",
+  "Alla",
+  "oo",
+  "ɓee",
+  "So",
+  "gila",
+  "yimɓe",
+  "Manndelaa",
+  "sabu",
+  "ɗemngal",
+  "debbo",
+  "leyɗe",
+  "men",
+  "ngol",
+  "ɗiɗi",
+  "ɗon",
+  "ɗoo",
+  "Konte",
+  "heen",
+  "si",
+  "yo",
+  "Kono",
+  "fow",
+  "hannde",
+  "gorko",
+  "hoore",
+  "ngam",
+  "wano",
+  "Moolo",
+  "gooto",
+  "lewru",
+  "ANC",
+  "Alfaa",
+  "duuɓi",
+  "oon",
+  "tawii",
+  "ndii",
+  "innde",
+  "kanko",
+  "leƴƴi",
+  "wonaa",
+  "Lansana",
+  "dow",
+  "noon",
+  "waɗi",
+  "Jaloo",
+  "Tuuree",
+  "neɗɗo",
+  "so",
+  "suudu",
+  "tawi",
+  "wuro",
+  "ɓaawo",
+  "baaba",
+  "diina",
+  "fedde",
+  "galle",
+  "ndeen",
+  "ngon",
+  "seeɗa",
+  "wiyi",
+  "Maali",
+  "ene",
+  "jamaa",
+  "maanaa",
+  "wonde",
+  "ɗuum",
+  "ekn",
+  "hay",
+  "nguu",
+  "tan",
+  "toon",
+  "tuma",
+  "Ɗum",
+  "ɓaleeɓe",
+  "Afirik",
+  "Fuladu",
+  "Labe",
+  "Senegal",
+  "fewndo",
+  "hare",
+  "kon",
+  "ndiyam",
+  "ngu",
+  "sahaa",
+  "tawa",
+  "winndere",
+  "Mali",
+  "Nelaaɗo",
+  "fuɗɗii",
+  "jeyaa",
+  "wonnde",
+  "woote",
+  "ɗe",
+  "ɗee",
+  "ɗemɗe",
+  "Bintu",
+  "Hino",
+  "Muusaa",
+  "cortewol",
+  "fuu",
+  "golle",
+  "hooreejo",
+  "koninkooɓe",
+  "laawol",
+  "mayri",
+  "na",
+  "ndi",
+  "omo",
+  "raneeɓe",
+  "woodi",
+  "ɗii",
+  "Caggal",
+  "Farayse",
+  "Gammbi",
+  "Hooreejo",
+  "ana",
+  "caggal",
+  "dewgal",
+  "kasoo",
+  "laamorde",
+  "laatino",
+  "ndun",
+  "nguurndam",
+  "pulaar",
+  "ton",
+  "tun",
+  "waawi",
+  "Afrik",
+  "Alqur’aanaare",
+  "Faransi",
+  "Fulfulde",
+  "Nde",
+  "Pullo",
+  "Tooro",
+  "Yaayaa",
+  "alaa",
+  "geɗe",
+  "he",
+  "heewi",
+  "himo",
+  "huunde",
+  "jam",
+  "jogii",
+  "jommbaajo",
+  "jooni",
+  "kam",
+  "konu",
+  "koo",
+  "laamɗo",
+  "min",
+  "nanndi",
+  "nii",
+  "nyannde",
+  "ɗi",
+  "ɗoon",
+  "Adamaawa",
+  "Almaami",
+  "Bookar",
+  "Ka",
+  "Laamaandi",
+  "Seeku",
+  "Si",
+  "a",
+  "alkule",
+  "apartaayd",
+  "balɗe",
+  "fulfulde",
+  "haala",
+  "hedde",
+  "hono",
+  "kanyum",
+  "laamii",
+  "mon",
+  "mun",
+  "nunɗal",
+  "rewɓe",
+  "yeru",
+  "yoga",
+  "ñalnde",
+  "Ɓe",
+  "Kamarun",
+  "Malle",
+  "Mbertudi",
+  "Misiide",
+  "Muhammadu",
+  "On",
+  "Oon",
+  "am",
+  "bannge",
+  "baŋŋe",
+  "biyeteeɗo",
+  "comci",
+  "de",
+  "deftere",
+  "fonnye",
+  "fooli",
+  "fota",
+  "goo",
+  "heewde",
+  "hooreeɓe",
+  "jibinaa",
+  "jojjanɗe",
+  "juuɗe",
+  "kamɓe",
+  "laamateeri",
+  "le",
+  "ley",
+  "maayo",
+  "mawnude",
+  "mawɓe",
+  "mawɗo",
+  "miniteeriiɓe",
+  "naati",
+  "ngo",
+  "pinal",
+  "teeminannde",
+  "wonande",
+  "yeeso",
+  "Ɓaawo",
+  "ɓeen",
+  "ɓiɗɗo",
+  "ɗo",
+  "22",
+  "Ceerno",
+  "Fedde",
+  "Firdu",
+  "Innde",
+  "Jara",
+  "Maayo",
+  "Mandiŋkooɓe",
+  "Manndinkooɓe",
+  "Najeeriya",
+  "Nelson",
+  "Tumaani",
+  "adii",
+  "corteeji",
+  "dawla",
+  "dawrugol",
+  "du",
+  "gannde",
+  "gorgal",
+  "goɗɗe",
+  "go’o",
+  "happu",
+  "hari",
+  "hee",
+  "hewtaynoo",
+  "heɓi",
+  "hoɗuɗo",
+  "kañum",
+  "km2",
+  "laatii",
+  "mayre",
+  "mbele",
+  "naange",
+  "nano",
+  "nanondiral",
+  "nelaaɗo",
+  "ngoni",
+  "njiimaandi",
+  "renndo",
+  "saanga",
+  "saare",
+  "sibu",
+  "suka",
+  "suumayee",
+  "tati",
+  "tawnoo",
+  "wiyee",
+  "wondude",
+  "wonnoo",
+  "yiɗde",
+  "yumma",
+  "ɓiɓɓe",
+  "1960",
+  "Bamako",
+  "Biro",
+  "Gaabu",
+  "Gila",
+  "Maasina",
+  "Ndenndaandi",
+  "Niil",
+  "Ukba",
+  "addani",
+  "aduna",
+  "anndaa",
+  "anndiraa",
+  "arano",
+  "aynooɓe",
+  "ballal",
+  "defte",
+  "diiwal",
+  "diiwe",
+  "duuɗe",
+  "funnaange",
+  "goomu",
+  "jawdi",
+  "jemma",
+  "kolonaaku",
+  "laabi",
+  "leñol",
+  "lowre",
+  "lutti",
+  "ma",
+  "majji",
+  "mbaawaa",
+  "mi",
+  "ndimaagu",
+  "ndimaaku",
+  "ngenndi",
+  "nokku",
+  "nokkuure",
+  "nun",
+  "pular",
+  "sanne",
+  "saw",
+  "sukaaɓe",
+  "teeŋtii",
+  "wayi",
+  "waɗa",
+  "waɗde",
+  "wolde",
+  "won",
+  "wootere",
+  "worgo",
+  "yiɗi",
+  "Ñalnde",
+  "ñannde",
+  "ƴetti",
+  "ɓurɗi",
+  "ɗun",
+  "1.",
+  "1984",
+  "2.",
+  "Abdu",
+  "Abdul",
+  "Adamawa",
+  "Afiriik",
+  "Ahmadu",
+  "Aljeri",
+  "Amriki",
+  "Apartaayd",
+  "Balde",
+  "CEDEAO",
+  "Faransiiɓe",
+  "Ginenaaɓe",
+  "Haa",
+  "Hiirnaange",
+  "Ibn",
+  "Jalunkeeɓe",
+  "Kamerun",
+  "Kuyaate",
+  "Moodibbo",
+  "Ndiin",
+  "Persidan",
+  "Siilo",
+  "Tarawore",
+  "Yo",
+  "amen",
+  "arti",
+  "daali",
+  "darnde",
+  "dawlaaji",
+  "diiwaan",
+  "feewde",
+  "fulɓe",
+  "galluure",
+  "ganndal",
+  "golleeji",
+  "golwole",
+  "hade",
+  "hawtiti",
+  "hiɓe",
+  "holliti",
+  "hoɗo",
+  "hujjaaji",
+  "immorde",
+  "jamaanu",
+  "jeeɗiɗi",
+  "jiwo",
+  "jogaade",
+  "kan",
+  "keerol",
+  "kese",
+  "keso",
+  "lamɗo",
+  "larme",
+  "lislaamu",
+  "lollude",
+  "majje",
+  "miijo",
+  "misal",
+  "ndiin",
+  "needi",
+  "njeenaari",
+  "njuɓɓudi",
+  "pulaar/fulfulde",
+  "salii",
+  "sappo",
+  "simooje",
+  "simoore",
+  "sinci",
+  "suwee",
+  "taariika",
+  "taho",
+  "teemedannde",
+  "tigi",
+  "tinndi",
+  "toɗɗaa",
+  "tuuginorde",
+  "waasde",
+  "waraa",
+  "weeyo",
+  "wi’ee",
+  "wondi",
+  "woɓɓe",
+  "yaltini",
+  "yuɓɓo",
+  "ñalorma",
+  "ɓesngu",
+  "ɓurnde",
+  "ɓurɗe",
+  "1958",
+  "1982",
+  "1985",
+  "1989",
+  "2010",
+  "25",
+  "30",
+  "9",
+  "Aamadu",
+  "Adama",
+  "Ahmed",
+  "Alqur’aana",
+  "Baqara",
+  "Bisaawo",
+  "Botha",
+  "Burkina",
+  "CNDD",
+  "Caad",
+  "Demmba",
+  "Engele",
+  "Faso",
+  "Fonnye",
+  "Goomu",
+  "Himo",
+  "Hiɓe",
+  "IRIN",
+  "Jaawara",
+  "Jaloŋ",
+  "Kala",
+  "Keytaa",
+  "Koli",
+  "La",
+  "Laamateeri",
+  "Laamorde",
+  "Leydi",
+  "Leƴƴi",
+  "Makka",
+  "Ndeen",
+  "Neene",
+  "Nii",
+  "Nyannde",
+  "Porto",
+  "Portooɓe",
+  "Sokoto",
+  "Tambo",
+  "Teŋella",
+  "Umar",
+  "Yimɓe",
+  "Yumma",
+  "addugol",
+  "alsilamaaku",
+  "anndaaka",
+  "ardiiɓe",
+  "ardungal",
+  "ari",
+  "caɗeele",
+  "dammbitiima",
+  "demal",
+  "des",
+  "et",
+  "eɗe",
+  "feccere",
+  "feere",
+  "folli",
+  "fuuta",
+  "gardagol",
+  "goro",
+  "goɗɗo",
+  "haray",
+  "heewɓe",
+  "hella",
+  "hesu",
+  "hettaare",
+  "hinyooɓe",
+  "hollitii",
+  "hoohooɓe",
+  "hoolaare",
+  "hooreejo-leydi",
+  "huɗo",
+  "inniraa",
+  "inɗe",
+  "jaagorɓe",
+  "jeyanoo",
+  "jeydi",
+  "jojjannde",
+  "jolal",
+  "jowi",
+  "juulɓe",
+  "kaaldigal",
+  "kaalis",
+  "kaaƴe",
+  "kareeli",
+  "keewi",
+  "km",
+  "koloni",
+  "konnguɗi",
+  "koohooɓe",
+  "koorka",
+  "lesdi",
+  "leyɗeele",
+  "limle",
+  "maggal",
+  "mawnde",
+  "mawni",
+  "mbaawi",
+  "mbinndudi",
+  "moorol",
+  "muuɗum",
+  "mu’um",
+  "ndu",
+  "ne",
+  "ngee",
+  "ngeeygu",
+  "ngoo",
+  "nuwambar",
+  "pelle",
+  "piide",
+  "pine",
+  "rimɓe",
+  "sariya",
+  "senngo",
+  "seppooɓe",
+  "sikke",
+  "sincaa",
+  "taali",
+  "tagopeeje",
+  "takko",
+  "tawaa",
+  "tawde",
+  "teelal",
+  "teeŋti",
+  "tuggi",
+  "waɗaa",
+  "waɗii",
+  "wi'ee",
+  "wiyde",
+  "wiʼi",
+  "wonii",
+  "woo",
+  "woowi",
+  "yewti",
+  "yonta",
+  "yontii",
+  "ñaawoore",
+  "ñalaande",
+  "Ɓamtaare",
+  "Ɗuum",
+  "ɗeen",
+  "ɗowgu",
+  "10",
+  "15",
+  "16",
+  "1867",
+  "1883",
+  "1896",
+  "1969",
+  "1976",
+  "1992",
+  "1994",
+  "20",
+  "2009",
+  "2012",
+  "2013",
+  "26",
+  "5",
+  "6",
+  "60",
+  "Abdullah",
+  "Abuu",
+  "Almameeɓe",
+  "Arab",
+  "Bakari",
+  "Barazil",
+  "Ben",
+  "Butelesi",
+  "Caka",
+  "De",
+  "Dental",
+  "Dikkori",
+  "Dumbuya",
+  "East",
+  "Ejipte",
+  "Ene",
+  "Enngele",
+  "Fewndo",
+  "Foode",
+  "Gambi",
+  "Gana",
+  "Hannde",
+  "Hay",
+  "Ina",
+  "Ittude",
+  "Iwdi",
+  "Jamme",
+  "Jeeri",
+  "Jooni",
+  "Kaasamaas",
+  "Kabaa",
+  "Kadiijata",
+  "Klerk",
+  "Konaakiri",
+  "Konaare",
+  "Konngo",
+  "Kummba",
+  "Laam-Tooro",
+  "Laamiiɗo",
+  "Lewru",
+  "Leyɗe",
+  "Lome",
+  "Malal",
+  "Mammadu",
+  "Mandelaa",
+  "Maninkaaɓe",
+  "Manndiŋkooɓe",
+  "Men",
+  "Misira",
+  "Muttalibi",
+  "Nafi",
+  "National",
+  "Ndimaagu",
+  "Ndiyam",
+  "Ndorma",
+  "Neɗɗo",
+  "Ngaabu",
+  "Ngenndiije",
+  "Niijer",
+  "No",
+  "Olivier",
+  "Omo",
+  "PAC",
+  "Pellet",
+  "Pooredaaka",
+  "Pulaar",
+  "Pular",
+  "Saamori",
+  "Sahara",
+  "Sammba",
+  "Seɓɓe",
+  "Sisulu",
+  "Soh",
+  "Sompaare",
+  "Sudaan",
+  "Tijjaani",
+  "Timmbo",
+  "Timor",
+  "UNESCO",
+  "Umaama",
+  "Ummu",
+  "Vieira",
+  "Vietnam",
+  "Woɓɓe",
+  "Wuuri",
+  "Yoga",
+  "Zea",
+  "ado",
+  "aldaa",
+  "alhaali",
+  "almamaaku",
+  "annabaaɓe",
+  "artiri",
+  "awokaaji",
+  "aɓe",
+  "aɗa",
+  "bonni",
+  "bonnuɓe",
+  "boombi",
+  "boowal",
+  "buy",
+  "catal",
+  "cokkooɓe",
+  "cukalel",
+  "daande",
+  "daartol",
+  "daawal",
+  "daga",
+  "danndugol",
+  "demokaraasi",
+  "denndaangal",
+  "denndaaɗe",
+  "doole",
+  "doolnude",
+  "dunce",
+  "etii",
+  "faatii",
+  "faransiire",
+  "fayɓe",
+  "feddeeji",
+  "feewti",
+  "fellaa",
+  "felliti",
+  "fetel",
+  "feƴƴini",
+  "firti",
+  "fiyakuuji",
+  "fiɓnde",
+  "fus",
+  "fuuna",
+  "galleeji",
+  "gasa",
+  "gawri",
+  "gaño",
+  "giiɗe",
+  "gollal",
+  "goonga",
+  "goppitgol",
+  "goɗɗi",
+  "haaldude",
+  "haalii",
+  "hakke",
+  "halfinaa",
+  "hankadi",
+  "haqiiqa",
+  "hara",
+  "hawri",
+  "haɗaali",
+  "heewɗe",
+  "heɓa",
+  "heɓti",
+  "hikkiiɗi",
+  "hinde",
+  "hiraande",
+  "hooti",
+  "ibriilu",
+  "inniri",
+  "ittude",
+  "jaambareeɓe",
+  "jagge",
+  "jamma",
+  "jannde",
+  "jeereende",
+  "jeyi",
+  "jeytaare",
+  "jibinannde",
+  "jignaaɓe",
+  "jokki",
+  "jokkondiral",
+  "jommbugal",
+  "kanyun",
+  "kawtal",
+  "keewɗe",
+  "keɓii",
+  "klerk",
+  "koninkeejo",
+  "konngol",
+  "laten",
+  "law",
+  "maaɗum",
+  "mari",
+  "marse",
+  "maslahaa",
+  "mawɗe",
+  "mayru",
+  "mays",
+  "mbaadi",
+  "mbaɗaa",
+  "mboomri",
+  "meere",
+  "miilol",
+  "misiide",
+  "mofte",
+  "mum'en",
+  "naata",
+  "naatude",
+  "naatugol",
+  "nayo",
+  "naʼi",
+  "ndeya",
+  "neene",
+  "neeɓaali",
+  "ngardiigu",
+  "ngel",
+  "nih",
+  "njaggu",
+  "noone",
+  "nooneeji",
+  "noowammbar",
+  "nyalaande",
+  "oktoobar",
+  "parti",
+  "persidan",
+  "petelaaji",
+  "pour",
+  "rajoo",
+  "remuru",
+  "ronki",
+  "salaade",
+  "sikkaa",
+  "siwiljo",
+  "taalol",
+  "tee",
+  "teewu",
+  "tekkere",
+  "terɗe",
+  "timmi",
+  "timmoode",
+  "tuubakooɓe",
+  "ummanii",
+  "waawa",
+  "waañooɓe",
+  "walaa",
+  "waraaɓe",
+  "warngo",
+  "watti",
+  "waɗee",
+  "wi'a",
+  "wi'eteeɗo",
+  "wi'i",
+  "wii",
+  "wona",
+  "wonɓe",
+  "wota",
+  "wowleede",
+  "woɗɓe",
+  "wuurde",
+  "yahi",
+  "yaltude",
+  "yettoode",
+  "yiɗaa",
+  "yurme",
+  "Ñannde",
+  "ñaama",
+  "ñaamo",
+  "ñiiɓude",
+  "Ɓen",
+  "ƴettude",
+  "ɓeynguure",
+  "ɓiyiiko",
+  "ɓuretee",
+  "ɓurɓe",
+  "ɓurɗo",
+  "ɗam",
+  "ɗiin",
+  "ɗiɗo",
+  "ɗuuɗal",
+  "ɗuuɗi",
+  "ɗuuɗude",
+  "ɗuuɗuɗi",
+  "1.Misiide",
+  "12",
+  "15aɓere",
+  "17",
+  "18",
+  "1881",
+  "1948",
+  "1956",
+  "1959",
+  "1964",
+  "1979",
+  "1991",
+  "1993",
+  "19ɓere",
+  "2",
+  "2.Misiide",
+  "2002",
+  "2005",
+  "2006",
+  "2007",
+  "230",
+  "3",
+  "3.",
+  "4",
+  "40",
+  "500",
+  "8",
+  "A",
+  "Aazi",
+  "Abdullaahi",
+  "Al",
+  "Albert",
+  "Alii",
+  "Aliyyu",
+  "Almanɓe",
+  "Almasaanii",
+  "Almufassal",
+  "Asiariki",
+  "Atilanti",
+  "Atlantik",
+  "Attiwaalu",
+  "Ba",
+  "Bajju",
+  "Bernardo",
+  "Birom",
+  "Bisaaw",
+  "Bono",
+  "Bula",
+  "Burkinaa",
+  "Burra",
+  "Buubakar",
+  "CAP",
+  "Cabral",
+  "Casamance",
+  "Coil",
+  "Conseil",
+  "Curitiba",
+  "Cáceres",
+  "Debbo",
+  "Deniyankooɓe",
+  "Dentuɗe",
+  "Diiwal",
+  "Dimo",
+  "Ecoppi",
+  "En",
+  "Endi",
+  "Enngeleeɓe",
+  "Entrena",
+  "Eɗen",
+  "Faggudu",
+  "Fahin",
+  "Fello",
+  "Fii",
+  "Fommbina",
+  "Fooduyee",
+  "Funnaange",
+  "Gelaajo",
+  "Gine-Bisaawo",
+  "Goonga",
+  "Guinée",
+  "Hakkillaaji",
+  "Hakkundeeri",
+  "Harameeji",
+  "Haute",
+  "Henri",
+  "Himɓe",
+  "Hindi",
+  "Hirnaangeeri",
+  "Hoorugol",
+  "Ido",
+  "Inkata",
+  "Island",
+  "Jaagorɓe",
+  "Jaakankeeɓe",
+};
+const uint16_t WA_FREQ_42_RANKS[] = {
+  243, 298, 754, 0, 246, 0, 0, 848, 0, 539, 867, 0, 0, 0, 94, 469,
+  189, 418, 525, 638, 736, 0, 0, 939, 0, 0, 0, 0, 912, 0, 0, 890,
+  0, 0, 361, 194, 70, 0, 0, 0, 0, 0, 979, 0, 0, 0, 296, 355,
+  949, 0, 0, 589, 0, 0, 0, 0, 735, 0, 0, 0, 0, 502, 39, 166,
+  0, 932, 0, 715, 0, 0, 0, 390, 226, 27, 604, 241, 708, 711, 374, 0,
+  0, 0, 0, 124, 0, 324, 0, 0, 0, 0, 690, 363, 0, 0, 0, 232,
+  0, 0, 0, 0, 0, 0, 310, 450, 0, 852, 0, 0, 750, 0, 0, 0,
+  24, 12, 88, 446, 488, 853, 0, 111, 204, 303, 0, 0, 313, 58, 0, 581,
+  0, 703, 0, 0, 839, 207, 68, 319, 369, 803, 259, 859, 965, 0, 0, 0,
+  651, 0, 0, 0, 0, 0, 0, 234, 957, 618, 0, 0, 0, 0, 540, 868,
+  0, 0, 431, 0, 0, 0, 0, 0, 300, 425, 799, 0, 321, 798, 0, 113,
+  0, 0, 0, 0, 0, 402, 702, 0, 0, 0, 0, 0, 971, 0, 585, 29,
+  474, 509, 20, 883, 0, 323, 737, 496, 0, 0, 0, 0, 0, 0, 0, 169,
+  372, 0, 929, 0, 779, 145, 0, 0, 0, 0, 227, 0, 0, 0, 336, 514,
+  517, 975, 631, 0, 692, 0, 0, 0, 0, 0, 683, 954, 0, 0, 0, 0,
+  289, 0, 0, 350, 0, 0, 582, 0, 439, 0, 0, 999, 0, 466, 0, 0,
+  0, 0, 0, 927, 0, 492, 854, 617, 0, 0, 0, 0, 0, 484, 592, 668,
+  774, 0, 0, 0, 0, 340, 0, 0, 367, 0, 0, 991, 165, 173, 0, 960,
+  0, 0, 0, 0, 117, 0, 0, 325, 73, 0, 250, 791, 0, 98, 438, 607,
+  988, 0, 0, 567, 49, 0, 0, 0, 334, 348, 0, 18, 457, 0, 0, 0,
+  0, 0, 0, 373, 910, 0, 898, 0, 0, 305, 216, 698, 967, 403, 856, 878,
+  65, 404, 569, 626, 657, 0, 0, 628, 678, 0, 0, 0, 217, 0, 0, 0,
+  307, 0, 545, 0, 274, 0, 0, 0, 193, 121, 0, 0, 959, 0, 832, 0,
+  162, 222, 0, 101, 681, 819, 0, 0, 0, 0, 0, 0, 989, 183, 627, 944,
+  0, 0, 0, 171, 188, 0, 0, 462, 288, 301, 393, 430, 955, 987, 0, 331,
+  0, 0, 0, 810, 850, 0, 181, 434, 0, 0, 199, 213, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 985, 0, 694, 0, 596, 724, 797,
+  877, 0, 907, 210, 619, 982, 0, 0, 0, 86, 154, 192, 980, 0, 518, 902,
+  0, 0, 0, 0, 294, 0, 0, 0, 0, 454, 997, 412, 433, 926, 687, 109,
+  0, 0, 527, 0, 0, 0, 440, 0, 0, 553, 140, 63, 257, 530, 688, 0,
+  56, 0, 0, 0, 133, 0, 0, 198, 0, 0, 0, 0, 405, 758, 0, 0,
+  616, 0, 0, 761, 212, 0, 0, 0, 0, 843, 0, 138, 946, 161, 550, 497,
+  656, 0, 952, 0, 0, 0, 255, 0, 0, 31, 0, 537, 0, 0, 0, 915,
+  0, 0, 0, 0, 516, 968, 0, 749, 0, 623, 262, 827, 851, 918, 178, 0,
+  726, 119, 729, 0, 118, 526, 521, 400, 0, 268, 0, 0, 0, 0, 0, 0,
+  846, 0, 0, 0, 0, 75, 501, 772, 875, 0, 0, 614, 963, 993, 844, 486,
+  0, 0, 383, 394, 304, 0, 360, 126, 315, 938, 653, 91, 25, 662, 940, 947,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 595, 0, 0, 0, 50,
+  0, 308, 0, 432, 0, 0, 718, 273, 0, 0, 0, 962, 0, 0, 245, 602,
+  608, 0, 0, 0, 0, 139, 44, 0, 0, 0, 0, 762, 0, 0, 748, 0,
+  0, 532, 792, 835, 0, 0, 0, 705, 267, 0, 504, 0, 0, 387, 423, 816,
+  0, 0, 609, 0, 0, 778, 0, 428, 346, 0, 811, 368, 716, 0, 0, 725,
+  0, 0, 0, 0, 153, 0, 0, 781, 0, 87, 0, 463, 0, 0, 642, 995,
+  123, 0, 731, 709, 901, 26, 384, 686, 998, 0, 0, 673, 64, 180, 230, 610,
+  552, 675, 247, 874, 13, 441, 969, 0, 0, 0, 0, 0, 0, 0, 347, 752,
+  0, 0, 0, 672, 0, 0, 0, 0, 0, 857, 0, 3, 48, 823, 0, 0,
+  0, 0, 0, 472, 100, 283, 0, 738, 842, 983, 0, 57, 0, 594, 51, 0,
+  578, 789, 0, 0, 0, 191, 164, 254, 0, 0, 0, 994, 225, 0, 464, 696,
+  0, 0, 637, 782, 0, 606, 0, 151, 414, 291, 790, 764, 448, 465, 284, 0,
+  0, 0, 0, 0, 0, 97, 146, 793, 22, 420, 0, 0, 0, 0, 0, 0,
+  0, 4, 796, 0, 531, 676, 0, 0, 0, 208, 0, 0, 0, 0, 220, 0,
+  0, 0, 765, 891, 538, 0, 892, 0, 0, 475, 491, 476, 814, 0, 565, 0,
+  0, 357, 0, 0, 278, 597, 0, 0, 156, 0, 0, 155, 629, 0, 134, 206,
+  444, 871, 333, 0, 0, 409, 72, 788, 0, 0, 0, 297, 83, 685, 802, 930,
+  914, 806, 179, 408, 0, 105, 0, 0, 590, 0, 0, 0, 0, 0, 809, 0,
+  700, 838, 886, 966, 0, 0, 0, 275, 0, 0, 0, 0, 0, 566, 62, 0,
+  150, 144, 443, 127, 529, 753, 773, 822, 974, 0, 0, 0, 0, 0, 152, 717,
+  0, 0, 0, 0, 0, 0, 873, 249, 0, 229, 43, 417, 639, 828, 0, 224,
+  0, 0, 732, 10, 447, 396, 460, 599, 894, 71, 143, 784, 349, 429, 837, 218,
+  342, 365, 807, 449, 787, 978, 0, 562, 0, 0, 59, 493, 0, 0, 480, 693,
+  0, 0, 0, 554, 0, 0, 0, 167, 0, 0, 0, 0, 583, 666, 808, 0,
+  498, 32, 0, 0, 292, 33, 108, 591, 706, 908, 0, 786, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 7, 650, 0, 0, 0, 0, 122, 228, 260,
+  928, 0, 455, 0, 76, 0, 0, 311, 0, 697, 0, 0, 544, 576, 0, 0,
+  0, 654, 160, 0, 824, 0, 0, 203, 0, 881, 244, 209, 175, 299, 896, 437,
+  0, 745, 0, 0, 0, 0, 0, 136, 0, 0, 0, 0, 0, 0, 0, 727,
+  458, 573, 0, 0, 536, 0, 379, 495, 0, 0, 14, 376, 605, 489, 625, 0,
+  0, 386, 55, 128, 358, 0, 172, 353, 580, 917, 0, 767, 0, 0, 0, 865,
+  366, 704, 840, 0, 0, 0, 0, 280, 0, 0, 0, 740, 120, 620, 664, 0,
+  265, 0, 163, 35, 11, 287, 335, 598, 755, 0, 0, 0, 74, 295, 571, 0,
+  0, 0, 0, 0, 66, 174, 549, 551, 689, 0, 0, 0, 0, 935, 0, 0,
+  90, 0, 157, 0, 0, 60, 46, 0, 201, 0, 389, 237, 182, 456, 674, 195,
+  459, 0, 624, 149, 177, 337, 559, 560, 364, 327, 611, 695, 885, 0, 0, 0,
+  547, 0, 0, 0, 0, 984, 0, 0, 445, 587, 911, 240, 0, 903, 205, 0,
+  130, 419, 533, 0, 0, 916, 0, 0, 272, 0, 849, 95, 0, 0, 756, 422,
+  970, 279, 0, 0, 0, 570, 0, 0, 0, 635, 655, 0, 132, 577, 922, 0,
+  41, 282, 558, 69, 45, 795, 0, 424, 652, 661, 0, 242, 861, 158, 482, 0,
+  0, 258, 362, 0, 0, 603, 0, 0, 0, 0, 575, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 398, 0, 0, 202, 641, 0, 0, 584, 0, 36,
+  0, 677, 836, 0, 0, 0, 0, 0, 0, 515, 0, 0, 351, 406, 542, 712,
+  647, 893, 920, 931, 0, 6, 85, 114, 401, 942, 147, 5, 413, 747, 996, 0,
+  976, 0, 494, 0, 760, 862, 937, 0, 783, 0, 92, 170, 318, 159, 380, 397,
+  214, 453, 499, 707, 869, 913, 0, 759, 895, 0, 794, 0, 0, 543, 0, 477,
+  512, 818, 0, 919, 0, 0, 89, 953, 236, 739, 0, 0, 0, 329, 561, 0,
+  0, 0, 0, 285, 830, 110, 0, 0, 0, 435, 0, 0, 0, 0, 804, 261,
+  0, 53, 231, 513, 0, 326, 0, 0, 0, 0, 0, 572, 168, 600, 768, 613,
+  500, 328, 921, 800, 0, 0, 0, 0, 0, 0, 0, 541, 0, 0, 0, 0,
+  0, 0, 682, 888, 0, 0, 0, 0, 0, 812, 0, 841, 0, 511, 0, 0,
+  377, 0, 0, 0, 0, 0, 320, 508, 505, 339, 503, 0, 0, 0, 0, 490,
+  0, 986, 442, 385, 0, 771, 0, 0, 0, 0, 0, 407, 520, 948, 0, 330,
+  0, 0, 0, 0, 0, 0, 0, 0, 359, 0, 0, 0, 0, 0, 223, 0,
+  0, 61, 0, 933, 884, 0, 0, 354, 0, 0, 0, 0, 37, 314, 506, 38,
+  905, 950, 0, 821, 338, 785, 834, 0, 0, 290, 0, 0, 0, 0, 0, 0,
+  0, 728, 860, 0, 0, 0, 0, 0, 523, 906, 0, 0, 0, 535, 0, 479,
+  0, 0, 0, 233, 634, 0, 0, 0, 345, 805, 0, 0, 0, 0, 0, 0,
+  186, 269, 0, 0, 0, 0, 0, 40, 391, 485, 733, 34, 211, 820, 0, 0,
+  972, 451, 0, 0, 0, 2, 125, 621, 0, 0, 0, 0, 880, 0, 0, 0,
+  0, 574, 719, 665, 99, 281, 588, 0, 522, 0, 277, 0, 564, 0, 0, 302,
+  436, 483, 632, 0, 0, 52, 0, 0, 0, 0, 107, 680, 0, 0, 0, 176,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 622, 669, 0, 615, 0, 0, 0,
+  0, 0, 897, 0, 556, 0, 0, 0, 555, 93, 0, 887, 0, 0, 293, 0,
+  0, 0, 0, 0, 0, 0, 96, 148, 30, 0, 0, 15, 0, 945, 0, 270,
+  0, 0, 0, 0, 0, 684, 19, 640, 116, 0, 137, 77, 0, 0, 0, 0,
+  309, 253, 17, 1, 0, 826, 0, 0, 104, 106, 115, 468, 659, 746, 956, 0,
+  256, 317, 742, 831, 899, 0, 0, 0, 343, 0, 78, 568, 0, 0, 0, 0,
+  135, 190, 0, 235, 934, 187, 0, 0, 215, 221, 563, 923, 0, 426, 528, 0,
+  0, 0, 958, 0, 649, 722, 0, 0, 80, 264, 23, 713, 775, 829, 0, 239,
+  0, 421, 990, 0, 0, 0, 103, 370, 388, 646, 845, 344, 0, 936, 0, 0,
+  734, 142, 0, 286, 306, 0, 0, 833, 0, 0, 601, 47, 510, 586, 847, 0,
+  0, 0, 0, 478, 0, 0, 0, 870, 0, 0, 776, 0, 0, 0, 0, 276,
+  817, 0, 0, 129, 0, 710, 876, 0, 0, 546, 0, 0, 1000, 777, 0, 16,
+  864, 42, 943, 0, 0, 84, 0, 670, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 964, 0, 0, 0, 766, 0, 720, 0, 0, 0, 0, 0, 0,
+  667, 0, 0, 0, 67, 0, 21, 941, 0, 0, 0, 730, 266, 8, 0, 548,
+  0, 648, 0, 0, 0, 341, 82, 102, 378, 900, 375, 248, 630, 904, 644, 0,
+  961, 660, 0, 0, 0, 0, 0, 0, 633, 769, 863, 415, 0, 0, 0, 0,
+  882, 0, 0, 0, 381, 197, 743, 0, 0, 0, 0, 399, 131, 872, 889, 579,
+  0, 0, 744, 79, 473, 0, 0, 0, 0, 723, 866, 636, 461, 714, 112, 371,
+  557, 612, 721, 763, 0, 0, 0, 0, 252, 671, 0, 0, 0, 0, 0, 471,
+  981, 395, 0, 0, 0, 519, 322, 452, 0, 757, 0, 0, 0, 185, 316, 0,
+  251, 879, 352, 0, 200, 0, 0, 0, 0, 0, 411, 663, 643, 924, 813, 0,
+  0, 0, 858, 0, 0, 925, 691, 0, 0, 219, 81, 701, 196, 977, 0, 392,
+  481, 427, 593, 0, 0, 0, 312, 28, 645, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 263, 0, 0, 356, 679, 0, 0, 973, 0, 410, 0, 0, 0,
+  54, 416, 184, 780, 271, 470, 0, 815, 507, 741, 992, 332, 0, 0, 0, 534,
+  658, 0, 0, 855, 951, 825, 0, 238, 0, 801, 0, 0, 770, 0, 0, 0,
+  0, 0, 0, 524, 487, 751, 699, 0, 0, 0, 0, 467, 0, 0, 909, 0,
+  0, 0, 382, 0, 0, 141, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0,
+};
+
+const char *WA_FREQ_43_TOKENS[] = {
+  "on",
+  "ei",
+  "ja",
+  "se",
+  "hän",
+  "en",
+  "mitä",
+  "että",
+  "ole",
+  "olen",
+  "oli",
+  "niin",
+  "mutta",
+  "sen",
+  "vain",
+  "minä",
+  "jos",
+  "tämä",
+  "nyt",
+  "voi",
+  "sinä",
+  "olet",
+  "kun",
+  "sitä",
+  "kuin",
+  "he",
+  "hänen",
+  "täällä",
+  "olla",
+  "et",
+  "kaikki",
+  "minun",
+  "ovat",
+  "hyvä",
+  "minua",
+  "sitten",
+  "onko",
+  "miksi",
+  "sinua",
+  "miten",
+  "sinun",
+  "älä",
+  "siitä",
+  "hänet",
+  "mitään",
+  "kyllä",
+  "kiitos",
+  "hei",
+  "mikä",
+  "olisi",
+  "ne",
+  "kanssa",
+  "pitää",
+  "joka",
+  "ollut",
+  "tai",
+  "häntä",
+  "tässä",
+  "tiedä",
+  "minulle",
+  "minulla",
+  "jotain",
+  "ehkä",
+  "missä",
+  "tuo",
+  "minut",
+  "me",
+  "oletko",
+  "kuka",
+  "hyvin",
+  "anteeksi",
+  "vielä",
+  "tämän",
+  "sinut",
+  "sinulle",
+  "jo",
+  "koska",
+  "haluan",
+  "olemme",
+  "tiedän",
+  "tehdä",
+  "tänne",
+  "meidän",
+  "emme",
+  "saa",
+  "tule",
+  "paljon",
+  "siellä",
+  "anna",
+  "eivät",
+  "tätä",
+  "pois",
+  "ennen",
+  "sinulla",
+  "täytyy",
+  "aina",
+  "tulee",
+  "siinä",
+  "enää",
+  "eikö",
+  "takaisin",
+  "herra",
+  "mistä",
+  "selvä",
+  "yksi",
+  "te",
+  "juuri",
+  "näin",
+  "halua",
+  "pitäisi",
+  "kuinka",
+  "vai",
+  "koko",
+  "joku",
+  "meillä",
+  "olin",
+  "kaksi",
+  "hänelle",
+  "mennä",
+  "koskaan",
+  "tästä",
+  "tietää",
+  "kai",
+  "mies",
+  "joten",
+  "aivan",
+  "voin",
+  "ihan",
+  "no",
+  "siis",
+  "totta",
+  "isä",
+  "entä",
+  "aika",
+  "siihen",
+  "mene",
+  "oikein",
+  "kuten",
+  "vähän",
+  "olette",
+  "edes",
+  "teet",
+  "äiti",
+  "eikä",
+  "todella",
+  "hyvää",
+  "voit",
+  "aikaa",
+  "kukaan",
+  "haluat",
+  "mukaan",
+  "kunnossa",
+  "minusta",
+  "itse",
+  "myös",
+  "vaan",
+  "sanoi",
+  "sillä",
+  "kaiken",
+  "ettei",
+  "noin",
+  "ulos",
+  "hänellä",
+  "auttaa",
+  "taas",
+  "jälkeen",
+  "tulla",
+  "katso",
+  "pidä",
+  "heidän",
+  "päästä",
+  "puhua",
+  "tänään",
+  "sinusta",
+  "pahoillani",
+  "kerro",
+  "tuli",
+  "vaikka",
+  "niitä",
+  "etkö",
+  "liian",
+  "meitä",
+  "kotiin",
+  "tee",
+  "muuta",
+  "näyttää",
+  "teidän",
+  "vuotta",
+  "kiinni",
+  "nähdä",
+  "ilman",
+  "tapahtui",
+  "nämä",
+  "sinne",
+  "mennään",
+  "heti",
+  "sanoa",
+  "jotka",
+  "haluatko",
+  "varmasti",
+  "ette",
+  "saat",
+  "tähän",
+  "antaa",
+  "tiedät",
+  "kolme",
+  "tarvitse",
+  "haluaa",
+  "kertoa",
+  "ota",
+  "meidät",
+  "pian",
+  "odota",
+  "saada",
+  "menee",
+  "teitä",
+  "nähnyt",
+  "teen",
+  "hänestä",
+  "luoja",
+  "tehnyt",
+  "enemmän",
+  "täältä",
+  "tekee",
+  "sanoin",
+  "vastaan",
+  "n",
+  "usko",
+  "heidät",
+  "olevan",
+  "takia",
+  "sisään",
+  "käy",
+  "poika",
+  "jonka",
+  "voimme",
+  "olit",
+  "asia",
+  "heitä",
+  "olivat",
+  "sain",
+  "meille",
+  "piti",
+  "luulin",
+  "varmaan",
+  "yhä",
+  "sano",
+  "hienoa",
+  "tuon",
+  "ikinä",
+  "tuolla",
+  "teille",
+  "tiedätkö",
+  "varma",
+  "yhdessä",
+  "rakastan",
+  "joo",
+  "juttu",
+  "tarvitsen",
+  "kuollut",
+  "siksi",
+  "voisi",
+  "oikeassa",
+  "ottaa",
+  "ajan",
+  "kerran",
+  "mihin",
+  "lähteä",
+  "minne",
+  "yhtä",
+  "tappaa",
+  "teki",
+  "valmis",
+  "toinen",
+  "tapahtuu",
+  "ihmiset",
+  "pidän",
+  "silloin",
+  "hauskaa",
+  "voinut",
+  "tulen",
+  "pitänyt",
+  "tyttö",
+  "teillä",
+  "teidät",
+  "nainen",
+  "rouva",
+  "kyse",
+  "kauan",
+  "rahaa",
+  "ensin",
+  "enkä",
+  "yksin",
+  "joskus",
+  "olisin",
+  "tosi",
+  "lisää",
+  "apua",
+  "tuota",
+  "sai",
+  "oliko",
+  "lopeta",
+  "kulta",
+  "meni",
+  "päivä",
+  "pari",
+  "tällä",
+  "kertaa",
+  "tohtori",
+  "tuntuu",
+  "menen",
+  "päivää",
+  "jotta",
+  "huomenna",
+  "myöhemmin",
+  "uusi",
+  "tavata",
+  "sanoit",
+  "niinkö",
+  "älkää",
+  "halusin",
+  "nähdään",
+  "ainoa",
+  "odottaa",
+  "saanut",
+  "jonkun",
+  "milloin",
+  "minäkin",
+  "saan",
+  "etten",
+  "paras",
+  "yhden",
+  "silti",
+  "asiaa",
+  "parempi",
+  "vie",
+  "jota",
+  "osaa",
+  "viime",
+  "alas",
+  "paikka",
+  "tein",
+  "kuuluu",
+  "mikään",
+  "teit",
+  "ihmisiä",
+  "ketään",
+  "ajattelin",
+  "ylös",
+  "okei",
+  "jotakin",
+  "alkaa",
+  "miehen",
+  "ymmärrän",
+  "hetki",
+  "ohi",
+  "ymmärrä",
+  "sama",
+  "hieman",
+  "yli",
+  "muista",
+  "yritän",
+  "kuuntele",
+  "oletteko",
+  "sir",
+  "tullut",
+  "pieni",
+  "oikea",
+  "riittää",
+  "tiennyt",
+  "minkä",
+  "asioita",
+  "tulin",
+  "jokin",
+  "isäni",
+  "teemme",
+  "neiti",
+  "jossa",
+  "toivottavasti",
+  "tarkoittaa",
+  "vanha",
+  "kuoli",
+  "poissa",
+  "läpi",
+  "voisin",
+  "muuten",
+  "soittaa",
+  "halunnut",
+  "otan",
+  "haluaisin",
+  "saanko",
+  "pyydän",
+  "minuun",
+  "puhu",
+  "nopeasti",
+  "oikeasti",
+  "voinko",
+  "kanssasi",
+  "täysin",
+  "nimi",
+  "kunnes",
+  "hyvältä",
+  "löytää",
+  "vasta",
+  "tarpeeksi",
+  "iso",
+  "töitä",
+  "olisit",
+  "käyttää",
+  "poliisi",
+  "asti",
+  "heille",
+  "viisi",
+  "ettet",
+  "irti",
+  "kohta",
+  "kuulostaa",
+  "luulen",
+  "kuitenkin",
+  "tahansa",
+  "isäsi",
+  "kiltti",
+  "vuoden",
+  "tulossa",
+  "yrittää",
+  "samaa",
+  "kiva",
+  "ainakin",
+  "tulkaa",
+  "hiljaa",
+  "mukana",
+  "eli",
+  "sellaista",
+  "miltä",
+  "pakko",
+  "ensimmäinen",
+  "eilen",
+  "neljä",
+  "rahat",
+  "kaunis",
+  "pysy",
+  "kello",
+  "liikaa",
+  "kuulin",
+  "tunnen",
+  "senkin",
+  "mieltä",
+  "varten",
+  "sanoo",
+  "mukava",
+  "tarkoitat",
+  "dollaria",
+  "hitto",
+  "muut",
+  "kerron",
+  "kotona",
+  "asian",
+  "kertonut",
+  "niistä",
+  "melkein",
+  "kertoi",
+  "näytä",
+  "sait",
+  "siltä",
+  "meistä",
+  "kuulla",
+  "toisen",
+  "tunne",
+  "paska",
+  "kuullut",
+  "kaveri",
+  "näen",
+  "hieno",
+  "luulet",
+  "eri",
+  "pysty",
+  "halusi",
+  "jopa",
+  "uskoa",
+  "tehdään",
+  "osa",
+  "hauska",
+  "kapteeni",
+  "olimme",
+  "auta",
+  "paitsi",
+  "uuden",
+  "kanssani",
+  "äitisi",
+  "luuletko",
+  "tänä",
+  "john",
+  "kanssaan",
+  "puhut",
+  "vuoksi",
+  "suoraan",
+  "näytät",
+  "kaikkea",
+  "aikaan",
+  "päivän",
+  "haloo",
+  "mikset",
+  "sieltä",
+  "voitte",
+  "kävi",
+  "uskon",
+  "tietenkin",
+  "ystäväni",
+  "löysin",
+  "minuuttia",
+  "asiat",
+  "hätää",
+  "toki",
+  "maailman",
+  "nuo",
+  "tietysti",
+  "palaa",
+  "kuule",
+  "pikku",
+  "tarvitsee",
+  "jumala",
+  "maksaa",
+  "tarvitsemme",
+  "hetkinen",
+  "new",
+  "auto",
+  "tuntia",
+  "tapahtunut",
+  "soita",
+  "sanonut",
+  "voitko",
+  "mä",
+  "sille",
+  "jää",
+  "menossa",
+  "jolla",
+  "tervetuloa",
+  "lähellä",
+  "työtä",
+  "elää",
+  "kovin",
+  "pojat",
+  "sanon",
+  "ongelma",
+  "yötä",
+  "jätä",
+  "hullu",
+  "saamme",
+  "muita",
+  "sinuun",
+  "näe",
+  "minulta",
+  "tiesin",
+  "katsokaa",
+  "sellainen",
+  "jättää",
+  "tavalla",
+  "ai",
+  "lapset",
+  "aiemmin",
+  "tapa",
+  "ensi",
+  "viedä",
+  "menkää",
+  "huomenta",
+  "niiden",
+  "yhtään",
+  "jack",
+  "yritä",
+  "muistatko",
+  "vuonna",
+  "tarkoitan",
+  "sopii",
+  "parasta",
+  "päivänä",
+  "äitini",
+  "viimeinen",
+  "helvetti",
+  "soitan",
+  "onnea",
+  "sehän",
+  "oma",
+  "terve",
+  "samoin",
+  "heillä",
+  "välitä",
+  "annan",
+  "suuri",
+  "tiedämme",
+  "ihminen",
+  "hoitaa",
+  "vaivaa",
+  "huono",
+  "hyvät",
+  "miestä",
+  "jäädä",
+  "tulit",
+  "molemmat",
+  "heistä",
+  "vaikea",
+  "sanot",
+  "aamulla",
+  "olkaa",
+  "kysyä",
+  "väärin",
+  "väliä",
+  "mahtavaa",
+  "paremmin",
+  "viitsi",
+  "muka",
+  "tulevat",
+  "päälle",
+  "monta",
+  "luo",
+  "kahden",
+  "pääse",
+  "vauhtia",
+  "olleet",
+  "valmiina",
+  "teistä",
+  "aio",
+  "voivat",
+  "käydä",
+  "onneksi",
+  "miehet",
+  "lähde",
+  "vastaa",
+  "antoi",
+  "syytä",
+  "haluavat",
+  "takana",
+  "joita",
+  "naisen",
+  "lapsi",
+  "tuossa",
+  "lähden",
+  "uudelleen",
+  "töissä",
+  "rauhoitu",
+  "unohda",
+  "katsomaan",
+  "lähdetään",
+  "naiset",
+  "kaikkien",
+  "aion",
+  "uutta",
+  "toimi",
+  "asiassa",
+  "poikani",
+  "saattaa",
+  "yritin",
+  "toimii",
+  "tärkeää",
+  "paha",
+  "sisällä",
+  "uudestaan",
+  "pidät",
+  "tuskin",
+  "muistan",
+  "etkä",
+  "lähti",
+  "taitaa",
+  "ongelmia",
+  "tarvitset",
+  "tappoi",
+  "menemme",
+  "tunnin",
+  "sinulta",
+  "kysymys",
+  "voisit",
+  "ruokaa",
+  "näitä",
+  "kaikille",
+  "haluatte",
+  "iltana",
+  "ovi",
+  "tekemään",
+  "onkin",
+  "sinäkin",
+  "tehty",
+  "lapsia",
+  "elossa",
+  "aikana",
+  "hoidan",
+  "outoa",
+  "etsin",
+  "kestä",
+  "ulkona",
+  "kuolla",
+  "alkoi",
+  "menet",
+  "muuttaa",
+  "kunhan",
+  "naimisiin",
+  "aiot",
+  "ase",
+  "elämä",
+  "katsoa",
+  "lopettaa",
+  "maan",
+  "michael",
+  "tyyppi",
+  "häneen",
+  "täynnä",
+  "hyviä",
+  "auton",
+  "tytön",
+  "voisimme",
+  "vittu",
+  "puhun",
+  "oikeastaan",
+  "yleensä",
+  "avaa",
+  "puoli",
+  "sekä",
+  "hakemaan",
+  "joko",
+  "kuusi",
+  "tulet",
+  "voisitko",
+  "toivon",
+  "vaikeaa",
+  "palata",
+  "olemaan",
+  "laita",
+  "hetken",
+  "ystäviä",
+  "jatkaa",
+  "muu",
+  "ikävä",
+  "töihin",
+  "tilanne",
+  "mahdollista",
+  "erittäin",
+  "hätänä",
+  "verta",
+  "tekevät",
+  "helvettiä",
+  "vaikuttaa",
+  "seuraa",
+  "mukavaa",
+  "homma",
+  "elämäni",
+  "istu",
+  "paikan",
+  "pitkä",
+  "saisi",
+  "luona",
+  "kuulemma",
+  "lupaan",
+  "käynyt",
+  "vaimoni",
+  "vettä",
+  "nuori",
+  "kaikkia",
+  "nimeni",
+  "alla",
+  "ovatko",
+  "auki",
+  "kenen",
+  "pyytää",
+  "ollaan",
+  "saimme",
+  "tehtävä",
+  "oman",
+  "yhteen",
+  "sä",
+  "kestää",
+  "sanotaan",
+  "paikalla",
+  "taida",
+  "jokainen",
+  "haluamme",
+  "saatte",
+  "vihainen",
+  "jutella",
+  "puolesta",
+  "olekin",
+  "antakaa",
+  "teette",
+  "ystävä",
+  "turvassa",
+  "eihän",
+  "usein",
+  "välillä",
+  "tytöt",
+  "uskomatonta",
+  "voittaa",
+  "josta",
+  "miksei",
+  "luota",
+  "iloinen",
+  "luottaa",
+  "ihmisten",
+  "häneltä",
+  "näetkö",
+  "illalla",
+  "väärässä",
+  "yritti",
+  "vitun",
+  "näet",
+  "pelastaa",
+  "edessä",
+  "sentään",
+  "päällä",
+  "tosiaan",
+  "niinpä",
+  "syy",
+  "kautta",
+  "itsensä",
+  "onpa",
+  "soitti",
+  "päin",
+  "ala",
+  "mahtava",
+  "matkalla",
+  "päässä",
+  "paljonko",
+  "kerroin",
+  "alle",
+  "viimeksi",
+  "kymmenen",
+  "saavat",
+  "sam",
+  "yhteyttä",
+  "sinähän",
+  "nimensä",
+  "velkaa",
+  "frank",
+  "kaukana",
+  "näytän",
+  "helppoa",
+  "haittaa",
+  "toista",
+  "lähtee",
+  "idea",
+  "haluaisi",
+  "suomennos",
+  "olenko",
+  "nimesi",
+  "paskiainen",
+  "tapauksessa",
+  "jutun",
+  "haen",
+  "ajaa",
+  "kunnon",
+  "kuolee",
+  "jossain",
+  "samalla",
+  "olemassa",
+  "puhuu",
+  "pelkää",
+  "herrat",
+  "rakastaa",
+  "fbi",
+  "itseni",
+  "selittää",
+  "kultaseni",
+  "vei",
+  "tärkeä",
+  "ymmärtää",
+  "katsotaan",
+  "kuulu",
+  "agentti",
+  "syö",
+  "charlie",
+  "tuosta",
+  "veljeni",
+  "maahan",
+  "syödä",
+  "helvetin",
+  "pojan",
+  "mennyt",
+  "pitkään",
+  "jotkut",
+  "sisälle",
+  "odottakaa",
+  "ympäri",
+  "eteenpäin",
+  "loppuun",
+  "pomo",
+  "luultavasti",
+  "vien",
+  "kuukautta",
+  "odotan",
+  "seuraava",
+  "eräs",
+  "jumalan",
+  "varo",
+  "tom",
+  "millainen",
+  "äidin",
+  "pääsi",
+  "viikon",
+  "ajatus",
+  "talo",
+  "ostaa",
+  "ettekö",
+  "kertoo",
+  "etsi",
+  "talon",
+  "isän",
+  "otti",
+  "huolta",
+  "olkoon",
+  "tulisi",
+  "tekisi",
+  "maailma",
+  "kädet",
+  "saman",
+  "kohtaan",
+  "tarvitaan",
+  "kerta",
+  "taidan",
+  "totuus",
+  "david",
+  "ymmärrätkö",
+  "numero",
+  "mietin",
+  "alan",
+  "itsesi",
+  "käyn",
+  "kaikesta",
+  "myöhässä",
+  "voimmeko",
+  "asiasta",
+  "selvää",
+  "presidentti",
+  "kovasti",
+  "pitäisikö",
+  "george",
+  "näki",
+  "palaan",
+  "tietoa",
+  "itseäsi",
+  "viikkoa",
+  "aloittaa",
+  "näkee",
+  "tiesi",
+  "tuonne",
+  "jatka",
+  "miljoonaa",
+  "mieheni",
+  "tajua",
+  "oltava",
+  "jätti",
+  "pelkkä",
+  "häivy",
+  "kysy",
+  "loppu",
+  "laittaa",
+  "kauanko",
+  "aiotko",
+  "avulla",
+  "huoli",
+  "tällaista",
+  "estää",
+  "minähän",
+  "annoin",
+  "tietenkään",
+  "tiedäthän",
+  "pyysi",
+  "muutaman",
+  "mike",
+  "perhe",
+  "miehiä",
+  "joe",
+  "rakas",
+  "halusit",
+  "täydellinen",
+  "kohti",
+  "naimisissa",
+  "the",
+  "käytä",
+  "selvittää",
+  "peter",
+  "ottakaa",
+  "elämän",
+  "uutisia",
+  "jäljellä",
+  "sattuu",
+  "tapan",
+  "puhutaan",
+  "elämää",
+  "lapsen",
+  "muiden",
+  "viikolla",
+  "ajattele",
+  "kahvia",
+  "selville",
+  "ystäväsi",
+  "menin",
+  "puolella",
+  "pitäkää",
+  "seitsemän",
+  "taisi",
+  "pysyä",
+  "pääsee",
+  "ylpeä",
+  "todisteita",
+};
+const uint16_t WA_FREQ_43_RANKS[] = {
+  0, 530, 0, 0, 0, 0, 380, 830, 871, 79, 177, 150, 342, 713, 801, 0,
+  271, 889, 0, 0, 0, 0, 720, 385, 34, 538, 426, 846, 0, 56, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 781, 347, 0, 63, 466, 0, 0, 0, 0,
+  0, 919, 0, 0, 544, 0, 0, 0, 0, 722, 838, 0, 894, 0, 340, 0,
+  0, 593, 0, 0, 0, 585, 0, 0, 339, 605, 0, 0, 0, 0, 0, 0,
+  0, 636, 78, 138, 287, 688, 0, 0, 0, 321, 0, 0, 0, 589, 120, 972,
+  238, 978, 987, 20, 545, 622, 0, 0, 621, 249, 0, 0, 0, 0, 379, 152,
+  512, 314, 0, 0, 0, 0, 651, 0, 169, 826, 0, 0, 828, 391, 0, 91,
+  635, 0, 0, 0, 184, 295, 244, 168, 435, 835, 0, 0, 0, 0, 0, 0,
+  0, 0, 750, 0, 0, 0, 0, 689, 100, 550, 0, 0, 864, 0, 82, 0,
+  0, 0, 0, 165, 539, 0, 761, 762, 166, 712, 0, 0, 0, 510, 0, 839,
+  698, 469, 0, 0, 0, 252, 994, 0, 0, 192, 0, 0, 0, 0, 0, 309,
+  0, 0, 270, 0, 746, 0, 0, 0, 0, 0, 0, 0, 0, 148, 468, 163,
+  0, 0, 0, 0, 616, 0, 0, 450, 492, 18, 0, 0, 0, 0, 0, 0,
+  0, 0, 907, 0, 895, 41, 0, 0, 0, 0, 0, 0, 507, 998, 0, 0,
+  278, 0, 0, 581, 0, 0, 556, 0, 734, 442, 0, 0, 0, 172, 186, 354,
+  212, 106, 578, 738, 836, 768, 653, 706, 925, 428, 931, 942, 0, 458, 0, 0,
+  0, 0, 0, 0, 733, 0, 262, 0, 112, 247, 603, 144, 652, 0, 229, 0,
+  754, 325, 869, 929, 0, 0, 816, 0, 0, 256, 0, 0, 0, 117, 570, 111,
+  383, 757, 608, 573, 0, 373, 564, 613, 961, 0, 0, 374, 94, 103, 477, 658,
+  848, 29, 725, 257, 453, 0, 22, 565, 602, 615, 739, 899, 0, 0, 0, 158,
+  315, 535, 509, 241, 0, 0, 0, 500, 0, 0, 856, 0, 0, 0, 283, 42,
+  566, 815, 984, 459, 915, 0, 178, 58, 196, 0, 0, 0, 0, 0, 0, 61,
+  406, 170, 0, 0, 540, 0, 0, 0, 281, 348, 455, 506, 202, 0, 0, 0,
+  0, 0, 410, 0, 8, 727, 696, 338, 0, 0, 775, 986, 0, 10, 552, 0,
+  0, 0, 0, 289, 411, 0, 0, 0, 557, 0, 575, 887, 0, 0, 0, 587,
+  555, 378, 505, 67, 717, 753, 796, 502, 219, 812, 867, 949, 0, 0, 0, 0,
+  323, 0, 0, 960, 0, 0, 0, 156, 161, 267, 811, 0, 999, 438, 0, 0,
+  0, 0, 484, 945, 0, 860, 906, 700, 751, 0, 0, 127, 164, 623, 752, 937,
+  25, 0, 259, 0, 0, 187, 487, 328, 729, 821, 176, 849, 0, 0, 0, 0,
+  0, 189, 0, 0, 109, 0, 0, 640, 0, 0, 0, 868, 0, 0, 0, 0,
+  0, 0, 75, 33, 242, 483, 239, 0, 963, 973, 0, 508, 0, 0, 0, 0,
+  0, 0, 0, 24, 0, 0, 0, 0, 0, 0, 0, 0, 0, 35, 0, 471,
+  683, 0, 0, 0, 0, 0, 0, 851, 272, 731, 390, 3, 304, 708, 783, 463,
+  932, 997, 279, 933, 0, 0, 40, 0, 0, 0, 0, 609, 0, 489, 0, 0,
+  0, 0, 97, 0, 0, 0, 911, 356, 639, 820, 0, 0, 412, 470, 159, 0,
+  263, 0, 0, 668, 331, 297, 995, 0, 0, 0, 0, 0, 0, 0, 855, 227,
+  0, 0, 0, 0, 0, 280, 0, 0, 808, 86, 643, 946, 0, 0, 0, 66,
+  0, 180, 0, 0, 317, 135, 422, 0, 0, 0, 0, 0, 0, 0, 286, 307,
+  464, 475, 766, 802, 0, 0, 0, 804, 0, 580, 980, 0, 0, 795, 0, 0,
+  0, 0, 943, 0, 0, 0, 298, 0, 197, 859, 920, 291, 0, 12, 625, 874,
+  0, 0, 0, 0, 549, 96, 0, 0, 245, 360, 0, 730, 902, 0, 0, 0,
+  0, 852, 0, 0, 0, 0, 293, 0, 0, 228, 0, 0, 0, 749, 248, 0,
+  0, 0, 624, 324, 479, 90, 649, 879, 674, 695, 936, 208, 956, 0, 0, 606,
+  765, 57, 819, 0, 0, 788, 0, 0, 0, 0, 0, 0, 430, 667, 944, 0,
+  940, 488, 0, 0, 0, 0, 71, 52, 723, 157, 0, 0, 0, 113, 0, 0,
+  0, 143, 357, 0, 0, 0, 0, 0, 0, 910, 70, 732, 0, 0, 759, 336,
+  576, 125, 0, 155, 49, 594, 800, 84, 214, 371, 779, 618, 951, 992, 501, 0,
+  0, 361, 0, 92, 254, 0, 0, 0, 302, 0, 274, 124, 676, 303, 784, 0,
+  0, 0, 0, 678, 235, 873, 877, 0, 23, 0, 19, 0, 612, 921, 522, 0,
+  59, 0, 0, 0, 0, 388, 979, 520, 546, 872, 0, 0, 146, 0, 216, 0,
+  0, 424, 0, 0, 693, 780, 572, 0, 0, 0, 337, 655, 789, 0, 0, 737,
+  0, 0, 0, 0, 473, 0, 724, 0, 0, 0, 0, 0, 0, 80, 772, 0,
+  0, 14, 372, 0, 384, 758, 990, 0, 0, 0, 0, 0, 0, 0, 123, 308,
+  0, 0, 0, 0, 0, 0, 577, 526, 233, 842, 0, 669, 0, 0, 0, 444,
+  0, 467, 0, 0, 0, 220, 0, 0, 292, 814, 0, 0, 351, 334, 930, 83,
+  30, 776, 0, 0, 190, 381, 648, 923, 0, 870, 0, 0, 440, 704, 0, 0,
+  48, 0, 0, 0, 0, 0, 0, 0, 126, 0, 0, 0, 875, 0, 408, 0,
+  798, 7, 31, 803, 173, 210, 806, 631, 0, 938, 0, 277, 0, 95, 493, 0,
+  694, 691, 0, 461, 0, 0, 574, 654, 885, 0, 0, 965, 77, 74, 191, 313,
+  498, 119, 705, 0, 0, 345, 225, 0, 221, 296, 349, 364, 630, 358, 261, 771,
+  792, 0, 395, 418, 362, 604, 955, 0, 0, 908, 0, 0, 0, 0, 0, 0,
+  0, 0, 290, 0, 0, 0, 413, 898, 0, 0, 0, 230, 495, 0, 0, 185,
+  316, 854, 0, 0, 0, 375, 0, 0, 0, 139, 0, 243, 445, 0, 0, 0,
+  638, 0, 0, 0, 0, 0, 443, 137, 179, 0, 0, 0, 0, 0, 415, 457,
+  645, 0, 0, 54, 0, 0, 567, 599, 65, 222, 425, 0, 0, 273, 0, 0,
+  0, 0, 0, 0, 0, 0, 619, 0, 0, 0, 641, 0, 0, 0, 0, 0,
+  0, 46, 0, 0, 326, 0, 51, 312, 0, 0, 0, 0, 255, 0, 44, 628,
+  207, 845, 0, 0, 592, 0, 0, 588, 0, 551, 0, 0, 513, 0, 101, 160,
+  928, 0, 918, 0, 0, 0, 0, 0, 0, 0, 405, 72, 0, 807, 0, 901,
+  0, 0, 0, 571, 866, 741, 823, 0, 0, 0, 0, 0, 0, 0, 0, 890,
+  305, 670, 0, 0, 0, 407, 0, 203, 0, 151, 300, 0, 0, 0, 0, 0,
+  47, 260, 833, 0, 182, 675, 0, 0, 0, 0, 0, 387, 0, 89, 0, 0,
+  0, 0, 133, 432, 494, 744, 68, 215, 310, 183, 460, 626, 516, 610, 657, 122,
+  822, 0, 0, 0, 0, 0, 686, 452, 0, 989, 0, 787, 0, 0, 0, 284,
+  465, 0, 0, 740, 0, 0, 130, 0, 0, 0, 0, 497, 0, 0, 0, 128,
+  434, 687, 763, 333, 684, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  903, 0, 21, 0, 0, 542, 240, 0, 0, 269, 0, 0, 346, 563, 601, 611,
+  697, 0, 600, 850, 237, 809, 0, 0, 0, 0, 0, 0, 0, 0, 770, 0,
+  414, 0, 629, 0, 446, 0, 393, 205, 837, 917, 886, 0, 0, 110, 832, 0,
+  0, 844, 0, 0, 909, 0, 167, 0, 825, 0, 525, 224, 294, 718, 0, 523,
+  0, 115, 266, 0, 941, 0, 2, 0, 0, 0, 0, 0, 53, 104, 692, 0,
+  0, 0, 0, 976, 0, 0, 0, 785, 0, 0, 142, 131, 913, 472, 0, 0,
+  0, 0, 386, 437, 0, 0, 0, 524, 715, 0, 596, 0, 396, 677, 548, 327,
+  680, 554, 861, 912, 914, 966, 211, 607, 969, 0, 0, 154, 660, 0, 882, 0,
+  0, 755, 0, 853, 0, 0, 0, 0, 0, 805, 0, 0, 99, 0, 258, 503,
+  0, 0, 16, 637, 218, 790, 478, 282, 149, 431, 0, 0, 0, 0, 0, 0,
+  0, 617, 499, 201, 496, 329, 728, 0, 382, 0, 0, 0, 0, 0, 0, 0,
+  633, 301, 449, 957, 0, 480, 491, 0, 11, 0, 0, 0, 341, 0, 0, 0,
+  0, 200, 0, 0, 840, 959, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 69, 843, 0, 0, 0, 343, 685, 0, 251, 537, 485, 863, 0,
+  0, 0, 50, 0, 0, 0, 0, 0, 394, 0, 0, 0, 927, 964, 0, 0,
+  0, 417, 934, 0, 553, 0, 0, 0, 0, 409, 0, 0, 376, 536, 954, 891,
+  17, 404, 0, 0, 569, 0, 767, 764, 847, 0, 288, 586, 0, 0, 541, 0,
+  448, 0, 0, 0, 335, 454, 543, 953, 777, 0, 322, 0, 108, 515, 642, 0,
+  264, 663, 427, 793, 5, 27, 0, 0, 0, 0, 0, 0, 9, 0, 0, 199,
+  857, 250, 517, 664, 0, 0, 0, 0, 401, 0, 392, 646, 791, 841, 0, 0,
+  0, 0, 0, 0, 206, 529, 531, 582, 0, 0, 0, 562, 971, 0, 352, 0,
+  0, 0, 121, 748, 0, 0, 0, 15, 88, 93, 175, 595, 662, 681, 0, 344,
+  0, 368, 253, 627, 0, 0, 0, 0, 0, 0, 162, 299, 782, 817, 55, 818,
+  0, 0, 306, 579, 0, 0, 0, 73, 181, 967, 0, 447, 701, 974, 0, 0,
+  0, 896, 827, 745, 813, 0, 0, 0, 881, 897, 0, 0, 892, 743, 4, 416,
+  721, 204, 420, 824, 0, 0, 134, 0, 0, 0, 0, 968, 0, 0, 559, 834,
+  0, 900, 0, 0, 0, 0, 935, 0, 402, 0, 389, 597, 0, 0, 0, 0,
+  774, 888, 970, 0, 0, 0, 0, 561, 332, 0, 0, 276, 0, 0, 0, 0,
+  64, 234, 174, 0, 0, 0, 0, 0, 236, 0, 682, 98, 13, 916, 952, 904,
+  0, 0, 0, 673, 0, 0, 514, 950, 0, 456, 982, 534, 0, 0, 0, 353,
+  0, 0, 0, 268, 397, 76, 702, 880, 893, 319, 359, 32, 198, 451, 486, 644,
+  665, 1000, 0, 0, 707, 0, 0, 0, 0, 0, 0, 275, 679, 905, 666, 661,
+  747, 0, 0, 43, 0, 0, 0, 0, 116, 0, 0, 28, 462, 0, 60, 0,
+  0, 141, 0, 786, 419, 421, 560, 769, 799, 926, 0, 0, 958, 0, 355, 0,
+  62, 6, 399, 0, 0, 865, 975, 0, 558, 0, 0, 0, 0, 0, 45, 716,
+  719, 504, 948, 0, 107, 650, 672, 0, 0, 0, 118, 0, 0, 0, 0, 0,
+  0, 132, 0, 0, 0, 584, 38, 140, 0, 0, 153, 0, 0, 1, 363, 398,
+  0, 0, 36, 0, 699, 810, 0, 711, 858, 632, 0, 647, 265, 709, 756, 0,
+  829, 188, 862, 922, 0, 528, 0, 0, 656, 735, 0, 0, 0, 102, 223, 285,
+  171, 433, 490, 568, 482, 0, 209, 0, 429, 726, 0, 231, 0, 0, 0, 0,
+  0, 0, 710, 0, 0, 0, 0, 105, 0, 0, 0, 0, 0, 962, 377, 590,
+  760, 831, 598, 400, 634, 369, 983, 939, 0, 217, 0, 0, 533, 37, 985, 441,
+  591, 0, 147, 87, 0, 0, 0, 519, 0, 532, 993, 0, 330, 26, 439, 659,
+  232, 977, 0, 246, 481, 226, 614, 518, 714, 794, 320, 0, 583, 0, 0, 0,
+  0, 0, 0, 511, 883, 0, 370, 350, 423, 988, 213, 690, 996, 0, 474, 0,
+  884, 0, 876, 547, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  311, 476, 85, 403, 991, 878, 0, 0, 366, 0, 0, 0, 0, 0, 0, 620,
+  0, 0, 0, 0, 0, 773, 0, 0, 0, 0, 742, 0, 0, 114, 367, 736,
+  981, 0, 0, 0, 194, 0, 703, 778, 797, 193, 521, 527, 39, 924, 0, 0,
+  0, 195, 318, 0, 145, 81, 436, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 671, 0, 0, 0, 0, 136, 947, 0, 0, 0, 365, 129, 0,
+};
+
+const char *WA_FREQ_44_TOKENS[] = {
+  "vit",
+  "í",
+  "tað",
+  "mín",
+  "er",
+  "ert",
+  "tú",
+  "inni",
+  "hann",
+  "hevði",
+  "ongantíð",
+  "verið",
+  "okinawa",
+  "fyrr",
+  "elska",
+  "útferðir",
+  "mugu",
+  "fara",
+  "kann",
+  "enda",
+  "galið",
+  "systir",
+  "dámar",
+  "bommini",
+  "bróður",
+  "ikki",
+  "her",
+  "dag",
+  "keyptu",
+  "bíligasta",
+  "teið",
+  "maðurin",
+  "høgur",
+  "nær",
+  "byrjar",
+  "framførslan",
+};
+const uint16_t WA_FREQ_44_RANKS[] = {
+  0, 0, 0, 14, 5, 33, 0, 0, 0, 26, 30, 0, 0, 0, 2, 0,
+  34, 36, 24, 0, 0, 0, 0, 9, 0, 32, 0, 17, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 19, 0, 0,
+  13, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 15, 0, 16, 0,
+  0, 0, 0, 0, 0, 0, 25, 0, 0, 8, 0, 0, 0, 0, 0, 31,
+  29, 0, 0, 1, 28, 0, 0, 3, 6, 0, 0, 0, 0, 27, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 35, 0, 0, 0, 23, 0,
+  0, 20, 0, 0, 0, 11, 18, 22, 0, 0, 0, 0, 4, 0, 0, 0,
+};
+
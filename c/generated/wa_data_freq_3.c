@@ -0,0 +1,8359 @@
+#include "worldalphabets_data.h"
+
+const char *WA_FREQ_45_TOKENS[] = {
+  "de",
+  "je",
+  "est",
+  "pas",
+  "le",
+  "que",
+  "la",
+  "vous",
+  "tu",
+  "un",
+  "c'",
+  "à",
+  "et",
+  "il",
+  "a",
+  "l'",
+  "ne",
+  "les",
+  "j'",
+  "en",
+  "on",
+  "ça",
+  "une",
+  "d'",
+  "ce",
+  "qu'",
+  "pour",
+  "ai",
+  "n'",
+  "des",
+  "qui",
+  "mais",
+  "dans",
+  "nous",
+  "elle",
+  "me",
+  "bien",
+  "si",
+  "du",
+  "y",
+  "suis",
+  "non",
+  "t'",
+  "avec",
+  "tout",
+  "plus",
+  "mon",
+  "m'",
+  "te",
+  "au",
+  "fait",
+  "moi",
+  "s'",
+  "oui",
+  "va",
+  "était",
+  "as",
+  "faire",
+  "ils",
+  "sur",
+  "quoi",
+  "se",
+  "comme",
+  "sais",
+  "être",
+  "veux",
+  "ici",
+  "ma",
+  "toi",
+  "est-ce",
+  "dit",
+  "lui",
+  "votre",
+  "es",
+  "pourquoi",
+  "où",
+  "là",
+  "rien",
+  "cette",
+  "sont",
+  "quand",
+  "peux",
+  "dire",
+  "son",
+  "avez",
+  "vais",
+  "alors",
+  "ton",
+  "comment",
+  "par",
+  "ou",
+  "chose",
+  "bon",
+  "ont",
+  "merci",
+  "juste",
+  "très",
+  "jamais",
+  "été",
+  "aussi",
+  "avoir",
+  "vraiment",
+  "voir",
+  "même",
+  "sa",
+  "oh",
+  "maintenant",
+  "tous",
+  "peut",
+  "deux",
+  "ces",
+  "êtes",
+  "allez",
+  "ta",
+  "autre",
+  "peu",
+  "temps",
+  "quelque",
+  "fais",
+  "toujours",
+  "encore",
+  "notre",
+  "mes",
+  "besoin",
+  "avait",
+  "accord",
+  "faut",
+  "dois",
+  "vie",
+  "peut-être",
+  "aller",
+  "fois",
+  "vu",
+  "donc",
+  "sans",
+  "monde",
+  "étais",
+  "parce",
+  "avant",
+  "sûr",
+  "trop",
+  "quelqu'",
+  "parler",
+  "personne",
+  "avais",
+  "père",
+  "crois",
+  "après",
+  "aux",
+  "dieu",
+  "ouais",
+  "ses",
+  "pense",
+  "eu",
+  "aime",
+  "leur",
+  "homme",
+  "viens",
+  "vrai",
+  "femme",
+  "ok",
+  "doit",
+  "veut",
+  "ans",
+  "m.",
+  "mal",
+  "chez",
+  "déjà",
+  "depuis",
+  "beaucoup",
+  "vos",
+  "bonne",
+  "mort",
+  "mieux",
+  "vas",
+  "mère",
+  "sera",
+  "dis",
+  "fille",
+  "tes",
+  "gens",
+  "quel",
+  "vois",
+  "désolé",
+  "ca",
+  "voilà",
+  "avons",
+  "petit",
+  "maison",
+  "soit",
+  "cela",
+  "autres",
+  "toute",
+  "soir",
+  "passé",
+  "prendre",
+  "jour",
+  "monsieur",
+  "nos",
+  "savoir",
+  "choses",
+  "salut",
+  "cet",
+  "nom",
+  "argent",
+  "bonjour",
+  "nuit",
+  "raison",
+  "moins",
+  "arrive",
+  "maman",
+  "reste",
+  "moment",
+  "voulais",
+  "seul",
+  "aider",
+  "air",
+  "entre",
+  "papa",
+  "passe",
+  "aurais",
+  "problème",
+  "ah",
+  "peur",
+  "regarde",
+  "voulez",
+  "gars",
+  "trouvé",
+  "fils",
+  "attends",
+  "savez",
+  "jusqu'",
+  "trouver",
+  "trois",
+  "assez",
+  "famille",
+  "dû",
+  "eh",
+  "toutes",
+  "plaît",
+  "pourrait",
+  "travail",
+  "pris",
+  "pu",
+  "tête",
+  "quelle",
+  "sait",
+  "sommes",
+  "appelle",
+  "quelques",
+  "faites",
+  "partir",
+  "vite",
+  "arrête",
+  "seule",
+  "serait",
+  "voiture",
+  "enfants",
+  "tuer",
+  "merde",
+  "hé",
+  "pendant",
+  "idée",
+  "chance",
+  "parle",
+  "aurait",
+  "part",
+  "elles",
+  "jours",
+  "grand",
+  "aujourd'hui",
+  "venir",
+  "ami",
+  "demain",
+  "hein",
+  "tard",
+  "puis",
+  "truc",
+  "passer",
+  "petite",
+  "tant",
+  "connais",
+  "combien",
+  "mec",
+  "sens",
+  "pouvez",
+  "porte",
+  "sortir",
+  "super",
+  "heure",
+  "contre",
+  "coup",
+  "comprends",
+  "entendu",
+  "vient",
+  "allons",
+  "ensemble",
+  "nouveau",
+  "amour",
+  "importe",
+  "sang",
+  "désolée",
+  "cas",
+  "sous",
+  "rester",
+  "amis",
+  "prends",
+  "fini",
+  "hommes",
+  "tué",
+  "question",
+  "partie",
+  "histoire",
+  "devrais",
+  "aide",
+  "dernière",
+  "demande",
+  "chercher",
+  "pensais",
+  "genre",
+  "seulement",
+  "police",
+  "car",
+  "mois",
+  "frère",
+  "laisser",
+  "aucun",
+  "mettre",
+  "eux",
+  "laisse",
+  "chaque",
+  "ville",
+  "arrivé",
+  "devrait",
+  "parlé",
+  "avez-vous",
+  "vont",
+  "longtemps",
+  "aucune",
+  "heures",
+  "bébé",
+  "place",
+  "revoir",
+  "putain",
+  "compris",
+  "ni",
+  "savais",
+  "leurs",
+  "étaient",
+  "attention",
+  "donner",
+  "affaire",
+  "endroit",
+  "pourrais",
+  "corps",
+  "façon",
+  "donné",
+  "est-il",
+  "voici",
+  "train",
+  "dont",
+  "écoute",
+  "yeux",
+  "trouve",
+  "pouvoir",
+  "type",
+  "perdu",
+  "premier",
+  "première",
+  "côté",
+  "point",
+  "tellement",
+  "main",
+  "tiens",
+  "sois",
+  "enfant",
+  "vieux",
+  "matin",
+  "venu",
+  "pardon",
+  "là-bas",
+  "suite",
+  "vers",
+  "minutes",
+  "demandé",
+  "venez",
+  "devant",
+  "dr",
+  "enfin",
+  "arrêter",
+  "cause",
+  "nouvelle",
+  "attendez",
+  "chambre",
+  "droit",
+  "parti",
+  "mis",
+  "eau",
+  "compte",
+  "dirait",
+  "terre",
+  "belle",
+  "espère",
+  "aimerais",
+  "loin",
+  "as-tu",
+  "mari",
+  "donne",
+  "fin",
+  "croire",
+  "mme",
+  "aura",
+  "gros",
+  "boulot",
+  "plutôt",
+  "chérie",
+  "prêt",
+  "filles",
+  "bureau",
+  "mourir",
+  "hier",
+  "possible",
+  "jouer",
+  "demander",
+  "celui",
+  "voulait",
+  "beau",
+  "jeune",
+  "euh",
+  "dehors",
+  "docteur",
+  "a-t-il",
+  "confiance",
+  "appeler",
+  "années",
+  "vérité",
+  "école",
+  "chef",
+  "femmes",
+  "propos",
+  "semaine",
+  "vivre",
+  "regardez",
+  "feu",
+  "journée",
+  "madame",
+  "hey",
+  "téléphone",
+  "près",
+  "affaires",
+  "meilleur",
+  "devez",
+  "dessus",
+  "mains",
+  "penses",
+  "prie",
+  "équipe",
+  "vas-y",
+  "grande",
+  "manger",
+  "arriver",
+  "dur",
+  "guerre",
+  "ait",
+  "appelé",
+  "marche",
+  "sécurité",
+  "garçon",
+  "essaie",
+  "important",
+  "dites",
+  "exactement",
+  "font",
+  "fort",
+  "presque",
+  "plein",
+  "derrière",
+  "ben",
+  "mariage",
+  "parents",
+  "capitaine",
+  "dernier",
+  "fou",
+  "ceux",
+  "tomber",
+  "attendre",
+  "vue",
+  "pensé",
+  "souviens",
+  "envie",
+  "fête",
+  "jeu",
+  "génial",
+  "pays",
+  "garde",
+  "cours",
+  "bientôt",
+  "ii",
+  "numéro",
+  "personnes",
+  "cinq",
+  "parfait",
+  "excusez-moi",
+  "laissé",
+  "ainsi",
+  "retour",
+  "semble",
+  "autant",
+  "peine",
+  "minute",
+  "essayé",
+  "plan",
+  "instant",
+  "serai",
+  "prison",
+  "penser",
+  "essayer",
+  "prend",
+  "arme",
+  "mauvais",
+  "mot",
+  "travailler",
+  "quatre",
+  "rentrer",
+  "regarder",
+  "choix",
+  "êtes-vous",
+  "parfois",
+  "film",
+  "abord",
+  "voyez",
+  "faute",
+  "facile",
+  "croyais",
+  "bas",
+  "changer",
+  "entendre",
+  "plaisir",
+  "heureux",
+  "entrer",
+  "voudrais",
+  "es-tu",
+  "propre",
+  "étiez",
+  "tour",
+  "fera",
+  "ensuite",
+  "garder",
+  "agent",
+  "allait",
+  "lit",
+  "travaille",
+  "adore",
+  "amie",
+  "rendre",
+  "allons-y",
+  "route",
+  "lieu",
+  "année",
+  "voit",
+  "commence",
+  "service",
+  "devoir",
+  "attend",
+  "drôle",
+  "difficile",
+  "sûre",
+  "pire",
+  "pos",
+  "peuvent",
+  "sujet",
+  "état",
+  "ceci",
+  "impossible",
+  "sorte",
+  "perdre",
+  "dollars",
+  "voulu",
+  "morte",
+  "ira",
+  "faisait",
+  "bizarre",
+  "oublié",
+  "arrêtez",
+  "ferai",
+  "serais",
+  "tôt",
+  "inquiète",
+  "payer",
+  "coeur",
+  "dès",
+  "pouvais",
+  "reviens",
+  "chien",
+  "suffit",
+  "prenez",
+  "pensez",
+  "café",
+  "calme",
+  "cherche",
+  "montrer",
+  "parles",
+  "photo",
+  "ferme",
+  "problèmes",
+  "the",
+  "cœur",
+  "sûrement",
+  "verre",
+  "aimes",
+  "devons",
+  "veulent",
+  "doute",
+  "musique",
+  "courant",
+  "sauf",
+  "moyen",
+  "nouvelles",
+  "puis-je",
+  "avis",
+  "sauver",
+  "hôpital",
+  "questions",
+  "meurtre",
+  "sérieux",
+  "seconde",
+  "trucs",
+  "comprendre",
+  "allais",
+  "esprit",
+  "cool",
+  "mlle",
+  "marché",
+  "fous",
+  "laisse-moi",
+  "haut",
+  "salle",
+  "malade",
+  "changé",
+  "gentil",
+  "allé",
+  "six",
+  "simple",
+  "john",
+  "semaines",
+  "celle",
+  "jack",
+  "appris",
+  "seigneur",
+  "dîner",
+  "sors",
+  "commencé",
+  "suppose",
+  "chemin",
+  "partout",
+  "bras",
+  "cul",
+  "prochaine",
+  "visage",
+  "h",
+  "meilleure",
+  "face",
+  "soirée",
+  "roi",
+  "surtout",
+  "retard",
+  "écrit",
+  "livre",
+  "rapport",
+  "chéri",
+  "message",
+  "voulez-vous",
+  "vaut",
+  "ferais",
+  "morts",
+  "boire",
+  "soyez",
+  "président",
+  "plait",
+  "bois",
+  "sinon",
+  "erreur",
+  "new",
+  "ecoute",
+  "mr",
+  "rentre",
+  "rendez-vous",
+  "devait",
+  "revenir",
+  "joue",
+  "pauvre",
+  "devenir",
+  "s",
+  "rencontrer",
+  "sort",
+  "commencer",
+  "pouvait",
+  "occupe",
+  "entends",
+  "souvent",
+  "pièce",
+  "reçu",
+  "grave",
+  "mets",
+  "intérieur",
+  "honneur",
+  "dormir",
+  "an",
+  "faux",
+  "messieurs",
+  "groupe",
+  "rêve",
+  "carte",
+  "aviez",
+  "appel",
+  "manque",
+  "envoyé",
+  "début",
+  "sam",
+  "puisse",
+  "écoutez",
+  "laissez-moi",
+  "bonsoir",
+  "content",
+  "secret",
+  "venue",
+  "cher",
+  "dis-moi",
+  "effet",
+  "voyons",
+  "sac",
+  "continue",
+  "acheter",
+  "voix",
+  "certains",
+  "occuper",
+  "noël",
+  "gagner",
+  "grâce",
+  "maître",
+  "prix",
+  "mauvaise",
+  "général",
+  "âge",
+  "long",
+  "rue",
+  "tirer",
+  "apprendre",
+  "cheveux",
+  "noir",
+  "promis",
+  "avaient",
+  "patron",
+  "avocat",
+  "force",
+  "accident",
+  "dix",
+  "probablement",
+  "laissez",
+  "bout",
+  "ordre",
+  "armes",
+  "cru",
+  "déteste",
+  "retrouver",
+  "millions",
+  "incroyable",
+  "voyage",
+  "ailleurs",
+  "oublie",
+  "ressemble",
+  "bienvenue",
+  "disparu",
+  "protéger",
+  "utiliser",
+  "situation",
+  "petits",
+  "aurai",
+  "veux-tu",
+  "connaissez",
+  "simplement",
+  "scène",
+  "sœur",
+  "prête",
+  "oncle",
+  "devriez",
+  "liste",
+  "soeur",
+  "complètement",
+  "dos",
+  "armée",
+  "paix",
+  "battre",
+  "york",
+  "crime",
+  "anniversaire",
+  "finir",
+  "réussi",
+  "agit",
+  "i",
+  "retourner",
+  "sale",
+  "libre",
+  "bouge",
+  "contrôle",
+  "rappelle",
+  "arrêté",
+  "hôtel",
+  "idiot",
+  "okay",
+  "rencontré",
+  "restez",
+  "absolument",
+  "mots",
+  "victime",
+  "impression",
+  "décidé",
+  "sympa",
+  "pars",
+  "fasse",
+  "avion",
+  "bordel",
+  "habitude",
+  "table",
+  "rouge",
+  "système",
+  "photos",
+  "médecin",
+  "seras",
+  "bateau",
+  "stupide",
+  "faim",
+  "autour",
+  "fond",
+  "surprise",
+  "croyez",
+  "devais",
+  "ligne",
+  "porter",
+  "imagine",
+  "colère",
+  "clair",
+  "seront",
+  "savait",
+  "balle",
+  "gagné",
+  "or",
+  "hors",
+  "magnifique",
+  "risque",
+  "terminé",
+  "su",
+  "heureuse",
+  "mission",
+  "jolie",
+  "parlez",
+  "présent",
+  "sorti",
+  "cadeau",
+  "expliquer",
+  "volé",
+  "plusieurs",
+  "gauche",
+  "ferait",
+  "neuf",
+  "passe-t-il",
+  "ouvre",
+  "disais",
+  "dedans",
+  "disent",
+  "pouvons",
+  "allez-y",
+  "suivre",
+  "pourra",
+  "inspecteur",
+  "réponse",
+  "lumière",
+  "pieds",
+  "pote",
+  "montre",
+  "pied",
+  "marcher",
+  "charlie",
+  "auras",
+  "envoyer",
+  "vraie",
+  "espèce",
+  "doivent",
+  "allô",
+  "pareil",
+  "vas-tu",
+  "soleil",
+  "camp",
+  "fallait",
+  "coin",
+  "ignore",
+  "moitié",
+  "you",
+  "selon",
+  "tenir",
+  "grosse",
+  "vouloir",
+  "michael",
+  "vieille",
+  "devenu",
+  "continuer",
+  "rend",
+  "sortie",
+  "recherche",
+  "arrière",
+  "lire",
+  "doucement",
+  "joli",
+  "avance",
+  "exact",
+  "disait",
+  "club",
+  "arrivée",
+  "tue",
+  "laquelle",
+  "poser",
+  "chaud",
+  "aimé",
+  "david",
+  "fais-tu",
+  "tom",
+  "professeur",
+  "quitter",
+  "loi",
+  "tueur",
+  "donne-moi",
+  "flics",
+  "connaître",
+  "lettre",
+  "forme",
+  "connaît",
+  "conseil",
+  "bar",
+  "normal",
+  "danger",
+  "dangereux",
+  "folle",
+  "jure",
+  "tiré",
+  "essaye",
+  "bonnes",
+  "offre",
+  "but",
+  "froid",
+  "allez-vous",
+  "prêts",
+  "tranquille",
+  "gamin",
+  "joe",
+  "classe",
+  "joué",
+  "poste",
+  "con",
+  "mike",
+  "attaque",
+  "boîte",
+  "enquête",
+  "visite",
+  "juge",
+  "moi-même",
+  "bord",
+  "debout",
+  "envoie",
+  "preuve",
+  "oublier",
+  "bons",
+  "vivant",
+  "ciel",
+  "lu",
+  "touche",
+  "aimer",
+  "faites-vous",
+  "télé",
+  "met",
+  "écouter",
+  "serez",
+  "ll",
+  "pourtant",
+  "change",
+  "triste",
+  "droite",
+  "gueule",
+  "tombe",
+  "sentir",
+  "ouvrir",
+  "travers",
+  "santé",
+  "dossier",
+  "ie",
+  "jeunes",
+  "frank",
+  "coucher",
+  "cuisine",
+  "monte",
+  "pouvez-vous",
+};
+const uint16_t WA_FREQ_45_RANKS[] = {
+  0, 0, 790, 0, 688, 440, 0, 396, 846, 0, 0, 0, 590, 615, 739, 0,
+  57, 425, 807, 908, 988, 0, 0, 4, 146, 402, 0, 0, 609, 0, 0, 100,
+  421, 0, 766, 385, 0, 0, 480, 754, 749, 0, 0, 0, 517, 119, 16, 729,
+  0, 897, 0, 145, 0, 0, 0, 828, 0, 888, 750, 140, 0, 0, 0, 0,
+  0, 288, 157, 444, 506, 834, 850, 0, 79, 0, 117, 433, 604, 765, 487, 0,
+  986, 0, 0, 414, 0, 218, 0, 0, 132, 571, 681, 934, 73, 181, 694, 856,
+  866, 907, 339, 0, 0, 0, 0, 0, 177, 773, 519, 175, 268, 306, 45, 0,
+  830, 390, 0, 0, 953, 0, 608, 966, 0, 11, 492, 0, 0, 150, 0, 0,
+  0, 538, 0, 328, 350, 499, 582, 8, 241, 430, 450, 727, 787, 915, 467, 144,
+  215, 473, 509, 958, 0, 0, 0, 80, 0, 0, 0, 304, 204, 0, 0, 993,
+  0, 0, 0, 64, 264, 801, 0, 977, 0, 0, 0, 0, 46, 0, 0, 0,
+  703, 231, 76, 251, 327, 551, 0, 0, 238, 747, 923, 0, 301, 678, 822, 952,
+  985, 212, 0, 0, 0, 0, 0, 113, 563, 0, 782, 0, 527, 0, 0, 0,
+  594, 0, 0, 232, 0, 244, 0, 644, 514, 221, 0, 0, 0, 0, 810, 0,
+  261, 0, 141, 0, 52, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 618,
+  0, 0, 798, 0, 0, 0, 270, 0, 0, 0, 917, 0, 0, 320, 85, 0,
+  41, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 196, 454, 0, 0, 0,
+  0, 726, 0, 0, 474, 341, 529, 0, 721, 434, 786, 854, 0, 871, 0, 619,
+  939, 0, 0, 0, 513, 0, 0, 0, 103, 280, 377, 448, 881, 948, 0, 182,
+  716, 0, 0, 852, 0, 0, 0, 494, 237, 0, 0, 645, 0, 0, 943, 0,
+  0, 0, 0, 330, 867, 632, 0, 0, 751, 0, 184, 0, 0, 219, 713, 410,
+  992, 815, 0, 242, 0, 0, 0, 0, 0, 980, 0, 530, 0, 0, 9, 298,
+  224, 748, 0, 0, 443, 0, 451, 0, 0, 152, 0, 0, 92, 284, 0, 0,
+  472, 195, 0, 0, 0, 0, 0, 507, 0, 0, 611, 0, 149, 415, 580, 0,
+  0, 0, 0, 876, 0, 0, 0, 0, 722, 0, 0, 0, 0, 0, 326, 0,
+  0, 193, 877, 303, 0, 0, 0, 0, 0, 544, 83, 0, 488, 785, 596, 0,
+  0, 601, 283, 36, 478, 733, 743, 882, 26, 308, 159, 324, 359, 714, 784, 340,
+  101, 0, 0, 15, 837, 893, 0, 19, 0, 0, 0, 300, 367, 873, 0, 426,
+  235, 295, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  617, 469, 0, 0, 0, 0, 962, 0, 48, 543, 925, 652, 607, 0, 843, 0,
+  0, 0, 338, 0, 927, 989, 0, 0, 0, 0, 0, 0, 0, 0, 292, 0,
+  91, 89, 906, 167, 342, 0, 0, 0, 345, 606, 740, 799, 482, 0, 904, 0,
+  0, 116, 0, 794, 424, 0, 591, 731, 845, 0, 0, 468, 400, 540, 788, 913,
+  104, 0, 886, 37, 453, 0, 0, 0, 0, 0, 53, 27, 797, 0, 636, 247,
+  0, 758, 633, 0, 14, 0, 0, 562, 0, 0, 334, 412, 0, 0, 847, 0,
+  198, 0, 109, 0, 0, 0, 0, 0, 760, 0, 0, 404, 0, 305, 403, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 71, 0, 0, 0, 0, 859, 0, 621, 0, 172, 435, 573, 831,
+  0, 0, 0, 493, 520, 738, 0, 0, 0, 0, 0, 0, 161, 191, 0, 0,
+  0, 821, 0, 585, 583, 0, 0, 458, 0, 0, 0, 418, 33, 50, 950, 0,
+  273, 500, 0, 0, 0, 0, 437, 0, 0, 315, 0, 0, 0, 287, 974, 0,
+  0, 0, 0, 0, 293, 654, 416, 775, 0, 0, 0, 0, 229, 0, 0, 659,
+  0, 0, 0, 0, 0, 364, 0, 0, 605, 806, 0, 0, 0, 0, 0, 319,
+  968, 398, 0, 0, 653, 206, 464, 297, 698, 94, 417, 629, 0, 0, 0, 0,
+  211, 0, 0, 955, 0, 502, 0, 638, 0, 998, 0, 0, 0, 0, 55, 133,
+  154, 411, 0, 0, 0, 0, 0, 0, 0, 0, 0, 222, 920, 0, 548, 0,
+  889, 0, 0, 0, 0, 933, 0, 0, 0, 0, 0, 0, 0, 166, 947, 129,
+  0, 578, 0, 0, 0, 0, 0, 0, 663, 0, 916, 176, 0, 285, 317, 348,
+  603, 858, 0, 0, 178, 0, 165, 254, 389, 0, 0, 697, 0, 148, 0, 90,
+  0, 0, 282, 168, 262, 466, 180, 634, 0, 3, 18, 0, 0, 279, 446, 0,
+  423, 0, 0, 266, 252, 776, 0, 0, 0, 0, 122, 136, 802, 99, 47, 246,
+  336, 477, 734, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 778, 0, 818,
+  650, 838, 462, 0, 0, 0, 0, 188, 408, 0, 0, 0, 0, 0, 0, 0,
+  0, 795, 378, 0, 255, 497, 0, 972, 203, 309, 707, 0, 0, 0, 0, 0,
+  504, 887, 106, 374, 0, 313, 2, 587, 817, 982, 545, 0, 0, 0, 349, 800,
+  935, 355, 0, 0, 124, 267, 44, 0, 0, 542, 210, 391, 613, 717, 0, 755,
+  13, 875, 112, 0, 0, 86, 213, 661, 0, 0, 422, 352, 0, 0, 640, 0,
+  0, 0, 81, 250, 708, 137, 899, 929, 0, 0, 0, 796, 0, 946, 318, 351,
+  814, 0, 491, 0, 438, 0, 589, 0, 0, 0, 549, 0, 0, 0, 979, 0,
+  0, 0, 365, 383, 0, 457, 368, 0, 0, 0, 463, 296, 0, 689, 0, 951,
+  461, 712, 428, 870, 884, 945, 0, 0, 455, 0, 0, 0, 0, 427, 0, 0,
+  0, 0, 0, 565, 812, 623, 811, 208, 0, 0, 0, 0, 0, 0, 625, 0,
+  0, 0, 114, 0, 0, 0, 0, 0, 0, 66, 0, 0, 0, 0, 0, 0,
+  537, 0, 0, 0, 0, 192, 202, 102, 386, 485, 0, 0, 276, 353, 0, 912,
+  441, 0, 0, 0, 207, 779, 0, 711, 0, 863, 0, 447, 228, 384, 0, 823,
+  646, 826, 901, 236, 371, 56, 78, 546, 938, 87, 322, 693, 373, 0, 0, 272,
+  964, 220, 973, 0, 0, 25, 0, 0, 431, 0, 363, 769, 936, 35, 190, 249,
+  803, 559, 862, 0, 532, 0, 17, 88, 456, 983, 0, 0, 0, 60, 74, 0,
+  780, 990, 0, 0, 0, 0, 568, 914, 931, 31, 0, 0, 0, 0, 0, 0,
+  641, 0, 82, 670, 963, 275, 0, 0, 0, 0, 0, 0, 344, 718, 849, 10,
+  401, 978, 200, 883, 38, 0, 566, 162, 627, 761, 0, 0, 0, 0, 495, 395,
+  664, 358, 926, 108, 0, 868, 0, 0, 0, 0, 0, 0, 0, 0, 0, 223,
+  347, 0, 63, 259, 12, 804, 0, 0, 0, 600, 0, 0, 0, 0, 120, 0,
+  69, 687, 0, 0, 0, 832, 0, 586, 323, 269, 0, 1, 0, 0, 0, 808,
+  260, 820, 0, 0, 0, 0, 370, 0, 310, 372, 971, 0, 853, 0, 0, 0,
+  0, 579, 614, 763, 0, 0, 0, 226, 547, 40, 725, 944, 0, 0, 0, 0,
+  0, 909, 869, 0, 42, 0, 0, 878, 0, 0, 0, 0, 230, 0, 0, 258,
+  969, 839, 0, 0, 0, 0, 597, 0, 311, 624, 767, 199, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 690, 616, 214, 695, 595, 465, 366, 0,
+  0, 0, 0, 523, 0, 657, 274, 0, 771, 0, 0, 511, 68, 419, 984, 475,
+  531, 392, 510, 746, 0, 991, 413, 631, 0, 715, 357, 173, 683, 737, 777, 96,
+  0, 0, 0, 0, 892, 0, 155, 0, 0, 0, 0, 189, 865, 0, 0, 0,
+  0, 24, 0, 0, 759, 0, 0, 0, 960, 0, 0, 115, 577, 0, 0, 0,
+  0, 0, 0, 387, 705, 0, 528, 0, 0, 0, 702, 706, 833, 928, 0, 0,
+  0, 0, 0, 0, 515, 610, 0, 637, 0, 135, 0, 127, 0, 0, 0, 0,
+  105, 170, 550, 197, 388, 533, 598, 937, 0, 0, 0, 552, 0, 0, 789, 0,
+  0, 0, 332, 553, 756, 757, 655, 0, 479, 0, 381, 0, 0, 0, 783, 997,
+  70, 216, 331, 0, 0, 0, 481, 691, 921, 0, 460, 536, 791, 813, 910, 676,
+  0, 490, 905, 0, 84, 956, 0, 0, 861, 940, 0, 354, 0, 0, 0, 0,
+  470, 501, 72, 0, 0, 43, 0, 183, 672, 793, 0, 0, 362, 0, 314, 0,
+  0, 32, 143, 278, 564, 885, 730, 0, 0, 0, 0, 0, 0, 307, 0, 185,
+  0, 0, 0, 569, 0, 524, 0, 0, 1000, 169, 0, 97, 131, 959, 0, 526,
+  0, 0, 0, 379, 429, 0, 0, 164, 0, 23, 723, 851, 667, 860, 139, 0,
+  0, 0, 0, 0, 0, 896, 0, 394, 0, 0, 0, 709, 581, 130, 0, 592,
+  658, 0, 0, 0, 0, 741, 286, 0, 0, 0, 0, 941, 0, 635, 142, 792,
+  0, 397, 0, 0, 0, 0, 525, 857, 995, 0, 0, 325, 0, 0, 0, 696,
+  151, 522, 774, 0, 0, 0, 0, 0, 824, 0, 576, 201, 399, 0, 970, 588,
+  243, 781, 234, 299, 369, 489, 642, 679, 835, 879, 651, 898, 0, 0, 0, 0,
+  503, 0, 277, 0, 768, 0, 0, 0, 0, 67, 0, 0, 0, 0, 253, 147,
+  432, 179, 0, 0, 666, 0, 0, 0, 0, 0, 0, 0, 0, 449, 75, 0,
+  0, 0, 0, 0, 0, 0, 0, 954, 0, 496, 675, 903, 0, 0, 321, 484,
+  290, 476, 556, 848, 0, 0, 380, 599, 742, 0, 895, 0, 593, 0, 62, 685,
+  110, 557, 59, 194, 471, 719, 805, 827, 0, 0, 0, 626, 406, 0, 0, 393,
+  0, 5, 294, 0, 0, 0, 0, 710, 558, 720, 752, 0, 0, 0, 976, 0,
+  0, 445, 0, 699, 123, 0, 0, 890, 0, 0, 126, 156, 0, 0, 0, 0,
+  574, 158, 0, 0, 0, 0, 745, 0, 0, 0, 0, 329, 816, 30, 93, 186,
+  209, 316, 662, 643, 864, 894, 163, 575, 704, 668, 924, 932, 248, 0, 0, 671,
+  919, 0, 107, 0, 439, 0, 0, 98, 0, 762, 0, 483, 0, 0, 0, 128,
+  333, 567, 0, 39, 205, 452, 486, 841, 0, 965, 0, 0, 0, 0, 0, 981,
+  669, 409, 770, 902, 0, 975, 825, 0, 459, 0, 0, 0, 764, 138, 217, 0,
+  407, 994, 900, 0, 239, 728, 29, 0, 0, 572, 0, 34, 521, 700, 0, 620,
+  855, 20, 0, 0, 0, 0, 0, 61, 28, 0, 842, 0, 649, 0, 0, 245,
+  376, 0, 0, 660, 0, 0, 0, 0, 0, 0, 0, 0, 343, 95, 442, 673,
+  930, 0, 0, 0, 0, 256, 0, 0, 880, 346, 772, 0, 22, 21, 682, 516,
+  555, 0, 0, 0, 160, 263, 0, 0, 0, 187, 0, 0, 872, 674, 281, 0,
+  174, 996, 0, 0, 0, 312, 840, 0, 0, 0, 0, 0, 0, 512, 0, 647,
+  0, 289, 0, 736, 0, 382, 0, 0, 539, 0, 0, 0, 0, 257, 0, 0,
+  0, 0, 0, 692, 0, 0, 0, 0, 0, 0, 0, 0, 361, 0, 227, 967,
+  265, 534, 0, 0, 612, 724, 0, 0, 744, 0, 0, 0, 949, 0, 0, 0,
+  0, 0, 560, 570, 961, 0, 0, 891, 0, 561, 7, 0, 753, 829, 0, 918,
+  335, 0, 51, 0, 999, 686, 0, 0, 375, 0, 0, 0, 656, 809, 125, 541,
+  0, 0, 0, 0, 0, 0, 0, 0, 684, 874, 922, 58, 554, 0, 0, 0,
+  54, 0, 639, 0, 240, 0, 0, 0, 6, 987, 360, 628, 171, 436, 225, 735,
+  0, 0, 0, 0, 0, 0, 0, 121, 665, 630, 65, 602, 819, 942, 153, 420,
+  701, 0, 0, 0, 0, 0, 0, 648, 844, 291, 356, 498, 836, 0, 0, 0,
+  0, 0, 0, 0, 233, 508, 302, 77, 0, 0, 0, 0, 0, 111, 0, 0,
+  0, 0, 0, 505, 518, 405, 677, 0, 134, 0, 0, 0, 0, 0, 957, 271,
+  911, 732, 0, 622, 680, 0, 0, 0, 0, 118, 337, 535, 584, 0, 0, 0,
+};
+
+const char *WA_FREQ_46_TOKENS[] = {
+  "ik",
+  "dit",
+  "es",
+  "en",
+  "fuar",
+  "sii",
+  "t",
+  "mai",
+  "tee",
+  "liifst",
+  "repariari",
+  "hurom",
+  "wet",
+  "dü",
+  "ek",
+  "tö",
+  "skuul",
+  "gung",
+  "faađer",
+  "mensk",
+  "diar",
+  "hart",
+  "aarbert",
+  "hi",
+  "staant",
+  "üp",
+  "taak",
+  "haa",
+  "muar",
+  "ungst",
+  "jam",
+  "üs",
+  "di",
+  "teekeni",
+  "litj",
+  "kraans",
+  "tom",
+  "jemsk",
+};
+const uint16_t WA_FREQ_46_RANKS[] = {
+  8, 26, 0, 0, 9, 0, 0, 0, 0, 0, 21, 0, 0, 0, 0, 24,
+  31, 0, 0, 0, 0, 0, 0, 0, 35, 27, 0, 16, 0, 14, 30, 0,
+  0, 33, 7, 5, 19, 20, 0, 0, 0, 25, 36, 32, 0, 0, 0, 0,
+  0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 38, 0, 3, 0,
+  0, 0, 6, 0, 0, 0, 0, 0, 0, 1, 10, 0, 0, 12, 0, 0,
+  23, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0,
+  0, 0, 0, 34, 0, 0, 0, 0, 0, 17, 0, 0, 0, 0, 22, 37,
+  0, 4, 11, 28, 0, 0, 0, 0, 0, 0, 29, 0, 0, 18, 0, 0,
+};
+
+const char *WA_FREQ_47_TOKENS[] = {
+  "al",
+  "è",
+  "vueit",
+  "o",
+  "soi",
+  "un",
+  "om",
+  "il",
+  "televisôr",
+  "nol",
+  "va",
+  "mi",
+  "clami",
+  "jack",
+  "ce",
+  "che",
+  "tu",
+  "fasis",
+  "sul",
+  "ordenadôr",
+  "buine",
+  "gnot",
+  "cemût",
+  "stâstu",
+  "capìsitu",
+  "cjase",
+  "interessant",
+};
+const uint16_t WA_FREQ_47_RANKS[] = {
+  18, 0, 0, 21, 0, 1, 0, 0, 0, 0, 27, 0, 0, 0, 11, 23,
+  0, 2, 16, 0, 0, 0, 0, 0, 5, 0, 22, 0, 7, 0, 17, 6,
+  0, 4, 0, 0, 8, 15, 0, 25, 0, 10, 20, 24, 0, 26, 19, 9,
+  0, 0, 0, 0, 0, 0, 0, 12, 13, 0, 0, 0, 0, 3, 0, 14,
+};
+
+const char *WA_FREQ_48_TOKENS[] = {
+  "an",
+  "tom",
+  "go",
+  "raibh",
+  "ach",
+  "mé",
+  "tá",
+  "sé",
+  "ag",
+  "dúirt",
+  "comhluadar",
+  "uaidh",
+  "ná",
+  "bí",
+  "déanach",
+  "don",
+  "cruinniú",
+  "amárach",
+  "is",
+  "maith",
+  "leo",
+  "béarla",
+  "níl",
+  "dhá",
+  "inscne",
+  "sa",
+  "ghaeilge",
+  "bhí",
+  "réidh",
+  "madra",
+  "rua",
+  "ta",
+  "dáinte",
+  "mó",
+  "dheirfiúr",
+  "álainn",
+  "cá",
+  "thá",
+  "fhios",
+  "ndéanann",
+  "máire",
+  "rud",
+  "san",
+  "uaireanta",
+  "greadadh",
+  "báistí",
+  "caithfidh",
+  "dul",
+};
+const uint16_t WA_FREQ_48_RANKS[] = {
+  0, 0, 0, 0, 27, 44, 0, 0, 47, 8, 0, 0, 7, 18, 0, 0,
+  0, 46, 0, 0, 1, 0, 0, 0, 0, 0, 0, 5, 36, 0, 42, 9,
+  34, 23, 0, 0, 0, 0, 0, 48, 0, 0, 0, 30, 0, 0, 0, 12,
+  6, 13, 20, 38, 0, 0, 0, 31, 24, 4, 43, 29, 0, 0, 11, 28,
+  39, 0, 0, 14, 0, 0, 0, 10, 17, 37, 0, 0, 0, 0, 0, 0,
+  26, 40, 0, 0, 16, 21, 0, 0, 25, 33, 0, 0, 0, 0, 0, 0,
+  0, 0, 32, 0, 0, 19, 0, 0, 45, 35, 0, 0, 0, 22, 0, 2,
+  3, 0, 0, 0, 0, 0, 0, 41, 0, 0, 15, 0, 0, 0, 0, 0,
+};
+
+const char *WA_FREQ_49_TOKENS[] = {
+  "lɛ",
+  "tom",
+  "mary",
+  "nakai",
+  "aba",
+  "ni",
+  "te",
+  "oyɔɔ",
+  "tɛŋŋ",
+  "oketeke",
+  "tsi",
+  "ebɛŋkɛ",
+  "maŋ",
+  "obaanyɛ",
+  "oye",
+  "fɔfɔi",
+  "miwooo",
+  "tokotai",
+  "baanyɛ",
+  "ŋmɛlɛtswai",
+  "fioo",
+  "dani",
+  "sheee",
+  "mumɔi",
+  "gbeyei",
+  "wo",
+  "atade",
+  "kakadaŋŋ",
+  "mɛni",
+  "hewɔ",
+  "oyaaa",
+  "nitsumɔ",
+  "ŋmɛnɛ",
+  "kɛ",
+  "kɛɛ",
+  "amɛsusuuu",
+  "akɛ",
+  "john",
+  "baaha",
+  "alice",
+  "afee",
+  "ye",
+  "obua",
+  "mi",
+  "matsi",
+};
+const uint16_t WA_FREQ_49_RANKS[] = {
+  36, 7, 0, 0, 22, 0, 0, 0, 0, 0, 42, 0, 43, 0, 13, 18,
+  0, 0, 30, 0, 41, 0, 14, 0, 0, 5, 6, 0, 0, 0, 40, 0,
+  3, 32, 15, 0, 0, 0, 0, 0, 29, 0, 0, 11, 0, 0, 0, 0,
+  16, 0, 26, 0, 0, 0, 0, 17, 44, 0, 0, 0, 34, 0, 0, 35,
+  0, 4, 0, 0, 19, 27, 31, 0, 0, 45, 0, 28, 0, 0, 0, 0,
+  12, 0, 0, 8, 0, 0, 0, 38, 0, 20, 0, 0, 0, 1, 24, 0,
+  0, 0, 0, 0, 0, 0, 10, 0, 0, 0, 33, 37, 0, 0, 0, 2,
+  23, 0, 0, 0, 0, 0, 0, 21, 25, 9, 39, 0, 0, 0, 0, 0,
+};
+
+const char *WA_FREQ_50_TOKENS[] = {
+  "an",
+  "tha",
+  "a",
+  "e",
+  "bi",
+  "math",
+  "chan",
+  "sibh",
+  "am",
+  "mi",
+  "dòchas",
+  "gum",
+  "iasg",
+  "dhut",
+  "bruidhinn",
+  "gu",
+  "luath",
+  "aire",
+  "air",
+  "rathad",
+  "mise",
+  "as",
+  "coireach",
+  "falt",
+  "fada",
+  "chuir",
+  "litir",
+  "aige",
+  "fearg",
+  "oirre",
+  "robh",
+  "nur",
+  "stiùiriche",
+  "buidheann",
+  "carthannachd",
+  "sin",
+  "bha",
+  "ag",
+  "obair",
+  "aig",
+  "taigh",
+  "osda",
+  "màireach",
+  "anns",
+  "mhadainn",
+  "iongnadh",
+  "gur",
+  "lugha",
+  "le",
+  "tòmas",
+  "sinne",
+};
+const uint16_t WA_FREQ_50_RANKS[] = {
+  50, 0, 16, 0, 28, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  22, 24, 32, 9, 1, 0, 0, 0, 0, 0, 40, 0, 39, 0, 30, 38,
+  0, 0, 0, 0, 0, 0, 0, 0, 26, 34, 35, 0, 0, 0, 0, 7,
+  0, 23, 37, 3, 0, 8, 47, 10, 20, 0, 0, 0, 0, 0, 0, 12,
+  0, 0, 0, 15, 0, 0, 0, 36, 43, 0, 0, 0, 11, 0, 0, 0,
+  0, 0, 6, 0, 31, 51, 0, 0, 42, 41, 0, 0, 0, 0, 19, 0,
+  0, 0, 0, 0, 29, 0, 45, 0, 0, 18, 14, 13, 33, 5, 21, 27,
+  44, 46, 49, 4, 48, 0, 2, 0, 0, 25, 0, 0, 0, 0, 0, 17,
+};
+
+const char *WA_FREQ_51_TOKENS[] = {
+  "ª",
+  "de",
+  "que",
+  "a",
+  "e",
+  "o",
+  "do",
+  "da",
+  "unha",
+  "os",
+  "en",
+  "un",
+  "as",
+  "se",
+  "súa",
+  "máis",
+  "na",
+  "para",
+  "ou",
+  "A",
+  "é",
+  "como",
+  "á",
+  "por",
+  "no",
+  "das",
+  "non",
+  "dos",
+  "O",
+  "seu",
+  "con",
+  "tamén",
+  "polo",
+  "son",
+  "ao",
+  "co",
+  "pola",
+  "coa",
+  "seus",
+  "foi",
+  "Os",
+  "dun",
+  "ser",
+  "ás",
+  "xa",
+  "súas",
+  "entre",
+  "En",
+  "As",
+  "ó",
+  "nos",
+  "pode",
+  "parte",
+  "ten",
+  "está",
+  "lle",
+  "teñen",
+  "só",
+  "todo",
+  "Tamén",
+  "dunha",
+  "nunha",
+  "moi",
+  "sobre",
+  "aínda",
+  "pero",
+  "así",
+  "están",
+  "cos",
+  "outros",
+  "nas",
+  "contra",
+  "este",
+  "cando",
+  "goberno",
+  "hai",
+  "coma",
+  "vida",
+  "anos",
+  "tanto",
+  "dous",
+  "tempo",
+  "esta",
+  "sen",
+  "Ademais",
+  "aos",
+  "maior",
+  "No",
+  "poden",
+  "traballo",
+  "desta",
+  "Unha",
+  "país",
+  "foron",
+  "mesmo",
+  "durante",
+  "cada",
+  "galego",
+  "nin",
+  "ata",
+  "mundo",
+  "todos",
+  "dúas",
+  "nun",
+  "onde",
+  "era",
+  "xeral",
+  "forma",
+  "lingua",
+  "É",
+  "cal",
+  "familia",
+  "vez",
+  "persoas",
+  "grupo",
+  "nome",
+  "ano",
+  "edición",
+  "caso",
+  "calquera",
+  "última",
+  "segundo",
+  "páxina",
+  "mentres",
+  "outra",
+  "baixo",
+  "medio",
+  "menos",
+  "dende",
+  "polos",
+  "sexa",
+  "despois",
+  "ben",
+  "Non",
+  "Este",
+  "Galicia",
+  "tipo",
+  "xeito",
+  "mulleres",
+  "outro",
+  "ter",
+  "política",
+  "cidade",
+  "orixe",
+  "poboación",
+  "Na",
+  "século",
+  "ós",
+  "quen",
+  "facer",
+  "conta",
+  "poder",
+  "tres",
+  "Galiza",
+  "estado",
+  "cor",
+  "estes",
+  "gran",
+  "cunha",
+  "toda",
+  "mesma",
+  "momento",
+  "cun",
+  "moitos",
+  "propio",
+  "desenvolvemento",
+  "homes",
+  "membros",
+  "moito",
+  "maioría",
+  "el",
+  "outras",
+  "primeiro",
+  "persoa",
+  "E",
+  "pobo",
+  "Con",
+  "social",
+  "senón",
+  "lugar",
+  "Por",
+  "grupos",
+  "común",
+  "uns",
+  "dentro",
+  "fai",
+  "mais",
+  "coas",
+  "dereito",
+  "galega",
+  "polas",
+  "dereitos",
+  "auga",
+  "primeira",
+  "fin",
+  "cara",
+  "día",
+  "desde",
+  "Porén",
+  "San",
+  "canto",
+  "veces",
+  "Un",
+  "partir",
+  "catro",
+  "De",
+  "sociedade",
+  "estas",
+  "territorio",
+  "base",
+  "obra",
+  "obxectivo",
+  "algúns",
+  "nivel",
+  "moitas",
+  "Aínda",
+  "Cando",
+  "tivo",
+  "novo",
+  "ademais",
+  "sempre",
+  "debe",
+  "historia",
+  "tiña",
+  "nova",
+  "actividades",
+  "Se",
+  "feito",
+  "eran",
+  "respecto",
+  "sistema",
+  "casos",
+  "condicións",
+  "Esta",
+  "Para",
+  "mediante",
+  "linguas",
+  "exemplo",
+  "deste",
+  "mellor",
+  "si",
+  "banda",
+  "muller",
+  "función",
+  "actividade",
+  "Así",
+  "nenos",
+  "iso",
+  "grande",
+  "será",
+  "ningún",
+  "posición",
+  "xunto",
+  "fillos",
+  "carácter",
+  "Xunta",
+  "pouco",
+  "Durante",
+  "orde",
+  "fóra",
+  "morte",
+  "case",
+  "fixo",
+  "sendo",
+  "debido",
+  "decembro",
+  "porque",
+  "illa",
+  "lei",
+  "uso",
+  "destes",
+  "libre",
+  "grandes",
+  "rei",
+  "número",
+  "importante",
+  "través",
+  "fronte",
+  "palabra",
+  "diferentes",
+  "2021",
+  "importancia",
+  "eleccións",
+  "tal",
+  "organización",
+  "home",
+  "ningunha",
+  "público",
+  "proxecto",
+  "zona",
+  "coñecido",
+  "Foi",
+  "todas",
+  "xente",
+  "concello",
+  "Santiago",
+  "antes",
+  "hoxe",
+  "Pero",
+  "algunhas",
+  "dicir",
+  "fillo",
+  "obxecto",
+  "estaba",
+  "casa",
+  "galegos",
+  "acción",
+  "España",
+  "medios",
+  "relación",
+  "rexión",
+  "relacións",
+  "humanos",
+  "vai",
+  "comunidade",
+  "logo",
+  "época",
+  "entón",
+  "Hai",
+  "propia",
+  "dar",
+  "existencia",
+  "serie",
+  "lles",
+  "sociais",
+  "obras",
+  "liberdade",
+  "situación",
+  "varios",
+  "ela",
+  "sentido",
+  "liña",
+  "termo",
+  "presenza",
+  "idade",
+  "Ao",
+  "especies",
+  "Son",
+  "del",
+  "conxunto",
+  "días",
+  "deben",
+  "equipo",
+  "proceso",
+  "cales",
+  "internacional",
+  "Coruña",
+  "tarde",
+  "guerra",
+  "nacional",
+  "defensa",
+  "especial",
+  "acceso",
+  "até",
+  "funcións",
+  "natural",
+  "Estes",
+  "partes",
+  "nai",
+  "construción",
+  "isto",
+  "Vigo",
+  "longo",
+  "igual",
+  "sur",
+  "xaneiro",
+  "BNG",
+  "tan",
+  "pois",
+  "produción",
+  "Galega",
+  "único",
+  "países",
+  "eles",
+  "forza",
+  "Como",
+  "resto",
+  "acordo",
+  "cultural",
+  "habitantes",
+  "Segundo",
+  "económica",
+  "importantes",
+  "Despois",
+  "pai",
+  "punto",
+  "la",
+  "nesta",
+  "movemento",
+  "coñecida",
+  "varias",
+  "agora",
+  "autor",
+  "práctica",
+  "actual",
+  "millóns",
+  "células",
+  "superficie",
+  "Estado",
+  "axuda",
+  "comezou",
+  "formas",
+  "enfermidade",
+  "cultura",
+  "corpo",
+  "María",
+  "sexan",
+  "valor",
+  "especie",
+  "expresión",
+  "terra",
+  "ca",
+  "humano",
+  "pais",
+  "río",
+  "carreira",
+  "loita",
+  "algún",
+  "2012",
+  "estar",
+  "idioma",
+  "espazo",
+  "Isto",
+  "mar",
+  "educación",
+  "proteínas",
+  "demais",
+  "nosa",
+  "ver",
+  "pobos",
+  "pública",
+  "servizos",
+  "final",
+  "unhas",
+  "norte",
+  "oposición",
+  "actualidade",
+  "Pola",
+  "partido",
+  "podería",
+  "protección",
+  "inclúe",
+  "tódolos",
+  "segunda",
+  "seguridade",
+  "Europa",
+  "man",
+  "van",
+  "estrutura",
+  "membro",
+  "principal",
+  "cantidade",
+  "noso",
+  "Algúns",
+  "22",
+  "centro",
+  "xullo",
+  "calidade",
+  "imaxe",
+  "libro",
+  "directamente",
+  "medidas",
+  "español",
+  "principais",
+  "Goberno",
+  "xeralmente",
+  "apoio",
+  "neste",
+  "presidente",
+  "comúns",
+  "zonas",
+  "información",
+  "datos",
+  "xénero",
+  "di",
+  "chamado",
+  "formación",
+  "Polo",
+  "idea",
+  "novas",
+  "realizar",
+  "Ten",
+  "forte",
+  "Compostela",
+  "forzas",
+  "primeiros",
+  "El",
+  "razón",
+  "pesar",
+  "cambio",
+  "interese",
+  "humana",
+  "total",
+  "música",
+  "algo",
+  "enerxía",
+  "administración",
+  "sería",
+  "tempada",
+  "tras",
+  "Tags",
+  "Dende",
+  "propiedade",
+  "acto",
+  "estados",
+  "fan",
+  "cousas",
+  "novembro",
+  "palabras",
+  "xuño",
+  "terras",
+  "media",
+  "animais",
+  "principios",
+  "preto",
+  "interior",
+  "pequena",
+  "recoñecemento",
+  "realidade",
+  "tiñan",
+  "vila",
+  "período",
+  "chamada",
+  "novos",
+  "cidadáns",
+  "2",
+  "igrexa",
+  "superior",
+  "traballos",
+  "popular",
+  "características",
+  "Manuel",
+  "presente",
+  "incluso",
+  "persoal",
+  "obter",
+  "institucións",
+  "grazas",
+  "capacidade",
+  "materia",
+  "The",
+  "filla",
+  "Real",
+  "destas",
+  "opinión",
+  "paso",
+  "político",
+  "La",
+  "rede",
+  "Santa",
+  "camiño",
+  "materiais",
+  "necesario",
+  "elementos",
+  "asociación",
+  "etc",
+  "illas",
+  "Neste",
+  "necesidade",
+  "Entre",
+  "setembro",
+  "exército",
+  "Consello",
+  "Francia",
+  "cidades",
+  "creación",
+  "ante",
+  "papel",
+  "Igrexa",
+  "especialmente",
+  "3",
+  "boa",
+  "castelán",
+  "concepto",
+  "Todos",
+  "culturais",
+  "servizo",
+  "maio",
+  "rúa",
+  "territorios",
+  "augas",
+  "veciños",
+  "sector",
+  "Xeral",
+  "planta",
+  "1",
+  "independente",
+  "trata",
+  "Pontevedra",
+  "ensino",
+  "parroquia",
+  "perda",
+  "posible",
+  "existe",
+  "intereses",
+  "pasou",
+  "Universidade",
+  "cadea",
+  "Só",
+  "2020",
+  "empresa",
+  "finais",
+  "quere",
+  "Carlos",
+  "estivo",
+  "inglés",
+  "recursos",
+  "cabeza",
+  "Estas",
+  "control",
+  "célula",
+  "cinco",
+  "Xosé",
+  "traballadores",
+  "reino",
+  "I",
+  "Lugo",
+  "alí",
+  "mor",
+  "capital",
+  "Mentres",
+  "problemas",
+  "irmán",
+  "normalmente",
+  "pequenas",
+  "seres",
+  "posibilidade",
+  "Nos",
+  "figura",
+  "Mais",
+  "web",
+  "ADN",
+  "individuos",
+  "febreiro",
+  "follas",
+  "área",
+  "ocasións",
+  "agosto",
+  "central",
+  "provincia",
+  "10",
+  "chegar",
+  "fose",
+  "xogo",
+  "ese",
+  "plantas",
+  "galegas",
+  "tamaño",
+  "técnica",
+  "título",
+  "mans",
+  "actos",
+  "crecemento",
+  "dereita",
+  "leva",
+  "outubro",
+  "II",
+  "natureza",
+  "condición",
+  "políticas",
+  "primeiras",
+  "verán",
+  "elemento",
+  "marzo",
+  "medida",
+  "voto",
+  "existen",
+  "facendo",
+  "y",
+  "alta",
+  "anterior",
+  "último",
+  "antiga",
+  "posúe",
+  "miúdo",
+  "relixión",
+  "dixo",
+  "oficial",
+  "profesional",
+  "real",
+  "Nas",
+  "referencia",
+  "tradición",
+  "local",
+  "nunca",
+  "séculos",
+  "Concello",
+  "orixinal",
+  "pequenos",
+  "influencia",
+  "5",
+  "campo",
+  "clase",
+  "estudo",
+  "estaban",
+  "esa",
+  "fontes",
+  "Todo",
+  "Fernández",
+  "José",
+  "atópase",
+  "literatura",
+  "éxito",
+  "comeza",
+  "maneira",
+  "honra",
+  "traballar",
+  "Deus",
+  "cousa",
+  "maiores",
+  "alto",
+  "crise",
+  "vontade",
+  "noite",
+  "presenta",
+  "chegou",
+  "Máis",
+  "comunicación",
+  "desenvolver",
+  "hora",
+  "nacemento",
+  "rexións",
+  "saír",
+  "diferenza",
+  "diversas",
+  "houbo",
+  "deles",
+  "matrimonio",
+  "mellores",
+  "nomes",
+  "Madrid",
+  "Nova",
+  "Xa",
+  "dese",
+  "empresas",
+  "permite",
+  "concellos",
+  "crear",
+  "menor",
+  "saúde",
+  "coñecemento",
+  "dirección",
+  "seguinte",
+  "costa",
+  "m",
+  "artigo",
+  "deu",
+  "propiedades",
+  "causa",
+  "fundamental",
+  "paz",
+  "pequeno",
+  "principio",
+  "dá",
+  "haberá",
+  "principalmente",
+  "puntos",
+  "volta",
+  "Terra",
+  "Trátase",
+  "fora",
+  "letras",
+  "razóns",
+  "lado",
+  "cabo",
+  "coñecidos",
+  "diversos",
+  "estudos",
+  "imaxes",
+  "22 de decembro",
+  "terá",
+  "aquí",
+  "ideas",
+  "Nesta",
+  "Academia",
+  "Imperio",
+  "coñecer",
+  "arte",
+  "poida",
+  "bo",
+  "of",
+  "propios",
+  "Castro",
+  "abril",
+  "pasado",
+  "aplicación",
+  "seguintes",
+  "xenes",
+  "20",
+  "Lei",
+  "escola",
+  "pedra",
+  "Reino",
+  "Ourense",
+  "soa",
+  "30",
+  "Sábado",
+  "metros",
+  "proteína",
+  "tomar",
+  "arredor",
+  "programa",
+  "ollos",
+  "teoría",
+  "tódalas",
+  "antigo",
+  "leis",
+  "lugares",
+  "textos",
+  "cancións",
+  "modo",
+  "autoridade",
+  "manter",
+  "material",
+  "falta",
+  "km²",
+  "Gran",
+  "poderá",
+  "esquerda",
+  "liñas",
+  "linguaxe",
+  "viaxe",
+  "Desde",
+  "propias",
+  "Xesús",
+  "recibiu",
+  "15",
+  "baixa",
+  "nada",
+  "personaxes",
+  "14",
+  "últimos",
+  "participar",
+  "lonxitude",
+  "proxectos",
+  "pódese",
+  "accións",
+  "contido",
+  "redor",
+  "Asemblea",
+  "representantes",
+  "libros",
+  "obxectos",
+  "restos",
+  "ácido",
+  "naturais",
+  "texto",
+  "atopa",
+  "madeira",
+  "semana",
+  "Debido",
+  "futuro",
+  "versión",
+  "Tras",
+  "algunha",
+  "bandeira",
+  "fonte",
+  "proba",
+  "Pedro",
+  "metade",
+  "movementos",
+  "segue",
+  "puido",
+  "vía",
+  "Á",
+  "25",
+  "4",
+  "ataques",
+  "coñece",
+  "familias",
+  "posto",
+  "chan",
+  "doutros",
+  "forman",
+  "longa",
+  "luz",
+  "motivos",
+  "Cada",
+  "branca",
+  "estilo",
+  "mes",
+  "aqueles",
+  "artigos",
+  "atopar",
+  "lingüística",
+  "pezas",
+  "tempos",
+  "contén",
+  "levar",
+  "única",
+  "campaña",
+  "economía",
+  "Premio",
+  "meses",
+  "categoría",
+  "contacto",
+  "resultado",
+  "formar",
+  "produtos",
+  "Roma",
+  "decisión",
+  "escrita",
+  "partidos",
+  "XX",
+  "Nacional",
+  "efecto",
+  "equipos",
+  "posíbel",
+  "tiveron",
+  "aparece",
+  "converteuse",
+  "tipos",
+  "XIX",
+  "antigos",
+  "resposta",
+  "12",
+  "esforzo",
+  "6",
+  "mostra",
+  "Galego",
+  "amplo",
+  "efectos",
+  "grego",
+  "infancia",
+  "malia",
+  "xogadores",
+  "distintas",
+  "masa",
+  "xustiza",
+  "adiante",
+  "española",
+  "poderán",
+  "significa",
+  "recibir",
+  "horas",
+  "sexo",
+  "fala",
+  "igualdade",
+  "Algunhas",
+  "militar",
+  "particular",
+  "Moitos",
+  "Xoán",
+  "adoita",
+  "adoitan",
+  "leste",
+  "variedade",
+  "Francisco",
+  "exterior",
+  "data",
+  "identidade",
+  "2007",
+  "altura",
+  "supón",
+  "tradicional",
+  "deseño",
+  "había",
+  "cambios",
+  "vista",
+  "populares",
+  "Fernando",
+  "políticos",
+  "xuízo",
+  "Rodríguez",
+  "cambiar",
+  "modelo",
+  "Antonio",
+  "Deste",
+  "Logo",
+  "evitar",
+  "irmáns",
+  "PP",
+  "proposta",
+  "18",
+  "chega",
+  "nosos",
+  "vitoria",
+  "entrada",
+  "certo",
+  "pel",
+  "bastante",
+  "niveis",
+  "delas",
+  "grao",
+  "poesía",
+  "Estados",
+  "coñecidas",
+  "seis",
+  "semellante",
+  "23",
+  "PPdeG",
+  "Nacións",
+  "investigación",
+  "pasar",
+  "significado",
+  "flores",
+  "2011",
+  "científico",
+  "escudo",
+  "problema",
+};
+const uint16_t WA_FREQ_51_RANKS[] = {
+  0, 177, 28, 0, 0, 416, 0, 0, 0, 270, 617, 729, 317, 0, 265, 394,
+  13, 514, 219, 592, 647, 753, 0, 0, 0, 0, 0, 0, 0, 0, 702, 862,
+  282, 0, 898, 598, 619, 0, 677, 418, 948, 352, 894, 978, 169, 747, 0, 0,
+  0, 0, 976, 123, 776, 0, 0, 959, 0, 552, 972, 982, 110, 0, 793, 0,
+  0, 223, 0, 924, 0, 10, 233, 263, 304, 0, 0, 186, 1, 879, 423, 693,
+  0, 665, 742, 0, 837, 47, 0, 326, 891, 612, 864, 762, 0, 0, 0, 0,
+  171, 624, 906, 811, 636, 183, 920, 0, 0, 168, 189, 372, 849, 0, 0, 0,
+  444, 222, 350, 0, 939, 0, 469, 0, 254, 483, 225, 53, 229, 327, 458, 784,
+  162, 271, 671, 672, 675, 756, 31, 0, 0, 574, 91, 802, 573, 0, 0, 0,
+  0, 391, 848, 909, 0, 980, 176, 58, 361, 0, 0, 179, 16, 93, 0, 0,
+  0, 0, 0, 701, 0, 0, 0, 0, 244, 925, 395, 0, 0, 0, 0, 388,
+  782, 896, 121, 0, 0, 877, 39, 430, 996, 0, 0, 0, 48, 490, 646, 465,
+  464, 522, 778, 798, 682, 870, 0, 0, 421, 0, 0, 0, 81, 0, 0, 620,
+  0, 585, 640, 0, 0, 844, 0, 628, 0, 946, 151, 131, 432, 172, 0, 0,
+  0, 0, 284, 419, 63, 115, 588, 875, 0, 525, 0, 0, 0, 167, 0, 148,
+  977, 626, 0, 0, 0, 0, 377, 486, 637, 44, 0, 0, 0, 825, 166, 479,
+  243, 0, 0, 643, 0, 0, 0, 307, 113, 325, 823, 0, 0, 491, 217, 374,
+  0, 0, 0, 60, 0, 963, 0, 0, 314, 569, 871, 0, 101, 0, 0, 0,
+  0, 0, 0, 0, 368, 0, 208, 758, 670, 935, 0, 0, 0, 0, 0, 876,
+  957, 0, 0, 264, 0, 0, 0, 474, 0, 859, 0, 0, 0, 0, 298, 332,
+  638, 155, 0, 554, 363, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 146,
+  0, 0, 812, 0, 727, 194, 507, 0, 0, 575, 788, 668, 953, 0, 0, 0,
+  0, 0, 296, 0, 0, 901, 534, 508, 65, 822, 850, 0, 0, 0, 922, 248,
+  266, 0, 0, 378, 0, 0, 0, 0, 964, 0, 0, 0, 0, 0, 316, 683,
+  0, 0, 0, 979, 0, 0, 106, 448, 454, 882, 676, 0, 0, 0, 0, 323,
+  0, 77, 0, 0, 18, 35, 164, 880, 0, 0, 0, 0, 0, 315, 902, 0,
+  199, 0, 133, 0, 0, 252, 0, 0, 0, 0, 0, 0, 824, 0, 0, 0,
+  0, 0, 0, 4, 641, 703, 210, 847, 931, 801, 834, 23, 130, 477, 780, 820,
+  0, 76, 0, 0, 0, 286, 0, 0, 955, 0, 597, 0, 245, 275, 338, 403,
+  563, 698, 952, 0, 0, 435, 773, 0, 715, 0, 0, 889, 0, 0, 0, 0,
+  0, 0, 434, 406, 707, 362, 237, 163, 0, 799, 818, 764, 0, 224, 910, 0,
+  19, 493, 0, 478, 0, 389, 379, 0, 129, 919, 0, 567, 496, 98, 0, 399,
+  528, 0, 0, 0, 0, 64, 95, 0, 688, 0, 0, 540, 600, 0, 481, 609,
+  343, 774, 499, 842, 873, 0, 0, 0, 0, 425, 0, 0, 662, 968, 0, 607,
+  807, 616, 763, 0, 0, 134, 830, 0, 0, 0, 0, 0, 981, 0, 0, 923,
+  0, 0, 0, 0, 0, 452, 548, 128, 111, 0, 0, 185, 226, 771, 83, 173,
+  334, 152, 439, 622, 0, 0, 104, 0, 0, 0, 0, 787, 0, 426, 544, 725,
+  0, 0, 139, 836, 0, 0, 279, 0, 0, 0, 0, 975, 0, 904, 0, 0,
+  216, 393, 87, 433, 887, 0, 690, 884, 936, 253, 570, 583, 67, 0, 0, 869,
+  197, 124, 424, 673, 33, 0, 945, 518, 0, 0, 0, 0, 0, 728, 0, 178,
+  0, 420, 795, 708, 651, 302, 488, 46, 340, 761, 0, 0, 390, 0, 0, 0,
+  0, 321, 739, 833, 674, 843, 808, 149, 0, 0, 0, 0, 878, 0, 0, 829,
+  329, 0, 0, 0, 17, 422, 821, 0, 0, 0, 0, 0, 614, 102, 0, 0,
+  0, 71, 655, 0, 721, 990, 0, 0, 144, 150, 170, 593, 0, 143, 447, 92,
+  903, 0, 0, 0, 147, 382, 0, 853, 969, 495, 0, 689, 278, 0, 240, 59,
+  716, 0, 431, 0, 0, 0, 0, 0, 0, 0, 0, 103, 0, 0, 0, 719,
+  0, 0, 228, 0, 0, 0, 54, 606, 755, 0, 260, 0, 342, 861, 0, 0,
+  966, 0, 258, 0, 238, 0, 947, 472, 319, 0, 0, 0, 0, 0, 0, 88,
+  0, 0, 0, 369, 0, 835, 0, 984, 0, 0, 0, 231, 376, 0, 0, 0,
+  211, 0, 0, 0, 0, 0, 0, 0, 336, 0, 299, 0, 456, 623, 805, 0,
+  949, 6, 475, 0, 204, 380, 351, 865, 0, 0, 803, 854, 0, 0, 685, 0,
+  0, 897, 107, 0, 0, 995, 0, 746, 695, 112, 603, 618, 625, 678, 687, 553,
+  57, 796, 866, 30, 371, 462, 0, 0, 0, 158, 0, 357, 120, 355, 659, 401,
+  246, 84, 789, 883, 0, 135, 0, 0, 0, 0, 0, 867, 0, 0, 218, 0,
+  0, 987, 654, 0, 0, 0, 1000, 0, 0, 0, 37, 686, 0, 174, 0, 0,
+  0, 0, 341, 0, 0, 0, 290, 0, 0, 0, 0, 0, 0, 556, 386, 0,
+  0, 69, 463, 510, 79, 642, 0, 0, 0, 0, 257, 0, 0, 0, 0, 273,
+  82, 100, 0, 0, 405, 0, 0, 453, 70, 0, 0, 0, 0, 841, 0, 0,
+  461, 0, 0, 331, 0, 0, 0, 0, 0, 0, 961, 0, 0, 0, 0, 407,
+  730, 0, 0, 0, 385, 451, 712, 0, 0, 0, 0, 0, 0, 0, 0, 810,
+  0, 0, 0, 0, 0, 684, 0, 0, 0, 937, 0, 0, 863, 589, 417, 0,
+  295, 0, 0, 0, 0, 73, 337, 56, 236, 631, 916, 667, 700, 198, 988, 312,
+  581, 608, 0, 0, 0, 0, 230, 0, 96, 480, 530, 0, 0, 571, 0, 0,
+  220, 516, 0, 0, 0, 61, 137, 182, 757, 908, 0, 50, 122, 754, 0, 726,
+  0, 0, 0, 306, 397, 926, 256, 0, 0, 0, 24, 0, 737, 0, 0, 0,
+  0, 0, 0, 0, 280, 562, 0, 0, 181, 711, 0, 0, 0, 200, 602, 354,
+  705, 852, 934, 0, 0, 0, 521, 0, 74, 0, 0, 0, 0, 0, 0, 272,
+  450, 0, 0, 0, 0, 0, 0, 551, 207, 293, 0, 322, 318, 353, 365, 501,
+  568, 0, 396, 621, 839, 944, 213, 0, 523, 0, 590, 744, 0, 697, 827, 160,
+  165, 0, 0, 29, 644, 561, 0, 89, 0, 0, 0, 0, 0, 748, 97, 12,
+  72, 557, 0, 0, 241, 983, 0, 346, 781, 0, 482, 0, 0, 85, 710, 0,
+  0, 0, 0, 0, 0, 0, 0, 751, 0, 0, 0, 0, 126, 921, 0, 0,
+  0, 0, 0, 0, 0, 0, 734, 956, 0, 86, 0, 0, 0, 0, 159, 442,
+  513, 0, 184, 109, 0, 0, 0, 470, 515, 974, 0, 2, 440, 0, 998, 735,
+  611, 498, 0, 0, 0, 542, 0, 0, 0, 0, 0, 0, 0, 511, 815, 0,
+  0, 261, 489, 0, 856, 892, 0, 0, 555, 669, 918, 0, 0, 0, 0, 0,
+  0, 0, 40, 0, 27, 383, 527, 731, 0, 658, 572, 743, 0, 0, 577, 0,
+  0, 0, 0, 0, 0, 905, 0, 0, 221, 0, 0, 51, 0, 0, 722, 485,
+  656, 274, 840, 941, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 629, 0,
+  0, 476, 633, 9, 288, 313, 584, 0, 310, 576, 301, 0, 0, 538, 324, 141,
+  0, 0, 0, 287, 413, 503, 524, 0, 0, 927, 0, 0, 0, 0, 0, 0,
+  536, 294, 0, 0, 0, 36, 0, 0, 0, 0, 0, 0, 0, 0, 752, 364,
+  504, 0, 0, 596, 269, 0, 0, 0, 0, 0, 652, 45, 235, 0, 0, 991,
+  0, 578, 632, 446, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 267, 767, 938, 358, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  190, 639, 0, 0, 531, 992, 0, 630, 681, 0, 398, 0, 605, 0, 161, 526,
+  0, 0, 0, 305, 0, 202, 785, 0, 118, 0, 94, 0, 117, 212, 375, 0,
+  0, 0, 0, 0, 335, 497, 0, 0, 0, 0, 766, 0, 582, 0, 127, 0,
+  0, 0, 0, 250, 34, 819, 0, 0, 402, 0, 0, 0, 0, 512, 547, 586,
+  709, 0, 0, 66, 587, 0, 0, 55, 0, 0, 0, 509, 0, 0, 347, 0,
+  0, 187, 0, 549, 745, 545, 0, 0, 0, 0, 297, 0, 0, 0, 0, 412,
+  193, 52, 0, 0, 116, 0, 0, 601, 0, 0, 0, 564, 932, 0, 696, 384,
+  0, 806, 0, 0, 0, 0, 0, 860, 800, 809, 895, 0, 505, 0, 0, 0,
+  0, 765, 958, 857, 0, 251, 292, 772, 0, 0, 851, 929, 650, 794, 933, 960,
+  0, 303, 0, 691, 0, 0, 0, 0, 790, 0, 0, 0, 328, 0, 0, 344,
+  0, 411, 0, 0, 119, 0, 0, 311, 962, 0, 0, 0, 0, 0, 0, 0,
+  0, 664, 868, 359, 775, 105, 156, 816, 994, 467, 0, 0, 0, 209, 0, 0,
+  0, 0, 0, 888, 0, 0, 26, 0, 320, 289, 940, 0, 0, 0, 0, 0,
+  205, 441, 459, 0, 0, 0, 714, 0, 741, 0, 49, 247, 125, 724, 817, 723,
+  828, 487, 494, 912, 0, 0, 404, 0, 32, 0, 0, 0, 427, 41, 492, 309,
+  886, 653, 0, 740, 0, 0, 537, 550, 826, 0, 0, 203, 770, 0, 0, 760,
+  594, 0, 255, 428, 718, 0, 546, 281, 0, 78, 0, 0, 890, 950, 14, 455,
+  604, 749, 0, 0, 0, 0, 0, 0, 0, 657, 661, 138, 99, 579, 0, 0,
+  791, 0, 533, 5, 804, 831, 90, 951, 627, 0, 0, 0, 566, 0, 0, 0,
+  0, 0, 68, 0, 881, 954, 965, 0, 449, 0, 0, 62, 438, 0, 591, 786,
+  967, 0, 0, 0, 20, 43, 457, 666, 885, 893, 0, 0, 460, 0, 0, 15,
+  0, 0, 0, 0, 0, 0, 0, 529, 214, 999, 0, 408, 0, 468, 732, 484,
+  872, 38, 283, 196, 242, 392, 206, 519, 541, 188, 680, 769, 797, 0, 736, 0,
+  0, 997, 180, 191, 645, 356, 792, 21, 845, 635, 900, 0, 215, 0, 0, 0,
+  0, 195, 0, 227, 360, 858, 330, 0, 249, 262, 0, 943, 713, 899, 0, 348,
+  970, 738, 410, 0, 0, 0, 140, 660, 0, 0, 429, 0, 0, 777, 814, 0,
+  259, 11, 0, 0, 559, 779, 0, 0, 0, 0, 855, 0, 0, 535, 0, 0,
+  136, 615, 75, 0, 0, 0, 993, 0, 0, 0, 706, 543, 973, 648, 0, 907,
+  750, 114, 915, 0, 0, 0, 0, 532, 239, 539, 694, 986, 373, 0, 0, 42,
+  0, 0, 0, 0, 339, 0, 0, 874, 285, 0, 0, 0, 0, 308, 838, 0,
+  692, 0, 0, 0, 345, 985, 0, 142, 0, 0, 0, 0, 0, 0, 414, 445,
+  649, 704, 720, 0, 157, 0, 0, 0, 558, 0, 0, 0, 0, 0, 0, 443,
+  699, 0, 0, 717, 846, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 599, 832, 0, 0, 0, 0, 0, 108, 0, 0, 0,
+  0, 409, 0, 0, 0, 0, 0, 0, 0, 192, 333, 387, 8, 0, 0, 0,
+  813, 942, 0, 0, 80, 500, 0, 0, 381, 0, 153, 0, 0, 0, 291, 0,
+  367, 0, 466, 580, 234, 370, 610, 502, 517, 0, 0, 0, 634, 0, 0, 0,
+  0, 0, 565, 0, 0, 663, 154, 175, 3, 471, 132, 917, 0, 0, 0, 0,
+  0, 0, 349, 911, 0, 277, 595, 0, 0, 437, 0, 0, 0, 0, 366, 0,
+  0, 0, 914, 733, 613, 928, 930, 0, 0, 0, 473, 0, 0, 276, 0, 0,
+  0, 7, 145, 415, 768, 0, 0, 506, 520, 560, 913, 971, 0, 201, 0, 0,
+  0, 436, 0, 0, 0, 0, 0, 300, 0, 0, 0, 0, 0, 0, 0, 0,
+  268, 22, 679, 783, 0, 989, 0, 0, 0, 400, 0, 759, 0, 232, 25, 0,
+};
+
+const char *WA_FREQ_52_TOKENS[] = {
+  "ha",
+  "avei",
+  "pe",
+  "peteĩ",
+  "umi",
+  "de",
+  "ary",
+  "ko",
+  "heta",
+  "rupi",
+  "oĩ",
+  "ha'e",
+  "mba’e",
+  "upe",
+  "ha’e",
+  "Ko",
+  "térã",
+  "táva",
+  "hag̃ua",
+  "ára",
+  "jave",
+  "oiko",
+  "katu",
+  "rehegua",
+  "ambue",
+  "guive",
+  "rehe",
+  "porã",
+  "guasu",
+  "chupe",
+  "yvy",
+  "hikuái",
+  "peve",
+  "ñane",
+  "tenda",
+  "oguereko",
+  "gotyo",
+  "tetã",
+  "ikatu",
+  "ñande",
+  "ndive",
+  "ramo",
+  "va’ekue",
+  "rire",
+  "ava",
+  "y",
+  "la",
+  "pegua",
+  "mymba",
+  "hérava",
+  "Paraguái",
+  "tapicha",
+  "hagua",
+  "San",
+  "apytépe",
+  "ojapo",
+  "niko",
+  "rupive",
+  "oĩva",
+  "del",
+  "Guarani",
+  "Ary",
+  "karai",
+  "haguã",
+  "retãme",
+  "tembiapo",
+  "tape",
+  "Pe",
+  "opa",
+  "ñe’ẽ",
+  "kuéra",
+  "ári",
+  "hese",
+  "oho",
+  "upépe",
+  "Umi",
+  "ichupe",
+  "ñe'ẽ",
+  "Oĩ",
+  "ysyry",
+  "opyta",
+  "mokõi",
+  "aty",
+  "Upe",
+  "Péicha",
+  "péicha",
+  "yvyra",
+  "oikóva",
+  "távape",
+  "ojejapo",
+  "Avei",
+  "ha’éva",
+  "hína",
+  "he’i",
+  "ou",
+  "guare",
+  "jey",
+  "Ha’e",
+  "ko’ã",
+  "José",
+  "oñepyrũ",
+  "voi",
+  "Paraguaýpe",
+  "retã",
+  "upéicha",
+  "mba'e",
+  "Heta",
+  "Juan",
+  "oike",
+  "guarã",
+  "Ha",
+  "tetãvore",
+  "Paraguay",
+  "che",
+  "héra",
+  "osẽ",
+  "aja",
+  "López",
+  "kóva",
+  "óga",
+  "oreko",
+  "hague",
+  "omba’apo",
+  "arygua",
+  "chupekuéra",
+  "kuña",
+  "hetave",
+  "terã",
+  "mbohapy",
+  "opaite",
+  "péva",
+  "upéi",
+  "Paraguáipe",
+  "Ára",
+  "ha’ekuéra",
+  "ohechauka",
+  "orekóva",
+  "reko",
+  "Kóva",
+  "heñói",
+  "jepe",
+  "Ha'e",
+  "oguerekóva",
+  "Peteĩ",
+  "Tetã",
+  "opaichagua",
+  "pyahu",
+  "Carlos",
+  "jajuhu",
+  "ka’aguy",
+  "guyra",
+  "mboyve",
+  "ohasa",
+  "mba’éichapa",
+  "Antonio",
+  "tuichavéva",
+  "yvypóra",
+  "La",
+  "yvate",
+  "umíva",
+  "chugui",
+  "El",
+  "tembi’u",
+  "ha'ehína",
+  "opavave",
+  "oúva",
+  "peteĩha",
+  "tapichakuéra",
+  "hetaiterei",
+  "pukukue",
+  "arandu",
+  "ipype",
+  "mitã",
+  "omano",
+  "Ko’ã",
+  "Francisco",
+  "hembiapo",
+  "ape",
+  "upéva",
+  "yvyty",
+  "ku",
+  "oipuru",
+  "katuete",
+  "kuimba’e",
+  "oguahẽ",
+  "tekove",
+  "Upépe",
+  "ojejapóva",
+  "yma",
+  "María",
+  "ohóvo",
+  "herava",
+  "ohai",
+  "gueteri",
+  "kuarahy",
+  "meve",
+  "máva",
+  "oñemoĩ",
+  "upévare",
+  "Pedro",
+  "oje’e",
+  "ñembýpe",
+  "ñe’ẽte",
+  "Táva",
+  "oĩha",
+  "téra",
+  "ñorairõ",
+  "Guasu",
+  "Oguereko",
+  "Upéicha",
+  "oikuaa",
+  "tavayguakuéra",
+  "árape",
+  "ñandéve",
+  "ningo",
+  "purahéi",
+  "tai",
+  "ko’ãva",
+  "mba’asy",
+  "Ruta",
+  "opytáva",
+  "2010",
+  "Karai",
+  "Marangatu",
+  "hendápe",
+  "javeve",
+  "ndaha’éi",
+  "ohupyty",
+  "tendápe",
+  "Brasil",
+  "vai",
+  "tuicha",
+  "morotĩ",
+  "ryepýpe",
+  "mburuvicha",
+  "ojehecha",
+  "opáichagua",
+  "peteï",
+  "1",
+  "Upéi",
+  "ojekuaa",
+  "tetãme",
+  "hũ",
+  "irundy",
+  "mbo’ehára",
+  "ohóva",
+  "Ko’ãva",
+  "en",
+  "ñe’ẽpehẽtai",
+  "avakuéra",
+  "nde",
+  "renda",
+  "tuichakue",
+  "akue",
+  "hendive",
+  "jasyapy",
+  "mante",
+  "tero",
+  "ypykue",
+  "g̃uarã",
+  "jasyrundy",
+  "kuri",
+  "tupão",
+  "Ikatu",
+  "haguére",
+  "Ava",
+  "Guaraníme",
+  "Villa",
+  "hekove",
+  "omba’apóva",
+  "a",
+  "ani",
+  "ichugui",
+  "katupyry",
+  "los",
+  "ome’ẽ",
+  "pohã",
+  "Chaco",
+  "arýpe",
+  "guarani",
+  "jasykõi",
+  "ko’ápe",
+  "ojapóva",
+  "oñembohéra",
+  "oñondive",
+  "tekoha",
+  "Kachíke",
+  "Solano",
+  "Yvy",
+  "ikatúva",
+  "osẽva",
+  "Ñande",
+  "hete",
+  "jasyteĩ",
+  "ojehu",
+  "oñangareko",
+  "Ambue",
+  "el",
+  "mayma",
+  "mokõiha",
+  "mymbakuéra",
+  "ypy",
+  "aranduka",
+  "ojepuru",
+  "rembiapo",
+  "Dr",
+  "Guerra",
+  "Ha’ekuéra",
+  "Pindorama",
+  "Santa",
+  "ko’árupi",
+  "pehẽngue",
+  "peteĩva",
+  "temiandu",
+  "Upévare",
+  "gui",
+  "ñepyrũ",
+  "oñemohenda",
+  "tee",
+  "va’erã",
+  "isy",
+  "ko’ág̃a",
+  "mbarete",
+  "mbytépe",
+  "ndaikatúi",
+  "oikove",
+  "ojeheróva",
+  "tekotevẽ",
+  "Péva",
+  "achegety",
+  "asy",
+  "km",
+  "michĩ",
+  "omoheñói",
+  "rape",
+  "tavaguasu",
+  "tuicháva",
+  "Francia",
+  "Ysyry",
+  "ha’ehína",
+  "he’ise",
+  "kavaju",
+  "puku",
+  "teko",
+  "yva",
+  "Argentina",
+  "amo",
+  "aravo",
+  "iporã",
+  "nunga",
+  "Buenos",
+  "Kuarahy",
+  "Oiko",
+  "Poyvi",
+  "Tupã",
+  "iporãva",
+  "ndaje",
+  "ogueraha",
+  "oime",
+  "oipytyvõ",
+  "reheve",
+  "rete",
+  "vaka",
+  "ñe’ẽpoty",
+  "González",
+  "hembiapokue",
+  "hina",
+  "jasypoapy",
+  "ja’e",
+  "ohecha",
+  "ombohovái",
+  "ñana",
+  "Félix",
+  "he’íva",
+  "oipurúva",
+  "tendáre",
+  "ypykuéra",
+  "Lengua",
+  "ha’eha",
+  "he'i",
+  "itúva",
+  "oñemoarandu",
+  "upérõ",
+  "ñu",
+  "Itúva",
+  "Manuel",
+  "ha´e",
+  "jasy",
+  "jasypa",
+  "mbo’ehao",
+  "pu’ae",
+  "pype",
+  "Nacional",
+  "Techapyrã",
+  "Tupão",
+  "ambuéva",
+  "jasypo",
+  "ka’avo",
+  "gua",
+  "henda",
+  "jahecha",
+  "kokuépe",
+  "mba’eve",
+  "mitãrusu",
+  "mombyry",
+  "oikova’ekue",
+  "tetãvore’i",
+  "ykére",
+  "Che",
+  "España",
+  "ha’eva’ekue",
+  "jerére",
+  "kamby",
+  "kuñakarai",
+  "marangatu",
+  "mba’épa",
+  "ojeporu",
+  "pa’i",
+  "sy",
+  "Asunción",
+  "Triple",
+  "haguépe",
+  "jepémo",
+  "mba’éva",
+  "yvytu",
+  "Fernando",
+  "Ko’ápe",
+  "Luis",
+  "kóicha",
+  "marandu",
+  "oĩháme",
+  "ñe’ẽme",
+  "Guaraní",
+  "Tupãsy",
+  "he’iséva",
+  "ita",
+  "juehegua",
+  "ka'avo",
+  "mba’épe",
+  "mbo’ehaópe",
+  "omotenonde",
+  "oñeha’ã",
+  "rekove",
+  "réra",
+  "ymaguare",
+  "Concepción",
+  "Europape",
+  "Omano",
+  "avati",
+  "hesekuéra",
+  "ja’ekuaa",
+  "ohasáva",
+  "ojupi",
+  "okambúva",
+  "omoĩ",
+  "Mariscal",
+  "Ohai",
+  "hákatu",
+  "km²",
+  "ohechaukáva",
+  "oikovéva",
+  "pira",
+  "pytã",
+  "rembe’ýpe",
+  "Ayala",
+  "Cerro",
+  "Hesu",
+  "Opa",
+  "Rodríguez",
+  "haimete",
+  "hamba’e",
+  "ko'ã",
+  "oguata",
+  "renondépe",
+  "ryguasu",
+  "tendota",
+  "tuichave",
+  "vore",
+  "ymave",
+  "ãva",
+  "10",
+  "15",
+  "Parana",
+  "avave",
+  "jaikuaa",
+  "kure",
+  "ndaipóri",
+  "ojuhu",
+  "reta",
+  "ro'y",
+  "techapyrã",
+  "12",
+  "8",
+  "Arte",
+  "araka’eve",
+  "ho’a",
+  "jasyporundy",
+  "kuatia",
+  "mborayhu",
+  "og̃uahẽ",
+  "omoñepyrũ",
+  "Ñane",
+  "ñembosarái",
+  "30",
+  "Alianza",
+  "Gaspar",
+  "Paraguaýgui",
+  "Pa’i",
+  "chipa",
+  "derecho",
+  "herakuã",
+  "hóga",
+  "mbohapyha",
+  "mokõipa",
+  "ojogua",
+  "pa",
+  "paha",
+  "po",
+  "pokõi",
+  "tĩgua",
+  "upevarã",
+  "yvýpe",
+  "ñe’ẽpapára",
+  "Oñepyrũ",
+  "akóinte",
+  "añoite",
+  "haihára",
+  "jehai",
+  "ogueru",
+  "ohaíkuri",
+  "ojeguereko",
+  "oñeme’ẽ",
+  "peteî",
+  "tavusu",
+  "tenondegua",
+  "Ñorairõ",
+  "Cardozo",
+  "ao",
+  "avañe’ẽ",
+  "hemiandu",
+  "ijyvy",
+  "imemby",
+  "ka’a",
+  "ka’aguýre",
+  "kuimba'e",
+  "okaháre",
+  "omenda",
+  "porãva",
+  "pópe",
+  "rembiapokue",
+  "resẽ",
+  "sa",
+  "viru",
+  "ñemoñare",
+  "ñe’ẽtéva",
+  "25",
+  "3",
+  "Aires",
+  "Héra",
+  "Mymba",
+  "Puerto",
+  "ha’ete",
+  "hendáicha",
+  "ipu",
+  "iñambue",
+  "jaipuru",
+  "jasypokõi",
+  "oheja",
+  "oheka",
+  "oiméva",
+  "ojuka",
+  "poguýpe",
+  "porãve",
+  "remiandu",
+  "térâ",
+  "14",
+  "2",
+  "Caballero",
+  "Santiago",
+  "ae",
+  "heko",
+  "ikatuha",
+  "jasypoteĩ",
+  "jeko",
+  "mbyte",
+  "ogueraháva",
+  "ome’ẽva",
+  "omombe’u",
+  "pya’e",
+  "upégui",
+  "Art.",
+  "Iporã",
+  "Jepémo",
+  "Peru",
+  "jajuhukuaa",
+  "kuatiahaipyre",
+  "mandyju",
+  "ojehero",
+  "ojejuhu",
+  "ruvicha",
+  "tava",
+  "tavaygua",
+  "ta’anga",
+  "upérupi",
+  "áva",
+  "7",
+  "Amérikagua",
+  "Avakuaaty",
+  "Don",
+  "General",
+  "Guaraní”",
+  "Martínez",
+  "Mcal",
+  "Miguel",
+  "Museo",
+  "Upérõ",
+  "are",
+  "guýpe",
+  "hapicha",
+  "hasy",
+  "hekopete",
+  "hetã",
+  "hápe",
+  "korapy",
+  "mba’apo",
+  "mimi",
+  "oguejy",
+  "ojepurúva",
+  "ojeréva",
+  "ova",
+  "pa’ũme",
+  "puru",
+  "su",
+  "tavakuéra",
+  "uperire",
+  "vove",
+  "24",
+  "6",
+  "Diccionario",
+  "Paraguaigua",
+  "añetehápe",
+  "distrito",
+  "guasúpe",
+  "he'ise",
+  "m",
+  "mba’eichaitépa",
+  "mávapa",
+  "o",
+  "omotenondéva",
+  "peteĩháme",
+  "pyhare",
+  "rérape",
+  "róga",
+  "tembipuru",
+  "tendagua",
+  "umía",
+  "Flores",
+  "Upéva",
+  "apytégui",
+  "avano’õ",
+  "añete",
+  "haguáicha",
+  "ho’u",
+  "ikatuhápe",
+  "ikatupyry",
+  "jasypateĩ",
+  "jepokuaa",
+  "jevy",
+  "juky",
+  "omba'apo",
+  "oĩhápe",
+  "paraguaya",
+  "pundie",
+  "pépe",
+  "ra’y",
+  "taha’e",
+  "tembiasakue",
+  "ymaite",
+  "ypa'ũ",
+  "ysaja",
+  "ã",
+  "ñe'ẽme",
+  "ñe’ẽjoaju",
+  "20",
+  "Blás",
+  "Itavusu",
+  "Mburuvicha",
+  "Paso",
+  "Rosa",
+  "guasuete",
+  "jopói",
+  "mba'asy",
+  "mba’yruguata",
+  "mba’ére",
+  "memby",
+  "ojegueraha",
+  "ojerure",
+  "okakuaa",
+  "okaru",
+  "pirapire",
+  "rei",
+  "va'ekue",
+  "ñemuha",
+  "11",
+  "13",
+  "16",
+  "4",
+  "Cordillera",
+  "Heñói",
+  "I",
+  "Mora",
+  "Oje’e",
+  "Omenda",
+  "Pérez",
+  "apo",
+  "hagua",
+  "he’iháicha",
+  "hovy",
+  "iporãvéva",
+  "irundyha",
+  "kokue",
+  "ko’ága",
+  "mbohapypa",
+  "oguahẽva",
+  "ohaiva’ekue",
+  "oikoha",
+  "ojeporúva",
+  "oky",
+  "ombohasa",
+  "ombohéra",
+  "oporandu",
+  "paraguái",
+  "poapy",
+  "pytagua",
+  "rógape",
+  "tembiporu",
+  "yperana",
+  "ñe'ẽnguéra",
+  "ñe’ẽtekuaa",
+  "ñorãirõ",
+  "1950",
+  "21",
+  "28",
+  "Amérika",
+  "Coronel",
+  "Estigarribia",
+  "Kuña",
+  "Uperire",
+  "akã",
+  "apópe",
+  "año",
+  "chéve",
+  "ijerére",
+  "imbarete",
+  "karaiñe'ẽ",
+  "kesu",
+  "kuaa",
+  "las",
+  "mitãkuña",
+  "ohechakuaa",
+  "ombojoaju",
+  "ombyaty",
+  "omohenda",
+  "omopyenda",
+  "oñemopyenda",
+  "oĩgui",
+  "poyvi",
+  "tembi'u",
+  "upéichante",
+  "ápe",
+  "18",
+  "5",
+  "Acosta",
+  "India",
+  "Péa",
+  "apoha",
+  "arahaku",
+  "arte",
+  "iñemoarandu",
+  "jajapo",
+  "jasypakõi",
+  "mandi’o",
+  "mba’yru",
+  "ndéve",
+  "oguerekova",
+  "oikéva",
+  "oimeraẽ",
+  "ojeiko",
+  "ojere",
+  "onohẽ",
+  "opavavépe",
+  "opurahéi",
+  "pa’ũ",
+  "raka’e",
+  "rembiasa",
+  "sa’i",
+  "upekuévo",
+  "vy’a",
+  "ñemohenda",
+  "Avañe'ẽ",
+  "Jasy",
+  "John",
+  "Peteĩha",
+  "Ramón",
+  "atýpe",
+  "hetaite",
+  "háicha",
+  "i",
+  "itavusu",
+  "mba'épa",
+  "mbaraka",
+  "mokõive",
+  "moĩmbaha",
+  "ogakuéra",
+  "ojehechakuaa",
+  "ojeho",
+  "omoambue",
+  "omohechauka",
+  "oñemba’apo",
+  "pire",
+  "py’a",
+  "sa’y",
+  "teroja",
+  "tuja",
+  "túva",
+  "Ñembosaraipavẽ",
+  "ñemoarandu",
+  "1870",
+  "Cruz",
+  "Hembiapo",
+  "II",
+  "Ko'ã",
+  "Oreko",
+  "Río",
+  "Yvyra",
+  "aviõ",
+  "añónte",
+  "gueterei",
+  "hasýva",
+  "hembiapópe",
+  "hógape",
+  "ijapopyre",
+  "jare",
+  "jehasa",
+  "jeroky",
+  "ka’irãime",
+  "kurusu",
+  "ohaíva",
+  "ojeipuru",
+  "ojekuaavéva",
+  "oñembohérava",
+  "peteĩteĩ",
+  "poteĩ",
+  "po’i",
+  "retepy",
+  "rupi’a",
+  "tembiapópe",
+  "tenonde",
+  "upeigua",
+  "ñemitỹ",
+  "23",
+  "26",
+  "9",
+  "Aty",
+  "Bertoni",
+  "Fernández",
+  "Grande",
+  "Guaranikuéra",
+  "Joaquín",
+  "Ko’ág̃a",
+  "Loma",
+  "Misiones",
+  "Montoya",
+  "Ndaipóri",
+  "Opaite",
+  "Paraguarí",
+  "Retã",
+  "Roque",
+  "Ru",
+  "Tape",
+  "Tapichakuéra",
+  "Ymave",
+  "asýva",
+  "do",
+  "e",
+  "haku",
+  "ha’eño",
+  "hogue",
+  "ijojaha’ỹva",
+  "iñe’ẽ",
+  "jagua",
+  "jahechakuaa",
+  "jere",
+  "joguaha",
+  "jára",
+  "kuñataĩ",
+  "mba´e",
+  "oguerúva",
+  "ojoaju",
+  "okápe",
+  "ombopu",
+  "omombe'u",
+  "oĩva’ekue",
+  "para",
+  "pindo",
+  "rekoha",
+  "rendápe",
+  "sa’yju",
+  "so’o",
+  "taipu",
+  "tendárupi",
+  "Ñandejára",
+  "ñe’ẽkuaaty",
+  "19",
+  "Agustín",
+  "Europa",
+  "Mayma",
+  "Mbo’ehára",
+  "Ojapo",
+  "Oñemoarandu",
+  "Paraguari",
+  "R.",
+  "Tetãvore",
+  "The",
+  "Villarrica",
+  "Yvyty",
+  "aporeko",
+  "apu’a",
+  "arapy",
+  "ha'éva",
+  "hekoha",
+  "herava’ekue",
+  "ja’eporãsérõ",
+  "latinañe'ẽ",
+  "mbyjajere",
+  "oipyhy",
+  "ojuehe",
+  "omboguapy",
+  "oñepyrũva",
+  "oñe’ẽva",
+  "paraguayo",
+  "poha",
+  "porãite",
+  "tekoha'ãngandy",
+  "tete",
+  "tuguy",
+  "ypýpe",
+  "yvyramáta",
+  "ág̃a",
+  "ỹrõ",
+  "17",
+  "22",
+  "Andrés",
+  "Bautista",
+  "Fuerte",
+  "García",
+  "Guaira",
+  "Gómez",
+  "Hesukirito",
+  "Hogue",
+  "Hyãsia",
+  "Juana",
+  "Mano",
+  "Oime",
+  "Paulo",
+  "Villeta",
+  "apañuãi",
+  "atyha",
+  "atã",
+  "colonia",
+  "hatã",
+  "hesakã",
+  "jaguereko",
+  "kakuaa",
+  "kuatiáre",
+  "ku’i",
+  "mba'éichapa",
+  "mbyja",
+  "mitãnguéra",
+  "muanduhe",
+  "nda’ipóri",
+  "ndie",
+  "ndikatúi",
+  "oikuaauka",
+  "oisãmbyhy",
+  "ojapova",
+  "ojapova’ekue",
+  "ojehai",
+  "ojekuaáva",
+  "ombojoajúva",
+  "omyakã",
+  "omyakãva",
+  "ovecha",
+  "oñangarekóva",
+  "oñe'ẽ",
+  "oñeñangareko",
+  "oñorairõ",
+  "paraguasu",
+  "pu'ae",
+  "rapicha",
+};
+const uint16_t WA_FREQ_52_RANKS[] = {
+  838, 0, 0, 550, 0, 666, 0, 0, 0, 896, 0, 897, 0, 0, 943, 0,
+  0, 0, 0, 337, 359, 0, 0, 646, 0, 677, 0, 419, 502, 217, 255, 762,
+  416, 983, 989, 0, 0, 369, 176, 610, 0, 0, 0, 973, 796, 0, 0, 0,
+  0, 0, 0, 0, 353, 663, 682, 623, 788, 818, 90, 375, 39, 676, 0, 0,
+  0, 0, 58, 159, 0, 523, 0, 0, 0, 0, 192, 454, 529, 580, 810, 118,
+  936, 0, 0, 674, 325, 913, 269, 804, 0, 0, 466, 203, 569, 531, 594, 606,
+  298, 0, 0, 102, 257, 726, 0, 0, 0, 301, 22, 563, 0, 945, 514, 220,
+  805, 0, 0, 0, 0, 719, 0, 0, 348, 0, 0, 959, 219, 977, 199, 0,
+  0, 720, 0, 819, 319, 0, 201, 534, 0, 0, 0, 0, 242, 0, 909, 254,
+  0, 214, 55, 250, 649, 828, 0, 585, 0, 0, 0, 0, 20, 703, 84, 766,
+  948, 0, 632, 696, 698, 0, 0, 0, 0, 154, 591, 351, 0, 0, 0, 0,
+  0, 0, 258, 746, 0, 0, 36, 532, 620, 396, 445, 817, 846, 968, 750, 222,
+  412, 352, 11, 778, 727, 0, 0, 0, 0, 853, 326, 811, 489, 223, 568, 23,
+  264, 0, 0, 0, 0, 0, 0, 0, 0, 0, 673, 0, 0, 0, 0, 0,
+  843, 0, 191, 791, 0, 0, 64, 0, 0, 0, 0, 0, 290, 871, 0, 0,
+  0, 0, 0, 0, 453, 770, 0, 0, 652, 59, 0, 407, 96, 711, 966, 229,
+  759, 836, 0, 0, 0, 564, 0, 0, 206, 291, 0, 233, 826, 0, 0, 0,
+  0, 141, 114, 0, 510, 97, 490, 0, 231, 433, 927, 0, 105, 0, 0, 0,
+  0, 302, 919, 0, 0, 0, 0, 0, 0, 0, 211, 0, 0, 179, 331, 536,
+  0, 0, 880, 633, 0, 0, 0, 868, 0, 200, 815, 0, 0, 0, 0, 549,
+  0, 0, 0, 0, 951, 857, 0, 0, 0, 0, 0, 0, 0, 881, 0, 207,
+  625, 859, 85, 150, 0, 0, 167, 0, 0, 0, 279, 188, 790, 0, 0, 0,
+  133, 350, 579, 0, 0, 0, 432, 0, 0, 780, 0, 0, 767, 0, 372, 0,
+  42, 0, 665, 0, 829, 379, 66, 136, 143, 469, 0, 384, 748, 0, 0, 0,
+  180, 0, 53, 0, 0, 347, 875, 0, 0, 0, 0, 0, 0, 460, 210, 940,
+  323, 616, 0, 0, 25, 129, 538, 797, 904, 0, 0, 0, 276, 0, 299, 565,
+  0, 0, 0, 0, 0, 321, 244, 0, 0, 0, 0, 0, 0, 0, 506, 0,
+  498, 0, 0, 271, 481, 704, 689, 747, 614, 0, 0, 425, 735, 908, 346, 0,
+  915, 373, 398, 0, 0, 723, 738, 268, 0, 0, 0, 274, 0, 429, 573, 485,
+  903, 297, 955, 0, 0, 34, 0, 0, 0, 303, 0, 0, 0, 0, 474, 0,
+  78, 570, 0, 190, 0, 0, 0, 988, 519, 428, 12, 687, 4, 0, 0, 0,
+  95, 0, 212, 14, 282, 599, 516, 651, 886, 888, 993, 0, 0, 0, 0, 0,
+  361, 0, 654, 0, 830, 695, 0, 330, 0, 0, 391, 139, 293, 784, 996, 0,
+  0, 850, 872, 65, 0, 471, 978, 0, 0, 806, 598, 0, 0, 0, 0, 0,
+  0, 415, 655, 710, 0, 0, 0, 0, 0, 0, 0, 213, 0, 125, 0, 0,
+  0, 683, 0, 0, 0, 0, 158, 33, 488, 0, 0, 653, 0, 87, 782, 450,
+  589, 0, 448, 307, 470, 413, 477, 624, 300, 882, 0, 0, 0, 0, 0, 718,
+  0, 841, 925, 0, 0, 0, 0, 128, 195, 0, 0, 0, 0, 0, 690, 874,
+  92, 540, 0, 198, 289, 394, 964, 462, 0, 452, 667, 112, 0, 0, 0, 0,
+  0, 0, 106, 692, 343, 0, 104, 555, 601, 901, 390, 0, 708, 0, 76, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 971, 0, 0, 0, 0, 0, 478, 480,
+  776, 0, 0, 0, 0, 194, 574, 612, 905, 364, 0, 0, 751, 0, 604, 0,
+  0, 0, 0, 0, 62, 0, 0, 0, 0, 93, 130, 442, 0, 0, 0, 0,
+  0, 116, 834, 74, 757, 861, 0, 0, 814, 628, 0, 0, 37, 434, 204, 263,
+  465, 878, 910, 31, 374, 67, 0, 422, 0, 0, 435, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 618, 0, 342, 345, 630, 0, 355, 0, 0, 643,
+  802, 260, 0, 51, 245, 0, 721, 0, 98, 669, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 296, 765, 858, 461, 877, 473, 744, 926, 458, 427, 892,
+  224, 0, 583, 306, 0, 812, 0, 371, 542, 657, 0, 660, 0, 0, 832, 0,
+  0, 0, 847, 0, 0, 165, 533, 0, 251, 0, 998, 73, 680, 0, 287, 0,
+  0, 327, 648, 0, 0, 241, 0, 0, 0, 0, 0, 0, 0, 0, 700, 0,
+  0, 111, 232, 9, 152, 609, 0, 0, 0, 556, 793, 504, 642, 0, 0, 0,
+  0, 0, 0, 0, 149, 82, 456, 893, 0, 312, 603, 0, 684, 758, 775, 0,
+  138, 0, 0, 0, 0, 0, 144, 186, 0, 115, 32, 275, 494, 103, 273, 707,
+  0, 739, 0, 686, 0, 80, 495, 860, 418, 0, 0, 0, 117, 987, 808, 0,
+  0, 0, 163, 94, 382, 639, 237, 731, 870, 0, 0, 0, 265, 647, 0, 409,
+  0, 0, 0, 541, 0, 0, 0, 0, 218, 839, 0, 0, 238, 0, 0, 262,
+  0, 619, 0, 714, 417, 807, 0, 0, 629, 584, 0, 0, 0, 605, 0, 0,
+  284, 736, 0, 0, 0, 13, 0, 803, 954, 0, 426, 0, 0, 0, 0, 318,
+  317, 588, 777, 553, 308, 787, 517, 942, 0, 0, 0, 0, 0, 464, 615, 0,
+  0, 0, 0, 0, 178, 0, 0, 0, 403, 68, 209, 957, 0, 0, 0, 341,
+  984, 0, 0, 0, 0, 0, 411, 404, 246, 402, 492, 0, 100, 0, 0, 0,
+  0, 0, 205, 52, 547, 177, 389, 83, 322, 537, 827, 979, 0, 557, 722, 668,
+  0, 0, 147, 193, 0, 184, 71, 0, 0, 0, 561, 119, 0, 672, 967, 879,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 754, 0, 336, 0, 0,
+  0, 0, 900, 0, 0, 0, 0, 0, 0, 249, 0, 617, 0, 54, 252, 0,
+  431, 0, 0, 0, 344, 997, 0, 0, 664, 694, 0, 0, 0, 0, 0, 0,
+  593, 0, 0, 0, 0, 975, 0, 578, 0, 0, 0, 0, 357, 528, 0, 0,
+  0, 0, 0, 0, 0, 0, 820, 0, 0, 0, 0, 137, 0, 482, 558, 88,
+  99, 497, 571, 887, 0, 507, 0, 0, 0, 0, 511, 894, 658, 0, 0, 0,
+  0, 0, 0, 0, 132, 10, 0, 0, 0, 792, 0, 0, 0, 0, 0, 362,
+  0, 385, 548, 0, 221, 335, 999, 717, 0, 0, 0, 661, 387, 918, 457, 81,
+  320, 526, 314, 0, 0, 0, 779, 0, 0, 101, 0, 183, 0, 0, 0, 91,
+  156, 472, 697, 0, 0, 79, 0, 0, 771, 640, 358, 6, 475, 849, 168, 370,
+  0, 0, 0, 773, 315, 86, 0, 0, 270, 856, 0, 0, 0, 0, 56, 965,
+  933, 0, 0, 0, 0, 0, 0, 0, 530, 46, 230, 185, 638, 681, 0, 0,
+  175, 582, 0, 123, 0, 0, 0, 535, 5, 0, 500, 522, 0, 512, 0, 0,
+  816, 0, 0, 0, 173, 174, 393, 414, 50, 436, 455, 520, 566, 631, 688, 729,
+  899, 701, 906, 798, 627, 0, 715, 0, 406, 0, 0, 0, 0, 0, 981, 0,
+  0, 0, 0, 934, 0, 0, 0, 0, 0, 0, 0, 0, 543, 45, 702, 837,
+  961, 89, 600, 650, 764, 16, 724, 0, 0, 0, 41, 524, 0, 256, 821, 0,
+  134, 917, 0, 0, 851, 972, 0, 0, 0, 0, 0, 253, 121, 0, 902, 0,
+  0, 991, 0, 0, 0, 937, 586, 0, 562, 0, 0, 941, 0, 0, 0, 272,
+  590, 863, 644, 916, 962, 637, 0, 0, 939, 19, 0, 889, 366, 0, 0, 57,
+  316, 0, 35, 0, 0, 0, 0, 0, 0, 108, 842, 0, 0, 0, 164, 671,
+  552, 0, 0, 0, 463, 437, 752, 181, 44, 800, 864, 980, 0, 0, 70, 577,
+  0, 0, 0, 197, 0, 0, 69, 0, 0, 172, 0, 0, 0, 0, 486, 869,
+  0, 63, 0, 0, 0, 476, 986, 883, 400, 740, 840, 513, 935, 0, 801, 0,
+  309, 236, 755, 825, 0, 0, 0, 675, 949, 439, 932, 28, 0, 124, 734, 239,
+  501, 898, 0, 0, 0, 608, 822, 377, 29, 835, 976, 0, 0, 7, 368, 745,
+  0, 40, 161, 283, 645, 733, 0, 0, 397, 0, 0, 0, 0, 0, 0, 72,
+  551, 960, 0, 493, 259, 0, 0, 491, 0, 0, 0, 266, 338, 662, 554, 27,
+  785, 109, 378, 693, 30, 929, 992, 182, 0, 518, 0, 865, 783, 963, 0, 641,
+  0, 0, 0, 329, 0, 0, 0, 0, 0, 267, 38, 145, 0, 0, 0, 503,
+  0, 781, 0, 622, 772, 0, 0, 824, 0, 0, 0, 0, 0, 0, 0, 0,
+  131, 243, 515, 946, 0, 0, 0, 732, 0, 0, 0, 0, 0, 597, 153, 24,
+  202, 982, 0, 0, 0, 8, 226, 459, 468, 521, 706, 760, 0, 0, 0, 0,
+  0, 0, 225, 285, 0, 75, 399, 0, 113, 595, 848, 0, 0, 0, 395, 823,
+  0, 0, 0, 444, 0, 0, 405, 0, 0, 621, 0, 0, 0, 0, 0, 0,
+  0, 146, 162, 0, 0, 753, 749, 0, 659, 484, 634, 0, 0, 0, 0, 0,
+  867, 235, 995, 365, 447, 559, 261, 310, 709, 912, 950, 0, 0, 0, 602, 0,
+  0, 0, 2, 716, 728, 281, 0, 0, 575, 0, 0, 0, 763, 799, 809, 340,
+  148, 420, 952, 985, 994, 1000, 295, 48, 107, 831, 383, 0, 196, 286, 0, 0,
+  376, 0, 381, 576, 885, 0, 0, 1, 0, 0, 0, 0, 0, 467, 0, 0,
+  730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 769,
+  155, 0, 0, 126, 786, 581, 110, 0, 0, 332, 157, 920, 49, 974, 0, 0,
+  0, 0, 0, 0, 0, 0, 525, 424, 592, 401, 240, 636, 0, 0, 0, 122,
+  0, 560, 895, 0, 0, 0, 0, 277, 691, 924, 356, 0, 928, 142, 0, 0,
+  169, 421, 0, 247, 761, 0, 0, 0, 0, 0, 0, 367, 0, 334, 0, 208,
+  305, 0, 0, 0, 292, 958, 930, 0, 151, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 171, 0, 0, 483, 0, 0, 354, 0, 0, 0, 725, 947, 0, 0,
+  0, 248, 0, 0, 0, 0, 0, 0, 227, 944, 0, 0, 0, 26, 170, 0,
+  0, 0, 0, 0, 545, 539, 0, 0, 135, 0, 0, 0, 0, 0, 451, 0,
+  587, 392, 956, 0, 120, 0, 685, 386, 0, 0, 0, 333, 938, 0, 0, 544,
+  833, 0, 679, 907, 60, 380, 911, 215, 891, 970, 0, 0, 216, 43, 410, 496,
+  712, 914, 0, 0, 527, 0, 0, 0, 862, 813, 388, 0, 0, 0, 280, 441,
+  756, 845, 876, 487, 613, 890, 969, 0, 0, 0, 0, 0, 0, 678, 499, 0,
+  866, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 140, 0,
+  0, 742, 0, 0, 670, 0, 0, 0, 0, 0, 228, 0, 0, 0, 0, 0,
+  127, 304, 572, 0, 0, 854, 0, 0, 0, 0, 47, 0, 0, 0, 0, 0,
+  0, 0, 479, 408, 187, 596, 0, 17, 844, 21, 0, 626, 0, 0, 3, 852,
+  0, 0, 0, 0, 0, 0, 0, 0, 508, 0, 0, 438, 635, 705, 611, 789,
+  546, 61, 0, 0, 0, 0, 0, 0, 0, 0, 607, 713, 339, 873, 15, 324,
+  0, 0, 855, 0, 234, 0, 0, 0, 0, 774, 0, 0, 768, 0, 0, 0,
+  0, 0, 0, 656, 509, 446, 931, 77, 0, 0, 430, 922, 0, 0, 0, 0,
+  278, 288, 328, 166, 884, 0, 921, 923, 0, 0, 0, 349, 449, 0, 0, 0,
+  363, 741, 743, 794, 990, 0, 313, 0, 0, 160, 699, 0, 311, 0, 440, 0,
+  0, 189, 567, 294, 423, 737, 360, 953, 505, 0, 0, 443, 0, 0, 795, 0,
+};
+
+const char *WA_FREQ_53_TOKENS[] = {
+  "isch",
+  "wiä",
+  "han",
+  "i",
+  "gschnarchet",
+  "echti",
+  "männer",
+  "trinked",
+  "tee",
+  "rauche",
+  "im",
+  "lift",
+  "nit",
+  "erläubt",
+  "loh",
+  "mi",
+  "in",
+  "ruh",
+  "mach",
+  "echli",
+  "äxgüsi",
+  "häissisch",
+  "zum",
+  "vornamä",
+  "de",
+  "tom",
+  "zimmerma",
+  "oder",
+  "gaats",
+  "ihnä",
+  "broscht",
+};
+const uint16_t WA_FREQ_53_RANKS[] = {
+  10, 0, 0, 0, 8, 9, 13, 19, 0, 5, 20, 24, 1, 7, 6, 11,
+  12, 29, 0, 0, 3, 2, 0, 0, 0, 0, 0, 25, 0, 0, 22, 28,
+  0, 0, 0, 31, 30, 0, 0, 0, 0, 0, 17, 0, 0, 0, 4, 26,
+  27, 0, 15, 21, 0, 0, 0, 16, 0, 0, 18, 0, 0, 0, 14, 23,
+};
+
+const char *WA_FREQ_54_TOKENS[] = {
+  "ત",
+  "ર",
+  "સ",
+  "છ",
+  "ક",
+  "મ",
+  "ટ",
+  "વ",
+  "ન",
+  "ય",
+  "લ",
+  "ઘ",
+  "ધ",
+  "કર",
+  "આ",
+  "જ",
+  "રહ",
+  "જગ",
+  "શ",
+  "નથ",
+  "સમ",
+  "દ",
+  "પ",
+  "ઓ",
+  "દસ",
+  "ચ",
+  "પચ",
+  "ઇઠ",
+  "એ",
+  "બ",
+  "અહ",
+  "ઈએ",
+  "તન",
+  "સમજ",
+  "ણ",
+  "મસક",
+  "ઈ",
+  "પણ",
+  "એક",
+  "ધવ",
+  "અઘર",
+  "તમ",
+  "ઉમર",
+  "ટલ",
+  "ધરત",
+  "ઉપર",
+  "આક",
+  "હ",
+  "લત",
+};
+const uint16_t WA_FREQ_54_RANKS[] = {
+  0, 12, 0, 0, 21, 36, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 39, 0, 0, 0, 0, 0, 30, 0, 0, 2, 9, 17,
+  35, 0, 0, 0, 0, 0, 27, 0, 14, 29, 0, 4, 0, 0, 0, 0,
+  26, 0, 1, 0, 0, 25, 0, 0, 0, 43, 28, 46, 18, 0, 0, 0,
+  33, 0, 23, 0, 15, 0, 0, 48, 0, 34, 0, 32, 47, 0, 0, 20,
+  0, 11, 0, 0, 0, 0, 0, 0, 0, 22, 45, 0, 0, 24, 0, 0,
+  44, 0, 10, 0, 0, 38, 0, 40, 3, 0, 41, 0, 0, 7, 19, 0,
+  0, 5, 31, 37, 0, 13, 16, 8, 6, 0, 0, 0, 0, 0, 0, 49,
+};
+
+const char *WA_FREQ_55_TOKENS[] = {
+  "da",
+  "a",
+  "ya",
+  "ta",
+  "ba",
+  "na",
+  "yi",
+  "ne",
+  "kuma",
+  "su",
+  "shi",
+  "wannan",
+  "ce",
+  "ga",
+  "cikin",
+  "suka",
+  "ke",
+  "cewa",
+  "sun",
+  "ka",
+  "za",
+  "sai",
+  "daga",
+  "aka",
+  "wani",
+  "kasar",
+  "mai",
+  "ko",
+  "nan",
+  "haka",
+  "A",
+  "kan",
+  "ma",
+  "an",
+  "masu",
+  "domin",
+  "wanda",
+  "zai",
+  "mu",
+  "suna",
+  "kai",
+  "Allah",
+  "dai",
+  "duk",
+  "yadda",
+  "wasu",
+  "samu",
+  "har",
+  "yana",
+  "wa",
+  "iya",
+  "zuwa",
+  "sa",
+  "amma",
+  "ake",
+  "kasa",
+  "abin",
+  "wajen",
+  "don",
+  "Ya",
+  "‘yan",
+  "yake",
+  "yin",
+  "lokacin",
+  "irin",
+  "yanzu",
+  "daya",
+  "ci",
+  "idan",
+  "zama",
+  "wata",
+  "jihar",
+  "gaba",
+  "suke",
+  "mutane",
+  "wadanda",
+  "dan",
+  "aiki",
+  "bayyana",
+  "akwai",
+  "tare",
+  "kamar",
+  "inda",
+  "ita",
+  "aikin",
+  "bayan",
+  "biyu",
+  "fara",
+  "Sin",
+  "mata",
+  "ni",
+  "babu",
+  "bai",
+  "mutum",
+  "to",
+  "in",
+  "nuna",
+  "duniya",
+  "saboda",
+  "ana",
+  "ganin",
+  "kara",
+  "ina",
+  "yan",
+  "fi",
+  "san",
+  "shiga",
+  "baya",
+  "ji",
+  "ciki",
+  "Wannan",
+  "wadannan",
+  "samun",
+  "Amma",
+  "gwamnatin",
+  "musamman",
+  "tana",
+  "Da",
+  "masa",
+  "farko",
+  "kuwa",
+  "shugaban",
+  "shekarar",
+  "dama",
+  "kamata",
+  "kawo",
+  "yau",
+  "sauran",
+  "lafiya",
+  "shekara",
+  "amfani",
+  "To",
+  "yawa",
+  "son",
+  "Nijeriya",
+  "Najeriya",
+  "gwamnati",
+  "Sai",
+  "abu",
+  "dake",
+  "kira",
+  "din",
+  "ranar",
+  "Na",
+  "kawai",
+  "matsayin",
+  "Idan",
+  "Amurka",
+  "neman",
+  "zo",
+  "wato",
+  "Malam",
+  "Kuma",
+  "hakan",
+  "shekaru",
+  "tabbatar",
+  "babban",
+  "so",
+  "lokaci",
+  "kungiyar",
+  "yace",
+  "Saboda",
+  "birnin",
+  "muka",
+  "akan",
+  "tun",
+  "jarida",
+  "Daga",
+  "hada",
+  "Haka",
+  "zaman",
+  "rashin",
+  "take",
+  "guda",
+  "yawan",
+  "kasashen",
+  "kafin",
+  "bisa",
+  "uku",
+  "watan",
+  "ki",
+  "gudanar",
+  "Kano",
+  "kowa",
+  "kafa",
+  "sha",
+  "jama’a",
+  "tsakanin",
+  "je",
+  "halin",
+  "taba",
+  "siyasa",
+  "mana",
+  "Shugaban",
+  "hanyar",
+  "al’umma",
+  "sosai",
+  "mutanen",
+  "cutar",
+  "zaben",
+  "Buhari",
+  "garin",
+  "kayan",
+  "An",
+  "kashe",
+  "mun",
+  "gaskiya",
+  "gidan",
+  "Hausa",
+  "muna",
+  "taron",
+  "Bayan",
+  "baki",
+  "Alhaji",
+  "fito",
+  "sake",
+  "Don",
+  "rubuta",
+  "jin",
+  "ku",
+  "sannan",
+  "kama",
+  "hankali",
+  "wurin",
+  "Shi",
+  "sanya",
+  "sama",
+  "magana",
+  "abubuwan",
+  "dauki",
+  "sami",
+  "rika",
+  "zan",
+  "cin",
+  "Jihar",
+  "kasance",
+  "Yace",
+  "zasu",
+  "gida",
+  "Sannan",
+  "koma",
+  "labarai",
+  "ban",
+  "Duk",
+  "daban",
+  "hukumar",
+  "fada",
+  "zabe",
+  "fim",
+  "sani",
+  "kudi",
+  "manyan",
+  "yayin",
+  "yankin",
+  "harkokin",
+  "wadda",
+  "rayuwa",
+  "mulki",
+  "tsarin",
+  "Ta",
+  "majalisar",
+  "muke",
+  "bakin",
+  "ruwa",
+  "Kaduna",
+  "kansa",
+  "samar",
+  "bi",
+  "Ba",
+  "kokarin",
+  "bayar",
+  "abubuwa",
+  "kudin",
+  "komai",
+  "mace",
+  "kana",
+  "gani",
+  "mulkin",
+  "kansu",
+  "kyau",
+  "basu",
+  "kare",
+  "Ko",
+  "aure",
+  "dole",
+  "matan",
+  "wai",
+  "waje",
+  "fiye",
+  "rana",
+  "tsaro",
+  "jam’iyyar",
+  "fatan",
+  "Ina",
+  "dawo",
+  "nake",
+  "shafi",
+  "ayyukan",
+  "daular",
+  "bukatar",
+  "gwamnan",
+  "shirin",
+  "gabatar",
+  "nasara",
+  "PDP",
+  "bar",
+  "hana",
+  "yayi",
+  "abun",
+  "karshe",
+  "yaki",
+  "maka",
+  "Boko",
+  "bangaren",
+  "game",
+  "dubu",
+  "gaban",
+  "musu",
+  "Haram",
+  "wuce",
+  "Domin",
+  "juna",
+  "kula",
+  "mafi",
+  "tarihi",
+  "daidai",
+  "batun",
+  "kowane",
+  "tashi",
+  "sakamakon",
+  "biyar",
+  "kada",
+  "Wani",
+  "shirya",
+  "abinci",
+  "harkar",
+  "matsalar",
+  "tattalin",
+  "taimaka",
+  "kananan",
+  "zata",
+  "faru",
+  "tafi",
+  "al’ummar",
+  "me",
+  "Ibrahim",
+  "kenan",
+  "damar",
+  "cewar",
+  "karatu",
+  "hudu",
+  "can",
+  "dukkan",
+  "yada",
+  "maganar",
+  "addinin",
+  "karin",
+  "kullum",
+  "Hukumar",
+  "kammala",
+  "Majalisar",
+  "karkashin",
+  "shugaba",
+  "fadi",
+  "Akwai",
+  "babbar",
+  "gari",
+  "gina",
+  "min",
+  "kadai",
+  "arziki",
+  "hannu",
+  "bayani",
+  "dari",
+  "sauransu",
+  "yarda",
+  "mayar",
+  "kashi",
+  "rayuwar",
+  "Arewa",
+  "ai",
+  "lamarin",
+  "yara",
+  "Shugaba",
+  "cigaba",
+  "Muhammad",
+  "gyara",
+  "addini",
+  "bata",
+  "yiwa",
+  "dauka",
+  "cika",
+  "tafiya",
+  "bin",
+  "gabata",
+  "gaske",
+  "Yanzu",
+  "ruwan",
+  "labarin",
+  "Gwamna",
+  "zamani",
+  "Gwamnan",
+  "daukar",
+  "nemi",
+  "duba",
+  "girma",
+  "Ga",
+  "Musulmi",
+  "fadin",
+  "goma",
+  "bincike",
+  "sunan",
+  "Ka",
+  "dauke",
+  "rike",
+  "tsaya",
+  "APC",
+  "kamfanin",
+  "zauna",
+  "dace",
+  "tsohon",
+  "matukar",
+  "gare",
+  "tsawon",
+  "aikata",
+  "fannin",
+  "Har",
+  "Wasu",
+  "bude",
+  "daban-daban",
+  "kwamitin",
+  "matasa",
+  "zamanin",
+  "Musulunci",
+  "bada",
+  "hannun",
+  "fitar",
+  "gano",
+  "Abubakar",
+  "Sarkin",
+  "dalilin",
+  "sabon",
+  "kadan",
+  "kanta",
+  "shine",
+  "Kamar",
+  "Tun",
+  "tafiyar",
+  "karatun",
+  "makarantar",
+  "kabilar",
+  "nufin",
+  "rasa",
+  "wancan",
+  "kusan",
+  "kwana",
+  "kwarai",
+  "wacce",
+  "abinda",
+  "biya",
+  "tunanin",
+  "iri",
+  "maza",
+  "fama",
+  "Annabi",
+  "Bauchi",
+  "ilimi",
+  "Abuja",
+  "mutu",
+  "shigo",
+  "In",
+  "goyon",
+  "za'a",
+  "Su",
+  "sanda",
+  "jiya",
+  "tarayya",
+  "nasarar",
+  "karshen",
+  "jaridar",
+  "wasan",
+  "matsala",
+  "rage",
+  "cimma",
+  "kasuwa",
+  "gudun",
+  "karfi",
+  "kasashe",
+  "kusa",
+  "Muhammadu",
+  "Taiwan",
+  "hadin",
+  "Mai",
+  "karfin",
+  "shugabannin",
+  "zargin",
+  "farin",
+  "taka",
+  "matakin",
+  "wuraren",
+  "dangane",
+  "mika",
+  "misali",
+  "sanin",
+  "yakin",
+  "fa",
+  "mamaki",
+  "hali",
+  "bikin",
+  "jiki",
+  "fita",
+  "nasa",
+  "gama",
+  "kowace",
+  "mani",
+  "hakuri",
+  "hanya",
+  "maimakon",
+  "Afirka",
+  "alheri",
+  "Manzon",
+  "taro",
+  "wuri",
+  "amince",
+  "dadi",
+  "kiran",
+  "saba",
+  "sojoji",
+  "dare",
+  "sau",
+  "shawara",
+  "biyan",
+  "wane",
+  "Imam",
+  "kake",
+  "inganta",
+  "karo",
+  "tace",
+  "Ana",
+  "makaranta",
+  "mutumin",
+  "Abin",
+  "Janar",
+  "takarar",
+  "buga",
+  "jama'a",
+  "tsaye",
+  "’yan",
+  "cikinsu",
+  "riga",
+  "wurare",
+  "matsalolin",
+  "zaune",
+  "aiwatar",
+  "ikon",
+  "shaida",
+  "sojojin",
+  "yanayin",
+  "shida",
+  "ilmi",
+  "ilmin",
+  "uwa",
+  "doka",
+  "lardin",
+  "‘Yan",
+  "jawo",
+  "karya",
+  "maso",
+  "musulmi",
+  "Jonathan",
+  "Muna",
+  "karanta",
+  "nasu",
+  "Dan",
+  "Hajiya",
+  "ido",
+  "muhimmanci",
+  "Babban",
+  "harshen",
+  "kallon",
+  "man",
+  "tarihin",
+  "binciken",
+  "jam'iyyar",
+  "laifi",
+  "tara",
+  "gwamna",
+  "Babu",
+  "arewa",
+  "bane",
+  "dasu",
+  "gaya",
+  "Sarki",
+  "Shin",
+  "wuta",
+  "Abdullahi",
+  "amsa",
+  "rahoton",
+  "Sun",
+  "bukata",
+  "daina",
+  "kimanin",
+  "raba",
+  "sarki",
+  "taimakawa",
+  "hanyoyin",
+  "makon",
+  "lallai",
+  "dukkanin",
+  "lura",
+  "Iran",
+  "SAW",
+  "Za",
+  "Ali",
+  "Umar",
+  "jama’ar",
+  "karamar",
+  "shakka",
+  "Bello",
+  "miliyan",
+  "soja",
+  "Katsina",
+  "baiwa",
+  "godiya",
+  "manema",
+  "Adamawa",
+  "Nijar",
+  "gane",
+  "mataki",
+  "kiwon",
+  "wasa",
+  "kin",
+  "yanayi",
+  "isa",
+  "jirgin",
+  "takara",
+  "wajibi",
+  "faruwa",
+  "bari",
+  "fadar",
+  "ran",
+  "sukan",
+  "Ahmad",
+  "hanci",
+  "majalisa",
+  "manta",
+  "namiji",
+  "Mu",
+  "rai",
+  "sayar",
+  "siyasar",
+  "jami’an",
+  "Ita",
+  "tashin",
+  "dadin",
+  "dimbin",
+  "kiyaye",
+  "nawa",
+  "sanar",
+  "shin",
+  "yaya",
+  "Wato",
+  "arzikin",
+  "kayayyakin",
+  "2015",
+  "Sani",
+  "bugawa",
+  "kasuwanci",
+  "hau",
+  "ila",
+  "Afrika",
+  "Wanda",
+  "fahimci",
+  "harin",
+  "imani",
+  "jihohi",
+  "kokari",
+  "tamkar",
+  "kyautata",
+  "labari",
+  "masana",
+  "dora",
+  "jini",
+  "bashi",
+  "nada",
+  "Bisa",
+  "gasar",
+  "shafin",
+  "shan",
+  "Inda",
+  "Karamar",
+  "saka",
+  "yasa",
+  "Musa",
+  "ba'a",
+  "noma",
+  "Gwamnatin",
+  "Muhammadu Buhari",
+  "sabuwar",
+  "wadansu",
+  "yanke",
+  "Obasanjo",
+  "jihohin",
+  "tsara",
+  "Hausawa",
+  "Shehu",
+  "bunkasa",
+  "haifar",
+  "kwashe",
+  "Duniya",
+  "adalci",
+  "hankalin",
+  "rasu",
+  "Borno",
+  "auren",
+  "fata",
+  "sauki",
+  "tura",
+  "‘yar",
+  "cire",
+  "Dakta",
+  "Ni",
+  "dokar",
+  "hijira",
+  "jiha",
+  "koyi",
+  "waka",
+  "Kungiyar",
+  "Misali",
+  "bisani",
+  "haihuwa",
+  "matakan",
+  "illa",
+  "jikin",
+  "kudaden",
+  "tattauna",
+  "Obama",
+  "cikakken",
+  "tasiri",
+  "tunani",
+  "adawa",
+  "bakwai",
+  "maganin",
+  "tsari",
+  "yaba",
+  "Ban",
+  "Suna",
+  "kar",
+  "karbi",
+  "kungiyoyin",
+  "matar",
+  "rundunar",
+  "sarkin",
+  "Wadannan",
+  "fahimtar",
+  "rufe",
+  "zabi",
+  "gidajen",
+  "kasuwar",
+  "takwas",
+  "zargi",
+  "Aliyu",
+  "hadu",
+  "magani",
+  "Fulani",
+  "dakin",
+  "kabilu",
+  "shiri",
+  "talakawa",
+  "tayi",
+  "karamin",
+  "tsaron",
+  "Yana",
+  "fuskanta",
+  "tunda",
+  "ajiye",
+  "fili",
+  "ma’aikatan",
+  "namu",
+  "tsare",
+  "tsoron",
+  "Gaskiya",
+  "hukumomin",
+  "tambaya",
+  "wayar",
+  "10",
+  "Cikin",
+  "Hajji",
+  "Kasar",
+  "bayanin",
+  "hukumomi",
+  "koyar",
+  "Wata",
+  "dade",
+  "hikima",
+  "sace",
+  "Muryar",
+  "dalibai",
+  "littafin",
+  "ofishin",
+  "Han",
+  "Mun",
+  "Umma",
+  "bangare",
+  "damuwa",
+  "duka",
+  "ja",
+  "kasancewar",
+  "kuka",
+  "lashe",
+  "wutar",
+  "Masu",
+  "albashi",
+  "hari",
+  "matuka",
+  "Adamu",
+  "dokokin",
+  "wakilan",
+  "Isa",
+  "Kudu",
+  "bukaci",
+  "karfe",
+  "kungiya",
+  "soma",
+  "Bugu",
+  "daji",
+  "gabashin",
+  "mota",
+  "sallah",
+  "shekarun",
+  "tsakiya",
+  "amin",
+  "bana",
+  "tsakaninsu",
+  "20",
+  "Abban",
+  "alfahari",
+  "filin",
+  "hukuma",
+  "kotun",
+  "kudu",
+  "kwanaki",
+  "marasa",
+  "mutuwa",
+  "rashawa",
+  "rikicin",
+  "taimakon",
+  "Kafin",
+  "Kamaru",
+  "dinga",
+  "farkon",
+  "jefa",
+  "karbar",
+  "kawar",
+  "shafa",
+  "sune",
+  "takardar",
+  "yammacin",
+  "3",
+  "Mr",
+  "abincin",
+  "hakkin",
+  "mako",
+  "nazarin",
+  "Jami’ar",
+  "malamai",
+  "sabo",
+  "wuya",
+  "Adam",
+  "iyaye",
+  "kyauta",
+  "littafi",
+  "mara",
+  "ma’aikata",
+  "nauyin",
+  "yunkurin",
+  "zuba",
+  "Abu",
+  "la’akari",
+  "magance",
+  "rinka",
+  "gargajiya",
+  "matsayi",
+  "muhimman",
+  "sako",
+  "wakilinmu",
+  "anfani",
+  "biyo",
+  "fitowa",
+  "gobe",
+  "makarantu",
+  "shawarar",
+  "tattaunawa",
+  "Hakan",
+  "Me",
+  "cibiyar",
+  "daraja",
+  "fagen",
+  "lafiyar",
+  "nata",
+  "tuni",
+  "zuciya",
+  "Iraki",
+  "LEADERSHIP",
+  "ayyuka",
+  "kotu",
+  "matasan",
+  "wakoki",
+  "yaran",
+  "ciwon",
+  "jerin",
+  "kishin",
+  "2",
+  "Gidan",
+  "Usman",
+  "fasaha",
+  "fuskantar",
+  "jami'an",
+  "kaya",
+  "sha’awa",
+  "taimako",
+  "yankunan",
+  "yaro",
+  "zarar",
+  "Hakika",
+  "Sakkwato",
+  "Sanata",
+  "Zamfara",
+  "hukuncin",
+  "jiragen",
+  "kaddamar",
+  "kaina",
+  "rubutu",
+  "shigar",
+  "aiko",
+  "al'ummar",
+  "karni",
+  "koda",
+  "matsaloli",
+  "rawa",
+  "salon",
+  "tabbata",
+  "zalika",
+  "Maiduguri",
+  "gaggawa",
+  "tunawa",
+  "wakokin",
+  "al'umma",
+  "laifin",
+  "Kasa",
+  "Neja",
+  "Turai",
+  "gudu",
+  "Jarida",
+  "albarka",
+  "dalili",
+  "daukaka",
+  "ilimin",
+  "kari",
+  "wahala",
+  "yanki",
+  "asibiti",
+  "bara",
+  "kamu",
+  "kika",
+  "layi",
+  "rediyo",
+  "sashen",
+  "shugabanci",
+  "canza",
+  "hira",
+  "ministan",
+  "mukamin",
+  "100",
+  "Aminu",
+  "Ebola",
+  "Sokoto",
+  "kalubale",
+  "koyon",
+  "sakin",
+  "shahara",
+  "shugabanni",
+  "ƙasar",
+  "jawabi",
+  "sassan",
+  "taso",
+  "2016",
+  "Ado",
+  "Garba",
+  "kanka",
+  "komawa",
+  "koya",
+  "mijinta",
+  "ziyara",
+  "ALMIZAN",
+  "Lokacin",
+  "Taraba",
+  "asalin",
+  "haife",
+  "hanyoyi",
+};
+const uint16_t WA_FREQ_55_RANKS[] = {
+  683, 0, 0, 0, 0, 0, 0, 643, 885, 925, 975, 0, 0, 163, 47, 0,
+  0, 0, 491, 0, 0, 0, 0, 322, 781, 0, 0, 318, 0, 580, 974, 0,
+  0, 79, 818, 0, 0, 0, 0, 0, 0, 910, 0, 358, 0, 420, 0, 585,
+  0, 0, 0, 0, 0, 0, 211, 547, 0, 0, 892, 54, 611, 971, 154, 0,
+  0, 0, 628, 0, 418, 0, 0, 0, 0, 103, 0, 0, 0, 0, 0, 595,
+  0, 0, 0, 0, 0, 0, 0, 0, 544, 550, 961, 973, 0, 0, 0, 490,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 964, 808, 0, 0, 0, 0,
+  0, 0, 175, 0, 65, 0, 0, 0, 0, 748, 0, 0, 0, 308, 249, 0,
+  0, 0, 403, 0, 0, 431, 718, 39, 165, 534, 0, 248, 433, 193, 304, 800,
+  0, 0, 0, 0, 0, 0, 566, 242, 0, 705, 99, 0, 26, 180, 760, 623,
+  365, 906, 850, 856, 109, 0, 0, 0, 634, 905, 0, 545, 0, 0, 320, 0,
+  0, 0, 0, 0, 258, 0, 0, 118, 644, 0, 0, 0, 0, 0, 520, 0,
+  0, 0, 768, 0, 399, 264, 559, 749, 194, 860, 267, 528, 370, 965, 816, 591,
+  0, 0, 0, 335, 0, 0, 573, 396, 0, 279, 0, 0, 0, 798, 0, 0,
+  516, 0, 0, 0, 645, 0, 0, 321, 839, 0, 0, 0, 48, 395, 777, 0,
+  453, 0, 436, 344, 716, 0, 0, 394, 870, 775, 0, 0, 0, 127, 556, 470,
+  731, 0, 0, 823, 686, 597, 820, 0, 0, 284, 0, 424, 0, 108, 593, 943,
+  0, 277, 0, 0, 463, 656, 846, 0, 78, 0, 726, 0, 0, 166, 0, 0,
+  49, 633, 752, 0, 0, 451, 0, 288, 867, 0, 0, 0, 0, 12, 56, 481,
+  0, 681, 821, 10, 0, 0, 0, 848, 346, 471, 0, 0, 50, 0, 0, 918,
+  0, 0, 0, 0, 0, 0, 140, 0, 331, 98, 0, 0, 942, 0, 0, 144,
+  205, 488, 388, 829, 941, 0, 639, 0, 85, 0, 229, 0, 178, 339, 0, 921,
+  0, 0, 0, 0, 0, 0, 950, 0, 274, 444, 797, 0, 0, 0, 698, 0,
+  0, 214, 754, 0, 0, 0, 0, 0, 0, 0, 0, 0, 218, 0, 0, 0,
+  0, 890, 387, 0, 0, 334, 764, 113, 275, 907, 927, 176, 662, 0, 168, 0,
+  660, 740, 765, 957, 962, 0, 0, 721, 0, 82, 511, 0, 404, 0, 0, 0,
+  627, 300, 0, 152, 345, 651, 734, 0, 0, 871, 0, 0, 0, 0, 169, 0,
+  332, 0, 0, 2, 786, 0, 0, 132, 0, 0, 392, 876, 21, 934, 642, 810,
+  0, 0, 0, 502, 0, 0, 0, 421, 0, 170, 0, 0, 0, 0, 222, 709,
+  730, 0, 0, 0, 741, 0, 0, 0, 0, 0, 36, 256, 493, 776, 536, 631,
+  780, 0, 0, 0, 702, 125, 0, 480, 923, 0, 504, 71, 0, 0, 0, 343,
+  0, 986, 960, 0, 89, 703, 410, 0, 0, 352, 519, 956, 0, 0, 762, 0,
+  0, 0, 0, 215, 250, 278, 0, 458, 650, 799, 997, 0, 0, 894, 0, 638,
+  232, 70, 0, 0, 615, 316, 993, 24, 105, 224, 668, 500, 83, 720, 807, 865,
+  887, 637, 712, 779, 0, 0, 0, 0, 0, 0, 467, 0, 0, 0, 0, 0,
+  427, 112, 700, 230, 311, 101, 793, 182, 244, 299, 302, 535, 484, 0, 0, 501,
+  0, 271, 879, 0, 0, 0, 503, 0, 0, 0, 0, 561, 0, 0, 549, 0,
+  0, 0, 0, 55, 59, 0, 0, 0, 939, 532, 212, 179, 233, 478, 998, 0,
+  0, 0, 0, 0, 0, 0, 589, 778, 68, 58, 303, 966, 796, 241, 898, 0,
+  0, 0, 14, 553, 0, 102, 355, 878, 0, 0, 0, 0, 0, 90, 728, 696,
+  877, 0, 994, 0, 0, 0, 0, 375, 756, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 842, 0, 0, 0, 685,
+  474, 784, 0, 0, 6, 197, 0, 61, 524, 920, 15, 930, 0, 473, 0, 0,
+  0, 0, 0, 0, 136, 895, 371, 626, 858, 485, 0, 0, 0, 0, 581, 341,
+  479, 0, 0, 0, 0, 0, 116, 557, 0, 0, 0, 142, 0, 739, 147, 0,
+  0, 0, 426, 0, 495, 649, 714, 0, 347, 74, 0, 415, 0, 353, 0, 0,
+  912, 0, 0, 725, 0, 0, 761, 0, 161, 0, 0, 307, 0, 0, 542, 0,
+  0, 0, 0, 0, 238, 540, 0, 0, 266, 494, 0, 0, 530, 827, 0, 531,
+  944, 0, 897, 198, 0, 619, 173, 0, 0, 0, 0, 672, 0, 0, 0, 0,
+  0, 0, 869, 0, 237, 506, 124, 646, 0, 0, 280, 333, 430, 953, 0, 0,
+  0, 0, 0, 917, 407, 746, 442, 497, 439, 0, 199, 886, 0, 0, 0, 0,
+  0, 0, 174, 217, 291, 0, 0, 0, 533, 0, 0, 0, 0, 0, 841, 0,
+  0, 0, 616, 75, 208, 319, 416, 678, 60, 462, 359, 811, 835, 1000, 413, 0,
+  738, 486, 523, 0, 0, 0, 293, 518, 570, 882, 330, 0, 157, 586, 41, 107,
+  584, 0, 0, 0, 186, 466, 139, 189, 231, 351, 245, 575, 604, 802, 824, 903,
+  0, 543, 0, 0, 183, 0, 0, 0, 0, 0, 715, 181, 873, 0, 787, 891,
+  670, 0, 0, 0, 618, 679, 0, 832, 0, 0, 0, 840, 901, 0, 0, 0,
+  272, 412, 0, 0, 34, 0, 0, 0, 0, 298, 0, 0, 0, 150, 73, 295,
+  582, 576, 376, 744, 315, 769, 833, 489, 914, 263, 487, 578, 32, 0, 0, 259,
+  587, 384, 723, 900, 0, 0, 931, 0, 37, 0, 0, 0, 398, 0, 0, 0,
+  911, 0, 0, 695, 0, 0, 111, 0, 0, 989, 572, 0, 0, 227, 349, 378,
+  0, 0, 367, 0, 409, 814, 120, 0, 0, 0, 937, 0, 0, 727, 240, 464,
+  0, 43, 4, 254, 791, 0, 0, 671, 0, 0, 0, 0, 0, 268, 859, 0,
+  0, 0, 0, 893, 110, 541, 0, 0, 904, 247, 0, 0, 0, 675, 437, 86,
+  27, 146, 680, 0, 0, 690, 0, 0, 379, 51, 0, 919, 0, 0, 782, 0,
+  306, 951, 0, 601, 938, 0, 151, 0, 826, 636, 0, 0, 465, 0, 0, 0,
+  0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 20, 429, 190, 460, 844, 984,
+  301, 121, 569, 819, 200, 902, 8, 667, 0, 0, 0, 172, 0, 0, 0, 0,
+  0, 0, 246, 422, 0, 0, 0, 0, 0, 0, 0, 0, 122, 896, 0, 0,
+  196, 397, 100, 617, 655, 985, 0, 0, 126, 18, 735, 342, 970, 0, 0, 0,
+  610, 0, 0, 162, 0, 192, 380, 447, 115, 0, 0, 72, 0, 0, 0, 0,
+  228, 255, 676, 97, 0, 0, 0, 187, 0, 647, 22, 635, 689, 945, 0, 828,
+  0, 0, 0, 0, 0, 0, 42, 755, 0, 0, 0, 929, 0, 0, 297, 0,
+  0, 0, 0, 76, 0, 0, 64, 0, 659, 0, 0, 0, 164, 0, 0, 145,
+  411, 830, 522, 0, 0, 0, 991, 537, 857, 148, 435, 158, 0, 0, 0, 0,
+  0, 0, 0, 982, 0, 969, 0, 719, 0, 0, 0, 0, 0, 406, 450, 687,
+  0, 0, 362, 0, 0, 234, 80, 207, 94, 0, 849, 0, 0, 0, 138, 0,
+  114, 143, 204, 0, 0, 0, 84, 663, 386, 0, 0, 402, 673, 383, 539, 19,
+  552, 602, 622, 571, 665, 915, 750, 936, 0, 0, 93, 361, 252, 599, 697, 0,
+  475, 992, 0, 792, 988, 92, 657, 425, 0, 954, 69, 0, 33, 815, 0, 0,
+  0, 0, 0, 0, 568, 283, 614, 736, 0, 287, 0, 0, 286, 372, 958, 0,
+  184, 191, 724, 0, 0, 44, 461, 0, 324, 476, 77, 521, 664, 0, 845, 52,
+  282, 0, 0, 123, 0, 0, 0, 0, 855, 0, 926, 0, 0, 0, 448, 652,
+  0, 368, 0, 289, 483, 0, 0, 874, 795, 0, 0, 265, 0, 0, 0, 0,
+  0, 216, 0, 0, 153, 0, 788, 201, 0, 0, 0, 0, 0, 0, 477, 428,
+  53, 373, 977, 0, 0, 81, 0, 220, 0, 432, 0, 0, 0, 326, 509, 767,
+  7, 913, 0, 606, 0, 771, 0, 0, 0, 0, 0, 0, 499, 0, 0, 0,
+  0, 0, 0, 684, 0, 0, 0, 0, 955, 579, 0, 713, 0, 327, 0, 0,
+  0, 851, 605, 390, 134, 743, 356, 0, 0, 0, 25, 583, 757, 0, 0, 654,
+  0, 0, 0, 0, 0, 5, 357, 285, 0, 0, 223, 269, 366, 377, 577, 290,
+  935, 889, 0, 809, 0, 317, 195, 57, 806, 881, 312, 210, 862, 0, 0, 0,
+  0, 0, 0, 674, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  492, 0, 0, 0, 852, 155, 202, 888, 640, 0, 0, 661, 0, 0, 0, 742,
+  0, 596, 496, 0, 0, 0, 843, 872, 0, 0, 933, 177, 0, 364, 0, 309,
+  0, 526, 251, 875, 408, 0, 0, 0, 0, 0, 0, 0, 0, 348, 243, 863,
+  0, 0, 296, 538, 747, 751, 773, 0, 0, 0, 0, 0, 0, 0, 131, 0,
+  0, 0, 758, 884, 0, 28, 0, 0, 0, 0, 0, 35, 213, 221, 669, 766,
+  159, 0, 883, 135, 0, 978, 0, 0, 141, 513, 514, 0, 0, 0, 0, 0,
+  588, 603, 0, 0, 551, 0, 613, 0, 323, 0, 609, 987, 0, 517, 0, 979,
+  688, 729, 0, 0, 0, 0, 0, 928, 0, 0, 510, 967, 817, 445, 0, 382,
+  468, 160, 313, 710, 0, 0, 694, 0, 0, 0, 505, 0, 456, 156, 853, 171,
+  630, 0, 963, 0, 0, 899, 452, 565, 261, 434, 235, 976, 0, 648, 0, 459,
+  423, 0, 838, 443, 239, 0, 67, 30, 563, 482, 789, 0, 0, 0, 0, 0,
+  0, 0, 560, 0, 0, 0, 666, 0, 0, 46, 63, 149, 847, 0, 0, 983,
+  0, 0, 837, 0, 0, 0, 0, 625, 825, 0, 0, 0, 0, 0, 0, 329,
+  0, 770, 457, 0, 31, 325, 328, 722, 206, 400, 472, 753, 952, 0, 0, 0,
+  188, 562, 959, 0, 629, 0, 0, 0, 0, 45, 691, 0, 0, 236, 822, 0,
+  0, 0, 0, 0, 0, 564, 0, 0, 0, 257, 350, 707, 305, 706, 117, 693,
+  310, 908, 980, 0, 203, 0, 0, 0, 0, 621, 0, 95, 598, 225, 590, 209,
+  0, 0, 281, 701, 0, 0, 0, 525, 0, 0, 226, 704, 0, 813, 0, 0,
+  0, 417, 104, 374, 546, 3, 880, 922, 0, 0, 0, 0, 0, 87, 0, 0,
+  0, 0, 0, 0, 0, 0, 574, 783, 381, 405, 0, 968, 0, 0, 0, 0,
+  558, 924, 805, 337, 0, 0, 419, 981, 0, 0, 0, 0, 0, 0, 836, 594,
+  785, 507, 812, 708, 128, 834, 745, 0, 0, 91, 0, 354, 0, 0, 0, 0,
+  732, 682, 0, 0, 0, 996, 0, 0, 0, 555, 0, 0, 0, 0, 527, 0,
+  0, 294, 363, 803, 29, 868, 995, 0, 0, 932, 0, 608, 600, 801, 0, 0,
+  0, 804, 0, 866, 0, 369, 0, 129, 0, 0, 0, 0, 314, 0, 774, 262,
+  0, 0, 23, 948, 0, 0, 0, 0, 9, 336, 699, 0, 0, 385, 292, 653,
+  0, 0, 0, 548, 0, 864, 273, 498, 0, 0, 0, 0, 0, 0, 133, 393,
+  0, 0, 0, 260, 0, 0, 772, 0, 0, 620, 641, 0, 1, 0, 0, 947,
+  0, 512, 624, 0, 0, 607, 219, 0, 130, 790, 529, 0, 0, 949, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 692, 612, 0, 0, 909, 0, 401, 0, 0,
+  0, 0, 0, 0, 0, 0, 16, 0, 0, 137, 96, 0, 0, 677, 0, 515,
+  253, 0, 0, 17, 763, 940, 0, 0, 106, 0, 270, 0, 759, 0, 658, 0,
+  0, 946, 119, 440, 0, 0, 0, 38, 0, 414, 854, 167, 469, 0, 0, 0,
+  0, 455, 360, 794, 0, 0, 0, 0, 0, 0, 0, 0, 66, 711, 454, 276,
+  338, 632, 737, 831, 567, 554, 916, 999, 40, 185, 62, 391, 340, 446, 592, 0,
+  733, 389, 0, 0, 0, 88, 449, 11, 508, 717, 438, 861, 972, 990, 441, 0,
+};
+
+const char *WA_FREQ_56_TOKENS[] = {
+  "ke",
+  "i",
+  "ka",
+  "kanaka",
+  "e",
+  "hele",
+  "he",
+  "pua",
+  "nā",
+  "hale",
+  "nei",
+  "nui",
+  "liʻiliʻi",
+  "hāʻawi",
+  "akua",
+  "pūpū",
+  "mai",
+  "ʻulaʻula",
+  "loaʻa",
+  "kahi",
+  "lāʻau",
+  "kaʻiulani",
+  "aia",
+  "mau",
+  "kaumaha",
+  "au",
+  "ma",
+  "kūʻai",
+  "ʻai",
+  "niu",
+  "melemele",
+  "ʻili",
+  "ʻalani",
+  "ʻelua",
+  "aʻu",
+  "pōpoki",
+  "wāhine",
+  "manaʻo",
+  "o",
+  "noho",
+  "ʻilihune",
+};
+const uint16_t WA_FREQ_56_RANKS[] = {
+  6, 17, 37, 0, 0, 0, 0, 0, 8, 28, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 20, 10, 4, 36, 0, 0,
+  0, 39, 0, 0, 0, 0, 0, 0, 0, 22, 3, 0, 0, 0, 0, 12,
+  0, 0, 30, 1, 40, 0, 0, 0, 21, 33, 0, 0, 0, 0, 0, 19,
+  9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 38, 0, 0, 0, 0, 31,
+  0, 0, 0, 0, 15, 32, 0, 0, 41, 0, 0, 0, 13, 25, 0, 0,
+  0, 35, 0, 0, 0, 0, 0, 23, 18, 16, 29, 0, 0, 0, 2, 0,
+  24, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 34, 26, 7, 11, 27,
+};
+
+const char *WA_FREQ_57_TOKENS[] = {
+  "לא",
+  "את",
+  "אני",
+  "זה",
+  "אתה",
+  "מה",
+  "הוא",
+  "על",
+  "לי",
+  "של",
+  "כן",
+  "לך",
+  "אבל",
+  "יש",
+  "שלי",
+  "כל",
+  "בסדר",
+  "עם",
+  "היא",
+  "שלך",
+  "אם",
+  "טוב",
+  "היה",
+  "אנחנו",
+  "רוצה",
+  "אז",
+  "יודע",
+  "רק",
+  "הם",
+  "יכול",
+  "אותו",
+  "אותך",
+  "יותר",
+  "ג",
+  "כאן",
+  "אותי",
+  "הזה",
+  "שאני",
+  "למה",
+  "להיות",
+  "עכשיו",
+  "או",
+  "אחד",
+  "משהו",
+  "היי",
+  "צריך",
+  "כמו",
+  "אל",
+  "כך",
+  "איך",
+  "אין",
+  "נכון",
+  "לעשות",
+  "תודה",
+  "לו",
+  "לנו",
+  "שאתה",
+  "מי",
+  "זאת",
+  "שם",
+  "חושב",
+  "כדי",
+  "שהוא",
+  "כמה",
+  "פשוט",
+  "יודעת",
+  "אותה",
+  "אולי",
+  "באמת",
+  "כי",
+  "הייתי",
+  "שזה",
+  "גם",
+  "זו",
+  "עושה",
+  "האם",
+  "ואני",
+  "דבר",
+  "שלו",
+  "עוד",
+  "כבר",
+  "שלא",
+  "נראה",
+  "שלנו",
+  "מאוד",
+  "לפני",
+  "הרבה",
+  "בבקשה",
+  "הולך",
+  "קדימה",
+  "אומר",
+  "יהיה",
+  "יכולה",
+  "פעם",
+  "זמן",
+  "אתם",
+  "עדיין",
+  "עד",
+  "ממש",
+  "אלוהים",
+  "ובכן",
+  "איפה",
+  "לה",
+  "קצת",
+  "מישהו",
+  "אותם",
+  "לעזאזל",
+  "אה",
+  "לראות",
+  "הנה",
+  "הייתה",
+  "פה",
+  "אבא",
+  "הכל",
+  "ללכת",
+  "בכל",
+  "שהיא",
+  "צריכה",
+  "בדיוק",
+  "אנשים",
+  "אף",
+  "לדבר",
+  "חייב",
+  "שוב",
+  "חשבתי",
+  "היית",
+  "היום",
+  "שיש",
+  "מצטער",
+  "מר",
+  "צריכים",
+  "בוא",
+  "היו",
+  "שאת",
+  "חושבת",
+  "קרה",
+  "אחת",
+  "לזה",
+  "שלה",
+  "אמא",
+  "אוהב",
+  "שום",
+  "אחר",
+  "אפילו",
+  "ה",
+  "אדוני",
+  "תמיד",
+  "יכולים",
+  "יום",
+  "חבר",
+  "להם",
+  "בטוח",
+  "בגלל",
+  "שלום",
+  "ואז",
+  "בטח",
+  "קורה",
+  "האלה",
+  "אחרי",
+  "שהם",
+  "מדי",
+  "רואה",
+  "הזאת",
+  "הזמן",
+  "כולם",
+  "איתך",
+  "אמר",
+  "רגע",
+  "צ",
+  "בן",
+  "ו",
+  "שאנחנו",
+  "אמרתי",
+  "איזה",
+  "בו",
+  "אדם",
+  "תראה",
+  "דברים",
+  "מבין",
+  "טובה",
+  "בשביל",
+  "בזה",
+  "דרך",
+  "אוקיי",
+  "לעזור",
+  "אותנו",
+  "בבית",
+  "בואו",
+  "מספיק",
+  "הו",
+  "תהיה",
+  "הכי",
+  "הדבר",
+  "תן",
+  "י",
+  "ב",
+  "לדעת",
+  "כלום",
+  "מקום",
+  "כזה",
+  "לקחת",
+  "מזה",
+  "לכם",
+  "מתכוון",
+  "ככה",
+  "ביותר",
+  "אוכל",
+  "איתי",
+  "יודעים",
+  "אפשר",
+  "ר",
+  "וזה",
+  "לומר",
+  "ל",
+  "כאילו",
+  "קשה",
+  "לכאן",
+  "הביתה",
+  "עליי",
+  "להגיד",
+  "שנים",
+  "מת",
+  "די",
+  "למצוא",
+  "גדול",
+  "היתה",
+  "שני",
+  "בלי",
+  "מצטערת",
+  "אנו",
+  "אלה",
+  "שלהם",
+  "לקבל",
+  "הזו",
+  "יפה",
+  "ראיתי",
+  "מנסה",
+  "כמובן",
+  "מותק",
+  "מדבר",
+  "ואתה",
+  "נהדר",
+  "עליו",
+  "סליחה",
+  "אוהבת",
+  "אך",
+  "אומרת",
+  "בואי",
+  "לעולם",
+  "ממני",
+  "רוצים",
+  "הלילה",
+  "והוא",
+  "הבחור",
+  "לתת",
+  "האמת",
+  "אחי",
+  "ולא",
+  "לשם",
+  "עבור",
+  "תגיד",
+  "בית",
+  "אמרת",
+  "ואת",
+  "ד",
+  "בי",
+  "מעולם",
+  "מכאן",
+  "כסף",
+  "עבודה",
+  "זהו",
+  "מוכן",
+  "ילד",
+  "נחמד",
+  "לכל",
+  "בך",
+  "עושים",
+  "מרגיש",
+  "רציתי",
+  "עליך",
+  "נמצא",
+  "אכפת",
+  "ש",
+  "הולכים",
+  "לצאת",
+  "כדאי",
+  "עובד",
+  "בדרך",
+  "חכה",
+  "אי",
+  "לאן",
+  "עשה",
+  "איתו",
+  "מ",
+  "מהר",
+  "בזמן",
+  "ק",
+  "נוכל",
+  "לגבי",
+  "נשמע",
+  "עשית",
+  "עשיתי",
+  "בכלל",
+  "דקות",
+  "חייבת",
+  "שלכם",
+  "בשבילך",
+  "אמור",
+  "מספר",
+  "מכיר",
+  "ללא",
+  "מחר",
+  "לספר",
+  "גברת",
+  "לחזור",
+  "בעיה",
+  "רע",
+  "בא",
+  "נלך",
+  "משנה",
+  "ידעתי",
+  "מתי",
+  "חייבים",
+  "סוף",
+  "החיים",
+  "להרוג",
+  "הן",
+  "ממך",
+  "חלק",
+  "מאמין",
+  "בחור",
+  "בחייך",
+  "במקום",
+  "גבר",
+  "זוכר",
+  "הולכת",
+  "הגיע",
+  "הכול",
+  "תעשה",
+  "מקווה",
+  "לב",
+  "בחיים",
+  "הבית",
+  "המקום",
+  "ידי",
+  "חיים",
+  "כל-כך",
+  "איש",
+  "תוכל",
+  "כנראה",
+  "האנשים",
+  "כאשר",
+  "היינו",
+  "לבד",
+  "כמעט",
+  "עלי",
+  "מניח",
+  "הכסף",
+  "נעשה",
+  "לילה",
+  "ע",
+  "למעשה",
+  "דולר",
+  "שנה",
+  "שמעתי",
+  "תראי",
+  "בטוחה",
+  "לגמרי",
+  "החוצה",
+  "ילדים",
+  "קטן",
+  "הדברים",
+  "חשוב",
+  "בין",
+  "שמח",
+  "הבא",
+  "הראשון",
+  "לבוא",
+  "לחשוב",
+  "הדרך",
+  "מאז",
+  "בחזרה",
+  "אמרה",
+  "מאוחר",
+  "קודם",
+  "העבודה",
+  "אחרת",
+  "מגיע",
+  "להגיע",
+  "בה",
+  "מבינה",
+  "ברור",
+  "עצמך",
+  "בהחלט",
+  "לאחר",
+  "כלומר",
+  "השני",
+  "יחד",
+  "אוי",
+  "במשך",
+  "לפחות",
+  "לשמוע",
+  "אהיה",
+  "מוזר",
+  "ברגע",
+  "לעבוד",
+  "אליי",
+  "וואו",
+  "אישה",
+  "כעת",
+  "אליך",
+  "העולם",
+  "יופי",
+  "שלוש",
+  "מהם",
+  "הערב",
+  "אתמול",
+  "הספר",
+  "ואם",
+  "הראשונה",
+  "אתן",
+  "ספר",
+  "חדש",
+  "מושג",
+  "בוקר",
+  "שעות",
+  "לבית",
+  "מזל",
+  "להביא",
+  "בחוץ",
+  "ון",
+  "למטה",
+  "בשבילי",
+  "אלא",
+  "חברים",
+  "היכן",
+  "למעלה",
+  "כ",
+  "כולנו",
+  "מקרה",
+  "ראית",
+  "ביחד",
+  "שהיה",
+  "עלינו",
+  "להישאר",
+  "ערב",
+  "כרגע",
+  "בני",
+  "בלילה",
+  "תקשיב",
+  "אלו",
+  "האחרון",
+  "קשר",
+  "באופן",
+  "ביום",
+  "בקשר",
+  "אעשה",
+  "בת",
+  "איתה",
+  "ימים",
+  "מקבל",
+  "ומה",
+  "בתוך",
+  "השם",
+  "האיש",
+  "תפסיק",
+  "לשאול",
+  "והיא",
+  "הילד",
+  "ועכשיו",
+  "מדוע",
+  "קח",
+  "יקרה",
+  "סוג",
+  "ממנו",
+  "עליה",
+  "העיר",
+  "העניין",
+  "הפעם",
+  "החבר",
+  "הבעיה",
+  "האחרונה",
+  "שיהיה",
+  "היחיד",
+  "האלו",
+  "לפעמים",
+  "רעיון",
+  "כפי",
+  "חזרה",
+  "למען",
+  "בעוד",
+  "עומד",
+  "שבו",
+  "אלי",
+  "בנאדם",
+  "טובים",
+  "חרא",
+  "אליו",
+  "מיד",
+  "משחק",
+  "צודק",
+  "בפעם",
+  "הלו",
+  "להיכנס",
+  "עצמי",
+  "בעולם",
+  "תורגם",
+  "קטנה",
+  "תני",
+  "בלתי",
+  "איזו",
+  "לאכול",
+  "לעזוב",
+  "תראו",
+  "בפנים",
+  "לשמור",
+  "יהיו",
+  "גדולה",
+  "לעצור",
+  "שלושה",
+  "קל",
+  "הילדים",
+  "להשיג",
+  "הדלת",
+  "הרגע",
+  "אימא",
+  "להבין",
+  "בחדר",
+  "חזק",
+  "נורא",
+  "הי",
+  "רבה",
+  "הסיבה",
+  "מחוץ",
+  "הבן",
+  "יכולתי",
+  "וגם",
+  "לכן",
+  "מתכוונת",
+  "אתכם",
+  "היחידה",
+  "אמיתי",
+  "סתם",
+  "מרגישה",
+  "האדם",
+  "שאתם",
+  "אומרים",
+  "חוץ",
+  "למות",
+  "רב",
+  "ראש",
+  "נו",
+  "להתראות",
+  "אדירים",
+  "קרוב",
+  "שתי",
+  "מתה",
+  "גרוע",
+  "לוקח",
+  "מכל",
+  "נראית",
+  "פנים",
+  "להשתמש",
+  "קוראים",
+  "חברה",
+  "ממה",
+  "הראש",
+  "מדהים",
+  "ילדה",
+  "המשפחה",
+  "והם",
+  "מצחיק",
+  "חושבים",
+  "קיבלתי",
+  "מצאתי",
+  "נגד",
+  "לעבור",
+  "ליד",
+  "שאין",
+  "החברה",
+  "לקרוא",
+  "לחיות",
+  "מוכנה",
+  "חמש",
+  "עלייך",
+  "א",
+  "חיי",
+  "פחות",
+  "באותו",
+  "מפה",
+  "הבנתי",
+  "לנסות",
+  "ביי",
+  "ארוחת",
+  "אבי",
+  "נגמר",
+  "שהייתי",
+  "בשם",
+  "הבוקר",
+  "יוצא",
+  "מדברים",
+  "לשחק",
+  "אחרים",
+  "לפגוש",
+  "דם",
+  "פעמים",
+  "לנצח",
+  "תחת",
+  "חודשים",
+  "הבאה",
+  "להתחיל",
+  "ואנחנו",
+  "הטוב",
+  "לגרום",
+  "הא",
+  "סיכוי",
+  "להמשיך",
+  "לישון",
+  "שמעת",
+  "אהבה",
+  "שמישהו",
+  "זונה",
+  "שעה",
+  "נהיה",
+  "מאשר",
+  "הגדול",
+  "אותן",
+  "חצי",
+  "בקרוב",
+  "תגידי",
+  "סיבה",
+  "ס",
+  "מחדש",
+  "לבדוק",
+  "נשים",
+  "חכי",
+  "כשאני",
+  "מאמינה",
+  "מגניב",
+  "בבוקר",
+  "שכל",
+  "מדברת",
+  "לחכות",
+  "מתחיל",
+  "פרק",
+  "לכך",
+  "שאלה",
+  "לקח",
+  "צוחק",
+  "בנוגע",
+  "לשים",
+  "מכירה",
+  "נותן",
+  "אלך",
+  "חי",
+  "מעט",
+  "המכונית",
+  "התכוונתי",
+  "חדשות",
+  "צוות",
+  "משפחה",
+  "זקוק",
+  "מתחת",
+  "להציל",
+  "גמור",
+  "הזדמנות",
+  "מטורף",
+  "שונה",
+  "כאלה",
+  "מעולה",
+  "וכל",
+  "ויש",
+  "בתור",
+  "לפי",
+  "ניסיתי",
+  "סיפור",
+  "בערך",
+  "מים",
+  "לתוך",
+  "תסתכל",
+  "דעתך",
+  "זוכרת",
+  "יין",
+  "שאם",
+  "להרגיש",
+  "חוזר",
+  "עזרה",
+  "רציני",
+  "עונה",
+  "שלומך",
+  "אפשרי",
+  "מחפש",
+  "הסיפור",
+  "חתיכת",
+  "שכן",
+  "המפקד",
+  "מעל",
+  "הלך",
+  "מלא",
+  "שאולי",
+  "אנג",
+  "בצורה",
+  "שומע",
+  "נכנס",
+  "להפסיק",
+  "החדש",
+  "שווה",
+  "עניין",
+  "פנימה",
+  "כיף",
+  "חדר",
+  "חסר",
+  "ורג",
+  "כמוך",
+  "ראשון",
+  "אסור",
+  "לקנות",
+  "מאד",
+  "להתקשר",
+  "מייקל",
+  "בהם",
+  "בעבר",
+  "ראה",
+  "להראות",
+  "מצב",
+  "ברצינות",
+  "נתראה",
+  "נפלא",
+  "מוקדם",
+  "אינך",
+  "שתיים",
+  "תדאג",
+  "להגן",
+  "כלל",
+  "מאיתנו",
+  "בחורה",
+  "בנות",
+  "עבר",
+  "במה",
+  "טעות",
+  "משם",
+  "הטלפון",
+  "רצה",
+  "שקרה",
+  "שזו",
+  "להוציא",
+  "כה",
+  "עצמו",
+  "המצב",
+  "למרות",
+  "הקטן",
+  "עצור",
+  "מיליון",
+  "אקח",
+  "מסוגל",
+  "להאמין",
+  "במקרה",
+  "ידע",
+  "שבוע",
+  "איתנו",
+  "נוסף",
+  "חדשה",
+  "רצח",
+  "אמרו",
+  "איני",
+  "כוח",
+  "גברתי",
+  "גורם",
+  "עליהם",
+  "לעבודה",
+  "מוכנים",
+  "ידעת",
+  "מאחורי",
+  "ים",
+  "האישה",
+  "הכבוד",
+  "מידע",
+  "שאלות",
+  "לכי",
+  "דין",
+  "בצד",
+  "נעים",
+  "כשאתה",
+  "באתי",
+  "מפני",
+  "מבטיח",
+  "קשור",
+  "כשהוא",
+  "כדור",
+  "שאמרתי",
+  "בחיי",
+  "שמחה",
+  "קורא",
+  "נתן",
+  "מעבר",
+  "תוכלי",
+  "מס",
+  "חולה",
+  "שונא",
+  "לפה",
+  "המשטרה",
+  "במיוחד",
+  "ימי",
+  "שאוכל",
+  "קפטן",
+  "מעניין",
+  "יצא",
+  "לאנשים",
+  "גברים",
+  "אשר",
+  "ניתן",
+  "בכך",
+  "ככל",
+  "בעיות",
+  "מושלם",
+  "על-ידי",
+  "בעלי",
+  "לשתות",
+  "אראה",
+  "בעל",
+  "הלא",
+  "אגיד",
+  "אוהבים",
+  "לקרות",
+  "שרה",
+  "מין",
+  "להכיר",
+  "ארבע",
+  "אלף",
+  "להתמודד",
+  "מניחה",
+  "למקום",
+  "קפה",
+  "הבחורה",
+  "אינו",
+  "מייק",
+  "יי",
+  "ישר",
+  "לשבת",
+  "לעצמי",
+  "בראש",
+  "אידיוט",
+  "מחכה",
+  "תקשיבי",
+  "נשאר",
+  "פיטר",
+  "הבת",
+  "אלייך",
+  "שניכם",
+  "עובדת",
+  "לשלם",
+  "מן",
+  "תוך",
+  "לטפל",
+  "לזוז",
+  "המשחק",
+  "באה",
+  "עשר",
+  "לדאוג",
+  "פרנק",
+  "שצריך",
+  "אש",
+  "ללמוד",
+  "תהיי",
+  "למי",
+  "מאיפה",
+  "לעצמך",
+  "ממנה",
+  "הלב",
+  "לג",
+  "מתוקה",
+  "רוח",
+  "למישהו",
+  "חג",
+  "הנשיא",
+  "ספק",
+  "דוקטור",
+  "התחת",
+  "בעיר",
+  "המון",
+  "החולים",
+  "מוצא",
+  "לחפש",
+  "לחלוטין",
+  "שהיית",
+  "הלוואי",
+  "רד",
+  "שמי",
+  "רחוק",
+  "התיק",
+  "ההוא",
+  "אנא",
+  "מילה",
+  "חשבת",
+  "הללו",
+  "אמורה",
+  "מול",
+  "אליה",
+  "אצל",
+  "עשינו",
+  "הפנים",
+  "שוטר",
+  "שנינו",
+  "להחזיר",
+  "מערכת",
+  "מצוות",
+  "להודות",
+  "שבועות",
+  "מתוך",
+  "לתפוס",
+  "לפגוע",
+  "מיוחד",
+  "רוב",
+  "לבחור",
+  "ז",
+  "טיפש",
+  "אלינו",
+  "במצב",
+  "אחזור",
+  "תעשי",
+  "שמה",
+  "מכן",
+  "התינוק",
+  "שנוכל",
+  "להפוך",
+  "אח",
+  "בחורים",
+  "יורק",
+  "נעלם",
+  "רואים",
+  "טום",
+  "מצוין",
+  "לגלות",
+  "לכולם",
+  "לחדר",
+  "היד",
+  "שמו",
+  "בעצמי",
+  "יכולת",
+  "תחזור",
+  "הנכון",
+  "מתים",
+  "טובות",
+  "אביך",
+  "אצטרך",
+  "להסביר",
+  "מישהי",
+  "הארץ",
+  "שאמרת",
+  "תביא",
+  "איתם",
+  "טלפון",
+  "נצטרך",
+  "ייתכן",
+  "שאנו",
+  "השנה",
+  "ח",
+  "הדם",
+  "לשנות",
+  "חבל",
+  "אינני",
+  "כבוד",
+  "המשפט",
+  "המוות",
+  "רבים",
+  "צא",
+  "באמצע",
+  "יעשה",
+  "סלח",
+  "יימס",
+  "נמצאת",
+  "לרגע",
+  "החלק",
+  "להשאיר",
+  "שניות",
+  "בנו",
+  "שנייה",
+  "חכם",
+  "הודעה",
+  "פני",
+  "מידי",
+  "ליצור",
+  "הגיוני",
+  "תירגע",
+  "זין",
+  "בעצמך",
+  "לברוח",
+  "בעצם",
+  "לבן",
+  "האקדח",
+  "אכן",
+  "השבוע",
+  "יד",
+  "כולכם",
+  "הנרי",
+  "מצפה",
+  "הרג",
+  "אהבתי",
+  "בסוף",
+  "כלב",
+};
+const uint16_t WA_FREQ_57_RANKS[] = {
+  837, 0, 0, 0, 0, 0, 0, 0, 851, 0, 566, 0, 0, 0, 0, 381,
+  0, 0, 0, 0, 612, 410, 969, 323, 0, 752, 527, 0, 332, 710, 0, 0,
+  0, 0, 0, 0, 0, 558, 0, 0, 0, 0, 996, 442, 782, 0, 0, 0,
+  0, 0, 0, 0, 0, 832, 614, 0, 0, 976, 0, 0, 0, 0, 0, 724,
+  128, 0, 0, 50, 0, 289, 327, 0, 701, 0, 0, 0, 32, 607, 112, 391,
+  13, 169, 141, 619, 692, 774, 0, 0, 511, 0, 921, 0, 235, 239, 76, 98,
+  598, 673, 863, 0, 371, 995, 0, 0, 0, 105, 0, 0, 0, 0, 539, 0,
+  0, 318, 491, 706, 0, 0, 0, 717, 156, 0, 508, 157, 0, 0, 0, 881,
+  0, 0, 0, 0, 0, 344, 427, 211, 439, 978, 59, 0, 0, 835, 0, 0,
+  461, 618, 769, 582, 517, 588, 748, 56, 227, 475, 684, 709, 63, 802, 14, 623,
+  485, 972, 431, 40, 441, 513, 38, 200, 48, 591, 670, 708, 762, 777, 917, 644,
+  31, 681, 741, 362, 610, 793, 0, 0, 738, 873, 893, 164, 682, 0, 0, 0,
+  0, 349, 376, 496, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 267, 833,
+  445, 675, 0, 0, 0, 989, 343, 808, 0, 0, 505, 875, 249, 0, 0, 803,
+  0, 0, 0, 280, 0, 0, 95, 0, 360, 0, 0, 0, 312, 0, 0, 0,
+  616, 0, 0, 0, 251, 455, 0, 96, 0, 335, 0, 195, 532, 636, 0, 0,
+  0, 0, 0, 202, 0, 790, 0, 0, 102, 756, 0, 0, 0, 0, 904, 87,
+  0, 177, 590, 0, 0, 173, 546, 74, 45, 490, 844, 1000, 486, 0, 135, 368,
+  604, 674, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 258, 0, 0, 256,
+  116, 218, 0, 477, 0, 0, 0, 0, 0, 0, 757, 176, 783, 0, 0, 0,
+  0, 919, 0, 561, 183, 66, 555, 830, 0, 0, 52, 375, 0, 253, 162, 685,
+  0, 0, 0, 0, 0, 188, 423, 806, 888, 0, 408, 0, 823, 0, 240, 295,
+  487, 0, 0, 575, 435, 0, 403, 0, 0, 0, 34, 3, 293, 776, 780, 857,
+  600, 0, 0, 0, 0, 340, 825, 0, 0, 749, 336, 0, 0, 457, 986, 0,
+  137, 784, 743, 0, 161, 579, 0, 0, 0, 454, 880, 0, 0, 21, 0, 0,
+  0, 979, 47, 140, 158, 874, 1, 420, 0, 0, 565, 899, 552, 699, 261, 86,
+  957, 0, 0, 0, 0, 220, 0, 0, 0, 0, 384, 0, 0, 0, 0, 0,
+  0, 51, 0, 0, 305, 22, 0, 0, 0, 281, 0, 134, 234, 6, 37, 111,
+  615, 635, 834, 415, 846, 27, 132, 879, 0, 0, 944, 307, 206, 745, 858, 345,
+  0, 0, 0, 197, 205, 0, 0, 238, 0, 397, 854, 0, 0, 0, 0, 0,
+  0, 250, 0, 5, 148, 817, 0, 0, 0, 775, 0, 0, 0, 0, 0, 418,
+  0, 938, 0, 0, 2, 712, 800, 0, 470, 0, 0, 0, 0, 977, 0, 658,
+  795, 0, 0, 0, 0, 0, 434, 331, 637, 462, 338, 0, 0, 634, 294, 0,
+  36, 16, 939, 0, 352, 0, 0, 734, 794, 0, 0, 965, 0, 686, 819, 184,
+  193, 831, 481, 778, 0, 719, 0, 0, 727, 0, 0, 0, 0, 0, 0, 366,
+  0, 0, 746, 0, 468, 0, 444, 0, 0, 272, 585, 0, 0, 0, 0, 0,
+  0, 915, 0, 208, 601, 0, 707, 0, 647, 0, 287, 243, 370, 829, 529, 380,
+  0, 544, 609, 541, 578, 764, 99, 0, 0, 0, 182, 0, 0, 935, 0, 0,
+  0, 0, 467, 569, 0, 277, 0, 0, 0, 0, 0, 0, 984, 0, 166, 0,
+  0, 0, 46, 562, 0, 425, 43, 0, 0, 395, 805, 49, 139, 0, 385, 0,
+  20, 244, 330, 363, 364, 0, 58, 0, 903, 0, 0, 0, 0, 174, 948, 117,
+  870, 0, 114, 0, 163, 0, 0, 0, 168, 233, 653, 687, 728, 761, 755, 62,
+  864, 991, 962, 656, 0, 142, 0, 0, 0, 0, 876, 0, 0, 545, 853, 26,
+  0, 836, 0, 0, 999, 0, 0, 0, 0, 649, 0, 0, 0, 0, 626, 0,
+  130, 0, 0, 0, 0, 0, 629, 729, 0, 0, 0, 0, 0, 0, 0, 0,
+  151, 0, 0, 0, 504, 0, 0, 0, 0, 190, 0, 0, 0, 0, 0, 291,
+  0, 61, 0, 955, 144, 304, 523, 531, 377, 877, 324, 0, 0, 0, 0, 0,
+  0, 953, 247, 406, 85, 766, 810, 0, 0, 929, 0, 0, 0, 0, 0, 65,
+  412, 0, 0, 0, 0, 317, 0, 694, 0, 0, 0, 101, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 458, 0, 300, 0, 260, 78, 44, 797, 951, 718, 97,
+  763, 897, 572, 0, 0, 347, 0, 940, 35, 351, 422, 677, 0, 0, 348, 0,
+  0, 129, 0, 0, 0, 0, 0, 0, 110, 0, 0, 0, 181, 0, 691, 0,
+  0, 0, 690, 621, 108, 0, 299, 0, 0, 210, 413, 482, 554, 798, 494, 985,
+  386, 358, 0, 225, 346, 0, 0, 0, 73, 409, 0, 0, 0, 0, 283, 0,
+  484, 0, 0, 0, 0, 730, 0, 0, 217, 0, 90, 0, 0, 0, 534, 770,
+  0, 0, 0, 967, 0, 941, 0, 0, 720, 0, 0, 201, 0, 524, 0, 666,
+  0, 224, 0, 973, 0, 0, 0, 0, 106, 209, 0, 355, 0, 593, 0, 0,
+  0, 0, 0, 705, 0, 0, 0, 150, 0, 81, 0, 0, 0, 0, 0, 437,
+  913, 126, 507, 693, 0, 896, 0, 0, 0, 0, 0, 492, 0, 0, 0, 274,
+  960, 0, 865, 453, 92, 121, 908, 959, 124, 167, 314, 402, 221, 416, 476, 563,
+  75, 583, 628, 669, 772, 773, 824, 0, 440, 0, 93, 0, 0, 0, 702, 0,
+  0, 659, 0, 0, 0, 0, 0, 0, 0, 0, 302, 992, 0, 0, 0, 639,
+  0, 0, 0, 0, 0, 697, 0, 0, 0, 787, 0, 0, 867, 0, 0, 608,
+  739, 932, 464, 0, 226, 0, 668, 0, 0, 339, 599, 480, 0, 0, 0, 0,
+  0, 70, 0, 526, 0, 0, 0, 483, 232, 856, 460, 0, 901, 0, 0, 0,
+  216, 0, 0, 768, 657, 788, 119, 214, 617, 0, 0, 29, 0, 0, 82, 213,
+  266, 452, 0, 0, 297, 0, 0, 0, 0, 0, 698, 809, 0, 0, 0, 0,
+  0, 149, 125, 512, 654, 0, 0, 0, 245, 257, 0, 0, 0, 396, 0, 0,
+  0, 0, 153, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 733, 212, 0,
+  678, 0, 229, 0, 0, 0, 264, 0, 0, 0, 0, 900, 0, 0, 655, 0,
+  0, 0, 0, 0, 192, 0, 760, 753, 0, 0, 186, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 306, 0, 0, 179, 722, 0, 968, 0, 816, 0, 0, 25,
+  781, 792, 530, 320, 298, 109, 392, 869, 0, 0, 0, 0, 0, 0, 451, 726,
+  804, 723, 0, 0, 0, 868, 493, 891, 0, 0, 252, 0, 0, 911, 0, 0,
+  522, 0, 0, 24, 0, 0, 0, 0, 337, 0, 949, 0, 100, 0, 0, 0,
+  0, 0, 8, 115, 394, 594, 0, 83, 812, 820, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 373, 0, 0, 103, 577, 262, 356, 680, 907, 0, 0, 0,
+  0, 0, 474, 0, 0, 0, 357, 0, 10, 688, 0, 796, 581, 269, 650, 822,
+  994, 170, 596, 840, 878, 0, 0, 215, 683, 847, 0, 433, 0, 0, 0, 0,
+  191, 175, 430, 0, 0, 0, 241, 0, 703, 53, 0, 171, 417, 0, 0, 0,
+  0, 0, 0, 0, 956, 571, 185, 0, 0, 231, 0, 326, 0, 0, 632, 265,
+  564, 89, 882, 909, 379, 521, 0, 278, 223, 136, 736, 488, 311, 589, 850, 631,
+  845, 887, 927, 80, 473, 966, 997, 0, 0, 661, 535, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 194, 660, 0, 268, 622, 0, 551, 0, 292, 704, 715, 905,
+  922, 0, 0, 0, 374, 961, 0, 0, 0, 0, 587, 852, 0, 0, 843, 0,
+  0, 0, 0, 0, 365, 0, 263, 0, 0, 0, 799, 0, 165, 489, 548, 638,
+  918, 0, 0, 520, 0, 0, 0, 0, 255, 0, 0, 0, 0, 0, 120, 0,
+  382, 0, 0, 0, 0, 0, 428, 393, 0, 0, 242, 584, 713, 0, 0, 0,
+  0, 0, 0, 178, 595, 735, 199, 502, 113, 767, 633, 862, 811, 923, 0, 0,
+  0, 0, 0, 354, 0, 0, 0, 367, 711, 0, 0, 0, 0, 0, 0, 0,
+  0, 369, 970, 0, 0, 0, 0, 288, 516, 667, 0, 0, 0, 0, 0, 0,
+  514, 556, 646, 0, 0, 0, 848, 0, 0, 405, 0, 0, 387, 740, 275, 313,
+  246, 60, 0, 958, 0, 510, 64, 273, 860, 341, 731, 849, 436, 426, 0, 0,
+  0, 0, 620, 284, 0, 0, 207, 259, 456, 0, 0, 18, 0, 0, 127, 950,
+  0, 0, 479, 990, 0, 0, 0, 0, 0, 0, 7, 0, 606, 0, 0, 0,
+  315, 309, 0, 0, 0, 0, 0, 0, 0, 0, 643, 154, 0, 821, 301, 0,
+  945, 0, 328, 438, 597, 826, 737, 910, 419, 0, 0, 0, 0, 0, 980, 0,
+  0, 0, 883, 580, 0, 303, 0, 0, 0, 515, 964, 592, 0, 222, 549, 0,
+  695, 926, 0, 725, 11, 407, 497, 0, 0, 0, 0, 189, 0, 466, 0, 946,
+  0, 0, 0, 0, 963, 0, 0, 322, 573, 0, 0, 0, 0, 828, 568, 172,
+  500, 0, 459, 0, 920, 0, 0, 0, 898, 0, 447, 478, 676, 290, 842, 19,
+  0, 0, 0, 889, 0, 0, 0, 0, 0, 0, 0, 0, 576, 696, 0, 0,
+  0, 0, 0, 0, 79, 987, 0, 0, 550, 861, 0, 759, 0, 463, 203, 916,
+  0, 0, 450, 663, 902, 84, 499, 625, 0, 0, 350, 993, 0, 0, 0, 0,
+  528, 228, 107, 319, 627, 286, 543, 721, 747, 943, 0, 0, 0, 160, 401, 936,
+  414, 859, 0, 472, 586, 77, 372, 0, 0, 630, 714, 0, 0, 68, 0, 0,
+  15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 785, 432, 0, 138, 0,
+  0, 17, 813, 924, 974, 359, 0, 0, 912, 0, 0, 611, 885, 914, 841, 0,
+  0, 0, 333, 0, 872, 0, 0, 0, 448, 952, 0, 0, 0, 0, 0, 0,
+  0, 0, 9, 751, 0, 0, 0, 334, 542, 55, 0, 0, 0, 981, 0, 0,
+  0, 0, 0, 325, 71, 603, 925, 0, 0, 0, 424, 538, 187, 0, 404, 254,
+  934, 0, 645, 219, 791, 0, 894, 0, 537, 648, 0, 855, 933, 0, 72, 0,
+  557, 570, 0, 954, 0, 0, 0, 886, 0, 143, 871, 0, 155, 0, 285, 398,
+  664, 758, 0, 0, 540, 0, 0, 204, 0, 0, 12, 624, 744, 0, 0, 133,
+  271, 975, 0, 0, 0, 838, 0, 814, 895, 0, 0, 0, 0, 0, 495, 0,
+  104, 0, 0, 54, 679, 0, 0, 536, 282, 69, 378, 421, 122, 754, 503, 807,
+  750, 28, 815, 827, 248, 446, 146, 296, 574, 605, 665, 928, 0, 560, 30, 180,
+  145, 0, 602, 866, 641, 0, 0, 159, 23, 652, 0, 0, 0, 998, 0, 0,
+  0, 0, 198, 839, 308, 353, 0, 0, 152, 0, 988, 0, 0, 0, 0, 0,
+  0, 0, 0, 651, 118, 0, 786, 0, 0, 0, 390, 0, 465, 4, 506, 94,
+  518, 662, 310, 316, 449, 501, 237, 509, 779, 942, 443, 983, 559, 0, 230, 642,
+  388, 0, 0, 0, 640, 700, 0, 270, 400, 890, 411, 672, 947, 0, 399, 0,
+  0, 0, 41, 429, 613, 0, 801, 0, 0, 39, 0, 0, 329, 931, 567, 469,
+  321, 123, 276, 471, 742, 892, 547, 671, 0, 0, 88, 0, 0, 0, 884, 982,
+  818, 0, 0, 342, 498, 906, 383, 0, 361, 0, 525, 0, 0, 0, 0, 0,
+  0, 0, 0, 33, 0, 0, 42, 196, 553, 0, 732, 147, 389, 0, 771, 91,
+  0, 0, 0, 57, 789, 930, 0, 0, 67, 0, 0, 0, 533, 279, 765, 971,
+  0, 0, 0, 0, 0, 937, 0, 716, 0, 0, 0, 689, 0, 0, 519, 131,
+};
+
+const char *WA_FREQ_58_TOKENS[] = {
+  "है",
+  "।",
+  "के",
+  "मैं",
+  "नहीं",
+  "हैं",
+  "में",
+  "एक",
+  "आप",
+  "लिए",
+  "और",
+  "यह",
+  "से",
+  "की",
+  "क्या",
+  "कि",
+  "तुम",
+  "हो",
+  "कर",
+  "मुझे",
+  "को",
+  "हम",
+  "था",
+  "वह",
+  "पर",
+  "हूँ",
+  "रहे",
+  "भी",
+  "रहा",
+  "का",
+  "अपने",
+  "कुछ",
+  "तो",
+  "गया",
+  "इस",
+  "मेरे",
+  "ठीक",
+  "करने",
+  "किया",
+  "साथ",
+  "उसे",
+  "हाँ",
+  "वे",
+  "सकते",
+  "लेकिन",
+  "यहाँ",
+  "तुम्हें",
+  "कोई",
+  "तरह",
+  "अब",
+  "पता",
+  "होगा",
+  "बहुत",
+  "बात",
+  "सकता",
+  "जाओ",
+  "ही",
+  "दिया",
+  "करना",
+  "जा",
+  "मेरी",
+  "सब",
+  "बारे",
+  "लगता",
+  "कहा",
+  "जो",
+  "वहाँ",
+  "जब",
+  "इसे",
+  "अच्छा",
+  "चाहिए",
+  "बाहर",
+  "करो",
+  "क्यों",
+  "अपनी",
+  "थे",
+  "चलो",
+  "दो",
+  "ले",
+  "किसी",
+  "फिर",
+  "काम",
+  "अगर",
+  "ये",
+  "कैसे",
+  "करते",
+  "पहले",
+  "बस",
+  "चाहते",
+  "जाएगा",
+  "आदमी",
+  "कभी",
+  "समय",
+  "वापस",
+  "हमें",
+  "रही",
+  "आ",
+  "तक",
+  "हमारे",
+  "मेरा",
+  "रूप",
+  "मैंने",
+  "करता",
+  "या",
+  "अभी",
+  "मिल",
+  "चाहता",
+  "घर",
+  "उसके",
+  "सभी",
+  "उस",
+  "मत",
+  "आपको",
+  "जाना",
+  "अरे",
+  "सिर्फ",
+  "बंद",
+  "ओह",
+  "उन्हें",
+  "सही",
+  "हूं",
+  "थी",
+  "देखो",
+  "ने",
+  "तुम्हारे",
+  "प्यार",
+  "वो",
+  "जरूरत",
+  "लोगों",
+  "हुआ",
+  "करें",
+  "ऐसा",
+  "उन्होंने",
+  "दिन",
+  "न",
+  "बाद",
+  "कौन",
+  "हर",
+  "पास",
+  "दे",
+  "नीचे",
+  "देखा",
+  "जाता",
+  "बार",
+  "कृपया",
+  "धन्यवाद",
+  "पिता",
+  "करेंगे",
+  "भगवान",
+  "क्योंकि",
+  "लोग",
+  "वाला",
+  "जानते",
+  "देख",
+  "छोड़",
+  "आज",
+  "मतलब",
+  "कहाँ",
+  "जीवन",
+  "आओ",
+  "जाने",
+  "अधिक",
+  "यही",
+  "होता",
+  "सर",
+  "मदद",
+  "रात",
+  "माँ",
+  "लिया",
+  "केवल",
+  "तुमने",
+  "सबसे",
+  "नाम",
+  "मार",
+  "हुए",
+  "हमेशा",
+  "याद",
+  "कारण",
+  "गए",
+  "आया",
+  "जानता",
+  "शायद",
+  "साल",
+  "दूर",
+  "हे",
+  "होने",
+  "फोन",
+  "भाई",
+  "वास्तव",
+  "शुरू",
+  "उसकी",
+  "मिला",
+  "जगह",
+  "कोशिश",
+  "कम",
+  "सच",
+  "लग",
+  "शादी",
+  "पसंद",
+  "चला",
+  "इन",
+  "अच्छी",
+  "तुम्हारी",
+  "यहां",
+  "दोस्त",
+  "मर",
+  "कहते",
+  "होना",
+  "दुनिया",
+  "तुम्हारा",
+  "एम",
+  "कह",
+  "इसके",
+  "रुको",
+  "तैयार",
+  "बच्चे",
+  "उन",
+  "लो",
+  "उनके",
+  "जैसे",
+  "इतना",
+  "जल्दी",
+  "अंदर",
+  "श्री",
+  "यदि",
+  "पिताजी",
+  "कल",
+  "ऊपर",
+  "देंगे",
+  "आपके",
+  "हमारी",
+  "बताओ",
+  "खुद",
+  "गई",
+  "अपना",
+  "खैर",
+  "उसने",
+  "वाले",
+  "चलते",
+  "रहो",
+  "दी",
+  "मिलता",
+  "बेहतर",
+  "कार",
+  "बकवास",
+  "पीछे",
+  "द्वारा",
+  "मुझसे",
+  "हाथ",
+  "विश्वास",
+  "पूरी",
+  "ना",
+  "महिला",
+  "लड़की",
+  "आपका",
+  "देखने",
+  "तुमसे",
+  "लगा",
+  "उसका",
+  "चल",
+  "ओर",
+  "मिनट",
+  "समझ",
+  "बिना",
+  "बता",
+  "तीन",
+  "सुनो",
+  "पैसे",
+  "होगी",
+  "दोनों",
+  "कहना",
+  "पुलिस",
+  "देना",
+  "पुरुष",
+  "कहीं",
+  "बना",
+  "परिवार",
+  "खो",
+  "दिल",
+  "हां",
+  "लेने",
+  "बेटा",
+  "सोचा",
+  "आगे",
+  "जहां",
+  "पागल",
+  "सुना",
+  "जाते",
+  "चले",
+  "बोल",
+  "गलत",
+  "ज्यादा",
+  "महसूस",
+  "चाहती",
+  "सकती",
+  "यकीन",
+  "इसलिए",
+  "पी",
+  "डर",
+  "आता",
+  "आपकी",
+  "लड़का",
+  "उह",
+  "समस्या",
+  "बुरा",
+  "सुंदर",
+  "छोटे",
+  "बताया",
+  "खत्म",
+  "आने",
+  "माफ",
+  "कमबख्त",
+  "यार",
+  "बीच",
+  "दूसरे",
+  "काफी",
+  "भूल",
+  "ध्यान",
+  "हुई",
+  "तब",
+  "बेटी",
+  "रहने",
+  "खेल",
+  "बड़ा",
+  "माफी",
+  "बच्चों",
+  "शहर",
+  "आह",
+  "पूरा",
+  "बदल",
+  "देने",
+  "देखते",
+  "देर",
+  "डाल",
+  "बिल्कुल",
+  "कई",
+  "वाह",
+  "सोच",
+  "भुगतान",
+  "जैक",
+  "बेटे",
+  "मुझ",
+  "पानी",
+  "महोदय",
+  "आग",
+  "देता",
+  "आते",
+  "कहां",
+  "चिंता",
+  "रखना",
+  "उससे",
+  "पहली",
+  "बनाने",
+  "गोली",
+  "माध्यम",
+  "कितना",
+  "सुरक्षित",
+  "देखना",
+  "वहां",
+  "इससे",
+  "इसका",
+  "मारा",
+  "पत्नी",
+  "रहना",
+  "पार्टी",
+  "अन्य",
+  "अच्छे",
+  "हैलो",
+  "महान",
+  "आए",
+  "क्षमा",
+  "पिछले",
+  "मारने",
+  "रहते",
+  "वादा",
+  "राजा",
+  "इंतजार",
+  "उनकी",
+  "सुबह",
+  "सिर",
+  "नए",
+  "विचार",
+  "दोस्तों",
+  "योजना",
+  "प्राप्त",
+  "घंटे",
+  "खुश",
+  "अंत",
+  "करती",
+  "करेगा",
+  "थोड़ा",
+  "सम्मान",
+  "आदेश",
+  "पूरे",
+  "अलग",
+  "उम्मीद",
+  "आर",
+  "पाने",
+  "औरत",
+  "इतनी",
+  "लड़के",
+  "गिर",
+  "संगीत",
+  "रास्ता",
+  "युद्ध",
+  "रास्ते",
+  "हमारा",
+  "जारी",
+  "मन",
+  "लड़ाई",
+  "डाला",
+  "शुक्रिया",
+  "मुश्किल",
+  "आराम",
+  "चुका",
+  "प्रिय",
+  "झूठ",
+  "बंदूक",
+  "खुशी",
+  "नरक",
+  "आशा",
+  "चुप",
+  "उपयोग",
+  "सवाल",
+  "आपने",
+  "वैसे",
+  "देश",
+  "रखो",
+  "असली",
+  "बड़ी",
+  "जैसा",
+  "सुन",
+  "हाय",
+  "चोट",
+  "रखा",
+  "मौत",
+  "पापा",
+  "पर्याप्त",
+  "पुरुषों",
+  "शांत",
+  "पुराने",
+  "हंसते",
+  "सा",
+  "दें",
+  "पकड़",
+  "बहन",
+  "सामने",
+  "सुरक्षा",
+  "खाने",
+  "खाना",
+  "चाचा",
+  "बन",
+  "अमेरिका",
+  "परेशान",
+  "बच्चा",
+  "सी",
+  "जवाब",
+  "सेना",
+  "आसान",
+  "पैसा",
+  "ऐसे",
+  "महीने",
+  "रखने",
+  "छोटी",
+  "अलविदा",
+  "कदम",
+  "अगले",
+  "भाग",
+  "नमस्ते",
+  "सारे",
+  "लंबे",
+  "देते",
+  "कॉल",
+  "छोटा",
+  "भाड़",
+  "बनाया",
+  "हमने",
+  "स्थिति",
+  "इस्तेमाल",
+  "परवाह",
+  "कैसा",
+  "होती",
+  "गलती",
+  "राम",
+  "नष्ट",
+  "स्वागत",
+  "अजीब",
+  "रह",
+  "व्यक्ति",
+  "मूर्ख",
+  "तुम्हे",
+  "सिकंदर",
+  "मै",
+  "मालिक",
+  "गंदगी",
+  "रखें",
+  "नौकरी",
+  "हांक",
+  "जीत",
+  "कंपनी",
+  "लेंगे",
+  "चारों",
+  "तस्वीर",
+  "रहता",
+  "कहानी",
+  "खड़े",
+  "रोक",
+  "बातें",
+  "अकेले",
+  "किस",
+  "साफ",
+  "िलए",
+  "मौका",
+  "भरोसा",
+  "चिल्ला",
+  "जहाँ",
+  "कसम",
+  "सारा",
+  "करीब",
+  "जान",
+  "तुलना",
+  "इतने",
+  "कब",
+  "यात्रा",
+  "हमला",
+  "रक्षा",
+  "पाया",
+  "जल्द",
+  "पति",
+  "गयी",
+  "जहाज",
+  "बेबी",
+  "हवा",
+  "आती",
+  "दरवाजा",
+  "जाएगी",
+  "कहता",
+  "स्कॉट",
+  "मिलेगा",
+  "मां",
+  "वाली",
+  "वजह",
+  "महत्वपूर्ण",
+  "जय",
+  "अकेला",
+  "सामान",
+  "सो",
+  "रख",
+  "शामिल",
+  "नया",
+  "मिलने",
+  "निश्चित",
+  "करनी",
+  "स्कूल",
+  "जेल",
+  "तरफ",
+  "बड़े",
+  "पल",
+  "अंतिम",
+  "ब्रायन",
+  "पैदा",
+  "चार",
+  "कितने",
+  "कहने",
+  "इंदर",
+  "इंतज़ार",
+  "जी",
+  "मातृभाषा",
+  "अस्पताल",
+  "जाँच",
+  "बर्बाद",
+  "दर्द",
+  "दिनों",
+  "शॉन",
+  "पृथ्वी",
+  "महिलाओं",
+  "पूछ",
+  "लगभग",
+  "नफरत",
+  "बताने",
+  "देखें",
+  "ट्रेवर",
+  "सप्ताह",
+  "बेशक",
+  "डॉक्टर",
+  "पांच",
+  "स्पष्ट",
+  "लगी",
+  "इसकी",
+  "तोड़",
+  "मजाक",
+  "पालन",
+  "यहीं",
+  "खाता",
+  "क्षेत्र",
+  "भर",
+  "मामले",
+  "खबर",
+  "ज़रूरत",
+  "सड़क",
+  "हत्या",
+  "समाप्त",
+  "प्रकार",
+  "ली",
+  "संदेश",
+  "क्लिक",
+  "माफ़",
+  "शब्द",
+  "खिलाफ",
+  "खून",
+  "जॉन",
+  "लाने",
+  "शक्ति",
+  "जाए",
+  "फ्यूरर",
+  "भोजन",
+  "आवाज",
+  "हिस्सा",
+  "कमीने",
+  "वही",
+  "भेजा",
+  "होंगे",
+  "देगा",
+  "जानती",
+  "गधे",
+  "रंग",
+  "मृत",
+  "शांति",
+  "आश्चर्य",
+  "बेवकूफ",
+  "शरीर",
+  "इच्छा",
+  "टीम",
+  "बताना",
+  "बचा",
+  "होते",
+  "कहो",
+  "आना",
+  "लाइन",
+  "मरने",
+  "व्यापार",
+  "कितनी",
+  "सं",
+  "दुश्मन",
+  "तेजी",
+  "स्वीकार",
+  "जिस",
+  "जीवित",
+  "बाकी",
+  "पार",
+  "दस",
+  "कमरे",
+  "संभाल",
+  "खोज",
+  "आसपास",
+  "कार्यालय",
+  "बढ़िया",
+  "मिशन",
+  "बर्ट",
+  "खेद",
+  "लेकर",
+  "डौग",
+  "चोरी",
+  "चेहरे",
+  "एंडी",
+  "हम्म",
+  "चुके",
+  "जानेमन",
+  "राष्ट्रपति",
+  "हथियार",
+  "सरकार",
+  "पूर्व",
+  "जंगल",
+  "बचाने",
+  "लेना",
+  "मानव",
+  "बेकार",
+  "ग्रह",
+  "करके",
+  "सोचते",
+  "लाया",
+  "गये",
+  "नेता",
+  "हा",
+  "जांच",
+  "साथी",
+  "बैठ",
+  "साहब",
+  "प्रार्थना",
+  "यीशु",
+  "अनुमति",
+  "मजबूत",
+  "लड़कियों",
+  "भेज",
+  "पूछना",
+  "विकल्प",
+  "सीधे",
+  "खोजने",
+  "सवारी",
+  "नंबर",
+  "मैडम",
+  "विशेष",
+  "दूसरी",
+  "ख्याल",
+  "उत्तर",
+  "दिमाग",
+  "मुक्त",
+  "उनका",
+  "उनमें",
+  "कॉलेज",
+  "कप्तान",
+  "हाउस",
+  "निशान",
+  "आवश्यकता",
+  "पेड़",
+  "सारी",
+  "निकल",
+  "ऐसी",
+  "श्रीमान",
+  "हालांकि",
+  "जिंदा",
+  "पैर",
+  "युवा",
+  "तय",
+  "राज्य",
+  "जादू",
+  "जानकारी",
+  "नई",
+  "शॉ",
+  "इसमें",
+  "सुनिश्चित",
+  "बुरी",
+  "पीठ",
+  "समुद्र",
+  "पड़ा",
+  "व्हाइट",
+  "गर्म",
+  "कोड",
+  "कठिन",
+  "मुसीबत",
+  "लायक",
+  "सोने",
+  "छह",
+  "रेडियो",
+  "समझते",
+  "करोगे",
+  "दरवाजे",
+  "सेकंड",
+  "भविष्य",
+  "जला",
+  "सामान्य",
+  "कोडी",
+  "खाली",
+  "निर्णय",
+  "दूसरों",
+  "गति",
+  "नियंत्रण",
+  "गंभीर",
+  "आँखें",
+  "चाल",
+  "परमाणु",
+  "बिस्तर",
+  "अधिकार",
+  "गायब",
+  "कपड़े",
+  "लक्ष्य",
+  "तेज",
+  "प्रेज़ीडेंट",
+  "दौरान",
+  "चलिए",
+  "जाती",
+  "तरीका",
+  "चेहरा",
+  "उड़ान",
+  "जबकि",
+  "जिम",
+  "ड्राइव",
+  "तुरंत",
+  "लानत",
+  "निर्माण",
+  "दूसरा",
+  "ग्रन्ट्स",
+  "संभव",
+  "कुतिया",
+  "सक्षम",
+  "कॉफी",
+  "विंसेंट",
+  "सावधान",
+  "पहुँच",
+  "सांस",
+  "प्रवेश",
+  "सपना",
+  "बिजली",
+  "पेले",
+  "इंजन",
+  "तरीके",
+  "लड़कों",
+  "दुकान",
+  "संपर्क",
+  "सेवा",
+  "पूछा",
+  "चुकी",
+  "बुला",
+  "मारो",
+  "अलावा",
+  "करूँगा",
+  "फेंक",
+  "ड्रैगन",
+  "नमस्कार",
+  "उठो",
+  "पक्ष",
+  "बीमार",
+  "धीरे",
+  "भारी",
+  "पकड़ो",
+  "मिले",
+  "प्रभु",
+  "लगाने",
+  "ओक्जा",
+  "खा",
+  "सहमत",
+  "रिपोर्ट",
+  "मृत्यु",
+  "चाय",
+  "बैठक",
+  "सात",
+  "खराब",
+  "आत्मा",
+  "नुकसान",
+  "खर्च",
+  "पड़ता",
+  "लाख",
+  "समझा",
+  "निकाल",
+  "बिलकुल",
+  "प्लीज़",
+  "बारी",
+  "भूमि",
+  "लेते",
+  "खींच",
+  "दूँगा",
+  "जमीन",
+  "कार्य",
+  "सामना",
+  "बजे",
+  "आई",
+  "प्रकाश",
+  "लें",
+  "सूअर",
+  "चाची",
+  "लेफ्टिनेंट",
+  "देखेंगे",
+  "चीजें",
+  "छोड़ने",
+  "पीछा",
+  "बढ़",
+  "भाग्यशाली",
+  "गर्व",
+  "ताकि",
+  "टूट",
+  "शानदार",
+  "उच्च",
+  "भाग्य",
+  "टायर",
+  "पहला",
+  "ओम",
+  "डी",
+  "तेरे",
+  "सौदा",
+  "काट",
+  "कराह",
+  "खूबसूरत",
+  "बनाना",
+  "गड़बड़",
+  "फैसला",
+  "ज़रूर",
+  "प्रतीक्षा",
+  "थोड़ी",
+  "वर्ष",
+  "नही",
+  "दिखाने",
+  "परिवर्तन",
+  "समुद्री",
+  "आनंद",
+  "रोकने",
+  "सूट",
+  "शिकार",
+  "मारे",
+  "साइमन",
+  "मील",
+  "जानना",
+  "वक्त",
+  "सैम",
+  "धोखा",
+  "चिंतित",
+  "जन्मदिन",
+  "टीवी",
+  "कल्पना",
+  "पा",
+  "बधाई",
+  "होटल",
+  "पुरानी",
+  "इसी",
+  "हिम्मत",
+  "राहुल",
+  "हेलो",
+  "लाल",
+  "समर्थन",
+  "जिसे",
+  "कार्ड",
+  "डैनी",
+  "चलें",
+  "बेच",
+  "डॉलर",
+  "जाएंगे",
+  "जाएँ",
+  "माफ़",
+  "ए",
+  "गले",
+  "बदलने",
+  "प्यारी",
+  "भयानक",
+  "अचानक",
+  "कानून",
+  "उसी",
+  "खतरनाक",
+  "बच",
+  "स्थान",
+  "भागो",
+  "रक्त",
+  "उड़ा",
+  "साबित",
+  "दक्षिण",
+  "उम्र",
+  "रहें",
+  "सोचता",
+  "सुनने",
+  "बैठो",
+  "तलाश",
+  "शाम",
+  "मास्टर",
+  "धत्",
+  "बुलाया",
+  "मानना",
+  "व्यस्त",
+  "ज़्यादा",
+  "दूंगा",
+  "अप",
+  "फ़ोन",
+  "ऐलिस",
+  "खड़ा",
+  "सोचो",
+  "करूंगा",
+  "डॉ",
+  "रानी",
+  "एलिजाबेथ",
+  "रो",
+  "आये",
+  "करोड़",
+  "दूरी",
+  "लेता",
+  "हार",
+  "बज",
+  "एरिक",
+  "कीजिए",
+  "छत",
+  "सके",
+  "माता",
+  "मिली",
+  "देखकर",
+  "देखभाल",
+  "अध्यक्ष",
+  "पहचान",
+  "पूछो",
+  "तूफान",
+  "बैग",
+  "किए",
+  "तौर",
+  "एन",
+  "दीवार",
+  "इलाज",
+  "समझे",
+  "मुख्य",
+  "शराब",
+  "सेट",
+  "कराहना",
+  "सज्जनों",
+  "फर्क",
+  "राजनीति",
+  "कमांडर",
+  "प्रणाली",
+  "दिखाई",
+  "बम",
+  "जाकर",
+  "हाल",
+  "स्टेशन",
+  "लाओ",
+  "घुरघुराना",
+  "भारत",
+  "पश्चिम",
+};
+const uint16_t WA_FREQ_58_RANKS[] = {
+  830, 0, 0, 122, 521, 0, 466, 0, 508, 0, 0, 0, 0, 269, 42, 274,
+  283, 182, 905, 104, 577, 0, 279, 563, 0, 0, 0, 0, 33, 55, 203, 774,
+  866, 0, 192, 0, 10, 0, 70, 0, 0, 0, 150, 0, 0, 0, 411, 0,
+  0, 0, 816, 0, 188, 504, 861, 392, 0, 0, 0, 229, 0, 0, 357, 0,
+  0, 0, 602, 0, 69, 185, 426, 748, 0, 0, 770, 0, 0, 0, 404, 598,
+  872, 0, 379, 551, 667, 717, 805, 803, 0, 731, 484, 427, 950, 932, 647, 920,
+  451, 92, 554, 32, 0, 0, 0, 698, 0, 966, 0, 240, 168, 0, 0, 0,
+  660, 0, 0, 177, 190, 495, 352, 864, 0, 376, 530, 473, 398, 605, 975, 158,
+  702, 0, 0, 191, 0, 0, 0, 639, 0, 0, 40, 729, 0, 388, 394, 0,
+  0, 0, 0, 845, 0, 0, 0, 0, 0, 476, 0, 0, 305, 860, 0, 0,
+  0, 0, 686, 314, 128, 373, 659, 0, 0, 0, 0, 149, 0, 0, 0, 387,
+  0, 460, 625, 0, 0, 0, 0, 0, 264, 619, 951, 0, 0, 0, 0, 208,
+  699, 0, 354, 0, 270, 652, 749, 0, 0, 67, 0, 390, 855, 465, 0, 520,
+  934, 0, 0, 0, 348, 693, 0, 0, 480, 0, 0, 72, 263, 836, 842, 0,
+  0, 273, 29, 0, 0, 161, 310, 0, 0, 134, 194, 402, 953, 579, 322, 882,
+  0, 0, 0, 706, 87, 886, 991, 0, 585, 344, 879, 963, 0, 867, 0, 607,
+  719, 0, 0, 0, 0, 0, 0, 0, 5, 117, 680, 0, 0, 0, 0, 802,
+  0, 665, 0, 162, 0, 0, 0, 0, 0, 0, 0, 1000, 243, 281, 586, 0,
+  494, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 196, 506, 524,
+  791, 793, 935, 359, 96, 450, 976, 0, 0, 0, 0, 0, 0, 569, 0, 511,
+  65, 0, 0, 0, 533, 248, 0, 0, 0, 536, 701, 0, 0, 937, 175, 90,
+  0, 631, 0, 0, 0, 0, 0, 0, 0, 679, 788, 789, 711, 956, 453, 565,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 475, 401, 671, 0, 915, 0, 0,
+  0, 483, 56, 277, 752, 921, 936, 997, 155, 0, 0, 234, 74, 193, 0, 0,
+  0, 0, 81, 0, 949, 560, 725, 0, 0, 179, 30, 634, 0, 811, 869, 0,
+  0, 0, 297, 0, 0, 895, 885, 973, 771, 843, 0, 0, 603, 0, 823, 643,
+  0, 0, 385, 0, 0, 0, 0, 0, 0, 0, 370, 311, 492, 753, 804, 0,
+  0, 740, 0, 618, 350, 648, 722, 741, 249, 614, 0, 0, 0, 0, 91, 0,
+  0, 0, 0, 0, 498, 131, 448, 896, 0, 0, 0, 54, 736, 0, 0, 0,
+  53, 0, 0, 0, 0, 282, 778, 911, 0, 787, 0, 361, 587, 646, 381, 782,
+  525, 0, 0, 957, 232, 14, 49, 0, 0, 0, 336, 0, 0, 180, 380, 909,
+  236, 0, 0, 761, 0, 0, 0, 98, 275, 801, 773, 57, 703, 827, 972, 0,
+  13, 550, 0, 109, 0, 0, 167, 488, 799, 834, 0, 341, 364, 556, 926, 597,
+  7, 718, 164, 0, 219, 822, 0, 235, 853, 0, 0, 316, 0, 557, 0, 0,
+  461, 0, 0, 477, 197, 471, 204, 485, 529, 317, 589, 0, 691, 0, 0, 0,
+  914, 0, 0, 119, 0, 0, 0, 0, 0, 837, 0, 435, 876, 0, 3, 640,
+  291, 0, 238, 0, 215, 410, 0, 0, 0, 0, 0, 990, 214, 996, 114, 744,
+  292, 399, 583, 255, 670, 907, 0, 0, 0, 0, 0, 825, 366, 655, 968, 0,
+  0, 143, 0, 0, 19, 0, 0, 0, 0, 0, 0, 948, 0, 365, 697, 77,
+  0, 0, 0, 165, 145, 326, 9, 0, 0, 0, 0, 0, 0, 0, 0, 658,
+  0, 0, 68, 595, 319, 0, 221, 0, 0, 0, 777, 0, 0, 31, 0, 0,
+  375, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 216, 0, 0, 959, 682,
+  971, 0, 0, 0, 0, 558, 568, 0, 0, 513, 0, 526, 0, 0, 878, 0,
+  512, 160, 0, 0, 0, 624, 0, 172, 541, 747, 15, 0, 0, 540, 454, 0,
+  141, 84, 510, 629, 0, 887, 0, 0, 0, 894, 942, 129, 0, 369, 0, 0,
+  127, 0, 0, 987, 307, 151, 272, 367, 813, 818, 0, 280, 897, 628, 0, 0,
+  0, 0, 0, 0, 0, 102, 0, 0, 0, 36, 707, 85, 800, 0, 247, 431,
+  0, 0, 0, 730, 0, 859, 594, 0, 0, 0, 0, 174, 0, 0, 0, 0,
+  0, 169, 457, 136, 0, 0, 0, 781, 0, 0, 148, 393, 0, 0, 0, 539,
+  979, 552, 156, 265, 0, 0, 0, 231, 470, 786, 873, 0, 0, 0, 0, 0,
+  0, 462, 0, 0, 278, 922, 0, 0, 0, 0, 223, 0, 0, 189, 339, 0,
+  0, 871, 0, 0, 107, 562, 0, 0, 0, 0, 0, 0, 708, 0, 0, 0,
+  45, 815, 0, 0, 59, 101, 183, 0, 4, 0, 313, 0, 0, 0, 335, 0,
+  0, 0, 0, 0, 157, 138, 675, 726, 917, 0, 294, 0, 286, 0, 26, 599,
+  927, 638, 931, 0, 763, 0, 0, 0, 574, 0, 0, 132, 0, 0, 257, 609,
+  116, 669, 709, 824, 0, 0, 135, 664, 200, 440, 0, 0, 775, 0, 630, 0,
+  0, 728, 584, 0, 0, 839, 0, 635, 0, 0, 0, 35, 684, 0, 0, 0,
+  0, 0, 0, 902, 0, 258, 463, 535, 39, 0, 0, 0, 285, 0, 0, 734,
+  417, 0, 0, 733, 0, 113, 580, 995, 998, 0, 186, 2, 593, 766, 0, 0,
+  681, 37, 323, 833, 938, 967, 0, 0, 0, 0, 0, 604, 0, 0, 870, 715,
+  0, 960, 0, 62, 713, 0, 0, 765, 0, 572, 111, 0, 947, 795, 0, 548,
+  205, 608, 0, 700, 0, 94, 892, 237, 287, 0, 0, 44, 482, 898, 945, 0,
+  0, 242, 245, 230, 695, 819, 0, 0, 47, 261, 378, 300, 108, 421, 199, 360,
+  546, 662, 0, 0, 0, 0, 965, 0, 0, 903, 0, 0, 0, 142, 0, 103,
+  0, 0, 0, 295, 0, 0, 334, 578, 780, 0, 0, 0, 840, 835, 0, 0,
+  0, 0, 130, 0, 0, 768, 0, 338, 0, 227, 403, 433, 21, 537, 692, 0,
+  438, 503, 649, 783, 547, 874, 875, 0, 0, 0, 0, 0, 0, 596, 0, 807,
+  986, 386, 0, 414, 83, 627, 0, 345, 509, 760, 877, 0, 0, 633, 358, 418,
+  340, 212, 253, 181, 571, 611, 982, 0, 198, 666, 25, 58, 428, 437, 201, 904,
+  80, 958, 0, 0, 0, 913, 939, 50, 298, 413, 678, 588, 831, 0, 395, 0,
+  946, 0, 144, 289, 0, 0, 532, 259, 555, 0, 0, 0, 0, 0, 288, 0,
+  0, 382, 794, 0, 0, 814, 0, 0, 0, 767, 0, 0, 302, 0, 0, 118,
+  0, 0, 489, 622, 0, 553, 694, 746, 925, 0, 137, 0, 52, 405, 737, 0,
+  0, 507, 346, 954, 0, 333, 0, 0, 251, 817, 841, 0, 202, 0, 0, 0,
+  0, 0, 0, 325, 616, 0, 0, 0, 0, 0, 0, 351, 0, 0, 0, 776,
+  851, 0, 651, 0, 38, 0, 891, 153, 0, 0, 0, 16, 0, 293, 445, 468,
+  929, 0, 0, 0, 742, 0, 0, 0, 0, 0, 0, 0, 0, 0, 487, 0,
+  0, 0, 0, 0, 0, 0, 769, 0, 0, 0, 0, 657, 353, 912, 0, 0,
+  0, 724, 745, 750, 0, 207, 888, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  6, 0, 559, 0, 0, 0, 363, 0, 0, 0, 444, 0, 0, 0, 452, 383,
+  0, 18, 0, 0, 0, 626, 0, 0, 0, 0, 0, 0, 86, 347, 0, 0,
+  441, 0, 502, 0, 0, 0, 0, 900, 0, 266, 66, 0, 0, 449, 0, 276,
+  140, 301, 419, 610, 0, 0, 0, 0, 0, 721, 739, 60, 661, 0, 0, 977,
+  0, 0, 0, 0, 893, 306, 847, 806, 0, 0, 672, 0, 0, 0, 0, 0,
+  0, 0, 496, 674, 330, 785, 0, 0, 271, 576, 985, 0, 125, 217, 220, 623,
+  978, 0, 0, 0, 758, 0, 262, 755, 0, 0, 0, 0, 0, 422, 591, 928,
+  688, 0, 434, 933, 0, 0, 910, 0, 320, 0, 0, 222, 154, 0, 0, 439,
+  0, 759, 952, 0, 0, 883, 641, 0, 0, 93, 0, 542, 0, 0, 362, 549,
+  0, 250, 0, 0, 632, 0, 0, 779, 567, 564, 329, 429, 974, 99, 0, 0,
+  0, 0, 246, 176, 284, 430, 0, 0, 0, 0, 613, 0, 0, 64, 187, 425,
+  570, 0, 544, 961, 573, 0, 0, 0, 0, 331, 0, 0, 0, 0, 852, 0,
+  0, 0, 0, 400, 654, 0, 0, 48, 268, 0, 152, 75, 0, 0, 0, 126,
+  850, 712, 0, 252, 337, 663, 849, 0, 0, 0, 304, 764, 832, 534, 650, 606,
+  374, 491, 82, 519, 820, 0, 0, 0, 0, 0, 0, 0, 0, 517, 518, 0,
+  0, 527, 916, 617, 863, 924, 0, 106, 716, 0, 0, 0, 110, 0, 0, 456,
+  0, 0, 0, 20, 0, 71, 0, 0, 226, 46, 970, 218, 0, 0, 12, 0,
+  0, 0, 0, 0, 955, 735, 0, 0, 516, 442, 178, 0, 0, 408, 0, 34,
+  0, 0, 147, 621, 0, 636, 0, 0, 962, 0, 0, 195, 677, 0, 0, 332,
+  561, 0, 406, 0, 0, 0, 371, 0, 0, 0, 0, 856, 0, 173, 923, 97,
+  999, 0, 22, 166, 0, 590, 0, 848, 76, 865, 984, 467, 0, 687, 0, 0,
+  0, 981, 0, 0, 689, 0, 0, 501, 0, 146, 0, 0, 0, 51, 349, 696,
+  0, 0, 0, 308, 0, 0, 28, 0, 210, 566, 969, 423, 299, 416, 880, 0,
+  0, 0, 0, 0, 0, 0, 0, 653, 756, 792, 821, 919, 881, 327, 328, 355,
+  790, 0, 0, 0, 0, 171, 858, 0, 0, 469, 738, 63, 254, 0, 493, 601,
+  0, 0, 0, 798, 233, 0, 213, 0, 0, 0, 0, 0, 0, 0, 415, 0,
+  0, 810, 464, 854, 0, 0, 0, 472, 714, 184, 0, 474, 0, 0, 690, 754,
+  0, 0, 0, 0, 88, 0, 0, 808, 0, 0, 857, 0, 409, 0, 0, 0,
+  0, 0, 0, 0, 0, 705, 0, 0, 0, 0, 0, 0, 796, 0, 0, 0,
+  0, 0, 0, 0, 0, 267, 0, 0, 0, 0, 17, 0, 100, 0, 545, 673,
+  318, 309, 0, 0, 0, 0, 11, 0, 0, 0, 0, 989, 459, 993, 0, 0,
+  372, 0, 0, 0, 115, 170, 490, 0, 0, 211, 447, 0, 0, 443, 828, 890,
+  0, 0, 424, 0, 772, 0, 0, 0, 943, 0, 941, 0, 889, 209, 0, 112,
+  0, 391, 906, 0, 455, 538, 727, 123, 642, 0, 751, 24, 838, 124, 0, 343,
+  481, 436, 732, 0, 0, 296, 918, 0, 0, 0, 0, 0, 0, 0, 412, 992,
+  0, 0, 0, 656, 0, 908, 0, 0, 312, 1, 420, 79, 988, 0, 0, 615,
+  0, 0, 0, 812, 0, 0, 0, 0, 260, 0, 0, 41, 120, 256, 844, 0,
+  499, 0, 479, 497, 704, 983, 0, 0, 224, 0, 899, 581, 0, 0, 901, 0,
+  139, 389, 95, 523, 321, 27, 0, 121, 0, 0, 290, 0, 0, 432, 384, 0,
+  0, 0, 0, 0, 43, 241, 994, 0, 0, 522, 514, 0, 0, 0, 0, 0,
+  0, 0, 531, 575, 784, 206, 228, 500, 710, 315, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 377, 61, 73, 407, 478, 0, 600, 89, 397, 645, 676,
+  868, 0, 0, 723, 244, 486, 0, 757, 930, 0, 0, 396, 0, 0, 720, 884,
+  0, 620, 0, 0, 0, 0, 668, 0, 0, 0, 0, 797, 8, 762, 846, 0,
+  0, 0, 0, 368, 23, 225, 0, 0, 303, 105, 0, 0, 809, 356, 683, 0,
+  0, 0, 0, 543, 637, 980, 829, 0, 0, 0, 0, 446, 528, 862, 940, 964,
+  324, 582, 0, 0, 685, 612, 826, 0, 163, 0, 0, 0, 458, 0, 0, 0,
+  0, 0, 0, 0, 743, 159, 0, 0, 0, 78, 0, 0, 0, 239, 0, 342,
+  592, 944, 0, 0, 0, 0, 0, 0, 0, 505, 515, 0, 133, 0, 0, 644,
+};
+
+const char *WA_FREQ_59_TOKENS[] = {
+  "je",
+  "da",
+  "ne",
+  "se",
+  "i",
+  "u",
+  "to",
+  "sam",
+  "što",
+  "na",
+  "ti",
+  "za",
+  "mi",
+  "si",
+  "li",
+  "ja",
+  "su",
+  "ali",
+  "nije",
+  "s",
+  "samo",
+  "ga",
+  "me",
+  "od",
+  "a",
+  "bi",
+  "ovo",
+  "kako",
+  "te",
+  "će",
+  "o",
+  "dobro",
+  "ako",
+  "smo",
+  "sa",
+  "sve",
+  "kao",
+  "ću",
+  "biti",
+  "tako",
+  "znam",
+  "ste",
+  "nisam",
+  "ovdje",
+  "bio",
+  "mogu",
+  "pa",
+  "zašto",
+  "on",
+  "još",
+  "redu",
+  "bilo",
+  "nešto",
+  "kad",
+  "koji",
+  "vas",
+  "mislim",
+  "hvala",
+  "iz",
+  "ili",
+  "možda",
+  "ih",
+  "gdje",
+  "ima",
+  "vam",
+  "više",
+  "znaš",
+  "rekao",
+  "sada",
+  "moj",
+  "onda",
+  "bih",
+  "tko",
+  "mu",
+  "ćemo",
+  "do",
+  "nema",
+  "bila",
+  "ništa",
+  "zar",
+  "nas",
+  "ona",
+  "želim",
+  "malo",
+  "mene",
+  "može",
+  "vi",
+  "molim",
+  "kada",
+  "reći",
+  "šta",
+  "jer",
+  "prije",
+  "tebe",
+  "hej",
+  "imam",
+  "možeš",
+  "sad",
+  "tu",
+  "ćeš",
+  "zbog",
+  "ni",
+  "nam",
+  "tamo",
+  "jesi",
+  "ljudi",
+  "nisi",
+  "svi",
+  "moram",
+  "uvijek",
+  "treba",
+  "stvarno",
+  "hajde",
+  "po",
+  "jedan",
+  "koliko",
+  "već",
+  "idemo",
+  "misliš",
+  "zato",
+  "baš",
+  "nego",
+  "neće",
+  "bez",
+  "oh",
+  "stvari",
+  "vrijeme",
+  "moja",
+  "možemo",
+  "dok",
+  "koje",
+  "ono",
+  "joj",
+  "oni",
+  "želiš",
+  "toga",
+  "ovaj",
+  "žao",
+  "imaš",
+  "taj",
+  "naravno",
+  "tome",
+  "mogao",
+  "posao",
+  "gospodine",
+  "moramo",
+  "koja",
+  "znači",
+  "imamo",
+  "dana",
+  "moje",
+  "nikad",
+  "tvoj",
+  "dan",
+  "bili",
+  "rekla",
+  "put",
+  "radi",
+  "godina",
+  "bolje",
+  "svoje",
+  "moraš",
+  "daj",
+  "nemoj",
+  "bože",
+  "puno",
+  "neću",
+  "netko",
+  "ok",
+  "meni",
+  "možete",
+  "kod",
+  "reci",
+  "mislio",
+  "vidjeti",
+  "jeste",
+  "mama",
+  "izgleda",
+  "znate",
+  "dobar",
+  "dva",
+  "mora",
+  "njega",
+  "imao",
+  "stvar",
+  "nisu",
+  "život",
+  "im",
+  "tata",
+  "vremena",
+  "radiš",
+  "vidio",
+  "volim",
+  "jako",
+  "pomoći",
+  "ići",
+  "vidim",
+  "kući",
+  "nikada",
+  "danas",
+  "zna",
+  "trebao",
+  "dogodilo",
+  "neka",
+  "hoćeš",
+  "opet",
+  "vrlo",
+  "upravo",
+  "svoj",
+  "učiniti",
+  "nakon",
+  "odmah",
+  "ime",
+  "sigurno",
+  "svoju",
+  "tri",
+  "idem",
+  "želi",
+  "g",
+  "evo",
+  "nitko",
+  "jesam",
+  "čovjek",
+  "mnogo",
+  "čemu",
+  "tim",
+  "koju",
+  "tvoja",
+  "bit",
+  "zdravo",
+  "oko",
+  "no",
+  "tobom",
+  "ćete",
+  "neki",
+  "čak",
+  "kaže",
+  "znao",
+  "nismo",
+  "toliko",
+  "ide",
+  "žena",
+  "bok",
+  "mnom",
+  "htio",
+  "prema",
+  "postoji",
+  "ta",
+  "mjesto",
+  "bude",
+  "god",
+  "čekaj",
+  "kažem",
+  "novac",
+  "dovoljno",
+  "imate",
+  "vidi",
+  "nemam",
+  "drugi",
+  "tvoje",
+  "ju",
+  "jednom",
+  "prvi",
+  "način",
+  "otac",
+  "došao",
+  "doći",
+  "znati",
+  "oprosti",
+  "tebi",
+  "idi",
+  "njih",
+  "lijepo",
+  "ove",
+  "dakle",
+  "vrata",
+  "godine",
+  "želite",
+  "vidimo",
+  "puta",
+  "događa",
+  "sranje",
+  "sebe",
+  "vaš",
+  "razgovarati",
+  "čini",
+  "naći",
+  "nekoliko",
+  "pravu",
+  "dušo",
+  "dalje",
+  "dobra",
+  "zajedno",
+  "drago",
+  "problem",
+  "previše",
+  "imati",
+  "trebam",
+  "kroz",
+  "siguran",
+  "poput",
+  "sutra",
+  "vratiti",
+  "ma",
+  "zapravo",
+  "dobiti",
+  "ovamo",
+  "dođi",
+  "jedna",
+  "mogla",
+  "dugo",
+  "otići",
+  "pravo",
+  "gore",
+  "točno",
+  "svaki",
+  "pod",
+  "vidiš",
+  "vama",
+  "osim",
+  "radim",
+  "oprostite",
+  "naš",
+  "ubio",
+  "njim",
+  "dosta",
+  "raditi",
+  "ova",
+  "slušaj",
+  "noć",
+  "mogli",
+  "ubiti",
+  "neke",
+  "čovječe",
+  "niste",
+  "teško",
+  "čuo",
+  "trebali",
+  "dobio",
+  "ovde",
+  "pogledaj",
+  "učinio",
+  "odavde",
+  "koga",
+  "hoću",
+  "brzo",
+  "moju",
+  "protiv",
+  "nećeš",
+  "loše",
+  "super",
+  "dijete",
+  "g.",
+  "mislila",
+  "znamo",
+  "večeras",
+  "vjerojatno",
+  "par",
+  "unutra",
+  "pomoć",
+  "sviđa",
+  "nama",
+  "mislite",
+  "dio",
+  "nadam",
+  "tom",
+  "jednu",
+  "isto",
+  "dvije",
+  "auto",
+  "istina",
+  "ovu",
+  "neko",
+  "uh",
+  "imala",
+  "napraviti",
+  "mali",
+  "imaju",
+  "njegov",
+  "ljude",
+  "dolje",
+  "kažeš",
+  "minuta",
+  "trebalo",
+  "ovako",
+  "bismo",
+  "ko",
+  "prvo",
+  "rekli",
+  "mog",
+  "uz",
+  "tip",
+  "vaše",
+  "imali",
+  "sto",
+  "preko",
+  "van",
+  "ovom",
+  "naše",
+  "trebala",
+  "ovog",
+  "vjerujem",
+  "otišao",
+  "jedno",
+  "kuće",
+  "dati",
+  "misli",
+  "pravi",
+  "dolazi",
+  "zove",
+  "mrtav",
+  "morate",
+  "broj",
+  "majka",
+  "prijatelj",
+  "htjela",
+  "one",
+  "dao",
+  "radio",
+  "ruke",
+  "kasnije",
+  "vjerovati",
+  "vidjela",
+  "natrag",
+  "pet",
+  "jednostavno",
+  "razumijem",
+  "pusti",
+  "ostati",
+  "veliki",
+  "jednog",
+  "novi",
+  "obitelj",
+  "tog",
+  "nekoga",
+  "kakav",
+  "gotovo",
+  "onaj",
+  "svojim",
+  "veze",
+  "govori",
+  "poslije",
+  "iza",
+  "nju",
+  "napravio",
+  "posla",
+  "života",
+  "stari",
+  "došli",
+  "budi",
+  "l",
+  "važno",
+  "hoće",
+  "ipak",
+  "drugo",
+  "svog",
+  "pitanje",
+  "uopće",
+  "zaista",
+  "njemu",
+  "znala",
+  "cijeli",
+  "ideš",
+  "vaša",
+  "prestani",
+  "trebamo",
+  "osjećam",
+  "njima",
+  "njom",
+  "želio",
+  "sin",
+  "problema",
+  "vezi",
+  "njegova",
+  "sama",
+  "jest",
+  "trebaš",
+  "također",
+  "žene",
+  "sati",
+  "tada",
+  "trenutak",
+  "jutro",
+  "bog",
+  "čovjeka",
+  "vidjeli",
+  "vrati",
+  "tvoju",
+  "valjda",
+  "između",
+  "biste",
+  "dolara",
+  "priča",
+  "briga",
+  "volio",
+  "pronaći",
+  "uzeti",
+  "slučaj",
+  "stani",
+  "najbolje",
+  "morao",
+  "bar",
+  "uskoro",
+  "uzmi",
+  "gledaj",
+  "ha",
+  "spreman",
+  "ozbiljno",
+  "voli",
+  "jasno",
+  "oca",
+  "noći",
+  "svijet",
+  "srce",
+  "riječ",
+  "sebi",
+  "drži",
+  "sat",
+  "kuću",
+  "čudno",
+  "prijatelji",
+  "gde",
+  "ovim",
+  "jedini",
+  "sigurna",
+  "došla",
+  "osoba",
+  "ovoga",
+  "zvuči",
+  "sjajno",
+  "dr",
+  "potpuno",
+  "ce",
+  "mom",
+  "moći",
+  "žele",
+  "čega",
+  "odlično",
+  "druge",
+  "veoma",
+  "prilično",
+  "grad",
+  "našao",
+  "tek",
+  "naša",
+  "budem",
+  "ženu",
+  "životu",
+  "sretan",
+  "nemaš",
+  "halo",
+  "oči",
+  "glavu",
+  "kojeg",
+  "nećemo",
+  "nekog",
+  "ikada",
+  "stalno",
+  "slučaju",
+  "lako",
+  "dečki",
+  "strane",
+  "četiri",
+  "svijetu",
+  "vidite",
+  "sata",
+  "velika",
+  "ideja",
+  "najbolji",
+  "pred",
+  "dvoje",
+  "ljudima",
+  "obitelji",
+  "skoro",
+  "ljubav",
+  "blizu",
+  "nemojte",
+  "svih",
+  "e",
+  "nemamo",
+  "jesu",
+  "kraj",
+  "vani",
+  "oružje",
+  "momci",
+  "negdje",
+  "smrti",
+  "ponekad",
+  "brat",
+  "plan",
+  "ruku",
+  "ponovno",
+  "pola",
+  "dečko",
+  "vratio",
+  "brod",
+  "pretpostavljam",
+  "moguće",
+  "policija",
+  "k",
+  "moglo",
+  "kamo",
+  "znaju",
+  "rade",
+  "prava",
+  "svom",
+  "djevojka",
+  "pojma",
+  "radite",
+  "brini",
+  "razlog",
+  "mjesta",
+  "sinoć",
+  "pištolj",
+  "niti",
+  "tijelo",
+  "kažu",
+  "daleko",
+  "lice",
+  "tjedan",
+  "mala",
+  "smrt",
+  "našli",
+  "kakva",
+  "ovoj",
+  "pitanja",
+  "radimo",
+  "živi",
+  "sjećam",
+  "mojoj",
+  "moji",
+  "draga",
+  "dovraga",
+  "sjećaš",
+  "mjestu",
+  "manje",
+  "barem",
+  "sina",
+  "umrijeti",
+  "novca",
+  "svega",
+  "gospođo",
+  "jack",
+  "pazi",
+  "cu",
+  "sobu",
+  "ikad",
+  "pitati",
+  "dr.",
+  "šest",
+  "svima",
+  "budeš",
+  "istinu",
+  "ponovo",
+  "kraju",
+  "polako",
+  "nje",
+  "djecu",
+  "prijatelja",
+  "oboje",
+  "izgledaš",
+  "čujem",
+  "djeca",
+  "bojim",
+  "voliš",
+  "pitam",
+  "pogledajte",
+  "spremni",
+  "želimo",
+  "umro",
+  "sobi",
+  "gospodo",
+  "govoriš",
+  "čula",
+  "ranije",
+  "izgubio",
+  "dobili",
+  "šanse",
+  "čim",
+  "govorim",
+  "recite",
+  "tvog",
+  "odakle",
+  "čuti",
+  "vodi",
+  "iako",
+  "laku",
+  "uzeo",
+  "prijatelju",
+  "new",
+  "ispod",
+  "dajte",
+  "hoćete",
+  "njoj",
+  "mojim",
+  "nekako",
+  "njegove",
+  "otišla",
+  "riječi",
+  "pokušao",
+  "gledati",
+  "morati",
+  "isuse",
+  "vode",
+  "krv",
+  "poruku",
+  "aha",
+  "smiješno",
+  "dođe",
+  "ah",
+  "dragi",
+  "gradu",
+  "doma",
+  "piće",
+  "ujutro",
+  "morat",
+  "zbilja",
+  "živjeti",
+  "pokušavam",
+  "bile",
+  "sestra",
+  "zanima",
+  "pričati",
+  "drugog",
+  "sami",
+  "ostani",
+  "ostaviti",
+  "putu",
+  "jedino",
+  "gđo",
+  "mrzim",
+  "rat",
+  "potrebno",
+  "poziv",
+  "znali",
+  "ubojstvo",
+  "očito",
+  "ostavio",
+  "pitao",
+  "svojoj",
+  "ubojica",
+  "telefon",
+  "tražim",
+  "ovome",
+  "mjeseci",
+  "takav",
+  "dogoditi",
+  "kuća",
+  "nikoga",
+  "sigurni",
+  "pričaš",
+  "isti",
+  "zadnji",
+  "deset",
+  "ispred",
+  "boli",
+  "uredu",
+  "sastanak",
+  "ondje",
+  "nekim",
+  "razloga",
+  "naprijed",
+  "postoje",
+  "jedina",
+  "vašu",
+  "njegovo",
+  "time",
+  "cijelu",
+  "krvi",
+  "san",
+  "uradio",
+  "govoriti",
+  "priliku",
+  "kakve",
+  "shvaćam",
+  "pre",
+  "svim",
+  "neku",
+  "ljubavi",
+  "jel",
+  "njegovu",
+  "zaboravi",
+  "tih",
+  "sva",
+  "zemlji",
+  "uvek",
+  "poslu",
+  "našu",
+  "doista",
+  "večer",
+  "čuli",
+  "zvao",
+  "poslao",
+  "prva",
+  "zemlju",
+  "lijepa",
+  "tražio",
+  "dame",
+  "jutros",
+  "muž",
+  "igra",
+  "zovem",
+  "nazvati",
+  "ovih",
+  "drugu",
+  "miru",
+  "čeka",
+  "stan",
+  "shvatio",
+  "traži",
+  "izaći",
+  "ostali",
+  "živ",
+  "vijesti",
+  "osjećaj",
+  "tjedna",
+  "pustiti",
+  "jučer",
+  "kriv",
+  "čekati",
+  "odgovor",
+  "inače",
+  "kapetane",
+  "dobre",
+  "pokazati",
+  "odvesti",
+  "jesmo",
+  "film",
+  "tipa",
+  "ovi",
+  "druga",
+  "priču",
+  "jedva",
+  "gđice",
+  "trebate",
+  "smiri",
+  "voljela",
+  "među",
+  "sljedeći",
+  "mjesec",
+  "desilo",
+  "john",
+  "onog",
+  "počeo",
+  "jebeni",
+  "sta",
+  "večeru",
+  "našeg",
+  "razumiješ",
+  "obično",
+  "sine",
+  "mrtva",
+  "gt",
+  "brata",
+  "krevet",
+  "zatim",
+  "vrsta",
+  "piše",
+  "koristi",
+  "ostavi",
+  "dolaze",
+  "lud",
+  "kojoj",
+  "kojem",
+  "spremna",
+  "djevojke",
+  "dali",
+  "svakako",
+  "toj",
+  "tvom",
+  "gle",
+  "grada",
+  "ući",
+  "umjesto",
+  "vašeg",
+  "pored",
+  "nećete",
+  "smisla",
+  "djece",
+  "svijeta",
+  "ostalo",
+  "vreme",
+  "kraja",
+  "otvori",
+  "čuješ",
+  "dala",
+  "uraditi",
+  "razgovor",
+  "zaustaviti",
+  "dobri",
+  "moraju",
+  "boga",
+  "frank",
+  "misle",
+  "zemlje",
+  "godinu",
+  "učinila",
+  "video",
+  "učini",
+  "trebaju",
+  "prestati",
+  "jebeno",
+  "kim",
+  "savršeno",
+  "smijem",
+  "zaboravio",
+  "bolji",
+  "njen",
+  "nova",
+  "drugom",
+  "htjeli",
+  "završiti",
+  "red",
+  "kažete",
+  "brže",
+  "um",
+  "dobila",
+  "mjeseca",
+  "noge",
+  "strani",
+  "nastavi",
+  "momak",
+  "početi",
+  "divno",
+  "dom",
+  "igrati",
+  "strašno",
+  "zabavno",
+  "eto",
+  "spasiti",
+  "prošlo",
+  "leđa",
+  "ured",
+  "iskreno",
+  "doktore",
+  "školu",
+  "hoćemo",
+  "the",
+  "često",
+  "osobno",
+  "roditelji",
+  "gospodin",
+  "izvan",
+  "mike",
+  "vidjet",
+  "zbogom",
+  "vjeruj",
+  "charlie",
+  "riješiti",
+  "odlazi",
+  "platiti",
+  "zauvijek",
+  "željela",
+  "posebno",
+  "ubojstva",
+  "poznajem",
+  "sretno",
+  "michael",
+  "ispričavam",
+  "staviti",
+  "uspio",
+  "saznati",
+  "kćer",
+  "glavni",
+  "pronašli",
+  "otišli",
+  "nevjerojatno",
+  "tvojim",
+  "sobom",
+  "čekajte",
+  "oče",
+  "prošli",
+  "morala",
+  "nove",
+  "pravila",
+  "kome",
+  "zatvoru",
+  "velike",
+  "učinili",
+  "dopustiti",
+  "mislili",
+  "policiju",
+  "nazad",
+  "jebi",
+  "postao",
+  "shvatiti",
+  "svakom",
+  "slušajte",
+  "napravila",
+  "brinuti",
+  "godinama",
+  "zatvor",
+  "sreće",
+  "stara",
+  "držati",
+  "pronašao",
+  "radili",
+  "promijeniti",
+  "kurac",
+  "napad",
+};
+const uint16_t WA_FREQ_59_RANKS[] = {
+  0, 550, 267, 65, 0, 206, 954, 0, 0, 0, 0, 712, 0, 831, 0, 0,
+  0, 0, 378, 0, 123, 286, 0, 94, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 364, 0, 118, 0, 406, 0, 0, 0, 0, 0, 0, 0, 0, 0, 701,
+  68, 764, 483, 194, 0, 276, 0, 903, 0, 0, 0, 254, 723, 0, 0, 682,
+  980, 0, 646, 0, 0, 313, 857, 0, 633, 0, 0, 131, 0, 188, 0, 0,
+  0, 0, 876, 0, 777, 117, 737, 575, 853, 875, 0, 0, 482, 229, 931, 337,
+  0, 0, 621, 942, 355, 0, 0, 463, 0, 0, 0, 56, 0, 818, 0, 0,
+  0, 0, 0, 0, 0, 0, 663, 0, 0, 0, 909, 0, 0, 0, 0, 417,
+  484, 0, 0, 0, 0, 239, 66, 74, 526, 173, 930, 496, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 119, 0, 341, 368, 854, 0, 0, 0, 167, 597,
+  0, 0, 0, 55, 0, 0, 0, 0, 0, 0, 787, 0, 275, 731, 0, 0,
+  0, 0, 835, 0, 0, 573, 0, 0, 0, 939, 613, 122, 71, 0, 93, 0,
+  0, 0, 0, 0, 0, 0, 733, 437, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 634, 0, 662, 0, 0, 842, 0, 569, 789, 391, 898, 755, 751, 0,
+  159, 0, 0, 108, 133, 0, 0, 294, 0, 0, 0, 0, 176, 244, 306, 718,
+  774, 0, 659, 78, 0, 0, 0, 0, 834, 143, 0, 197, 0, 592, 415, 887,
+  995, 29, 715, 9, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 899, 0, 0, 132, 736, 828, 971, 0, 0, 837, 0, 0, 0,
+  543, 568, 27, 0, 0, 0, 0, 0, 0, 0, 0, 0, 334, 0, 0, 0,
+  0, 265, 0, 17, 611, 155, 124, 547, 934, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 255, 0, 0, 426, 134, 700, 886, 982, 0, 0, 0, 0, 0, 0,
+  0, 36, 73, 862, 978, 767, 582, 0, 562, 0, 664, 153, 163, 726, 99, 354,
+  811, 914, 919, 0, 0, 0, 0, 0, 287, 820, 0, 0, 422, 300, 0, 28,
+  53, 0, 0, 0, 0, 0, 0, 120, 0, 0, 412, 880, 0, 766, 362, 0,
+  0, 670, 509, 425, 0, 0, 397, 0, 207, 283, 656, 0, 850, 0, 0, 380,
+  50, 0, 63, 0, 0, 180, 212, 567, 628, 466, 970, 589, 59, 928, 0, 0,
+  815, 979, 0, 23, 0, 0, 0, 622, 166, 0, 649, 675, 0, 584, 42, 949,
+  89, 0, 0, 25, 187, 0, 0, 581, 0, 528, 695, 75, 12, 0, 331, 874,
+  877, 974, 574, 863, 0, 0, 0, 471, 843, 676, 688, 519, 959, 0, 0, 0,
+  0, 72, 796, 0, 109, 910, 0, 0, 0, 0, 936, 0, 0, 552, 0, 926,
+  0, 179, 0, 0, 0, 0, 0, 0, 90, 0, 0, 0, 317, 975, 0, 0,
+  0, 0, 0, 0, 0, 0, 47, 511, 814, 264, 172, 33, 82, 529, 591, 822,
+  844, 402, 938, 580, 539, 430, 780, 556, 894, 522, 0, 0, 0, 0, 405, 0,
+  0, 174, 0, 636, 0, 0, 687, 0, 0, 481, 227, 16, 170, 0, 0, 0,
+  330, 558, 937, 0, 515, 0, 111, 577, 759, 0, 136, 246, 800, 444, 906, 967,
+  0, 342, 323, 0, 301, 0, 0, 0, 0, 0, 0, 432, 455, 52, 532, 520,
+  0, 361, 0, 403, 0, 0, 0, 0, 596, 679, 390, 0, 0, 0, 517, 18,
+  416, 0, 449, 0, 0, 0, 0, 0, 0, 992, 0, 0, 0, 849, 0, 0,
+  797, 609, 0, 0, 657, 0, 447, 912, 0, 0, 760, 0, 169, 536, 0, 0,
+  0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 951, 486, 902, 0, 0,
+  349, 0, 339, 423, 614, 735, 802, 0, 0, 0, 932, 765, 0, 771, 0, 260,
+  38, 129, 377, 19, 651, 673, 694, 826, 214, 329, 148, 488, 220, 576, 824, 371,
+  732, 994, 602, 606, 10, 873, 0, 0, 0, 713, 0, 0, 11, 0, 0, 0,
+  305, 81, 0, 195, 0, 407, 0, 778, 825, 890, 0, 571, 465, 0, 0, 0,
+  0, 414, 421, 0, 0, 0, 752, 0, 0, 0, 24, 0, 0, 724, 748, 97,
+  251, 985, 0, 92, 435, 883, 0, 0, 0, 328, 781, 0, 616, 0, 685, 913,
+  203, 0, 196, 0, 0, 0, 88, 442, 448, 0, 0, 43, 274, 0, 0, 892,
+  0, 0, 0, 0, 0, 545, 0, 0, 436, 0, 242, 200, 0, 0, 0, 900,
+  0, 0, 0, 399, 458, 0, 0, 554, 866, 0, 830, 168, 0, 467, 0, 358,
+  0, 0, 385, 0, 858, 819, 498, 0, 450, 891, 0, 0, 0, 0, 0, 0,
+  0, 31, 0, 0, 340, 0, 222, 0, 503, 0, 0, 314, 0, 0, 485, 318,
+  0, 0, 0, 0, 0, 478, 0, 0, 452, 946, 0, 0, 0, 0, 0, 0,
+  798, 234, 601, 0, 0, 462, 788, 816, 0, 0, 888, 907, 87, 139, 181, 998,
+  497, 0, 650, 804, 0, 0, 0, 0, 0, 178, 45, 968, 0, 0, 0, 0,
+  0, 0, 125, 0, 0, 0, 1, 284, 370, 472, 593, 671, 719, 595, 5, 725,
+  920, 652, 921, 953, 0, 105, 199, 961, 0, 0, 807, 0, 398, 0, 446, 0,
+  101, 282, 565, 641, 721, 895, 783, 0, 396, 846, 0, 0, 0, 0, 83, 720,
+  126, 0, 0, 0, 0, 0, 0, 0, 516, 0, 0, 0, 0, 0, 0, 221,
+  0, 0, 0, 363, 0, 0, 629, 0, 0, 479, 332, 270, 217, 530, 927, 433,
+  253, 440, 745, 708, 418, 0, 0, 0, 0, 0, 0, 0, 559, 918, 0, 0,
+  0, 0, 266, 0, 0, 0, 607, 856, 0, 428, 761, 0, 0, 475, 0, 0,
+  0, 929, 756, 0, 0, 0, 327, 660, 0, 198, 810, 823, 0, 0, 0, 0,
+  0, 0, 248, 623, 668, 0, 0, 0, 211, 0, 0, 861, 0, 26, 0, 365,
+  923, 0, 0, 0, 564, 0, 0, 0, 0, 0, 0, 258, 0, 0, 291, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 693, 360, 0, 0, 0, 312, 794, 0,
+  502, 610, 0, 0, 947, 0, 0, 0, 586, 924, 20, 357, 0, 0, 302, 901,
+  683, 0, 619, 0, 0, 533, 518, 64, 916, 216, 917, 250, 147, 640, 0, 0,
+  855, 0, 0, 0, 236, 0, 3, 0, 0, 560, 790, 15, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 95, 896, 635, 145, 0, 0, 0, 347, 0, 0, 0,
+  473, 836, 997, 249, 801, 0, 0, 0, 190, 775, 142, 367, 840, 845, 956, 0,
+  0, 0, 0, 948, 14, 279, 0, 182, 0, 80, 0, 0, 0, 0, 0, 366,
+  716, 0, 0, 0, 453, 865, 0, 40, 183, 476, 67, 0, 500, 563, 0, 535,
+  710, 510, 0, 0, 0, 848, 0, 757, 292, 175, 70, 570, 661, 746, 957, 0,
+  0, 0, 208, 0, 0, 144, 638, 0, 0, 960, 0, 152, 495, 98, 0, 0,
+  0, 110, 0, 0, 0, 0, 0, 0, 505, 0, 0, 57, 499, 408, 987, 566,
+  0, 0, 0, 991, 0, 0, 0, 218, 717, 303, 381, 0, 981, 925, 0, 245,
+  112, 750, 0, 0, 0, 983, 0, 0, 0, 146, 0, 0, 594, 338, 0, 0,
+  0, 0, 0, 320, 618, 189, 469, 0, 0, 869, 140, 0, 0, 730, 852, 0,
+  0, 489, 631, 512, 648, 0, 0, 0, 0, 0, 996, 639, 0, 557, 0, 30,
+  0, 0, 0, 0, 0, 0, 224, 0, 0, 0, 697, 0, 304, 86, 0, 103,
+  193, 268, 908, 786, 632, 0, 817, 356, 885, 281, 690, 727, 0, 0, 375, 0,
+  0, 441, 0, 0, 0, 0, 0, 0, 0, 0, 154, 0, 247, 542, 0, 799,
+  0, 0, 0, 0, 61, 605, 141, 62, 359, 839, 135, 0, 0, 0, 0, 420,
+  0, 0, 0, 191, 0, 171, 0, 0, 243, 0, 0, 149, 881, 0, 922, 527,
+  889, 0, 583, 851, 231, 0, 0, 0, 0, 0, 0, 779, 0, 514, 0, 0,
+  35, 213, 384, 477, 531, 941, 943, 513, 0, 0, 0, 0, 0, 933, 620, 0,
+  0, 0, 630, 233, 311, 0, 278, 940, 0, 0, 137, 315, 457, 0, 0, 0,
+  0, 0, 0, 0, 41, 77, 587, 655, 0, 0, 0, 400, 809, 768, 0, 321,
+  647, 986, 263, 707, 805, 551, 0, 0, 0, 0, 691, 0, 0, 0, 523, 827,
+  0, 741, 549, 0, 238, 492, 0, 0, 0, 309, 0, 280, 162, 0, 0, 627,
+  0, 977, 0, 0, 0, 0, 0, 0, 202, 204, 344, 345, 669, 470, 702, 335,
+  6, 791, 369, 409, 333, 443, 792, 13, 299, 411, 439, 553, 429, 944, 0, 0,
+  0, 0, 504, 0, 0, 572, 0, 678, 955, 114, 308, 223, 0, 0, 0, 288,
+  829, 0, 0, 0, 680, 911, 0, 0, 808, 0, 0, 0, 0, 0, 674, 0,
+  0, 838, 617, 714, 0, 0, 0, 164, 984, 0, 0, 0, 521, 0, 0, 0,
+  157, 608, 645, 952, 0, 322, 494, 269, 508, 0, 0, 0, 763, 372, 0, 0,
+  0, 235, 296, 237, 240, 387, 884, 0, 0, 0, 0, 868, 966, 0, 474, 0,
+  0, 0, 905, 722, 729, 295, 256, 0, 0, 319, 653, 0, 0, 0, 0, 870,
+  969, 0, 210, 0, 0, 672, 0, 209, 0, 965, 525, 0, 487, 546, 0, 460,
+  289, 0, 0, 297, 0, 0, 0, 812, 394, 326, 738, 561, 976, 0, 51, 747,
+  821, 0, 548, 0, 0, 395, 0, 0, 388, 625, 386, 859, 958, 454, 626, 0,
+  0, 0, 743, 860, 0, 0, 0, 39, 0, 703, 0, 0, 0, 0, 4, 8,
+  252, 0, 0, 0, 681, 999, 758, 0, 150, 0, 0, 0, 424, 0, 0, 0,
+  0, 0, 373, 579, 749, 684, 0, 506, 544, 0, 0, 588, 0, 127, 350, 973,
+  0, 116, 0, 0, 0, 271, 524, 740, 734, 0, 0, 464, 0, 0, 0, 0,
+  21, 0, 0, 383, 0, 0, 0, 392, 0, 0, 0, 0, 0, 0, 115, 60,
+  0, 615, 0, 555, 0, 0, 413, 0, 0, 0, 0, 0, 160, 0, 192, 226,
+  293, 962, 0, 0, 151, 964, 0, 0, 0, 46, 0, 336, 990, 0, 709, 0,
+  0, 867, 0, 699, 739, 773, 324, 0, 490, 0, 0, 7, 393, 138, 389, 468,
+  599, 259, 711, 806, 382, 0, 0, 0, 0, 0, 0, 257, 0, 0, 0, 950,
+  0, 0, 0, 325, 0, 0, 0, 0, 507, 0, 0, 0, 0, 0, 84, 537,
+  578, 0, 0, 0, 0, 48, 696, 461, 667, 285, 534, 0, 612, 0, 686, 0,
+  228, 0, 0, 754, 677, 878, 879, 0, 0, 847, 0, 0, 0, 0, 353, 419,
+  972, 0, 0, 541, 897, 0, 0, 0, 186, 102, 0, 298, 431, 49, 272, 54,
+  343, 538, 600, 91, 107, 637, 793, 0, 491, 0, 0, 346, 0, 401, 0, 161,
+  501, 445, 893, 0, 0, 864, 993, 0, 0, 0, 113, 310, 0, 590, 603, 643,
+  706, 351, 704, 0, 742, 0, 0, 352, 0, 316, 379, 459, 177, 451, 988, 0,
+  0, 0, 0, 0, 106, 184, 642, 79, 456, 644, 585, 769, 0, 69, 493, 871,
+  104, 935, 0, 665, 156, 219, 0, 0, 0, 0, 0, 215, 784, 0, 374, 882,
+  0, 32, 776, 0, 0, 0, 0, 0, 0, 782, 0, 0, 2, 185, 277, 540,
+  0, 434, 803, 0, 0, 0, 0, 261, 205, 128, 480, 0, 404, 0, 410, 744,
+  598, 0, 0, 0, 0, 0, 833, 348, 307, 376, 915, 0, 0, 130, 0, 692,
+  813, 832, 0, 0, 0, 0, 0, 624, 0, 0, 0, 0, 0, 658, 0, 0,
+  165, 762, 1000, 0, 0, 100, 945, 772, 770, 0, 44, 705, 753, 604, 0, 0,
+  0, 262, 0, 0, 0, 201, 230, 0, 0, 963, 0, 0, 0, 0, 427, 58,
+  96, 76, 158, 273, 225, 438, 872, 989, 290, 666, 0, 0, 0, 0, 121, 841,
+  0, 698, 241, 0, 0, 0, 0, 0, 785, 728, 0, 654, 0, 0, 34, 0,
+  0, 0, 0, 0, 0, 904, 0, 0, 85, 0, 0, 795, 0, 0, 232, 689,
+};
+
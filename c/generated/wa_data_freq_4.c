@@ -0,0 +1,11605 @@
+#include "worldalphabets_data.h"
+
+const char *WA_FREQ_60_TOKENS[] = {
+  "je",
+  "wobhladujće",
+  "sej",
+  "tute",
+  "fota",
+  "jeje",
+  "swójba",
+  "jara",
+  "wulka",
+  "njejsće",
+  "hłódny",
+  "kóčka",
+  "pod",
+  "blidom",
+  "to",
+  "wažny",
+  "list",
+  "jeli",
+  "sy",
+  "mučna",
+  "dźi",
+  "spać",
+  "smy",
+  "w",
+  "swojim",
+  "ródnym",
+  "kraju",
+  "čehodla",
+  "stojitaj",
+  "tom",
+  "njespaše",
+  "z",
+  "kim",
+  "pućujeće",
+};
+const uint16_t WA_FREQ_60_RANKS[] = {
+  0, 0, 24, 0, 0, 10, 0, 0, 0, 18, 5, 0, 0, 0, 0, 0,
+  0, 0, 0, 4, 0, 0, 20, 0, 0, 0, 0, 19, 32, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 23, 0, 0,
+  0, 0, 0, 9, 0, 0, 0, 33, 0, 0, 0, 0, 0, 0, 0, 14,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 17, 15, 21, 34, 0, 25,
+  22, 0, 0, 0, 12, 16, 0, 0, 2, 11, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 1, 26, 0, 0, 0, 0, 13, 29, 0, 30,
+  0, 0, 0, 0, 28, 0, 0, 6, 27, 7, 0, 0, 0, 0, 31, 0,
+};
+
+const char *WA_FREQ_61_TOKENS[] = {
+  "yon",
+  "nan",
+  "moun",
+  "ki",
+  "genyen",
+  "te",
+  "se",
+  "yo",
+  "li",
+  "Li",
+  "lane",
+  "pou",
+  "2000",
+  "kèk",
+  "a",
+  "Nan",
+  "ak",
+  "l",
+  "la",
+  "sa",
+  "gen",
+  "an",
+  "pa",
+  "konte",
+  "sou",
+  "fè",
+  "popilasyon",
+  "bagay",
+  "ap",
+  "Yon",
+  "tout",
+  "matematisyen",
+  "avèk",
+  "e",
+  "ekriven",
+  "lòt",
+  "de",
+  "peyi",
+  "epi",
+  "Popilasyon",
+  "soti",
+  "kote",
+  "lè",
+  "kapab",
+  "2002",
+  "ou",
+  "ka",
+  "nou",
+  "tankou",
+  "afriken",
+  "anpil",
+  "pi",
+  "dyaspora",
+  "lang",
+  "plant",
+  "fèt",
+  "2004",
+  "rejyon",
+  "tou",
+  "pase",
+  "bay",
+  "travay",
+  "menm",
+  "di",
+  "Lòt",
+  "ke",
+  "2001",
+  "men",
+  "Se",
+  "2003",
+  "oswa",
+  "san",
+  "dwa",
+  "itilize",
+  "rele",
+  "franse",
+  "mete",
+  "gwo",
+  "ti",
+  "pran",
+  "mo",
+  "plis",
+  "tan",
+  "kò",
+  "byen",
+  "vini",
+  "Yo",
+  "Ayiti",
+  "Mo",
+  "jan",
+  "pati",
+  "dlo",
+  "rive",
+  "dwe",
+  "ale",
+  "premye",
+  "konnen",
+  "chak",
+  "si",
+  "jwenn",
+  "kont",
+  "Ayisyen",
+  "ni",
+  "tè",
+  "gwoup",
+  "2",
+  "lan",
+  "oubyen",
+  "a.",
+  "ant",
+  "britanik",
+  "Moun",
+  "apre",
+  "bon",
+  "toujou",
+  "manje",
+  "vle",
+  "ane",
+  "pandan",
+  "vin",
+  "plizyè",
+  "Leta",
+  "laten",
+  "jou",
+  "bèt",
+  "Eta",
+  "ayisyen",
+  "ansanm",
+  "lwa",
+  "pale",
+  "fòme",
+  "kantite",
+  "ekri",
+  "kay",
+  "kreyòl",
+  "viv",
+  "youn",
+  "ta",
+  "anba",
+  "2005",
+  "andedan",
+  "zòn",
+  "rete",
+  "depi",
+  "lachanm",
+  "tèt",
+  "fanmi",
+  "manm",
+  "wè",
+  "Lè",
+  "Non",
+  "Km²",
+  "moso",
+  "Men",
+  "eleksyon",
+  "anvan",
+  "non",
+  "politik",
+  "syantifik",
+  "resevwa",
+  "vil",
+  "lajan",
+  "nenpòt",
+  "fòs",
+  "mande",
+  "kòm",
+  "Sipèfisi",
+  "gason",
+  "fòm",
+  "reprezante",
+  "piti",
+  "bezwen",
+  "nonm",
+  "k",
+  "paske",
+  "senk",
+  "m",
+  "pye",
+  "prezidan",
+  "pèmèt",
+  "w",
+  "Si",
+  "Tout",
+  "lavi",
+  "italyen",
+  "1",
+  "3",
+  "fi",
+  "kiben",
+  "gouvènman",
+  "twa",
+  "Gen",
+  "fwa",
+  "pwosesis",
+  "sistèm",
+  "sèl",
+  "janm",
+  "okenn",
+  "tribinal",
+  "Nou",
+  "Pou",
+  "kat",
+  "pat",
+  "lèt",
+  "rapò",
+  "maladi",
+  "sèvi",
+  "selil",
+  "fe",
+  "Bondye",
+  "fini",
+  "kap",
+  "sèvis",
+  "liv",
+  "sèlman",
+  "kenbe",
+  "mache",
+  "kòmanse",
+  "pitit",
+  "fason",
+  "machin",
+  "devan",
+  "sifas",
+  "ede",
+  "lekòl",
+  "mouri",
+  "vivan",
+  "ba",
+  "mwen",
+  "chimik",
+  "pwodui",
+  "rantre",
+  "ye",
+  "d",
+  "pral",
+  "sibstans",
+  "diferan",
+  "elektoral",
+  "plas",
+  "enèji",
+  "mas",
+  "Sa",
+  "prizon",
+  "renmen",
+  "chanje",
+  "chanjman",
+  "ladan",
+  "kwè",
+  "mwa",
+  "pote",
+  "jwe",
+  "mèt",
+  "senatè",
+  "depatman",
+  "pouvwa",
+  "timoun",
+  "kontinye",
+  "lalwa",
+  "objè",
+  "pèp",
+  "voye",
+  "likid",
+  "sitye",
+  "tap",
+  "Misyon",
+  "konsa",
+  "pozisyon",
+  "depite",
+  "deplase",
+  "direksyon",
+  "mizik",
+  "ameriken",
+  "bouch",
+  "konsèy",
+  "nouvo",
+  "va",
+  "An",
+  "yonn",
+  "òganis",
+  "mouvman",
+  "pwoblèm",
+  "Etazini",
+  "chwazi",
+  "deja",
+  "sosyete",
+  "vòt",
+  "wòch",
+  "latriye",
+  "pwen",
+  "Aksyon",
+  "ankò",
+  "enpòtan",
+  "eta",
+  "minis",
+  "montre",
+  "jis",
+  "kalite",
+  "kreye",
+  "Jean",
+  "Nenpòt",
+  "lot",
+  "4",
+  "biwo",
+  "devlope",
+  "parèt",
+  "gran",
+  "mal",
+  "nasyonal",
+  "touye",
+  "Kiba",
+  "antre",
+  "bwa",
+  "moman",
+  "patisipe",
+  "tonbe",
+  "Etimoloji",
+  "chita",
+  "etidye",
+  "jij",
+  "kite",
+  "panse",
+  "ansyen",
+  "gade",
+  "limyè",
+  "rezilta",
+  "sanble",
+  "sitwayen",
+  "kontwole",
+  "legliz",
+  "Travay",
+  "latè",
+  "n",
+  "enfòmasyon",
+  "5",
+  "Jezi",
+  "fanm",
+  "sant",
+  "solèy",
+  "wout",
+  "chache",
+  "Repiblik",
+  "konn",
+  "leta",
+  "Chèf-lye",
+  "Mete",
+  "al",
+  "prizonye",
+  "ann",
+  "aparèy",
+  "kraze",
+  "long",
+  "manman",
+  "tounen",
+  "fin",
+  "fòk",
+  "teroris",
+  "Anpil",
+  "aksyon",
+  "eleman",
+  "kondisyon",
+  "koulè",
+  "milyon",
+  "piblik",
+  "Bergen",
+  "desizyon",
+  "Apre",
+  "egziste",
+  "okipe",
+  "peryòd",
+  "pyès",
+  "kouch",
+  "laj",
+  "mitan",
+  "dezyèm",
+  "en",
+  "istwa",
+  "pwent",
+  "pèdi",
+  "òdinatè",
+  "aktivite",
+  "alfabèt",
+  "baz",
+  "divize",
+  "kòz",
+  "lakòz",
+  "rezon",
+  "souvan",
+  "fò",
+  "konprann",
+  "vote",
+  "zannimo",
+  "Konstitisyon",
+  "Pa",
+  "Premye",
+  "espas",
+  "mezi",
+  "oblije",
+  "sans",
+  "santi",
+  "té",
+  "espesyal",
+  "liy",
+  "lòd",
+  "pami",
+  "anpeche",
+  "do",
+  "fizik",
+  "kanadyen",
+  "Kanada",
+  "anlè",
+  "glif",
+  "inite",
+  "konesans",
+  "nesesè",
+  "sila",
+  "Depi",
+  "lanmè",
+  "mwayen",
+  "tanperati",
+  "12",
+  "6",
+  "deyò",
+  "etid",
+  "imaj",
+  "kè",
+  "sòti",
+  "vann",
+  "La",
+  "asanble",
+  "bò",
+  "deside",
+  "nèt",
+  "pwogram",
+  "Fè",
+  "grandi",
+  "konpoze",
+  "kounye",
+  "lwen",
+  "move",
+  "pwoteje",
+  "òganizasyon",
+  "konsidere",
+  "mennen",
+  "mezire",
+  "peye",
+  "biznis",
+  "dat",
+  "lib",
+  "militè",
+  "nivo",
+  "respekte",
+  "wo",
+  "Gerardo",
+  "John",
+  "atravè",
+  "bèl",
+  "dokiman",
+  "etap",
+  "grenn",
+  "natirèl",
+  "otorite",
+  "prepare",
+  "prezante",
+  "separe",
+  "son",
+  "zam",
+  "atis",
+  "divès",
+  "grav",
+  "kanpe",
+  "kouran",
+  "kòb",
+  "monte",
+  "patikil",
+  "valè",
+  "Monmouth",
+  "Ou",
+  "Pati",
+  "anyen",
+  "dirije",
+  "ogmante",
+  "pwononse",
+  "7",
+  "Sou",
+  "atòm",
+  "dènye",
+  "je",
+  "jwèt",
+  "papye",
+  "posede",
+  "pwose",
+  "rad",
+  "vant",
+  "é",
+  "Yonn",
+  "blan",
+  "chif",
+  "dan",
+  "dèyè",
+  "estrikti",
+  "kole",
+  "krim",
+  "leve",
+  "materyèl",
+  "rankontre",
+  "trè",
+  "8",
+  "Ewòp",
+  "KEP",
+  "Menm",
+  "jeneral",
+  "kretyen",
+  "onn",
+  "relasyon",
+  "sante",
+  "syans",
+  "èt",
+  "Afrik",
+  "Ki",
+  "SDJ",
+  "cho",
+  "entènasyonal",
+  "matyè",
+  "seksyon",
+  "seri",
+  "touche",
+  "trete",
+  "van",
+  "vi",
+  "branch",
+  "chante",
+  "fèy",
+  "kijan",
+  "le",
+  "malad",
+  "molekil",
+  "prèske",
+  "ranje",
+  "regle",
+  "solid",
+  "t",
+  "vitès",
+  "Konsèy",
+  "Lalwa",
+  "Pòtoprens",
+  "Sistèm",
+  "bout",
+  "lide",
+  "metal",
+  "mond",
+  "pibliye",
+  "sé",
+  "Fòk",
+  "avek",
+  "dakò",
+  "elektrik",
+  "etranje",
+  "gaz",
+  "jijman",
+  "kwen",
+  "nonmen",
+  "plan",
+  "pwòp",
+  "ranplase",
+  "reyaksyon",
+  "tande",
+  "vit",
+  "vre",
+  "zile",
+  "Jan",
+  "Ozetazini",
+  "akòz",
+  "aplike",
+  "defann",
+  "dekri",
+  "femèl",
+  "kapital",
+  "kouvri",
+  "lis",
+  "plen",
+  "sekirite",
+  "10",
+  "Sen",
+  "aprann",
+  "atik",
+  "fas",
+  "jenn",
+  "kou",
+  "solisyon",
+  "y",
+  "zo",
+  "zwazo",
+  "Antonio",
+  "Pierre",
+  "aji",
+  "chèf",
+  "dwèt",
+  "egal",
+  "enstitisyon",
+  "komin",
+  "konpayi",
+  "kreyòl.",
+  "mesaj",
+  "ze",
+  "òganize",
+  "De",
+  "Genyen",
+  "aprè",
+  "avan",
+  "chaj",
+  "dwat",
+  "ekip",
+  "espès",
+  "kom",
+  "nwayo",
+  "osinon",
+  "papa",
+  "radyo",
+  "selon",
+  "twò",
+  "15",
+  "Mwen",
+  "chalè",
+  "dife",
+  "distans",
+  "espesifik",
+  "jèn",
+  "karakteristik",
+  "km²",
+  "koupe",
+  "kout",
+  "mizisyen",
+  "pwopriyete",
+  "reponn",
+  "sentòm",
+  "sid",
+  "wa",
+  "Chak",
+  "Gade",
+  "Prezidan",
+  "San",
+  "amenyen",
+  "diferans",
+  "jije",
+  "kesyon",
+  "kouman",
+  "lagè",
+  "lame",
+  "nwa",
+  "nòmal",
+  "po",
+  "pè",
+  "sik",
+  "sivil",
+  "twal",
+  "vire",
+  "Charles",
+  "Essex",
+  "administrasyon",
+  "domèn",
+  "elektè",
+  "fen",
+  "fon",
+  "grip",
+  "lontan",
+  "on",
+  "osi",
+  "planèt",
+  "popilè",
+  "televizyon",
+  "Camden",
+  "Kote",
+  "Kèk",
+  "asosye",
+  "elektrisite",
+  "etwal",
+  "janvye",
+  "kasasyon",
+  "klas",
+  "komanse",
+  "kominike",
+  "koze",
+  "marye",
+  "operasyon",
+  "pwovens",
+  "regleman",
+  "reyinyon",
+  "senp",
+  "tèks",
+  "wòl",
+  "David",
+  "Katalina",
+  "M",
+  "Miyami",
+  "Morris",
+  "Ti",
+  "afè",
+  "desann",
+  "difisil",
+  "endike",
+  "matematik",
+  "nò",
+  "oseyan",
+  "pouse",
+  "rale",
+  "teknik",
+  "2008",
+  "30",
+  "Bay",
+  "Burlington",
+  "Depatman",
+  "Joseph",
+  "Pandan",
+  "batay",
+  "deklare",
+  "epòk",
+  "gou",
+  "jistis",
+  "kab",
+  "kilti",
+  "kit",
+  "lakay",
+  "lavil",
+  "louvri",
+  "plat",
+  "pozitif",
+  "pre",
+  "sitiyasyon",
+  "syèk",
+  "vè",
+  "we",
+  "9",
+  "Amerik",
+  "Bwa",
+  "Nasyonal",
+  "Ni",
+  "Rene",
+  "anplwaye",
+  "anvi",
+  "diminye",
+  "doktè",
+  "granmoun",
+  "lemond",
+  "lès",
+  "modèl",
+  "paj",
+  "pawòl",
+  "plizye",
+  "poul",
+  "prensip",
+  "relijyon",
+  "reyalize",
+  "rivyè",
+  "sispann",
+  "sit",
+  "Lwa",
+  "Ocean",
+  "esklav",
+  "imen",
+  "jodi",
+  "komite",
+  "kontinan",
+  "l.",
+  "medikaman",
+  "mi",
+  "ofisyèl",
+  "pep",
+  "pli",
+  "retounen",
+  "santral",
+  "sitou",
+  "sosyal",
+  "swiv",
+  "syèl",
+  "vrè",
+  "won",
+  "ògàn",
+  "Dayiti",
+  "Dènye",
+  "James",
+  "achte",
+  "anviwònman",
+  "avyon",
+  "baze",
+  "bwat",
+  "enstriman",
+  "esplike",
+  "fanmiy",
+  "fet",
+  "fevriye",
+  "frèt",
+  "fèb",
+  "jouk",
+  "kontak",
+  "nimewo",
+  "nimewotasyon",
+  "nonb",
+  "obsèvatè",
+  "rekonèt",
+  "retire",
+  "sis",
+  "tretman",
+  "vyann",
+  "wotè",
+  "Bagay",
+  "Pran",
+  "Retire",
+  "apeprè",
+  "avril",
+  "egzanp",
+  "entènèt",
+  "evite",
+  "fèmen",
+  "jounen",
+  "lapli",
+  "lwès",
+  "make",
+  "mil",
+  "pap",
+  "pate",
+  "reyini",
+  "solè",
+  "E",
+  "Epi",
+  "L.",
+  "Washington",
+  "William",
+  "anwo",
+  "atè",
+  "eksperyans",
+  "fasil",
+  "fil",
+  "frè",
+  "jen",
+  "jwè",
+  "kominote",
+  "kouche",
+  "lanmò",
+  "lespri",
+  "paran",
+  "pinisyon",
+  "prevwa",
+  "prive",
+  "rezoud",
+  "ri",
+  "sè",
+  "sèt",
+  "teren",
+  "toupre",
+  "18",
+  "Azi",
+  "Biwo",
+  "Fernando",
+  "Fowòm",
+  "Franklin",
+  "Frans",
+  "Jacques",
+  "aksepte",
+  "depase",
+  "dire",
+  "etabli",
+  "evènman",
+  "fonn",
+  "gratis",
+  "inivèsite",
+  "kad",
+  "koko",
+  "lajistis",
+  "mwens",
+  "nouvèl",
+  "oktòb",
+  "pen",
+  "poko",
+  "posib",
+  "rechèch",
+  "responsab",
+  "sib",
+  "vizite",
+  "zanmi",
+  "zouti",
+  "Gwoup",
+  "Jodi",
+  "Komite",
+  "Liv",
+  "Rutland",
+  "bwè",
+  "chanm",
+  "dous",
+  "edikasyon",
+  "espwa",
+  "gin",
+  "jounal",
+  "kandida",
+  "kochon",
+  "komen",
+  "nèf",
+  "omwen",
+  "plak",
+  "poutèt",
+  "primè",
+  "rapid",
+  "siperyè",
+  "sipò",
+  "teritwa",
+  "zak",
+  "000",
+  "200",
+  "2006",
+  "Itilize",
+  "Le",
+  "Plizyè",
+  "aktè",
+  "angle",
+  "anjeneral",
+  "cheve",
+  "dis",
+  "disponib",
+  "dòmi",
+  "fonde",
+  "il",
+  "kilomèt",
+  "konstitisyon",
+  "kopi",
+  "lespas",
+  "lokal",
+  "mari",
+  "ofri",
+  "polis",
+  "pwa",
+  "pwojè",
+  "sak",
+  "segondè",
+  "swen",
+  "tann",
+  "tisi",
+  "twazyèm",
+  "vwayaje",
+  "zan",
+  "zozo",
+  "20",
+  "Bib",
+  "Fòs",
+  "Jezikri",
+  "Middlesex",
+  "arete",
+  "avantaj",
+  "bakteri",
+  "chèche",
+  "degre",
+  "demokrasi",
+  "devlopman",
+  "dinò",
+  "disparèt",
+  "ebre",
+  "fay",
+  "fonksyon",
+  "frape",
+  "gras",
+  "jounalis",
+  "kominal",
+  "kondanen",
+  "lemonn",
+  "lite",
+  "machandiz",
+  "met",
+  "mineral",
+  "opoze",
+  "resous",
+  "respè",
+  "sal",
+  "telefòn",
+  "2011",
+  "25",
+  "Sussex",
+  "Vil",
+  "Windham",
+  "Windsor",
+  "anviwon",
+  "bann",
+  "boul",
+  "dapre",
+  "degaje",
+  "dola",
+  "endepandan",
+  "goumen",
+  "group",
+  "kapasite",
+  "kominikasyon",
+  "konsène",
+  "kòd",
+  "lage",
+  "lalin",
+  "les",
+  "libète",
+  "madanm",
+  "melanje",
+  "minisipal",
+  "preparasyon",
+  "presyon",
+  "rasin",
+};
+const uint16_t WA_FREQ_61_RANKS[] = {
+  0, 336, 688, 878, 0, 0, 0, 0, 0, 0, 783, 0, 0, 0, 717, 0,
+  146, 320, 0, 0, 0, 0, 58, 0, 0, 0, 0, 0, 0, 0, 0, 600,
+  0, 0, 0, 426, 0, 958, 0, 0, 0, 436, 0, 493, 0, 0, 234, 0,
+  366, 0, 0, 0, 0, 0, 0, 0, 579, 330, 795, 570, 0, 657, 0, 0,
+  271, 262, 283, 0, 0, 0, 683, 771, 785, 0, 128, 0, 0, 524, 0, 0,
+  0, 793, 0, 0, 0, 0, 0, 0, 0, 363, 395, 0, 0, 483, 65, 95,
+  26, 422, 871, 971, 321, 227, 781, 349, 646, 0, 0, 0, 448, 0, 31, 16,
+  319, 81, 115, 237, 377, 207, 381, 652, 758, 782, 933, 294, 0, 0, 0, 0,
+  0, 0, 731, 0, 560, 735, 774, 0, 0, 0, 233, 73, 0, 0, 0, 0,
+  0, 112, 0, 0, 0, 121, 25, 190, 327, 542, 555, 696, 80, 160, 723, 726,
+  217, 399, 779, 571, 119, 0, 0, 0, 0, 0, 172, 447, 135, 469, 557, 0,
+  0, 84, 0, 0, 0, 0, 0, 0, 0, 70, 0, 0, 0, 0, 337, 750,
+  0, 0, 0, 0, 0, 0, 414, 435, 0, 0, 0, 0, 888, 0, 0, 0,
+  798, 56, 42, 289, 0, 0, 0, 0, 0, 0, 162, 267, 0, 0, 894, 807,
+  191, 161, 0, 0, 0, 842, 523, 0, 270, 0, 0, 356, 303, 355, 424, 704,
+  792, 0, 0, 248, 38, 310, 326, 852, 75, 331, 434, 439, 968, 0, 762, 981,
+  0, 6, 0, 0, 0, 292, 350, 0, 0, 0, 0, 491, 796, 0, 0, 0,
+  55, 659, 0, 164, 21, 52, 385, 0, 0, 0, 0, 291, 0, 0, 0, 0,
+  0, 201, 601, 236, 83, 544, 0, 0, 0, 0, 698, 0, 0, 0, 610, 996,
+  899, 714, 0, 0, 0, 0, 244, 575, 710, 936, 365, 0, 637, 858, 0, 105,
+  111, 0, 0, 0, 604, 543, 618, 649, 961, 0, 0, 0, 0, 257, 617, 0,
+  0, 0, 0, 0, 616, 937, 0, 0, 17, 0, 0, 0, 0, 0, 0, 0,
+  0, 216, 0, 163, 563, 0, 870, 153, 438, 297, 0, 0, 479, 615, 960, 0,
+  1, 268, 0, 14, 431, 0, 921, 0, 0, 508, 0, 367, 0, 389, 0, 883,
+  0, 0, 0, 0, 0, 0, 273, 410, 136, 224, 528, 379, 716, 603, 0, 175,
+  0, 0, 0, 0, 635, 556, 0, 686, 897, 907, 860, 900, 535, 0, 0, 0,
+  945, 0, 0, 0, 0, 784, 0, 0, 0, 211, 0, 0, 614, 0, 0, 0,
+  0, 0, 0, 15, 582, 707, 358, 0, 0, 0, 0, 834, 895, 0, 0, 0,
+  0, 0, 180, 734, 0, 0, 0, 0, 0, 0, 953, 0, 0, 51, 620, 638,
+  673, 537, 0, 0, 0, 0, 608, 0, 0, 0, 0, 715, 461, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 368, 915, 97, 0, 0, 246, 87, 359, 801, 0,
+  46, 0, 0, 0, 200, 391, 23, 0, 0, 0, 0, 93, 0, 0, 376, 585,
+  221, 558, 181, 0, 754, 764, 935, 117, 134, 213, 372, 887, 149, 510, 241, 409,
+  902, 954, 722, 116, 0, 0, 0, 0, 188, 0, 247, 549, 0, 293, 0, 0,
+  859, 0, 0, 415, 920, 151, 905, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 288, 628, 893, 462, 0, 428, 0, 547, 0, 0, 718, 0, 0, 0, 0,
+  0, 0, 979, 896, 192, 947, 0, 863, 0, 0, 0, 0, 352, 0, 0, 35,
+  88, 332, 0, 0, 0, 378, 0, 0, 0, 0, 0, 938, 0, 86, 39, 0,
+  85, 0, 596, 0, 0, 0, 950, 740, 0, 0, 0, 380, 394, 0, 212, 0,
+  802, 678, 197, 0, 145, 0, 203, 0, 0, 994, 0, 0, 0, 313, 5, 0,
+  0, 0, 0, 404, 41, 0, 0, 918, 0, 0, 665, 0, 0, 824, 0, 0,
+  0, 0, 240, 0, 0, 0, 206, 226, 282, 517, 997, 0, 0, 0, 0, 0,
+  0, 0, 0, 886, 0, 875, 0, 0, 0, 0, 0, 927, 79, 788, 155, 819,
+  0, 0, 868, 0, 0, 0, 504, 655, 0, 0, 130, 0, 501, 0, 0, 0,
+  864, 144, 260, 0, 0, 0, 0, 0, 304, 574, 139, 663, 695, 833, 276, 279,
+  595, 679, 701, 955, 243, 0, 0, 455, 906, 0, 0, 0, 0, 742, 867, 0,
+  454, 0, 511, 0, 0, 322, 348, 0, 61, 581, 476, 104, 597, 307, 514, 0,
+  0, 0, 0, 205, 0, 964, 0, 0, 0, 0, 0, 278, 737, 0, 0, 661,
+  989, 0, 709, 0, 916, 0, 0, 983, 0, 76, 0, 333, 413, 745, 0, 328,
+  0, 0, 480, 285, 0, 0, 0, 0, 0, 0, 993, 520, 911, 0, 274, 0,
+  393, 64, 78, 405, 0, 967, 147, 0, 0, 797, 0, 0, 222, 0, 0, 0,
+  0, 453, 0, 36, 62, 0, 0, 0, 43, 123, 503, 708, 973, 0, 706, 0,
+  0, 0, 0, 0, 0, 360, 90, 0, 0, 306, 0, 0, 529, 940, 0, 0,
+  0, 0, 0, 0, 0, 566, 173, 515, 0, 0, 0, 302, 636, 0, 0, 0,
+  362, 496, 786, 265, 826, 844, 487, 0, 0, 769, 407, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 757, 739, 0, 486, 0, 0, 335, 4, 0, 0, 982, 301,
+  0, 861, 0, 0, 512, 0, 0, 0, 0, 0, 0, 759, 0, 0, 0, 0,
+  0, 396, 0, 0, 22, 619, 235, 0, 0, 0, 0, 0, 0, 591, 0, 0,
+  0, 0, 0, 0, 977, 0, 685, 196, 0, 0, 853, 0, 0, 0, 965, 854,
+  316, 0, 0, 820, 576, 0, 0, 711, 668, 0, 68, 0, 0, 232, 466, 0,
+  0, 990, 13, 269, 132, 862, 962, 0, 0, 0, 0, 901, 0, 0, 0, 0,
+  0, 0, 0, 567, 199, 0, 420, 341, 0, 0, 0, 256, 0, 626, 761, 703,
+  794, 0, 133, 138, 488, 976, 719, 0, 481, 0, 156, 485, 77, 187, 741, 0,
+  0, 0, 0, 0, 118, 692, 0, 392, 0, 0, 0, 171, 165, 0, 0, 0,
+  0, 0, 680, 299, 28, 913, 728, 344, 654, 0, 0, 182, 518, 343, 738, 772,
+  843, 650, 0, 0, 0, 0, 0, 432, 0, 0, 667, 0, 0, 641, 0, 613,
+  642, 0, 541, 0, 998, 0, 0, 0, 0, 0, 47, 459, 0, 340, 122, 129,
+  845, 0, 0, 925, 400, 0, 0, 0, 0, 458, 0, 9, 0, 831, 0, 419,
+  565, 817, 308, 702, 0, 0, 0, 0, 909, 0, 0, 0, 0, 621, 0, 912,
+  0, 0, 0, 0, 0, 0, 468, 230, 0, 0, 0, 0, 92, 693, 932, 0,
+  645, 0, 509, 648, 99, 890, 941, 780, 975, 499, 166, 429, 991, 0, 0, 143,
+  633, 789, 0, 0, 0, 0, 110, 882, 0, 0, 840, 0, 0, 59, 0, 0,
+  0, 185, 176, 0, 0, 687, 0, 0, 0, 0, 0, 984, 0, 0, 609, 0,
+  457, 183, 411, 587, 671, 791, 749, 0, 850, 0, 889, 37, 0, 100, 0, 0,
+  836, 495, 0, 0, 0, 0, 440, 0, 44, 383, 720, 0, 851, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 49, 0, 0, 421, 195, 540, 590, 724, 586, 848,
+  0, 245, 357, 0, 157, 677, 548, 0, 0, 0, 0, 0, 204, 124, 470, 0,
+  0, 277, 0, 0, 0, 0, 423, 0, 919, 0, 0, 148, 0, 0, 0, 0,
+  0, 0, 0, 944, 0, 450, 0, 0, 527, 519, 219, 0, 0, 0, 0, 0,
+  403, 805, 516, 721, 0, 943, 412, 0, 0, 0, 449, 0, 0, 0, 0, 0,
+  0, 141, 374, 275, 370, 0, 0, 0, 0, 0, 966, 0, 533, 545, 568, 705,
+  127, 849, 0, 0, 694, 874, 898, 623, 847, 0, 498, 598, 607, 0, 914, 325,
+  974, 0, 0, 492, 846, 980, 0, 417, 101, 0, 957, 0, 0, 120, 0, 732,
+  91, 538, 0, 0, 0, 539, 474, 712, 0, 0, 94, 0, 546, 580, 730, 0,
+  27, 345, 865, 630, 0, 0, 229, 0, 0, 398, 0, 0, 0, 530, 884, 0,
+  20, 647, 388, 386, 725, 0, 107, 612, 578, 0, 0, 624, 456, 838, 0, 106,
+  0, 0, 0, 0, 644, 0, 0, 209, 397, 0, 0, 0, 0, 605, 0, 0,
+  0, 0, 109, 752, 756, 0, 0, 178, 464, 0, 290, 0, 0, 0, 0, 218,
+  577, 142, 625, 29, 465, 346, 697, 592, 713, 825, 763, 451, 298, 506, 266, 186,
+  223, 532, 554, 818, 446, 228, 445, 869, 194, 284, 963, 978, 640, 0, 0, 338,
+  0, 433, 656, 177, 583, 0, 0, 744, 401, 0, 0, 113, 0, 0, 804, 880,
+  643, 0, 0, 507, 477, 0, 0, 765, 437, 0, 0, 0, 0, 0, 0, 800,
+  0, 611, 108, 877, 879, 959, 599, 0, 799, 651, 0, 0, 743, 472, 0, 0,
+  0, 0, 0, 660, 0, 0, 0, 215, 0, 323, 0, 0, 550, 681, 478, 760,
+  184, 803, 305, 334, 371, 813, 53, 773, 0, 0, 829, 822, 0, 0, 231, 0,
+  0, 0, 0, 0, 0, 892, 0, 0, 0, 821, 287, 0, 0, 0, 0, 0,
+  690, 317, 0, 0, 0, 63, 629, 0, 0, 553, 0, 0, 0, 0, 0, 572,
+  0, 329, 0, 931, 250, 255, 747, 54, 521, 0, 631, 0, 0, 0, 0, 0,
+  0, 923, 0, 96, 885, 0, 0, 0, 0, 0, 0, 0, 746, 102, 252, 137,
+  0, 832, 0, 700, 0, 315, 254, 775, 0, 0, 0, 0, 0, 0, 258, 995,
+  0, 588, 670, 0, 0, 168, 170, 811, 353, 634, 814, 985, 261, 0, 443, 0,
+  0, 513, 669, 0, 551, 0, 0, 904, 0, 653, 939, 0, 0, 0, 7, 0,
+  0, 956, 430, 755, 0, 48, 50, 154, 0, 0, 0, 0, 0, 777, 0, 930,
+  0, 534, 471, 34, 67, 662, 948, 0, 0, 238, 0, 0, 917, 0, 0, 71,
+  0, 0, 0, 0, 251, 361, 881, 922, 0, 552, 0, 0, 0, 0, 0, 753,
+  314, 593, 0, 280, 497, 672, 351, 684, 736, 45, 815, 0, 0, 114, 0, 841,
+  0, 0, 40, 126, 0, 193, 0, 0, 0, 691, 460, 0, 0, 0, 0, 24,
+  131, 808, 0, 0, 0, 816, 606, 776, 809, 934, 296, 0, 0, 364, 835, 0,
+  60, 972, 263, 150, 159, 589, 525, 494, 152, 505, 442, 594, 602, 766, 10, 658,
+  986, 354, 259, 69, 564, 526, 839, 281, 0, 347, 768, 33, 0, 0, 0, 778,
+  427, 926, 0, 0, 0, 408, 0, 0, 0, 0, 0, 0, 0, 790, 0, 729,
+  0, 167, 375, 418, 264, 767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 855,
+  463, 929, 0, 0, 0, 689, 0, 286, 369, 0, 0, 0, 0, 951, 0, 482,
+  324, 770, 0, 0, 8, 699, 891, 0, 295, 103, 210, 318, 0, 382, 89, 174,
+  500, 666, 787, 866, 992, 0, 0, 573, 748, 0, 910, 0, 467, 584, 416, 952,
+  0, 0, 342, 452, 2, 0, 0, 3, 0, 12, 632, 0, 0, 311, 562, 0,
+  0, 169, 999, 0, 0, 0, 0, 0, 387, 0, 0, 0, 18, 0, 0, 733,
+  0, 0, 664, 225, 384, 682, 0, 0, 253, 0, 675, 0, 0, 0, 0, 873,
+  0, 0, 0, 0, 0, 0, 11, 0, 827, 484, 970, 627, 751, 208, 872, 0,
+  0, 949, 425, 727, 0, 0, 0, 946, 830, 0, 19, 988, 373, 0, 0, 0,
+  0, 0, 0, 622, 473, 536, 0, 674, 0, 57, 0, 272, 903, 32, 98, 140,
+  441, 0, 806, 0, 0, 908, 202, 0, 0, 0, 928, 490, 444, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 489, 823, 0, 312, 402, 676, 82, 214, 239,
+  812, 828, 0, 66, 1000, 561, 0, 522, 72, 242, 339, 987, 309, 857, 0, 0,
+  0, 0, 0, 0, 0, 0, 942, 0, 0, 0, 0, 0, 559, 0, 924, 0,
+  220, 249, 406, 300, 0, 158, 189, 390, 969, 0, 876, 0, 837, 0, 0, 569,
+  0, 0, 475, 810, 856, 0, 30, 0, 639, 0, 0, 74, 0, 0, 0, 0,
+  502, 531, 0, 198, 0, 0, 0, 0, 125, 0, 0, 0, 0, 0, 0, 179,
+};
+
+const char *WA_FREQ_62_TOKENS[] = {
+  "a",
+  "nem",
+  "az",
+  "hogy",
+  "és",
+  "egy",
+  "van",
+  "ez",
+  "is",
+  "de",
+  "meg",
+  "csak",
+  "ha",
+  "mi",
+  "én",
+  "azt",
+  "volt",
+  "igen",
+  "vagy",
+  "kell",
+  "el",
+  "itt",
+  "már",
+  "még",
+  "ne",
+  "te",
+  "ki",
+  "mit",
+  "ezt",
+  "vagyok",
+  "most",
+  "jó",
+  "tudom",
+  "úgy",
+  "miért",
+  "akkor",
+  "mint",
+  "ő",
+  "jól",
+  "lesz",
+  "nagyon",
+  "nincs",
+  "mert",
+  "minden",
+  "sem",
+  "amit",
+  "olyan",
+  "rendben",
+  "így",
+  "be",
+  "volna",
+  "oké",
+  "nekem",
+  "le",
+  "fel",
+  "tudod",
+  "ott",
+  "lehet",
+  "valami",
+  "majd",
+  "mindig",
+  "talán",
+  "maga",
+  "köszönöm",
+  "semmi",
+  "hát",
+  "aki",
+  "amikor",
+  "hol",
+  "neki",
+  "szóval",
+  "neked",
+  "ami",
+  "kis",
+  "hé",
+  "tényleg",
+  "hiszem",
+  "elég",
+  "valamit",
+  "fog",
+  "lenne",
+  "ó",
+  "igaz",
+  "rá",
+  "vele",
+  "milyen",
+  "ilyen",
+  "ide",
+  "biztos",
+  "uram",
+  "őket",
+  "vissza",
+  "nagy",
+  "tudja",
+  "ma",
+  "egész",
+  "sajnálom",
+  "nos",
+  "mikor",
+  "vagyunk",
+  "gyerünk",
+  "vannak",
+  "azért",
+  "ember",
+  "történt",
+  "mr",
+  "persze",
+  "túl",
+  "sok",
+  "mondta",
+  "két",
+  "értem",
+  "gyere",
+  "szia",
+  "valaki",
+  "ahogy",
+  "aztán",
+  "pedig",
+  "kicsit",
+  "engem",
+  "ezért",
+  "velem",
+  "arra",
+  "voltam",
+  "mondtam",
+  "ugye",
+  "mindent",
+  "őt",
+  "na",
+  "kellett",
+  "új",
+  "más",
+  "semmit",
+  "benne",
+  "se",
+  "nézd",
+  "akarsz",
+  "szerintem",
+  "miatt",
+  "kérem",
+  "jobb",
+  "veled",
+  "akarok",
+  "akarom",
+  "erre",
+  "több",
+  "kérlek",
+  "baj",
+  "mindenki",
+  "legyen",
+  "kéne",
+  "soha",
+  "menj",
+  "nap",
+  "akar",
+  "magát",
+  "együtt",
+  "rám",
+  "senki",
+  "szép",
+  "át",
+  "első",
+  "mintha",
+  "pár",
+  "rossz",
+  "este",
+  "ezek",
+  "minket",
+  "után",
+  "emberek",
+  "téged",
+  "róla",
+  "szerint",
+  "várj",
+  "hogyan",
+  "újra",
+  "sosem",
+  "láttam",
+  "tudok",
+  "tudtam",
+  "istenem",
+  "ön",
+  "kellene",
+  "dolog",
+  "ja",
+  "akartam",
+  "hittem",
+  "mondja",
+  "egyszer",
+  "annyira",
+  "igazán",
+  "oda",
+  "mondd",
+  "amíg",
+  "másik",
+  "apa",
+  "egyik",
+  "lenni",
+  "tessék",
+  "megyek",
+  "gondoltam",
+  "tűnik",
+  "lett",
+  "néhány",
+  "magam",
+  "inkább",
+  "érted",
+  "jobban",
+  "anya",
+  "innen",
+  "saját",
+  "rajta",
+  "ezzel",
+  "épp",
+  "alatt",
+  "ebben",
+  "elnézést",
+  "úr",
+  "legjobb",
+  "teljesen",
+  "figyelj",
+  "tud",
+  "magad",
+  "három",
+  "egyetlen",
+  "hozzá",
+  "megy",
+  "jön",
+  "mielőtt",
+  "szó",
+  "mind",
+  "egyedül",
+  "menjünk",
+  "komolyan",
+  "akarod",
+  "oh",
+  "mondani",
+  "micsoda",
+  "akik",
+  "voltál",
+  "isten",
+  "mire",
+  "tovább",
+  "előtt",
+  "vége",
+  "voltak",
+  "ahol",
+  "ők",
+  "hadd",
+  "nekünk",
+  "holnap",
+  "szeretném",
+  "nő",
+  "honnan",
+  "nélkül",
+  "ennek",
+  "tehát",
+  "pontosan",
+  "azok",
+  "áll",
+  "dr.",
+  "először",
+  "mégis",
+  "fogok",
+  "tudjuk",
+  "csinálsz",
+  "azzal",
+  "remek",
+  "akarja",
+  "beszélni",
+  "erről",
+  "mondom",
+  "idő",
+  "megint",
+  "látni",
+  "haver",
+  "fogja",
+  "nehéz",
+  "leszek",
+  "jött",
+  "rád",
+  "lány",
+  "gyorsan",
+  "remélem",
+  "ti",
+  "hallottam",
+  "fogom",
+  "hanem",
+  "helló",
+  "tudni",
+  "pont",
+  "össze",
+  "látom",
+  "igazi",
+  "tudsz",
+  "sokat",
+  "sincs",
+  "nekik",
+  "egyet",
+  "haza",
+  "örülök",
+  "utolsó",
+  "mondtad",
+  "menni",
+  "szeretnék",
+  "később",
+  "mivel",
+  "megvan",
+  "érzem",
+  "ezen",
+  "miről",
+  "ennyi",
+  "legalább",
+  "ugyan",
+  "kösz",
+  "azonnal",
+  "ideje",
+  "magának",
+  "sokkal",
+  "fogsz",
+  "csinálni",
+  "férfi",
+  "tegnap",
+  "bele",
+  "hagyd",
+  "fontos",
+  "srácok",
+  "akit",
+  "kedves",
+  "arról",
+  "nagyszerű",
+  "pénzt",
+  "végre",
+  "gond",
+  "érdekel",
+  "annak",
+  "azon",
+  "reggel",
+  "éves",
+  "gondolom",
+  "tenni",
+  "többet",
+  "tetszik",
+  "attól",
+  "kész",
+  "összes",
+  "apám",
+  "mennem",
+  "ment",
+  "helyzet",
+  "többé",
+  "abba",
+  "néha",
+  "meghalt",
+  "biztosan",
+  "állj",
+  "egyáltalán",
+  "éve",
+  "szükségem",
+  "néz",
+  "halott",
+  "boldog",
+  "szeretlek",
+  "következő",
+  "hely",
+  "látod",
+  "képes",
+  "fiam",
+  "beszélsz",
+  "szeretem",
+  "add",
+  "mrs",
+  "ezeket",
+  "dolgot",
+  "számít",
+  "hová",
+  "között",
+  "vagytok",
+  "szerinted",
+  "abban",
+  "régi",
+  "fickó",
+  "óta",
+  "jelent",
+  "segíteni",
+  "történik",
+  "találkozunk",
+  "világ",
+  "készen",
+  "mondott",
+  "perc",
+  "beszél",
+  "míg",
+  "majdnem",
+  "jöttem",
+  "ellen",
+  "aha",
+  "úgyhogy",
+  "fiú",
+  "szabad",
+  "öt",
+  "hova",
+  "ahhoz",
+  "valakit",
+  "megyünk",
+  "jöjjön",
+  "valaha",
+  "francba",
+  "tettem",
+  "óra",
+  "barátom",
+  "neve",
+  "nézze",
+  "dolgokat",
+  "s",
+  "addig",
+  "köszi",
+  "mész",
+  "múlva",
+  "hozzám",
+  "folyik",
+  "enyém",
+  "velünk",
+  "érte",
+  "tőle",
+  "miután",
+  "fél",
+  "munka",
+  "éppen",
+  "leszel",
+  "valószínűleg",
+  "tedd",
+  "légy",
+  "főnök",
+  "amint",
+  "drágám",
+  "mondod",
+  "bár",
+  "bármit",
+  "gondolsz",
+  "király",
+  "emlékszel",
+  "hülye",
+  "emlékszem",
+  "dolgok",
+  "jelenti",
+  "kérek",
+  "előbb",
+  "mindjárt",
+  "miss",
+  "fognak",
+  "ilyet",
+  "maradj",
+  "tőlem",
+  "gondolod",
+  "napot",
+  "mennyi",
+  "gyönyörű",
+  "valóban",
+  "utána",
+  "bármi",
+  "mennyire",
+  "akár",
+  "természetesen",
+  "fogunk",
+  "akart",
+  "valójában",
+  "viszlát",
+  "nézz",
+  "vicces",
+  "tette",
+  "anyám",
+  "négy",
+  "beszélek",
+  "tökéletes",
+  "teljes",
+  "éjjel",
+  "kapitány",
+  "tudta",
+  "embert",
+  "tett",
+  "szüksége",
+  "való",
+  "elment",
+  "helyet",
+  "találtam",
+  "év",
+  "gyerek",
+  "eddig",
+  "jaj",
+  "vettem",
+  "tudják",
+  "sikerült",
+  "ezelőtt",
+  "fogd",
+  "csinál",
+  "öreg",
+  "ég",
+  "velük",
+  "annyi",
+  "életben",
+  "mióta",
+  "pénz",
+  "egyszerűen",
+  "igazad",
+  "mond",
+  "tiszta",
+  "otthon",
+  "jack",
+  "élet",
+  "szól",
+  "hosszú",
+  "belőle",
+  "igazából",
+  "üdv",
+  "john",
+  "igaza",
+  "menjen",
+  "aggódj",
+  "szépen",
+  "fogod",
+  "hangzik",
+  "vedd",
+  "helyes",
+  "jövök",
+  "bocs",
+  "mást",
+  "közel",
+  "fiúk",
+  "ötlet",
+  "new",
+  "viszont",
+  "tart",
+  "ok",
+  "reggelt",
+  "végül",
+  "halló",
+  "hamarosan",
+  "hiszed",
+  "jár",
+  "bocsánat",
+  "látta",
+  "sose",
+  "doktor",
+  "hét",
+  "maguk",
+  "ebből",
+  "furcsa",
+  "alig",
+  "fenébe",
+  "időt",
+  "egymást",
+  "többi",
+  "életem",
+  "korábban",
+  "lennék",
+  "voltunk",
+  "muszáj",
+  "elő",
+  "vagyis",
+  "h",
+  "rosszul",
+  "munkát",
+  "sokáig",
+  "kurva",
+  "hat",
+  "pillanat",
+  "kapcsolatban",
+  "szívesen",
+  "ismerem",
+  "vigyázz",
+  "mellett",
+  "önnek",
+  "ehhez",
+  "melyik",
+  "marad",
+  "jössz",
+  "eltűnt",
+  "rendőrség",
+  "nyugi",
+  "beteg",
+  "akarta",
+  "lennie",
+  "srác",
+  "ennyire",
+  "második",
+  "különleges",
+  "gyerekek",
+  "dolgozni",
+  "érti",
+  "működik",
+  "jönni",
+  "magával",
+  "csináld",
+  "apád",
+  "rólam",
+  "ügy",
+  "kérdés",
+  "láttad",
+  "komoly",
+  "él",
+  "bennem",
+  "keresztül",
+  "akinek",
+  "egyszerű",
+  "őrült",
+  "dolgozik",
+  "embereket",
+  "gondolja",
+  "hívják",
+  "felé",
+  "erős",
+  "belül",
+  "fehér",
+  "fekete",
+  "maradt",
+  "csodálatos",
+  "annyit",
+  "lehetséges",
+  "szívem",
+  "azokat",
+  "sam",
+  "mindketten",
+  "kaptam",
+  "várjon",
+  "tudunk",
+  "gyilkos",
+  "alá",
+  "hiszi",
+  "édes",
+  "amire",
+  "vár",
+  "hatalmas",
+  "mindegy",
+  "tőled",
+  "fiatal",
+  "hello",
+  "köszönjük",
+  "igazság",
+  "kibaszott",
+  "apja",
+  "közben",
+  "bárki",
+  "kettő",
+  "nagyobb",
+  "nincsenek",
+  "fene",
+  "héten",
+  "úton",
+  "segítség",
+  "múlt",
+  "érdekes",
+  "könnyű",
+  "számára",
+  "akarnak",
+  "szörnyű",
+  "uraim",
+  "ajtót",
+  "mindenkinek",
+  "nevem",
+  "mármint",
+  "segít",
+  "kívül",
+  "előre",
+  "asszonyom",
+  "nálam",
+  "amiért",
+  "nézel",
+  "ketten",
+  "különben",
+  "része",
+  "valahol",
+  "mondják",
+  "venni",
+  "csináltam",
+  "elnök",
+  "tartani",
+  "hány",
+  "lesznek",
+  "probléma",
+  "e",
+  "beszéltem",
+  "fogjuk",
+  "élni",
+  "ettől",
+  "percet",
+  "ügynök",
+  "máris",
+  "esetleg",
+  "egyre",
+  "fordította",
+  "michael",
+  "tele",
+  "leszünk",
+  "igazat",
+  "tesz",
+  "kit",
+  "egészen",
+  "mondjuk",
+  "szükségünk",
+  "legnagyobb",
+  "tudjátok",
+  "nyomozó",
+  "bent",
+  "minek",
+  "jöttél",
+  "adni",
+  "tíz",
+  "szót",
+  "évvel",
+  "például",
+  "mondták",
+  "tűnt",
+  "titeket",
+  "család",
+  "veszélyes",
+  "meleg",
+  "ér",
+  "the",
+  "került",
+  "hagyja",
+  "tiéd",
+  "halál",
+  "fegyvert",
+  "kicsi",
+  "szent",
+  "lányok",
+  "kicsim",
+  "magukat",
+  "ránk",
+  "adj",
+  "ház",
+  "édesem",
+  "fogják",
+  "adott",
+  "hozzád",
+  "adja",
+  "félek",
+  "lehetett",
+  "eléggé",
+  "szükség",
+  "újabb",
+  "mai",
+  "fáj",
+  "amiket",
+  "régen",
+  "kemény",
+  "rengeteg",
+  "mindenkit",
+  "éreztem",
+  "segíts",
+  "látszik",
+  "amerikai",
+  "véget",
+  "körül",
+  "rohadt",
+  "mondok",
+  "kerül",
+  "beszélt",
+  "éjszaka",
+  "mondtál",
+  "lehetne",
+  "valahogy",
+  "hirtelen",
+  "rögtön",
+  "barátok",
+  "jót",
+  "végig",
+  "köze",
+  "dehogy",
+  "ért",
+  "biztonsági",
+  "bocsi",
+  "békén",
+  "szereti",
+  "kinek",
+  "tudtad",
+  "charlie",
+  "kapott",
+  "egyébként",
+  "helyen",
+  "mennünk",
+  "anyu",
+  "jönnek",
+  "ölni",
+  "látja",
+  "szar",
+  "vajon",
+  "jézusom",
+  "szeretnél",
+  "járt",
+  "tom",
+  "hisz",
+  "szegény",
+  "nektek",
+  "érzés",
+  "frank",
+  "okos",
+  "mike",
+  "hoztam",
+  "út",
+  "biztonságban",
+  "mögött",
+  "onnan",
+  "esküszöm",
+  "ismeri",
+  "bárcsak",
+  "értettem",
+  "találkoztunk",
+  "segíthetek",
+  "távol",
+  "ugyanaz",
+  "sajnos",
+  "napja",
+  "kölyök",
+  "mindannyian",
+  "értelme",
+  "érzed",
+  "emberi",
+  "hallani",
+  "szeretne",
+  "kint",
+  "orvos",
+  "senkit",
+  "csapat",
+  "elmúlt",
+  "gondol",
+  "lássuk",
+  "ennél",
+  "fia",
+  "ismered",
+  "késő",
+  "apu",
+  "legyek",
+  "keres",
+  "feleségem",
+  "annál",
+  "felesége",
+  "lányt",
+  "david",
+  "egészet",
+  "merre",
+  "folyton",
+  "mozgás",
+  "talált",
+  "rólad",
+  "senkinek",
+  "barátja",
+  "életét",
+  "oka",
+  "beszélünk",
+  "valakinek",
+  "keresel",
+  "magára",
+  "tegye",
+  "gyertek",
+  "george",
+  "halt",
+  "dollár",
+  "ezer",
+  "legközelebb",
+  "tartok",
+  "szükséged",
+  "hihetetlen",
+  "kifelé",
+  "fura",
+  "város",
+  "itthon",
+  "szeret",
+  "beszélj",
+  "megértem",
+  "elmegyek",
+  "időben",
+  "lgen",
+  "ülj",
+  "anyád",
+  "fogalmam",
+  "mondanom",
+  "utat",
+  "millió",
+  "hátra",
+  "csinált",
+  "idióta",
+  "városban",
+  "lassan",
+  "nevét",
+  "kik",
+  "lehetetlen",
+  "megfelelő",
+  "víz",
+  "szerelem",
+  "nézni",
+  "számomra",
+  "aludni",
+  "imádom",
+  "kivéve",
+  "joe",
+  "helyre",
+  "utoljára",
+  "peter",
+  "t",
+  "lényeg",
+  "amúgy",
+  "á",
+  "bizony",
+  "benned",
+  "miközben",
+  "felejtsd",
+  "teszi",
+  "ben",
+  "tettél",
+  "észre",
+  "hír",
+  "alapján",
+  "maradjon",
+  "közül",
+  "hallom",
+  "gondolok",
+  "őszintén",
+  "amivel",
+  "önt",
+  "rosszabb",
+  "csinálja",
+  "tudott",
+  "életet",
+  "dolgozom",
+  "szerettem",
+  "nőt",
+  "legyél",
+  "látok",
+  "hozott",
+  "azóta",
+  "általában",
+  "végén",
+  "estét",
+  "nyugodtan",
+  "éjt",
+  "megölni",
+  "tartsd",
+  "részt",
+  "anyja",
+  "jutott",
+  "drága",
+  "i",
+  "hiányzik",
+  "hagyjuk",
+  "bizonyos",
+  "üzenetet",
+  "egyes",
+  "próbáltam",
+  "megölte",
+  "gratulálok",
+  "rég",
+  "jövő",
+  "uh",
+  "kérsz",
+  "napon",
+  "kislány",
+  "emiatt",
+  "állsz",
+  "tudnak",
+  "l",
+  "rész",
+  "azután",
+  "baja",
+  "messze",
+  "csodás",
+  "szemét",
+  "hölgyem",
+  "föld",
+  "találni",
+  "mostanában",
+  "csomó",
+  "szuper",
+  "akivel",
+  "látott",
+  "állt",
+  "ah",
+  "hívott",
+  "kezd",
+  "ilyesmi",
+  "titkos",
+  "bocsánatot",
+  "lennél",
+  "büszke",
+  "játszani",
+  "magas",
+  "ideig",
+  "házban",
+  "o",
+  "nők",
+  "nézzétek",
+  "dolgom",
+  "james",
+  "állok",
+  "szereted",
+  "áldozat",
+  "elmondom",
+  "vér",
+  "kap",
+};
+const uint16_t WA_FREQ_62_RANKS[] = {
+  980, 270, 0, 0, 306, 53, 114, 482, 132, 644, 690, 714, 2, 138, 125, 335,
+  672, 434, 950, 981, 424, 259, 34, 0, 0, 273, 0, 0, 0, 673, 0, 625,
+  521, 17, 541, 556, 0, 0, 276, 567, 716, 59, 0, 501, 0, 0, 0, 0,
+  0, 444, 0, 0, 76, 0, 715, 938, 141, 0, 0, 0, 0, 0, 0, 934,
+  0, 828, 459, 919, 873, 0, 0, 0, 698, 519, 182, 593, 987, 0, 0, 603,
+  0, 524, 296, 111, 0, 425, 0, 941, 0, 0, 0, 798, 451, 234, 374, 627,
+  21, 860, 0, 0, 322, 0, 336, 0, 0, 136, 654, 0, 0, 0, 133, 338,
+  585, 0, 458, 134, 158, 30, 28, 384, 530, 179, 330, 640, 867, 184, 505, 918,
+  601, 961, 364, 757, 239, 779, 801, 989, 0, 0, 0, 0, 347, 447, 56, 0,
+  0, 0, 324, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 151,
+  0, 264, 0, 0, 0, 0, 0, 0, 0, 0, 340, 0, 0, 0, 0, 0,
+  0, 517, 0, 545, 0, 0, 0, 0, 712, 104, 243, 879, 0, 288, 121, 0,
+  377, 0, 0, 507, 0, 0, 402, 0, 202, 461, 0, 0, 0, 0, 290, 895,
+  0, 0, 0, 0, 0, 808, 0, 516, 896, 651, 0, 890, 508, 0, 660, 0,
+  75, 0, 0, 0, 0, 441, 0, 472, 334, 356, 0, 0, 0, 0, 0, 74,
+  0, 0, 665, 510, 706, 0, 0, 0, 912, 0, 203, 0, 0, 422, 429, 0,
+  0, 26, 837, 170, 0, 0, 583, 0, 666, 857, 542, 0, 29, 0, 0, 0,
+  771, 796, 0, 839, 943, 0, 0, 686, 795, 205, 0, 0, 0, 0, 608, 0,
+  0, 0, 0, 827, 829, 927, 0, 0, 468, 0, 878, 0, 127, 0, 0, 843,
+  0, 442, 0, 0, 0, 0, 832, 0, 0, 0, 0, 154, 65, 488, 0, 0,
+  0, 490, 739, 0, 953, 0, 385, 303, 404, 230, 37, 339, 655, 0, 0, 0,
+  0, 0, 0, 0, 0, 645, 430, 752, 0, 0, 0, 846, 0, 0, 266, 271,
+  747, 861, 967, 212, 591, 9, 343, 421, 371, 445, 590, 130, 650, 903, 0, 0,
+  0, 0, 0, 0, 985, 295, 372, 589, 122, 94, 683, 977, 804, 0, 389, 314,
+  907, 486, 814, 0, 0, 0, 7, 0, 0, 0, 0, 0, 973, 0, 213, 431,
+  767, 0, 0, 813, 852, 689, 299, 0, 0, 0, 41, 0, 0, 0, 0, 109,
+  0, 0, 910, 393, 0, 0, 0, 100, 0, 0, 261, 0, 0, 246, 354, 0,
+  924, 0, 0, 1, 0, 0, 0, 525, 0, 0, 0, 635, 874, 844, 781, 904,
+  275, 0, 0, 565, 0, 0, 0, 0, 282, 560, 57, 281, 0, 514, 0, 423,
+  0, 0, 0, 86, 398, 0, 535, 0, 682, 0, 448, 576, 0, 97, 678, 722,
+  148, 0, 0, 0, 500, 0, 0, 0, 611, 36, 774, 0, 60, 740, 0, 0,
+  0, 0, 214, 0, 0, 0, 0, 0, 219, 719, 0, 0, 546, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 748, 609, 822, 0, 0, 0, 0, 0,
+  0, 630, 688, 991, 0, 0, 0, 0, 319, 478, 0, 185, 0, 244, 0, 851,
+  0, 0, 0, 0, 0, 0, 370, 841, 702, 119, 245, 363, 674, 744, 0, 228,
+  71, 255, 600, 554, 137, 916, 497, 0, 0, 0, 0, 928, 863, 0, 0, 0,
+  318, 0, 0, 0, 416, 373, 0, 0, 529, 575, 0, 732, 0, 0, 833, 965,
+  964, 974, 917, 0, 0, 208, 223, 67, 315, 0, 503, 327, 538, 959, 0, 0,
+  0, 0, 0, 0, 592, 471, 0, 49, 320, 0, 663, 0, 534, 858, 419, 1000,
+  0, 790, 0, 191, 232, 344, 0, 0, 450, 0, 0, 107, 648, 971, 0, 146,
+  73, 260, 824, 0, 0, 0, 0, 0, 369, 0, 0, 0, 0, 0, 0, 0,
+  108, 0, 0, 0, 0, 499, 0, 0, 0, 0, 48, 0, 0, 986, 420, 0,
+  0, 396, 0, 47, 129, 307, 0, 776, 286, 0, 0, 407, 285, 115, 0, 0,
+  0, 869, 418, 464, 0, 0, 333, 0, 0, 636, 0, 793, 942, 0, 0, 0,
+  992, 0, 888, 0, 0, 0, 0, 0, 0, 948, 850, 0, 0, 96, 724, 587,
+  0, 0, 0, 0, 171, 332, 633, 836, 966, 0, 0, 0, 0, 8, 466, 594,
+  667, 656, 0, 0, 0, 367, 976, 39, 0, 868, 913, 0, 759, 414, 984, 0,
+  881, 571, 0, 0, 586, 51, 0, 0, 0, 0, 0, 287, 0, 0, 0, 0,
+  0, 0, 0, 440, 0, 0, 0, 0, 454, 0, 0, 0, 709, 32, 0, 0,
+  0, 0, 221, 0, 0, 0, 0, 33, 194, 443, 177, 568, 996, 0, 999, 0,
+  0, 473, 990, 0, 0, 0, 906, 842, 0, 225, 489, 853, 353, 902, 0, 297,
+  91, 969, 0, 933, 854, 0, 0, 0, 0, 0, 0, 549, 0, 0, 0, 0,
+  0, 0, 216, 380, 456, 513, 720, 734, 880, 462, 58, 235, 265, 0, 298, 69,
+  483, 958, 0, 492, 553, 0, 0, 0, 0, 0, 401, 520, 0, 0, 0, 0,
+  0, 0, 236, 279, 680, 726, 0, 898, 0, 0, 0, 0, 175, 559, 944, 89,
+  84, 224, 313, 469, 105, 162, 782, 0, 0, 161, 289, 27, 693, 717, 899, 0,
+  0, 0, 0, 0, 403, 883, 588, 491, 641, 0, 0, 0, 816, 751, 0, 988,
+  0, 35, 476, 0, 994, 0, 597, 474, 620, 643, 0, 0, 79, 0, 0, 0,
+  0, 0, 93, 128, 619, 116, 949, 0, 972, 0, 0, 0, 573, 0, 0, 0,
+  475, 0, 196, 365, 0, 0, 329, 957, 0, 557, 0, 253, 417, 652, 0, 0,
+  156, 0, 0, 0, 0, 923, 0, 0, 310, 0, 0, 6, 701, 502, 626, 0,
+  821, 818, 0, 0, 0, 166, 0, 875, 0, 0, 3, 788, 562, 131, 157, 321,
+  395, 558, 615, 0, 0, 0, 0, 911, 0, 291, 708, 0, 0, 62, 0, 0,
+  0, 359, 0, 0, 0, 193, 64, 0, 0, 0, 0, 82, 0, 263, 388, 0,
+  155, 743, 19, 220, 0, 729, 0, 0, 884, 0, 0, 0, 346, 548, 0, 0,
+  0, 0, 671, 433, 0, 479, 727, 0, 887, 0, 147, 238, 349, 415, 544, 0,
+  0, 0, 579, 901, 685, 831, 46, 200, 267, 718, 90, 762, 935, 0, 0, 0,
+  0, 24, 577, 0, 351, 0, 25, 0, 0, 0, 566, 176, 386, 932, 0, 892,
+  0, 211, 772, 930, 0, 242, 0, 677, 0, 152, 240, 383, 694, 0, 0, 997,
+  248, 598, 254, 872, 0, 0, 0, 0, 0, 0, 602, 43, 280, 379, 0, 0,
+  283, 0, 0, 778, 169, 0, 0, 0, 457, 613, 552, 0, 312, 0, 954, 792,
+  931, 0, 0, 0, 0, 103, 250, 294, 885, 0, 0, 20, 664, 45, 0, 382,
+  540, 978, 806, 0, 0, 0, 0, 0, 0, 0, 0, 0, 145, 277, 983, 0,
+  0, 172, 700, 0, 0, 0, 0, 0, 0, 0, 77, 5, 10, 12, 180, 0,
+  960, 0, 0, 197, 163, 222, 518, 0, 455, 0, 0, 653, 0, 300, 783, 188,
+  617, 186, 449, 820, 0, 0, 0, 607, 481, 580, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 638, 616, 0, 0, 0, 979, 936, 0, 0, 0,
+  555, 763, 0, 0, 787, 564, 0, 218, 512, 905, 378, 98, 0, 0, 181, 0,
+  756, 0, 0, 0, 0, 523, 477, 198, 791, 0, 120, 0, 0, 738, 0, 0,
+  0, 536, 0, 697, 741, 0, 0, 0, 68, 350, 684, 0, 95, 439, 484, 413,
+  436, 995, 0, 0, 0, 0, 0, 0, 258, 55, 531, 0, 0, 99, 0, 362,
+  0, 0, 0, 199, 304, 341, 0, 0, 599, 237, 140, 102, 229, 0, 0, 0,
+  784, 92, 387, 460, 504, 124, 780, 900, 164, 61, 0, 750, 292, 745, 862, 226,
+  0, 0, 0, 187, 0, 570, 618, 765, 0, 278, 331, 139, 233, 496, 0, 23,
+  189, 0, 63, 376, 0, 11, 326, 480, 437, 81, 337, 766, 811, 631, 262, 704,
+  847, 982, 357, 0, 0, 0, 0, 728, 0, 621, 0, 0, 0, 85, 110, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 165, 432, 0, 0,
+  661, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 0, 0, 809, 0, 968,
+  0, 0, 0, 397, 0, 0, 0, 713, 0, 0, 753, 118, 815, 0, 435, 758,
+  0, 0, 0, 0, 410, 251, 794, 0, 217, 937, 0, 0, 760, 316, 0, 0,
+  0, 78, 539, 361, 551, 38, 50, 632, 642, 870, 882, 952, 0, 123, 823, 699,
+  0, 802, 22, 550, 0, 0, 0, 14, 0, 0, 206, 305, 605, 799, 0, 0,
+  0, 749, 0, 142, 0, 0, 0, 707, 0, 0, 894, 572, 670, 0, 0, 0,
+  0, 0, 0, 0, 0, 192, 893, 0, 0, 0, 581, 0, 506, 0, 0, 446,
+  0, 0, 0, 0, 0, 311, 0, 866, 0, 0, 675, 494, 830, 0, 532, 0,
+  0, 159, 0, 0, 0, 0, 257, 669, 0, 0, 0, 725, 563, 302, 428, 399,
+  574, 70, 731, 810, 939, 0, 623, 0, 691, 834, 886, 0, 0, 946, 0, 0,
+  975, 391, 0, 345, 915, 0, 0, 0, 0, 325, 856, 0, 0, 0, 0, 0,
+  522, 0, 0, 201, 0, 52, 485, 150, 463, 696, 0, 835, 0, 284, 876, 173,
+  438, 947, 998, 736, 515, 0, 0, 0, 0, 160, 0, 195, 528, 768, 773, 785,
+  926, 0, 0, 453, 647, 803, 951, 848, 355, 897, 789, 692, 908, 0, 0, 0,
+  0, 628, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 855, 135, 106,
+  342, 622, 0, 864, 0, 0, 0, 0, 0, 0, 0, 427, 0, 0, 637, 0,
+  0, 54, 770, 681, 465, 963, 0, 13, 777, 569, 634, 889, 0, 0, 0, 0,
+  0, 0, 209, 0, 0, 0, 0, 646, 764, 66, 87, 83, 126, 308, 838, 269,
+  0, 0, 0, 268, 659, 775, 805, 0, 0, 0, 0, 0, 840, 0, 925, 679,
+  687, 769, 0, 0, 0, 0, 0, 0, 596, 0, 0, 614, 945, 639, 0, 366,
+  0, 0, 0, 610, 0, 0, 149, 0, 0, 408, 0, 0, 0, 0, 40, 0,
+  909, 0, 819, 0, 0, 0, 970, 786, 0, 272, 0, 80, 112, 143, 711, 0,
+  0, 0, 0, 940, 368, 0, 392, 662, 328, 409, 470, 358, 629, 360, 649, 113,
+  117, 578, 730, 929, 487, 0, 0, 0, 746, 0, 0, 375, 400, 412, 495, 865,
+  0, 0, 0, 0, 742, 606, 381, 733, 0, 0, 0, 0, 42, 252, 207, 210,
+  0, 241, 511, 561, 812, 703, 0, 658, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 215, 845, 612, 256, 0, 0, 0, 0, 178, 0, 0, 293, 411, 0,
+  0, 0, 755, 168, 0, 0, 0, 0, 4, 323, 0, 0, 0, 0, 0, 0,
+  390, 797, 0, 348, 0, 533, 0, 695, 721, 31, 956, 993, 595, 0, 0, 509,
+  0, 0, 0, 0, 101, 0, 817, 0, 0, 0, 0, 0, 183, 737, 962, 0,
+  0, 0, 167, 0, 0, 0, 0, 426, 0, 0, 0, 0, 0, 190, 891, 0,
+  0, 0, 735, 0, 0, 0, 0, 582, 0, 0, 0, 498, 849, 0, 955, 204,
+  406, 922, 0, 914, 247, 0, 0, 0, 352, 0, 584, 705, 0, 0, 859, 754,
+  871, 723, 0, 668, 452, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  227, 543, 467, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 547,
+  0, 0, 0, 0, 710, 604, 0, 0, 0, 0, 877, 44, 493, 624, 0, 0,
+  0, 72, 0, 231, 317, 0, 0, 0, 0, 0, 0, 527, 0, 274, 0, 0,
+  153, 826, 657, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 394, 405,
+  0, 0, 0, 676, 0, 0, 0, 0, 0, 0, 0, 920, 0, 0, 0, 0,
+  0, 0, 88, 0, 0, 0, 18, 761, 825, 921, 0, 0, 174, 0, 0, 0,
+  0, 0, 0, 0, 309, 0, 807, 301, 526, 537, 16, 0, 0, 0, 249, 800,
+};
+
+const char *WA_FREQ_63_TOKENS[] = {
+  "է",
+  "և",
+  "են",
+  "որ",
+  "ու",
+  "էր",
+  "համար",
+  "իր",
+  "մի",
+  "եւ",
+  "այն",
+  "էլ",
+  "այդ",
+  "հետ",
+  "չի",
+  "թե",
+  "կարող",
+  "ոչ",
+  "այս",
+  "պետք",
+  "նաև",
+  "կամ",
+  "ավելի",
+  "մասին",
+  "այլ",
+  "եմ",
+  "մեջ",
+  "շատ",
+  "իսկ",
+  "որը",
+  "մեր",
+  "հետո",
+  "միայն",
+  "Հայաստանի",
+  "նրա",
+  "Այս",
+  "քանի",
+  "իրենց",
+  "վրա",
+  "ինչպես",
+  "թվականի",
+  "ենք",
+  "ինչ",
+  "մեծ",
+  "ժամանակ",
+  "մեկ",
+  "նա",
+  "որոնք",
+  "ՀՀ",
+  "է։",
+  "էին",
+  "ես",
+  "ընթացքում",
+  "բոլոր",
+  "բայց",
+  "կողմից",
+  "երբ",
+  "նոր",
+  "չեն",
+  "եթե",
+  "որպես",
+  "դա",
+  "անգամ",
+  "համար։",
+  "առաջին",
+  "չէ",
+  "ունի",
+  "արդեն",
+  "քաղաքական",
+  "դեպքում",
+  "ամեն",
+  "մոտ",
+  "պետական",
+  "մենք",
+  "նման",
+  "երկու",
+  "2",
+  "նրանց",
+  "մարդ։",
+  "դեմ",
+  "տարի",
+  "բան",
+  "սակայն",
+  "Իսկ",
+  "եղել",
+  "բնակվում",
+  "որի",
+  "տեղի",
+  "նաեւ",
+  "Նա",
+  "շուրջ",
+  "տվյալներով",
+  "միջազգային",
+  "քան",
+  "3",
+  "անհրաժեշտ",
+  "հայ",
+  "լավ",
+  "1",
+  "ապա",
+  "Եվ",
+  "իմ",
+  "առաջ",
+  "վերջին",
+  "ասել",
+  "կարելի",
+  "Այդ",
+  "եք",
+  "ինձ",
+  "Բայց",
+  "Հայաստանում",
+  "նրան",
+  "է.",
+  "են։",
+  "Եթե",
+  "ի",
+  "2001",
+  "մինչև",
+  "ազգային",
+  "Այն",
+  "դեռ",
+  "գյուղում",
+  "այսօր",
+  "տարբեր",
+  "առանց",
+  "դուրս",
+  "մեզ",
+  "ասում",
+  "մարդ",
+  "տալիս",
+  "տնտեսական",
+  "օրվա",
+  "4",
+  "դրա",
+  "հնարավոր",
+  "երկրի",
+  "կազմում",
+  "նրանք",
+  "որտեղ",
+  "օր",
+  "5",
+  "ով",
+  "լինի",
+  "ամբողջական",
+  "Ես",
+  "հենց",
+  "հայտնի",
+  "նույն",
+  "կատարում",
+  "Սակայն",
+  "թ.",
+  "մարդիկ",
+  "հետ։",
+  "մարդկանց",
+  "ձեր",
+  "հայկական",
+  "Սերժ",
+  "ընդհանուր",
+  "10",
+  "հիմնական",
+  "տարվա",
+  "ունեցել",
+  "ըստ",
+  "նկատմամբ",
+  "Հանրապետության",
+  "վրա։",
+  "որն",
+  "գտնվում",
+  "ասաց",
+  "չեմ",
+  "որպեսզի",
+  "աշխարհի",
+  "գլխավոր",
+  "նախագահ",
+  "հունվարի",
+  "Ինչպես",
+  "կա",
+  "չէր",
+  "6",
+  "ուզում",
+  "մեկը",
+  "ունեցող",
+  "պատճառով",
+  "հատուկ",
+  "Ռուսաստանի",
+  "այնպես",
+  "իրեն",
+  "մարդու",
+  "է՝",
+  "զարգացման",
+  "Արեգակի",
+  "երկրային",
+  "կապված",
+  "որոնց",
+  "նշել",
+  "պտույտ",
+  "դրանք",
+  "միջինում",
+  "արագությամբ։",
+  "որևէ",
+  "ուղեծրով",
+  "ունեն",
+  "աստիճան/օր",
+  "կառավարության",
+  "2015",
+  "դրանց",
+  "լինել",
+  "գալիս",
+  "շարք",
+  "ովքեր",
+  "վերաբերյալ",
+  "բարձր",
+  "թվականին",
+  "ին",
+  "այնքան",
+  "Ըստ",
+  "հայտարարել",
+  "միջև",
+  "համապատասխան",
+  "միջոցով",
+  "քիչ",
+  "ամբողջ",
+  "Connection",
+  "close",
+  "երկրների",
+  "միշտ",
+  "պիտի",
+  "Մի",
+  "սա",
+  "լինելու",
+  "Մենք",
+  "կարծում",
+  "նախատեսված",
+  "Հայաստանը",
+  "Երևանի",
+  "հիմա",
+  "Այսօր",
+  "որոշ",
+  "կարևոր",
+  "ցույց",
+  "կան",
+  "կյանքի",
+  "երեք",
+  "մասին։",
+  "շարժվելով",
+  "թույլ",
+  "հազար",
+  "Ձեր",
+  "թվում",
+  "Նրա",
+  "Սա",
+  "7",
+  "կլինի",
+  "ինչ-որ",
+  "ճիշտ",
+  "մասը",
+  "նույնիսկ",
+  "ձեզ",
+  "սոցիալական",
+  "օրը",
+  "Սարգսյանը",
+  "հայտնել",
+  "մյուս",
+  "նախկին",
+  "անում",
+  "Դա",
+  "փոքր",
+  "նշանակում",
+  "շրջանում",
+  "սահմանված",
+  "բազմաթիվ",
+  "ևս",
+  "երկրորդ",
+  "մեջ։",
+  "ազատ",
+  "1.",
+  "տակ",
+  "նույնպես",
+  "Մեր",
+  "20",
+  "լուրջ",
+  "պարզ",
+  "հանդես",
+  "անդամ",
+  "մասնակցել",
+  "ցանկացած",
+  "դարձել",
+  "2.",
+  "Նրանք",
+  "արտաքին",
+  "սեփական",
+  "տվել",
+  "ինչը",
+  "մլն",
+  "ի՞նչ",
+  "եկել",
+  "տեղ",
+  "ժողովրդի",
+  "ա",
+  "աշխատանքի",
+  "Թուրքիայի",
+  "դեպի",
+  "Ադրբեջանի",
+  "2014",
+  "ձեռք",
+  "տարեկան",
+  "գրում",
+  "ներկայացնում",
+  "8",
+  "այստեղ",
+  "գործում",
+  "հաճախ",
+  "յուրաքանչյուր",
+  "ողջ",
+  "նախագահի",
+  "Բոլոր",
+  "Սարգսյանի",
+  "ԱՄՆ",
+  "գործունեության",
+  "պաշտպանության",
+  "համաձայն",
+  "փորձում",
+  "հնարավորություն",
+  "քո",
+  "չենք",
+  "խմբի",
+  "ինքը",
+  "Տիգրան",
+  "ցանկանում",
+  "լավագույն",
+  "Հայ",
+  "ստացել",
+  "Երբ",
+  "հայտնում",
+  "չկա",
+  "հասարակական",
+  "առավել",
+  "անել",
+  "Ի",
+  "Աստղագուշակ",
+  "իրար",
+  "այդպես",
+  "23",
+  "էի",
+  "հատկապես",
+  "քեզ",
+  "դուք",
+  "պատրաստ",
+  "էր։",
+  "օգտվելու",
+  "արդյունքում",
+  "երկրում",
+  "որեւէ",
+  "ընդամենը",
+  "լինում",
+  "12",
+  "երկար",
+  "15",
+  "պետության",
+  "պաշտոնական",
+  "համարում",
+  "վերաբերում",
+  "Jan",
+  "Հայկական",
+  "այնպիսի",
+  "դառնում",
+  "առկա",
+  "Content-Length",
+  "NET",
+  "կատարել",
+  "պահին",
+  "հետևյալ",
+  "օրենքի",
+  "11",
+  "GMT",
+  "սկսել",
+  "բաց",
+  "իրենք",
+  "Հայտնաբերվել",
+  "հասարակության",
+  "համակարգի",
+  "Date",
+  "որոշակի",
+  "նշեց",
+  "ուղղված",
+  "Ամեն",
+  "գրել",
+  "անվտանգության",
+  "այժմ",
+  "գտնվող",
+  "կերպ",
+  "դատարանի",
+  "առանձին",
+  "հարցը",
+  "իրավունքների",
+  "քրեական",
+  "ներքին",
+  "քաղաքի",
+  "անց",
+  "ռուսական",
+  "շարունակում",
+  "Ազգային",
+  "3.",
+  "դեկտեմբերի",
+  "անձանց",
+  "իշխանության",
+  "Նոր",
+  "ում",
+  "Ծառայությունից",
+  "Մեծ",
+  "գաղտնագիր",
+  "ծանր",
+  "աշխատում",
+  "ներկայացրել",
+  "հարաբերությունների",
+  "տալ",
+  "9",
+  "հիմնականում",
+  "2010",
+  "աշխատանքային",
+  "չունի",
+  "տեսնում",
+  "օրինակ",
+  "համայնքի",
+  "որում",
+  "համաշխարհային",
+  "Ու",
+  "30",
+  "դու",
+  "դժվար",
+  "Հայաստան",
+  "անկախ",
+  "տվյալ",
+  "որոշում",
+  "սույն",
+  "պատմության",
+  "որովհետև",
+  "իրավունք",
+  "ծառայության",
+  "համարվում",
+  "կողմից։",
+  "Բացի",
+  "ժամը",
+  "մինչեւ",
+  "դրամ",
+  "մեկն",
+  "անվան",
+  "2013",
+  "բնական",
+  "22",
+  "հերթին",
+  "ռազմական",
+  "արել",
+  "Հայոց",
+  "Ղարաբաղի",
+  "Ինչ",
+  "բերել",
+  "Ընդհանուր",
+  "տարիներին",
+  "մնում",
+  "Առաջին",
+  "ինքն",
+  "ֆինանսական",
+  "ունեցած",
+  "նշված",
+  "կառավարման",
+  "նպատակով",
+  "2011",
+  "ունենում",
+  "ընտանիքի",
+  "չէ։",
+  "ինչի",
+  "գրեթե",
+  "համագործակցության",
+  "խոսում",
+  "գործող",
+  "նշում",
+  "գնում",
+  "իրավական",
+  "դատական",
+  "ծրագրի",
+  "որքան",
+  "մշակութային",
+  "այնտեղ",
+  "որին",
+  "որովհետեւ",
+  "սիրում",
+  "հարցում",
+  "Իր",
+  "խոշոր",
+  "ապրում",
+  "կարողանում",
+  "հարթությունը",
+  "համատեղ",
+  "պարզապես",
+  "հաշվի",
+  "կազմակերպության",
+  "գիտական",
+  "այսպես",
+  "դեպ",
+  "խնդիր",
+  "մարզի",
+  "շնորհիվ",
+  "աշխատել",
+  "միլիոն",
+  "այլև",
+  "հարց",
+  "ԱԺ",
+  "հաջորդ",
+  "խորհրդի",
+  "վատ",
+  "երբեք",
+  "կարգով",
+  "բացի",
+  "առումով",
+  "աշխարհում",
+  "պայմաններում",
+  "որոշել",
+  "«Ես",
+  "Երևանում",
+  "կրկին",
+  "իրական",
+  "մարտի",
+  "տարածքում",
+  "կառավարությունը",
+  "ոք",
+  "նախարար",
+  "իշխանությունները",
+  "այլն։",
+  "խիստ",
+  "ունենալ",
+  "քաղաքականության",
+  "ոչինչ",
+  "տան",
+  "եվրոպական",
+  "Ոչ",
+  "միջին",
+  "Ի՞նչ",
+  "մեկի",
+  "ստեղծել",
+  "ընկերության",
+  "հիման",
+  "դիմել",
+  "խնդիրը",
+  "Դուք",
+  "Երևան",
+  "հոդվածի",
+  "մարդը",
+  "քաղաքացիական",
+  "բժշկական",
+  "հասկանում",
+  "18",
+  "երեխաների",
+  "իհարկե",
+  "մայիսի",
+  "25",
+  "ղեկավար",
+  "անձնական",
+  "սկսում",
+  "կրթության",
+  "Հիմա",
+  "դրական",
+  "օրենքով",
+  "24",
+  "Շատ",
+  "14",
+  "1-ին",
+  "ամիս",
+  "գործել",
+  "Հիշեցնենք",
+  "նախարարության",
+  "խոսել",
+  "ընդունել",
+  "ինչու",
+  "մինչ",
+  "մարմնի",
+  "ուղղակի",
+  "բավական",
+  "դարձավ",
+  "միասին",
+  "թիվ",
+  "ուր",
+  "թե՛",
+  "հերթական",
+  "արագ",
+  "պատերազմի",
+  "պայմանավորված",
+  "13",
+  "վաղ",
+  "հստակ",
+  "հաղորդում",
+  "է»",
+  "բնակչության",
+  "արդյունավետ",
+  "ուժերի",
+  "պատրաստվում",
+  "բնակչությունը",
+  "կատարվում",
+  "Վրաստանի",
+  "16",
+  "խաղաղ",
+  "ստանալու",
+  "թիվը",
+  "բավականին",
+  "կախված",
+  "տեսանյութ",
+  "Իրանի",
+  "հին",
+  "մասին»",
+  "որից",
+  "շրջանակներում",
+  "միակ",
+  "հարցերի",
+  "հետաքրքիր",
+  "ոլորտում",
+  "ամենը",
+  "նախորդ",
+  "տնտեսության",
+  "գեղեցիկ",
+  "գործ",
+  "երիտասարդ",
+  "գոյություն",
+  "կուսակցության",
+  "տարածքի",
+  "կոչ",
+  "նախագահը",
+  "2012",
+  "դիմաց",
+  "ստիպված",
+  "հայերի",
+  "ներկա",
+  "ԱՄՆ-ի",
+  "պարտադիր",
+  "տարիների",
+  "մտնում",
+  "Արմեն",
+  "անունը",
+  "խնդիրներ",
+  "ստանում",
+  "ուրիշ",
+  "Գլխավոր",
+  "հոկտեմբերի",
+  "քաղաքում",
+  "ունենք",
+  "հանձնաժողովի",
+  "շենքի",
+  "թե՞",
+  "ակտիվ",
+  "անձի",
+  "Ռուսաստանը",
+  "Սուրբ",
+  "մասնագիտական",
+  "վարչական",
+  "հայտնվել",
+  "Դրա",
+  "Ուկրաինայի",
+  "պատասխան",
+  "դարի",
+  "կնոջ",
+  "էինք",
+  "միության",
+  "միջոցների",
+  "գործի",
+  "երկրներում",
+  "ուժի",
+  "կանանց",
+  "պես",
+  "դեպքերում",
+  "փոխարեն",
+  "ԼՂՀ",
+  "Ձեզ",
+  "երեկ",
+  "ուսումնական",
+  "եւս",
+  "Եվրոպայի",
+  "խաղում",
+  "արդյոք",
+  "վերաբերել՝",
+  "պատմական",
+  "վարչապետ",
+  "ավելին",
+  "պահանջում",
+  "անցել",
+  "երրորդ",
+  "խնդիրների",
+  "տեղական",
+  "չպետք",
+  "ուղղությամբ",
+  "լինեն",
+  "կատարելու",
+  "հետևանքով",
+  "հավաքականի",
+  "հանդեպ",
+  "իրականացնում",
+  "կարեւոր",
+  "2-րդ",
+  "իշխանությունների",
+  "Իմ",
+  "սեպտեմբերի",
+  "դրանից",
+  "կյանքը",
+  "ունենալու",
+  "երկիրը",
+  "նախկինում",
+  "դոլար",
+  "4.",
+  "տարին",
+  "կապ",
+  "Հոդված",
+  "նորից",
+  "Թուրքիան",
+  "Այստեղ",
+  "նվիրված",
+  "Արցախի",
+  "տեղեկացնում",
+  "Ա.",
+  "մշակույթի",
+  "100",
+  "օրերին",
+  "Պետք",
+  "որով",
+  "իրավունքները",
+  "հասանելի",
+  "հանդիպում",
+  "կազմել",
+  "կյանքում",
+  "պատկանում",
+  "տրվում",
+  "գործը",
+  "ներկայացված",
+  "ՌԴ",
+  "ոստիկանության",
+  "գազի",
+  "հանդիպման",
+  "օգտագործել",
+  "մամուլի",
+  "Ավելի",
+  "շաբաթ",
+  "թուրքական",
+  "Արթուր",
+  "վիճակում",
+  "Ֆրանսիայի",
+  "դեռևս",
+  "են՝",
+  "մասի",
+  "Այսինքն",
+  "Նշենք",
+  "չորս",
+  "17",
+  "էջ",
+  "Ռոբերտ",
+  "ուշ",
+  "կողմ",
+  "այդքան",
+  "գործողությունների",
+  "կարգավորման",
+  "նոյեմբերի",
+  "թող",
+  "համալսարանի",
+  "այսօրվա",
+  "պայքարի",
+  "ուներ",
+  "հետագա",
+  "ապրիլի",
+  "X-Powered-By",
+  "ուժեղ",
+  "ժամ",
+  "ժամանակ։",
+  "ամերիկյան",
+  "ժամանակակից",
+  "բոլորը",
+  "երկիր",
+  "Fri",
+  "եկեղեցու",
+  "նշանակություն",
+  "կարծիքով",
+  "մլրդ",
+  "խնդրի",
+  "կոչվում",
+  "հետագայում",
+  "անմիջապես",
+  "մարդկային",
+  "մասնավորապես",
+  "մասնակցում",
+  "Վերջին",
+  "Ընդ",
+  "հասել",
+  "կոնկրետ",
+  "տուն",
+  "չէին",
+  "«Մենք",
+  "անցնում",
+  "կազմակերպությունների",
+  "կարծես",
+  "սպասում",
+  "Չնայած",
+  "կմ",
+  "իրականում",
+  "Գագիկ",
+  "վեր",
+  "ստացվել",
+  "Սարգսյանն",
+  "ազատության",
+  "Կարդալ",
+  "շուտ",
+  "մտածում",
+  "Նման",
+  "անելու",
+  "ընդհանրապես",
+  "Արամ",
+  "Լեռնային",
+  "գոնե",
+  "լայն",
+  "երեխայի",
+  "դառնալ",
+  "իրականացման",
+  "չնայած",
+  "դպրոցի",
+  "խոսքով",
+  "ծրագրերի",
+  "ջրի",
+  "իրավունքի",
+  "հարաբերությունները",
+  "տեսակի",
+  "մնացել",
+  "հարցի",
+  "Ադրբեջանը",
+  "Գյումրիի",
+  "երբեմն",
+  "հակամարտության",
+  "հայոց",
+  "մարդահամարի",
+  "կարիք",
+  "նա։",
+  "այլևս",
+  "խնդիրները",
+  "օգտագործման",
+  "հասնել",
+  "և՛",
+  "իրականացնել",
+  "հանդիսանում",
+  "խոսքը",
+  "իսկապես",
+  "շրջանի",
+  "տեղափոխվել",
+  "հարցին",
+  "բարդ",
+  "ինչո՞ւ",
+  "ընտրությունների",
+  "առնվազն",
+  "առջև",
+  "Ավելին",
+  "գյուղի",
+  "հանրային",
+  "Հայտնի",
+  "առաջարկում",
+  "մասնակցելու",
+  "ներկայացնել",
+  "որոնցից",
+  "բարձրագույն",
+  "իշխանությունը",
+  "կրում",
+  "տեխնիկական",
+  "վիճակը",
+  "Ինձ",
+  "Նրանց",
+  "բերում",
+  "ո՛չ",
+  "վիճակի",
+  "կանայք",
+  "համակարգը",
+  "հոգի",
+  "21",
+  "ապրել",
+  "գրանցվել",
+  "մարմինների",
+  "օգտագործվում",
+  "այդպիսի",
+  "խորհուրդ",
+  "ժողովուրդը",
+  "գյուղական",
+  "փոքրիկ",
+  "տեղը",
+  "կը",
+  "ենթակա",
+  "աշխատանքների",
+  "իրավիճակը",
+  "ստեղծվել",
+  "ձևով",
+  "ֆիզիկական",
+  "պատգամավոր",
+  "ահա",
+  "ընկերությունը",
+  "տալու",
+  "տարածությունը",
+  "որոշման",
+  "աշխատանք",
+  "կմ²",
+  "5.",
+  "Վարդան",
+  "որոշումը",
+  "պակաս",
+  "մակերեսը",
+  "Երեւանի",
+  "գալ",
+  "կրթական",
+  "հինգ",
+  "միաժամանակ",
+  "տեսել",
+  "Թե",
+  "ծնվել",
+  "էս",
+  "հեռու",
+  "վտանգավոր",
+  "թթ",
+  "2014թ",
+  "Ս.",
+  "ծրագիրը",
+  "Հայաստանից",
+  "ընդունում",
+  "պետությունների",
+  "Ահա",
+  "ադրբեջանական",
+  "Գյումրիում",
+  "փոփոխություններ",
+  "անցած",
+  "գործով",
+  "ծառայությունների",
+  "Կենտրոնական",
+  "պատճառը",
+  "կենտրոնում",
+  "արդյունքներով",
+  "կատարվել",
+  "միմյանց",
+  "էդ",
+  "ստեղծված",
+  "մարզիչ",
+  "Աստված",
+  "գտնում",
+  "լրացուցիչ",
+  "19",
+  "գտնել",
+  "ասած",
+  "Լևոն",
+  "մշտապես",
+  "կանգնած",
+  "շնորհակալություն",
+  "առ",
+  "կարգի",
+  "իրականացվում",
+  "հանրապետության",
+  "Կարեն",
+  "մնալ",
+  "Կարծում",
+  "լեզվի",
+  "աշխատանքը",
+  "տվյալներով)։",
+  "Այժմ",
+  "ենթարկվել",
+  "զգում",
+  "տնօրեն",
+  "աշխատանքները",
+  "քաղաքացիների",
+  "50",
+  "հեշտ",
+  "հույս",
+  "ընտրական",
+  "Իհարկե",
+  "փետրվարի",
+  "սկսած",
+  "նորմալ",
+  "մշտական",
+  "դրան",
+  "կատարված",
+  "միջոցով։",
+  "օգոստոսի",
+  "ճանաչում",
+  "մեկին",
+  "ցեղասպանության",
+  "հարուստ",
+  "Վաճառվում",
+  "պայքարում",
+  "Հենց",
+  "հաստատել",
+  "Մեկ",
+  "ցածր",
+  "ՀՀԿ",
+  "պարագայում",
+  "տվեց",
+  "նշվում",
+  "կատարման",
+  "ուրեմն",
+  "ժամանակի",
+  "ոլորտի",
+  "հրապարակել",
+  "տեղում",
+  "զբաղվում",
+  "կենտրոնական",
+  "օգտակար",
+  "լույս",
+};
+const uint16_t WA_FREQ_63_RANKS[] = {
+  70, 658, 0, 548, 0, 0, 0, 0, 116, 950, 0, 0, 0, 0, 30, 0,
+  237, 0, 0, 0, 23, 0, 104, 0, 876, 667, 900, 914, 187, 381, 399, 718,
+  789, 424, 565, 791, 849, 0, 0, 411, 0, 0, 490, 0, 0, 34, 0, 147,
+  0, 0, 366, 0, 0, 49, 304, 680, 772, 0, 0, 169, 363, 0, 571, 93,
+  637, 807, 830, 491, 0, 350, 0, 0, 282, 0, 0, 0, 265, 883, 442, 584,
+  0, 0, 437, 0, 0, 0, 0, 0, 0, 507, 0, 691, 0, 252, 735, 180,
+  0, 0, 739, 0, 64, 0, 0, 854, 364, 459, 0, 0, 0, 929, 0, 177,
+  461, 761, 812, 0, 0, 848, 956, 0, 0, 0, 0, 259, 0, 0, 782, 0,
+  705, 771, 853, 0, 200, 0, 0, 344, 628, 723, 198, 0, 773, 75, 894, 0,
+  866, 0, 829, 90, 0, 0, 0, 241, 485, 0, 622, 91, 222, 0, 0, 214,
+  331, 930, 0, 5, 0, 0, 609, 415, 10, 677, 0, 0, 0, 268, 0, 499,
+  0, 454, 0, 0, 105, 1, 768, 763, 881, 913, 174, 0, 110, 125, 291, 419,
+  477, 0, 353, 0, 0, 0, 0, 0, 132, 261, 587, 0, 297, 0, 0, 656,
+  0, 267, 403, 660, 770, 623, 990, 744, 0, 0, 0, 0, 931, 135, 0, 0,
+  0, 0, 627, 754, 809, 0, 0, 551, 0, 0, 0, 0, 635, 0, 0, 0,
+  206, 0, 223, 0, 0, 803, 0, 82, 703, 0, 0, 0, 0, 283, 0, 0,
+  0, 0, 678, 0, 0, 538, 316, 510, 581, 746, 909, 751, 0, 220, 88, 81,
+  402, 639, 804, 0, 707, 0, 0, 0, 0, 827, 0, 0, 0, 0, 0, 0,
+  0, 585, 0, 0, 201, 514, 0, 481, 0, 712, 878, 197, 191, 0, 0, 0,
+  0, 0, 0, 0, 190, 0, 0, 1000, 0, 0, 0, 84, 478, 244, 0, 0,
+  629, 0, 59, 111, 482, 749, 971, 383, 380, 983, 0, 0, 0, 0, 810, 379,
+  916, 0, 0, 0, 447, 277, 603, 778, 0, 0, 0, 0, 0, 0, 814, 977,
+  52, 94, 589, 254, 590, 650, 811, 860, 131, 0, 0, 0, 103, 952, 0, 0,
+  0, 921, 955, 0, 903, 0, 0, 0, 0, 897, 0, 0, 0, 683, 685, 0,
+  555, 0, 0, 641, 725, 726, 758, 13, 0, 126, 0, 0, 31, 0, 615, 995,
+  0, 621, 184, 0, 0, 902, 469, 964, 0, 0, 0, 0, 0, 300, 390, 500,
+  0, 0, 62, 0, 0, 0, 0, 0, 0, 0, 0, 0, 834, 653, 0, 0,
+  240, 979, 0, 186, 159, 253, 374, 799, 0, 0, 0, 0, 0, 0, 0, 0,
+  508, 421, 0, 980, 455, 0, 215, 0, 729, 0, 954, 0, 0, 647, 250, 563,
+  0, 145, 856, 992, 0, 137, 409, 0, 260, 488, 687, 501, 762, 58, 209, 655,
+  780, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 121, 460, 645, 516, 845,
+  0, 0, 0, 0, 0, 279, 273, 67, 397, 175, 610, 298, 631, 349, 537, 540,
+  367, 634, 593, 793, 911, 0, 0, 0, 310, 0, 0, 0, 0, 97, 345, 446,
+  435, 416, 505, 43, 0, 0, 0, 0, 0, 33, 0, 915, 0, 0, 272, 0,
+  0, 0, 0, 0, 0, 0, 0, 825, 230, 42, 400, 467, 0, 0, 0, 0,
+  0, 0, 0, 334, 0, 60, 0, 0, 0, 0, 0, 874, 0, 0, 0, 0,
+  37, 284, 0, 0, 192, 0, 0, 0, 0, 871, 0, 392, 844, 0, 0, 0,
+  833, 130, 0, 0, 0, 0, 0, 0, 706, 46, 0, 0, 0, 232, 969, 0,
+  0, 535, 486, 0, 0, 0, 0, 156, 0, 522, 0, 0, 0, 843, 769, 0,
+  0, 0, 0, 948, 0, 0, 0, 0, 0, 312, 0, 999, 371, 606, 620, 625,
+  0, 0, 0, 0, 945, 335, 0, 0, 0, 319, 211, 943, 0, 0, 134, 0,
+  0, 0, 904, 935, 242, 572, 327, 0, 709, 0, 7, 292, 0, 0, 0, 0,
+  0, 864, 539, 797, 0, 0, 0, 0, 0, 0, 0, 308, 0, 0, 0, 79,
+  595, 686, 651, 0, 343, 462, 933, 781, 0, 0, 0, 745, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 557, 317, 0, 0, 0, 892, 887, 694, 974, 0, 0,
+  515, 0, 202, 243, 76, 328, 818, 938, 0, 0, 0, 0, 0, 142, 534, 961,
+  0, 0, 0, 0, 0, 0, 155, 299, 573, 730, 800, 852, 0, 289, 907, 74,
+  0, 0, 0, 0, 0, 0, 0, 865, 100, 162, 290, 0, 0, 0, 0, 0,
+  747, 0, 0, 407, 0, 0, 0, 862, 29, 0, 0, 0, 492, 274, 296, 559,
+  614, 644, 741, 863, 0, 0, 0, 0, 248, 0, 0, 0, 602, 0, 32, 0,
+  837, 0, 0, 53, 168, 219, 0, 0, 0, 119, 0, 0, 494, 0, 181, 418,
+  370, 823, 0, 0, 0, 786, 0, 520, 998, 556, 826, 428, 937, 0, 0, 0,
+  0, 0, 221, 0, 0, 0, 917, 0, 967, 0, 56, 855, 280, 0, 269, 0,
+  0, 0, 783, 787, 0, 2, 306, 665, 0, 212, 475, 133, 452, 395, 256, 0,
+  0, 817, 0, 393, 210, 362, 28, 527, 0, 662, 0, 0, 668, 0, 61, 0,
+  0, 0, 0, 523, 947, 0, 0, 0, 0, 0, 805, 0, 717, 0, 0, 689,
+  554, 15, 568, 0, 0, 0, 0, 0, 0, 0, 196, 0, 0, 0, 0, 0,
+  4, 0, 0, 784, 0, 681, 0, 962, 0, 311, 361, 0, 12, 0, 226, 794,
+  0, 605, 0, 0, 532, 0, 546, 598, 0, 0, 183, 879, 484, 0, 0, 0,
+  813, 0, 0, 128, 0, 170, 0, 0, 120, 333, 966, 391, 895, 0, 0, 0,
+  480, 140, 150, 0, 0, 0, 0, 742, 674, 163, 382, 0, 24, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 356, 0, 108, 0, 521, 0, 0, 0, 0, 89,
+  503, 560, 666, 487, 868, 0, 0, 251, 19, 112, 307, 509, 776, 95, 0, 0,
+  270, 840, 0, 0, 558, 654, 0, 122, 199, 325, 0, 0, 0, 182, 9, 139,
+  0, 824, 213, 612, 981, 458, 792, 939, 569, 858, 0, 0, 0, 592, 0, 842,
+  148, 973, 0, 0, 40, 0, 0, 0, 0, 0, 0, 149, 278, 0, 716, 0,
+  570, 471, 0, 0, 218, 249, 276, 779, 679, 737, 987, 0, 0, 0, 0, 0,
+  0, 0, 154, 422, 0, 0, 0, 476, 14, 0, 0, 0, 189, 0, 910, 434,
+  633, 753, 767, 0, 315, 0, 0, 0, 0, 0, 0, 0, 8, 358, 483, 0,
+  574, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 355, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 451, 0,
+  0, 0, 457, 0, 0, 669, 376, 0, 0, 0, 0, 890, 986, 438, 672, 171,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 861, 934, 336, 940, 426, 39,
+  489, 0, 0, 0, 0, 394, 985, 0, 123, 332, 413, 36, 321, 552, 0, 0,
+  690, 239, 0, 815, 0, 0, 0, 0, 531, 194, 882, 0, 0, 109, 0, 0,
+  92, 936, 958, 759, 0, 617, 649, 0, 0, 179, 0, 724, 113, 0, 0, 0,
+  86, 0, 640, 195, 0, 357, 575, 207, 432, 0, 0, 847, 0, 0, 0, 0,
+  0, 919, 562, 138, 822, 0, 0, 0, 0, 0, 0, 63, 389, 893, 922, 960,
+  0, 0, 205, 0, 583, 247, 365, 0, 0, 646, 0, 27, 0, 0, 831, 738,
+  0, 217, 0, 0, 594, 578, 287, 872, 542, 0, 836, 17, 441, 630, 0, 0,
+  158, 0, 0, 0, 0, 0, 0, 54, 0, 473, 671, 0, 788, 790, 0, 0,
+  0, 0, 0, 0, 953, 713, 152, 731, 0, 0, 0, 0, 0, 0, 0, 608,
+  72, 684, 429, 427, 41, 498, 524, 642, 766, 975, 0, 711, 0, 0, 905, 326,
+  417, 285, 626, 692, 777, 564, 928, 0, 0, 732, 0, 368, 0, 0, 495, 0,
+  0, 0, 0, 0, 611, 236, 719, 346, 341, 0, 146, 255, 258, 638, 701, 720,
+  946, 841, 404, 965, 0, 743, 0, 0, 68, 193, 144, 0, 704, 0, 530, 77,
+  0, 0, 926, 0, 337, 513, 453, 580, 695, 733, 984, 433, 0, 0, 821, 0,
+  0, 0, 0, 339, 533, 102, 604, 449, 957, 0, 0, 0, 0, 50, 101, 257,
+  294, 795, 846, 51, 0, 0, 71, 0, 348, 877, 0, 0, 0, 161, 0, 99,
+  66, 0, 0, 0, 0, 613, 208, 0, 443, 526, 601, 0, 412, 0, 0, 0,
+  774, 303, 0, 0, 204, 0, 502, 238, 0, 0, 697, 329, 0, 0, 127, 908,
+  0, 324, 0, 309, 899, 0, 0, 0, 0, 0, 0, 436, 518, 0, 0, 0,
+  0, 18, 517, 0, 0, 0, 0, 0, 543, 0, 78, 351, 420, 579, 912, 463,
+  850, 430, 599, 408, 618, 87, 0, 314, 0, 0, 798, 0, 0, 129, 493, 0,
+  0, 0, 3, 141, 224, 465, 0, 896, 369, 721, 835, 0, 619, 0, 0, 0,
+  545, 0, 0, 0, 0, 0, 305, 0, 820, 0, 0, 924, 263, 0, 359, 0,
+  972, 302, 0, 0, 0, 0, 275, 600, 832, 0, 0, 378, 0, 816, 886, 0,
+  0, 0, 0, 0, 0, 0, 0, 176, 0, 0, 582, 474, 576, 0, 536, 0,
+  0, 577, 448, 497, 160, 0, 0, 0, 45, 0, 80, 968, 0, 172, 0, 0,
+  676, 439, 47, 0, 750, 0, 106, 0, 0, 0, 0, 0, 425, 0, 0, 0,
+  0, 0, 0, 0, 991, 0, 0, 98, 0, 0, 528, 0, 0, 0, 752, 0,
+  0, 470, 714, 245, 0, 0, 0, 0, 597, 0, 0, 760, 0, 0, 764, 338,
+  450, 231, 0, 0, 0, 286, 342, 859, 775, 867, 885, 0, 83, 22, 0, 0,
+  700, 0, 0, 566, 117, 354, 0, 0, 889, 0, 166, 0, 38, 0, 153, 0,
+  0, 0, 0, 976, 0, 264, 740, 808, 838, 696, 0, 0, 173, 698, 496, 11,
+  0, 281, 21, 320, 479, 0, 0, 0, 0, 0, 0, 0, 0, 0, 675, 888,
+  0, 708, 567, 993, 0, 225, 0, 0, 0, 0, 0, 401, 0, 819, 0, 923,
+  0, 464, 504, 0, 607, 0, 0, 0, 0, 0, 0, 0, 636, 0, 880, 927,
+  0, 468, 0, 0, 0, 0, 229, 216, 0, 541, 0, 0, 970, 405, 0, 360,
+  0, 352, 228, 901, 114, 994, 553, 755, 0, 682, 0, 234, 262, 440, 423, 472,
+  757, 0, 373, 0, 699, 151, 57, 688, 0, 396, 906, 925, 951, 959, 143, 0,
+  0, 233, 0, 0, 322, 0, 0, 702, 0, 785, 0, 549, 0, 73, 313, 673,
+  561, 839, 869, 942, 544, 715, 0, 0, 157, 167, 0, 884, 124, 736, 802, 920,
+  0, 0, 0, 591, 0, 115, 0, 978, 0, 271, 386, 632, 982, 0, 898, 727,
+  875, 0, 0, 801, 0, 693, 48, 989, 0, 398, 0, 765, 796, 164, 659, 0,
+  55, 941, 0, 0, 0, 340, 414, 25, 347, 996, 0, 0, 0, 0, 0, 0,
+  330, 0, 431, 0, 288, 870, 710, 0, 0, 0, 0, 0, 0, 0, 444, 0,
+  107, 0, 0, 375, 857, 988, 0, 0, 0, 0, 0, 0, 734, 69, 118, 648,
+  547, 873, 918, 85, 944, 652, 0, 0, 0, 0, 0, 511, 0, 0, 96, 20,
+  512, 0, 0, 388, 550, 318, 661, 596, 227, 0, 0, 0, 806, 0, 26, 0,
+  664, 0, 387, 0, 0, 657, 0, 0, 0, 456, 0, 0, 0, 0, 756, 0,
+  0, 643, 0, 0, 0, 0, 0, 0, 0, 0, 185, 588, 949, 372, 0, 0,
+  0, 0, 616, 963, 295, 445, 0, 0, 44, 377, 586, 624, 0, 385, 466, 722,
+  323, 266, 0, 0, 828, 0, 519, 663, 0, 0, 0, 997, 188, 0, 0, 0,
+  35, 136, 0, 0, 0, 851, 0, 0, 0, 506, 0, 246, 728, 0, 0, 0,
+  0, 891, 0, 0, 0, 0, 65, 529, 0, 293, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 301, 932, 0, 0, 0, 0, 16, 203, 0, 0, 0, 0, 0,
+  0, 0, 0, 748, 165, 0, 235, 0, 0, 384, 178, 410, 670, 6, 525, 406,
+};
+
+const char *WA_FREQ_64_TOKENS[] = {
+  "le",
+  "tu",
+  "in",
+  "es",
+  "quando",
+  "del",
+  "esque",
+  "pote",
+  "dicer",
+  "lo",
+  "proprie",
+  "parolas",
+  "carne",
+  "era",
+  "tenere",
+  "an",
+  "ille",
+  "vostre",
+  "filio",
+  "on",
+  "va",
+  "aperir",
+  "session",
+  "duration",
+  "volata",
+  "de",
+  "solmente",
+  "20",
+  "minutas",
+  "dunque",
+  "il",
+  "se",
+  "tracta",
+  "plus",
+  "curte",
+  "viage",
+  "aeree",
+  "international",
+  "disponibile",
+  "bomba",
+  "explode",
+  "io",
+  "incontrava",
+  "per",
+  "hasardo",
+  "fratre",
+  "strata",
+  "vos",
+  "nata",
+  "multo",
+  "celeremente",
+  "nunquam",
+  "a",
+  "tom",
+  "illos",
+  "placeva",
+};
+const uint16_t WA_FREQ_64_RANKS[] = {
+  51, 0, 0, 0, 0, 0, 14, 17, 0, 0, 0, 0, 0, 0, 0, 0,
+  44, 0, 0, 0, 8, 16, 37, 33, 0, 9, 0, 26, 43, 20, 45, 0,
+  0, 0, 0, 0, 6, 31, 0, 35, 52, 0, 3, 0, 34, 18, 46, 48,
+  0, 10, 49, 53, 11, 47, 0, 0, 0, 0, 0, 29, 0, 0, 4, 13,
+  0, 0, 0, 0, 0, 42, 0, 0, 0, 0, 0, 0, 28, 0, 21, 41,
+  19, 27, 25, 36, 0, 0, 55, 0, 0, 0, 0, 0, 0, 5, 2, 7,
+  23, 30, 32, 0, 0, 0, 0, 22, 0, 39, 0, 0, 50, 0, 0, 15,
+  54, 1, 38, 56, 0, 12, 40, 0, 0, 0, 0, 0, 24, 0, 0, 0,
+};
+
+const char *WA_FREQ_65_TOKENS[] = {
+  "aku",
+  "kau",
+  "yang",
+  "tidak",
+  "ini",
+  "itu",
+  "dan",
+  "dia",
+  "di",
+  "akan",
+  "apa",
+  "kita",
+  "untuk",
+  "bisa",
+  "ada",
+  "tak",
+  "mereka",
+  "anda",
+  "tahu",
+  "dengan",
+  "saya",
+  "dari",
+  "ya",
+  "tapi",
+  "kami",
+  "ke",
+  "harus",
+  "sudah",
+  "kamu",
+  "adalah",
+  "orang",
+  "saja",
+  "seperti",
+  "ingin",
+  "jika",
+  "pergi",
+  "hanya",
+  "semua",
+  "sekarang",
+  "sini",
+  "jadi",
+  "dalam",
+  "bukan",
+  "baik",
+  "bagaimana",
+  "jangan",
+  "lagi",
+  "punya",
+  "lebih",
+  "oh",
+  "pada",
+  "mungkin",
+  "kalian",
+  "lakukan",
+  "karena",
+  "sangat",
+  "satu",
+  "juga",
+  "apakah",
+  "mau",
+  "pernah",
+  "siapa",
+  "telah",
+  "ayo",
+  "hal",
+  "saat",
+  "kenapa",
+  "hari",
+  "kembali",
+  "atau",
+  "datang",
+  "begitu",
+  "sesuatu",
+  "banyak",
+  "benar",
+  "kasih",
+  "menjadi",
+  "melihat",
+  "terjadi",
+  "melakukan",
+  "terima",
+  "tentang",
+  "lihat",
+  "seorang",
+  "bahwa",
+  "kalau",
+  "hei",
+  "bagus",
+  "bilang",
+  "masih",
+  "oke",
+  "lain",
+  "sana",
+  "waktu",
+  "baiklah",
+  "tempat",
+  "mana",
+  "keluar",
+  "lalu",
+  "malam",
+  "maaf",
+  "membuat",
+  "mati",
+  "sedang",
+  "memiliki",
+  "tahun",
+  "sekali",
+  "sampai",
+  "anak",
+  "baru",
+  "dapat",
+  "beberapa",
+  "ayah",
+  "sendiri",
+  "katakan",
+  "hidup",
+  "mengapa",
+  "sebuah",
+  "perlu",
+  "kan",
+  "sama",
+  "tunggu",
+  "salah",
+  "semuanya",
+  "rumah",
+  "mengatakan",
+  "ia",
+  "ketika",
+  "masuk",
+  "cepat",
+  "dengar",
+  "besar",
+  "padaku",
+  "disini",
+  "pikir",
+  "pasti",
+  "yg",
+  "ibu",
+  "masalah",
+  "benar-benar",
+  "belum",
+  "pak",
+  "bicara",
+  "dua",
+  "tentu",
+  "selamat",
+  "cukup",
+  "selalu",
+  "tuhan",
+  "suka",
+  "yeah",
+  "seseorang",
+  "melakukannya",
+  "pria",
+  "setelah",
+  "mengerti",
+  "baik-baik",
+  "tolong",
+  "dimana",
+  "bahkan",
+  "apa-apa",
+  "berada",
+  "menemukan",
+  "sedikit",
+  "bertemu",
+  "mendapatkan",
+  "percaya",
+  "oleh",
+  "makan",
+  "lama",
+  "atas",
+  "ku",
+  "tinggal",
+  "bekerja",
+  "terlalu",
+  "wanita",
+  "sebagai",
+  "padamu",
+  "sayang",
+  "kali",
+  "tetap",
+  "yakin",
+  "hey",
+  "cara",
+  "berhenti",
+  "jalan",
+  "setiap",
+  "berpikir",
+  "mulai",
+  "dunia",
+  "mari",
+  "membunuh",
+  "selama",
+  "luar",
+  "kecil",
+  "pertama",
+  "sebelum",
+  "diri",
+  "bersama",
+  "mengambil",
+  "boleh",
+  "the",
+  "merasa",
+  "mencari",
+  "uang",
+  "apapun",
+  "senang",
+  "butuh",
+  "kurasa",
+  "ayolah",
+  "teman",
+  "sebenarnya",
+  "mencoba",
+  "gadis",
+  "dulu",
+  "tanpa",
+  "jam",
+  "denganmu",
+  "takkan",
+  "buruk",
+  "para",
+  "polisi",
+  "membawa",
+  "yah",
+  "berapa",
+  "orang-orang",
+  "itulah",
+  "ingat",
+  "kemudian",
+  "siap",
+  "biarkan",
+  "maksudku",
+  "terus",
+  "gila",
+  "pun",
+  "tuan",
+  "sakit",
+  "tidur",
+  "pulang",
+  "segera",
+  "seharusnya",
+  "kepada",
+  "memang",
+  "takut",
+  "dirimu",
+  "halo",
+  "terlihat",
+  "nama",
+  "i",
+  "sial",
+  "berbicara",
+  "minta",
+  "kota",
+  "mobil",
+  "membantu",
+  "terakhir",
+  "biasa",
+  "cinta",
+  "mu",
+  "depan",
+  "sepertinya",
+  "sebentar",
+  "padanya",
+  "rasa",
+  "bagian",
+  "bodoh",
+  "sialan",
+  "manusia",
+  "tiga",
+  "berhasil",
+  "sungguh",
+  "mendengar",
+  "tepat",
+  "bawah",
+  "berikan",
+  "ambil",
+  "pagi",
+  "air",
+  "keluarga",
+  "hai",
+  "bawa",
+  "kehilangan",
+  "maafkan",
+  "untukmu",
+  "nanti",
+  "bagi",
+  "tangan",
+  "hebat",
+  "s",
+  "menunggu",
+  "ikut",
+  "melihatnya",
+  "masa",
+  "jauh",
+  "pekerjaan",
+  "ah",
+  "you",
+  "berdua",
+  "paling",
+  "peduli",
+  "aneh",
+  "anak-anak",
+  "penting",
+  "tadi",
+  "si",
+  "selesai",
+  "seluruh",
+  "ok",
+  "meninggalkan",
+  "cuma",
+  "suatu",
+  "terbaik",
+  "khawatir",
+  "tua",
+  "memberikan",
+  "tenang",
+  "hentikan",
+  "disana",
+  "bisakah",
+  "coba",
+  "uh",
+  "menit",
+  "sekolah",
+  "duduk",
+  "sebelumnya",
+  "secara",
+  "maka",
+  "besok",
+  "minum",
+  "tn",
+  "berarti",
+  "a",
+  "bulan",
+  "bergerak",
+  "sejak",
+  "hampir",
+  "kemari",
+  "kepala",
+  "astaga",
+  "tetapi",
+  "soal",
+  "maksudmu",
+  "menggunakan",
+  "tau",
+  "diam",
+  "aman",
+  "berjalan",
+  "buat",
+  "sulit",
+  "senjata",
+  "iya",
+  "inginkan",
+  "kapan",
+  "sekitar",
+  "pintu",
+  "nak",
+  "ayahku",
+  "memberi",
+  "hati",
+  "kesempatan",
+  "nah",
+  "bermain",
+  "cari",
+  "dekat",
+  "mendapat",
+  "bukankah",
+  "jelas",
+  "nya",
+  "tim",
+  "dengannya",
+  "mudah",
+  "akhirnya",
+  "jatuh",
+  "kumohon",
+  "denganku",
+  "agar",
+  "benarkah",
+  "berakhir",
+  "ayahmu",
+  "memberitahu",
+  "alasan",
+  "menarik",
+  "cantik",
+  "kawan",
+  "berubah",
+  "kupikir",
+  "satu-satunya",
+  "keras",
+  "mata",
+  "dokter",
+  "lainnya",
+  "beritahu",
+  "kemana",
+  "serius",
+  "kuat",
+  "bertanya",
+  "minggu",
+  "meminta",
+  "membuatku",
+  "kerja",
+  "bunuh",
+  "pergilah",
+  "kehidupan",
+  "berbeda",
+  "berharap",
+  "bangun",
+  "indah",
+  "menurutmu",
+  "beri",
+  "menyelamatkan",
+  "kata",
+  "hilang",
+  "kabar",
+  "darah",
+  "dengarkan",
+  "kamar",
+  "lari",
+  "kulakukan",
+  "berkata",
+  "menyenangkan",
+  "dilakukan",
+  "kosong",
+  "b1",
+  "eh",
+  "belakang",
+  "raja",
+  "dasar",
+  "bajingan",
+  "biar",
+  "makanan",
+  "bantuan",
+  "dapatkan",
+  "meninggal",
+  "ruang",
+  "demi",
+  "kedua",
+  "kekuatan",
+  "marah",
+  "membiarkan",
+  "lepaskan",
+  "daripada",
+  "buku",
+  "it",
+  "4ch000000",
+  "menikah",
+  "berusaha",
+  "diriku",
+  "fncandara",
+  "rencana",
+  "telepon",
+  "kasus",
+  "perang",
+  "pertanyaan",
+  "kapal",
+  "belajar",
+  "suara",
+  "amerika",
+  "lupa",
+  "lihatlah",
+  "muda",
+  "pikirkan",
+  "ibumu",
+  "perjalanan",
+  "menuju",
+  "cerita",
+  "permisi",
+  "naik",
+  "langsung",
+  "wow",
+  "paham",
+  "antara",
+  "membutuhkan",
+  "tinggi",
+  "t",
+  "turun",
+  "ide",
+  "4ah80",
+  "kaki",
+  "penuh",
+  "sendirian",
+  "negara",
+  "lima",
+  "ibuku",
+  "namanya",
+  "kematian",
+  "anjing",
+  "berdiri",
+  "to",
+  "kecuali",
+  "kira",
+  "kapten",
+  "rahasia",
+  "menang",
+  "and",
+  "menerima",
+  "silakan",
+  "tanah",
+  "bicarakan",
+  "lucu",
+  "buka",
+  "ch00ffff",
+  "melawan",
+  "menunjukkan",
+  "dirinya",
+  "um",
+  "agen",
+  "melalui",
+  "rasanya",
+  "sepanjang",
+  "akhir",
+  "bu",
+  "artinya",
+  "pilihan",
+  "nona",
+  "terlambat",
+  "pesta",
+  "mulia",
+  "membuatmu",
+  "membuatnya",
+  "untukku",
+  "temukan",
+  "semakin",
+  "well",
+  "bung",
+  "kesalahan",
+  "john",
+  "silahkan",
+  "lewat",
+  "mencintaimu",
+  "sementara",
+  "nomor",
+  "api",
+  "memilih",
+  "pesawat",
+  "guru",
+  "bahagia",
+  "waktunya",
+  "film",
+  "tiba",
+  "bantu",
+  "melihatmu",
+  "panas",
+  "bumi",
+  "memakai",
+  "okay",
+  "kubilang",
+  "menemukannya",
+  "segalanya",
+  "setidaknya",
+  "keren",
+  "membunuhnya",
+  "no",
+  "jawab",
+  "hidupku",
+  "pesan",
+  "bertahan",
+  "bayi",
+  "bahasa",
+  "kantor",
+  "putri",
+  "empat",
+  "tinggalkan",
+  "muncul",
+  "omong",
+  "kenal",
+  "perusahaan",
+  "awal",
+  "anakku",
+  "penjara",
+  "setuju",
+  "nyata",
+  "sempurna",
+  "semoga",
+  "janji",
+  "bercanda",
+  "tampak",
+  "pembunuh",
+  "siapapun",
+  "menghancurkan",
+  "kesini",
+  "membayar",
+  "surat",
+  "of",
+  "kelas",
+  "beruntung",
+  "laki-laki",
+  "tampaknya",
+  "whoa",
+  "ulang",
+  "jumpa",
+  "sebaiknya",
+  "menembak",
+  "namun",
+  "brengsek",
+  "permainan",
+  "bila",
+  "hal-hal",
+  "sam",
+  "menjaga",
+  "tahan",
+  "sering",
+  "tutup",
+  "sang",
+  "jack",
+  "pembunuhan",
+  "perintah",
+  "semacam",
+  "jahat",
+  "hubungan",
+  "terbang",
+  "dingin",
+  "mendapatkannya",
+  "berikutnya",
+  "mengetahui",
+  "pasukan",
+  "hati-hati",
+  "laut",
+  "by",
+  "me",
+  "meskipun",
+  "sehingga",
+  "membawanya",
+  "sebabnya",
+  "huh",
+  "perempuan",
+  "segala",
+  "menangkap",
+  "harusnya",
+  "kurang",
+  "tanda",
+  "membeli",
+  "mundur",
+  "berbohong",
+  "mesin",
+  "in",
+  "barang",
+  "berita",
+  "begini",
+  "bukti",
+  "mimpi",
+  "l",
+  "bisnis",
+  "bukanlah",
+  "menangis",
+  "tembak",
+  "menulis",
+  "menelepon",
+  "berbahaya",
+  "kukatakan",
+  "pikiran",
+  "mencuri",
+  "terluka",
+  "tersebut",
+  "pakai",
+  "berani",
+  "dr.",
+  "agak",
+  "awak",
+  "melindungi",
+  "benda",
+  "membaca",
+  "setengah",
+  "dariku",
+  "hitam",
+  "ha",
+  "musim",
+  "enak",
+  "lagu",
+  "kemarin",
+  "tubuh",
+  "siang",
+  "man",
+  "memikirkan",
+  "inilah",
+  "bersalah",
+  "mengirim",
+  "mengenai",
+  "namaku",
+  "memutuskan",
+  "mengubah",
+  "saling",
+  "harap",
+  "paman",
+  "hingga",
+  "mendengarkan",
+  "selamanya",
+  "terhadap",
+  "saudara",
+  "hukum",
+  "menghilang",
+  "tugas",
+  "betapa",
+  "hmm",
+  "lupakan",
+  "obat",
+  "hadiah",
+  "manis",
+  "sebelah",
+  "bagiku",
+  "merasakan",
+  "menghabiskan",
+  "fs60",
+  "informasi",
+  "selain",
+  "new",
+  "sisi",
+  "kunci",
+  "bebas",
+  "juta",
+  "istri",
+  "menyukai",
+  "mengikuti",
+  "my",
+  "keadaan",
+  "milik",
+  "pernikahan",
+  "saatnya",
+  "kukira",
+  "menyukainya",
+  "entahlah",
+  "kesana",
+  "bersama-sama",
+  "benci",
+  "kakak",
+  "mengerikan",
+  "pindah",
+  "berat",
+  "sadar",
+  "m",
+  "merah",
+  "pribadi",
+  "arah",
+  "temanku",
+  "menyesal",
+  "korban",
+  "wajah",
+  "membuka",
+  "enam",
+  "presiden",
+  "inggris",
+  "bergabung",
+  "lantai",
+  "udara",
+  "melewati",
+  "anggota",
+  "batu",
+  "gunakan",
+  "mengalami",
+  "jujur",
+  "pintar",
+  "sistem",
+  "putih",
+  "mr",
+  "sibuk",
+  "menghentikan",
+  "memeriksa",
+  "dimulai",
+  "berjanji",
+  "bola",
+  "biasanya",
+  "nyonya",
+  "keamanan",
+  "mampu",
+  "bintang",
+  "gagal",
+  "panjang",
+  "dolar",
+  "bos",
+  "musik",
+  "panggil",
+  "kereta",
+  "menyerah",
+  "serangan",
+  "musuh",
+  "hi",
+  "mohon",
+  "menyerang",
+  "tanganmu",
+  "pakaian",
+  "foto",
+  "membunuhmu",
+  "akal",
+  "kartu",
+  "mencintai",
+  "perasaan",
+  "tentara",
+  "jenis",
+  "acara",
+  "seberapa",
+  "matahari",
+  "mandi",
+  "mempunyai",
+  "toko",
+  "membantumu",
+  "maksud",
+  "tunjukkan",
+  "kuharap",
+  "petugas",
+  "kecelakaan",
+  "ruangan",
+  "teman-teman",
+  "memanggil",
+  "makhluk",
+  "kabur",
+  "apos",
+  "ternyata",
+  "memulai",
+  "tengah",
+  "detik",
+  "terbuka",
+  "menurut",
+  "kulihat",
+  "kini",
+  "hantu",
+  "jaga",
+  "cocok",
+  "tertawa",
+  "posisi",
+  "namamu",
+  "selanjutnya",
+  "mengatakannya",
+  "keberatan",
+  "mabuk",
+  "tertarik",
+  "catatan",
+  "tujuan",
+  "kanan",
+  "kalah",
+  "neraka",
+  "pukul",
+  "planet",
+  "menyelesaikan",
+  "khusus",
+  "panggilan",
+  "masalahnya",
+  "hanyalah",
+  "periksa",
+  "hutan",
+  "ditemukan",
+  "menonton",
+  "utara",
+  "utama",
+  "kamera",
+  "memberitahumu",
+  "burung",
+  "dewa",
+  "ayahnya",
+  "gak",
+  "cahaya",
+  "entah",
+  "hah",
+  "pantas",
+  "disebut",
+  "menginginkan",
+  "pahlawan",
+  "terlibat",
+  "operasi",
+  "situasi",
+  "melarikan",
+  "gambar",
+  "kejahatan",
+  "lee",
+  "misi",
+  "percayalah",
+  "perhatian",
+  "gue",
+  "on",
+  "don",
+  "membunuhku",
+  "menurutku",
+  "sir",
+  "kiri",
+  "kalinya",
+  "ketakutan",
+  "menjual",
+  "kotak",
+  "terdengar",
+  "kuda",
+  "berguna",
+  "sejauh",
+  "pintunya",
+  "alam",
+  "kemarilah",
+  "mengganggu",
+  "pistol",
+  "hello",
+  "sepertimu",
+  "ikuti",
+  "bahaya",
+  "hubungi",
+  "hidupmu",
+  "nenek",
+  "gelap",
+  "menyadari",
+  "ahli",
+  "kim",
+  "main",
+  "kopi",
+  "merupakan",
+  "memberimu",
+  "go",
+  "ratu",
+  "that",
+  "kemungkinan",
+  "bersamamu",
+  "diterjemahkan",
+  "kejadian",
+  "laporan",
+  "balik",
+  "detektif",
+  "daftar",
+  "es",
+  "sejarah",
+  "nyaman",
+  "daging",
+  "keputusan",
+  "caranya",
+  "ceritakan",
+  "bernama",
+  "istirahat",
+  "layak",
+  "pertemuan",
+  "penjaga",
+  "alat",
+  "kulit",
+  "sesuai",
+  "kebenaran",
+  "persetan",
+  "peter",
+  "temanmu",
+  "york",
+  "tiba-tiba",
+  "penyihir",
+  "sampah",
+  "bersumpah",
+  "menghubungi",
+  "hak",
+  "pemerintah",
+  "mendengarnya",
+  "darimu",
+  "memastikan",
+  "lapar",
+  "bohong",
+  "tanya",
+  "bunga",
+  "menjelaskan",
+  "sih",
+  "emas",
+  "david",
+  "berasal",
+  "malu",
+  "kaya",
+  "dah",
+  "monster",
+  "bersamaku",
+  "mayat",
+  "frank",
+  "minuman",
+  "tangkap",
+  "bom",
+  "meja",
+  "pacar",
+  "digunakan",
+  "asing",
+  "daerah",
+  "ikan",
+  "angkat",
+  "pengacara",
+  "michael",
+  "milikku",
+  "bau",
+  "normal",
+  "harapan",
+  "ampun",
+  "butuhkan",
+  "mr.",
+  "bank",
+  "mengalahkan",
+  "jiwa",
+  "prajurit",
+  "otak",
+  "kabarmu",
+  "miliki",
+  "menempatkan",
+  "hotel",
+  "selatan",
+  "lelah",
+  "dapatkah",
+  "pohon",
+  "sebagian",
+  "menemui",
+  "apa-apaan",
+  "berangkat",
+  "pusat",
+  "tumbuh",
+  "kerajaan",
+  "dewasa",
+  "maju",
+  "menjawab",
+  "menutup",
+};
+const uint16_t WA_FREQ_65_RANKS[] = {
+  1000, 0, 169, 239, 421, 815, 385, 614, 824, 936, 988, 0, 0, 0, 112, 0,
+  203, 217, 70, 347, 114, 0, 0, 0, 0, 0, 115, 0, 0, 362, 353, 686,
+  0, 0, 359, 197, 678, 787, 0, 500, 0, 0, 0, 173, 0, 805, 348, 0,
+  918, 0, 0, 0, 0, 0, 0, 685, 896, 904, 946, 0, 489, 0, 0, 0,
+  0, 0, 511, 0, 0, 0, 215, 247, 0, 420, 798, 802, 0, 0, 142, 131,
+  0, 0, 107, 694, 75, 322, 376, 646, 919, 529, 0, 649, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 987, 0, 29, 0, 159, 887, 0, 0,
+  0, 0, 0, 0, 379, 0, 0, 0, 0, 0, 287, 35, 445, 724, 855, 956,
+  817, 993, 0, 0, 586, 0, 0, 259, 10, 0, 881, 0, 0, 97, 0, 605,
+  302, 775, 0, 0, 804, 127, 506, 536, 396, 850, 874, 913, 0, 578, 0, 0,
+  0, 0, 0, 431, 0, 0, 0, 4, 0, 410, 990, 0, 0, 0, 0, 0,
+  589, 459, 94, 272, 0, 0, 0, 0, 424, 262, 165, 345, 486, 603, 664, 533,
+  0, 271, 581, 225, 0, 175, 273, 454, 592, 876, 973, 0, 0, 0, 0, 0,
+  666, 36, 241, 0, 543, 726, 0, 526, 0, 628, 0, 0, 0, 196, 545, 852,
+  983, 507, 119, 161, 0, 709, 0, 388, 651, 58, 501, 752, 0, 0, 0, 0,
+  264, 0, 0, 596, 0, 0, 108, 368, 696, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 224, 391, 0, 0, 53, 44, 331, 303, 370, 0, 872, 497, 629, 0,
+  0, 735, 0, 0, 776, 0, 538, 789, 0, 405, 0, 0, 0, 0, 0, 0,
+  972, 0, 0, 728, 0, 0, 0, 0, 0, 0, 0, 0, 793, 892, 534, 0,
+  88, 794, 0, 31, 0, 398, 163, 455, 754, 880, 0, 0, 0, 0, 862, 0,
+  930, 72, 0, 0, 0, 0, 0, 0, 0, 0, 0, 404, 0, 0, 312, 0,
+  0, 0, 0, 692, 298, 653, 0, 0, 0, 566, 206, 255, 14, 429, 885, 916,
+  141, 675, 939, 478, 0, 0, 0, 0, 547, 0, 499, 0, 0, 0, 0, 0,
+  0, 0, 548, 0, 0, 0, 0, 0, 103, 0, 482, 0, 66, 86, 248, 0,
+  226, 639, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 472, 0,
+  0, 0, 0, 0, 221, 0, 761, 597, 888, 416, 518, 691, 800, 0, 0, 317,
+  0, 0, 77, 65, 315, 375, 619, 0, 0, 0, 656, 0, 311, 682, 768, 736,
+  0, 0, 0, 332, 0, 263, 447, 0, 0, 0, 770, 0, 0, 0, 0, 0,
+  839, 280, 201, 254, 408, 717, 0, 0, 0, 174, 477, 820, 0, 833, 0, 0,
+  0, 0, 122, 0, 0, 0, 0, 0, 0, 0, 0, 413, 0, 0, 0, 0,
+  0, 0, 155, 0, 0, 180, 0, 0, 0, 0, 0, 126, 785, 0, 0, 827,
+  0, 760, 743, 0, 963, 0, 399, 848, 202, 41, 674, 104, 0, 17, 749, 625,
+  0, 0, 252, 397, 52, 309, 931, 214, 0, 0, 0, 446, 0, 0, 0, 0,
+  401, 0, 658, 0, 0, 0, 418, 830, 0, 0, 660, 0, 0, 457, 0, 0,
+  45, 0, 0, 755, 0, 807, 756, 809, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 295, 192, 542, 0, 0,
+  647, 676, 0, 319, 352, 0, 528, 146, 730, 821, 0, 0, 318, 337, 960, 0,
+  0, 0, 943, 0, 868, 853, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 294, 390, 650, 662, 0, 0, 0, 935, 0, 575, 0, 308, 632, 0, 40,
+  577, 0, 0, 509, 0, 0, 591, 0, 864, 0, 0, 0, 546, 130, 389, 0,
+  0, 0, 859, 0, 232, 531, 0, 907, 364, 695, 719, 0, 0, 0, 0, 228,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 392, 849, 616, 0, 652, 74,
+  481, 513, 261, 951, 0, 0, 0, 0, 0, 0, 0, 0, 693, 0, 432, 223,
+  0, 924, 0, 0, 0, 170, 0, 0, 944, 914, 342, 373, 976, 0, 672, 381,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 573, 891, 0, 0, 0, 113, 0,
+  0, 436, 148, 333, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 137, 0,
+  0, 593, 0, 745, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 212, 557,
+  60, 326, 185, 0, 0, 0, 0, 0, 0, 0, 0, 648, 267, 438, 587, 779,
+  110, 781, 933, 0, 0, 0, 0, 325, 640, 0, 0, 645, 0, 941, 968, 0,
+  0, 356, 0, 905, 0, 0, 0, 684, 301, 407, 856, 882, 0, 0, 0, 0,
+  282, 9, 339, 847, 265, 0, 0, 0, 0, 0, 64, 387, 412, 466, 570, 708,
+  938, 978, 0, 0, 0, 0, 0, 0, 145, 0, 609, 580, 0, 0, 90, 55,
+  93, 932, 732, 470, 0, 0, 0, 355, 313, 0, 0, 235, 618, 0, 0, 0,
+  615, 0, 0, 0, 766, 893, 0, 0, 0, 0, 0, 0, 0, 0, 166, 0,
+  0, 631, 50, 343, 954, 0, 0, 900, 0, 792, 0, 638, 276, 0, 249, 0,
+  683, 0, 0, 425, 395, 772, 702, 417, 0, 0, 0, 527, 541, 0, 285, 0,
+  95, 76, 0, 0, 0, 0, 0, 328, 659, 0, 0, 268, 0, 0, 292, 0,
+  87, 96, 714, 554, 837, 0, 334, 786, 796, 828, 0, 358, 256, 0, 564, 816,
+  0, 942, 61, 0, 0, 0, 0, 0, 0, 0, 818, 0, 120, 558, 0, 286,
+  690, 810, 11, 105, 0, 0, 0, 0, 0, 403, 842, 0, 0, 0, 0, 0,
+  0, 253, 671, 733, 0, 0, 551, 0, 803, 0, 132, 0, 83, 121, 323, 869,
+  899, 495, 621, 921, 68, 0, 0, 0, 0, 0, 0, 0, 453, 62, 762, 0,
+  0, 209, 458, 0, 101, 965, 51, 0, 0, 0, 304, 979, 0, 0, 980, 0,
+  688, 176, 540, 0, 371, 205, 549, 947, 440, 0, 857, 0, 0, 0, 0, 731,
+  0, 0, 361, 0, 0, 0, 484, 124, 520, 351, 222, 183, 948, 952, 475, 0,
+  0, 522, 349, 555, 680, 959, 997, 456, 870, 1, 289, 0, 897, 747, 832, 846,
+  0, 335, 73, 452, 474, 524, 505, 563, 279, 400, 861, 382, 895, 78, 310, 700,
+  851, 0, 0, 0, 0, 0, 572, 0, 0, 346, 612, 0, 644, 0, 149, 912,
+  160, 199, 383, 258, 0, 0, 0, 0, 689, 0, 0, 0, 277, 260, 574, 423,
+  0, 0, 961, 0, 0, 411, 0, 0, 336, 0, 479, 0, 0, 0, 0, 0,
+  133, 0, 630, 195, 305, 314, 0, 0, 583, 0, 0, 0, 164, 0, 0, 0,
+  42, 613, 679, 826, 0, 211, 915, 0, 627, 0, 422, 0, 0, 0, 565, 296,
+  831, 0, 0, 0, 0, 0, 0, 877, 0, 0, 0, 0, 0, 0, 920, 0,
+  0, 468, 0, 0, 0, 687, 465, 0, 0, 0, 448, 512, 85, 0, 0, 0,
+  0, 0, 673, 883, 576, 715, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  200, 461, 0, 0, 571, 0, 0, 0, 0, 778, 0, 377, 0, 49, 0, 0,
+  0, 0, 419, 0, 366, 428, 227, 537, 0, 0, 0, 0, 0, 0, 669, 0,
+  443, 441, 0, 999, 0, 0, 0, 0, 0, 0, 0, 406, 365, 117, 626, 0,
+  0, 0, 0, 0, 188, 0, 0, 0, 0, 426, 0, 698, 0, 0, 0, 0,
+  3, 0, 791, 622, 825, 0, 0, 0, 0, 0, 705, 0, 590, 602, 0, 0,
+  0, 739, 0, 975, 0, 0, 0, 0, 0, 0, 7, 521, 134, 737, 764, 357,
+  0, 0, 757, 929, 595, 661, 986, 655, 0, 207, 721, 186, 28, 0, 367, 813,
+  0, 0, 167, 231, 0, 0, 967, 290, 525, 0, 523, 0, 330, 0, 0, 0,
+  0, 567, 0, 178, 502, 994, 0, 0, 0, 0, 0, 568, 0, 0, 0, 0,
+  469, 795, 0, 219, 902, 0, 19, 172, 504, 985, 995, 964, 394, 642, 0, 0,
+  0, 0, 606, 0, 307, 439, 750, 0, 427, 0, 300, 0, 0, 0, 0, 0,
+  354, 0, 0, 0, 0, 0, 20, 0, 0, 0, 865, 0, 0, 928, 275, 102,
+  701, 0, 0, 0, 879, 246, 799, 875, 0, 854, 2, 139, 288, 716, 812, 925,
+  0, 344, 491, 106, 98, 483, 561, 38, 878, 894, 47, 582, 0, 0, 0, 0,
+  562, 790, 0, 706, 729, 0, 0, 0, 0, 0, 327, 0, 0, 977, 0, 0,
+  0, 0, 0, 643, 0, 0, 81, 190, 0, 0, 0, 0, 0, 0, 181, 780,
+  657, 138, 125, 738, 0, 33, 63, 240, 607, 229, 363, 485, 777, 917, 514, 0,
+  43, 0, 0, 171, 0, 0, 0, 0, 970, 0, 600, 84, 257, 338, 480, 0,
+  0, 177, 670, 0, 0, 158, 909, 0, 890, 0, 634, 324, 771, 0, 937, 0,
+  0, 270, 681, 992, 0, 0, 30, 0, 0, 0, 0, 144, 704, 636, 487, 759,
+  836, 0, 284, 444, 0, 0, 950, 0, 569, 560, 594, 0, 100, 16, 15, 243,
+  250, 297, 374, 559, 996, 866, 82, 553, 449, 490, 0, 0, 0, 0, 0, 162,
+  0, 898, 0, 0, 0, 234, 0, 884, 266, 473, 801, 0, 0, 37, 57, 189,
+  218, 579, 727, 0, 39, 763, 462, 0, 0, 712, 858, 510, 492, 0, 0, 0,
+  71, 236, 0, 723, 889, 340, 0, 519, 0, 299, 182, 713, 969, 147, 0, 503,
+  54, 637, 0, 911, 0, 67, 0, 758, 0, 0, 0, 0, 0, 0, 966, 378,
+  414, 550, 386, 598, 753, 910, 213, 237, 8, 409, 834, 59, 210, 974, 886, 80,
+  187, 982, 623, 0, 769, 699, 0, 665, 0, 0, 92, 430, 556, 0, 0, 0,
+  0, 0, 0, 129, 0, 0, 0, 372, 0, 0, 91, 451, 814, 863, 0, 611,
+  773, 998, 0, 0, 27, 0, 0, 0, 0, 0, 0, 493, 949, 0, 819, 0,
+  0, 0, 0, 0, 0, 434, 329, 0, 0, 179, 269, 0, 0, 244, 369, 940,
+  89, 0, 230, 184, 245, 283, 922, 460, 194, 220, 697, 711, 0, 0, 0, 663,
+  808, 118, 291, 496, 784, 128, 471, 402, 0, 906, 0, 488, 0, 0, 0, 99,
+  0, 0, 0, 0, 0, 0, 0, 0, 157, 544, 633, 151, 109, 350, 278, 0,
+  191, 204, 22, 703, 0, 23, 464, 841, 0, 0, 0, 0, 123, 516, 707, 0,
+  136, 238, 668, 901, 908, 0, 0, 0, 822, 0, 725, 0, 0, 0, 0, 722,
+  0, 984, 168, 962, 0, 0, 0, 0, 494, 797, 934, 0, 0, 517, 24, 0,
+  25, 0, 783, 0, 450, 788, 751, 384, 193, 677, 0, 0, 0, 867, 0, 0,
+  0, 0, 0, 0, 0, 823, 0, 0, 0, 34, 601, 620, 718, 153, 18, 765,
+  957, 806, 840, 32, 316, 835, 393, 0, 0, 306, 0, 0, 767, 0, 741, 604,
+  0, 0, 0, 0, 584, 927, 0, 0, 0, 0, 0, 535, 641, 437, 0, 860,
+  0, 0, 0, 599, 0, 0, 774, 0, 208, 0, 0, 0, 435, 811, 242, 608,
+  48, 156, 0, 0, 0, 46, 734, 0, 13, 0, 5, 442, 539, 829, 321, 515,
+  360, 433, 926, 0, 0, 748, 0, 0, 617, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 274, 624, 135, 320, 0, 0, 746, 0, 0, 0, 116, 667, 216,
+  467, 710, 971, 0, 0, 0, 0, 0, 0, 0, 341, 152, 0, 6, 21, 981,
+  0, 0, 0, 415, 845, 0, 150, 585, 720, 958, 635, 0, 0, 0, 0, 0,
+  0, 0, 0, 26, 463, 838, 154, 0, 0, 380, 233, 0, 0, 654, 0, 0,
+  0, 0, 79, 293, 198, 498, 0, 0, 588, 610, 0, 0, 0, 0, 0, 955,
+  0, 530, 0, 0, 69, 0, 0, 0, 12, 740, 0, 873, 903, 945, 0, 0,
+  0, 744, 476, 0, 0, 843, 0, 0, 532, 0, 742, 991, 0, 0, 0, 0,
+  0, 0, 143, 508, 844, 923, 0, 111, 140, 782, 989, 251, 281, 871, 552, 953,
+};
+
+const char *WA_FREQ_66_TOKENS[] = {
+  "yo",
+  "ha",
+  "li",
+  "noi",
+  "es",
+  "il",
+  "un",
+  "it",
+  "ne",
+  "deve",
+  "trovar",
+  "tri",
+  "voluntarios",
+  "lasciv",
+  "scrit",
+  "libre",
+  "pri",
+  "porcelane",
+  "esset",
+  "traduction",
+  "ama",
+  "frigid",
+  "bir",
+  "criat",
+  "leon",
+  "fusilat",
+  "creatura",
+  "slovenia",
+  "ganiat",
+  "europan",
+  "championatu",
+  "de",
+  "basketball",
+  "in",
+  "annu",
+  "2017",
+  "manja",
+  "save",
+  "ca",
+  "ver",
+  "o",
+};
+const uint16_t WA_FREQ_66_RANKS[] = {
+  0, 0, 0, 10, 29, 21, 0, 19, 0, 24, 0, 0, 36, 0, 23, 0,
+  0, 11, 0, 0, 1, 0, 0, 0, 0, 0, 0, 32, 33, 0, 0, 15,
+  0, 41, 0, 27, 6, 0, 0, 0, 0, 12, 34, 0, 0, 0, 0, 16,
+  39, 0, 13, 0, 0, 0, 9, 26, 0, 0, 0, 3, 0, 0, 5, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 17, 0, 0, 4, 14, 0, 18, 31, 0, 0, 38, 37, 0, 0, 7,
+  8, 22, 0, 0, 30, 0, 0, 0, 0, 0, 40, 0, 0, 0, 0, 0,
+  0, 0, 25, 28, 0, 0, 0, 2, 20, 0, 0, 0, 0, 35, 0, 0,
+};
+
+const char *WA_FREQ_67_TOKENS[] = {
+  "na",
+  "nke",
+  "ya",
+  "ndị",
+  "ha",
+  "a",
+  "bụ",
+  "ihe",
+  "bu",
+  "ka",
+  "afo",
+  "ubochi",
+  "ọ",
+  "o",
+  "ahụ",
+  "onye",
+  "mgbe",
+  "nwere",
+  "ma",
+  "Na",
+  "maka",
+  "dị",
+  "anyị",
+  "otu",
+  "Gregorian",
+  "ana-kpo",
+  "iri",
+  "calender",
+  "year",
+  "mmadụ",
+  "nile",
+  "were",
+  "leap",
+  "ndi",
+  "ebe",
+  "aka",
+  "ike",
+  "onwa",
+  "agugu",
+  "agwu",
+  "obodo",
+  "kpo",
+  "mere",
+  "du",
+  "Anyi",
+  "Igbo",
+  "mba",
+  "kwuru",
+  "O",
+  "isi",
+  "ana",
+  "e",
+  "abụọ",
+  "ala",
+  "Ọ",
+  "anya",
+  "ji",
+  "m",
+  "si",
+  "di",
+  "ọrụ",
+  "ọzọ",
+  "Ihe",
+  "Ndị",
+  "gị",
+  "ọtụtụ",
+  "ọbụla",
+  "iji",
+  "afọ",
+  "ego",
+  "Naijiria",
+  "Ha",
+  "na-eme",
+  "bụrụ",
+  "th",
+  "Nke",
+  "ọnụ",
+  "ọchịchị",
+  "gọọmenti",
+  "okwu",
+  "mara",
+  "iche",
+  "Onye",
+  "ụmụ",
+  "onwe",
+  "ugbu",
+  "gara",
+  "ukwu",
+  "mma",
+  "mmiri",
+  "Mgbe",
+  "agha",
+  "nọ",
+  "site",
+  "akwụkwọ",
+  "ime",
+  "mee",
+  "January",
+  "nwa",
+  "iwu",
+  "ụzọ",
+  "Buhari",
+  "gbasara",
+  "i",
+  "ruru",
+  "nwoke",
+  "ga",
+  "atọ",
+  "Ka",
+  "Juun",
+  "nnukwu",
+  "chọrọ",
+  "egwu",
+  "ise",
+  "ụlọ",
+  "A",
+  "ụbọchị",
+  "nwanyị",
+  "nri",
+  "a.",
+  "eji",
+  "mbụ",
+  "n’ime",
+  "ụwa",
+  "mana",
+  "Nigeria",
+  "nyere",
+  "tupu",
+  "ọrịa",
+  "aga",
+  "ọma",
+  "ụdị",
+  "obi",
+  "2016",
+  "dịka",
+  "ama",
+  "oke",
+  "Jenụwarị",
+  "KBC",
+  "n’ihu",
+  "Mana",
+  "anọ",
+  "na-ekwu",
+  "kwesiri",
+  "kwuo",
+  "Mee",
+  "Mbe",
+  "akụkọ",
+  "oge",
+  "n’ihe",
+  "asụsụ",
+  "nweghị",
+  "ga-eme",
+  "ozi",
+  "Eprel",
+  "Maachị",
+  "ahu",
+  "hụrụ",
+  "jiri",
+  "siri",
+  "ọkụ",
+  "2017",
+  "Ọtụtụ",
+  "karịrị",
+  "kpọrọ",
+  "ọnwa",
+  "bekee",
+  "hụ",
+  "sị",
+  "ndụ",
+  "asaa",
+  "màọbụ",
+  "nanị",
+  "no",
+  "aha",
+  "usoro",
+  "Julaị",
+  "Novemba",
+  "Febrụwarị",
+  "etu",
+  "madu",
+  "Ọktoba",
+  "E",
+  "Septemba",
+  "gwara",
+  "n’aka",
+  "kwa",
+  "ị",
+  "ụfọdụ",
+  "Otu",
+  "ojii",
+  "Anyị",
+  "bidoro",
+  "na-agba",
+  "anaghị",
+  "gbara",
+  "ọhụrụ",
+  "mbu",
+  "ruo",
+  "elu",
+  "leap-year",
+  "ahịa",
+  "of",
+  "na-ahụ",
+  "n’ụlọ",
+  "isii",
+  "n’ala",
+  "uwe",
+  "eme",
+  "mkpa",
+  "bụla",
+  "steeti",
+  "Steeti",
+  "nna",
+  "pụtara",
+  "ikpe",
+  "1.",
+  "narị",
+  "nyocha",
+  "ezi",
+  "mmanụ",
+  "ngwa",
+  "ọnọdụ",
+  "mbọ",
+  "Networks",
+  "na-arụ",
+  "nwe",
+  "n’afọ",
+  "ọgụ",
+  "abụghị",
+  "nne",
+  "non-leap",
+  "nwata",
+  "Ya",
+  "Önwa",
+  "niile",
+  "n’ahụ",
+  "ọsọ",
+  "ụka",
+  "anụ",
+  "kpatara",
+  "n'ime",
+  "na-achị",
+  "n’obodo",
+  "Chukwu",
+  "19th",
+  "wee",
+  "mmadu",
+  "nta",
+  "abuo",
+  "nwunye",
+  "Naịjirịa",
+  "buru",
+  "esi",
+  "gburu",
+  "taa",
+  "Amerịka",
+  "asatọ",
+  "ga-eji",
+  "n’isi",
+  "na-aga",
+  "n’ihi",
+  "pụrụ",
+  "ọgwụ",
+  "agaghị",
+  "eze",
+  "mkpụrụ",
+  "mụ",
+  "na-achọ",
+  "Mazi",
+  "be",
+  "hapụ",
+  "kacha",
+  "n’ụwa",
+  "Amerịkà",
+  "February",
+  "ga-esi",
+  "kemgbe",
+  "nde",
+  "nnyefe",
+  "nye",
+  "n’oge",
+  "puku",
+  "bukwa",
+  "ịbụ",
+  "Boko",
+  "Haram",
+  "Kedu",
+  "Michael",
+  "Ndi",
+  "anyi",
+  "gwa",
+  "kedu",
+  "ọmẹka",
+  "adịghị",
+  "nka",
+  "omume",
+  "ụgwọ",
+  "n’ebe",
+  "enweghị",
+  "na-enye",
+  "nkwado",
+  "onyeisi",
+  "so",
+  "Í",
+  "29",
+  "Amerikạ",
+  "C.",
+  "agba",
+  "ga-abụ",
+  "ibe",
+  "karịa",
+  "mádu",
+  "n’otu",
+  "ọjọọ",
+  "ụkwụ",
+  "I",
+  "bi",
+  "kama",
+  "nso",
+  "nsogbu",
+  "uru",
+  "amaghị",
+  "nwee",
+  "ogbunigwe",
+  "ụmụaka",
+  "20",
+  "30",
+  "Alokwem",
+  "Eze",
+  "June",
+  "akwa",
+  "bara",
+  "ntị",
+  "zuru",
+  "57",
+  "n’ọnwa",
+  "ọnwụ",
+  "3",
+  "ezigbo",
+  "mpaghara",
+  "n’ụzọ",
+  "na-akpọ",
+  "nor",
+  "n’anya",
+  "May",
+  "ihu",
+  "ne",
+  "n’ọnụ",
+  "tụrụ",
+  "uwa",
+  "ụlọọrụ",
+  "15",
+  "27",
+  "Obama",
+  "afọr",
+  "ato",
+  "bido",
+  "iwe",
+  "njem",
+  "nwụrụ",
+  "nà",
+  "oku",
+  "pụta",
+  "Ebe",
+  "azụ",
+  "chi",
+  "nwetere",
+  "nzukọ",
+  "10",
+  "Gọọmenti",
+  "Jonathan",
+  "Naigeria",
+  "chọpụtara",
+  "enyi",
+  "gosiri",
+  "kachasị",
+  "nchekwa",
+  "ngagharị",
+  "25",
+  "Disemba",
+  "ajọ",
+  "ohere",
+  "ugwu",
+  "Ọgọọst",
+  "18",
+  "achọ",
+  "ndu",
+  "nkeji",
+  "okenye",
+  "ole",
+  "shuga",
+  "12",
+  "6",
+  "March",
+  "The",
+  "agwa",
+  "bịara",
+  "eziokwu",
+  "gosi",
+  "nụrụ",
+  "onu",
+  "tinye",
+  "ụnụ",
+  "19",
+  "4",
+  "Trump",
+  "etiti",
+  "oru",
+  "ȯ",
+  "16",
+  "28",
+  "Biafra",
+  "Kemgbe",
+  "Ma",
+  "N’ihi",
+  "bịa",
+  "bụzi",
+  "chere",
+  "echiche",
+  "igwe",
+  "sayensi",
+  "tinyere",
+  "ulo",
+  "àlà",
+  "ịma",
+  "ọcha",
+  "ọkwa",
+  "17",
+  "26",
+  "5",
+  "Naịjiria",
+  "ajụjụ",
+  "chọọ",
+  "ibu",
+  "na-adịghị",
+  "obere",
+  "osisi",
+  "ịhe",
+  "11",
+  "2",
+  "8",
+  "Anambra",
+  "Nnamdi",
+  "kà",
+  "na-akwado",
+  "na-enwe",
+  "n’obi",
+  "n’ọchịchị",
+  "n’ụbọchị",
+  "ụdaume",
+  "ụgbọ",
+  "ụgbọala",
+  "21",
+  "9",
+  "April",
+  "Maka",
+  "Odeniigbo",
+  "dara",
+  "egbe",
+  "ekwe",
+  "jụrụ",
+  "mgba",
+  "na-eche",
+  "nche",
+  "ngwaahịa",
+  "njikọ",
+  "udo",
+  "ébé",
+  "13",
+  "14",
+  "22",
+  "23",
+  "31",
+  "7",
+  "nd",
+  "njọ",
+  "ozo",
+  "st",
+  "ó",
+  "Ụfọdụ",
+  "24",
+  "9th",
+  "Afrịka",
+  "Bekee",
+  "aja",
+  "ga-ahụ",
+  "igbo",
+  "ije",
+  "ikuku",
+  "nkata",
+  "wireless",
+  "wo",
+  "íshí",
+  "ọkụkọ",
+  "Ụmụ",
+  "1",
+  "2013",
+  "Agụ",
+  "Awụsa",
+  "China",
+  "Kanụ",
+  "Obodo",
+  "abalị",
+  "akara",
+  "arụ",
+  "ezinụlọ",
+  "he",
+  "mmụọ",
+  "nkịtị",
+  "n’akụkụ",
+  "Tupu",
+  "gbaa",
+  "ijeri",
+  "màkà",
+  "n'elu",
+  "nakwa",
+  "oche",
+  "rd",
+  "Mmadụ",
+  "asị",
+  "ghara",
+  "na-eji",
+  "nchọpụta",
+  "ndọrọ",
+  "nwanne",
+  "nọrọ",
+  "uche",
+  "ọkaikpe",
+  "Izrel",
+  "Lagos",
+  "amị",
+  "bula",
+  "bụghị",
+  "icheiche",
+  "ikwu",
+  "inye",
+  "ire",
+  "kere",
+  "na-enweghị",
+  "ngalaba",
+  "n’azụ",
+  "wepụtara",
+  "ọdụ",
+  "ọha",
+  "July",
+  "Naịrà",
+  "Onyeisi",
+  "akpa",
+  "cha",
+  "dịrị",
+  "ehi",
+  "enye",
+  "ganye",
+  "há",
+  "ikike",
+  "ishii",
+  "itenanị",
+  "mahadum",
+  "mgbanwe",
+  "na-atụ",
+  "ozor",
+  "shí",
+  "soro",
+  "ịgba",
+  "Voice",
+  "gbuo",
+  "iyi",
+  "kwụrụ",
+  "nọr",
+  "n’akwụkwọ",
+  "shi",
+  "Afrika",
+  "Ajụjụ",
+  "Amerika",
+  "Oge",
+  "akụkụ",
+  "anụmanụ",
+  "asato",
+  "dere",
+  "dum",
+  "egbu",
+  "enwe",
+  "gi",
+  "izuụka",
+  "kwụsị",
+  "mgbasa",
+  "na-adị",
+  "na-akpa",
+  "na-eri",
+  "nkuzi",
+  "nwayọọ",
+  "omebe",
+  "omenala",
+  "tata",
+  "ụgbọelu",
+  "ụtọ",
+  "5th",
+  "Chineke",
+  "DSS",
+  "agụụ",
+  "and",
+  "calendar",
+  "data",
+  "ga-adị",
+  "gaghị",
+  "gụnyere",
+  "mechara",
+  "na-enyocha",
+  "na-eto",
+  "netwọk",
+  "n’",
+  "out",
+  "wetere",
+  "ịhụ",
+  "20th",
+  "Akụkọ",
+  "December",
+  "EFCC",
+  "Enwe",
+  "Kristi",
+  "London",
+  "ano",
+  "anwụ",
+  "atụmatụ",
+  "bọọlụ",
+  "bụkwazi",
+  "ilu",
+  "inwe",
+  "itoolu",
+  "kwere",
+  "makana",
+  "me",
+  "metụtara",
+  "nga",
+  "nkwa",
+  "n’etiti",
+  "obukwa",
+  "Imo",
+  "Iri",
+  "Okwu",
+  "Site",
+  "akpọ",
+  "anwụọla",
+  "anyanwu",
+  "gboo",
+  "jupụtara",
+  "mbido",
+  "megide",
+  "mpụ",
+  "naịrà",
+  "ochie",
+  "29th",
+  "abụ",
+  "akarị",
+  "akwukwo",
+  "akụ",
+  "amara",
+  "dibịa",
+  "ezu",
+  "mgbọ",
+  "na-egosi",
+  "ntụli",
+  "nwanyi",
+  "nụ",
+  "rụọ",
+  "yá",
+  "ọgụgụ",
+  "Ụdị",
+  "ụbụrụ",
+  "23rd",
+  "26th",
+  "Fulani",
+  "Gọvanọ",
+  "Isi",
+  "Nanị",
+  "achọghị",
+  "adị",
+  "ede",
+  "egwuregwu",
+  "ezo",
+  "fọk",
+  "gaa",
+  "gara-aga",
+  "ihụ",
+  "kpara",
+  "kwesịrị",
+  "mmanwụ",
+  "mèrè",
+  "na-eso",
+  "né",
+  "n’ike",
+  "n’ọtụtụ",
+  "oyibo",
+  "ozu",
+  "video",
+  "áhà",
+  "ọbara",
+  "27th",
+  "APC",
+  "Iji",
+  "Mmiri",
+  "Obu",
+  "Rọshịa",
+  "South",
+  "akwụ",
+  "biko",
+  "ekpere",
+  "hé",
+  "kasi",
+  "kwukwaziri",
+  "malitere",
+  "mata",
+  "miri",
+  "mkpụrụokwu",
+  "mmemme",
+  "mụrụ",
+  "nsusu",
+  "ntụ",
+  "nwèrè",
+  "ogologo",
+  "orü",
+  "soja",
+  "Ọrịa",
+  "ụmụnwanyị",
+  "ụtụtụ",
+  "Mba",
+  "New",
+  "Nwoke",
+  "Okorocha",
+  "ThruLink",
+  "agụ",
+  "ahụhụ",
+  "asụ",
+  "butere",
+  "dịghị",
+  "dịkwa",
+  "eriri",
+  "foto",
+  "ga-ebido",
+  "gọvanọ",
+  "ishi",
+  "jụọ",
+  "kara",
+  "mberede",
+  "mmeri",
+  "nara",
+  "n’elu",
+  "onyinye",
+  "osimiri",
+  "ịdị",
+  "ọbụghị",
+  "10th",
+  "14th",
+  "2015",
+  "25th",
+  "Aha",
+  "Ike",
+  "Lasa",
+  "Nkịta",
+  "abatara",
+  "banyere",
+  "bata",
+  "eri",
+  "gwam",
+  "izu",
+  "juru",
+  "kpọọ",
+  "kwado",
+  "mbe",
+  "mkpọrọ",
+  "na-abịa",
+  "na-ebute",
+  "na-egbu",
+  "nkiri",
+  "n’akpa",
+  "n’asụsụ",
+  "omekome",
+  "ozigbo",
+  "ịhụnanya",
+  "ọla",
+  "ụra",
+  "24th",
+  "2nd",
+  "Achebe",
+  "Asụsụ",
+  "Ego",
+  "Goodluck",
+  "IP",
+  "Iran",
+  "Nkọwa",
+  "Ugbu",
+  "batara",
+  "egbuola",
+  "elekere",
+  "ese",
+  "ga-enyere",
+  "igbu",
+  "ishií",
+  "merenụ",
+  "mfe",
+  "mkpuru",
+  "mpe",
+  "n'uwa",
+  "na-abụghị",
+  "nsọ",
+  "ocha",
+  "ofe",
+  "omụmụ",
+  "rie",
+  "rụrụ",
+  "sịrị",
+  "taata",
+  "tara",
+  "wuru",
+  "élú",
+  "Ọnwụ",
+  "Ọnụ",
+  "ọka",
+  "ọtọ",
+  "15th",
+  "17th",
+  "2007",
+  "21st",
+  "6th",
+  "Fiva",
+  "Goodluck Jonathan",
+  "IPOB",
+  "Uche",
+  "abu",
+  "amụrụ",
+  "atụ",
+  "azụmahịa",
+  "ebumnobi",
+  "eto",
+  "ewu",
+  "ga-asị",
+  "gafee",
+  "iko",
+  "inwete",
+  "iteghete",
+  "jide",
+  "kwara",
+  "kwụ",
+  "merụrụ",
+  "n'etiti",
+  "na-ada",
+  "na-agwa",
+  "na-ele",
+  "naghị",
+  "nwete",
+  "nzu",
+  "n’Abuja",
+  "n’ọrụ",
+  "okporo",
+  "olu",
+  "otú",
+  "uka",
+  "ịmara",
+  "13th",
+  "22nd",
+  "30th",
+  "3rd",
+  "7th",
+  "Barack",
+  "Chi",
+  "Europe",
+  "Fraịdee",
+  "Nwa",
+  "N’ikpeazụ",
+  "Ocean",
+  "abịa",
+  "aghụghọ",
+  "akpụ",
+  "amadi",
+  "anyanwụ",
+  "apụghị",
+  "dika",
+  "ekwesịghị",
+  "ga-agba",
+  "ga-enye",
+  "itinye",
+  "jere",
+  "jidere",
+  "kwaa",
+  "minista",
+  "mmanya",
+  "mmụta",
+  "na-anụ",
+  "na-ebu",
+  "nghọta",
+  "ngwá",
+  "nsị",
+  "n’abalị",
+  "n’ogige",
+  "n’okwu",
+  "pụọ",
+  "sọsọ",
+  "yana",
+  "ímé",
+  "ọdụdụ",
+  "ọgbakọ",
+  "ọhịa",
+  "ọtú",
+  "ụnyaahụ",
+  "12th",
+  "16th",
+  "28th",
+  "31st",
+  "4th",
+  "8th",
+  "Ama",
+  "Anya",
+  "City",
+  "Gịnị",
+  "Nna",
+  "N’afọ",
+  "Obiano",
+  "PoE",
+  "Taata",
+  "ada",
+  "akị",
+  "amịrị",
+  "by",
+  "chee",
+  "dí",
+  "ekwesi",
+  "ewere",
+  "ga-enwe",
+  "izizi",
+  "kwenyere",
+  "lee",
+  "n'afọ",
+  "n'oge",
+  "n'ụzọ",
+  "na-agbanyeghi",
+  "na-ede",
+  "na-ere",
+  "na-etinye",
+  "nhọpụta",
+  "nkwekọrịta",
+  "nwéré",
+  "n’ezinụlọ",
+  "n’ụdị",
+  "obibi",
+  "olileanya",
+  "onyonyo",
+  "ugbo",
+  "ámá",
+  "ịche",
+  "ọlụ",
+  "ụtara",
+  "100",
+  "18th",
+  "2008",
+  "2012",
+  "Aka",
+  "Ala",
+  "America",
+  "Biko",
+  "Delta",
+  "Event",
+  "Ji",
+  "Nduru",
+  "Obi",
+  "UN",
+  "Ugwu",
+  "Wikipedia",
+  "York",
+  "anumanu",
+  "asịwo",
+  "añụrị",
+  "banye",
+  "bere",
+  "chọpụta",
+  "dịkà",
+  "emume",
+  "eso",
+  "gịnị",
+  "ikikere",
+  "jikọrọ",
+  "kasị",
+  "kpọmkwem",
+  "kwadoro",
+  "kwu",
+  "kárírí",
+  "maghị",
+  "mebe",
+  "mkpà",
+  "mmasị",
+  "n",
+  "na-akọwa",
+  "na-asị",
+  "na-ebe",
+  "na-eru",
+  "ngwọta",
+  "ochichi",
+  "oji",
+  "onyunyo",
+  "ta",
+};
+const uint16_t WA_FREQ_67_RANKS[] = {
+  330, 229, 371, 432, 588, 778, 444, 832, 172, 847, 0, 648, 77, 684, 66, 938,
+  0, 935, 0, 0, 0, 163, 0, 828, 782, 577, 92, 379, 793, 0, 953, 550,
+  0, 345, 706, 965, 0, 538, 837, 0, 0, 703, 159, 190, 0, 892, 0, 0,
+  526, 140, 773, 0, 0, 452, 549, 930, 761, 809, 928, 0, 790, 994, 0, 33,
+  133, 0, 9, 0, 236, 225, 106, 0, 683, 0, 384, 312, 428, 0, 0, 0,
+  335, 461, 0, 0, 0, 0, 500, 0, 934, 0, 0, 0, 729, 475, 191, 0,
+  0, 0, 0, 0, 752, 0, 402, 0, 0, 164, 0, 0, 0, 0, 189, 0,
+  0, 0, 0, 0, 0, 593, 126, 245, 0, 157, 346, 789, 0, 941, 834, 0,
+  0, 0, 0, 0, 206, 831, 179, 557, 561, 813, 0, 0, 302, 30, 125, 826,
+  0, 0, 0, 590, 0, 199, 0, 0, 0, 0, 0, 0, 948, 185, 570, 829,
+  0, 0, 0, 0, 57, 0, 0, 0, 0, 0, 0, 0, 0, 0, 424, 260,
+  728, 4, 483, 0, 43, 0, 42, 0, 0, 0, 0, 132, 0, 407, 289, 439,
+  0, 0, 171, 0, 0, 0, 0, 0, 0, 0, 719, 0, 0, 0, 0, 738,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 696, 0, 0, 0, 0, 0, 0,
+  709, 0, 956, 0, 0, 0, 603, 616, 619, 68, 0, 0, 0, 0, 0, 652,
+  135, 0, 0, 978, 0, 0, 0, 0, 0, 47, 445, 0, 0, 845, 908, 791,
+  0, 0, 280, 195, 0, 466, 0, 877, 0, 741, 651, 478, 0, 0, 0, 0,
+  594, 0, 0, 243, 147, 0, 0, 0, 0, 0, 919, 0, 0, 0, 0, 532,
+  851, 899, 0, 0, 0, 0, 0, 228, 332, 0, 0, 0, 0, 368, 0, 0,
+  0, 0, 0, 0, 300, 0, 0, 182, 325, 760, 0, 0, 536, 975, 932, 0,
+  0, 0, 0, 0, 429, 0, 99, 123, 476, 0, 0, 0, 0, 0, 0, 20,
+  0, 804, 0, 0, 201, 521, 647, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 799, 735, 0, 0, 881, 753, 0, 0, 129, 0, 795, 390, 207, 618, 0,
+  215, 0, 882, 0, 0, 0, 378, 0, 197, 512, 0, 555, 219, 917, 0, 925,
+  0, 0, 0, 0, 0, 0, 110, 0, 679, 0, 18, 0, 0, 596, 693, 672,
+  673, 124, 0, 0, 0, 0, 0, 0, 0, 685, 0, 0, 768, 0, 0, 0,
+  146, 622, 2, 633, 0, 0, 552, 0, 609, 658, 942, 954, 0, 0, 0, 0,
+  0, 427, 0, 6, 370, 440, 489, 667, 772, 955, 34, 316, 0, 0, 0, 462,
+  0, 0, 0, 852, 0, 583, 0, 0, 0, 0, 0, 0, 823, 974, 319, 581,
+  997, 0, 0, 0, 0, 0, 334, 0, 0, 0, 0, 0, 655, 0, 0, 0,
+  0, 95, 115, 0, 937, 0, 888, 153, 542, 558, 571, 0, 926, 0, 0, 284,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 635, 575, 0, 0, 525,
+  0, 0, 0, 0, 776, 136, 213, 0, 0, 0, 0, 0, 0, 0, 453, 933,
+  0, 463, 0, 235, 0, 0, 0, 36, 996, 0, 121, 305, 675, 0, 0, 677,
+  149, 317, 93, 0, 404, 0, 632, 798, 118, 961, 449, 0, 599, 419, 309, 399,
+  0, 0, 0, 0, 0, 0, 854, 222, 807, 294, 509, 543, 0, 0, 0, 698,
+  628, 629, 682, 39, 850, 0, 0, 0, 0, 0, 0, 560, 0, 0, 0, 522,
+  991, 0, 839, 0, 0, 0, 0, 0, 0, 0, 0, 352, 0, 264, 0, 0,
+  358, 766, 949, 0, 794, 0, 0, 885, 724, 381, 114, 886, 0, 220, 545, 218,
+  291, 764, 107, 777, 283, 288, 127, 397, 611, 425, 744, 0, 255, 713, 0, 0,
+  151, 0, 0, 840, 0, 0, 0, 970, 0, 0, 0, 0, 0, 0, 792, 0,
+  0, 122, 502, 0, 459, 0, 657, 0, 0, 270, 0, 0, 0, 0, 55, 0,
+  0, 0, 0, 890, 1, 0, 0, 0, 79, 565, 0, 0, 800, 0, 0, 0,
+  0, 0, 204, 825, 194, 297, 473, 0, 0, 0, 0, 0, 0, 0, 518, 0,
+  0, 725, 0, 897, 375, 524, 636, 0, 943, 0, 0, 53, 816, 0, 637, 0,
+  969, 0, 0, 0, 0, 76, 433, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  750, 0, 0, 0, 98, 0, 0, 716, 0, 224, 314, 142, 26, 496, 904, 535,
+  0, 0, 165, 0, 0, 269, 310, 485, 0, 0, 0, 145, 0, 664, 130, 0,
+  838, 0, 824, 0, 844, 952, 0, 0, 359, 361, 553, 154, 574, 576, 0, 0,
+  0, 875, 0, 0, 240, 0, 326, 13, 89, 279, 714, 181, 208, 369, 754, 911,
+  958, 14, 60, 770, 659, 367, 0, 0, 0, 0, 929, 745, 0, 0, 0, 0,
+  0, 72, 251, 0, 0, 0, 0, 0, 139, 143, 299, 328, 380, 566, 0, 0,
+  0, 644, 420, 737, 287, 883, 0, 0, 27, 234, 771, 924, 105, 327, 109, 0,
+  242, 0, 385, 600, 650, 418, 944, 372, 40, 156, 438, 406, 23, 48, 88, 383,
+  523, 527, 630, 670, 674, 746, 579, 787, 811, 814, 819, 830, 486, 984, 104, 0,
+  83, 389, 285, 0, 871, 907, 0, 0, 54, 0, 0, 0, 81, 529, 0, 0,
+  0, 0, 0, 0, 0, 446, 0, 0, 423, 998, 946, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 608, 0, 69, 0, 0, 0, 152, 67, 680, 0, 0, 0,
+  0, 0, 0, 41, 158, 212, 282, 322, 559, 0, 959, 0, 0, 0, 12, 320,
+  373, 979, 0, 0, 0, 860, 626, 607, 0, 0, 0, 0, 211, 0, 0, 0,
+  0, 0, 0, 262, 0, 0, 605, 0, 0, 0, 128, 290, 356, 451, 272, 774,
+  0, 835, 336, 148, 862, 645, 393, 8, 620, 801, 113, 257, 501, 660, 751, 915,
+  0, 311, 1000, 503, 756, 0, 0, 573, 827, 863, 363, 0, 506, 318, 339, 85,
+  0, 705, 0, 0, 0, 507, 0, 0, 413, 0, 606, 480, 0, 111, 669, 742,
+  0, 0, 0, 0, 0, 0, 0, 37, 447, 0, 0, 0, 162, 131, 180, 360,
+  872, 0, 0, 177, 414, 198, 721, 836, 0, 0, 0, 0, 0, 22, 972, 0,
+  0, 0, 112, 0, 0, 0, 217, 0, 0, 0, 10, 0, 0, 810, 0, 0,
+  0, 196, 276, 223, 484, 0, 348, 591, 913, 0, 0, 0, 0, 0, 35, 0,
+  0, 0, 0, 0, 874, 0, 0, 715, 0, 654, 730, 0, 0, 353, 0, 909,
+  0, 0, 51, 49, 749, 803, 859, 842, 0, 653, 443, 138, 586, 0, 246, 0,
+  0, 0, 0, 0, 59, 422, 718, 649, 203, 781, 520, 812, 983, 0, 0, 0,
+  0, 0, 0, 784, 849, 0, 169, 237, 0, 75, 357, 499, 16, 492, 0, 0,
+  144, 141, 947, 0, 94, 0, 0, 0, 0, 0, 0, 642, 0, 275, 732, 726,
+  0, 513, 306, 0, 0, 0, 901, 0, 386, 0, 641, 551, 598, 349, 0, 338,
+  0, 0, 273, 395, 293, 161, 0, 0, 0, 80, 0, 304, 858, 0, 0, 292,
+  331, 84, 0, 0, 0, 0, 0, 0, 0, 394, 0, 0, 434, 0, 0, 0,
+  464, 806, 62, 91, 238, 662, 973, 989, 0, 448, 0, 0, 0, 0, 788, 0,
+  0, 0, 0, 0, 259, 515, 595, 786, 0, 562, 528, 0, 748, 248, 0, 0,
+  690, 0, 755, 0, 688, 519, 0, 202, 0, 0, 0, 0, 960, 0, 0, 0,
+  695, 0, 587, 0, 0, 0, 274, 166, 0, 0, 263, 843, 19, 0, 0, 340,
+  0, 643, 0, 0, 0, 0, 0, 209, 0, 785, 747, 0, 0, 0, 0, 0,
+  0, 624, 0, 377, 639, 90, 0, 0, 0, 0, 0, 0, 568, 711, 0, 0,
+  7, 0, 0, 350, 0, 0, 0, 0, 757, 0, 686, 0, 0, 0, 221, 455,
+  708, 323, 0, 0, 676, 482, 0, 923, 0, 0, 880, 0, 0, 0, 0, 0,
+  0, 986, 0, 0, 0, 494, 70, 102, 168, 32, 281, 733, 17, 950, 976, 987,
+  0, 96, 533, 868, 45, 916, 232, 0, 0, 0, 906, 410, 985, 101, 992, 441,
+  0, 0, 0, 0, 541, 0, 0, 303, 855, 638, 0, 0, 623, 0, 0, 0,
+  0, 0, 120, 0, 0, 0, 731, 0, 0, 0, 0, 278, 437, 0, 0, 392,
+  0, 780, 457, 175, 244, 867, 891, 0, 450, 0, 401, 0, 0, 0, 0, 436,
+  497, 216, 417, 694, 717, 853, 945, 0, 0, 0, 856, 0, 0, 324, 0, 534,
+  0, 712, 0, 58, 0, 271, 0, 0, 0, 0, 21, 578, 0, 0, 0, 0,
+  0, 614, 699, 442, 296, 0, 268, 0, 298, 0, 0, 0, 0, 0, 739, 627,
+  0, 241, 29, 63, 435, 678, 0, 530, 474, 767, 0, 187, 0, 374, 0, 456,
+  365, 0, 0, 0, 0, 0, 0, 0, 821, 0, 0, 779, 0, 0, 977, 689,
+  736, 661, 817, 254, 431, 833, 103, 337, 382, 544, 0, 0, 0, 0, 0, 467,
+  0, 0, 0, 0, 0, 65, 0, 295, 0, 931, 0, 0, 391, 584, 0, 376,
+  491, 569, 160, 613, 192, 815, 495, 411, 71, 857, 936, 31, 968, 74, 481, 510,
+  775, 921, 0, 869, 0, 0, 0, 415, 0, 0, 0, 0, 876, 0, 0, 802,
+  517, 537, 498, 740, 822, 0, 0, 0, 0, 256, 134, 0, 585, 398, 426, 0,
+  0, 0, 0, 0, 615, 702, 820, 884, 155, 0, 0, 0, 210, 97, 887, 0,
+  0, 286, 589, 707, 797, 722, 0, 0, 0, 0, 0, 548, 50, 308, 922, 214,
+  940, 0, 333, 0, 0, 0, 0, 0, 0, 258, 0, 0, 604, 0, 342, 472,
+  846, 0, 0, 0, 687, 668, 0, 873, 612, 0, 0, 0, 0, 0, 0, 0,
+  902, 971, 547, 52, 471, 870, 0, 5, 681, 964, 511, 0, 0, 0, 0, 621,
+  910, 0, 56, 914, 704, 0, 0, 0, 0, 841, 137, 186, 866, 0, 0, 184,
+  656, 61, 329, 343, 116, 366, 540, 617, 249, 0, 0, 277, 0, 0, 0, 0,
+  46, 351, 0, 0, 0, 0, 0, 0, 0, 0, 762, 0, 0, 188, 666, 0,
+  0, 759, 0, 0, 861, 0, 100, 396, 539, 765, 0, 848, 0, 734, 0, 0,
+  0, 0, 0, 44, 796, 0, 0, 0, 963, 723, 0, 864, 0, 0, 0, 546,
+  671, 567, 0, 0, 0, 0, 28, 64, 610, 0, 697, 0, 0, 0, 769, 0,
+  0, 700, 580, 0, 0, 3, 479, 665, 0, 226, 11, 0, 0, 0, 0, 408,
+  0, 0, 0, 0, 0, 0, 0, 261, 982, 0, 0, 0, 878, 0, 0, 0,
+  0, 230, 0, 362, 625, 967, 0, 344, 602, 0, 0, 0, 266, 0, 0, 0,
+  0, 0, 701, 0, 0, 995, 0, 307, 460, 150, 0, 0, 0, 0, 0, 0,
+  0, 465, 0, 117, 818, 563, 0, 920, 0, 0, 564, 25, 247, 364, 981, 0,
+  405, 354, 493, 927, 939, 0, 0, 0, 430, 582, 646, 894, 980, 918, 87, 0,
+  0, 710, 265, 783, 962, 990, 0, 692, 905, 170, 514, 0, 0, 0, 38, 250,
+  227, 388, 634, 301, 663, 0, 531, 0, 0, 0, 108, 951, 119, 315, 999, 0,
+  0, 454, 597, 0, 73, 321, 403, 0, 504, 898, 0, 516, 0, 0, 0, 0,
+  0, 400, 0, 0, 0, 267, 193, 86, 556, 758, 879, 912, 82, 508, 896, 0,
+  0, 805, 0, 0, 0, 490, 865, 0, 0, 966, 0, 341, 205, 895, 468, 601,
+  808, 0, 988, 0, 893, 743, 0, 347, 239, 200, 477, 470, 409, 487, 889, 458,
+  0, 421, 0, 0, 167, 720, 691, 183, 727, 900, 0, 488, 0, 0, 0, 0,
+  0, 0, 252, 0, 0, 0, 0, 0, 957, 993, 0, 0, 640, 0, 78, 0,
+  0, 0, 253, 176, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  903, 0, 313, 0, 231, 0, 0, 0, 0, 0, 416, 0, 469, 0, 355, 0,
+  0, 173, 387, 24, 412, 592, 631, 0, 0, 0, 0, 0, 233, 554, 0, 0,
+  0, 763, 0, 0, 505, 0, 0, 15, 572, 0, 0, 0, 0, 0, 174, 178,
+};
+
+const char *WA_FREQ_68_TOKENS[] = {
+  "ég",
+  "ađ",
+  "er",
+  "í",
+  "ekki",
+  "ūađ",
+  "og",
+  "á",
+  "ūú",
+  "viđ",
+  "hann",
+  "ūetta",
+  "hvađ",
+  "sem",
+  "mér",
+  "til",
+  "en",
+  "međ",
+  "ūér",
+  "fyrir",
+  "af",
+  "um",
+  "var",
+  "mig",
+  "ūig",
+  "að",
+  "já",
+  "hún",
+  "nei",
+  "ūví",
+  "allt",
+  "bara",
+  "svo",
+  "eru",
+  "ef",
+  "ert",
+  "ūá",
+  "það",
+  "ertu",
+  "eins",
+  "okkur",
+  "vera",
+  "lagi",
+  "eftir",
+  "gera",
+  "veit",
+  "ūiđ",
+  "hefur",
+  "hér",
+  "ūeir",
+  "nú",
+  "frá",
+  "fara",
+  "þú",
+  "hvernig",
+  "við",
+  "út",
+  "ūegar",
+  "hef",
+  "upp",
+  "aftur",
+  "honum",
+  "svona",
+  "minn",
+  "ekkert",
+  "vel",
+  "sé",
+  "hana",
+  "verđur",
+  "hver",
+  "þetta",
+  "ykkur",
+  "ūessu",
+  "vil",
+  "veriđ",
+  "komdu",
+  "segja",
+  "erum",
+  "eđa",
+  "hérna",
+  "úr",
+  "get",
+  "hverju",
+  "aldrei",
+  "gott",
+  "hvar",
+  "hafa",
+  "hjá",
+  "getur",
+  "koma",
+  "okkar",
+  "viltu",
+  "inn",
+  "fá",
+  "núna",
+  "mađur",
+  "takk",
+  "eitthvađ",
+  "kannski",
+  "hvað",
+  "sagđi",
+  "herra",
+  "ūau",
+  "hans",
+  "ūarna",
+  "ūarf",
+  "tala",
+  "henni",
+  "væri",
+  "sjá",
+  "ūar",
+  "held",
+  "líka",
+  "fer",
+  "ūín",
+  "áfram",
+  "ūeim",
+  "með",
+  "rétt",
+  "ūess",
+  "sér",
+  "farđu",
+  "ūinn",
+  "mjög",
+  "vegna",
+  "kemur",
+  "saman",
+  "gert",
+  "þér",
+  "sá",
+  "mín",
+  "einn",
+  "enn",
+  "verđ",
+  "gæti",
+  "alltaf",
+  "allir",
+  "ætla",
+  "of",
+  "hafi",
+  "pabbi",
+  "yfir",
+  "má",
+  "ūessi",
+  "mamma",
+  "enginn",
+  "kom",
+  "dag",
+  "skal",
+  "komiđ",
+  "sig",
+  "heldur",
+  "veistu",
+  "bíddu",
+  "vita",
+  "mitt",
+  "förum",
+  "heim",
+  "guđ",
+  "sama",
+  "þig",
+  "átt",
+  "tíma",
+  "ūakka",
+  "einhver",
+  "höfum",
+  "finnst",
+  "ūær",
+  "mikiđ",
+  "fariđ",
+  "láttu",
+  "niđur",
+  "jæja",
+  "getum",
+  "hefđi",
+  "gķđur",
+  "fyrirgefđu",
+  "hingađ",
+  "mun",
+  "segir",
+  "meira",
+  "taka",
+  "vildi",
+  "veist",
+  "ađeins",
+  "fjandinn",
+  "satt",
+  "áđur",
+  "segđu",
+  "elskan",
+  "ūessa",
+  "eitt",
+  "hvert",
+  "vertu",
+  "voru",
+  "halda",
+  "alla",
+  "myndi",
+  "öll",
+  "vill",
+  "gerđu",
+  "hvort",
+  "fram",
+  "kvöld",
+  "einu",
+  "ūitt",
+  "láta",
+  "gerir",
+  "því",
+  "sagt",
+  "ykkar",
+  "verđum",
+  "hættu",
+  "hefurđu",
+  "alveg",
+  "annađ",
+  "hélt",
+  "fķlk",
+  "ķ",
+  "hennar",
+  "vilt",
+  "hæ",
+  "stađ",
+  "fķr",
+  "sjáđu",
+  "ár",
+  "leiđ",
+  "verđa",
+  "vinur",
+  "eina",
+  "gerđi",
+  "geri",
+  "séđ",
+  "sinni",
+  "mína",
+  "þá",
+  "hvađa",
+  "reyna",
+  "neitt",
+  "ætti",
+  "hvers",
+  "hallķ",
+  "gaman",
+  "menn",
+  "elska",
+  "vissi",
+  "skil",
+  "finna",
+  "langar",
+  "auđvitađ",
+  "vinna",
+  "án",
+  "drepa",
+  "eruđ",
+  "frábært",
+  "ūessum",
+  "undir",
+  "mínum",
+  "áttu",
+  "strax",
+  "hugsa",
+  "síđan",
+  "ūeirra",
+  "eigum",
+  "engin",
+  "morgun",
+  "öllum",
+  "einmitt",
+  "alvöru",
+  "viss",
+  "taktu",
+  "ūína",
+  "fimm",
+  "varst",
+  "fékk",
+  "kem",
+  "gengur",
+  "jú",
+  "ūennan",
+  "leitt",
+  "ná",
+  "þið",
+  "átti",
+  "ūannig",
+  "frú",
+  "geturđu",
+  "lengi",
+  "sæll",
+  "lengur",
+  "ūarft",
+  "heldurđu",
+  "heyrđu",
+  "hvenær",
+  "komast",
+  "hitta",
+  "haltu",
+  "gķđa",
+  "segi",
+  "fyrsta",
+  "lífi",
+  "betur",
+  "vilja",
+  "fyrst",
+  "eiga",
+  "ūykir",
+  "öllu",
+  "kominn",
+  "einhvern",
+  "inni",
+  "burt",
+  "ára",
+  "áhyggjur",
+  "víst",
+  "daginn",
+  "hjálpa",
+  "mann",
+  "a",
+  "geta",
+  "varđ",
+  "ūangađ",
+  "gķđ",
+  "handa",
+  "ūurfum",
+  "gerđist",
+  "sinn",
+  "i",
+  "þeir",
+  "ein",
+  "virđist",
+  "ūínum",
+  "máliđ",
+  "hægt",
+  "ættir",
+  "nema",
+  "mál",
+  "minni",
+  "illa",
+  "komum",
+  "ætlarđu",
+  "hafđi",
+  "fyrr",
+  "héđan",
+  "sjálfur",
+  "nķtt",
+  "búinn",
+  "líf",
+  "heiti",
+  "tveir",
+  "leita",
+  "heima",
+  "líđur",
+  "samt",
+  "þegar",
+  "nķg",
+  "gerum",
+  "gegn",
+  "engar",
+  "langt",
+  "erfitt",
+  "tvö",
+  "vorum",
+  "mínu",
+  "gangi",
+  "jack",
+  "hætta",
+  "mátt",
+  "annars",
+  "bless",
+  "ferđ",
+  "enga",
+  "tekur",
+  "mömmu",
+  "vantar",
+  "fengiđ",
+  "hafiđ",
+  "gefa",
+  "fjandans",
+  "skiptir",
+  "deyja",
+  "hve",
+  "hugmynd",
+  "gat",
+  "mínútur",
+  "klukkan",
+  "heitir",
+  "heyra",
+  "stundum",
+  "fann",
+  "hlũtur",
+  "fær",
+  "flott",
+  "spyrja",
+  "fæ",
+  "haldiđ",
+  "máli",
+  "ætlar",
+  "verður",
+  "gerast",
+  "trúi",
+  "allan",
+  "alls",
+  "sért",
+  "hvern",
+  "líklega",
+  "fínt",
+  "lítur",
+  "mínir",
+  "nota",
+  "komst",
+  "hjálp",
+  "sex",
+  "ganga",
+  "verið",
+  "nokkuđ",
+  "allar",
+  "besta",
+  "fleiri",
+  "þessu",
+  "gerist",
+  "sjáumst",
+  "úti",
+  "ha",
+  "tíu",
+  "fađir",
+  "hey",
+  "uppi",
+  "orđiđ",
+  "fannst",
+  "stendur",
+  "baka",
+  "sæl",
+  "tvær",
+  "smá",
+  "tķk",
+  "međan",
+  "sagđir",
+  "virkilega",
+  "líkar",
+  "kann",
+  "manni",
+  "værir",
+  "sũna",
+  "daga",
+  "varstu",
+  "pabba",
+  "hr",
+  "tvo",
+  "þau",
+  "man",
+  "byrja",
+  "hringja",
+  "jafnvel",
+  "milli",
+  "frekar",
+  "afsakiđ",
+  "ūinni",
+  "ķkei",
+  "eða",
+  "eigin",
+  "segirđu",
+  "næstum",
+  "gegnum",
+  "ættum",
+  "new",
+  "manstu",
+  "heyrt",
+  "hluti",
+  "ao",
+  "árum",
+  "strákar",
+  "meina",
+  "eitthvað",
+  "látiđ",
+  "afsakađu",
+  "sonur",
+  "john",
+  "betra",
+  "gķđan",
+  "kona",
+  "skiliđ",
+  "komin",
+  "engan",
+  "mađurinn",
+  "sérđu",
+  "hátt",
+  "konan",
+  "sú",
+  "ūķtt",
+  "skilurđu",
+  "vitum",
+  "tími",
+  "helvítis",
+  "beint",
+  "annan",
+  "horfa",
+  "hverjum",
+  "færđ",
+  "vinir",
+  "ūekki",
+  "borđa",
+  "leyfđu",
+  "kemst",
+  "litla",
+  "utan",
+  "undan",
+  "kalla",
+  "ūķ",
+  "hví",
+  "hversu",
+  "gætir",
+  "tekiđ",
+  "búiđ",
+  "dálítiđ",
+  "verđi",
+  "konu",
+  "tilbúinn",
+  "hefđir",
+  "reyndar",
+  "ūessari",
+  "bíđa",
+  "félagi",
+  "jesús",
+  "skulum",
+  "ūũđir",
+  "orđ",
+  "maður",
+  "bílinn",
+  "miklu",
+  "grínast",
+  "myndir",
+  "ú",
+  "varlega",
+  "tek",
+  "viku",
+  "annar",
+  "hlustađu",
+  "hafđu",
+  "átta",
+  "kyrr",
+  "engu",
+  "peninga",
+  "andskotinn",
+  "fáum",
+  "finn",
+  "skjķta",
+  "nafn",
+  "nķgu",
+  "börn",
+  "seinna",
+  "lokiđ",
+  "sjáiđ",
+  "meiri",
+  "brķđir",
+  "borga",
+  "svolítiđ",
+  "eiginlega",
+  "sagði",
+  "strákur",
+  "ætlađi",
+  "pú",
+  "sína",
+  "ūínu",
+  "skilja",
+  "hamingju",
+  "slepptu",
+  "búin",
+  "mynd",
+  "betri",
+  "frábær",
+  "vona",
+  "nær",
+  "fallegt",
+  "yrđi",
+  "york",
+  "ūegiđu",
+  "barn",
+  "settu",
+  "viljum",
+  "miđur",
+  "best",
+  "síđasta",
+  "hafir",
+  "næsta",
+  "hlusta",
+  "geti",
+  "ūúsund",
+  "burtu",
+  "bjarga",
+  "ræđa",
+  "ū",
+  "gerđir",
+  "oft",
+  "kenna",
+  "margir",
+  "hinn",
+  "skrifa",
+  "hug",
+  "sínum",
+  "dali",
+  "ūessar",
+  "náđi",
+  "von",
+  "vonandi",
+  "hræddur",
+  "ja",
+  "séu",
+  "gætum",
+  "setja",
+  "lét",
+  "reyndi",
+  "fröken",
+  "þarna",
+  "þar",
+  "ađra",
+  "þeim",
+  "ad",
+  "bílnum",
+  "ūrír",
+  "sofa",
+  "lítiđ",
+  "þarf",
+  "slæmt",
+  "tilbúin",
+  "nũja",
+  "gaf",
+  "lifa",
+  "læt",
+  "reyndu",
+  "búa",
+  "sækja",
+  "tækifæri",
+  "mínar",
+  "örugglega",
+  "næst",
+  "síđar",
+  "öđrum",
+  "fáđu",
+  "konur",
+  "mistök",
+  "líta",
+  "sendi",
+  "sjö",
+  "bjķđa",
+  "rķlegur",
+  "gefđu",
+  "fjárinn",
+  "nokkur",
+  "vini",
+  "talar",
+  "skilur",
+  "stađar",
+  "tķkst",
+  "lætur",
+  "skipti",
+  "ætlum",
+  "talađ",
+  "þess",
+  "sestu",
+  "sko",
+  "peningana",
+  "sagđirđu",
+  "gekk",
+  "gamla",
+  "standa",
+  "frank",
+  "nálægt",
+  "falleg",
+  "margt",
+  "vá",
+  "líttu",
+  "vinnur",
+  "færđu",
+  "sagđist",
+  "samband",
+  "farinn",
+  "michael",
+  "almáttugur",
+  "sæti",
+  "húsiđ",
+  "augnablik",
+  "hringi",
+  "minna",
+  "ūekkir",
+  "númer",
+  "lofa",
+  "fjandanum",
+  "stķr",
+  "ungfrú",
+  "lífiđ",
+  "varla",
+  "kaupa",
+  "sjáum",
+  "charlie",
+  "heyrđi",
+  "tökum",
+  "vandamál",
+  "þín",
+  "dķ",
+  "rangt",
+  "föđur",
+  "gær",
+  "ennūá",
+  "mat",
+  "berjast",
+  "einhvers",
+  "viljiđ",
+  "bænum",
+  "missa",
+  "hitti",
+  "börnin",
+  "þinn",
+  "fyrstu",
+  "fķlki",
+  "petta",
+  "önnur",
+  "senda",
+  "herrar",
+  "hringdi",
+  "david",
+  "ætli",
+  "sitt",
+  "mķđir",
+  "vinstri",
+  "hitt",
+  "vinnu",
+  "framan",
+  "áhuga",
+  "lesa",
+  "næstu",
+  "hringdu",
+  "gķđu",
+  "leika",
+  "hljķmar",
+  "þessi",
+  "leiđinni",
+  "aõ",
+  "niđri",
+  "látum",
+  "hægri",
+  "dauđur",
+  "datt",
+  "ūrjú",
+  "getađ",
+  "bíl",
+  "hjálpađ",
+  "læknir",
+  "nokkra",
+  "haft",
+  "fundiđ",
+  "mķti",
+  "spila",
+  "manns",
+  "fréttir",
+  "ūessir",
+  "ūann",
+  "hætti",
+  "takiđ",
+  "einhverju",
+  "munu",
+  "fjölskyldu",
+  "hjarta",
+  "dagur",
+  "konar",
+  "bestu",
+  "tii",
+  "tímann",
+  "george",
+  "ķtrúlegt",
+  "ást",
+  "mörg",
+  "čg",
+  "bađ",
+  "beđiđ",
+  "náđu",
+  "litli",
+  "trúa",
+  "herbergi",
+  "snũst",
+  "sam",
+  "frændi",
+  "mike",
+  "drap",
+  "farðu",
+  "barniđ",
+  "getiđ",
+  "hendur",
+  "innan",
+  "ūurfa",
+  "hinum",
+  "drekka",
+  "húsinu",
+  "biđ",
+  "starf",
+  "heyri",
+  "hús",
+  "þær",
+  "stelpa",
+  "dyrnar",
+  "mánuđi",
+  "finnur",
+  "síđustu",
+  "höldum",
+  "fangelsi",
+  "færi",
+  "heiminum",
+  "fyndiđ",
+  "fari",
+  "verð",
+  "ofan",
+  "leggja",
+  "stelpur",
+  "alvara",
+  "tom",
+  "unniđ",
+  "rétta",
+  "hrifinn",
+  "finnum",
+  "borđ",
+  "öđru",
+  "nũtt",
+  "eini",
+  "krakkar",
+  "gefiđ",
+  "allra",
+  "ūurfti",
+  "vatn",
+  "pao",
+  "tveimur",
+  "kynnast",
+  "gleymdu",
+  "besti",
+  "nákvæmlega",
+  "enda",
+  "réttu",
+  "komist",
+  "bíđiđ",
+  "virđi",
+  "hata",
+  "komið",
+  "sástu",
+  "sinnum",
+  "biđja",
+  "lifandi",
+  "sleppa",
+  "systir",
+  "svara",
+  "hrædd",
+  "líst",
+  "nũ",
+  "skaltu",
+  "bæđi",
+  "stund",
+  "vitiđ",
+  "velkomin",
+  "aō",
+  "reyni",
+  "drengur",
+  "skipta",
+  "opna",
+  "læra",
+  "afar",
+  "vann",
+  "virkar",
+  "ūarftu",
+  "eg",
+  "vildir",
+  "fljķtt",
+  "ūarfnast",
+  "sũndu",
+  "drepiđ",
+  "hjálpađu",
+  "gamall",
+  "seint",
+  "nokkrum",
+  "fékkstu",
+  "níu",
+  "opnađu",
+  "drottinn",
+  "væru",
+  "bak",
+  "missti",
+  "lögreglan",
+  "fleira",
+  "dáinn",
+  "augun",
+  "dansa",
+  "gefur",
+  "mikil",
+  "marga",
+  "þakka",
+  "ūrjár",
+  "stjķrn",
+  "ben",
+  "næ",
+  "fķlkiđ",
+  "nafni",
+  "heyrirđu",
+  "míns",
+  "stađinn",
+  "verđiđ",
+  "niður",
+  "gleyma",
+  "margar",
+  "einhverjum",
+  "byssu",
+  "kaffi",
+  "systur",
+  "mark",
+  "harry",
+  "sérđ",
+  "gamli",
+  "greiđa",
+  "gaur",
+  "dömur",
+  "sömu",
+  "hratt",
+  "neinn",
+  "ber",
+  "mikill",
+  "bera",
+  "sakna",
+  "dķttur",
+  "ári",
+  "leyfi",
+  "ansi",
+  "hjálpar",
+  "mikið",
+  "finndu",
+  "ūínar",
+  "sannarlega",
+  "giftast",
+  "elskar",
+  "snúa",
+  "sjálf",
+  "munt",
+  "mķđur",
+  "heimi",
+  "hætt",
+  "náđ",
+  "einum",
+  "bũr",
+  "vio",
+  "henry",
+  "né",
+  "litlu",
+  "sögu",
+  "munum",
+  "komu",
+  "hverjir",
+  "farið",
+  "velkominn",
+  "aftan",
+  "leit",
+  "manninn",
+  "joe",
+  "komstu",
+  "tíminn",
+  "yđar",
+  "sín",
+  "komi",
+  "stattu",
+  "flytja",
+  "nokkrar",
+  "farin",
+  "hin",
+  "guð",
+  "loksins",
+  "fyrirgefðu",
+  "drykk",
+  "vin",
+  "góður",
+  "raun",
+  "megin",
+  "fullt",
+  "áætlun",
+  "ūínir",
+  "efni",
+  "selja",
+  "stúlka",
+  "verk",
+  "paul",
+  "stađur",
+  "sjálfan",
+  "meinarđu",
+  "hingað",
+  "afsökunar",
+  "fylgja",
+  "hönd",
+  "verðum",
+  "hugsađu",
+  "sumir",
+  "breyta",
+  "pér",
+  "vikur",
+  "degi",
+  "reynt",
+  "ūrjá",
+  "mikla",
+  "hefði",
+  "komnir",
+};
+const uint16_t WA_FREQ_68_RANKS[] = {
+  52, 0, 0, 700, 112, 758, 0, 0, 0, 0, 0, 669, 20, 238, 9, 521,
+  37, 274, 343, 154, 61, 634, 703, 967, 0, 0, 0, 0, 572, 0, 0, 481,
+  0, 424, 679, 357, 515, 0, 358, 773, 0, 419, 645, 840, 911, 0, 0, 0,
+  96, 228, 318, 122, 169, 896, 23, 193, 278, 0, 0, 0, 735, 0, 0, 671,
+  178, 0, 0, 173, 412, 531, 653, 0, 0, 391, 0, 640, 121, 919, 0, 806,
+  0, 0, 0, 216, 0, 745, 362, 899, 0, 0, 0, 0, 0, 198, 204, 828,
+  0, 0, 731, 0, 940, 0, 100, 0, 885, 952, 0, 0, 282, 0, 0, 247,
+  793, 24, 953, 416, 485, 361, 0, 0, 0, 0, 0, 0, 131, 674, 0, 552,
+  875, 582, 0, 57, 292, 721, 109, 0, 155, 0, 376, 563, 0, 70, 0, 209,
+  743, 0, 0, 910, 99, 0, 0, 0, 0, 0, 0, 330, 311, 0, 0, 195,
+  0, 630, 0, 0, 35, 960, 257, 0, 0, 0, 0, 0, 0, 0, 0, 281,
+  404, 837, 0, 0, 0, 0, 804, 846, 0, 0, 0, 0, 933, 0, 934, 315,
+  304, 539, 0, 484, 829, 0, 0, 0, 847, 0, 891, 0, 0, 134, 508, 666,
+  691, 5, 876, 78, 349, 447, 929, 476, 0, 546, 82, 790, 800, 0, 0, 103,
+  0, 74, 935, 0, 682, 614, 710, 0, 176, 0, 689, 821, 0, 483, 658, 0,
+  271, 0, 373, 0, 0, 0, 0, 113, 0, 0, 234, 0, 0, 0, 0, 0,
+  501, 0, 753, 415, 855, 732, 0, 0, 0, 627, 767, 76, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 322, 220, 429, 0, 0, 0, 0, 0, 0, 864,
+  310, 908, 713, 0, 629, 0, 0, 916, 0, 0, 715, 0, 0, 183, 0, 0,
+  0, 197, 0, 0, 0, 716, 0, 0, 342, 848, 675, 950, 199, 642, 872, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 217, 309, 787, 406, 39, 0, 66, 567,
+  888, 897, 619, 922, 0, 0, 0, 0, 0, 0, 0, 0, 0, 678, 0, 230,
+  562, 62, 662, 0, 94, 0, 0, 0, 0, 41, 0, 0, 0, 0, 548, 92,
+  286, 308, 259, 740, 687, 0, 845, 0, 936, 0, 737, 537, 0, 0, 0, 272,
+  0, 0, 0, 0, 0, 124, 0, 0, 0, 0, 0, 0, 385, 0, 596, 0,
+  981, 867, 0, 597, 115, 264, 468, 557, 957, 0, 849, 0, 377, 6, 116, 494,
+  190, 786, 893, 975, 54, 0, 0, 0, 146, 163, 0, 0, 147, 580, 0, 0,
+  843, 256, 0, 244, 317, 293, 7, 340, 711, 64, 87, 8, 158, 191, 245, 578,
+  877, 500, 791, 0, 378, 0, 0, 0, 327, 637, 0, 0, 636, 686, 702, 258,
+  405, 992, 0, 856, 528, 659, 0, 0, 765, 0, 0, 0, 0, 0, 0, 977,
+  0, 912, 0, 0, 0, 224, 836, 401, 0, 0, 435, 261, 611, 0, 450, 656,
+  0, 0, 0, 561, 0, 0, 459, 0, 477, 810, 0, 0, 0, 0, 0, 0,
+  857, 0, 0, 170, 341, 574, 595, 973, 0, 0, 19, 0, 0, 0, 502, 0,
+  0, 0, 0, 0, 0, 0, 359, 909, 917, 266, 0, 605, 598, 0, 536, 615,
+  466, 692, 203, 694, 0, 0, 0, 0, 0, 0, 0, 277, 592, 439, 387, 0,
+  0, 0, 0, 670, 775, 0, 136, 570, 768, 0, 285, 0, 0, 794, 0, 667,
+  511, 609, 881, 214, 660, 668, 559, 0, 0, 0, 374, 976, 0, 386, 697, 811,
+  461, 718, 842, 930, 454, 980, 983, 0, 0, 0, 456, 168, 0, 648, 0, 0,
+  104, 189, 0, 538, 161, 250, 621, 890, 0, 0, 79, 331, 333, 90, 649, 982,
+  0, 834, 0, 0, 472, 0, 0, 166, 347, 945, 0, 0, 0, 288, 0, 0,
+  172, 0, 0, 0, 0, 150, 354, 0, 517, 45, 761, 895, 0, 505, 0, 633,
+  778, 0, 0, 0, 586, 0, 299, 788, 0, 651, 838, 0, 0, 328, 0, 0,
+  0, 0, 233, 0, 0, 0, 0, 0, 488, 0, 0, 227, 0, 0, 91, 0,
+  267, 452, 381, 759, 0, 0, 0, 518, 0, 0, 0, 403, 0, 0, 449, 276,
+  783, 956, 0, 184, 0, 0, 0, 0, 0, 0, 414, 0, 0, 0, 0, 360,
+  617, 0, 0, 0, 213, 0, 0, 0, 0, 695, 12, 0, 0, 355, 0, 925,
+  995, 0, 0, 0, 145, 188, 428, 512, 928, 127, 93, 68, 503, 248, 295, 434,
+  302, 673, 0, 0, 108, 820, 0, 0, 0, 0, 0, 313, 0, 0, 0, 427,
+  728, 135, 0, 0, 0, 460, 0, 754, 165, 747, 0, 0, 69, 0, 0, 0,
+  571, 254, 446, 0, 0, 0, 306, 0, 0, 465, 962, 914, 0, 722, 0, 0,
+  97, 284, 215, 222, 555, 0, 964, 868, 1000, 0, 0, 0, 242, 853, 0, 672,
+  380, 0, 0, 0, 939, 797, 75, 0, 726, 0, 0, 0, 0, 0, 0, 289,
+  0, 643, 346, 493, 0, 0, 85, 219, 584, 0, 0, 0, 0, 680, 0, 0,
+  98, 963, 303, 0, 0, 0, 167, 0, 0, 0, 0, 0, 0, 815, 0, 0,
+  777, 0, 0, 28, 871, 0, 0, 0, 177, 275, 225, 18, 353, 469, 326, 717,
+  0, 0, 921, 0, 0, 0, 0, 407, 0, 0, 270, 569, 776, 998, 0, 0,
+  0, 38, 0, 371, 0, 554, 211, 624, 780, 551, 852, 824, 918, 399, 0, 0,
+  575, 0, 0, 0, 746, 0, 408, 892, 123, 0, 932, 269, 89, 0, 0, 0,
+  0, 0, 0, 0, 0, 492, 185, 0, 924, 523, 749, 0, 0, 601, 0, 527,
+  0, 887, 0, 0, 606, 0, 526, 641, 835, 255, 616, 263, 413, 865, 997, 0,
+  0, 883, 0, 0, 738, 444, 0, 0, 457, 345, 839, 0, 0, 160, 0, 0,
+  40, 0, 59, 0, 560, 573, 471, 0, 0, 792, 221, 0, 947, 0, 0, 516,
+  774, 0, 30, 760, 0, 0, 0, 0, 0, 0, 770, 878, 0, 0, 395, 301,
+  602, 879, 766, 0, 0, 0, 0, 0, 388, 785, 0, 0, 0, 0, 448, 0,
+  0, 0, 0, 0, 525, 796, 543, 0, 0, 549, 84, 425, 442, 0, 279, 0,
+  0, 0, 26, 335, 696, 771, 262, 260, 0, 0, 0, 714, 65, 251, 938, 0,
+  0, 298, 0, 0, 0, 0, 22, 0, 0, 0, 394, 375, 495, 789, 0, 0,
+  0, 0, 0, 0, 0, 0, 445, 744, 905, 966, 819, 0, 886, 0, 0, 0,
+  27, 0, 0, 0, 0, 0, 0, 688, 0, 0, 0, 0, 0, 0, 151, 0,
+  0, 904, 351, 0, 253, 620, 708, 0, 0, 0, 0, 44, 0, 31, 0, 542,
+  0, 0, 86, 693, 972, 0, 0, 0, 126, 48, 139, 564, 646, 451, 0, 813,
+  0, 833, 0, 0, 0, 352, 0, 0, 0, 0, 0, 0, 0, 14, 0, 823,
+  707, 0, 752, 305, 3, 0, 684, 0, 432, 0, 194, 129, 0, 859, 994, 0,
+  0, 0, 0, 397, 0, 705, 119, 0, 0, 0, 882, 850, 321, 0, 0, 0,
+  0, 205, 0, 370, 0, 0, 15, 0, 729, 0, 0, 0, 0, 0, 0, 80,
+  0, 0, 0, 0, 398, 280, 566, 0, 550, 0, 0, 0, 529, 0, 0, 873,
+  622, 830, 720, 0, 0, 0, 907, 0, 506, 0, 0, 312, 324, 0, 0, 497,
+  0, 0, 0, 0, 0, 0, 0, 47, 36, 81, 0, 0, 0, 870, 0, 0,
+  0, 0, 0, 583, 268, 969, 111, 114, 235, 0, 344, 750, 316, 338, 410, 889,
+  0, 58, 0, 453, 0, 0, 0, 0, 0, 683, 0, 0, 0, 0, 0, 56,
+  0, 0, 0, 332, 0, 0, 0, 0, 631, 0, 464, 677, 0, 600, 901, 0,
+  0, 0, 0, 0, 0, 0, 520, 650, 0, 0, 0, 0, 0, 0, 63, 0,
+  0, 77, 844, 142, 0, 0, 0, 0, 0, 661, 818, 0, 610, 970, 0, 654,
+  482, 880, 237, 0, 0, 0, 0, 0, 436, 0, 0, 809, 0, 623, 0, 0,
+  0, 0, 95, 0, 0, 0, 0, 212, 535, 0, 0, 0, 0, 0, 0, 208,
+  226, 307, 356, 148, 854, 0, 0, 0, 252, 581, 0, 202, 438, 866, 0, 0,
+  0, 72, 0, 498, 290, 522, 0, 0, 249, 0, 73, 125, 0, 663, 884, 968,
+  0, 88, 0, 0, 0, 334, 0, 748, 0, 0, 798, 0, 0, 207, 655, 0,
+  0, 0, 0, 0, 231, 0, 0, 0, 0, 0, 0, 0, 0, 704, 0, 463,
+  433, 991, 0, 685, 0, 0, 0, 0, 0, 368, 43, 181, 420, 0, 0, 900,
+  117, 0, 926, 985, 0, 138, 0, 0, 0, 0, 664, 594, 71, 657, 803, 923,
+  984, 60, 0, 931, 0, 814, 0, 0, 863, 83, 0, 0, 0, 781, 948, 0,
+  0, 903, 0, 0, 0, 0, 0, 0, 0, 541, 812, 0, 699, 0, 0, 0,
+  0, 0, 325, 0, 0, 0, 0, 55, 989, 807, 751, 0, 509, 0, 0, 558,
+  524, 297, 0, 0, 0, 0, 0, 604, 741, 0, 0, 0, 0, 0, 0, 379,
+  470, 382, 175, 0, 0, 34, 961, 841, 0, 0, 0, 757, 0, 339, 591, 613,
+  827, 0, 0, 0, 42, 137, 283, 724, 171, 733, 0, 0, 755, 0, 105, 730,
+  314, 367, 0, 0, 0, 0, 725, 0, 0, 0, 246, 411, 589, 0, 0, 192,
+  241, 513, 544, 701, 0, 0, 949, 417, 236, 0, 0, 490, 0, 0, 383, 0,
+  0, 0, 0, 51, 441, 421, 556, 0, 0, 0, 593, 201, 0, 858, 0, 319,
+  632, 588, 816, 0, 0, 736, 0, 955, 603, 0, 0, 676, 0, 0, 0, 437,
+  0, 0, 32, 149, 210, 336, 0, 0, 0, 320, 959, 0, 0, 186, 0, 779,
+  0, 223, 0, 587, 869, 0, 0, 0, 979, 0, 0, 0, 993, 0, 390, 0,
+  0, 0, 763, 861, 504, 799, 132, 422, 533, 782, 906, 987, 0, 0, 0, 13,
+  0, 384, 0, 0, 0, 0, 50, 825, 0, 67, 0, 46, 0, 0, 4, 25,
+  164, 706, 734, 287, 784, 822, 0, 0, 179, 0, 400, 462, 162, 719, 769, 832,
+  0, 239, 0, 0, 206, 0, 0, 393, 0, 0, 323, 553, 174, 0, 0, 0,
+  0, 519, 507, 130, 607, 0, 965, 0, 0, 0, 141, 625, 363, 831, 0, 0,
+  0, 431, 599, 0, 0, 576, 187, 159, 698, 0, 0, 590, 489, 860, 2, 0,
+  294, 0, 0, 802, 0, 0, 296, 423, 0, 954, 0, 300, 0, 0, 0, 0,
+  862, 0, 0, 0, 0, 0, 681, 937, 196, 532, 0, 0, 978, 0, 0, 0,
+  0, 17, 291, 514, 638, 0, 0, 156, 0, 0, 0, 898, 941, 29, 0, 0,
+  0, 372, 0, 348, 0, 971, 0, 0, 0, 0, 0, 180, 0, 942, 801, 0,
+  369, 762, 943, 0, 0, 0, 894, 739, 608, 0, 0, 647, 990, 0, 0, 0,
+  0, 0, 0, 727, 0, 0, 0, 107, 742, 999, 128, 946, 153, 0, 0, 0,
+  665, 0, 0, 106, 0, 612, 0, 0, 0, 273, 392, 218, 0, 102, 0, 364,
+  547, 723, 0, 0, 0, 628, 486, 0, 120, 200, 240, 478, 496, 927, 0, 0,
+  0, 0, 443, 0, 110, 772, 0, 0, 0, 0, 0, 0, 0, 396, 10, 639,
+  0, 0, 577, 0, 0, 0, 182, 499, 265, 568, 920, 1, 140, 0, 874, 0,
+  0, 458, 534, 487, 510, 951, 152, 366, 133, 143, 545, 0, 0, 0, 540, 0,
+  0, 0, 0, 0, 0, 988, 0, 0, 16, 426, 243, 0, 0, 0, 712, 0,
+  0, 157, 530, 0, 0, 475, 851, 11, 986, 418, 644, 690, 0, 0, 480, 0,
+  0, 0, 913, 626, 365, 915, 944, 409, 0, 0, 0, 0, 0, 118, 0, 0,
+  0, 491, 0, 440, 144, 479, 0, 0, 33, 652, 0, 0, 0, 0, 0, 0,
+  0, 0, 709, 0, 0, 0, 0, 0, 0, 0, 402, 585, 902, 0, 0, 618,
+  350, 0, 474, 0, 0, 329, 467, 473, 232, 756, 0, 635, 764, 0, 101, 455,
+  795, 21, 0, 0, 0, 0, 0, 389, 0, 229, 430, 0, 958, 817, 974, 0,
+  337, 0, 579, 808, 0, 53, 805, 0, 0, 826, 49, 996, 0, 565, 0, 0,
+};
+
+const char *WA_FREQ_69_TOKENS[] = {
+  "e",
+  "non",
+  "che",
+  "di",
+  "la",
+  "il",
+  "un",
+  "a",
+  "per",
+  "è",
+  "in",
+  "una",
+  "mi",
+  "sono",
+  "ho",
+  "l'",
+  "si",
+  "ha",
+  "ma",
+  "lo",
+  "cosa",
+  "con",
+  "no",
+  "le",
+  "ti",
+  "se",
+  "da",
+  "i",
+  "come",
+  "io",
+  "ci",
+  "hai",
+  "questo",
+  "bene",
+  "qui",
+  "sei",
+  "del",
+  "tu",
+  "solo",
+  "mio",
+  "al",
+  "me",
+  "tutto",
+  "c'",
+  "te",
+  "era",
+  "della",
+  "mia",
+  "fatto",
+  "fare",
+  "essere",
+  "so",
+  "quando",
+  "sì",
+  "ora",
+  "lei",
+  "gli",
+  "ne",
+  "oh",
+  "questa",
+  "detto",
+  "ok",
+  "va",
+  "perche",
+  "quello",
+  "mai",
+  "alla",
+  "o",
+  "anche",
+  "stato",
+  "abbiamo",
+  "tutti",
+  "dei",
+  "grazie",
+  "chi",
+  "sta",
+  "molto",
+  "più",
+  "voglio",
+  "perché",
+  "tuo",
+  "beh",
+  "sia",
+  "nel",
+  "lui",
+  "allora",
+  "posso",
+  "piu",
+  "ehi",
+  "prima",
+  "tua",
+  "suo",
+  "niente",
+  "qualcosa",
+  "sai",
+  "siamo",
+  "un'",
+  "cosi",
+  "davvero",
+  "ancora",
+  "hanno",
+  "stai",
+  "fa",
+  "sua",
+  "così",
+  "casa",
+  "uno",
+  "dove",
+  "su",
+  "vero",
+  "vuoi",
+  "noi",
+  "due",
+  "quindi",
+  "dire",
+  "d'",
+  "delle",
+  "quella",
+  "sempre",
+  "altro",
+  "sto",
+  "andare",
+  "ad",
+  "po",
+  "loro",
+  "devo",
+  "quel",
+  "forse",
+  "li",
+  "proprio",
+  "certo",
+  "tempo",
+  "nella",
+  "poi",
+  "vi",
+  "credo",
+  "vita",
+  "cose",
+  "sul",
+  "quanto",
+  "puoi",
+  "fuori",
+  "anni",
+  "cui",
+  "andiamo",
+  "dell'",
+  "parte",
+  "visto",
+  "qualcuno",
+  "all'",
+  "lavoro",
+  "voi",
+  "ciao",
+  "dio",
+  "volta",
+  "dopo",
+  "adesso",
+  "stata",
+  "uomo",
+  "padre",
+  "devi",
+  "bisogno",
+  "gia",
+  "amico",
+  "ed",
+  "posto",
+  "nessuno",
+  "via",
+  "cos'",
+  "fai",
+  "signore",
+  "meglio",
+  "cazzo",
+  "dai",
+  "dal",
+  "vuole",
+  "sembra",
+  "giorno",
+  "ogni",
+  "modo",
+  "senza",
+  "vedere",
+  "dobbiamo",
+  "signor",
+  "qualche",
+  "dispiace",
+  "penso",
+  "ecco",
+  "parlare",
+  "tra",
+  "mamma",
+  "già",
+  "sarebbe",
+  "dalla",
+  "troppo",
+  "fosse",
+  "possiamo",
+  "ce",
+  "nuovo",
+  "male",
+  "madre",
+  "avete",
+  "tanto",
+  "favore",
+  "successo",
+  "vai",
+  "sulla",
+  "giusto",
+  "sa",
+  "miei",
+  "aspetta",
+  "avere",
+  "altra",
+  "farlo",
+  "alle",
+  "facendo",
+  "abbia",
+  "momento",
+  "ero",
+  "aveva",
+  "ragazzi",
+  "deve",
+  "persone",
+  "nostro",
+  "tipo",
+  "prego",
+  "grande",
+  "può",
+  "senti",
+  "appena",
+  "potrebbe",
+  "soldi",
+  "dice",
+  "sapere",
+  "tre",
+  "oggi",
+  "questi",
+  "piace",
+  "idea",
+  "siete",
+  "ai",
+  "avevo",
+  "figlio",
+  "accordo",
+  "gente",
+  "sicuro",
+  "vieni",
+  "degli",
+  "guarda",
+  "dentro",
+  "trovato",
+  "queste",
+  "caso",
+  "forza",
+  "dov'",
+  "tutte",
+  "pensi",
+  "signora",
+  "faccio",
+  "nome",
+  "avuto",
+  "problema",
+  "altri",
+  "puo",
+  "aver",
+  "mondo",
+  "tutta",
+  "preso",
+  "nulla",
+  "nostra",
+  "donna",
+  "stare",
+  "basta",
+  "insieme",
+  "faccia",
+  "ragazza",
+  "subito",
+  "famiglia",
+  "ragazzo",
+  "volevo",
+  "okay",
+  "sentito",
+  "ah",
+  "stesso",
+  "ragione",
+  "sarà",
+  "tuoi",
+  "capito",
+  "notte",
+  "volte",
+  "testa",
+  "serve",
+  "tesoro",
+  "sotto",
+  "eh",
+  "suoi",
+  "vado",
+  "sara",
+  "dato",
+  "stiamo",
+  "bella",
+  "scusa",
+  "erano",
+  "pensavo",
+  "avrei",
+  "prendere",
+  "buona",
+  "porta",
+  "bello",
+  "moglie",
+  "vorrei",
+  "storia",
+  "succede",
+  "morto",
+  "cercando",
+  "dici",
+  "persona",
+  "pronto",
+  "meno",
+  "dovuto",
+  "avanti",
+  "capisco",
+  "secondo",
+  "venire",
+  "polizia",
+  "lì",
+  "avrebbe",
+  "stanno",
+  "mentre",
+  "letto",
+  "fino",
+  "dico",
+  "amici",
+  "fine",
+  "aiuto",
+  "paura",
+  "fratello",
+  "stavo",
+  "uomini",
+  "nell'",
+  "domani",
+  "facciamo",
+  "abbastanza",
+  "capo",
+  "amore",
+  "nei",
+  "ucciso",
+  "state",
+  "piano",
+  "macchina",
+  "trovare",
+  "comunque",
+  "vediamo",
+  "giorni",
+  "nemmeno",
+  "mano",
+  "dall'",
+  "presto",
+  "stati",
+  "merda",
+  "far",
+  "bambino",
+  "andato",
+  "vedo",
+  "tornare",
+  "quelle",
+  "cio",
+  "primo",
+  "vostro",
+  "neanche",
+  "sera",
+  "giro",
+  "morte",
+  "e'",
+  "qua",
+  "pensato",
+  "buon",
+  "anno",
+  "mie",
+  "diavolo",
+  "quasi",
+  "piacere",
+  "bel",
+  "dovrei",
+  "nessun",
+  "contro",
+  "stessa",
+  "felice",
+  "colpa",
+  "punto",
+  "andata",
+  "dovrebbe",
+  "vedi",
+  "quale",
+  "chiesto",
+  "invece",
+  "perchè",
+  "migliore",
+  "nostri",
+  "finito",
+  "figlia",
+  "dovresti",
+  "papa",
+  "almeno",
+  "sento",
+  "quei",
+  "col",
+  "ore",
+  "passato",
+  "magari",
+  "minuti",
+  "terra",
+  "vostra",
+  "strada",
+  "sola",
+  "credi",
+  "importante",
+  "sue",
+  "salve",
+  "settimana",
+  "perso",
+  "uscire",
+  "parlato",
+  "papà",
+  "stasera",
+  "scusi",
+  "dollari",
+  "occhi",
+  "mani",
+  "ultima",
+  "possibile",
+  "scuola",
+  "significa",
+  "sapevo",
+  "nelle",
+  "potrei",
+  "stava",
+  "bambini",
+  "eri",
+  "importa",
+  "indietro",
+  "riesco",
+  "sangue",
+  "chiama",
+  "messo",
+  "piccolo",
+  "traduzione",
+  "tardi",
+  "cuore",
+  "marito",
+  "viene",
+  "venuto",
+  "ieri",
+  "spero",
+  "ricordi",
+  "quelli",
+  "dovremmo",
+  "lasciato",
+  "ascolta",
+  "difficile",
+  "quell'",
+  "auto",
+  "chiamato",
+  "ciò",
+  "altre",
+  "parlando",
+  "pensare",
+  "fantastico",
+  "fatta",
+  "numero",
+  "veramente",
+  "fanno",
+  "com'",
+  "serio",
+  "possa",
+  "fossi",
+  "entrare",
+  "anch'",
+  "qualsiasi",
+  "pensa",
+  "dicendo",
+  "acqua",
+  "portato",
+  "stanza",
+  "problemi",
+  "forte",
+  "nessuna",
+  "lascia",
+  "amo",
+  "roba",
+  "agente",
+  "dietro",
+  "corpo",
+  "pare",
+  "sentire",
+  "foto",
+  "telefono",
+  "voleva",
+  "poco",
+  "prendi",
+  "piccola",
+  "vicino",
+  "quest'",
+  "sacco",
+  "stia",
+  "capire",
+  "potuto",
+  "cinque",
+  "strano",
+  "tue",
+  "andando",
+  "donne",
+  "sappiamo",
+  "bravo",
+  "ragazze",
+  "festa",
+  "senso",
+  "genere",
+  "quattro",
+  "dare",
+  "attimo",
+  "sorella",
+  "pure",
+  "probabilmente",
+  "film",
+  "parla",
+  "ufficio",
+  "verso",
+  "mesi",
+  "farti",
+  "unica",
+  "morire",
+  "signorina",
+  "vecchio",
+  "domanda",
+  "ben",
+  "guerra",
+  "dottore",
+  "conosco",
+  "qual",
+  "vivere",
+  "vista",
+  "prova",
+  "nuova",
+  "ricordo",
+  "divertente",
+  "avessi",
+  "sicura",
+  "paio",
+  "conto",
+  "perdere",
+  "dimmi",
+  "farmi",
+  "figli",
+  "mezzo",
+  "lavorare",
+  "unico",
+  "esattamente",
+  "squadra",
+  "esatto",
+  "possono",
+  "fate",
+  "faro",
+  "sapete",
+  "dottor",
+  "parola",
+  "piedi",
+  "sopra",
+  "motivo",
+  "avevi",
+  "cavolo",
+  "capitano",
+  "finita",
+  "volete",
+  "siano",
+  "potresti",
+  "gioco",
+  "perfetto",
+  "be",
+  "mente",
+  "mangiare",
+  "resto",
+  "credere",
+  "fortuna",
+  "tratta",
+  "chiamo",
+  "morta",
+  "là",
+  "entrambi",
+  "avresti",
+  "passare",
+  "cena",
+  "the",
+  "sarei",
+  "controllo",
+  "affari",
+  "spiace",
+  "ultimo",
+  "facile",
+  "farò",
+  "buongiorno",
+  "davanti",
+  "tizio",
+  "dammi",
+  "sicurezza",
+  "dalle",
+  "quanti",
+  "dica",
+  "matrimonio",
+  "john",
+  "vogliono",
+  "molti",
+  "culo",
+  "fuoco",
+  "cercare",
+  "pistola",
+  "potremmo",
+  "re",
+  "mandato",
+  "puttana",
+  "negli",
+  "cioe",
+  "inizio",
+  "saranno",
+  "causa",
+  "voglia",
+  "mettere",
+  "fammi",
+  "uccidere",
+  "vogliamo",
+  "faremo",
+  "però",
+  "genitori",
+  "sesso",
+  "potete",
+  "ricevuto",
+  "vivo",
+  "presidente",
+  "città",
+  "citta",
+  "succedendo",
+  "ospedale",
+  "fu",
+  "agli",
+  "scritto",
+  "smettila",
+  "vada",
+  "attenzione",
+  "sulle",
+  "bere",
+  "situazione",
+  "omicidio",
+  "revisione",
+  "avesse",
+  "ottimo",
+  "cura",
+  "durante",
+  "provato",
+  "parole",
+  "lasciare",
+  "dicono",
+  "new",
+  "prossima",
+  "nostre",
+  "arrivato",
+  "paese",
+  "sull'",
+  "andate",
+  "chiunque",
+  "capisci",
+  "pace",
+  "immagino",
+  "musica",
+  "tieni",
+  "oddio",
+  "jack",
+  "libro",
+  "eravamo",
+  "amica",
+  "diventare",
+  "sui",
+  "sbagliato",
+  "dirmi",
+  "wow",
+  "farai",
+  "entra",
+  "venuta",
+  "scelta",
+  "voluto",
+  "portare",
+  "assolutamente",
+  "molte",
+  "chiedo",
+  "torna",
+  "scoperto",
+  "fatti",
+  "settimane",
+  "dirlo",
+  "alcuni",
+  "prigione",
+  "giornata",
+  "piuttosto",
+  "buono",
+  "aspettare",
+  "parli",
+  "arrivare",
+  "lungo",
+  "vede",
+  "avvocato",
+  "deciso",
+  "sarai",
+  "messaggio",
+  "dormire",
+  "dieci",
+  "stupido",
+  "usare",
+  "dello",
+  "cielo",
+  "guardare",
+  "bagno",
+  "aria",
+  "voce",
+  "tornato",
+  "vuol",
+  "giù",
+  "conosci",
+  "benissimo",
+  "prendo",
+  "verita",
+  "cane",
+  "restare",
+  "chiamare",
+  "poter",
+  "campo",
+  "luce",
+  "sam",
+  "qualunque",
+  "giovane",
+  "signori",
+  "fra",
+  "provare",
+  "minuto",
+  "saperlo",
+  "lontano",
+  "gruppo",
+  "continua",
+  "arrivo",
+  "gran",
+  "realta",
+  "cerca",
+  "passo",
+  "domande",
+  "insomma",
+  "bambina",
+  "pensando",
+  "capelli",
+  "trova",
+  "onore",
+  "aiutare",
+  "verità",
+  "prove",
+  "n'",
+  "funziona",
+  "alto",
+  "giu",
+  "credevo",
+  "futuro",
+  "preoccuparti",
+  "idiota",
+  "cibo",
+  "fretta",
+  "cara",
+  "finalmente",
+  "morti",
+  "odio",
+  "solito",
+  "brava",
+  "é",
+  "incidente",
+  "allo",
+  "dev'",
+  "intenzione",
+  "speciale",
+  "cambiare",
+  "vera",
+  "camera",
+  "oltre",
+  "semplice",
+  "dirti",
+  "riguardo",
+  "finche",
+  "aspetto",
+  "viaggio",
+  "chiaro",
+  "chiamata",
+  "bocca",
+  "permesso",
+  "piacerebbe",
+  "dovete",
+  "giocare",
+  "ordine",
+  "circa",
+  "ovviamente",
+  "finire",
+  "piu'",
+  "natale",
+  "i'",
+  "direi",
+  "vostri",
+  "occhio",
+  "pronta",
+  "scusami",
+  "mattina",
+  "cercato",
+  "crede",
+  "sistema",
+  "york",
+  "fondo",
+  "resta",
+  "devono",
+  "prossimo",
+  "pronti",
+  "saputo",
+  "scusate",
+  "potere",
+  "milioni",
+  "soltanto",
+  "armi",
+  "arriva",
+  "fermo",
+  "mese",
+  "chiedere",
+  "cristo",
+  "torno",
+  "venite",
+  "controllare",
+  "appuntamento",
+  "s",
+  "chiami",
+  "vecchia",
+  "detective",
+  "pero",
+  "metti",
+  "grado",
+  "vanno",
+  "nave",
+  "iniziato",
+  "perche'",
+  "informazioni",
+  "libero",
+  "stronzo",
+  "grandi",
+  "pezzo",
+  "segreto",
+  "colpo",
+  "faceva",
+  "piacciono",
+  "porto",
+  "oppure",
+  "completamente",
+  "vederti",
+  "lista",
+  "venga",
+  "veloce",
+  "assassino",
+  "sapeva",
+  "finché",
+  "tom",
+  "ormai",
+  "interessa",
+  "generale",
+  "giusta",
+  "tenere",
+  "pazzo",
+  "vittima",
+  "giuro",
+  "consiglio",
+  "michael",
+  "alcune",
+  "semplicemente",
+  "zio",
+  "centro",
+  "specie",
+  "mille",
+  "sogno",
+  "lasci",
+  "carino",
+  "doveva",
+  "brutto",
+  "nello",
+  "aspetti",
+  "incredibile",
+  "sole",
+  "glielo",
+  "legge",
+  "spesso",
+  "guardate",
+  "cambiato",
+  "scena",
+  "volevi",
+  "charlie",
+  "lasciami",
+  "gentile",
+  "rispetto",
+  "ve",
+  "fara",
+  "zitto",
+  "incontro",
+  "farà",
+  "servono",
+  "rapporto",
+  "errore",
+  "mike",
+  "sanno",
+  "pagare",
+  "sorpresa",
+  "occhiata",
+  "risposta",
+  "presa",
+  "servizio",
+  "medico",
+  "usato",
+  "hey",
+  "caro",
+  "schifo",
+  "avrai",
+  "dolore",
+  "saresti",
+  "personale",
+  "quali",
+  "saro",
+  "peggio",
+  "addio",
+  "addosso",
+  "dovevo",
+  "poteva",
+  "pieno",
+  "diverso",
+  "vestiti",
+  "sparato",
+  "realtà",
+  "do",
+  "sarò",
+  "normale",
+  "fame",
+  "programma",
+  "nonna",
+  "sappia",
+  "sembrava",
+  "migliori",
+  "notizie",
+  "avevamo",
+  "riesci",
+  "posizione",
+  "vengo",
+  "rimanere",
+  "compagnia",
+  "proposito",
+  "farci",
+  "joe",
+  "ricorda",
+  "frank",
+  "prende",
+  "tante",
+  "avevano",
+  "arrivando",
+  "chiuso",
+  "terribile",
+  "ritardo",
+  "attento",
+  "bar",
+  "sembri",
+  "fallo",
+  "dimenticato",
+  "bisogna",
+  "impossibile",
+  "cioè",
+  "studio",
+  "stessi",
+  "arma",
+  "conosce",
+  "uscita",
+  "ii",
+  "fin",
+  "disse",
+  "david",
+  "vattene",
+  "quante",
+  "guai",
+  "intorno",
+  "video",
+  "manca",
+  "esserci",
+  "grosso",
+  "tanti",
+  "dolce",
+  "chiave",
+  "cervello",
+  "coraggio",
+  "interessante",
+};
+const uint16_t WA_FREQ_69_RANKS[] = {
+  0, 619, 0, 0, 0, 442, 687, 672, 717, 798, 0, 945, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 703, 0, 490, 670, 0, 0, 245, 0, 0, 0, 0,
+  0, 154, 863, 0, 0, 0, 0, 330, 0, 55, 340, 450, 843, 0, 16, 465,
+  0, 763, 0, 0, 678, 0, 425, 542, 195, 0, 0, 0, 602, 892, 0, 0,
+  351, 491, 824, 0, 595, 0, 0, 177, 228, 675, 701, 170, 750, 894, 0, 0,
+  0, 0, 0, 0, 0, 0, 92, 0, 0, 881, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 152, 180, 0, 0, 0, 371, 0, 299, 338, 0, 0, 737, 0,
+  278, 617, 61, 0, 0, 255, 638, 369, 545, 44, 312, 147, 486, 571, 592, 0,
+  218, 0, 0, 0, 0, 0, 22, 993, 137, 0, 552, 0, 589, 380, 292, 502,
+  507, 735, 0, 0, 621, 994, 0, 0, 0, 0, 0, 760, 0, 0, 0, 761,
+  0, 0, 919, 0, 0, 0, 0, 0, 0, 564, 553, 956, 0, 0, 0, 655,
+  0, 0, 0, 438, 240, 0, 363, 0, 295, 355, 0, 0, 0, 664, 784, 0,
+  0, 0, 861, 0, 0, 454, 852, 690, 0, 0, 156, 540, 0, 0, 268, 0,
+  0, 982, 0, 0, 0, 437, 148, 182, 610, 991, 0, 0, 897, 0, 197, 281,
+  647, 229, 286, 0, 0, 57, 0, 0, 0, 0, 501, 0, 0, 0, 949, 0,
+  0, 0, 0, 0, 213, 0, 582, 0, 910, 917, 0, 0, 0, 679, 628, 239,
+  751, 45, 661, 733, 981, 0, 258, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 3, 0, 0, 812, 525, 441, 206, 166, 649, 898, 933, 0, 0, 0,
+  0, 0, 980, 0, 0, 0, 659, 155, 400, 0, 0, 0, 0, 0, 0, 127,
+  0, 67, 640, 109, 199, 431, 100, 747, 0, 0, 0, 0, 698, 236, 248, 950,
+  0, 0, 0, 202, 518, 0, 0, 998, 902, 915, 0, 0, 0, 403, 0, 0,
+  0, 0, 0, 288, 280, 580, 0, 0, 0, 0, 0, 216, 0, 0, 38, 538,
+  637, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 587, 0, 0, 221, 335,
+  0, 0, 706, 0, 0, 82, 0, 167, 601, 581, 755, 0, 0, 629, 673, 497,
+  774, 890, 0, 131, 0, 489, 46, 722, 344, 0, 263, 161, 284, 523, 0, 318,
+  9, 10, 440, 856, 348, 953, 43, 445, 479, 918, 115, 0, 0, 0, 757, 692,
+  0, 0, 536, 42, 990, 973, 89, 0, 113, 846, 328, 0, 0, 855, 893, 0,
+  0, 0, 0, 8, 985, 0, 0, 0, 0, 0, 0, 482, 0, 0, 0, 339,
+  0, 32, 0, 0, 385, 965, 888, 305, 343, 365, 410, 304, 650, 920, 939, 130,
+  224, 586, 504, 725, 966, 840, 0, 233, 563, 976, 0, 766, 275, 0, 0, 0,
+  0, 0, 0, 443, 0, 0, 0, 212, 506, 0, 0, 0, 0, 0, 0, 0,
+  635, 936, 0, 0, 0, 0, 294, 547, 405, 593, 707, 721, 806, 829, 0, 0,
+  0, 0, 0, 817, 0, 633, 376, 782, 928, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 414, 142, 0, 0, 0,
+  0, 796, 0, 0, 6, 0, 0, 738, 937, 0, 0, 0, 0, 802, 688, 0,
+  0, 709, 476, 0, 0, 298, 463, 648, 125, 215, 723, 250, 321, 0, 186, 0,
+  0, 959, 0, 0, 0, 604, 0, 654, 478, 0, 0, 0, 361, 0, 515, 391,
+  908, 54, 780, 316, 300, 0, 0, 0, 0, 449, 532, 0, 144, 0, 0, 0,
+  105, 770, 356, 607, 724, 0, 682, 754, 31, 219, 0, 0, 62, 0, 0, 439,
+  0, 406, 739, 0, 0, 0, 0, 0, 0, 680, 50, 458, 577, 609, 711, 645,
+  797, 0, 290, 0, 0, 0, 0, 989, 0, 930, 383, 841, 0, 0, 0, 226,
+  0, 903, 0, 0, 0, 0, 867, 184, 0, 556, 0, 169, 349, 835, 899, 887,
+  819, 0, 0, 0, 117, 444, 847, 271, 0, 697, 0, 0, 25, 0, 0, 0,
+  0, 378, 0, 859, 354, 530, 0, 393, 362, 0, 0, 0, 0, 0, 0, 0,
+  0, 407, 0, 40, 0, 963, 99, 107, 616, 0, 372, 828, 776, 794, 63, 296,
+  0, 0, 759, 896, 301, 494, 728, 336, 0, 436, 483, 669, 0, 948, 0, 0,
+  0, 0, 0, 0, 191, 0, 940, 0, 157, 0, 0, 331, 0, 876, 455, 0,
+  0, 140, 430, 477, 822, 961, 0, 0, 0, 0, 0, 0, 0, 0, 0, 618,
+  0, 0, 658, 0, 0, 0, 613, 636, 0, 608, 0, 495, 498, 533, 543, 204,
+  816, 914, 0, 150, 103, 642, 877, 970, 0, 0, 0, 416, 882, 413, 0, 0,
+  574, 4, 68, 0, 573, 75, 190, 854, 0, 173, 453, 0, 381, 193, 366, 0,
+  0, 20, 466, 777, 0, 0, 0, 0, 827, 475, 0, 0, 788, 0, 73, 804,
+  0, 0, 0, 0, 0, 71, 0, 765, 512, 748, 783, 0, 135, 0, 0, 0,
+  0, 0, 0, 591, 0, 0, 78, 905, 419, 0, 452, 0, 0, 634, 0, 0,
+  320, 0, 59, 0, 0, 0, 262, 462, 0, 0, 0, 526, 541, 0, 28, 0,
+  0, 0, 411, 0, 90, 93, 324, 0, 0, 732, 14, 237, 885, 0, 390, 585,
+  0, 353, 667, 0, 0, 0, 0, 0, 76, 0, 0, 0, 0, 0, 0, 551,
+  132, 566, 527, 0, 493, 168, 826, 0, 270, 0, 308, 0, 0, 65, 598, 720,
+  0, 0, 0, 0, 0, 0, 359, 823, 0, 0, 0, 0, 0, 0, 29, 904,
+  0, 235, 467, 434, 555, 611, 639, 562, 0, 123, 317, 791, 0, 0, 0, 0,
+  0, 0, 0, 86, 451, 364, 972, 695, 979, 468, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 83, 302, 952, 256, 315, 0, 0, 0,
+  0, 174, 0, 0, 0, 0, 743, 0, 657, 943, 0, 0, 0, 0, 583, 886,
+  0, 84, 612, 0, 0, 0, 162, 225, 257, 957, 0, 0, 0, 0, 0, 0,
+  66, 149, 428, 222, 79, 0, 568, 0, 0, 557, 0, 923, 0, 576, 875, 0,
+  971, 0, 0, 831, 572, 183, 988, 0, 81, 764, 838, 0, 0, 0, 0, 485,
+  689, 767, 832, 921, 977, 198, 282, 0, 0, 505, 34, 464, 714, 172, 244, 389,
+  889, 0, 0, 834, 0, 0, 58, 377, 303, 0, 0, 129, 487, 992, 0, 0,
+  0, 151, 0, 0, 276, 864, 958, 0, 122, 35, 388, 0, 0, 809, 0, 0,
+  0, 0, 470, 0, 0, 0, 329, 0, 0, 870, 0, 0, 469, 53, 39, 7,
+  420, 426, 570, 91, 17, 742, 251, 460, 779, 900, 901, 554, 968, 0, 0, 868,
+  0, 0, 741, 435, 0, 729, 0, 0, 0, 0, 95, 597, 0, 550, 0, 283,
+  0, 0, 0, 0, 457, 0, 0, 0, 0, 0, 0, 0, 0, 0, 975, 404,
+  665, 0, 0, 708, 508, 685, 0, 77, 415, 954, 0, 0, 0, 620, 0, 0,
+  0, 845, 0, 652, 0, 0, 0, 0, 0, 47, 272, 52, 164, 267, 285, 674,
+  0, 373, 488, 0, 0, 0, 0, 171, 916, 0, 342, 384, 773, 0, 0, 0,
+  473, 534, 716, 0, 2, 395, 64, 752, 277, 0, 0, 402, 0, 0, 651, 758,
+  987, 0, 0, 0, 112, 217, 0, 997, 119, 474, 590, 872, 927, 660, 0, 0,
+  0, 0, 0, 0, 521, 880, 0, 0, 0, 0, 0, 693, 0, 0, 0, 97,
+  205, 0, 0, 0, 0, 0, 0, 803, 185, 0, 0, 0, 19, 0, 0, 839,
+  0, 0, 0, 145, 0, 0, 0, 0, 88, 883, 662, 0, 0, 0, 0, 350,
+  0, 0, 252, 0, 0, 223, 0, 72, 696, 352, 821, 786, 857, 941, 397, 446,
+  379, 116, 0, 0, 56, 0, 0, 0, 0, 0, 0, 0, 0, 935, 0, 0,
+  0, 0, 0, 781, 0, 96, 0, 0, 74, 472, 279, 424, 995, 0, 528, 641,
+  0, 432, 0, 423, 0, 118, 194, 0, 951, 0, 0, 108, 0, 313, 559, 567,
+  209, 684, 0, 287, 599, 69, 0, 0, 0, 232, 0, 0, 513, 0, 322, 699,
+  266, 974, 0, 106, 0, 0, 0, 853, 0, 0, 0, 0, 0, 0, 254, 187,
+  516, 0, 0, 0, 0, 0, 0, 807, 0, 101, 323, 358, 422, 531, 584, 306,
+  606, 801, 0, 0, 259, 41, 740, 746, 0, 0, 0, 0, 594, 944, 0, 0,
+  0, 0, 85, 744, 653, 842, 700, 0, 549, 0, 643, 683, 201, 865, 0, 731,
+  0, 0, 946, 529, 745, 579, 805, 0, 0, 499, 314, 511, 715, 0, 0, 0,
+  230, 0, 128, 231, 260, 749, 922, 13, 189, 0, 0, 136, 87, 644, 70, 360,
+  496, 913, 0, 0, 480, 848, 0, 0, 0, 124, 163, 188, 858, 0, 0, 0,
+  367, 0, 0, 0, 0, 0, 0, 907, 0, 0, 0, 433, 0, 999, 447, 825,
+  401, 0, 0, 0, 730, 0, 0, 60, 964, 0, 0, 0, 492, 0, 0, 0,
+  110, 325, 412, 0, 253, 311, 0, 220, 326, 0, 0, 0, 631, 0, 0, 0,
+  327, 386, 12, 207, 398, 785, 860, 0, 866, 319, 0, 0, 0, 0, 0, 0,
+  681, 0, 0, 0, 0, 869, 0, 0, 0, 427, 481, 0, 0, 0, 0, 565,
+  0, 503, 0, 104, 196, 500, 691, 0, 134, 0, 0, 0, 814, 0, 461, 694,
+  94, 769, 337, 0, 539, 261, 0, 0, 408, 0, 524, 307, 705, 0, 0, 0,
+  0, 368, 0, 0, 0, 121, 175, 126, 934, 960, 0, 878, 0, 0, 0, 246,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 713, 996, 0, 26, 625,
+  264, 736, 0, 0, 310, 0, 0, 0, 0, 978, 0, 624, 0, 0, 0, 0,
+  0, 24, 0, 1, 111, 392, 929, 18, 0, 0, 0, 274, 0, 0, 862, 0,
+  0, 0, 0, 0, 0, 0, 0, 102, 48, 0, 0, 0, 0, 544, 623, 668,
+  0, 0, 0, 138, 955, 0, 0, 800, 0, 0, 0, 374, 677, 986, 153, 399,
+  548, 600, 0, 289, 789, 0, 0, 0, 0, 0, 0, 0, 0, 509, 133, 139,
+  510, 710, 0, 772, 238, 0, 0, 0, 409, 0, 0, 297, 517, 0, 615, 0,
+  799, 768, 0, 15, 0, 30, 0, 775, 247, 561, 778, 0, 0, 0, 0, 375,
+  578, 926, 984, 0, 0, 141, 234, 0, 227, 269, 0, 159, 120, 632, 895, 0,
+  0, 0, 0, 181, 387, 0, 762, 214, 790, 0, 0, 484, 558, 656, 0, 36,
+  0, 884, 0, 0, 0, 931, 179, 0, 241, 712, 0, 702, 818, 176, 346, 0,
+  0, 0, 418, 49, 0, 0, 0, 0, 0, 0, 0, 663, 0, 874, 879, 630,
+  0, 0, 605, 849, 0, 0, 0, 0, 603, 341, 0, 0, 0, 98, 0, 0,
+  0, 0, 811, 0, 37, 719, 0, 0, 0, 519, 0, 871, 0, 243, 836, 0,
+  734, 962, 0, 0, 810, 0, 0, 795, 0, 165, 273, 0, 421, 0, 0, 676,
+  912, 0, 334, 0, 0, 0, 0, 0, 0, 793, 514, 0, 833, 0, 0, 0,
+  522, 0, 0, 0, 718, 771, 0, 0, 0, 0, 787, 0, 448, 0, 756, 575,
+  0, 396, 158, 210, 249, 0, 0, 0, 0, 0, 0, 626, 33, 0, 471, 850,
+  114, 873, 0, 0, 51, 80, 146, 200, 932, 242, 5, 0, 27, 0, 0, 347,
+  1000, 192, 546, 891, 203, 265, 0, 792, 704, 909, 520, 0, 309, 646, 0, 0,
+  0, 160, 333, 0, 0, 0, 0, 535, 925, 813, 357, 666, 0, 0, 0, 0,
+  293, 569, 332, 459, 0, 0, 456, 291, 0, 0, 11, 0, 0, 0, 0, 429,
+  686, 0, 537, 0, 0, 0, 0, 0, 622, 837, 596, 938, 0, 0, 830, 0,
+  394, 560, 820, 0, 0, 0, 0, 671, 0, 0, 983, 0, 0, 417, 21, 851,
+  969, 942, 0, 178, 208, 211, 345, 588, 911, 0, 0, 0, 967, 727, 0, 0,
+  0, 0, 753, 0, 815, 0, 0, 370, 0, 627, 0, 726, 0, 0, 0, 143,
+  0, 0, 924, 0, 614, 808, 906, 947, 0, 844, 0, 0, 382, 0, 23, 0,
+};
+
+const char *WA_FREQ_70_TOKENS[] = {
+  "アン",
+  "リア",
+  "引き",
+  "取り",
+  "アー",
+  "持ち",
+  "上げ",
+  "イア",
+  "アイ",
+  "あり",
+  "けア",
+  "生き",
+  "連れ",
+  "受け",
+  "まり",
+  "アレ",
+  "殺し",
+  "アリ",
+  "りが",
+  "あん",
+  "楽し",
+  "間違",
+  "初め",
+  "手伝",
+  "付け",
+  "あた",
+  "付き",
+  "話し",
+  "当た",
+  "ライ",
+  "入り",
+  "イリ",
+  "ディ",
+  "ジュ",
+  "たり",
+  "立ち",
+  "ああ",
+  "人知",
+  "当時",
+  "がと",
+  "出来",
+  "入電",
+  "同じ",
+  "入れ",
+  "止め",
+  "起こ",
+  "食べ",
+  "人下",
+  "伝え",
+  "向か",
+  "ある",
+  "リカ",
+  "体大",
+  "落ち",
+  "ち着",
+  "あっ",
+  "大き",
+  "上手",
+  "り近",
+  "んな",
+  "始ま",
+  "あら",
+  "の子",
+  "れ警",
+  "して",
+  "馬鹿",
+  "降り",
+  "り大",
+  "近づ",
+  "小さ",
+  "着け",
+  "無し",
+  "人期",
+  "日付",
+  "ック",
+  "代わ",
+  "上が",
+  "決ま",
+  "行き",
+  "き合",
+  "出会",
+  "知り",
+  "り合",
+  "合い",
+  "語ア",
+  "かり",
+  "見張",
+  "支払",
+  "知ら",
+  "て上",
+  "表現",
+  "アッ",
+  "ニア",
+  "リー",
+  "リス",
+  "ュリ",
+  "マン",
+  "世代",
+  "出売",
+  "イス",
+  "所持",
+  "引っ",
+  "下ろ",
+  "人進",
+  "マリ",
+  "乗り",
+  "続き",
+  "り引",
+  "無く",
+  "動手",
+  "アル",
+  "バイ",
+  "アフ",
+  "り意",
+  "送り",
+  "ット",
+  "、。",
+  "。何",
+  "何あ",
+  "あな",
+  "なた",
+  "た言",
+  "言行",
+  "行人",
+  "知）",
+  "）（",
+  "（事",
+  "事彼",
+  "彼女",
+  "女お",
+  "お前",
+  "前話",
+  "話来",
+  "来分",
+  "分か",
+  "か者",
+  "者聞",
+  "聞死",
+  "死時",
+  "時あ",
+  "あ殺",
+  "殺前",
+  "前中",
+  "中達",
+  "達必",
+  "必要",
+  "要あ",
+  "あの",
+  "の気",
+  "気大",
+  "大丈",
+  "丈夫",
+  "夫」",
+  "」「",
+  "「自",
+  "自分",
+  "分持",
+  "持本",
+  "本当",
+  "時間",
+  "間我",
+  "我々",
+  "々一",
+  "一的",
+  "的無",
+  "無あ",
+  "とう",
+  "う家",
+  "家会",
+  "会日",
+  "日年",
+  "年仕",
+  "仕事",
+  "事手",
+  "手一",
+  "一緒",
+  "緒後",
+  "後出",
+  "来他",
+  "他入",
+  "電話",
+  "話目",
+  "目様",
+  "様分",
+  "分車",
+  "車所",
+  "所あ",
+  "んた",
+  "た度",
+  "度同",
+  "じ場",
+  "場所",
+  "所問",
+  "問題",
+  "題子",
+  "子供",
+  "供愛",
+  "愛金",
+  "金名",
+  "名前",
+  "前子",
+  "子信",
+  "信さ",
+  "さあ",
+  "あ少",
+  "少し",
+  "し使",
+  "使全",
+  "全て",
+  "て世",
+  "世界",
+  "界教",
+  "教え",
+  "え通",
+  "通り",
+  "り来",
+  "来る",
+  "る上",
+  "上入",
+  "れ人",
+  "人間",
+  "間行",
+  "行け",
+  "け今",
+  "今日",
+  "日物",
+  "物女",
+  "女呼",
+  "呼生",
+  "きあ",
+  "あれ",
+  "れじ",
+  "じゃ",
+  "ゃあ",
+  "あ止",
+  "め心",
+  "心配",
+  "配母",
+  "母連",
+  "れ関",
+  "関係",
+  "係外",
+  "外家",
+  "家族",
+  "族起",
+  "起き",
+  "き意",
+  "意味",
+  "味神",
+  "神警",
+  "警察",
+  "察力",
+  "力最",
+  "最後",
+  "後作",
+  "作次",
+  "次息",
+  "息子",
+  "子取",
+  "取全",
+  "全部",
+  "部間",
+  "間書",
+  "書捜",
+  "捜査",
+  "査起",
+  "こ回",
+  "回別",
+  "別情",
+  "情報",
+  "報理",
+  "理由",
+  "由数",
+  "数一",
+  "一人",
+  "人部",
+  "部屋",
+  "屋以",
+  "以上",
+  "上人",
+  "人生",
+  "生急",
+  "急食",
+  "べ女",
+  "女性",
+  "性続",
+  "続け",
+  "け事",
+  "事件",
+  "件始",
+  "始め",
+  "め最",
+  "最初",
+  "初連",
+  "連絡",
+  "絡ま",
+  "まあ",
+  "あ調",
+  "調べ",
+  "べ安",
+  "安全",
+  "全下",
+  "下さ",
+  "さ楽",
+  "し殺",
+  "殺人",
+  "下万",
+  "万友",
+  "友達",
+  "達約",
+  "約束",
+  "束二",
+  "二結",
+  "結婚",
+  "婚無",
+  "無理",
+  "理感",
+  "感じ",
+  "じ得",
+  "得最",
+  "最高",
+  "高送",
+  "送計",
+  "計画",
+  "画仲",
+  "仲間",
+  "間先",
+  "先可",
+  "可能",
+  "能あ",
+  "あい",
+  "いつ",
+  "つあ",
+  "あと",
+  "と明",
+  "明日",
+  "日変",
+  "変わ",
+  "わ聞",
+  "聞こ",
+  "こえ",
+  "え確",
+  "確認",
+  "認命",
+  "命着",
+  "着与",
+  "与え",
+  "え全",
+  "全員",
+  "員動",
+  "動理",
+  "理解",
+  "解二",
+  "二人",
+  "人開",
+  "開け",
+  "け友",
+  "友人",
+  "人機",
+  "機不",
+  "不あ",
+  "あげ",
+  "げ離",
+  "離れ",
+  "れ戦",
+  "戦先",
+  "先生",
+  "生言",
+  "言え",
+  "え質",
+  "質問",
+  "問置",
+  "置犯",
+  "犯人",
+  "人受",
+  "け感",
+  "感第",
+  "第あ",
+  "あぁ",
+  "ぁ伝",
+  "え素",
+  "素晴",
+  "晴ら",
+  "らし",
+  "しド",
+  "ドア",
+  "ア本",
+  "本乗",
+  "乗用",
+  "用感",
+  "感謝",
+  "謝正",
+  "正し",
+  "し言",
+  "言葉",
+  "葉大",
+  "大立",
+  "立写",
+  "写真",
+  "真２",
+  "２人",
+  "人説",
+  "説明",
+  "明博",
+  "博士",
+  "士強",
+  "強絶",
+  "絶対",
+  "対座",
+  "座国",
+  "国向",
+  "か名",
+  "名あ",
+  "る野",
+  "野郎",
+  "郎番",
+  "番一",
+  "一番",
+  "番重",
+  "重要",
+  "要状",
+  "状況",
+  "況元",
+  "元気",
+  "気水",
+  "水変",
+  "変え",
+  "え十",
+  "十分",
+  "分週",
+  "週間",
+  "間や",
+  "やあ",
+  "あ父",
+  "父親",
+  "親間",
+  "違い",
+  "い王",
+  "王了",
+  "了解",
+  "解相",
+  "相手",
+  "手員",
+  "員声",
+  "声会",
+  "会え",
+  "え音",
+  "音多",
+  "多く",
+  "く消",
+  "消え",
+  "え会",
+  "会社",
+  "社簡",
+  "簡単",
+  "単選",
+  "選残",
+  "残念",
+  "念自",
+  "自由",
+  "由自",
+  "自身",
+  "身等",
+  "等一",
+  "一体",
+  "体人",
+  "人々",
+  "々報",
+  "報告",
+  "告読",
+  "読過",
+  "過ぎ",
+  "ぎ通",
+  "通ア",
+  "アメ",
+  "メリ",
+  "カ元",
+  "元命",
+  "命令",
+  "令高",
+  "高体",
+  "大統",
+  "統領",
+  "領月",
+  "月警",
+  "警官",
+  "官語",
+  "語学",
+  "学校",
+  "校対",
+  "対決",
+  "決め",
+  "め真",
+  "真実",
+  "実初",
+  "めて",
+  "て口",
+  "口大",
+  "大変",
+  "変要",
+  "要変",
+  "変戦",
+  "戦争",
+  "争学",
+  "学あ",
+  "あそ",
+  "そこ",
+  "こ武",
+  "武器",
+  "器店",
+  "店母",
+  "母親",
+  "親刑",
+  "刑事",
+  "事気",
+  "気持",
+  "ち間",
+  "違運",
+  "運記",
+  "記録",
+  "録光",
+  "光手",
+  "伝深",
+  "深落",
+  "着存",
+  "存在",
+  "在実",
+  "実役",
+  "役病",
+  "病院",
+  "院住",
+  "住責",
+  "責任",
+  "任あ",
+  "っ普",
+  "普通",
+  "通行",
+  "行動",
+  "動大",
+  "きな",
+  "な監",
+  "監視",
+  "視協",
+  "協力",
+  "力多",
+  "多分",
+  "分実",
+  "実際",
+  "際足",
+  "足地",
+  "地球",
+  "球生",
+  "生活",
+  "活任",
+  "任せ",
+  "せ気",
+  "気分",
+  "分解",
+  "解決",
+  "決結",
+  "結果",
+  "果調",
+  "調査",
+  "査研",
+  "研究",
+  "究何",
+  "何処",
+  "処発",
+  "発見",
+  "見場",
+  "場大",
+  "大事",
+  "事止",
+  "止ま",
+  "ま興",
+  "興味",
+  "味大",
+  "き生",
+  "生な",
+  "なあ",
+  "あ運",
+  "運転",
+  "転ヶ",
+  "ヶ月",
+  "月多",
+  "多１",
+  "１人",
+  "人番",
+  "番号",
+  "号状",
+  "状態",
+  "態来",
+  "来い",
+  "い開",
+  "開上",
+  "手済",
+  "済場",
+  "場合",
+  "合刑",
+  "刑務",
+  "務今",
+  "今度",
+  "度以",
+  "以外",
+  "外朝",
+  "朝飛",
+  "飛行",
+  "行あ",
+  "あま",
+  "近く",
+  "く後",
+  "後ろ",
+  "ろ目",
+  "目的",
+  "的歌",
+  "歌面",
+  "面白",
+  "白弁",
+  "弁護",
+  "護客",
+  "客売",
+  "売特",
+  "特別",
+  "別昨",
+  "昨日",
+  "日少",
+  "少な",
+  "な認",
+  "認め",
+  "め死",
+  "死体",
+  "体医",
+  "医者",
+  "者装",
+  "装置",
+  "置共",
+  "共唯",
+  "唯一",
+  "一あ",
+  "な不",
+  "不明",
+  "明限",
+  "限り",
+  "り信",
+  "信用",
+  "用美",
+  "美し",
+  "し用",
+  "用意",
+  "意話",
+  "話せ",
+  "せ移",
+  "移動",
+  "動映",
+  "映画",
+  "画美",
+  "美咲",
+  "咲取",
+  "取引",
+  "引最",
+  "最近",
+  "近現",
+  "現場",
+  "場事",
+  "事故",
+  "故連",
+  "連中",
+  "中過",
+  "過去",
+  "去全",
+  "全く",
+  "く選",
+  "選択",
+  "択完",
+  "完全",
+  "全信",
+  "信じ",
+  "じ信",
+  "信頼",
+  "頼町",
+  "町何",
+  "何故",
+  "故始",
+  "ま精",
+  "精神",
+  "神付",
+  "けあ",
+  "ら女",
+  "女の",
+  "子気",
+  "気づ",
+  "づ記",
+  "記憶",
+  "憶頑",
+  "頑張",
+  "張2",
+  "2人",
+  "人素",
+  "素敵",
+  "敵身",
+  "身価",
+  "価値",
+  "値有",
+  "有非",
+  "非常",
+  "常三",
+  "三最",
+  "最も",
+  "も両",
+  "両親",
+  "親人",
+  "人物",
+  "物生",
+  "生ま",
+  "まれ",
+  "警備",
+  "備以",
+  "以前",
+  "前無",
+  "無事",
+  "事聞",
+  "聞け",
+  "け決",
+  "決し",
+  "て銀",
+  "銀行",
+  "行馬",
+  "鹿裁",
+  "裁判",
+  "判降",
+  "大学",
+  "学州",
+  "州今",
+  "今回",
+  "回空",
+  "空経",
+  "経験",
+  "験本",
+  "本物",
+  "物部",
+  "部化",
+  "化未",
+  "未来",
+  "来正",
+  "正直",
+  "直年",
+  "年間",
+  "間無",
+  "無駄",
+  "駄現",
+  "現れ",
+  "れ島",
+  "島病",
+  "病気",
+  "気内",
+  "内風",
+  "風結",
+  "結構",
+  "構治",
+  "治療",
+  "療予",
+  "予定",
+  "定点",
+  "点1",
+  "1人",
+  "人許",
+  "許可",
+  "可勇",
+  "勇気",
+  "気最",
+  "最悪",
+  "悪本",
+  "本気",
+  "気全",
+  "全然",
+  "然任",
+  "任務",
+  "務日",
+  "日本",
+  "本作",
+  "作戦",
+  "戦成",
+  "成功",
+  "功進",
+  "進近",
+  "づ品",
+  "品消",
+  "消小",
+  "さな",
+  "な科",
+  "科学",
+  "学放",
+  "放向",
+  "向こ",
+  "こう",
+  "う事",
+  "事実",
+  "実食",
+  "食関",
+  "関戦",
+  "戦い",
+  "い少",
+  "少年",
+  "年爆",
+  "爆発",
+  "発現",
+  "現実",
+  "実保",
+  "保護",
+  "護地",
+  "地下",
+  "下隊",
+  "隊地",
+  "地別",
+  "別れ",
+  "れ時",
+  "時代",
+  "代使",
+  "使え",
+  "え組",
+  "組織",
+  "織式",
+  "式落",
+  "け動",
+  "動物",
+  "物無",
+  "し下",
+  "下が",
+  "が技",
+  "技術",
+  "術個",
+  "個人",
+  "期待",
+  "待調",
+  "調子",
+  "子線",
+  "線局",
+  "局利",
+  "利用",
+  "用主",
+  "主人",
+  "人館",
+  "館毎",
+  "毎日",
+  "付当",
+  "当然",
+  "然患",
+  "患者",
+  "者全",
+  "全今",
+  "今朝",
+  "朝過",
+  "過ご",
+  "ご馬",
+  "馬あ",
+  "あー",
+  "ーあ",
+  "たし",
+  "し立",
+  "立て",
+  "て地",
+  "地獄",
+  "獄：",
+  "：合",
+  "合続",
+  "続陛",
+  "陛下",
+  "下小",
+  "さ火",
+  "火平",
+  "平気",
+  "気世",
+  "世話",
+  "話能",
+  "能力",
+  "力理",
+  "理子",
+  "子検",
+  "検査",
+  "査ア",
+  "レッ",
+  "クス",
+  "ス木",
+  "木号",
+  "号山",
+  "山解",
+  "解警",
+  "警部",
+  "部食",
+  "食事",
+  "事幸",
+  "幸運",
+  "運構",
+  "構侵",
+  "侵入",
+  "入駄",
+  "駄目",
+  "目緊",
+  "緊急",
+  "急親",
+  "親父",
+  "父気",
+  "気付",
+  "付主",
+  "主速",
+  "速代",
+  "わり",
+  "り休",
+  "休原",
+  "原因",
+  "因警",
+  "警告",
+  "告山",
+  "山里",
+  "里特",
+  "特に",
+  "に部",
+  "部下",
+  "下運",
+  "運命",
+  "命到",
+  "到着",
+  "着自",
+  "自殺",
+  "殺屋",
+  "屋現",
+  "現在",
+  "在一",
+  "一部",
+  "部行",
+  "行為",
+  "為遺",
+  "遺体",
+  "大切",
+  "切関",
+  "関わ",
+  "わ常",
+  "常感",
+  "感情",
+  "情夕",
+  "夕食",
+  "食星",
+  "星達",
+  "達也",
+  "也手",
+  "手紙",
+  "紙混",
+  "混乱",
+  "乱支",
+  "支配",
+  "配影",
+  "影響",
+  "響受",
+  "け入",
+  "れ知",
+  "知れ",
+  "れ行",
+  "行方",
+  "方少",
+  "少女",
+  "女位",
+  "位半",
+  "半分",
+  "分誕",
+  "誕生",
+  "生超",
+  "超施",
+  "施設",
+  "設殺",
+  "殺せ",
+  "せ向",
+  "向け",
+  "け機",
+  "機会",
+  "会人",
+  "人類",
+  "類正",
+  "正確",
+  "確色",
+  "色々",
+  "々活",
+  "活動",
+  "動料",
+  "料理",
+  "理要",
+  "要求",
+  "求再",
+  "再指",
+  "指示",
+  "示部",
+  "部隊",
+  "隊何",
+  "何者",
+  "者音",
+  "音楽",
+  "楽上",
+  "げ管",
+  "管理",
+  "理映",
+  "映像",
+};
+const uint16_t WA_FREQ_70_RANKS[] = {
+  962, 320, 297, 0, 965, 0, 0, 79, 0, 550, 182, 875, 732, 0, 0, 197,
+  28, 611, 0, 0, 592, 947, 0, 0, 768, 908, 0, 0, 231, 0, 1000, 0,
+  0, 0, 212, 203, 263, 582, 726, 0, 11, 0, 429, 441, 927, 402, 78, 0,
+  0, 0, 0, 369, 0, 565, 317, 0, 0, 0, 0, 337, 499, 190, 115, 523,
+  351, 608, 0, 490, 0, 0, 0, 395, 831, 0, 0, 221, 0, 435, 439, 590,
+  837, 0, 0, 448, 440, 749, 0, 0, 100, 553, 217, 133, 220, 0, 0, 814,
+  0, 586, 0, 0, 210, 0, 976, 0, 0, 0, 0, 670, 0, 0, 0, 0,
+  770, 0, 0, 612, 0, 155, 937, 1, 914, 703, 892, 907, 0, 905, 183, 0,
+  0, 0, 33, 0, 331, 0, 0, 616, 0, 0, 0, 0, 0, 790, 0, 0,
+  384, 0, 0, 850, 0, 0, 0, 0, 695, 326, 461, 42, 591, 0, 0, 0,
+  250, 601, 0, 330, 394, 0, 0, 7, 399, 35, 30, 745, 751, 0, 810, 0,
+  0, 0, 0, 567, 0, 543, 0, 25, 862, 223, 0, 0, 341, 967, 300, 0,
+  316, 283, 161, 736, 0, 0, 0, 0, 0, 0, 0, 541, 0, 579, 0, 0,
+  530, 987, 602, 772, 0, 149, 191, 0, 0, 113, 287, 477, 166, 0, 174, 325,
+  778, 383, 248, 780, 610, 527, 691, 860, 0, 417, 179, 0, 660, 0, 0, 0,
+  0, 0, 624, 340, 0, 627, 0, 0, 0, 0, 955, 0, 0, 0, 954, 329,
+  0, 0, 842, 0, 0, 746, 0, 0, 0, 0, 0, 255, 0, 186, 41, 423,
+  302, 0, 0, 946, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 479, 779,
+  0, 0, 0, 0, 657, 290, 0, 10, 233, 719, 797, 901, 918, 0, 0, 0,
+  515, 0, 866, 0, 43, 0, 0, 874, 0, 360, 0, 0, 0, 950, 0, 26,
+  481, 218, 408, 694, 923, 995, 69, 0, 0, 0, 0, 0, 0, 652, 820, 0,
+  0, 0, 0, 0, 574, 386, 59, 178, 921, 721, 0, 491, 0, 0, 0, 0,
+  665, 997, 305, 0, 0, 0, 798, 0, 170, 525, 0, 193, 847, 0, 966, 0,
+  371, 687, 0, 165, 938, 968, 361, 45, 492, 517, 656, 279, 0, 0, 0, 0,
+  0, 0, 0, 542, 484, 664, 725, 70, 740, 0, 0, 899, 139, 681, 0, 0,
+  0, 0, 358, 66, 0, 244, 353, 573, 748, 0, 120, 928, 0, 0, 0, 0,
+  0, 0, 758, 516, 487, 0, 0, 533, 0, 313, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 108, 180, 18, 84, 68, 932, 0, 0, 497,
+  0, 0, 0, 0, 251, 0, 0, 0, 0, 0, 600, 763, 524, 0, 0, 27,
+  0, 0, 998, 0, 0, 289, 0, 970, 357, 403, 773, 393, 488, 852, 32, 856,
+  948, 985, 597, 659, 0, 0, 106, 886, 0, 558, 0, 713, 0, 0, 0, 0,
+  826, 0, 822, 0, 246, 0, 0, 0, 0, 0, 0, 273, 0, 0, 0, 0,
+  209, 690, 764, 0, 0, 0, 830, 307, 654, 308, 756, 434, 868, 3, 274, 0,
+  0, 762, 0, 0, 0, 0, 0, 0, 0, 366, 502, 0, 0, 0, 0, 0,
+  696, 0, 243, 208, 339, 455, 0, 0, 0, 0, 0, 642, 105, 0, 0, 0,
+  0, 0, 716, 406, 0, 0, 619, 0, 0, 0, 0, 0, 0, 857, 0, 0,
+  513, 0, 588, 0, 0, 483, 0, 269, 0, 0, 143, 953, 0, 128, 258, 0,
+  641, 0, 817, 782, 833, 0, 0, 0, 271, 0, 0, 0, 0, 0, 478, 421,
+  0, 816, 0, 0, 426, 0, 508, 40, 800, 0, 39, 805, 0, 0, 110, 466,
+  61, 215, 328, 551, 722, 6, 272, 355, 671, 235, 0, 0, 0, 578, 666, 774,
+  0, 0, 0, 0, 0, 505, 228, 585, 0, 0, 0, 200, 776, 0, 792, 0,
+  0, 480, 975, 631, 0, 887, 0, 0, 57, 0, 0, 0, 0, 855, 646, 398,
+  0, 164, 31, 254, 465, 98, 587, 0, 0, 0, 0, 0, 169, 414, 111, 685,
+  37, 148, 299, 323, 422, 236, 58, 311, 576, 701, 877, 930, 522, 994, 0, 13,
+  0, 348, 0, 0, 268, 0, 0, 0, 0, 12, 0, 0, 0, 0, 22, 412,
+  315, 0, 0, 275, 0, 0, 0, 964, 0, 213, 580, 474, 127, 230, 342, 771,
+  839, 4, 888, 688, 0, 0, 766, 396, 552, 0, 0, 0, 284, 390, 942, 0,
+  0, 0, 0, 0, 321, 781, 0, 0, 0, 318, 900, 188, 0, 0, 0, 343,
+  0, 0, 0, 0, 0, 257, 0, 0, 0, 0, 859, 0, 0, 738, 0, 0,
+  783, 563, 192, 0, 0, 757, 789, 0, 0, 0, 391, 0, 0, 0, 0, 442,
+  0, 0, 0, 829, 935, 0, 0, 0, 8, 0, 0, 0, 916, 87, 0, 129,
+  638, 0, 958, 0, 437, 0, 89, 0, 375, 411, 0, 81, 0, 546, 526, 683,
+  832, 0, 0, 0, 561, 134, 146, 883, 0, 872, 0, 0, 261, 304, 0, 249,
+  498, 0, 0, 278, 53, 0, 0, 864, 447, 0, 0, 0, 0, 0, 0, 0,
+  712, 0, 777, 0, 85, 0, 0, 44, 0, 775, 812, 0, 804, 969, 0, 194,
+  473, 0, 0, 614, 648, 0, 0, 0, 0, 519, 0, 389, 0, 698, 247, 0,
+  0, 211, 684, 0, 934, 979, 124, 668, 559, 799, 0, 181, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 462, 489, 91, 140, 450, 196, 734, 0, 49, 0,
+  0, 0, 0, 0, 0, 0, 338, 0, 0, 715, 0, 0, 0, 0, 0, 0,
+  0, 397, 528, 0, 869, 0, 0, 824, 224, 678, 737, 374, 0, 0, 0, 956,
+  141, 0, 0, 0, 9, 256, 605, 359, 615, 125, 676, 974, 996, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 451, 0, 755, 0, 152, 0, 0, 0, 902, 117,
+  92, 309, 802, 945, 472, 658, 0, 206, 142, 728, 890, 594, 0, 47, 99, 599,
+  0, 622, 634, 486, 0, 157, 0, 0, 677, 682, 0, 704, 0, 0, 0, 0,
+  431, 0, 147, 0, 112, 669, 0, 0, 94, 21, 878, 0, 693, 714, 327, 0,
+  0, 0, 0, 0, 0, 0, 0, 214, 896, 0, 0, 0, 0, 504, 0, 0,
+  0, 679, 977, 0, 566, 819, 0, 0, 0, 0, 0, 82, 568, 583, 234, 17,
+  651, 735, 861, 54, 929, 0, 0, 922, 0, 109, 387, 510, 941, 0, 0, 0,
+  889, 0, 176, 0, 931, 0, 0, 293, 891, 0, 101, 0, 0, 114, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 972, 0, 0, 90, 0, 643, 0, 16,
+  184, 0, 910, 452, 0, 754, 811, 0, 0, 432, 801, 750, 0, 0, 680, 245,
+  0, 760, 626, 145, 603, 815, 225, 0, 0, 0, 0, 456, 741, 0, 0, 56,
+  467, 464, 813, 404, 0, 742, 50, 0, 0, 349, 535, 925, 0, 72, 345, 0,
+  637, 0, 821, 0, 226, 280, 933, 0, 913, 0, 915, 0, 0, 0, 0, 350,
+  0, 0, 0, 322, 0, 0, 986, 706, 0, 0, 162, 413, 0, 557, 0, 0,
+  0, 581, 177, 661, 828, 739, 705, 0, 0, 367, 0, 0, 0, 0, 0, 0,
+  0, 29, 227, 103, 401, 122, 430, 303, 759, 981, 973, 469, 540, 336, 0, 202,
+  500, 0, 438, 0, 0, 0, 34, 639, 844, 960, 963, 151, 156, 0, 154, 548,
+  0, 0, 0, 0, 0, 0, 0, 168, 0, 0, 554, 0, 786, 0, 723, 0,
+  0, 260, 0, 454, 285, 0, 0, 0, 0, 0, 0, 0, 0, 0, 126, 0,
+  531, 400, 633, 720, 876, 503, 863, 222, 761, 0, 0, 0, 0, 0, 0, 0,
+  0, 569, 0, 0, 858, 0, 0, 0, 0, 0, 0, 0, 904, 0, 0, 380,
+  324, 370, 589, 709, 843, 884, 267, 238, 983, 635, 0, 410, 520, 0, 0, 0,
+  949, 0, 0, 0, 672, 0, 130, 0, 562, 0, 0, 537, 0, 132, 468, 549,
+  0, 0, 0, 0, 620, 0, 14, 795, 97, 385, 632, 724, 0, 335, 0, 0,
+  0, 0, 0, 747, 0, 0, 15, 116, 55, 604, 662, 897, 0, 0, 0, 0,
+  175, 0, 0, 0, 0, 0, 0, 0, 0, 51, 0, 0, 173, 944, 0, 0,
+  0, 0, 0, 0, 0, 252, 0, 405, 199, 470, 494, 545, 596, 787, 879, 0,
+  0, 0, 0, 0, 0, 0, 189, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  895, 744, 0, 264, 0, 0, 286, 20, 882, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 306, 362, 0, 0, 0, 0, 0, 0, 730, 936, 0, 0, 0, 0,
+  0, 0, 67, 796, 0, 253, 0, 281, 0, 0, 352, 0, 0, 618, 436, 96,
+  459, 595, 718, 88, 990, 0, 984, 717, 310, 46, 205, 493, 415, 0, 999, 0,
+  137, 0, 0, 71, 607, 0, 0, 803, 577, 0, 0, 0, 144, 0, 172, 292,
+  0, 0, 0, 871, 219, 791, 0, 0, 0, 0, 0, 0, 418, 0, 216, 920,
+  241, 0, 0, 0, 0, 867, 0, 628, 0, 0, 0, 0, 0, 951, 453, 73,
+  727, 62, 77, 381, 0, 0, 544, 613, 697, 572, 376, 571, 575, 60, 138, 476,
+  534, 765, 835, 0, 0, 0, 0, 0, 598, 48, 291, 609, 623, 64, 708, 0,
+  0, 0, 0, 52, 372, 506, 686, 982, 0, 0, 988, 0, 0, 0, 0, 0,
+  496, 75, 86, 378, 702, 0, 136, 0, 0, 0, 501, 83, 198, 667, 153, 655,
+  0, 379, 407, 692, 495, 0, 23, 485, 0, 364, 368, 784, 365, 959, 201, 204,
+  898, 0, 104, 0, 0, 836, 259, 239, 943, 818, 332, 0, 0, 0, 0, 0,
+  0, 940, 0, 356, 0, 0, 838, 0, 0, 0, 0, 0, 636, 0, 0, 0,
+  0, 593, 846, 0, 911, 808, 827, 0, 0, 298, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 334, 0, 0, 0, 121, 0, 0, 650, 0, 0, 0, 74,
+  288, 823, 0, 640, 457, 0, 532, 0, 0, 865, 0, 0, 185, 853, 237, 446,
+  460, 785, 894, 93, 427, 710, 752, 0, 135, 0, 629, 0, 0, 0, 0, 482,
+  881, 0, 0, 195, 131, 978, 674, 0, 0, 0, 0, 424, 0, 0, 0, 0,
+  0, 0, 675, 0, 870, 0, 0, 123, 0, 0, 346, 0, 630, 0, 0, 0,
+  0, 0, 0, 294, 0, 0, 0, 0, 0, 419, 991, 0, 0, 425, 0, 0,
+  0, 65, 854, 906, 621, 957, 729, 0, 0, 880, 699, 409, 649, 38, 992, 118,
+  265, 0, 0, 282, 514, 0, 673, 0, 0, 63, 0, 0, 0, 0, 518, 0,
+  0, 0, 0, 0, 0, 276, 0, 0, 277, 0, 536, 382, 538, 647, 885, 0,
+  0, 36, 80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  845, 0, 0, 0, 0, 160, 167, 0, 0, 0, 150, 0, 653, 584, 319, 689,
+  663, 0, 0, 0, 0, 0, 0, 187, 240, 0, 301, 841, 388, 961, 266, 377,
+  0, 333, 0, 0, 0, 119, 794, 731, 0, 0, 0, 0, 444, 939, 102, 354,
+  471, 644, 840, 312, 971, 924, 919, 507, 529, 809, 570, 107, 509, 767, 769, 0,
+  989, 2, 0, 733, 0, 806, 163, 0, 0, 0, 0, 0, 373, 0, 0, 0,
+  0, 0, 363, 0, 0, 825, 159, 0, 229, 0, 5, 0, 0, 95, 521, 0,
+  0, 952, 0, 851, 0, 0, 0, 270, 0, 392, 0, 0, 0, 416, 0, 556,
+  980, 0, 0, 555, 0, 0, 0, 0, 0, 707, 19, 458, 625, 463, 711, 903,
+  788, 344, 0, 0, 743, 0, 0, 0, 753, 912, 0, 700, 511, 0, 560, 262,
+  0, 617, 993, 158, 295, 926, 0, 645, 0, 475, 917, 0, 347, 0, 242, 0,
+  0, 0, 0, 0, 0, 807, 0, 0, 0, 0, 606, 564, 793, 232, 0, 539,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 171, 0, 0, 0, 443,
+  0, 0, 0, 849, 0, 0, 848, 296, 873, 433, 834, 0, 547, 0, 0, 0,
+  0, 0, 0, 0, 0, 428, 909, 449, 893, 76, 207, 445, 512, 0, 314, 420,
+};
+
+const char *WA_FREQ_71_TOKENS[] = {
+  "i",
+  "mi",
+  "lo",
+  "se",
+  "da",
+  "e",
+  "la",
+  "a",
+  "le",
+  "no",
+  "o",
+  "ka",
+  "kei",
+  "ra",
+  "na",
+  "fi",
+  "do",
+  "platu",
+  "cu",
+  "cfila",
+  "nitcu",
+  "stogau",
+  "ni",
+  "velve",
+  "u",
+  "cmalu",
+  "nelci",
+  "selpre",
+  "ku",
+  "cinmle",
+  "cnino",
+  "va",
+  "zdani",
+  "tom",
+  "maris",
+  "pu",
+  "tavla",
+  "ucu",
+  "ro",
+  "ba",
+  "xamgu",
+  "jimpe",
+  "cipnrlaru",
+  "blabi",
+  "cipnrkorvu",
+  "xekri",
+  "so",
+  "imei",
+  "vofli",
+  "kanpe",
+  "nu",
+  "snada",
+  "ma",
+};
+const uint16_t WA_FREQ_71_RANKS[] = {
+  53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 40, 0, 0, 16, 23, 27, 0, 0, 48, 0, 0,
+  20, 11, 0, 0, 15, 0, 0, 43, 52, 0, 12, 47, 0, 0, 0, 0,
+  25, 3, 22, 8, 0, 0, 0, 2, 45, 0, 46, 28, 38, 0, 0, 24,
+  18, 0, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 32, 50,
+  0, 17, 49, 0, 30, 36, 37, 29, 35, 0, 0, 0, 0, 0, 4, 0,
+  0, 0, 51, 0, 0, 0, 0, 33, 31, 39, 0, 0, 0, 21, 1, 34,
+  19, 9, 0, 6, 0, 0, 0, 0, 0, 42, 7, 0, 5, 13, 10, 14,
+};
+
+const char *WA_FREQ_72_TOKENS[] = {
+  "ing",
+  "lan",
+  "kang",
+  "sing",
+  "iki",
+  "saka",
+  "iku",
+  "ana",
+  "dadi",
+  "kanggo",
+  "uga",
+  "utawa",
+  "kanthi",
+  "taun",
+  "bisa",
+  "ora",
+  "karo",
+  "yaiku",
+  "minangka",
+  "ingkang",
+  "Ing",
+  "sawijining",
+  "nalika",
+  "luwih",
+  "wong",
+  "basa",
+  "wis",
+  "kuwi",
+  "wonten",
+  "déning",
+  "paling",
+  "kutha",
+  "banjur",
+  "marang",
+  "salah",
+  "amarga",
+  "para",
+  "nganti",
+  "punika",
+  "dening",
+  "kasebut",
+  "siji",
+  "jroning",
+  "kaya",
+  "saking",
+  "mau",
+  "nanging",
+  "bakal",
+  "Jawa",
+  "negara",
+  "jeneng",
+  "menika",
+  "yèn",
+  "donya",
+  "nduwèni",
+  "mung",
+  "akèh",
+  "nganggo",
+  "Nalika",
+  "Indonesia",
+  "padha",
+  "tanggal",
+  "arupa",
+  "gedhé",
+  "wiwit",
+  "film",
+  "sisih",
+  "isih",
+  "wektu",
+  "ning",
+  "urip",
+  "papan",
+  "banget",
+  "supaya",
+  "saben",
+  "cilik",
+  "diarani",
+  "banyu",
+  "liya",
+  "liyané",
+  "2",
+  "jiwa",
+  "dheweke",
+  "dados",
+  "menyang",
+  "mangsa",
+  "manungsa",
+  "saiki",
+  "duwé",
+  "kaping",
+  "dhuwur",
+  "Nanging",
+  "Jerman",
+  "nduwé",
+  "sacara",
+  "ugi",
+  "jaman",
+  "tau",
+  "babagan",
+  "pedunung",
+  "cara",
+  "yakuwi",
+  "misuwur",
+  "Polandia",
+  "loro",
+  "wilayah",
+  "tembung",
+  "kalebu",
+  "inggih",
+  "utama",
+  "dumunung",
+  "sarta",
+  "Ana",
+  "dina",
+  "kudu",
+  "apik",
+  "kaliyan",
+  "1",
+  "Indonésia",
+  "kayata",
+  "akeh",
+  "anak",
+  "dhèwèké",
+  "awak",
+  "Inggris",
+  "miturut",
+  "dikenal",
+  "saged",
+  "nduweni",
+  "tlatah",
+  "ananging",
+  "Kutha",
+  "abad",
+  "kurang",
+  "bagéyan",
+  "yen",
+  "panggonan",
+  "sekolah",
+  "sistem",
+  "kabèh",
+  "anyar",
+  "main",
+  "3",
+  "digawé",
+  "sawisé",
+  "umum",
+  "jinis",
+  "Basa",
+  "Saliyané",
+  "kerep",
+  "suku",
+  "rong",
+  "pungkasan",
+  "provinsi",
+  "musik",
+  "anggota",
+  "pisanan",
+  "kanggé",
+  "bahan",
+  "mawa",
+  "manèh",
+  "asring",
+  "utawi",
+  "sawetara",
+  "disebut",
+  "dhaérah",
+  "dheweké",
+  "Ananging",
+  "saéngga",
+  "dhéwé",
+  "sampun",
+  "tegesé",
+  "dianggep",
+  "kali",
+  "lair",
+  "aksara",
+  "Jepang",
+  "tekan",
+  "perang",
+  "tanduran",
+  "kidul",
+  "Sawisé",
+  "wadon",
+  "antara",
+  "bab",
+  "liyane",
+  "panganan",
+  "menawa",
+  "isa",
+  "piyambakipun",
+  "dumadi",
+  "jenengé",
+  "ngenani",
+  "lemah",
+  "Islam",
+  "umur",
+  "kanti",
+  "tetep",
+  "gawé",
+  "lanang",
+  "Dheweke",
+  "tanpa",
+  "dawa",
+  "tumrap",
+  "wigati",
+  "namung",
+  "agama",
+  "mlebu",
+  "km",
+  "ngisor",
+  "gawe",
+  "tahun",
+  "asalé",
+  "biasané",
+  "Walanda",
+  "mula",
+  "watara",
+  "werna",
+  "5",
+  "Kali",
+  "Wonten",
+  "masyarakat",
+  "piranti",
+  "SD",
+  "bebarengan",
+  "Banjur",
+  "boten",
+  "sijiné",
+  "kéwan",
+  "antarané",
+  "nasional",
+  "10",
+  "kahanan",
+  "4",
+  "kasil",
+  "sadurungé",
+  "bagéan",
+  "tim",
+  "duwe",
+  "raja",
+  "gedhe",
+  "langsung",
+  "lor",
+  "cacahé",
+  "durung",
+  "wong-wong",
+  "lagi",
+  "seneng",
+  "tiyang",
+  "miwiti",
+  "kena",
+  "alam",
+  "pulo",
+  "Kecamatan",
+  "umumé",
+  "seni",
+  "gunung",
+  "digawe",
+  "godhong",
+  "bangsa",
+  "yuta",
+  "nggawé",
+  "duweni",
+  "karya",
+  "sajroning",
+  "Prancis",
+  "Gunung",
+  "sasi",
+  "awujud",
+  "tinimbang",
+  "dianggo",
+  "wujud",
+  "Jeneng",
+  "Saka",
+  "Amarga",
+  "tuwa",
+  "Ora",
+  "budaya",
+  "kulon",
+  "putih",
+  "I",
+  "acara",
+  "kulawarga",
+  "Jakarta",
+  "apa",
+  "Miturut",
+  "dipun",
+  "omah",
+  "asam",
+  "arep",
+  "Para",
+  "damel",
+  "wit",
+  "Yunani",
+  "Prabu",
+  "Arab",
+  "buku",
+  "ditemokaké",
+  "swara",
+  "kulit",
+  "20",
+  "digunakaké",
+  "dipigunakaké",
+  "manggon",
+  "bocah",
+  "rasa",
+  "Kelas",
+  "bumi",
+  "utamané",
+  "gampang",
+  "iwak",
+  "getih",
+  "maneh",
+  "6",
+  "sumber",
+  "waé",
+  "7",
+  "Kabupatèn",
+  "jero",
+  "liwat",
+  "manéka",
+  "mati",
+  "asal",
+  "of",
+  "Dhèwèké",
+  "pusat",
+  "segara",
+  "Amérika",
+  "kangge",
+  "lagu",
+  "saha",
+  "kabeh",
+  "telu",
+  "Negeri",
+  "kembang",
+  "papané",
+  "album",
+  "langkung",
+  "nduwéni",
+  "ya",
+  "digunakake",
+  "wanita",
+  "telung",
+  "dhateng",
+  "resmi",
+  "biasa",
+  "ngalami",
+  "km²",
+  "tengah",
+  "warga",
+  "wewengkon",
+  "metu",
+  "anané",
+  "alas",
+  "panas",
+  "dhasar",
+  "ageng",
+  "Pulo",
+  "abang",
+  "katon",
+  "migunakaké",
+  "mènèhi",
+  "bal-balan",
+  "kayu",
+  "putra",
+  "Wong",
+  "nyambut",
+  "tumuju",
+  "awit",
+  "jam",
+  "ngandhut",
+  "kathah",
+  "cepet",
+  "lajeng",
+  "sel",
+  "bangunan",
+  "dalan",
+  "internasional",
+  "sinetron",
+  "Dewi",
+  "Kanthi",
+  "alit",
+  "wulan",
+  "India",
+  "Piyambakipun",
+  "déné",
+  "Tengah",
+  "spesies",
+  "II",
+  "Universitas",
+  "Tembung",
+  "lintang",
+  "pemain",
+  "tetanduran",
+  "wétan",
+  "Yèn",
+  "wangun",
+  "meter",
+  "béda",
+  "ukuran",
+  "musim",
+  "sapérangan",
+  "2007",
+  "amargi",
+  "atom",
+  "cm",
+  "15",
+  "ibu",
+  "malih",
+  "Raja",
+  "8",
+  "Allah",
+  "30",
+  "klub",
+  "Jroning",
+  "nulis",
+  "gelar",
+  "satunggaling",
+  "The",
+  "Kidul",
+  "Film",
+  "Mula",
+  "2008",
+  "12",
+  "Amerika",
+  "Taun",
+  "dijupuk",
+  "peran",
+  "saya",
+  "asil",
+  "sajarah",
+  "kerja",
+  "grup",
+  "kimia",
+  "9",
+  "Perang",
+  "mangan",
+  "Saben",
+  "bareng",
+  "watu",
+  "2006",
+  "malah",
+  "mbentuk",
+  "2009",
+  "masarakat",
+  "Kanggo",
+  "di",
+  "tingkat",
+  "bintang",
+  "dienggo",
+  "de",
+  "kalih",
+  "manuk",
+  "tokoh",
+  "2004",
+  "amerga",
+  "bentuk",
+  "panjenengané",
+  "sijining",
+  "Jembar",
+  "sinau",
+  "Kulon",
+  "mesin",
+  "rada",
+  "barang",
+  "gadhah",
+  "tansah",
+  "antarane",
+  "Italia",
+  "dhewe",
+  "dudu",
+  "penyakit",
+  "rakyat",
+  "amba",
+  "Powiat",
+  "wayang",
+  "crita",
+  "laut",
+  "papat",
+  "kira-kira",
+  "ijo",
+  "perusahaan",
+  "Asia",
+  "melu",
+  "pendidikan",
+  "awaké",
+  "putri",
+  "cedhak",
+  "kecamatan",
+  "jenis",
+  "sèl",
+  "Negara",
+  "bali",
+  "hukum",
+  "sak",
+  "kondhang",
+  "adhedhasar",
+  "nomer",
+  "klebu",
+  "ahli",
+  "dan",
+  "ireng",
+  "fungsi",
+  "kados",
+  "Gusti",
+  "angka",
+  "dolanan",
+  "jaringan",
+  "wiwitan",
+  "woh",
+  "milih",
+  "program",
+  "mapan",
+  "Cina",
+  "enom",
+  "garis",
+  "kagungan",
+  "kagolong",
+  "njero",
+  "tuwuh",
+  "istilah",
+  "nglakoni",
+  "Mei",
+  "cukup",
+  "khas",
+  "warna",
+  "2010",
+  "Sekolah",
+  "daya",
+  "klompok",
+  "sosial",
+  "Iki",
+  "Sawise",
+  "entuk",
+  "mèlu",
+  "September",
+  "wekdal",
+  "Agustus",
+  "ngasilaké",
+  "sepisanan",
+  "kapisan",
+  "mulai",
+  "16",
+  "Wétan",
+  "diwiwiti",
+  "lara",
+  "populasi",
+  "17",
+  "Januari",
+  "Korea",
+  "naté",
+  "daging",
+  "Salah",
+  "jembar",
+  "pirang-pirang",
+  "Perancis",
+  "mbangun",
+  "prosès",
+  "18",
+  "kewan",
+  "nglawan",
+  "terus",
+  "biyasané",
+  "pamaréntahan",
+  "dumugi",
+  "khusus",
+  "sabanjuré",
+  "Oktober",
+  "suhu",
+  "2005",
+  "Wiwit",
+  "dibangun",
+  "désa",
+  "pesawat",
+  "Mesir",
+  "Taman",
+  "virus",
+  "11",
+  "SM",
+  "Saiki",
+  "ilmu",
+  "nama",
+  "asli",
+  "daerah",
+  "kalebet",
+  "masalah",
+  "dhaerah",
+  "Latin",
+  "komputer",
+  "upacara",
+  "Bali",
+  "dene",
+  "tanah",
+  "wisata",
+  "Provinsi",
+  "Saliyane",
+  "Sarékat",
+  "kono",
+  "judhulé",
+  "sikil",
+  "awal",
+  "bidang",
+  "gaya",
+  "Piala",
+  "srengéngé",
+  "Panjenengané",
+  "organisasi",
+  "sastra",
+  "sedaya",
+  "tembang",
+  "Juli",
+  "Maret",
+  "aktif",
+  "akting",
+  "tilar",
+  "Juni",
+  "Nasional",
+  "mata",
+  "pasangan",
+  "13",
+  "posisi",
+  "tangan",
+  "sithik",
+  "unsur",
+  "kaum",
+  "19",
+  "Kabupaten",
+  "politik",
+  "dilakoni",
+  "merga",
+  "ditulis",
+  "lingkungan",
+  "obat",
+  "Déné",
+  "beda",
+  "informasi",
+  "kelas",
+  "éntuk",
+  "14",
+  "Romawi",
+  "adoh",
+  "bageyan",
+  "kuning",
+  "pada",
+  "surat",
+  "wayah",
+  "2011",
+  "nggawe",
+  "Lor",
+  "garing",
+  "hak",
+  "kuwat",
+  "Desember",
+  "TV",
+  "m",
+  "pendhidhikan",
+  "suwé",
+  "gol",
+  "olèh",
+  "sang",
+  "25",
+  "alat",
+  "dipangan",
+  "Sing",
+  "ngarep",
+  "Donya",
+  "kapérang",
+  "njaga",
+  "gambar",
+  "menehi",
+  "nuduhaké",
+  "struktur",
+  "Amérika Sarékat",
+  "November",
+  "balung",
+  "nampa",
+  "Muhammad",
+  "kaloro",
+  "sami",
+  "wae",
+  "Kayadéné",
+  "band",
+  "Spanyol",
+  "karir",
+  "mabur",
+  "stasiun",
+  "ateges",
+  "mangkono",
+  "Dheweké",
+  "Dèwi",
+  "pelajaran",
+  "Minangka",
+  "Republik",
+  "kasusun",
+  "kayadéné",
+  "kana",
+  "teka",
+  "Sawijining",
+  "bilih",
+  "April",
+  "isi",
+  "jenenge",
+  "nggawa",
+  "Afrika",
+  "candhi",
+  "ibukutha",
+  "antawisipun",
+  "desa",
+  "lokal",
+  "Al",
+  "sawise",
+  "nem",
+  "penyanyi",
+  "2001",
+  "sanget",
+  "taksih",
+  "VI",
+  "kitab",
+  "taman",
+  "Dadi",
+  "alus",
+  "lumantar",
+  "kelompok",
+  "ditempuh",
+  "hubungan",
+  "Sang",
+  "gula",
+  "mèh",
+  "paraga",
+  "nikah",
+  "protein",
+  "21",
+  "Februari",
+  "masa",
+  "proses",
+  "saengga",
+  "sekitar",
+  "Ning",
+  "Kristen",
+  "ndadekake",
+  "anggone",
+  "cahya",
+  "kiwa",
+  "negeri",
+  "ditepungi",
+  "gumantung",
+  "nggunakake",
+  "pikantuk",
+  "Sultan",
+  "campuran",
+  "lunga",
+  "mboten",
+  "njaba",
+  "seka",
+  "arah",
+  "gunggung",
+  "kapal",
+  "sepur",
+  "Segara",
+  "data",
+  "guru",
+  "pulitik",
+  "sajroné",
+  "titik",
+  "2003",
+  "dijenengi",
+  "diwènèhi",
+  "penting",
+  "Eropah",
+  "Yahudi",
+  "akéh",
+  "kuna",
+  "mesthi",
+  "ndhuweni",
+  "ngantos",
+  "umat",
+  "Senadyan",
+  "inggil",
+  "perkara",
+  "Senajan",
+  "nduwe",
+  "supados",
+  "Yen",
+  "dhuwuré",
+  "gelem",
+  "pucuk",
+  "Israel",
+  "jalur",
+  "asale",
+  "bagian",
+  "maca",
+  "sejarah",
+  "ula",
+  "Lan",
+  "lima",
+  "mawi",
+  "sedulur",
+  "senyawa",
+  "tugas",
+  "Suku",
+  "njupuk",
+  "nyebabaké",
+  "èlmu",
+  "AS",
+  "Liga",
+  "gas",
+  "jabatan",
+  "listrik",
+  "menang",
+  "ngerti",
+  "pabrik",
+  "sijine",
+  "dhiri",
+  "dinten",
+  "ekonomi",
+  "kawasan",
+  "ketemu",
+  "dunya",
+  "pindhah",
+  "zaman",
+  "24",
+  "Eropa",
+  "lenga",
+  "panjenenganipun",
+  "wengi",
+  "Agung",
+  "Nabi",
+  "Semarang",
+  "biyèn",
+  "maknané",
+  "pamaréntah",
+  "patang",
+  "A",
+  "Raden",
+  "ati",
+  "pasukan",
+  "Sistem",
+  "massa",
+  "wiji",
+  "zat",
+  "kabupaten",
+  "tentara",
+  "2000",
+  "Yogyakarta",
+  "dhumateng",
+  "industri",
+  "enem",
+  "masjid",
+  "mèmper",
+  "Sadurungé",
+  "kabudayan",
+  "kerajaan",
+  "ngrembaka",
+  "shalat",
+  "adat",
+  "cacahe",
+  "setunggal",
+  "situs",
+  "tengen",
+  "werna-werna",
+  "Panjenenganipun",
+  "Rusia",
+  "ayat",
+  "diwasa",
+  "mburi",
+  "munggah",
+  "teges",
+  "menawi",
+  "neng",
+  "becik",
+  "pertama",
+  "Serikat",
+  "alami",
+  "jantung",
+  "nyanyi",
+  "olahraga",
+  "tunggal",
+  "dideleng",
+  "senajan",
+  "status",
+  "usaha",
+  "biasane",
+  "dawané",
+  "mobil",
+  "rampung",
+  "dipilih",
+  "isiné",
+  "nate",
+  "Paris",
+  "limang",
+  "pinggir",
+  "23",
+  "John",
+  "Ratu",
+  "bidhang",
+  "negara-negara",
+  "nyinaoni",
+  "owah",
+  "pinter",
+  "Bathara",
+  "Jawa Tengah",
+  "Kaisar",
+  "badan",
+  "bentuké",
+  "dianakaké",
+  "lulus",
+  "ngliwati",
+  "prastawa",
+  "Partai",
+  "Raya",
+  "bin",
+  "didol",
+  "diwenehi",
+  "modern",
+  "nggunakaké",
+  "pihak",
+  "suci",
+  "ukurané",
+  "kalah",
+  "Kang",
+  "Masjid",
+  "molekul",
+  "50",
+  "aran",
+  "nyegah",
+  "pasar",
+  "pengaruh",
+  "udan",
+  "versi",
+  "Pangeran",
+  "dhéwéké",
+  "endhog",
+  "hiburan",
+  "inti",
+  "tekanan",
+  "wates",
+  "kopi",
+  "mlebet",
+  "pesisir",
+  "sadurunge",
+  "sipat",
+  "tambahan",
+  "uripé",
+  "Kabèh",
+  "Tionghoa",
+  "adhem",
+  "calon",
+  "dipimpin",
+  "lapisan",
+  "nganggep",
+  "nggadhahi",
+  "senadyan",
+  "Presiden",
+  "bebas",
+  "bunder",
+  "gerakan",
+  "golongan",
+  "montor",
+  "njabat",
+  "tegese",
+  "Australia",
+  "Sacara",
+  "kasus",
+  "ngendi",
+  "28",
+  "Bab",
+  "Istilah",
+  "Kalimantan",
+  "New",
+  "gabung",
+  "22",
+  "26",
+  "abot",
+  "dipérang",
+  "kompetisi",
+  "njalari",
+  "100",
+  "Aksara",
+  "bayi",
+  "ibuné",
+  "kauripan",
+  "piyambak",
+  "séda",
+  "Kembang",
+  "Sawetara",
+  "Sunan",
+  "Wektu",
+  "biru",
+  "jembaré",
+  "total",
+  "umume",
+  "wewatesan",
+  "Tanduran",
+  "dewa",
+  "ngurangi",
+  "sapa",
+  "umuré",
+  "Awit",
+  "aktor",
+  "anduweni",
+};
+const uint16_t WA_FREQ_72_RANKS[] = {
+  0, 0, 735, 0, 0, 181, 0, 0, 826, 0, 0, 0, 712, 564, 0, 0,
+  370, 0, 0, 0, 191, 0, 0, 0, 0, 239, 0, 65, 0, 0, 217, 977,
+  0, 715, 585, 490, 77, 402, 970, 0, 0, 16, 868, 877, 358, 698, 267, 0,
+  0, 0, 583, 0, 0, 0, 0, 131, 0, 462, 0, 938, 283, 0, 354, 284,
+  460, 0, 0, 0, 0, 381, 0, 73, 85, 515, 0, 0, 0, 0, 395, 0,
+  304, 697, 0, 0, 0, 0, 0, 741, 0, 0, 934, 39, 0, 317, 0, 0,
+  167, 0, 786, 0, 0, 505, 0, 0, 89, 827, 932, 933, 0, 0, 0, 630,
+  738, 0, 195, 420, 731, 0, 817, 169, 0, 203, 622, 828, 0, 0, 846, 0,
+  806, 341, 0, 534, 0, 0, 0, 840, 0, 54, 816, 0, 0, 976, 777, 325,
+  0, 0, 0, 0, 333, 791, 517, 141, 776, 360, 792, 835, 0, 0, 805, 0,
+  329, 464, 993, 278, 485, 26, 0, 260, 189, 929, 452, 433, 0, 0, 0, 208,
+  969, 0, 0, 0, 0, 0, 0, 104, 0, 765, 29, 387, 660, 658, 920, 527,
+  719, 0, 0, 0, 183, 757, 0, 0, 773, 0, 0, 0, 0, 0, 0, 0,
+  401, 0, 0, 0, 27, 308, 670, 152, 722, 404, 916, 987, 0, 871, 665, 531,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 280, 0, 0, 52, 0, 900,
+  306, 0, 0, 0, 0, 345, 0, 911, 0, 573, 945, 0, 0, 0, 215, 257,
+  663, 0, 229, 0, 0, 0, 80, 0, 0, 768, 986, 0, 0, 593, 134, 640,
+  870, 0, 522, 0, 154, 0, 66, 0, 263, 318, 913, 0, 563, 671, 0, 0,
+  0, 0, 754, 812, 0, 0, 860, 0, 0, 0, 0, 0, 0, 0, 161, 398,
+  574, 623, 872, 0, 0, 0, 356, 0, 0, 96, 0, 0, 0, 100, 685, 0,
+  643, 457, 818, 0, 21, 548, 0, 0, 0, 516, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 875, 482, 0, 0, 15, 0, 0, 0,
+  0, 186, 606, 0, 688, 0, 0, 93, 941, 166, 521, 0, 0, 0, 0, 0,
+  0, 853, 0, 0, 0, 0, 0, 148, 322, 498, 795, 837, 0, 0, 582, 409,
+  769, 0, 415, 255, 0, 0, 0, 0, 540, 0, 0, 216, 256, 664, 721, 992,
+  0, 0, 0, 0, 37, 290, 923, 0, 0, 188, 799, 0, 0, 0, 0, 391,
+  228, 199, 365, 0, 815, 0, 0, 0, 0, 0, 0, 0, 0, 0, 461, 0,
+  0, 0, 0, 578, 232, 423, 0, 486, 541, 520, 728, 473, 0, 0, 0, 0,
+  275, 171, 841, 884, 0, 528, 0, 0, 0, 0, 599, 0, 403, 566, 0, 0,
+  668, 0, 0, 0, 0, 0, 180, 0, 605, 0, 0, 0, 0, 0, 0, 0,
+  910, 0, 0, 802, 0, 174, 0, 0, 0, 0, 396, 944, 0, 94, 708, 58,
+  147, 468, 632, 746, 942, 990, 250, 0, 0, 0, 0, 581, 74, 425, 951, 0,
+  0, 0, 0, 0, 469, 0, 0, 0, 218, 140, 366, 888, 0, 313, 254, 810,
+  0, 0, 124, 0, 0, 0, 235, 0, 0, 0, 635, 0, 0, 0, 0, 0,
+  0, 281, 706, 0, 19, 0, 0, 0, 0, 277, 474, 0, 426, 0, 0, 0,
+  0, 634, 753, 0, 0, 0, 0, 0, 105, 952, 0, 907, 0, 51, 273, 355,
+  421, 480, 0, 0, 770, 0, 0, 0, 0, 211, 0, 0, 0, 0, 0, 0,
+  0, 865, 0, 0, 787, 165, 0, 0, 595, 925, 0, 864, 0, 0, 246, 383,
+  0, 0, 0, 233, 535, 0, 0, 0, 307, 575, 0, 0, 0, 0, 0, 682,
+  691, 47, 723, 854, 939, 347, 48, 598, 804, 385, 0, 0, 0, 618, 631, 0,
+  0, 0, 0, 0, 176, 909, 0, 743, 0, 633, 67, 796, 0, 0, 160, 0,
+  18, 0, 949, 0, 0, 68, 0, 0, 536, 0, 0, 470, 0, 0, 298, 50,
+  918, 850, 0, 0, 890, 0, 0, 0, 0, 0, 437, 0, 0, 0, 0, 0,
+  481, 72, 662, 0, 892, 0, 0, 0, 0, 0, 0, 0, 783, 137, 0, 40,
+  0, 0, 0, 0, 0, 526, 265, 747, 758, 0, 0, 0, 897, 610, 0, 466,
+  0, 0, 201, 192, 530, 857, 0, 0, 0, 112, 0, 0, 97, 0, 335, 0,
+  271, 893, 114, 156, 726, 895, 119, 0, 0, 0, 0, 0, 0, 577, 979, 0,
+  46, 0, 869, 28, 268, 646, 0, 859, 0, 0, 328, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 784, 0, 0, 454, 0, 822, 279, 84, 0, 0, 117, 453,
+  0, 0, 0, 727, 684, 0, 902, 615, 0, 0, 0, 252, 0, 0, 0, 248,
+  0, 447, 0, 0, 790, 0, 619, 0, 0, 0, 0, 0, 956, 0, 954, 824,
+  0, 0, 0, 0, 187, 891, 896, 991, 0, 661, 725, 413, 206, 703, 115, 629,
+  763, 0, 755, 0, 334, 0, 0, 0, 0, 0, 0, 0, 301, 392, 0, 981,
+  836, 440, 321, 968, 0, 0, 0, 0, 0, 0, 961, 234, 379, 71, 984, 60,
+  825, 997, 0, 0, 0, 839, 362, 679, 0, 0, 523, 41, 103, 0, 0, 0,
+  339, 399, 793, 676, 848, 903, 508, 0, 0, 0, 0, 332, 556, 616, 845, 151,
+  0, 955, 0, 0, 316, 445, 493, 855, 964, 0, 781, 0, 0, 538, 0, 711,
+  245, 764, 940, 950, 0, 751, 842, 223, 361, 197, 919, 0, 61, 0, 337, 568,
+  989, 0, 0, 0, 0, 0, 0, 491, 0, 0, 621, 0, 0, 163, 0, 673,
+  748, 0, 285, 0, 0, 0, 973, 720, 0, 0, 110, 92, 0, 0, 0, 294,
+  7, 0, 843, 0, 0, 625, 0, 0, 0, 0, 0, 0, 138, 336, 654, 716,
+  185, 0, 0, 808, 0, 230, 424, 231, 251, 699, 0, 807, 111, 0, 414, 912,
+  887, 749, 0, 0, 584, 0, 644, 704, 0, 0, 82, 862, 0, 143, 0, 0,
+  0, 342, 127, 224, 475, 917, 214, 831, 930, 386, 885, 978, 0, 0, 0, 0,
+  0, 975, 0, 778, 116, 0, 0, 0, 258, 0, 0, 44, 560, 0, 0, 0,
+  0, 0, 0, 479, 123, 0, 0, 507, 614, 0, 608, 844, 142, 0, 503, 994,
+  0, 0, 0, 179, 0, 0, 0, 0, 502, 432, 500, 0, 0, 173, 927, 0,
+  609, 0, 368, 709, 0, 558, 707, 42, 357, 0, 0, 128, 175, 0, 0, 509,
+  0, 0, 693, 14, 863, 310, 0, 222, 494, 0, 0, 772, 0, 407, 642, 0,
+  974, 678, 8, 3, 789, 0, 785, 830, 0, 0, 0, 0, 0, 0, 0, 962,
+  0, 0, 162, 400, 0, 0, 309, 205, 324, 549, 905, 908, 0, 0, 428, 607,
+  0, 546, 866, 0, 56, 225, 382, 438, 552, 879, 0, 24, 0, 0, 0, 102,
+  150, 442, 488, 998, 0, 0, 412, 0, 153, 0, 0, 43, 0, 0, 0, 0,
+  695, 242, 692, 569, 12, 132, 597, 0, 559, 351, 0, 451, 0, 0, 858, 0,
+  659, 650, 0, 0, 125, 0, 0, 17, 471, 0, 0, 756, 539, 0, 0, 417,
+  0, 0, 587, 0, 0, 0, 0, 554, 0, 314, 943, 0, 0, 686, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 170, 0, 946, 0, 0, 0, 0, 0, 0,
+  834, 13, 0, 0, 0, 0, 0, 0, 677, 0, 434, 0, 0, 113, 0, 0,
+  0, 236, 788, 196, 0, 0, 0, 0, 0, 0, 0, 0, 33, 0, 69, 627,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 182, 240, 375, 653, 0, 106, 878,
+  0, 0, 0, 87, 338, 813, 775, 0, 0, 172, 289, 430, 596, 624, 0, 0,
+  0, 0, 0, 393, 710, 0, 0, 0, 0, 0, 449, 501, 931, 0, 512, 0,
+  602, 0, 0, 0, 331, 0, 0, 0, 0, 0, 0, 291, 237, 378, 717, 435,
+  0, 312, 431, 0, 0, 483, 193, 458, 821, 922, 0, 303, 718, 856, 91, 906,
+  0, 601, 0, 326, 0, 0, 0, 0, 0, 0, 766, 0, 0, 146, 0, 0,
+  0, 0, 0, 315, 443, 0, 2, 0, 319, 829, 88, 0, 0, 129, 847, 81,
+  0, 924, 729, 966, 34, 779, 0, 0, 492, 0, 0, 427, 0, 0, 227, 418,
+  737, 798, 0, 0, 210, 363, 1000, 0, 0, 514, 797, 364, 0, 898, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 586, 0, 0, 300, 327, 118,
+  436, 98, 567, 212, 0, 0, 0, 0, 0, 745, 247, 545, 645, 832, 0, 0,
+  79, 204, 0, 655, 367, 416, 506, 467, 533, 694, 811, 880, 0, 801, 62, 0,
+  220, 851, 0, 411, 571, 740, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 168, 408, 244, 352, 565, 873, 0, 477, 794, 0, 0, 0, 302, 59, 700,
+  861, 0, 0, 11, 537, 0, 0, 0, 0, 519, 45, 0, 346, 572, 936, 0,
+  592, 0, 0, 219, 589, 638, 814, 311, 372, 588, 463, 759, 0, 0, 651, 22,
+  38, 305, 369, 580, 75, 450, 681, 10, 0, 0, 489, 0, 0, 465, 0, 0,
+  0, 0, 262, 0, 0, 550, 348, 543, 713, 487, 926, 0, 0, 78, 0, 0,
+  371, 177, 288, 261, 207, 448, 495, 551, 852, 553, 0, 0, 750, 0, 590, 0,
+  0, 937, 576, 0, 0, 0, 221, 652, 0, 666, 0, 0, 0, 0, 542, 690,
+  0, 0, 64, 76, 0, 484, 838, 0, 472, 86, 0, 901, 287, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 31, 198, 0, 701, 524, 774, 820,
+  894, 0, 889, 299, 511, 0, 0, 0, 0, 200, 780, 380, 760, 782, 0, 971,
+  0, 0, 0, 292, 377, 876, 296, 157, 529, 389, 249, 613, 960, 295, 983, 0,
+  0, 149, 921, 639, 155, 714, 0, 270, 126, 656, 594, 702, 0, 0, 0, 999,
+  0, 0, 504, 0, 0, 145, 0, 0, 83, 0, 963, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 579, 833, 456, 883, 0, 209, 0, 373, 809, 0, 0, 0,
+  0, 683, 555, 928, 0, 0, 120, 226, 397, 525, 532, 0, 0, 0, 238, 0,
+  0, 0, 996, 101, 0, 0, 557, 419, 0, 0, 0, 0, 5, 752, 259, 349,
+  459, 647, 190, 771, 957, 0, 184, 736, 744, 982, 0, 0, 0, 0, 0, 20,
+  499, 604, 0, 0, 0, 0, 0, 9, 0, 241, 422, 823, 122, 272, 90, 359,
+  496, 636, 57, 374, 0, 340, 0, 0, 406, 194, 0, 0, 35, 0, 0, 53,
+  330, 689, 874, 133, 819, 995, 0, 4, 144, 733, 948, 959, 0, 0, 0, 0,
+  0, 0, 293, 350, 510, 518, 0, 0, 547, 0, 648, 0, 108, 135, 767, 641,
+  0, 0, 0, 0, 282, 657, 139, 915, 953, 958, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 158, 611, 800, 0, 0, 70, 0, 0, 444, 0, 0, 904,
+  410, 626, 561, 0, 0, 967, 0, 0, 972, 0, 0, 0, 0, 0, 867, 0,
+  0, 0, 0, 0, 637, 0, 0, 0, 0, 0, 0, 405, 761, 803, 0, 25,
+  136, 669, 687, 0, 988, 0, 0, 0, 159, 376, 0, 947, 55, 882, 0, 0,
+  0, 732, 0, 0, 0, 0, 0, 269, 667, 612, 886, 297, 705, 672, 980, 32,
+  0, 0, 0, 0, 107, 320, 95, 343, 23, 478, 0, 266, 0, 0, 0, 617,
+  0, 0, 243, 353, 0, 0, 0, 0, 0, 455, 130, 253, 0, 570, 899, 202,
+  985, 674, 0, 0, 0, 441, 0, 6, 0, 0, 0, 620, 164, 429, 476, 0,
+  0, 0, 0, 0, 0, 390, 388, 0, 0, 0, 323, 0, 274, 0, 0, 0,
+  0, 109, 0, 0, 0, 0, 0, 0, 600, 384, 213, 562, 0, 63, 0, 680,
+  0, 276, 36, 446, 649, 178, 513, 734, 30, 675, 730, 439, 849, 0, 1, 0,
+  0, 0, 0, 0, 0, 628, 121, 344, 881, 724, 0, 544, 742, 0, 0, 696,
+  497, 965, 0, 0, 49, 99, 264, 0, 739, 286, 394, 914, 603, 935, 0, 0,
+  0, 591, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 762, 0, 0, 0,
+};
+
+const char *WA_FREQ_73_TOKENS[] = {
+  "ეა",
+  "ვ",
+  "ნვ",
+  "ჟვ",
+  "თ",
+  "ნა",
+  "ჟთ",
+  "ჱა",
+  "ღვ",
+  "რთ",
+  "დჲ",
+  "ლთ",
+  "ა",
+  "გ",
+  "მთ",
+  "ფვ",
+  "რჲგა",
+  "ჲრ",
+  "ჟ",
+  "კაკგჲ",
+  "რვ",
+  "ნჲ",
+  "მვ",
+  "ჟყმ",
+  "აჱ",
+  "აკჲ",
+  "ქრჲ",
+  "ეჲბპვ",
+  "გჲ",
+  "რპწბგა",
+  "ჟა",
+  "ნწმა",
+  "მჲზვ",
+  "მს",
+  "ნთ",
+  "ჟამჲ",
+  "გთ",
+  "ოჲ",
+  "წ",
+  "ბვქვ",
+  "დთ",
+  "რაკა",
+  "რჲა",
+  "თმა",
+  "რსკ",
+  "ჱნამ",
+  "მნჲდჲ",
+  "ჲე",
+  "ეჲ",
+  "ევკა",
+  "კარჲ",
+  "ჟჲ",
+  "ჟვდა",
+  "კაკ",
+  "რჲი",
+  "ბთ",
+  "ნვღჲ",
+  "ჱაღჲ",
+  "ს",
+  "მვნ",
+  "კაკჲ",
+  "რვბ",
+  "გჟთფკჲ",
+  "ჟრვ",
+  "ჟმვ",
+  "რჲ",
+  "ჱნავქ",
+  "თლთ",
+  "თჟკამ",
+  "ეჲბპჲ",
+  "ჲღვ",
+  "კყევ",
+  "აჟ",
+  "მჲდა",
+  "კჲდარჲ",
+  "ბლადჲეაპწ",
+  "თმამ",
+  "ნალთ",
+  "გპვმვ",
+  "კჲ",
+  "ნვდჲ",
+  "ჲ",
+  "გჟთფკთ",
+  "ოპჲჟრჲ",
+  "ჟსმ",
+  "რჲჱთ",
+  "რამ",
+  "ჲგა",
+  "ჟამ",
+  "არა",
+  "კჲვრჲ",
+  "მჲ",
+  "ოპთ",
+  "რწ",
+  "რაჱთ",
+  "ვეთნ",
+  "მჲზვქ",
+  "კჲი",
+  "ნთღჲ",
+  "ჱაღჲრჲ",
+  "კჲდა",
+  "თჟკაქ",
+  "მთჟლწ",
+  "ნაჟ",
+  "თმაქ",
+  "ჟლვე",
+  "ჳაიევ",
+  "ევ",
+  "ეალთ",
+  "და",
+  "არ",
+  "მჲლწ",
+  "ნთვ",
+  "ოპვეთ",
+  "პაბჲრა",
+  "ფჲგვკ",
+  "თმ",
+  "ვენა",
+  "ვრჲ",
+  "მალკჲ",
+  "ბვჱ",
+  "გთვ",
+  "ნვმა",
+  "კაჱა",
+  "კჲირჲ",
+  "რჲლკჲგა",
+  "გაჟ",
+  "გვფვ",
+  "ჱნაფთ",
+  "ევნ",
+  "ნწკჲი",
+  "გჟვ",
+  "რვჱთ",
+  "ვენჲ",
+  "რვბვ",
+  "რჲფნჲ",
+  "ჟრაგა",
+  "მთჟლთქ",
+  "ჟყზალწგამ",
+  "ოპაგთქ",
+  "კაზა",
+  "რარკჲ",
+  "ი",
+  "თმამვ",
+  "ნაოპაგთ",
+  "ოჲგვფვ",
+  "ბაღა",
+  "ბთევ",
+  "კჲლკჲ",
+  "კჲთრჲ",
+  "მვნვ",
+  "დჲეთნთ",
+  "რპვბა",
+  "ნათჟრთნა",
+  "მნჲდს",
+  "რჲდაგა",
+  "ზვნა",
+  "რომ",
+  "ჳჲპა",
+  "ბწჳ",
+  "კყმ",
+  "რგჲ",
+  "ოა",
+  "ნვქრჲ",
+  "ფრჲ",
+  "ნთკჲდა",
+  "ჟყჟ",
+  "კაზთ",
+  "ჲგევ",
+  "ბთლ",
+  "ნვკა",
+  "ოპაგთ",
+  "ოპვე",
+  "კაკრჲ",
+  "ოპვჱ",
+  "პაჱბთპა",
+  "ბყევ",
+  "გვ",
+  "ოყრ",
+  "ჟაკამ",
+  "ჟყპ",
+  "გთზ",
+  "კაევ",
+  "კაზვქ",
+  "ეჲკარჲ",
+  "ჲნ",
+  "ამა",
+  "კაჱაჳ",
+  "პვე",
+  "მა",
+  "ეჲპთ",
+  "ჟთრვ",
+  "ჲგჲ",
+  "ეგა",
+  "რა",
+  "ოაკ",
+  "ეწგჲლთრვ",
+  "ნვწ",
+  "ჱნავ",
+  "ამთ",
+  "ჟყღჲ",
+  "ეპსდ",
+  "ბჲზვ",
+  "თჟკა",
+  "გთნადთ",
+  "რაა",
+  "ჱჲქრჲ",
+  "კა",
+  "ოაპთ",
+  "გყგ",
+  "ჳჲპარა",
+  "მწჟრჲ",
+  "გთეწ",
+  "გჟვკთ",
+  "რშ",
+  "კჲწრჲ",
+  "ქრა",
+  "რპთ",
+  "ბთლჲ",
+  "ოჲჟლვ",
+  "ეგვ",
+  "რწჳ",
+  "ნთკჲი",
+  "ნვღა",
+  "ჱავენჲ",
+  "ჱაპაეთ",
+  "ჱეპაგვი",
+  "სრპვ",
+  "ამ",
+  "ოჲე",
+  "რსკა",
+  "ნვკჲ",
+  "ნაოპაგწ",
+  "ჟთდსპნჲ",
+  "ზთგჲრა",
+  "ენვჟ",
+  "ბთჳ",
+  "რპწბგაქვ",
+  "ჟლსფთ",
+  "მჲპა",
+  "ოპჲბლვმ",
+  "მაიკა",
+  "მჲზვმ",
+  "ნაპვე",
+  "მთჟლამ",
+  "ეჲჟრა",
+  "პაბჲრთ",
+  "ჱარჲგა",
+  "ვევნ",
+  "ზთგჲრ",
+  "მე",
+  "ჟაკაქ",
+  "ნსზეა",
+  "მთჟლვჳ",
+  "გვფვპ",
+  "მჲწ",
+  "ჲჳ",
+  "ეჲბპა",
+  "ჟრანა",
+  "გთეთმ",
+  "სბთ",
+  "ჟვბვ",
+  "ჲბთფამ",
+  "ოპთწრვლ",
+  "ნწკჲლკჲ",
+  "ეაი",
+  "ნაფთნ",
+  "ეჲბყპ",
+  "ცრჲ",
+  "ჱნავრვ",
+  "ვლა",
+  "მჲზამ",
+  "პაჱბთპამ",
+  "დჲგჲპთ",
+  "კჲთ",
+  "თჱგთნვრვ",
+  "ბპარ",
+  "მამჲ",
+  "ეს",
+  "მალკს",
+  "მჲი",
+  "მჲზვბთ",
+  "ოაპთრვ",
+  "ჳვი",
+  "ჲჟრაგთ",
+  "რჲდაქ",
+  "ჲნა",
+  "ჟთდსპვნ",
+  "ეჲიევ",
+  "სქრვ",
+  "თმვ",
+  "ჲეთმვ",
+  "თმაქვ",
+  "ევრვ",
+  "რამს",
+  "ჲრნჲგჲ",
+  "კაჱგამ",
+  "თმარვ",
+  "ჟსოვპ",
+  "ეჲჟრარყფნჲ",
+  "კაკგჲრჲ",
+  "თჱდლვზეა",
+  "ოჲგვ",
+  "მჲთრვ",
+  "ოპაგწ",
+  "ნაგთჟრთნა",
+  "კაკგა",
+  "ნთქრჲ",
+  "დჲგჲპთქ",
+  "ფაკაი",
+  "ლს",
+  "დლაგარა",
+  "პაბჲრარა",
+  "მჲლამ",
+  "ნაოპაგთქ",
+  "ჟრპანა",
+  "ეპსდჲ",
+  "ჟრანვ",
+  "ნწმამ",
+  "ჱეპაჟრთ",
+  "მჲმფვრა",
+  "ჟკჲპჲ",
+  "გთეთ",
+  "დჲეთნა",
+  "შენ",
+  "ეჲმა",
+  "ჱეპაგჲ",
+  "დჲჟოჲეთ",
+  "თჟკაჳ",
+  "ნჲღ",
+  "ენთ",
+  "მთნსრთ",
+  "ბთლა",
+  "რთვ",
+  "ჟთნ",
+  "ჟკყოა",
+  "ბვ",
+  "ეამ",
+  "ნვღარა",
+  "მჲმვნრ",
+  "ეანთ",
+  "გვენადა",
+  "უნდა",
+  "აქ",
+  "ოჲმჲდნა",
+  "ევუა",
+  "გყპნა",
+  "გპვმვრჲ",
+  "ნვრ",
+  "თმვრჲ",
+  "ვი",
+  "დჲგჲპწ",
+  "ოარ",
+  "ფაჟა",
+  "კაჱგა",
+  "მყზ",
+  "ევგჲ",
+  "ჲჟგვნ",
+  "ფაჟრ",
+  "ჟრთდა",
+  "ჟს",
+  "მჲზვრვ",
+  "ეაგაი",
+  "კჲვ",
+  "ჳსბაგჲ",
+  "კჲდჲ",
+  "კს",
+  "გთზეამ",
+  "მჲმფვ",
+  "გჟყღნჲჟრ",
+  "ოპაგჲ",
+  "დ",
+  "ჳაპვჟგა",
+  "ოპვეგთე",
+  "ალთ",
+  "გყპგთ",
+  "ჟვკჲ",
+  "ნთკჲდაქ",
+  "ოპაგთმ",
+  "ფვკა",
+  "გთეწჳ",
+  "წჟნჲ",
+  "მჲწრა",
+  "ჳაპთ",
+  "ბწჳა",
+  "ჟგჲ",
+  "ჱარჲა",
+  "კჲლკს",
+  "რგჲთრვ",
+  "ეპსდთ",
+  "ოპჲრთგ",
+  "ეგამარა",
+  "კაკყგ",
+  "ფსევჟნჲ",
+  "რჲლკს",
+  "ნაოპაგთლ",
+  "მთჟლთ",
+  "მვზეს",
+  "ნაოპაგთმ",
+  "გყპგთმ",
+  "კჲლარა",
+  "ბყპჱჲ",
+  "ოჲდლვენთ",
+  "მნვ",
+  "მჲმთფვ",
+  "ტალა",
+  "ჟპვ",
+  "მჲვრჲ",
+  "ლჲქჲ",
+  "მამა",
+  "რაკყგ",
+  "მაი",
+  "კაზვ",
+  "გთეთქ",
+  "ჟაკა",
+  "ბყეა",
+  "ღჲმ",
+  "მყპრყგ",
+  "ბთლთ",
+  "გჱვმა",
+  "პაეგამ",
+  "თჟკარვ",
+  "დჲრჲგ",
+  "ჟვპთჲჱნჲ",
+  "თჱგთნთ",
+  "რგჲწ",
+  "კყევრჲ",
+  "მვნწ",
+  "ჲეთ",
+  "ჱაქრჲ",
+  "რპყდგამვ",
+  "გყრპვ",
+  "მაგრამ",
+  "ოჲნვ",
+  "მვჟრჲ",
+  "ნაჱაე",
+  "გპართ",
+  "კაკგთ",
+  "ჱეპაგვირვ",
+  "დჲჟოჲეთნვ",
+  "ვქ",
+  "დლვეამ",
+  "ჟგვრა",
+  "ევუარა",
+  "ჲრკყევ",
+  "ნაე",
+  "ნვმჲ",
+  "ეზაკ",
+  "ის",
+  "ჟვსქრვ",
+  "ნაქთრვ",
+  "რაკ",
+  "ნწკჲთ",
+  "გჱვმთ",
+  "ჱაე",
+  "ოვრ",
+  "თუ",
+  "დლვეა",
+  "ზთგ",
+  "ჟპვღს",
+  "რარჲ",
+  "ჱნავჳ",
+  "თჱ",
+  "ეაევ",
+  "ჲეამ",
+  "პვეს",
+  "ჲფთრვ",
+  "ეჲევკა",
+  "კვ",
+  "ჲგაა",
+  "ჩემი",
+  "ნწმაქვ",
+  "ჟოაპრაკ",
+  "ფაჟ",
+  "დპაეა",
+  "დჲგჲპთმ",
+  "ოპთწრვლთ",
+  "ჟრპაჳჲრნჲ",
+  "ჲკჲლჲ",
+  "მჲდს",
+  "რაკთგა",
+  "მჲპამ",
+  "გთზეაქ",
+  "ღვქვ",
+  "კ",
+  "ბვგ",
+  "მამკა",
+  "ოყრთ",
+  "გშ",
+  "ნთრჲ",
+  "თჱგთნწგაი",
+  "გკყღთ",
+  "გაზნჲ",
+  "პაჱბთპაქ",
+  "კაჱგაქ",
+  "ჱნაფვნთვ",
+  "დჲპვ",
+  "ოპვეოჲლადამ",
+  "ნაქარა",
+  "ჟლსფაი",
+  "კაზვრვ",
+  "კჲნ",
+  "დჲლწმა",
+  "ჟლსქაი",
+  "ოპაგ",
+  "დლვეაქ",
+  "გვენყზ",
+  "ეპსდთრვ",
+  "ჱნავმ",
+  "ფჲგვფვ",
+  "ეთ",
+  "ნამვპთ",
+  "მჲმვნრა",
+  "ჟოჲკჲინჲ",
+  "ოყპგჲ",
+  "კჲლკჲრჲ",
+  "მთჟლთრვ",
+  "ეჲბპთ",
+  "კი",
+  "ოჲმჲღ",
+  "კყღარა",
+  "ჟთდსპნა",
+  "ჲრთეა",
+  "ლვჟნჲ",
+  "ოპვჟრანთ",
+  "ბაქ",
+  "დჲჟოჲეა",
+  "ალჲ",
+  "სრპჲ",
+  "ოჲფრთ",
+  "ნვლთ",
+  "მშ",
+  "ჟამა",
+  "კჲლა",
+  "ფაჲ",
+  "ეჲბაპ",
+  "გაქვ",
+  "თჱბჲპ",
+  "თევწ",
+  "თჱდლვეა",
+  "რგჲვრჲ",
+  "თმარ",
+  "ჲბაეთ",
+  "ჟვემთუა",
+  "ჟოპთ",
+  "ოპვგჲე",
+  "დევ",
+  "გთზეალ",
+  "ჟვკჲდაქ",
+  "ოჲპაეთ",
+  "თჳ",
+  "შენი",
+  "ეჲა",
+  "ჟგვ",
+  "ფაპლთ",
+  "ბპაგჲ",
+  "ჟვკაკჲ",
+  "გჲეა",
+  "კაჱალ",
+  "მჲდარ",
+  "მწჟრჲრჲ",
+  "გჟწკა",
+  "მვჟვუა",
+  "ოჲნწკჲდა",
+  "თეგა",
+  "ოჲდჲგჲპთმ",
+  "ვარ",
+  "პვფვ",
+  "ჟპვღა",
+  "სბთვ",
+  "რგყპევ",
+  "რპსენჲ",
+  "თჟკაქვ",
+  "ვდჲ",
+  "ნთკჲ",
+  "დჲრჲგთ",
+  "ნჲგ",
+  "ზვნთ",
+  "ნსზნჲ",
+  "ხარ",
+  "ჲგთვ",
+  "კაზამ",
+  "დპაე",
+  "ჱვმწრა",
+  "ნთგ",
+  "ეჲქლთ",
+  "ნჲგა",
+  "პაჱბპაჳ",
+  "ოჲმნთქ",
+  "ჱგსფთ",
+  "ოჲმჲდნვ",
+  "მაიკ",
+  "ნწმაქ",
+  "ოყკ",
+  "ბთევქ",
+  "რაკჲ",
+  "ჱაპ",
+  "ოჲჱნაგამ",
+  "ოსკა",
+  "რთო",
+  "გვპჲწრნჲ",
+  "ჟლსფთლჲ",
+  "ჲრრსკ",
+  "ბლადჲეაპამ",
+  "ეჲლაპა",
+  "ჲჟრანა",
+  "ოპთფთნა",
+  "რაკაგა",
+  "რაკჲგა",
+  "ჟლსქა",
+  "ჲნჱთ",
+  "ბჲდ",
+  "ნწკჲდა",
+  "ტთლ",
+  "ფთფჲ",
+  "ეჲლს",
+  "ეპსდა",
+  "ესქჲ",
+  "ოპვკალვნჲ",
+  "ჟვჟრპა",
+  "ნაოპაგთჳ",
+  "თმაჳ",
+  "კჲწ",
+  "მთჟლვგ",
+  "ნძ",
+  "თჟკალ",
+  "დლსოჲჟრთ",
+  "ეგამა",
+  "ჲჱნაფაგა",
+  "ჟოჲპვე",
+  "ნვდჲგარა",
+  "ჟწკაქ",
+  "რთმ",
+  "ჟრპსგა",
+  "გყოპჲჟ",
+  "ჟგყპქთ",
+  "გპარარა",
+  "ალვკჟ",
+  "თდპა",
+  "ჲნთ",
+  "ბწჳმვ",
+  "ზთგვვ",
+  "გწპგამ",
+  "ფსჳ",
+  "ნაეწგამ",
+  "პაჱბპა",
+  "ნვა",
+  "მჲზვქვ",
+  "ოჲფაკაი",
+  "სმპვ",
+  "ოპჲბლვმთ",
+  "ეჲმ",
+  "ლთუვრჲ",
+  "ჟმვქნჲ",
+  "ჟვმვიჟრგჲრჲ",
+  "ჳპანა",
+  "ზალ",
+  "სბთწ",
+  "ჳვ",
+  "ლვკა",
+  "გყპჳს",
+  "გჟთფკთრვ",
+  "ოპაგთრვ",
+  "ვმჲ",
+  "ნწმამვ",
+  "გყჱმჲზნჲ",
+  "მჲწრ",
+  "ოჲეჲბპჲ",
+  "თეგამ",
+  "რვბწ",
+  "ჟმჲ",
+  "სზაჟნჲ",
+  "ნამვპწ",
+  "ჟოაჟთ",
+  "ჟრჲი",
+  "ჟრპანნჲ",
+  "ფვრთპთ",
+  "ოჲგრჲპნჲ",
+  "დჲლწმ",
+  "ჳა",
+  "ჟგწრ",
+  "ნჲმვპ",
+  "გამ",
+  "კლვპ",
+  "ჟკყოთ",
+  "ოლან",
+  "ქანჟ",
+  "ნთკჲდჲ",
+  "იყო",
+  "ლთლთ",
+  "რვლვტჲნა",
+  "ჟნჲღთ",
+  "ფვჟრ",
+  "ნწკჲდჲ",
+  "რგჲი",
+  "გყპნვ",
+  "კპაი",
+  "დჲჟოჲეთნ",
+  "ოპაგწრ",
+  "ღწჳ",
+  "ჲრთევ",
+  "ბყევქ",
+  "გწპნჲ",
+  "ჟვმვიჟრგჲ",
+  "პყუვრვ",
+  "მჲპაქ",
+  "ესმა",
+  "ფსგჟრგამ",
+  "ნვევი",
+  "ოყრწ",
+  "ჱნავქვ",
+  "ეჲიეა",
+  "უწლ",
+  "ოპთწრნჲ",
+  "ვნ",
+  "თჟრთნარა",
+  "გთზრვ",
+  "კაჲ",
+  "ჟვმვ",
+  "ეყღვპწ",
+  "ჟრაწ",
+  "ლსე",
+  "ოჲლთუთწრა",
+  "მყზვ",
+  "ნაოპვე",
+  "რ",
+  "უწლარა",
+  "ნწკყევ",
+  "ვმ",
+  "რგჲწრა",
+  "ჲრთევმ",
+  "ეამთ",
+  "ნაჟამ",
+  "ჟთნა",
+  "ჲფთ",
+  "ნს",
+  "ვგვ",
+  "თჟკამვ",
+  "ჱარგჲპა",
+  "ეჲკრჲპ",
+  "თჟკარ",
+  "ფაკ",
+  "ეზჲპეზ",
+  "ბყეთ",
+  "ჲბპარნჲ",
+  "რჩi",
+  "ვეგა",
+  "ჲნჲ",
+  "დპვქკა",
+  "ოაჱთ",
+  "ქვჟრ",
+  "მაკჟ",
+  "ეპყზ",
+  "მჲლთ",
+  "კპთკჟ",
+  "ჱაბაგნჲ",
+  "ნჲგთ",
+  "იჲპკ",
+  "ეყლდჲ",
+  "ჩვენ",
+  "არის",
+  "ჟლსქამ",
+  "ძალიან",
+  "გნთმანთვ",
+  "ჲრგჲპთ",
+  "გაქარა",
+  "ჲეთქ",
+  "წგნჲ",
+  "რჲმ",
+  "ლსკ",
+  "ლთფნჲ",
+  "თეთჲრ",
+  "გპყჱკა",
+  "კარგი",
+  "ჟსრპთნრა",
+  "ჟმყპრრა",
+  "დლაგა",
+  "ეჲკ",
+  "კყღა",
+  "ოპაგა",
+  "თჟრჲ",
+  "კყჟმვრ",
+  "ან",
+  "ჟრაწრა",
+  "მას",
+  "ჱაოჲფნა",
+  "ვერ",
+  "რპყდგამ",
+  "ვიცი",
+  "უვლთწ",
+  "ეჲქყლ",
+  "ჟყღჲრჲ",
+  "ფჲგვკა",
+  "კყჟნჲ",
+  "ეზჲნ",
+  "ევრვრჲ",
+  "მალჲ",
+  "არნჲ",
+  "კპალ",
+  "კაჱგარ",
+  "დპთზთ",
+  "ოპაგთლნჲ",
+  "ოჲგწპგამ",
+  "თჱლვჱვ",
+  "ნვკჲლკს",
+  "ჟრპაჳ",
+  "სბთლ",
+  "ეჲიევქ",
+  "ეგვრვ",
+  "ჲჟრანვ",
+  "ნჲჟთ",
+  "თჱდლვზეაქ",
+  "დჲჟოჲზჲ",
+  "ჲრთგამ",
+  "კსფვ",
+  "რპწბგალჲ",
+  "ბთეამ",
+  "კპა",
+  "გაქთრვ",
+  "კპყგ",
+  "ჲჟრანვქ",
+  "პვკჲგ",
+  "გთნჲ",
+  "პაბჲრწ",
+  "ჟვკჟ",
+  "მთნა",
+  "გვფვპწ",
+  "რაც",
+  "ბთგა",
+  "რპწბგარ",
+  "ოჲმჲდნვქ",
+  "გვლთფვჟრგჲ",
+  "კჲდჲრჲ",
+  "მვჟვუ",
+  "ლძბჲგ",
+  "ჲბაეწ",
+  "ჟთნკჲ",
+  "გჲინა",
+  "ოჲჱნაგაქ",
+  "რპვბალჲ",
+  "გპარა",
+  "უწლჲრჲ",
+  "ეპსდარა",
+  "ჟყპუვრჲ",
+  "ჳაპვჟგამ",
+  "ჲოთრგამ",
+  "ჳაპვჟა",
+  "სფთლთღვ",
+  "ჲოპვევლვნჲ",
+  "ნამვპთმ",
+  "კპაწ",
+  "ჳთლწეთ",
+  "i",
+  "ევჟვრ",
+  "გჱვ",
+  "ბჲპბა",
+  "ეაზვ",
+  "ნაქ",
+  "ღჲ",
+  "რპყდგაი",
+  "ჱბჲპსგა",
+  "რპყდნა",
+  "ჟთლა",
+  "ჱაოჲფგა",
+  "ჱლვ",
+  "ეზთმ",
+  "მჲმფვრჲ",
+  "მთლჲ",
+  "ოჲკაზთ",
+  "ჲჟრაგწ",
+  "ფს",
+  "მჲვ",
+  "ნამ",
+  "ოთქვ",
+  "ბყეარ",
+  "ოჲკაზა",
+  "ჳჲრვლ",
+  "თჟრჲპთწ",
+  "ჳჲრვლა",
+  "ჟსრპთნ",
+  "გჲეთ",
+  "ჟვენთ",
+  "თჱჲბღჲ",
+  "დლვეაი",
+  "კაზვმ",
+  "ნწკაკყგ",
+  "მვფ",
+  "პყკარა",
+  "არვლ",
+  "უვლ",
+  "ნწკაკგა",
+  "ჟაეა",
+  "ნ",
+  "მაპკ",
+  "დჲჟოჲევ",
+  "გფვპა",
+  "ვჟრჩ",
+  "ბლთჱჲ",
+  "ჱბჲპსგაქ",
+  "ევლ",
+  "მალყკ",
+  "ეალვფ",
+  "ოსჟნთ",
+  "გწპგაქ",
+  "ჲრთგაქ",
+  "როგორ",
+  "ნაოყლნჲ",
+  "გყპნვმ",
+  "ჟრჲ",
+  "მვჟრა",
+  "გჱვმვმ",
+  "თჟრთნა",
+  "კპაჟთგა",
+  "კვგთნ",
+  "სბთვქ",
+  "მალკა",
+  "ჲრკჲლკჲრჲ",
+  "ჟყგჟვმ",
+  "უა",
+  "ჟვპზანრ",
+  "ჱაოჲგვე",
+  "ამვპთკა",
+  "ოჲმჲდნთ",
+  "ნთჟამ",
+  "ოპვკპაჟნჲ",
+  "ოჲჟლვენთრვ",
+  "ოყპგთ",
+  "ეჲბთ",
+  "ოპვმნჲდს",
+  "მაზ",
+  "კნთდა",
+  "ჲბთფა",
+  "ჱნაწრ",
+  "ბპჱჲ",
+  "ჱვმ",
+  "თმალ",
+  "კთ",
+  "ჟლსფგა",
+  "ზვნთრვ",
+  "ზთგჲრჲრ",
+  "ჟვემთუთ",
+  "კვირ",
+  "ჟამთ",
+  "ელწ",
+  "მთლთჲნა",
+  "ნჲჟთქ",
+  "ნაეგჲპ",
+  "ჲნაჱთ",
+  "ადვნრ",
+  "ეჲკრჲპვ",
+  "ფაკა",
+  "ეწეჲ",
+  "რპვგჲზთ",
+  "ვჟლთ",
+  "ოჲმნწ",
+  "დჲჟოჲე",
+  "ბჲდა",
+  "კამ",
+  "ბყევმ",
+  "ნაქთჲრ",
+  "გპა",
+  "გნთმაგაი",
+  "ჱნაწ",
+  "კატვ",
+  "როგორც",
+  "დპთზა",
+  "ზვნარა",
+  "ნვმამ",
+  "ჟრანალჲ",
+  "ბთრთ",
+  "ესქთ",
+  "თეთ",
+  "ჱევჟჩ",
+  "რწლჲრჲ",
+  "ოყპგარა",
+  "რარვ",
+  "რატომ",
+  "მყპრგთ",
+  "ბთჱნვჟ",
+  "გაქა",
+  "მისი",
+  "ჟაკაგ",
+  "ჳლაოვ",
+  "მჲმუთ",
+  "ნაგჟწკყევ",
+  "ეჲიეჲჳ",
+  "პყკა",
+  "ბჲლთ",
+  "ეჲჟვდა",
+  "მთფვლ",
+  "ეჲგთზეანვ",
+  "ფვჟრჲ",
+  "ვკ",
+  "თნაფვ",
+  "ეჲოა",
+  "თდპარა",
+  "გჲრ",
+  "ჲრთგამვ",
+  "ოპჲმვნთ",
+  "ჟოაჟთბჲ",
+};
+const uint16_t WA_FREQ_73_RANKS[] = {
+  0, 720, 132, 0, 0, 0, 388, 880, 937, 740, 0, 0, 0, 0, 0, 136,
+  996, 0, 0, 0, 324, 366, 0, 673, 757, 0, 0, 799, 0, 0, 610, 0,
+  915, 0, 44, 500, 0, 213, 854, 582, 0, 0, 0, 493, 0, 0, 11, 0,
+  0, 133, 812, 983, 0, 25, 382, 805, 0, 0, 0, 0, 0, 184, 77, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 343, 783, 383, 0, 450, 0, 0,
+  0, 0, 0, 0, 939, 0, 0, 240, 618, 435, 0, 217, 696, 0, 0, 0,
+  639, 389, 930, 0, 0, 982, 0, 0, 0, 0, 163, 0, 434, 0, 0, 0,
+  0, 916, 0, 54, 728, 0, 256, 0, 232, 0, 0, 0, 0, 70, 282, 509,
+  0, 56, 185, 897, 0, 912, 867, 67, 962, 0, 238, 454, 0, 0, 0, 0,
+  131, 190, 0, 425, 0, 0, 0, 0, 459, 0, 0, 0, 0, 655, 266, 0,
+  71, 591, 535, 0, 0, 200, 233, 0, 592, 0, 0, 541, 0, 0, 748, 312,
+  966, 0, 0, 83, 0, 0, 0, 560, 138, 538, 0, 226, 0, 0, 0, 0,
+  0, 474, 82, 544, 604, 677, 0, 0, 0, 0, 0, 0, 0, 341, 859, 0,
+  0, 0, 0, 0, 0, 558, 0, 0, 291, 0, 369, 0, 621, 336, 94, 431,
+  191, 506, 574, 304, 5, 0, 195, 709, 0, 0, 0, 0, 0, 24, 652, 118,
+  0, 0, 0, 534, 0, 0, 822, 0, 0, 0, 0, 0, 53, 651, 0, 237,
+  104, 0, 0, 316, 440, 0, 0, 0, 0, 0, 0, 0, 731, 0, 571, 0,
+  0, 0, 0, 580, 0, 285, 264, 308, 1, 0, 0, 0, 0, 437, 532, 0,
+  0, 0, 0, 116, 0, 115, 470, 681, 315, 529, 742, 826, 871, 220, 855, 905,
+  0, 936, 0, 38, 760, 0, 0, 504, 802, 0, 700, 59, 209, 140, 350, 0,
+  665, 0, 960, 0, 0, 0, 0, 843, 0, 0, 0, 852, 0, 478, 543, 0,
+  235, 0, 514, 86, 635, 782, 684, 928, 0, 0, 866, 0, 0, 0, 419, 550,
+  249, 384, 988, 162, 458, 0, 0, 0, 28, 87, 0, 0, 215, 72, 486, 707,
+  130, 347, 365, 595, 0, 0, 0, 0, 0, 0, 182, 309, 0, 0, 900, 95,
+  0, 0, 0, 0, 0, 585, 0, 0, 967, 0, 0, 0, 0, 0, 781, 0,
+  0, 443, 0, 206, 608, 218, 717, 611, 511, 716, 344, 870, 953, 977, 984, 0,
+  0, 0, 0, 0, 0, 0, 196, 634, 0, 0, 0, 620, 0, 0, 0, 809,
+  0, 0, 0, 710, 564, 320, 525, 756, 0, 313, 778, 0, 482, 18, 332, 66,
+  416, 442, 453, 408, 615, 679, 686, 981, 644, 0, 715, 0, 0, 577, 179, 0,
+  0, 0, 0, 917, 0, 0, 183, 0, 0, 160, 0, 0, 0, 605, 0, 175,
+  157, 607, 614, 0, 446, 828, 85, 903, 0, 0, 0, 0, 0, 0, 0, 348,
+  271, 405, 0, 919, 0, 0, 779, 650, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 407, 0, 0, 0, 0, 391, 0, 0, 898, 0, 0, 88, 0, 0, 578,
+  145, 877, 0, 888, 400, 0, 260, 664, 767, 978, 0, 0, 570, 0, 139, 305,
+  0, 325, 106, 0, 0, 91, 0, 970, 0, 653, 565, 0, 0, 267, 755, 832,
+  874, 499, 958, 0, 0, 0, 0, 73, 0, 0, 0, 0, 0, 485, 0, 192,
+  0, 0, 0, 98, 0, 0, 824, 0, 471, 773, 0, 0, 0, 0, 0, 671,
+  0, 563, 0, 0, 0, 484, 554, 0, 0, 0, 899, 1000, 923, 22, 296, 946,
+  0, 255, 243, 911, 642, 0, 763, 659, 0, 974, 737, 821, 797, 34, 0, 281,
+  46, 0, 0, 0, 0, 0, 0, 0, 583, 0, 0, 0, 352, 370, 465, 0,
+  0, 385, 552, 173, 0, 0, 727, 393, 0, 0, 0, 0, 0, 0, 603, 687,
+  0, 0, 0, 0, 0, 15, 159, 980, 0, 52, 0, 0, 0, 165, 0, 0,
+  0, 0, 998, 0, 97, 331, 546, 884, 612, 776, 26, 265, 702, 770, 0, 0,
+  0, 467, 625, 0, 0, 0, 143, 0, 674, 0, 0, 876, 0, 0, 0, 198,
+  0, 433, 257, 539, 557, 624, 0, 0, 0, 0, 457, 0, 666, 660, 688, 807,
+  479, 0, 0, 0, 0, 0, 0, 0, 0, 800, 0, 36, 0, 0, 0, 0,
+  0, 0, 2, 0, 581, 0, 177, 0, 0, 0, 749, 263, 729, 907, 216, 933,
+  0, 0, 436, 0, 0, 0, 0, 0, 0, 0, 0, 356, 134, 146, 380, 691,
+  0, 0, 0, 17, 0, 488, 0, 329, 0, 0, 0, 451, 551, 830, 769, 0,
+  0, 0, 0, 0, 0, 12, 675, 0, 0, 0, 0, 0, 718, 883, 0, 0,
+  0, 333, 274, 593, 895, 932, 0, 0, 838, 0, 0, 0, 910, 0, 0, 42,
+  188, 649, 542, 796, 0, 0, 0, 0, 810, 0, 0, 259, 831, 0, 950, 0,
+  229, 0, 351, 252, 0, 277, 833, 45, 0, 0, 0, 0, 0, 386, 0, 0,
+  0, 0, 0, 0, 0, 990, 0, 0, 744, 397, 172, 632, 638, 141, 463, 475,
+  7, 0, 0, 0, 0, 411, 704, 0, 0, 848, 0, 598, 0, 0, 853, 153,
+  0, 426, 168, 276, 420, 549, 0, 0, 0, 0, 96, 0, 0, 829, 0, 0,
+  390, 622, 0, 0, 0, 926, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0,
+  0, 865, 0, 521, 0, 0, 0, 495, 201, 680, 703, 881, 0, 850, 0, 0,
+  0, 0, 823, 0, 0, 439, 0, 0, 0, 0, 236, 567, 444, 0, 392, 423,
+  775, 334, 0, 144, 0, 0, 0, 0, 445, 0, 0, 483, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 413, 654, 0, 0, 0, 672, 455, 0, 355, 0,
+  0, 814, 851, 244, 345, 498, 697, 739, 901, 0, 969, 0, 0, 0, 0, 0,
+  0, 127, 0, 590, 0, 0, 78, 685, 0, 43, 245, 387, 452, 128, 378, 81,
+  629, 597, 725, 84, 148, 69, 120, 178, 462, 421, 513, 708, 738, 750, 522, 834,
+  861, 0, 0, 0, 0, 0, 896, 0, 892, 0, 891, 965, 273, 986, 0, 0,
+  0, 0, 270, 301, 0, 0, 0, 119, 647, 527, 0, 189, 732, 952, 0, 0,
+  322, 0, 0, 0, 0, 0, 113, 0, 0, 524, 882, 422, 540, 913, 0, 862,
+  0, 616, 863, 262, 0, 0, 491, 0, 0, 0, 545, 841, 0, 497, 964, 0,
+  181, 16, 510, 818, 940, 0, 460, 403, 661, 225, 835, 646, 8, 893, 164, 328,
+  938, 0, 0, 51, 75, 584, 656, 515, 721, 0, 0, 353, 0, 41, 302, 806,
+  0, 0, 4, 724, 808, 374, 947, 927, 690, 734, 973, 0, 300, 0, 0, 0,
+  537, 772, 518, 0, 0, 0, 0, 0, 0, 193, 294, 957, 0, 712, 714, 202,
+  261, 49, 61, 878, 0, 0, 0, 0, 0, 0, 0, 376, 0, 0, 0, 3,
+  80, 114, 222, 298, 630, 410, 698, 358, 794, 816, 836, 0, 886, 759, 0, 0,
+  339, 600, 856, 894, 155, 827, 0, 0, 230, 507, 0, 254, 971, 991, 0, 0,
+  820, 519, 631, 272, 713, 335, 0, 0, 0, 29, 250, 473, 531, 837, 528, 840,
+  0, 441, 790, 645, 811, 576, 180, 555, 785, 566, 20, 64, 601, 944, 516, 0,
+  0, 0, 0, 207, 0, 0, 979, 0, 137, 0, 0, 0, 0, 602, 0, 0,
+  0, 338, 641, 0, 0, 0, 0, 0, 972, 92, 0, 0, 0, 568, 0, 889,
+  60, 0, 21, 0, 490, 0, 0, 0, 0, 461, 0, 0, 279, 0, 0, 234,
+  609, 588, 764, 0, 318, 706, 33, 0, 0, 0, 242, 0, 0, 0, 0, 0,
+  0, 924, 904, 0, 211, 945, 0, 0, 0, 231, 110, 466, 326, 311, 736, 741,
+  929, 589, 0, 0, 0, 0, 0, 112, 31, 648, 284, 670, 692, 176, 0, 0,
+  0, 0, 0, 0, 0, 0, 102, 330, 0, 0, 968, 0, 0, 0, 0, 0,
+  0, 55, 0, 766, 0, 0, 0, 0, 122, 0, 0, 0, 0, 212, 10, 0,
+  79, 0, 208, 239, 0, 0, 297, 228, 626, 0, 0, 701, 186, 758, 147, 948,
+  0, 0, 13, 154, 6, 319, 801, 0, 887, 0, 394, 303, 743, 0, 48, 432,
+  572, 995, 0, 0, 0, 0, 575, 0, 517, 792, 0, 0, 0, 0, 0, 449,
+  803, 39, 124, 251, 722, 780, 0, 0, 76, 885, 0, 0, 768, 0, 730, 0,
+  0, 0, 0, 258, 0, 0, 0, 0, 399, 156, 0, 959, 994, 0, 682, 357,
+  361, 0, 323, 864, 0, 0, 0, 839, 0, 0, 0, 0, 418, 0, 0, 934,
+  0, 0, 0, 0, 858, 0, 0, 398, 909, 0, 0, 412, 963, 0, 0, 961,
+  0, 711, 99, 606, 496, 908, 921, 0, 152, 429, 873, 890, 487, 359, 0, 210,
+  0, 753, 599, 105, 657, 286, 547, 501, 668, 745, 955, 0, 0, 0, 93, 406,
+  40, 619, 288, 492, 689, 817, 505, 90, 0, 0, 0, 0, 0, 0, 0, 0,
+  364, 0, 0, 699, 63, 0, 815, 0, 0, 197, 762, 0, 395, 733, 0, 872,
+  0, 0, 0, 0, 875, 58, 989, 0, 227, 23, 0, 0, 472, 0, 32, 735,
+  0, 613, 954, 0, 283, 363, 847, 121, 109, 199, 676, 902, 349, 246, 765, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 857, 169, 503, 0, 0, 0, 0,
+  683, 0, 0, 0, 633, 150, 295, 373, 0, 623, 842, 0, 0, 0, 0, 0,
+  0, 0, 0, 35, 0, 949, 976, 0, 0, 0, 0, 791, 0, 906, 0, 0,
+  0, 678, 0, 428, 0, 0, 0, 0, 512, 57, 469, 0, 0, 0, 170, 0,
+  0, 0, 0, 0, 89, 0, 317, 50, 562, 0, 354, 0, 0, 0, 107, 0,
+  0, 111, 0, 533, 241, 798, 0, 662, 149, 0, 0, 0, 0, 0, 14, 0,
+  194, 367, 508, 925, 0, 0, 0, 0, 627, 628, 430, 761, 100, 669, 0, 0,
+  0, 0, 0, 379, 804, 0, 559, 0, 360, 0, 0, 523, 573, 0, 941, 0,
+  951, 992, 30, 942, 0, 310, 135, 372, 219, 587, 0, 0, 0, 0, 402, 0,
+  0, 268, 596, 0, 253, 788, 0, 287, 448, 0, 0, 203, 999, 997, 280, 752,
+  985, 0, 0, 214, 377, 0, 553, 0, 0, 0, 0, 0, 0, 943, 0, 0,
+  0, 0, 19, 68, 161, 223, 299, 396, 637, 726, 746, 0, 415, 548, 579, 0,
+  786, 0, 0, 108, 248, 327, 27, 0, 0, 0, 489, 784, 0, 569, 0, 0,
+  594, 0, 0, 381, 0, 0, 0, 747, 0, 0, 0, 530, 337, 0, 414, 480,
+  224, 0, 0, 0, 774, 0, 0, 494, 0, 0, 0, 922, 0, 0, 0, 0,
+  868, 0, 0, 0, 468, 771, 526, 787, 0, 0, 0, 0, 0, 0, 0, 404,
+  920, 368, 0, 0, 0, 0, 0, 342, 0, 0, 0, 101, 0, 0, 643, 754,
+  0, 0, 918, 375, 0, 0, 0, 0, 221, 0, 0, 0, 0, 705, 362, 464,
+  795, 0, 417, 536, 0, 0, 931, 0, 0, 879, 0, 0, 0, 0, 849, 819,
+  561, 617, 293, 0, 0, 0, 0, 0, 0, 371, 0, 158, 447, 0, 0, 74,
+  825, 0, 0, 0, 306, 695, 477, 0, 117, 126, 166, 174, 427, 0, 556, 151,
+  0, 0, 0, 0, 62, 123, 694, 723, 278, 0, 0, 0, 0, 0, 103, 0,
+  269, 502, 0, 0, 0, 860, 0, 0, 0, 0, 401, 0, 0, 0, 0, 0,
+  975, 0, 0, 0, 0, 340, 0, 424, 520, 956, 993, 0, 0, 187, 0, 658,
+  0, 636, 719, 844, 869, 171, 663, 846, 0, 0, 0, 0, 0, 0, 438, 289,
+  125, 292, 751, 0, 813, 204, 481, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 987, 935, 0, 0, 0, 0, 247, 0, 0, 0, 314, 456,
+  0, 0, 0, 47, 667, 914, 0, 0, 693, 0, 640, 0, 290, 321, 0, 476,
+  789, 793, 845, 586, 142, 777, 346, 0, 0, 37, 0, 205, 0, 0, 0, 0,
+  0, 307, 409, 0, 0, 0, 0, 275, 0, 0, 0, 167, 0, 65, 129, 0,
+};
+
+const char *WA_FREQ_74_TOKENS[] = {
+  "kózlerin",
+  "tom",
+  "hám",
+  "mariya",
+  "jumıstı",
+  "basqalardan",
+  "kóre",
+  "jaqsıraq",
+  "orınlaymız",
+  "dep",
+  "oylaydı",
+  "абайла",
+  "tatoebaǵa",
+  "xosh",
+  "keldińiz",
+  "nan",
+  "jańa",
+  "emes",
+  "ashqısı",
+  "kelmeydi",
+  "sorawǵa",
+  "juwap",
+  "ber",
+  "ol",
+  "jumdı",
+  "men",
+  "vrach",
+  "emespen",
+};
+const uint16_t WA_FREQ_74_RANKS[] = {
+  3, 8, 13, 22, 0, 0, 0, 0, 15, 23, 0, 0, 17, 0, 14, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 21, 0, 0, 0, 0,
+  0, 0, 5, 0, 24, 4, 0, 0, 18, 10, 0, 0, 27, 0, 1, 2,
+  12, 0, 0, 20, 16, 6, 9, 28, 0, 0, 25, 26, 0, 0, 7, 11,
+};
+
@@ -0,0 +1,10608 @@
+#include "worldalphabets_data.h"
+
+const char *WA_FREQ_75_TOKENS[] = {
+  "n",
+  "d",
+  "deg",
+  "i",
+  "ad",
+  "di",
+  "s",
+  "ay",
+  "ara",
+  "ur",
+  "akk",
+  "ar",
+  "seg",
+  "ɣef",
+  "akken",
+  "yiwen",
+  "yiwet",
+  "At",
+  "kan",
+  "aṭas",
+  "u",
+  "ɣer",
+  "am",
+  "Deg",
+  "neɣ",
+  "wid",
+  "ass",
+  "D",
+  "yella",
+  "imi",
+  "llan",
+  "ma",
+  "kra",
+  "si",
+  "ayen",
+  "a",
+  "useggas",
+  "nniḍen",
+  "ger",
+  "azal",
+  "tutlayt",
+  "yernu",
+  "medden",
+  "anda",
+  "yal",
+  "yellan",
+  "yerna",
+  "sin",
+  "maca",
+  "wis",
+  "tama",
+  "γef",
+  "deg-s",
+  "win",
+  "Di",
+  "tella",
+  "taddart",
+  "tmurt",
+  "acu",
+  "la",
+  "tutlayin",
+  "daɣen",
+  "ula",
+  "γer",
+  "mi",
+  "waṭas",
+  "zik",
+  "af",
+  "id",
+  "Tizi",
+  "akw",
+  "fell-as",
+  "awal",
+  "wayen",
+  "ama",
+  "iseggasen",
+  "wass",
+  "Ma",
+  "isem",
+  "umi",
+  "g",
+  "armi",
+  "asmi",
+  "ass-a",
+  "ameqran",
+  "tesɛa",
+  "Wezzu",
+  "amezwaru",
+  "temdint",
+  "Tizi Wezzu",
+  "gar",
+  "ed",
+  "aya",
+  "lḥal",
+  "netta",
+  "ulac",
+  "Ass",
+  "Tmurt",
+  "Leqbayel",
+  "Lezzayer",
+  "amek",
+  "dɣa",
+  "Seg",
+  "Fransa",
+  "tura",
+  "acku",
+  "teqbaylit",
+  "yuɣal",
+  "lqern",
+  "nezmer",
+  "yiseggasen",
+  "akked",
+  "belli",
+  "umaḍal",
+  "I",
+  "mazal",
+  "nsen",
+  "tmaziɣt",
+  "1980",
+  "Maca",
+  "ilul",
+  "wakken",
+  "Llan",
+  "qqaren",
+  "ugar",
+  "Ldzayer",
+  "almi",
+  "uqbel",
+  "tamezwarut",
+  "yesɛa",
+  "yesɛan",
+  "dakk-n",
+  "snat",
+  "yemmut",
+  "ines",
+  "Tefriqt",
+  "daγen",
+  "mačči",
+  "Bgayet",
+  "cwiṭ",
+  "dakken",
+  "mgal",
+  "yisem",
+  "deg-sen",
+  "akka",
+  "ilaq",
+  "iman-is",
+  "imezdaɣ",
+  "sɛan",
+  "Mi",
+  "Umerri",
+  "Yugurten",
+  "nni",
+  "S",
+  "tesdawit",
+  "tin",
+  "de",
+  "Dɣa",
+  "akk-n",
+  "ameqqran",
+  "ccna",
+  "meqqren",
+  "niḍen",
+  "usegwas",
+  "Cameroun",
+  "3",
+  "imiren",
+  "neγ",
+  "tamaziɣt",
+  "tmiwa",
+  "Ad",
+  "abrid",
+  "imaziɣen",
+  "twacult",
+  "yimezdaɣen",
+  "akal",
+  "illa",
+  "tmura",
+  "Yuɣ",
+  "isem-is",
+  "wussan",
+  "Asmi",
+  "amenzu",
+  "tebda",
+  "tira",
+  "udabu",
+  "xas",
+  "20",
+  "Sliman",
+  "din",
+  "diɣ",
+  "tuɣal",
+  "wakal",
+  "yegduden",
+  "ihi",
+  "tamurt",
+  "wawal",
+  "Akken",
+  "agi",
+  "taqbaylit",
+  "wa",
+  "yemdanen",
+  "zemren",
+  "ɣas",
+  "bdan",
+  "ddunit",
+  "gar-asen",
+  "merra",
+  "tazwara",
+  "tikli",
+  "waya",
+  "2",
+  "Aṭas",
+  "Tmurt n Leqbayel",
+  "aseggas",
+  "iwakken",
+  "umata",
+  "useggwas",
+  "yili",
+  "Paris",
+  "tlata",
+  "tudert",
+  "ugafa",
+  "waman",
+  "Ben",
+  "ddaw",
+  "nettat",
+  "6",
+  "akk-d",
+  "lweqt",
+  "tallit",
+  "tis",
+  "yennayer",
+  "yura",
+  "5",
+  "7",
+  "U",
+  "ig",
+  "isegwasen",
+  "umezruy",
+  "yezmer",
+  "zdat",
+  "Ɛisa",
+  "Imaziɣen",
+  "Kra",
+  "Yella",
+  "amur",
+  "amzun",
+  "at",
+  "aḥric",
+  "illan",
+  "qqaren-as",
+  "yinelmaden",
+  "17",
+  "Ar",
+  "Imi",
+  "bisekstil",
+  "Ccix",
+  "Si",
+  "atg",
+  "tallit-nni",
+  "tikkelt",
+  "wiyaḍ",
+  "8",
+  "Ihi",
+  "Ur",
+  "ahat",
+  "amkan",
+  "inelmaden",
+  "ladɣa",
+  "naf",
+  "sɣur",
+  "tarbaɛt",
+  "uɣerbaz",
+  "wexxam",
+  "2008",
+  "Isṭunya",
+  "Yebrir",
+  "agdud",
+  "aken",
+  "ala",
+  "amaziɣ",
+  "baba-s",
+  "dinna",
+  "mebla",
+  "taɛrabt",
+  "tikelt",
+  "ttmeslayen",
+  "yekka-d",
+  "yexdem",
+  "15",
+  "Dzayer",
+  "Xas",
+  "imdanen",
+  "taggara",
+  "tamdint",
+  "ttidiren",
+  "uḍar",
+  "yedles",
+  "11",
+  "12",
+  "19",
+  "25",
+  "Ugafa",
+  "agemmay",
+  "assa",
+  "daxel",
+  "leqdic",
+  "llant",
+  "nneɣ",
+  "tmeṭṭut",
+  "wumi",
+  "yiman-is",
+  "1",
+  "2006",
+  "Ilul",
+  "Wid",
+  "dujamber",
+  "tagara",
+  "tmaziγt",
+  "waken",
+  "13",
+  "Dda",
+  "Dγa",
+  "Lzzayer",
+  "Sidi",
+  "Tafriqt",
+  "Tamurt",
+  "Yidir",
+  "agellid",
+  "aki",
+  "aman",
+  "ddula",
+  "fell-asen",
+  "tezlatin",
+  "umezgun",
+  "yekcem",
+  "yemma-s",
+  "yes",
+  "yimukan",
+  "ɣur-s",
+  "10",
+  "14",
+  "Meγres",
+  "Yennayer",
+  "immut",
+  "tisṭunit",
+  "tmurt-a",
+  "wayeḍ",
+  "yuran",
+  "yuγal",
+  "16",
+  "1989",
+  "30",
+  "argaz",
+  "asegwas",
+  "ay-a",
+  "dayen",
+  "deffir",
+  "deffir-es",
+  "imezwura",
+  "iwala",
+  "ixeddem",
+  "leqbayel",
+  "mliḥ",
+  "nutni",
+  "yettwasnen",
+  "yunyu",
+  "1992",
+  "Fṛansa",
+  "La",
+  "Ledzayer",
+  "Tella",
+  "Tmazɣa",
+  "Zik",
+  "ayyur",
+  "gan",
+  "gma-s",
+  "iberdan",
+  "iga",
+  "iruḥ",
+  "isefra",
+  "lmend",
+  "maci",
+  "naɣ",
+  "nnig",
+  "ugellid",
+  "wamek",
+  "warrac",
+  "wasmi",
+  "wedlis",
+  "wenẓul",
+  "yebda",
+  "yedlisen",
+  "yeqqim",
+  "Ṛṛum",
+  "1962",
+  "1990",
+  "Awal",
+  "Ayt",
+  "as",
+  "is",
+  "lḥebs",
+  "temnaṭ",
+  "tezmer",
+  "tineṣliyin",
+  "tsertit",
+  "tɣiwant",
+  "war",
+  "wass-a",
+  "webrid",
+  "yagi",
+  "A",
+  "Akka",
+  "Faḍma",
+  "Izwawen",
+  "Yal",
+  "Yibaskiyen",
+  "axxam",
+  "azwaw",
+  "diɣen",
+  "imeqranen",
+  "imezdaɣen",
+  "ixdem",
+  "mmi-s",
+  "tayri",
+  "tidett",
+  "tili",
+  "tsekla",
+  "Γef",
+  "Ṛebbi",
+  "2005",
+  "Franṣa",
+  "Meksa",
+  "Merruk",
+  "Muḥand",
+  "amaynut",
+  "amdan",
+  "aselway",
+  "aydeg",
+  "ddin",
+  "dγa",
+  "ismawen",
+  "macci",
+  "rradyu",
+  "rran",
+  "t",
+  "taddart-is",
+  "tamanaɣt",
+  "tasertit",
+  "taɣiwant",
+  "teglizit",
+  "tikwal",
+  "tẓuri",
+  "ukabar",
+  "yakan",
+  "ɣur-es",
+  "2001",
+  "23",
+  "4",
+  "Taddart",
+  "Yimaziɣen",
+  "Yiraten",
+  "acḥal",
+  "adabu",
+  "anamek-is",
+  "aneggaru",
+  "atrar",
+  "ayagi",
+  "d-yezgan",
+  "d-yezzin",
+  "ikemmel",
+  "imenɣi",
+  "lemden",
+  "nitni",
+  "tafat",
+  "tameṭṭut",
+  "tefsut",
+  "temmut",
+  "tid",
+  "tmurt-is",
+  "tẓegwa",
+  "uselmed",
+  "wawalen",
+  "xedmen",
+  "yedder",
+  "yelhan",
+  "yessefk",
+  "yisem-is",
+  "ɣ",
+  "2004",
+  "28",
+  "Nnig",
+  "Tdukli",
+  "Windows",
+  "Zedɣen-tt",
+  "aqbayli",
+  "bab",
+  "ccek",
+  "imawlan-is",
+  "imeslayen",
+  "lmut",
+  "mbeɛd",
+  "sdat",
+  "seddaw",
+  "taglizit",
+  "tameqrant",
+  "taqburt",
+  "taɣlamt",
+  "ttamnen",
+  "tutlayt-nsen",
+  "wala",
+  "wegdud",
+  "yakk",
+  "yessawalen",
+  "yid-sen",
+  "yir",
+  "yiri",
+  "000",
+  "100",
+  "18",
+  "24",
+  "9",
+  "Amaziɣ",
+  "Amur",
+  "Ass-a",
+  "Aεmer",
+  "Illa",
+  "Iqbayliyen",
+  "Leqran",
+  "Mengellat",
+  "Rebbi",
+  "Singapur",
+  "Spenyul",
+  "Ssi",
+  "Yemmut",
+  "aggi",
+  "ak",
+  "akud",
+  "amezruy",
+  "azzayri",
+  "da",
+  "ddren",
+  "furar",
+  "imelyan",
+  "iselmaden",
+  "leṣnaf",
+  "nezzeh",
+  "seg-sen",
+  "ssawalen",
+  "sseqdacen",
+  "tafṛensist",
+  "tamawt",
+  "tamecṭuḥt",
+  "tayeḍ",
+  "tidet",
+  "tuddar",
+  "twilayt",
+  "udem",
+  "uẓawan",
+  "wasif",
+  "wemdan",
+  "wemkan",
+  "yergazen",
+  "yettidiren",
+  "yid-s",
+  "yidurar",
+  "yimelyunen",
+  "yiḍ",
+  "26",
+  "Amezruy",
+  "Ayen",
+  "Azwaw",
+  "Aḥmed",
+  "Aṛezqi",
+  "Mammeri",
+  "Muḥamed",
+  "Muḥemed",
+  "Saldae",
+  "Tunes",
+  "Tutlayt",
+  "Yulyu",
+  "anamek",
+  "ay-n",
+  "d-yellan",
+  "deg-sent",
+  "f",
+  "idles",
+  "ifassen",
+  "iman-nsen",
+  "iwumi",
+  "izedɣen",
+  "kecmen",
+  "lɣaci",
+  "myal",
+  "qrib",
+  "semman",
+  "ssuq",
+  "tedwilt",
+  "temdinin",
+  "tudert-is",
+  "umennuɣ",
+  "urigami",
+  "wahil",
+  "wakk-n",
+  "wanag",
+  "wazal",
+  "yefka",
+  "yerzan",
+  "yesεan",
+  "yettmeslayen",
+  "zedɣen",
+  "1947",
+  "1994",
+  "El",
+  "II",
+  "Lalman",
+  "Lmulud",
+  "Mulud",
+  "Muḥ",
+  "Tamaziɣt",
+  "Ulac",
+  "Yicc",
+  "Yiwen",
+  "amecṭuḥ",
+  "amedya",
+  "arraw",
+  "atan",
+  "d-nini",
+  "ifazen",
+  "ikcem",
+  "imeqqranen",
+  "irgazen",
+  "le",
+  "les",
+  "neqqar",
+  "tefṛensist",
+  "tunṣibt",
+  "tuɣac",
+  "tɣawsiwin",
+  "uguren",
+  "werɛad",
+  "yebɣa",
+  "yeqqel",
+  "yidis",
+  "yis-s",
+  "ṭṭfen",
+  "1970",
+  "1995",
+  "1998",
+  "2007",
+  "29",
+  "Acku",
+  "Akk",
+  "Ccinwa",
+  "Irland",
+  "Le",
+  "Nuja",
+  "Sliman Ɛazem",
+  "Tmaziɣt",
+  "adlis",
+  "afus",
+  "alamma",
+  "diγen",
+  "du",
+  "idrimen",
+  "igduden",
+  "iqburen",
+  "izemren",
+  "lawan",
+  "lkaɣeḍ",
+  "lɛesker",
+  "mayu",
+  "mazal-it",
+  "meɣres",
+  "meṛṛa",
+  "tama-s",
+  "tamaneɣt",
+  "tameqqrant",
+  "tiyaḍ",
+  "tmucuha",
+  "ttgen",
+  "ul",
+  "urar",
+  "usaru",
+  "usseggwas",
+  "uɣalen",
+  "wakud",
+  "wezgen",
+  "yenna",
+  "yeqqar",
+  "yerra",
+  "yettwasen",
+  "yettwassnen",
+  "yezgan",
+  "yilli",
+  "yulyu",
+  "zedɣen-tt",
+  "Ɛazem",
+  "ɣur",
+  "Adlis",
+  "Agemmay",
+  "Anecta",
+  "Daɣen",
+  "Ger",
+  "Iṛumyen",
+  "Kanada",
+  "Lla",
+  "Lunis",
+  "Meɣres",
+  "Musa",
+  "Muḥend",
+  "Tura",
+  "Win",
+  "Yakuc",
+  "Yikurdiyen",
+  "Zidan",
+  "alemmas",
+  "amaziγ",
+  "anida",
+  "aselmed",
+  "aɛrab",
+  "aṭṭas",
+  "bɣan",
+  "dacu",
+  "ddurt",
+  "ideg",
+  "ilin",
+  "illul",
+  "imir",
+  "iseggwasen",
+  "iserdasen",
+  "kkan",
+  "kraḍ",
+  "lameɛna",
+  "lebda",
+  "rrif",
+  "sbiṭar",
+  "seg-s",
+  "tamaynut",
+  "tazwawt",
+  "tekcem",
+  "tesɣunt",
+  "teẓgi",
+  "tikkwal",
+  "tiṭ",
+  "tlawin",
+  "tlemmast",
+  "tmetti",
+  "tmurt-nsen",
+  "tudrin",
+  "ubrid",
+  "ufus",
+  "umedyaz",
+  "ussan",
+  "uxxam",
+  "wergaz",
+  "werǧin",
+  "yedda",
+  "yegmamen",
+  "yejjan",
+  "yenna-d",
+  "yerr",
+  "yesεa",
+  "yettidir",
+  "yeḥricen",
+  "yid-es",
+  "yimir-n",
+  "yismawen",
+  "yufa-d",
+  "Ǧamila",
+  "ɣuct",
+  "γas",
+  "1988",
+  "2000",
+  "22",
+  "27",
+  "31",
+  "Inelmaden",
+  "Israyil",
+  "Kirgizistan",
+  "Navarra",
+  "Roma",
+  "Yerna",
+  "adrar",
+  "aked",
+  "akin",
+  "alami",
+  "aselmad",
+  "beṛṛa",
+  "ccerq",
+  "degs",
+  "idlisen",
+  "igan",
+  "ilmend",
+  "isekkilen",
+  "isɛa",
+  "izwawen",
+  "iɣerbazen",
+  "iḍ",
+  "km",
+  "krad",
+  "lbaṭel",
+  "leḥkem",
+  "m",
+  "melmi",
+  "niɣ",
+  "répression",
+  "sakkin",
+  "taɣelnawt",
+  "tedbelt",
+  "teddun",
+  "tefka",
+  "tella-d",
+  "ten",
+  "teqqel",
+  "tezwara",
+  "teɣri",
+  "timura",
+  "tlul",
+  "tmeddit",
+  "tmusni",
+  "unabaḍ",
+  "usselmed",
+  "utaram",
+  "wacu",
+  "wat",
+  "weḥric",
+  "wigi",
+  "yarna",
+  "yeffeɣ",
+  "yes-s",
+  "yettekkan",
+  "yeǧǧan",
+  "yeḍran",
+  "yeḥbes",
+  "yides",
+  "yimassanen",
+  "yisefra",
+  "yura-d",
+  "yuɣalen",
+  "zzit",
+  "1940",
+  "1956",
+  "1979",
+  "1982",
+  "1999",
+  "2002",
+  "2011",
+  "21",
+  "Adrum",
+  "Aseggas",
+  "Bab",
+  "Belqasem",
+  "Belεid",
+  "Briṭanya",
+  "Fr'ansa",
+  "Galili",
+  "Ibaskiyen",
+  "Ilaq",
+  "Kenya",
+  "Lmerruk",
+  "Lunis At Mengellat",
+  "Maṣer",
+  "Muḥemmed",
+  "Nezmer",
+  "Tira",
+  "Turuft",
+  "Wenẓul",
+  "Yeqbayliyen",
+  "Yimedyazen",
+  "aberkan",
+  "adrum",
+  "aggur",
+  "ahric",
+  "alammi",
+  "amedyaz",
+  "anect-a",
+  "anemhal",
+  "aqdim",
+  "aseggwas",
+  "atas",
+  "azgen",
+  "ccix",
+  "d-mazal",
+  "dagi",
+  "ddewla",
+  "dima",
+  "gen",
+  "ibda",
+  "imalas",
+  "iminigen",
+  "imusnawen",
+  "ineggura",
+  "iqdimen",
+  "isegassen",
+  "isura",
+  "iḥbes",
+  "ladγa",
+  "lgirra",
+  "lεesker",
+  "msefhamen",
+  "qqaren-d",
+  "qqlen",
+  "semman-as",
+  "t-id",
+  "talitwanit",
+  "talmanit",
+  "talɣa",
+  "tamedyazt",
+  "te",
+  "tegrawla",
+  "telli",
+  "temsal",
+  "temsalt",
+  "terbaεt",
+  "tesɛi",
+  "tezmert",
+  "tgeldit",
+  "tikkal",
+  "tilizri",
+  "tuddsa",
+  "tutlayt-a",
+  "twaculin",
+  "ufella",
+  "unadi",
+  "unṣib",
+  "waddalen",
+  "waggur",
+  "wakk",
+  "way-a",
+  "wudem",
+  "wwḍen",
+  "xeddmen",
+  "yekka",
+  "yekker",
+  "yelli-s",
+  "yesɛi",
+  "yettwassen",
+  "yewweḍ",
+  "yewwi",
+  "yeṭṭef",
+  "yeẓra",
+  "yiselmaden",
+  "yiṭij",
+  "zzman",
+  "Ǧerǧer",
+  "Ḥmed",
+  "ṭṭrad",
+  "1957",
+  "1972",
+  "1987",
+  "1991",
+  "1996",
+  "200",
+  "40",
+  "Aderbal",
+  "Adrar",
+  "Amar",
+  "Aseqqamu",
+  "Asya",
+  "Augustin",
+  "Aâli",
+  "Aẓawan",
+  "Buciker",
+  "Caker",
+  "Ibn",
+  "Ikurdiyen",
+  "Imiren",
+  "Imuhaɣ",
+  "Isem",
+  "Isem-is",
+  "Llant",
+  "Lpari",
+  "Lɛiraq",
+  "Marius",
+  "Mayyu",
+  "Mekka",
+  "Meɛṭub",
+  "Mouloud",
+  "New",
+  "Sakin",
+  "Salem",
+  "Saɛid",
+  "Tala",
+  "Tameṭṭut",
+  "Tesɛa",
+  "Tifinaɣ",
+  "Ula",
+  "Web",
+  "Wehran",
+  "Yiwunak",
+  "Yunyu",
+  "Yusef",
+  "ameqṛan",
+  "amḍiq",
+  "anagar",
+  "anecta",
+  "aqcic",
+  "arraw-is",
+};
+const uint16_t WA_FREQ_75_RANKS[] = {
+  0, 189, 987, 0, 855, 970, 0, 0, 0, 0, 0, 809, 735, 900, 330, 0,
+  401, 9, 148, 0, 0, 0, 792, 0, 0, 0, 24, 102, 594, 0, 520, 831,
+  119, 0, 0, 941, 0, 0, 419, 984, 0, 15, 0, 0, 0, 0, 2, 0,
+  271, 647, 1000, 0, 0, 0, 240, 426, 0, 0, 0, 0, 0, 0, 229, 0,
+  0, 27, 834, 909, 0, 0, 0, 0, 0, 101, 518, 540, 568, 589, 980, 0,
+  999, 0, 0, 435, 207, 544, 0, 0, 0, 0, 0, 0, 0, 236, 374, 593,
+  690, 0, 702, 0, 0, 824, 642, 0, 412, 0, 0, 0, 0, 156, 802, 915,
+  470, 0, 0, 0, 743, 0, 0, 579, 126, 0, 0, 0, 753, 0, 0, 0,
+  904, 0, 0, 0, 0, 105, 919, 0, 870, 0, 174, 912, 0, 0, 527, 0,
+  0, 0, 0, 0, 49, 0, 0, 278, 674, 582, 692, 812, 0, 453, 0, 0,
+  0, 0, 0, 0, 151, 0, 0, 0, 0, 0, 509, 31, 0, 482, 0, 732,
+  154, 981, 214, 0, 0, 0, 0, 51, 530, 0, 0, 0, 297, 771, 0, 0,
+  93, 0, 0, 0, 0, 0, 153, 0, 0, 0, 170, 887, 485, 0, 0, 0,
+  945, 138, 147, 813, 50, 567, 248, 559, 350, 367, 671, 182, 434, 0, 0, 347,
+  0, 0, 0, 0, 0, 410, 366, 0, 0, 0, 0, 0, 0, 0, 383, 535,
+  0, 0, 841, 0, 0, 0, 0, 0, 765, 411, 843, 618, 866, 443, 0, 0,
+  761, 911, 89, 638, 0, 892, 0, 0, 0, 128, 0, 0, 0, 0, 57, 262,
+  285, 427, 0, 211, 889, 368, 0, 0, 0, 0, 0, 710, 0, 0, 0, 590,
+  863, 506, 719, 436, 833, 893, 907, 286, 392, 894, 0, 898, 0, 0, 686, 478,
+  0, 0, 0, 800, 946, 216, 852, 0, 0, 0, 0, 672, 201, 811, 929, 0,
+  446, 503, 0, 0, 254, 0, 265, 0, 905, 0, 356, 795, 0, 0, 469, 767,
+  0, 0, 0, 0, 393, 977, 0, 614, 538, 0, 807, 0, 127, 612, 487, 716,
+  745, 580, 920, 12, 0, 251, 402, 0, 0, 319, 0, 0, 0, 0, 748, 247,
+  175, 0, 0, 0, 0, 471, 560, 660, 0, 0, 0, 0, 0, 0, 369, 0,
+  0, 565, 0, 0, 0, 0, 257, 828, 424, 942, 0, 0, 0, 626, 796, 0,
+  0, 0, 0, 0, 857, 0, 0, 359, 0, 955, 0, 0, 0, 0, 968, 556,
+  0, 971, 0, 378, 107, 628, 0, 333, 0, 0, 0, 0, 183, 451, 208, 360,
+  916, 270, 982, 36, 300, 276, 342, 758, 0, 0, 693, 0, 20, 499, 0, 0,
+  0, 0, 0, 496, 0, 0, 0, 48, 0, 0, 0, 0, 651, 0, 0, 0,
+  684, 490, 890, 91, 0, 0, 202, 338, 448, 47, 936, 989, 995, 0, 0, 0,
+  397, 0, 0, 0, 191, 0, 0, 0, 0, 0, 0, 0, 0, 421, 0, 0,
+  0, 0, 0, 488, 0, 873, 0, 0, 0, 604, 224, 0, 0, 0, 0, 0,
+  0, 0, 0, 864, 136, 75, 571, 808, 868, 326, 575, 818, 277, 554, 162, 566,
+  707, 991, 0, 0, 964, 0, 0, 215, 557, 0, 25, 370, 923, 953, 0, 16,
+  468, 115, 0, 452, 0, 0, 66, 0, 965, 0, 715, 0, 260, 0, 0, 0,
+  0, 0, 0, 0, 786, 0, 308, 371, 810, 524, 0, 827, 0, 0, 0, 528,
+  0, 0, 0, 624, 0, 0, 966, 0, 184, 906, 158, 0, 0, 0, 564, 1,
+  837, 877, 0, 0, 0, 563, 72, 331, 641, 289, 750, 797, 0, 387, 0, 59,
+  465, 739, 0, 0, 0, 0, 0, 0, 11, 306, 0, 0, 0, 622, 925, 0,
+  507, 0, 133, 483, 682, 0, 0, 0, 0, 0, 0, 494, 84, 296, 390, 607,
+  790, 0, 473, 125, 555, 722, 729, 0, 0, 108, 649, 0, 0, 0, 120, 198,
+  695, 0, 0, 921, 0, 0, 241, 406, 250, 0, 0, 0, 0, 323, 0, 0,
+  0, 0, 0, 985, 0, 0, 0, 0, 694, 0, 0, 0, 611, 169, 263, 787,
+  0, 0, 0, 0, 459, 0, 0, 0, 0, 0, 0, 0, 238, 746, 561, 948,
+  0, 0, 0, 0, 134, 139, 382, 754, 232, 667, 253, 82, 190, 339, 670, 243,
+  681, 762, 773, 43, 394, 881, 83, 0, 519, 654, 0, 720, 659, 0, 0, 658,
+  760, 0, 0, 0, 0, 244, 815, 0, 0, 0, 0, 592, 0, 0, 0, 789,
+  969, 143, 572, 381, 673, 58, 146, 826, 856, 0, 100, 206, 0, 0, 0, 462,
+  662, 476, 474, 0, 817, 576, 418, 819, 930, 0, 0, 677, 0, 268, 727, 0,
+  0, 318, 256, 0, 0, 764, 0, 0, 0, 633, 635, 643, 0, 0, 0, 0,
+  141, 6, 730, 0, 0, 585, 0, 0, 0, 0, 0, 0, 396, 0, 0, 497,
+  0, 974, 0, 529, 0, 0, 0, 445, 755, 303, 0, 354, 30, 0, 543, 0,
+  0, 581, 632, 763, 0, 0, 348, 0, 0, 0, 407, 320, 14, 188, 597, 0,
+  0, 97, 998, 0, 0, 67, 545, 645, 927, 0, 0, 460, 0, 0, 41, 733,
+  816, 844, 0, 8, 440, 0, 386, 0, 500, 0, 0, 0, 0, 0, 4, 625,
+  867, 0, 63, 0, 0, 109, 721, 69, 281, 619, 931, 0, 689, 274, 603, 883,
+  534, 872, 951, 0, 0, 0, 316, 0, 13, 0, 149, 0, 531, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 408, 417, 0, 874, 0, 0, 349, 0, 0, 0,
+  0, 0, 0, 0, 0, 967, 0, 0, 0, 0, 0, 0, 19, 0, 0, 514,
+  0, 957, 0, 0, 0, 287, 0, 0, 0, 5, 0, 116, 0, 0, 0, 85,
+  0, 0, 775, 0, 0, 0, 62, 799, 0, 996, 311, 0, 0, 428, 0, 734,
+  498, 0, 759, 0, 203, 88, 46, 124, 192, 301, 375, 505, 0, 0, 0, 0,
+  344, 680, 701, 0, 0, 0, 513, 992, 744, 584, 0, 0, 0, 166, 501, 0,
+  803, 0, 0, 0, 860, 0, 0, 847, 0, 699, 0, 0, 0, 861, 0, 0,
+  179, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 259, 0, 0, 0, 718,
+  242, 165, 901, 293, 103, 0, 357, 569, 0, 0, 7, 299, 312, 361, 28, 430,
+  0, 0, 447, 0, 888, 187, 975, 0, 0, 573, 267, 0, 0, 0, 640, 0,
+  0, 0, 0, 0, 168, 273, 313, 275, 279, 332, 696, 845, 96, 0, 997, 785,
+  131, 0, 163, 515, 0, 928, 245, 938, 0, 0, 0, 0, 655, 291, 605, 0,
+  0, 0, 0, 0, 0, 0, 0, 112, 627, 0, 0, 0, 86, 880, 0, 160,
+  636, 502, 0, 106, 34, 194, 481, 679, 703, 415, 0, 0, 0, 0, 0, 0,
+  0, 0, 292, 150, 940, 0, 766, 740, 0, 0, 0, 0, 0, 0, 33, 0,
+  340, 859, 0, 525, 0, 40, 664, 0, 0, 0, 0, 0, 431, 918, 0, 0,
+  0, 0, 510, 652, 842, 0, 0, 0, 521, 0, 17, 157, 272, 345, 380, 709,
+  0, 0, 0, 249, 548, 180, 0, 0, 0, 77, 130, 0, 0, 687, 0, 0,
+  0, 0, 0, 862, 546, 0, 388, 178, 0, 228, 0, 0, 438, 0, 0, 444,
+  0, 608, 836, 336, 979, 0, 934, 0, 80, 0, 0, 0, 0, 113, 0, 769,
+  3, 167, 0, 0, 129, 885, 891, 0, 541, 631, 0, 688, 0, 0, 939, 747,
+  0, 0, 0, 0, 261, 0, 0, 0, 219, 0, 0, 0, 0, 0, 0, 0,
+  0, 237, 0, 0, 0, 337, 161, 0, 489, 0, 298, 234, 32, 26, 821, 90,
+  0, 0, 956, 0, 653, 0, 0, 0, 0, 0, 0, 346, 0, 0, 0, 949,
+  0, 0, 0, 222, 723, 373, 425, 0, 0, 0, 437, 0, 0, 416, 0, 0,
+  751, 0, 0, 0, 0, 947, 0, 613, 0, 258, 600, 155, 0, 0, 0, 523,
+  181, 0, 0, 0, 741, 522, 823, 0, 399, 676, 0, 646, 552, 648, 663, 990,
+  0, 73, 0, 0, 0, 0, 0, 0, 461, 204, 629, 0, 0, 246, 0, 0,
+  0, 0, 0, 0, 335, 757, 142, 64, 706, 959, 644, 404, 591, 814, 0, 212,
+  0, 0, 853, 0, 455, 0, 0, 53, 56, 0, 0, 110, 295, 598, 698, 988,
+  704, 395, 0, 851, 0, 104, 0, 532, 479, 54, 193, 772, 0, 152, 895, 0,
+  587, 223, 926, 512, 121, 0, 0, 0, 42, 0, 61, 0, 782, 0, 0, 314,
+  0, 0, 0, 0, 0, 0, 910, 549, 0, 0, 186, 71, 22, 0, 0, 869,
+  0, 0, 0, 422, 805, 18, 933, 0, 341, 172, 230, 650, 822, 865, 0, 0,
+  21, 986, 973, 114, 264, 456, 477, 65, 441, 728, 935, 536, 784, 358, 835, 0,
+  0, 0, 788, 0, 0, 111, 0, 0, 137, 196, 450, 778, 903, 122, 0, 0,
+  0, 0, 0, 606, 403, 376, 882, 334, 449, 886, 283, 504, 0, 913, 508, 317,
+  871, 0, 463, 235, 355, 0, 537, 0, 0, 0, 713, 39, 221, 475, 409, 135,
+  601, 922, 993, 0, 0, 700, 95, 391, 962, 0, 595, 0, 144, 98, 0, 0,
+  0, 0, 0, 185, 351, 379, 0, 55, 352, 266, 227, 724, 749, 0, 0, 0,
+  0, 0, 937, 0, 288, 0, 0, 78, 365, 0, 0, 0, 793, 661, 924, 994,
+  0, 0, 0, 0, 145, 0, 364, 712, 0, 0, 0, 0, 685, 858, 0, 398,
+  495, 562, 615, 0, 0, 0, 756, 0, 486, 0, 0, 0, 774, 0, 0, 551,
+  914, 0, 0, 0, 0, 0, 711, 0, 325, 0, 0, 0, 0, 252, 0, 0,
+  781, 420, 220, 854, 0, 0, 0, 588, 0, 0, 0, 0, 0, 683, 630, 776,
+  932, 0, 0, 472, 0, 0, 526, 0, 0, 616, 29, 574, 666, 0, 0, 0,
+  0, 634, 0, 343, 458, 779, 405, 806, 423, 10, 52, 656, 950, 35, 0, 0,
+  0, 0, 0, 282, 384, 231, 621, 639, 0, 0, 0, 875, 0, 0, 0, 87,
+  0, 0, 0, 23, 328, 74, 321, 413, 439, 801, 848, 0, 691, 0, 0, 0,
+  0, 972, 0, 164, 547, 558, 879, 637, 963, 726, 0, 0, 0, 0, 171, 294,
+  0, 0, 825, 0, 310, 780, 0, 0, 0, 0, 0, 0, 37, 553, 791, 0,
+  0, 849, 173, 464, 226, 665, 467, 731, 783, 897, 0, 902, 205, 466, 943, 117,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 0, 961, 0, 0, 0, 480,
+  0, 533, 0, 389, 899, 0, 0, 0, 140, 0, 838, 0, 0, 209, 307, 99,
+  197, 609, 0, 363, 0, 0, 0, 0, 0, 840, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 239, 400, 617, 199, 705, 0, 0, 0, 493, 742, 878, 960,
+  457, 978, 0, 362, 0, 0, 0, 0, 0, 0, 195, 329, 433, 516, 255, 429,
+  0, 218, 736, 0, 0, 539, 0, 213, 717, 0, 657, 0, 0, 0, 44, 669,
+  302, 777, 602, 830, 876, 896, 0, 0, 570, 92, 159, 0, 725, 45, 0, 0,
+  0, 0, 0, 0, 0, 623, 0, 0, 79, 578, 123, 233, 884, 0, 0, 0,
+  610, 0, 0, 954, 353, 132, 0, 0, 0, 0, 0, 752, 804, 829, 798, 917,
+  0, 850, 0, 820, 0, 81, 0, 0, 0, 0, 377, 0, 0, 0, 0, 846,
+  0, 284, 0, 0, 517, 304, 0, 0, 0, 0, 60, 269, 542, 944, 414, 976,
+  0, 0, 0, 511, 0, 324, 484, 708, 952, 491, 0, 0, 225, 432, 0, 0,
+  0, 0, 0, 200, 0, 315, 372, 0, 0, 0, 714, 322, 550, 738, 0, 0,
+  675, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 210, 0, 454, 0, 0,
+  0, 0, 0, 0, 668, 737, 958, 0, 0, 0, 0, 38, 0, 0, 0, 0,
+  0, 309, 596, 0, 0, 0, 0, 0, 0, 0, 76, 0, 0, 583, 0, 0,
+  577, 0, 0, 0, 0, 0, 442, 832, 290, 770, 118, 839, 983, 0, 217, 70,
+  327, 68, 492, 0, 0, 0, 908, 0, 0, 0, 678, 0, 0, 385, 599, 280,
+  177, 794, 0, 0, 0, 0, 94, 697, 176, 620, 0, 0, 305, 0, 0, 586,
+};
+
+const char *WA_FREQ_76_TOKENS[] = {
+  "ngali",
+  "ngiti",
+  "munene",
+  "mbaka",
+  "nisyiukuma",
+  "tom",
+  "niwe",
+  "waku",
+  "niniendete",
+  "huu",
+  "niw",
+  "o",
+  "usi",
+  "wa",
+  "katatu",
+  "nduniani",
+  "mwaitu",
+  "atũmie",
+  "valũa",
+  "hũũ",
+  "kwacha",
+  "nuthambisye",
+  "nikwataa",
+  "mbia",
+  "ya",
+  "mwaki",
+  "isovetw",
+  "e",
+  "na",
+  "mũonza",
+  "hĩĩ",
+  "nĩ",
+  "yakwa",
+};
+const uint16_t WA_FREQ_76_RANKS[] = {
+  0, 11, 30, 0, 0, 0, 0, 0, 26, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 16, 0, 0,
+  0, 1, 12, 0, 24, 29, 0, 0, 19, 7, 0, 3, 8, 0, 0, 0,
+  0, 0, 21, 31, 13, 20, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0,
+  0, 32, 0, 0, 15, 0, 0, 0, 0, 0, 5, 18, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 10, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 17, 22, 27, 25, 0, 0, 2, 0, 0, 4, 0, 0, 0, 6,
+  0, 0, 0, 28, 33, 0, 0, 0, 0, 23, 0, 0, 0, 0, 0, 0,
+};
+
+const char *WA_FREQ_77_TOKENS[] = {
+  "мен",
+  "ол",
+  "жоқ",
+  "сен",
+  "не",
+  "бұл",
+  "керек",
+  "оны",
+  "ба",
+  "ма",
+  "жақсы",
+  "менің",
+  "иә",
+  "маған",
+  "бар",
+  "бе",
+  "деп",
+  "емес",
+  "оның",
+  "сіз",
+  "біз",
+  "ал",
+  "мені",
+  "де",
+  "ғой",
+  "жатыр",
+  "енді",
+  "үшін",
+  "олар",
+  "сенің",
+  "бір",
+  "да",
+  "бірақ",
+  "қайда",
+  "саған",
+  "сені",
+  "неге",
+  "адам",
+  "осында",
+  "болады",
+  "келеді",
+  "доктор",
+  "оған",
+  "хаку",
+  "николас",
+  "мына",
+  "болды",
+  "тек",
+  "бәрі",
+  "рахмет",
+  "дұрыс",
+  "сол",
+  "мүмкін",
+  "және",
+  "тағы",
+  "жұмыс",
+  "еді",
+  "басқа",
+  "ме",
+  "болып",
+  "егер",
+  "осы",
+  "біздің",
+  "мында",
+  "солай",
+  "едім",
+  "өтінемін",
+  "міне",
+  "президент",
+  "малдер",
+  "екен",
+  "сіздің",
+  "кетті",
+  "тұр",
+  "кәзір",
+  "болған",
+  "өте",
+  "ештеңе",
+  "кім",
+  "сияқты",
+  "болса",
+  "қалай",
+  "білмеймін",
+  "скалли",
+  "шығар",
+  "бізге",
+  "кешіріңіз",
+  "джо",
+  "жарайды",
+  "алып",
+  "әлі",
+  "сэн",
+  "сізді",
+  "пе",
+  "сізге",
+  "ғана",
+  "жерде",
+  "ше",
+  "бәрін",
+  "кеттік",
+  "бола",
+  "сәлем",
+  "жүр",
+  "шын",
+  "уганда",
+  "жерден",
+  "адамдар",
+  "туралы",
+  "жерге",
+  "сонда",
+  "қалды",
+  "келді",
+  "мырза",
+  "тірі",
+  "деген",
+  "болар",
+  "білемін",
+  "онда",
+  "әкей",
+  "жаңа",
+  "қой",
+  "әй",
+  "қайырлы",
+  "тихиро",
+  "меніңше",
+  "а",
+  "фбр",
+  "бірге",
+  "қан",
+  "қатты",
+  "тым",
+  "себебі",
+  "таң",
+  "екенін",
+  "кел",
+  "келген",
+  "тауып",
+  "өз",
+  "дейді",
+  "көріп",
+  "бер",
+  "тіпті",
+  "оларды",
+  "алмаймын",
+  "осылай",
+  "олай",
+  "гариган",
+  "білесің",
+  "бірдеңе",
+  "қол",
+  "амин",
+  "одан",
+  "бері",
+  "жатырмын",
+  "әке",
+  "қайта",
+  "мынау",
+  "ең",
+  "келе",
+  "у",
+  "қандай",
+  "апа",
+  "сондай",
+  "көп",
+  "қажет",
+  "мұнда",
+  "нәрсе",
+  "тұрмын",
+  "үлкен",
+  "әрине",
+  "кешірім",
+  "ешкім",
+  "бізді",
+  "па",
+  "бүгін",
+  "қарашы",
+  "іздеп",
+  "тиіс",
+  "уәде",
+  "сендер",
+  "менде",
+  "қарай",
+  "дене",
+  "соң",
+  "кейін",
+  "тез",
+  "юбаба",
+  "тарт",
+  "біреу",
+  "болмайды",
+  "ана",
+  "тыныш",
+  "өзім",
+  "құдай",
+  "тұрсың",
+  "дәл",
+  "жағдай",
+  "ойлап",
+  "екі",
+  "болмаса",
+  "айтты",
+  "келдім",
+  "артқа",
+  "қуаныштымын",
+  "қарсы",
+  "арнайы",
+  "былай",
+  "шынымен",
+  "қиын",
+  "түс",
+  "келіп",
+  "бол",
+  "тоқта",
+  "қайдан",
+  "барлық",
+  "үш",
+  "комази",
+  "жүріңдер",
+  "ақ",
+  "әйел",
+  "өзің",
+  "барып",
+  "алтын",
+  "өтінем",
+  "өмір",
+  "көмек",
+  "отыр",
+  "болу",
+  "кәне",
+  "қонақ",
+  "кішкене",
+  "әдемі",
+  "алмай",
+  "келмейді",
+  "әлде",
+  "керемет",
+  "адамдары",
+  "деймін",
+  "жеп",
+  "бойы",
+  "сэр",
+  "дегенмен",
+  "өзі",
+  "кей",
+  "боп",
+  "шығып",
+  "табылған",
+  "тезірек",
+  "әрі",
+  "біраз",
+  "оларға",
+  "барлығын",
+  "бұны",
+  "бара",
+  "бұның",
+  "сенімен",
+  "аласың",
+  "ой",
+  "айтып",
+  "дем",
+  "алған",
+  "қош",
+  "бала",
+  "күтіп",
+  "едік",
+  "ауырып",
+  "керегі",
+  "неткен",
+  "бос",
+  "әшейін",
+  "қарап",
+  "аха",
+  "маңызды",
+  "қанша",
+  "сізбен",
+  "айтарым",
+  "алайда",
+  "өзен",
+  "сайтан",
+  "қызық",
+  "әкем",
+  "жоғалып",
+  "секілді",
+  "кетіп",
+  "сізде",
+  "жауап",
+  "келдіңіз",
+  "қолымнан",
+  "алды",
+  "кеткен",
+  "қалдым",
+  "алмайсың",
+  "сонымен",
+  "джона",
+  "бо",
+  "шақырып",
+  "адамның",
+  "кешір",
+  "сау",
+  "дейін",
+  "соншалықты",
+  "маккензи",
+  "кезде",
+  "тамаша",
+  "болатын",
+  "қашан",
+  "үйге",
+  "онымен",
+  "қалған",
+  "тұрсыз",
+  "берші",
+  "күн",
+  "сондықтан",
+  "бұрынғы",
+  "міндетті",
+  "қорықпа",
+  "жөнінде",
+  "қазір",
+  "айтасың",
+  "дейсіз",
+  "болсаң",
+  "жол",
+  "баланы",
+  "о",
+  "жақсымын",
+  "келдің",
+  "қашып",
+  "көрген",
+  "джонас",
+  "ден",
+  "кет",
+  "ұста",
+  "аласыз",
+  "мынаны",
+  "жаман",
+  "тоқтат",
+  "бәрібір",
+  "айт",
+  "мұны",
+  "тура",
+  "тоқтай",
+  "жақын",
+  "сара",
+  "әкеліңдер",
+  "осындай",
+  "өлтіреді",
+  "ойлаймын",
+  "келесі",
+  "айтшы",
+  "сөз",
+  "зат",
+  "ойлайсың",
+  "рин",
+  "қара",
+  "жарайсың",
+  "иісі",
+  "ем",
+  "бізде",
+  "барады",
+  "таба",
+  "едің",
+  "береді",
+  "жасап",
+  "істеп",
+  "іс",
+  "балақай",
+  "осындамын",
+  "жұмысқа",
+  "жиіркенішті",
+  "юбабаның",
+  "фокс",
+  "ауру",
+  "хабар",
+  "болдың",
+  "кісі",
+  "берген",
+  "баратын",
+  "білесіз",
+  "істеуге",
+  "қаша",
+  "өмірін",
+  "сұрап",
+  "жатырсың",
+  "тұнба",
+  "моника",
+  "түрде",
+  "тоқтаңыз",
+  "васва",
+  "бірі",
+  "күшті",
+  "оботтың",
+  "ауыру",
+  "агент",
+  "естіп",
+  "рет",
+  "осыны",
+  "өлі",
+  "айта",
+  "содан",
+  "арада",
+  "жатқан",
+  "кеш",
+  "тұрыңдар",
+  "есімім",
+  "өзіңді",
+  "түсінемін",
+  "бас",
+  "дейсің",
+  "құпия",
+  "рұқсат",
+  "сұрақ",
+  "көре",
+  "жеке",
+  "жұмысы",
+  "ашық",
+  "ондай",
+  "обот",
+  "пойыз",
+  "қорқып",
+  "қызмет",
+  "ер",
+  "өліп",
+  "дана",
+  "кейде",
+  "көмегің",
+  "көреміз",
+  "ұшып",
+  "су",
+  "лас",
+  "дайын",
+  "әйтпесе",
+  "оңай",
+  "етіп",
+  "алмаймыз",
+  "келмей",
+  "көр",
+  "едіңіз",
+  "көмектесе",
+  "соған",
+  "шығарсың",
+  "отырмын",
+  "вирджиния",
+  "бұдан",
+  "жер",
+  "болсын",
+  "біледі",
+  "нашар",
+  "ертең",
+  "келсе",
+  "істейді",
+  "шотландияда",
+  "кристиан",
+  "көрдім",
+  "менен",
+  "болдым",
+  "британ",
+  "ешкімге",
+  "амансыз",
+  "таптым",
+  "сезіп",
+  "жалғыз",
+  "барасың",
+  "штаты",
+  "сатып",
+  "кіріңіз",
+  "алатын",
+  "түрлі",
+  "кедей",
+  "қалайсың",
+  "қуып",
+  "ұшақ",
+  "сезім",
+  "олардың",
+  "ойладым",
+  "британдықтар",
+  "елден",
+  "агентін",
+  "соңғы",
+  "аш",
+  "қала",
+  "ұлы",
+  "ұстап",
+  "айтпақшы",
+  "қал",
+  "екінші",
+  "жұмысым",
+  "емдеу",
+  "уақытта",
+  "малдерді",
+  "операция",
+  "өзімнің",
+  "қарапайым",
+  "анда",
+  "госпитальға",
+  "экстрасенс",
+  "беріп",
+  "қайтайықшы",
+  "бітті",
+  "істей",
+  "ұйықтап",
+  "жолмен",
+  "жәй",
+  "халық",
+  "анау",
+  "айтасыз",
+  "дәрігермін",
+  "еске",
+  "маймылдар",
+  "ақпарат",
+  "жоғалған",
+  "бұрын",
+  "жек",
+  "көруге",
+  "тұрыңыз",
+  "тамақ",
+  "мінекей",
+  "жіберді",
+  "қояды",
+  "ата",
+  "қолы",
+  "ешқашан",
+  "бойынша",
+  "жаққа",
+  "бере",
+  "артық",
+  "олардан",
+  "көрейік",
+  "сендерге",
+  "үкімет",
+  "барамын",
+  "алмадым",
+  "екеуміз",
+  "тұрады",
+  "кете",
+  "мейірімді",
+  "ауруы",
+  "шешім",
+  "болғандықтан",
+  "таста",
+  "арналған",
+  "жайлы",
+  "жете",
+  "жан",
+  "беріңіз",
+  "оян",
+  "үйде",
+  "сене",
+  "тездет",
+  "болуы",
+  "өңсіз",
+  "сенемін",
+  "естідім",
+  "сенбейсің",
+  "алмайды",
+  "берсін",
+  "кісілер",
+  "тездетіп",
+  "өзіңіз",
+  "мұз",
+  "пайда",
+  "тұра",
+  "айтамын",
+  "беріңізші",
+  "бэннан",
+  "сонша",
+  "айтқан",
+  "қай",
+  "болмақ",
+  "көптеген",
+  "өзінің",
+  "менімен",
+  "үстінде",
+  "министірі",
+  "жерді",
+  "угандаға",
+  "әне",
+  "ақымақ",
+  "айттың",
+  "қатысы",
+  "ешқандай",
+  "крис",
+  "ақша",
+  "қағаз",
+  "дедіңіз",
+  "кетемін",
+  "өтірікші",
+  "отырыңыз",
+  "барам",
+  "бірдей",
+  "сандхофф",
+  "кеттің",
+  "қыз",
+  "ацепромазин",
+  "көресің",
+  "сағаттан",
+  "терең",
+  "әміршісі",
+  "гариганмын",
+  "қылмыс",
+  "ұқсайды",
+  "тұрғаным",
+  "түсіндім",
+  "жігіт",
+  "барлығы",
+  "дәрі",
+  "алу",
+  "әйелдер",
+  "бірнеше",
+  "заңсыз",
+  "күтпеген",
+  "көзіңді",
+  "дәмді",
+  "ала",
+  "саулық",
+  "ел",
+  "дәрігер",
+  "апам",
+  "мұның",
+  "сосын",
+  "қалады",
+  "айтады",
+  "соны",
+  "айтыңыз",
+  "он",
+  "төмен",
+  "емеспін",
+  "қарым",
+  "басына",
+  "мінеки",
+  "мүшесін",
+  "бізбен",
+  "адамға",
+  "салынған",
+  "болмай",
+  "қойшы",
+  "кімсің",
+  "келіңіз",
+  "анық",
+  "қолым",
+  "хабарласып",
+  "емхана",
+  "елдің",
+  "жоғалт",
+  "танысқаныма",
+  "болыңыз",
+  "мыналарды",
+  "ұрдым",
+  "кетеді",
+  "ас",
+  "кешкі",
+  "басқаша",
+  "көреді",
+  "аян",
+  "сағат",
+  "біртүрлі",
+  "белгілі",
+  "құдайдан",
+  "кісіні",
+  "алдында",
+  "ричмонд",
+  "қолдана",
+  "жасалған",
+  "үйіңе",
+  "дәрігерсің",
+  "жаныңда",
+  "жатырсыз",
+  "дегенің",
+  "құрып",
+  "кеткір",
+  "күдікті",
+  "екеуміздің",
+  "сөзімді",
+  "бұрында",
+  "ұрлап",
+  "әңгіме",
+  "баланың",
+  "стоун",
+  "көрдіңіз",
+  "тұрған",
+  "өкілі",
+  "қою",
+  "машина",
+  "қамап",
+  "адаммен",
+  "сақтап",
+  "барда",
+  "сөйлесіп",
+  "көрсет",
+  "отырсың",
+  "ағылшын",
+  "емді",
+  "кез",
+  "анаң",
+  "емханаға",
+  "сөйлесуге",
+  "орнына",
+  "кэмпбел",
+  "талғам",
+  "адамдарға",
+  "меннен",
+  "із",
+  "кімге",
+  "білесіңбе",
+  "шық",
+  "батыл",
+  "тұрғанда",
+  "қолынан",
+  "шотландық",
+  "әсіресе",
+  "кімсіз",
+  "айтқанымды",
+  "драмми",
+  "өлтірмекші",
+  "президентті",
+  "мүшелерін",
+  "болсам",
+  "отырған",
+  "атып",
+  "ойын",
+  "жүріп",
+  "ойлайды",
+  "дым",
+  "тоқтамай",
+  "тырысам",
+  "дедім",
+  "жануар",
+  "таптыңыз",
+  "қосылып",
+  "оқасы",
+  "әкеммен",
+  "дәрігерімін",
+  "әбден",
+  "қойды",
+  "етпейді",
+  "күйеуім",
+  "тыңдашы",
+  "екенсің",
+  "жас",
+  "қайдасыз",
+  "байланыс",
+  "табады",
+  "қалайды",
+  "жіберген",
+  "мақтан",
+  "шаршадым",
+  "телефон",
+  "себеп",
+  "атап",
+  "мама",
+  "сенеді",
+  "қолында",
+  "уақыт",
+  "етеміз",
+  "қайғылы",
+  "шықты",
+  "күте",
+  "қыздың",
+  "көрдің",
+  "алғашқы",
+  "ауырды",
+  "раушан",
+  "туалет",
+  "түбі",
+  "ей",
+  "иттер",
+  "ақылсыз",
+  "минуспен",
+  "тұтқындар",
+  "жіберіңдер",
+  "теңіз",
+  "келіңдер",
+  "алады",
+  "күні",
+  "тастадым",
+  "жаншып",
+  "мерит",
+  "ретінде",
+  "тыңда",
+  "беремін",
+  "істейсіз",
+  "алдым",
+  "ие",
+  "қам",
+  "әскерлер",
+  "сөйлейсіз",
+  "боламын",
+  "ағылшынша",
+  "апасын",
+  "батпақ",
+  "автобус",
+  "елес",
+  "жүреді",
+  "қалып",
+  "тыныштал",
+  "зоодүкен",
+  "үйшікке",
+  "аз",
+  "берем",
+  "шыдай",
+  "шықтым",
+  "ашыңдар",
+  "жыл",
+  "бірінші",
+  "есімімді",
+  "тоқтаңдар",
+  "қоғамдық",
+  "сұрай",
+  "ауыр",
+  "айтам",
+  "сиқыршы",
+  "ұнамайды",
+  "істегім",
+  "жібереді",
+  "атың",
+  "өсиеті",
+  "келуіне",
+  "жасай",
+  "дзэниба",
+  "өздері",
+  "астына",
+  "кеттім",
+  "ұ",
+  "аялдама",
+  "отырып",
+  "жолы",
+  "жай",
+  "деді",
+  "атаға",
+  "келісімшартқа",
+  "сендердің",
+  "аузыңды",
+  "өзімді",
+  "қайтып",
+  "жердің",
+  "сенбеймін",
+  "түсас",
+  "жұмысын",
+  "агенті",
+  "айналып",
+  "құдайдың",
+  "дәрігері",
+  "жылаймын",
+  "мақсат",
+  "үкіметі",
+  "аминге",
+  "көрінеді",
+  "жергілікті",
+  "адамдарды",
+  "оларда",
+  "есіміңді",
+  "жүрмін",
+  "өлім",
+  "хат",
+  "қызды",
+  "келдік",
+  "батыс",
+  "берейін",
+  "келгенін",
+  "қолыңнан",
+  "заттар",
+  "ауылға",
+  "тікен",
+  "жасайтын",
+  "же",
+  "бастап",
+  "та",
+  "ішке",
+  "тоқтама",
+  "бетін",
+  "бонни",
+  "кеше",
+  "нәрсені",
+  "алдық",
+  "таза",
+  "саламыз",
+  "өлең",
+  "әжей",
+  "келемін",
+  "жуынды",
+  "рухы",
+  "тақтайша",
+  "нигихаями",
+  "адаммын",
+  "адал",
+  "қылмыскерлерді",
+  "мейман",
+  "жағдайына",
+  "көрсеткім",
+  "мәссаған",
+  "кесіртке",
+  "өзін",
+  "доғар",
+  "көмектескен",
+  "асығыспын",
+  "өмірі",
+  "шеше",
+  "есімде",
+  "түсті",
+  "қонағымыз",
+  "жолың",
+  "атаққа",
+  "болғаным",
+  "шексіз",
+  "сәл",
+  "толығымен",
+  "айда",
+  "несі",
+  "қонаққа",
+  "жігіттер",
+  "далбаса",
+  "адамдарым",
+  "түсімде",
+  "көргем",
+  "ұмыттың",
+  "сыйлаймын",
+  "сұраған",
+  "оқиғаларға",
+  "сенесіз",
+  "істер",
+  "жауыз",
+  "сыртқы",
+  "жүрсіңдер",
+  "жабық",
+  "президенттің",
+  "атым",
+  "іздеу",
+  "сияқтымын",
+  "бұрыннан",
+  "босқа",
+  "көріңіз",
+  "жатып",
+  "қалайсыз",
+  "қолмен",
+  "алыс",
+  "болмасын",
+  "екіншісі",
+  "адамсың",
+  "бердің",
+  "жылдар",
+  "сөйтіп",
+  "жібереміз",
+  "сенгім",
+  "ішімдік",
+  "холидей",
+  "суға",
+  "хакудың",
+  "сендерді",
+  "бұнымен",
+  "маскүнем",
+  "шапшаң",
+  "көмекші",
+  "жағдайы",
+  "айналыспаймын",
+  "еліме",
+  "жұмысшы",
+  "байланысты",
+  "ванна",
+  "келмейтін",
+  "бөлмесіне",
+  "жібер",
+  "кеңесшімсің",
+  "әрқашан",
+  "шетке",
+  "барын",
+  "жетеді",
+  "түнде",
+  "бөлмеге",
+  "емі",
+  "естідік",
+  "жоғарыға",
+  "кездесетін",
+  "кеп",
+  "бермейді",
+  "көмекшісі",
+  "сирек",
+  "орнында",
+  "ұйықтай",
+  "жаным",
+  "айқайлама",
+  "бәлішті",
+  "ұзын",
+  "ойыңды",
+  "кісіге",
+  "ойыншықтарды",
+  "берді",
+  "тастаңызшы",
+  "қорқынышты",
+  "жылама",
+  "шулап",
+  "сұрау",
+  "кеттіңдер",
+  "тірімін",
+  "төсектегі",
+  "қане",
+  "баға",
+  "есімің",
+  "жатпайды",
+  "іздері",
+  "немене",
+  "қолда",
+};
+const uint16_t WA_FREQ_77_RANKS[] = {
+  0, 3, 0, 525, 960, 0, 0, 0, 0, 566, 919, 0, 0, 78, 369, 0,
+  539, 0, 0, 412, 196, 86, 0, 725, 888, 0, 0, 0, 0, 522, 187, 0,
+  211, 991, 0, 22, 362, 526, 0, 648, 0, 216, 611, 364, 0, 438, 913, 0,
+  0, 0, 475, 0, 63, 0, 76, 140, 273, 378, 779, 144, 0, 0, 408, 0,
+  33, 508, 230, 0, 857, 650, 0, 0, 0, 0, 0, 461, 0, 0, 762, 70,
+  0, 0, 0, 421, 0, 0, 0, 324, 0, 0, 0, 0, 34, 705, 0, 0,
+  0, 0, 515, 0, 0, 129, 734, 924, 946, 0, 0, 0, 0, 0, 0, 805,
+  929, 269, 0, 0, 0, 0, 0, 0, 0, 394, 0, 0, 0, 518, 753, 0,
+  0, 91, 0, 0, 178, 639, 0, 0, 0, 0, 535, 809, 0, 459, 0, 0,
+  304, 751, 0, 484, 0, 151, 0, 0, 0, 507, 0, 433, 638, 311, 0, 840,
+  0, 582, 715, 306, 14, 386, 194, 389, 254, 46, 391, 470, 589, 176, 252, 652,
+  848, 0, 220, 722, 145, 573, 0, 310, 380, 0, 409, 575, 0, 745, 663, 0,
+  572, 0, 0, 0, 244, 109, 366, 864, 0, 0, 0, 82, 0, 967, 0, 0,
+  0, 0, 742, 0, 544, 974, 0, 375, 0, 498, 215, 0, 314, 0, 577, 695,
+  133, 0, 0, 0, 0, 0, 0, 884, 210, 538, 0, 0, 0, 0, 0, 127,
+  497, 676, 0, 0, 490, 0, 434, 798, 384, 799, 444, 996, 0, 268, 0, 0,
+  0, 0, 0, 0, 491, 0, 341, 688, 521, 368, 0, 0, 0, 0, 317, 164,
+  193, 445, 0, 0, 0, 0, 0, 0, 633, 0, 446, 0, 0, 0, 865, 0,
+  0, 0, 0, 0, 0, 730, 0, 703, 0, 0, 0, 344, 596, 284, 56, 766,
+  0, 0, 530, 667, 0, 0, 0, 943, 322, 744, 0, 603, 469, 0, 916, 0,
+  0, 0, 613, 0, 487, 0, 30, 968, 0, 0, 657, 843, 121, 0, 0, 66,
+  0, 910, 553, 827, 0, 634, 0, 0, 894, 45, 0, 642, 747, 0, 816, 0,
+  0, 0, 0, 0, 0, 0, 451, 0, 126, 928, 0, 0, 186, 994, 0, 812,
+  0, 0, 0, 0, 489, 661, 0, 0, 0, 649, 283, 130, 462, 10, 543, 305,
+  709, 131, 724, 693, 243, 900, 0, 0, 0, 0, 443, 0, 0, 200, 547, 0,
+  233, 339, 0, 0, 0, 0, 0, 35, 720, 0, 0, 0, 0, 0, 0, 31,
+  0, 0, 0, 549, 0, 542, 591, 432, 0, 0, 402, 332, 0, 0, 275, 452,
+  763, 977, 0, 0, 0, 138, 0, 0, 0, 558, 36, 7, 635, 0, 0, 0,
+  0, 477, 0, 0, 0, 0, 731, 0, 15, 319, 0, 0, 0, 120, 0, 513,
+  0, 100, 0, 466, 170, 0, 0, 0, 0, 112, 726, 930, 349, 9, 962, 313,
+  0, 0, 833, 935, 0, 357, 263, 345, 449, 20, 504, 615, 754, 822, 0, 102,
+  957, 388, 0, 0, 0, 0, 12, 0, 0, 0, 290, 845, 580, 890, 456, 0,
+  0, 0, 583, 0, 428, 0, 320, 0, 847, 644, 975, 301, 161, 0, 0, 0,
+  0, 0, 0, 258, 0, 534, 886, 0, 424, 0, 48, 794, 824, 0, 0, 0,
+  0, 0, 282, 419, 0, 0, 0, 0, 0, 0, 0, 431, 0, 0, 0, 519,
+  352, 579, 678, 354, 393, 871, 49, 142, 918, 0, 0, 0, 0, 593, 188, 202,
+  279, 567, 173, 862, 237, 668, 0, 630, 0, 0, 0, 612, 0, 560, 0, 0,
+  0, 746, 0, 0, 622, 548, 0, 889, 808, 0, 0, 0, 195, 117, 440, 0,
+  0, 0, 0, 116, 516, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 980,
+  0, 0, 0, 0, 0, 931, 0, 303, 128, 0, 0, 0, 458, 0, 278, 0,
+  0, 0, 610, 401, 0, 0, 0, 0, 0, 0, 0, 599, 370, 793, 531, 0,
+  0, 0, 0, 0, 0, 0, 478, 677, 331, 0, 0, 877, 0, 0, 0, 0,
+  0, 944, 563, 992, 0, 496, 246, 866, 0, 169, 392, 942, 441, 776, 982, 915,
+  0, 0, 787, 371, 0, 167, 0, 0, 0, 480, 291, 132, 921, 0, 925, 0,
+  0, 309, 89, 570, 37, 792, 299, 499, 404, 914, 0, 0, 0, 0, 83, 778,
+  0, 0, 17, 769, 437, 0, 874, 0, 821, 631, 590, 0, 75, 813, 524, 0,
+  0, 0, 0, 415, 625, 899, 0, 0, 670, 340, 585, 711, 0, 103, 671, 0,
+  768, 197, 605, 0, 0, 0, 355, 780, 0, 152, 481, 0, 65, 971, 50, 541,
+  576, 0, 361, 479, 618, 624, 655, 198, 802, 19, 581, 0, 0, 0, 184, 0,
+  0, 0, 0, 0, 110, 256, 0, 0, 0, 0, 0, 0, 966, 0, 0, 0,
+  0, 736, 0, 298, 0, 0, 0, 0, 182, 318, 0, 286, 748, 623, 93, 0,
+  274, 0, 0, 561, 0, 0, 0, 0, 981, 0, 0, 414, 0, 0, 0, 0,
+  400, 0, 838, 245, 483, 597, 714, 880, 96, 956, 32, 359, 0, 0, 0, 473,
+  0, 781, 463, 604, 998, 236, 0, 238, 0, 0, 124, 0, 0, 0, 260, 0,
+  350, 416, 139, 206, 125, 183, 376, 403, 425, 429, 510, 757, 806, 687, 858, 784,
+  846, 917, 0, 0, 0, 0, 562, 81, 797, 0, 0, 926, 0, 0, 0, 511,
+  0, 0, 0, 0, 0, 39, 55, 57, 149, 0, 723, 0, 227, 172, 0, 0,
+  0, 0, 592, 111, 685, 964, 0, 0, 0, 1, 397, 464, 704, 927, 0, 906,
+  13, 212, 0, 162, 988, 0, 0, 0, 0, 0, 0, 820, 0, 0, 358, 247,
+  0, 379, 696, 0, 0, 343, 0, 168, 218, 351, 226, 373, 405, 61, 707, 0,
+  79, 861, 878, 0, 772, 0, 0, 0, 804, 0, 683, 0, 0, 0, 72, 321,
+  963, 837, 0, 0, 986, 0, 0, 0, 0, 0, 0, 85, 550, 829, 690, 775,
+  0, 154, 342, 740, 334, 181, 0, 0, 447, 732, 0, 0, 0, 0, 0, 0,
+  204, 0, 0, 174, 0, 407, 616, 0, 0, 0, 0, 179, 694, 626, 0, 0,
+  231, 767, 0, 0, 382, 0, 209, 0, 387, 503, 0, 0, 327, 0, 749, 0,
+  0, 664, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  993, 0, 0, 883, 0, 0, 632, 0, 108, 0, 0, 0, 0, 0, 710, 0,
+  0, 0, 155, 104, 160, 295, 689, 62, 860, 898, 502, 528, 728, 312, 0, 951,
+  221, 713, 785, 0, 651, 782, 0, 123, 180, 867, 0, 0, 0, 0, 0, 43,
+  814, 0, 0, 0, 0, 743, 891, 0, 147, 0, 0, 0, 893, 316, 0, 28,
+  868, 0, 0, 0, 0, 0, 0, 0, 0, 0, 251, 950, 786, 0, 0, 0,
+  0, 0, 0, 0, 692, 0, 609, 0, 435, 0, 165, 40, 0, 0, 0, 0,
+  0, 506, 0, 0, 0, 0, 0, 24, 294, 0, 0, 0, 0, 0, 983, 0,
+  0, 554, 0, 905, 225, 0, 0, 214, 60, 285, 600, 699, 662, 106, 64, 556,
+  586, 365, 628, 954, 0, 0, 0, 0, 0, 831, 6, 337, 0, 395, 665, 0,
+  0, 0, 0, 0, 0, 0, 0, 674, 922, 0, 673, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 192, 0, 0, 336, 818, 0, 500, 0, 869, 0, 0,
+  0, 0, 892, 0, 0, 0, 390, 512, 619, 0, 0, 0, 44, 0, 23, 0,
+  680, 0, 0, 0, 264, 881, 156, 0, 113, 602, 157, 629, 0, 0, 0, 0,
+  0, 249, 0, 0, 0, 468, 482, 0, 527, 969, 0, 825, 617, 0, 0, 0,
+  0, 0, 0, 323, 810, 338, 850, 413, 488, 0, 0, 0, 0, 0, 0, 0,
+  0, 686, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 439,
+  537, 897, 0, 267, 250, 80, 557, 0, 163, 0, 287, 0, 0, 240, 0, 0,
+  0, 471, 0, 0, 0, 87, 970, 0, 646, 92, 0, 0, 0, 398, 0, 335,
+  738, 0, 0, 721, 571, 0, 0, 0, 0, 0, 691, 150, 0, 99, 995, 0,
+  0, 875, 0, 0, 514, 293, 0, 0, 0, 621, 949, 606, 0, 5, 257, 420,
+  852, 0, 262, 826, 77, 0, 774, 118, 923, 0, 0, 0, 0, 0, 0, 0,
+  399, 406, 0, 248, 717, 771, 0, 0, 0, 0, 114, 422, 912, 849, 0, 385,
+  873, 0, 0, 835, 0, 759, 27, 0, 0, 0, 4, 0, 0, 0, 801, 0,
+  0, 0, 166, 565, 0, 0, 637, 0, 235, 706, 26, 47, 11, 647, 879, 904,
+  0, 0, 932, 0, 614, 984, 448, 41, 815, 347, 659, 788, 326, 990, 568, 0,
+  770, 0, 0, 0, 0, 29, 159, 0, 0, 0, 189, 54, 228, 476, 141, 712,
+  800, 903, 0, 716, 0, 52, 0, 719, 0, 308, 958, 296, 270, 0, 0, 356,
+  0, 0, 578, 551, 329, 353, 430, 896, 271, 584, 0, 0, 941, 945, 0, 25,
+  832, 0, 0, 783, 0, 0, 0, 0, 0, 0, 0, 0, 280, 601, 0, 997,
+  0, 0, 0, 839, 0, 972, 0, 101, 0, 0, 836, 0, 0, 0, 0, 0,
+  0, 115, 0, 372, 0, 0, 0, 51, 0, 0, 718, 936, 153, 641, 908, 0,
+  0, 0, 67, 0, 0, 265, 374, 0, 0, 0, 0, 0, 750, 0, 764, 0,
+  0, 0, 0, 952, 0, 0, 643, 0, 177, 0, 907, 253, 333, 523, 741, 959,
+  300, 552, 0, 859, 0, 0, 0, 0, 0, 0, 0, 807, 0, 315, 0, 955,
+  777, 0, 0, 0, 0, 505, 627, 472, 976, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 94, 933, 0, 0, 830, 0, 819, 0, 0, 423, 756, 0, 0,
+  0, 18, 803, 739, 465, 529, 555, 934, 0, 0, 0, 377, 0, 0, 708, 0,
+  0, 965, 0, 0, 495, 733, 0, 383, 0, 95, 654, 0, 0, 0, 0, 272,
+  0, 546, 134, 297, 0, 773, 939, 0, 0, 348, 0, 288, 0, 681, 0, 0,
+  0, 789, 608, 0, 0, 136, 0, 0, 0, 0, 119, 191, 367, 697, 0, 595,
+  266, 148, 122, 660, 698, 569, 872, 0, 978, 0, 0, 185, 0, 0, 0, 0,
+  328, 492, 0, 844, 0, 0, 735, 0, 396, 0, 0, 217, 895, 887, 701, 842,
+  0, 486, 851, 199, 0, 302, 0, 0, 190, 467, 765, 442, 620, 870, 876, 0,
+  0, 0, 0, 143, 979, 292, 0, 0, 0, 588, 811, 105, 0, 71, 234, 0,
+  426, 0, 0, 0, 0, 0, 0, 74, 203, 418, 817, 2, 0, 0, 0, 0,
+  0, 545, 645, 640, 0, 0, 587, 0, 961, 0, 0, 417, 158, 0, 0, 0,
+  863, 1000, 223, 0, 987, 0, 0, 0, 0, 436, 755, 0, 360, 0, 0, 363,
+  729, 137, 0, 0, 682, 0, 0, 911, 213, 702, 0, 855, 953, 381, 460, 885,
+  0, 0, 841, 666, 0, 989, 232, 0, 761, 0, 0, 239, 208, 281, 474, 201,
+  509, 0, 0, 0, 902, 0, 307, 69, 0, 0, 0, 0, 0, 0, 0, 0,
+  224, 98, 760, 0, 0, 0, 0, 0, 0, 0, 455, 0, 205, 453, 636, 255,
+  0, 427, 0, 0, 0, 0, 0, 0, 0, 0, 229, 276, 737, 559, 84, 450,
+  828, 937, 856, 0, 0, 494, 0, 0, 0, 0, 0, 727, 0, 0, 0, 0,
+  0, 684, 59, 973, 0, 0, 90, 42, 171, 242, 346, 410, 653, 73, 540, 656,
+  790, 259, 532, 791, 940, 947, 999, 0, 533, 0, 219, 411, 0, 0, 795, 135,
+  0, 493, 0, 0, 0, 68, 0, 0, 0, 501, 0, 675, 920, 948, 517, 564,
+  598, 261, 97, 594, 796, 0, 0, 207, 88, 0, 58, 536, 0, 823, 16, 0,
+  0, 834, 0, 0, 0, 0, 0, 574, 700, 0, 0, 0, 107, 0, 854, 882,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 985, 0, 0, 0, 607,
+  658, 485, 669, 0, 672, 0, 0, 38, 325, 454, 752, 909, 0, 0, 8, 0,
+  53, 901, 0, 0, 0, 0, 175, 0, 146, 330, 0, 758, 938, 520, 679, 0,
+  0, 0, 277, 289, 0, 21, 0, 0, 0, 0, 0, 241, 457, 853, 222, 0,
+};
+
+const char *WA_FREQ_78_TOKENS[] = {
+  "និង",
+  "វិទ្យាស្ថានជាតិស្ថិតិ",
+  "ឬ",
+  "www.stats.nis.gov.kh",
+  "ដែល",
+  "២",
+  "១",
+  "ខេត្តបាត់ដំបង",
+  "ម",
+  "ខេត្តបន្ទាយមានជ័យ",
+  "៤",
+  "គឺ",
+  "ឃុំ",
+  "៣",
+  "ខេត្តកណ្តាល",
+  "ប្រវែង",
+  "ឆ្នាំ",
+  "៥",
+  "ទៅ",
+  "មាន",
+  "៦",
+  "ហើយ",
+  "១០",
+  "ក្នុង",
+  "៨",
+  "រួមមាន",
+  "ពី",
+  "១២",
+  "៧",
+  "ត្រូវ",
+  "ខែ",
+  "ដល់",
+  "www.cambodia.gov.kh",
+  "ប្រភពពីគេហទំព័ររដ្ឋាភិបាលខ្មែរ",
+  "ប្រភពពីវិទ្យាស្ថានសេដ្ឋកិច្ចកម្ពុជា",
+  "ធ្វើ",
+  "នេះ",
+  "ស្រុក",
+  "១៥",
+  "District",
+  "កម្ពុជា",
+  "ដោយ",
+  "បាន",
+  "០០០",
+  "ការ",
+  "រឺ",
+  "១១",
+  "ទី",
+  "២-",
+  "គេ",
+  "ជា",
+  "១៣",
+  "នោះ",
+  "ផល",
+  "១១ភូមិ",
+  "ABC",
+  "នាក់",
+  "នៅ",
+  "៣-",
+  "ខ្ញុំ",
+  "ជាឃុំមួយស្ថិតនៅក្នុងស្រុកស្អាង",
+  "មិន",
+  "លោក",
+  "ស.",
+  "អោយ",
+  "១-",
+  "១៤",
+  "១៩",
+  "២០",
+  "៩",
+  "a",
+  "ជាឃុំមួយស្ថិតនៅក្នុងស្រុកមង្គលបុរី",
+  "ថា",
+  "៤-",
+  "៥ភូមិ",
+  "៦ភូមិ",
+  "៨ភូមិ",
+  "កម្មសិទ្ធិករ",
+  "តើ",
+  "មនុស្ស",
+  "យើង",
+  "រៀល",
+  "៣ភូមិ",
+  "៧ភូមិ",
+  "កំពង់ស្ពាន",
+  "គ.ម",
+  "ចិន",
+  "ជាឃុំមួយស្ថិតនៅក្នុងស្រុកកណ្តាលស្ទឹង",
+  "ជាឃុំមួយស្ថិតនៅក្នុងស្រុកបាត់ដំបង",
+  "ប្រការ",
+  "១៦",
+  "២១",
+  "២៤",
+  "Chrov",
+  "b",
+  "ក្រោយអង្គរ",
+  "គេបាន",
+  "ជាឃុំមួយស្ថិតនៅក្នុងស្រុកអូរជ្រៅ",
+  "ជាតិ",
+  "ជាស្រុកមួយស្ថិតនៅក្នុងខេត្តសៀមរាប",
+  "ដូចនេះ",
+  "ទេ",
+  "ធ្នូ",
+  "នាង",
+  "នឹង",
+  "នៃ",
+  "នៃច្បាប់នេះ",
+  "នៅថ្ងៃទី",
+  "ផ្ទាំង​ទី",
+  "របស់",
+  "ស",
+  "សាសនា",
+  "អង្គ",
+  "១៨",
+  "៤ភូមិ",
+  "ខេត្ត",
+  "ខែមេសា",
+  "ខ្មែរ",
+  "គម",
+  "គឺជា",
+  "ជាឃុំមួយស្ថិតនៅក្នុងស្រុកកៀនស្វាយ",
+  "ជាឃុំមួយស្ថិតនៅក្នុងស្រុកពញាឮ",
+  "ជាឃុំមួយស្ថិតនៅក្នុងស្រុកសង្កែ",
+  "ជាឃុំមួយស្ថិតនៅក្នុងស្រុកស្វាយចេក",
+  "ថ្ងៃ",
+  "បើ",
+  "ប្រែថា",
+  "មានសិទ្ធិ",
+  "មួយ",
+  "វត្ត។",
+  "វ​ទី",
+  "ហៅថា",
+  "ឧទាហរណ៍",
+  "២៥",
+  "៩ភូមិ",
+  "A",
+  "Netr",
+  "Preah",
+  "c",
+  "m",
+  "កញ្ញា",
+  "គឺជា​",
+  "គ្រួសារ",
+  "ចាំ",
+  "ជាឃុំមួយស្ថិតនៅក្នុងស្រុកថ្មពួក",
+  "ជាឃុំមួយស្ថិតនៅក្នុងស្រុកព្រះនេត្រព្រះ",
+  "ជាឃុំមួយស្ថិតនៅក្នុងស្រុកម៉ាឡៃ",
+  "ដែរ",
+  "តាង",
+  "តុលាការ",
+  "ថ្ងៃទី",
+  "ធម៌",
+  "និង​",
+  "ប៉ុន្តែ",
+  "ប្រទេសកម្ពុជា",
+  "ពីរ",
+  "ព្រះសាស្តា",
+  "ភាសា",
+  "ភ្នំពេញ",
+  "រវាង",
+  "លើ",
+  "វប្បធម៌",
+  "សង្កាត់",
+  "សម្រាប់",
+  "ឧទា",
+  "២៣",
+  "២៦",
+  "៣០",
+  "ខេត្តកណ្ដាល",
+  "គ.",
+  "គ្មានជនណាម្នាក់",
+  "ចិត្ត",
+  "ជន",
+  "ជាឃុំមួយស្ថិតនៅក្នុងស្រុកតាខ្មៅ",
+  "ជាឃុំមួយស្ថិតនៅក្នុងស្រុកឯកភ្នំ",
+  "ជាស្រុកមួយស្ថិតនៅក្នុងខេត្តកណ្តាល",
+  "ដូច",
+  "ដូច្នេះ",
+  "ដូរ",
+  "ដើម្បី",
+  "តាម",
+  "ទាំង",
+  "បពិត្រព្រះឣង្គដ៏ចម្រើន",
+  "ផង",
+  "ពួកគេ",
+  "មនុស្សគ្រប់រូប",
+  "មេសា",
+  "លាននាក់",
+  "លើក",
+  "វា",
+  "សិទ្ធិ",
+  "ស្គាល់",
+  "ស្មើនឹង",
+  "ឡាវ",
+  "អាច",
+  "អារម្មណ៍",
+  "ៗ",
+  "០",
+  "១០ភូមិ",
+  "១៧",
+  "២០០៧",
+  "២០០៩",
+  "២២",
+  "២៧",
+  "២៩",
+  "3",
+  "B",
+  "i",
+  "n",
+  "x",
+  "y",
+  "ការងារ",
+  "កំពុង",
+  "ក្នុងឆ្នាំ",
+  "ក្នុង​",
+  "ខេត្តកំពង់ឆ្នាំង",
+  "ខេត្តព្រៃវែង",
+  "ខែធ្នូ",
+  "គ.ស.",
+  "គាត់",
+  "គាថា",
+  "គីឡូម៉ែត្រ",
+  "គូ",
+  "ឃុំកំពង់ស្វាយ",
+  "ឃុំប្រាសាទ",
+  "ឃុំរកា",
+  "ឃុំរលួស",
+  "ចំណាំ",
+  "ច្បាប់",
+  "ជាក្រលាផ្ទៃនៃត្រីកោណ",
+  "ជាឃុំមួយស្ថិតនៅក្នុងស្រុកកោះធំ",
+  "ជាឃុំមួយស្ថិតនៅក្នុងស្រុកបវេល",
+  "ជាឃុំមួយស្ថិតនៅក្នុងស្រុកភ្នំស្រុក",
+  "ជាឃុំមួយស្ថិតនៅក្នុងស្រុកសំពៅលូន",
+  "ជាឈ្មោះឃុំមួយក្នុង",
+  "ជាស្រុកមួយរបស់ខេត្តឧត្តរមានជ័យ",
+  "ជាស្រុកមួយស្ថិតនៅក្នុងខេត្តតាកែវ",
+  "ជា​",
+  "ជួន",
+  "ជួន ណាត",
+  "ដើម",
+  "ណា",
+  "ណាត",
+  "តាងដោយ",
+  "តែ១ដងជាអប្បនាជវន",
+  "ត្រីកោណ",
+  "ត្រូវទទួលទោសរដ្ឋបាលថែមទៀត",
+  "ទីក្រុងភ្នំពេញ",
+  "ទុក្ខ",
+  "នាទី",
+  "និយាយ",
+  "និស្សិត",
+  "នៅគ",
+  "បន្ទាត់",
+  "បន្ទុក",
+  "ប្រឆាំង",
+  "ប្រទេស",
+  "ប្រាំ",
+  "ប្រាំមួយ",
+  "ផ្ដន្ទាទោសដាក់ពន្ធនាគារពី",
+  "ពាក្យ​ថា",
+  "ពួក",
+  "ពេល",
+  "ព្រះពោធិសត្វទាំងនោះ",
+  "មាត្រា",
+  "មានន័យថា",
+  "មានព្រះពុទ្ធត្រាស",
+  "មិនា",
+  "មុននឹងវារលាយទៅ",
+  "រូប",
+  "វៀតណាម",
+  "សាន",
+  "សាលាក្តី",
+  "សុខ",
+  "សូត្រ",
+  "សេដ្ឋកិច្ច",
+  "ហេតុនេះ",
+  "អស់",
+  "អ៊ីរ៉ង់",
+  "អ្នកស្រី",
+  "០០",
+  "១៤ភូមិ",
+  "២៨",
+  "៦%",
+  "AD",
+  "C",
+  "D",
+  "O",
+  "R",
+  "Shaw",
+  "Veng",
+  "and",
+  "function",
+  "g",
+  "k",
+  "p.",
+  "«កូន​អើយ",
+  "«អើ",
+  "កក្កដា",
+  "កប្ប",
+  "ការពារ",
+  "កុម្ភៈ",
+  "កូស៊ីនុស",
+  "កើត",
+  "កើតឡើង",
+  "ក្នុងគណិតវិទ្យា",
+  "ក្បាល",
+  "ក្រាបទូលថា",
+  "ខេត្តកោះកុង",
+  "ខេត្តតាកែវ",
+  "ខេត្តព្រះត្រពាំង",
+  "ខែកញ្ញា",
+  "ខែតុលា",
+  "ខែមករា",
+  "ខ្មែរក្រហម",
+  "គឹម",
+  "គឺជាស្រុកមួយនៃ",
+  "គុយរី",
+  "ឃុំជ្រៃ(ស្រុក",
+  "ឃុំឈើទាល",
+  "ចំនួន",
+  "ចំពោះ",
+  "ជនគ្រប់រូប",
+  "ជនណា",
+  "ជប៉ុន",
+  "ជាឃុំមួយស្ថិតនៅក្នុងស្រុកសិរីសោភ័ណ",
+  "ជាឈ្មោះស្រុកក្នុងខេត្តព្រៃវែង",
+  "ជាទុក្ខ",
+  "ជាបច្ច័យ",
+  "ជាប្រធាន",
+  "ជាភាសាអង់គ្លេស",
+  "ជាមួយ",
+  "ឈូងសមុទ្រថៃ",
+  "ដក",
+  "ដល់ទី",
+  "ដូចជា",
+  "ដូចម្តេច",
+  "ដែលកើតឡើង",
+  "តាកែវ",
+  "តាជីគីស្ថាន",
+  "ថៃ",
+  "ថ្ងៃ​ទី",
+  "ថ្នាក់ទី",
+  "ទៀត",
+  "ទេវតា",
+  "ទ្រង់ត្រាស់ថា",
+  "នាំអោយ",
+  "និងមាត្រា",
+  "នីតិវិធី",
+  "នួន",
+  "នែនាងកុមារិកា",
+  "នៃច្បាប់",
+  "នៃមាត្រា",
+  "នៃ​គ",
+  "នៅឆ្នាំ",
+  "បញ្ញា",
+  "បញ្ហា",
+  "បាត់ដំបង",
+  "បំពេញមុខងារ",
+  "ប៉ុណ្ណោះ",
+  "ប្រការនេះ",
+  "ប្រជាពលរដ្ឋ",
+  "ប្រភេទ",
+  "ផែនដី",
+  "ផ្ទាល់",
+  "ពួកធម៌ក្នុងវគ្គនេះ",
+  "ព្រះ",
+  "ព្រះថេរៈ",
+  "ព្រះពុទ្ធសាសនា",
+  "ព្រះសម្មាសម្ពុទ្ធ",
+  "ព្រះសិវៈ",
+  "ព្រះអង្គ",
+  "ភិក្ខុទាំងឡាយ",
+  "ភូមិ។",
+  "មករា",
+  "មគ្គ",
+  "មធ្យមធរណីមាត្រ",
+  "មន្ត្រី",
+  "មានចំងាយ",
+  "យុត្តិធម៌",
+  "យ៉ាង",
+  "រ.",
+  "វគ្គ",
+  "វស្សា",
+  "វិញ",
+  "វិញ្ញាណ",
+  "សម្លាប់",
+  "សហជីព",
+  "សិទ្ធិប្រើប្រាស់",
+  "សៀមរាប",
+  "សៀវភៅ​លេខ",
+  "សេវភាព",
+  "ស៊ីនុស",
+  "ស្របនឹង",
+  "ស្រុកកៀនស្វាយ",
+  "ស្រុកនេះត្រូវបានបែងចែកទៅជា",
+  "ស្រុកនេះមាន៦ឃុំ",
+  "ស្រះ​ទី",
+  "ស្វាមី",
+  "ហ្វីលីពីន",
+  "ឡើង",
+  "អ",
+  "អង្គការ",
+  "អនត្តា",
+  "អាស្រ័យនៅ",
+  "អាឡេវ​ថា",
+  "អំណាចតុលាការ",
+  "អ៊ូបេគីស្ថាន",
+  "អ្នក",
+  "ឥណ្ឌូនេស៊ី",
+  "ឥន្ទ្រិយ",
+  "ឧបទ្វីបម៉ាឡេ",
+  "ឬស្មើនឹង",
+  "។ល។",
+  "១២ភូមិ",
+  "១៥ភូមិ",
+  "១៩០៨",
+  "១៩៥៣",
+  "១៩៦៦",
+  "១៩៧០",
+  "២%",
+  "៣៤",
+  "៥-",
+  "៥០",
+  "៦-",
+  "៧-",
+  "1",
+  "350px",
+  "5",
+  "AB",
+  "AH2",
+  "AH3",
+  "AH42",
+  "AH6",
+  "AH64",
+  "AH67",
+  "AH7",
+  "AH78",
+  "AH81",
+  "AH82",
+  "AH84",
+  "BC",
+  "BE",
+  "BG",
+  "Bernoulli",
+  "Brahmagupta",
+  "CF",
+  "Cambodia",
+  "China",
+  "Erythrina",
+  "Excenter",
+  "G",
+  "GE",
+  "H",
+  "I",
+  "Money",
+  "OC",
+  "Prey",
+  "Riemann",
+  "Titre",
+  "V",
+  "VB",
+  "by",
+  "cosh",
+  "http://cchrcambodia",
+  "of",
+  "polynomial)។",
+  "pp.",
+  "sinh",
+  "standard",
+  "stiffness",
+  "t",
+  "triangle",
+  "«ខ្ញុំ​បាន​ពឹង​អ្នក​ស្រុក",
+  "«ជីក​ឯណា​កើត",
+  "«ឈប់​បង",
+  "«បើ​ចិក​ចង់​បាន",
+  "«អ្នក​អើយ​អ្នក",
+  "«ឪអើយ",
+  "«ឯង​ធ្វើ​តម្រុយ​បែប​ណា",
+  "«ឱលោក",
+  "ក.",
+  "ក.ក.",
+  "កករ",
+  "កក្តដា",
+  "កម្ពុជាប្រជាធិបតេយ្យ",
+  "ករៗ",
+  "កាត់",
+  "ការចេញប័ណ្ណកម្មសិទ្ធិខុស",
+  "ការឈឺចិត្ត",
+  "ការថា",
+  "ការបិទបាំងហ៊ីប៉ូតែក",
+  "ការប៉ះនៃ",
+  "ការភ្ញាក់រលឹករបស់លោកអាចារ្យ",
+  "ការ​កូរ​សមុទ្រ​ទឹក​ដោះ​",
+  "ការ​ស្ថាបនា​ព្រះរាជវាំង​នៅ​ទីក្រុង​ភ្នំពេញ​មាន​ពីរ​លើក",
+  "កាលណាអារម្មណ៍របស់វិញ្ញាណ",
+  "កាល​ពី​ព្រេង​នាយ",
+  "កាហ្សាក់(អាហ្ស៊ែរបៃហ្សង់",
+  "កាំ",
+  "កិច្ច",
+  "កិច្ច​សហការ",
+  "កីឡាករចំនួន",
+  "កីឡាបើកឆាកមាន",
+  "កុមារ​ប្អូន​ថយ​ចេញ​ពី​កន្លែង​នោះ​មិន​ឆ្ងាយ​ប៉ុន្មាន",
+  "កុំមានរបស់ដទៃជាទីពឹងឡើយ",
+  "កូរ៉េ",
+  "កូអរដោនេក្នុងតំរុយដេកាតគឺ",
+  "កើតមកមានសេរីភាព",
+  "កើតឡើងដូចលេខ១ខាងលើដែរ",
+  "កោះស៊ូម៉ាត្រា",
+  "កំណើត",
+  "កំពុង​តែ​ទឹម​គោ​ភ្ជួរ​ស្រែ",
+  "ក៏កើតឡើង",
+  "ក៏មកដល់មុខសាលាបាលីជាន់ខ្ពស់",
+  "ក៏​ម្នីម្នា​រៀប​ធ្វើ​អន្សម​នំ​គម​ចំណី​ចំណុក",
+  "ក៏​រឹង​រឹត​តែ​ញាប់​ញ័រ",
+  "ក្នុងករណីមិនរាងចាល",
+  "ក្នុងទី",
+  "ក្នុងនោះ",
+  "ក្នុងផ្នែកសេចក្ដីថ្លៃថ្នូរ",
+  "ក្នុងស្មារតី",
+  "ក្នុងអាស៊ីខាងកើត",
+  "ក្រចេះ",
+  "ក្រសួង​អប់​រំ",
+  "ក្រហម",
+  "ក្រោយមក",
+  "ក្រៅពីនេះ",
+  "ក្រៅពីនេះមានជនជាតិចិន",
+  "ខ-គណនា",
+  "ខន្ធកៈ",
+  "ខេត្តកំពង់ធំ",
+  "ខេត្តកំពត",
+  "ខេត្តក្រចេះ",
+  "ខេត្តមួយនៃប្រទេសកម្ពុជា",
+  "ខេត្តស្ទឹងត្រែង",
+  "ខេត្តស្វាយរៀង",
+  "ខេត្ត​នេះ​ត្រូវ​បានបែង​ចែកជា​",
+  "ខែកក្កដា",
+  "ខែមិនា",
+  "ខែមីនា",
+  "ខែឧសភា",
+  "ខ្ញុំព្រះករុណាទាំងឡាយ",
+  "ខ្ញុំម្ចាស់មិនដឹងទេ",
+  "ខ្ញុំម្ចាស់សូមថ្វាយព្រះបង្គំលាហើយ",
+  "ខ្លួនឯង",
+  "ខ្លះ",
+  "ខ្សែបន្តជីវិត",
+  "គ.ស",
+  "គណបក្ស",
+  "គណិតវិទ្យា",
+  "គម្ពីរទីឃនិកាយ",
+  "គម្ពីរ​នេះ​ផ្តើម​ដោយ​សេចក្តី​លំអិត​អំពី​ការ​បង្កើត​",
+  "គឺជាអនុគមន៍ចំនួនកុំផ្លិចដូចខាងក្រោម",
+  "គឺជាអនុគមន៍អិចស្បូណង់ស្យែលកុំផ្លិច។",
+  "គឺជា​ទ្វីប​ធំជាងគេ​ទី២",
+  "គឺថា",
+  "គឺថាត្រូវដឹងខ្លួនជានិច្ចថា",
+  "គឺ​",
+  "គុណនឹង",
+  "គេមានចំនួន",
+  "គេមានបន្ទាត់",
+  "គេ​ត្រូវ​យក​សញ្ញា",
+  "គេ​មាន​ចំនុច",
+  "គោរព",
+  "គ្រប់គ្នា",
+  "គ្រាន់​តែ​នឹក​ក្នុង​ពោះ​ប៉ុណ្ណោះ",
+  "គ្រឿង",
+  "ឃុំកោះធំ",
+  "ឃុំកំពង់សីលា៖",
+  "ឃុំតាប៉ុន",
+  "ឃុំពន្លៃ(ស្រុកភ្នំស្រុក",
+  "ឃុំមោង",
+  "ឃុំមោង៖",
+  "ឃុំម៉ាឡៃ",
+  "ឃុំសំបួរ",
+  "ឃុំសំពៅលូន",
+  "ឃុំស្វាយជ្រុំ",
+  "ឃុំអូរដំបង",
+  "ឃើម៉ាន់(អ៊ីរ៉ង",
+  "ឃោរឃៅ",
+  "ងាកទៅរកទ្វារវិញ្ញាណ",
+  "ចក្ខុវិញ្ញាណ",
+  "ចតុកោណកែង",
+  "ចប់",
+  "ចាប់ពីថ្ងៃទី",
+  "ចាប់​ពី​សៀវភៅ​លេខ",
+  "ចាប់​​ពី​​សៀវភៅ​​លេខ",
+  "ចាស់",
+  "ចិត្តទទួលយក",
+  "ចិត្តបែរទៅរកទ្វារវិញ្ញាណ៥",
+  "ចិន​ឆ្លើយ​ថា",
+  "ចិន​ថា",
+  "ចុះ",
+  "ចូលរួម",
+  "ចៀវ",
+  "ចេញ",
+  "ចំងាយពីអ័ក្ស",
+  "ចំនុចនឹងពីរនោះហៅថាកំនុំ",
+  "ចំនួនកុំផ្លិច",
+  "ចំនួនគត់",
+  "ចំពោះមនុស្សម្នាក់",
+  "ច្រកចូហរ",
+  "ច្រកម៉ាឡាកា",
+  "ច្រកសិង្ហបុរី",
+  "ឆាប់",
+  "ឆ្នាំ១៩៨៩",
+  "ឆ្នាំ២០០៣",
+  "ឆ្នាំ២០១០",
+  "ឆ្នាំ២០១២",
+  "ជនជាតិម៉ាឡេ។",
+  "ជរា",
+  "ជាឃុំមួយស្ថិតនៅក្នុងស្រុក​ថ្មគោល",
+  "ជាចំណោលកែងនៃ",
+  "ជាចំនួនពិត។",
+  "ជាឈ្មោះឃុំមួយក្នុងស្រុកកំពង់សីលា",
+  "ជាឈ្មោះស្រុកក្នុងខេត្តកោះកុង",
+  "ជាដើម",
+  "ជាតំណាងព្រះអង្គ",
+  "ជាតំបន់ផលិតអាភៀនដ៏ធំមួយក្នុងចំនោមតំបន់ផលិតអាភៀនទាំង២​នៅអាស៊ី។",
+  "ជាត្រីកោណសមបាត",
+  "ជាន់លើ",
+  "ជាបច្ច័យឲ្យកើតឡើង",
+  "ជាផលរបស់",
+  "ជាមេគុណប្រាប់ទិសនៃបន្ទាត់",
+  "ជាវិភវតណ្ហា",
+  "ជាសាសនារបស់រដ្ឋ។",
+  "ជាស្រុកមួយស្ថិតនៅក្នុងខេត្តបន្ទាយមានជ័យ",
+  "ជាស្រុកមួយស្ថិតនៅក្នុងខេត្តបាត់ដំបង",
+  "ជាអនុគមន៍នៃn",
+  "ជាឧបទ្វីបដ៏សំខាន់១នៅអាស៊ីអាគ្នេយ៍",
+  "ជុំ",
+  "ជូឡុង",
+  "ជំនួយ",
+  "ជំនឿ",
+  "ជ្រៅ",
+  "ឈ្មោះ",
+  "ឈ្មោះដើម",
+  "ញឹក",
+  "ដល់ចំនុចដែលមានតំលៃអានន្ត។",
+  "ដល់ចំនុចត្រង់អានន្ត។",
+  "ដល់ពេលយើងបានស្ដាប់អាន",
+  "ដល់​",
+  "ដីលើ",
+  "ដូង",
+  "ដូចគ្នាដែរ",
+  "ដូច​ជា",
+  "ដូមីនិក",
+  "ដើម្បី​កុំ​ឲ្យ​វណ្ណយុត្តិ​នេះ",
+  "ដេ",
+  "ដែនទឹកដែលព័ទ្ឋជុំវិញ",
+  "ដែរ។",
+  "ដែលជាជនជាតិឥណ្ឌា។",
+  "ដែលជារបស់កម្មសិទ្ធិករផ្សេងទៀត",
+  "ដែលតែងពិគ្រោះគ្នាអំពីបញ្ហាជាតិ",
+  "ដែលបានកំណត់ក្នុងមាត្រា",
+  "ដែលមានបង្កប់នូវអាថ៌កំបាំងយ៉ាងជ្រៅ",
+  "ដែលមុំ",
+  "ដែល​ជា​​សាវក​របស់​ព្រះ​វិស្ណុ​",
+  "ដែល​ដាក់​ពី​លើ",
+  "ដែល​និយាយ​អំពី​",
+  "ដោត​ថើ្លម​អាខូច​នេះ​អាំង​ស៊ី»",
+  "ដោយមិនគិតដល់ព្យសនកម្ម",
+  "ដោយសារ",
+  "ដោយសេរី",
+  "ដោះ",
+  "តទាលម្ពណចិត្ត២",
+  "តទៅទៀត",
+  "តាកាឡូ",
+  "តាមដងផ្លូវជាតិលេខ៥",
+  "តាមប្រពៃណី",
+  "តាមអំពើចិត្តឡើយ។",
+  "តិច",
+  "តុលា",
+  "តើអ្នកនគរនេះនិងមានបាបកម្មយ៉ាងណាទៅថ្ងៃអនាគត",
+  "តើ​ឲ្យ​ប្រាក់​អញ​ប៉ុន្មាន",
+  "តែ",
+  "តែតាមពិតគឺនគរប្រទេសដែលយើងកើត",
+  "តែ​ក្នុងចិត្ត​នឹក​ខ្នាញ់​ពេក​ណាស់",
+  "តែ​មិន​ស្ថិតស្ថេរ",
+  "តំបន់ជួរភ្នំព័ទ្ធជុំវិញតំបន់នេះ​មានរាងជាអឌ្ឍច័ន្ទ",
+  "តំបន់អឌ្ឍច័ន្ទមាស",
+  "ត្រូវបានចាប់ខ្លួន",
+  "ត្រូវបានចែកចេញជា",
+  "ត្រូវ​សង្កត់​សំឡេង​លើ​ព្យាង្គ",
+  "ថា៖",
+  "ថា​ដូច​ម្តេចៗ​ឡើយ",
+  "ថ្ងៃពុធ",
+  "ថ្នាក់",
+  "ថ្លៃគ្រប់គ្រង",
+  "ទទួល",
+  "ទទួលការការពារ",
+  "ទទួលយក",
+  "ទន្លេមេគង្គកម្ពុជាមានប្រវែង",
+  "ទាក់ទង",
+  "ទាយាទ",
+  "ទាំងអស់",
+  "ទីរួមខេត្តរបស់ខេត្តនេះគឺ",
+  "ទឹក",
+  "ទឹកដី",
+  "ទុក្ខវេទនា",
+  "ទុក្ខំ",
+  "ទើបគេដាក់ឈ្មោះវាបែបនេះ។",
+  "ទើស​ទែង​គ្នា​ជា​មួយ​ស្រៈ​ខាង​លើ",
+  "ទេ។",
+  "ទោសភាព",
+  "ទៅនឹងចំនុចនឹងពីរជាចំនួនថេរ(ស្មើនឹង",
+  "ទៅបារីសង់",
+  "ទៅព្រំដែនតួរគី-ប៊ុលហ្គារី",
+  "ទៅឲ្យចិត្តមួយទៀត",
+  "ទៅ​ឈរ​មើល​យក្ស​ស៊ី​ដំរី",
+  "ទៅ​រក​កាប់​ឫស្សី​មក​ធ្វើត្រណោត​",
+  "ទំនង",
+  "ទ័ពរថ",
+  "ទ្រង់ត្រាស់តទៅទៀតថា",
+  "ទ្រឹស្តីបទពីតាករ",
+  "ទ្វីបអាស៊ី",
+  "ធ",
+  "ធនលាភ",
+  "ធីតាកបិលមហាព្រហ្ម",
+  "ធ្នើ",
+  "នគរអោយកុលបុត្រកុលធីតាប្រុសស្រី",
+  "នគរូបនីយកម្ម",
+  "នា",
+  "នាង​ង៉ោះ​ឮ​កូន​ថា​ដូច្នោះ",
+  "នាទី។",
+  "នាមជីវចល",
+  "នាយជាតិ",
+  "នាវាចំបាំងដឹកអ្នកទោសនេះ",
+  "និងពី",
+  "និងមួយបំណែកទៀតពី",
+  "និងយុត្តិធម៌",
+  "និង​រឿង​របស់​ស្តេច​កាល​ពី​ព្រេង​នាយ​ឈ្មោះ",
+  "និង​អសុ​រៈ",
+  "និព្វាន",
+  "នីតិកាលទី១",
+  "នីតិបុគ្គល",
+  "នឹងបានត្រាស់ជាព្រះពុទ្ធ",
+  "នេះឈ្មោះថា",
+  "នេះហើយ",
+  "នៃកតិកាសញ្ញានេះ",
+  "នៃការត្រាស់ដឹង",
+  "នៃកូនបំណុល",
+  "នៃ​",
+  "នោះគេបាន",
+  "នោះទេ",
+  "នៅក្នុងឆ្នាំ",
+  "នៅក្នុងប្លង់ដែលមានផលបូកនៃចំងាយរវាងចំនុច",
+  "នៅពេលដែល",
+  "នៅ​គ្រិស្ត​សតវង្ស​ទី​១៩",
+  "នៅ​គ្រិស្ត​សតវត្ស​ទី​១៥",
+  "បក",
+  "បកស្រាយពន្យល់ទើបយើងដឹងថា",
+  "បង់ក្លាដែស្ស",
+  "បង្កើត",
+  "បញ្ចក្ខន្ធ",
+  "បញ្ចទ្វារាវជ្ជនៈ",
+  "បញ្ញត្តិ",
+  "បដិបត្តិ​បូជា",
+  "បណ្តឹង",
+  "បណ្តុះឫសគុណធម៌",
+  "បន្តិចក្រោយមក",
+  "បន្ទាត់ប្រាប់ទិស",
+  "បន្ទាប់ពីបានទទួលការព្យាករណ៍",
+  "បន្ទាប់មក",
+  "បន្លែ",
+  "បរិវារសព្ទ",
+  "បរៗ",
+  "បា.",
+  "បានឆ្លើយថា",
+  "បានសួរព្រះថេរៈ",
+  "បានឡើយ។",
+  "បារាំង",
+  "បីតិ",
+  "បីលាន",
+  "បុគ្គល",
+  "បុព្វជន",
+  "បុរស",
+  "បុរស​ប្តី​ប្រពន្ធ​នោះ",
+  "បើគេអោយ",
+  "បើ​",
+  "បើ​អ្នក​ឯ​ណា",
+  "បេតិកភណ្ឌ",
+  "បំណង",
+  "ប៉ាគីស្ថាន",
+  "ប៉ាស្កាល់",
+  "ប៉ូស",
+  "ប៉េត្រូប៉ាវឡូវស្គ៍(កាហ្សាក់ស្ថាន",
+  "ប៉ែន",
+  "ប្បវេណី",
+  "ប្រការគឺ",
+  "ប្រជាជនម៉ាឡេស៊ីមានប្រមាណ",
+  "ប្រទេសចិន",
+  "ប្រធាន",
+  "ប្រសព្វគ្នាត្រង់",
+  "ប្រហែលគ្នានឹង",
+  "ប្រាំបួនលាន",
+  "ប្រាំលាន",
+  "ប្អូន​និយាយ​ថា",
+  "ប្ឫឋុ",
+  "ផង​គ្នា",
+  "ផលទុន",
+  "ផលុបភោគ",
+  "ផស្សៈ",
+  "ផ្លែដូង",
+  "ផ្សេងៗ",
+  "ព.",
+  "ព.ស.",
+  "ពណ៌",
+  "ពត៌មាន",
+  "ពន្យល់",
+  "ពលកម្ម",
+  "ពាក្យ",
+  "ពាក្យ​នេះ",
+  "ពិត",
+  "ពីទីរួមខេត្តកំពង់ឆ្នាំង",
+  "ពីមុនយើងតែងច្រឡំថាបាយមានគុណ",
+  "ពុទ្ធសាសនា",
+  "ពេល​នោះ​យក្ស​សួរ​ថា",
+  "ពោល​គឺ",
+  "ព្យែរ",
+  "ព្រោះ",
+  "ព្រោះបុព្វជនមេនេះបានទុកទឹកដី",
+  "ព្រំដែនកាហ្សាក់ស្ថាន",
+  "ព្រះជន្ម",
+  "ព្រះនិព្វាន",
+  "ព្រះពោធិសត្វ",
+  "ព្រះសង្ឃ",
+  "ព្រះសម្មាសម្ពុទ្ធទ្រង់សម្តែងអំពី",
+  "ព្រះសីហនុ",
+  "ព្រះសូត្រ",
+  "ព្រះអនិច្ចំ",
+  "ព្រះ​អង្គ​ដួង",
+  "ភយតូបដ្នានញ្ញាណ",
+  "ភវង្គចលនៈ",
+  "ភាគ",
+  "ភាគច្រើននៃប្រជាជនម៉ាឡេស៊ីជា",
+  "ភាគរយ",
+  "ភាតរភាពជាបងប្អូន។",
+  "ភាព",
+  "ភាសាបារាំង",
+  "ភាសាប្រើប្រាស់ផ្លូវការគឺភាសាម៉ាឡេ។",
+  "ភិក្ខុ",
+  "ភូមា",
+  "ភូមិ",
+  "ភ្នំក្រាំងរមាស​មានទីតាំងស្ថិតនៅចន្លោះឃុំស្រែថ្មី",
+  "ភ្លឺ",
+  "ម.",
+  "មក",
+  "មនុស្សទាំងអស់",
+  "មហាតលិក",
+  "មាត់",
+  "មានឈ្មោះថា",
+  "មានតាំងពីលោកនៅជាសិស្សសាលាបាលីជាន់ខ្ពស់ម៉្លេះ",
+  "មានប្រវែង",
+  "មានពីរបំណែកពី",
+  "មានសមីការ",
+  "មាន​ចិត្ត​ជ្រះ​ថ្លា​សទ្ធា​បាន​ភាវនា​គិត​នឹក​ដល់​ព្រះ",
+  "មាន​ទីតាំង​នៅ​ចំ​កណ្ដាល​",
+  "មាន​ន័យ​ថា",
+  "មាន​បុរស​ប្តី​ប្រពន្ធ",
+  "មាន​ផ្ទៃក្រឡា​ប្រហែល",
+  "មិនដឹងថ្ងៃណាបានជួបវិញទេ",
+  "មិន​ទាន់​ចេញ​ស្តី",
+  "មិន​សល់​ក្រ​អ្វី​នឹង​អញ្ជើញ​ទៅ​ឯនគរ​ខ្ញុំ​នោះ​ទេ",
+  "មីន",
+  "មុខ",
+  "មូលីវណ្ណ",
+  "មួយ។",
+  "មើល",
+  "មោងឫស្សី)ជាឃុំមួយស្ថិតនៅក្នុងស្រុក​មោងឫស្សី",
+  "ម៉ារី",
+  "ម៉ារី(តួរមិនគីស្ថាន",
+  "ម៉ាឡេស៊ី",
+  "ម៉ែ",
+  "ម៉ោង",
+  "ម្ចាស់​ជំនួយ",
+  "ម្នាក់",
+  "ម្យ៉ាងវិញទៀត",
+  "ម។",
+  "យីហ៊ុប",
+  "យ៉ាងណាមិញ",
+  "យ៉ាងហោចណាស់",
+  "យ៉ាង​គឺ",
+  "យ៉េរ៉េវ៉ាន់(អារមឺនៀ",
+  "រង់",
+  "រង្វង់ត្រីកោណមាត្រ",
+  "រជ្ជកាលព្រះបាទ​នរោត្តមទើប​ស្ថិតស្ថេរ​។",
+  "រជ្ជកាលព្រះបាទ​ពញាយ៉ាត",
+  "រដ្ឋ",
+  "រដ្ឋភាគី",
+  "របង",
+  "របស់ខ្លួន",
+  "រស់",
+  "រស់នៅសព្វថ្ងៃនេះទេ",
+  "រាជធានី",
+  "រាប់ចូលជាការរំលោភ",
+  "រាប់តាមទិសទ្រនិចនាឡិកា)មាន",
+  "រឺទេ",
+  "រូបារម្មណ៍ព្រមទាំងផស្សៈ",
+  "រឿងទៀតគឺ",
+  "រឿង​ធ្រុវៈ",
+  "រឿង​ព្រេង​អំពី​រុទ្រៈ​",
+  "រៀងគ្នាមកលើបន្ទាត់",
+  "រោច",
+  "ល",
+  "លក្ខណៈ",
+  "លាន",
+  "លាន​ឆ្នាំ",
+  "លី",
+  "លើក​ទី​២",
+  "លែង",
+  "លោកអភិសិទ្ធិ",
+  "វណ្ណ",
+  "វណ្ណ មូលីវណ្ណ",
+  "វប្បធម៌។",
+  "វាឃើញរូបារម្មណ៍",
+  "វាដាច់ចេញពីភវង្គ",
+  "វាដំណើរការឥតខ្ចោះនៅចន្លោះពី",
+  "វាទទួលយក",
+  "វាបង្កើតផស្សៈ",
+  "វាផ្ទៀតផ្ទាត់នឹងរូបមន្តអឺលែរដែល",
+  "វាពិតនីក្នុងបំណែកប្លង់កុំផ្លិច។",
+  "វា​ត្រូវ​បាន​គូរ​ប្លង់​ដោយ​ស្ថាបត្យករ​ខ្មែរ​ដ៏​ល្បី​គឺ​​លោក",
+  "វិញ្ញាណរបស់ភ្នែក",
+  "វេនៈ",
+  "វេយ្យាករណ៍",
+  "វេយ្យាករណ៍​ខ្មែរ",
+  "សងា្កត់",
+  "សង្គម",
+  "សន្តាន",
+  "សមាធិ",
+  "សមាធិ​",
+  "សមុទ្រចិនខាងត្បូង",
+  "សមុទ្រអង់ដាម៉ង់",
+  "សមុទ្រ​មថនៈ",
+  "សម្បដិច្ឆនៈ",
+  "សម្បើម",
+  "សម្ពន្ធ​មិត្ត",
+  "សម្រាប់​ស្ដេច​ចក្រ​ពត្តិ",
+  "សម្រេច",
+  "សម្លេងនោះជា",
+  "សហាតិមាត្រ",
+  "សាធារណរដ្ឋខ្មែរ",
+  "សាលាសាសនា",
+  "សាវីយ៉ូ",
+  "សាស",
+  "សាសនាឥស្លាមជាសាសនាធំជាងគេនៅម៉ាឡេស៊ី",
+  "សិទ្ធិចាត់ចែងលើទ្រព្យ",
+  "សិទ្ធិមនុស្ស",
+  "សិទ្ធិវន្ត",
+  "សីហា",
+  "សឺន",
+  "សឺន សាន",
+  "សុគតនៅក្នុងពន្ធនាគារ",
+  "សូមកុំឲ្យខ្ញុំបានត្រាស់ពេញបរិបូណ៌",
+  "សូមទ្រង់បញ្ជូនមេទ័ពទី",
+  "សូមមើលទំព័រ",
+  "សួរ",
+  "សួរ​ថា",
+  "សួរ​ទៅ​អាប៉ាង​ថា",
+  "សេរីភាព",
+  "សេរីសុទ្ឋា",
+  "សំគាល់៖",
+  "សំណង់",
+  "សំរាប់",
+  "សំរាយបញ្ជាក់",
+  "សំអឿន",
+  "ស៊ីជម្ពូខ្ចីដូចជើងហង្ស",
+  "ស៊ីមេទ្រី​ធំ",
+  "ស្ករតាំងម៉ែ",
+  "ស្តាយខានឃើញមុខឧបាសកឧបាសិកា",
+  "ស្ទឹងត្រែង",
+  "ស្មើៗគ្នា",
+  "ស្មើ២ដង",
+  "ស្រុកកណ្តាលស្ទឹង)នេះមាន",
+  "ស្រុកកៀនស្វាយ)នេះមាន",
+  "ស្រុកកំពង់លាវ",
+  "ស្រុកកំពង់សីលា",
+  "ស្រុកកំពង់សៀម",
+  "ស្រុកឆ្លូង",
+  "ស្រុកនេះមាន១២ឃុំ",
+  "ស្រុកនេះមាន១៤ឃុំ",
+  "ស្រុកនេះមាន៩ឃុំ",
+  "ស្រុកបាណន់",
+  "ស្រុកព្រះស្ដេច",
+  "ស្រុកម៉ាឡៃ",
+  "ស្រុករលាប្អៀរ",
+  "ស្រុកសិរីសោភ័ណ",
+  "ស្រុកសំរោង",
+  "ស្រុកស្អាង",
+  "ស្រុកអង្គរបុរី",
+  "ស្រុកអន្លង់វែង",
+  "ហត្ថលេខា",
+  "ហិកតា",
+  "ហូរកាត់ប្រទេស",
+  "ហើយបញ្ជូនផស្សៈនោះ",
+  "ហើយហៅវាជា",
+  "ហើយ​និយាយ​នឹង​អាឡេវ​ថា",
+  "ហេតុដូច្នេះ",
+};
+const uint16_t WA_FREQ_78_RANKS[] = {
+  231, 0, 0, 84, 186, 640, 568, 0, 0, 0, 874, 0, 0, 0, 944, 198,
+  67, 599, 128, 0, 10, 0, 0, 512, 0, 0, 727, 309, 454, 647, 20, 355,
+  732, 914, 0, 712, 489, 839, 885, 22, 756, 823, 0, 0, 0, 698, 76, 0,
+  677, 433, 0, 0, 0, 331, 0, 870, 0, 0, 0, 602, 0, 0, 0, 9,
+  319, 613, 875, 921, 826, 0, 511, 0, 825, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 55, 0, 0, 0, 0, 919, 0, 0, 0, 0, 980, 0, 396, 416,
+  277, 824, 0, 0, 0, 0, 0, 0, 561, 910, 0, 0, 781, 0, 0, 0,
+  62, 0, 0, 0, 0, 0, 0, 341, 0, 0, 18, 738, 0, 590, 0, 0,
+  0, 70, 0, 0, 0, 748, 0, 0, 0, 0, 0, 0, 0, 0, 373, 431,
+  713, 366, 720, 688, 739, 203, 105, 754, 753, 421, 320, 346, 540, 881, 597, 971,
+  0, 0, 985, 611, 911, 0, 0, 529, 617, 0, 917, 0, 783, 0, 850, 0,
+  127, 0, 268, 537, 579, 0, 0, 0, 0, 498, 0, 0, 323, 188, 29, 457,
+  652, 0, 0, 0, 100, 233, 795, 533, 0, 0, 367, 886, 257, 0, 0, 0,
+  302, 504, 581, 0, 0, 0, 253, 156, 381, 673, 377, 168, 626, 583, 909, 350,
+  973, 0, 90, 184, 806, 178, 689, 383, 173, 337, 730, 0, 0, 0, 0, 0,
+  0, 238, 593, 695, 496, 607, 0, 0, 290, 409, 0, 304, 330, 0, 0, 0,
+  0, 245, 0, 237, 332, 374, 849, 0, 334, 770, 262, 0, 0, 0, 536, 0,
+  0, 122, 435, 563, 958, 0, 0, 0, 0, 202, 0, 592, 0, 926, 0, 0,
+  675, 0, 21, 621, 0, 0, 0, 0, 715, 180, 904, 711, 0, 102, 0, 73,
+  240, 490, 110, 803, 0, 631, 832, 0, 0, 0, 0, 0, 717, 201, 269, 0,
+  0, 0, 658, 0, 0, 997, 899, 0, 549, 0, 624, 87, 651, 916, 147, 950,
+  0, 0, 121, 0, 0, 36, 0, 0, 0, 0, 0, 0, 0, 0, 610, 0,
+  0, 0, 372, 0, 370, 7, 185, 668, 0, 955, 0, 4, 0, 0, 901, 0,
+  0, 172, 812, 0, 0, 0, 0, 0, 0, 576, 0, 714, 0, 0, 0, 0,
+  14, 91, 0, 0, 135, 0, 0, 0, 0, 0, 226, 458, 133, 0, 0, 0,
+  52, 866, 0, 0, 0, 0, 83, 0, 0, 848, 0, 0, 0, 699, 979, 0,
+  358, 520, 0, 805, 0, 0, 0, 0, 0, 967, 0, 544, 627, 682, 693, 155,
+  405, 992, 0, 71, 690, 787, 0, 502, 491, 619, 667, 636, 828, 0, 573, 0,
+  578, 945, 556, 0, 0, 0, 57, 111, 0, 23, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 169, 0, 49, 510, 88, 0, 560, 0, 1, 661, 771, 605, 855,
+  12, 0, 0, 0, 0, 0, 0, 131, 307, 538, 0, 0, 854, 0, 296, 703,
+  78, 24, 275, 660, 879, 990, 0, 0, 0, 0, 213, 439, 0, 0, 453, 934,
+  0, 552, 708, 327, 0, 375, 565, 0, 724, 567, 0, 813, 335, 0, 0, 0,
+  0, 0, 775, 964, 0, 0, 0, 0, 0, 0, 653, 505, 484, 842, 0, 0,
+  838, 455, 108, 0, 408, 0, 132, 0, 230, 254, 584, 530, 0, 0, 3, 104,
+  159, 315, 95, 528, 672, 735, 786, 0, 493, 476, 601, 596, 649, 0, 336, 577,
+  141, 762, 908, 0, 0, 0, 480, 833, 31, 249, 426, 959, 953, 0, 0, 209,
+  298, 469, 0, 0, 0, 0, 0, 0, 0, 645, 952, 0, 99, 0, 0, 0,
+  54, 663, 66, 729, 745, 2, 892, 937, 0, 0, 0, 571, 0, 0, 0, 0,
+  0, 788, 0, 0, 0, 0, 0, 497, 0, 0, 0, 162, 835, 0, 0, 191,
+  0, 872, 0, 393, 0, 0, 0, 0, 0, 0, 0, 0, 0, 487, 0, 0,
+  0, 0, 503, 0, 0, 464, 359, 637, 0, 0, 0, 0, 0, 0, 588, 654,
+  0, 0, 0, 0, 0, 0, 0, 564, 289, 0, 0, 0, 241, 461, 474, 519,
+  0, 0, 0, 508, 0, 815, 0, 74, 0, 0, 983, 723, 794, 0, 0, 553,
+  0, 0, 0, 0, 134, 0, 0, 0, 0, 0, 0, 956, 961, 0, 0, 0,
+  0, 448, 509, 65, 200, 272, 274, 861, 548, 0, 0, 0, 830, 0, 851, 0,
+  515, 799, 0, 0, 0, 0, 130, 92, 0, 968, 572, 506, 0, 0, 517, 0,
+  255, 0, 0, 887, 387, 1000, 802, 129, 0, 117, 243, 258, 0, 0, 918, 232,
+  0, 413, 0, 0, 170, 338, 286, 702, 963, 0, 0, 0, 0, 0, 60, 928,
+  0, 451, 0, 790, 0, 119, 943, 0, 0, 16, 763, 0, 0, 0, 0, 984,
+  0, 972, 987, 0, 0, 0, 0, 889, 0, 0, 0, 0, 0, 0, 994, 0,
+  0, 0, 157, 456, 818, 0, 532, 181, 0, 896, 0, 0, 316, 0, 820, 859,
+  939, 0, 0, 447, 0, 0, 0, 0, 5, 0, 371, 30, 463, 0, 0, 438,
+  0, 0, 123, 868, 0, 0, 494, 0, 0, 271, 633, 0, 69, 0, 0, 0,
+  0, 710, 780, 0, 0, 0, 0, 283, 0, 0, 0, 0, 871, 0, 208, 235,
+  694, 876, 0, 0, 0, 867, 0, 0, 0, 0, 0, 126, 144, 0, 591, 778,
+  721, 0, 975, 0, 0, 149, 0, 0, 0, 0, 0, 0, 841, 183, 0, 0,
+  0, 430, 659, 784, 0, 0, 0, 382, 293, 0, 0, 189, 764, 0, 923, 993,
+  0, 0, 0, 68, 234, 0, 0, 0, 0, 425, 0, 0, 397, 325, 580, 962,
+  0, 0, 0, 969, 82, 0, 0, 0, 251, 600, 758, 0, 406, 0, 0, 310,
+  671, 0, 0, 0, 0, 0, 399, 0, 37, 791, 0, 0, 0, 0, 0, 33,
+  514, 843, 97, 936, 957, 0, 361, 34, 616, 662, 449, 0, 0, 0, 0, 0,
+  927, 0, 0, 742, 44, 61, 665, 938, 869, 622, 101, 0, 860, 206, 575, 614,
+  0, 0, 0, 163, 844, 0, 0, 0, 0, 883, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 847, 0, 905, 744, 0, 385, 0, 0, 444, 0, 0, 0,
+  0, 0, 0, 719, 216, 471, 0, 935, 0, 0, 817, 59, 912, 137, 287, 638,
+  229, 897, 281, 472, 882, 507, 977, 0, 676, 683, 903, 0, 419, 0, 569, 819,
+  93, 114, 884, 0, 322, 0, 0, 0, 50, 902, 755, 81, 478, 0, 0, 45,
+  741, 220, 0, 0, 0, 261, 388, 547, 0, 0, 64, 0, 0, 475, 53, 348,
+  831, 63, 751, 288, 891, 991, 0, 0, 265, 400, 207, 0, 467, 816, 0, 0,
+  776, 0, 0, 369, 0, 0, 933, 0, 466, 0, 0, 0, 246, 440, 0, 0,
+  0, 0, 0, 894, 328, 760, 837, 0, 0, 112, 317, 221, 411, 782, 0, 273,
+  266, 747, 774, 0, 546, 161, 125, 804, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 639, 0, 167, 641, 174, 545, 0, 279, 477, 757, 0, 0, 0, 0, 0,
+  0, 0, 725, 0, 0, 0, 0, 0, 0, 0, 0, 615, 0, 0, 0, 0,
+  697, 280, 402, 740, 357, 485, 363, 391, 247, 211, 534, 0, 743, 483, 0, 0,
+  0, 0, 0, 0, 0, 15, 550, 700, 0, 0, 0, 701, 542, 0, 85, 0,
+  0, 0, 0, 809, 895, 0, 0, 913, 669, 574, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 558, 158, 0, 0, 0, 0, 0, 0, 922, 0, 0, 165,
+  0, 432, 0, 0, 0, 470, 0, 0, 642, 0, 0, 0, 344, 632, 0, 0,
+  890, 28, 329, 539, 678, 0, 0, 94, 674, 620, 942, 687, 0, 0, 0, 0,
+  495, 148, 0, 0, 686, 646, 197, 0, 0, 500, 947, 0, 0, 0, 25, 42,
+  0, 0, 0, 340, 750, 324, 877, 761, 43, 0, 643, 106, 282, 836, 0, 0,
+  0, 0, 392, 0, 354, 0, 222, 312, 789, 0, 587, 0, 0, 305, 0, 0,
+  0, 0, 0, 300, 0, 267, 612, 417, 0, 8, 932, 0, 0, 0, 0, 543,
+  0, 0, 0, 0, 0, 996, 441, 0, 0, 0, 0, 0, 0, 777, 390, 0,
+  0, 0, 0, 0, 326, 0, 524, 670, 398, 0, 0, 940, 798, 586, 428, 749,
+  11, 301, 0, 0, 0, 557, 0, 192, 250, 278, 378, 898, 0, 0, 0, 0,
+  915, 0, 0, 415, 0, 0, 479, 152, 684, 0, 0, 0, 187, 0, 0, 427,
+  779, 0, 0, 862, 259, 345, 0, 0, 0, 499, 492, 218, 900, 0, 0, 386,
+  437, 75, 0, 140, 151, 0, 0, 0, 863, 0, 321, 349, 814, 0, 0, 79,
+  465, 103, 722, 974, 0, 535, 0, 0, 343, 446, 0, 205, 655, 0, 212, 582,
+  797, 124, 0, 0, 0, 17, 41, 227, 603, 365, 0, 0, 0, 0, 737, 482,
+  811, 829, 113, 0, 0, 72, 26, 153, 239, 773, 604, 808, 954, 0, 853, 486,
+  0, 0, 199, 47, 429, 691, 0, 80, 523, 704, 459, 531, 840, 0, 595, 0,
+  925, 0, 0, 793, 98, 0, 907, 0, 39, 224, 342, 460, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 880, 303, 384, 810, 333, 166, 285, 562, 731, 800, 634,
+  468, 0, 0, 0, 389, 0, 0, 0, 606, 0, 35, 0, 0, 0, 989, 0,
+  941, 0, 726, 0, 0, 0, 0, 0, 680, 929, 195, 0, 210, 623, 650, 718,
+  834, 628, 551, 906, 0, 0, 0, 598, 263, 513, 625, 981, 0, 0, 785, 0,
+  0, 0, 0, 685, 0, 0, 976, 115, 219, 362, 0, 648, 356, 0, 0, 164,
+  6, 252, 857, 0, 0, 0, 0, 0, 0, 0, 0, 707, 318, 966, 0, 846,
+  0, 0, 0, 242, 314, 0, 0, 0, 705, 179, 0, 0, 555, 0, 0, 0,
+  0, 0, 0, 260, 0, 0, 0, 0, 0, 0, 0, 0, 217, 264, 339, 0,
+  420, 0, 0, 0, 0, 0, 311, 0, 0, 0, 308, 0, 150, 0, 0, 0,
+  0, 0, 0, 0, 136, 501, 0, 0, 410, 845, 0, 0, 0, 0, 0, 0,
+  0, 0, 807, 0, 0, 0, 142, 0, 0, 96, 769, 594, 13, 424, 629, 822,
+  0, 193, 214, 32, 395, 585, 681, 297, 276, 228, 827, 920, 0, 0, 733, 0,
+  0, 0, 998, 352, 38, 177, 422, 852, 0, 0, 120, 143, 175, 146, 379, 423,
+  666, 0, 0, 858, 0, 0, 746, 0, 946, 609, 765, 0, 0, 865, 0, 445,
+  0, 27, 107, 481, 0, 407, 0, 299, 0, 566, 0, 0, 0, 306, 364, 759,
+  0, 752, 516, 0, 0, 0, 0, 0, 376, 380, 522, 525, 0, 0, 0, 657,
+  0, 248, 0, 0, 0, 0, 0, 0, 292, 313, 0, 0, 0, 948, 0, 0,
+  0, 351, 0, 244, 0, 656, 58, 635, 204, 706, 767, 19, 190, 930, 692, 295,
+  360, 450, 554, 995, 0, 0, 0, 0, 931, 0, 0, 0, 0, 982, 145, 0,
+  0, 0, 0, 0, 796, 0, 154, 679, 986, 518, 0, 0, 960, 215, 40, 0,
+  0, 0, 644, 951, 589, 873, 403, 462, 0, 0, 734, 0, 0, 0, 0, 0,
+  0, 0, 772, 488, 0, 182, 0, 86, 0, 0, 434, 521, 608, 0, 0, 0,
+  368, 89, 924, 0, 0, 294, 709, 0, 160, 0, 570, 0, 0, 978, 0, 559,
+  664, 443, 0, 0, 0, 0, 970, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  116, 801, 893, 0, 236, 452, 0, 0, 0, 0, 51, 0, 0, 0, 0, 0,
+  256, 139, 442, 864, 792, 878, 0, 0, 0, 0, 0, 0, 0, 0, 0, 347,
+  0, 436, 225, 418, 404, 0, 527, 0, 118, 0, 0, 0, 56, 0, 0, 0,
+  0, 0, 0, 48, 194, 196, 394, 401, 526, 0, 0, 0, 270, 414, 618, 0,
+  223, 0, 353, 0, 821, 0, 0, 176, 0, 0, 0, 0, 0, 0, 0, 138,
+  0, 77, 0, 0, 0, 0, 0, 0, 630, 412, 541, 736, 284, 766, 0, 0,
+  0, 109, 0, 888, 999, 0, 856, 728, 768, 949, 696, 0, 0, 0, 0, 0,
+  171, 0, 988, 716, 473, 0, 965, 0, 0, 0, 0, 0, 0, 0, 291, 46,
+};
+
+const char *WA_FREQ_79_TOKENS[] = {
+  "ಮತ್ತು",
+  "ಈ",
+  "ಹಾಗೂ",
+  "ಇದು",
+  "ಅಥವಾ",
+  "ಅವರು",
+  "ತಮ್ಮ",
+  "ಮೇಲೆ",
+  "ಒಂದು",
+  "ತನ್ನ",
+  "ಎಂದು",
+  "ಅದರ",
+  "ಹೆಚ್ಚಿನ",
+  "ಸಹ",
+  "ಯಾವುದೇ",
+  "ಇತರ",
+  "ಎಲ್ಲಾ",
+  "ಅವರ",
+  "ಆದರೆ",
+  "ಮೂಲಕ",
+  "ರ",
+  "ನಂತರ",
+  "ಕೇವಲ",
+  "ಬೇರೆ",
+  "ಹೆಚ್ಚು",
+  "ರೀತಿಯ",
+  "ಎಂಬ",
+  "ಸಮಯದಲ್ಲಿ",
+  "ಬಗ್ಗೆ",
+  "ಅವನ",
+  "ಕೆಲವು",
+  "ಪ್ರತಿ",
+  "ಆ",
+  "ಒಬ್ಬ",
+  "ಅನೇಕ",
+  "ಎರಡು",
+  "ಸಾಮಾನ್ಯ",
+  "ಈಗ",
+  "ರಾಷ್ಟ್ರೀಯ",
+  "ಮೂಲ",
+  "ಆರ್ಥಿಕ",
+  "ಅವುಗಳ",
+  "ಅದು",
+  "ಮಾಡಿದ",
+  "ಒಂದೇ",
+  "ನ",
+  "ಸಾಮಾನ್ಯವಾಗಿ",
+  "ಇರುವ",
+  "ಹಾಗು",
+  "ರಾಜಕೀಯ",
+  "ವಿಶೇಷ",
+  "ಪ್ರಮುಖ",
+  "ಅತ್ಯಂತ",
+  "ಇದನ್ನು",
+  "ಸಾಮಾಜಿಕ",
+  "ಮೊದಲ",
+  "ಇದರ",
+  "ಹಲವಾರು",
+  "ಸಂಯುಕ್ತ",
+  "ಮಾತ್ರ",
+  "ಸುಮಾರು",
+  "ಹೊಂದಿದೆ",
+  "ಶಿಕ್ಷಣ",
+  "ಹೊಸ",
+  "ದೇಶದ",
+  "ಗಳನ್ನು",
+  "ಕೂಡ",
+  "ರಿಂದ",
+  "ಸಾಹಿತ್ಯ",
+  "ಕಡಿಮೆ",
+  "ಸಾರ್ವಜನಿಕ",
+  "ಸಂಬಂಧಿಸಿದ",
+  "ಜೊತೆಗೆ",
+  "ಅಲ್ಲದೆ",
+  "ಯಾವ",
+  "ನಡುವೆ",
+  "ಹಲವು",
+  "ಕಾರ್ಯ",
+  "ರಲ್ಲಿ",
+  "ಸಂಪೂರ್ಣ",
+  "ಇಂತಹ",
+  "ಆದ",
+  "ನಲ್ಲಿ",
+  "ವಿವಿಧ",
+  "ಪ್ರಕಾರ",
+  "ಧಾರ್ಮಿಕ",
+  "ಒಳಗೊಂಡಿದೆ",
+  "ಅನ್ನು",
+  "ಅಭಿವೃದ್ಧಿ",
+  "ದೊಡ್ಡ",
+  "ಆಧಾರದ",
+  "ಭಾರತದ",
+  "ಕೊನೆಯ",
+  "ಮಾನವ",
+  "ಅದನ್ನು",
+  "ಅತಿ",
+  "ಮೂರು",
+  "ತಾನು",
+  "ಎಲ್ಲ",
+  "ಜನರು",
+  "ಮಾಡುವ",
+  "ಪ್ರಾಥಮಿಕ",
+  "ಪರಸ್ಪರ",
+  "ಸಂದರ್ಭದಲ್ಲಿ",
+  "ಸಂಪೂರ್ಣವಾಗಿ",
+  "ಕನ್ನಡ",
+  "ವಾಣಿಜ್ಯ",
+  "ಮಾಡಲು",
+  "ಹೊಂದಿರುವ",
+  "ಅವನು",
+  "ಮುಖ್ಯ",
+  "ಕುರಿತು",
+  "ಸಾಂಸ್ಕೃತಿಕ",
+  "ಇಲ್ಲಿ",
+  "ಕೆಲಸ",
+  "ಮಕ್ಕಳು",
+  "ಉತ್ತಮ",
+  "ರೀತಿಯಲ್ಲಿ",
+  "ಭಾರತೀಯ",
+  "ಸ್ಥಳೀಯ",
+  "ಅವು",
+  "ಉತ್ತರ",
+  "ಬಹಳ",
+  "ಅವರಿಗೆ",
+  "ಇದೆ",
+  "ದಕ್ಷಿಣ",
+  "ನಡುವಿನ",
+  "ರಂದು",
+  "ಕಾರಣ",
+  "ಗಳು",
+  "ಅದೇ",
+  "ಎಂಬುದು",
+  "ಹೆಚ್ಚಾಗಿ",
+  "ನೈಸರ್ಗಿಕ",
+  "ಪ್ರಮಾಣದ",
+  "ಜೀವನದ",
+  "ಸಣ್ಣ",
+  "ಅವಧಿಯಲ್ಲಿ",
+  "ಮೊದಲು",
+  "ಸಂಗೀತ",
+  "ಎಂಬುದನ್ನು",
+  "ಎರಡೂ",
+  "ಪಡೆಯಲು",
+  "ಇನ್ನೂ",
+  "ಅಲ್ಲಿ",
+  "ಇವರು",
+  "ಏಕೆಂದರೆ",
+  "ವಿರುದ್ಧ",
+  "೨",
+  "೫",
+  "ಮಾಡುತ್ತದೆ",
+  "ಗೆ",
+  "ವರ್ಷ",
+  "ಇತರೆ",
+  "ಇದರಲ್ಲಿ",
+  "ಇದಕ್ಕೆ",
+  "ಯ",
+  "ಗಳಲ್ಲಿ",
+  "೩",
+  "ಆಫ್",
+  "ಆತ",
+  "ಸ್ವಾತಂತ್ರ್ಯ",
+  "ಆದಾಗ್ಯೂ",
+  "ಅವರನ್ನು",
+  "ಇದೇ",
+  "ಯನ್ನು",
+  "ಸ್ವತಃ",
+  "ಕೆಳಗೆ",
+  "ಭಾರತ",
+  "ಹೀಗೆ",
+  "ಪುನಃ",
+  "ಅಂದರೆ",
+  "ಪ್ರಭಾವ",
+  "ಮಾಡಿದರು",
+  "೧",
+  "ಭಾಷೆ",
+  "ಉದಾಹರಣೆಗೆ",
+  "೧೦",
+  "ವನ್ನು",
+  "ಜೊತೆ",
+  "ಬಾರಿ",
+  "ವರ್ಷಗಳ",
+  "ದಿ",
+  "ಕಾಲ",
+  "ನಾಲ್ಕು",
+  "ಸ್ವತಂತ್ರ",
+  "ಹೆಸರು",
+  "ದಲ್ಲಿ",
+  "ಕೇಂದ್ರ",
+  "ಹಿಂದೆ",
+  "೪",
+  "ಮೇಲಿನ",
+  "ಅವಕಾಶ",
+  "ಕಾನೂನು",
+  "ಆದರೂ",
+  "ಬಳಸಲಾಗುತ್ತದೆ",
+  "ದ",
+  "ಅಲ್ಲದೇ",
+  "ಕುಟುಂಬದ",
+  "ಬಹುತೇಕ",
+  "ಹಿಂದಿನ",
+  "ನಮ್ಮ",
+  "ನೀಡುವ",
+  "ರಾಜ್ಯದ",
+  "ಬೆಳವಣಿಗೆ",
+  "ಮಾಹಿತಿ",
+  "ಮುಕ್ತ",
+  "ಇವು",
+  "ಆದ್ದರಿಂದ",
+  "ಪರಿಣಾಮ",
+  "ಮುಂದೆ",
+  "ಆಧುನಿಕ",
+  "ರಾಜ್ಯ",
+  "ಗಳ",
+  "ನಗರದ",
+  "ನೀಡುತ್ತದೆ",
+  "ಧರ್ಮ",
+  "ರೀತಿ",
+  "ಆಹಾರ",
+  "ಒಟ್ಟು",
+  "ಮನೆ",
+  "ಶಕ್ತಿ",
+  "ನಗರ",
+  "ಪ್ರಮಾಣದಲ್ಲಿ",
+  "೬",
+  "ನಂತರದ",
+  "ಸೇವೆ",
+  "ಜನರ",
+  "ಕೆಲವೊಮ್ಮೆ",
+  "ಮತ್ತೆ",
+  "ನಿರ್ದಿಷ್ಟ",
+  "ಸಾಂಪ್ರದಾಯಿಕ",
+  "ಆರೋಗ್ಯ",
+  "ಕೂಡಾ",
+  "ವಿಶೇಷವಾಗಿ",
+  "ಆತನ",
+  "ನಾನು",
+  "ಯುವ",
+  "ಶತಮಾನದ",
+  "ಹಿಂದೂ",
+  "ಮಾಡಿ",
+  "ಅವುಗಳಲ್ಲಿ",
+  "ಸಂಬಂಧಿಸಿದಂತೆ",
+  "ಇಲ್ಲ",
+  "ವರ್ಷದ",
+  "ಸಮಾಜದ",
+  "ನಡೆದ",
+  "ಪ್ರಶಸ್ತಿ",
+  "ವ್ಯವಸ್ಥೆ",
+  "ಖಾಸಗಿ",
+  "ಪ್ರಧಾನ",
+  "ಕರ್ನಾಟಕ",
+  "ವರೆಗೆ",
+  "ಸಂಸ್ಥೆಗಳು",
+  "ವೈದ್ಯಕೀಯ",
+  "ಐದು",
+  "ಮುಂದಿನ",
+  "ಕಾಲದಲ್ಲಿ",
+  "ಸರ್ಕಾರದ",
+  "ಸೇರಿದಂತೆ",
+  "ಅದಕ್ಕೆ",
+  "ವ್ಯವಹಾರ",
+  "ಪೈಕಿ",
+  "ಬಂದ",
+  "ಆಗ",
+  "ವಿಷಯ",
+  "ಜಾತಿ",
+  "ನೀರಿನ",
+  "ಪೂರ್ವ",
+  "೨೦",
+  "೧೨",
+  "ಅವುಗಳನ್ನು",
+  "ಕಾರ್ಯವನ್ನು",
+  "ಪ್ರದೇಶದ",
+  "ಹೊಂದಿವೆ",
+  "ಮಕ್ಕಳಿಗೆ",
+  "ಇವರ",
+  "ನಾವು",
+  "೧೫",
+  "ಅಮೆರಿಕಾ",
+  "ಸದಸ್ಯ",
+  "ಜನ",
+  "ರಾಷ್ಟ್ರಗಳ",
+  "ಹೇಗೆ",
+  "ಪ್ರದೇಶದಲ್ಲಿ",
+  "ಜೀವನ",
+  "ಭೌತಿಕ",
+  "ಹೊಂದಿರುತ್ತದೆ",
+  "ಅಧ್ಯಯನ",
+  "ಮಾನವನ",
+  "ಮಟ್ಟದ",
+  "ಸ್ವಲ್ಪ",
+  "ಉನ್ನತ",
+  "ಆಡಳಿತ",
+  "ಬಹಳಷ್ಟು",
+  "ನೀರು",
+  "ನೇ",
+  "ವೇಳೆ",
+  "ಉದ್ದೇಶ",
+  "ನೀಡಿದರು",
+  "ಪಶ್ಚಿಮ",
+  "ರಾಷ್ಟ್ರದ",
+  "೭",
+  "ಹೇಳಿದರು",
+  "ಆಗಿದೆ",
+  "ಇರುತ್ತದೆ",
+  "ಎಂದರೆ",
+  "ಮಾಡಿತು",
+  "೮",
+  "ಅತ್ಯುತ್ತಮ",
+  "ಪ್ರತಿಯೊಂದು",
+  "ಹಳೆಯ",
+  "ತಂಡದ",
+  "ತುಂಬಾ",
+  "ಶ್ರೀ",
+  "ಸಮಾಜ",
+  "ಕರೆಯಲಾಗುತ್ತದೆ",
+  "ಪ್ರಥಮ",
+  "ಹೆಸರನ್ನು",
+  "ವಿಶ್ವ",
+  "ಗಳಿಗೆ",
+  "ಬ್ರಿಟಿಷ್",
+  "ದಿನ",
+  "ವೈಯಕ್ತಿಕ",
+  "ಪ್ರದೇಶಗಳಲ್ಲಿ",
+  "ಸ್ವಂತ",
+  "ಅಭಿಪ್ರಾಯ",
+  "ಹೊಂದಿದ್ದು",
+  "ಇಂದು",
+  "ತಾವು",
+  "ಬಿಡುಗಡೆ",
+  "ಹೊಂದಿದ",
+  "ವಿಜ್ಞಾನ",
+  "ಕಿ",
+  "ವ್ಯಾಪಾರ",
+  "ರಕ್ಷಣೆ",
+  "ಹೊಂದಿರುತ್ತವೆ",
+  "ಓರ್ವ",
+  "ಬರುವ",
+  "ಮಕ್ಕಳ",
+  "ನಿರ್ಮಾಣ",
+  "ಇಂಥ",
+  "ಚಿತ್ರ",
+  "ಪಡೆಯುವ",
+  "ವಿಭಿನ್ನ",
+  "ಜುಲೈ",
+  "ಇಬ್ಬರು",
+  "ತಮ್ಮದೇ",
+  "೯",
+  "ಹಾಗೆಯೇ",
+  "ಜನಪ್ರಿಯ",
+  "ಪಡೆದರು",
+  "ಮತ್ತೊಂದು",
+  "ಮುಖ್ಯವಾಗಿ",
+  "ರಾಷ್ಟ್ರಗಳು",
+  "ಭೂಮಿಯ",
+  "ಸಾಕಷ್ಟು",
+  "ವ್ಯಕ್ತಿ",
+  "ಸಹಾಯ",
+  "ತನ್ನದೇ",
+  "ಹಕ್ಕು",
+  "ಮಧ್ಯೆ",
+  "ಎರಡನೇ",
+  "ಕುಟುಂಬ",
+  "ಮೇ",
+  "ಇದಲ್ಲದೆ",
+  "ಕಾನೂನಿನ",
+  "ಕಾಲದ",
+  "ಪಡೆದ",
+  "ವಿಶಿಷ್ಟ",
+  "ನನ್ನ",
+  "ವಿದ್ಯುತ್",
+  "ವ್ಯವಸ್ಥೆಯ",
+  "ಆಯ್ಕೆ",
+  "ದಿನಗಳಲ್ಲಿ",
+  "ಭಾರತದಲ್ಲಿ",
+  "ಸಂಸ್ಥೆಯ",
+  "ಸಂಸ್ಥಾನದ",
+  "ಇದರಿಂದ",
+  "ಇನ್ನೊಂದು",
+  "ಜನವರಿ",
+  "ಅದರಲ್ಲಿ",
+  "ಸದಸ್ಯರು",
+  "ಉಳಿದ",
+  "ತಂದೆ",
+  "ತರಬೇತಿ",
+  "ರೂಪದಲ್ಲಿ",
+  "ಯುನೈಟೆಡ್",
+  "ಸಂಪರ್ಕ",
+  "ಹಾಗೆ",
+  "ಅಧಿಕ",
+  "ಕಾರಣದಿಂದ",
+  "ಬದಲಿಗೆ",
+  "೨೫",
+  "ಐತಿಹಾಸಿಕ",
+  "ಭಾಗದಲ್ಲಿ",
+  "ಮಾನಸಿಕ",
+  "ವ್ಯವಸ್ಥೆಯನ್ನು",
+  "ನೀಡಿದ",
+  "ಮಾರಾಟ",
+  "ಸಂಬಂಧ",
+  "ವಿಶ್ವದ",
+  "ಆಗಿ",
+  "ಇದರಿಂದಾಗಿ",
+  "ಮಾಡಲಾಯಿತು",
+  "೩೦",
+  "ಹೊಂದಿತ್ತು",
+  "ಅಧಿಕೃತ",
+  "ಒದಗಿಸುತ್ತದೆ",
+  "ಪರಿಸರ",
+  "ಪ್ರಸ್ತುತ",
+  "ಸರ್ಕಾರ",
+  "ಅಂತಿಮ",
+  "ಬಳಸುವ",
+  "ಯು",
+  "೧೬",
+  "ಗಮನ",
+  "ದಿಂದ",
+  "ದೇಶದಲ್ಲಿ",
+  "ಸಮಾನ",
+  "ಎಂದೂ",
+  "ಪ್ರಾಚೀನ",
+  "ಕೃಷಿ",
+  "ಚಿಕ್ಕ",
+  "ಬಳಕೆ",
+  "ರೂಪ",
+  "ಜೈವಿಕ",
+  "ತನಗೆ",
+  "ಮಾಡುವುದು",
+  "ನೀಡಲು",
+  "ಸಂದರ್ಭಗಳಲ್ಲಿ",
+  "ಸಾಮರ್ಥ್ಯವನ್ನು",
+  "ಇವೆ",
+  "ಕೆಲವೊಂದು",
+  "ಅಲ್ಲ",
+  "ನಂತರದಲ್ಲಿ",
+  "ಇಡೀ",
+  "೧೮",
+  "ಮಾಡಲಾಗುತ್ತದೆ",
+  "ಆರು",
+  "ವೈಜ್ಞಾನಿಕ",
+  "ಮಾಹಿತಿಯನ್ನು",
+  "ಸೂಚಿಸುತ್ತದೆ",
+  "ಕಪ್ಪು",
+  "ಕೆಂಪು",
+  "ಶತಮಾನದಲ್ಲಿ",
+  "ಉಂಟು",
+  "ನೆಯ",
+  "ಅಂಶಗಳನ್ನು",
+  "ದೇಶಗಳಲ್ಲಿ",
+  "ಸದಾ",
+  "ಸ್ಥಾನವನ್ನು",
+  "ಒಳಗೊಂಡಿರುತ್ತದೆ",
+  "ಜೂನ್",
+  "ಮಧ್ಯ",
+  "ಅಂತರರಾಷ್ಟ್ರೀಯ",
+  "ಅಮೆರಿಕ",
+  "ದೇಶ",
+  "೧೧",
+  "ಸರಕಾರದ",
+  "ಕಲೆ",
+  "ನವೆಂಬರ್",
+  "ಬಗೆಯ",
+  "ಬಳಸಿ",
+  "ಸಂಶೋಧನೆ",
+  "ಸಂಸ್ಥೆ",
+  "ಅರ್ಥ",
+  "ಕಂಡು",
+  "ವರ್ಷದಲ್ಲಿ",
+  "ಸದಸ್ಯರ",
+  "೧೩",
+  "ಚಲನಚಿತ್ರ",
+  "ಡಿಸೆಂಬರ್",
+  "ನ್ನು",
+  "ಪ್ರದೇಶ",
+  "ಪಕ್ಷದ",
+  "ಸಹಜ",
+  "ಶೈಕ್ಷಣಿಕ",
+  "ಸರಾಸರಿ",
+  "ಸೇರಿವೆ",
+  "ಆರಂಭಿಕ",
+  "ನಿಂದ",
+  "ಪರಿಣಾಮವಾಗಿ",
+  "ವರ್ಷಗಳಲ್ಲಿ",
+  "ತಾಂತ್ರಿಕ",
+  "ಪ್ರಮಾಣ",
+  "ಪ್ರಸಿದ್ಧ",
+  "ಕಾರಣದಿಂದಾಗಿ",
+  "ನೇರವಾಗಿ",
+  "ಸಂಖ್ಯೆಯ",
+  "ಜನಿಸಿದ",
+  "ವ್ಯಕ್ತಿಯ",
+  "ಸಮಯ",
+  "ಜಿಲ್ಲೆಯ",
+  "ಹಣ",
+  "ಅಂತಿಮವಾಗಿ",
+  "ಇಲ್ಲಿನ",
+  "ಹಕ್ಕನ್ನು",
+  "ಹಣಕಾಸು",
+  "ಅಷ್ಟೇ",
+  "ಎರಡನೆಯ",
+  "ಮೂಲಭೂತ",
+  "ಕ್ಷೇತ್ರದಲ್ಲಿ",
+  "ವಸ್ತುಗಳನ್ನು",
+  "ಹಿರಿಯ",
+  "ಸಂಖ್ಯೆ",
+  "ಸಂಸ್ಕೃತಿ",
+  "ಪಂದ್ಯದಲ್ಲಿ",
+  "ತಮ್ಮನ್ನು",
+  "ಪ್ರದರ್ಶನ",
+  "ಮಾಡಬಹುದು",
+  "೧೪",
+  "ತೀವ್ರ",
+  "ನೇರ",
+  "ಕಂಡುಬರುತ್ತದೆ",
+  "ಭಾಗದ",
+  "ಸಾಮರ್ಥ್ಯ",
+  "ಅಂತರ",
+  "ಮಟ್ಟದಲ್ಲಿ",
+  "ದಾಳಿ",
+  "ಒಳಗೊಂಡಂತೆ",
+  "ಕಳೆದ",
+  "ಬಾರಿಗೆ",
+  "ಮಹತ್ವದ",
+  "ನೂತನ",
+  "೧೭",
+  "ನೋಡಿ",
+  "ಪ್ರತ್ಯೇಕ",
+  "ಹೀಗಾಗಿ",
+  "ಅಂತಹ",
+  "ನಿರ್ವಹಣೆ",
+  "ನೀಡಿತು",
+  "ಮುಖಾಂತರ",
+  "ಸಂಸ್ಥೆಯು",
+  "ಸಾರ್ವತ್ರಿಕ",
+  "ಅವುಗಳು",
+  "ಪಾತ್ರವನ್ನು",
+  "ಜನರಿಗೆ",
+  "ಬಗೆಗಿನ",
+  "ರಚನೆ",
+  "ರಾಸಾಯನಿಕ",
+  "ಕಾಣಬಹುದು",
+  "ಕೆಲಸಕ್ಕೆ",
+  "ಮನುಷ್ಯ",
+  "ಸಾಧಾರಣ",
+  "ಕುರಿತಾದ",
+  "ಬಂಡವಾಳ",
+  "ವಸತಿ",
+  "ವಸ್ತು",
+  "ಎಲ್ಲರೂ",
+  "ಜಾಗತಿಕ",
+  "ಬಳಿ",
+  "ಯುದ್ಧ",
+  "ಕಾರಣವಾಯಿತು",
+  "ಮಿಲಿಯನ್",
+  "ವಸ್ತುಗಳು",
+  "ವ್ಯವಸ್ಥೆಯು",
+  "ಬಹು",
+  "ಅಕ್ಟೋಬರ್",
+  "ಏಕೈಕ",
+  "ಕಡೆಗೆ",
+  "ಮಟ್ಟವನ್ನು",
+  "ಮಾರ್ಚ್",
+  "ಸ್ಥಾನ",
+  "ಹೊತ್ತಿಗೆ",
+  "ಮಾರುಕಟ್ಟೆ",
+  "ಸುಲಭವಾಗಿ",
+  "ಭಾಷೆಯ",
+  "ಸಂಬಂಧವನ್ನು",
+  "ಅಗತ್ಯ",
+  "ಆಂತರಿಕ",
+  "ವ್ಯಾಪಕವಾಗಿ",
+  "ತಾಯಿ",
+  "ನಗರವು",
+  "ಬಿಟ್ಟು",
+  "ವಿನ್ಯಾಸ",
+  "ಸರ್ಕಾರವು",
+  "ಹೊಂದಿದ್ದರು",
+  "ಆಸ್ತಿ",
+  "ಕೊನೆಯಲ್ಲಿ",
+  "ರೀತಿಯಾಗಿ",
+  "ವ್ಯವಸ್ಥೆಗೆ",
+  "ಇತ್ತೀಚಿನ",
+  "ಇವುಗಳ",
+  "ಪರಿಣಾಮವನ್ನು",
+  "ಮಾಡುತ್ತಾರೆ",
+  "ಅಂತಾರಾಷ್ಟ್ರೀಯ",
+  "ದಶಕದ",
+  "ನಡೆಯುವ",
+  "ಪರ",
+  "ಸಲುವಾಗಿ",
+  "ಸೆಪ್ಟೆಂಬರ್",
+  "ಇಂದಿಗೂ",
+  "ಎಂಬುದಾಗಿ",
+  "ನಿಯಂತ್ರಣ",
+  "ಪಡೆಯಿತು",
+  "ಭೇಟಿ",
+  "ಮಾಡಲಾಗಿದೆ",
+  "ಏಪ್ರಿಲ್",
+  "ಸಭೆ",
+  "ಪಾತ್ರ",
+  "ಬರೆದ",
+  "ಭಾಗವನ್ನು",
+  "ವಿವಾಹ",
+  "ಹಣವನ್ನು",
+  "ಡಿ",
+  "ದೈಹಿಕ",
+  "ಭಾಗ",
+  "ರಷ್ಟು",
+  "೨೪",
+  "ಆರಂಭದಲ್ಲಿ",
+  "ಇವುಗಳನ್ನು",
+  "ಕಂಪನಿಗಳು",
+  "ಕೆಲವೇ",
+  "ಹಕ್ಕುಗಳನ್ನು",
+  "ಹೆಚ್ಚುವರಿ",
+  "ತಂಡವು",
+  "ಬದಲಾಗಿ",
+  "ಬೃಹತ್",
+  "ಸಂಗೀತದ",
+  "ಆಟದ",
+  "ಚಿಕಿತ್ಸೆ",
+  "ನಿಜವಾದ",
+  "ಆಗಸ್ಟ್",
+  "ಫೆಬ್ರವರಿ",
+  "ಫ್ರೆಂಚ್",
+  "ಶಕ್ತಿಯನ್ನು",
+  "ಸಮಾಜದಲ್ಲಿ",
+  "ಪುಸ್ತಕ",
+  "ಬದಲಾವಣೆ",
+  "ಬರುತ್ತದೆ",
+  "ಎಷ್ಟು",
+  "ನೃತ್ಯ",
+  "ಪ್ರಶಸ್ತಿಯನ್ನು",
+  "ವಿದ್ಯಾರ್ಥಿಗಳು",
+  "ವೇಳೆಗೆ",
+  "ಸಹೋದರ",
+  "ಇಲ್ಲದೆ",
+  "ಎಂದರು",
+  "ಕೆಲ",
+  "ಚಿತ್ರದ",
+  "ಮುಂತಾದ",
+  "ಯುದ್ಧದ",
+  "ವಸ್ತುಗಳ",
+  "೧೯",
+  "ಕಂಪನಿಯು",
+  "ಬಂದಿದೆ",
+  "ವಯಸ್ಸಿನಲ್ಲಿ",
+  "ಕ್ರಿಕೆಟ್",
+  "ಜನರನ್ನು",
+  "ಪ್ರಭಾವವನ್ನು",
+  "ವಿರೋಧ",
+  "ಹೊಂದಿದ್ದ",
+  "ಅತೀ",
+  "ಗುಂಪು",
+  "ಬೆಂಬಲ",
+  "ವಿಮಾನ",
+  "ಸರಳ",
+  "2",
+  "ಕಾಂಗ್ರೆಸ್",
+  "ಕೈಗಾರಿಕಾ",
+  "ಜನಾಂಗದ",
+  "ದಿನಗಳ",
+  "ಅಮೇರಿಕಾ",
+  "ನಿರ್ದಿಷ್ಟವಾಗಿ",
+  "ನೀಡಿ",
+  "ಮಾಡುತ್ತವೆ",
+  "ಇನ್ನಿತರ",
+  "ನಡೆಯುತ್ತದೆ",
+  "ಪ್ರಸಾರ",
+  "ಬೇಕು",
+  "ಹೆಣ್ಣು",
+  "ಗಮನಾರ್ಹ",
+  "ಪ್ರದೇಶವು",
+  "ಬಣ್ಣದ",
+  "ಇತಿಹಾಸ",
+  "ಕೆಳಗಿನ",
+  "ಪ್ರಪಂಚದ",
+  "ಮಾದರಿಯ",
+  "ಅಲ್ಲಿನ",
+  "ಅವಳ",
+  "ಎಂಬುದರ",
+  "ಒಟ್ಟಾರೆ",
+  "ಕನ್ನಡ ಸಾಹಿತ್ಯ",
+  "ಡಾ",
+  "ನೀವು",
+  "ಪದವಿ",
+  "ಯಿಂದ",
+  "ಪ್ರಾದೇಶಿಕ",
+  "ರಾಜ",
+  "ವಾದ",
+  "ಹಂತದಲ್ಲಿ",
+  "ಹಣಕಾಸಿನ",
+  "ಈಗಲೂ",
+  "ಜೀವಿಗಳು",
+  "ಪೂರ್ಣ",
+  "ಹತ್ತು",
+  "ಕೆಲಸವನ್ನು",
+  "ಚಿತ್ರದಲ್ಲಿ",
+  "ತೆರನಾದ",
+  "ಪಡೆದಿದ್ದಾರೆ",
+  "ಮಂದಿ",
+  "ಸರ್ಕಾರಿ",
+  "ಹೊರತುಪಡಿಸಿ",
+  "೨೨",
+  "ಅವಳು",
+  "ಏಳು",
+  "ಗಳಿಸಿದರು",
+  "ತಿಂಗಳ",
+  "ಧರ್ಮದ",
+  "ಬಹುಪಾಲು",
+  "ಮಗ",
+  "ಯಾವಾಗಲೂ",
+  "ಹುಟ್ಟು",
+  "ಎನ್ನುವ",
+  "ಗಂಡು",
+  "ದಶಕದಲ್ಲಿ",
+  "ಸೇರಿ",
+  "ಸೇರಿದ",
+  "ದೇಹದ",
+  "ನಗರದಲ್ಲಿ",
+  "ಬಂದು",
+  "ಮೊದಲಾದ",
+  "ಇನ್ನು",
+  "ತಂತ್ರಜ್ಞಾನ",
+  "ರಕ್ಷಣಾ",
+  "ಸೂಕ್ತ",
+  "ಒಳಗೊಂಡಿತ್ತು",
+  "ಕಡೆ",
+  "ತೆರಿಗೆ",
+  "ಪ್ರಮುಖವಾಗಿ",
+  "ಬಳಿಕ",
+  "ಹೇಳುತ್ತಾರೆ",
+  "ಆಸಕ್ತಿ",
+  "ಕಂಪನಿಯ",
+  "ಜಗತ್ತಿನ",
+  "ನಂಬಿಕೆ",
+  "ನಡೆಯಿತು",
+  "ಮಾತ್ರವೇ",
+  "ವರದಿ",
+  "ಶಕ್ತಿಯ",
+  "ವೃತ್ತಿ",
+  "ಸರಿಯಾದ",
+  "ಅಧಿಕಾರ",
+  "ಅಧಿಕಾರಿಗಳು",
+  "ಬೀರುತ್ತದೆ",
+  "ಮೂರನೇ",
+  "ರೋಗ",
+  "ವ್ಯಕ್ತಿಯು",
+  "ಅಗತ್ಯವಾದ",
+  "ಇತ್ತು",
+  "ಒಳ್ಳೆಯ",
+  "ಬಿಳಿ",
+  "ಯೋಜನೆ",
+  "ವರ್ಗದ",
+  "ಅಂಶಗಳು",
+  "ಅವನನ್ನು",
+  "ಬಿ",
+  "ವಾರ್ಷಿಕ",
+  "ವಿದೇಶಿ",
+  "ಅಪಾರ",
+  "ಆಕೆ",
+  "ಕೆಲವರು",
+  "ನಿಟ್ಟಿನಲ್ಲಿ",
+  "ಬುಡಕಟ್ಟು",
+  "ಮಾದರಿ",
+  "ರನ್",
+  "ವಿಷಯಗಳನ್ನು",
+  "1",
+  "ಆತ್ಮ",
+  "ಕನಿಷ್ಠ",
+  "ದೇಶಗಳ",
+  "ಪದವನ್ನು",
+  "ಪ್ರವೇಶ",
+  "ಮೈಸೂರು",
+  "ಸೇವಾ",
+  "ಸೇವೆಯನ್ನು",
+  "ನದಿಯ",
+  "ಬಣ್ಣ",
+  "ಸಾರಿಗೆ",
+  "ಹಾಗಾಗಿ",
+  "ಕಾರಣವಾಗುತ್ತದೆ",
+  "ದಶಲಕ್ಷ",
+  "ಬೆಳಕು",
+  "ಮುಂಚೆ",
+  "ವಿಷಯಗಳ",
+  "ಸ್ಥಿತಿಯ",
+  "ಜನಿಸಿದರು",
+  "ದೇವರ",
+  "ಬಳಸುತ್ತಾರೆ",
+  "ಬಹುಶಃ",
+  "೨೬",
+  "ನಾಗರಿಕ",
+  "ಮರದ",
+  "ವಿಧಾನ",
+  "ಹೆಸರಿನ",
+  "ಜಾನ್",
+  "ದಾರಿ",
+  "ನೀಡಲಾಗುತ್ತದೆ",
+  "ಬಳಸಿಕೊಂಡು",
+  "ಬೇಕಾದ",
+  "ಭೂಮಿ",
+  "ಕಾರ್ಯಕ್ರಮಗಳನ್ನು",
+  "ತನಕ",
+  "ದೇಶಗಳು",
+  "ಯಲ್ಲಿ",
+  "ವ್ಯಕ್ತಿಗಳು",
+  "ಸಂಶೋಧನಾ",
+  "ಅದಕ್ಕಿಂತ",
+  "ಅವನಿಗೆ",
+  "ಆರಂಭಿಸಿದರು",
+  "ಪ್ರತಿಯೊಬ್ಬ",
+  "ಸಂಬಂಧಿತ",
+  "ಸೇವೆಗಳನ್ನು",
+  "ಇದ್ದ",
+  "ಒಳಗೆ",
+  "ಪತ್ನಿ",
+  "ಪುರಾತನ",
+  "ಪ್ರದೇಶವನ್ನು",
+  "ಮಾಡಿದ್ದಾರೆ",
+  "ವೃತ್ತಿಪರ",
+  "ಸ್ಥಿತಿಗೆ",
+  "ಇವುಗಳಲ್ಲಿ",
+  "ಜಾತಿಯ",
+  "ಪವಿತ್ರ",
+  "ಪ್ರಾರಂಭಿಸಿದರು",
+  "ಮತ್ತಷ್ಟು",
+  "ಶಾಲೆ",
+  "ಹೊರಗೆ",
+  "ಗೌರವ",
+  "ತನ್ನನ್ನು",
+  "ನಿರ್ವಹಿಸುತ್ತದೆ",
+  "ಹೊಂದಲು",
+  "ಎಸ್",
+  "ರಾತ್ರಿ",
+  "ಇಂಗ್ಲಿಷ್",
+  "ಇಂದಿನ",
+  "ಉತ್ಪಾದನೆ",
+  "ಕ್ರಮವಾಗಿ",
+  "ತೈಲ",
+  "ಮೂಲದ",
+  "ಸ್ಥಳ",
+  "ಅಧ್ಯಕ್ಷ",
+  "ಆಗಿತ್ತು",
+  "ಪರಿಣಾಮಗಳನ್ನು",
+  "ಬಳಕೆಯ",
+  "ವಿಷಯದಲ್ಲಿ",
+  "ಹಿಡಿದು",
+  "ಇಂಗ್ಲೆಂಡ್",
+  "ಕಥೆ",
+  "ಕ್ರಮ",
+  "ಜರ್ಮನ್",
+  "ನಡೆಸಲು",
+  "ಬ್ಯಾಂಕ್",
+  "ಸಂಸ್ಥಾನ",
+  "ಸಮಯವನ್ನು",
+  "ಸರಿಯಾಗಿ",
+  "ಸ್ವತಂತ್ರವಾಗಿ",
+  "ಹೇಳಿದ್ದಾರೆ",
+  "ಅಡಿ",
+  "ಅಧಿಕಾರವನ್ನು",
+  "ಇತ್ತೀಚೆಗೆ",
+  "ಕಂಪ್ಯೂಟರ್",
+  "ಕರ್ನಾಟಕದ",
+  "ಚಿತ್ರವು",
+  "ರಾಷ್ಟ್ರಗಳಲ್ಲಿ",
+  "ಸದರಿ",
+  "ಸಾಧ್ಯವಿಲ್ಲ",
+  "ಅವಧಿಯ",
+  "ಇಬ್ಬರೂ",
+  "ಇವುಗಳು",
+  "ಒಮ್ಮೆ",
+  "ಒಳಗೊಳ್ಳುತ್ತದೆ",
+  "ತೋರಿಸುತ್ತದೆ",
+  "ನೀಡುತ್ತವೆ",
+  "ನೀರನ್ನು",
+  "ಬಂದರು",
+  "ಮಹಿಳೆಯರು",
+  "ವಿಧದ",
+  "ವೇಗದ",
+  "ವ್ಯಾಪಕ",
+  "ಸಂಸ್ಥಾನದಲ್ಲಿ",
+  "ಹಕ್ಕುಗಳ",
+  "ಅಂದಾಜು",
+  "ನನಗೆ",
+  "ನಾಟಕ",
+  "ನಿರಂತರವಾಗಿ",
+  "ಪಡೆದು",
+  "ಪ್ರದೇಶಗಳು",
+  "ಹಸಿರು",
+  "ತಮಿಳು",
+  "ಪ್ರಕ್ರಿಯೆ",
+  "ಬೆಲೆ",
+  "ವಯಸ್ಸಿನ",
+  "ಹೊರತು",
+  "ಅಡಿಯಲ್ಲಿ",
+  "ಆಸ್ಟ್ರೇಲಿಯಾ",
+  "ಇತ್ಯಾದಿ",
+  "ಇನ್ನಷ್ಟು",
+  "ಜನಸಂಖ್ಯೆ",
+  "ದೇಶಕ್ಕೆ",
+  "ನಡೆಸುವ",
+  "ಪರವಾಗಿ",
+  "ಮುಂಚಿನ",
+  "ಒತ್ತಡ",
+  "ನಡೆಸಿದ",
+  "ಪರಿಸರದ",
+  "ಸಮುದಾಯದ",
+  "ಅನನ್ಯ",
+  "ಕಾರ್ಡ್",
+  "ದೃಷ್ಟಿಯಿಂದ",
+  "ಧ್ವನಿ",
+  "ಬೆಂಗಳೂರು",
+  "ಸಂಸ್ಕೃತಿಯ",
+  "ಸಮುದ್ರ",
+  "ಅಂಶಗಳ",
+  "ಇರುತ್ತವೆ",
+  "ಕಂಪನಿ",
+  "ಕ್ಷೇತ್ರಗಳಲ್ಲಿ",
+  "ಕ್ಷೇತ್ರದ",
+  "ಬೆಳಕಿನ",
+  "ಸಂಸ್ಥೆಗಳ",
+  "ಆಗಾಗ್ಗೆ",
+  "ನೀತಿ",
+  "ಮೂಲತಃ",
+  "ರಾಜಧಾನಿ",
+  "ಸ್ಪಷ್ಟವಾಗಿ",
+  "ಉದ್ಯೋಗ",
+  "ಎಂಟು",
+  "ಪಟ್ಟಿ",
+  "ಮಿಲಿಟರಿ",
+  "ವ್ಯವಸ್ಥೆಯಲ್ಲಿ",
+  "ಶಾಲೆಗಳು",
+  "ಸಾವಿರ",
+  "ಸ್ವಾತಂತ್ರ್ಯದ",
+  "ಹೊರ",
+  "ಎ",
+  "ಜೀವನದಲ್ಲಿ",
+  "ತಂಡ",
+  "ತಿಳಿಸಿದರು",
+  "ದಿನದ",
+  "ನಿಮ್ಮ",
+  "ಪ್ರಪಂಚದಲ್ಲಿ",
+  "ಬಳಸಲು",
+  "ಮಾಜಿ",
+  "10",
+  "ಆಕೆಯ",
+  "ಒಕ್ಕೂಟದ",
+  "ಒಳಗೊಂಡ",
+  "ಪ್ರಮಾಣವು",
+  "ಬಳಕೆಗೆ",
+  "ಮೇಲ್ಮೈ",
+  "ಮೊದಲೇ",
+  "ಶೈಲಿಯ",
+  "ಸ್ಥಿತಿ",
+  "ಹಿನ್ನೆಲೆಯಲ್ಲಿ",
+  "೨೧",
+  "ಚಿತ್ರಗಳನ್ನು",
+  "ಪಕ್ಷ",
+  "ಪಡೆದಿದೆ",
+  "ಮಕ್ಕಳನ್ನು",
+  "ಮೊದಲಿಗೆ",
+  "ಶ್ರೇಷ್ಠ",
+  "ಅಥವ",
+  "ಪ್ರಾಣಿಗಳ",
+  "ಯಾರು",
+  "ವಲಸೆ",
+  "ಸಿ",
+  "ಸೂಕ್ಷ್ಮ",
+  "ಅಂತರಾಷ್ಟ್ರೀಯ",
+  "ಅಮೆರಿಕನ್",
+  "ಒದಗಿಸುವ",
+  "ಭಾಗಗಳಲ್ಲಿ",
+  "ವಾಸ್ತವವಾಗಿ",
+  "ಅವನ್ನು",
+  "ಕರೆಯುತ್ತಾರೆ",
+  "ಕಾರ್ಯಕ್ರಮ",
+  "ತರಹದ",
+  "ದೂರ",
+  "ಪಂದ್ಯಗಳಲ್ಲಿ",
+  "ಮಾಡಿದೆ",
+  "ರಹಸ್ಯ",
+  "ಲಕ್ಷಣಗಳನ್ನು",
+  "ಸುತ್ತ",
+  "ಸ್ಥಳದಲ್ಲಿ",
+  "ಹೋಗುವ",
+  "ಉಂಟಾಗುವ",
+  "ಕಲಾ",
+  "ಗುರು",
+  "ಚಿತ್ರಗಳು",
+  "ಜಿಲ್ಲಾ",
+  "ದೇವರು",
+  "ಪರಿಹಾರ",
+  "ಪ್ರಚಾರ",
+  "ಭಾಗವು",
+  "ಮತ",
+  "ಸಂಖ್ಯೆಯಲ್ಲಿ",
+  "ಸಂಸ್ಕೃತ",
+  "ಹೊಂದಿದ್ದಾರೆ",
+  "ಅದರಲ್ಲೂ",
+};
+const uint16_t WA_FREQ_79_RANKS[] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 268, 482, 0, 460, 471, 506, 239, 104,
+  661, 814, 934, 429, 0, 0, 0, 0, 65, 0, 67, 0, 0, 0, 0, 0,
+  77, 0, 654, 985, 0, 0, 0, 0, 0, 0, 0, 0, 0, 843, 189, 945,
+  0, 0, 0, 0, 0, 357, 27, 438, 39, 495, 704, 0, 0, 0, 0, 0,
+  0, 313, 848, 0, 0, 0, 0, 222, 0, 566, 0, 702, 205, 651, 252, 122,
+  462, 472, 872, 925, 319, 343, 0, 599, 0, 615, 70, 669, 149, 777, 0, 0,
+  0, 0, 0, 0, 929, 0, 0, 0, 0, 0, 895, 0, 0, 824, 0, 0,
+  0, 0, 0, 402, 300, 459, 528, 813, 11, 0, 299, 0, 0, 0, 60, 95,
+  135, 207, 0, 0, 0, 0, 0, 0, 178, 246, 0, 0, 763, 860, 0, 0,
+  312, 170, 915, 867, 0, 0, 193, 360, 992, 0, 639, 496, 988, 535, 541, 0,
+  0, 635, 782, 378, 805, 959, 0, 0, 0, 0, 0, 0, 0, 0, 0, 35,
+  76, 0, 0, 0, 0, 0, 195, 0, 0, 42, 928, 973, 0, 0, 0, 0,
+  0, 26, 232, 372, 419, 499, 902, 0, 919, 0, 0, 0, 0, 136, 840, 359,
+  672, 524, 609, 874, 36, 880, 134, 997, 0, 0, 517, 0, 94, 0, 399, 436,
+  600, 831, 0, 709, 707, 0, 0, 0, 0, 595, 875, 0, 0, 0, 0, 0,
+  0, 0, 701, 0, 0, 795, 699, 0, 291, 0, 59, 940, 862, 0, 563, 810,
+  142, 5, 404, 0, 0, 0, 556, 509, 0, 123, 175, 0, 0, 453, 278, 620,
+  789, 0, 0, 0, 0, 979, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  790, 0, 711, 0, 0, 0, 0, 749, 989, 522, 456, 0, 0, 0, 492, 0,
+  0, 118, 155, 819, 344, 785, 0, 0, 240, 532, 978, 687, 143, 984, 961, 933,
+  0, 0, 0, 0, 276, 0, 0, 0, 0, 0, 894, 0, 0, 745, 0, 0,
+  0, 0, 0, 0, 0, 922, 970, 0, 0, 546, 859, 982, 0, 0, 0, 828,
+  29, 293, 253, 0, 0, 186, 905, 882, 0, 0, 120, 169, 511, 0, 367, 385,
+  800, 22, 396, 0, 380, 0, 0, 0, 0, 0, 0, 0, 0, 0, 571, 836,
+  198, 0, 0, 0, 69, 0, 0, 0, 477, 0, 636, 0, 0, 0, 755, 24,
+  619, 576, 0, 0, 347, 303, 254, 816, 0, 433, 0, 0, 6, 0, 0, 0,
+  0, 288, 0, 212, 602, 0, 744, 638, 0, 16, 183, 0, 0, 227, 277, 0,
+  23, 531, 231, 244, 124, 100, 946, 0, 0, 0, 202, 770, 838, 0, 0, 0,
+  0, 0, 0, 0, 924, 646, 698, 731, 0, 504, 0, 0, 632, 225, 792, 547,
+  681, 0, 0, 243, 305, 0, 0, 0, 45, 0, 83, 0, 102, 373, 633, 0,
+  550, 0, 0, 0, 0, 580, 53, 395, 306, 503, 226, 725, 804, 889, 0, 242,
+  0, 0, 696, 267, 0, 0, 705, 649, 975, 0, 0, 0, 0, 0, 377, 0,
+  0, 262, 0, 0, 0, 0, 0, 0, 0, 108, 18, 304, 0, 0, 0, 935,
+  684, 0, 0, 0, 0, 539, 534, 921, 112, 955, 0, 0, 0, 0, 2, 0,
+  0, 0, 0, 0, 0, 216, 384, 690, 952, 833, 0, 0, 0, 0, 0, 0,
+  0, 251, 0, 0, 0, 607, 0, 0, 0, 0, 0, 0, 340, 0, 81, 493,
+  224, 400, 941, 786, 172, 533, 760, 950, 827, 0, 548, 0, 0, 478, 350, 812,
+  0, 0, 575, 0, 596, 0, 174, 629, 144, 0, 757, 394, 0, 0, 980, 48,
+  0, 674, 185, 365, 739, 0, 0, 648, 0, 374, 109, 414, 480, 0, 0, 364,
+  0, 0, 0, 0, 851, 475, 0, 0, 369, 773, 869, 0, 0, 677, 0, 0,
+  618, 0, 156, 97, 675, 0, 758, 468, 656, 0, 886, 111, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 274, 0, 0, 0, 0, 0, 0, 0, 0, 716, 0,
+  0, 0, 697, 0, 366, 621, 34, 61, 589, 854, 691, 858, 0, 425, 767, 0,
+  0, 0, 0, 918, 981, 386, 487, 0, 0, 0, 180, 0, 79, 0, 85, 0,
+  0, 0, 286, 469, 0, 0, 354, 0, 0, 845, 893, 0, 0, 329, 917, 0,
+  162, 592, 663, 181, 0, 0, 0, 451, 665, 774, 318, 525, 500, 0, 0, 0,
+  0, 422, 324, 518, 616, 650, 682, 15, 778, 923, 910, 0, 0, 260, 0, 420,
+  0, 0, 0, 0, 983, 0, 0, 440, 788, 167, 920, 0, 0, 0, 196, 626,
+  526, 430, 564, 423, 688, 877, 332, 0, 0, 466, 930, 327, 398, 968, 584, 96,
+  0, 501, 0, 0, 803, 908, 991, 349, 0, 605, 0, 0, 0, 549, 0, 0,
+  603, 543, 0, 0, 0, 435, 0, 0, 0, 957, 0, 713, 99, 266, 0, 0,
+  0, 0, 0, 393, 0, 555, 692, 0, 0, 664, 17, 296, 0, 0, 573, 0,
+  259, 0, 0, 855, 0, 0, 0, 657, 728, 379, 434, 218, 552, 32, 165, 545,
+  0, 0, 444, 628, 0, 221, 0, 284, 0, 667, 476, 139, 184, 0, 160, 0,
+  0, 0, 0, 0, 0, 0, 280, 0, 0, 0, 0, 0, 455, 557, 90, 0,
+  0, 0, 0, 0, 0, 732, 0, 958, 960, 110, 140, 666, 601, 694, 464, 0,
+  710, 0, 0, 40, 0, 0, 336, 0, 410, 0, 0, 0, 0, 0, 287, 0,
+  0, 0, 537, 750, 890, 282, 339, 903, 630, 64, 0, 98, 598, 0, 0, 0,
+  0, 752, 523, 0, 0, 0, 0, 192, 693, 0, 729, 0, 0, 0, 0, 0,
+  285, 125, 0, 0, 849, 335, 245, 751, 820, 103, 473, 771, 371, 0, 0, 408,
+  412, 906, 0, 695, 263, 0, 0, 283, 606, 0, 0, 0, 0, 411, 644, 963,
+  270, 241, 990, 0, 939, 0, 0, 558, 0, 0, 942, 0, 0, 0, 0, 883,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 490, 176, 383, 0,
+  0, 969, 965, 450, 613, 279, 0, 0, 71, 116, 834, 0, 289, 0, 12, 230,
+  568, 0, 0, 161, 0, 0, 0, 387, 0, 33, 345, 995, 0, 0, 0, 158,
+  315, 3, 73, 802, 0, 0, 645, 0, 0, 62, 43, 234, 321, 199, 159, 653,
+  794, 901, 993, 544, 87, 194, 7, 281, 424, 521, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 823, 865, 680, 269, 337, 853, 857, 863, 951, 119, 0, 0,
+  829, 826, 132, 258, 46, 166, 314, 542, 740, 461, 953, 0, 0, 0, 516, 0,
+  0, 401, 0, 676, 0, 0, 944, 409, 0, 0, 764, 998, 0, 0, 0, 0,
+  0, 0, 793, 0, 0, 452, 0, 0, 0, 0, 0, 0, 320, 0, 536, 0,
+  0, 301, 911, 168, 481, 708, 720, 323, 967, 0, 418, 730, 292, 0, 678, 0,
+  0, 617, 0, 0, 0, 0, 0, 0, 0, 206, 0, 0, 0, 443, 0, 0,
+  9, 514, 491, 0, 0, 0, 0, 0, 0, 0, 0, 0, 171, 0, 562, 0,
+  876, 0, 126, 190, 148, 308, 0, 712, 0, 233, 322, 341, 737, 614, 801, 861,
+  271, 662, 878, 51, 884, 994, 780, 0, 842, 0, 0, 311, 642, 57, 799, 885,
+  0, 52, 20, 325, 754, 0, 806, 0, 0, 597, 0, 497, 779, 936, 0, 0,
+  0, 0, 0, 352, 0, 0, 913, 0, 947, 0, 106, 0, 74, 0, 448, 0,
+  203, 0, 0, 746, 796, 530, 871, 0, 0, 250, 0, 0, 0, 0, 0, 0,
+  0, 0, 182, 219, 220, 317, 141, 338, 428, 78, 582, 0, 0, 0, 133, 362,
+  717, 272, 441, 706, 847, 432, 0, 0, 0, 0, 0, 0, 0, 0, 130, 821,
+  0, 0, 0, 0, 177, 703, 837, 931, 948, 996, 0, 0, 0, 0, 389, 608,
+  577, 0, 0, 0, 631, 0, 0, 415, 570, 593, 255, 0, 37, 0, 0, 0,
+  0, 0, 938, 0, 724, 0, 0, 465, 128, 229, 0, 348, 574, 0, 0, 974,
+  652, 0, 572, 0, 0, 0, 0, 0, 356, 72, 0, 0, 215, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 179, 0, 0, 0, 0, 0, 0, 0, 361,
+  659, 916, 249, 0, 38, 0, 0, 316, 660, 700, 0, 0, 164, 0, 0, 213,
+  298, 445, 0, 0, 999, 507, 719, 0, 0, 442, 449, 553, 235, 0, 0, 0,
+  0, 265, 0, 520, 590, 0, 791, 237, 510, 787, 0, 309, 565, 784, 0, 769,
+  152, 355, 0, 0, 368, 0, 310, 0, 485, 671, 331, 0, 0, 467, 0, 0,
+  10, 0, 427, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  726, 346, 333, 0, 376, 204, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 513, 1, 759, 0, 328, 211, 0, 0, 0, 0, 0, 147, 307, 403,
+  811, 0, 13, 105, 898, 0, 742, 0, 937, 0, 0, 783, 0, 0, 0, 0,
+  0, 551, 0, 962, 0, 0, 0, 846, 0, 0, 154, 421, 668, 0, 0, 0,
+  0, 0, 0, 0, 0, 733, 0, 0, 0, 926, 0, 591, 114, 569, 714, 718,
+  210, 932, 683, 949, 0, 0, 841, 0, 201, 0, 474, 0, 0, 830, 30, 208,
+  391, 392, 527, 554, 236, 835, 0, 0, 426, 519, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 972, 0, 0, 0, 4, 832, 117, 583, 0, 0, 0, 0, 0,
+  138, 892, 47, 768, 0, 256, 0, 512, 689, 807, 0, 879, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 228, 0, 0, 494, 0, 63, 0,
+  738, 0, 145, 0, 0, 0, 0, 670, 634, 622, 0, 342, 0, 909, 852, 0,
+  0, 0, 0, 0, 640, 0, 966, 0, 8, 257, 508, 818, 0, 56, 382, 447,
+  0, 0, 0, 150, 431, 797, 0, 0, 0, 0, 92, 353, 0, 0, 0, 809,
+  0, 0, 0, 748, 0, 772, 0, 200, 489, 850, 0, 0, 151, 0, 627, 0,
+  0, 0, 0, 0, 0, 0, 0, 822, 0, 0, 581, 986, 407, 93, 463, 756,
+  21, 1000, 0, 0, 326, 19, 31, 0, 248, 0, 0, 417, 887, 540, 0, 623,
+  0, 375, 655, 864, 0, 0, 264, 954, 358, 0, 0, 101, 734, 866, 0, 0,
+  0, 0, 0, 0, 625, 0, 586, 0, 0, 0, 82, 49, 0, 0, 14, 209,
+  610, 775, 914, 0, 561, 89, 515, 637, 163, 0, 904, 127, 483, 735, 131, 381,
+  825, 781, 647, 0, 0, 334, 0, 0, 0, 75, 446, 0, 0, 0, 0, 405,
+  0, 0, 0, 0, 0, 0, 297, 479, 457, 927, 0, 0, 238, 0, 762, 0,
+  0, 0, 0, 413, 0, 388, 173, 41, 658, 0, 0, 0, 896, 722, 0, 25,
+  587, 956, 0, 458, 0, 0, 0, 191, 0, 0, 91, 723, 538, 0, 0, 897,
+  113, 58, 370, 470, 439, 579, 594, 604, 907, 0, 0, 976, 0, 0, 0, 686,
+  0, 715, 390, 0, 0, 290, 0, 0, 0, 0, 0, 971, 987, 0, 88, 0,
+  0, 0, 454, 0, 0, 0, 0, 817, 437, 673, 559, 912, 0, 187, 585, 0,
+  0, 0, 0, 0, 743, 0, 406, 121, 223, 888, 0, 0, 502, 611, 0, 0,
+  0, 0, 560, 0, 839, 727, 891, 295, 0, 721, 0, 643, 873, 0, 66, 844,
+  0, 0, 0, 0, 80, 488, 0, 397, 612, 0, 0, 0, 964, 0, 0, 0,
+  0, 0, 685, 0, 330, 766, 0, 68, 0, 0, 261, 679, 0, 55, 217, 0,
+  115, 0, 0, 899, 129, 0, 0, 0, 0, 363, 0, 416, 0, 294, 0, 50,
+  247, 0, 747, 0, 0, 137, 153, 0, 0, 761, 808, 0, 0, 0, 567, 0,
+  0, 0, 0, 505, 0, 86, 498, 0, 0, 0, 0, 0, 107, 0, 0, 0,
+  943, 0, 624, 302, 641, 736, 881, 753, 0, 815, 146, 275, 0, 0, 0, 28,
+  486, 84, 900, 798, 197, 0, 578, 0, 0, 157, 44, 188, 741, 588, 0, 0,
+  765, 868, 0, 0, 856, 0, 0, 214, 776, 977, 0, 0, 0, 0, 0, 0,
+  484, 0, 0, 0, 0, 0, 0, 0, 529, 0, 0, 0, 54, 351, 870, 0,
+};
+
+const char *WA_FREQ_80_TOKENS[] = {
+  "어요",
+  "니다",
+  "아니",
+  "사람",
+  "생각",
+  "하는",
+  "잖아",
+  "아요",
+  "지만",
+  "당신",
+  "이야",
+  "습니",
+  "세요",
+  "들이",
+  "었어",
+  "으로",
+  "하지",
+  "해요",
+  "는데",
+  "있었",
+  "모르",
+  "거야",
+  "그렇",
+  "았어",
+  "그러",
+  "라고",
+  "에게",
+  "에서",
+  "우리",
+  "여기",
+  "한테",
+  "다고",
+  "들어",
+  "말이",
+  "에요",
+  "했어",
+  "니까",
+  "필요",
+  "다면",
+  "이에",
+  "아이",
+  "하고",
+  "엄마",
+  "이그",
+  "하나",
+  "아무",
+  "얘기",
+  "친구",
+  "겠어",
+  "이지",
+  "들을",
+  "있는",
+  "좋아",
+  "는아",
+  "일이",
+  "알았",
+  "요그",
+  "람들",
+  "세상",
+  "그녀",
+  "그들",
+  "미안",
+  "들은",
+  "자네",
+  "르겠",
+  "아버",
+  "버지",
+  "사랑",
+  "까지",
+  "말하",
+  "그래",
+  "있어",
+  "요있",
+  "리가",
+  "지금",
+  "괜찮",
+  "모두",
+  "어서",
+  "이거",
+  "어디",
+  "있을",
+  "아빠",
+  "요이",
+  "있다",
+  "뭐라",
+  "합니",
+  "시간",
+  "문제",
+  "으면",
+  "나요",
+  "에아",
+  "리를",
+  "누구",
+  "지아",
+  "한다",
+  "네요",
+  "겠지",
+  "도와",
+  "그것",
+  "돌아",
+  "리고",
+  "정말",
+  "없어",
+  "신이",
+  "다시",
+  "고아",
+  "알아",
+  "같은",
+  "이하",
+  "전에",
+  "것도",
+  "대한",
+  "자기",
+  "하면",
+  "요해",
+  "야있",
+  "은데",
+  "선생",
+  "다음",
+  "게말",
+  "말해",
+  "여자",
+  "너희",
+  "지나",
+  "가요",
+  "요어",
+  "을마",
+  "알겠",
+  "기다",
+  "다있",
+  "는지",
+  "대로",
+  "남자",
+  "소리",
+  "처음",
+  "이름",
+  "아닌",
+  "나가",
+  "없다",
+  "지가",
+  "수술",
+  "준비",
+  "입니",
+  "을있",
+  "누군",
+  "기를",
+  "기가",
+  "가아",
+  "머리",
+  "환자",
+  "만나",
+  "지하",
+  "다리",
+  "애들",
+  "아서",
+  "마음",
+  "그랬",
+  "이해",
+  "데요",
+  "자는",
+  "기억",
+  "는거",
+  "요사",
+  "얼굴",
+  "부터",
+  "내가",
+  "그리",
+  "이다",
+  "그런",
+  "서그",
+  "렇게",
+  "모든",
+  "예요",
+  "은오",
+  "오늘",
+  "아직",
+  "진짜",
+  "고이",
+  "어않",
+  "않아",
+  "람이",
+  "안녕",
+  "같아",
+  "는그",
+  "해아",
+  "잠깐",
+  "가서",
+  "가자",
+  "요아",
+  "몰라",
+  "신의",
+  "그만",
+  "뭔가",
+  "니라",
+  "거기",
+  "니가",
+  "요자",
+  "가지",
+  "고그",
+  "됐어",
+  "아마",
+  "은얘",
+  "해야",
+  "동안",
+  "싶어",
+  "구들",
+  "사실",
+  "데생",
+  "생님",
+  "물론",
+  "되는",
+  "있으",
+  "이상",
+  "거라",
+  "도움",
+  "죄송",
+  "어가",
+  "요알",
+  "주세",
+  "것이",
+  "것은",
+  "각했",
+  "해서",
+  "로아",
+  "지있",
+  "다는",
+  "요너",
+  "이죠",
+  "않았",
+  "요죽",
+  "다때",
+  "고어",
+  "당연",
+  "않는",
+  "서이",
+  "야기",
+  "자가",
+  "이어",
+  "요건",
+  "뭐하",
+  "군가",
+  "했잖",
+  "이유",
+  "하게",
+  "리에",
+  "저희",
+  "을거",
+  "자신",
+  "가이",
+  "아들",
+  "방법",
+  "고맙",
+  "일어",
+  "이것",
+  "을아",
+  "찾아",
+  "까요",
+  "요저",
+  "다마",
+  "만들",
+  "잠시",
+  "곳에",
+  "을그",
+  "게아",
+  "각하",
+  "자를",
+  "정도",
+  "으니",
+  "다기",
+  "놈들",
+  "에이",
+  "어머",
+  "머니",
+  "좋겠",
+  "걸로",
+  "도아",
+  "고요",
+  "줘요",
+  "를어",
+  "가족",
+  "아가",
+  "게요",
+  "아기",
+  "병원",
+  "해줘",
+  "있겠",
+  "된다",
+  "이는",
+  "자고",
+  "아내",
+  "보다",
+  "요원",
+  "죽이",
+  "가져",
+  "신들",
+  "로그",
+  "는다",
+  "자리",
+  "못하",
+  "말했",
+  "것들",
+  "만있",
+  "심장",
+  "이아",
+  "래를",
+  "가그",
+  "어왜",
+  "무슨",
+  "한하",
+  "어떻",
+  "떻게",
+  "그럼",
+  "게있",
+  "제가",
+  "이제",
+  "네가",
+  "저우",
+  "게다",
+  "나도",
+  "요당",
+  "은아",
+  "좋은",
+  "나는",
+  "같이",
+  "게없",
+  "찮아",
+  "말아",
+  "안돼",
+  "기서",
+  "위해",
+  "해해",
+  "지엄",
+  "바로",
+  "로가",
+  "데알",
+  "리있",
+  "있습",
+  "어아",
+  "얼마",
+  "제발",
+  "있지",
+  "겁니",
+  "다어",
+  "리는",
+  "신을",
+  "을자",
+  "그걸",
+  "때문",
+  "대해",
+  "집에",
+  "지일",
+  "렇지",
+  "만약",
+  "저기",
+  "고마",
+  "마워",
+  "워요",
+  "돼요",
+  "요거",
+  "맞아",
+  "와그",
+  "그거",
+  "말을",
+  "없는",
+  "하세",
+  "러니",
+  "가고",
+  "만했",
+  "이걸",
+  "이이",
+  "이미",
+  "이봐",
+  "봐아",
+  "데아",
+  "상에",
+  "에있",
+  "고있",
+  "있고",
+  "절대",
+  "야당",
+  "래도",
+  "도대",
+  "한말",
+  "말은",
+  "가갈",
+  "갈않",
+  "안해",
+  "것을",
+  "을여",
+  "감사",
+  "어때",
+  "나를",
+  "있잖",
+  "아저",
+  "가봐",
+  "봐요",
+  "않을",
+  "완전",
+  "안에",
+  "다사",
+  "한번",
+  "대체",
+  "각해",
+  "혼자",
+  "는말",
+  "이리",
+  "깐만",
+  "싫어",
+  "요한",
+  "해이",
+  "아는",
+  "는너",
+  "새로",
+  "왔어",
+  "도가",
+  "기에",
+  "원하",
+  "요도",
+  "요모",
+  "알지",
+  "밖에",
+  "있나",
+  "하죠",
+  "죠했",
+  "했는",
+  "이있",
+  "요갖",
+  "서것",
+  "이나",
+  "중에",
+  "요마",
+  "언제",
+  "했지",
+  "봤어",
+  "서시",
+  "마지",
+  "지막",
+  "왜냐",
+  "엄청",
+  "오래",
+  "다려",
+  "요제",
+  "니지",
+  "면보",
+  "가있",
+  "는누",
+  "보여",
+  "여러",
+  "전히",
+  "없지",
+  "들그",
+  "말로",
+  "여보",
+  "조금",
+  "보세",
+  "서로",
+  "로안",
+  "랑해",
+  "싶은",
+  "뿐이",
+  "확실",
+  "요죄",
+  "글쎄",
+  "는했",
+  "나의",
+  "요생",
+  "러지",
+  "지되",
+  "면아",
+  "마도",
+  "전화",
+  "에도",
+  "도것",
+  "처럼",
+  "최고",
+  "의말",
+  "건가",
+  "요없",
+  "고것",
+  "이번",
+  "만해",
+  "구야",
+  "없었",
+  "어그",
+  "알잖",
+  "분명",
+  "걱정",
+  "정보",
+  "보자",
+  "아침",
+  "요대",
+  "이당",
+  "있네",
+  "네그",
+  "들의",
+  "뭔데",
+  "아하",
+  "는찾",
+  "가필",
+  "에그",
+  "없잖",
+  "고기",
+  "기분",
+  "못해",
+  "게가",
+  "분이",
+  "만요",
+  "게하",
+  "해봐",
+  "밤에",
+  "에미",
+  "잘못",
+  "앉아",
+  "같네",
+  "가게",
+  "들었",
+  "요만",
+  "나서",
+  "진정",
+  "지방",
+  "법을",
+  "하려",
+  "먹을",
+  "조심",
+  "심해",
+  "따라",
+  "었는",
+  "까얘",
+  "희가",
+  "기요",
+  "될까",
+  "술을",
+  "문을",
+  "지어",
+  "어도",
+  "은생",
+  "가끔",
+  "레이",
+  "음에",
+  "고들",
+  "들고",
+  "랬어",
+  "어차",
+  "이가",
+  "하자",
+  "니잖",
+  "를죽",
+  "죽었",
+  "한있",
+  "지정",
+  "정신",
+  "요하",
+  "기회",
+  "를그",
+  "가도",
+  "와줘",
+  "앞에",
+  "뭐든",
+  "오는",
+  "렇다",
+  "테니",
+  "도요",
+  "믿어",
+  "속에",
+  "시만",
+  "할게",
+  "기는",
+  "는언",
+  "언니",
+  "갈게",
+  "하루",
+  "가를",
+  "음을",
+  "제는",
+  "없네",
+  "를생",
+  "지뭐",
+  "상황",
+  "화를",
+  "번째",
+  "할까",
+  "중이",
+  "어이",
+  "거짓",
+  "짓말",
+  "실은",
+  "은받",
+  "그치",
+  "을까",
+  "까어",
+  "차에",
+  "르지",
+  "가까",
+  "론이",
+  "학교",
+  "경찰",
+  "숨을",
+  "했다",
+  "많아",
+  "떨어",
+  "을말",
+  "는만",
+  "화가",
+  "찾았",
+  "히아",
+  "을세",
+  "니었",
+  "마이",
+  "리무",
+  "을만",
+  "는얼",
+  "사진",
+  "원에",
+  "다바",
+  "다자",
+  "가만",
+  "연하",
+  "보이",
+  "노래",
+  "계획",
+  "에됐",
+  "있거",
+  "거든",
+  "실을",
+  "요누",
+  "크리",
+  "리스",
+  "갔어",
+  "이고",
+  "고상",
+  "상관",
+  "일하",
+  "사건",
+  "죠아",
+  "가가",
+  "다신",
+  "이놈",
+  "은하",
+  "의사",
+  "박사",
+  "사님",
+  "님나",
+  "는딸",
+  "보내",
+  "인생",
+  "는정",
+  "고한",
+  "았다",
+  "었다",
+  "다곳",
+  "없으",
+  "리와",
+  "이사",
+  "지이",
+  "이쪽",
+  "쪽으",
+  "서들",
+  "군요",
+  "같군",
+  "똑같",
+  "은가",
+  "가능",
+  "아해",
+  "라도",
+  "움직",
+  "을모",
+  "겠네",
+  "울만",
+  "남편",
+  "희들",
+  "려있",
+  "이없",
+  "안하",
+  "서친",
+  "문이",
+  "달라",
+  "이러",
+  "시아",
+  "아야",
+  "싶었",
+  "해하",
+  "나만",
+  "는게",
+  "다좋",
+  "래모",
+  "거니",
+  "고거",
+  "는죽",
+  "녀석",
+  "몰랐",
+  "랐어",
+  "좋네",
+  "은사",
+  "들에",
+  "겠다",
+  "관심",
+  "이오",
+  "나면",
+  "냄새",
+  "인간",
+  "번도",
+  "러는",
+  "확인",
+  "닌가",
+  "라는",
+  "할아",
+  "이들",
+  "야선",
+  "네의",
+  "않지",
+  "가질",
+  "고지",
+  "의해",
+  "간에",
+  "어할",
+  "할싶",
+  "안전",
+  "를하",
+  "파티",
+  "데그",
+  "버려",
+  "진심",
+  "장님",
+  "무기",
+  "않나",
+  "라면",
+  "있단",
+  "건을",
+  "무서",
+  "말인",
+  "인지",
+  "질문",
+  "한데",
+  "없나",
+  "심이",
+  "음엔",
+  "어젯",
+  "젯밤",
+  "을바",
+  "전하",
+  "나보",
+  "종일",
+  "최근",
+  "그난",
+  "난내",
+  "내안",
+  "안수",
+  "수이",
+  "이네",
+  "네거",
+  "야좀",
+  "좀그",
+  "래있",
+  "왜더",
+  "더그",
+  "고우",
+  "리다",
+  "다무",
+  "슨한",
+  "만잘",
+  "잘어",
+  "게할",
+  "할그",
+  "그냥",
+  "냥정",
+  "말그",
+  "럼것",
+  "것게",
+  "는해",
+  "해여",
+  "기넌",
+  "넌제",
+  "가날",
+  "날우",
+  "가건",
+  "건전",
+  "전이",
+  "제지",
+  "금그",
+  "그게",
+  "게걸",
+  "걸거",
+  "거아",
+  "니네",
+  "가없",
+  "어돼",
+  "돼저",
+  "우린",
+  "린제",
+  "제못",
+  "못좋",
+  "아당",
+  "다른",
+  "른나",
+  "나그",
+  "런그",
+  "그건",
+  "건너",
+  "너무",
+  "무그",
+  "래서",
+  "시이",
+  "이건",
+  "건이",
+  "이런",
+  "런나",
+  "도모",
+  "든당",
+  "신거",
+  "거예",
+  "신은",
+  "아좋",
+  "오때",
+  "때너",
+  "너하",
+  "는하",
+  "아냐",
+  "냐나",
+  "니야",
+  "야알",
+  "아같",
+  "이응",
+  "응이",
+  "이게",
+  "요괜",
+  "아오",
+  "늘말",
+  "야줄",
+  "줄또",
+  "또널",
+  "널누",
+  "누가",
+  "가어",
+  "어떤",
+  "떤아",
+  "아주",
+  "주말",
+  "직안",
+  "돼진",
+  "짜모",
+  "두마",
+  "마같",
+  "은여",
+  "서어",
+  "그는",
+  "는위",
+  "요일",
+  "마바",
+  "가근",
+  "근데",
+  "알고",
+  "이렇",
+  "게빨",
+  "빨리",
+  "다이",
+  "거전",
+  "에어",
+  "아뇨",
+  "뇨계",
+  "계속",
+  "속닥",
+  "닥터",
+  "터얼",
+  "마나",
+  "나될",
+  "될알",
+  "아제",
+  "발있",
+  "지겁",
+  "디사",
+  "그가",
+  "가안",
+  "녕좋",
+  "요같",
+  "아우",
+  "래요",
+  "자그",
+  "걸두",
+  "두아",
+  "니에",
+  "을때",
+  "문에",
+  "에대",
+  "빠몇",
+  "몇사",
+  "람했",
+  "어뭐",
+  "뭐야",
+  "야수",
+  "수도",
+  "도많",
+  "많이",
+  "이집",
+  "에거",
+  "거지",
+  "일을",
+  "을저",
+  "저는",
+  "는음",
+  "음그",
+  "지함",
+  "함께",
+  "께만",
+  "약하",
+  "나저",
+  "기고",
+  "요항",
+  "항상",
+  "상나",
+  "나한",
+  "테잠",
+  "깐가",
+  "서가",
+  "가장",
+  "장돼",
+  "거죠",
+  "죠가",
+  "자맞",
+  "아보",
+  "보고",
+  "고와",
+  "거말",
+  "을괜",
+  "무도",
+  "도없",
+  "는안",
+  "녕하",
+  "요몰",
+  "라일",
+  "일많",
+  "많은",
+  "은당",
+  "의아",
+  "무것",
+  "도그",
+  "까큰",
+  "큰알",
+  "그의",
+  "의뭐",
+  "뭐가",
+  "워그",
+  "요젠",
+  "젠장",
+  "장사",
+  "거에",
+  "걸그",
+  "그럴",
+  "럴것",
+  "도말",
+  "미야",
+  "야그",
+  "그를",
+  "를뭔",
+  "가온",
+  "온이",
+  "니면",
+  "면같",
+  "런데",
+  "라세",
+  "고뭐",
+  "고예",
+  "예절",
+  "대말",
+  "말야",
+  "당장",
+  "장그",
+  "은거",
+  "기전",
+  "전부",
+  "부둘",
+  "둘그",
+  "녀는",
+  "는니",
+  "기있",
+  "있죠",
+  "죠하",
+  "면가",
+  "지고",
+  "이참",
+  "참너",
+  "너도",
+  "도됐",
+  "어미",
+  "해것",
+  "여긴",
+  "긴아",
+  "무사",
+  "람은",
+  "은감",
+  "사합",
+  "다다",
+  "다들",
+  "때씨",
+  "씨곧",
+  "곧엄",
+  "마가",
+  "가나",
+  "를이",
+  "이젠",
+  "젠아",
+};
+const uint16_t WA_FREQ_80_RANKS[] = {
+  195, 0, 0, 0, 0, 0, 462, 0, 0, 487, 271, 837, 958, 0, 0, 530,
+  0, 0, 953, 0, 0, 0, 0, 0, 0, 282, 0, 364, 0, 894, 0, 0,
+  0, 0, 622, 0, 473, 0, 0, 0, 0, 0, 0, 524, 458, 538, 836, 0,
+  0, 66, 987, 0, 798, 0, 808, 0, 0, 884, 0, 0, 0, 0, 0, 941,
+  0, 412, 865, 0, 0, 933, 0, 733, 0, 48, 669, 0, 0, 768, 778, 0,
+  0, 0, 604, 0, 309, 7, 189, 981, 0, 596, 171, 262, 959, 27, 0, 398,
+  0, 526, 0, 613, 0, 746, 0, 0, 986, 134, 446, 0, 651, 771, 261, 409,
+  979, 0, 0, 901, 67, 0, 0, 0, 0, 0, 0, 119, 140, 118, 0, 0,
+  275, 385, 0, 280, 338, 753, 0, 481, 455, 0, 0, 0, 0, 652, 0, 984,
+  0, 0, 705, 254, 883, 706, 129, 0, 990, 0, 120, 0, 288, 0, 184, 0,
+  0, 0, 0, 0, 0, 805, 0, 0, 39, 0, 115, 291, 391, 696, 842, 529,
+  947, 0, 0, 0, 0, 0, 0, 852, 411, 690, 748, 0, 0, 772, 0, 0,
+  0, 0, 479, 0, 0, 489, 0, 96, 890, 0, 0, 33, 0, 0, 727, 0,
+  0, 38, 60, 164, 352, 86, 707, 809, 975, 965, 123, 0, 0, 708, 858, 898,
+  0, 0, 795, 0, 0, 0, 0, 0, 341, 0, 978, 0, 0, 429, 0, 0,
+  177, 591, 943, 0, 0, 0, 316, 0, 0, 173, 588, 713, 0, 0, 182, 0,
+  484, 465, 687, 521, 608, 877, 0, 0, 0, 763, 0, 0, 0, 307, 721, 131,
+  932, 0, 0, 0, 578, 69, 0, 0, 0, 0, 647, 403, 697, 0, 682, 0,
+  0, 0, 0, 0, 0, 875, 139, 496, 333, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 40, 0, 44, 0, 684, 0, 43, 255, 0, 0, 19, 102,
+  9, 413, 828, 919, 0, 0, 0, 0, 0, 0, 463, 612, 299, 209, 278, 328,
+  560, 625, 793, 607, 586, 632, 752, 911, 966, 0, 0, 0, 196, 226, 447, 47,
+  372, 500, 747, 57, 581, 0, 0, 0, 0, 0, 0, 0, 128, 0, 377, 614,
+  0, 340, 419, 163, 952, 0, 323, 0, 30, 276, 320, 90, 0, 0, 0, 0,
+  0, 346, 0, 661, 0, 0, 0, 0, 146, 917, 522, 741, 816, 802, 251, 0,
+  263, 0, 0, 0, 0, 0, 792, 0, 221, 315, 711, 0, 0, 0, 562, 0,
+  750, 970, 0, 0, 470, 0, 0, 0, 0, 822, 0, 0, 0, 0, 407, 656,
+  844, 0, 0, 0, 268, 329, 452, 0, 0, 0, 0, 702, 153, 360, 281, 0,
+  366, 24, 138, 224, 498, 467, 0, 0, 112, 688, 0, 0, 0, 0, 0, 289,
+  920, 0, 670, 0, 361, 0, 0, 0, 0, 64, 515, 796, 297, 736, 939, 951,
+  85, 0, 554, 453, 534, 154, 0, 369, 0, 451, 0, 674, 98, 819, 0, 0,
+  235, 0, 507, 0, 0, 0, 348, 0, 0, 0, 525, 605, 889, 0, 800, 760,
+  0, 0, 559, 0, 751, 540, 0, 0, 871, 324, 542, 0, 107, 29, 408, 437,
+  882, 874, 934, 937, 0, 317, 0, 0, 0, 1000, 0, 0, 0, 621, 121, 0,
+  0, 426, 0, 0, 0, 0, 0, 217, 0, 0, 0, 326, 0, 655, 0, 0,
+  0, 0, 0, 0, 968, 0, 42, 310, 908, 758, 376, 322, 234, 494, 811, 0,
+  0, 0, 0, 0, 501, 818, 0, 393, 199, 205, 157, 314, 176, 152, 602, 665,
+  790, 145, 851, 535, 242, 0, 924, 466, 503, 0, 170, 0, 0, 638, 0, 0,
+  172, 0, 230, 264, 390, 238, 461, 520, 0, 0, 252, 0, 283, 6, 620, 998,
+  256, 695, 0, 0, 241, 0, 0, 0, 0, 720, 0, 907, 392, 0, 548, 0,
+  0, 830, 300, 335, 624, 186, 0, 0, 72, 646, 876, 0, 0, 0, 0, 644,
+  0, 0, 0, 0, 0, 823, 0, 0, 0, 0, 0, 810, 623, 817, 246, 0,
+  28, 225, 296, 311, 370, 433, 0, 31, 73, 0, 0, 0, 0, 0, 482, 249,
+  0, 0, 0, 0, 220, 0, 414, 0, 405, 239, 0, 0, 0, 0, 0, 394,
+  0, 302, 490, 929, 557, 980, 0, 0, 0, 0, 0, 0, 97, 0, 0, 8,
+  510, 0, 0, 0, 0, 287, 550, 681, 0, 0, 0, 110, 61, 0, 0, 450,
+  0, 846, 0, 0, 583, 856, 0, 584, 0, 231, 0, 0, 0, 0, 0, 0,
+  743, 0, 843, 0, 248, 103, 355, 491, 532, 766, 70, 54, 386, 635, 787, 666,
+  864, 0, 0, 0, 0, 785, 0, 293, 756, 777, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 460, 812, 641, 723, 0, 0, 0, 0, 672, 0, 216, 561,
+  955, 0, 0, 645, 0, 143, 0, 0, 732, 0, 0, 477, 0, 0, 122, 910,
+  905, 0, 443, 0, 0, 158, 0, 680, 0, 689, 0, 572, 539, 0, 0, 0,
+  0, 0, 0, 89, 0, 855, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 731, 0, 0, 0, 165, 671, 457, 566, 694, 188, 954, 427, 668, 36,
+  775, 957, 0, 0, 0, 0, 22, 428, 579, 431, 734, 126, 169, 849, 931, 657,
+  983, 0, 0, 32, 642, 448, 378, 862, 868, 0, 0, 0, 0, 0, 847, 0,
+  0, 0, 0, 887, 5, 0, 236, 654, 659, 218, 15, 0, 486, 0, 0, 389,
+  0, 0, 0, 440, 52, 505, 0, 0, 0, 0, 729, 643, 358, 779, 0, 0,
+  0, 0, 0, 168, 237, 260, 499, 527, 794, 0, 0, 0, 0, 347, 0, 764,
+  0, 0, 0, 0, 709, 0, 34, 77, 245, 0, 0, 0, 0, 0, 825, 1,
+  0, 597, 0, 0, 0, 664, 744, 0, 0, 439, 963, 0, 0, 0, 0, 537,
+  92, 976, 627, 0, 0, 903, 0, 166, 789, 0, 0, 0, 0, 0, 365, 567,
+  0, 0, 0, 0, 0, 949, 0, 0, 511, 357, 918, 0, 0, 0, 0, 587,
+  318, 551, 206, 84, 714, 556, 653, 334, 888, 992, 167, 201, 0, 117, 915, 0,
+  0, 0, 0, 0, 0, 0, 0, 573, 0, 0, 384, 399, 485, 183, 861, 0,
+  0, 71, 0, 0, 0, 0, 0, 0, 835, 79, 125, 356, 20, 362, 565, 658,
+  434, 824, 899, 906, 472, 0, 0, 144, 292, 0, 0, 91, 0, 111, 0, 0,
+  400, 142, 469, 749, 633, 0, 974, 0, 65, 615, 136, 383, 0, 374, 967, 0,
+  0, 0, 0, 0, 0, 76, 0, 0, 0, 926, 0, 0, 678, 14, 132, 207,
+  0, 0, 859, 0, 589, 0, 0, 569, 0, 468, 969, 742, 0, 108, 114, 124,
+  582, 179, 971, 174, 533, 0, 0, 0, 0, 0, 0, 0, 719, 0, 0, 0,
+  0, 417, 0, 0, 0, 0, 912, 0, 0, 0, 436, 312, 406, 0, 10, 200,
+  896, 0, 938, 56, 564, 0, 0, 0, 0, 327, 0, 628, 0, 0, 0, 0,
+  156, 866, 325, 0, 483, 0, 330, 0, 0, 950, 0, 0, 650, 982, 0, 266,
+  944, 162, 0, 0, 0, 601, 902, 0, 0, 0, 0, 0, 0, 0, 0, 381,
+  354, 761, 807, 523, 735, 0, 513, 577, 93, 0, 215, 870, 776, 0, 0, 0,
+  0, 105, 259, 841, 0, 0, 0, 845, 869, 0, 0, 78, 923, 893, 480, 0,
+  0, 0, 247, 575, 0, 960, 418, 773, 0, 11, 257, 867, 784, 927, 0, 803,
+  0, 997, 0, 0, 109, 570, 715, 726, 762, 0, 0, 0, 0, 0, 99, 35,
+  250, 0, 0, 0, 0, 0, 0, 0, 349, 0, 0, 232, 404, 198, 456, 848,
+  50, 0, 449, 308, 336, 528, 396, 568, 703, 737, 304, 0, 0, 0, 0, 133,
+  420, 806, 0, 294, 0, 767, 0, 0, 0, 0, 0, 192, 0, 0, 0, 337,
+  0, 0, 286, 0, 0, 0, 0, 831, 0, 0, 0, 26, 0, 618, 913, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 631, 536, 0, 0, 155, 219, 854, 781,
+  0, 0, 81, 0, 0, 0, 0, 0, 0, 233, 0, 0, 459, 648, 18, 332,
+  106, 272, 685, 0, 0, 0, 936, 553, 991, 791, 0, 267, 804, 0, 270, 897,
+  0, 0, 0, 0, 985, 0, 265, 0, 0, 0, 0, 701, 23, 430, 363, 683,
+  895, 606, 0, 0, 0, 0, 0, 0, 454, 512, 636, 0, 0, 0, 0, 0,
+  900, 945, 925, 0, 0, 0, 80, 814, 0, 0, 0, 379, 0, 0, 765, 0,
+  0, 211, 343, 770, 0, 769, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  25, 0, 0, 544, 0, 0, 269, 306, 353, 478, 273, 676, 397, 827, 745, 194,
+  0, 545, 0, 0, 0, 839, 0, 0, 0, 0, 0, 0, 0, 0, 722, 0,
+  476, 342, 0, 0, 0, 0, 197, 319, 517, 640, 0, 838, 0, 799, 988, 0,
+  416, 0, 0, 0, 151, 444, 321, 774, 0, 422, 175, 0, 0, 0, 0, 506,
+  704, 0, 0, 0, 0, 663, 0, 0, 130, 0, 0, 962, 626, 0, 0, 0,
+  0, 0, 415, 432, 0, 213, 0, 0, 0, 0, 0, 0, 821, 0, 0, 815,
+  0, 0, 0, 0, 0, 298, 662, 0, 0, 51, 0, 0, 0, 0, 0, 0,
+  0, 0, 873, 0, 0, 0, 546, 17, 0, 0, 0, 0, 191, 210, 724, 0,
+  0, 0, 0, 0, 502, 160, 285, 717, 977, 725, 0, 0, 0, 0, 0, 0,
+  0, 58, 243, 0, 0, 0, 0, 904, 150, 0, 0, 0, 497, 0, 508, 0,
+  181, 834, 886, 940, 0, 0, 0, 53, 673, 313, 0, 0, 301, 0, 0, 0,
+  0, 290, 21, 710, 0, 104, 212, 303, 0, 698, 0, 0, 0, 178, 519, 0,
+  0, 0, 857, 0, 718, 629, 693, 914, 0, 0, 0, 253, 599, 0, 0, 0,
+  728, 0, 972, 0, 0, 826, 0, 441, 0, 0, 801, 0, 148, 0, 368, 0,
+  788, 0, 274, 2, 0, 435, 0, 0, 0, 0, 295, 0, 371, 345, 571, 754,
+  63, 359, 240, 782, 948, 0, 87, 75, 193, 395, 0, 0, 0, 880, 630, 0,
+  0, 0, 0, 380, 277, 547, 373, 0, 999, 679, 113, 185, 700, 916, 0, 0,
+  0, 0, 222, 0, 0, 840, 284, 0, 0, 0, 0, 0, 0, 0, 585, 0,
+  0, 0, 639, 686, 531, 0, 0, 0, 0, 0, 493, 730, 850, 509, 49, 229,
+  863, 909, 141, 0, 996, 616, 137, 0, 0, 0, 716, 0, 0, 0, 563, 88,
+  555, 964, 649, 610, 0, 0, 127, 0, 0, 0, 0, 382, 0, 0, 488, 445,
+  0, 0, 0, 0, 159, 0, 0, 367, 935, 0, 0, 0, 258, 677, 961, 860,
+  0, 244, 375, 738, 0, 0, 0, 279, 0, 0, 0, 223, 853, 0, 0, 0,
+  518, 0, 611, 442, 0, 0, 495, 0, 0, 492, 12, 0, 0, 0, 0, 83,
+  0, 881, 351, 558, 0, 0, 0, 0, 0, 0, 0, 0, 331, 0, 401, 59,
+  0, 203, 829, 0, 0, 464, 541, 474, 543, 885, 598, 475, 942, 0, 878, 0,
+  660, 187, 832, 339, 930, 149, 94, 0, 552, 62, 68, 892, 0, 0, 0, 922,
+  0, 0, 594, 438, 549, 100, 180, 740, 0, 0, 424, 0, 0, 0, 0, 101,
+  388, 593, 755, 0, 0, 13, 516, 135, 813, 783, 0, 574, 0, 833, 0, 580,
+  0, 0, 55, 0, 691, 0, 0, 0, 421, 0, 147, 0, 0, 0, 4, 780,
+  956, 0, 227, 161, 208, 619, 0, 423, 0, 592, 350, 3, 0, 0, 0, 0,
+  0, 0, 609, 0, 0, 0, 0, 0, 0, 675, 993, 0, 0, 0, 228, 0,
+  514, 74, 590, 0, 95, 0, 0, 637, 0, 425, 973, 820, 0, 46, 786, 995,
+  0, 0, 45, 603, 879, 0, 0, 41, 116, 190, 699, 797, 928, 759, 891, 989,
+  595, 994, 0, 402, 634, 0, 0, 0, 0, 0, 0, 872, 576, 617, 0, 0,
+  0, 214, 504, 739, 0, 0, 0, 0, 0, 667, 37, 204, 0, 0, 0, 0,
+  0, 202, 0, 0, 0, 410, 387, 16, 0, 0, 0, 0, 921, 0, 0, 0,
+  344, 600, 0, 0, 0, 692, 712, 757, 0, 471, 0, 0, 946, 82, 305, 0,
+};
+
+const char *WA_FREQ_81_TOKENS[] = {
+  "छु",
+  "अख",
+  "چھُ",
+  "अस्‍ति",
+  "देश",
+  "آکھ",
+  "मंज",
+  "मंज़",
+  "تہٕ",
+  "त॒",
+  "ओस",
+  "چھُہ",
+  "यि",
+  "मुलुख",
+  "प्रदेश",
+  "अमेरिका",
+  "منٛز",
+  "महाद्वीपे",
+  "एक",
+  "منز",
+  "پٮ۪ٹھ",
+  "मशहूर",
+  "چھہ",
+  "छ",
+  "छि",
+  "यथ",
+  "چائ",
+  "اکھ",
+  "अफ्रीका-महाद्वीपे",
+  "एशिया-महाद्वीपे",
+  "त",
+  "राजधानी",
+  "सुन्‍द",
+  "چھ",
+  "छु।",
+  "यूनिकोड",
+  "सदी",
+  "اَکھ",
+  "عیسیٰ",
+  "و",
+  "یُس",
+  "یہٕ",
+  "एशिया",
+  "यूरोप",
+  "بپتسمہ",
+  "سٍتـ̡",
+  "شہر",
+  "چُھ",
+  "چُھہ",
+  "یہ",
+  "ति",
+  "of",
+  "از",
+  "تہِ",
+  "خٲطرٕ",
+  "سرینگر",
+  "شَہَر۔",
+  "چھَ",
+  "کشمیر",
+  "کِس",
+  "ہے",
+  "अफ्रीका-",
+  "कॉशुर",
+  "बोड",
+  "भारत",
+  "वनान",
+  "शेख",
+  "स॒त्य्",
+  "and",
+  "آغہٕ",
+  "اوس",
+  "در",
+  "عیسٲے",
+  "قٕسم",
+  "مُلک",
+  "مِشیٖن",
+  "پَتہٕ",
+  "چھؙ",
+  "کے",
+  "یا",
+  "یِوان",
+  "یہِ",
+  "आज़कलुक",
+  "कशीर",
+  "नगर",
+  "पॆठ",
+  "बापथ",
+  "बैक्जे",
+  "युस",
+  "सु",
+  "جاناوار",
+  "جموں",
+  "جٔنوٗبی",
+  "دارالحکومت",
+  "دوران",
+  "سُند",
+  "سُہ",
+  "فَن۔",
+  "لَچھ",
+  "مانز",
+  "مسیح",
+  "مشہور",
+  "منج",
+  "واقع۔",
+  "کرنہٕ",
+  "کلومیٹر",
+  "کلیسا",
+  "که",
+  "کُل",
+  "ہندُستٲنُک",
+  "ہُنٛد",
+  "अब्‍दुल्‍ला",
+  "अस्‍य",
+  "आव",
+  "इस्तिमाल",
+  "ऎनकोडिंग",
+  "कशीरुक",
+  "चीनी",
+  "ज़ि",
+  "दक्षिण",
+  "दक्षिणे-पूर्वे",
+  "नाव",
+  "पत॒",
+  "प्यठ",
+  "प्रशान्‍त",
+  "बादशाहतन",
+  "बादशाहत॒",
+  "महासागरे",
+  "या",
+  "रियासत",
+  "वार्याहन",
+  "सिला",
+  "हिन्दोस्तानुक",
+  "‍देश",
+  "Lake",
+  "samaguka",
+  "اس",
+  "است",
+  "اننتناگ",
+  "اَفریٖقہ",
+  "اَمٮُ۪ک",
+  "ایوان",
+  "اے",
+  "اے۔",
+  "باقی",
+  "بودھ",
+  "بًارت",
+  "تام",
+  "ترال",
+  "تٖ",
+  "تھزر",
+  "تی",
+  "تے",
+  "حضرت",
+  "دِنہٕ",
+  "دۅہہٕ",
+  "ریاضیات",
+  "زندگی",
+  "زَبان",
+  "ستۍ",
+  "سید",
+  "شاہ",
+  "ضِلَس",
+  "مِسر",
+  "ناو",
+  "نجات",
+  "نگر",
+  "وول،",
+  "وۄل",
+  "پاک",
+  "پاکستان",
+  "پردےش",
+  "پُلوۄم",
+  "چہُ",
+  "کُن",
+  "کٲشُر",
+  "کھۅر",
+  "کی",
+  "ہُند",
+  "یاتھ",
+  "یاد",
+  "یتھ",
+  "یوان",
+  "یێلہِ",
+  "अस",
+  "आस॒",
+  "ई॰",
+  "उत्तर",
+  "एशिया-महाद्वीपस",
+  "ऑस",
+  "कब्ज़॒",
+  "करान",
+  "कॅर",
+  "कॅरिथ",
+  "खास",
+  "गया",
+  "गोगुर्यो",
+  "ग्रन्‍थ",
+  "ज़बानन",
+  "ज़॒",
+  "तथ",
+  "त्रॆ",
+  "दक्षिण-अमेरिका",
+  "दक्षिणे",
+  "दिल्ली",
+  "धर्म",
+  "प्यठ॒",
+  "प्रानि",
+  "बनोव",
+  "बाग",
+  "बॊड",
+  "बौद्ध-धर्म",
+  "भारतीय",
+  "मगर",
+  "मध्‍ये",
+  "मुगल",
+  "मुहम्मद",
+  "यूरोप-महाद्वीपे",
+  "राज़दॉनी",
+  "वार॒",
+  "विंडोज़",
+  "शहर",
+  "शहरस",
+  "शायर",
+  "समगुक",
+  "सारनि",
+  "हर्फन",
+  "हुंद",
+  "१निचि",
+  "10646स",
+  "29",
+  "50",
+  "Acacia",
+  "E",
+  "ISO/IEC",
+  "London",
+  "N",
+  "National",
+  "Russia",
+  "S.A.",
+  "See",
+  "a",
+  "chu",
+  "lakes",
+  "man̄za",
+  "motto",
+  "mulaka.",
+  "nāva",
+  "آبس",
+  "آبہٕ",
+  "آتھ",
+  "آخری",
+  "آزاد",
+  "آسہِ،",
+  "آن",
+  "آو",
+  "آکہ",
+  "اتھ",
+  "اخ",
+  "ارب",
+  "اريِ",
+  "استعمال",
+  "اسلامی",
+  "انڈمان",
+  "انڈمان تٔ نِکوبار",
+  "اور",
+  "اوسط",
+  "اک",
+  "اہم",
+  "ایکیشیا",
+  "بارامولا",
+  "بر",
+  "به",
+  "بًآرت",
+  "بَرِصٔغیٖر۔",
+  "بێیہِ",
+  "تس",
+  "تعریف",
+  "تِہ",
+  "تٔ",
+  "ثى۪قہ",
+  "جمو",
+  "حصَن",
+  "حصہ",
+  "حٲصل",
+  "خدایہ",
+  "خدایہِ",
+  "دلھی",
+  "دور",
+  "دور۔",
+  "دُبارٕ",
+  "دۄدٕ",
+  "دۅہ،",
+  "دی",
+  "دیوی",
+  "دیگری",
+  "را",
+  "رالاونی",
+  "رسم۔",
+  "رود",
+  "روزان۔",
+  "روٝحہِ",
+  "رِیاسَت",
+  "ریاست",
+  "ریلوے",
+  "زبان",
+  "زَبان۔",
+  "زیادٕ",
+  "ساتھ",
+  "سالانہٕ",
+  "سری",
+  "سَبزی",
+  "سٕندِ",
+  "سۄ",
+  "سیٚپٹَمبَر",
+  "سے",
+  "شاردا",
+  "شری",
+  "شَہَر",
+  "شٲمل",
+  "شہرَس",
+  "شہر۔",
+  "صدی",
+  "علاقہٕ",
+  "علاوٕ",
+  "علی",
+  "فَنہِ",
+  "فٹ",
+  "قبل",
+  "قدیم",
+  "لوٗکھ",
+  "لَگبَگ",
+  "لچھ",
+  "مارتند",
+  "مشہور۔",
+  "مقدس",
+  "مندِر",
+  "مںز",
+  "مۄکھہٕ",
+  "میر",
+  "میرپور",
+  "میل",
+  "میلہ",
+  "میٹر",
+  "میٹر۔",
+  "میں",
+  "می‌گوییم",
+  "ناگَن",
+  "نه",
+  "نِکوبار",
+  "وادی",
+  "وجودَس",
+  "ونان",
+  "ونن",
+  "وَری",
+  "ٲسۍ",
+  "پاکِستانُک",
+  "پت",
+  "پر",
+  "پنجابی",
+  "پٲٹۍ",
+  "پھِرـ̡",
+  "چ",
+  "چنی",
+  "چھِ",
+  "چھہٕ",
+  "چھےٚ",
+  "چہُہ",
+  "ڈاکٹر",
+  "کشمیرُک",
+  "کَتھ",
+  "کَرٕنۍ۔",
+  "کٮ۪ن",
+  "کٮ۪نٛہ",
+  "کٲڈ",
+  "کھۄتہٕ",
+  "کہ",
+  "کہِ",
+  "کۄر",
+  "کیوٚم",
+  "گژھِ",
+  "گژھہ",
+  "گژھہِ",
+  "ہندوستان",
+  "ہندِ",
+  "ہُہ",
+  "ہِندوستانُک",
+  "یس",
+  "یوسف",
+  "یونیورسٹی",
+  "یَتہِ",
+  "یٔمِس",
+  "یی",
+  "ییہِ",
+  "ےتٛ",
+  "۳",
+  "۴٠",
+  "अकिस",
+  "अजकल",
+  "अथ",
+  "अफ्रीका",
+  "अलग",
+  "आज़ाद",
+  "आज़ॉदी",
+  "इकबाल",
+  "इति",
+  "इस्ताद॒",
+  "ईजिप्ट",
+  "उत्तर अमेरिका",
+  "उत्तर-अमेरिका-महाद्वीपे",
+  "एनम्‌",
+  "ऐन्",
+  "ऑस्य्",
+  "करोड",
+  "कर॒न॒",
+  "कवि",
+  "कश्‍मीर",
+  "कालिज",
+  "किताब",
+  "किस",
+  "केरिबियन-क्षेत्रे",
+  "कॊर",
+  "कोड",
+  "कोरियन",
+  "क्याह",
+  "क्षेत्रे",
+  "खॊत॒",
+  "खोत",
+  "गव",
+  "गीत",
+  "च",
+  "छुय",
+  "ज़बान",
+  "ज़बानि",
+  "ज़बान॒",
+  "जान",
+  "जाव",
+  "तीर्थस्थान",
+  "तॅम्य्",
+  "तेमसंज",
+  "देवनागरी",
+  "दौर",
+  "नदी",
+  "नि",
+  "निश",
+  "निशि",
+  "नेपाल",
+  "पत",
+  "पश्‍चिमक्षेत्रे",
+  "पेनिनसूला",
+  "प्रथ",
+  "प्राचीन",
+  "प्रोन",
+  "फारूख",
+  "बज़ात",
+  "बादशाह",
+  "बार॒",
+  "बेसबाल",
+  "ब्रोंठ",
+  "भाषा",
+  "मध्‍यक्षेत्रे",
+  "महान",
+  "मान॒न॒",
+  "मीलिथ",
+  "मुलक",
+  "मुल्कन",
+  "मेन",
+  "मोहन",
+  "यालू",
+  "यिमन",
+  "यिवान",
+  "यॆम्युक",
+  "रवीन्द्रनाथ",
+  "राम",
+  "रॅलिथ",
+  "लडक",
+  "लद्दाख",
+  "लेखक",
+  "लेख॒न॒",
+  "वजीर",
+  "वार्याह",
+  "विकिपीडिया",
+  "वुछिव",
+  "शहर।",
+  "संज",
+  "सप॒दान",
+  "सम्बन्धित",
+  "सरकॉरी",
+  "सहज",
+  "सारिन॒य",
+  "सारिव॒य",
+  "सुंज",
+  "स्टैण्डर्ड",
+  "स॒तय्",
+  "हंज",
+  "हर्फी",
+  "हान",
+  "हिन्‍दोस्‍तानुक",
+  "हिसस",
+  "ह॒न्दिस",
+  "१५",
+  "६६८स",
+  "1.3",
+  "110",
+  "129لَچھ",
+  "1509",
+  "1812-1877",
+  "1846",
+  "1861-1941",
+  "1877-1938",
+  "1903-1948",
+  "1907-1979",
+  "1917تس",
+  "1925-1972",
+  "1929",
+  "1932",
+  "1943",
+  "1980",
+  "1996",
+  "2000",
+  "2003",
+  "214",
+  "25",
+  "2،500",
+  "33.73",
+  "33.88N",
+  "33.93",
+  "345",
+  "34N74E",
+  "503sa",
+  "6",
+  "60",
+  "74.92E",
+  "75.1",
+  "75.15",
+  "8859",
+  "Academic",
+  "Al-Mamlakah",
+  "An",
+  "Astrology",
+  "BSD",
+  "Baikal",
+  "Birkher",
+  "Book",
+  "Boston",
+  "Brown",
+  "Cardona",
+  "Dhanesh",
+  "English/German",
+  "Federátsiya",
+  "General",
+  "George",
+  "Green",
+  "Hindi",
+  "Hrsg",
+  "ISO",
+  "ISOस",
+  "ITRANS",
+  "ITRANS scheme",
+  "Ichirō",
+  "In",
+  "India؛",
+  "Introduction",
+  "Jain",
+  "Kluwer",
+  "Ladoga",
+  "Lahore",
+  "List",
+  "Longman",
+  "Longmans",
+  "Major",
+  "Manuel",
+  "Mass.",
+  "Minerva",
+  "NT",
+  "New",
+  "Noriega",
+  "Norton",
+  "Onega",
+  "Publishers",
+  "Rivers",
+  "Rossíya",
+  "Rossíyskaya",
+  "Routledge",
+  "Sandbox",
+  "Shop",
+  "Suzuki",
+  "TeX",
+  "This",
+  "U",
+  "UTF-16",
+  "UTF-8",
+  "Utah",
+  "W.W.",
+  "X",
+  "XP",
+  "York",
+  "al-'Arabiyah",
+  "as-Sa'udiyah",
+  "bādaśāhata",
+  "bōḍa",
+  "cha",
+  "code",
+  "collections",
+  "critic",
+  "drepanolobium",
+  "duniyā-uka",
+  "encyclopedia",
+  "essayist",
+  "essays",
+  "founder",
+  "historian",
+  "historical",
+  "in",
+  "include",
+  "is",
+  "istimāla",
+  "jayatē",
+  "karana",
+  "khōta",
+  "kitābana",
+  "literary",
+  "literature",
+  "man̄ja",
+  "mathematics",
+  "microprocessor",
+  "nagara",
+  "novelist",
+  "novels",
+  "numerous",
+  "online",
+  "outline",
+  "page",
+  "penned",
+  "pradēśa",
+  "prān'yana",
+  "rājadhānī",
+  "satyamēva",
+  "scheme",
+  "scholar",
+  "silā",
+  "sp",
+  "sāgī",
+  "sārani",
+  "ta",
+  "thovahŏsa",
+  "translation",
+  "tre",
+  "tākatavara",
+  "vāśiṅgaṭana",
+  "yatha",
+  "yi",
+  "yusā",
+  "yānī",
+  "ōsa",
+  "Российская",
+  "Россия",
+  "Федерация",
+  "آب",
+  "آبادی",
+  "آثار",
+  "آدمـ̡",
+  "آري",
+  "آریپل،",
+  "آسنٕچ",
+  "آسِہ",
+  "آسیہ",
+  "آش",
+  "آفتابَس",
+  "آفتابُک",
+  "آمتۍ",
+  "آمُت",
+  "آمُت۔",
+  "آمیرِکا",
+  "آنچه‌که",
+  "أزکِس",
+  "أسـ̡",
+  "أمہ",
+  "أمہِ",
+  "أکس",
+  "أکـ̡",
+  "أکِس",
+  "ابتداہس",
+  "ات",
+  "اج",
+  "ادا",
+  "ارتٲجہن",
+  "اردٗ",
+  "ازاد",
+  "ازتون",
+  "اسامہ",
+  "استدلال",
+  "استفاده",
+  "اسلام",
+  "اسلامِک",
+  "اسمانس",
+  "اسمانن",
+  "اسمانہٕ",
+  "اسمٲنـ̡",
+  "اسہِ",
+  "اشخاصو",
+  "اشوکَن",
+  "اصول",
+  "اعظمن",
+  "اقبال",
+  "اقوٲمۍ",
+  "السّعوديّة",
+  "العربيّة",
+  "المملكة",
+  "الہام،",
+  "الی",
+  "امان،",
+  "امریٖکاک",
+  "امریکہ",
+  "امن",
+  "امیرآباد،",
+  "امۍ",
+  "امےرِکا",
+  "انجیل",
+  "انجیل،",
+  "انحصار",
+  "انسان",
+  "انسانس",
+  "انسٲنِیتس",
+  "اننت",
+  "انگرعزۍ",
+  "اوسطَس",
+  "اونتی",
+  "اونتۍپورہٕ)۔",
+  "اَدَب",
+  "اَز",
+  "اَمِچے",
+  "اَمیُک",
+  "اَمۍکٮ۪ن",
+  "اَگستہٕ",
+  "اِنچ",
+  "اٮ۪ڑِٹ۔",
+  "اپریل",
+  "اپریٖلہٕ",
+  "اچائی",
+  "اڈٕچھُہ",
+  "اکٲے",
+  "اہَم",
+  "ایشا",
+  "ایشیا",
+  "ایمانہٕ",
+  "این",
+  "ایٖمانہٕ",
+  "ایک",
+  "اییس",
+  "ا۔ر۔",
+  "بئیڈ",
+  "با",
+  "بابرکت",
+  "باتھ",
+  "بادشاح۔",
+  "باقیَن",
+  "بالا،",
+  "باپتٛ",
+  "باپتھ",
+  "باینٖل",
+  "بحٲلی",
+  "بخچٲیِش",
+  "بدکارن",
+  "برونٛہ",
+  "برٚونٛہ۔",
+  "برٛونٹھ",
+  "بسثصضلوخ",
+  "بشر",
+  "بغداد",
+  "بـێیِہ",
+  "بناونہٕ",
+  "بناوٖن",
+  "بنایا",
+  "بنومُت",
+  "بنٲو",
+  "بنیاد",
+  "بنیٲدی",
+  "بنێوو،",
+  "به‌شمار",
+  "بولان",
+  "بولان۔",
+  "بوڈ",
+  "بًآرتسے",
+  "بَمبَے",
+  "بَنٮ۪ومُت",
+  "بَٹھِس",
+  "بَڈھۍ",
+  "بُتھ",
+  "بٹوار)،",
+  "بپرسم؟",
+  "بڈ",
+  "بڈشاہ",
+  "بکار",
+  "بکنگ",
+  "بھارت",
+  "بھارتی",
+  "بۆن",
+  "بیان",
+  "بیجنگس",
+  "بیشتر",
+  "بین",
+  "بۯونٹھ",
+  "تام۔",
+  "تبدیلی",
+  "تتٛ",
+  "تجارتی",
+  "تخمینہ",
+  "ترالکۍ",
+  "تراونی",
+  "ترجمٖ",
+  "ترقی",
+  "ترٚالٕچ",
+  "ترٚٮ۪ن",
+  "ترٚٲو",
+  "ترٚیہ",
+  "ترٛالُک",
+  "ترہونے",
+  "ترین",
+  "تصیل",
+  "تعالی",
+  "تعداد",
+  "تعمیر",
+  "تعمیٖرات",
+  "تقریبا",
+  "تقسیم",
+  "تل",
+  "تمۍ",
+  "تو",
+  "توابع",
+  "تٍم",
+  "تَ",
+  "تَسُند",
+  "تَقریٖب",
+  "تَمۍ",
+  "تُلٕر",
+  "تِمہِ",
+  "تٕ",
+  "تٕہ",
+  "تٲصیل۔",
+  "تٴ",
+  "تھٲوِتھ",
+  "تھین",
+  "تہِ۔",
+  "تیرتھستھان۔",
+  "تیوٝت",
+  "تۯێیمہِ",
+  "ثى۪قہ عیسٲے کلیسا",
+  "ثى۪قہٕ",
+  "جا",
+  "جان",
+  "جانور",
+  "جانوَر",
+  "جاں",
+  "جایہِ",
+  "جاے",
+  "جدیدی",
+  "جنتُک",
+  "جنسنکھیا",
+  "جنم",
+  "جنم۔",
+  "جنگلات",
+  "جوٗنہٕ",
+  "جوڈھان۔",
+  "جُلَے",
+  "جہلم",
+  "جۄم",
+  "حالت",
+  "حببا",
+  "حبٖ",
+  "حبہ",
+  "حجَس",
+  "حرفس",
+  "حصوں",
+  "حمد",
+  "حکمراں۔",
+  "حکومت",
+  "حکومتَن",
+  "حیاتیات",
+  "حیثیت",
+  "حیمالے",
+  "حیندٗ",
+  "حیندۍ",
+  "خاتون،",
+  "خاص",
+  "خان",
+  "ختم",
+  "خدا",
+  "خداین",
+  "خدمت",
+  "خط",
+  "خمیٖرِ",
+  "خواستم",
+  "خود",
+  "خورد",
+  "خوٝنس",
+  "خٕلاف۔",
+  "خٲپرٕ",
+  "دا",
+  "دادرا",
+  "دارد.»",
+  "دارشنک",
+  "دامنه",
+  "دانش",
+  "دانشنامه",
+  "دانشنامهٔ",
+  "دانشهای",
+  "دانشی",
+  "درگذر",
+  "دریا،",
+  "دس",
+  "دست",
+  "دعسحآ؛",
+  "دعسحا۔",
+  "دعوناگرۍ",
+  "دقیق",
+  "دوبھائی",
+  "دود،",
+  "دورَس",
+  "دولت",
+  "دونی",
+  "دٍوناگری",
+  "دَچھ",
+  "دَہ",
+  "دُنـ̡",
+  "دُنیاہَس",
+  "دُيِمِ",
+  "دِنہ",
+  "دِیُن",
+  "دٲن",
+  "دچھہ",
+  "دۄدھ",
+  "دۄیو",
+  "دۆہ",
+  "دیدگاه",
+  "دیدگاه‌های",
+  "دیش۔",
+  "دیصی",
+  "دیلحۍ۔",
+  "دیوا،",
+  "دیور،",
+  "دیُن۔",
+  "دیگر",
+  "دے",
+  "دےٖن",
+  "دۯاو۔",
+  "ذَنہِ",
+  "ذِلُک",
+  "ذِلہٕ",
+  "ذٲژ",
+  "ذکر",
+  "ذیادٕ",
+  "راجدینی",
+  "راجدینی۔",
+  "راجنیتک",
+  "راج۔",
+  "راولپنڈی",
+  "راےن",
+  "رحتٕچ",
+  "رحمتہٕ",
+  "رس",
+  "رسم",
+  "رسمہٕ",
+  "رشته‌ای",
+  "رنگ",
+  "روزمٕژ،",
+  "روش",
+  "روٗس",
+  "روٝح",
+  "روٝحٲنی",
+  "روٝد'کِس",
+  "روپے",
+  "رِياست",
+  "رٔنگـ̡",
+  "رٲیج۔",
+  "رہا",
+  "رہنُما",
+  "رہی۔",
+  "رۄقبہٕ",
+  "رۄکبہٕ",
+  "رۆس",
+  "ریا",
+  "ریاستَس",
+  "ریاستُک",
+  "ریاضی",
+  "ریاضیدانان",
+  "ریل",
+  "رے",
+  "زبانن",
+  "زبانی",
+  "زرخیز",
+  "زماس",
+  "زمانَس",
+  "زمانُک",
+  "زمانکۍبرباد",
+  "زمیٖنہِ",
+  "زن",
+  "زندٕ",
+  "زندگـ̡",
+  "زندگی،",
+};
+const uint16_t WA_FREQ_81_RANKS[] = {
+  0, 0, 0, 118, 311, 72, 485, 915, 366, 0, 0, 216, 61, 0, 0, 0,
+  0, 935, 612, 129, 230, 431, 838, 0, 0, 0, 726, 578, 771, 0, 0, 203,
+  518, 602, 848, 163, 0, 0, 551, 895, 0, 405, 351, 623, 0, 0, 0, 0,
+  0, 0, 240, 356, 0, 0, 0, 873, 0, 0, 633, 649, 830, 321, 967, 0,
+  0, 681, 0, 0, 0, 100, 122, 404, 749, 249, 0, 396, 0, 0, 424, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 474, 5, 0, 0, 0, 762,
+  227, 0, 60, 0, 0, 0, 0, 898, 327, 360, 363, 994, 699, 978, 690, 734,
+  581, 0, 795, 0, 0, 902, 0, 589, 0, 390, 799, 0, 36, 0, 0, 630,
+  0, 0, 0, 237, 15, 433, 963, 0, 0, 0, 0, 0, 853, 82, 828, 0,
+  879, 0, 250, 0, 0, 0, 657, 666, 0, 948, 0, 894, 0, 0, 0, 0,
+  0, 672, 348, 76, 0, 0, 0, 370, 142, 511, 809, 0, 0, 0, 972, 417,
+  186, 576, 632, 0, 0, 0, 77, 986, 297, 521, 0, 0, 0, 0, 615, 0,
+  585, 0, 0, 0, 144, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 155,
+  436, 478, 275, 334, 502, 517, 716, 96, 671, 0, 0, 0, 0, 0, 0, 138,
+  178, 0, 563, 0, 0, 0, 0, 0, 0, 0, 0, 868, 490, 471, 705, 500,
+  637, 884, 0, 655, 910, 904, 931, 983, 0, 384, 220, 717, 298, 452, 624, 95,
+  427, 942, 0, 0, 0, 913, 0, 0, 290, 0, 274, 0, 397, 0, 67, 0,
+  0, 468, 373, 0, 0, 0, 0, 262, 0, 0, 0, 454, 505, 998, 906, 0,
+  0, 945, 0, 0, 354, 0, 387, 486, 0, 166, 852, 0, 613, 0, 989, 0,
+  0, 465, 294, 0, 626, 787, 211, 21, 0, 561, 0, 725, 0, 0, 260, 0,
+  0, 0, 183, 395, 0, 0, 0, 460, 547, 780, 943, 0, 0, 0, 0, 258,
+  442, 0, 524, 0, 816, 754, 0, 0, 731, 969, 0, 445, 839, 0, 16, 35,
+  0, 0, 0, 472, 493, 595, 273, 616, 251, 769, 587, 885, 0, 0, 337, 201,
+  6, 453, 214, 516, 677, 770, 549, 0, 542, 415, 430, 459, 0, 860, 993, 985,
+  0, 0, 0, 0, 934, 333, 0, 0, 0, 0, 0, 0, 0, 42, 0, 0,
+  204, 0, 548, 0, 88, 232, 149, 752, 0, 0, 0, 0, 0, 190, 469, 0,
+  236, 528, 724, 367, 448, 0, 0, 180, 0, 39, 0, 0, 0, 0, 692, 0,
+  147, 936, 0, 242, 379, 538, 697, 599, 781, 0, 0, 130, 133, 901, 0, 0,
+  0, 0, 0, 429, 317, 160, 320, 439, 741, 837, 900, 382, 990, 406, 0, 0,
+  0, 0, 766, 843, 338, 343, 0, 0, 466, 929, 238, 0, 0, 282, 0, 302,
+  0, 0, 0, 2, 892, 560, 79, 0, 0, 0, 0, 0, 355, 0, 0, 47,
+  0, 949, 0, 0, 0, 286, 875, 80, 323, 0, 0, 0, 0, 788, 0, 0,
+  922, 0, 0, 0, 698, 0, 0, 0, 0, 0, 0, 168, 700, 0, 0, 0,
+  0, 0, 0, 0, 106, 0, 974, 0, 583, 856, 0, 0, 0, 0, 103, 0,
+  105, 107, 639, 971, 999, 676, 0, 0, 0, 271, 182, 285, 28, 647, 408, 862,
+  0, 0, 435, 988, 0, 480, 0, 401, 218, 357, 0, 194, 554, 669, 702, 765,
+  281, 341, 840, 385, 956, 114, 785, 0, 414, 927, 0, 0, 276, 353, 25, 512,
+  800, 0, 270, 0, 161, 829, 883, 0, 863, 0, 0, 0, 0, 362, 0, 0,
+  938, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 94, 798, 0, 0, 914,
+  0, 0, 0, 0, 0, 0, 0, 482, 580, 753, 0, 660, 912, 0, 0, 265,
+  0, 0, 0, 12, 0, 0, 0, 0, 703, 0, 359, 0, 0, 0, 0, 664,
+  695, 0, 412, 501, 959, 358, 813, 0, 0, 0, 0, 0, 0, 0, 0, 136,
+  0, 642, 805, 508, 715, 0, 0, 0, 0, 0, 0, 0, 0, 44, 421, 574,
+  0, 0, 0, 0, 71, 364, 0, 0, 579, 306, 608, 117, 0, 767, 0, 0,
+  0, 41, 420, 996, 619, 0, 184, 586, 819, 0, 340, 0, 757, 462, 0, 428,
+  374, 223, 597, 620, 0, 0, 0, 365, 495, 510, 10, 278, 386, 509, 0, 0,
+  0, 0, 916, 0, 0, 0, 882, 0, 0, 0, 0, 0, 0, 861, 679, 0,
+  0, 0, 0, 0, 303, 0, 778, 255, 93, 617, 877, 0, 0, 48, 0, 0,
+  0, 0, 0, 1000, 411, 0, 0, 627, 527, 195, 0, 207, 593, 747, 997, 0,
+  0, 735, 743, 0, 392, 0, 0, 280, 0, 0, 0, 139, 0, 0, 987, 352,
+  683, 0, 451, 0, 667, 0, 287, 0, 0, 0, 903, 0, 514, 81, 470, 818,
+  736, 831, 0, 573, 0, 0, 0, 189, 0, 523, 233, 304, 295, 977, 0, 0,
+  0, 246, 409, 621, 473, 0, 0, 0, 0, 0, 0, 0, 266, 0, 575, 665,
+  773, 292, 592, 158, 85, 388, 693, 723, 109, 937, 313, 0, 0, 159, 432, 264,
+  955, 0, 0, 536, 0, 930, 0, 0, 0, 0, 0, 0, 0, 0, 0, 145,
+  0, 288, 456, 0, 0, 0, 0, 0, 0, 74, 0, 372, 259, 570, 893, 97,
+  0, 0, 245, 92, 116, 0, 0, 0, 0, 0, 634, 887, 701, 779, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 739, 119, 600, 696, 822, 0, 0, 0,
+  0, 175, 555, 714, 755, 0, 792, 0, 0, 0, 0, 0, 0, 54, 0, 545,
+  84, 123, 648, 918, 0, 0, 0, 720, 0, 0, 51, 684, 34, 68, 0, 0,
+  0, 0, 520, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 712, 46, 0, 0, 0, 0, 0, 0, 0, 0, 939, 40, 248, 0, 0,
+  339, 854, 645, 740, 0, 746, 0, 0, 804, 802, 0, 0, 0, 0, 663, 0,
+  0, 0, 0, 0, 0, 0, 461, 193, 870, 329, 640, 841, 968, 0, 293, 0,
+  0, 0, 0, 706, 991, 0, 0, 0, 0, 0, 0, 0, 376, 588, 0, 940,
+  283, 312, 0, 835, 31, 498, 704, 952, 0, 299, 0, 0, 674, 0, 0, 0,
+  447, 410, 0, 0, 499, 0, 0, 0, 0, 0, 0, 58, 0, 0, 0, 0,
+  659, 768, 99, 0, 742, 268, 101, 279, 484, 0, 173, 0, 0, 0, 0, 0,
+  0, 815, 440, 18, 464, 202, 479, 842, 176, 710, 878, 801, 844, 0, 0, 70,
+  0, 0, 899, 344, 0, 0, 0, 606, 0, 0, 0, 0, 673, 0, 244, 402,
+  886, 309, 291, 964, 0, 0, 0, 0, 52, 571, 492, 506, 0, 375, 332, 336,
+  730, 772, 658, 0, 0, 330, 817, 0, 347, 540, 127, 393, 733, 907, 0, 0,
+  0, 629, 0, 515, 628, 670, 921, 764, 200, 398, 820, 0, 0, 318, 491, 174,
+  782, 636, 231, 151, 378, 137, 688, 305, 751, 908, 224, 970, 3, 308, 0, 0,
+  463, 0, 124, 0, 0, 0, 0, 872, 66, 794, 811, 0, 598, 49, 0, 0,
+  0, 0, 869, 458, 0, 651, 241, 342, 682, 531, 686, 889, 941, 0, 326, 786,
+  0, 917, 0, 622, 253, 0, 557, 0, 0, 444, 0, 0, 0, 0, 0, 0,
+  87, 539, 0, 962, 0, 0, 0, 0, 0, 0, 0, 738, 0, 331, 0, 0,
+  0, 0, 0, 607, 1, 0, 680, 0, 335, 17, 0, 0, 0, 0, 0, 443,
+  243, 481, 590, 0, 635, 761, 0, 0, 911, 0, 644, 566, 172, 488, 507, 783,
+  836, 859, 865, 0, 0, 0, 0, 0, 63, 0, 745, 0, 494, 638, 0, 143,
+  7, 213, 0, 24, 857, 0, 0, 609, 0, 0, 0, 845, 847, 483, 0, 0,
+  217, 0, 8, 0, 0, 0, 0, 0, 0, 0, 23, 0, 0, 796, 0, 808,
+  760, 0, 0, 0, 0, 0, 219, 0, 0, 0, 814, 0, 0, 605, 0, 53,
+  212, 0, 0, 0, 0, 0, 0, 0, 0, 603, 855, 191, 546, 0, 0, 0,
+  0, 888, 0, 0, 973, 0, 807, 0, 0, 0, 0, 0, 0, 825, 403, 0,
+  652, 0, 120, 206, 625, 181, 975, 0, 0, 0, 0, 315, 694, 982, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 134, 208, 345, 544, 277, 832, 567, 933,
+  187, 0, 932, 150, 328, 0, 0, 75, 89, 0, 0, 83, 86, 0, 56, 0,
+  0, 0, 0, 371, 73, 661, 777, 0, 132, 425, 38, 0, 391, 0, 157, 0,
+  0, 0, 377, 0, 552, 0, 0, 131, 27, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 553, 0, 0, 289, 0, 0, 0, 0, 758, 368, 0, 0, 229,
+  455, 192, 984, 45, 419, 487, 728, 791, 784, 0, 812, 0, 57, 0, 689, 744,
+  0, 793, 0, 0, 62, 0, 0, 0, 0, 13, 407, 0, 0, 961, 0, 0,
+  0, 0, 0, 0, 4, 171, 165, 646, 650, 496, 0, 0, 0, 0, 732, 0,
+  0, 0, 0, 0, 0, 0, 0, 381, 0, 32, 0, 722, 0, 0, 0, 0,
+  0, 55, 0, 874, 0, 926, 0, 0, 0, 98, 530, 0, 0, 564, 284, 196,
+  108, 737, 0, 457, 846, 164, 0, 0, 0, 0, 995, 559, 0, 350, 0, 0,
+  400, 361, 418, 0, 135, 263, 475, 91, 128, 568, 810, 446, 958, 90, 121, 909,
+  11, 65, 169, 776, 0, 0, 0, 0, 0, 656, 50, 0, 0, 0, 0, 920,
+  322, 826, 0, 0, 0, 594, 0, 0, 162, 775, 0, 0, 0, 0, 177, 0,
+  0, 0, 0, 0, 0, 0, 152, 0, 759, 823, 26, 0, 577, 0, 965, 20,
+  0, 0, 0, 0, 0, 0, 582, 0, 0, 0, 721, 543, 980, 222, 422, 849,
+  0, 0, 0, 0, 0, 513, 718, 541, 871, 850, 423, 604, 691, 866, 504, 0,
+  261, 37, 413, 534, 0, 0, 0, 0, 156, 0, 0, 584, 896, 0, 310, 0,
+  529, 556, 30, 0, 205, 641, 533, 197, 477, 0, 0, 0, 0, 0, 0, 0,
+  256, 0, 179, 0, 687, 0, 210, 0, 269, 827, 0, 0, 0, 0, 675, 0,
+  369, 226, 296, 719, 33, 188, 43, 267, 0, 0, 324, 9, 550, 562, 0, 148,
+  0, 0, 535, 631, 497, 272, 0, 0, 247, 346, 774, 858, 467, 0, 416, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 601, 992, 0, 0,
+  252, 522, 881, 59, 185, 0, 0, 0, 0, 0, 0, 0, 125, 349, 438, 925,
+  685, 0, 0, 0, 0, 897, 0, 0, 864, 0, 0, 0, 0, 141, 0, 380,
+  0, 0, 0, 78, 0, 0, 0, 0, 69, 102, 729, 833, 919, 257, 0, 0,
+  0, 596, 0, 957, 0, 319, 426, 558, 572, 678, 923, 0, 0, 0, 618, 0,
+  235, 0, 0, 0, 0, 950, 0, 307, 750, 867, 0, 0, 891, 0, 449, 126,
+  803, 0, 0, 0, 254, 0, 0, 0, 450, 537, 0, 209, 0, 0, 0, 0,
+  0, 565, 946, 0, 0, 0, 0, 215, 834, 708, 503, 890, 790, 221, 653, 314,
+  711, 727, 951, 519, 981, 0, 0, 0, 789, 611, 0, 532, 111, 0, 944, 199,
+  0, 110, 0, 0, 713, 0, 824, 905, 0, 0, 0, 526, 0, 113, 0, 0,
+  0, 0, 0, 0, 0, 104, 0, 0, 0, 976, 0, 437, 198, 0, 300, 591,
+  654, 0, 643, 153, 225, 806, 0, 0, 748, 0, 0, 0, 0, 797, 979, 434,
+  0, 383, 0, 301, 0, 0, 0, 0, 394, 947, 662, 924, 0, 876, 0, 0,
+  0, 0, 0, 928, 0, 0, 0, 234, 0, 0, 614, 0, 19, 0, 763, 851,
+  239, 953, 112, 316, 389, 707, 0, 0, 0, 0, 0, 0, 0, 441, 960, 0,
+  146, 0, 0, 0, 0, 610, 489, 140, 821, 880, 0, 115, 756, 0, 0, 0,
+  0, 0, 154, 0, 0, 0, 325, 0, 0, 0, 0, 0, 0, 476, 228, 0,
+  0, 0, 0, 0, 0, 399, 668, 966, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 64, 170, 0, 0, 14, 569, 709, 525, 0, 0, 954, 167,
+};
+
+const char *WA_FREQ_82_TOKENS[] = {
+  "do",
+  "de",
+  "et",
+  "wie",
+  "su",
+  "un",
+  "am",
+  "fastelovend",
+  "durch",
+  "kölle",
+  "bes",
+  "jeck",
+  "dem",
+  "dun",
+  "die",
+  "koche",
+  "nit",
+  "mieh",
+  "wieh",
+  "sinn",
+  "ich",
+  "eene",
+  "kleine",
+  "jung",
+  "direk",
+  "nevve",
+  "mir",
+  "stonn",
+  "steis",
+  "nen",
+  "ohß",
+  "vörm",
+  "berch",
+  "weed",
+  "hätz",
+  "fruh",
+  "leich",
+  "wann",
+  "fröhjohr",
+  "sich",
+  "jetz",
+  "zeich",
+  "wat",
+  "wells",
+  "maache",
+  "resultat",
+  "vun",
+  "dämm",
+  "treffe",
+  "wor",
+  "dat",
+  "me",
+  "em",
+  "nächste",
+  "johr",
+  "daach",
+  "för",
+  "ne",
+  "zoch",
+  "veranstallte",
+  "wollt",
+  "es",
+  "1823",
+  "ierschte",
+  "karnevalszoch",
+  "moondach",
+  "für",
+  "jetrocke",
+  "krisste",
+  "en",
+  "aap",
+  "tom",
+  "is",
+  "e",
+  "blödschkopp",
+  "isch",
+  "ben",
+  "schön",
+};
+const uint16_t WA_FREQ_82_RANKS[] = {
+  0, 0, 0, 0, 0, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 16, 60, 46, 0, 0, 0, 24, 0, 0, 0, 0, 0, 0, 0, 14,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0, 36, 39, 0,
+  0, 0, 0, 5, 28, 0, 40, 58, 38, 0, 0, 43, 0, 0, 62, 29,
+  71, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 76, 0, 0, 0,
+  0, 0, 0, 18, 34, 0, 44, 0, 0, 33, 0, 68, 0, 78, 0, 6,
+  0, 0, 0, 0, 0, 73, 0, 11, 0, 54, 0, 0, 0, 8, 12, 72,
+  0, 0, 0, 74, 42, 0, 10, 0, 0, 0, 30, 0, 0, 41, 0, 0,
+  3, 0, 0, 0, 65, 0, 17, 0, 0, 0, 0, 0, 0, 0, 37, 0,
+  49, 0, 0, 7, 35, 9, 59, 0, 0, 0, 0, 2, 25, 0, 0, 0,
+  0, 0, 77, 21, 45, 27, 52, 0, 0, 0, 0, 51, 50, 22, 0, 0,
+  0, 0, 0, 0, 57, 0, 47, 0, 0, 0, 0, 0, 0, 0, 0, 69,
+  0, 0, 0, 0, 0, 55, 0, 63, 0, 0, 0, 0, 0, 0, 56, 0,
+  0, 1, 20, 23, 0, 0, 0, 0, 66, 0, 0, 0, 0, 61, 0, 0,
+  0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 4, 0,
+  0, 70, 13, 31, 32, 64, 0, 0, 75, 0, 0, 0, 19, 0, 67, 0,
+};
+
+const char *WA_FREQ_83_TOKENS[] = {
+  "و",
+  "لە",
+  "بۆ",
+  "بە",
+  "له‌",
+  "کە",
+  "ئەو",
+  "به‌",
+  "ساڵی",
+  "ئەم",
+  "كه‌",
+  "كە",
+  "ئه‌و",
+  "بوو",
+  "زۆر",
+  "كوردستان",
+  "خۆی",
+  "یان",
+  "لەسەر",
+  "بووە",
+  "دا",
+  "لەگەڵ",
+  "شاری",
+  "تا",
+  "بەڵام",
+  "کوردستان",
+  "ئێراق",
+  "دوو",
+  "دوای",
+  "لەو",
+  "ئەوەی",
+  "ئه‌م",
+  "سەر",
+  "نێوان",
+  "ئێستا",
+  "ساڵ",
+  "پێی",
+  "ئێران",
+  "كرد",
+  "ناوی",
+  "زیاتر",
+  "کرد",
+  "وەک",
+  "که‌",
+  "بێت",
+  "له‌سه‌ر",
+  "ژمارەی",
+  "هیچ",
+  "له‌گه‌ڵ",
+  "سیاسی",
+  "عێراق",
+  "ھەر",
+  "کەس",
+  "ناو",
+  "ڕۆژی",
+  "بوون",
+  "یەکێک",
+  "كورد",
+  "خۆیان",
+  "پارتی",
+  "هەر",
+  "بێ",
+  "له‌و",
+  "تر",
+  "چەند",
+  "هەموو",
+  "له",
+  "سه‌ر",
+  "ئەوە",
+  "لەم",
+  "کۆتایی",
+  "دانیشتوانی",
+  "به‌ڵام",
+  "ھەیە",
+  "دروست",
+  "بارزانی",
+  "پارێزگای",
+  "هه‌روه‌ها",
+  "کورد",
+  "هەیە",
+  "دەبێت",
+  "ئەگەر",
+  "هه‌ر",
+  "هه‌رێمی",
+  "من",
+  "ماوە",
+  "لێ",
+  "بكات",
+  "پێش",
+  "سه‌رۆك",
+  "ئێمە",
+  "پێ",
+  "گشتی",
+  "پڕدا",
+  "پاش",
+  "هەرێمی",
+  "دەکات",
+  "هه‌یه‌",
+  "سێ",
+  "لەلایەن",
+  "زمانی",
+  "ھەموو",
+  "توركیا",
+  "دواتر",
+  "هه‌موو",
+  "یەکەم",
+  "وە",
+  "چه‌ند",
+  "کردووە",
+  "ی",
+  "سه‌رۆكی",
+  "سلێمانی",
+  "ھەروەھا",
+  "کوردی",
+  "زۆری",
+  "نییە",
+  "جار",
+  "دەست",
+  "داوای",
+  "پاشان",
+  "ناوەندی",
+  "هەروەها",
+  "بوونی",
+  "ئه‌وه‌ی",
+  "ده‌كات",
+  "لیستی",
+  "بۆیە",
+  "له‌لایه‌ن",
+  "مافی",
+  "بەو",
+  "دەستی",
+  "سوریا",
+  "ژیانی",
+  "ئێمه‌",
+  "وڵاتی",
+  "له‌م",
+  "به",
+  "وەك",
+  "ناوچەی",
+  "پێک",
+  "حكومه‌تی",
+  "مانگی",
+  "باس",
+  "یەک",
+  "بکات",
+  "لای",
+  "نێو",
+  "مرۆڤ",
+  "یاسا",
+  "ئەمە",
+  "هه‌رێم",
+  "بوو،",
+  "دەبێ",
+  "ده‌بێت",
+  "بەسەر",
+  "چوار",
+  "چۆن",
+  "زۆربەی",
+  "چەندین",
+  "بن",
+  "وا",
+  "کوڕی",
+  "نوێ",
+  "وڵات",
+  "شێخ",
+  "پێویستە",
+  "ماوەی",
+  "گوتی",
+  "ئه‌وه‌",
+  "ھۆی",
+  "ئایا",
+  "وەکوو",
+  "وتیشی",
+  "وه‌ك",
+  "ڕۆژھەڵاتی",
+  "ژێر",
+  "دەكات",
+  "وڵاتانی",
+  "گەورە",
+  "ئەمەش",
+  "بووه‌",
+  "عەرەبی",
+  "بواری",
+  "واتە",
+  "چ",
+  "لەبەر",
+  "تری",
+  "ناوبراو",
+  "کاری",
+  "لایەن",
+  "ئیسلامی",
+  "كه‌س",
+  "نیشتمانی",
+  "باسی",
+  "٢٠٠٦",
+  "ئاستی",
+  "کاتی",
+  "ئه‌گه‌ر",
+  "رایگه‌یاند",
+  "بەپێی",
+  "تورکیا",
+  "دژی",
+  "بەم",
+  "دەکەن",
+  "زانستی",
+  "سەرۆكی",
+  "بەرامبەر",
+  "ھاتووە",
+  "باشووری",
+  "وڵاتە",
+  "سوپای",
+  "وه‌زیری",
+  "حكومه‌ت",
+  "ئینگلیزی",
+  "سووریا",
+  "دەوڵەتی",
+  "ئەوان",
+  "شارە",
+  "ئێراقی",
+  "بەرەو",
+  "تایبەت",
+  "ملیۆن",
+  "تەمەنی",
+  "بەر",
+  "هۆی",
+  "بكرێت",
+  "شوێنی",
+  "‌و",
+  "رۆژی",
+  "سەرۆك",
+  "کۆچی",
+  "یاسای",
+  "كرده‌وه‌",
+  "دوایی",
+  "پێنج",
+  "خەڵکی",
+  "چونكە",
+  "تێدا",
+  "ھەڵکەوتووە",
+  "دێت",
+  "سەردەمی",
+  "كاری",
+  "کردنی",
+  "پێكهێنانی",
+  "کراوە",
+  "ساڵە",
+  "سەدەی",
+  "دەسەڵاتی",
+  "به‌غدا",
+  "کاتێک",
+  "کۆماری",
+  "جۆرە",
+  "تەواو",
+  "ئەوەیە",
+  "بنەماڵە",
+  "سەبارەت",
+  "ئه‌نجومه‌نی",
+  "تەنیا",
+  "ھەندێک",
+  "کەسە",
+  "كردنی",
+  "كۆتایی",
+  "هه‌رێمى",
+  "ئازادی",
+  "سەرژمێرییەکانی",
+  "مێژووی",
+  "ئەندامی",
+  "تۆ",
+  "وه‌زاره‌تی",
+  "ئه‌مه‌ریكا",
+  "سەرژمێری",
+  "عەلی",
+  "حکومەتی",
+  "دەکرێت",
+  "ساڵانی",
+  "پۆستی",
+  "بەردەوام",
+  "كردووه‌",
+  "یا",
+  "تایبەتی",
+  "هاوكات",
+  "هه‌ردوو",
+  "کار",
+  "کوردستانی",
+  "ده‌ست",
+  "٢٠٠٦دا",
+  "هێزه‌",
+  "پێویسته‌",
+  "ھیچ",
+  "بەشی",
+  "پێویست",
+  "که",
+  "گرنگی",
+  "تەواوی",
+  "خەڵكی",
+  "پێشتر",
+  "بڕیاری",
+  "كوردستانی",
+  "مامۆستا",
+  "ئاماری",
+  "بڵاو",
+  "خوێندنی",
+  "سه‌باره‌ت",
+  "ئامارەکانی",
+  "به‌و",
+  "دەبێتە",
+  "دەوروبەری",
+  "پەیوەندی",
+  "پارێزگاکانی",
+  "پارێزگایە",
+  "دیكە",
+  "بنەماڵەدا",
+  "وتی",
+  "یاخود",
+  "خوێندن",
+  "پەرلەمان",
+  "نییه‌",
+  "کرا",
+  "باش",
+  "شەڕی",
+  "ئەمڕۆ",
+  "تێیدا",
+  "دوا",
+  "پەرلەمانی",
+  "گەلی",
+  "ته‌نها",
+  "ئازاد",
+  "ساڵی‌",
+  "باکووری",
+  "كار",
+  "پێویستی",
+  "كوردی",
+  "تەنها",
+  "پاراستنی",
+  "بەغدا",
+  "ده‌كه‌ن",
+  "ئەنجام",
+  "بەهۆی",
+  "ده‌دات",
+  "ده‌وڵه‌تی",
+  "سەرۆکی",
+  "نوێی",
+  "ژیان",
+  "ئیسلام",
+  "خۆیدا",
+  "داعش",
+  "دێیە",
+  "ئایینی",
+  "كرد،",
+  "حكوومەتی",
+  "محەمەد",
+  "نزیکەی",
+  "جێگری",
+  "كرا",
+  "وشەی",
+  "بو",
+  "خوای",
+  "زانیاری",
+  "به‌سه‌ر",
+  "ئێستاش",
+  "چونكه‌",
+  "گۆڕان",
+  "خاوەنی",
+  "هەولێر",
+  "ڕووی",
+  "گه‌وره‌",
+  "بدات",
+  "دژ",
+  "گەورەی",
+  "ئەویش",
+  "باوکی",
+  "بێت،",
+  "جیهان",
+  "دەدات",
+  "وایە",
+  "باشترین",
+  "جگە",
+  "سەرەکی",
+  "هه‌زار",
+  "وت",
+  "فارسی",
+  "نە",
+  "به‌ره‌و",
+  "داهاتوو",
+  "ئاماژەی",
+  "ئه‌مڕۆ",
+  "بكه‌ن",
+  "رایگەیاند",
+  "سیستەمی",
+  "شۆڕشی",
+  "نابێت",
+  "بەشداری",
+  "كۆماری",
+  "هه‌ولێر",
+  "ئاماژه‌ی",
+  "زانکۆی",
+  "شاری‌",
+  "وەزارەتی",
+  "یەکێکە",
+  "هەرێم",
+  "چی",
+  "توانی",
+  "تەنھا",
+  "جیھانی",
+  "داوا",
+  "نوری",
+  "داوە",
+  "دیاری",
+  "لەساڵی",
+  "لەناو",
+  "گرنگ",
+  "ئابووری",
+  "ئەمریکا",
+  "ئه‌نجام",
+  "بەھۆی",
+  "كوردستان،",
+  "گەورەترین",
+  "بووە،",
+  "بۆیه‌",
+  "خۆمان",
+  "رابردوو",
+  "سەرەتای",
+  "هێشتا",
+  "ئیراق",
+  "شێوەی",
+  "دوور",
+  "وتیشی‌",
+  "وەزیری",
+  "باڵای",
+  "دیموكراتی",
+  "گوندی",
+  "دە",
+  "زیاد",
+  "قۆناغی",
+  "لەوە",
+  "مەلا",
+  "جێی",
+  "دایک",
+  "رایگه‌یاند،",
+  "ئەحمەد",
+  "ئەنجومەنی",
+  "بكەن",
+  "لەنێوان",
+  "میسر",
+  "ئاو",
+  "به‌م",
+  "دێکانی",
+  "سزا",
+  "لەوێ",
+  "چه‌ندین",
+  "بەتایبەتی",
+  "دیواندەرەیە",
+  "گۆرانی",
+  "مالكی",
+  "وڵاته‌",
+  "چونکە",
+  "بیر",
+  "هەیە،",
+  "پرسی",
+  "پڕ",
+  "خۆ",
+  "دەکرد",
+  "زەوی",
+  "سه‌رجه‌م",
+  "ناوچە",
+  "نەتەوەیی",
+  "پێیان",
+  "خاوەن",
+  "رۆژ",
+  "كاتێك",
+  "لیبیا",
+  "ئاشتی",
+  "بکرێت",
+  "دیكه‌",
+  "شارى",
+  "ئاسایشی",
+  "ئه‌وان",
+  "ئه‌وه‌ى",
+  "خوا",
+  "خۆی‌",
+  "سەردانی",
+  "کەم",
+  "ئه‌مه‌",
+  "بارودۆخی",
+  "بەکار",
+  "خەڵک",
+  "دۆلار",
+  "دەڵێن",
+  "كردووە",
+  "وەكو",
+  "به‌رده‌وام",
+  "دووەم",
+  "مانگ",
+  "هەزار",
+  "پشت",
+  "گشت",
+  "یه‌ك",
+  "18",
+  "ئاماژە",
+  "ئه‌ندامی",
+  "ئەوانەی",
+  "ده‌ڵێت",
+  "دەكەن",
+  "عێراقی",
+  "بەوە",
+  "دەڵێت",
+  "باری",
+  "تیایدا",
+  "جیهانی",
+  "دەنگی",
+  "ئاوێنه‌",
+  "بازرگانی",
+  "بکەن",
+  "جیاواز",
+  "كاتی",
+  "كوردستاندا",
+  "مالیكی",
+  "نزیک",
+  "گفتوگۆ",
+  "كردن",
+  "ئێوە",
+  "بڕیار",
+  "تاران",
+  "خەڵاتی",
+  "دەکا",
+  "په‌رله‌مان",
+  "ھەرێمی",
+  "جیھان",
+  "دەرەوەی",
+  "سه‌رچاوه‌كه‌",
+  "تەنانەت",
+  "ده‌كرێت",
+  "سیاسیی",
+  "لایه‌ن",
+  "وه‌ک",
+  "پشتیوانی",
+  "کتێبی",
+  "گەڵ",
+  "یەکەمی",
+  "بریتییە",
+  "تایبه‌ت",
+  "توانای",
+  "كەس",
+  "ھەتا",
+  "بێگومان",
+  "سنووری",
+  "کردن",
+  "نەوت",
+  "پلەی",
+  "ئەوا",
+  "شار",
+  "شێوەیەکی",
+  "لێی",
+  "گوتیشی",
+  "یه‌كه‌م",
+  "ساڵح",
+  "سه‌ردانی",
+  "نێچیرڤان",
+  "کردەوە",
+  "ئاژانسی",
+  "هێزی",
+  "و،",
+  "زۆرتر",
+  "یاسایی",
+  "باشتر",
+  "بەبێ",
+  "بەناوی",
+  "وه‌كو",
+  "پۆلیس",
+  "دانیشتووانی",
+  "سەرجەم",
+  "شێوازی",
+  "وه‌زیران",
+  "ئه‌وه‌شی",
+  "ئه‌وه‌ی‌",
+  "دیكەی",
+  "روونیشیكرده‌وه‌",
+  "نیە",
+  "یەك",
+  "ئەنجامی",
+  "بوون،",
+  "خۆى",
+  "عوسمانی",
+  "هاوپه‌یمانی",
+  "پۆلیسی",
+  "ڕۆژ",
+  "ئامانجی",
+  "خەڵك",
+  "سه‌رۆكایه‌تی",
+  "له‌ناو",
+  "مانای",
+  "هه‌رێمی‌",
+  "چاپ",
+  "ئه‌مریكا",
+  "ئیسرائیل",
+  "عیراق",
+  "موسڵ",
+  "هێزه‌كانی",
+  "گۆڤاری",
+  "به‌رامبه‌ر",
+  "خاڵی",
+  "رژێمى",
+  "سەربازی",
+  "نا",
+  "وەکو",
+  "کۆمەڵێک",
+  "ھەبوو",
+  "یە",
+  "یەکەمین",
+  "ئه‌ورووپا",
+  "بریتیە",
+  "سه‌رۆكی‌",
+  "پرۆسەی",
+  "رووی",
+  "لایەنی",
+  "ئەوەش",
+  "دواى",
+  "دەكرێت",
+  "دەکرێ",
+  "پایتەختی",
+  "کات",
+  "حكوومەت",
+  "دا،",
+  "دووەمی",
+  "دیموكراسی",
+  "لەبارەی",
+  "وه‌زیرانی",
+  "ژن",
+  "بریندار",
+  "دان",
+  "ده‌ره‌وه‌ی",
+  "دەگەڕێتەوە",
+  "سەرۆک",
+  "مەھاباد",
+  "نین",
+  "هەردوو",
+  "چین",
+  "ئاسایش",
+  "باشوور",
+  "بەشێک",
+  "دامەزراندنی",
+  "نزیك",
+  "نیشتیمانی",
+  "هەمان",
+  "ژماره‌یه‌ك",
+  "ئینگلیسی",
+  "بنەمای",
+  "تاڵه‌بانی",
+  "داوه‌",
+  "دیکە",
+  "شێوە",
+  "لەدوای",
+  "هێزە",
+  "وای",
+  "ھەمان",
+  "ئاوێنە",
+  "به‌ر",
+  "به‌شداری",
+  "دابین",
+  "دوای‌",
+  "شیعری",
+  "به‌پێی",
+  "حكومه‌تی‌",
+  "خەباتی",
+  "ده‌کات",
+  "دەبن",
+  "دەوڵەت",
+  "چاودێری",
+  "یەکێتی",
+  "ئه‌مه‌ش",
+  "تۆمار",
+  "جەنگی",
+  "دارایی",
+  "دانانی",
+  "دەسەڵات",
+  "سروشتی",
+  "شتێک",
+  "ناسراوە",
+  "کۆمەڵەی",
+  "ھەبووە",
+  "یه‌كێتیى",
+  "سیاسەتی",
+  "عوسمان",
+  "فەلسەفەی",
+  "كه‌سایه‌تیى",
+  "هه‌بێت",
+  "بەدەست",
+  "دوایین",
+  "مەبەستی",
+  "نه‌وت",
+  "ڕێژەی",
+  "یەكێتی",
+  "به‌هۆی",
+  "رێگای",
+  "نییە،",
+  "پێغەمبەر",
+  "گرت",
+  "لایه‌نه‌",
+  "ماڵی",
+  "نموونە",
+  "چاره‌سه‌ر",
+  "ژمارە",
+  "ئه‌وه‌ش",
+  "به‌ریتانیا",
+  "ویلایەتە",
+  "چاو",
+  "ئاشكرا",
+  "بۆی",
+  "تشرینی",
+  "جیاوازی",
+  "جێگای",
+  "خەبات",
+  "زۆرترین",
+  "ناوچه‌",
+  "هاوكاری",
+  "پێشمەرگە",
+  "گیانی",
+  "یه‌كێتی",
+  "جۆری",
+  "عه‌لی",
+  "قسە",
+  "لەوانەیە",
+  "ڕێگەی",
+  "یاری",
+  "ئیبراهیم",
+  "ئیتر",
+  "بەڵكو",
+  "دیموکراتی",
+  "دەگاتە",
+  "زمان",
+  "قورئان",
+  "لایەنە",
+  "له‌نێوان",
+  "لەوانە",
+  "نەبێت",
+  "هه‌ندێك",
+  "ئاوی",
+  "ئێستادا",
+  "ئەندامانی",
+  "با",
+  "حکومه‌تی",
+  "دەتوانێت",
+  "شەڕ",
+  "قەزای",
+  "هەبێت",
+  "پێکەوە",
+  "ئێراقدا",
+  "ئێوه‌",
+  "بەرز",
+  "دو",
+  "ساڵى",
+  "عه‌ره‌بی",
+  "مستەفا",
+  "نیه‌",
+  "کۆمەڵە",
+  "کەسێک",
+  "ئێرانی",
+  "باسه‌",
+  "باشی",
+  "بدرێت",
+  "بیست",
+  "خولی",
+  "خۆش",
+  "ده‌نگ",
+  "ساڵیدا",
+  "لەنێو",
+  "ڕێگای",
+  "ھەولێر",
+  "ئه‌لعێراق)ی‌",
+  "ئیئتیلافی",
+  "بەڵکو",
+  "خوێن",
+  "دامەزراوە",
+  "دەدەن",
+  "كراوه‌",
+  "ملیار",
+  "ناسراو",
+  "ناوخۆ",
+  "ڕۆژئاوای",
+  "ھەندێ",
+  "ئاژانسی‌(ئه‌سوات",
+  "بكات،",
+  "تریش",
+  "جیا",
+  "حکومەت",
+  "حیزبی",
+  "دەکەوێتە",
+  "راگه‌یاند",
+  "ناوچەکە",
+  "بكەین",
+  "دەكەین",
+  "كاروباری",
+  "كوژران",
+  "نەبوو",
+  "وێنەی",
+  "پێشكه‌ش",
+  "ڕۆژژمێری",
+  "کەسی",
+  "ھێزی",
+  "ئەوروپا",
+  "تورکی",
+  "خۆم",
+  "دەدا",
+  "رۆڵی",
+  "سنە",
+  "سه‌رۆكى",
+  "شەش",
+  "كۆمار",
+  "له‌به‌ر",
+  "وه‌زیرى",
+  "پێشمه‌رگه‌",
+  "پێکھاتووە",
+  "گەل",
+  "بڕی",
+  "دایە",
+  "دراوە",
+  "فیلمی",
+  "لەوەی",
+  "مێژوویی",
+  "نەك",
+  "هات",
+  "وتی‌",
+  "پشتگیری",
+  "چارەسەری",
+  "ئەمەریكا",
+  "ئەنجوومەنی",
+  "به‌پێی‌",
+  "بەشێکی",
+  "تاكو",
+  "تورکیایە",
+  "تیرۆر",
+  "حزبی",
+  "د.",
+  "دی",
+  "كات",
+  "هه‌ردوولا",
+  "پێشوازی",
+  "ئه‌وا",
+  "ئێراق،",
+  "به‌ده‌ست",
+  "تائێستا",
+  "خواست",
+  "دەریای",
+  "له‌وه‌",
+  "نەتەوە",
+  "هێزه‌كانى",
+  "بریتین",
+  "به‌هۆی‌",
+  "به‌وه‌",
+  "سەری",
+  "له‌باره‌ی",
+  "مێژوو",
+  "هەمیشە",
+  "هەندێ",
+  "ژمارەیەکی",
+  "ئەدەبی",
+  "بەتایبەت",
+  "بەرگری",
+  "ته‌نیا",
+  "جارێكی",
+  "داهاتوودا",
+  "شارستانی",
+  "كراوە",
+  "كەركووك",
+  "ناوەڕاست",
+  "هه‌مان",
+  "چاوی",
+  "کوردستاندا",
+  "یه‌كێك",
+  "ئه‌ندامانی",
+  "بڕیاره‌",
+  "خۆشی",
+  "زۆرینەی",
+  "سی",
+  "مامۆستای",
+  "کوردیی",
+  "ئامانج",
+  "خۆیه‌وه‌",
+  "درێژ",
+  "ده‌ستی",
+  "دیار",
+  "شارەکانی",
+  "نه‌ته‌وه‌",
+  "نەوتی",
+  "٢٠١٠",
+  "گه‌لی",
+  "ئاماژه‌یه‌",
+  "بەرنامەی",
+  "بەرھەمی",
+  "تێدایە",
+  "جوان",
+  "دادگای",
+  "دیارە",
+  "شتێکی",
+  "شۆڕش",
+  "كێشەی",
+  "مردنی",
+  "ناوچه‌ی",
+  "هەندێك",
+  "واتای",
+  "په‌رله‌مانی",
+  "یانەی",
+  "3",
+  "جێگەی",
+  "دكتۆر",
+  "دەوری",
+  "رۆژی‌",
+  "ز",
+  "عەرەب",
+  "په‌یوه‌ندی",
+  "ئازاری",
+  "ئه‌وروپا",
+  "بدەن",
+  "بزووتنەوەی",
+  "جگه‌",
+  "خزمەتی",
+  "داهاتووی",
+  "زۆرێک",
+  "لەدایک",
+  "نیشان",
+  "نێودەوڵەتی",
+  "کوردەکان",
+  "کۆمەڵایەتی",
+  "به‌رپرسانی",
+  "بون",
+  "تووشی",
+  "سوڵتان",
+  "ناوچەکانی",
+  "نووسینی",
+  "وایه‌",
+  "١٠",
+  "٢٠٠٩",
+  "ھەیە،",
+  "ئەگەرچی",
+  "بتوانن",
+  "دوێنێ",
+  "رێكخراوی",
+  "سوود",
+  "سەربەخۆ",
+  "سەرەتا",
+  "شاندی",
+  "عێراقدا",
+  "وه‌",
+  "پێناو",
+  "ڕۆڵی",
+  "ھەم",
+  "ئه‌وه‌یه‌",
+  "بارەی",
+  "دروستکردنی",
+  "درێژەی",
+  "دیموکراسی",
+  "دەرەوە",
+  "زایینی",
+  "قازی",
+  "هاتووه‌",
+  "وەڵامی",
+  "کۆمپانیای",
+  "یەكەم",
+  "ئێران،",
+  "بەکارھێنانی",
+  "توندوتیژی",
+  "دووبارە",
+  "عه‌لاوی",
+  "كردوه‌",
+  "لەژێر",
+  "محه‌مه‌د",
+  "نوێنه‌رانی",
+  "هێنا",
+  "پاڵپشتی",
+  "کانت",
+  "کۆتاییی",
+  "ھەردوو",
+  "یەكێك",
+  "ئه‌نجومه‌نی‌",
+  "ته‌واوی",
+  "عێراق،",
+  "فیدراڵ",
+  "موسڵمانان",
+  "ناكات",
+  "ناوخۆی",
+  "هەوڵی",
+  "پارێزگای‌",
+  "کردوە",
+  "ھێنا",
+  "ئه‌مریکا",
+  "باڵا",
+  "ببێتە",
+  "دیکەی",
+  "دەربارەی",
+  "دەکاتەوە",
+  "سه‌در",
+  "سەرچاوەی",
+  "فەرمی",
+  "نابێ",
+  "نوێنەرانی",
+  "پرۆسه‌ی",
+  "ڕوو",
+  "ھونەری",
+  "ئامادە",
+  "بارزانى",
+};
+const uint16_t WA_FREQ_83_RANKS[] = {
+  731, 124, 855, 712, 867, 0, 536, 967, 22, 0, 0, 702, 367, 0, 511, 0,
+  5, 0, 801, 0, 303, 0, 0, 0, 682, 0, 0, 0, 0, 0, 570, 644,
+  474, 181, 662, 144, 704, 765, 831, 908, 0, 0, 0, 935, 819, 684, 0, 0,
+  0, 0, 0, 0, 0, 0, 601, 0, 0, 694, 0, 0, 0, 0, 266, 932,
+  0, 82, 0, 110, 0, 0, 0, 24, 0, 821, 0, 0, 0, 0, 866, 581,
+  0, 0, 0, 514, 77, 0, 151, 0, 0, 363, 0, 0, 0, 0, 0, 304,
+  0, 166, 0, 0, 873, 0, 0, 348, 0, 0, 185, 0, 246, 543, 0, 0,
+  0, 722, 0, 991, 159, 807, 823, 894, 230, 42, 663, 257, 346, 616, 125, 707,
+  753, 179, 464, 0, 0, 0, 311, 736, 0, 683, 457, 248, 84, 309, 982, 0,
+  0, 0, 0, 312, 493, 73, 833, 0, 972, 0, 851, 0, 0, 0, 726, 0,
+  96, 0, 0, 0, 0, 408, 914, 465, 0, 579, 0, 60, 862, 0, 680, 0,
+  0, 0, 129, 0, 524, 0, 0, 293, 732, 948, 803, 428, 0, 950, 45, 668,
+  992, 86, 0, 0, 0, 405, 799, 695, 960, 994, 653, 0, 0, 432, 0, 0,
+  0, 0, 134, 0, 0, 0, 0, 759, 0, 628, 0, 0, 0, 896, 0, 0,
+  377, 730, 887, 0, 0, 654, 0, 252, 0, 0, 0, 607, 892, 898, 503, 953,
+  310, 47, 461, 946, 0, 0, 0, 0, 0, 0, 0, 0, 280, 258, 567, 30,
+  630, 782, 174, 879, 207, 469, 0, 0, 449, 275, 0, 0, 0, 521, 876, 0,
+  191, 865, 0, 351, 455, 107, 0, 0, 0, 0, 0, 0, 383, 626, 0, 965,
+  395, 561, 853, 784, 85, 0, 929, 0, 0, 0, 0, 540, 788, 299, 750, 755,
+  0, 957, 834, 955, 0, 472, 0, 0, 0, 0, 0, 0, 0, 0, 0, 484,
+  51, 0, 219, 362, 0, 453, 523, 0, 596, 31, 0, 385, 0, 37, 997, 911,
+  0, 0, 0, 0, 0, 491, 0, 0, 623, 0, 463, 0, 0, 0, 0, 0,
+  462, 569, 0, 229, 352, 711, 137, 323, 496, 558, 394, 547, 974, 1000, 0, 0,
+  0, 0, 470, 0, 863, 477, 781, 790, 494, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 413, 0, 0, 0, 0, 0, 0, 0, 0, 139, 138, 167, 554,
+  0, 0, 0, 0, 0, 849, 0, 199, 0, 0, 0, 0, 0, 0, 0, 0,
+  598, 156, 104, 136, 163, 231, 260, 14, 565, 0, 0, 0, 0, 0, 192, 837,
+  43, 0, 0, 605, 442, 0, 685, 0, 780, 0, 187, 528, 912, 852, 989, 0,
+  0, 0, 897, 0, 0, 198, 349, 909, 0, 745, 667, 734, 856, 0, 0, 254,
+  0, 0, 0, 0, 364, 314, 612, 0, 0, 0, 0, 0, 0, 0, 839, 0,
+  0, 0, 83, 0, 175, 721, 986, 499, 757, 592, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 688, 0, 0, 0, 279, 0, 0, 0, 544, 0, 0, 0, 0,
+  925, 0, 0, 294, 883, 818, 0, 430, 0, 0, 356, 0, 0, 0, 0, 0,
+  0, 0, 0, 36, 237, 291, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  173, 0, 0, 209, 930, 0, 221, 766, 0, 0, 0, 410, 489, 938, 420, 0,
+  0, 0, 608, 0, 0, 149, 859, 350, 0, 928, 415, 0, 113, 748, 439, 769,
+  34, 357, 0, 0, 0, 141, 0, 0, 0, 158, 760, 0, 611, 520, 0, 0,
+  0, 0, 0, 0, 342, 657, 850, 0, 699, 578, 16, 70, 0, 495, 645, 0,
+  0, 0, 0, 777, 826, 53, 441, 418, 564, 78, 984, 998, 0, 0, 519, 0,
+  0, 927, 526, 806, 406, 0, 0, 97, 740, 0, 115, 329, 468, 0, 0, 0,
+  0, 135, 719, 841, 146, 127, 222, 319, 905, 0, 436, 404, 0, 0, 0, 482,
+  591, 671, 460, 90, 481, 737, 762, 985, 0, 0, 0, 338, 0, 0, 4, 0,
+  829, 452, 123, 0, 109, 666, 959, 555, 651, 0, 0, 376, 0, 0, 0, 55,
+  63, 614, 112, 599, 918, 988, 0, 532, 0, 49, 0, 978, 513, 690, 951, 169,
+  218, 9, 993, 0, 0, 0, 816, 0, 272, 546, 792, 804, 244, 0, 0, 964,
+  438, 0, 62, 0, 811, 0, 0, 0, 0, 0, 0, 437, 0, 0, 0, 563,
+  571, 0, 0, 638, 0, 0, 0, 676, 227, 891, 0, 0, 674, 619, 0, 758,
+  884, 0, 370, 656, 815, 407, 0, 197, 0, 0, 552, 733, 0, 0, 0, 725,
+  354, 535, 0, 320, 13, 476, 0, 0, 941, 0, 0, 0, 0, 0, 899, 0,
+  0, 0, 0, 580, 0, 798, 0, 995, 0, 188, 510, 0, 121, 128, 345, 0,
+  0, 195, 0, 0, 0, 0, 0, 0, 0, 0, 813, 933, 0, 0, 0, 106,
+  0, 0, 742, 0, 0, 0, 0, 0, 822, 652, 267, 609, 315, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 764, 776, 937, 0, 0, 0, 0, 773, 0, 0,
+  553, 944, 0, 0, 0, 0, 0, 0, 620, 28, 0, 874, 0, 56, 366, 809,
+  886, 0, 255, 0, 0, 403, 336, 0, 226, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 422, 538, 0, 0, 0, 0, 171, 0, 0, 0, 245, 0,
+  0, 0, 0, 0, 0, 0, 308, 253, 182, 0, 419, 0, 0, 269, 130, 288,
+  386, 317, 618, 0, 287, 268, 111, 145, 215, 743, 0, 298, 0, 0, 0, 797,
+  0, 0, 643, 161, 0, 0, 0, 0, 0, 0, 0, 378, 0, 0, 0, 0,
+  0, 727, 0, 0, 648, 203, 0, 990, 0, 76, 400, 828, 817, 968, 0, 0,
+  80, 0, 0, 427, 281, 716, 0, 0, 0, 0, 746, 343, 0, 0, 296, 0,
+  738, 201, 467, 771, 0, 0, 649, 0, 290, 154, 0, 692, 1, 0, 566, 934,
+  0, 0, 0, 0, 0, 507, 551, 217, 0, 0, 48, 447, 0, 903, 384, 961,
+  0, 322, 939, 142, 162, 214, 0, 700, 846, 262, 0, 353, 0, 0, 0, 0,
+  576, 0, 915, 0, 368, 751, 233, 999, 0, 0, 0, 0, 539, 691, 0, 0,
+  0, 0, 126, 500, 0, 0, 810, 0, 0, 390, 321, 724, 956, 79, 180, 820,
+  0, 0, 0, 0, 6, 0, 193, 713, 119, 157, 562, 795, 0, 160, 622, 0,
+  381, 0, 533, 375, 184, 639, 0, 274, 0, 0, 313, 0, 0, 875, 0, 379,
+  0, 117, 698, 0, 0, 0, 0, 0, 0, 190, 0, 202, 502, 767, 548, 882,
+  0, 114, 21, 0, 0, 361, 0, 872, 0, 958, 0, 0, 0, 0, 0, 600,
+  0, 0, 200, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 631, 917,
+  0, 0, 987, 545, 0, 0, 0, 247, 0, 910, 926, 46, 213, 186, 401, 206,
+  0, 625, 0, 0, 0, 0, 0, 0, 0, 486, 658, 0, 582, 885, 23, 573,
+  0, 0, 371, 0, 504, 380, 497, 446, 498, 708, 178, 0, 71, 360, 0, 459,
+  0, 372, 0, 0, 0, 236, 61, 529, 414, 170, 479, 0, 0, 0, 595, 774,
+  365, 952, 240, 0, 943, 211, 0, 0, 98, 0, 975, 703, 0, 0, 399, 471,
+  687, 466, 512, 870, 962, 0, 0, 0, 0, 0, 0, 861, 0, 0, 0, 942,
+  0, 640, 0, 0, 0, 216, 256, 355, 402, 0, 603, 840, 888, 979, 763, 140,
+  0, 0, 0, 39, 0, 388, 752, 0, 923, 634, 847, 0, 0, 0, 0, 0,
+  557, 0, 0, 284, 0, 0, 0, 0, 488, 0, 0, 0, 0, 234, 701, 423,
+  0, 0, 0, 0, 393, 0, 768, 0, 647, 0, 0, 827, 0, 228, 0, 637,
+  779, 854, 0, 800, 0, 0, 0, 754, 0, 0, 297, 429, 0, 210, 0, 0,
+  0, 0, 0, 585, 18, 344, 147, 584, 936, 945, 382, 706, 597, 0, 0, 369,
+  537, 786, 0, 0, 0, 0, 0, 0, 0, 0, 0, 143, 845, 0, 0, 68,
+  0, 530, 0, 0, 877, 0, 0, 0, 0, 0, 0, 487, 0, 756, 0, 895,
+  0, 0, 116, 0, 17, 0, 0, 560, 81, 0, 0, 102, 249, 661, 339, 0,
+  416, 0, 334, 0, 0, 796, 0, 0, 0, 302, 0, 0, 785, 0, 642, 977,
+  0, 341, 35, 583, 665, 963, 0, 0, 0, 0, 627, 878, 271, 359, 0, 250,
+  0, 770, 251, 0, 0, 575, 606, 749, 454, 0, 425, 0, 0, 0, 0, 586,
+  525, 0, 325, 0, 689, 808, 0, 153, 0, 0, 335, 556, 515, 69, 164, 224,
+  693, 0, 0, 0, 100, 0, 980, 273, 333, 72, 473, 913, 409, 0, 0, 0,
+  0, 0, 517, 0, 0, 0, 0, 0, 0, 0, 0, 0, 624, 0, 0, 194,
+  868, 0, 0, 0, 0, 264, 832, 679, 825, 922, 15, 677, 120, 970, 172, 373,
+  433, 0, 340, 559, 650, 0, 830, 0, 860, 0, 621, 0, 675, 715, 549, 0,
+  0, 374, 0, 0, 0, 183, 26, 54, 241, 864, 901, 921, 947, 0, 949, 778,
+  0, 0, 33, 574, 633, 0, 0, 0, 103, 0, 659, 969, 681, 0, 0, 328,
+  787, 331, 440, 594, 655, 0, 0, 0, 542, 0, 29, 239, 243, 577, 0, 783,
+  292, 976, 791, 0, 305, 435, 0, 0, 0, 421, 0, 0, 0, 0, 0, 50,
+  168, 761, 426, 669, 451, 0, 0, 0, 0, 0, 324, 838, 0, 38, 904, 0,
+  629, 152, 588, 0, 0, 0, 0, 0, 0, 0, 92, 337, 0, 881, 772, 0,
+  27, 919, 0, 0, 95, 105, 848, 270, 501, 678, 717, 0, 0, 44, 572, 741,
+  893, 0, 971, 0, 0, 0, 705, 824, 527, 0, 0, 0, 208, 940, 0, 0,
+  41, 89, 0, 844, 0, 0, 91, 148, 93, 2, 814, 0, 392, 0, 673, 590,
+  347, 714, 450, 0, 0, 0, 20, 232, 59, 0, 285, 0, 326, 635, 0, 0,
+  263, 57, 794, 332, 0, 0, 276, 0, 155, 492, 729, 0, 25, 996, 0, 0,
+  0, 0, 0, 522, 0, 150, 0, 0, 0, 541, 0, 0, 0, 0, 0, 131,
+  610, 744, 710, 0, 0, 0, 0, 0, 0, 0, 196, 259, 424, 417, 508, 636,
+  0, 0, 0, 0, 0, 0, 0, 19, 67, 389, 444, 12, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 843, 0, 242, 445, 0, 443, 0, 0, 0, 789,
+  924, 718, 672, 505, 604, 118, 0, 0, 0, 0, 0, 0, 0, 890, 0, 0,
+  64, 0, 0, 0, 0, 122, 99, 448, 295, 613, 593, 0, 0, 0, 0, 0,
+  0, 223, 0, 0, 0, 0, 0, 0, 0, 0, 0, 398, 238, 916, 723, 0,
+  283, 485, 0, 660, 686, 0, 0, 458, 0, 0, 0, 478, 490, 0, 0, 0,
+  212, 132, 431, 0, 0, 0, 0, 0, 735, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 587, 0, 615, 66, 456, 316,
+  94, 775, 697, 204, 812, 889, 0, 0, 0, 0, 802, 177, 0, 0, 0, 261,
+  0, 920, 0, 0, 0, 286, 0, 835, 0, 0, 954, 74, 10, 3, 857, 0,
+  0, 0, 0, 516, 133, 0, 0, 973, 602, 0, 0, 646, 0, 869, 0, 300,
+  0, 0, 176, 277, 301, 0, 0, 0, 0, 278, 531, 906, 205, 327, 11, 981,
+  475, 617, 983, 793, 0, 0, 396, 568, 842, 871, 880, 0, 0, 0, 87, 900,
+  282, 0, 189, 0, 0, 0, 0, 664, 7, 966, 289, 0, 0, 0, 0, 0,
+  0, 0, 589, 0, 65, 0, 0, 0, 0, 0, 0, 108, 0, 0, 902, 318,
+  836, 0, 0, 307, 0, 0, 0, 506, 52, 0, 220, 739, 0, 0, 58, 0,
+  0, 0, 0, 720, 0, 0, 0, 412, 0, 805, 0, 391, 483, 0, 0, 0,
+  0, 0, 306, 480, 907, 88, 387, 0, 0, 509, 40, 265, 0, 0, 0, 330,
+  0, 0, 397, 641, 0, 0, 0, 696, 0, 632, 0, 858, 0, 8, 670, 518,
+  411, 747, 0, 0, 0, 0, 0, 165, 0, 235, 0, 931, 0, 0, 0, 0,
+  0, 0, 0, 0, 550, 0, 0, 101, 32, 75, 534, 709, 225, 434, 358, 728,
+};
+
+const char *WA_FREQ_84_TOKENS[] = {
+  "жана",
+  "менен",
+  "да",
+  "бир",
+  "эле",
+  "деп",
+  "боюнча",
+  "болуп",
+  "үчүн",
+  "бул",
+  "болгон",
+  "же",
+  "Бул",
+  "ал",
+  "керек",
+  "эмес",
+  "бар",
+  "башка",
+  "жок",
+  "алып",
+  "анын",
+  "ар",
+  "турган",
+  "деген",
+  "өз",
+  "гана",
+  "Ал",
+  "кандай",
+  "болот",
+  "катары",
+  "эки",
+  "эл",
+  "дагы",
+  "кийин",
+  "болсо",
+  "ушул",
+  "мүмкүн",
+  "Бирок",
+  "Кыргыз",
+  "адам",
+  "тарабынан",
+  "учурда",
+  "аны",
+  "эми",
+  "эч",
+  "алардын",
+  "көп",
+  "кабыл",
+  "мамлекеттик",
+  "чейин",
+  "аркылуу",
+  "келген",
+  "алуу",
+  "жаткан",
+  "каршы",
+  "ошол",
+  "иш",
+  "кыргыз",
+  "ылайык",
+  "тууралуу",
+  "бардык",
+  "ошондой",
+  "эң",
+  "жерде",
+  "тийиш",
+  "Улуттук",
+  "жатат",
+  "берүү",
+  "жалпы",
+  "жолу",
+  "ээ",
+  "келип",
+  "көз",
+  "пайда",
+  "аралык",
+  "турат",
+  "мындай",
+  "баш",
+  "негизги",
+  "ага",
+  "өзүнүн",
+  "саясий",
+  "кол",
+  "жөнүндө",
+  "сөз",
+  "алган",
+  "ишке",
+  "байланыштуу",
+  "биз",
+  "жаңы",
+  "өзү",
+  "туура",
+  "ичинде",
+  "чоң",
+  "Анын",
+  "алынган",
+  "алар",
+  "зарыл",
+  "чыгып",
+  "айрым",
+  "жакшы",
+  "бирок",
+  "калган",
+  "берилген",
+  "Алар",
+  "толук",
+  "маалымат",
+  "банк",
+  "болушу",
+  "жол",
+  "өтө",
+  "бири",
+  "айтып",
+  "Кыргызстандын",
+  "Республикасынын",
+  "жеке",
+  "адамдар",
+  "жардам",
+  "келет",
+  "Ошол",
+  "белгилүү",
+  "Кыргызстан",
+  "экен",
+  "шайлоо",
+  "атайын",
+  "саналат",
+  "мыйзам",
+  "биздин",
+  "ким",
+  "болду",
+  "карата",
+  "чыккан",
+  "жер",
+  "кайра",
+  "Ушул",
+  "атат",
+  "иштеп",
+  "жогорку",
+  "чет",
+  "бийлик",
+  "ушундай",
+  "биринчи",
+  "улуттук",
+  "кылып",
+  "камсыз",
+  "мен",
+  "банктын",
+  "акча",
+  "өлкө",
+  "берет",
+  "укук",
+  "нерсе",
+  "Азаттык",
+  "өзгөчө",
+  "адамдын",
+  "арасында",
+  "азыр",
+  "катар",
+  "алат",
+  "андан",
+  "негизинде",
+  "билим",
+  "коомдук",
+  "аталган",
+  "элдин",
+  "Ошондой",
+  "берген",
+  "Алардын",
+  "алдында",
+  "Ошондуктан",
+  "иши",
+  "талап",
+  "кылган",
+  "деле",
+  "учурунда",
+  "сот",
+  "Биз",
+  "түрдө",
+  "коргоо",
+  "Кыргызстанда",
+  "анда",
+  "Андан",
+  "күнү",
+  "нече",
+  "жыл",
+  "мамлекет",
+  "сыяктуу",
+  "Мен",
+  "өткөн",
+  "Эгерде",
+  "алууга",
+  "аз",
+  "ара",
+  "жактан",
+  "Бишкек",
+  "ички",
+  "бери",
+  "белгиленген",
+  "берип",
+  "өкмөт",
+  "улам",
+  "туруп",
+  "экенин",
+  "киши",
+  "кызмат",
+  "көркөм",
+  "окуу",
+  "тышкары",
+  "топ",
+  "үч",
+  "бирге",
+  "аларды",
+  "илимий",
+  "түрдүү",
+  "калды",
+  "Ош",
+  "орун",
+  "азыркы",
+  "экономикалык",
+  "айтымында",
+  "социалдык",
+  "Бир",
+  "тиешелүү",
+  "тартып",
+  "билдирди",
+  "Анткени",
+  "Мындай",
+  "адамдардын",
+  "эмне",
+  "иштеген",
+  "сатып",
+  "кайсы",
+  "Ар",
+  "жаш",
+  "жооп",
+  "добуш",
+  "президент",
+  "тең",
+  "кылмыш",
+  "караганда",
+  "кирет",
+  "экендигин",
+  "кылуу",
+  "болчу",
+  "ортосунда",
+  "акыркы",
+  "чек",
+  "жергиликтүү",
+  "Жогорку",
+  "Манас",
+  "өзүнчө",
+  "ачык",
+  "эске",
+  "балдар",
+  "маселе",
+  "миң",
+  "калат",
+  "кеткен",
+  "баары",
+  "оор",
+  "жараша",
+  "мурда",
+  "иштер",
+  "ала",
+  "жакын",
+  "күн",
+  "сактоо",
+  "жашаган",
+  "башкы",
+  "максатында",
+  "түзүлгөн",
+  "Мындан",
+  "болбосо",
+  "кээ",
+  "кийинки",
+  "кылат",
+  "өлкөнүн",
+  "боло",
+  "күч",
+  "ортосундагы",
+  "так",
+  "аракет",
+  "дейт",
+  "барып",
+  "элдик",
+  "кеңири",
+  "экинчи",
+  "Мына",
+  "саны",
+  "болбойт",
+  "мамлекеттин",
+  "башкалар",
+  "жагынан",
+  "катуу",
+  "колдонулат",
+  "алдын",
+  "укуктуу",
+  "Азыр",
+  "башчысы",
+  "өкүлдөрү",
+  "албай",
+  "өзүнө",
+  "жүзөгө",
+  "эсептелет",
+  "коюлган",
+  "расмий",
+  "таза",
+  "маанилүү",
+  "элек",
+  "Мисалы",
+  "келишим",
+  "укугу",
+  "мурдагы",
+  "абдан",
+  "Эми",
+  "Себеби",
+  "жасалган",
+  "буга",
+  "берилет",
+  "Эгер",
+  "жатышат",
+  "бере",
+  "Эл",
+  "юридикалык",
+  "АКШ",
+  "алгачкы",
+  "орус",
+  "келе",
+  "мүчөсү",
+  "өтүп",
+  "карап",
+  "бийликтин",
+  "айтты",
+  "алмашуу",
+  "суу",
+  "2",
+  "күндө",
+  "берүүгө",
+  "кандайдыр",
+  "мындан",
+  "КР",
+  "кезде",
+  "жүргөн",
+  "К.",
+  "Убактылуу",
+  "канча",
+  "таасир",
+  "ары",
+  "кошумча",
+  "маалыматтар",
+  "айткан",
+  "кредиттик",
+  "ой",
+  "аларга",
+  "соң",
+  "анан",
+  "бөлүгү",
+  "түрү",
+  "муну",
+  "салуу",
+  "Анан",
+  "каралган",
+  "А.",
+  "элге",
+  "Буга",
+  "албайт",
+  "түзүү",
+  "өкмөттүн",
+  "чыгат",
+  "башкаруу",
+  "сунуш",
+  "тышкы",
+  "алдынча",
+  "жылы",
+  "калыбына",
+  "жөнүндөгү",
+  "коопсуздук",
+  "баштаган",
+  "сактап",
+  "кан",
+  "ишин",
+  "беш",
+  "бизге",
+  "көңүл",
+  "айтканда",
+  "баа",
+  "баалуу",
+  "бүгүнкү",
+  "көрсөтүлөт",
+  "Биздин",
+  "бирдей",
+  "эмгек",
+  "кыргыздар",
+  "айтылган",
+  "бүгүн",
+  "салып",
+  "аталат",
+  "жөнгө",
+  "дайыма",
+  "иштери",
+  "Мында",
+  "кошо",
+  "жүргүзүү",
+  "Азыркы",
+  "3",
+  "басып",
+  "Бакиев",
+  "чечим",
+  "коомдун",
+  "1",
+  "койгон",
+  "качан",
+  "эркин",
+  "милдеттүү",
+  "парламенттик",
+  "Кыргызстанга",
+  "көрсөтүлгөн",
+  "жашап",
+  "ири",
+  "Анда",
+  "мезгилде",
+  "тарыхый",
+  "жетекчиси",
+  "бала",
+  "дегенде",
+  "Кыргызстандагы",
+  "басма",
+  "байыркы",
+  "ичинен",
+  "Банк",
+  "укугуна",
+  "жүрүп",
+  "туруктуу",
+  "көптөгөн",
+  "орто",
+  "түзөт",
+  "тез",
+  "аткаруу",
+  "Орусия",
+  "коюп",
+  "болбосун",
+  "2.",
+  "болуш",
+  "убагында",
+  "алганда",
+  "он",
+  "түрүндө",
+  "бийликке",
+  "Ата",
+  "шартта",
+  "жатканын",
+  "өткөрүп",
+  "ойлойм",
+  "кетип",
+  "президенти",
+  "учун",
+  "өздөрүнүн",
+  "Аны",
+  "көрүп",
+  "диний",
+  "жылдан",
+  "мамиле",
+  "Ага",
+  "кара",
+  "нак",
+  "партия",
+  "Башкы",
+  "элди",
+  "жерге",
+  "убактылуу",
+  "Мамлекеттик",
+  "өлкөдө",
+  "чыгуу",
+  "деңгээлде",
+  "болуу",
+  "жайгашкан",
+  "2011",
+  "кетти",
+  "дүйнөлүк",
+  "алды",
+  "себеби",
+  "жылдын",
+  "белгиледи",
+  "чейинки",
+  "кылууга",
+  "укуктук",
+  "Маалымат",
+  "окуя",
+  "убакта",
+  "алынат",
+  "финансылык",
+  "ак",
+  "болууга",
+  "сырткары",
+  "дүйнө",
+  "жазып",
+  "жан",
+  "кирген",
+  "көрсөтүү",
+  "шарт",
+  "сайын",
+  "кыйын",
+  "болгондо",
+  "болгону",
+  "жерден",
+  "кыйла",
+  "кайрадан",
+  "эли",
+  "тыюу",
+  "баштап",
+  "катарында",
+  "ат",
+  "бөлүп",
+  "мына",
+  "маселелер",
+  "ыйгарым",
+  "төрт",
+  "келди",
+  "башында",
+  "берди",
+  "жогору",
+  "мыкты",
+  "айта",
+  "аткан",
+  "учурларда",
+  "негизинен",
+  "Кытай",
+  "айтылат",
+  "карабастан",
+  "кетет",
+  "максаты",
+  "тил",
+  "жумуш",
+  "кошуп",
+  "уулу",
+  "өзүн",
+  "деди",
+  "Борбордук",
+  "убакыт",
+  "маалыматтарды",
+  "байланышкан",
+  "органдары",
+  "өкүлү",
+  "чыгаруу",
+  "Роза",
+  "ашык",
+  "элинин",
+  "жасаган",
+  "түзгөн",
+  "укуктары",
+  "ишти",
+  "ай",
+  "жарандык",
+  "мүчөлөрү",
+  "анткени",
+  "ашыруу",
+  "зор",
+  "мисалы",
+  "жардамы",
+  "тарап",
+  "убакыты",
+  "төлөм",
+  "укугун",
+  "маселени",
+  "адамдарга",
+  "коом",
+  "уюмдар",
+  "Айрым",
+  "5",
+  "операцияларын",
+  "ордуна",
+  "бөлүшүү",
+  "саясат",
+  "таандык",
+  "Таңкы",
+  "көпчүлүк",
+  "мырза",
+  "1-чыгарылыш",
+  "3.",
+  "төрагасы",
+  "кирип",
+  "жасап",
+  "пайдалануу",
+  "айыл",
+  "Азия",
+  "каранды",
+  "пикир",
+  "1.",
+  "Демек",
+  "менин",
+  "жаштар",
+  "маалыматты",
+  "алынып",
+  "түзүп",
+  "башкача",
+  "Албетте",
+  "жарым",
+  "маданий",
+  "маселеси",
+  "болбой",
+  "кармап",
+  "олуттуу",
+  "алууда",
+  "катышкан",
+  "кыргыздардын",
+  "андай",
+  "дал",
+  "багытталган",
+  "эс",
+  "шаарында",
+  "жолун",
+  "чыныгы",
+  "баарын",
+  "жатабыз",
+  "Ошон",
+  "колдоо",
+  "өзбек",
+  "даяр",
+  "жүрөт",
+  "АКШнын",
+  "калып",
+  "каражаттары",
+  "ашуун",
+  "б.",
+  "каза",
+  "системасы",
+  "түрк",
+  "ыктымал",
+  "абал",
+  "бизде",
+  "жеткен",
+  "мааниге",
+  "ашырылат",
+  "бардыгы",
+  "эгерде",
+  "чыгарып",
+  "кызматкерлери",
+  "өтөт",
+  "толугу",
+  "чегинде",
+  "жакка",
+  "алышат",
+  "тараптуу",
+  "жашоо",
+  "миллион",
+  "партиянын",
+  "10",
+  "партиялар",
+  "шайлоого",
+  "күнгө",
+  "болгондуктан",
+  "го",
+  "иштерди",
+  "кыргыздын",
+  "тартипте",
+  "Орусиянын",
+  "партиясынын",
+  "суммасы",
+  "түшкөн",
+  "бою",
+  "Жалпы",
+  "жөнөкөй",
+  "Ак",
+  "аныкталат",
+  "Азаттыкка",
+  "каражат",
+  "каржылоо",
+  "сөзсүз",
+  "Отунбаева",
+  "негиз",
+  "оң",
+  "Муну",
+  "кызматы",
+  "медициналык",
+  "тартуу",
+  "колдонуу",
+  "министри",
+  "мааниси",
+  "бийликти",
+  "жылдык",
+  "күчтүү",
+  "табигый",
+  "М.",
+  "аты",
+  "ж.",
+  "коюу",
+  "үй",
+  "өткөрүү",
+  "согуш",
+  "тынч",
+  "аттуу",
+  "калышы",
+  "жазылган",
+  "мүмкүнчүлүк",
+  "айтылып",
+  "жыйынтыгы",
+  "Жеке",
+  "келтирүү",
+  "демократиялык",
+  "бөлүнөт",
+  "окуялар",
+  "өнүктүрүү",
+  "айтат",
+  "илим",
+  "улуу",
+  "жарык",
+  "ислам",
+  "ишкер",
+  "жүзүндө",
+  "билдирген",
+  "жаман",
+  "калса",
+  "аймагында",
+  "дем",
+  "көбүнчө",
+  "Жалал-Абад",
+  "Жаңы",
+  "татаал",
+  "4.",
+  "эсептейт",
+  "Бакиевдин",
+  "таасири",
+  "кылынат",
+  "байланыш",
+  "жүргүзүлөт",
+  "эларалык",
+  "Адам",
+  "Шейшемби",
+  "системасынын",
+  "натыйжасында",
+  "азырынча",
+  "аскер",
+  "Февраль",
+  "көргөн",
+  "макул",
+  "жалгыз",
+  "сом",
+  "эсепке",
+  "кеңешинин",
+  "жокко",
+  "01",
+  "Менин",
+  "барган",
+  "жөн",
+  "Ошентип",
+  "аныктоо",
+  "атындагы",
+  "электрондук",
+  "20",
+  "экендиги",
+  "балдардын",
+  "техникалык",
+  "атабыз",
+  "Президент",
+  "берүүчү",
+  "терең",
+  "банктык",
+  "иштерин",
+  "Манастын",
+  "коммерциялык",
+  "мүнөздүү",
+  "ирет",
+  "окуп",
+  "чечими",
+  "шаар",
+  "Россия",
+  "жарыяланган",
+  "кантип",
+  "комиссия",
+  "сиз",
+  "4",
+  "пайыздык",
+  "уюмдардын",
+  "жылга",
+  "президенттик",
+  "аракети",
+  "күчтөр",
+  "ден",
+  "Өз",
+  "көбүрөөк",
+  "дин",
+  "активдүү",
+  "аялдар",
+  "президенттин",
+  "катышып",
+  "соода",
+  "Т.",
+  "министрлигинин",
+  "үчүнчү",
+  "мезгил",
+  "жылда",
+  "тили",
+  "Башка",
+  "абалы",
+  "уюштуруу",
+  "жай",
+  "материалдык",
+  "чогуу",
+  "Орто",
+  "түзүүгө",
+  "салынган",
+  "тургандыгын",
+  "турганын",
+  "электр",
+  "күрөө",
+  "Кээ",
+  "келгенде",
+  "кыл",
+  "мүчө",
+  "тобу",
+  "банкка",
+  "каалаган",
+  "бүт",
+  "тапта",
+  "укуктарын",
+  "Кеңештин",
+  "белгилеп",
+  "министрлиги",
+  "абалда",
+  "кат",
+  "таасирин",
+  "аныкталган",
+  "түзүлүшү",
+  "болмок",
+  "кырдаал",
+  "тартиби",
+  "Банктын",
+  "кишинин",
+  "өздөрү",
+  "тийиштүү",
+  "мөөнөтү",
+  "терс",
+  "өкмөтү",
+  "облустук",
+  "Чыгыш",
+  "айрыкча",
+  "басары",
+  "чыга",
+  "атышат",
+  "май",
+  "Билим",
+  "баардык",
+  "көрсөтүп",
+  "ордун",
+  "Кредиттик",
+  "бийлиги",
+  "ишине",
+  "массалык",
+  "нерсени",
+  "Эки",
+  "бөлүнүп",
+  "к.",
+  "келишимдин",
+  "майда",
+  "түз",
+  "адамдарды",
+  "уруксат",
+  "чыкты",
+  "«Манас»",
+  "Бардык",
+  "адамга",
+  "болбогон",
+  "кээде",
+  "кыла",
+  "мектеп",
+  "партиясы",
+  "ишеним",
+  "маселелерди",
+  "тиешеси",
+  "уюмунун",
+  "жак",
+  "билдирет",
+  "органдарынын",
+  "ошондуктан",
+  "борбордук",
+  "сырткы",
+  "төмөнкү",
+  "мамлекеттер",
+  "көрүнүш",
+  "тандап",
+  "кредит",
+  "күндөн",
+  "таап",
+  "уюм",
+  "түшүп",
+  "Европа",
+  "дээрлик",
+  "ошону",
+  "себеп",
+  "төлөө",
+  "Ошондо",
+  "сотко",
+  "бүткүл",
+  "жери",
+  "келсе",
+  "Өзбекстан",
+  "Бүгүнкү",
+  "кыска",
+  "партиялардын",
+  "Борбор",
+  "милиция",
+  "окшош",
+  "болобу",
+  "эсептелген",
+  "Курманбек",
+  "алышкан",
+  "мыйзамсыз",
+  "эски",
+  "катчысы",
+  "баштады",
+  "дарылоо",
+  "жазган",
+  "мурун",
+  "парламент",
+  "эгер",
+  "ээси",
+  "Биринчи",
+  "аябай",
+  "өлкөдөгү",
+  "Мунун",
+  "Эмне",
+  "жазуу",
+  "жакта",
+  "көтөрүп",
+  "саясый",
+  "Казакстан",
+  "Сиз",
+  "валюта",
+  "ачып",
+  "канчалык",
+  "карандысыз",
+  "аял",
+  "чагылдырылат",
+  "Түштүк",
+  "булар",
+  "жъргъзъъ",
+  "татыктуу",
+  "чакан",
+  "ж.б.",
+  "бекем",
+  "качып",
+  "каражаттар",
+  "кызматынын",
+  "адамды",
+  "калктын",
+  "менчик",
+  "оюн",
+  "түзүлөт",
+  "автору",
+  "жүргүзүп",
+  "келишими",
+  "айында",
+  "Бүгүн",
+  "алдындагы",
+  "белгисиз",
+  "өттү",
+  "Батыш",
+  "райондук",
+  "А",
+  "кайтып",
+  "милдетин",
+  "саат",
+  "тартип",
+  "колго",
+  "каражаттарын",
+  "түрлөрү",
+  "алты",
+  "иштелип",
+  "келишимге",
+  "күчү",
+  "мүмкүнчүлүгү",
+  "туруу",
+  "дүйнөнүн",
+  "жоопкерчилик",
+  "кала",
+  "изилдөө",
+  "китеп",
+  "таануу",
+  "кайтарып",
+  "карай",
+  "мезгилинде",
+  "Аталган",
+  "өлкөлөр",
+  "Улуттар",
+  "атынан",
+  "тарткан",
+  "чыгыш",
+  "С.",
+  "салынат",
+  "чыгарган",
+  "экени",
+  "өлкөлөрдүн",
+  "аргасыз",
+  "ойлоп",
+  "табылган",
+  "тараптан",
+  "ыр",
+  "алтын",
+  "келиши",
+  "Учурда",
+};
+const uint16_t WA_FREQ_84_RANKS[] = {
+  0, 0, 946, 0, 308, 363, 0, 0, 352, 892, 0, 0, 0, 0, 128, 0,
+  0, 0, 0, 23, 420, 0, 0, 430, 751, 0, 964, 0, 0, 0, 0, 0,
+  0, 0, 380, 14, 112, 854, 0, 0, 0, 0, 65, 951, 0, 0, 0, 655,
+  0, 0, 0, 0, 421, 0, 0, 0, 0, 780, 0, 0, 0, 0, 0, 985,
+  0, 0, 637, 0, 0, 0, 0, 963, 431, 613, 666, 219, 0, 0, 560, 0,
+  943, 0, 0, 0, 186, 0, 0, 0, 0, 681, 263, 0, 0, 141, 744, 967,
+  415, 0, 0, 79, 0, 0, 0, 0, 253, 0, 54, 0, 0, 0, 0, 399,
+  416, 0, 0, 0, 0, 832, 0, 0, 0, 0, 0, 382, 515, 708, 659, 0,
+  0, 0, 0, 0, 338, 524, 685, 0, 502, 0, 966, 0, 0, 0, 0, 137,
+  1, 0, 0, 0, 297, 103, 566, 32, 273, 766, 753, 330, 473, 863, 217, 105,
+  378, 856, 948, 240, 956, 993, 0, 0, 0, 514, 0, 674, 0, 688, 0, 27,
+  57, 0, 638, 0, 0, 0, 189, 119, 0, 226, 0, 821, 861, 0, 0, 0,
+  667, 617, 303, 750, 704, 469, 0, 12, 620, 0, 635, 0, 916, 0, 0, 0,
+  0, 0, 579, 0, 542, 0, 867, 0, 634, 862, 608, 0, 0, 0, 0, 0,
+  934, 0, 772, 175, 170, 0, 370, 662, 0, 0, 0, 0, 0, 0, 164, 0,
+  851, 372, 0, 270, 282, 680, 58, 0, 0, 0, 133, 0, 324, 718, 953, 975,
+  0, 586, 0, 0, 256, 0, 0, 564, 713, 0, 612, 87, 0, 10, 0, 37,
+  47, 725, 955, 991, 668, 846, 911, 0, 0, 0, 0, 616, 762, 0, 0, 369,
+  0, 381, 94, 0, 0, 0, 0, 0, 789, 0, 0, 0, 756, 234, 0, 0,
+  0, 0, 0, 609, 472, 0, 0, 120, 110, 0, 0, 0, 0, 783, 0, 0,
+  19, 723, 264, 0, 823, 0, 0, 78, 0, 285, 849, 0, 0, 0, 0, 0,
+  434, 0, 784, 0, 0, 781, 761, 0, 0, 0, 790, 889, 947, 0, 692, 385,
+  458, 769, 0, 0, 0, 0, 652, 0, 0, 453, 0, 4, 437, 0, 0, 654,
+  0, 572, 296, 357, 417, 539, 607, 813, 952, 989, 0, 0, 497, 969, 0, 0,
+  0, 200, 245, 0, 0, 316, 0, 0, 890, 236, 891, 406, 0, 0, 0, 323,
+  853, 997, 0, 395, 0, 463, 35, 0, 411, 0, 0, 675, 0, 0, 124, 179,
+  204, 145, 262, 397, 706, 715, 935, 0, 0, 0, 0, 507, 0, 0, 983, 0,
+  0, 0, 0, 0, 570, 25, 647, 928, 0, 0, 377, 15, 798, 0, 0, 0,
+  36, 870, 293, 345, 487, 591, 55, 0, 17, 0, 0, 0, 641, 0, 46, 50,
+  909, 924, 0, 0, 0, 601, 44, 76, 901, 0, 140, 205, 0, 0, 887, 0,
+  839, 0, 0, 244, 0, 0, 424, 895, 0, 904, 898, 0, 176, 573, 343, 0,
+  0, 0, 0, 203, 173, 546, 279, 0, 0, 0, 258, 521, 0, 0, 0, 701,
+  0, 734, 879, 0, 0, 7, 482, 0, 587, 621, 0, 0, 0, 0, 785, 0,
+  0, 0, 0, 353, 0, 603, 255, 305, 494, 658, 938, 499, 0, 0, 0, 0,
+  0, 452, 0, 427, 722, 0, 0, 413, 0, 689, 147, 0, 500, 565, 642, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 574, 618, 0,
+  0, 869, 0, 0, 132, 530, 581, 448, 0, 683, 803, 0, 125, 74, 346, 0,
+  907, 0, 589, 0, 843, 0, 0, 0, 719, 0, 69, 0, 0, 902, 0, 0,
+  0, 950, 773, 0, 699, 0, 0, 0, 498, 0, 826, 0, 0, 0, 178, 0,
+  0, 0, 0, 0, 0, 0, 0, 342, 0, 0, 550, 0, 0, 920, 0, 825,
+  940, 801, 0, 457, 0, 0, 0, 18, 111, 533, 0, 331, 597, 622, 339, 230,
+  0, 0, 0, 0, 0, 0, 857, 0, 0, 0, 0, 371, 122, 426, 583, 693,
+  728, 824, 0, 865, 646, 368, 0, 0, 389, 22, 227, 248, 548, 884, 926, 812,
+  611, 34, 0, 0, 300, 961, 0, 0, 496, 0, 0, 184, 0, 0, 72, 259,
+  432, 195, 0, 760, 0, 0, 95, 0, 182, 190, 350, 0, 0, 0, 0, 0,
+  0, 268, 6, 309, 0, 0, 307, 271, 0, 0, 0, 0, 0, 986, 322, 0,
+  290, 517, 73, 166, 636, 68, 0, 247, 610, 614, 0, 0, 562, 0, 557, 0,
+  0, 733, 0, 0, 150, 0, 0, 0, 0, 0, 0, 467, 474, 0, 677, 0,
+  0, 0, 162, 446, 727, 0, 883, 152, 185, 287, 970, 0, 0, 11, 108, 159,
+  355, 871, 0, 468, 0, 0, 419, 553, 0, 191, 0, 0, 0, 814, 0, 0,
+  168, 0, 0, 0, 0, 0, 519, 774, 881, 590, 984, 0, 63, 0, 0, 0,
+  130, 0, 0, 0, 0, 995, 0, 0, 41, 792, 0, 0, 0, 0, 513, 0,
+  0, 516, 602, 0, 0, 0, 918, 0, 0, 123, 3, 793, 749, 0, 0, 0,
+  0, 209, 705, 914, 552, 0, 0, 0, 235, 291, 314, 518, 771, 409, 714, 359,
+  85, 433, 754, 167, 481, 528, 0, 0, 386, 0, 994, 0, 0, 0, 600, 0,
+  488, 0, 77, 283, 0, 0, 0, 97, 192, 0, 575, 135, 435, 0, 592, 491,
+  627, 0, 0, 0, 142, 326, 0, 0, 982, 0, 645, 0, 653, 212, 225, 913,
+  959, 82, 885, 0, 0, 625, 0, 0, 0, 146, 231, 0, 0, 0, 0, 289,
+  376, 535, 554, 13, 752, 269, 292, 0, 0, 408, 138, 449, 730, 0, 0, 996,
+  0, 310, 0, 160, 0, 0, 0, 0, 0, 0, 0, 361, 0, 0, 686, 0,
+  0, 0, 251, 327, 0, 976, 899, 0, 0, 0, 0, 0, 527, 0, 0, 0,
+  0, 364, 782, 802, 456, 1000, 0, 0, 0, 373, 649, 0, 0, 0, 703, 0,
+  0, 0, 0, 0, 716, 977, 0, 0, 923, 0, 43, 466, 67, 392, 198, 405,
+  443, 101, 163, 475, 228, 61, 335, 525, 556, 396, 151, 349, 207, 833, 848, 942,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 81, 695, 317,
+  38, 547, 626, 763, 770, 922, 104, 115, 156, 643, 888, 220, 208, 429, 933, 0,
+  759, 0, 0, 0, 0, 0, 588, 404, 729, 0, 246, 702, 0, 0, 367, 0,
+  820, 797, 875, 949, 0, 0, 878, 356, 0, 436, 0, 0, 872, 266, 0, 286,
+  0, 0, 0, 0, 0, 0, 0, 710, 0, 422, 0, 460, 0, 0, 0, 0,
+  0, 249, 0, 912, 0, 852, 0, 0, 845, 0, 407, 0, 383, 787, 0, 315,
+  0, 0, 0, 0, 48, 0, 563, 631, 0, 0, 0, 541, 0, 0, 0, 0,
+  795, 60, 777, 939, 0, 0, 526, 62, 0, 0, 794, 0, 815, 0, 866, 536,
+  0, 0, 261, 21, 0, 229, 0, 512, 549, 678, 656, 737, 0, 354, 0, 0,
+  0, 0, 0, 807, 0, 531, 8, 0, 0, 0, 0, 0, 739, 155, 505, 478,
+  66, 302, 540, 800, 0, 0, 534, 0, 624, 0, 0, 16, 0, 0, 202, 0,
+  0, 974, 971, 0, 486, 0, 506, 0, 0, 218, 0, 0, 0, 0, 0, 0,
+  957, 0, 0, 0, 33, 188, 265, 599, 0, 0, 0, 0, 0, 0, 0, 520,
+  0, 748, 0, 0, 0, 0, 0, 0, 0, 0, 358, 0, 990, 0, 0, 503,
+  808, 96, 215, 799, 932, 0, 0, 0, 577, 919, 988, 0, 0, 651, 0, 0,
+  0, 0, 669, 0, 0, 157, 937, 915, 921, 470, 0, 0, 187, 0, 0, 905,
+  0, 0, 0, 0, 0, 543, 690, 116, 0, 0, 0, 0, 0, 0, 0, 304,
+  444, 864, 414, 962, 0, 0, 615, 944, 742, 438, 479, 927, 0, 0, 492, 0,
+  0, 632, 0, 0, 831, 696, 0, 0, 0, 931, 0, 51, 0, 0, 0, 0,
+  0, 765, 0, 973, 0, 0, 0, 223, 418, 360, 746, 351, 806, 523, 673, 682,
+  711, 930, 0, 441, 0, 0, 0, 838, 321, 0, 0, 0, 0, 0, 459, 425,
+  511, 640, 594, 0, 0, 280, 0, 0, 850, 471, 402, 89, 532, 858, 0, 336,
+  0, 836, 796, 0, 0, 91, 450, 0, 391, 0, 0, 0, 114, 267, 127, 362,
+  788, 805, 830, 250, 809, 929, 0, 529, 0, 161, 194, 0, 451, 56, 628, 0,
+  0, 876, 0, 462, 0, 0, 375, 0, 0, 0, 0, 0, 0, 0, 0, 410,
+  0, 0, 0, 630, 0, 0, 0, 0, 0, 0, 0, 0, 153, 0, 0, 0,
+  559, 664, 0, 0, 197, 0, 92, 558, 0, 0, 169, 232, 374, 0, 855, 29,
+  0, 0, 538, 0, 657, 328, 709, 900, 0, 0, 0, 340, 868, 0, 0, 0,
+  0, 288, 0, 0, 0, 0, 0, 0, 0, 731, 0, 0, 465, 0, 0, 0,
+  0, 0, 0, 0, 233, 26, 0, 0, 0, 842, 0, 661, 747, 522, 987, 0,
+  775, 0, 320, 569, 0, 0, 0, 0, 0, 0, 171, 0, 0, 561, 0, 740,
+  365, 936, 0, 0, 0, 165, 623, 88, 224, 260, 490, 694, 0, 0, 0, 388,
+  0, 24, 758, 102, 767, 639, 0, 745, 576, 379, 827, 633, 0, 148, 49, 0,
+  0, 276, 0, 0, 0, 118, 0, 239, 817, 981, 684, 0, 0, 0, 53, 348,
+  908, 0, 717, 829, 0, 476, 504, 0, 334, 897, 0, 0, 873, 0, 0, 59,
+  568, 0, 0, 301, 0, 0, 810, 275, 238, 596, 860, 241, 509, 0, 403, 0,
+  0, 0, 0, 0, 174, 0, 493, 0, 121, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 844, 0, 0, 0, 0, 0, 741, 0, 544, 0, 0, 0, 318, 0,
+  0, 109, 485, 0, 0, 210, 545, 221, 0, 0, 707, 311, 644, 0, 0, 28,
+  31, 660, 978, 134, 0, 0, 0, 0, 294, 30, 697, 979, 0, 201, 0, 776,
+  605, 859, 0, 0, 299, 755, 992, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 75, 968, 0, 52, 841, 0, 0, 0, 0, 0, 306, 0, 341, 0,
+  910, 0, 736, 9, 0, 0, 0, 0, 100, 757, 70, 0, 0, 440, 0, 0,
+  0, 580, 0, 0, 390, 0, 0, 0, 252, 724, 0, 495, 0, 0, 720, 0,
+  0, 477, 0, 83, 0, 837, 0, 896, 0, 0, 0, 272, 893, 0, 578, 0,
+  687, 464, 598, 0, 0, 0, 0, 0, 0, 0, 0, 0, 312, 822, 131, 401,
+  222, 428, 999, 0, 0, 0, 0, 0, 0, 0, 0, 818, 332, 894, 0, 0,
+  917, 954, 510, 0, 0, 42, 0, 886, 0, 489, 880, 278, 158, 98, 384, 0,
+  0, 445, 149, 672, 671, 206, 877, 998, 0, 0, 0, 484, 698, 0, 0, 582,
+  387, 243, 834, 211, 154, 454, 0, 0, 0, 0, 366, 0, 0, 0, 0, 0,
+  595, 423, 0, 0, 136, 0, 177, 196, 0, 0, 0, 0, 941, 0, 139, 333,
+  5, 180, 447, 143, 281, 648, 726, 237, 735, 325, 329, 86, 216, 254, 295, 551,
+  835, 874, 882, 0, 442, 828, 0, 99, 0, 0, 925, 0, 811, 0, 0, 107,
+  0, 0, 0, 0, 0, 0, 0, 0, 347, 183, 571, 0, 0, 71, 0, 0,
+  277, 555, 106, 663, 0, 0, 39, 393, 0, 0, 0, 0, 593, 0, 0, 960,
+  461, 764, 213, 768, 732, 0, 20, 0, 455, 0, 0, 0, 0, 0, 501, 0,
+  743, 113, 172, 972, 606, 398, 439, 567, 129, 400, 906, 337, 958, 903, 965, 816,
+  980, 181, 840, 0, 0, 0, 0, 0, 0, 0, 0, 0, 712, 45, 537, 0,
+  786, 0, 64, 274, 0, 0, 584, 0, 80, 721, 791, 804, 650, 679, 0, 0,
+  0, 0, 819, 0, 0, 0, 0, 0, 93, 199, 0, 0, 117, 0, 257, 412,
+  691, 84, 779, 0, 319, 0, 483, 0, 0, 0, 0, 0, 0, 0, 0, 126,
+  945, 0, 629, 394, 0, 0, 0, 2, 40, 0, 0, 0, 144, 242, 700, 0,
+  0, 0, 0, 0, 604, 0, 0, 0, 0, 778, 214, 344, 847, 0, 665, 670,
+  298, 313, 480, 508, 676, 738, 0, 90, 0, 0, 193, 0, 619, 0, 284, 585,
+};
+
+const char *WA_FREQ_85_TOKENS[] = {
+  "est",
+  "thomas",
+  "panem",
+  "soror",
+  "discipula",
+  "lycei",
+  "non",
+  "saccus",
+  "plēnus",
+  "valde",
+  "tristis",
+  "exceptiones",
+  "erant",
+  "emit",
+  "naves",
+  "quae",
+  "forte",
+  "paratae",
+  "corripiunt",
+  "onerantque",
+  "auro",
+  "portantur",
+  "avari",
+  "pygmalionis",
+  "opes",
+  "pelago",
+  "dux",
+  "foemina",
+  "facti",
+  "e",
+  "pekino",
+  "oriundi",
+  "sunt",
+  "pelliculam",
+  "aspiciunt",
+  "vendebat",
+  "potentia",
+  "hominem",
+  "qui",
+  "eam",
+  "tenit",
+  "corrumpit",
+  "et",
+  "victimas",
+  "suas",
+  "vitiat",
+};
+const uint16_t WA_FREQ_85_RANKS[] = {
+  43, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 14, 38, 0, 0, 42,
+  0, 0, 26, 0, 25, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 6, 3, 23, 0, 0, 0, 0, 0, 28, 36, 0,
+  11, 44, 0, 19, 0, 24, 0, 0, 0, 0, 0, 0, 0, 0, 34, 0,
+  0, 5, 35, 0, 7, 0, 45, 0, 33, 39, 0, 0, 0, 41, 2, 32,
+  0, 29, 0, 0, 0, 0, 0, 0, 40, 0, 0, 10, 0, 0, 0, 4,
+  9, 0, 0, 18, 16, 20, 27, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  13, 0, 22, 30, 21, 15, 8, 0, 31, 12, 17, 37, 0, 0, 0, 0,
+};
+
+const char *WA_FREQ_86_TOKENS[] = {
+  "mu",
+  "ku",
+  "nga",
+  "ne",
+  "nti",
+  "era",
+  "bwe",
+  "e",
+  "wa",
+  "naye",
+  "ate",
+  "ya",
+  "gye",
+  "oba",
+  "ye",
+  "buli",
+  "abantu",
+  "we",
+  "ssente",
+  "kuba",
+  "kyokka",
+  "nnyo",
+  "kino",
+  "kubanga",
+  "be",
+  "kya",
+  "ba",
+  "kye",
+  "Mu",
+  "poliisi",
+  "eno",
+  "gwe",
+  "Buganda",
+  "Uganda",
+  "yali",
+  "bye",
+  "kati",
+  "okuva",
+  "Kabaka",
+  "lwa",
+  "Kampala",
+  "kwe",
+  "yagambye",
+  "za",
+  "wabula",
+  "alina",
+  "lwe",
+  "agamba",
+  "bulungi",
+  "abaana",
+  "emyaka",
+  "ddala",
+  "bya",
+  "gwa",
+  "y’e",
+  "lya",
+  "na",
+  "olwo",
+  "omwana",
+  "ebintu",
+  "ze",
+  "zino",
+  "oluvannyuma",
+  "guno",
+  "bwa",
+  "omu",
+  "okukola",
+  "omuntu",
+  "si",
+  "Wabula",
+  "omusajja",
+  "bangi",
+  "yategeezezza",
+  "wakati",
+  "waliwo",
+  "Kino",
+  "ga",
+  "kkooti",
+  "aba",
+  "eri",
+  "Bwe",
+  "maaso",
+  "abamu",
+  "Museveni",
+  "nsonga",
+  "naddala",
+  "bino",
+  "mmotoka",
+  "omukazi",
+  "abalala",
+  "kiseera",
+  "ngeri",
+  "wange",
+  "bantu",
+  "okuba",
+  "byonna",
+  "Nze",
+  "mbeera",
+  "Pulezidenti",
+  "ono",
+  "nze",
+  "bano",
+  "wadde",
+  "mwe",
+  "Gavumenti",
+  "okulaba",
+  "yabadde",
+  "Ate",
+  "Ku",
+  "bonna",
+  "ki",
+  "balina",
+  "Naye",
+  "nabo",
+  "gavumenti",
+  "ttaka",
+  "okufuna",
+  "Poliisi",
+  "ali",
+  "ka",
+  "myaka",
+  "KCCA",
+  "ekyo",
+  "Kyokka",
+  "obulungi",
+  "ettaka",
+  "bagenda",
+  "kifo",
+  "okubeera",
+  "yonna",
+  "bagamba",
+  "bali",
+  "abadde",
+  "lino",
+  "muntu",
+  "kimu",
+  "eyali",
+  "wano",
+  "Katonda",
+  "emirimu",
+  "mulimu",
+  "wamu",
+  "omulimu",
+  "Nnoonya",
+  "okutuuka",
+  "awo",
+  "ggwanga",
+  "engeri",
+  "omuli",
+  "owa",
+  "okuli",
+  "abasajja",
+  "baali",
+  "maka",
+  "lwaki",
+  "eyo",
+  "eya",
+  "ge",
+  "ayagala",
+  "ennyo",
+  "Njagala",
+  "Era",
+  "omukwano",
+  "ssaawa",
+  "ensonga",
+  "Nga",
+  "ttiimu",
+  "omukyala",
+  "ddwaaliro",
+  "nsi",
+  "okugenda",
+  "okutuusa",
+  "singa",
+  "nkola",
+  "wiiki",
+  "amaanyi",
+  "disitulikiti",
+  "tewali",
+  "ennaku",
+  "mukwano",
+  "embeera",
+  "omwaka",
+  "Bukedde",
+  "Abaganda",
+  "amazzi",
+  "munne",
+  "baagala",
+  "dda",
+  "mukyala",
+  "wansi",
+  "abeera",
+  "ekya",
+  "baabwe",
+  "luno",
+  "Nnina",
+  "nnina",
+  "emu",
+  "Cranes",
+  "agenda",
+  "ebirala",
+  "mukazi",
+  "kitundu",
+  "ebyo",
+  "awaka",
+  "musajja",
+  "kkampuni",
+  "Katikkiro",
+  "gya",
+  "bba",
+  "waggulu",
+  "endala",
+  "Abantu",
+  "olina",
+  "Bino",
+  "ebiri",
+  "ndi",
+  "bintu",
+  "lye",
+  "Yagambye",
+  "ewa",
+  "kyalo",
+  "Waliwo",
+  "Palamenti",
+  "obukadde",
+  "bingi",
+  "kibuga",
+  "Buli",
+  "yenna",
+  "bitundu",
+  "nali",
+  "ng’ali",
+  "bange",
+  "kitaawe",
+  "ggwe",
+  "mpaka",
+  "bizinensi",
+  "mwana",
+  "oyo",
+  "munno",
+  "kwa",
+  "baana",
+  "Mmengo",
+  "South",
+  "baba",
+  "banne",
+  "buno",
+  "Dr",
+  "kano",
+  "bbiri",
+  "okumala",
+  "omuwala",
+  "abakazi",
+  "abo",
+  "lunaku",
+  "maama",
+  "talina",
+  "10",
+  "anti",
+  "oluusi",
+  "omwami",
+  "bakola",
+  "abali",
+  "Wano",
+  "nange",
+  "mwaka",
+  "w’e",
+  "NRM",
+  "waabwe",
+  "baabadde",
+  "ebbanga",
+  "ssomero",
+  "Masaka",
+  "ekintu",
+  "Amerika",
+  "Bannayuganda",
+  "Kati",
+  "zonna",
+  "babadde",
+  "okumanya",
+  "ensimbi",
+  "omulala",
+  "bo",
+  "essimu",
+  "akola",
+  "omusango",
+  "Oluvannyuma",
+  "bajja",
+  "Minisita",
+  "abavubuka",
+  "okusobola",
+  "ofiisi",
+  "muwala",
+  "n’ebirala",
+  "zaabwe",
+  "Mukono",
+  "ajja",
+  "kyonna",
+  "ke",
+  "emmere",
+  "kukola",
+  "Omusajja",
+  "obuzibu",
+  "abasinga",
+  "abatuuze",
+  "ow’e",
+  "Agamba",
+  "obulamu",
+  "kubeera",
+  "amagezi",
+  "gumu",
+  "nnyumba",
+  "ekifo",
+  "Mulago",
+  "bw’aba",
+  "Ono",
+  "Kale",
+  "ennyumba",
+  "babiri",
+  "njagala",
+  "ow’emyaka",
+  "30",
+  "ffe",
+  "omusaayi",
+  "yo",
+  "amaka",
+  "kuliko",
+  "kisaawe",
+  "bodaboda",
+  "bulamu",
+  "Besigye",
+  "Kenya",
+  "akulira",
+  "yange",
+  "okudda",
+  "Abamu",
+  "Black",
+  "bw’oba",
+  "olwa",
+  "kiri",
+  "kitegeeza",
+  "bifo",
+  "bulijjo",
+  "Omukazi",
+  "Bungereza",
+  "eddagala",
+  "taata",
+  "oli",
+  "ensi",
+  "ssimu",
+  "20",
+  "kibiina",
+  "n’agamba",
+  "okulya",
+  "abakyala",
+  "emmotoka",
+  "n’abaana",
+  "ssentebe",
+  "famire",
+  "kizibu",
+  "esatu",
+  "ayinza",
+  "baffe",
+  "Eno",
+  "ekiseera",
+  "erya",
+  "Ye",
+  "nayo",
+  "byabwe",
+  "Afrika",
+  "mukulu",
+  "leero",
+  "okusinziira",
+  "Lukwago",
+  "100",
+  "abalina",
+  "yaabwe",
+  "bubi",
+  "eyabadde",
+  "oyinza",
+  "2010",
+  "abawala",
+  "asobola",
+  "kuno",
+  "2",
+  "3",
+  "Bano",
+  "nnyina",
+  "Ssande",
+  "mutabani",
+  "katale",
+  "kiba",
+  "nnamba",
+  "omuliro",
+  "obudde",
+  "okusoma",
+  "n’abantu",
+  "luguudo",
+  "biseera",
+  "mukolo",
+  "ng’alina",
+  "mirimu",
+  "sso",
+  "ebweru",
+  "eza",
+  "tulina",
+  "amanyi",
+  "obulwadde",
+  "okusinga",
+  "takisi",
+  "Ssentebe",
+  "omukulu",
+  "munda",
+  "w’emyaka",
+  "2011",
+  "enkola",
+  "kugenda",
+  "makya",
+  "ssinga",
+  "Jinja",
+  "olukiiko",
+  "okwongera",
+  "siteegi",
+  "Omwana",
+  "Wakiso",
+  "nnyingi",
+  "okutandika",
+  "Engeri",
+  "Omuntu",
+  "ebigambo",
+  "kirungi",
+  "okukuba",
+  "okuzimba",
+  "olubuto",
+  "Ekirala",
+  "kintu",
+  "erinnya",
+  "wo",
+  "ndowooza",
+  "mangu",
+  "yiika",
+  "4",
+  "Aba",
+  "Meeya",
+  "ggoolo",
+  "katono",
+  "5",
+  "amasasi",
+  "amateeka",
+  "omubiri",
+  "erina",
+  "okumpi",
+  "FC",
+  "babeera",
+  "ddyo",
+  "eggwanga",
+  "olunaku",
+  "tebalina",
+  "okutta",
+  "ebimu",
+  "Wadde",
+  "ewedde",
+  "abaserikale",
+  "ekitiibwa",
+  "mubiri",
+  "okuggyako",
+  "Ndi",
+  "abaali",
+  "ekibiina",
+  "Africa",
+  "Obote",
+  "eggulo",
+  "endwadde",
+  "Kamya",
+  "waffe",
+  "naawe",
+  "bayita",
+  "tuli",
+  "John",
+  "Kayihura",
+  "bungi",
+  "ebitundu",
+  "nno",
+  "ggombolola",
+  "osobola",
+  "Ntebe",
+  "mawanga",
+  "nju",
+  "oguwedde",
+  "Ssekabaka",
+  "lukiiko",
+  "musango",
+  "Makindye",
+  "okukozesa",
+  "abayizi",
+  "egenda",
+  "emirundi",
+  "POLIISI",
+  "y’omu",
+  "Obuganda",
+  "abazannyi",
+  "basajja",
+  "bbanka",
+  "gano",
+  "mateeka",
+  "minisita",
+  "so",
+  "Micho",
+  "Moses",
+  "ekiro",
+  "Mukama",
+  "emabega",
+  "David",
+  "abakozi",
+  "abasuubuzi",
+  "ente",
+  "mukaaga",
+  "mutwe",
+  "akatale",
+  "langi",
+  "muganda",
+  "okwogera",
+  "omupiira",
+  "omugenzi",
+  "bwonna",
+  "ebya",
+  "lw’e",
+  "ebizibu",
+  "ly’e",
+  "ng’ate",
+  "budde",
+  "b’e",
+  "50",
+  "emyezi",
+  "enkulu",
+  "akakiiko",
+  "maanyi",
+  "omulambo",
+  "Muteesa",
+  "eby’enjawulo",
+  "engoye",
+  "kumpi",
+  "mazzi",
+  "nguudo",
+  "ntikko",
+  "n’abalala",
+  "Ssemwanga",
+  "ebisinga",
+  "1",
+  "kika",
+  "Kawempe",
+  "amaaso",
+  "awamu",
+  "batandika",
+  "kkono",
+  "mwezi",
+  "Joseph",
+  "mulembe",
+  "ssaako",
+  "Ssaabasajja",
+  "ekitundu",
+  "kufuna",
+  "siriimu",
+  "Okuva",
+  "bwabwe",
+  "kisenge",
+  "ssatu",
+  "y’emu",
+  "bazadde",
+  "ezo",
+  "yekka",
+  "bannaabwe",
+  "buvuddeko",
+  "12",
+  "bbanga",
+  "kkubo",
+  "basatu",
+  "ng’agamba",
+  "Mutebi",
+  "ogwa",
+  "Kaweesi",
+  "empya",
+  "essaawa",
+  "muli",
+  "atya",
+  "okusasula",
+  "omukisa",
+  "yaffe",
+  "ludda",
+  "January",
+  "Mmande",
+  "Ne",
+  "gwange",
+  "kulaba",
+  "omutwe",
+  "2016",
+  "agambye",
+  "ebiseera",
+  "obuyinza",
+  "Maama",
+  "Musisi",
+  "okukuuma",
+  "empisa",
+  "II",
+  "abawagizi",
+  "bamanyi",
+  "kulonda",
+  "nnannyini",
+  "Luzira",
+  "abaabadde",
+  "bufumbo",
+  "Abasajja",
+  "Makerere",
+  "balowooza",
+  "laavu",
+  "mwetegefu",
+  "Bw’oba",
+  "FUFA",
+  "Okugeza",
+  "amannya",
+  "empaka",
+  "Charles",
+  "ababaka",
+  "bamaze",
+  "bombi",
+  "ejja",
+  "ekibuga",
+  "Luweero",
+  "buzibu",
+  "ekitongole",
+  "ekizibu",
+  "25",
+  "Awo",
+  "Trump",
+  "ababadde",
+  "okwegatta",
+  "December",
+  "kituufu",
+  "lumu",
+  "n’agenda",
+  "okufa",
+  "Lubaga",
+  "bokka",
+  "emirembe",
+  "okukwata",
+  "Lwomukaaga",
+  "Peter",
+  "emmundu",
+  "nnaku",
+  "Abaana",
+  "kijja",
+  "muto",
+  "nnali",
+  "amaze",
+  "ez’enjawulo",
+  "okuddamu",
+  "olumu",
+  "okusaba",
+  "tugenda",
+  "Akulira",
+  "mbu",
+  "omukono",
+  "bafuna",
+  "ebifo",
+  "15",
+  "18",
+  "2017",
+  "abazadde",
+  "n’atandika",
+  "Gen",
+  "kitongole",
+  "nakyo",
+  "ndaba",
+  "emisango",
+  "okunoonyereza",
+  "y'e",
+  "6",
+  "Mulindwa",
+  "Road",
+  "kyali",
+  "oluyimba",
+  "twali",
+  "abakulembeze",
+  "amangu",
+  "bayinza",
+  "bbaala",
+  "gino",
+  "omulamuzi",
+  "Abatuuze",
+  "Ronald",
+  "essanyu",
+  "Lubiri",
+  "Oba",
+  "lubuto",
+  "muganzi",
+  "DP",
+  "abasawo",
+  "mba",
+  "nabyo",
+  "obwagazi",
+  "yalina",
+  "essomero",
+  "obufumbo",
+  "obuwumbi",
+  "okugula",
+  "okulonda",
+  "yadde",
+  "omutima",
+  "yafa",
+  "kakiiko",
+  "kale",
+  "mikwano",
+  "bukadde",
+  "gyabwe",
+  "kuva",
+  "mmere",
+  "of",
+  "omubaka",
+  "yunivasite",
+  "Mengo",
+  "Zooni",
+  "kkomera",
+  "okuwa",
+  "17",
+  "Abalala",
+  "Olwo",
+  "akalulu",
+  "masomero",
+  "sirina",
+  "8",
+  "Baganda",
+  "Lugogo",
+  "abato",
+  "Bobi",
+  "St",
+  "Walusimbi",
+  "ani",
+  "ddagala",
+  "edda",
+  "mannya",
+  "okujja",
+  "omutuuze",
+  "Godfrey",
+  "Kigambibwa",
+  "ekika",
+  "gaabwe",
+  "mingi",
+  "omugagga",
+  "Mbeera",
+  "basobole",
+  "biri",
+  "lyonna",
+  "akaboozi",
+  "bakazi",
+  "n’ategeeza",
+  "okutwala",
+  "olw’okuba",
+  "Sarah",
+  "ebirowoozo",
+  "eka",
+  "ekutte",
+  "ffenna",
+  "kusooka",
+  "okuyita",
+  "Lwaki",
+  "Mukasa",
+  "akawuka",
+  "batuuka",
+  "okwewala",
+  "yasoose",
+  "7",
+  "Kitegeeza",
+  "Mbarara",
+  "Singa",
+  "abakulu",
+  "kasita",
+  "mupiira",
+  "okulwanyisa",
+  "tolina",
+  "2008",
+  "Lwokutaano",
+  "Mityana",
+  "endagaano",
+  "mutindo",
+  "pikipiki",
+  "2015",
+  "E",
+  "July",
+  "Nsubuga",
+  "etteeka",
+  "mulundi",
+  "okuyingira",
+  "omulundi",
+  "ebbaluwa",
+  "ennyimba",
+  "palamenti",
+  "Kintu",
+  "Muwonge",
+  "Nnaalongo",
+  "Robert",
+  "Villa",
+  "yagenda",
+  "Sudhir",
+  "amalala",
+  "bakozesa",
+  "basobola",
+  "enduulu",
+  "erimu",
+  "Obwakabaka",
+  "Omu",
+  "bakyala",
+  "bbaasi",
+  "omwezi",
+  "yasooka",
+  "Beti",
+  "Kizito",
+  "May",
+  "bava",
+  "bizibu",
+  "okuyamba",
+  "ssi",
+  "yatandika",
+  "August",
+  "Embeera",
+  "Sudan",
+  "obungi",
+  "baze",
+  "enteekateeka",
+  "kigambibwa",
+  "kyangu",
+  "ojja",
+  "Kato",
+  "Ssente",
+  "bakadde",
+  "simanyi",
+  "y’ensonga",
+  "ekimu",
+  "naffe",
+  "okulaga",
+  "URA",
+  "Wine",
+  "ebika",
+  "nazo",
+  "ngalo",
+  "Nakivubo",
+  "kirabika",
+  "kiro",
+  "ng’abantu",
+  "ntono",
+  "olutalo",
+  "40",
+  "Ebintu",
+  "Kayunga",
+  "ekyapa",
+  "eryo",
+  "2009",
+  "2012",
+  "batya",
+  "ekirala",
+  "mukama",
+  "bimu",
+  "gwonna",
+  "Hajji",
+  "enkoko",
+  "kkanisa",
+  "minisitule",
+  "omukolo",
+  "FDC",
+  "Lwokuna",
+  "Muky",
+  "Omulamuzi",
+  "School",
+  "abayimbi",
+  "amawulire",
+  "bukya",
+  "kyabwe",
+  "Ssebaana",
+  "bawala",
+  "kaweefube",
+  "kiyinza",
+  "liigi",
+  "okusooka",
+  "omutindo",
+  "Mw",
+  "batuuze",
+  "bazze",
+  "bbo",
+  "gwo",
+  "ogwo",
+  "okwagala",
+  "mangi",
+  "myezi",
+  "ng’eno",
+  "obuvunaanyizibwa",
+  "Nakawa",
+  "awatali",
+  "buyinza",
+  "mbadde",
+  "musaayi",
+  "n’asaba",
+  "pulezidenti",
+  "waakiri",
+  "azze",
+  "nfuna",
+  "ng’enda",
+  "obubaka",
+  "Katwe",
+  "asobole",
+  "liizi",
+  "mulamu",
+  "munaana",
+  "ziri",
+  "Ssaalongo",
+  "ezimu",
+  "kiva",
+  "yakola",
+  "Fred",
+  "October",
+  "ky’e",
+  "omuyimbi",
+  "yasabye",
+  "Ekyo",
+  "Omukyala",
+  "ffaamu",
+  "mirembe",
+  "omwenge",
+  "2014",
+  "bw’agamba",
+  "Muganda",
+  "Omwogezi",
+  "Leero",
+  "Olubiri",
+  "UPDF",
+  "Zari",
+  "byalo",
+  "Busoga",
+  "Nansana",
+  "September",
+  "okuzaala",
+  "waka",
+  "Ggwe",
+  "bwangu",
+  "bwo",
+  "embi",
+  "mpola",
+  "24",
+  "Kasubi",
+  "Lubega",
+  "Mpigi",
+  "abasoba",
+  "agenze",
+  "and",
+  "basinga",
+  "by",
+  "emitwalo",
+  "mutima",
+  "okunoonya",
+  "okussa",
+  "omulungi",
+  "sizoni",
+  "wala",
+  "zokka",
+  "Matovu",
+  "Mukiibi",
+  "Rwanda",
+  "abagenyi",
+  "enguudo",
+  "kiki",
+  "k’e",
+  "n’omwana",
+  "obutwa",
+  "yava",
+  "11",
+  "Ffe",
+  "Mbabazi",
+  "Yategeezezza",
+  "abangi",
+  "bibiri",
+  "mikolo",
+  "musanvu",
+  "obwo",
+  "okwambala",
+  "otya",
+  "Hotel",
+  "Musajja",
+  "ava",
+  "yajja",
+  "Bunyoro",
+  "Gwe",
+  "kitebe",
+  "n’e",
+  "obwa",
+  "2.",
+  "Mayiga",
+  "Mubiru",
+  "Omuganda",
+  "ago",
+  "batandise",
+  "emikolo",
+  "kinene",
+  "ngoye",
+};
+const uint16_t WA_FREQ_86_RANKS[] = {
+  0, 868, 507, 0, 0, 0, 0, 0, 395, 477, 409, 745, 359, 795, 301, 925,
+  343, 429, 612, 648, 656, 0, 0, 0, 262, 0, 0, 975, 0, 142, 374, 591,
+  781, 0, 0, 149, 0, 92, 0, 275, 0, 0, 0, 278, 464, 0, 0, 313,
+  593, 0, 0, 0, 389, 671, 222, 650, 442, 796, 95, 799, 472, 621, 844, 926,
+  541, 703, 999, 0, 0, 0, 0, 0, 0, 0, 0, 473, 417, 66, 327, 675,
+  700, 597, 749, 314, 126, 296, 578, 253, 0, 0, 0, 0, 977, 399, 228, 770,
+  895, 0, 0, 0, 0, 990, 0, 0, 0, 315, 647, 0, 721, 0, 0, 731,
+  0, 438, 0, 0, 0, 667, 831, 0, 0, 816, 891, 303, 0, 183, 0, 421,
+  934, 0, 18, 0, 0, 771, 865, 1, 346, 455, 15, 377, 547, 217, 0, 0,
+  616, 519, 0, 545, 0, 0, 0, 34, 0, 0, 484, 0, 103, 0, 476, 0,
+  0, 0, 798, 225, 936, 948, 0, 0, 0, 0, 0, 0, 0, 672, 941, 0,
+  0, 973, 0, 0, 0, 0, 345, 0, 0, 901, 528, 827, 0, 633, 193, 380,
+  0, 0, 0, 0, 0, 549, 780, 0, 0, 0, 0, 0, 0, 351, 0, 0,
+  197, 344, 900, 0, 923, 0, 0, 0, 918, 0, 932, 165, 0, 0, 0, 0,
+  0, 458, 856, 440, 104, 449, 747, 927, 0, 0, 0, 987, 0, 572, 0, 0,
+  875, 0, 0, 0, 846, 0, 0, 579, 192, 494, 241, 692, 697, 851, 272, 581,
+  0, 0, 0, 0, 0, 0, 0, 0, 163, 845, 0, 504, 249, 339, 468, 529,
+  309, 889, 994, 0, 0, 0, 89, 100, 427, 879, 0, 0, 0, 0, 0, 0,
+  0, 0, 947, 0, 0, 0, 0, 0, 830, 0, 462, 0, 0, 834, 0, 0,
+  0, 0, 0, 498, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0,
+  496, 635, 0, 0, 61, 723, 0, 0, 861, 0, 673, 0, 0, 0, 294, 134,
+  0, 0, 0, 0, 0, 0, 0, 0, 147, 322, 0, 140, 0, 378, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 295, 264, 0, 989, 0, 636, 813, 0,
+  857, 0, 0, 0, 0, 499, 23, 520, 587, 0, 196, 967, 0, 0, 0, 0,
+  0, 838, 30, 0, 0, 734, 6, 905, 577, 908, 0, 107, 755, 668, 0, 0,
+  0, 0, 0, 0, 0, 532, 0, 0, 0, 0, 874, 0, 0, 789, 0, 0,
+  131, 0, 0, 0, 0, 698, 194, 744, 826, 0, 625, 0, 340, 600, 127, 0,
+  128, 430, 0, 972, 257, 779, 0, 0, 445, 360, 216, 146, 44, 185, 282, 118,
+  649, 714, 919, 930, 0, 0, 0, 800, 49, 85, 133, 425, 454, 0, 115, 0,
+  0, 501, 7, 310, 583, 788, 0, 0, 420, 0, 0, 965, 159, 627, 811, 0,
+  122, 884, 388, 0, 0, 518, 670, 0, 0, 0, 0, 330, 229, 491, 167, 555,
+  562, 530, 5, 561, 752, 792, 237, 907, 0, 0, 0, 3, 274, 0, 0, 0,
+  840, 877, 320, 450, 0, 0, 0, 300, 364, 0, 0, 0, 0, 0, 0, 0,
+  0, 527, 0, 0, 778, 892, 762, 129, 611, 363, 0, 291, 387, 0, 288, 0,
+  265, 904, 0, 0, 0, 135, 173, 0, 0, 0, 0, 0, 0, 487, 708, 0,
+  0, 0, 0, 130, 212, 179, 0, 17, 812, 0, 32, 60, 0, 0, 0, 0,
+  0, 964, 0, 0, 669, 0, 0, 0, 0, 86, 0, 0, 280, 0, 0, 119,
+  0, 0, 0, 0, 0, 0, 0, 0, 984, 942, 690, 0, 0, 0, 0, 0,
+  0, 0, 607, 0, 691, 0, 0, 0, 0, 394, 0, 13, 0, 515, 0, 80,
+  568, 894, 77, 590, 730, 970, 0, 0, 485, 0, 0, 0, 0, 782, 26, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 911, 255, 598, 358, 246, 719, 0, 605,
+  0, 0, 0, 0, 0, 839, 82, 0, 937, 0, 0, 0, 0, 534, 0, 0,
+  0, 0, 98, 428, 57, 102, 453, 436, 564, 615, 73, 178, 0, 383, 0, 431,
+  0, 0, 0, 0, 0, 56, 663, 843, 0, 371, 983, 630, 722, 0, 0, 0,
+  0, 802, 0, 0, 0, 187, 0, 0, 509, 505, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 617, 0, 141, 443, 0, 765,
+  478, 0, 0, 0, 589, 0, 0, 0, 991, 11, 279, 0, 0, 0, 0, 0,
+  0, 0, 0, 51, 881, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 247, 166, 0, 232, 470, 517, 586, 542, 210, 522, 592, 878, 902,
+  452, 920, 726, 489, 0, 0, 0, 0, 0, 976, 0, 738, 0, 0, 271, 413,
+  820, 887, 97, 382, 0, 0, 0, 0, 969, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 398, 0, 0, 0, 631, 739, 321, 109, 784, 333, 311,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 202, 953, 350, 113, 0, 0,
+  0, 0, 0, 457, 0, 0, 619, 0, 0, 208, 227, 45, 405, 441, 566, 567,
+  0, 404, 68, 0, 683, 695, 0, 0, 153, 306, 791, 674, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 111, 250, 737, 982, 0,
+  0, 0, 601, 0, 132, 0, 0, 299, 0, 451, 281, 654, 0, 0, 337, 643,
+  200, 928, 43, 543, 0, 0, 978, 0, 0, 0, 137, 717, 818, 558, 859, 0,
+  349, 0, 0, 0, 33, 804, 0, 710, 0, 0, 0, 0, 0, 0, 488, 0,
+  335, 426, 0, 0, 302, 0, 0, 775, 822, 0, 759, 715, 0, 0, 0, 604,
+  0, 797, 0, 39, 0, 0, 659, 0, 0, 0, 961, 466, 741, 0, 0, 0,
+  0, 968, 422, 502, 0, 0, 573, 0, 0, 402, 341, 248, 809, 939, 0, 0,
+  0, 471, 0, 0, 0, 403, 447, 369, 0, 0, 552, 0, 0, 385, 0, 0,
+  0, 94, 243, 465, 235, 733, 842, 909, 189, 342, 381, 917, 944, 331, 0, 145,
+  823, 701, 847, 0, 0, 270, 835, 986, 0, 304, 0, 0, 666, 872, 963, 742,
+  699, 0, 48, 419, 215, 660, 713, 910, 836, 416, 563, 407, 853, 864, 0, 0,
+  661, 993, 849, 0, 0, 0, 0, 0, 0, 783, 120, 634, 906, 0, 0, 40,
+  64, 0, 0, 0, 0, 0, 4, 75, 0, 651, 0, 0, 0, 0, 0, 0,
+  915, 218, 0, 819, 0, 0, 751, 705, 326, 460, 510, 0, 0, 664, 0, 439,
+  0, 175, 0, 0, 0, 0, 620, 0, 0, 869, 0, 0, 138, 479, 814, 0,
+  0, 912, 956, 0, 69, 0, 0, 0, 716, 0, 0, 571, 0, 776, 0, 0,
+  0, 0, 0, 0, 0, 0, 684, 482, 833, 0, 0, 0, 35, 386, 679, 234,
+  105, 308, 224, 114, 332, 0, 0, 136, 0, 0, 0, 0, 0, 0, 0, 808,
+  0, 0, 0, 0, 0, 0, 971, 0, 325, 392, 628, 665, 821, 841, 493, 0,
+  328, 0, 0, 434, 139, 0, 0, 0, 0, 544, 0, 506, 557, 803, 72, 54,
+  125, 735, 0, 0, 0, 0, 0, 0, 0, 676, 58, 289, 0, 191, 0, 293,
+  916, 0, 746, 921, 0, 336, 521, 0, 0, 0, 0, 538, 0, 0, 0, 0,
+  0, 0, 0, 181, 0, 0, 0, 0, 444, 207, 0, 0, 774, 0, 0, 0,
+  0, 793, 390, 785, 190, 981, 0, 0, 606, 0, 0, 150, 287, 824, 0, 0,
+  524, 0, 0, 0, 397, 0, 658, 469, 0, 0, 0, 0, 0, 156, 401, 985,
+  0, 273, 850, 753, 365, 16, 379, 459, 238, 888, 997, 551, 316, 0, 182, 254,
+  297, 0, 283, 0, 0, 0, 594, 0, 946, 0, 22, 47, 307, 629, 639, 158,
+  0, 554, 0, 681, 391, 266, 0, 531, 0, 0, 0, 0, 0, 290, 0, 736,
+  0, 974, 0, 0, 0, 945, 0, 556, 226, 646, 0, 0, 0, 38, 0, 0,
+  408, 513, 0, 0, 867, 204, 862, 0, 575, 0, 707, 0, 837, 106, 0, 0,
+  0, 245, 0, 0, 0, 0, 767, 2, 0, 523, 0, 0, 913, 954, 0, 384,
+  0, 0, 357, 361, 59, 410, 483, 815, 0, 0, 36, 0, 0, 0, 0, 461,
+  497, 582, 979, 0, 0, 0, 0, 0, 0, 269, 805, 880, 0, 0, 0, 0,
+  938, 0, 0, 960, 0, 0, 828, 480, 347, 267, 284, 686, 393, 184, 110, 548,
+  525, 680, 0, 0, 0, 27, 602, 201, 0, 0, 0, 653, 0, 0, 0, 292,
+  0, 0, 638, 0, 0, 25, 0, 0, 0, 78, 154, 206, 456, 0, 0, 0,
+  0, 0, 559, 570, 623, 729, 825, 996, 0, 0, 0, 758, 0, 0, 261, 0,
+  0, 0, 0, 0, 0, 367, 550, 96, 694, 219, 943, 240, 152, 0, 171, 0,
+  790, 0, 768, 860, 0, 24, 622, 0, 711, 0, 0, 88, 424, 801, 0, 0,
+  474, 574, 0, 148, 446, 958, 0, 873, 370, 448, 195, 0, 0, 0, 0, 0,
+  0, 0, 914, 286, 21, 71, 81, 0, 0, 0, 164, 0, 0, 806, 688, 0,
+  0, 640, 0, 0, 0, 0, 724, 277, 897, 0, 0, 329, 662, 893, 966, 0,
+  0, 0, 0, 0, 0, 14, 0, 584, 817, 79, 258, 348, 433, 560, 0, 0,
+  0, 0, 0, 0, 0, 0, 42, 0, 0, 0, 595, 0, 0, 0, 0, 677,
+  0, 0, 0, 0, 0, 0, 0, 756, 0, 516, 0, 221, 718, 368, 848, 0,
+  155, 0, 0, 0, 500, 55, 0, 929, 712, 764, 285, 0, 896, 641, 0, 0,
+  169, 0, 685, 725, 995, 0, 0, 180, 356, 761, 883, 0, 0, 29, 952, 0,
+  0, 0, 0, 876, 0, 0, 396, 0, 209, 214, 603, 0, 618, 565, 0, 99,
+  151, 0, 0, 8, 198, 256, 268, 988, 569, 0, 231, 740, 0, 0, 0, 0,
+  0, 372, 0, 0, 687, 0, 0, 702, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 63, 76, 885, 998, 0, 832, 0, 0, 0, 0, 0, 239, 898, 0,
+  0, 0, 475, 613, 0, 0, 0, 0, 0, 512, 0, 0, 514, 0, 463, 93,
+  732, 41, 338, 588, 763, 886, 0, 0, 334, 657, 535, 352, 0, 0, 678, 435,
+  1000, 414, 0, 890, 0, 0, 0, 0, 0, 0, 858, 949, 0, 931, 0, 787,
+  0, 748, 0, 0, 354, 553, 0, 67, 355, 696, 0, 870, 0, 0, 37, 90,
+  0, 0, 0, 0, 0, 12, 743, 980, 0, 777, 0, 0, 0, 0, 0, 160,
+  0, 259, 0, 0, 0, 0, 0, 962, 161, 162, 0, 626, 0, 0, 91, 0,
+  252, 0, 682, 0, 116, 366, 112, 610, 143, 406, 632, 951, 0, 0, 0, 0,
+  415, 0, 608, 950, 324, 0, 177, 511, 596, 176, 637, 866, 0, 276, 144, 533,
+  0, 172, 0, 0, 924, 689, 19, 0, 0, 0, 0, 53, 760, 855, 46, 0,
+  70, 495, 437, 362, 772, 412, 899, 957, 0, 0, 0, 223, 644, 0, 74, 319,
+  486, 757, 933, 769, 863, 882, 233, 992, 0, 0, 236, 62, 244, 773, 0, 251,
+  0, 0, 0, 0, 0, 599, 829, 323, 31, 0, 0, 0, 263, 492, 168, 83,
+  903, 0, 0, 0, 0, 199, 0, 186, 213, 0, 727, 922, 0, 706, 0, 539,
+  0, 0, 101, 220, 766, 0, 318, 400, 750, 0, 0, 0, 0, 0, 642, 540,
+  124, 0, 467, 580, 0, 754, 0, 423, 0, 704, 490, 652, 807, 955, 0, 0,
+  0, 0, 546, 260, 373, 935, 0, 0, 0, 0, 174, 0, 0, 0, 0, 20,
+  50, 170, 211, 418, 526, 609, 0, 786, 108, 432, 52, 65, 121, 230, 576, 203,
+  411, 854, 0, 298, 0, 242, 305, 585, 624, 0, 0, 0, 0, 810, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 87, 0, 0, 0, 0, 10, 0, 0,
+  205, 117, 645, 508, 312, 709, 0, 0, 0, 0, 0, 614, 0, 0, 0, 157,
+  0, 376, 693, 871, 794, 940, 84, 123, 536, 728, 0, 28, 655, 0, 0, 959,
+  0, 0, 537, 0, 375, 188, 317, 353, 481, 852, 503, 0, 0, 0, 720, 0,
+};
+
+const char *WA_FREQ_87_TOKENS[] = {
+  "o",
+  "à",
+  "l",
+  "son",
+  "gh",
+  "de",
+  "é",
+  "veuggio",
+  "unna",
+  "pisciña",
+  "chi",
+  "ste",
+  "scignoriñe",
+  "mi",
+  "piña",
+  "graçie",
+  "açendi",
+  "e",
+  "luxe",
+  "inta",
+  "mæ",
+  "famiggia",
+  "pe",
+  "disnâ",
+  "da",
+  "domenega",
+  "ea",
+  "andio",
+  "d",
+  "anâ",
+  "mangiâ",
+  "feua",
+  "casa",
+  "no",
+  "anæ",
+  "construe",
+  "fabriche",
+  "in",
+  "mescico",
+  "bon",
+  "scrive",
+  "machina",
+  "confuso",
+  "pòrco",
+  "reusa",
+  "a",
+  "domandou",
+  "ch",
+  "â",
+  "ciammesse",
+  "ciù",
+  "tardi",
+  "ma",
+  "se",
+  "ascordou",
+};
+const uint16_t WA_FREQ_87_RANKS[] = {
+  0, 0, 0, 17, 2, 4, 36, 16, 55, 0, 0, 0, 0, 19, 21, 23,
+  51, 0, 0, 0, 0, 0, 26, 0, 0, 0, 5, 6, 35, 40, 47, 0,
+  0, 1, 0, 0, 0, 11, 0, 49, 13, 0, 38, 0, 0, 22, 12, 29,
+  0, 0, 10, 46, 20, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 50, 48, 7, 27, 39, 45, 0, 3, 0, 0, 0,
+  0, 0, 15, 0, 0, 0, 9, 41, 0, 0, 0, 0, 43, 52, 54, 0,
+  0, 0, 0, 33, 0, 0, 0, 0, 0, 0, 8, 28, 24, 32, 42, 44,
+  0, 0, 0, 18, 0, 0, 0, 37, 0, 31, 0, 0, 25, 53, 30, 34,
+};
+
+const char *WA_FREQ_88_TOKENS[] = {
+  "l",
+  "che",
+  "é",
+  "tu",
+  "n",
+  "dl",
+  "da",
+  "al",
+  "entourn",
+  "te",
+  "la",
+  "ne",
+  "nia",
+  "ie",
+  "el",
+  "sà",
+  "scrive",
+  "dret",
+  "fej",
+  "freit",
+  "ancuei",
+  "ladin",
+  "dolomitich",
+  "lingaz",
+  "neolatin",
+  "rejoné",
+  "30",
+  "000",
+  "persones",
+  "cinch",
+  "valedes",
+  "via",
+  "massif",
+  "sela",
+  "tl",
+  "tirol",
+  "meridional",
+  "mia",
+  "convinzion",
+  "intima",
+  "religion",
+  "davegnì",
+  "serà",
+  "pur",
+  "umanism",
+  "vuel",
+  "dì",
+  "cult",
+  "de",
+  "dut",
+  "chel",
+  "om",
+  "vita",
+  "entriega",
+  "santificheda",
+  "y",
+  "porteda",
+  "su",
+  "a",
+  "valour",
+  "moral",
+  "ala",
+  "dij",
+  "ti",
+  "plej",
+  "i",
+  "ciofs",
+  "sce",
+  "menges",
+  "mueres",
+  "son",
+  "vedl",
+  "miei",
+  "mutons",
+  "scola",
+  "ae",
+  "lavé",
+  "mie",
+  "auto",
+  "cogn",
+  "doures",
+  "dizionar",
+  "canche",
+  "liejes",
+  "chest",
+  "liber",
+};
+const uint16_t WA_FREQ_88_RANKS[] = {
+  0, 10, 0, 0, 0, 0, 0, 0, 35, 0, 0, 0, 0, 0, 0, 61,
+  0, 0, 2, 84, 0, 0, 75, 0, 0, 0, 0, 0, 85, 0, 0, 0,
+  78, 82, 0, 0, 29, 0, 0, 0, 0, 0, 0, 63, 0, 0, 65, 0,
+  0, 0, 0, 25, 58, 0, 12, 0, 0, 34, 0, 27, 36, 0, 0, 0,
+  0, 0, 0, 0, 0, 55, 0, 0, 0, 0, 76, 0, 1, 57, 0, 5,
+  0, 0, 0, 13, 0, 44, 17, 54, 0, 0, 0, 0, 0, 0, 4, 74,
+  15, 30, 45, 73, 0, 0, 0, 79, 0, 0, 0, 46, 0, 0, 66, 0,
+  0, 72, 0, 0, 0, 42, 0, 0, 24, 62, 11, 83, 6, 7, 0, 48,
+  0, 0, 0, 23, 71, 8, 0, 0, 38, 53, 0, 21, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 32, 0, 81, 0, 0, 0, 49, 52, 0, 0, 0,
+  0, 0, 0, 50, 26, 0, 0, 0, 0, 0, 0, 0, 64, 0, 51, 0,
+  31, 39, 70, 59, 19, 0, 0, 0, 0, 56, 0, 41, 0, 40, 0, 86,
+  16, 0, 69, 80, 0, 0, 0, 3, 0, 0, 0, 0, 22, 0, 43, 0,
+  60, 0, 0, 0, 0, 0, 0, 0, 28, 0, 0, 0, 0, 0, 0, 0,
+  67, 14, 0, 0, 0, 33, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 77, 0, 9, 0, 68, 0, 18, 37, 20, 0, 47, 0, 0, 0,
+};
+
+const char *WA_FREQ_89_TOKENS[] = {
+  "fa",
+  "freid",
+  "miga",
+  "œch",
+  "per",
+  "dent",
+  "cold",
+  "al",
+  "incœ",
+  "mé",
+  "g",
+  "hoo",
+  "lu",
+  "sta",
+  "ben",
+  "piœv",
+  "come",
+  "va",
+  "la",
+  "se",
+  "vedom",
+};
+const uint16_t WA_FREQ_89_RANKS[] = {
+  0, 0, 0, 0, 6, 8, 9, 0, 14, 0, 2, 16, 0, 13, 18, 0,
+  5, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 12, 20, 0,
+  0, 0, 15, 0, 0, 3, 11, 0, 21, 0, 0, 0, 0, 0, 17, 0,
+  10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 19, 0, 0, 0, 7,
+};
+
@@ -0,0 +1,11504 @@
+#include "worldalphabets_data.h"
+
+const char *WA_FREQ_90_TOKENS[] = {
+  "na",
+  "ya",
+  "oyo",
+  "mpe",
+  "te",
+  "yango",
+  "ba",
+  "ezali",
+  "bato",
+  "ye",
+  "to",
+  "pe",
+  "moko",
+  "mpo",
+  "mingi",
+  "mpé",
+  "moto",
+  "o",
+  "yo",
+  "ndenge",
+  "bango",
+  "Na",
+  "TB",
+  "soki",
+  "bazali",
+  "ezalí",
+  "kati",
+  "po",
+  "mosala",
+  "tango",
+  "ekoki",
+  "kosala",
+  "ma",
+  "de",
+  "kasi",
+  "ko",
+  "wana",
+  "Soki",
+  "mwa",
+  "tǒ",
+  "eye",
+  "nde",
+  "ngai",
+  "lokola",
+  "nyonso",
+  "bana",
+  "e",
+  "mboka",
+  "makasi",
+  "makambo",
+  "baye",
+  "esika",
+  "mokili",
+  "bwa",
+  "mbula",
+  "Kemet",
+  "azali",
+  "lisusu",
+  "biso",
+  "ezalaki",
+  "lya",
+  "mbala",
+  "liboso",
+  "nini",
+  "sima",
+  "kozala",
+  "misala",
+  "ete",
+  "koleka",
+  "mosusu",
+  "la",
+  "malamu",
+  "Kasi",
+  "nzela",
+  "bongo",
+  "Yango",
+  "misusu",
+  "bazalaki",
+  "ekolo",
+  "gilípi",
+  "nzoto",
+  "ozali",
+  "yambo",
+  "kopesa",
+  "mobimba",
+  "Ba",
+  "batu",
+  "bokono",
+  "likolo",
+  "mibale",
+  "mobu",
+  "bakoki",
+  "mokolo",
+  "monene",
+  "ndako",
+  "BCG",
+  "koloba",
+  "mwana",
+  "noki",
+  "lingomba",
+  "mabe",
+  "ntango",
+  "penza",
+  "bokonzi",
+  "ezalaka",
+  "kozua",
+  "mikolo",
+  "wa",
+  "maladie",
+  "Ezali",
+  "koyeba",
+  "lelo",
+  "libota",
+  "sika",
+  "esengeli",
+  "kaka",
+  "kokoma",
+  "makoki",
+  "bya",
+  "mpó",
+  "mya",
+  "nkisi",
+  "sanza",
+  "Vincent",
+  "a",
+  "bisika",
+  "elembo",
+  "kelasi",
+  "minene",
+  "moke",
+  "yě",
+  "Beljiki",
+  "azalaki",
+  "azalí",
+  "kotonga",
+  "likambo",
+  "tee",
+  "Bikolo",
+  "Ekolo",
+  "O",
+  "etali",
+  "ndéngé",
+  "se",
+  "Bato",
+  "Congo",
+  "Lokola",
+  "ata",
+  "bomoi",
+  "ebele",
+  "mpona",
+  "mwasi",
+  "pene",
+  "Belgique",
+  "Ezipeto",
+  "Kongo",
+  "eleki",
+  "epayi",
+  "kokende",
+  "kosalisa",
+  "mabele",
+  "makanisi",
+  "motema",
+  "mpenza",
+  "nayo",
+  "pandemie",
+  "sánzá",
+  "Afrika",
+  "Kinshasa",
+  "Tango",
+  "alingi",
+  "bambula",
+  "bolingo",
+  "kino",
+  "kobela",
+  "mbangu",
+  "pé",
+  "yangó",
+  "Bonkumu",
+  "Lingala",
+  "Mpo",
+  "Nile",
+  "basango",
+  "biloko",
+  "bino",
+  "ezala",
+  "kozwa",
+  "maye",
+  "mibeko",
+  "mitano",
+  "virus",
+  "Lazariste",
+  "Moto",
+  "Narmer",
+  "babola",
+  "bandako",
+  "boye",
+  "boyokani",
+  "eloko",
+  "kobimisa",
+  "kolakisa",
+  "kopekisa",
+  "kotala",
+  "mikanda",
+  "moyi",
+  "posa",
+  "óyo",
+  "Ingɛlɛ́tɛlɛ",
+  "Ndakisa",
+  "Nzambe",
+  "Tshombe",
+  "basi",
+  "bomoyi",
+  "depression",
+  "ekomi",
+  "koluka",
+  "kosalela",
+  "kotanga",
+  "maboko",
+  "mawa",
+  "nsima",
+  "ntina",
+  "pona",
+  "suka",
+  "tii",
+  "Nzela",
+  "Pandemia",
+  "Wana",
+  "awa",
+  "banda",
+  "baninga",
+  "banso",
+  "basusu",
+  "bikolo",
+  "bilenge",
+  "bitumba",
+  "elongo",
+  "esengi",
+  "ewutaka",
+  "kala",
+  "kobongisa",
+  "koki",
+  "kolanda",
+  "lisanga",
+  "lolenge",
+  "mbongo",
+  "mokɔlɔ",
+  "mpasi",
+  "mutu",
+  "mwindu",
+  "naino",
+  "ndakisa",
+  "politiki",
+  "solo",
+  "30",
+  "Ata",
+  "Faraon",
+  "Kongó",
+  "Mentuhotep",
+  "Yésu",
+  "bakonzi",
+  "bingumba",
+  "bokasi",
+  "bokolongono",
+  "boyíké",
+  "ebandi",
+  "ebonga",
+  "ebongi",
+  "et",
+  "kobanda",
+  "kombo",
+  "kosenga",
+  "loléngé",
+  "matali",
+  "mayi",
+  "mike",
+  "misato",
+  "mpô",
+  "wapi",
+  "Djenga",
+  "Katanga",
+  "Kingasani",
+  "Kongó-Kinsásá",
+  "Mutos",
+  "Ndako",
+  "Ndenge",
+  "Nzámbe",
+  "SF-",
+  "Sima",
+  "bangó",
+  "bonkumu",
+  "bonsomi",
+  "epai",
+  "mangomba",
+  "mateya",
+  "mpenzá",
+  "naye",
+  "nkombo",
+  "okoki",
+  "pasi",
+  "tonga",
+  "tɛ́",
+  "yoko",
+  "Bakoki",
+  "Charité",
+  "Esengeli",
+  "Kala",
+  "Masina",
+  "Mbula",
+  "Paul",
+  "Santu",
+  "bafaraon",
+  "bamvula",
+  "bandeko",
+  "bapaya",
+  "basengeli",
+  "bazui",
+  "biye",
+  "bobokoli",
+  "boni",
+  "elingi",
+  "esengo",
+  "fer",
+  "kama",
+  "komona",
+  "kotambola",
+  "koyoka",
+  "lopitalo",
+  "mabota",
+  "maladi",
+  "manso",
+  "masolo",
+  "mayele",
+  "mbuma",
+  "mbóka",
+  "mobali",
+  "mobú",
+  "molongo",
+  "moninga",
+  "mpene",
+  "nakati",
+  "ndelo",
+  "nkómbó",
+  "nse",
+  "ordinaire",
+  "que",
+  "senga",
+  "yé",
+  "zomi",
+  "ézala",
+  "10",
+  "BD",
+  "Bacillus",
+  "Buku",
+  "Calmette-Guérin",
+  "II",
+  "Likonzi",
+  "Makambo",
+  "Matari",
+  "Mbala",
+  "Mission",
+  "Mobeko",
+  "Ya",
+  "akoki",
+  "atomi",
+  "azua",
+  "babengaka",
+  "bakristu",
+  "balingi",
+  "bandɛkɛ",
+  "baoyo",
+  "bazala",
+  "bazalí",
+  "binso",
+  "bipayi",
+  "bondeko",
+  "contre",
+  "dokotolo",
+  "ena",
+  "engumba",
+  "eyebani",
+  "kobatela",
+  "kobika",
+  "kobikisa",
+  "kuna",
+  "libanda",
+  "lingala",
+  "lisalisi",
+  "lisolo",
+  "lisúsu",
+  "loboko",
+  "lokasa",
+  "lokumu",
+  "loposo",
+  "malonga",
+  "mama",
+  "masanga",
+  "masi",
+  "mobateli",
+  "mokanda",
+  "molai",
+  "molakisi",
+  "molayi",
+  "monganga",
+  "mopaya",
+  "mosika",
+  "mposa",
+  "mái",
+  "míngi",
+  "ndɛkɛ",
+  "nionso",
+  "nkota",
+  "nzambe",
+  "nzembo",
+  "nzóto",
+  "pembeni",
+  "poso",
+  "soso",
+  "stress",
+  "sɔ́kí",
+  "tina",
+  "yɔ̌",
+  "zali",
+  "zemi",
+  "11",
+  "2",
+  "Basusu",
+  "Bɛ́lɛjika",
+  "Fisch",
+  "H5N1",
+  "K",
+  "Kinsásá",
+  "Kisangani",
+  "Leta",
+  "Lingomba",
+  "Mobateli",
+  "Mosala",
+  "Mpona",
+  "Ntango",
+  "Okoki",
+  "Sango",
+  "Suzanne",
+  "Vubu",
+  "Ye",
+  "Yesu",
+  "bapesaka",
+  "basala",
+  "basali",
+  "bavandaka",
+  "bazangi",
+  "bisíká",
+  "bizaleli",
+  "boyambi",
+  "boyekoli",
+  "bǎna",
+  "chemin",
+  "contact",
+  "du",
+  "epesi",
+  "esengelaki",
+  "esíká",
+  "gouvernement",
+  "internet",
+  "kobanga",
+  "kofanda",
+  "kokanga",
+  "kosalama",
+  "kosunga",
+  "kotika",
+  "kovanda",
+  "libwa",
+  "losambo",
+  "malembe",
+  "mambi",
+  "mibu",
+  "mine",
+  "minso",
+  "misalisi",
+  "misálá",
+  "mombongo",
+  "moye",
+  "ndambo",
+  "ngambo",
+  "nioso",
+  "ná",
+  "pandemia",
+  "sekele",
+  "sé",
+  "tata",
+  "té",
+  "vaccin",
+  "yúni",
+  "zuwa",
+  "zuwama",
+  "1",
+  "20",
+  "2004",
+  "2006",
+  "3",
+  "5",
+  "A",
+  "Bamama",
+  "Bana",
+  "Bruxelles",
+  "Coltan",
+  "Constatation",
+  "Ebamba",
+  "Eklezya",
+  "Ekoki",
+  "Elingi",
+  "Epai",
+  "Espérant",
+  "Filles",
+  "Imhotep",
+  "Kamuke",
+  "Kasa",
+  "Lelo",
+  "Louise",
+  "MHL-",
+  "Maladi",
+  "Mama",
+  "Maria",
+  "Mbangu",
+  "Misala",
+  "Misalisi",
+  "Misalisi ya Mbangu",
+  "Mohly",
+  "Moyángeli",
+  "Mángwɛlɛ́",
+  "N'Kany",
+  "Nkómbó",
+  "Nubia",
+  "Patience",
+  "Saint",
+  "Sene",
+  "Vincent wa Paul",
+  "WHO",
+  "akeyi",
+  "ans",
+  "awei",
+  "baboti",
+  "bakoko",
+  "bakomi",
+  "banganga",
+  "bankoko",
+  "bapiramidi",
+  "basúsu",
+  "bayebi",
+  "bazua",
+  "bituka",
+  "bo",
+  "bobateli",
+  "boboto",
+  "bokɔnɔ",
+  "bosoto",
+  "bosémbo",
+  "bozali",
+  "butu",
+  "bákolela",
+  "ebanda",
+  "ebandaki",
+  "ekomaki",
+  "ekosalisa",
+  "ekozala",
+  "en",
+  "esalaka",
+  "ewuti",
+  "famille",
+  "formation",
+  "immunite",
+  "iye",
+  "km",
+  "kobebisa",
+  "kobima",
+  "koboma",
+  "kokanisa",
+  "kolobela",
+  "komeka",
+  "kondima",
+  "kosilisa",
+  "kosolola",
+  "kosála",
+  "kotiya",
+  "koyamba",
+  "koyekola",
+  "leta",
+  "libulu",
+  "lifuta",
+  "lina",
+  "lisano",
+  "liye",
+  "lizalí",
+  "lokóla",
+  "lokótá",
+  "makila",
+  "makolo",
+  "makási",
+  "maloba",
+  "mbongwana",
+  "mibali",
+  "mibange",
+  "mikili",
+  "minei",
+  "ministre",
+  "minoko",
+  "misatu",
+  "miso",
+  "mission",
+  "miye",
+  "mokonzi",
+  "molende",
+  "molimo",
+  "motindo",
+  "moyángeli",
+  "muke",
+  "nazali",
+  "ndembó",
+  "ngele",
+  "ngomba",
+  "ngonga",
+  "nkoto",
+  "nsango",
+  "ntángo",
+  "nyoso",
+  "oyeba",
+  "pamba",
+  "projet",
+  "sala",
+  "sango",
+  "symptomes",
+  "tuku",
+  "vie",
+  "vilúsu",
+  "yɔ̂",
+  "ákolela",
+  "ɛntɛrnɛ́tɛ",
+  "15",
+  "16",
+  "Banda",
+  "Bantoma",
+  "Bayindo",
+  "Bienvenu",
+  "Bienvenu Sene Mongaba",
+  "Bobokoli",
+  "Bulamatari",
+  "CSK",
+  "Chinois",
+  "Esika",
+  "Etumangele",
+  "Ezalí",
+  "Kinshásá",
+  "Kofanda",
+  "Komeka",
+  "Kuna",
+  "Kɔ́ngɔ",
+  "Likambo",
+  "Likolo",
+  "Mabiki",
+  "Malamu",
+  "Mamá",
+  "Maneno",
+  "Marillac",
+  "Mibeko",
+  "Mingi",
+  "Mokonzi",
+  "Mongaba",
+  "Mosungi",
+  "Mpe",
+  "Nakati",
+  "Naye",
+  "Ngai",
+  "Organisation",
+  "Président",
+  "Santé",
+  "Tuberculose",
+  "UK",
+  "Wiki",
+  "akomaki",
+  "alingaki",
+  "alobi",
+  "apesi",
+  "asielumuki",
+  "azui",
+  "bafungoli",
+  "bakambi",
+  "bakolo",
+  "bakopesa",
+  "bameka",
+  "basalaki",
+  "basoso",
+  "batimolaka",
+  "bazuaka",
+  "bilamba",
+  "bilanga",
+  "biteni",
+  "biteyelo",
+  "biyamba",
+  "bokomi",
+  "bokási",
+  "bopemi",
+  "bosembo",
+  "bovis",
+  "boyangeli",
+  "bísó",
+  "bôngó",
+  "cas",
+  "contraception",
+  "des",
+  "dzomi",
+  "ebale",
+  "ebandeli",
+  "ebongisami",
+  "ekeseni",
+  "ekokaki",
+  "ekokí",
+  "ekoma",
+  "ekopesa",
+  "ekólo",
+  "elakisi",
+  "elobi",
+  "elongi",
+  "epesaki",
+  "esalami",
+  "esalemaki",
+  "etumba",
+  "ewumelaki",
+  "eyaki",
+  "eyano",
+  "ezuaka",
+  "farasa",
+  "gombe",
+  "groupe",
+  "i",
+  "ikɛ́",
+  "indépendant",
+  "inso",
+  "kobenga",
+  "kobunda",
+  "kokoba",
+  "kokokisa",
+  "kokolola",
+  "kokota",
+  "kokotisa",
+  "kokɛndɛ",
+  "kolala",
+  "kolendisa",
+  "kolinga",
+  "komanyola",
+  "komata",
+  "kompani",
+  "kopanza",
+  "kosakola",
+  "kosomba",
+  "koteya",
+  "koto",
+  "koyebisa",
+  "kozanga",
+  "kufaki",
+  "libela",
+  "linene",
+  "lisangá",
+  "lisapo",
+  "liwa",
+  "lizali",
+  "lokota",
+  "maboke",
+  "mai",
+  "makomi",
+  "makono",
+  "mbíla",
+  "million",
+  "mindondo",
+  "mitindo",
+  "mituka",
+  "monoko",
+  "mopepe",
+  "mosantu",
+  "mosolo",
+  "mpoya",
+  "mpɔ̂",
+  "mua",
+  "musala",
+  "mwâ",
+  "mángwɛlɛ́",
+  "natal",
+  "neti",
+  "ngala",
+  "nkásá",
+  "nzinga",
+  "okomona",
+  "okoyoka",
+  "okozala",
+  "omoni",
+  "osengeli",
+  "ozua",
+  "pembe",
+  "pete",
+  "pota",
+  "risk",
+  "sengeli",
+  "signe",
+  "soi",
+  "sud",
+  "tala",
+  "ti",
+  "tolo",
+  "tozali",
+  "tyfus",
+  "tɛ",
+  "uta",
+  "vague",
+  "wáná",
+  "zambi",
+  "ǒ",
+  "100",
+  "1819",
+  "1960",
+  "1998",
+  "2005",
+  "2007",
+  "22",
+  "26",
+  "27",
+  "50",
+  "6",
+  "8",
+  "9",
+  "Ali",
+  "Angle",
+  "Atlantique",
+  "Azalaki",
+  "Azali",
+  "Azalákí",
+  "BCK",
+  "BaFaraon",
+  "Banso",
+  "Bayuda",
+  "Beljika",
+  "Bikoro",
+  "Bileko",
+  "Bobele",
+  "Bobongo",
+  "Bokonzi",
+  "Bomoi",
+  "Bongo",
+  "Confréries",
+  "Djer",
+  "Djoser",
+  "Erópa",
+  "Europa",
+  "Ezala",
+  "Ezalaka",
+  "Joseph",
+  "Kati",
+  "Kester",
+  "Kokende",
+  "Kosólola",
+  "Kuruse",
+  "Lingisi",
+  "Luka",
+  "Lycée",
+  "M.",
+  "Mabongisi",
+  "Maloba",
+  "Marko",
+  "Matanga",
+  "Matié",
+  "Mediterane",
+  "Mgr",
+  "Mikolo",
+  "Minisele",
+  "Moko",
+  "Mokolo",
+  "Molímo",
+  "Mondiale",
+  "Monene",
+  "Mycobacterium",
+  "Nasalaki",
+  "Nazali",
+  "Nganga-Nzambe",
+  "Nkisi",
+  "Nkásá",
+  "Nákonzémba",
+  "Océan",
+  "Pierrette",
+  "Soeurs",
+  "Soko",
+  "Swisi",
+  "Sɔ́kí",
+  "Tozali",
+  "Web",
+  "abandaki",
+  "akozala",
+  "akòmaki",
+  "al.",
+  "alakisaki",
+  "aluki",
+  "ambulance",
+  "amemamaki",
+  "amipesi",
+  "amoni",
+  "asalaki",
+  "asengi",
+  "asiazui",
+  "atika",
+  "ayambaki",
+  "azala",
+  "azalaka",
+  "azaláká",
+  "baFaraon",
+  "babandi",
+  "babelaka",
+  "babeti",
+  "bafandi",
+  "baflama",
+  "bai",
+  "bakangi",
+  "bakei",
+  "bakelasi",
+  "bakende",
+  "bakobela",
+  "bakoma",
+  "bakozala",
+  "bakufi",
+  "bamboka",
+  "bamonaki",
+  "bandeke",
+  "bandá",
+  "bankisi",
+  "basalaka",
+  "basambisi",
+  "basani",
+  "basoda",
+  "batikali",
+  "batiya",
+  "batiyaka",
+  "bayaki",
+  "bayeba",
+  "bazalaka",
+  "bazwi",
+  "bilako",
+  "bilembo",
+  "bilɔ́kɔ",
+  "bipai",
+  "bisusu",
+  "bobele",
+  "boboti",
+  "bokolisi",
+  "bokulaka",
+  "bokutani",
+  "bomoko",
+  "bomoto",
+  "bopesi",
+  "bosalisi",
+  "buku",
+  "bwale",
+  "calendrier",
+  "cartonnée",
+  "chaque",
+  "compagnie",
+  "deja",
+  "doktolo",
+  "ebikaka",
+  "ekobanda",
+  "ekoti",
+  "ekufa",
+  "elakisaka",
+  "eleko",
+  "elenge",
+  "elikya",
+  "elingí",
+  "emataka",
+  "emeseni",
+  "emonanaka",
+  "emonani",
+  "enene",
+  "engebene",
+  "epesaka",
+  "epesami",
+  "esalamaka",
+  "esengaka",
+  "esi",
+  "esili",
+  "etando",
+  "eteni",
+  "etuka",
+  "eténi",
+  "exploitation",
+  "eyamba",
+  "eyebanaki",
+  "ferrées",
+  "ibandi",
+  "ka",
+  "kati-kati",
+  "katikati",
+  "kimia",
+  "kitoko",
+  "kobongola",
+  "kolia",
+  "komini",
+  "komitungisa",
+};
+const uint16_t WA_FREQ_90_RANKS[] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 88, 261, 465, 458, 658, 673, 998, 0,
+  0, 0, 341, 0, 0, 646, 0, 0, 428, 0, 0, 734, 0, 0, 599, 814,
+  861, 0, 52, 0, 0, 0, 0, 168, 875, 0, 702, 0, 0, 0, 894, 0,
+  277, 332, 0, 117, 0, 201, 97, 729, 555, 0, 0, 0, 0, 0, 0, 0,
+  0, 788, 0, 367, 0, 0, 866, 0, 188, 0, 400, 0, 101, 0, 0, 352,
+  0, 0, 0, 398, 123, 429, 448, 943, 413, 476, 716, 432, 9, 331, 340, 531,
+  714, 0, 0, 144, 0, 0, 0, 0, 162, 375, 316, 481, 941, 293, 0, 0,
+  0, 662, 0, 0, 111, 947, 0, 178, 0, 0, 0, 0, 893, 589, 576, 593,
+  0, 0, 220, 0, 137, 0, 0, 0, 876, 848, 10, 475, 699, 761, 0, 0,
+  0, 0, 748, 0, 0, 0, 0, 430, 473, 961, 0, 85, 0, 0, 0, 656,
+  0, 0, 0, 126, 0, 0, 386, 0, 0, 0, 0, 200, 282, 524, 0, 484,
+  594, 0, 0, 543, 76, 786, 0, 674, 0, 0, 569, 446, 770, 619, 0, 847,
+  0, 0, 73, 0, 0, 0, 0, 0, 0, 358, 208, 287, 57, 0, 558, 726,
+  0, 0, 0, 796, 0, 233, 0, 0, 0, 0, 548, 542, 608, 0, 330, 580,
+  0, 568, 0, 0, 0, 246, 930, 0, 176, 736, 0, 0, 0, 0, 0, 132,
+  133, 642, 0, 0, 0, 160, 0, 0, 969, 509, 643, 718, 0, 37, 663, 693,
+  0, 5, 738, 0, 0, 0, 0, 403, 0, 437, 338, 0, 118, 0, 0, 0,
+  312, 0, 0, 0, 0, 968, 0, 245, 914, 0, 0, 607, 526, 0, 255, 545,
+  0, 984, 45, 0, 0, 0, 610, 0, 0, 0, 283, 0, 0, 141, 436, 0,
+  0, 281, 43, 0, 0, 615, 0, 0, 880, 381, 450, 845, 108, 846, 715, 889,
+  0, 272, 782, 114, 179, 192, 767, 501, 577, 940, 347, 535, 180, 0, 0, 22,
+  0, 0, 829, 284, 0, 0, 0, 0, 0, 130, 0, 0, 0, 151, 536, 333,
+  934, 0, 783, 0, 0, 747, 515, 361, 595, 0, 0, 0, 0, 0, 769, 0,
+  0, 0, 0, 737, 0, 0, 173, 672, 588, 906, 870, 0, 653, 698, 435, 319,
+  0, 0, 0, 0, 0, 0, 886, 975, 0, 0, 0, 0, 0, 0, 842, 955,
+  0, 0, 317, 13, 705, 823, 0, 408, 540, 83, 0, 533, 720, 753, 922, 416,
+  972, 0, 265, 557, 0, 0, 102, 0, 0, 0, 0, 56, 380, 0, 0, 885,
+  0, 0, 196, 125, 350, 424, 0, 211, 51, 668, 0, 0, 550, 0, 0, 0,
+  478, 635, 477, 237, 835, 0, 0, 0, 0, 0, 0, 267, 521, 819, 323, 480,
+  899, 987, 916, 0, 0, 0, 0, 0, 224, 212, 452, 785, 150, 877, 892, 979,
+  155, 657, 556, 0, 0, 0, 0, 0, 32, 0, 0, 0, 0, 169, 136, 385,
+  349, 551, 680, 0, 0, 0, 77, 98, 194, 405, 949, 945, 0, 0, 0, 0,
+  106, 468, 879, 0, 0, 0, 0, 127, 0, 0, 932, 0, 0, 0, 171, 0,
+  0, 206, 0, 0, 187, 0, 0, 912, 0, 459, 903, 0, 0, 0, 0, 0,
+  204, 290, 0, 371, 0, 0, 0, 0, 0, 0, 0, 0, 0, 318, 0, 0,
+  0, 0, 0, 325, 661, 935, 953, 639, 0, 440, 0, 0, 0, 0, 0, 328,
+  0, 0, 982, 256, 217, 0, 0, 0, 0, 609, 0, 0, 0, 493, 713, 808,
+  0, 0, 302, 148, 348, 469, 0, 0, 198, 0, 0, 0, 0, 0, 0, 0,
+  0, 750, 800, 0, 695, 0, 957, 0, 454, 0, 0, 0, 0, 0, 0, 988,
+  950, 1000, 0, 863, 696, 0, 534, 0, 0, 0, 0, 0, 700, 0, 677, 0,
+  0, 411, 0, 0, 0, 0, 0, 549, 0, 490, 193, 0, 263, 659, 219, 0,
+  0, 0, 0, 0, 0, 455, 329, 692, 784, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 1, 50, 324, 470, 0, 0, 0, 0, 335, 370, 804, 0,
+  0, 0, 407, 799, 806, 61, 502, 744, 898, 105, 0, 0, 956, 0, 0, 0,
+  409, 685, 868, 859, 0, 303, 0, 0, 0, 0, 0, 63, 0, 0, 0, 23,
+  884, 907, 0, 983, 0, 0, 0, 0, 0, 0, 759, 0, 0, 0, 0, 79,
+  0, 0, 0, 387, 0, 0, 616, 582, 694, 0, 0, 0, 271, 190, 460, 631,
+  157, 394, 807, 963, 0, 0, 0, 0, 222, 0, 0, 0, 0, 561, 0, 0,
+  938, 0, 0, 418, 0, 0, 0, 0, 0, 0, 467, 139, 552, 638, 966, 0,
+  0, 0, 0, 0, 0, 911, 0, 0, 42, 243, 901, 0, 0, 0, 0, 0,
+  518, 18, 763, 883, 357, 0, 0, 0, 758, 974, 0, 603, 513, 110, 320, 483,
+  165, 776, 321, 778, 810, 0, 0, 353, 0, 798, 0, 254, 944, 918, 970, 0,
+  0, 0, 691, 0, 0, 0, 0, 0, 362, 633, 0, 0, 495, 627, 669, 689,
+  844, 908, 937, 0, 0, 0, 0, 0, 0, 0, 0, 135, 251, 354, 0, 382,
+  24, 131, 977, 765, 0, 0, 574, 0, 0, 0, 38, 0, 0, 242, 732, 0,
+  0, 121, 0, 297, 274, 181, 854, 0, 980, 0, 0, 0, 802, 0, 0, 0,
+  268, 0, 838, 0, 0, 0, 0, 0, 0, 0, 96, 0, 781, 0, 84, 0,
+  147, 225, 0, 0, 0, 344, 107, 625, 402, 0, 94, 247, 0, 913, 0, 46,
+  952, 0, 0, 0, 900, 0, 741, 711, 0, 0, 313, 368, 575, 0, 0, 751,
+  0, 278, 0, 0, 924, 0, 727, 0, 0, 115, 0, 0, 0, 0, 0, 946,
+  623, 423, 920, 0, 0, 630, 757, 0, 218, 0, 0, 0, 0, 0, 0, 0,
+  306, 0, 0, 122, 363, 232, 14, 269, 441, 990, 0, 0, 183, 681, 0, 0,
+  0, 203, 754, 0, 0, 25, 0, 167, 0, 0, 421, 0, 0, 498, 0, 606,
+  0, 0, 779, 586, 0, 717, 0, 0, 926, 0, 0, 0, 0, 69, 0, 0,
+  766, 0, 0, 671, 0, 0, 0, 728, 397, 731, 730, 596, 0, 585, 0, 0,
+  0, 0, 0, 567, 0, 0, 103, 553, 240, 391, 0, 0, 0, 0, 993, 0,
+  213, 0, 0, 959, 0, 146, 0, 837, 17, 0, 992, 166, 505, 288, 433, 0,
+  485, 294, 0, 186, 489, 613, 743, 927, 0, 0, 508, 0, 0, 0, 0, 0,
+  65, 0, 0, 0, 0, 0, 40, 0, 0, 0, 0, 384, 0, 388, 420, 636,
+  0, 0, 771, 140, 4, 134, 390, 479, 697, 976, 0, 0, 0, 0, 253, 264,
+  0, 0, 0, 0, 0, 444, 864, 605, 366, 887, 0, 0, 620, 647, 0, 0,
+  618, 928, 0, 0, 795, 129, 626, 0, 0, 0, 474, 0, 0, 527, 0, 0,
+  0, 0, 0, 0, 572, 215, 0, 0, 0, 0, 683, 0, 504, 0, 0, 0,
+  0, 29, 871, 410, 897, 0, 0, 0, 0, 882, 0, 34, 0, 0, 0, 0,
+  0, 214, 0, 0, 0, 0, 0, 426, 721, 0, 0, 0, 600, 0, 0, 0,
+  624, 768, 0, 0, 67, 0, 0, 510, 0, 824, 276, 343, 238, 0, 530, 0,
+  704, 0, 15, 270, 794, 226, 205, 865, 0, 0, 0, 0, 0, 872, 604, 679,
+  93, 128, 755, 797, 365, 48, 488, 462, 541, 724, 995, 0, 0, 66, 401, 0,
+  0, 0, 360, 676, 891, 0, 322, 0, 74, 565, 915, 393, 289, 434, 0, 0,
+  0, 0, 0, 0, 0, 579, 813, 0, 0, 0, 0, 0, 33, 688, 0, 0,
+  0, 591, 0, 0, 0, 827, 249, 722, 3, 0, 81, 0, 417, 0, 0, 999,
+  0, 0, 0, 0, 0, 311, 578, 0, 236, 0, 0, 0, 0, 0, 0, 492,
+  0, 0, 0, 0, 0, 0, 0, 0, 64, 0, 0, 0, 0, 0, 654, 826,
+  921, 0, 295, 849, 0, 0, 0, 602, 852, 95, 881, 0, 0, 890, 0, 0,
+  0, 0, 486, 703, 228, 929, 80, 0, 0, 392, 336, 675, 445, 780, 537, 597,
+  91, 670, 0, 0, 0, 0, 0, 280, 0, 985, 0, 506, 519, 740, 651, 425,
+  965, 0, 156, 197, 0, 0, 231, 310, 973, 0, 0, 0, 0, 431, 612, 684,
+  841, 873, 925, 958, 0, 830, 0, 0, 241, 622, 112, 0, 0, 116, 0, 0,
+  53, 0, 733, 0, 0, 0, 0, 0, 0, 396, 0, 560, 0, 0, 971, 482,
+  494, 652, 660, 92, 0, 7, 0, 0, 917, 960, 503, 86, 855, 221, 0, 189,
+  62, 0, 0, 831, 273, 0, 0, 0, 817, 719, 629, 964, 0, 305, 789, 0,
+  0, 0, 0, 825, 0, 0, 0, 793, 0, 0, 762, 0, 0, 275, 0, 0,
+  0, 0, 120, 709, 0, 164, 0, 538, 0, 28, 583, 0, 0, 463, 359, 590,
+  0, 170, 0, 570, 0, 815, 0, 0, 0, 0, 752, 628, 0, 0, 0, 0,
+  0, 0, 0, 499, 44, 850, 981, 0, 0, 0, 640, 0, 6, 0, 0, 0,
+  374, 0, 438, 554, 0, 82, 100, 291, 544, 422, 592, 239, 286, 0, 0, 0,
+  0, 0, 260, 0, 0, 36, 566, 637, 978, 0, 0, 0, 0, 327, 539, 266,
+  587, 0, 584, 337, 0, 0, 0, 0, 234, 0, 0, 0, 0, 59, 16, 0,
+  745, 304, 710, 0, 760, 0, 0, 0, 0, 0, 682, 687, 0, 472, 0, 300,
+  307, 0, 923, 145, 511, 149, 878, 910, 0, 0, 0, 285, 0, 0, 0, 948,
+  0, 279, 0, 0, 0, 175, 0, 0, 0, 0, 0, 0, 99, 0, 0, 113,
+  832, 0, 0, 0, 528, 161, 31, 419, 858, 70, 666, 547, 649, 962, 143, 342,
+  772, 820, 0, 0, 427, 644, 0, 919, 0, 355, 0, 0, 0, 0, 0, 0,
+  389, 292, 0, 47, 0, 199, 252, 507, 0, 0, 0, 708, 774, 72, 0, 0,
+  299, 655, 933, 346, 0, 0, 453, 209, 0, 487, 559, 0, 989, 0, 0, 0,
+  8, 0, 182, 68, 142, 356, 466, 500, 581, 571, 617, 90, 742, 707, 746, 0,
+  0, 0, 0, 0, 0, 0, 809, 301, 645, 163, 0, 0, 378, 0, 55, 0,
+  0, 0, 517, 229, 0, 0, 0, 874, 936, 0, 373, 159, 75, 0, 58, 0,
+  0, 202, 516, 457, 0, 314, 442, 0, 0, 525, 0, 11, 0, 0, 0, 339,
+  0, 706, 0, 0, 0, 0, 185, 701, 191, 805, 0, 0, 942, 0, 27, 833,
+  951, 0, 598, 991, 404, 2, 124, 461, 522, 812, 828, 0, 0, 0, 0, 601,
+  0, 564, 21, 257, 869, 0, 0, 0, 0, 0, 0, 902, 0, 0, 0, 0,
+  0, 195, 207, 383, 443, 471, 491, 0, 0, 49, 0, 0, 0, 326, 856, 723,
+  20, 0, 0, 648, 19, 0, 0, 0, 152, 931, 0, 667, 0, 853, 0, 0,
+  89, 0, 138, 30, 109, 412, 862, 803, 909, 739, 0, 119, 41, 250, 764, 0,
+  790, 756, 822, 843, 0, 372, 0, 0, 821, 0, 0, 0, 0, 0, 0, 0,
+  0, 35, 839, 0, 0, 0, 997, 0, 0, 0, 309, 0, 395, 414, 449, 614,
+  851, 0, 0, 0, 0, 0, 0, 0, 369, 456, 415, 0, 177, 665, 996, 0,
+  0, 787, 0, 0, 0, 0, 0, 364, 0, 0, 0, 235, 896, 954, 0, 834,
+  0, 258, 836, 439, 811, 308, 377, 546, 562, 244, 71, 816, 0, 939, 0, 0,
+  0, 0, 0, 792, 573, 399, 775, 0, 967, 87, 262, 496, 0, 621, 12, 735,
+  818, 0, 0, 0, 0, 497, 0, 0, 104, 158, 801, 0, 230, 464, 0, 650,
+  0, 351, 773, 174, 0, 0, 223, 0, 345, 447, 54, 60, 315, 725, 860, 895,
+  0, 664, 0, 210, 563, 0, 0, 0, 0, 0, 0, 532, 0, 0, 78, 0,
+  0, 867, 0, 994, 611, 905, 514, 406, 184, 376, 451, 26, 248, 153, 154, 296,
+  379, 39, 334, 520, 227, 690, 777, 986, 0, 0, 0, 0, 678, 0, 0, 0,
+  0, 529, 712, 857, 172, 523, 641, 904, 0, 0, 298, 259, 634, 791, 0, 0,
+  216, 512, 0, 0, 0, 0, 0, 888, 632, 840, 0, 686, 749, 0, 0, 0,
+};
+
+const char *WA_FREQ_91_TOKENS[] = {
+  "ແລະ",
+  "ການ",
+  "ໃນ",
+  "ທີ່",
+  "ທ່ານ",
+  "ໄດ້",
+  "ມີ",
+  "ຂອງ",
+  "ເປັນ",
+  "ວັນທີ",
+  "ເວລາ",
+  "ໃຫ້",
+  "ລາວ",
+  "2011",
+  "ນີ້",
+  "ແມ່ນ",
+  "ມາ",
+  "2012",
+  "ທີ",
+  "ວ່າ",
+  "ວັນ",
+  "ດຣ",
+  "ກໍ",
+  "ເຂົ້າ",
+  "ຄວາມ",
+  "ບໍ່",
+  "ຈະ",
+  "ແຫ່ງ",
+  "ເບິ່ງ",
+  "ຮ່ວມ",
+  "ຢູ່",
+  "ໂດຍ",
+  "ປີ",
+  "ຜູ້",
+  "ຫຼື",
+  "ຄົນ",
+  "ໄປ",
+  "ຈາກ",
+  "ກັບ",
+  "ສປປ",
+  "ກັນ",
+  "ຄຳ",
+  "ກະ­ຊວງ",
+  "ຂຶ້ນ",
+  "ແຕ່",
+  "ເພື່ອ",
+  "ຊາດ",
+  "ງານ",
+  "ຄະ­ນະ",
+  "ຍັງ",
+  "ດ້ວຍ",
+  "ກອງ",
+  "ຮັບ",
+  "ຄັ້ງ",
+  "ນຳ",
+  "ພ້ອມ",
+  "ນັ້ນ",
+  "ວ່າ­ການ",
+  "ຈັນ",
+  "ບັນ­ດາ",
+  "ເຖິງ",
+  "ປະ­ເທດ",
+  "ວຽງ",
+  "ລັດ­ຖະ­ມົນ­ຕີ",
+  "ນະ­ຄອນ­ຫຼວງ",
+  "ຮອງ",
+  "ຈັດ",
+  "ປະ­ທານ",
+  "ທັງ",
+  "ທາງ",
+  "ຢ່າງ",
+  "ຕາມ",
+  "ແລ້ວ",
+  "ດັ່ງ­ກ່າວ",
+  "ປະ­ຊຸມ",
+  "ລັດ",
+  "ພັກ",
+  "ດີ",
+  "ວົງ",
+  "ຕໍ່",
+  "ເຮັດ",
+  "ເມືອງ",
+  "ສູນ",
+  "ຫຼາຍ",
+  "ບ້ານ",
+  "ຕ້ອງ",
+  "ຫົວ­ໜ້າ",
+  "ໄຊ",
+  "ຄື",
+  "ສະ",
+  "ສາ",
+  "ເຊັ່ນ",
+  "ແຂວງ",
+  "ເງິນ",
+  "ຜ່ານ",
+  "ເຈົ້າ",
+  "ຕ່າງ­ປະ­ເທດ",
+  "ກ່ຽວ­ຂ້ອງ",
+  "ເຮົາ",
+  "ປະ­ຊາ­ຊົນ",
+  "ໃຊ້",
+  "ອັນ",
+  "ອອກ",
+  "ປະ­ຈຳ",
+  "ເຫັນ",
+  "ພິ­ທີ",
+  "ຈີນ",
+  "ທຳ",
+  "ອີກ",
+  "ສີ",
+  "ຕົວ",
+  "ສອງ",
+  "ນາງ",
+  "1",
+  "2",
+  "ເອົາ",
+  "ປະ",
+  "ຕັ້ງ",
+  "ກາງ",
+  "ໃຫຍ່",
+  "ສູງ",
+  "ເວ­ລາ",
+  "ວຽກ",
+  "ສະ­ພາ",
+  "ລົງ",
+  "ທອງ",
+  "ຊ່ວຍ",
+  "ວິນາທີ",
+  "3",
+  "ສ້າງ",
+  "ເວລາໃນການປະມວນຜົນໜ້າເວັບ",
+  "ອາ",
+  "ໂອ­ກາດ",
+  "ອົງ­ການ",
+  "ພັດທະນາໂດຍ",
+  "iTeen",
+  "ອອກແບບ",
+  "ໜຶ່ງ",
+  "ສ່ວນ",
+  "ສຶກ",
+  "ພັດ­ທະ­ນາ",
+  "ພັນ",
+  "ພາກ­ສ່ວນ",
+  "ສົມ",
+  "ຜົນ",
+  "ບຸນ",
+  "ມັນ",
+  "ມິຖຸນາ",
+  "ຈຳ­ນວນ",
+  "ປະ­ຕິ­ບັດ",
+  "ມະ",
+  "ຫາ",
+  "ເຊິ່ງ",
+  "ໂຄງ­ການ",
+  "ລະ",
+  "ດ້ານ",
+  "ສະ­ຫາຍ",
+  "ມື",
+  "ດຽວ",
+  "ພວກ",
+  "ບໍ­ລິ­ສັດ",
+  "ພະຈິກ",
+  "ກີບ",
+  "ເລື່ອງ",
+  "ກົມ",
+  "ສາ­ທາ­ລະ­ນະ",
+  "ພະ",
+  "ທັນວາ",
+  "ລະ­ຫວ່າງ",
+  "ຂ່າວ",
+  "ຖືກ",
+  "ຕ່າງໆ",
+  "ແທນ",
+  "ພົບ",
+  "ສຳ­ລັບ",
+  "ຊຶ່ງ",
+  "ທຸກ",
+  "ເພາະ",
+  "ນ້ຳ",
+  "ກ່າວ",
+  "ພະ­ນັກ­ງານ",
+  "ໜ້າ",
+  "ນາ­ຍົກ­ລັດ­ຖະ­ມົນ­ຕີ",
+  "ສ",
+  "ຮູ້",
+  "ຫລື",
+  "ຂໍ",
+  "ຕອນ",
+  "ສຸດ",
+  "ແກ່",
+  "ເລືອກ",
+  "ຄອງ",
+  "ສຸກ",
+  "ແບບ",
+  "ຝ່າຍ",
+  "ມອບ",
+  "ລາຍ",
+  "ເດືອນ",
+  "ທິ",
+  "ລ້ານ",
+  "ມູນ",
+  "ລັດ­ຖະ­ບານ",
+  "ສຈ",
+  "ໃໝ່",
+  "ກັນຍາ",
+  "ຍະ",
+  "ເກີດ",
+  "4",
+  "ນາ",
+  "ເຂດ",
+  "ສິງຫາ",
+  "ເມື່ອ",
+  "ສປ",
+  "ຕຸລາ",
+  "ຄວນ",
+  "ໜ້າ­ທີ່",
+  "ລົດ",
+  "ກຽດ",
+  "ນັກ",
+  "ເພີ່ມ",
+  "ຕົນ",
+  "10",
+  "ກິດ",
+  "ຂໍ້",
+  "ທູດ",
+  "ບາງ",
+  "ຂັ້ນ",
+  "ຄ່າ",
+  "ສາ­ມາດ",
+  "ສົ່ງ",
+  "5",
+  "ການ­ຈັດ­ຕັ້ງ",
+  "ພຶດສະພາ",
+  "ກີ­ລາ",
+  "ຄ້າ",
+  "ພະ­ນະ",
+  "ກໍລະກົດ",
+  "ຖະ",
+  "ໂລກ",
+  "ມັງກອນ",
+  "15",
+  "ເສຍ",
+  "ຈຶ່ງ",
+  "ລາ",
+  "ລີ",
+  "ເວົ້າ",
+  "ແຂ່ງ­ຂັນ",
+  "ໄຂ",
+  "ຄິດ",
+  "ຢ້ຽມ­ຢາມ",
+  "ສຸ",
+  "ເອກ",
+  "ກຳ­ມະ­ການ",
+  "ຫ້ອງ",
+  "າ",
+  "6",
+  "ກ່ຽວ",
+  "ຊົນ",
+  "ສະ­ເພາະ",
+  "ສາ­ກົນ",
+  "ປະ­ກອບ",
+  "ກຸມພາ",
+  "ທະ­ນາ­ຄານ",
+  "ຊ່ວຍ­ເຫຼືອ",
+  "14",
+  "ທົ່ວ",
+  "ບັນ­ຫາ",
+  "ແກ້",
+  "16",
+  "ຕື່ມ",
+  "30",
+  "ດຳ­ເນີນ",
+  "ແສງ",
+  "ໝົດ",
+  "ຖ້າ",
+  "ໝາຍ",
+  "ນະ",
+  "ພາຍ",
+  "ລົງ­ທຶນ",
+  "ສັງ­ຄົມ",
+  "ຫວຽດ­ນາມ",
+  "ແຈ້ງ",
+  "ສຳ­ຄັນ",
+  "ບັນ",
+  "ໂມງ",
+  "ຖື",
+  "ແນວ",
+  "ສອນ",
+  "ໃຈ",
+  "ໃດ",
+  "7",
+  "ພາກ",
+  "11",
+  "9",
+  "ກົດ­ໝາຍ",
+  "21",
+  "ກ່ອນ",
+  "ລວມ",
+  "ສະ­ແດງ",
+  "ເຊີນ",
+  "ເປີດ",
+  "ກາ",
+  "ກຸ່ມ",
+  "ຊີ",
+  "ຕ້ອນ­ຮັບ",
+  "ເອງ",
+  "ໄລ­ຍະ",
+  "ແຮງ",
+  "ພາບ",
+  "ຢາກ",
+  "ອື່ນໆ",
+  "25",
+  "ກິນ",
+  "ທຶນ",
+  "ຄະ",
+  "ຊີ­ວິດ",
+  "ບົດ",
+  "ຢາ",
+  "13",
+  "ກໍ່­ສ້າງ",
+  "ກວ່າ",
+  "ຕິດ",
+  "ຜູ້­ຕາງ­ໜ້າ",
+  "ສາຍ",
+  "ເຊ",
+  "ໄທ",
+  "12",
+  "ຜະ­ລິດ",
+  "ໃສ່",
+  "ສິ່ງ",
+  "18",
+  "20",
+  "ກວດ­ກາ",
+  "ຖາ",
+  "ອັກ",
+  "ໂຕ",
+  "ເມສາ",
+  "27",
+  "ກ່ວ",
+  "ພົວ­ພັນ",
+  "23",
+  "ຄູ່",
+  "ຕະ",
+  "17",
+  "28",
+  "ຂ້າງ",
+  "ນັບ",
+  "ແມັດ",
+  "22",
+  "ນາມ",
+  "ຄັ້ງທີ",
+  "ທຸ­ລະ",
+  "ຜົນ­ສຳ­ເລັດ",
+  "ຢ້ຽມ",
+  "ວິ",
+  "ສຳ­ເລັດ",
+  "ຊາວ",
+  "ມີນາ",
+  "ສານ",
+  "ເທດ",
+  "ແກ້ວ",
+  "ໂດ",
+  "ກຳ",
+  "ຕອບ",
+  "ສືບ­ຕໍ່",
+  "ໄວ້",
+  "ຕີ",
+  "ທ້າຍ",
+  "ເຂົາ",
+  "ຈິງ",
+  "ຈົ່ງ",
+  "ຍິງ",
+  "ຕາງ­ໜ້າ",
+  "ບໍ­ລິ­ຫານ",
+  "ປົກ­ຄອງ",
+  "26",
+  "ຂຽນ",
+  "ຊຽນ",
+  "ຕາ",
+  "ເງິນ­ຕາ",
+  "8",
+  "ຫ້ອງ­ການ",
+  "ອາ­ຫານ",
+  "ເພິ່ນ",
+  "ແຜນ­ການ",
+  "ແມ່",
+  "ໄພ",
+  "ຄອບ­ຄົວ",
+  "ວັດ",
+  "ເນື່ອງ",
+  "ເພື່ອນ",
+  "ຂະ",
+  "ທ່ຽວ",
+  "ລົມ",
+  "ແນກ",
+  "2.",
+  "ມື້",
+  "ລຳ",
+  "ລູກ",
+  "ໂຮງ­ຮຽນ",
+  "ປ້ອງ",
+  "ສັກ",
+  "ສິນ",
+  "ຫຼັກ",
+  "ຈຸດ",
+  "ຊາຍ",
+  "ອາດ",
+  "ເປັນ­ຕົ້ນ",
+  "ໃຫ້­ການ",
+  "3.",
+  "ຄຸ້ມ",
+  "ລະ­ດັບ",
+  "ອົງ",
+  "ຮັກ",
+  "4.",
+  "ດາ",
+  "ຕະ­ຫຼາດ",
+  "ທະ",
+  "ບໍ­ລິ­ການ",
+  "ມະ­ຫາ­ວິ­ທະ­ຍາ­ໄລ",
+  "ວັດ­ທະ­ນະ­ທຳ",
+  "ສິນ­ຄ້າ",
+  "ຫາກ",
+  "ເສດ­ຖະ­ກິດ",
+  "ລິ",
+  "ລຸນ",
+  "ສຳ­ນັກ­ງານ",
+  "ອິນ",
+  "ພອນ",
+  "ເຮືອນ",
+  "ທ່ອງ",
+  "ຮຽນ",
+  "ຂ່ຳ­ນັບ",
+  "ຄົງ",
+  "ລະ­ບຽບ",
+  "ສຽງ",
+  "ຄັນ",
+  "ວິ­ຊາ",
+  "ເຊັນ",
+  "ແຂກ",
+  "24",
+  "ທີມ",
+  "ບ່ອນ",
+  "ປາ",
+  "ລິດ",
+  "ຫຼຽນ",
+  "ເດີນ­ທາງ",
+  "ແຜນ",
+  "ໃບ",
+  "ສະ­ເໜີ",
+  "ສິດ",
+  "ສູ່",
+  "ຮອດ",
+  "ເຊຍ",
+  "ເລ­ຂາ­ທິ­ການ",
+  "ແລກ­ປ່ຽນ",
+  "ພໍ່",
+  "ຣາ",
+  "ລາ­ຄາ",
+  "ສະ­ພາບ",
+  "ສະ­ມາ­ຄົມ",
+  "ເທື່ອ",
+  "ເລກ",
+  "ຂະ­ຫຍາຍ",
+  "ຊື້",
+  "ຟັງ",
+  "ວາງ",
+  "ຫຼວງ",
+  "ອວຍ­ພອນ",
+  "ເອີ",
+  "ໜ່ວຍ",
+  "06",
+  "ເລີ່ມ",
+  "ຄຸນ",
+  "ຊັ້ນ",
+  "ຍ້ອນ",
+  "ຕົ້ນ",
+  "ປະ­ສົບ",
+  "ອິດ",
+  "ເທົ່າ",
+  "ໂຄ­ສະ­ນາ",
+  "ໃຕ້",
+  "19",
+  "29",
+  "ຍາກ",
+  "ມິດ­ຕະ­ພາບ",
+  "ລາດ",
+  "ຫລາຍ",
+  "ຊາ",
+  "ດິນ",
+  "ນອກ­ຈາກ",
+  "ອີ",
+  "ເຕີ",
+  "ໃນປີ",
+  "ເຄື່ອງ",
+  "ເຊົ້າ",
+  "ກຸມ­ພາ",
+  "ປະ­ມານ",
+  "ປັດ­ຈຸ­ບັນ",
+  "ສະ­ມາ­ຊິກ",
+  "ຫຼັງ",
+  "ອື່ນ",
+  "09",
+  "ຈິດ",
+  "ຊະ­ນະ",
+  "ດວງ",
+  "ຖະ­ແຫຼງ",
+  "ພະ­ຍາດ",
+  "ເຄີຍ",
+  "ເມ­ສາ",
+  "ກະລຸນາໃຫ້ຄໍາຄິດຄໍາເຫັນໃນທາງສ້າງສັນ",
+  "ດັບ",
+  "ທັນ",
+  "ທັນ­ວາ",
+  "ບວນ",
+  "ປອນ",
+  "ສິງ­ຫາ",
+  "ເລີຍ",
+  "ເສັ້ນ­ທາງ",
+  "ກັນ­ຍາ",
+  "ຄ.ສ.",
+  "ຈອດ",
+  "ຈູມ",
+  "ຈົນ",
+  "ພຽງ",
+  "ສະ­ບັບ",
+  "ອຳ­ນາດ",
+  "1.",
+  "ການ­ເມືອງ",
+  "ຂາຍ",
+  "ຊຸດ",
+  "ດັ່ງ­ນີ້",
+  "ດາ­ລາ",
+  "ຖາມ",
+  "ຢູ",
+  "ສິງ",
+  "ຮູບ",
+  "ໂດຍທົ່ວໄປ",
+  "04",
+  "ກຳ­ລັງ",
+  "ບູ",
+  "ປະ­ກອບ­ສ່ວນ",
+  "ມວນ",
+  "ສ.ສ",
+  "ສະ­ນັ້ນ",
+  "ສະ­ຫວັນ",
+  "ສຸ­ຂະ­ພາບ",
+  "ຫວຽດນາມ",
+  "ຮ້ານ",
+  "ໂລ",
+  "ໄວ",
+  "5.",
+  "ຄືນ",
+  "ດອກ",
+  "ທໍ່",
+  "ບັດ",
+  "ປກສ",
+  "ປະມານ",
+  "ພື້ນ",
+  "ມະ­ນີ",
+  "ມາ­ລີ",
+  "ມິ­ຖຸ­ນາ",
+  "ສັນ­ຍາ",
+  "ສື່",
+  "ຫົວ",
+  "ເຊື່ອ",
+  "01",
+  "ນ້ອຍ",
+  "ບອກ",
+  "ອ່ານ",
+  "ໂອ",
+  "07",
+  "ກວດ",
+  "ຍົກ",
+  "ພິມ",
+  "ມີ­ນາ",
+  "ຮອບ",
+  "ໄຟ",
+  "ຄົ້ນ",
+  "ຄໍ",
+  "ຊີ້",
+  "ຍີ່­ປຸ່ນ",
+  "ສະ­ໜາມ",
+  "50",
+  "ຄະ­ດີ",
+  "ປະ­ເພດ",
+  "ປະເທດລາວ",
+  "ປັບ­ປຸງ",
+  "ປຶກ­ສາ",
+  "ມາດ",
+  "ຣົບ",
+  "ສະ­ຫງົບ",
+  "ເກົ່າ",
+  "ເຂົ້າ­ໃຈ",
+  "ໂຮງ­ໝໍ",
+  "ໄມ້",
+  "ກຳ­ນົດ",
+  "ຍອດ",
+  "ທິດ",
+  "ບາ",
+  "ພາຍ­ຫຼັງ",
+  "ໂນ",
+  "ຊົມ­ເຊີຍ",
+  "ນອກ",
+  "ຜູ້­ອຳ­ນວຍ­ການ",
+  "ອ້ອມ",
+  "ຮັກ­ສາ",
+  "ເຂັ້ມ­ແຂງ",
+  "ເທິງ",
+  "ນີ",
+  "ມາດ­ຕາ",
+  "ອຸດ­ສາ­ຫະ­ກຳ",
+  "ຮັບ­ຜິດ­ຊອບ",
+  "ເອ",
+  "ໂຣ",
+  "ໂຮງ­ແຮມ",
+  "ໜຸ່ມ",
+  "08",
+  "31",
+  "ຄັດ",
+  "ຄາດ",
+  "ຕະ­ຫຼອດ",
+  "ພາ­ສາ",
+  "ສຳ",
+  "ເປົ້າ",
+  "02",
+  "05",
+  "ຍິ່ງ",
+  "ຕື້",
+  "ຕົກ",
+  "ພື້ນ­ຖານ",
+  "ມັກ",
+  "ລັດຖະມົນຕີວ່າການ",
+  "ສະ­ໜອງ",
+  "ສົ່ງ­ເສີມ",
+  "ແດງ",
+  "ນະ­ຄອນ",
+  "ບ່າຍ",
+  "ພາສາອັງກິດ",
+  "ມອບ-ຮັບ",
+  "ຫຍັງ",
+  "ໂກ",
+  "ໃນວັນທີ",
+  "ກິດ­ຈະ­ກຳ",
+  "ຂ້ອຍ",
+  "ຈະ­ເລີນ",
+  "ຈຳ­ກັດ",
+  "ຈ່າຍ",
+  "ທ່າ",
+  "ນະຄອນຫຼວງວຽງຈັນ",
+  "ພຶດ­ສະ­ພາ",
+  "ພົນ",
+  "ລາວ.",
+  "ສາມ",
+  "ເຊື້ອ",
+  "ເນ",
+  "ເນື້ອ",
+  "ກໍ­ລະ­ກົດ",
+  "ງາມ",
+  "ຊອກ",
+  "ຊຸກ­ຍູ້",
+  "ຕ້ານ",
+  "ປອດ",
+  "ປະ­ຊາ­ທິ­ປະ­ໄຕ",
+  "ເອົາ­ໃຈ­ໃສ່",
+  "ຄຽງ",
+  "ຈັກ",
+  "ຊະ",
+  "ຍາມ",
+  "ທິມ",
+  "ນັດ",
+  "ປະເທດ",
+  "ພົມ­ວິ­ຫານ",
+  "ລະ­ບົບ",
+  "ວິ­ທະ­ຍາ­ສາດ",
+  "ສະ­ໄໝ",
+  "ເກີນ",
+  "ເດັກ",
+  "ເລ",
+  "ເໝາະ",
+  "2010",
+  "ກຳ­ປູ­ເຈຍ",
+  "ກູ້",
+  "ກໍ່",
+  "ຂອບ",
+  "ຂ້າ­ພະ­ເຈົ້າ",
+  "ຈັນ­ທະ",
+  "ຊົມ",
+  "ຍາດ",
+  "ດາວ",
+  "ປະ­ກົດ",
+  "ສາດ",
+  "ອຸ່ນ",
+  "ເຢຍ",
+  "ກະ­ສິ­ກຳ-ປ່າ­ໄມ້",
+  "ກິໂລແມັດ",
+  "ຄຳວ່າ",
+  "ຈຳນວນ",
+  "ຊື່",
+  "ຍາວ",
+  "ດັ່ງ­ນັ້ນ",
+  "ຖ້ວມ",
+  "ບໍ",
+  "ພຣະ",
+  "ສອບ",
+  "ສະ­ໝັກ",
+  "ຫາ­ລື",
+  "ອົບ­ຮົມ",
+  "ໄຫວ",
+  "ຍຸ­ຕິ",
+  "ນານ",
+  "ບັນ­ທຶກ",
+  "ປະຊາຊົນ",
+  "ຝຣັ່ງ",
+  "ພະ­ຈິກ",
+  "ພາ",
+  "ວິ­ພາ",
+  "ອະ­ນຸ­ຍາດ",
+  "ຮັບ­ຮອງ",
+  "ເຕັມ",
+  "ແມ່­ຍິງ",
+  "ຂະ­ນະ",
+  "ຕຸ­ລາ",
+  "ຕ້ອງ­ການ",
+  "ທະ­ວີ",
+  "ທ້າວ",
+  "ປູກ",
+  "ພໍ",
+  "ສສຊ",
+  "ຫາຍ",
+  "ອາ­ເມ­ລິ­ກາ",
+  "ເຈົ້າ­ພາບ",
+  "ເຈົ້າ­ເມືອງ",
+  "ໃກ້",
+  "100",
+  "ກາຍ",
+  "ຂົນ­ສົ່ງ",
+  "ຊາບ",
+  "ຕິ",
+  "ຕົກ­ລົງ",
+  "ຕ່າງ",
+  "ປະ­ໂຫຍດ",
+  "ສະນັ້ນ",
+  "ຫະ",
+  "ອາ­ຍຸ",
+  "ອຳ­ນວຍ",
+  "ອົກ",
+  "ອົດ",
+  "ເມ",
+  "ແດ່",
+  "ກາຍ­ເປັນ",
+  "ຂັບ",
+  "ທາດ­ຫຼວງ",
+  "ນັກ­ກີ­ລາ",
+  "ບໍ­ດີ",
+  "ປະ­ກາດ",
+  "ລະຫວ່າງ",
+  "ລາ­ງວັນ",
+  "ສົມ­ບູນ",
+  "ຫວັດ",
+  "ຫ້າມ",
+  "ຫໍ",
+  "ເກດ",
+  "ເລີດ",
+  "ໂທ",
+  "ກະ­ກຽມ",
+  "ກົງ",
+  "ຂະ­ແໜງ­ການ",
+  "ຄ້ວ",
+  "ຊຽງ",
+  "ຕິດ­ຕາມ",
+  "ຕູ້",
+  "ນອນ",
+  "ນັກ­ຮຽນ",
+  "ນ້ອງ",
+  "ປະ­ດັບ",
+  "ພັກ-ລັດ",
+  "ລະ­ເມີດ",
+  "ລັດຖະບານ",
+  "ວິ­ທີ",
+  "ສະ­ຖານ­ທີ່",
+  "ຮ້າຍ",
+  "ເກັບ",
+  "ເກົາ­ຫຼີ",
+  "ແບ່ງ",
+  "ໂຕນ",
+  "ການພິມ",
+  "ຄູ",
+  "ຈຸ",
+  "ທອງລຸນ",
+  "ທຸກໆ",
+  "ທ້ອງ­ຖິ່ນ",
+  "ບຸກ",
+  "ຜົນ­ງານ",
+  "ພິ­ຈາ­ລະ­ນາ",
+  "ພິ­ເສດ",
+  "ສະ­ດວກ",
+  "ສະ­ຫະ­ລັດ",
+  "ສະ­ໂມ­ສອນ",
+  "ສິນຄ້າ",
+  "ເສບ",
+  "ເສີມ",
+  "ແພງ",
+  "ແພດ",
+  "ໃຜ",
+  "ໄກ",
+  "ໄຟ­ຟ້າ",
+  "ໜ້ອຍ",
+  "VII",
+  "ກິ",
+  "ຂາດ",
+  "ດັ່ງກ່າວ",
+  "ນັກ­ທຸ­ລະ­ກິດ",
+  "ນິ­ຍົມ",
+  "ປະ­ຊາ",
+  "ປະ­ຕິ­ວັດ",
+  "ປັກ",
+  "ຜິດ",
+  "ພິ",
+  "ມຽນ",
+  "ສວນ",
+  "ສະ­ຫະ­ພັນ",
+  "ສະ­ເຫຼີມ­ສະ­ຫຼອງ",
+  "ສິ­ລະ",
+  "ສີສຸລິດ",
+  "ສົມມະນາ",
+  "ຫວັງ",
+  "ອະ­ທິ­ການ",
+  "ອາ­ທິດ",
+  "ຮຽກ­ຮ້ອງ",
+  "ເຄື່ອນ",
+  "ເຕະ",
+  "ເປັນຕົ້ນ",
+  "ເພງ",
+  "6.",
+  "ກາ­ແດງ",
+  "ກຳ­ມາ",
+  "ຂວາງ",
+  "ຄ.ສ",
+  "ຊູ",
+  "ດອນ",
+  "ບຸກ­ຄົນ",
+  "ປະ­ສານ",
+  "ພູ",
+  "ມັງ­ກອນ",
+  "ມາດຣິດ",
+  "ສັກ­ຂີ",
+  "ເອ­ກະ­ສານ",
+  "ແນວ­ໃດ",
+  "ແໜ້ນ",
+  "ໄມ",
+  "ການ­ເຄື່ອນ­ໄຫວ",
+  "ກູ",
+  "ບົວ",
+  "ປ້າຍ",
+  "ພວມ",
+  "ລາວ-ຫວຽດນາມ",
+  "ສະ­ຫະ",
+  "ສະ­ໜັບ­ສະ­ໜູນ",
+  "ອັດ",
+  "ອາ­ຊີ",
+  "ເຂື່ອນໄຟຟ້າຂະໜາດນ້ອຍແຫ່ງໜຶ່ງ",
+  "ເສດຖະກິດ",
+  "ແລະອື່ນໆ",
+  "03",
+  "2008",
+  "7.",
+  "ກວມ",
+  "ຂັນ",
+  "ຊິ",
+  "ຊ້າງ",
+  "ດັ່ງ",
+  "ນອກຈາກ",
+  "ນະ­ໂຍ­ບາຍ",
+  "ບົດ­ຮຽນ",
+  "ປະຈຸບັນ",
+  "ພັດ",
+  "ພິ­ຍານ",
+  "ສະ­ຫຼຸບ",
+  "ສາທາລະນະລັດ",
+  "ເງື່ອນ­ໄຂ",
+  "ເຕືອນ",
+  "ເບື້ອງ",
+  "ເຜີຍ­ແຜ່",
+  "ເລ­ຂາ",
+  "ແດນ",
+  "ກະຊວງການຕ່າງປະເທດ",
+  "ຄູ-ອາ­ຈານ",
+  "ຈຳ­ເປັນ",
+  "ຍິນ",
+  "ຖະ­ໜົນ",
+  "ບັນ­ລຸ",
+  "ປະຈຳ",
+  "ປາກ",
+  "ຜູ້­ນຳ",
+  "ລະ­ອຽດ",
+  "ສະ­ຖານ­ທູດ",
+  "ສະ­ໝອງ",
+  "ສາ­ເຫດ",
+  "ສົນ­ໃຈ",
+  "ສົມ­ຄວນ",
+  "ສ້າງ­ຕັ້ງ",
+  "ຫຼຸດ",
+  "ອະ",
+  "ອົບ",
+  "ເຈົ້າ­ແຂວງ",
+  "ເພັດ",
+  "ແນະ­ນຳ",
+  "ແມນ",
+  "ໄນ",
+  "ກະ­ທຳ",
+  "ກົດ",
+  "ຂອບ­ໃຈ",
+  "ຄວາມ­ທຸກ",
+  "ຄົບ­ຮອບ",
+  "ຄ່ອຍ",
+  "ຊຸມ",
+  "ດົນ",
+  "ຖານ",
+  "ປາວ",
+  "ຣິວ",
+  "ລ້ານກີບ",
+  "ສ່ອງ",
+  "ຫລຸດ",
+  "ອາ­ຊີບ",
+  "ອາ­ນາ­ຈັກ",
+  "ຮ້ອຍ",
+  "ເຮືອ",
+  "ໄອ",
+  "ໜັກ",
+  "ໝັ້ນ",
+  "ກອນ",
+  "ຄາ",
+  "ງົບ­ປະ­ມານ",
+  "ຈັດ­ການ",
+  "ຈຳ­ປາ",
+  "ດັ່ງນັ້ນ",
+  "ຕຣາ",
+  "ບານ­ເຕະ",
+  "ປິນ",
+  "ປົກ",
+  "ຜາ",
+  "ພະ­ແນກ­ການ",
+  "ມະ­ນຸດ",
+  "ສ.ເກົາ­ຫຼີ",
+  "ຫັນ",
+  "ຮສຈ",
+  "ຮອງນາຍົກລັດຖະມົນຕີ",
+  "ເລັ່ງ",
+  "ເສດຖະສາດ",
+  "ເອີ້ນວ່າ",
+  "ເໜືອ",
+  "ໝາຍເຖິງ",
+  "8.",
+  "IX",
+  "ກໍ­ລະ­ນີ",
+  "ຂະ­ຫຍາຍ­ຕົວ",
+  "ຈຸດ­ປະ­ສົງ",
+  "ຍາ",
+  "ຍົງ",
+  "ຍ້ອງ­ຍໍ",
+  "ບິນ",
+  "ປິ່ນ­ປົວ",
+  "ມ",
+  "ມະ­ຕິ",
+  "ມ່ວນ",
+  "ລີກ",
+  "ລ້ຽງ",
+  "ວັດທະນະທຳ",
+  "ສະຫາຍ",
+  "ສັນ",
+  "ສັ່ງ",
+  "ເຕ",
+  "ເລືອດ",
+  "ເອ­ກະ",
+  "ແຕກ",
+  "ແຕ່ງ",
+  "ໂຍ­ທາ",
+  "61",
+  "ກະ­ທົບ",
+  "ກິ່ງ",
+  "ກຽມ",
+  "ກ້າວ",
+  "ຈັບ",
+  "ຊະ­ນິດ",
+  "ດຳ­ລົງ",
+  "ທະ­ລຸ",
+  "ທາ",
+  "ທ່ານຮອງນາຍົກລັດຖະມົນຕີ",
+  "ນິດ",
+  "ບາດ",
+  "ບົດ­ບາດ",
+  "ປະຊາທິປະໄຕ",
+  "ປຶ້ມ",
+  "ພະ­ລັງ­ງານ",
+  "ມິດ",
+  "ຢູໄນເຕັດ",
+  "ລາຄາ",
+  "ສັງ",
+  "ສິດ­ທິ",
+};
+const uint16_t WA_FREQ_91_RANKS[] = {
+  992, 562, 0, 895, 0, 0, 960, 0, 0, 664, 0, 519, 0, 0, 0, 158,
+  0, 0, 0, 0, 0, 469, 494, 996, 829, 0, 473, 0, 990, 118, 735, 73,
+  0, 0, 0, 0, 785, 751, 0, 0, 373, 0, 233, 742, 225, 0, 792, 0,
+  0, 0, 0, 559, 0, 87, 346, 261, 419, 478, 0, 0, 0, 0, 0, 0,
+  0, 0, 779, 0, 0, 0, 625, 0, 0, 0, 0, 77, 932, 305, 0, 0,
+  724, 925, 0, 948, 0, 300, 6, 915, 0, 0, 394, 0, 0, 291, 0, 0,
+  839, 61, 416, 0, 0, 0, 0, 0, 977, 505, 0, 144, 0, 0, 655, 0,
+  0, 0, 556, 549, 747, 42, 851, 216, 0, 0, 668, 244, 0, 0, 0, 0,
+  0, 0, 25, 0, 90, 490, 0, 0, 913, 0, 0, 504, 529, 0, 0, 308,
+  445, 0, 0, 0, 83, 0, 0, 0, 0, 957, 0, 0, 0, 697, 76, 876,
+  650, 0, 113, 0, 0, 0, 0, 277, 506, 138, 522, 686, 0, 54, 437, 0,
+  956, 0, 0, 0, 0, 0, 0, 0, 146, 169, 0, 488, 701, 16, 259, 597,
+  681, 0, 0, 238, 0, 945, 0, 0, 676, 814, 889, 509, 897, 766, 0, 0,
+  0, 0, 112, 410, 858, 599, 199, 825, 0, 442, 0, 435, 0, 0, 0, 0,
+  0, 236, 18, 708, 0, 0, 0, 869, 133, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 798, 0, 569, 0, 57, 78, 318, 0, 689, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 793, 565, 387, 0, 0, 205, 334, 389, 0, 0,
+  0, 0, 0, 0, 0, 582, 0, 8, 886, 0, 0, 0, 0, 0, 21, 0,
+  283, 210, 286, 0, 1000, 812, 0, 805, 0, 62, 0, 32, 22, 838, 938, 0,
+  0, 0, 0, 0, 0, 100, 0, 817, 52, 9, 0, 0, 252, 0, 0, 221,
+  0, 0, 143, 618, 344, 486, 720, 0, 357, 0, 0, 105, 289, 0, 0, 0,
+  813, 81, 258, 201, 401, 514, 706, 771, 859, 0, 878, 0, 0, 0, 354, 123,
+  888, 973, 500, 0, 0, 0, 0, 0, 0, 628, 840, 554, 936, 0, 0, 0,
+  0, 651, 49, 200, 0, 732, 0, 172, 511, 0, 326, 763, 934, 0, 307, 0,
+  0, 41, 450, 96, 0, 0, 0, 976, 861, 595, 245, 0, 388, 0, 0, 0,
+  901, 712, 0, 5, 0, 584, 0, 280, 37, 0, 998, 0, 0, 0, 989, 994,
+  0, 0, 0, 460, 0, 0, 162, 382, 0, 0, 952, 0, 94, 411, 0, 0,
+  0, 0, 0, 293, 156, 222, 860, 866, 0, 367, 0, 622, 0, 907, 606, 254,
+  0, 219, 0, 235, 707, 39, 705, 0, 392, 398, 970, 179, 193, 182, 249, 940,
+  0, 687, 0, 69, 0, 642, 0, 0, 0, 0, 0, 257, 168, 434, 892, 0,
+  0, 0, 587, 675, 517, 0, 0, 0, 0, 0, 1, 431, 773, 107, 181, 213,
+  432, 623, 0, 0, 0, 229, 684, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 931, 0, 0, 10, 47, 189, 420, 267, 2, 624, 682, 872, 348,
+  342, 657, 0, 516, 0, 921, 591, 0, 183, 85, 993, 0, 0, 0, 780, 0,
+  917, 328, 981, 0, 421, 795, 633, 0, 0, 167, 512, 0, 0, 0, 264, 800,
+  0, 0, 0, 491, 823, 298, 537, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  524, 493, 753, 0, 0, 545, 0, 863, 0, 0, 0, 0, 503, 385, 0, 0,
+  0, 0, 0, 745, 0, 0, 403, 175, 415, 417, 601, 0, 0, 20, 0, 0,
+  0, 0, 730, 0, 0, 815, 0, 0, 211, 443, 652, 961, 0, 0, 777, 710,
+  781, 0, 0, 0, 0, 145, 914, 0, 983, 0, 0, 0, 802, 0, 482, 608,
+  0, 0, 0, 0, 0, 0, 0, 807, 0, 0, 0, 190, 0, 616, 761, 955,
+  0, 0, 0, 0, 495, 0, 0, 173, 191, 0, 0, 0, 0, 0, 535, 0,
+  685, 0, 0, 0, 0, 0, 0, 0, 0, 0, 673, 0, 0, 313, 820, 404,
+  0, 132, 551, 63, 341, 368, 627, 890, 0, 0, 171, 926, 0, 868, 0, 0,
+  0, 602, 0, 386, 534, 0, 0, 0, 128, 0, 64, 0, 0, 604, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 234, 391, 665, 620, 322, 775, 894,
+  0, 0, 0, 550, 502, 997, 0, 0, 34, 0, 207, 603, 194, 0, 0, 0,
+  409, 0, 809, 323, 669, 0, 0, 0, 0, 0, 197, 383, 718, 0, 702, 958,
+  187, 691, 370, 40, 111, 666, 253, 88, 581, 610, 639, 520, 734, 757, 358, 908,
+  0, 0, 0, 754, 927, 0, 0, 0, 0, 315, 274, 0, 406, 0, 0, 413,
+  0, 350, 0, 0, 0, 0, 0, 248, 470, 471, 0, 578, 311, 266, 130, 0,
+  0, 399, 538, 0, 0, 285, 786, 0, 0, 312, 15, 271, 0, 0, 0, 748,
+  0, 596, 140, 0, 678, 0, 217, 0, 0, 0, 230, 0, 332, 0, 0, 0,
+  0, 180, 671, 906, 0, 0, 12, 847, 0, 821, 355, 208, 0, 0, 564, 228,
+  902, 850, 0, 788, 218, 0, 465, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 893, 0, 352, 526, 882, 911, 0, 0, 0, 662, 0, 0, 964,
+  0, 0, 0, 711, 226, 0, 0, 0, 0, 0, 301, 631, 0, 0, 433, 0,
+  0, 0, 209, 29, 667, 309, 857, 979, 0, 0, 0, 0, 725, 0, 0, 0,
+  0, 0, 0, 92, 50, 819, 0, 279, 0, 0, 0, 452, 0, 462, 922, 0,
+  147, 255, 0, 0, 0, 0, 605, 613, 803, 0, 0, 0, 0, 0, 232, 250,
+  0, 783, 0, 97, 796, 905, 0, 272, 0, 791, 0, 0, 0, 212, 0, 0,
+  0, 27, 575, 192, 384, 937, 327, 0, 120, 0, 801, 0, 846, 0, 658, 731,
+  0, 0, 0, 0, 0, 137, 762, 0, 0, 0, 0, 645, 466, 129, 155, 845,
+  570, 297, 59, 0, 0, 0, 630, 683, 835, 227, 0, 0, 347, 75, 448, 28,
+  507, 854, 154, 0, 292, 206, 0, 0, 0, 0, 703, 832, 646, 660, 263, 984,
+  0, 0, 694, 0, 58, 425, 51, 672, 0, 393, 479, 663, 539, 881, 612, 941,
+  0, 139, 696, 674, 899, 0, 528, 339, 0, 177, 0, 0, 0, 126, 400, 0,
+  0, 455, 615, 698, 356, 0, 0, 0, 220, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 438, 842, 536, 0, 0, 0, 407, 0, 0, 0, 0, 24, 44, 241,
+  0, 0, 0, 661, 0, 865, 965, 0, 0, 930, 0, 0, 0, 0, 0, 811,
+  188, 600, 278, 654, 0, 883, 0, 728, 0, 808, 0, 0, 476, 0, 0, 414,
+  453, 0, 954, 557, 827, 0, 692, 729, 0, 677, 741, 776, 944, 243, 276, 0,
+  477, 0, 0, 0, 0, 0, 390, 0, 0, 497, 288, 910, 985, 0, 774, 0,
+  837, 0, 484, 933, 959, 70, 0, 0, 331, 0, 0, 451, 510, 468, 0, 0,
+  0, 0, 380, 918, 0, 0, 0, 0, 721, 0, 0, 0, 0, 0, 0, 818,
+  0, 408, 0, 0, 0, 457, 768, 0, 0, 256, 363, 991, 0, 0, 0, 0,
+  542, 987, 0, 0, 0, 0, 0, 467, 0, 449, 237, 530, 436, 880, 0, 0,
+  0, 0, 109, 699, 577, 19, 242, 202, 590, 240, 713, 329, 0, 0, 909, 153,
+  0, 284, 521, 0, 0, 546, 0, 149, 0, 0, 0, 0, 0, 134, 0, 0,
+  0, 0, 518, 0, 0, 0, 912, 864, 0, 0, 0, 871, 0, 0, 0, 0,
+  262, 0, 0, 0, 0, 634, 480, 695, 0, 0, 680, 0, 0, 0, 0, 752,
+  0, 0, 969, 0, 513, 636, 848, 0, 626, 738, 0, 0, 439, 0, 7, 0,
+  0, 0, 0, 0, 0, 541, 831, 282, 746, 928, 756, 135, 239, 317, 461, 294,
+  0, 0, 0, 0, 0, 441, 0, 874, 0, 822, 0, 555, 0, 0, 0, 0,
+  0, 214, 561, 0, 160, 472, 887, 0, 0, 0, 270, 0, 195, 592, 924, 0,
+  0, 0, 797, 939, 89, 325, 971, 760, 38, 0, 428, 67, 700, 963, 0, 102,
+  115, 0, 995, 0, 0, 0, 0, 0, 0, 0, 485, 99, 0, 0, 0, 454,
+  0, 572, 316, 0, 670, 0, 0, 395, 856, 0, 574, 303, 515, 834, 0, 0,
+  159, 690, 310, 0, 405, 0, 0, 0, 45, 0, 0, 0, 950, 0, 375, 114,
+  790, 737, 0, 0, 0, 870, 879, 0, 0, 589, 0, 0, 0, 0, 0, 0,
+  0, 0, 33, 501, 563, 715, 361, 117, 749, 0, 151, 0, 0, 0, 765, 653,
+  79, 849, 0, 381, 552, 0, 499, 0, 0, 0, 0, 0, 0, 0, 0, 163,
+  165, 299, 306, 833, 0, 548, 609, 0, 619, 583, 0, 0, 0, 116, 372, 896,
+  0, 492, 722, 789, 0, 799, 0, 0, 0, 360, 531, 0, 0, 0, 0, 0,
+  929, 0, 0, 231, 0, 35, 424, 0, 53, 573, 0, 0, 0, 0, 0, 0,
+  0, 0, 463, 0, 0, 0, 418, 0, 0, 0, 0, 611, 853, 0, 544, 0,
+  273, 974, 978, 0, 0, 0, 898, 269, 302, 644, 723, 290, 0, 0, 0, 71,
+  0, 0, 635, 176, 366, 576, 446, 0, 0, 487, 726, 0, 0, 0, 0, 0,
+  649, 481, 0, 0, 0, 782, 0, 621, 553, 0, 0, 704, 464, 719, 0, 0,
+  426, 0, 0, 0, 0, 106, 709, 804, 816, 916, 0, 103, 0, 947, 247, 0,
+  0, 295, 281, 377, 489, 3, 767, 0, 0, 0, 23, 0, 0, 968, 0, 98,
+  966, 359, 980, 0, 0, 0, 0, 0, 567, 456, 104, 585, 558, 647, 693, 36,
+  349, 733, 121, 174, 750, 764, 246, 946, 127, 0, 0, 0, 769, 0, 0, 0,
+  374, 0, 543, 265, 560, 844, 0, 0, 0, 656, 0, 101, 0, 0, 0, 0,
+  0, 0, 0, 0, 184, 943, 962, 0, 0, 136, 0, 0, 0, 0, 0, 0,
+  877, 60, 0, 0, 0, 444, 447, 640, 594, 759, 333, 65, 629, 0, 972, 0,
+  0, 0, 304, 369, 397, 784, 828, 108, 0, 0, 0, 0, 0, 0, 0, 440,
+  68, 0, 46, 84, 152, 727, 0, 0, 110, 923, 170, 566, 0, 778, 0, 0,
+  0, 14, 31, 203, 758, 0, 0, 0, 0, 371, 0, 0, 714, 0, 0, 13,
+  365, 0, 0, 598, 743, 770, 0, 215, 540, 632, 588, 0, 755, 967, 0, 324,
+  0, 157, 0, 0, 335, 17, 458, 196, 0, 0, 0, 0, 0, 0, 496, 0,
+  571, 794, 330, 0, 0, 0, 0, 268, 0, 423, 287, 178, 475, 949, 0, 0,
+  999, 0, 810, 975, 26, 72, 0, 224, 0, 498, 0, 0, 688, 0, 920, 0,
+  0, 0, 0, 0, 0, 379, 527, 787, 0, 0, 0, 0, 855, 0, 0, 0,
+  402, 422, 508, 429, 951, 95, 55, 0, 0, 0, 0, 0, 91, 0, 0, 0,
+  320, 338, 340, 459, 483, 736, 982, 131, 376, 0, 873, 0, 0, 0, 0, 0,
+  0, 891, 430, 321, 185, 362, 396, 351, 740, 826, 0, 0, 614, 0, 986, 579,
+  43, 66, 275, 841, 885, 935, 0, 659, 0, 86, 0, 0, 904, 0, 0, 0,
+  0, 296, 593, 0, 0, 0, 0, 0, 862, 0, 0, 0, 0, 0, 617, 124,
+  0, 641, 166, 364, 533, 607, 717, 0, 4, 0, 0, 525, 378, 900, 186, 875,
+  903, 0, 0, 48, 141, 0, 0, 0, 716, 772, 0, 0, 638, 427, 164, 198,
+  884, 0, 0, 0, 0, 0, 0, 806, 0, 260, 547, 319, 11, 150, 586, 0,
+  0, 0, 852, 74, 568, 0, 0, 0, 122, 337, 637, 643, 867, 0, 0, 82,
+  0, 744, 0, 0, 0, 988, 0, 119, 148, 56, 679, 0, 532, 142, 93, 353,
+  648, 942, 523, 0, 0, 0, 30, 336, 343, 0, 0, 0, 0, 161, 0, 919,
+  0, 0, 251, 0, 0, 0, 0, 0, 80, 474, 830, 0, 824, 0, 953, 836,
+  0, 345, 0, 0, 0, 580, 0, 204, 0, 0, 412, 0, 0, 0, 0, 0,
+  0, 0, 0, 843, 314, 0, 0, 0, 125, 0, 223, 0, 0, 0, 0, 739,
+};
+
+const char *WA_FREQ_92_TOKENS[] = {
+  "ir",
+  "aš",
+  "tai",
+  "kad",
+  "tu",
+  "ne",
+  "taip",
+  "jis",
+  "ką",
+  "čia",
+  "į",
+  "kaip",
+  "su",
+  "ar",
+  "o",
+  "man",
+  "kas",
+  "gerai",
+  "mano",
+  "bet",
+  "iš",
+  "mes",
+  "tik",
+  "tau",
+  "ji",
+  "yra",
+  "jei",
+  "jie",
+  "tavo",
+  "buvo",
+  "savo",
+  "kur",
+  "kai",
+  "dar",
+  "mane",
+  "jūs",
+  "dabar",
+  "apie",
+  "viskas",
+  "jį",
+  "tave",
+  "jo",
+  "jau",
+  "labai",
+  "to",
+  "ten",
+  "reikia",
+  "už",
+  "turi",
+  "kodėl",
+  "po",
+  "nieko",
+  "dėl",
+  "mūsų",
+  "per",
+  "nors",
+  "gali",
+  "gal",
+  "na",
+  "jūsų",
+  "tikrai",
+  "ačiū",
+  "nori",
+  "ko",
+  "nuo",
+  "turiu",
+  "bus",
+  "jos",
+  "štai",
+  "manęs",
+  "ją",
+  "būti",
+  "mums",
+  "jam",
+  "jums",
+  "nes",
+  "visi",
+  "noriu",
+  "juk",
+  "žinai",
+  "pone",
+  "ei",
+  "tiesiog",
+  "tavęs",
+  "žinau",
+  "tą",
+  "nagi",
+  "nėra",
+  "ant",
+  "daug",
+  "viską",
+  "tas",
+  "tada",
+  "prie",
+  "iki",
+  "labas",
+  "jų",
+  "nežinau",
+  "prašau",
+  "juos",
+  "prieš",
+  "vienas",
+  "daugiau",
+  "galiu",
+  "manau",
+  "mus",
+  "vis",
+  "jus",
+  "negaliu",
+  "tiek",
+  "pas",
+  "pat",
+  "taigi",
+  "toks",
+  "net",
+  "be",
+  "dieve",
+  "kol",
+  "žinoma",
+  "kiek",
+  "koks",
+  "mama",
+  "nei",
+  "esu",
+  "pats",
+  "būtų",
+  "esi",
+  "niekada",
+  "tiesa",
+  "kartą",
+  "pasakyti",
+  "jog",
+  "geriau",
+  "visą",
+  "jai",
+  "vieną",
+  "kada",
+  "šiandien",
+  "kuris",
+  "niekas",
+  "atsiprašau",
+  "turime",
+  "eime",
+  "atrodo",
+  "kuo",
+  "negali",
+  "todėl",
+  "aišku",
+  "žmonės",
+  "eik",
+  "greičiau",
+  "metų",
+  "atleisk",
+  "tuo",
+  "palauk",
+  "arba",
+  "laiko",
+  "patinka",
+  "vėl",
+  "manai",
+  "tėti",
+  "jeigu",
+  "sveiki",
+  "visai",
+  "nereikia",
+  "šį",
+  "kartu",
+  "puiku",
+  "visada",
+  "buvau",
+  "du",
+  "kam",
+  "tuoj",
+  "namo",
+  "ta",
+  "klausyk",
+  "žmogus",
+  "tačiau",
+  "jiems",
+  "darai",
+  "kažkas",
+  "juo",
+  "sakė",
+  "padaryti",
+  "visus",
+  "irgi",
+  "nenoriu",
+  "geras",
+  "eiti",
+  "šūdas",
+  "sveikas",
+  "kokia",
+  "tokia",
+  "daryti",
+  "a",
+  "galbūt",
+  "nutiko",
+  "viena",
+  "gi",
+  "kitą",
+  "visa",
+  "kurie",
+  "dieną",
+  "tam",
+  "padėti",
+  "žmogau",
+  "nė",
+  "pinigų",
+  "šis",
+  "velnias",
+  "i",
+  "myliu",
+  "reiškia",
+  "sakiau",
+  "pasakyk",
+  "galima",
+  "maniau",
+  "sako",
+  "sau",
+  "bent",
+  "turbūt",
+  "tavimi",
+  "žmonių",
+  "manimi",
+  "supratau",
+  "norėjau",
+  "tikras",
+  "nebuvo",
+  "velnių",
+  "laikas",
+  "buvai",
+  "supranti",
+  "norėčiau",
+  "kurį",
+  "vyras",
+  "tėvas",
+  "vyksta",
+  "paskui",
+  "saša",
+  "matai",
+  "toliau",
+  "suprantu",
+  "diena",
+  "pirmyn",
+  "pažiūrėk",
+  "vardas",
+  "tie",
+  "turim",
+  "darbo",
+  "atgal",
+  "žiūrėk",
+  "puikiai",
+  "metu",
+  "metus",
+  "duok",
+  "neturi",
+  "liaukis",
+  "ja",
+  "malonu",
+  "jokių",
+  "lyg",
+  "kažką",
+  "ponia",
+  "rimtai",
+  "tania",
+  "darbą",
+  "tikiuosi",
+  "šią",
+  "ateik",
+  "greitai",
+  "manim",
+  "žino",
+  "pati",
+  "kuri",
+  "sere",
+  "gera",
+  "tavim",
+  "galime",
+  "laiką",
+  "matau",
+  "nuostabu",
+  "mačiau",
+  "teisingai",
+  "gyvenimą",
+  "visiškai",
+  "galėčiau",
+  "tėtis",
+  "as",
+  "tuomet",
+  "visas",
+  "ši",
+  "rytoj",
+  "pinigus",
+  "visų",
+  "naktį",
+  "turėjo",
+  "tokio",
+  "viso",
+  "sakau",
+  "beveik",
+  "tarp",
+  "lr",
+  "šiek",
+  "pasakė",
+  "turite",
+  "atleiskit",
+  "kartais",
+  "šito",
+  "leisk",
+  "anksčiau",
+  "neturiu",
+  "sunku",
+  "gana",
+  "žinoti",
+  "kuzia",
+  "nesu",
+  "atsitiko",
+  "save",
+  "tos",
+  "nebus",
+  "draugas",
+  "truputį",
+  "labiau",
+  "darbas",
+  "tikriausiai",
+  "vėliau",
+  "turėjau",
+  "ilgai",
+  "trys",
+  "duris",
+  "vieta",
+  "dvi",
+  "tuos",
+  "visiems",
+  "vaikai",
+  "sakei",
+  "pamatyti",
+  "vakar",
+  "vadinasi",
+  "turėtų",
+  "žmona",
+  "tiesą",
+  "kalba",
+  "nesuprantu",
+  "nesvarbu",
+  "kitas",
+  "mergina",
+  "šitą",
+  "matyti",
+  "daro",
+  "tikra",
+  "einu",
+  "būsiu",
+  "vaikas",
+  "pasakiau",
+  "einam",
+  "nenori",
+  "šios",
+  "vietą",
+  "galite",
+  "kalbi",
+  "šio",
+  "pasakysiu",
+  "moteris",
+  "pagalbos",
+  "sekasi",
+  "būčiau",
+  "jas",
+  "nemanau",
+  "paklausyk",
+  "sūnus",
+  "sveika",
+  "draugai",
+  "jumis",
+  "žmones",
+  "abu",
+  "tokie",
+  "ka",
+  "būtent",
+  "tų",
+  "kokį",
+  "pasikalbėti",
+  "mašiną",
+  "liko",
+  "padėk",
+  "blogai",
+  "būk",
+  "vyrai",
+  "niekad",
+  "gyvenimas",
+  "būt",
+  "teisus",
+  "padarė",
+  "girdėjau",
+  "laukia",
+  "vos",
+  "rankas",
+  "pirma",
+  "galvą",
+  "gaila",
+  "kita",
+  "padarei",
+  "mieloji",
+  "negalima",
+  "vardu",
+  "kurią",
+  "pro",
+  "minučių",
+  "žinote",
+  "grįžti",
+  "žinot",
+  "gero",
+  "dienos",
+  "norite",
+  "reikėjo",
+  "atleiskite",
+  "tiesiai",
+  "gyvenimo",
+  "nesijaudink",
+  "vieno",
+  "vienintelis",
+  "rytas",
+  "ponas",
+  "šalia",
+  "ramiai",
+  "kelias",
+  "aha",
+  "kiekvieną",
+  "visos",
+  "maiklai",
+  "atrodai",
+  "vaikų",
+  "pirmas",
+  "eina",
+  "kurios",
+  "namuose",
+  "galėtų",
+  "mirė",
+  "kitaip",
+  "dalykas",
+  "būsi",
+  "turėčiau",
+  "panele",
+  "matei",
+  "kuriuos",
+  "žemės",
+  "kito",
+  "pagal",
+  "klausau",
+  "dievo",
+  "akis",
+  "galėtum",
+  "vaikinai",
+  "šeima",
+  "pasaulio",
+  "visko",
+  "niekam",
+  "esame",
+  "tris",
+  "girdi",
+  "reikės",
+  "kapitone",
+  "daktare",
+  "supratai",
+  "vandens",
+  "šiuo",
+  "tad",
+  "jėzau",
+  "turėtum",
+  "kiti",
+  "namų",
+  "kalbėti",
+  "seniai",
+  "oho",
+  "alio",
+  "geriausias",
+  "esate",
+  "pagaliau",
+  "mirties",
+  "pavyko",
+  "nepatinka",
+  "metas",
+  "mumis",
+  "savaitę",
+  "tokį",
+  "pasaulyje",
+  "jokio",
+  "namie",
+  "šitas",
+  "mintis",
+  "radau",
+  "norėjo",
+  "žmogaus",
+  "baik",
+  "niekur",
+  "dolerių",
+  "dievas",
+  "vietos",
+  "vaikinas",
+  "atėjo",
+  "galėjo",
+  "nužudyti",
+  "myli",
+  "pasakyt",
+  "galim",
+  "eikš",
+  "graži",
+  "namus",
+  "džekai",
+  "gyvas",
+  "greit",
+  "keista",
+  "gyventi",
+  "patikėti",
+  "prašom",
+  "įdomu",
+  "galais",
+  "mašina",
+  "brolis",
+  "gyvenime",
+  "padariau",
+  "palaukit",
+  "šeimos",
+  "sakyk",
+  "kelio",
+  "gauti",
+  "veikia",
+  "teks",
+  "šiaip",
+  "beje",
+  "pirmą",
+  "imk",
+  "užsičiaupk",
+  "kurio",
+  "pasiruošęs",
+  "ponai",
+  "ginklą",
+  "oro",
+  "dalis",
+  "rasti",
+  "ak",
+  "negi",
+  "tokių",
+  "negerai",
+  "svarbu",
+  "lauk",
+  "tarsi",
+  "ala",
+  "vietoje",
+  "pasaulį",
+  "tegu",
+  "vien",
+  "drauge",
+  "palikti",
+  "sakai",
+  "pinigai",
+  "motina",
+  "šitaip",
+  "dirbti",
+  "bėk",
+  "kitų",
+  "jais",
+  "puikus",
+  "dėkoju",
+  "gyvena",
+  "toli",
+  "žmogų",
+  "būna",
+  "būtum",
+  "merginos",
+  "naują",
+  "paskutinis",
+  "pusę",
+  "negalime",
+  "problemų",
+  "atsargiai",
+  "kažkur",
+  "kokie",
+  "dingo",
+  "brangioji",
+  "iškart",
+  "dėmesio",
+  "ranką",
+  "eisiu",
+  "pakankamai",
+  "tokios",
+  "baigta",
+  "suprasti",
+  "vakarą",
+  "didelis",
+  "meilės",
+  "cia",
+  "vyrukas",
+  "pasakei",
+  "išeiti",
+  "mielasis",
+  "svarbiausia",
+  "velniop",
+  "reikalas",
+  "kokios",
+  "mašinos",
+  "kalbu",
+  "ateina",
+  "mažas",
+  "ai",
+  "dienas",
+  "istorija",
+  "nebūtų",
+  "grįšiu",
+  "galvoje",
+  "patiko",
+  "šaunu",
+  "oi",
+  "važiuojam",
+  "šįvakar",
+  "sėkmės",
+  "komanda",
+  "miesto",
+  "surasti",
+  "tiesų",
+  "dienų",
+  "juokinga",
+  "visur",
+  "metai",
+  "šiame",
+  "išėjo",
+  "džiaugiuosi",
+  "sakyti",
+  "norit",
+  "žinojau",
+  "berniukas",
+  "argi",
+  "galvos",
+  "bijau",
+  "jaučiuosi",
+  "nelabai",
+  "gražu",
+  "priklauso",
+  "pasaulis",
+  "tėvo",
+  "šaunuolis",
+  "skamba",
+  "drauguži",
+  "neblogai",
+  "dėkui",
+  "stok",
+  "kambarį",
+  "neįmanoma",
+  "policija",
+  "naujo",
+  "vaikus",
+  "kelią",
+  "jokios",
+  "puiki",
+  "susipažinti",
+  "eini",
+  "dirba",
+  "paimk",
+  "dviejų",
+  "geriausia",
+  "dalykų",
+  "nežinojau",
+  "smagu",
+  "nenorėjau",
+  "kurių",
+  "karo",
+  "galėtume",
+  "galvojau",
+  "paleisk",
+  "omeny",
+  "padarysiu",
+  "vardą",
+  "nužudė",
+  "parodyk",
+  "maisto",
+  "tokiu",
+  "šie",
+  "silvestrai",
+  "čionai",
+  "daryt",
+  "tikrųjų",
+  "klausimas",
+  "norėtum",
+  "m",
+  "s",
+  "kiekvienas",
+  "sakant",
+  "mudu",
+  "sveikinu",
+  "gražus",
+  "mažiau",
+  "turit",
+  "patys",
+  "žemyn",
+  "nežinai",
+  "miela",
+  "panašu",
+  "sūnau",
+  "laikykis",
+  "aplink",
+  "pradėti",
+  "patį",
+  "mirti",
+  "prisiekiu",
+  "senas",
+  "valandą",
+  "darau",
+  "nebėra",
+  "kartų",
+  "leisti",
+  "turėti",
+  "kitos",
+  "paliko",
+  "kokią",
+  "baigėsi",
+  "lipk",
+  "valandų",
+  "valandas",
+  "keletą",
+  "skauda",
+  "pala",
+  "pamaniau",
+  "pasakysi",
+  "nežino",
+  "pavyks",
+  "vakaras",
+  "nesąmonė",
+  "ateis",
+  "tame",
+  "susitikti",
+  "sužinoti",
+  "norėjai",
+  "bičiuli",
+  "problema",
+  "kažkoks",
+  "įvyko",
+  "pameni",
+  "daktaras",
+  "kelių",
+  "džo",
+  "viduje",
+  "durų",
+  "tėvai",
+  "palik",
+  "kelis",
+  "ryte",
+  "žmonėms",
+  "dukra",
+  "paklausti",
+  "džonai",
+  "proto",
+  "veiki",
+  "rankos",
+  "namai",
+  "būdu",
+  "tuojau",
+  "mėšlas",
+  "likti",
+  "tapo",
+  "kraujo",
+  "padėkit",
+  "lš",
+  "brangusis",
+  "savęs",
+  "nakties",
+  "jaučiu",
+  "vietoj",
+  "planas",
+  "atėjau",
+  "atidaryk",
+  "stalo",
+  "paskutinį",
+  "kokio",
+  "eikit",
+  "ryt",
+  "veidą",
+  "mergaitė",
+  "namą",
+  "nusiramink",
+  "geros",
+  "savimi",
+  "tinka",
+  "dirbu",
+  "karalius",
+  "tokią",
+  "pažiūrėti",
+  "šių",
+  "paprasta",
+  "dievui",
+  "daiktus",
+  "pasisekė",
+  "šiuos",
+  "gavau",
+  "meilė",
+  "nerūpi",
+  "grįžk",
+  "parodyti",
+  "užteks",
+  "nurimk",
+  "nuostabus",
+  "laiku",
+  "mieste",
+  "galit",
+  "girdėjai",
+  "miestą",
+  "galva",
+  "pradžių",
+  "the",
+  "netgi",
+  "važiuoti",
+  "nekenčiu",
+  "galvoju",
+  "vyrų",
+  "reikėtų",
+  "filmas",
+  "regis",
+  "rūpi",
+  "šioje",
+  "kartus",
+  "tomai",
+  "žiūri",
+  "lauke",
+  "dažnai",
+  "turėsi",
+  "vienos",
+  "kelkis",
+  "minutėlę",
+  "kvailas",
+  "davė",
+  "atveju",
+  "galėsi",
+  "kalės",
+  "padaryk",
+  "paskambinsiu",
+  "ponios",
+  "naujas",
+  "nesi",
+  "mamos",
+  "kavos",
+  "negalėjau",
+  "buvome",
+  "kvaila",
+  "pradėjo",
+  "galvoji",
+  "kažko",
+  "pasitrauk",
+  "taniuša",
+  "prakeikimas",
+  "nemačiau",
+  "vaiką",
+  "valandos",
+  "vyrą",
+  "jautiesi",
+  "labanakt",
+  "laivas",
+  "pažįstu",
+  "apgailestauju",
+  "dalykus",
+  "panašaus",
+  "šeimą",
+  "maža",
+  "metais",
+  "pažvelk",
+  "pažadu",
+  "sania",
+  "vienu",
+  "policijos",
+  "andrejyčiau",
+  "minutes",
+  "karas",
+  "turėtume",
+  "ypač",
+  "vyručiai",
+  "pakeisti",
+  "tikiu",
+  "nesupratau",
+  "kuriuo",
+  "goša",
+  "laivą",
+  "is",
+  "bandau",
+  "šiąnakt",
+  "nesakyk",
+  "kadangi",
+  "kokių",
+  "lik",
+  "gerą",
+  "dedasi",
+  "trijų",
+  "daryk",
+  "ranka",
+  "turėjai",
+  "tapti",
+  "juokauji",
+  "sūnų",
+  "paimti",
+  "parodysiu",
+  "darosi",
+  "šakės",
+  "u",
+  "draugų",
+  "merginą",
+  "patikėk",
+  "lengva",
+  "skirtumas",
+  "važiuok",
+  "miręs",
+  "bei",
+  "žmoną",
+  "gale",
+  "pasiruošę",
+  "niekuo",
+  "istoriją",
+  "namas",
+  "jėga",
+  "gyvybę",
+  "geri",
+  "mėnesį",
+  "dink",
+  "seni",
+  "prakeiktas",
+  "nuolat",
+  "vidun",
+  "mėnesius",
+  "kitus",
+  "duoti",
+  "mielas",
+  "būdas",
+  "teisi",
+  "deja",
+  "gavai",
+  "mokyklos",
+  "tegul",
+  "sara",
+  "bloga",
+  "telefoną",
+  "vienintelė",
+  "kieno",
+  "privalai",
+  "apsaugos",
+  "pasiimti",
+  "nuostabi",
+  "ryto",
+  "panašiai",
+  "vakare",
+  "numeris",
+  "kambaryje",
+  "išskyrus",
+  "netrukus",
+  "laikyk",
+  "link",
+  "prasideda",
+  "nebuvau",
+  "durys",
+  "gražiai",
+  "galėjai",
+  "negyvas",
+  "sutinku",
+  "nesupranti",
+  "padės",
+  "kovos",
+  "žodis",
+  "miegoti",
+  "širdis",
+  "d",
+  "manote",
+  "tėve",
+  "dešimt",
+  "blogas",
+  "pamiršau",
+  "žinome",
+  "praėjo",
+  "telefono",
+  "biče",
+  "porą",
+  "virš",
+  "paskubėk",
+  "širdies",
+  "prasidėjo",
+  "jav",
+  "varyk",
+  "didelė",
+  "moka",
+  "mirtis",
+  "neturime",
+  "brolau",
+  "oh",
+  "pabaiga",
+  "deividai",
+  "mokyklą",
+  "pasilikti",
+  "paprastai",
+  "pietų",
+  "išgelbėti",
+  "nedaryk",
+  "šita",
+  "nematau",
+  "vyro",
+  "knygą",
+  "planą",
+};
+const uint16_t WA_FREQ_92_RANKS[] = {
+  0, 485, 752, 772, 883, 908, 0, 218, 809, 0, 0, 0, 9, 302, 0, 0,
+  74, 280, 288, 793, 0, 0, 0, 111, 961, 32, 988, 0, 0, 3, 256, 634,
+  619, 759, 31, 979, 0, 483, 925, 0, 0, 0, 0, 124, 0, 12, 335, 965,
+  0, 0, 0, 0, 0, 0, 728, 942, 0, 0, 0, 27, 121, 779, 608, 0,
+  0, 0, 550, 102, 0, 0, 0, 73, 0, 309, 0, 213, 738, 0, 0, 0,
+  0, 0, 0, 748, 831, 0, 0, 0, 0, 0, 0, 0, 0, 0, 511, 891,
+  0, 0, 437, 156, 293, 0, 922, 692, 184, 128, 0, 0, 0, 907, 0, 0,
+  0, 150, 157, 467, 118, 187, 506, 0, 0, 0, 0, 0, 658, 322, 667, 230,
+  526, 813, 226, 259, 197, 181, 277, 508, 617, 986, 0, 417, 0, 383, 663, 0,
+  0, 446, 0, 0, 0, 0, 0, 833, 919, 0, 0, 0, 355, 636, 890, 344,
+  0, 717, 0, 0, 25, 0, 354, 0, 212, 262, 0, 0, 0, 0, 168, 983,
+  299, 648, 677, 0, 0, 0, 683, 440, 0, 0, 0, 0, 0, 950, 442, 0,
+  911, 0, 620, 0, 341, 438, 0, 0, 0, 0, 408, 458, 631, 489, 435, 822,
+  531, 369, 206, 313, 542, 618, 687, 857, 924, 615, 0, 0, 0, 0, 0, 763,
+  568, 896, 0, 0, 0, 0, 893, 0, 0, 0, 656, 0, 964, 0, 0, 0,
+  0, 860, 86, 861, 0, 216, 292, 209, 295, 338, 997, 477, 691, 933, 693, 859,
+  982, 147, 11, 0, 0, 0, 0, 494, 0, 790, 0, 0, 0, 173, 570, 224,
+  0, 0, 0, 23, 125, 581, 660, 968, 0, 0, 287, 223, 849, 0, 0, 420,
+  565, 766, 865, 162, 282, 104, 963, 0, 805, 592, 0, 0, 0, 0, 0, 0,
+  0, 0, 845, 13, 436, 588, 70, 119, 671, 0, 874, 110, 938, 0, 0, 0,
+  654, 0, 484, 0, 491, 0, 0, 0, 139, 513, 775, 572, 932, 974, 0, 0,
+  646, 380, 0, 414, 284, 0, 0, 0, 541, 967, 0, 106, 881, 0, 5, 434,
+  761, 345, 843, 14, 0, 836, 880, 0, 172, 0, 0, 350, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 794, 586, 0, 864, 0, 0, 0, 973,
+  0, 0, 158, 490, 994, 810, 443, 227, 0, 0, 0, 297, 641, 920, 0, 0,
+  55, 0, 0, 0, 0, 0, 0, 0, 461, 0, 0, 670, 0, 710, 384, 0,
+  0, 0, 757, 0, 250, 0, 0, 0, 0, 473, 0, 764, 0, 928, 0, 0,
+  137, 858, 0, 195, 594, 328, 948, 758, 0, 0, 647, 0, 0, 0, 0, 0,
+  0, 0, 0, 583, 610, 160, 0, 0, 602, 699, 806, 0, 0, 0, 0, 179,
+  0, 561, 0, 0, 781, 852, 0, 208, 423, 0, 584, 330, 251, 824, 776, 536,
+  320, 449, 459, 935, 0, 0, 875, 0, 792, 0, 272, 0, 715, 0, 0, 0,
+  0, 0, 0, 0, 0, 359, 566, 768, 808, 0, 248, 0, 0, 0, 298, 633,
+  0, 0, 0, 0, 0, 0, 0, 0, 749, 981, 0, 245, 488, 0, 0, 0,
+  0, 0, 587, 804, 217, 0, 0, 296, 315, 93, 551, 258, 26, 556, 0, 131,
+  72, 134, 161, 614, 0, 0, 0, 791, 428, 394, 0, 415, 0, 0, 0, 105,
+  201, 730, 959, 999, 786, 205, 934, 0, 0, 0, 0, 0, 0, 0, 825, 856,
+  498, 152, 703, 0, 0, 170, 0, 0, 387, 115, 851, 460, 0, 0, 746, 0,
+  126, 85, 363, 737, 941, 0, 753, 0, 0, 0, 0, 0, 848, 0, 0, 202,
+  0, 0, 19, 721, 0, 0, 624, 0, 0, 0, 0, 549, 0, 0, 0, 0,
+  496, 0, 630, 0, 951, 35, 112, 616, 0, 846, 0, 0, 590, 0, 159, 0,
+  0, 0, 0, 0, 754, 678, 716, 871, 0, 276, 879, 0, 0, 0, 0, 0,
+  0, 34, 796, 365, 0, 0, 559, 505, 0, 0, 0, 308, 370, 399, 582, 708,
+  519, 731, 0, 0, 59, 18, 819, 811, 906, 324, 598, 0, 0, 655, 0, 364,
+  0, 0, 0, 474, 0, 398, 689, 801, 960, 53, 61, 516, 0, 40, 16, 164,
+  204, 727, 821, 132, 815, 325, 0, 231, 194, 989, 0, 0, 0, 0, 0, 482,
+  0, 0, 838, 0, 0, 0, 611, 228, 0, 0, 0, 0, 740, 681, 0, 0,
+  0, 785, 0, 0, 0, 0, 46, 375, 0, 0, 0, 0, 448, 571, 0, 0,
+  103, 0, 407, 234, 257, 382, 0, 0, 0, 0, 0, 679, 219, 0, 627, 0,
+  0, 0, 0, 0, 0, 895, 0, 84, 101, 303, 0, 0, 0, 97, 343, 471,
+  576, 704, 349, 904, 265, 0, 169, 254, 830, 539, 957, 0, 901, 215, 0, 0,
+  952, 15, 0, 892, 0, 30, 701, 854, 970, 0, 0, 79, 67, 650, 470, 977,
+  0, 0, 0, 413, 640, 690, 0, 271, 479, 0, 929, 978, 0, 0, 0, 0,
+  0, 0, 0, 0, 307, 0, 0, 455, 0, 639, 430, 441, 814, 0, 52, 621,
+  0, 0, 141, 0, 0, 0, 249, 0, 525, 386, 841, 318, 0, 0, 33, 0,
+  739, 903, 987, 0, 0, 75, 376, 734, 0, 475, 591, 863, 10, 894, 211, 782,
+  0, 645, 0, 0, 0, 0, 807, 0, 548, 0, 0, 0, 0, 0, 0, 390,
+  445, 985, 0, 832, 0, 0, 501, 0, 464, 674, 319, 1000, 0, 0, 0, 274,
+  803, 878, 0, 238, 0, 600, 745, 240, 0, 0, 0, 0, 0, 0, 472, 0,
+  0, 0, 0, 661, 0, 0, 0, 936, 301, 0, 0, 80, 0, 0, 0, 0,
+  267, 193, 853, 0, 0, 0, 0, 0, 0, 0, 0, 388, 146, 954, 0, 0,
+  48, 0, 0, 44, 0, 358, 867, 0, 0, 0, 214, 0, 962, 0, 0, 0,
+  0, 0, 0, 145, 372, 0, 454, 107, 947, 183, 419, 0, 521, 447, 788, 816,
+  0, 599, 175, 0, 98, 913, 311, 0, 0, 0, 0, 0, 971, 0, 0, 0,
+  0, 0, 151, 0, 71, 182, 0, 0, 0, 0, 778, 0, 0, 422, 780, 0,
+  0, 723, 953, 735, 712, 937, 0, 527, 0, 0, 0, 0, 0, 869, 0, 0,
+  0, 0, 0, 0, 37, 239, 69, 140, 154, 129, 644, 685, 0, 0, 709, 0,
+  0, 0, 0, 0, 504, 767, 0, 260, 0, 0, 378, 0, 326, 769, 0, 0,
+  411, 109, 465, 0, 515, 604, 6, 94, 236, 595, 0, 743, 96, 185, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 342, 0, 0, 696, 0, 0,
+  0, 0, 0, 0, 229, 0, 585, 0, 902, 0, 0, 0, 980, 0, 0, 0,
+  866, 697, 0, 926, 0, 0, 0, 207, 771, 876, 0, 756, 232, 882, 0, 0,
+  0, 820, 0, 0, 0, 462, 89, 534, 63, 729, 373, 652, 747, 940, 374, 431,
+  0, 0, 0, 457, 733, 0, 28, 0, 133, 512, 0, 889, 0, 0, 0, 0,
+  0, 0, 842, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 589, 0,
+  0, 352, 0, 0, 385, 0, 0, 653, 666, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 720, 366, 0, 0, 0, 421, 235, 0, 0, 66, 0, 0,
+  711, 0, 0, 0, 0, 0, 306, 186, 532, 777, 0, 0, 0, 268, 0, 0,
+  0, 784, 0, 0, 877, 802, 0, 0, 0, 0, 0, 0, 744, 0, 0, 0,
+  885, 969, 580, 898, 0, 0, 0, 751, 0, 49, 81, 0, 0, 0, 755, 0,
+  336, 0, 314, 0, 0, 700, 0, 0, 0, 91, 840, 698, 0, 0, 0, 371,
+  0, 741, 870, 887, 198, 130, 312, 995, 56, 225, 990, 0, 0, 0, 0, 400,
+  510, 0, 0, 20, 148, 0, 82, 486, 0, 247, 317, 722, 0, 210, 0, 0,
+  0, 0, 0, 927, 0, 514, 0, 705, 332, 188, 0, 0, 0, 0, 522, 353,
+  273, 416, 0, 389, 0, 0, 0, 0, 0, 0, 0, 0, 190, 0, 0, 702,
+  719, 910, 0, 0, 0, 0, 0, 0, 834, 433, 21, 180, 0, 0, 220, 244,
+  155, 578, 855, 949, 0, 0, 0, 0, 0, 0, 533, 83, 346, 0, 0, 0,
+  0, 0, 0, 638, 329, 357, 637, 497, 0, 0, 530, 0, 0, 0, 0, 0,
+  0, 750, 0, 0, 975, 283, 0, 918, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 726, 945, 427, 0, 509, 0, 0, 0, 0, 200, 0, 0, 799, 0, 0,
+  0, 24, 528, 0, 0, 0, 0, 0, 0, 930, 0, 367, 333, 553, 300, 87,
+  0, 606, 564, 327, 684, 116, 827, 567, 0, 17, 29, 0, 0, 0, 351, 795,
+  900, 912, 294, 404, 0, 0, 0, 0, 597, 0, 0, 406, 540, 286, 0, 555,
+  0, 391, 0, 0, 253, 543, 0, 261, 41, 51, 165, 237, 439, 403, 337, 529,
+  68, 659, 736, 872, 0, 178, 50, 410, 762, 0, 837, 607, 0, 0, 632, 0,
+  412, 0, 0, 127, 149, 0, 0, 381, 0, 316, 0, 0, 0, 65, 0, 0,
+  0, 0, 0, 144, 0, 680, 1, 0, 0, 0, 993, 0, 199, 817, 0, 537,
+  868, 266, 992, 0, 0, 64, 0, 0, 270, 0, 138, 0, 304, 0, 0, 305,
+  0, 0, 0, 0, 798, 0, 0, 452, 897, 0, 395, 613, 724, 0, 117, 242,
+  0, 0, 0, 0, 0, 839, 0, 60, 0, 0, 0, 0, 456, 789, 0, 347,
+  331, 405, 451, 62, 579, 291, 958, 665, 998, 0, 0, 0, 0, 625, 0, 222,
+  58, 0, 0, 557, 339, 368, 643, 686, 713, 0, 0, 524, 0, 0, 502, 252,
+  0, 662, 243, 0, 463, 0, 787, 0, 269, 356, 931, 143, 0, 0, 574, 0,
+  275, 418, 847, 0, 520, 0, 0, 0, 0, 0, 0, 0, 377, 835, 0, 0,
+  0, 426, 0, 0, 0, 0, 492, 593, 596, 0, 0, 0, 0, 361, 0, 0,
+  0, 0, 476, 0, 22, 77, 507, 812, 0, 0, 233, 0, 0, 0, 0, 2,
+  108, 0, 0, 573, 0, 0, 0, 0, 36, 725, 0, 92, 0, 0, 78, 487,
+  43, 481, 38, 991, 0, 0, 672, 0, 0, 558, 676, 0, 0, 348, 0, 0,
+  0, 263, 0, 0, 450, 42, 246, 424, 176, 826, 8, 0, 95, 279, 432, 0,
+  136, 0, 0, 171, 0, 0, 135, 538, 7, 0, 0, 45, 649, 0, 0, 0,
+  0, 480, 0, 0, 0, 829, 884, 100, 0, 0, 562, 0, 0, 166, 642, 984,
+  0, 547, 0, 88, 0, 828, 0, 651, 0, 0, 976, 0, 0, 0, 0, 429,
+  0, 0, 0, 706, 0, 0, 0, 402, 605, 241, 57, 635, 732, 123, 163, 668,
+  946, 0, 0, 0, 0, 221, 142, 177, 321, 695, 493, 546, 334, 575, 675, 682,
+  196, 192, 167, 800, 612, 0, 916, 0, 0, 0, 0, 289, 362, 0, 0, 4,
+  425, 39, 714, 873, 844, 0, 469, 0, 0, 0, 189, 478, 466, 0, 0, 0,
+  120, 0, 0, 281, 360, 818, 0, 0, 191, 0, 0, 0, 0, 0, 0, 90,
+  0, 0, 628, 0, 453, 545, 609, 915, 113, 577, 0, 0, 122, 517, 623, 0,
+  0, 0, 0, 0, 0, 0, 0, 626, 0, 0, 323, 603, 0, 397, 0, 0,
+  0, 0, 563, 0, 0, 0, 923, 468, 0, 944, 0, 495, 718, 888, 0, 0,
+  0, 0, 0, 783, 0, 560, 0, 174, 0, 0, 0, 694, 0, 0, 622, 823,
+  0, 0, 0, 0, 47, 909, 905, 340, 0, 0, 921, 0, 899, 278, 0, 862,
+  0, 0, 760, 552, 669, 850, 939, 886, 688, 0, 914, 956, 264, 393, 0, 0,
+  707, 0, 770, 0, 153, 76, 255, 500, 285, 503, 774, 0, 396, 535, 0, 0,
+  0, 0, 0, 310, 0, 554, 0, 0, 0, 0, 0, 0, 0, 0, 114, 290,
+  943, 0, 0, 544, 972, 996, 0, 0, 0, 0, 0, 664, 569, 797, 765, 0,
+  0, 0, 518, 773, 0, 0, 0, 0, 401, 409, 673, 629, 917, 0, 0, 0,
+  0, 0, 0, 0, 0, 379, 601, 499, 0, 0, 0, 203, 0, 0, 0, 523,
+  966, 0, 444, 0, 99, 0, 657, 54, 742, 392, 0, 955, 0, 0, 0, 0,
+};
+
+const char *WA_FREQ_93_TOKENS[] = {
+  "ir",
+  "cīši",
+  "pasauļs",
+  "pylns",
+  "ar",
+  "troku",
+  "cylvākim",
+  "tovs",
+  "kačs",
+  "malns",
+  "dzeive",
+  "sapnys",
+  "kod",
+  "jius",
+  "planavoj",
+  "puorbaudeit",
+  "jei",
+  "sasnēdze",
+  "īvārojamus",
+  "rezultatus",
+  "jam",
+  "stypra",
+  "gribiešona",
+  "juos",
+  "sirdsapziņa",
+  "skaidra",
+  "es",
+  "nagrybu",
+  "dzeivuot",
+  "vīns",
+  "pats",
+  "maņ",
+  "stuovūklis",
+  "dareit",
+  "koč",
+  "kū",
+  "cytu",
+  "mes",
+  "asam",
+  "dusmeigi",
+};
+const uint16_t WA_FREQ_93_RANKS[] = {
+  10, 0, 0, 0, 38, 0, 0, 33, 0, 39, 0, 0, 0, 0, 0, 0,
+  21, 0, 0, 31, 0, 20, 0, 0, 0, 0, 18, 0, 0, 0, 22, 0,
+  28, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 26, 0, 4, 9,
+  40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 27, 0,
+  16, 14, 0, 0, 0, 0, 0, 0, 23, 0, 15, 0, 32, 12, 0, 0,
+  0, 0, 0, 6, 7, 0, 0, 24, 36, 19, 35, 0, 0, 25, 2, 0,
+  0, 0, 0, 5, 0, 30, 0, 0, 0, 0, 0, 0, 0, 34, 0, 0,
+  0, 0, 0, 0, 29, 0, 1, 0, 0, 3, 13, 0, 0, 0, 11, 37,
+};
+
+const char *WA_FREQ_94_TOKENS[] = {
+  "ir",
+  "es",
+  "tu",
+  "un",
+  "tas",
+  "ka",
+  "man",
+  "to",
+  "vai",
+  "ko",
+  "ar",
+  "par",
+  "kas",
+  "tā",
+  "kā",
+  "viņš",
+  "tev",
+  "jā",
+  "uz",
+  "no",
+  "mēs",
+  "nav",
+  "labi",
+  "nē",
+  "bet",
+  "jūs",
+  "lai",
+  "ja",
+  "viņa",
+  "mani",
+  "bija",
+  "viņu",
+  "esmu",
+  "esi",
+  "tevi",
+  "mums",
+  "ne",
+  "tikai",
+  "tad",
+  "viņi",
+  "kad",
+  "jums",
+  "arī",
+  "viss",
+  "pie",
+  "kur",
+  "nu",
+  "vēl",
+  "tik",
+  "jau",
+  "tur",
+  "te",
+  "kaut",
+  "būs",
+  "paldies",
+  "visu",
+  "viņam",
+  "tagad",
+  "pēc",
+  "šeit",
+  "kāpēc",
+  "būtu",
+  "ļoti",
+  "savu",
+  "mūsu",
+  "lūdzu",
+  "taču",
+  "šo",
+  "gan",
+  "mans",
+  "ak",
+  "kāds",
+  "jūsu",
+  "zinu",
+  "daudz",
+  "jo",
+  "varbūt",
+  "esam",
+  "kungs",
+  "cik",
+  "zini",
+  "tās",
+  "mana",
+  "tiešām",
+  "esat",
+  "domāju",
+  "pa",
+  "var",
+  "varētu",
+  "būt",
+  "tam",
+  "tāpēc",
+  "visi",
+  "nezinu",
+  "šī",
+  "nekad",
+  "viens",
+  "līdz",
+  "pat",
+  "aiziet",
+  "gribu",
+  "manu",
+  "varu",
+  "gribi",
+  "kurš",
+  "kopā",
+  "tie",
+  "neesmu",
+  "dievs",
+  "prom",
+  "domā",
+  "pirms",
+  "vairs",
+  "neko",
+  "viņiem",
+  "protams",
+  "vien",
+  "šis",
+  "kādu",
+  "vajag",
+  "mūs",
+  "kārtībā",
+  "tieši",
+  "tava",
+  "atpakaļ",
+  "viņai",
+  "nāc",
+  "tavs",
+  "vienu",
+  "nekas",
+  "patīk",
+  "vairāk",
+  "notiek",
+  "pats",
+  "vienmēr",
+  "viņas",
+  "nevaru",
+  "vari",
+  "vienkārši",
+  "tavu",
+  "dari",
+  "bez",
+  "iet",
+  "pret",
+  "ej",
+  "nebija",
+  "labāk",
+  "dēļ",
+  "lieliski",
+  "kāda",
+  "teica",
+  "biju",
+  "šķiet",
+  "laiku",
+  "nekā",
+  "sveiks",
+  "mājās",
+  "tātad",
+  "neviens",
+  "piedod",
+  "zināt",
+  "ser",
+  "atkal",
+  "iekšā",
+  "laiks",
+  "nevar",
+  "pagaidi",
+  "viņus",
+  "ejam",
+  "tāds",
+  "trīs",
+  "teicu",
+  "runā",
+  "manis",
+  "cilvēki",
+  "ei",
+  "darīt",
+  "neesi",
+  "pārāk",
+  "labs",
+  "varam",
+  "tevis",
+  "visiem",
+  "sauc",
+  "velns",
+  "cilvēks",
+  "draugs",
+  "laika",
+  "sevi",
+  "ārā",
+  "viena",
+  "naudu",
+  "taisnība",
+  "tos",
+  "tēvs",
+  "skaidrs",
+  "šurp",
+  "laikā",
+  "šodien",
+  "notika",
+  "lietas",
+  "citu",
+  "tajā",
+  "kuru",
+  "atvainojiet",
+  "teikt",
+  "grib",
+  "šīs",
+  "šajā",
+  "nozīmē",
+  "tādu",
+  "dienu",
+  "izskatās",
+  "kam",
+  "vecīt",
+  "mīlu",
+  "vajadzētu",
+  "laikam",
+  "žēl",
+  "tāda",
+  "tāpat",
+  "redzēt",
+  "jābūt",
+  "bijis",
+  "noteikti",
+  "negribu",
+  "manas",
+  "tūlīt",
+  "kādēļ",
+  "iespējams",
+  "divi",
+  "savas",
+  "kamēr",
+  "joprojām",
+  "tika",
+  "zina",
+  "cilvēku",
+  "palīdzēt",
+  "visus",
+  "gatavs",
+  "vietā",
+  "tikko",
+  "saki",
+  "nevajag",
+  "ātrāk",
+  "līdzi",
+  "pareizi",
+  "ilgi",
+  "ātri",
+  "lieta",
+  "nebūtu",
+  "redzi",
+  "manā",
+  "darbu",
+  "sveiki",
+  "paskaties",
+  "vajadzīgs",
+  "gadu",
+  "sveika",
+  "visas",
+  "jauki",
+  "tiem",
+  "beidz",
+  "noticis",
+  "saka",
+  "nebūs",
+  "dēls",
+  "katru",
+  "mamma",
+  "starp",
+  "galā",
+  "velna",
+  "gandrīz",
+  "tiek",
+  "droši",
+  "gribēju",
+  "gadus",
+  "pateikt",
+  "nedaudz",
+  "rokas",
+  "vārdu",
+  "lūk",
+  "aiz",
+  "ļauj",
+  "augšā",
+  "it",
+  "gribētu",
+  "laba",
+  "biji",
+  "dienas",
+  "sev",
+  "skaties",
+  "rīt",
+  "teici",
+  "vārds",
+  "dara",
+  "kundze",
+  "gadiem",
+  "dod",
+  "savā",
+  "liels",
+  "diena",
+  "lietu",
+  "būšu",
+  "dzīvi",
+  "vietu",
+  "klāt",
+  "pāris",
+  "reizi",
+  "vieta",
+  "darba",
+  "tēt",
+  "jāiet",
+  "mīļā",
+  "mazliet",
+  "vaļā",
+  "darbs",
+  "nevis",
+  "tavas",
+  "varat",
+  "draugi",
+  "drīz",
+  "abi",
+  "priekšā",
+  "pasaulē",
+  "runāt",
+  "puiši",
+  "tēti",
+  "ceru",
+  "laukā",
+  "labu",
+  "vīrs",
+  "visa",
+  "priekšu",
+  "nemaz",
+  "atceries",
+  "cilvēkiem",
+  "redzēju",
+  "saprotu",
+  "redzu",
+  "nāk",
+  "hei",
+  "sapratu",
+  "saproti",
+  "pasaules",
+  "divas",
+  "atrast",
+  "tomēr",
+  "kopš",
+  "pasaki",
+  "atvaino",
+  "pāri",
+  "vajadzēja",
+  "grūti",
+  "bērni",
+  "nopietni",
+  "nevari",
+  "jādara",
+  "doties",
+  "patiesībā",
+  "saku",
+  "nedomāju",
+  "diezgan",
+  "nogalināt",
+  "tālāk",
+  "vēlreiz",
+  "tikt",
+  "pati",
+  "pīter",
+  "cauri",
+  "durvis",
+  "miris",
+  "naudas",
+  "redzējis",
+  "pilnīgi",
+  "šovakar",
+  "lejā",
+  "priekš",
+  "fib",
+  "vienalga",
+  "slikti",
+  "ņem",
+  "kura",
+  "nost",
+  "mašīnu",
+  "vismaz",
+  "dzīve",
+  "harij",
+  "roku",
+  "nauda",
+  "meitene",
+  "sasodīts",
+  "vēlāk",
+  "nespēju",
+  "nekādu",
+  "tavā",
+  "reiz",
+  "atā",
+  "nīl",
+  "prieks",
+  "pirmais",
+  "šie",
+  "pašu",
+  "vietas",
+  "izdarīt",
+  "zemes",
+  "mājas",
+  "nolādēts",
+  "būsi",
+  "nepatīk",
+  "piedodiet",
+  "šejienes",
+  "vēlies",
+  "gribat",
+  "mīļais",
+  "acis",
+  "ejiet",
+  "klau",
+  "tai",
+  "patiešām",
+  "kungi",
+  "zem",
+  "strādā",
+  "priecājos",
+  "savus",
+  "kādreiz",
+  "iesim",
+  "ceļu",
+  "gada",
+  "paliec",
+  "kādas",
+  "sava",
+  "iespēja",
+  "notiks",
+  "s",
+  "nesaprotu",
+  "labā",
+  "neesam",
+  "bērns",
+  "nāciet",
+  "vienīgais",
+  "dzīvo",
+  "cits",
+  "vajadzīga",
+  "minūtes",
+  "svarīgi",
+  "tētis",
+  "klausies",
+  "kādam",
+  "sieva",
+  "liekas",
+  "otru",
+  "palikt",
+  "džek",
+  "nevienam",
+  "izbeidz",
+  "dabūt",
+  "o",
+  "runāju",
+  "bērnu",
+  "dolāru",
+  "garām",
+  "beidzot",
+  "laipni",
+  "pagaidiet",
+  "pirmā",
+  "oho",
+  "brauc",
+  "tiks",
+  "pirmo",
+  "labākais",
+  "nedrīkst",
+  "viegli",
+  "ūdens",
+  "atrodas",
+  "puika",
+  "dzīvot",
+  "dienā",
+  "citādi",
+  "tām",
+  "drošs",
+  "tādēļ",
+  "vēlos",
+  "pēdējā",
+  "vispār",
+  "galvu",
+  "sieviete",
+  "tiksimies",
+  "nevaram",
+  "atradu",
+  "māte",
+  "mammu",
+  "kuri",
+  "puisis",
+  "stundas",
+  "dieva",
+  "nakti",
+  "īsti",
+  "forši",
+  "doma",
+  "būsim",
+  "sen",
+  "pusi",
+  "pietiekami",
+  "manuprāt",
+  "ceļā",
+  "pasaule",
+  "asv",
+  "problēma",
+  "daži",
+  "palīdzību",
+  "mašīna",
+  "daļa",
+  "gadā",
+  "tālu",
+  "daru",
+  "dažas",
+  "pietiek",
+  "izskaties",
+  "parasti",
+  "sirds",
+  "mierā",
+  "uzmanību",
+  "tādas",
+  "šim",
+  "gadījumā",
+  "jautājums",
+  "dzirdēju",
+  "mazais",
+  "gribēja",
+  "ziņu",
+  "meklē",
+  "cilvēkus",
+  "liec",
+  "gadi",
+  "labrīt",
+  "gaida",
+  "liela",
+  "aizveries",
+  "pasauli",
+  "bijām",
+  "jaunu",
+  "mājā",
+  "zināju",
+  "šobrīd",
+  "kādā",
+  "kuras",
+  "dzīves",
+  "satikt",
+  "ieroci",
+  "hallo",
+  "čau",
+  "palīdzi",
+  "sievu",
+  "jēziņ",
+  "paliek",
+  "kādi",
+  "hārvij",
+  "tuvu",
+  "nekādas",
+  "vēlu",
+  "skaista",
+  "nāves",
+  "gluži",
+  "zinām",
+  "rīta",
+  "nezināju",
+  "runa",
+  "dzīvs",
+  "kurā",
+  "dzīvību",
+  "drīkstu",
+  "nevienu",
+  "plāns",
+  "ziņas",
+  "spēj",
+  "mieru",
+  "sievietes",
+  "atgriezies",
+  "draugu",
+  "uzmanīgi",
+  "apkārt",
+  "i",
+  "ģimenes",
+  "iešu",
+  "nogalināja",
+  "vīru",
+  "strādāju",
+  "nomierinies",
+  "māju",
+  "pavisam",
+  "agrāk",
+  "nomira",
+  "vakar",
+  "spēlē",
+  "smieklīgi",
+  "gatavi",
+  "brālis",
+  "patiesību",
+  "blakus",
+  "vaina",
+  "jauna",
+  "domājat",
+  "meitenes",
+  "vēlas",
+  "vārdā",
+  "citi",
+  "vispirms",
+  "caur",
+  "nedēļas",
+  "dzirdēt",
+  "re",
+  "atceros",
+  "tādi",
+  "minūtēm",
+  "esot",
+  "bijusi",
+  "drošības",
+  "klājas",
+  "īpaši",
+  "izklausās",
+  "tiesa",
+  "jūtos",
+  "vienā",
+  "domāt",
+  "pēdējo",
+  "zemē",
+  "nakts",
+  "mašīnā",
+  "turies",
+  "pieder",
+  "tavi",
+  "meiteni",
+  "vajadzēs",
+  "dāmas",
+  "pār",
+  "vienīgā",
+  "vecais",
+  "paņem",
+  "prātā",
+  "iespēju",
+  "tepat",
+  "saviem",
+  "pakaļ",
+  "izdevās",
+  "nebiju",
+  "tēvu",
+  "ģimene",
+  "jauns",
+  "valsts",
+  "tici",
+  "liek",
+  "varēja",
+  "tikpat",
+  "neuztraucies",
+  "vērts",
+  "saprast",
+  "pietiks",
+  "darāt",
+  "negribi",
+  "palīgā",
+  "brīdi",
+  "neticami",
+  "bērniem",
+  "lieliska",
+  "tuvojas",
+  "pīters",
+  "ideja",
+  "pusē",
+  "šiem",
+  "mašīnas",
+  "cita",
+  "īsts",
+  "u",
+  "šoreiz",
+  "apsolu",
+  "jauks",
+  "ellē",
+  "beigas",
+  "braucam",
+  "godīgi",
+  "neviena",
+  "braukt",
+  "turpini",
+  "tiesas",
+  "vēlaties",
+  "iepriekš",
+  "kļūst",
+  "neesat",
+  "divus",
+  "sāra",
+  "nīls",
+  "īstais",
+  "māja",
+  "spēle",
+  "desmit",
+  "parādi",
+  "mazā",
+  "vecāki",
+  "nezini",
+  "šos",
+  "a",
+  "atgriezties",
+  "durvīm",
+  "noticēt",
+  "skrien",
+  "dzirdi",
+  "jautri",
+  "kurp",
+  "aģents",
+  "kurienes",
+  "dzīvē",
+  "atvainojos",
+  "pārliecināts",
+  "lielisks",
+  "izdarīji",
+  "paklausies",
+  "redzēji",
+  "cenšos",
+  "cietumā",
+  "asinis",
+  "skaisti",
+  "gatava",
+  "viņù",
+  "izmantot",
+  "izdarīja",
+  "lika",
+  "nekāda",
+  "dīvaini",
+  "sakot",
+  "kara",
+  "maz",
+  "darīsim",
+  "dzimšanas",
+  "vainas",
+  "iepazīties",
+  "zemi",
+  "ap",
+  "mierīgi",
+  "strādāt",
+  "cilvēka",
+  "citiem",
+  "padomā",
+  "tēva",
+  "pilsētā",
+  "diez",
+  "jātiek",
+  "visā",
+  "pēdējais",
+  "šai",
+  "reizes",
+  "beidzies",
+  "jauka",
+  "darām",
+  "aprunāties",
+  "savām",
+  "pieci",
+  "nezina",
+  "galvenais",
+  "atdod",
+  "manai",
+  "pazīstu",
+  "kreisi",
+  "manam",
+  "komanda",
+  "jēzus",
+  "daudzi",
+  "otrā",
+  "vienam",
+  "dodas",
+  "telefonu",
+  "spēli",
+  "rokās",
+  "tādā",
+  "piemēram",
+  "džeks",
+  "gaisā",
+  "kurieni",
+  "jautājumu",
+  "kuģi",
+  "tiesības",
+  "dzirdējis",
+  "j",
+  "atrada",
+  "spēles",
+  "izņemot",
+  "stāsts",
+  "ceļa",
+  "t",
+  "gulēt",
+  "nedari",
+  "darbojas",
+  "nekur",
+  "darītu",
+  "paskat",
+  "sākt",
+  "drošībā",
+  "iemesls",
+  "brāli",
+  "pateikšu",
+  "jāzina",
+  "katrs",
+  "paši",
+  "malā",
+  "veicas",
+  "bērnus",
+  "jūties",
+  "meita",
+  "sievieti",
+  "eju",
+  "kāp",
+  "atver",
+  "traks",
+  "suns",
+  "ved",
+  "zelta",
+  "lietā",
+  "likās",
+  "kājas",
+  "reizēm",
+  "ļaudis",
+  "patika",
+  "jauno",
+  "skolā",
+  "sajūta",
+  "kļūt",
+  "zvēru",
+  "dienām",
+  "mirkli",
+  "iespējas",
+  "darbā",
+  "lielu",
+  "visur",
+  "džon",
+  "vīri",
+  "policija",
+  "meklēju",
+  "bail",
+  "sāk",
+  "ieradies",
+  "galda",
+  "seju",
+  "visām",
+  "veids",
+  "draudziņ",
+  "brīnišķīgi",
+  "paga",
+  "dievam",
+  "mazāk",
+  "celies",
+  "b",
+  "iedod",
+  "jausmas",
+  "gribēji",
+  "izmanto",
+  "nevajadzētu",
+  "četri",
+  "kapteini",
+  "redz",
+  "kuģis",
+  "sūda",
+  "apsveicu",
+  "sāka",
+  "daļu",
+  "rokā",
+  "nesaki",
+  "stāstu",
+  "uguni",
+  "dārgā",
+  "nepieciešams",
+  "karš",
+  "ziņā",
+  "seko",
+  "teikšu",
+  "ļaujiet",
+  "abiem",
+  "uzreiz",
+  "redzat",
+  "turp",
+  "dažreiz",
+  "parādīt",
+  "dodies",
+  "atbildi",
+  "šādi",
+  "naktī",
+  "mister",
+  "istabā",
+  "parunāt",
+  "negribēju",
+  "labdien",
+  "doktor",
+  "slikts",
+  "ielas",
+  "ceļš",
+  "ģimeni",
+  "tiktu",
+  "pilsētas",
+  "the",
+  "m",
+  "draudzene",
+  "bieži",
+  "jāatrod",
+  "jādodas",
+  "informāciju",
+  "jūtu",
+  "mērķis",
+  "gāja",
+  "bojā",
+  "pagaidām",
+  "met",
+  "tikšanās",
+  "domājis",
+  "kājām",
+  "citas",
+  "arvien",
+  "spēku",
+  "palīdzība",
+  "došos",
+  "manī",
+  "zināms",
+  "mājām",
+  "galvas",
+  "sākas",
+  "gana",
+  "nespēj",
+  "dodamies",
+  "katram",
+  "dēlu",
+  "sākumā",
+  "parādā",
+  "oh",
+  "varēsi",
+  "pretī",
+  "kurus",
+  "klausos",
+  "zēns",
+  "paklau",
+  "zināji",
+  "palīdziet",
+  "tuvāk",
+  "nāvi",
+  "mīlestība",
+  "diemžēl",
+  "ūdeni",
+  "jaunkundz",
+  "atstāt",
+  "skatieties",
+  "nedomā",
+  "vecs",
+  "beigās",
+  "saprati",
+  "jāsaka",
+  "vīrietis",
+  "vis",
+  "pašā",
+  "patiesi",
+  "jaunais",
+  "uzmanies",
+  "divām",
+  "sāku",
+  "skat",
+  "atslēgas",
+  "paskatieties",
+  "meklēt",
+  "zāles",
+  "darīšu",
+  "pēkšņi",
+  "dabū",
+  "turi",
+  "bijāt",
+  "ik",
+  "problēmas",
+  "acīs",
+  "maniem",
+  "grāmatu",
+  "laid",
+  "teiktu",
+  "moz",
+  "pašam",
+  "lietām",
+  "vārdus",
+  "sāp",
+  "virs",
+  "patiesība",
+  "apmēram",
+  "ciet",
+  "mākslas",
+  "bīstami",
+  "pilnībā",
+  "dosimies",
+  "malacis",
+  "esiet",
+  "pilsētu",
+  "vārdi",
+  "auto",
+  "leo",
+  "veidā",
+  "nerunā",
+  "kafiju",
+  "muļķības",
+};
+const uint16_t WA_FREQ_94_RANKS[] = {
+  532, 275, 268, 0, 0, 0, 0, 0, 859, 111, 442, 565, 540, 650, 800, 937,
+  830, 0, 0, 0, 0, 0, 0, 0, 475, 46, 0, 763, 714, 419, 0, 246,
+  0, 0, 0, 203, 0, 0, 0, 693, 0, 0, 0, 0, 0, 0, 832, 857,
+  0, 110, 0, 0, 0, 0, 88, 0, 0, 0, 715, 0, 0, 887, 0, 524,
+  0, 0, 56, 0, 0, 0, 624, 36, 637, 0, 0, 0, 0, 0, 970, 881,
+  509, 0, 716, 0, 0, 0, 726, 0, 0, 503, 0, 0, 928, 0, 0, 0,
+  0, 0, 501, 0, 0, 0, 349, 0, 0, 95, 780, 528, 0, 0, 202, 0,
+  0, 223, 820, 39, 825, 657, 18, 57, 61, 0, 942, 0, 323, 562, 0, 542,
+  0, 0, 0, 765, 0, 29, 0, 0, 0, 439, 0, 0, 0, 83, 102, 0,
+  0, 0, 974, 0, 0, 0, 645, 762, 0, 0, 0, 292, 230, 573, 0, 0,
+  21, 373, 254, 512, 120, 27, 0, 0, 0, 67, 0, 0, 0, 0, 0, 430,
+  371, 82, 402, 0, 925, 408, 838, 979, 0, 0, 0, 0, 75, 0, 0, 0,
+  204, 977, 0, 0, 0, 279, 38, 234, 642, 839, 0, 0, 0, 0, 185, 363,
+  818, 862, 22, 338, 924, 0, 0, 0, 54, 725, 0, 19, 432, 968, 498, 24,
+  351, 982, 0, 0, 172, 754, 0, 0, 0, 355, 587, 0, 0, 0, 0, 0,
+  0, 0, 907, 0, 0, 0, 0, 118, 594, 623, 403, 0, 0, 0, 0, 0,
+  0, 52, 635, 329, 0, 0, 0, 0, 793, 344, 405, 497, 603, 644, 904, 956,
+  960, 983, 694, 49, 134, 504, 654, 987, 9, 414, 915, 0, 0, 175, 764, 0,
+  0, 668, 180, 345, 604, 472, 0, 205, 846, 425, 0, 0, 0, 0, 551, 0,
+  0, 192, 0, 0, 679, 678, 142, 746, 772, 89, 169, 274, 276, 546, 656, 779,
+  0, 0, 0, 343, 0, 0, 0, 0, 0, 0, 0, 553, 0, 0, 125, 0,
+  0, 0, 299, 494, 354, 0, 369, 0, 71, 217, 304, 356, 619, 448, 3, 683,
+  873, 949, 146, 11, 0, 0, 748, 0, 214, 0, 0, 0, 0, 515, 0, 0,
+  0, 336, 0, 316, 63, 73, 241, 585, 0, 975, 377, 0, 0, 0, 0, 383,
+  384, 406, 0, 561, 629, 221, 0, 0, 0, 361, 385, 393, 252, 743, 0, 0,
+  0, 0, 0, 387, 0, 751, 0, 555, 0, 0, 0, 43, 0, 536, 876, 0,
+  0, 307, 462, 0, 0, 0, 0, 522, 315, 0, 0, 0, 0, 0, 0, 0,
+  478, 0, 0, 131, 702, 0, 0, 447, 331, 0, 0, 228, 391, 883, 985, 980,
+  699, 0, 340, 0, 0, 711, 761, 739, 903, 113, 889, 712, 0, 0, 964, 115,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 443, 0, 0, 0,
+  0, 0, 756, 888, 775, 428, 0, 941, 0, 596, 282, 854, 0, 0, 0, 848,
+  939, 0, 165, 0, 0, 0, 87, 976, 817, 898, 0, 0, 781, 263, 0, 0,
+  382, 0, 490, 150, 227, 404, 963, 0, 0, 0, 359, 171, 0, 689, 0, 109,
+  696, 320, 740, 923, 0, 0, 735, 0, 0, 0, 0, 28, 0, 0, 0, 0,
+  0, 198, 0, 770, 0, 0, 0, 0, 17, 436, 178, 519, 643, 959, 0, 333,
+  0, 0, 547, 144, 851, 0, 375, 0, 390, 0, 215, 0, 0, 0, 0, 0,
+  0, 777, 951, 0, 0, 0, 0, 638, 188, 0, 0, 145, 692, 65, 243, 365,
+  930, 581, 0, 0, 0, 0, 0, 0, 653, 0, 705, 0, 62, 669, 0, 212,
+  261, 549, 0, 934, 0, 0, 0, 0, 0, 247, 0, 0, 717, 112, 845, 0,
+  0, 897, 0, 455, 0, 731, 99, 124, 327, 0, 860, 636, 0, 0, 757, 229,
+  0, 0, 0, 0, 70, 0, 0, 0, 593, 0, 0, 0, 0, 0, 0, 750,
+  810, 0, 0, 0, 296, 186, 311, 453, 782, 734, 0, 590, 0, 0, 718, 0,
+  0, 389, 14, 96, 0, 483, 0, 0, 0, 500, 0, 487, 0, 84, 0, 0,
+  225, 0, 0, 467, 0, 648, 0, 154, 0, 156, 0, 0, 0, 0, 7, 91,
+  631, 723, 0, 787, 464, 807, 0, 183, 609, 0, 35, 0, 0, 991, 0, 208,
+  485, 741, 806, 0, 324, 576, 0, 123, 127, 721, 858, 0, 0, 0, 0, 0,
+  0, 226, 0, 0, 269, 861, 0, 0, 0, 690, 357, 0, 729, 249, 0, 564,
+  211, 0, 847, 423, 597, 649, 691, 0, 0, 0, 0, 0, 0, 0, 0, 612,
+  0, 210, 335, 374, 849, 0, 0, 523, 544, 808, 0, 672, 0, 179, 0, 12,
+  783, 0, 317, 957, 473, 992, 508, 0, 218, 100, 0, 0, 298, 0, 0, 0,
+  0, 151, 458, 0, 451, 0, 0, 675, 0, 0, 0, 0, 330, 559, 598, 0,
+  661, 0, 0, 0, 0, 640, 946, 0, 0, 0, 245, 379, 868, 944, 659, 0,
+  892, 441, 0, 0, 823, 0, 413, 0, 0, 955, 409, 0, 0, 68, 0, 0,
+  0, 168, 502, 0, 0, 902, 0, 0, 708, 0, 914, 0, 0, 0, 0, 0,
+  855, 0, 47, 471, 463, 42, 591, 931, 995, 0, 231, 773, 0, 0, 583, 0,
+  0, 0, 0, 378, 0, 0, 181, 852, 0, 121, 44, 454, 981, 0, 627, 647,
+  0, 0, 438, 531, 0, 0, 74, 724, 0, 580, 194, 755, 0, 0, 0, 281,
+  342, 493, 686, 841, 410, 0, 999, 0, 0, 0, 0, 170, 0, 0, 460, 875,
+  0, 0, 0, 222, 0, 0, 747, 0, 0, 0, 138, 0, 0, 0, 736, 910,
+  466, 665, 972, 834, 958, 0, 614, 641, 427, 488, 728, 630, 908, 613, 0, 0,
+  182, 737, 0, 161, 0, 812, 119, 827, 0, 0, 0, 0, 0, 0, 0, 0,
+  916, 213, 0, 259, 920, 996, 291, 954, 0, 0, 518, 0, 0, 0, 760, 0,
+  0, 0, 909, 943, 264, 422, 530, 703, 824, 0, 0, 0, 0, 526, 0, 31,
+  730, 287, 0, 0, 0, 0, 126, 416, 961, 673, 0, 0, 0, 81, 0, 0,
+  0, 0, 477, 0, 919, 0, 190, 602, 0, 0, 0, 209, 0, 257, 364, 0,
+  0, 0, 0, 398, 0, 0, 0, 0, 0, 622, 101, 435, 568, 891, 894, 0,
+  677, 216, 521, 789, 0, 148, 952, 0, 108, 0, 6, 397, 452, 0, 0, 0,
+  984, 0, 0, 0, 520, 0, 37, 0, 0, 0, 0, 535, 239, 167, 2, 484,
+  698, 0, 0, 0, 586, 545, 595, 177, 201, 697, 237, 913, 971, 0, 578, 0,
+  388, 0, 0, 0, 0, 0, 160, 58, 826, 890, 0, 0, 250, 459, 769, 4,
+  129, 813, 652, 831, 78, 0, 511, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  610, 0, 0, 372, 426, 0, 0, 0, 163, 0, 0, 0, 0, 0, 0, 837,
+  0, 556, 611, 0, 0, 0, 199, 671, 0, 822, 0, 0, 0, 662, 0, 0,
+  869, 950, 0, 0, 440, 0, 0, 0, 0, 935, 0, 588, 722, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 173, 626, 0, 0, 537, 0, 0, 0, 420,
+  625, 0, 0, 0, 187, 0, 632, 0, 0, 0, 749, 271, 40, 962, 0, 0,
+  0, 0, 933, 0, 153, 0, 289, 0, 0, 658, 0, 0, 392, 0, 713, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 771, 0, 805, 200,
+  106, 286, 381, 0, 0, 0, 0, 64, 0, 481, 867, 550, 318, 450, 557, 577,
+  969, 360, 297, 0, 0, 569, 0, 0, 0, 0, 0, 0, 0, 444, 575, 864,
+  417, 940, 15, 0, 191, 0, 0, 788, 0, 0, 0, 0, 0, 0, 309, 0,
+  0, 0, 0, 25, 0, 510, 176, 0, 0, 107, 0, 0, 0, 0, 348, 840,
+  843, 0, 0, 0, 506, 814, 0, 633, 525, 768, 0, 0, 386, 797, 0, 424,
+  368, 0, 193, 184, 248, 0, 0, 0, 0, 0, 514, 158, 0, 856, 798, 616,
+  367, 0, 224, 236, 0, 0, 994, 0, 791, 0, 0, 608, 0, 0, 0, 607,
+  821, 312, 720, 936, 0, 0, 0, 0, 829, 0, 0, 103, 0, 0, 802, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 695, 0, 480, 828, 0, 0, 492, 0,
+  0, 0, 0, 206, 135, 0, 0, 143, 990, 0, 0, 0, 0, 0, 0, 60,
+  0, 517, 639, 738, 676, 900, 370, 301, 136, 615, 0, 759, 0, 655, 0, 347,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 620, 0, 322, 0, 0, 0,
+  0, 290, 660, 300, 491, 899, 912, 122, 220, 13, 314, 376, 566, 0, 0, 0,
+  431, 674, 0, 277, 0, 0, 0, 244, 152, 745, 882, 399, 0, 0, 0, 0,
+  219, 90, 534, 727, 0, 0, 0, 0, 0, 445, 0, 0, 421, 0, 0, 86,
+  0, 0, 0, 0, 411, 966, 272, 332, 998, 278, 0, 0, 0, 415, 446, 0,
+  0, 905, 0, 34, 80, 306, 815, 863, 352, 687, 313, 0, 0, 407, 319, 412,
+  945, 0, 0, 0, 0, 0, 1, 801, 0, 189, 0, 0, 0, 235, 0, 0,
+  489, 571, 0, 0, 948, 10, 0, 0, 0, 927, 0, 461, 0, 599, 0, 0,
+  0, 0, 0, 684, 486, 496, 0, 449, 0, 0, 0, 0, 0, 0, 938, 0,
+  308, 664, 0, 51, 700, 437, 809, 753, 0, 710, 0, 733, 932, 196, 0, 0,
+  310, 0, 0, 0, 0, 0, 0, 706, 844, 0, 0, 0, 0, 0, 0, 0,
+  893, 0, 233, 552, 251, 400, 670, 0, 0, 666, 621, 784, 0, 0, 0, 804,
+  0, 0, 302, 0, 0, 0, 0, 0, 978, 0, 72, 0, 325, 353, 538, 157,
+  164, 816, 0, 0, 600, 558, 256, 682, 776, 0, 0, 232, 326, 605, 993, 0,
+  0, 0, 114, 918, 0, 0, 0, 0, 0, 0, 0, 0, 618, 548, 0, 0,
+  0, 0, 465, 240, 305, 93, 350, 758, 0, 0, 0, 0, 667, 965, 0, 0,
+  719, 97, 358, 0, 162, 283, 947, 0, 26, 59, 0, 5, 197, 513, 663, 0,
+  50, 0, 0, 0, 0, 0, 0, 334, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 803, 0, 45, 76, 0, 0, 174, 507, 0, 0, 0, 77, 885, 0,
+  0, 0, 0, 53, 850, 0, 0, 0, 906, 973, 0, 8, 570, 836, 0, 953,
+  0, 0, 0, 0, 0, 0, 0, 986, 0, 0, 429, 539, 0, 0, 0, 0,
+  0, 0, 141, 48, 967, 752, 0, 0, 0, 0, 0, 495, 0, 0, 533, 0,
+  929, 0, 434, 0, 997, 0, 468, 766, 0, 0, 0, 474, 288, 255, 811, 0,
+  23, 139, 921, 0, 0, 0, 0, 32, 116, 149, 280, 328, 0, 778, 0, 16,
+  0, 0, 0, 0, 0, 0, 0, 0, 155, 92, 293, 321, 295, 601, 884, 41,
+  988, 0, 0, 0, 0, 794, 0, 617, 0, 0, 0, 0, 0, 0, 0, 396,
+  572, 896, 926, 270, 0, 560, 606, 767, 0, 0, 574, 0, 872, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 456, 792, 79, 853, 339, 744, 273, 833, 886,
+  543, 819, 563, 479, 685, 704, 871, 877, 901, 688, 0, 0, 0, 0, 0, 0,
+  0, 0, 238, 0, 470, 0, 346, 0, 0, 0, 69, 394, 401, 989, 242, 0,
+  469, 582, 66, 701, 865, 0, 874, 0, 880, 554, 0, 866, 207, 541, 0, 94,
+  0, 589, 0, 0, 285, 922, 294, 1000, 0, 911, 0, 0, 0, 0, 0, 0,
+  341, 0, 651, 55, 117, 195, 527, 265, 680, 785, 0, 0, 895, 0, 262, 0,
+  0, 140, 457, 0, 133, 476, 0, 258, 505, 0, 0, 104, 0, 362, 128, 30,
+  33, 681, 742, 870, 380, 0, 253, 166, 482, 159, 795, 878, 0, 584, 260, 774,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 147, 0, 418, 529, 707, 266, 284,
+  790, 732, 433, 842, 567, 0, 592, 0, 879, 0, 0, 0, 0, 0, 0, 0,
+  796, 628, 0, 337, 579, 0, 85, 303, 366, 786, 132, 137, 499, 799, 835, 709,
+  98, 267, 917, 0, 0, 0, 0, 395, 634, 105, 130, 646, 0, 0, 20, 516,
+};
+
+const char *WA_FREQ_95_TOKENS[] = {
+  "日月逝矣",
+  "歲不我與",
+  "傷其親",
+  "是傷其本",
+  "傷其本",
+  "枝從而亡",
+  "學生坐於下",
+  "智",
+  "仁",
+  "勇",
+  "三者",
+  "天下之達德也",
+  "雕蟲篆刻壯夫不為也",
+  "勿懼虎為敵",
+  "唯懼豕為友",
+  "吾立足当下",
+  "予不得有為於此",
+};
+const uint16_t WA_FREQ_95_RANKS[] = {
+  6, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 11, 0, 0, 0,
+  0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 10,
+  0, 0, 0, 0, 3, 9, 0, 0, 13, 0, 0, 0, 14, 0, 15, 12,
+  0, 0, 0, 1, 0, 0, 17, 0, 7, 0, 0, 0, 0, 0, 4, 2,
+};
+
+const char *WA_FREQ_96_TOKENS[] = {
+  "म",
+  "क",
+  "छ",
+  "न",
+  "धन",
+  "यव",
+  "द",
+  "प",
+  "रण",
+  "अह",
+  "हम",
+  "ठ",
+  "हमर",
+  "ट",
+  "नमस",
+  "र",
+};
+const uint16_t WA_FREQ_96_RANKS[] = {
+  0, 12, 0, 0, 0, 1, 5, 0, 16, 8, 0, 6, 0, 7, 14, 0,
+  0, 0, 2, 3, 11, 0, 4, 15, 0, 0, 0, 0, 9, 10, 13, 0,
+};
+
+const char *WA_FREQ_97_TOKENS[] = {
+  "мархта",
+  "шачема",
+  "шить",
+  "няемозонк",
+  "эрятама",
+  "цебярь",
+  "ошса",
+  "фкя",
+  "кафта",
+  "колма",
+  "ниле",
+  "вете",
+  "кота",
+  "сисем",
+  "кафкса",
+  "вейхкса",
+  "кемонь",
+  "шицень",
+  "кендалхнень",
+  "аш",
+  "пейхть",
+  "кинь",
+  "лангс",
+  "покодят",
+  "бурдж",
+  "халифа",
+  "тяни",
+  "сембода",
+  "оцю",
+  "менелькъргама",
+  "масторъётконь",
+  "авань",
+};
+const uint16_t WA_FREQ_97_RANKS[] = {
+  12, 0, 0, 14, 20, 7, 16, 0, 5, 0, 0, 0, 6, 0, 0, 0,
+  17, 18, 28, 0, 0, 29, 15, 4, 0, 0, 11, 0, 0, 0, 0, 8,
+  30, 0, 24, 27, 0, 0, 10, 23, 0, 0, 0, 0, 19, 0, 2, 21,
+  1, 32, 0, 0, 3, 9, 22, 0, 0, 13, 25, 26, 0, 0, 0, 31,
+};
+
+const char *WA_FREQ_98_TOKENS[] = {
+  "a",
+  "ni",
+  "jen",
+  "da",
+  "nuu",
+  "sa",
+  "vi",
+  "o",
+  "an",
+  "daja",
+  "ka",
+  "tyi",
+  "iyo",
+  "va",
+  "un",
+  "nu",
+  "maa",
+  "i",
+  "dani",
+  "yukuan",
+  "na",
+  "ya",
+  "e",
+  "kuvi",
+  "ntu",
+  "suu",
+  "ini",
+  "de",
+  "nee",
+  "ta",
+  "ɨjɨn",
+  "ñivɨ",
+  "iin",
+  "majan",
+  "axin",
+  "jin",
+  "ñuu",
+  "on",
+  "ji",
+  "ve",
+  "ñu",
+  "ña",
+  "tu",
+  "so",
+  "katyi",
+  "kue",
+  "u",
+  "ntuvi",
+  "sava",
+  "kua",
+  "tiñu",
+  "ne",
+  "suni",
+  "tee",
+  "ja",
+  "koo",
+  "kaa",
+  "daa",
+  "nute",
+  "tun",
+  "en",
+  "tuni",
+  "jini",
+  "yu",
+  "kene",
+  "vii",
+  "jia",
+  "kuatyi",
+  "sukuan",
+  "ke",
+  "yuku",
+  "su",
+  "soma",
+  "ityi",
+  "vitan",
+  "ita",
+  "tan",
+  "naa",
+  "savi",
+  "kumi",
+  "kuni",
+  "no",
+  "viji",
+  "ɨ",
+  "ku",
+  "yaji",
+  "kuaa",
+  "detun",
+  "ki",
+  "satiñu",
+  "to",
+  "nasa",
+  "kaji",
+  "ɨn",
+  "yutun",
+  "in",
+  "ma",
+  "jika",
+  "tyu",
+  "kivɨ",
+  "yaa",
+  "saa",
+  "je",
+  "jɨn",
+  "kuaiyo",
+  "jie",
+  "nkuvi",
+  "kɨ",
+  "tɨɨn",
+  "kanta",
+  "inka",
+  "xini",
+  "niyo",
+  "kitɨ",
+  "sikɨ",
+  "yo",
+  "xita",
+  "ko",
+  "vijin",
+  "nani",
+  "se",
+  "xu",
+  "jo",
+  "viko",
+  "vixin",
+  "tata",
+  "este",
+  "kutu",
+  "neyu",
+  "tuku",
+  "xeen",
+  "taji",
+  "luli",
+  "ti",
+  "tyiji",
+  "yoo",
+  "vaji",
+  "jun",
+  "xiko",
+  "tyinei",
+  "tiuun",
+  "tiempu",
+  "sɨɨn",
+  "kune",
+  "yaku",
+  "kuiya",
+  "jan",
+  "kajie",
+  "nɨ",
+  "kunee",
+  "tii",
+  "teku",
+  "jiaa",
+  "yɨ",
+  "nsa",
+  "nutyi",
+  "nuvi",
+  "kuaan",
+  "iña",
+  "stila",
+  "kuun",
+  "itu",
+  "ju",
+  "nityi",
+  "xine",
+  "suvi",
+  "titɨ",
+  "nkanta",
+  "kuatee",
+  "yɨkɨn",
+  "nika",
+  "nini",
+  "ah",
+  "tatan",
+  "teso",
+  "ntaka",
+  "kusɨɨ",
+  "noo",
+  "uvi",
+  "katie",
+  "tatyi",
+  "nanta",
+  "niko",
+  "yujin",
+  "yuve",
+  "nenu",
+  "iñɨ",
+  "nkajie",
+  "nake",
+  "jɨ",
+  "kueka",
+  "vɨ",
+  "kava",
+  "sikua",
+  "yata",
+  "ii",
+  "nta",
+  "sɨɨ",
+  "mm",
+  "nakani",
+  "nuku",
+  "nti",
+  "nana",
+  "kiji",
+  "nuni",
+  "sukua",
+  "ntañu",
+  "sutyi",
+  "tuvi",
+  "eh",
+  "kukueka",
+  "kunu",
+  "jinu",
+  "tyiso",
+  "kunei",
+  "yatin",
+  "n",
+  "xiin",
+  "soo",
+  "dayoo",
+  "nkene",
+  "tikuitɨ",
+  "sukun",
+  "naka",
+  "nka",
+  "jiso",
+  "ñɨ",
+  "tutu",
+  "kuya",
+  "natyiso",
+  "jiko",
+  "tava",
+  "ntɨɨn",
+  "jianini",
+  "kani",
+  "kini",
+  "kunta",
+  "jiantiñu",
+  "sama",
+  "kuka",
+  "ito",
+  "jiakɨn",
+  "yuu",
+  "koyo",
+  "xi",
+  "uni",
+  "ñe",
+  "te",
+  "natee",
+  "tana",
+  "kinoo",
+  "nsama",
+  "jita",
+  "satatan",
+  "danu",
+  "niva",
+  "kaka",
+  "niyɨ",
+  "tiluu",
+  "sikitɨ",
+  "nejika",
+  "natyu",
+  "natyi",
+  "taan",
+  "ñɨɨ",
+  "nakete",
+  "najiavi",
+  "yɨɨ",
+  "xinikɨ",
+  "kuii",
+  "tyata",
+  "jiani",
+  "nantu",
+  "kanijia",
+  "sani",
+  "tina",
+  "kuee",
+  "lelu",
+  "nakoo",
+  "kuu",
+  "nantiñu",
+  "tikuee",
+  "yoso",
+  "pelikula",
+  "kutyi",
+  "xe",
+  "natɨɨn",
+  "itɨ",
+  "nkoo",
+  "nasɨ",
+  "yatyi",
+  "jitu",
+  "kee",
+  "sikaka",
+  "sɨ",
+  "kajin",
+  "mi",
+  "nku",
+  "jianku",
+  "kumani",
+  "nama",
+  "nava",
+  "tyunaa",
+  "kuijin",
+  "tixin",
+  "yɨkɨ",
+  "tuun",
+  "kuiñɨ",
+  "sivɨ",
+  "ntutyi",
+  "ñaji",
+  "kata",
+  "santu",
+  "li",
+  "nsaa",
+  "yatu",
+  "sikuita",
+  "tyityi",
+  "yavi",
+  "nijin",
+  "ntia",
+  "sute",
+  "kafe",
+  "tyilena",
+  "soko",
+  "niñɨ",
+  "ñama",
+  "ora",
+  "nn",
+  "kuitɨ",
+  "yaka",
+  "tya",
+  "xinañu",
+  "nkanii",
+  "nkinoo",
+  "kuñu",
+  "tiyu",
+  "tuno",
+  "naku",
+  "kokun",
+  "tonii",
+  "ñujien",
+  "nanee",
+  "koso",
+  "kunini",
+  "tivɨ",
+  "ñunkuun",
+  "jiaan",
+  "xa",
+  "anima",
+  "yuvi",
+  "kayu",
+  "nkatyi",
+  "lee",
+  "xina",
+  "kukue",
+  "nkunei",
+  "tyitu",
+  "taka",
+  "siu",
+  "xinaa",
+  "nii",
+  "nakuetu",
+  "nkaa",
+  "kueni",
+  "nsikua",
+  "sana",
+  "nivɨ",
+  "kijin",
+  "la",
+  "kisɨ",
+  "nututu",
+  "nkoyo",
+  "kuenta",
+  "nke",
+  "kana",
+  "kuvijin",
+  "jityi",
+  "naja",
+  "yutyi",
+  "jiñu",
+  "nsikɨ",
+  "yukun",
+  "nkivɨ",
+  "skuela",
+  "tikumi",
+  "dayo",
+  "tiɨkɨn",
+  "kɨɨn",
+  "kuiso",
+  "nijian",
+  "nastutu",
+  "nita",
+  "nikɨn",
+  "kuteku",
+  "kui",
+  "kurusi",
+  "nkuni",
+  "ñejin",
+  "kolo",
+  "tinana",
+  "sikuiko",
+  "ntuni",
+  "nɨɨ",
+  "nixi",
+  "kutatan",
+  "isa",
+  "jiaku",
+  "yoko",
+  "nijia",
+  "tyiyo",
+  "xito",
+  "nkukue",
+  "nakajie",
+  "una",
+  "naskutu",
+  "xii",
+  "nkɨ",
+  "xiyo",
+  "numi",
+  "yakuaa",
+  "kuantiñu",
+  "television",
+  "uva",
+  "ntyi",
+  "nanuku",
+  "ñune",
+  "vatyi",
+  "ñɨvɨ",
+  "nsatiñu",
+  "nkutu",
+  "kakɨn",
+  "s",
+  "yajini",
+  "sanaa",
+  "ɨɨ",
+  "kunaa",
+  "likuañɨ",
+  "kanal",
+  "nsu",
+  "sia",
+  "nkiji",
+  "kuna",
+  "nkaku",
+  "nsiu",
+  "lejo",
+  "kujika",
+  "lava",
+  "netu",
+  "kaxin",
+  "nata",
+  "vasketvol",
+  "nkatie",
+  "nakuvi",
+  "nanii",
+  "ninu",
+  "nkuka",
+  "ixi",
+  "too",
+  "rosa",
+  "kartutyu",
+  "ajan",
+  "isu",
+  "jiasɨ",
+  "lo",
+  "ñankava",
+  "nunuma",
+  "ñanku",
+  "nakunee",
+  "xino",
+  "stutu",
+  "yujii",
+  "kakan",
+  "jikan",
+  "nakasɨ",
+  "selular",
+  "kuta",
+  "kaku",
+  "ñunu",
+  "mmm",
+  "vita",
+  "teyu",
+  "natava",
+  "nkusɨɨ",
+  "ntee",
+  "nko",
+  "tyuvee",
+  "nsuu",
+  "jiavi",
+  "arado",
+  "xixi",
+  "tajia",
+  "komida",
+  "ñani",
+  "sikutyi",
+  "teen",
+  "jianke",
+  "kete",
+  "nakenta",
+  "nɨnuu",
+  "nasaa",
+  "tunkatɨ",
+  "iñu",
+  "nuva",
+  "nteso",
+  "nusu",
+  "kojiñu",
+  "nxine",
+  "kuañɨ",
+  "tosa",
+  "navi",
+  "kaxi",
+  "tyuva",
+  "sikajian",
+  "yukue",
+  "niji",
+  "fevrero",
+  "tutin",
+  "mansana",
+  "ñankunee",
+  "ñanka",
+  "kuviji",
+  "naxine",
+  "nakatyi",
+  "tyilu",
+  "aja",
+  "dajan",
+  "ro",
+  "suku",
+  "xinoo",
+  "nakaa",
+  "nei",
+  "kaan",
+  "tute",
+  "ɨɨn",
+  "guitarra",
+  "nkitɨ",
+  "sukuatyi",
+  "kane",
+  "tyike",
+  "najie",
+  "neka",
+  "sikayu",
+  "palatiyu",
+  "nito",
+  "natu",
+  "sikatyi",
+  "kun",
+  "xukui",
+  "xitin",
+  "lintu",
+  "kunityi",
+  "kinivɨ",
+  "ntika",
+  "tisɨ",
+  "tiete",
+  "sujia",
+  "kuiyo",
+  "mayordomo",
+  "kuno",
+  "kanaji",
+  "nkuta",
+  "jiankɨ",
+  "tyii",
+  "san",
+  "kuku",
+  "kanajin",
+  "nijnuu",
+  "nnn",
+  "tinumi",
+  "ocotepec",
+  "tyuve",
+  "ntaji",
+  "kixin",
+  "vei",
+  "vilu",
+  "jito",
+  "koto",
+  "kuxini",
+  "viernes",
+  "nkuaa",
+  "kuña",
+  "vityi",
+  "jiete",
+  "tyukuan",
+  "nakuiso",
+  "kasɨ",
+  "ñɨñɨ",
+  "nuxi",
+  "ntyu",
+  "tyiku",
+  "gladiola",
+  "vu",
+  "nasɨɨ",
+  "tyile",
+  "tasu",
+  "tiempo",
+  "jiaxin",
+  "nteku",
+  "karru",
+  "ñantiñu",
+  "tekiu",
+  "ntaan",
+  "nkumi",
+  "katu",
+  "nano",
+  "tyikɨ",
+  "kei",
+  "tatu",
+  "satu",
+  "kɨnke",
+  "korrido",
+  "kɨna",
+  "kasun",
+  "tuyujii",
+  "maña",
+  "ijɨn",
+  "es",
+  "yaxi",
+  "asukar",
+  "tuyujia",
+  "saka",
+  "nakua",
+  "kuentu",
+  "notisia",
+  "nas",
+  "neva",
+  "ɨjɨ",
+  "jiaxiin",
+  "jiniñu",
+  "m",
+  "kuili",
+  "sto",
+  "sinko",
+  "xinava",
+  "nkujika",
+  "xinɨ",
+  "noviemvre",
+  "enero",
+  "tityi",
+  "tunta",
+  "tutiin",
+  "sikuitɨ",
+  "ɨh",
+  "kunaka",
+  "kinɨ",
+  "xinatyi",
+  "d",
+  "kusama",
+  "nakumani",
+  "suva",
+  "jiankunee",
+  "semana",
+  "yatun",
+  "panteon",
+  "nakɨ",
+  "tino",
+  "yute",
+  "naña",
+  "naiin",
+  "skuata",
+  "titi",
+  "mii",
+  "travajo",
+  "jiya",
+  "jene",
+  "sikoo",
+  "español",
+  "si",
+  "teya",
+  "skasun",
+  "kunoo",
+  "sikutu",
+  "kartutyo",
+  "nijiaa",
+  "kayɨ",
+  "ñunkuii",
+  "nsuvi",
+  "kutuni",
+  "tiyo",
+  "nenuu",
+  "kenta",
+  "tienda",
+  "nte",
+  "violin",
+  "inuu",
+  "stuvi",
+  "tioo",
+  "jiin",
+  "tanuu",
+  "valon",
+  "nuju",
+  "nkuiso",
+  "nanika",
+  "lii",
+  "musiko",
+  "diavete",
+  "tinuyu",
+  "naxita",
+  "kajia",
+  "kundaa",
+  "tiu",
+  "atole",
+  "maja",
+  "arros",
+  "nsukua",
+  "jee",
+  "klo",
+  "tɨyɨkɨ",
+  "niku",
+  "tinutyi",
+  "sun",
+  "nataji",
+  "ingles",
+  "kanini",
+  "xikɨn",
+  "nikɨ",
+  "kinu",
+  "stuu",
+  "niso",
+  "nkee",
+  "ntii",
+  "pelota",
+  "nukun",
+  "sikana",
+  "kumbia",
+  "son",
+  "minu",
+  "jiankava",
+  "ñuú",
+  "tusuun",
+  "sasikuun",
+  "xituvi",
+  "ntiin",
+  "nikoo",
+  "jengibre",
+  "teta",
+  "tunkaya",
+  "nkani",
+  "xitu",
+  "radiu",
+  "naxiteku",
+  "nkuña",
+  "fuerte",
+  "njia",
+  "nkunoo",
+  "nkunu",
+  "kuxi",
+  "kasa",
+  "taxin",
+  "tasa",
+  "nunu",
+  "axi",
+  "liyo",
+  "jikonuu",
+  "sikaxin",
+  "vatu",
+  "media",
+  "triki",
+  "nuun",
+  "nxinaa",
+  "nujiaa",
+  "marso",
+  "avril",
+  "mayo",
+  "disiembre",
+  "disiemvre",
+  "xitivɨ",
+  "tune",
+  "tunutyi",
+  "tunkitɨ",
+  "jien",
+  "katɨ",
+  "teñu",
+  "santo",
+  "nentañu",
+  "kuva",
+  "yosonikaje",
+  "nixiyu",
+  "kuaty",
+  "niyu",
+  "sukluan",
+  "naá",
+  "yugo",
+  "skuita",
+  "tetuvi",
+  "kute",
+  "toto",
+  "jiaka",
+  "kunejii",
+  "kuajiani",
+  "kuneji",
+  "nkuu",
+  "yakuan",
+  "ntana",
+  "rosario",
+  "nkunuu",
+  "jiakan",
+  "xin",
+  "nɨnkani",
+  "vjɨn",
+  "sexto",
+  "sika",
+  "tikasun",
+  "nasikutyi",
+  "nakaka",
+  "nakoso",
+  "tia",
+  "najia",
+  "ntuu",
+  "xitutu",
+  "moto",
+  "tyityiyo",
+  "tiɨkɨ",
+  "tiku",
+  "yuji",
+  "di",
+  "natiñu",
+  "revoso",
+  "makina",
+  "jiaxi",
+  "ajɨn",
+  "xitun",
+  "kɨnake",
+  "nkuyati",
+  "jeen",
+  "nkukueka",
+  "ñankuun",
+  "nakava",
+  "sikasun",
+  "skitɨ",
+  "luu",
+  "neni",
+  "tunku",
+  "nasikutu",
+  "yola",
+  "palma",
+  "kujia",
+  "ntuku",
+  "xen",
+  "nakusu",
+  "nukue",
+  "kunetu",
+  "najiee",
+  "jiyo",
+  "kuxeen",
+  "kunenu",
+  "yakuin",
+  "venado",
+  "nitakaa",
+  "muñeka",
+  "jiankaa",
+  "tunyavi",
+  "ñuun",
+  "yuva",
+  "ntivɨ",
+  "tama",
+  "nkakɨn",
+  "mañu",
+  "ntutya",
+  "sikee",
+  "kaje",
+  "ntava",
+  "katyio",
+  "kotye",
+  "ntoo",
+  "nsute",
+  "ɨjvn",
+  "tunaa",
+  "nati",
+  "jianuku",
+  "jianu",
+  "xinuvi",
+  "ra",
+  "jiankuiñɨ",
+  "kunda",
+  "kutuva",
+  "ntaa",
+  "kunikɨn",
+  "uxi",
+  "le",
+  "tisu",
+  "kunijin",
+  "limu",
+  "nunaa",
+  "sindiko",
+  "kukanuu",
+  "tiaan",
+  "ntyinu",
+  "servisio",
+  "koko",
+  "nasta",
+  "yukuatyi",
+  "jinee",
+  "stansia",
+  "ykuan",
+  "sikunu",
+  "ty",
+  "situ",
+  "ama",
+  "kin",
+  "pan",
+  "dia",
+  "nasukun",
+  "kenei",
+  "sikaku",
+  "tyji",
+  "nastaa",
+  "luti",
+  "tikutyi",
+  "nkukuee",
+  "nanɨ",
+  "stee",
+  "kuanta",
+  "jianake",
+  "nkayu",
+  "diaa",
+  "tonini",
+  "tonkuaa",
+  "kujiñu",
+  "respeto",
+  "vo",
+  "tɨɨ",
+  "jiku",
+  "anjin",
+  "nkaka",
+  "jii",
+  "tinikɨn",
+  "kasuela",
+  "jiasɨɨ",
+  "unidos",
+  "tuini",
+  "nañu",
+  "ao",
+  "siuu",
+  "natata",
+  "tunee",
+  "agapando",
+  "jianɨ",
+  "kiku",
+  "kuate",
+  "mulinu",
+  "hachi",
+  "serie",
+  "jianka",
+  "ñuva",
+  "sini",
+  "tutii",
+  "altar",
+  "kuina",
+  "tayi",
+  "nai",
+  "yani",
+  "tajan",
+  "voleibol",
+  "basketvol",
+  "vatyo",
+  "kukatie",
+  "neyɨ",
+  "staka",
+  "tunkatɨɨ",
+  "xinikoo",
+  "mantañu",
+  "sukava",
+  "vara",
+  "kusi",
+  "tunavi",
+  "nkusi",
+  "tyiyu",
+  "jiatu",
+  "tunkaa",
+  "kaxe",
+  "iñn",
+  "kimu",
+  "tuntiñɨ",
+  "erida",
+  "kɨnaka",
+  "jatyi",
+  "nkinivɨ",
+  "kusikɨ",
+  "nateso",
+  "nusɨɨ",
+  "nasia",
+  "estasion",
+  "netee",
+  "ññuu",
+  "is",
+  "virgen",
+  "inmaculada",
+  "iti",
+  "sanee",
+  "nasatiñu",
+  "anu",
+  "nukú",
+  "ñankɨɨn",
+  "kujiaa",
+  "ɨs",
+  "natañu",
+  "viyo",
+  "kutee",
+};
+const uint16_t WA_FREQ_98_RANKS[] = {
+  63, 0, 537, 0, 579, 270, 456, 562, 0, 0, 320, 25, 892, 0, 0, 0,
+  0, 0, 662, 932, 0, 853, 0, 586, 970, 635, 0, 193, 403, 671, 787, 394,
+  997, 0, 806, 0, 181, 0, 0, 0, 513, 115, 328, 0, 995, 0, 648, 774,
+  0, 0, 0, 0, 766, 687, 57, 67, 0, 0, 0, 0, 259, 0, 357, 0,
+  0, 0, 517, 0, 0, 0, 998, 332, 0, 0, 972, 0, 0, 0, 421, 454,
+  218, 485, 956, 0, 0, 0, 0, 364, 574, 0, 0, 0, 915, 293, 0, 882,
+  296, 701, 476, 985, 703, 0, 345, 0, 0, 0, 0, 244, 0, 0, 700, 893,
+  384, 0, 0, 0, 137, 698, 0, 0, 0, 606, 256, 98, 0, 0, 0, 0,
+  0, 0, 0, 0, 54, 221, 420, 0, 481, 0, 0, 719, 0, 0, 0, 963,
+  0, 577, 646, 268, 923, 880, 324, 0, 112, 0, 0, 0, 424, 638, 0, 0,
+  0, 0, 0, 0, 39, 0, 0, 279, 404, 407, 730, 877, 0, 0, 0, 0,
+  0, 539, 237, 100, 113, 46, 397, 458, 210, 738, 757, 857, 0, 0, 852, 0,
+  0, 843, 0, 0, 0, 718, 337, 0, 0, 0, 0, 0, 388, 0, 0, 605,
+  0, 0, 0, 0, 171, 0, 0, 0, 0, 0, 644, 0, 49, 694, 0, 292,
+  313, 523, 716, 0, 0, 0, 0, 0, 0, 931, 954, 321, 0, 69, 198, 200,
+  0, 0, 186, 689, 960, 0, 518, 0, 971, 0, 0, 0, 0, 859, 0, 0,
+  0, 248, 325, 355, 536, 128, 0, 511, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 78, 0, 0, 0, 0, 0, 0, 60, 0, 945,
+  0, 0, 0, 0, 77, 393, 0, 0, 818, 214, 0, 0, 0, 0, 749, 208,
+  959, 0, 796, 72, 431, 540, 223, 486, 86, 842, 0, 0, 0, 0, 260, 354,
+  819, 0, 0, 803, 0, 338, 0, 0, 383, 0, 0, 731, 0, 0, 763, 0,
+  0, 142, 0, 0, 861, 0, 0, 0, 0, 0, 990, 0, 0, 909, 43, 377,
+  566, 503, 889, 0, 0, 987, 0, 653, 780, 34, 110, 820, 0, 0, 786, 282,
+  751, 0, 0, 0, 105, 545, 0, 600, 233, 0, 0, 41, 0, 0, 301, 0,
+  0, 109, 614, 204, 0, 0, 0, 0, 0, 0, 387, 884, 0, 0, 0, 944,
+  0, 0, 0, 0, 934, 0, 0, 0, 988, 0, 362, 0, 674, 888, 0, 0,
+  0, 0, 375, 886, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 488,
+  0, 949, 0, 1, 131, 495, 628, 144, 174, 659, 0, 3, 0, 0, 777, 0,
+  0, 455, 0, 428, 596, 475, 551, 693, 0, 176, 0, 0, 732, 0, 0, 0,
+  793, 0, 0, 0, 226, 0, 0, 0, 151, 792, 681, 625, 0, 286, 0, 0,
+  405, 0, 802, 316, 363, 0, 216, 0, 0, 0, 156, 0, 0, 408, 845, 45,
+  390, 0, 202, 0, 873, 906, 0, 0, 0, 0, 461, 0, 608, 0, 0, 592,
+  879, 0, 0, 275, 290, 900, 0, 0, 555, 613, 336, 0, 0, 0, 0, 494,
+  0, 676, 781, 0, 0, 564, 0, 179, 0, 0, 0, 55, 136, 0, 0, 0,
+  294, 0, 0, 0, 207, 506, 563, 609, 0, 658, 0, 663, 0, 0, 0, 0,
+  29, 0, 0, 640, 111, 416, 871, 642, 0, 258, 0, 0, 0, 0, 436, 0,
+  342, 691, 742, 0, 124, 0, 0, 0, 0, 759, 0, 0, 0, 936, 252, 217,
+  262, 177, 409, 580, 595, 918, 0, 869, 0, 543, 0, 0, 0, 0, 160, 235,
+  639, 844, 13, 243, 964, 389, 251, 926, 305, 178, 715, 0, 0, 685, 0, 947,
+  0, 483, 0, 0, 0, 308, 702, 232, 150, 254, 0, 148, 571, 373, 487, 585,
+  623, 914, 0, 0, 306, 559, 0, 0, 575, 0, 281, 696, 0, 0, 0, 0,
+  660, 0, 0, 0, 361, 0, 522, 624, 833, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 611, 21, 0, 0, 0, 0, 0, 930, 157, 134, 560, 664, 51,
+  789, 410, 626, 87, 645, 0, 0, 785, 0, 0, 447, 0, 0, 654, 0, 0,
+  0, 805, 0, 0, 0, 865, 0, 0, 0, 0, 398, 0, 0, 0, 14, 593,
+  0, 0, 0, 0, 0, 0, 0, 772, 185, 0, 677, 0, 245, 891, 0, 0,
+  837, 0, 615, 295, 0, 0, 0, 0, 0, 170, 395, 469, 794, 0, 651, 717,
+  0, 0, 590, 435, 81, 508, 0, 0, 0, 0, 396, 982, 0, 0, 0, 874,
+  0, 0, 0, 0, 0, 514, 0, 0, 215, 399, 166, 0, 0, 821, 0, 0,
+  0, 0, 804, 138, 414, 470, 656, 0, 525, 548, 667, 876, 0, 0, 0, 0,
+  0, 8, 817, 0, 598, 0, 280, 0, 0, 0, 630, 866, 570, 0, 117, 0,
+  184, 465, 0, 0, 0, 274, 194, 0, 0, 0, 466, 778, 0, 0, 367, 0,
+  141, 206, 594, 484, 933, 331, 147, 558, 831, 0, 0, 0, 7, 20, 351, 684,
+  969, 602, 0, 832, 929, 0, 0, 40, 0, 0, 0, 0, 83, 937, 0, 0,
+  33, 0, 16, 0, 0, 0, 103, 902, 0, 0, 739, 73, 526, 940, 18, 0,
+  0, 0, 770, 0, 0, 191, 0, 734, 264, 0, 0, 89, 0, 0, 437, 529,
+  790, 0, 668, 814, 0, 287, 0, 0, 453, 0, 887, 744, 62, 680, 401, 391,
+  446, 64, 813, 647, 9, 471, 10, 155, 450, 228, 490, 149, 661, 826, 854, 897,
+  946, 768, 498, 0, 0, 0, 0, 0, 0, 0, 0, 0, 868, 0, 0, 0,
+  242, 451, 544, 381, 0, 0, 0, 0, 0, 0, 0, 302, 0, 0, 0, 0,
+  0, 402, 0, 975, 872, 130, 319, 847, 0, 0, 0, 0, 0, 239, 601, 0,
+  0, 0, 569, 729, 870, 127, 921, 434, 441, 977, 0, 58, 825, 0, 0, 0,
+  169, 0, 30, 353, 378, 578, 828, 957, 26, 0, 810, 767, 0, 0, 0, 0,
+  0, 899, 500, 341, 756, 860, 649, 0, 875, 50, 0, 0, 0, 449, 0, 0,
+  0, 0, 0, 344, 0, 0, 114, 773, 863, 895, 0, 0, 779, 0, 0, 0,
+  510, 369, 849, 0, 0, 0, 0, 0, 0, 330, 153, 433, 219, 304, 549, 726,
+  0, 0, 0, 132, 0, 619, 0, 705, 812, 996, 11, 0, 0, 808, 267, 400,
+  0, 0, 0, 535, 910, 249, 52, 0, 0, 0, 0, 314, 0, 0, 618, 491,
+  0, 515, 750, 334, 230, 366, 0, 0, 0, 942, 187, 443, 0, 0, 276, 898,
+  0, 360, 0, 0, 0, 312, 442, 530, 229, 413, 683, 746, 0, 0, 0, 15,
+  0, 0, 0, 0, 669, 798, 0, 797, 0, 0, 425, 0, 0, 71, 255, 999,
+  0, 0, 0, 289, 0, 591, 0, 516, 0, 0, 452, 583, 697, 288, 371, 56,
+  173, 501, 740, 829, 919, 429, 106, 339, 603, 754, 974, 994, 0, 992, 263, 753,
+  326, 459, 139, 546, 80, 629, 984, 547, 68, 896, 0, 28, 0, 0, 908, 531,
+  0, 199, 271, 224, 816, 556, 0, 348, 0, 0, 0, 44, 823, 0, 0, 333,
+  541, 0, 0, 0, 12, 720, 741, 445, 463, 686, 725, 723, 0, 0, 0, 167,
+  0, 0, 632, 386, 752, 0, 0, 0, 0, 0, 724, 0, 620, 323, 499, 0,
+  920, 0, 0, 0, 0, 126, 76, 467, 482, 791, 0, 657, 0, 0, 0, 712,
+  0, 643, 0, 0, 0, 0, 0, 0, 0, 0, 675, 0, 0, 0, 231, 748,
+  0, 438, 827, 478, 587, 5, 0, 0, 0, 104, 0, 572, 97, 0, 0, 0,
+  824, 745, 0, 0, 32, 427, 164, 66, 0, 0, 0, 0, 0, 53, 851, 512,
+  0, 0, 146, 350, 477, 125, 616, 0, 212, 385, 665, 0, 347, 905, 0, 211,
+  0, 261, 0, 0, 0, 0, 42, 637, 172, 0, 0, 349, 0, 0, 0, 236,
+  807, 917, 0, 0, 0, 0, 760, 0, 0, 0, 0, 0, 0, 0, 0, 183,
+  0, 0, 0, 0, 273, 728, 0, 0, 0, 0, 0, 0, 0, 0, 265, 0,
+  6, 776, 0, 0, 0, 0, 783, 85, 489, 0, 0, 0, 885, 0, 220, 492,
+  246, 617, 784, 673, 496, 0, 0, 0, 0, 120, 0, 761, 0, 0, 0, 0,
+  0, 799, 0, 444, 0, 864, 0, 0, 340, 266, 0, 352, 883, 257, 0, 505,
+  519, 682, 182, 989, 19, 727, 809, 939, 557, 0, 159, 0, 291, 758, 0, 0,
+  0, 283, 878, 0, 0, 0, 0, 0, 417, 0, 0, 0, 0, 0, 0, 0,
+  0, 480, 0, 240, 379, 631, 855, 0, 0, 542, 0, 0, 272, 468, 504, 0,
+  47, 0, 0, 0, 225, 0, 0, 297, 961, 0, 0, 0, 0, 0, 0, 0,
+  597, 0, 0, 0, 0, 699, 690, 856, 0, 0, 0, 0, 704, 911, 365, 0,
+  0, 928, 0, 432, 329, 747, 836, 0, 0, 479, 0, 0, 0, 0, 527, 714,
+  122, 241, 800, 599, 303, 422, 858, 0, 318, 0, 0, 0, 161, 782, 0, 0,
+  335, 986, 189, 0, 636, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  152, 834, 415, 952, 473, 118, 195, 419, 0, 0, 0, 133, 765, 0, 0, 841,
+  0, 0, 0, 534, 573, 0, 0, 713, 0, 0, 411, 0, 35, 567, 474, 890,
+  924, 95, 0, 0, 423, 343, 0, 0, 222, 0, 0, 688, 811, 610, 0, 0,
+  0, 315, 0, 775, 993, 0, 0, 0, 0, 0, 0, 84, 0, 0, 0, 966,
+  0, 0, 0, 0, 460, 633, 991, 867, 234, 188, 0, 0, 0, 119, 552, 976,
+  0, 735, 953, 310, 0, 0, 0, 0, 554, 955, 0, 93, 0, 0, 121, 743,
+  0, 762, 524, 788, 0, 309, 983, 0, 903, 528, 0, 709, 981, 0, 158, 0,
+  0, 881, 0, 23, 641, 0, 0, 0, 862, 968, 0, 0, 0, 0, 0, 0,
+  75, 299, 101, 958, 0, 0, 380, 0, 307, 0, 497, 406, 0, 0, 0, 925,
+  0, 951, 0, 582, 0, 0, 165, 904, 197, 0, 0, 0, 0, 938, 0, 733,
+  0, 0, 965, 0, 0, 0, 0, 0, 0, 672, 17, 0, 839, 0, 79, 0,
+  0, 737, 0, 0, 0, 123, 440, 607, 764, 201, 278, 822, 584, 0, 180, 250,
+  0, 192, 0, 621, 0, 0, 0, 830, 0, 0, 0, 91, 269, 31, 175, 650,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1000, 0, 24, 0, 0, 190, 0,
+  0, 382, 980, 317, 0, 22, 0, 655, 0, 0, 0, 0, 0, 0, 298, 327,
+  846, 61, 0, 0, 581, 0, 0, 0, 412, 0, 722, 203, 0, 532, 59, 392,
+  88, 0, 0, 0, 0, 346, 0, 0, 0, 0, 0, 253, 0, 670, 0, 801,
+  568, 0, 322, 840, 116, 129, 0, 979, 0, 2, 795, 143, 912, 38, 948, 464,
+  589, 771, 0, 90, 209, 300, 0, 941, 710, 0, 0, 0, 462, 967, 521, 0,
+  0, 0, 0, 0, 0, 0, 0, 835, 916, 0, 0, 0, 0, 0, 0, 372,
+  0, 0, 706, 145, 205, 943, 0, 358, 0, 0, 472, 907, 0, 0, 0, 0,
+  894, 950, 0, 553, 0, 0, 227, 588, 0, 0, 0, 962, 0, 0, 0, 0,
+  0, 0, 848, 0, 0, 913, 359, 0, 0, 769, 27, 37, 311, 48, 679, 652,
+  755, 277, 935, 978, 0, 0, 0, 0, 0, 0, 370, 634, 4, 0, 0, 0,
+  0, 92, 627, 0, 0, 0, 36, 163, 707, 850, 0, 0, 0, 0, 507, 708,
+  0, 168, 368, 0, 107, 0, 213, 622, 140, 509, 561, 711, 0, 162, 0, 0,
+  0, 0, 135, 0, 0, 533, 0, 0, 0, 0, 96, 448, 0, 418, 721, 922,
+  284, 666, 102, 70, 0, 154, 0, 356, 65, 74, 565, 604, 0, 238, 927, 0,
+  0, 815, 0, 0, 439, 0, 0, 0, 0, 108, 196, 973, 0, 0, 0, 426,
+  457, 736, 0, 0, 520, 374, 0, 0, 0, 0, 493, 0, 576, 838, 0, 376,
+  901, 0, 0, 0, 692, 0, 0, 0, 285, 0, 99, 502, 612, 0, 94, 678,
+  0, 0, 0, 0, 0, 550, 0, 247, 430, 0, 538, 695, 0, 0, 82, 0,
+};
+
+const char *WA_FREQ_99_TOKENS[] = {
+  "wak",
+  "bak",
+  "a",
+  "gak",
+  "kou",
+  "ji",
+  "bei",
+  "akou",
+  "telou",
+  "kena",
+  "mun",
+  "dagen",
+  "tan",
+  "yen",
+  "ajau",
+  "telo",
+  "sebab",
+  "itou",
+  "melou",
+  "diyak",
+  "ien",
+  "angai",
+  "inou",
+  "pisak",
+  "idak",
+  "jegem",
+  "iyen",
+  "lah",
+  "un",
+  "ito",
+  "suka",
+  "paling",
+  "kawak",
+  "liko",
+  "siyen",
+  "atau",
+  "likou",
+  "subet",
+  "pebak",
+  "agei",
+  "ngak",
+  "selalu",
+  "masa",
+  "loyen",
+  "mapun",
+  "jadi",
+  "yenlah",
+  "melo",
+  "sama",
+  "cara",
+  "lau",
+  "da",
+  "senuka",
+  "aneak",
+  "debei",
+  "ienlah",
+  "jegum",
+  "nda",
+  "bila",
+  "sekul",
+  "pasel",
+  "adalah",
+  "serita",
+  "supaya",
+  "keman",
+  "kerja",
+  "kuman",
+  "takan",
+  "telepon",
+  "iyenlah",
+  "tapi",
+  "sakai",
+  "kaau",
+  "ataupun",
+  "pun",
+  "bahasa",
+  "diak",
+  "duwit",
+  "den",
+  "susah",
+  "yian",
+  "ujan",
+  "ndabei",
+  "tuneh",
+  "kek",
+  "melanau",
+  "ino",
+  "musim",
+  "anek",
+  "isak",
+  "lebok",
+  "pegui",
+  "teknoloji",
+  "belajer",
+  "agai",
+  "masyarakat",
+  "sien",
+  "negara",
+  "lahabei",
+  "rasa",
+  "laei",
+  "sukan",
+  "lok",
+  "memang",
+  "ngadan",
+  "sentiasa",
+  "teknologi",
+  "serta",
+  "sibet",
+  "nou",
+  "warna",
+  "sejarah",
+  "masem",
+  "bangsa",
+  "dabei",
+  "aku",
+  "akan",
+  "keluarga",
+  "mana",
+  "kadeng",
+  "puon",
+  "badan",
+  "jelau",
+  "penyakit",
+  "kak",
+  "loyien",
+  "wakkan",
+  "kah",
+  "lagu",
+  "nebak",
+  "semua",
+  "unclear",
+  "bisnes",
+  "bank",
+  "perlu",
+  "makau",
+  "sabei",
+  "lalu",
+  "jahak",
+  "mesti",
+  "tina",
+  "pasal",
+  "baih",
+  "paa",
+  "aa",
+  "jalak",
+  "tudip",
+  "sai",
+  "madak",
+  "bukan",
+  "pidok",
+  "taao",
+  "bagi",
+  "ai",
+  "penting",
+  "bulan",
+  "taou",
+  "lebeh",
+  "sebap",
+  "lo",
+  "noise",
+  "jegam",
+  "mudei",
+  "lubeang",
+  "macem",
+  "masarakat",
+  "bayar",
+  "seneng",
+  "kenaan",
+  "dana",
+  "debai",
+  "tama",
+  "nisak",
+  "taau",
+  "eh",
+  "kan",
+  "dan",
+  "gaan",
+  "musik",
+  "neh",
+  "ako",
+  "doktor",
+  "macam",
+  "berubah",
+  "iklim",
+  "senang",
+  "menjaga",
+  "buwak",
+  "cuaca",
+  "budaya",
+  "buyak",
+  "asel",
+  "sihat",
+  "ba",
+  "matai",
+  "dua",
+  "nyat",
+  "mula",
+  "biasa",
+  "menaah",
+  "bah",
+  "tapak",
+  "tuu",
+  "bunga",
+  "geji",
+  "aaa",
+  "matek",
+  "mahou",
+  "sungai",
+  "terutama",
+  "deloyien",
+  "cikgu",
+  "online",
+  "deloyen",
+  "samalah",
+  "lakei",
+  "pigek",
+  "sendirik",
+  "mudak",
+  "umit",
+  "kira",
+  "tuhan",
+  "telabau",
+  "lebih",
+  "an",
+  "betul",
+  "jumit",
+  "cerita",
+  "yang",
+  "jekan",
+  "jalan",
+  "ko",
+  "menulung",
+  "keadaan",
+  "japah",
+  "au",
+  "kesihatan",
+  "ubat",
+  "not",
+  "menuluong",
+  "pejaja",
+  "muzik",
+  "malaysia",
+  "pimun",
+  "pala",
+  "duit",
+  "barang",
+  "balau",
+  "langit",
+  "awan",
+  "tenawan",
+  "min",
+  "seni",
+  "taun",
+  "tarian",
+  "kapuong",
+  "untuk",
+  "ayeng",
+  "benateang",
+  "yau",
+  "kereja",
+  "aktiviti",
+  "pernah",
+  "krismas",
+  "cita",
+  "kutan",
+  "sebenarnya",
+  "pesta",
+  "melei",
+  "pause",
+  "asin",
+  "cuti",
+  "clear",
+  "udipan",
+  "aneng",
+  "bol",
+  "adep",
+  "aniek",
+  "g",
+  "berapa",
+  "gian",
+  "antara",
+  "koulah",
+  "kerajaan",
+  "sepaya",
+  "bisness",
+  "lasuk",
+  "udei",
+  "pikiran",
+  "imun",
+  "laie",
+  "bareng",
+  "lubeng",
+  "sapai",
+  "mengundi",
+  "madou",
+  "kadang",
+  "ataupuun",
+  "pinyeang",
+  "kebajikan",
+  "nasihat",
+  "negui",
+  "sereta",
+  "menaban",
+  "liyan",
+  "adet",
+  "asou",
+  "biruk",
+  "belajar",
+  "mengajer",
+  "henpon",
+  "sawa",
+  "satu",
+  "peden",
+  "soalan",
+  "serangga",
+  "apabila",
+  "sarawak",
+  "umik",
+  "aan",
+  "kapoung",
+  "tiap",
+  "naseng",
+  "hobi",
+  "buk",
+  "nyadin",
+  "yianlah",
+  "tao",
+  "kinan",
+  "contoh",
+  "masalah",
+  "masaraket",
+  "puun",
+  "program",
+  "mengajar",
+  "nimen",
+  "di",
+  "baau",
+  "keretak",
+  "kad",
+  "tuwon",
+  "saudara",
+  "pindah",
+  "tradisional",
+  "laju",
+  "saji",
+  "sayur",
+  "pengalaman",
+  "kasihatan",
+  "lai",
+  "sieng",
+  "skil",
+  "telipon",
+  "handpon",
+  "belaku",
+  "selalunya",
+  "mak",
+  "siew",
+  "putih",
+  "bau",
+  "en",
+  "tibou",
+  "nimun",
+  "mara",
+  "segak",
+  "jelawaih",
+  "cabaran",
+  "hal",
+  "daripada",
+  "bahagian",
+  "pedeh",
+  "mestilah",
+  "gaya",
+  "ialah",
+  "sukup",
+  "unlah",
+  "pulek",
+  "artis",
+  "biteang",
+  "hanpon",
+  "tentu",
+  "tau",
+  "giyen",
+  "biasanya",
+  "beilah",
+  "memeng",
+  "maju",
+  "mejaga",
+  "pedengah",
+  "maseraket",
+  "umai",
+  "beh",
+  "usul",
+  "komputer",
+  "lou",
+  "alat",
+  "secara",
+  "itoulah",
+  "lasuok",
+  "daat",
+  "ngan",
+  "bilem",
+  "too",
+  "soft",
+  "manusia",
+  "ic",
+  "pikir",
+  "eno",
+  "peserita",
+  "ayen",
+  "payah",
+  "ginan",
+  "berkumpulan",
+  "rayak",
+  "mukah",
+  "tugau",
+  "acara",
+  "suwab",
+  "najer",
+  "teniman",
+  "sabjek",
+  "mudah",
+  "napun",
+  "perelu",
+  "hasil",
+  "and",
+  "ja",
+  "lima",
+  "paspot",
+  "luwer",
+  "abei",
+  "biyasa",
+  "relek",
+  "jawok",
+  "tokoh",
+  "buyen",
+  "suci",
+  "onlaen",
+  "pandai",
+  "apa",
+  "dunia",
+  "sekali",
+  "tou",
+  "giaan",
+  "ok",
+  "yeh",
+  "bawai",
+  "kaul",
+  "nidok",
+  "tetapi",
+  "udip",
+  "sikap",
+  "gui",
+  "kuji",
+  "janek",
+  "tutui",
+  "memin",
+  "gidei",
+  "bup",
+  "asal",
+  "senaman",
+  "berjaya",
+  "pendidikan",
+  "bil",
+  "kawa",
+  "seperti",
+  "ndalah",
+  "tuo",
+  "jawai",
+  "kala",
+  "menulih",
+  "memajukan",
+  "luar",
+  "sistem",
+  "sebelum",
+  "dirik",
+  "keluwerga",
+  "mungkin",
+  "umur",
+  "apuk",
+  "bajou",
+  "kedai",
+  "lian",
+  "guruk",
+  "iban",
+  "laen",
+  "watir",
+  "kredit",
+  "jenis",
+  "jaga",
+  "siaw",
+  "sapek",
+  "segala",
+  "gitou",
+  "pinyeng",
+  "tanggungjawab",
+  "kenereja",
+  "kehidupan",
+  "peritah",
+  "jabatan",
+  "perkhidmatan",
+  "bilun",
+  "siban",
+  "kayou",
+  "jed",
+  "tuun",
+  "apah",
+  "mentor",
+  "salui",
+  "menari",
+  "motosikal",
+  "rumah",
+  "temujanji",
+  "line",
+  "ke",
+  "pegawai",
+  "dalam",
+  "kawasan",
+  "nyam",
+  "kualiti",
+  "masieng",
+  "memudahkan",
+  "doloyen",
+  "walaupun",
+  "minou",
+  "baou",
+  "jawuk",
+  "ulem",
+  "tv",
+  "lawyer",
+  "kereta",
+  "keritak",
+  "skul",
+  "tiyap",
+  "makin",
+  "tanda",
+  "kenasusou",
+  "diyem",
+  "aman",
+  "modal",
+  "kei",
+  "kuwatir",
+  "hospital",
+  "pedih",
+  "nyaam",
+  "yb",
+  "nasang",
+  "daun",
+  "music",
+  "awam",
+  "servis",
+  "memerlukan",
+  "memulakan",
+  "rapet",
+  "menolong",
+  "kawin",
+  "mata",
+  "sebieng",
+  "duwa",
+  "tukang",
+  "jumek",
+  "menyedia",
+  "umek",
+  "tipou",
+  "pebiyah",
+  "kuching",
+  "matematik",
+  "belagu",
+  "suti",
+  "raun",
+  "medipeh",
+  "bidang",
+  "data",
+  "keja",
+  "menipu",
+  "dengan",
+  "terpaksa",
+  "so",
+  "dengah",
+  "masin",
+  "sehat",
+  "gejilah",
+  "emm",
+  "babui",
+  "memesei",
+  "adikakak",
+  "kemajuan",
+  "business",
+  "malem",
+  "alam",
+  "filem",
+  "duniya",
+  "moden",
+  "cukup",
+  "stabil",
+  "guna",
+  "metoh",
+  "keji",
+  "tahun",
+  "masuok",
+  "lain",
+  "dibak",
+  "cuma",
+  "pejuah",
+  "betemu",
+  "meriyah",
+  "kina",
+  "miyau",
+  "game",
+  "pelajaran",
+  "kepentingan",
+  "test",
+  "handphone",
+  "mahal",
+  "lawuih",
+  "nyin",
+  "berlaku",
+  "wakan",
+  "sekala",
+  "siyau",
+  "tuwun",
+  "ayeang",
+  "benateng",
+  "projek",
+  "deloien",
+  "rakyat",
+  "inoukah",
+  "nyadi",
+  "melayu",
+  "sound",
+  "taah",
+  "kenalah",
+  "keluwarga",
+  "tengah",
+  "dari",
+  "pesapur",
+  "salak",
+  "kompiuta",
+  "mengikut",
+  "hanya",
+  "diri",
+  "zaman",
+  "sei",
+  "neng",
+  "dikakak",
+  "janeak",
+  "sou",
+  "ah",
+  "ajaulah",
+  "werena",
+  "pisek",
+  "resiko",
+  "kerna",
+  "menambah",
+  "betan",
+  "bangga",
+  "ilmu",
+  "damai",
+  "semuwa",
+  "kamei",
+  "batui",
+  "pelakon",
+  "gerija",
+  "oleh",
+  "dalah",
+  "membawen",
+  "pinyieng",
+  "membaca",
+  "ikan",
+  "gurieng",
+  "tuteng",
+  "nyaem",
+  "sek",
+  "jilah",
+  "inget",
+  "memikir",
+  "subat",
+  "nerasa",
+  "ka",
+  "baruk",
+  "nigek",
+  "alak",
+  "kakeang",
+  "apak",
+  "sayuor",
+  "limau",
+  "biyasanya",
+  "umor",
+  "kelou",
+  "baaw",
+  "em",
+  "mengait",
+  "jinih",
+  "urusan",
+  "faham",
+  "baliek",
+  "megajer",
+  "kenerja",
+  "gereja",
+  "taon",
+  "adat",
+  "ataupuon",
+  "ramai",
+  "kes",
+  "tetep",
+  "kalai",
+  "piyeang",
+  "wasiek",
+  "miweak",
+  "berkomunikasi",
+  "nebangga",
+  "kenataou",
+  "jauh",
+  "pahem",
+  "belubak",
+  "pusok",
+  "lalai",
+  "tiba",
+  "nobor",
+  "meloulah",
+  "akoulah",
+  "makanan",
+  "temih",
+  "lasouk",
+  "pabila",
+  "seronok",
+  "biru",
+  "mengatur",
+  "bengsa",
+  "kudok",
+  "siek",
+  "buyun",
+  "jenaka",
+  "sebareng",
+  "reti",
+  "video",
+  "nejuwah",
+  "sangat",
+  "hidup",
+  "alah",
+  "peluen",
+  "pihak",
+  "bersama",
+  "membayar",
+  "surat",
+  "raya",
+  "kubeji",
+  "kuba",
+  "bateng",
+  "kelo",
+  "jepun",
+  "debeilah",
+  "ahli",
+  "jam",
+  "menulong",
+  "minda",
+  "perasaan",
+  "tulung",
+  "memerlu",
+  "mempengaruhi",
+  "menyabek",
+  "anang",
+  "tun",
+  "bebak",
+  "pulik",
+  "piseak",
+  "linut",
+  "pulem",
+  "kiek",
+  "lakau",
+  "peyieng",
+  "loyar",
+  "loya",
+  "manah",
+  "disuka",
+  "pat",
+  "merasa",
+  "eksasaih",
+  "jogging",
+  "hujan",
+  "keluar",
+  "menyukuong",
+  "doyen",
+  "risiko",
+  "memula",
+  "kemajuwan",
+  "subjek",
+  "cash",
+  "nilai",
+  "rekreasi",
+  "menyuwak",
+  "asek",
+  "bintang",
+  "la",
+  "pedegah",
+  "telefon",
+  "kajih",
+  "klinik",
+  "selain",
+  "tak",
+  "pejah",
+  "mapuon",
+  "maksud",
+  "banjir",
+  "loien",
+  "petemu",
+  "pejuwah",
+  "kerana",
+  "boleh",
+  "especially",
+  "sekolah",
+  "kol",
+  "jumik",
+  "adakah",
+  "semasa",
+  "melalui",
+  "getan",
+  "jaman",
+  "opis",
+  "keluwar",
+  "miaw",
+  "badminton",
+  "asil",
+  "pokok",
+  "sedara",
+  "dawek",
+  "manuok",
+  "pimen",
+  "tenang",
+  "ketan",
+  "me",
+  "semanget",
+  "se",
+  "kubaji",
+  "kreatif",
+  "bersukan",
+  "kecuali",
+  "kawul",
+  "lada",
+  "negaleng",
+  "simpel",
+  "merdeka",
+  "masuk",
+  "berjangkit",
+  "kovid",
+  "yin",
+  "sevis",
+  "bereti",
+  "pertama",
+  "nelajer",
+  "tukeng",
+  "muda",
+  "setiyap",
+  "panas",
+  "singoh",
+  "tuhut",
+  "sebiyeang",
+  "famili",
+  "paya",
+  "aneik",
+  "bareang",
+  "sendiri",
+  "tenemu",
+  "pedageng",
+  "skill",
+  "amahou",
+  "kebersihan",
+  "paguong",
+  "sepatutnya",
+  "scammer",
+  "japan",
+  "hati",
+  "kawaklah",
+  "atas",
+  "mebawen",
+  "mada",
+  "cun",
+  "mubat",
+  "pek",
+  "daging",
+  "tanlah",
+  "peniliek",
+  "padak",
+  "mmm",
+  "language",
+  "from",
+  "central",
+  "tim",
+  "menak",
+  "pegoi",
+  "kali",
+  "perogerem",
+  "penikir",
+  "jebah",
+  "walaupuun",
+  "sebagai",
+  "sesuatu",
+  "waktu",
+  "menudip",
+  "padai",
+  "alakei",
+  "lobeng",
+  "luwar",
+  "best",
+  "sawit",
+  "pebunga",
+  "matik",
+  "seluruh",
+  "tuluong",
+  "ada",
+  "jiyen",
+  "belaih",
+  "sekejap",
+  "jelakau",
+  "nama",
+  "pangai",
+  "peluang",
+  "minat",
+  "jujok",
+  "semangat",
+  "penah",
+  "gerenti",
+  "tukeang",
+  "kristian",
+  "begupul",
+  "form",
+  "tujuk",
+  "tetu",
+  "senukakou",
+  "malar",
+  "berita",
+  "kampung",
+  "betukar",
+  "rawon",
+  "korea",
+  "tibi",
+  "sosial",
+  "rindu",
+  "tetap",
+  "geografi",
+  "pesuwak",
+  "laien",
+  "lasu",
+  "lakah",
+  "neguna",
+  "bidan",
+  "seneang",
+  "scam",
+  "idaklah",
+  "judi",
+  "pa",
+  "tenabawen",
+  "ih",
+  "internet",
+  "sup",
+  "wa",
+  "lawatan",
+  "guun",
+  "sukalah",
+  "tasiek",
+  "tudoi",
+  "dawok",
+  "gien",
+  "turun",
+  "penilek",
+  "barulah",
+  "ekonomi",
+  "kaliek",
+  "teladan",
+  "sian",
+  "siyenlah",
+  "transfer",
+  "tablet",
+  "gem",
+  "keluwer",
+  "baju",
+  "membantu",
+  "pengetahuan",
+  "setiap",
+  "penadak",
+  "semakin",
+  "canggih",
+  "nejuah",
+  "beji",
+  "diyakkah",
+  "pengan",
+  "angan",
+  "bekerja",
+  "pengenalan",
+  "dokumen",
+  "inoulah",
+  "guli",
+  "pelim",
+  "salah",
+  "pekebun",
+  "sawi",
+  "diyan",
+  "jaja",
+  "nejaja",
+  "udeng",
+};
+const uint16_t WA_FREQ_99_RANKS[] = {
+  0, 133, 7, 490, 223, 591, 184, 0, 0, 788, 0, 0, 38, 900, 760, 721,
+  754, 777, 36, 971, 862, 0, 0, 0, 0, 0, 302, 0, 0, 61, 0, 0,
+  0, 288, 89, 475, 489, 872, 0, 0, 452, 548, 0, 0, 0, 0, 0, 0,
+  0, 169, 455, 658, 975, 870, 0, 220, 136, 508, 0, 0, 837, 775, 0, 0,
+  0, 0, 0, 0, 0, 903, 0, 0, 0, 374, 0, 391, 0, 326, 893, 0,
+  0, 99, 442, 178, 511, 0, 0, 0, 230, 0, 0, 0, 817, 0, 0, 697,
+  0, 0, 274, 607, 0, 0, 889, 991, 0, 0, 0, 0, 367, 0, 0, 352,
+  0, 385, 0, 0, 812, 151, 0, 0, 0, 298, 80, 696, 0, 630, 345, 162,
+  660, 706, 496, 659, 730, 778, 344, 989, 117, 483, 518, 700, 990, 119, 0, 0,
+  0, 0, 0, 0, 0, 256, 366, 112, 510, 647, 0, 0, 0, 0, 0, 0,
+  0, 528, 419, 190, 6, 350, 317, 114, 355, 463, 48, 924, 928, 0, 183, 416,
+  755, 0, 291, 91, 898, 0, 0, 172, 175, 972, 615, 0, 219, 0, 0, 299,
+  402, 744, 805, 217, 280, 0, 471, 0, 0, 0, 0, 0, 0, 919, 0, 0,
+  88, 0, 0, 365, 343, 68, 191, 447, 742, 736, 143, 935, 0, 286, 849, 937,
+  689, 816, 135, 142, 399, 216, 639, 857, 432, 0, 238, 359, 617, 0, 0, 0,
+  100, 0, 0, 59, 0, 0, 586, 0, 840, 0, 574, 0, 0, 260, 726, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 155, 0, 0, 0, 824, 543, 678,
+  1000, 0, 0, 0, 0, 695, 0, 0, 0, 0, 0, 249, 358, 763, 0, 0,
+  631, 565, 0, 832, 13, 789, 952, 173, 0, 516, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 444, 0, 309, 454, 885, 0, 0, 956, 273, 0, 0,
+  720, 461, 598, 0, 0, 0, 855, 914, 0, 592, 869, 895, 0, 0, 0, 123,
+  130, 0, 779, 0, 0, 0, 0, 0, 0, 363, 977, 0, 115, 467, 0, 0,
+  0, 157, 616, 23, 627, 707, 401, 861, 0, 0, 0, 0, 774, 0, 0, 0,
+  0, 0, 0, 0, 250, 392, 0, 0, 33, 35, 301, 428, 927, 941, 584, 90,
+  814, 12, 915, 0, 15, 0, 0, 0, 0, 174, 798, 198, 253, 306, 553, 0,
+  0, 0, 240, 962, 0, 0, 0, 996, 0, 587, 0, 0, 0, 0, 34, 311,
+  105, 0, 0, 290, 368, 765, 831, 507, 967, 0, 871, 853, 0, 597, 904, 0,
+  675, 0, 0, 3, 0, 0, 0, 0, 0, 341, 0, 626, 0, 886, 102, 0,
+  0, 0, 809, 0, 632, 0, 0, 393, 938, 858, 271, 988, 0, 0, 0, 63,
+  0, 0, 0, 0, 0, 0, 907, 0, 323, 93, 0, 0, 0, 0, 725, 113,
+  53, 0, 0, 0, 202, 542, 891, 877, 0, 73, 333, 757, 0, 161, 0, 0,
+  549, 384, 0, 0, 970, 0, 951, 4, 54, 46, 911, 181, 64, 541, 657, 0,
+  0, 0, 0, 530, 478, 571, 958, 0, 0, 0, 780, 0, 593, 0, 0, 0,
+  0, 294, 308, 0, 0, 0, 349, 0, 0, 0, 0, 427, 680, 0, 0, 0,
+  0, 622, 934, 618, 948, 0, 0, 596, 0, 0, 0, 681, 0, 0, 0, 0,
+  226, 459, 51, 747, 0, 0, 0, 0, 0, 0, 0, 0, 0, 854, 0, 0,
+  0, 167, 0, 404, 0, 0, 625, 0, 0, 0, 0, 0, 0, 0, 623, 0,
+  0, 0, 529, 560, 451, 0, 0, 547, 0, 0, 9, 0, 0, 0, 0, 0,
+  0, 713, 245, 289, 606, 662, 686, 325, 902, 0, 0, 0, 81, 431, 445, 610,
+  929, 0, 0, 0, 0, 0, 776, 0, 0, 848, 0, 0, 236, 557, 0, 0,
+  0, 0, 612, 0, 0, 503, 0, 246, 0, 0, 0, 215, 0, 0, 802, 0,
+  0, 0, 0, 0, 749, 0, 0, 682, 0, 0, 0, 0, 0, 0, 600, 98,
+  0, 0, 0, 0, 909, 0, 0, 694, 0, 0, 83, 0, 716, 237, 982, 692,
+  0, 396, 527, 0, 0, 0, 0, 336, 0, 0, 0, 197, 0, 690, 0, 0,
+  683, 770, 266, 413, 233, 111, 767, 806, 0, 0, 0, 0, 0, 0, 0, 567,
+  137, 0, 42, 107, 156, 0, 0, 0, 0, 0, 0, 0, 818, 738, 0, 0,
+  0, 0, 0, 0, 918, 362, 608, 821, 0, 786, 0, 0, 0, 983, 267, 995,
+  0, 397, 644, 980, 0, 698, 0, 0, 0, 378, 930, 0, 585, 18, 0, 200,
+  312, 462, 856, 0, 0, 0, 144, 435, 920, 582, 0, 265, 0, 0, 0, 0,
+  724, 562, 984, 0, 0, 773, 0, 0, 429, 0, 278, 590, 0, 0, 0, 168,
+  0, 337, 207, 287, 525, 0, 709, 192, 595, 830, 505, 0, 0, 602, 0, 0,
+  0, 160, 841, 0, 0, 125, 0, 0, 381, 735, 558, 568, 688, 276, 0, 0,
+  0, 0, 438, 0, 0, 0, 0, 0, 27, 0, 494, 75, 398, 0, 41, 0,
+  0, 0, 0, 925, 0, 0, 400, 0, 132, 0, 0, 842, 0, 0, 165, 921,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 613, 850,
+  122, 0, 330, 795, 285, 0, 0, 0, 0, 0, 942, 0, 364, 0, 751, 319,
+  0, 0, 0, 19, 304, 166, 211, 701, 0, 0, 0, 370, 405, 0, 37, 87,
+  241, 234, 414, 544, 225, 561, 628, 195, 791, 916, 0, 210, 0, 0, 0, 0,
+  0, 0, 263, 759, 609, 0, 0, 976, 0, 633, 0, 0, 176, 76, 0, 153,
+  0, 0, 440, 673, 0, 259, 0, 621, 0, 498, 0, 0, 0, 0, 0, 583,
+  0, 305, 0, 0, 0, 715, 0, 0, 0, 0, 0, 0, 300, 49, 652, 797,
+  811, 212, 0, 0, 0, 0, 0, 0, 10, 40, 371, 140, 85, 500, 761, 959,
+  92, 0, 106, 380, 0, 469, 0, 0, 163, 353, 258, 379, 0, 0, 787, 0,
+  342, 0, 189, 303, 422, 437, 101, 480, 619, 0, 328, 0, 205, 836, 864, 868,
+  703, 0, 70, 0, 0, 771, 534, 0, 0, 243, 944, 0, 0, 0, 926, 559,
+  964, 965, 620, 981, 0, 0, 0, 0, 468, 116, 97, 0, 182, 0, 0, 0,
+  351, 0, 650, 663, 897, 0, 67, 0, 118, 66, 679, 753, 0, 0, 603, 0,
+  784, 740, 844, 458, 491, 0, 815, 0, 338, 539, 0, 0, 0, 0, 222, 0,
+  538, 239, 551, 254, 743, 750, 867, 96, 667, 44, 272, 297, 0, 0, 141, 0,
+  0, 499, 0, 0, 0, 0, 0, 0, 0, 732, 0, 26, 0, 0, 0, 29,
+  0, 0, 536, 570, 0, 0, 20, 513, 448, 912, 0, 0, 0, 0, 0, 164,
+  517, 0, 0, 0, 0, 180, 880, 892, 978, 0, 148, 828, 0, 443, 0, 648,
+  813, 0, 0, 0, 822, 0, 0, 262, 847, 509, 0, 0, 0, 0, 0, 940,
+  390, 403, 457, 418, 0, 0, 126, 228, 687, 0, 335, 961, 0, 146, 0, 0,
+  0, 0, 0, 0, 0, 702, 0, 0, 0, 0, 0, 578, 0, 0, 0, 203,
+  654, 0, 354, 545, 0, 0, 820, 0, 0, 0, 406, 0, 0, 0, 264, 0,
+  0, 0, 0, 0, 0, 0, 986, 0, 0, 0, 0, 0, 84, 224, 999, 0,
+  21, 0, 922, 0, 0, 0, 0, 946, 954, 0, 0, 0, 0, 0, 0, 235,
+  0, 369, 0, 307, 479, 672, 485, 960, 949, 0, 242, 0, 0, 493, 0, 0,
+  0, 899, 322, 860, 0, 0, 0, 0, 514, 0, 0, 834, 320, 0, 0, 0,
+  229, 0, 0, 0, 0, 950, 0, 741, 0, 0, 47, 823, 923, 955, 957, 0,
+  484, 0, 0, 0, 0, 0, 0, 0, 0, 945, 74, 177, 315, 321, 334, 421,
+  572, 793, 0, 339, 589, 188, 668, 953, 0, 186, 0, 231, 839, 0, 605, 0,
+  0, 2, 0, 0, 0, 487, 185, 357, 409, 296, 533, 752, 0, 0, 314, 453,
+  0, 0, 575, 159, 0, 0, 0, 579, 108, 535, 0, 0, 0, 0, 79, 0,
+  0, 803, 873, 332, 411, 826, 56, 412, 883, 887, 894, 987, 0, 0, 0, 465,
+  580, 476, 0, 0, 908, 0, 60, 0, 0, 0, 0, 82, 0, 0, 293, 0,
+  661, 772, 0, 0, 0, 0, 576, 0, 851, 0, 149, 645, 969, 537, 717, 0,
+  0, 0, 825, 327, 0, 261, 456, 913, 0, 0, 331, 0, 424, 430, 0, 0,
+  992, 382, 28, 599, 781, 194, 0, 131, 0, 0, 745, 998, 0, 0, 0, 0,
+  0, 884, 947, 0, 0, 0, 0, 0, 502, 0, 685, 0, 993, 134, 171, 270,
+  665, 0, 0, 0, 0, 0, 0, 441, 0, 0, 255, 0, 318, 0, 939, 72,
+  348, 932, 512, 58, 863, 466, 0, 0, 0, 0, 45, 624, 655, 0, 0, 0,
+  150, 704, 0, 874, 0, 0, 827, 0, 0, 0, 209, 0, 199, 526, 835, 0,
+  30, 896, 24, 546, 394, 208, 0, 712, 0, 0, 531, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 699, 966, 62, 0, 0, 629, 684, 196, 439, 247, 470, 521,
+  656, 415, 420, 446, 693, 206, 232, 799, 269, 810, 973, 0, 985, 104, 800, 910,
+  492, 25, 284, 758, 504, 792, 808, 55, 221, 0, 0, 0, 0, 376, 251, 671,
+  0, 0, 0, 0, 0, 0, 783, 0, 0, 0, 0, 0, 0, 313, 640, 0,
+  0, 0, 347, 0, 0, 0, 0, 764, 124, 65, 670, 0, 0, 0, 0, 0,
+  0, 5, 0, 481, 733, 450, 905, 0, 0, 32, 705, 564, 0, 594, 147, 275,
+  642, 666, 711, 16, 581, 766, 714, 906, 931, 281, 933, 214, 573, 128, 669, 833,
+  0, 0, 0, 433, 708, 110, 0, 0, 170, 0, 0, 0, 0, 0, 77, 0,
+  979, 0, 0, 611, 179, 782, 0, 324, 677, 846, 601, 389, 139, 218, 410, 722,
+  882, 201, 464, 651, 520, 17, 843, 0, 506, 968, 395, 0, 0, 0, 0, 387,
+  0, 0, 801, 555, 0, 0, 0, 0, 11, 0, 845, 614, 22, 0, 0, 310,
+  552, 0, 0, 604, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 888, 917,
+  377, 372, 719, 50, 746, 819, 0, 852, 473, 0, 0, 0, 145, 0, 375, 634,
+  936, 588, 566, 213, 472, 638, 282, 0, 737, 0, 0, 0, 756, 346, 0, 138,
+  0, 0, 0, 554, 649, 0, 501, 495, 0, 0, 0, 0, 890, 0, 449, 878,
+  0, 540, 635, 0, 0, 0, 0, 0, 0, 0, 0, 0, 994, 268, 295, 643,
+  129, 361, 388, 522, 691, 729, 997, 0, 154, 0, 436, 0, 0, 0, 0, 0,
+  0, 0, 664, 0, 0, 0, 0, 556, 426, 0, 943, 94, 0, 0, 71, 0,
+  0, 0, 120, 486, 69, 417, 474, 0, 0, 865, 109, 0, 0, 0, 0, 121,
+  340, 0, 807, 0, 569, 316, 482, 875, 0, 78, 0, 790, 127, 423, 859, 0,
+  769, 0, 0, 158, 829, 0, 434, 963, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 796, 252, 0, 0, 636, 477, 563, 227, 283, 383, 723, 14,
+  762, 901, 39, 8, 187, 532, 727, 0, 408, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 279, 0, 488, 257, 0, 0, 0, 718, 0, 879, 0,
+  0, 0, 866, 0, 0, 0, 86, 248, 710, 881, 794, 0, 52, 0, 0, 0,
+  637, 0, 0, 0, 0, 407, 0, 0, 0, 0, 0, 0, 57, 739, 804, 0,
+  360, 0, 0, 193, 728, 768, 0, 676, 0, 523, 0, 0, 0, 0, 653, 748,
+  731, 0, 329, 524, 577, 0, 31, 0, 0, 0, 152, 460, 0, 0, 0, 0,
+  0, 0, 0, 515, 103, 0, 0, 0, 0, 0, 425, 0, 0, 0, 356, 0,
+  0, 0, 43, 674, 641, 0, 646, 277, 785, 0, 0, 292, 0, 0, 497, 0,
+  734, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 204, 519, 0, 0,
+  386, 0, 0, 0, 0, 244, 0, 0, 0, 0, 0, 0, 95, 373, 0, 0,
+  876, 0, 0, 838, 0, 974, 0, 0, 0, 0, 0, 0, 0, 550, 0, 0,
+};
+
+const char *WA_FREQ_100_TOKENS[] = {
+  "dia",
+  "Ny",
+  "ny",
+  "ary",
+  "amin'ny",
+  "taona",
+  "tamin'ny",
+  "kaominina",
+  "kaodim-paositra",
+  "mampiasa",
+  "soratra",
+  "mponina",
+  "INSEE",
+  "desimaly",
+  "fisiana",
+  "ara-daharampehintany",
+  "ara-daharanjarahasin'ilay",
+  "araka",
+  "natao",
+  "fanisana",
+  "isam-ponin'i",
+  "2008",
+  "ao",
+  "andro",
+  "masoandro",
+  "manodidin'ny",
+  "halavam-potoana",
+  "hidodikodonany",
+  "2006",
+  "tanàna",
+  "zavatra",
+  "anisan'ny",
+  "habakabaka",
+  "madinidinika",
+  "laharam-pehintaniny",
+  "laharan-jarahasiny",
+  "kilometatra",
+  "toradroa",
+  "velarantanin'ilay",
+  "metatra",
+  "1999",
+  "indrindra",
+  "toerana",
+  "haavon'ny",
+  "ireo",
+  "no",
+  "Avaratra",
+  "sy",
+  "I",
+  "Atsinanana",
+  "2009",
+  "avo",
+  "any",
+  "tsy",
+  "fiteny",
+  "na",
+  "malagasy",
+  "olona",
+  "ho",
+  "isam-ponina",
+  "manome",
+  "hakitroka",
+  "izy",
+  "distrikan'i",
+  "izay",
+  "ambany",
+  "io",
+  "misy",
+  "teny",
+  "eo",
+  "2000",
+  "iray",
+  "2007",
+  "fa",
+  "2001",
+  "Ireo",
+  "maty",
+  "izany",
+  "i",
+  "koa",
+  "tany",
+  "azy",
+  "haavon'ilay",
+  "haavon-dranomasina",
+  "avy",
+  "kalandrie",
+  "Gregôriana",
+  "zava-nitranga",
+  "olon-teraka",
+  "hoe",
+  "ka",
+  "La",
+  "2002",
+  "manana",
+  "ilay",
+  "firenena",
+  "teo",
+  "kintana",
+  "tao",
+  "ihany",
+  "amin’ny",
+  "atonton-kintan'i",
+  "NGC",
+  "ben'ny",
+  "mpanao",
+  "Madagasikara",
+  "Le",
+  "29°",
+  "mba",
+  "1998",
+  "politika",
+  "faritra",
+  "2003",
+  "2004",
+  "maro",
+  "voalohany",
+  "Tamin'ny",
+  "an'ny",
+  "izao",
+  "raha",
+  "2005",
+  "tena",
+  "mandritry",
+  "fotoana",
+  "faha",
+  "tapitrisa",
+  "taonjato",
+  "rehefa",
+  "anarana",
+  "be",
+  "27°",
+  "28°",
+  "laharam-pokontaniny",
+  "Misy",
+  "an'i",
+  "noho",
+  "hafa",
+  "mety",
+  "rehetra",
+  "lehibe",
+  "avaratra",
+  "roa",
+  "anaty",
+  "frantsay",
+  "Tsy",
+  "azo",
+  "nisy",
+  "satria",
+  "volana",
+  "mbola",
+  "eto",
+  "faritr'ora",
+  "renivohiny",
+  "fomba",
+  "efa",
+  "atao",
+  "aza",
+  "de",
+  "Frantsa",
+  "afaka",
+  "ankehitriny",
+  "isan'ny",
+  "lasa",
+  "ity",
+  "Ary",
+  "toy",
+  "atsimo",
+  "faritany",
+  "kosa",
+  "mpanjaka",
+  "ampiasaina",
+  "sinoa",
+  "anefa",
+  "fantatra",
+  "GMT",
+  "hatramin'ny",
+  "taloha",
+  "anglisy",
+  "Andrefana",
+  "anatin'ny",
+  "Les",
+  "3:30",
+  "8°",
+  "tonga",
+  "kanji",
+  "Somme",
+  "Amin'ny",
+  "Ralambo",
+  "nosy",
+  "aminy",
+  "nanomboka",
+  "1",
+  "hita",
+  "faritr'i",
+  "hatrany",
+  "miaraka",
+  "andriana",
+  "ampiasain'ny",
+  "Afrika",
+  "Any",
+  "rano",
+  "miasa",
+  "Picardie",
+  "miteny",
+  "II",
+  "kely",
+  "Io",
+  "Ao",
+  "an-tany",
+  "Espaina",
+  "andrefana",
+  "departementan'i",
+  "isa",
+  "kokoa",
+  "Rehefa",
+  "foko",
+  "3",
+  "7°",
+  "Atsimo",
+  "Amerika",
+  "mahery",
+  "vao",
+  "Izy",
+  "ofisialy",
+  "2008–2014",
+  "Ambohidrabiby",
+  "tontolo",
+  "telo",
+  "fanjakana",
+  "manao",
+  "Ilay",
+  "amin'i",
+  "an'ilay",
+  "ohatra",
+  "matetika",
+  "1997",
+  "alalan'ny",
+  "tamin’ny",
+  "japoney",
+  "abidy",
+  "amin'ireo",
+  "latina",
+  "16",
+  "ahitana",
+  "mitovy",
+  "ngeza",
+  "tsara",
+  "10",
+  "koreanina",
+  "Malagasy",
+  "Raha",
+  "2010",
+  "arabo",
+  "farany",
+  "momba",
+  "Amin'izao",
+  "atsinanana",
+  "kaody",
+  "midika",
+  "Araka",
+  "2",
+  "20",
+  "4",
+  "folo",
+  "horonantsary",
+  "12",
+  "5",
+  "indray",
+  "manokana",
+  "Eoropa",
+  "anarany",
+  "faharoa",
+  "0.",
+  "22",
+  "asa",
+  "betsaka",
+  "karazana",
+  "rindrankajy",
+  "21",
+  "25",
+  "Etazonia",
+  "endrika",
+  "manodidina",
+  "taty",
+  "Manana",
+  "15",
+  "miaina",
+  "ranomasina",
+  "intsony",
+  "tenenina",
+  "17",
+  "31",
+  "samy",
+  "tokoa",
+  "19",
+  "23",
+  "30°",
+  "Noho",
+  "eny",
+  "Repoblika",
+  "Eo",
+  "dimy",
+  "trano",
+  "1996",
+  "24",
+  "amin'ilay",
+  "km",
+  "sasany",
+  "vaovao",
+  "30",
+  "vohitra",
+  "7",
+  "amina",
+  "aoriana",
+  "of",
+  "orinasa",
+  "1.",
+  "2014",
+  "mitondra",
+  "sady",
+  "000",
+  "Antananarivo",
+  "Na",
+  "ady",
+  "samihafa",
+  "tamin'izany",
+  "tokony",
+  "vary",
+  "India",
+  "departemantan'i",
+  "indostrian'ny",
+  "Fa",
+  "antsoina",
+  "lazaina",
+  "vazimba",
+  "Sina",
+  "ambony",
+  "amin'io",
+  "aorian'ny",
+  "fotsiny",
+  "milina",
+  "nahazo",
+  "renirano",
+  "amorontsiraka",
+  "efatra",
+  "fikambanana",
+  "1995",
+  "27",
+  "grika",
+  "maromaro",
+  "moa",
+  "teraka",
+  "13",
+  "Andriandoriamanjaka",
+  "nanao",
+  "fanoratana",
+  "ireny",
+  "milaza",
+  "toa",
+  "vola",
+  "lahatsoratra",
+  "mikasika",
+  "tsotra",
+  "vita",
+  "11",
+  "34",
+  "36",
+  "soratana",
+  "Wikipedia",
+  "hasina",
+  "18",
+  "1991",
+  "teto",
+  "2.",
+  "6",
+  "9",
+  "Rabiby",
+  "biby",
+  "pejy",
+  "tanjona",
+  "123",
+  "42",
+  "80",
+  "Azia",
+  "boky",
+  "mpiteny",
+  "olombelona",
+  "1993",
+  "50",
+  "Tany",
+  "amin'izany",
+  "fampiasana",
+  "1994",
+  "26",
+  "28",
+  "29",
+  "33",
+  "40",
+  "54",
+  "Nanomboka",
+  "Zanadralambo",
+  "avokoa",
+  "fianarana",
+  "mipetraka",
+  "107",
+  "129",
+  "37",
+  "47",
+  "hova",
+  "nohon'ny",
+  "wiki",
+  "Mpanjaka",
+  "renivohitra",
+  "tetikasa",
+  "32",
+  "anaran'ny",
+  "litera",
+  "nanjaka",
+  "tantara",
+  "35",
+  "4.",
+  "Izany",
+  "vokatry",
+  "voly",
+  "111",
+  "14",
+  "39",
+  "44",
+  "51",
+  "6.",
+  "8",
+  "Ankehitriny",
+  "Manakara",
+  "aloha",
+  "espaniola",
+  "isam-poniny",
+  "1990",
+  "7.",
+  "9.",
+  "ala",
+  "mahazo",
+  "121",
+  "Imerina",
+  "fambolena",
+  "miisa",
+  "saika",
+  "sary",
+  "tanànan'i",
+  "119",
+  "133",
+  "3.",
+  "38",
+  "5.",
+  "60",
+  "91",
+  "Andrianampoinimerina",
+  "Indonezia",
+  "Kanada",
+  "ambin'ny",
+  "amin'izao",
+  "arivo",
+  "feo",
+  "fiangonana",
+  "nitondra",
+  "sehatra",
+  "tanteraka",
+  "100",
+  "116",
+  "203",
+  "86",
+  "Efa",
+  "Martsa",
+  "Nosy",
+  "iraisam-pirenena",
+  "merina",
+  "namorona",
+  "zanatany",
+  "201",
+  "52",
+  "58",
+  "90",
+  "Ohatra",
+  "andrefan'i",
+  "fitaovana",
+  "tamin'i",
+  "zanany",
+  "101",
+  "106",
+  "135",
+  "41",
+  "49",
+  "69",
+  "70",
+  "Betsaka",
+  "Maro",
+  "Sud",
+  "alina",
+  "loatra",
+  "mora",
+  "mpikambana",
+  "solosaina",
+  "tarika",
+  "118",
+  "145",
+  "158",
+  "43",
+  "55",
+  "94",
+  "Afaka",
+  "Avy",
+  "Firenena",
+  "alàlan'ny",
+  "hono",
+  "lamba",
+  "mpianatra",
+  "nanana",
+  "nisàna",
+  "omby",
+  "taminy",
+  "114",
+  "120",
+  "172",
+  "46",
+  "53",
+  "Ho",
+  "anelanelan'ny",
+  "ilaina",
+  "manerana",
+  "mila",
+  "mpanoratra",
+  "nonina",
+  "saingy",
+  "sisintany",
+  "tendrombohitra",
+  "vondrona",
+  "zanapeo",
+  "122",
+  "126",
+  "130",
+  "141",
+  "173",
+  "45",
+  "500",
+  "84",
+  "92",
+  "Mety",
+  "Taona",
+  "anjara",
+  "ankapobeny",
+  "daholo",
+  "fampahalalana",
+  "farihy",
+  "halavirana",
+  "kanefa",
+  "lafin'ny",
+  "vahiny",
+  "102",
+  "105",
+  "117",
+  "146",
+  "205",
+  "300",
+  "56",
+  "59",
+  "8.",
+  "96",
+  "Alemaina",
+  "Repoblikan'i",
+  "Teo",
+  "lovantsofina",
+  "maintsy",
+  "mazava",
+  "mihitsy",
+  "olana",
+  "talohan'ny",
+  "vahoaka",
+  "103",
+  "108",
+  "112",
+  "153",
+  "160",
+  "163",
+  "48",
+  "65",
+  "79",
+  "81",
+  "Fonohasina",
+  "Kristy",
+  "antony",
+  "km²",
+  "landy",
+  "manaraka",
+  "rivotra",
+  "tsirairay",
+  "124",
+  "128",
+  "152",
+  "168",
+  "202",
+  "233",
+  "270",
+  "66",
+  "83",
+  "P-L",
+  "anatiny",
+  "arakaraky",
+  "fajiry",
+  "faritan'i",
+  "fiainana",
+  "iny",
+  "orana",
+  "siansa",
+  "tamin'ireo",
+  "137",
+  "139",
+  "150",
+  "204",
+  "212",
+  "77",
+  "78",
+  "82",
+  "95",
+  "Antsirabe",
+  "Virgo",
+  "akory",
+  "amerikana",
+  "faritanin'i",
+  "gazety",
+  "governemanta",
+  "vato",
+  "vitsy",
+  "113",
+  "154",
+  "156",
+  "57",
+  "72",
+  "75",
+  "87",
+  "93",
+  "Afovoany",
+  "Nisy",
+  "akaiky",
+  "manjaka",
+  "manoratra",
+  "monina",
+  "nataon'i",
+  "nivoaka",
+  "104",
+  "125",
+  "131",
+  "144",
+  "167",
+  "174",
+  "182",
+  "197",
+  "1981",
+  "200",
+  "210",
+  "229",
+  "245",
+  "76",
+  "Azo",
+  "Farafangana",
+  "Jolay",
+  "foana",
+  "maina",
+  "malay",
+  "nefa",
+  "sambo",
+  "sns",
+  "147",
+  "169",
+  "216",
+  "220",
+  "89",
+  "Frantsay",
+  "Ity",
+  "anivon'ny",
+  "ankabeazan'ny",
+  "la",
+  "mamaritra",
+  "nataony",
+  "tropikaly",
+  "109",
+  "127",
+  "143",
+  "159",
+  "165",
+  "171",
+  "181",
+  "188",
+  "189",
+  "211",
+  "275",
+  "64",
+  "97",
+  "Janoary",
+  "Mpc",
+  "Paris",
+  "Rosia",
+  "aratra",
+  "atsinanan'i",
+  "faran'ny",
+  "fototra",
+  "irery",
+  "isaky",
+  "malaza",
+  "110",
+  "132",
+  "136",
+  "149",
+  "166",
+  "176",
+  "184",
+  "185",
+  "186",
+  "208",
+  "250",
+  "67",
+  "Ady",
+  "Jesoa",
+  "Mly",
+  "Teny",
+  "afovoany",
+  "hazo",
+  "ivelany",
+  "lava",
+  "maha",
+  "manontolo",
+  "rafitra",
+  "ranomasimbe",
+  "vitsivitsy",
+  "zanaka",
+  "140",
+  "177",
+  "183",
+  "190",
+  "196",
+  "1992",
+  "207",
+  "209",
+  "260",
+  "31°",
+  "68",
+  "71",
+  "73",
+  "Aogositra",
+  "Lasa",
+  "Radama",
+  "fifandraisana",
+  "hetsy",
+  "hevitra",
+  "mandeha",
+  "nampiasaina",
+  "tahaka",
+  "taratasy",
+  "tokana",
+  "volapoky",
+  "138",
+  "151",
+  "161",
+  "194",
+  "195",
+  "1988",
+  "199",
+  "217",
+  "221",
+  "226",
+  "230",
+  "240",
+  "249",
+  "255",
+  "325",
+  "74",
+  "99",
+  "Anisan'ny",
+  "Filipina",
+  "Izay",
+  "eoropeana",
+  "eran-tany",
+  "hira",
+  "lalàna",
+  "mena",
+  "mifototra",
+  "mihoatra",
+  "rakitra",
+  "tamin'io",
+  "115",
+  "164",
+  "175",
+  "191",
+  "192",
+  "224",
+  "253",
+  "274",
+  "283",
+  "63",
+  "98",
+  "Korea",
+  "Masina",
+  "Mbola",
+  "Sambava",
+  "atsimon'i",
+  "atsimon'ny",
+  "finoana",
+  "fito",
+  "hafanana",
+  "labiera",
+  "nahita",
+  "razana",
+  "velarantaniny",
+  "134",
+  "155",
+  "162",
+  "170",
+  "180",
+  "206",
+  "222",
+  "223",
+  "243",
+  "252",
+  "254",
+  "256",
+  "285",
+  "Fiangonana",
+  "New",
+  "Rabefaravolamanjaka",
+  "Ranomasimbe",
+  "Tsiroanomandidy",
+  "alemana",
+  "endriky",
+  "fohy",
+  "fotsy",
+  "haavo",
+  "hatry",
+  "lafiny",
+  "manomboka",
+  "matoanteny",
+  "mizara",
+  "mpamboly",
+  "olom-pirenena",
+  "raki-pahalalana",
+  "zavamaniry",
+  "179",
+  "193",
+  "219",
+  "238",
+  "244",
+  "261",
+  "263",
+  "88",
+  "Ambatondrazaka",
+  "Aostralia",
+  "Dia",
+  "Google",
+  "Marihina",
+  "Oktobra",
+  "Pasifika",
+  "Tanànan'i",
+  "enina",
+  "fahefana",
+  "fanjakany",
+  "faritry",
+  "filôzôfy",
+  "hery",
+  "hisy",
+  "isan-taona",
+  "lanja",
+  "miankina",
+  "momban'ny",
+  "mpitondra",
+  "niasa",
+  "niteraka",
+  "noforonina",
+  "rainy",
+  "romana",
+  "1989",
+  "218",
+  "289",
+  "303",
+  "350",
+  "398",
+  "Jean",
+  "Mandritsara",
+  "Ntaolo",
+  "Ranavalona",
+  "Satria",
+  "T-3",
+  "amin’",
+  "fahatelo",
+  "fanamboarana",
+  "fitondrana",
+  "mahay",
+  "malalaka",
+  "mpandrindra",
+  "nandritra",
+  "renifeo",
+  "renivohitry",
+  "tamil",
+  "taranja",
+  "tranonkala",
+  "velarantany",
+  "142",
+  "215",
+  "234",
+  "236",
+  "242",
+  "282",
+  "286",
+  "294",
+  "299",
+  "320",
+  "324",
+  "61",
+  "62",
+  "Ambatolampy",
+  "Arak'izany",
+  "Leo",
+  "Mananjary",
+  "Moramanga",
+  "Nord",
+  "Tao",
+  "Wikibolana",
+  "antitra",
+  "araky",
+  "departemanta",
+  "fahavaratra",
+  "fanaovana",
+  "feno",
+  "fiaramanidina",
+  "ireto",
+  "mafy",
+  "masina",
+  "niaina",
+  "pinyin",
+  "rosy",
+  "rova",
+  "tamba-nosy",
+  "velarana",
+  "voasintona",
+  "zo",
+  "148",
+  "187",
+  "198",
+  "2011",
+  "213",
+  "214",
+  "228",
+  "237",
+  "241",
+  "248",
+  "262",
+  "271",
+  "284",
+  "296",
+  "381",
+  "85",
+  "Andrianjaka",
+  "SALT",
+  "Taolanaro",
+  "Vohipeno",
+  "alahamady",
+  "aretina",
+  "hatramin’ny",
+  "lalana",
+  "maneho",
+  "mantsy",
+  "mpampiasa",
+  "nipetraka",
+  "portogey",
+  "sarotra",
+  "157",
+  "178",
+  "17°",
+  "231",
+  "246",
+  "259",
+  "277",
+  "305",
+  "326",
+  "364",
+  "520",
+  "Fianarantsoa",
+  "Kanefa",
+  "Koa",
+  "Matetika",
+  "Romana",
+  "ahafahana",
+  "amerikanina",
+  "ela",
+  "fandinihana",
+  "faritanin'ny",
+  "fifidianana",
+  "fikarohana",
+  "haingana",
+  "mafana",
+  "matematika",
+  "mihintsy",
+  "nampiasa",
+  "nanome",
+};
+const uint16_t WA_FREQ_100_RANKS[] = {
+  0, 0, 524, 995, 605, 0, 986, 928, 614, 0, 0, 555, 873, 0, 104, 367,
+  627, 0, 0, 105, 0, 188, 976, 531, 0, 0, 0, 48, 538, 835, 467, 435,
+  288, 178, 404, 412, 415, 734, 744, 0, 878, 0, 864, 0, 0, 0, 0, 58,
+  0, 0, 771, 0, 0, 514, 81, 318, 0, 0, 781, 0, 0, 214, 0, 0,
+  0, 543, 511, 0, 0, 0, 539, 0, 0, 712, 0, 0, 0, 0, 0, 0,
+  300, 0, 0, 661, 723, 0, 0, 0, 0, 0, 0, 0, 0, 312, 598, 201,
+  391, 663, 0, 0, 60, 0, 0, 0, 0, 0, 0, 0, 102, 0, 500, 818,
+  747, 0, 0, 0, 0, 0, 0, 0, 352, 671, 108, 574, 0, 577, 795, 0,
+  0, 486, 884, 0, 0, 326, 700, 460, 298, 364, 193, 767, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 294, 814, 0, 715, 621, 0, 999, 528, 0, 491, 0,
+  0, 688, 959, 0, 0, 640, 196, 0, 15, 213, 64, 160, 13, 424, 706, 872,
+  717, 826, 987, 0, 0, 0, 0, 0, 476, 113, 0, 439, 580, 0, 0, 252,
+  251, 255, 0, 496, 1000, 777, 409, 494, 0, 0, 0, 773, 0, 0, 589, 803,
+  0, 0, 451, 594, 841, 0, 0, 132, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 749, 0, 442, 821, 811, 115, 385, 994, 380, 0, 0, 0, 992, 0, 0,
+  938, 0, 420, 0, 401, 742, 0, 0, 127, 109, 0, 0, 0, 719, 0, 898,
+  0, 200, 0, 769, 0, 360, 0, 0, 0, 0, 0, 0, 0, 871, 0, 0,
+  0, 0, 449, 0, 124, 0, 0, 735, 892, 10, 716, 0, 0, 0, 0, 0,
+  509, 786, 979, 0, 0, 0, 0, 0, 0, 0, 756, 402, 0, 0, 0, 0,
+  0, 0, 0, 302, 39, 558, 0, 0, 675, 447, 646, 535, 0, 0, 0, 0,
+  0, 0, 418, 961, 291, 324, 170, 584, 0, 0, 0, 0, 0, 0, 181, 323,
+  0, 0, 0, 0, 390, 0, 0, 393, 0, 0, 847, 604, 513, 684, 508, 0,
+  0, 0, 677, 0, 0, 0, 0, 0, 0, 0, 0, 179, 0, 0, 542, 0,
+  0, 0, 0, 44, 356, 722, 0, 185, 455, 0, 0, 0, 0, 0, 141, 397,
+  479, 276, 152, 739, 670, 751, 940, 0, 189, 410, 909, 0, 0, 227, 466, 284,
+  0, 0, 868, 0, 23, 389, 779, 969, 0, 408, 657, 428, 718, 180, 355, 0,
+  630, 629, 0, 0, 520, 923, 0, 0, 0, 0, 0, 0, 281, 210, 0, 0,
+  652, 0, 24, 365, 248, 22, 154, 422, 695, 812, 137, 164, 822, 915, 0, 0,
+  648, 0, 0, 0, 0, 502, 370, 665, 925, 697, 445, 0, 73, 50, 381, 0,
+  659, 0, 0, 0, 0, 858, 0, 301, 0, 68, 100, 33, 518, 218, 668, 0,
+  0, 112, 0, 0, 0, 0, 0, 515, 0, 0, 778, 0, 0, 358, 0, 153,
+  0, 484, 0, 0, 0, 0, 902, 981, 403, 0, 808, 485, 220, 0, 0, 0,
+  268, 636, 801, 299, 308, 806, 0, 206, 0, 0, 766, 0, 0, 65, 458, 468,
+  710, 863, 0, 0, 0, 0, 0, 311, 0, 337, 544, 82, 372, 644, 0, 239,
+  35, 49, 943, 0, 857, 0, 119, 273, 336, 406, 568, 836, 231, 0, 0, 0,
+  0, 0, 0, 0, 0, 211, 92, 216, 0, 11, 0, 0, 0, 0, 0, 135,
+  750, 802, 0, 0, 985, 139, 432, 0, 0, 0, 0, 0, 977, 0, 0, 0,
+  0, 0, 763, 0, 0, 0, 340, 0, 421, 0, 0, 655, 0, 0, 823, 477,
+  147, 724, 729, 0, 0, 545, 159, 869, 0, 666, 903, 0, 831, 840, 0, 0,
+  0, 561, 0, 37, 912, 474, 42, 746, 0, 946, 0, 0, 645, 905, 0, 0,
+  0, 0, 0, 416, 492, 0, 0, 0, 0, 347, 223, 674, 259, 0, 0, 448,
+  0, 142, 0, 34, 0, 0, 0, 819, 0, 0, 0, 309, 0, 0, 519, 827,
+  625, 0, 0, 0, 56, 165, 571, 711, 932, 0, 0, 0, 52, 785, 988, 896,
+  825, 934, 0, 0, 296, 642, 685, 0, 0, 844, 134, 846, 759, 951, 696, 32,
+  145, 0, 0, 0, 607, 423, 436, 0, 0, 0, 745, 0, 0, 553, 0, 0,
+  379, 0, 0, 0, 0, 0, 0, 0, 321, 600, 643, 0, 0, 194, 331, 129,
+  346, 0, 69, 293, 0, 0, 0, 0, 94, 0, 0, 926, 658, 897, 753, 0,
+  0, 0, 0, 0, 0, 203, 131, 0, 0, 162, 417, 0, 0, 647, 0, 338,
+  0, 357, 0, 0, 0, 0, 45, 14, 0, 488, 0, 0, 0, 0, 0, 0,
+  0, 579, 0, 0, 74, 202, 0, 0, 208, 738, 0, 2, 0, 962, 978, 0,
+  918, 361, 195, 313, 0, 249, 459, 501, 0, 0, 0, 0, 0, 167, 908, 536,
+  0, 804, 136, 0, 0, 0, 148, 0, 0, 280, 97, 310, 363, 740, 368, 824,
+  464, 0, 0, 0, 0, 0, 0, 0, 0, 143, 687, 0, 262, 0, 0, 117,
+  0, 714, 0, 0, 0, 0, 0, 349, 900, 0, 890, 263, 0, 0, 0, 638,
+  906, 0, 0, 0, 0, 842, 0, 0, 0, 0, 0, 0, 0, 0, 79, 0,
+  12, 845, 0, 597, 9, 692, 817, 936, 440, 0, 89, 0, 0, 0, 0, 859,
+  0, 0, 0, 0, 462, 0, 0, 0, 0, 0, 0, 530, 209, 234, 789, 0,
+  0, 120, 0, 914, 0, 0, 754, 587, 774, 0, 0, 452, 411, 941, 0, 0,
+  540, 588, 334, 967, 0, 30, 66, 0, 641, 0, 0, 344, 377, 503, 850, 0,
+  0, 950, 0, 0, 0, 0, 650, 0, 182, 172, 116, 314, 599, 0, 0, 63,
+  0, 0, 71, 761, 0, 0, 0, 0, 0, 0, 258, 0, 0, 0, 0, 0,
+  0, 151, 635, 0, 721, 0, 266, 0, 0, 0, 322, 0, 0, 0, 0, 0,
+  0, 0, 0, 669, 0, 942, 85, 199, 533, 0, 0, 80, 0, 217, 891, 0,
+  547, 0, 0, 0, 0, 0, 282, 41, 430, 0, 99, 0, 472, 264, 26, 0,
+  937, 0, 0, 457, 554, 673, 861, 883, 0, 0, 176, 755, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 70, 0, 0, 384, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 317, 606, 725, 955, 91, 47, 758, 253, 772, 982,
+  0, 256, 0, 0, 0, 345, 277, 0, 616, 0, 681, 569, 570, 787, 0, 0,
+  0, 0, 40, 592, 0, 0, 197, 88, 6, 386, 564, 0, 0, 286, 920, 0,
+  852, 894, 0, 649, 619, 0, 0, 0, 0, 0, 0, 0, 487, 0, 241, 289,
+  676, 0, 0, 0, 150, 489, 632, 499, 315, 0, 31, 0, 0, 0, 0, 882,
+  949, 232, 565, 0, 0, 0, 0, 383, 901, 966, 0, 0, 0, 434, 0, 0,
+  0, 0, 0, 0, 0, 0, 888, 0, 0, 327, 0, 366, 0, 0, 899, 0,
+  0, 0, 396, 269, 163, 0, 0, 473, 371, 876, 118, 158, 760, 737, 207, 922,
+  933, 0, 893, 698, 911, 0, 506, 965, 405, 146, 469, 101, 618, 480, 95, 339,
+  633, 770, 780, 0, 0, 0, 694, 838, 689, 375, 622, 837, 25, 382, 537, 0,
+  832, 0, 0, 419, 0, 0, 0, 603, 0, 0, 0, 860, 0, 849, 0, 0,
+  0, 0, 0, 0, 0, 0, 350, 527, 0, 174, 0, 0, 0, 839, 610, 0,
+  0, 373, 0, 0, 552, 392, 0, 229, 782, 156, 797, 895, 0, 0, 0, 628,
+  275, 970, 0, 887, 810, 0, 429, 0, 0, 0, 0, 0, 0, 0, 38, 76,
+  341, 55, 328, 398, 525, 186, 626, 752, 855, 954, 972, 608, 0, 0, 0, 0,
+  929, 0, 0, 0, 0, 0, 0, 0, 140, 0, 0, 791, 57, 0, 271, 297,
+  463, 595, 596, 0, 0, 343, 0, 996, 0, 0, 225, 874, 149, 534, 0, 376,
+  62, 0, 809, 388, 0, 305, 0, 0, 612, 285, 303, 0, 572, 664, 620, 330,
+  682, 0, 956, 0, 219, 0, 0, 16, 0, 775, 0, 0, 166, 17, 944, 27,
+  169, 77, 128, 924, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 261,
+  0, 0, 0, 0, 0, 0, 123, 325, 930, 830, 0, 0, 0, 0, 730, 0,
+  0, 0, 0, 0, 0, 975, 0, 0, 0, 728, 0, 510, 215, 0, 0, 441,
+  171, 287, 651, 0, 0, 0, 242, 0, 573, 953, 522, 623, 0, 0, 693, 192,
+  125, 829, 221, 576, 613, 792, 0, 0, 880, 0, 0, 583, 444, 4, 161, 0,
+  0, 0, 582, 505, 0, 130, 562, 126, 110, 0, 0, 0, 333, 0, 190, 0,
+  0, 0, 609, 431, 453, 726, 662, 0, 0, 512, 0, 173, 963, 0, 0, 0,
+  235, 0, 0, 0, 0, 0, 36, 586, 292, 917, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 493, 998, 495, 0, 246, 0, 278, 0, 0, 678, 168, 507,
+  879, 478, 617, 267, 378, 807, 0, 0, 0, 624, 0, 541, 848, 960, 0, 0,
+  290, 523, 0, 526, 238, 866, 794, 427, 851, 904, 989, 0, 0, 0, 0, 0,
+  369, 0, 0, 72, 0, 799, 590, 243, 0, 0, 0, 0, 889, 0, 0, 0,
+  0, 0, 578, 601, 443, 0, 0, 0, 557, 0, 0, 0, 653, 971, 843, 87,
+  784, 83, 815, 550, 0, 0, 0, 0, 0, 0, 0, 233, 686, 0, 560, 184,
+  204, 212, 177, 257, 437, 611, 407, 236, 283, 551, 683, 720, 741, 764, 800, 828,
+  272, 833, 0, 0, 78, 0, 691, 634, 0, 0, 0, 0, 0, 0, 0, 0,
+  183, 0, 699, 228, 798, 0, 0, 0, 21, 155, 865, 0, 0, 0, 731, 274,
+  701, 713, 0, 320, 0, 0, 0, 0, 1, 205, 997, 0, 362, 593, 0, 0,
+  0, 0, 0, 426, 75, 974, 0, 585, 191, 548, 0, 0, 0, 61, 708, 0,
+  425, 656, 834, 3, 862, 0, 0, 0, 0, 0, 0, 796, 790, 7, 765, 0,
+  20, 0, 0, 0, 0, 0, 0, 0, 18, 93, 307, 0, 0, 0, 482, 270,
+  776, 0, 0, 0, 0, 667, 0, 0, 0, 498, 0, 0, 504, 0, 138, 399,
+  260, 748, 86, 265, 0, 0, 0, 0, 0, 516, 916, 0, 450, 0, 0, 549,
+  0, 945, 0, 59, 0, 67, 198, 470, 532, 703, 788, 875, 0, 465, 0, 0,
+  0, 0, 0, 993, 0, 0, 990, 446, 0, 0, 0, 247, 921, 983, 0, 0,
+  0, 947, 672, 0, 0, 0, 0, 0, 0, 222, 316, 483, 856, 122, 957, 679,
+  43, 910, 400, 948, 0, 351, 0, 19, 0, 984, 0, 0, 886, 0, 0, 919,
+  816, 0, 0, 0, 0, 0, 0, 237, 602, 529, 0, 0, 939, 704, 0, 0,
+  0, 335, 0, 881, 637, 0, 0, 0, 762, 0, 0, 0, 615, 0, 0, 563,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 107, 319, 51, 705, 497, 581,
+  295, 348, 226, 230, 931, 935, 591, 187, 5, 394, 471, 768, 968, 973, 0, 0,
+  0, 0, 913, 0, 111, 98, 224, 374, 0, 0, 820, 660, 0, 0, 250, 702,
+  867, 0, 0, 106, 175, 304, 732, 743, 877, 0, 0, 454, 103, 456, 0, 0,
+  0, 279, 0, 567, 927, 0, 0, 0, 0, 0, 0, 0, 0, 0, 907, 0,
+  0, 54, 0, 556, 709, 639, 885, 0, 0, 0, 680, 0, 853, 413, 0, 0,
+  952, 0, 0, 0, 0, 332, 240, 84, 991, 114, 707, 461, 736, 121, 783, 575,
+  0, 0, 0, 144, 0, 29, 0, 157, 0, 958, 0, 353, 28, 359, 0, 0,
+  793, 0, 0, 0, 0, 0, 342, 0, 0, 438, 654, 727, 481, 0, 559, 0,
+  0, 0, 475, 0, 0, 0, 0, 0, 0, 329, 490, 90, 0, 414, 0, 0,
+  517, 0, 0, 0, 0, 0, 306, 0, 0, 690, 387, 980, 0, 0, 0, 757,
+  0, 0, 354, 870, 0, 0, 0, 254, 566, 0, 133, 0, 546, 0, 0, 0,
+  805, 395, 0, 0, 0, 521, 0, 0, 631, 0, 433, 733, 0, 96, 0, 964,
+  244, 813, 0, 0, 0, 0, 0, 0, 854, 0, 8, 0, 0, 0, 46, 245,
+};
+
+const char *WA_FREQ_101_TOKENS[] = {
+  "kesalul",
+  "me",
+  "talein",
+  "wen",
+  "gisipisgwa",
+  "t",
+  "talo",
+  "ltioq",
+  "teluisi",
+  "julien",
+  "ula",
+  "gjigan",
+  "teluisig",
+  "arras",
+  "tatuji",
+  "gneg",
+  "eteg",
+  "gta",
+  "n",
+  "laurie",
+};
+const uint16_t WA_FREQ_101_RANKS[] = {
+  0, 0, 12, 0, 5, 13, 0, 0, 0, 14, 20, 0, 0, 0, 0, 19,
+  0, 1, 7, 0, 0, 0, 15, 3, 10, 0, 0, 0, 0, 0, 0, 9,
+  0, 0, 6, 2, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 18, 11, 0, 16, 0, 0, 0, 8, 0, 0, 0, 0, 0, 17, 0,
+};
+
+const char *WA_FREQ_102_TOKENS[] = {
+  "元",
+  "на",
+  "и",
+  "во",
+  "се",
+  "од",
+  "за",
+  "да",
+  "со",
+  "е",
+  "дека",
+  "го",
+  "ќе",
+  "што",
+  "не",
+  "како",
+  "ја",
+  "ги",
+  "година",
+  "Во",
+  "кои",
+  "а",
+  "тоа",
+  "кој",
+  "по",
+  "до",
+  "која",
+  "но",
+  "има",
+  "Македонија",
+  "или",
+  "беше",
+  "бил",
+  "биде",
+  "може",
+  "повеќе",
+  "тој",
+  "кога",
+  "На",
+  "само",
+  "многу",
+  "сите",
+  "години",
+  "пред",
+  "еден",
+  "така",
+  "му",
+  "време",
+  "дел",
+  "други",
+  "поради",
+  "уште",
+  "им",
+  "околу",
+  "Според",
+  "биле",
+  "треба",
+  "па",
+  "една",
+  "овој",
+  "оваа",
+  "За",
+  "нема",
+  "каде",
+  "кон",
+  "Тој",
+  "меѓу",
+  "според",
+  "вели",
+  "била",
+  "тие",
+  "кај",
+  "страна",
+  "таа",
+  "исто",
+  "ова",
+  "додека",
+  "против",
+  "Од",
+  "неколку",
+  "под",
+  "Скопје",
+  "бидат",
+  "имаат",
+  "Со",
+  "било",
+  "би",
+  "милиони",
+  "Но",
+  "преку",
+  "евра",
+  "без",
+  "рече",
+  "Се",
+  "беа",
+  "работи",
+  "овие",
+  "бидејќи",
+  "некои",
+  "две",
+  "место",
+  "По",
+  "нив",
+  "број",
+  "неговата",
+  "три",
+  "својата",
+  "кое",
+  "ЕУ",
+  "своите",
+  "изјави",
+  "луѓе",
+  "веќе",
+  "Ова",
+  "при",
+  "крајот",
+  "него",
+  "градот",
+  "сега",
+  "врз",
+  "својот",
+  "И",
+  "два",
+  "Тоа",
+  "Како",
+  "ако",
+  "можат",
+  "текот",
+  "неговиот",
+  "првиот",
+  "светот",
+  "денеска",
+  "Србија",
+  "си",
+  "земјата",
+  "Европа",
+  "NGC",
+  "откако",
+  "над",
+  "Грција",
+  "цел",
+  "земји",
+  "пат",
+  "пак",
+  "век",
+  "работа",
+  "низ",
+  "голем",
+  "САД",
+  "2012",
+  "познати",
+  "ден",
+  "нови",
+  "Владата",
+  "Косово",
+  "Тие",
+  "начин",
+  "времето",
+  "ни",
+  "туку",
+  "освен",
+  "дали",
+  "годината",
+  "период",
+  "јазик",
+  "другите",
+  "повторно",
+  "државата",
+  "покрај",
+  "мора",
+  "бројот",
+  "помош",
+  "пати",
+  "нивните",
+  "наоѓа",
+  "Така",
+  "претседател",
+  "ниту",
+  "2011",
+  "заедно",
+  "затоа",
+  "започнува",
+  "дури",
+  "лица",
+  "помеѓу",
+  "смета",
+  "неговите",
+  "потоа",
+  "град",
+  "којшто",
+  "Таа",
+  "Не",
+  "објектот",
+  "долари",
+  "велат",
+  "името",
+  "декември",
+  "збор",
+  "групата",
+  "20",
+  "почетокот",
+  "поделба",
+  "станува",
+  "секој",
+  "дена",
+  "земја",
+  "едно",
+  "2010",
+  "пари",
+  "критериуми",
+  "10",
+  "група",
+  "Република",
+  "живот",
+  "прв",
+  "систем",
+  "Објектот",
+  "двете",
+  "оние",
+  "Сепак",
+  "иако",
+  "вклучен",
+  "месеци",
+  "договор",
+  "четири",
+  "истражувачи",
+  "истражувања",
+  "Каталогот",
+  "подоцна",
+  "отсто",
+  "пример",
+  "игра",
+  "различни",
+  "претставува",
+  "збирки",
+  "предмет",
+  "Ако",
+  "однос",
+  "односно",
+  "значи",
+  "нешто",
+  "некој",
+  "денес",
+  "голема",
+  "Европската",
+  "вршено",
+  "Проучување",
+  "различн",
+  "луѓето",
+  "Кога",
+  "споменува",
+  "Оваа",
+  "очекува",
+  "сепак",
+  "нов",
+  "јануари",
+  "врска",
+  "пет",
+  "места",
+  "избори",
+  "Објавено",
+  "Иако",
+  "1",
+  "претседателот",
+  "октомври",
+  "особено",
+  "име",
+  "првата",
+  "партија",
+  "држави",
+  "деца",
+  "користи",
+  "5",
+  "држава",
+  "тогаш",
+  "неговото",
+  "ноември",
+  "нивната",
+  "15",
+  "имаше",
+  "Овој",
+  "неа",
+  "недела",
+  "Германија",
+  "своето",
+  "пишува",
+  "проблеми",
+  "селото",
+  "македонски",
+  "постои",
+  "направи",
+  "Исто",
+  "часот",
+  "Турција",
+  "сака",
+  "често",
+  "2",
+  "30",
+  "септември",
+  "секоја",
+  "2009",
+  "рамките",
+  "политички",
+  "ми",
+  "добро",
+  "среќава",
+  "најважните",
+  "Бугарија",
+  "развој",
+  "граѓаните",
+  "ви",
+  "А",
+  "ниво",
+  "натпревар",
+  "бара",
+  "влада",
+  "новиот",
+  "колку",
+  "услови",
+  "центар",
+  "големи",
+  "метри",
+  "Хрватска",
+  "мај",
+  "користат",
+  "илјади",
+  "милијарди",
+  "нејзината",
+  "првите",
+  "победа",
+  "македонскиот",
+  "вода",
+  "НАТО",
+  "политика",
+  "разлика",
+  "12",
+  "македонската",
+  "нејзиниот",
+  "галаксии",
+  "март",
+  "ознаката",
+  "банка",
+  "случај",
+  "јуни",
+  "војна",
+  "владата",
+  "поддршка",
+  "PGC",
+  "сум",
+  "Република Македонија",
+  "толку",
+  "доби",
+  "Русија",
+  "прашање",
+  "тим",
+  "малку",
+  "4",
+  "жители",
+  "месец",
+  "Франција",
+  "април",
+  "3",
+  "Министерството",
+  "дела",
+  "објави",
+  "јули",
+  "соработка",
+  "вчера",
+  "сме",
+  "човек",
+  "нова",
+  "Груевски",
+  "друга",
+  "февруари",
+  "шест",
+  "победи",
+  "содржи",
+  "помалку",
+  "веднаш",
+  "себе",
+  "речиси",
+  "основа",
+  "оти",
+  "минути",
+  "досега",
+  "крај",
+  "прави",
+  "резултат",
+  "2008",
+  "доколку",
+  "состојба",
+  "она",
+  "минатата",
+  "денари",
+  "регионот",
+  "податоци",
+  "сезона",
+  "можност",
+  "полицијата",
+  "информации",
+  "календар",
+  "18",
+  "води",
+  "Сите",
+  "последните",
+  "Албанија",
+  "нивниот",
+  "дојде",
+  "годинава",
+  "11",
+  "Рим",
+  "целосно",
+  "улога",
+  "СДСМ",
+  "вид",
+  "филмот",
+  "заврши",
+  "суд",
+  "секогаш",
+  "август",
+  "премиер",
+  "ние",
+  "право",
+  "истакна",
+  "новата",
+  "проблем",
+  "Белград",
+  "свет",
+  "сили",
+  "власт",
+  "животот",
+  "таму",
+  "министер",
+  "криза",
+  "ред",
+  "нас",
+  "компании",
+  "целиот",
+  "Овие",
+  "делови",
+  "врати",
+  "мерењето",
+  "Поради",
+  "решение",
+  "стана",
+  "промени",
+  "настани",
+  "бараат",
+  "права",
+  "енергија",
+  "заштита",
+  "Британија",
+  "нашата",
+  "натпревари",
+  "групи",
+  "даде",
+  "сметаат",
+  "продолжи",
+  "медиуми",
+  "16",
+  "позната",
+  "друг",
+  "половина",
+  "нашите",
+  "македонските",
+  "Ќе",
+  "организација",
+  "прашања",
+  "100",
+  "сè",
+  "комисија",
+  "сте",
+  "црква",
+  "филм",
+  "куќа",
+  "имал",
+  "премиерот",
+  "Св",
+  "член",
+  "членови",
+  "познато",
+  "случи",
+  "вториот",
+  "имало",
+  "добие",
+  "граѓани",
+  "проценти",
+  "MCG",
+  "никогаш",
+  "6",
+  "процес",
+  "познат",
+  "14",
+  "знае",
+  "Некои",
+  "министерот",
+  "оди",
+  "економија",
+  "Затоа",
+  "тука",
+  "односи",
+  "истиот",
+  "Никола",
+  "Александар",
+  "одлука",
+  "мерки",
+  "отколку",
+  "план",
+  "2013",
+  "Италија",
+  "19",
+  "население",
+  "ништо",
+  "сакаат",
+  "Покрај",
+  "соопшти",
+  "компанија",
+  "најмногу",
+  "17",
+  "дело",
+  "самиот",
+  "сила",
+  "периодот",
+  "надворешни",
+  "изнесува",
+  "компанијата",
+  "Пред",
+  "постојат",
+  "13",
+  "Меѓутоа",
+  "претходно",
+  "2007",
+  "поголем",
+  "храна",
+  "Лондон",
+  "средства",
+  "вредност",
+  "работат",
+  "првенство",
+  "25",
+  "прочитана",
+  "Советот",
+  "производи",
+  "тврди",
+  "позиција",
+  "Земјата",
+  "култура",
+  "најчесто",
+  "останатите",
+  "нејзините",
+  "законот",
+  "економски",
+  "форма",
+  "поголема",
+  "дава",
+  "земјите",
+  "доаѓа",
+  "можеби",
+  "влијание",
+  "работата",
+  "километри",
+  "надвор",
+  "50",
+  "source",
+  "description",
+  "тимот",
+  "живеат",
+  "изграден",
+  "Дали",
+  "Шпанија",
+  "донесе",
+  "близина",
+  "истата",
+  "местото",
+  "2006",
+  "образование",
+  "поени",
+  "партии",
+  "освои",
+  "рок",
+  "проектот",
+  "село",
+  "случаи",
+  "власти",
+  "децата",
+  "јас",
+  "производство",
+  "Австралија",
+  "претставници",
+  "останува",
+  "институции",
+  "доволно",
+  "раст",
+  "седум",
+  "директор",
+  "Гора",
+  "заедница",
+  "цена",
+  "Црна",
+  "посебно",
+  "процесот",
+  "Кина",
+  "km",
+  "вкупно",
+  "8",
+  "зад",
+  "контрола",
+  "видови",
+  "часа",
+  "Њујорк",
+  "заради",
+  "целата",
+  "24",
+  "Македонците",
+  "простор",
+  "програма",
+  "проценува",
+  "областа",
+  "Статијата",
+  "наоѓаат",
+  "жени",
+  "До",
+  "тешко",
+  "момент",
+  "резултати",
+  "жена",
+  "Многу",
+  "светски",
+  "фаза",
+  "историјата",
+  "средба",
+  "пазар",
+  "значајни",
+  "постојано",
+  "натпреварот",
+  "народ",
+  "активности",
+  "втората",
+  "ѕвезди",
+  "полиција",
+  "некоја",
+  "власта",
+  "наместо",
+  "најголем",
+  "бизнис",
+  "унија",
+  "прашањето",
+  "населението",
+  "следната",
+  "токму",
+  "европски",
+  "цели",
+  "7",
+  "21",
+  "двата",
+  "Охрид",
+  "употреба",
+  "зошто",
+  "татко",
+  "вклучувајќи",
+  "новите",
+  "интерес",
+  "јавноста",
+  "Црна Гора",
+  "однесува",
+  "додаде",
+  "храм",
+  "стане",
+  "песни",
+  "најде",
+  "мали",
+  "црквата",
+  "Еден",
+  "Да",
+  "причина",
+  "сезоната",
+  "промена",
+  "Откако",
+  "негово",
+  "прва",
+  "Што",
+  "главниот",
+  "лице",
+  "ли",
+  "требало",
+  "имаме",
+  "нашиот",
+  "БиХ",
+  "утре",
+  "Америка",
+  "навистина",
+  "одредени",
+  "жените",
+  "Атина",
+  "Собранието",
+  "Брисел",
+  "првото",
+  "CGCG",
+  "коло",
+  "патот",
+  "десет",
+  "играат",
+  "училиште",
+  "браќата",
+  "основни",
+  "Претседателот",
+  "гледа",
+  "главно",
+  "дом",
+  "прават",
+  "семејство",
+  "мајка",
+  "договорот",
+  "тело",
+  "носи",
+  "медиумите",
+  "поврзани",
+  "центарот",
+  "немаат",
+  "прво",
+  "нивното",
+  "најави",
+  "40",
+  "почна",
+  "страни",
+  "дома",
+  "успех",
+  "зголеми",
+  "зголемување",
+  "ОН",
+  "музика",
+  "реката",
+  "одбрана",
+  "всушност",
+  "имале",
+  "албум",
+  "припаѓа",
+  "двајца",
+  "главен",
+  "т.е.",
+  "проект",
+  "Џон",
+  "никој",
+  "историја",
+  "извори",
+  "возраст",
+  "чини",
+  "безбедност",
+  "намалување",
+  "воопшто",
+  "2005",
+  "обично",
+  "покажува",
+  "закон",
+  "земјава",
+  "повеќето",
+  "г.",
+  "регион",
+  "пристап",
+  "смртта",
+  "градови",
+  "ве",
+  "случајот",
+  "движење",
+  "Ние",
+  "борба",
+  "проекти",
+  "политичка",
+  "де",
+  "Потоа",
+  "интернет",
+  "Сега",
+  "кариера",
+  "иднина",
+  "после",
+  "The",
+  "Има",
+  "Само",
+  "намали",
+  "површина",
+  "изборите",
+  "можно",
+  "осум",
+  "Римјаните",
+  "лига",
+  "живее",
+  "син",
+  "пазарот",
+  "почеток",
+  "Битола",
+  "Законот",
+  "започна",
+  "брзо",
+  "станал",
+  "Вардар",
+  "имала",
+  "војници",
+  "Црвенковски",
+  "клубот",
+  "ме",
+  "најдобар",
+  "јазици",
+  "преговори",
+  "големо",
+  "јасно",
+  "странски",
+  "понатаму",
+  "сектор",
+  "9",
+  "весникот",
+  "Јас",
+  "Доколку",
+  "совет",
+  "22",
+  "мрежа",
+  "последниот",
+  "втор",
+  "најмалку",
+  "лигата",
+  "2002",
+  "појави",
+  "нејзиното",
+  "Првата",
+  "Обама",
+  "Додека",
+  "2004",
+  "Романија",
+  "побара",
+  "одлуката",
+  "продажба",
+  "весник",
+  "Балканот",
+  "лидери",
+  "награда",
+  "изградба",
+  "парите",
+  "објекти",
+  "200",
+  "одржи",
+  "врски",
+  "опозицијата",
+  "проблемот",
+  "средината",
+  "организации",
+  "календарот",
+  "семејството",
+  "клуб",
+  "Словенија",
+  "денови",
+  "Велика",
+  "обезбеди",
+  "основале",
+  "преговорите",
+  "истражување",
+  "23",
+  "затвор",
+  "Денес",
+  "потврди",
+  "тема",
+  "ситуација",
+  "притисок",
+  "недели",
+  "Кај",
+  "американски",
+  "год",
+  "оружје",
+  "еднаш",
+  "добива",
+  "смрт",
+  "предизвика",
+  "европските",
+  "Македонската",
+  "финансии",
+  "хиџра",
+  "годишно",
+  "зборува",
+  "книга",
+  "телото",
+  "2001",
+  "добра",
+  "серија",
+  "возила",
+  "долг",
+  "песната",
+  "значење",
+  "општина",
+  "финансиски",
+  "услуги",
+  "случува",
+  "песна",
+  "финалето",
+  "оглед",
+  "линија",
+  "понеделник",
+  "партијата",
+  "претставник",
+  "Рем",
+  "г.п.н.е.",
+  "следните",
+  "Ромул",
+  "напад",
+  "Македонци",
+  "функција",
+  "г.п.н.е",
+  "753",
+  "свој",
+  "ДУИ",
+  "асирскиот",
+  "реши",
+  "4750",
+  "игри",
+  "обид",
+  "Асур",
+  "граот",
+  "средбата",
+  "цената",
+  "доста",
+  "избројана",
+  "Ab",
+  "condita",
+  "urbe",
+  "Босна",
+  "дете",
+  "остане",
+  "денот",
+  "небо",
+  "лесно",
+  "членство",
+  "успеа",
+  "поголеми",
+  "официјално",
+  "разни",
+  "најверојатно",
+  "посета",
+  "IC",
+  "Освен",
+  "свои",
+  "поранешниот",
+  "пласман",
+  "ВМРО-ДПМНЕ",
+  "добил",
+  "добијат",
+  "војната",
+  "светска",
+  "терен",
+  "трае",
+  "друго",
+  "чекор",
+  "отвори",
+  "своја",
+  "средина",
+  "барање",
+  "репрезентација",
+  "27",
+  "мене",
+  "област",
+  "помогне",
+  "воени",
+  "локалните",
+  "стил",
+  "Унијата",
+  "Нова",
+  "Свети",
+  "потребно",
+  "врвот",
+  "мала",
+  "боја",
+  "Нема",
+  "американскиот",
+  "зборови",
+  "инвестиции",
+  "реформи",
+  "причини",
+  "постигна",
+  "филмови",
+  "области",
+  "избор",
+  "листата",
+  "стои",
+  "Англија",
+  "учество",
+  "одговор",
+  "подобро",
+  "секретар",
+  "покажуваат",
+  "Првиот",
+  "потребни",
+  "26",
+  "нарекува",
+  "продолжува",
+  "протега",
+  "вработени",
+  "најголемиот",
+  "Универзитетот",
+  "податоците",
+  "развојот",
+  "двајцата",
+  "мал",
+  "потекло",
+  "Една",
+};
+const uint16_t WA_FREQ_102_RANKS[] = {
+  0, 0, 0, 0, 0, 622, 0, 0, 834, 437, 440, 99, 0, 0, 0, 0,
+  0, 0, 391, 0, 0, 0, 0, 0, 0, 0, 227, 525, 0, 0, 469, 0,
+  0, 0, 0, 117, 681, 886, 0, 0, 0, 0, 88, 514, 0, 0, 636, 0,
+  294, 404, 528, 0, 614, 0, 0, 115, 340, 0, 0, 0, 330, 0, 0, 0,
+  0, 0, 0, 426, 0, 0, 403, 583, 332, 582, 673, 617, 550, 0, 0, 0,
+  28, 206, 619, 187, 188, 566, 0, 0, 0, 0, 0, 0, 62, 653, 350, 936,
+  977, 0, 0, 0, 0, 795, 0, 0, 0, 0, 149, 0, 0, 547, 0, 0,
+  0, 0, 0, 993, 828, 0, 0, 0, 0, 0, 0, 0, 0, 710, 0, 0,
+  0, 0, 0, 0, 478, 265, 393, 0, 0, 999, 0, 113, 577, 0, 341, 876,
+  675, 0, 0, 0, 0, 0, 0, 798, 0, 480, 409, 835, 0, 510, 565, 76,
+  728, 40, 0, 0, 0, 0, 476, 726, 315, 0, 729, 0, 193, 53, 396, 172,
+  31, 786, 957, 522, 704, 872, 0, 0, 873, 455, 38, 0, 687, 0, 367, 208,
+  0, 0, 0, 0, 121, 625, 846, 0, 0, 0, 561, 213, 489, 587, 0, 0,
+  0, 554, 670, 116, 443, 867, 0, 724, 0, 0, 0, 0, 108, 0, 885, 754,
+  0, 0, 150, 790, 4, 0, 0, 0, 0, 444, 952, 0, 0, 0, 201, 0,
+  0, 0, 0, 752, 0, 0, 0, 282, 0, 0, 0, 192, 601, 0, 385, 248,
+  368, 679, 692, 746, 0, 0, 20, 0, 285, 39, 310, 479, 742, 924, 0, 457,
+  615, 0, 0, 33, 0, 0, 0, 501, 0, 0, 0, 850, 264, 0, 453, 526,
+  372, 705, 0, 25, 0, 689, 0, 442, 0, 0, 0, 0, 0, 467, 377, 492,
+  0, 0, 0, 13, 0, 0, 858, 0, 0, 0, 573, 0, 134, 0, 0, 0,
+  0, 0, 424, 0, 519, 0, 0, 0, 0, 516, 854, 0, 0, 0, 0, 0,
+  0, 949, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 972, 436, 0, 0,
+  0, 196, 0, 384, 449, 758, 12, 927, 22, 0, 0, 0, 277, 505, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 960, 629, 168, 59, 0, 0, 0, 0, 392,
+  0, 317, 0, 745, 0, 354, 740, 0, 0, 0, 0, 0, 880, 920, 996, 0,
+  0, 733, 218, 0, 517, 27, 563, 0, 0, 838, 0, 0, 148, 256, 661, 0,
+  643, 0, 0, 468, 412, 771, 0, 466, 667, 824, 0, 707, 774, 610, 805, 909,
+  220, 0, 0, 410, 211, 389, 623, 0, 0, 224, 0, 0, 950, 316, 893, 0,
+  842, 0, 0, 0, 821, 0, 401, 0, 0, 699, 905, 165, 532, 0, 278, 488,
+  815, 732, 892, 0, 0, 0, 0, 748, 0, 308, 451, 0, 307, 289, 69, 334,
+  431, 572, 0, 465, 0, 176, 624, 0, 0, 0, 0, 0, 0, 374, 240, 559,
+  796, 191, 953, 271, 363, 628, 0, 0, 0, 944, 0, 0, 0, 0, 130, 425,
+  0, 0, 0, 0, 0, 0, 0, 0, 242, 895, 0, 0, 0, 244, 0, 0,
+  0, 0, 72, 3, 0, 0, 0, 0, 0, 145, 0, 0, 0, 251, 241, 474,
+  837, 0, 0, 975, 922, 128, 293, 422, 581, 0, 0, 0, 0, 0, 0, 153,
+  0, 0, 0, 916, 832, 0, 0, 0, 0, 978, 651, 0, 0, 0, 0, 186,
+  875, 0, 0, 0, 0, 541, 779, 844, 225, 482, 452, 0, 30, 270, 484, 695,
+  903, 0, 0, 825, 984, 0, 0, 0, 0, 0, 169, 543, 811, 976, 862, 0,
+  0, 102, 0, 0, 0, 366, 0, 0, 0, 0, 0, 103, 0, 648, 159, 373,
+  891, 0, 441, 0, 0, 0, 896, 657, 0, 0, 530, 85, 253, 303, 521, 764,
+  702, 124, 300, 847, 889, 0, 775, 823, 0, 0, 454, 0, 0, 929, 24, 0,
+  0, 0, 257, 203, 534, 640, 0, 48, 0, 0, 0, 890, 0, 0, 0, 281,
+  0, 0, 923, 0, 849, 0, 0, 766, 772, 783, 254, 291, 580, 727, 261, 0,
+  112, 0, 0, 0, 855, 760, 238, 0, 0, 0, 937, 743, 0, 0, 0, 641,
+  0, 0, 198, 741, 0, 0, 0, 0, 0, 688, 0, 0, 782, 67, 0, 0,
+  971, 0, 0, 0, 719, 0, 132, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  808, 0, 286, 0, 247, 333, 0, 706, 313, 804, 0, 0, 183, 0, 0, 114,
+  1000, 0, 0, 0, 0, 0, 0, 0, 606, 0, 429, 0, 205, 0, 0, 836,
+  0, 0, 94, 175, 458, 0, 0, 542, 0, 0, 512, 177, 481, 0, 0, 351,
+  0, 229, 0, 0, 0, 322, 0, 0, 0, 0, 553, 0, 711, 0, 463, 461,
+  947, 0, 0, 11, 817, 0, 190, 0, 609, 1, 0, 900, 0, 163, 912, 0,
+  184, 0, 0, 338, 578, 0, 0, 120, 0, 540, 0, 298, 564, 620, 0, 414,
+  0, 50, 958, 0, 639, 369, 806, 0, 0, 759, 8, 138, 200, 933, 986, 549,
+  594, 545, 638, 973, 0, 685, 0, 0, 0, 0, 0, 357, 0, 787, 991, 0,
+  0, 0, 0, 158, 756, 0, 0, 0, 0, 387, 0, 0, 0, 0, 0, 95,
+  665, 0, 0, 0, 0, 931, 989, 406, 123, 0, 600, 0, 0, 0, 0, 328,
+  228, 626, 630, 678, 902, 0, 0, 197, 0, 0, 337, 0, 0, 0, 0, 0,
+  312, 407, 987, 0, 964, 721, 0, 762, 306, 144, 283, 260, 411, 0, 0, 0,
+  380, 0, 408, 533, 0, 0, 784, 0, 0, 0, 611, 871, 81, 0, 0, 0,
+  945, 331, 98, 0, 0, 612, 696, 329, 7, 119, 852, 570, 884, 691, 182, 74,
+  45, 339, 448, 513, 649, 969, 755, 345, 221, 439, 361, 537, 0, 355, 222, 680,
+  0, 0, 829, 0, 684, 0, 336, 487, 41, 236, 642, 0, 34, 475, 174, 255,
+  477, 770, 961, 904, 897, 0, 0, 35, 0, 0, 0, 141, 593, 362, 943, 204,
+  252, 305, 343, 58, 386, 6, 348, 473, 598, 780, 864, 968, 0, 0, 0, 0,
+  0, 353, 0, 376, 544, 955, 866, 0, 607, 23, 504, 940, 304, 645, 966, 503,
+  0, 139, 539, 0, 0, 0, 0, 0, 701, 0, 93, 68, 585, 423, 0, 0,
+  562, 302, 982, 0, 0, 43, 720, 82, 0, 0, 0, 0, 990, 0, 100, 0,
+  0, 37, 170, 16, 91, 498, 0, 0, 0, 0, 36, 0, 0, 491, 71, 789,
+  799, 0, 0, 0, 0, 131, 0, 0, 0, 66, 0, 0, 659, 279, 0, 0,
+  0, 381, 730, 65, 765, 0, 660, 0, 674, 0, 107, 567, 840, 974, 851, 0,
+  0, 266, 0, 0, 919, 0, 0, 0, 0, 0, 0, 797, 812, 865, 981, 0,
+  0, 135, 621, 133, 89, 508, 0, 0, 0, 0, 0, 0, 0, 60, 0, 0,
+  813, 722, 413, 0, 0, 0, 215, 769, 983, 0, 0, 0, 0, 0, 0, 0,
+  0, 433, 0, 0, 918, 717, 767, 0, 402, 0, 379, 0, 430, 0, 127, 0,
+  0, 574, 0, 311, 618, 0, 0, 0, 0, 0, 383, 0, 0, 0, 0, 0,
+  52, 262, 637, 0, 126, 0, 110, 0, 0, 490, 0, 78, 527, 73, 212, 446,
+  0, 0, 0, 0, 151, 0, 0, 395, 602, 415, 55, 883, 42, 0, 167, 0,
+  0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 358, 0, 0, 77, 0, 709,
+  731, 280, 0, 0, 364, 400, 0, 428, 658, 450, 877, 0, 0, 0, 802, 718,
+  0, 0, 0, 0, 171, 569, 375, 735, 0, 239, 0, 591, 0, 0, 0, 470,
+  518, 874, 723, 0, 267, 0, 744, 747, 0, 0, 0, 0, 0, 226, 0, 295,
+  359, 0, 0, 0, 807, 0, 0, 524, 0, 0, 502, 633, 708, 910, 0, 0,
+  0, 652, 0, 0, 0, 831, 356, 327, 456, 0, 0, 0, 0, 499, 0, 235,
+  809, 230, 0, 0, 250, 613, 0, 0, 18, 195, 0, 0, 0, 0, 830, 243,
+  965, 0, 0, 0, 0, 0, 0, 0, 596, 0, 0, 560, 0, 856, 0, 0,
+  118, 0, 0, 0, 0, 0, 939, 0, 0, 0, 0, 0, 0, 15, 785, 297,
+  714, 0, 608, 0, 0, 0, 0, 656, 233, 162, 352, 92, 29, 472, 0, 677,
+  676, 0, 0, 0, 0, 736, 863, 0, 899, 0, 0, 156, 166, 323, 632, 634,
+  0, 397, 0, 0, 0, 157, 816, 0, 0, 0, 946, 0, 934, 0, 0, 263,
+  0, 595, 0, 0, 0, 326, 0, 0, 0, 0, 0, 324, 0, 146, 194, 207,
+  697, 870, 941, 0, 394, 0, 0, 0, 0, 0, 0, 0, 0, 0, 483, 597,
+  0, 258, 926, 605, 777, 0, 57, 321, 0, 56, 0, 0, 365, 568, 419, 0,
+  0, 750, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 86, 268, 320, 0,
+  0, 588, 0, 0, 0, 599, 398, 571, 635, 0, 0, 0, 0, 757, 967, 0,
+  878, 942, 0, 273, 0, 0, 551, 0, 75, 753, 0, 0, 0, 0, 663, 335,
+  843, 447, 485, 0, 0, 0, 0, 0, 0, 96, 604, 819, 0, 161, 142, 494,
+  140, 690, 911, 0, 0, 907, 0, 460, 778, 459, 507, 0, 0, 0, 0, 0,
+  0, 0, 318, 0, 0, 0, 44, 0, 390, 0, 0, 853, 0, 901, 0, 0,
+  698, 0, 509, 0, 0, 0, 662, 928, 0, 917, 0, 0, 180, 0, 0, 994,
+  906, 995, 416, 0, 246, 703, 0, 0, 0, 9, 90, 382, 0, 0, 19, 49,
+  495, 237, 0, 0, 962, 0, 0, 548, 0, 5, 0, 915, 0, 0, 948, 0,
+  0, 0, 0, 506, 106, 223, 445, 2, 0, 0, 0, 0, 700, 0, 0, 792,
+  104, 814, 0, 147, 956, 734, 288, 0, 0, 0, 0, 644, 0, 0, 64, 462,
+  887, 109, 935, 493, 879, 737, 0, 627, 0, 0, 0, 0, 0, 0, 0, 217,
+  371, 827, 0, 0, 129, 296, 202, 32, 497, 287, 557, 749, 839, 47, 0, 0,
+  164, 349, 0, 0, 0, 405, 859, 0, 0, 603, 820, 199, 970, 0, 0, 173,
+  672, 0, 0, 486, 496, 552, 84, 154, 435, 683, 801, 101, 299, 54, 79, 210,
+  500, 399, 861, 314, 925, 739, 579, 776, 963, 869, 998, 0, 908, 420, 791, 87,
+  655, 179, 671, 0, 0, 0, 0, 979, 818, 921, 0, 0, 272, 669, 0, 0,
+  803, 417, 471, 0, 515, 590, 646, 894, 0, 189, 592, 21, 616, 178, 930, 992,
+  438, 997, 0, 0, 347, 245, 0, 761, 0, 342, 0, 0, 284, 738, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 136, 985, 0, 0, 0, 0, 0, 0, 0,
+  584, 0, 0, 0, 868, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 794, 841, 105, 0, 0, 0, 793, 0, 0, 0, 427, 631, 913, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 219, 269, 0, 0, 301, 0, 0, 980,
+  360, 511, 26, 434, 954, 0, 421, 0, 988, 122, 292, 432, 0, 0, 0, 418,
+  216, 0, 378, 0, 0, 576, 0, 0, 0, 0, 712, 46, 845, 768, 586, 882,
+  231, 0, 0, 0, 0, 0, 0, 344, 185, 0, 0, 0, 137, 232, 464, 589,
+  715, 654, 860, 0, 0, 0, 0, 97, 0, 0, 857, 0, 520, 0, 650, 0,
+  951, 531, 556, 800, 0, 0, 0, 0, 125, 0, 0, 0, 14, 319, 111, 234,
+  370, 682, 0, 0, 0, 0, 848, 0, 535, 826, 0, 0, 686, 694, 751, 0,
+  959, 536, 647, 143, 181, 575, 898, 538, 693, 0, 0, 529, 0, 546, 713, 773,
+  0, 0, 276, 275, 290, 932, 763, 810, 61, 716, 0, 0, 51, 0, 0, 0,
+  259, 0, 0, 781, 0, 725, 0, 888, 881, 0, 209, 0, 0, 0, 0, 0,
+  214, 668, 0, 0, 0, 63, 388, 523, 17, 0, 0, 0, 0, 0, 0, 833,
+  664, 558, 155, 938, 0, 0, 0, 0, 0, 788, 346, 0, 83, 0, 70, 274,
+  0, 0, 80, 0, 0, 0, 822, 0, 0, 152, 0, 0, 0, 0, 249, 0,
+  0, 0, 0, 0, 0, 0, 160, 555, 666, 914, 325, 0, 0, 309, 0, 0,
+};
+
+const char *WA_FREQ_103_TOKENS[] = {
+  "ഒരു",
+  "ഈ",
+  "എന്ന",
+  "അദ്ദേഹം",
+  "തന്നെ",
+  "നിന്ന്",
+  "ഏറ്റവും",
+  "നിന്നും",
+  "ഇത്",
+  "ചെയ്തു",
+  "എന്ന്",
+  "ആണ്",
+  "ആ",
+  "തന്റെ",
+  "വരെ",
+  "പ്രധാന",
+  "വലിയ",
+  "എന്നു",
+  "പിന്നീട്",
+  "ചില",
+  "സി",
+  "പല",
+  "ശേഷം",
+  "എന്നീ",
+  "പി",
+  "തിരുവനന്തപുരം",
+  "വളരെ",
+  "പുതിയ",
+  "കെ",
+  "എന്നും",
+  "ഇവിടെ",
+  "പറഞ്ഞു",
+  "അത്",
+  "എന്നാല്‍",
+  "അദ്ദേഹത്തിന്റെ",
+  "എല്ലാ",
+  "എം",
+  "കേരള",
+  "മറ്റു",
+  "രണ്ട്",
+  "മുതൽ",
+  "രണ്ടു",
+  "ഇദ്ദേഹം",
+  "സ്ഥിതി",
+  "തുടങ്ങിയ",
+  "കേരളത്തിലെ",
+  "സംസ്ഥാന",
+  "എന്നാണ്",
+  "ഇതിന്റെ",
+  "ഓഫ്",
+  "ആദ്യ",
+  "എന്നാൽ",
+  "ജില്ലയിലെ",
+  "ചെറിയ",
+  "മാത്രം",
+  "തുടങ്ങി",
+  "വിവിധ",
+  "മുതല്‍",
+  "അതിന്റെ",
+  "പറയുന്നു",
+  "പോലീസ്",
+  "കൊണ്ട്",
+  "ഇവ",
+  "ഓരോ",
+  "ആയിരുന്നു",
+  "ചെയ്യുന്നു",
+  "നടന്ന",
+  "മറ്റൊരു",
+  "എന്നിവ",
+  "അവരുടെ",
+  "കൊച്ചി",
+  "ചെയ്യുന്ന",
+  "ൽ",
+  "എസ്",
+  "കൂടുതല്‍",
+  "കൂടി",
+  "വഴി",
+  "നിരവധി",
+  "മികച്ച",
+  "അവിടെ",
+  "ചിത്രം",
+  "ആദ്യത്തെ",
+  "വീണ്ടും",
+  "പ്രസിഡന്റ്",
+  "കാരണം",
+  "പ്രത്യേക",
+  "സര്‍ക്കാര്‍",
+  "പക്ഷേ",
+  "ഉണ്ട്",
+  "ഇത്തരം",
+  "ദിവസം",
+  "വി",
+  "അഥവാ",
+  "ചെയ്ത",
+  "നടത്തിയ",
+  "മാത്രമേ",
+  "ഞാന്‍",
+  "കോഴിക്കോട്",
+  "ബി",
+  "ചെയ്യുന്നത്",
+  "വരുന്ന",
+  "ആദ്യമായി",
+  "ഇന്ന്",
+  "കൂടാതെ",
+  "സാധാരണ",
+  "മൂന്നു",
+  "വേണ്ടി",
+  "അവര്‍",
+  "നടത്തി",
+  "നിന്നു",
+  "സംവിധാനം",
+  "ഉള്ള",
+  "പോലെ",
+  "ഇന്ത്യന്‍",
+  "രണ്ടാം",
+  "നല്ല",
+  "പേര്",
+  "ദേശീയ",
+  "മറ്റും",
+  "ഏകദേശം",
+  "ആദ്യം",
+  "സെക്രട്ടറി",
+  "ന്",
+  "മറ്റ്",
+  "മൂലം",
+  "ജില്ലാ",
+  "വന്നു",
+  "മൂന്ന്",
+  "ഇന്ത്യയിലെ",
+  "ഇപ്പോള്‍",
+  "ഡി",
+  "എങ്കിലും",
+  "കൂടുതൽ",
+  "മലയാള",
+  "യു",
+  "ഏറെ",
+  "കാലത്ത്",
+  "ആയി",
+  "ജോലി",
+  "പേരിൽ",
+  "ഉപയോഗിച്ച്",
+  "സ്വന്തം",
+  "കാണാം",
+  "ഇന്ത്യൻ",
+  "നേടി",
+  "ടി",
+  "ഡോ",
+  "അടുത്ത",
+  "എ.",
+  "എന്നിവര്‍",
+  "കേന്ദ്ര",
+  "രൂപ",
+  "സമയം",
+  "മന്ത്രി",
+  "ഇന്ത്യ",
+  "ബ്രിട്ടീഷ്",
+  "അന്തരിച്ചു",
+  "ഇങ്ങനെ",
+  "കോടി",
+  "ക്ഷേത്രം",
+  "എന്റെ",
+  "സ്ഥാനം",
+  "രാഷ്ട്രീയ",
+  "അവ",
+  "10",
+  "പഴയ",
+  "ഇതു",
+  "പ്രകാരം",
+  "അങ്ങനെ",
+  "നിന്നുള്ള",
+  "രൂപം",
+  "കഴിഞ്ഞ",
+  "മാറി",
+  "ഒന്നാം",
+  "ലഭിച്ചു",
+  "വര്‍ഷം",
+  "അദ്ദേഹത്തെ",
+  "അവർ",
+  "പഞ്ചായത്ത്",
+  "പറയുന്നത്",
+  "രാവിലെ",
+  "തുടര്‍ന്ന്",
+  "പോലും",
+  "ഇംഗ്ലീഷ്",
+  "ല്‍",
+  "കി",
+  "പേരില്‍",
+  "തങ്ങളുടെ",
+  "ധാരാളം",
+  "ഉദ്ഘാടനം",
+  "കോടതി",
+  "നല്‍കി",
+  "ശതമാനം",
+  "ഇന്ത്യയുടെ",
+  "മുമ്പ്",
+  "ഇതിനു",
+  "കൊല്ലം",
+  "തുടർന്ന്",
+  "എന്നത്",
+  "വന്ന",
+  "കോളേജ്",
+  "ചലച്ചിത്ര",
+  "കോണ്‍ഗ്രസ്",
+  "വിവാഹം",
+  "യാത്ര",
+  "ഭാഗം",
+  "മാത്രമാണ്",
+  "വച്ച്",
+  "കുറഞ്ഞ",
+  "ഇതിനെ",
+  "നടക്കുന്ന",
+  "ഐ.",
+  "ചെയ്തത്",
+  "ചെയ്ത്",
+  "വർഷം",
+  "നിന്നാണ്",
+  "സ്വയം",
+  "നേടിയ",
+  "പ്രമുഖ",
+  "കഥ",
+  "സാമ്പത്തിക",
+  "ലക്ഷം",
+  "മുഹമ്മദ്",
+  "12",
+  "അതിനു",
+  "തമ്മിലുള്ള",
+  "നാലു",
+  "പദ്ധതി",
+  "തോമസ്",
+  "സമയത്ത്",
+  "സ്ഥലം",
+  "ഒരേ",
+  "ഭാഗമായി",
+  "2",
+  "അന്താരാഷ്ട്ര",
+  "കേരളത്തില്‍",
+  "ഏതാണ്ട്",
+  "ലെ",
+  "തമിഴ്",
+  "പകരം",
+  "എന്‍",
+  "20",
+  "ഇതില്‍",
+  "അതു",
+  "എ",
+  "നടത്തുന്ന",
+  "ജീവിതം",
+  "ഭാര്യ",
+  "ഇതിന്",
+  "മാത്രമല്ല",
+  "ചെയ്യും",
+  "അവയുടെ",
+  "ആധുനിക",
+  "എഴുതിയ",
+  "സാഹിത്യ",
+  "ഉപയോഗിക്കുന്ന",
+  "പാലക്കാട്",
+  "കമ്പനി",
+  "കോട്ടയം",
+  "മരിച്ചു",
+  "കാലം",
+  "കിലോമീറ്റർ",
+  "അറിയപ്പെടുന്നു",
+  "നിയമം",
+  "ആസ്",
+  "മുന്‍",
+  "ഉണ്ടായിരുന്നു",
+  "15",
+  "മുഖ്യമന്ത്രി",
+  "എണ്ണം",
+  "ജി",
+  "ദ",
+  "മാറ്റി",
+  "വരെയുള്ള",
+  "ഇതിൽ",
+  "അന്ന്",
+  "വിതരണം",
+  "കൂടിയ",
+  "എന്നിങ്ങനെ",
+  "5",
+  "വെള്ളം",
+  "രാത്രി",
+  "വിദ്യാഭ്യാസ",
+  "തരം",
+  "അമേരിക്കൻ",
+  "എന്നതാണ്",
+  "അറിയിച്ചു",
+  "വിഭാഗം",
+  "സർക്കാർ",
+  "അന്വേഷണം",
+  "പഠനം",
+  "വിദ്യാഭ്യാസം",
+  "സെന്റ്",
+  "തവണ",
+  "വരുന്നു",
+  "ഇന്നും",
+  "തന്നെയാണ്",
+  "ജനറല്‍",
+  "3",
+  "സംഗീത",
+  "മീറ്റർ",
+  "സംഘം",
+  "എല്ലാം",
+  "ആയ",
+  "ബന്ധപ്പെട്ട",
+  "കൃഷി",
+  "എന്നിവയാണ്",
+  "വെച്ച്",
+  "താഴെ",
+  "രണ്ടാമത്തെ",
+  "എറണാകുളം",
+  "ഇവരുടെ",
+  "പുരസ്കാരം",
+  "ഐ",
+  "30",
+  "മരണം",
+  "നമ്മുടെ",
+  "അവരെ",
+  "പോയി",
+  "പണം",
+  "ശ്രീ",
+  "ആലപ്പുഴ",
+  "നേതൃത്വം",
+  "ലോകത്തിലെ",
+  "മിക്ക",
+  "ഇവര്‍",
+  "കേരളത്തിൽ",
+  "ഭൂമി",
+  "ഇന്നത്തെ",
+  "അതിനെ",
+  "മാസം",
+  "കണ്ടു",
+  "ന്യൂഡല്‍ഹി",
+  "അഞ്ച്",
+  "നാല്",
+  "അതേ",
+  "കമ്മിറ്റി",
+  "സ്വകാര്യ",
+  "ഉപയോഗിക്കുന്നത്",
+  "അക്കാദമി",
+  "കണ്ണൂര്‍",
+  "മലയാളം",
+  "രീതി",
+  "1",
+  "അധികം",
+  "പ്രശസ്ത",
+  "കരുതുന്നു",
+  "വീട്ടില്‍",
+  "ഇപ്പോൾ",
+  "നല്‍കിയ",
+  "ജോസഫ്",
+  "പള്ളി",
+  "ഭരണം",
+  "അദ്ദേഹത്തിന്",
+  "ചരിത്രം",
+  "അഞ്ചു",
+  "അമ്മ",
+  "ആണ്‌",
+  "മലപ്പുറം",
+  "ലഭിച്ച",
+  "പിന്നെ",
+  "യുടെ",
+  "വില",
+  "വേണം",
+  "25",
+  "വന്നത്",
+  "കഴിയും",
+  "സംബന്ധിച്ച",
+  "ഇനി",
+  "ഏതെങ്കിലും",
+  "ആവശ്യപ്പെട്ടു",
+  "മുഴുവന്‍",
+  "ക്രിക്കറ്റ്",
+  "അന്നത്തെ",
+  "പേര്‍",
+  "കേസ്",
+  "റിപ്പോര്‍ട്ട്",
+  "പോലുള്ള",
+  "വിശ്വാസം",
+  "ജനുവരി",
+  "11",
+  "4",
+  "നടന്നു",
+  "ജനനം",
+  "തുടക്കം",
+  "ഇപ്പോഴും",
+  "പ്രാധാന്യം",
+  "ഇതേ",
+  "യോഗം",
+  "പലപ്പോഴും",
+  "ബാങ്ക്",
+  "വൈദ്യുതി",
+  "ആരംഭിച്ചു",
+  "നടപടി",
+  "മെഡിക്കല്‍",
+  "എന്നായിരുന്നു",
+  "കാണുന്ന",
+  "കിലോമീറ്റര്‍",
+  "സ്ഥലത്ത്",
+  "മൂന്നാം",
+  "6",
+  "ചോദ്യം",
+  "കഴിഞ്ഞു",
+  "നായര്‍",
+  "എല്‍",
+  "ഒട്ടേറെ",
+  "ശക്തമായ",
+  "പുറത്തിറങ്ങിയ",
+  "നൽകി",
+  "ഏതാനും",
+  "ലക്ഷ്യം",
+  "അവസാന",
+  "ഒന്നും",
+  "സ്‌കൂള്‍",
+  "കാര്യം",
+  "ബന്ധം",
+  "2008",
+  "ഞങ്ങള്‍",
+  "പക്ഷെ",
+  "കണ്ടെത്തി",
+  "അതുകൊണ്ട്",
+  "പാര്‍ട്ടി",
+  "ഇദ്ദേഹത്തിന്റെ",
+  "മുഖ്യ",
+  "ആര്‍",
+  "അതില്‍",
+  "8",
+  "റോഡ്",
+  "ലോക",
+  "വ്യത്യസ്ത",
+  "സമിതി",
+  "ചെയര്‍മാന്‍",
+  "ഭക്ഷണം",
+  "മാറ്റം",
+  "50",
+  "ലഭിക്കുന്ന",
+  "16",
+  "അതായത്",
+  "14",
+  "പ്രത്യേകം",
+  "ഇവർ",
+  "കൈകാര്യം",
+  "നിലവിൽ",
+  "18",
+  "എനിക്ക്",
+  "ജൂലൈ",
+  "ബന്ധപ്പെട്ട്",
+  "ഇന്ത്യയിൽ",
+  "വൈസ്",
+  "2009",
+  "അറിയപ്പെടുന്ന",
+  "സംബന്ധിച്ച്",
+  "സിനിമ",
+  "നിലയിൽ",
+  "ഇവയുടെ",
+  "ചേര്‍ന്ന്",
+  "സംഗീതം",
+  "വരും",
+  "രാജ്യത്തെ",
+  "അനുസരിച്ച്",
+  "ആകെ",
+  "കൊണ്ടു",
+  "പ്രധാനമായും",
+  "പുസ്തകം",
+  "സമ്മേളനം",
+  "ജനിച്ചു",
+  "സ്വതന്ത്ര",
+  "എഫ്",
+  "ലഭിച്ചത്",
+  "അതിന്",
+  "ചെയ്യാന്‍",
+  "ചീഫ്",
+  "അമേരിക്കന്‍",
+  "സംഭവം",
+  "കൂടെ",
+  "കേരളത്തിന്റെ",
+  "കഴിഞ്ഞ്",
+  "പ്രദേശം",
+  "7",
+  "2006",
+  "2010",
+  "ഇന്ത്യയില്‍",
+  "രോഗം",
+  "സാങ്കേതിക",
+  "നിലയില്‍",
+  "ദി",
+  "കേന്ദ്രം",
+  "തൃശ്ശൂര്‍",
+  "ഫെബ്രുവരി",
+  "വിവരങ്ങള്‍",
+  "വഹിച്ചു",
+  "2007",
+  "മൊത്തം",
+  "രാജ്യം",
+  "തിരഞ്ഞെടുപ്പ്",
+  "കടന്നു",
+  "തിരിച്ചു",
+  "മുൻപ്",
+  "മൊബൈല്‍",
+  "തുടങ്ങിയത്",
+  "ലോട്ടറി",
+  "കേസില്‍",
+  "യുദ്ധം",
+  "13",
+  "നേതൃത്വത്തില്‍",
+  "രീതിയിൽ",
+  "ചെയ്തിരുന്നു",
+  "തുടങ്ങിയവ",
+  "മുന്നില്‍",
+  "ഹൈക്കോടതി",
+  "അടി",
+  "ഏപ്രിൽ",
+  "വകുപ്പ്",
+  "അവസാനം",
+  "പാർട്ടി",
+  "അറസ്റ്റ്",
+  "മറുപടി",
+  "അറിയപ്പെടുന്നത്",
+  "എഴുതി",
+  "വിജയം",
+  "തീരുമാനിച്ചു",
+  "കൃതി",
+  "നഗരം",
+  "പുറമേ",
+  "പ്രധാനപ്പെട്ട",
+  "അതിൽ",
+  "100",
+  "9",
+  "നീക്കം",
+  "മാര്‍ച്ച്",
+  "രാജ്യത്തിന്റെ",
+  "ഉയര്‍ന്ന",
+  "താന്‍",
+  "ആറു",
+  "നീണ്ട",
+  "ഇവിടത്തെ",
+  "പദം",
+  "പരേതനായ",
+  "ശ്രദ്ധ",
+  "സാമൂഹിക",
+  "ഇതുവരെ",
+  "ഹിന്ദി",
+  "കാണാന്‍",
+  "കേരളം",
+  "ചേർന്ന്",
+  "ശരാശരി",
+  "സ്കൂൾ",
+  "of",
+  "നടത്തിയത്",
+  "അധികാരം",
+  "പലരും",
+  "ബാംഗ്ലൂര്‍",
+  "രംഗത്ത്",
+  "നികുതി",
+  "24",
+  "നേതാവ്",
+  "വിളിക്കുന്നു",
+  "അമേരിക്കയിലെ",
+  "മീറ്റര്‍",
+  "വ്യാഴാഴ്ച",
+  "നിറഞ്ഞ",
+  "അല്ലെങ്കില്‍",
+  "40",
+  "തമ്മിൽ",
+  "നേരിട്ട്",
+  "ഉപയോഗിക്കുന്നു",
+  "പുരാതന",
+  "ജസ്റ്റിസ്",
+  "ആറ്",
+  "മാതൃഭൂമി",
+  "വിവരം",
+  "അനുമതി",
+  "പേരു",
+  "മക്കള്‍",
+  "ബുധനാഴ്ച",
+  "17",
+  "കരുതപ്പെടുന്നു",
+  "പരാതി",
+  "നവംബർ",
+  "പങ്കെടുത്തു",
+  "ഫിബ്രവരി",
+  "എച്ച്",
+  "കടുത്ത",
+  "ഭാഗത്ത്",
+  "ജില്ലയിൽ",
+  "ഹിന്ദു",
+  "ഡിസംബർ",
+  "സേവനം",
+  "അല്ലെങ്കിൽ",
+  "അവസരം",
+  "ജെ",
+  "ഒന്ന്",
+  "ശനിയാഴ്ച",
+  "മെയ്",
+  "രചിച്ച",
+  "ഒന്നാണ്",
+  "നാം",
+  "എന്നെ",
+  "നടത്തുന്നത്",
+  "പ്രാഥമിക",
+  "അതിനാല്‍",
+  "അവാര്‍ഡ്",
+  "ജൂൺ",
+  "രീതിയില്‍",
+  "ഭാരതീയ",
+  "ഏതു",
+  "മാർച്ച്",
+  "റെയില്‍വേ",
+  "കാര്യങ്ങള്‍",
+  "അടിസ്ഥാന",
+  "ഞായറാഴ്ച",
+  "തീരുമാനം",
+  "നല്‍കുന്ന",
+  "പരിശീലനം",
+  "വാദം",
+  "സമരം",
+  "പേർ",
+  "മുന്‍പ്",
+  "ആന്‍ഡ്",
+  "നടന്നത്",
+  "കറുത്ത",
+  "പറയുന്ന",
+  "സഹായം",
+  "കുറച്ചു",
+  "അതേസമയം",
+  "ഉയർന്ന",
+  "കണ്ട്",
+  "പറയാം",
+  "ചിത്രത്തിന്റെ",
+  "ശ്രമം",
+  "പ്രസംഗിച്ചു",
+  "ഡയറക്ടര്‍",
+  "ദൂരം",
+  "പോകുന്ന",
+  "സാധാരണയായി",
+  "വേണ്ട",
+  "ലോകത്തെ",
+  "ഉയരം",
+  "ഒക്ടോബർ",
+  "മേയ്",
+  "കാര്യത്തില്‍",
+  "ആവശ്യം",
+  "എന്നറിയപ്പെടുന്ന",
+  "കീഴിൽ",
+  "തമ്മില്‍",
+  "കമ്പനിയുടെ",
+  "ജില്ലയില്‍",
+  "ലീഗ്",
+  "ഓഫീസ്",
+  "ഇല്ല",
+  "നിലവില്‍",
+  "എങ്ങനെ",
+  "വെള്ളിയാഴ്ച",
+  "എന്നിവയുടെ",
+  "നന്നായി",
+  "തിങ്കളാഴ്ച",
+  "സംസാരിച്ചു",
+  "ഇപ്പോഴത്തെ",
+  "ചര്‍ച്ച",
+  "അലി",
+  "ഇ.",
+  "പ്രദേശത്ത്",
+  "പൊതു",
+  "പ്രഖ്യാപിച്ചു",
+  "ചെയ്യുക",
+  "നൂറ്റാണ്ടിന്റെ",
+  "നിലപാട്",
+  "കരുതി",
+  "ശവസംസ്‌കാരം",
+  "ബിരുദം",
+  "കഴിയുന്ന",
+  "എന്നിവയും",
+  "പുരസ്‌കാരം",
+  "ഏക",
+  "വരുന്നത്",
+  "ആഭ്യന്തര",
+  "വന്‍",
+  "കൂടിയാണ്",
+  "നൂറ്റാണ്ടിൽ",
+  "ഭൂമിയുടെ",
+  "തുക",
+  "പേരും",
+  "മുഴുവൻ",
+  "എത്ര",
+  "ഒടുവില്‍",
+  "പിതാവ്",
+  "22",
+  "ഇന്ത്യാ",
+  "ലഭ്യമാണ്",
+  "നടക്കും",
+  "മുംബൈ",
+  "നടക്കുന്നത്",
+  "വൈകീട്ട്",
+  "സ്",
+  "സ്ഥിതിചെയ്യുന്ന",
+  "പ്രാദേശിക",
+  "അപേക്ഷിച്ച്",
+  "ശക്തി",
+  "പ്രധാനമന്ത്രി",
+  "സഹായത്തോടെ",
+  "പ്രവര്‍ത്തനം",
+  "അതിനാൽ",
+  "അസോസിയേഷന്‍",
+  "പുറത്ത്",
+  "കമ്മീഷന്‍",
+  "നിലവിലുള്ള",
+  "വളരെയധികം",
+  "മഴ",
+  "കുറിച്ച്",
+  "നമുക്ക്",
+  "19",
+  "ചൊവ്വാഴ്ച",
+  "പ്രദേശത്തെ",
+  "ആരംഭിച്ച",
+  "സര്‍ക്കാരിന്റെ",
+  "ഓഗസ്റ്റ്",
+  "സംസ്ഥാനത്തെ",
+  "ഡിസംബര്‍",
+  "സാധ്യത",
+  "ജനങ്ങളുടെ",
+  "നേരത്തെ",
+  "എത്തി",
+  "ചെയ്തിട്ടുണ്ട്",
+  "23",
+  "ഇതിനായി",
+  "കമ്മ്യൂണിസ്റ്റ്",
+  "അല്പം",
+  "കവി",
+  "കിടക്കുന്ന",
+  "ഭാഷ",
+  "നല്‍കാന്‍",
+  "പറയപ്പെടുന്നു",
+  "വികസന",
+  "ദിവസവും",
+  "ഒപ്പം",
+  "മകന്‍",
+  "ചിത്രത്തിലെ",
+  "സമീപം",
+  "നു",
+  "പെട്ടെന്ന്",
+  "പ്രത്യേകത",
+  "ഫിലിം",
+  "രാജാവ്",
+  "ഇവിടുത്തെ",
+  "തിരഞ്ഞെടുപ്പില്‍",
+  "അമേരിക്ക",
+  "ഫോണ്‍",
+  "വിദേശ",
+  "ചെന്നൈ",
+  "സംഘടന",
+  "ജനവരി",
+  "ജോൺ",
+  "താലൂക്കിൽ",
+  "വ്യക്തമാക്കി",
+  "ഇവരെ",
+  "ജോണ്‍",
+  "താമസം",
+  "വനിതാ",
+  "അക്കാലത്ത്",
+  "പഞ്ചായത്തിലെ",
+  "സാധിക്കും",
+  "കാണുന്നത്",
+  "പ്രശസ്തമായ",
+  "ഏഴു",
+  "ബ്ലോക്ക്",
+  "വെറും",
+  "പത്തു",
+  "പാത",
+  "മുൻ",
+  "പങ്ക്",
+  "ലോകം",
+  "2000",
+  "ചെയ്യാൻ",
+  "കണ്ട",
+  "മനുഷ്യന്റെ",
+  "നാലാം",
+  "വിധി",
+  "പറഞ്ഞ്",
+  "21",
+  "കുടുംബം",
+  "വയസ്സിൽ",
+  "നമ്പൂതിരി",
+  "ബസ്",
+  "ഇടുക്കി",
+  "തരത്തിലുള്ള",
+  "പത്ത്",
+  "സോഷ്യലിസ്റ്റ്",
+  "പറഞ്ഞത്",
+  "പരിസ്ഥിതി",
+  "2011",
+  "ഇവയെ",
+  "പൊതുവേ",
+  "അധ്യക്ഷത",
+  "ശബ്ദം",
+  "സ്വാധീനം",
+  "ഒരിക്കലും",
+  "താൻ",
+  "നാഷണൽ",
+  "28",
+  "26",
+  "അനേകം",
+  "ആവശ്യമായ",
+  "വ്യവസായ",
+  "60",
+  "ഇതോടെ",
+  "നോക്കി",
+  "യൂണിയന്‍",
+  "നേതൃത്വത്തിൽ",
+  "വീതം",
+  "എട്ട്",
+  "മുസ്‌ലിം",
+  "അത്തരം",
+  "അധികൃതര്‍",
+  "അഭിപ്രായം",
+  "കുറച്ച്",
+  "നാടകം",
+  "മിക്കവാറും",
+  "ഉന്നത",
+  "അഡ്വ",
+  "ഗ്രാമപഞ്ചായത്ത്",
+  "കാണപ്പെടുന്നു",
+  "ചിത്രത്തിൽ",
+  "കോടതിയില്‍",
+  "ചെയ്യുകയും",
+  "ചൈനീസ്",
+  "അംഗം",
+  "ഔദ്യോഗിക",
+  "കാണപ്പെടുന്ന",
+  "കുട്ടികളുടെ",
+  "ഏഴ്",
+  "കാര്യമായ",
+  "നീളം",
+  "നേതൃത്വത്തിലുള്ള",
+  "സ്വീകരിച്ചു",
+  "സെപ്റ്റംബർ",
+  "നാഷണല്‍",
+  "മത്സരം",
+  "യാതൊരു",
+  "അവര്‍ക്ക്",
+  "എല്ലാവരും",
+  "തികച്ചും",
+  "ഗ്രൂപ്പ്",
+  "വധശിക്ഷ",
+  "അംഗീകാരം",
+  "ചിത്രങ്ങള്‍",
+  "നിയമനം",
+  "രണ്ടും",
+  "സര്‍വീസ്",
+  "27",
+  "പ്രവര്‍ത്തിക്കുന്ന",
+  "വ്യക്തമായ",
+  "കണ്ണൂർ",
+  "വീട്",
+  "ഉപയോഗിച്ചു",
+  "എപ്പോഴും",
+  "തിരികെ",
+  "കമ്പ്യൂട്ടര്‍",
+  "ഫലം",
+  "ലഭിക്കും",
+  "നവംബര്‍",
+  "അഭിനയിച്ചു",
+  "ഗ്രീക്ക്",
+  "നിര്‍ദേശം",
+  "പിള്ള",
+  "അതുപോലെ",
+  "ഫ്രഞ്ച്",
+  "നിശ്ചിത",
+  "കൂടുതലായി",
+  "ചുറ്റും",
+  "മലബാര്‍",
+  "ശരിയായ",
+  "നിർമ്മിച്ച",
+  "ഫലമായി",
+  "ആരും",
+  "പുറത്തു",
+  "ജോര്‍ജ്",
+  "ശാസ്ത്ര",
+  "ഉപയോഗം",
+  "സി.",
+  "ഏപ്രില്‍",
+  "എന്നാണ്‌",
+  "ജനിച്ചത്",
+  "ശിക്ഷ",
+  "ശരീരം",
+  "ആക്രമണം",
+  "കൃത്യമായി",
+  "പത്രിയില്‍",
+  "തുടർന്നു",
+  "മുകളില്‍",
+  "വീഡിയോ",
+  "ജനിച്ച",
+  "തേടി",
+  "സ്ത്രീ",
+  "പണി",
+  "പരമാവധി",
+  "സംസ്ഥാനത്ത്",
+  "ന്റെ",
+  "വന്ന്",
+  "ചുമതല",
+  "മേഖലയിലെ",
+  "സഭ",
+  "സ്റ്റേറ്റ്",
+  "യോഗത്തില്‍",
+  "സംഘടനയുടെ",
+  "എന്നിവരുടെ",
+  "കീഴിലുള്ള",
+  "പ്രത്യേകിച്ച്",
+  "കയറി",
+  "തനിക്ക്",
+  "ഇതിലെ",
+  "വേഗം",
+  "2001",
+  "വിവരങ്ങൾ",
+  "2005",
+  "കമ്യൂണിസ്റ്റ്",
+  "സമ്മാനം",
+  "കൊണ്ടാണ്",
+  "തെക്കേ",
+  "പോയ",
+  "നിയമസഭാ",
+  "പത്രസമ്മേളനത്തില്‍",
+  "സൈനിക",
+  "ഒന്നു",
+  "കോളേജിൽ",
+  "ബോര്‍ഡ്",
+  "പിന്തുണ",
+  "പലതും",
+  "2012",
+  "കണ്ടെത്തിയത്",
+  "നേരെ",
+  "പെട്ട",
+  "സഹകരണ",
+  "ഉണ്ടാകും",
+  "ബാക്കി",
+  "ഗവേഷണ",
+  "ജനങ്ങള്‍",
+  "ജനറൽ",
+  "വയനാട്",
+  "സുപ്രീം",
+  "ചികിത്സ",
+  "പദ്ധതിയുടെ",
+  "വാങ്ങി",
+  "ജോസ്",
+  "മേഖലയില്‍",
+  "ശേഷമാണ്",
+  "ഇനിയും",
+  "ഏത്",
+  "പുറമെ",
+  "കോളേജില്‍",
+  "കുട്ടി",
+  "കോൺഗ്രസ്",
+  "അവാർഡ്",
+  "ആദ്യകാല",
+  "പത്തനംതിട്ട",
+  "പ്രതി",
+  "വിളിച്ചു",
+  "സ്വന്തമായി",
+  "ചതുരശ്ര",
+  "പ്രവേശനം",
+  "നഗരത്തിലെ",
+  "റേഡിയോ",
+  "ടീം",
+  "ബാലകൃഷ്ണന്‍",
+  "യൂത്ത്",
+  "അയാളുടെ",
+  "പ്രായം",
+  "എന്‍ഡോസള്‍ഫാന്‍",
+  "കാരണമായി",
+  "നടപടികള്‍",
+  "പ്രവർത്തനം",
+  "മതി",
+  "200",
+  "പരമ്പരാഗത",
+  "അപേക്ഷ",
+  "നൽകിയ",
+  "പ്രവർത്തിക്കുന്ന",
+  "ഭാഷയിൽ",
+  "മാത്യു",
+  "രൂപയുടെ",
+  "തുടങ്ങിയവര്‍",
+  "മുകളിൽ",
+  "അപ്പോള്‍",
+  "വ്യവസ്ഥ",
+  "ചിത്രങ്ങൾ",
+  "നടത്താന്‍",
+  "സാംസ്കാരിക",
+  "ഇതാണ്",
+  "തൊഴിലാളി",
+  "പതിവ്",
+  "മരുമക്കള്‍",
+  "ഇ",
+  "നല്‍കിയത്",
+  "എൻ",
+  "ജനസംഖ്യ",
+  "പദവി",
+  "മീ",
+  "സ്വദേശി",
+  "അഴിമതി",
+  "അവതരിപ്പിച്ചു",
+  "നില്‍ക്കുന്ന",
+};
+const uint16_t WA_FREQ_103_RANKS[] = {
+  0, 279, 609, 0, 850, 865, 0, 0, 778, 0, 0, 189, 0, 0, 42, 246,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 456, 0, 476, 527,
+  568, 0, 0, 661, 0, 0, 186, 0, 632, 0, 0, 931, 0, 0, 0, 175,
+  0, 164, 154, 0, 0, 941, 311, 616, 955, 0, 362, 13, 0, 0, 525, 0,
+  0, 0, 0, 0, 0, 0, 523, 78, 582, 0, 0, 333, 509, 0, 0, 0,
+  0, 222, 0, 0, 0, 317, 854, 641, 205, 406, 536, 658, 513, 479, 830, 0,
+  0, 736, 0, 0, 877, 0, 0, 578, 572, 0, 0, 400, 968, 0, 0, 0,
+  0, 0, 620, 731, 896, 0, 0, 0, 0, 802, 986, 0, 0, 25, 0, 0,
+  0, 0, 0, 0, 520, 0, 0, 0, 0, 705, 0, 159, 0, 0, 0, 988,
+  703, 0, 171, 0, 0, 0, 0, 627, 0, 0, 411, 0, 0, 0, 454, 666,
+  0, 0, 0, 161, 0, 0, 0, 0, 306, 0, 323, 681, 0, 470, 0, 36,
+  533, 586, 0, 0, 0, 40, 0, 0, 0, 605, 0, 0, 0, 0, 0, 481,
+  461, 296, 384, 855, 0, 873, 0, 589, 0, 116, 208, 451, 0, 312, 374, 247,
+  542, 712, 238, 745, 788, 910, 0, 185, 0, 0, 0, 0, 57, 213, 455, 0,
+  859, 950, 928, 0, 198, 752, 510, 897, 0, 0, 263, 749, 813, 473, 963, 0,
+  188, 293, 0, 0, 0, 0, 443, 0, 702, 0, 0, 974, 0, 794, 728, 0,
+  0, 7, 274, 321, 0, 781, 978, 314, 355, 424, 653, 0, 0, 0, 0, 561,
+  0, 10, 938, 460, 0, 0, 465, 0, 0, 0, 0, 387, 0, 0, 0, 0,
+  0, 981, 55, 0, 337, 738, 113, 371, 490, 534, 0, 564, 0, 719, 0, 637,
+  0, 0, 157, 383, 760, 898, 169, 0, 0, 0, 0, 111, 0, 0, 0, 0,
+  0, 33, 142, 163, 467, 576, 289, 558, 732, 0, 0, 0, 606, 320, 0, 0,
+  0, 0, 0, 643, 740, 0, 0, 377, 573, 0, 0, 0, 5, 0, 725, 0,
+  0, 550, 0, 832, 0, 0, 0, 0, 178, 230, 0, 0, 544, 980, 971, 0,
+  843, 747, 291, 0, 0, 0, 0, 0, 482, 0, 815, 720, 265, 904, 469, 449,
+  0, 0, 345, 423, 0, 0, 0, 0, 386, 431, 447, 334, 110, 566, 809, 270,
+  491, 878, 0, 0, 0, 38, 435, 762, 276, 137, 972, 0, 0, 704, 197, 200,
+  260, 668, 983, 1000, 0, 709, 0, 0, 0, 0, 0, 420, 543, 546, 583, 220,
+  595, 0, 0, 381, 165, 417, 0, 0, 0, 526, 959, 0, 0, 786, 792, 579,
+  825, 214, 915, 539, 0, 0, 0, 0, 659, 0, 0, 360, 492, 364, 0, 753,
+  0, 64, 0, 0, 0, 350, 759, 354, 787, 0, 0, 0, 0, 976, 0, 0,
+  14, 628, 701, 0, 0, 0, 710, 0, 0, 649, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 841, 0, 750, 11, 671, 0, 863, 942, 201, 918, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 771, 0, 0, 0, 179,
+  0, 0, 0, 0, 0, 0, 954, 0, 672, 0, 517, 0, 139, 599, 0, 229,
+  944, 0, 0, 0, 596, 0, 707, 340, 318, 540, 906, 16, 184, 958, 162, 597,
+  706, 973, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 408, 101, 282, 349,
+  789, 39, 0, 322, 0, 764, 466, 0, 0, 0, 60, 0, 0, 553, 888, 0,
+  602, 0, 261, 727, 0, 29, 0, 0, 680, 133, 776, 0, 965, 0, 833, 0,
+  0, 0, 0, 398, 0, 0, 0, 512, 0, 0, 0, 413, 395, 934, 0, 0,
+  278, 0, 782, 0, 0, 0, 0, 0, 0, 0, 0, 0, 562, 402, 908, 0,
+  0, 0, 0, 0, 917, 0, 812, 726, 336, 729, 0, 722, 0, 630, 860, 375,
+  0, 0, 875, 0, 257, 0, 0, 0, 88, 0, 0, 0, 52, 0, 0, 0,
+  0, 0, 594, 0, 0, 0, 223, 0, 419, 440, 0, 485, 929, 0, 819, 328,
+  358, 0, 0, 0, 724, 949, 730, 0, 107, 370, 407, 532, 556, 868, 0, 0,
+  488, 862, 0, 0, 0, 0, 487, 0, 99, 0, 202, 51, 129, 294, 818, 49,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 359, 102, 0, 325, 0,
+  829, 0, 2, 94, 69, 31, 901, 0, 0, 0, 41, 300, 665, 529, 524, 577,
+  236, 228, 743, 697, 884, 277, 505, 503, 0, 0, 0, 380, 0, 415, 0, 0,
+  0, 0, 0, 0, 0, 0, 604, 339, 994, 0, 168, 0, 1, 44, 303, 691,
+  251, 624, 951, 0, 47, 151, 183, 647, 112, 357, 853, 995, 392, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 806, 0, 0, 0, 0, 127, 0, 378, 0, 0,
+  0, 0, 0, 0, 690, 0, 0, 0, 0, 295, 365, 315, 0, 0, 0, 210,
+  766, 391, 255, 404, 77, 696, 943, 216, 0, 0, 17, 0, 242, 0, 0, 96,
+  0, 911, 0, 0, 0, 0, 0, 0, 0, 0, 871, 382, 0, 0, 0, 0,
+  0, 0, 907, 0, 0, 0, 921, 0, 24, 0, 196, 0, 798, 136, 0, 0,
+  144, 0, 297, 0, 0, 0, 521, 0, 0, 53, 393, 0, 0, 765, 0, 0,
+  0, 0, 0, 0, 0, 713, 948, 0, 0, 982, 593, 610, 0, 0, 0, 172,
+  226, 920, 0, 0, 0, 0, 0, 0, 0, 363, 426, 0, 613, 250, 37, 0,
+  286, 631, 0, 0, 0, 977, 0, 421, 458, 390, 600, 0, 0, 0, 0, 253,
+  353, 891, 892, 0, 0, 857, 581, 0, 48, 166, 46, 316, 682, 332, 808, 0,
+  209, 0, 772, 0, 0, 0, 0, 63, 422, 842, 0, 0, 0, 0, 0, 0,
+  272, 0, 410, 0, 838, 84, 224, 645, 537, 905, 834, 269, 331, 636, 75, 22,
+  434, 655, 969, 662, 924, 352, 0, 0, 103, 940, 0, 0, 0, 299, 675, 0,
+  0, 0, 0, 452, 0, 0, 0, 821, 793, 20, 626, 679, 0, 744, 0, 0,
+  0, 569, 674, 933, 262, 0, 0, 0, 0, 0, 394, 0, 290, 0, 0, 0,
+  0, 190, 0, 0, 302, 445, 689, 271, 615, 715, 0, 59, 664, 768, 900, 0,
+  0, 0, 0, 0, 21, 0, 0, 448, 0, 538, 0, 930, 0, 0, 0, 608,
+  158, 235, 773, 876, 916, 714, 414, 0, 0, 0, 285, 0, 758, 108, 650, 0,
+  0, 0, 0, 0, 0, 0, 397, 932, 0, 309, 0, 0, 0, 268, 530, 795,
+  945, 837, 964, 174, 644, 783, 0, 879, 936, 826, 0, 0, 0, 0, 801, 522,
+  0, 472, 0, 0, 0, 0, 0, 379, 548, 361, 669, 0, 654, 0, 0, 614,
+  0, 0, 0, 0, 0, 245, 0, 0, 0, 141, 474, 0, 0, 0, 570, 0,
+  497, 0, 0, 0, 0, 0, 0, 0, 93, 0, 241, 717, 0, 0, 0, 761,
+  0, 0, 883, 0, 0, 0, 0, 287, 444, 0, 0, 0, 0, 0, 0, 686,
+  0, 0, 919, 0, 0, 0, 0, 660, 874, 989, 0, 71, 181, 346, 351, 957,
+  0, 545, 343, 939, 0, 284, 233, 146, 0, 401, 120, 0, 0, 839, 0, 0,
+  430, 0, 508, 0, 0, 0, 0, 0, 0, 506, 147, 817, 0, 18, 126, 194,
+  195, 807, 962, 0, 0, 0, 170, 204, 937, 913, 0, 0, 329, 0, 0, 131,
+  484, 638, 301, 81, 756, 769, 173, 121, 784, 396, 867, 870, 899, 923, 922, 822,
+  176, 292, 889, 0, 87, 673, 0, 0, 128, 699, 754, 0, 0, 0, 0, 62,
+  588, 999, 258, 563, 0, 0, 0, 0, 0, 192, 0, 683, 425, 0, 0, 0,
+  0, 90, 436, 80, 552, 970, 946, 0, 348, 463, 0, 0, 356, 27, 953, 0,
+  4, 0, 0, 0, 0, 330, 0, 0, 8, 997, 0, 0, 28, 319, 0, 528,
+  219, 0, 0, 718, 0, 555, 182, 249, 639, 367, 831, 119, 256, 861, 967, 275,
+  516, 221, 0, 635, 0, 376, 993, 313, 471, 0, 0, 0, 559, 625, 670, 0,
+  0, 0, 0, 342, 0, 149, 50, 54, 446, 0, 0, 91, 560, 814, 0, 234,
+  574, 495, 304, 373, 925, 0, 0, 0, 281, 619, 499, 0, 554, 0, 0, 0,
+  442, 86, 416, 494, 324, 676, 409, 700, 780, 617, 341, 73, 648, 283, 695, 996,
+  0, 0, 0, 0, 775, 118, 567, 0, 0, 0, 846, 0, 0, 0, 0, 344,
+  0, 0, 199, 0, 98, 893, 0, 412, 0, 0, 0, 0, 0, 0, 992, 810,
+  678, 0, 0, 0, 998, 549, 0, 97, 0, 45, 723, 0, 816, 0, 0, 0,
+  0, 0, 0, 427, 327, 935, 0, 0, 0, 0, 0, 0, 0, 0, 0, 89,
+  0, 0, 0, 0, 805, 927, 926, 677, 0, 66, 0, 0, 0, 0, 547, 601,
+  611, 0, 0, 418, 502, 0, 0, 0, 0, 0, 30, 15, 326, 694, 0, 0,
+  100, 264, 0, 280, 0, 0, 0, 0, 215, 399, 0, 0, 0, 308, 739, 0,
+  0, 785, 803, 0, 0, 0, 0, 894, 0, 0, 0, 880, 0, 811, 828, 0,
+  721, 851, 122, 203, 575, 823, 335, 437, 737, 887, 145, 836, 872, 0, 0, 0,
+  0, 0, 61, 0, 0, 0, 0, 0, 824, 117, 0, 881, 105, 0, 0, 869,
+  0, 0, 623, 0, 58, 0, 519, 757, 239, 0, 0, 551, 0, 716, 95, 642,
+  217, 0, 0, 0, 0, 0, 0, 0, 866, 0, 755, 0, 895, 0, 0, 0,
+  0, 464, 67, 0, 0, 0, 212, 155, 0, 152, 0, 0, 240, 0, 0, 0,
+  368, 43, 629, 468, 663, 0, 0, 975, 0, 0, 0, 734, 0, 774, 0, 35,
+  687, 585, 0, 607, 531, 0, 0, 429, 0, 0, 960, 0, 0, 0, 0, 618,
+  273, 0, 0, 439, 123, 143, 746, 912, 886, 984, 0, 0, 0, 0, 0, 243,
+  489, 598, 0, 76, 0, 0, 767, 498, 0, 0, 26, 698, 428, 288, 990, 0,
+  633, 820, 0, 763, 0, 0, 0, 565, 0, 864, 603, 827, 742, 0, 991, 0,
+  486, 902, 0, 0, 85, 0, 0, 0, 0, 0, 657, 0, 115, 580, 667, 0,
+  0, 0, 0, 515, 0, 0, 0, 0, 148, 252, 459, 0, 0, 0, 0, 438,
+  0, 227, 790, 0, 496, 0, 0, 140, 372, 0, 0, 218, 0, 0, 225, 307,
+  684, 0, 0, 0, 0, 0, 835, 0, 79, 511, 0, 0, 0, 19, 541, 0,
+  590, 0, 0, 0, 952, 462, 0, 0, 0, 109, 150, 885, 248, 621, 0, 0,
+  0, 733, 0, 0, 0, 0, 167, 646, 366, 751, 0, 478, 124, 0, 0, 685,
+  385, 845, 0, 156, 0, 0, 0, 0, 0, 0, 640, 692, 0, 0, 592, 0,
+  135, 267, 298, 0, 72, 211, 652, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  177, 796, 0, 74, 244, 338, 0, 0, 0, 0, 68, 493, 450, 777, 0, 0,
+  711, 849, 0, 0, 656, 0, 0, 0, 800, 0, 0, 770, 138, 501, 708, 453,
+  858, 0, 432, 0, 0, 0, 0, 0, 0, 0, 0, 0, 587, 0, 507, 232,
+  83, 254, 347, 688, 847, 0, 0, 106, 180, 0, 0, 804, 441, 903, 0, 947,
+  0, 779, 0, 0, 0, 0, 0, 979, 0, 591, 193, 237, 956, 0, 622, 0,
+  0, 844, 848, 0, 741, 0, 191, 0, 909, 634, 966, 735, 0, 0, 0, 0,
+  0, 70, 0, 0, 0, 0, 0, 0, 748, 34, 231, 310, 0, 914, 0, 433,
+  0, 0, 130, 0, 483, 480, 0, 0, 0, 0, 0, 504, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 612, 840, 693, 0, 153, 92, 56, 305, 791, 856,
+  0, 0, 0, 500, 0, 0, 405, 389, 0, 651, 160, 259, 403, 0, 0, 187,
+  535, 0, 557, 0, 0, 369, 0, 852, 207, 0, 134, 104, 0, 6, 797, 0,
+  0, 82, 0, 0, 0, 0, 388, 890, 0, 0, 0, 0, 0, 518, 0, 0,
+  477, 584, 12, 206, 132, 799, 0, 985, 0, 266, 65, 475, 987, 0, 0, 0,
+  0, 0, 882, 571, 0, 0, 0, 32, 114, 125, 23, 514, 457, 961, 0, 0,
+};
+
+const char *WA_FREQ_104_TOKENS[] = {
+  "k",
+  "a",
+  "o",
+  "rá",
+  "nú",
+  "ü",
+  "yó",
+  "má",
+  "b",
+  "ná",
+  "i",
+  "e",
+  "rí",
+  "mí",
+  "yá",
+  "ä",
+  "dyá",
+  "m",
+  "ë",
+  "ó",
+  "ts",
+  "t",
+  "í",
+  "kja",
+  "para",
+  "u",
+  "të",
+  "ró",
+  "à",
+  "jó",
+  "s",
+  "gá",
+  "né",
+  "kjâ",
+  "gó",
+  "ngék",
+  "ngé",
+  "ji",
+  "pa",
+  "jângo",
+  "jñíñi",
+  "ch",
+  "que",
+  "nk",
+  "dyä",
+  "sí",
+  "á",
+  "porque",
+  "gí",
+  "dyà",
+  "mbáxua",
+  "äji",
+  "eh",
+  "ndé",
+  "nuts",
+  "pero",
+  "tjo",
+  "ngu",
+  "ma",
+  "este",
+  "ö",
+  "jñátjo",
+  "pu",
+  "téxe",
+  "ñé",
+  "té",
+  "tji",
+  "mi",
+  "pá",
+  "síji",
+  "dya",
+  "é",
+  "ndíxu",
+  "ti",
+  "jñôna",
+  "ngéko",
+  "jé",
+  "gú",
+  "y",
+  "zo",
+  "pë",
+  "ja",
+  "íjtu",
+  "ñá",
+  "egö",
+  "â",
+  "jñíni",
+  "ñe",
+  "rü",
+  "kjo",
+  "tö",
+  "ndó",
+  "yo",
+  "p",
+  "üji",
+  "jë",
+  "só",
+  "dyi",
+  "nu",
+  "n",
+  "ra",
+  "na",
+  "ya",
+  "gü",
+  "ndä",
+  "xíji",
+  "pji",
+  "ngó",
+  "eji",
+  "mâ",
+  "iji",
+  "ndá",
+  "zü",
+  "xôrü",
+  "tjö",
+  "ri",
+  "téxi",
+  "móji",
+  "kjü",
+  "ndéje",
+  "xí",
+  "tu",
+  "dyájkja",
+  "ín",
+  "mëch",
+  "zhi",
+  "rú",
+  "jo",
+  "pjéko",
+  "pjék",
+  "nü",
+  "xë",
+  "mateo",
+  "jnä",
+  "san",
+  "nda",
+  "ngéjo",
+  "me",
+  "de",
+  "íjk",
+  "pjö",
+  "nge",
+  "póji",
+  "jä",
+  "jma",
+  "jíngua",
+  "xôra",
+  "ko",
+  "ndo",
+  "pjü",
+  "mbü",
+  "nà",
+  "si",
+  "xôm",
+  "jö",
+  "ndéxe",
+  "ngo",
+  "ní",
+  "já",
+  "mbédye",
+  "jua",
+  "d",
+  "ka",
+  "ñáji",
+  "je",
+  "nê",
+  "níts",
+  "kjá",
+  "ñi",
+  "së",
+  "juë",
+  "pjíño",
+  "jñí",
+  "ojmé",
+  "go",
+  "sä",
+  "jü",
+  "jñá",
+  "te",
+  "aji",
+  "nójo",
+  "jích",
+  "tjü",
+  "jnü",
+  "ndë",
+  "míxa",
+  "tí",
+  "nána",
+  "máji",
+  "sô",
+  "tá",
+  "pâra",
+  "áñima",
+  "xípji",
+  "xíts",
+  "ngôñi",
+  "agö",
+  "bo",
+  "pö",
+  "xúti",
+  "rä",
+  "mbe",
+  "dyé",
+  "ùnü",
+  "mü",
+  "ndü",
+  "ndéxi",
+  "dyájk",
+  "mu",
+  "ga",
+  "íti",
+  "jm",
+  "chjü",
+  "imi",
+  "ngü",
+  "po",
+  "ñéjo",
+  "ák",
+  "nája",
+  "pédye",
+  "áji",
+  "ndízik",
+  "ngá",
+  "pe",
+  "mbé",
+  "jtjo",
+  "ò",
+  "veces",
+  "kjë",
+  "ndú",
+  "ne",
+  "angeze",
+  "pü",
+  "so",
+  "kjâji",
+  "rüji",
+  "ùni",
+  "lúlu",
+  "ndzhü",
+  "ndu",
+  "pó",
+  "xi",
+  "jmu",
+  "tk",
+  "nù",
+  "jókò",
+  "tü",
+  "ña",
+  "ro",
+  "xo",
+  "ndzhôd",
+  "ñí",
+  "núdya",
+  "ngéjyo",
+  "ñéje",
+  "dyák",
+  "jmi",
+  "xôrüji",
+  "mbáne",
+  "ño",
+  "dyó",
+  "sénch",
+  "jânge",
+  "kíjmi",
+  "mbéñe",
+  "nó",
+  "ndés",
+  "májp",
+  "tju",
+  "nuk",
+  "pjántëjë",
+  "ru",
+  "mé",
+  "kö",
+  "íb",
+  "sëjme",
+  "bü",
+  "ík",
+  "pjámilia",
+  "sö",
+  "jíchiji",
+  "pádrino",
+  "jyó",
+  "zà",
+  "ô",
+  "jók",
+  "mbépji",
+  "nújnù",
+  "ta",
+  "ngéje",
+  "ngéka",
+  "meji",
+  "ízhi",
+  "síbi",
+  "jña",
+  "síño",
+  "añimále",
+  "pjiji",
+  "tä",
+  "nt",
+  "jk",
+  "kjíjmi",
+  "íjke",
+  "chü",
+  "jí",
+  "nde",
+  "mbéjkue",
+  "tp",
+  "dyö",
+  "dyájkjo",
+  "ndék",
+  "nä",
+  "xü",
+  "íji",
+  "ndí",
+  "pés",
+  "ndéch",
+  "zó",
+  "mbo",
+  "pä",
+  "ugö",
+  "tòpjü",
+  "siño",
+  "se",
+  "núk",
+  "mbés",
+  "dye",
+  "ójmé",
+  "chö",
+  "to",
+  "sa",
+  "no",
+  "mbó",
+  "pjë",
+  "sà",
+  "épji",
+  "sódye",
+  "mó",
+  "jmé",
+  "ínch",
+  "ndóra",
+  "bá",
+  "ú",
+  "im",
+  "xe",
+  "hasta",
+  "kü",
+  "mä",
+  "ñôna",
+  "flécha",
+  "bíjtu",
+  "kjèzhe",
+  "jñi",
+  "jíchi",
+  "tjmé",
+  "jyä",
+  "xônxua",
+  "mba",
+  "mbéjch",
+  "píts",
+  "üb",
+  "jui",
+  "kjuá",
+  "ju",
+  "sü",
+  "ngéjnú",
+  "mbék",
+  "ngéjnu",
+  "téjm",
+  "kji",
+  "nguârü",
+  "nújnu",
+  "x",
+  "ngík",
+  "café",
+  "su",
+  "za",
+  "jôd",
+  "ùjni",
+  "néji",
+  "ñeje",
+  "mú",
+  "tpjäji",
+  "ngí",
+  "jt",
+  "gi",
+  "igö",
+  "zä",
+  "zéngua",
+  "éb",
+  "núdyá",
+  "üjmé",
+  "íxi",
+  "jyês",
+  "dyájka",
+  "chu",
+  "nguárü",
+  "jñônaji",
+  "éñe",
+  "xîji",
+  "jízhi",
+  "ät",
+  "jíts",
+  "jna",
+  "xu",
+  "jmuji",
+  "àjñíni",
+  "më",
+  "índzu",
+  "sódyeji",
+  "kju",
+  "jângé",
+  "dyò",
+  "uë",
+  "kjó",
+  "pja",
+  "oji",
+  "núdyà",
+  "kjö",
+  "ñú",
+  "dyë",
+  "mbá",
+  "sî",
+  "dyéje",
+  "pjâdül",
+  "desde",
+  "ndáreje",
+  "núji",
+  "mândres",
+  "chju",
+  "tradición",
+  "pójo",
+  "nânga",
+  "anú",
+  "santiaguero",
+  "angezeji",
+  "ns",
+  "jyés",
+  "ku",
+  "cada",
+  "núts",
+  "jôngo",
+  "jue",
+  "gö",
+  "tía",
+  "jtü",
+  "ñó",
+  "jnu",
+  "és",
+  "ñêch",
+  "pje",
+  "xôri",
+  "séncho",
+  "tàpjü",
+  "âraxü",
+  "pjo",
+  "nüji",
+  "chi",
+  "dyo",
+  "flecha",
+  "ndzü",
+  "ím",
+  "juí",
+  "pájna",
+  "uji",
+  "jme",
+  "âji",
+  "anu",
+  "éñeji",
+  "éje",
+  "âra",
+  "ndízi",
+  "íngu",
+  "mbéjchüjn",
+  "mbédyeji",
+  "ápjü",
+  "ndzhä",
+  "pjá",
+  "ñä",
+  "ngú",
+  "pára",
+  "jângó",
+  "jês",
+  "mbóji",
+  "mája",
+  "ndzhôgü",
+  "ñejo",
+  "ñéjyo",
+  "bi",
+  "xík",
+  "guë",
+  "ñéts",
+  "tjë",
+  "ah",
+  "nêm",
+  "täji",
+  "kó",
+  "dyàjkja",
+  "ájk",
+  "mbéjchujn",
+  "mbèpji",
+  "ejmé",
+  "ngéji",
+  "ás",
+  "dyéb",
+  "ni",
+  "jtjü",
+  "xích",
+  "pé",
+  "ñátji",
+  "limonada",
+  "jñini",
+  "ndéxü",
+  "pjâd",
+  "mbí",
+  "sé",
+  "bë",
+  "ínána",
+  "tüji",
+  "ézhi",
+  "dyája",
+  "ñéj",
+  "mbéch",
+  "j",
+  "ndzi",
+  "mójmé",
+  "téji",
+  "ñék",
+  "zhe",
+  "síjme",
+  "síb",
+  "jyôd",
+  "ntjü",
+  "jyás",
+  "àñima",
+  "mbä",
+  "tú",
+  "ñójm",
+  "sòdye",
+  "nji",
+  "ke",
+  "ye",
+  "mângo",
+  "ñô",
+  "xálo",
+  "jño",
+  "jñiñi",
+  "mézhe",
+  "jch",
+  "kjôs",
+  "sò",
+  "áje",
+  "ímíjtu",
+  "ngua",
+  "jés",
+  "ùnüji",
+  "ak",
+  "gánde",
+  "mbö",
+  "mbézhi",
+  "chícharo",
+  "jêch",
+  "ndójo",
+  "ndémp",
+  "jângor",
+  "gä",
+  "zò",
+  "eje",
+  "ngrús",
+  "sk",
+  "mbája",
+  "tó",
+  "ün",
+  "xä",
+  "nguá",
+  "dyàrá",
+  "kjí",
+  "ngôxt",
+  "tjme",
+  "macho",
+  "agua",
+  "pòji",
+  "míjmi",
+  "éji",
+  "óji",
+  "rgo",
+  "xî",
+  "ârá",
+  "pjüji",
+  "es",
+  "kä",
+  "ngôs",
+  "angezi",
+  "como",
+  "zíji",
+  "nch",
+  "ará",
+  "sejme",
+  "gé",
+  "tújmuji",
+  "gu",
+  "ñu",
+  "pi",
+  "costumbre",
+  "íjñíni",
+  "mëchi",
+  "kjèzheji",
+  "zi",
+  "zénguaji",
+  "xôru",
+  "pastora",
+  "oyó",
+  "ndi",
+  "ndù",
+  "xóp",
+  "ngéts",
+  "sódya",
+  "kjími",
+  "nkju",
+  "jô",
+  "ngích",
+  "ndága",
+  "espada",
+  "jyâs",
+  "mo",
+  "pârgo",
+  "che",
+  "pjé",
+  "zá",
+  "ímbáne",
+  "mbéñeji",
+  "sá",
+  "mús",
+  "mbédyi",
+  "nájo",
+  "ñângestjya",
+  "mbót",
+  "ómbeñe",
+  "derecha",
+  "ëji",
+  "mp",
+  "ngum",
+  "sú",
+  "nátjo",
+  "dyè",
+  "sîji",
+  "ími",
+  "péch",
+  "ngéj",
+  "zhiji",
+  "ëgö",
+  "servilleta",
+  "xôrügö",
+  "color",
+  "jñu",
+  "mbë",
+  "gloria",
+  "por",
+  "yé",
+  "tjí",
+  "yájk",
+  "ré",
+  "nújk",
+  "ik",
+  "mán",
+  "ba",
+  "atjo",
+  "más",
+  "tópjü",
+  "mójm",
+  "lugar",
+  "mbüji",
+  "zénguats",
+  "ge",
+  "ânga",
+  "tjä",
+  "ojme",
+  "zénguazü",
+  "güts",
+  "jôgü",
+  "válido",
+  "pà",
+  "édyi",
+  "kúch",
+  "ñë",
+  "mério",
+  "ajmé",
+  "punk",
+  "pjôrü",
+  "jmá",
+  "kuá",
+  "ndôñi",
+  "ndájme",
+  "tío",
+  "nájnú",
+  "xôt",
+  "néje",
+  "ndzu",
+  "ñátjo",
+  "xídyo",
+  "síjmé",
+  "ázucar",
+  "azúcar",
+  "ñê",
+  "ki",
+  "padrino",
+  "dyábi",
+  "tíjué",
+  "jñé",
+  "mbójkjím",
+  "delantal",
+  "dyàrró",
+  "ndôra",
+  "xâxtü",
+  "émbe",
+  "patrón",
+  "zàpjü",
+  "jyá",
+  "ndéji",
+  "ñíts",
+  "tés",
+  "sû",
+  "sentío",
+  "jya",
+  "híts",
+  "dyàjk",
+  "pju",
+  "ñônaji",
+  "jtji",
+  "ndôm",
+  "dyójk",
+  "ägö",
+  "depende",
+  "jângots",
+  "dyèje",
+  "xa",
+  "sopa",
+  "jnüji",
+  "jni",
+  "nutsk",
+  "ndémoxü",
+  "ôn",
+  "jônk",
+  "ñej",
+  "máma",
+  "dyákja",
+  "mbás",
+  "as",
+  "îji",
+  "pójtü",
+  "kjáji",
+  "küji",
+  "ügö",
+  "péb",
+  "míjme",
+  "vez",
+  "ôt",
+  "xú",
+  "tanto",
+  "respetágoji",
+  "jê",
+  "recibido",
+  "respeto",
+  "guitarra",
+  "ndédye",
+  "ngéjyó",
+  "pjánt",
+  "mbóxte",
+  "ngíko",
+  "manera",
+  "órü",
+  "mbára",
+  "sp",
+  "tje",
+  "tjéñe",
+  "rüjmé",
+  "éch",
+  "zö",
+  "ibi",
+  "tsko",
+  "jôrü",
+  "güji",
+  "chji",
+  "pk",
+  "íjmi",
+  "êm",
+  "dyôd",
+  "mbéjchün",
+  "ñáxtjo",
+  "nga",
+  "tkojmé",
+  "éts",
+  "ù",
+  "ndóñi",
+  "tëje",
+  "üjü",
+  "persona",
+  "rga",
+  "iti",
+  "mízhikjími",
+  "mbéb",
+  "kâ",
+  "doctor",
+  "jêndze",
+  "jmü",
+  "tabla",
+  "jùm",
+  "ndéb",
+  "corona",
+  "míjtu",
+  "kjuârü",
+  "xá",
+  "jmeji",
+  "levadura",
+  "harina",
+  "dyés",
+  "míxi",
+  "ñâxtjo",
+  "bízhi",
+  "tjó",
+  "ndáxi",
+  "ùnu",
+  "ngéjk",
+  "jñô",
+  "jwe",
+  "xîk",
+  "spjiji",
+  "pédyeji",
+  "ójtjo",
+  "tjéze",
+  "sacramento",
+  "íngod",
+  "xtü",
+  "yä",
+  "ês",
+  "ândres",
+  "ndóji",
+  "mbôxte",
+  "íño",
+  "íntá",
+  "xîts",
+  "mbéjkueji",
+  "jú",
+  "súb",
+  "pós",
+  "xôpjü",
+  "jôrüji",
+  "núkja",
+  "dyáb",
+  "xó",
+  "ntjo",
+  "nêch",
+  "è",
+  "dyèjpje",
+  "jízhiji",
+  "dyü",
+  "téje",
+  "jíyo",
+  "yò",
+  "tújmüji",
+  "sabor",
+  "nkjü",
+  "añimale",
+  "mbôrü",
+  "mò",
+  "rósa",
+  "sea",
+  "cupágoji",
+  "nújnú",
+  "táji",
+  "mbénko",
+  "pízhi",
+  "tô",
+  "ndóm",
+  "máj",
+  "ítju",
+  "íjtuji",
+  "âs",
+  "tiene",
+  "ëzo",
+  "páraji",
+  "violín",
+  "kích",
+  "kjáp",
+  "máquina",
+  "tiji",
+  "íngôñi",
+  "ëjë",
+  "mbéji",
+  "ngéjm",
+  "xô",
+  "àxuxí",
+  "ñâxto",
+  "máxk",
+  "nudyá",
+  "ídyo",
+  "ndzhôk",
+  "sacristán",
+  "nítsjimi",
+  "ndíts",
+  "sídyi",
+  "mími",
+  "jôt",
+  "ül",
+  "pj",
+  "flauta",
+  "nêjm",
+  "ndére",
+  "sibi",
+  "palesito",
+  "zí",
+  "cuerpo",
+  "míji",
+  "dyágo",
+  "kârgo",
+  "nô",
+  "jôk",
+  "chjä",
+  "jângerga",
+  "íbi",
+  "páreje",
+  "tja",
+  "kí",
+  "tm",
+  "ndánxa",
+  "partera",
+  "müji",
+  "mbèdye",
+  "mbu",
+  "mádrina",
+  "éñi",
+  "ndém",
+  "on",
+  "ì",
+  "májmu",
+  "ndéhe",
+  "ága",
+  "ngés",
+  "xís",
+  "mèzhe",
+  "mbójkjimi",
+  "ndájma",
+  "úzib",
+  "xîch",
+  "dyár",
+  "ndése",
+  "jmí",
+  "íjñí",
+  "mbéts",
+  "ze",
+  "mamá",
+  "räji",
+  "hùmü",
+  "fruta",
+  "zheji",
+  "luz",
+  "ñéxtjo",
+  "tocadisco",
+  "ñângistya",
+  "riji",
+  "ímba",
+  "jânger",
+  "ínts",
+  "nânk",
+  "dyáko",
+  "jmó",
+  "ndzhô",
+  "om",
+  "tíjmi",
+  "metro",
+  "tézhe",
+  "jâgü",
+  "dyàmbi",
+  "pjém",
+  "pjéjme",
+  "jñátji",
+  "mbàra",
+  "jôrga",
+  "pôs",
+  "ndzhônt",
+  "kájk",
+  "morales",
+  "mbéndzu",
+  "pédyi",
+  "fríjole",
+  "tsjómbeñe",
+  "kjé",
+  "túji",
+  "ádyo",
+  "ünü",
+  "tpjüji",
+  "ngóra",
+  "nguâri",
+  "téxeji",
+  "ngek",
+  "jângorga",
+  "ijk",
+  "énk",
+  "párgo",
+  "nko",
+};
+const uint16_t WA_FREQ_104_RANKS[] = {
+  611, 0, 0, 0, 0, 71, 415, 0, 668, 0, 193, 958, 539, 0, 0, 0,
+  748, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 597, 115, 0, 0, 0,
+  0, 260, 0, 0, 0, 952, 0, 0, 0, 0, 0, 0, 0, 0, 162, 508,
+  717, 867, 892, 0, 679, 0, 661, 171, 567, 733, 843, 979, 0, 0, 0, 0,
+  0, 282, 0, 696, 206, 343, 456, 316, 565, 0, 0, 0, 0, 222, 344, 119,
+  371, 408, 783, 881, 0, 0, 0, 0, 0, 0, 305, 591, 921, 0, 0, 0,
+  322, 427, 0, 662, 988, 0, 213, 229, 151, 503, 534, 571, 626, 0, 0, 0,
+  387, 625, 851, 572, 908, 0, 0, 0, 0, 0, 0, 0, 336, 0, 0, 0,
+  0, 0, 675, 393, 770, 379, 937, 209, 945, 0, 542, 0, 0, 0, 0, 0,
+  520, 823, 842, 0, 465, 227, 0, 97, 196, 610, 302, 461, 0, 0, 0, 0,
+  0, 70, 587, 0, 38, 529, 0, 86, 0, 385, 787, 0, 0, 0, 0, 10,
+  0, 0, 0, 0, 0, 104, 132, 0, 53, 540, 788, 0, 802, 974, 126, 460,
+  0, 0, 0, 0, 0, 475, 0, 0, 0, 0, 0, 0, 739, 0, 239, 268,
+  412, 649, 862, 0, 124, 63, 0, 428, 0, 0, 0, 0, 0, 535, 0, 0,
+  0, 334, 0, 0, 0, 404, 397, 0, 509, 111, 0, 0, 0, 0, 856, 0,
+  847, 446, 647, 0, 0, 964, 913, 0, 971, 358, 266, 504, 172, 874, 987, 0,
+  0, 179, 0, 0, 237, 764, 831, 0, 756, 382, 422, 323, 889, 167, 0, 55,
+  618, 681, 627, 488, 819, 603, 832, 0, 0, 0, 0, 0, 528, 0, 0, 338,
+  181, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 274, 0, 981, 0, 956,
+  483, 608, 134, 376, 485, 0, 1000, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 586, 443, 0, 800, 950, 0, 0, 863, 0, 659, 0, 96, 450, 939, 0,
+  693, 0, 0, 0, 0, 0, 0, 0, 557, 0, 799, 0, 0, 0, 122, 81,
+  288, 0, 976, 709, 0, 0, 0, 0, 894, 670, 0, 0, 0, 579, 829, 0,
+  0, 0, 430, 487, 0, 130, 0, 432, 0, 0, 0, 602, 246, 0, 54, 431,
+  0, 798, 512, 219, 0, 0, 612, 701, 174, 0, 0, 0, 423, 0, 0, 0,
+  0, 853, 0, 0, 25, 0, 0, 365, 147, 314, 910, 0, 0, 0, 598, 0,
+  0, 215, 381, 138, 0, 0, 0, 0, 0, 137, 0, 0, 0, 0, 0, 0,
+  0, 395, 501, 2, 15, 280, 299, 0, 37, 732, 613, 47, 198, 377, 0, 0,
+  0, 0, 0, 839, 0, 340, 6, 0, 0, 663, 0, 286, 0, 44, 0, 0,
+  0, 0, 970, 645, 0, 855, 0, 648, 0, 0, 0, 0, 265, 345, 27, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 0, 40, 677, 0, 997,
+  0, 95, 424, 0, 173, 948, 39, 184, 0, 0, 0, 233, 790, 24, 876, 0,
+  0, 0, 0, 0, 969, 0, 0, 0, 0, 848, 957, 0, 0, 0, 0, 0,
+  61, 728, 893, 0, 0, 0, 895, 0, 352, 673, 109, 82, 272, 744, 841, 852,
+  553, 707, 858, 911, 92, 279, 961, 476, 898, 992, 0, 860, 0, 0, 0, 0,
+  0, 0, 9, 0, 0, 0, 0, 112, 0, 0, 977, 90, 319, 521, 561, 0,
+  0, 155, 0, 0, 0, 0, 695, 0, 0, 0, 0, 247, 0, 767, 414, 100,
+  76, 0, 719, 0, 0, 0, 0, 445, 0, 0, 726, 776, 924, 0, 812, 0,
+  318, 0, 0, 0, 0, 0, 0, 589, 0, 0, 0, 546, 223, 740, 775, 478,
+  814, 0, 210, 406, 0, 0, 0, 0, 0, 0, 708, 0, 0, 0, 0, 782,
+  346, 0, 601, 786, 0, 0, 0, 0, 0, 527, 700, 226, 0, 721, 947, 309,
+  0, 684, 270, 0, 0, 0, 935, 667, 444, 52, 0, 0, 0, 0, 158, 194,
+  420, 676, 773, 0, 102, 0, 0, 0, 973, 0, 741, 715, 74, 496, 866, 0,
+  369, 584, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  723, 699, 435, 437, 574, 583, 637, 729, 779, 0, 378, 778, 0, 710, 0, 0,
+  180, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 242, 0, 0, 0,
+  0, 0, 94, 931, 199, 0, 657, 564, 718, 73, 850, 897, 914, 0, 0, 0,
+  0, 628, 0, 498, 951, 0, 652, 0, 0, 355, 750, 0, 0, 0, 0, 101,
+  0, 190, 225, 16, 869, 0, 525, 735, 0, 361, 885, 285, 0, 30, 0, 524,
+  983, 0, 0, 329, 401, 758, 0, 0, 306, 0, 0, 91, 0, 0, 0, 0,
+  0, 3, 202, 419, 656, 458, 235, 737, 891, 0, 0, 0, 0, 0, 0, 0,
+  87, 142, 169, 563, 835, 0, 0, 0, 0, 0, 0, 0, 214, 692, 0, 0,
+  0, 883, 0, 810, 0, 0, 0, 0, 218, 683, 453, 0, 0, 0, 530, 0,
+  0, 0, 0, 0, 804, 383, 0, 0, 123, 0, 789, 107, 442, 0, 0, 0,
+  0, 0, 99, 0, 170, 518, 165, 0, 566, 413, 769, 960, 0, 532, 11, 436,
+  4, 262, 515, 580, 220, 820, 844, 906, 469, 985, 117, 686, 705, 0, 203, 995,
+  0, 0, 0, 0, 954, 0, 0, 878, 0, 32, 417, 0, 0, 507, 0, 192,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 80, 41, 531,
+  275, 996, 0, 349, 963, 0, 0, 0, 0, 0, 0, 0, 0, 620, 0, 0,
+  0, 258, 615, 368, 238, 0, 0, 84, 0, 797, 875, 0, 129, 927, 0, 0,
+  0, 0, 972, 0, 0, 502, 920, 0, 0, 0, 0, 0, 577, 492, 899, 926,
+  0, 499, 471, 447, 763, 60, 753, 818, 0, 0, 0, 187, 267, 426, 185, 0,
+  0, 0, 289, 0, 0, 559, 0, 544, 624, 120, 0, 425, 0, 489, 0, 909,
+  0, 0, 0, 0, 106, 0, 614, 636, 0, 339, 0, 20, 0, 873, 0, 0,
+  0, 678, 0, 0, 0, 840, 0, 0, 0, 0, 658, 0, 191, 629, 0, 0,
+  0, 0, 0, 0, 646, 929, 953, 0, 0, 505, 31, 14, 293, 562, 0, 0,
+  315, 292, 22, 0, 161, 0, 0, 0, 749, 0, 163, 0, 685, 116, 573, 140,
+  0, 0, 0, 0, 66, 127, 231, 201, 307, 448, 640, 0, 384, 0, 590, 623,
+  159, 354, 46, 807, 0, 0, 0, 0, 653, 664, 0, 0, 0, 342, 991, 533,
+  0, 0, 0, 0, 766, 0, 0, 398, 0, 0, 607, 0, 110, 0, 440, 256,
+  0, 0, 0, 0, 153, 308, 711, 596, 865, 351, 297, 433, 922, 833, 0, 0,
+  0, 0, 942, 0, 0, 794, 0, 0, 966, 0, 0, 785, 0, 0, 0, 494,
+  864, 481, 0, 639, 29, 0, 0, 0, 0, 0, 204, 0, 0, 0, 917, 0,
+  0, 0, 207, 409, 828, 552, 989, 325, 0, 0, 0, 139, 449, 968, 0, 0,
+  58, 650, 0, 0, 642, 0, 0, 366, 0, 0, 519, 234, 745, 0, 940, 372,
+  0, 550, 999, 0, 0, 0, 281, 114, 816, 79, 491, 747, 884, 284, 934, 0,
+  197, 455, 0, 407, 438, 0, 42, 0, 462, 160, 575, 0, 0, 374, 0, 0,
+  0, 497, 473, 713, 0, 0, 0, 765, 146, 879, 0, 0, 0, 0, 0, 768,
+  212, 0, 0, 200, 21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 780,
+  370, 396, 0, 0, 849, 360, 592, 570, 0, 208, 641, 0, 59, 0, 0, 688,
+  905, 0, 0, 477, 941, 0, 830, 0, 0, 0, 0, 0, 0, 49, 118, 0,
+  250, 0, 0, 0, 141, 887, 0, 0, 359, 846, 604, 682, 755, 0, 0, 674,
+  936, 545, 0, 486, 0, 337, 248, 654, 0, 0, 0, 736, 980, 0, 0, 168,
+  35, 0, 0, 121, 588, 357, 0, 616, 730, 918, 0, 252, 0, 0, 0, 821,
+  0, 48, 694, 731, 0, 0, 600, 672, 0, 0, 548, 464, 0, 0, 85, 157,
+  331, 806, 375, 57, 0, 362, 638, 439, 0, 0, 845, 36, 0, 245, 0, 0,
+  0, 0, 0, 0, 0, 228, 762, 0, 0, 0, 0, 0, 472, 320, 0, 0,
+  0, 0, 291, 298, 901, 0, 801, 283, 582, 0, 0, 680, 0, 0, 418, 83,
+  394, 402, 811, 0, 356, 660, 0, 0, 0, 0, 0, 903, 0, 495, 655, 317,
+  547, 482, 796, 56, 669, 666, 805, 0, 69, 526, 341, 0, 896, 522, 0, 493,
+  310, 0, 149, 18, 221, 0, 813, 0, 0, 0, 808, 0, 537, 0, 605, 916,
+  26, 665, 276, 912, 928, 0, 0, 68, 630, 886, 321, 902, 0, 781, 0, 716,
+  0, 0, 312, 136, 752, 0, 0, 0, 0, 216, 793, 0, 0, 0, 0, 0,
+  65, 606, 0, 0, 712, 0, 176, 0, 0, 0, 0, 67, 599, 0, 131, 0,
+  405, 45, 441, 0, 0, 0, 0, 0, 0, 399, 959, 0, 264, 295, 77, 0,
+  0, 0, 809, 0, 510, 877, 0, 738, 0, 13, 0, 0, 386, 0, 0, 634,
+  0, 0, 0, 0, 232, 148, 0, 0, 0, 0, 0, 633, 0, 0, 253, 416,
+  986, 0, 166, 549, 687, 822, 943, 993, 0, 0, 0, 0, 241, 0, 0, 0,
+  0, 0, 0, 195, 259, 0, 0, 0, 125, 301, 946, 0, 373, 619, 998, 0,
+  0, 0, 189, 5, 468, 742, 0, 0, 0, 523, 0, 287, 834, 0, 0, 0,
+  353, 261, 0, 720, 0, 178, 0, 644, 0, 391, 617, 0, 333, 0, 511, 0,
+  514, 0, 34, 777, 0, 955, 0, 0, 0, 0, 0, 836, 513, 0, 324, 792,
+  0, 0, 0, 0, 0, 177, 0, 0, 0, 249, 938, 581, 0, 236, 837, 0,
+  0, 0, 0, 12, 421, 105, 133, 0, 0, 0, 0, 0, 0, 857, 560, 965,
+  984, 0, 0, 0, 825, 962, 457, 569, 734, 390, 516, 389, 882, 631, 23, 459,
+  0, 463, 188, 474, 0, 568, 725, 827, 0, 0, 0, 0, 380, 0, 0, 556,
+  0, 746, 0, 0, 932, 944, 0, 0, 0, 154, 0, 0, 0, 0, 0, 347,
+  273, 704, 872, 632, 451, 128, 0, 907, 144, 925, 0, 0, 0, 452, 0, 975,
+  335, 915, 671, 400, 50, 0, 888, 72, 0, 0, 0, 330, 0, 702, 0, 0,
+  0, 817, 0, 263, 0, 923, 994, 724, 824, 367, 0, 0, 0, 0, 0, 277,
+  697, 300, 0, 0, 0, 103, 691, 900, 350, 930, 164, 771, 0, 0, 490, 651,
+  175, 0, 0, 467, 0, 269, 772, 0, 0, 826, 0, 0, 774, 17, 698, 990,
+  0, 290, 19, 152, 328, 311, 722, 621, 795, 434, 815, 108, 854, 0, 890, 0,
+  470, 479, 0, 0, 93, 751, 0, 0, 0, 98, 113, 506, 0, 411, 551, 1,
+  500, 714, 871, 933, 978, 0, 0, 466, 0, 243, 0, 484, 706, 595, 182, 0,
+  0, 0, 0, 410, 429, 609, 0, 0, 0, 0, 0, 211, 0, 593, 0, 0,
+  757, 0, 0, 0, 0, 0, 0, 0, 558, 578, 838, 967, 255, 585, 0, 240,
+  703, 244, 0, 0, 0, 254, 0, 554, 0, 0, 296, 388, 0, 0, 859, 0,
+  0, 0, 0, 543, 217, 251, 51, 326, 454, 64, 0, 0, 186, 0, 75, 89,
+  0, 0, 0, 643, 689, 690, 0, 0, 8, 348, 205, 403, 555, 145, 294, 313,
+  0, 0, 868, 0, 759, 0, 0, 364, 0, 0, 0, 0, 0, 278, 224, 727,
+  982, 861, 0, 0, 0, 0, 0, 0, 949, 0, 0, 0, 28, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 33, 0, 43, 392, 0, 0, 0, 0, 0, 78,
+  754, 0, 0, 541, 0, 0, 183, 0, 135, 0, 760, 0, 0, 0, 0, 0,
+  156, 0, 0, 635, 230, 271, 0, 0, 622, 0, 0, 0, 0, 0, 0, 0,
+  0, 327, 303, 536, 761, 784, 0, 0, 0, 62, 904, 150, 0, 0, 0, 0,
+  576, 791, 0, 0, 0, 0, 143, 0, 0, 480, 0, 7, 363, 0, 0, 803,
+  517, 594, 257, 870, 0, 0, 880, 88, 919, 743, 0, 0, 0, 0, 332, 538,
+};
+
@@ -0,0 +1,8348 @@
+#include "worldalphabets_data.h"
+
+const char *WA_FREQ_105_TOKENS[] = {
+  "бол",
+  "уу",
+  "алдвал",
+  "барьж",
+  "улаанбаатар",
+  "монгол",
+  "улсын",
+  "нийслэл",
+  "юм",
+  "хэн",
+  "нэг",
+  "нь",
+  "ярих",
+  "ёстой",
+  "өршөөгөөрэй",
+  "та",
+  "англиар",
+  "ярьдаг",
+  "бразилд",
+  "маш",
+  "олон",
+  "том",
+  "хотууд",
+  "байдаг",
+  "жилл",
+  "царайлагаас",
+  "гадна",
+  "ухаалаг",
+  "чи",
+  "сэлж",
+  "чадах",
+  "өндөрт",
+  "гарах",
+  "тусмаа",
+  "агаар",
+  "хүйтэн",
+  "болно",
+  "би",
+  "амралттай",
+  "байна",
+  "агт",
+  "болдог",
+  "ам",
+  "болдоггүй",
+  "тэр",
+  "ирэх",
+  "байхаа",
+};
+const uint16_t WA_FREQ_105_RANKS[] = {
+  0, 0, 0, 0, 0, 34, 39, 0, 6, 30, 2, 0, 0, 45, 0, 0,
+  10, 0, 0, 0, 20, 15, 0, 14, 0, 8, 11, 0, 0, 31, 18, 42,
+  1, 0, 41, 0, 36, 4, 0, 16, 0, 29, 0, 0, 37, 0, 0, 0,
+  13, 0, 24, 22, 0, 0, 0, 35, 25, 47, 21, 0, 0, 19, 0, 38,
+  0, 0, 0, 0, 3, 12, 0, 0, 0, 5, 9, 28, 44, 23, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 26, 0, 0, 33, 0,
+  0, 17, 0, 32, 0, 0, 0, 40, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 43, 0, 0, 0, 0, 0, 0, 27, 0, 0, 46,
+};
+
+const char *WA_FREQ_106_TOKENS[] = {
+  "ꯇ",
+  "ꯊꯕꯛ",
+  "ꯔ",
+  "ꯍ",
+  "eina",
+  "ngangbu",
+  "nungsi",
+  "꯲꯰꯱꯰ꯗ",
+  "h1n1",
+  "ꯀ",
+  "ꯒ",
+  "ꯑꯋ",
+  "ꯠꯄ",
+  "ꯂ",
+  "ꯈ",
+  "mi",
+  "khara",
+  "laak",
+  "i",
+  "ꯅꯉꯅ",
+  "ꯕ",
+  "ꯉꯃꯒꯗ",
+  "ꯇꯁ",
+  "ꯡꯅ",
+  "ꯌꯔꯕꯗ",
+  "ꯑ",
+  "ꯛ",
+  "chaaba",
+};
+const uint16_t WA_FREQ_106_RANKS[] = {
+  6, 22, 0, 0, 2, 10, 0, 9, 0, 8, 17, 0, 0, 25, 0, 0,
+  4, 0, 7, 13, 14, 24, 27, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+  26, 21, 0, 0, 0, 20, 0, 1, 0, 0, 11, 3, 0, 23, 19, 0,
+  0, 15, 0, 12, 0, 0, 0, 16, 0, 28, 0, 0, 0, 18, 0, 0,
+};
+
+const char *WA_FREQ_107_TOKENS[] = {
+  "we",
+  "wa",
+  "ken",
+  "ata",
+  "kenhróhkwa",
+  "kahsohkwanón",
+  "s",
+  "shé",
+  "kon",
+  "skennenkó",
+  "atià",
+  "tawi",
+  "só",
+  "tsi",
+  "kowá",
+  "nen",
+  "í",
+  "i",
+  "akwawenhshón",
+  "a",
+  "thí",
+  "áhsen",
+  "niiohwistá",
+  "e",
+  "téntre",
+  "kén",
+  "thon",
+  "na",
+  "tontá",
+  "se",
+  "atennà",
+  "tshera",
+  "ratihní",
+  "nons",
+  "ahtahkwa",
+  "ón",
+  "tehonráhta",
+  "ahs",
+  "nonkwehón",
+  "atón",
+  "tánon",
+  "tsoié",
+  "on",
+  "ionkhihsenná",
+  "wi",
+  "aón",
+  "ton",
+  "kenh",
+  "iahsheiatewennáta",
+  "ahse",
+  "ontate",
+  "nisténha",
+};
+const uint16_t WA_FREQ_107_RANKS[] = {
+  0, 0, 1, 5, 10, 50, 0, 0, 0, 39, 0, 0, 0, 19, 17, 27,
+  4, 44, 48, 35, 0, 12, 0, 13, 0, 0, 7, 0, 0, 41, 43, 0,
+  0, 15, 11, 0, 28, 0, 0, 0, 36, 0, 0, 14, 38, 0, 0, 0,
+  29, 0, 0, 9, 20, 32, 45, 47, 0, 0, 37, 0, 2, 0, 0, 0,
+  0, 0, 0, 0, 3, 0, 33, 0, 0, 0, 0, 0, 0, 23, 31, 0,
+  0, 0, 0, 0, 0, 34, 0, 0, 40, 0, 0, 0, 0, 0, 30, 52,
+  21, 49, 0, 0, 25, 0, 6, 0, 0, 0, 0, 26, 0, 0, 18, 0,
+  0, 0, 0, 24, 42, 0, 0, 0, 51, 0, 8, 16, 22, 0, 0, 46,
+};
+
+const char *WA_FREQ_108_TOKENS[] = {
+  "dan",
+  "yang",
+  "di",
+  "ini",
+  "dengan",
+  "untuk",
+  "dalam",
+  "pada",
+  "itu",
+  "dari",
+  "oleh",
+  "kepada",
+  "tidak",
+  "juga",
+  "akan",
+  "telah",
+  "ke",
+  "adalah",
+  "bagi",
+  "tahun",
+  "mereka",
+  "sebagai",
+  "atau",
+  "tersebut",
+  "negara",
+  "daripada",
+  "Haji",
+  "orang",
+  "lebih",
+  "satu",
+  "merupakan",
+  "menjadi",
+  "boleh",
+  "Malaysia",
+  "kerana",
+  "ialah",
+  "seperti",
+  "serta",
+  "beliau",
+  "lain",
+  "mempunyai",
+  "lagi",
+  "hari",
+  "dapat",
+  "bin",
+  "Pada",
+  "masa",
+  "ia",
+  "secara",
+  "Awang",
+  "Brunei",
+  "sebuah",
+  "antara",
+  "dua",
+  "ada",
+  "seorang",
+  "bahawa",
+  "tetapi",
+  "berkata",
+  "kerajaan",
+  "iaitu",
+  "kawasan",
+  "Islam",
+  "para",
+  "beberapa",
+  "sama",
+  "Beliau",
+  "ketika",
+  "Melayu",
+  "Majlis",
+  "baru",
+  "terletak",
+  "atas",
+  "Menteri",
+  "Dalam",
+  "Negara",
+  "pertama",
+  "banyak",
+  "hanya",
+  "menggunakan",
+  "Yang",
+  "semasa",
+  "melalui",
+  "katanya",
+  "selepas",
+  "berkenaan",
+  "semua",
+  "digunakan",
+  "perlu",
+  "dunia",
+  "laut",
+  "apabila",
+  "pihak",
+  "rakyat",
+  "Jabatan",
+  "Di",
+  "kita",
+  "Ia",
+  "pula",
+  "setiap",
+  "mengenai",
+  "turut",
+  "besar",
+  "kedudukan",
+  "termasuk",
+  "sebelum",
+  "tempat",
+  "meter",
+  "masih",
+  "hingga",
+  "bersama",
+  "bahasa",
+  "rumah",
+  "Kementerian",
+  "ramai",
+  "sehingga",
+  "bawah",
+  "dia",
+  "Daerah",
+  "penduduk",
+  "mana",
+  "utama",
+  "pelbagai",
+  "pasukan",
+  "Lapangan",
+  "tinggi",
+  "bukan",
+  "Terbang",
+  "memberi",
+  "tiga",
+  "raya",
+  "pelajar",
+  "terhadap",
+  "kini",
+  "sudah",
+  "kali",
+  "lalu",
+  "sahaja",
+  "sekolah",
+  "berjaya",
+  "sendiri",
+  "salah",
+  "membuat",
+  "baik",
+  "sini",
+  "bulan",
+  "masyarakat",
+  "buah",
+  "menerima",
+  "sebanyak",
+  "air",
+  "terdapat",
+  "diri",
+  "Darussalam",
+  "Ini",
+  "anak",
+  "terus",
+  "ketinggian",
+  "mengambil",
+  "majlis",
+  "sistem",
+  "saya",
+  "kecil",
+  "ahli",
+  "aras",
+  "mendapat",
+  "Ketua",
+  "diadakan",
+  "Abdul",
+  "Kampung",
+  "nama",
+  "luar",
+  "tentera",
+  "bermula",
+  "Dr",
+  "Mohd",
+  "negeri",
+  "berlaku",
+  "pernah",
+  "kami",
+  "Amerika",
+  "UMNO",
+  "bahagian",
+  "memberikan",
+  "selama",
+  "semula",
+  "kedua",
+  "jika",
+  "bidang",
+  "Datuk",
+  "perkhidmatan",
+  "peratus",
+  "dikenali",
+  "Syarikat",
+  "sejak",
+  "syarikat",
+  "amat",
+  "pilihan",
+  "anda",
+  "peserta",
+  "Pusat",
+  "Selain",
+  "Seri",
+  "penting",
+  "tanpa",
+  "kemudian",
+  "bandar",
+  "membantu",
+  "paling",
+  "Negeri",
+  "ekonomi",
+  "membawa",
+  "awal",
+  "tanah",
+  "program",
+  "kata",
+  "sekali",
+  "berada",
+  "mampu",
+  "kumpulan",
+  "Sekolah",
+  "1",
+  "mungkin",
+  "peringkat",
+  "keluarga",
+  "lelaki",
+  "Mereka",
+  "acara",
+  "parti",
+  "supaya",
+  "seluruh",
+  "Sukan",
+  "Kerajaan",
+  "kerja",
+  "juta",
+  "Pengarah",
+  "Pegawai",
+  "Bagi",
+  "bentuk",
+  "politik",
+  "kurang",
+  "Kuala",
+  "Dewan",
+  "Perdana",
+  "menyertai",
+  "pagi",
+  "China",
+  "pegawai",
+  "tempatan",
+  "manakala",
+  "keadaan",
+  "masalah",
+  "kuasa",
+  "terdiri",
+  "empat",
+  "memiliki",
+  "Berhormat",
+  "tempoh",
+  "lama",
+  "jam",
+  "mula",
+  "meningkatkan",
+  "Dengan",
+  "Sultan",
+  "sangat",
+  "binti",
+  "usaha",
+  "2",
+  "jenis",
+  "anggota",
+  "Hari",
+  "waktu",
+  "cara",
+  "wanita",
+  "pusat",
+  "Jepun",
+  "sekitar",
+  "menyebabkan",
+  "Pengiran",
+  "jumlah",
+  "malam",
+  "aktiviti",
+  "agama",
+  "menunjukkan",
+  "ibu",
+  "manusia",
+  "pembangunan",
+  "hidup",
+  "akhir",
+  "10",
+  "jalan",
+  "Indonesia",
+  "diberikan",
+  "Presiden",
+  "BN",
+  "dilakukan",
+  "kereta",
+  "hadir",
+  "3",
+  "tentang",
+  "Dato",
+  "berbanding",
+  "mudah",
+  "apa",
+  "Namun",
+  "Timbalan",
+  "sedang",
+  "kapal",
+  "Sementara",
+  "Setiausaha",
+  "Iraq",
+  "mahu",
+  "menarik",
+  "Dayang",
+  "Dia",
+  "hasil",
+  "maklumat",
+  "makanan",
+  "mengikut",
+  "Bahagian",
+  "petang",
+  "arah",
+  "kalangan",
+  "Ali",
+  "Pendidikan",
+  "masing-masing",
+  "Januari",
+  "biasa",
+  "walaupun",
+  "Singapura",
+  "agar",
+  "bantuan",
+  "berlangsung",
+  "mencapai",
+  "begitu",
+  "menyampaikan",
+  "projek",
+  "Universiti",
+  "samping",
+  "setelah",
+  "sepanjang",
+  "suatu",
+  "bahan",
+  "Cina",
+  "kampung",
+  "kaum",
+  "lima",
+  "Saya",
+  "baginda",
+  "pemimpin",
+  "Hal",
+  "mata",
+  "seterusnya",
+  "kerjasama",
+  "awam",
+  "2009",
+  "latitude",
+  "longtitude",
+  "Paduka",
+  "sebarang",
+  "pun",
+  "Masjid",
+  "kedua-dua",
+  "Tentera",
+  "2008",
+  "selaku",
+  "Tetap",
+  "emas",
+  "Sungai",
+  "pendidikan",
+  "melihat",
+  "datang",
+  "Bahasa",
+  "of",
+  "semakin",
+  "hubungan",
+  "perkara",
+  "dibuat",
+  "selain",
+  "Oleh",
+  "kembali",
+  "Menurut",
+  "daerah",
+  "calon",
+  "menyatakan",
+  "Ahmad",
+  "peluang",
+  "sebahagian",
+  "melakukan",
+  "mengadakan",
+  "sering",
+  "filem",
+  "Bagaimanapun",
+  "sejarah",
+  "perniagaan",
+  "badan",
+  "20",
+  "sesuatu",
+  "Raja",
+  "memastikan",
+  "pesawat",
+  "antarabangsa",
+  "sentiasa",
+  "Selepas",
+  "hendaklah",
+  "Asia",
+  "rendah",
+  "AS",
+  "diberi",
+  "Inggeris",
+  "Jalan",
+  "Jika",
+  "menyediakan",
+  "penggunaan",
+  "tenaga",
+  "wang",
+  "Program",
+  "maka",
+  "jawatan",
+  "Allah",
+  "2011",
+  "Kebangsaan",
+  "Lumpur",
+  "Untuk",
+  "hampir",
+  "4",
+  "bangunan",
+  "kira-kira",
+  "mendapatkan",
+  "2010",
+  "ketiga",
+  "menghasilkan",
+  "tangan",
+  "segi",
+  "5",
+  "Ehwal",
+  "biasanya",
+  "Perkhidmatan",
+  "Muhammad",
+  "kehormat",
+  "Besar",
+  "dibina",
+  "Julai",
+  "bertujuan",
+  "latihan",
+  "Antara",
+  "proses",
+  "Pulau",
+  "jelas",
+  "tetamu",
+  "Walaupun",
+  "serangan",
+  "memerlukan",
+  "terutama",
+  "sokongan",
+  "Tutong",
+  "India",
+  "Raya",
+  "bekerja",
+  "polis",
+  "Latitud",
+  "Longitud",
+  "industri",
+  "Arab",
+  "The",
+  "Belia",
+  "Bandar",
+  "disebabkan",
+  "namun",
+  "Jun",
+  "keputusan",
+  "kakitangan",
+  "sekarang",
+  "tawaran",
+  "kanan",
+  "isu",
+  "keselamatan",
+  "berkaitan",
+  "golongan",
+  "Pembangunan",
+  "Mac",
+  "panjang",
+  "sukan",
+  "semalam",
+  "undang-undang",
+  "warga",
+  "harga",
+  "30",
+  "Sarawak",
+  "12",
+  "Hajah",
+  "lagu",
+  "zaman",
+  "kes",
+  "kebanyakan",
+  "ASEAN",
+  "sumbangan",
+  "pengguna",
+  "Antarabangsa",
+  "Kesihatan",
+  "tiada",
+  "buku",
+  "15",
+  "Disember",
+  "perang",
+  "Orang",
+  "pemain",
+  "tindakan",
+  "khas",
+  "dianggap",
+  "penuh",
+  "minyak",
+  "9",
+  "menjadikan",
+  "September",
+  "berbeza",
+  "Abdullah",
+  "2012",
+  "Rakyat",
+  "muda",
+  "depan",
+  "kaki",
+  "negara-negara",
+  "sumber",
+  "Republik",
+  "Belait",
+  "produk",
+  "masuk",
+  "perlawanan",
+  "tinggal",
+  "buat",
+  "sedikit",
+  "kanak-kanak",
+  "British",
+  "Ogos",
+  "terkenal",
+  "ruang",
+  "kemudiannya",
+  "sementara",
+  "dilihat",
+  "diterima",
+  "Barat",
+  "meningkat",
+  "menyaksikan",
+  "terbaik",
+  "keperluan",
+  "April",
+  "rasmi",
+  "hati",
+  "lawatan",
+  "ingin",
+  "Pengerusi",
+  "dijangka",
+  "melibatkan",
+  "peranan",
+  "2007",
+  "tetap",
+  "Kumpulan",
+  "pertandingan",
+  "kejayaan",
+  "perubahan",
+  "Pasukan",
+  "Polis",
+  "Tetapi",
+  "perkembangan",
+  "Tahun",
+  "kesihatan",
+  "musim",
+  "November",
+  "tahap",
+  "keluar",
+  "teknologi",
+  "kemudahan",
+  "pasaran",
+  "Sabah",
+  "Katanya",
+  "Nama",
+  "Apabila",
+  "enam",
+  "membolehkan",
+  "Sebagai",
+  "pegawai-pegawai",
+  "pingat",
+  "kewangan",
+  "harus",
+  "belum",
+  "demikian",
+  "Tidak",
+  "menerusi",
+  "sektor",
+  "sesuai",
+  "udara",
+  "terpaksa",
+  "mencari",
+  "Ugama",
+  "minit",
+  "Oktober",
+  "diambil",
+  "disediakan",
+  "tengah",
+  "2006",
+  "Mulia",
+  "wilayah",
+  "pasti",
+  "Pemangku",
+  "Kami",
+  "Mei",
+  "asing",
+  "hadapan",
+  "Selangor",
+  "mengandungi",
+  "tertentu",
+  "asas",
+  "Dunia",
+  "batu",
+  "pembinaan",
+  "alam",
+  "seramai",
+  "masjid",
+  "jauh",
+  "kehidupan",
+  "bekas",
+  "komputer",
+  "budaya",
+  "Terdapat",
+  "terlibat",
+  "dikatakan",
+  "umum",
+  "guru",
+  "wakil",
+  "Eropah",
+  "kesan",
+  "berdasarkan",
+  "Pejabat",
+  "media",
+  "pokok",
+  "terakhir",
+  "Kita",
+  "memenangi",
+  "laman",
+  "persembahan",
+  "cuba",
+  "tujuan",
+  "rasa",
+  "Ahli",
+  "senjata",
+  "mengikuti",
+  "6",
+  "semangat",
+  "Ketika",
+  "api",
+  "bacaan",
+  "akibat",
+  "terbesar",
+  "Diraja",
+  "mengalami",
+  "Sri",
+  "Bukit",
+  "perempuan",
+  "Perak",
+  "Satu",
+  "menjelaskan",
+  "bangsa",
+  "dilaksanakan",
+  "Australia",
+  "and",
+  "Tanah",
+  "khususnya",
+  "langsung",
+  "Johor",
+  "seseorang",
+  "ikan",
+  "permainan",
+  "26",
+  "Jerman",
+  "berharap",
+  "7",
+  "abad",
+  "Burung",
+  "tadi",
+  "dahulu",
+  "akhirnya",
+  "Parlimen",
+  "bapa",
+  "agak",
+  "warna",
+  "pengurusan",
+  "sempena",
+  "sesi",
+  "diikuti",
+  "dijalankan",
+  "cukup",
+  "pengalaman",
+  "8",
+  "Taman",
+  "pembangkang",
+  "muzik",
+  "menghadapi",
+  "seni",
+  "Sebelum",
+  "dilantik",
+  "hujan",
+  "Hadir",
+  "orang-orang",
+  "kenderaan",
+  "pekerja",
+  "dasar",
+  "ketua",
+  "saja",
+  "hadiah",
+  "muncul",
+  "gagal",
+  "selamat",
+  "lepas",
+  "penyakit",
+  "Mukim",
+  "16",
+  "Melaka",
+  "Laut",
+  "operasi",
+  "Selatan",
+  "dijadikan",
+  "menambah",
+  "Persatuan",
+  "sebenarnya",
+  "disampaikan",
+  "melaksanakan",
+  "menjalankan",
+  "didapati",
+  "Batu",
+  "bilik",
+  "kuat",
+  "25",
+  "mana-mana",
+  "terbang",
+  "bagaimanapun",
+  "berasal",
+  "Jawatankuasa",
+  "siri",
+  "unit",
+  "ditubuhkan",
+  "sebelah",
+  "swasta",
+  "membina",
+  "anak-anak",
+  "mangsa",
+  "11",
+  "belakang",
+  "keseluruhan",
+  "2004",
+  "langkah",
+  "Para",
+  "undi",
+  "moden",
+  "memulakan",
+  "kerusi",
+  "memilih",
+  "perhatian",
+  "kejadian",
+  "membentuk",
+  "kadar",
+  "Manakala",
+  "Md",
+  "melahirkan",
+  "ahli-ahli",
+  "ilmu",
+  "nilai",
+  "tarikh",
+  "Thailand",
+  "Ibrahim",
+  "berat",
+  "Februari",
+  "Timur",
+  "mati",
+  "asal",
+  "minggu",
+  "menyokong",
+  "dibawa",
+  "individu",
+  "18",
+  "Abd",
+  "KUALA",
+  "Dari",
+  "Perancis",
+  "Kewangan",
+  "pengajian",
+  "pengetahuan",
+  "Najib",
+  "bebas",
+  "bilion",
+  "Rahman",
+  "Temburong",
+  "terutamanya",
+  "pentadbiran",
+  "kursus",
+  "pengundi",
+  "kota",
+  "hutan",
+  "Baginda",
+  "meninggalkan",
+  "pejabat",
+  "dikeluarkan",
+  "dipilih",
+  "14",
+  "A",
+  "sekiranya",
+  "web",
+  "memasuki",
+  "sepenuhnya",
+  "Semasa",
+  "kelas",
+  "bakal",
+  "13",
+  "wujud",
+  "2005",
+  "malah",
+  "sambutan",
+  "mengurangkan",
+  "Tuan",
+  "kepentingan",
+  "Setiap",
+  "Nasional",
+  "ucapan",
+  "II",
+  "perkataan",
+  "Jumaat",
+  "Awam",
+  "Projek",
+  "Sabtu",
+  "menentang",
+  "Perang",
+  "jadi",
+  "tambahan",
+  "ditemui",
+  "berterusan",
+  "sijil",
+  "Selasa",
+  "dipanggil",
+  "belia",
+  "Mesyuarat",
+  "hak",
+  "tiba",
+  "berusia",
+  "kos",
+  "meneruskan",
+  "segala",
+  "ditetapkan",
+  "Tun",
+  "kebangsaan",
+  "Setelah",
+  "perjalanan",
+  "kaedah",
+  "sebenar",
+  "Parti",
+  "nanti",
+  "Tan",
+  "bergantung",
+  "sosial",
+  "terbabit",
+  "Wanita",
+  "pulang",
+  "elektrik",
+  "contoh",
+  "24",
+  "lanjut",
+  "kemahiran",
+  "laluan",
+  "ataupun",
+  "mewakili",
+  "Waktu",
+  "Bangunan",
+  "jabatan",
+  "putih",
+  "sejenis",
+  "Unit",
+  "kekal",
+  "berkuasa",
+  "terlalu",
+  "tujuh",
+  "mengeluarkan",
+  "milik",
+  "rancangan",
+  "17",
+  "Sistem",
+  "laporan",
+  "bergerak",
+  "Pinang",
+  "diperlukan",
+  "Al-Qur'an",
+  "ianya",
+  "Abu",
+  "PAS",
+  "Persekutuan",
+  "kategori",
+  "sampai",
+  "Agung",
+  "bertindak",
+  "Tinggi",
+  "Sdn",
+  "merujuk",
+  "selatan",
+  "berusaha",
+  "panas",
+  "tugas",
+  "bertanggungjawab",
+  "tahu",
+  "sesetengah",
+  "Menengah",
+  "Ismail",
+  "akhbar",
+  "pemerintahan",
+  "rakan",
+  "makan",
+  "menghantar",
+  "100",
+  "demi",
+  "kenyataan",
+  "hal",
+  "haiwan",
+  "tanggungjawab",
+  "bola",
+  "juara",
+  "sebab",
+  "surat",
+  "21",
+  "Kota",
+  "Kategori",
+  "Juga",
+  "taklimat",
+  "DAP",
+  "sedia",
+  "barat",
+  "lewat",
+  "utara",
+  "berkhidmat",
+  "menawarkan",
+  "Mohammad",
+  "penulis",
+  "menggalakkan",
+  "berita",
+  "pelanggan",
+  "diketuai",
+  "popular",
+  "Ibu",
+  "bilangan",
+  "konsep",
+  "tapak",
+  "2013",
+  "dirinya",
+  "dihantar",
+  "memenuhi",
+  "isteri",
+  "dimulakan",
+  "Korea",
+  "kulit",
+  "terbuka",
+  "alat",
+  "cabaran",
+  "Muara",
+  "Semua",
+  "berkesan",
+  "perubatan",
+  "Israel",
+  "sukar",
+  "menang",
+  "kematian",
+  "pantai",
+  "Kebanyakan",
+  "Ada",
+  "dihasilkan",
+  "kajian",
+  "mulai",
+  "Kelantan",
+  "meminta",
+  "Tengah",
+  "mengekalkan",
+  "sungai",
+  "percaya",
+  "sana",
+  "New",
+  "Othman",
+  "jangka",
+  "menghadiri",
+  "rawatan",
+  "kempen",
+  "berakhir",
+  "Isnin",
+  "tak",
+  "jelasnya",
+  "Baru",
+  "50",
+  "bekalan",
+  "keras",
+  "Khamis",
+  "Utara",
+  "kelihatan",
+  "menurut",
+  "Dan",
+  "bumi",
+  "diperolehi",
+};
+const uint16_t WA_FREQ_108_RANKS[] = {
+  0, 392, 447, 296, 422, 861, 913, 229, 386, 896, 911, 351, 609, 967, 65, 994,
+  260, 0, 23, 0, 141, 0, 0, 0, 0, 0, 0, 0, 0, 0, 915, 0,
+  823, 0, 549, 106, 269, 0, 85, 0, 0, 0, 552, 530, 546, 0, 531, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 405, 662, 0, 0, 385, 499, 0,
+  0, 0, 0, 519, 809, 0, 0, 653, 0, 36, 466, 0, 0, 0, 0, 0,
+  0, 577, 217, 0, 331, 409, 417, 0, 792, 0, 51, 461, 936, 677, 0, 0,
+  0, 0, 238, 320, 0, 0, 0, 0, 0, 0, 0, 0, 958, 0, 0, 0,
+  0, 722, 63, 0, 0, 929, 0, 0, 0, 0, 433, 188, 0, 0, 463, 0,
+  0, 0, 879, 920, 0, 0, 0, 0, 15, 0, 62, 563, 0, 121, 0, 0,
+  745, 0, 0, 0, 253, 48, 905, 394, 424, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 332, 370, 624, 92, 13, 663, 718, 817, 0, 535, 0, 0, 0,
+  980, 0, 272, 0, 0, 0, 0, 0, 0, 0, 0, 975, 0, 0, 0, 186,
+  430, 516, 757, 0, 740, 308, 442, 878, 928, 0, 995, 0, 0, 0, 0, 419,
+  568, 0, 0, 0, 999, 93, 0, 0, 0, 0, 0, 0, 0, 77, 0, 472,
+  802, 83, 89, 518, 319, 235, 858, 912, 993, 14, 873, 178, 0, 0, 0, 0,
+  644, 354, 778, 818, 845, 0, 584, 45, 610, 710, 895, 0, 81, 474, 0, 353,
+  533, 487, 0, 0, 0, 0, 0, 144, 0, 204, 0, 0, 0, 214, 241, 636,
+  0, 0, 173, 266, 898, 477, 785, 0, 0, 589, 676, 0, 0, 560, 0, 705,
+  0, 0, 951, 0, 767, 990, 0, 0, 0, 248, 0, 0, 0, 0, 401, 108,
+  0, 0, 0, 28, 0, 899, 974, 0, 770, 0, 0, 0, 0, 0, 0, 0,
+  0, 239, 335, 0, 883, 0, 84, 467, 554, 0, 0, 0, 0, 544, 545, 640,
+  887, 992, 667, 0, 24, 0, 0, 0, 908, 0, 208, 407, 471, 0, 0, 0,
+  586, 0, 0, 321, 522, 641, 688, 478, 675, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 148, 774, 347, 576, 884, 0, 171, 631,
+  704, 363, 491, 0, 0, 0, 0, 0, 0, 0, 0, 261, 699, 755, 526, 724,
+  0, 0, 0, 182, 64, 862, 991, 0, 0, 0, 904, 0, 0, 0, 0, 0,
+  606, 257, 32, 498, 184, 211, 918, 0, 779, 0, 0, 310, 342, 0, 0, 790,
+  0, 743, 821, 747, 290, 365, 0, 0, 0, 201, 917, 94, 0, 0, 483, 0,
+  334, 0, 33, 70, 777, 221, 0, 0, 888, 459, 0, 660, 556, 123, 0, 0,
+  0, 0, 0, 828, 983, 0, 708, 0, 0, 0, 0, 0, 0, 0, 0, 634,
+  458, 0, 340, 0, 762, 136, 947, 0, 0, 0, 0, 309, 0, 833, 910, 314,
+  475, 437, 592, 796, 88, 932, 922, 703, 941, 783, 553, 307, 181, 21, 230, 529,
+  659, 766, 832, 776, 223, 800, 946, 0, 670, 0, 702, 902, 726, 754, 791, 0,
+  0, 0, 0, 0, 652, 736, 795, 801, 0, 964, 0, 0, 0, 0, 781, 350,
+  0, 0, 0, 174, 95, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 0,
+  512, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 510, 903, 0,
+  428, 0, 169, 687, 578, 738, 616, 713, 700, 933, 0, 0, 0, 0, 0, 0,
+  0, 618, 0, 0, 75, 963, 0, 0, 0, 0, 0, 0, 0, 642, 0, 0,
+  961, 620, 0, 613, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 145,
+  0, 0, 0, 341, 0, 891, 812, 408, 302, 0, 0, 360, 0, 352, 367, 0,
+  0, 0, 0, 0, 190, 968, 0, 759, 395, 276, 0, 0, 0, 0, 0, 786,
+  0, 378, 200, 0, 0, 0, 0, 0, 515, 0, 0, 857, 154, 0, 0, 25,
+  78, 198, 508, 756, 927, 0, 0, 0, 287, 0, 0, 830, 0, 567, 892, 212,
+  0, 957, 0, 0, 987, 259, 0, 0, 50, 160, 0, 0, 548, 782, 0, 0,
+  0, 0, 0, 0, 0, 686, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  960, 187, 0, 146, 572, 985, 0, 0, 0, 0, 0, 945, 0, 265, 0, 0,
+  0, 469, 716, 270, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 725, 0,
+  0, 49, 0, 0, 625, 741, 0, 470, 0, 0, 727, 0, 0, 0, 565, 140,
+  71, 749, 517, 175, 0, 0, 0, 0, 649, 0, 0, 325, 882, 349, 203, 400,
+  614, 0, 485, 0, 0, 0, 0, 110, 0, 626, 0, 617, 0, 0, 170, 543,
+  763, 3, 794, 0, 0, 0, 0, 0, 0, 0, 0, 193, 587, 0, 128, 789,
+  0, 837, 0, 0, 0, 523, 853, 0, 0, 733, 376, 488, 0, 0, 109, 979,
+  348, 0, 322, 938, 119, 210, 0, 566, 0, 0, 527, 361, 397, 0, 0, 0,
+  124, 0, 0, 0, 482, 825, 897, 996, 0, 155, 665, 426, 0, 0, 429, 292,
+  721, 0, 0, 80, 0, 364, 0, 0, 0, 41, 607, 0, 0, 0, 0, 39,
+  168, 396, 619, 748, 732, 863, 158, 489, 865, 0, 0, 784, 0, 0, 855, 0,
+  0, 0, 0, 301, 570, 0, 0, 0, 0, 0, 602, 183, 286, 0, 0, 0,
+  859, 107, 251, 793, 336, 984, 886, 0, 438, 0, 0, 129, 99, 454, 633, 597,
+  637, 0, 179, 0, 0, 207, 0, 0, 0, 0, 0, 233, 937, 112, 0, 19,
+  956, 0, 304, 256, 495, 74, 728, 0, 0, 621, 122, 497, 744, 0, 0, 0,
+  0, 797, 0, 0, 0, 346, 0, 0, 326, 0, 103, 0, 139, 66, 31, 690,
+  0, 149, 116, 0, 43, 0, 490, 807, 0, 0, 247, 872, 583, 0, 0, 455,
+  0, 264, 403, 0, 383, 0, 8, 969, 943, 953, 680, 0, 0, 299, 0, 658,
+  0, 274, 0, 0, 303, 0, 0, 0, 0, 0, 720, 808, 622, 0, 0, 0,
+  115, 0, 323, 0, 0, 0, 237, 0, 0, 0, 368, 413, 773, 0, 0, 0,
+  0, 375, 0, 0, 0, 611, 0, 0, 0, 0, 481, 393, 0, 0, 595, 0,
+  0, 195, 398, 434, 505, 0, 711, 0, 225, 234, 164, 313, 835, 371, 854, 293,
+  982, 1000, 632, 0, 0, 0, 82, 0, 0, 0, 0, 0, 263, 0, 0, 0,
+  414, 111, 27, 525, 540, 850, 176, 147, 245, 436, 534, 496, 246, 503, 521, 0,
+  0, 0, 0, 0, 0, 216, 0, 0, 425, 504, 511, 860, 0, 432, 760, 0,
+  0, 0, 0, 163, 889, 848, 0, 224, 327, 374, 0, 0, 532, 0, 0, 0,
+  7, 402, 643, 0, 0, 0, 167, 390, 787, 714, 0, 0, 0, 0, 0, 816,
+  0, 311, 0, 0, 0, 0, 420, 282, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 669, 0, 0, 730, 133, 847, 0, 780, 298, 0, 989, 768, 0, 0, 0,
+  312, 0, 0, 0, 0, 881, 0, 0, 0, 0, 0, 0, 0, 0, 0, 723,
+  0, 0, 249, 0, 0, 0, 0, 338, 295, 476, 648, 761, 769, 0, 0, 0,
+  159, 0, 0, 0, 0, 0, 0, 0, 0, 907, 0, 0, 0, 29, 0, 764,
+  0, 0, 59, 0, 0, 0, 0, 0, 439, 0, 0, 0, 880, 0, 0, 0,
+  729, 26, 0, 0, 558, 580, 561, 0, 0, 574, 684, 415, 166, 697, 846, 856,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 742, 0, 0, 603, 0,
+  2, 0, 0, 0, 271, 324, 411, 679, 0, 500, 501, 550, 0, 0, 0, 306,
+  278, 34, 305, 507, 0, 0, 0, 0, 0, 0, 1, 868, 0, 0, 215, 599,
+  189, 0, 0, 0, 673, 901, 0, 942, 0, 0, 0, 291, 135, 752, 449, 134,
+  513, 0, 410, 952, 978, 388, 250, 202, 406, 734, 864, 890, 950, 959, 0, 0,
+  0, 213, 0, 275, 0, 0, 0, 0, 38, 0, 0, 220, 443, 628, 751, 0,
+  0, 412, 0, 524, 0, 0, 906, 258, 280, 949, 0, 608, 645, 0, 0, 268,
+  0, 0, 0, 900, 231, 377, 0, 462, 76, 707, 919, 894, 0, 0, 0, 0,
+  277, 0, 0, 876, 914, 0, 5, 0, 0, 344, 758, 0, 0, 719, 0, 143,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 423, 252, 0, 0, 635, 955, 222,
+  819, 831, 874, 20, 571, 971, 104, 87, 255, 638, 42, 924, 0, 514, 357, 698,
+  0, 944, 0, 0, 0, 0, 0, 0, 0, 0, 382, 418, 0, 0, 0, 132,
+  0, 0, 0, 165, 694, 0, 0, 90, 480, 0, 0, 0, 0, 0, 557, 0,
+  456, 285, 113, 345, 579, 37, 16, 627, 317, 206, 337, 654, 685, 693, 69, 380,
+  127, 494, 547, 73, 639, 765, 843, 871, 966, 0, 977, 56, 328, 827, 0, 0,
+  931, 22, 0, 435, 623, 0, 0, 0, 596, 689, 297, 0, 0, 0, 444, 841,
+  0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 54, 379, 0, 921, 870,
+  0, 0, 739, 0, 0, 226, 630, 86, 96, 717, 737, 836, 281, 954, 55, 988,
+  0, 60, 448, 197, 283, 0, 35, 300, 0, 0, 0, 0, 0, 0, 0, 218,
+  0, 333, 695, 948, 0, 0, 0, 0, 126, 451, 0, 0, 0, 30, 79, 598,
+  771, 810, 799, 972, 473, 219, 0, 826, 715, 647, 746, 236, 289, 612, 373, 829,
+  372, 0, 0, 114, 0, 58, 0, 0, 0, 209, 0, 0, 0, 692, 0, 284,
+  493, 940, 0, 0, 0, 227, 706, 0, 588, 731, 0, 0, 0, 0, 672, 930,
+  986, 0, 0, 0, 105, 0, 445, 464, 118, 125, 72, 359, 506, 824, 0, 389,
+  100, 362, 840, 804, 820, 0, 0, 0, 0, 0, 40, 318, 0, 0, 0, 0,
+  664, 0, 0, 528, 0, 923, 0, 682, 0, 0, 0, 0, 0, 0, 0, 0,
+  452, 0, 0, 0, 585, 805, 0, 0, 0, 0, 0, 965, 0, 0, 0, 242,
+  453, 981, 0, 0, 0, 537, 0, 0, 788, 130, 509, 0, 0, 0, 387, 701,
+  0, 970, 131, 273, 0, 0, 0, 465, 172, 520, 877, 0, 0, 0, 0, 600,
+  0, 52, 421, 479, 61, 68, 53, 536, 177, 0, 0, 484, 0, 0, 0, 137,
+  0, 0, 0, 0, 0, 0, 191, 0, 0, 0, 0, 0, 156, 646, 151, 814,
+  575, 594, 10, 446, 834, 0, 0, 934, 330, 0, 0, 0, 142, 468, 0, 0,
+  492, 604, 416, 678, 885, 0, 852, 998, 0, 772, 650, 839, 838, 0, 0, 0,
+  0, 0, 11, 486, 696, 0, 0, 0, 666, 683, 655, 0, 0, 0, 0, 0,
+  180, 581, 753, 875, 228, 976, 161, 101, 185, 102, 294, 0, 590, 869, 0, 0,
+  0, 559, 0, 0, 98, 441, 0, 0, 0, 391, 551, 0, 356, 0, 199, 712,
+  399, 0, 0, 709, 0, 0, 0, 0, 674, 0, 440, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 811, 0, 0, 0, 0, 0, 0, 564, 629, 0, 0, 0,
+  0, 358, 0, 67, 0, 0, 0, 0, 343, 427, 0, 384, 916, 997, 12, 150,
+  369, 925, 893, 0, 0, 538, 0, 0, 6, 803, 4, 502, 591, 842, 867, 935,
+  57, 0, 0, 0, 909, 656, 0, 973, 91, 0, 849, 0, 0, 0, 0, 555,
+  605, 691, 822, 117, 844, 404, 0, 0, 0, 615, 750, 138, 0, 288, 573, 205,
+  815, 569, 0, 0, 0, 601, 0, 0, 582, 0, 460, 671, 813, 9, 162, 0,
+  668, 0, 262, 329, 450, 593, 243, 0, 0, 939, 775, 0, 0, 0, 0, 0,
+  0, 196, 0, 17, 798, 851, 0, 0, 0, 457, 157, 316, 431, 366, 0, 0,
+  0, 254, 47, 866, 153, 0, 0, 0, 0, 735, 0, 120, 0, 0, 0, 657,
+  661, 539, 962, 0, 279, 240, 267, 381, 97, 681, 339, 0, 232, 0, 0, 0,
+  926, 0, 244, 0, 806, 0, 0, 0, 542, 562, 651, 0, 541, 0, 0, 0,
+  0, 192, 0, 0, 0, 0, 0, 44, 152, 315, 194, 0, 0, 355, 0, 0,
+};
+
+const char *WA_FREQ_109_TOKENS[] = {
+  "um",
+  "yang",
+  "saya",
+  "kita",
+  "dan",
+  "di",
+  "lah",
+  "ada",
+  "untuk",
+  "itu",
+  "kalau",
+  "ini",
+  "dalam",
+  "juga",
+  "tidak",
+  "ni",
+  "dia",
+  "dengan",
+  "jadi",
+  "atau",
+  "orang",
+  "boleh",
+  "suka",
+  "tu",
+  "apa",
+  "akan",
+  "macam",
+  "anak",
+  "ialah",
+  "pun",
+  "adalah",
+  "unclear",
+  "sebab",
+  "mereka",
+  "lebih",
+  "negara",
+  "kami",
+  "banyak",
+  "noise",
+  "baik",
+  "kepada",
+  "tempat",
+  "teknologi",
+  "masa",
+  "dapat",
+  "tapi",
+  "satu",
+  "memang",
+  "ke",
+  "rumah",
+  "mau",
+  "seperti",
+  "keluarga",
+  "sekarang",
+  "sangat",
+  "mana",
+  "makanan",
+  "menggunakan",
+  "sama",
+  "sudah",
+  "cara",
+  "sekolah",
+  "kanak",
+  "kadang",
+  "lain",
+  "pada",
+  "dulu",
+  "komuniti",
+  "hari",
+  "kerja",
+  "ya",
+  "selalu",
+  "kerana",
+  "buat",
+  "oleh",
+  "begitu",
+  "bagi",
+  "membantu",
+  "bila",
+  "telefon",
+  "dorang",
+  "saja",
+  "daripada",
+  "punya",
+  "tentang",
+  "permainan",
+  "bahasa",
+  "dari",
+  "muzik",
+  "sukan",
+  "paling",
+  "rasa",
+  "cerita",
+  "bimbit",
+  "pigi",
+  "main",
+  "perniagaan",
+  "ataupun",
+  "lagi",
+  "kesihatan",
+  "contohnya",
+  "biasanya",
+  "melalui",
+  "sentiasa",
+  "ibu",
+  "mungkin",
+  "masyarakat",
+  "kawan",
+  "perlu",
+  "supaya",
+  "iaitu",
+  "secara",
+  "menjaga",
+  "cuaca",
+  "kehidupan",
+  "mempunyai",
+  "kan",
+  "warna",
+  "penting",
+  "antara",
+  "nampak",
+  "keadaan",
+  "durang",
+  "sendiri",
+  "bunga",
+  "guru",
+  "perkara",
+  "jenis",
+  "belajar",
+  "kecil",
+  "luar",
+  "bapa",
+  "makan",
+  "malaysia",
+  "diri",
+  "jauh",
+  "bermain",
+  "kampung",
+  "pernah",
+  "apabila",
+  "biasa",
+  "musim",
+  "cough",
+  "pokok",
+  "sejarah",
+  "hujan",
+  "semua",
+  "jika",
+  "menjadi",
+  "biru",
+  "kemudian",
+  "sihat",
+  "membuat",
+  "kurang",
+  "baru",
+  "mesti",
+  "kena",
+  "seorang",
+  "sabah",
+  "mencari",
+  "tempatan",
+  "buli",
+  "kawasan",
+  "pertama",
+  "bagus",
+  "mimang",
+  "tradisional",
+  "setiap",
+  "hidup",
+  "ingin",
+  "panas",
+  "alat",
+  "berada",
+  "iklim",
+  "penggunaan",
+  "tau",
+  "budaya",
+  "ia",
+  "program",
+  "tumbuhan",
+  "tahun",
+  "pula",
+  "sebagai",
+  "bola",
+  "senang",
+  "penyakit",
+  "pesta",
+  "dua",
+  "tua",
+  "salah",
+  "sebagainya",
+  "memberi",
+  "kerajaan",
+  "mudah",
+  "kegemaran",
+  "kasi",
+  "tarian",
+  "masalah",
+  "contoh",
+  "pergi",
+  "sesuatu",
+  "memudahkan",
+  "tangan",
+  "tiada",
+  "ketika",
+  "pembayaran",
+  "sekali",
+  "pandai",
+  "aktiviti",
+  "doktor",
+  "perayaan",
+  "maksudnya",
+  "pakai",
+  "duit",
+  "pelajaran",
+  "nasihat",
+  "bank",
+  "memerlukan",
+  "melihat",
+  "pekerjaan",
+  "buah",
+  "tingu",
+  "tetapi",
+  "pihak",
+  "mata",
+  "benda",
+  "susah",
+  "badan",
+  "kucing",
+  "ai",
+  "datang",
+  "besar",
+  "kad",
+  "segi",
+  "nya",
+  "berjaya",
+  "sesuai",
+  "lagu",
+  "tinggi",
+  "pasal",
+  "perkhidmatan",
+  "pelbagai",
+  "haiwan",
+  "agak",
+  "guna",
+  "pakaian",
+  "gunakan",
+  "mengikut",
+  "wanita",
+  "tinggal",
+  "berkaitan",
+  "amat",
+  "itulah",
+  "semasa",
+  "sistem",
+  "ramai",
+  "perubahan",
+  "memulakan",
+  "sepak",
+  "muda",
+  "digunakan",
+  "ka",
+  "merupakan",
+  "senaman",
+  "anu",
+  "bah",
+  "wang",
+  "melakukan",
+  "bantuan",
+  "lepas",
+  "bukan",
+  "bahan",
+  "seronok",
+  "berubah",
+  "mendapat",
+  "sungai",
+  "seni",
+  "minat",
+  "iya",
+  "percutian",
+  "telepon",
+  "talian",
+  "setakat",
+  "raya",
+  "pendapat",
+  "ujian",
+  "modal",
+  "beberapa",
+  "lakukan",
+  "jangan",
+  "bintang",
+  "berapa",
+  "berlaku",
+  "sana",
+  "betul",
+  "kedua",
+  "ahli",
+  "masuk",
+  "memberikan",
+  "nama",
+  "berjalan",
+  "ikut",
+  "sayur",
+  "barang",
+  "sebenarnya",
+  "tampat",
+  "cari",
+  "kebajikan",
+  "tersebut",
+  "umur",
+  "cantik",
+  "acara",
+  "kerna",
+  "telah",
+  "bekerja",
+  "seharian",
+  "langit",
+  "berenang",
+  "cuma",
+  "bersama",
+  "hati",
+  "telampau",
+  "kulintangan",
+  "perjalanan",
+  "hobi",
+  "pawagam",
+  "memandu",
+  "tekanan",
+  "laut",
+  "lama",
+  "berita",
+  "ok",
+  "bisaya",
+  "melayu",
+  "peguam",
+  "berpasukan",
+  "filem",
+  "me",
+  "hanya",
+  "pendidikan",
+  "hospital",
+  "tida",
+  "keperluan",
+  "memastikan",
+  "ingat",
+  "zaman",
+  "cukup",
+  "rakan",
+  "membayar",
+  "bajet",
+  "bilang",
+  "kereta",
+  "mengajar",
+  "meningkatkan",
+  "lima",
+  "online",
+  "bawa",
+  "temujanji",
+  "mengundi",
+  "misalnya",
+  "lahir",
+  "negeri",
+  "masih",
+  "tiga",
+  "buku",
+  "daun",
+  "awam",
+  "tenang",
+  "menyebabkan",
+  "pelajar",
+  "maklumat",
+  "perasaan",
+  "puluh",
+  "artis",
+  "mula",
+  "buahan",
+  "pengalaman",
+  "gembira",
+  "pegawai",
+  "sampai",
+  "berpindah",
+  "jalan",
+  "bidang",
+  "air",
+  "belum",
+  "terutama",
+  "info",
+  "penyanyi",
+  "ber",
+  "sikit",
+  "nda",
+  "depan",
+  "ubat",
+  "cabaran",
+  "video",
+  "tv",
+  "budak",
+  "bandar",
+  "keselamatan",
+  "awan",
+  "pembelajaran",
+  "tertentu",
+  "bikin",
+  "tokoh",
+  "urusan",
+  "la",
+  "kah",
+  "membawa",
+  "cerah",
+  "soalan",
+  "kenderaan",
+  "mengandung",
+  "sahaja",
+  "sini",
+  "internet",
+  "saling",
+  "sabab",
+  "kamu",
+  "dunia",
+  "melibatkan",
+  "masing",
+  "individu",
+  "waktu",
+  "terutamanya",
+  "berniaga",
+  "rakyat",
+  "cita",
+  "bergantung",
+  "okay",
+  "selamat",
+  "tengok",
+  "suci",
+  "tanam",
+  "badminton",
+  "membeli",
+  "sosial",
+  "tunai",
+  "beli",
+  "peristiwa",
+  "kebimbangan",
+  "tiba",
+  "mempelajari",
+  "kenapa",
+  "radio",
+  "berkhasiat",
+  "ikan",
+  "ideal",
+  "tanggungjawab",
+  "projek",
+  "saudara",
+  "ambil",
+  "jabatan",
+  "disediakan",
+  "dokumen",
+  "bertanya",
+  "terlalu",
+  "melawat",
+  "lawatan",
+  "kualiti",
+  "berbanding",
+  "dahulu",
+  "hal",
+  "sehingga",
+  "tahu",
+  "tadi",
+  "diorang",
+  "pikir",
+  "laugh",
+  "kemahiran",
+  "rancangan",
+  "sebelum",
+  "p",
+  "terkenal",
+  "sehari",
+  "alam",
+  "kali",
+  "suda",
+  "lalu",
+  "binatang",
+  "layang",
+  "perbankan",
+  "telipon",
+  "mendidik",
+  "sokongan",
+  "manusia",
+  "keluar",
+  "minggu",
+  "bulan",
+  "ayam",
+  "kemajuan",
+  "terbesar",
+  "dimainkan",
+  "terdapat",
+  "maju",
+  "mendung",
+  "tanya",
+  "pasangan",
+  "harapan",
+  "mati",
+  "minda",
+  "jiran",
+  "sa",
+  "suatu",
+  "sakit",
+  "selain",
+  "diberi",
+  "pelakon",
+  "siapa",
+  "menarik",
+  "dibuat",
+  "semuanya",
+  "bangsa",
+  "takut",
+  "generasi",
+  "menyihatkan",
+  "bercerita",
+  "mendapatkan",
+  "ramlee",
+  "gula",
+  "tumbuh",
+  "peluang",
+  "pagi",
+  "serangga",
+  "istimewa",
+  "gasing",
+  "mengenai",
+  "pasport",
+  "semakin",
+  "kedai",
+  "berbeza",
+  "masjid",
+  "penghijraan",
+  "disebabkan",
+  "nilai",
+  "peringkat",
+  "ilmu",
+  "kemudahan",
+  "bergerak",
+  "berhubung",
+  "membaca",
+  "risiko",
+  "utama",
+  "kertas",
+  "penulis",
+  "kaum",
+  "faedah",
+  "maka",
+  "agama",
+  "bagaimana",
+  "mengambil",
+  "kejayaan",
+  "menyokong",
+  "perlukan",
+  "antaranya",
+  "memasak",
+  "bersejarah",
+  "kemarau",
+  "walaupun",
+  "cigu",
+  "pinjaman",
+  "kaamatan",
+  "kreatif",
+  "sedang",
+  "penduduk",
+  "islam",
+  "tanpa",
+  "klinik",
+  "sedikit",
+  "mendengar",
+  "sekitar",
+  "pelajari",
+  "fikiran",
+  "etnik",
+  "bantu",
+  "kelapa",
+  "berwarna",
+  "mengetahui",
+  "balik",
+  "golongan",
+  "menambah",
+  "mencuci",
+  "jarang",
+  "minta",
+  "bentuk",
+  "diberikan",
+  "mampu",
+  "sebarang",
+  "merah",
+  "polis",
+  "agensi",
+  "beliau",
+  "adik",
+  "minyak",
+  "nanti",
+  "sayuran",
+  "dijaga",
+  "masak",
+  "ipin",
+  "gugup",
+  "semangat",
+  "peniaga",
+  "tasik",
+  "sambutan",
+  "popular",
+  "pasukan",
+  "inda",
+  "pengajaran",
+  "kebanyakan",
+  "seseorang",
+  "membentuk",
+  "kebanyakkan",
+  "terdekat",
+  "daerah",
+  "mem",
+  "pergerakan",
+  "kaki",
+  "empat",
+  "menyediakan",
+  "si",
+  "serta",
+  "genre",
+  "santai",
+  "tidur",
+  "pemakanan",
+  "manis",
+  "perubatan",
+  "mengurangkan",
+  "tun",
+  "semestinya",
+  "tradisi",
+  "sepanjang",
+  "ujan",
+  "memahami",
+  "ekonomi",
+  "jual",
+  "pengenalan",
+  "menghadapi",
+  "baju",
+  "ubatan",
+  "mainan",
+  "game",
+  "berminat",
+  "tanah",
+  "bercakap",
+  "pengetahuan",
+  "segala",
+  "begitulah",
+  "atas",
+  "enam",
+  "kana",
+  "banjir",
+  "para",
+  "kerbau",
+  "mahu",
+  "kerap",
+  "lagenda",
+  "tulah",
+  "berjumpa",
+  "hitam",
+  "bersih",
+  "buleh",
+  "khatulistiwa",
+  "sekejap",
+  "pemuzik",
+  "buaya",
+  "ic",
+  "majlis",
+  "menandakan",
+  "menjimatkan",
+  "cuci",
+  "buruj",
+  "dipanggil",
+  "mengikuti",
+  "suami",
+  "selesa",
+  "sukar",
+  "sekurang",
+  "se",
+  "sebabnya",
+  "petang",
+  "dengar",
+  "kewangan",
+  "dato",
+  "kagumi",
+  "menonton",
+  "bulih",
+  "ringan",
+  "jaga",
+  "durian",
+  "baca",
+  "dikatakan",
+  "panjang",
+  "selalunya",
+  "luas",
+  "batu",
+  "sejuk",
+  "murid",
+  "upin",
+  "kisah",
+  "pegi",
+  "kenduri",
+  "tarikh",
+  "bayar",
+  "ketat",
+  "faktor",
+  "bangga",
+  "kredit",
+  "anjing",
+  "harap",
+  "papan",
+  "mesin",
+  "aku",
+  "jugalah",
+  "berhijrah",
+  "asal",
+  "kasih",
+  "cikgu",
+  "ajar",
+  "cakap",
+  "harian",
+  "kurangnya",
+  "pejabat",
+  "fikir",
+  "baguslah",
+  "seluruh",
+  "terus",
+  "yakin",
+  "bahawa",
+  "siti",
+  "allahyarham",
+  "selebriti",
+  "da",
+  "s",
+  "tanaman",
+  "putih",
+  "ah",
+  "k",
+  "aplikasi",
+  "mengharapkan",
+  "kemerdekaan",
+  "menyambut",
+  "jumpa",
+  "tampar",
+  "takraw",
+  "urang",
+  "ribut",
+  "alhamdulillah",
+  "situ",
+  "sajalah",
+  "bersikap",
+  "canggih",
+  "terkini",
+  "bil",
+  "jam",
+  "dipilih",
+  "usahawan",
+  "terakhir",
+  "pasti",
+  "talipon",
+  "pertanian",
+  "pendapatan",
+  "sering",
+  "amalan",
+  "sekiranya",
+  "belas",
+  "adanya",
+  "soal",
+  "ianya",
+  "mandi",
+  "mama",
+  "merasa",
+  "era",
+  "seb",
+  "bagitau",
+  "mengadakan",
+  "pastikan",
+  "kesan",
+  "arwah",
+  "m",
+  "idea",
+  "kata",
+  "ma",
+  "pikiran",
+  "persekitaran",
+  "mengelakkan",
+  "mengamalkan",
+  "menanam",
+  "sembilan",
+  "sepuluh",
+  "handphone",
+  "gambar",
+  "kira",
+  "ketua",
+  "mat",
+  "guli",
+  "perempuan",
+  "rumput",
+  "diperlukan",
+  "dekat",
+  "situasi",
+  "berhati",
+  "kaunter",
+  "kuih",
+  "lautan",
+  "kek",
+  "kuman",
+  "penerimaan",
+  "tugasan",
+  "wayang",
+  "calon",
+  "moden",
+  "kicil",
+  "satunya",
+  "berbagai",
+  "kadangkala",
+  "ceramah",
+  "sesama",
+  "dewasa",
+  "rendah",
+  "bewarna",
+  "sebuah",
+  "peribadi",
+  "menenangkan",
+  "terhadap",
+  "harus",
+  "simpan",
+  "pengguna",
+  "scammer",
+  "sri",
+  "sia",
+  "nasir",
+  "terbaik",
+  "hampir",
+  "cepat",
+  "menulis",
+  "cuba",
+  "berehat",
+  "pemandangan",
+  "nak",
+  "rambutan",
+  "padi",
+  "err",
+  "merisaukan",
+  "jaman",
+  "memiliki",
+  "awal",
+  "memilih",
+  "pemimpin",
+  "kayu",
+  "komputer",
+  "skolah",
+  "kandungan",
+  "be",
+  "kecuali",
+  "guaman",
+  "tanda",
+  "suruh",
+  "kegembiraan",
+  "talipun",
+  "tolong",
+  "apakah",
+  "variasi",
+  "membimbangkan",
+  "matematik",
+  "tambah",
+  "universiti",
+  "perminan",
+  "dilakukan",
+  "begini",
+  "peluh",
+  "usaha",
+  "sikap",
+  "passport",
+  "naik",
+  "aman",
+  "kumpulan",
+  "bahagian",
+  "ja",
+  "kebaikan",
+  "fm",
+  "sanang",
+  "transfer",
+  "melaksanakan",
+  "kini",
+  "seterusnya",
+  "bertutur",
+  "damai",
+  "memakan",
+  "berat",
+  "jogging",
+  "berfikir",
+  "nah",
+  "tuai",
+  "kegunaan",
+  "keladi",
+  "mestilah",
+  "arah",
+  "bersenam",
+  "minum",
+  "beaufort",
+  "basar",
+  "panggil",
+  "bawang",
+  "kebersihan",
+  "nasi",
+  "peralatan",
+  "wujud",
+  "mendesak",
+  "oh",
+  "menentu",
+  "suku",
+  "remaja",
+  "media",
+  "pengurusan",
+  "qr",
+  "google",
+  "menjual",
+  "kecilan",
+  "monson",
+  "dilaksanakan",
+  "bercita",
+  "duduk",
+  "menyertai",
+  "cucu",
+  "sungguh",
+  "dihadapi",
+  "mempengaruhi",
+  "lukisan",
+  "jangkitan",
+  "cahaya",
+  "merindui",
+  "akhirat",
+  "covid",
+  "kalanya",
+  "congkak",
+  "proses",
+  "lari",
+  "perlahan",
+  "bilik",
+  "berguna",
+  "kerjasama",
+  "ba",
+  "membuatkan",
+  "kekal",
+  "isu",
+  "faham",
+  "monyet",
+  "menang",
+  "bergaul",
+  "caranya",
+  "bercuti",
+  "hasil",
+  "mangga",
+  "menuai",
+  "hasilnya",
+  "seja",
+  "luka",
+  "it",
+  "berjogging",
+  "segar",
+  "salleh",
+  "pilih",
+  "inggeris",
+  "kumbang",
+  "sup",
+  "tamu",
+  "asas",
+  "seremban",
+  "jinis",
+  "tepi",
+  "berminyak",
+  "menyampaikan",
+  "perkembangan",
+  "persatuan",
+  "semoga",
+  "meng",
+  "kota",
+  "melancong",
+  "segera",
+  "payah",
+  "berikan",
+  "gelap",
+  "jawapan",
+  "jururawat",
+  "baiklah",
+  "menjalankan",
+  "memancing",
+  "pulau",
+  "banggakan",
+  "hadiah",
+  "per",
+  "t",
+  "sains",
+  "darah",
+  "bole",
+  "kuda",
+  "telipun",
+  "pengajian",
+  "keinginan",
+  "undian",
+};
+const uint16_t WA_FREQ_109_RANKS[] = {
+  599, 95, 133, 337, 688, 868, 274, 577, 905, 906, 936, 988, 0, 0, 288, 489,
+  754, 771, 20, 301, 124, 794, 840, 927, 0, 0, 0, 0, 723, 137, 0, 0,
+  657, 0, 321, 128, 471, 0, 0, 0, 366, 872, 0, 250, 343, 801, 74, 0,
+  0, 0, 0, 887, 0, 828, 0, 0, 662, 0, 0, 0, 854, 0, 857, 0,
+  0, 0, 0, 0, 0, 0, 67, 0, 0, 29, 0, 0, 0, 0, 0, 681,
+  919, 0, 207, 0, 835, 506, 0, 0, 0, 0, 921, 0, 0, 0, 501, 928,
+  841, 0, 0, 0, 0, 0, 0, 0, 0, 0, 418, 683, 394, 0, 0, 0,
+  373, 0, 0, 730, 0, 0, 0, 0, 0, 0, 203, 148, 123, 227, 0, 454,
+  555, 0, 448, 0, 636, 0, 167, 0, 26, 0, 163, 0, 670, 56, 0, 0,
+  630, 0, 0, 0, 752, 178, 0, 145, 455, 0, 543, 0, 0, 0, 0, 0,
+  440, 442, 0, 177, 195, 269, 140, 15, 340, 512, 603, 0, 0, 524, 27, 959,
+  0, 0, 423, 569, 572, 0, 0, 0, 576, 882, 0, 708, 659, 0, 0, 847,
+  530, 349, 925, 292, 0, 456, 0, 0, 0, 0, 498, 0, 0, 0, 0, 0,
+  142, 200, 784, 0, 0, 224, 0, 0, 0, 395, 0, 0, 0, 164, 429, 436,
+  342, 103, 109, 240, 248, 348, 0, 761, 0, 14, 393, 293, 735, 674, 813, 0,
+  92, 627, 316, 79, 941, 0, 235, 380, 682, 990, 0, 0, 0, 273, 621, 780,
+  885, 0, 0, 0, 0, 0, 0, 40, 0, 119, 0, 0, 0, 144, 154, 341,
+  643, 802, 0, 94, 0, 399, 946, 0, 0, 180, 0, 317, 0, 551, 628, 411,
+  0, 0, 0, 0, 534, 0, 0, 881, 0, 379, 0, 0, 0, 0, 0, 0,
+  165, 0, 0, 21, 0, 0, 0, 129, 0, 0, 0, 447, 0, 0, 0, 0,
+  0, 76, 264, 584, 0, 0, 704, 0, 420, 480, 0, 0, 924, 0, 832, 0,
+  0, 955, 890, 515, 309, 0, 0, 0, 457, 0, 78, 819, 0, 0, 24, 0,
+  385, 0, 0, 616, 680, 0, 0, 251, 0, 0, 858, 862, 983, 0, 0, 0,
+  0, 0, 0, 0, 400, 438, 0, 0, 216, 221, 355, 499, 11, 546, 300, 0,
+  0, 0, 0, 0, 886, 759, 772, 0, 0, 0, 567, 375, 277, 258, 0, 0,
+  991, 0, 0, 701, 652, 286, 0, 0, 0, 490, 0, 0, 0, 0, 0, 0,
+  0, 827, 149, 338, 299, 462, 634, 926, 422, 951, 971, 0, 503, 709, 0, 0,
+  0, 0, 0, 863, 614, 0, 0, 0, 0, 0, 902, 426, 932, 0, 90, 0,
+  629, 556, 22, 573, 552, 776, 0, 823, 798, 315, 0, 0, 0, 242, 0, 970,
+  0, 0, 0, 0, 0, 0, 793, 0, 0, 0, 0, 0, 0, 0, 785, 0,
+  0, 306, 0, 1000, 0, 476, 0, 0, 0, 0, 433, 372, 0, 39, 0, 0,
+  518, 102, 817, 969, 261, 0, 0, 0, 993, 19, 0, 536, 110, 34, 563, 796,
+  859, 0, 583, 487, 106, 812, 0, 0, 0, 0, 146, 0, 811, 0, 0, 0,
+  0, 0, 0, 0, 0, 668, 722, 935, 0, 676, 226, 797, 606, 878, 880, 848,
+  549, 915, 931, 0, 0, 0, 0, 245, 0, 0, 0, 0, 0, 0, 0, 336,
+  295, 593, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 0, 171, 0, 0,
+  0, 703, 0, 895, 633, 677, 914, 430, 437, 588, 0, 0, 417, 0, 397, 0,
+  0, 0, 396, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 836, 0, 0,
+  0, 136, 783, 789, 507, 743, 829, 967, 0, 731, 553, 916, 332, 0, 0, 215,
+  414, 0, 0, 631, 0, 0, 0, 0, 460, 0, 0, 587, 0, 225, 834, 0,
+  0, 0, 0, 0, 0, 0, 101, 214, 97, 799, 0, 699, 0, 658, 0, 345,
+  998, 510, 0, 431, 0, 0, 0, 0, 0, 0, 930, 428, 852, 0, 0, 36,
+  38, 166, 0, 0, 0, 412, 720, 405, 999, 0, 0, 0, 333, 100, 557, 408,
+  751, 172, 710, 953, 0, 330, 804, 891, 496, 667, 873, 900, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 118, 0, 0, 0, 975, 0, 0, 0, 0, 335, 864,
+  0, 296, 72, 43, 488, 838, 642, 700, 0, 0, 0, 409, 844, 55, 0, 842,
+  0, 894, 472, 694, 278, 0, 0, 0, 0, 0, 0, 0, 0, 0, 305, 425,
+  51, 112, 0, 390, 0, 0, 0, 0, 0, 374, 883, 246, 0, 0, 773, 236,
+  155, 973, 0, 0, 0, 741, 0, 404, 600, 0, 0, 427, 470, 344, 843, 0,
+  0, 839, 0, 519, 0, 0, 0, 0, 0, 0, 0, 475, 0, 0, 0, 0,
+  0, 6, 0, 0, 0, 0, 497, 0, 0, 0, 0, 565, 0, 974, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 866, 0, 0, 0, 0, 294, 363,
+  0, 0, 532, 544, 897, 0, 0, 675, 0, 0, 0, 30, 719, 0, 908, 0,
+  477, 605, 756, 0, 692, 982, 0, 0, 32, 598, 867, 0, 0, 0, 421, 517,
+  0, 435, 595, 58, 909, 0, 0, 747, 0, 116, 590, 869, 451, 0, 790, 591,
+  228, 531, 199, 0, 0, 0, 0, 937, 0, 0, 361, 0, 0, 0, 594, 911,
+  985, 716, 0, 0, 0, 229, 0, 0, 0, 389, 0, 485, 837, 877, 376, 0,
+  0, 42, 122, 424, 972, 0, 538, 0, 0, 0, 622, 192, 182, 386, 483, 757,
+  718, 0, 139, 0, 641, 398, 669, 638, 0, 0, 0, 0, 117, 87, 893, 77,
+  0, 0, 25, 845, 608, 954, 986, 0, 0, 115, 542, 0, 0, 0, 0, 0,
+  912, 977, 0, 0, 815, 545, 539, 0, 0, 0, 232, 933, 62, 59, 212, 263,
+  308, 655, 463, 717, 69, 0, 0, 0, 157, 830, 0, 156, 452, 508, 713, 484,
+  805, 0, 104, 0, 613, 778, 66, 749, 604, 283, 465, 482, 671, 0, 0, 0,
+  450, 249, 114, 432, 194, 466, 143, 574, 748, 0, 0, 0, 0, 0, 0, 0,
+  159, 256, 516, 892, 995, 0, 611, 511, 0, 134, 279, 618, 0, 0, 0, 729,
+  0, 528, 818, 0, 0, 0, 607, 0, 0, 712, 733, 0, 96, 210, 247, 0,
+  0, 234, 201, 992, 0, 0, 1, 806, 53, 70, 211, 262, 297, 219, 319, 495,
+  509, 541, 585, 656, 777, 653, 254, 807, 929, 875, 947, 0, 949, 0, 0, 903,
+  175, 311, 320, 0, 904, 0, 923, 107, 0, 64, 0, 0, 522, 392, 0, 0,
+  0, 0, 439, 481, 0, 781, 0, 0, 833, 0, 814, 0, 660, 610, 0, 0,
+  0, 0, 856, 130, 189, 619, 358, 535, 0, 0, 0, 596, 568, 0, 0, 559,
+  13, 0, 0, 0, 0, 0, 775, 645, 0, 270, 191, 0, 0, 0, 0, 736,
+  0, 0, 0, 0, 434, 0, 0, 209, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 824, 93, 0, 0, 0, 353, 0, 702, 0, 0, 0,
+  654, 978, 0, 0, 0, 0, 943, 0, 0, 0, 0, 0, 0, 0, 0, 580,
+  0, 0, 161, 0, 0, 0, 0, 0, 945, 0, 666, 0, 0, 0, 0, 956,
+  550, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 35, 322, 0,
+  0, 0, 0, 0, 0, 0, 253, 415, 0, 0, 0, 0, 0, 734, 0, 0,
+  958, 83, 0, 310, 0, 0, 257, 760, 0, 132, 89, 0, 275, 646, 0, 121,
+  0, 0, 0, 0, 0, 0, 0, 0, 602, 960, 664, 0, 782, 0, 0, 0,
+  2, 0, 769, 0, 0, 162, 966, 0, 0, 0, 204, 458, 742, 965, 326, 0,
+  369, 0, 705, 997, 0, 0, 0, 0, 0, 0, 5, 98, 291, 410, 179, 453,
+  383, 901, 0, 0, 86, 540, 0, 0, 0, 185, 0, 382, 60, 0, 0, 884,
+  0, 0, 525, 0, 647, 0, 174, 768, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 846, 976, 0, 644, 0, 0, 989, 620, 0, 0, 876, 0, 0, 0, 0,
+  502, 957, 0, 0, 980, 0, 378, 464, 401, 0, 520, 0, 0, 0, 403, 635,
+  0, 744, 0, 0, 127, 725, 910, 243, 961, 0, 0, 632, 0, 0, 0, 0,
+  570, 938, 0, 944, 0, 0, 18, 962, 0, 0, 661, 849, 0, 0, 514, 153,
+  981, 0, 0, 0, 940, 917, 663, 0, 0, 0, 198, 360, 689, 913, 0, 0,
+  597, 176, 7, 181, 486, 795, 617, 147, 942, 996, 99, 0, 468, 0, 0, 637,
+  987, 0, 0, 779, 0, 63, 853, 0, 0, 0, 547, 0, 0, 217, 0, 370,
+  684, 0, 474, 0, 0, 934, 0, 419, 0, 0, 197, 280, 0, 0, 581, 0,
+  244, 105, 50, 138, 377, 52, 314, 391, 371, 151, 307, 449, 491, 492, 649, 690,
+  271, 691, 740, 648, 746, 816, 950, 979, 0, 0, 276, 158, 141, 562, 0, 0,
+  0, 183, 0, 640, 850, 578, 860, 0, 0, 0, 352, 711, 922, 0, 0, 0,
+  0, 416, 639, 0, 0, 0, 31, 0, 0, 334, 0, 188, 208, 304, 184, 505,
+  706, 763, 963, 0, 0, 788, 0, 0, 388, 0, 0, 445, 0, 48, 8, 323,
+  0, 193, 387, 252, 548, 0, 73, 85, 554, 687, 792, 0, 0, 0, 0, 173,
+  575, 745, 0, 0, 0, 0, 0, 0, 239, 0, 0, 0, 0, 47, 339, 889,
+  0, 0, 303, 0, 54, 265, 586, 0, 186, 673, 800, 402, 0, 0, 0, 721,
+  231, 0, 0, 0, 0, 223, 0, 0, 0, 91, 727, 0, 0, 347, 855, 346,
+  289, 331, 0, 0, 0, 443, 0, 0, 0, 939, 0, 0, 0, 407, 446, 678,
+  994, 831, 0, 0, 0, 0, 504, 0, 17, 0, 0, 861, 0, 0, 0, 268,
+  168, 0, 679, 0, 0, 0, 0, 325, 0, 0, 57, 65, 615, 0, 0, 0,
+  920, 266, 753, 298, 459, 33, 282, 601, 0, 0, 0, 0, 739, 714, 0, 68,
+  494, 0, 0, 0, 825, 0, 0, 0, 0, 0, 0, 948, 724, 0, 0, 898,
+  218, 0, 206, 0, 787, 0, 899, 964, 0, 364, 0, 0, 0, 513, 521, 0,
+  351, 896, 284, 61, 0, 0, 0, 260, 131, 625, 686, 0, 808, 0, 0, 0,
+  0, 302, 579, 356, 111, 205, 120, 473, 362, 571, 560, 697, 500, 821, 0, 478,
+  0, 0, 0, 527, 0, 0, 241, 0, 0, 0, 0, 0, 28, 907, 384, 766,
+  774, 160, 88, 287, 803, 71, 0, 0, 0, 0, 0, 0, 190, 187, 359, 479,
+  202, 238, 267, 318, 533, 623, 758, 0, 230, 0, 0, 0, 561, 672, 865, 0,
+  0, 0, 75, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 259,
+  37, 381, 444, 750, 281, 312, 255, 108, 526, 16, 870, 0, 0, 0, 0, 233,
+  737, 826, 0, 0, 0, 523, 529, 0, 0, 170, 762, 0, 0, 0, 81, 0,
+  0, 685, 0, 82, 368, 0, 0, 0, 285, 786, 968, 0, 0, 0, 0, 0,
+  0, 196, 0, 0, 80, 0, 0, 0, 0, 0, 0, 126, 738, 770, 0, 791,
+  0, 0, 0, 113, 150, 350, 918, 0, 272, 0, 0, 810, 0, 624, 41, 0,
+  84, 0, 0, 0, 0, 290, 327, 707, 9, 755, 12, 365, 237, 441, 696, 822,
+  728, 0, 0, 0, 0, 0, 0, 820, 329, 0, 406, 0, 732, 0, 0, 0,
+  665, 0, 0, 0, 0, 467, 0, 0, 0, 695, 0, 413, 0, 169, 537, 566,
+  651, 874, 0, 152, 0, 0, 0, 0, 0, 0, 589, 609, 767, 3, 10, 313,
+  809, 0, 354, 558, 0, 0, 23, 0, 0, 0, 715, 0, 0, 0, 0, 0,
+  0, 0, 0, 49, 324, 765, 0, 0, 0, 0, 726, 952, 0, 213, 693, 0,
+  0, 0, 44, 469, 135, 0, 0, 0, 0, 0, 0, 564, 698, 0, 0, 0,
+  851, 0, 626, 0, 0, 461, 871, 888, 4, 879, 592, 0, 125, 0, 0, 650,
+  0, 0, 0, 0, 764, 0, 0, 0, 0, 222, 328, 0, 0, 612, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 45, 493, 582, 984, 357, 0, 367, 0, 0,
+};
+
+const char *WA_FREQ_110_TOKENS[] = {
+  "ziri",
+  "jrid",
+  "dan",
+  "tkellem",
+  "fuq",
+  "din",
+  "naqbel",
+  "miegħek",
+  "joqgħod",
+  "jevita",
+  "it",
+  "tabib",
+  "eżaminani",
+  "aħna",
+  "lkoll",
+  "morna",
+  "norqdu",
+  "wara",
+  "titkellem",
+  "bl",
+  "ingliż",
+  "jien",
+  "differenti",
+  "minn",
+  "ġuvintur",
+  "oħra",
+  "għaliex",
+  "xtrajt",
+  "fjora",
+  "jipprova",
+  "jgħin",
+  "in",
+  "nies",
+};
+const uint16_t WA_FREQ_110_RANKS[] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 4, 0, 0, 0, 13,
+  0, 0, 0, 2, 0, 0, 17, 0, 0, 0, 3, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 33, 0, 0, 0, 32, 0, 0, 0, 12, 23,
+  0, 0, 0, 15, 0, 0, 7, 0, 20, 24, 0, 0, 0, 0, 0, 14,
+  19, 29, 30, 0, 0, 27, 0, 0, 8, 0, 26, 6, 16, 31, 0, 0,
+  0, 0, 18, 0, 0, 0, 5, 22, 0, 0, 0, 0, 0, 0, 0, 0,
+  9, 11, 0, 0, 25, 0, 0, 10, 0, 0, 0, 0, 21, 28, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+const char *WA_FREQ_111_TOKENS[] = {
+  "os",
+  "tom",
+  "okat",
+  "mary",
+  "nvkvftetv",
+  "orēn",
+  "eyacet",
+  "kihces",
+  "boston",
+  "tvlofvn",
+  "ariyof",
+  "vmohpvlvtket",
+  "cē",
+  "vccakvn",
+  "cvyacēs",
+  "ąhvkleksa",
+  "vlicēcet",
+  "hece",
+  "eskiyvtēsekos",
+  "tayekot",
+  "nak",
+  "estomen",
+  "eyopaklatkat",
+  "cekihcv",
+  "kafe",
+  "pumvnahat",
+  "kohmis",
+  "hvtvm",
+  "yekcet",
+};
+const uint16_t WA_FREQ_111_RANKS[] = {
+  0, 0, 9, 23, 17, 1, 0, 6, 0, 0, 5, 0, 0, 25, 29, 0,
+  0, 11, 15, 21, 0, 0, 0, 0, 0, 0, 18, 0, 20, 7, 27, 8,
+  4, 10, 28, 0, 0, 26, 16, 0, 14, 3, 13, 24, 0, 0, 12, 2,
+  19, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+const char *WA_FREQ_112_TOKENS[] = {
+  "က",
+  "ဖြစ်ပါတယ်။",
+  "ကို",
+  "ဖြစ်သည်။",
+  "ပြောပါတယ်။",
+  "၂",
+  "၁",
+  "နဲ့",
+  "၃",
+  "အတွက်",
+  "၅",
+  "လို့",
+  "၄",
+  "အခုလို",
+  "အသက်",
+  "အမေရိကန်",
+  "သူက",
+  "ခုနှစ်",
+  "မြန်မာ",
+  "ရက်",
+  "ဆိုပါတယ်။",
+  "အဲဒီ",
+  "ရက်နေ့တွင်",
+  "၆",
+  "၁၀",
+  "၇",
+  "နှစ်",
+  "ရဲ့",
+  "အခု",
+  "ဆိုတဲ့",
+  "၂၀",
+  "ရှိသည်။",
+  "အစိုးရ",
+  "၁၂",
+  "၈",
+  "၁၅",
+  "နိုင်ငံရေး",
+  "သူ",
+  "နိုင်ငံ",
+  "မှာ",
+  "ရက်နေ့",
+  "အပါအဝင်",
+  "၉",
+  "၁၁",
+  "အထိ",
+  "အဖြစ်",
+  "ဟာ",
+  "၃၀",
+  "ပထမဆုံး",
+  "တို့",
+  "မတ်လ",
+  "ဒီလို",
+  "နှင့်",
+  "နဲ႔",
+  "ကုလသမဂ္ဂ",
+  "ရွေးကောက်ပွဲ",
+  "လူ",
+  "၁၄",
+  "ဒီ",
+  "၁၉",
+  "အဓိက",
+  "ေျပာပါတယ္။",
+  "သမ္မတ",
+  "ဦး",
+  "ေမး",
+  "ခုနှစ်၊",
+  "PDF",
+  "၂၄",
+  "၁၃",
+  "၂၅",
+  "ပြီးခဲ့တဲ့",
+  "မေလ",
+  "၁၈",
+  "စီးပွားရေး",
+  "ဒါဟာ",
+  "လက်ရှိ",
+  "သည်",
+  "ရက်နေ့က",
+  "သူဟာ",
+  "လည်းကောင်း၊",
+  "သို့မဟုတ်",
+  "တရုတ်",
+  "၂၆",
+  "ဆိုင်ရာ",
+  "ဖြစ်ပြီး",
+  "ျဖစ္ပါတယ္။",
+  "၁၆",
+  "အတူ",
+  "အမျိုးသား",
+  "စတဲ့",
+  "ဇန်နဝါရီလ",
+  "၂၁",
+  "ဒီဇင်ဘာလ",
+  "ရက်နေ့မှာ",
+  "၁၇",
+  "ဝန်ကြီး",
+  "NUG",
+  "အစိုးရက",
+  "နိုဝင်ဘာလ",
+  "နာရီ",
+  "စုစုပေါင်း",
+  "ပြန်လည်",
+  "ရှိပါတယ်။",
+  "လည်း",
+  "၂၇",
+  "နှစ်အရွယ်",
+  "မေး",
+  "နိုင်ငံတကာ",
+  "လည်းကောင်း",
+  "သူတို့",
+  "ဒါပေမဲ့",
+  "အနေနဲ့",
+  "NLD",
+  "ဒီမိုကရေစီ",
+  "နိုင်ငံခြားရေး",
+  "၂၈",
+  "ခု",
+  "၂၃",
+  "ဥက္ကဋ္ဌ",
+  "အဲဒီလို",
+  "၂၂",
+  "Biden",
+  "နောက်ဆုံး",
+  "ဖြစ်တယ်လို့",
+  "ဇွန်လ",
+  "နောက်ထပ်",
+  "ရက်မှာ",
+  "မြန်မာနိုင်ငံ",
+  "၂၉",
+  "ဒေါ်အောင်ဆန်းစုကြည်",
+  "သိရပါတယ်။",
+  "၂၀၂၀",
+  "တွင်",
+  "ဖြစ်တဲ့",
+  "ရန်ကုန်",
+  "သေဆုံးသူ",
+  "အဖွဲ့",
+  "ဒေါ်လာ",
+  "ဆိုပြီး",
+  "ဒုတိယ",
+  "မစ္စတာ",
+  "သန်း",
+  "အောက်တိုဘာလ",
+  "ကီလိုမီတာ",
+  "၅၀",
+  "အခြေခံ",
+  "၂၀၂၁",
+  "ရဲ႕",
+  "ဇန်နဝါရီ",
+  "ရက်က",
+  "အကြောင်း",
+  "အနည်းဆုံး",
+  "ခေါင်းဆောင်",
+  "ဆိုတာ",
+  "ဒေါက်တာ",
+  "ဖေဖော်ဝါရီလ",
+  "မြန်မာနိုင်ငံမှာ",
+  "၁၀၀",
+  "ဆက်လက်",
+  "ပါတီ",
+  "လွှတ်တော်",
+  "အာဆီယံ",
+  "ကျော်",
+  "မန္တလေး",
+  "သမၼတ",
+  "အိန္ဒိယ",
+  "ဧပြီလ",
+  "ယောက်",
+  "လုံခြုံရေး",
+  "အမျိုးသမီး",
+  "ကနေ",
+  "Joe",
+  "ဒီကနေ့",
+  "မှ",
+  "သူ့ရဲ့",
+  "Joe Biden",
+  "နိုဝင်ဘာ",
+  "မြန်မာ့",
+  "အဖွဲ့ဝင်",
+  "Trump",
+  "ဆိုတာကို",
+  "ဒီဇင်ဘာ",
+  "မြန်မာပြည်",
+  "အတွင်း",
+  "စက်တင်ဘာ",
+  "စစ်ရေး",
+  "ဖွဲ့စည်းပုံ",
+  "ကိုဗစ်",
+  "စစ်တပ်က",
+  "ဒေါ်အောင်ဆန်းစုကြည်ကို",
+  "ပတ်သက်ပြီး",
+  "ပုဒ်မ",
+  "ဘယ်လို",
+  "ဘီဘီစီကို",
+  "များကို",
+  "သော",
+  "ဥပဒေ",
+  "တက္ကသိုလ်",
+  "ပြည်ထောင်စု",
+  "လ",
+  "၃၁",
+  "ပြည်တွင်း",
+  "ဖေဖော်ဝါရီ",
+  "အမိ",
+  "အမှု",
+  "ကာကွယ်ရေး",
+  "ကျေးရွာ",
+  "စတင်",
+  "စပြီး",
+  "တခြား",
+  "ဒါကို",
+  "ဒါ့အပြင်",
+  "ရက္",
+  "သူ့ကို",
+  "ခေါ်",
+  "စစ်ကောင်စီက",
+  "ဒီတပတ္",
+  "သေဆုံးခဲ့ပါတယ်။",
+  "အခြေစိုက်",
+  "၂၀၁၀",
+  "ခဲ့သည်။",
+  "ထားပါတယ်။",
+  "မွာ",
+  "အမှတ်",
+  "အရ",
+  "ခုလို",
+  "ဇူလိုင်လ",
+  "ပေ",
+  "လူ့အခွင့်အရေး",
+  "အဖ",
+  "အရွယ်",
+  "အားလုံး",
+  "ခဲ့ပါတယ်။",
+  "တပ်မတော်",
+  "တွေ့ရပါတယ်။",
+  "ပတ်သက်လို့",
+  "ရှိတယ်လို့",
+  "၁၉၄၈",
+  "ကတည်းက",
+  "စစ်ကောင်စီ",
+  "ဆိုရင်",
+  "ပညာ",
+  "မြတ်သော",
+  "လူဦးရေ",
+  "ဝန်ကြီးချုပ်",
+  "၂၀၀၈",
+  "ခုနှစ်တွင်",
+  "တရားဝင်",
+  "တာဝန်",
+  "တို့ကို",
+  "ပြည်သူ့",
+  "မီတာ",
+  "ရှိနေပါတယ်။",
+  "အေမရိကန္",
+  "၂၀၀",
+  "ကတော့",
+  "ထုတ်ပြန်ပါတယ်။",
+  "ဒါက",
+  "သြဂုတ်လ",
+  "ဒေသခံ",
+  "နောက်",
+  "ပါတယ်။",
+  "မဲ",
+  "သတင်းစာ",
+  "အာဏာသိမ်း",
+  "ဧပြီ",
+  "ေျဖ",
+  "KNU",
+  "ခုနှစ်မှာ",
+  "တင္ျပထားပါတယ္။",
+  "တွေ",
+  "ပါဝင်",
+  "ဗြိတိသျှ",
+  "အတြက္",
+  "အထူး",
+  "အထွေထွေ",
+  "၁၉၈၈",
+  "George",
+  "Grow",
+  "ထောင်ဒဏ်",
+  "နိုင်ငံတော်",
+  "ဖြစ်ကုန်၏။",
+  "ဘီဘီစီ",
+  "ရိုဟင်ဂျာ",
+  "လို့လည်း",
+  "သား",
+  "အပေါ်",
+  "အရေးပေါ်",
+  "VOA",
+  "ကိုရိုနာဗိုင်းရပ်စ်",
+  "က်ေနာ္",
+  "ကွယ်လွန်",
+  "ငြိမ်းချမ်းရေး",
+  "နောက်ပိုင်း",
+  "မြန်မာနိုင်ငံကို",
+  "မြန်မာပြည်မှာ",
+  "လက်နက်",
+  "သူတို့ရဲ့",
+  "အဲဒီေတာ့",
+  "Mr",
+  "စက်တင်ဘာလ",
+  "တွေကို",
+  "ဒီနေ့",
+  "ပါဝင်သည်။",
+  "ဘီလျံ",
+  "ရှိခဲ့ပါတယ်။",
+  "ရှေ့နေ",
+  "လုပ်ငန်း",
+  "သည်။",
+  "အမေရိကန်ဒေါ်လာ",
+  "အလုပ်သမား",
+  "အေမရိကန္သုံး",
+  "ေဒၚလွလွသန္းက",
+  "ရက်တွင်",
+  "ရက်၊",
+  "လို႔",
+  "ဟူသော",
+  "IIMM",
+  "ကိုယ်စားလှယ်",
+  "ည",
+  "တိုင်းရင်းသား",
+  "ဒါေပမဲ့",
+  "မြန်မာကို",
+  "သူတို႔",
+  "အခြား",
+  "အသင်း",
+  "ကျန်းမာရေး",
+  "ဒါပေမယ့်",
+  "နောက်ပြီး",
+  "ဘယ္လို",
+  "ရုရှား",
+  "ရွိပါတယ္။",
+  "လူတွေ",
+  "ဝင်ရောက်",
+  "အကြီးဆုံး",
+  "အနှစ်",
+  "အပြည်ပြည်ဆိုင်ရာ",
+  "အဖွဲ့က",
+  "၁ဝ",
+  "KIA",
+  "ကျပ်",
+  "စာရေးဆရာ",
+  "ဆက်ဆံရေး",
+  "ဆရာ",
+  "ညနေ",
+  "တို့က",
+  "ဒါကြောင့်",
+  "ပဲ",
+  "ဘီလီယံ",
+  "မြန်မာ နိုင်ငံ",
+  "မြန်မာနိုင်ငံက",
+  "ယဉ်ကျေးမှု",
+  "ရတဲ့",
+  "ရန်ကုန်မြို့",
+  "အများဆုံး",
+  "အဲဒါက",
+  "CDF",
+  "က်ေနာ္တို႔",
+  "ခု၊",
+  "စစ်ကောင်စီဘက်က",
+  "တခု",
+  "တို့သည်",
+  "နီးပါး",
+  "ပြောခဲ့ပါတယ်။",
+  "မိနစ်",
+  "မိသားစု",
+  "မြောက်ကိုရီးယား",
+  "ရာခိုင်နှုန်း",
+  "ရှိပြီး",
+  "လုံးဝ",
+  "အဖွဲ့ချုပ်",
+  "အားလုံးကို",
+  "အောက်တိုဘာ",
+  "ကမ္ဘာ့",
+  "ကုမ္ပဏီ",
+  "ကေတာ့",
+  "ခုထိ",
+  "တဲ့",
+  "ဒီေန႔",
+  "ပထမ",
+  "ပြည်နယ်",
+  "ဘက်က",
+  "မြို့တော်",
+  "မြို့နယ်",
+  "အစီအစဥ္မွာ",
+  "ဥပမာ",
+  "၃၅",
+  "႔",
+  "တဦး",
+  "တို႔",
+  "ဒေါ်အောင်ဆန်းစုကြည်က",
+  "နိုင်ငံမှာ",
+  "ပါဝင်ပါတယ်။",
+  "ပြောဆို",
+  "ဖြင့်",
+  "မွေးချင်း",
+  "ရက်နေ့အထိ",
+  "သမီး",
+  "သိန်း",
+  "အခြေအနေ",
+  "အတည်ပြု",
+  "ဦးကို",
+  "၁၉၆၂",
+  "၂၀၁၈",
+  "Myanmar",
+  "ဆိုရှယ်လစ်",
+  "ဌာန",
+  "တပ်မတော်က",
+  "တရားမဝင်",
+  "ဒါပေမယ့်",
+  "ဒုက္ခသည်",
+  "နိုင်ငံတွေ",
+  "ပါကစ္စတန်",
+  "ဖြစ်ကြောင်း",
+  "မနက်",
+  "မြန်မာ့အရေး",
+  "လက်နက်ကိုင်",
+  "အများအပြား",
+  "ဦး၊",
+  "၁၉၄၇",
+  "၂၀၀၉",
+  "CRPH",
+  "ကာကွယ်ဆေး",
+  "ဆိုပါတယ္။",
+  "ဇူလိုင်",
+  "တစ်ဦး",
+  "နှစ်နဲ့",
+  "ဖော်ပြထားပါတယ်။",
+  "ဖြစ်လာပါတယ်။",
+  "မေ",
+  "ရက္ေန႔",
+  "ရှိတဲ့",
+  "လောက်",
+  "လွန်ခဲ့တဲ့",
+  "သူ့",
+  "အ",
+  "အစည်းအဝေး",
+  "အသက္",
+  "အေျခခံတဲ့",
+  "အေျခအေန",
+  "၂၀၁၂",
+  "၄၀",
+  "ကလည်း",
+  "ကိုလည်း",
+  "ကူညီ",
+  "စာပေ",
+  "ဆိုေတာ့",
+  "ဆောင်ရွက်",
+  "တို့တွင်",
+  "ထိုင်းနိုင်ငံ",
+  "ဒီကေန႔",
+  "ပတ္သက္ၿပီး",
+  "ပူးပေါင်း",
+  "ဗိုလ်ချုပ်ကြီး",
+  "မွေးဖွားခဲ့သည်။",
+  "လာမယ့်",
+  "လူထု",
+  "လူမှုရေး",
+  "သက်ဆိုင်ရာ",
+  "သုတေသန",
+  "ဟူ၍",
+  "အကူအညီ",
+  "အခုတော့",
+  "အချက်",
+  "အနက်",
+  "အပြင်",
+  "၅၀၀",
+  "ICJ",
+  "ကိုရိုနာ",
+  "ကျောင်းသား",
+  "ကွန်မြူနစ်",
+  "ခေါ်တဲ့",
+  "ဆရာမ",
+  "တပ်မဟာ",
+  "ထိ",
+  "နိုင်ငံက",
+  "ပါဝင်သော",
+  "ပိုမို",
+  "ပြည့်နှစ်",
+  "ပြီးတော့",
+  "ပြောထားပါတယ်။",
+  "ဖမ်းဆီး",
+  "မျိုး",
+  "မွေးဖွားသည်။",
+  "မှာတော့",
+  "လွတ်လပ်ရေး",
+  "သူတို့က",
+  "သူ႔ကို",
+  "အမည်ရင်းမှာ",
+  "အလုပ်",
+  "အီဒီယံအသုံးေတြကို",
+  "ျပန္လည္",
+  "ျမန္မာႏိုင္ငံမွာ",
+  "၁၅၀",
+  "၂၀၁၆",
+  "၂၀၁၉",
+  "၅၀၅",
+  "ကျင်းပတဲ့",
+  "ခုနှစ်က",
+  "စက္တင္ဘာ",
+  "ဆက်ပြီး",
+  "ဆိုသည်မှာ",
+  "ဌာနက",
+  "တစ်ခု",
+  "တယောက်",
+  "တွေ့ဆုံ",
+  "ဒါ",
+  "ဒေသတွင်း",
+  "နိုင်ငံပေါင်း",
+  "နောက်ပိုင်းမှာ",
+  "ပညာရှင်",
+  "ပိတ်ဆို့",
+  "ပြောပြပါတယ်။",
+  "ဖြစ်ကြသည်။",
+  "ဗဟို",
+  "ဗိုင်းရပ်စ်",
+  "ဘင်္ဂလားဒေ့ရှ်",
+  "မိုင်",
+  "မြန်မာနိုင်ငံထဲ",
+  "မြန်မာနိုင်ငံရဲ့",
+  "မှု",
+  "ရုရှားက",
+  "ရွေးကောက်ပွဲမှာ",
+  "ရှိပါပြီ။",
+  "လူငယ်",
+  "လေကြောင်း",
+  "သတင်း",
+  "သတ်မှတ်",
+  "သန္း",
+  "အကြီးအကဲ",
+  "အင်္ဂလိပ်",
+  "အလုပ်အကျွေး",
+  "အာကာသ",
+  "အဲဒါကို",
+  "ဦးနဲ့",
+  "၂၀၁၁",
+  "၂၀၂၂",
+  "Donald",
+  "ကိုဗစ်-၁၉",
+  "ကူးစက်မှု",
+  "ကေန",
+  "ကျော်ကို",
+  "ခန့်",
+  "စစ္တပ္က",
+  "စစ်ကောင်စီရဲ့",
+  "စစ်အစိုးရက",
+  "ဇန္နဝါရီ",
+  "ဇန္နဝါရီလ",
+  "ဇွန်",
+  "တရုတ်ရဲ့",
+  "တိုက်ပွဲတွေ",
+  "တုန်းက",
+  "တွေက",
+  "ထပ်မံ",
+  "ထုတ်ပြန်",
+  "ဒေါ်အောင်ဆန်းစုကြည်ဟာ",
+  "ပိုပြီး",
+  "ပုံ",
+  "ပြည်ပ",
+  "ပြောကြပါတယ်။",
+  "ဖြစ်ခဲ့ပါတယ်။",
+  "ဖြစ်ပြီး၊",
+  "ဖြေ",
+  "ဗိုလ်ချုပ်မှူးကြီး",
+  "မ",
+  "မစ္စ",
+  "ရောဂါ",
+  "ရေးပါတယ်။",
+  "လို",
+  "သိပ္ပံ",
+  "ဟု",
+  "ဟုတ္ကဲ့",
+  "အခါ",
+  "အစီအစဉ်ကို",
+  "အယောက်",
+  "အရေး",
+  "အဲဒီမှာ",
+  "ဥရောပ",
+  "ျမန္မာ",
+  "၂၀၁၇",
+  "၇၆",
+  "ႏွစ္",
+  "AA",
+  "ကုလ",
+  "ကျွန်မ",
+  "ကြိမ်မြောက်",
+  "ကြေညာခဲ့ပါတယ်။",
+  "ကြေညာပါတယ်။",
+  "ကွယ်လွန်သည်။",
+  "ခ",
+  "ခေါင်းဆောင်တွေ",
+  "စစ်ကိုင်းတိုင်း",
+  "ဆု",
+  "ဆွေးနွေးပွဲ",
+  "ညီလာခံ",
+  "တစ်ယောက်",
+  "တွေရဲ့",
+  "ထုတ်ပြန်ခဲ့ပါတယ်။",
+  "ထဲ",
+  "ဒေါ်အောင်ဆန်းစုကြည်ရဲ့",
+  "နေပါတယ်။",
+  "နေရာ",
+  "နေရာမှာ",
+  "ပူးတွဲ",
+  "ဖြစ်တယ်လို့လည်း",
+  "ဖြစ်သလို",
+  "ဘီဘီစီက",
+  "ဘုရား၏",
+  "မဟုတ်ပါဘူး။",
+  "များတွင်",
+  "များသည်",
+  "ရက်အထိ",
+  "လည္း",
+  "လုပ်ဖို့",
+  "သူတို့ကို",
+  "အဂၤလိပ္စာ",
+  "အစီရင်ခံစာ",
+  "အတွင်းမှာ",
+  "အဖွဲ့အစည်း",
+  "အာဏာ",
+  "အဲ့ဒီ",
+  "အွန်လိုင်း",
+  "၁၀၀၀",
+  "၂၀၁၄",
+  "၂၀၁၅",
+  "၄၅",
+  "၈၈",
+  "ၿပီးခဲ့တဲ့",
+  "ကလည္း",
+  "ခရိုင်",
+  "ခုႏွစ္",
+  "စစ္ေကာင္စီဘက္က",
+  "စီစဉ်",
+  "တခါ",
+  "တပ်ရင်း",
+  "တရားရုံးက",
+  "တိုက်ခိုက်မှု",
+  "ထဲမှာ",
+  "ဒါကြောင့်",
+  "ဒီဇင္ဘာ",
+  "နယ်မြေ",
+  "နိုင်ငံကို",
+  "နေပြည်တော်မှာ",
+  "နံနက်",
+  "ပုဂ္ဂိုလ်",
+  "ဗြိတိန်",
+  "များ",
+  "ယောက်၊",
+  "ရက္ေန႔မွာ",
+  "ရန်ကုန်မှာ",
+  "ရဲ",
+  "လူပေါင်း",
+  "သဘာဝ",
+  "သမဂ္ဂ",
+  "သာ",
+  "အကြိမ်",
+  "အကြီးအကျယ်",
+  "အကြောင်းကို",
+  "အင်္ဂါနေ့က",
+  "အမျိုးမျိုး",
+  "အရင်က",
+  "အာဏာပိုင်တွေက",
+  "ဥက္ကဌ",
+  "ဥပဒေကို",
+  "၁၉၆၃",
+  "၇၅",
+  "၈၀",
+  "AAPP",
+  "Omicron",
+  "Retrieved",
+  "on",
+  "ကချင်ပြည်နယ်",
+  "ကမ္ဘာ",
+  "ကလေးသူငယ်",
+  "ကိုယ်တိုင်",
+  "ကိုယ်ပိုင်",
+  "ကောင်စီ",
+  "ကျော်က",
+  "ကျွန်တော်",
+  "ကျွန်တော်တို့",
+  "ခုက",
+  "ဂျပန်",
+  "စစ်တပ်ရဲ့",
+  "စစ်သား",
+  "စသည့်",
+  "စာရင်းအရ",
+  "တချို့",
+  "တရုတ်က",
+  "ထို့ပြင်",
+  "ဒသမ",
+  "ဒုတိယအကြိမ်",
+  "နာမည်ကျော်",
+  "နိုင်ငံပိုင်",
+  "နံပါတ်",
+  "နှစ်ပေါင်း",
+  "နှစ်မှာ",
+  "ပညာရေး",
+  "ပါ",
+  "ပိတ်ပင်",
+  "ဖော်ပြပါတယ်။",
+  "ဘဏ္ဍာရေး",
+  "မနေ့",
+  "မနေ့က",
+  "မိမိ",
+  "မေန႔က",
+  "ရက်ကနေ",
+  "ရက်စွဲနဲ့",
+  "ရန်ကုန်မြို့၌",
+  "ရွေးချယ်",
+  "လက်ခံ",
+  "လက်မ",
+  "လာမယ့်",
+  "လုပ်ငန်းတွေ",
+  "သင်ကြား",
+  "သုံးသပ်ပါတယ်။",
+  "သံတမန်",
+  "သံအမတ်",
+  "အခုဆို",
+  "အချိန်",
+  "အဂၤလိပ္စာမွာေတာ့",
+  "အင်တာနက်",
+  "အစီအစဉ်",
+  "အဆိုပါ",
+  "အရင်",
+  "အား",
+  "အီဒီယံ",
+  "အေၾကာင္း",
+  "အဲဒီတော့",
+  "အဲဒီမွာ",
+  "အဲဒီအချိန်က",
+  "ဩဂုတ်လ",
+  "ေက်ာ္",
+  "ေယာက္",
+  "ေရြးေကာက္ပြဲ",
+  "၁။",
+  "၂ဝ",
+  "၃၀၀",
+  "၃၇",
+  "၅၅",
+  "CDM",
+  "COVID-19",
+  "McConnell",
+  "of",
+  "ကမ္ဘာပေါ်တွင်",
+  "ကော်မတီ",
+  "ကျောင်း",
+  "ကြေညာချက်",
+  "ကွယ်လွန်ခဲ့သည်။",
+  "စင်္ကာပူ",
+  "စစ်တပ်",
+  "ဆိုတော့",
+  "ဇနီး",
+  "တကယ္ေတာ့",
+  "တတိယ",
+  "တိုက်တွန်း",
+  "တောင်းဆို",
+  "တွေမှာ",
+  "ထုတ်ပြန်ချက်အရ",
+  "ထုတ်ပြန်ထားပါတယ်။",
+  "ဒါမှမဟုတ်",
+  "ဒါ့ကြောင့်",
+  "ဒီတော့",
+  "ဒေသခံတွေက",
+  "နှစ်ကြာ",
+  "ပစ်ခတ်",
+  "ပါပါတယ်။",
+  "ပါမောက္ခ",
+  "ပြောကြား",
+  "ပြောခွင့်ရ",
+  "ပြောဆိုခဲ့ပါတယ်။",
+  "ဖြစ်နေတဲ့",
+  "ဖြစ်လာခဲ့ပါတယ်။",
+  "ဖြစ်၏။",
+  "ရက်ပေါင်း",
+  "ရုပ်ရှင်",
+  "ရုရှားနဲ့",
+  "ရှိနေတဲ့",
+  "လက်ရှိမှာ",
+  "လိုက်ပါတယ်။",
+  "လူမျိုးစု",
+  "လွတ်မြောက်ရေး",
+  "ဝန်းကျင်",
+  "သူတို႔က",
+  "သူနဲ့",
+  "အချက်အလက်",
+  "အချက်အလက်တွေကို",
+  "အချိန်မှာ",
+  "အဂ္ဂဥပဋ္ဌက",
+  "အင်ဒိုနီးရှား",
+  "အစ္စရေး",
+  "အတွင်းရေးမှူးချုပ်",
+  "အပါအဝင္",
+  "အမေရိကန် ပြည်ထောင်စု",
+  "အများကြီး",
+  "အရေအတွက်",
+  "အသိအမှတ်",
+  "အာရှ",
+  "အိန္ဒိယက",
+  "အေနနဲ႔",
+  "ဦးဆောင်",
+  "ေနာက္",
+  "၀",
+  "၁၉၆၁",
+  "၁၉၆၄",
+  "၁၉၈၄",
+  "၁၉၉ဝ",
+  "၁၉၉၂",
+  "၂၀၀၇",
+  "၂၇၀",
+  "၄၆",
+  "၅၂",
+  "၉၀",
+  "Array",
+  "Mitch",
+  "Pennsylvania",
+  "Sasakawa",
+  "the",
+  "ကလေး",
+  "ကျနော်",
+  "ကျော်မှာ",
+  "ကွယ်လွန်ချိန်တွင်",
+  "ချက်",
+  "စည်းကမ်း",
+  "စတုရန်းမိုင်",
+  "စာမျက်နှာ",
+  "စွပ်စွဲ",
+  "ဆက္ၿပီး",
+  "ဆက်ပြောပါတယ်။",
+  "ညီလာခံမှာ",
+  "တရားဝင္",
+  "တာဝန်ခံ",
+  "တို့ရဲ့",
+  "ထိပ်သီး",
+  "ထိုင်း",
+  "ထိုသို့",
+  "ဒါေပမယ့္",
+  "ဒီဇင္ဘာလ",
+  "ဒေသ",
+  "ဒေါ်အောင်ဆန်းစုကြည်နဲ့",
+  "နည်းပညာ",
+  "နားလည်ရပါတယ်။",
+  "နိုင်ငံတော်၏",
+  "နိုင်တဲ့",
+  "နေတာ",
+  "ပစ္စည်းတွေ",
+  "ပတ်",
+  "ပထမဆုံးအကြိမ်",
+  "ပါဝင်တဲ့",
+  "ပါး",
+  "ပါ။",
+  "ပေါင်း",
+  "ပေးဖို့",
+  "ဖြစ်စေ၊",
+  "ဖြစ်တယ်။",
+  "ဖွဲ့စည်း",
+  "ဖွဲ့စည်းပုံ အခြေခံ ဥပဒေ",
+  "ဘယ်သူမှ",
+  "ဘာသာရေး",
+  "ဘုရင်",
+  "ဘုရား",
+  "မကြာခင်",
+  "မဖြစ်မနေ",
+  "မရွိပါဘူး။",
+  "မိမိ၏",
+  "ရက္ေန႔က",
+  "ရက်နေ့မှာတော့",
+  "ရက်နဲ့",
+  "ရက်မြောက်",
+  "ရင်ဆိုင်နေရတဲ့",
+  "ရာခိုင်နှုန်း၊",
+  "ရေးသား",
+  "ရှိနေပြီး",
+  "ရှိသော",
+  "လက္ရွိ",
+  "လုပ်ခဲ့ပါတယ်။",
+  "လုပ်ဆောင်",
+  "လုံး",
+  "လူကို",
+  "လေ့လာရေး",
+  "လွတ်လပ်စွာ",
+  "ဝန်ဆောင်မှု",
+  "သခင်",
+  "သတင်းထောက်",
+  "သို့",
+  "အကြမ်းဖက်",
+  "အခမ်းအနား",
+  "အခုဆိုရင်",
+  "အခွင့်အရေး",
+  "အစည်းအဝေးမှာ",
+  "အစိုးရကို",
+  "အဆောက်အအုံ",
+  "အတိုင်ပင်ခံပုဂ္ဂိုလ်",
+  "အထက်",
+  "အပိုဒ်",
+  "အမေရိကန်က",
+  "အမျိုးသား ဒီမိုကရေစီ အဖွဲ့ချုပ်",
+  "အရေးကြီးတဲ့",
+  "အလားတူ",
+  "အလျား",
+  "အိုမီခရွန်",
+  "အဲဒီထဲက",
+  "အဲဒီနောက်",
+  "ေက်ာ္ကို",
+  "ေဒါက္တာ",
+  "ေနာက္ထပ္",
+  "ေလာက္",
+  "၀န်ကြီး",
+  "၂။",
+  "၃၆",
+  "၃၉",
+  "၄၀၀",
+  "၆ဝ",
+  "၆၀",
+  "Andrews",
+  "Arizona",
+  "Burma",
+  "Delta",
+  "SNLD",
+  "Twitter",
+  "UNODC",
+  "and",
+  "ကနီ",
+  "ကမ္ဘာမှာ",
+  "ကမ္ဘောဒီးယား",
+  "ကလေးငယ်",
+  "ကာကြယ္ေဆး",
+  "ကိုတော့",
+  "ကုမ္ပဏီက",
+  "ကုလသမဂ္ဂက",
+  "ကျင်းပဖို့",
+  "ကျန်တဲ့",
+  "ကွန်ဂရက်",
+  "ခါ",
+  "ခုမှာ",
+  "ခဲ့တဲ့",
+  "စစ်ကောင်စီတပ်တွေ",
+  "စစ်သွေးကြွ",
+  "စနစ်",
+  "စီရင်ချက်",
+  "စီးပြားေရး",
+  "ဆရာကြီး",
+  "ဆောက်လုပ်ရေး",
+  "ဆွေးနွေး",
+  "တကျော့ပြန်",
+  "တဆင့်",
+  "တည်ရှိသည်။",
+  "တပ်ဖွဲ့ဝင်",
+  "တပ်မတော်နဲ့",
+  "တောင်",
+  "ထို့ကြောင့်",
+  "ထို့အပြင်",
+  "ထုတ်ဖော်",
+  "ထောင်",
+  "ဒါယကာ",
+  "ဒါယိကာမ",
+  "ဒုတိယမြောက်",
+  "နာရီအတွင်း",
+  "နိုင်ငံတွေက",
+  "နေရာကို",
+  "နေ့စဉ်",
+  "နှစ်တွင်",
+  "ပညာရှင်တွေက",
+  "ပတ္သက္လို႔",
+  "ပတ်သက်တဲ့",
+  "ပထမဆံုး",
+  "ပါတီရဲ့",
+  "ပါဝင်ခဲ့ပါတယ်။",
+  "ပုံစံ",
+  "ပေးခဲ့ပါတယ်။",
+  "ဖဆပလ",
+  "ဖြစ်စေ",
+  "ဖွားမြင်သည်။",
+  "ဗိုင်းရပ်စ်ပိုး",
+  "ဗိုလ်ချုပ်အောင်ဆန်း",
+  "ဗိုလ်မှူးကြီး",
+  "ဘလင်ကင်က",
+  "ဘာသာ",
+  "ဘိကၡဳနီ",
+  "မတိုင်ခင်",
+  "မရှိဘူးလို့",
+  "မဟုတ်ဘူးလို့",
+  "မအင္ၾကင္းႏိုင္က",
+  "မိန်းမ",
+  "မြန်မာပြည်ကို",
+  "မြန်မာပြည်ရဲ့",
+  "ယူကရိန်းကို",
+  "ယောက်ကို",
+  "ယောက်နဲ့",
+  "ရခိုင်ပြည်နယ်",
+  "ရန်ကုန်က",
+  "ရာထူး",
+  "ရှင်းပြပါတယ်။",
+  "ရှိနေတယ်လို့",
+  "ရှိပြီ",
+  "လက်မမှ",
+  "လတ်တလော",
+  "လာတဲ့",
+  "လာပါတယ်။",
+  "လာရောက်",
+  "လိုက်သည်။",
+};
+const uint16_t WA_FREQ_112_RANKS[] = {
+  409, 942, 0, 0, 0, 525, 0, 0, 189, 467, 14, 0, 0, 599, 758, 831,
+  0, 215, 29, 729, 649, 0, 0, 41, 309, 448, 801, 0, 126, 256, 682, 356,
+  0, 0, 969, 0, 0, 262, 647, 240, 627, 203, 538, 0, 765, 0, 0, 0,
+  0, 0, 395, 0, 506, 52, 165, 0, 0, 0, 269, 0, 0, 133, 0, 0,
+  0, 0, 127, 761, 877, 100, 84, 213, 361, 76, 390, 205, 595, 347, 882, 892,
+  875, 939, 0, 935, 48, 530, 740, 951, 310, 554, 0, 0, 311, 481, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  247, 785, 64, 0, 196, 0, 0, 0, 0, 0, 420, 429, 0, 373, 0, 0,
+  523, 147, 0, 0, 607, 291, 712, 581, 754, 187, 0, 0, 0, 162, 792, 0,
+  0, 0, 0, 0, 0, 0, 0, 728, 958, 0, 0, 0, 697, 0, 228, 0,
+  624, 0, 731, 5, 700, 275, 0, 0, 0, 0, 0, 0, 0, 389, 0, 457,
+  0, 0, 0, 0, 249, 417, 507, 810, 833, 828, 173, 202, 277, 180, 184, 442,
+  872, 884, 0, 0, 300, 119, 0, 0, 0, 0, 0, 0, 398, 604, 0, 556,
+  0, 0, 0, 560, 744, 28, 0, 258, 501, 509, 982, 0, 104, 0, 0, 115,
+  708, 0, 874, 832, 905, 0, 0, 401, 685, 688, 0, 131, 625, 680, 574, 706,
+  776, 552, 823, 782, 0, 0, 183, 410, 659, 0, 0, 0, 916, 0, 0, 10,
+  0, 0, 991, 0, 0, 0, 0, 0, 88, 144, 721, 225, 190, 197, 592, 639,
+  929, 907, 0, 0, 0, 17, 0, 12, 780, 804, 995, 498, 86, 644, 208, 824,
+  204, 0, 964, 0, 466, 937, 602, 0, 799, 99, 0, 0, 0, 4, 16, 842,
+  0, 0, 0, 145, 31, 613, 0, 150, 0, 0, 0, 0, 681, 0, 0, 0,
+  0, 0, 0, 0, 0, 212, 0, 0, 868, 200, 375, 789, 392, 0, 297, 618,
+  253, 245, 836, 962, 331, 570, 323, 125, 485, 863, 537, 809, 891, 271, 0, 0,
+  608, 0, 0, 0, 0, 0, 0, 186, 0, 0, 0, 111, 320, 848, 0, 272,
+  70, 163, 405, 617, 232, 637, 628, 805, 0, 0, 474, 0, 299, 774, 98, 551,
+  473, 260, 932, 0, 117, 582, 844, 0, 806, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 116, 0, 735, 0, 0, 756,
+  0, 241, 859, 220, 385, 0, 0, 0, 0, 573, 0, 0, 767, 0, 0, 78,
+  0, 632, 0, 416, 944, 0, 521, 201, 0, 340, 11, 175, 393, 418, 757, 0,
+  0, 0, 0, 846, 0, 0, 532, 123, 281, 108, 0, 646, 0, 0, 898, 0,
+  0, 0, 296, 0, 387, 963, 0, 0, 839, 739, 889, 69, 472, 408, 489, 734,
+  0, 887, 211, 0, 938, 0, 0, 0, 0, 36, 192, 270, 0, 333, 0, 0,
+  0, 214, 500, 0, 575, 0, 0, 0, 110, 483, 492, 817, 246, 698, 306, 871,
+  987, 0, 936, 0, 0, 0, 0, 0, 0, 0, 386, 0, 0, 0, 0, 0,
+  612, 0, 0, 0, 0, 579, 0, 977, 0, 0, 0, 0, 87, 918, 0, 0,
+  0, 0, 0, 0, 402, 0, 598, 917, 0, 295, 0, 0, 106, 294, 0, 0,
+  0, 439, 0, 0, 7, 49, 152, 303, 438, 431, 83, 829, 655, 572, 486, 26,
+  103, 811, 878, 881, 885, 909, 404, 924, 0, 949, 419, 0, 0, 0, 788, 0,
+  816, 620, 813, 0, 0, 0, 742, 0, 645, 0, 0, 900, 267, 0, 0, 238,
+  862, 0, 244, 0, 120, 0, 71, 450, 0, 168, 0, 0, 0, 0, 0, 674,
+  615, 726, 0, 0, 0, 124, 0, 0, 112, 858, 947, 925, 0, 0, 0, 363,
+  0, 0, 0, 714, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 377,
+  54, 563, 0, 0, 0, 0, 0, 95, 0, 371, 478, 0, 760, 0, 0, 224,
+  92, 0, 0, 0, 699, 0, 0, 0, 0, 950, 0, 0, 0, 0, 0, 670,
+  0, 0, 44, 102, 626, 234, 0, 658, 362, 504, 717, 539, 0, 0, 856, 0,
+  279, 979, 997, 0, 316, 20, 0, 484, 0, 370, 293, 0, 421, 886, 0, 0,
+  663, 477, 475, 174, 19, 43, 469, 0, 0, 0, 0, 0, 0, 181, 317, 113,
+  764, 0, 470, 0, 894, 394, 0, 0, 0, 0, 522, 566, 57, 923, 0, 359,
+  0, 0, 0, 0, 0, 0, 0, 56, 0, 971, 0, 733, 193, 18, 0, 0,
+  15, 226, 446, 0, 843, 0, 0, 850, 0, 0, 327, 0, 0, 0, 559, 332,
+  0, 793, 983, 0, 0, 0, 888, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 352, 0, 0, 381, 493, 53, 503, 68, 984, 51, 0, 0, 339, 763,
+  547, 0, 65, 159, 132, 170, 0, 0, 0, 0, 807, 0, 0, 927, 0, 0,
+  351, 425, 508, 0, 136, 636, 837, 0, 502, 0, 585, 0, 480, 914, 0, 0,
+  0, 453, 704, 0, 0, 259, 656, 869, 0, 0, 0, 600, 0, 0, 242, 0,
+  494, 540, 0, 0, 101, 0, 0, 911, 0, 0, 678, 0, 0, 550, 75, 822,
+  926, 0, 0, 0, 0, 0, 0, 85, 0, 0, 443, 0, 63, 151, 435, 0,
+  0, 0, 0, 0, 0, 723, 755, 529, 0, 0, 0, 0, 0, 0, 0, 497,
+  188, 0, 0, 930, 524, 0, 812, 9, 955, 0, 0, 0, 341, 0, 0, 0,
+  0, 0, 0, 307, 321, 0, 0, 338, 177, 433, 904, 0, 0, 0, 6, 423,
+  558, 219, 577, 0, 82, 336, 597, 195, 0, 0, 0, 999, 118, 0, 345, 638,
+  0, 0, 0, 0, 0, 491, 0, 0, 0, 0, 0, 0, 959, 976, 0, 535,
+  143, 79, 462, 0, 0, 0, 0, 0, 528, 635, 465, 0, 0, 0, 40, 0,
+  0, 0, 603, 89, 378, 0, 0, 3, 128, 384, 642, 690, 695, 759, 280, 517,
+  825, 972, 0, 0, 330, 718, 0, 0, 0, 654, 335, 954, 591, 105, 158, 934,
+  0, 415, 978, 0, 0, 0, 0, 0, 0, 0, 0, 2, 434, 0, 0, 488,
+  319, 610, 897, 797, 495, 399, 893, 59, 920, 957, 0, 0, 0, 643, 0, 22,
+  140, 0, 199, 391, 994, 287, 0, 274, 0, 0, 544, 616, 0, 0, 0, 0,
+  0, 0, 661, 0, 0, 324, 753, 0, 0, 0, 684, 716, 413, 808, 980, 0,
+  749, 0, 0, 0, 0, 0, 0, 0, 424, 0, 648, 0, 0, 769, 0, 25,
+  933, 965, 0, 0, 0, 689, 692, 679, 0, 853, 0, 705, 686, 0, 0, 0,
+  0, 257, 172, 543, 62, 569, 329, 169, 441, 693, 343, 743, 838, 840, 0, 0,
+  66, 266, 427, 536, 633, 182, 0, 0, 0, 263, 0, 0, 0, 0, 0, 0,
+  326, 0, 834, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 668, 794, 61,
+  73, 0, 0, 0, 0, 0, 142, 0, 0, 0, 216, 268, 0, 81, 0, 985,
+  471, 0, 0, 342, 691, 796, 866, 382, 948, 953, 0, 0, 0, 35, 0, 0,
+  0, 236, 568, 803, 0, 0, 0, 0, 0, 0, 0, 137, 707, 0, 0, 0,
+  0, 0, 0, 0, 0, 58, 514, 0, 476, 194, 334, 426, 458, 505, 895, 0,
+  302, 0, 0, 0, 0, 0, 0, 0, 94, 24, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 860, 0, 0, 998, 943, 0, 0, 0, 0, 254, 827, 0,
+  0, 826, 0, 0, 0, 814, 815, 0, 379, 751, 0, 383, 0, 0, 0, 0,
+  545, 0, 93, 206, 701, 546, 0, 0, 0, 0, 0, 39, 376, 0, 0, 0,
+  901, 641, 0, 0, 0, 660, 0, 0, 0, 0, 0, 879, 0, 0, 482, 0,
+  0, 74, 795, 0, 0, 0, 0, 380, 0, 222, 161, 992, 0, 223, 499, 973,
+  0, 0, 0, 0, 250, 694, 725, 732, 0, 0, 265, 630, 0, 940, 0, 531,
+  0, 248, 0, 0, 322, 709, 0, 0, 0, 166, 34, 852, 0, 0, 0, 903,
+  304, 0, 0, 0, 0, 0, 778, 0, 0, 0, 0, 0, 0, 0, 444, 651,
+  0, 741, 432, 715, 0, 0, 0, 0, 0, 239, 0, 818, 464, 344, 534, 908,
+  653, 0, 198, 0, 634, 669, 0, 650, 619, 0, 0, 0, 0, 0, 970, 584,
+  135, 273, 961, 0, 46, 0, 0, 851, 0, 0, 0, 0, 0, 0, 0, 33,
+  664, 0, 8, 0, 207, 0, 156, 0, 301, 687, 0, 512, 773, 178, 0, 0,
+  0, 0, 0, 146, 278, 0, 153, 45, 0, 0, 0, 407, 580, 0, 0, 0,
+  0, 0, 313, 60, 346, 0, 0, 0, 0, 727, 702, 0, 0, 0, 0, 21,
+  609, 0, 913, 0, 0, 0, 0, 96, 820, 0, 0, 0, 23, 0, 397, 364,
+  0, 0, 55, 261, 348, 455, 479, 747, 0, 0, 357, 783, 0, 0, 0, 722,
+  451, 97, 90, 179, 777, 0, 0, 0, 422, 0, 0, 0, 0, 0, 0, 993,
+  463, 0, 0, 0, 596, 0, 968, 0, 109, 0, 847, 0, 0, 683, 0, 0,
+  0, 0, 548, 952, 0, 0, 0, 990, 0, 0, 286, 0, 0, 210, 857, 0,
+  0, 0, 0, 870, 696, 298, 0, 0, 0, 902, 0, 0, 0, 0, 0, 750,
+  0, 768, 865, 912, 0, 227, 235, 0, 0, 0, 791, 0, 0, 0, 0, 611,
+  0, 0, 631, 282, 542, 0, 0, 0, 0, 0, 185, 0, 0, 0, 0, 0,
+  676, 358, 372, 285, 0, 0, 555, 0, 0, 0, 374, 562, 0, 511, 557, 703,
+  0, 0, 0, 314, 107, 436, 490, 588, 713, 308, 855, 906, 910, 922, 0, 0,
+  233, 564, 786, 154, 849, 276, 945, 0, 752, 237, 0, 0, 583, 0, 0, 0,
+  0, 0, 0, 0, 445, 621, 0, 0, 354, 0, 0, 0, 561, 315, 762, 677,
+  155, 0, 0, 456, 0, 50, 748, 0, 0, 0, 447, 0, 0, 0, 0, 0,
+  956, 515, 0, 0, 513, 0, 0, 0, 883, 0, 0, 365, 0, 771, 800, 91,
+  141, 640, 0, 0, 0, 0, 675, 745, 0, 0, 0, 864, 0, 164, 0, 160,
+  289, 468, 114, 802, 931, 966, 996, 880, 0, 567, 772, 0, 0, 0, 0, 0,
+  981, 0, 0, 0, 719, 861, 974, 0, 0, 0, 0, 0, 290, 673, 0, 437,
+  0, 0, 149, 428, 252, 337, 821, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 787, 388, 366, 0, 986, 0, 662, 975, 459, 32, 0, 0, 0, 0,
+  0, 80, 0, 218, 0, 0, 0, 0, 0, 652, 876, 0, 27, 47, 122, 553,
+  798, 0, 0, 0, 0, 0, 0, 0, 921, 0, 0, 0, 449, 0, 0, 622,
+  775, 589, 0, 171, 0, 440, 0, 130, 283, 288, 0, 919, 0, 671, 403, 0,
+  565, 0, 0, 578, 606, 0, 0, 587, 890, 0, 710, 0, 527, 0, 0, 0,
+  0, 0, 0, 134, 0, 0, 0, 0, 460, 0, 0, 328, 0, 0, 37, 623,
+  0, 0, 0, 0, 229, 896, 0, 0, 221, 406, 454, 325, 666, 38, 355, 396,
+  461, 770, 0, 594, 614, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 510,
+  0, 988, 0, 0, 657, 0, 541, 0, 0, 430, 0, 0, 915, 0, 941, 452,
+  0, 0, 0, 0, 672, 400, 533, 0, 0, 0, 779, 0, 255, 724, 0, 367,
+  0, 0, 0, 737, 0, 0, 13, 0, 0, 746, 0, 0, 42, 67, 0, 0,
+  0, 191, 360, 845, 0, 129, 516, 0, 0, 0, 0, 231, 0, 549, 711, 496,
+  411, 989, 841, 0, 526, 605, 593, 0, 312, 0, 292, 176, 251, 873, 790, 0,
+  0, 854, 520, 0, 0, 0, 30, 121, 72, 487, 601, 819, 0, 0, 230, 0,
+  0, 0, 766, 835, 318, 243, 0, 0, 0, 0, 0, 960, 209, 0, 0, 217,
+  571, 0, 414, 138, 157, 349, 518, 738, 784, 830, 781, 967, 148, 369, 0, 0,
+  350, 0, 576, 0, 353, 368, 665, 264, 412, 284, 899, 586, 867, 736, 519, 629,
+  928, 667, 1000, 1, 305, 77, 720, 946, 0, 139, 590, 0, 167, 0, 0, 730,
+};
+
+const char *WA_FREQ_113_TOKENS[] = {
+  "тов",
+  "седе",
+  "ламо",
+  "ава",
+  "тесэ",
+  "тон",
+  "финнэнь",
+  "ломанят",
+  "янксян",
+  "мекс",
+  "туинь",
+  "зяро",
+  "тонеть",
+  "эряви",
+  "апак",
+  "кавтолдо",
+  "ловномась",
+  "сёрмадомадо",
+  "шожда",
+  "ков",
+  "эйкакшт",
+  "кедть",
+  "паро",
+  "чокшне",
+  "шумбрат",
+  "кияк",
+  "панжизе",
+  "кенкшенть",
+};
+const uint16_t WA_FREQ_113_RANKS[] = {
+  0, 0, 0, 9, 0, 0, 0, 0, 0, 19, 24, 0, 0, 0, 0, 0,
+  17, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 21, 11, 0,
+  0, 12, 0, 0, 6, 0, 0, 0, 26, 8, 5, 18, 0, 10, 16, 4,
+  20, 22, 28, 1, 0, 0, 0, 0, 0, 3, 15, 25, 7, 13, 23, 27,
+};
+
+const char *WA_FREQ_114_TOKENS[] = {
+  "دله",
+  "و",
+  "که",
+  "اتا",
+  "هسته",
+  "ره",
+  "اینتا",
+  "ونه",
+  "نوم",
+  "سال",
+  "تصویب",
+  "رای",
+  "از",
+  "دره",
+  "جه",
+  "۰تا",
+  "نفر",
+  "هسه",
+  "جمعیت",
+  "ایران",
+  "قرار",
+  "بی‌یه",
+  "وه",
+  "دارنه",
+  "تاریخ",
+  "شهر",
+  "سازمان",
+  "بین‌المللی",
+  "درباره",
+  "امنیت",
+  "شورا",
+  "سند",
+  "قطعنومه",
+  "بَیّه،",
+  "متحدِ",
+  "مللِ",
+  "در",
+  "این",
+  "نشست",
+  "بَیّه",
+  "قطعنومه،",
+  "به",
+  "مخالف",
+  "موافق",
+  "ممتنع",
+  "رای،",
+  "روستا،",
+  "بیه",
+  "دله،",
+  "ئو",
+  "ِسرشماری",
+  "جا",
+  "۱۵تا",
+  "تا",
+  "مرکز",
+  "میلادی",
+  "اوستان",
+  "کشور",
+  "با",
+  "بخش",
+  "میون",
+  "فرانسه",
+  "شه",
+  "شهرستون",
+  "قرن",
+  "داینه",
+  "دهستون",
+  "یا",
+  "استان",
+  "آماری",
+  "براساس",
+  "مازرون",
+  "گادِر",
+  "سَره،",
+  "هم",
+  "روستایِ",
+  "وشون",
+  "اهل",
+  "اعلام",
+  "۱۳۹۰",
+  "۲۰۰۸",
+  "جاپون",
+  "وضعیت",
+  "هاکردن",
+  "هاکاردنه",
+  "درون",
+  "خله",
+  "۱۳۸۵",
+  "اردبیل",
+  "توابع",
+  "بابل",
+  "روستای",
+  "بیّه",
+  "بررسی",
+  "گت",
+  "ِاوستان",
+  "ِبخش،",
+  "ِشهرستون،",
+  "نویسنده",
+  "ِدهستون",
+  "زوون",
+  "بینه",
+  "ساری",
+  "مازندران",
+  "ولی",
+  "مازرون اوستان",
+  "داشته",
+  "مرکزی",
+  "بیستم",
+  "بونه",
+  "سر",
+  "دانّه",
+  "هاکرده",
+  "جنوبی",
+  "مازرونی",
+  "زبون",
+  "أتا",
+  "سرشماری",
+  "هکرده",
+  "پاپ",
+  "وسّه",
+  "دسامبر",
+  "اون",
+  "پیش",
+  "دنیا",
+  "فرانسهِ",
+  "کار",
+  "آمار",
+  "ایالت",
+  "جنگ",
+  "اسا",
+  "آمریکا",
+  "بعد",
+  "ژوئن",
+  "بر",
+  "دهستان",
+  "مردم",
+  "۱۳۸۵،",
+  "گادِر،",
+  "ایالات",
+  "برای",
+  "شاعر",
+  "دو",
+  "دوره",
+  "جزیره",
+  "میلیون",
+  "زمون",
+  "ژانویه",
+  "مارس",
+  "جوموری",
+  "هر",
+  "بیته",
+  "غربی",
+  "دیگه",
+  "اکتبر",
+  "بندپی",
+  "نوامبر",
+  "سه",
+  "سپتامبر",
+  "مه",
+  "گت‌ترین",
+  "رم",
+  "پس",
+  "روز",
+  "آوریل",
+  "گتی",
+  "ویشتر",
+  "قاره",
+  "متحده",
+  "ئون",
+  "زندگی",
+  "متر",
+  "کانده",
+  "بمرده",
+  "زمین",
+  "هسنه",
+  "شرقی",
+  "جولای",
+  "بزائه",
+  "بین",
+  "وره",
+  "پیل",
+  "بموئه",
+  "۳۰",
+  "اولین",
+  "نوزدهم",
+  "اوت",
+  "شمالی",
+  "موزه",
+  "یکا",
+  "خوری",
+  "پیدا",
+  "فارسی",
+  "۱۵",
+  "صورت",
+  "ئیران",
+  "دونگه",
+  "کاتولیک",
+  "ِمرکزی",
+  "کلیسای",
+  "بورده",
+  "ترین",
+  "را",
+  "گپ",
+  "هستنه",
+  "چین",
+  "دریا",
+  "۲۹",
+  "هکردنه",
+  "۱تا",
+  "نفرجمعیت",
+  "دولت",
+  "استفاده",
+  "بنویشته",
+  "حکومت",
+  "انگلیسی",
+  "بساته",
+  "گنش",
+  "اونجه",
+  "ِشرقی",
+  "نیشته‌گا",
+  "تیم",
+  "ملی",
+  "مِقوم",
+  "اما",
+  "اول",
+  "رسمی",
+  "قبول",
+  "پرتغال",
+  "عضو",
+  "180px",
+  "سیوا",
+  "۲۰۰۷",
+  "فوریه",
+  "متحد",
+  "۱۴",
+  "درنه",
+  "۲۰",
+  "دین",
+  "هدائه",
+  "کننه",
+  "رمان‌نویس",
+  "وانه",
+  "یک",
+  "۲۸",
+  "بریتانیا",
+  "درست",
+  "مسابقات",
+  "منطقه",
+  "وونه",
+  "دست",
+  "پرتغالی",
+  "کیلومتر",
+  "قدیم",
+  "ویشته",
+  "۲۰۰۶",
+  "بی",
+  "عربی",
+  "ئوشار",
+  "جه،",
+  "شهرستون،",
+  "۱۲",
+  "مشگین",
+  "مونا",
+  "بنویشت",
+  "توسط",
+  "هاکردنه",
+  "کوه",
+  "همه",
+  "۲تا",
+  "۲۱",
+  "دنه",
+  "مردمون",
+  "حزب",
+  "قبرس",
+  "ادبیات",
+  "اینکه",
+  "باعث",
+  "ای",
+  "۲۲",
+  "ی",
+  "۱۴تا",
+  "ایسم",
+  "پرچم",
+  "۱۷",
+  "آلمان",
+  "خورشید",
+  "۱۹",
+  "۱۳",
+  "۲۰۰۹",
+  "آسیا",
+  "دتا",
+  "مسیه",
+  "نشون",
+  "۲۷",
+  "دوم",
+  "ِدله",
+  "یه",
+  "دِتا",
+  "کهکشون",
+  "۳۱",
+  "عراق",
+  "ملل",
+  "نوری",
+  "هند",
+  "کتاب",
+  "ات",
+  "بار",
+  "تشکیل",
+  "جهون",
+  "هاکنه",
+  "شروع",
+  "تموم",
+  "است",
+  "تبرستون",
+  "راه",
+  "کم",
+  "کیتاب",
+  "۲۳",
+  "سده",
+  "هزار",
+  "وسر",
+  "سجادرود",
+  "فلکی",
+  "معنی",
+  "۱۸",
+  "ریکا",
+  "ماه",
+  "گرمی",
+  "۱۱",
+  "ایرانی",
+  "سلسله",
+  "۲۵",
+  "داستان",
+  "سَر",
+  "هکنه",
+  "چون",
+  "۴",
+  "جنوب",
+  "روسیه",
+  "هسِّه",
+  "تهران",
+  "جایزه",
+  "دانه",
+  "دِ",
+  "بعضی",
+  "حدود",
+  "۱۹۹۳",
+  "اولی",
+  "شا",
+  "گانّه",
+  "علی",
+  "آفریقا",
+  "مورد",
+  "همراه",
+  "ِمسئله",
+  "گیلون",
+  "دیگر",
+  "رشته",
+  "شوروی",
+  "همون",
+  "گروه",
+  "رستاق",
+  "نه",
+  "نیشتنگا",
+  "هجری",
+  "۱۰",
+  "۱۶",
+  "۲۶",
+  "په",
+  "درس",
+  "شرکت",
+  "همین",
+  "۲۰۱۱",
+  "برابر",
+  "حمله",
+  "سامون",
+  "اتی",
+  "او",
+  "خط",
+  "كه",
+  "ژان",
+  "کارده",
+  "ِچار",
+  "پارس‌آباد",
+  "کشورون",
+  "کلیسا",
+  "خاورمیونه",
+  "په،",
+  "آفریخا",
+  "بخش،",
+  "بلننی",
+  "حوکومت",
+  "چن",
+  "۲۰۰۵",
+  "بَیی‌یه",
+  "خراسان",
+  "رضوی",
+  "صلح",
+  "مثل",
+  "کولونی",
+  "۱۳تا",
+  "یعنی",
+  "۱۱تا",
+  "۱۹۹۴",
+  "آمل",
+  "بازی",
+  "سنه",
+  "شعر",
+  "هکردن",
+  "ان‌جی‌سی",
+  "بمردن",
+  "دیّه",
+  "شاء",
+  "اصلی",
+  "ایسلام",
+  "دس",
+  "رو",
+  "واقع",
+  "۱۹۹۲",
+  "۲",
+  "اوشار",
+  "بی‌یه،",
+  "دابوی",
+  "سرزمین",
+  "هاکرد",
+  "ِشهر",
+  "ِلاله‌آباد",
+  "کانّه",
+  "کرون",
+  "انگوت",
+  "بابلسر",
+  "بردسکن",
+  "روستائی",
+  "شهرستان",
+  "ونجه",
+  "ِکشور",
+  "۲۰۱۰",
+  "اساره",
+  "بن",
+  "بیّن",
+  "بەلەننی",
+  "جهونی",
+  "شمال",
+  "نیه",
+  "ور",
+  "۲۰۰۳",
+  "بدینه",
+  "خانواده",
+  "روی",
+  "همینتی",
+  "کوردستون",
+  "۲۰۰۴",
+  "آمریکایی",
+  "برخی",
+  "شانزدهم",
+  "شکست",
+  "وچه",
+  "چاپ",
+  "۱۹۹۸",
+  "سوار",
+  "نیز",
+  "هدا",
+  "همینسه",
+  "وجود",
+  "۱۹۹۵",
+  "۲۰۰۲",
+  "سیاسی",
+  "لیتکوه",
+  "موتحده",
+  "گنه",
+  "۲۴",
+  "کویت",
+  "انجام",
+  "قشلاق",
+  "نمایش‌نومه",
+  "هاکنن",
+  "پلی",
+  "آلمانی",
+  "ترنه",
+  "تولید",
+  "زیادی",
+  "شونه",
+  "فاصله،",
+  "قهرمون",
+  "نویس",
+  "تاریخی",
+  "خار",
+  "دشت",
+  "دموکراتیک",
+  "دوران",
+  "صفحه",
+  "۱۹۹۹",
+  "جزیره مونا",
+  "خادش",
+  "ر",
+  "روم",
+  "سالگی",
+  "قدیمی",
+  "ِسازمان",
+  "پایین",
+  "کوردی",
+  "کیلومترموربع",
+  "آمریکای",
+  "اروپا",
+  "اصلاندوز",
+  "بئی",
+  "بازدیدکان",
+  "فصل",
+  "می",
+  "هجدهم",
+  "بائوته",
+  "بوسنی",
+  "شکل",
+  "هارشاگر",
+  "چه",
+  "۶",
+  "داشتنه",
+  "ساحل",
+  "موتحده ایالات",
+  "نومه",
+  "ِملل",
+  "آخرسری",
+  "هرزگوین",
+  "همینتا",
+  "ِغربی",
+  "۱۹۹۶",
+  "۲۰۰۰",
+  "۳",
+  "ایکه",
+  "خورشیدی",
+  "رودپی",
+  "سوریه",
+  "غار",
+  "هکنن",
+  "۱۹۹۷",
+  "ترکیه",
+  "جور",
+  "زیر",
+  "مکزیک",
+  "وسه",
+  "کاردنه",
+  "کنه",
+  "کنگو",
+  "داعی",
+  "دمباله",
+  "صحرا",
+  "فرمول",
+  "مجموعه",
+  "ناحیه",
+  "نوروز",
+  "ِترنه",
+  "کشف",
+  "۵",
+  "بوردنه",
+  "شومال",
+  "مقوم",
+  "نظر",
+  "ها",
+  "هسه‌نه",
+  "ِرودپی",
+  "کلی",
+  "جمهوری",
+  "دینه",
+  "سی",
+  "په‌روو",
+  "کشتی",
+  "گیرنه",
+  "آنگولا",
+  "بتونسته",
+  "روان",
+  "سومالی",
+  "هفدهم",
+  "پر",
+  "آن",
+  "برگذار",
+  "بيه",
+  "بییته",
+  "خوشه",
+  "دریا مونا",
+  "زیاد",
+  "هسته،",
+  "چار",
+  "۱",
+  "اگه",
+  "دریاچه",
+  "فیلم",
+  "همچنین",
+  "ِوضعیت",
+  "چند",
+  "یونان",
+  "۲۰۰۱",
+  "ارتفاع",
+  "رواندا",
+  "نوبل",
+  "کومک",
+  "بوردن",
+  "درصد",
+  "روزنومه‌نگار",
+  "مربع",
+  "مسیحی",
+  "نو",
+  "واژه",
+  "۱۹۹۰",
+  "۱۹۹۱",
+  "آزاد",
+  "ارشق",
+  "امریکا",
+  "بساتنه",
+  "توم",
+  "جهانی",
+  "خود",
+  "رئیس",
+  "رییس‌جمهور",
+  "مار",
+  "میلاد",
+  "نام",
+  "هیچ",
+  "ِبابل‌کنار",
+  "پهلوی",
+  "گانه",
+  "۰۴",
+  "۷",
+  "ارتش",
+  "اوقیانوس",
+  "بَینه",
+  "درکا",
+  "زمونی",
+  "سن",
+  "شامل",
+  "فقط",
+  "قسمت",
+  "آذربایجون",
+  "البته",
+  "اینتی",
+  "بگردسته",
+  "بیتنه",
+  "تنها",
+  "جمیت",
+  "دانشگاه",
+  "روسی",
+  "سبک",
+  "سیو",
+  "شما",
+  "عکس",
+  "فرهنگ",
+  "قدر",
+  "لاتین",
+  "لیبریا",
+  "معمولاً",
+  "میرزا",
+  "کاری‌پی",
+  "گورجستون",
+  "اسرائیل-لبنان",
+  "ایتالیا",
+  "باوندیون",
+  "بعدن",
+  "بیی‌یه",
+  "دونّه",
+  "سودان",
+  "شهرون",
+  "فلسطین",
+  "نفت",
+  "هدانه",
+  "ِکلیجان",
+  "گتاب",
+  "۹",
+  "بالا",
+  "داشته،",
+  "دی",
+  "روستا",
+  "زنّه",
+  "سَره",
+  "معروف",
+  "منتشر",
+  "وەشون",
+  "ِدو",
+  "پخش",
+  "کردنه",
+  "کیجا",
+  "کیلومترمترموربع",
+  "باز",
+  "خلخال",
+  "خوش‌رود",
+  "دَیی‌یه",
+  "دیه",
+  "سو",
+  "شو",
+  "فرانسوی",
+  "وقتی",
+  "گدر",
+  "اونا",
+  "بَییته",
+  "تبری",
+  "تنگه",
+  "جمله",
+  "جنسی",
+  "خد",
+  "دار",
+  "رهبر",
+  "عاج",
+  "عنوان",
+  "فریم",
+  "نیشتگاه",
+  "های",
+  "واری",
+  "ویکی‌پدیا",
+  "۳تا",
+  "۹تا",
+  "ke",
+  "آذربایجان",
+  "آلبوم",
+  "ات‌تی",
+  "ایسلامی",
+  "ایمپراتوری",
+  "بمو",
+  "بنشنه",
+  "بیش",
+  "جدید",
+  "جشن",
+  "شومالی",
+  "عونوان",
+  "غرب",
+  "نزدیک",
+  "پا",
+  "ژوئیه",
+  "کرده",
+  "کوره",
+  "کوچک",
+  "۱۰تا",
+  "of",
+  "re",
+  "آمریکا قاره",
+  "اروپای",
+  "اسپانیا",
+  "اینجه",
+  "بموئن",
+  "بوره",
+  "دکته",
+  "دیهستون",
+  "سِوا",
+  "عربستون",
+  "ما",
+  "مرن",
+  "میونی",
+  "وزیر",
+  "وچون",
+  "کر",
+  "گننه",
+  "یوگوسلاوی",
+  "آدم",
+  "ئوشاری",
+  "امیر",
+  "اندونزی",
+  "اوردون",
+  "ایقتصادی",
+  "بوئه",
+  "جهان",
+  "دور",
+  "رستم",
+  "ریزشگاه",
+  "زازاکی",
+  "زوونون",
+  "سنت",
+  "هنری",
+  "چنتا",
+  "کل",
+  "کوهنه",
+  "کیلومترمربع",
+  "گاتنه",
+  "یاد",
+  "۰۸",
+  "آخرین",
+  "اسپهبد",
+  "جان",
+  "دستور",
+  "دلیل",
+  "زنه‌نه",
+  "سوره",
+  "فوتوال",
+  "قدرت",
+  "مدرسه",
+  "نظامی",
+  "همدیگه",
+  "ویلکیج",
+  "پل",
+  "پنج",
+  "پییر",
+  "کانادا",
+  "۰۹",
+  "۱۲تا",
+  "Falls",
+  "بتونسه",
+  "بمونه",
+  "تر",
+  "خودرو",
+  "دارای",
+  "شمسی",
+  "فاصله",
+  "فیلسوف",
+  "قبل",
+  "منظومه",
+  "میاندورود",
+  "ِگتاب",
+  "پَلی",
+  "کبّی‌یه",
+  "کسی",
+  "گرگان",
+  "یونانی",
+  "اشاره",
+  "بزه",
+  "سپاه",
+  "شر",
+  "شرق",
+  "موسیقی",
+  "کلمه",
+  "attä",
+  "ادبی",
+  "بوو",
+  "تغییر",
+  "حال",
+  "دادگاه",
+  "سوم",
+  "سیرالئون",
+  "محمد",
+  "مناطق",
+  "موری",
+  "نزدیکی",
+  "نقش",
+  "پادشاهی",
+  "کلیجان",
+  "کلیجان رستاق",
+  "کو",
+  "۰۶",
+  "de",
+  "بیشتر",
+  "تقویم",
+  "جنوبی رودپی",
+  "دهه",
+  "شائون",
+  "شاه",
+  "قمری",
+  "مجله",
+  "نمین",
+  "ِخوری",
+  "پایتخت",
+  "کنار",
+  "کچیک",
+  "اتیوپی",
+  "اسم",
+  "انقلاب",
+  "اینان",
+  "بائه",
+  "تعداد",
+  "جای",
+  "دماوند",
+  "شون",
+  "علیا",
+  "موفق",
+  "نقشه",
+  "ِمنطقه",
+  "پاریس",
+  "آخر",
+  "آمریکایِ",
+  "اثر",
+  "اجتماعی",
+  "اسرائیل",
+  "انابد",
+  "بساتن",
+  "تهرون",
+  "داره",
+  "رنگ",
+  "شەنه",
+  "وختی",
+  "ِاتا",
+  "پول",
+  "گل",
+  "۱۹۴۸",
+  "۱۹۸۰",
+  "The",
+  "انجوم",
+  "ایسپانیا",
+  "بندر",
+  "بینه،",
+  "تیمور",
+  "جولی",
+  "حتی",
+  "خیابان",
+  "دشت سر",
+  "زنا",
+  "ساله",
+  "سیاره",
+  "طور",
+  "مردی",
+  "مسئله",
+  "وسّه،",
+  "ول",
+  "وی",
+  "ِسایتاما",
+  "پی‌یر",
+  "۰۷",
+  "Wikipedia",
+  "اختلال",
+  "ازدواج",
+  "اشغال",
+  "امه",
+  "انجیل",
+  "اوروپا",
+  "بیماری",
+  "جائون",
+  "جمع",
+  "حرکت",
+  "خان",
+  "زنده",
+  "سعودی",
+  "نیروئون",
+  "کا",
+  "یکم",
+  "۱۹۶۰",
+  "۱۹۸۸",
+  "اتحاد",
+  "اسرائیل-سوریه",
+  "امروزه",
+  "جام",
+  "جنگل",
+  "خورد",
+  "دوره‌ی",
+  "دومین",
+  "سال‌ئون",
+  "سرخ",
+  "سوی",
+  "شاخه",
+  "شیر",
+  "ظاهری",
+  "فیروزجاه",
+  "هاده",
+  "هسّه",
+  "هفت",
+  "همکاری",
+  "گتنه",
+  "گتِ",
+  "گیلون اوستان",
+  "ئوروپا",
+  "اسب",
+  "اين",
+  "ایجاد",
+  "بالاخیابان",
+  "بریتانیای",
+  "بوننه",
+  "بیّه،",
+  "جا،",
+  "جنبش",
+  "غیر",
+  "فلسفه",
+  "منابع",
+  "مورخ",
+  "نیشتنگاء",
+  "هرازپی",
+  "هنتا",
+  "چندتا",
+  "کوروش",
+  "گرجستون",
+  "۱۹۸۲",
+  "and",
+  "آغاز",
+  "اردن",
+  "اسفیورد",
+  "افغانستان",
+  "المپیک",
+  "تازه",
+  "تقسیم",
+  "جرم",
+  "خاک",
+  "ده",
+  "دیوان",
+  "رشت",
+  "سفلی",
+  "شارل",
+  "شوراب",
+  "عیسی",
+  "فیضیه",
+  "لندن",
+  "معاون",
+  "نتیجه",
+  "ِچیبا",
+  "چینی",
+  "گادر",
+  "گورباچف",
+  "۱۹۷۰",
+  "اینگیلیسی",
+  "بائوتنه",
+  "بواشه",
+  "بَیته",
+  "ته",
+  "جامع",
+  "جنایی",
+  "دسته",
+  "رییس‌جمهوری",
+  "علویون",
+  "ممد",
+};
+const uint16_t WA_FREQ_114_RANKS[] = {
+  936, 0, 0, 0, 0, 37, 0, 0, 270, 57, 0, 754, 507, 109, 550, 838,
+  860, 0, 0, 0, 0, 0, 0, 0, 0, 684, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 147, 177, 361, 718, 926, 4, 487, 768, 974, 589, 0, 0,
+  783, 0, 0, 973, 0, 679, 755, 0, 142, 311, 90, 917, 0, 0, 0, 0,
+  41, 0, 0, 149, 281, 0, 0, 54, 0, 375, 767, 529, 729, 0, 297, 472,
+  0, 0, 0, 0, 76, 0, 0, 0, 0, 0, 0, 672, 0, 458, 125, 308,
+  582, 268, 138, 0, 0, 0, 0, 116, 137, 464, 432, 631, 678, 848, 952, 0,
+  0, 0, 567, 769, 394, 228, 447, 523, 831, 0, 0, 0, 0, 629, 86, 250,
+  542, 376, 584, 671, 282, 0, 0, 0, 0, 0, 508, 264, 657, 682, 891, 896,
+  970, 0, 0, 0, 179, 0, 0, 217, 0, 236, 947, 612, 0, 0, 397, 540,
+  0, 0, 0, 518, 0, 435, 760, 0, 0, 0, 58, 0, 0, 0, 20, 190,
+  320, 153, 950, 0, 0, 371, 721, 0, 203, 0, 106, 0, 0, 0, 0, 0,
+  496, 942, 0, 173, 723, 863, 956, 24, 0, 866, 0, 238, 187, 0, 0, 395,
+  814, 840, 0, 0, 0, 122, 280, 285, 793, 857, 0, 294, 640, 411, 21, 124,
+  60, 314, 424, 26, 526, 585, 751, 800, 996, 0, 0, 0, 579, 0, 363, 0,
+  0, 0, 930, 130, 522, 0, 0, 0, 0, 428, 0, 825, 912, 0, 0, 491,
+  521, 882, 987, 0, 0, 161, 241, 0, 0, 0, 0, 0, 0, 509, 471, 391,
+  953, 592, 170, 269, 707, 0, 0, 208, 0, 455, 0, 714, 0, 0, 0, 0,
+  0, 0, 0, 777, 0, 0, 0, 456, 0, 0, 0, 0, 0, 143, 696, 0,
+  199, 708, 670, 0, 0, 414, 0, 0, 976, 0, 342, 359, 0, 0, 0, 0,
+  0, 914, 0, 742, 0, 128, 480, 0, 627, 358, 0, 0, 0, 0, 478, 0,
+  490, 0, 118, 0, 96, 0, 804, 246, 876, 0, 0, 0, 200, 80, 0, 274,
+  737, 652, 0, 7, 0, 568, 42, 0, 0, 0, 0, 0, 0, 0, 0, 354,
+  476, 647, 286, 0, 0, 655, 978, 40, 0, 290, 0, 849, 0, 0, 539, 0,
+  0, 0, 0, 0, 0, 0, 0, 205, 0, 259, 0, 31, 856, 879, 0, 0,
+  141, 0, 0, 0, 674, 635, 0, 0, 0, 0, 0, 0, 0, 0, 931, 50,
+  283, 676, 437, 748, 593, 938, 0, 819, 871, 400, 0, 0, 0, 321, 958, 959,
+  972, 0, 0, 0, 0, 79, 384, 102, 331, 650, 0, 28, 622, 398, 675, 0,
+  0, 0, 0, 0, 739, 868, 111, 598, 0, 489, 728, 0, 0, 0, 796, 701,
+  373, 633, 267, 730, 408, 449, 733, 901, 646, 998, 0, 341, 765, 0, 0, 0,
+  0, 0, 0, 442, 157, 613, 726, 0, 601, 0, 0, 0, 792, 319, 230, 0,
+  982, 0, 0, 0, 0, 0, 209, 68, 0, 704, 0, 0, 0, 488, 904, 0,
+  0, 0, 337, 0, 725, 103, 85, 0, 248, 0, 0, 0, 0, 0, 108, 572,
+  0, 929, 70, 145, 44, 0, 0, 0, 186, 851, 884, 537, 560, 0, 399, 252,
+  387, 883, 961, 965, 0, 0, 0, 0, 0, 221, 727, 0, 818, 486, 0, 0,
+  0, 379, 95, 184, 881, 839, 0, 0, 406, 810, 591, 621, 641, 660, 0, 0,
+  0, 0, 0, 365, 557, 927, 0, 824, 865, 0, 0, 0, 0, 0, 0, 0,
+  939, 0, 0, 887, 0, 0, 0, 0, 0, 345, 351, 499, 538, 788, 0, 0,
+  444, 0, 0, 719, 846, 873, 0, 0, 0, 0, 0, 0, 231, 741, 0, 446,
+  547, 752, 0, 920, 304, 0, 0, 59, 0, 0, 10, 251, 615, 700, 234, 781,
+  861, 348, 0, 932, 0, 326, 470, 0, 0, 309, 574, 692, 150, 474, 196, 940,
+  0, 0, 0, 0, 0, 0, 607, 916, 16, 0, 0, 778, 0, 310, 966, 0,
+  816, 0, 0, 895, 0, 0, 8, 506, 514, 661, 49, 0, 530, 869, 0, 628,
+  0, 0, 74, 690, 0, 717, 845, 87, 903, 989, 0, 0, 0, 97, 225, 0,
+  0, 0, 0, 29, 62, 0, 89, 202, 602, 271, 893, 0, 0, 0, 0, 531,
+  828, 0, 344, 389, 782, 807, 0, 416, 0, 0, 0, 0, 0, 139, 0, 0,
+  0, 0, 0, 512, 0, 0, 0, 0, 0, 0, 192, 0, 552, 0, 0, 594,
+  573, 611, 743, 0, 0, 0, 215, 575, 357, 441, 951, 347, 812, 0, 175, 732,
+  105, 559, 0, 0, 0, 822, 0, 798, 0, 666, 941, 0, 30, 38, 770, 0,
+  0, 466, 0, 195, 0, 0, 43, 806, 841, 0, 855, 0, 0, 0, 131, 164,
+  73, 303, 160, 843, 382, 146, 0, 0, 0, 0, 0, 0, 0, 0, 820, 0,
+  114, 918, 0, 0, 889, 0, 0, 832, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 289, 779, 0, 0, 405, 0, 0, 0, 0, 0, 0, 853, 0, 0,
+  0, 0, 705, 171, 213, 421, 0, 0, 669, 425, 324, 565, 906, 525, 686, 595,
+  617, 501, 0, 393, 0, 764, 750, 0, 235, 0, 0, 0, 277, 797, 0, 483,
+  811, 0, 81, 0, 0, 220, 469, 497, 533, 482, 852, 0, 240, 0, 536, 477,
+  27, 596, 656, 420, 638, 720, 0, 0, 0, 0, 0, 0, 140, 541, 0, 0,
+  113, 0, 0, 0, 210, 313, 443, 712, 969, 0, 756, 276, 854, 338, 436, 564,
+  805, 218, 665, 495, 0, 532, 735, 332, 98, 45, 112, 258, 396, 823, 858, 0,
+  0, 0, 349, 0, 948, 418, 546, 0, 693, 785, 0, 307, 335, 0, 498, 0,
+  0, 0, 117, 0, 0, 610, 933, 0, 0, 636, 0, 372, 0, 599, 706, 968,
+  0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 83, 2, 152, 0, 757,
+  315, 0, 842, 949, 984, 0, 0, 0, 0, 180, 256, 451, 618, 664, 897, 899,
+  0, 0, 0, 0, 0, 0, 0, 454, 644, 801, 590, 0, 746, 0, 0, 0,
+  0, 787, 369, 789, 0, 0, 0, 272, 0, 645, 0, 0, 0, 0, 0, 0,
+  0, 0, 711, 300, 15, 0, 295, 462, 390, 0, 0, 0, 0, 0, 182, 0,
+  0, 734, 34, 167, 0, 0, 898, 222, 410, 178, 158, 786, 837, 440, 0, 0,
+  193, 115, 0, 403, 0, 0, 826, 0, 545, 624, 0, 353, 609, 77, 0, 0,
+  0, 0, 549, 136, 535, 201, 0, 429, 0, 257, 0, 817, 836, 0, 356, 0,
+  0, 366, 433, 502, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 913, 0,
+  0, 0, 0, 995, 0, 0, 22, 0, 731, 0, 0, 0, 0, 763, 0, 0,
+  0, 243, 886, 0, 0, 254, 279, 296, 762, 0, 0, 919, 0, 0, 168, 227,
+  0, 829, 0, 0, 0, 0, 0, 0, 0, 0, 859, 885, 0, 198, 32, 569,
+  0, 0, 867, 0, 0, 0, 561, 0, 463, 0, 0, 388, 835, 0, 0, 0,
+  0, 0, 0, 688, 563, 928, 0, 362, 47, 0, 9, 0, 803, 910, 527, 0,
+  0, 577, 662, 0, 772, 847, 0, 0, 862, 0, 794, 413, 994, 0, 352, 877,
+  0, 0, 784, 6, 606, 745, 492, 821, 0, 415, 0, 299, 555, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 915, 761, 955, 967, 975, 306, 0, 0, 11,
+  0, 758, 0, 0, 687, 654, 0, 908, 0, 0, 0, 156, 681, 166, 0, 0,
+  237, 174, 426, 216, 0, 155, 774, 132, 417, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 334, 407, 653, 957, 0, 197, 597, 0, 0, 206,
+  776, 0, 0, 0, 0, 383, 0, 0, 0, 0, 0, 554, 0, 935, 452, 0,
+  0, 0, 0, 325, 61, 603, 864, 977, 983, 0, 0, 0, 0, 0, 0, 0,
+  698, 0, 0, 0, 431, 461, 163, 0, 439, 94, 262, 336, 0, 0, 0, 13,
+  0, 0, 0, 0, 346, 934, 392, 0, 0, 0, 312, 937, 753, 65, 144, 0,
+  71, 233, 377, 945, 0, 0, 0, 0, 0, 659, 551, 680, 773, 261, 808, 159,
+  0, 0, 0, 88, 165, 520, 771, 713, 19, 874, 0, 0, 0, 0, 101, 0,
+  473, 0, 0, 0, 0, 570, 318, 72, 191, 485, 0, 892, 0, 0, 0, 316,
+  0, 587, 0, 0, 0, 802, 479, 0, 0, 0, 219, 566, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 322, 0, 0, 0, 0, 14, 0, 0, 850,
+  0, 648, 0, 0, 0, 0, 0, 626, 56, 293, 430, 0, 0, 91, 51, 663,
+  0, 0, 0, 0, 0, 980, 759, 981, 242, 0, 0, 457, 82, 333, 738, 0,
+  0, 0, 0, 0, 183, 878, 0, 0, 0, 0, 0, 668, 0, 0, 581, 0,
+  0, 790, 0, 0, 0, 0, 0, 301, 0, 0, 0, 438, 954, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 367, 12, 266, 0, 0, 0, 275, 0, 0, 556,
+  0, 204, 0, 229, 0, 0, 0, 419, 481, 694, 0, 791, 0, 0, 0, 288,
+  35, 583, 902, 0, 0, 620, 17, 1, 0, 0, 0, 0, 0, 0, 292, 511,
+  3, 667, 0, 84, 404, 0, 0, 0, 0, 0, 0, 0, 0, 302, 0, 129,
+  468, 990, 5, 78, 0, 0, 799, 0, 0, 0, 0, 123, 0, 0, 0, 368,
+  207, 249, 245, 578, 0, 0, 339, 0, 0, 0, 0, 0, 386, 0, 0, 212,
+  971, 0, 0, 370, 0, 0, 0, 0, 0, 543, 0, 343, 0, 0, 381, 553,
+  422, 0, 0, 0, 0, 0, 0, 0, 0, 0, 870, 0, 632, 0, 500, 780,
+  815, 872, 900, 0, 0, 0, 0, 0, 0, 448, 922, 0, 378, 0, 0, 524,
+  0, 0, 0, 0, 350, 0, 519, 460, 0, 52, 110, 0, 0, 0, 36, 0,
+  412, 327, 517, 639, 0, 0, 0, 0, 55, 298, 0, 450, 214, 605, 0, 0,
+  169, 0, 0, 0, 991, 0, 0, 0, 0, 0, 0, 0, 445, 0, 232, 894,
+  0, 0, 0, 0, 0, 154, 434, 673, 223, 0, 0, 53, 724, 374, 651, 736,
+  963, 0, 689, 907, 0, 0, 278, 880, 0, 93, 0, 0, 0, 0, 513, 634,
+  0, 0, 677, 0, 0, 135, 100, 92, 0, 0, 305, 0, 766, 0, 0, 120,
+  224, 260, 548, 0, 265, 0, 493, 909, 0, 0, 0, 0, 25, 0, 0, 985,
+  795, 317, 0, 0, 642, 0, 0, 0, 189, 637, 459, 0, 0, 364, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 465,
+  127, 619, 1000, 0, 0, 943, 64, 0, 964, 993, 63, 544, 148, 330, 107, 99,
+  505, 875, 0, 562, 580, 121, 0, 925, 188, 699, 716, 323, 813, 576, 649, 827,
+  67, 0, 494, 833, 239, 0, 0, 0, 0, 18, 340, 510, 380, 685, 695, 273,
+  0, 0, 0, 0, 385, 104, 923, 0, 0, 0, 0, 0, 691, 946, 962, 427,
+  588, 890, 0, 0, 0, 0, 0, 0, 0, 0, 0, 960, 0, 0, 0, 66,
+  658, 921, 997, 0, 740, 0, 0, 181, 0, 0, 625, 39, 911, 176, 722, 0,
+  253, 986, 0, 0, 809, 988, 905, 999, 226, 0, 0, 0, 0, 0, 284, 0,
+  0, 329, 0, 0, 0, 0, 0, 0, 0, 0, 126, 255, 571, 834, 133, 162,
+  401, 0, 749, 0, 643, 0, 23, 0, 0, 0, 0, 453, 0, 503, 888, 0,
+  0, 0, 0, 244, 0, 0, 0, 0, 0, 355, 747, 0, 484, 516, 0, 185,
+  614, 0, 0, 0, 69, 287, 291, 558, 211, 328, 630, 703, 979, 0, 134, 423,
+  775, 844, 0, 604, 46, 151, 710, 992, 944, 0, 0, 924, 0, 33, 0, 75,
+  0, 0, 0, 0, 0, 0, 0, 0, 830, 600, 0, 0, 263, 0, 172, 409,
+  194, 683, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 402, 0, 616,
+  709, 247, 504, 0, 0, 0, 697, 119, 702, 715, 0, 0, 467, 360, 608, 475,
+  586, 0, 623, 744, 0, 0, 0, 0, 515, 528, 0, 0, 0, 0, 534, 0,
+};
+
+const char *WA_FREQ_115_TOKENS[] = {
+  "de",
+  "dat",
+  "ik",
+  "will",
+  "sehn",
+  "ehr",
+  "an",
+  "en",
+  "is",
+  "dissen",
+  "film",
+  "geern",
+  "heff",
+  "vör",
+  "twee",
+  "johr",
+  "jichtens",
+  "betahlt",
+  "warrt",
+  "e",
+  "kass",
+  "wenn",
+  "steertpogg",
+  "wasst",
+  "denn",
+  "geiht",
+  "steert",
+  "weg",
+  "un",
+  "been",
+  "fangt",
+  "wassen",
+  "mien",
+  "hobby",
+  "inköpen",
+  "kann",
+  "licht",
+  "utdoon",
+  "woll",
+  "echten",
+  "dokter",
+  "küert",
+  "so",
+  "normaal",
+  "maak",
+  "keen",
+  "fehler",
+  "he",
+  "weer",
+  "dumm",
+  "noog",
+  "to",
+  "löven",
+  "küken",
+  "ümmer",
+  "kläuker",
+  "sin",
+  "as",
+  "hauhn",
+};
+const uint16_t WA_FREQ_115_RANKS[] = {
+  0, 0, 0, 5, 0, 0, 26, 51, 37, 45, 49, 0, 0, 0, 0, 0,
+  25, 58, 0, 40, 7, 42, 11, 38, 34, 0, 0, 1, 0, 24, 0, 0,
+  19, 50, 0, 18, 54, 0, 0, 0, 0, 0, 0, 2, 43, 36, 0, 0,
+  10, 0, 27, 15, 0, 17, 0, 0, 0, 53, 44, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 16, 0, 33, 22, 3, 32, 39, 52, 55, 57, 0,
+  0, 13, 56, 0, 0, 14, 46, 0, 47, 0, 0, 0, 59, 6, 0, 29,
+  4, 23, 41, 0, 0, 9, 0, 0, 0, 0, 35, 0, 21, 0, 0, 0,
+  0, 8, 0, 20, 28, 30, 12, 31, 0, 0, 0, 0, 0, 48, 0, 0,
+};
+
+const char *WA_FREQ_116_TOKENS[] = {
+  "र",
+  "पनि",
+  "छ",
+  "भएको",
+  "भने",
+  "लागि",
+  "गर्न",
+  "गरेको",
+  "गर्ने",
+  "छ।",
+  "हो",
+  "यो",
+  "नै",
+  "छन्।",
+  "उनले",
+  "तर",
+  "छन्",
+  "तथा",
+  "एक",
+  "थियो।",
+  "हुने",
+  "गरेका",
+  "हो।",
+  "भन्ने",
+  "नेपाली",
+  "थियो",
+  "रहेको",
+  "थिए।",
+  "हुन",
+  "नेपाल",
+  "त",
+  "केही",
+  "मात्र",
+  "काम",
+  "कुनै",
+  "गरी",
+  "गर्दै",
+  "संविधान",
+  "आफ्नो",
+  "राजनीतिक",
+  "कुरा",
+  "भएका",
+  "सबै",
+  "कारण",
+  "दिन",
+  "दुई",
+  "अहिले",
+  "गरिएको",
+  "थिए",
+  "को",
+  "भए",
+  "रूपमा",
+  "त्यो",
+  "यस",
+  "नयाँ",
+  "बताए।",
+  "गरेर",
+  "मा",
+  "माओवादी",
+  "अध्यक्ष",
+  "छैन",
+  "वा",
+  "हुन्छ",
+  "समेत",
+  "जानकारी",
+  "धेरै",
+  "बढी",
+  "सय",
+  "उनी",
+  "अनुसार",
+  "हजार",
+  "सरकार",
+  "राष्ट्रिय",
+  "छैन।",
+  "उनको",
+  "आएको",
+  "एउटा",
+  "निर्माण",
+  "सरकारले",
+  "प्रधानमन्त्री",
+  "के",
+  "प्रमुख",
+  "सहमति",
+  "भन्दै",
+  "तीन",
+  "भनेर",
+  "गर्दा",
+  "प्रहरी",
+  "पहिलो",
+  "वर्ष",
+  "अन्य",
+  "नेपालको",
+  "विकास",
+  "म",
+  "१",
+  "विभिन्न",
+  "जिल्ला",
+  "शान्ति",
+  "होइन",
+  "अब",
+  "रहेका",
+  "निर्णय",
+  "हामी",
+  "दिने",
+  "लाख",
+  "गरे",
+  "यस्तो",
+  "आर्थिक",
+  "नेता",
+  "हुन्छ।",
+  "ठूलो",
+  "सो",
+  "आएका",
+  "भयो",
+  "नेपालमा",
+  "हुन्",
+  "कि",
+  "२",
+  "हुन्।",
+  "समस्या",
+  "पार्टी",
+  "दिएको",
+  "क्षेत्रमा",
+  "विषयमा",
+  "यी",
+  "अर्को",
+  "गर्नु",
+  "सुरु",
+  "गरे।",
+  "मैले",
+  "समय",
+  "माग",
+  "भन्दा",
+  "स्थानीय",
+  "अवस्थामा",
+  "रुपमा",
+  "१०",
+  "प्रयोग",
+  "राम्रो",
+  "हाम्रो",
+  "भएर",
+  "ती",
+  "भएकाले",
+  "सहयोग",
+  "अवस्था",
+  "गते",
+  "कार्यक्रम",
+  "६",
+  "अघि",
+  "मेरो",
+  "यसको",
+  "बताए",
+  "त्यसैले",
+  "व्यवस्था",
+  "जना",
+  "अगाडि",
+  "मात्रै",
+  "भएपछि",
+  "माओवादीले",
+  "बनाउन",
+  "५",
+  "पर्ने",
+  "छलफल",
+  "जारी",
+  "भारतीय",
+  "३",
+  "पछि",
+  "तयार",
+  "लागेको",
+  "क्रममा",
+  "सदस्य",
+  "चार",
+  "हामीले",
+  "आज",
+  "मलाई",
+  "ले",
+  "प्रतिशत",
+  "सन्",
+  "त्यसको",
+  "आवश्यक",
+  "आधारमा",
+  "बेला",
+  "घर",
+  "करोड",
+  "बनाउने",
+  "मन्त्री",
+  "भने।",
+  "प्रहरीले",
+  "केन्द्रीय",
+  "बन्द",
+  "परेको",
+  "कम",
+  "गएको",
+  "उक्त",
+  "महिला",
+  "गत",
+  "उहाँले",
+  "जाने",
+  "सरकारको",
+  "एमाले",
+  "मन",
+  "नाम",
+  "नभएको",
+  "दिएका",
+  "उनलाई",
+  "रकम",
+  "कार्यक्रममा",
+  "जस्तो",
+  "जनाएको",
+  "निकै",
+  "समयमा",
+  "नेपालले",
+  "अनि",
+  "सरकारी",
+  "सार्वजनिक",
+  "लिएर",
+  "घोषणा",
+  "पूरा",
+  "यही",
+  "दोस्रो",
+  "डा",
+  "यहाँ",
+  "प्राप्त",
+  "कार्यालय",
+  "४",
+  "राज्य",
+  "थप",
+  "पाँच",
+  "उल्लेख",
+  "पटक",
+  "बन्न",
+  "यस्ता",
+  "देखि",
+  "आउने",
+  "रुपैयाँ",
+  "वटा",
+  "सेवा",
+  "मुख्य",
+  "भनेको",
+  "गर्नुपर्ने",
+  "करिब",
+  "सबैभन्दा",
+  "हुँदा",
+  "त्यही",
+  "सफल",
+  "बताएका",
+  "भइरहेको",
+  "विशेष",
+  "साथ",
+  "हुँदै",
+  "प्रक्रिया",
+  "आग्रह",
+  "लामो",
+  "साथै",
+  "थाहा",
+  "काठमाडौं",
+  "सहभागी",
+  "जनताको",
+  "१५",
+  "खेल",
+  "सुरक्षा",
+  "सक्ने",
+  "कांग्रेस",
+  "बिहे",
+  "दाबी",
+  "दिए।",
+  "बैठकमा",
+  "समिति",
+  "क्षेत्र",
+  "देश",
+  "भयो।",
+  "अन्तर्राष्ट्रिय",
+  "अधिकार",
+  "आयोजना",
+  "विषय",
+  "नेतृत्व",
+  "१२",
+  "२०",
+  "आफ्ना",
+  "का",
+  "दलका",
+  "गठन",
+  "नागरिक",
+  "पक्राउ",
+  "दुवै",
+  "कार्य",
+  "उच्च",
+  "यसले",
+  "दल",
+  "नाममा",
+  "अझै",
+  "निर्वाचन",
+  "नहुने",
+  "आरोप",
+  "राजेश",
+  "लिन",
+  "मृत्यु",
+  "१४",
+  "जुन",
+  "नेपालका",
+  "उनका",
+  "पुगेको",
+  "मूल्य",
+  "लगानी",
+  "खर्च",
+  "त्यसपछि",
+  "सञ्चालन",
+  "आफ्नै",
+  "पत्रकार",
+  "बनेको",
+  "सम्पन्न",
+  "गरेपछि",
+  "त्यस",
+  "अन्तिम",
+  "५०",
+  "राष्ट्रपति",
+  "नेकपा",
+  "एवं",
+  "प्रस्ताव",
+  "पैसा",
+  "बाँकी",
+  "फेरि",
+  "आन्दोलन",
+  "राष्ट्र",
+  "बैठक",
+  "योजना",
+  "किन",
+  "गफ",
+  "भारत",
+  "७",
+  "महानिरीक्षक",
+  "गोल",
+  "सक्छ",
+  "शिक्षा",
+  "मुख",
+  "सकेको",
+  "कसरी",
+  "नजिकबाट",
+  "उत्पादन",
+  "हुनु",
+  "खरेल",
+  "यसलाई",
+  "सामाजिक",
+  "त्यस्तै",
+  "बताउनुभयो",
+  "बारेमा",
+  "बजेट",
+  "८",
+  "न",
+  "परेका",
+  "कायम",
+  "महानायक",
+  "वर्षको",
+  "गरिने",
+  "विश्वास",
+  "देखिएको",
+  "बढेको",
+  "पूर्वप्रहरी",
+  "त्यहाँ",
+  "अच्युतकृष्ण",
+  "परिवर्तन",
+  "हमालसंगको",
+  "भन्छन्",
+  "अर्थ",
+  "लोकतान्त्रिक",
+  "होला",
+  "पक्षमा",
+  "सेना",
+  "यसरी",
+  "फिर्ता",
+  "११",
+  "व्यक्त",
+  "पाउने",
+  "यसअघि",
+  "प्रयास",
+  "दिए",
+  "नीति",
+  "रन",
+  "फिल्म",
+  "उनीहरूले",
+  "at",
+  "खेलमा",
+  "गम्भीर",
+  "स्पष्ट",
+  "देशको",
+  "भूमिका",
+  "यस्तै",
+  "सहमतिको",
+  "बाटो",
+  "कति",
+  "भनाइ",
+  "त्यस्तो",
+  "सडक",
+  "सचिव",
+  "गरिरहेका",
+  "आफूलाई",
+  "२५",
+  "प्रस्तुत",
+  "देशमा",
+  "जान",
+  "बाहिर",
+  "ठाउँमा",
+  "माओवादीको",
+  "जनता",
+  "स्थापना",
+  "पार्टीको",
+  "नसक्ने",
+  "९",
+  "आफू",
+  "निजी",
+  "उनीहरू",
+  "बिहान",
+  "राजनीति",
+  "कसैले",
+  "संविधानसभाको",
+  "दिनमा",
+  "उद्योग",
+  "सात",
+  "फर्काउनुस्",
+  "हरेक",
+  "अरू",
+  "सामान्य",
+  "सकिन्छ",
+  "त्यसलाई",
+  "पानी",
+  "घरमा",
+  "कारबाही",
+  "यसमा",
+  "महिना",
+  "अर्ब",
+  "संयुक्त",
+  "स्थानमा",
+  "पछिल्लो",
+  "विवाद",
+  "तयारी",
+  "जनताले",
+  "धारणा",
+  "रु",
+  "नसकेको",
+  "विद्यार्थी",
+  "बजारमा",
+  "पहिले",
+  "बस्ने",
+  "छैनन्।",
+  "३०",
+  "नेतृत्वमा",
+  "विश्व",
+  "जातीय",
+  "विचार",
+  "नि",
+  "अहिलेको",
+  "लिने",
+  "जिल्लामा",
+  "लिएको",
+  "जति",
+  "बनाएको",
+  "समितिले",
+  "स्वास्थ्य",
+  "समाधान",
+  "श्रेष्ठ",
+  "मुद्दा",
+  "अध्ययन",
+  "पूर्व",
+  "पुगेका",
+  "तेस्रो",
+  "संविधानसभा",
+  "गरिरहेको",
+  "आफूले",
+  "सम्म",
+  "विदेशी",
+  "हाल",
+  "घाइते",
+  "हुनेछ।",
+  "घटना",
+  "बजार",
+  "बताउँदै",
+  "जस्ता",
+  "स्थिति",
+  "सम्भावना",
+  "प्रवेश",
+  "हत्या",
+  "श्रेष्ठले",
+  "राख्ने",
+  "बनाएर",
+  "उसले",
+  "ध्यान",
+  "भारतको",
+  "हुँदैन",
+  "सकिने",
+  "वर्तमान",
+  "भन्न",
+  "दलको",
+  "विकल्प",
+  "बन्ने",
+  "मुलुकमा",
+  "समितिको",
+  "खेलाडी",
+  "कतिपय",
+  "उपचार",
+  "राजा",
+  "एकीकृत",
+  "निर्देशन",
+  "प्रदान",
+  "यसका",
+  "युवा",
+  "सोमबार",
+  "आइतबार",
+  "उपलब्ध",
+  "फरक",
+  "हात",
+  "अमेरिकी",
+  "वातावरण",
+  "पर्यटन",
+  "अहिलेसम्म",
+  "थालेको",
+  "छैनन्",
+  "आउन",
+  "भइसकेको",
+  "पाएको",
+  "कर्मचारी",
+  "जस्तै",
+  "मुलुकको",
+  "अनुसन्धान",
+  "विरोध",
+  "उनीहरूको",
+  "त्यसमा",
+  "सम्बन्ध",
+  "राखेर",
+  "आधार",
+  "छु",
+  "गराउन",
+  "जेठ",
+  "बैंक",
+  "बसेको",
+  "समाज",
+  "अझ",
+  "समाचार",
+  "बैठकले",
+  "जिम्मेवारी",
+  "लाई",
+  "सभापति",
+  "संवैधानिक",
+  "बुधबार",
+  "प्रश्न",
+  "१६",
+  "अधिकांश",
+  "चुनाव",
+  "व्यवस्थापन",
+  "अधिकारी",
+  "मुलुक",
+  "बाबुराम",
+  "निर्देशक",
+  "बिक्री",
+  "सम्पूर्ण",
+  "तत्काल",
+  "शुक्रबार",
+  "सत्ता",
+  "राज्यको",
+  "कमजोर",
+  "जरुरी",
+  "लाग्ने",
+  "पुनः",
+  "प्रदर्शन",
+  "कार्यान्वयन",
+  "जीवन",
+  "संख्या",
+  "सालमा",
+  "१३",
+  "जे",
+  "पर्छ",
+  "होइन।",
+  "सकिन्छ।",
+  "दैनिक",
+  "रहने",
+  "एउटै",
+  "उपाध्यक्ष",
+  "देखिन्छ।",
+  "टोली",
+  "परे",
+  "म्याद",
+  "आगामी",
+  "समितिका",
+  "कोही",
+  "सम्झौता",
+  "यति",
+  "व्यक्ति",
+  "जोड",
+  "शनिबार",
+  "ठूला",
+  "गराउने",
+  "हुनुपर्ने",
+  "भट्टराईले",
+  "सशस्त्र",
+  "१८",
+  "प्रतिक्रिया",
+  "समायोजन",
+  "त्यति",
+  "2010",
+  "शक्ति",
+  "भई",
+  "सम्बन्धित",
+  "अरु",
+  "उसको",
+  "सञ्चार",
+  "भनी",
+  "बजे",
+  "पार्टीका",
+  "अवसर",
+  "दाहालले",
+  "पूर्ण",
+  "राखेको",
+  "कोइराला",
+  "संलग्न",
+  "जसले",
+  "दिएर",
+  "उनीहरुले",
+  "दक्षिण",
+  "संसदीय",
+  "गर्नुभएको",
+  "स्थापित",
+  "जिल्लाको",
+  "कोइरालाले",
+  "सरकारमा",
+  "बिहीबार",
+  "सरकारलाई",
+  "क्षेत्रको",
+  "थिएन",
+  "बाट",
+  "जग्गा",
+  "चलचित्र",
+  "अस्पताल",
+  "बताउँछन्।",
+  "ल्याउन",
+  "जनतालाई",
+  "सकारात्मक",
+  "अन्त्य",
+  "भाषा",
+  "कहिले",
+  "सोही",
+  "सम्मान",
+  "सुधार",
+  "आवश्यकता",
+  "गीत",
+  "गएका",
+  "पक्ष",
+  "४०",
+  "कृषि",
+  "हामीलाई",
+  "आन्तरिक",
+  "संस्था",
+  "पाएका",
+  "लक्ष्य",
+  "भाग",
+  "मान्छे",
+  "थिएन।",
+  "सहज",
+  "समूह",
+  "बाध्य",
+  "वृद्धि",
+  "छन",
+  "१९",
+  "प्रत्येक",
+  "हाम्रा",
+  "या",
+  "गाउँ",
+  "राख्न",
+  "माथि",
+  "तर्फबाट",
+  "फैसला",
+  "प्रधान",
+  "दाहाल",
+  "थालेका",
+  "निम्ति",
+  "गर्छ",
+  "दर्ता",
+  "भट्टराई",
+  "विकेट",
+  "प्रभावित",
+  "विद्यालय",
+  "मंगलबार",
+  "गाडी",
+  "काठमाडौँ",
+  "बसेर",
+  "सूचना",
+  "सम्बोधन",
+  "देखिन्छ",
+  "लाग्छ",
+  "कुरामा",
+  "यसै",
+  "प्रभाव",
+  "थापा",
+  "क्षेत्रका",
+  "भए।",
+  "अफ",
+  "गएर",
+  "हुँदैन।",
+  "हुनेछ",
+  "देशका",
+  "अधिकारीले",
+  "पुग्ने",
+  "कारोबार",
+  "मधेसी",
+  "अदालतको",
+  "१७",
+  "माओवादीका",
+  "शासन",
+  "सबैले",
+  "रहेछ",
+  "नियन्त्रण",
+  "जो",
+  "हुन्छन्",
+  "थापाले",
+  "सुविधा",
+  "त्यसका",
+  "सिर्जना",
+  "बताउनुभयो।",
+  "टोलीले",
+  "२२",
+  "हतियार",
+  "प्रहार",
+  "आयोजित",
+  "मत",
+  "यादवले",
+  "आठ",
+  "वन",
+  "प्रधानमन्त्रीको",
+  "सक्छ।",
+  "खनालले",
+  "तत्कालीन",
+  "कस्तो",
+  "गलत",
+  "शुरु",
+  "कहिल्यै",
+  "वर्षमा",
+  "बनेका",
+  "हरियो",
+  "राजीनामा",
+  "असर",
+  "बैंकले",
+  "पहिचान",
+  "राजनीतिमा",
+  "गर्नुभयो",
+  "आचार्य",
+  "नभए",
+  "नभई",
+  "वितरण",
+  "लागेका",
+  "सेयर",
+  "त्यसले",
+  "गर्छन्",
+  "अनुभव",
+  "गर्नुपर्छ",
+  "कुन",
+  "सानो",
+  "संविधानको",
+  "भनेका",
+  "दस",
+  "जनाको",
+  "नेतृत्वको",
+  "भएन",
+  "अन्तरिम",
+  "मिनेटमा",
+  "कार्यकारी",
+  "त्यसो",
+  "दबाब",
+  "कानुन",
+  "संरक्षण",
+  "अभाव",
+  "PM",
+  "स्थान",
+  "समर्थन",
+  "अवसरमा",
+  "सक्रिय",
+  "यसैगरी",
+  "कार्यालयमा",
+  "राखेका",
+  "वाणिज्य",
+  "सुझाव",
+  "कारणले",
+  "केन्द्र",
+  "अनुमान",
+  "महत्वपूर्ण",
+  "सम्भव",
+  "लिएका",
+  "पराजित",
+  "उहाँको",
+  "चाहिँ",
+  "पार्न",
+  "कम्पनीले",
+  "प्रकाशित",
+  "२१",
+  "दलले",
+  "२४",
+  "सबैलाई",
+  "गरेकी",
+  "पार्ने",
+  "ल्याउने",
+  "गुनासो",
+  "गोली",
+  "राखिएको",
+  "पहल",
+  "दिइएको",
+  "माओवादीलाई",
+  "६०",
+  "अर्थात्",
+  "स्थायी",
+  "छोरा",
+  "आशा",
+  "महासचिव",
+  "ऋण",
+  "पार्टीले",
+  "स्वतन्त्र",
+  "व्यापार",
+  "आएर",
+  "नगर्ने",
+  "हेर्दा",
+  "ठाउँ",
+  "पौडेलले",
+  "दिँदै",
+  "गरिएका",
+  "निश्चित",
+  "नेपाललाई",
+  "पाउन",
+  "जाँदा",
+  "कार्यकर्ता",
+  "आक्रमण",
+  "प्रधानमन्त्रीले",
+  "सही",
+  "माघ",
+  "सेनाको",
+  "पुष्पकमल",
+  "वार्ता",
+  "हुनुपर्छ",
+  "सबैको",
+  "उत्पन्न",
+  "होस्",
+  "प्रत्यक्ष",
+  "बसेका",
+  "बढाउन",
+  "वरिष्ठ",
+  "कम्पनी",
+  "काममा",
+  "चर्चा",
+  "राति",
+  "पुरानो",
+  "आदि",
+  "अधिकृत",
+  "थुप्रै",
+  "ज्यान",
+  "ऊ",
+  "कर",
+  "उहाँ",
+  "सम्बन्धमा",
+  "जम्मा",
+  "सहभागिता",
+  "अस्पतालमा",
+  "भ्रमण",
+  "मन्त्रालय",
+  "हेर्न",
+  "मान्यता",
+  "बलियो",
+  "वर्षअघि",
+  "नपरे",
+  "उत्कृष्ट",
+  "उपयुक्त",
+  "नगरी",
+  "भारतमा",
+  "चासो",
+  "लगाउने",
+  "बस्न",
+  "वित्तीय",
+  "भित्र",
+  "प्रतिवेदन",
+  "कानुनी",
+  "क्षमता",
+  "सीमित",
+  "उचित",
+  "कडा",
+  "पारेको",
+  "पुरस्कार",
+  "प्रशासन",
+  "मानव",
+  "बढ्न",
+  "साना",
+  "प्रतियोगितामा",
+  "लगाएर",
+  "नियन्त्रणमा",
+  "खुला",
+  "यदि",
+  "क्षेत्रीय",
+  "निर्माणका",
+  "विस्तार",
+  "अभियान",
+  "बढ्ने",
+  "मिलेर",
+  "लगायतका",
+  "मूल",
+  "रातोः",
+  "बढ्दै",
+  "पारित",
+  "विदेश",
+  "अघिल्लो",
+  "बनाएका",
+  "भएपनि",
+  "निर्माणको",
+  "स्वीकार",
+  "बरु",
+  "असफल",
+  "मन्त्रालयले",
+  "परीक्षा",
+  "परिवार",
+  "लागू",
+  "ल्याएको",
+  "संघ",
+  "प्रहरीको",
+  "जवाफ",
+  "निर्वाचित",
+  "हासिल",
+  "0",
+  "कतै",
+  "यात्रा",
+  "सैनिक",
+  "एकै",
+  "प्रशिक्षक",
+  "दिनुभयो",
+  "गुरुङ",
+  "प्रतिबद्धता",
+  "तय",
+  "सर्वोच्च",
+  "नेताले",
+  "दिनु",
+  "त्यस्ता",
+  "शर्माले",
+  "सडकमा",
+  "पुग्न",
+  "खान",
+  "गाउँमा",
+  "गर्छन्।",
+  "निर्वाचनमा",
+  "साता",
+  "२८",
+  "छौं",
+  "फुटबल",
+  "संयोजक",
+  "दलहरू",
+  "समाजमा",
+  "राजधानी",
+  "उनीहरूलाई",
+  "२७",
+  "आयोग",
+  "पर्छ।",
+  "हैन",
+  "२३",
+  "वर्षदेखि",
+  "फागुन",
+  "किनभने",
+  "कार्यरत",
+  "आन्दोलनमा",
+  "तर्क",
+  "नेताहरूले",
+  "गर्‍यो",
+  "निर्माणमा",
+  "सवारी",
+  "शीर्ष",
+  "भएकोले",
+  "प्रवक्ता",
+  "आमा",
+  "जब",
+  "दैनिकी",
+  "प्राविधिक",
+  "हिजो",
+  "भनिन्",
+  "२६",
+  "योगदान",
+  "नियमित",
+  "संघका",
+  "गर्छ।",
+  "कुल",
+  "गाविस",
+  "उनीहरु",
+  "यसबाट",
+  "भन्नुभयो",
+  "सजिलो",
+  "व्यक्तिगत",
+  "उपाधि",
+  "प्रचण्ड",
+  "मुक्त",
+  "दलित",
+  "फाइदा",
+  "संकलन",
+  "प्रभावकारी",
+  "शर्मा",
+  "यादव",
+  "सामान",
+  "पत्र",
+  "पुरुष",
+  "अमेरिका",
+  "चीन",
+  "एमालेले",
+  "सीमा",
+};
+const uint16_t WA_FREQ_116_RANKS[] = {
+  883, 988, 0, 0, 409, 0, 0, 0, 0, 0, 0, 0, 303, 682, 0, 761,
+  996, 0, 0, 220, 596, 664, 398, 0, 0, 999, 0, 0, 0, 0, 0, 0,
+  80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 191, 0, 0, 0, 640, 750, 0, 595, 0, 618, 54, 0, 189,
+  0, 0, 122, 37, 207, 726, 863, 0, 671, 487, 0, 318, 0, 0, 546, 0,
+  232, 470, 537, 890, 0, 0, 123, 738, 0, 0, 0, 270, 0, 0, 0, 925,
+  0, 0, 629, 0, 0, 0, 88, 0, 0, 0, 458, 0, 0, 0, 0, 0,
+  0, 0, 258, 615, 0, 0, 0, 0, 151, 500, 0, 0, 0, 0, 0, 0,
+  248, 0, 327, 483, 683, 563, 0, 943, 582, 0, 249, 711, 509, 0, 0, 0,
+  0, 0, 0, 606, 977, 622, 0, 0, 51, 0, 114, 0, 0, 0, 0, 0,
+  590, 867, 0, 213, 244, 0, 0, 0, 0, 0, 0, 529, 0, 0, 0, 0,
+  681, 320, 0, 937, 0, 0, 0, 0, 0, 0, 0, 336, 230, 227, 759, 540,
+  212, 257, 465, 598, 638, 130, 689, 719, 779, 654, 773, 780, 799, 806, 816, 400,
+  612, 670, 903, 375, 841, 950, 963, 964, 0, 0, 0, 101, 551, 432, 0, 0,
+  0, 566, 76, 266, 932, 198, 605, 823, 0, 45, 0, 0, 0, 0, 361, 574,
+  0, 589, 302, 0, 853, 0, 0, 0, 0, 90, 661, 0, 0, 0, 657, 765,
+  0, 397, 0, 0, 815, 0, 239, 520, 0, 512, 0, 0, 0, 0, 730, 0,
+  832, 741, 846, 0, 163, 0, 0, 13, 0, 0, 0, 200, 0, 0, 503, 0,
+  0, 548, 829, 0, 739, 904, 181, 0, 289, 0, 0, 648, 554, 578, 604, 429,
+  480, 552, 562, 140, 850, 921, 0, 0, 0, 228, 0, 0, 0, 127, 631, 0,
+  110, 0, 0, 177, 0, 0, 0, 637, 0, 0, 0, 0, 0, 0, 0, 435,
+  0, 0, 0, 621, 0, 182, 444, 675, 28, 775, 579, 807, 837, 827, 412, 997,
+  0, 0, 786, 180, 0, 0, 712, 0, 0, 72, 0, 553, 791, 0, 573, 592,
+  0, 436, 0, 7, 210, 559, 911, 491, 835, 87, 643, 754, 840, 878, 0, 0,
+  0, 0, 727, 221, 0, 0, 226, 0, 0, 362, 280, 969, 659, 645, 171, 245,
+  0, 0, 0, 571, 0, 0, 0, 0, 286, 356, 686, 844, 373, 692, 297, 942,
+  794, 0, 223, 865, 884, 267, 0, 138, 445, 0, 0, 0, 283, 626, 0, 0,
+  0, 0, 749, 888, 488, 0, 0, 0, 930, 0, 0, 16, 0, 0, 0, 0,
+  0, 0, 696, 0, 345, 253, 47, 261, 913, 872, 0, 0, 0, 0, 358, 922,
+  0, 0, 319, 824, 859, 986, 40, 747, 655, 250, 518, 0, 384, 906, 960, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 464, 979, 203, 0, 0, 0, 560, 946,
+  22, 443, 0, 308, 116, 419, 778, 917, 978, 0, 60, 0, 71, 0, 0, 729,
+  939, 0, 672, 662, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 461, 934, 507, 0, 0, 0, 0, 0, 338, 4, 234, 67, 254, 12,
+  510, 849, 971, 0, 0, 474, 0, 0, 225, 0, 363, 538, 0, 0, 0, 891,
+  0, 0, 0, 0, 0, 0, 965, 0, 962, 0, 0, 842, 431, 0, 81, 0,
+  731, 0, 0, 948, 0, 0, 300, 952, 184, 717, 555, 908, 0, 0, 0, 0,
+  0, 324, 0, 0, 0, 0, 0, 0, 580, 0, 0, 325, 91, 812, 887, 602,
+  0, 0, 0, 736, 851, 0, 0, 866, 0, 0, 211, 521, 892, 121, 0, 0,
+  0, 128, 0, 312, 394, 0, 0, 0, 0, 115, 0, 0, 344, 10, 721, 408,
+  32, 97, 269, 457, 475, 968, 970, 0, 0, 153, 111, 159, 441, 103, 0, 0,
+  38, 0, 259, 135, 263, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  278, 623, 787, 0, 949, 0, 0, 831, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 199, 627, 0, 523, 0, 0, 0, 774, 0, 0, 309, 98, 506, 725, 768,
+  233, 307, 468, 315, 0, 0, 766, 795, 0, 0, 0, 576, 0, 0, 0, 0,
+  0, 0, 556, 335, 792, 704, 701, 0, 743, 0, 0, 0, 23, 311, 0, 0,
+  0, 0, 0, 0, 453, 0, 0, 0, 679, 149, 680, 987, 237, 168, 414, 0,
+  0, 0, 0, 785, 825, 0, 348, 0, 639, 810, 0, 0, 322, 0, 0, 0,
+  0, 0, 396, 514, 871, 0, 873, 0, 584, 914, 0, 564, 935, 0, 625, 0,
+  958, 133, 174, 533, 821, 129, 331, 522, 288, 64, 877, 954, 972, 499, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 490, 0, 718, 0, 187, 0, 0, 0,
+  0, 0, 0, 0, 0, 172, 519, 0, 0, 473, 577, 667, 301, 0, 0, 0,
+  830, 534, 346, 0, 0, 597, 694, 0, 0, 583, 0, 0, 352, 0, 961, 870,
+  0, 152, 0, 251, 677, 0, 0, 0, 482, 376, 0, 70, 125, 217, 905, 885,
+  923, 0, 0, 0, 273, 0, 360, 855, 0, 0, 0, 0, 236, 380, 316, 186,
+  467, 826, 0, 0, 0, 169, 349, 0, 341, 953, 0, 328, 544, 0, 0, 0,
+  517, 0, 0, 0, 0, 0, 0, 0, 0, 0, 644, 0, 0, 0, 0, 0,
+  0, 975, 876, 48, 440, 484, 705, 0, 0, 0, 0, 527, 603, 0, 0, 0,
+  0, 386, 0, 0, 0, 471, 532, 0, 0, 0, 652, 0, 0, 0, 0, 981,
+  282, 190, 260, 314, 983, 157, 0, 860, 0, 902, 0, 0, 99, 0, 674, 0,
+  18, 0, 0, 0, 173, 0, 0, 0, 772, 0, 96, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 834, 893, 515, 0, 0, 0, 379, 0, 0, 0,
+  0, 0, 0, 0, 86, 160, 0, 0, 24, 104, 808, 817, 183, 0, 69, 994,
+  0, 0, 0, 0, 0, 0, 0, 633, 0, 0, 0, 0, 588, 0, 0, 0,
+  751, 383, 0, 0, 0, 447, 585, 78, 306, 591, 688, 118, 611, 744, 0, 0,
+  0, 0, 0, 715, 31, 0, 0, 528, 0, 800, 974, 0, 50, 0, 0, 0,
+  30, 366, 0, 669, 112, 0, 802, 926, 0, 145, 479, 0, 0, 0, 0, 0,
+  0, 0, 746, 0, 879, 0, 402, 609, 0, 531, 748, 789, 0, 0, 0, 0,
+  353, 0, 195, 0, 0, 0, 0, 0, 0, 0, 148, 334, 897, 0, 909, 0,
+  0, 229, 516, 124, 0, 0, 691, 100, 36, 0, 614, 797, 489, 0, 0, 0,
+  0, 874, 242, 945, 632, 0, 0, 0, 113, 635, 676, 0, 170, 561, 156, 141,
+  769, 449, 0, 430, 929, 390, 951, 291, 0, 194, 0, 495, 572, 27, 956, 501,
+  0, 0, 143, 586, 737, 783, 0, 17, 0, 0, 0, 215, 699, 0, 347, 793,
+  0, 0, 0, 0, 0, 0, 0, 0, 796, 262, 814, 0, 0, 0, 0, 0,
+  0, 0, 0, 381, 811, 875, 990, 0, 0, 0, 295, 697, 0, 0, 0, 0,
+  660, 763, 508, 757, 864, 428, 941, 0, 0, 858, 993, 117, 0, 5, 653, 74,
+  0, 620, 378, 557, 587, 695, 833, 0, 1, 107, 450, 387, 822, 0, 0, 359,
+  63, 0, 758, 0, 0, 820, 0, 405, 247, 788, 209, 936, 991, 452, 0, 0,
+  0, 928, 0, 15, 139, 530, 777, 720, 854, 0, 0, 370, 0, 0, 801, 0,
+  687, 959, 0, 369, 0, 575, 0, 411, 568, 0, 0, 525, 0, 752, 513, 0,
+  0, 11, 649, 798, 0, 94, 647, 0, 0, 0, 0, 0, 351, 415, 957, 0,
+  165, 438, 167, 3, 0, 0, 0, 0, 0, 85, 698, 710, 406, 651, 732, 910,
+  0, 0, 0, 265, 293, 0, 753, 927, 0, 0, 0, 0, 665, 0, 0, 0,
+  0, 0, 0, 0, 0, 819, 62, 690, 0, 0, 463, 0, 401, 0, 77, 973,
+  136, 185, 193, 255, 299, 838, 896, 0, 0, 0, 79, 0, 918, 374, 0, 898,
+  455, 0, 142, 0, 0, 0, 371, 292, 442, 460, 734, 0, 154, 770, 0, 0,
+  0, 0, 617, 89, 496, 0, 569, 0, 0, 0, 342, 0, 0, 0, 0, 0,
+  0, 0, 852, 337, 0, 0, 813, 0, 272, 131, 790, 43, 616, 296, 707, 56,
+  448, 355, 733, 839, 0, 0, 119, 0, 0, 0, 218, 982, 0, 317, 469, 41,
+  284, 0, 155, 0, 0, 0, 0, 995, 804, 0, 599, 723, 459, 0, 235, 0,
+  0, 0, 0, 395, 205, 388, 434, 526, 0, 0, 702, 550, 984, 93, 0, 0,
+  0, 175, 275, 524, 0, 0, 0, 161, 274, 706, 0, 912, 0, 0, 0, 0,
+  25, 0, 836, 134, 601, 0, 0, 0, 0, 895, 49, 120, 105, 197, 403, 271,
+  502, 610, 34, 416, 0, 437, 0, 0, 0, 0, 0, 0, 0, 0, 0, 907,
+  713, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 332, 607, 916, 216, 333, 868, 742, 0, 222, 947, 0, 53, 0, 0, 542,
+  0, 856, 0, 0, 0, 0, 0, 0, 0, 0, 44, 494, 0, 164, 0, 0,
+  0, 433, 545, 0, 0, 0, 0, 685, 57, 0, 0, 192, 410, 980, 966, 2,
+  0, 0, 0, 298, 869, 0, 385, 0, 613, 304, 343, 75, 350, 202, 619, 82,
+  150, 329, 277, 354, 931, 0, 0, 511, 0, 0, 0, 0, 0, 497, 881, 0,
+  0, 68, 179, 0, 208, 630, 0, 0, 61, 0, 0, 803, 0, 493, 0, 0,
+  0, 709, 9, 268, 901, 0, 0, 976, 0, 0, 477, 42, 0, 0, 0, 0,
+  323, 0, 0, 0, 0, 0, 0, 0, 0, 446, 58, 636, 0, 0, 0, 900,
+  0, 762, 0, 0, 321, 809, 0, 0, 641, 0, 241, 0, 417, 0, 0, 481,
+  0, 393, 439, 365, 0, 0, 0, 0, 716, 391, 26, 0, 0, 0, 421, 608,
+  0, 646, 0, 0, 0, 0, 14, 535, 642, 0, 543, 0, 20, 0, 102, 424,
+  377, 724, 894, 0, 0, 0, 0, 539, 0, 0, 0, 0, 201, 684, 0, 0,
+  0, 581, 0, 624, 456, 0, 0, 389, 0, 0, 0, 52, 243, 818, 549, 989,
+  992, 310, 83, 0, 404, 1000, 137, 0, 0, 0, 0, 252, 281, 84, 313, 466,
+  486, 668, 0, 0, 570, 666, 678, 0, 998, 0, 0, 413, 462, 845, 848, 0,
+  0, 673, 0, 0, 880, 0, 407, 0, 703, 0, 0, 0, 0, 0, 420, 126,
+  0, 0, 339, 0, 35, 0, 924, 0, 0, 451, 39, 0, 0, 0, 0, 722,
+  8, 735, 781, 0, 0, 0, 65, 0, 399, 0, 422, 0, 206, 279, 423, 285,
+  425, 0, 0, 0, 166, 650, 0, 760, 0, 0, 0, 476, 756, 0, 0, 0,
+  0, 0, 158, 224, 276, 364, 492, 567, 771, 426, 0, 176, 0, 29, 372, 294,
+  73, 728, 899, 920, 755, 256, 985, 0, 0, 0, 0, 0, 663, 204, 828, 0,
+  0, 0, 238, 0, 0, 547, 46, 628, 634, 0, 0, 106, 0, 0, 847, 357,
+  0, 0, 0, 231, 0, 0, 0, 162, 246, 196, 0, 0, 944, 0, 326, 0,
+  264, 919, 558, 0, 0, 0, 0, 95, 0, 367, 0, 0, 0, 0, 330, 933,
+  0, 0, 340, 392, 472, 504, 0, 0, 0, 427, 0, 700, 0, 0, 0, 0,
+  805, 0, 0, 290, 593, 658, 0, 0, 478, 0, 0, 861, 0, 108, 594, 776,
+  66, 882, 0, 505, 767, 0, 132, 240, 915, 955, 764, 0, 940, 0, 0, 0,
+  33, 0, 0, 938, 0, 708, 55, 59, 146, 0, 0, 188, 19, 0, 0, 0,
+  0, 0, 0, 0, 0, 889, 0, 0, 0, 0, 382, 485, 600, 109, 0, 0,
+  144, 541, 0, 782, 0, 0, 656, 0, 843, 0, 214, 287, 745, 0, 498, 0,
+  0, 862, 0, 0, 0, 0, 418, 784, 219, 967, 0, 0, 368, 0, 454, 0,
+  693, 21, 147, 857, 0, 565, 0, 0, 0, 0, 178, 536, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 714, 0, 0, 0, 92, 886, 6, 740, 305,
+};
+
+const char *WA_FREQ_117_TOKENS[] = {
+  "ik",
+  "je",
+  "het",
+  "de",
+  "dat",
+  "is",
+  "een",
+  "niet",
+  "en",
+  "van",
+  "wat",
+  "we",
+  "in",
+  "ze",
+  "hij",
+  "te",
+  "zijn",
+  "op",
+  "maar",
+  "er",
+  "met",
+  "voor",
+  "die",
+  "heb",
+  "me",
+  "als",
+  "was",
+  "ben",
+  "om",
+  "dit",
+  "mijn",
+  "aan",
+  "u",
+  "dan",
+  "n",
+  "naar",
+  "weet",
+  "hier",
+  "zo",
+  "jij",
+  "kan",
+  "geen",
+  "nog",
+  "ja",
+  "hem",
+  "heeft",
+  "wel",
+  "moet",
+  "wil",
+  "hebben",
+  "goed",
+  "haar",
+  "nee",
+  "hoe",
+  "nu",
+  "waar",
+  "over",
+  "ook",
+  "doen",
+  "uit",
+  "zou",
+  "ga",
+  "of",
+  "gaan",
+  "bent",
+  "mij",
+  "bij",
+  "al",
+  "ons",
+  "had",
+  "iets",
+  "daar",
+  "jullie",
+  "gaat",
+  "zal",
+  "m",
+  "hebt",
+  "kom",
+  "waarom",
+  "meer",
+  "deze",
+  "moeten",
+  "t",
+  "laat",
+  "kunnen",
+  "dus",
+  "jou",
+  "denk",
+  "wie",
+  "alles",
+  "echt",
+  "doe",
+  "door",
+  "alleen",
+  "s",
+  "toch",
+  "zien",
+  "weg",
+  "eens",
+  "man",
+  "misschien",
+  "laten",
+  "nooit",
+  "nou",
+  "zei",
+  "terug",
+  "oké",
+  "mee",
+  "niets",
+  "iemand",
+  "komt",
+  "toen",
+  "veel",
+  "even",
+  "onze",
+  "gewoon",
+  "weten",
+  "komen",
+  "nodig",
+  "mensen",
+  "tot",
+  "worden",
+  "zeggen",
+  "tijd",
+  "weer",
+  "leven",
+  "twee",
+  "net",
+  "tegen",
+  "maken",
+  "uw",
+  "zeg",
+  "omdat",
+  "zit",
+  "wordt",
+  "z",
+  "hou",
+  "kijk",
+  "heel",
+  "wij",
+  "altijd",
+  "mag",
+  "gedaan",
+  "dood",
+  "zeker",
+  "af",
+  "jaar",
+  "hun",
+  "wilde",
+  "dag",
+  "allemaal",
+  "jouw",
+  "huis",
+  "dacht",
+  "doet",
+  "vader",
+  "kunt",
+  "wacht",
+  "zie",
+  "vrouw",
+  "keer",
+  "andere",
+  "zoals",
+  "zij",
+  "dank",
+  "anders",
+  "geef",
+  "waren",
+  "willen",
+  "zich",
+  "bedankt",
+  "één",
+  "mr",
+  "erg",
+  "wilt",
+  "praten",
+  "spijt",
+  "geld",
+  "kon",
+  "werk",
+  "oh",
+  "iedereen",
+  "beter",
+  "werd",
+  "moeder",
+  "niemand",
+  "vinden",
+  "staat",
+  "gezien",
+  "niks",
+  "binnen",
+  "zitten",
+  "zullen",
+  "na",
+  "helpen",
+  "wist",
+  "vind",
+  "genoeg",
+  "sorry",
+  "vast",
+  "elkaar",
+  "ging",
+  "uur",
+  "klaar",
+  "hele",
+  "neem",
+  "leuk",
+  "natuurlijk",
+  "alle",
+  "god",
+  "maak",
+  "lang",
+  "kwam",
+  "graag",
+  "hé",
+  "toe",
+  "drie",
+  "zegt",
+  "bedoel",
+  "deed",
+  "dingen",
+  "maakt",
+  "alsjeblieft",
+  "eerste",
+  "krijgen",
+  "zonder",
+  "steeds",
+  "hallo",
+  "houden",
+  "vertellen",
+  "ziet",
+  "idee",
+  "geven",
+  "achter",
+  "geweest",
+  "blijven",
+  "helemaal",
+  "mooi",
+  "onder",
+  "kijken",
+  "zag",
+  "goede",
+  "naam",
+  "moest",
+  "blijf",
+  "kun",
+  "auto",
+  "luister",
+  "grote",
+  "lijkt",
+  "snel",
+  "ooit",
+  "vragen",
+  "paar",
+  "wanneer",
+  "want",
+  "meneer",
+  "nieuwe",
+  "gebeurd",
+  "zorgen",
+  "vriend",
+  "beetje",
+  "kinderen",
+  "gek",
+  "hand",
+  "vraag",
+  "laatste",
+  "geweldig",
+  "hadden",
+  "zelfs",
+  "enige",
+  "bang",
+  "nemen",
+  "samen",
+  "eten",
+  "o",
+  "zelf",
+  "hoor",
+  "geleden",
+  "staan",
+  "gevonden",
+  "jongen",
+  "denken",
+  "vandaag",
+  "denkt",
+  "beste",
+  "gezegd",
+  "thuis",
+  "wereld",
+  "jongens",
+  "heen",
+  "ken",
+  "hen",
+  "eerst",
+  "eigen",
+  "zoon",
+  "gelijk",
+  "buiten",
+  "vertel",
+  "morgen",
+  "meisje",
+  "probleem",
+  "alsof",
+  "geloof",
+  "halen",
+  "familie",
+  "elke",
+  "zouden",
+  "hoop",
+  "politie",
+  "mannen",
+  "bijna",
+  "vermoord",
+  "eigenlijk",
+  "werken",
+  "verdomme",
+  "horen",
+  "manier",
+  "zat",
+  "vrienden",
+  "precies",
+  "kind",
+  "hè",
+  "kleine",
+  "begrijp",
+  "wou",
+  "geeft",
+  "orde",
+  "houdt",
+  "verder",
+  "vroeg",
+  "stop",
+  "wachten",
+  "rustig",
+  "hoofd",
+  "krijg",
+  "daarom",
+  "gebeurt",
+  "soms",
+  "volgens",
+  "dagen",
+  "vond",
+  "krijgt",
+  "gemaakt",
+  "kant",
+  "werkt",
+  "open",
+  "gehad",
+  "voel",
+  "zaak",
+  "blij",
+  "volgende",
+  "zoek",
+  "kans",
+  "vanavond",
+  "bel",
+  "probeer",
+  "zoeken",
+  "oude",
+  "ding",
+  "moment",
+  "best",
+  "tussen",
+  "plaats",
+  "pas",
+  "gehoord",
+  "vijf",
+  "verteld",
+  "zet",
+  "prima",
+  "hulp",
+  "stad",
+  "vindt",
+  "brengen",
+  "pijn",
+  "slecht",
+  "geloven",
+  "eruit",
+  "minuten",
+  "school",
+  "plan",
+  "broer",
+  "pak",
+  "jezelf",
+  "hoeveel",
+  "kamer",
+  "betekent",
+  "spreken",
+  "juist",
+  "heet",
+  "soort",
+  "haal",
+  "ergens",
+  "vier",
+  "gebruiken",
+  "ligt",
+  "blijft",
+  "welke",
+  "proberen",
+  "dokter",
+  "agent",
+  "help",
+  "later",
+  "voordat",
+  "ogen",
+  "vrij",
+  "klopt",
+  "gaf",
+  "foto",
+  "word",
+  "zodat",
+  "dochter",
+  "problemen",
+  "plek",
+  "water",
+  "kent",
+  "week",
+  "beginnen",
+  "praat",
+  "eerder",
+  "lk",
+  "mis",
+  "handen",
+  "deur",
+  "baby",
+  "bellen",
+  "boven",
+  "groot",
+  "echte",
+  "hoeft",
+  "ie",
+  "doden",
+  "stoppen",
+  "moeilijk",
+  "dr",
+  "sinds",
+  "land",
+  "spelen",
+  "zoveel",
+  "hetzelfde",
+  "mevrouw",
+  "snap",
+  "breng",
+  "pakken",
+  "druk",
+  "verhaal",
+  "lekker",
+  "vrouwen",
+  "schat",
+  "vergeten",
+  "gebeuren",
+  "ervan",
+  "kreeg",
+  "waarschijnlijk",
+  "hoi",
+  "mogelijk",
+  "mooie",
+  "bloed",
+  "wees",
+  "nacht",
+  "nieuws",
+  "bed",
+  "liet",
+  "lopen",
+  "gelukkig",
+  "waarheid",
+  "reden",
+  "papa",
+  "hoorde",
+  "klinkt",
+  "maanden",
+  "vermoorden",
+  "zorg",
+  "dollar",
+  "bezig",
+  "voorbij",
+  "terwijl",
+  "sta",
+  "zaken",
+  "avond",
+  "tien",
+  "schuld",
+  "veilig",
+  "redden",
+  "hart",
+  "zult",
+  "duidelijk",
+  "stel",
+  "the",
+  "schiet",
+  "eraan",
+  "zes",
+  "begin",
+  "gekomen",
+  "vol",
+  "vriendin",
+  "rond",
+  "voelt",
+  "baas",
+  "moord",
+  "ander",
+  "klein",
+  "fijn",
+  "jaren",
+  "mam",
+  "lichaam",
+  "eerlijk",
+  "gezicht",
+  "ver",
+  "wakker",
+  "ouders",
+  "zoiets",
+  "leren",
+  "telefoon",
+  "los",
+  "per",
+  "mama",
+  "nummer",
+  "fout",
+  "mogen",
+  "meteen",
+  "slapen",
+  "zeer",
+  "dezelfde",
+  "liefde",
+  "alstublieft",
+  "deel",
+  "liggen",
+  "erop",
+  "vaak",
+  "vallen",
+  "belangrijk",
+  "sterven",
+  "oud",
+  "neer",
+  "buurt",
+  "langs",
+  "houd",
+  "rest",
+  "stond",
+  "sir",
+  "begrepen",
+  "drinken",
+  "team",
+  "vertelde",
+  "beneden",
+  "vergeet",
+  "vooruit",
+  "mrs",
+  "hoort",
+  "baan",
+  "dicht",
+  "inderdaad",
+  "geval",
+  "zetten",
+  "oorlog",
+  "mezelf",
+  "tijdens",
+  "john",
+  "maakte",
+  "kennen",
+  "gebruikt",
+  "oke",
+  "geluk",
+  "hey",
+  "hield",
+  "wapen",
+  "kop",
+  "vertrouwen",
+  "rust",
+  "mond",
+  "weken",
+  "elk",
+  "betalen",
+  "anderen",
+  "neemt",
+  "recht",
+  "nam",
+  "jack",
+  "kantoor",
+  "gegeven",
+  "ermee",
+  "overal",
+  "eén",
+  "daarna",
+  "tweede",
+  "onderzoek",
+  "welkom",
+  "hard",
+  "liever",
+  "bewijs",
+  "vanaf",
+  "aardig",
+  "klootzak",
+  "stuk",
+  "woord",
+  "veranderen",
+  "zin",
+  "straks",
+  "vent",
+  "zus",
+  "haat",
+  "vandaan",
+  "miss",
+  "lieverd",
+  "zichzelf",
+  "nieuw",
+  "ontmoeten",
+  "werden",
+  "allebei",
+  "minder",
+  "pap",
+  "nergens",
+  "kwaad",
+  "sam",
+  "erin",
+  "ervoor",
+  "kerel",
+  "gisteren",
+  "ontmoet",
+  "miljoen",
+  "ok",
+  "film",
+  "verloren",
+  "probeerde",
+  "gebeld",
+  "new",
+  "antwoord",
+  "noemen",
+  "informatie",
+  "boek",
+  "stil",
+  "kapitein",
+  "kwijt",
+  "enkel",
+  "valt",
+  "boos",
+  "licht",
+  "geworden",
+  "pa",
+  "persoon",
+  "konden",
+  "beschermen",
+  "slechte",
+  "ziekenhuis",
+  "gevoel",
+  "gegaan",
+  "voorzichtig",
+  "hond",
+  "rijden",
+  "eindelijk",
+  "gesproken",
+  "meisjes",
+  "aarde",
+  "ten",
+  "normaal",
+  "grappig",
+  "heren",
+  "voelen",
+  "moordenaar",
+  "mens",
+  "president",
+  "nogal",
+  "gevangenis",
+  "loopt",
+  "degene",
+  "prachtig",
+  "hoezo",
+  "kopen",
+  "vechten",
+  "punt",
+  "vreemd",
+  "trouwen",
+  "contact",
+  "verkeerd",
+  "meen",
+  "koffie",
+  "verwacht",
+  "schip",
+  "ziek",
+  "plezier",
+  "einde",
+  "stap",
+  "advocaat",
+  "begint",
+  "begon",
+  "enkele",
+  "erbij",
+  "gang",
+  "gebeurde",
+  "heer",
+  "herinner",
+  "jezus",
+  "opnieuw",
+  "serieus",
+  "zomaar",
+  "pardon",
+  "gevraagd",
+  "controle",
+  "getrouwd",
+  "daarmee",
+  "spel",
+  "bedoelt",
+  "perfect",
+  "stellen",
+  "juiste",
+  "koning",
+  "beloof",
+  "grond",
+  "waard",
+  "winnen",
+  "nadat",
+  "gebruik",
+  "naartoe",
+  "begrijpen",
+  "veranderd",
+  "acht",
+  "he",
+  "gingen",
+  "kwamen",
+  "leeft",
+  "leg",
+  "gekregen",
+  "langer",
+  "verliezen",
+  "vroeger",
+  "lucht",
+  "wapens",
+  "verlaten",
+  "probeert",
+  "dames",
+  "seks",
+  "schieten",
+  "toekomst",
+  "behalve",
+  "slim",
+  "meest",
+  "stuur",
+  "leger",
+  "woorden",
+  "zeven",
+  "brengt",
+  "charlie",
+  "half",
+  "hierheen",
+  "trots",
+  "spullen",
+  "geheim",
+  "helpt",
+  "vraagt",
+  "michael",
+  "weinig",
+  "ongeveer",
+  "schatje",
+  "sommige",
+  "makkelijk",
+  "kracht",
+  "gedood",
+  "gestolen",
+  "tenminste",
+  "lange",
+  "ongeluk",
+  "frank",
+  "zodra",
+  "werkte",
+  "wilden",
+  "eet",
+  "slechts",
+  "lief",
+  "nietwaar",
+  "relatie",
+  "trek",
+  "afgelopen",
+  "val",
+  "volgen",
+  "ter",
+  "voelde",
+  "bekend",
+  "bewijzen",
+  "hoef",
+  "via",
+  "oom",
+  "loop",
+  "belde",
+  "lijken",
+  "sturen",
+  "men",
+  "slachtoffer",
+  "george",
+  "genomen",
+  "maand",
+  "onzin",
+  "meid",
+  "york",
+  "erger",
+  "idioot",
+  "ziens",
+  "dienst",
+  "erover",
+  "feest",
+  "leek",
+  "vreselijk",
+  "eentje",
+  "gevaar",
+  "wonen",
+  "grootste",
+  "succes",
+  "vertrekken",
+  "jawel",
+  "muziek",
+  "mocht",
+  "raar",
+  "slaap",
+  "joe",
+  "absoluut",
+  "vorige",
+  "ruimte",
+  "ieder",
+  "schuldig",
+  "goeie",
+  "begonnen",
+  "luisteren",
+  "sterk",
+  "omhoog",
+  "totdat",
+  "afspraak",
+  "lezen",
+  "zwarte",
+  "vanwege",
+  "hemel",
+  "tenzij",
+  "gisteravond",
+  "begrijpt",
+  "ene",
+  "lag",
+  "naast",
+  "vooral",
+  "fantastisch",
+  "gered",
+  "viel",
+  "trouwens",
+  "uh",
+  "bank",
+  "pistool",
+  "noem",
+  "bedrijf",
+  "camera",
+  "blijkbaar",
+  "woont",
+  "verkopen",
+  "beide",
+  "zolang",
+  "straat",
+  "mike",
+  "geest",
+  "david",
+  "vuur",
+  "peter",
+  "verkeerde",
+  "moesten",
+  "lieve",
+  "tom",
+  "geprobeerd",
+  "meeste",
+  "kijkt",
+  "stierf",
+  "hotel",
+  "droom",
+  "verliefd",
+  "jammer",
+  "gedacht",
+  "let",
+  "rug",
+  "vertaling",
+  "slaan",
+  "gaten",
+  "doel",
+  "meter",
+  "drugs",
+  "gevaarlijk",
+  "geweldige",
+  "lijst",
+  "fbi",
+  "namen",
+  "deden",
+  "jonge",
+  "schelen",
+  "goedemorgen",
+  "dragen",
+  "iedere",
+  "excuseer",
+  "stom",
+  "jong",
+  "zover",
+  "betaald",
+  "kende",
+  "kleren",
+  "gesprek",
+  "lukt",
+  "welk",
+  "vertelt",
+  "prijs",
+  "voorstellen",
+  "huwelijk",
+  "tv",
+  "missen",
+  "schrijven",
+  "groep",
+  "herinneren",
+  "regels",
+  "vonden",
+  "vliegtuig",
+  "onderweg",
+  "delen",
+  "geleerd",
+  "stomme",
+  "bestaat",
+  "james",
+  "vertrouw",
+  "daarvoor",
+  "shit",
+  "trekken",
+  "zak",
+  "vanuit",
+  "gebracht",
+  "stem",
+  "gezin",
+  "keuze",
+  "raken",
+  "direct",
+  "verdomde",
+  "boot",
+  "dom",
+  "verleden",
+  "gemist",
+  "duurt",
+  "gedachten",
+  "situatie",
+  "moe",
+  "deal",
+  "tafel",
+  "band",
+  "generaal",
+  "reis",
+  "partner",
+  "leuke",
+  "raad",
+  "honger",
+  "geraakt",
+  "gebouw",
+  "zwaar",
+  "gast",
+  "gestuurd",
+  "geboren",
+  "bracht",
+  "rechter",
+  "agenten",
+  "bureau",
+  "macht",
+  "spreek",
+  "derde",
+  "regel",
+  "kolonel",
+  "ruzie",
+  "oma",
+  "zeiden",
+  "speelt",
+  "dronken",
+  "vliegen",
+  "luitenant",
+  "gelooft",
+  "arme",
+  "seconden",
+  "liep",
+  "tuurlijk",
+  "red",
+  "gefeliciteerd",
+  "koud",
+  "regelen",
+  "henry",
+  "bericht",
+  "vlucht",
+  "moeite",
+  "hel",
+  "dame",
+  "oog",
+  "ma",
+  "dansen",
+  "teken",
+  "onmogelijk",
+  "gewerkt",
+  "helaas",
+  "grapje",
+  "arm",
+  "show",
+  "lachen",
+  "leggen",
+  "sleutel",
+  "wet",
+  "liefje",
+};
+const uint16_t WA_FREQ_117_RANKS[] = {
+  0, 899, 423, 0, 0, 719, 0, 483, 518, 0, 785, 142, 373, 449, 499, 504,
+  0, 546, 808, 0, 707, 0, 0, 365, 845, 0, 335, 297, 994, 691, 607, 38,
+  683, 886, 0, 0, 0, 0, 957, 0, 0, 0, 0, 155, 0, 0, 679, 0,
+  0, 0, 531, 0, 0, 0, 0, 0, 0, 97, 0, 786, 708, 0, 477, 712,
+  825, 0, 954, 581, 0, 0, 0, 3, 389, 0, 264, 0, 191, 0, 383, 51,
+  0, 0, 0, 64, 0, 574, 0, 0, 0, 0, 0, 0, 0, 891, 0, 0,
+  0, 232, 0, 0, 500, 908, 0, 769, 0, 369, 972, 0, 0, 8, 770, 0,
+  40, 0, 0, 271, 0, 0, 0, 315, 0, 0, 871, 0, 0, 0, 0, 545,
+  560, 616, 12, 213, 828, 0, 79, 319, 0, 0, 0, 992, 474, 84, 165, 543,
+  613, 633, 0, 0, 632, 0, 0, 802, 838, 0, 281, 239, 325, 909, 576, 0,
+  636, 192, 0, 687, 746, 19, 775, 0, 0, 964, 975, 5, 983, 47, 0, 990,
+  93, 313, 807, 0, 860, 414, 906, 949, 0, 0, 677, 48, 544, 0, 208, 334,
+  629, 736, 927, 0, 0, 0, 0, 0, 0, 0, 0, 0, 487, 849, 0, 730,
+  507, 0, 0, 0, 0, 0, 0, 559, 77, 614, 0, 0, 122, 642, 0, 0,
+  215, 0, 689, 0, 0, 123, 282, 293, 0, 791, 940, 882, 0, 0, 0, 0,
+  0, 600, 0, 0, 440, 547, 354, 558, 0, 0, 0, 0, 0, 336, 412, 0,
+  394, 16, 302, 0, 0, 0, 0, 0, 0, 789, 188, 929, 0, 572, 946, 0,
+  463, 366, 0, 71, 686, 932, 623, 0, 0, 0, 0, 367, 589, 0, 0, 0,
+  827, 0, 0, 0, 0, 0, 0, 649, 536, 0, 0, 284, 0, 0, 228, 470,
+  214, 569, 229, 384, 878, 993, 0, 710, 0, 704, 656, 728, 149, 0, 0, 0,
+  0, 0, 0, 0, 14, 0, 143, 0, 0, 631, 961, 0, 0, 154, 163, 441,
+  272, 291, 353, 468, 395, 317, 443, 314, 671, 684, 779, 96, 805, 349, 820, 979,
+  635, 817, 261, 754, 90, 6, 126, 568, 750, 0, 481, 714, 742, 0, 0, 0,
+  666, 0, 462, 658, 0, 978, 549, 0, 0, 0, 0, 0, 753, 0, 0, 0,
+  0, 341, 0, 438, 0, 0, 10, 0, 0, 826, 716, 184, 0, 0, 0, 428,
+  516, 765, 117, 0, 398, 737, 0, 156, 0, 0, 894, 0, 628, 0, 0, 0,
+  303, 0, 28, 25, 0, 722, 0, 725, 58, 180, 897, 851, 78, 85, 227, 362,
+  0, 0, 332, 0, 0, 0, 0, 0, 0, 0, 0, 118, 494, 0, 885, 696,
+  368, 956, 0, 514, 0, 0, 0, 235, 45, 925, 0, 0, 0, 0, 260, 834,
+  496, 0, 0, 324, 0, 0, 0, 0, 0, 0, 884, 0, 224, 479, 665, 0,
+  0, 359, 772, 113, 984, 348, 0, 811, 263, 951, 943, 0, 0, 256, 89, 0,
+  0, 0, 0, 0, 0, 0, 640, 0, 489, 269, 610, 637, 0, 0, 0, 798,
+  0, 981, 0, 794, 800, 0, 206, 529, 587, 594, 174, 103, 0, 69, 801, 0,
+  221, 0, 647, 0, 0, 0, 0, 0, 0, 0, 458, 44, 273, 476, 938, 0,
+  56, 393, 0, 0, 416, 923, 311, 109, 740, 0, 0, 0, 0, 233, 0, 936,
+  53, 534, 0, 0, 0, 527, 0, 0, 209, 137, 358, 11, 413, 0, 0, 0,
+  0, 0, 530, 792, 0, 182, 0, 268, 461, 46, 128, 237, 522, 783, 455, 35,
+  883, 0, 905, 30, 0, 659, 0, 0, 0, 0, 0, 250, 129, 0, 605, 0,
+  902, 193, 400, 0, 0, 0, 0, 0, 195, 377, 644, 0, 622, 603, 0, 121,
+  942, 0, 62, 0, 0, 0, 846, 0, 604, 693, 157, 344, 283, 327, 824, 248,
+  778, 259, 465, 0, 0, 0, 0, 0, 152, 0, 125, 322, 356, 1000, 0, 0,
+  444, 852, 0, 0, 0, 0, 0, 0, 0, 0, 0, 136, 391, 0, 243, 0,
+  0, 0, 829, 0, 194, 0, 0, 0, 0, 0, 0, 0, 92, 612, 0, 0,
+  0, 0, 921, 0, 0, 661, 0, 0, 0, 0, 974, 351, 966, 782, 100, 0,
+  874, 759, 0, 0, 0, 0, 0, 0, 732, 583, 0, 0, 0, 392, 970, 0,
+  26, 210, 639, 0, 0, 0, 535, 0, 0, 575, 190, 162, 606, 430, 976, 876,
+  201, 0, 0, 0, 0, 0, 655, 329, 454, 0, 0, 0, 831, 0, 0, 0,
+  0, 0, 0, 0, 822, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  101, 660, 692, 0, 0, 23, 524, 703, 158, 803, 0, 0, 301, 390, 360, 0,
+  0, 0, 488, 0, 0, 0, 171, 0, 246, 0, 0, 245, 664, 793, 0, 0,
+  0, 276, 0, 0, 0, 0, 0, 472, 0, 928, 0, 379, 0, 0, 72, 748,
+  601, 0, 0, 333, 0, 0, 0, 0, 0, 102, 0, 0, 0, 0, 0, 299,
+  382, 706, 255, 985, 555, 0, 0, 745, 0, 542, 944, 0, 971, 698, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 396, 760, 0, 0, 515, 207, 371, 864, 678,
+  0, 148, 55, 181, 338, 0, 2, 247, 0, 0, 0, 0, 177, 690, 0, 0,
+  0, 0, 0, 0, 370, 0, 0, 0, 42, 226, 713, 0, 0, 930, 0, 0,
+  91, 0, 131, 567, 417, 523, 361, 931, 478, 211, 988, 0, 0, 968, 0, 0,
+  0, 469, 0, 0, 918, 426, 304, 781, 0, 0, 0, 0, 0, 39, 0, 0,
+  31, 0, 0, 0, 511, 0, 0, 0, 0, 305, 401, 7, 41, 0, 21, 879,
+  0, 0, 0, 557, 135, 0, 0, 0, 0, 0, 787, 0, 0, 0, 0, 0,
+  0, 0, 0, 675, 0, 0, 132, 0, 702, 94, 0, 110, 0, 0, 0, 0,
+  0, 81, 0, 0, 0, 0, 582, 251, 915, 0, 290, 115, 868, 869, 621, 0,
+  735, 342, 168, 815, 0, 346, 295, 0, 875, 711, 720, 0, 634, 0, 485, 0,
+  350, 0, 134, 257, 98, 0, 0, 0, 0, 170, 0, 0, 0, 580, 0, 493,
+  0, 593, 0, 553, 839, 159, 445, 0, 0, 0, 0, 420, 565, 0, 0, 0,
+  0, 0, 0, 199, 694, 947, 0, 893, 873, 0, 95, 280, 490, 0, 592, 861,
+  0, 0, 83, 339, 645, 225, 796, 835, 912, 0, 771, 0, 0, 0, 147, 962,
+  0, 386, 0, 179, 528, 0, 0, 277, 0, 0, 0, 0, 0, 561, 0, 0,
+  399, 0, 266, 166, 701, 810, 0, 0, 0, 1, 0, 372, 900, 945, 453, 0,
+  0, 519, 298, 935, 764, 0, 0, 0, 0, 0, 903, 196, 0, 0, 0, 685,
+  0, 0, 551, 743, 0, 0, 0, 598, 63, 288, 907, 0, 0, 0, 0, 862,
+  0, 0, 437, 0, 538, 0, 0, 330, 726, 0, 892, 953, 99, 0, 15, 0,
+  0, 0, 151, 198, 17, 20, 218, 357, 566, 611, 766, 866, 459, 895, 0, 0,
+  0, 812, 0, 584, 0, 788, 0, 0, 497, 934, 0, 4, 29, 278, 306, 380,
+  0, 202, 585, 967, 0, 0, 836, 267, 0, 169, 0, 0, 724, 0, 0, 0,
+  773, 0, 86, 498, 0, 0, 289, 0, 0, 0, 0, 0, 695, 806, 799, 833,
+  70, 933, 0, 920, 0, 0, 887, 0, 0, 307, 0, 0, 0, 87, 963, 0,
+  0, 816, 57, 473, 673, 0, 0, 0, 397, 0, 120, 0, 0, 0, 0, 223,
+  0, 0, 0, 0, 0, 432, 0, 0, 0, 688, 0, 0, 0, 347, 0, 0,
+  0, 749, 0, 795, 0, 0, 287, 0, 797, 0, 0, 0, 32, 958, 987, 578,
+  776, 448, 0, 595, 941, 0, 508, 0, 320, 105, 505, 627, 0, 0, 952, 279,
+  0, 870, 556, 819, 844, 0, 418, 588, 0, 258, 34, 294, 617, 59, 676, 847,
+  896, 0, 755, 858, 0, 0, 0, 937, 52, 804, 0, 0, 0, 456, 0, 144,
+  0, 0, 0, 300, 630, 889, 0, 533, 491, 757, 492, 0, 0, 0, 0, 410,
+  0, 0, 0, 0, 715, 216, 24, 512, 790, 0, 0, 0, 0, 124, 65, 0,
+  111, 203, 486, 150, 435, 859, 867, 0, 421, 22, 830, 0, 0, 345, 989, 0,
+  0, 0, 0, 0, 0, 175, 388, 0, 364, 0, 0, 0, 0, 0, 231, 0,
+  0, 340, 841, 0, 230, 67, 0, 0, 0, 837, 0, 969, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 68, 270, 0, 0, 0, 0, 286, 442, 61, 186, 973,
+  0, 986, 0, 187, 0, 0, 0, 0, 959, 0, 0, 0, 0, 709, 0, 857,
+  241, 0, 0, 76, 0, 0, 0, 0, 506, 741, 0, 0, 0, 843, 0, 145,
+  33, 734, 999, 0, 0, 0, 0, 0, 521, 0, 919, 0, 669, 854, 409, 0,
+  0, 0, 0, 0, 0, 0, 0, 43, 434, 597, 249, 699, 780, 916, 0, 446,
+  343, 513, 0, 189, 337, 0, 308, 550, 901, 525, 955, 0, 429, 407, 532, 571,
+  0, 75, 0, 777, 0, 562, 768, 0, 296, 744, 0, 403, 526, 0, 160, 161,
+  652, 422, 840, 253, 0, 0, 262, 139, 913, 0, 0, 0, 88, 112, 176, 252,
+  402, 457, 599, 419, 425, 217, 254, 717, 823, 0, 242, 274, 0, 0, 326, 0,
+  0, 0, 657, 0, 424, 316, 18, 212, 832, 761, 965, 80, 0, 0, 0, 602,
+  738, 0, 0, 0, 0, 107, 0, 0, 0, 200, 733, 363, 865, 236, 898, 0,
+  0, 0, 0, 127, 0, 624, 0, 0, 0, 0, 0, 855, 0, 108, 510, 0,
+  0, 0, 520, 0, 0, 818, 0, 814, 0, 618, 0, 700, 60, 751, 0, 0,
+  888, 0, 114, 591, 577, 0, 697, 460, 853, 0, 0, 0, 0, 0, 439, 173,
+  615, 552, 850, 0, 0, 82, 104, 352, 904, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 641, 172, 570, 651, 0, 309, 427, 653, 0, 0, 0,
+  205, 821, 0, 27, 0, 0, 0, 609, 0, 464, 563, 318, 0, 0, 586, 910,
+  0, 0, 0, 0, 0, 0, 503, 0, 0, 739, 374, 0, 856, 727, 0, 0,
+  0, 0, 731, 178, 784, 625, 848, 0, 167, 0, 0, 0, 0, 0, 310, 729,
+  982, 540, 668, 998, 116, 950, 140, 0, 0, 0, 917, 375, 408, 681, 0, 0,
+  312, 0, 0, 0, 292, 0, 863, 0, 0, 648, 0, 0, 0, 0, 0, 130,
+  321, 331, 0, 0, 0, 0, 0, 0, 620, 991, 0, 0, 890, 219, 877, 0,
+  0, 431, 0, 501, 537, 667, 881, 406, 996, 0, 509, 0, 36, 0, 922, 0,
+  328, 9, 0, 0, 0, 0, 244, 164, 204, 643, 995, 0, 0, 0, 482, 0,
+  0, 0, 220, 450, 0, 0, 0, 0, 638, 447, 0, 0, 49, 141, 355, 0,
+  376, 548, 756, 980, 0, 0, 0, 670, 662, 0, 914, 0, 0, 0, 0, 682,
+  0, 0, 0, 539, 0, 0, 0, 222, 238, 0, 0, 0, 0, 924, 133, 948,
+  763, 0, 433, 0, 0, 767, 502, 234, 590, 663, 0, 0, 0, 381, 0, 579,
+  619, 0, 285, 0, 0, 0, 0, 939, 0, 0, 0, 138, 517, 0, 0, 0,
+  0, 0, 323, 0, 66, 0, 0, 415, 758, 674, 0, 0, 0, 0, 480, 960,
+  0, 74, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 197, 0, 842, 0,
+  0, 73, 378, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 452, 680, 240,
+  718, 0, 0, 0, 0, 0, 0, 0, 0, 0, 484, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 185, 0, 183, 495, 0, 0, 0,
+  0, 0, 0, 0, 554, 809, 0, 0, 466, 0, 13, 405, 451, 646, 880, 0,
+  0, 723, 0, 0, 0, 0, 37, 385, 654, 0, 0, 54, 0, 0, 0, 0,
+  0, 0, 0, 0, 436, 265, 0, 0, 911, 0, 0, 0, 0, 0, 0, 813,
+  275, 564, 0, 608, 106, 721, 997, 0, 411, 0, 0, 467, 0, 0, 705, 762,
+  926, 146, 747, 0, 119, 626, 0, 0, 475, 0, 0, 752, 153, 573, 0, 0,
+  0, 977, 471, 650, 0, 0, 0, 0, 404, 596, 50, 672, 774, 541, 387, 872,
+};
+
+const char *WA_FREQ_118_TOKENS[] = {
+  "tom",
+  "å",
+  "bu",
+  "er",
+  "god",
+  "eg",
+  "at",
+  "han",
+  "det",
+  "pusta",
+  "inn",
+  "har",
+  "tre",
+  "kamera",
+  "i",
+  "byen",
+  "nokså",
+  "annleis",
+  "frå",
+  "på",
+  "landet",
+  "helg",
+  "for",
+  "eit",
+  "dyrt",
+  "piano",
+  "alle",
+  "prisar",
+  "steig",
+  "korfor",
+  "gjer",
+  "folk",
+  "slike",
+  "dumme",
+  "ting",
+  "malka",
+  "ein",
+  "skarpskyttar",
+  "veit",
+  "ikkje",
+  "visste",
+  "måtte",
+  "gjera",
+  "forstod",
+  "ingenting",
+  "av",
+  "sa",
+};
+const uint16_t WA_FREQ_118_RANKS[] = {
+  0, 0, 0, 0, 4, 0, 0, 34, 24, 0, 23, 31, 39, 0, 0, 0,
+  0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 26, 30, 37, 0,
+  0, 0, 0, 7, 41, 0, 40, 0, 0, 0, 0, 0, 19, 0, 0, 0,
+  21, 13, 43, 22, 0, 0, 38, 0, 10, 27, 6, 45, 0, 0, 0, 9,
+  0, 0, 3, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0, 0, 0, 36,
+  5, 18, 33, 28, 42, 47, 0, 0, 0, 0, 44, 0, 0, 0, 0, 0,
+  16, 0, 0, 32, 0, 14, 0, 2, 0, 0, 11, 0, 12, 29, 15, 1,
+  0, 0, 0, 0, 35, 0, 0, 0, 0, 46, 17, 0, 25, 0, 0, 0,
+};
+
+const char *WA_FREQ_119_TOKENS[] = {
+  "og",
+  "i",
+  "til",
+  "er",
+  "som",
+  "det",
+  "på",
+  "en",
+  "han",
+  "ikke",
+  "med",
+  "for",
+  "av",
+  "jeg",
+  "har",
+  "å",
+  "var",
+  "de",
+  "at",
+  "skal",
+  "den",
+  "fra",
+  "så",
+  "Og",
+  "et",
+  "Men",
+  "om",
+  "du",
+  "vi",
+  "sier",
+  "Jeg",
+  "ham",
+  "ut",
+  "over",
+  "Han",
+  "Det",
+  "hadde",
+  "Gå",
+  "vil",
+  "sa",
+  "Gud",
+  "oss",
+  "da",
+  "kan",
+  "sin",
+  "men",
+  "I",
+  "hun",
+  "De",
+  "kom",
+  "hans",
+  "inn",
+  "ved",
+  "dem",
+  "mot",
+  "Så",
+  "alle",
+  "være",
+  "Da",
+  "blir",
+  "også",
+  "Jesus",
+  "seg",
+  "alt",
+  "der",
+  "Guds",
+  "min",
+  "eller",
+  "dette",
+  "bli",
+  "dag",
+  "gikk",
+  "Den",
+  "fikk",
+  "din",
+  "ned",
+  "kommer",
+  "hovedinnhold",
+  "hovedmeny",
+  "En",
+  "For",
+  "Foto",
+  "bare",
+  "sine",
+  "sammen",
+  "år",
+  "hele",
+  "når",
+  "tilbake",
+  "Vi",
+  "igjen",
+  "barn",
+  "to",
+  "tok",
+  "sitt",
+  "andre",
+  "ha",
+  "liv",
+  "ingen",
+  "henne",
+  "selv",
+  "ble",
+  "må",
+  "folk",
+  "under",
+  "her",
+  "deres",
+  "meg",
+  "mange",
+  "gjør",
+  "mann",
+  "Dette",
+  "bort",
+  "går",
+  "får",
+  "se",
+  "2013",
+  "få",
+  "hvor",
+  "før",
+  "ditt",
+  "deg",
+  "vår",
+  "denne",
+  "mitt",
+  "dere",
+  "gjorde",
+  "etter",
+  "gå",
+  "opp",
+  "ser",
+  "Hvorfor",
+  "ta",
+  "gjøre",
+  "Er",
+  "Hvem",
+  "pï¿½",
+  "vet",
+  "står",
+  "godt",
+  "blitt",
+  "siden",
+  "komme",
+  "fordi",
+  "hos",
+  "rundt",
+  "dine",
+  "tre",
+  "tror",
+  "frem",
+  "kunne",
+  "livet",
+  "store",
+  "Hun",
+  "gang",
+  "la",
+  "aldri",
+  "mine",
+  "døde",
+  "både",
+  "ord",
+  "ï¿½",
+  "navn",
+  "Du",
+  "stor",
+  "tid",
+  "mens",
+  "uten",
+  "nå",
+  "Distriktsnyheter",
+  "hver",
+  "skulle",
+  "jo",
+  "Når",
+  "gjort",
+  "rett",
+  "våre",
+  "Kristus",
+  "samme",
+  "vei",
+  "ville",
+  "verden",
+  "På",
+  "gi",
+  "far",
+  "første",
+  "all",
+  "si",
+  "tar",
+  "helt",
+  "Derfor",
+  "mennesker",
+  "svarte",
+  "Hvor",
+  "vært",
+  "Herren",
+  "alltid",
+  "dager",
+  "hjem",
+  "enn",
+  "gode",
+  "hvem",
+  "gir",
+  "hennes",
+  "tro",
+  "elsker",
+  "måtte",
+  "imot",
+  "Der",
+  "satt",
+  "veien",
+  "hverandre",
+  "mor",
+  "hus",
+  "himmelen",
+  "Her",
+  "Jesu",
+  "holdt",
+  "menn",
+  "sønn",
+  "vann",
+  "heller",
+  "ja",
+  "disse",
+  "fått",
+  "langt",
+  "Etter",
+  "jorden",
+  "holder",
+  "Av",
+  "egen",
+  "like",
+  "slik",
+  "kommet",
+  "slo",
+  "huset",
+  "ligger",
+  "ting",
+  "glede",
+  "lenge",
+  "kjærlighet",
+  "foran",
+  "landet",
+  "vel",
+  "del",
+  "død",
+  "Se",
+  "siste",
+  "hjerte",
+  "Herre",
+  "eget",
+  "land",
+  "sagt",
+  "mer",
+  "hvorfor",
+  "sett",
+  "Alle",
+  "gitt",
+  "gammel",
+  "mannen",
+  "hørte",
+  "annen",
+  "bor",
+  "lever",
+  "sted",
+  "kjenner",
+  "lå",
+  "god",
+  "Ånd",
+  "nok",
+  "dagen",
+  "evig",
+  "hører",
+  "nåde",
+  "tatt",
+  "I dag",
+  "La",
+  "derfor",
+  "satte",
+  "synd",
+  "Hans",
+  "Har",
+  "FOTO",
+  "skyld",
+  "sï¿½",
+  "gamle",
+  "gjennom",
+  "nye",
+  "Vil",
+  "ropte",
+  "én",
+  "fant",
+  "holde",
+  "hånd",
+  "borte",
+  "leve",
+  "blod",
+  "falt",
+  "fred",
+  "spurte",
+  "Ja",
+  "folket",
+  "byen",
+  "menneske",
+  "rike",
+  "Mange",
+  "fire",
+  "kvinne",
+  "fast",
+  "Et",
+  "litt",
+  "noen",
+  "begynte",
+  "flere",
+  "hva",
+  "stod",
+  "Hellige",
+  "gått",
+  "hjelp",
+  "hodet",
+  "noe",
+  "ekte",
+  "ene",
+  "lenger",
+  "stedet",
+  "utenfor",
+  "først",
+  "trodde",
+  "Les",
+  "Om",
+  "datter",
+  "stå",
+  "hellige",
+  "høre",
+  "Med",
+  "kastet",
+  "vannet",
+  "elsket",
+  "synder",
+  "Til",
+  "side",
+  "det.",
+  "mat",
+  "ett",
+  "forteller",
+  "lys",
+  "Bli",
+  "kvinner",
+  "man",
+  "Ham",
+  "Ingen",
+  "ber",
+  "Ikke",
+  "Oppdatert",
+  "Publisert",
+  "eneste",
+  "hvis",
+  "lot",
+  "ny",
+  "sitter",
+  "sorg",
+  "visste",
+  "fram",
+  "stort",
+  "trenger",
+  "videre",
+  "1",
+  "Også",
+  "hjemme",
+  "Står",
+  "bønn",
+  "liten",
+  "Som",
+  "bak",
+  "veltet",
+  "Skriv",
+  "fem",
+  "tenkte",
+  "kraft",
+  "bud",
+  "dit",
+  "fortalte",
+  "Far",
+  "gråt",
+  "lov",
+  "ute",
+  "venn",
+  "sendte",
+  "unge",
+  "født",
+  "begge",
+  "dra",
+  "gress",
+  "sjel",
+  "vilje",
+  "annet",
+  "frelse",
+  "barna",
+  "Herrens",
+  "sønnen",
+  "Kan",
+  "bror",
+  "gull",
+  "onde",
+  "vårt",
+  "finne",
+  "tale",
+  "full",
+  "Fra",
+  "midt",
+  "ånd",
+  "alene",
+  "Tror",
+  "finnes",
+  "tiden",
+  "setter",
+  "fremmed",
+  "mellom",
+  "Ved",
+  "jord",
+  "kaller",
+  "lykkelig",
+  "slår",
+  "Alt",
+  "hender",
+  "levende",
+  "2",
+  "dør",
+  "gav",
+  "Å",
+  "ære",
+  "hjertet",
+  "knuste",
+  "redd",
+  "bodde",
+  "hvert",
+  "enda",
+  "lar",
+  "natten",
+  "Kristi",
+  "Nei",
+  "forbi",
+  "legger",
+  "vite",
+  "herlig",
+  "penger",
+  "Én",
+  "hit",
+  "hørt",
+  "klær",
+  "døden",
+  "grunn",
+  "venner",
+  "våknet",
+  "bedre",
+  "bærer",
+  "drøm",
+  "kongen",
+  "nær",
+  "ti",
+  "kalte",
+  "Aftenposten.no",
+  "armen",
+  "ganger",
+  "natt",
+  "bar",
+  "egne",
+  "vï¿½re",
+  "Kom",
+  "troen",
+  "små",
+  "tenker",
+  "Ta",
+  "To",
+  "beste",
+  "fri",
+  "gutten",
+  "skriver",
+  "veier",
+  "Denne",
+  "brød",
+  "dø",
+  "frelst",
+  "førte",
+  "makt",
+  "United-fan",
+  "kjente",
+  "menneskene",
+  "tanker",
+  "hjerter",
+  "lite",
+  "sov",
+  "evige",
+  "finner",
+  "funnet",
+  "mål",
+  "gave",
+  "lagt",
+  "gjerninger",
+  "kjent",
+  "brenner",
+  "hester",
+  "hånden",
+  "Nå",
+  "be",
+  "sønner",
+  "slå",
+  "sannhet",
+  "taler",
+  "Jesus Kristus",
+  "Kjøp",
+  "følge",
+  "kvinnen",
+  "tredje",
+  "vant",
+  "vise",
+  "20",
+  "fulgte",
+  "inne",
+  "roper",
+  "solen",
+  "Yeshua",
+  "ansikt",
+  "ofte",
+  "slutt",
+  "Johannes",
+  "ansiktet",
+  "himmel",
+  "møte",
+  "stille",
+  "NRK",
+  "lyst",
+  "skrev",
+  "snart",
+  "kjærligheten",
+  "søster",
+  "1.",
+  "fare",
+  "hendene",
+  "håret",
+  "mig",
+  "allerede",
+  "hundre",
+  "15",
+  "drømmen",
+  "slått",
+  "veldig",
+  "barnet",
+  "korset",
+  "mye",
+  "spør",
+  "synger",
+  "verdens",
+  "virkelig",
+  "Hvis",
+  "Man",
+  "hesten",
+  "tegn",
+  "viste",
+  "7",
+  "altså",
+  "elske",
+  "mener",
+  "pakt",
+  "skrevet",
+  "viser",
+  "vær",
+  "hjelpe",
+  "sterk",
+  "tårer",
+  "Maria",
+  "plass",
+  "3",
+  "drikke",
+  "fint",
+  "live",
+  "hvite",
+  "hvordan",
+  "håp",
+  "levde",
+  "loven",
+  "rette",
+  "løp",
+  "troende",
+  "gjerne",
+  "mistet",
+  "sove",
+  "mørke",
+  "seks",
+  "tjener",
+  "Erik",
+  "Hele",
+  "Petter",
+  "10",
+  "Hør",
+  "Peter",
+  "Tour",
+  "drepte",
+  "konge",
+  "lang",
+  "minnes",
+  "tusen",
+  "vender",
+  "Per",
+  "samlet",
+  "sang",
+  "Ånden",
+  "Guds rike",
+  "Mens",
+  "Min",
+  "blekk",
+  "levd",
+  "nytt",
+  "syv",
+  "5",
+  "Folk",
+  "jubler",
+  "møtte",
+  "talte",
+  "Kopier",
+  "Søk",
+  "barnebarn",
+  "hode",
+  "sant",
+  "venstre",
+  "2.",
+  "John",
+  "Vær",
+  "gaver",
+  "hellig",
+  "meget",
+  "nei",
+  "råd",
+  "Bare",
+  "fï¿½r",
+  "lenkeadresse",
+  "ren",
+  "sover",
+  "blant",
+  "dei",
+  "eldste",
+  "evangeliet",
+  "ferdig",
+  "hater",
+  "skapt",
+  "«Jeg",
+  "brøt",
+  "fulle",
+  "føre",
+  "sist",
+  "skinner",
+  "sår",
+  "ønsker",
+  "4",
+  "David",
+  "disiplene",
+  "ende",
+  "glad",
+  "havet",
+  "offer",
+  "omkring",
+  "redde",
+  "skjedde",
+  "dyr",
+  "frykter",
+  "mørket",
+  "skrek",
+  "14",
+  "Gutten",
+  "flyktet",
+  "jubel",
+  "saken",
+  "the",
+  "åpnet",
+  "stormen",
+  "Arne",
+  "Paulus",
+  "angrer",
+  "indre",
+  "sendt",
+  "skje",
+  "takk",
+  "vare",
+  "vï¿½r",
+  "Syria",
+  "bo",
+  "brødre",
+  "dig",
+  "laget",
+  "nu",
+  "ung",
+  "Den Hellige Ånd",
+  "blåste",
+  "mørkt",
+  "ryggen",
+  "tomme",
+  "legeme",
+  "rettferdighet",
+  "2011",
+  "disipler",
+  "fører",
+  "Martin",
+  "blå",
+  "frykt",
+  "henger",
+  "lære",
+  "velsignelse",
+  "8",
+  "Eller",
+  "engang",
+  "hang",
+  "hatt",
+  "livets",
+  "sig",
+  "ødelagt",
+  "ødelegger",
+  "18",
+  "Faderen",
+  "døtre",
+  "ler",
+  "munn",
+  "røk",
+  "Anders",
+  "Kanskje",
+  "Skal",
+  "Sønn",
+  "fjellet",
+  "gleden",
+  "inntil",
+  "sette",
+  "Snart",
+  "betyr",
+  "blev",
+  "fylt",
+  "ga",
+  "graven",
+  "gråter",
+  "legge",
+  "Andre",
+  "Sønnen",
+  "kalt",
+  "latter",
+  "rev",
+  "Disse",
+  "The",
+  "by",
+  "dersom",
+  "drar",
+  "jødene",
+  "lille",
+  "påsken",
+  "smerte",
+  "vekker",
+  "17",
+  "6",
+  "Siden",
+  "Vet",
+  "ild",
+  "lover",
+  "løfter",
+  "slags",
+  "traff",
+  "vinne",
+  "12",
+  "Aldri",
+  "Lars",
+  "New",
+  "Var",
+  "bære",
+  "faller",
+  "frukt",
+  "lam",
+  "løftet",
+  "mening",
+  "ovnen",
+  "reiste",
+  "seier",
+  "sinn",
+  "større",
+  "11",
+  "Hver",
+  "døren",
+  "gullet",
+  "ligge",
+  "skam",
+  "stund",
+  "styrke",
+  "telt",
+  "ødela",
+  "kalles",
+  "sengen",
+  "stoler",
+  "Selv",
+  "fullt",
+  "klaget",
+  "kropp",
+  "9",
+  "brødrene",
+  "båten",
+  "evighet",
+  "familie",
+  "godhet",
+  "kanskje",
+  "ofre",
+  "tjeneste",
+  "AV",
+  "Bergen",
+  "Fordi",
+  "Gi",
+  "Magnus",
+  "Olav",
+  "brennende",
+  "dårlig",
+  "dørene",
+  "hatet",
+  "hundene",
+  "kjenne",
+  "lurte",
+  "navnet",
+  "rasende",
+  "ro",
+  "sitte",
+  "skjønte",
+  "sterke",
+  "tjene",
+  "30",
+  "Din",
+  "Mannen",
+  "badet",
+  "fattige",
+  "føttene",
+  "herlighet",
+  "rent",
+  "rive",
+  "søker",
+  "tidlig",
+  "vin",
+  "Satan",
+  "bord",
+  "brent",
+  "kjøttet",
+  "måte",
+  "reise",
+  "roser",
+  "stjal",
+  "vinner",
+  "16",
+  "Bibelen",
+  "Gjør",
+  "Hansen",
+  "Jan",
+  "Norge",
+  "bygget",
+  "kors",
+  "lyset",
+  "lærer",
+  "nï¿½r",
+  "pleide",
+  "resten",
+  "storm",
+  "Fotball",
+  "Måtte",
+  "hjelper",
+  "oppe",
+  "sender",
+  "svar",
+  "synden",
+  "vis",
+  "Før",
+  "forbannet",
+  "hør",
+  "jublet",
+  "menighet",
+  "mennesket",
+  "skyter",
+  "sprang",
+  "stenger",
+  "treet",
+  "13",
+  "3.",
+  "engler",
+  "flukt",
+  "fortelle",
+  "overalt",
+  "sanne",
+  "talt",
+  "Messias",
+  "blåser",
+  "herjet",
+  "heter",
+  "presten",
+  "salt",
+  "stadig",
+  "fremdeles",
+  "gjest",
+  "kjøtt",
+  "klærne",
+  "menigheten",
+  "nakken",
+  "syntes",
+  "åpne",
+  "dype",
+  "skapte",
+  "Northug",
+  "Slik",
+  "blodet",
+  "deler",
+  "knust",
+  "livs",
+  "mest",
+  "måned",
+  "Vik",
+  "engel",
+  "fall",
+  "glemmer",
+  "hentet",
+  "intet",
+  "ogsï¿½",
+  "på.",
+  "retten",
+  "sannheten",
+  "tak",
+  "tenner",
+  "veggene",
+  "venter",
+  "Harald",
+  "Mine",
+  "Si",
+  "Thomas",
+  "fiender",
+  "forlot",
+  "glatte",
+  "grepet",
+  "grå",
+  "gutt",
+  "naken",
+  "Christian",
+  "dreper",
+  "dronning",
+  "falle",
+  "husene",
+  "kaste",
+  "rant",
+  "Enten",
+  "Over",
+  "bolig",
+  "forstår",
+  "følger",
+  "hår",
+  "morgen",
+  "skjer",
+  "svarer",
+  "synes",
+  "Plutselig",
+  "alarm",
+  "bok",
+  "ferd",
+  "minnet",
+  "skremme",
+  "steder",
+  "vasket",
+  "visdom",
+  "fremmede",
+  "hviler",
+  "reddet",
+  "stjernene",
+  "strømmer",
+  "utover",
+  "vendte",
+  "vinden",
+  "Går",
+  "Jerusalem",
+  "Knut",
+  "arbeid",
+  "boken",
+  "drepe",
+  "enhver",
+  "fanget",
+  "farvel",
+  "friskt",
+  "jøder",
+  "leke",
+  "lyden",
+  "nakne",
+  "skjulte",
+  "stol",
+  "time",
+  "trærne",
+  "velsignet",
+  "vende",
+  "vilt",
+  "4.",
+  "Jo",
+  "Manchester",
+  "bruke",
+  "falsk",
+  "fjellene",
+  "fuglene",
+  "hvile",
+  "senere",
+};
+const uint16_t WA_FREQ_119_RANKS[] = {
+  215, 791, 910, 917, 0, 0, 0, 0, 0, 0, 752, 0, 891, 151, 267, 448,
+  343, 585, 756, 0, 0, 0, 563, 990, 566, 380, 0, 718, 706, 346, 0, 0,
+  0, 405, 890, 0, 213, 806, 226, 608, 100, 646, 0, 212, 515, 216, 973, 42,
+  413, 0, 0, 162, 356, 0, 17, 436, 0, 0, 497, 851, 0, 144, 0, 0,
+  0, 0, 0, 132, 0, 0, 0, 0, 0, 0, 0, 558, 0, 0, 0, 0,
+  0, 0, 0, 113, 0, 0, 0, 0, 0, 0, 0, 622, 0, 560, 620, 0,
+  396, 99, 976, 675, 0, 0, 0, 967, 533, 617, 31, 912, 0, 0, 319, 0,
+  0, 541, 0, 0, 0, 389, 839, 730, 825, 449, 426, 949, 270, 0, 0, 190,
+  783, 0, 0, 0, 0, 95, 726, 0, 0, 0, 158, 884, 0, 171, 72, 0,
+  0, 0, 0, 0, 269, 0, 408, 677, 962, 0, 598, 0, 0, 70, 0, 0,
+  143, 0, 85, 208, 694, 701, 903, 0, 0, 0, 0, 264, 0, 0, 487, 522,
+  767, 845, 203, 393, 588, 629, 290, 59, 695, 325, 997, 235, 80, 314, 476, 6,
+  481, 504, 606, 624, 214, 518, 711, 736, 0, 0, 385, 871, 0, 527, 0, 136,
+  831, 229, 433, 89, 880, 0, 0, 0, 0, 68, 0, 740, 332, 0, 467, 850,
+  0, 39, 155, 0, 0, 0, 0, 0, 769, 657, 0, 0, 15, 320, 0, 985,
+  0, 248, 0, 0, 506, 0, 568, 0, 0, 376, 499, 636, 0, 0, 520, 545,
+  698, 217, 479, 64, 547, 750, 511, 751, 894, 348, 995, 618, 263, 782, 0, 428,
+  0, 442, 0, 796, 631, 0, 60, 0, 0, 978, 926, 0, 0, 0, 0, 0,
+  721, 0, 0, 787, 0, 0, 492, 0, 0, 0, 0, 0, 980, 676, 864, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 209, 0, 0, 0, 91, 0, 0,
+  435, 0, 0, 0, 754, 0, 0, 0, 0, 0, 0, 130, 457, 312, 244, 329,
+  233, 0, 703, 0, 0, 456, 572, 793, 987, 0, 0, 802, 196, 227, 239, 0,
+  0, 377, 0, 160, 402, 308, 189, 873, 0, 0, 0, 556, 513, 820, 0, 0,
+  347, 0, 0, 0, 0, 0, 220, 0, 0, 0, 0, 591, 0, 902, 0, 41,
+  451, 271, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 578, 0, 0,
+  0, 231, 424, 709, 955, 211, 0, 0, 0, 0, 0, 0, 0, 662, 394, 705,
+  835, 944, 0, 0, 0, 551, 0, 0, 888, 0, 0, 0, 50, 0, 0, 0,
+  382, 279, 611, 219, 224, 152, 1, 474, 594, 744, 780, 0, 686, 0, 0, 523,
+  525, 0, 0, 0, 0, 0, 0, 45, 483, 0, 0, 0, 571, 0, 0, 323,
+  0, 863, 693, 0, 204, 11, 530, 823, 984, 0, 732, 763, 0, 0, 0, 280,
+  328, 972, 957, 104, 135, 150, 249, 195, 0, 302, 170, 0, 0, 0, 0, 0,
+  0, 0, 453, 0, 0, 317, 0, 810, 673, 422, 815, 834, 968, 0, 0, 368,
+  934, 0, 425, 0, 0, 397, 0, 645, 0, 0, 994, 911, 543, 0, 0, 963,
+  0, 0, 123, 789, 0, 570, 0, 0, 0, 0, 969, 223, 0, 364, 0, 0,
+  0, 47, 363, 521, 580, 0, 260, 0, 0, 266, 222, 118, 779, 0, 0, 0,
+  282, 965, 0, 0, 0, 0, 277, 602, 57, 663, 876, 0, 0, 0, 294, 353,
+  0, 284, 0, 0, 421, 0, 0, 0, 0, 0, 539, 107, 185, 715, 0, 236,
+  0, 0, 0, 381, 0, 0, 0, 0, 992, 0, 0, 0, 0, 106, 0, 0,
+  51, 303, 565, 0, 0, 76, 0, 16, 0, 0, 0, 942, 0, 0, 0, 733,
+  818, 124, 735, 342, 567, 610, 576, 881, 946, 0, 538, 350, 951, 0, 0, 498,
+  509, 383, 409, 77, 896, 653, 898, 0, 180, 0, 0, 0, 0, 101, 300, 877,
+  889, 0, 0, 0, 945, 0, 0, 153, 194, 838, 0, 103, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 460, 986, 0, 0,
+  471, 581, 688, 0, 0, 167, 0, 0, 0, 528, 484, 310, 0, 536, 349, 948,
+  0, 0, 0, 0, 0, 0, 0, 0, 589, 0, 0, 75, 375, 0, 540, 202,
+  268, 0, 0, 727, 0, 306, 0, 0, 0, 0, 0, 305, 246, 0, 0, 0,
+  542, 627, 0, 0, 0, 0, 0, 304, 0, 0, 52, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 874, 0, 0, 486, 649, 865, 0, 0,
+  0, 134, 62, 0, 237, 468, 681, 0, 0, 0, 0, 0, 0, 700, 0, 0,
+  459, 0, 0, 0, 0, 0, 616, 614, 915, 0, 110, 490, 242, 0, 0, 819,
+  682, 141, 696, 0, 0, 0, 0, 0, 0, 0, 0, 176, 0, 0, 0, 785,
+  430, 0, 0, 121, 0, 0, 0, 0, 0, 324, 114, 296, 826, 893, 387, 640,
+  0, 0, 0, 146, 0, 0, 0, 0, 0, 770, 431, 746, 29, 517, 939, 977,
+  24, 139, 937, 0, 0, 0, 0, 0, 429, 683, 960, 250, 654, 597, 5, 469,
+  482, 48, 307, 678, 690, 827, 849, 867, 927, 817, 164, 665, 914, 0, 2, 549,
+  384, 579, 613, 285, 0, 760, 0, 790, 532, 930, 0, 559, 186, 0, 0, 358,
+  25, 0, 0, 0, 0, 786, 0, 0, 63, 147, 352, 658, 828, 932, 670, 0,
+  193, 0, 0, 56, 966, 0, 0, 0, 197, 554, 0, 0, 0, 895, 0, 731,
+  630, 0, 0, 0, 0, 0, 0, 0, 0, 808, 753, 0, 44, 140, 805, 0,
+  81, 148, 619, 178, 0, 0, 0, 0, 0, 0, 46, 0, 900, 846, 0, 0,
+  0, 406, 0, 0, 0, 0, 0, 0, 935, 65, 129, 262, 371, 501, 774, 0,
+  0, 0, 0, 230, 0, 0, 764, 868, 0, 704, 991, 0, 0, 643, 0, 0,
+  0, 0, 133, 859, 0, 0, 0, 0, 0, 761, 0, 0, 0, 573, 333, 667,
+  0, 0, 0, 355, 723, 257, 275, 318, 0, 0, 765, 809, 552, 904, 0, 0,
+  685, 0, 897, 842, 0, 0, 953, 0, 0, 240, 710, 928, 0, 0, 0, 0,
+  232, 466, 766, 316, 0, 495, 201, 605, 0, 0, 494, 836, 0, 0, 0, 0,
+  0, 832, 0, 0, 0, 79, 500, 537, 0, 0, 390, 0, 0, 0, 0, 354,
+  601, 0, 0, 0, 0, 0, 830, 0, 0, 0, 0, 666, 0, 0, 205, 0,
+  0, 768, 0, 0, 0, 0, 612, 635, 0, 470, 0, 58, 0, 535, 351, 544,
+  714, 315, 177, 899, 175, 0, 10, 137, 587, 741, 0, 514, 0, 0, 142, 659,
+  993, 661, 0, 508, 188, 378, 218, 289, 633, 0, 0, 0, 0, 0, 0, 0,
+  0, 437, 252, 340, 238, 0, 295, 883, 775, 127, 590, 0, 83, 0, 0, 0,
+  0, 0, 0, 557, 4, 0, 88, 0, 23, 241, 461, 625, 30, 940, 0, 0,
+  0, 298, 773, 0, 0, 69, 0, 0, 717, 0, 0, 18, 27, 728, 341, 366,
+  801, 824, 909, 19, 798, 0, 0, 0, 0, 0, 0, 369, 0, 0, 712, 0,
+  0, 0, 0, 0, 109, 0, 128, 0, 345, 755, 858, 919, 0, 729, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 954, 0, 0, 0, 0, 0,
+  122, 234, 34, 747, 885, 438, 0, 0, 550, 593, 0, 822, 938, 0, 0, 0,
+  0, 38, 256, 702, 906, 941, 0, 0, 0, 0, 982, 0, 111, 0, 555, 0,
+  0, 0, 54, 265, 0, 330, 679, 0, 0, 74, 759, 811, 0, 0, 0, 0,
+  477, 604, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 445, 0,
+  169, 0, 327, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 119, 273,
+  360, 0, 0, 362, 321, 0, 0, 33, 983, 800, 0, 0, 933, 837, 0, 797,
+  862, 374, 255, 415, 950, 697, 961, 414, 596, 852, 322, 502, 916, 749, 478, 157,
+  840, 956, 311, 84, 0, 108, 0, 288, 334, 120, 251, 454, 628, 921, 21, 607,
+  40, 989, 0, 71, 0, 0, 0, 0, 0, 0, 804, 656, 61, 641, 0, 427,
+  647, 577, 181, 168, 777, 0, 0, 0, 0, 412, 813, 0, 0, 0, 0, 582,
+  981, 0, 489, 78, 96, 0, 0, 281, 291, 13, 0, 0, 0, 299, 395, 975,
+  326, 0, 0, 998, 0, 0, 22, 0, 0, 0, 491, 475, 680, 0, 0, 367,
+  0, 0, 0, 970, 0, 0, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  450, 274, 398, 0, 0, 337, 505, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 423, 708, 0, 638, 0, 37, 82, 410, 0, 0, 0, 564, 947, 650,
+  0, 0, 335, 621, 0, 0, 0, 0, 0, 0, 0, 0, 372, 0, 0, 0,
+  283, 0, 716, 149, 292, 720, 778, 0, 0, 816, 0, 0, 488, 0, 276, 848,
+  0, 771, 651, 53, 272, 615, 0, 0, 772, 725, 814, 599, 687, 861, 0, 0,
+  574, 0, 524, 172, 0, 0, 0, 0, 0, 0, 0, 546, 184, 400, 0, 0,
+  0, 0, 0, 0, 671, 404, 0, 569, 165, 225, 287, 847, 691, 922, 526, 0,
+  652, 0, 0, 0, 0, 561, 496, 600, 293, 503, 0, 0, 692, 0, 115, 0,
+  191, 485, 117, 812, 163, 0, 0, 0, 432, 0, 833, 90, 339, 0, 444, 0,
+  243, 0, 0, 0, 0, 0, 0, 0, 0, 0, 463, 0, 925, 0, 228, 102,
+  0, 0, 338, 0, 0, 0, 929, 0, 0, 0, 0, 0, 548, 0, 0, 0,
+  207, 401, 20, 66, 179, 105, 253, 379, 434, 519, 642, 734, 931, 439, 116, 0,
+  0, 73, 999, 0, 0, 26, 974, 0, 0, 455, 821, 0, 0, 0, 0, 0,
+  0, 0, 583, 668, 0, 0, 0, 97, 331, 719, 742, 112, 776, 856, 952, 440,
+  87, 707, 154, 359, 841, 0, 0, 0, 0, 996, 12, 373, 0, 0, 0, 0,
+  0, 199, 853, 0, 131, 0, 0, 0, 0, 0, 254, 748, 918, 684, 0, 0,
+  0, 336, 0, 0, 784, 452, 0, 0, 0, 655, 0, 866, 0, 0, 0, 0,
+  0, 609, 0, 0, 887, 36, 49, 173, 534, 159, 745, 857, 198, 807, 261, 0,
+  0, 699, 0, 28, 0, 92, 210, 0, 403, 586, 0, 93, 739, 0, 0, 648,
+  0, 192, 441, 247, 365, 737, 0, 0, 391, 446, 584, 829, 738, 936, 901, 166,
+  221, 472, 126, 869, 924, 0, 0, 206, 0, 1000, 419, 55, 0, 875, 0, 964,
+  0, 8, 0, 0, 886, 905, 0, 125, 795, 0, 908, 637, 0, 507, 632, 913,
+  0, 0, 0, 0, 669, 0, 0, 0, 0, 174, 0, 575, 0, 0, 297, 0,
+  0, 0, 664, 724, 0, 0, 0, 0, 0, 0, 762, 0, 0, 758, 399, 0,
+  0, 0, 344, 562, 245, 418, 634, 722, 0, 0, 0, 94, 872, 187, 592, 0,
+  0, 623, 0, 0, 416, 0, 713, 493, 14, 792, 0, 0, 35, 0, 0, 0,
+  0, 0, 0, 0, 603, 67, 626, 0, 0, 0, 0, 138, 855, 870, 0, 0,
+  182, 0, 0, 0, 0, 0, 447, 0, 0, 0, 516, 689, 161, 0, 0, 0,
+  860, 660, 462, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 529, 0,
+  757, 0, 788, 473, 313, 0, 0, 258, 200, 799, 156, 259, 43, 286, 958, 781,
+  0, 672, 0, 0, 0, 0, 0, 86, 3, 386, 407, 803, 943, 0, 0, 0,
+  361, 0, 0, 0, 0, 0, 278, 0, 0, 0, 0, 879, 0, 0, 301, 0,
+  0, 878, 843, 0, 0, 0, 892, 0, 0, 370, 420, 464, 0, 0, 98, 443,
+  0, 0, 0, 392, 0, 959, 923, 0, 0, 979, 0, 0, 0, 0, 595, 644,
+  0, 411, 0, 183, 882, 0, 309, 145, 0, 674, 0, 0, 0, 907, 531, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 388, 0, 0, 0, 0, 0,
+  920, 458, 510, 971, 0, 357, 0, 0, 0, 0, 417, 0, 794, 0, 512, 465,
+  0, 743, 0, 639, 844, 988, 0, 0, 0, 0, 0, 0, 480, 553, 854, 0,
+};
+
@@ -0,0 +1,9546 @@
+#include "worldalphabets_data.h"
+
+const char *WA_FREQ_120_TOKENS[] = {
+  "le",
+  "ka",
+  "go",
+  "la",
+  "ya",
+  "a",
+  "mafelelo",
+  "Letlakala",
+  "fetotšwe",
+  "e",
+  "ba",
+  "tša",
+  "o",
+  "ke",
+  "se",
+  "di",
+  "wa",
+  "ye",
+  "tše",
+  "ga",
+  "2017",
+  "gore",
+  "2016",
+  "sa",
+  "re",
+  "ge",
+  "be",
+  "Phupu",
+  "tla",
+  "gomme",
+  "Lewedi",
+  "bja",
+  "mo",
+  "pele",
+  "na",
+  "Phato",
+  "ile",
+  "gagwe",
+  "batho",
+  "yeo",
+  "Hlakola",
+  "2020",
+  "moka",
+  "goba",
+  "2018",
+  "Ka",
+  "Go",
+  "Diphalane",
+  "Re",
+  "rena",
+  "O",
+  "Ke",
+  "bona",
+  "bjalo",
+  "wo",
+  "kudu",
+  "yo",
+  "Afrika",
+  "2015",
+  "bao",
+  "Dibatsela",
+  "Pherekgong",
+  "swanetše",
+  "tšeo",
+  "7",
+  "2014",
+  "Mosegamanye",
+  "realo",
+  "24",
+  "Dibokwane",
+  "lego",
+  "2",
+  "gape",
+  "dira",
+  "Borwa",
+  "2021",
+  "fao",
+  "11",
+  "gona",
+  "21",
+  "25",
+  "bo",
+  "1",
+  "yona",
+  "seo",
+  "godimo",
+  "nako",
+  "fihla",
+  "2019",
+  "nyaka",
+  "Manthole",
+  "ngwaga",
+  "naga",
+  "bjo",
+  "morago",
+  "mmušo",
+  "27",
+  "28",
+  "6",
+  "bohlokwa",
+  "matšatši",
+  "setšhaba",
+  "kgolo",
+  "tšwa",
+  "22",
+  "ao",
+  "fela",
+  "E",
+  "Ge",
+  "feta",
+  "bego",
+  "thoma",
+  "Ga",
+  "sehlopha",
+  "šoma",
+  "gare",
+  "10",
+  "15",
+  "tšwela",
+  "4",
+  "Le",
+  "mešomo",
+  "5",
+  "29",
+  "dingwe",
+  "mošomo",
+  "thuša",
+  "tšona",
+  "Moranang",
+  "8",
+  "letšatši",
+  "tee",
+  "nago",
+  "9",
+  "ntle",
+  "hwetša",
+  "lefase",
+  "3",
+  "Se",
+  "thuto",
+  "swana",
+  "2013",
+  "30",
+  "Matlakala",
+  "dijo",
+  "18",
+  "20",
+  "gwa",
+  "motho",
+  "selo",
+  "leo",
+  "tsela",
+  "bolela",
+  "maatla",
+  "nngwe",
+  "tlase",
+  "bana",
+  "tšea",
+  "šala",
+  "bile",
+  "tloga",
+  "Mopitlo",
+  "fa",
+  "kgona",
+  "mongwe",
+  "tseba",
+  "16",
+  "maemo",
+  "bophelo",
+  "tlago",
+  "gabotse",
+  "yena",
+  "bjale",
+  "14",
+  "31",
+  "mafelelong",
+  "26",
+  "botse",
+  "efela",
+  "19",
+  "dilo",
+  "meetse",
+  "moo",
+  "2011",
+  "bokgoni",
+  "fase",
+  "Morago",
+  "rata",
+  "Ba",
+  "nageng",
+  "bophara",
+  "ditirelo",
+  "mang",
+  "gago",
+  "lengwe",
+  "sepela",
+  "ekonomi",
+  "Efela",
+  "Mmušo",
+  "karolo",
+  "lebaka",
+  "mengwaga",
+  "kua",
+  "dula",
+  "Gomme",
+  "lefaseng",
+  "tlo",
+  "13",
+  "Setšhaba",
+  "bohle",
+  "Mo",
+  "diphoofolo",
+  "Koko",
+  "nyakišišo",
+  "12",
+  "HIV",
+  "mathomo",
+  "mohlagase",
+  "Batho",
+  "gammogo",
+  "nnete",
+  "23",
+  "Bjale",
+  "bangwe",
+  "netefatša",
+  "polelo",
+  "ebile",
+  "sengwe",
+  "A",
+  "gae",
+  "kaonafatša",
+  "magareng",
+  "mokgwa",
+  "motheo",
+  "dinaga",
+  "hloka",
+  "mabapi",
+  "tlhabollo",
+  "fetilego",
+  "gobane",
+  "mathata",
+  "mmogo",
+  "thušo",
+  "ANC",
+  "Modimo",
+  "aga",
+  "bašomi",
+  "mehla",
+  "molao",
+  "ngwageng",
+  "dirwa",
+  "dutše",
+  "eba",
+  "hloma",
+  "swara",
+  "bontšha",
+  "tšohle",
+  "2012",
+  "Mma",
+  "bago",
+  "tokelo",
+  "tšhelete",
+  "bobedi",
+  "lebelo",
+  "ntši",
+  "taba",
+  "šomiša",
+  "bjang",
+  "bose",
+  "ditšhelete",
+  "mengwageng",
+  "rile",
+  "swanetšego",
+  "akaretša",
+  "dirago",
+  "lebelela",
+  "mmalwa",
+  "no",
+  "ra",
+  "sona",
+  "woo",
+  "Kapa",
+  "aba",
+  "dintši",
+  "eng",
+  "ja",
+  "kgauswi",
+  "mengwe",
+  "ona",
+  "t¹a",
+  "tšweletša",
+  "pedi",
+  "sego",
+  "swanela",
+  "maswi",
+  "sebaka",
+  "kgone",
+  "lentšu",
+  "thomile",
+  "wona",
+  "basadi",
+  "eupša",
+  "mmele",
+  "monnyane",
+  "tlhahlo",
+  "tšwetša",
+  "bosenyi",
+  "ditokelo",
+  "lehono",
+  "leka",
+  "nna",
+  "Sizwe",
+  "badudi",
+  "17",
+  "bea",
+  "bolwetši",
+  "fihlelela",
+  "kaone",
+  "lenaneo",
+  "rapolasa",
+  "tokologo",
+  "šomišwa",
+  "Gape",
+  "Tate",
+  "diaparo",
+  "kgahlanong",
+  "kgopela",
+  "maphelo",
+  "tlala",
+  "bjoko",
+  "dieta",
+  "ditaba",
+  "hlogo",
+  "palo",
+  "taolo",
+  "šupa",
+  "bapala",
+  "bothata",
+  "fofela",
+  "lebeletše",
+  "matswalo",
+  "mola",
+  "nakong",
+  "of",
+  "bakgathatema",
+  "botša",
+  "dikenti",
+  "khutšo",
+  "lena",
+  "mangwe",
+  "mpsha",
+  "phela",
+  "Leboa",
+  "Mna",
+  "Molao",
+  "Neo",
+  "Thuto",
+  "eya",
+  "ilego",
+  "maoto",
+  "tšhireletšo",
+  "Tlhabollo",
+  "bosetšhaba",
+  "dimilione",
+  "fofa",
+  "goeletša",
+  "kanegelo",
+  "kgale",
+  "kudukudu",
+  "laetša",
+  "latela",
+  "nale",
+  "pela",
+  "tema",
+  "tshepedišo",
+  "Africa",
+  "baithuti",
+  "bone",
+  "bošego",
+  "dintlo",
+  "latelago",
+  "lona",
+  "mangwalo",
+  "merogo",
+  "moya",
+  "Mopresidente",
+  "boleng",
+  "botlalo",
+  "ditsela",
+  "fapana",
+  "fetola",
+  "fihlela",
+  "fokotša",
+  "kenti",
+  "lekana",
+  "maleba",
+  "mananeokgoparara",
+  "nnyane",
+  "swarwa",
+  "Gus",
+  "Letšatši",
+  "Palo",
+  "bilego",
+  "botšiša",
+  "dinyakwa",
+  "dirile",
+  "fetša",
+  "ithuta",
+  "kwa",
+  "lapa",
+  "phethagatša",
+  "tharo",
+  "Mandela",
+  "bitšwa",
+  "lethabo",
+  "mekgwa",
+  "sefahlego",
+  "tlhokomelo",
+  "tliša",
+  "tshela",
+  "šetše",
+  "000",
+  "African",
+  "Koketso",
+  "Lefase",
+  "Mang",
+  "Thoko",
+  "akaretšwa",
+  "amogela",
+  "bala",
+  "hlohleletša",
+  "hlokomela",
+  "kgopolo",
+  "lešata",
+  "nyuklea",
+  "seabe",
+  "tshedimošo",
+  "Bosetšhaba",
+  "Mmasepala",
+  "Ngwaga",
+  "Nimirode",
+  "bafsa",
+  "bagwera",
+  "dibjalo",
+  "dikgwedi",
+  "dipolelo",
+  "gola",
+  "kgonago",
+  "maikemišetšo",
+  "mehuta",
+  "mogolo",
+  "mohlala",
+  "ngwana",
+  "thekgo",
+  "tsebo",
+  "Naa",
+  "dibaka",
+  "dinonyana",
+  "emela",
+  "hlaloša",
+  "kgwebo",
+  "lwantšha",
+  "milione",
+  "mokgatlo",
+  "nka",
+  "nonyana",
+  "nyakago",
+  "polokego",
+  "sebopego",
+  "sekolong",
+  "swanago",
+  "Dinaga",
+  "Ya",
+  "bitšwago",
+  "bogolo",
+  "diriša",
+  "diswantšho",
+  "ditiragalo",
+  "gantši",
+  "gauta",
+  "hlola",
+  "katse",
+  "lefapha",
+  "leswa",
+  "mae",
+  "mantšu",
+  "mehlare",
+  "melao",
+  "nne",
+  "phetelo",
+  "tsena",
+  "tšwago",
+  "tšwelela",
+  "Bjalo",
+  "Di",
+  "Moh",
+  "baka",
+  "boima",
+  "dikanegelo",
+  "ditiro",
+  "fiwa",
+  "kwagala",
+  "leano",
+  "lefelo",
+  "lesome",
+  "lewatle",
+  "mohlare",
+  "mohuta",
+  "ratago",
+  "setšo",
+  "temokrasi",
+  "thekga",
+  "tlhokego",
+  "2010",
+  "Bohlabela",
+  "Jesu",
+  "Transcription",
+  "diprotšeke",
+  "dire",
+  "hwetše",
+  "kago",
+  "leloko",
+  "mananeo",
+  "mongwalelo",
+  "mpša",
+  "nagana",
+  "namela",
+  "ngwala",
+  "papadi",
+  "thibela",
+  "tle",
+  "tšweletšo",
+  "Kopano",
+  "Lenaneo",
+  "Maemo",
+  "Modulasetulo",
+  "boditšhabatšhaba",
+  "bulela",
+  "dienywa",
+  "dinyakišišo",
+  "dumela",
+  "gopola",
+  "hweditše",
+  "itšego",
+  "iša",
+  "kitima",
+  "leboga",
+  "lefelong",
+  "makala",
+  "maloko",
+  "mesong",
+  "selegae",
+  "seripa",
+  "setšhabeng",
+  "Bolaodi",
+  "Molaotheo",
+  "SAQA",
+  "boraro",
+  "dikgetho",
+  "dipoelo",
+  "ditherišano",
+  "dulago",
+  "fana",
+  "ikemišeditše",
+  "kalafo",
+  "kopana",
+  "kopano",
+  "leina",
+  "myemyela",
+  "nanya",
+  "phihlelelo",
+  "puku",
+  "semmušo",
+  "telele",
+  "thabile",
+  "tirelo",
+  "tlhago",
+  "tlogela",
+  "šomago",
+  "1994",
+  "2009",
+  "Bodikela",
+  "Eupša",
+  "Kriste",
+  "Nelson",
+  "ama",
+  "bantši",
+  "barutiši",
+  "diatla",
+  "dirilwego",
+  "kabo",
+  "kakaretšo",
+  "kgoši",
+  "leago",
+  "lemoga",
+  "mabaka",
+  "mafelong",
+  "magato",
+  "maleme",
+  "mmala",
+  "mogwera",
+  "ntwa",
+  "oketša",
+  "rarolla",
+  "seetša",
+  "swere",
+  "thoko",
+  "tsenya",
+  "tšhomišo",
+  "wela",
+  "AIDS",
+  "Mošomo",
+  "Pele",
+  "batswadi",
+  "bodikela",
+  "bolelago",
+  "bomenetša",
+  "bonolo",
+  "diiri",
+  "dinageng",
+  "dipapadi",
+  "dirilego",
+  "ditlhohlo",
+  "fapanego",
+  "hlokago",
+  "ikonomi",
+  "kgatelelo",
+  "kgethwa",
+  "lla",
+  "mahlo",
+  "mantši",
+  "matlakala",
+  "mmagwe",
+  "mosadi",
+  "mpšanyana",
+  "nama",
+  "phethagatšo",
+  "putla",
+  "ruta",
+  "sega",
+  "sephetho",
+  "thaba",
+  "tsebe",
+  "šireletša",
+  "šomela",
+  "Gabby",
+  "Hlomphegago",
+  "Kgabo",
+  "Kgoro",
+  "Layla",
+  "Mabapi",
+  "Mesong",
+  "Mmusogae",
+  "Sa",
+  "bokaone",
+  "borutho",
+  "boya",
+  "dihlopha",
+  "dikgato",
+  "dithuto",
+  "ditlamorago",
+  "ditšhaba",
+  "efe",
+  "histori",
+  "humana",
+  "kgolofalo",
+  "kgopelo",
+  "laola",
+  "lebakeng",
+  "lebane",
+  "lee",
+  "legolo",
+  "lekala",
+  "lešokeng",
+  "maemong",
+  "mafelo",
+  "mašeleng",
+  "meraro",
+  "rate",
+  "seemo",
+  "thala",
+  "tikologo",
+  "tlogo",
+  "Bathobaso",
+  "Bošego",
+  "Diphoofolo",
+  "Godimo",
+  "Lekala",
+  "Mokgwa",
+  "akaretšago",
+  "bakeng",
+  "bopa",
+  "botho",
+  "dikotsi",
+  "dingwalwa",
+  "dipharologantšho",
+  "diripa",
+  "emetše",
+  "emiša",
+  "gabo",
+  "hlapa",
+  "kae",
+  "kopanya",
+  "kotsi",
+  "lalela",
+  "magaeng",
+  "mahlatse",
+  "maikarabelo",
+  "marula",
+  "mebedi",
+  "mentši",
+  "mmeleng",
+  "mohola",
+  "moso",
+  "nepo",
+  "ntšhi",
+  "pejana",
+  "tiro",
+  "tshepedi¹o",
+  "tšere",
+  "tšhengwaneng",
+  "wago",
+  "yago",
+  "Bana",
+  "Ee",
+  "Lefelo",
+  "Momma",
+  "Naga",
+  "SADC",
+  "Sefoka",
+  "Seo",
+  "Sepikara",
+  "Shireen",
+  "baswa",
+  "bitša",
+  "bjoo",
+  "boetapele",
+  "bogale",
+  "boleta",
+  "boloka",
+  "bongwalolodi",
+  "bontši",
+  "dikgwebo",
+  "dipuku",
+  "dirišwa",
+  "gabjale",
+  "gešo",
+  "hlano",
+  "hlomile",
+  "katlego",
+  "kgole",
+  "kitimela",
+  "lebanego",
+  "leboa",
+  "maatlafatša",
+  "mabokgoni",
+  "mafolofolo",
+  "malapa",
+  "mašole",
+  "meepo",
+  "mekgatlo",
+  "molato",
+  "motseng",
+  "nnoši",
+  "opela",
+  "pelo",
+  "penta",
+  "pilione",
+  "pula",
+  "segwera",
+  "seswantšho",
+  "swerwe",
+  "tlaleletša",
+  "tletše",
+  "tonki",
+  "šoro",
+  "1.",
+  "Khansele",
+  "Labobedi",
+  "Language",
+  "Maloko",
+  "Maoto",
+  "Mokgatlo",
+  "South",
+  "Tau",
+  "Tše",
+  "boela",
+  "bohlale",
+  "bohloko",
+  "bonala",
+  "bongwe",
+  "dihlapi",
+  "dipersente",
+  "diphetogo",
+  "diteko",
+  "etela",
+  "filwe",
+  "keteka",
+  "kgahlišago",
+  "kgethegilego",
+  "lehu",
+  "maAfrika",
+  "meetseng",
+  "mehlano",
+  "mme",
+  "mmušong",
+  "mohlareng",
+  "mokokotlong",
+  "molala",
+  "mongwadi",
+  "monna",
+  "morero",
+  "nyakišišong",
+  "peleng",
+  "raloka",
+  "reka",
+  "sefela",
+  "segolo",
+  "sekolo",
+  "tlwaelega",
+  "tsa",
+  "tsebega",
+  "tseleng",
+  "t¹eo",
+  "2004",
+  "Alex",
+  "Amerika",
+  "Brevis",
+  "Dinyakišišo",
+  "Harding",
+  "Mafelelong",
+  "Mini",
+  "Moraloki",
+  "Morena",
+  "National",
+  "Nka",
+  "Sepedi",
+  "Tlhahlo",
+  "Tšhireletšo",
+  "Vita",
+  "amanago",
+  "beakanya",
+  "befetšwe",
+  "beke",
+  "dikamano",
+  "dikolo",
+  "dimela",
+  "dipolante",
+  "dirilwe",
+  "dule",
+  "eme",
+  "goja",
+  "kgatha",
+  "kgethologanyo",
+  "kgwedi",
+  "lekola",
+  "lesolo",
+  "leswika",
+  "madi",
+  "magolo",
+  "mošemane",
+  "mošomong",
+  "naa",
+  "ntše",
+  "nyake",
+  "peeletšo",
+  "phepo",
+  "phetogo",
+  "sepediša",
+  "theeletša",
+  "tiišetša",
+  "tlhomo",
+  "tsene",
+  "tsoga",
+  "virase",
+  "wena",
+  "šome",
+  "2.",
+  "2008",
+  "Asia",
+  "Bolwetši",
+  "Dell",
+  "Krog",
+  "Madiba",
+  "Malome",
+  "Marie-Lou",
+  "Mešomo",
+  "Moswe",
+  "Mpšhe",
+  "Ngwageng",
+  "Repabliki",
+  "Sebjana",
+  "Sisanda",
+  "Ye",
+  "abelana",
+  "afe",
+  "apara",
+  "atlegilego",
+  "belegwe",
+  "dibe",
+  "dilete",
+  "dinnyane",
+  "direkwa",
+  "dirwago",
+  "dithoto",
+  "ditoropong",
+  "dumelela",
+  "etšwa",
+  "fediša",
+  "gaborena",
+  "gannyane",
+  "hlama",
+  "ikgantšha",
+  "in",
+  "ipshina",
+  "kelo",
+  "kgatelopele",
+  "kgetha",
+  "kgethollo",
+  "kgonthe",
+  "leihlo",
+  "leleme",
+  "lenaneong",
+  "mafapheng",
+  "mehutahuta",
+  "mokotla",
+  "molaotheo",
+  "morula",
+  "mosela",
+  "motse",
+  "ngwakong",
+  "nona",
+  "nyakegago",
+  "ofe",
+  "palelwa",
+  "phoofolo",
+  "seswai",
+  "tate",
+  "teko",
+  "theilwe",
+  "tlwaelegilego",
+  "t¹e",
+  "tšhemo",
+  "tšhoga",
+  "15:25",
+  "21:35",
+  "21:54",
+  "Ann",
+  "Bohle",
+  "Cassidy",
+  "Dinagakopano",
+  "Ditšhelete",
+  "ETQA",
+  "Eskom",
+  "Kanegelo",
+  "Khudu",
+  "Khwezi",
+  "Lehono",
+  "Magareng",
+  "Mangwalo",
+  "Mbali",
+  "Monna",
+  "Motho",
+  "Moya",
+  "Nolitha",
+  "Polelo",
+  "Setereke",
+  "Sontaga",
+  "TB",
+  "Thutlwa",
+  "Zimkhitha",
+  "amago",
+  "araba",
+  "baetapele",
+  "bathong",
+  "bokamoso",
+  "boletše",
+  "borwa",
+  "dipisikiti",
+  "dipolotiki",
+  "dipotšišo",
+  "direga",
+  "diswa",
+  "ditsebi",
+  "elego",
+  "ema",
+  "fapafapanego",
+  "gatee",
+  "goga",
+  "gohle",
+  "hemela",
+  "kabago",
+  "kamoka",
+  "kgethega",
+  "kgontšha",
+  "kgotlelelo",
+  "khabetšhe",
+  "laetšago",
+  "lebeletšwe",
+  "lefsa",
+};
+const uint16_t WA_FREQ_120_RANKS[] = {
+  68, 0, 0, 0, 207, 846, 0, 0, 0, 0, 0, 0, 0, 0, 540, 0,
+  493, 0, 0, 0, 480, 0, 0, 0, 0, 0, 0, 212, 0, 718, 0, 978,
+  847, 0, 959, 0, 0, 888, 658, 336, 645, 384, 676, 842, 955, 111, 719, 963,
+  646, 906, 0, 0, 673, 439, 66, 729, 0, 0, 0, 0, 491, 0, 0, 0,
+  845, 874, 0, 0, 0, 0, 0, 0, 0, 559, 0, 0, 0, 0, 210, 0,
+  940, 0, 0, 0, 648, 0, 767, 0, 0, 225, 728, 0, 0, 65, 0, 437,
+  0, 424, 0, 0, 0, 0, 392, 217, 0, 0, 0, 0, 0, 45, 168, 0,
+  0, 33, 511, 772, 0, 377, 0, 305, 152, 882, 0, 0, 632, 0, 476, 28,
+  512, 0, 0, 273, 132, 0, 37, 432, 391, 0, 18, 0, 821, 0, 942, 0,
+  0, 0, 0, 0, 0, 122, 571, 0, 0, 0, 0, 388, 0, 0, 0, 449,
+  284, 0, 0, 0, 0, 0, 0, 303, 0, 0, 896, 722, 873, 954, 43, 0,
+  0, 0, 506, 0, 0, 0, 0, 0, 0, 804, 661, 0, 0, 0, 0, 7,
+  514, 93, 183, 0, 0, 0, 0, 0, 589, 0, 0, 0, 610, 0, 0, 814,
+  568, 631, 893, 0, 0, 12, 0, 0, 389, 190, 0, 597, 0, 0, 0, 748,
+  0, 472, 258, 598, 715, 0, 0, 0, 0, 0, 558, 674, 0, 0, 0, 436,
+  0, 904, 0, 247, 816, 0, 456, 0, 0, 329, 0, 0, 235, 578, 983, 302,
+  0, 516, 633, 638, 792, 0, 0, 898, 838, 0, 0, 977, 186, 622, 945, 0,
+  0, 349, 438, 288, 0, 0, 166, 863, 730, 0, 0, 62, 0, 0, 337, 364,
+  788, 53, 112, 694, 734, 119, 702, 0, 705, 0, 0, 0, 0, 708, 379, 0,
+  908, 0, 0, 0, 0, 0, 775, 0, 322, 447, 513, 239, 17, 774, 671, 843,
+  0, 517, 63, 0, 314, 88, 0, 0, 0, 343, 218, 233, 467, 687, 300, 0,
+  635, 0, 0, 0, 60, 644, 0, 580, 528, 953, 0, 861, 642, 462, 949, 972,
+  0, 0, 415, 0, 0, 0, 0, 714, 0, 0, 593, 0, 0, 0, 0, 0,
+  0, 637, 0, 0, 137, 453, 0, 684, 0, 0, 0, 0, 0, 0, 636, 640,
+  727, 849, 0, 523, 766, 0, 41, 0, 0, 0, 0, 0, 0, 562, 356, 381,
+  0, 0, 0, 0, 106, 101, 250, 185, 277, 19, 291, 455, 519, 763, 781, 960,
+  979, 0, 641, 404, 197, 938, 980, 0, 0, 826, 649, 0, 0, 681, 0, 0,
+  504, 0, 752, 6, 78, 117, 435, 85, 879, 926, 0, 0, 82, 368, 652, 669,
+  917, 0, 165, 0, 0, 0, 0, 0, 0, 0, 0, 448, 0, 262, 488, 0,
+  245, 605, 832, 401, 0, 0, 351, 0, 133, 0, 835, 0, 831, 0, 0, 0,
+  0, 627, 0, 0, 0, 335, 964, 0, 0, 339, 0, 634, 0, 0, 0, 0,
+  466, 0, 543, 0, 544, 0, 0, 375, 486, 696, 925, 0, 289, 827, 0, 0,
+  0, 0, 0, 280, 0, 285, 586, 0, 0, 677, 49, 42, 0, 0, 0, 0,
+  0, 0, 181, 0, 0, 115, 662, 0, 706, 412, 406, 286, 0, 0, 0, 0,
+  868, 0, 0, 807, 0, 464, 564, 0, 0, 0, 0, 326, 0, 0, 527, 345,
+  740, 609, 0, 0, 0, 747, 829, 783, 0, 0, 0, 0, 0, 0, 0, 0,
+  547, 576, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 796,
+  0, 0, 0, 0, 0, 0, 884, 0, 0, 428, 0, 0, 0, 613, 0, 0,
+  806, 0, 0, 841, 0, 0, 0, 675, 595, 820, 0, 0, 0, 0, 922, 281,
+  0, 0, 20, 0, 572, 993, 0, 414, 860, 0, 599, 798, 0, 0, 0, 0,
+  0, 0, 0, 228, 0, 856, 500, 505, 201, 319, 92, 306, 712, 764, 973, 0,
+  936, 0, 0, 431, 913, 915, 0, 0, 799, 0, 0, 556, 0, 0, 141, 552,
+  793, 0, 0, 0, 35, 907, 858, 987, 0, 209, 685, 0, 0, 0, 110, 0,
+  0, 0, 0, 0, 222, 0, 724, 918, 0, 0, 74, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 240, 365, 0, 0, 346, 691, 0, 0, 0, 237, 969,
+  318, 805, 0, 0, 295, 342, 0, 362, 422, 423, 0, 0, 159, 758, 0, 75,
+  0, 0, 0, 0, 0, 869, 0, 0, 0, 0, 0, 0, 0, 988, 0, 0,
+  499, 0, 0, 0, 259, 875, 0, 90, 0, 0, 889, 0, 0, 0, 246, 25,
+  265, 279, 802, 290, 911, 198, 268, 0, 541, 668, 0, 0, 194, 450, 161, 0,
+  755, 0, 0, 241, 163, 371, 96, 515, 839, 0, 353, 0, 689, 309, 0, 442,
+  0, 13, 16, 73, 113, 324, 330, 656, 0, 0, 0, 22, 0, 524, 692, 0,
+  0, 0, 0, 0, 0, 272, 720, 231, 0, 81, 357, 143, 304, 0, 56, 600,
+  0, 0, 0, 348, 0, 0, 885, 0, 473, 0, 253, 663, 147, 0, 46, 0,
+  0, 243, 89, 0, 0, 761, 773, 833, 0, 340, 0, 120, 0, 484, 84, 587,
+  433, 36, 416, 655, 778, 0, 0, 628, 630, 782, 579, 0, 104, 574, 824, 418,
+  957, 0, 316, 0, 102, 639, 560, 34, 405, 0, 234, 0, 625, 731, 0, 0,
+  819, 0, 0, 621, 216, 664, 397, 935, 0, 0, 64, 0, 226, 660, 604, 160,
+  312, 779, 0, 393, 982, 269, 0, 0, 862, 994, 0, 0, 769, 0, 549, 157,
+  294, 470, 0, 0, 0, 818, 178, 301, 891, 0, 966, 927, 369, 717, 900, 125,
+  0, 811, 0, 0, 0, 0, 0, 0, 0, 0, 0, 813, 616, 0, 0, 0,
+  355, 557, 0, 0, 0, 0, 263, 385, 542, 0, 232, 0, 0, 590, 107, 287,
+  0, 0, 270, 991, 151, 795, 215, 881, 0, 0, 0, 0, 176, 569, 0, 0,
+  238, 659, 0, 810, 242, 267, 647, 58, 188, 254, 380, 0, 0, 138, 0, 0,
+  0, 784, 944, 533, 756, 986, 0, 0, 171, 203, 950, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 601, 127, 0, 591, 0, 0, 0, 0, 21, 32, 0, 0,
+  554, 150, 902, 0, 0, 0, 0, 0, 0, 0, 0, 0, 776, 0, 0, 402,
+  0, 0, 707, 323, 939, 749, 672, 777, 47, 109, 2, 855, 958, 0, 0, 697,
+  0, 0, 0, 0, 0, 0, 0, 156, 551, 0, 30, 0, 420, 0, 0, 0,
+  0, 0, 0, 916, 443, 354, 0, 585, 0, 0, 0, 0, 603, 118, 394, 490,
+  686, 744, 0, 51, 9, 483, 956, 0, 407, 0, 0, 0, 899, 0, 224, 0,
+  173, 0, 0, 0, 0, 459, 0, 0, 344, 0, 169, 737, 588, 0, 481, 0,
+  0, 0, 0, 570, 0, 0, 679, 892, 0, 0, 0, 0, 0, 0, 526, 227,
+  555, 398, 800, 0, 0, 0, 565, 0, 0, 0, 0, 853, 0, 0, 0, 0,
+  0, 0, 124, 321, 709, 532, 710, 617, 146, 378, 0, 191, 509, 651, 223, 0,
+  87, 162, 721, 732, 0, 0, 0, 0, 0, 657, 0, 0, 230, 0, 0, 148,
+  0, 0, 550, 0, 682, 725, 929, 333, 750, 99, 413, 429, 606, 0, 0, 54,
+  0, 0, 307, 780, 0, 417, 479, 602, 626, 933, 834, 0, 0, 690, 0, 0,
+  452, 0, 0, 0, 867, 292, 373, 0, 538, 0, 0, 0, 0, 0, 469, 0,
+  0, 0, 59, 0, 0, 485, 877, 575, 0, 0, 0, 864, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 427, 376, 275, 985, 0, 990, 206, 296, 0, 0,
+  0, 629, 759, 0, 1000, 446, 567, 594, 851, 0, 0, 457, 0, 0, 0, 0,
+  266, 0, 153, 912, 0, 276, 608, 0, 0, 525, 71, 695, 0, 0, 0, 26,
+  434, 683, 0, 0, 0, 0, 0, 0, 0, 0, 0, 249, 815, 886, 553, 134,
+  539, 0, 0, 0, 0, 39, 69, 880, 248, 623, 0, 0, 0, 0, 236, 0,
+  315, 716, 0, 0, 454, 0, 0, 0, 0, 930, 0, 0, 0, 924, 463, 984,
+  24, 522, 711, 0, 951, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 72,
+  332, 680, 0, 0, 399, 890, 0, 688, 794, 0, 0, 0, 0, 0, 164, 947,
+  390, 840, 0, 0, 154, 0, 0, 0, 741, 0, 482, 596, 0, 0, 0, 155,
+  366, 614, 817, 812, 0, 0, 0, 0, 0, 0, 0, 0, 396, 0, 0, 83,
+  0, 0, 0, 0, 0, 11, 67, 252, 260, 713, 975, 189, 0, 971, 0, 618,
+  0, 0, 40, 103, 331, 27, 461, 753, 395, 293, 830, 738, 193, 897, 931, 997,
+  754, 0, 0, 130, 465, 534, 61, 704, 785, 531, 425, 0, 0, 0, 850, 0,
+  0, 0, 0, 0, 341, 0, 0, 91, 175, 372, 624, 409, 866, 0, 932, 0,
+  440, 0, 274, 566, 0, 742, 126, 271, 0, 0, 0, 0, 0, 611, 996, 0,
+  0, 144, 317, 123, 256, 0, 0, 0, 0, 563, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 196, 0, 0, 0, 352, 530, 52, 308,
+  474, 848, 0, 584, 723, 0, 0, 167, 495, 941, 989, 0, 48, 0, 0, 445,
+  0, 0, 0, 0, 411, 0, 0, 0, 791, 283, 620, 0, 0, 0, 0, 0,
+  0, 192, 142, 0, 0, 0, 961, 0, 0, 0, 23, 257, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 170, 205, 313, 426, 77, 765, 790, 665, 607, 0, 0,
+  0, 0, 0, 0, 510, 0, 0, 768, 0, 0, 444, 822, 251, 921, 0, 182,
+  311, 0, 498, 255, 573, 577, 0, 76, 0, 0, 0, 0, 0, 0, 15, 105,
+  116, 0, 0, 0, 887, 536, 0, 0, 803, 0, 0, 502, 360, 441, 0, 701,
+  0, 1, 199, 10, 174, 735, 739, 919, 967, 999, 86, 430, 928, 0, 561, 179,
+  0, 0, 0, 0, 297, 535, 0, 0, 0, 0, 95, 244, 383, 970, 0, 859,
+  0, 0, 0, 131, 187, 229, 261, 612, 952, 974, 0, 400, 0, 0, 264, 0,
+  0, 0, 387, 507, 0, 0, 0, 809, 700, 0, 0, 320, 666, 0, 0, 0,
+  0, 0, 0, 736, 0, 403, 475, 363, 0, 751, 0, 114, 298, 494, 546, 0,
+  0, 184, 650, 901, 0, 0, 408, 923, 0, 79, 548, 492, 0, 0, 0, 0,
+  0, 0, 0, 139, 0, 0, 0, 419, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 128, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 367,
+  3, 0, 0, 0, 0, 808, 0, 0, 0, 0, 0, 0, 0, 0, 998, 0,
+  0, 0, 0, 0, 894, 140, 478, 145, 521, 757, 903, 0, 361, 0, 44, 0,
+  0, 0, 0, 0, 57, 0, 0, 0, 219, 410, 282, 760, 0, 797, 211, 857,
+  0, 946, 0, 468, 0, 0, 0, 801, 0, 172, 121, 0, 581, 0, 0, 871,
+  180, 97, 55, 50, 743, 909, 582, 910, 177, 0, 310, 0, 995, 0, 0, 976,
+  0, 458, 0, 837, 878, 0, 0, 0, 0, 703, 0, 852, 0, 0, 0, 0,
+  0, 0, 471, 0, 0, 699, 771, 981, 0, 0, 0, 0, 948, 204, 327, 460,
+  965, 80, 0, 0, 0, 0, 359, 135, 653, 0, 0, 0, 865, 0, 870, 0,
+  94, 537, 200, 451, 667, 693, 905, 962, 854, 136, 4, 968, 992, 0, 0, 0,
+  0, 0, 698, 0, 0, 0, 0, 844, 0, 825, 334, 920, 0, 0, 726, 0,
+  615, 338, 934, 0, 374, 583, 0, 0, 0, 347, 0, 208, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 108, 0, 477, 823, 914, 0, 195, 883, 895,
+  129, 38, 214, 14, 31, 421, 221, 149, 520, 619, 654, 762, 592, 0, 0, 746,
+  382, 943, 0, 0, 386, 70, 370, 496, 733, 100, 487, 678, 872, 328, 299, 501,
+  508, 529, 158, 789, 489, 202, 325, 745, 770, 828, 876, 787, 0, 0, 0, 358,
+  503, 98, 0, 518, 643, 786, 0, 836, 0, 497, 0, 0, 0, 0, 213, 29,
+  0, 0, 937, 0, 0, 8, 0, 0, 350, 0, 0, 545, 0, 0, 278, 670,
+};
+
+const char *WA_FREQ_121_TOKENS[] = {
+  "kɛ",
+  "gua",
+  "ɛ",
+  "th",
+  "k",
+  "ci",
+  "bɛ",
+  "ŋ",
+  "töm",
+  "tee",
+  "ɔ",
+  "r",
+  "banɛ",
+  "wä",
+  "ɛmi",
+  "mi",
+  "thia",
+  "waaŋ",
+  "cɛ",
+  "c",
+  "lo",
+  "ɛn",
+  "ɣöö",
+  "dee",
+  "raan",
+  "la",
+  "t",
+  "kɛnɛ",
+  "mɛri",
+  "nhɔk",
+  "kɛn",
+  "muuth",
+  "gɔ",
+  "ruacni",
+  "da",
+  "di",
+  "jɛn",
+  "lɛ",
+  "lä",
+  "mɔ",
+  "kɛl",
+  "cop",
+  "a",
+  "juëëy",
+  "mäni",
+  "duɔɔth",
+  "doth",
+  "ɣëy",
+  "cien",
+  "rɔ",
+  "thdu",
+  "bi",
+  "ŋuäc",
+};
+const uint16_t WA_FREQ_121_RANKS[] = {
+  0, 0, 9, 14, 10, 0, 0, 0, 0, 0, 0, 0, 29, 45, 50, 33,
+  0, 20, 31, 0, 0, 2, 0, 0, 42, 40, 28, 39, 7, 47, 15, 5,
+  0, 36, 27, 0, 0, 0, 0, 18, 0, 0, 0, 0, 41, 23, 13, 24,
+  49, 21, 0, 43, 0, 0, 53, 16, 30, 0, 0, 0, 1, 0, 22, 0,
+  8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 0, 0, 34, 32, 38, 0,
+  17, 0, 0, 0, 3, 0, 0, 0, 6, 19, 44, 0, 0, 37, 12, 52,
+  0, 11, 0, 0, 0, 0, 0, 0, 51, 4, 26, 0, 35, 46, 0, 0,
+};
+
+const char *WA_FREQ_122_TOKENS[] = {
+  "de",
+  "la",
+  "e",
+  "lo",
+  "a",
+  "que",
+  "en",
+  "per",
+  "un",
+  "es",
+  "del",
+  "las",
+  "una",
+  "dins",
+  "se",
+  "son",
+  "los",
+  "Lo",
+  "La",
+  "mai",
+  "al",
+  "pas",
+  "dels",
+  "o",
+  "amb",
+  "coma",
+  "sus",
+  "lei",
+  "dau",
+  "foguèt",
+  "tanben",
+  "En",
+  "Es",
+  "sa",
+  "entre",
+  "d'un",
+  "i",
+  "Los",
+  "au",
+  "dei",
+  "s",
+  "A",
+  "èra",
+  "fòrça",
+  "cap",
+  "mas",
+  "d'una",
+  "nom",
+  "deu",
+  "l",
+  "lenga",
+  "vila",
+  "pel",
+  "sègle",
+  "ans",
+  "municipalitat",
+  "pus",
+  "Se",
+  "an",
+  "Las",
+  "tres",
+  "dos",
+  "tot",
+  "leis",
+  "aquela",
+  "ua",
+  "n",
+  "pòt",
+  "ne",
+  "d",
+  "çò",
+  "fins",
+  "plan",
+  "Un",
+  "De",
+  "Per",
+  "temps",
+  "fin",
+  "partida",
+  "als",
+  "aquel",
+  "vilatge",
+  "part",
+  "li",
+  "fa",
+  "m",
+  "ont",
+  "sens",
+  "Dins",
+  "pauc",
+  "sul",
+  "país",
+  "qui",
+  "pels",
+  "region",
+  "far",
+  "si",
+  "situat",
+  "lor",
+  "p",
+  "primièr",
+  "foguèron",
+  "sieu",
+  "Pasmens",
+  "doas",
+  "sud",
+  "encara",
+  "Una",
+  "E",
+  "èsser",
+  "qu'ei",
+  "Son",
+  "francés",
+  "non",
+  "deis",
+  "França",
+  "vida",
+  "era",
+  "abitants",
+  "quand",
+  "dab",
+  "comuna",
+  "I",
+  "sos",
+  "occitan",
+  "còp",
+  "pendent",
+  "aquò",
+  "qu'es",
+  "après",
+  "Aquela",
+  "populacion",
+  "poder",
+  "ra",
+  "familha",
+  "eth",
+  "guèrra",
+  "dens",
+  "costat",
+  "forma",
+  "granda",
+  "partir",
+  "ja",
+  "mes",
+  "Lei",
+  "causa",
+  "èran",
+  "l'an",
+  "cada",
+  "occitana",
+  "Foguèt",
+  "qualques",
+  "estat",
+  "km",
+  "siá",
+  "annadas",
+  "Sant",
+  "Aquel",
+  "abans",
+  "biais",
+  "totes",
+  "deus",
+  "Que",
+  "t",
+  "st",
+  "Mas",
+  "dempuèi",
+  "sas",
+  "c",
+  "sovent",
+  "grand",
+  "segon",
+  "fach",
+  "mòrt",
+  "Tolosa",
+  "nos",
+  "politica",
+  "tota",
+  "venguèt",
+  "ri",
+  "mens",
+  "mond",
+  "Al",
+  "aviá",
+  "dire",
+  "lengas",
+  "nòrd",
+  "mei",
+  "durant",
+  "Sa",
+  "govèrn",
+  "important",
+  "ambé",
+  "contra",
+  "sei",
+  "periòde",
+  "grop",
+  "màger",
+  "nombre",
+  "centre",
+  "donc",
+  "el",
+  "va",
+  "exemple",
+  "cultura",
+  "jos",
+  "departament",
+  "des",
+  "importanta",
+  "sistèma",
+  "còntra",
+  "ven",
+  "ai",
+  "president",
+  "rei",
+  "r",
+  "drech",
+  "d’un",
+  "doncas",
+  "II",
+  "alara",
+  "lu",
+  "pr",
+  "moment",
+  "plaça",
+  "pòdon",
+  "b",
+  "faguèt",
+  "soa",
+  "com",
+  "dera",
+  "totjorn",
+  "territ",
+  "rd",
+  "meteis",
+  "cas",
+  "d'aquela",
+  "ble",
+  "trabalh",
+  "totas",
+  "començament",
+  "francesa",
+  "ciutat",
+  "deth",
+  "ara",
+  "puèi",
+  "situa",
+  "situada",
+  "còps",
+  "libre",
+  "Aquò",
+  "2",
+  "vèrs",
+  "Après",
+  "me",
+  "riu",
+  "sonque",
+  "conegut",
+  "tant",
+  "quatre",
+  "cal",
+  "linha",
+  "monde",
+  "jorn",
+  "regions",
+  "desvolopament",
+  "ho",
+  "res",
+  "autres",
+  "aprèp",
+  "mar",
+  "Estats",
+  "òbra",
+  "aquesta",
+  "l'entorn",
+  "veire",
+  "d'aquel",
+  "primièra",
+  "musica",
+  "territòri",
+  "membres",
+  "entà",
+  "junh",
+  "personas",
+  "perque",
+  "3",
+  "paire",
+  "solament",
+  "sieus",
+  "Joan",
+  "autre",
+  "serà",
+  "ben",
+  "qu'èra",
+  "1",
+  "capitala",
+  "segonda",
+  "estats",
+  "tornar",
+  "on",
+  "societat",
+  "luòc",
+  "pro",
+  "jòc",
+  "tr",
+  "ei",
+  "pichon",
+  "generalament",
+  "permet",
+  "vos",
+  "aver",
+  "10",
+  "d’una",
+  "ncia",
+  "tard",
+  "ròtle",
+  "jamai",
+  "aital",
+  "qu'a",
+  "aqueste",
+  "roman",
+  "movement",
+  "Ansin",
+  "4",
+  "formacion",
+  "isa",
+  "gl",
+  "rra",
+  "Guèrra",
+  "basa",
+  "ni",
+  "l'Empèri",
+  "Amb",
+  "subretot",
+  "vall",
+  "creacion",
+  "decembre",
+  "contunh",
+  "Coma",
+  "sc",
+  "camin",
+  "març",
+  "lors",
+  "aqueles",
+  "fòrças",
+  "setembre",
+  "situacion",
+  "importantas",
+  "agu",
+  "superfícia",
+  "París",
+  "dempu",
+  "produccion",
+  "5",
+  "segond",
+  "fan",
+  "batalha",
+  "literatura",
+  "public",
+  "Republica",
+  "òbras",
+  "venir",
+  "gaireben",
+  "km²",
+  "cors",
+  "tre",
+  "ca",
+  "seriá",
+  "milions",
+  "via",
+  "cinc",
+  "XIX",
+  "ba",
+  "l'armada",
+  "tipe",
+  "Conselh",
+  "finala",
+  "rota",
+  "parlar",
+  "jorns",
+  "d'aiga",
+  "le",
+  "re",
+  "damb",
+  "Units",
+  "julhet",
+  "presenta",
+  "latin",
+  "15",
+  "alavetz",
+  "general",
+  "uèi",
+  "mot",
+  "punt",
+  "20",
+  "anciana",
+  "III",
+  "novembre",
+  "aquí",
+  "novèla",
+  "Estats Units",
+  "long",
+  "6",
+  "pa",
+  "suls",
+  "Aquesta",
+  "Au",
+  "domeni",
+  "sol",
+  "d'autres",
+  "païses",
+  "succès",
+  "gràcias",
+  "tèrme",
+  "Quand",
+  "bastit",
+  "trobar",
+  "tèrra",
+  "sembla",
+  "mena",
+  "aguèt",
+  "nòstra",
+  "que's",
+  "comunas",
+  "et",
+  "projècte",
+  "òmes",
+  "còrs",
+  "Aqueste",
+  "posicion",
+  "principala",
+  "pichona",
+  "d'ara",
+  "filh",
+  "Pendent",
+  "avi",
+  "l’occitan",
+  "ditz",
+  "aquelas",
+  "30",
+  "vilas",
+  "camp",
+  "l'istòria",
+  "s'es",
+  "grands",
+  "Era",
+  "capitèt",
+  "totala",
+  "permetèt",
+  "Euròpa",
+  "Enfin",
+  "mitat",
+  "12",
+  "jol",
+  "nivèl",
+  "carrièra",
+  "tròp",
+  "majoritat",
+  "passa",
+  "ancian",
+  "tròba",
+  "7",
+  "politic",
+  "Èra",
+  "aqueu",
+  "comun",
+  "diferents",
+  "sègles",
+  "Tèrra",
+  "preséncia",
+  "Sud",
+  "8",
+  "passat",
+  "primi",
+  "avC",
+  "rt",
+  "cast",
+  "gaire",
+  "nomenat",
+  "glèisa",
+  "Revolucion",
+  "question",
+  "direccion",
+  "comencèt",
+  "ponch",
+  "s'i",
+  "lèu",
+  "L",
+  "rèi",
+  "teatre",
+  "autras",
+  "dinastia",
+  "premier",
+  "quitament",
+  "Segon",
+  "tropas",
+  "data",
+  "prèp",
+  "ras",
+  "rs",
+  "rason",
+  "membre",
+  "dich",
+  "tà",
+  "darrièr",
+  "foncion",
+  "maire",
+  "ò",
+  "Prèmi",
+  "anglés",
+  "autra",
+  "importants",
+  "meteissa",
+  "diferentas",
+  "ministre",
+  "seu",
+  "territòris",
+  "pasmens",
+  "Occitània",
+  "pòble",
+  "vista",
+  "qu’es",
+  "vòl",
+  "corrent",
+  "Grand",
+  "causas",
+  "natural",
+  "espècias",
+  "f",
+  "pres",
+  "particular",
+  "25",
+  "rapidament",
+  "ais",
+  "car",
+  "seis",
+  "l'origina",
+  "genièr",
+  "utilizat",
+  "9",
+  "títol",
+  "davant",
+  "fons",
+  "l'estat",
+  "benlèu",
+  "coneguda",
+  "ges",
+  "primièrs",
+  "senhor",
+  "seguida",
+  "Qu'ei",
+  "comte",
+  "IV",
+  "victòria",
+  "van",
+  "V",
+  "especialament",
+  "l'ora",
+  "bon",
+  "estada",
+  "nacionala",
+  "atal",
+  "tèxtes",
+  "14",
+  "armada",
+  "mès",
+  "limit",
+  "segur",
+  "sons",
+  "quilom",
+  "grèc",
+  "passar",
+  "Montpelhièr",
+  "Eth",
+  "grandas",
+  "18",
+  "Roma",
+  "l'occitan",
+  "ancians",
+  "Aprèp",
+  "Catalonha",
+  "conflicte",
+  "servici",
+  "egalament",
+  "possible",
+  "senhors",
+  "òme",
+  "Fa",
+  "Pèire",
+  "16",
+  "debuta",
+  "13",
+  "onte",
+  "Loís",
+  "color",
+  "contraròtle",
+  "partit",
+  "d'agost",
+  "d'èsser",
+  "febrièr",
+  "gle",
+  "grops",
+  "sota",
+  "Partit",
+  "formas",
+  "XX",
+  "natura",
+  "mondiala",
+  "tan",
+  "occitans",
+  "noms",
+  "persona",
+  "Durant",
+  "nombroses",
+  "pòrta",
+  "tòca",
+  "divèrsas",
+  "epòca",
+  "Nòrd",
+  "aquelei",
+  "compausat",
+  "principalament",
+  "genre",
+  "considerat",
+  "d'ua",
+  "deguèt",
+  "sola",
+  "17",
+  "Glèisa",
+  "demanda",
+  "d'origina",
+  "dona",
+  "l'oèst",
+  "província",
+  "sustot",
+  "american",
+  "pren",
+  "l'epòca",
+  "mon",
+  "Cap",
+  "mentre",
+  "Le",
+  "catalan",
+  "elegit",
+  "gentilici",
+  "vengut",
+  "femna",
+  "realitat",
+  "font",
+  "tal",
+  "torn",
+  "melhor",
+  "nòstre",
+  "bourg",
+  "ria",
+  "Fran",
+  "nombrosas",
+  "relacions",
+  "còr",
+  "l'aiga",
+  "mau",
+  "principalas",
+  "Comuna",
+  "militar",
+  "tradicion",
+  "demòra",
+  "l'èst",
+  "contrari",
+  "format",
+  "més",
+  "Tot",
+  "2007",
+  "D'efèct",
+  "Leis",
+  "parr",
+  "Puei",
+  "mejana",
+  "municipalitats",
+  "enter",
+  "plana",
+  "Barcelona",
+  "Mai",
+  "camps",
+  "crisi",
+  "demorèt",
+  "còs",
+  "mejans",
+  "mesura",
+  "Aqueles",
+  "Dempuèi",
+  "rèsta",
+  "principi",
+  "bastida",
+  "passatge",
+  "tractat",
+  "revista",
+  "entraïnèt",
+  "filha",
+  "umana",
+  "000",
+  "Cada",
+  "du",
+  "faire",
+  "site",
+  "ch",
+  "traversat",
+  "economica",
+  "manca",
+  "novèlas",
+  "pichons",
+  "qu'an",
+  "M",
+  "condicions",
+  "naut",
+  "Sus",
+  "mitan",
+  "d'autras",
+  "lista",
+  "anar",
+  "l'illa",
+  "N",
+  "creat",
+  "of",
+  "puei",
+  "2006",
+  "22",
+  "formar",
+  "Qualques",
+  "prene",
+  "presa",
+  "qualitat",
+  "version",
+  "alemand",
+  "man",
+  "bona",
+  "romana",
+  "relativament",
+  "bastiment",
+  "combat",
+  "patz",
+  "dicha",
+  "mots",
+  "qu'un",
+  "Tanben",
+  "bastir",
+  "jove",
+  "maugrat",
+  "mètres",
+  "parla",
+  "teoria",
+  "11",
+  "carri",
+  "l'òbra",
+  "meses",
+  "talha",
+  "abbaye",
+  "Edat",
+  "avián",
+  "religion",
+  "tornèt",
+  "estudis",
+  "programa",
+  "divèrsei",
+  "China",
+  "Santa",
+  "24",
+  "donar",
+  "montanha",
+  "seuna",
+  "Dieu",
+  "Maria",
+  "21",
+  "besonh",
+  "moriguèt",
+  "crear",
+  "generau",
+  "l'Universitat",
+  "lingüistica",
+  "lutz",
+  "quasi",
+  "2000",
+  "gu",
+  "istoric",
+  "2009",
+  "actuala",
+  "les",
+  "peu",
+  "2005",
+  "Nobel",
+  "Provença",
+  "cadun",
+  "marge",
+  "dempuei",
+  "sortida",
+  "viure",
+  "d'en",
+  "debanèt",
+  "19",
+  "2008",
+  "Val",
+  "mejan",
+  "mission",
+  "referéncia",
+  "vist",
+  "annada",
+  "elements",
+  "enfants",
+  "oras",
+  "construccion",
+  "nòu",
+  "professor",
+  "dus",
+  "libres",
+  "quia",
+  "vin",
+  "carga",
+  "ieu",
+  "l'emperaire",
+  "na",
+  "comèrci",
+  "negre",
+  "romans",
+  "militara",
+  "Segonda",
+  "activitats",
+  "compte",
+  "conquista",
+  "mantun",
+  "nasquèt",
+  "Parlament",
+  "atau",
+  "novèl",
+  "superficia",
+  "tèrras",
+  "ela",
+  "reiaume",
+  "activitat",
+  "modèl",
+  "planeta",
+  "rta",
+  "XVIII",
+  "ena",
+  "l'autor",
+  "pes",
+  "valor",
+  "2004",
+  "fàcia",
+  "l'autre",
+  "fòrt",
+  "practica",
+  "Francés",
+  "XVI",
+  "daus",
+  "famós",
+  "fraire",
+  "regional",
+  "val",
+  "istòria",
+  "l'annada",
+  "personatge",
+  "País",
+  "ath",
+  "d'altitud",
+  "dintre",
+  "mal",
+  "pont",
+  "temperatura",
+  "premiera",
+  "2010",
+  "26",
+  "eles",
+  "essent",
+  "Cal",
+  "d'octobre",
+  "poesia",
+  "tornarmai",
+  "occitanas",
+  "scenari",
+  "Aqueu",
+  "trabalhs",
+  "Entre",
+  "er",
+  "lac",
+  "bas",
+  "cort",
+  "subre",
+  "donat",
+  "escrivan",
+  "representa",
+  "blanc",
+  "longa",
+  "pr'amor",
+  "23",
+  "aus",
+  "Atal",
+  "Congrès",
+  "campanha",
+  "publica",
+  "aperaqu",
+  "der",
+  "mesa",
+  "nascut",
+  "rre",
+  "significa",
+  "economic",
+  "mòstra",
+  "sièis",
+  "Malgrat",
+  "The",
+  "nivèu",
+  "saber",
+  "sap",
+  "certanei",
+  "comunicacion",
+  "in",
+  "28",
+  "Aquelas",
+  "ostals",
+  "personatges",
+  "Empèri",
+  "Jean",
+  "Prèmi Nobel",
+  "autor",
+  "sector",
+  "cau",
+  "Aital",
+  "alemanda",
+  "caps",
+  "l'Union",
+  "ma",
+  "1980",
+  "clima",
+  "l'òme",
+  "probablament",
+  "1970",
+  "Alemanha",
+  "as",
+  "castèl",
+  "mi",
+  "utilizada",
+  "gran",
+  "guèrras",
+  "1960",
+  "Itàlia",
+  "decidiguèt",
+  "division",
+  "ectaras",
+  "fòra",
+  "massa",
+  "ten",
+  "div",
+  "divèrses",
+  "matèria",
+  "regim",
+  "relacion",
+  "u",
+  "2012",
+  "VI",
+  "XIII",
+  "defensa",
+  "actual",
+  "gascon",
+  "seria",
+  "Sos",
+  "classa",
+  "Espanha",
+  "afluent",
+  "l'Estat",
+  "movements",
+  "d'abril",
+  "eleccions",
+  "bassa",
+  "dreches",
+  "ensems",
+  "27",
+  "culturas",
+  "d'aquesta",
+  "hèra",
+  "longor",
+  "sala",
+  "n'es",
+  "principaus",
+  "viu",
+  "XIV",
+  "amassa",
+  "combats",
+  "l'o",
+  "seus",
+  "travèrs",
+  "dinc",
+  "filme",
+  "institucions",
+  "venguèron",
+  "2011",
+  "ligat",
+  "retorn",
+  "seguent",
+  "dificultats",
+  "actualament",
+  "1990",
+};
+const uint16_t WA_FREQ_122_RANKS[] = {
+  0, 879, 62, 534, 0, 507, 714, 0, 346, 710, 0, 0, 0, 0, 955, 23,
+  937, 245, 732, 831, 0, 0, 0, 22, 361, 0, 0, 618, 645, 517, 358, 0,
+  604, 931, 727, 824, 0, 0, 662, 47, 287, 479, 414, 617, 754, 49, 70, 239,
+  655, 770, 225, 444, 0, 25, 737, 521, 299, 0, 874, 603, 458, 686, 622, 397,
+  491, 709, 276, 778, 0, 0, 821, 499, 0, 139, 77, 119, 0, 0, 0, 0,
+  0, 116, 243, 965, 907, 35, 0, 0, 0, 470, 186, 484, 615, 462, 316, 0,
+  202, 0, 0, 0, 0, 0, 0, 0, 266, 0, 0, 0, 0, 795, 0, 0,
+  385, 0, 0, 65, 421, 328, 687, 0, 0, 0, 0, 102, 0, 124, 912, 0,
+  0, 424, 0, 721, 832, 0, 545, 0, 581, 671, 762, 0, 0, 0, 172, 0,
+  525, 649, 0, 0, 0, 53, 508, 0, 0, 0, 0, 584, 48, 92, 481, 0,
+  0, 390, 730, 101, 0, 330, 794, 419, 326, 0, 961, 177, 681, 161, 811, 0,
+  0, 0, 0, 0, 0, 0, 988, 553, 777, 560, 0, 0, 32, 0, 152, 869,
+  929, 128, 0, 471, 262, 539, 0, 423, 0, 0, 411, 0, 0, 0, 0, 451,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 235, 0, 0, 0,
+  0, 0, 650, 891, 957, 0, 0, 0, 0, 0, 0, 0, 0, 105, 0, 273,
+  789, 228, 631, 492, 0, 785, 171, 0, 0, 0, 0, 0, 0, 623, 0, 0,
+  0, 0, 412, 633, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 871, 0,
+  0, 0, 0, 0, 637, 0, 0, 0, 0, 976, 0, 802, 0, 0, 0, 0,
+  0, 735, 0, 707, 609, 0, 0, 0, 0, 466, 990, 72, 0, 880, 0, 0,
+  864, 0, 0, 89, 0, 0, 0, 0, 0, 582, 0, 54, 607, 0, 0, 0,
+  551, 0, 319, 0, 628, 0, 0, 562, 0, 0, 774, 611, 57, 60, 394, 0,
+  992, 254, 0, 0, 0, 757, 0, 43, 193, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 570, 141, 0, 0, 0, 676, 917, 0, 0, 237, 698, 0, 204, 216,
+  495, 533, 0, 974, 407, 0, 0, 0, 0, 0, 441, 0, 0, 279, 0, 695,
+  289, 0, 746, 0, 256, 897, 118, 555, 792, 344, 983, 0, 0, 363, 107, 0,
+  8, 26, 0, 236, 0, 0, 0, 433, 913, 0, 185, 0, 0, 0, 454, 0,
+  568, 0, 293, 255, 895, 0, 738, 892, 0, 0, 690, 0, 278, 896, 906, 0,
+  0, 0, 635, 5, 312, 442, 476, 751, 799, 0, 0, 759, 934, 0, 0, 0,
+  0, 196, 0, 0, 0, 0, 309, 0, 94, 944, 0, 352, 233, 429, 112, 115,
+  292, 672, 379, 771, 0, 0, 0, 0, 387, 0, 0, 682, 0, 0, 0, 554,
+  163, 365, 586, 0, 0, 461, 899, 0, 0, 0, 0, 437, 918, 0, 0, 0,
+  0, 680, 692, 0, 0, 0, 404, 0, 38, 71, 0, 0, 264, 0, 0, 0,
+  614, 660, 787, 0, 156, 940, 0, 0, 0, 0, 0, 0, 0, 728, 46, 558,
+  0, 0, 501, 0, 720, 0, 0, 0, 0, 689, 0, 143, 0, 0, 0, 64,
+  659, 123, 418, 0, 489, 683, 0, 0, 0, 0, 197, 724, 0, 0, 860, 0,
+  674, 0, 227, 0, 0, 0, 19, 0, 261, 0, 45, 148, 189, 998, 0, 0,
+  0, 133, 0, 696, 0, 0, 283, 321, 320, 333, 652, 843, 96, 593, 898, 67,
+  323, 450, 769, 157, 0, 0, 274, 0, 0, 0, 0, 0, 0, 606, 0, 0,
+  339, 923, 0, 0, 0, 351, 0, 0, 0, 0, 924, 0, 0, 0, 0, 63,
+  0, 449, 226, 271, 651, 0, 210, 313, 0, 0, 0, 0, 39, 0, 964, 997,
+  0, 0, 229, 405, 782, 0, 277, 673, 0, 0, 0, 0, 0, 222, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 969, 963, 0, 0, 701, 848, 948, 318,
+  0, 0, 0, 0, 443, 819, 218, 0, 0, 537, 0, 0, 556, 0, 0, 0,
+  793, 0, 977, 0, 893, 181, 0, 0, 127, 87, 178, 0, 280, 0, 478, 734,
+  0, 837, 0, 805, 0, 0, 0, 345, 244, 636, 253, 953, 0, 0, 203, 0,
+  80, 557, 0, 0, 0, 520, 0, 927, 700, 0, 314, 464, 626, 644, 0, 0,
+  669, 0, 100, 388, 0, 0, 950, 0, 0, 198, 31, 246, 841, 865, 0, 0,
+  661, 888, 303, 325, 0, 445, 0, 0, 0, 0, 0, 391, 0, 88, 304, 134,
+  383, 0, 0, 0, 594, 465, 0, 0, 0, 0, 0, 0, 838, 130, 887, 856,
+  0, 0, 242, 0, 85, 0, 0, 889, 258, 0, 786, 0, 0, 0, 629, 0,
+  386, 24, 0, 852, 142, 355, 475, 747, 251, 818, 263, 515, 780, 653, 639, 960,
+  66, 4, 435, 973, 0, 0, 0, 0, 0, 532, 0, 440, 796, 0, 40, 699,
+  0, 0, 0, 516, 768, 503, 0, 0, 0, 374, 498, 36, 12, 395, 518, 808,
+  941, 980, 989, 911, 868, 0, 0, 0, 0, 0, 0, 17, 104, 324, 986, 0,
+  0, 776, 0, 0, 0, 0, 0, 0, 741, 0, 0, 749, 230, 0, 37, 158,
+  342, 580, 0, 27, 0, 83, 803, 0, 0, 0, 0, 317, 106, 468, 0, 0,
+  425, 0, 745, 0, 970, 0, 224, 0, 0, 0, 585, 541, 0, 743, 0, 0,
+  359, 0, 120, 0, 59, 370, 823, 0, 0, 477, 999, 270, 98, 0, 0, 742,
+  0, 0, 0, 0, 0, 0, 0, 0, 854, 0, 0, 0, 0, 0, 0, 0,
+  0, 366, 0, 901, 543, 248, 493, 600, 0, 612, 638, 0, 0, 275, 473, 908,
+  0, 0, 781, 801, 861, 240, 0, 717, 0, 900, 0, 596, 126, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 453, 0, 536, 978, 764, 0, 0, 332, 0, 790,
+  0, 0, 353, 0, 0, 763, 0, 0, 0, 866, 0, 82, 0, 284, 14, 286,
+  0, 0, 0, 0, 0, 111, 269, 0, 0, 0, 188, 0, 315, 338, 0, 684,
+  20, 377, 967, 921, 0, 0, 457, 830, 0, 0, 0, 0, 452, 488, 840, 0,
+  0, 523, 0, 0, 514, 0, 886, 920, 0, 849, 41, 0, 0, 0, 0, 362,
+  675, 0, 164, 883, 0, 0, 52, 578, 135, 0, 0, 426, 241, 180, 296, 250,
+  378, 722, 268, 756, 814, 0, 69, 0, 0, 0, 804, 84, 646, 708, 10, 131,
+  504, 563, 336, 666, 0, 0, 713, 0, 0, 93, 327, 572, 863, 389, 349, 334,
+  217, 249, 369, 993, 0, 0, 641, 209, 90, 0, 0, 0, 0, 712, 149, 9,
+  194, 431, 624, 810, 97, 0, 380, 427, 723, 613, 752, 0, 753, 0, 0, 0,
+  0, 282, 0, 0, 0, 0, 0, 0, 0, 872, 129, 668, 528, 153, 430, 919,
+  987, 0, 375, 413, 455, 704, 882, 706, 0, 0, 0, 0, 170, 0, 0, 0,
+  322, 561, 579, 0, 0, 136, 0, 627, 535, 576, 736, 1, 744, 946, 0, 0,
+  0, 670, 400, 456, 0, 827, 0, 0, 0, 0, 0, 0, 0, 0, 0, 436,
+  750, 0, 812, 783, 0, 0, 0, 0, 0, 403, 0, 0, 0, 972, 0, 0,
+  340, 511, 0, 335, 114, 873, 705, 0, 211, 0, 0, 0, 0, 0, 760, 807,
+  0, 0, 0, 0, 0, 486, 877, 0, 482, 0, 0, 176, 903, 0, 212, 531,
+  0, 215, 550, 0, 0, 234, 0, 0, 0, 0, 0, 0, 368, 583, 0, 29,
+  657, 376, 0, 260, 0, 0, 0, 347, 0, 0, 0, 0, 930, 0, 996, 634,
+  76, 0, 0, 859, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 401, 0, 200, 183, 697, 306, 530, 467, 991, 30, 0, 0, 485, 0, 0,
+  905, 0, 0, 0, 28, 56, 595, 0, 0, 0, 0, 291, 68, 800, 815, 540,
+  958, 0, 0, 0, 0, 766, 825, 0, 0, 483, 0, 935, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 813, 0, 0, 0, 0,
+  34, 0, 833, 0, 0, 160, 0, 0, 0, 0, 381, 0, 0, 853, 0, 95,
+  252, 307, 834, 691, 463, 460, 490, 174, 294, 360, 851, 875, 0, 0, 0, 806,
+  0, 0, 0, 0, 0, 0, 0, 288, 0, 0, 151, 0, 341, 0, 0, 693,
+  529, 630, 0, 0, 16, 21, 925, 0, 605, 566, 890, 0, 932, 103, 0, 295,
+  192, 0, 0, 0, 0, 373, 0, 0, 0, 0, 0, 0, 0, 656, 0, 0,
+  371, 0, 0, 86, 894, 0, 219, 191, 867, 0, 0, 0, 0, 0, 0, 367,
+  519, 956, 415, 428, 472, 773, 862, 939, 0, 844, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 573, 748, 438, 55, 0, 640, 0, 0, 0, 125, 878, 0,
+  206, 0, 505, 0, 0, 399, 0, 167, 122, 0, 952, 904, 182, 108, 281, 876,
+  755, 0, 0, 354, 0, 0, 685, 0, 145, 0, 0, 0, 740, 231, 0, 0,
+  510, 526, 0, 971, 0, 565, 0, 0, 0, 0, 0, 207, 285, 658, 761, 0,
+  0, 0, 13, 0, 647, 265, 199, 364, 439, 590, 979, 826, 985, 175, 396, 933,
+  0, 0, 0, 0, 0, 0, 0, 173, 0, 0, 664, 954, 0, 549, 18, 0,
+  0, 290, 0, 0, 0, 922, 155, 0, 0, 663, 162, 0, 0, 0, 0, 1000,
+  0, 0, 0, 0, 0, 0, 205, 949, 0, 132, 0, 0, 0, 0, 885, 238,
+  620, 711, 0, 828, 597, 0, 0, 297, 765, 779, 0, 74, 257, 0, 0, 0,
+  0, 0, 0, 0, 0, 548, 0, 0, 0, 117, 791, 0, 497, 0, 15, 146,
+  726, 494, 816, 0, 0, 0, 822, 855, 0, 220, 110, 0, 0, 0, 0, 0,
+  839, 382, 0, 3, 564, 767, 0, 0, 138, 223, 719, 0, 0, 678, 718, 0,
+  0, 0, 0, 0, 144, 0, 0, 0, 0, 422, 474, 0, 942, 0, 0, 850,
+  496, 968, 981, 0, 42, 44, 348, 402, 733, 154, 469, 184, 0, 208, 502, 559,
+  0, 522, 0, 0, 0, 0, 0, 0, 0, 0, 0, 845, 842, 0, 91, 0,
+  0, 0, 538, 0, 0, 0, 75, 343, 909, 0, 0, 0, 0, 0, 0, 0,
+  0, 994, 0, 113, 267, 527, 577, 702, 945, 667, 0, 0, 0, 0, 0, 0,
+  546, 78, 232, 58, 432, 0, 835, 159, 506, 51, 0, 0, 0, 0, 0, 0,
+  0, 679, 775, 0, 0, 165, 187, 350, 398, 33, 0, 393, 0, 0, 0, 195,
+  574, 7, 936, 938, 926, 0, 0, 150, 213, 446, 0, 0, 221, 0, 0, 571,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 847, 392, 602, 625, 247, 951,
+  0, 0, 0, 0, 587, 409, 410, 434, 214, 331, 512, 984, 0, 300, 0, 0,
+  0, 0, 589, 329, 11, 797, 0, 0, 0, 0, 642, 0, 784, 447, 259, 729,
+  416, 798, 910, 608, 654, 975, 544, 715, 870, 0, 0, 567, 621, 73, 966, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 591, 542, 599, 50, 0, 0, 179,
+  357, 0, 0, 0, 0, 0, 547, 0, 0, 569, 0, 0, 0, 0, 552, 601,
+  0, 772, 0, 0, 619, 0, 0, 0, 694, 509, 0, 0, 140, 406, 731, 817,
+  487, 0, 0, 0, 0, 0, 408, 943, 0, 0, 2, 0, 716, 0, 0, 0,
+  0, 928, 99, 384, 836, 311, 448, 588, 598, 846, 61, 0, 0, 788, 420, 902,
+  610, 169, 677, 0, 982, 725, 0, 0, 0, 0, 0, 592, 616, 703, 79, 0,
+  0, 0, 166, 147, 959, 0, 0, 109, 6, 298, 915, 0, 310, 480, 665, 995,
+  0, 0, 337, 829, 0, 0, 0, 0, 190, 524, 688, 739, 513, 0, 914, 0,
+  0, 137, 0, 0, 575, 0, 0, 0, 0, 0, 168, 643, 0, 0, 962, 0,
+  0, 0, 0, 0, 0, 0, 648, 356, 881, 372, 272, 820, 947, 0, 0, 500,
+  0, 916, 0, 0, 632, 809, 302, 0, 201, 0, 0, 758, 0, 0, 0, 0,
+  121, 301, 417, 305, 459, 0, 858, 0, 0, 884, 0, 308, 857, 0, 81, 0,
+};
+
+const char *WA_FREQ_123_TOKENS[] = {
+  "kan",
+  "fi",
+  "akka",
+  "yoo",
+  "ta'u",
+  "dha",
+  "tokko",
+  "kessatti",
+  "immo",
+  "hin",
+  "kana",
+  "kessa",
+  "keessatti",
+  "Oromoo",
+  "bara",
+  "irratti",
+  "irra",
+  "isaa",
+  "gara",
+  "kuni",
+  "keessaa",
+  "argamu",
+  "ture",
+  "kunis",
+  "keessa",
+  "itti",
+  "waan",
+  "yeroo",
+  "jedhamu",
+  "kun",
+  "hanga",
+  "biyya",
+  "Afaan",
+  "ni",
+  "yokan",
+  "nama",
+  "qaba",
+  "qabu",
+  "lafa",
+  "bakka",
+  "Itoophiyaa",
+  "walitti",
+  "argamtu",
+  "malee",
+  "Bara",
+  "booda",
+  "bayye",
+  "afaan",
+  "ofii",
+  "ta'an",
+  "mana",
+  "ummata",
+  "wajjin",
+  "adda",
+  "maqaa",
+  "ta'e",
+  "akkasumas",
+  "of",
+  "Oromiyaa",
+  "garuu",
+  "ta’u",
+  "argama",
+  "immoo",
+  "bishaan",
+  "irraa",
+  "naannoo",
+  "ta'a",
+  "magaalaa",
+  "sadarkaa",
+  "jiru",
+  "isa",
+  "kanaa",
+  "gossa",
+  "bahaatti",
+  "danda'a",
+  "isaan",
+  "ummatta",
+  "Eshiyaa",
+  "argaman",
+  "yerro",
+  "biraa",
+  "isaanii",
+  "inni",
+  "Haa",
+  "aanaa",
+  "danda'u",
+  "baayyee",
+  "hundoofte",
+  "Afrikaa",
+  "addunyaa",
+  "odolaarraa",
+  "godina",
+  "adunya",
+  "guddaa",
+  "osoo",
+  "ta'uu",
+  "sababa",
+  "gosa",
+  "hunda",
+  "isaani",
+  "jalatti",
+  "kunii",
+  "turan",
+  "Yeroo",
+  "iin",
+  "jiraatu",
+  "Akka",
+  "amma",
+  "erga",
+  "gudda",
+  "haa",
+  "jalqabe",
+  "qillensa",
+  "addaa",
+  "ishee",
+  "jedhama",
+  "ol",
+  "saba",
+  "Kunis",
+  "dhibee",
+  "kanaan",
+  "karaa",
+  "namoota",
+  "qabdi",
+  "lafaa",
+  "mootummaa",
+  "tti",
+  "Kan",
+  "jedhu",
+  "jiddu",
+  "jira",
+  "parsentii",
+  "qaban",
+  "waggaa",
+  "namni",
+  "qabdu",
+  "ta'ee",
+  "taatu",
+  "gallana",
+  "Abbaa",
+  "Akkasumas",
+  "Oromoon",
+  "ishii",
+  "jedhame",
+  "waliin",
+  "biratti",
+  "birra",
+  "dura",
+  "godhe",
+  "uummata",
+  "Kuni",
+  "Maqaan",
+  "Sheek",
+  "baha",
+  "barumsaa",
+  "humna",
+  "warra",
+  "Addunyaa",
+  "Garba",
+  "aadaa",
+  "and",
+  "barumsa",
+  "biyyoota",
+  "jechuun",
+  "kibba",
+  "kutaa",
+  "kutta",
+  "laga",
+  "malle",
+  "ta’e",
+  "ykn",
+  "zonii",
+  "amantii",
+  "argamani",
+  "argamti",
+  "dhufee",
+  "jiran",
+  "miti",
+  "qubee",
+  "bodda",
+  "kanatti",
+  "sirna",
+  "wal",
+  "2005",
+  "Shawaa",
+  "durii",
+  "maqaan",
+  "meetira",
+  "namoonni",
+  "qabame",
+  "Dhihaa",
+  "Finfinnee",
+  "ergaa",
+  "harka",
+  "Arsii",
+  "Maccaa",
+  "ardii",
+  "barnoota",
+  "biyyotta",
+  "garaa",
+  "gargari",
+  "jedhamani",
+  "jiraatan",
+  "kaaba",
+  "kabba",
+  "kessaa",
+  "olii",
+  "protein",
+  "sadii",
+  "seenaa",
+  "tokkoffa",
+  "turte",
+  "Galaana",
+  "Kana",
+  "Oromo",
+  "amino",
+  "biyyaa",
+  "dhigaa",
+  "dubbatu",
+  "ishe",
+  "jedhaman",
+  "ka'e",
+  "lama",
+  "sadarka",
+  "tokkotti",
+  "waraana",
+  "Abdiisaa",
+  "Onesmoos",
+  "Wallagga",
+  "abbaa",
+  "baayyeen",
+  "bayee",
+  "fesashi",
+  "garba",
+  "hedduu",
+  "hojii",
+  "jirti",
+  "km²",
+  "manaa",
+  "mirga",
+  "n",
+  "ti",
+  "wagga",
+  "2",
+  "Bakki",
+  "Erga",
+  "Kunii",
+  "Naayil",
+  "ballina",
+  "bineensota",
+  "fulla",
+  "gargara",
+  "guddicha",
+  "guddoo",
+  "ittiin",
+  "jalqaba",
+  "jedhamee",
+  "jedhamuun",
+  "jirru",
+  "kilometers",
+  "lubbu",
+  "namaa",
+  "oromoo",
+  "percentii",
+  "waraanaa",
+  "Afrikaatti",
+  "Bahaa",
+  "Magaalaan",
+  "barreeffama",
+  "bekkama",
+  "ganna",
+  "jala",
+  "jechu",
+  "jirra",
+  "jiruu",
+  "lammaffaa",
+  "qabachu",
+  "qabamu",
+  "qofa",
+  "sana",
+  "ta'in",
+  "turee",
+  "2007",
+  "Aanaan",
+  "Bilisummaa",
+  "Booranaa",
+  "Central",
+  "alla",
+  "barbachisaa",
+  "carraa",
+  "dhukkuba",
+  "hidhaa",
+  "jalqabaa",
+  "jalqaban",
+  "jijjirama",
+  "kuniin",
+  "persentiin",
+  "qabattu",
+  "qabxii",
+  "ummanni",
+  "ummataa",
+  "Agency",
+  "Ameerikaa",
+  "Jimmaa",
+  "Marsiin",
+  "Oromia",
+  "Statistical",
+  "Taaddasaa",
+  "ammaa",
+  "ammoo",
+  "bayyen",
+  "fakki",
+  "godhame",
+  "hundaa",
+  "jalla",
+  "jecha",
+  "kanaaf",
+  "magaala",
+  "mallattoo",
+  "miliyoona",
+  "mootummaan",
+  "qarqara",
+  "qoqqodama",
+  "tokkoo",
+  "wave",
+  "2005tti",
+  "Abbaan",
+  "Baaroo",
+  "Baha",
+  "Bakrii",
+  "G.C.",
+  "Gaara",
+  "Garaa",
+  "Garbi",
+  "Macaafa",
+  "Namoonni",
+  "Raashiyaa",
+  "Tanzania",
+  "Teslaan",
+  "United",
+  "addaan",
+  "bayyinan",
+  "biyyattii",
+  "busaa",
+  "danda'an",
+  "dhibaa",
+  "dhibeen",
+  "dorgommii",
+  "duraan",
+  "ft",
+  "haala",
+  "hunda'e",
+  "ka’e",
+  "mi",
+  "sochii",
+  "ta'aan",
+  "taate",
+  "tapha",
+  "vacuum",
+  "10",
+  "2006",
+  "24",
+  "30",
+  "Aanaa",
+  "Adda",
+  "Arabaa",
+  "Bakriin",
+  "Gadaa",
+  "Godina",
+  "Taayitaa",
+  "Tumsaa",
+  "Ummatni",
+  "Yoo",
+  "akkatta",
+  "anna",
+  "baay'ee",
+  "ballini",
+  "bayinna",
+  "beekkama",
+  "beekkamu",
+  "bekkamu",
+  "bishan",
+  "caalaa",
+  "calu",
+  "dhalate",
+  "dhiraa",
+  "diqqa",
+  "fayyadamu",
+  "gaafa",
+  "godha",
+  "haadha",
+  "iddoo",
+  "jalqabu",
+  "jiddutti",
+  "jiraata",
+  "kuniis",
+  "mirgaa",
+  "plasma",
+  "qaama",
+  "qabani",
+  "qabsoo",
+  "qarqarra",
+  "square",
+  "ta’an",
+  "tokkoffaa",
+  "warri",
+  "Aliin",
+  "Amboo",
+  "Antiraaksiin",
+  "Arsi",
+  "Birruu",
+  "Dr",
+  "E.C.",
+  "Ethiopia",
+  "Garuu",
+  "Gindabarat",
+  "Indiyaa",
+  "Itti",
+  "Jaarraa",
+  "Koloneel",
+  "Laga",
+  "Magaalaa",
+  "Mana",
+  "Olompiikii",
+  "Oromootti",
+  "Percentiin",
+  "Qulqulluu",
+  "Taaddasaan",
+  "Waldaa",
+  "World",
+  "Xurunash",
+  "Yuurooppi",
+  "acid",
+  "baayyinaan",
+  "bahaa",
+  "bahan",
+  "bakki",
+  "balaa",
+  "bayyina",
+  "biyyatti",
+  "bulaa",
+  "bulchiinsa",
+  "buna",
+  "calla",
+  "dafee",
+  "dhaaba",
+  "dhufe",
+  "dhufuu",
+  "dubartii",
+  "dubbatama",
+  "fayyida",
+  "gadi",
+  "galatti",
+  "gubba",
+  "guddaan",
+  "hafan",
+  "irraatti",
+  "jechuu",
+  "jedhamun",
+  "jedhamutti",
+  "jedhan",
+  "kanneen",
+  "kenna",
+  "kenya",
+  "kibbaan",
+  "lamaan",
+  "maatii",
+  "maqqa",
+  "namotta",
+  "odoo",
+  "qabaman",
+  "qabata",
+  "qabne",
+  "rakko",
+  "ta'anii",
+  "umurii",
+  "waa'ee",
+  "walii",
+  "yookan",
+  "4",
+  "Abdiisan",
+  "Bishaan",
+  "Borana",
+  "CSA",
+  "Eertiraan",
+  "Elemoon",
+  "Ijiipti",
+  "Itoophiyaan",
+  "Kibbaa",
+  "Maammoo",
+  "Madagascar",
+  "Naqamte",
+  "New",
+  "Ortodoksii",
+  "Parsentiin",
+  "Persentiin",
+  "Red",
+  "Tulluu",
+  "Tuulamaa",
+  "Yuunivarsiitii",
+  "albuuda",
+  "bana",
+  "beekkamti",
+  "bilisummaa",
+  "binensotta",
+  "darbee",
+  "demma",
+  "dheerina",
+  "dhibaan",
+  "dhihaan",
+  "dhuma",
+  "godhee",
+  "godinaalee",
+  "gogaa",
+  "gogga",
+  "guddina",
+  "guddo",
+  "hojji",
+  "ibsutti",
+  "ifaa",
+  "isaanis",
+  "isaas",
+  "jabba",
+  "jedhamti",
+  "jedhee",
+  "kennu",
+  "km",
+  "midhafame",
+  "nafa",
+  "namicha",
+  "persentii",
+  "qabamee",
+  "qabatee",
+  "qo'anno",
+  "qofaa",
+  "sabboonummaa",
+  "sanaa",
+  "seena",
+  "sirba",
+  "speed",
+  "suni",
+  "ta’ee",
+  "tilmamaan",
+  "turre",
+  "umuriin",
+  "utuu",
+  "walit",
+  "wamamu",
+  "warqee",
+  "xiyyaaraa",
+  "1",
+  "17",
+  "1997",
+  "40",
+  "Asteer",
+  "Baaroon",
+  "Chrysler",
+  "Dirre",
+  "Earth",
+  "Elemoo",
+  "Europe",
+  "Fayyaa",
+  "Greek",
+  "Haroo",
+  "Hayila",
+  "Keeniyaa",
+  "Kibba",
+  "Luba",
+  "Mazaamir",
+  "Nile",
+  "Paasifiik",
+  "Polandball",
+  "Poolaandi",
+  "Raashiyaan",
+  "The",
+  "Tsetse",
+  "Wallaga",
+  "ademma",
+  "ademsaa",
+  "afaanii",
+  "akkuma",
+  "ammaatti",
+  "argamanii",
+  "argate",
+  "baasii",
+  "baay'ina",
+  "bahaan",
+  "bayyee",
+  "bishaani",
+  "bodaa",
+  "danda'erra",
+  "dandeenye",
+  "dandeettii",
+  "daqiiqaa",
+  "dhabuu",
+  "dheeraa",
+  "dhumaa",
+  "diqqo",
+  "duraa",
+  "eega",
+  "fakkena",
+  "fiigicha",
+  "fixee",
+  "fuula",
+  "garee",
+  "garra",
+  "garu",
+  "godhu",
+  "gubbatti",
+  "guddate",
+  "guutuu",
+  "guyyaa",
+  "hedduun",
+  "hojjatu",
+  "ibsuuf",
+  "iffa",
+  "issa",
+  "jaarraa",
+  "jedhuu",
+  "jirran",
+  "keenya",
+  "koronaavaayirasii",
+  "lakkoofsa",
+  "lamatti",
+  "lamma",
+  "manneen",
+  "million",
+  "nami",
+  "oxygen",
+  "parsentiin",
+  "plate",
+  "qabate",
+  "qabatte",
+  "qalamu",
+  "radiation",
+  "sadaffa",
+  "sarara",
+  "tattu",
+  "tectonic",
+  "tilmaman",
+  "ummataan",
+  "waldaa",
+  "yaalii",
+  "100",
+  "1991",
+  "20",
+  "2009",
+  "24%",
+  "25%",
+  "3",
+  "Achiin",
+  "Achittis",
+  "Africa",
+  "Akkuma",
+  "Alii",
+  "Ambo",
+  "American",
+  "Atilaantiik",
+  "Baalee",
+  "Boodarra",
+  "Canadan",
+  "Dodola",
+  "Enamelii",
+  "Ethiopian",
+  "Finfinneetti",
+  "Gaanfa",
+  "Guddinaan",
+  "Gulf",
+  "Hanga",
+  "Islaamaa",
+  "Itoophiyaatti",
+  "Jimma",
+  "Jordaniin",
+  "Kanaaf",
+  "Kun",
+  "Kuttan",
+  "Limmuu",
+  "Mars",
+  "North",
+  "Ocean",
+  "Oromootin",
+  "Sarbiyaa",
+  "Space",
+  "States",
+  "Tea",
+  "USA",
+  "Waldaan",
+  "Wangeela",
+  "Waraana",
+  "achi",
+  "addunyaarraa",
+  "afur",
+  "ala",
+  "alaa",
+  "anne",
+  "baadiyyaa",
+  "badiyya",
+  "barate",
+  "biology",
+  "biyyi",
+  "buduni",
+  "bulchaa",
+  "cabbi",
+  "cabbin",
+  "deeme",
+  "deemee",
+  "dhibbantaan",
+  "dhihaa",
+  "dhimma",
+  "dubbatamu",
+  "duraaf",
+  "durra",
+  "energy",
+  "fluid",
+  "fudhatama",
+  "ga'e",
+  "gaddi",
+  "galu",
+  "garagara",
+  "gargar",
+  "godherra",
+  "gosaa",
+  "guddan",
+  "guddoon",
+  "haaraa",
+  "haati",
+  "hamaa",
+  "hamma",
+  "har’a",
+  "ibsetti",
+  "ii",
+  "ilallani",
+  "isaaf",
+  "isheen",
+  "ispoorii",
+  "ittin",
+  "jalaa",
+  "jedhamanii",
+  "jedhamtu",
+  "jedhanitti",
+  "jiraan",
+  "kara",
+  "kiyya",
+  "lachuu",
+  "lammaffa",
+  "lammaffatti",
+  "lipid",
+  "lubbuu",
+  "namatti",
+  "nyaata",
+  "nyatta",
+  "qabamanii",
+  "qabatu",
+  "qabee",
+  "qabuu",
+  "qilleensa",
+  "qorannoo",
+  "sabboonaa",
+  "salpha",
+  "seismic",
+  "shan",
+  "sunii",
+  "ta'eef",
+  "ta'uun",
+  "tajaajila",
+  "tissue",
+  "tokkollen",
+  "tropical",
+  "xiqqoo",
+  "yaada",
+  "yokaan",
+  "1998",
+  "20%",
+  "ABO",
+  "Abbabaa",
+  "Ahimad",
+  "Arkitiik",
+  "As",
+  "Atlantic",
+  "Bakka",
+  "Ballina",
+  "Bayyina",
+  "Biluu",
+  "Caamsaa",
+  "Chaayinaan",
+  "Dhibeen",
+  "Diimaa",
+  "East",
+  "Ergaa",
+  "Eritrean",
+  "Esparanto",
+  "Gibee",
+  "Gujii",
+  "Harar",
+  "Hasan",
+  "Hemisphere",
+  "II",
+  "Innis",
+  "Istaatistiksii",
+  "Kunimmoo",
+  "Mahaammad",
+  "May",
+  "Memorandumiin",
+  "Naannoo",
+  "Namoota",
+  "Nuclear",
+  "Obbo",
+  "Oceaniin",
+  "Oromoof",
+  "Oromoota",
+  "Qoqqodama",
+  "Sudaan",
+  "Suwiiz",
+  "Teslaa",
+  "UEFA",
+  "Ummanni",
+  "Ummata",
+  "Ummatti",
+  "Wallaggaa",
+  "abbaan",
+  "achiin",
+  "achitti",
+  "afraffaa",
+  "akkataa",
+  "antiraaksii",
+  "argatte",
+  "argatu",
+  "as",
+  "baayyen",
+  "barnootaa",
+  "barsiisaa",
+  "barsiisuu",
+  "bayeen",
+  "beekamu",
+  "biroo",
+  "blood",
+  "caala",
+  "cell",
+  "celli",
+  "crust",
+  "dandenne",
+  "dandettera",
+  "darbe",
+  "darbu",
+  "demmu",
+  "dhaan",
+  "dherinna",
+  "dhibba",
+  "dhiha",
+  "dhihoo",
+  "dhiira",
+  "du'an",
+  "dubartoota",
+  "dubbatan",
+  "fayyaa",
+  "fayyadama",
+  "fayyadaman",
+  "fayyadamuun",
+  "fiddu",
+  "fixxe",
+  "foon",
+  "fudhatame",
+  "fudhatee",
+  "gadii",
+  "gargaara",
+  "gazii",
+  "geggefame",
+  "genetic",
+  "glucose",
+  "gochuu",
+  "godhaa",
+  "goota",
+  "gubbaatti",
+  "guddinaan",
+  "guddinan",
+  "hiin",
+  "hundeffame",
+  "ibsame",
+  "ilalluf",
+  "ilma",
+  "isaatti",
+  "jabbena",
+  "jalqabee",
+  "jechii",
+  "jedhamuu",
+  "jirenya",
+  "jirrattu",
+  "ka",
+  "ka'ee",
+  "ka'uun",
+  "kanas",
+  "kibban",
+  "koo",
+  "laman",
+  "loltuu",
+  "mala",
+  "male",
+  "marrimaanii",
+  "mataa",
+  "meeshaa",
+  "miseensa",
+  "nannoo",
+  "nuti",
+  "obbo",
+  "ofiin",
+  "organizimotta",
+  "proteinotni",
+  "qabaatu",
+  "qabamuu",
+  "qabatotta",
+  "qodama",
+  "qofaan",
+  "qoffa",
+  "qotee",
+  "rakkoo",
+  "siyaasa",
+  "storm",
+  "sunitti",
+  "ta'un",
+  "taane",
+  "taatee",
+  "tajajilamuu",
+  "taphatta",
+  "tributary",
+  "tun",
+  "uume",
+  "waantotta",
+  "waldaan",
+  "warraa",
+  "yookaan",
+  "1000",
+  "1974",
+  "1994",
+  "1ffaa",
+  "2008",
+  "22",
+  "2ffaa",
+  "400",
+  "4ffaa",
+  "5",
+  "6",
+  "America",
+  "Awadaay",
+  "Baasiles",
+  "Blood",
+  "Boorana",
+  "British",
+  "Bulchaan",
+  "Bultoo",
+  "C",
+  "Carbon",
+  "Congenital",
+  "Daandiin",
+  "Dibaabaa",
+  "Duulaa",
+  "Eertiraa",
+  "Egypt",
+  "Emperor",
+  "Eritrea",
+  "G",
+  "Grand",
+  "Hararghe",
+  "IAAFn",
+  "Ibraahim",
+  "Iluu",
+  "Island",
+  "Kaaba",
+  "Kanarraa",
+  "Kenya",
+  "Kuniis",
+  "Lafaa",
+  "Latin",
+  "Liberation",
+  "Madagaskaar",
+  "Magaalli",
+  "Ministeera",
+  "Mootummaan",
+  "Moqaadishoo",
+  "Nasib",
+  "National",
+  "O",
+  "Oromootif",
+  "Planet",
+  "Plasman",
+  "Proteinotni",
+  "Qilxuu",
+  "Qubeen",
+  "Qulqulluun",
+  "Raas",
+  "Radiation",
+  "Saphaalloo",
+  "Shrek",
+  "Sillaasee",
+  "Siyaatil",
+  "Sochiin",
+  "Somaaliyaa",
+  "Sooviyeet",
+  "Suez",
+  "Taj",
+  "Tanzaaniyaa",
+};
+const uint16_t WA_FREQ_123_RANKS[] = {
+  0, 0, 0, 0, 0, 0, 314, 0, 0, 0, 0, 0, 615, 32, 0, 0,
+  828, 841, 0, 169, 0, 0, 0, 286, 429, 147, 655, 545, 659, 970, 644, 879,
+  445, 1000, 0, 0, 0, 685, 0, 0, 0, 0, 0, 953, 464, 67, 467, 356,
+  490, 621, 0, 0, 782, 59, 94, 98, 889, 386, 0, 108, 0, 590, 0, 0,
+  0, 179, 180, 187, 325, 602, 835, 0, 0, 0, 0, 0, 812, 0, 674, 977,
+  0, 365, 482, 737, 752, 733, 290, 0, 0, 0, 326, 265, 346, 433, 177, 593,
+  770, 901, 289, 896, 153, 0, 202, 598, 776, 0, 216, 296, 0, 0, 0, 0,
+  0, 603, 0, 208, 0, 0, 0, 858, 0, 802, 0, 0, 0, 0, 0, 174,
+  300, 451, 0, 0, 0, 0, 530, 143, 0, 0, 630, 0, 466, 51, 193, 0,
+  961, 319, 0, 0, 0, 882, 264, 880, 741, 0, 0, 626, 259, 756, 0, 618,
+  0, 0, 209, 844, 497, 668, 0, 0, 71, 0, 402, 0, 0, 0, 805, 0,
+  175, 493, 572, 870, 0, 0, 0, 0, 494, 0, 501, 627, 862, 0, 479, 993,
+  0, 0, 0, 0, 0, 114, 0, 0, 0, 0, 213, 534, 0, 0, 17, 196,
+  967, 0, 0, 0, 0, 0, 311, 488, 168, 0, 994, 0, 579, 0, 410, 510,
+  92, 0, 0, 800, 0, 0, 0, 0, 0, 35, 0, 0, 0, 0, 0, 22,
+  0, 0, 0, 0, 0, 815, 872, 440, 0, 0, 0, 0, 654, 0, 0, 0,
+  0, 403, 820, 505, 316, 518, 610, 248, 710, 854, 323, 204, 913, 997, 999, 0,
+  0, 0, 0, 0, 448, 735, 0, 0, 298, 70, 441, 588, 528, 595, 93, 887,
+  925, 0, 0, 0, 0, 278, 0, 27, 68, 0, 438, 0, 341, 0, 267, 0,
+  0, 288, 515, 522, 0, 0, 54, 0, 582, 945, 0, 0, 0, 0, 780, 0,
+  0, 0, 0, 531, 552, 474, 134, 589, 0, 83, 0, 943, 0, 0, 894, 821,
+  0, 958, 0, 0, 0, 0, 0, 933, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 189, 763, 473, 976, 0, 584, 0, 0, 606, 723, 992, 347, 312, 338, 0,
+  0, 162, 348, 0, 697, 0, 0, 0, 0, 0, 0, 0, 0, 377, 36, 491,
+  461, 520, 694, 642, 0, 0, 0, 282, 900, 0, 78, 0, 0, 898, 0, 0,
+  0, 0, 357, 366, 0, 0, 0, 587, 0, 0, 0, 0, 101, 0, 676, 442,
+  746, 492, 998, 566, 117, 871, 0, 0, 0, 0, 796, 0, 0, 415, 0, 0,
+  0, 0, 0, 0, 360, 935, 390, 0, 0, 707, 0, 968, 0, 0, 72, 564,
+  0, 13, 0, 236, 0, 734, 0, 0, 0, 0, 0, 0, 283, 831, 0, 0,
+  0, 0, 26, 121, 0, 0, 0, 0, 0, 185, 190, 980, 0, 0, 47, 0,
+  0, 0, 748, 0, 113, 0, 631, 137, 337, 215, 792, 0, 125, 0, 0, 0,
+  0, 0, 261, 28, 370, 0, 0, 0, 0, 0, 0, 0, 609, 0, 0, 926,
+  77, 46, 0, 142, 392, 322, 0, 170, 0, 154, 0, 0, 0, 0, 955, 231,
+  378, 0, 923, 0, 0, 349, 0, 559, 2, 791, 877, 915, 4, 62, 546, 75,
+  645, 714, 420, 837, 0, 0, 63, 318, 427, 0, 0, 0, 857, 0, 0, 0,
+  0, 0, 0, 513, 0, 396, 0, 0, 0, 0, 0, 0, 0, 478, 580, 628,
+  0, 948, 0, 84, 722, 0, 516, 0, 789, 0, 634, 0, 0, 374, 542, 241,
+  743, 817, 952, 0, 0, 0, 0, 0, 0, 150, 651, 0, 0, 484, 0, 986,
+  0, 0, 195, 0, 569, 0, 0, 0, 0, 823, 156, 0, 0, 0, 335, 0,
+  549, 836, 0, 0, 0, 399, 742, 906, 808, 851, 0, 0, 437, 0, 0, 594,
+  0, 652, 0, 0, 0, 0, 419, 0, 0, 0, 0, 0, 0, 667, 0, 869,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 82, 864, 0, 0, 0,
+  126, 359, 91, 0, 0, 0, 0, 0, 86, 0, 0, 391, 242, 251, 859, 507,
+  922, 0, 0, 394, 214, 223, 0, 526, 966, 0, 0, 0, 0, 0, 991, 0,
+  0, 556, 0, 0, 0, 0, 633, 0, 963, 0, 133, 0, 0, 0, 301, 611,
+  801, 671, 0, 0, 140, 0, 0, 0, 0, 0, 0, 0, 0, 0, 132, 171,
+  751, 0, 649, 0, 0, 0, 0, 0, 0, 708, 0, 0, 0, 294, 0, 0,
+  720, 0, 0, 537, 20, 543, 503, 0, 266, 0, 0, 49, 398, 0, 0, 0,
+  0, 658, 0, 412, 120, 787, 950, 0, 0, 110, 0, 910, 0, 0, 0, 85,
+  0, 475, 0, 638, 0, 274, 221, 689, 30, 905, 220, 757, 249, 861, 928, 799,
+  0, 0, 774, 0, 0, 842, 485, 565, 0, 0, 563, 364, 982, 0, 838, 996,
+  0, 122, 0, 849, 0, 0, 0, 343, 613, 0, 0, 257, 363, 591, 197, 280,
+  469, 790, 355, 158, 0, 199, 439, 0, 321, 920, 0, 0, 646, 0, 0, 0,
+  0, 109, 0, 562, 0, 0, 0, 0, 760, 0, 614, 480, 0, 843, 0, 0,
+  105, 0, 0, 0, 719, 0, 0, 0, 0, 0, 0, 0, 0, 0, 716, 0,
+  339, 539, 0, 453, 511, 529, 570, 648, 680, 693, 919, 924, 0, 0, 0, 276,
+  0, 444, 878, 0, 0, 0, 0, 0, 303, 0, 0, 417, 592, 0, 0, 55,
+  449, 0, 568, 0, 0, 0, 0, 253, 640, 715, 66, 732, 825, 912, 988, 502,
+  376, 481, 934, 555, 886, 12, 0, 0, 400, 0, 942, 687, 1, 0, 0, 0,
+  550, 0, 0, 0, 0, 506, 201, 0, 459, 0, 0, 669, 0, 0, 0, 0,
+  813, 0, 944, 0, 597, 371, 192, 0, 0, 159, 818, 795, 706, 0, 0, 0,
+  0, 0, 0, 69, 725, 0, 661, 0, 0, 0, 0, 0, 0, 0, 0, 401,
+  0, 816, 0, 0, 0, 0, 0, 0, 788, 866, 0, 194, 0, 650, 38, 931,
+  0, 0, 0, 533, 548, 0, 0, 0, 299, 96, 486, 8, 601, 969, 0, 0,
+  0, 868, 918, 0, 88, 313, 771, 0, 0, 635, 74, 198, 234, 305, 407, 57,
+  414, 476, 885, 0, 0, 0, 424, 0, 0, 0, 0, 0, 25, 0, 786, 0,
+  0, 0, 0, 0, 0, 308, 0, 747, 0, 0, 636, 237, 287, 389, 509, 888,
+  487, 560, 0, 0, 0, 0, 0, 0, 260, 295, 0, 452, 225, 873, 0, 0,
+  0, 0, 64, 304, 14, 0, 0, 0, 0, 947, 0, 0, 310, 0, 0, 148,
+  284, 379, 0, 981, 0, 0, 0, 0, 692, 0, 48, 0, 0, 0, 519, 909,
+  0, 704, 0, 0, 0, 558, 0, 0, 58, 172, 218, 462, 773, 0, 0, 0,
+  0, 0, 0, 0, 431, 758, 0, 0, 498, 0, 761, 0, 0, 382, 0, 893,
+  0, 423, 0, 0, 0, 0, 0, 0, 705, 418, 574, 0, 352, 211, 375, 698,
+  914, 0, 839, 932, 0, 0, 254, 521, 0, 876, 0, 0, 6, 0, 785, 0,
+  0, 767, 660, 798, 23, 0, 0, 44, 855, 783, 0, 116, 678, 245, 0, 0,
+  0, 0, 5, 222, 411, 724, 850, 867, 0, 941, 129, 240, 336, 764, 0, 0,
+  381, 939, 0, 0, 0, 0, 0, 205, 0, 0, 0, 97, 619, 465, 0, 711,
+  0, 730, 709, 0, 0, 0, 0, 247, 472, 0, 0, 0, 43, 768, 0, 0,
+  0, 0, 0, 41, 344, 0, 0, 0, 149, 0, 0, 0, 0, 421, 847, 0,
+  383, 178, 639, 0, 0, 0, 0, 653, 0, 0, 0, 607, 230, 749, 890, 908,
+  262, 95, 554, 604, 620, 0, 0, 0, 0, 0, 0, 0, 656, 541, 123, 0,
+  239, 0, 0, 0, 0, 0, 0, 102, 863, 0, 0, 0, 0, 477, 0, 0,
+  0, 232, 0, 624, 0, 0, 0, 0, 0, 0, 292, 297, 605, 0, 0, 127,
+  246, 833, 0, 42, 0, 362, 670, 0, 0, 0, 9, 0, 0, 406, 810, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 571, 623, 21, 0, 0, 0, 0,
+  272, 0, 0, 176, 567, 0, 0, 0, 0, 369, 203, 0, 681, 0, 0, 244,
+  596, 258, 0, 0, 0, 279, 814, 119, 0, 0, 0, 65, 684, 7, 45, 523,
+  576, 0, 0, 281, 0, 217, 0, 328, 155, 269, 428, 753, 0, 728, 0, 832,
+  0, 0, 350, 561, 0, 0, 686, 834, 0, 0, 0, 0, 39, 954, 0, 551,
+  0, 675, 0, 0, 0, 0, 385, 0, 625, 0, 0, 0, 0, 0, 0, 0,
+  81, 0, 713, 0, 0, 0, 0, 794, 726, 329, 772, 167, 152, 717, 930, 434,
+  696, 52, 874, 962, 483, 430, 291, 331, 354, 946, 0, 702, 964, 0, 0, 495,
+  18, 233, 777, 949, 0, 0, 937, 682, 0, 784, 883, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 612, 0, 0, 865, 0, 0, 0, 0,
+  0, 0, 0, 940, 0, 965, 0, 200, 972, 0, 0, 0, 0, 0, 320, 0,
+  0, 0, 846, 0, 131, 517, 0, 333, 0, 0, 408, 87, 0, 0, 793, 0,
+  188, 0, 608, 458, 532, 938, 238, 73, 250, 0, 0, 471, 0, 0, 0, 0,
+  0, 987, 138, 0, 956, 0, 0, 744, 425, 226, 975, 0, 508, 699, 0, 0,
+  340, 0, 0, 0, 3, 0, 585, 0, 0, 0, 778, 578, 664, 860, 829, 0,
+  0, 0, 0, 285, 840, 0, 0, 553, 24, 0, 183, 463, 0, 0, 0, 830,
+  0, 0, 0, 0, 0, 0, 0, 535, 512, 0, 895, 368, 811, 0, 112, 0,
+  128, 173, 15, 736, 0, 0, 252, 330, 0, 0, 0, 395, 581, 0, 0, 353,
+  500, 447, 405, 540, 936, 0, 971, 0, 0, 797, 0, 0, 0, 50, 524, 358,
+  106, 0, 111, 0, 745, 99, 130, 504, 759, 76, 136, 0, 0, 0, 0, 0,
+  0, 309, 629, 443, 740, 984, 468, 409, 0, 809, 544, 56, 0, 0, 0, 547,
+  0, 293, 0, 206, 144, 151, 617, 891, 277, 351, 527, 916, 0, 0, 0, 807,
+  0, 921, 243, 373, 856, 673, 762, 0, 0, 0, 0, 0, 0, 0, 0, 40,
+  573, 0, 0, 191, 0, 0, 10, 575, 60, 90, 115, 212, 641, 207, 324, 489,
+  583, 690, 271, 695, 701, 124, 0, 0, 146, 738, 0, 0, 852, 89, 0, 990,
+  0, 0, 599, 712, 0, 380, 929, 899, 268, 637, 0, 0, 974, 0, 306, 662,
+  804, 755, 679, 911, 0, 0, 0, 397, 470, 822, 902, 0, 927, 263, 0, 0,
+  33, 775, 0, 0, 0, 227, 0, 0, 803, 104, 16, 29, 557, 904, 0, 0,
+  0, 53, 0, 186, 0, 229, 334, 769, 161, 0, 0, 0, 0, 499, 0, 0,
+  0, 0, 0, 536, 0, 0, 141, 739, 0, 34, 0, 0, 0, 691, 307, 0,
+  0, 345, 0, 0, 446, 135, 766, 0, 413, 0, 0, 0, 647, 892, 118, 663,
+  666, 979, 181, 235, 332, 657, 0, 0, 256, 0, 727, 973, 903, 0, 19, 384,
+  721, 327, 538, 632, 219, 163, 165, 455, 683, 643, 881, 0, 31, 79, 884, 0,
+  0, 0, 0, 0, 0, 166, 315, 525, 436, 422, 983, 0, 0, 0, 0, 0,
+  917, 0, 460, 703, 0, 989, 0, 255, 0, 0, 0, 957, 0, 0, 0, 0,
+  0, 0, 103, 845, 622, 317, 388, 456, 729, 677, 765, 897, 0, 0, 107, 0,
+  273, 586, 665, 616, 960, 0, 0, 0, 0, 372, 779, 0, 0, 184, 367, 978,
+  0, 0, 0, 61, 450, 164, 224, 361, 907, 0, 0, 0, 0, 827, 0, 0,
+  0, 514, 426, 302, 435, 806, 819, 824, 951, 0, 0, 0, 145, 700, 0, 0,
+  0, 985, 0, 0, 718, 959, 995, 182, 0, 0, 0, 853, 0, 750, 0, 0,
+  0, 0, 228, 875, 0, 0, 0, 0, 457, 0, 160, 387, 404, 731, 848, 0,
+  0, 0, 600, 577, 0, 0, 0, 0, 100, 210, 0, 0, 0, 0, 157, 11,
+  0, 275, 0, 0, 0, 0, 80, 454, 0, 826, 37, 342, 416, 688, 0, 754,
+  0, 270, 0, 0, 432, 0, 0, 0, 139, 781, 393, 0, 496, 0, 672, 0,
+};
+
+const char *WA_FREQ_124_TOKENS[] = {
+  "ଓ",
+  "ଏହି",
+  "ଏକ",
+  "ସେ",
+  "ଏହା",
+  "ମଧ୍ୟ",
+  "ଅଟେ",
+  "କରି",
+  "ପାଇଁ",
+  "କରିଥିଲେ",
+  "ହୁଏ",
+  "ଏବଂ",
+  "ବା",
+  "ପରେ",
+  "ଜୀବ",
+  "ବଂଶର",
+  "ଡାଇନୋସର",
+  "ଏହାର",
+  "ରେ",
+  "ଥିବା",
+  "ଜଣେ",
+  "ଓଡ଼ିଆ",
+  "ହୋଇ",
+  "ସମୟରେ",
+  "ଥିଲେ",
+  "ମସିହାରେ",
+  "ଦ୍ଵାରା",
+  "ତାଙ୍କ",
+  "କରିବା",
+  "ଭାବେ",
+  "କରାଯାଏ",
+  "ଅନେକ",
+  "ରୋଗ",
+  "ତାଙ୍କର",
+  "ବୋଲି",
+  "ସହ",
+  "ଦିନ",
+  "ଓଡ଼ିଶାର",
+  "ଗୋଟିଏ",
+  "ଉପରେ",
+  "କଲେ",
+  "ମନ୍ଦିର",
+  "ମଧ୍ୟରେ",
+  "ଅଧିକ",
+  "ସହିତ",
+  "ନାହିଁ",
+  "ଏହାକୁ",
+  "ଭାବରେ",
+  "ର",
+  "ଥିଲା",
+  "ଆରମ୍ଭ",
+  "କିନ୍ତୁ",
+  "ହୋଇଥାଏ",
+  "ବିଭିନ୍ନ",
+  "ହେଉଛି",
+  "ହେଲେ",
+  "ତଥା",
+  "ବ୍ୟବହାର",
+  "ନିମନ୍ତେ",
+  "କିଛି",
+  "କରନ୍ତି",
+  "ପ୍ରଥମ",
+  "ନ",
+  "ହୋଇଥିଲା",
+  "ଅନ୍ୟ",
+  "ଜାତୀୟ",
+  "ହେଲା",
+  "ଜିଲ୍ଲା",
+  "ସେହି",
+  "ରହିଛି",
+  "ଭାରତୀୟ",
+  "ତାଙ୍କୁ",
+  "ନାମ",
+  "ବର୍ଷ",
+  "ହୋଇଥିଲେ",
+  "ତିଆରି",
+  "ଯାହା",
+  "ଅଛି",
+  "ଯେ",
+  "ଠାରୁ",
+  "ପୂଜା",
+  "ଏଠାରେ",
+  "ଅନୁସାରେ",
+  "ପର୍ଯ୍ୟନ୍ତ",
+  "ନିଜ",
+  "ଜିଲ୍ଲାର",
+  "କୁହାଯାଏ",
+  "ଭାରତର",
+  "କରିଥିଲା",
+  "ରୁ",
+  "ନିର୍ମିତ",
+  "ଥାଏ",
+  "କି",
+  "କୌଣସି",
+  "ଜନ୍ମ",
+  "କରେ",
+  "ବେଳେ",
+  "ଆଦି",
+  "ଗ୍ରହଣ",
+  "ନେଇ",
+  "ଅବସ୍ଥିତ",
+  "ହେବା",
+  "ରୂପେ",
+  "ଦେଇ",
+  "କେତେକ",
+  "ନାମରେ",
+  "ପ୍ରାୟ",
+  "ରକ୍ତ",
+  "କାମ",
+  "ପାଳନ",
+  "ଓଡ଼ିଶା",
+  "କରିବାକୁ",
+  "ମାନେ",
+  "ରାଜା",
+  "ସୃଷ୍ଟି",
+  "ଅନ୍ତର୍ଗତ",
+  "ନିଜର",
+  "କରାଯାଇଥାଏ",
+  "ମୁଖ୍ୟ",
+  "ଠାରେ",
+  "ମାସ",
+  "ଯୋଗୁ",
+  "ତାହା",
+  "ଭିତରେ",
+  "କାରଣ",
+  "ମସିହା",
+  "ଏ",
+  "ବହୁ",
+  "ସବୁ",
+  "ଦୁଇ",
+  "ସମୟ",
+  "ଭଳି",
+  "କରିଛନ୍ତି",
+  "ମଧ୍ୟରୁ",
+  "ଏଥିରେ",
+  "ଓଡ଼ିଶାରେ",
+  "କରିଥାନ୍ତି",
+  "ସମସ୍ତ",
+  "ପ୍ରଥମେ",
+  "ତେଣୁ",
+  "ପ୍ରକାର",
+  "ପ୍ରତି",
+  "ପରି",
+  "କେବଳ",
+  "କୁ",
+  "ଲୋକ",
+  "ଭାରତ",
+  "କରିଥିଲେ।",
+  "ଛୋଟ",
+  "କଟକ",
+  "ପୂର୍ବରୁ",
+  "ଦେବୀ",
+  "ଦେଖାଯାଏ",
+  "ଔଷଧ",
+  "ମୁକ୍ତିଲାଭ",
+  "ଶିକ୍ଷା",
+  "ଯେଉଁ",
+  "ସହର",
+  "ରାଜ୍ୟ",
+  "ଧରି",
+  "ଦ୍ୱାରା",
+  "ଆଉ",
+  "ପାଇ",
+  "ମାନଙ୍କ",
+  "ଶକ୍ତି",
+  "ପ୍ରାର୍ଥୀ",
+  "ଜୀବନ",
+  "ବହୁତ",
+  "ସାଧାରଣ",
+  "ଦେଖିବାକୁ",
+  "ନିର୍ଦ୍ଦେଶନାରେ",
+  "ସେଠାରେ",
+  "କରୁଥିଲେ",
+  "କାର୍ଯ୍ୟ",
+  "ସ୍ଥାନରେ",
+  "ଅତି",
+  "ମାତ୍ର",
+  "ସ୍ଥାନ",
+  "ଚିକିତ୍ସା",
+  "ଦିଆଯାଏ",
+  "ପ୍ରଦାନ",
+  "ଲାଭ",
+  "ହୋଇଥିବା",
+  "ନିର୍ମାଣ",
+  "ସଂଖ୍ୟା",
+  "ହୋଇଥାଏ।",
+  "ଉତ୍ତର",
+  "ବେଶ",
+  "ବଡ଼",
+  "ଶ୍ରୀ",
+  "ତେବେ",
+  "ଯାତ୍ରା",
+  "ଅନୁଷ୍ଠିତ",
+  "ଲକ୍ଷଣ",
+  "ସେମାନେ",
+  "ବିଷୟରେ",
+  "ଶେଷ",
+  "ଦଳ",
+  "ପରିଚିତ",
+  "ରଚନା",
+  "ଦୁଇଟି",
+  "ଜୀବାଣୁ",
+  "ରଥ",
+  "ଉଚ୍ଚ",
+  "ଜଗନ୍ନାଥ",
+  "ଦକ୍ଷିଣ",
+  "କଥାଚିତ୍ର",
+  "ପ୍ରକାଶ",
+  "ଭାଷା",
+  "ଖାଦ୍ୟ",
+  "ନିର୍ବାଚିତ",
+  "ଭଲ",
+  "କରାଯାଇଥିଲା",
+  "ବି",
+  "ହୋଇଛି",
+  "of",
+  "ବିବାହ",
+  "ବିଶେଷ",
+  "ମୃତ୍ୟୁ",
+  "ଦେଇଥିଲେ",
+  "ନାମକ",
+  "ପ୍ରତ୍ୟେକ",
+  "କଥା",
+  "ଦର୍ଶନ",
+  "ଭୋଗ",
+  "ଲାଗି",
+  "କରୁଥିବା",
+  "ଜଣାଶୁଣା",
+  "ପାଖରେ",
+  "କିମ୍ବା",
+  "ନିକଟରେ",
+  "ପ୍ରସିଦ୍ଧ",
+  "ସାହିତ୍ୟ",
+  "ହିଁ",
+  "ପ୍ରସ୍ତୁତ",
+  "କରିଥିବା",
+  "ସଙ୍ଗୀତ",
+  "ସାଧାରଣତଃ",
+  "ଆବଶ୍ୟକ",
+  "ହେଉଥିବା",
+  "ଗୁଡ଼ିକ",
+  "ଙ୍କ",
+  "ପରୀକ୍ଷା",
+  "ନଦୀ",
+  "ଅଞ୍ଚଳ",
+  "ଜଳ",
+  "ପରବର୍ତ୍ତୀ",
+  "ଫଳରେ",
+  "ମିଳେ",
+  "ଜନତା",
+  "ମୁଁ",
+  "ଅର୍ଥ",
+  "ପୁରସ୍କାର",
+  "ବ୍ରତ",
+  "କରାଯାଏ।",
+  "ପୁରାତନ",
+  "ଅନ୍ୟାନ୍ୟ",
+  "କରାଯାଇଛି",
+  "ଶିବ",
+  "କଂଗ୍ରେସ",
+  "କବି",
+  "ପଦାର୍ଥ",
+  "ବିଜ୍ଞାନ",
+  "ଇତ୍ୟାଦି",
+  "ଦାସ",
+  "ହେଉଛନ୍ତି",
+  "ହେବ",
+  "ଯାଇ",
+  "ଯାହାର",
+  "ହିନ୍ଦୁ",
+  "ନୀତି",
+  "ପତ୍ର",
+  "କରିଥାଏ",
+  "ପୁରୀ",
+  "କହନ୍ତି",
+  "ପ୍ରତିଷ୍ଠା",
+  "ଯଥା",
+  "ଦେଶ",
+  "ପିତା",
+  "ପ୍ରକାରର",
+  "ଉଭୟ",
+  "ପ୍ରବେଶ",
+  "୨୦୦୯",
+  "କାଳରେ",
+  "ନୁହେଁ",
+  "କ୍ଷେତ୍ରରେ",
+  "ବିଜୁ",
+  "ପର୍ବ",
+  "ମୌଳିକ",
+  "ରାଜଧାନୀ",
+  "ଅଳ୍ପ",
+  "ଶବ୍ଦ",
+  "ତିନି",
+  "ଧର୍ମ",
+  "ଭାଷାରେ",
+  "ଭିନ୍ନ",
+  "ମୂର୍ତ୍ତି",
+  "ପ୍ରମୁଖ",
+  "ବିଶିଷ୍ଟ",
+  "ଭାଗ",
+  "କମ",
+  "ବର୍ତ୍ତମାନ",
+  "ତା",
+  "ରାଜ୍ୟର",
+  "ଅନ୍ୟତମ",
+  "ମଣ୍ଡେଲା",
+  "ରଚିତ",
+  "ଏବେ",
+  "କଳା",
+  "ତାକୁ",
+  "ପୂର୍ବ",
+  "ଅଲଗା",
+  "ପାନ",
+  "ନୂଆ",
+  "ବିଜେ",
+  "କରିବାର",
+  "ଗୀତ",
+  "୫",
+  "କରାଯାଇ",
+  "ଭାଗରେ",
+  "ଶାସନ",
+  "ଭାରତରେ",
+  "ମହିଳା",
+  "ଅନୁଯାୟୀ",
+  "କେନ୍ଦ୍ର",
+  "ଗତ",
+  "ଟି",
+  "ମୋଟ",
+  "ନିର୍ବାଚନରେ",
+  "ସେବା",
+  "କେହି",
+  "ସ୍ଵତନ୍ତ୍ର",
+  "ହୁଅନ୍ତି",
+  "ଫଳ",
+  "ହୋଇଯାଏ",
+  "ଅଂଶ",
+  "ରହିଛି।",
+  "ପଶ୍ଚିମ",
+  "ପୁତ୍ର",
+  "ଯୋଗ",
+  "ଗଠନ",
+  "ଗ୍ରାମ",
+  "ଭୁତାଣୁ",
+  "ସେତେବେଳେ",
+  "ପ୍ରତୀକ",
+  "ଫୁଲ",
+  "ମୁଖ୍ୟତଃ",
+  "ରହି",
+  "ରାସାୟନିକ",
+  "୨",
+  "ପାଣି",
+  "ପ୍ରଧାନ",
+  "ମା",
+  "ରହେ",
+  "କହିଲେ",
+  "ଘରେ",
+  "ବର୍ଣ୍ଣନା",
+  "ବୃଦ୍ଧି",
+  "ସେମାନଙ୍କ",
+  "ଅଧିକାଂଶ",
+  "ଦୂରରେ",
+  "ନିର୍ବାଚନ",
+  "ରୋଗରେ",
+  "ସାହାଯ୍ୟ",
+  "ତାରିଖରେ",
+  "ପ୍ରୟୋଗ",
+  "କବିତା",
+  "ବନ୍ଦ",
+  "ସରକାର",
+  "ଏଇ",
+  "କରିଥାନ୍ତି।",
+  "ଦେଲେ",
+  "ଭଗବାନ",
+  "ସବୁଠାରୁ",
+  "ଅଞ୍ଚଳରେ",
+  "ଗଛ",
+  "ଦ୍ଵିତୀୟ",
+  "ପାଳିତ",
+  "ନିର୍ବାଚନମଣ୍ଡଳୀ",
+  "ଅଧିକାର",
+  "ଅଭିନୟ",
+  "ଦେଖି",
+  "କଲା",
+  "ଗୁଡିକ",
+  "ମିଳିଥାଏ",
+  "୩",
+  "ମୋର",
+  "ସଙ୍ଗେ",
+  "ସ୍ନାନ",
+  "ଦେବ",
+  "ବ୍ୟବସ୍ଥା",
+  "ଭୋଟ",
+  "ରୋଗର",
+  "ରକ୍ଷା",
+  "ସେଥିରେ",
+  "ହାସଲ",
+  "ଉତ୍କଳ",
+  "କର୍କଟ",
+  "ଇଂରାଜୀ",
+  "ବାଲେଶ୍ଵର",
+  "ବେଳକୁ",
+  "ମନ୍ଦିରର",
+  "ମନ୍ଦିରରେ",
+  "ଯଦି",
+  "ଜଣାଯାଏ",
+  "ଅଫ",
+  "ଦୂର",
+  "ଦେଶର",
+  "ମଠ",
+  "୬",
+  "ଯୋଗୁଁ",
+  "୪",
+  "ଗଜପତି",
+  "ଗବେଷଣା",
+  "ମାଧ୍ୟମରେ",
+  "ଯନ୍ତ୍ରଣା",
+  "ଯାହାକି",
+  "ଆକ୍ରମଣ",
+  "ଆସି",
+  "ଗୁରୁ",
+  "ବ୍ଳକ",
+  "୧",
+  "୧୦",
+  "ଆଧୁନିକ",
+  "ଗ୍ରାମରେ",
+  "ଚନ୍ଦ୍ର",
+  "ପୃଥିବୀର",
+  "ପ୍ରାଥମିକ",
+  "ଯେତେବେଳେ",
+  "କରିବାରେ",
+  "ଶିଶୁ",
+  "ଜନ୍ମଗ୍ରହଣ",
+  "ବିଧାନ",
+  "ସମଗ୍ର",
+  "ସୂର୍ଯ୍ୟ",
+  "ଉଲ୍ଲେଖ",
+  "ଦେଶରେ",
+  "ନୂତନ",
+  "ପରିବର୍ତ୍ତନ",
+  "ପ୍ରଶାସନିକ",
+  "ମାନଙ୍କୁ",
+  "ରୂପରେ",
+  "ହିସାବରେ",
+  "ବ୍ୟତୀତ",
+  "ଯାଏ",
+  "ଶୁକ୍ଳ",
+  "ନିର୍ଣ୍ଣୟ",
+  "ପରମ୍ପରା",
+  "ବ୍ୟବହୃତ",
+  "ମୁଣ୍ଡ",
+  "ଜନ୍ମିତ",
+  "ତାହାକୁ",
+  "ତାହାର",
+  "ମୂଳ",
+  "ସିନେମା",
+  "and",
+  "ଆମ",
+  "ଦେଶ।",
+  "ଫୁଟ",
+  "ସଦର",
+  "ଏକାଦଶୀ",
+  "ଦିବସ",
+  "ଧାରଣ",
+  "ହୋଇପାରେ",
+  "ଅଟେ।",
+  "ଅପେକ୍ଷା",
+  "ନୃତ୍ୟ",
+  "ପବିତ୍ର",
+  "ବଡ",
+  "ବୌଦ୍ଧ",
+  "ରଙ୍ଗ",
+  "ଇତିହାସ",
+  "କୃଷ୍ଣ",
+  "ଯାହାକୁ",
+  "ସରକାରଙ୍କ",
+  "ଅତ୍ୟନ୍ତ",
+  "ତୃତୀୟ",
+  "ପୁରାଣ",
+  "ପୂର୍ଣ୍ଣିମା",
+  "ପ୍ରଦେଶର",
+  "ବିଦ୍ୟାଳୟ",
+  "ଲେଖକ",
+  "ଲେଖା",
+  "ସଂକ୍ରମଣ",
+  "ଘର",
+  "ଜଣା",
+  "ଥରେ",
+  "ପାରେ",
+  "ପ୍ରକାଶିତ",
+  "ରୋଗୀ",
+  "ସାରା",
+  "ଯାଏଁ",
+  "ଅବସ୍ଥାରେ",
+  "କୁହାଯାଏ।",
+  "ପରମାଣୁ",
+  "ମଣିଷ",
+  "ମାସରେ",
+  "ଜିଲ୍ଲାରେ",
+  "ପୁଣି",
+  "ପ୍ରମାଣ",
+  "ପ୍ରାପ୍ତ",
+  "ଶେଷରେ",
+  "ଉତ୍ସବ",
+  "ପ୍ରତିରୋଧ",
+  "ବିଶ୍ଵାସ",
+  "ଲୋକପ୍ରିୟ",
+  "ସଭା",
+  "ହୋଇଥିବାରୁ",
+  "ଗାଁ",
+  "ପ୍ରଭାବିତ",
+  "ପ୍ରାଚୀନ",
+  "ବ୍ରାହ୍ମଣ",
+  "ଅଟନ୍ତି",
+  "ଅତ୍ୟଧିକ",
+  "ଦେବା",
+  "କୁମାର",
+  "ପରିଣତ",
+  "ବ୍ଲକ",
+  "ଲୋକେ",
+  "ଅଭିନେତା",
+  "କଟକର",
+  "ଚଳଚ୍ଚିତ୍ର",
+  "ଥିବାରୁ",
+  "ଶରୀର",
+  "ସଂସ୍କୃତ",
+  "କରିଛି",
+  "ତଳେ",
+  "ଦେବୀଙ୍କ",
+  "ପ୍ରତିବର୍ଷ",
+  "ବିଷ୍ଣୁ",
+  "ବିଷୟ",
+  "ଯୁଦ୍ଧ",
+  "ସରକାରୀ",
+  "୨୦",
+  "ଅଛନ୍ତି",
+  "ଖୁବ",
+  "ଗତି",
+  "ଦେହରେ",
+  "ଭୂମିକା",
+  "ମତରେ",
+  "ଶ୍ରୀମନ୍ଦିର",
+  "ସ୍ଥାପନ",
+  "ଆଗରୁ",
+  "କ୍ରମେ",
+  "ନଷ୍ଟ",
+  "ମାତା",
+  "ରଖି",
+  "ସମାନ",
+  "ସେବନ",
+  "୭",
+  "ହେବାର",
+  "ଏହାପରେ",
+  "କ୍ରମାଙ୍କ",
+  "ଜନିତ",
+  "ତରଫରୁ",
+  "ସାମାଜିକ",
+  "ଅଗଷ୍ଟ",
+  "କରା",
+  "ରକ୍ତଚାପ",
+  "ରୂପ",
+  "କ୍ଷମତା",
+  "ଦରକାର",
+  "ପୁରୁଷ",
+  "ମହାନ୍ତି",
+  "ମାଆ",
+  "ମିଶ୍ର",
+  "ରାଷ୍ଟ୍ରପତି",
+  "୧୨",
+  "୮",
+  "ଓଡ଼ିଶୀ",
+  "କନ୍ୟା",
+  "ବିଭକ୍ତ",
+  "ହଜାର",
+  "ଅର୍ପଣ",
+  "ତାର",
+  "ପଟ୍ଟନାୟକ",
+  "ପୁରୁଣା",
+  "ବିକାଶ",
+  "ଓଷା",
+  "ନିର୍ଦ୍ଦେଶକ",
+  "ପ୍ରଭାବ",
+  "ବୟସରେ",
+  "ଭକ୍ତ",
+  "ମାନଙ୍କର",
+  "ମୂଖ୍ୟ",
+  "ସୁନ୍ଦର",
+  "ଉକ୍ତ",
+  "ତିଥିରେ",
+  "ନିର୍ଦ୍ଦିଷ୍ଟ",
+  "ଭଦ୍ରକ",
+  "ରଥଯାତ୍ରା",
+  "କରାଗଲା",
+  "ନିଜକୁ",
+  "ବର୍ଷର",
+  "ବିଶ୍ଵ",
+  "ଲୋକମାନେ",
+  "ଆମେ",
+  "ଉଚ୍ଚତା",
+  "ନେଇଥିଲେ",
+  "ପାଇଥିଲେ",
+  "ସ୍ଵାଧୀନତା",
+  "ହୁଏ।",
+  "ଚାରି",
+  "ତଥ୍ୟ",
+  "ତାରିଖ",
+  "ଦାସଙ୍କ",
+  "ବାହାର",
+  "ଯିଏ",
+  "ରହିଅଛି",
+  "ଶରୀରର",
+  "ସମ୍ମାନ",
+  "ସେହିପରି",
+  "ଅସୁବିଧା",
+  "ଆଇନ",
+  "ଏଣୁ",
+  "ଘୋଷଣା",
+  "ଡିସେମ୍ବର",
+  "ତା’ର",
+  "ମହାପାତ୍ର",
+  "ଲକ୍ଷ",
+  "ଲାଗେ",
+  "ସଂକ୍ରମିତ",
+  "ସନ୍ତାନ",
+  "ଇଂରେଜ",
+  "ଚାଷ",
+  "ରାଜନୈତିକ",
+  "ସମ୍ଭାବନା",
+  "ସିଂହ",
+  "ହାର",
+  "ଆକାର",
+  "ଐତିହାସିକ",
+  "ଚାପ",
+  "ତିନୋଟି",
+  "ଶତାବ୍ଦୀରେ",
+  "ସୁବିଧା",
+  "ସୁଯୋଗ",
+  "କାଳ",
+  "ଗାଆଁ",
+  "ଚିତ୍ର",
+  "ପଣ୍ଡିତ",
+  "ବେଶରେ",
+  "ଭାଷାର",
+  "ମୋ",
+  "ହାତରେ",
+  "ଅବସ୍ଥା",
+  "ଗଠିତ",
+  "ଜୁଲାଇ",
+  "ପୁସ୍ତକ",
+  "ବୈଜ୍ଞାନିକ",
+  "ମତ",
+  "ମିଶାଇ",
+  "ରହିବା",
+  "କରିବାପାଇଁ",
+  "ତରଳ",
+  "ଥିଲା।",
+  "ଦେବତା",
+  "ବ୍ୟକ୍ତି",
+  "ସମାଜ",
+  "୧୫",
+  "୩୦",
+  "ଆହୁରି",
+  "ଏପରି",
+  "ମାନ୍ୟତା",
+  "ସେମାନଙ୍କୁ",
+  "ପରିବାର",
+  "ବାହାରେ",
+  "ଯିବା",
+  "ରଙ୍ଗର",
+  "ଶତାବ୍ଦୀ",
+  "ସି",
+  "ସେମାନଙ୍କର",
+  "ସ୍ନାୟୁ",
+  "କ୍ଷୁଦ୍ର",
+  "ଥର",
+  "ନିଜେ",
+  "ପ୍ରାକୃତିକ",
+  "ବିଶ୍ୱାସ",
+  "ଭାଇ",
+  "ଲିଖିତ",
+  "ସଂକ୍ରାନ୍ତି",
+  "ଆଜି",
+  "ଏଥି",
+  "ନଭେମ୍ବର",
+  "ବହୁଳ",
+  "ବିଭାଗ",
+  "ମହାବିଦ୍ୟାଳୟ",
+  "ମି",
+  "ମିଶି",
+  "ସମ୍ପର୍କ",
+  "ଅନୁଭବ",
+  "ଆଦିବାସୀ",
+  "କମିଯାଏ",
+  "ଗୁଣ୍ଡିଚା",
+  "ଦିଗରେ",
+  "ପ୍ରତିଷ୍ଠିତ",
+  "ପ୍ରଭୁ",
+  "ମା’",
+  "ଯେଉଁଥିରେ",
+  "୨୪",
+  "ଅବସ୍ଥିତ।",
+  "ଚନ୍ଦନ",
+  "ଜାନୁଆରୀ",
+  "ଝିଅ",
+  "ଧର୍ମର",
+  "ନଳୀ",
+  "ଯନ୍ତ୍ର",
+  "ସମ୍ପର୍କରେ",
+  "ସେଥିପାଇଁ",
+  "ଗ୍ରାମର",
+  "ଜ୍ଞାନ",
+  "ପୃଥିବୀ",
+  "ବର୍ଣ୍ଣିତ",
+  "ଶ୍ରେଷ୍ଠ",
+  "I",
+  "କଷ୍ଟ",
+  "ନିମ୍ନ",
+  "ବିଧି",
+  "ମାନସିକ",
+  "ରୁପେ",
+  "ହାତ",
+  "କାର୍ତ୍ତିକ",
+  "କ୍ରମିକ",
+  "ଜଗନ୍ନାଥଙ୍କ",
+  "ପଥର",
+  "ପୀଠ",
+  "ରହିଥାଏ",
+  "ରହିଥିଲା",
+  "ଲୋକଙ୍କ",
+  "ଶ୍ରୀଜଗନ୍ନାଥ",
+  "ସ୍କୁଲ",
+  "ସ୍ଥାନୀୟ",
+  "ହେତୁ",
+  "ଅଭାବ",
+  "ଏମାନେ",
+  "ଓଡ଼ିଆରେ",
+  "କେନ୍ଦୁଝର",
+  "ଖଣ୍ଡ",
+  "ଗୁଣ",
+  "ଚଳଚିତ୍ର",
+  "ଜନ",
+  "ଦାନ",
+  "ଦୀର୍ଘ",
+  "ପ୍ରସାଦ",
+  "ଲୋକଙ୍କର",
+  "୧୮",
+  "କୂଳରେ",
+  "ଜଗତର",
+  "ଦିନରେ",
+  "ପକାଇ",
+  "ପ୍ରଚଳିତ",
+  "ବିରୁଦ୍ଧରେ",
+  "ଭୁବନେଶ୍ଵର",
+  "ମାନବ",
+  "ସପ୍ତାହ",
+  "ହିନ୍ଦୀ",
+  "ଅକ୍ଟୋବର",
+  "କମ୍",
+  "କ୍ରିକେଟ",
+  "ଖେଳ",
+  "ଗର୍ଭ",
+  "ଧାନ",
+  "ବ୍ରହ୍ମା",
+  "ମହାପ୍ରଭୁଙ୍କ",
+  "ସମୁଦ୍ର",
+  "ଜଣ",
+  "ନାଚ",
+  "ପୃଥିବୀରେ",
+  "ମହକୁମା",
+  "ଶାଖା",
+  "ଶ୍ରୀମନ୍ଦିରରେ",
+  "୨୦୧୨",
+  "ଅବଦାନ",
+  "କଳିଙ୍ଗ",
+  "ଜଙ୍ଗଲ",
+  "ଥିଲେ।",
+  "ନାମିତ",
+  "ପାଖାପାଖି",
+  "ପାଠ",
+  "ବନ୍ଦର",
+  "ବାସ",
+  "ବାହାରି",
+  "ବିଜୟ",
+  "ମହାରାଜା",
+  "ସ୍ତରରେ",
+  "in",
+  "କଲେ।",
+  "କୋଷ",
+  "ଗଲେ",
+  "ଚେଷ୍ଟା",
+  "ବିମାନ",
+  "ବୟସ",
+  "ଭିତରୁ",
+  "ଯକ୍ଷ୍ମା",
+  "ଲକ୍ଷ୍ମୀ",
+  "ସଦସ୍ୟ",
+  "ଉଦ୍ଦେଶ୍ୟରେ",
+  "ଉନ୍ନତି",
+  "ଏସିଆ",
+  "ଦିନେ",
+  "ନିମୋନିଆ",
+  "ବାୟୁ",
+  "ହେଉଥିଲା",
+  "ଆଣି",
+  "ଆନନ୍ଦ",
+  "ଜାତିର",
+  "ନାଟକ",
+  "ପକ୍ଷରୁ",
+  "ପ୍ରଚାର",
+  "ଫେରି",
+  "ରଖିବା",
+  "ରାଜାଙ୍କ",
+  "ହୋଇଥିଲା।",
+  "୧୪",
+  "୨୦୧୧",
+  "ଅସ୍ଥି",
+  "ଗଛର",
+  "ଦ୍ଵାର",
+  "ପତ୍ନୀ",
+  "ପରିବାରରେ",
+  "ପୁଅ",
+  "ଶତାବ୍ଦୀର",
+  "୯",
+  "ଉପଯୁକ୍ତ",
+  "କାହାଣୀ",
+  "ଚିହ୍ନ",
+  "ଜୁନ",
+  "ଠାକୁର",
+  "ଧଳା",
+  "ନାରାୟଣ",
+  "ନିୟୁତ",
+  "ପଡେ",
+  "ପାଏ",
+  "ପ୍ରଣାଳୀ",
+  "ମନ୍ତ୍ରୀ",
+  "ମାସର",
+  "ଶିକ୍ଷକ",
+  "ସମ୍ଭବ",
+  "ସମୟର",
+  "୨୫",
+  "ଅଙ୍ଗ",
+  "ଉଦ୍ଭିଦ",
+  "ଉପନ୍ୟାସ",
+  "ଏହିଦିନ",
+  "ତୁଳସୀ",
+  "ଧିରେ",
+  "ନିୟମ",
+  "ପତ୍ରିକା",
+  "ପୂର୍ଣ୍ଣ",
+  "ପୌରାଣିକ",
+  "ଭିତର",
+  "ସମ୍ବିଧାନ",
+  "ସେବକ",
+  "ପାରମ୍ପରିକ",
+  "ପ୍ରଭୃତି",
+  "ବିଶାଳ",
+  "ମାତ୍ରା",
+  "ମୁକ୍ତ",
+  "ମୋଗଲ",
+  "ସର୍ବାଧିକ",
+  "ସାହିତ୍ୟରେ",
+  "ସୂଚନା",
+  "ସ୍ଥାପିତ",
+  "ଅର୍ଥାତ",
+  "ଆୟ",
+  "ଓଡ଼ିଆଚଳଚ୍ଚିତ୍ର",
+  "କରୁଛନ୍ତି",
+  "ଖ୍ରୀ",
+  "ଗଣନା",
+  "ଗୋବିନ୍ଦ",
+  "ଚରଣ",
+  "ଦାୟିତ୍ଵ",
+  "ପଦ୍ଧତି",
+  "ମସ୍ତିଷ୍କ",
+  "ଶରୀରରେ",
+  "ସଂଯୁକ୍ତ",
+  "ସାହିତ୍ୟର",
+  "ସ୍ଵଳ୍ପ",
+  "ହେବାକୁ",
+  "ଅଥବା",
+  "ଅଭିନେତ୍ରୀ",
+  "ଉପର",
+  "କର",
+  "ଗୋଟି",
+  "ଗ୍ରହ",
+  "ଦିଅନ୍ତି",
+  "ନିଯୁକ୍ତ",
+  "ନିର୍ଭର",
+  "ପରିମାଣ",
+  "ପାଣିରେ",
+  "ପାର୍ଟି",
+  "ପୂର୍ବେ",
+  "ଯାଇଥାଏ",
+  "ସଫଳ",
+  "ସମସ୍ତେ",
+  "ଅନୁଗୋଳ",
+  "ଆକାରରେ",
+  "ଆଲୋକ",
+  "ଉଚିତ",
+  "କିମ୍ବଦନ୍ତୀ",
+  "ପିଲା",
+  "ମଣ୍ଡପ",
+  "ମାର୍ଚ୍ଚ",
+  "ଯୁକ୍ତ",
+  "ସାହାଯ୍ୟରେ",
+  "ଆନ୍ଧ୍ର",
+  "ଉପାସନା",
+  "କେବେ",
+  "ଘରକୁ",
+  "ଜାତି",
+  "ଜୀବନର",
+  "ତ୍ୟାଗ",
+  "ପହଣ୍ଡି",
+  "ପି",
+  "ପ୍ରଚଳନ",
+  "ମୋତେ",
+  "ଯାଇଛି",
+  "ଲାଲ",
+  "ସମସ୍ୟା",
+  "ସ୍ଥିର",
+  "ଅଧୁନା",
+  "ଅଧ୍ୟୟନ",
+  "ଆଇ",
+  "ଆଜ୍‌ମା",
+  "ଆମେରିକା",
+  "ଉତ୍ତମ",
+  "ଏଥିପାଇଁ",
+  "ଖ୍ରୀଷ୍ଟାବ୍ଦରେ",
+  "ଜୀବନରେ",
+  "ପରିବାରର",
+  "ପିତାଙ୍କ",
+  "ରାତିରେ",
+  "ରାମଚନ୍ଦ୍ର",
+  "ସଂଯୋଗ",
+  "ସମ୍ବଲପୁର",
+  "ସୁଦ୍ଧା",
+  "ସ୍ଵାସ୍ଥ୍ୟ",
+  "ହୋଇଥାନ୍ତି",
+  "ଆଲୋଚନା",
+  "ଏତେ",
+  "ଓଜନ",
+  "କହିଥିଲେ",
+  "ନିକଟସ୍ଥ",
+  "ପରିଚୟ",
+  "ପରିବେଷଣ",
+  "ବ୍ୟତିତ",
+  "ରେଭେନ୍ସା",
+  "ଶବ୍ଦର",
+  "ଶୁଣି",
+  "ସଂଗୀତ",
+  "ସଂସ୍କୃତି",
+  "ସହଜରେ",
+  "ସାମାନ୍ୟ",
+  "ସୁରକ୍ଷା",
+  "ସ୍ଥାପନା",
+  "୧୬",
+  "୨୦୧୩",
+  "ଅପରେଶନ",
+  "ଆନ୍ଦୋଳନ",
+  "ଆସିଥିଲେ",
+  "ଆସିଲେ",
+  "ଉତ୍ପାଦନ",
+  "ଦଳର",
+  "ଦ୍ବାରା",
+  "ଧୀରେ",
+  "ପୂଜାର୍ଚ୍ଚନା",
+  "ପ୍ରଦାହ",
+  "ବର୍ଷା",
+  "ବିଶ୍ଵର",
+  "ମହାନ",
+  "ମୁସଲମାନ",
+  "ରଥରେ",
+  "ସଂଗ୍ରହ",
+  "ସ୍ନାତକ",
+  "ଅର୍ଥନୈତିକ",
+  "ଆବିଷ୍କାର",
+  "ଆସିଛି",
+  "କଣିକା",
+  "କାଠ",
+  "କେତେ",
+  "ଚଉତିଶା",
+  "ଜ୍ଵର",
+  "ଠିକ",
+  "ଦି",
+  "ଧୂପ",
+  "ପାଇବା",
+  "ମାନଙ୍କରେ",
+  "ରସ",
+  "ରାଜ୍ୟରେ",
+  "ସଭାପତି",
+  "ହେବାରୁ",
+  "ଆଫ୍ରିକା",
+  "ଏହିପରି",
+  "କଟକରେ",
+  "କେଉଁ",
+  "ଗଣ୍ଠି",
+  "ଗାୟକ",
+  "ଗ୍ରନ୍ଥ",
+  "ଟିକା",
+  "ନଗର",
+  "ପଦ୍ମ",
+};
+const uint16_t WA_FREQ_124_RANKS[] = {
+  314, 979, 0, 883, 0, 0, 0, 0, 0, 0, 0, 0, 866, 61, 538, 736,
+  0, 0, 0, 0, 0, 16, 47, 355, 969, 0, 870, 0, 0, 188, 720, 404,
+  157, 809, 471, 490, 917, 230, 0, 0, 0, 0, 0, 0, 0, 209, 27, 865,
+  0, 0, 478, 0, 928, 0, 0, 0, 0, 620, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 722, 657, 565, 35, 492, 213, 631, 998, 0, 0, 0, 0, 0,
+  0, 0, 789, 0, 0, 315, 622, 0, 0, 0, 0, 22, 0, 671, 394, 621,
+  158, 755, 788, 749, 208, 479, 911, 191, 934, 154, 961, 0, 0, 108, 0, 0,
+  302, 0, 919, 223, 634, 544, 0, 0, 0, 0, 0, 0, 860, 0, 382, 712,
+  514, 0, 0, 202, 721, 827, 24, 935, 498, 962, 0, 0, 318, 423, 819, 0,
+  0, 995, 0, 0, 0, 0, 0, 171, 273, 704, 0, 0, 0, 0, 254, 58,
+  463, 324, 759, 799, 831, 914, 0, 299, 0, 0, 0, 193, 940, 416, 446, 694,
+  0, 655, 0, 842, 981, 810, 0, 130, 0, 0, 0, 0, 0, 0, 182, 0,
+  10, 323, 0, 581, 0, 0, 0, 12, 362, 0, 330, 0, 415, 474, 43, 141,
+  20, 159, 748, 766, 0, 593, 769, 900, 737, 0, 0, 0, 0, 0, 0, 0,
+  0, 724, 139, 258, 608, 0, 0, 869, 115, 128, 985, 667, 0, 0, 0, 0,
+  0, 651, 0, 0, 310, 526, 285, 814, 0, 693, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 196, 0, 787, 418, 698, 849, 0, 0, 0, 0, 0, 46,
+  425, 461, 0, 0, 0, 845, 868, 0, 695, 0, 0, 31, 0, 399, 713, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 211, 0, 0, 0, 0, 0, 0, 0,
+  0, 244, 343, 317, 598, 702, 779, 796, 871, 0, 0, 265, 0, 0, 0, 110,
+  176, 0, 0, 999, 0, 566, 0, 0, 764, 451, 0, 0, 0, 0, 509, 0,
+  0, 0, 0, 0, 0, 812, 0, 435, 0, 0, 163, 762, 69, 0, 389, 798,
+  0, 828, 0, 0, 0, 0, 0, 0, 190, 0, 0, 428, 753, 0, 0, 0,
+  0, 0, 351, 0, 0, 0, 833, 523, 510, 699, 880, 966, 0, 0, 181, 0,
+  0, 535, 587, 725, 0, 0, 270, 0, 0, 0, 85, 179, 63, 910, 861, 0,
+  0, 0, 0, 665, 647, 0, 0, 283, 672, 0, 102, 0, 153, 626, 792, 0,
+  0, 0, 0, 0, 237, 218, 0, 0, 875, 0, 0, 0, 0, 49, 0, 808,
+  494, 0, 0, 0, 0, 149, 795, 0, 0, 272, 0, 0, 0, 0, 489, 0,
+  0, 40, 567, 0, 375, 0, 0, 0, 678, 72, 528, 60, 562, 99, 0, 0,
+  0, 0, 0, 7, 472, 307, 738, 0, 97, 730, 590, 0, 0, 706, 0, 0,
+  52, 0, 0, 890, 0, 458, 17, 545, 0, 0, 0, 606, 652, 352, 358, 708,
+  897, 0, 0, 0, 0, 0, 0, 0, 76, 347, 441, 763, 774, 169, 0, 0,
+  0, 0, 50, 0, 0, 0, 0, 0, 0, 0, 0, 345, 284, 0, 0, 0,
+  552, 381, 645, 268, 686, 987, 483, 0, 387, 0, 374, 502, 618, 0, 710, 0,
+  0, 714, 0, 876, 90, 540, 0, 0, 0, 993, 611, 0, 816, 0, 276, 782,
+  582, 0, 0, 117, 144, 341, 360, 384, 448, 653, 447, 780, 818, 947, 0, 0,
+  0, 94, 349, 0, 530, 105, 863, 0, 0, 4, 175, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 473, 0, 401, 945, 767, 0, 45, 0, 409, 0, 0, 0,
+  224, 0, 187, 148, 173, 319, 476, 513, 691, 0, 0, 0, 0, 847, 420, 0,
+  366, 990, 0, 0, 0, 0, 0, 292, 0, 0, 556, 891, 0, 0, 688, 0,
+  605, 841, 641, 0, 452, 0, 91, 0, 0, 958, 80, 357, 0, 0, 0, 583,
+  194, 0, 853, 0, 0, 0, 0, 0, 0, 0, 180, 298, 0, 0, 371, 0,
+  0, 602, 19, 84, 38, 88, 304, 426, 745, 867, 0, 74, 467, 493, 0, 412,
+  118, 222, 0, 0, 0, 0, 54, 646, 0, 200, 0, 0, 0, 0, 0, 542,
+  0, 411, 949, 0, 0, 936, 0, 0, 287, 632, 643, 0, 0, 0, 0, 23,
+  0, 0, 0, 143, 0, 0, 75, 0, 414, 0, 975, 895, 0, 904, 0, 0,
+  0, 0, 145, 701, 599, 0, 0, 0, 0, 811, 864, 0, 0, 815, 516, 42,
+  221, 156, 240, 946, 0, 823, 0, 161, 0, 0, 0, 898, 0, 11, 233, 0,
+  328, 334, 0, 791, 402, 0, 974, 0, 553, 264, 0, 0, 0, 0, 925, 0,
+  0, 677, 0, 0, 0, 520, 739, 0, 0, 0, 0, 0, 846, 377, 886, 0,
+  0, 662, 133, 732, 892, 959, 0, 950, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 177, 548, 893, 0, 580, 0, 0, 0, 0, 112, 0, 0, 79, 0, 829,
+  316, 547, 614, 638, 650, 459, 151, 894, 73, 126, 0, 0, 839, 0, 0, 684,
+  0, 0, 225, 838, 982, 0, 937, 0, 0, 0, 0, 0, 640, 454, 0, 421,
+  760, 0, 0, 0, 0, 0, 0, 487, 0, 0, 0, 0, 0, 62, 558, 0,
+  0, 116, 322, 0, 0, 0, 0, 533, 0, 0, 896, 0, 0, 0, 70, 0,
+  532, 717, 424, 0, 0, 0, 761, 0, 0, 344, 396, 0, 0, 0, 0, 912,
+  0, 0, 0, 155, 183, 297, 836, 0, 0, 807, 71, 0, 427, 0, 0, 0,
+  0, 991, 0, 0, 0, 229, 329, 57, 0, 0, 220, 669, 0, 455, 0, 586,
+  0, 391, 0, 0, 851, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 111, 275, 0, 0, 0, 604, 78, 0, 109, 0, 0, 0, 680,
+  0, 830, 373, 210, 550, 0, 0, 0, 610, 0, 0, 0, 0, 393, 541, 0,
+  0, 0, 674, 0, 59, 0, 121, 0, 0, 0, 113, 0, 140, 0, 0, 0,
+  204, 444, 0, 628, 436, 973, 715, 0, 920, 633, 837, 0, 0, 0, 214, 0,
+  0, 0, 0, 687, 0, 120, 670, 0, 0, 0, 51, 100, 3, 203, 367, 707,
+  907, 0, 0, 0, 765, 0, 0, 596, 623, 746, 924, 0, 291, 368, 0, 0,
+  0, 0, 0, 41, 0, 0, 0, 0, 170, 326, 636, 644, 537, 873, 53, 813,
+  13, 508, 607, 96, 719, 0, 0, 597, 0, 0, 822, 751, 0, 0, 0, 0,
+  0, 0, 0, 0, 931, 0, 0, 954, 0, 852, 905, 400, 0, 477, 0, 0,
+  0, 0, 506, 649, 616, 150, 0, 66, 68, 481, 245, 806, 832, 0, 438, 0,
+  0, 0, 0, 0, 531, 0, 803, 439, 216, 33, 735, 0, 417, 0, 103, 0,
+  0, 0, 821, 0, 0, 834, 135, 172, 410, 727, 943, 0, 5, 48, 700, 0,
+  267, 613, 0, 301, 801, 0, 0, 0, 854, 386, 296, 378, 955, 0, 0, 0,
+  0, 0, 0, 0, 0, 198, 162, 996, 0, 64, 279, 0, 0, 286, 575, 0,
+  289, 984, 0, 862, 0, 253, 0, 744, 0, 0, 560, 783, 0, 252, 525, 0,
+  313, 0, 549, 637, 185, 266, 0, 0, 269, 551, 772, 0, 86, 0, 0, 0,
+  0, 563, 93, 554, 251, 0, 0, 0, 232, 0, 0, 0, 0, 0, 572, 0,
+  0, 589, 0, 44, 0, 0, 238, 0, 747, 835, 0, 524, 0, 0, 0, 0,
+  615, 0, 503, 690, 0, 0, 0, 0, 0, 0, 0, 0, 976, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 668, 0, 234, 295, 716, 246, 406,
+  964, 134, 965, 501, 986, 138, 395, 635, 0, 29, 166, 723, 909, 0, 926, 0,
+  0, 742, 664, 932, 55, 445, 505, 0, 0, 0, 0, 14, 0, 0, 0, 576,
+  915, 952, 992, 241, 26, 0, 0, 274, 0, 0, 0, 0, 0, 186, 0, 0,
+  0, 199, 0, 588, 0, 0, 0, 98, 696, 0, 0, 658, 0, 0, 0, 206,
+  0, 0, 364, 261, 432, 277, 659, 968, 781, 0, 92, 0, 0, 0, 0, 681,
+  0, 0, 0, 39, 207, 239, 303, 794, 989, 0, 0, 0, 0, 131, 281, 332,
+  429, 546, 579, 903, 960, 217, 219, 750, 850, 689, 0, 682, 0, 0, 359, 0,
+  0, 0, 0, 280, 661, 0, 0, 0, 205, 0, 0, 480, 0, 0, 0, 363,
+  0, 0, 592, 0, 0, 468, 784, 129, 0, 0, 0, 271, 0, 192, 0, 0,
+  942, 497, 106, 0, 0, 820, 0, 0, 0, 0, 0, 0, 0, 0, 81, 227,
+  0, 250, 0, 0, 482, 257, 521, 0, 539, 300, 660, 0, 0, 485, 0, 0,
+  0, 278, 475, 518, 778, 0, 0, 0, 0, 259, 178, 0, 0, 0, 570, 25,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 980, 0, 0, 440, 499, 0,
+  0, 0, 0, 0, 0, 0, 978, 800, 0, 0, 0, 0, 0, 0, 242, 309,
+  0, 56, 146, 433, 469, 504, 488, 703, 256, 127, 879, 255, 383, 825, 465, 101,
+  104, 625, 921, 939, 0, 390, 0, 0, 397, 369, 639, 21, 376, 385, 534, 574,
+  844, 142, 174, 859, 888, 802, 0, 885, 0, 0, 0, 0, 398, 147, 260, 388,
+  877, 557, 595, 718, 331, 692, 333, 470, 758, 0, 305, 336, 555, 629, 741, 0,
+  0, 356, 0, 263, 354, 0, 0, 0, 0, 0, 0, 0, 642, 30, 770, 0,
+  0, 0, 0, 675, 327, 0, 951, 212, 462, 559, 290, 28, 676, 882, 902, 906,
+  997, 0, 0, 0, 124, 0, 457, 793, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 536, 0, 0, 0, 0, 511, 734, 136, 933, 648, 0, 817, 413, 855, 0,
+  0, 0, 507, 0, 922, 0, 0, 0, 0, 0, 0, 0, 916, 988, 235, 790,
+  619, 0, 0, 857, 529, 872, 0, 630, 0, 0, 0, 0, 338, 370, 804, 0,
+  0, 705, 923, 600, 0, 624, 0, 0, 0, 591, 0, 0, 0, 350, 0, 0,
+  881, 0, 0, 0, 403, 495, 0, 786, 0, 0, 0, 573, 577, 0, 137, 617,
+  740, 437, 0, 826, 0, 226, 0, 0, 0, 0, 0, 0, 407, 0, 0, 340,
+  119, 711, 683, 733, 65, 0, 679, 773, 0, 228, 913, 152, 6, 36, 1000, 519,
+  361, 464, 0, 0, 0, 0, 0, 685, 248, 627, 0, 0, 0, 0, 757, 0,
+  0, 422, 0, 0, 963, 0, 89, 34, 164, 0, 0, 0, 247, 0, 983, 0,
+  308, 0, 0, 522, 0, 0, 0, 0, 858, 585, 0, 0, 0, 0, 543, 571,
+  0, 0, 380, 337, 379, 673, 500, 938, 0, 249, 83, 442, 107, 195, 236, 231,
+  262, 603, 654, 948, 0, 496, 0, 0, 456, 0, 0, 0, 95, 0, 824, 82,
+  0, 189, 443, 132, 449, 125, 312, 0, 0, 0, 0, 957, 0, 887, 0, 0,
+  527, 346, 927, 320, 0, 353, 392, 431, 970, 994, 0, 466, 656, 67, 0, 0,
+  0, 348, 771, 0, 215, 726, 0, 0, 0, 0, 0, 419, 0, 342, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 918, 0, 0, 77, 0, 0, 0, 0, 9,
+  0, 0, 0, 0, 87, 776, 956, 0, 729, 777, 0, 609, 569, 0, 0, 0,
+  0, 0, 0, 0, 929, 339, 0, 0, 0, 568, 0, 0, 0, 0, 930, 0,
+  0, 0, 709, 0, 0, 0, 0, 0, 512, 0, 848, 160, 486, 2, 515, 184,
+  405, 584, 899, 967, 282, 114, 294, 306, 840, 0, 843, 0, 450, 15, 32, 612,
+  666, 1, 743, 805, 335, 372, 491, 0, 18, 321, 168, 293, 288, 311, 122, 775,
+  0, 944, 953, 365, 0, 0, 0, 0, 0, 901, 785, 0, 484, 663, 856, 165,
+  731, 971, 123, 0, 0, 0, 0, 768, 0, 430, 0, 889, 0, 0, 0, 325,
+  0, 0, 0, 0, 752, 977, 0, 0, 0, 0, 0, 561, 0, 0, 0, 0,
+  578, 0, 878, 0, 797, 0, 874, 0, 0, 564, 197, 601, 0, 756, 0, 0,
+  728, 243, 0, 0, 0, 517, 908, 0, 0, 0, 0, 0, 453, 754, 941, 972,
+  0, 0, 460, 37, 434, 0, 201, 0, 408, 8, 0, 0, 167, 594, 884, 697,
+};
+
+const char *WA_FREQ_125_TOKENS[] = {
+  "ਮ",
+  "ਦ",
+  "ਹ",
+  "ਕ",
+  "ਨ",
+  "ਸ",
+  "ਟ",
+  "ਲ",
+  "ਗ",
+  "ਬ",
+  "ਚ",
+  "ਤ",
+  "ਰ",
+  "ਕਹ",
+  "ਵ",
+  "ਪ",
+  "ਨਹ",
+  "ਆਦ",
+  "ਆ",
+  "ਸਬ",
+  "ਛ",
+  "ਦਸ",
+  "ਘ",
+  "ਜਫ",
+  "ਈ",
+  "ੲ",
+  "ਸਹ",
+  "ਲਗਦ",
+  "ਅ",
+  "ਤਵ",
+  "ਵਲ",
+  "ਇ",
+  "ਪੜ",
+  "ਆਇਆ",
+  "ਅਤ",
+  "ਧ",
+  "ਆਨ",
+  "ਐਨ",
+  "ਭਟਕ",
+  "ਉਣ",
+  "ਕਰਨ",
+  "ੳ",
+  "ਝ",
+  "ੜ",
+  "ਣ",
+  "ਪਤ",
+};
+const uint16_t WA_FREQ_125_RANKS[] = {
+  42, 29, 0, 0, 15, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0, 0,
+  0, 38, 21, 0, 0, 44, 0, 0, 24, 0, 0, 0, 0, 0, 36, 9,
+  18, 37, 12, 40, 20, 0, 0, 32, 0, 0, 0, 0, 6, 0, 0, 23,
+  0, 2, 3, 13, 19, 31, 39, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 4, 0, 35, 0, 0, 0, 28, 0, 0, 10,
+  0, 0, 0, 0, 0, 22, 0, 7, 41, 0, 25, 45, 11, 34, 0, 0,
+  0, 0, 14, 0, 16, 30, 0, 0, 46, 0, 27, 0, 0, 0, 0, 0,
+  0, 5, 8, 0, 17, 33, 0, 43, 1, 0, 0, 0, 0, 0, 0, 0,
+};
+
+const char *WA_FREQ_126_TOKENS[] = {
+  "ta",
+  "danki",
+  "bo",
+  "mi",
+  "ban",
+  "masha",
+  "kier",
+  "casa",
+  "cu",
+  "laga",
+  "nos",
+  "sali",
+  "keiro",
+  "mama",
+  "mashá",
+  "bunita",
+  "pocopoco",
+  "y",
+  "semper",
+  "kòrsou",
+  "usa",
+  "un",
+  "sistema",
+  "di",
+  "skirbimentu",
+  "fonétiko",
+  "kon",
+  "k",
+  "e",
+  "bida",
+  "no",
+  "kere",
+};
+const uint16_t WA_FREQ_126_RANKS[] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 23, 14, 26, 0, 0,
+  0, 0, 0, 30, 0, 0, 0, 0, 7, 10, 21, 11, 0, 0, 0, 22,
+  28, 24, 1, 8, 13, 19, 0, 0, 0, 0, 15, 17, 12, 25, 5, 0,
+  9, 0, 0, 27, 29, 0, 32, 4, 0, 18, 0, 2, 3, 16, 20, 31,
+};
+
+const char *WA_FREQ_127_TOKENS[] = {
+  "nie",
+  "to",
+  "się",
+  "w",
+  "na",
+  "i",
+  "że",
+  "z",
+  "co",
+  "jest",
+  "do",
+  "tak",
+  "o",
+  "jak",
+  "ale",
+  "a",
+  "mnie",
+  "mi",
+  "za",
+  "ja",
+  "tym",
+  "tego",
+  "go",
+  "ci",
+  "po",
+  "tylko",
+  "czy",
+  "tu",
+  "może",
+  "jestem",
+  "ma",
+  "ty",
+  "cię",
+  "mam",
+  "jesteś",
+  "już",
+  "jeśli",
+  "dla",
+  "wiem",
+  "coś",
+  "dobrze",
+  "więc",
+  "od",
+  "teraz",
+  "pan",
+  "wszystko",
+  "być",
+  "będzie",
+  "masz",
+  "nic",
+  "tam",
+  "mogę",
+  "proszę",
+  "jej",
+  "są",
+  "gdzie",
+  "kiedy",
+  "ten",
+  "on",
+  "ciebie",
+  "by",
+  "sobie",
+  "ze",
+  "był",
+  "wiesz",
+  "bardzo",
+  "było",
+  "przez",
+  "jego",
+  "ją",
+  "chcę",
+  "dlaczego",
+  "pani",
+  "jeszcze",
+  "mój",
+  "nas",
+  "żeby",
+  "no",
+  "bo",
+  "chcesz",
+  "ich",
+  "też",
+  "tutaj",
+  "naprawdę",
+  "nigdy",
+  "mamy",
+  "kto",
+  "możesz",
+  "dobra",
+  "przepraszam",
+  "mu",
+  "gdy",
+  "muszę",
+  "porządku",
+  "dziękuję",
+  "nawet",
+  "chyba",
+  "domu",
+  "ona",
+  "prawda",
+  "zrobić",
+  "była",
+  "właśnie",
+  "będę",
+  "zawsze",
+  "hej",
+  "nim",
+  "nam",
+  "te",
+  "moja",
+  "musisz",
+  "je",
+  "dzięki",
+  "bez",
+  "tej",
+  "trochę",
+  "ktoś",
+  "panie",
+  "jesteśmy",
+  "moje",
+  "powiedzieć",
+  "który",
+  "czas",
+  "więcej",
+  "twój",
+  "musimy",
+  "lat",
+  "ta",
+  "chce",
+  "możemy",
+  "wszyscy",
+  "tobą",
+  "albo",
+  "prostu",
+  "chodzi",
+  "razem",
+  "stało",
+  "cześć",
+  "mną",
+  "czego",
+  "sam",
+  "myślę",
+  "pana",
+  "przed",
+  "boże",
+  "raz",
+  "czemu",
+  "będziesz",
+  "niż",
+  "ludzie",
+  "dalej",
+  "czym",
+  "was",
+  "dobry",
+  "przy",
+  "ludzi",
+  "dzień",
+  "życie",
+  "lepiej",
+  "miał",
+  "rzeczy",
+  "twoja",
+  "czasu",
+  "ok",
+  "temu",
+  "robisz",
+  "myślisz",
+  "kim",
+  "niech",
+  "które",
+  "oczywiście",
+  "siebie",
+  "niego",
+  "cóż",
+  "powiedział",
+  "u",
+  "daj",
+  "moim",
+  "chodź",
+  "musi",
+  "my",
+  "nikt",
+  "twoje",
+  "tych",
+  "pod",
+  "dlatego",
+  "pewnie",
+  "powiedz",
+  "aby",
+  "wtedy",
+  "wygląda",
+  "jeden",
+  "mojego",
+  "im",
+  "mówi",
+  "dziś",
+  "taki",
+  "mieć",
+  "jako",
+  "dwa",
+  "potem",
+  "wie",
+  "takie",
+  "nią",
+  "wszystkie",
+  "znaczy",
+  "rozumiem",
+  "dzieje",
+  "moją",
+  "będziemy",
+  "wiele",
+  "stąd",
+  "oni",
+  "mojej",
+  "miejsce",
+  "iść",
+  "kilka",
+  "pomóc",
+  "dużo",
+  "ile",
+  "jasne",
+  "byłem",
+  "swoje",
+  "myśli",
+  "cały",
+  "skąd",
+  "wiedzieć",
+  "dzieci",
+  "nich",
+  "która",
+  "wam",
+  "przykro",
+  "można",
+  "jakieś",
+  "tę",
+  "wszystkich",
+  "nad",
+  "jakiś",
+  "sposób",
+  "trzeba",
+  "mają",
+  "niej",
+  "pracy",
+  "kogoś",
+  "tyle",
+  "robić",
+  "bardziej",
+  "mówisz",
+  "zanim",
+  "zbyt",
+  "szybko",
+  "dzisiaj",
+  "tobie",
+  "takiego",
+  "świetnie",
+  "zobaczyć",
+  "zaraz",
+  "pewno",
+  "miałem",
+  "kocham",
+  "mówię",
+  "nadal",
+  "jaki",
+  "rację",
+  "kochanie",
+  "myślałem",
+  "trzy",
+  "ojciec",
+  "ani",
+  "robi",
+  "stanie",
+  "tą",
+  "później",
+  "ponieważ",
+  "idź",
+  "życia",
+  "twoim",
+  "przestań",
+  "sie",
+  "swoją",
+  "chciałem",
+  "długo",
+  "mamo",
+  "kiedyś",
+  "cholera",
+  "wciąż",
+  "nadzieję",
+  "aż",
+  "będą",
+  "jutro",
+  "każdy",
+  "dni",
+  "problem",
+  "widzę",
+  "mógł",
+  "stary",
+  "taka",
+  "żebyś",
+  "widzisz",
+  "twojej",
+  "tato",
+  "potrzebuję",
+  "znowu",
+  "kurwa",
+  "dziecko",
+  "nocy",
+  "znaleźć",
+  "sama",
+  "dokładnie",
+  "dnia",
+  "oh",
+  "pierwszy",
+  "czuję",
+  "pieniądze",
+  "powiem",
+  "zrobił",
+  "nami",
+  "miała",
+  "twoją",
+  "gdyby",
+  "nasz",
+  "nasze",
+  "razie",
+  "samo",
+  "były",
+  "dobre",
+  "słuchaj",
+  "koniec",
+  "chciał",
+  "widziałem",
+  "jakie",
+  "wszystkim",
+  "znam",
+  "wcześniej",
+  "spokój",
+  "chwilę",
+  "mama",
+  "sobą",
+  "zostać",
+  "został",
+  "wy",
+  "czegoś",
+  "żyje",
+  "mówić",
+  "bym",
+  "którzy",
+  "porozmawiać",
+  "spójrz",
+  "roku",
+  "mogą",
+  "chciałbym",
+  "zabić",
+  "poza",
+  "dom",
+  "we",
+  "imię",
+  "twojego",
+  "lub",
+  "och",
+  "miło",
+  "którą",
+  "kogo",
+  "sir",
+  "minut",
+  "jakby",
+  "prawie",
+  "drzwi",
+  "byłam",
+  "jesteście",
+  "posłuchaj",
+  "powiedziałem",
+  "powodu",
+  "powinniśmy",
+  "gdzieś",
+  "końcu",
+  "lubię",
+  "mów",
+  "sprawy",
+  "czekaj",
+  "pomysł",
+  "zrobię",
+  "wiemy",
+  "wydaje",
+  "byłeś",
+  "razy",
+  "moich",
+  "człowiek",
+  "jednak",
+  "innego",
+  "dość",
+  "pomocy",
+  "przecież",
+  "panu",
+  "broń",
+  "żadnych",
+  "noc",
+  "macie",
+  "ciągle",
+  "c",
+  "żebym",
+  "źle",
+  "powiedziała",
+  "facet",
+  "mówiłem",
+  "którego",
+  "podoba",
+  "miejscu",
+  "jeżeli",
+  "skoro",
+  "ego",
+  "ojca",
+  "powinieneś",
+  "lata",
+  "sprawa",
+  "niczego",
+  "takim",
+  "pamiętasz",
+  "sądzę",
+  "właściwie",
+  "dwie",
+  "pokoju",
+  "którym",
+  "myślałam",
+  "jedno",
+  "idziemy",
+  "również",
+  "bądź",
+  "znasz",
+  "swój",
+  "swojego",
+  "byś",
+  "chodźmy",
+  "nowy",
+  "chciałam",
+  "pewien",
+  "wczoraj",
+  "jedną",
+  "musiał",
+  "której",
+  "idę",
+  "poważnie",
+  "swoim",
+  "życiu",
+  "rozumiesz",
+  "których",
+  "podczas",
+  "miałam",
+  "oczy",
+  "rano",
+  "sprawę",
+  "wystarczy",
+  "spokojnie",
+  "całą",
+  "telefon",
+  "rzecz",
+  "matka",
+  "samochód",
+  "świat",
+  "nimi",
+  "dwóch",
+  "pracę",
+  "dać",
+  "byli",
+  "powinienem",
+  "weź",
+  "jedna",
+  "zamknij",
+  "the",
+  "mały",
+  "da",
+  "pozwól",
+  "całe",
+  "wina",
+  "wiedziałem",
+  "wrócić",
+  "między",
+  "chcą",
+  "idzie",
+  "śmierci",
+  "mówił",
+  "numer",
+  "oto",
+  "miejsca",
+  "dopóki",
+  "czujesz",
+  "cokolwiek",
+  "swojej",
+  "nikogo",
+  "dam",
+  "powiedziałeś",
+  "tłumaczenie",
+  "dziewczyna",
+  "najpierw",
+  "pamiętam",
+  "powiesz",
+  "pytanie",
+  "inaczej",
+  "świecie",
+  "znów",
+  "wyglądasz",
+  "przynajmniej",
+  "widzieć",
+  "prawdę",
+  "zrobiłem",
+  "śmierć",
+  "swoich",
+  "halo",
+  "gdybym",
+  "jednego",
+  "pieniędzy",
+  "brzmi",
+  "wierzę",
+  "innych",
+  "trzymaj",
+  "robię",
+  "ogóle",
+  "super",
+  "kobiety",
+  "potrzebuje",
+  "tata",
+  "pójdę",
+  "wielu",
+  "dokąd",
+  "ręce",
+  "zrobiłeś",
+  "miłość",
+  "całkiem",
+  "naszej",
+  "nasza",
+  "możliwe",
+  "gra",
+  "prawo",
+  "inne",
+  "każdym",
+  "chwili",
+  "kobieta",
+  "jednym",
+  "zrób",
+  "ważne",
+  "wybacz",
+  "żona",
+  "chcemy",
+  "działa",
+  "byłoby",
+  "także",
+  "słyszałem",
+  "wiedział",
+  "dziewczyny",
+  "drogi",
+  "pewna",
+  "wiecie",
+  "mówią",
+  "cieszę",
+  "dopiero",
+  "poznać",
+  "serce",
+  "inny",
+  "witam",
+  "pojęcia",
+  "parę",
+  "przeciwko",
+  "udało",
+  "powinien",
+  "została",
+  "naszym",
+  "raczej",
+  "wiadomość",
+  "pięć",
+  "s",
+  "każdego",
+  "godziny",
+  "plan",
+  "wcale",
+  "ciało",
+  "słowa",
+  "witaj",
+  "naszego",
+  "mogła",
+  "czasie",
+  "dostać",
+  "nowego",
+  "czymś",
+  "stać",
+  "oznacza",
+  "jaką",
+  "naszych",
+  "patrz",
+  "czyli",
+  "twoich",
+  "człowieka",
+  "czasem",
+  "dziwne",
+  "żyć",
+  "zostaw",
+  "zabrać",
+  "żadnego",
+  "cholery",
+  "ostatnio",
+  "rodziny",
+  "ciężko",
+  "martw",
+  "miałeś",
+  "rozmawiać",
+  "rób",
+  "ziemi",
+  "nazywa",
+  "panowie",
+  "bóg",
+  "widziałam",
+  "szczęście",
+  "syn",
+  "takich",
+  "sprawie",
+  "zabił",
+  "powrotem",
+  "możecie",
+  "godzin",
+  "potrzebujemy",
+  "diabła",
+  "panią",
+  "powinnaś",
+  "ostatni",
+  "zrobimy",
+  "mąż",
+  "wyjść",
+  "krwi",
+  "szkoły",
+  "nieźle",
+  "syna",
+  "natychmiast",
+  "słucham",
+  "mieliśmy",
+  "taką",
+  "wszystkiego",
+  "widziałeś",
+  "serio",
+  "policja",
+  "chciała",
+  "zrobisz",
+  "byliśmy",
+  "radę",
+  "zgadza",
+  "one",
+  "czasami",
+  "końca",
+  "idziesz",
+  "zostanie",
+  "powinnam",
+  "byłaś",
+  "mogłem",
+  "drodze",
+  "mieli",
+  "najbardziej",
+  "pomoc",
+  "jaka",
+  "cztery",
+  "john",
+  "strony",
+  "część",
+  "należy",
+  "jack",
+  "kimś",
+  "głowy",
+  "brat",
+  "zobaczenia",
+  "blisko",
+  "zaczekaj",
+  "powiedziałam",
+  "uwierzyć",
+  "skarbie",
+  "zły",
+  "naszą",
+  "wieczór",
+  "dolarów",
+  "twarz",
+  "zostało",
+  "świata",
+  "cała",
+  "potrzebujesz",
+  "środku",
+  "pokój",
+  "innym",
+  "obchodzi",
+  "spotkanie",
+  "chcecie",
+  "gotowy",
+  "doktorze",
+  "temat",
+  "wielki",
+  "uważaj",
+  "daleko",
+  "pół",
+  "ode",
+  "uda",
+  "dr",
+  "chociaż",
+  "kiedykolwiek",
+  "rok",
+  "lecz",
+  "miasta",
+  "d",
+  "poczekaj",
+  "robota",
+  "racja",
+  "człowiekiem",
+  "wieczorem",
+  "zależy",
+  "dobranoc",
+  "późno",
+  "chciałabym",
+  "mógłbym",
+  "krew",
+  "gdybyś",
+  "wziąć",
+  "lubi",
+  "słowo",
+  "powinno",
+  "zewnątrz",
+  "nowe",
+  "rodzina",
+  "wspaniale",
+  "mówiąc",
+  "stronie",
+  "miesięcy",
+  "głowę",
+  "robimy",
+  "znalazłem",
+  "lubisz",
+  "mniej",
+  "wrócę",
+  "wejść",
+  "wypadek",
+  "pierwsze",
+  "szybciej",
+  "tydzień",
+  "chłopaki",
+  "nieważne",
+  "pójść",
+  "praca",
+  "czeka",
+  "zobaczymy",
+  "taa",
+  "szansę",
+  "wiedziałam",
+  "widział",
+  "wody",
+  "dawaj",
+  "zna",
+  "mała",
+  "jezu",
+  "zrobi",
+  "pracować",
+  "moi",
+  "serca",
+  "jakoś",
+  "złe",
+  "chwila",
+  "prawa",
+  "sądzisz",
+  "według",
+  "spotkać",
+  "kapitanie",
+  "zupełnie",
+  "sprawdzić",
+  "mogli",
+  "ojcem",
+  "you",
+  "boga",
+  "okej",
+  "wspólnego",
+  "mówiłeś",
+  "mieście",
+  "robią",
+  "chłopak",
+  "jechać",
+  "prawdopodobnie",
+  "doktor",
+  "spać",
+  "pracuje",
+  "zdjęcia",
+  "wasza",
+  "uwagę",
+  "myśleć",
+  "mówiłam",
+  "znać",
+  "t",
+  "ciała",
+  "mógłbyś",
+  "problemy",
+  "okay",
+  "film",
+  "gotowa",
+  "tymi",
+  "zdjęcie",
+  "pogadać",
+  "brak",
+  "powiedziałaś",
+  "wiedzą",
+  "dał",
+  "małe",
+  "pomoże",
+  "ponad",
+  "mało",
+  "kilku",
+  "koleś",
+  "wkrótce",
+  "rękę",
+  "razu",
+  "mógłby",
+  "ostatnie",
+  "miasto",
+  "zrobiła",
+  "przyjaciół",
+  "stronę",
+  "góry",
+  "nazwisko",
+  "wami",
+  "pa",
+  "całym",
+  "drogę",
+  "wystarczająco",
+  "zatrzymać",
+  "droga",
+  "niemożliwe",
+  "jakąś",
+  "mike",
+  "odejść",
+  "broni",
+  "zmienić",
+  "wszędzie",
+  "prosto",
+  "rodzice",
+  "początku",
+  "policji",
+  "nagle",
+  "drugi",
+  "brata",
+  "przyjaciel",
+  "wielkie",
+  "człowieku",
+  "choć",
+  "samego",
+  "muszą",
+  "często",
+  "dziecka",
+  "pomóż",
+  "dobrym",
+  "kłopoty",
+  "nazywam",
+  "większość",
+  "zacząć",
+  "roboty",
+  "zaczyna",
+  "żaden",
+  "pozwolić",
+  "matki",
+  "miłości",
+  "trudno",
+  "błąd",
+  "drugiej",
+  "głowie",
+  "dziewczynę",
+  "pokaż",
+  "córka",
+  "godzinę",
+  "michael",
+  "żadnej",
+  "jedynie",
+  "szkole",
+  "pierwsza",
+  "musiałem",
+  "wracaj",
+  "szkoda",
+  "george",
+  "siostra",
+  "zapomnij",
+  "pomyślałem",
+  "słyszysz",
+  "ponownie",
+  "przyszedł",
+  "całkowicie",
+  "charlie",
+  "zamiast",
+  "trzymać",
+  "musicie",
+  "czuje",
+  "gówno",
+  "trzech",
+  "rady",
+  "dowiedzieć",
+  "jakaś",
+  "obiecuję",
+  "osób",
+  "niestety",
+  "zadzwonić",
+  "samochodu",
+  "czekać",
+  "zatem",
+  "jakim",
+  "miało",
+  "piękna",
+  "oraz",
+  "zostań",
+  "rany",
+  "jedziemy",
+  "dasz",
+  "kraju",
+  "zrobiłam",
+  "zostawić",
+  "historia",
+  "mimo",
+  "zobacz",
+  "głupi",
+  "nowym",
+  "faceta",
+  "dawno",
+  "pokazać",
+  "widzenia",
+  "rodzinę",
+  "obok",
+  "jednej",
+  "powie",
+  "sami",
+  "przykład",
+  "tygodniu",
+  "chciałeś",
+  "dłużej",
+  "ruszaj",
+  "oboje",
+  "dół",
+  "najlepszy",
+  "wróci",
+  "odkąd",
+  "musiała",
+  "zabawne",
+  "górę",
+  "frank",
+  "łatwo",
+  "uważam",
+  "będziecie",
+  "wieku",
+  "mówiła",
+  "joe",
+  "synu",
+  "chłopcy",
+  "złego",
+  "niczym",
+  "męża",
+  "sporo",
+  "popatrz",
+  "inni",
+  "szefie",
+  "środka",
+  "znaleźliśmy",
+  "samym",
+  "pewnego",
+  "pracuję",
+  "panno",
+  "zajmę",
+  "zamierzam",
+  "istnieje",
+  "uważasz",
+  "okazji",
+  "moment",
+  "takiej",
+  "spróbuj",
+  "znajdziemy",
+  "osobą",
+  "nikomu",
+  "kupić",
+  "sześć",
+  "gość",
+  "niby",
+  "spróbować",
+  "póki",
+  "cicho",
+  "zła",
+  "jakiegoś",
+  "uh",
+  "wezmę",
+  "walczyć",
+  "wiadomości",
+  "prawdziwe",
+  "niedługo",
+  "ciągu",
+  "żonę",
+  "tom",
+  "fbi",
+  "boję",
+  "strasznie",
+  "wasze",
+  "historii",
+  "dziewczyną",
+  "powinna",
+  "nowa",
+  "wrócił",
+  "mężczyzna",
+  "gotowi",
+  "głos",
+  "około",
+};
+const uint16_t WA_FREQ_127_RANKS[] = {
+  0, 0, 0, 294, 129, 559, 675, 0, 730, 0, 674, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 484, 0, 623, 501, 585, 754, 875, 0, 0, 0, 702,
+  0, 186, 0, 0, 0, 513, 920, 495, 968, 65, 0, 121, 0, 760, 701, 0,
+  0, 0, 290, 199, 0, 442, 642, 168, 218, 117, 343, 427, 233, 358, 665, 895,
+  295, 434, 910, 997, 0, 0, 727, 216, 0, 0, 0, 0, 598, 194, 0, 0,
+  527, 857, 111, 0, 0, 0, 824, 268, 0, 50, 697, 0, 0, 196, 516, 15,
+  449, 708, 591, 0, 0, 0, 0, 785, 0, 219, 0, 0, 0, 149, 37, 0,
+  0, 0, 0, 0, 102, 921, 960, 0, 0, 0, 0, 33, 0, 0, 227, 280,
+  643, 0, 355, 0, 548, 0, 220, 91, 335, 0, 488, 200, 0, 0, 86, 714,
+  0, 0, 0, 0, 0, 245, 0, 408, 837, 0, 0, 331, 487, 0, 0, 0,
+  603, 881, 0, 0, 0, 0, 0, 0, 0, 0, 986, 0, 0, 0, 0, 167,
+  267, 0, 420, 0, 0, 0, 0, 0, 206, 0, 247, 0, 885, 0, 0, 0,
+  570, 357, 0, 0, 191, 618, 431, 256, 792, 336, 608, 659, 0, 0, 0, 498,
+  462, 652, 422, 0, 0, 0, 242, 657, 762, 0, 211, 0, 0, 0, 243, 790,
+  0, 0, 0, 835, 232, 753, 0, 328, 0, 0, 0, 0, 0, 0, 0, 49,
+  0, 916, 272, 781, 798, 286, 471, 704, 654, 871, 0, 0, 0, 234, 0, 0,
+  0, 109, 115, 542, 0, 0, 0, 529, 0, 874, 304, 757, 0, 346, 945, 0,
+  839, 192, 930, 0, 0, 0, 791, 0, 0, 26, 53, 537, 180, 271, 646, 912,
+  0, 0, 0, 0, 0, 0, 0, 0, 40, 550, 0, 0, 0, 0, 0, 0,
+  0, 132, 807, 155, 763, 0, 114, 822, 0, 0, 0, 823, 0, 0, 0, 0,
+  0, 0, 0, 0, 63, 928, 213, 0, 0, 951, 197, 707, 991, 0, 329, 439,
+  0, 0, 0, 0, 526, 681, 596, 0, 0, 0, 0, 36, 177, 0, 28, 221,
+  430, 0, 22, 731, 926, 0, 0, 0, 360, 299, 651, 0, 891, 0, 0, 0,
+  504, 576, 821, 838, 706, 445, 711, 345, 847, 0, 0, 0, 0, 645, 0, 0,
+  0, 0, 0, 0, 573, 0, 144, 0, 0, 0, 0, 0, 412, 688, 794, 0,
+  580, 0, 0, 0, 35, 0, 539, 187, 678, 956, 709, 664, 162, 687, 282, 524,
+  414, 0, 0, 942, 0, 0, 75, 158, 908, 0, 0, 722, 259, 0, 0, 0,
+  0, 0, 380, 16, 480, 813, 0, 249, 503, 604, 656, 171, 19, 79, 341, 765,
+  932, 0, 409, 0, 0, 0, 869, 0, 0, 0, 182, 0, 0, 0, 497, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 432, 0, 0, 97, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 637, 0, 29, 465, 0, 241, 82, 185, 202, 382,
+  834, 0, 0, 0, 0, 919, 818, 270, 468, 897, 981, 306, 99, 0, 0, 479,
+  0, 0, 4, 236, 292, 0, 94, 183, 0, 946, 261, 0, 0, 0, 0, 538,
+  887, 812, 0, 641, 862, 0, 138, 0, 0, 0, 0, 20, 166, 672, 788, 876,
+  0, 0, 0, 0, 784, 0, 0, 68, 401, 592, 843, 853, 886, 613, 746, 0,
+  467, 583, 609, 941, 371, 972, 288, 0, 611, 0, 0, 0, 733, 393, 723, 215,
+  317, 736, 962, 597, 0, 0, 264, 800, 878, 437, 438, 402, 446, 224, 828, 988,
+  178, 0, 0, 0, 810, 0, 0, 30, 67, 83, 677, 406, 901, 0, 0, 364,
+  0, 375, 998, 0, 472, 0, 387, 0, 24, 46, 44, 545, 164, 0, 353, 303,
+  374, 496, 278, 531, 787, 578, 900, 0, 366, 782, 0, 911, 0, 0, 934, 175,
+  189, 0, 563, 671, 0, 0, 212, 0, 134, 842, 0, 523, 0, 0, 0, 0,
+  0, 512, 0, 0, 0, 0, 62, 0, 0, 0, 0, 8, 0, 326, 367, 555,
+  935, 349, 0, 0, 5, 145, 663, 698, 728, 0, 0, 0, 321, 0, 0, 0,
+  816, 76, 0, 0, 0, 0, 0, 0, 159, 0, 0, 140, 0, 0, 0, 51,
+  644, 339, 0, 544, 0, 0, 302, 0, 377, 123, 43, 0, 0, 394, 425, 682,
+  423, 0, 894, 0, 161, 560, 811, 693, 48, 889, 492, 0, 799, 735, 0, 237,
+  759, 0, 0, 0, 0, 404, 58, 931, 0, 0, 0, 0, 284, 139, 0, 768,
+  676, 195, 228, 383, 210, 395, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  587, 0, 0, 323, 619, 783, 883, 0, 564, 599, 745, 775, 80, 915, 150, 72,
+  699, 955, 0, 0, 0, 713, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 13, 0, 764, 0, 0, 0, 0, 673, 0, 660, 483, 749, 0, 551, 0,
+  0, 0, 0, 101, 750, 610, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  436, 0, 350, 0, 0, 0, 0, 0, 0, 0, 0, 61, 0, 528, 0, 390,
+  0, 0, 0, 0, 0, 705, 970, 827, 850, 85, 530, 973, 567, 0, 0, 0,
+  650, 936, 311, 0, 877, 0, 45, 112, 388, 493, 769, 923, 0, 0, 6, 461,
+  0, 0, 258, 285, 506, 0, 700, 0, 0, 0, 27, 330, 0, 0, 474, 773,
+  0, 0, 0, 0, 0, 0, 964, 982, 0, 809, 0, 0, 0, 0, 938, 0,
+  64, 0, 127, 0, 273, 858, 906, 0, 0, 0, 0, 0, 832, 0, 568, 0,
+  0, 0, 0, 81, 863, 136, 574, 0, 0, 0, 0, 0, 0, 0, 456, 732,
+  581, 0, 0, 566, 0, 0, 433, 0, 588, 0, 0, 0, 365, 825, 0, 113,
+  541, 0, 0, 0, 240, 638, 0, 670, 0, 338, 755, 774, 0, 308, 351, 776,
+  356, 0, 0, 489, 208, 546, 854, 929, 0, 69, 203, 344, 7, 793, 918, 0,
+  0, 0, 128, 739, 0, 0, 0, 0, 0, 0, 0, 0, 204, 283, 0, 0,
+  0, 0, 819, 0, 70, 804, 0, 0, 0, 737, 0, 119, 486, 316, 534, 649,
+  829, 0, 0, 0, 0, 147, 0, 0, 0, 0, 0, 0, 260, 606, 0, 719,
+  0, 627, 0, 0, 896, 39, 0, 386, 954, 0, 569, 0, 777, 441, 444, 980,
+  318, 0, 130, 786, 859, 0, 0, 0, 0, 0, 477, 370, 502, 953, 601, 0,
+  0, 586, 514, 0, 0, 0, 0, 0, 0, 557, 0, 0, 0, 0, 188, 142,
+  0, 0, 124, 0, 0, 106, 0, 0, 0, 0, 0, 435, 0, 0, 801, 32,
+  505, 848, 0, 0, 322, 0, 0, 0, 418, 628, 635, 965, 223, 0, 0, 0,
+  0, 0, 0, 455, 882, 0, 0, 450, 426, 913, 0, 0, 789, 0, 743, 987,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 577, 963, 0, 254, 277, 38,
+  0, 0, 0, 92, 226, 561, 510, 0, 89, 802, 253, 806, 0, 122, 0, 0,
+  0, 0, 0, 692, 372, 327, 0, 235, 729, 0, 0, 60, 156, 0, 291, 413,
+  0, 0, 0, 758, 0, 0, 0, 0, 0, 977, 0, 0, 0, 0, 0, 867,
+  407, 137, 927, 205, 0, 74, 971, 689, 0, 995, 0, 0, 0, 47, 251, 354,
+  879, 14, 405, 361, 0, 0, 0, 231, 0, 0, 892, 0, 391, 287, 0, 0,
+  778, 0, 0, 0, 691, 499, 520, 710, 275, 636, 933, 214, 0, 0, 0, 448,
+  473, 0, 0, 959, 0, 0, 899, 95, 966, 342, 621, 0, 198, 717, 917, 772,
+  0, 0, 0, 0, 279, 0, 0, 0, 0, 0, 669, 536, 31, 0, 0, 108,
+  904, 0, 0, 309, 0, 229, 310, 612, 685, 712, 34, 0, 0, 683, 724, 0,
+  556, 0, 950, 0, 0, 9, 607, 525, 0, 0, 0, 0, 0, 0, 648, 190,
+  0, 0, 301, 265, 0, 0, 0, 0, 833, 0, 0, 0, 803, 252, 0, 269,
+  0, 458, 0, 989, 0, 630, 0, 751, 0, 870, 0, 222, 893, 0, 830, 201,
+  0, 0, 0, 0, 0, 0, 410, 655, 620, 686, 0, 0, 0, 0, 0, 463,
+  0, 0, 0, 695, 0, 0, 0, 0, 0, 0, 490, 615, 0, 0, 0, 0,
+  0, 0, 820, 0, 0, 0, 0, 381, 0, 0, 0, 217, 795, 840, 0, 17,
+  0, 0, 0, 0, 333, 0, 0, 907, 244, 174, 384, 396, 173, 398, 389, 814,
+  0, 734, 0, 416, 0, 507, 595, 157, 766, 0, 340, 457, 770, 105, 0, 0,
+  397, 873, 752, 0, 0, 0, 225, 0, 0, 466, 0, 126, 0, 320, 248, 0,
+  0, 0, 747, 0, 0, 634, 0, 0, 0, 246, 582, 992, 0, 0, 855, 56,
+  176, 0, 42, 0, 116, 0, 0, 18, 0, 0, 369, 0, 0, 826, 352, 0,
+  368, 0, 0, 0, 0, 0, 0, 0, 667, 25, 239, 575, 154, 0, 0, 0,
+  0, 851, 0, 289, 841, 0, 0, 0, 0, 565, 0, 0, 868, 0, 0, 0,
+  590, 0, 562, 522, 756, 967, 0, 0, 165, 0, 0, 0, 0, 690, 0, 0,
+  0, 0, 0, 0, 0, 460, 0, 808, 230, 594, 521, 0, 0, 0, 543, 348,
+  0, 0, 0, 172, 125, 716, 922, 633, 961, 274, 993, 1000, 999, 12, 0, 0,
+  0, 767, 872, 0, 0, 293, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 849, 0, 0, 0, 0, 0, 0, 0, 742, 0, 0, 0, 107, 0, 815,
+  385, 540, 0, 0, 860, 509, 898, 494, 104, 0, 944, 508, 880, 362, 616, 519,
+  0, 0, 0, 103, 334, 958, 0, 73, 943, 0, 0, 181, 419, 485, 866, 0,
+  0, 558, 533, 653, 846, 209, 90, 77, 805, 0, 0, 100, 0, 0, 0, 141,
+  428, 475, 476, 617, 864, 0, 0, 0, 0, 0, 0, 949, 0, 170, 0, 0,
+  0, 403, 0, 0, 0, 0, 553, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  797, 890, 0, 153, 464, 0, 647, 549, 0, 148, 600, 852, 0, 715, 0, 905,
+  324, 481, 57, 605, 679, 373, 865, 314, 0, 0, 0, 0, 861, 940, 0, 978,
+  0, 0, 696, 0, 281, 976, 0, 0, 96, 451, 796, 658, 55, 152, 193, 179,
+  909, 347, 680, 0, 120, 640, 0, 0, 0, 0, 87, 589, 0, 584, 662, 0,
+  0, 0, 0, 453, 884, 400, 0, 0, 54, 0, 0, 2, 276, 721, 0, 0,
+  0, 602, 632, 720, 836, 0, 0, 844, 515, 0, 0, 0, 0, 0, 411, 0,
+  0, 969, 0, 417, 614, 985, 0, 66, 948, 0, 0, 298, 359, 71, 447, 305,
+  23, 169, 622, 744, 0, 0, 163, 469, 957, 238, 207, 845, 0, 0, 703, 0,
+  0, 0, 0, 296, 482, 535, 0, 0, 440, 0, 415, 0, 0, 0, 0, 0,
+  0, 0, 0, 93, 443, 452, 0, 0, 84, 914, 0, 0, 332, 59, 325, 0,
+  0, 0, 903, 0, 0, 0, 0, 0, 0, 0, 0, 0, 856, 902, 250, 0,
+  937, 0, 0, 0, 315, 0, 3, 0, 0, 0, 0, 0, 262, 572, 312, 661,
+  738, 517, 990, 725, 454, 0, 1, 98, 925, 478, 307, 626, 337, 131, 817, 0,
+  0, 0, 0, 0, 0, 0, 146, 0, 0, 0, 378, 500, 0, 0, 0, 0,
+  0, 0, 0, 459, 118, 143, 297, 300, 518, 133, 376, 552, 726, 994, 979, 0,
+  392, 0, 0, 0, 0, 160, 0, 0, 0, 0, 547, 151, 470, 532, 624, 0,
+  888, 974, 996, 0, 0, 668, 0, 0, 0, 110, 0, 0, 41, 424, 0, 0,
+  0, 399, 52, 0, 511, 0, 0, 0, 0, 554, 255, 421, 257, 0, 0, 0,
+  0, 0, 0, 939, 0, 0, 491, 266, 718, 625, 780, 0, 0, 779, 0, 0,
+  0, 0, 0, 579, 694, 0, 429, 0, 0, 0, 666, 0, 0, 593, 684, 0,
+  0, 313, 379, 975, 0, 748, 0, 924, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 11, 0, 263, 0, 0, 831, 21, 761, 0, 0, 0, 319, 0, 0, 741,
+  947, 0, 0, 771, 984, 0, 0, 0, 0, 0, 88, 0, 0, 629, 0, 0,
+  0, 0, 0, 0, 639, 184, 740, 952, 571, 983, 0, 135, 631, 363, 78, 0,
+};
+
+const char *WA_FREQ_128_TOKENS[] = {
+  "ast",
+  "ni",
+  "dabber",
+  "ezze",
+  "mes",
+  "zinnimai",
+  "tikran",
+  "kelli",
+  "tāšis",
+  "penningans",
+  "tu",
+  "gaūne",
+  "swāimans",
+  "wūraisins",
+  "as",
+  "gaūwuns",
+  "tenessei",
+  "neggi",
+  "aīnan",
+  "pēismen",
+  "tū",
+  "dīlawuns",
+  "brendu",
+  "tenesse",
+  "genā",
+  "afrikīnini",
+  "iz",
+  "mōzambikan",
+  "ābli",
+  "zalli",
+  "tāns",
+  "sōcialists",
+  "majs",
+  "kattins",
+  "galinnuns",
+  "šan",
+  "pellin",
+  "autō",
+  "jāt",
+  "aīnat",
+  "dīwais",
+  "adder",
+  "walnāi",
+  "pintei",
+  "zēistan",
+  "lāiskas",
+  "na",
+  "stalu",
+};
+const uint16_t WA_FREQ_128_RANKS[] = {
+  0, 0, 0, 0, 5, 0, 0, 40, 46, 12, 0, 0, 0, 0, 0, 0,
+  15, 36, 0, 0, 0, 23, 0, 0, 0, 2, 8, 25, 27, 44, 18, 0,
+  0, 0, 0, 0, 4, 10, 47, 7, 39, 42, 0, 0, 0, 14, 0, 0,
+  0, 35, 0, 48, 0, 0, 1, 0, 41, 13, 38, 0, 17, 21, 0, 0,
+  24, 0, 0, 0, 0, 32, 0, 0, 0, 0, 0, 30, 0, 0, 0, 0,
+  0, 0, 0, 0, 45, 0, 22, 29, 0, 0, 0, 0, 0, 9, 11, 0,
+  0, 0, 3, 28, 19, 33, 0, 0, 26, 0, 0, 0, 31, 20, 0, 0,
+  0, 34, 0, 37, 0, 0, 0, 0, 0, 0, 0, 0, 16, 6, 43, 0,
+};
+
+const char *WA_FREQ_129_TOKENS[] = {
+  "ته",
+  "د",
+  "ـ",
+  "دی",
+  "نه",
+  "ده",
+  "سمیع",
+  "وهغه",
+  "غوږ",
+  "نیولی",
+  "وو",
+  "زه",
+  "ښه",
+  "یم",
+  "خپله",
+  "څنګه",
+  "یې",
+  "دا",
+  "پښتو",
+  "ياد",
+  "نقاد",
+  "قلندر",
+  "مومند",
+  "کلے",
+  "دے",
+  "لس",
+  "کاله",
+  "وړاندې",
+  "ایله",
+  "څلوېښت",
+  "زره",
+  "نجونو",
+  "کونړ",
+  "کې",
+  "زده",
+  "کړې",
+  "کولې",
+  "خو",
+  "اوس",
+  "دغه",
+  "شمېر",
+  "دوه",
+  "اویا",
+  "زرو",
+  "رسیدلی",
+  "ټام",
+  "او",
+  "ماری",
+  "دلته",
+  "چیښی",
+  "کوي",
+  "سکيم",
+  "چوک",
+  "لږ",
+  "مخکښې",
+  "احمد",
+  "خېلو",
+  "يوه",
+  "لاره",
+  "تلې",
+  "هیڅ",
+  "سوک",
+  "ځما",
+  "اوښکی",
+  "وینی",
+  "صلى",
+  "الله",
+  "عليه",
+  "وسلم",
+  "هغه",
+  "يو",
+  "ډېر",
+  "فکرمند",
+  "کس",
+  "ایا",
+  "نن",
+  "دده",
+  "سالګره",
+};
+const uint16_t WA_FREQ_129_RANKS[] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 16, 0,
+  13, 54, 15, 0, 0, 0, 43, 0, 0, 0, 70, 0, 0, 0, 0, 0,
+  0, 0, 0, 12, 0, 27, 0, 6, 0, 0, 75, 30, 65, 72, 0, 37,
+  77, 47, 4, 0, 0, 0, 0, 14, 40, 56, 0, 0, 44, 0, 0, 0,
+  55, 0, 66, 0, 0, 0, 0, 0, 0, 50, 60, 0, 0, 0, 0, 33,
+  0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 0,
+  0, 0, 0, 0, 20, 0, 0, 0, 0, 0, 0, 0, 11, 32, 21, 0,
+  0, 0, 67, 23, 62, 0, 0, 0, 0, 0, 0, 0, 76, 0, 0, 0,
+  0, 0, 0, 0, 45, 69, 49, 0, 0, 78, 0, 74, 0, 0, 0, 0,
+  19, 3, 52, 0, 51, 63, 31, 53, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 61, 0, 0, 59, 17, 41, 7, 0, 0, 0, 0, 0, 0, 0, 36,
+  0, 0, 0, 0, 39, 0, 0, 0, 0, 0, 35, 0, 1, 0, 0, 0,
+  71, 0, 0, 0, 29, 58, 0, 0, 0, 64, 0, 0, 0, 34, 0, 0,
+  26, 0, 0, 0, 0, 0, 28, 0, 0, 68, 0, 0, 0, 73, 0, 0,
+  0, 0, 0, 57, 0, 22, 0, 0, 0, 0, 0, 0, 24, 5, 10, 0,
+  42, 0, 0, 38, 0, 0, 0, 0, 0, 46, 0, 0, 0, 8, 9, 48,
+};
+
+const char *WA_FREQ_130_TOKENS[] = {
+  "que",
+  "a",
+  "o",
+  "não",
+  "de",
+  "é",
+  "e",
+  "um",
+  "para",
+  "eu",
+  "uma",
+  "está",
+  "com",
+  "se",
+  "do",
+  "por",
+  "os",
+  "ele",
+  "mas",
+  "em",
+  "bem",
+  "isso",
+  "da",
+  "como",
+  "sim",
+  "as",
+  "no",
+  "mais",
+  "na",
+  "meu",
+  "aqui",
+  "me",
+  "muito",
+  "foi",
+  "ela",
+  "isto",
+  "estou",
+  "fazer",
+  "vamos",
+  "já",
+  "ser",
+  "vai",
+  "à",
+  "minha",
+  "só",
+  "ao",
+  "tem",
+  "tudo",
+  "te",
+  "porque",
+  "há",
+  "tenho",
+  "vou",
+  "tu",
+  "sei",
+  "quando",
+  "agora",
+  "estás",
+  "você",
+  "lá",
+  "então",
+  "ter",
+  "era",
+  "quem",
+  "onde",
+  "nada",
+  "ou",
+  "coisa",
+  "dizer",
+  "são",
+  "quero",
+  "estava",
+  "sou",
+  "seu",
+  "pode",
+  "mesmo",
+  "esta",
+  "eles",
+  "nós",
+  "sua",
+  "dos",
+  "todos",
+  "nos",
+  "mim",
+  "posso",
+  "bom",
+  "ver",
+  "este",
+  "casa",
+  "temos",
+  "tens",
+  "tua",
+  "nunca",
+  "estão",
+  "até",
+  "assim",
+  "teu",
+  "acho",
+  "falar",
+  "disse",
+  "ainda",
+  "tempo",
+  "também",
+  "ir",
+  "pai",
+  "sobre",
+  "vez",
+  "quê",
+  "quer",
+  "és",
+  "favor",
+  "depois",
+  "tão",
+  "melhor",
+  "mãe",
+  "talvez",
+  "olá",
+  "obrigado",
+  "noite",
+  "ti",
+  "sabes",
+  "sempre",
+  "deus",
+  "estamos",
+  "alguém",
+  "dia",
+  "certo",
+  "nem",
+  "alguma",
+  "vida",
+  "anos",
+  "dele",
+  "sem",
+  "vais",
+  "das",
+  "tinha",
+  "estar",
+  "queres",
+  "coisas",
+  "homem",
+  "pessoas",
+  "algo",
+  "pelo",
+  "ficar",
+  "boa",
+  "sabe",
+  "parece",
+  "claro",
+  "dois",
+  "verdade",
+  "tipo",
+  "preciso",
+  "antes",
+  "senhor",
+  "lhe",
+  "podes",
+  "apenas",
+  "sr.",
+  "faz",
+  "vocês",
+  "ninguém",
+  "trabalho",
+  "outra",
+  "espera",
+  "saber",
+  "comigo",
+  "vão",
+  "dinheiro",
+  "aí",
+  "podemos",
+  "pouco",
+  "essa",
+  "esse",
+  "grande",
+  "pois",
+  "pela",
+  "qualquer",
+  "disso",
+  "num",
+  "qual",
+  "desculpa",
+  "dela",
+  "hoje",
+  "toda",
+  "deve",
+  "mulher",
+  "queria",
+  "fora",
+  "filho",
+  "cá",
+  "seja",
+  "meus",
+  "nosso",
+  "olha",
+  "vá",
+  "daqui",
+  "sério",
+  "oh",
+  "nossa",
+  "certeza",
+  "diz",
+  "nome",
+  "às",
+  "outro",
+  "todo",
+  "dar",
+  "tentar",
+  "sair",
+  "têm",
+  "quanto",
+  "pensar",
+  "mal",
+  "volta",
+  "aconteceu",
+  "consigo",
+  "três",
+  "mundo",
+  "menos",
+  "amigo",
+  "contigo",
+  "embora",
+  "numa",
+  "passa",
+  "porquê",
+  "problema",
+  "carro",
+  "lado",
+  "vezes",
+  "nas",
+  "fez",
+  "seus",
+  "novo",
+  "merda",
+  "parte",
+  "todas",
+  "aos",
+  "obrigada",
+  "primeiro",
+  "será",
+  "lugar",
+  "voltar",
+  "pensei",
+  "algum",
+  "achas",
+  "vem",
+  "dentro",
+  "família",
+  "ali",
+  "razão",
+  "aquele",
+  "dias",
+  "fui",
+  "anda",
+  "querida",
+  "sabia",
+  "duas",
+  "ideia",
+  "hora",
+  "si",
+  "polícia",
+  "podem",
+  "forma",
+  "entre",
+  "caso",
+  "gosto",
+  "atrás",
+  "homens",
+  "devia",
+  "aquilo",
+  "amor",
+  "pessoa",
+  "ok",
+  "podia",
+  "uns",
+  "desde",
+  "somos",
+  "cabeça",
+  "horas",
+  "deles",
+  "fica",
+  "ajudar",
+  "tarde",
+  "momento",
+  "tal",
+  "tenha",
+  "pronto",
+  "fiz",
+  "foram",
+  "ia",
+  "cidade",
+  "amigos",
+  "encontrar",
+  "frente",
+  "sido",
+  "passar",
+  "deixar",
+  "vi",
+  "nenhum",
+  "gente",
+  "durante",
+  "seria",
+  "outros",
+  "entrar",
+  "chegar",
+  "nova",
+  "trabalhar",
+  "quase",
+  "desculpe",
+  "amanhã",
+  "tanto",
+  "fosse",
+  "história",
+  "irmão",
+  "cima",
+  "contra",
+  "morrer",
+  "maneira",
+  "suas",
+  "enquanto",
+  "alguns",
+  "ajuda",
+  "precisa",
+  "morto",
+  "primeira",
+  "porta",
+  "minhas",
+  "medo",
+  "morte",
+  "aquela",
+  "óptimo",
+  "caminho",
+  "vir",
+  "feliz",
+  "sinto",
+  "minutos",
+  "ouvir",
+  "desta",
+  "tive",
+  "neste",
+  "matar",
+  "cada",
+  "estes",
+  "acontecer",
+  "espero",
+  "ano",
+  "rapaz",
+  "precisamos",
+  "for",
+  "causa",
+  "feito",
+  "sorte",
+  "lamento",
+  "filha",
+  "acha",
+  "teus",
+  "levar",
+  "conta",
+  "estas",
+  "arma",
+  "pessoal",
+  "quarto",
+  "olhos",
+  "senhora",
+  "adeus",
+  "cara",
+  "disto",
+  "algumas",
+  "juntos",
+  "difícil",
+  "última",
+  "única",
+  "manhã",
+  "importante",
+  "poder",
+  "mãos",
+  "ei",
+  "água",
+  "começar",
+  "faço",
+  "perto",
+  "cuidado",
+  "sangue",
+  "nossos",
+  "semana",
+  "mesma",
+  "usar",
+  "significa",
+  "acredito",
+  "querem",
+  "cinco",
+  "acabou",
+  "problemas",
+  "corpo",
+  "altura",
+  "disseste",
+  "nisso",
+  "chefe",
+  "jogo",
+  "guerra",
+  "fala",
+  "procura",
+  "dr.",
+  "sabemos",
+  "fizeste",
+  "ouve",
+  "realmente",
+  "terra",
+  "havia",
+  "ontem",
+  "umas",
+  "deixa-me",
+  "dólares",
+  "comer",
+  "dormir",
+  "dá",
+  "escola",
+  "logo",
+  "querido",
+  "sabem",
+  "fim",
+  "deste",
+  "eram",
+  "pára",
+  "agente",
+  "equipa",
+  "rapariga",
+  "marido",
+  "calma",
+  "coração",
+  "segurança",
+  "viver",
+  "estado",
+  "parar",
+  "teve",
+  "segundo",
+  "muitas",
+  "quatro",
+  "mão",
+  "baixo",
+  "maior",
+  "meio",
+  "meses",
+  "mau",
+  "vê",
+  "ouvi",
+  "andar",
+  "rápido",
+  "número",
+  "vejo",
+  "mulheres",
+  "morreu",
+  "nenhuma",
+  "acordo",
+  "festa",
+  "fazes",
+  "capitão",
+  "raio",
+  "pais",
+  "suficiente",
+  "poderia",
+  "sra.",
+  "crianças",
+  "estavam",
+  "força",
+  "muitos",
+  "nesta",
+  "presidente",
+  "buscar",
+  "filhos",
+  "perder",
+  "esperar",
+  "viu",
+  "irmã",
+  "chega",
+  "possível",
+  "devias",
+  "sai",
+  "acabar",
+  "rapazes",
+  "precisas",
+  "elas",
+  "contar",
+  "idiota",
+  "olhar",
+  "vossa",
+  "teria",
+  "foste",
+  "estavas",
+  "pena",
+  "mil",
+  "longe",
+  "faça",
+  "penso",
+  "tivesse",
+  "tuas",
+  "pedir",
+  "estranho",
+  "importa",
+  "fácil",
+  "muita",
+  "veio",
+  "brincar",
+  "bebé",
+  "plano",
+  "devo",
+  "prazer",
+  "velho",
+  "conseguir",
+  "passado",
+  "tomar",
+  "além",
+  "jantar",
+  "dá-me",
+  "depressa",
+  "pergunta",
+  "tirar",
+  "pequeno",
+  "descobrir",
+  "sala",
+  "ah",
+  "telefone",
+  "trás",
+  "seis",
+  "culpa",
+  "vos",
+  "exactamente",
+  "possa",
+  "deixa",
+  "errado",
+  "vivo",
+  "menina",
+  "john",
+  "casamento",
+  "outras",
+  "espere",
+  "pensa",
+  "jack",
+  "nossas",
+  "correr",
+  "mudar",
+  "diga",
+  "paz",
+  "sentir",
+  "cama",
+  "gostava",
+  "sozinho",
+  "pelos",
+  "comida",
+  "sequer",
+  "falta",
+  "ficou",
+  "conheço",
+  "gosta",
+  "passou",
+  "bastante",
+  "deu",
+  "provavelmente",
+  "palavra",
+  "demasiado",
+  "diferente",
+  "essas",
+  "armas",
+  "digo",
+  "licença",
+  "demais",
+  "pagar",
+  "médico",
+  "seguir",
+  "semanas",
+  "consegues",
+  "dizem",
+  "matou",
+  "único",
+  "acreditar",
+  "local",
+  "fazem",
+  "pior",
+  "próprio",
+  "continua",
+  "vosso",
+  "consegue",
+  "fico",
+  "diz-me",
+  "país",
+  "gostaria",
+  "forte",
+  "partir",
+  "prisão",
+  "próxima",
+  "especial",
+  "esteja",
+  "livro",
+  "oportunidade",
+  "viste",
+  "rei",
+  "chegou",
+  "esses",
+  "continuar",
+  "resto",
+  "ar",
+  "estive",
+  "hospital",
+  "sítio",
+  "fazê-lo",
+  "raios",
+  "ligar",
+  "porra",
+  "minuto",
+  "irá",
+  "sentido",
+  "atenção",
+  "vim",
+  "quis",
+  "sam",
+  "queremos",
+  "direito",
+  "café",
+  "venha",
+  "visto",
+  "criança",
+  "luz",
+  "filme",
+  "música",
+  "portanto",
+  "haver",
+  "esteve",
+  "aqueles",
+  "pôr",
+  "querer",
+  "sexo",
+  "fogo",
+  "connosco",
+  "beber",
+  "toma",
+  "mr",
+  "houve",
+  "tratar",
+  "pequena",
+  "ganhar",
+  "ponto",
+  "milhões",
+  "manter",
+  "precisar",
+  "rua",
+  "olhe",
+  "pé",
+  "fazemos",
+  "encontrei",
+  "miúda",
+  "existe",
+  "arranjar",
+  "dez",
+  "último",
+  "assassino",
+  "miúdo",
+  "tinhas",
+  "estávamos",
+  "cedo",
+  "vês",
+  "boca",
+  "boas",
+  "acontece",
+  "jovem",
+  "preocupes",
+  "comprar",
+  "situação",
+  "esposa",
+  "sistema",
+  "devem",
+  "jogar",
+  "natal",
+  "capaz",
+  "certa",
+  "michael",
+  "amiga",
+  "seguro",
+  "questão",
+  "relação",
+  "perguntas",
+  "encontro",
+  "sob",
+  "cão",
+  "quiseres",
+  "negócio",
+  "quiser",
+  "nisto",
+  "sinal",
+  "linda",
+  "facto",
+  "mensagem",
+  "próximo",
+  "apanhar",
+  "adoro",
+  "crime",
+  "banho",
+  "própria",
+  "deves",
+  "grandes",
+  "chamada",
+  "finalmente",
+  "novamente",
+  "futuro",
+  "começou",
+  "perguntar",
+  "notícias",
+  "acabei",
+  "fique",
+  "ambos",
+  "lhes",
+  "chamar",
+  "entendo",
+  "cabelo",
+  "entra",
+  "grupo",
+  "doutor",
+  "salvar",
+  "livre",
+  "viagem",
+  "vontade",
+  "sozinha",
+  "conversa",
+  "tipos",
+  "fugir",
+  "palavras",
+  "consegui",
+  "tinham",
+  "devíamos",
+  "lista",
+  "gostas",
+  "lutar",
+  "escritório",
+  "peço",
+  "final",
+  "procurar",
+  "deixou",
+  "alto",
+  "interessa",
+  "bonito",
+  "chão",
+  "campo",
+  "perfeito",
+  "tio",
+  "estiver",
+  "pelas",
+  "dito",
+  "respeito",
+  "completamente",
+  "deveria",
+  "vista",
+  "charlie",
+  "breve",
+  "melhores",
+  "á",
+  "bonita",
+  "normal",
+  "devemos",
+  "fiquei",
+  "mortos",
+  "faria",
+  "tom",
+  "mesa",
+  "preso",
+  "simples",
+  "iria",
+  "fixe",
+  "emprego",
+  "achei",
+  "faças",
+  "chama",
+  "linha",
+  "dizes",
+  "real",
+  "nave",
+  "lembras-te",
+  "assunto",
+  "vale",
+  "cala-te",
+  "ataque",
+  "pensava",
+  "frank",
+  "ai",
+  "graças",
+  "escolha",
+  "ordem",
+  "viva",
+  "fundo",
+  "terá",
+  "doente",
+  "acidente",
+  "má",
+  "the",
+  "modo",
+  "provas",
+  "resposta",
+  "bocado",
+  "papá",
+  "avião",
+  "deixe-me",
+  "vindo",
+  "após",
+  "erro",
+  "acredita",
+  "miúdos",
+  "verdadeiro",
+  "jesus",
+  "idade",
+  "fizeram",
+  "fantástico",
+  "pare",
+  "morta",
+  "leva",
+  "percebo",
+  "saiu",
+  "pensas",
+  "advogado",
+  "conhece",
+  "espaço",
+  "estivesse",
+  "fazia",
+  "serviço",
+  "missão",
+  "ler",
+  "louco",
+  "bons",
+  "conhecer",
+  "nele",
+  "lindo",
+  "informação",
+  "abrir",
+  "mente",
+  "mike",
+  "perceber",
+  "amo-te",
+  "programa",
+  "veja",
+  "sol",
+  "fomos",
+  "simplesmente",
+  "caixa",
+  "sete",
+  "senhores",
+  "hotel",
+  "nessa",
+  "gostar",
+  "incrível",
+  "puta",
+  "amo",
+  "vai-te",
+  "david",
+  "dor",
+  "joe",
+  "dessa",
+  "presente",
+  "carta",
+  "governo",
+  "barco",
+  "loja",
+  "energia",
+  "pra",
+  "vítima",
+  "roupa",
+  "voz",
+  "trouxe",
+  "luta",
+  "câmara",
+  "disse-me",
+  "fome",
+  "professor",
+  "estúpido",
+  "mamã",
+  "mostrar",
+  "hipótese",
+  "telemóvel",
+  "reunião",
+  "prova",
+  "s",
+  "percebi",
+  "casar",
+  "general",
+  "peter",
+  "volto",
+  "trazer",
+  "olho",
+  "chamado",
+  "conseguiu",
+  "exército",
+  "através",
+  "lei",
+  "digas",
+  "banco",
+  "naquela",
+  "deixe",
+  "nesse",
+  "disseram",
+  "conseguimos",
+  "segunda",
+  "tempos",
+  "podias",
+  "tocar",
+  "mês",
+  "tiro",
+  "fbi",
+  "soube",
+  "tenhas",
+  "quantos",
+  "creio",
+  "george",
+  "papel",
+  "sonho",
+  "ver-te",
+  "desse",
+  "tínhamos",
+  "bar",
+  "povo",
+  "tentei",
+  "eras",
+  "fizemos",
+  "cena",
+  "tenente",
+  "centro",
+  "tivemos",
+  "conversar",
+  "teres",
+  "nao",
+  "vê-lo",
+  "proteger",
+  "diabo",
+  "parabéns",
+  "bebida",
+  "aposto",
+  "base",
+  "tradução",
+  "sinto-me",
+  "esperem",
+  "excelente",
+  "comandante",
+  "voltou",
+  "namorada",
+  "precisam",
+  "sabias",
+  "empresa",
+  "resolver",
+  "metade",
+  "impossível",
+  "lembro",
+  "desapareceu",
+  "interessante",
+  "acerca",
+  "segundos",
+  "cair",
+  "engraçado",
+  "bela",
+  "mentir",
+  "costas",
+  "chave",
+  "divertido",
+  "ouviste",
+  "juro",
+  "escrever",
+  "piada",
+  "oito",
+  "levou",
+  "passada",
+  "guarda",
+  "controlo",
+  "daí",
+  "apartamento",
+  "segredo",
+  "decisão",
+  "funciona",
+  "posição",
+  "surpresa",
+  "parecia",
+  "cerca",
+  "céu",
+  "negócios",
+  "cabo",
+  "receber",
+  "motivo",
+  "imediatamente",
+  "olhem",
+  "vidas",
+  "passo",
+  "tribunal",
+  "max",
+  "contacto",
+  "começa",
+  "ora",
+  "ótimo",
+  "bolas",
+  "trabalha",
+  "tenham",
+  "inferno",
+  "estrada",
+  "delas",
+  "falei",
+  "diria",
+  "cheio",
+  "companhia",
+  "ouça",
+};
+const uint16_t WA_FREQ_130_RANKS[] = {
+  949, 0, 81, 0, 0, 0, 0, 0, 242, 0, 0, 195, 128, 247, 0, 90,
+  26, 308, 232, 252, 427, 0, 0, 672, 666, 774, 0, 299, 0, 901, 0, 0,
+  0, 0, 0, 0, 0, 0, 625, 0, 0, 111, 294, 442, 590, 556, 68, 826,
+  988, 0, 0, 0, 0, 0, 783, 641, 749, 0, 0, 0, 0, 0, 0, 0,
+  456, 424, 712, 0, 0, 17, 821, 0, 841, 974, 693, 718, 0, 0, 0, 0,
+  0, 0, 169, 688, 531, 263, 689, 804, 0, 390, 0, 0, 813, 0, 616, 0,
+  0, 0, 0, 200, 792, 933, 0, 449, 524, 573, 588, 624, 4, 766, 0, 219,
+  896, 0, 296, 329, 481, 0, 467, 710, 950, 586, 305, 234, 940, 226, 420, 918,
+  283, 0, 655, 653, 0, 0, 0, 0, 0, 834, 333, 337, 954, 0, 938, 0,
+  0, 0, 462, 0, 0, 289, 73, 45, 36, 508, 696, 963, 584, 0, 0, 0,
+  222, 0, 0, 0, 0, 0, 0, 871, 221, 872, 0, 0, 837, 0, 868, 368,
+  199, 466, 370, 732, 741, 862, 124, 231, 375, 644, 845, 985, 986, 0, 511, 554,
+  754, 0, 0, 603, 770, 0, 0, 0, 0, 0, 180, 686, 0, 0, 762, 0,
+  683, 0, 0, 0, 0, 0, 619, 532, 0, 0, 357, 0, 0, 534, 0, 0,
+  0, 960, 284, 0, 714, 0, 592, 667, 450, 646, 0, 0, 0, 0, 549, 0,
+  0, 0, 991, 0, 266, 0, 599, 0, 496, 486, 146, 648, 812, 966, 983, 0,
+  194, 49, 684, 925, 0, 0, 0, 429, 107, 829, 676, 907, 492, 0, 78, 602,
+  0, 0, 0, 0, 0, 0, 0, 709, 42, 0, 859, 298, 217, 973, 0, 288,
+  755, 521, 359, 0, 0, 0, 358, 213, 278, 0, 0, 0, 0, 0, 0, 187,
+  621, 0, 312, 0, 0, 0, 823, 161, 903, 0, 0, 0, 0, 744, 0, 0,
+  0, 432, 201, 562, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 560, 0,
+  0, 0, 982, 0, 279, 129, 324, 742, 830, 580, 0, 394, 0, 0, 54, 494,
+  457, 530, 0, 600, 72, 885, 156, 384, 633, 915, 930, 810, 353, 0, 0, 0,
+  0, 446, 869, 162, 314, 453, 0, 0, 503, 0, 0, 51, 0, 316, 417, 634,
+  172, 0, 0, 127, 143, 574, 63, 472, 327, 627, 661, 748, 769, 847, 0, 286,
+  498, 777, 924, 0, 9, 46, 437, 0, 0, 0, 0, 0, 0, 0, 0, 152,
+  277, 857, 0, 32, 0, 0, 0, 0, 245, 773, 402, 460, 0, 0, 0, 0,
+  0, 455, 910, 2, 100, 0, 931, 828, 0, 0, 0, 753, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 877, 0, 70, 0, 0, 0, 0, 448, 0, 0, 0,
+  0, 0, 115, 967, 0, 0, 208, 895, 0, 0, 0, 356, 140, 499, 843, 160,
+  980, 0, 0, 382, 543, 59, 413, 0, 568, 0, 515, 227, 39, 640, 670, 434,
+  67, 354, 362, 838, 0, 0, 0, 0, 791, 147, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 403, 76, 106, 992, 808, 0, 254, 372, 734, 848, 19, 953,
+  0, 0, 0, 0, 564, 251, 916, 771, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 639, 0, 0, 0, 788, 343, 0, 0, 0, 0, 0, 555, 0, 0, 818,
+  181, 0, 0, 0, 0, 58, 463, 218, 0, 0, 0, 246, 787, 703, 77, 238,
+  392, 374, 0, 0, 0, 0, 0, 0, 0, 0, 114, 0, 86, 116, 768, 248,
+  320, 815, 902, 485, 0, 0, 0, 0, 0, 0, 79, 474, 293, 883, 0, 0,
+  697, 321, 440, 733, 897, 0, 582, 630, 0, 958, 0, 0, 272, 0, 125, 993,
+  0, 0, 0, 0, 0, 347, 0, 0, 0, 690, 758, 0, 0, 0, 0, 364,
+  746, 137, 0, 0, 0, 545, 0, 188, 775, 894, 0, 395, 860, 0, 346, 0,
+  138, 206, 381, 0, 500, 567, 671, 0, 0, 301, 522, 0, 121, 0, 0, 66,
+  935, 0, 0, 0, 29, 270, 730, 0, 0, 0, 0, 0, 120, 82, 0, 0,
+  209, 229, 811, 405, 944, 306, 0, 0, 0, 873, 0, 0, 514, 290, 0, 0,
+  0, 292, 0, 678, 840, 366, 441, 548, 731, 142, 0, 0, 957, 0, 10, 25,
+  205, 596, 604, 228, 809, 881, 0, 0, 0, 0, 0, 0, 418, 0, 626, 743,
+  0, 0, 350, 389, 558, 0, 643, 0, 613, 776, 0, 335, 796, 212, 338, 287,
+  443, 210, 764, 912, 0, 0, 921, 0, 0, 495, 0, 715, 879, 0, 0, 0,
+  0, 0, 0, 175, 0, 0, 0, 444, 0, 657, 585, 668, 0, 598, 875, 459,
+  0, 445, 711, 0, 0, 388, 506, 799, 858, 601, 0, 844, 920, 0, 0, 0,
+  0, 3, 380, 551, 587, 0, 0, 681, 426, 0, 660, 436, 0, 0, 93, 946,
+  0, 0, 64, 553, 0, 0, 0, 0, 0, 527, 141, 30, 465, 0, 0, 0,
+  0, 0, 0, 74, 0, 0, 833, 491, 0, 0, 583, 0, 297, 431, 519, 0,
+  0, 694, 0, 165, 0, 391, 0, 0, 0, 196, 414, 0, 0, 0, 0, 631,
+  0, 166, 198, 257, 611, 685, 225, 108, 801, 0, 0, 0, 13, 0, 330, 0,
+  0, 0, 647, 0, 410, 956, 0, 0, 0, 0, 173, 203, 594, 0, 473, 0,
+  0, 0, 304, 0, 131, 134, 0, 0, 0, 0, 171, 0, 0, 0, 0, 698,
+  102, 546, 178, 652, 393, 893, 999, 0, 302, 0, 325, 662, 701, 0, 0, 0,
+  948, 0, 0, 610, 0, 735, 0, 0, 0, 397, 606, 0, 0, 0, 0, 563,
+  332, 103, 513, 761, 105, 544, 0, 0, 0, 0, 475, 0, 0, 21, 659, 0,
+  0, 0, 629, 48, 932, 575, 0, 190, 0, 400, 0, 726, 0, 0, 0, 504,
+  0, 0, 260, 852, 0, 88, 0, 193, 523, 0, 0, 0, 0, 275, 516, 680,
+  987, 0, 0, 0, 0, 970, 0, 0, 300, 0, 0, 0, 285, 0, 0, 0,
+  767, 0, 164, 725, 0, 0, 151, 396, 0, 0, 0, 435, 0, 96, 415, 0,
+  0, 0, 0, 185, 0, 0, 113, 0, 0, 0, 16, 0, 0, 0, 150, 379,
+  464, 468, 913, 0, 0, 886, 0, 0, 736, 0, 876, 0, 0, 0, 0, 95,
+  317, 702, 0, 0, 0, 0, 8, 0, 0, 927, 820, 0, 0, 0, 0, 0,
+  0, 0, 695, 0, 0, 874, 0, 0, 0, 235, 502, 906, 908, 798, 0, 0,
+  40, 0, 0, 313, 0, 0, 0, 0, 699, 0, 155, 295, 0, 0, 0, 184,
+  0, 214, 704, 0, 0, 255, 557, 0, 0, 597, 737, 0, 0, 56, 341, 315,
+  0, 0, 0, 92, 259, 608, 750, 995, 0, 0, 0, 0, 825, 0, 0, 760,
+  0, 52, 936, 0, 0, 0, 0, 542, 572, 0, 477, 0, 439, 133, 0, 520,
+  0, 423, 540, 0, 43, 0, 0, 0, 0, 236, 855, 433, 271, 620, 38, 0,
+  0, 0, 274, 334, 0, 0, 0, 0, 0, 937, 250, 5, 110, 669, 0, 0,
+  882, 981, 0, 0, 401, 409, 605, 720, 745, 824, 0, 0, 0, 0, 550, 0,
+  0, 328, 0, 211, 419, 408, 786, 0, 0, 411, 0, 700, 0, 0, 0, 191,
+  765, 256, 34, 430, 109, 0, 0, 0, 479, 518, 145, 539, 665, 0, 0, 0,
+  0, 53, 197, 451, 0, 176, 0, 0, 122, 0, 0, 83, 566, 0, 31, 0,
+  0, 595, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 884, 996, 0, 0, 0, 0, 0, 0, 0, 929, 934, 0, 0, 637, 62,
+  186, 784, 0, 0, 0, 0, 0, 0, 578, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 994, 0, 756, 0, 376, 797, 997, 622, 0, 618, 919, 118, 517, 729,
+  989, 0, 0, 469, 880, 482, 237, 11, 888, 0, 636, 0, 0, 0, 0, 0,
+  0, 0, 0, 265, 0, 914, 0, 0, 716, 793, 0, 0, 0, 0, 0, 0,
+  0, 50, 0, 0, 658, 0, 911, 962, 0, 763, 0, 0, 0, 0, 0, 0,
+  0, 0, 617, 0, 739, 0, 230, 281, 842, 939, 0, 0, 0, 0, 385, 581,
+  866, 0, 0, 89, 0, 0, 0, 0, 0, 645, 0, 0, 345, 0, 454, 493,
+  785, 0, 0, 900, 806, 955, 0, 98, 0, 926, 593, 0, 0, 360, 192, 541,
+  0, 404, 800, 224, 239, 579, 807, 835, 0, 0, 490, 552, 322, 0, 241, 904,
+  0, 0, 0, 705, 972, 0, 0, 12, 759, 0, 0, 846, 378, 654, 0, 0,
+  832, 28, 480, 968, 971, 0, 0, 0, 0, 1000, 153, 323, 0, 0, 0, 0,
+  0, 75, 0, 0, 202, 0, 0, 941, 0, 673, 0, 0, 85, 60, 831, 233,
+  969, 975, 0, 0, 536, 850, 570, 943, 510, 44, 0, 344, 0, 0, 0, 0,
+  220, 628, 977, 822, 0, 0, 0, 0, 803, 0, 802, 61, 387, 428, 0, 0,
+  0, 158, 0, 0, 805, 0, 0, 0, 0, 276, 591, 569, 738, 0, 0, 0,
+  273, 407, 340, 0, 264, 377, 104, 307, 512, 928, 0, 101, 814, 889, 0, 961,
+  0, 0, 747, 0, 0, 65, 559, 984, 0, 0, 0, 0, 0, 0, 112, 168,
+  664, 0, 355, 422, 383, 978, 135, 675, 757, 0, 0, 0, 0, 154, 0, 0,
+  0, 0, 0, 80, 311, 0, 119, 0, 0, 692, 123, 0, 163, 386, 0, 0,
+  483, 267, 461, 623, 722, 0, 0, 0, 0, 0, 0, 0, 565, 0, 0, 0,
+  0, 412, 0, 0, 0, 0, 318, 505, 851, 0, 0, 674, 0, 0, 0, 0,
+  650, 0, 0, 0, 0, 0, 363, 752, 0, 130, 0, 0, 371, 0, 14, 349,
+  614, 635, 0, 0, 0, 0, 0, 179, 126, 0, 607, 0, 0, 0, 0, 0,
+  416, 0, 853, 7, 892, 0, 47, 280, 497, 0, 0, 651, 854, 0, 728, 0,
+  91, 484, 0, 529, 0, 0, 261, 0, 0, 0, 348, 0, 0, 0, 0, 447,
+  37, 0, 899, 965, 41, 923, 0, 0, 0, 0, 0, 0, 849, 0, 0, 0,
+  0, 0, 0, 487, 0, 691, 0, 351, 501, 717, 538, 170, 99, 339, 182, 782,
+  865, 0, 57, 365, 367, 706, 509, 33, 772, 0, 0, 0, 571, 649, 0, 149,
+  269, 471, 240, 878, 0, 0, 0, 6, 0, 0, 0, 864, 0, 751, 0, 0,
+  576, 0, 243, 0, 0, 0, 35, 0, 174, 244, 0, 561, 707, 719, 94, 282,
+  942, 0, 0, 0, 0, 0, 204, 0, 0, 727, 87, 839, 0, 20, 687, 55,
+  0, 0, 0, 0, 0, 0, 0, 144, 778, 781, 887, 898, 0, 0, 0, 326,
+  361, 856, 0, 406, 0, 69, 0, 0, 945, 0, 922, 0, 0, 951, 890, 0,
+  794, 216, 0, 0, 0, 836, 0, 139, 421, 336, 0, 0, 0, 0, 0, 533,
+  0, 0, 861, 0, 331, 489, 167, 724, 789, 863, 148, 0, 0, 0, 253, 708,
+  740, 780, 0, 309, 0, 0, 0, 0, 0, 0, 723, 0, 177, 0, 458, 537,
+  0, 0, 258, 0, 342, 0, 0, 0, 677, 0, 0, 0, 0, 0, 0, 0,
+  0, 303, 0, 867, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 159, 398, 535, 452, 964, 0, 0, 0, 262, 0, 0, 632,
+  0, 0, 0, 819, 0, 97, 470, 526, 790, 0, 207, 817, 23, 0, 0, 0,
+  642, 157, 679, 827, 310, 528, 947, 959, 0, 0, 547, 438, 0, 0, 478, 0,
+  0, 816, 0, 656, 0, 0, 183, 638, 0, 0, 0, 0, 476, 0, 0, 0,
+  0, 507, 425, 721, 870, 979, 0, 0, 1, 609, 488, 0, 525, 917, 0, 713,
+  0, 0, 399, 0, 663, 0, 0, 0, 352, 0, 0, 0, 0, 0, 0, 612,
+  0, 0, 615, 18, 0, 990, 0, 0, 0, 952, 0, 0, 0, 373, 0, 0,
+  117, 15, 0, 0, 136, 0, 0, 0, 0, 0, 0, 0, 0, 0, 84, 319,
+  998, 0, 0, 0, 0, 0, 577, 0, 0, 0, 249, 589, 291, 891, 905, 909,
+  976, 24, 223, 369, 132, 0, 779, 795, 71, 215, 189, 268, 0, 0, 27, 682,
+};
+
+const char *WA_FREQ_131_TOKENS[] = {
+  "karqan",
+  "llaqtam",
+  "Uma",
+  "llaqtanqa",
+  "llaqtapi",
+  "huk",
+  "mama",
+  "qallarisqa",
+  "wataqa",
+  "ñiqin",
+  "watapi",
+  "Hulyanu",
+  "kalindaryukama",
+  "watam",
+  "killapi",
+  "chhasku",
+  "nisqaqa",
+  "de",
+  "simipi",
+  "paqarisqa",
+  "kastilla",
+  "sutiyuq",
+  "aswan",
+  "runaqa",
+  "Griguryanu",
+  "icha",
+  "wañusqa",
+  "nisqa",
+  "runakunam",
+  "kaq",
+  "watap",
+  "wan",
+  "raymi",
+  "qhapaq",
+  "puquy",
+  "San",
+  "wakllanwatam",
+  "kay",
+  "watamanta",
+  "1",
+  "kñ",
+  "puchukarqan",
+  "qhulla",
+  "hanaq",
+  "kalindaryuyuq",
+  "llaqtayuq",
+  "suyu",
+  "quchamanta",
+  "mitrum",
+  "31",
+  "hatun",
+  "suyupi",
+  "Pikchunqa",
+  "qallarirqan",
+  "kan",
+  "qhichwa",
+  "llaqtap",
+  "p'unchaw",
+  "Kristup",
+  "rimanku",
+  "ñawpan",
+  "kawsachkanku",
+  "llaqta",
+  "runa",
+  "p'unchawninmi",
+  "tiyanku",
+  "mana",
+  "pulitiku",
+  "suyum",
+  "p'unchawqa",
+  "kalindaryupi",
+  "lliwmanta",
+  "puchukayninkama",
+  "wakllanwatapi",
+  "kanayuq",
+  "atipachawwan",
+  "intichawwan",
+  "ch'askachawwan",
+  "quyllurchawwan",
+  "illapachawwan",
+  "k'uychichawwan",
+  "killachawwan",
+  "kalindaryukamataq",
+  "llaqtapiqa",
+  "runakuna",
+  "astawan",
+  "watakama",
+  "ichataq",
+  "uma",
+  "ñawpaq",
+  "2001",
+  "Kay",
+  "Piruw",
+  "Lima",
+  "Chay",
+  "Hukllachasqa",
+  "chay",
+  "kuti",
+  "chunka",
+  "del",
+  "manaraq",
+  "simikunatam",
+  "Romanu",
+  "aymara",
+  "simi",
+  "iskay",
+  "nisqataq",
+  "watakuna",
+  "watakunaqa",
+  "chunkantin",
+  "pacha",
+  "chunkawata",
+  "y",
+  "kachkan",
+  "Kichwa",
+  "llaqtanmi",
+  "Huk",
+  "llaqtaqa",
+  "Yachay",
+  "la",
+  "La",
+  "José",
+  "pruwinsya",
+  "Amirika",
+  "Santa",
+  "kitilli",
+  "Qhapaq",
+  "runam",
+  "munisipyupiqa",
+  "achka",
+  "Ikwadur",
+  "Nobel",
+  "Qhichwa",
+  "ancha",
+  "Italya",
+  "hina",
+  "2",
+  "Hatun",
+  "ima",
+  "2006",
+  "El",
+  "Provincia",
+  "pruwinsyam",
+  "Tayta",
+  "yachay",
+  "2007",
+  "aswanta",
+  "piluta",
+  "allin",
+  "watapis",
+  "wata",
+  "manam",
+  "2005",
+  "tukuy",
+  "m",
+  "Aires",
+  "Buenos",
+  "Departamento",
+  "of",
+  "chakra",
+  "runakunap",
+  "latin",
+  "Umalliqnin",
+  "kantaray",
+  "p'unchawpi",
+  "p.",
+  "Juan",
+  "Qusqu",
+  "kitillipiqa",
+  "kitillipi",
+  "simitam",
+  "inti",
+  "kamasqa",
+  "kiti",
+  "chaymanta",
+  "Buliwya",
+  "pusaq",
+  "chaskirqan",
+  "pruwinsyapiqa",
+  "killa",
+  "kawsanku",
+  "piruwanu",
+  "Mama",
+  "Ispaña",
+  "nispa",
+  "Iskay",
+  "Arhintina",
+  "Piruwpi",
+  "kaspa",
+  "Francisco",
+  "Kastilla",
+  "kawsay",
+  "warmiqa",
+  "anta",
+  "kimsa",
+  "3",
+  "situwa",
+  "tarpuy",
+  "markapi",
+  "Umalliq",
+  "Kamasqa",
+  "Madrid",
+  "qarqan",
+  "2008",
+  "4",
+  "Mishiku",
+  "Ransiya",
+  "Unriya",
+  "mamallaqtapi",
+  "aymuray",
+  "hinam",
+  "5",
+  "musuq",
+  "Roma",
+  "kitim",
+  "km",
+  "runap",
+  "Nacional",
+  "kitillinmi",
+  "nisqam",
+  "Suñay",
+  "hayt'aqmi",
+  "2010",
+  "Universidad",
+  "María",
+  "Piruwpa",
+  "tawa",
+  "Awya",
+  "Perú",
+  "en",
+  "llaqtamanta",
+  "yapuy",
+  "nisqapi",
+  "sutipaq",
+  "warmi",
+  "Antonio",
+  "kitipiqa",
+  "ñawpa",
+  "Musuq",
+  "PP",
+  "ayriway",
+  "kamayuq",
+  "kanqa",
+  "tiyachkan",
+  "indihina",
+  "mayu",
+  "wasi",
+  "Kunan",
+  "awqaq",
+  "taripay",
+  "10",
+  "ayllu",
+  "Huwan",
+  "Pedro",
+  "Santiago",
+  "runakunaqa",
+  "2004",
+  "Papa",
+  "kawsaq",
+  "pachapi",
+  "qallarispa",
+  "2002",
+  "Editorial",
+  "Paris",
+  "amachaq",
+  "sutichasqa",
+  "Alma",
+  "Miguel",
+  "karqa",
+  "karum",
+  "2009",
+  "28",
+  "8",
+  "II",
+  "sutiyuqqa",
+  "walltay",
+  "Inka",
+  "Mana",
+  "Puerto",
+  "Tukuy",
+  "kamayuqnin",
+  "ninchikmi",
+  "suyup",
+  "yaku",
+  "Estado",
+  "15",
+  "6",
+  "mater",
+  "waray",
+  "7",
+  "Luis",
+  "Pulunya",
+  "Suyukunap",
+  "qillqaq",
+  "watapiqa",
+  "9",
+  "pachakwata",
+  "12",
+  "Suyukunapi",
+  "chanta",
+  "pawqar",
+  "tukurqan",
+  "Chunka",
+  "pi",
+  "tiyan",
+  "Alimanya",
+  "Papam",
+  "grigu",
+  "los",
+  "30",
+  "kanku",
+  "kathuliku",
+  "ninchik",
+  "pruwinsyap",
+  "simimanta",
+  "the",
+  "20",
+  "25",
+  "ISBN",
+  "pinchikilla",
+  "qa",
+  "runakunata",
+  "suqta",
+  "wakin",
+  "I",
+  "Kañari",
+  "inlish",
+  "simita",
+  "2003",
+  "Inlatirra",
+  "distritupiqa",
+  "hayt'ay",
+  "lliw",
+  "watakamam",
+  "16",
+  "18",
+  "Munisipyupiqa",
+  "Uruwayi",
+  "ayamarq'a",
+  "kantunmi",
+  "klubmi",
+  "umalliqnin",
+  "Chayrayku",
+  "Chunwa",
+  "Paykunaqa",
+  "kaptin",
+  "suyupiqa",
+  "suñaytas",
+  "umalliqninmi",
+  "17",
+  "19",
+  "22",
+  "Iwrupapi",
+  "Yalapi",
+  "Ñawpa",
+  "13",
+  "14",
+  "III",
+  "suyunmi",
+  "11",
+  "21",
+  "29",
+  "k'iti",
+  "23",
+  "distritu",
+  "kunan",
+  "riqsisqa",
+  "tukukun",
+  "yura",
+  "24",
+  "Dyuspa",
+  "Kimsa",
+  "Mishikupi",
+  "New",
+  "Suyupi",
+  "ahinataq",
+  "allpa",
+  "kanman",
+  "kantun",
+  "pusaqninqa",
+  "rurasqa",
+  "26",
+  "el",
+  "ichaqa",
+  "llimphisqan",
+  "qillqaqmi",
+  "waraniyi",
+  "yaqa",
+  "1980",
+  "Kuyu",
+  "chakrapura",
+  "chinu",
+  "purin",
+  "1990",
+  "Brasil",
+  "Inkakunap",
+  "Los",
+  "P'unchaw",
+  "Uralan",
+  "kichwa",
+  "nisqawan",
+  "wayra",
+  "2011",
+  "27",
+  "Carlos",
+  "Kunanqa",
+  "Manuel",
+  "Parawayi",
+  "Urin",
+  "hunuchá",
+  "kaqmanta",
+  "riqyunmi",
+  "sinchi",
+  "suntur",
+  "1993",
+  "Phransya",
+  "Tawantinsuyu",
+  "kawsan",
+  "nisqapas",
+  "pichqa",
+  "1997",
+  "Brasilpi",
+  "Cantón",
+  "Sunturnin",
+  "Villa",
+  "and",
+  "pachak",
+  "rimaqninmi",
+  "1981",
+  "2000",
+  "20px",
+  "Kashamarka",
+  "Nihun",
+  "Pruwinsyapiqa",
+  "aliman",
+  "ama",
+  "chaypi",
+  "rimarirqan",
+  "umalliq",
+  "Amarumayu",
+  "Buliwyapi",
+  "Inti",
+  "Región",
+  "Republika",
+  "2012",
+  "Griguryu",
+  "Suyu",
+  "Suyukuna",
+  "karu",
+  "qanchis",
+  "wiñay",
+  "yachaq",
+  "Suntur",
+  "aranway",
+  "ch’uju",
+  "huklla",
+  "iqin",
+  "kaynin",
+  "wamani",
+  "1992",
+  "Ariqipa",
+  "kasqa",
+  "rikch'aq",
+  "runakunapas",
+  "urqu",
+  "Ñawpaq",
+  "1991",
+  "Aswan",
+  "Chinchay",
+  "Fernando",
+  "a",
+  "distritum",
+  "in",
+  "qallarirqan.",
+  "qillqarqan",
+  "rimay",
+  "1969",
+  "Allpa",
+  "Binidiktu",
+  "Chawpi",
+  "Churinkuna",
+  "Río",
+  "Uru",
+  "kikinpa",
+  "kuyu",
+  "manañam",
+  "mayum",
+  "sapa",
+  "wañurqan",
+  "1984",
+  "Alimanyapi",
+  "Aymara",
+  "Domingo",
+  "Ediciones",
+  "Watimala",
+  "nisqap",
+  "niyta",
+  "qillqasqa",
+  "qucha",
+  "1999",
+  "Awqaq",
+  "Liyun",
+  "México",
+  "Quchapampa",
+  "Tawa",
+  "University",
+  "ispañul",
+  "isqun",
+  "llimphiq",
+  "nisqakunaqa",
+  "pisi",
+  "wiñan",
+  "yawar",
+  "1945",
+  "1970",
+  "1986",
+  "Chilipi",
+  "John",
+  "distritunmi",
+  "llapan",
+  "1960",
+  "1989",
+  "Barcelona",
+  "De",
+  "IV",
+  "Tupaq",
+  "Urasuyu",
+  "kawsachkan",
+  "mayuman",
+  "munisipyu",
+  "rimaqniyuq",
+  "rumi",
+  "sach'a-sach'a",
+  "urquqa",
+  "watakunapi",
+  "000",
+  "1974",
+  "1998",
+  "Achka",
+  "Anqash",
+  "Chaymanta",
+  "Las",
+  "Lliwmanta",
+  "Pawlu",
+  "Rosa",
+  "XII",
+  "York",
+  "anafilaxia",
+  "hatunmi",
+  "hunu",
+  "kaqpi",
+  "kaqwan",
+  "mamallaqta",
+  "mikhunchik",
+  "rimaq",
+  "sallqa",
+  "urin",
+  "yaya",
+  "1967",
+  "1968",
+  "1976",
+  "Asyapi",
+  "Beni",
+  "General",
+  "Italyapi",
+  "Libre",
+  "Piruwanu",
+  "Simi",
+  "awustupi",
+  "disimripi",
+  "hawa",
+  "kaptinmi",
+  "nisqata",
+  "saywitu",
+  "utaq",
+  "ñiqpi",
+  "1996",
+  "Abya",
+  "California",
+  "Krus",
+  "London",
+  "Pampa",
+  "V",
+  "arabya",
+  "hulyupi",
+  "inirupi",
+  "iskayniyuq",
+  "kurku",
+  "las",
+  "marsupi",
+  "mayukillapi",
+  "nisqatam",
+  "purtuyis",
+  "sitimripi",
+  "uktuwripi",
+  "unquy",
+  "willay",
+  "1963",
+  "1975",
+  "1987",
+  "Club",
+  "Ispañapi",
+  "Jorge",
+  "Kathuliku",
+  "Kitu",
+  "Pablo",
+  "Paul",
+  "Runallaqta",
+  "Santo",
+  "Suñaytam",
+  "Wawakuna",
+  "anchata",
+  "awrilpi",
+  "cm",
+  "hanaqmi",
+  "hunyupi",
+  "kamarirqan",
+  "kapchiypi",
+  "kaqta",
+  "kikin",
+  "nuwimripi",
+  "pachaqa",
+  "patanpi",
+  "pruwinsyapi",
+  "qarqurqan",
+  "sumaq",
+  "wallqanqa",
+  "1939",
+  "1953",
+  "1988",
+  "1994",
+  "Estudios",
+  "García",
+  "Runap",
+  "inka",
+  "manas",
+  "puka",
+  "ruranku",
+  "takichaqmi",
+  "100",
+  "1949",
+  "1958",
+  "1982",
+  "Colegio",
+  "Giovanni",
+  "Kristiyanu",
+  "Puka",
+  "Quechua",
+  "Quito",
+  "Runa",
+  "Simin",
+  "Soberano",
+  "Wien",
+  "Winisuylapi",
+  "Yachaywasi",
+  "atin",
+  "awqaqkuna",
+  "crup",
+  "iñuku",
+  "kamarisqa",
+  "kapuq",
+  "kitillipipas",
+  "kristiyanu",
+  "llaqtakuna",
+  "manchay",
+  "mawk'a",
+  "munan",
+  "phiwrirupi",
+  "pinyin",
+  "ukhu",
+  "urqukunamanta",
+  "wankurisqa",
+  "wasipi",
+  "watapim",
+  "yachaqsi",
+  "1979",
+  "1983",
+  "Alberto",
+  "Berlin",
+  "Bolívar",
+  "Hampi",
+  "Hawa",
+  "Marcos",
+  "Mendoza",
+  "Pichqa",
+  "Punu",
+  "Santu",
+  "The",
+  "do",
+  "kanmi",
+  "kaqpas",
+  "kaqqa",
+  "llimphiqpas",
+  "marka",
+  "munisipyupi",
+  "para",
+  "ruranchik",
+  "simiman",
+  "suni",
+  "von",
+  "warmim",
+  "1966",
+  "1973",
+  "A",
+  "Ayakuchu",
+  "Chanka",
+  "Chuqiyapu",
+  "Editores",
+  "IX",
+  "Kuba",
+  "München",
+  "Puruha",
+  "Rafael",
+  "VIII",
+  "XI",
+  "allinta",
+  "iskaynintin",
+  "laya",
+  "pachakwatapi",
+  "qillqaqsi",
+  "qillqasqan",
+  "raphi",
+  "runayuq",
+  "tukuspa",
+  "1959",
+  "1961",
+  "1962",
+  "1965",
+  "Chaqllisinchipi",
+  "Chili",
+  "Ikwadurpi",
+  "Panama",
+  "Paz",
+  "Prado",
+  "Pérez",
+  "Ricardo",
+  "Salwadur",
+  "Sánchez",
+  "VII",
+  "kaptinqa",
+  "llaqtakunapi",
+  "llaqtaman",
+  "markap",
+  "musika",
+  "nisqamanta",
+  "nisqamantaqa",
+  "pachamanta",
+  "pruwinsyaqa",
+  "qhapaqninsi",
+  "qillqa",
+  "rurasqan",
+  "tiyaq",
+  "1946",
+  "1978",
+  "Edición",
+  "Historia",
+  "Ima",
+  "Ioannes",
+  "Kaymi",
+  "Montevideo",
+  "París",
+  "Qanchis",
+  "Rusiya",
+  "Sapa",
+  "Suqta",
+  "UNESCO",
+  "Velasco",
+  "Vicente",
+  "Victoria",
+  "Wak'as",
+  "hinatam",
+  "kachkaptin",
+  "kamayuqninmi",
+  "kanchu",
+  "llaqtapas",
+  "pichqantin",
+  "quchapi",
+  "rimaykuna",
+  "runas",
+  "ruranapaq",
+  "1935",
+  "1957",
+  "1964",
+  "1985",
+  "300",
+  "Alfredo",
+  "Ancha",
+  "Daniel",
+  "Javier",
+  "Jesús",
+  "Kulumbya",
+  "Losada",
+  "Machu",
+  "Nikarawa",
+  "Orellana",
+  "Runakuna",
+  "Sebastián",
+  "Ulimpiku",
+  "VI",
+  "Yala",
+  "akllasqa",
+  "atirqan",
+  "chiqniq",
+  "kapchiy",
+  "kaptinpas",
+  "patapi",
+  "quchap",
+  "rurarqan",
+  "siq'i",
+  "sobre",
+  "wamanim",
+  "1922",
+  "1942",
+  "1950",
+  "1952",
+  "1971",
+  "200",
+  "40",
+  "Chile",
+  "Distritupiqa",
+  "Ignacio",
+  "Maria",
+  "Peruana",
+  "Salvador",
+  "Sociedad",
+  "Titiqaqa",
+  "Urqu",
+  "X",
+  "anti",
+  "manaña",
+  "markam",
+  "messages",
+  "pa",
+  "quechua",
+  "rimaypi",
+  "runasimitam",
+  "ruraq",
+  "simim",
+  "tawayuq",
+  "waranqa",
+  "1936",
+  "1941",
+  "1954",
+  "1977",
+  "70",
+  "América",
+  "Educación",
+  "Hepburn",
+  "Isabel",
+  "Llaqtap",
+  "Lliw",
+  "López",
+  "Mayor",
+  "Pansaliyu",
+  "Ramón",
+  "Rio",
+  "Robert",
+  "UTC",
+  "Yaku",
+  "achkha",
+  "ankallis",
+  "distrito",
+  "hamuq",
+  "nawa",
+  "nihun",
+  "p'unchawmanta",
+  "pachapiqa",
+  "paqarin",
+  "pichqayuq",
+  "pruwinsyanmi",
+  "pulitikupas",
+  "qhipaq",
+  "rikunchik",
+  "rock",
+  "syn",
+  "tiksi",
+  "wiñaq",
+  "yachachiq",
+  "yakupi",
+  "ñiqi",
+  "1920",
+  "1930",
+  "Ana",
+  "Andrés",
+  "Apurimaq",
+  "Biblioteca",
+  "Canton",
+  "Cervantes",
+  "Chimpurasu",
+  "Cultura",
+  "FC",
+  "George",
+  "Hanan",
+  "Ika",
+  "Iskusya",
+  "Ispañamanta",
+  "Madridpi",
+  "Martín",
+  "P'utuqsi",
+  "Pando",
+  "Ransiyapi",
+  "Ríos",
+  "Yupanki",
+  "distritup",
+  "hayu",
+  "intip",
+  "jisk'a",
+  "kichwapi",
+  "kusituymi",
+  "llaqtamantaqa",
+  "llaqtapim",
+  "ministru",
+  "nin",
+  "ninku",
+  "pachantin",
+  "pusaqniyuq",
+  "qhipa",
+  "qillqasqanqa",
+  "runakunas",
+  "ruran",
+  "ruru",
+  "simip",
+  "tawantin",
+  "wapsi",
+  "warmip",
+  "wañuchirqan",
+  "130",
+  "150",
+  "1934",
+  "1938",
+  "1940",
+  "1947",
+  "1948",
+  "50",
+  "80",
+  "Augusto",
+  "Caracas",
+  "Chaypi",
+  "Chincha",
+  "Eccles",
+  "Felipe",
+  "Llimanta",
+  "Manqu",
+  "Markus",
+  "Pacha",
+  "Sarakuru",
+  "Yachaytaqpi",
+  "Zamora",
+  "al",
+  "atiparqan",
+  "comunidad",
+  "da",
+  "hawanpi",
+  "hukniyuq",
+  "kamachiy",
+  "kawpaqpas",
+  "kawsaykuq",
+  "kawsaypi",
+  "kimsayuq",
+  "kuska",
+  "llaqtata",
+  "mayup",
+  "munisipyunmi",
+  "pachataq",
+  "paqarichisqan",
+  "paqarirqan",
+  "pay",
+  "pusaqmi",
+  "qhari",
+  "rikch'anmi",
+  "rikunki",
+  "sichus",
+  "simipitaq",
+  "takiq",
+  "tarikun",
+  "tukri",
+  "unqusqa",
+  "yupayninqa",
+  "yuraq",
+  "120",
+  "1928",
+  "1931",
+  "1995",
+  "American",
+  "Azul",
+  "Belaúnde",
+  "Chuqichaka",
+  "Cristóbal",
+  "Cruz",
+  "González",
+  "Hunin",
+  "Huñusqa",
+  "Jesus",
+  "Ministru",
+  "Napurunakunam",
+  "Nicolás",
+  "Pizarro",
+  "Rodríguez",
+  "Salinas",
+  "Santos",
+};
+const uint16_t WA_FREQ_131_RANKS[] = {
+  678, 681, 0, 0, 0, 0, 354, 0, 189, 0, 390, 0, 763, 797, 0, 0,
+  0, 0, 343, 372, 0, 668, 0, 803, 0, 363, 0, 438, 0, 0, 640, 0,
+  389, 312, 922, 0, 0, 270, 190, 564, 719, 686, 941, 0, 330, 0, 0, 571,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 240, 857, 0, 718, 0, 0, 358,
+  0, 0, 0, 766, 0, 0, 791, 927, 0, 492, 249, 767, 889, 387, 946, 737,
+  852, 0, 0, 831, 0, 911, 855, 926, 867, 203, 172, 776, 0, 290, 0, 161,
+  383, 0, 0, 0, 0, 0, 695, 437, 0, 25, 604, 0, 0, 0, 0, 0,
+  0, 0, 0, 901, 0, 0, 0, 506, 0, 0, 0, 0, 23, 221, 391, 918,
+  0, 997, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 463, 67, 0, 0,
+  0, 0, 0, 0, 0, 0, 582, 0, 0, 0, 0, 0, 660, 0, 0, 0,
+  459, 0, 0, 0, 503, 73, 697, 733, 762, 925, 9, 157, 253, 456, 206, 342,
+  374, 523, 908, 439, 966, 755, 0, 16, 525, 329, 105, 185, 881, 0, 0, 117,
+  223, 591, 33, 677, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 379, 671, 957, 0, 149, 0, 0, 885, 0, 48, 0, 0,
+  0, 0, 445, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  132, 0, 0, 334, 0, 0, 0, 0, 0, 931, 623, 0, 177, 0, 529, 532,
+  526, 173, 0, 410, 0, 0, 0, 750, 0, 0, 0, 0, 683, 0, 0, 0,
+  0, 295, 501, 789, 0, 304, 0, 837, 0, 0, 0, 0, 0, 152, 0, 300,
+  0, 0, 0, 843, 0, 734, 0, 0, 0, 428, 0, 0, 679, 975, 548, 259,
+  693, 96, 0, 0, 0, 0, 0, 0, 297, 71, 254, 0, 0, 0, 848, 0,
+  715, 859, 861, 0, 350, 790, 0, 0, 0, 0, 0, 238, 311, 324, 542, 19,
+  663, 118, 561, 0, 0, 798, 868, 576, 631, 813, 540, 0, 0, 359, 0, 0,
+  0, 0, 45, 255, 0, 757, 440, 420, 828, 0, 0, 0, 0, 792, 650, 865,
+  680, 0, 562, 201, 832, 989, 0, 0, 703, 413, 37, 998, 0, 452, 460, 870,
+  0, 0, 793, 0, 0, 824, 0, 108, 0, 43, 535, 0, 0, 0, 0, 99,
+  0, 0, 193, 851, 92, 696, 627, 427, 20, 256, 817, 934, 943, 712, 557, 651,
+  581, 0, 0, 0, 0, 0, 896, 0, 0, 644, 0, 705, 0, 0, 188, 194,
+  0, 0, 88, 360, 251, 204, 471, 545, 268, 595, 765, 0, 0, 815, 0, 0,
+  0, 0, 0, 863, 0, 0, 0, 425, 489, 0, 0, 0, 146, 486, 822, 0,
+  0, 0, 565, 602, 0, 898, 323, 0, 0, 0, 0, 0, 559, 0, 483, 0,
+  727, 579, 795, 225, 0, 0, 0, 0, 0, 39, 131, 151, 291, 596, 166, 939,
+  0, 955, 0, 0, 63, 0, 833, 0, 130, 316, 397, 0, 24, 143, 774, 285,
+  0, 366, 0, 636, 314, 436, 810, 809, 38, 648, 41, 0, 0, 819, 441, 725,
+  0, 778, 0, 0, 0, 154, 0, 0, 0, 0, 533, 160, 97, 234, 144, 467,
+  534, 325, 836, 550, 0, 972, 0, 0, 0, 0, 0, 0, 0, 0, 574, 847,
+  964, 78, 979, 507, 635, 147, 121, 308, 327, 875, 936, 0, 920, 0, 0, 107,
+  0, 586, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 653,
+  584, 453, 615, 721, 0, 0, 0, 0, 110, 0, 0, 958, 207, 720, 0, 0,
+  0, 0, 0, 777, 0, 761, 0, 895, 373, 759, 0, 0, 619, 0, 0, 0,
+  0, 0, 849, 184, 241, 0, 0, 0, 0, 0, 0, 469, 0, 0, 0, 0,
+  0, 84, 839, 0, 303, 0, 0, 0, 0, 983, 0, 978, 552, 709, 747, 0,
+  0, 479, 646, 0, 93, 197, 710, 0, 98, 0, 874, 0, 0, 0, 0, 0,
+  0, 0, 0, 684, 242, 447, 59, 549, 0, 0, 0, 0, 583, 0, 0, 769,
+  0, 482, 0, 0, 364, 612, 0, 0, 62, 991, 0, 0, 0, 164, 344, 27,
+  388, 422, 551, 904, 0, 0, 0, 0, 764, 0, 0, 0, 0, 0, 894, 0,
+  547, 0, 657, 233, 0, 0, 339, 0, 536, 367, 0, 252, 455, 666, 0, 0,
+  518, 0, 162, 498, 784, 728, 260, 0, 0, 0, 450, 0, 399, 0, 0, 0,
+  625, 841, 739, 0, 246, 771, 11, 226, 0, 0, 0, 0, 0, 0, 475, 749,
+  812, 0, 1, 544, 993, 384, 3, 307, 424, 930, 14, 994, 0, 0, 276, 794,
+  891, 0, 0, 0, 0, 0, 0, 0, 338, 770, 947, 0, 0, 0, 0, 0,
+  0, 474, 0, 0, 46, 555, 0, 168, 907, 0, 0, 0, 0, 465, 174, 408,
+  0, 572, 924, 0, 0, 673, 0, 345, 0, 318, 888, 310, 862, 0, 0, 0,
+  0, 0, 0, 0, 505, 0, 102, 661, 0, 504, 541, 0, 317, 589, 42, 66,
+  921, 95, 381, 0, 0, 0, 0, 275, 0, 0, 0, 205, 309, 953, 0, 508,
+  691, 0, 0, 0, 0, 289, 0, 0, 656, 0, 0, 0, 0, 232, 0, 637,
+  742, 0, 0, 0, 0, 0, 0, 0, 0, 449, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 499, 0, 0, 87, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 735, 0, 0, 195, 811, 876, 0, 0, 0, 0, 0, 0, 187,
+  788, 0, 0, 265, 716, 751, 945, 0, 0, 0, 470, 0, 55, 0, 917, 840,
+  0, 406, 209, 4, 796, 0, 965, 0, 838, 0, 0, 333, 419, 682, 0, 0,
+  0, 380, 2, 86, 13, 430, 977, 0, 0, 353, 772, 0, 986, 90, 0, 826,
+  53, 0, 0, 0, 906, 0, 298, 243, 466, 520, 569, 0, 122, 186, 0, 371,
+  0, 58, 0, 0, 35, 0, 0, 0, 0, 0, 0, 0, 288, 196, 313, 0,
+  700, 0, 0, 0, 599, 880, 968, 500, 0, 0, 279, 0, 872, 0, 485, 0,
+  0, 0, 0, 786, 0, 0, 0, 0, 0, 0, 0, 639, 496, 752, 0, 49,
+  283, 647, 741, 753, 457, 468, 0, 0, 670, 0, 0, 64, 0, 36, 0, 0,
+  0, 302, 603, 0, 0, 0, 0, 139, 0, 0, 556, 0, 341, 477, 988, 0,
+  512, 708, 267, 902, 0, 0, 0, 674, 75, 676, 928, 123, 365, 176, 0, 0,
+  0, 0, 0, 461, 0, 0, 0, 0, 0, 0, 0, 0, 0, 286, 156, 433,
+  516, 858, 0, 652, 0, 0, 111, 69, 134, 10, 0, 0, 655, 787, 0, 0,
+  0, 0, 830, 0, 44, 0, 641, 0, 159, 0, 0, 0, 0, 890, 701, 0,
+  0, 442, 517, 593, 0, 0, 0, 919, 935, 0, 0, 145, 0, 0, 0, 0,
+  0, 278, 578, 0, 0, 0, 610, 897, 959, 328, 0, 0, 464, 0, 0, 169,
+  228, 402, 362, 170, 537, 714, 882, 0, 336, 0, 0, 18, 29, 116, 76, 632,
+  411, 0, 0, 0, 103, 502, 511, 783, 808, 0, 694, 17, 101, 801, 0, 0,
+  0, 0, 135, 0, 887, 0, 0, 104, 745, 113, 239, 287, 227, 395, 608, 665,
+  0, 30, 621, 0, 0, 0, 202, 0, 0, 0, 0, 806, 0, 624, 0, 0,
+  0, 900, 732, 0, 844, 218, 224, 0, 0, 981, 620, 0, 0, 883, 0, 854,
+  0, 0, 444, 0, 0, 0, 22, 570, 0, 247, 0, 702, 658, 0, 0, 0,
+  0, 28, 0, 393, 446, 0, 0, 0, 0, 0, 860, 369, 0, 0, 962, 0,
+  0, 756, 818, 0, 0, 0, 0, 628, 0, 106, 0, 171, 215, 699, 0, 0,
+  675, 0, 0, 0, 282, 0, 412, 493, 54, 638, 609, 490, 723, 805, 933, 835,
+  217, 915, 950, 996, 605, 873, 0, 89, 932, 0, 0, 929, 0, 563, 128, 296,
+  799, 519, 0, 400, 415, 370, 12, 0, 0, 0, 594, 515, 575, 423, 480, 598,
+  0, 0, 0, 0, 158, 590, 879, 0, 277, 167, 0, 976, 0, 0, 0, 0,
+  0, 81, 0, 781, 163, 842, 0, 779, 0, 129, 0, 0, 0, 0, 531, 137,
+  0, 451, 597, 26, 740, 0, 0, 687, 893, 0, 0, 0, 0, 567, 481, 573,
+  0, 0, 995, 0, 0, 746, 85, 258, 377, 192, 513, 914, 0, 0, 690, 0,
+  0, 0, 0, 0, 0, 949, 0, 0, 0, 0, 0, 0, 0, 0, 618, 40,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 199, 0, 32, 0, 165, 0, 0,
+  385, 853, 0, 155, 892, 802, 785, 346, 495, 538, 0, 0, 57, 0, 0, 0,
+  905, 886, 0, 273, 83, 622, 0, 0, 0, 0, 0, 305, 967, 0, 0, 0,
+  0, 484, 0, 0, 0, 0, 340, 0, 50, 0, 0, 558, 65, 0, 0, 148,
+  409, 0, 738, 0, 845, 850, 0, 0, 0, 528, 0, 281, 0, 198, 748, 0,
+  0, 487, 210, 212, 645, 722, 744, 937, 0, 685, 0, 0, 220, 0, 5, 0,
+  0, 386, 0, 0, 956, 0, 553, 509, 664, 954, 707, 903, 960, 1000, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 335, 0, 0, 431, 0, 0, 923, 109, 0,
+  0, 0, 0, 0, 0, 315, 0, 0, 0, 829, 82, 0, 414, 667, 0, 0,
+  0, 0, 0, 70, 825, 807, 866, 301, 974, 0, 0, 0, 0, 0, 0, 394,
+  401, 141, 417, 616, 0, 0, 0, 421, 0, 0, 0, 21, 8, 245, 321, 630,
+  150, 692, 0, 990, 0, 0, 0, 125, 592, 758, 0, 0, 999, 724, 0, 0,
+  0, 263, 264, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 352,
+  405, 736, 626, 0, 0, 0, 326, 969, 0, 274, 476, 0, 913, 292, 0, 543,
+  0, 0, 0, 357, 91, 229, 34, 112, 782, 730, 821, 963, 0, 0, 0, 0,
+  0, 429, 0, 299, 731, 713, 970, 0, 0, 0, 951, 800, 530, 0, 0, 418,
+  236, 114, 494, 0, 348, 704, 973, 0, 0, 216, 262, 261, 568, 6, 717, 443,
+  649, 47, 827, 971, 0, 74, 0, 0, 948, 0, 0, 877, 248, 613, 0, 462,
+  0, 80, 488, 0, 0, 0, 524, 688, 0, 0, 566, 912, 985, 454, 617, 662,
+  179, 403, 820, 0, 349, 214, 376, 0, 133, 0, 332, 136, 961, 0, 0, 0,
+  0, 0, 213, 0, 0, 672, 0, 119, 0, 0, 0, 208, 0, 237, 235, 0,
+  0, 992, 580, 0, 0, 0, 269, 816, 614, 698, 909, 0, 0, 0, 0, 331,
+  0, 230, 634, 0, 491, 222, 0, 0, 546, 0, 944, 0, 0, 0, 181, 0,
+  0, 0, 0, 126, 244, 982, 0, 0, 426, 0, 458, 0, 910, 554, 56, 0,
+  0, 633, 823, 219, 768, 510, 0, 178, 375, 407, 416, 869, 497, 0, 743, 0,
+  0, 987, 378, 0, 100, 773, 0, 0, 0, 0, 629, 0, 271, 726, 0, 669,
+  351, 404, 0, 0, 984, 0, 0, 0, 382, 0, 191, 347, 0, 0, 94, 514,
+  0, 587, 0, 284, 539, 606, 938, 0, 560, 60, 607, 871, 7, 0, 0, 398,
+  0, 0, 0, 577, 522, 280, 804, 706, 0, 0, 306, 266, 0, 0, 293, 0,
+  435, 361, 472, 77, 0, 0, 0, 0, 916, 0, 527, 711, 0, 0, 0, 585,
+  434, 643, 0, 182, 200, 611, 396, 521, 0, 142, 120, 180, 952, 0, 0, 0,
+  0, 250, 0, 0, 0, 600, 601, 0, 0, 257, 940, 0, 0, 153, 448, 0,
+  0, 0, 0, 0, 0, 140, 775, 0, 0, 0, 0, 356, 0, 0, 175, 659,
+  0, 0, 0, 0, 0, 0, 0, 0, 654, 588, 473, 0, 0, 0, 432, 754,
+  760, 0, 0, 0, 0, 942, 0, 52, 138, 878, 0, 368, 729, 0, 864, 68,
+  337, 392, 294, 0, 0, 115, 319, 642, 0, 0, 183, 0, 0, 0, 0, 780,
+  846, 689, 0, 322, 834, 0, 0, 0, 0, 856, 0, 0, 211, 0, 0, 0,
+  0, 272, 51, 127, 814, 980, 0, 0, 0, 79, 0, 0, 0, 0, 0, 478,
+  31, 320, 884, 899, 0, 0, 231, 355, 0, 0, 61, 72, 0, 0, 124, 0,
+};
+
+const char *WA_FREQ_132_TOKENS[] = {
+  "utz",
+  "a",
+  "uwach",
+  "ri",
+  "anan",
+  "atat",
+  "jawje",
+  "saqarik",
+  "jasche",
+  "la",
+  "awach",
+  "maltyox",
+  "k",
+  "ax",
+  "nujolom",
+};
+const uint16_t WA_FREQ_132_RANKS[] = {
+  6, 7, 8, 11, 14, 0, 0, 0, 0, 0, 9, 0, 0, 4, 0, 0,
+  3, 0, 0, 2, 0, 0, 12, 1, 0, 5, 10, 15, 0, 0, 0, 13,
+};
+
+const char *WA_FREQ_133_TOKENS[] = {
+  "𐴀",
+  "𐴀𐴝𐴌",
+  "𐴀𐴠𐴑",
+  "𐴟",
+  "𐴠",
+  "i",
+  "r",
+  "ii",
+  "tapa",
+  "aa",
+  "no",
+  "𐴡𐴘",
+  "𐴝",
+  "america",
+  "seth",
+  "enosh",
+  "hite",
+  "khuda",
+  "sa",
+  "aar",
+  "israel",
+  "ore",
+  "zaito",
+  "hitare",
+  "𐴀𐴞𐴕𐴐",
+  "𐴝𐴕",
+  "𐴁𐴠𐴒",
+  "𐴟𐴕",
+  "𐴀𐴝𐴎𐴝𐴊𐴢",
+  "𐴉",
+  "𐴟𐴖𐴝𐴙𐴕𐴝",
+  "𐴇",
+  "𐴡𐴑",
+  "𐴀𐴞𐴎",
+  "𐴡𐴃𐴢",
+  "𐴓𐴡𐴌",
+  "𐴉𐴡𐴘𐴊𐴝",
+  "𐴞𐴃𐴝𐴘𐴝𐴃",
+  "𐴀𐴝𐴈𐴡𐴓",
+  "𐴁𐴟𐴎",
+  "𐴠𐴃𐴡𐴓",
+  "𐴞𐴃𐴝𐴌𐴝𐴃",
+  "𐴀𐴡𐴕",
+  "𐴎𐴡𐴕",
+  "𐴓𐴡𐴘",
+  "𐴁",
+  "𐴝𐴘",
+  "𐴡",
+  "𐴋",
+  "𐴡𐴙𐴓",
+  "𐴔",
+  "𐴝𐴔𐴠𐴓𐴝",
+  "𐴒𐴡𐴌",
+  "𐴡𐴕",
+  "𐴏𐴝𐴀𐴝",
+  "tu",
+  "ki",
+  "goribolla",
+  "sor",
+  "anglo",
+  "saxon",
+  "iyatoba",
+  "german",
+  "bongshor",
+  "manushore",
+  "eksho",
+  "bhag",
+  "manush",
+  "dora",
+  "za",
+  "adam",
+  "kenan",
+  "mogor",
+  "juab",
+  "diye",
+  "de",
+  "honnwa",
+  "zar",
+  "abas",
+  "ttun",
+  "funon",
+  "don",
+  "zani",
+  "diyum",
+  "iiyan",
+  "sasha",
+  "ghor",
+  "hiba",
+  "here",
+  "takedde",
+  "bout",
+  "bosor",
+  "or",
+  "zulum",
+  "gore",
+  "ze",
+  "tte",
+  "soforot",
+  "gil",
+  "hotholor",
+  "malikgwaye",
+  "lot",
+  "fail",
+  "mari",
+  "felail",
+  "tua",
+  "nassa",
+  "toyar",
+  "𐴃𐴟𐴘",
+  "𐴇𐴡𐴍𐴠",
+  "𐴎𐴡𐴀𐴊",
+};
+const uint16_t WA_FREQ_133_RANKS[] = {
+  0, 27, 0, 84, 87, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 36, 98, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 17,
+  0, 69, 75, 90, 0, 0, 0, 92, 0, 0, 0, 95, 0, 0, 93, 0,
+  34, 83, 0, 55, 89, 0, 0, 62, 22, 91, 0, 18, 37, 43, 50, 65,
+  85, 0, 0, 0, 96, 0, 61, 81, 0, 48, 111, 0, 0, 0, 0, 0,
+  19, 0, 0, 0, 82, 12, 2, 97, 0, 0, 0, 40, 100, 30, 56, 26,
+  101, 0, 0, 94, 47, 52, 106, 0, 0, 35, 74, 78, 105, 0, 6, 7,
+  110, 0, 0, 0, 0, 0, 16, 15, 0, 0, 0, 38, 57, 0, 3, 102,
+  0, 45, 31, 63, 0, 0, 0, 9, 0, 0, 109, 99, 0, 0, 0, 0,
+  0, 0, 80, 0, 0, 0, 0, 0, 39, 0, 0, 76, 54, 0, 0, 0,
+  0, 0, 0, 13, 44, 0, 0, 0, 0, 0, 77, 41, 53, 28, 71, 88,
+  0, 21, 29, 0, 0, 0, 0, 24, 0, 0, 0, 0, 10, 70, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 58, 46, 68, 79, 0,
+  0, 0, 5, 33, 0, 0, 60, 64, 51, 72, 0, 0, 103, 108, 66, 0,
+  104, 59, 25, 20, 0, 1, 32, 73, 49, 107, 0, 0, 0, 42, 23, 67,
+  0, 0, 0, 0, 0, 0, 0, 86, 0, 0, 0, 0, 0, 0, 4, 11,
+};
+
+const char *WA_FREQ_134_TOKENS[] = {
+  "mu",
+  "ko",
+  "ku",
+  "muri",
+  "na",
+  "ya",
+  "wa",
+  "ca",
+  "ngo",
+  "ari",
+  "kandi",
+  "ni",
+  "yo",
+  "aho",
+  "no",
+  "kuko",
+  "cane",
+  "rya",
+  "kuri",
+  "kugira",
+  "hamwe",
+  "Burundi",
+  "iyo",
+  "gihugu",
+  "ivyo",
+  "mbere",
+  "yuko",
+  "bo",
+  "abantu",
+  "ico",
+  "Mu",
+  "ariko",
+  "canke",
+  "bari",
+  "rero",
+  "w’igihugu",
+  "Ngo",
+  "abo",
+  "hari",
+  "gihe",
+  "neza",
+  "uwo",
+  "Reta",
+  "mwaka",
+  "avuga",
+  "imbere",
+  "yari",
+  "Bujumbura",
+  "uko",
+  "wo",
+  "i",
+  "vyo",
+  "bose",
+  "ntara",
+  "co",
+  "bwa",
+  "ati",
+  "igihugu",
+  "Imana",
+  "nyene",
+  "akaba",
+  "amenyesha",
+  "za",
+  "Ku",
+  "Uburundi",
+  "hagati",
+  "kubera",
+  "ata",
+  "inyuma",
+  "ba",
+  "Ivyo",
+  "kuba",
+  "bafise",
+  "bavuga",
+  "komine",
+  "Muri",
+  "umukuru",
+  "iryo",
+  "yose",
+  "abandi",
+  "umuntu",
+  "gushika",
+  "abanyagihugu",
+  "gisagara",
+  "vya",
+  "bamwe",
+  "Afrika",
+  "abarundi",
+  "afise",
+  "benshi",
+  "ubu",
+  "kabiri",
+  "kuva",
+  "Petero",
+  "ayo",
+  "naho",
+  "mukuru",
+  "Umukuru",
+  "Uwo",
+  "ka",
+  "abana",
+  "uyu",
+  "gusa",
+  "arongoye",
+  "igenekerezo",
+  "umwe",
+  "vyose",
+  "bwo",
+  "rwa",
+  "wiwe",
+  "Abarundi",
+  "baba",
+  "umurwi",
+  "ingingo",
+  "imyaka",
+  "we",
+  "bariko",
+  "bihugu",
+  "mpuzamakungu",
+  "muntu",
+  "ibikorwa",
+  "kwa",
+  "nta",
+  "Amerika",
+  "bijanye",
+  "zo",
+  "izo",
+  "igihe",
+  "ishirahamwe",
+  "nabo",
+  "musi",
+  "ryo",
+  "Ariko",
+  "amafaranga",
+  "uwu",
+  "c’Uburundi",
+  "Leta",
+  "gatatu",
+  "y’Uburundi",
+  "Abo",
+  "nama",
+  "reta",
+  "Iyo",
+  "Ni",
+  "Gitega",
+  "Inyuma",
+  "Ishirahamwe",
+  "umutekano",
+  "ingene",
+  "nkuru",
+  "gukora",
+  "inama",
+  "yabo",
+  "ibintu",
+  "uno",
+  "harimwo",
+  "aba",
+  "Ati",
+  "atari",
+  "ntumbero",
+  "munsi",
+  "sentare",
+  "amahoro",
+  "kimwe",
+  "n’abandi",
+  "ukuri",
+  "ubuzima",
+  "kuja",
+  "uburyo",
+  "Abantu",
+  "baca",
+  "bakaba",
+  "nk’uko",
+  "ingorane",
+  "intwaro",
+  "ubwo",
+  "bantu",
+  "bimwe",
+  "nawe",
+  "yiwe",
+  "agateka",
+  "bagiye",
+  "vyinshi",
+  "aca",
+  "amategeko",
+  "Umurwi",
+  "n’",
+  "murwi",
+  "nabi",
+  "wese",
+  "Nkurunziza",
+  "umwaka",
+  "2016",
+  "Hari",
+  "mugambwe",
+  "paruwase",
+  "yoba",
+  "mugambi",
+  "urwo",
+  "bamaze",
+  "nyuma",
+  "ubutungane",
+  "umugambwe",
+  "iri",
+  "yamenyesheje",
+  "Amakuru",
+  "Kenya",
+  "bikorwa",
+  "bwoko",
+  "kane",
+  "karere",
+  "ONU",
+  "hafi",
+  "kw’isi",
+  "asaba",
+  "biri",
+  "inyigisho",
+  "gufasha",
+  "hano",
+  "myaka",
+  "gisata",
+  "kaminuza",
+  "Video",
+  "buryo",
+  "gutanga",
+  "amakuru",
+  "basaba",
+  "du",
+  "haba",
+  "Aho",
+  "kubona",
+  "umugambi",
+  "n’amahoro",
+  "rwo",
+  "kwezi",
+  "nka",
+  "babiri",
+  "hariho",
+  "2013",
+  "Ico",
+  "by",
+  "mu.",
+  "politike",
+  "cose",
+  "ikibanza",
+  "kibanza",
+  "nshasha",
+  "rusangi",
+  "ubutegetsi",
+  "Official",
+  "amatora",
+  "video",
+  "bake",
+  "c’umukuru",
+  "y’abantu",
+  "NKURUNZIZA",
+  "akazi",
+  "zina",
+  "Raba",
+  "nshingamateka",
+  "urwaruka",
+  "n’ibindi",
+  "yavuze",
+  "kumwe",
+  "hanyuma",
+  "imwe",
+  "kurwanya",
+  "ngiro",
+  "umwana",
+  "asanzwe",
+  "kubijanye",
+  "mashure",
+  "maze",
+  "mugabo",
+  "5",
+  "rwego",
+  "10",
+  "abakristu",
+  "rumwe",
+  "yaciye",
+  "ndetse",
+  "usanga",
+  "ava",
+  "bikaba",
+  "rimwe",
+  "20",
+  "nyigisho",
+  "y’igihugu",
+  "Abanyagihugu",
+  "Cibitoke",
+  "agiye",
+  "gushira",
+  "ikaba",
+  "kumenya",
+  "kw’igenekerezo",
+  "zose",
+  "amaze",
+  "ho",
+  "ngingo",
+  "2017",
+  "CNDD",
+  "kigo",
+  "2",
+  "Patiri",
+  "iminsi",
+  "indirimbo",
+  "kuronka",
+  "uyo",
+  "ashobora",
+  "cumi",
+  "yabaye",
+  "ahabona",
+  "vyari",
+  "gutera",
+  "ibiganiro",
+  "4k",
+  "FDD",
+  "MiRRor",
+  "Ndoroshe",
+  "Présidence-République",
+  "TeAm",
+  "gituma",
+  "ibivurwa",
+  "itariki",
+  "kwihonya",
+  "muryango",
+  "nibo",
+  "n’abantu",
+  "abari",
+  "gatanu",
+  "gikorwa",
+  "amazi",
+  "biwe",
+  "indwi",
+  "iteka",
+  "Umushikiranganji",
+  "babo",
+  "cacu",
+  "gukingira",
+  "nayo",
+  "ubwoba",
+  "Kuri",
+  "Rwanda",
+  "Umugambwe",
+  "Jean",
+  "uri",
+  "baje",
+  "de",
+  "ibiri",
+  "shirahamwe",
+  "bashobora",
+  "bwiwe",
+  "nzu",
+  "ubutumwa",
+  "w’amaguru",
+  "Ikindi",
+  "bagirizwa",
+  "hose",
+  "n’abo",
+  "yahora",
+  "barenga",
+  "ibihumbi",
+  "Inama",
+  "amashure",
+  "kuwa",
+  "ubumwe",
+  "abatutsi",
+  "ikiringo",
+  "mw’ibohero",
+  "Naho",
+  "hanze",
+  "ikibazo",
+  "kurondera",
+  "niwe",
+  "Avuga",
+  "Nzero",
+  "amatongo",
+  "bakora",
+  "yitwa",
+  "Kuva",
+  "gisirikare",
+  "Sentare",
+  "ako",
+  "umutima",
+  "w’ishirahamwe",
+  "Home",
+  "Ubumwe",
+  "amashirahamwe",
+  "inzu",
+  "menshi",
+  "mw’ihiganwa",
+  "niho",
+  "nyinshi",
+  "CNDD-FDD",
+  "Iryo",
+  "Nk’uko",
+  "banyagihugu",
+  "bita",
+  "gufata",
+  "mirongo",
+  "nkuko",
+  "w’umugambwe",
+  "Rwasa",
+  "Tanzaniya",
+  "abanyeshure",
+  "ibihugu",
+  "isaba",
+  "si",
+  "Ekleziya",
+  "Umuririmvyi",
+  "kibazo",
+  "3",
+  "Ngozi",
+  "Rumonge",
+  "Ubu",
+  "iki",
+  "imisi",
+  "abahutu",
+  "ahubwo",
+  "gatondo",
+  "zibiri",
+  "baciye",
+  "imigambi",
+  "kugirango",
+  "none",
+  "n’umwe",
+  "ubutunzi",
+  "umuryango",
+  "umushikiranganji",
+  "yagirizwa",
+  "Afirika",
+  "abakozi",
+  "akarorero",
+  "ciwe",
+  "gatandatu",
+  "ijambo",
+  "imanza",
+  "Mpimba",
+  "ajejwe",
+  "bana",
+  "kuvuga",
+  "kw’izina",
+  "mushasha",
+  "ngorane",
+  "vyerekeye",
+  "w’Imana",
+  "zimwe",
+  "Bamwe",
+  "biro",
+  "bituma",
+  "kenshi",
+  "mafaranga",
+  "misi",
+  "nshingiro",
+  "ujejwe",
+  "y’ubuseruko",
+  "2015",
+  "ibirwanisho",
+  "rikuru",
+  "Ayo",
+  "abajejwe",
+  "baja",
+  "igisata",
+  "kure",
+  "la",
+  "yahoze",
+  "amatohoza",
+  "bamenyesha",
+  "basanzwe",
+  "igikorwa",
+  "iriko",
+  "n’uko",
+  "yaho",
+  "yaraye",
+  "bene",
+  "intara",
+  "inzego",
+  "kiringo",
+  "matora",
+  "vyabo",
+  "wabo",
+  "yatowe",
+  "amwe",
+  "bwabo",
+  "iheze",
+  "indwara",
+  "mwiza",
+  "wari",
+  "Zunze",
+  "agira",
+  "batatu",
+  "baza",
+  "bushikiranganji",
+  "gukoresha",
+  "kino",
+  "patiri",
+  "15",
+  "amahera",
+  "azwi",
+  "bane",
+  "kwubaka",
+  "kw’ijana",
+  "ubushikiranganji",
+  "umunsi",
+  "urubanza",
+  "Buraya",
+  "Muyinga",
+  "akamaro",
+  "amakenga",
+  "gutunganya",
+  "mibano",
+  "n’abanyagihugu",
+  "zone",
+  "2014",
+  "bike",
+  "buzima",
+  "gice",
+  "umuririmvyi",
+  "Deo",
+  "Nta",
+  "abavyeyi",
+  "bitaro",
+  "gusubira",
+  "ibijanye",
+  "icegera",
+  "umugwi",
+  "yafashwe",
+  "bahora",
+  "mashirahamwe",
+  "niyo",
+  "nzego",
+  "boba",
+  "butumwa",
+  "hejuru",
+  "ibindi",
+  "inyishu",
+  "kumenyesha",
+  "kwica",
+  "mw’ijoro",
+  "ndirimbo",
+  "uruhara",
+  "y’uko",
+  "ziri",
+  "Agathon",
+  "Bururi",
+  "CNTB",
+  "Trump",
+  "amagara",
+  "babona",
+  "bitandukanye",
+  "ibibanza",
+  "kubandanya",
+  "n’umurwi",
+  "ubuhinga",
+  "umwimbu",
+  "vyiza",
+  "amatati",
+  "bikuru",
+  "gusubiza",
+  "ibidukikije",
+  "itegeko",
+  "iterambere",
+  "mutima",
+  "n’ishirahamwe",
+  "n’umukuru",
+  "uburenganzira",
+  "umuti",
+  "zunze",
+  "Bubanza",
+  "Iconayisavye",
+  "Ruyigi",
+  "batari",
+  "ica",
+  "ivyiyumviro",
+  "nko",
+  "rugero",
+  "umugabo",
+  "yemeza",
+  "y’aho",
+  "MSD",
+  "OBR",
+  "amazu",
+  "aribo",
+  "bava",
+  "eka",
+  "gutangura",
+  "hasi",
+  "make",
+  "atatu",
+  "bagize",
+  "bivugwa",
+  "canecane",
+  "ingendo",
+  "kazi",
+  "n’aho",
+  "ubwa",
+  "Colonel",
+  "Général",
+  "Igihugu",
+  "ariwe",
+  "ihiganwa",
+  "intumbero",
+  "iyi",
+  "mbi",
+  "shingiro",
+  "yagiye",
+  "12",
+  "Ruhuhuma",
+  "bashaka",
+  "bibanza",
+  "ibwirizwa",
+  "ifise",
+  "kazoza",
+  "nguvu",
+  "uheze",
+  "umwanya",
+  "13",
+  "4",
+  "Donald",
+  "Kirundo",
+  "Papa",
+  "Pierre",
+  "Vyatangajwe",
+  "akavuga",
+  "bafashwe",
+  "bategerezwa",
+  "bazi",
+  "buri",
+  "dufise",
+  "ibibazo",
+  "isi",
+  "kera",
+  "kiri",
+  "mubijanye",
+  "n’ivyo",
+  "umukono",
+  "Kayanza",
+  "Nkuko",
+  "ahanini",
+  "amajambo",
+  "igice",
+  "itanu",
+  "itatu",
+  "turi",
+  "w’imyaka",
+  "y’Ubuseruko",
+  "Kigarama",
+  "abasirikare",
+  "ataco",
+  "guteza",
+  "kwitaba",
+  "18",
+  "Ndamukiza",
+  "abamenyeshamakuru",
+  "abiri",
+  "akaryo",
+  "bagera",
+  "bitari",
+  "butegetsi",
+  "butungane",
+  "c’Urwanda",
+  "higanwa",
+  "naco",
+  "twese",
+  "1",
+  "Uyo",
+  "igiye",
+  "mahiganwa",
+  "makungu",
+  "mutwe",
+  "mw’ishirahamwe",
+  "nzira",
+  "poritike",
+  "rugendo",
+  "rukino",
+  "ry’Imana",
+  "twari",
+  "ubwicanyi",
+  "ubwoko",
+  "uruhusha",
+  "wewe",
+  "yakoze",
+  "zabo",
+  "EAC",
+  "Ikigo",
+  "Ubushikiranganji",
+  "ahandi",
+  "bakoze",
+  "bati",
+  "bibiri",
+  "biciye",
+  "izina",
+  "kijejwe",
+  "kuraba",
+  "muhira",
+  "n’ayandi",
+  "rukristu",
+  "ukwo",
+  "yariko",
+  "yasavye",
+  "7",
+  "amajana",
+  "bice",
+  "biganiro",
+  "bigize",
+  "bivuye",
+  "ejo",
+  "gusumba",
+  "inkino",
+  "isoko",
+  "kuza",
+  "makuru",
+  "masezerano",
+  "minwe",
+  "myiyerekano",
+  "n’amategeko",
+  "rigenga",
+  "umuyobozi",
+  "uwundi",
+  "vuba",
+  "yatanguye",
+  "yatanze",
+  "14",
+  "Arusha",
+  "FC",
+  "Muramvya",
+  "akamo",
+  "amasezerano",
+  "bishobora",
+  "gusaba",
+  "imyiyerekano",
+  "isaha",
+  "mugwi",
+  "ngaha",
+  "ngaho",
+  "nti",
+  "yagize",
+  "Kongo",
+  "Mariya",
+  "akora",
+  "bato",
+  "gukorera",
+  "ibice",
+  "n’umutekano",
+  "rimenyesha",
+  "rutonde",
+  "FNL",
+  "Ikibazo",
+  "Kristu",
+  "Munyonyo",
+  "Nshimirimana",
+  "Umwe",
+  "aha",
+  "arenga",
+  "atandukanye",
+  "bajejwe",
+  "bifise",
+  "guca",
+  "ibiro",
+  "icese",
+  "imfashanyo",
+  "ko.",
+  "ndwi",
+  "ruhande",
+  "twebwe",
+  "umunani",
+  "yashikirije",
+  "Aha",
+  "I",
+  "baguma",
+  "birori",
+  "bishwe",
+  "guhagarika",
+  "ishure",
+  "iwe",
+  "iyindi",
+  "mabanga",
+  "rwaruka",
+  "ukaba",
+  "y’i",
+  "2012",
+  "CNARED",
+  "Congo",
+  "Rwagasore",
+  "Umuvugizi",
+  "bagira",
+  "bashobore",
+  "bwinshi",
+  "bwose",
+  "cari",
+  "diyoseze",
+  "imiryango",
+  "inguvu",
+  "kama",
+  "ku.",
+  "muririmvyi",
+  "ukuntu",
+  "wose",
+  "yahaye",
+  "yitavye",
+  "16",
+  "22",
+  "Ntwarante",
+  "Umuntu",
+  "bisata",
+  "b’ibihugu",
+  "gutwara",
+  "imirwi",
+  "migambi",
+  "migambwe",
+  "mirwi",
+  "mw’ibarabara",
+  "n’abajejwe",
+  "rubanza",
+  "yamaze",
+  "y’Epfo",
+  "Yezu",
+  "abagabo",
+  "amezi",
+  "batangura",
+  "batanu",
+  "be",
+  "giteramo",
+  "iwabo",
+  "kabo",
+  "makomine",
+  "mitumba",
+  "nkino",
+  "nserukiragihugu",
+  "ntaco",
+  "nziza",
+  "n’ico",
+  "ryiwe",
+  "u",
+  "w’umurundi",
+  "25",
+  "Abasirikare",
+  "Diyoseze",
+  "Koreya",
+  "Maria",
+  "OLUCOME",
+  "Paul",
+  "Umuyobozi",
+  "Yohani",
+  "abandanya",
+  "aja",
+  "bakorera",
+  "bashika",
+  "bintu",
+  "inzira",
+  "jewe",
+  "mabarabara",
+  "ryishinze",
+  "ry’umupira",
+  "B",
+  "Connection",
+  "Gambia",
+  "Komine",
+  "Kubera",
+  "abakenyezi",
+  "bama",
+  "bikwiye",
+  "gitero",
+  "kare",
+  "kibuga",
+  "kikaba",
+  "minsi",
+  "ugasanga",
+  "umuco",
+  "urukundo",
+  "urunani",
+  "vyerekana",
+  "wanje",
+  "30",
+  "Abandi",
+  "Date",
+  "GMT",
+  "Ijambo",
+  "Kinama",
+  "Musenyeri",
+  "NET",
+  "Sep",
+  "Tue",
+  "Urunani",
+  "biba",
+  "bigatuma",
+  "bw’igihugu",
+  "close",
+  "ikigongwe",
+  "inkoho",
+  "intahe",
+  "kurongora",
+  "n’iyo",
+  "ufise",
+  "yishwe",
+  "zitandukanye",
+  "6",
+  "9",
+  "Icegera",
+  "Izo",
+  "Mukakaro",
+  "Na",
+  "abanywanyi",
+  "gushigikira",
+  "hakaba",
+  "kwakira",
+  "navyo",
+  "rwiwe",
+  "ry’Ubumwe",
+  "umugore",
+  "uwa",
+  "vyabaye",
+  "wa.",
+  "50",
+  "Adolphe",
+  "Partager",
+  "Paruwase",
+  "abakinyi",
+  "amabi",
+  "bindi",
+  "bitavye",
+  "igituma",
+  "impunzi",
+  "ino",
+  "izindi",
+  "kahise",
+  "publication",
+  "risaba",
+  "rugo",
+  "ubumuga",
+  "ubwenge",
+  "urukino",
+  "ururimi",
+  "yagandaguwe",
+  "yemeye",
+  "21",
+  "Abanyeshure",
+  "Agira",
+  "Amenyesha",
+  "Ruheshi",
+  "abona",
+  "ahantu",
+  "aza",
+  "bitwaje",
+  "guhindura",
+  "ibihano",
+  "kiganiro",
+  "kurekuriranira",
+  "kurusha",
+  "kwerekana",
+  "muganga",
+  "mvo",
+  "umusi",
+  "urwego",
+  "y’imyaka",
+  "Rusama",
+  "Umugwi",
+  "Umukinyi",
+  "abagore",
+  "abategetsi",
+  "amabanga",
+  "batanguye",
+  "buhinga",
+  "gufatwa",
+  "gukura",
+  "inkuru",
+  "inyungu",
+  "nivyo",
+  "n’ubushikiranganji",
+  "umuhuza",
+  "umuvugizi",
+  "8",
+  "Abakinyi",
+  "Eka",
+  "Emmanuel",
+  "Makamba",
+  "Ngagara",
+  "UPRONA",
+  "buramatari",
+  "igikombe",
+  "ikintu",
+  "impuzu",
+  "ingoma",
+  "kwemera",
+  "kwinjira",
+  "mabi",
+  "mugoroba",
+  "n’amashirahamwe",
+  "runani",
+  "rwose",
+  "w’intara",
+  "Ebola",
+  "Igihe",
+  "Ikinyamakuru",
+  "Tanganyika",
+  "agashimwe",
+  "atanga",
+  "avuye",
+  "batazira",
+  "bihe",
+};
+const uint16_t WA_FREQ_134_RANKS[] = {
+  0, 0, 0, 0, 16, 223, 0, 0, 667, 569, 118, 955, 0, 0, 0, 604,
+  257, 950, 0, 0, 146, 449, 0, 0, 0, 494, 780, 0, 0, 696, 0, 0,
+  0, 990, 0, 0, 0, 0, 0, 899, 0, 0, 619, 0, 0, 0, 998, 520,
+  0, 0, 0, 0, 0, 0, 514, 0, 0, 0, 0, 920, 134, 73, 593, 0,
+  0, 0, 0, 0, 0, 0, 135, 0, 0, 726, 967, 0, 0, 0, 798, 0,
+  299, 0, 0, 0, 0, 0, 0, 38, 83, 181, 161, 359, 655, 690, 400, 701,
+  741, 861, 0, 0, 0, 485, 0, 0, 634, 89, 0, 0, 0, 542, 0, 496,
+  0, 94, 0, 0, 961, 0, 0, 0, 0, 0, 0, 0, 40, 0, 0, 111,
+  160, 0, 116, 0, 0, 0, 938, 1, 323, 937, 0, 0, 176, 641, 849, 0,
+  0, 248, 0, 558, 627, 679, 747, 0, 57, 760, 0, 0, 0, 612, 0, 0,
+  0, 0, 0, 504, 684, 150, 420, 688, 947, 0, 0, 0, 0, 0, 145, 240,
+  0, 210, 989, 530, 0, 0, 0, 0, 0, 0, 175, 0, 885, 547, 965, 409,
+  0, 810, 0, 399, 817, 0, 0, 796, 0, 458, 748, 0, 142, 707, 0, 765,
+  511, 260, 273, 560, 598, 756, 0, 0, 0, 252, 0, 0, 0, 0, 692, 501,
+  0, 0, 781, 0, 872, 0, 0, 0, 0, 0, 0, 0, 628, 54, 90, 683,
+  0, 0, 856, 330, 0, 0, 0, 0, 0, 525, 0, 0, 0, 0, 0, 222,
+  0, 149, 915, 0, 0, 0, 0, 0, 0, 963, 0, 0, 633, 0, 609, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 0, 508, 750,
+  188, 650, 98, 850, 169, 720, 913, 841, 0, 0, 0, 256, 368, 0, 0, 0,
+  473, 0, 0, 704, 0, 0, 575, 778, 421, 0, 197, 0, 7, 331, 0, 498,
+  0, 0, 0, 0, 0, 552, 878, 968, 0, 0, 685, 0, 0, 424, 0, 902,
+  566, 791, 0, 0, 398, 0, 34, 0, 0, 0, 0, 0, 0, 926, 0, 21,
+  0, 0, 895, 234, 499, 0, 964, 0, 945, 0, 0, 406, 996, 0, 381, 0,
+  0, 0, 0, 0, 0, 405, 495, 956, 657, 976, 0, 0, 0, 883, 141, 638,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 524, 425, 761, 828, 195, 0,
+  0, 0, 939, 0, 0, 914, 290, 0, 0, 0, 0, 591, 0, 0, 0, 0,
+  698, 0, 0, 0, 0, 0, 37, 203, 893, 0, 745, 0, 900, 291, 0, 0,
+  0, 296, 770, 0, 277, 358, 0, 904, 0, 48, 0, 0, 28, 49, 63, 93,
+  417, 334, 491, 353, 906, 467, 639, 995, 890, 0, 0, 0, 840, 0, 794, 0,
+  0, 376, 218, 0, 0, 0, 759, 529, 1000, 0, 0, 325, 447, 0, 556, 623,
+  738, 0, 0, 0, 0, 0, 664, 0, 0, 0, 595, 0, 0, 482, 540, 0,
+  281, 0, 736, 792, 0, 0, 0, 0, 66, 0, 0, 383, 124, 590, 503, 636,
+  786, 951, 0, 0, 0, 988, 140, 337, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 310, 733, 0, 0, 0, 0, 0, 0, 0, 0, 227, 0, 413, 871, 0,
+  44, 769, 264, 378, 854, 120, 0, 0, 0, 186, 360, 315, 952, 435, 0, 751,
+  0, 99, 0, 170, 764, 0, 858, 29, 52, 43, 531, 0, 0, 0, 533, 301,
+  642, 343, 0, 0, 185, 324, 562, 705, 889, 14, 880, 541, 255, 316, 462, 653,
+  687, 0, 0, 0, 0, 0, 528, 0, 61, 108, 247, 199, 250, 551, 709, 777,
+  960, 136, 23, 139, 0, 713, 680, 757, 946, 0, 0, 586, 304, 0, 0, 0,
+  469, 20, 930, 0, 0, 0, 243, 0, 0, 0, 0, 0, 0, 857, 0, 0,
+  326, 0, 0, 254, 0, 431, 606, 0, 32, 543, 654, 81, 718, 0, 808, 0,
+  302, 581, 0, 0, 307, 0, 0, 0, 0, 0, 0, 0, 251, 269, 276, 154,
+  582, 587, 346, 758, 5, 814, 953, 0, 597, 0, 212, 755, 0, 0, 749, 522,
+  0, 0, 0, 752, 0, 0, 818, 772, 327, 958, 289, 352, 0, 0, 0, 0,
+  470, 0, 45, 0, 180, 0, 0, 155, 0, 0, 0, 0, 0, 0, 293, 426,
+  0, 0, 601, 0, 287, 640, 0, 0, 0, 369, 172, 493, 384, 183, 632, 0,
+  0, 0, 125, 868, 0, 519, 96, 766, 418, 0, 0, 536, 0, 0, 0, 0,
+  0, 370, 0, 669, 793, 0, 242, 0, 0, 594, 263, 0, 0, 0, 0, 0,
+  442, 0, 231, 668, 0, 0, 670, 909, 550, 739, 775, 0, 0, 0, 35, 401,
+  561, 725, 0, 0, 879, 0, 789, 0, 0, 246, 935, 896, 0, 0, 0, 0,
+  0, 0, 456, 0, 0, 259, 382, 404, 0, 374, 95, 691, 0, 0, 0, 209,
+  567, 516, 862, 0, 80, 589, 744, 779, 863, 402, 836, 629, 64, 434, 549, 874,
+  446, 162, 0, 47, 386, 393, 816, 0, 204, 0, 0, 241, 286, 91, 329, 681,
+  388, 754, 901, 0, 0, 0, 0, 0, 387, 0, 0, 565, 379, 618, 0, 646,
+  0, 0, 0, 268, 0, 0, 0, 0, 954, 0, 0, 0, 846, 0, 51, 226,
+  917, 104, 580, 335, 788, 806, 981, 824, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 860, 480, 0, 0, 583, 0, 191, 245, 0, 0, 0, 577, 19,
+  68, 924, 975, 0, 0, 53, 962, 0, 0, 0, 785, 0, 0, 126, 0, 440,
+  554, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 932, 0, 0, 427, 0,
+  0, 152, 69, 0, 700, 0, 0, 0, 271, 0, 585, 0, 999, 0, 0, 0,
+  986, 30, 0, 0, 0, 0, 614, 957, 153, 876, 0, 0, 0, 0, 167, 397,
+  156, 132, 922, 0, 39, 0, 607, 0, 0, 371, 0, 647, 0, 265, 811, 0,
+  0, 0, 0, 776, 0, 174, 214, 87, 338, 910, 488, 0, 0, 412, 993, 0,
+  0, 177, 274, 0, 0, 0, 743, 0, 79, 190, 512, 660, 0, 207, 572, 0,
+  0, 0, 92, 345, 559, 0, 852, 825, 0, 0, 722, 0, 300, 0, 0, 0,
+  0, 0, 0, 538, 0, 829, 0, 0, 0, 0, 0, 0, 0, 0, 232, 0,
+  0, 109, 0, 224, 602, 645, 463, 800, 0, 0, 100, 472, 475, 891, 137, 0,
+  0, 365, 0, 433, 165, 678, 812, 534, 0, 521, 110, 0, 0, 0, 0, 77,
+  11, 588, 128, 605, 918, 949, 0, 649, 0, 0, 0, 0, 0, 497, 184, 509,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 67, 855, 349, 518, 0, 643,
+  332, 0, 600, 0, 408, 0, 859, 0, 875, 211, 24, 0, 0, 0, 102, 715,
+  819, 0, 178, 411, 313, 714, 0, 0, 523, 0, 0, 0, 151, 217, 711, 703,
+  782, 0, 284, 130, 866, 0, 0, 0, 0, 0, 0, 0, 309, 0, 0, 830,
+  0, 0, 0, 0, 272, 648, 0, 997, 652, 803, 486, 348, 367, 515, 0, 0,
+  0, 0, 555, 0, 0, 916, 0, 0, 468, 490, 0, 0, 0, 797, 0, 0,
+  0, 0, 544, 0, 0, 0, 0, 716, 474, 897, 0, 479, 0, 344, 0, 0,
+  0, 0, 0, 0, 848, 114, 0, 0, 0, 912, 717, 0, 0, 356, 372, 805,
+  0, 0, 0, 0, 235, 0, 570, 305, 0, 0, 0, 0, 489, 568, 0, 0,
+  941, 423, 457, 919, 0, 0, 0, 117, 455, 644, 663, 459, 731, 795, 147, 659,
+  833, 143, 0, 415, 0, 0, 0, 390, 0, 689, 0, 0, 0, 283, 443, 517,
+  0, 354, 576, 978, 194, 837, 0, 0, 0, 484, 0, 0, 0, 0, 0, 0,
+  0, 377, 0, 0, 0, 55, 620, 0, 0, 0, 0, 205, 603, 410, 249, 980,
+  41, 429, 864, 771, 0, 0, 0, 385, 768, 613, 535, 0, 0, 0, 0, 394,
+  898, 0, 0, 719, 513, 884, 813, 933, 865, 113, 0, 133, 676, 0, 0, 0,
+  0, 432, 258, 477, 0, 0, 0, 0, 0, 0, 163, 0, 0, 699, 0, 9,
+  0, 0, 0, 0, 0, 0, 0, 3, 84, 0, 0, 0, 391, 0, 0, 303,
+  873, 784, 0, 0, 58, 76, 438, 0, 677, 0, 0, 0, 0, 0, 464, 0,
+  0, 564, 925, 0, 799, 0, 621, 450, 314, 0, 0, 944, 0, 25, 319, 0,
+  599, 0, 0, 753, 845, 173, 615, 0, 0, 322, 282, 815, 0, 115, 977, 665,
+  0, 0, 545, 221, 0, 70, 339, 0, 0, 0, 0, 297, 0, 574, 0, 0,
+  0, 0, 0, 0, 0, 822, 0, 0, 198, 571, 853, 0, 0, 0, 0, 8,
+  119, 834, 200, 658, 236, 972, 827, 476, 983, 0, 0, 0, 0, 419, 0, 0,
+  308, 105, 171, 229, 294, 340, 436, 233, 635, 422, 790, 122, 656, 838, 882, 903,
+  702, 0, 60, 0, 0, 0, 0, 0, 0, 0, 0, 706, 809, 0, 0, 0,
+  361, 0, 0, 275, 17, 888, 0, 487, 182, 839, 881, 481, 611, 734, 892, 27,
+  364, 737, 940, 0, 362, 0, 86, 0, 686, 763, 0, 0, 630, 0, 0, 366,
+  0, 0, 0, 380, 0, 2, 138, 317, 801, 0, 579, 0, 0, 774, 0, 0,
+  0, 0, 0, 0, 832, 0, 0, 478, 584, 157, 278, 292, 973, 974, 0, 0,
+  746, 557, 239, 0, 0, 0, 843, 942, 311, 0, 193, 0, 0, 0, 82, 168,
+  179, 673, 869, 783, 982, 62, 357, 192, 984, 0, 26, 312, 342, 506, 0, 507,
+  65, 36, 0, 0, 727, 0, 662, 966, 0, 0, 0, 0, 631, 159, 0, 0,
+  0, 0, 0, 0, 0, 821, 0, 78, 847, 992, 0, 395, 0, 31, 0, 802,
+  682, 0, 851, 921, 0, 0, 328, 0, 187, 0, 262, 396, 121, 844, 527, 616,
+  0, 0, 0, 437, 546, 539, 723, 0, 0, 0, 0, 0, 0, 373, 985, 0,
+  0, 430, 894, 927, 196, 693, 318, 674, 0, 75, 392, 671, 453, 695, 71, 0,
+  573, 537, 826, 244, 730, 596, 144, 270, 123, 0, 454, 0, 0, 288, 578, 0,
+  911, 0, 0, 0, 375, 0, 306, 0, 0, 439, 532, 0, 762, 208, 905, 0,
+  403, 0, 0, 0, 103, 0, 0, 0, 0, 0, 0, 867, 416, 0, 0, 0,
+  0, 0, 320, 228, 298, 445, 0, 622, 0, 0, 0, 870, 0, 0, 500, 4,
+  414, 74, 526, 0, 0, 0, 0, 608, 728, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 261, 164, 0, 6, 767, 553, 0, 0, 148, 624, 85, 295, 0, 886,
+  0, 0, 0, 712, 0, 0, 0, 0, 0, 0, 0, 492, 0, 0, 0, 0,
+  201, 694, 0, 610, 0, 0, 483, 0, 0, 253, 592, 626, 266, 0, 0, 46,
+  0, 0, 0, 0, 13, 341, 0, 18, 887, 12, 0, 0, 931, 0, 0, 0,
+  651, 0, 0, 279, 452, 225, 0, 675, 0, 0, 948, 321, 0, 0, 59, 0,
+  0, 0, 50, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0,
+  0, 0, 389, 189, 166, 637, 280, 735, 697, 0, 112, 842, 0, 0, 407, 444,
+  970, 0, 740, 877, 267, 0, 0, 230, 347, 0, 0, 351, 0, 0, 0, 773,
+  0, 936, 33, 158, 441, 88, 672, 466, 807, 0, 428, 0, 213, 0, 336, 0,
+  0, 0, 0, 0, 0, 0, 216, 202, 237, 708, 107, 465, 510, 959, 994, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 563, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 363, 943, 461, 823, 97, 617, 835, 350, 721, 72,
+  0, 0, 238, 0, 0, 979, 0, 0, 0, 742, 56, 220, 451, 505, 0, 0,
+  0, 219, 732, 333, 0, 934, 0, 666, 502, 471, 0, 101, 971, 355, 831, 0,
+  0, 0, 0, 0, 42, 0, 0, 127, 907, 991, 0, 0, 0, 0, 0, 0,
+  285, 969, 206, 729, 548, 928, 929, 0, 448, 987, 0, 0, 0, 0, 0, 0,
+  0, 710, 0, 10, 0, 820, 0, 908, 0, 0, 0, 0, 0, 0, 724, 0,
+  0, 215, 625, 787, 106, 129, 460, 0, 0, 0, 661, 0, 0, 923, 15, 804,
+};
+
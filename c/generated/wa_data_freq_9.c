@@ -0,0 +1,10529 @@
+#include "worldalphabets_data.h"
+
+const char *WA_FREQ_135_TOKENS[] = {
+  "de",
+  "nu",
+  "să",
+  "o",
+  "în",
+  "ce",
+  "e",
+  "că",
+  "şi",
+  "la",
+  "a",
+  "cu",
+  "pe",
+  "am",
+  "un",
+  "mai",
+  "asta",
+  "pentru",
+  "este",
+  "sunt",
+  "ai",
+  "te",
+  "bine",
+  "da",
+  "ca",
+  "dar",
+  "se",
+  "din",
+  "fost",
+  "care",
+  "fi",
+  "mă",
+  "eu",
+  "aici",
+  "sa",
+  "dacă",
+  "trebuie",
+  "va",
+  "cum",
+  "si",
+  "tu",
+  "acum",
+  "aşa",
+  "el",
+  "ar",
+  "lui",
+  "ceva",
+  "când",
+  "doar",
+  "eşti",
+  "ei",
+  "ne",
+  "mine",
+  "tine",
+  "poate",
+  "pot",
+  "voi",
+  "face",
+  "cred",
+  "îmi",
+  "au",
+  "mea",
+  "spus",
+  "ştiu",
+  "unde",
+  "vă",
+  "meu",
+  "ea",
+  "mult",
+  "vreau",
+  "s-a",
+  "despre",
+  "vrei",
+  "sau",
+  "tot",
+  "foarte",
+  "pare",
+  "acolo",
+  "chiar",
+  "in",
+  "noi",
+  "bună",
+  "ta",
+  "era",
+  "nimic",
+  "faci",
+  "are",
+  "făcut",
+  "cine",
+  "nici",
+  "putea",
+  "ştii",
+  "fac",
+  "fie",
+  "nevoie",
+  "trebui",
+  "rău",
+  "atunci",
+  "timp",
+  "tău",
+  "spun",
+  "și",
+  "rog",
+  "acest",
+  "îţi",
+  "nu-i",
+  "spune",
+  "avem",
+  "poţi",
+  "al",
+  "le",
+  "după",
+  "vom",
+  "deci",
+  "îl",
+  "prea",
+  "mulţumesc",
+  "să-l",
+  "cineva",
+  "oh",
+  "toate",
+  "ani",
+  "cel",
+  "suntem",
+  "vei",
+  "bun",
+  "sigur",
+  "vor",
+  "vrea",
+  "mare",
+  "îi",
+  "iar",
+  "până",
+  "cât",
+  "haide",
+  "crezi",
+  "încă",
+  "hei",
+  "stai",
+  "atât",
+  "totul",
+  "avea",
+  "venit",
+  "spui",
+  "ăsta",
+  "avut",
+  "m-am",
+  "lucru",
+  "să-ţi",
+  "văzut",
+  "fel",
+  "să-i",
+  "putem",
+  "ceea",
+  "n-am",
+  "să-mi",
+  "fără",
+  "ma",
+  "mama",
+  "place",
+  "aş",
+  "decât",
+  "asa",
+  "domnule",
+  "niciodată",
+  "regulă",
+  "mi-a",
+  "prin",
+  "s-o",
+  "esti",
+  "înainte",
+  "văd",
+  "mergem",
+  "unul",
+  "uite",
+  "puţin",
+  "hai",
+  "loc",
+  "nimeni",
+  "toată",
+  "apoi",
+  "vezi",
+  "dat",
+  "întâmplat",
+  "fii",
+  "l-am",
+  "naiba",
+  "nou",
+  "oameni",
+  "ia",
+  "facem",
+  "zi",
+  "acasă",
+  "multe",
+  "jos",
+  "lumea",
+  "două",
+  "toţi",
+  "nu-mi",
+  "daca",
+  "timpul",
+  "această",
+  "orice",
+  "oamenii",
+  "auzit",
+  "doi",
+  "dle",
+  "luat",
+  "fiecare",
+  "peste",
+  "vrut",
+  "înapoi",
+  "într-o",
+  "astea",
+  "aţi",
+  "aia",
+  "fiu",
+  "dintre",
+  "merge",
+  "lor",
+  "nişte",
+  "trei",
+  "numele",
+  "om",
+  "cea",
+  "găsit",
+  "cei",
+  "doamne",
+  "mele",
+  "te-ai",
+  "i",
+  "stiu",
+  "aceasta",
+  "du-te",
+  "viaţa",
+  "deja",
+  "ziua",
+  "duc",
+  "dată",
+  "parte",
+  "i-am",
+  "vino",
+  "destul",
+  "câteva",
+  "există",
+  "serios",
+  "gata",
+  "bani",
+  "vorbesc",
+  "ok",
+  "tatăl",
+  "aproape",
+  "vedem",
+  "afară",
+  "dau",
+  "numai",
+  "întâmplă",
+  "nostru",
+  "adevărat",
+  "noastră",
+  "înseamnă",
+  "într-un",
+  "una",
+  "vin",
+  "m-a",
+  "eram",
+  "locul",
+  "scuze",
+  "acesta",
+  "vine",
+  "repede",
+  "zis",
+  "fapt",
+  "ori",
+  "te-am",
+  "n-o",
+  "putut",
+  "grijă",
+  "tale",
+  "lucruri",
+  "singur",
+  "prima",
+  "casa",
+  "probabil",
+  "ajuns",
+  "cam",
+  "exact",
+  "ştie",
+  "sunteţi",
+  "l-a",
+  "dreptate",
+  "simt",
+  "tocmai",
+  "noapte",
+  "cele",
+  "târziu",
+  "trecut",
+  "zile",
+  "facă",
+  "mereu",
+  "adică",
+  "partea",
+  "seara",
+  "lucrurile",
+  "iau",
+  "unui",
+  "împreună",
+  "plecat",
+  "crezut",
+  "omule",
+  "fata",
+  "imediat",
+  "ne-am",
+  "spre",
+  "azi",
+  "ţi-am",
+  "departe",
+  "aceste",
+  "terminat",
+  "început",
+  "trebuia",
+  "iubesc",
+  "m-ai",
+  "stii",
+  "măcar",
+  "pierdut",
+  "tata",
+  "sub",
+  "copii",
+  "frumos",
+  "banii",
+  "mâine",
+  "n-ai",
+  "mi-am",
+  "mamă",
+  "mi",
+  "mei",
+  "treaba",
+  "l-ai",
+  "tată",
+  "plec",
+  "sus",
+  "păi",
+  "n-a",
+  "s-ar",
+  "vorba",
+  "ăla",
+  "greu",
+  "viaţă",
+  "vedea",
+  "mi-ai",
+  "d-le",
+  "dumnezeu",
+  "tipul",
+  "desigur",
+  "drumul",
+  "nu-ţi",
+  "minute",
+  "dracu",
+  "înţeleg",
+  "trebuit",
+  "dai",
+  "murit",
+  "ajuta",
+  "mie",
+  "femeie",
+  "idee",
+  "copil",
+  "aveţi",
+  "gândit",
+  "ultima",
+  "ale",
+  "moment",
+  "tip",
+  "i-a",
+  "primul",
+  "aceea",
+  "multumesc",
+  "pus",
+  "sper",
+  "noastre",
+  "data",
+  "merg",
+  "pic",
+  "s-au",
+  "dus",
+  "seama",
+  "erau",
+  "bune",
+  "aşteaptă",
+  "făcut-o",
+  "imi",
+  "spune-mi",
+  "lua",
+  "urmă",
+  "tare",
+  "griji",
+  "înţeles",
+  "cazul",
+  "poti",
+  "vreo",
+  "problema",
+  "buna",
+  "nu-l",
+  "cauza",
+  "între",
+  "ajunge",
+  "duci",
+  "ce-i",
+  "camera",
+  "ajutor",
+  "mort",
+  "noaptea",
+  "vorbim",
+  "corect",
+  "cand",
+  "întotdeauna",
+  "minunat",
+  "încercat",
+  "ele",
+  "poftim",
+  "îşi",
+  "ucis",
+  "ore",
+  "pune",
+  "vreodată",
+  "vorbeşti",
+  "fiul",
+  "ciudat",
+  "unei",
+  "dumnezeule",
+  "dr",
+  "ba",
+  "probleme",
+  "problemă",
+  "vorbit",
+  "adus",
+  "familia",
+  "simţi",
+  "lasă-mă",
+  "luni",
+  "vii",
+  "altă",
+  "cap",
+  "faţă",
+  "cer",
+  "ales",
+  "uită-te",
+  "crede",
+  "cale",
+  "credeam",
+  "te-a",
+  "ascultă",
+  "nicio",
+  "casă",
+  "duce",
+  "dă-mi",
+  "bucur",
+  "uitat",
+  "cunosc",
+  "acel",
+  "încredere",
+  "caz",
+  "facut",
+  "singură",
+  "joc",
+  "oricum",
+  "mergi",
+  "altceva",
+  "primit",
+  "asemenea",
+  "faţa",
+  "lume",
+  "ochii",
+  "acord",
+  "cinci",
+  "fată",
+  "veni",
+  "patru",
+  "mulţi",
+  "siguranţă",
+  "iei",
+  "lăsat",
+  "telefon",
+  "prins",
+  "fratele",
+  "băieţi",
+  "simplu",
+  "asta-i",
+  "salut",
+  "ţi-a",
+  "uşor",
+  "maşina",
+  "prieten",
+  "omul",
+  "dragă",
+  "i-ai",
+  "important",
+  "găsi",
+  "lângă",
+  "puteţi",
+  "grozav",
+  "doamnă",
+  "rau",
+  "câte",
+  "vina",
+  "zici",
+  "şi-a",
+  "vorbi",
+  "dolari",
+  "acea",
+  "pasă",
+  "mod",
+  "ne-a",
+  "faceţi",
+  "uh",
+  "pun",
+  "maşină",
+  "sunat",
+  "ești",
+  "mâna",
+  "ştim",
+  "rahat",
+  "tau",
+  "știu",
+  "pleci",
+  "prieteni",
+  "odată",
+  "pleacă",
+  "stau",
+  "drum",
+  "alte",
+  "dvs.",
+  "as",
+  "astfel",
+  "curând",
+  "întors",
+  "ora",
+  "mi-e",
+  "mic",
+  "n-ar",
+  "doua",
+  "arată",
+  "alt",
+  "începe",
+  "nouă",
+  "de-a",
+  "s",
+  "singura",
+  "gând",
+  "treabă",
+  "trimis",
+  "capul",
+  "apă",
+  "copilul",
+  "posibil",
+  "singurul",
+  "soţia",
+  "alo",
+  "noroc",
+  "legătură",
+  "spate",
+  "adevărul",
+  "frumoasă",
+  "aveam",
+  "viata",
+  "împotriva",
+  "către",
+  "veţi",
+  "inima",
+  "lăsa",
+  "tăi",
+  "încearcă",
+  "niciun",
+  "rămâne",
+  "întoarce",
+  "oraş",
+  "să-şi",
+  "contează",
+  "auzi",
+  "prietenul",
+  "ştiţi",
+  "așa",
+  "nume",
+  "frate",
+  "bărbat",
+  "chestia",
+  "astăzi",
+  "familie",
+  "las",
+  "pleca",
+  "taci",
+  "întâmpla",
+  "spatele",
+  "domnul",
+  "copiii",
+  "încerc",
+  "mers",
+  "său",
+  "vreme",
+  "ştiam",
+  "pace",
+  "mersi",
+  "ajut",
+  "întorc",
+  "fiica",
+  "iti",
+  "an",
+  "le-am",
+  "deloc",
+  "motiv",
+  "john",
+  "pui",
+  "minte",
+  "întreb",
+  "înţelegi",
+  "oră",
+  "ţine",
+  "perfect",
+  "uita",
+  "mari",
+  "amândoi",
+  "știi",
+  "plecăm",
+  "sta",
+  "jack",
+  "erai",
+  "persoană",
+  "dupa",
+  "mâinile",
+  "ieşi",
+  "devreme",
+  "muncă",
+  "parcă",
+  "sora",
+  "fă",
+  "gândesc",
+  "rămas",
+  "fericit",
+  "amintesc",
+  "plac",
+  "sigură",
+  "revedere",
+  "dl",
+  "dimineaţa",
+  "mică",
+  "fiindcă",
+  "prost",
+  "acelaşi",
+  "vină",
+  "naibii",
+  "putin",
+  "urma",
+  "sună",
+  "vreţi",
+  "nebun",
+  "arma",
+  "buni",
+  "aduc",
+  "jumătate",
+  "sânge",
+  "intrat",
+  "ţi-ai",
+  "spune-i",
+  "sun",
+  "aud",
+  "acestea",
+  "moarte",
+  "dvs",
+  "cunoscut",
+  "numărul",
+  "restul",
+  "găsesc",
+  "undeva",
+  "mi-ar",
+  "faptul",
+  "cerut",
+  "asupra",
+  "pa",
+  "aduce",
+  "zic",
+  "doamna",
+  "drept",
+  "cumva",
+  "aflat",
+  "ah",
+  "momentul",
+  "vadă",
+  "jur",
+  "fim",
+  "toti",
+  "poliţia",
+  "luăm",
+  "drăguţ",
+  "ce-ai",
+  "sam",
+  "vreun",
+  "vrem",
+  "afara",
+  "ultimul",
+  "sa-l",
+  "moartea",
+  "echipa",
+  "întâi",
+  "care-i",
+  "genul",
+  "il",
+  "foc",
+  "dă",
+  "uneori",
+  "altfel",
+  "ştiut",
+  "stat",
+  "unele",
+  "acela",
+  "înăuntru",
+  "deschide",
+  "ati",
+  "pur",
+  "scris",
+  "abia",
+  "clar",
+  "trece",
+  "reuşit",
+  "ţi",
+  "dea",
+  "schimbat",
+  "dimineaţă",
+  "new",
+  "altcineva",
+  "uşa",
+  "prietenii",
+  "ii",
+  "devenit",
+  "ieri",
+  "dori",
+  "aibă",
+  "pământ",
+  "the",
+  "cameră",
+  "amice",
+  "tuturor",
+  "sex",
+  "afla",
+  "femei",
+  "frică",
+  "totuşi",
+  "sale",
+  "folosit",
+  "vorbeşte",
+  "normal",
+  "liber",
+  "într-adevăr",
+  "uit",
+  "intră",
+  "lasă",
+  "sfârşit",
+  "voiam",
+  "soţul",
+  "băiat",
+  "săptămâni",
+  "ăştia",
+  "l-au",
+  "încât",
+  "multă",
+  "greşit",
+  "război",
+  "milioane",
+  "găsim",
+  "trecută",
+  "ci",
+  "ideea",
+  "biroul",
+  "vazut",
+  "închisoare",
+  "v-am",
+  "exista",
+  "regula",
+  "pat",
+  "plus",
+  "întâlnit",
+  "muri",
+  "amuzant",
+  "sa-ti",
+  "zice",
+  "spital",
+  "arăţi",
+  "jurul",
+  "lovit",
+  "spună",
+  "suficient",
+  "trage",
+  "şansă",
+  "doctor",
+  "plăcere",
+  "draga",
+  "alea",
+  "domnilor",
+  "direct",
+  "petrecere",
+  "oricine",
+  "plăcut",
+  "felul",
+  "gura",
+  "ochi",
+  "ucide",
+  "traducerea",
+  "telefonul",
+  "special",
+  "şcoală",
+  "munca",
+  "niste",
+  "omorât",
+  "încerca",
+  "dispărut",
+  "voastră",
+  "întâlnire",
+  "unii",
+  "cheamă",
+  "haideţi",
+  "şase",
+  "ieşit",
+  "fara",
+  "complet",
+  "dragoste",
+  "zece",
+  "povestea",
+  "niciodata",
+  "sincer",
+  "arăt",
+  "dreapta",
+  "laşi",
+  "scrie",
+  "opri",
+  "unu",
+  "obicei",
+  "dumneavoastră",
+  "viitoare",
+  "vechi",
+  "aştept",
+  "îti",
+  "fugi",
+  "minut",
+  "însă",
+  "afaceri",
+  "ţie",
+  "plăcea",
+  "michael",
+  "şti",
+  "mâncare",
+  "dă-i",
+  "ajung",
+  "picioare",
+  "anul",
+  "schimb",
+  "întrebare",
+  "aer",
+  "atâta",
+  "charlie",
+  "puternic",
+  "toţii",
+  "rămâi",
+  "aminteşti",
+  "furat",
+  "intra",
+  "ajutorul",
+  "cafea",
+  "vad",
+  "promit",
+  "poveste",
+  "frank",
+  "scuză-mă",
+  "gândeam",
+  "deoarece",
+  "treci",
+  "toata",
+  "lucrez",
+  "luptă",
+  "film",
+  "întrebat",
+  "prietene",
+  "cat",
+  "anume",
+  "mamei",
+  "plece",
+  "bineînţeles",
+  "sa-i",
+  "mână",
+  "mor",
+  "vedere",
+  "iubito",
+  "seară",
+  "pana",
+  "dăm",
+  "întrebări",
+  "inca",
+  "dreptul",
+  "ceilalţi",
+  "lupta",
+  "sa-mi",
+  "apa",
+  "caut",
+  "voie",
+  "george",
+  "lucrat",
+  "săptămână",
+  "le-a",
+  "doctore",
+  "personal",
+  "agent",
+  "joe",
+  "tom",
+  "dracului",
+  "femeia",
+  "super",
+  "fete",
+  "sã",
+  "ajute",
+  "cunoşti",
+  "puterea",
+  "căpitane",
+  "birou",
+  "david",
+  "pregătit",
+  "mike",
+  "celor",
+  "york",
+  "adaptarea",
+  "mesaj",
+  "omoare",
+  "prietena",
+  "meargă",
+  "gândeşti",
+  "doresc",
+  "dor",
+  "staţi",
+  "cui",
+  "masina",
+  "absolut",
+  "aceeaşi",
+  "acele",
+  "persoane",
+  "accident",
+  "fiind",
+  "sunteti",
+  "dl.",
+  "crimă",
+  "părinţii",
+  "evident",
+  "mi-au",
+  "simte",
+  "pierde",
+  "l",
+  "încerci",
+  "oamenilor",
+  "ordine",
+  "domnului",
+  "spunem",
+  "schimba",
+  "ţin",
+  "uiţi",
+  "noua",
+  "stare",
+  "mici",
+  "continuă",
+  "învăţat",
+  "rând",
+  "salvat",
+  "ce-a",
+  "băiatul",
+  "trimite",
+  "plan",
+  "stă",
+  "caută",
+  "speriat",
+  "folosi",
+  "urăsc",
+  "planul",
+  "fiule",
+  "m-au",
+  "suna",
+  "închis",
+  "m",
+  "stie",
+  "foame",
+  "citit",
+  "secret",
+  "lucrează",
+  "omor",
+  "clipă",
+  "ţii",
+  "mulțumesc",
+  "simţit",
+  "privire",
+  "cauţi",
+  "presupun",
+  "văzut-o",
+  "opreşte-te",
+  "masă",
+  "alta",
+};
+const uint16_t WA_FREQ_135_RANKS[] = {
+  0, 0, 0, 0, 508, 0, 307, 0, 798, 0, 838, 0, 613, 0, 896, 900,
+  534, 105, 133, 783, 946, 0, 303, 0, 0, 800, 651, 819, 0, 0, 289, 0,
+  0, 0, 0, 167, 258, 316, 636, 62, 889, 538, 0, 0, 0, 0, 189, 0,
+  0, 0, 0, 0, 716, 0, 815, 437, 920, 293, 0, 0, 0, 146, 356, 747,
+  878, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 405, 740, 867, 875, 0,
+  860, 0, 257, 463, 0, 0, 0, 0, 0, 888, 0, 0, 0, 0, 0, 372,
+  44, 69, 367, 57, 205, 79, 47, 143, 261, 130, 239, 509, 572, 677, 546, 213,
+  461, 845, 0, 0, 176, 0, 0, 0, 72, 933, 0, 240, 0, 305, 175, 690,
+  406, 0, 642, 0, 322, 339, 310, 939, 0, 457, 53, 730, 758, 287, 550, 909,
+  0, 0, 0, 0, 0, 190, 0, 0, 718, 0, 529, 504, 668, 765, 0, 368,
+  0, 724, 0, 0, 0, 0, 0, 0, 0, 0, 913, 43, 183, 780, 947, 142,
+  814, 967, 603, 0, 0, 0, 818, 0, 0, 0, 186, 507, 789, 0, 820, 633,
+  691, 518, 0, 680, 579, 755, 0, 485, 0, 223, 0, 0, 0, 0, 0, 0,
+  86, 645, 0, 0, 0, 76, 890, 612, 0, 0, 0, 0, 150, 277, 278, 0,
+  0, 0, 0, 314, 536, 0, 0, 0, 0, 0, 385, 640, 950, 975, 0, 0,
+  562, 0, 311, 0, 0, 64, 425, 0, 0, 0, 0, 0, 0, 500, 112, 778,
+  0, 22, 787, 544, 721, 0, 0, 0, 0, 627, 904, 0, 960, 513, 479, 0,
+  0, 807, 903, 334, 0, 0, 638, 879, 0, 628, 148, 0, 0, 0, 0, 0,
+  751, 510, 657, 446, 941, 0, 0, 0, 515, 116, 421, 784, 1000, 0, 0, 793,
+  218, 192, 200, 0, 0, 0, 0, 0, 0, 254, 619, 0, 36, 0, 0, 586,
+  0, 0, 866, 994, 0, 0, 0, 417, 296, 323, 456, 328, 379, 673, 959, 567,
+  0, 0, 0, 931, 962, 719, 0, 0, 0, 0, 467, 607, 0, 0, 41, 101,
+  243, 0, 594, 45, 712, 577, 345, 0, 106, 268, 399, 0, 635, 0, 0, 0,
+  995, 0, 576, 0, 0, 604, 0, 0, 624, 622, 481, 701, 644, 411, 291, 465,
+  557, 207, 104, 841, 968, 587, 84, 611, 0, 0, 0, 0, 281, 552, 559, 929,
+  153, 0, 0, 0, 0, 0, 256, 526, 0, 0, 260, 654, 226, 0, 0, 0,
+  0, 0, 0, 470, 835, 429, 0, 0, 0, 0, 0, 0, 0, 448, 639, 0,
+  0, 0, 581, 11, 656, 0, 0, 0, 249, 0, 0, 0, 0, 149, 462, 338,
+  0, 177, 540, 329, 849, 400, 605, 0, 0, 0, 0, 961, 670, 0, 917, 0,
+  0, 0, 0, 0, 744, 377, 0, 0, 37, 435, 317, 0, 0, 0, 905, 0,
+  0, 0, 0, 0, 0, 0, 542, 0, 0, 0, 0, 247, 503, 658, 391, 168,
+  852, 162, 280, 873, 160, 228, 344, 679, 739, 3, 165, 982, 0, 894, 90, 238,
+  493, 825, 0, 927, 0, 0, 0, 996, 0, 294, 857, 0, 0, 0, 0, 270,
+  131, 434, 0, 0, 0, 0, 0, 0, 31, 0, 23, 737, 0, 350, 547, 0,
+  0, 0, 8, 0, 707, 0, 315, 0, 0, 0, 0, 0, 0, 949, 0, 242,
+  0, 56, 672, 0, 0, 0, 0, 759, 0, 0, 444, 0, 0, 0, 0, 431,
+  811, 325, 761, 0, 992, 0, 0, 0, 0, 0, 839, 0, 0, 0, 0, 0,
+  404, 0, 172, 0, 788, 0, 0, 0, 0, 0, 863, 0, 937, 0, 0, 843,
+  0, 0, 109, 0, 886, 0, 0, 0, 771, 59, 203, 573, 250, 308, 647, 75,
+  473, 0, 0, 0, 0, 795, 779, 166, 881, 596, 902, 0, 61, 0, 0, 217,
+  769, 984, 0, 0, 0, 511, 489, 0, 125, 455, 970, 846, 0, 0, 0, 609,
+  0, 26, 0, 0, 899, 154, 0, 0, 0, 0, 0, 0, 528, 89, 928, 0,
+  0, 49, 103, 398, 0, 0, 0, 119, 0, 0, 0, 0, 0, 989, 0, 0,
+  0, 652, 0, 887, 127, 235, 370, 439, 487, 610, 0, 0, 0, 0, 0, 0,
+  0, 171, 0, 0, 0, 0, 71, 614, 817, 0, 0, 28, 530, 0, 33, 38,
+  132, 427, 0, 0, 77, 0, 0, 527, 667, 0, 0, 0, 0, 0, 0, 666,
+  681, 601, 0, 0, 0, 0, 0, 450, 531, 0, 0, 0, 0, 0, 0, 225,
+  128, 371, 629, 773, 0, 0, 0, 0, 0, 0, 295, 301, 74, 349, 660, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 0, 208, 0, 0, 194,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 97, 0, 0, 0, 259, 0, 0,
+  0, 4, 0, 777, 0, 801, 0, 0, 0, 735, 543, 630, 748, 85, 198, 0,
+  697, 0, 309, 318, 0, 720, 0, 0, 0, 438, 0, 67, 392, 537, 0, 0,
+  99, 330, 363, 355, 191, 262, 340, 631, 674, 763, 0, 517, 407, 590, 736, 0,
+  251, 0, 0, 0, 0, 0, 0, 0, 0, 0, 785, 276, 731, 0, 269, 0,
+  0, 0, 2, 120, 215, 966, 402, 617, 979, 0, 0, 0, 107, 246, 231, 945,
+  0, 0, 361, 342, 282, 0, 514, 0, 0, 0, 0, 0, 0, 709, 799, 0,
+  0, 585, 856, 0, 0, 0, 373, 0, 625, 0, 0, 0, 180, 0, 0, 0,
+  138, 0, 0, 0, 608, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 82,
+  477, 583, 702, 870, 0, 0, 0, 891, 0, 0, 872, 910, 178, 265, 738, 0,
+  854, 0, 901, 711, 288, 0, 0, 0, 0, 0, 0, 0, 753, 0, 0, 0,
+  0, 694, 319, 710, 0, 0, 0, 836, 0, 932, 0, 0, 0, 0, 897, 164,
+  0, 0, 0, 568, 0, 19, 501, 561, 895, 998, 0, 0, 0, 244, 0, 976,
+  0, 362, 83, 248, 440, 495, 659, 0, 0, 973, 0, 0, 0, 0, 0, 0,
+  0, 0, 689, 91, 0, 858, 490, 0, 0, 775, 337, 63, 428, 549, 808, 0,
+  16, 312, 0, 0, 0, 0, 0, 418, 0, 0, 214, 0, 423, 0, 0, 0,
+  0, 346, 0, 0, 0, 0, 0, 0, 520, 0, 548, 87, 197, 0, 486, 0,
+  0, 0, 0, 833, 535, 6, 353, 560, 924, 0, 0, 102, 233, 460, 693, 803,
+  0, 0, 100, 786, 0, 0, 52, 145, 0, 0, 0, 951, 0, 0, 221, 341,
+  505, 230, 826, 842, 620, 906, 187, 0, 20, 0, 574, 741, 0, 0, 136, 545,
+  182, 0, 0, 0, 0, 0, 121, 0, 708, 0, 0, 0, 0, 0, 0, 15,
+  241, 0, 0, 499, 40, 267, 762, 859, 0, 0, 92, 634, 695, 0, 299, 912,
+  0, 692, 0, 0, 0, 0, 452, 828, 0, 0, 0, 0, 0, 0, 115, 686,
+  0, 0, 0, 0, 408, 571, 0, 0, 488, 0, 0, 0, 942, 55, 0, 0,
+  564, 0, 0, 0, 222, 880, 117, 958, 0, 918, 0, 1, 224, 589, 700, 938,
+  821, 0, 0, 853, 0, 0, 0, 725, 723, 963, 18, 0, 454, 713, 991, 0,
+  0, 0, 386, 985, 0, 0, 54, 664, 756, 0, 272, 480, 987, 0, 749, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 68, 443, 0, 0, 0, 0, 0, 147,
+  0, 0, 0, 0, 81, 327, 459, 742, 0, 599, 0, 0, 0, 173, 0, 597,
+  665, 0, 347, 0, 0, 0, 0, 591, 0, 0, 766, 0, 0, 649, 0, 255,
+  163, 556, 954, 0, 0, 141, 360, 491, 898, 0, 0, 0, 158, 0, 0, 0,
+  0, 0, 358, 940, 796, 0, 0, 442, 0, 151, 729, 412, 0, 0, 94, 0,
+  48, 0, 65, 0, 232, 0, 51, 745, 375, 0, 0, 410, 0, 0, 0, 0,
+  365, 275, 502, 525, 0, 447, 0, 0, 0, 331, 0, 0, 0, 264, 430, 122,
+  553, 0, 0, 0, 0, 732, 0, 0, 936, 39, 426, 88, 623, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 210, 381, 496, 0, 876, 0, 0, 0, 0, 0,
+  35, 478, 0, 432, 637, 396, 219, 0, 0, 862, 0, 0, 284, 874, 0, 0,
+  0, 0, 943, 283, 201, 387, 715, 682, 977, 0, 570, 321, 0, 0, 0, 0,
+  451, 563, 0, 0, 0, 0, 471, 0, 0, 137, 422, 714, 956, 174, 95, 971,
+  0, 0, 582, 580, 441, 110, 655, 0, 930, 0, 0, 0, 0, 0, 0, 704,
+  498, 524, 46, 0, 0, 413, 433, 685, 791, 236, 273, 306, 0, 0, 774, 0,
+  0, 0, 0, 983, 907, 134, 184, 335, 376, 588, 0, 383, 792, 0, 0, 25,
+  565, 687, 781, 506, 152, 357, 812, 336, 776, 813, 883, 0, 0, 274, 750, 925,
+  512, 864, 978, 0, 935, 0, 0, 324, 0, 0, 806, 0, 468, 0, 409, 0,
+  195, 0, 0, 0, 0, 0, 0, 0, 96, 206, 0, 0, 0, 0, 351, 0,
+  0, 0, 0, 764, 0, 366, 0, 0, 0, 0, 135, 922, 332, 827, 0, 0,
+  12, 78, 108, 234, 297, 584, 17, 809, 393, 0, 397, 797, 0, 0, 0, 0,
+  453, 0, 263, 0, 118, 464, 662, 0, 727, 352, 0, 0, 0, 290, 616, 0,
+  0, 0, 919, 266, 0, 271, 684, 9, 521, 73, 532, 419, 743, 847, 237, 974,
+  993, 869, 575, 683, 948, 0, 0, 0, 0, 0, 0, 193, 286, 0, 703, 0,
+  70, 885, 0, 0, 0, 0, 0, 663, 424, 144, 988, 728, 648, 0, 0, 632,
+  0, 0, 757, 0, 0, 0, 0, 911, 717, 0, 0, 848, 705, 734, 754, 0,
+  0, 161, 66, 388, 834, 0, 0, 0, 185, 0, 0, 0, 382, 0, 27, 696,
+  861, 0, 0, 199, 541, 188, 921, 0, 0, 964, 0, 326, 934, 831, 0, 0,
+  0, 111, 566, 7, 93, 0, 0, 0, 0, 155, 156, 804, 0, 0, 0, 0,
+  0, 0, 0, 403, 0, 0, 211, 139, 824, 0, 0, 0, 0, 653, 0, 0,
+  0, 0, 0, 14, 0, 494, 42, 374, 726, 865, 389, 0, 746, 671, 58, 882,
+  923, 997, 0, 0, 0, 908, 0, 770, 0, 676, 0, 30, 0, 0, 0, 0,
+  0, 0, 0, 0, 466, 0, 0, 0, 0, 0, 0, 0, 0, 469, 472, 752,
+  855, 519, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 698, 790, 0, 98,
+  782, 0, 816, 0, 699, 0, 169, 292, 522, 0, 0, 837, 384, 643, 0, 300,
+  621, 0, 0, 892, 0, 0, 0, 0, 0, 844, 60, 0, 0, 955, 678, 170,
+  0, 359, 877, 0, 0, 0, 0, 0, 21, 0, 0, 0, 598, 0, 646, 497,
+  113, 0, 0, 0, 378, 0, 0, 830, 302, 0, 0, 304, 0, 0, 688, 641,
+  0, 0, 0, 129, 539, 986, 0, 0, 0, 0, 868, 554, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 401, 810, 5, 179, 0, 760, 313, 380,
+  871, 0, 952, 0, 593, 474, 0, 0, 0, 0, 0, 551, 483, 972, 0, 415,
+  626, 915, 0, 482, 484, 245, 212, 884, 0, 0, 916, 123, 159, 953, 0, 445,
+  0, 0, 348, 661, 0, 0, 0, 0, 926, 999, 0, 0, 0, 0, 0, 802,
+  0, 0, 202, 805, 706, 893, 458, 476, 0, 0, 0, 0, 0, 285, 516, 600,
+  0, 0, 124, 555, 650, 0, 0, 181, 569, 229, 10, 354, 24, 822, 523, 0,
+  0, 0, 220, 0, 0, 0, 140, 0, 279, 0, 0, 832, 0, 364, 13, 0,
+  533, 618, 595, 914, 0, 0, 0, 0, 675, 980, 0, 0, 0, 615, 0, 0,
+  395, 0, 369, 840, 0, 0, 0, 606, 0, 0, 80, 0, 0, 0, 227, 252,
+  944, 0, 965, 0, 0, 29, 0, 0, 343, 0, 0, 722, 772, 851, 34, 50,
+  253, 204, 414, 420, 0, 196, 558, 209, 436, 475, 602, 733, 957, 0, 394, 0,
+  0, 333, 990, 0, 829, 157, 850, 0, 0, 767, 592, 0, 0, 669, 0, 298,
+  0, 0, 0, 0, 449, 492, 126, 216, 416, 578, 981, 0, 114, 0, 0, 794,
+  0, 0, 0, 0, 0, 823, 0, 0, 0, 0, 320, 390, 969, 0, 0, 0,
+};
+
+const char *WA_FREQ_136_TOKENS[] = {
+  "я",
+  "не",
+  "что",
+  "в",
+  "и",
+  "ты",
+  "это",
+  "на",
+  "с",
+  "он",
+  "мы",
+  "как",
+  "вы",
+  "да",
+  "мне",
+  "у",
+  "нет",
+  "меня",
+  "так",
+  "но",
+  "а",
+  "его",
+  "все",
+  "она",
+  "тебя",
+  "о",
+  "если",
+  "за",
+  "бы",
+  "тебе",
+  "они",
+  "чтобы",
+  "же",
+  "есть",
+  "просто",
+  "из",
+  "к",
+  "для",
+  "ну",
+  "когда",
+  "хорошо",
+  "здесь",
+  "по",
+  "был",
+  "знаю",
+  "то",
+  "только",
+  "всё",
+  "было",
+  "вас",
+  "может",
+  "нас",
+  "вот",
+  "от",
+  "быть",
+  "кто",
+  "будет",
+  "почему",
+  "вам",
+  "их",
+  "очень",
+  "могу",
+  "уже",
+  "спасибо",
+  "или",
+  "нам",
+  "еще",
+  "там",
+  "нужно",
+  "сейчас",
+  "где",
+  "чем",
+  "хочу",
+  "ничего",
+  "этого",
+  "была",
+  "мой",
+  "ее",
+  "ладно",
+  "знаешь",
+  "п",
+  "до",
+  "этом",
+  "потому",
+  "теперь",
+  "думаю",
+  "больше",
+  "её",
+  "со",
+  "раз",
+  "ему",
+  "надо",
+  "время",
+  "этот",
+  "ли",
+  "ещё",
+  "пока",
+  "даже",
+  "привет",
+  "сказал",
+  "себя",
+  "должен",
+  "тоже",
+  "хочешь",
+  "давай",
+  "что-то",
+  "никогда",
+  "эй",
+  "того",
+  "тогда",
+  "него",
+  "ни",
+  "тут",
+  "были",
+  "конечно",
+  "правда",
+  "об",
+  "моя",
+  "пожалуйста",
+  "тобой",
+  "сказать",
+  "сегодня",
+  "один",
+  "лучше",
+  "можешь",
+  "сюда",
+  "мной",
+  "значит",
+  "сделать",
+  "всегда",
+  "дело",
+  "можно",
+  "ей",
+  "должны",
+  "порядке",
+  "без",
+  "день",
+  "том",
+  "буду",
+  "делать",
+  "хотел",
+  "чего",
+  "эти",
+  "много",
+  "после",
+  "этим",
+  "всего",
+  "во",
+  "твой",
+  "ним",
+  "лет",
+  "боже",
+  "них",
+  "сэр",
+  "ведь",
+  "мистер",
+  "жизнь",
+  "потом",
+  "ней",
+  "такой",
+  "который",
+  "всех",
+  "через",
+  "им",
+  "возможно",
+  "немного",
+  "такое",
+  "слишком",
+  "себе",
+  "зачем",
+  "должна",
+  "моей",
+  "люди",
+  "знаете",
+  "этой",
+  "думаешь",
+  "свою",
+  "точно",
+  "человек",
+  "твоя",
+  "под",
+  "сказала",
+  "назад",
+  "из-за",
+  "эту",
+  "можем",
+  "случилось",
+  "мама",
+  "мог",
+  "вместе",
+  "отец",
+  "сделал",
+  "мои",
+  "кажется",
+  "друг",
+  "куда",
+  "никто",
+  "поэтому",
+  "эта",
+  "которые",
+  "два",
+  "тот",
+  "сколько",
+  "понимаю",
+  "снова",
+  "жизни",
+  "нравится",
+  "людей",
+  "помочь",
+  "видел",
+  "люблю",
+  "хочет",
+  "место",
+  "знать",
+  "кто-то",
+  "прости",
+  "отлично",
+  "похоже",
+  "парень",
+  "домой",
+  "всем",
+  "деньги",
+  "иди",
+  "времени",
+  "дома",
+  "именно",
+  "доктор",
+  "думал",
+  "говорил",
+  "делаешь",
+  "будем",
+  "прямо",
+  "стоит",
+  "поговорить",
+  "найти",
+  "разве",
+  "слушай",
+  "своей",
+  "лишь",
+  "ага",
+  "можете",
+  "простите",
+  "хотела",
+  "сам",
+  "что-нибудь",
+  "тем",
+  "будешь",
+  "прошу",
+  "три",
+  "деле",
+  "хотите",
+  "говорить",
+  "давайте",
+  "совсем",
+  "знал",
+  "знает",
+  "какой",
+  "моего",
+  "скажи",
+  "дом",
+  "дела",
+  "вами",
+  "свои",
+  "ж",
+  "говорит",
+  "несколько",
+  "должно",
+  "про",
+  "ваш",
+  "происходит",
+  "жаль",
+  "туда",
+  "действительно",
+  "папа",
+  "завтра",
+  "оно",
+  "черт",
+  "одна",
+  "перед",
+  "наш",
+  "уверен",
+  "отсюда",
+  "нужна",
+  "самом",
+  "тех",
+  "нужен",
+  "свой",
+  "мою",
+  "кого",
+  "верно",
+  "работу",
+  "каждый",
+  "твоей",
+  "будут",
+  "хватит",
+  "понял",
+  "нее",
+  "уж",
+  "имя",
+  "против",
+  "кое-что",
+  "пор",
+  "чём",
+  "раньше",
+  "говорю",
+  "более",
+  "надеюсь",
+  "итак",
+  "при",
+  "ваша",
+  "вообще",
+  "пошли",
+  "мать",
+  "нельзя",
+  "наверное",
+  "нами",
+  "твои",
+  "могли",
+  "дай",
+  "ради",
+  "всю",
+  "ребята",
+  "ко",
+  "хотя",
+  "понимаешь",
+  "идти",
+  "этих",
+  "откуда",
+  "такая",
+  "ясно",
+  "другой",
+  "извините",
+  "вижу",
+  "видеть",
+  "над",
+  "могут",
+  "равно",
+  "мисс",
+  "скоро",
+  "будто",
+  "зовут",
+  "виду",
+  "наши",
+  "думала",
+  "послушай",
+  "между",
+  "своего",
+  "вопрос",
+  "этому",
+  "почти",
+  "года",
+  "человека",
+  "которая",
+  "подожди",
+  "руки",
+  "нормально",
+  "такие",
+  "возьми",
+  "минут",
+  "извини",
+  "вещи",
+  "могла",
+  "смотри",
+  "хоть",
+  "работа",
+  "пару",
+  "сын",
+  "ваше",
+  "дня",
+  "пора",
+  "неё",
+  "жить",
+  "видишь",
+  "достаточно",
+  "господи",
+  "быстро",
+  "твою",
+  "весь",
+  "убить",
+  "ночь",
+  "говоришь",
+  "собой",
+  "скажу",
+  "готов",
+  "слышал",
+  "какая",
+  "посмотри",
+  "первый",
+  "самое",
+  "видела",
+  "пусть",
+  "месте",
+  "нашли",
+  "сказали",
+  "плохо",
+  "смогу",
+  "ваши",
+  "отца",
+  "детей",
+  "знаем",
+  "рад",
+  "прав",
+  "никаких",
+  "имею",
+  "миссис",
+  "иногда",
+  "смерти",
+  "своих",
+  "пойду",
+  "брат",
+  "вроде",
+  "рядом",
+  "мир",
+  "произошло",
+  "которую",
+  "сделала",
+  "говорила",
+  "знала",
+  "мое",
+  "одного",
+  "таким",
+  "помощь",
+  "такого",
+  "кем",
+  "насчет",
+  "вчера",
+  "случае",
+  "увидеть",
+  "нашей",
+  "говорят",
+  "правильно",
+  "убил",
+  "одно",
+  "пойти",
+  "друга",
+  "сама",
+  "долго",
+  "работать",
+  "дверь",
+  "делает",
+  "женщина",
+  "важно",
+  "кроме",
+  "будь",
+  "собираюсь",
+  "вашей",
+  "нужны",
+  "здорово",
+  "номер",
+  "проблема",
+  "проблемы",
+  "денег",
+  "чёрт",
+  "хороший",
+  "твоего",
+  "одну",
+  "дальше",
+  "вернуться",
+  "давно",
+  "последний",
+  "ночи",
+  "узнать",
+  "уверена",
+  "машину",
+  "права",
+  "пять",
+  "моих",
+  "также",
+  "тому",
+  "вечером",
+  "дети",
+  "опять",
+  "вообще-то",
+  "серьезно",
+  "работает",
+  "своим",
+  "сначала",
+  "две",
+  "одной",
+  "моим",
+  "те",
+  "жена",
+  "думаете",
+  "помнишь",
+  "глаза",
+  "ними",
+  "чувак",
+  "ночью",
+  "чувствую",
+  "взять",
+  "сразу",
+  "утром",
+  "часть",
+  "придется",
+  "стать",
+  "идея",
+  "дорогая",
+  "прекрасно",
+  "слова",
+  "сделали",
+  "видели",
+  "наша",
+  "сердце",
+  "помню",
+  "парня",
+  "момент",
+  "утро",
+  "здравствуйте",
+  "стал",
+  "скорее",
+  "ох",
+  "большой",
+  "кто-нибудь",
+  "часов",
+  "год",
+  "друзья",
+  "сильно",
+  "говори",
+  "смысле",
+  "которой",
+  "уйти",
+  "которого",
+  "капитан",
+  "работы",
+  "любовь",
+  "дочь",
+  "новый",
+  "боюсь",
+  "имеет",
+  "стой",
+  "дней",
+  "той",
+  "голову",
+  "ах",
+  "столько",
+  "понятно",
+  "дать",
+  "девушка",
+  "довольно",
+  "доме",
+  "вечер",
+  "оба",
+  "пойдем",
+  "увидимся",
+  "шанс",
+  "хорошая",
+  "прежде",
+  "сделаю",
+  "какого",
+  "быстрее",
+  "понять",
+  "рассказать",
+  "вашего",
+  "бог",
+  "интересно",
+  "затем",
+  "умер",
+  "обо",
+  "никого",
+  "парни",
+  "самый",
+  "твое",
+  "вон",
+  "пришел",
+  "чтоб",
+  "поверить",
+  "слово",
+  "будете",
+  "нашел",
+  "милая",
+  "странно",
+  "какие",
+  "ой",
+  "та",
+  "однажды",
+  "сможешь",
+  "получить",
+  "обычно",
+  "ума",
+  "полагаю",
+  "алло",
+  "посмотреть",
+  "иначе",
+  "наших",
+  "тело",
+  "хотели",
+  "свое",
+  "пришли",
+  "моё",
+  "другие",
+  "выглядит",
+  "подумал",
+  "лицо",
+  "приятно",
+  "мам",
+  "говорите",
+  "обратно",
+  "нашего",
+  "телефон",
+  "мире",
+  "честь",
+  "господин",
+  "доброе",
+  "план",
+  "другом",
+  "час",
+  "джон",
+  "пути",
+  "делал",
+  "типа",
+  "посмотрим",
+  "насколько",
+  "пытался",
+  "правду",
+  "решил",
+  "поздно",
+  "нем",
+  "работе",
+  "любит",
+  "хотят",
+  "кому",
+  "сестра",
+  "какой-то",
+  "места",
+  "кого-то",
+  "скажешь",
+  "следующий",
+  "других",
+  "получил",
+  "кстати",
+  "говорили",
+  "пришла",
+  "безопасности",
+  "рада",
+  "когда-нибудь",
+  "город",
+  "внимание",
+  "кофе",
+  "которое",
+  "вся",
+  "семья",
+  "конец",
+  "позже",
+  "дал",
+  "думать",
+  "спать",
+  "вернулся",
+  "остаться",
+  "некоторые",
+  "кровь",
+  "оружие",
+  "пришлось",
+  "хуже",
+  "дорогой",
+  "полиция",
+  "сможем",
+  "понимаете",
+  "четыре",
+  "которых",
+  "ужасно",
+  "ждать",
+  "способ",
+  "делаю",
+  "готовы",
+  "совершенно",
+  "смотреть",
+  "вернусь",
+  "большое",
+  "единственный",
+  "вперед",
+  "часа",
+  "где-то",
+  "муж",
+  "идет",
+  "таких",
+  "ребенка",
+  "машина",
+  "стороны",
+  "смог",
+  "сына",
+  "играть",
+  "сами",
+  "верю",
+  "честно",
+  "нашла",
+  "звучит",
+  "угодно",
+  "как-то",
+  "руку",
+  "начала",
+  "перевод",
+  "какое",
+  "взял",
+  "станет",
+  "пытаюсь",
+  "внутри",
+  "знали",
+  "новости",
+  "добрый",
+  "подождите",
+  "скажите",
+  "ребенок",
+  "вашу",
+  "мальчик",
+  "осталось",
+  "делаете",
+  "году",
+  "мере",
+  "поняла",
+  "отношения",
+  "далеко",
+  "вокруг",
+  "хотим",
+  "слышала",
+  "двух",
+  "приятель",
+  "никому",
+  "мужчина",
+  "неделю",
+  "вернуть",
+  "смерть",
+  "сих",
+  "ту",
+  "сможет",
+  "the",
+  "дайте",
+  "двое",
+  "видите",
+  "долларов",
+  "крови",
+  "решение",
+  "путь",
+  "следует",
+  "неужели",
+  "около",
+  "готова",
+  "семьи",
+  "идем",
+  "смотрите",
+  "круто",
+  "история",
+  "вдруг",
+  "спросить",
+  "i",
+  "твоих",
+  "второй",
+  "вина",
+  "джек",
+  "женщины",
+  "нашу",
+  "заткнись",
+  "минуту",
+  "собираешься",
+  "твоим",
+  "шоу",
+  "прощения",
+  "больно",
+  "машины",
+  "пап",
+  "трудно",
+  "постоянно",
+  "поможет",
+  "проблем",
+  "например",
+  "дерьмо",
+  "полиции",
+  "начать",
+  "знают",
+  "лучший",
+  "добро",
+  "спасти",
+  "рождения",
+  "оставить",
+  "чарли",
+  "любишь",
+  "конце",
+  "забыл",
+  "месяцев",
+  "часто",
+  "мило",
+  "комнате",
+  "нему",
+  "матери",
+  "милый",
+  "полностью",
+  "школе",
+  "леди",
+  "серьёзно",
+  "убили",
+  "случай",
+  "джо",
+  "убийство",
+  "послушайте",
+  "посмотрите",
+  "пошел",
+  "никакого",
+  "сделаем",
+  "говоря",
+  "неплохо",
+  "использовать",
+  "прошлой",
+  "иду",
+  "узнал",
+  "прекрати",
+  "чуть",
+  "держи",
+  "невозможно",
+  "господа",
+  "слушайте",
+  "наше",
+  "машине",
+  "сэм",
+  "свет",
+  "образом",
+  "иметь",
+  "другое",
+  "другого",
+  "шесть",
+  "людям",
+  "погоди",
+  "имени",
+  "детка",
+  "недели",
+  "меньше",
+  "легко",
+  "крайней",
+  "девочка",
+  "придётся",
+  "мало",
+  "ненавижу",
+  "you",
+  "последние",
+  "насчёт",
+  "выглядишь",
+  "сообщение",
+  "думает",
+  "друзей",
+  "обещаю",
+  "агент",
+  "вместо",
+  "последнее",
+  "самого",
+  "настолько",
+  "ответ",
+  "детектив",
+  "понятия",
+  "родители",
+  "показать",
+  "поехали",
+  "стало",
+  "мэм",
+  "своими",
+  "всей",
+  "очевидно",
+  "помогите",
+  "маленький",
+  "школу",
+  "пожаловать",
+  "твоё",
+  "либо",
+  "забрать",
+  "прошло",
+  "особенно",
+  "имеешь",
+  "истории",
+  "эм",
+  "вопросы",
+  "большая",
+  "минутку",
+  "пол",
+  "остановить",
+  "чему",
+  "свидания",
+  "обязательно",
+  "городе",
+  "убийца",
+  "сделай",
+  "a",
+  "ваших",
+  "любви",
+  "спокойной",
+  "б",
+  "своё",
+  "мадам",
+  "идите",
+  "выйти",
+  "делают",
+  "немедленно",
+  "делай",
+  "возможность",
+  "человеком",
+  "бывает",
+  "ужин",
+  "моем",
+  "купить",
+  "позвонить",
+  "наконец",
+  "стала",
+  "любой",
+  "клянусь",
+  "смешно",
+  "абсолютно",
+  "всему",
+  "переводчики",
+  "забудь",
+  "секунду",
+  "выбор",
+  "тысяч",
+  "потерял",
+  "майкл",
+  "волнуйся",
+  "ноги",
+  "таком",
+  "настоящий",
+  "означает",
+  "встретиться",
+  "известно",
+  "работаю",
+  "замечательно",
+  "любом",
+  "оставь",
+  "связи",
+  "боль",
+  "выпить",
+  "представить",
+  "убийства",
+  "малыш",
+  "умерла",
+  "воды",
+  "окей",
+  "речь",
+  "хорошие",
+  "поводу",
+  "перестань",
+  "увидел",
+  "повезло",
+  "президент",
+  "мужик",
+  "которым",
+  "прошлом",
+  "дам",
+  "десять",
+  "умереть",
+  "поговорим",
+  "отцом",
+  "искать",
+  "тихо",
+  "оставил",
+  "пистолет",
+  "начал",
+  "сложно",
+  "города",
+  "неделе",
+  "хотелось",
+  "принять",
+  "историю",
+  "босс",
+  "держать",
+  "пойдём",
+  "подумала",
+  "фильм",
+  "слышишь",
+  "рано",
+  "удачи",
+  "еду",
+  "словно",
+  "причина",
+  "пришёл",
+  "э",
+  "компании",
+  "спокойно",
+  "работал",
+  "подумать",
+  "вести",
+  "вещь",
+  "брата",
+  "конца",
+  "получится",
+  "блин",
+  "право",
+  "ввиду",
+  "бога",
+  "по-моему",
+  "подарок",
+  "комнату",
+  "мира",
+  "успокойся",
+  "позволить",
+  "моему",
+  "идёт",
+  "самая",
+  "рассказал",
+  "курсе",
+  "намного",
+  "мистера",
+  "женщин",
+  "тяжело",
+  "ух",
+  "предложение",
+  "одним",
+};
+const uint16_t WA_FREQ_136_RANKS[] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 512, 970, 0, 0, 0, 0, 0, 0,
+  244, 760, 450, 718, 827, 216, 135, 745, 825, 0, 602, 243, 0, 596, 30, 177,
+  0, 0, 389, 111, 614, 661, 734, 583, 0, 0, 0, 697, 786, 0, 0, 0,
+  0, 347, 0, 343, 0, 0, 781, 309, 540, 311, 924, 245, 155, 927, 0, 0,
+  0, 0, 252, 763, 891, 490, 900, 0, 170, 533, 0, 0, 258, 303, 517, 123,
+  20, 172, 898, 938, 810, 416, 523, 26, 678, 0, 0, 0, 39, 759, 0, 0,
+  0, 378, 0, 11, 0, 0, 66, 384, 0, 0, 0, 0, 0, 0, 0, 431,
+  56, 144, 0, 0, 0, 0, 0, 0, 0, 197, 853, 0, 0, 0, 294, 318,
+  0, 0, 584, 0, 236, 582, 735, 0, 0, 0, 0, 0, 179, 274, 0, 0,
+  967, 529, 0, 413, 317, 799, 0, 922, 27, 305, 0, 0, 0, 0, 0, 0,
+  0, 561, 0, 0, 0, 874, 225, 897, 0, 0, 0, 0, 0, 164, 701, 751,
+  65, 0, 0, 138, 142, 0, 50, 0, 0, 0, 0, 0, 694, 0, 907, 997,
+  801, 0, 809, 895, 0, 0, 286, 33, 0, 0, 362, 130, 496, 182, 293, 917,
+  0, 63, 0, 0, 0, 64, 0, 239, 190, 0, 0, 420, 0, 0, 0, 958,
+  0, 0, 51, 0, 148, 0, 0, 0, 0, 731, 419, 0, 0, 0, 129, 275,
+  432, 835, 189, 0, 833, 143, 0, 60, 0, 816, 0, 0, 0, 0, 99, 426,
+  0, 0, 0, 0, 373, 361, 964, 0, 929, 184, 268, 695, 769, 175, 226, 178,
+  69, 0, 610, 456, 337, 302, 852, 715, 0, 0, 0, 0, 0, 502, 524, 598,
+  742, 910, 925, 43, 0, 0, 0, 0, 0, 0, 93, 932, 122, 0, 0, 0,
+  55, 0, 545, 54, 234, 0, 0, 965, 0, 0, 0, 904, 0, 0, 61, 0,
+  0, 0, 0, 0, 699, 0, 815, 0, 0, 0, 982, 363, 458, 497, 221, 723,
+  173, 0, 0, 0, 248, 0, 0, 0, 345, 0, 279, 427, 627, 52, 730, 995,
+  787, 38, 667, 465, 761, 954, 0, 104, 21, 126, 717, 0, 0, 587, 0, 559,
+  79, 0, 0, 0, 150, 644, 664, 0, 326, 0, 637, 382, 0, 0, 0, 24,
+  0, 0, 0, 322, 0, 0, 0, 0, 0, 0, 716, 0, 0, 0, 0, 0,
+  0, 491, 203, 790, 862, 327, 464, 875, 270, 703, 794, 894, 0, 682, 0, 0,
+  0, 807, 0, 0, 0, 0, 0, 0, 0, 180, 727, 460, 297, 0, 0, 208,
+  231, 400, 606, 802, 878, 899, 314, 968, 371, 121, 806, 784, 0, 0, 146, 552,
+  0, 0, 0, 75, 944, 59, 115, 0, 0, 391, 439, 324, 0, 0, 0, 0,
+  472, 0, 641, 834, 395, 0, 0, 462, 0, 387, 752, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 506, 0, 312, 0, 477, 0, 0, 0, 0, 0, 0,
+  0, 0, 348, 386, 0, 0, 0, 710, 725, 0, 0, 267, 687, 408, 601, 536,
+  955, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 826, 0, 0, 152,
+  952, 0, 0, 5, 185, 356, 573, 0, 0, 0, 0, 0, 0, 417, 53, 364,
+  712, 0, 836, 0, 36, 0, 563, 0, 276, 0, 0, 538, 0, 235, 0, 931,
+  0, 469, 0, 0, 839, 224, 0, 0, 242, 0, 211, 409, 636, 0, 864, 0,
+  0, 35, 74, 0, 0, 0, 0, 307, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 599, 698, 994, 0, 0, 0, 0, 406, 0, 0, 0, 403, 206, 793, 823,
+  882, 0, 0, 468, 0, 860, 96, 612, 530, 919, 474, 0, 0, 370, 112, 435,
+  728, 832, 510, 292, 296, 531, 868, 976, 81, 755, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 200, 145, 18, 45, 446, 499, 594, 509, 847, 990, 0,
+  367, 553, 679, 865, 939, 315, 0, 0, 0, 498, 581, 0, 0, 334, 789, 0,
+  113, 0, 199, 0, 0, 0, 0, 574, 747, 753, 255, 722, 0, 0, 516, 643,
+  732, 0, 934, 0, 0, 0, 0, 0, 107, 455, 263, 566, 851, 0, 0, 0,
+  495, 534, 692, 76, 0, 0, 0, 0, 867, 0, 0, 905, 132, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 767, 889, 841, 0, 519, 37, 191, 818, 0, 605,
+  0, 0, 0, 0, 0, 0, 0, 325, 775, 6, 0, 0, 780, 0, 0, 0,
+  0, 0, 0, 0, 0, 374, 0, 0, 0, 0, 0, 0, 358, 256, 411, 0,
+  0, 0, 10, 7, 782, 0, 94, 220, 166, 332, 418, 877, 357, 0, 830, 909,
+  153, 354, 943, 981, 0, 0, 0, 0, 281, 961, 0, 0, 0, 353, 444, 649,
+  652, 817, 0, 696, 973, 0, 0, 0, 650, 671, 828, 0, 726, 0, 15, 461,
+  0, 0, 869, 73, 935, 282, 0, 908, 896, 119, 0, 0, 0, 0, 0, 92,
+  437, 194, 0, 0, 0, 0, 23, 953, 0, 0, 14, 355, 0, 0, 505, 0,
+  848, 0, 471, 369, 246, 359, 901, 271, 0, 238, 803, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 685, 0, 128, 0, 0, 0, 0, 0, 0, 744, 595,
+  0, 379, 569, 892, 738, 0, 494, 915, 201, 489, 0, 0, 0, 49, 159, 441,
+  482, 749, 764, 838, 885, 551, 708, 0, 655, 0, 928, 0, 0, 0, 85, 0,
+  0, 0, 228, 299, 342, 941, 0, 0, 0, 666, 0, 0, 0, 617, 0, 0,
+  169, 0, 0, 0, 0, 0, 0, 0, 480, 0, 0, 0, 181, 291, 654, 0,
+  71, 247, 560, 0, 404, 0, 632, 0, 28, 978, 0, 570, 0, 520, 0, 0,
+  0, 0, 0, 0, 125, 0, 0, 945, 301, 0, 473, 0, 0, 0, 0, 0,
+  259, 963, 0, 0, 95, 0, 912, 0, 0, 0, 445, 916, 0, 0, 0, 368,
+  550, 425, 424, 758, 174, 819, 849, 921, 0, 120, 0, 209, 518, 702, 0, 0,
+  770, 0, 0, 141, 233, 521, 84, 660, 0, 796, 608, 683, 0, 0, 0, 290,
+  381, 688, 0, 0, 0, 0, 0, 0, 0, 681, 0, 0, 340, 223, 188, 588,
+  0, 335, 0, 503, 756, 528, 0, 0, 0, 349, 485, 156, 972, 980, 985, 285,
+  0, 544, 137, 429, 457, 0, 0, 0, 476, 217, 580, 0, 0, 0, 478, 0,
+  0, 0, 269, 16, 651, 0, 766, 0, 205, 820, 0, 0, 0, 186, 670, 0,
+  0, 0, 0, 0, 640, 109, 845, 999, 241, 0, 768, 0, 0, 78, 171, 266,
+  0, 48, 0, 0, 0, 0, 0, 70, 0, 522, 140, 0, 513, 625, 0, 0,
+  0, 0, 0, 0, 90, 151, 192, 713, 969, 0, 0, 515, 549, 0, 0, 0,
+  0, 0, 0, 0, 604, 714, 68, 986, 0, 618, 746, 1, 0, 0, 0, 647,
+  0, 0, 393, 0, 0, 0, 0, 467, 0, 0, 0, 0, 0, 0, 214, 4,
+  428, 447, 705, 603, 621, 774, 778, 576, 0, 0, 264, 106, 0, 0, 866, 0,
+  0, 0, 484, 0, 0, 0, 0, 788, 987, 0, 0, 0, 0, 0, 0, 257,
+  0, 757, 0, 704, 0, 0, 0, 237, 0, 0, 0, 300, 0, 0, 176, 0,
+  0, 0, 591, 0, 0, 558, 843, 846, 158, 884, 339, 562, 893, 0, 277, 0,
+  0, 3, 537, 656, 960, 616, 0, 0, 0, 0, 463, 0, 0, 440, 689, 260,
+  648, 0, 547, 0, 261, 555, 984, 813, 890, 29, 844, 0, 0, 0, 134, 940,
+  0, 646, 0, 47, 147, 567, 633, 0, 0, 0, 0, 0, 0, 733, 871, 487,
+  804, 0, 989, 0, 936, 77, 947, 0, 42, 565, 161, 346, 623, 673, 229, 0,
+  0, 0, 0, 0, 0, 0, 0, 542, 0, 824, 926, 600, 289, 0, 0, 9,
+  310, 0, 383, 0, 0, 0, 0, 230, 278, 750, 0, 0, 0, 331, 0, 593,
+  483, 0, 0, 0, 659, 589, 556, 883, 0, 0, 0, 0, 0, 0, 436, 672,
+  630, 771, 377, 0, 0, 0, 642, 736, 0, 0, 0, 0, 0, 956, 0, 0,
+  690, 707, 46, 0, 721, 0, 397, 423, 0, 110, 597, 0, 396, 2, 100, 585,
+  0, 0, 946, 0, 0, 80, 991, 0, 272, 546, 974, 136, 535, 0, 0, 72,
+  0, 414, 492, 792, 620, 0, 665, 514, 975, 0, 219, 942, 739, 320, 117, 543,
+  577, 748, 0, 0, 0, 0, 0, 998, 933, 795, 0, 198, 0, 0, 265, 887,
+  0, 0, 103, 0, 0, 0, 0, 0, 0, 0, 776, 0, 0, 365, 0, 0,
+  0, 0, 0, 0, 0, 58, 0, 114, 0, 0, 0, 0, 930, 0, 0, 475,
+  415, 308, 0, 863, 380, 0, 0, 0, 388, 0, 139, 344, 0, 0, 693, 0,
+  539, 850, 858, 680, 0, 187, 451, 0, 0, 149, 0, 280, 578, 0, 0, 0,
+  336, 0, 779, 316, 0, 572, 0, 0, 765, 0, 253, 0, 0, 0, 443, 0,
+  548, 0, 0, 102, 165, 319, 401, 657, 658, 773, 854, 0, 0, 0, 0, 0,
+  0, 948, 0, 0, 554, 634, 0, 0, 0, 0, 0, 0, 168, 0, 0, 822,
+  0, 0, 0, 0, 390, 0, 34, 251, 407, 422, 0, 67, 709, 105, 586, 0,
+  0, 831, 0, 0, 0, 0, 87, 993, 0, 0, 902, 0, 840, 0, 133, 0,
+  691, 0, 0, 0, 0, 0, 0, 0, 0, 88, 25, 44, 459, 0, 433, 0,
+  31, 284, 886, 920, 0, 0, 0, 0, 341, 89, 212, 0, 0, 0, 0, 394,
+  0, 0, 442, 0, 250, 405, 0, 466, 0, 0, 0, 0, 375, 0, 979, 329,
+  0, 0, 0, 0, 249, 0, 0, 8, 808, 0, 0, 619, 0, 98, 906, 0,
+  360, 631, 86, 0, 772, 0, 0, 352, 0, 0, 0, 0, 304, 453, 195, 579,
+  983, 0, 0, 971, 0, 0, 669, 202, 911, 0, 0, 0, 626, 306, 0, 210,
+  0, 493, 0, 0, 950, 338, 0, 996, 0, 0, 777, 0, 83, 486, 684, 741,
+  611, 923, 635, 0, 0, 0, 0, 0, 0, 0, 430, 0, 0, 452, 0, 0,
+  0, 313, 0, 0, 62, 0, 557, 193, 888, 0, 0, 213, 330, 511, 481, 686,
+  163, 837, 421, 0, 645, 0, 0, 0, 0, 0, 0, 525, 41, 0, 508, 622,
+  0, 811, 0, 0, 0, 0, 0, 0, 412, 629, 0, 0, 470, 0, 966, 754,
+  0, 0, 872, 0, 856, 376, 880, 903, 298, 0, 500, 0, 0, 0, 0, 0,
+  0, 613, 0, 0, 0, 0, 609, 674, 0, 254, 0, 0, 0, 17, 0, 0,
+  438, 526, 0, 607, 127, 222, 740, 962, 0, 0, 0, 0, 0, 0, 0, 232,
+  0, 0, 0, 0, 0, 366, 504, 0, 372, 0, 0, 167, 0, 615, 0, 398,
+  879, 0, 592, 676, 40, 677, 762, 0, 108, 183, 800, 913, 564, 0, 0, 0,
+  0, 873, 0, 0, 0, 0, 675, 0, 0, 724, 0, 857, 914, 283, 351, 842,
+  0, 0, 82, 19, 0, 0, 0, 881, 937, 479, 0, 262, 0, 0, 0, 0,
+  0, 101, 785, 32, 700, 116, 812, 0, 22, 628, 783, 861, 992, 118, 957, 333,
+  829, 0, 13, 876, 0, 0, 350, 0, 797, 1000, 0, 0, 287, 0, 0, 0,
+  590, 0, 0, 0, 0, 0, 855, 0, 0, 0, 959, 402, 131, 0, 0, 0,
+  663, 0, 918, 0, 0, 0, 0, 227, 0, 0, 0, 321, 295, 653, 0, 0,
+  0, 392, 541, 0, 805, 0, 0, 0, 0, 0, 196, 0, 0, 0, 0, 719,
+  0, 0, 0, 0, 0, 0, 0, 0, 218, 454, 0, 0, 0, 571, 0, 814,
+  0, 488, 0, 124, 0, 711, 0, 0, 240, 791, 859, 706, 57, 273, 949, 977,
+  624, 527, 668, 870, 0, 0, 0, 215, 0, 328, 0, 0, 0, 0, 97, 0,
+  288, 662, 0, 0, 0, 0, 0, 0, 160, 410, 532, 12, 638, 639, 323, 798,
+  0, 0, 0, 0, 0, 0, 720, 737, 449, 0, 162, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 743, 0, 0, 0, 448, 0, 0, 207, 385, 575, 91,
+  821, 507, 568, 157, 951, 988, 0, 399, 0, 0, 0, 154, 501, 204, 729, 434,
+};
+
+const char *WA_FREQ_137_TOKENS[] = {
+  "nga",
+  "n",
+  "omu",
+  "nti",
+  "era",
+  "abaana",
+  "abantu",
+  "oku",
+  "oba",
+  "muno",
+  "ebyanyegesya",
+  "e",
+  "okubba",
+  "omuntu",
+  "naye",
+  "kubanga",
+  "buli",
+  "omwana",
+  "ne",
+  "okuba",
+  "ya",
+  "aa",
+  "ate",
+  "mu",
+  "amwei",
+  "yange",
+  "ba",
+  "ku",
+  "aaa",
+  "kusai",
+  "engeri",
+  "amaizi",
+  "ni",
+  "omukitundu",
+  "ebintu",
+  "emmere",
+  "so",
+  "oyo",
+  "eka",
+  "okufuna",
+  "ekka",
+  "kyange",
+  "ati",
+  "ekyo",
+  "kyaiswe",
+  "kitundu",
+  "ebyo",
+  "okwaba",
+  "te",
+  "eyo",
+  "amwe",
+  "emirimu",
+  "omusaiza",
+  "okulya",
+  "alina",
+  "bwa",
+  "o",
+  "okumanya",
+  "okusoma",
+  "boona",
+  "okubanga",
+  "awo",
+  "aba",
+  "bya",
+  "okugeza",
+  "bwala",
+  "na",
+  "mbe",
+  "ka",
+  "kuba",
+  "olina",
+  "obulwaire",
+  "okusobola",
+  "nka",
+  "enkola",
+  "kubba",
+  "wa",
+  "omubiri",
+  "nadala",
+  "kisai",
+  "za",
+  "byanyegesya",
+  "edi",
+  "haa",
+  "lwa",
+  "abandi",
+  "okukola",
+  "ng",
+  "no",
+  "amagezi",
+  "okwendya",
+  "bona",
+  "masomero",
+  "mangu",
+  "amasomero",
+  "obuzibu",
+  "gwa",
+  "k",
+  "nkusobola",
+  "nina",
+  "lya",
+  "omweka",
+  "nikyo",
+  "mmere",
+  "nje",
+  "bwange",
+  "eni",
+  "baana",
+  "ebya",
+  "empiiya",
+  "eya",
+  "ebyanjawulo",
+  "maiso",
+  "omulimu",
+  "abba",
+  "sente",
+  "okubona",
+  "buni",
+  "omusujja",
+  "byona",
+  "ekitundu",
+  "ebiseera",
+  "ebindi",
+  "niyo",
+  "muntu",
+  "bange",
+  "bini",
+  "byange",
+  "isatu",
+  "bantu",
+  "ngeri",
+  "ezanjawulo",
+  "endwaire",
+  "kini",
+  "obwomi",
+  "kyona",
+  "okuboneka",
+  "ayina",
+  "naba",
+  "kale",
+  "okwewala",
+  "somero",
+  "tulina",
+  "ee",
+  "oluvanyuma",
+  "aahh",
+  "yona",
+  "yeena",
+  "okusai",
+  "zini",
+  "kyalo",
+  "nikwo",
+  "abo",
+  "oli",
+  "naddala",
+  "baiswe",
+  "emere",
+  "nk",
+  "ezo",
+  "gavumenti",
+  "okunywa",
+  "akusobola",
+  "bakusobola",
+  "kusoma",
+  "singa",
+  "abasaiza",
+  "obwa",
+  "biyambire",
+  "myezi",
+  "ensonga",
+  "ekya",
+  "obwo",
+  "okola",
+  "ekyakabiri",
+  "ekintu",
+  "emirundi",
+  "amaani",
+  "nabba",
+  "kaseera",
+  "abaala",
+  "ndi",
+  "nsinga",
+  "nsiri",
+  "oyina",
+  "nsonga",
+  "olwa",
+  "maizi",
+  "obumanyisyo",
+  "nimba",
+  "kya",
+  "okwega",
+  "ndya",
+  "nimwo",
+  "nibyo",
+  "esente",
+  "bwona",
+  "waliwo",
+  "olunaku",
+  "zaiswe",
+  "ki",
+  "ga",
+  "nizo",
+  "nibabba",
+  "embeera",
+  "leke",
+  "nko",
+  "mubiri",
+  "oyinza",
+  "a",
+  "bingi",
+  "aka",
+  "yena",
+  "balina",
+  "enda",
+  "budi",
+  "kwa",
+  "ekindi",
+  "omuli",
+  "ago",
+  "obba",
+  "kimwei",
+  "ekyamazima",
+  "olyawo",
+  "omungeri",
+  "olwekyo",
+  "abakali",
+  "mwana",
+  "mirimu",
+  "nkola",
+  "edagala",
+  "bintu",
+  "kwaba",
+  "obulanga",
+  "obwingi",
+  "entambula",
+  "kiri",
+  "eee",
+  "mba",
+  "baba",
+  "zange",
+  "bafunire",
+  "haaa",
+  "saawa",
+  "okusomero",
+  "basobole",
+  "okwekeberesya",
+  "ababyaire",
+  "nabantu",
+  "omubiseera",
+  "bani",
+  "eza",
+  "ogwa",
+  "mwomi",
+  "ampi",
+  "agatali",
+  "yaiswe",
+  "abakulu",
+  "kimwe",
+  "omukali",
+  "omukazi",
+  "business",
+  "bakusoma",
+  "nyumirwa",
+  "omuno",
+  "tugeze",
+  "nobba",
+  "bakwaba",
+  "byaiswe",
+  "ezindi",
+  "okunaaba",
+  "okutandikawo",
+  "we",
+  "tte",
+  "gwamwei",
+  "kituufu",
+  "okuzwa",
+  "nda",
+  "ekidukano",
+  "amaiso",
+  "abamwe",
+  "nijo",
+  "odi",
+  "enyembo",
+  "baingi",
+  "ali",
+  "abasawu",
+  "babba",
+  "bwabwe",
+  "nibo",
+  "oni",
+  "lunaku",
+  "ebifo",
+  "ndowo",
+  "obwoomi",
+  "okwakala",
+  "tuli",
+  "noba",
+  "dwaliro",
+  "omungalo",
+  "omugaso",
+  "waamu",
+  "niye",
+  "binyambire",
+  "ebikusinga",
+  "buzibu",
+  "enaku",
+  "abakulembeze",
+  "ekikusooka",
+  "omumasomero",
+  "tuyina",
+  "omwirwaro",
+  "emirumu",
+  "okuzwala",
+  "katimba",
+  "bisiisa",
+  "abato",
+  "then",
+  "olusi",
+  "olwaleero",
+  "byabwe",
+  "gasai",
+  "gayonjo",
+  "omumaiso",
+  "kwendya",
+  "ebisai",
+  "biyambireku",
+  "omudwaliro",
+  "omwekka",
+  "nsi",
+  "ke",
+  "aga",
+  "emwei",
+  "abanjawulo",
+  "eeeh",
+  "maani",
+  "ebizibu",
+  "obwire",
+  "zaabwe",
+  "deni",
+  "bitundu",
+  "kiki",
+  "mulimu",
+  "omupiira",
+  "ndoowo",
+  "esimu",
+  "mpozi",
+  "bamukago",
+  "nduma",
+  "yamwei",
+  "ye",
+  "mbeera",
+  "okusinga",
+  "egindi",
+  "bwaala",
+  "ziri",
+  "nolwekyo",
+  "yoona",
+  "omubitundu",
+  "omukyala",
+  "akasente",
+  "owa",
+  "tukusobola",
+  "obusiisa",
+  "bwaiswe",
+  "lwaki",
+  "mambya",
+  "nkwaba",
+  "omwogo",
+  "biseera",
+  "okukolesya",
+  "empiya",
+  "enjunzai",
+  "ntambula",
+  "mukaaga",
+  "gabba",
+  "omubifo",
+  "bwojo",
+  "olwo",
+  "abakusinga",
+  "abamwei",
+  "okukwatibwa",
+  "nyinza",
+  "abasomesa",
+  "nabanga",
+  "ani",
+  "katonda",
+  "yuganda",
+  "mwogo",
+  "obulumi",
+  "ensiri",
+  "obwenkanya",
+  "amasanyalaze",
+  "wamu",
+  "ogwo",
+  "ayinza",
+  "banywi",
+  "kulya",
+  "obuli",
+  "bakufuna",
+  "emeere",
+  "okutwala",
+  "ebiri",
+  "okutumbula",
+  "omwei",
+  "wamwei",
+  "nabo",
+  "gaba",
+  "gani",
+  "gwona",
+  "ekyamisana",
+  "bali",
+  "kiseera",
+  "nkwendya",
+  "yamu",
+  "zingi",
+  "obutwa",
+  "oikendi",
+  "muto",
+  "okumuwa",
+  "wange",
+  "ti",
+  "nabaana",
+  "oluusi",
+  "abakazi",
+  "kidukano",
+  "uum",
+  "engoye",
+  "akwaba",
+  "government",
+  "okusanga",
+  "osanga",
+  "nfunire",
+  "nindya",
+  "okutandika",
+  "bisai",
+  "omwe",
+  "ha",
+  "byoona",
+  "gyensinga",
+  "zensinga",
+  "nkyali",
+  "esaawa",
+  "eddagala",
+  "ebba",
+  "isaatu",
+  "noyaba",
+  "mwezi",
+  "emikago",
+  "bazenya",
+  "njeena",
+  "ebyetaago",
+  "ewaiswe",
+  "okwo",
+  "omukisa",
+  "okusomesya",
+  "eziri",
+  "okubaza",
+  "kintu",
+  "okwewola",
+  "bwire",
+  "mukitundu",
+  "erina",
+  "ebisinga",
+  "obwanjawulo",
+  "afuna",
+  "ansi",
+  "agali",
+  "ddwaliro",
+  "amatai",
+  "asobole",
+  "okwetangira",
+  "emambya",
+  "okanca",
+  "akyali",
+  "yabwe",
+  "myaka",
+  "omunda",
+  "nayaba",
+  "bank",
+  "kufuna",
+  "kukola",
+  "yamwe",
+  "nigyo",
+  "uumm",
+  "omwala",
+  "njawulo",
+  "yete",
+  "emisomo",
+  "ekisai",
+  "muli",
+  "iswe",
+  "lususu",
+  "okuura",
+  "mweka",
+  "obuyonjo",
+  "ensi",
+  "aboojo",
+  "nke",
+  "ddala",
+  "afunire",
+  "kikulu",
+  "nekindi",
+  "obwegesye",
+  "kyoona",
+  "nibasobola",
+  "omunkola",
+  "yaamu",
+  "ebiro",
+  "okasasiro",
+  "etasyera",
+  "nguudo",
+  "akasubba",
+  "ko",
+  "emyezi",
+  "owondi",
+  "munoo",
+  "okuluga",
+  "nayenga",
+  "bajuti",
+  "bulamu",
+  "abeegi",
+  "yo",
+  "obu",
+  "nibaba",
+  "obundi",
+  "kakyarumwei",
+  "kunywa",
+  "okudukana",
+  "gasumbe",
+  "gwamu",
+  "olwansonga",
+  "obuwangwa",
+  "amaka",
+  "nyaba",
+  "obworo",
+  "okkola",
+  "aganjawulo",
+  "akaita",
+  "kaita",
+  "endweire",
+  "babe",
+  "okuwa",
+  "abatakwesobola",
+  "bba",
+  "kasasiro",
+  "bizinesi",
+  "nyendya",
+  "akairika",
+  "eibanga",
+  "zabwe",
+  "bwomi",
+  "ebirowoozo",
+  "gyisai",
+  "maka",
+  "batera",
+  "okolesya",
+  "osobola",
+  "okutambula",
+  "olwakubba",
+  "basomere",
+  "kiyambire",
+  "omumbeera",
+  "iswena",
+  "booda",
+  "boda",
+  "ddagala",
+  "bubba",
+  "nobanga",
+  "kolera",
+  "njena",
+  "biki",
+  "atenga",
+  "ibiri",
+  "bijunire",
+  "okunsonga",
+  "amangu",
+  "bonkai",
+  "bulwaire",
+  "akawunga",
+  "obulabe",
+  "osirimu",
+  "nywena",
+  "siriimu",
+  "wabula",
+  "kasita",
+  "ebikumbanirwamu",
+  "famire",
+  "asomere",
+  "uganda",
+  "ekizimba",
+  "kyandi",
+  "nkolesya",
+  "piki",
+  "gwange",
+  "emyaka",
+  "nasobola",
+  "ebicaafu",
+  "gwamwe",
+  "luvanyuma",
+  "nsobola",
+  "esatu",
+  "mwaka",
+  "okwitirana",
+  "akapiira",
+  "nokufuna",
+  "ab",
+  "kizibu",
+  "babwe",
+  "nibwo",
+  "obuvunanyizibwa",
+  "oggeza",
+  "emizenyo",
+  "omunsi",
+  "eri",
+  "eriwo",
+  "emabega",
+  "obutaba",
+  "gali",
+  "nebindi",
+  "kukolesya",
+  "gyabwe",
+  "mwiniki",
+  "niko",
+  "okulwala",
+  "bukyali",
+  "kyandibaire",
+  "tukwaba",
+  "ob",
+  "eeh",
+  "obo",
+  "okwongera",
+  "atete",
+  "okukuuma",
+  "bwamu",
+  "nijjo",
+  "olugendo",
+  "obusai",
+  "dala",
+  "okwegesebwa",
+  "kyabwe",
+  "ntera",
+  "biyata",
+  "ebitundu",
+  "ako",
+  "okansa",
+  "eyina",
+  "ebiyata",
+  "basome",
+  "egisai",
+  "engalo",
+  "abone",
+  "onyamwanga",
+  "bbe",
+  "bakwatibwa",
+  "kyamu",
+  "enkolesya",
+  "kola",
+  "kanca",
+  "gona",
+  "obutandwa",
+  "enzira",
+  "okunkango",
+  "bibinja",
+  "beegere",
+  "jindi",
+  "abasomere",
+  "akulya",
+  "okujanjaba",
+  "iye",
+  "lwakuba",
+  "kituffu",
+  "emikaago",
+  "nkufuna",
+  "bayina",
+  "yonkai",
+  "obubonero",
+  "anywereire",
+  "inai",
+  "tuyinza",
+  "akubba",
+  "kiyambireku",
+  "akufuna",
+  "abali",
+  "ebitabu",
+  "okwisomero",
+  "bwananyini",
+  "akati",
+  "nibafuna",
+  "munywani",
+  "omwo",
+  "obusuume",
+  "okufa",
+  "empisa",
+  "obumwei",
+  "agasai",
+  "kibba",
+  "kikusobola",
+  "butyai",
+  "amagulu",
+  "ogeza",
+  "okusooka",
+  "bafuna",
+  "gange",
+  "bakumanya",
+  "vitamini",
+  "nkumanya",
+  "bisoboire",
+  "kuliku",
+  "omwirwalo",
+  "kyensinga",
+  "nimala",
+  "kawunga",
+  "abakugu",
+  "omusawu",
+  "obwiire",
+  "buba",
+  "omuceere",
+  "y",
+  "byalo",
+  "egyanjawulo",
+  "omubantu",
+  "okunaba",
+  "bituyambireku",
+  "ebisale",
+  "ayabe",
+  "asome",
+  "byongeire",
+  "ndwaire",
+  "okwelalikira",
+  "akutoonya",
+  "okusula",
+  "enkaito",
+  "omukugu",
+  "bbanka",
+  "ebyoloni",
+  "sabiti",
+  "nkoleserye",
+  "kasubba",
+  "obukerwa",
+  "akuura",
+  "munsi",
+  "omwomi",
+  "nyembo",
+  "omubazi",
+  "abaira",
+  "eisatu",
+  "abbe",
+  "okusinzira",
+  "bwamwei",
+  "wamwe",
+  "goona",
+  "nemba",
+  "enkulakulana",
+  "jange",
+  "wena",
+  "mukisa",
+  "abakyala",
+  "nigo",
+  "mumaiso",
+  "oinza",
+  "baabwe",
+  "nebintu",
+  "be",
+  "byanjawulo",
+  "tuba",
+  "yadde",
+  "basangire",
+  "fiizi",
+  "endowooza",
+  "okuyambaku",
+  "basaiza",
+  "omubintu",
+  "takusobola",
+  "agatalimu",
+  "wanu",
+  "talina",
+  "school",
+  "fees",
+  "okwa",
+  "omunsonga",
+  "okumanyisibwa",
+  "ekyakkola",
+  "omukifo",
+  "ekiyonjo",
+  "binyambireku",
+  "gindi",
+  "guni",
+  "okusinziira",
+  "kyaigolo",
+  "ekyaigolo",
+  "ekyamambya",
+  "umm",
+  "musanju",
+  "lyona",
+  "okwika",
+  "emirembe",
+  "okkolesya",
+  "obuvumu",
+  "ekituffu",
+  "okwiza",
+  "bo",
+  "gonza",
+  "okwegesya",
+  "enyegesya",
+  "okwata",
+  "ikumi",
+  "omuirwaro",
+  "amatooke",
+  "esomero",
+  "okukyalo",
+  "neba",
+  "kituyambaku",
+  "tubba",
+  "obwongo",
+  "mmm",
+  "tayina",
+  "ekikusookera",
+  "kubbi",
+  "pikipiki",
+  "okwe",
+  "okatonda",
+  "okwiawo",
+  "obwita",
+  "bikuni",
+  "ebbiizineesi",
+  "bendera",
+  "elangi",
+  "ayaba",
+  "omwenkanonkano",
+  "agayonjo",
+  "bakola",
+  "okwiiza",
+  "akola",
+  "banka",
+  "bayonjo",
+  "nzibiika",
+  "ekyalo",
+  "munsonga",
+  "abanadiini",
+  "nafuna",
+  "asomereku",
+  "nengeri",
+  "byenda",
+  "ennaku",
+  "kisigikira",
+  "mupiira",
+  "gya",
+  "ma",
+  "iyee",
+  "obulamu",
+  "nokumanya",
+  "egyisai",
+  "bibiina",
+  "obujanjabi",
+  "omuto",
+  "mabega",
+  "aiguru",
+  "ebisera",
+  "okusasaana",
+  "bwamwe",
+  "mulwaire",
+  "basinga",
+  "eirai",
+  "olw",
+  "bakubba",
+  "omukusoma",
+  "okubawa",
+  "eba",
+  "nekintu",
+  "ekirigiraku",
+  "ababyere",
+  "abazadde",
+  "ebimwei",
+  "bbo",
+  "ebimwe",
+  "z",
+  "niwesanga",
+  "natandika",
+  "bwingi",
+  "obusisa",
+  "dagala",
+  "galina",
+  "galimu",
+  "okuwamu",
+  "kyete",
+  "bizibu",
+  "nokuba",
+  "okuleeta",
+  "pressure",
+  "okubiika",
+  "bikwaba",
+  "kyakuboneraku",
+  "jingi",
+  "okweega",
+  "oyaba",
+  "magulu",
+  "okusumba",
+  "balya",
+  "obusobozi",
+  "ekyasingire",
+  "okwemeera",
+  "eizire",
+  "nyo",
+  "ogyikolesya",
+  "nekka",
+  "tukolesya",
+  "wondi",
+  "iguru",
+  "omukubi",
+  "kaba",
+  "ebiyaata",
+  "bowa",
+  "sirimu",
+  "busaiza",
+  "kansa",
+  "katugeze",
+  "erimu",
+  "bityo",
+  "bakulu",
+  "basoboire",
+  "ente",
+  "beega",
+  "bituyambire",
+  "okwetandikirawo",
+  "ebiyinza",
+  "ebi",
+  "kyakubaire",
+  "okwetangiramu",
+  "okulwanisya",
+  "okuyamba",
+  "mukyala",
+  "omulumu",
+  "oo",
+  "myeezi",
+  "okwirayo",
+  "bibba",
+  "kiba",
+  "omwezi",
+  "tibalina",
+  "obukugu",
+  "ekivuga",
+  "buliizo",
+  "sukaali",
+  "sizoni",
+  "okwekuuma",
+  "ebijanjaalo",
+  "ebibi",
+  "ekyakukola",
+  "obulimu",
+  "motoka",
+  "zoona",
+  "nasomere",
+  "bideero",
+  "kusaba",
+  "mutimbagano",
+  "gi",
+  "kiyonjo",
+  "ensuwa",
+  "olunkusense",
+  "bakwega",
+  "ebyadembe",
+  "takairika",
+  "mpola",
+  "okutunga",
+  "ebirime",
+  "ebizinensi",
+  "genyinza",
+  "kwegamba",
+  "gawa",
+  "tinyabangaku",
+  "nkulowooza",
+  "ebbanga",
+  "omusawo",
+  "musawo",
+  "yenkai",
+  "egyo",
+  "eryo",
+  "kisobola",
+  "omukaaga",
+  "kisinzira",
+  "bi",
+  "nakobere",
+  "amawuro",
+  "egyindi",
+  "gyona",
+  "ejanjawulo",
+  "nzibika",
+  "bakwiza",
+  "bu",
+  "omukintu",
+  "omwirwaliro",
+  "omubizibu",
+  "babwala",
+  "tukola",
+  "kikwiza",
+  "obona",
+  "eneyakalya",
+  "atandika",
+  "gyenyiza",
+  "gyoyinza",
+};
+const uint16_t WA_FREQ_137_RANKS[] = {
+  0, 0, 452, 891, 545, 0, 986, 0, 59, 296, 0, 698, 607, 0, 0, 0,
+  0, 0, 0, 588, 950, 0, 0, 0, 683, 328, 837, 869, 0, 393, 0, 882,
+  0, 0, 946, 218, 0, 131, 772, 0, 568, 759, 0, 207, 0, 0, 582, 0,
+  0, 0, 0, 0, 311, 0, 0, 473, 0, 0, 20, 914, 0, 0, 0, 0,
+  0, 0, 989, 753, 912, 901, 0, 0, 609, 0, 485, 0, 440, 3, 123, 574,
+  600, 122, 245, 781, 0, 107, 0, 153, 0, 680, 741, 641, 461, 909, 0, 849,
+  0, 561, 0, 0, 0, 0, 952, 992, 0, 516, 0, 0, 984, 0, 0, 567,
+  0, 674, 0, 968, 0, 872, 0, 577, 0, 0, 169, 0, 0, 0, 622, 631,
+  719, 0, 272, 191, 0, 881, 0, 24, 0, 0, 350, 363, 463, 231, 475, 678,
+  794, 0, 0, 113, 0, 548, 0, 0, 43, 0, 557, 0, 0, 0, 0, 335,
+  0, 0, 0, 210, 581, 312, 0, 106, 0, 973, 0, 0, 999, 386, 0, 184,
+  168, 599, 0, 124, 994, 0, 443, 855, 902, 0, 0, 0, 0, 0, 761, 0,
+  0, 934, 0, 0, 590, 0, 199, 0, 0, 500, 951, 13, 501, 962, 885, 677,
+  685, 76, 803, 993, 0, 647, 0, 0, 0, 0, 0, 170, 0, 0, 0, 0,
+  286, 769, 0, 0, 78, 0, 0, 0, 432, 0, 0, 0, 0, 823, 0, 0,
+  640, 450, 132, 433, 529, 645, 820, 252, 171, 238, 108, 233, 650, 0, 0, 0,
+  0, 49, 0, 748, 0, 489, 0, 478, 0, 0, 0, 0, 236, 0, 0, 376,
+  90, 408, 920, 0, 157, 675, 260, 0, 0, 0, 0, 0, 0, 0, 936, 0,
+  0, 92, 979, 100, 0, 807, 0, 0, 812, 0, 0, 0, 0, 0, 0, 0,
+  899, 0, 0, 630, 933, 0, 206, 202, 0, 0, 0, 0, 77, 0, 0, 0,
+  176, 537, 864, 0, 0, 638, 290, 717, 0, 429, 448, 765, 0, 0, 338, 818,
+  965, 0, 0, 0, 713, 774, 0, 0, 0, 0, 0, 52, 627, 687, 569, 0,
+  0, 0, 0, 0, 0, 0, 0, 428, 0, 0, 0, 856, 620, 0, 0, 414,
+  879, 0, 0, 0, 0, 0, 654, 491, 778, 301, 341, 0, 0, 0, 256, 242,
+  0, 0, 816, 0, 925, 0, 5, 295, 907, 0, 704, 509, 401, 676, 0, 346,
+  0, 243, 0, 795, 249, 0, 611, 721, 136, 800, 0, 0, 838, 0, 0, 0,
+  652, 0, 498, 0, 0, 0, 269, 0, 608, 0, 0, 0, 0, 636, 524, 0,
+  0, 0, 0, 209, 0, 0, 0, 0, 0, 601, 133, 62, 81, 181, 327, 399,
+  534, 801, 905, 80, 579, 927, 0, 0, 185, 375, 580, 324, 451, 158, 160, 681,
+  758, 0, 490, 310, 880, 0, 0, 0, 0, 0, 0, 0, 0, 0, 605, 821,
+  0, 0, 0, 259, 223, 0, 0, 0, 720, 0, 560, 488, 340, 118, 357, 447,
+  583, 48, 4, 470, 480, 628, 227, 740, 929, 966, 0, 1, 644, 1000, 0, 0,
+  0, 137, 564, 462, 811, 0, 0, 481, 541, 0, 0, 413, 515, 0, 0, 0,
+  0, 336, 370, 0, 565, 947, 0, 211, 0, 0, 0, 531, 903, 138, 265, 799,
+  602, 0, 0, 0, 82, 125, 165, 732, 0, 0, 0, 195, 287, 477, 673, 188,
+  897, 120, 664, 904, 0, 844, 0, 7, 938, 83, 0, 35, 0, 0, 943, 0,
+  0, 0, 0, 0, 0, 987, 0, 0, 382, 155, 0, 0, 0, 419, 751, 2,
+  285, 444, 808, 867, 0, 0, 273, 0, 0, 668, 0, 0, 0, 0, 0, 887,
+  957, 709, 65, 271, 105, 0, 768, 0, 0, 0, 281, 0, 0, 921, 0, 614,
+  0, 512, 127, 201, 416, 0, 0, 0, 0, 0, 156, 0, 0, 377, 190, 0,
+  0, 0, 253, 0, 0, 0, 0, 586, 355, 99, 471, 368, 587, 649, 670, 728,
+  317, 525, 773, 782, 334, 390, 299, 783, 0, 237, 0, 876, 0, 0, 995, 0,
+  0, 0, 351, 0, 67, 288, 0, 0, 591, 0, 0, 0, 421, 178, 0, 0,
+  425, 0, 0, 873, 0, 101, 292, 0, 289, 0, 0, 542, 0, 0, 66, 551,
+  179, 656, 0, 589, 0, 0, 0, 572, 689, 941, 0, 0, 0, 0, 0, 550,
+  684, 0, 0, 0, 0, 653, 0, 247, 321, 0, 0, 0, 342, 0, 0, 466,
+  894, 884, 367, 908, 0, 982, 119, 225, 167, 23, 58, 825, 0, 0, 0, 0,
+  0, 0, 0, 366, 595, 701, 0, 0, 446, 915, 928, 0, 0, 0, 331, 919,
+  300, 0, 0, 760, 733, 0, 126, 0, 454, 10, 594, 0, 343, 404, 798, 789,
+  863, 945, 990, 804, 0, 974, 517, 978, 215, 0, 0, 0, 0, 0, 0, 0,
+  0, 57, 68, 570, 967, 144, 0, 0, 626, 0, 0, 0, 745, 0, 504, 314,
+  0, 539, 0, 344, 86, 42, 369, 546, 332, 0, 819, 0, 0, 0, 26, 472,
+  61, 0, 0, 861, 0, 0, 0, 453, 786, 0, 46, 284, 464, 868, 0, 0,
+  970, 0, 360, 0, 0, 0, 0, 0, 0, 847, 0, 584, 143, 505, 147, 0,
+  0, 251, 14, 0, 576, 708, 0, 0, 302, 0, 0, 0, 0, 387, 0, 858,
+  0, 0, 0, 0, 0, 832, 519, 0, 0, 538, 0, 200, 566, 890, 0, 0,
+  0, 0, 633, 0, 411, 309, 0, 36, 436, 878, 0, 0, 0, 0, 0, 796,
+  0, 0, 853, 511, 339, 686, 695, 0, 0, 0, 635, 854, 886, 0, 102, 145,
+  407, 0, 0, 149, 445, 834, 0, 140, 196, 0, 0, 492, 0, 575, 0, 830,
+  434, 969, 0, 11, 96, 0, 648, 585, 0, 543, 39, 104, 976, 549, 971, 723,
+  0, 0, 0, 883, 0, 0, 0, 0, 960, 0, 983, 0, 852, 0, 518, 0,
+  0, 0, 0, 734, 0, 0, 263, 0, 0, 0, 932, 279, 280, 0, 0, 0,
+  474, 0, 250, 510, 41, 596, 326, 839, 0, 0, 8, 735, 0, 981, 0, 0,
+  0, 130, 916, 0, 0, 362, 949, 727, 931, 142, 129, 963, 0, 150, 240, 264,
+  348, 388, 729, 0, 230, 972, 0, 442, 0, 642, 139, 0, 0, 606, 0, 0,
+  0, 379, 714, 0, 402, 621, 671, 0, 639, 784, 0, 0, 0, 0, 0, 0,
+  0, 790, 0, 0, 0, 276, 749, 841, 495, 0, 69, 706, 756, 0, 244, 85,
+  802, 0, 0, 0, 163, 843, 19, 197, 0, 418, 0, 0, 0, 0, 0, 135,
+  0, 0, 0, 930, 0, 770, 906, 523, 736, 0, 0, 0, 422, 315, 0, 94,
+  0, 0, 0, 0, 0, 103, 738, 0, 0, 0, 0, 426, 573, 0, 0, 456,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 958, 875, 846, 0, 217,
+  0, 214, 507, 0, 0, 0, 0, 0, 0, 0, 183, 0, 0, 0, 0, 0,
+  0, 0, 0, 406, 189, 998, 0, 0, 918, 0, 325, 0, 262, 0, 877, 624,
+  0, 0, 619, 0, 0, 0, 0, 0, 533, 305, 0, 0, 0, 690, 0, 777,
+  182, 617, 0, 0, 0, 0, 0, 0, 371, 730, 787, 37, 722, 0, 0, 97,
+  116, 0, 0, 0, 898, 0, 0, 0, 924, 718, 378, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 775, 0, 0, 79, 726, 743, 592, 0, 0, 0, 0, 0,
+  254, 0, 0, 204, 0, 483, 0, 0, 0, 0, 0, 502, 257, 940, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 248, 0, 0, 205, 361, 0, 318, 469, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 417, 50, 228, 381,
+  848, 175, 394, 913, 0, 17, 53, 208, 38, 752, 985, 0, 0, 779, 291, 0,
+  494, 308, 0, 860, 0, 0, 658, 0, 0, 0, 0, 0, 152, 809, 850, 682,
+  895, 0, 0, 0, 937, 0, 571, 762, 0, 0, 0, 0, 0, 73, 0, 134,
+  385, 0, 0, 0, 665, 0, 232, 597, 0, 0, 0, 824, 298, 0, 0, 623,
+  352, 0, 715, 0, 0, 0, 0, 657, 0, 372, 0, 0, 0, 0, 0, 0,
+  373, 0, 0, 888, 0, 0, 0, 28, 0, 303, 0, 0, 0, 313, 333, 0,
+  0, 161, 395, 297, 18, 857, 0, 826, 0, 0, 0, 0, 0, 400, 842, 922,
+  0, 0, 0, 0, 948, 0, 0, 959, 0, 791, 892, 0, 0, 0, 0, 724,
+  484, 353, 813, 697, 0, 173, 0, 0, 154, 0, 322, 833, 0, 0, 0, 0,
+  109, 506, 0, 0, 988, 27, 693, 0, 0, 0, 354, 0, 0, 0, 0, 764,
+  0, 72, 815, 0, 304, 345, 763, 0, 246, 198, 554, 0, 192, 391, 479, 746,
+  0, 0, 0, 0, 74, 0, 219, 663, 0, 0, 0, 166, 552, 603, 831, 0,
+  679, 0, 0, 277, 651, 0, 0, 0, 0, 0, 0, 216, 0, 117, 0, 0,
+  0, 0, 141, 669, 358, 16, 347, 0, 0, 0, 0, 536, 0, 0, 0, 0,
+  503, 0, 278, 31, 293, 319, 817, 0, 0, 828, 435, 975, 0, 0, 148, 865,
+  829, 0, 306, 0, 688, 0, 660, 0, 0, 0, 0, 0, 956, 0, 0, 0,
+  0, 692, 0, 457, 910, 29, 513, 604, 521, 0, 0, 486, 493, 520, 555, 702,
+  793, 954, 0, 0, 593, 9, 459, 0, 0, 63, 121, 496, 0, 356, 0, 0,
+  0, 234, 716, 771, 797, 0, 222, 859, 0, 0, 996, 0, 91, 694, 0, 0,
+  0, 187, 0, 0, 0, 0, 0, 193, 0, 374, 0, 151, 0, 112, 320, 364,
+  365, 268, 380, 482, 0, 0, 0, 0, 0, 742, 0, 0, 0, 415, 194, 349,
+  0, 224, 0, 0, 980, 0, 0, 0, 610, 0, 34, 0, 162, 397, 737, 667,
+  862, 0, 0, 0, 0, 530, 754, 871, 544, 547, 0, 0, 0, 0, 0, 0,
+  0, 0, 84, 12, 776, 0, 827, 437, 159, 900, 0, 845, 0, 323, 0, 0,
+  0, 556, 788, 0, 0, 409, 911, 266, 32, 110, 241, 0, 0, 526, 836, 0,
+  0, 0, 0, 0, 467, 699, 703, 0, 0, 0, 0, 0, 0, 0, 0, 532,
+  0, 851, 0, 0, 0, 439, 0, 0, 0, 0, 0, 0, 455, 0, 0, 420,
+  316, 186, 294, 874, 0, 0, 30, 559, 0, 0, 465, 0, 22, 0, 0, 458,
+  0, 261, 558, 0, 0, 0, 0, 0, 0, 659, 405, 712, 0, 0, 282, 0,
+  0, 0, 274, 0, 757, 392, 0, 87, 814, 870, 383, 615, 0, 0, 95, 0,
+  0, 220, 0, 258, 866, 21, 172, 889, 0, 0, 646, 0, 632, 0, 0, 0,
+  0, 423, 0, 0, 0, 0, 0, 780, 528, 562, 618, 468, 691, 750, 412, 0,
+  410, 424, 307, 508, 923, 700, 51, 213, 114, 0, 180, 964, 0, 0, 0, 0,
+  75, 430, 935, 0, 522, 805, 616, 0, 540, 33, 275, 527, 893, 221, 514, 98,
+  578, 164, 535, 953, 460, 0, 235, 0, 0, 212, 612, 64, 725, 441, 55, 60,
+  806, 0, 0, 0, 0, 174, 0, 0, 0, 0, 0, 497, 767, 0, 0, 449,
+  661, 0, 0, 0, 0, 696, 0, 0, 0, 598, 239, 0, 0, 0, 0, 283,
+  563, 0, 0, 0, 0, 45, 0, 0, 0, 398, 389, 203, 0, 0, 359, 431,
+  0, 0, 0, 270, 0, 0, 146, 71, 0, 0, 93, 666, 744, 766, 0, 0,
+  0, 0, 0, 0, 0, 553, 0, 0, 115, 0, 0, 0, 662, 991, 255, 427,
+  0, 0, 731, 0, 0, 88, 0, 384, 0, 917, 0, 0, 0, 0, 0, 0,
+  0, 177, 0, 711, 613, 128, 961, 0, 0, 0, 229, 0, 0, 438, 0, 6,
+  70, 329, 0, 0, 0, 0, 822, 25, 0, 939, 56, 476, 499, 403, 977, 47,
+  634, 707, 955, 330, 896, 0, 0, 672, 0, 0, 337, 625, 739, 0, 942, 0,
+  0, 0, 0, 0, 0, 267, 755, 0, 0, 0, 0, 0, 0, 15, 0, 0,
+  0, 40, 0, 0, 0, 637, 835, 0, 226, 0, 705, 0, 0, 747, 0, 111,
+  629, 0, 396, 0, 0, 0, 997, 44, 0, 0, 0, 0, 792, 0, 0, 655,
+  944, 0, 0, 0, 0, 0, 810, 54, 643, 785, 710, 840, 926, 0, 89, 487,
+};
+
+const char *WA_FREQ_138_TOKENS[] = {
+  "mu",
+  "ko",
+  "ku",
+  "ngo",
+  "ni",
+  "muri",
+  "na",
+  "ari",
+  "kandi",
+  "cyane",
+  "no",
+  "kuko",
+  "Rwanda",
+  "ariko",
+  "ya",
+  "yo",
+  "kuri",
+  "we",
+  "wa",
+  "aho",
+  "ndetse",
+  "ibyo",
+  "cyangwa",
+  "hari",
+  "neza",
+  "ati",
+  "nâ",
+  "uko",
+  "nta",
+  "kuba",
+  "se",
+  "avuga",
+  "gihe",
+  "umuntu",
+  "byo",
+  "icyo",
+  "kugira",
+  "iyo",
+  "uyu",
+  "buri",
+  "abantu",
+  "byose",
+  "iki",
+  "ubu",
+  "aba",
+  "Mu",
+  "mbere",
+  "Ni",
+  "nyuma",
+  "gusa",
+  "igihe",
+  "iyi",
+  "bwo",
+  "buryo",
+  "ntabwo",
+  "afite",
+  "gukora",
+  "cya",
+  "imbere",
+  "cyo",
+  "bafite",
+  "maze",
+  "niba",
+  "ahubwo",
+  "benshi",
+  "byinshi",
+  "nawe",
+  "u",
+  "wo",
+  "ubwo",
+  "munsi",
+  "yâ",
+  "bari",
+  "Ibi",
+  "yavuze",
+  "abana",
+  "abaturage",
+  "kubera",
+  "Perezida",
+  "bwa",
+  "umwana",
+  "byiza",
+  "ibi",
+  "umugore",
+  "Kagame",
+  "gahunda",
+  "ibintu",
+  "uwo",
+  "kujya",
+  "wese",
+  "Ati",
+  "harimo",
+  "bya",
+  "bo",
+  "rero",
+  "ikibazo",
+  "Uyu",
+  "Yagize",
+  "za",
+  "uburyo",
+  "yari",
+  "umwe",
+  "ufite",
+  "iri",
+  "bose",
+  "kuva",
+  "Imana",
+  "Njyewe-",
+  "ye",
+  "kubona",
+  "Ariko",
+  "nka",
+  "zo",
+  "kibazo",
+  "baba",
+  "ubuzima",
+  "umugabo",
+  "Gusa",
+  "abandi",
+  "mpamvu",
+  "kugeza",
+  "gihugu",
+  "amafaranga",
+  "Ibyo",
+  "rwose",
+  "imbaraga",
+  "koko",
+  "bavuga",
+  "igihugu",
+  "nubwo",
+  "si",
+  "Iyo",
+  "ibibazo",
+  "ndi",
+  "wanjye",
+  "wawe",
+  "n’ibindi",
+  "bikorwa",
+  "rwa",
+  "indwara",
+  "nanjye",
+  "buzima",
+  "kimwe",
+  "atari",
+  "Hari",
+  "tariki",
+  "muryango",
+  "yagize",
+  "umwanya",
+  "uri",
+  "Abanyarwanda",
+  "hano",
+  "Leta",
+  "yaba",
+  "agaciro",
+  "yawe",
+  "imyaka",
+  "mwana",
+  "bituma",
+  "wowe",
+  "inama",
+  "rwego",
+  "mwaka",
+  "Muri",
+  "kurya",
+  "agira",
+  "ubundi",
+  "kuvuga",
+  "Avuga",
+  "ukuri",
+  "bityo",
+  "vuba",
+  "usanga",
+  "ibikorwa",
+  "abo",
+  "ubushobozi",
+  "nari",
+  "Mama",
+  "bamwe",
+  "isi",
+  "amahirwe",
+  "2017",
+  "byari",
+  "amazi",
+  "ntacyo",
+  "umutima",
+  "be",
+  "hanze",
+  "kwa",
+  "Afurika",
+  "mbona",
+  "muntu",
+  "none",
+  "wâ",
+  "bana",
+  "nuko",
+  "Iki",
+  "akaba",
+  "Icyo",
+  "Ubwo",
+  "rusange",
+  "ngombwa",
+  "abagore",
+  "kumva",
+  "Ku",
+  "cyose",
+  "kureba",
+  "Ntabwo",
+  "2016",
+  "nyinshi",
+  "ba",
+  "uburenganzira",
+  "ka",
+  "Iyi",
+  "inyuma",
+  "undi",
+  "kugera",
+  "ashobora",
+  "rwo",
+  "yose",
+  "abanyarwanda",
+  "kumenya",
+  "uruhare",
+  "ikintu",
+  "Niba",
+  "bitandukanye",
+  "nk’uko",
+  "nziza",
+  "amakuru",
+  "amaze",
+  "gushaka",
+  "impamvu",
+  "kwiga",
+  "aya",
+  "biri",
+  "umuryango",
+  "hafi",
+  "hamwe",
+  "rugo",
+  "ahantu",
+  "babo",
+  "gufata",
+  "imirimo",
+  "mwiza",
+  "njye",
+  "bagomba",
+  "Sacha",
+  "agomba",
+  "kongera",
+  "bitewe",
+  "rimwe",
+  "bishobora",
+  "Ngo",
+  "aha",
+  "yacu",
+  "ababyeyi",
+  "biba",
+  "nabi",
+  "bikaba",
+  "ibindi",
+  "cyumweru",
+  "hagati",
+  "ifite",
+  "kubaka",
+  "nzu",
+  "Yesu",
+  "bwe",
+  "nkâ",
+  "y’u",
+  "umukobwa",
+  "yaje",
+  "gutera",
+  "menshi",
+  "n’abandi",
+  "gutanga",
+  "Nyuma",
+  "bantu",
+  "Paul",
+  "Dr",
+  "dufite",
+  "Ubu",
+  "imwe",
+  "yabwiye",
+  "numva",
+  "rya",
+  "Daddy",
+  "Nelson",
+  "i",
+  "iminsi",
+  "ahita",
+  "niyo",
+  "myaka",
+  "bamaze",
+  "bijyanye",
+  "Ese",
+  "gukomeza",
+  "ushaka",
+  "inshingano",
+  "urukundo",
+  "nayo",
+  "ayo",
+  "mugabo",
+  "cyâ",
+  "dore",
+  "Yakomeje",
+  "Kuri",
+  "akora",
+  "bajya",
+  "ingaruka",
+  "zitandukanye",
+  "byâ",
+  "Joy",
+  "kubaho",
+  "More",
+  "Read",
+  "bimwe",
+  "byaba",
+  "indirimbo",
+  "izi",
+  "myiza",
+  "nibwo",
+  "runaka",
+  "barimo",
+  "gikorwa",
+  "ho",
+  "mfite",
+  "ubumuga",
+  "FC",
+  "Ikindi",
+  "meza",
+  "kera",
+  "naho",
+  "nko",
+  "amateka",
+  "urubyiruko",
+  "witwa",
+  "Polisi",
+  "gufasha",
+  "wari",
+  "zâ",
+  "FPR",
+  "kure",
+  "noneho",
+  "uba",
+  "ushobora",
+  "Abantu",
+  "guteza",
+  "ajya",
+  "indi",
+  "mukino",
+  "agiye",
+  "ashaka",
+  "bwiza",
+  "bagiye",
+  "bakaba",
+  "imyenda",
+  "Papa",
+  "mubiri",
+  "yanjye",
+  "bagira",
+  "bikomeye",
+  "ikipe",
+  "kazi",
+  "Umuyobozi",
+  "bashobora",
+  "amagambo",
+  "ejo",
+  "zose",
+  "bitaro",
+  "iba",
+  "ibitekerezo",
+  "nibyo",
+  "mwanya",
+  "umubiri",
+  "w’imyaka",
+  "akazi",
+  "birimo",
+  "muganga",
+  "minsi",
+  "ubuyobozi",
+  "yabo",
+  "Uganda",
+  "bibazo",
+  "bihugu",
+  "cye",
+  "saa",
+  "gukoresha",
+  "nama",
+  "Nubwo",
+  "bihe",
+  "bwabo",
+  "urugero",
+  "uvuga",
+  "amaso",
+  "arimo",
+  "hejuru",
+  "kwita",
+  "inshuti",
+  "nabo",
+  "umukino",
+  "bwâ",
+  "icyizere",
+  "kabiri",
+  "yatangiye",
+  "umutekano",
+  "Kuba",
+  "bakwiye",
+  "miliyoni",
+  "muto",
+  "nkuru",
+  "ze",
+  "abagabo",
+  "akenshi",
+  "ibyiza",
+  "2015",
+  "Nta",
+  "njyewe",
+  "umusaruro",
+  "cg",
+  "ariyo",
+  "serivisi",
+  "ukora",
+  "hose",
+  "kwirinda",
+  "mugore",
+  "Kigali",
+  "Paul Kagame",
+  "bigatuma",
+  "gitaramo",
+  "kugaragaza",
+  "magambo",
+  "ndwara",
+  "nzi",
+  "™uko",
+  "imbabazi",
+  "umuco",
+  "Aha",
+  "kaminuza",
+  "zirimo",
+  "kunywa",
+  "twe",
+  "imaze",
+  "y’uko",
+  "ubumenyi",
+  "ubwoba",
+  "wabo",
+  "yombi",
+  "Bob",
+  "atangira",
+  "kwishyura",
+  "mpuzamahanga",
+  "10",
+  "bakora",
+  "by’umwihariko",
+  "gushyira",
+  "mpuzabitsina",
+  "ukuntu",
+  "yumva",
+  "abakinnyi",
+  "kuza",
+  "mazi",
+  "twari",
+  "azi",
+  "bagera",
+  "bifite",
+  "nabyo",
+  "nzira",
+  "shampiyona",
+  "uru",
+  "abona",
+  "giti",
+  "kurushaho",
+  "rushanwa",
+  "yitwa",
+  "bagenzi",
+  "bintu",
+  "n’uko",
+  "kenshi",
+  "Rayon",
+  "Umuseke",
+  "ibyishimo",
+  "ntawe",
+  "yakoze",
+  "APR",
+  "gutangira",
+  "icyemezo",
+  "umuyobozi",
+  "yifuza",
+  "y’igihugu",
+  "aza",
+  "ibikoresho",
+  "imiti",
+  "niwe",
+  "yahise",
+  "akamaro",
+  "inzira",
+  "Yavuze",
+  "buriya",
+  "impano",
+  "umutwe",
+  "Akira",
+  "Oya",
+  "bagore",
+  "burundu",
+  "bye",
+  "gutuma",
+  "kiri",
+  "kwambara",
+  "myinshi",
+  "ubwenge",
+  "Email",
+  "Umuntu",
+  "batandukanye",
+  "bwawe",
+  "iterambere",
+  "umunsi",
+  "kugenda",
+  "ikoranabuhanga",
+  "itsinda",
+  "ugomba",
+  "Minisitiri",
+  "bifuza",
+  "ibihugu",
+  "maso",
+  "muhanda",
+  "mukuru",
+  "umubare",
+  "umubyeyi",
+  "uretse",
+  "wenyine",
+  "Africa",
+  "Itorero",
+  "kubana",
+  "mbi",
+  "mpera",
+  "mugenzi",
+  "Jean",
+  "babiri",
+  "inkuru",
+  "kare",
+  "kugura",
+  "kurusha",
+  "mashuri",
+  "nyamara",
+  "15",
+  "asaba",
+  "bashaka",
+  "cyacu",
+  "mikino",
+  "n’abana",
+  "ruhande",
+  "amaraso",
+  "intego",
+  "kinini",
+  "Kamena",
+  "abakobwa",
+  "kuwa",
+  "leta",
+  "pe",
+  "yakomeje",
+  "gitabo",
+  "nyina",
+  "politiki",
+  "umwuka",
+  "gute",
+  "igikorwa",
+  "intege",
+  "mukobwa",
+  "nkuko",
+  "telephone",
+  "y’imyaka",
+  "Jenoside",
+  "bita",
+  "cyabo",
+  "guhura",
+  "gutyo",
+  "mibi",
+  "ruswa",
+  "ubona",
+  "Kuva",
+  "Njyewe",
+  "amategeko",
+  "bwose",
+  "ijambo",
+  "imibonano",
+  "kwitabira",
+  "amanota",
+  "batanga",
+  "guha",
+  "intambwe",
+  "kirekire",
+  "wenda",
+  "bibi",
+  "ibya",
+  "kubyara",
+  "nibura",
+  "20",
+  "ishuri",
+  "isura",
+  "kwinjira",
+  "mutima",
+  "zabo",
+  "Buri",
+  "byabo",
+  "imikino",
+  "kumwe",
+  "miryango",
+  "namwe",
+  "ryâ",
+  "turi",
+  "umuhanzi",
+  "™u",
+  "Aba",
+  "aka",
+  "ikigo",
+  "kanseri",
+  "kugirango",
+  "nyine",
+  "urugo",
+  "waba",
+  "aribyo",
+  "de",
+  "hasi",
+  "nyarwanda",
+  "umwanzuro",
+  "Sports",
+  "abafite",
+  "binyuze",
+  "ukuvuga",
+  "akunda",
+  "ubusa",
+  "yahawe",
+  "bigaragaza",
+  "burya",
+  "gutekereza",
+  "imibereho",
+  "irimo",
+  "kigero",
+  "kwakira",
+  "nabwo",
+  "tugomba",
+  "ubushakashatsi",
+  "ukaba",
+  "Ko",
+  "Nk’uko",
+  "akomeza",
+  "byatumye",
+  "Gasongo",
+  "gusoma",
+  "ibyangombwa",
+  "Pasiteri",
+  "Uko",
+  "asanga",
+  "bakunze",
+  "banjye",
+  "gukorwa",
+  "n’igihe",
+  "BBC",
+  "Naho",
+  "Reka",
+  "Sacha-",
+  "akavuga",
+  "akiri",
+  "cyiza",
+  "ibiri",
+  "mutwe",
+  "Aho",
+  "Nelson-",
+  "Trump",
+  "abayobozi",
+  "bahanzi",
+  "bishoboka",
+  "ivuga",
+  "make",
+  "ugasanga",
+  "umuziki",
+  "Danny",
+  "Komisiyo",
+  "kindi",
+  "mirimo",
+  "n’",
+  "umuti",
+  "Kuko",
+  "Police",
+  "U",
+  "bigaragara",
+  "bâ",
+  "gito",
+  "gutwara",
+  "imideli",
+  "iya",
+  "ngiye",
+  "ukunda",
+  "uzi",
+  "30",
+  "Iri",
+  "batuye",
+  "imiryango",
+  "inzoga",
+  "kintu",
+  "tumaze",
+  "ADEPR",
+  "Mbere",
+  "afata",
+  "igisubizo",
+  "ijuru",
+  "imyitozo",
+  "itorero",
+  "kuririmba",
+  "kuyobora",
+  "reka",
+  "yamaze",
+  "Igihe",
+  "Kugira",
+  "ahari",
+  "bihagije",
+  "byabaye",
+  "ibihe",
+  "itangazamakuru",
+  "izo",
+  "mba",
+  "n’iyo",
+  "biterwa",
+  "gishize",
+  "gukina",
+  "igitekerezo",
+  "ikaba",
+  "matora",
+  "umurimo",
+  "zimwe",
+  "Mama-",
+  "Uretse",
+  "bakunda",
+  "gatatu",
+  "munini",
+  "ntangira",
+  "yagiye",
+  "yasabye",
+  "12",
+  "None",
+  "Nyamara",
+  "Si",
+  "baturage",
+  "igaragaza",
+  "irushanwa",
+  "isoko",
+  "njya",
+  "rufite",
+  "umukandida",
+  "umuriro",
+  "urimo",
+  "gace",
+  "igikombe",
+  "isuku",
+  "kurwanya",
+  "mujyi",
+  "Ahubwo",
+  "Njye",
+  "bagize",
+  "bombi",
+  "bwinshi",
+  "gato",
+  "guhitamo",
+  "imodoka",
+  "ingufu",
+  "iwabo",
+  "kdi",
+  "kiganiro",
+  "kigo",
+  "kose",
+  "makuru",
+  "nshuro",
+  "nshya",
+  "rukundo",
+  "rumwe",
+  "ubutumwa",
+  "ugiye",
+  "uzaba",
+  "Inkotanyi",
+  "humura",
+  "ikomeye",
+  "mushinga",
+  "n’ubwo",
+  "ukomeye",
+  "Burya",
+  "agaragaza",
+  "bisanzwe",
+  "cyari",
+  "inda",
+  "inyungu",
+  "iryo",
+  "murenge",
+  "ubwe",
+  "ukwiye",
+  "Izi",
+  "Umwe",
+  "We-",
+  "banyarwanda",
+  "kuryama",
+  "muhanzi",
+  "niko",
+  "n’u",
+  "Umugabo",
+  "abahanzi",
+  "amasaha",
+  "babona",
+  "bakajya",
+  "guhangana",
+  "gukorera",
+  "haba",
+  "hakaba",
+  "ibijyanye",
+  "ibyemezo",
+  "inzu",
+  "kwiyamamaza",
+  "n’abantu",
+  "rye",
+  "ryo",
+  "w’u",
+  "Amerika",
+  "Mana",
+  "guca",
+  "ijana",
+  "itandukanye",
+  "mushiki",
+  "n’uburyo",
+  "2",
+  "4",
+  "azaba",
+  "batangiye",
+  "bayo",
+  "bwoko",
+  "by",
+  "habaho",
+  "ikindi",
+  "ituma",
+  "niho",
+  "umaze",
+  "umusore",
+  "Erega",
+  "Umuryango",
+  "abanyeshuri",
+  "bakoresha",
+  "bibiri",
+  "bushakashatsi",
+  "byaha",
+  "gushyiraho",
+  "hashize",
+  "karere",
+  "par",
+  "raporo",
+  "ujya",
+  "Joy-",
+  "Ubushakashatsi",
+  "ambwira",
+  "gereza",
+  "gukunda",
+  "hanyuma",
+  "izina",
+  "kuzamura",
+  "musore",
+  "n’ibyo",
+  "sha",
+  "wifuza",
+  "6",
+  "Nanjye",
+  "amashanyarazi",
+  "bumwe",
+  "ibiyobyabwenge",
+  "ingamba",
+  "nako",
+  "rwâ",
+  "ubusanzwe",
+  "umuhungu",
+  "utari",
+  "w’Imana",
+  "™Imana",
+  "Brendah",
+  "Brown",
+  "abahanga",
+  "amazina",
+  "bafata",
+  "bice",
+  "bivugwa",
+  "cyumba",
+  "guhuza",
+  "ibimenyetso",
+  "kipe",
+  "mugaragaro",
+  "ubwonko",
+  "yabaye",
+  "yatangaje",
+  "yayo",
+  "Eddy",
+  "Kandi",
+  "Nonese",
+  "bakomeza",
+  "bivuze",
+  "kwivuza",
+  "nanone",
+  "n’abagore",
+  "ubutaka",
+  "yigeze",
+  "14",
+  "I",
+  "Murakoze",
+  "Rwose",
+  "The",
+  "agahinda",
+  "amasomo",
+  "gutora",
+  "ijwi",
+  "imbuto",
+  "kuburyo",
+  "nda",
+  "ndirimbo",
+  "nti",
+  "rubuga",
+  "uburezi",
+  "7",
+  "Humura",
+  "Werurwe",
+  "atandukanye",
+  "atanga",
+  "biga",
+  "bigo",
+  "bigomba",
+  "bindi",
+  "igira",
+  "murongo",
+  "natwe",
+  "nshaka",
+  "ntaho",
+  "ubumwe",
+  "yagaragaje",
+  "18",
+  "John",
+  "aricyo",
+  "bikwiye",
+  "gitondo",
+  "guhabwa",
+  "hehe",
+  "ibiryo",
+  "ikora",
+  "ingenzi",
+  "ndabona",
+  "n’abo",
+  "rikomeye",
+  "umukunzi",
+  "y’abaturage",
+  "Dore",
+  "Emmanuel",
+  "Jane",
+  "Niyo",
+  "bisaba",
+  "bundi",
+  "ikimenyetso",
+  "nabonye",
+  "ryari",
+  "ubushake",
+  "ziba",
+  "Abaturage",
+  "Bufaransa",
+  "Isi",
+  "Uru",
+  "akwiye",
+  "bacu",
+  "bane",
+  "batari",
+  "bugufi",
+  "gifite",
+  "guhora",
+  "gukemura",
+  "ibiro",
+  "inkunga",
+  "kanya",
+  "kumurika",
+  "n’iki",
+  "ugira",
+  "wose",
+  "Aya",
+  "Kiliziya",
+  "Nyakanga",
+  "Undi",
+  "abiri",
+  "amashuri",
+  "bagabo",
+  "bahawe",
+  "bakeneye",
+  "bimeze",
+  "bwanjye",
+  "erega",
+  "gakondo",
+  "guhindura",
+  "hakiri",
+  "impungenge",
+  "ishobora",
+  "kugaragara",
+  "kuruta",
+  "masezerano",
+};
+const uint16_t WA_FREQ_138_RANKS[] = {
+  706, 0, 0, 0, 12, 231, 0, 0, 855, 848, 271, 384, 352, 571, 0, 534,
+  376, 0, 0, 0, 0, 0, 0, 0, 578, 387, 0, 0, 0, 661, 853, 0,
+  456, 125, 692, 878, 0, 0, 0, 0, 0, 0, 0, 214, 358, 684, 0, 416,
+  647, 295, 0, 0, 0, 0, 0, 0, 613, 0, 311, 928, 123, 564, 315, 0,
+  672, 0, 0, 0, 0, 0, 374, 432, 321, 0, 790, 0, 422, 0, 541, 980,
+  0, 0, 619, 426, 0, 0, 793, 175, 0, 947, 71, 280, 494, 844, 920, 985,
+  991, 0, 196, 646, 548, 605, 668, 719, 770, 862, 948, 0, 0, 330, 348, 443,
+  488, 942, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 0, 0, 0,
+  0, 0, 18, 779, 0, 0, 0, 1, 0, 0, 109, 0, 70, 191, 476, 0,
+  0, 0, 0, 0, 0, 0, 0, 298, 26, 382, 731, 724, 819, 286, 807, 896,
+  593, 0, 0, 516, 768, 410, 872, 243, 264, 869, 894, 0, 0, 0, 0, 451,
+  897, 0, 0, 291, 349, 921, 202, 392, 0, 0, 0, 0, 257, 669, 0, 294,
+  234, 565, 0, 242, 750, 997, 0, 86, 504, 0, 561, 0, 0, 367, 0, 0,
+  221, 62, 0, 0, 981, 740, 0, 0, 0, 0, 0, 151, 616, 839, 859, 0,
+  625, 762, 0, 395, 435, 0, 0, 763, 0, 0, 0, 0, 40, 65, 602, 751,
+  385, 0, 0, 513, 711, 0, 743, 0, 0, 721, 0, 0, 208, 0, 0, 438,
+  0, 0, 0, 0, 0, 0, 0, 0, 671, 0, 0, 0, 507, 543, 547, 261,
+  309, 530, 732, 404, 925, 0, 868, 103, 0, 910, 0, 0, 0, 0, 495, 496,
+  900, 347, 787, 0, 100, 172, 0, 322, 615, 0, 0, 0, 0, 933, 0, 0,
+  0, 0, 0, 0, 650, 0, 333, 823, 0, 268, 652, 303, 19, 324, 455, 701,
+  765, 914, 0, 778, 411, 0, 0, 0, 586, 887, 953, 993, 0, 617, 0, 903,
+  212, 0, 0, 0, 573, 0, 73, 0, 0, 0, 0, 889, 0, 0, 0, 238,
+  0, 0, 626, 219, 23, 554, 0, 0, 618, 708, 994, 523, 629, 0, 782, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 464, 0, 0, 0, 0, 0, 388, 0,
+  0, 0, 0, 0, 0, 892, 124, 0, 634, 0, 0, 193, 664, 0, 0, 0,
+  955, 0, 0, 0, 0, 425, 995, 0, 0, 0, 0, 884, 0, 0, 847, 0,
+  0, 0, 0, 0, 0, 466, 253, 0, 296, 722, 0, 0, 935, 351, 0, 0,
+  0, 368, 536, 165, 423, 156, 452, 812, 0, 0, 134, 0, 79, 28, 94, 72,
+  99, 106, 639, 265, 735, 0, 0, 0, 0, 0, 0, 27, 0, 919, 0, 972,
+  0, 0, 267, 338, 0, 0, 390, 974, 825, 938, 0, 609, 730, 0, 965, 999,
+  653, 857, 0, 270, 0, 336, 715, 0, 121, 0, 0, 308, 0, 0, 864, 916,
+  21, 0, 698, 917, 0, 0, 158, 206, 262, 225, 314, 344, 741, 360, 759, 263,
+  378, 786, 592, 820, 0, 0, 0, 241, 506, 0, 0, 0, 0, 944, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 614, 0, 0, 0, 964, 789, 0, 0, 0,
+  163, 905, 606, 453, 830, 192, 353, 463, 562, 56, 0, 0, 0, 0, 0, 0,
+  0, 0, 556, 346, 551, 0, 694, 41, 167, 975, 0, 433, 785, 0, 0, 752,
+  0, 13, 960, 0, 397, 515, 582, 0, 340, 20, 413, 527, 0, 0, 0, 0,
+  745, 0, 0, 0, 0, 0, 0, 0, 198, 53, 0, 0, 525, 705, 0, 754,
+  514, 0, 38, 130, 651, 471, 956, 962, 1000, 0, 0, 0, 0, 0, 0, 223,
+  0, 37, 327, 0, 389, 690, 0, 0, 0, 0, 0, 815, 0, 946, 0, 898,
+  147, 0, 533, 0, 276, 420, 598, 737, 14, 356, 0, 34, 136, 487, 0, 0,
+  769, 0, 0, 0, 0, 406, 380, 0, 0, 473, 654, 688, 81, 162, 623, 87,
+  822, 829, 150, 860, 7, 901, 927, 0, 0, 0, 326, 923, 0, 676, 35, 369,
+  0, 0, 486, 796, 747, 0, 412, 0, 0, 725, 0, 0, 0, 0, 0, 0,
+  566, 0, 32, 0, 83, 840, 0, 943, 0, 0, 0, 918, 0, 0, 727, 0,
+  0, 630, 55, 118, 680, 959, 0, 568, 0, 0, 355, 331, 186, 127, 468, 528,
+  393, 937, 0, 675, 0, 0, 332, 0, 0, 0, 0, 0, 22, 0, 813, 0,
+  0, 659, 0, 0, 0, 0, 0, 0, 0, 363, 75, 85, 803, 831, 998, 204,
+  0, 627, 110, 279, 624, 0, 666, 738, 226, 0, 0, 0, 0, 0, 95, 569,
+  328, 850, 0, 0, 0, 0, 583, 874, 0, 579, 0, 310, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 493, 301, 0, 595, 0, 0, 682,
+  10, 142, 832, 939, 119, 643, 160, 461, 881, 0, 0, 695, 205, 806, 0, 0,
+  876, 0, 0, 101, 210, 0, 0, 0, 104, 0, 0, 833, 597, 44, 846, 0,
+  297, 0, 0, 0, 0, 120, 824, 0, 0, 0, 0, 828, 474, 632, 0, 0,
+  0, 0, 77, 0, 863, 0, 0, 880, 0, 0, 0, 249, 0, 0, 229, 288,
+  0, 224, 304, 761, 0, 0, 0, 766, 0, 817, 0, 0, 0, 0, 0, 0,
+  377, 429, 950, 988, 0, 0, 0, 0, 0, 232, 0, 0, 0, 758, 117, 17,
+  0, 826, 952, 0, 589, 105, 0, 0, 0, 0, 255, 482, 941, 113, 0, 195,
+  0, 0, 305, 0, 0, 0, 74, 469, 0, 603, 0, 0, 0, 794, 0, 0,
+  0, 161, 215, 867, 677, 0, 0, 0, 0, 491, 0, 337, 0, 284, 529, 780,
+  0, 0, 0, 0, 0, 0, 0, 0, 194, 381, 636, 875, 0, 0, 116, 442,
+  873, 818, 0, 0, 24, 135, 335, 739, 0, 188, 686, 886, 0, 858, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 84, 535, 339, 42, 341, 373, 713, 0,
+  764, 277, 302, 931, 0, 0, 181, 0, 220, 90, 334, 418, 757, 777, 969, 0,
+  0, 0, 403, 537, 0, 0, 0, 0, 82, 691, 0, 742, 182, 558, 954, 407,
+  0, 0, 177, 0, 0, 108, 0, 0, 0, 517, 199, 398, 0, 0, 0, 0,
+  269, 139, 983, 54, 0, 375, 0, 581, 0, 0, 213, 477, 0, 0, 153, 576,
+  0, 557, 0, 0, 274, 0, 0, 396, 0, 409, 0, 0, 0, 0, 0, 0,
+  9, 674, 51, 542, 0, 0, 0, 287, 729, 697, 0, 0, 0, 545, 500, 0,
+  0, 560, 591, 902, 0, 0, 0, 802, 0, 0, 78, 499, 665, 0, 480, 0,
+  184, 0, 0, 635, 131, 266, 0, 0, 0, 849, 122, 370, 0, 0, 39, 808,
+  448, 459, 316, 114, 0, 890, 0, 979, 0, 0, 0, 0, 57, 460, 0, 883,
+  0, 821, 259, 399, 0, 0, 0, 0, 171, 0, 0, 233, 218, 0, 882, 0,
+  971, 0, 0, 58, 0, 519, 0, 371, 924, 631, 140, 434, 622, 936, 0, 0,
+  871, 0, 0, 0, 783, 0, 670, 0, 0, 166, 0, 0, 0, 457, 0, 0,
+  0, 502, 0, 449, 926, 748, 0, 0, 320, 663, 521, 728, 845, 865, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 702, 0, 673, 96, 329, 0,
+  0, 0, 0, 0, 0, 417, 957, 289, 0, 0, 0, 0, 0, 0, 0, 0,
+  470, 656, 415, 0, 0, 0, 408, 0, 0, 610, 0, 419, 0, 0, 976, 0,
+  0, 132, 685, 281, 767, 0, 0, 273, 531, 717, 958, 0, 0, 0, 0, 0,
+  0, 590, 776, 0, 145, 524, 484, 644, 0, 391, 683, 0, 0, 989, 0, 0,
+  0, 0, 0, 0, 596, 454, 359, 607, 703, 0, 0, 0, 52, 753, 0, 0,
+  25, 492, 401, 540, 966, 0, 0, 0, 437, 0, 260, 949, 0, 0, 0, 366,
+  0, 870, 0, 0, 0, 0, 0, 0, 0, 0, 36, 111, 0, 217, 575, 501,
+  801, 932, 0, 532, 498, 795, 0, 0, 60, 0, 0, 0, 879, 967, 424, 4,
+  441, 0, 402, 450, 805, 678, 0, 3, 0, 0, 641, 0, 0, 772, 0, 827,
+  718, 0, 550, 716, 129, 164, 0, 0, 462, 0, 246, 505, 0, 0, 342, 577,
+  0, 0, 0, 0, 503, 0, 357, 97, 159, 272, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 254, 756, 227, 0, 0, 0, 0, 173, 642, 250, 157, 712, 0,
+  0, 0, 0, 0, 0, 211, 400, 0, 0, 0, 0, 230, 0, 888, 0, 207,
+  0, 660, 0, 0, 0, 187, 544, 570, 0, 0, 0, 0, 0, 781, 0, 0,
+  68, 0, 293, 0, 112, 0, 0, 509, 0, 0, 0, 479, 0, 64, 0, 0,
+  0, 0, 222, 792, 810, 300, 584, 628, 915, 0, 431, 189, 788, 0, 0, 185,
+  0, 0, 0, 0, 0, 0, 497, 657, 0, 0, 0, 0, 549, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 244, 354, 0, 394, 414, 446, 0, 0, 319,
+  148, 0, 0, 0, 726, 0, 179, 0, 973, 572, 736, 0, 133, 343, 0, 934,
+  0, 0, 0, 580, 0, 2, 734, 0, 0, 0, 245, 0, 945, 0, 0, 61,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 0, 0, 0, 0, 0, 841,
+  0, 0, 0, 0, 0, 963, 364, 240, 891, 0, 209, 458, 940, 987, 67, 0,
+  0, 436, 63, 472, 0, 611, 0, 0, 658, 0, 47, 306, 430, 0, 798, 836,
+  0, 0, 0, 0, 0, 749, 539, 0, 0, 0, 0, 0, 180, 144, 372, 693,
+  0, 0, 0, 0, 929, 0, 0, 791, 0, 0, 0, 0, 0, 46, 31, 0,
+  483, 0, 0, 0, 485, 0, 520, 816, 522, 681, 137, 574, 174, 645, 149, 842,
+  861, 0, 899, 904, 0, 563, 733, 0, 961, 0, 0, 0, 784, 851, 600, 856,
+  885, 345, 0, 290, 0, 0, 0, 0, 679, 709, 552, 283, 773, 837, 843, 852,
+  710, 0, 0, 0, 0, 465, 48, 0, 29, 0, 0, 0, 0, 489, 877, 0,
+  0, 0, 0, 0, 169, 0, 318, 0, 197, 481, 0, 638, 811, 138, 0, 0,
+  0, 0, 0, 0, 50, 0, 0, 908, 0, 362, 930, 379, 43, 0, 0, 700,
+  0, 599, 0, 325, 797, 0, 0, 98, 0, 0, 248, 299, 475, 0, 968, 6,
+  0, 128, 992, 146, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 143, 895, 15, 907, 996, 0, 0, 92, 405, 662, 0, 183, 428,
+  0, 854, 0, 771, 0, 200, 714, 0, 0, 0, 984, 0, 0, 0, 0, 0,
+  49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 655, 866, 282, 0, 0, 59,
+  216, 0, 0, 0, 16, 445, 154, 285, 986, 5, 440, 687, 510, 0, 922, 0,
+  0, 0, 0, 775, 0, 275, 0, 0, 0, 0, 0, 93, 0, 0, 107, 0,
+  0, 0, 69, 190, 0, 0, 0, 0, 0, 604, 951, 0, 0, 0, 0, 0,
+  0, 0, 814, 258, 170, 323, 804, 0, 0, 0, 115, 278, 0, 0, 0, 0,
+  518, 0, 307, 89, 755, 0, 0, 667, 0, 978, 0, 365, 555, 637, 0, 612,
+  699, 0, 91, 168, 467, 689, 427, 982, 313, 588, 236, 990, 237, 447, 911, 312,
+  0, 0, 912, 0, 201, 0, 235, 155, 203, 317, 511, 350, 538, 620, 909, 0,
+  744, 66, 508, 0, 421, 0, 0, 0, 0, 0, 601, 0, 0, 0, 559, 834,
+  913, 0, 800, 0, 0, 0, 0, 490, 893, 0, 526, 799, 640, 838, 0, 30,
+  141, 553, 0, 0, 0, 0, 774, 0, 0, 585, 80, 292, 478, 587, 633, 809,
+  835, 152, 386, 608, 906, 704, 760, 0, 0, 0, 0, 76, 696, 126, 228, 247,
+  648, 0, 0, 0, 88, 707, 0, 720, 0, 0, 178, 567, 594, 0, 0, 0,
+  251, 0, 252, 239, 383, 0, 0, 0, 0, 0, 0, 0, 0, 361, 0, 649,
+  0, 256, 746, 8, 0, 0, 970, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 546, 0, 0, 102, 723, 444, 0, 0, 977, 621, 0, 176, 439, 11, 512,
+};
+
+const char *WA_FREQ_139_TOKENS[] = {
+  "тарбахтарым",
+  "көһүйдүлэр",
+  "атыыр",
+  "биэ",
+  "бөҕөнү",
+  "үөрдээбит",
+  "икки",
+  "тараҕай",
+  "быттаспыттарыгар",
+  "дылы",
+  "уолум",
+  "хороччу",
+  "улааппыт",
+  "бурдж",
+  "халифа",
+  "билигин",
+  "аан",
+  "дойдуга",
+  "саамай",
+  "үрдүк",
+  "небоскреб",
+  "мин",
+  "сатыы",
+  "баран",
+  "иһэбин",
+  "көҕөрбүтүн",
+  "көрүмэ",
+  "үүнээйитэ",
+  "билиэҕэ",
+  "оннук",
+  "эрэ",
+  "буолбатын",
+  "сүөһү",
+  "барыта",
+  "ааҕылынна",
+  "өрөмүөн",
+  "кэнниттэн",
+  "күргэ",
+  "бөҕөргөөбүт",
+};
+const uint16_t WA_FREQ_139_RANKS[] = {
+  31, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 24,
+  0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 6, 2, 23, 0,
+  26, 0, 0, 0, 7, 28, 36, 0, 18, 10, 0, 16, 0, 34, 0, 0,
+  20, 5, 21, 0, 0, 1, 29, 33, 0, 13, 0, 0, 0, 0, 39, 0,
+  0, 0, 0, 0, 8, 19, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0,
+  0, 0, 0, 0, 0, 32, 0, 35, 0, 0, 0, 0, 0, 0, 11, 0,
+  0, 30, 37, 0, 0, 0, 0, 0, 0, 38, 0, 0, 0, 0, 4, 27,
+  0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 14, 15, 0, 25, 0, 12,
+};
+
+const char *WA_FREQ_140_TOKENS[] = {
+  "ᱤᱧ",
+  "ᱴᱚᱢ",
+  "ᱫᱟᱨᱮ",
+  "ᱪᱮᱞᱮᱠᱟ",
+  "ᱫᱚ",
+  "ᱟᱹᱛᱩ",
+  "ᱠᱷᱚᱱ",
+  "ᱦᱮᱡ",
+  "ᱠᱟᱱᱟ",
+  "ᱴᱤᱵᱷᱤ",
+  "ᱨᱮ",
+  "ᱢᱮᱱᱟᱭᱟ",
+  "ᱟᱡᱟᱜ",
+  "ᱪᱟᱹᱠᱨᱤ",
+  "ᱵᱟᱰᱟᱭᱟᱭ",
+  "ᱢᱤᱫᱴᱟᱹᱝ",
+  "ᱧᱮᱞ",
+  "ᱫᱟᱲᱮᱭᱟᱜ",
+  "ᱠᱟᱹᱱᱟᱹᱧ",
+  "ᱦᱩᱥᱤᱭᱟᱹᱨ",
+  "ᱚᱱᱟ",
+  "ᱟᱲᱟᱜ",
+  "ᱠᱟᱜ",
+  "ᱢᱮ",
+  "ᱱᱟᱦ",
+  "ᱛᱤᱱᱟᱹᱜ",
+  "ᱜᱟᱱ",
+  "ᱠᱚ",
+  "ᱞᱟᱜᱟᱣ",
+  "ᱠᱮᱜᱼᱟᱭ",
+  "ᱡᱚᱝᱜᱽᱞᱤ",
+  "ᱩᱱᱤ",
+  "ᱦᱟᱹᱲᱩᱵ",
+  "ᱠᱮᱫᱮᱭᱟᱭ",
+};
+const uint16_t WA_FREQ_140_RANKS[] = {
+  0, 0, 0, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0,
+  0, 7, 0, 0, 0, 13, 33, 0, 15, 22, 0, 0, 0, 0, 12, 0,
+  26, 0, 18, 9, 0, 0, 0, 19, 21, 0, 0, 0, 0, 0, 3, 32,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31, 23, 28, 0, 0, 0,
+  30, 0, 0, 0, 10, 8, 29, 6, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 34, 0, 0,
+  0, 20, 0, 0, 0, 0, 25, 11, 0, 0, 0, 0, 0, 27, 2, 0,
+  0, 24, 16, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+};
+
+const char *WA_FREQ_141_TOKENS[] = {
+  "mi",
+  "assai",
+  "cu",
+  "a",
+  "lu",
+  "lupu",
+  "di",
+  "mala",
+  "cuscienza",
+  "comu",
+  "opira",
+  "penza",
+  "chi",
+  "su",
+  "cammuriusi",
+  "siddia",
+  "megghiu",
+  "picca",
+  "chianciri",
+  "ca",
+  "trivuliari",
+  "iddu",
+  "è",
+  "cuntentu",
+  "so",
+  "travagghiu",
+  "piaciunu",
+  "i",
+  "ricordi",
+  "dû",
+  "passatu",
+  "fazzu",
+  "doccia",
+  "na",
+  "vota",
+  "o",
+  "iornu",
+  "porta",
+  "si",
+  "sta",
+  "ciurennu",
+  "l",
+  "ha",
+  "criatu",
+  "la",
+  "natura",
+  "pi",
+  "li",
+  "cori",
+  "nnamurati",
+  "u",
+  "figghiolu",
+  "dissi",
+  "tassì",
+  "spariu",
+  "nta",
+  "nigghia",
+};
+const uint16_t WA_FREQ_141_RANKS[] = {
+  0, 0, 0, 0, 0, 49, 0, 0, 40, 0, 0, 0, 0, 5, 0, 0,
+  0, 23, 0, 0, 35, 47, 12, 0, 56, 0, 38, 0, 0, 0, 15, 0,
+  0, 7, 32, 36, 34, 13, 37, 55, 52, 2, 0, 16, 25, 31, 0, 20,
+  33, 51, 0, 4, 11, 14, 22, 1, 21, 30, 57, 9, 46, 48, 53, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 42, 50, 0, 0,
+  0, 18, 0, 0, 0, 54, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 8, 27, 39, 26, 24, 0, 0, 0, 0, 0, 0, 0, 28, 17,
+  3, 29, 0, 0, 0, 0, 10, 43, 44, 0, 45, 0, 41, 0, 0, 0,
+};
+
+const char *WA_FREQ_142_TOKENS[] = {
+  "جي",
+  "کي",
+  "آهي",
+  "ته",
+  "جو",
+  "تي",
+  "کان",
+  "سان",
+  "هڪ",
+  "نه",
+  "ٿي",
+  "ڪري",
+  "جا",
+  "هن",
+  "آهن",
+  "به",
+  "مان",
+  "ٿو",
+  "لاءِ",
+  "ئي",
+  "ان",
+  "سنڌ",
+  "سندس",
+  "پر",
+  "پنهنجي",
+  "هو",
+  "اهو",
+  "ڪيو",
+  "آهي،",
+  "جنهن",
+  "ويو",
+  "ڪرڻ",
+  "سنڌي",
+  "پوءِ",
+  "انهن",
+  "ٿا",
+  "اسان",
+  "ڪنهن",
+  "وڃي",
+  "پاڻ",
+  "جڏهن",
+  "هئي",
+  "واري",
+  "تائين",
+  "ٿيو",
+  "جن",
+  "يا",
+  "پڻ",
+  "ڪئي",
+  "اها",
+  "هئا",
+  "کيس",
+  "اچي",
+  "رهيو",
+  "هر",
+  "آهن،",
+  "جيڪو",
+  "ڪم",
+  "اهي",
+  "ڪو",
+  "جيڪي",
+  "سندن",
+  "طور",
+  "ماڻهو",
+  "ڪتاب",
+  "ويندو",
+  "ڏينهن",
+  "حاصل",
+  "ويا",
+  "رهي",
+  "دنيا",
+  "وقت",
+  "وارو",
+  "وڌيڪ",
+  "هو،",
+  "وري",
+  "جون",
+  "تمام",
+  "پنهنجو",
+  "ڏانهن",
+  "پاڪستان",
+  "ملڪ",
+  "چيو",
+  "شاه",
+  "سال",
+  "مون",
+  "استعمال",
+  "ڪجهه",
+  "سڀ",
+  "منهنجي",
+  "ڳالهه",
+  "اهڙي",
+  "ماڻهن",
+  "هاڻي",
+  "ٻئي",
+  "پيو",
+  "وڏي",
+  "تعليم",
+  "جيڪا",
+  "ڇا",
+  "شروع",
+  "ڪونه",
+  "ڪي",
+  "ٿئي",
+  "ٽي",
+  "نالي",
+  "اڄ",
+  "رهيا",
+  "ٻه",
+  "جيڪڏهن",
+  "هي",
+  "وٺي",
+  "انهيءَ",
+  "سو",
+  "ڳوٺ",
+  "وٽ",
+  "سگهي",
+  "وئي",
+  "ٻين",
+  "ادب",
+  "جيئن",
+  "سمنڊ",
+  "ڪن",
+  "گڏ",
+  "عڪس",
+  "اڳ",
+  "پيدا",
+  "اندر",
+  "هوندي",
+  "ڇو",
+  "ڪا",
+  "نالو",
+  "هٿ",
+  "پاڻي",
+  "سائين",
+  "مشهور",
+  "ادبي",
+  "تنهن",
+  "وڏو",
+  "حڪومت",
+  "پيش",
+  "ڪندا",
+  "ملي",
+  "نظر",
+  "ٿيندو",
+  "هوندو",
+  "پئي",
+  "پهرين",
+  "ٿيڻ",
+  "حيدرآباد",
+  "هنن",
+  "هيٺ",
+  "صاحب",
+  "ڇڏيو",
+  "ڪيا",
+  "ائين",
+  "توهان",
+  "جتي",
+  "موجود",
+  "ڪڏهن",
+  "سالن",
+  "ميل",
+  "ٻيو",
+  "ٿو،",
+  "ڪيائين",
+  "پٽ",
+  "ٿيل",
+  "ڏنو",
+  "کين",
+  "گيت",
+  "ٻار",
+  "ٿيا",
+  "ڪندو",
+  "تڏهن",
+  "آيو",
+  "ڪمپيوٽر",
+  "رڳو",
+  "عوام",
+  "ڇوڙ",
+  "ڏکڻ",
+  "اتي",
+  "ذريعي",
+  "سواءِ",
+  "هجي",
+  "وڃن",
+  "شاهه",
+  "ٻوليءَ",
+  "تان",
+  "سنڌوءَ",
+  "سڄي",
+  "وفات",
+  "ويندي",
+  "ڏسي",
+  "علائقي",
+  "اڳتي",
+  "ٻي",
+  "اوڀر",
+  "بعد",
+  "رکي",
+  "ڏئي",
+  "طرف",
+  "هيءَ",
+  "ڏيڻ",
+  "اسڪول",
+  "اوهان",
+  "توڙي",
+  "دل",
+  "هتي",
+  "يعني",
+  "اڃا",
+  "سڀني",
+  "شهر",
+  "هئي،",
+  "گهر",
+  "شاعر",
+  "هيءُ",
+  "پير",
+  "ڇڏي",
+  "گهڻو",
+  "سر",
+  "ٿيون",
+  "اهڙو",
+  "شاعري",
+  "قائم",
+  "مطابق",
+  "هوندا",
+  "وغيره",
+  "انسان",
+  "تون",
+  "مختلف",
+  "ويو،",
+  "مطلب",
+  "وچ",
+  "محمد",
+  "نئين",
+  "پاسي",
+  "فقير",
+  "قومي",
+  "بي",
+  "جِي",
+  "خيال",
+  "ريت",
+  "وارن",
+  "آباد",
+  "تو",
+  "رات",
+  "عام",
+  "ٻن",
+  "پيا",
+  "ڪيترن",
+  "استاد",
+  "هلي",
+  "کے",
+  "حقيقت",
+  "سبب",
+  "ظاهر",
+  "منهنجو",
+  "ها",
+  "ٻولي",
+  "پهريون",
+  "ٿا،",
+  "ٿي،",
+  "ٿيندا",
+  "ڄڻ",
+  "کڻي",
+  "مٿي",
+  "میں",
+  "ڪجھه",
+  "ڪندي",
+  "حصو",
+  "ختم",
+  "هميشه",
+  "ڪراچي",
+  "جيان",
+  "دور",
+  "مضمون",
+  "ٿيندڙ",
+  "ڏسڻ",
+  "ڏني",
+  "بابت",
+  "مٿان",
+  "ڪيل",
+  "تنهنڪري",
+  "رنگ",
+  "صورت",
+  "لکيل",
+  "هندستان",
+  "ويندا",
+  "ٻيا",
+  "ڪراچيءَ",
+  "بند",
+  "ثابت",
+  "سنڌو",
+  "محسوس",
+  "مقرر",
+  "مگر",
+  "وهڪري",
+  "يونيورسٽي",
+  "ڇاڪاڻ",
+  "ڊاڪٽر",
+  "ڪيترائي",
+  "گهڻي",
+  "اردو",
+  "اولهه",
+  "اڪثر",
+  "خاص",
+  "زبان",
+  "موجوده",
+  "وارا",
+  "ٻاهر",
+  "پري",
+  "پڙهڻ",
+  "اور",
+  "ايم",
+  "معلوم",
+  "هئا،",
+  "ٿِي",
+  "ڌاري",
+  "ڪري،",
+  "ڪيئن",
+  "آيا",
+  "ايشيا",
+  "ايندو",
+  "تن",
+  "ته،",
+  "درياه",
+  "زماني",
+  "قوم",
+  "لڳي",
+  "مثال",
+  "پاڻيءَ",
+  "پنهنجا",
+  "ڪيون",
+  "گهٽ",
+  "سياست",
+  "سگهجي",
+  "شايع",
+  "لکي",
+  "کانپوءِ",
+  "ڪندڙ",
+  "ڪٿي",
+  "جنگ",
+  "حڪمران",
+  "سطح",
+  "شامل",
+  "طرفان",
+  "وي",
+  "خان",
+  "رکيو",
+  "ٻارن",
+  "چين",
+  "ڌرتيءَ",
+  "ڏٺو",
+  "آزاد",
+  "آواز",
+  "بنيادي",
+  "رکڻ",
+  "سگھي",
+  "طرح",
+  "لفظ",
+  "نڪري",
+  "پسند",
+  "چئي",
+  "ڏي",
+  "تاريخ",
+  "در",
+  "شايد",
+  "منهن",
+  "پوري",
+  "ٿيندي",
+  "ڄاڻ",
+  "ڪتابن",
+  "اڻ",
+  "ترقي",
+  "جهڙوڪ",
+  "سموري",
+  "ضماءُ",
+  "غلام",
+  "لطيف",
+  "لکڻ",
+  "ڪوشش",
+  "آخري",
+  "زمين",
+  "عڪسن",
+  "لڳو",
+  "مرزا",
+  "ناهي",
+  "ويون",
+  "ٿين",
+  "چڪا",
+  "ڪهڙي",
+  "اتر",
+  "اهڙا",
+  "جاءِ",
+  "جاري",
+  "سي",
+  "سڏيو",
+  "صرف",
+  "قديم",
+  "ماڳ",
+  "وهڪرو",
+  "پوي",
+  "ڪافي",
+  "ڪانه",
+  "آئون",
+  "جدوجهد",
+  "جنم",
+  "دوران",
+  "سگھجي",
+  "عمل",
+  "هيون",
+  "ياد",
+  "ٺٽي",
+  "ٽن",
+  "پاران",
+  "ٿورو",
+  "چڪو",
+  "بهترين",
+  "بڻجي",
+  "خبر",
+  "رخ",
+  "عوامي",
+  "مڪمل",
+  "هاڻ",
+  "ڏاڍو",
+  "کي،",
+  "گهرجي",
+  "اسلام",
+  "انداز",
+  "اٿس",
+  "تنهنجي",
+  "تھ",
+  "جهڙي",
+  "دوست",
+  "زندگي",
+  "عشق",
+  "غير",
+  "هندو",
+  "هنڌ",
+  "ڪردار",
+  "آهيان",
+  "الله",
+  "اي",
+  "بيان",
+  "تماڪ",
+  "رکندڙ",
+  "سامهون",
+  "سگريٽ",
+  "شاعريءَ",
+  "ضلعي",
+  "فقط",
+  "نئون",
+  "نموني",
+  "هوس",
+  "وڏا",
+  "پنجاب",
+  "پنهنجن",
+  "پهچي",
+  "پڙهي",
+  "ڪاليج",
+  "of",
+  "آئي",
+  "اتان",
+  "بلوچ",
+  "سماجي",
+  "سميت",
+  "عمر",
+  "محبت",
+  "محفوظ",
+  "ميان",
+  "وڌي",
+  "ڪيترا",
+  "ادا",
+  "اصل",
+  "انساني",
+  "زندگيءَ",
+  "سرڪار",
+  "سفر",
+  "فوج",
+  "فوجي",
+  "قومن",
+  "موجب",
+  "نوجوان",
+  "نيٺ",
+  "نٿو",
+  "هزارين",
+  "ورتو",
+  "وٽان",
+  "پوندو",
+  "پي",
+  "ڪناري",
+  "آهي؟",
+  "ايندا",
+  "اکين",
+  "باقي",
+  "ذڪر",
+  "زور",
+  "ساڳي",
+  "سوال",
+  "شادي",
+  "ضرورت",
+  "نهايت",
+  "هزار",
+  "هُن",
+  "پيءُ",
+  "چوندا",
+  "کی",
+  "ڪير",
+  "آف",
+  "ايئن",
+  "اين",
+  "اُن",
+  "تبديل",
+  "حيثيت",
+  "خدا",
+  "رستي",
+  "رهڻ",
+  "سرڪاري",
+  "سمجهي",
+  "سنه",
+  "سنڌين",
+  "علي",
+  "واپس",
+  "ويئي",
+  "ٻنهي",
+  "پاس",
+  "پنهور",
+  "ڌرتي",
+  "کھوار",
+  "ڪيئي",
+  "گذريل",
+  "اچڻ",
+  "ساري",
+  "سنڌي ادب",
+  "مسلمان",
+  "مقصد",
+  "نظم",
+  "هڪڙي",
+  "وانگر",
+  "پروگرام",
+  "پورو",
+  "ڇاڙهه",
+  "ڌيان",
+  "ڪيو،",
+  "انگريزي",
+  "اياز",
+  "ايوارڊ",
+  "بنياد",
+  "تعداد",
+  "خود",
+  "داخل",
+  "دير",
+  "رهن",
+  "سامونڊي",
+  "سياسي",
+  "شعر",
+  "صفحي",
+  "صورتحال",
+  "عرصي",
+  "مذهبي",
+  "هيو",
+  "وڌ",
+  "وڪيپيڊيا",
+  "ٻُڍل",
+  "ڄائو",
+  "آڻي",
+  "اختيار",
+  "اهم",
+  "اولاد",
+  "اڌ",
+  "بخش",
+  "تعليمي",
+  "جيتوڻيڪ",
+  "سائنس",
+  "سکر",
+  "عثمان",
+  "نسل",
+  "هُو",
+  "يونيورسٽيءَ",
+  "پنڌ",
+  "پيٽ",
+  "چار",
+  "گل",
+  "گھر",
+  "ڳڻپيوڪر",
+  "5",
+  "آخر",
+  "آپ",
+  "آھي",
+  "اڳي",
+  "اڳيان",
+  "بورڊ",
+  "ترين",
+  "تيل",
+  "جتان",
+  "حالت",
+  "خيرپور",
+  "رهندو",
+  "لاڙڪاڻي",
+  "ماءُ",
+  "نے",
+  "چوڻ",
+  "گھڻي",
+  "آيل",
+  "انگ",
+  "اهڙيءَ",
+  "اکر",
+  "حصي",
+  "خرچ",
+  "سماج",
+  "لک",
+  "لکيا",
+  "ملڻ",
+  "موٽي",
+  "نمبر",
+  "وڃڻ",
+  "ٻولين",
+  "ٻڌي",
+  "پرائمري",
+  "چون",
+  "ڊيم",
+  "ڊيٽا",
+  "ڪهڙو",
+  "ڪوبه",
+  "ڪيائون",
+  "ڪيتريون",
+  "3",
+  "بدران",
+  "بلوچستان",
+  "تحريڪ",
+  "تعلق",
+  "حضرت",
+  "خواب",
+  "دشمن",
+  "رهيون",
+  "سگهن",
+  "شهيد",
+  "عالمي",
+  "علائقن",
+  "مذڪوره",
+  "مکيه",
+  "نياپو",
+  "هڻي",
+  "والد",
+  "پنج",
+  "پوليس",
+  "پوندي",
+  "چڪي",
+  "ڏنيون",
+  "ڏور",
+  "ڪلام",
+  "ڪلڪ",
+  "2",
+  "اخبار",
+  "ادارن",
+  "اليزي",
+  "اچن",
+  "بلڪه",
+  "بهتر",
+  "بيهي",
+  "توکي",
+  "تيار",
+  "حوالي",
+  "خاندان",
+  "ريڊيو",
+  "شمار",
+  "علائقو",
+  "مجبور",
+  "مدد",
+  "مليو",
+  "ننڍي",
+  "هليو",
+  "و",
+  "ڀرسان",
+  "چيائين",
+  "کائي",
+  "ڪمار",
+  "ڳالهيون",
+  "آزادي",
+  "آهيون",
+  "اسين",
+  "الڳ",
+  "اهڙن",
+  "اِنڊمي",
+  "بلڪل",
+  "بڻائي",
+  "تبديلي",
+  "جنرل",
+  "جهڙو",
+  "سے",
+  "قرآن",
+  "لڳ",
+  "مارچ",
+  "ماڻهوءَ",
+  "مرڪز",
+  "مقبول",
+  "ملڪن",
+  "هجن",
+  "هوا",
+  "پراڻي",
+  "چاهي",
+  "ڌار",
+  "ڏنا",
+  "ڏهه",
+  "ڪامياب",
+  "ڪٿان",
+  "گڏجي",
+  "گھٽ",
+  "ءِ",
+  "آمريڪا",
+  "ايترو",
+  "بيگ",
+  "بکر",
+  "جي،",
+  "حملو",
+  "خلاف",
+  "رت",
+  "ساهه",
+  "سنڌي ٻولي",
+  "سومرو",
+  "شريف",
+  "شهرن",
+  "صوبن",
+  "ضرور",
+  "فرمايو",
+  "لحاظ",
+  "لفظن",
+  "مشتمل",
+  "مونکي",
+  "هڪڙو",
+  "وفاقي",
+  "ويهي",
+  "ڀري",
+  "ڊسمبر",
+  "ڏنل",
+  "کانسواءِ",
+  "کن",
+  "گذري",
+  "گھڻو",
+  "آڏو",
+  "اعليٰ",
+  "ايندڙ",
+  "اکيون",
+  "بار",
+  "برابر",
+  "تحلل",
+  "تنهنجو",
+  "جهڙا",
+  "جواب",
+  "حال",
+  "حق",
+  "رهندي",
+  "سيد",
+  "سڄو",
+  "شاعرن",
+  "شڪارپور",
+  "عڪسل",
+  "لڳا",
+  "متاثر",
+  "مري",
+  "مسلمانن",
+  "منجهان",
+  "موت",
+  "نوڪري",
+  "واقع",
+  "وسيلي",
+  "يورپ",
+  "ٻاراڻي",
+  "پار",
+  "پاسو",
+  "پهريان",
+  "ڄام",
+  "کا",
+  "ڪئي،",
+  "ڪجھ",
+  "ہے",
+  "آ",
+  "آزاديءَ",
+  "آسمان",
+  "آهستي",
+  "اديب",
+  "انگريزن",
+  "اوچتو",
+  "ايتري",
+  "تازو",
+  "تعلقي",
+  "خالي",
+  "ذهن",
+  "راءِ",
+  "رحمت",
+  "روايت",
+  "روس",
+  "سج",
+  "سدائين",
+  "سن",
+  "سنڌيءَ",
+  "سوچ",
+  "شروعات",
+  "صديءَ",
+  "علمي",
+  "فضائي",
+  "فن",
+  "لکيو",
+  "مليل",
+  "مير",
+  "ميلن",
+  "ناول",
+  "ننڍو",
+  "هندن",
+  "هوءَ",
+  "هيٺين",
+  "وطن",
+  "ويا،",
+  "ويٺل",
+  "وٺڻ",
+  "پليجي",
+  "پيج",
+  "ٿو؟",
+  "ٿوري",
+  "ٿيو،",
+  "ڀاڱي",
+  "ڀيرو",
+  "چئن",
+  "چنڊ",
+  "چينل",
+  "ڊسڪ",
+  "ڏيکاري",
+  "ڪار",
+  "ڪالم",
+  "ڪرائي",
+  "ڪوٽ",
+  "ڪيترين",
+  "ڪڇ",
+  "گهڻا",
+  "ڳايو",
+  "4",
+  "اسلامي",
+  "امن",
+  "انگريزيءَ",
+  "اهميت",
+  "تصور",
+  "توھان",
+  "حالتن",
+  "ذاتي",
+  "رهندا",
+  "سا",
+  "سائنسي",
+  "شڪار",
+  "علم",
+  "فڪري",
+  "قتل",
+  "منزل",
+  "منظور",
+  "نظام",
+  "هتان",
+  "هجڻ",
+  "هٿن",
+  "وائرس",
+  "وجود",
+  "وڃي،",
+  "وڻ",
+  "ٺاهي",
+  "ٻيهر",
+  "پئجي",
+  "چند",
+  "چپ",
+  "چڙهي",
+  "ڊراما",
+  "ڦاڪ",
+  "ڪشور",
+  "ڪمري",
+  "ڪڍي",
+  "25",
+  "آڪٽوبر",
+  "ارب",
+  "اصطلاح",
+  "ايندي",
+  "اک",
+  "بس",
+  "تاريخي",
+  "تحقيق",
+  "حڪم",
+  "سان،",
+  "ساڻ",
+  "سمجهڻ",
+  "سمن",
+  "سوين",
+  "سيڪڙو",
+  "سيگن",
+  "سگهون",
+  "شاگرد",
+  "شين",
+  "شڪست",
+  "صوبائي",
+  "علاوه",
+  "فڪر",
+  "مئي",
+  "ماحول",
+  "مارڪو",
+  "مذهب",
+  "مليا",
+  "ممڪن",
+  "موقعو",
+  "مڙني",
+  "نالا",
+  "نماز",
+  "ننڍڙي",
+  "نوان",
+  "نومبر",
+  "هئڻ",
+  "هوريان",
+  "هونديون",
+  "واريءَ",
+  "واٽ",
+  "ور",
+  "وينديون",
+  "وڏن",
+  "ٺاهڻ",
+  "پارٽي",
+  "پولو",
+  "پڙهيل",
+  "ٿر",
+  "ڇپجي",
+  "ڊي",
+  "ڌڻي",
+  "ڏاڍي",
+  "ڏس",
+  "ڪريو",
+  "گھڻ",
+  "20",
+  "6",
+  "and",
+  "آندو",
+  "امريڪا",
+  "ايڇ",
+  "اُتي",
+  "اپريل",
+  "تصوير",
+  "تي،",
+  "جديد",
+  "جنوري",
+  "جهاز",
+  "خلائي",
+  "درجي",
+  "درياهه",
+  "ديس",
+  "روز",
+  "سيپٽمبر",
+  "سگهندو",
+  "سگهيو",
+  "سگھن",
+  "شام",
+  "شيون",
+  "ع",
+  "عبداللطيف",
+  "عرصو",
+  "عظيم",
+  "فرزند",
+  "فقيرن",
+  "فيصلو",
+  "لاء",
+  "لکين",
+  "مئٽرڪ",
+  "مالڪ",
+  "متعارف",
+  "مخصوص",
+  "مناسب",
+  "منظر",
+  "منهنجا",
+  "مهراڻ",
+  "مهيا",
+  "مهيني",
+  "ميدان",
+  "ميسر",
+  "ميمبر",
+  "مٿس",
+  "ننڍا",
+  "ننڍپڻ",
+  "نويس",
+  "هئس",
+  "هلندڙ",
+  "ويڪرائي",
+  "وڊيو",
+  "ٻڌايو",
+  "ٻڌل",
+  "پهتو",
+  "پيار",
+  "ڀاءُ",
+  "چئبو",
+  "ڇڏيندا",
+  "ڇڏڻ",
+  "ڏنائين",
+  "ڏيئي",
+  "ڦاٽ",
+  "کاتي",
+  "ڪابه",
+  "ڪر",
+  "ڪرايو",
+  "ڪرڻو",
+  "ڪل",
+};
+const uint16_t WA_FREQ_142_RANKS[] = {
+  602, 893, 0, 0, 0, 366, 131, 0, 0, 0, 0, 0, 299, 776, 541, 314,
+  553, 0, 606, 457, 0, 960, 0, 205, 0, 0, 0, 0, 0, 0, 0, 392,
+  568, 792, 812, 829, 0, 0, 0, 274, 108, 734, 0, 782, 0, 0, 0, 0,
+  3, 0, 0, 0, 0, 5, 328, 935, 215, 0, 505, 773, 0, 0, 718, 0,
+  0, 791, 411, 0, 0, 953, 650, 0, 0, 745, 29, 139, 0, 468, 0, 726,
+  573, 0, 699, 884, 0, 0, 0, 0, 0, 0, 0, 95, 380, 395, 744, 0,
+  389, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 451, 460, 0, 0, 516,
+  447, 0, 0, 0, 124, 0, 0, 0, 394, 0, 225, 433, 0, 581, 746, 795,
+  774, 0, 856, 0, 0, 0, 0, 28, 0, 0, 0, 0, 862, 278, 387, 0,
+  825, 0, 0, 654, 0, 0, 540, 0, 0, 489, 565, 550, 0, 0, 0, 0,
+  0, 897, 0, 0, 0, 619, 527, 0, 618, 0, 580, 0, 0, 0, 0, 219,
+  0, 0, 0, 0, 0, 0, 719, 0, 0, 487, 0, 634, 0, 498, 0, 319,
+  0, 0, 0, 0, 587, 0, 0, 0, 39, 94, 293, 633, 667, 439, 159, 883,
+  962, 302, 0, 0, 0, 772, 0, 0, 0, 675, 819, 694, 0, 0, 107, 188,
+  507, 571, 0, 212, 0, 0, 992, 0, 0, 0, 0, 391, 596, 0, 813, 0,
+  0, 0, 0, 342, 0, 434, 160, 440, 626, 849, 490, 234, 372, 393, 971, 408,
+  0, 0, 72, 266, 991, 0, 0, 301, 166, 185, 969, 0, 0, 720, 382, 0,
+  0, 0, 0, 0, 0, 0, 0, 87, 0, 338, 0, 0, 0, 0, 0, 0,
+  0, 0, 519, 525, 0, 184, 0, 0, 0, 0, 0, 0, 0, 0, 877, 0,
+  117, 860, 0, 0, 0, 0, 148, 77, 194, 617, 462, 216, 204, 640, 281, 668,
+  370, 875, 885, 206, 405, 485, 545, 703, 899, 982, 0, 0, 0, 715, 0, 833,
+  0, 670, 0, 6, 222, 421, 181, 506, 0, 0, 0, 240, 471, 450, 0, 0,
+  685, 446, 0, 729, 0, 142, 16, 306, 418, 112, 0, 0, 0, 0, 0, 0,
+  75, 767, 0, 762, 0, 663, 631, 0, 0, 0, 0, 0, 0, 407, 681, 0,
+  0, 401, 0, 456, 0, 0, 403, 0, 847, 0, 0, 261, 0, 443, 938, 0,
+  0, 0, 0, 0, 52, 547, 0, 76, 523, 265, 990, 559, 0, 0, 0, 0,
+  0, 17, 0, 0, 0, 183, 0, 572, 71, 0, 0, 170, 0, 503, 983, 318,
+  0, 0, 304, 0, 133, 200, 0, 0, 336, 397, 714, 0, 0, 0, 0, 0,
+  197, 479, 99, 58, 0, 231, 220, 622, 637, 696, 429, 687, 951, 0, 0, 0,
+  680, 0, 0, 0, 520, 798, 211, 997, 47, 0, 0, 153, 0, 0, 0, 0,
+  0, 0, 236, 0, 0, 0, 253, 0, 889, 367, 0, 0, 0, 612, 115, 441,
+  317, 816, 482, 0, 722, 0, 743, 0, 686, 38, 0, 121, 0, 0, 0, 0,
+  766, 0, 620, 0, 709, 902, 927, 0, 0, 0, 0, 0, 655, 0, 922, 0,
+  0, 756, 239, 0, 227, 0, 161, 790, 0, 0, 0, 957, 0, 0, 0, 0,
+  295, 0, 26, 0, 0, 0, 0, 855, 0, 0, 158, 566, 0, 551, 0, 0,
+  0, 0, 410, 0, 0, 0, 0, 708, 946, 118, 353, 514, 558, 0, 195, 0,
+  518, 0, 0, 0, 0, 46, 801, 0, 0, 616, 803, 0, 712, 0, 0, 0,
+  0, 754, 0, 0, 245, 0, 959, 0, 0, 0, 396, 297, 0, 0, 140, 713,
+  0, 335, 430, 0, 0, 0, 176, 0, 276, 593, 0, 0, 217, 0, 0, 45,
+  915, 359, 799, 0, 0, 0, 0, 0, 0, 125, 85, 0, 0, 0, 0, 0,
+  0, 0, 704, 807, 0, 371, 291, 0, 0, 0, 24, 120, 868, 688, 736, 986,
+  7, 0, 797, 0, 0, 0, 0, 0, 110, 0, 0, 0, 0, 0, 0, 0,
+  0, 132, 0, 838, 576, 721, 636, 0, 0, 23, 286, 0, 0, 0, 0, 0,
+  0, 61, 0, 0, 210, 0, 0, 0, 0, 224, 307, 386, 784, 564, 896, 0,
+  237, 492, 0, 872, 0, 279, 0, 768, 546, 63, 0, 0, 0, 0, 0, 0,
+  943, 0, 822, 945, 340, 0, 796, 522, 0, 282, 254, 0, 561, 710, 0, 0,
+  0, 0, 0, 0, 248, 290, 448, 614, 739, 716, 800, 911, 104, 0, 233, 0,
+  0, 0, 985, 898, 0, 0, 378, 0, 417, 821, 332, 0, 0, 526, 0, 0,
+  258, 437, 809, 0, 49, 0, 269, 0, 0, 0, 0, 0, 0, 802, 574, 53,
+  0, 0, 127, 285, 111, 810, 84, 948, 989, 0, 0, 0, 0, 0, 0, 947,
+  0, 647, 908, 830, 0, 0, 406, 0, 778, 0, 0, 0, 0, 0, 0, 591,
+  575, 0, 0, 0, 0, 533, 0, 876, 0, 172, 873, 965, 0, 179, 535, 976,
+  589, 759, 840, 362, 0, 0, 0, 0, 0, 235, 0, 0, 313, 930, 0, 700,
+  508, 36, 548, 91, 674, 0, 698, 400, 65, 793, 0, 836, 0, 11, 0, 590,
+  226, 758, 0, 0, 874, 623, 357, 881, 0, 543, 186, 0, 0, 0, 867, 0,
+  0, 0, 0, 0, 0, 0, 344, 385, 624, 0, 0, 0, 577, 735, 0, 0,
+  264, 652, 973, 870, 0, 917, 0, 463, 0, 0, 0, 271, 0, 0, 853, 288,
+  431, 974, 0, 189, 794, 918, 0, 0, 0, 0, 549, 59, 384, 0, 0, 0,
+  0, 238, 97, 585, 901, 0, 0, 0, 321, 0, 0, 435, 597, 611, 0, 0,
+  334, 270, 0, 425, 895, 0, 0, 0, 0, 0, 0, 454, 0, 0, 613, 136,
+  0, 398, 0, 921, 1000, 103, 444, 15, 594, 609, 779, 995, 105, 426, 0, 0,
+  0, 373, 0, 0, 0, 0, 445, 78, 0, 0, 0, 262, 673, 358, 941, 0,
+  0, 162, 89, 452, 592, 0, 0, 109, 0, 0, 0, 190, 0, 627, 51, 761,
+  656, 0, 0, 588, 823, 871, 0, 0, 679, 0, 610, 865, 476, 0, 644, 669,
+  837, 34, 323, 645, 828, 916, 949, 0, 0, 0, 0, 0, 0, 924, 0, 0,
+  661, 0, 0, 0, 493, 81, 330, 842, 0, 0, 375, 763, 961, 0, 659, 0,
+  0, 0, 621, 0, 0, 0, 0, 0, 531, 764, 783, 804, 894, 0, 0, 0,
+  891, 259, 963, 0, 287, 381, 878, 0, 309, 0, 820, 0, 67, 249, 635, 705,
+  0, 824, 0, 0, 0, 80, 850, 119, 0, 458, 0, 0, 0, 0, 0, 449,
+  760, 0, 0, 0, 0, 599, 300, 469, 880, 785, 167, 950, 0, 0, 348, 0,
+  0, 0, 0, 383, 0, 0, 0, 0, 461, 0, 486, 0, 0, 0, 630, 928,
+  0, 0, 0, 0, 604, 0, 68, 0, 20, 351, 972, 0, 192, 584, 44, 692,
+  481, 771, 0, 0, 66, 657, 641, 834, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 146, 0, 96, 940, 0, 914, 0, 0, 701, 0,
+  40, 74, 128, 600, 0, 0, 968, 37, 0, 0, 0, 0, 113, 643, 0, 0,
+  171, 35, 453, 977, 0, 0, 0, 0, 846, 474, 473, 539, 4, 377, 583, 208,
+  191, 180, 750, 931, 354, 0, 0, 0, 979, 0, 0, 31, 542, 0, 60, 0,
+  368, 0, 0, 0, 727, 0, 436, 0, 0, 415, 70, 978, 0, 0, 0, 0,
+  937, 0, 273, 0, 114, 138, 529, 79, 536, 844, 256, 747, 64, 0, 858, 0,
+  0, 18, 843, 660, 0, 150, 562, 0, 864, 165, 861, 970, 0, 0, 0, 0,
+  0, 857, 141, 0, 0, 54, 742, 665, 497, 845, 174, 892, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 325, 0, 86, 923, 260, 929,
+  942, 827, 552, 888, 252, 0, 221, 0, 0, 0, 232, 268, 365, 732, 0, 0,
+  187, 0, 658, 0, 305, 0, 25, 557, 0, 324, 769, 0, 0, 241, 0, 0,
+  0, 316, 955, 0, 0, 0, 697, 733, 757, 283, 101, 524, 0, 164, 702, 263,
+  424, 515, 511, 642, 852, 920, 0, 0, 993, 0, 0, 0, 356, 0, 0, 653,
+  0, 0, 475, 0, 388, 0, 0, 629, 0, 0, 0, 43, 428, 464, 0, 0,
+  116, 502, 528, 0, 0, 0, 0, 0, 343, 996, 0, 0, 56, 333, 504, 202,
+  82, 954, 0, 1, 416, 0, 0, 0, 0, 9, 513, 677, 0, 152, 122, 472,
+  886, 595, 0, 0, 399, 749, 0, 0, 0, 0, 691, 887, 0, 510, 0, 981,
+  0, 706, 0, 193, 603, 607, 0, 0, 789, 0, 294, 0, 0, 738, 0, 0,
+  0, 0, 0, 0, 0, 848, 275, 470, 0, 0, 0, 0, 866, 0, 695, 984,
+  0, 0, 805, 467, 672, 42, 327, 944, 0, 484, 0, 0, 363, 0, 0, 0,
+  0, 0, 0, 466, 601, 777, 0, 0, 0, 0, 0, 0, 0, 0, 639, 0,
+  0, 0, 0, 586, 438, 646, 649, 879, 999, 0, 0, 0, 0, 0, 0, 0,
+  196, 0, 0, 994, 0, 0, 615, 246, 765, 775, 480, 228, 909, 0, 339, 331,
+  582, 863, 12, 2, 0, 0, 199, 0, 0, 0, 0, 289, 0, 0, 201, 0,
+  0, 570, 346, 919, 967, 298, 664, 814, 0, 41, 693, 770, 0, 0, 0, 684,
+  0, 0, 936, 939, 0, 272, 0, 0, 0, 155, 707, 0, 0, 0, 0, 906,
+  0, 826, 933, 988, 0, 0, 0, 926, 379, 488, 671, 0, 0, 0, 0, 569,
+  666, 787, 841, 491, 154, 409, 134, 818, 501, 851, 0, 0, 0, 455, 404, 678,
+  229, 910, 0, 247, 651, 50, 0, 0, 341, 0, 0, 0, 500, 477, 284, 0,
+  175, 218, 420, 815, 741, 0, 257, 0, 390, 0, 0, 0, 0, 956, 0, 21,
+  0, 0, 442, 0, 0, 0, 676, 88, 483, 13, 0, 0, 495, 0, 145, 0,
+  0, 48, 0, 0, 0, 352, 326, 106, 329, 964, 0, 0, 0, 0, 780, 554,
+  0, 465, 151, 682, 900, 0, 0, 0, 905, 752, 277, 0, 0, 0, 0, 0,
+  0, 296, 255, 0, 0, 0, 0, 0, 0, 0, 869, 0, 147, 478, 987, 0,
+  0, 0, 689, 0, 0, 0, 786, 0, 0, 102, 0, 0, 137, 157, 156, 648,
+  509, 0, 0, 98, 724, 0, 0, 0, 267, 831, 0, 0, 223, 361, 376, 130,
+  0, 0, 0, 73, 0, 0, 521, 0, 0, 0, 27, 0, 0, 605, 0, 0,
+  33, 0, 0, 0, 0, 0, 0, 32, 280, 413, 494, 499, 0, 10, 0, 934,
+  0, 925, 0, 123, 730, 0, 168, 0, 90, 0, 310, 980, 209, 0, 169, 859,
+  882, 419, 0, 0, 360, 0, 0, 0, 932, 62, 459, 135, 560, 0, 0, 788,
+  0, 0, 0, 0, 0, 0, 173, 214, 14, 0, 0, 0, 625, 0, 244, 538,
+  753, 0, 242, 243, 532, 998, 0, 427, 806, 0, 0, 0, 740, 369, 0, 0,
+  0, 0, 0, 93, 177, 683, 0, 912, 958, 0, 0, 0, 0, 0, 0, 143,
+  0, 811, 230, 0, 251, 808, 0, 414, 0, 0, 0, 126, 311, 0, 0, 182,
+  0, 0, 303, 0, 250, 598, 0, 0, 534, 100, 422, 0, 349, 0, 0, 322,
+  496, 517, 817, 839, 412, 731, 163, 0, 737, 0, 355, 0, 728, 717, 0, 0,
+  537, 0, 0, 0, 0, 0, 0, 0, 723, 0, 0, 320, 751, 0, 198, 578,
+  0, 0, 312, 0, 907, 0, 0, 0, 203, 890, 904, 952, 0, 608, 0, 0,
+  835, 0, 0, 854, 0, 0, 0, 22, 711, 832, 92, 0, 0, 0, 0, 0,
+  0, 0, 315, 0, 555, 345, 144, 69, 350, 364, 402, 0, 213, 129, 337, 628,
+  0, 57, 0, 690, 0, 55, 975, 0, 0, 0, 0, 0, 0, 755, 83, 0,
+  0, 748, 0, 579, 0, 0, 374, 0, 0, 0, 0, 544, 0, 0, 0, 556,
+  0, 0, 632, 0, 30, 638, 913, 0, 0, 149, 207, 0, 0, 308, 567, 178,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 966, 662, 0, 0, 8, 0, 0,
+  0, 563, 0, 0, 0, 781, 725, 0, 347, 512, 423, 432, 530, 903, 0, 292,
+};
+
+const char *WA_FREQ_143_TOKENS[] = {
+  "و",
+  "نە",
+  "ماڵ",
+  "ئیوە",
+  "شەۊ",
+  "شواڵ",
+  "کەنە",
+  "وەر",
+  "خوەم",
+  "خوەد",
+  "خوەێ",
+  "خوەمان",
+  "خوەدان",
+  "خوەێان",
+  "گەرد",
+  "یەک",
+  "چیمن",
+  "کا",
+  "دز",
+  "گریا",
+  "مدوو",
+  "مردن",
+  "نادیاره",
+  "من",
+  "کومەکێ",
+  "کردم",
+  "تا",
+  "لە",
+  "خیاوانەگە",
+  "ڕەد",
+  "بوو",
+  "بوسیه",
+  "یا",
+  "دەمە",
+  "لێد",
+  "پام",
+  "تەزیا",
+  "ئەو",
+  "چشتە",
+  "خوەیان",
+  "نۊسانه",
+  "ئەوان",
+  "کتاوەگان",
+  "بەسایۊن",
+};
+const uint16_t WA_FREQ_143_RANKS[] = {
+  15, 0, 0, 0, 0, 0, 0, 0, 38, 44, 0, 0, 3, 12, 0, 0,
+  0, 0, 0, 26, 0, 14, 0, 0, 0, 0, 0, 8, 0, 0, 0, 5,
+  0, 0, 0, 16, 24, 0, 0, 31, 23, 0, 2, 0, 0, 0, 0, 0,
+  25, 11, 37, 0, 22, 0, 0, 41, 0, 0, 0, 18, 4, 21, 35, 0,
+  0, 0, 9, 0, 0, 6, 0, 27, 13, 0, 20, 0, 0, 0, 0, 0,
+  0, 34, 0, 7, 0, 0, 0, 0, 0, 0, 32, 0, 1, 0, 30, 0,
+  0, 0, 0, 0, 36, 0, 0, 42, 0, 10, 28, 0, 40, 29, 0, 39,
+  43, 0, 0, 0, 17, 0, 19, 33, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+const char *WA_FREQ_144_TOKENS[] = {
+  "ad",
+  "ar",
+  "ɣ",
+  "lliɣ",
+  "ur",
+  "iqqan",
+  "k",
+  "id",
+  "as",
+  "tssfldt",
+  "tirmt",
+  "nnm",
+  "tkkrm",
+  "man",
+  "anaw",
+  "n",
+  "tunnut",
+  "tskart",
+  "rad",
+  "ɣinn",
+  "iliɣ",
+  "yat",
+  "tsragt",
+  "tom",
+  "ixṣṣa",
+  "icwwṛ",
+  "f",
+  "ugayyu",
+  "nns",
+  "ɣassad",
+  "nga",
+  "islman",
+  "i",
+  "imnsi",
+  "wabiba",
+  "ittasi",
+  "malarya",
+  "tusrmt",
+  "maya",
+  "harvard",
+  "akud",
+  "gis",
+  "illa",
+  "ṭum",
+  "d",
+  "mari",
+  "iɣ",
+  "tram",
+  "tfkm",
+  "awal",
+  "ha",
+  "nn",
+  "awn",
+  "t",
+  "isɣi",
+  "yan",
+};
+const uint16_t WA_FREQ_144_RANKS[] = {
+  27, 0, 0, 0, 0, 0, 0, 0, 10, 40, 0, 0, 0, 0, 0, 0,
+  9, 0, 0, 30, 0, 0, 0, 11, 0, 0, 29, 0, 13, 0, 0, 7,
+  34, 0, 54, 19, 26, 41, 47, 53, 0, 0, 17, 0, 36, 0, 45, 0,
+  0, 55, 0, 0, 0, 6, 0, 15, 0, 1, 0, 0, 23, 0, 14, 21,
+  37, 39, 35, 50, 4, 44, 48, 0, 0, 0, 0, 0, 0, 0, 0, 16,
+  0, 3, 0, 0, 52, 0, 0, 0, 20, 38, 18, 0, 0, 0, 0, 0,
+  46, 0, 49, 2, 56, 0, 0, 12, 0, 0, 32, 0, 0, 0, 33, 24,
+  28, 43, 0, 0, 22, 0, 0, 8, 25, 5, 42, 31, 51, 0, 0, 0,
+};
+
+const char *WA_FREQ_145_TOKENS[] = {
+  "හා",
+  "ඇති",
+  "මේ",
+  "අතර",
+  "සහ",
+  "සඳහා",
+  "වන",
+  "මෙම",
+  "ලෙස",
+  "ද",
+  "ඒ",
+  "කරන",
+  "වූ",
+  "විය",
+  "ඇත",
+  "බව",
+  "කළ",
+  "කර",
+  "වේ",
+  "දී",
+  "නම්",
+  "එය",
+  "විසින්",
+  "නිසා",
+  "හෝ",
+  "එම",
+  "ලැබී",
+  "යන",
+  "ඔහු",
+  "ප‍්‍රතිචාර",
+  "ශ්‍රී",
+  "වී",
+  "කිරීම",
+  "විට",
+  "එහි",
+  "කිරීමට",
+  "වැනි",
+  "සිට",
+  "ගැන",
+  "වශයෙන්",
+  "අනුව",
+  "සිදු",
+  "හැකි",
+  "නමුත්",
+  "ක්",
+  "ලබා",
+  "අපේ",
+  "බොහෝ",
+  "වල",
+  "මෙය",
+  "ලද",
+  "වඩා",
+  "වන්නේ",
+  "වැඩි",
+  "සමග",
+  "ලදී",
+  "මගින්",
+  "කරයි",
+  "කටයුතු",
+  "බවට",
+  "යනු",
+  "තුළ",
+  "නැහැ",
+  "එක්",
+  "ගෙන",
+  "කරන්න",
+  "ලංකාවේ",
+  "අපි",
+  "මම",
+  "අය",
+  "වලට",
+  "එක",
+  "පසු",
+  "පත්",
+  "අද",
+  "පමණ",
+  "තවත්",
+  "තම",
+  "ඉතා",
+  "කියලා",
+  "ලංකා",
+  "මත",
+  "ඔවුන්",
+  "විශාල",
+  "දක්වා",
+  "ගත",
+  "වගේ",
+  "ගැනීමට",
+  "භාවිතා",
+  "හැක",
+  "මහතා",
+  "තමයි",
+  "ඔහුගේ",
+  "ඒවා",
+  "යුතු",
+  "වලින්",
+  "කරනු",
+  "ජාතික",
+  "දැන්",
+  "ඇත්තේ",
+  "පිළිබඳ",
+  "සිටි",
+  "පසුව",
+  "තිබේ",
+  "නෑ",
+  "වැඩ",
+  "කල",
+  "හැකිය",
+  "වෙයි",
+  "සදහා",
+  "රටේ",
+  "විවිධ",
+  "දින",
+  "පෙර",
+  "මහා",
+  "වීම",
+  "බවත්",
+  "වු",
+  "යන්න",
+  "එක්සත්",
+  "ප්‍රධාන",
+  "ඊට",
+  "යොදා",
+  "ගත්",
+  "වෙනස්",
+  "වසර",
+  "වූයේ",
+  "නව",
+  "සිටින",
+  "කොට",
+  "ගන්නා",
+  "නැති",
+  "මෙහි",
+  "පවතින",
+  "ගිය",
+  "නැත",
+  "ගැනීම",
+  "මට",
+  "රට",
+  "පළමු",
+  "බවයි",
+  "ඉදිරිපත්",
+  "කරමින්",
+  "කළේය",
+  "ඔය",
+  "යැයි",
+  "අවසන්",
+  "ගන්න",
+  "කිරීමේ",
+  "නිර්මාණය",
+  "ඇය",
+  "ලැබේ",
+  "සිය",
+  "පමණක්",
+  "කියන",
+  "සමඟ",
+  "කරන්නේ",
+  "අඩු",
+  "කුඩා",
+  "හරි",
+  "ආරම්භ",
+  "කොළඹ",
+  "ශ්‍රී ලංකා",
+  "මෙන්ම",
+  "අයත්",
+  "සහිත",
+  "තුල",
+  "සමහර",
+  "ලබන",
+  "ලෝක",
+  "වෙනත්",
+  "අවශ්‍ය",
+  "සඳහන්",
+  "වෙනුවෙන්",
+  "ගුවන්",
+  "වැදගත්",
+  "ගමන්",
+  "පිළිබඳව",
+  "ඔබ",
+  "නැවත",
+  "ඉන්න",
+  "සොයා",
+  "වෙන්න",
+  "මස",
+  "දකුණු",
+  "එහෙත්",
+  "හමුදා",
+  "හි",
+  "කියා",
+  "ස",
+  "විශේෂ",
+  "සම්බන්ධ",
+  "වෙත",
+  "මුල්",
+  "දෙයක්",
+  "නොවන",
+  "පාලනය",
+  "කාලය",
+  "කෙසේ",
+  "ඔවුන්ගේ",
+  "යුතුය",
+  "වාර්තා",
+  "පවතී",
+  "මහ",
+  "දේශපාලන",
+  "මේවා",
+  "දෙන",
+  "කතා",
+  "යම්",
+  "ලකුණු",
+  "දේ",
+  "මගේ",
+  "ඇතැයි",
+  "රාජ්‍ය",
+  "අයට",
+  "යටතේ",
+  "කළේ",
+  "අප",
+  "සිංහල",
+  "ශ්‍රී ලංකාවේ",
+  "ලංකාව",
+  "මෙවැනි",
+  "වීමට",
+  "තව",
+  "නොවේ",
+  "ඇතුළු",
+  "පිහිටි",
+  "මීට",
+  "යුතුයි",
+  "ඉහළ",
+  "එකක්",
+  "වෙලා",
+  "වෙන",
+  "වඩාත්",
+  "එසේ",
+  "පුරා",
+  "මඟින්",
+  "තිබූ",
+  "ආර්ථික",
+  "ඒක",
+  "මුදල්",
+  "ක",
+  "රුපියල්",
+  "අදහස්",
+  "අවුරුදු",
+  "නොහැකි",
+  "තරම්",
+  "කට",
+  "ගේ",
+  "විද්‍යාව",
+  "ලබයි",
+  "ඔහුට",
+  "කියන්නේ",
+  "රජය",
+  "දක්නට",
+  "අපට",
+  "පරිදි",
+  "කරලා",
+  "පොලිස්",
+  "ඉන්",
+  "ඉවත්",
+  "දෙන්න",
+  "සම්බන්ධයෙන්",
+  "සෑම",
+  "ජනතාව",
+  "එරෙහිව",
+  "ඒත්",
+  "නීති",
+  "කියයි",
+  "රටවල්",
+  "ට",
+  "දෙකක්",
+  "එපා",
+  "මේක",
+  "ගොස්",
+  "යයි",
+  "සාමාන්‍ය",
+  "එකම",
+  "සමාජ",
+  "වහන්සේ",
+  "බලය",
+  "කරනවා",
+  "නීතිය",
+  "හරහා",
+  "එල්ල",
+  "වෙනවා",
+  "තියෙන්නේ",
+  "තරග",
+  "තොරතුරු",
+  "එනම්",
+  "අනෙකුත්",
+  "වර්ග",
+  "නිදහස්",
+  "පිහිටා",
+  "ඇතැම්",
+  "දේවල්",
+  "ම",
+  "වර්ධනය",
+  "එන",
+  "හේතු",
+  "හොඳ",
+  "කොටස්",
+  "එහෙම",
+  "පැවැති",
+  "ලංකාවට",
+  "18",
+  "තීරණය",
+  "පැවති",
+  "කාලයක්",
+  "හේතුවෙන්",
+  "කියල",
+  "දැඩි",
+  "නොව",
+  "පොලිසිය",
+  "තිබෙන",
+  "ක්‍රියාත්මක",
+  "බටහිර",
+  "පිරිසක්",
+  "අනෙක්",
+  "ගනී",
+  "තියෙනවා",
+  "ලදි",
+  "ජනාධිපති",
+  "සංවිධානය",
+  "වුවද",
+  "බෞද්ධ",
+  "වසරේ",
+  "ආහාර",
+  "මූලික",
+  "ප්‍රකාශ",
+  "විස්තර",
+  "සමාන",
+  "සේවය",
+  "කෙරේ",
+  "තමා",
+  "වෙන්නේ",
+  "යොමු",
+  "පොදු",
+  "රජයේ",
+  "ඕන",
+  "මොකද",
+  "මෙන්",
+  "මෙසේ",
+  "හොද",
+  "මෙහිදී",
+  "පවා",
+  "ලෝකයේ",
+  "පුළුවන්",
+  "උතුරු",
+  "හේතුව",
+  "ජනවාරි",
+  "වෛද්‍ය",
+  "අමතරව",
+  "ඉඩ",
+  "ප්‍රථම",
+  "අපිට",
+  "එයට",
+  "පැමිණි",
+  "පසුගිය",
+  "ලොකු",
+  "ය.",
+  "ලක්",
+  "ජලය",
+  "රජු",
+  "නමින්",
+  "පැහැදිලි",
+  "වැනිදා",
+  "මා",
+  "දිය",
+  "ලෙසින්",
+  "බලන්න",
+  "වූහ",
+  "තමන්",
+  "ලොව",
+  "ඇයි",
+  "මිනිස්සු",
+  "ජාත්‍යන්තර",
+  "පටන්",
+  "හිටපු",
+  "බලා",
+  "හිමි",
+  "සාමාන්‍යයෙන්",
+  "කරුණු",
+  "පාසල්",
+  "එමෙන්ම",
+  "කළා",
+  "බැවින්",
+  "තියෙන",
+  "කාලයේ",
+  "මිනිසුන්",
+  "කරගෙන",
+  "දෙවැනි",
+  "ලැබෙන",
+  "මානව",
+  "අධික",
+  "රටට",
+  "එහිදී",
+  "නේද",
+  "පිල",
+  "හෙවත්",
+  "කිරීමෙන්",
+  "දන්නේ",
+  "විනාශ",
+  "ලැබූ",
+  "පහර",
+  "ආරක්ෂක",
+  "නිකුත්",
+  "ජීවත්",
+  "දියුණු",
+  "හට",
+  "සිදුවන",
+  "හැකියාව",
+  "එවැනි",
+  "රටවල",
+  "කිහිපයක්",
+  "කෙනෙක්",
+  "නියම",
+  "ක්‍රමය",
+  "2",
+  "එසේම",
+  "ඔබට",
+  "ටික",
+  "දෙමළ",
+  "බුදු",
+  "කළහ",
+  "කිසිම",
+  "සියලු",
+  "තබා",
+  "මාර්ග",
+  "කණ්ඩායම්",
+  "තවද",
+  "දුන්",
+  "හැම",
+  "පළාත්",
+  "නම",
+  "මාධ්‍ය",
+  "දැනට",
+  "සමත්",
+  "විශ්වාස",
+  "අත්අඩංගුවට",
+  "පහළ",
+  "සේවා",
+  "තමන්ගේ",
+  "නොමැති",
+  "දෙනෙක්",
+  "ගල්",
+  "සමන්විත",
+  "ක්‍රියා",
+  "අවස්ථාව",
+  "පහත",
+  "රෝග",
+  "එකතු",
+  "පැමිණ",
+  "ආකාරයට",
+  "හමුදාව",
+  "දෙක",
+  "විශ්ව",
+  "ශී‍්‍ර",
+  "ක්‍රම",
+  "වැඩක්",
+  "තෙල්",
+  "ජල",
+  "දෙවන",
+  "එදා",
+  "කලින්",
+  "කියන්න",
+  "සුළු",
+  "සිටියේ",
+  "යුද",
+  "ලද්දේ",
+  "පැරණි",
+  "භාවිත",
+  "වැරදි",
+  "ඉල්ලා",
+  "විදුලි",
+  "ඇතුළත්",
+  "තිබුණි",
+  "ගනු",
+  "මුළු",
+  "කෙරෙහි",
+  "වෙන්",
+  "මිල",
+  "ශ්‍රී ලංකාව",
+  "ජනපති",
+  "ගැනීමේ",
+  "ආගමික",
+  "තත්ත්වය",
+  "පමණි",
+  "2013",
+  "ආදී",
+  "පරිගණක",
+  "ලැබීය",
+  "බල",
+  "නිෂ්පාදනය",
+  "ප්‍රමාණය",
+  "රැගෙන",
+  "මුස්ලිම්",
+  "උසස්",
+  "බස්",
+  "සටන්",
+  "ක‍්‍රීඩා",
+  "කි",
+  "ප්‍රමාණයක්",
+  "ඉන්නේ",
+  "ජය",
+  "මැතිවරණ",
+  "මෙහෙම",
+  "නැගෙනහිර",
+  "සේ",
+  "කොටි",
+  "වුවත්",
+  "10",
+  "ඡන්ද",
+  "නායක",
+  "පිරිස",
+  "අනතුරුව",
+  "නගරය",
+  "අධ්‍යාපන",
+  "වලදී",
+  "ගත්තේය",
+  "කිසිදු",
+  "සකස්",
+  "දරුවන්",
+  "වෙනුවට",
+  "චෝදනා",
+  "විද්‍යාත්මක",
+  "ගොඩ",
+  "3",
+  "සිකුරාදා",
+  "අදාල",
+  "පවසයි",
+  "යනුවෙන්",
+  "ශාක",
+  "පෙන්වා",
+  "මුහුණ",
+  "ස්ථානය",
+  "නිර්මාණ",
+  "අවස්ථා",
+  "මැද",
+  "නැත්නම්",
+  "ඉන්දියාවේ",
+  "ආ",
+  "සල්ලි",
+  "දත්ත",
+  "4",
+  "රජ",
+  "මිලියන",
+  "ගිහින්",
+  "අනේ",
+  "ක්‍රීඩා",
+  "කොටසක්",
+  "බැරි",
+  "ව",
+  "1",
+  "දුම්රිය",
+  "මුහුදු",
+  "ක‍්‍රිකට්",
+  "මෙයට",
+  "නගර",
+  "ප‍්‍රධාන",
+  "තවමත්",
+  "වුණා",
+  "පෞද්ගලික",
+  "මිය",
+  "අඩංගු",
+  "20",
+  "ඔවුන්ට",
+  "සුදු",
+  "වගේම",
+  "වෙමින්",
+  "කාල",
+  "ජන",
+  "නැතිව",
+  "උත්සාහ",
+  "ප්‍රදේශ",
+  "කණ්ඩායම",
+  "අගය",
+  "විවෘත",
+  "බවය",
+  "සිවිල්",
+  "ආයතන",
+  "භාණ්ඩ",
+  "මාස",
+  "තුළින්",
+  "විදියට",
+  "වෙඩි",
+  "දෙවියන්",
+  "ඉහත",
+  "ඉන්නවා",
+  "කින්",
+  "තිබුණේ",
+  "නුවර",
+  "අවසාන",
+  "ගිනි",
+  "ඉදිරියට",
+  "ඉන්දීය",
+  "නගරයේ",
+  "තිබෙනවා",
+  "පිළිබද",
+  "කලා",
+  "සිදුවිය",
+  "ගියේය",
+  "තරගය",
+  "එකට",
+  "ගනිමින්",
+  "අතින්",
+  "ආකාරය",
+  "ශක්තිය",
+  "යුද්ධය",
+  "අඩි",
+  "ලක්ෂණ",
+  "ස්ථාන",
+  "මහනුවර",
+  "පළ",
+  "ලබන්නේ",
+  "අතරින්",
+  "අපරාධ",
+  "පරාජය",
+  "යුත්",
+  "තුවාල",
+  "මාර්ගය",
+  "පෙනී",
+  "දැකිය",
+  "සභා",
+  "වයස",
+  "ඕනෑම",
+  "කිරීම්",
+  "තරගාවලියේ",
+  "5",
+  "නිල",
+  "මධ්‍යම",
+  "යන්නේ",
+  "තැන",
+  "ඉතින්",
+  "දිනා",
+  "නිසාය",
+  "ය",
+  "යාමට",
+  "ලේකම්",
+  "ආයතනය",
+  "වර්ෂ",
+  "එක්ක",
+  "අධ්‍යාපනය",
+  "දීමට",
+  "පදනම්",
+  "මිනිස්",
+  "බවද",
+  "කෙරෙන",
+  "පැය",
+  "උදාහරණයක්",
+  "සිටියේය",
+  "ඡායාරූප",
+  "වනුයේ",
+  "ජීවිත",
+  "ආණ්ඩුව",
+  "ඔස්සේ",
+  "ඇගේ",
+  "සීමා",
+  "ටෙස්ට්",
+  "ආරක්ෂා",
+  "දක්වන",
+  "වර්තමානයේ",
+  "ගෙදර",
+  "ආසන්න",
+  "ද්‍රව්‍ය",
+  "විද්‍යා",
+  "ඇමරිකානු",
+  "වාහන",
+  "අවම",
+  "කරපු",
+  "පාලන",
+  "භෞතික",
+  "වෙතත්",
+  "තෙක්",
+  "පිට",
+  "ගණන්",
+  "පිරිමි",
+  "සතුන්",
+  "සියල්ල",
+  "දිග",
+  "එයින්",
+  "දෙනා",
+  "රන්",
+  "වුයේ",
+  "තිබිණි",
+  "විසිනි",
+  "යළි",
+  "ආචාර්ය",
+  "ජනතාවට",
+  "විශේෂයෙන්",
+  "අන්තර්",
+  "ඇමැති",
+  "ඉතිහාසය",
+  "උප",
+  "ඔවුහු",
+  "එතකොට",
+  "පන්දු",
+  "අර්ථ",
+  "නඩු",
+  "නැතුව",
+  "ගණනක්",
+  "ඉන්දියාව",
+  "පියවර",
+  "සහභාගි",
+  "කිරි",
+  "යුගයේ",
+  "නැද්ද",
+  "පර්යේෂණ",
+  "ක්‍රි",
+  "විදේශ",
+  "කරති",
+  "චිත්‍රපට",
+  "නිෂ්පාදන",
+  "දැක",
+  "සැප්තැම්බර්",
+  "යි",
+  "ගොඩක්",
+  "තිබුණා",
+  "නාට්‍ය",
+  "කිසියම්",
+  "දමා",
+  "සටහන්",
+  "ඕනෑ",
+  "සම්පූර්ණ",
+  "15",
+  "අවධානය",
+  "ඒවායේ",
+  "පැවැත්වෙන",
+  "බැහැ",
+  "වෙබ්",
+  "වෙති",
+  "පාර",
+  "දැක්විය",
+  "චීන",
+  "දැන",
+  "අදාළ",
+  "සාර්ථක",
+  "සැලසුම්",
+  "12",
+  "සිටිති",
+  "තුනක්",
+  "ජීවිතය",
+  "තෝරා",
+  "බලපෑම්",
+  "දා",
+  "පුළුල්",
+  "නිදහස",
+  "බ්‍රිතාන්‍ය",
+  "දීම",
+  "නියෝජනය",
+  "සමාජය",
+  "හැර",
+  "තේරුම්",
+  "ඇතිවන",
+  "ගියේ",
+  "තහනම්",
+  "කාන්තා",
+  "හානි",
+  "සුදුසු",
+  "රසායනික",
+  "ඉංග්‍රීසි",
+  "6",
+  "තනි",
+  "ප්‍රශ්න",
+  "බර",
+  "ගත්තේ",
+  "තේ",
+  "පත්ව",
+  "වීමෙන්",
+  "සැලකිය",
+  "සෞඛ්‍ය",
+  "සියලූ",
+  "සම්පත්",
+  "ජනතා",
+  "සභාපති",
+  "අති",
+  "තරුණ",
+  "ජාතීන්ගේ",
+  "ප්‍රදේශයේ",
+  "මහත්",
+  "යනවා",
+  "සිල්වා",
+  "මහජන",
+  "අලි",
+  "පවත්වා",
+  "ඔලිම්පික්",
+  "වටා",
+  "යුධ",
+  "අංශ",
+  "ඉහල",
+  "පහසුකම්",
+  "සම්මත",
+  "අසල",
+  "ක්‍රිකට්",
+  "සංවර්ධනය",
+  "අර",
+  "පොඩි",
+  "විද්‍යුත්",
+  "අත්",
+  "අධ්‍යයනය",
+  "කරන්නට",
+  "19",
+  "එන්න",
+  "කතරගම",
+  "තරගාවලිය",
+  "දේශීය",
+  "සංගීත",
+  "සමාගම",
+  "වායු",
+  "තත්වය",
+  "භූ",
+  "සිටී",
+  "සිදුවූ",
+  "සිදුවේ",
+  "කඩා",
+  "ඉටු",
+  "කියති",
+  "සංඛ්‍යාව",
+  "තවදුරටත්",
+  "දුර",
+  "කාර්ය",
+  "යෝජනා",
+  "දඩුවම්",
+  "ඉතාමත්",
+  "විතරයි",
+  "අතට",
+  "තහවුරු",
+  "වර්ණ",
+  "කී",
+  "කෙටි",
+  "සියවසේ",
+  "පද්ධතිය",
+  "බෝම්බ",
+  "වගා",
+  "මහතාගේ",
+  "ඝාතනය",
+  "මහින්ද",
+  "රූප",
+  "අල්",
+  "සංගමය",
+  "දිගටම",
+  "පද්ධති",
+  "එමගින්",
+  "නාවික",
+  "යානා",
+  "මරණ",
+  "ඇයට",
+  "කිරීමයි",
+  "මානසික",
+  "ඩොලර්",
+  "රජයට",
+  "සාධක",
+  "කොහොමද",
+  "මීටර්",
+  "දිනය",
+  "11",
+  "ලක්ෂ",
+  "අදහස",
+  "අනිත්",
+  "මරා",
+  "යාම",
+  "නිසි",
+  "භාෂාව",
+  "මල්",
+  "ඇවිත්",
+  "නෙමෙයි",
+  "නිලධාරීන්",
+  "අන්තර්ජාතික",
+  "කළු",
+  "පොලීසිය",
+  "බුදුන්",
+  "මෙහෙයුම්",
+  "ඉන්දියානු",
+  "16",
+  "මණ්ඩලය",
+  "හඳුන්වා",
+  "වනවිට",
+  "වීමේ",
+  "ආදිය",
+  "පියා",
+  "දෙදෙනා",
+  "අත",
+  "තමන්ට",
+  "තොරව",
+  "විද්‍යාවේ",
+  "පස්සේ",
+  "හැබැයි",
+  "හොදයි",
+  "යටත්",
+  "මුලින්ම",
+  "උපදෙස්",
+  "පත්විය",
+  "අනුගමනය",
+  "පරීක්ෂණ",
+  "බලාපොරොත්තු",
+  "නතර",
+  "විවාහ",
+  "පක්ෂ",
+  "කල්",
+  "ඓතිහාසික",
+  "කැර",
+  "නිවැරදි",
+  "රටක්",
+  "අරමුණ",
+  "රජුගේ",
+  "නූතන",
+  "පවත්වාගෙන",
+  "මග",
+  "ආරක්ෂාව",
+  "ගස්",
+  "හමුවේ",
+  "රතු",
+  "සමාජයේ",
+  "සදහන්",
+  "පිළිබදව",
+  "හරියට",
+  "සහාය",
+  "සිටියහ",
+  "බිහි",
+  "වරක්",
+  "ඇත්තටම",
+  "පස්",
+  "පුද්ගලයන්",
+  "ඉතිරි",
+  "ලෙසද",
+  "කිරිම",
+  "රථ",
+  "ආසියානු",
+  "සත්‍ය",
+  "2012",
+  "අවට",
+  "ඇමෙරිකා",
+  "බෑ",
+  "කරා",
+  "ලෝකය",
+  "නැවතත්",
+  "ඇතුලත්",
+  "13",
+  "පුවත්",
+  "අංක",
+  "යුක්ත",
+  "වතුර",
+  "සතු",
+  "සමයේ",
+  "මැයි",
+  "සියලුම",
+  "හොඳින්",
+  "නෙවෙයි",
+  "පිණිස",
+  "සියළු",
+  "පාර්ලිමේන්තු",
+  "දිගු",
+  "ප්‍රදේශය",
+  "ප‍්‍රකාශ",
+  "වසරේදී",
+  "30",
+  "අරමුණු",
+  "එවිට",
+  "මෙලෙස",
+  "කලාව",
+  "7",
+  "ඇයගේ",
+  "ගන්නේ",
+  "දෙනකු",
+  "බිම්",
+  "බෙදා",
+  "සාකච්ඡා",
+  "සම්මාන",
+  "අගමැති",
+  "ආපසු",
+  "පෙන්නුම්",
+  "බුද්ධ",
+  "අවි",
+  "නමැති",
+  "මොන",
+  "වනු",
+  "හිමිකම්",
+  "අයගේ",
+  "මතු",
+  "ලැබුණු",
+  "කතාව",
+  "පුලුවන්",
+  "ඇමෙරිකාව",
+  "ගියා",
+  "භූමි",
+  "උපකරණ",
+  "නිරූපණය",
+  "භාවිතය",
+  "14",
+  "කි‍්‍රකට්",
+  "සංවිධාන",
+  "කඩුලූ",
+  "වෙළඳ",
+  "ජනපද",
+  "වත්",
+  "දෙයි",
+  "කුසලාන",
+  "දායක",
+  "ඉතාම",
+  "උපත",
+};
+const uint16_t WA_FREQ_145_RANKS[] = {
+  0, 0, 0, 60, 471, 0, 701, 711, 379, 420, 166, 760, 145, 176, 0, 0,
+  0, 0, 307, 339, 879, 0, 0, 0, 0, 0, 0, 892, 875, 242, 865, 0,
+  0, 0, 674, 0, 495, 0, 0, 788, 966, 0, 24, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 36, 47, 0, 0, 51, 0,
+  0, 0, 0, 48, 0, 468, 124, 131, 794, 0, 0, 0, 491, 520, 843, 0,
+  0, 118, 120, 810, 0, 0, 0, 0, 0, 0, 0, 282, 0, 961, 0, 12,
+  0, 0, 0, 0, 0, 0, 363, 0, 0, 0, 0, 0, 259, 284, 0, 326,
+  0, 0, 0, 0, 0, 0, 985, 394, 449, 0, 0, 0, 381, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 218, 0, 0, 0, 0, 726,
+  333, 799, 684, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 185, 0, 0,
+  443, 0, 0, 0, 43, 0, 0, 0, 0, 0, 0, 0, 0, 0, 403, 0,
+  754, 203, 297, 0, 517, 0, 10, 206, 900, 919, 383, 0, 0, 870, 0, 994,
+  402, 963, 404, 169, 952, 50, 964, 0, 0, 0, 0, 136, 0, 344, 0, 405,
+  0, 836, 0, 72, 821, 0, 0, 0, 0, 250, 414, 0, 0, 0, 0, 0,
+  99, 461, 930, 0, 163, 0, 681, 765, 103, 0, 0, 15, 0, 0, 0, 329,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 371, 0, 0, 0,
+  0, 0, 66, 0, 601, 0, 533, 0, 0, 100, 0, 146, 0, 0, 0, 0,
+  0, 0, 0, 0, 375, 740, 0, 0, 0, 0, 775, 0, 992, 0, 835, 89,
+  219, 868, 0, 382, 0, 514, 2, 162, 0, 0, 396, 106, 0, 0, 224, 0,
+  0, 0, 178, 272, 112, 135, 487, 223, 0, 948, 0, 988, 0, 0, 0, 0,
+  872, 0, 0, 626, 883, 0, 0, 0, 389, 70, 661, 0, 0, 0, 534, 27,
+  0, 0, 0, 255, 840, 0, 0, 0, 0, 0, 230, 426, 855, 305, 561, 0,
+  456, 42, 0, 412, 93, 0, 0, 0, 0, 68, 518, 26, 341, 0, 370, 703,
+  624, 262, 504, 599, 873, 0, 0, 0, 0, 751, 853, 0, 0, 0, 435, 500,
+  574, 667, 321, 741, 308, 757, 731, 904, 3, 955, 0, 0, 776, 747, 0, 0,
+  0, 521, 52, 266, 997, 0, 181, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  67, 744, 0, 0, 0, 0, 359, 0, 0, 343, 563, 0, 0, 301, 0, 0,
+  0, 119, 248, 781, 349, 512, 550, 54, 94, 856, 965, 0, 57, 177, 0, 503,
+  0, 820, 34, 467, 0, 0, 0, 0, 455, 0, 0, 716, 984, 0, 365, 981,
+  0, 585, 0, 0, 0, 0, 392, 437, 823, 0, 910, 940, 0, 0, 696, 0,
+  0, 709, 970, 0, 0, 0, 325, 113, 654, 0, 0, 0, 142, 0, 0, 0,
+  0, 232, 753, 0, 0, 0, 0, 0, 409, 0, 37, 82, 65, 110, 398, 423,
+  309, 132, 686, 768, 979, 0, 927, 0, 221, 0, 0, 0, 0, 0, 0, 0,
+  0, 499, 671, 0, 252, 235, 505, 31, 361, 187, 557, 982, 0, 572, 150, 991,
+  0, 0, 0, 0, 0, 69, 0, 253, 6, 338, 617, 0, 40, 0, 292, 376,
+  9, 362, 0, 0, 0, 0, 0, 0, 0, 0, 0, 156, 189, 416, 0, 0,
+  786, 0, 902, 846, 0, 0, 0, 0, 678, 364, 968, 0, 0, 613, 0, 0,
+  972, 0, 0, 0, 0, 143, 0, 0, 0, 157, 0, 432, 943, 0, 0, 0,
+  0, 0, 523, 0, 580, 687, 0, 0, 0, 210, 0, 863, 0, 0, 0, 0,
+  0, 0, 0, 0, 427, 636, 201, 246, 369, 133, 372, 243, 576, 635, 544, 990,
+  785, 0, 0, 368, 0, 0, 0, 21, 336, 682, 0, 0, 0, 154, 53, 0,
+  17, 0, 519, 204, 281, 643, 0, 0, 698, 0, 64, 0, 0, 0, 597, 0,
+  194, 288, 631, 277, 0, 0, 632, 538, 0, 446, 183, 197, 479, 579, 0, 0,
+  342, 0, 0, 0, 0, 598, 186, 0, 0, 0, 191, 734, 971, 993, 96, 352,
+  460, 648, 542, 0, 0, 257, 450, 827, 983, 0, 0, 813, 0, 0, 0, 924,
+  0, 859, 0, 0, 0, 0, 0, 327, 884, 0, 0, 0, 590, 87, 0, 117,
+  864, 0, 0, 260, 0, 832, 623, 0, 139, 7, 0, 452, 0, 0, 0, 513,
+  0, 19, 0, 958, 0, 0, 0, 0, 0, 646, 0, 0, 0, 0, 564, 0,
+  440, 0, 713, 0, 0, 134, 607, 745, 0, 137, 0, 0, 273, 0, 0, 477,
+  549, 0, 498, 535, 0, 0, 0, 0, 314, 462, 83, 130, 149, 71, 0, 0,
+  0, 721, 0, 890, 229, 445, 0, 953, 0, 0, 0, 0, 11, 167, 540, 615,
+  847, 816, 880, 916, 0, 0, 0, 0, 0, 173, 351, 123, 697, 748, 322, 441,
+  956, 0, 138, 418, 998, 630, 316, 0, 675, 797, 0, 0, 566, 395, 901, 0,
+  211, 0, 793, 0, 0, 378, 114, 569, 887, 0, 0, 545, 926, 0, 0, 0,
+  0, 0, 977, 0, 0, 105, 0, 275, 407, 0, 915, 0, 668, 33, 0, 0,
+  0, 0, 0, 706, 0, 0, 0, 0, 0, 175, 718, 85, 766, 881, 0, 0,
+  0, 0, 0, 0, 0, 596, 0, 0, 198, 212, 385, 357, 457, 509, 0, 844,
+  0, 0, 733, 0, 755, 0, 0, 778, 317, 565, 4, 75, 184, 380, 251, 822,
+  620, 222, 825, 973, 529, 332, 893, 153, 97, 749, 102, 463, 258, 28, 724, 922,
+  485, 0, 0, 921, 0, 0, 0, 231, 0, 158, 723, 789, 0, 0, 0, 0,
+  391, 0, 0, 834, 195, 0, 348, 861, 0, 205, 936, 438, 0, 217, 0, 0,
+  0, 0, 0, 0, 0, 0, 739, 522, 0, 0, 0, 0, 0, 0, 216, 717,
+  0, 0, 0, 428, 0, 0, 570, 0, 0, 664, 0, 0, 712, 528, 0, 0,
+  0, 602, 592, 0, 330, 614, 0, 0, 0, 0, 0, 933, 0, 582, 0, 0,
+  672, 0, 0, 0, 0, 0, 360, 474, 0, 609, 109, 553, 752, 174, 0, 0,
+  0, 0, 484, 0, 81, 300, 771, 845, 171, 986, 466, 828, 0, 0, 639, 645,
+  878, 0, 390, 0, 0, 0, 0, 931, 729, 949, 0, 0, 0, 439, 537, 0,
+  0, 0, 0, 0, 0, 234, 264, 0, 0, 0, 923, 0, 0, 0, 0, 0,
+  91, 271, 41, 650, 0, 815, 0, 0, 0, 0, 552, 147, 0, 725, 0, 951,
+  0, 0, 172, 0, 0, 578, 0, 0, 0, 999, 0, 0, 0, 0, 49, 0,
+  0, 0, 0, 0, 289, 906, 0, 0, 637, 490, 0, 759, 941, 0, 676, 0,
+  170, 0, 0, 188, 704, 0, 0, 0, 548, 769, 254, 310, 612, 644, 885, 928,
+  0, 0, 0, 400, 265, 295, 0, 625, 0, 44, 524, 571, 800, 20, 0, 354,
+  0, 0, 594, 0, 0, 0, 0, 995, 306, 0, 0, 0, 0, 0, 0, 227,
+  0, 0, 0, 0, 0, 0, 425, 0, 115, 511, 0, 319, 1, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 562, 905, 762, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 659, 515, 0, 0, 0, 290, 619, 547, 772, 0, 0, 502, 0,
+  228, 0, 783, 894, 0, 683, 0, 0, 851, 0, 0, 0, 0, 241, 454, 573,
+  196, 908, 377, 0, 0, 0, 0, 0, 0, 238, 0, 640, 388, 472, 526, 111,
+  165, 600, 433, 692, 705, 764, 0, 0, 0, 296, 470, 812, 0, 0, 0, 818,
+  0, 0, 0, 525, 0, 311, 236, 577, 608, 393, 934, 0, 848, 107, 200, 824,
+  261, 347, 0, 842, 556, 0, 0, 746, 831, 0, 610, 727, 616, 406, 481, 0,
+  0, 367, 422, 334, 473, 180, 0, 0, 237, 345, 0, 0, 0, 0, 303, 0,
+  0, 0, 0, 355, 0, 108, 384, 0, 536, 0, 506, 858, 0, 0, 127, 907,
+  0, 56, 164, 809, 0, 0, 0, 215, 0, 0, 0, 0, 0, 937, 0, 413,
+  0, 0, 0, 738, 0, 199, 782, 808, 796, 0, 0, 0, 249, 0, 0, 419,
+  0, 0, 0, 74, 399, 719, 374, 0, 0, 0, 293, 691, 798, 714, 770, 0,
+  256, 356, 247, 0, 693, 0, 581, 0, 0, 0, 0, 0, 886, 0, 0, 1000,
+  220, 653, 0, 0, 0, 736, 679, 792, 532, 756, 159, 429, 871, 0, 155, 554,
+  0, 0, 722, 0, 346, 411, 0, 0, 447, 695, 0, 0, 86, 0, 0, 656,
+  0, 0, 299, 0, 0, 0, 95, 415, 543, 0, 431, 0, 0, 151, 0, 0,
+  80, 0, 0, 208, 0, 0, 274, 76, 0, 0, 0, 0, 560, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 837, 0, 0, 0, 286, 651, 888,
+  0, 214, 531, 589, 730, 267, 867, 895, 29, 46, 280, 974, 0, 603, 168, 857,
+  708, 0, 0, 45, 629, 358, 0, 0, 628, 18, 152, 530, 568, 817, 424, 860,
+  0, 541, 777, 869, 0, 0, 0, 55, 5, 353, 0, 116, 0, 0, 595, 774,
+  763, 0, 0, 453, 84, 0, 0, 874, 0, 0, 0, 673, 803, 866, 245, 830,
+  0, 337, 587, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 621, 849,
+  852, 0, 313, 291, 489, 0, 0, 0, 73, 140, 475, 647, 421, 795, 0, 917,
+  0, 0, 386, 0, 0, 0, 0, 0, 0, 0, 0, 323, 0, 720, 0, 0,
+  987, 61, 302, 0, 918, 555, 732, 638, 98, 77, 270, 278, 483, 558, 58, 324,
+  63, 559, 669, 586, 715, 891, 975, 996, 464, 401, 622, 0, 0, 144, 935, 233,
+  507, 141, 539, 790, 947, 279, 0, 0, 0, 122, 328, 959, 148, 945, 0, 482,
+  488, 0, 0, 989, 0, 0, 0, 179, 0, 0, 226, 750, 318, 702, 826, 335,
+  397, 896, 960, 0, 0, 0, 0, 0, 320, 373, 193, 478, 688, 804, 677, 850,
+  929, 593, 588, 939, 448, 516, 942, 126, 0, 0, 0, 0, 944, 410, 269, 0,
+  240, 699, 0, 0, 854, 909, 38, 434, 0, 0, 0, 618, 899, 494, 655, 312,
+  458, 742, 911, 0, 591, 160, 0, 0, 285, 957, 0, 0, 0, 436, 0, 0,
+  743, 584, 0, 0, 0, 0, 0, 476, 79, 213, 780, 914, 0, 0, 0, 0,
+  0, 0, 239, 0, 496, 791, 967, 0, 225, 662, 315, 0, 0, 649, 829, 805,
+  876, 761, 0, 0, 0, 13, 657, 0, 430, 161, 508, 0, 0, 0, 0, 331,
+  962, 366, 0, 0, 551, 0, 0, 0, 0, 0, 0, 0, 209, 0, 773, 0,
+  182, 0, 950, 0, 497, 0, 658, 889, 92, 707, 0, 0, 0, 244, 469, 633,
+  0, 0, 0, 129, 30, 710, 652, 0, 0, 779, 0, 0, 0, 758, 0, 104,
+  0, 0, 642, 0, 78, 486, 819, 0, 444, 0, 0, 0, 14, 62, 685, 22,
+  802, 0, 0, 784, 128, 0, 0, 0, 501, 0, 0, 0, 0, 0, 350, 442,
+  0, 451, 811, 0, 897, 0, 0, 604, 0, 0, 23, 0, 0, 0, 806, 283,
+  0, 0, 737, 912, 298, 207, 976, 0, 660, 0, 493, 932, 304, 666, 690, 801,
+  954, 0, 882, 0, 0, 0, 0, 0, 969, 606, 700, 814, 605, 946, 0, 0,
+  0, 0, 0, 680, 0, 925, 121, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 980, 0, 0, 663, 0, 787, 665, 0, 0, 0, 0, 0, 0,
+  0, 202, 192, 0, 0, 0, 25, 0, 0, 0, 0, 938, 0, 0, 0, 88,
+  978, 0, 0, 0, 0, 0, 0, 0, 0, 0, 480, 575, 0, 0, 408, 0,
+  0, 90, 0, 125, 510, 190, 838, 862, 276, 913, 0, 641, 841, 340, 35, 459,
+  0, 0, 694, 611, 0, 8, 728, 839, 0, 0, 0, 567, 0, 39, 627, 0,
+  0, 287, 101, 268, 0, 0, 16, 0, 0, 0, 294, 465, 546, 807, 833, 689,
+  903, 583, 0, 59, 0, 898, 767, 0, 32, 0, 492, 0, 263, 0, 387, 670,
+  634, 0, 735, 0, 0, 0, 417, 877, 920, 0, 0, 527, 0, 0, 0, 0,
+};
+
+const char *WA_FREQ_146_TOKENS[] = {
+  "to",
+  "sa",
+  "je",
+  "si",
+  "som",
+  "a",
+  "na",
+  "že",
+  "čo",
+  "nie",
+  "v",
+  "ako",
+  "tak",
+  "ale",
+  "by",
+  "s",
+  "mi",
+  "o",
+  "tu",
+  "do",
+  "ja",
+  "sme",
+  "ste",
+  "áno",
+  "z",
+  "len",
+  "ma",
+  "už",
+  "aby",
+  "dobre",
+  "ho",
+  "keď",
+  "ak",
+  "ty",
+  "ti",
+  "za",
+  "ťa",
+  "bol",
+  "pre",
+  "sú",
+  "tam",
+  "prečo",
+  "niečo",
+  "toto",
+  "no",
+  "teraz",
+  "aj",
+  "hej",
+  "mám",
+  "byť",
+  "ich",
+  "bude",
+  "ju",
+  "takže",
+  "ten",
+  "všetko",
+  "tom",
+  "nič",
+  "vás",
+  "kde",
+  "kto",
+  "k",
+  "po",
+  "bolo",
+  "bola",
+  "ešte",
+  "vám",
+  "toho",
+  "alebo",
+  "jej",
+  "má",
+  "môj",
+  "jeho",
+  "myslím",
+  "máš",
+  "viem",
+  "vieš",
+  "mňa",
+  "poriadku",
+  "tým",
+  "veľmi",
+  "mal",
+  "prosím",
+  "potom",
+  "nikdy",
+  "možno",
+  "od",
+  "nás",
+  "ani",
+  "so",
+  "povedal",
+  "chcem",
+  "neviem",
+  "mu",
+  "ďakujem",
+  "ísť",
+  "vy",
+  "naozaj",
+  "stále",
+  "teba",
+  "pretože",
+  "viac",
+  "chceš",
+  "oh",
+  "povedať",
+  "nám",
+  "ahoj",
+  "on",
+  "pred",
+  "máme",
+  "boli",
+  "moja",
+  "musím",
+  "tie",
+  "vo",
+  "sem",
+  "môžem",
+  "dnes",
+  "budem",
+  "ktorý",
+  "niekto",
+  "práve",
+  "pane",
+  "mali",
+  "pán",
+  "poďme",
+  "všetci",
+  "pozri",
+  "myslíš",
+  "či",
+  "mať",
+  "nemôžem",
+  "čas",
+  "asi",
+  "ktoré",
+  "keby",
+  "veľa",
+  "vždy",
+  "tiež",
+  "moje",
+  "poď",
+  "mala",
+  "stalo",
+  "trochu",
+  "my",
+  "ľudia",
+  "tomu",
+  "pri",
+  "deň",
+  "máte",
+  "tú",
+  "musíme",
+  "iba",
+  "tvoj",
+  "rád",
+  "bože",
+  "otec",
+  "tento",
+  "tá",
+  "jeden",
+  "bez",
+  "chcel",
+  "mohol",
+  "jasné",
+  "veci",
+  "zo",
+  "robiť",
+  "ide",
+  "dobrý",
+  "budeš",
+  "ok",
+  "mnou",
+  "môže",
+  "viete",
+  "kým",
+  "mne",
+  "až",
+  "presne",
+  "môžeš",
+  "život",
+  "ľudí",
+  "dosť",
+  "vážne",
+  "preto",
+  "dobré",
+  "späť",
+  "všetky",
+  "tebou",
+  "urobiť",
+  "deje",
+  "robíš",
+  "vedieť",
+  "prepáč",
+  "vďaka",
+  "však",
+  "musíš",
+  "povedala",
+  "ona",
+  "budeme",
+  "nikto",
+  "kvôli",
+  "lebo",
+  "domov",
+  "teda",
+  "pravdu",
+  "vec",
+  "nech",
+  "hneď",
+  "im",
+  "každý",
+  "svoje",
+  "myslel",
+  "než",
+  "kedy",
+  "pár",
+  "tvoja",
+  "prepáčte",
+  "nechcem",
+  "rokov",
+  "choď",
+  "povedz",
+  "potrebujem",
+  "daj",
+  "miesto",
+  "nemám",
+  "svoju",
+  "videl",
+  "samozrejme",
+  "raz",
+  "chce",
+  "takto",
+  "také",
+  "mohli",
+  "preč",
+  "noc",
+  "ním",
+  "nejaké",
+  "idem",
+  "spolu",
+  "vlastne",
+  "problém",
+  "musí",
+  "žiadne",
+  "počkaj",
+  "chcete",
+  "vôbec",
+  "lepšie",
+  "vidieť",
+  "môžeme",
+  "urobil",
+  "tvoje",
+  "tebe",
+  "dostať",
+  "prišiel",
+  "peniaze",
+  "hovoriť",
+  "kurva",
+  "vyzerá",
+  "ktorá",
+  "mama",
+  "dlho",
+  "kam",
+  "niekedy",
+  "von",
+  "príliš",
+  "nich",
+  "sám",
+  "celý",
+  "úplne",
+  "tej",
+  "rada",
+  "určite",
+  "nuž",
+  "môžete",
+  "pod",
+  "ráno",
+  "fajn",
+  "váš",
+  "seba",
+  "pomôcť",
+  "večer",
+  "aký",
+  "nebude",
+  "dieťa",
+  "cez",
+  "deti",
+  "niekoho",
+  "u",
+  "všetkých",
+  "aké",
+  "majú",
+  "mojej",
+  "tých",
+  "rýchlo",
+  "pravda",
+  "taký",
+  "istý",
+  "znamená",
+  "môjho",
+  "tieto",
+  "koľko",
+  "predtým",
+  "medzi",
+  "dať",
+  "tejto",
+  "čom",
+  "chcela",
+  "neho",
+  "muž",
+  "meno",
+  "ideme",
+  "dievča",
+  "budú",
+  "dva",
+  "tri",
+  "nebol",
+  "nejaký",
+  "svoj",
+  "podľa",
+  "mohla",
+  "žena",
+  "nájsť",
+  "pani",
+  "vaše",
+  "budete",
+  "ľúto",
+  "pozrite",
+  "veď",
+  "zajtra",
+  "moju",
+  "hovorí",
+  "ktorú",
+  "správne",
+  "túto",
+  "hore",
+  "dostal",
+  "super",
+  "ďalej",
+  "naše",
+  "vedel",
+  "tomto",
+  "náš",
+  "chvíľu",
+  "dal",
+  "vidím",
+  "prácu",
+  "prestaň",
+  "proste",
+  "vie",
+  "okej",
+  "jedno",
+  "mami",
+  "pohode",
+  "dole",
+  "myslíte",
+  "aspoň",
+  "vaša",
+  "nej",
+  "táto",
+  "jedna",
+  "i",
+  "pomoc",
+  "oni",
+  "robí",
+  "poviem",
+  "nemôžeš",
+  "dve",
+  "ku",
+  "skôr",
+  "človek",
+  "ktorí",
+  "radšej",
+  "doktor",
+  "zlé",
+  "nechaj",
+  "páči",
+  "myslela",
+  "pozor",
+  "auto",
+  "nami",
+  "dúfam",
+  "skoro",
+  "čože",
+  "ňou",
+  "nemá",
+  "proti",
+  "nemal",
+  "neskôr",
+  "jednu",
+  "iné",
+  "odtiaľto",
+  "hovorím",
+  "zabiť",
+  "nad",
+  "hovoril",
+  "prvý",
+  "vami",
+  "svojho",
+  "musíte",
+  "milujem",
+  "počul",
+  "zdá",
+  "skvelé",
+  "dobrá",
+  "doma",
+  "znova",
+  "koho",
+  "hovoríš",
+  "fakt",
+  "och",
+  "dvere",
+  "zlatko",
+  "minút",
+  "sebe",
+  "nebolo",
+  "našiel",
+  "chlap",
+  "počúvaj",
+  "musieť",
+  "pekla",
+  "nebudem",
+  "okolo",
+  "riti",
+  "zabil",
+  "matka",
+  "uh",
+  "mŕtvy",
+  "videla",
+  "dvaja",
+  "príde",
+  "nemôže",
+  "veľký",
+  "vidíš",
+  "času",
+  "prišli",
+  "tohto",
+  "ideš",
+  "našli",
+  "tvoju",
+  "uvidíme",
+  "číslo",
+  "celé",
+  "sama",
+  "haló",
+  "dom",
+  "čokoľvek",
+  "nemáš",
+  "práca",
+  "musel",
+  "jedného",
+  "vrátiť",
+  "buď",
+  "potrebujeme",
+  "taká",
+  "nápad",
+  "otca",
+  "slečna",
+  "celkom",
+  "nemyslím",
+  "cítim",
+  "zbraň",
+  "života",
+  "nebola",
+  "svet",
+  "noci",
+  "vonku",
+  "spraviť",
+  "prišla",
+  "moc",
+  "pokiaľ",
+  "skutočne",
+  "svete",
+  "žiadny",
+  "svojej",
+  "zlato",
+  "včera",
+  "dám",
+  "malý",
+  "pekne",
+  "koniec",
+  "the",
+  "ruky",
+  "dôvod",
+  "práce",
+  "co",
+  "rok",
+  "volá",
+  "počkať",
+  "ňu",
+  "odísť",
+  "nechať",
+  "tí",
+  "stane",
+  "dnu",
+  "inak",
+  "prísť",
+  "ťažké",
+  "ceste",
+  "zatiaľ",
+  "vtedy",
+  "najlepšie",
+  "sebou",
+  "problémy",
+  "pocit",
+  "prípade",
+  "celú",
+  "možné",
+  "povedali",
+  "iste",
+  "znovu",
+  "dajte",
+  "páni",
+  "predsa",
+  "dobrú",
+  "chlapec",
+  "roky",
+  "čím",
+  "istá",
+  "ach",
+  "dokonca",
+  "videli",
+  "žiť",
+  "poďte",
+  "niekde",
+  "ďalší",
+  "iný",
+  "vieme",
+  "syn",
+  "spôsob",
+  "nemáme",
+  "toľko",
+  "poznám",
+  "ňom",
+  "priateľ",
+  "nemôžeme",
+  "týždeň",
+  "pozrieť",
+  "brat",
+  "boh",
+  "nový",
+  "spravil",
+  "chlapci",
+  "sakra",
+  "robíte",
+  "zle",
+  "tvojej",
+  "naša",
+  "akoby",
+  "robím",
+  "pekné",
+  "pôjdem",
+  "cestu",
+  "ženy",
+  "zase",
+  "znie",
+  "hodín",
+  "nimi",
+  "oci",
+  "oči",
+  "dá",
+  "okrem",
+  "chápem",
+  "pripravený",
+  "chceli",
+  "konečne",
+  "telo",
+  "aká",
+  "mieste",
+  "ano",
+  "mojom",
+  "potrebuje",
+  "mojich",
+  "veľké",
+  "domu",
+  "priamo",
+  "človeče",
+  "počas",
+  "počkajte",
+  "nechceš",
+  "jediný",
+  "kapitán",
+  "týchto",
+  "rozumiem",
+  "zdravím",
+  "môžu",
+  "slovo",
+  "urobila",
+  "mohlo",
+  "smrť",
+  "nové",
+  "krát",
+  "príbeh",
+  "robil",
+  "srdce",
+  "chcú",
+  "jednoducho",
+  "hlavu",
+  "drž",
+  "muža",
+  "porozprávať",
+  "choďte",
+  "prípad",
+  "plán",
+  "mimo",
+  "nepovedal",
+  "vedela",
+  "isté",
+  "neskoro",
+  "povedzte",
+  "tvojho",
+  "dostali",
+  "pravdepodobne",
+  "vašu",
+  "vecí",
+  "svojich",
+  "nechcel",
+  "živote",
+  "ďalšie",
+  "ze",
+  "hrať",
+  "john",
+  "rodina",
+  "ženu",
+  "kámo",
+  "dôležité",
+  "dolárov",
+  "nejakú",
+  "týmto",
+  "smrti",
+  "myslí",
+  "vziať",
+  "ticho",
+  "dni",
+  "dome",
+  "šancu",
+  "jo",
+  "veriť",
+  "sestra",
+  "starý",
+  "päť",
+  "nevieš",
+  "loď",
+  "odkiaľ",
+  "malé",
+  "mrzí",
+  "našej",
+  "ďaleko",
+  "new",
+  "úžasné",
+  "nemohol",
+  "nevidel",
+  "okay",
+  "obaja",
+  "šťastie",
+  "všetkým",
+  "dvoch",
+  "nemali",
+  "žiadna",
+  "dní",
+  "dr.",
+  "nemala",
+  "potrebovať",
+  "jedlo",
+  "zostať",
+  "ktorého",
+  "sam",
+  "zmysel",
+  "rovnako",
+  "rokmi",
+  "malo",
+  "čoskoro",
+  "snažím",
+  "nechajte",
+  "you",
+  "treba",
+  "hodiny",
+  "vyzeráš",
+  "potrebuješ",
+  "ocko",
+  "strane",
+  "dňa",
+  "dala",
+  "yeah",
+  "nechal",
+  "jediná",
+  "zomrel",
+  "pracovať",
+  "madam",
+  "priatelia",
+  "oveľa",
+  "urobím",
+  "časť",
+  "ó",
+  "ruku",
+  "počuť",
+  "zastaviť",
+  "telefón",
+  "vašej",
+  "nikoho",
+  "krv",
+  "najprv",
+  "nevedel",
+  "najlepší",
+  "našich",
+  "takmer",
+  "čau",
+  "zem",
+  "dostala",
+  "chyba",
+  "ktorých",
+  "začal",
+  "nemusíš",
+  "mesta",
+  "opäť",
+  "urobili",
+  "ktorej",
+  "aha",
+  "stačí",
+  "správy",
+  "práci",
+  "charlie",
+  "láska",
+  "išiel",
+  "mesto",
+  "jack",
+  "strach",
+  "zlý",
+  "volám",
+  "čase",
+  "školy",
+  "chceme",
+  "začať",
+  "kamoš",
+  "našla",
+  "neboj",
+  "tvár",
+  "moji",
+  "počula",
+  "syna",
+  "zavolať",
+  "niekoľko",
+  "nevie",
+  "zemi",
+  "povieš",
+  "rodinu",
+  "našu",
+  "pamätáš",
+  "polícia",
+  "nemôžete",
+  "roku",
+  "naspäť",
+  "pôjdeme",
+  "štyri",
+  "poznáš",
+  "odišiel",
+  "sveta",
+  "robia",
+  "chlape",
+  "rozprávať",
+  "párty",
+  "spať",
+  "pekný",
+  "veľká",
+  "verím",
+  "nerob",
+  "skutočnosti",
+  "meste",
+  "nemáte",
+  "zbrane",
+  "dali",
+  "auta",
+  "cesty",
+  "uveriť",
+  "zistiť",
+  "nechce",
+  "nakoniec",
+  "chlapče",
+  "ono",
+  "mysli",
+  "dcéra",
+  "pána",
+  "všade",
+  "tou",
+  "vzal",
+  "zavolám",
+  "dievčatá",
+  "blízko",
+  "volal",
+  "chcieť",
+  "nášho",
+  "akú",
+  "vypadni",
+  "myslieť",
+  "šťastný",
+  "vášho",
+  "naposledy",
+  "vidíte",
+  "šiel",
+  "odkedy",
+  "radi",
+  "neboli",
+  "vedeli",
+  "chlapík",
+  "možnosť",
+  "ah",
+  "hovorila",
+  "tím",
+  "stať",
+  "každého",
+  "vnútri",
+  "hlavy",
+  "nejde",
+  "cesta",
+  "hodinu",
+  "prvé",
+  "vrátim",
+  "jasne",
+  "menej",
+  "nehovor",
+  "peňazí",
+  "nebudeš",
+  "čakať",
+  "urob",
+  "žiaden",
+  "um",
+  "odtiaľ",
+  "muži",
+  "vrátil",
+  "škole",
+  "pol",
+  "malá",
+  "hovoríte",
+  "večeru",
+  "musela",
+  "nejako",
+  "okamžite",
+  "sex",
+  "mojou",
+  "poslal",
+  "prvá",
+  "záleží",
+  "miesta",
+  "druhý",
+  "odo",
+  "snažil",
+  "iného",
+  "michael",
+  "ne",
+  "sľubujem",
+  "ha",
+  "hovoria",
+  "šéf",
+  "žije",
+  "skvelý",
+  "čoho",
+  "zachrániť",
+  "šesť",
+  "hovor",
+  "hubu",
+  "stratil",
+  "nikomu",
+  "rovno",
+  "dostane",
+  "dolu",
+  "predstaviť",
+  "rodičia",
+  "správu",
+  "musia",
+  "človeka",
+  "výborne",
+  "byt",
+  "stretnúť",
+  "bež",
+  "spoločnosť",
+  "zomrieť",
+  "poriadne",
+  "posledný",
+  "vezmi",
+  "ta",
+  "rodiny",
+  "posledné",
+  "strašne",
+  "vráť",
+  "stojí",
+  "chlapa",
+  "jediné",
+  "hmm",
+  "odpoveď",
+  "nohy",
+  "dámy",
+  "náhodou",
+  "ľuďom",
+  "každú",
+  "joe",
+  "film",
+  "zostaň",
+  "agent",
+  "cítiš",
+  "dávno",
+  "ver",
+  "t",
+  "spoločné",
+  "otázka",
+  "začína",
+  "manžel",
+  "vravel",
+  "jednej",
+  "nevadí",
+  "napríklad",
+  "svojom",
+  "právo",
+  "chlapi",
+  "čaká",
+  "počuj",
+  "počúvajte",
+  "bojovať",
+  "rande",
+  "informácie",
+  "mesiac",
+  "držať",
+  "zmeniť",
+  "mužov",
+  "chodiť",
+  "ukáž",
+  "dostanem",
+  "zobrať",
+  "zabili",
+  "tými",
+  "nažive",
+  "pohyb",
+  "drahá",
+  "tvojom",
+  "aute",
+  "milé",
+  "zabudol",
+  "môcť",
+  "použiť",
+  "blázon",
+  "zavolaj",
+  "často",
+  "stará",
+  "brata",
+  "existuje",
+  "hey",
+  "dostaneme",
+  "šťastia",
+  "vlasy",
+  "povie",
+  "bezpečí",
+  "funguje",
+  "and",
+  "celá",
+  "druhej",
+  "stretnutie",
+  "pripravená",
+  "mimochodom",
+  "žiadnu",
+  "pôjde",
+  "ukázať",
+  "boha",
+  "nejaká",
+  "snáď",
+  "divné",
+  "cítiť",
+  "neverím",
+  "čerta",
+  "nechcela",
+  "mesiacov",
+  "ostatní",
+  "prisahám",
+  "e",
+  "navždy",
+  "pokoj",
+  "desať",
+  "museli",
+  "n",
+  "urobíme",
+  "horšie",
+  "prestať",
+  "nezáleží",
+  "priateľov",
+  "srandu",
+  "slová",
+  "jesť",
+  "zvláštne",
+  "keďže",
+  "sami",
+  "preboha",
+  "najskôr",
+  "robíme",
+  "všetkom",
+  "peter",
+  "pozrime",
+  "hovorili",
+  "tvojich",
+  "vezmem",
+  "zober",
+  "šaty",
+  "nedá",
+  "pokračovať",
+};
+const uint16_t WA_FREQ_146_RANKS[] = {
+  0, 174, 0, 0, 230, 0, 0, 0, 0, 993, 0, 0, 0, 0, 0, 0,
+  43, 177, 68, 241, 752, 0, 0, 252, 588, 0, 172, 922, 924, 0, 0, 911,
+  0, 572, 0, 0, 0, 0, 747, 728, 759, 0, 0, 0, 0, 0, 396, 0,
+  0, 0, 163, 232, 0, 0, 327, 0, 0, 0, 0, 461, 0, 84, 0, 0,
+  0, 463, 742, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 209, 0, 0,
+  213, 0, 0, 195, 989, 0, 0, 0, 100, 689, 0, 325, 0, 0, 450, 14,
+  565, 930, 142, 0, 772, 0, 0, 437, 0, 0, 0, 0, 719, 0, 0, 393,
+  0, 0, 200, 0, 0, 907, 0, 962, 0, 0, 175, 755, 858, 0, 563, 815,
+  0, 0, 918, 0, 589, 0, 0, 94, 564, 787, 988, 977, 0, 0, 0, 0,
+  120, 0, 0, 0, 0, 952, 620, 0, 942, 0, 0, 0, 905, 448, 225, 531,
+  0, 271, 0, 0, 295, 0, 0, 0, 0, 0, 0, 0, 0, 0, 790, 0,
+  0, 0, 0, 433, 0, 0, 857, 248, 0, 0, 0, 686, 468, 459, 735, 419,
+  539, 0, 272, 0, 0, 0, 0, 0, 838, 0, 0, 0, 0, 0, 0, 0,
+  0, 863, 0, 224, 642, 0, 0, 621, 0, 0, 0, 0, 269, 0, 537, 652,
+  0, 0, 0, 0, 0, 0, 0, 480, 0, 517, 0, 187, 876, 0, 0, 0,
+  236, 821, 0, 0, 0, 0, 0, 0, 362, 0, 0, 137, 0, 961, 0, 132,
+  931, 270, 123, 554, 799, 548, 553, 0, 0, 0, 0, 967, 367, 0, 0, 0,
+  0, 160, 672, 98, 641, 521, 778, 895, 919, 0, 0, 0, 0, 0, 458, 0,
+  0, 0, 0, 0, 233, 0, 0, 0, 0, 0, 0, 0, 786, 0, 0, 0,
+  0, 0, 903, 0, 934, 623, 161, 965, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 619, 682, 363, 581, 97, 0, 584, 0, 859, 0, 144, 0,
+  0, 0, 969, 0, 0, 0, 391, 827, 33, 680, 0, 154, 223, 258, 19, 817,
+  0, 0, 355, 667, 135, 0, 0, 655, 262, 0, 0, 975, 0, 0, 0, 0,
+  820, 0, 0, 0, 371, 751, 0, 718, 0, 0, 221, 0, 0, 0, 403, 795,
+  0, 429, 575, 0, 0, 0, 0, 0, 414, 0, 0, 0, 0, 546, 814, 0,
+  308, 0, 0, 74, 0, 0, 234, 0, 0, 0, 0, 102, 290, 538, 0, 0,
+  0, 0, 469, 0, 626, 775, 0, 0, 0, 789, 440, 341, 660, 920, 23, 0,
+  0, 0, 0, 6, 180, 0, 665, 0, 0, 0, 0, 880, 36, 609, 475, 926,
+  0, 810, 382, 255, 257, 493, 634, 695, 0, 0, 0, 155, 867, 0, 663, 259,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 709, 0, 122, 559, 668,
+  744, 677, 0, 0, 0, 0, 0, 0, 0, 0, 384, 441, 275, 761, 0, 0,
+  0, 0, 0, 0, 0, 0, 540, 541, 481, 846, 0, 12, 198, 0, 376, 628,
+  152, 694, 633, 91, 754, 157, 797, 955, 0, 0, 146, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 592, 0, 0, 0, 0, 0, 0, 21, 708, 0, 0, 0,
+  0, 0, 340, 711, 854, 0, 675, 0, 0, 0, 883, 309, 630, 0, 0, 690,
+  0, 0, 0, 0, 0, 0, 0, 0, 528, 0, 117, 0, 0, 0, 640, 380,
+  0, 0, 364, 0, 0, 0, 297, 244, 0, 22, 0, 0, 896, 0, 0, 976,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 515, 0, 78, 121,
+  0, 0, 0, 0, 383, 415, 462, 892, 871, 888, 46, 311, 171, 369, 127, 0,
+  943, 580, 957, 199, 0, 964, 0, 723, 639, 0, 0, 604, 981, 732, 353, 0,
+  29, 495, 0, 0, 734, 0, 73, 0, 0, 0, 0, 613, 0, 0, 176, 118,
+  124, 251, 0, 0, 0, 585, 617, 0, 439, 0, 0, 25, 0, 30, 378, 261,
+  253, 750, 959, 0, 7, 544, 486, 773, 948, 405, 0, 0, 35, 110, 286, 616,
+  887, 0, 643, 0, 0, 0, 408, 0, 0, 928, 136, 0, 0, 0, 0, 41,
+  0, 923, 0, 0, 0, 0, 0, 0, 601, 0, 87, 0, 0, 912, 0, 939,
+  0, 0, 26, 0, 488, 205, 618, 316, 0, 0, 254, 785, 0, 370, 179, 394,
+  0, 237, 685, 0, 0, 291, 55, 347, 256, 422, 401, 812, 855, 82, 80, 203,
+  220, 231, 349, 741, 0, 547, 72, 431, 222, 77, 321, 603, 703, 593, 856, 947,
+  0, 716, 0, 339, 0, 766, 0, 0, 0, 0, 0, 844, 0, 0, 763, 0,
+  0, 0, 0, 0, 0, 0, 571, 0, 0, 0, 0, 881, 202, 0, 186, 792,
+  409, 18, 917, 0, 0, 0, 0, 869, 904, 0, 0, 457, 0, 0, 0, 760,
+  0, 543, 92, 0, 0, 0, 0, 0, 0, 602, 0, 0, 0, 38, 0, 0,
+  966, 0, 0, 69, 0, 134, 656, 746, 872, 650, 164, 15, 929, 0, 314, 503,
+  81, 830, 0, 0, 0, 150, 910, 0, 506, 724, 932, 0, 796, 954, 5, 745,
+  0, 657, 104, 0, 173, 0, 3, 83, 350, 379, 518, 207, 987, 0, 361, 276,
+  0, 170, 0, 0, 374, 326, 0, 0, 0, 0, 532, 0, 0, 0, 803, 217,
+  510, 991, 950, 638, 0, 0, 193, 346, 0, 0, 899, 86, 320, 0, 0, 0,
+  0, 0, 178, 860, 0, 0, 0, 0, 722, 507, 0, 0, 397, 166, 529, 0,
+  0, 413, 300, 51, 625, 831, 0, 594, 873, 0, 897, 0, 238, 980, 425, 698,
+  605, 756, 0, 0, 0, 0, 0, 614, 832, 963, 0, 477, 868, 0, 0, 0,
+  28, 743, 0, 133, 0, 0, 938, 864, 0, 0, 496, 335, 679, 443, 762, 840,
+  0, 0, 111, 748, 214, 774, 50, 845, 914, 0, 0, 492, 0, 192, 0, 0,
+  0, 421, 631, 438, 879, 484, 707, 0, 0, 0, 436, 377, 684, 0, 0, 0,
+  264, 243, 400, 0, 997, 0, 75, 113, 386, 862, 953, 693, 0, 560, 432, 0,
+  0, 0, 0, 824, 365, 0, 0, 196, 0, 0, 0, 590, 159, 944, 0, 0,
+  273, 158, 0, 0, 500, 0, 0, 0, 0, 651, 16, 779, 373, 474, 139, 0,
+  106, 0, 901, 76, 0, 451, 423, 299, 359, 315, 825, 52, 937, 0, 96, 0,
+  452, 710, 802, 0, 343, 591, 598, 181, 848, 281, 293, 434, 891, 399, 0, 0,
+  24, 836, 88, 0, 0, 48, 0, 0, 536, 555, 687, 973, 330, 0, 107, 34,
+  454, 749, 0, 0, 0, 0, 338, 562, 0, 902, 129, 389, 523, 0, 404, 0,
+  250, 0, 0, 191, 4, 721, 780, 143, 653, 0, 0, 153, 0, 577, 596, 57,
+  126, 935, 945, 0, 0, 498, 0, 0, 420, 0, 764, 0, 381, 116, 352, 765,
+  247, 712, 783, 798, 805, 524, 0, 0, 0, 109, 141, 167, 473, 627, 958, 189,
+  662, 0, 0, 0, 0, 0, 0, 246, 184, 806, 811, 600, 491, 472, 801, 829,
+  909, 130, 849, 986, 688, 131, 0, 0, 0, 0, 0, 90, 345, 0, 331, 0,
+  0, 808, 0, 453, 0, 0, 0, 0, 0, 0, 0, 0, 64, 445, 595, 646,
+  637, 813, 0, 9, 889, 925, 0, 0, 85, 242, 940, 0, 0, 0, 0, 851,
+  0, 148, 0, 921, 283, 568, 470, 870, 0, 0, 0, 292, 0, 0, 0, 296,
+  0, 513, 737, 0, 0, 0, 218, 994, 819, 0, 188, 487, 0, 0, 0, 227,
+  0, 0, 582, 0, 767, 0, 0, 0, 0, 0, 0, 11, 27, 804, 0, 0,
+  0, 0, 0, 0, 0, 266, 449, 882, 42, 0, 648, 0, 0, 348, 757, 0,
+  322, 456, 466, 0, 0, 485, 816, 0, 0, 67, 114, 402, 715, 0, 0, 0,
+  736, 0, 0, 992, 0, 0, 0, 249, 215, 0, 0, 208, 933, 0, 0, 89,
+  0, 0, 0, 875, 0, 427, 0, 0, 758, 0, 0, 0, 0, 729, 0, 866,
+  0, 0, 0, 0, 979, 0, 0, 852, 0, 0, 499, 0, 0, 0, 0, 0,
+  2, 0, 0, 0, 268, 0, 0, 368, 525, 843, 366, 0, 841, 0, 776, 0,
+  0, 740, 0, 826, 356, 59, 0, 0, 0, 927, 516, 0, 482, 569, 0, 0,
+  576, 0, 0, 0, 0, 0, 629, 0, 235, 649, 996, 336, 983, 418, 673, 985,
+  608, 998, 0, 717, 0, 874, 974, 206, 301, 0, 0, 542, 0, 0, 968, 99,
+  497, 0, 809, 0, 0, 0, 0, 147, 354, 274, 360, 190, 0, 768, 731, 0,
+  0, 916, 245, 534, 0, 0, 0, 0, 0, 0, 0, 0, 151, 305, 771, 0,
+  288, 956, 0, 0, 0, 32, 0, 17, 0, 0, 0, 0, 654, 0, 0, 0,
+  0, 390, 0, 0, 0, 692, 149, 0, 624, 63, 0, 0, 0, 0, 0, 514,
+  319, 0, 395, 0, 0, 697, 0, 0, 0, 0, 0, 0, 0, 0, 0, 95,
+  0, 0, 0, 949, 0, 0, 483, 49, 0, 0, 138, 0, 0, 0, 0, 0,
+  733, 0, 0, 0, 502, 0, 0, 312, 0, 165, 822, 0, 0, 489, 65, 533,
+  720, 884, 984, 606, 0, 610, 999, 0, 615, 310, 586, 0, 0, 13, 0, 0,
+  0, 674, 781, 777, 0, 0, 467, 632, 644, 535, 793, 519, 784, 837, 960, 0,
+  982, 0, 0, 915, 0, 0, 0, 318, 372, 0, 0, 0, 307, 119, 182, 387,
+  704, 978, 1000, 0, 0, 713, 0, 501, 201, 946, 0, 128, 240, 681, 794, 0,
+  730, 0, 0, 706, 0, 0, 93, 323, 329, 344, 407, 145, 442, 847, 894, 294,
+  520, 0, 0, 566, 865, 504, 0, 0, 56, 936, 0, 332, 0, 0, 183, 666,
+  0, 44, 611, 0, 886, 0, 0, 0, 0, 818, 476, 570, 0, 0, 333, 0,
+  0, 0, 289, 971, 567, 0, 0, 850, 0, 0, 265, 0, 185, 550, 0, 79,
+  699, 0, 906, 0, 0, 0, 0, 0, 0, 0, 828, 357, 0, 0, 0, 0,
+  0, 0, 622, 0, 0, 0, 0, 0, 0, 0, 0, 0, 228, 0, 280, 972,
+  0, 328, 678, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 738,
+  0, 995, 0, 0, 140, 599, 375, 287, 636, 0, 61, 204, 417, 0, 0, 60,
+  334, 770, 416, 31, 0, 0, 0, 782, 70, 239, 0, 1, 324, 385, 671, 0,
+  0, 0, 878, 0, 853, 597, 0, 0, 298, 842, 508, 428, 494, 464, 683, 702,
+  0, 861, 0, 726, 0, 0, 0, 522, 0, 0, 900, 410, 0, 0, 670, 0,
+  0, 0, 0, 406, 412, 526, 647, 676, 807, 0, 583, 0, 0, 0, 0, 54,
+  212, 216, 0, 0, 0, 66, 479, 0, 951, 578, 833, 0, 101, 0, 0, 0,
+  0, 898, 0, 823, 512, 753, 0, 197, 303, 278, 587, 0, 0, 108, 0, 62,
+  0, 447, 0, 0, 0, 446, 0, 607, 0, 460, 0, 0, 0, 471, 0, 211,
+  342, 913, 0, 561, 659, 527, 267, 0, 0, 398, 284, 788, 0, 0, 0, 725,
+  430, 337, 0, 125, 509, 304, 10, 424, 465, 552, 574, 573, 260, 612, 885, 0,
+  0, 0, 317, 0, 0, 0, 229, 877, 990, 0, 0, 727, 0, 0, 47, 302,
+  279, 0, 0, 557, 530, 219, 0, 0, 0, 0, 0, 226, 105, 313, 426, 839,
+  0, 0, 39, 40, 282, 551, 505, 444, 71, 358, 714, 0, 0, 169, 0, 0,
+  545, 263, 556, 0, 194, 549, 661, 53, 696, 112, 0, 0, 351, 0, 908, 0,
+  635, 0, 58, 210, 558, 0, 0, 0, 411, 0, 0, 0, 791, 0, 0, 511,
+  769, 0, 277, 0, 0, 0, 0, 0, 37, 0, 103, 0, 306, 115, 0, 0,
+  156, 0, 835, 490, 0, 0, 0, 0, 0, 0, 700, 0, 0, 0, 941, 0,
+  478, 8, 0, 0, 0, 893, 0, 162, 579, 664, 0, 834, 701, 658, 705, 970,
+  691, 20, 800, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 168, 435, 0, 0, 455, 669, 0, 0, 0, 0, 388, 645, 739, 392,
+  890, 0, 0, 285, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 0,
+};
+
+const char *WA_FREQ_147_TOKENS[] = {
+  "je",
+  "ne",
+  "da",
+  "se",
+  "v",
+  "sem",
+  "to",
+  "in",
+  "si",
+  "kaj",
+  "na",
+  "bi",
+  "za",
+  "ti",
+  "pa",
+  "ni",
+  "mi",
+  "z",
+  "bo",
+  "lahko",
+  "so",
+  "ga",
+  "če",
+  "bom",
+  "me",
+  "še",
+  "te",
+  "kot",
+  "ja",
+  "s",
+  "tako",
+  "jaz",
+  "kako",
+  "ki",
+  "vse",
+  "ko",
+  "ali",
+  "samo",
+  "o",
+  "bil",
+  "že",
+  "vem",
+  "jo",
+  "od",
+  "zakaj",
+  "kar",
+  "ste",
+  "boš",
+  "nisem",
+  "dobro",
+  "nekaj",
+  "tudi",
+  "redu",
+  "prav",
+  "jih",
+  "smo",
+  "tukaj",
+  "res",
+  "po",
+  "bilo",
+  "zdaj",
+  "bila",
+  "tega",
+  "hvala",
+  "ampak",
+  "iz",
+  "ker",
+  "kdo",
+  "naj",
+  "več",
+  "ta",
+  "tem",
+  "imam",
+  "tu",
+  "kje",
+  "veš",
+  "vedno",
+  "mislim",
+  "do",
+  "bomo",
+  "moj",
+  "mu",
+  "nič",
+  "vas",
+  "sva",
+  "saj",
+  "zelo",
+  "a",
+  "potem",
+  "prosim",
+  "pri",
+  "vam",
+  "rekel",
+  "sta",
+  "no",
+  "ima",
+  "imaš",
+  "tam",
+  "zato",
+  "moram",
+  "daj",
+  "nikoli",
+  "bodo",
+  "toda",
+  "le",
+  "mogoče",
+  "pred",
+  "veliko",
+  "vsi",
+  "biti",
+  "nisi",
+  "torej",
+  "zaradi",
+  "malo",
+  "nas",
+  "moja",
+  "rad",
+  "morem",
+  "seveda",
+  "gospod",
+  "misliš",
+  "gre",
+  "hej",
+  "brez",
+  "on",
+  "nazaj",
+  "dan",
+  "imel",
+  "ji",
+  "morda",
+  "vendar",
+  "bova",
+  "pridi",
+  "žal",
+  "čas",
+  "oče",
+  "videl",
+  "moje",
+  "nam",
+  "tvoj",
+  "boste",
+  "všeč",
+  "k",
+  "moral",
+  "kdaj",
+  "lepo",
+  "zgodilo",
+  "moraš",
+  "prišel",
+  "gremo",
+  "takoj",
+  "mene",
+  "ob",
+  "poglej",
+  "mama",
+  "dovolj",
+  "grem",
+  "stvari",
+  "vi",
+  "oh",
+  "bog",
+  "svoje",
+  "pojdi",
+  "pravi",
+  "kajne",
+  "meni",
+  "ven",
+  "sam",
+  "videti",
+  "oprosti",
+  "povedal",
+  "življenje",
+  "hotel",
+  "tebe",
+  "ime",
+  "imamo",
+  "let",
+  "tvoja",
+  "časa",
+  "bolj",
+  "sploh",
+  "sedaj",
+  "med",
+  "danes",
+  "rekla",
+  "bili",
+  "mislil",
+  "moramo",
+  "jim",
+  "dober",
+  "spet",
+  "povej",
+  "ljudje",
+  "ljudi",
+  "hočem",
+  "nihče",
+  "skupaj",
+  "naredil",
+  "nekdo",
+  "človek",
+  "niso",
+  "niti",
+  "svojo",
+  "imela",
+  "rada",
+  "mano",
+  "dogaja",
+  "eno",
+  "hočeš",
+  "vedel",
+  "ona",
+  "želim",
+  "pomeni",
+  "razumem",
+  "dva",
+  "kam",
+  "denar",
+  "živjo",
+  "treba",
+  "koliko",
+  "tvoje",
+  "šel",
+  "njim",
+  "domov",
+  "tole",
+  "mora",
+  "oprostite",
+  "morala",
+  "preveč",
+  "vidim",
+  "g",
+  "ubil",
+  "dolgo",
+  "dobil",
+  "proti",
+  "čez",
+  "dokler",
+  "delo",
+  "nočem",
+  "naprej",
+  "videla",
+  "tabo",
+  "bolje",
+  "tri",
+  "ničesar",
+  "dela",
+  "dal",
+  "enkrat",
+  "noč",
+  "preden",
+  "sranje",
+  "narobe",
+  "imate",
+  "prišla",
+  "vsak",
+  "ve",
+  "nimam",
+  "skrbi",
+  "pod",
+  "tisti",
+  "ena",
+  "mojo",
+  "greš",
+  "greva",
+  "tebi",
+  "hitro",
+  "tisto",
+  "veste",
+  "šla",
+  "verjetno",
+  "naju",
+  "dve",
+  "stran",
+  "stvar",
+  "iti",
+  "našel",
+  "zate",
+  "povedati",
+  "počakaj",
+  "pomoč",
+  "en",
+  "moreš",
+  "konec",
+  "glede",
+  "vsaj",
+  "poslušaj",
+  "nama",
+  "super",
+  "avto",
+  "moji",
+  "jutri",
+  "prej",
+  "celo",
+  "njo",
+  "slišal",
+  "našli",
+  "g.",
+  "otrok",
+  "zdravo",
+  "zdi",
+  "vidiš",
+  "reči",
+  "kakšen",
+  "fant",
+  "kjer",
+  "prijatelj",
+  "nehaj",
+  "ravno",
+  "želiš",
+  "stari",
+  "morali",
+  "oči",
+  "imajo",
+  "leta",
+  "potrebujem",
+  "govori",
+  "hotela",
+  "dobra",
+  "tja",
+  "drugega",
+  "delaš",
+  "upam",
+  "bodi",
+  "zame",
+  "skozi",
+  "težko",
+  "mojega",
+  "storil",
+  "mislila",
+  "ves",
+  "doma",
+  "sama",
+  "počneš",
+  "povedala",
+  "dni",
+  "mesto",
+  "morava",
+  "drugi",
+  "vrata",
+  "včasih",
+  "imeli",
+  "dr.",
+  "pusti",
+  "del",
+  "tvojo",
+  "videli",
+  "vaš",
+  "more",
+  "glej",
+  "govoriti",
+  "skoraj",
+  "koga",
+  "prekleto",
+  "čem",
+  "očitno",
+  "otroka",
+  "kakšno",
+  "dajmo",
+  "način",
+  "resno",
+  "nocoj",
+  "vsem",
+  "gospa",
+  "govoriš",
+  "poznam",
+  "kmalu",
+  "sin",
+  "toliko",
+  "prišli",
+  "ok",
+  "prvi",
+  "pride",
+  "točno",
+  "gotovo",
+  "trenutek",
+  "tej",
+  "takrat",
+  "mrtev",
+  "pravkar",
+  "govoril",
+  "svoj",
+  "njega",
+  "vaše",
+  "umrl",
+  "njegovo",
+  "vedela",
+  "odlično",
+  "misli",
+  "vedeti",
+  "prepričan",
+  "nekoga",
+  "vseeno",
+  "nima",
+  "njegov",
+  "uspelo",
+  "dol",
+  "raje",
+  "očka",
+  "naredila",
+  "hoče",
+  "strani",
+  "eden",
+  "slabo",
+  "poti",
+  "svet",
+  "nismo",
+  "mož",
+  "vaša",
+  "pet",
+  "zunaj",
+  "bosta",
+  "fantje",
+  "niste",
+  "denarja",
+  "kakšna",
+  "roke",
+  "noter",
+  "čisto",
+  "teh",
+  "svojega",
+  "moški",
+  "vseh",
+  "najbrž",
+  "vrnil",
+  "minut",
+  "karkoli",
+  "ženska",
+  "glavo",
+  "zanima",
+  "tip",
+  "narediti",
+  "svetu",
+  "brat",
+  "povem",
+  "mami",
+  "pomembno",
+  "dekle",
+  "obstaja",
+  "življenja",
+  "mestu",
+  "očeta",
+  "našla",
+  "vzel",
+  "naš",
+  "pravzaprav",
+  "razen",
+  "njih",
+  "najprej",
+  "čakaj",
+  "pazi",
+  "enega",
+  "pol",
+  "njegova",
+  "naše",
+  "mislite",
+  "ju",
+  "dobila",
+  "vemo",
+  "primer",
+  "zjutraj",
+  "najbolj",
+  "blizu",
+  "mogel",
+  "adijo",
+  "šlo",
+  "žena",
+  "drugače",
+  "želel",
+  "jutro",
+  "teden",
+  "drugo",
+  "tvoji",
+  "rekli",
+  "temu",
+  "oba",
+  "dobili",
+  "verjeti",
+  "mojbog",
+  "pot",
+  "malce",
+  "hudiča",
+  "hišo",
+  "želi",
+  "razumeš",
+  "nad",
+  "vaju",
+  "vzemi",
+  "težave",
+  "pripravljen",
+  "priti",
+  "govorim",
+  "izgleda",
+  "vraga",
+  "pustil",
+  "delam",
+  "leti",
+  "ljubica",
+  "ljubim",
+  "najti",
+  "radi",
+  "naredi",
+  "nisva",
+  "kateri",
+  "prihaja",
+  "poklical",
+  "pomagal",
+  "novo",
+  "morate",
+  "čudno",
+  "gor",
+  "nimaš",
+  "verjamem",
+  "lepa",
+  "oni",
+  "dolarjev",
+  "fanta",
+  "ubiti",
+  "reci",
+  "srce",
+  "vprašanje",
+  "dala",
+  "tvojega",
+  "počasi",
+  "otroci",
+  "jack",
+  "midva",
+  "smrt",
+  "takega",
+  "resnično",
+  "leto",
+  "poznaš",
+  "odšel",
+  "čeprav",
+  "notri",
+  "nami",
+  "mamo",
+  "prijatelja",
+  "halo",
+  "nato",
+  "spomniš",
+  "česa",
+  "imeti",
+  "sebi",
+  "precej",
+  "praviš",
+  "pomagam",
+  "orožje",
+  "jasno",
+  "drži",
+  "govorila",
+  "vami",
+  "druge",
+  "tak",
+  "živijo",
+  "službo",
+  "ženske",
+  "smrti",
+  "štiri",
+  "delal",
+  "pozabi",
+  "slišala",
+  "pomagati",
+  "izgubil",
+  "priložnost",
+  "srečo",
+  "naša",
+  "prvič",
+  "šef",
+  "okoli",
+  "miru",
+  "živi",
+  "popolnoma",
+  "storiti",
+  "končno",
+  "drug",
+  "nikogar",
+  "sebe",
+  "vsega",
+  "vama",
+  "človeka",
+  "dajte",
+  "roko",
+  "njen",
+  "njej",
+  "imava",
+  "ljubezen",
+  "kasneje",
+  "poslal",
+  "mar",
+  "sestra",
+  "spomnim",
+  "daleč",
+  "najboljši",
+  "pač",
+  "draga",
+  "večer",
+  "načrt",
+  "pridem",
+  "john",
+  "pravijo",
+  "problem",
+  "vidiva",
+  "moremo",
+  "mojem",
+  "vso",
+  "kri",
+  "želite",
+  "življenju",
+  "sporočilo",
+  "naredili",
+  "hiši",
+  "vidimo",
+  "vesel",
+  "policija",
+  "ženo",
+  "velik",
+  "poglejte",
+  "utihni",
+  "začel",
+  "smešno",
+  "umrla",
+  "potrebno",
+  "veseli",
+  "uro",
+  "sobo",
+  "katero",
+  "zgodi",
+  "rečem",
+  "družino",
+  "new",
+  "edini",
+  "pištolo",
+  "velika",
+  "mali",
+  "manj",
+  "družina",
+  "oditi",
+  "kraj",
+  "moč",
+  "ostani",
+  "prijatelji",
+  "potrebuje",
+  "ur",
+  "postal",
+  "enako",
+  "otroke",
+  "čudovito",
+  "sina",
+  "mati",
+  "prava",
+  "zares",
+  "pokliči",
+  "punca",
+  "včeraj",
+  "vsako",
+  "ubili",
+  "šli",
+  "njem",
+  "tistega",
+  "jezus",
+  "rit",
+  "čaka",
+  "nekoč",
+  "mojih",
+  "počutim",
+  "sledi",
+  "pozabil",
+  "bile",
+  "sobi",
+  "potrebuješ",
+  "strah",
+  "njeno",
+  "šest",
+  "sinoči",
+  "tiste",
+  "par",
+  "obraz",
+  "komaj",
+  "pridite",
+  "potrebujemo",
+  "smem",
+  "zanj",
+  "zadnji",
+  "njimi",
+  "kakšne",
+  "krasno",
+  "vašo",
+  "gdč",
+  "menoj",
+  "prepričana",
+  "teboj",
+  "ostal",
+  "nate",
+  "lep",
+  "vsa",
+  "odšla",
+  "svoji",
+  "svojih",
+  "noro",
+  "rešil",
+  "naslednji",
+  "dobim",
+  "kakor",
+  "resnico",
+  "kriv",
+  "igra",
+  "pravim",
+  "ubila",
+  "storila",
+  "bojim",
+  "tiho",
+  "njegove",
+  "tista",
+  "stara",
+  "mesta",
+  "povejte",
+  "najboljše",
+  "koncu",
+  "neverjetno",
+  "pojdite",
+  "žensko",
+  "vidva",
+  "edina",
+  "občutek",
+  "telefon",
+  "nekako",
+  "medtem",
+  "pomiri",
+  "pomagaj",
+  "deset",
+  "sedi",
+  "nimamo",
+  "času",
+  "poleg",
+  "naši",
+  "takole",
+  "dragi",
+  "vedeli",
+  "ostali",
+  "pripravljeni",
+  "deluje",
+  "vprašal",
+  "čim",
+  "pripravljena",
+  "želela",
+  "spoznala",
+  "živ",
+  "besede",
+  "sami",
+  "doktor",
+  "nekje",
+  "piše",
+  "pomaga",
+  "ostati",
+  "rabim",
+  "šele",
+  "mrtva",
+  "zadnje",
+  "delati",
+  "večerjo",
+  "sveta",
+  "dne",
+  "sicer",
+  "zraven",
+  "slišim",
+  "vrnila",
+  "spoznal",
+  "nobenega",
+  "mogla",
+  "naredim",
+  "začela",
+  "konca",
+  "vodo",
+  "brata",
+  "uh",
+  "morilec",
+  "spravi",
+  "moža",
+  "žrtev",
+  "pravo",
+  "letih",
+  "tokrat",
+  "ljubi",
+  "ure",
+  "prva",
+  "krvi",
+  "zabavo",
+  "možnosti",
+  "grozno",
+  "posel",
+  "kaže",
+  "gospodje",
+  "novega",
+  "ponovno",
+  "star",
+  "izvoli",
+  "veliki",
+  "prišlo",
+  "name",
+  "pojdiva",
+  "zgodba",
+  "poročila",
+  "prvo",
+  "pozneje",
+  "razlog",
+  "novi",
+  "pustila",
+  "pustite",
+  "boljše",
+  "sovražim",
+  "primeru",
+  "počakajte",
+  "odkar",
+  "dali",
+  "hiše",
+  "prinesel",
+  "nekega",
+  "slišati",
+  "isto",
+  "kupil",
+  "vzela",
+  "agent",
+  "slišiš",
+  "nje",
+  "hočete",
+  "zagotovo",
+  "prideš",
+  "ostala",
+  "možnost",
+  "napad",
+  "charlie",
+  "vodi",
+  "nočeš",
+  "hiša",
+  "pokaži",
+  "boli",
+  "obljubim",
+  "odpri",
+  "hrano",
+  "svojim",
+  "sliši",
+  "šolo",
+  "njena",
+  "ter",
+  "film",
+  "umor",
+  "nekateri",
+  "namesto",
+  "živeti",
+  "kod",
+  "kralj",
+  "menda",
+  "stoj",
+  "katerega",
+  "druga",
+  "cel",
+  "noče",
+  "pojma",
+  "sabo",
+  "vidite",
+  "dobiti",
+  "pijačo",
+  "nor",
+  "preprosto",
+  "njegovi",
+  "michael",
+  "vedo",
+  "kolega",
+  "dom",
+  "pokazal",
+  "oseba",
+  "nista",
+  "vrniti",
+  "trenutno",
+  "vrni",
+  "smeš",
+  "nov",
+  "spusti",
+  "poklicala",
+  "pogovoriti",
+  "ideja",
+  "ostalo",
+  "počne",
+  "šoli",
+  "resnici",
+  "pojdimo",
+  "moči",
+  "srček",
+  "hudo",
+  "slišali",
+  "tod",
+  "dam",
+  "kom",
+  "povsem",
+  "prostor",
+  "truplo",
+  "dati",
+  "vidi",
+  "sanje",
+  "tvojih",
+  "policijo",
+  "našo",
+  "zabavno",
+  "vaši",
+  "družine",
+  "plačal",
+  "zadnjič",
+  "poveš",
+  "nobene",
+  "mimo",
+  "nikar",
+  "močno",
+  "ustavi",
+  "končal",
+  "predsednik",
+  "zakon",
+  "dobre",
+  "pomagala",
+  "zadnja",
+  "frank",
+  "smel",
+  "tom",
+  "dveh",
+  "briga",
+  "ah",
+  "zase",
+  "reče",
+  "nova",
+  "zvečer",
+  "katere",
+  "pohiti",
+  "morajo",
+  "hoteli",
+  "škoda",
+  "noge",
+  "zgodbo",
+  "bogu",
+  "nikomur",
+  "kavo",
+  "spodaj",
+  "rešiti",
+  "nobenih",
+  "drugih",
+  "srečen",
+  "potreboval",
+  "kapitan",
+  "nemogoče",
+  "vrat",
+  "osebno",
+  "okrog",
+  "dobiš",
+  "številka",
+  "pozna",
+  "izmed",
+  "poslušajte",
+  "mike",
+  "prekleti",
+  "hočejo",
+  "pes",
+  "hodi",
+  "varno",
+  "delala",
+  "vrsti",
+  "jebi",
+  "naučil",
+  "tla",
+  "stric",
+  "njemu",
+  "klical",
+  "nove",
+  "telo",
+  "dekleta",
+  "odgovor",
+  "poskušal",
+  "vode",
+  "gledal",
+  "i",
+  "svojem",
+  "čutim",
+  "kreten",
+  "umreti",
+  "komu",
+  "sme",
+  "darilo",
+  "iščem",
+  "skrivnost",
+  "david",
+  "boljši",
+  "povedali",
+  "noči",
+  "sistem",
+  "avtu",
+  "george",
+  "sedem",
+  "vašega",
+  "tvojem",
+  "prosil",
+  "izgubila",
+  "fbi",
+  "stanovanje",
+};
+const uint16_t WA_FREQ_147_RANKS[] = {
+  0, 0, 530, 92, 988, 0, 0, 544, 0, 0, 0, 0, 0, 855, 0, 333,
+  0, 951, 507, 0, 0, 431, 0, 174, 0, 0, 482, 735, 0, 308, 0, 0,
+  0, 0, 0, 0, 0, 897, 102, 667, 947, 20, 416, 0, 501, 0, 0, 0,
+  57, 0, 469, 679, 957, 339, 510, 0, 0, 0, 0, 0, 0, 948, 0, 165,
+  0, 0, 0, 0, 0, 75, 780, 0, 0, 0, 0, 0, 0, 800, 0, 0,
+  55, 0, 0, 994, 694, 888, 635, 0, 0, 585, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 716, 0, 0, 0, 0, 84, 0, 0, 0, 671,
+  695, 699, 0, 0, 620, 0, 567, 0, 550, 46, 928, 731, 0, 0, 0, 0,
+  161, 656, 511, 666, 0, 406, 282, 82, 539, 518, 268, 197, 393, 547, 927, 0,
+  0, 0, 0, 0, 0, 0, 121, 605, 151, 774, 810, 819, 646, 0, 0, 0,
+  0, 205, 0, 0, 129, 0, 0, 0, 0, 0, 0, 639, 0, 0, 0, 998,
+  278, 0, 0, 688, 703, 0, 0, 691, 0, 0, 0, 0, 254, 45, 0, 0,
+  0, 0, 0, 0, 0, 625, 622, 374, 0, 0, 0, 674, 0, 753, 0, 0,
+  0, 0, 916, 0, 0, 618, 792, 599, 0, 0, 0, 0, 118, 0, 0, 0,
+  363, 0, 437, 0, 0, 0, 375, 0, 0, 0, 0, 0, 503, 615, 861, 0,
+  732, 0, 537, 62, 389, 698, 280, 875, 0, 0, 0, 230, 573, 794, 306, 0,
+  0, 27, 376, 558, 926, 949, 0, 0, 0, 877, 841, 624, 272, 993, 0, 144,
+  128, 417, 481, 0, 784, 346, 845, 979, 193, 136, 266, 0, 0, 0, 611, 0,
+  515, 881, 0, 0, 351, 0, 0, 449, 859, 262, 0, 271, 746, 645, 0, 0,
+  0, 0, 0, 0, 805, 186, 0, 0, 0, 842, 0, 0, 778, 574, 0, 0,
+  0, 0, 0, 0, 0, 521, 514, 0, 0, 0, 0, 0, 0, 896, 0, 0,
+  0, 0, 0, 0, 0, 0, 638, 0, 0, 0, 275, 140, 101, 640, 74, 207,
+  284, 329, 677, 710, 781, 873, 49, 621, 216, 324, 935, 997, 0, 0, 0, 33,
+  0, 0, 0, 0, 0, 0, 0, 99, 649, 852, 508, 0, 0, 366, 287, 385,
+  689, 0, 0, 409, 0, 0, 180, 285, 499, 577, 766, 0, 414, 682, 283, 772,
+  0, 522, 0, 0, 420, 467, 571, 513, 555, 357, 545, 378, 66, 433, 451, 632,
+  563, 633, 849, 25, 901, 903, 952, 527, 42, 718, 342, 809, 893, 0, 47, 878,
+  0, 0, 0, 88, 182, 0, 392, 0, 0, 0, 0, 0, 13, 19, 941, 0,
+  0, 970, 422, 328, 124, 258, 404, 279, 367, 380, 540, 911, 0, 0, 0, 923,
+  0, 0, 895, 976, 100, 183, 0, 0, 80, 317, 487, 701, 0, 312, 0, 0,
+  0, 402, 0, 0, 0, 0, 0, 767, 0, 0, 48, 763, 259, 825, 879, 0,
+  0, 811, 372, 153, 0, 0, 15, 512, 724, 359, 850, 972, 211, 572, 0, 0,
+  0, 0, 335, 171, 552, 169, 797, 134, 0, 0, 693, 0, 0, 0, 472, 0,
+  0, 0, 270, 0, 541, 0, 198, 604, 464, 958, 0, 29, 166, 65, 0, 0,
+  0, 0, 210, 675, 764, 0, 219, 554, 0, 0, 0, 0, 665, 0, 0, 0,
+  0, 479, 322, 444, 0, 0, 0, 659, 0, 0, 0, 806, 471, 60, 0, 509,
+  535, 556, 680, 0, 355, 293, 0, 0, 743, 983, 396, 426, 24, 0, 132, 37,
+  549, 883, 267, 697, 902, 999, 28, 0, 0, 291, 295, 528, 871, 0, 0, 425,
+  0, 76, 206, 0, 824, 0, 0, 0, 0, 0, 0, 0, 370, 0, 0, 506,
+  0, 0, 22, 589, 0, 0, 0, 35, 660, 827, 412, 910, 961, 0, 0, 0,
+  379, 0, 0, 0, 442, 0, 0, 0, 887, 154, 965, 0, 647, 0, 0, 221,
+  264, 398, 634, 953, 364, 0, 106, 0, 0, 0, 222, 18, 462, 917, 955, 0,
+  714, 0, 445, 0, 11, 663, 0, 0, 0, 331, 0, 0, 14, 0, 562, 0,
+  0, 115, 428, 263, 719, 388, 0, 0, 133, 889, 696, 0, 0, 0, 0, 98,
+  395, 954, 0, 0, 0, 711, 399, 702, 930, 839, 44, 361, 390, 0, 0, 0,
+  0, 0, 10, 0, 391, 0, 681, 0, 0, 0, 0, 0, 0, 200, 832, 485,
+  214, 613, 0, 0, 0, 0, 0, 0, 310, 0, 0, 0, 157, 837, 224, 0,
+  0, 529, 415, 531, 905, 566, 0, 606, 315, 0, 466, 777, 0, 418, 0, 0,
+  0, 0, 217, 234, 407, 454, 489, 0, 0, 713, 0, 0, 0, 0, 0, 676,
+  564, 432, 0, 0, 752, 705, 642, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 39, 843, 0, 0, 773, 0, 580, 0, 0, 0, 0, 0, 0, 736, 301,
+  974, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 184, 846, 0, 0, 0,
+  0, 623, 0, 0, 0, 808, 628, 446, 721, 365, 799, 0, 97, 159, 215, 452,
+  362, 561, 673, 709, 0, 0, 0, 256, 423, 336, 492, 493, 597, 672, 796, 0,
+  0, 0, 160, 0, 302, 439, 1, 347, 354, 401, 669, 700, 749, 286, 950, 977,
+  0, 311, 0, 0, 0, 0, 0, 191, 0, 0, 341, 34, 0, 0, 0, 0,
+  251, 305, 651, 590, 741, 248, 860, 919, 94, 289, 0, 0, 0, 0, 212, 668,
+  158, 0, 0, 0, 0, 0, 0, 0, 543, 0, 0, 520, 551, 0, 0, 0,
+  0, 497, 598, 455, 0, 0, 0, 0, 0, 0, 517, 265, 802, 313, 337, 465,
+  616, 761, 822, 0, 0, 0, 0, 886, 0, 0, 0, 0, 798, 0, 0, 0,
+  0, 0, 307, 135, 608, 692, 867, 0, 801, 343, 0, 0, 484, 332, 0, 723,
+  891, 427, 836, 892, 327, 0, 0, 0, 0, 793, 0, 0, 0, 0, 0, 0,
+  0, 996, 71, 296, 204, 0, 109, 768, 0, 0, 0, 0, 0, 12, 536, 758,
+  0, 436, 0, 0, 0, 0, 0, 0, 235, 885, 0, 0, 0, 576, 587, 0,
+  745, 0, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 314, 785, 658,
+  0, 0, 0, 458, 728, 937, 172, 0, 0, 0, 30, 0, 750, 494, 686, 833,
+  0, 77, 779, 0, 0, 0, 103, 96, 854, 244, 457, 593, 0, 0, 0, 0,
+  0, 0, 58, 209, 738, 0, 2, 0, 0, 596, 0, 733, 0, 0, 0, 0,
+  0, 0, 0, 0, 470, 123, 377, 440, 584, 770, 294, 0, 0, 0, 150, 104,
+  0, 0, 0, 706, 0, 424, 0, 984, 960, 122, 967, 237, 0, 914, 218, 330,
+  356, 0, 524, 831, 9, 612, 0, 226, 592, 602, 319, 461, 828, 0, 0, 922,
+  126, 273, 142, 820, 0, 0, 0, 31, 382, 0, 684, 980, 0, 6, 435, 925,
+  0, 548, 0, 0, 0, 0, 0, 0, 318, 107, 81, 323, 252, 434, 0, 0,
+  0, 0, 0, 0, 276, 648, 939, 0, 0, 915, 0, 0, 0, 0, 0, 904,
+  67, 0, 0, 0, 0, 0, 419, 0, 0, 0, 0, 21, 78, 164, 874, 0,
+  119, 0, 0, 0, 201, 884, 0, 483, 0, 0, 546, 804, 0, 869, 0, 0,
+  533, 0, 0, 0, 0, 0, 199, 0, 0, 188, 0, 0, 443, 0, 664, 0,
+  0, 91, 0, 0, 0, 523, 0, 0, 0, 908, 0, 0, 0, 0, 130, 167,
+  757, 0, 290, 257, 0, 594, 192, 756, 0, 0, 0, 0, 0, 340, 0, 137,
+  63, 0, 0, 0, 722, 349, 0, 532, 0, 0, 712, 5, 0, 384, 0, 139,
+  844, 0, 583, 345, 595, 760, 857, 0, 0, 0, 630, 0, 0, 0, 0, 0,
+  0, 316, 0, 502, 0, 0, 890, 936, 0, 0, 127, 872, 0, 468, 876, 629,
+  813, 0, 0, 117, 0, 650, 0, 0, 0, 0, 309, 0, 0, 921, 0, 0,
+  0, 0, 0, 865, 0, 0, 0, 0, 0, 277, 906, 176, 744, 882, 0, 89,
+  945, 0, 0, 807, 0, 292, 0, 0, 0, 0, 0, 0, 0, 488, 519, 740,
+  619, 175, 51, 0, 0, 0, 173, 720, 0, 0, 631, 0, 0, 657, 0, 933,
+  0, 298, 163, 0, 0, 0, 607, 0, 242, 0, 0, 373, 934, 0, 0, 0,
+  0, 108, 929, 0, 963, 0, 557, 907, 400, 0, 0, 0, 816, 0, 678, 582,
+  0, 0, 371, 438, 575, 538, 717, 729, 0, 0, 0, 0, 0, 0, 0, 504,
+  0, 870, 559, 0, 734, 0, 708, 938, 0, 0, 0, 812, 148, 0, 0, 0,
+  0, 0, 0, 0, 591, 325, 0, 245, 834, 0, 352, 0, 742, 0, 0, 187,
+  413, 652, 0, 0, 815, 0, 0, 17, 26, 840, 931, 959, 653, 326, 754, 260,
+  360, 569, 868, 913, 956, 982, 320, 995, 348, 59, 1000, 156, 0, 0, 0, 0,
+  0, 0, 0, 304, 491, 0, 0, 0, 0, 490, 0, 851, 0, 0, 0, 0,
+  0, 0, 704, 0, 0, 203, 0, 964, 474, 0, 0, 748, 641, 899, 762, 0,
+  568, 858, 0, 0, 0, 227, 924, 170, 707, 0, 0, 213, 0, 459, 829, 0,
+  120, 269, 0, 386, 368, 36, 441, 791, 985, 992, 0, 0, 0, 553, 250, 453,
+  0, 0, 0, 429, 0, 475, 253, 601, 0, 579, 0, 765, 0, 918, 0, 0,
+  0, 685, 776, 0, 0, 0, 0, 381, 0, 942, 0, 981, 0, 0, 0, 968,
+  0, 0, 771, 0, 0, 715, 0, 516, 739, 0, 0, 0, 112, 0, 53, 973,
+  0, 0, 0, 0, 0, 789, 247, 986, 803, 0, 0, 866, 0, 113, 0, 0,
+  0, 0, 0, 971, 0, 0, 0, 110, 0, 0, 0, 0, 727, 0, 4, 168,
+  565, 654, 0, 0, 0, 0, 0, 0, 0, 0, 249, 0, 0, 0, 505, 0,
+  0, 105, 448, 912, 0, 0, 72, 0, 0, 643, 0, 823, 610, 0, 0, 228,
+  0, 220, 40, 0, 637, 421, 880, 0, 0, 0, 0, 408, 145, 940, 0, 0,
+  38, 0, 0, 0, 0, 900, 0, 430, 0, 0, 0, 196, 987, 0, 0, 0,
+  0, 202, 670, 0, 626, 403, 0, 0, 0, 460, 131, 358, 243, 261, 246, 0,
+  0, 759, 0, 0, 138, 43, 0, 0, 636, 90, 755, 847, 0, 0, 0, 838,
+  0, 814, 0, 0, 0, 0, 0, 179, 655, 0, 0, 7, 383, 570, 473, 614,
+  0, 338, 737, 0, 0, 0, 0, 0, 0, 0, 989, 241, 898, 405, 0, 0,
+  0, 0, 87, 223, 817, 0, 0, 0, 0, 0, 990, 486, 0, 0, 114, 795,
+  463, 239, 281, 662, 0, 238, 353, 726, 0, 661, 0, 0, 0, 0, 0, 0,
+  178, 0, 0, 225, 190, 476, 730, 480, 790, 863, 0, 0, 70, 0, 297, 232,
+  0, 848, 586, 600, 0, 0, 991, 93, 181, 16, 334, 54, 0, 125, 233, 143,
+  387, 447, 411, 111, 344, 835, 0, 0, 0, 86, 0, 617, 962, 783, 0, 162,
+  236, 534, 920, 0, 0, 498, 0, 0, 0, 0, 0, 769, 0, 0, 397, 525,
+  149, 288, 853, 894, 255, 725, 975, 0, 0, 0, 394, 787, 155, 856, 0, 0,
+  0, 0, 0, 0, 194, 786, 450, 978, 208, 410, 609, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 185, 231, 0, 0, 0, 0, 0, 85, 141, 0, 775, 478,
+  588, 50, 0, 0, 862, 0, 0, 477, 0, 0, 0, 0, 3, 274, 782, 969,
+  68, 627, 0, 0, 0, 0, 0, 456, 0, 116, 240, 0, 0, 0, 0, 0,
+  0, 0, 83, 0, 0, 0, 303, 0, 818, 0, 603, 687, 0, 23, 0, 581,
+  747, 864, 0, 0, 0, 944, 0, 0, 0, 0, 8, 0, 0, 0, 0, 229,
+  0, 0, 830, 495, 0, 189, 52, 195, 350, 644, 751, 146, 683, 0, 0, 526,
+  943, 41, 0, 578, 69, 542, 299, 560, 826, 0, 0, 0, 0, 0, 0, 64,
+  73, 79, 500, 788, 821, 321, 909, 932, 690, 0, 0, 496, 0, 0, 0, 0,
+  0, 0, 0, 369, 0, 0, 946, 0, 147, 0, 0, 0, 0, 0, 56, 61,
+  966, 0, 0, 0, 0, 300, 0, 0, 152, 0, 0, 0, 0, 177, 95, 0,
+};
+
+const char *WA_FREQ_148_TOKENS[] = {
+  "maam",
+  "edtjebe",
+  "lea",
+  "mov",
+  "ålkone",
+  "mïnnedh",
+  "daanbien",
+  "ij",
+  "bïjle",
+  "tom",
+  "jovkoe",
+  "guktie",
+  "datnine",
+  "manne",
+  "oslovisnie",
+  "årroem",
+  "hæhtadidh",
+  "skuvlen",
+  "mænngan",
+  "datne",
+  "darjoeminie",
+  "mij",
+  "gaskebiejjiebeapmose",
+  "sïjhth",
+  "byöpmedidh",
+  "gaahtoe",
+};
+const uint16_t WA_FREQ_148_RANKS[] = {
+  16, 0, 4, 15, 19, 0, 5, 0, 0, 0, 0, 1, 0, 21, 0, 0,
+  6, 3, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0,
+  8, 0, 13, 0, 0, 0, 0, 0, 25, 23, 0, 9, 26, 0, 0, 10,
+  0, 0, 0, 0, 0, 12, 0, 14, 18, 7, 17, 0, 20, 11, 24, 0,
+};
+
+const char *WA_FREQ_149_TOKENS[] = {
+  "kuti",
+  "kana",
+  "uye",
+  "asi",
+  "uyu",
+  "iyi",
+  "nekuti",
+  "ane",
+  "ari",
+  "iri",
+  "vanhu",
+  "makore",
+  "vana",
+  "vari",
+  "mari",
+  "apo",
+  "chete",
+  "vanoti",
+  "murume",
+  "mwana",
+  "vanodaro",
+  "ava",
+  "anoti",
+  "kuita",
+  "nyaya",
+  "wake",
+  "munhu",
+  "avo",
+  "pamwe",
+  "vamwe",
+  "zvikuru",
+  "zvakare",
+  "ichi",
+  "nguva",
+  "Ndiri",
+  "sezvo",
+  "mukadzi",
+  "anodaro",
+  "wangu",
+  "achiti",
+  "vake",
+  "kusvika",
+  "uyo",
+  "Kana",
+  "kubva",
+  "izvi",
+  "kune",
+  "ndiri",
+  "aya",
+  "akadaro",
+  "nekuda",
+  "basa",
+  "mumwe",
+  "zviri",
+  "Asi",
+  "izvo",
+  "zvinhu",
+  "saka",
+  "vakadaro",
+  "mudzimai",
+  "pane",
+  "wavo",
+  "Vanoti",
+  "here",
+  "pasi",
+  "vachiti",
+  "naye",
+  "vane",
+  "mvura",
+  "yake",
+  "yangu",
+  "kuda",
+  "kuenda",
+  "Mai",
+  "zvakanaka",
+  "rino",
+  "mushure",
+  "iye",
+  "mberi",
+  "ini",
+  "iyo",
+  "Izvi",
+  "kumba",
+  "yavo",
+  "musikana",
+  "Ini",
+  "anonzi",
+  "yekuti",
+  "kwete",
+  "zvekuti",
+  "anoda",
+  "kunge",
+  "sei",
+  "imwe",
+  "idzi",
+  "vavo",
+  "vave",
+  "gore",
+  "nyika",
+  "pamba",
+  "vanenge",
+  "uko",
+  "amai",
+  "zvimwe",
+  "kutaura",
+  "dambudziko",
+  "pamusoro",
+  "asina",
+  "dzimwe",
+  "svondo",
+  "mumba",
+  "hapana",
+  "ravo",
+  "nevana",
+  "vangu",
+  "zvino",
+  "akati",
+  "mukomana",
+  "nevamwe",
+  "varimi",
+  "tiri",
+  "anenge",
+  "ave",
+  "zvose",
+  "Anoti",
+  "ndiye",
+  "kuona",
+  "Saka",
+  "Mwari",
+  "mishonga",
+  "rake",
+  "ine",
+  "pasina",
+  "baba",
+  "vose",
+  "kugara",
+  "mabasa",
+  "mukuru",
+  "munyika",
+  "ndivo",
+  "apa",
+  "uri",
+  "vaviri",
+  "navo",
+  "kuitira",
+  "mashoko",
+  "riri",
+  "dzavo",
+  "haana",
+  "musi",
+  "muno",
+  "Vamwe",
+  "nemurume",
+  "dziri",
+  "rimwe",
+  "pakati",
+  "rapera",
+  "chiri",
+  "muHarare",
+  "mune",
+  "mhosva",
+  "mugore",
+  "kunze",
+  "panguva",
+  "kuburikidza",
+  "vabereki",
+  "Dr",
+  "maviri",
+  "mhuri",
+  "Kune",
+  "mekunge",
+  "nemwana",
+  "ndinotsvagawo",
+  "kumusha",
+  "kwake",
+  "Nyaya",
+  "uno",
+  "zvakaita",
+  "mukana",
+  "yedu",
+  "kuchikoro",
+  "chikwata",
+  "ndechekuti",
+  "HIV",
+  "ivo",
+  "Africa",
+  "zvinoita",
+  "vakati",
+  "akanga",
+  "nevanhu",
+  "kare",
+  "vanoda",
+  "Murume",
+  "kudya",
+  "of",
+  "Mutongi",
+  "mbeu",
+  "zuva",
+  "Zimbabwe",
+  "kuziva",
+  "pachena",
+  "yacho",
+  "nzvimbo",
+  "kuna",
+  "madzimai",
+  "dzake",
+  "pano",
+  "uyewo",
+  "Vanhu",
+  "vatambi",
+  "vasina",
+  "Kwayedza",
+  "akaita",
+  "kwavo",
+  "kuramba",
+  "zvakawanda",
+  "nezvimwe",
+  "kuitwa",
+  "mombe",
+  "pfungwa",
+  "dzangu",
+  "nyoka",
+  "handina",
+  "muna",
+  "dare",
+  "pachokwadi",
+  "inonzi",
+  "nokuti",
+  "chirwere",
+  "ndipo",
+  "ndiyo",
+  "kutsvaga",
+  "kushanda",
+  "vazhinji",
+  "vakawanda",
+  "vedu",
+  "mazuva",
+  "varume",
+  "ropa",
+  "anogona",
+  "mamwe",
+  "kuno",
+  "zita",
+  "vanonzi",
+  "zvavo",
+  "mudare",
+  "mutambo",
+  "chaizvo",
+  "ainge",
+  "guru",
+  "yose",
+  "gwaro",
+  "1",
+  "kuHarare",
+  "Court",
+  "tsika",
+  "chinhu",
+  "isu",
+  "yakawanda",
+  "nekudaro",
+  "ngaandibate",
+  "nhabvu",
+  "havana",
+  "aine",
+  "kunyangwe",
+  "kuwana",
+  "ndine",
+  "kuri",
+  "imba",
+  "kudare",
+  "mweya",
+  "ndizvo",
+  "uku",
+  "chimwe",
+  "nemudzimai",
+  "nzira",
+  "nenguva",
+  "chikoro",
+  "mwaka",
+  "zvine",
+  "chake",
+  "ayo",
+  "mitambo",
+  "munyaya",
+  "kunyanya",
+  "Makadii",
+  "iro",
+  "nemumwe",
+  "achida",
+  "zvakasiyana",
+  "zvidzidzo",
+  "Sekuru",
+  "veKwayedza",
+  "hama",
+  "kushandisa",
+  "kupinda",
+  "zvakakosha",
+  "Mwana",
+  "aive",
+  "upenyu",
+  "veruzhinji",
+  "Civil",
+  "18",
+  "kufamba",
+  "ino",
+  "30",
+  "Mambo",
+  "zvisinei",
+  "Vana",
+  "nenyaya",
+  "yadarika",
+  "ruzivo",
+  "rangu",
+  "Cde",
+  "kuuya",
+  "Mbuya",
+  "vanogona",
+  "zvikoro",
+  "utachiona",
+  "nhasi",
+  "chokwadi",
+  "chii",
+  "zvikwata",
+  "rubatsiro",
+  "vanofanira",
+  "nyama",
+  "000",
+  "vakuru",
+  "ake",
+  "ose",
+  "pamusha",
+  "mbiri",
+  "wacho",
+  "bedzi",
+  "chekuti",
+  "redu",
+  "20",
+  "iwe",
+  "zvirimwa",
+  "zvake",
+  "chirongwa",
+  "fodya",
+  "pamberi",
+  "akabva",
+  "hweHIV",
+  "dzidzo",
+  "inenge",
+  "akange",
+  "chavo",
+  "kuchipatara",
+  "nemari",
+  "neni",
+  "vadzidzi",
+  "nazvo",
+  "akasiyana",
+  "mukombe",
+  "mwedzi",
+  "kutora",
+  "vacho",
+  "kusvikira",
+  "pari",
+  "vange",
+  "rose",
+  "zvese",
+  "25",
+  "goho",
+  "ndinoda",
+  "simba",
+  "2",
+  "Zvisinei",
+  "aiva",
+  "vechidiki",
+  "matatu",
+  "rine",
+  "edu",
+  "kubatsira",
+  "zvakanyanya",
+  "Hurumende",
+  "huru",
+  "mumutambo",
+  "pedyo",
+  "vachida",
+  "ipapo",
+  "vainge",
+  "Mudzimai",
+  "kubasa",
+  "zvinonzi",
+  "achibva",
+  "mutumbi",
+  "wose",
+  "dai",
+  "vakaita",
+  "Amai",
+  "munguva",
+  "Nhare",
+  "chero",
+  "kutanga",
+  "nenzira",
+  "vaine",
+  "panzvimbo",
+  "tine",
+  "zvirwere",
+  "n’anga",
+  "kumapurisa",
+  "kupa",
+  "zvisina",
+  "nesimba",
+  "tsvina",
+  "dzose",
+  "icho",
+  "kusanganisira",
+  "zvinenge",
+  "Tine",
+  "naamai",
+  "munzvimbo",
+  "rinonzi",
+  "anobva",
+  "Ndine",
+  "mukati",
+  "mushonga",
+  "ano",
+  "muZimbabwe",
+  "kudarika",
+  "ndiko",
+  "gumi",
+  "musoro",
+  "kunzi",
+  "Mumwe",
+  "nemukadzi",
+  "pachikoro",
+  "vechikoro",
+  "Ndinoda",
+  "chikafu",
+  "muzvikoro",
+  "akaudza",
+  "kwangu",
+  "pamuviri",
+  "doro",
+  "zvichitevera",
+  "anofanira",
+  "kuitika",
+  "rekuti",
+  "idzo",
+  "zvinoreva",
+  "chedu",
+  "hwavo",
+  "nayo",
+  "vanova",
+  "35",
+  "Baba",
+  "yako",
+  "anoita",
+  "urwu",
+  "vatatu",
+  "wedu",
+  "Zvino",
+  "vakanga",
+  "kubuda",
+  "anogara",
+  "kunzwa",
+  "Pane",
+  "School",
+  "kutamba",
+  "pfupi",
+  "akapa",
+  "dzine",
+  "rudo",
+  "40",
+  "Isu",
+  "Tiri",
+  "Zvakadaro",
+  "murimi",
+  "nhare",
+  "matambudziko",
+  "paine",
+  "Mashoko",
+  "wekuroora",
+  "and",
+  "zhinji",
+  "kudai",
+  "wako",
+  "hunhu",
+  "neKwayedza",
+  "yave",
+  "anoshanda",
+  "iyoyo",
+  "mudunhu",
+  "Munhu",
+  "vaive",
+  "midziyo",
+  "ekuti",
+  "ndave",
+  "ndiwo",
+  "acho",
+  "panyaya",
+  "redziviriro",
+  "Mukadzi",
+  "venhau",
+  "zvinova",
+  "kure",
+  "kupi",
+  "Madzibaba",
+  "akawanda",
+  "ikoko",
+  "kurima",
+  "nyore",
+  "akatanga",
+  "negative",
+  "nemusi",
+  "tave",
+  "dzedu",
+  "hakuna",
+  "Anoda",
+  "Jesu",
+  "motokari",
+  "yepamusoro",
+  "23",
+  "tinoda",
+  "vachiri",
+  "dzakasiyana",
+  "musha",
+  "nababa",
+  "zvave",
+  "aida",
+  "positive",
+  "dzimba",
+  "ange",
+  "kuve",
+  "mapurisa",
+  "reHarare",
+  "kufa",
+  "muporofita",
+  "asati",
+  "haasi",
+  "haina",
+  "tose",
+  "akafa",
+  "chikamu",
+  "radarika",
+  "vakadzi",
+  "kwenyaya",
+  "sepaanoti",
+  "achiita",
+  "Kubva",
+  "wekuti",
+  "kodzero",
+  "Dambudziko",
+  "kwekuti",
+  "ndinodawo",
+  "vanove",
+  "nhengo",
+  "mhando",
+  "zvinosanganisira",
+  "inoti",
+  "kubvira",
+  "chibage",
+  "mbatya",
+  "muviri",
+  "vakange",
+  "Primary",
+  "yakaita",
+  "vachiita",
+  "vanogara",
+  "zvichidzika",
+  "kwazvo",
+  "nani",
+  "kuSouth",
+  "mhuka",
+  "Co",
+  "hwake",
+  "mazita",
+  "pavo",
+  "22",
+  "nemvura",
+  "vanoita",
+  "kunoita",
+  "mutambi",
+  "ndokuti",
+  "President",
+  "vanhukadzi",
+  "hazvina",
+  "kubata",
+  "kubatsirwa",
+  "nemunhu",
+  "chekuita",
+  "Dzimwe",
+  "dzakawanda",
+  "mudiki",
+  "ivhu",
+  "kwenguva",
+  "nemakore",
+  "bvunzo",
+  "vava",
+  "mana",
+  "okuberekwa",
+  "kwakaita",
+  "kwandiri",
+  "akaramba",
+  "racho",
+  "mikana",
+  "pamwedzi",
+  "vasati",
+  "utano",
+  "zvachose",
+  "kwaari",
+  "zvazvo",
+  "High",
+  "Ko",
+  "26",
+  "kunyika",
+  "zvakasimba",
+  "akanaka",
+  "ekuberekwa",
+  "kwenyika",
+  "isina",
+  "munharaunda",
+  "mwanasikana",
+  "nemweya",
+  "pangu",
+  "panze",
+  "28",
+  "inogona",
+  "muzukuru",
+  "ndini",
+  "kunzvimbo",
+  "ndokubva",
+  "adarika",
+  "nedzimwe",
+  "Iye",
+  "kubhadhara",
+  "kwedu",
+  "miriyoni",
+  "nhetembo",
+  "Gore",
+  "Zvakadai",
+  "zvangu",
+  "achiri",
+  "dzinoti",
+  "kutsvagawo",
+  "Svondo",
+  "Handina",
+  "mashanu",
+  "24",
+  "izvozvo",
+  "miviri",
+  "nemishonga",
+  "varairidzi",
+  "4",
+  "kudaro",
+  "kunyora",
+  "kureva",
+  "zvinogona",
+  "nevabereki",
+  "kuchechi",
+  "ndiro",
+  "sangano",
+  "vaida",
+  "kwava",
+  "moto",
+  "vanofanirwa",
+  "akaenda",
+  "kurarama",
+  "mabhuku",
+  "kutenga",
+  "maringe",
+  "Mari",
+  "Zvimwe",
+  "akamhan’arira",
+  "anofanirwa",
+  "nhamba",
+  "zvakadaro",
+  "wekutanga",
+  "32",
+  "Anoenderera",
+  "Mugabe",
+  "aka",
+  "makumi",
+  "kushandiswa",
+  "vanasikana",
+  "mumitambo",
+  "Akati",
+  "Rudo",
+  "chitunha",
+  "nawo",
+  "27",
+  "kupihwa",
+  "kusimudzira",
+  "mukurumbira",
+  "nevarume",
+  "kwemakore",
+  "mimwe",
+  "mumusha",
+  "zvemba",
+  "kukwanisa",
+  "kwevana",
+  "nemhuri",
+  "huku",
+  "oga",
+  "pamutemo",
+  "kusangana",
+  "wechikoro",
+  "7",
+  "chine",
+  "huroyi",
+  "maporofita",
+  "vaiva",
+  "zvakadai",
+  "senzira",
+  "vanobva",
+  "Ngaave",
+  "matanho",
+  "mazwi",
+  "mudzimba",
+  "sekuti",
+  "wenyika",
+  "zvinoda",
+  "Pamusoro",
+  "Tinoda",
+  "kwavari",
+  "nehama",
+  "ongororo",
+  "Central",
+  "United",
+  "Varimi",
+  "divi",
+  "kun’anga",
+  "pake",
+  "shamwari",
+  "upfumi",
+  "Izvozvi",
+  "kuchengeta",
+  "dzakaita",
+  "mubvunzo",
+  "nen’anga",
+  "Kuti",
+  "yaiva",
+  "yese",
+  "zvedu",
+  "nemapurisa",
+  "unenge",
+  "FC",
+  "vese",
+  "zvakaitika",
+  "chaiyo",
+  "Ishe",
+  "husiku",
+  "zvacho",
+  "3",
+  "muupenyu",
+  "rinoti",
+  "chechi",
+  "chikuru",
+  "kuhwina",
+  "Mushure",
+  "achienda",
+  "inoda",
+  "vadiki",
+  "izvozvi",
+  "umo",
+  "umu",
+  "angu",
+  "anova",
+  "mutauro",
+  "sadza",
+  "Iyi",
+  "huwandu",
+  "kumashure",
+  "kuonekwa",
+  "kuvanhu",
+  "Nyanduri",
+  "nyangwe",
+  "shasha",
+  "wese",
+  "yaive",
+  "Ndipo",
+  "anoona",
+  "chinonzi",
+  "kurwara",
+  "refu",
+  "tsumo",
+  "yakaitwa",
+  "yechikoro",
+  "haisi",
+  "inoita",
+  "kutaurwa",
+  "21",
+  "Ari",
+  "kudunhu",
+  "shungu",
+  "the",
+  "vakabva",
+  "City",
+  "nezvinhu",
+  "36",
+  "chino",
+  "yevanhu",
+  "Changamire",
+  "Dai",
+  "Dokora",
+  "Hongu",
+  "akadai",
+  "chaiko",
+  "ndava",
+  "ndeyekuti",
+  "nenyoka",
+  "kutarisira",
+  "muroora",
+  "dzinosanganisira",
+  "vachibva",
+  "vakomana",
+  "Hapana",
+  "Moyo",
+  "nokudaro",
+  "asiri",
+  "dzinenge",
+  "nemamwe",
+  "Apa",
+  "Platinum",
+  "havasi",
+  "hembe",
+  "muri",
+  "naro",
+  "parizvino",
+  "vakatanga",
+  "wadarika",
+  "imbwa",
+  "naMwari",
+  "panhamba",
+  "chaiwo",
+  "hanzvadzi",
+  "mawoko",
+  "zvekudya",
+  "zvipfuyo",
+  "League",
+  "dzakadai",
+  "enyika",
+  "hangu",
+  "nematambudziko",
+  "29",
+  "Cup",
+  "Sabhuku",
+  "45",
+  "Mukuru",
+  "chibharo",
+  "hupenyu",
+  "manyepo",
+  "50",
+  "anove",
+  "mavo",
+  "mukusimudzira",
+  "34",
+  "Panguva",
+  "huri",
+  "kuva",
+  "une",
+  "kupera",
+  "mapiritsi",
+  "murairidzi",
+  "wave",
+  "semunhu",
+  "mumunda",
+  "mutemo",
+  "Madzimai",
+  "Vachitaura",
+  "ambuya",
+  "Seed",
+  "dzacho",
+  "hurukuro",
+  "maererano",
+  "ndicho",
+  "yava",
+  "gomarara",
+  "nedambudziko",
+  "redzidzo",
+  "zvirongwa",
+  "Zvakakosha",
+  "muridzi",
+  "vashandi",
+  "37",
+  "emawoko",
+  "hatina",
+  "hondo",
+  "make",
+  "33",
+  "kuisa",
+  "pamushonga",
+  "yakanaka",
+  "chinangwa",
+  "chose",
+  "kudzokera",
+  "kushaya",
+  "wesangano",
+  "38",
+  "kubvisa",
+  "miti",
+  "mubhuku",
+  "wayo",
+  "19",
+  "idzva",
+  "vanokwanisa",
+  "naizvozvo",
+  "vakafa",
+  "Nguva",
+  "shoma",
+  "tinenge",
+  "unogona",
+  "zvinodiwa",
+  "hwenyika",
+  "kunwa",
+  "mota",
+  "musango",
+  "nderekuti",
+  "vawane",
+  "Vakati",
+  "anokwanisa",
+  "muchikwata",
+  "mumvura",
+  "vanotiwo",
+  "achinge",
+  "mamiriro",
+  "bonde",
+  "kutevera",
+  "Vanoenderera",
+  "usina",
+  "vakaona",
+  "yakasiyana",
+  "zviviri",
+  "kuvaka",
+  "nyanduri",
+  "rakanaka",
+  "afa",
+  "ati",
+  "bazi",
+  "maziso",
+  "unonzi",
+  "zvichinzi",
+  "kuChitungwiza",
+  "kumbobvira",
+  "kumutambo",
+  "kutambira",
+  "nekuita",
+  "nenyika",
+  "rinenge",
+  "vanoziva",
+  "zvizhinji",
+  "achinzi",
+  "kuzvikoro",
+  "nemaporofita",
+  "kuratidza",
+  "mafuta",
+  "neimwe",
+  "nemagariro",
+  "pahekita",
+  "shoko",
+  "tinoona",
+  "vasikana",
+  "vatsigiri",
+  "zvenyu",
+  "neutachiona",
+  "vachienda",
+  "varwere",
+  "kutya",
+  "mhiko",
+  "nesangano",
+  "tsamba",
+  "Hospital",
+  "dzekuti",
+  "kuroorwa",
+  "mitatu",
+  "nadzo",
+  "pave",
+  "sekuru",
+  "chikonzero",
+  "mubairo",
+  "mukoma",
+  "tete",
+  "vakwanise",
+  "Zvinonzi",
+  "mazano",
+  "mufaro",
+  "pachiitiko",
+  "pose",
+  "vanosanganisira",
+  "zvishoma",
+  "iripo",
+  "magwaro",
+  "muroyi",
+  "musangano",
+  "rufu",
+  "vanotsinhira",
+  "aenda",
+  "inyaya",
+  "nechinangwa",
+  "nyanzvi",
+  "kambani",
+  "Muhurukuro",
+  "changu",
+  "hwakanaka",
+  "kufunga",
+  "ndinotsvaga",
+};
+const uint16_t WA_FREQ_149_RANKS[] = {
+  0, 0, 906, 0, 0, 63, 996, 0, 0, 0, 0, 0, 0, 750, 794, 955,
+  970, 0, 157, 275, 490, 0, 793, 219, 0, 0, 877, 0, 0, 0, 0, 0,
+  673, 103, 343, 580, 969, 870, 0, 0, 0, 670, 0, 765, 949, 0, 0, 322,
+  0, 0, 896, 0, 0, 0, 0, 682, 0, 0, 0, 0, 479, 286, 562, 904,
+  986, 0, 0, 859, 0, 168, 592, 688, 0, 0, 0, 0, 994, 0, 390, 707,
+  728, 0, 0, 153, 809, 25, 31, 101, 211, 951, 0, 0, 0, 702, 353, 460,
+  0, 0, 0, 0, 0, 491, 0, 964, 977, 0, 0, 0, 961, 976, 0, 0,
+  0, 0, 0, 0, 297, 963, 332, 639, 0, 0, 29, 178, 316, 428, 947, 542,
+  0, 171, 181, 461, 0, 0, 0, 200, 232, 218, 799, 485, 444, 543, 594, 0,
+  0, 0, 0, 933, 0, 0, 937, 0, 770, 932, 518, 0, 634, 107, 288, 0,
+  0, 0, 0, 0, 199, 52, 324, 0, 0, 0, 0, 909, 0, 469, 0, 672,
+  866, 984, 0, 0, 342, 0, 0, 0, 888, 681, 0, 0, 0, 0, 0, 0,
+  49, 1000, 640, 313, 57, 414, 452, 0, 0, 0, 0, 0, 73, 0, 668, 780,
+  523, 700, 0, 320, 400, 569, 0, 929, 0, 0, 845, 0, 690, 406, 33, 0,
+  779, 0, 577, 0, 747, 0, 0, 418, 437, 885, 36, 990, 0, 997, 0, 0,
+  0, 0, 87, 283, 449, 0, 0, 0, 439, 0, 474, 513, 254, 771, 182, 229,
+  0, 514, 61, 0, 0, 0, 0, 0, 0, 0, 0, 405, 656, 260, 547, 0,
+  0, 0, 54, 872, 156, 0, 487, 926, 0, 0, 0, 0, 150, 19, 0, 0,
+  840, 533, 0, 0, 0, 0, 0, 0, 0, 0, 892, 908, 945, 0, 0, 480,
+  0, 0, 0, 62, 24, 64, 796, 0, 935, 0, 334, 0, 0, 827, 0, 0,
+  717, 0, 0, 0, 202, 296, 0, 635, 819, 0, 398, 864, 0, 0, 346, 0,
+  0, 0, 0, 0, 111, 59, 0, 0, 0, 0, 0, 117, 0, 0, 0, 0,
+  0, 0, 0, 158, 0, 0, 0, 0, 104, 278, 0, 0, 889, 0, 226, 842,
+  482, 616, 775, 0, 0, 607, 0, 32, 920, 0, 0, 116, 245, 0, 588, 743,
+  884, 0, 918, 625, 0, 0, 140, 3, 387, 0, 307, 331, 97, 0, 0, 875,
+  0, 724, 0, 985, 0, 162, 647, 804, 847, 169, 0, 0, 0, 0, 0, 912,
+  0, 415, 838, 240, 998, 37, 584, 465, 0, 0, 0, 126, 967, 719, 0, 841,
+  304, 0, 0, 0, 0, 0, 0, 47, 0, 0, 0, 91, 928, 102, 854, 958,
+  516, 50, 555, 394, 0, 703, 914, 0, 0, 0, 129, 0, 0, 0, 0, 0,
+  850, 108, 571, 427, 339, 217, 551, 558, 315, 628, 0, 74, 0, 0, 0, 0,
+  432, 0, 0, 385, 403, 0, 0, 0, 496, 0, 0, 0, 60, 911, 0, 0,
+  0, 0, 0, 0, 0, 0, 20, 0, 367, 788, 790, 137, 243, 458, 834, 0,
+  23, 0, 0, 397, 0, 0, 0, 791, 0, 0, 0, 0, 0, 252, 0, 408,
+  868, 18, 752, 601, 738, 968, 323, 676, 756, 962, 0, 0, 0, 0, 0, 0,
+  279, 0, 0, 0, 68, 0, 0, 0, 0, 0, 0, 222, 106, 649, 0, 0,
+  210, 466, 709, 0, 693, 0, 299, 0, 0, 0, 166, 848, 662, 381, 754, 927,
+  965, 233, 291, 600, 629, 238, 695, 777, 940, 364, 0, 135, 426, 0, 13, 152,
+  0, 0, 0, 329, 539, 611, 624, 716, 259, 196, 244, 273, 330, 718, 776, 359,
+  836, 0, 81, 154, 0, 837, 0, 0, 0, 0, 699, 0, 88, 891, 587, 0,
+  0, 0, 0, 769, 0, 0, 370, 502, 802, 0, 504, 376, 924, 42, 185, 694,
+  650, 801, 476, 489, 0, 0, 0, 0, 720, 0, 11, 0, 0, 228, 795, 0,
+  0, 0, 371, 0, 0, 0, 0, 352, 1, 825, 0, 0, 0, 630, 0, 0,
+  0, 713, 142, 0, 0, 71, 0, 0, 0, 0, 0, 0, 28, 242, 0, 943,
+  274, 0, 0, 0, 44, 508, 517, 0, 0, 165, 0, 0, 610, 684, 0, 0,
+  829, 0, 0, 0, 0, 0, 0, 177, 0, 0, 954, 0, 220, 0, 826, 349,
+  734, 0, 817, 0, 0, 0, 0, 0, 327, 246, 737, 917, 810, 683, 0, 646,
+  764, 783, 880, 946, 0, 583, 0, 0, 48, 658, 0, 0, 881, 0, 215, 69,
+  692, 867, 980, 923, 0, 0, 0, 0, 237, 781, 0, 318, 0, 0, 30, 0,
+  328, 0, 0, 167, 0, 0, 915, 0, 338, 151, 515, 0, 0, 384, 689, 550,
+  597, 741, 373, 0, 995, 0, 440, 0, 618, 0, 604, 0, 0, 115, 438, 0,
+  0, 0, 0, 0, 0, 0, 99, 207, 375, 429, 282, 98, 417, 0, 0, 0,
+  0, 123, 0, 0, 0, 0, 272, 0, 0, 365, 139, 230, 306, 341, 0, 144,
+  812, 0, 0, 0, 559, 4, 0, 0, 10, 0, 0, 0, 337, 0, 0, 0,
+  0, 900, 0, 0, 0, 991, 0, 0, 589, 86, 0, 648, 0, 503, 0, 159,
+  0, 0, 0, 0, 0, 269, 0, 0, 617, 445, 637, 492, 725, 560, 833, 598,
+  446, 549, 948, 753, 0, 0, 136, 0, 0, 213, 0, 0, 0, 0, 0, 731,
+  0, 354, 772, 0, 184, 113, 231, 374, 507, 0, 0, 0, 973, 0, 305, 268,
+  669, 0, 0, 0, 613, 0, 0, 100, 412, 0, 0, 109, 893, 392, 0, 0,
+  0, 0, 0, 0, 509, 0, 308, 0, 0, 0, 14, 133, 420, 0, 907, 451,
+  0, 975, 141, 192, 454, 677, 733, 321, 960, 188, 0, 0, 0, 916, 957, 579,
+  358, 0, 248, 0, 0, 0, 0, 0, 214, 388, 488, 443, 0, 0, 0, 0,
+  0, 568, 0, 0, 0, 0, 0, 0, 0, 402, 0, 704, 0, 0, 0, 277,
+  435, 391, 0, 0, 757, 882, 0, 0, 0, 0, 981, 897, 603, 537, 748, 905,
+  972, 0, 325, 0, 8, 930, 759, 0, 251, 84, 410, 146, 431, 773, 0, 0,
+  0, 0, 0, 0, 0, 666, 789, 922, 0, 0, 0, 0, 0, 0, 0, 730,
+  0, 21, 255, 974, 163, 0, 0, 0, 0, 0, 0, 653, 732, 830, 959, 0,
+  326, 0, 293, 216, 234, 119, 351, 0, 659, 261, 0, 722, 0, 0, 0, 363,
+  0, 0, 0, 758, 294, 0, 860, 0, 0, 687, 0, 0, 0, 0, 0, 553,
+  766, 416, 883, 0, 942, 0, 0, 0, 525, 0, 0, 204, 0, 0, 993, 0,
+  661, 0, 0, 0, 0, 0, 0, 0, 0, 209, 0, 0, 201, 0, 0, 0,
+  0, 271, 0, 0, 0, 0, 0, 0, 195, 813, 715, 844, 651, 0, 5, 966,
+  0, 528, 746, 853, 0, 110, 0, 0, 0, 75, 0, 538, 0, 593, 0, 910,
+  0, 0, 631, 0, 856, 0, 0, 0, 249, 298, 0, 66, 851, 0, 0, 0,
+  0, 0, 407, 736, 839, 0, 871, 0, 303, 800, 127, 828, 887, 0, 0, 0,
+  0, 0, 0, 319, 612, 0, 706, 0, 0, 0, 311, 705, 372, 763, 0, 0,
+  619, 0, 0, 0, 0, 0, 401, 0, 258, 187, 0, 0, 727, 0, 512, 614,
+  130, 585, 532, 145, 664, 0, 0, 0, 0, 878, 457, 0, 0, 0, 0, 0,
+  0, 0, 174, 0, 0, 114, 0, 0, 0, 0, 0, 0, 0, 0, 0, 362,
+  0, 0, 310, 0, 655, 197, 16, 122, 423, 205, 865, 0, 0, 0, 442, 697,
+  453, 895, 0, 0, 605, 0, 366, 186, 314, 90, 807, 7, 818, 22, 913, 0,
+  857, 0, 468, 798, 0, 608, 0, 0, 35, 292, 632, 333, 348, 654, 0, 0,
+  0, 0, 0, 0, 0, 0, 678, 762, 0, 582, 0, 436, 6, 170, 936, 55,
+  191, 284, 686, 835, 409, 0, 395, 921, 236, 843, 903, 0, 941, 0, 642, 411,
+  660, 987, 265, 557, 760, 643, 735, 0, 0, 548, 0, 0, 527, 751, 0, 467,
+  698, 0, 0, 0, 0, 53, 472, 0, 0, 0, 39, 76, 645, 797, 938, 0,
+  0, 0, 300, 0, 0, 0, 0, 0, 564, 0, 79, 112, 164, 633, 0, 369,
+  0, 0, 0, 0, 0, 627, 832, 179, 399, 566, 574, 0, 421, 554, 500, 545,
+  711, 846, 463, 0, 0, 0, 0, 494, 546, 721, 0, 172, 0, 522, 0, 0,
+  0, 0, 0, 0, 0, 663, 0, 0, 193, 0, 0, 0, 0, 0, 0, 253,
+  744, 0, 0, 72, 441, 675, 0, 0, 0, 931, 0, 982, 289, 983, 606, 0,
+  0, 0, 0, 0, 808, 0, 0, 0, 0, 0, 0, 224, 0, 805, 183, 0,
+  696, 125, 0, 0, 0, 422, 0, 742, 778, 175, 823, 0, 0, 0, 0, 0,
+  43, 520, 0, 567, 0, 447, 0, 0, 510, 855, 886, 434, 0, 0, 0, 302,
+  0, 0, 0, 78, 161, 0, 0, 317, 815, 863, 0, 0, 0, 0, 194, 473,
+  0, 0, 475, 0, 173, 901, 0, 0, 357, 85, 498, 782, 869, 0, 0, 281,
+  0, 301, 0, 312, 0, 0, 132, 82, 0, 0, 0, 0, 0, 448, 0, 264,
+  38, 287, 0, 0, 0, 971, 0, 0, 0, 873, 280, 511, 0, 0, 0, 0,
+  0, 83, 934, 0, 0, 0, 820, 0, 0, 529, 0, 0, 0, 0, 0, 816,
+  723, 176, 0, 0, 989, 0, 0, 350, 0, 0, 0, 212, 495, 596, 578, 0,
+  0, 0, 355, 45, 644, 0, 879, 0, 0, 534, 0, 0, 0, 852, 336, 679,
+  0, 0, 361, 890, 0, 0, 0, 0, 0, 0, 0, 239, 641, 745, 0, 0,
+  131, 0, 0, 190, 726, 0, 455, 0, 0, 0, 0, 0, 0, 95, 0, 262,
+  27, 573, 0, 477, 0, 0, 0, 0, 803, 0, 0, 0, 0, 0, 0, 541,
+  0, 0, 0, 0, 0, 0, 51, 379, 0, 0, 257, 0, 988, 0, 0, 0,
+  65, 806, 0, 483, 792, 0, 0, 0, 56, 0, 0, 858, 0, 0, 0, 0,
+  0, 0, 396, 347, 0, 0, 0, 0, 0, 0, 0, 626, 0, 0, 0, 160,
+  0, 0, 0, 0, 198, 0, 0, 561, 0, 0, 0, 221, 0, 0, 295, 344,
+  902, 0, 0, 0, 0, 247, 386, 0, 0, 0, 0, 267, 17, 208, 0, 0,
+  739, 0, 787, 0, 0, 0, 92, 563, 761, 925, 862, 206, 0, 377, 615, 148,
+  821, 118, 380, 767, 0, 849, 0, 0, 450, 26, 0, 0, 0, 0, 0, 999,
+  15, 0, 0, 0, 956, 256, 0, 290, 0, 0, 124, 486, 535, 576, 0, 93,
+  241, 419, 524, 894, 531, 270, 505, 0, 0, 0, 530, 360, 919, 0, 636, 0,
+  0, 950, 0, 0, 774, 714, 831, 0, 478, 591, 0, 0, 94, 501, 0, 552,
+  586, 0, 0, 590, 602, 0, 0, 464, 0, 0, 526, 430, 0, 701, 120, 622,
+  413, 992, 383, 404, 570, 0, 0, 0, 0, 0, 0, 180, 143, 0, 0, 105,
+  898, 685, 0, 46, 0, 0, 0, 0, 609, 623, 0, 521, 0, 0, 0, 0,
+  581, 0, 382, 0, 149, 203, 378, 456, 536, 0, 134, 250, 0, 484, 0, 691,
+  652, 0, 424, 540, 657, 565, 0, 0, 0, 0, 0, 0, 0, 0, 0, 425,
+  0, 786, 77, 147, 276, 824, 595, 12, 0, 0, 80, 96, 121, 671, 755, 0,
+  0, 0, 41, 481, 285, 0, 811, 519, 471, 493, 0, 235, 874, 0, 0, 0,
+  0, 0, 729, 0, 710, 345, 309, 572, 978, 979, 225, 40, 34, 667, 0, 0,
+  665, 0, 0, 0, 0, 768, 0, 58, 674, 749, 138, 506, 544, 0, 0, 0,
+  0, 0, 0, 953, 0, 356, 0, 0, 189, 0, 0, 263, 128, 899, 0, 0,
+  0, 784, 0, 785, 227, 433, 0, 0, 0, 0, 708, 89, 393, 740, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 822, 0, 0, 0, 0, 67, 0, 266,
+  155, 0, 0, 0, 0, 0, 861, 0, 638, 223, 0, 0, 0, 0, 459, 2,
+  470, 499, 462, 9, 575, 621, 939, 599, 0, 0, 70, 814, 340, 497, 620, 0,
+  0, 0, 944, 0, 368, 876, 389, 712, 335, 952, 0, 0, 556, 680, 0, 0,
+};
+
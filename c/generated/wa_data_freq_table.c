@@ -0,0 +1,1995 @@
+#include "worldalphabets_data.h"
+
+extern const char *WA_FREQ_0_TOKENS[];
+extern const uint16_t WA_FREQ_0_RANKS[];
+extern const char *WA_FREQ_1_TOKENS[];
+extern const uint16_t WA_FREQ_1_RANKS[];
+extern const char *WA_FREQ_2_TOKENS[];
+extern const uint16_t WA_FREQ_2_RANKS[];
+extern const char *WA_FREQ_3_TOKENS[];
+extern const uint16_t WA_FREQ_3_RANKS[];
+extern const char *WA_FREQ_4_TOKENS[];
+extern const uint16_t WA_FREQ_4_RANKS[];
+extern const char *WA_FREQ_5_TOKENS[];
+extern const uint16_t WA_FREQ_5_RANKS[];
+extern const char *WA_FREQ_6_TOKENS[];
+extern const uint16_t WA_FREQ_6_RANKS[];
+extern const char *WA_FREQ_7_TOKENS[];
+extern const uint16_t WA_FREQ_7_RANKS[];
+extern const char *WA_FREQ_8_TOKENS[];
+extern const uint16_t WA_FREQ_8_RANKS[];
+extern const char *WA_FREQ_9_TOKENS[];
+extern const uint16_t WA_FREQ_9_RANKS[];
+extern const char *WA_FREQ_10_TOKENS[];
+extern const uint16_t WA_FREQ_10_RANKS[];
+extern const char *WA_FREQ_11_TOKENS[];
+extern const uint16_t WA_FREQ_11_RANKS[];
+extern const char *WA_FREQ_12_TOKENS[];
+extern const uint16_t WA_FREQ_12_RANKS[];
+extern const char *WA_FREQ_13_TOKENS[];
+extern const uint16_t WA_FREQ_13_RANKS[];
+extern const char *WA_FREQ_14_TOKENS[];
+extern const uint16_t WA_FREQ_14_RANKS[];
+extern const char *WA_FREQ_15_TOKENS[];
+extern const uint16_t WA_FREQ_15_RANKS[];
+extern const char *WA_FREQ_16_TOKENS[];
+extern const uint16_t WA_FREQ_16_RANKS[];
+extern const char *WA_FREQ_17_TOKENS[];
+extern const uint16_t WA_FREQ_17_RANKS[];
+extern const char *WA_FREQ_18_TOKENS[];
+extern const uint16_t WA_FREQ_18_RANKS[];
+extern const char *WA_FREQ_19_TOKENS[];
+extern const uint16_t WA_FREQ_19_RANKS[];
+extern const char *WA_FREQ_20_TOKENS[];
+extern const uint16_t WA_FREQ_20_RANKS[];
+extern const char *WA_FREQ_21_TOKENS[];
+extern const uint16_t WA_FREQ_21_RANKS[];
+extern const char *WA_FREQ_22_TOKENS[];
+extern const uint16_t WA_FREQ_22_RANKS[];
+extern const char *WA_FREQ_23_TOKENS[];
+extern const uint16_t WA_FREQ_23_RANKS[];
+extern const char *WA_FREQ_24_TOKENS[];
+extern const uint16_t WA_FREQ_24_RANKS[];
+extern const char *WA_FREQ_25_TOKENS[];
+extern const uint16_t WA_FREQ_25_RANKS[];
+extern const char *WA_FREQ_26_TOKENS[];
+extern const uint16_t WA_FREQ_26_RANKS[];
+extern const char *WA_FREQ_27_TOKENS[];
+extern const uint16_t WA_FREQ_27_RANKS[];
+extern const char *WA_FREQ_28_TOKENS[];
+extern const uint16_t WA_FREQ_28_RANKS[];
+extern const char *WA_FREQ_29_TOKENS[];
+extern const uint16_t WA_FREQ_29_RANKS[];
+extern const char *WA_FREQ_30_TOKENS[];
+extern const uint16_t WA_FREQ_30_RANKS[];
+extern const char *WA_FREQ_31_TOKENS[];
+extern const uint16_t WA_FREQ_31_RANKS[];
+extern const char *WA_FREQ_32_TOKENS[];
+extern const uint16_t WA_FREQ_32_RANKS[];
+extern const char *WA_FREQ_33_TOKENS[];
+extern const uint16_t WA_FREQ_33_RANKS[];
+extern const char *WA_FREQ_34_TOKENS[];
+extern const uint16_t WA_FREQ_34_RANKS[];
+extern const char *WA_FREQ_35_TOKENS[];
+extern const uint16_t WA_FREQ_35_RANKS[];
+extern const char *WA_FREQ_36_TOKENS[];
+extern const uint16_t WA_FREQ_36_RANKS[];
+extern const char *WA_FREQ_37_TOKENS[];
+extern const uint16_t WA_FREQ_37_RANKS[];
+extern const char *WA_FREQ_38_TOKENS[];
+extern const uint16_t WA_FREQ_38_RANKS[];
+extern const char *WA_FREQ_39_TOKENS[];
+extern const uint16_t WA_FREQ_39_RANKS[];
+extern const char *WA_FREQ_40_TOKENS[];
+extern const uint16_t WA_FREQ_40_RANKS[];
+extern const char *WA_FREQ_41_TOKENS[];
+extern const uint16_t WA_FREQ_41_RANKS[];
+extern const char *WA_FREQ_42_TOKENS[];
+extern const uint16_t WA_FREQ_42_RANKS[];
+extern const char *WA_FREQ_43_TOKENS[];
+extern const uint16_t WA_FREQ_43_RANKS[];
+extern const char *WA_FREQ_44_TOKENS[];
+extern const uint16_t WA_FREQ_44_RANKS[];
+extern const char *WA_FREQ_45_TOKENS[];
+extern const uint16_t WA_FREQ_45_RANKS[];
+extern const char *WA_FREQ_46_TOKENS[];
+extern const uint16_t WA_FREQ_46_RANKS[];
+extern const char *WA_FREQ_47_TOKENS[];
+extern const uint16_t WA_FREQ_47_RANKS[];
+extern const char *WA_FREQ_48_TOKENS[];
+extern const uint16_t WA_FREQ_48_RANKS[];
+extern const char *WA_FREQ_49_TOKENS[];
+extern const uint16_t WA_FREQ_49_RANKS[];
+extern const char *WA_FREQ_50_TOKENS[];
+extern const uint16_t WA_FREQ_50_RANKS[];
+extern const char *WA_FREQ_51_TOKENS[];
+extern const uint16_t WA_FREQ_51_RANKS[];
+extern const char *WA_FREQ_52_TOKENS[];
+extern const uint16_t WA_FREQ_52_RANKS[];
+extern const char *WA_FREQ_53_TOKENS[];
+extern const uint16_t WA_FREQ_53_RANKS[];
+extern const char *WA_FREQ_54_TOKENS[];
+extern const uint16_t WA_FREQ_54_RANKS[];
+extern const char *WA_FREQ_55_TOKENS[];
+extern const uint16_t WA_FREQ_55_RANKS[];
+extern const char *WA_FREQ_56_TOKENS[];
+extern const uint16_t WA_FREQ_56_RANKS[];
+extern const char *WA_FREQ_57_TOKENS[];
+extern const uint16_t WA_FREQ_57_RANKS[];
+extern const char *WA_FREQ_58_TOKENS[];
+extern const uint16_t WA_FREQ_58_RANKS[];
+extern const char *WA_FREQ_59_TOKENS[];
+extern const uint16_t WA_FREQ_59_RANKS[];
+extern const char *WA_FREQ_60_TOKENS[];
+extern const uint16_t WA_FREQ_60_RANKS[];
+extern const char *WA_FREQ_61_TOKENS[];
+extern const uint16_t WA_FREQ_61_RANKS[];
+extern const char *WA_FREQ_62_TOKENS[];
+extern const uint16_t WA_FREQ_62_RANKS[];
+extern const char *WA_FREQ_63_TOKENS[];
+extern const uint16_t WA_FREQ_63_RANKS[];
+extern const char *WA_FREQ_64_TOKENS[];
+extern const uint16_t WA_FREQ_64_RANKS[];
+extern const char *WA_FREQ_65_TOKENS[];
+extern const uint16_t WA_FREQ_65_RANKS[];
+extern const char *WA_FREQ_66_TOKENS[];
+extern const uint16_t WA_FREQ_66_RANKS[];
+extern const char *WA_FREQ_67_TOKENS[];
+extern const uint16_t WA_FREQ_67_RANKS[];
+extern const char *WA_FREQ_68_TOKENS[];
+extern const uint16_t WA_FREQ_68_RANKS[];
+extern const char *WA_FREQ_69_TOKENS[];
+extern const uint16_t WA_FREQ_69_RANKS[];
+extern const char *WA_FREQ_70_TOKENS[];
+extern const uint16_t WA_FREQ_70_RANKS[];
+extern const char *WA_FREQ_71_TOKENS[];
+extern const uint16_t WA_FREQ_71_RANKS[];
+extern const char *WA_FREQ_72_TOKENS[];
+extern const uint16_t WA_FREQ_72_RANKS[];
+extern const char *WA_FREQ_73_TOKENS[];
+extern const uint16_t WA_FREQ_73_RANKS[];
+extern const char *WA_FREQ_74_TOKENS[];
+extern const uint16_t WA_FREQ_74_RANKS[];
+extern const char *WA_FREQ_75_TOKENS[];
+extern const uint16_t WA_FREQ_75_RANKS[];
+extern const char *WA_FREQ_76_TOKENS[];
+extern const uint16_t WA_FREQ_76_RANKS[];
+extern const char *WA_FREQ_77_TOKENS[];
+extern const uint16_t WA_FREQ_77_RANKS[];
+extern const char *WA_FREQ_78_TOKENS[];
+extern const uint16_t WA_FREQ_78_RANKS[];
+extern const char *WA_FREQ_79_TOKENS[];
+extern const uint16_t WA_FREQ_79_RANKS[];
+extern const char *WA_FREQ_80_TOKENS[];
+extern const uint16_t WA_FREQ_80_RANKS[];
+extern const char *WA_FREQ_81_TOKENS[];
+extern const uint16_t WA_FREQ_81_RANKS[];
+extern const char *WA_FREQ_82_TOKENS[];
+extern const uint16_t WA_FREQ_82_RANKS[];
+extern const char *WA_FREQ_83_TOKENS[];
+extern const uint16_t WA_FREQ_83_RANKS[];
+extern const char *WA_FREQ_84_TOKENS[];
+extern const uint16_t WA_FREQ_84_RANKS[];
+extern const char *WA_FREQ_85_TOKENS[];
+extern const uint16_t WA_FREQ_85_RANKS[];
+extern const char *WA_FREQ_86_TOKENS[];
+extern const uint16_t WA_FREQ_86_RANKS[];
+extern const char *WA_FREQ_87_TOKENS[];
+extern const uint16_t WA_FREQ_87_RANKS[];
+extern const char *WA_FREQ_88_TOKENS[];
+extern const uint16_t WA_FREQ_88_RANKS[];
+extern const char *WA_FREQ_89_TOKENS[];
+extern const uint16_t WA_FREQ_89_RANKS[];
+extern const char *WA_FREQ_90_TOKENS[];
+extern const uint16_t WA_FREQ_90_RANKS[];
+extern const char *WA_FREQ_91_TOKENS[];
+extern const uint16_t WA_FREQ_91_RANKS[];
+extern const char *WA_FREQ_92_TOKENS[];
+extern const uint16_t WA_FREQ_92_RANKS[];
+extern const char *WA_FREQ_93_TOKENS[];
+extern const uint16_t WA_FREQ_93_RANKS[];
+extern const char *WA_FREQ_94_TOKENS[];
+extern const uint16_t WA_FREQ_94_RANKS[];
+extern const char *WA_FREQ_95_TOKENS[];
+extern const uint16_t WA_FREQ_95_RANKS[];
+extern const char *WA_FREQ_96_TOKENS[];
+extern const uint16_t WA_FREQ_96_RANKS[];
+extern const char *WA_FREQ_97_TOKENS[];
+extern const uint16_t WA_FREQ_97_RANKS[];
+extern const char *WA_FREQ_98_TOKENS[];
+extern const uint16_t WA_FREQ_98_RANKS[];
+extern const char *WA_FREQ_99_TOKENS[];
+extern const uint16_t WA_FREQ_99_RANKS[];
+extern const char *WA_FREQ_100_TOKENS[];
+extern const uint16_t WA_FREQ_100_RANKS[];
+extern const char *WA_FREQ_101_TOKENS[];
+extern const uint16_t WA_FREQ_101_RANKS[];
+extern const char *WA_FREQ_102_TOKENS[];
+extern const uint16_t WA_FREQ_102_RANKS[];
+extern const char *WA_FREQ_103_TOKENS[];
+extern const uint16_t WA_FREQ_103_RANKS[];
+extern const char *WA_FREQ_104_TOKENS[];
+extern const uint16_t WA_FREQ_104_RANKS[];
+extern const char *WA_FREQ_105_TOKENS[];
+extern const uint16_t WA_FREQ_105_RANKS[];
+extern const char *WA_FREQ_106_TOKENS[];
+extern const uint16_t WA_FREQ_106_RANKS[];
+extern const char *WA_FREQ_107_TOKENS[];
+extern const uint16_t WA_FREQ_107_RANKS[];
+extern const char *WA_FREQ_108_TOKENS[];
+extern const uint16_t WA_FREQ_108_RANKS[];
+extern const char *WA_FREQ_109_TOKENS[];
+extern const uint16_t WA_FREQ_109_RANKS[];
+extern const char *WA_FREQ_110_TOKENS[];
+extern const uint16_t WA_FREQ_110_RANKS[];
+extern const char *WA_FREQ_111_TOKENS[];
+extern const uint16_t WA_FREQ_111_RANKS[];
+extern const char *WA_FREQ_112_TOKENS[];
+extern const uint16_t WA_FREQ_112_RANKS[];
+extern const char *WA_FREQ_113_TOKENS[];
+extern const uint16_t WA_FREQ_113_RANKS[];
+extern const char *WA_FREQ_114_TOKENS[];
+extern const uint16_t WA_FREQ_114_RANKS[];
+extern const char *WA_FREQ_115_TOKENS[];
+extern const uint16_t WA_FREQ_115_RANKS[];
+extern const char *WA_FREQ_116_TOKENS[];
+extern const uint16_t WA_FREQ_116_RANKS[];
+extern const char *WA_FREQ_117_TOKENS[];
+extern const uint16_t WA_FREQ_117_RANKS[];
+extern const char *WA_FREQ_118_TOKENS[];
+extern const uint16_t WA_FREQ_118_RANKS[];
+extern const char *WA_FREQ_119_TOKENS[];
+extern const uint16_t WA_FREQ_119_RANKS[];
+extern const char *WA_FREQ_120_TOKENS[];
+extern const uint16_t WA_FREQ_120_RANKS[];
+extern const char *WA_FREQ_121_TOKENS[];
+extern const uint16_t WA_FREQ_121_RANKS[];
+extern const char *WA_FREQ_122_TOKENS[];
+extern const uint16_t WA_FREQ_122_RANKS[];
+extern const char *WA_FREQ_123_TOKENS[];
+extern const uint16_t WA_FREQ_123_RANKS[];
+extern const char *WA_FREQ_124_TOKENS[];
+extern const uint16_t WA_FREQ_124_RANKS[];
+extern const char *WA_FREQ_125_TOKENS[];
+extern const uint16_t WA_FREQ_125_RANKS[];
+extern const char *WA_FREQ_126_TOKENS[];
+extern const uint16_t WA_FREQ_126_RANKS[];
+extern const char *WA_FREQ_127_TOKENS[];
+extern const uint16_t WA_FREQ_127_RANKS[];
+extern const char *WA_FREQ_128_TOKENS[];
+extern const uint16_t WA_FREQ_128_RANKS[];
+extern const char *WA_FREQ_129_TOKENS[];
+extern const uint16_t WA_FREQ_129_RANKS[];
+extern const char *WA_FREQ_130_TOKENS[];
+extern const uint16_t WA_FREQ_130_RANKS[];
+extern const char *WA_FREQ_131_TOKENS[];
+extern const uint16_t WA_FREQ_131_RANKS[];
+extern const char *WA_FREQ_132_TOKENS[];
+extern const uint16_t WA_FREQ_132_RANKS[];
+extern const char *WA_FREQ_133_TOKENS[];
+extern const uint16_t WA_FREQ_133_RANKS[];
+extern const char *WA_FREQ_134_TOKENS[];
+extern const uint16_t WA_FREQ_134_RANKS[];
+extern const char *WA_FREQ_135_TOKENS[];
+extern const uint16_t WA_FREQ_135_RANKS[];
+extern const char *WA_FREQ_136_TOKENS[];
+extern const uint16_t WA_FREQ_136_RANKS[];
+extern const char *WA_FREQ_137_TOKENS[];
+extern const uint16_t WA_FREQ_137_RANKS[];
+extern const char *WA_FREQ_138_TOKENS[];
+extern const uint16_t WA_FREQ_138_RANKS[];
+extern const char *WA_FREQ_139_TOKENS[];
+extern const uint16_t WA_FREQ_139_RANKS[];
+extern const char *WA_FREQ_140_TOKENS[];
+extern const uint16_t WA_FREQ_140_RANKS[];
+extern const char *WA_FREQ_141_TOKENS[];
+extern const uint16_t WA_FREQ_141_RANKS[];
+extern const char *WA_FREQ_142_TOKENS[];
+extern const uint16_t WA_FREQ_142_RANKS[];
+extern const char *WA_FREQ_143_TOKENS[];
+extern const uint16_t WA_FREQ_143_RANKS[];
+extern const char *WA_FREQ_144_TOKENS[];
+extern const uint16_t WA_FREQ_144_RANKS[];
+extern const char *WA_FREQ_145_TOKENS[];
+extern const uint16_t WA_FREQ_145_RANKS[];
+extern const char *WA_FREQ_146_TOKENS[];
+extern const uint16_t WA_FREQ_146_RANKS[];
+extern const char *WA_FREQ_147_TOKENS[];
+extern const uint16_t WA_FREQ_147_RANKS[];
+extern const char *WA_FREQ_148_TOKENS[];
+extern const uint16_t WA_FREQ_148_RANKS[];
+extern const char *WA_FREQ_149_TOKENS[];
+extern const uint16_t WA_FREQ_149_RANKS[];
+extern const char *WA_FREQ_150_TOKENS[];
+extern const uint16_t WA_FREQ_150_RANKS[];
+extern const char *WA_FREQ_151_TOKENS[];
+extern const uint16_t WA_FREQ_151_RANKS[];
+extern const char *WA_FREQ_152_TOKENS[];
+extern const uint16_t WA_FREQ_152_RANKS[];
+extern const char *WA_FREQ_153_TOKENS[];
+extern const uint16_t WA_FREQ_153_RANKS[];
+extern const char *WA_FREQ_154_TOKENS[];
+extern const uint16_t WA_FREQ_154_RANKS[];
+extern const char *WA_FREQ_155_TOKENS[];
+extern const uint16_t WA_FREQ_155_RANKS[];
+extern const char *WA_FREQ_156_TOKENS[];
+extern const uint16_t WA_FREQ_156_RANKS[];
+extern const char *WA_FREQ_157_TOKENS[];
+extern const uint16_t WA_FREQ_157_RANKS[];
+extern const char *WA_FREQ_158_TOKENS[];
+extern const uint16_t WA_FREQ_158_RANKS[];
+extern const char *WA_FREQ_159_TOKENS[];
+extern const uint16_t WA_FREQ_159_RANKS[];
+extern const char *WA_FREQ_160_TOKENS[];
+extern const uint16_t WA_FREQ_160_RANKS[];
+extern const char *WA_FREQ_161_TOKENS[];
+extern const uint16_t WA_FREQ_161_RANKS[];
+extern const char *WA_FREQ_162_TOKENS[];
+extern const uint16_t WA_FREQ_162_RANKS[];
+extern const char *WA_FREQ_163_TOKENS[];
+extern const uint16_t WA_FREQ_163_RANKS[];
+extern const char *WA_FREQ_164_TOKENS[];
+extern const uint16_t WA_FREQ_164_RANKS[];
+extern const char *WA_FREQ_165_TOKENS[];
+extern const uint16_t WA_FREQ_165_RANKS[];
+extern const char *WA_FREQ_166_TOKENS[];
+extern const uint16_t WA_FREQ_166_RANKS[];
+extern const char *WA_FREQ_167_TOKENS[];
+extern const uint16_t WA_FREQ_167_RANKS[];
+extern const char *WA_FREQ_168_TOKENS[];
+extern const uint16_t WA_FREQ_168_RANKS[];
+extern const char *WA_FREQ_169_TOKENS[];
+extern const uint16_t WA_FREQ_169_RANKS[];
+extern const char *WA_FREQ_170_TOKENS[];
+extern const uint16_t WA_FREQ_170_RANKS[];
+extern const char *WA_FREQ_171_TOKENS[];
+extern const uint16_t WA_FREQ_171_RANKS[];
+extern const char *WA_FREQ_172_TOKENS[];
+extern const uint16_t WA_FREQ_172_RANKS[];
+extern const char *WA_FREQ_173_TOKENS[];
+extern const uint16_t WA_FREQ_173_RANKS[];
+extern const char *WA_FREQ_174_TOKENS[];
+extern const uint16_t WA_FREQ_174_RANKS[];
+extern const char *WA_FREQ_175_TOKENS[];
+extern const uint16_t WA_FREQ_175_RANKS[];
+extern const char *WA_FREQ_176_TOKENS[];
+extern const uint16_t WA_FREQ_176_RANKS[];
+extern const char *WA_FREQ_177_TOKENS[];
+extern const uint16_t WA_FREQ_177_RANKS[];
+extern const char *WA_FREQ_178_TOKENS[];
+extern const uint16_t WA_FREQ_178_RANKS[];
+extern const char *WA_FREQ_179_TOKENS[];
+extern const uint16_t WA_FREQ_179_RANKS[];
+extern const char *WA_FREQ_180_TOKENS[];
+extern const uint16_t WA_FREQ_180_RANKS[];
+extern const char *WA_FREQ_181_TOKENS[];
+extern const uint16_t WA_FREQ_181_RANKS[];
+extern const char *WA_FREQ_182_TOKENS[];
+extern const uint16_t WA_FREQ_182_RANKS[];
+extern const char *WA_FREQ_183_TOKENS[];
+extern const uint16_t WA_FREQ_183_RANKS[];
+extern const char *WA_FREQ_184_TOKENS[];
+extern const uint16_t WA_FREQ_184_RANKS[];
+extern const char *WA_FREQ_185_TOKENS[];
+extern const uint16_t WA_FREQ_185_RANKS[];
+extern const char *WA_FREQ_186_TOKENS[];
+extern const uint16_t WA_FREQ_186_RANKS[];
+extern const char *WA_FREQ_187_TOKENS[];
+extern const uint16_t WA_FREQ_187_RANKS[];
+extern const char *WA_FREQ_188_TOKENS[];
+extern const uint16_t WA_FREQ_188_RANKS[];
+extern const char *WA_FREQ_189_TOKENS[];
+extern const uint16_t WA_FREQ_189_RANKS[];
+extern const char *WA_FREQ_190_TOKENS[];
+extern const uint16_t WA_FREQ_190_RANKS[];
+extern const char *WA_FREQ_191_TOKENS[];
+extern const uint16_t WA_FREQ_191_RANKS[];
+extern const char *WA_FREQ_192_TOKENS[];
+extern const uint16_t WA_FREQ_192_RANKS[];
+
+const wa_frequency_list WA_FREQUENCY_LISTS[] = {
+  {
+    "ady",
+    "word",
+    WA_FREQ_0_TOKENS, 1000u,
+    &WA_ALPHABETS[2],
+    WA_FREQ_0_RANKS, 2047u,
+  },
+  {
+    "af",
+    "word",
+    WA_FREQ_1_TOKENS, 1000u,
+    &WA_ALPHABETS[3],
+    WA_FREQ_1_RANKS, 2047u,
+  },
+  {
+    "ak",
+    "word",
+    WA_FREQ_2_TOKENS, 1000u,
+    &WA_ALPHABETS[5],
+    WA_FREQ_2_RANKS, 2047u,
+  },
+  {
+    "am",
+    "word",
+    WA_FREQ_3_TOKENS, 1000u,
+    &WA_ALPHABETS[6],
+    WA_FREQ_3_RANKS, 2047u,
+  },
+  {
+    "ar",
+    "word",
+    WA_FREQ_4_TOKENS, 1000u,
+    &WA_ALPHABETS[8],
+    WA_FREQ_4_RANKS, 2047u,
+  },
+  {
+    "arn",
+    "word",
+    WA_FREQ_5_TOKENS, 45u,
+    &WA_ALPHABETS[9],
+    WA_FREQ_5_RANKS, 127u,
+  },
+  {
+    "as",
+    "word",
+    WA_FREQ_6_TOKENS, 1000u,
+    &WA_ALPHABETS[10],
+    WA_FREQ_6_RANKS, 2047u,
+  },
+  {
+    "ast",
+    "word",
+    WA_FREQ_7_TOKENS, 45u,
+    &WA_ALPHABETS[12],
+    WA_FREQ_7_RANKS, 127u,
+  },
+  {
+    "ay",
+    "word",
+    WA_FREQ_8_TOKENS, 1000u,
+    &WA_ALPHABETS[13],
+    WA_FREQ_8_RANKS, 2047u,
+  },
+  {
+    "ba",
+    "word",
+    WA_FREQ_9_TOKENS, 1000u,
+    &WA_ALPHABETS[16],
+    WA_FREQ_9_RANKS, 2047u,
+  },
+  {
+    "bal",
+    "word",
+    WA_FREQ_10_TOKENS, 51u,
+    &WA_ALPHABETS[17],
+    WA_FREQ_10_RANKS, 127u,
+  },
+  {
+    "ban",
+    "word",
+    WA_FREQ_11_TOKENS, 1000u,
+    &WA_ALPHABETS[19],
+    WA_FREQ_11_RANKS, 2047u,
+  },
+  {
+    "bg",
+    "word",
+    WA_FREQ_12_TOKENS, 1000u,
+    &WA_ALPHABETS[27],
+    WA_FREQ_12_RANKS, 2047u,
+  },
+  {
+    "bho",
+    "word",
+    WA_FREQ_13_TOKENS, 44u,
+    &WA_ALPHABETS[30],
+    WA_FREQ_13_RANKS, 127u,
+  },
+  {
+    "bm",
+    "word",
+    WA_FREQ_14_TOKENS, 1000u,
+    &WA_ALPHABETS[32],
+    WA_FREQ_14_RANKS, 2047u,
+  },
+  {
+    "bn",
+    "word",
+    WA_FREQ_15_TOKENS, 1000u,
+    &WA_ALPHABETS[34],
+    WA_FREQ_15_RANKS, 2047u,
+  },
+  {
+    "bo",
+    "word",
+    WA_FREQ_16_TOKENS, 1000u,
+    &WA_ALPHABETS[35],
+    WA_FREQ_16_RANKS, 2047u,
+  },
+  {
+    "br",
+    "word",
+    WA_FREQ_17_TOKENS, 1000u,
+    &WA_ALPHABETS[36],
+    WA_FREQ_17_RANKS, 2047u,
+  },
+  {
+    "brx",
+    "word",
+    WA_FREQ_18_TOKENS, 26u,
+    &WA_ALPHABETS[37],
+    WA_FREQ_18_RANKS, 63u,
+  },
+  {
+    "bs",
+    "word",
+    WA_FREQ_19_TOKENS, 1000u,
+    &WA_ALPHABETS[38],
+    WA_FREQ_19_RANKS, 2047u,
+  },
+  {
+    "bug",
+    "word",
+    WA_FREQ_20_TOKENS, 1000u,
+    &WA_ALPHABETS[40],
+    WA_FREQ_20_RANKS, 2047u,
+  },
+  {
+    "ca",
+    "word",
+    WA_FREQ_21_TOKENS, 1000u,
+    &WA_ALPHABETS[43],
+    WA_FREQ_21_RANKS, 2047u,
+  },
+  {
+    "ce",
+    "word",
+    WA_FREQ_22_TOKENS, 1000u,
+    &WA_ALPHABETS[46],
+    WA_FREQ_22_RANKS, 2047u,
+  },
+  {
+    "ceb",
+    "word",
+    WA_FREQ_23_TOKENS, 1000u,
+    &WA_ALPHABETS[47],
+    WA_FREQ_23_RANKS, 2047u,
+  },
+  {
+    "cho",
+    "word",
+    WA_FREQ_24_TOKENS, 32u,
+    &WA_ALPHABETS[49],
+    WA_FREQ_24_RANKS, 63u,
+  },
+  {
+    "chr",
+    "word",
+    WA_FREQ_25_TOKENS, 11u,
+    &WA_ALPHABETS[50],
+    WA_FREQ_25_RANKS, 31u,
+  },
+  {
+    "ckb",
+    "word",
+    WA_FREQ_26_TOKENS, 1000u,
+    &WA_ALPHABETS[52],
+    WA_FREQ_26_RANKS, 2047u,
+  },
+  {
+    "co",
+    "word",
+    WA_FREQ_27_TOKENS, 36u,
+    &WA_ALPHABETS[53],
+    WA_FREQ_27_RANKS, 127u,
+  },
+  {
+    "cs",
+    "word",
+    WA_FREQ_28_TOKENS, 1000u,
+    &WA_ALPHABETS[55],
+    WA_FREQ_28_RANKS, 2047u,
+  },
+  {
+    "cv",
+    "word",
+    WA_FREQ_29_TOKENS, 1000u,
+    &WA_ALPHABETS[58],
+    WA_FREQ_29_RANKS, 2047u,
+  },
+  {
+    "cy",
+    "word",
+    WA_FREQ_30_TOKENS, 50u,
+    &WA_ALPHABETS[59],
+    WA_FREQ_30_RANKS, 127u,
+  },
+  {
+    "da",
+    "word",
+    WA_FREQ_31_TOKENS, 1000u,
+    &WA_ALPHABETS[60],
+    WA_FREQ_31_RANKS, 2047u,
+  },
+  {
+    "de",
+    "word",
+    WA_FREQ_32_TOKENS, 1000u,
+    &WA_ALPHABETS[62],
+    WA_FREQ_32_RANKS, 2047u,
+  },
+  {
+    "dsb",
+    "word",
+    WA_FREQ_33_TOKENS, 29u,
+    &WA_ALPHABETS[64],
+    WA_FREQ_33_RANKS, 63u,
+  },
+  {
+    "ee",
+    "word",
+    WA_FREQ_34_TOKENS, 1000u,
+    &WA_ALPHABETS[70],
+    WA_FREQ_34_RANKS, 2047u,
+  },
+  {
+    "el",
+    "word",
+    WA_FREQ_35_TOKENS, 1000u,
+    &WA_ALPHABETS[71],
+    WA_FREQ_35_RANKS, 2047u,
+  },
+  {
+    "en",
+    "word",
+    WA_FREQ_36_TOKENS, 1000u,
+    &WA_ALPHABETS[72],
+    WA_FREQ_36_RANKS, 2047u,
+  },
+  {
+    "eo",
+    "word",
+    WA_FREQ_37_TOKENS, 1000u,
+    &WA_ALPHABETS[73],
+    WA_FREQ_37_RANKS, 2047u,
+  },
+  {
+    "es",
+    "word",
+    WA_FREQ_38_TOKENS, 1000u,
+    &WA_ALPHABETS[74],
+    WA_FREQ_38_RANKS, 2047u,
+  },
+  {
+    "et",
+    "word",
+    WA_FREQ_39_TOKENS, 1000u,
+    &WA_ALPHABETS[75],
+    WA_FREQ_39_RANKS, 2047u,
+  },
+  {
+    "eu",
+    "word",
+    WA_FREQ_40_TOKENS, 1000u,
+    &WA_ALPHABETS[76],
+    WA_FREQ_40_RANKS, 2047u,
+  },
+  {
+    "fa",
+    "word",
+    WA_FREQ_41_TOKENS, 1000u,
+    &WA_ALPHABETS[78],
+    WA_FREQ_41_RANKS, 2047u,
+  },
+  {
+    "ff",
+    "word",
+    WA_FREQ_42_TOKENS, 1000u,
+    &WA_ALPHABETS[79],
+    WA_FREQ_42_RANKS, 2047u,
+  },
+  {
+    "fi",
+    "word",
+    WA_FREQ_43_TOKENS, 1000u,
+    &WA_ALPHABETS[81],
+    WA_FREQ_43_RANKS, 2047u,
+  },
+  {
+    "fo",
+    "word",
+    WA_FREQ_44_TOKENS, 36u,
+    &WA_ALPHABETS[82],
+    WA_FREQ_44_RANKS, 127u,
+  },
+  {
+    "fr",
+    "word",
+    WA_FREQ_45_TOKENS, 1000u,
+    &WA_ALPHABETS[83],
+    WA_FREQ_45_RANKS, 2047u,
+  },
+  {
+    "frr",
+    "word",
+    WA_FREQ_46_TOKENS, 38u,
+    &WA_ALPHABETS[84],
+    WA_FREQ_46_RANKS, 127u,
+  },
+  {
+    "fur",
+    "word",
+    WA_FREQ_47_TOKENS, 27u,
+    &WA_ALPHABETS[85],
+    WA_FREQ_47_RANKS, 63u,
+  },
+  {
+    "ga",
+    "word",
+    WA_FREQ_48_TOKENS, 48u,
+    &WA_ALPHABETS[87],
+    WA_FREQ_48_RANKS, 127u,
+  },
+  {
+    "gaa",
+    "word",
+    WA_FREQ_49_TOKENS, 45u,
+    &WA_ALPHABETS[88],
+    WA_FREQ_49_RANKS, 127u,
+  },
+  {
+    "gd",
+    "word",
+    WA_FREQ_50_TOKENS, 51u,
+    &WA_ALPHABETS[89],
+    WA_FREQ_50_RANKS, 127u,
+  },
+  {
+    "gl",
+    "word",
+    WA_FREQ_51_TOKENS, 1000u,
+    &WA_ALPHABETS[91],
+    WA_FREQ_51_RANKS, 2047u,
+  },
+  {
+    "gn",
+    "word",
+    WA_FREQ_52_TOKENS, 1000u,
+    &WA_ALPHABETS[92],
+    WA_FREQ_52_RANKS, 2047u,
+  },
+  {
+    "gsw",
+    "word",
+    WA_FREQ_53_TOKENS, 31u,
+    &WA_ALPHABETS[93],
+    WA_FREQ_53_RANKS, 63u,
+  },
+  {
+    "gu",
+    "word",
+    WA_FREQ_54_TOKENS, 49u,
+    &WA_ALPHABETS[94],
+    WA_FREQ_54_RANKS, 127u,
+  },
+  {
+    "ha",
+    "word",
+    WA_FREQ_55_TOKENS, 1000u,
+    &WA_ALPHABETS[97],
+    WA_FREQ_55_RANKS, 2047u,
+  },
+  {
+    "haw",
+    "word",
+    WA_FREQ_56_TOKENS, 41u,
+    &WA_ALPHABETS[98],
+    WA_FREQ_56_RANKS, 127u,
+  },
+  {
+    "he",
+    "word",
+    WA_FREQ_57_TOKENS, 1000u,
+    &WA_ALPHABETS[99],
+    WA_FREQ_57_RANKS, 2047u,
+  },
+  {
+    "hi",
+    "word",
+    WA_FREQ_58_TOKENS, 1000u,
+    &WA_ALPHABETS[100],
+    WA_FREQ_58_RANKS, 2047u,
+  },
+  {
+    "hr",
+    "word",
+    WA_FREQ_59_TOKENS, 1000u,
+    &WA_ALPHABETS[102],
+    WA_FREQ_59_RANKS, 2047u,
+  },
+  {
+    "hsb",
+    "word",
+    WA_FREQ_60_TOKENS, 34u,
+    &WA_ALPHABETS[103],
+    WA_FREQ_60_RANKS, 127u,
+  },
+  {
+    "ht",
+    "word",
+    WA_FREQ_61_TOKENS, 1000u,
+    &WA_ALPHABETS[104],
+    WA_FREQ_61_RANKS, 2047u,
+  },
+  {
+    "hu",
+    "word",
+    WA_FREQ_62_TOKENS, 1000u,
+    &WA_ALPHABETS[105],
+    WA_FREQ_62_RANKS, 2047u,
+  },
+  {
+    "hy",
+    "word",
+    WA_FREQ_63_TOKENS, 1000u,
+    &WA_ALPHABETS[106],
+    WA_FREQ_63_RANKS, 2047u,
+  },
+  {
+    "ia",
+    "word",
+    WA_FREQ_64_TOKENS, 56u,
+    &WA_ALPHABETS[107],
+    WA_FREQ_64_RANKS, 127u,
+  },
+  {
+    "id",
+    "word",
+    WA_FREQ_65_TOKENS, 1000u,
+    &WA_ALPHABETS[108],
+    WA_FREQ_65_RANKS, 2047u,
+  },
+  {
+    "ie",
+    "word",
+    WA_FREQ_66_TOKENS, 41u,
+    &WA_ALPHABETS[109],
+    WA_FREQ_66_RANKS, 127u,
+  },
+  {
+    "ig",
+    "word",
+    WA_FREQ_67_TOKENS, 1000u,
+    &WA_ALPHABETS[110],
+    WA_FREQ_67_RANKS, 2047u,
+  },
+  {
+    "is",
+    "word",
+    WA_FREQ_68_TOKENS, 1000u,
+    &WA_ALPHABETS[113],
+    WA_FREQ_68_RANKS, 2047u,
+  },
+  {
+    "it",
+    "word",
+    WA_FREQ_69_TOKENS, 1000u,
+    &WA_ALPHABETS[114],
+    WA_FREQ_69_RANKS, 2047u,
+  },
+  {
+    "ja",
+    "bigram",
+    WA_FREQ_70_TOKENS, 1000u,
+    &WA_ALPHABETS[117],
+    WA_FREQ_70_RANKS, 2047u,
+  },
+  {
+    "jbo",
+    "word",
+    WA_FREQ_71_TOKENS, 53u,
+    &WA_ALPHABETS[120],
+    WA_FREQ_71_RANKS, 127u,
+  },
+  {
+    "jv",
+    "word",
+    WA_FREQ_72_TOKENS, 1000u,
+    &WA_ALPHABETS[122],
+    WA_FREQ_72_RANKS, 2047u,
+  },
+  {
+    "ka",
+    "word",
+    WA_FREQ_73_TOKENS, 1000u,
+    &WA_ALPHABETS[123],
+    WA_FREQ_73_RANKS, 2047u,
+  },
+  {
+    "kaa",
+    "word",
+    WA_FREQ_74_TOKENS, 28u,
+    &WA_ALPHABETS[124],
+    WA_FREQ_74_RANKS, 63u,
+  },
+  {
+    "kab",
+    "word",
+    WA_FREQ_75_TOKENS, 1000u,
+    &WA_ALPHABETS[126],
+    WA_FREQ_75_RANKS, 2047u,
+  },
+  {
+    "kam",
+    "word",
+    WA_FREQ_76_TOKENS, 33u,
+    &WA_ALPHABETS[127],
+    WA_FREQ_76_RANKS, 127u,
+  },
+  {
+    "kk",
+    "word",
+    WA_FREQ_77_TOKENS, 1000u,
+    &WA_ALPHABETS[134],
+    WA_FREQ_77_RANKS, 2047u,
+  },
+  {
+    "km",
+    "bigram",
+    WA_FREQ_78_TOKENS, 1000u,
+    &WA_ALPHABETS[137],
+    WA_FREQ_78_RANKS, 2047u,
+  },
+  {
+    "kn",
+    "word",
+    WA_FREQ_79_TOKENS, 1000u,
+    &WA_ALPHABETS[138],
+    WA_FREQ_79_RANKS, 2047u,
+  },
+  {
+    "ko",
+    "bigram",
+    WA_FREQ_80_TOKENS, 1000u,
+    &WA_ALPHABETS[139],
+    WA_FREQ_80_RANKS, 2047u,
+  },
+  {
+    "ks",
+    "word",
+    WA_FREQ_81_TOKENS, 1000u,
+    &WA_ALPHABETS[144],
+    WA_FREQ_81_RANKS, 2047u,
+  },
+  {
+    "ksh",
+    "word",
+    WA_FREQ_82_TOKENS, 78u,
+    &WA_ALPHABETS[148],
+    WA_FREQ_82_RANKS, 255u,
+  },
+  {
+    "ku",
+    "word",
+    WA_FREQ_83_TOKENS, 1000u,
+    &WA_ALPHABETS[149],
+    WA_FREQ_83_RANKS, 2047u,
+  },
+  {
+    "ky",
+    "word",
+    WA_FREQ_84_TOKENS, 1000u,
+    &WA_ALPHABETS[152],
+    WA_FREQ_84_RANKS, 2047u,
+  },
+  {
+    "la",
+    "word",
+    WA_FREQ_85_TOKENS, 46u,
+    &WA_ALPHABETS[153],
+    WA_FREQ_85_RANKS, 127u,
+  },
+  {
+    "lg",
+    "word",
+    WA_FREQ_86_TOKENS, 1000u,
+    &WA_ALPHABETS[157],
+    WA_FREQ_86_RANKS, 2047u,
+  },
+  {
+    "lij",
+    "word",
+    WA_FREQ_87_TOKENS, 55u,
+    &WA_ALPHABETS[159],
+    WA_FREQ_87_RANKS, 127u,
+  },
+  {
+    "lld",
+    "word",
+    WA_FREQ_88_TOKENS, 86u,
+    &WA_ALPHABETS[162],
+    WA_FREQ_88_RANKS, 255u,
+  },
+  {
+    "lmo",
+    "word",
+    WA_FREQ_89_TOKENS, 21u,
+    &WA_ALPHABETS[163],
+    WA_FREQ_89_RANKS, 63u,
+  },
+  {
+    "ln",
+    "word",
+    WA_FREQ_90_TOKENS, 1000u,
+    &WA_ALPHABETS[164],
+    WA_FREQ_90_RANKS, 2047u,
+  },
+  {
+    "lo",
+    "bigram",
+    WA_FREQ_91_TOKENS, 1000u,
+    &WA_ALPHABETS[165],
+    WA_FREQ_91_RANKS, 2047u,
+  },
+  {
+    "lt",
+    "word",
+    WA_FREQ_92_TOKENS, 1000u,
+    &WA_ALPHABETS[167],
+    WA_FREQ_92_RANKS, 2047u,
+  },
+  {
+    "ltg",
+    "word",
+    WA_FREQ_93_TOKENS, 40u,
+    &WA_ALPHABETS[168],
+    WA_FREQ_93_RANKS, 127u,
+  },
+  {
+    "lv",
+    "word",
+    WA_FREQ_94_TOKENS, 1000u,
+    &WA_ALPHABETS[172],
+    WA_FREQ_94_RANKS, 2047u,
+  },
+  {
+    "lzh",
+    "word",
+    WA_FREQ_95_TOKENS, 17u,
+    &WA_ALPHABETS[173],
+    WA_FREQ_95_RANKS, 63u,
+  },
+  {
+    "mai",
+    "word",
+    WA_FREQ_96_TOKENS, 16u,
+    &WA_ALPHABETS[174],
+    WA_FREQ_96_RANKS, 31u,
+  },
+  {
+    "mdf",
+    "word",
+    WA_FREQ_97_TOKENS, 32u,
+    &WA_ALPHABETS[176],
+    WA_FREQ_97_RANKS, 63u,
+  },
+  {
+    "meh",
+    "word",
+    WA_FREQ_98_TOKENS, 1000u,
+    &WA_ALPHABETS[177],
+    WA_FREQ_98_RANKS, 2047u,
+  },
+  {
+    "mel",
+    "word",
+    WA_FREQ_99_TOKENS, 1000u,
+    &WA_ALPHABETS[178],
+    WA_FREQ_99_RANKS, 2047u,
+  },
+  {
+    "mg",
+    "word",
+    WA_FREQ_100_TOKENS, 1000u,
+    &WA_ALPHABETS[181],
+    WA_FREQ_100_RANKS, 2047u,
+  },
+  {
+    "mic",
+    "word",
+    WA_FREQ_101_TOKENS, 20u,
+    &WA_ALPHABETS[186],
+    WA_FREQ_101_RANKS, 63u,
+  },
+  {
+    "mk",
+    "word",
+    WA_FREQ_102_TOKENS, 1000u,
+    &WA_ALPHABETS[188],
+    WA_FREQ_102_RANKS, 2047u,
+  },
+  {
+    "ml",
+    "word",
+    WA_FREQ_103_TOKENS, 1000u,
+    &WA_ALPHABETS[189],
+    WA_FREQ_103_RANKS, 2047u,
+  },
+  {
+    "mmc",
+    "word",
+    WA_FREQ_104_TOKENS, 1000u,
+    &WA_ALPHABETS[190],
+    WA_FREQ_104_RANKS, 2047u,
+  },
+  {
+    "mn",
+    "word",
+    WA_FREQ_105_TOKENS, 47u,
+    &WA_ALPHABETS[191],
+    WA_FREQ_105_RANKS, 127u,
+  },
+  {
+    "mni",
+    "word",
+    WA_FREQ_106_TOKENS, 28u,
+    &WA_ALPHABETS[193],
+    WA_FREQ_106_RANKS, 63u,
+  },
+  {
+    "moh",
+    "word",
+    WA_FREQ_107_TOKENS, 52u,
+    &WA_ALPHABETS[196],
+    WA_FREQ_107_RANKS, 127u,
+  },
+  {
+    "ms",
+    "word",
+    WA_FREQ_108_TOKENS, 1000u,
+    &WA_ALPHABETS[199],
+    WA_FREQ_108_RANKS, 2047u,
+  },
+  {
+    "msi",
+    "word",
+    WA_FREQ_109_TOKENS, 1000u,
+    &WA_ALPHABETS[200],
+    WA_FREQ_109_RANKS, 2047u,
+  },
+  {
+    "mt",
+    "word",
+    WA_FREQ_110_TOKENS, 33u,
+    &WA_ALPHABETS[201],
+    WA_FREQ_110_RANKS, 127u,
+  },
+  {
+    "mus",
+    "word",
+    WA_FREQ_111_TOKENS, 29u,
+    &WA_ALPHABETS[203],
+    WA_FREQ_111_RANKS, 63u,
+  },
+  {
+    "my",
+    "bigram",
+    WA_FREQ_112_TOKENS, 1000u,
+    &WA_ALPHABETS[204],
+    WA_FREQ_112_RANKS, 2047u,
+  },
+  {
+    "myv",
+    "word",
+    WA_FREQ_113_TOKENS, 28u,
+    &WA_ALPHABETS[205],
+    WA_FREQ_113_RANKS, 63u,
+  },
+  {
+    "mzn",
+    "word",
+    WA_FREQ_114_TOKENS, 1000u,
+    &WA_ALPHABETS[206],
+    WA_FREQ_114_RANKS, 2047u,
+  },
+  {
+    "nds",
+    "word",
+    WA_FREQ_115_TOKENS, 59u,
+    &WA_ALPHABETS[210],
+    WA_FREQ_115_RANKS, 127u,
+  },
+  {
+    "ne",
+    "word",
+    WA_FREQ_116_TOKENS, 1000u,
+    &WA_ALPHABETS[211],
+    WA_FREQ_116_RANKS, 2047u,
+  },
+  {
+    "nl",
+    "word",
+    WA_FREQ_117_TOKENS, 1000u,
+    &WA_ALPHABETS[212],
+    WA_FREQ_117_RANKS, 2047u,
+  },
+  {
+    "nn",
+    "word",
+    WA_FREQ_118_TOKENS, 47u,
+    &WA_ALPHABETS[214],
+    WA_FREQ_118_RANKS, 127u,
+  },
+  {
+    "no",
+    "word",
+    WA_FREQ_119_TOKENS, 1000u,
+    &WA_ALPHABETS[216],
+    WA_FREQ_119_RANKS, 2047u,
+  },
+  {
+    "nso",
+    "word",
+    WA_FREQ_120_TOKENS, 1000u,
+    &WA_ALPHABETS[219],
+    WA_FREQ_120_RANKS, 2047u,
+  },
+  {
+    "nus",
+    "word",
+    WA_FREQ_121_TOKENS, 53u,
+    &WA_ALPHABETS[220],
+    WA_FREQ_121_RANKS, 127u,
+  },
+  {
+    "oc",
+    "word",
+    WA_FREQ_122_TOKENS, 1000u,
+    &WA_ALPHABETS[224],
+    WA_FREQ_122_RANKS, 2047u,
+  },
+  {
+    "om",
+    "word",
+    WA_FREQ_123_TOKENS, 1000u,
+    &WA_ALPHABETS[225],
+    WA_FREQ_123_RANKS, 2047u,
+  },
+  {
+    "or",
+    "word",
+    WA_FREQ_124_TOKENS, 1000u,
+    &WA_ALPHABETS[226],
+    WA_FREQ_124_RANKS, 2047u,
+  },
+  {
+    "pa",
+    "word",
+    WA_FREQ_125_TOKENS, 46u,
+    &WA_ALPHABETS[229],
+    WA_FREQ_125_RANKS, 127u,
+  },
+  {
+    "pap",
+    "word",
+    WA_FREQ_126_TOKENS, 32u,
+    &WA_ALPHABETS[230],
+    WA_FREQ_126_RANKS, 63u,
+  },
+  {
+    "pl",
+    "word",
+    WA_FREQ_127_TOKENS, 1000u,
+    &WA_ALPHABETS[233],
+    WA_FREQ_127_RANKS, 2047u,
+  },
+  {
+    "prg",
+    "word",
+    WA_FREQ_128_TOKENS, 48u,
+    &WA_ALPHABETS[234],
+    WA_FREQ_128_RANKS, 127u,
+  },
+  {
+    "ps",
+    "word",
+    WA_FREQ_129_TOKENS, 78u,
+    &WA_ALPHABETS[235],
+    WA_FREQ_129_RANKS, 255u,
+  },
+  {
+    "pt",
+    "word",
+    WA_FREQ_130_TOKENS, 1000u,
+    &WA_ALPHABETS[236],
+    WA_FREQ_130_RANKS, 2047u,
+  },
+  {
+    "qu",
+    "word",
+    WA_FREQ_131_TOKENS, 1000u,
+    &WA_ALPHABETS[237],
+    WA_FREQ_131_RANKS, 2047u,
+  },
+  {
+    "quc",
+    "word",
+    WA_FREQ_132_TOKENS, 15u,
+    &WA_ALPHABETS[238],
+    WA_FREQ_132_RANKS, 31u,
+  },
+  {
+    "rhg",
+    "word",
+    WA_FREQ_133_TOKENS, 111u,
+    &WA_ALPHABETS[241],
+    WA_FREQ_133_RANKS, 255u,
+  },
+  {
+    "rn",
+    "word",
+    WA_FREQ_134_TOKENS, 1000u,
+    &WA_ALPHABETS[243],
+    WA_FREQ_134_RANKS, 2047u,
+  },
+  {
+    "ro",
+    "word",
+    WA_FREQ_135_TOKENS, 1000u,
+    &WA_ALPHABETS[244],
+    WA_FREQ_135_RANKS, 2047u,
+  },
+  {
+    "ru",
+    "word",
+    WA_FREQ_136_TOKENS, 1000u,
+    &WA_ALPHABETS[245],
+    WA_FREQ_136_RANKS, 2047u,
+  },
+  {
+    "ruc",
+    "word",
+    WA_FREQ_137_TOKENS, 1000u,
+    &WA_ALPHABETS[246],
+    WA_FREQ_137_RANKS, 2047u,
+  },
+  {
+    "rw",
+    "word",
+    WA_FREQ_138_TOKENS, 1000u,
+    &WA_ALPHABETS[247],
+    WA_FREQ_138_RANKS, 2047u,
+  },
+  {
+    "sah",
+    "word",
+    WA_FREQ_139_TOKENS, 39u,
+    &WA_ALPHABETS[250],
+    WA_FREQ_139_RANKS, 127u,
+  },
+  {
+    "sat",
+    "word",
+    WA_FREQ_140_TOKENS, 34u,
+    &WA_ALPHABETS[253],
+    WA_FREQ_140_RANKS, 127u,
+  },
+  {
+    "scn",
+    "word",
+    WA_FREQ_141_TOKENS, 57u,
+    &WA_ALPHABETS[258],
+    WA_FREQ_141_RANKS, 127u,
+  },
+  {
+    "sd",
+    "word",
+    WA_FREQ_142_TOKENS, 1000u,
+    &WA_ALPHABETS[259],
+    WA_FREQ_142_RANKS, 2047u,
+  },
+  {
+    "sdh",
+    "word",
+    WA_FREQ_143_TOKENS, 44u,
+    &WA_ALPHABETS[260],
+    WA_FREQ_143_RANKS, 127u,
+  },
+  {
+    "shi",
+    "word",
+    WA_FREQ_144_TOKENS, 56u,
+    &WA_ALPHABETS[266],
+    WA_FREQ_144_RANKS, 127u,
+  },
+  {
+    "si",
+    "word",
+    WA_FREQ_145_TOKENS, 1000u,
+    &WA_ALPHABETS[267],
+    WA_FREQ_145_RANKS, 2047u,
+  },
+  {
+    "sk",
+    "word",
+    WA_FREQ_146_TOKENS, 1000u,
+    &WA_ALPHABETS[268],
+    WA_FREQ_146_RANKS, 2047u,
+  },
+  {
+    "sl",
+    "word",
+    WA_FREQ_147_TOKENS, 1000u,
+    &WA_ALPHABETS[269],
+    WA_FREQ_147_RANKS, 2047u,
+  },
+  {
+    "sma",
+    "word",
+    WA_FREQ_148_TOKENS, 26u,
+    &WA_ALPHABETS[270],
+    WA_FREQ_148_RANKS, 63u,
+  },
+  {
+    "sn",
+    "word",
+    WA_FREQ_149_TOKENS, 1000u,
+    &WA_ALPHABETS[274],
+    WA_FREQ_149_RANKS, 2047u,
+  },
+  {
+    "so",
+    "word",
+    WA_FREQ_150_TOKENS, 1000u,
+    &WA_ALPHABETS[275],
+    WA_FREQ_150_RANKS, 2047u,
+  },
+  {
+    "sq",
+    "word",
+    WA_FREQ_151_TOKENS, 1000u,
+    &WA_ALPHABETS[276],
+    WA_FREQ_151_RANKS, 2047u,
+  },
+  {
+    "sr",
+    "word",
+    WA_FREQ_152_TOKENS, 1000u,
+    &WA_ALPHABETS[277],
+    WA_FREQ_152_RANKS, 2047u,
+  },
+  {
+    "ss",
+    "word",
+    WA_FREQ_153_TOKENS, 1000u,
+    &WA_ALPHABETS[279],
+    WA_FREQ_153_RANKS, 2047u,
+  },
+  {
+    "st",
+    "word",
+    WA_FREQ_154_TOKENS, 1000u,
+    &WA_ALPHABETS[281],
+    WA_FREQ_154_RANKS, 2047u,
+  },
+  {
+    "su",
+    "word",
+    WA_FREQ_155_TOKENS, 1000u,
+    &WA_ALPHABETS[282],
+    WA_FREQ_155_RANKS, 2047u,
+  },
+  {
+    "sv",
+    "word",
+    WA_FREQ_156_TOKENS, 1000u,
+    &WA_ALPHABETS[283],
+    WA_FREQ_156_RANKS, 2047u,
+  },
+  {
+    "sw",
+    "word",
+    WA_FREQ_157_TOKENS, 1000u,
+    &WA_ALPHABETS[284],
+    WA_FREQ_157_RANKS, 2047u,
+  },
+  {
+    "szl",
+    "word",
+    WA_FREQ_158_TOKENS, 44u,
+    &WA_ALPHABETS[286],
+    WA_FREQ_158_RANKS, 127u,
+  },
+  {
+    "ta",
+    "word",
+    WA_FREQ_159_TOKENS, 1000u,
+    &WA_ALPHABETS[287],
+    WA_FREQ_159_RANKS, 2047u,
+  },
+  {
+    "te",
+    "word",
+    WA_FREQ_160_TOKENS, 1000u,
+    &WA_ALPHABETS[289],
+    WA_FREQ_160_RANKS, 2047u,
+  },
+  {
+    "tg",
+    "word",
+    WA_FREQ_161_TOKENS, 1000u,
+    &WA_ALPHABETS[291],
+    WA_FREQ_161_RANKS, 2047u,
+  },
+  {
+    "th",
+    "bigram",
+    WA_FREQ_162_TOKENS, 1000u,
+    &WA_ALPHABETS[292],
+    WA_FREQ_162_RANKS, 2047u,
+  },
+  {
+    "ti",
+    "word",
+    WA_FREQ_163_TOKENS, 1000u,
+    &WA_ALPHABETS[293],
+    WA_FREQ_163_RANKS, 2047u,
+  },
+  {
+    "tig",
+    "word",
+    WA_FREQ_164_TOKENS, 31u,
+    &WA_ALPHABETS[294],
+    WA_FREQ_164_RANKS, 63u,
+  },
+  {
+    "tk",
+    "word",
+    WA_FREQ_165_TOKENS, 1000u,
+    &WA_ALPHABETS[295],
+    WA_FREQ_165_RANKS, 2047u,
+  },
+  {
+    "tl",
+    "word",
+    WA_FREQ_166_TOKENS, 1000u,
+    &WA_ALPHABETS[296],
+    WA_FREQ_166_RANKS, 2047u,
+  },
+  {
+    "tn",
+    "word",
+    WA_FREQ_167_TOKENS, 1000u,
+    &WA_ALPHABETS[297],
+    WA_FREQ_167_RANKS, 2047u,
+  },
+  {
+    "tob",
+    "word",
+    WA_FREQ_168_TOKENS, 1000u,
+    &WA_ALPHABETS[299],
+    WA_FREQ_168_RANKS, 2047u,
+  },
+  {
+    "tok",
+    "word",
+    WA_FREQ_169_TOKENS, 155u,
+    &WA_ALPHABETS[300],
+    WA_FREQ_169_RANKS, 511u,
+  },
+  {
+    "top",
+    "word",
+    WA_FREQ_170_TOKENS, 1000u,
+    &WA_ALPHABETS[301],
+    WA_FREQ_170_RANKS, 2047u,
+  },
+  {
+    "tpi",
+    "word",
+    WA_FREQ_171_TOKENS, 37u,
+    &WA_ALPHABETS[302],
+    WA_FREQ_171_RANKS, 127u,
+  },
+  {
+    "tr",
+    "word",
+    WA_FREQ_172_TOKENS, 1000u,
+    &WA_ALPHABETS[303],
+    WA_FREQ_172_RANKS, 2047u,
+  },
+  {
+    "ts",
+    "word",
+    WA_FREQ_173_TOKENS, 1000u,
+    &WA_ALPHABETS[304],
+    WA_FREQ_173_RANKS, 2047u,
+  },
+  {
+    "tt",
+    "word",
+    WA_FREQ_174_TOKENS, 1000u,
+    &WA_ALPHABETS[305],
+    WA_FREQ_174_RANKS, 2047u,
+  },
+  {
+    "ttj",
+    "word",
+    WA_FREQ_175_TOKENS, 1000u,
+    &WA_ALPHABETS[306],
+    WA_FREQ_175_RANKS, 2047u,
+  },
+  {
+    "tyv",
+    "word",
+    WA_FREQ_176_TOKENS, 28u,
+    &WA_ALPHABETS[308],
+    WA_FREQ_176_RANKS, 63u,
+  },
+  {
+    "ug",
+    "word",
+    WA_FREQ_177_TOKENS, 1000u,
+    &WA_ALPHABETS[310],
+    WA_FREQ_177_RANKS, 2047u,
+  },
+  {
+    "uk",
+    "word",
+    WA_FREQ_178_TOKENS, 1000u,
+    &WA_ALPHABETS[311],
+    WA_FREQ_178_RANKS, 2047u,
+  },
+  {
+    "ukv",
+    "word",
+    WA_FREQ_179_TOKENS, 1000u,
+    &WA_ALPHABETS[312],
+    WA_FREQ_179_RANKS, 2047u,
+  },
+  {
+    "ur",
+    "word",
+    WA_FREQ_180_TOKENS, 1000u,
+    &WA_ALPHABETS[313],
+    WA_FREQ_180_RANKS, 2047u,
+  },
+  {
+    "uz",
+    "word",
+    WA_FREQ_181_TOKENS, 1000u,
+    &WA_ALPHABETS[314],
+    WA_FREQ_181_RANKS, 2047u,
+  },
+  {
+    "ve",
+    "word",
+    WA_FREQ_182_TOKENS, 1000u,
+    &WA_ALPHABETS[317],
+    WA_FREQ_182_RANKS, 2047u,
+  },
+  {
+    "vec",
+    "word",
+    WA_FREQ_183_TOKENS, 61u,
+    &WA_ALPHABETS[318],
+    WA_FREQ_183_RANKS, 127u,
+  },
+  {
+    "vi",
+    "word",
+    WA_FREQ_184_TOKENS, 1000u,
+    &WA_ALPHABETS[319],
+    WA_FREQ_184_RANKS, 2047u,
+  },
+  {
+    "vo",
+    "word",
+    WA_FREQ_185_TOKENS, 39u,
+    &WA_ALPHABETS[321],
+    WA_FREQ_185_RANKS, 127u,
+  },
+  {
+    "wo",
+    "word",
+    WA_FREQ_186_TOKENS, 1000u,
+    &WA_ALPHABETS[326],
+    WA_FREQ_186_RANKS, 2047u,
+  },
+  {
+    "xh",
+    "word",
+    WA_FREQ_187_TOKENS, 40u,
+    &WA_ALPHABETS[327],
+    WA_FREQ_187_RANKS, 127u,
+  },
+  {
+    "xkl",
+    "word",
+    WA_FREQ_188_TOKENS, 1000u,
+    &WA_ALPHABETS[328],
+    WA_FREQ_188_RANKS, 2047u,
+  },
+  {
+    "yo",
+    "word",
+    WA_FREQ_189_TOKENS, 1000u,
+    &WA_ALPHABETS[333],
+    WA_FREQ_189_RANKS, 2047u,
+  },
+  {
+    "za",
+    "word",
+    WA_FREQ_190_TOKENS, 1000u,
+    &WA_ALPHABETS[335],
+    WA_FREQ_190_RANKS, 2047u,
+  },
+  {
+    "zh",
+    "bigram",
+    WA_FREQ_191_TOKENS, 63u,
+    &WA_ALPHABETS[336],
+    WA_FREQ_191_RANKS, 127u,
+  },
+  {
+    "zu",
+    "word",
+    WA_FREQ_192_TOKENS, 1000u,
+    &WA_ALPHABETS[341],
+    WA_FREQ_192_RANKS, 2047u,
+  },
+};
+
+const double WA_RANK_WEIGHTS[] = {
+  1.7095112913514547, 0.75647079736603, 0.5532947556651122, 0.46084542061837025,
+  0.40659800924006667, 0.3703100622028965, 0.3440101947801938, 0.32389053777082116,
+  0.30788864463904214, 0.29478373494331395, 0.28380372261682446, 0.27443454075003526,
+  0.266319563348789, 0.2592029357487628, 0.25289589122654377, 0.24725582386086203,
+  0.24217279268492622, 0.2375605365212512, 0.23335032487697144, 0.22948664730569168,
+  0.22592412686965518, 0.22262526813646402, 0.21955878621879557, 0.21669834806086988,
+  0.21402161122130578, 0.21150948067132563, 0.20914552761453564, 0.20691553026638204,
+  0.20480710752155012, 0.20280942413660785, 0.2009129515257043, 0.19910927220541552,
+  0.19739091879462942, 0.19575124059025792, 0.19418429231456766, 0.19268474081439924,
+  0.1912477863915308, 0.18986909613163472, 0.18854474713037442, 0.18727117792818018,
+  0.18604514678870201, 0.18486369571099973, 0.18372411926794552, 0.18262393752493403,
+  0.18156087242278238, 0.18053282711350246, 0.17953786782269174, 0.17857420788167755,
+  0.17764019362942016, 0.1767342919310014, 0.17585507909824205, 0.17500123103013457,
+  0.17417151441757528, 0.17336477887930066, 0.1725799499147614, 0.17181602257553813,
+  0.17107205577031884, 0.1703471671298416, 0.16964052836789287, 0.1689513610827171,
+  0.16827893295027188, 0.16762255426683464, 0.16698157480369683, 0.1663553809411901,
+  0.1657433930531935, 0.16514506311665228, 0.16455987252358206, 0.16398733007559238,
+  0.16342697014320248, 0.16287835097417802, 0.1623410531368338, 0.16181467808575536,
+  0.16129884683871856, 0.16079319875475695, 0.16029739040435972, 0.15981109452369893,
+  0.15933399904559487, 0.1588658062006488, 0.15840623168261422, 0.1579550038726469,
+  0.15751186311758444, 0.15707656105786102, 0.15664886000107042, 0.15622853233755468,
+  0.1558153599947254, 0.1554091339271165, 0.15500965363943442, 0.15461672674010973,
+  0.154230168523069, 0.1538498015756414, 0.1534754554106896, 0.15310696612121458,
+  0.15274417605582769, 0.15238693351361496, 0.15203509245703767, 0.15168851224162103,
+  0.15134705736128204, 0.15101059720823704, 0.1506790058465117, 0.15035216179815097,
+  0.15002994784129467, 0.14971225081934755, 0.14939896146052972, 0.1490899742071454,
+  0.14878518705395744, 0.1484845013950975, 0.14818782187898452, 0.14789505627075958,
+  0.14760611532178095, 0.14732091264575473, 0.14703936460110498, 0.146761390179215,
+  0.14648691089819615, 0.14621585070186321, 0.14594813586361727, 0.14568369489495622,
+  0.1454224584583517, 0.1451643592842473, 0.1449093320919504, 0.1446573135142018,
+  0.14440824202522384, 0.14416205787205774, 0.143918703009014, 0.1436781210350702,
+  0.1434402571340604, 0.14320505801751024, 0.14297247186997986, 0.14274244829678573,
+  0.14251493827397993, 0.14228989410047185, 0.1420672693521851, 0.1418470188381474,
+  0.14162909855841835, 0.14141346566376392, 0.14120007841699322, 0.14098889615587643,
+  0.1407798792575681, 0.1405729891044642, 0.14036818805142443, 0.14016543939429651,
+  0.13996470733968044, 0.1397659569758767, 0.1395691542449626, 0.139374265915946,
+  0.13918125955894753, 0.13899010352036448, 0.1388007668989729, 0.13861321952292613,
+  0.13842743192761017, 0.13824337533431807, 0.13806102162970837, 0.13788034334601298,
+  0.13770131364196275, 0.1375239062843999, 0.13734809563054848, 0.1371738566109146,
+  0.13700116471279095, 0.1368299959643395, 0.1366603269192294, 0.13649213464180668,
+  0.13632539669277433, 0.1361600911153623, 0.13599619642196695, 0.13583369158124234,
+  0.13567255600562403, 0.13551276953926966, 0.13535431244639873, 0.13519716540001697,
+  0.13504130947100962, 0.13488672611759006, 0.1347333971750896, 0.1345813048460757,
+  0.13443043169078636, 0.1342807606178682, 0.13413227487540763, 0.1339849580422434,
+  0.13383879401955082, 0.13369376702268718, 0.133549861573289, 0.13340706249161188,
+  0.1332653548891045, 0.13312472416120738, 0.13298515598037006, 0.13284663628927684,
+  0.13270915129427563, 0.1325726874590014, 0.13243723149818806, 0.1323027703716623,
+  0.1321692912785124, 0.132036781651427, 0.13190522915119707, 0.13177462166137605,
+  0.13164494728309276, 0.13151619433001163, 0.1313883513234358, 0.1312614069875477,
+  0.13113535024478332, 0.1310101702113348, 0.13088585619277823, 0.13076239767982145,
+  0.130639784344169, 0.13051800603449945, 0.13039705277255234, 0.13027691474932057,
+  0.13015758232134547, 0.13003904600711055, 0.12992129648353165, 0.12980432458253988,
+  0.1296881212877546, 0.12957267773124373, 0.12945798519036866, 0.12934403508471104,
+  0.1292308189730791, 0.12911832855059088, 0.1290065556458325, 0.12889549221808824,
+  0.1287851303546415, 0.12867546226814366, 0.12856648029404888, 0.12845817688811348,
+  0.12835054462395717, 0.12824357619068502, 0.12813726439056797, 0.12803160213678028,
+  0.12792658245119237, 0.1278221984622174, 0.12771844340270994, 0.12761531060791523,
+  0.12751279351346803, 0.12741088565343894, 0.12730958065842735, 0.12720887225369978,
+  0.12710875425737164, 0.1270092205786324, 0.12691026521601148, 0.1268118822556853,
+  0.12671406586982292, 0.1266168103149703, 0.12652010993047158, 0.12642395913692633,
+  0.12632835243468235, 0.12623328440236226, 0.1261387496954236, 0.12604474304475144,
+  0.12595125925528225, 0.12585829320465877, 0.12576583984191464, 0.1256738941861881,
+  0.12558245132546422, 0.12549150641534462, 0.12540105467784401, 0.1253110914002133,
+  0.12522161193378772, 0.1251326116928603, 0.12504408615357923, 0.12495603085286922,
+  0.12486844138737542, 0.12478131341243032, 0.12469464264104203, 0.12460842484290438,
+  0.12452265584342732, 0.12443733152278813, 0.12435244781500202, 0.12426800070701213,
+  0.12418398623779865, 0.12410040049750573, 0.12401723962658699, 0.12393449981496789,
+  0.12385217730122555, 0.12377026837178522, 0.1236887693601327, 0.12360767664604301,
+  0.12352698665482423, 0.1234466958565767, 0.12336680076546677, 0.12328729793901518,
+  0.12320818397739931, 0.12312945552276935, 0.12305110925857776, 0.12297314190892196,
+  0.1228955502378998, 0.12281833104897744, 0.12274148118436962, 0.12266499752443183,
+  0.12258887698706411, 0.12251311652712629, 0.12243771313586442, 0.12236266384034802,
+  0.1222879657029181, 0.12221361582064548, 0.12213961132479949, 0.12206594938032636,
+  0.12199262718533754, 0.12191964197060752, 0.12184699099908093, 0.12177467156538875,
+  0.12170268099537353, 0.12163101664562309, 0.12155967590301309, 0.12148865618425758,
+  0.12141795493546809, 0.12134756963172029, 0.12127749777662893, 0.12120773690192999,
+  0.1211382845670707, 0.1210691383588066, 0.1210002958908059, 0.12093175480326085,
+  0.1208635127625061, 0.12079556746064352, 0.12072791661517392, 0.12066055796863498,
+  0.12059348928824559, 0.1205267083655566, 0.12046021301610704, 0.12039400107908713,
+  0.12032807041700624, 0.12026241891536728, 0.12019704448234601, 0.12013194504847653,
+  0.12006711856634146, 0.12000256301026781, 0.1199382763760278, 0.11987425668054488,
+  0.11981050196160448, 0.11974701027756969, 0.11968377970710196, 0.11962080834888583,
+  0.11955809432135898, 0.11949563576244611, 0.11943343082929767, 0.11937147769803248,
+  0.11930977456348504, 0.1192483196389565, 0.11918711115597, 0.11912614736402989,
+  0.11906542653038482, 0.11900494693979477, 0.1189447068943016, 0.11888470471300355,
+  0.11882493873183325, 0.1187654073033391, 0.11870610879647045, 0.11864704159636594,
+  0.11858820410414529, 0.11852959473670435, 0.11847121192651339, 0.11841305412141846,
+  0.11835511978444607, 0.11829740739361064, 0.1182399154417252, 0.11818264243621478,
+  0.11812558689893293, 0.11806874736598093, 0.11801212238752963, 0.11795571052764443,
+  0.11789951036411252, 0.11784352048827296, 0.11778773950484929, 0.11773216603178474,
+  0.1176767987000798, 0.11762163615363237, 0.1175666770490802, 0.11751192005564581,
+  0.11745736385498358, 0.11740300714102925, 0.11734884861985155, 0.11729488700950619,
+  0.11724112103989177, 0.117187549452608, 0.11713417100081591, 0.1170809844491002,
+  0.11702798857333349, 0.11697518216054263, 0.11692256400877682, 0.11687013292697797,
+  0.11681788773485241, 0.11676582726274504, 0.11671395035151476, 0.11666225585241205,
+  0.11661074262695816, 0.11655940954682595, 0.11650825549372266, 0.11645727935927405,
+  0.11640648004491037, 0.11635585646175395, 0.11630540753050822, 0.11625513218134842,
+  0.11620502935381384, 0.11615509799670143, 0.11610533706796111, 0.1160557455345923,
+  0.11600632237254209, 0.11595706656660462, 0.11590797711032202, 0.11585905300588666,
+  0.11581029326404464, 0.11576169690400079, 0.11571326295332472, 0.11566499044785841,
+  0.11561687843162491, 0.11556892595673819, 0.11552113208331448, 0.11547349587938453,
+  0.11542601642080717, 0.11537869279118405, 0.11533152408177542, 0.11528450939141727,
+  0.11523764782643912, 0.11519093850058346, 0.11514438053492584, 0.1150979730577962,
+  0.11505171520470109, 0.11500560611824723, 0.11495964494806558, 0.11491383085073696,
+  0.11486816298971812, 0.11482264053526922, 0.11477726266438178, 0.11473202856070817,
+  0.11468693741449133, 0.11464198842249598, 0.11459718078794034, 0.11455251372042888,
+  0.1145079864358859, 0.11446359815649, 0.1144193481106093, 0.11437523553273757,
+  0.11433125966343105, 0.11428741974924625, 0.11424371504267836, 0.11420014480210057,
+  0.11415670829170402, 0.11411340478143857, 0.11407023354695443, 0.11402719386954423,
+  0.11398428503608615, 0.11394150633898739, 0.11389885707612876, 0.11385633655080953,
+  0.1138139440716933, 0.11377167895275428, 0.1137295405132245, 0.11368752807754133,
+  0.1136456409752959, 0.1136038785411822, 0.11356224011494641, 0.11352072504133728,
+  0.11347933267005694, 0.11343806235571222, 0.11339691345776663, 0.113355885340493,
+  0.11331497737292656, 0.11327418892881863, 0.11323351938659088, 0.1131929681292901,
+  0.1131525345445435, 0.11311221802451468, 0.11307201796585986, 0.11303193376968487,
+  0.11299196484150256, 0.11295211059119056, 0.1129123704329499, 0.11287274378526369,
+  0.11283323007085659, 0.11279382871665468, 0.11275453915374563, 0.11271536081733957,
+  0.11267629314673028, 0.11263733558525685, 0.1125984875802658, 0.1125597485830736,
+  0.11252111804892972, 0.11248259543697989, 0.11244418021023005, 0.11240587183551051,
+  0.11236766978344058, 0.11232957352839368, 0.11229158254846265, 0.11225369632542573,
+  0.11221591434471263, 0.11217823609537118, 0.11214066107003436, 0.11210318876488751,
+  0.11206581867963607, 0.11202855031747372, 0.1119913831850508, 0.11195431679244286,
+  0.1119173506531201, 0.1118804842839166, 0.11184371720500022, 0.11180704893984264,
+  0.11177047901518994, 0.11173400696103328, 0.11169763231058003, 0.11166135460022523,
+  0.11162517336952325, 0.11158908816115994, 0.11155309852092479, 0.11151720399768376,
+  0.1114814041433521, 0.11144569851286769, 0.11141008666416442, 0.11137456815814606,
+  0.11133914255866043, 0.1113038094324736, 0.11126856834924466, 0.11123341888150058,
+  0.11119836060461137, 0.11116339309676558, 0.11112851593894592, 0.11109372871490526,
+  0.11105903101114291, 0.11102442241688087, 0.11098990252404083, 0.11095547092722093,
+  0.11092112722367296, 0.11088687101327992, 0.11085270189853355, 0.11081861948451237,
+  0.11078462337885965, 0.11075071319176198, 0.11071688853592765, 0.11068314902656559,
+  0.11064949428136438, 0.11061592392047137, 0.11058243756647235, 0.11054903484437102,
+  0.11051571538156899, 0.1104824788078458, 0.11044932475533922, 0.11041625285852574,
+  0.11038326275420123, 0.11035035408146186, 0.11031752648168512, 0.11028477959851117,
+  0.11025211307782416, 0.11021952656773404, 0.11018701971855821, 0.11015459218280366,
+  0.11012224361514909, 0.11008997367242729, 0.11005778201360772, 0.11002566829977911,
+  0.10999363219413254, 0.10996167336194425, 0.10992979147055916, 0.10989798618937392,
+  0.10986625718982079, 0.10983460414535115, 0.10980302673141942, 0.10977152462546715,
+  0.10974009750690711, 0.10970874505710777, 0.10967746695937769, 0.10964626289895019,
+  0.10961513256296823, 0.1095840756404692, 0.10955309182237014, 0.10952218080145297,
+  0.10949134227234976, 0.10946057593152843, 0.10942988147727821, 0.10939925860969558,
+  0.10936870703067017, 0.10933822644387073, 0.10930781655473149, 0.10927747707043838,
+  0.10924720769991556, 0.1092170081538119, 0.10918687814448785, 0.10915681738600215,
+  0.10912682559409893, 0.10909690248619461, 0.10906704778136533, 0.10903726120033412,
+  0.10900754246545842, 0.10897789130071765, 0.10894830743170088, 0.10891879058559462,
+  0.10888934049117074, 0.10885995687877453, 0.1088306394803128, 0.10880138802924212,
+  0.10877220226055717, 0.10874308191077928, 0.1087140267179449, 0.10868503642159436,
+  0.10865611076276054, 0.10862724948395786, 0.1085984523291712, 0.10856971904384509,
+  0.10854104937487269, 0.10851244307058522, 0.1084838998807414, 0.10845541955651673,
+  0.1084270018504932, 0.10839864651664899, 0.10837035331034804, 0.10834212198833014,
+  0.10831395230870072, 0.10828584403092088, 0.10825779691579761, 0.10822981072547394,
+  0.1082018852234192, 0.1081740201744195, 0.1081462153445681, 0.10811847050125607,
+  0.10809078541316286, 0.108063159850247, 0.10803559358373699, 0.10800808638612212,
+  0.10798063803114345, 0.10795324829378487, 0.10792591695026421, 0.10789864377802444,
+  0.107871428555725, 0.10784427106323304, 0.10781717108161501, 0.10779012839312802,
+  0.10776314278121152, 0.10773621403047885, 0.10770934192670913, 0.10768252625683891,
+  0.10765576680895404, 0.10762906337228177, 0.10760241573718252, 0.10757582369514215,
+  0.10754928703876405, 0.1075228055617613, 0.10749637905894897, 0.1074700073262366,
+  0.10744369016062033, 0.10741742736017566, 0.10739121872404983, 0.10736506405245447,
+  0.10733896314665821, 0.10731291580897954, 0.10728692184277945, 0.10726098105245438,
+  0.1072350932434291, 0.1072092582221496, 0.10718347579607632, 0.107157745773677,
+  0.10713206796442001, 0.10710644217876744, 0.10708086822816844, 0.10705534592505246,
+  0.10702987508282269, 0.1070044555158494, 0.10697908703946357, 0.10695376946995024,
+  0.10692850262454225, 0.10690328632141378, 0.10687812037967413, 0.10685300461936144,
+  0.10682793886143636, 0.10680292292777613, 0.10677795664116832, 0.10675303982530476,
+  0.10672817230477571, 0.10670335390506372, 0.10667858445253779, 0.10665386377444755,
+  0.10662919169891741, 0.10660456805494081, 0.10657999267237456, 0.10655546538193303,
+  0.10653098601518271, 0.10650655440453649, 0.10648217038324816, 0.10645783378540698,
+  0.10643354444593218, 0.10640930220056755, 0.10638510688587616, 0.10636095833923497,
+  0.1063368563988295, 0.10631280090364885, 0.10628879169348023, 0.1062648286089039,
+  0.10624091149128814, 0.1062170401827842, 0.10619321452632106, 0.10616943436560067,
+  0.10614569954509297, 0.10612200991003086, 0.10609836530640543, 0.10607476558096111,
+  0.10605121058119087, 0.10602770015533151, 0.1060042341523588, 0.105980812421983,
+  0.10595743481464405, 0.10593410118150706, 0.10591081137445764, 0.10588756524609748,
+  0.10586436264973975, 0.10584120343940473, 0.10581808746981522, 0.10579501459639234,
+  0.10577198467525097, 0.10574899756319557, 0.10572605311771581, 0.10570315119698229,
+  0.10568029165984236, 0.10565747436581589, 0.10563469917509113, 0.10561196594852047,
+  0.10558927454761648, 0.10556662483454776, 0.10554401667213488, 0.10552144992384642,
+  0.10549892445379493, 0.10547644012673302, 0.10545399680804947, 0.10543159436376519,
+  0.1054092326605296, 0.10538691156561657, 0.10536463094692067, 0.1053423906729535,
+  0.10532019061283986, 0.10529803063631396, 0.1052759106137159, 0.1052538304159878,
+  0.1052317899146704, 0.1052097889818992, 0.10518782749040104, 0.1051659053134905,
+  0.10514402232506637, 0.10512217839960812, 0.10510037341217243, 0.1050786072383898,
+  0.105056879754461, 0.10503519083715376, 0.10501354036379941, 0.10499192821228945,
+  0.1049703542610722, 0.10494881838914961, 0.10492732047607395, 0.10490586040194447,
+  0.1048844380474042, 0.10486305329363683, 0.1048417060223634, 0.10482039611583922,
+  0.10479912345685069, 0.1047778879287122, 0.10475668941526306, 0.1047355278008643,
+  0.10471440297039585, 0.10469331480925326, 0.10467226320334493, 0.10465124803908887,
+  0.10463026920341004, 0.10460932658373706, 0.10458842006799962, 0.10456754954462533,
+  0.10454671490253702, 0.10452591603114975, 0.10450515282036799, 0.1044844251605829,
+  0.10446373294266946, 0.10444307605798366, 0.10442245439835973, 0.10440186785610756,
+  0.10438131632400977, 0.10436079969531913, 0.10434031786375586, 0.10431987072350496,
+  0.10429945816921352, 0.10427908009598816, 0.10425873639939241, 0.1042384269754441,
+  0.10421815172061273, 0.10419791053181708, 0.10417770330642252, 0.10415752994223852,
+  0.10413739033751625, 0.1041172843909459, 0.10409721200165448, 0.1040771730692031,
+  0.10405716749358472, 0.10403719517522164, 0.10401725601496317, 0.10399734991408319,
+  0.10397747677427784, 0.10395763649766306, 0.10393782898677242, 0.10391805414455466,
+  0.10389831187437144, 0.1038786020799951, 0.10385892466560626, 0.10383927953579172,
+  0.10381966659554213, 0.10380008575024978, 0.10378053690570639, 0.10376101996810087,
+  0.10374153484401732, 0.10372208144043256, 0.10370265966471427, 0.10368326942461871,
+  0.1036639106282886, 0.10364458318425103, 0.10362528700141542, 0.10360602198907135,
+  0.10358678805688652, 0.10356758511490477, 0.10354841307354393, 0.1035292718435939,
+  0.10351016133621455, 0.10349108146293379, 0.10347203213564554, 0.10345301326660779,
+  0.10343402476844063, 0.10341506655412429, 0.10339613853699724, 0.10337724063075422,
+  0.10335837274944441, 0.10333953480746946, 0.10332072671958165, 0.10330194840088197,
+  0.1032831997668184, 0.10326448073318387, 0.10324579121611453, 0.103227131132088,
+  0.1032085003979214, 0.1031898989307697, 0.10317132664812383, 0.10315278346780891,
+  0.10313426930798264, 0.10311578408713334, 0.10309732772407833, 0.10307890013796216,
+  0.10306050124825492, 0.10304213097475053, 0.10302378923756503, 0.10300547595713488,
+  0.10298719105421536, 0.1029689344498788, 0.10295070606551301, 0.10293250582281961,
+  0.10291433364381242, 0.10289618945081577, 0.10287807316646298, 0.10285998471369476,
+  0.10284192401575747, 0.10282389099620175, 0.10280588557888083, 0.10278790768794896,
+  0.10276995724785992, 0.10275203418336545, 0.10273413841951375, 0.10271626988164788,
+  0.10269842849540434, 0.10268061418671148, 0.10266282688178817, 0.10264506650714209,
+  0.10262733298956841, 0.10260962625614832, 0.10259194623424753, 0.1025742928515148,
+  0.10255666603588062, 0.10253906571555563, 0.1025214918190293, 0.10250394427506854,
+  0.10248642301271618, 0.10246892796128972, 0.10245145905037983, 0.1024340162098491,
+  0.10241659936983048, 0.10239920846072614, 0.10238184341320597, 0.10236450415820632,
+  0.10234719062692861, 0.10232990275083803, 0.10231264046166226, 0.10229540369139006,
+  0.10227819237227012, 0.10226100643680959, 0.10224384581777295, 0.10222671044818063,
+  0.10220960026130783, 0.10219251519068318, 0.10217545517008748, 0.10215842013355257,
+  0.10214141001535994, 0.10212442475003958, 0.10210746427236882, 0.10209052851737092,
+  0.1020736174203141, 0.10205673091671014, 0.10203986894231329, 0.10202303143311905,
+  0.10200621832536305, 0.10198942955551976, 0.10197266506030142, 0.10195592477665687,
+  0.10193920864177036, 0.10192251659306041, 0.1019058485681787, 0.10188920450500899,
+  0.10187258434166582, 0.10185598801649359, 0.10183941546806534, 0.10182286663518166,
+  0.10180634145686958, 0.10178983987238156, 0.10177336182119433, 0.10175690724300776,
+  0.10174047607774396, 0.10172406826554602, 0.10170768374677706, 0.10169132246201923,
+  0.10167498435207249, 0.10165866935795373, 0.10164237742089564, 0.10162610848234575,
+  0.10160986248396536, 0.10159363936762851, 0.10157743907542105, 0.10156126154963953,
+  0.10154510673279026, 0.10152897456758836, 0.10151286499695665, 0.10149677796402481,
+  0.10148071341212829, 0.10146467128480738, 0.10144865152580629, 0.10143265407907212,
+  0.10141667888875397, 0.10140072589920192, 0.10138479505496613, 0.10136888630079595,
+  0.10135299958163892, 0.10133713484263981, 0.10132129202913984, 0.1013054710866756,
+  0.10128967196097827, 0.10127389459797263, 0.10125813894377624, 0.10124240494469841,
+  0.10122669254723951, 0.10121100169808989, 0.10119533234412909, 0.10117968443242502,
+  0.10116405791023296, 0.1011484527249948, 0.10113286882433815, 0.10111730615607546,
+  0.10110176466820324, 0.10108624430890109, 0.10107074502653099, 0.10105526676963639,
+  0.10103980948694143, 0.10102437312735002, 0.10100895763994516, 0.100993562973988,
+  0.10097818907891705, 0.10096283590434744, 0.10094750340007008, 0.1009321915160508,
+  0.10091690020242965, 0.10090162940952005, 0.10088637908780801, 0.10087114918795141,
+  0.10085593966077913, 0.10084075045729035, 0.10082558152865374, 0.10081043282620672,
+  0.10079530430145467, 0.10078019590607024, 0.10076510759189251, 0.10075003931092633,
+  0.1007349910153415, 0.10071996265747209, 0.10070495418981563, 0.10068996556503254,
+  0.10067499673594517, 0.1006600476555373, 0.10064511827695324, 0.10063020855349727,
+  0.10061531843863285, 0.10060044788598188, 0.10058559684932403, 0.1005707652825961,
+  0.10055595313989124, 0.10054116037545831, 0.10052638694370117, 0.10051163279917796,
+  0.10049689789660053, 0.10048218219083362, 0.1004674856368943, 0.10045280818995127,
+  0.10043814980532416, 0.10042351043848288, 0.10040889004504702, 0.10039428858078508,
+  0.10037970600161397, 0.10036514226359822, 0.10035059732294938, 0.10033607113602545,
+};
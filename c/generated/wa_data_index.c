@@ -0,0 +1,154 @@
+#include "worldalphabets_data.h"
+
+static const uint16_t WA_LANGUAGE_INDEX_SEEDS[] = {
+  3, 29, 1, 0, 0, 1, 7, 10, 2, 1, 26, 2, 0, 0, 0, 8,
+  13, 0, 11, 0, 0, 0, 14, 25, 5, 10, 9, 63, 9, 33, 0, 22,
+  17, 0, 15, 25, 6, 83, 38, 45, 54, 1, 77, 10, 16, 32, 16, 12,
+  9, 87, 2, 99, 0, 107, 1, 4, 16, 7, 1, 0, 23, 5, 9, 108,
+  89, 22, 1, 1, 0, 25, 390, 258, 31, 0, 1, 7, 1, 19, 29, 3,
+  139, 111, 201, 81, 60, 166, 4, 149, 151, 3, 25, 1, 260, 37, 0, 2,
+  6, 2, 138, 143, 19, 24, 27, 1, 9, 13, 79,
+};
+static const uint16_t WA_LANGUAGE_INDEX_SLOTS[] = {
+  150, 260, 293, 264, 111, 269, 64, 53, 203, 196, 174, 172, 10, 6, 107, 180,
+  151, 288, 227, 46, 210, 38, 125, 152, 95, 194, 133, 202, 218, 40, 309, 200,
+  241, 39, 254, 253, 73, 27, 159, 217, 0, 243, 117, 92, 129, 214, 146, 278,
+  265, 136, 138, 216, 2, 245, 220, 139, 109, 77, 205, 158, 267, 219, 106, 48,
+  204, 190, 244, 236, 282, 130, 33, 168, 9, 176, 199, 208, 231, 82, 287, 306,
+  37, 173, 50, 185, 15, 283, 201, 56, 26, 14, 232, 182, 17, 279, 23, 268,
+  187, 44, 115, 178, 230, 207, 317, 258, 164, 314, 316, 181, 75, 127, 43, 84,
+  18, 281, 110, 310, 63, 142, 162, 153, 313, 226, 262, 124, 177, 272, 179, 198,
+  250, 192, 189, 113, 276, 167, 183, 79, 239, 119, 81, 212, 97, 246, 320, 247,
+  31, 284, 304, 141, 251, 259, 169, 286, 59, 256, 104, 145, 143, 305, 291, 28,
+  213, 171, 274, 51, 78, 318, 186, 4, 166, 147, 20, 54, 303, 297, 34, 132,
+  98, 240, 233, 209, 273, 300, 61, 263, 184, 121, 122, 223, 21, 13, 19, 165,
+  60, 103, 58, 42, 12, 71, 140, 155, 148, 29, 160, 137, 134, 24, 154, 30,
+  74, 266, 35, 224, 249, 96, 45, 289, 80, 280, 99, 36, 242, 112, 85, 221,
+  149, 195, 261, 116, 277, 65, 135, 252, 41, 94, 25, 62, 67, 118, 311, 156,
+  86, 16, 32, 271, 100, 222, 319, 7, 312, 131, 90, 234, 57, 76, 270, 255,
+  5, 8, 83, 70, 66, 315, 299, 215, 308, 128, 170, 285, 307, 197, 211, 193,
+  238, 87, 1, 105, 302, 101, 235, 11, 52, 22, 188, 93, 295, 91, 275, 296,
+  69, 294, 257, 3, 228, 163, 248, 120, 298, 161, 206, 229, 102, 290, 301, 88,
+  225, 123, 72, 55, 157, 237, 144, 175, 89, 114, 191, 49, 108, 47, 292, 68,
+  126,
+};
+const wa_mph_table WA_LANGUAGE_INDEX = { WA_LANGUAGE_INDEX_SEEDS, WA_LANGUAGE_INDEX_SLOTS, 107u, 321u };
+
+static const uint16_t WA_ALPHABET_INDEX_SEEDS[] = {
+  11, 11, 0, 1, 1, 6, 16, 21, 17, 24, 0, 0, 4, 2, 8, 14,
+  32, 0, 9, 5, 3, 3, 1, 3, 0, 0, 60, 0, 4, 3, 7, 4,
+  11, 0, 80, 1, 21, 5, 29, 30, 0, 11, 9, 58, 68, 12, 6, 4,
+  0, 44, 28, 10, 0, 41, 7, 26, 18, 94, 1, 1, 11, 54, 1, 2,
+  21, 0, 0, 37, 12, 11, 2, 1, 5, 5, 8, 39, 20, 21, 2, 14,
+  13, 88, 0, 0, 123, 25, 46, 96, 92, 63, 79, 20, 173, 17, 373, 1,
+  31, 110, 23, 9, 133, 2, 24, 19, 105, 30, 27, 94, 15, 0, 206, 82,
+  0, 275,
+};
+static const uint16_t WA_ALPHABET_INDEX_SLOTS[] = {
+  324, 222, 86, 314, 303, 159, 272, 1, 175, 9, 317, 137, 4, 141, 313, 12,
+  64, 22, 67, 185, 121, 140, 151, 111, 82, 131, 338, 132, 50, 206, 158, 84,
+  187, 279, 124, 328, 219, 227, 312, 104, 199, 211, 162, 284, 18, 54, 325, 135,
+  163, 112, 299, 194, 161, 285, 305, 334, 311, 120, 225, 268, 282, 228, 213, 116,
+  286, 139, 37, 90, 235, 167, 109, 193, 327, 246, 300, 0, 150, 125, 172, 315,
+  326, 17, 252, 240, 108, 21, 322, 290, 129, 110, 250, 278, 238, 53, 310, 258,
+  81, 261, 62, 156, 96, 329, 192, 210, 20, 5, 267, 275, 78, 47, 171, 223,
+  27, 107, 26, 288, 183, 10, 72, 57, 119, 128, 319, 271, 293, 134, 45, 7,
+  8, 270, 215, 230, 23, 87, 306, 188, 191, 331, 226, 178, 155, 248, 316, 308,
+  2, 242, 126, 56, 25, 80, 318, 122, 44, 234, 236, 38, 260, 138, 218, 209,
+  59, 168, 203, 133, 200, 336, 196, 297, 63, 149, 241, 74, 30, 36, 189, 92,
+  169, 205, 323, 247, 75, 264, 65, 77, 269, 339, 70, 73, 333, 66, 33, 103,
+  40, 52, 130, 229, 166, 6, 232, 173, 181, 301, 201, 55, 177, 16, 182, 68,
+  195, 35, 289, 217, 14, 216, 180, 253, 117, 115, 165, 174, 49, 224, 113, 277,
+  43, 231, 100, 212, 332, 15, 160, 245, 330, 61, 190, 294, 249, 280, 273, 31,
+  153, 146, 143, 69, 105, 257, 170, 186, 265, 46, 220, 89, 291, 142, 97, 24,
+  341, 340, 144, 335, 214, 179, 93, 11, 197, 321, 95, 266, 304, 221, 148, 42,
+  255, 302, 48, 136, 51, 99, 29, 239, 259, 3, 243, 283, 295, 127, 76, 145,
+  85, 154, 13, 204, 91, 184, 58, 101, 263, 60, 256, 320, 32, 152, 98, 296,
+  198, 274, 114, 164, 147, 157, 244, 292, 208, 19, 79, 94, 233, 176, 337, 118,
+  307, 281, 262, 237, 28, 34, 207, 276, 123, 39, 298, 202, 88, 102, 41, 251,
+  254, 71, 106, 287, 83, 309,
+};
+const wa_mph_table WA_ALPHABET_INDEX = { WA_ALPHABET_INDEX_SEEDS, WA_ALPHABET_INDEX_SLOTS, 114u, 342u };
+
+static const uint16_t WA_ALPHABET_LANGUAGE_INDEX_SEEDS[] = {
+  3, 29, 1, 0, 0, 1, 7, 10, 2, 1, 26, 2, 0, 0, 0, 8,
+  13, 0, 11, 0, 0, 0, 14, 25, 5, 10, 9, 63, 9, 33, 0, 22,
+  17, 0, 15, 25, 6, 83, 38, 45, 54, 1, 77, 10, 16, 32, 16, 12,
+  9, 87, 2, 99, 0, 107, 1, 4, 16, 7, 1, 0, 23, 5, 9, 108,
+  89, 22, 1, 1, 0, 25, 390, 258, 31, 0, 1, 7, 1, 19, 29, 3,
+  139, 111, 201, 81, 60, 166, 4, 149, 151, 3, 25, 1, 260, 37, 0, 2,
+  6, 2, 138, 143, 19, 24, 27, 1, 9, 13, 79,
+};
+static const uint16_t WA_ALPHABET_LANGUAGE_INDEX_SLOTS[] = {
+  162, 276, 310, 281, 117, 286, 68, 57, 218, 211, 186, 184, 10, 6, 112, 193,
+  163, 305, 242, 50, 225, 42, 134, 164, 100, 209, 144, 217, 233, 44, 327, 215,
+  257, 43, 270, 269, 77, 30, 171, 232, 0, 259, 126, 97, 138, 229, 158, 295,
+  282, 148, 150, 231, 2, 261, 235, 151, 114, 82, 220, 170, 284, 234, 111, 52,
+  219, 205, 260, 251, 299, 139, 37, 180, 9, 188, 214, 223, 246, 87, 304, 324,
+  41, 185, 54, 200, 16, 300, 216, 60, 29, 14, 247, 196, 19, 296, 26, 285,
+  202, 48, 123, 190, 245, 222, 335, 274, 176, 332, 334, 195, 79, 136, 47, 89,
+  20, 298, 115, 328, 67, 154, 174, 165, 331, 241, 279, 133, 189, 289, 191, 213,
+  266, 207, 204, 121, 293, 179, 197, 84, 255, 128, 86, 227, 102, 262, 341, 263,
+  35, 301, 322, 153, 267, 275, 181, 303, 63, 272, 109, 157, 155, 323, 308, 31,
+  228, 183, 291, 55, 83, 336, 201, 4, 178, 159, 22, 58, 321, 314, 38, 143,
+  103, 256, 248, 224, 290, 318, 65, 280, 199, 130, 131, 238, 24, 13, 21, 177,
+  64, 108, 62, 46, 12, 75, 152, 167, 160, 32, 172, 149, 146, 27, 166, 34,
+  78, 283, 39, 239, 265, 101, 49, 306, 85, 297, 104, 40, 258, 120, 90, 236,
+  161, 210, 277, 124, 294, 69, 147, 268, 45, 99, 28, 66, 71, 127, 329, 168,
+  91, 17, 36, 288, 105, 237, 340, 7, 330, 141, 95, 249, 61, 81, 287, 271,
+  5, 8, 88, 74, 70, 333, 317, 230, 326, 137, 182, 302, 325, 212, 226, 208,
+  253, 92, 1, 110, 320, 106, 250, 11, 56, 25, 203, 98, 312, 96, 292, 313,
+  73, 311, 273, 3, 243, 175, 264, 129, 316, 173, 221, 244, 107, 307, 319, 93,
+  240, 132, 76, 59, 169, 252, 156, 187, 94, 122, 206, 53, 113, 51, 309, 72,
+  135,
+};
+const wa_mph_table WA_ALPHABET_LANGUAGE_INDEX = { WA_ALPHABET_LANGUAGE_INDEX_SEEDS, WA_ALPHABET_LANGUAGE_INDEX_SLOTS, 107u, 321u };
+
+static const uint16_t WA_FREQUENCY_INDEX_SEEDS[] = {
+  5, 0, 0, 13, 23, 24, 28, 2, 62, 3, 13, 22, 120, 34, 0, 4,
+  1, 4, 29, 0, 1, 124, 0, 11, 45, 77, 1, 76, 50, 0, 15, 28,
+  81, 31, 7, 0, 14, 35, 52, 14, 0, 66, 4, 47, 67, 35, 0, 18,
+  82, 43, 7, 2, 403, 1, 219, 0, 31, 49, 0, 34, 6, 84, 0, 9,
+  1103,
+};
+static const uint16_t WA_FREQUENCY_INDEX_SLOTS[] = {
+  175, 57, 17, 163, 95, 100, 112, 79, 62, 174, 34, 136, 122, 43, 131, 179,
+  75, 3, 183, 115, 154, 172, 107, 66, 32, 140, 86, 42, 109, 120, 88, 39,
+  96, 29, 0, 138, 121, 89, 146, 111, 132, 50, 170, 23, 44, 36, 45, 103,
+  13, 159, 187, 147, 38, 58, 33, 6, 99, 16, 156, 87, 28, 90, 22, 55,
+  10, 151, 47, 68, 185, 106, 189, 137, 37, 73, 141, 92, 77, 2, 145, 143,
+  25, 105, 84, 176, 188, 102, 117, 104, 166, 81, 24, 20, 46, 8, 7, 82,
+  52, 49, 165, 9, 26, 158, 173, 70, 19, 148, 69, 153, 184, 123, 128, 98,
+  4, 181, 21, 129, 12, 35, 93, 125, 60, 30, 114, 161, 27, 80, 134, 113,
+  18, 40, 72, 150, 142, 61, 130, 53, 48, 124, 91, 101, 71, 177, 126, 155,
+  162, 108, 65, 31, 74, 97, 11, 182, 63, 59, 5, 56, 139, 15, 1, 78,
+  83, 152, 127, 118, 144, 54, 85, 116, 169, 168, 119, 178, 67, 110, 135, 41,
+  167, 94, 180, 191, 164, 160, 76, 192, 51, 190, 64, 171, 149, 157, 14, 186,
+  133,
+};
+const wa_mph_table WA_FREQUENCY_INDEX = { WA_FREQUENCY_INDEX_SEEDS, WA_FREQUENCY_INDEX_SLOTS, 65u, 193u };
+
+static const uint16_t WA_KEYBOARD_INDEX_SEEDS[] = {
+  30, 1, 26, 20, 0, 5, 13, 4, 29, 3, 0, 0, 123, 19, 8, 0,
+  9, 1, 33, 11, 6, 5, 59, 0, 4, 37, 8, 55, 14, 0, 0, 10,
+  36, 7, 10, 346, 9, 0, 9, 25, 8, 18, 7, 71, 132, 0, 38, 17,
+  4, 54, 18, 381, 10, 153, 23, 118, 10, 11, 20, 10, 1, 96, 68, 98,
+  0, 0,
+};
+static const uint16_t WA_KEYBOARD_INDEX_SLOTS[] = {
+  160, 99, 156, 107, 63, 146, 41, 136, 172, 114, 186, 168, 80, 97, 26, 104,
+  24, 105, 65, 55, 2, 158, 48, 189, 5, 113, 16, 4, 25, 46, 90, 175,
+  35, 21, 174, 110, 6, 68, 162, 166, 147, 145, 194, 78, 50, 130, 120, 151,
+  191, 86, 53, 89, 64, 137, 22, 132, 125, 109, 188, 27, 193, 67, 100, 178,
+  47, 103, 56, 60, 167, 28, 126, 117, 12, 30, 8, 49, 141, 84, 72, 0,
+  121, 181, 32, 54, 143, 52, 163, 177, 62, 17, 44, 161, 81, 29, 101, 91,
+  42, 133, 37, 128, 111, 135, 176, 182, 108, 18, 184, 171, 75, 71, 92, 187,
+  40, 74, 59, 3, 43, 20, 118, 96, 19, 173, 102, 23, 36, 31, 190, 139,
+  150, 169, 148, 185, 79, 195, 154, 11, 9, 149, 98, 165, 66, 116, 85, 38,
+  159, 142, 88, 15, 119, 33, 73, 124, 57, 129, 95, 192, 164, 45, 170, 94,
+  122, 1, 82, 58, 93, 180, 123, 51, 76, 34, 7, 183, 179, 127, 144, 10,
+  13, 131, 87, 106, 115, 112, 157, 83, 152, 140, 39, 77, 69, 196, 61, 138,
+  153, 70, 14, 155, 134,
+};
+const wa_mph_table WA_KEYBOARD_INDEX = { WA_KEYBOARD_INDEX_SEEDS, WA_KEYBOARD_INDEX_SLOTS, 66u, 197u };
+
@@ -0,0 +1,7301 @@
+#include "worldalphabets_data.h"
+
+const wa_keyboard_mapping LAYOUT_0_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "z" },
+  { 0x1D, "y" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "+" },
+  { 0x2F, "ß" },
+  { 0x30, "´" },
+  { 0x31, "^" },
+  { 0x33, "ü" },
+  { 0x34, "ä" },
+  { 0x35, "ö" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "#" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "<" },
+};
+
+const wa_keyboard_mapping LAYOUT_0_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Z" },
+  { 0x1D, "Y" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "§" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "&" },
+  { 0x24, "/" },
+  { 0x25, "(" },
+  { 0x26, ")" },
+  { 0x27, "=" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "*" },
+  { 0x2F, "?" },
+  { 0x30, "`" },
+  { 0x31, "°" },
+  { 0x33, "Ü" },
+  { 0x34, "Ä" },
+  { 0x35, "Ö" },
+  { 0x36, ";" },
+  { 0x37, ":" },
+  { 0x38, "'" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_0_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Z" },
+  { 0x1D, "Y" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "§" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "&" },
+  { 0x24, "/" },
+  { 0x25, "(" },
+  { 0x26, ")" },
+  { 0x27, "=" },
+  { 0x2E, "*" },
+  { 0x2F, "?" },
+  { 0x33, "Ü" },
+  { 0x34, "Ä" },
+  { 0x35, "Ö" },
+  { 0x36, ";" },
+  { 0x37, ":" },
+  { 0x38, "'" },
+};
+
+const wa_keyboard_mapping LAYOUT_0_LAYER_3_ENTRIES[] = {
+  { 0x08, "€" },
+  { 0x10, "µ" },
+  { 0x14, "@" },
+  { 0x1F, "²" },
+  { 0x20, "³" },
+  { 0x24, "{" },
+  { 0x25, "[" },
+  { 0x26, "]" },
+  { 0x27, "}" },
+  { 0x2E, "~" },
+  { 0x2F, "\\" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_0_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_0_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_0_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_0_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_0_LAYER_2_ENTRIES, 44u,
+  },
+  {
+    "altgr",
+    LAYOUT_0_LAYER_3_ENTRIES, 12u,
+  },
+  {
+    "ctrl",
+    LAYOUT_0_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_1_LAYER_0_ENTRIES[] = {
+  { 0x04, "ش" },
+  { 0x05, "لا" },
+  { 0x06, "ؤ" },
+  { 0x07, "ي" },
+  { 0x08, "ث" },
+  { 0x09, "ب" },
+  { 0x0A, "ل" },
+  { 0x0B, "ا" },
+  { 0x0C, "ه" },
+  { 0x0D, "ت" },
+  { 0x0E, "ن" },
+  { 0x0F, "م" },
+  { 0x10, "ة" },
+  { 0x11, "ى" },
+  { 0x12, "خ" },
+  { 0x13, "ح" },
+  { 0x14, "ض" },
+  { 0x15, "ق" },
+  { 0x16, "س" },
+  { 0x17, "ف" },
+  { 0x18, "ع" },
+  { 0x19, "ر" },
+  { 0x1A, "ص" },
+  { 0x1B, "ء" },
+  { 0x1C, "غ" },
+  { 0x1D, "ئ" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "ج" },
+  { 0x30, "د" },
+  { 0x31, "\\" },
+  { 0x33, "ك" },
+  { 0x34, "ط" },
+  { 0x35, "ذ" },
+  { 0x36, "و" },
+  { 0x37, "ز" },
+  { 0x38, "ظ" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_1_LAYER_1_ENTRIES[] = {
+  { 0x04, "ِ" },
+  { 0x05, "لآ" },
+  { 0x06, "}" },
+  { 0x07, "]" },
+  { 0x08, "ُ" },
+  { 0x09, "[" },
+  { 0x0A, "لأ" },
+  { 0x0B, "أ" },
+  { 0x0C, "÷" },
+  { 0x0D, "ـ" },
+  { 0x0E, "،" },
+  { 0x0F, "/" },
+  { 0x10, "’" },
+  { 0x11, "آ" },
+  { 0x12, "×" },
+  { 0x13, "؛" },
+  { 0x14, "َ" },
+  { 0x15, "ٌ" },
+  { 0x16, "ٍ" },
+  { 0x17, "لإ" },
+  { 0x18, "‘" },
+  { 0x19, "{" },
+  { 0x1A, "ً" },
+  { 0x1B, "ْ" },
+  { 0x1C, "إ" },
+  { 0x1D, "~" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, ")" },
+  { 0x27, "(" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "<" },
+  { 0x30, ">" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "ّ" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "؟" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_1_LAYER_2_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_1_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_1_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_1_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "ctrl",
+    LAYOUT_1_LAYER_2_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_2_LAYER_0_ENTRIES[] = {
+  { 0x04, "ش" },
+  { 0x05, "لا" },
+  { 0x06, "ؤ" },
+  { 0x07, "ي" },
+  { 0x08, "ث" },
+  { 0x09, "ب" },
+  { 0x0A, "ل" },
+  { 0x0B, "ا" },
+  { 0x0C, "ه" },
+  { 0x0D, "ت" },
+  { 0x0E, "ن" },
+  { 0x0F, "م" },
+  { 0x10, "ة" },
+  { 0x11, "ى" },
+  { 0x12, "خ" },
+  { 0x13, "ح" },
+  { 0x14, "ض" },
+  { 0x15, "ق" },
+  { 0x16, "س" },
+  { 0x17, "ف" },
+  { 0x18, "ع" },
+  { 0x19, "ر" },
+  { 0x1A, "ص" },
+  { 0x1B, "ء" },
+  { 0x1C, "غ" },
+  { 0x1D, "ئ" },
+  { 0x1E, "&" },
+  { 0x1F, "é" },
+  { 0x20, "\"" },
+  { 0x21, "'" },
+  { 0x22, "(" },
+  { 0x23, "-" },
+  { 0x24, "è" },
+  { 0x25, "_" },
+  { 0x26, "ç" },
+  { 0x27, "à" },
+  { 0x2C, " " },
+  { 0x2D, ")" },
+  { 0x2E, "=" },
+  { 0x2F, "ج" },
+  { 0x30, "د" },
+  { 0x31, "ذ" },
+  { 0x33, "ك" },
+  { 0x34, "ط" },
+  { 0x35, ">" },
+  { 0x36, "و" },
+  { 0x37, "ز" },
+  { 0x38, "ظ" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_2_LAYER_1_ENTRIES[] = {
+  { 0x04, "\\" },
+  { 0x05, "لآ" },
+  { 0x06, "ِ" },
+  { 0x07, "]" },
+  { 0x08, "ُ" },
+  { 0x09, "[" },
+  { 0x0A, "لأ" },
+  { 0x0B, "أ" },
+  { 0x0C, "÷" },
+  { 0x0D, "ـ" },
+  { 0x0E, "،" },
+  { 0x0F, "/" },
+  { 0x10, "’" },
+  { 0x11, "آ" },
+  { 0x12, "×" },
+  { 0x13, "؛" },
+  { 0x14, "َ" },
+  { 0x15, "ٌ" },
+  { 0x17, "لإ" },
+  { 0x18, "‘" },
+  { 0x19, "ٍ" },
+  { 0x1A, "ً" },
+  { 0x1B, "ْ" },
+  { 0x1C, "إ" },
+  { 0x1D, "~" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "°" },
+  { 0x2E, "+" },
+  { 0x2F, "}" },
+  { 0x30, "{" },
+  { 0x31, "ّ" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "<" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "؟" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_2_LAYER_2_ENTRIES[] = {
+  { 0x06, "ِّ" },
+  { 0x08, "ُّ" },
+  { 0x14, "َّ" },
+  { 0x15, "ٌّ" },
+  { 0x19, "ٍّ" },
+  { 0x1A, "ًّ" },
+  { 0x21, "¤" },
+};
+
+const wa_keyboard_mapping LAYOUT_2_LAYER_3_ENTRIES[] = {
+  { 0x06, "ِّ" },
+  { 0x08, "ُّ" },
+  { 0x14, "َّ" },
+  { 0x15, "ٌّ" },
+  { 0x19, "ٍّ" },
+  { 0x1A, "ًّ" },
+  { 0x21, "¤" },
+};
+
+const wa_keyboard_mapping LAYOUT_2_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_2_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_2_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_2_LAYER_1_ENTRIES, 52u,
+  },
+  {
+    "altgr",
+    LAYOUT_2_LAYER_2_ENTRIES, 7u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_2_LAYER_3_ENTRIES, 7u,
+  },
+  {
+    "ctrl",
+    LAYOUT_2_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_3_LAYER_0_ENTRIES[] = {
+  { 0x04, "ش" },
+  { 0x05, "لا" },
+  { 0x06, "ؤ" },
+  { 0x07, "ي" },
+  { 0x08, "ث" },
+  { 0x09, "ب" },
+  { 0x0A, "ل" },
+  { 0x0B, "ا" },
+  { 0x0C, "ه" },
+  { 0x0D, "ت" },
+  { 0x0E, "ن" },
+  { 0x0F, "م" },
+  { 0x10, "ة" },
+  { 0x11, "ى" },
+  { 0x12, "خ" },
+  { 0x13, "ح" },
+  { 0x14, "ض" },
+  { 0x15, "ق" },
+  { 0x16, "س" },
+  { 0x17, "ف" },
+  { 0x18, "ع" },
+  { 0x19, "ر" },
+  { 0x1A, "ص" },
+  { 0x1B, "ء" },
+  { 0x1C, "غ" },
+  { 0x1D, "ئ" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "ج" },
+  { 0x30, "د" },
+  { 0x31, "ذ" },
+  { 0x33, "ك" },
+  { 0x34, "ط" },
+  { 0x35, ">" },
+  { 0x36, "و" },
+  { 0x37, "ز" },
+  { 0x38, "ظ" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "ـ" },
+};
+
+const wa_keyboard_mapping LAYOUT_3_LAYER_1_ENTRIES[] = {
+  { 0x04, "\\" },
+  { 0x05, "لآ" },
+  { 0x06, "ِ" },
+  { 0x07, "]" },
+  { 0x08, "ُ" },
+  { 0x09, "[" },
+  { 0x0A, "لأ" },
+  { 0x0B, "أ" },
+  { 0x0C, "÷" },
+  { 0x0D, "ـ" },
+  { 0x0E, "،" },
+  { 0x0F, "/" },
+  { 0x10, "’" },
+  { 0x11, "آ" },
+  { 0x12, "×" },
+  { 0x13, "؛" },
+  { 0x14, "َ" },
+  { 0x15, "ٌ" },
+  { 0x17, "لإ" },
+  { 0x18, "‘" },
+  { 0x19, "ٍ" },
+  { 0x1A, "ً" },
+  { 0x1B, "ْ" },
+  { 0x1C, "إ" },
+  { 0x1D, "~" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, ")" },
+  { 0x27, "(" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "}" },
+  { 0x30, "{" },
+  { 0x31, "ّ" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "<" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "؟" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_3_LAYER_2_ENTRIES[] = {
+  { 0x06, "ِّ" },
+  { 0x08, "ُّ" },
+  { 0x14, "َّ" },
+  { 0x15, "ٌّ" },
+  { 0x19, "ٍّ" },
+  { 0x1A, "ًّ" },
+  { 0x21, "¤" },
+};
+
+const wa_keyboard_mapping LAYOUT_3_LAYER_3_ENTRIES[] = {
+  { 0x06, "ِّ" },
+  { 0x08, "ُّ" },
+  { 0x14, "َّ" },
+  { 0x15, "ٌّ" },
+  { 0x19, "ٍّ" },
+  { 0x1A, "ًّ" },
+  { 0x21, "¤" },
+};
+
+const wa_keyboard_mapping LAYOUT_3_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_3_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_3_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_3_LAYER_1_ENTRIES, 52u,
+  },
+  {
+    "altgr",
+    LAYOUT_3_LAYER_2_ENTRIES, 7u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_3_LAYER_3_ENTRIES, 7u,
+  },
+  {
+    "ctrl",
+    LAYOUT_3_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_4_LAYER_0_ENTRIES[] = {
+  { 0x04, "ো" },
+  { 0x05, "ৱ" },
+  { 0x06, "ম" },
+  { 0x07, "্" },
+  { 0x08, "া" },
+  { 0x09, "ি" },
+  { 0x0A, "ু" },
+  { 0x0B, "প" },
+  { 0x0C, "গ" },
+  { 0x0D, "ৰ" },
+  { 0x0E, "ক" },
+  { 0x0F, "ত" },
+  { 0x10, "স" },
+  { 0x11, "ল" },
+  { 0x12, "দ" },
+  { 0x13, "জ" },
+  { 0x14, "ৌ" },
+  { 0x15, "ী" },
+  { 0x16, "ে" },
+  { 0x17, "ূ" },
+  { 0x18, "হ" },
+  { 0x19, "ন" },
+  { 0x1A, "ৈ" },
+  { 0x1B, "ং" },
+  { 0x1C, "ব" },
+  { 0x1E, "১" },
+  { 0x1F, "২" },
+  { 0x20, "৩" },
+  { 0x21, "৪" },
+  { 0x22, "৫" },
+  { 0x23, "৬" },
+  { 0x24, "৭" },
+  { 0x25, "৮" },
+  { 0x26, "৯" },
+  { 0x27, "০" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "ৃ" },
+  { 0x2F, "ড" },
+  { 0x30, "়" },
+  { 0x33, "চ" },
+  { 0x34, "ট" },
+  { 0x35, "॥" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "য়" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_4_LAYER_1_ENTRIES[] = {
+  { 0x04, "ও" },
+  { 0x06, "ণ" },
+  { 0x07, "অ" },
+  { 0x08, "আ" },
+  { 0x09, "ই" },
+  { 0x0A, "উ" },
+  { 0x0B, "ফ" },
+  { 0x0C, "ঘ" },
+  { 0x0E, "খ" },
+  { 0x0F, "থ" },
+  { 0x10, "শ" },
+  { 0x12, "ধ" },
+  { 0x13, "ঝ" },
+  { 0x14, "ঔ" },
+  { 0x15, "ঈ" },
+  { 0x16, "এ" },
+  { 0x17, "ঊ" },
+  { 0x18, "ঙ" },
+  { 0x1A, "ঐ" },
+  { 0x1B, "ঁ" },
+  { 0x1C, "ভ" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "্ৰ" },
+  { 0x21, "ৰ্" },
+  { 0x22, "জ্ঞ" },
+  { 0x23, "ত্ৰ" },
+  { 0x24, "ক্ষ" },
+  { 0x25, "শ্ৰ" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "ঃ" },
+  { 0x2E, "ঋ" },
+  { 0x2F, "ঢ" },
+  { 0x30, "ঞ" },
+  { 0x33, "ছ" },
+  { 0x34, "ঠ" },
+  { 0x36, "ষ" },
+  { 0x37, "।" },
+  { 0x38, "য" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_4_LAYER_2_ENTRIES[] = {
+  { 0x2A, "" },
+};
+
+const wa_keyboard_layer LAYOUT_4_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_4_LAYER_0_ENTRIES, 50u,
+  },
+  {
+    "shift",
+    LAYOUT_4_LAYER_1_ENTRIES, 45u,
+  },
+  {
+    "ctrl",
+    LAYOUT_4_LAYER_2_ENTRIES, 1u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_5_LAYER_0_ENTRIES[] = {
+  { 0x04, "ф" },
+  { 0x05, "и" },
+  { 0x06, "с" },
+  { 0x07, "в" },
+  { 0x08, "у" },
+  { 0x09, "а" },
+  { 0x0A, "п" },
+  { 0x0B, "р" },
+  { 0x0C, "ш" },
+  { 0x0D, "о" },
+  { 0x0E, "л" },
+  { 0x0F, "д" },
+  { 0x10, "ғ" },
+  { 0x11, "т" },
+  { 0x12, "һ" },
+  { 0x13, "з" },
+  { 0x14, "ј" },
+  { 0x15, "к" },
+  { 0x16, "ы" },
+  { 0x17, "е" },
+  { 0x18, "г" },
+  { 0x19, "м" },
+  { 0x1A, "ү" },
+  { 0x1B, "ч" },
+  { 0x1C, "н" },
+  { 0x1D, "ә" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "х" },
+  { 0x30, "ҹ" },
+  { 0x31, "\\" },
+  { 0x33, "ж" },
+  { 0x34, "ҝ" },
+  { 0x35, "`" },
+  { 0x36, "б" },
+  { 0x37, "ө" },
+  { 0x38, "." },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_5_LAYER_1_ENTRIES[] = {
+  { 0x04, "Ф" },
+  { 0x05, "И" },
+  { 0x06, "С" },
+  { 0x07, "В" },
+  { 0x08, "У" },
+  { 0x09, "А" },
+  { 0x0A, "П" },
+  { 0x0B, "Р" },
+  { 0x0C, "Ш" },
+  { 0x0D, "О" },
+  { 0x0E, "Л" },
+  { 0x0F, "Д" },
+  { 0x10, "Ғ" },
+  { 0x11, "Т" },
+  { 0x12, "Һ" },
+  { 0x13, "З" },
+  { 0x14, "Ј" },
+  { 0x15, "К" },
+  { 0x16, "Ы" },
+  { 0x17, "Е" },
+  { 0x18, "Г" },
+  { 0x19, "М" },
+  { 0x1A, "Ү" },
+  { 0x1B, "Ч" },
+  { 0x1C, "Н" },
+  { 0x1D, "Ә" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "№" },
+  { 0x21, ";" },
+  { 0x22, "%" },
+  { 0x23, ":" },
+  { 0x24, "?" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "Х" },
+  { 0x30, "Ҹ" },
+  { 0x31, "/" },
+  { 0x33, "Ж" },
+  { 0x34, "Ҝ" },
+  { 0x35, "~" },
+  { 0x36, "Б" },
+  { 0x37, "Ө" },
+  { 0x38, "," },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_5_LAYER_2_ENTRIES[] = {
+  { 0x04, "Ф" },
+  { 0x05, "И" },
+  { 0x06, "С" },
+  { 0x07, "В" },
+  { 0x08, "У" },
+  { 0x09, "А" },
+  { 0x0A, "П" },
+  { 0x0B, "Р" },
+  { 0x0C, "Ш" },
+  { 0x0D, "О" },
+  { 0x0E, "Л" },
+  { 0x0F, "Д" },
+  { 0x10, "Ғ" },
+  { 0x11, "Т" },
+  { 0x12, "Һ" },
+  { 0x13, "З" },
+  { 0x14, "Ј" },
+  { 0x15, "К" },
+  { 0x16, "Ы" },
+  { 0x17, "Е" },
+  { 0x18, "Г" },
+  { 0x19, "М" },
+  { 0x1A, "Ү" },
+  { 0x1B, "Ч" },
+  { 0x1C, "Н" },
+  { 0x1D, "Ә" },
+  { 0x2F, "Х" },
+  { 0x30, "Ҹ" },
+  { 0x33, "Ж" },
+  { 0x34, "Ҝ" },
+  { 0x36, "Б" },
+  { 0x37, "Ө" },
+};
+
+const wa_keyboard_mapping LAYOUT_5_LAYER_3_ENTRIES[] = {
+  { 0x1F, "@" },
+  { 0x21, "₼" },
+};
+
+const wa_keyboard_mapping LAYOUT_5_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_5_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_5_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_5_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_5_LAYER_2_ENTRIES, 32u,
+  },
+  {
+    "altgr",
+    LAYOUT_5_LAYER_3_ENTRIES, 2u,
+  },
+  {
+    "ctrl",
+    LAYOUT_5_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_6_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "ü" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "ö" },
+  { 0x30, "ğ" },
+  { 0x31, "\\" },
+  { 0x33, "ı" },
+  { 0x34, "ə" },
+  { 0x35, "`" },
+  { 0x36, "ç" },
+  { 0x37, "ş" },
+  { 0x38, "." },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_6_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "İ" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "Ü" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "№" },
+  { 0x21, ";" },
+  { 0x22, "%" },
+  { 0x23, ":" },
+  { 0x24, "?" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "Ö" },
+  { 0x30, "Ğ" },
+  { 0x31, "/" },
+  { 0x33, "I" },
+  { 0x34, "Ə" },
+  { 0x35, "~" },
+  { 0x36, "Ç" },
+  { 0x37, "Ş" },
+  { 0x38, "," },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "/" },
+};
+
+const wa_keyboard_mapping LAYOUT_6_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "İ" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "Ü" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x2F, "Ö" },
+  { 0x30, "Ğ" },
+  { 0x33, "I" },
+  { 0x34, "Ə" },
+  { 0x36, "Ç" },
+  { 0x37, "Ş" },
+};
+
+const wa_keyboard_mapping LAYOUT_6_LAYER_3_ENTRIES[] = {
+  { 0x1F, "@" },
+  { 0x21, "₼" },
+};
+
+const wa_keyboard_mapping LAYOUT_6_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_6_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_6_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_6_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_6_LAYER_2_ENTRIES, 32u,
+  },
+  {
+    "altgr",
+    LAYOUT_6_LAYER_3_ENTRIES, 2u,
+  },
+  {
+    "ctrl",
+    LAYOUT_6_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_7_LAYER_0_ENTRIES[] = {
+  { 0x04, "g" },
+  { 0x05, "k" },
+  { 0x06, "v" },
+  { 0x07, "s" },
+  { 0x08, "ş" },
+  { 0x09, "a" },
+  { 0x0A, "r" },
+  { 0x0B, "n" },
+  { 0x0C, "y" },
+  { 0x0D, "ə" },
+  { 0x0E, "l" },
+  { 0x0F, "i" },
+  { 0x10, "q" },
+  { 0x11, "e" },
+  { 0x12, "o" },
+  { 0x13, "h" },
+  { 0x14, "p" },
+  { 0x15, "u" },
+  { 0x16, "ı" },
+  { 0x17, "d" },
+  { 0x18, "m" },
+  { 0x19, "t" },
+  { 0x1A, "ü" },
+  { 0x1B, "f" },
+  { 0x1C, "b" },
+  { 0x1D, "ç" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "x" },
+  { 0x30, "j" },
+  { 0x33, "c" },
+  { 0x34, "ğ" },
+  { 0x35, "#" },
+  { 0x36, "z" },
+  { 0x37, "ö" },
+  { 0x38, "." },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_7_LAYER_1_ENTRIES[] = {
+  { 0x04, "G" },
+  { 0x05, "K" },
+  { 0x06, "V" },
+  { 0x07, "S" },
+  { 0x08, "Ş" },
+  { 0x09, "A" },
+  { 0x0A, "R" },
+  { 0x0B, "N" },
+  { 0x0C, "Y" },
+  { 0x0D, "Ə" },
+  { 0x0E, "L" },
+  { 0x0F, "İ" },
+  { 0x10, "Q" },
+  { 0x11, "E" },
+  { 0x12, "O" },
+  { 0x13, "H" },
+  { 0x14, "P" },
+  { 0x15, "U" },
+  { 0x16, "I" },
+  { 0x17, "D" },
+  { 0x18, "M" },
+  { 0x19, "T" },
+  { 0x1A, "Ü" },
+  { 0x1B, "F" },
+  { 0x1C, "B" },
+  { 0x1D, "Ç" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "№" },
+  { 0x21, ";" },
+  { 0x22, "%" },
+  { 0x23, ":" },
+  { 0x24, "?" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "X" },
+  { 0x30, "J" },
+  { 0x33, "C" },
+  { 0x34, "Ğ" },
+  { 0x35, "~" },
+  { 0x36, "Z" },
+  { 0x37, "Ö" },
+  { 0x38, "," },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_7_LAYER_2_ENTRIES[] = {
+  { 0x04, "G" },
+  { 0x05, "K" },
+  { 0x06, "V" },
+  { 0x07, "S" },
+  { 0x08, "Ş" },
+  { 0x09, "A" },
+  { 0x0A, "R" },
+  { 0x0B, "N" },
+  { 0x0C, "Y" },
+  { 0x0D, "Ə" },
+  { 0x0E, "L" },
+  { 0x0F, "İ" },
+  { 0x10, "Q" },
+  { 0x11, "E" },
+  { 0x12, "O" },
+  { 0x13, "H" },
+  { 0x14, "P" },
+  { 0x15, "U" },
+  { 0x16, "I" },
+  { 0x17, "D" },
+  { 0x18, "M" },
+  { 0x19, "T" },
+  { 0x1A, "Ü" },
+  { 0x1B, "F" },
+  { 0x1C, "B" },
+  { 0x1D, "Ç" },
+  { 0x2F, "X" },
+  { 0x30, "J" },
+  { 0x33, "C" },
+  { 0x34, "Ğ" },
+  { 0x36, "Z" },
+  { 0x37, "Ö" },
+};
+
+const wa_keyboard_mapping LAYOUT_7_LAYER_3_ENTRIES[] = {
+  { 0x1F, "@" },
+  { 0x21, "₼" },
+};
+
+const wa_keyboard_mapping LAYOUT_7_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+};
+
+const wa_keyboard_layer LAYOUT_7_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_7_LAYER_0_ENTRIES, 51u,
+  },
+  {
+    "shift",
+    LAYOUT_7_LAYER_1_ENTRIES, 51u,
+  },
+  {
+    "caps",
+    LAYOUT_7_LAYER_2_ENTRIES, 32u,
+  },
+  {
+    "altgr",
+    LAYOUT_7_LAYER_3_ENTRIES, 2u,
+  },
+  {
+    "ctrl",
+    LAYOUT_7_LAYER_4_ENTRIES, 1u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_8_LAYER_0_ENTRIES[] = {
+  { 0x04, "ф" },
+  { 0x05, "и" },
+  { 0x06, "с" },
+  { 0x07, "в" },
+  { 0x08, "у" },
+  { 0x09, "а" },
+  { 0x0A, "п" },
+  { 0x0B, "р" },
+  { 0x0C, "ш" },
+  { 0x0D, "о" },
+  { 0x0E, "л" },
+  { 0x0F, "д" },
+  { 0x10, "ь" },
+  { 0x11, "т" },
+  { 0x12, "щ" },
+  { 0x13, "з" },
+  { 0x14, "й" },
+  { 0x15, "к" },
+  { 0x16, "ы" },
+  { 0x17, "е" },
+  { 0x18, "г" },
+  { 0x19, "м" },
+  { 0x1A, "ц" },
+  { 0x1B, "ч" },
+  { 0x1C, "н" },
+  { 0x1D, "я" },
+  { 0x1E, "!" },
+  { 0x1F, "ө" },
+  { 0x20, "ҡ" },
+  { 0x21, "ғ" },
+  { 0x22, "ҫ" },
+  { 0x23, ":" },
+  { 0x24, "ҙ" },
+  { 0x25, "һ" },
+  { 0x26, "?" },
+  { 0x27, "№" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "ү" },
+  { 0x2F, "х" },
+  { 0x30, "ъ" },
+  { 0x31, "ң" },
+  { 0x33, "ж" },
+  { 0x34, "э" },
+  { 0x35, "ә" },
+  { 0x36, "б" },
+  { 0x37, "ю" },
+  { 0x38, "." },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_8_LAYER_1_ENTRIES[] = {
+  { 0x04, "Ф" },
+  { 0x05, "И" },
+  { 0x06, "С" },
+  { 0x07, "В" },
+  { 0x08, "У" },
+  { 0x09, "А" },
+  { 0x0A, "П" },
+  { 0x0B, "Р" },
+  { 0x0C, "Ш" },
+  { 0x0D, "О" },
+  { 0x0E, "Л" },
+  { 0x0F, "Д" },
+  { 0x10, "Ь" },
+  { 0x11, "Т" },
+  { 0x12, "Щ" },
+  { 0x13, "З" },
+  { 0x14, "Й" },
+  { 0x15, "К" },
+  { 0x16, "Ы" },
+  { 0x17, "Е" },
+  { 0x18, "Г" },
+  { 0x19, "М" },
+  { 0x1A, "Ц" },
+  { 0x1B, "Ч" },
+  { 0x1C, "Н" },
+  { 0x1D, "Я" },
+  { 0x1E, "\"" },
+  { 0x1F, "Ө" },
+  { 0x20, "Ҡ" },
+  { 0x21, "Ғ" },
+  { 0x22, "Ҫ" },
+  { 0x23, ";" },
+  { 0x24, "Ҙ" },
+  { 0x25, "Һ" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "%" },
+  { 0x2E, "Ү" },
+  { 0x2F, "Х" },
+  { 0x30, "Ъ" },
+  { 0x31, "Ң" },
+  { 0x33, "Ж" },
+  { 0x34, "Э" },
+  { 0x35, "Ә" },
+  { 0x36, "Б" },
+  { 0x37, "Ю" },
+  { 0x38, "," },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_8_LAYER_2_ENTRIES[] = {
+  { 0x04, "Ф" },
+  { 0x05, "И" },
+  { 0x06, "С" },
+  { 0x07, "В" },
+  { 0x08, "У" },
+  { 0x09, "А" },
+  { 0x0A, "П" },
+  { 0x0B, "Р" },
+  { 0x0C, "Ш" },
+  { 0x0D, "О" },
+  { 0x0E, "Л" },
+  { 0x0F, "Д" },
+  { 0x10, "Ь" },
+  { 0x11, "Т" },
+  { 0x12, "Щ" },
+  { 0x13, "З" },
+  { 0x14, "Й" },
+  { 0x15, "К" },
+  { 0x16, "Ы" },
+  { 0x17, "Е" },
+  { 0x18, "Г" },
+  { 0x19, "М" },
+  { 0x1A, "Ц" },
+  { 0x1B, "Ч" },
+  { 0x1C, "Н" },
+  { 0x1D, "Я" },
+  { 0x1F, "Ө" },
+  { 0x20, "Ҡ" },
+  { 0x21, "Ғ" },
+  { 0x22, "Ҫ" },
+  { 0x24, "Ҙ" },
+  { 0x25, "Һ" },
+  { 0x2E, "Ү" },
+  { 0x2F, "Х" },
+  { 0x30, "Ъ" },
+  { 0x31, "Ң" },
+  { 0x33, "Ж" },
+  { 0x34, "Э" },
+  { 0x35, "Ә" },
+  { 0x36, "Б" },
+  { 0x37, "Ю" },
+};
+
+const wa_keyboard_mapping LAYOUT_8_LAYER_3_ENTRIES[] = {
+  { 0x25, "₽" },
+};
+
+const wa_keyboard_mapping LAYOUT_8_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_8_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_8_LAYER_0_ENTRIES, 52u,
+  },
+  {
+    "shift",
+    LAYOUT_8_LAYER_1_ENTRIES, 52u,
+  },
+  {
+    "caps",
+    LAYOUT_8_LAYER_2_ENTRIES, 41u,
+  },
+  {
+    "altgr",
+    LAYOUT_8_LAYER_3_ENTRIES, 1u,
+  },
+  {
+    "ctrl",
+    LAYOUT_8_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_9_LAYER_0_ENTRIES[] = {
+  { 0x04, "ф" },
+  { 0x05, "і" },
+  { 0x06, "с" },
+  { 0x07, "в" },
+  { 0x08, "у" },
+  { 0x09, "а" },
+  { 0x0A, "п" },
+  { 0x0B, "р" },
+  { 0x0C, "ш" },
+  { 0x0D, "о" },
+  { 0x0E, "л" },
+  { 0x0F, "д" },
+  { 0x10, "ь" },
+  { 0x11, "т" },
+  { 0x12, "ў" },
+  { 0x13, "з" },
+  { 0x14, "й" },
+  { 0x15, "к" },
+  { 0x16, "ы" },
+  { 0x17, "е" },
+  { 0x18, "г" },
+  { 0x19, "м" },
+  { 0x1A, "ц" },
+  { 0x1B, "ч" },
+  { 0x1C, "н" },
+  { 0x1D, "я" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "х" },
+  { 0x30, "'" },
+  { 0x31, "\\" },
+  { 0x33, "ж" },
+  { 0x34, "э" },
+  { 0x35, "ё" },
+  { 0x36, "б" },
+  { 0x37, "ю" },
+  { 0x38, "." },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_9_LAYER_1_ENTRIES[] = {
+  { 0x04, "Ф" },
+  { 0x05, "І" },
+  { 0x06, "С" },
+  { 0x07, "В" },
+  { 0x08, "У" },
+  { 0x09, "А" },
+  { 0x0A, "П" },
+  { 0x0B, "Р" },
+  { 0x0C, "Ш" },
+  { 0x0D, "О" },
+  { 0x0E, "Л" },
+  { 0x0F, "Д" },
+  { 0x10, "Ь" },
+  { 0x11, "Т" },
+  { 0x12, "Ў" },
+  { 0x13, "З" },
+  { 0x14, "Й" },
+  { 0x15, "К" },
+  { 0x16, "Ы" },
+  { 0x17, "Е" },
+  { 0x18, "Г" },
+  { 0x19, "М" },
+  { 0x1A, "Ц" },
+  { 0x1B, "Ч" },
+  { 0x1C, "Н" },
+  { 0x1D, "Я" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "№" },
+  { 0x21, ";" },
+  { 0x22, "%" },
+  { 0x23, ":" },
+  { 0x24, "?" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "Х" },
+  { 0x30, "'" },
+  { 0x31, "/" },
+  { 0x33, "Ж" },
+  { 0x34, "Э" },
+  { 0x35, "Ё" },
+  { 0x36, "Б" },
+  { 0x37, "Ю" },
+  { 0x38, "," },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "/" },
+};
+
+const wa_keyboard_mapping LAYOUT_9_LAYER_2_ENTRIES[] = {
+  { 0x04, "Ф" },
+  { 0x05, "І" },
+  { 0x06, "С" },
+  { 0x07, "В" },
+  { 0x08, "У" },
+  { 0x09, "А" },
+  { 0x0A, "П" },
+  { 0x0B, "Р" },
+  { 0x0C, "Ш" },
+  { 0x0D, "О" },
+  { 0x0E, "Л" },
+  { 0x0F, "Д" },
+  { 0x10, "Ь" },
+  { 0x11, "Т" },
+  { 0x12, "Ў" },
+  { 0x13, "З" },
+  { 0x14, "Й" },
+  { 0x15, "К" },
+  { 0x16, "Ы" },
+  { 0x17, "Е" },
+  { 0x18, "Г" },
+  { 0x19, "М" },
+  { 0x1A, "Ц" },
+  { 0x1B, "Ч" },
+  { 0x1C, "Н" },
+  { 0x1D, "Я" },
+  { 0x2F, "Х" },
+  { 0x30, "'" },
+  { 0x33, "Ж" },
+  { 0x34, "Э" },
+  { 0x35, "Ё" },
+  { 0x36, "Б" },
+  { 0x37, "Ю" },
+};
+
+const wa_keyboard_mapping LAYOUT_9_LAYER_3_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_9_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_9_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_9_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_9_LAYER_2_ENTRIES, 33u,
+  },
+  {
+    "ctrl",
+    LAYOUT_9_LAYER_3_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_10_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x35, "`" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_10_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_10_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+};
+
+const wa_keyboard_mapping LAYOUT_10_LAYER_3_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_10_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_10_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_10_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_10_LAYER_2_ENTRIES, 26u,
+  },
+  {
+    "ctrl",
+    LAYOUT_10_LAYER_3_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_11_LAYER_0_ENTRIES[] = {
+  { 0x04, "а" },
+  { 0x05, "б" },
+  { 0x06, "ц" },
+  { 0x07, "д" },
+  { 0x08, "е" },
+  { 0x09, "ф" },
+  { 0x0A, "г" },
+  { 0x0B, "х" },
+  { 0x0C, "и" },
+  { 0x0D, "й" },
+  { 0x0E, "к" },
+  { 0x0F, "л" },
+  { 0x10, "м" },
+  { 0x11, "н" },
+  { 0x12, "о" },
+  { 0x13, "п" },
+  { 0x14, "я" },
+  { 0x15, "р" },
+  { 0x16, "с" },
+  { 0x17, "т" },
+  { 0x18, "у" },
+  { 0x19, "ж" },
+  { 0x1A, "в" },
+  { 0x1B, "ь" },
+  { 0x1C, "ъ" },
+  { 0x1D, "з" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "ш" },
+  { 0x30, "щ" },
+  { 0x31, "ю" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x35, "ч" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "ю" },
+};
+
+const wa_keyboard_mapping LAYOUT_11_LAYER_1_ENTRIES[] = {
+  { 0x04, "А" },
+  { 0x05, "Б" },
+  { 0x06, "Ц" },
+  { 0x07, "Д" },
+  { 0x08, "Е" },
+  { 0x09, "Ф" },
+  { 0x0A, "Г" },
+  { 0x0B, "Х" },
+  { 0x0C, "И" },
+  { 0x0D, "Й" },
+  { 0x0E, "К" },
+  { 0x0F, "Л" },
+  { 0x10, "М" },
+  { 0x11, "Н" },
+  { 0x12, "О" },
+  { 0x13, "П" },
+  { 0x14, "Я" },
+  { 0x15, "Р" },
+  { 0x16, "С" },
+  { 0x17, "Т" },
+  { 0x18, "У" },
+  { 0x19, "Ж" },
+  { 0x1A, "В" },
+  { 0x1B, "ѝ" },
+  { 0x1C, "Ъ" },
+  { 0x1D, "З" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "№" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "€" },
+  { 0x24, "§" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "Ш" },
+  { 0x30, "Щ" },
+  { 0x31, "Ю" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "Ч" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "Ю" },
+};
+
+const wa_keyboard_mapping LAYOUT_11_LAYER_2_ENTRIES[] = {
+  { 0x04, "А" },
+  { 0x05, "Б" },
+  { 0x06, "Ц" },
+  { 0x07, "Д" },
+  { 0x08, "Е" },
+  { 0x09, "Ф" },
+  { 0x0A, "Г" },
+  { 0x0B, "Х" },
+  { 0x0C, "И" },
+  { 0x0D, "Й" },
+  { 0x0E, "К" },
+  { 0x0F, "Л" },
+  { 0x10, "М" },
+  { 0x11, "Н" },
+  { 0x12, "О" },
+  { 0x13, "П" },
+  { 0x14, "Я" },
+  { 0x15, "Р" },
+  { 0x16, "С" },
+  { 0x17, "Т" },
+  { 0x18, "У" },
+  { 0x19, "Ж" },
+  { 0x1A, "В" },
+  { 0x1B, "Ь" },
+  { 0x1C, "Ъ" },
+  { 0x1D, "З" },
+  { 0x2F, "Ш" },
+  { 0x30, "Щ" },
+  { 0x31, "Ю" },
+  { 0x35, "Ч" },
+  { 0x64, "Ю" },
+};
+
+const wa_keyboard_mapping LAYOUT_11_LAYER_3_ENTRIES[] = {
+  { 0x2F, "Ы" },
+  { 0x30, "Э" },
+};
+
+const wa_keyboard_mapping LAYOUT_11_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+};
+
+const wa_keyboard_layer LAYOUT_11_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_11_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_11_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_11_LAYER_2_ENTRIES, 31u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_11_LAYER_3_ENTRIES, 2u,
+  },
+  {
+    "ctrl",
+    LAYOUT_11_LAYER_4_ENTRIES, 1u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_12_LAYER_0_ENTRIES[] = {
+  { 0x04, "а" },
+  { 0x05, "б" },
+  { 0x06, "ц" },
+  { 0x07, "д" },
+  { 0x08, "е" },
+  { 0x09, "ф" },
+  { 0x0A, "г" },
+  { 0x0B, "х" },
+  { 0x0C, "и" },
+  { 0x0D, "й" },
+  { 0x0E, "к" },
+  { 0x0F, "л" },
+  { 0x10, "м" },
+  { 0x11, "н" },
+  { 0x12, "о" },
+  { 0x13, "п" },
+  { 0x14, "ч" },
+  { 0x15, "р" },
+  { 0x16, "с" },
+  { 0x17, "т" },
+  { 0x18, "у" },
+  { 0x19, "в" },
+  { 0x1A, "ш" },
+  { 0x1B, "ж" },
+  { 0x1C, "ъ" },
+  { 0x1D, "з" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "я" },
+  { 0x30, "щ" },
+  { 0x31, "ь" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x35, "ю" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "ѝ" },
+};
+
+const wa_keyboard_mapping LAYOUT_12_LAYER_1_ENTRIES[] = {
+  { 0x04, "А" },
+  { 0x05, "Б" },
+  { 0x06, "Ц" },
+  { 0x07, "Д" },
+  { 0x08, "Е" },
+  { 0x09, "Ф" },
+  { 0x0A, "Г" },
+  { 0x0B, "Х" },
+  { 0x0C, "И" },
+  { 0x0D, "Й" },
+  { 0x0E, "К" },
+  { 0x0F, "Л" },
+  { 0x10, "М" },
+  { 0x11, "Н" },
+  { 0x12, "О" },
+  { 0x13, "П" },
+  { 0x14, "Ч" },
+  { 0x15, "Р" },
+  { 0x16, "С" },
+  { 0x17, "Т" },
+  { 0x18, "У" },
+  { 0x19, "В" },
+  { 0x1A, "Ш" },
+  { 0x1B, "Ж" },
+  { 0x1C, "Ъ" },
+  { 0x1D, "З" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "№" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "€" },
+  { 0x24, "§" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "–" },
+  { 0x2E, "+" },
+  { 0x2F, "Я" },
+  { 0x30, "Щ" },
+  { 0x31, "ѝ" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "Ю" },
+  { 0x36, "„" },
+  { 0x37, "“" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "Ѝ" },
+};
+
+const wa_keyboard_mapping LAYOUT_12_LAYER_2_ENTRIES[] = {
+  { 0x04, "А" },
+  { 0x05, "Б" },
+  { 0x06, "Ц" },
+  { 0x07, "Д" },
+  { 0x08, "Е" },
+  { 0x09, "Ф" },
+  { 0x0A, "Г" },
+  { 0x0B, "Х" },
+  { 0x0C, "И" },
+  { 0x0D, "Й" },
+  { 0x0E, "К" },
+  { 0x0F, "Л" },
+  { 0x10, "М" },
+  { 0x11, "Н" },
+  { 0x12, "О" },
+  { 0x13, "П" },
+  { 0x14, "Ч" },
+  { 0x15, "Р" },
+  { 0x16, "С" },
+  { 0x17, "Т" },
+  { 0x18, "У" },
+  { 0x19, "В" },
+  { 0x1A, "Ш" },
+  { 0x1B, "Ж" },
+  { 0x1C, "Ъ" },
+  { 0x1D, "З" },
+  { 0x2F, "Я" },
+  { 0x30, "Щ" },
+  { 0x31, "Ь" },
+  { 0x35, "Ю" },
+  { 0x64, "Ѝ" },
+};
+
+const wa_keyboard_mapping LAYOUT_12_LAYER_3_ENTRIES[] = {
+  { 0x2A, "" },
+};
+
+const wa_keyboard_layer LAYOUT_12_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_12_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_12_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_12_LAYER_2_ENTRIES, 31u,
+  },
+  {
+    "ctrl",
+    LAYOUT_12_LAYER_3_ENTRIES, 1u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_13_LAYER_0_ENTRIES[] = {
+  { 0x04, "ь" },
+  { 0x05, "ф" },
+  { 0x06, "ъ" },
+  { 0x07, "а" },
+  { 0x08, "е" },
+  { 0x09, "о" },
+  { 0x0A, "ж" },
+  { 0x0B, "г" },
+  { 0x0C, "с" },
+  { 0x0D, "т" },
+  { 0x0E, "н" },
+  { 0x0F, "в" },
+  { 0x10, "п" },
+  { 0x11, "х" },
+  { 0x12, "д" },
+  { 0x13, "з" },
+  { 0x14, "," },
+  { 0x15, "и" },
+  { 0x16, "я" },
+  { 0x17, "ш" },
+  { 0x18, "к" },
+  { 0x19, "э" },
+  { 0x1A, "у" },
+  { 0x1B, "й" },
+  { 0x1C, "щ" },
+  { 0x1D, "ю" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "." },
+  { 0x2F, "ц" },
+  { 0x30, ";" },
+  { 0x31, "(" },
+  { 0x33, "м" },
+  { 0x34, "ч" },
+  { 0x35, "`" },
+  { 0x36, "р" },
+  { 0x37, "л" },
+  { 0x38, "б" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_13_LAYER_1_ENTRIES[] = {
+  { 0x04, "Ь" },
+  { 0x05, "Ф" },
+  { 0x06, "Ъ" },
+  { 0x07, "А" },
+  { 0x08, "Е" },
+  { 0x09, "О" },
+  { 0x0A, "Ж" },
+  { 0x0B, "Г" },
+  { 0x0C, "С" },
+  { 0x0D, "Т" },
+  { 0x0E, "Н" },
+  { 0x0F, "В" },
+  { 0x10, "П" },
+  { 0x11, "Х" },
+  { 0x12, "Д" },
+  { 0x13, "З" },
+  { 0x14, "ы" },
+  { 0x15, "И" },
+  { 0x16, "Я" },
+  { 0x17, "Ш" },
+  { 0x18, "К" },
+  { 0x19, "Э" },
+  { 0x1A, "У" },
+  { 0x1B, "Й" },
+  { 0x1C, "Щ" },
+  { 0x1D, "Ю" },
+  { 0x1E, "!" },
+  { 0x1F, "?" },
+  { 0x20, "+" },
+  { 0x21, "\"" },
+  { 0x22, "%" },
+  { 0x23, "=" },
+  { 0x24, ":" },
+  { 0x25, "/" },
+  { 0x26, "_" },
+  { 0x27, "№" },
+  { 0x2C, " " },
+  { 0x2D, "І" },
+  { 0x2E, "V" },
+  { 0x2F, "Ц" },
+  { 0x30, "§" },
+  { 0x31, ")" },
+  { 0x33, "М" },
+  { 0x34, "Ч" },
+  { 0x35, "~" },
+  { 0x36, "Р" },
+  { 0x37, "Л" },
+  { 0x38, "Б" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_13_LAYER_2_ENTRIES[] = {
+  { 0x04, "Ь" },
+  { 0x05, "Ф" },
+  { 0x06, "Ъ" },
+  { 0x07, "А" },
+  { 0x08, "Е" },
+  { 0x09, "О" },
+  { 0x0A, "Ж" },
+  { 0x0B, "Г" },
+  { 0x0C, "С" },
+  { 0x0D, "Т" },
+  { 0x0E, "Н" },
+  { 0x0F, "В" },
+  { 0x10, "П" },
+  { 0x11, "Х" },
+  { 0x12, "Д" },
+  { 0x13, "З" },
+  { 0x15, "И" },
+  { 0x16, "Я" },
+  { 0x17, "Ш" },
+  { 0x18, "К" },
+  { 0x19, "Э" },
+  { 0x1A, "У" },
+  { 0x1B, "Й" },
+  { 0x1C, "Щ" },
+  { 0x1D, "Ю" },
+  { 0x2F, "Ц" },
+  { 0x33, "М" },
+  { 0x34, "Ч" },
+  { 0x36, "Р" },
+  { 0x37, "Л" },
+  { 0x38, "Б" },
+};
+
+const wa_keyboard_mapping LAYOUT_13_LAYER_3_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_13_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_13_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_13_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_13_LAYER_2_ENTRIES, 31u,
+  },
+  {
+    "ctrl",
+    LAYOUT_13_LAYER_3_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_14_LAYER_0_ENTRIES[] = {
+  { 0x04, "ь" },
+  { 0x05, "ф" },
+  { 0x06, "ъ" },
+  { 0x07, "а" },
+  { 0x08, "е" },
+  { 0x09, "о" },
+  { 0x0A, "ж" },
+  { 0x0B, "г" },
+  { 0x0C, "с" },
+  { 0x0D, "т" },
+  { 0x0E, "н" },
+  { 0x0F, "в" },
+  { 0x10, "п" },
+  { 0x11, "х" },
+  { 0x12, "д" },
+  { 0x13, "з" },
+  { 0x14, "," },
+  { 0x15, "и" },
+  { 0x16, "я" },
+  { 0x17, "ш" },
+  { 0x18, "к" },
+  { 0x19, "э" },
+  { 0x1A, "у" },
+  { 0x1B, "й" },
+  { 0x1C, "щ" },
+  { 0x1D, "ю" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "." },
+  { 0x2F, "ц" },
+  { 0x30, ";" },
+  { 0x31, "„" },
+  { 0x33, "м" },
+  { 0x34, "ч" },
+  { 0x35, "(" },
+  { 0x36, "р" },
+  { 0x37, "л" },
+  { 0x38, "б" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "ѝ" },
+};
+
+const wa_keyboard_mapping LAYOUT_14_LAYER_1_ENTRIES[] = {
+  { 0x04, "ѝ" },
+  { 0x05, "Ф" },
+  { 0x06, "Ъ" },
+  { 0x07, "А" },
+  { 0x08, "Е" },
+  { 0x09, "О" },
+  { 0x0A, "Ж" },
+  { 0x0B, "Г" },
+  { 0x0C, "С" },
+  { 0x0D, "Т" },
+  { 0x0E, "Н" },
+  { 0x0F, "В" },
+  { 0x10, "П" },
+  { 0x11, "Х" },
+  { 0x12, "Д" },
+  { 0x13, "З" },
+  { 0x14, "ы" },
+  { 0x15, "И" },
+  { 0x16, "Я" },
+  { 0x17, "Ш" },
+  { 0x18, "К" },
+  { 0x19, "Э" },
+  { 0x1A, "У" },
+  { 0x1B, "Й" },
+  { 0x1C, "Щ" },
+  { 0x1D, "Ю" },
+  { 0x1E, "!" },
+  { 0x1F, "?" },
+  { 0x20, "+" },
+  { 0x21, "\"" },
+  { 0x22, "%" },
+  { 0x23, "=" },
+  { 0x24, ":" },
+  { 0x25, "/" },
+  { 0x26, "–" },
+  { 0x27, "№" },
+  { 0x2C, " " },
+  { 0x2D, "$" },
+  { 0x2E, "€" },
+  { 0x2F, "Ц" },
+  { 0x30, "§" },
+  { 0x31, "“" },
+  { 0x33, "М" },
+  { 0x34, "Ч" },
+  { 0x35, ")" },
+  { 0x36, "Р" },
+  { 0x37, "Л" },
+  { 0x38, "Б" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "Ѝ" },
+};
+
+const wa_keyboard_mapping LAYOUT_14_LAYER_2_ENTRIES[] = {
+  { 0x04, "Ь" },
+  { 0x05, "Ф" },
+  { 0x06, "Ъ" },
+  { 0x07, "А" },
+  { 0x08, "Е" },
+  { 0x09, "О" },
+  { 0x0A, "Ж" },
+  { 0x0B, "Г" },
+  { 0x0C, "С" },
+  { 0x0D, "Т" },
+  { 0x0E, "Н" },
+  { 0x0F, "В" },
+  { 0x10, "П" },
+  { 0x11, "Х" },
+  { 0x12, "Д" },
+  { 0x13, "З" },
+  { 0x14, "," },
+  { 0x15, "И" },
+  { 0x16, "Я" },
+  { 0x17, "Ш" },
+  { 0x18, "К" },
+  { 0x19, "Э" },
+  { 0x1A, "У" },
+  { 0x1B, "Й" },
+  { 0x1C, "Щ" },
+  { 0x1D, "Ю" },
+  { 0x2F, "Ц" },
+  { 0x33, "М" },
+  { 0x34, "Ч" },
+  { 0x36, "Р" },
+  { 0x37, "Л" },
+  { 0x38, "Б" },
+  { 0x64, "Ѝ" },
+};
+
+const wa_keyboard_mapping LAYOUT_14_LAYER_3_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_14_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_14_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_14_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_14_LAYER_2_ENTRIES, 33u,
+  },
+  {
+    "ctrl",
+    LAYOUT_14_LAYER_3_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_15_LAYER_0_ENTRIES[] = {
+  { 0x04, "ো" },
+  { 0x05, "ব" },
+  { 0x06, "ম" },
+  { 0x07, "্" },
+  { 0x08, "া" },
+  { 0x09, "ি" },
+  { 0x0A, "ু" },
+  { 0x0B, "প" },
+  { 0x0C, "গ" },
+  { 0x0D, "র" },
+  { 0x0E, "ক" },
+  { 0x0F, "ত" },
+  { 0x10, "স" },
+  { 0x11, "ল" },
+  { 0x12, "দ" },
+  { 0x13, "জ" },
+  { 0x14, "ৌ" },
+  { 0x15, "ী" },
+  { 0x16, "ে" },
+  { 0x17, "ূ" },
+  { 0x18, "হ" },
+  { 0x19, "ন" },
+  { 0x1A, "ৈ" },
+  { 0x1B, "ং" },
+  { 0x1C, "ব" },
+  { 0x1E, "১" },
+  { 0x1F, "২" },
+  { 0x20, "৩" },
+  { 0x21, "৪" },
+  { 0x22, "৫" },
+  { 0x23, "৬" },
+  { 0x24, "৭" },
+  { 0x25, "৮" },
+  { 0x26, "৯" },
+  { 0x27, "০" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "ৃ" },
+  { 0x2F, "ড" },
+  { 0x30, "়" },
+  { 0x33, "চ" },
+  { 0x34, "ট" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "য়" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_15_LAYER_1_ENTRIES[] = {
+  { 0x04, "ও" },
+  { 0x06, "ণ" },
+  { 0x07, "অ" },
+  { 0x08, "আ" },
+  { 0x09, "ই" },
+  { 0x0A, "উ" },
+  { 0x0B, "ফ" },
+  { 0x0C, "ঘ" },
+  { 0x0E, "খ" },
+  { 0x0F, "থ" },
+  { 0x10, "শ" },
+  { 0x12, "ধ" },
+  { 0x13, "ঝ" },
+  { 0x14, "ঔ" },
+  { 0x15, "ঈ" },
+  { 0x16, "এ" },
+  { 0x17, "ঊ" },
+  { 0x18, "ঙ" },
+  { 0x1A, "ঐ" },
+  { 0x1B, "ঁ" },
+  { 0x1C, "ভ" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x21, "র্" },
+  { 0x22, "জ্ঞ" },
+  { 0x23, "ত্র" },
+  { 0x24, "ক্ষ" },
+  { 0x25, "শ্র" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "ঃ" },
+  { 0x2E, "ঋ" },
+  { 0x2F, "ঢ" },
+  { 0x30, "ঞ" },
+  { 0x33, "ছ" },
+  { 0x34, "ঠ" },
+  { 0x36, "ষ" },
+  { 0x38, "য" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_15_LAYER_2_ENTRIES[] = {
+  { 0x2A, "" },
+};
+
+const wa_keyboard_layer LAYOUT_15_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_15_LAYER_0_ENTRIES, 49u,
+  },
+  {
+    "shift",
+    LAYOUT_15_LAYER_1_ENTRIES, 43u,
+  },
+  {
+    "ctrl",
+    LAYOUT_15_LAYER_2_ENTRIES, 1u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_16_LAYER_0_ENTRIES[] = {
+  { 0x04, "ো" },
+  { 0x05, "ব" },
+  { 0x06, "ম" },
+  { 0x07, "্" },
+  { 0x08, "া" },
+  { 0x09, "ি" },
+  { 0x0A, "ু" },
+  { 0x0B, "প" },
+  { 0x0C, "গ" },
+  { 0x0D, "র" },
+  { 0x0E, "ক" },
+  { 0x0F, "ত" },
+  { 0x10, "স" },
+  { 0x11, "ল" },
+  { 0x12, "দ" },
+  { 0x13, "জ" },
+  { 0x14, "ৌ" },
+  { 0x15, "ী" },
+  { 0x16, "ে" },
+  { 0x17, "ূ" },
+  { 0x18, "হ" },
+  { 0x19, "ন" },
+  { 0x1A, "ৈ" },
+  { 0x1B, "ং" },
+  { 0x1C, "ব" },
+  { 0x1E, "১" },
+  { 0x1F, "২" },
+  { 0x20, "৩" },
+  { 0x21, "৪" },
+  { 0x22, "৫" },
+  { 0x23, "৬" },
+  { 0x24, "৭" },
+  { 0x25, "৮" },
+  { 0x26, "৯" },
+  { 0x27, "০" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "ৃ" },
+  { 0x2F, "ড" },
+  { 0x30, "়" },
+  { 0x33, "চ" },
+  { 0x34, "ট" },
+  { 0x35, "॥" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "য়" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_16_LAYER_1_ENTRIES[] = {
+  { 0x04, "ও" },
+  { 0x06, "ণ" },
+  { 0x07, "অ" },
+  { 0x08, "আ" },
+  { 0x09, "ই" },
+  { 0x0A, "উ" },
+  { 0x0B, "ফ" },
+  { 0x0C, "ঘ" },
+  { 0x0D, "ৎ" },
+  { 0x0E, "খ" },
+  { 0x0F, "থ" },
+  { 0x10, "শ" },
+  { 0x12, "ধ" },
+  { 0x13, "ঝ" },
+  { 0x14, "ঔ" },
+  { 0x15, "ঈ" },
+  { 0x16, "এ" },
+  { 0x17, "ঊ" },
+  { 0x18, "ঙ" },
+  { 0x1A, "ঐ" },
+  { 0x1B, "ঁ" },
+  { 0x1C, "ভ" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "্র" },
+  { 0x21, "র্" },
+  { 0x22, "জ্ঞ" },
+  { 0x23, "ত্র" },
+  { 0x24, "ক্ষ" },
+  { 0x25, "শ্র" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "ঃ" },
+  { 0x2E, "ঋ" },
+  { 0x2F, "ঢ" },
+  { 0x30, "ঞ" },
+  { 0x33, "ছ" },
+  { 0x34, "ঠ" },
+  { 0x35, "অ্যা" },
+  { 0x36, "ষ" },
+  { 0x37, "।" },
+  { 0x38, "য" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_16_LAYER_2_ENTRIES[] = {
+  { 0x2A, "" },
+};
+
+const wa_keyboard_layer LAYOUT_16_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_16_LAYER_0_ENTRIES, 50u,
+  },
+  {
+    "shift",
+    LAYOUT_16_LAYER_1_ENTRIES, 47u,
+  },
+  {
+    "ctrl",
+    LAYOUT_16_LAYER_2_ENTRIES, 1u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_17_LAYER_0_ENTRIES[] = {
+  { 0x04, "ো" },
+  { 0x05, "ব" },
+  { 0x06, "ম" },
+  { 0x07, "্" },
+  { 0x08, "া" },
+  { 0x09, "ি" },
+  { 0x0A, "ু" },
+  { 0x0B, "প" },
+  { 0x0C, "গ" },
+  { 0x0D, "র" },
+  { 0x0E, "ক" },
+  { 0x0F, "ত" },
+  { 0x10, "স" },
+  { 0x11, "ল" },
+  { 0x12, "দ" },
+  { 0x13, "জ" },
+  { 0x14, "ৌ" },
+  { 0x15, "ী" },
+  { 0x16, "ে" },
+  { 0x17, "ূ" },
+  { 0x18, "হ" },
+  { 0x19, "ন" },
+  { 0x1A, "ৈ" },
+  { 0x1B, "ং" },
+  { 0x1C, "ব" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "ৃ" },
+  { 0x2F, "ড" },
+  { 0x30, "়" },
+  { 0x33, "চ" },
+  { 0x34, "ট" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "য" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_17_LAYER_1_ENTRIES[] = {
+  { 0x04, "ও" },
+  { 0x06, "ণ" },
+  { 0x07, "অ" },
+  { 0x08, "আ" },
+  { 0x09, "ই" },
+  { 0x0A, "উ" },
+  { 0x0B, "ফ" },
+  { 0x0C, "ঘ" },
+  { 0x0E, "খ" },
+  { 0x0F, "থ" },
+  { 0x10, "শ" },
+  { 0x12, "ধ" },
+  { 0x13, "ঝ" },
+  { 0x14, "ঔ" },
+  { 0x15, "ঈ" },
+  { 0x16, "এ" },
+  { 0x17, "ঊ" },
+  { 0x18, "ঙ" },
+  { 0x1A, "ঐ" },
+  { 0x1B, "ঁ" },
+  { 0x1C, "ভ" },
+  { 0x1E, "অ্যা" },
+  { 0x20, "্র" },
+  { 0x21, "র্" },
+  { 0x22, "জ্র" },
+  { 0x23, "ত্ষ" },
+  { 0x24, "ক্র" },
+  { 0x25, "শ্র" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "ঃ" },
+  { 0x2E, "ঋ" },
+  { 0x2F, "ঢ" },
+  { 0x30, "ঞ" },
+  { 0x33, "ছ" },
+  { 0x34, "ঠ" },
+  { 0x36, "ষ" },
+  { 0x37, "{" },
+  { 0x38, "য়" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_17_LAYER_2_ENTRIES[] = {
+  { 0x04, "৴" },
+  { 0x07, "৸" },
+  { 0x09, "ৢ" },
+  { 0x0C, "ৎ" },
+  { 0x0D, "ৰ" },
+  { 0x14, "ৗ" },
+  { 0x15, "ৣ" },
+  { 0x16, "৶" },
+  { 0x1B, "৺" },
+  { 0x1E, "১" },
+  { 0x1F, "২" },
+  { 0x20, "৩" },
+  { 0x21, "৪" },
+  { 0x22, "৫" },
+  { 0x23, "৬" },
+  { 0x24, "৭" },
+  { 0x25, "৮" },
+  { 0x26, "৯" },
+  { 0x27, "০" },
+  { 0x2E, "ৢ" },
+  { 0x2F, "ড়" },
+};
+
+const wa_keyboard_mapping LAYOUT_17_LAYER_3_ENTRIES[] = {
+  { 0x04, "৵" },
+  { 0x07, "৹" },
+  { 0x09, "ঌ" },
+  { 0x0D, "ৱ" },
+  { 0x15, "ৡ" },
+  { 0x16, "৷" },
+  { 0x2E, "ৠ" },
+  { 0x2F, "ঢ়" },
+};
+
+const wa_keyboard_mapping LAYOUT_17_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+};
+
+const wa_keyboard_layer LAYOUT_17_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_17_LAYER_0_ENTRIES, 49u,
+  },
+  {
+    "shift",
+    LAYOUT_17_LAYER_1_ENTRIES, 44u,
+  },
+  {
+    "altgr",
+    LAYOUT_17_LAYER_2_ENTRIES, 21u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_17_LAYER_3_ENTRIES, 8u,
+  },
+  {
+    "ctrl",
+    LAYOUT_17_LAYER_4_ENTRIES, 1u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_18_LAYER_0_ENTRIES[] = {
+  { 0x04, "འ" },
+  { 0x05, "པ" },
+  { 0x06, "ཀ" },
+  { 0x07, "ད" },
+  { 0x08, "ེ" },
+  { 0x09, "བ" },
+  { 0x0A, "ང" },
+  { 0x0B, "མ" },
+  { 0x0C, "ི" },
+  { 0x0D, "་" },
+  { 0x0E, "ག" },
+  { 0x0F, "ལ" },
+  { 0x10, "m" },
+  { 0x11, "ན" },
+  { 0x12, "ོ" },
+  { 0x13, "ཕ" },
+  { 0x14, "ཅ" },
+  { 0x15, "ར" },
+  { 0x16, "ས" },
+  { 0x17, "ཏ" },
+  { 0x18, "ུ" },
+  { 0x19, "ཁ" },
+  { 0x1A, "ཆ" },
+  { 0x1B, "ཤ" },
+  { 0x1C, "ཡ" },
+  { 0x1D, "ཟ" },
+  { 0x1E, "༡" },
+  { 0x1F, "༢" },
+  { 0x20, "༣" },
+  { 0x21, "༤" },
+  { 0x22, "༥" },
+  { 0x23, "༦" },
+  { 0x24, "༧" },
+  { 0x25, "༨" },
+  { 0x26, "༩" },
+  { 0x27, "༠" },
+  { 0x2C, " " },
+  { 0x2D, "ཧ" },
+  { 0x2E, "ཝ" },
+  { 0x2F, "ཙ" },
+  { 0x30, "ཚ" },
+  { 0x31, "ཛ" },
+  { 0x33, "ཞ" },
+  { 0x34, "།" },
+  { 0x35, "ཨ" },
+  { 0x36, "ཐ" },
+  { 0x37, "ཇ" },
+  { 0x38, "ཉ" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_18_LAYER_1_ENTRIES[] = {
+  { 0x04, "ཱ" },
+  { 0x05, "྆" },
+  { 0x06, "ཀྵ" },
+  { 0x07, "ཌ" },
+  { 0x08, "༗" },
+  { 0x09, "༾" },
+  { 0x0A, "༿" },
+  { 0x0B, "࿏" },
+  { 0x0C, "༙" },
+  { 0x0D, "༂" },
+  { 0x0E, "༃" },
+  { 0x0F, "༆" },
+  { 0x10, "M" },
+  { 0x11, "ཎ" },
+  { 0x12, "༚" },
+  { 0x13, "༛" },
+  { 0x14, "༕" },
+  { 0x15, "ྼ" },
+  { 0x16, "༟" },
+  { 0x17, "ཊ" },
+  { 0x18, "༘" },
+  { 0x19, "྇" },
+  { 0x1A, "༖" },
+  { 0x1B, "ཥ" },
+  { 0x1C, "ྻ" },
+  { 0x1D, "༴" },
+  { 0x1E, "༪" },
+  { 0x1F, "༫" },
+  { 0x20, "༬" },
+  { 0x21, "༭" },
+  { 0x22, "༮" },
+  { 0x23, "༯" },
+  { 0x24, "༰" },
+  { 0x25, "༱" },
+  { 0x26, "༲" },
+  { 0x27, "༳" },
+  { 0x2C, " " },
+  { 0x2D, "༼" },
+  { 0x2E, "༽" },
+  { 0x2F, "༜" },
+  { 0x30, "༝" },
+  { 0x31, "༞" },
+  { 0x33, "༇" },
+  { 0x34, "༸" },
+  { 0x35, "༁" },
+  { 0x36, "ཋ" },
+  { 0x37, "༺" },
+  { 0x38, "༻" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_18_LAYER_2_ENTRIES[] = {
+  { 0x04, "ཱ" },
+  { 0x05, "྆" },
+  { 0x06, "ཀྵ" },
+  { 0x07, "ཌ" },
+  { 0x08, "༗" },
+  { 0x09, "༾" },
+  { 0x0A, "༿" },
+  { 0x0B, "࿏" },
+  { 0x0C, "༙" },
+  { 0x0D, "༂" },
+  { 0x0E, "༃" },
+  { 0x0F, "༆" },
+  { 0x10, "M" },
+  { 0x11, "ཎ" },
+  { 0x12, "༚" },
+  { 0x13, "༛" },
+  { 0x14, "༕" },
+  { 0x15, "ྼ" },
+  { 0x16, "༟" },
+  { 0x17, "ཊ" },
+  { 0x18, "༘" },
+  { 0x19, "྇" },
+  { 0x1A, "༖" },
+  { 0x1B, "ཥ" },
+  { 0x1C, "ྻ" },
+  { 0x1D, "༴" },
+  { 0x1E, "༪" },
+  { 0x1F, "༫" },
+  { 0x20, "༬" },
+  { 0x21, "༭" },
+  { 0x22, "༮" },
+  { 0x23, "༯" },
+  { 0x24, "༰" },
+  { 0x25, "༱" },
+  { 0x26, "༲" },
+  { 0x27, "༳" },
+  { 0x2D, "༼" },
+  { 0x2E, "༽" },
+  { 0x2F, "༜" },
+  { 0x30, "༝" },
+  { 0x31, "༞" },
+  { 0x33, "༇" },
+  { 0x34, "༸" },
+  { 0x35, "༁" },
+  { 0x36, "ཋ" },
+  { 0x37, "༺" },
+  { 0x38, "༻" },
+};
+
+const wa_keyboard_mapping LAYOUT_18_LAYER_3_ENTRIES[] = {
+  { 0x2C, " " },
+};
+
+const wa_keyboard_mapping LAYOUT_18_LAYER_4_ENTRIES[] = {
+  { 0x04, "࿄" },
+  { 0x05, "ྂ" },
+  { 0x06, "ྐྵ" },
+  { 0x07, "ྜ" },
+  { 0x08, "྾" },
+  { 0x09, "བྷ" },
+  { 0x0A, "࿆" },
+  { 0x0B, "࿇" },
+  { 0x0C, "ཱི" },
+  { 0x0D, "࿈" },
+  { 0x0E, "གྷ" },
+  { 0x0F, "࿉" },
+  { 0x10, "དྷ" },
+  { 0x11, "ྞ" },
+  { 0x12, "࿀" },
+  { 0x13, "࿁" },
+  { 0x14, "ྉ" },
+  { 0x15, "ཪ" },
+  { 0x16, "࿅" },
+  { 0x17, "ྚ" },
+  { 0x18, "ཱུ" },
+  { 0x19, "༶" },
+  { 0x1A, "ྈ" },
+  { 0x1B, "ྵ" },
+  { 0x1C, "྿" },
+  { 0x1D, "࿌" },
+  { 0x1E, "ྲྀ" },
+  { 0x1F, "ྲཱྀ" },
+  { 0x20, "ླྀ" },
+  { 0x21, "ླཱྀ" },
+  { 0x22, "ཱྀ" },
+  { 0x23, "༉" },
+  { 0x24, "༊" },
+  { 0x25, "༏" },
+  { 0x26, "༐" },
+  { 0x27, "༒" },
+  { 0x2C, " " },
+  { 0x2D, "༌" },
+  { 0x2E, "༓" },
+  { 0x2F, "࿂" },
+  { 0x30, "࿃" },
+  { 0x31, "ཛྷ" },
+  { 0x33, "࿊" },
+  { 0x34, "࿋" },
+  { 0x35, "ༀ" },
+  { 0x36, "ྛ" },
+  { 0x37, "ྋ" },
+  { 0x38, "ྊ" },
+};
+
+const wa_keyboard_mapping LAYOUT_18_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_18_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_18_LAYER_0_ENTRIES, 52u,
+  },
+  {
+    "shift",
+    LAYOUT_18_LAYER_1_ENTRIES, 52u,
+  },
+  {
+    "caps",
+    LAYOUT_18_LAYER_2_ENTRIES, 47u,
+  },
+  {
+    "altgr",
+    LAYOUT_18_LAYER_3_ENTRIES, 1u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_18_LAYER_4_ENTRIES, 48u,
+  },
+  {
+    "ctrl",
+    LAYOUT_18_LAYER_5_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_19_LAYER_0_ENTRIES[] = {
+  { 0x04, "འ" },
+  { 0x05, "པ" },
+  { 0x06, "ཀ" },
+  { 0x07, "ད" },
+  { 0x08, "ེ" },
+  { 0x09, "བ" },
+  { 0x0A, "ང" },
+  { 0x0B, "མ" },
+  { 0x0C, "ི" },
+  { 0x0D, "་" },
+  { 0x0E, "ག" },
+  { 0x0F, "ལ" },
+  { 0x10, "m" },
+  { 0x11, "ན" },
+  { 0x12, "ོ" },
+  { 0x13, "ཕ" },
+  { 0x14, "ཅ" },
+  { 0x15, "ར" },
+  { 0x16, "ས" },
+  { 0x17, "ཏ" },
+  { 0x18, "ུ" },
+  { 0x19, "ཁ" },
+  { 0x1A, "ཆ" },
+  { 0x1B, "ཤ" },
+  { 0x1C, "ཡ" },
+  { 0x1D, "ཟ" },
+  { 0x1E, "༡" },
+  { 0x1F, "༢" },
+  { 0x20, "༣" },
+  { 0x21, "༤" },
+  { 0x22, "༥" },
+  { 0x23, "༦" },
+  { 0x24, "༧" },
+  { 0x25, "༨" },
+  { 0x26, "༩" },
+  { 0x27, "༠" },
+  { 0x2C, " " },
+  { 0x2D, "ཧ" },
+  { 0x2E, "ཝ" },
+  { 0x2F, "ཙ" },
+  { 0x30, "ཚ" },
+  { 0x31, "ཛ" },
+  { 0x33, "ཞ" },
+  { 0x34, "།" },
+  { 0x35, "ཨ" },
+  { 0x36, "ཐ" },
+  { 0x37, "ཇ" },
+  { 0x38, "ཉ" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_19_LAYER_1_ENTRIES[] = {
+  { 0x04, "ཱ" },
+  { 0x05, "྆" },
+  { 0x06, "ཀྵ" },
+  { 0x07, "ཌ" },
+  { 0x08, "༗" },
+  { 0x09, "༾" },
+  { 0x0A, "༿" },
+  { 0x0B, "࿏" },
+  { 0x0C, "༙" },
+  { 0x0D, "༂" },
+  { 0x0E, "༃" },
+  { 0x0F, "༆" },
+  { 0x10, "M" },
+  { 0x11, "ཎ" },
+  { 0x12, "༚" },
+  { 0x13, "༛" },
+  { 0x14, "༕" },
+  { 0x15, "ྼ" },
+  { 0x16, "༟" },
+  { 0x17, "ཊ" },
+  { 0x18, "༘" },
+  { 0x19, "྇" },
+  { 0x1A, "༖" },
+  { 0x1B, "ཥ" },
+  { 0x1C, "ྻ" },
+  { 0x1D, "༴" },
+  { 0x1E, "༪" },
+  { 0x1F, "༫" },
+  { 0x20, "༬" },
+  { 0x21, "༭" },
+  { 0x22, "༮" },
+  { 0x23, "༯" },
+  { 0x24, "༰" },
+  { 0x25, "༱" },
+  { 0x26, "༲" },
+  { 0x27, "༳" },
+  { 0x2C, " " },
+  { 0x2D, "༼" },
+  { 0x2E, "༽" },
+  { 0x2F, "༜" },
+  { 0x30, "༝" },
+  { 0x31, "༞" },
+  { 0x33, "༇" },
+  { 0x34, "༸" },
+  { 0x35, "༁" },
+  { 0x36, "ཋ" },
+  { 0x37, "༺" },
+  { 0x38, "༻" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_19_LAYER_2_ENTRIES[] = {
+  { 0x04, "ཱ" },
+  { 0x05, "྆" },
+  { 0x06, "ཀྵ" },
+  { 0x07, "ཌ" },
+  { 0x08, "༗" },
+  { 0x09, "༾" },
+  { 0x0A, "༿" },
+  { 0x0B, "࿏" },
+  { 0x0C, "༙" },
+  { 0x0D, "༂" },
+  { 0x0E, "༃" },
+  { 0x0F, "༆" },
+  { 0x10, "M" },
+  { 0x11, "ཎ" },
+  { 0x12, "༚" },
+  { 0x13, "༛" },
+  { 0x14, "༕" },
+  { 0x15, "ྼ" },
+  { 0x16, "༟" },
+  { 0x17, "ཊ" },
+  { 0x18, "༘" },
+  { 0x19, "྇" },
+  { 0x1A, "༖" },
+  { 0x1B, "ཥ" },
+  { 0x1C, "ྻ" },
+  { 0x1D, "༴" },
+  { 0x1E, "༪" },
+  { 0x1F, "༫" },
+  { 0x20, "༬" },
+  { 0x21, "༭" },
+  { 0x22, "༮" },
+  { 0x23, "༯" },
+  { 0x24, "༰" },
+  { 0x25, "༱" },
+  { 0x26, "༲" },
+  { 0x27, "༳" },
+  { 0x2D, "༼" },
+  { 0x2E, "༽" },
+  { 0x2F, "༜" },
+  { 0x30, "༝" },
+  { 0x31, "༞" },
+  { 0x33, "༇" },
+  { 0x34, "༸" },
+  { 0x35, "༁" },
+  { 0x36, "ཋ" },
+  { 0x37, "༺" },
+  { 0x38, "༻" },
+};
+
+const wa_keyboard_mapping LAYOUT_19_LAYER_3_ENTRIES[] = {
+  { 0x2C, " " },
+};
+
+const wa_keyboard_mapping LAYOUT_19_LAYER_4_ENTRIES[] = {
+  { 0x04, "࿄" },
+  { 0x05, "ྂ" },
+  { 0x06, "ྐྵ" },
+  { 0x07, "ྜ" },
+  { 0x08, "྾" },
+  { 0x09, "བྷ" },
+  { 0x0A, "࿆" },
+  { 0x0B, "࿇" },
+  { 0x0C, "ཱི" },
+  { 0x0D, "࿈" },
+  { 0x0E, "གྷ" },
+  { 0x0F, "࿉" },
+  { 0x10, "དྷ" },
+  { 0x11, "ྞ" },
+  { 0x12, "࿀" },
+  { 0x13, "࿁" },
+  { 0x14, "ྉ" },
+  { 0x15, "ཪ" },
+  { 0x16, "࿅" },
+  { 0x17, "ྚ" },
+  { 0x18, "ཱུ" },
+  { 0x19, "༶" },
+  { 0x1A, "ྈ" },
+  { 0x1B, "ྵ" },
+  { 0x1C, "྿" },
+  { 0x1D, "࿌" },
+  { 0x1E, "ྲྀ" },
+  { 0x1F, "ཷ" },
+  { 0x20, "ླྀ" },
+  { 0x21, "ཹ" },
+  { 0x22, "ཱི" },
+  { 0x23, "༉" },
+  { 0x24, "༊" },
+  { 0x25, "༏" },
+  { 0x26, "༐" },
+  { 0x27, "༒" },
+  { 0x2C, " " },
+  { 0x2D, "༌" },
+  { 0x2E, "༓" },
+  { 0x2F, "࿂" },
+  { 0x30, "࿃" },
+  { 0x31, "ཛྷ" },
+  { 0x33, "࿊" },
+  { 0x34, "࿋" },
+  { 0x35, "ༀ" },
+  { 0x36, "ྛ" },
+  { 0x37, "ྋ" },
+  { 0x38, "ྊ" },
+};
+
+const wa_keyboard_mapping LAYOUT_19_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_19_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_19_LAYER_0_ENTRIES, 52u,
+  },
+  {
+    "shift",
+    LAYOUT_19_LAYER_1_ENTRIES, 52u,
+  },
+  {
+    "caps",
+    LAYOUT_19_LAYER_2_ENTRIES, 47u,
+  },
+  {
+    "altgr",
+    LAYOUT_19_LAYER_3_ENTRIES, 1u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_19_LAYER_4_ENTRIES, 48u,
+  },
+  {
+    "ctrl",
+    LAYOUT_19_LAYER_5_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_20_LAYER_0_ENTRIES[] = {
+  { 0x04, "а" },
+  { 0x05, "б" },
+  { 0x06, "ц" },
+  { 0x07, "д" },
+  { 0x08, "е" },
+  { 0x09, "ф" },
+  { 0x0A, "г" },
+  { 0x0B, "х" },
+  { 0x0C, "и" },
+  { 0x0D, "ј" },
+  { 0x0E, "к" },
+  { 0x0F, "л" },
+  { 0x10, "м" },
+  { 0x11, "н" },
+  { 0x12, "о" },
+  { 0x13, "п" },
+  { 0x14, "љ" },
+  { 0x15, "р" },
+  { 0x16, "с" },
+  { 0x17, "т" },
+  { 0x18, "у" },
+  { 0x19, "в" },
+  { 0x1A, "њ" },
+  { 0x1B, "џ" },
+  { 0x1C, "з" },
+  { 0x1D, "ѕ" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "'" },
+  { 0x2E, "+" },
+  { 0x2F, "ш" },
+  { 0x30, "ђ" },
+  { 0x31, "ж" },
+  { 0x33, "ч" },
+  { 0x34, "ћ" },
+  { 0x35, "`" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "-" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "<" },
+};
+
+const wa_keyboard_mapping LAYOUT_20_LAYER_1_ENTRIES[] = {
+  { 0x04, "А" },
+  { 0x05, "Б" },
+  { 0x06, "Ц" },
+  { 0x07, "Д" },
+  { 0x08, "Е" },
+  { 0x09, "Ф" },
+  { 0x0A, "Г" },
+  { 0x0B, "Х" },
+  { 0x0C, "И" },
+  { 0x0D, "Ј" },
+  { 0x0E, "К" },
+  { 0x0F, "Л" },
+  { 0x10, "М" },
+  { 0x11, "Н" },
+  { 0x12, "О" },
+  { 0x13, "П" },
+  { 0x14, "Љ" },
+  { 0x15, "Р" },
+  { 0x16, "С" },
+  { 0x17, "Т" },
+  { 0x18, "У" },
+  { 0x19, "В" },
+  { 0x1A, "Њ" },
+  { 0x1B, "Џ" },
+  { 0x1C, "З" },
+  { 0x1D, "Ѕ" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "&" },
+  { 0x24, "/" },
+  { 0x25, "(" },
+  { 0x26, ")" },
+  { 0x27, "=" },
+  { 0x2C, " " },
+  { 0x2D, "?" },
+  { 0x2E, "*" },
+  { 0x2F, "Ш" },
+  { 0x30, "Ђ" },
+  { 0x31, "Ж" },
+  { 0x33, "Ч" },
+  { 0x34, "Ћ" },
+  { 0x35, "~" },
+  { 0x36, ";" },
+  { 0x37, ":" },
+  { 0x38, "_" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_20_LAYER_2_ENTRIES[] = {
+  { 0x04, "А" },
+  { 0x05, "Б" },
+  { 0x06, "Ц" },
+  { 0x07, "Д" },
+  { 0x08, "Е" },
+  { 0x09, "Ф" },
+  { 0x0A, "Г" },
+  { 0x0B, "Х" },
+  { 0x0C, "И" },
+  { 0x0D, "Ј" },
+  { 0x0E, "К" },
+  { 0x0F, "Л" },
+  { 0x10, "М" },
+  { 0x11, "Н" },
+  { 0x12, "О" },
+  { 0x13, "П" },
+  { 0x14, "Љ" },
+  { 0x15, "Р" },
+  { 0x16, "С" },
+  { 0x17, "Т" },
+  { 0x18, "У" },
+  { 0x19, "В" },
+  { 0x1A, "Њ" },
+  { 0x1B, "Џ" },
+  { 0x1C, "З" },
+  { 0x1D, "Ѕ" },
+  { 0x2F, "Ш" },
+  { 0x30, "Ђ" },
+  { 0x31, "Ж" },
+  { 0x33, "Ч" },
+  { 0x34, "Ћ" },
+};
+
+const wa_keyboard_mapping LAYOUT_20_LAYER_3_ENTRIES[] = {
+  { 0x05, "{" },
+  { 0x08, "€" },
+  { 0x09, "[" },
+  { 0x0A, "]" },
+  { 0x10, "§" },
+  { 0x11, "}" },
+  { 0x14, "\\" },
+  { 0x19, "@" },
+  { 0x1A, "|" },
+  { 0x20, "^" },
+  { 0x22, "°" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_20_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_20_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_20_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_20_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_20_LAYER_2_ENTRIES, 31u,
+  },
+  {
+    "altgr",
+    LAYOUT_20_LAYER_3_ENTRIES, 13u,
+  },
+  {
+    "ctrl",
+    LAYOUT_20_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_21_LAYER_0_ENTRIES[] = {
+  { 0x04, "ᨕ" },
+  { 0x05, "ᨅ" },
+  { 0x06, "ᨌ" },
+  { 0x07, "ᨉ" },
+  { 0x08, "ᨙ" },
+  { 0x09, "ᨃ" },
+  { 0x0A, "ᨁ" },
+  { 0x0B, "ᨖ" },
+  { 0x0C, "ᨗ" },
+  { 0x0D, "ᨍ" },
+  { 0x0E, "ᨀ" },
+  { 0x0F, "ᨒ" },
+  { 0x10, "ᨆ" },
+  { 0x11, "ᨊ" },
+  { 0x12, "ᨚ" },
+  { 0x13, "ᨄ" },
+  { 0x14, "ᨛ" },
+  { 0x15, "ᨑ" },
+  { 0x16, "ᨔ" },
+  { 0x17, "ᨈ" },
+  { 0x18, "ᨘ" },
+  { 0x19, "ᨓ" },
+  { 0x1A, "ᨏ" },
+  { 0x1B, "ᨂ" },
+  { 0x1C, "ᨐ" },
+  { 0x1D, "ᨎ" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x35, "ꧏ" },
+  { 0x36, "᨞" },
+  { 0x37, "᨟" },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_21_LAYER_1_ENTRIES[] = {
+  { 0x04, "ᨕᨗ‍ᨐ" },
+  { 0x10, "ᨇ" },
+  { 0x11, "ᨋ" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_21_LAYER_2_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_21_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_21_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_21_LAYER_1_ENTRIES, 30u,
+  },
+  {
+    "ctrl",
+    LAYOUT_21_LAYER_2_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_22_LAYER_0_ENTRIES[] = {
+  { 0x04, "Ꭰ" },
+  { 0x05, "Ꭸ" },
+  { 0x06, "Ꮣ" },
+  { 0x07, "Ꮧ" },
+  { 0x08, "Ꭱ" },
+  { 0x09, "Ꭹ" },
+  { 0x0A, "Ꭶ" },
+  { 0x0B, "Ꭿ" },
+  { 0x0C, "Ꭲ" },
+  { 0x0D, "Ꮪ" },
+  { 0x0E, "Ꮈ" },
+  { 0x0F, "Ꮅ" },
+  { 0x10, "Ꮕ" },
+  { 0x11, "Ꮎ" },
+  { 0x12, "Ꭳ" },
+  { 0x13, "Ꮑ" },
+  { 0x14, "Ꭺ" },
+  { 0x15, "Ꮫ" },
+  { 0x16, "Ꮝ" },
+  { 0x17, "Ꮤ" },
+  { 0x18, "Ꭴ" },
+  { 0x19, "Ꭵ" },
+  { 0x1A, "Ꮃ" },
+  { 0x1B, "Ᏼ" },
+  { 0x1C, "Ꮿ" },
+  { 0x1D, "Ꭼ" },
+  { 0x1E, "ᏣᎳᎩ" },
+  { 0x1F, "ᎣᏏᏲ" },
+  { 0x20, "ᏩᏙ" },
+  { 0x21, "Ꮩ" },
+  { 0x22, "Ꮶ" },
+  { 0x23, "Ꮬ" },
+  { 0x24, "Ꮛ" },
+  { 0x25, "Ꮦ" },
+  { 0x26, "Ꮢ" },
+  { 0x27, "Ꮔ" },
+  { 0x2C, " " },
+  { 0x2D, "Ꮏ" },
+  { 0x2E, "Ᏻ" },
+  { 0x2F, "Ꮥ" },
+  { 0x30, "Ꮆ" },
+  { 0x31, "Ꮹ" },
+  { 0x33, "Ꮸ" },
+  { 0x34, "'" },
+  { 0x35, "`" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "Ꮒ" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_22_LAYER_1_ENTRIES[] = {
+  { 0x04, "Ꮜ" },
+  { 0x05, "Ᏸ" },
+  { 0x06, "Ꮯ" },
+  { 0x07, "Ꮠ" },
+  { 0x08, "Ꮳ" },
+  { 0x09, "Ꮘ" },
+  { 0x0A, "Ꮵ" },
+  { 0x0B, "Ꮂ" },
+  { 0x0C, "Ᏹ" },
+  { 0x0D, "Ꭻ" },
+  { 0x0E, "Ꭷ" },
+  { 0x0F, "Ꭾ" },
+  { 0x10, "Ꮇ" },
+  { 0x11, "Ꮋ" },
+  { 0x12, "Ꮼ" },
+  { 0x13, "Ꮺ" },
+  { 0x14, "Ꮖ" },
+  { 0x15, "Ꮟ" },
+  { 0x16, "Ꮞ" },
+  { 0x17, "Ꮨ" },
+  { 0x18, "Ꭽ" },
+  { 0x19, "Ꮮ" },
+  { 0x1A, "Ꮻ" },
+  { 0x1B, "Ꮽ" },
+  { 0x1C, "Ᏺ" },
+  { 0x1D, "Ꮓ" },
+  { 0x1E, "Ꮁ" },
+  { 0x1F, "Ꮗ" },
+  { 0x20, "Ꮷ" },
+  { 0x21, "Ꮀ" },
+  { 0x22, "Ꮉ" },
+  { 0x23, "Ꮭ" },
+  { 0x24, "Ꮱ" },
+  { 0x25, "Ꮊ" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "Ꮌ" },
+  { 0x2E, "Ꮍ" },
+  { 0x2F, "Ꮡ" },
+  { 0x30, "Ꮴ" },
+  { 0x31, "Ꮾ" },
+  { 0x33, "Ꮰ" },
+  { 0x34, "\"" },
+  { 0x35, "Ꮚ" },
+  { 0x36, "Ꮲ" },
+  { 0x37, "Ꮄ" },
+  { 0x38, "Ꮙ" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_22_LAYER_2_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x33, ";" },
+  { 0x35, "Ꮐ" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "/" },
+};
+
+const wa_keyboard_mapping LAYOUT_22_LAYER_3_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x35, "~" },
+  { 0x38, "?" },
+};
+
+const wa_keyboard_mapping LAYOUT_22_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+};
+
+const wa_keyboard_layer LAYOUT_22_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_22_LAYER_0_ENTRIES, 52u,
+  },
+  {
+    "shift",
+    LAYOUT_22_LAYER_1_ENTRIES, 52u,
+  },
+  {
+    "altgr",
+    LAYOUT_22_LAYER_2_ENTRIES, 46u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_22_LAYER_3_ENTRIES, 44u,
+  },
+  {
+    "ctrl",
+    LAYOUT_22_LAYER_4_ENTRIES, 1u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_23_LAYER_0_ENTRIES[] = {
+  { 0x04, "Ꭰ" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "Ꭱ" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "Ꭲ" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "Ꭳ" },
+  { 0x14, "q" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "Ꭴ" },
+  { 0x19, "Ꭵ" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x35, "`" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_23_LAYER_1_ENTRIES[] = {
+  { 0x04, "Ꭰ" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "Ꭱ" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "Ꭲ" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "Ꭳ" },
+  { 0x14, "Q" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "Ꭴ" },
+  { 0x19, "Ꭵ" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_23_LAYER_2_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x35, "`" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+};
+
+const wa_keyboard_mapping LAYOUT_23_LAYER_3_ENTRIES[] = {
+  { 0x2A, "" },
+};
+
+const wa_keyboard_layer LAYOUT_23_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_23_LAYER_0_ENTRIES, 48u,
+  },
+  {
+    "shift",
+    LAYOUT_23_LAYER_1_ENTRIES, 48u,
+  },
+  {
+    "caps",
+    LAYOUT_23_LAYER_2_ENTRIES, 47u,
+  },
+  {
+    "ctrl",
+    LAYOUT_23_LAYER_3_ENTRIES, 1u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_24_LAYER_0_ENTRIES[] = {
+  { 0x04, "ا" },
+  { 0x05, "ب" },
+  { 0x06, "ج" },
+  { 0x07, "د" },
+  { 0x08, "ە" },
+  { 0x09, "ف" },
+  { 0x0A, "گ" },
+  { 0x0B, "ه" },
+  { 0x0C, "ح" },
+  { 0x0D, "ژ" },
+  { 0x0E, "ک" },
+  { 0x0F, "ل" },
+  { 0x10, "م" },
+  { 0x11, "ن" },
+  { 0x12, "ۆ" },
+  { 0x13, "پ" },
+  { 0x14, "ق" },
+  { 0x15, "ر" },
+  { 0x16, "س" },
+  { 0x17, "ت" },
+  { 0x18, "ئ" },
+  { 0x19, "ڤ" },
+  { 0x1A, "و" },
+  { 0x1B, "خ" },
+  { 0x1C, "ی" },
+  { 0x1D, "ز" },
+  { 0x1E, "١" },
+  { 0x1F, "٢" },
+  { 0x20, "٣" },
+  { 0x21, "٤" },
+  { 0x22, "٥" },
+  { 0x23, "٦" },
+  { 0x24, "٧" },
+  { 0x25, "٨" },
+  { 0x26, "٩" },
+  { 0x27, "٠" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "]" },
+  { 0x30, "[" },
+  { 0x31, "\\" },
+  { 0x33, "؛" },
+  { 0x34, "'" },
+  { 0x35, "`" },
+  { 0x36, "،" },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_24_LAYER_1_ENTRIES[] = {
+  { 0x04, "آ" },
+  { 0x05, "ى" },
+  { 0x06, "چ" },
+  { 0x07, "ذ" },
+  { 0x08, "ي" },
+  { 0x09, "إ" },
+  { 0x0A, "غ" },
+  { 0x0B, "‌" },
+  { 0x0C, "ع" },
+  { 0x0D, "أ" },
+  { 0x0E, "ك" },
+  { 0x0F, "ڵ" },
+  { 0x10, "ـ" },
+  { 0x11, "ة" },
+  { 0x12, "ؤ" },
+  { 0x13, "ث" },
+  { 0x14, "`" },
+  { 0x15, "ڕ" },
+  { 0x16, "ش" },
+  { 0x17, "ط" },
+  { 0x18, "ء" },
+  { 0x19, "ظ" },
+  { 0x1A, "وو" },
+  { 0x1B, "ص" },
+  { 0x1C, "ێ" },
+  { 0x1D, "ض" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "٪" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, ")" },
+  { 0x27, "(" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "}" },
+  { 0x30, "{" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x36, ">" },
+  { 0x37, "<" },
+  { 0x38, "؟" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "/" },
+};
+
+const wa_keyboard_mapping LAYOUT_24_LAYER_2_ENTRIES[] = {
+  { 0x2A, "" },
+};
+
+const wa_keyboard_layer LAYOUT_24_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_24_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_24_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "ctrl",
+    LAYOUT_24_LAYER_2_ENTRIES, 1u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_25_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x35, "`" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_25_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_25_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+};
+
+const wa_keyboard_mapping LAYOUT_25_LAYER_3_ENTRIES[] = {
+  { 0x08, "€" },
+  { 0x1E, "+" },
+  { 0x1F, "ě" },
+  { 0x20, "š" },
+  { 0x21, "č" },
+  { 0x22, "ř" },
+  { 0x23, "ž" },
+  { 0x24, "ý" },
+  { 0x25, "á" },
+  { 0x26, "í" },
+  { 0x27, "é" },
+  { 0x2D, "=" },
+  { 0x2E, "´" },
+  { 0x2F, "ú" },
+  { 0x30, ")" },
+  { 0x31, "¨" },
+  { 0x33, "ů" },
+  { 0x34, "§" },
+  { 0x35, ";" },
+  { 0x36, "?" },
+  { 0x37, ":" },
+  { 0x38, "-" },
+  { 0x64, "ß" },
+};
+
+const wa_keyboard_mapping LAYOUT_25_LAYER_4_ENTRIES[] = {
+  { 0x2D, "%" },
+  { 0x2E, "ˇ" },
+  { 0x2F, "/" },
+  { 0x30, "(" },
+  { 0x31, "^" },
+  { 0x33, "\"" },
+  { 0x34, "!" },
+  { 0x35, "°" },
+  { 0x36, "×" },
+  { 0x37, "÷" },
+  { 0x38, "_" },
+  { 0x64, "˝" },
+};
+
+const wa_keyboard_mapping LAYOUT_25_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_25_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_25_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_25_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_25_LAYER_2_ENTRIES, 26u,
+  },
+  {
+    "altgr",
+    LAYOUT_25_LAYER_3_ENTRIES, 23u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_25_LAYER_4_ENTRIES, 12u,
+  },
+  {
+    "ctrl",
+    LAYOUT_25_LAYER_5_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_26_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "+" },
+  { 0x1F, "ě" },
+  { 0x20, "š" },
+  { 0x21, "č" },
+  { 0x22, "ř" },
+  { 0x23, "ž" },
+  { 0x24, "ý" },
+  { 0x25, "á" },
+  { 0x26, "í" },
+  { 0x27, "é" },
+  { 0x2C, " " },
+  { 0x2D, "=" },
+  { 0x2E, "´" },
+  { 0x2F, "ú" },
+  { 0x30, ")" },
+  { 0x31, "¨" },
+  { 0x33, "ů" },
+  { 0x34, "§" },
+  { 0x35, ";" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "-" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_26_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "%" },
+  { 0x2E, "ˇ" },
+  { 0x2F, "/" },
+  { 0x30, "(" },
+  { 0x31, "'" },
+  { 0x33, "\"" },
+  { 0x34, "!" },
+  { 0x35, "°" },
+  { 0x36, "?" },
+  { 0x37, ":" },
+  { 0x38, "_" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_26_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1F, "Ě" },
+  { 0x20, "Š" },
+  { 0x21, "Č" },
+  { 0x22, "Ř" },
+  { 0x23, "Ž" },
+  { 0x24, "Ý" },
+  { 0x25, "Á" },
+  { 0x26, "Í" },
+  { 0x27, "É" },
+  { 0x2F, "Ú" },
+  { 0x33, "Ů" },
+};
+
+const wa_keyboard_mapping LAYOUT_26_LAYER_3_ENTRIES[] = {
+  { 0x08, "€" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x33, ";" },
+  { 0x34, "¤" },
+  { 0x35, "`" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "/" },
+  { 0x64, "ß" },
+};
+
+const wa_keyboard_mapping LAYOUT_26_LAYER_4_ENTRIES[] = {
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "^" },
+  { 0x35, "~" },
+  { 0x36, "×" },
+  { 0x37, "÷" },
+  { 0x38, "?" },
+  { 0x64, "˝" },
+};
+
+const wa_keyboard_mapping LAYOUT_26_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_26_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_26_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_26_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_26_LAYER_2_ENTRIES, 37u,
+  },
+  {
+    "altgr",
+    LAYOUT_26_LAYER_3_ENTRIES, 23u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_26_LAYER_4_ENTRIES, 12u,
+  },
+  {
+    "ctrl",
+    LAYOUT_26_LAYER_5_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_27_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "z" },
+  { 0x1D, "y" },
+  { 0x1E, "+" },
+  { 0x1F, "ě" },
+  { 0x20, "š" },
+  { 0x21, "č" },
+  { 0x22, "ř" },
+  { 0x23, "ž" },
+  { 0x24, "ý" },
+  { 0x25, "á" },
+  { 0x26, "í" },
+  { 0x27, "é" },
+  { 0x2C, " " },
+  { 0x2D, "=" },
+  { 0x2E, "´" },
+  { 0x2F, "ú" },
+  { 0x30, ")" },
+  { 0x31, "¨" },
+  { 0x33, "ů" },
+  { 0x34, "§" },
+  { 0x35, ";" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "-" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_27_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Z" },
+  { 0x1D, "Y" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "%" },
+  { 0x2E, "ˇ" },
+  { 0x2F, "/" },
+  { 0x30, "(" },
+  { 0x31, "'" },
+  { 0x33, "\"" },
+  { 0x34, "!" },
+  { 0x35, "°" },
+  { 0x36, "?" },
+  { 0x37, ":" },
+  { 0x38, "_" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_27_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Z" },
+  { 0x1D, "Y" },
+  { 0x1F, "Ě" },
+  { 0x20, "Š" },
+  { 0x21, "Č" },
+  { 0x22, "Ř" },
+  { 0x23, "Ž" },
+  { 0x24, "Ý" },
+  { 0x25, "Á" },
+  { 0x26, "Í" },
+  { 0x27, "É" },
+  { 0x2F, "Ú" },
+  { 0x33, "Ů" },
+};
+
+const wa_keyboard_mapping LAYOUT_27_LAYER_3_ENTRIES[] = {
+  { 0x05, "{" },
+  { 0x06, "&" },
+  { 0x07, "Đ" },
+  { 0x08, "€" },
+  { 0x09, "[" },
+  { 0x0A, "]" },
+  { 0x0E, "ł" },
+  { 0x0F, "Ł" },
+  { 0x11, "}" },
+  { 0x14, "\\" },
+  { 0x16, "đ" },
+  { 0x19, "@" },
+  { 0x1A, "|" },
+  { 0x1B, "#" },
+  { 0x1E, "~" },
+  { 0x1F, "ˇ" },
+  { 0x20, "^" },
+  { 0x21, "˘" },
+  { 0x22, "°" },
+  { 0x23, "˛" },
+  { 0x24, "`" },
+  { 0x25, "˙" },
+  { 0x26, "´" },
+  { 0x27, "˝" },
+  { 0x2D, "¨" },
+  { 0x2E, "¸" },
+  { 0x2F, "÷" },
+  { 0x30, "×" },
+  { 0x31, "¤" },
+  { 0x33, "$" },
+  { 0x34, "ß" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "*" },
+};
+
+const wa_keyboard_mapping LAYOUT_27_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_27_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_27_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_27_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_27_LAYER_2_ENTRIES, 37u,
+  },
+  {
+    "altgr",
+    LAYOUT_27_LAYER_3_ENTRIES, 34u,
+  },
+  {
+    "ctrl",
+    LAYOUT_27_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_28_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "+" },
+  { 0x2E, "´" },
+  { 0x2F, "å" },
+  { 0x30, "¨" },
+  { 0x31, "'" },
+  { 0x33, "æ" },
+  { 0x34, "ø" },
+  { 0x35, "½" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "-" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "<" },
+};
+
+const wa_keyboard_mapping LAYOUT_28_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "#" },
+  { 0x21, "¤" },
+  { 0x22, "%" },
+  { 0x23, "&" },
+  { 0x24, "/" },
+  { 0x25, "(" },
+  { 0x26, ")" },
+  { 0x27, "=" },
+  { 0x2C, " " },
+  { 0x2D, "?" },
+  { 0x2E, "`" },
+  { 0x2F, "Å" },
+  { 0x30, "^" },
+  { 0x31, "*" },
+  { 0x33, "Æ" },
+  { 0x34, "Ø" },
+  { 0x35, "§" },
+  { 0x36, ";" },
+  { 0x37, ":" },
+  { 0x38, "_" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_28_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x2F, "Å" },
+  { 0x33, "Æ" },
+  { 0x34, "Ø" },
+};
+
+const wa_keyboard_mapping LAYOUT_28_LAYER_3_ENTRIES[] = {
+  { 0x08, "€" },
+  { 0x10, "µ" },
+  { 0x1F, "@" },
+  { 0x20, "£" },
+  { 0x21, "$" },
+  { 0x22, "€" },
+  { 0x24, "{" },
+  { 0x25, "[" },
+  { 0x26, "]" },
+  { 0x27, "}" },
+  { 0x2E, "|" },
+  { 0x30, "~" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_28_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_28_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_28_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_28_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_28_LAYER_2_ENTRIES, 29u,
+  },
+  {
+    "altgr",
+    LAYOUT_28_LAYER_3_ENTRIES, 13u,
+  },
+  {
+    "ctrl",
+    LAYOUT_28_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_29_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "z" },
+  { 0x1D, "y" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "+" },
+  { 0x2F, "ß" },
+  { 0x30, "´" },
+  { 0x31, "^" },
+  { 0x33, "ü" },
+  { 0x34, "ä" },
+  { 0x35, "ö" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "#" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "<" },
+};
+
+const wa_keyboard_mapping LAYOUT_29_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Z" },
+  { 0x1D, "Y" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "§" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "&" },
+  { 0x24, "/" },
+  { 0x25, "(" },
+  { 0x26, ")" },
+  { 0x27, "=" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "*" },
+  { 0x2F, "?" },
+  { 0x30, "`" },
+  { 0x31, "°" },
+  { 0x33, "Ü" },
+  { 0x34, "Ä" },
+  { 0x35, "Ö" },
+  { 0x36, ";" },
+  { 0x37, ":" },
+  { 0x38, "'" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_29_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Z" },
+  { 0x1D, "Y" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "§" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "&" },
+  { 0x24, "/" },
+  { 0x25, "(" },
+  { 0x26, ")" },
+  { 0x27, "=" },
+  { 0x2E, "*" },
+  { 0x2F, "?" },
+  { 0x33, "Ü" },
+  { 0x34, "Ä" },
+  { 0x35, "Ö" },
+  { 0x36, ";" },
+  { 0x37, ":" },
+  { 0x38, "'" },
+};
+
+const wa_keyboard_mapping LAYOUT_29_LAYER_3_ENTRIES[] = {
+  { 0x08, "€" },
+  { 0x10, "µ" },
+  { 0x14, "@" },
+  { 0x1F, "²" },
+  { 0x20, "³" },
+  { 0x24, "{" },
+  { 0x25, "[" },
+  { 0x26, "]" },
+  { 0x27, "}" },
+  { 0x2E, "~" },
+  { 0x2F, "\\" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_29_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_29_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_29_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_29_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_29_LAYER_2_ENTRIES, 44u,
+  },
+  {
+    "altgr",
+    LAYOUT_29_LAYER_3_ENTRIES, 12u,
+  },
+  {
+    "ctrl",
+    LAYOUT_29_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_30_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "z" },
+  { 0x1D, "y" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "ß" },
+  { 0x2E, "´" },
+  { 0x2F, "ü" },
+  { 0x30, "+" },
+  { 0x31, "#" },
+  { 0x33, "ö" },
+  { 0x34, "ä" },
+  { 0x35, "^" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "-" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "<" },
+};
+
+const wa_keyboard_mapping LAYOUT_30_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Z" },
+  { 0x1D, "Y" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "§" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "&" },
+  { 0x24, "/" },
+  { 0x25, "(" },
+  { 0x26, ")" },
+  { 0x27, "=" },
+  { 0x2C, " " },
+  { 0x2D, "?" },
+  { 0x2E, "`" },
+  { 0x2F, "Ü" },
+  { 0x30, "*" },
+  { 0x31, "'" },
+  { 0x33, "Ö" },
+  { 0x34, "Ä" },
+  { 0x35, "°" },
+  { 0x36, ";" },
+  { 0x37, ":" },
+  { 0x38, "_" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_30_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Z" },
+  { 0x1D, "Y" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "§" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "&" },
+  { 0x24, "/" },
+  { 0x25, "(" },
+  { 0x26, ")" },
+  { 0x27, "=" },
+  { 0x2D, "?" },
+  { 0x2E, "`" },
+  { 0x2F, "Ü" },
+  { 0x30, "*" },
+  { 0x31, "'" },
+  { 0x33, "Ö" },
+  { 0x34, "Ä" },
+  { 0x35, "°" },
+  { 0x36, ";" },
+  { 0x37, ":" },
+  { 0x38, "_" },
+  { 0x64, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_30_LAYER_3_ENTRIES[] = {
+  { 0x04, "☺" },
+  { 0x05, "‹" },
+  { 0x06, " " },
+  { 0x07, "′" },
+  { 0x08, "€" },
+  { 0x09, "˟" },
+  { 0x0A, "ẞ" },
+  { 0x0B, "ˍ" },
+  { 0x0C, "˜" },
+  { 0x0D, "¸" },
+  { 0x0E, "ˏ" },
+  { 0x0F, "˛" },
+  { 0x10, "µ" },
+  { 0x11, "–" },
+  { 0x12, "˚" },
+  { 0x13, "ˀ" },
+  { 0x14, "@" },
+  { 0x15, "˝" },
+  { 0x16, "″" },
+  { 0x17, "ˇ" },
+  { 0x18, "˘" },
+  { 0x19, "«" },
+  { 0x1A, "¯" },
+  { 0x1B, "»" },
+  { 0x1C, "¨" },
+  { 0x1D, "›" },
+  { 0x1E, "’" },
+  { 0x1F, "²" },
+  { 0x20, "³" },
+  { 0x21, "—" },
+  { 0x22, "¡" },
+  { 0x23, "¿" },
+  { 0x24, "{" },
+  { 0x25, "[" },
+  { 0x26, "]" },
+  { 0x27, "}" },
+  { 0x2C, " " },
+  { 0x2D, "\\" },
+  { 0x2E, "˙" },
+  { 0x2F, "ʼ" },
+  { 0x30, "~" },
+  { 0x31, "−" },
+  { 0x33, "ˌ" },
+  { 0x34, "˗" },
+  { 0x35, "×" },
+  { 0x36, "‑" },
+  { 0x37, "·" },
+  { 0x38, "­" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_30_LAYER_4_ENTRIES[] = {
+  { 0x2D, "ẞ" },
+};
+
+const wa_keyboard_mapping LAYOUT_30_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+};
+
+const wa_keyboard_layer LAYOUT_30_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_30_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_30_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_30_LAYER_2_ENTRIES, 48u,
+  },
+  {
+    "altgr",
+    LAYOUT_30_LAYER_3_ENTRIES, 49u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_30_LAYER_4_ENTRIES, 1u,
+  },
+  {
+    "ctrl",
+    LAYOUT_30_LAYER_5_ENTRIES, 1u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_31_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "z" },
+  { 0x1D, "y" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "ß" },
+  { 0x2E, "´" },
+  { 0x2F, "ü" },
+  { 0x30, "+" },
+  { 0x31, "#" },
+  { 0x33, "ö" },
+  { 0x34, "ä" },
+  { 0x35, "^" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "-" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "˟" },
+};
+
+const wa_keyboard_mapping LAYOUT_31_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Z" },
+  { 0x1D, "Y" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "§" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "&" },
+  { 0x24, "/" },
+  { 0x25, "(" },
+  { 0x26, ")" },
+  { 0x27, "=" },
+  { 0x2C, " " },
+  { 0x2D, "?" },
+  { 0x2E, "`" },
+  { 0x2F, "Ü" },
+  { 0x30, "*" },
+  { 0x31, "'" },
+  { 0x33, "Ö" },
+  { 0x34, "Ä" },
+  { 0x35, "°" },
+  { 0x36, ";" },
+  { 0x37, ":" },
+  { 0x38, "_" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "˟" },
+};
+
+const wa_keyboard_mapping LAYOUT_31_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Z" },
+  { 0x1D, "Y" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "§" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "&" },
+  { 0x24, "/" },
+  { 0x25, "(" },
+  { 0x26, ")" },
+  { 0x27, "=" },
+  { 0x2D, "?" },
+  { 0x2E, "`" },
+  { 0x2F, "Ü" },
+  { 0x30, "*" },
+  { 0x31, "'" },
+  { 0x33, "Ö" },
+  { 0x34, "Ä" },
+  { 0x35, "°" },
+  { 0x36, ";" },
+  { 0x37, ":" },
+  { 0x38, "_" },
+  { 0x64, "˟" },
+};
+
+const wa_keyboard_mapping LAYOUT_31_LAYER_3_ENTRIES[] = {
+  { 0x04, "☺" },
+  { 0x05, "‹" },
+  { 0x06, " " },
+  { 0x07, "′" },
+  { 0x08, "€" },
+  { 0x09, "˟" },
+  { 0x0A, "ẞ" },
+  { 0x0B, "ˍ" },
+  { 0x0C, "˜" },
+  { 0x0D, "¸" },
+  { 0x0E, "ˏ" },
+  { 0x0F, "˛" },
+  { 0x10, "µ" },
+  { 0x11, "–" },
+  { 0x12, "˚" },
+  { 0x13, "ˀ" },
+  { 0x14, "@" },
+  { 0x15, "˝" },
+  { 0x16, "″" },
+  { 0x17, "ˇ" },
+  { 0x18, "˘" },
+  { 0x19, "«" },
+  { 0x1A, "¯" },
+  { 0x1B, "»" },
+  { 0x1C, "¨" },
+  { 0x1D, "›" },
+  { 0x1E, "’" },
+  { 0x1F, "<" },
+  { 0x20, ">" },
+  { 0x21, "—" },
+  { 0x22, "¡" },
+  { 0x23, "¿" },
+  { 0x24, "{" },
+  { 0x25, "[" },
+  { 0x26, "]" },
+  { 0x27, "}" },
+  { 0x2C, " " },
+  { 0x2D, "\\" },
+  { 0x2E, "˙" },
+  { 0x2F, "ʼ" },
+  { 0x30, "~" },
+  { 0x31, "−" },
+  { 0x33, "ˌ" },
+  { 0x34, "˗" },
+  { 0x35, "|" },
+  { 0x36, "‑" },
+  { 0x37, "·" },
+  { 0x38, "­" },
+  { 0x64, "˟" },
+};
+
+const wa_keyboard_mapping LAYOUT_31_LAYER_4_ENTRIES[] = {
+  { 0x2D, "ẞ" },
+};
+
+const wa_keyboard_mapping LAYOUT_31_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+};
+
+const wa_keyboard_layer LAYOUT_31_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_31_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_31_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_31_LAYER_2_ENTRIES, 48u,
+  },
+  {
+    "altgr",
+    LAYOUT_31_LAYER_3_ENTRIES, 49u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_31_LAYER_4_ENTRIES, 1u,
+  },
+  {
+    "ctrl",
+    LAYOUT_31_LAYER_5_ENTRIES, 1u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_32_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "z" },
+  { 0x1D, "y" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "ß" },
+  { 0x2E, "´" },
+  { 0x2F, "ü" },
+  { 0x30, "+" },
+  { 0x31, "#" },
+  { 0x33, "ö" },
+  { 0x34, "ä" },
+  { 0x35, "^" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "-" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "<" },
+};
+
+const wa_keyboard_mapping LAYOUT_32_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Z" },
+  { 0x1D, "Y" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "§" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "&" },
+  { 0x24, "/" },
+  { 0x25, "(" },
+  { 0x26, ")" },
+  { 0x27, "=" },
+  { 0x2C, " " },
+  { 0x2D, "?" },
+  { 0x2E, "`" },
+  { 0x2F, "Ü" },
+  { 0x30, "*" },
+  { 0x31, "'" },
+  { 0x33, "Ö" },
+  { 0x34, "Ä" },
+  { 0x35, "°" },
+  { 0x36, ";" },
+  { 0x37, ":" },
+  { 0x38, "_" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_32_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Z" },
+  { 0x1D, "Y" },
+  { 0x2F, "Ü" },
+  { 0x33, "Ö" },
+  { 0x34, "Ä" },
+};
+
+const wa_keyboard_mapping LAYOUT_32_LAYER_3_ENTRIES[] = {
+  { 0x08, "€" },
+  { 0x10, "µ" },
+  { 0x14, "@" },
+  { 0x1F, "²" },
+  { 0x20, "³" },
+  { 0x24, "{" },
+  { 0x25, "[" },
+  { 0x26, "]" },
+  { 0x27, "}" },
+  { 0x2D, "\\" },
+  { 0x30, "~" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_32_LAYER_4_ENTRIES[] = {
+  { 0x10, "µ" },
+  { 0x14, "@" },
+  { 0x1F, "²" },
+  { 0x20, "³" },
+  { 0x24, "{" },
+  { 0x25, "[" },
+  { 0x26, "]" },
+  { 0x27, "}" },
+  { 0x2D, "ẞ" },
+  { 0x30, "~" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_32_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_32_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_32_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_32_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_32_LAYER_2_ENTRIES, 29u,
+  },
+  {
+    "altgr",
+    LAYOUT_32_LAYER_3_ENTRIES, 12u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_32_LAYER_4_ENTRIES, 11u,
+  },
+  {
+    "ctrl",
+    LAYOUT_32_LAYER_5_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_33_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "z" },
+  { 0x1D, "y" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "ß" },
+  { 0x2E, "´" },
+  { 0x2F, "ü" },
+  { 0x30, "+" },
+  { 0x31, "#" },
+  { 0x33, "ö" },
+  { 0x34, "ä" },
+  { 0x35, "^" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "-" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "<" },
+};
+
+const wa_keyboard_mapping LAYOUT_33_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Z" },
+  { 0x1D, "Y" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "§" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "&" },
+  { 0x24, "/" },
+  { 0x25, "(" },
+  { 0x26, ")" },
+  { 0x27, "=" },
+  { 0x2C, " " },
+  { 0x2D, "?" },
+  { 0x2E, "`" },
+  { 0x2F, "Ü" },
+  { 0x30, "*" },
+  { 0x31, "'" },
+  { 0x33, "Ö" },
+  { 0x34, "Ä" },
+  { 0x35, "°" },
+  { 0x36, ";" },
+  { 0x37, ":" },
+  { 0x38, "_" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_33_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Z" },
+  { 0x1D, "Y" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "§" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "&" },
+  { 0x24, "/" },
+  { 0x25, "(" },
+  { 0x26, ")" },
+  { 0x27, "=" },
+  { 0x2D, "?" },
+  { 0x2F, "Ü" },
+  { 0x30, "*" },
+  { 0x31, "'" },
+  { 0x33, "Ö" },
+  { 0x34, "Ä" },
+  { 0x36, ";" },
+  { 0x37, ":" },
+};
+
+const wa_keyboard_mapping LAYOUT_33_LAYER_3_ENTRIES[] = {
+  { 0x08, "€" },
+  { 0x10, "µ" },
+  { 0x14, "@" },
+  { 0x1F, "²" },
+  { 0x20, "³" },
+  { 0x24, "{" },
+  { 0x25, "[" },
+  { 0x26, "]" },
+  { 0x27, "}" },
+  { 0x2D, "\\" },
+  { 0x30, "~" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_33_LAYER_4_ENTRIES[] = {
+  { 0x2D, "ẞ" },
+};
+
+const wa_keyboard_mapping LAYOUT_33_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_33_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_33_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_33_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_33_LAYER_2_ENTRIES, 44u,
+  },
+  {
+    "altgr",
+    LAYOUT_33_LAYER_3_ENTRIES, 12u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_33_LAYER_4_ENTRIES, 1u,
+  },
+  {
+    "ctrl",
+    LAYOUT_33_LAYER_5_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_34_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "z" },
+  { 0x1D, "y" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "'" },
+  { 0x2E, "^" },
+  { 0x2F, "ü" },
+  { 0x30, "¨" },
+  { 0x31, "$" },
+  { 0x33, "ö" },
+  { 0x34, "ä" },
+  { 0x35, "§" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "-" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "<" },
+};
+
+const wa_keyboard_mapping LAYOUT_34_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Z" },
+  { 0x1D, "Y" },
+  { 0x1E, "+" },
+  { 0x1F, "\"" },
+  { 0x20, "*" },
+  { 0x21, "ç" },
+  { 0x22, "%" },
+  { 0x23, "&" },
+  { 0x24, "/" },
+  { 0x25, "(" },
+  { 0x26, ")" },
+  { 0x27, "=" },
+  { 0x2C, " " },
+  { 0x2D, "?" },
+  { 0x2E, "`" },
+  { 0x2F, "è" },
+  { 0x30, "!" },
+  { 0x31, "£" },
+  { 0x33, "é" },
+  { 0x34, "à" },
+  { 0x35, "°" },
+  { 0x36, ";" },
+  { 0x37, ":" },
+  { 0x38, "_" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_34_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Z" },
+  { 0x1D, "Y" },
+  { 0x2F, "Ü" },
+  { 0x33, "Ö" },
+  { 0x34, "Ä" },
+};
+
+const wa_keyboard_mapping LAYOUT_34_LAYER_3_ENTRIES[] = {
+  { 0x08, "€" },
+  { 0x1E, "¦" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "°" },
+  { 0x22, "§" },
+  { 0x23, "¬" },
+  { 0x24, "|" },
+  { 0x25, "¢" },
+  { 0x2D, "´" },
+  { 0x2E, "~" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "}" },
+  { 0x34, "{" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_34_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_34_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_34_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_34_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_34_LAYER_2_ENTRIES, 29u,
+  },
+  {
+    "altgr",
+    LAYOUT_34_LAYER_3_ENTRIES, 16u,
+  },
+  {
+    "ctrl",
+    LAYOUT_34_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_35_LAYER_0_ENTRIES[] = {
+  { 0x04, "ަ" },
+  { 0x05, "ބ" },
+  { 0x06, "ޗ" },
+  { 0x07, "ދ" },
+  { 0x08, "ެ" },
+  { 0x09, "ފ" },
+  { 0x0A, "ގ" },
+  { 0x0B, "ހ" },
+  { 0x0C, "ި" },
+  { 0x0D, "ޖ" },
+  { 0x0E, "ކ" },
+  { 0x0F, "ލ" },
+  { 0x10, "މ" },
+  { 0x11, "ނ" },
+  { 0x12, "ޮ" },
+  { 0x13, "ޕ" },
+  { 0x14, "ް" },
+  { 0x15, "ރ" },
+  { 0x16, "ސ" },
+  { 0x17, "ތ" },
+  { 0x18, "ު" },
+  { 0x19, "ވ" },
+  { 0x1A, "އ" },
+  { 0x1B, "×" },
+  { 0x1C, "ޔ" },
+  { 0x1D, "ޒ" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "]" },
+  { 0x30, "[" },
+  { 0x31, "\\" },
+  { 0x33, "؛" },
+  { 0x34, "'" },
+  { 0x35, "`" },
+  { 0x36, "،" },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_35_LAYER_1_ENTRIES[] = {
+  { 0x04, "ާ" },
+  { 0x05, "ޞ" },
+  { 0x06, "ޝ" },
+  { 0x07, "ޑ" },
+  { 0x08, "ޭ" },
+  { 0x09, "ﷲ" },
+  { 0x0A, "ޣ" },
+  { 0x0B, "ޙ" },
+  { 0x0C, "ީ" },
+  { 0x0D, "ޛ" },
+  { 0x0E, "ޚ" },
+  { 0x0F, "ޅ" },
+  { 0x10, "ޟ" },
+  { 0x11, "ޏ" },
+  { 0x12, "ޯ" },
+  { 0x13, "÷" },
+  { 0x14, "ޤ" },
+  { 0x15, "ޜ" },
+  { 0x16, "ށ" },
+  { 0x17, "ޓ" },
+  { 0x18, "ޫ" },
+  { 0x19, "ޥ" },
+  { 0x1A, "ޢ" },
+  { 0x1B, "ޘ" },
+  { 0x1C, "ޠ" },
+  { 0x1D, "ޡ" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, ")" },
+  { 0x27, "(" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "}" },
+  { 0x30, "{" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x36, ">" },
+  { 0x37, "<" },
+  { 0x38, "؟" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_35_LAYER_2_ENTRIES[] = {
+  { 0x05, "‌" },
+  { 0x10, "‏" },
+  { 0x11, "‎" },
+  { 0x19, "‍" },
+  { 0x33, ";" },
+  { 0x36, "," },
+};
+
+const wa_keyboard_mapping LAYOUT_35_LAYER_3_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_35_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_35_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_35_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "altgr",
+    LAYOUT_35_LAYER_2_ENTRIES, 6u,
+  },
+  {
+    "ctrl",
+    LAYOUT_35_LAYER_3_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_36_LAYER_0_ENTRIES[] = {
+  { 0x04, "ި" },
+  { 0x05, "ޅ" },
+  { 0x06, "ސ" },
+  { 0x07, "ް" },
+  { 0x08, "ާ" },
+  { 0x09, "ަ" },
+  { 0x0A, "ެ" },
+  { 0x0B, "ވ" },
+  { 0x0C, "މ" },
+  { 0x0D, "އ" },
+  { 0x0E, "ނ" },
+  { 0x0F, "ކ" },
+  { 0x10, "ބ" },
+  { 0x11, "ދ" },
+  { 0x12, "ތ" },
+  { 0x13, "ހ" },
+  { 0x14, "ޫ" },
+  { 0x15, "ީ" },
+  { 0x16, "ު" },
+  { 0x17, "ޭ" },
+  { 0x18, "ރ" },
+  { 0x19, "ޔ" },
+  { 0x1A, "ޮ" },
+  { 0x1B, "ޑ" },
+  { 0x1C, "ގ" },
+  { 0x1D, "ޒ" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "ލ" },
+  { 0x30, "[" },
+  { 0x31, "]" },
+  { 0x33, "ފ" },
+  { 0x34, "ﷲ" },
+  { 0x35, "`" },
+  { 0x36, "ށ" },
+  { 0x37, "ޓ" },
+  { 0x38, "ޯ" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_36_LAYER_1_ENTRIES[] = {
+  { 0x04, "<" },
+  { 0x05, "ޟ" },
+  { 0x06, "ޏ" },
+  { 0x07, "." },
+  { 0x08, "“" },
+  { 0x09, "،" },
+  { 0x0A, "\"" },
+  { 0x0B, "ޥ" },
+  { 0x0C, "ޣ" },
+  { 0x0D, "ޢ" },
+  { 0x0E, "ޘ" },
+  { 0x0F, "ޚ" },
+  { 0x10, "ޝ" },
+  { 0x11, "ޛ" },
+  { 0x12, "ޠ" },
+  { 0x13, "ޙ" },
+  { 0x14, "×" },
+  { 0x15, "/" },
+  { 0x16, ">" },
+  { 0x17, ":" },
+  { 0x18, "ޜ" },
+  { 0x19, "ޗ" },
+  { 0x1A, "’" },
+  { 0x1B, "ޕ" },
+  { 0x1C, "ޤ" },
+  { 0x1D, "ޖ" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, ")" },
+  { 0x27, "(" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "÷" },
+  { 0x30, "{" },
+  { 0x31, "}" },
+  { 0x33, "ޡ" },
+  { 0x34, "؛" },
+  { 0x35, "~" },
+  { 0x36, "\\" },
+  { 0x37, "ޞ" },
+  { 0x38, "؟" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_36_LAYER_2_ENTRIES[] = {
+  { 0x05, "‌" },
+  { 0x09, "," },
+  { 0x10, "‏" },
+  { 0x11, "‎" },
+  { 0x19, "‍" },
+  { 0x34, ";" },
+};
+
+const wa_keyboard_mapping LAYOUT_36_LAYER_3_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_36_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_36_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_36_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "altgr",
+    LAYOUT_36_LAYER_2_ENTRIES, 6u,
+  },
+  {
+    "ctrl",
+    LAYOUT_36_LAYER_3_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_37_LAYER_0_ENTRIES[] = {
+  { 0x04, "ཏ" },
+  { 0x05, "ར" },
+  { 0x06, "འ" },
+  { 0x07, "ད" },
+  { 0x08, "ག" },
+  { 0x09, "ན" },
+  { 0x0A, "པ" },
+  { 0x0B, "ཕ" },
+  { 0x0C, "ོ" },
+  { 0x0D, "བ" },
+  { 0x0E, "མ" },
+  { 0x0F, "ཙ" },
+  { 0x10, "ཤ" },
+  { 0x11, "ལ" },
+  { 0x12, "ཅ" },
+  { 0x13, "ཆ" },
+  { 0x14, "ཀ" },
+  { 0x15, "ང" },
+  { 0x16, "ཐ" },
+  { 0x17, "ི" },
+  { 0x18, "ེ" },
+  { 0x19, "ཡ" },
+  { 0x1A, "ཁ" },
+  { 0x1B, "ཟ" },
+  { 0x1C, "ུ" },
+  { 0x1D, "ཞ" },
+  { 0x1E, "༡" },
+  { 0x1F, "༢" },
+  { 0x20, "༣" },
+  { 0x21, "༤" },
+  { 0x22, "༥" },
+  { 0x23, "༦" },
+  { 0x24, "༧" },
+  { 0x25, "༨" },
+  { 0x26, "༩" },
+  { 0x27, "༠" },
+  { 0x2C, "་" },
+  { 0x2D, "༔" },
+  { 0x2E, "།" },
+  { 0x2F, "ཇ" },
+  { 0x30, "ཉ" },
+  { 0x31, "ཝ" },
+  { 0x33, "ཚ" },
+  { 0x34, "ཛ" },
+  { 0x35, "༉" },
+  { 0x36, "ས" },
+  { 0x37, "ཧ" },
+  { 0x38, "ཨ" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_37_LAYER_1_ENTRIES[] = {
+  { 0x04, "ྟ" },
+  { 0x05, "ྲ" },
+  { 0x06, "ཱ" },
+  { 0x07, "ྡ" },
+  { 0x08, "ྒ" },
+  { 0x09, "ྣ" },
+  { 0x0A, "ྤ" },
+  { 0x0B, "ྥ" },
+  { 0x0C, "ཽ" },
+  { 0x0D, "ྦ" },
+  { 0x0E, "ྨ" },
+  { 0x0F, "ྩ" },
+  { 0x10, "ྴ" },
+  { 0x11, "ླ" },
+  { 0x12, "ྕ" },
+  { 0x13, "ྖ" },
+  { 0x14, "ྐ" },
+  { 0x15, "ྔ" },
+  { 0x16, "ྠ" },
+  { 0x17, "ྀ" },
+  { 0x18, "ཻ" },
+  { 0x19, "ྱ" },
+  { 0x1A, "ྑ" },
+  { 0x1B, "ྯ" },
+  { 0x1C, "྄" },
+  { 0x1D, "ྮ" },
+  { 0x1E, "༄" },
+  { 0x1F, "༅" },
+  { 0x20, "༆" },
+  { 0x22, "༎" },
+  { 0x23, "༈" },
+  { 0x24, "༸" },
+  { 0x25, "༴" },
+  { 0x26, "༼" },
+  { 0x27, "༽" },
+  { 0x2C, " " },
+  { 0x2D, "ཿ" },
+  { 0x2E, "༑" },
+  { 0x2F, "ྗ" },
+  { 0x30, "ྙ" },
+  { 0x31, "ྭ" },
+  { 0x33, "ྪ" },
+  { 0x34, "ྫ" },
+  { 0x35, "༊" },
+  { 0x36, "ྶ" },
+  { 0x37, "ྷ" },
+  { 0x38, "ྸ" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_37_LAYER_2_ENTRIES[] = {
+  { 0x04, "ཊ" },
+  { 0x05, "ཪ" },
+  { 0x06, "༃" },
+  { 0x07, "ཌ" },
+  { 0x08, "ྌ" },
+  { 0x09, "ཎ" },
+  { 0x0C, "༝" },
+  { 0x0D, "༷" },
+  { 0x0E, "ཾ" },
+  { 0x0F, "༹" },
+  { 0x10, "ཥ" },
+  { 0x11, "༒" },
+  { 0x12, "༞" },
+  { 0x13, "༟" },
+  { 0x14, "ྈ" },
+  { 0x15, "ྃ" },
+  { 0x16, "ཋ" },
+  { 0x17, "༚" },
+  { 0x18, "༜" },
+  { 0x19, "༏" },
+  { 0x1A, "ྉ" },
+  { 0x1B, "྾" },
+  { 0x1C, "༛" },
+  { 0x1D, "༓" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, "༌" },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "(" },
+  { 0x30, ")" },
+  { 0x31, "\\" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x35, "࿑" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+};
+
+const wa_keyboard_mapping LAYOUT_37_LAYER_3_ENTRIES[] = {
+  { 0x04, "ྚ" },
+  { 0x05, "ྼ" },
+  { 0x06, "ྰ" },
+  { 0x07, "ྜ" },
+  { 0x08, "ྏ" },
+  { 0x09, "ྞ" },
+  { 0x0C, "༗" },
+  { 0x0D, "༵" },
+  { 0x0E, "྇" },
+  { 0x0F, "྆" },
+  { 0x10, "ྵ" },
+  { 0x12, "༘" },
+  { 0x13, "༙" },
+  { 0x14, "ྍ" },
+  { 0x15, "ྂ" },
+  { 0x16, "ྛ" },
+  { 0x17, "ྋྙ" },
+  { 0x19, "ྻ" },
+  { 0x1A, "ྎ" },
+  { 0x1B, "྿" },
+  { 0x1D, "༶" },
+  { 0x1E, "࿓" },
+  { 0x1F, "࿔" },
+  { 0x20, "༺" },
+  { 0x21, "༻" },
+  { 0x22, "྅" },
+  { 0x23, "༁" },
+  { 0x24, "ྊ" },
+  { 0x25, "*" },
+  { 0x2C, " " },
+  { 0x2D, "࿒" },
+  { 0x2E, "+" },
+  { 0x2F, "༿" },
+  { 0x30, "༾" },
+  { 0x31, "ྺ" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "࿐" },
+  { 0x36, "࿙" },
+  { 0x37, "࿚" },
+  { 0x38, "?" },
+};
+
+const wa_keyboard_mapping LAYOUT_37_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+};
+
+const wa_keyboard_layer LAYOUT_37_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_37_LAYER_0_ENTRIES, 52u,
+  },
+  {
+    "shift",
+    LAYOUT_37_LAYER_1_ENTRIES, 51u,
+  },
+  {
+    "altgr",
+    LAYOUT_37_LAYER_2_ENTRIES, 46u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_37_LAYER_3_ENTRIES, 41u,
+  },
+  {
+    "ctrl",
+    LAYOUT_37_LAYER_4_ENTRIES, 1u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_38_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "'" },
+  { 0x2E, "]" },
+  { 0x2F, "+" },
+  { 0x30, "}" },
+  { 0x31, "#" },
+  { 0x33, "΄" },
+  { 0x34, "¨" },
+  { 0x35, "\\" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "-" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "<" },
+};
+
+const wa_keyboard_mapping LAYOUT_38_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "&" },
+  { 0x24, "/" },
+  { 0x25, "(" },
+  { 0x26, ")" },
+  { 0x27, "=" },
+  { 0x2C, " " },
+  { 0x2D, "?" },
+  { 0x2E, "[" },
+  { 0x2F, "*" },
+  { 0x30, "{" },
+  { 0x31, "@" },
+  { 0x33, "¨" },
+  { 0x34, "΅" },
+  { 0x35, "|" },
+  { 0x36, ";" },
+  { 0x37, ":" },
+  { 0x38, "_" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_38_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+};
+
+const wa_keyboard_mapping LAYOUT_38_LAYER_3_ENTRIES[] = {
+  { 0x08, "€" },
+  { 0x1F, "²" },
+  { 0x20, "³" },
+  { 0x21, "£" },
+  { 0x22, "§" },
+  { 0x23, "¶" },
+  { 0x25, "¤" },
+  { 0x26, "¦" },
+  { 0x27, "°" },
+  { 0x2D, "±" },
+  { 0x2E, "½" },
+  { 0x2F, "«" },
+  { 0x30, "»" },
+  { 0x31, "¬" },
+  { 0x33, "΅" },
+  { 0x34, "΅" },
+};
+
+const wa_keyboard_mapping LAYOUT_38_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_38_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_38_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_38_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_38_LAYER_2_ENTRIES, 26u,
+  },
+  {
+    "altgr",
+    LAYOUT_38_LAYER_3_ENTRIES, 16u,
+  },
+  {
+    "ctrl",
+    LAYOUT_38_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_39_LAYER_0_ENTRIES[] = {
+  { 0x04, "α" },
+  { 0x05, "β" },
+  { 0x06, "ψ" },
+  { 0x07, "δ" },
+  { 0x08, "ε" },
+  { 0x09, "φ" },
+  { 0x0A, "γ" },
+  { 0x0B, "η" },
+  { 0x0C, "ι" },
+  { 0x0D, "ξ" },
+  { 0x0E, "κ" },
+  { 0x0F, "λ" },
+  { 0x10, "μ" },
+  { 0x11, "ν" },
+  { 0x12, "ο" },
+  { 0x13, "π" },
+  { 0x14, ";" },
+  { 0x15, "ρ" },
+  { 0x16, "σ" },
+  { 0x17, "τ" },
+  { 0x18, "θ" },
+  { 0x19, "ω" },
+  { 0x1A, "ς" },
+  { 0x1B, "χ" },
+  { 0x1C, "υ" },
+  { 0x1D, "ζ" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "'" },
+  { 0x2E, "]" },
+  { 0x2F, "+" },
+  { 0x30, "}" },
+  { 0x31, "#" },
+  { 0x33, "΄" },
+  { 0x34, "¨" },
+  { 0x35, "½" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "-" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "<" },
+};
+
+const wa_keyboard_mapping LAYOUT_39_LAYER_1_ENTRIES[] = {
+  { 0x04, "Α" },
+  { 0x05, "Β" },
+  { 0x06, "Ψ" },
+  { 0x07, "Δ" },
+  { 0x08, "Ε" },
+  { 0x09, "Φ" },
+  { 0x0A, "Γ" },
+  { 0x0B, "Η" },
+  { 0x0C, "Ι" },
+  { 0x0D, "Ξ" },
+  { 0x0E, "Κ" },
+  { 0x0F, "Λ" },
+  { 0x10, "Μ" },
+  { 0x11, "Ν" },
+  { 0x12, "Ο" },
+  { 0x13, "Π" },
+  { 0x14, ":" },
+  { 0x15, "Ρ" },
+  { 0x16, "Σ" },
+  { 0x17, "Τ" },
+  { 0x18, "Θ" },
+  { 0x19, "Ω" },
+  { 0x1A, "~" },
+  { 0x1B, "Χ" },
+  { 0x1C, "Υ" },
+  { 0x1D, "Ζ" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "£" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "&" },
+  { 0x24, "/" },
+  { 0x25, "(" },
+  { 0x26, ")" },
+  { 0x27, "=" },
+  { 0x2C, " " },
+  { 0x2D, "?" },
+  { 0x2E, "[" },
+  { 0x2F, "*" },
+  { 0x30, "{" },
+  { 0x31, "@" },
+  { 0x33, "¨" },
+  { 0x34, "΅" },
+  { 0x35, "±" },
+  { 0x36, ";" },
+  { 0x37, ":" },
+  { 0x38, "_" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_39_LAYER_2_ENTRIES[] = {
+  { 0x04, "Α" },
+  { 0x05, "Β" },
+  { 0x06, "Ψ" },
+  { 0x07, "Δ" },
+  { 0x08, "Ε" },
+  { 0x09, "Φ" },
+  { 0x0A, "Γ" },
+  { 0x0B, "Η" },
+  { 0x0C, "Ι" },
+  { 0x0D, "Ξ" },
+  { 0x0E, "Κ" },
+  { 0x0F, "Λ" },
+  { 0x10, "Μ" },
+  { 0x11, "Ν" },
+  { 0x12, "Ο" },
+  { 0x13, "Π" },
+  { 0x15, "Ρ" },
+  { 0x16, "Σ" },
+  { 0x17, "Τ" },
+  { 0x18, "Θ" },
+  { 0x19, "Ω" },
+  { 0x1B, "Χ" },
+  { 0x1C, "Υ" },
+  { 0x1D, "Ζ" },
+};
+
+const wa_keyboard_mapping LAYOUT_39_LAYER_3_ENTRIES[] = {
+  { 0x06, "©" },
+  { 0x08, "€" },
+  { 0x15, "®" },
+  { 0x1C, "¥" },
+  { 0x1F, "²" },
+  { 0x20, "³" },
+  { 0x21, "£" },
+  { 0x22, "§" },
+  { 0x23, "¶" },
+  { 0x25, "¤" },
+  { 0x26, "¦" },
+  { 0x27, "°" },
+  { 0x2D, "±" },
+  { 0x2E, "½" },
+  { 0x2F, "«" },
+  { 0x30, "»" },
+  { 0x31, "¬" },
+  { 0x33, "΅" },
+  { 0x34, "΅" },
+};
+
+const wa_keyboard_mapping LAYOUT_39_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_39_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_39_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_39_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_39_LAYER_2_ENTRIES, 24u,
+  },
+  {
+    "altgr",
+    LAYOUT_39_LAYER_3_ENTRIES, 19u,
+  },
+  {
+    "ctrl",
+    LAYOUT_39_LAYER_4_ENTRIES, 2u,
+  },
+};
+
@@ -0,0 +1,7967 @@
+#include "worldalphabets_data.h"
+
+const wa_keyboard_mapping LAYOUT_40_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "'" },
+  { 0x2E, "+" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "`" },
+  { 0x33, "´" },
+  { 0x34, "^" },
+  { 0x35, "\\" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "-" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "<" },
+};
+
+const wa_keyboard_mapping LAYOUT_40_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "&" },
+  { 0x24, "/" },
+  { 0x25, "(" },
+  { 0x26, ")" },
+  { 0x27, "=" },
+  { 0x2C, " " },
+  { 0x2D, "?" },
+  { 0x2E, "*" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "@" },
+  { 0x33, "¨" },
+  { 0x34, "~" },
+  { 0x35, "|" },
+  { 0x36, ";" },
+  { 0x37, ":" },
+  { 0x38, "_" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_40_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+};
+
+const wa_keyboard_mapping LAYOUT_40_LAYER_3_ENTRIES[] = {
+  { 0x08, "€" },
+};
+
+const wa_keyboard_mapping LAYOUT_40_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_40_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_40_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_40_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_40_LAYER_2_ENTRIES, 26u,
+  },
+  {
+    "altgr",
+    LAYOUT_40_LAYER_3_ENTRIES, 1u,
+  },
+  {
+    "ctrl",
+    LAYOUT_40_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_41_LAYER_0_ENTRIES[] = {
+  { 0x04, "α" },
+  { 0x05, "β" },
+  { 0x06, "ψ" },
+  { 0x07, "δ" },
+  { 0x08, "ε" },
+  { 0x09, "φ" },
+  { 0x0A, "γ" },
+  { 0x0B, "η" },
+  { 0x0C, "ι" },
+  { 0x0D, "ξ" },
+  { 0x0E, "κ" },
+  { 0x0F, "λ" },
+  { 0x10, "μ" },
+  { 0x11, "ν" },
+  { 0x12, "ο" },
+  { 0x13, "π" },
+  { 0x14, "·" },
+  { 0x15, "ρ" },
+  { 0x16, "σ" },
+  { 0x17, "τ" },
+  { 0x18, "θ" },
+  { 0x19, "ω" },
+  { 0x1A, "ς" },
+  { 0x1B, "χ" },
+  { 0x1C, "υ" },
+  { 0x1D, "ζ" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "'" },
+  { 0x2E, "+" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "²" },
+  { 0x33, "΄" },
+  { 0x34, "’" },
+  { 0x35, "½" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "-" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "§" },
+};
+
+const wa_keyboard_mapping LAYOUT_41_LAYER_1_ENTRIES[] = {
+  { 0x04, "Α" },
+  { 0x05, "Β" },
+  { 0x06, "Ψ" },
+  { 0x07, "Δ" },
+  { 0x08, "Ε" },
+  { 0x09, "Φ" },
+  { 0x0A, "Γ" },
+  { 0x0B, "Η" },
+  { 0x0C, "Ι" },
+  { 0x0D, "Ξ" },
+  { 0x0E, "Κ" },
+  { 0x0F, "Λ" },
+  { 0x10, "Μ" },
+  { 0x11, "Ν" },
+  { 0x12, "Ο" },
+  { 0x13, "Π" },
+  { 0x14, "―" },
+  { 0x15, "Ρ" },
+  { 0x16, "Σ" },
+  { 0x17, "Τ" },
+  { 0x18, "Θ" },
+  { 0x19, "Ω" },
+  { 0x1A, "¦" },
+  { 0x1B, "Χ" },
+  { 0x1C, "Υ" },
+  { 0x1D, "Ζ" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "£" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "¬" },
+  { 0x24, "/" },
+  { 0x25, "(" },
+  { 0x26, ")" },
+  { 0x27, "=" },
+  { 0x2C, " " },
+  { 0x2D, "°" },
+  { 0x2E, "*" },
+  { 0x2F, "«" },
+  { 0x30, "»" },
+  { 0x31, "³" },
+  { 0x33, "¨" },
+  { 0x34, "‘" },
+  { 0x35, "±" },
+  { 0x36, ";" },
+  { 0x37, ":" },
+  { 0x38, "_" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "©" },
+};
+
+const wa_keyboard_mapping LAYOUT_41_LAYER_2_ENTRIES[] = {
+  { 0x04, "Α" },
+  { 0x05, "Β" },
+  { 0x06, "Ψ" },
+  { 0x07, "Δ" },
+  { 0x08, "Ε" },
+  { 0x09, "Φ" },
+  { 0x0A, "Γ" },
+  { 0x0B, "Η" },
+  { 0x0C, "Ι" },
+  { 0x0D, "Ξ" },
+  { 0x0E, "Κ" },
+  { 0x0F, "Λ" },
+  { 0x10, "Μ" },
+  { 0x11, "Ν" },
+  { 0x12, "Ο" },
+  { 0x13, "Π" },
+  { 0x14, "―" },
+  { 0x15, "Ρ" },
+  { 0x16, "Σ" },
+  { 0x17, "Τ" },
+  { 0x18, "Θ" },
+  { 0x19, "Ω" },
+  { 0x1A, "¦" },
+  { 0x1B, "Χ" },
+  { 0x1C, "Υ" },
+  { 0x1D, "Ζ" },
+};
+
+const wa_keyboard_mapping LAYOUT_41_LAYER_3_ENTRIES[] = {
+  { 0x08, "€" },
+  { 0x33, "΅" },
+};
+
+const wa_keyboard_mapping LAYOUT_41_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_41_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_41_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_41_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_41_LAYER_2_ENTRIES, 26u,
+  },
+  {
+    "altgr",
+    LAYOUT_41_LAYER_3_ENTRIES, 2u,
+  },
+  {
+    "ctrl",
+    LAYOUT_41_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_42_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x35, "`" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_42_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_42_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+};
+
+const wa_keyboard_mapping LAYOUT_42_LAYER_3_ENTRIES[] = {
+  { 0x04, "á" },
+  { 0x06, "©" },
+  { 0x07, "ð" },
+  { 0x08, "é" },
+  { 0x0C, "í" },
+  { 0x0F, "ø" },
+  { 0x10, "µ" },
+  { 0x11, "ñ" },
+  { 0x12, "ó" },
+  { 0x13, "ö" },
+  { 0x14, "ä" },
+  { 0x15, "®" },
+  { 0x16, "ß" },
+  { 0x17, "þ" },
+  { 0x18, "ú" },
+  { 0x1A, "å" },
+  { 0x1C, "ü" },
+  { 0x1D, "æ" },
+  { 0x1E, "¡" },
+  { 0x1F, "²" },
+  { 0x20, "³" },
+  { 0x21, "¤" },
+  { 0x22, "€" },
+  { 0x23, "¼" },
+  { 0x24, "½" },
+  { 0x25, "¾" },
+  { 0x26, "‘" },
+  { 0x27, "’" },
+  { 0x2D, "¥" },
+  { 0x2E, "×" },
+  { 0x2F, "«" },
+  { 0x30, "»" },
+  { 0x31, "¬" },
+  { 0x33, "¶" },
+  { 0x34, "´" },
+  { 0x36, "ç" },
+  { 0x38, "¿" },
+};
+
+const wa_keyboard_mapping LAYOUT_42_LAYER_4_ENTRIES[] = {
+  { 0x04, "Á" },
+  { 0x06, "¢" },
+  { 0x07, "Ð" },
+  { 0x08, "É" },
+  { 0x0C, "Í" },
+  { 0x0F, "Ø" },
+  { 0x11, "Ñ" },
+  { 0x12, "Ó" },
+  { 0x13, "Ö" },
+  { 0x14, "Ä" },
+  { 0x16, "§" },
+  { 0x17, "Þ" },
+  { 0x18, "Ú" },
+  { 0x1A, "Å" },
+  { 0x1C, "Ü" },
+  { 0x1D, "Æ" },
+  { 0x1E, "¹" },
+  { 0x21, "£" },
+  { 0x2E, "÷" },
+  { 0x31, "¦" },
+  { 0x33, "°" },
+  { 0x34, "¨" },
+  { 0x36, "Ç" },
+};
+
+const wa_keyboard_mapping LAYOUT_42_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_42_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_42_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_42_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_42_LAYER_2_ENTRIES, 26u,
+  },
+  {
+    "altgr",
+    LAYOUT_42_LAYER_3_ENTRIES, 37u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_42_LAYER_4_ENTRIES, 23u,
+  },
+  {
+    "ctrl",
+    LAYOUT_42_LAYER_5_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_43_LAYER_0_ENTRIES[] = {
+  { 0x04, "α" },
+  { 0x05, "β" },
+  { 0x06, "ψ" },
+  { 0x07, "δ" },
+  { 0x08, "ε" },
+  { 0x09, "φ" },
+  { 0x0A, "γ" },
+  { 0x0B, "η" },
+  { 0x0C, "ι" },
+  { 0x0D, "ξ" },
+  { 0x0E, "κ" },
+  { 0x0F, "λ" },
+  { 0x10, "μ" },
+  { 0x11, "ν" },
+  { 0x12, "ο" },
+  { 0x13, "π" },
+  { 0x14, ";" },
+  { 0x15, "ρ" },
+  { 0x16, "σ" },
+  { 0x17, "τ" },
+  { 0x18, "θ" },
+  { 0x19, "ω" },
+  { 0x1A, "ς" },
+  { 0x1B, "χ" },
+  { 0x1C, "υ" },
+  { 0x1D, "ζ" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x33, "΄" },
+  { 0x34, "'" },
+  { 0x35, "~" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "<" },
+};
+
+const wa_keyboard_mapping LAYOUT_43_LAYER_1_ENTRIES[] = {
+  { 0x04, "Α" },
+  { 0x05, "Β" },
+  { 0x06, "Ψ" },
+  { 0x07, "Δ" },
+  { 0x08, "Ε" },
+  { 0x09, "Φ" },
+  { 0x0A, "Γ" },
+  { 0x0B, "Η" },
+  { 0x0C, "Ι" },
+  { 0x0D, "Ξ" },
+  { 0x0E, "Κ" },
+  { 0x0F, "Λ" },
+  { 0x10, "Μ" },
+  { 0x11, "Ν" },
+  { 0x12, "Ο" },
+  { 0x13, "Π" },
+  { 0x14, ":" },
+  { 0x15, "Ρ" },
+  { 0x16, "Σ" },
+  { 0x17, "Τ" },
+  { 0x18, "Θ" },
+  { 0x19, "Ω" },
+  { 0x1A, "΅" },
+  { 0x1B, "Χ" },
+  { 0x1C, "Υ" },
+  { 0x1D, "Ζ" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "|" },
+  { 0x33, "¨" },
+  { 0x34, "\"" },
+  { 0x35, "`" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_43_LAYER_2_ENTRIES[] = {
+  { 0x04, "Α" },
+  { 0x05, "Β" },
+  { 0x06, "Ψ" },
+  { 0x07, "Δ" },
+  { 0x08, "Ε" },
+  { 0x09, "Φ" },
+  { 0x0A, "Γ" },
+  { 0x0B, "Η" },
+  { 0x0C, "Ι" },
+  { 0x0D, "Ξ" },
+  { 0x0E, "Κ" },
+  { 0x0F, "Λ" },
+  { 0x10, "Μ" },
+  { 0x11, "Ν" },
+  { 0x12, "Ο" },
+  { 0x13, "Π" },
+  { 0x15, "Ρ" },
+  { 0x16, "Σ" },
+  { 0x17, "Τ" },
+  { 0x18, "Θ" },
+  { 0x19, "Ω" },
+  { 0x1B, "Χ" },
+  { 0x1C, "Υ" },
+  { 0x1D, "Ζ" },
+};
+
+const wa_keyboard_mapping LAYOUT_43_LAYER_3_ENTRIES[] = {
+  { 0x06, "©" },
+  { 0x08, "€" },
+  { 0x14, "´" },
+  { 0x15, "®" },
+  { 0x1C, "¥" },
+  { 0x1E, "Ϛ" },
+  { 0x1F, "Ϟ" },
+  { 0x20, "Ϡ" },
+  { 0x21, "£" },
+  { 0x22, "§" },
+  { 0x23, "¶" },
+  { 0x25, "¤" },
+  { 0x26, "¦" },
+  { 0x27, "°" },
+  { 0x2D, "±" },
+  { 0x2E, "½" },
+  { 0x2F, "«" },
+  { 0x30, "»" },
+  { 0x31, "¬" },
+  { 0x33, "΅" },
+  { 0x34, "᾿" },
+  { 0x35, "῁" },
+  { 0x38, "ι" },
+};
+
+const wa_keyboard_mapping LAYOUT_43_LAYER_4_ENTRIES[] = {
+  { 0x1F, "²" },
+  { 0x20, "³" },
+  { 0x2E, "῟" },
+  { 0x30, "·" },
+  { 0x31, "῝" },
+  { 0x34, "῾" },
+  { 0x38, "῞" },
+};
+
+const wa_keyboard_mapping LAYOUT_43_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_43_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_43_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_43_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_43_LAYER_2_ENTRIES, 24u,
+  },
+  {
+    "altgr",
+    LAYOUT_43_LAYER_3_ENTRIES, 23u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_43_LAYER_4_ENTRIES, 7u,
+  },
+  {
+    "ctrl",
+    LAYOUT_43_LAYER_5_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_44_LAYER_0_ENTRIES[] = {
+  { 0x04, "α" },
+  { 0x05, "β" },
+  { 0x06, "ψ" },
+  { 0x07, "δ" },
+  { 0x08, "ε" },
+  { 0x09, "φ" },
+  { 0x0A, "γ" },
+  { 0x0B, "η" },
+  { 0x0C, "ι" },
+  { 0x0D, "ξ" },
+  { 0x0E, "κ" },
+  { 0x0F, "λ" },
+  { 0x10, "μ" },
+  { 0x11, "ν" },
+  { 0x12, "ο" },
+  { 0x13, "π" },
+  { 0x14, ";" },
+  { 0x15, "ρ" },
+  { 0x16, "σ" },
+  { 0x17, "τ" },
+  { 0x18, "θ" },
+  { 0x19, "ω" },
+  { 0x1A, "ς" },
+  { 0x1B, "χ" },
+  { 0x1C, "υ" },
+  { 0x1D, "ζ" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x33, "΄" },
+  { 0x34, "'" },
+  { 0x35, "`" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "<" },
+};
+
+const wa_keyboard_mapping LAYOUT_44_LAYER_1_ENTRIES[] = {
+  { 0x04, "Α" },
+  { 0x05, "Β" },
+  { 0x06, "Ψ" },
+  { 0x07, "Δ" },
+  { 0x08, "Ε" },
+  { 0x09, "Φ" },
+  { 0x0A, "Γ" },
+  { 0x0B, "Η" },
+  { 0x0C, "Ι" },
+  { 0x0D, "Ξ" },
+  { 0x0E, "Κ" },
+  { 0x0F, "Λ" },
+  { 0x10, "Μ" },
+  { 0x11, "Ν" },
+  { 0x12, "Ο" },
+  { 0x13, "Π" },
+  { 0x14, ":" },
+  { 0x15, "Ρ" },
+  { 0x16, "Σ" },
+  { 0x17, "Τ" },
+  { 0x18, "Θ" },
+  { 0x19, "Ω" },
+  { 0x1A, "΅" },
+  { 0x1B, "Χ" },
+  { 0x1C, "Υ" },
+  { 0x1D, "Ζ" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "|" },
+  { 0x33, "¨" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_44_LAYER_2_ENTRIES[] = {
+  { 0x04, "Α" },
+  { 0x05, "Β" },
+  { 0x06, "Ψ" },
+  { 0x07, "Δ" },
+  { 0x08, "Ε" },
+  { 0x09, "Φ" },
+  { 0x0A, "Γ" },
+  { 0x0B, "Η" },
+  { 0x0C, "Ι" },
+  { 0x0D, "Ξ" },
+  { 0x0E, "Κ" },
+  { 0x0F, "Λ" },
+  { 0x10, "Μ" },
+  { 0x11, "Ν" },
+  { 0x12, "Ο" },
+  { 0x13, "Π" },
+  { 0x15, "Ρ" },
+  { 0x16, "Σ" },
+  { 0x17, "Τ" },
+  { 0x18, "Θ" },
+  { 0x19, "Ω" },
+  { 0x1B, "Χ" },
+  { 0x1C, "Υ" },
+  { 0x1D, "Ζ" },
+};
+
+const wa_keyboard_mapping LAYOUT_44_LAYER_3_ENTRIES[] = {
+  { 0x06, "©" },
+  { 0x08, "€" },
+  { 0x15, "®" },
+  { 0x1C, "¥" },
+  { 0x1F, "²" },
+  { 0x20, "³" },
+  { 0x21, "£" },
+  { 0x22, "§" },
+  { 0x23, "¶" },
+  { 0x25, "¤" },
+  { 0x26, "¦" },
+  { 0x27, "°" },
+  { 0x2D, "±" },
+  { 0x2E, "½" },
+  { 0x2F, "«" },
+  { 0x30, "»" },
+  { 0x31, "¬" },
+  { 0x33, "΅" },
+};
+
+const wa_keyboard_mapping LAYOUT_44_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_44_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_44_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_44_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_44_LAYER_2_ENTRIES, 24u,
+  },
+  {
+    "altgr",
+    LAYOUT_44_LAYER_3_ENTRIES, 18u,
+  },
+  {
+    "ctrl",
+    LAYOUT_44_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_45_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x33, ";" },
+  { 0x34, "#" },
+  { 0x35, "'" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "`" },
+};
+
+const wa_keyboard_mapping LAYOUT_45_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "Â£" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "~" },
+  { 0x35, "@" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "Â¬" },
+};
+
+const wa_keyboard_mapping LAYOUT_45_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+};
+
+const wa_keyboard_mapping LAYOUT_45_LAYER_3_ENTRIES[] = {
+  { 0x04, "Ã¡" },
+  { 0x08, "Ã©" },
+  { 0x0C, "Ã­" },
+  { 0x12, "Ã³" },
+  { 0x18, "Ãº" },
+  { 0x21, "â¬" },
+  { 0x34, "\\" },
+  { 0x64, "Â¦" },
+};
+
+const wa_keyboard_mapping LAYOUT_45_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_45_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_45_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_45_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_45_LAYER_2_ENTRIES, 26u,
+  },
+  {
+    "altgr",
+    LAYOUT_45_LAYER_3_ENTRIES, 8u,
+  },
+  {
+    "ctrl",
+    LAYOUT_45_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_46_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x35, "`" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_46_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_46_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+};
+
+const wa_keyboard_mapping LAYOUT_46_LAYER_3_ENTRIES[] = {
+  { 0x04, "ā" },
+  { 0x07, "ḍ" },
+  { 0x08, "ē" },
+  { 0x0A, "ṅ" },
+  { 0x0B, "ḥ" },
+  { 0x0C, "ī" },
+  { 0x0F, "l̥" },
+  { 0x10, "ṁ" },
+  { 0x11, "ṇ" },
+  { 0x12, "ō" },
+  { 0x14, "æ" },
+  { 0x15, "r̥" },
+  { 0x16, "ś" },
+  { 0x17, "ṭ" },
+  { 0x18, "ū" },
+  { 0x1B, "ṣ" },
+  { 0x1C, "ñ" },
+  { 0x21, "₹" },
+  { 0x2D, "-" },
+  { 0x2E, "–" },
+  { 0x34, "'" },
+  { 0x35, "`" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+};
+
+const wa_keyboard_mapping LAYOUT_46_LAYER_4_ENTRIES[] = {
+  { 0x04, "Ā" },
+  { 0x07, "Ḍ" },
+  { 0x08, "Ē" },
+  { 0x0A, "Ṅ" },
+  { 0x0B, "Ḥ" },
+  { 0x0C, "Ī" },
+  { 0x0F, "L̥" },
+  { 0x10, "Ṁ" },
+  { 0x11, "Ṇ" },
+  { 0x12, "Ō" },
+  { 0x14, "Æ" },
+  { 0x15, "R̥" },
+  { 0x16, "Ś" },
+  { 0x17, "Ṭ" },
+  { 0x18, "Ū" },
+  { 0x1B, "Ṣ" },
+  { 0x1C, "Ñ" },
+  { 0x23, "ˆ" },
+  { 0x26, "˘" },
+  { 0x2D, "ˍ" },
+  { 0x2E, "—" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x36, "<" },
+  { 0x38, "§" },
+};
+
+const wa_keyboard_mapping LAYOUT_46_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+};
+
+const wa_keyboard_layer LAYOUT_46_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_46_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_46_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_46_LAYER_2_ENTRIES, 26u,
+  },
+  {
+    "altgr",
+    LAYOUT_46_LAYER_3_ENTRIES, 25u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_46_LAYER_4_ENTRIES, 25u,
+  },
+  {
+    "ctrl",
+    LAYOUT_46_LAYER_5_ENTRIES, 1u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_47_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "#" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x35, "`" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_47_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "£" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "~" },
+  { 0x33, ":" },
+  { 0x34, "@" },
+  { 0x35, "¬" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_47_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+};
+
+const wa_keyboard_mapping LAYOUT_47_LAYER_3_ENTRIES[] = {
+  { 0x04, "á" },
+  { 0x08, "é" },
+  { 0x0C, "í" },
+  { 0x12, "ó" },
+  { 0x18, "ú" },
+  { 0x21, "€" },
+  { 0x31, "\\" },
+  { 0x35, "¦" },
+};
+
+const wa_keyboard_mapping LAYOUT_47_LAYER_4_ENTRIES[] = {
+  { 0x04, "Á" },
+  { 0x08, "É" },
+  { 0x0C, "Í" },
+  { 0x12, "Ó" },
+  { 0x18, "Ú" },
+  { 0x31, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_47_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_47_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_47_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_47_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_47_LAYER_2_ENTRIES, 26u,
+  },
+  {
+    "altgr",
+    LAYOUT_47_LAYER_3_ENTRIES, 8u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_47_LAYER_4_ENTRIES, 6u,
+  },
+  {
+    "ctrl",
+    LAYOUT_47_LAYER_5_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_48_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "x" },
+  { 0x06, "j" },
+  { 0x07, "e" },
+  { 0x08, "." },
+  { 0x09, "u" },
+  { 0x0A, "i" },
+  { 0x0B, "d" },
+  { 0x0C, "c" },
+  { 0x0D, "h" },
+  { 0x0E, "t" },
+  { 0x0F, "n" },
+  { 0x10, "m" },
+  { 0x11, "b" },
+  { 0x12, "r" },
+  { 0x13, "l" },
+  { 0x14, "'" },
+  { 0x15, "p" },
+  { 0x16, "o" },
+  { 0x17, "y" },
+  { 0x18, "g" },
+  { 0x19, "k" },
+  { 0x1A, "," },
+  { 0x1B, "q" },
+  { 0x1C, "f" },
+  { 0x1D, ";" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "[" },
+  { 0x2E, "]" },
+  { 0x2F, "/" },
+  { 0x30, "=" },
+  { 0x31, "\\" },
+  { 0x33, "s" },
+  { 0x34, "-" },
+  { 0x35, "`" },
+  { 0x36, "w" },
+  { 0x37, "v" },
+  { 0x38, "z" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_48_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "X" },
+  { 0x06, "J" },
+  { 0x07, "E" },
+  { 0x08, ">" },
+  { 0x09, "U" },
+  { 0x0A, "I" },
+  { 0x0B, "D" },
+  { 0x0C, "C" },
+  { 0x0D, "H" },
+  { 0x0E, "T" },
+  { 0x0F, "N" },
+  { 0x10, "M" },
+  { 0x11, "B" },
+  { 0x12, "R" },
+  { 0x13, "L" },
+  { 0x14, "\"" },
+  { 0x15, "P" },
+  { 0x16, "O" },
+  { 0x17, "Y" },
+  { 0x18, "G" },
+  { 0x19, "K" },
+  { 0x1A, "<" },
+  { 0x1B, "Q" },
+  { 0x1C, "F" },
+  { 0x1D, ":" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "{" },
+  { 0x2E, "}" },
+  { 0x2F, "?" },
+  { 0x30, "+" },
+  { 0x31, "|" },
+  { 0x33, "S" },
+  { 0x34, "_" },
+  { 0x35, "~" },
+  { 0x36, "W" },
+  { 0x37, "V" },
+  { 0x38, "Z" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_48_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "X" },
+  { 0x06, "J" },
+  { 0x07, "E" },
+  { 0x09, "U" },
+  { 0x0A, "I" },
+  { 0x0B, "D" },
+  { 0x0C, "C" },
+  { 0x0D, "H" },
+  { 0x0E, "T" },
+  { 0x0F, "N" },
+  { 0x10, "M" },
+  { 0x11, "B" },
+  { 0x12, "R" },
+  { 0x13, "L" },
+  { 0x15, "P" },
+  { 0x16, "O" },
+  { 0x17, "Y" },
+  { 0x18, "G" },
+  { 0x19, "K" },
+  { 0x1B, "Q" },
+  { 0x1C, "F" },
+  { 0x33, "S" },
+  { 0x36, "W" },
+  { 0x37, "V" },
+  { 0x38, "Z" },
+};
+
+const wa_keyboard_mapping LAYOUT_48_LAYER_3_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_48_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_48_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_48_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_48_LAYER_2_ENTRIES, 26u,
+  },
+  {
+    "ctrl",
+    LAYOUT_48_LAYER_3_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_49_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x35, "`" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_49_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_49_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+};
+
+const wa_keyboard_mapping LAYOUT_49_LAYER_3_ENTRIES[] = {
+  { 0x04, "á" },
+  { 0x06, "©" },
+  { 0x07, "ð" },
+  { 0x08, "é" },
+  { 0x0C, "í" },
+  { 0x0F, "ø" },
+  { 0x10, "µ" },
+  { 0x11, "ñ" },
+  { 0x12, "ó" },
+  { 0x13, "ö" },
+  { 0x14, "ä" },
+  { 0x15, "®" },
+  { 0x16, "ß" },
+  { 0x17, "þ" },
+  { 0x18, "ú" },
+  { 0x1A, "å" },
+  { 0x1C, "ü" },
+  { 0x1D, "æ" },
+  { 0x1E, "¡" },
+  { 0x1F, "²" },
+  { 0x20, "³" },
+  { 0x21, "¤" },
+  { 0x22, "€" },
+  { 0x23, "¼" },
+  { 0x24, "½" },
+  { 0x25, "¾" },
+  { 0x26, "‘" },
+  { 0x27, "’" },
+  { 0x2D, "¥" },
+  { 0x2E, "×" },
+  { 0x2F, "«" },
+  { 0x30, "»" },
+  { 0x31, "¬" },
+  { 0x33, "¶" },
+  { 0x34, "´" },
+  { 0x36, "ç" },
+  { 0x38, "¿" },
+};
+
+const wa_keyboard_mapping LAYOUT_49_LAYER_4_ENTRIES[] = {
+  { 0x04, "Á" },
+  { 0x06, "¢" },
+  { 0x07, "Ð" },
+  { 0x08, "É" },
+  { 0x0C, "Í" },
+  { 0x0F, "Ø" },
+  { 0x11, "Ñ" },
+  { 0x12, "Ó" },
+  { 0x13, "Ö" },
+  { 0x14, "Ä" },
+  { 0x16, "§" },
+  { 0x17, "Þ" },
+  { 0x18, "Ú" },
+  { 0x1A, "Å" },
+  { 0x1C, "Ü" },
+  { 0x1D, "Æ" },
+  { 0x1E, "¹" },
+  { 0x21, "£" },
+  { 0x2E, "÷" },
+  { 0x31, "¦" },
+  { 0x33, "°" },
+  { 0x34, "¨" },
+  { 0x36, "Ç" },
+};
+
+const wa_keyboard_mapping LAYOUT_49_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_49_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_49_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_49_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_49_LAYER_2_ENTRIES, 26u,
+  },
+  {
+    "altgr",
+    LAYOUT_49_LAYER_3_ENTRIES, 37u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_49_LAYER_4_ENTRIES, 23u,
+  },
+  {
+    "ctrl",
+    LAYOUT_49_LAYER_5_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_50_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "`" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x35, "<" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_50_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "~" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, ">" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_50_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+};
+
+const wa_keyboard_mapping LAYOUT_50_LAYER_3_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_50_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_50_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_50_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_50_LAYER_2_ENTRIES, 26u,
+  },
+  {
+    "ctrl",
+    LAYOUT_50_LAYER_3_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_51_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x35, "`" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_51_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_51_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+};
+
+const wa_keyboard_mapping LAYOUT_51_LAYER_3_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_51_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_51_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_51_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_51_LAYER_2_ENTRIES, 26u,
+  },
+  {
+    "ctrl",
+    LAYOUT_51_LAYER_3_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_52_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "'" },
+  { 0x2E, "¿" },
+  { 0x2F, "´" },
+  { 0x30, "+" },
+  { 0x31, "}" },
+  { 0x33, "ñ" },
+  { 0x34, "{" },
+  { 0x35, "|" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "-" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "<" },
+};
+
+const wa_keyboard_mapping LAYOUT_52_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "&" },
+  { 0x24, "/" },
+  { 0x25, "(" },
+  { 0x26, ")" },
+  { 0x27, "=" },
+  { 0x2C, " " },
+  { 0x2D, "?" },
+  { 0x2E, "¡" },
+  { 0x2F, "¨" },
+  { 0x30, "*" },
+  { 0x31, "]" },
+  { 0x33, "Ñ" },
+  { 0x34, "[" },
+  { 0x35, "°" },
+  { 0x36, ";" },
+  { 0x37, ":" },
+  { 0x38, "_" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_52_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x33, "Ñ" },
+};
+
+const wa_keyboard_mapping LAYOUT_52_LAYER_3_ENTRIES[] = {
+  { 0x14, "@" },
+  { 0x2D, "\\" },
+  { 0x30, "~" },
+  { 0x31, "`" },
+  { 0x34, "^" },
+  { 0x35, "¬" },
+};
+
+const wa_keyboard_mapping LAYOUT_52_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_52_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_52_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_52_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_52_LAYER_2_ENTRIES, 27u,
+  },
+  {
+    "altgr",
+    LAYOUT_52_LAYER_3_ENTRIES, 6u,
+  },
+  {
+    "ctrl",
+    LAYOUT_52_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_53_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "¨" },
+  { 0x2F, "÷" },
+  { 0x30, "`" },
+  { 0x31, "´" },
+  { 0x33, "ñ" },
+  { 0x34, "ç" },
+  { 0x35, "'" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "=" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "<" },
+};
+
+const wa_keyboard_mapping LAYOUT_53_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "ª" },
+  { 0x1F, "\"" },
+  { 0x20, "/" },
+  { 0x21, "(" },
+  { 0x22, ")" },
+  { 0x23, "¡" },
+  { 0x24, "!" },
+  { 0x25, "¿" },
+  { 0x26, "?" },
+  { 0x27, "₧" },
+  { 0x2C, " " },
+  { 0x2D, "+" },
+  { 0x2E, "¨" },
+  { 0x2F, "×" },
+  { 0x30, "`" },
+  { 0x31, "´" },
+  { 0x33, "Ñ" },
+  { 0x34, "Ç" },
+  { 0x35, "·" },
+  { 0x36, ";" },
+  { 0x37, ":" },
+  { 0x38, "%" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_53_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x2F, "×" },
+  { 0x33, "Ñ" },
+  { 0x34, "Ç" },
+};
+
+const wa_keyboard_mapping LAYOUT_53_LAYER_3_ENTRIES[] = {
+  { 0x04, "$" },
+  { 0x07, "@" },
+  { 0x08, "€" },
+  { 0x09, "[" },
+  { 0x0A, "]" },
+  { 0x0B, "|" },
+  { 0x0D, "£" },
+  { 0x0E, "±" },
+  { 0x16, "&" },
+  { 0x1E, "|" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "¼" },
+  { 0x22, "½" },
+  { 0x23, "¬" },
+  { 0x24, "_" },
+  { 0x25, "#" },
+  { 0x26, "§" },
+  { 0x27, "\\" },
+  { 0x2D, "*" },
+  { 0x2E, "~" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "}" },
+  { 0x33, "~" },
+  { 0x34, "{" },
+  { 0x35, "\\" },
+  { 0x37, "^" },
+};
+
+const wa_keyboard_mapping LAYOUT_53_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_53_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_53_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_53_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_53_LAYER_2_ENTRIES, 29u,
+  },
+  {
+    "altgr",
+    LAYOUT_53_LAYER_3_ENTRIES, 28u,
+  },
+  {
+    "ctrl",
+    LAYOUT_53_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_54_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "'" },
+  { 0x2E, "¡" },
+  { 0x2F, "`" },
+  { 0x30, "+" },
+  { 0x31, "ç" },
+  { 0x33, "ñ" },
+  { 0x34, "´" },
+  { 0x35, "º" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "-" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "<" },
+};
+
+const wa_keyboard_mapping LAYOUT_54_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "·" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "&" },
+  { 0x24, "/" },
+  { 0x25, "(" },
+  { 0x26, ")" },
+  { 0x27, "=" },
+  { 0x2C, " " },
+  { 0x2D, "?" },
+  { 0x2E, "¿" },
+  { 0x2F, "^" },
+  { 0x30, "*" },
+  { 0x31, "Ç" },
+  { 0x33, "Ñ" },
+  { 0x34, "¨" },
+  { 0x35, "ª" },
+  { 0x36, ";" },
+  { 0x37, ":" },
+  { 0x38, "_" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_54_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x31, "Ç" },
+  { 0x33, "Ñ" },
+};
+
+const wa_keyboard_mapping LAYOUT_54_LAYER_3_ENTRIES[] = {
+  { 0x08, "€" },
+  { 0x1E, "|" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "~" },
+  { 0x22, "€" },
+  { 0x23, "¬" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "}" },
+  { 0x34, "{" },
+  { 0x35, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_54_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_54_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_54_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_54_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_54_LAYER_2_ENTRIES, 28u,
+  },
+  {
+    "altgr",
+    LAYOUT_54_LAYER_3_ENTRIES, 12u,
+  },
+  {
+    "ctrl",
+    LAYOUT_54_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_55_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "+" },
+  { 0x2E, "´" },
+  { 0x2F, "ü" },
+  { 0x30, "õ" },
+  { 0x31, "'" },
+  { 0x33, "ö" },
+  { 0x34, "ä" },
+  { 0x35, "ˇ" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "-" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "<" },
+};
+
+const wa_keyboard_mapping LAYOUT_55_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "#" },
+  { 0x21, "¤" },
+  { 0x22, "%" },
+  { 0x23, "&" },
+  { 0x24, "/" },
+  { 0x25, "(" },
+  { 0x26, ")" },
+  { 0x27, "=" },
+  { 0x2C, " " },
+  { 0x2D, "?" },
+  { 0x2E, "`" },
+  { 0x2F, "Ü" },
+  { 0x30, "Õ" },
+  { 0x31, "*" },
+  { 0x33, "Ö" },
+  { 0x34, "Ä" },
+  { 0x35, "~" },
+  { 0x36, ";" },
+  { 0x37, ":" },
+  { 0x38, "_" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_55_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x2F, "Ü" },
+  { 0x30, "Õ" },
+  { 0x33, "Ö" },
+  { 0x34, "Ä" },
+};
+
+const wa_keyboard_mapping LAYOUT_55_LAYER_3_ENTRIES[] = {
+  { 0x08, "€" },
+  { 0x16, "š" },
+  { 0x1D, "ž" },
+  { 0x1F, "@" },
+  { 0x20, "£" },
+  { 0x21, "$" },
+  { 0x22, "€" },
+  { 0x24, "{" },
+  { 0x25, "[" },
+  { 0x26, "]" },
+  { 0x27, "}" },
+  { 0x2D, "\\" },
+  { 0x30, "§" },
+  { 0x31, "½" },
+  { 0x34, "^" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_55_LAYER_4_ENTRIES[] = {
+  { 0x16, "Š" },
+  { 0x1D, "Ž" },
+  { 0x1F, "@" },
+  { 0x20, "£" },
+  { 0x21, "$" },
+  { 0x24, "{" },
+  { 0x25, "[" },
+  { 0x26, "]" },
+  { 0x27, "}" },
+  { 0x2D, "\\" },
+  { 0x30, "§" },
+  { 0x31, "½" },
+  { 0x34, "^" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_55_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_55_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_55_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_55_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_55_LAYER_2_ENTRIES, 30u,
+  },
+  {
+    "altgr",
+    LAYOUT_55_LAYER_3_ENTRIES, 16u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_55_LAYER_4_ENTRIES, 14u,
+  },
+  {
+    "ctrl",
+    LAYOUT_55_LAYER_5_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_56_LAYER_0_ENTRIES[] = {
+  { 0x04, "ش" },
+  { 0x05, "ذ" },
+  { 0x06, "ز" },
+  { 0x07, "ی" },
+  { 0x08, "ث" },
+  { 0x09, "ب" },
+  { 0x0A, "ل" },
+  { 0x0B, "ا" },
+  { 0x0C, "ه" },
+  { 0x0D, "ت" },
+  { 0x0E, "ن" },
+  { 0x0F, "م" },
+  { 0x10, "پ" },
+  { 0x11, "د" },
+  { 0x12, "خ" },
+  { 0x13, "ح" },
+  { 0x14, "ض" },
+  { 0x15, "ق" },
+  { 0x16, "س" },
+  { 0x17, "ف" },
+  { 0x18, "ع" },
+  { 0x19, "ر" },
+  { 0x1A, "ص" },
+  { 0x1B, "ط" },
+  { 0x1C, "غ" },
+  { 0x1D, "ظ" },
+  { 0x1E, "۱" },
+  { 0x1F, "۲" },
+  { 0x20, "۳" },
+  { 0x21, "۴" },
+  { 0x22, "۵" },
+  { 0x23, "۶" },
+  { 0x24, "۷" },
+  { 0x25, "۸" },
+  { 0x26, "۹" },
+  { 0x27, "۰" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "ج" },
+  { 0x30, "چ" },
+  { 0x31, "\\" },
+  { 0x33, "ک" },
+  { 0x34, "گ" },
+  { 0x35, "‍" },
+  { 0x36, "و" },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_56_LAYER_1_ENTRIES[] = {
+  { 0x04, "ؤ" },
+  { 0x05, "‌" },
+  { 0x06, "ژ" },
+  { 0x07, "ي" },
+  { 0x08, "ٍ" },
+  { 0x09, "إ" },
+  { 0x0A, "أ" },
+  { 0x0B, "آ" },
+  { 0x0C, "ّ" },
+  { 0x0D, "ة" },
+  { 0x0E, "»" },
+  { 0x0F, "«" },
+  { 0x10, "ء" },
+  { 0x11, "ٔ" },
+  { 0x12, "]" },
+  { 0x13, "[" },
+  { 0x14, "ْ" },
+  { 0x15, "ً" },
+  { 0x16, "ئ" },
+  { 0x17, "ُ" },
+  { 0x18, "َ" },
+  { 0x19, "ٰ" },
+  { 0x1A, "ٌ" },
+  { 0x1B, "ط" },
+  { 0x1C, "ِ" },
+  { 0x1D, "ك" },
+  { 0x1E, "!" },
+  { 0x1F, "٬" },
+  { 0x20, "٫" },
+  { 0x21, "ریال" },
+  { 0x22, "٪" },
+  { 0x23, "×" },
+  { 0x24, "،" },
+  { 0x25, "*" },
+  { 0x26, ")" },
+  { 0x27, "(" },
+  { 0x2C, "‌" },
+  { 0x2D, "ـ" },
+  { 0x2E, "+" },
+  { 0x2F, "}" },
+  { 0x30, "{" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "؛" },
+  { 0x35, "‍" },
+  { 0x36, ">" },
+  { 0x37, "<" },
+  { 0x38, "؟" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_56_LAYER_2_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_56_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_56_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_56_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "ctrl",
+    LAYOUT_56_LAYER_2_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_57_LAYER_0_ENTRIES[] = {
+  { 0x04, "ش" },
+  { 0x05, "ذ" },
+  { 0x06, "ز" },
+  { 0x07, "ی" },
+  { 0x08, "ث" },
+  { 0x09, "ب" },
+  { 0x0A, "ل" },
+  { 0x0B, "ا" },
+  { 0x0C, "ه" },
+  { 0x0D, "ت" },
+  { 0x0E, "ن" },
+  { 0x0F, "م" },
+  { 0x10, "ئ" },
+  { 0x11, "د" },
+  { 0x12, "خ" },
+  { 0x13, "ح" },
+  { 0x14, "ض" },
+  { 0x15, "ق" },
+  { 0x16, "س" },
+  { 0x17, "ف" },
+  { 0x18, "ع" },
+  { 0x19, "ر" },
+  { 0x1A, "ص" },
+  { 0x1B, "ط" },
+  { 0x1C, "غ" },
+  { 0x1D, "ظ" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "ج" },
+  { 0x30, "چ" },
+  { 0x31, "پ" },
+  { 0x33, "ک" },
+  { 0x34, "گ" },
+  { 0x35, "÷" },
+  { 0x36, "و" },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "پ" },
+};
+
+const wa_keyboard_mapping LAYOUT_57_LAYER_1_ENTRIES[] = {
+  { 0x04, "َ" },
+  { 0x05, "إ" },
+  { 0x06, "ژ" },
+  { 0x07, "ِ" },
+  { 0x08, "ٍ" },
+  { 0x09, "ّ" },
+  { 0x0A, "ۀ" },
+  { 0x0B, "آ" },
+  { 0x0C, "]" },
+  { 0x0D, "ـ" },
+  { 0x0E, "«" },
+  { 0x0F, "»" },
+  { 0x10, "ء" },
+  { 0x11, "أ" },
+  { 0x12, "[" },
+  { 0x13, "\\" },
+  { 0x14, "ً" },
+  { 0x15, "ريال" },
+  { 0x16, "ُ" },
+  { 0x17, "،" },
+  { 0x18, "," },
+  { 0x19, "ؤ" },
+  { 0x1A, "ٌ" },
+  { 0x1B, "ي" },
+  { 0x1C, "؛" },
+  { 0x1D, "ة" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, ")" },
+  { 0x27, "(" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "}" },
+  { 0x30, "{" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "×" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "؟" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_57_LAYER_2_ENTRIES[] = {
+  { 0x27, "ہ" },
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_57_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_57_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_57_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "ctrl",
+    LAYOUT_57_LAYER_2_ENTRIES, 3u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_58_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "+" },
+  { 0x2E, "´" },
+  { 0x2F, "å" },
+  { 0x30, "¨" },
+  { 0x31, "'" },
+  { 0x33, "ö" },
+  { 0x34, "ä" },
+  { 0x35, "§" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "-" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "<" },
+};
+
+const wa_keyboard_mapping LAYOUT_58_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "#" },
+  { 0x21, "¤" },
+  { 0x22, "%" },
+  { 0x23, "&" },
+  { 0x24, "/" },
+  { 0x25, "(" },
+  { 0x26, ")" },
+  { 0x27, "=" },
+  { 0x2C, " " },
+  { 0x2D, "?" },
+  { 0x2E, "`" },
+  { 0x2F, "Å" },
+  { 0x30, "^" },
+  { 0x31, "*" },
+  { 0x33, "Ö" },
+  { 0x34, "Ä" },
+  { 0x35, "½" },
+  { 0x36, ";" },
+  { 0x37, ":" },
+  { 0x38, "_" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_58_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x2F, "Å" },
+  { 0x33, "Ö" },
+  { 0x34, "Ä" },
+};
+
+const wa_keyboard_mapping LAYOUT_58_LAYER_3_ENTRIES[] = {
+  { 0x04, "á" },
+  { 0x05, "ʒ" },
+  { 0x06, "č" },
+  { 0x07, "đ" },
+  { 0x08, "€" },
+  { 0x09, "ǥ" },
+  { 0x0A, "ǧ" },
+  { 0x0B, "ȟ" },
+  { 0x0C, "ï" },
+  { 0x0E, "ǩ" },
+  { 0x10, "µ" },
+  { 0x11, "ŋ" },
+  { 0x12, "õ" },
+  { 0x14, "â" },
+  { 0x16, "š" },
+  { 0x17, "ŧ" },
+  { 0x19, "ǯ" },
+  { 0x1D, "ž" },
+  { 0x1F, "@" },
+  { 0x20, "£" },
+  { 0x21, "$" },
+  { 0x22, "€" },
+  { 0x24, "{" },
+  { 0x25, "[" },
+  { 0x26, "]" },
+  { 0x27, "}" },
+  { 0x2D, "\\" },
+  { 0x30, "~" },
+  { 0x33, "ø" },
+  { 0x34, "æ" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_58_LAYER_4_ENTRIES[] = {
+  { 0x04, "Á" },
+  { 0x05, "Ʒ" },
+  { 0x06, "Č" },
+  { 0x07, "Đ" },
+  { 0x09, "Ǥ" },
+  { 0x0A, "Ǧ" },
+  { 0x0B, "Ȟ" },
+  { 0x0C, "Ï" },
+  { 0x0E, "Ǩ" },
+  { 0x11, "Ŋ" },
+  { 0x12, "Õ" },
+  { 0x14, "Â" },
+  { 0x16, "Š" },
+  { 0x17, "Ŧ" },
+  { 0x19, "Ǯ" },
+  { 0x1D, "Ž" },
+  { 0x33, "Ø" },
+  { 0x34, "Æ" },
+};
+
+const wa_keyboard_mapping LAYOUT_58_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_58_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_58_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_58_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_58_LAYER_2_ENTRIES, 29u,
+  },
+  {
+    "altgr",
+    LAYOUT_58_LAYER_3_ENTRIES, 31u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_58_LAYER_4_ENTRIES, 18u,
+  },
+  {
+    "ctrl",
+    LAYOUT_58_LAYER_5_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_59_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "+" },
+  { 0x2E, "´" },
+  { 0x2F, "å" },
+  { 0x30, "¨" },
+  { 0x31, "'" },
+  { 0x33, "ö" },
+  { 0x34, "ä" },
+  { 0x35, "§" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "-" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "<" },
+};
+
+const wa_keyboard_mapping LAYOUT_59_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "#" },
+  { 0x21, "¤" },
+  { 0x22, "%" },
+  { 0x23, "&" },
+  { 0x24, "/" },
+  { 0x25, "(" },
+  { 0x26, ")" },
+  { 0x27, "=" },
+  { 0x2C, " " },
+  { 0x2D, "?" },
+  { 0x2E, "`" },
+  { 0x2F, "Å" },
+  { 0x30, "^" },
+  { 0x31, "*" },
+  { 0x33, "Ö" },
+  { 0x34, "Ä" },
+  { 0x35, "½" },
+  { 0x36, ";" },
+  { 0x37, ":" },
+  { 0x38, "_" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_59_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x2F, "Å" },
+  { 0x33, "Ö" },
+  { 0x34, "Ä" },
+};
+
+const wa_keyboard_mapping LAYOUT_59_LAYER_3_ENTRIES[] = {
+  { 0x08, "€" },
+  { 0x10, "µ" },
+  { 0x1F, "@" },
+  { 0x20, "£" },
+  { 0x21, "$" },
+  { 0x22, "€" },
+  { 0x24, "{" },
+  { 0x25, "[" },
+  { 0x26, "]" },
+  { 0x27, "}" },
+  { 0x2D, "\\" },
+  { 0x30, "~" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_59_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_59_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_59_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_59_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_59_LAYER_2_ENTRIES, 29u,
+  },
+  {
+    "altgr",
+    LAYOUT_59_LAYER_3_ENTRIES, 13u,
+  },
+  {
+    "ctrl",
+    LAYOUT_59_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_60_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "+" },
+  { 0x2E, "´" },
+  { 0x2F, "å" },
+  { 0x30, "ð" },
+  { 0x31, "'" },
+  { 0x33, "æ" },
+  { 0x34, "ø" },
+  { 0x35, "½" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "-" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "<" },
+};
+
+const wa_keyboard_mapping LAYOUT_60_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "#" },
+  { 0x21, "¤" },
+  { 0x22, "%" },
+  { 0x23, "&" },
+  { 0x24, "/" },
+  { 0x25, "(" },
+  { 0x26, ")" },
+  { 0x27, "=" },
+  { 0x2C, " " },
+  { 0x2D, "?" },
+  { 0x2E, "`" },
+  { 0x2F, "Å" },
+  { 0x30, "Ð" },
+  { 0x31, "*" },
+  { 0x33, "Æ" },
+  { 0x34, "Ø" },
+  { 0x35, "§" },
+  { 0x36, ";" },
+  { 0x37, ":" },
+  { 0x38, "_" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_60_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x2F, "Å" },
+  { 0x30, "Ð" },
+  { 0x33, "Æ" },
+  { 0x34, "Ø" },
+};
+
+const wa_keyboard_mapping LAYOUT_60_LAYER_3_ENTRIES[] = {
+  { 0x08, "€" },
+  { 0x10, "µ" },
+  { 0x1F, "@" },
+  { 0x20, "£" },
+  { 0x21, "$" },
+  { 0x22, "€" },
+  { 0x24, "{" },
+  { 0x25, "[" },
+  { 0x26, "]" },
+  { 0x27, "}" },
+  { 0x2E, "|" },
+  { 0x2F, "¨" },
+  { 0x30, "~" },
+  { 0x34, "^" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_60_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_60_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_60_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_60_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_60_LAYER_2_ENTRIES, 30u,
+  },
+  {
+    "altgr",
+    LAYOUT_60_LAYER_3_ENTRIES, 15u,
+  },
+  {
+    "ctrl",
+    LAYOUT_60_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_61_LAYER_0_ENTRIES[] = {
+  { 0x04, "q" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "," },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "a" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "z" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "w" },
+  { 0x1E, "&" },
+  { 0x1F, "é" },
+  { 0x20, "\"" },
+  { 0x21, "'" },
+  { 0x22, "(" },
+  { 0x23, "§" },
+  { 0x24, "è" },
+  { 0x25, "!" },
+  { 0x26, "ç" },
+  { 0x27, "à" },
+  { 0x2C, " " },
+  { 0x2D, ")" },
+  { 0x2E, "-" },
+  { 0x2F, "^" },
+  { 0x30, "$" },
+  { 0x31, "µ" },
+  { 0x33, "m" },
+  { 0x34, "ù" },
+  { 0x35, "²" },
+  { 0x36, ";" },
+  { 0x37, ":" },
+  { 0x38, "=" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "<" },
+};
+
+const wa_keyboard_mapping LAYOUT_61_LAYER_1_ENTRIES[] = {
+  { 0x04, "Q" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "?" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "A" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "Z" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "W" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "°" },
+  { 0x2E, "_" },
+  { 0x2F, "¨" },
+  { 0x30, "*" },
+  { 0x31, "£" },
+  { 0x33, "M" },
+  { 0x34, "%" },
+  { 0x35, "³" },
+  { 0x36, "." },
+  { 0x37, "/" },
+  { 0x38, "+" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_61_LAYER_2_ENTRIES[] = {
+  { 0x04, "Q" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "?" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "A" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "Z" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "W" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2D, "°" },
+  { 0x2E, "_" },
+  { 0x2F, "¨" },
+  { 0x30, "*" },
+  { 0x31, "£" },
+  { 0x33, "M" },
+  { 0x34, "%" },
+  { 0x36, "." },
+  { 0x37, "/" },
+  { 0x38, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_61_LAYER_3_ENTRIES[] = {
+  { 0x08, "€" },
+  { 0x1E, "|" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "{" },
+  { 0x22, "[" },
+  { 0x23, "^" },
+  { 0x26, "{" },
+  { 0x27, "}" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "`" },
+  { 0x34, "´" },
+  { 0x38, "~" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_61_LAYER_4_ENTRIES[] = {
+  { 0x31, "`" },
+  { 0x34, "´" },
+  { 0x38, "~" },
+};
+
+const wa_keyboard_mapping LAYOUT_61_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_61_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_61_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_61_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_61_LAYER_2_ENTRIES, 46u,
+  },
+  {
+    "altgr",
+    LAYOUT_61_LAYER_3_ENTRIES, 15u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_61_LAYER_4_ENTRIES, 3u,
+  },
+  {
+    "ctrl",
+    LAYOUT_61_LAYER_5_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_62_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "^" },
+  { 0x30, "ç" },
+  { 0x31, "à" },
+  { 0x33, ";" },
+  { 0x34, "è" },
+  { 0x35, "°" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "é" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "ù" },
+};
+
+const wa_keyboard_mapping LAYOUT_62_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "?" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "^" },
+  { 0x30, "Ç" },
+  { 0x31, "À" },
+  { 0x33, ":" },
+  { 0x34, "È" },
+  { 0x35, "°" },
+  { 0x36, "'" },
+  { 0x37, "." },
+  { 0x38, "É" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "Ù" },
+};
+
+const wa_keyboard_mapping LAYOUT_62_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x30, "Ç" },
+  { 0x31, "À" },
+  { 0x34, "È" },
+  { 0x38, "É" },
+  { 0x64, "Ù" },
+};
+
+const wa_keyboard_mapping LAYOUT_62_LAYER_3_ENTRIES[] = {
+  { 0x04, "æ" },
+  { 0x06, "¢" },
+  { 0x07, "ð" },
+  { 0x08, "€" },
+  { 0x09, "ª" },
+  { 0x10, "µ" },
+  { 0x12, "ø" },
+  { 0x13, "þ" },
+  { 0x15, "¶" },
+  { 0x16, "ß" },
+  { 0x1B, "»" },
+  { 0x1C, "¥" },
+  { 0x1D, "«" },
+  { 0x1E, "¹" },
+  { 0x1F, "@" },
+  { 0x20, "³" },
+  { 0x21, "¼" },
+  { 0x22, "½" },
+  { 0x23, "¾" },
+  { 0x24, "{" },
+  { 0x25, "[" },
+  { 0x26, "]" },
+  { 0x27, "}" },
+  { 0x2D, "|" },
+  { 0x2E, "¸" },
+  { 0x2F, "°" },
+  { 0x30, "~" },
+  { 0x31, "`" },
+  { 0x33, "´" },
+  { 0x35, "¬" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "/" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_62_LAYER_4_ENTRIES[] = {
+  { 0x04, "Æ" },
+  { 0x06, "©" },
+  { 0x07, "Ð" },
+  { 0x10, "º" },
+  { 0x12, "Ø" },
+  { 0x13, "Þ" },
+  { 0x15, "®" },
+  { 0x16, "§" },
+  { 0x1E, "¡" },
+  { 0x1F, "²" },
+  { 0x20, "£" },
+  { 0x21, "¤" },
+  { 0x26, "±" },
+  { 0x2D, "¿" },
+  { 0x30, "¨" },
+  { 0x31, "`" },
+  { 0x33, "´" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_62_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_62_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_62_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_62_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_62_LAYER_2_ENTRIES, 31u,
+  },
+  {
+    "altgr",
+    LAYOUT_62_LAYER_3_ENTRIES, 34u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_62_LAYER_4_ENTRIES, 18u,
+  },
+  {
+    "ctrl",
+    LAYOUT_62_LAYER_5_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_63_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "^" },
+  { 0x30, "¸" },
+  { 0x31, "<" },
+  { 0x33, ";" },
+  { 0x34, "`" },
+  { 0x35, "#" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "é" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "«" },
+};
+
+const wa_keyboard_mapping LAYOUT_63_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "/" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "?" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "^" },
+  { 0x30, "¨" },
+  { 0x31, ">" },
+  { 0x33, ":" },
+  { 0x34, "`" },
+  { 0x35, "|" },
+  { 0x36, "'" },
+  { 0x37, "." },
+  { 0x38, "É" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "»" },
+};
+
+const wa_keyboard_mapping LAYOUT_63_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x38, "É" },
+};
+
+const wa_keyboard_mapping LAYOUT_63_LAYER_3_ENTRIES[] = {
+  { 0x08, "€" },
+  { 0x10, "µ" },
+  { 0x12, "§" },
+  { 0x13, "¶" },
+  { 0x1E, "±" },
+  { 0x1F, "@" },
+  { 0x20, "£" },
+  { 0x21, "¢" },
+  { 0x22, "¤" },
+  { 0x23, "¬" },
+  { 0x24, "¦" },
+  { 0x25, "²" },
+  { 0x26, "³" },
+  { 0x27, "¼" },
+  { 0x2D, "½" },
+  { 0x2E, "¾" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "}" },
+  { 0x33, "~" },
+  { 0x34, "{" },
+  { 0x35, "\\" },
+  { 0x36, "¯" },
+  { 0x37, "­" },
+  { 0x38, "´" },
+  { 0x64, "°" },
+};
+
+const wa_keyboard_mapping LAYOUT_63_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_63_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_63_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_63_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_63_LAYER_2_ENTRIES, 27u,
+  },
+  {
+    "altgr",
+    LAYOUT_63_LAYER_3_ENTRIES, 26u,
+  },
+  {
+    "ctrl",
+    LAYOUT_63_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_64_LAYER_0_ENTRIES[] = {
+  { 0x04, "q" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "," },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "a" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "z" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "w" },
+  { 0x1E, "&" },
+  { 0x1F, "é" },
+  { 0x20, "\"" },
+  { 0x21, "'" },
+  { 0x22, "(" },
+  { 0x23, "-" },
+  { 0x24, "è" },
+  { 0x25, "_" },
+  { 0x26, "ç" },
+  { 0x27, "à" },
+  { 0x2C, " " },
+  { 0x2D, ")" },
+  { 0x2E, "=" },
+  { 0x2F, "^" },
+  { 0x30, "$" },
+  { 0x31, "*" },
+  { 0x33, "m" },
+  { 0x34, "ù" },
+  { 0x35, "²" },
+  { 0x36, ";" },
+  { 0x37, ":" },
+  { 0x38, "!" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "<" },
+};
+
+const wa_keyboard_mapping LAYOUT_64_LAYER_1_ENTRIES[] = {
+  { 0x04, "Q" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "?" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "A" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "Z" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "W" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "°" },
+  { 0x2E, "+" },
+  { 0x2F, "¨" },
+  { 0x30, "£" },
+  { 0x31, "µ" },
+  { 0x33, "M" },
+  { 0x34, "%" },
+  { 0x36, "." },
+  { 0x37, "/" },
+  { 0x38, "§" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_64_LAYER_2_ENTRIES[] = {
+  { 0x04, "Q" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "?" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "A" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "Z" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "W" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2D, "°" },
+  { 0x2E, "+" },
+  { 0x2F, "¨" },
+  { 0x30, "£" },
+  { 0x31, "µ" },
+  { 0x33, "M" },
+  { 0x34, "%" },
+  { 0x36, "." },
+  { 0x37, "/" },
+  { 0x38, "§" },
+};
+
+const wa_keyboard_mapping LAYOUT_64_LAYER_3_ENTRIES[] = {
+  { 0x08, "€" },
+  { 0x1F, "~" },
+  { 0x20, "#" },
+  { 0x21, "{" },
+  { 0x22, "[" },
+  { 0x23, "|" },
+  { 0x24, "`" },
+  { 0x25, "\\" },
+  { 0x26, "^" },
+  { 0x27, "@" },
+  { 0x2D, "]" },
+  { 0x2E, "}" },
+  { 0x30, "¤" },
+};
+
+const wa_keyboard_mapping LAYOUT_64_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_64_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_64_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_64_LAYER_1_ENTRIES, 52u,
+  },
+  {
+    "caps",
+    LAYOUT_64_LAYER_2_ENTRIES, 46u,
+  },
+  {
+    "altgr",
+    LAYOUT_64_LAYER_3_ENTRIES, 13u,
+  },
+  {
+    "ctrl",
+    LAYOUT_64_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_65_LAYER_0_ENTRIES[] = {
+  { 0x04, "q" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "." },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "a" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "z" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "w" },
+  { 0x1E, "à" },
+  { 0x1F, "é" },
+  { 0x20, "è" },
+  { 0x21, "ê" },
+  { 0x22, "(" },
+  { 0x23, ")" },
+  { 0x24, "‘" },
+  { 0x25, "’" },
+  { 0x26, "«" },
+  { 0x27, "»" },
+  { 0x2C, " " },
+  { 0x2D, "'" },
+  { 0x2E, "^" },
+  { 0x2F, "-" },
+  { 0x30, "+" },
+  { 0x31, "*" },
+  { 0x33, "m" },
+  { 0x34, "/" },
+  { 0x35, "@" },
+  { 0x36, "," },
+  { 0x37, ":" },
+  { 0x38, ";" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "<" },
+};
+
+const wa_keyboard_mapping LAYOUT_65_LAYER_1_ENTRIES[] = {
+  { 0x04, "Q" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "?" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "A" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "Z" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "W" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "\"" },
+  { 0x2E, "¨" },
+  { 0x2F, "–" },
+  { 0x30, "±" },
+  { 0x31, "½" },
+  { 0x33, "M" },
+  { 0x34, "\\" },
+  { 0x35, "#" },
+  { 0x36, "!" },
+  { 0x37, "…" },
+  { 0x38, "=" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_65_LAYER_2_ENTRIES[] = {
+  { 0x04, "Q" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "A" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "Z" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "W" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x33, "M" },
+};
+
+const wa_keyboard_mapping LAYOUT_65_LAYER_3_ENTRIES[] = {
+  { 0x04, "θ" },
+  { 0x05, "-" },
+  { 0x06, "ç" },
+  { 0x07, "$" },
+  { 0x08, "€" },
+  { 0x09, "¤" },
+  { 0x0A, "µ" },
+  { 0x0B, "ſ" },
+  { 0x0C, "˙" },
+  { 0x0E, "/" },
+  { 0x0F, "|" },
+  { 0x10, "¿" },
+  { 0x11, "~" },
+  { 0x12, "œ" },
+  { 0x13, "%" },
+  { 0x14, "æ" },
+  { 0x15, "®" },
+  { 0x16, "ß" },
+  { 0x17, "{" },
+  { 0x18, "ù" },
+  { 0x19, "¸" },
+  { 0x1A, "£" },
+  { 0x1B, "©" },
+  { 0x1C, "}" },
+  { 0x1D, "ʒ" },
+  { 0x1E, "§" },
+  { 0x1F, "´" },
+  { 0x20, "`" },
+  { 0x21, "&" },
+  { 0x22, "[" },
+  { 0x23, "]" },
+  { 0x24, "¯" },
+  { 0x25, "_" },
+  { 0x26, "“" },
+  { 0x27, "”" },
+  { 0x2C, " " },
+  { 0x2D, "°" },
+  { 0x2E, "ˇ" },
+  { 0x2F, "−" },
+  { 0x30, "†" },
+  { 0x31, "×" },
+  { 0x33, "∞" },
+  { 0x34, "÷" },
+  { 0x35, "˘" },
+  { 0x36, "¡" },
+  { 0x37, "·" },
+  { 0x38, "≃" },
+  { 0x64, "⩽" },
+};
+
+const wa_keyboard_mapping LAYOUT_65_LAYER_4_ENTRIES[] = {
+  { 0x04, "ϴ" },
+  { 0x06, "Ç" },
+  { 0x0B, "ˍ" },
+  { 0x0C, "." },
+  { 0x12, "Œ" },
+  { 0x13, "‰" },
+  { 0x14, "Æ" },
+  { 0x16, "ẞ" },
+  { 0x17, "™" },
+  { 0x18, "Ù" },
+  { 0x19, "˛" },
+  { 0x1D, "Ʒ" },
+  { 0x1E, "À" },
+  { 0x1F, "É" },
+  { 0x20, "È" },
+  { 0x21, "Ê" },
+  { 0x22, "˝" },
+  { 0x23, "˵" },
+  { 0x25, "—" },
+  { 0x26, "‹" },
+  { 0x27, "›" },
+  { 0x2C, " " },
+  { 0x2D, "˚" },
+  { 0x2F, "‑" },
+  { 0x30, "‡" },
+  { 0x31, "¼" },
+  { 0x34, "√" },
+  { 0x35, "°" },
+  { 0x36, "," },
+  { 0x38, "≠" },
+  { 0x64, "⩾" },
+};
+
+const wa_keyboard_mapping LAYOUT_65_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+};
+
+const wa_keyboard_layer LAYOUT_65_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_65_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_65_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_65_LAYER_2_ENTRIES, 36u,
+  },
+  {
+    "altgr",
+    LAYOUT_65_LAYER_3_ENTRIES, 48u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_65_LAYER_4_ENTRIES, 31u,
+  },
+  {
+    "ctrl",
+    LAYOUT_65_LAYER_5_ENTRIES, 1u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_66_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "k" },
+  { 0x06, "x" },
+  { 0x07, "i" },
+  { 0x08, "p" },
+  { 0x09, "e" },
+  { 0x0A, "," },
+  { 0x0B, "c" },
+  { 0x0C, "d" },
+  { 0x0D, "t" },
+  { 0x0E, "s" },
+  { 0x0F, "r" },
+  { 0x10, "q" },
+  { 0x11, "’" },
+  { 0x12, "l" },
+  { 0x13, "j" },
+  { 0x14, "b" },
+  { 0x15, "o" },
+  { 0x16, "u" },
+  { 0x17, "è" },
+  { 0x18, "v" },
+  { 0x19, "." },
+  { 0x1A, "é" },
+  { 0x1B, "y" },
+  { 0x1C, "^" },
+  { 0x1D, "à" },
+  { 0x1E, "\"" },
+  { 0x1F, "«" },
+  { 0x20, "»" },
+  { 0x21, "(" },
+  { 0x22, ")" },
+  { 0x23, "@" },
+  { 0x24, "+" },
+  { 0x25, "-" },
+  { 0x26, "/" },
+  { 0x27, "*" },
+  { 0x2C, " " },
+  { 0x2D, "=" },
+  { 0x2E, "%" },
+  { 0x2F, "z" },
+  { 0x30, "w" },
+  { 0x31, "ç" },
+  { 0x33, "n" },
+  { 0x34, "m" },
+  { 0x35, "$" },
+  { 0x36, "g" },
+  { 0x37, "h" },
+  { 0x38, "f" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "ê" },
+};
+
+const wa_keyboard_mapping LAYOUT_66_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "K" },
+  { 0x06, "X" },
+  { 0x07, "I" },
+  { 0x08, "P" },
+  { 0x09, "E" },
+  { 0x0A, ";" },
+  { 0x0B, "C" },
+  { 0x0C, "D" },
+  { 0x0D, "T" },
+  { 0x0E, "S" },
+  { 0x0F, "R" },
+  { 0x10, "Q" },
+  { 0x11, "?" },
+  { 0x12, "L" },
+  { 0x13, "J" },
+  { 0x14, "B" },
+  { 0x15, "O" },
+  { 0x16, "U" },
+  { 0x17, "È" },
+  { 0x18, "V" },
+  { 0x19, ":" },
+  { 0x1A, "É" },
+  { 0x1B, "Y" },
+  { 0x1C, "!" },
+  { 0x1D, "À" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "°" },
+  { 0x2E, "`" },
+  { 0x2F, "Z" },
+  { 0x30, "W" },
+  { 0x31, "Ç" },
+  { 0x33, "N" },
+  { 0x34, "M" },
+  { 0x35, "#" },
+  { 0x36, "G" },
+  { 0x37, "H" },
+  { 0x38, "F" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "Ê" },
+};
+
+const wa_keyboard_mapping LAYOUT_66_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "K" },
+  { 0x06, "X" },
+  { 0x07, "I" },
+  { 0x08, "P" },
+  { 0x09, "E" },
+  { 0x0B, "C" },
+  { 0x0C, "D" },
+  { 0x0D, "T" },
+  { 0x0E, "S" },
+  { 0x0F, "R" },
+  { 0x10, "Q" },
+  { 0x12, "L" },
+  { 0x13, "J" },
+  { 0x14, "B" },
+  { 0x15, "O" },
+  { 0x16, "U" },
+  { 0x17, "È" },
+  { 0x18, "V" },
+  { 0x1A, "É" },
+  { 0x1B, "Y" },
+  { 0x1D, "À" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2F, "Z" },
+  { 0x30, "W" },
+  { 0x31, "Ç" },
+  { 0x33, "N" },
+  { 0x34, "M" },
+  { 0x36, "G" },
+  { 0x37, "H" },
+  { 0x38, "F" },
+  { 0x64, "Ê" },
+};
+
+const wa_keyboard_mapping LAYOUT_66_LAYER_3_ENTRIES[] = {
+  { 0x04, "æ" },
+  { 0x05, "~" },
+  { 0x06, "}" },
+  { 0x07, "¨" },
+  { 0x08, "&" },
+  { 0x09, "€" },
+  { 0x0A, "'" },
+  { 0x0B, "¸" },
+  { 0x0C, "∞" },
+  { 0x0D, "ᵉ" },
+  { 0x0E, "ß" },
+  { 0x0F, "˘" },
+  { 0x10, "˚" },
+  { 0x11, "¿" },
+  { 0x12, "/" },
+  { 0x14, "|" },
+  { 0x15, "œ" },
+  { 0x16, "ù" },
+  { 0x17, "`" },
+  { 0x18, "ˇ" },
+  { 0x19, "…" },
+  { 0x1A, "´" },
+  { 0x1B, "{" },
+  { 0x1C, "¡" },
+  { 0x1D, "\\" },
+  { 0x1E, "—" },
+  { 0x1F, "<" },
+  { 0x20, ">" },
+  { 0x21, "[" },
+  { 0x22, "]" },
+  { 0x23, "^" },
+  { 0x24, "±" },
+  { 0x25, "−" },
+  { 0x26, "÷" },
+  { 0x27, "×" },
+  { 0x2C, "_" },
+  { 0x2D, "≠" },
+  { 0x2E, "‰" },
+  { 0x2F, "-" },
+  { 0x33, "~" },
+  { 0x34, "¯" },
+  { 0x35, "–" },
+  { 0x36, "µ" },
+  { 0x37, "." },
+  { 0x38, "˛" },
+  { 0x64, "/" },
+};
+
+const wa_keyboard_mapping LAYOUT_66_LAYER_4_ENTRIES[] = {
+  { 0x04, "Æ" },
+  { 0x05, "‑" },
+  { 0x06, "’" },
+  { 0x07, "˙" },
+  { 0x08, "§" },
+  { 0x09, "¤" },
+  { 0x0A, "," },
+  { 0x0B, "©" },
+  { 0x0D, "™" },
+  { 0x0E, "ſ" },
+  { 0x0F, "®" },
+  { 0x12, "£" },
+  { 0x15, "Œ" },
+  { 0x16, "Ù" },
+  { 0x17, "`" },
+  { 0x19, "·" },
+  { 0x1B, "‘" },
+  { 0x1E, "„" },
+  { 0x1F, "“" },
+  { 0x20, "”" },
+  { 0x21, "⩽" },
+  { 0x22, "⩾" },
+  { 0x25, "¼" },
+  { 0x26, "½" },
+  { 0x27, "¾" },
+  { 0x2C, " " },
+  { 0x2D, "′" },
+  { 0x2E, "″" },
+  { 0x35, "¶" },
+  { 0x36, "†" },
+  { 0x37, "‡" },
+  { 0x64, "^" },
+};
+
+const wa_keyboard_mapping LAYOUT_66_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+};
+
+const wa_keyboard_layer LAYOUT_66_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_66_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_66_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_66_LAYER_2_ENTRIES, 41u,
+  },
+  {
+    "altgr",
+    LAYOUT_66_LAYER_3_ENTRIES, 46u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_66_LAYER_4_ENTRIES, 32u,
+  },
+  {
+    "ctrl",
+    LAYOUT_66_LAYER_5_ENTRIES, 1u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_67_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "z" },
+  { 0x1D, "y" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "'" },
+  { 0x2E, "^" },
+  { 0x2F, "è" },
+  { 0x30, "¨" },
+  { 0x31, "$" },
+  { 0x33, "é" },
+  { 0x34, "à" },
+  { 0x35, "§" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "-" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "<" },
+};
+
+const wa_keyboard_mapping LAYOUT_67_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Z" },
+  { 0x1D, "Y" },
+  { 0x1E, "+" },
+  { 0x1F, "\"" },
+  { 0x20, "*" },
+  { 0x21, "ç" },
+  { 0x22, "%" },
+  { 0x23, "&" },
+  { 0x24, "/" },
+  { 0x25, "(" },
+  { 0x26, ")" },
+  { 0x27, "=" },
+  { 0x2C, " " },
+  { 0x2D, "?" },
+  { 0x2E, "`" },
+  { 0x2F, "ü" },
+  { 0x30, "!" },
+  { 0x31, "£" },
+  { 0x33, "ö" },
+  { 0x34, "ä" },
+  { 0x35, "°" },
+  { 0x36, ";" },
+  { 0x37, ":" },
+  { 0x38, "_" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_67_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Z" },
+  { 0x1D, "Y" },
+};
+
+const wa_keyboard_mapping LAYOUT_67_LAYER_3_ENTRIES[] = {
+  { 0x08, "€" },
+  { 0x1E, "¦" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "°" },
+  { 0x22, "§" },
+  { 0x23, "¬" },
+  { 0x24, "|" },
+  { 0x25, "¢" },
+  { 0x2D, "´" },
+  { 0x2E, "~" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "}" },
+  { 0x34, "{" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_67_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_67_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_67_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_67_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_67_LAYER_2_ENTRIES, 26u,
+  },
+  {
+    "altgr",
+    LAYOUT_67_LAYER_3_ENTRIES, 16u,
+  },
+  {
+    "ctrl",
+    LAYOUT_67_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_68_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "#" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x35, "`" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_68_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "£" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "~" },
+  { 0x33, ":" },
+  { 0x34, "@" },
+  { 0x35, "¬" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_68_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+};
+
+const wa_keyboard_mapping LAYOUT_68_LAYER_3_ENTRIES[] = {
+  { 0x04, "á" },
+  { 0x08, "é" },
+  { 0x0C, "í" },
+  { 0x12, "ó" },
+  { 0x18, "ú" },
+  { 0x21, "€" },
+  { 0x34, "´" },
+  { 0x35, "¦" },
+};
+
+const wa_keyboard_mapping LAYOUT_68_LAYER_4_ENTRIES[] = {
+  { 0x04, "Á" },
+  { 0x08, "É" },
+  { 0x0C, "Í" },
+  { 0x12, "Ó" },
+  { 0x18, "Ú" },
+  { 0x34, "`" },
+  { 0x35, "¦" },
+};
+
+const wa_keyboard_mapping LAYOUT_68_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_68_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_68_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_68_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_68_LAYER_2_ENTRIES, 26u,
+  },
+  {
+    "altgr",
+    LAYOUT_68_LAYER_3_ENTRIES, 8u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_68_LAYER_4_ENTRIES, 7u,
+  },
+  {
+    "ctrl",
+    LAYOUT_68_LAYER_5_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_69_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "#" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x35, "`" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_69_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "£" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "~" },
+  { 0x33, ":" },
+  { 0x34, "@" },
+  { 0x35, "`" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_69_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+};
+
+const wa_keyboard_mapping LAYOUT_69_LAYER_3_ENTRIES[] = {
+  { 0x04, "á" },
+  { 0x08, "é" },
+  { 0x0C, "í" },
+  { 0x12, "ó" },
+  { 0x18, "ú" },
+  { 0x1C, "ý" },
+  { 0x21, "€" },
+  { 0x24, "⁊" },
+  { 0x34, "'" },
+  { 0x35, "¦" },
+};
+
+const wa_keyboard_mapping LAYOUT_69_LAYER_4_ENTRIES[] = {
+  { 0x04, "Á" },
+  { 0x08, "É" },
+  { 0x0C, "Í" },
+  { 0x12, "Ó" },
+  { 0x18, "Ú" },
+  { 0x1C, "Ý" },
+  { 0x34, "’" },
+  { 0x35, "¬" },
+};
+
+const wa_keyboard_mapping LAYOUT_69_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_69_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_69_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_69_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_69_LAYER_2_ENTRIES, 26u,
+  },
+  {
+    "altgr",
+    LAYOUT_69_LAYER_3_ENTRIES, 10u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_69_LAYER_4_ENTRIES, 8u,
+  },
+  {
+    "ctrl",
+    LAYOUT_69_LAYER_5_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_70_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "'" },
+  { 0x2E, "¿" },
+  { 0x2F, "´" },
+  { 0x30, "+" },
+  { 0x31, "}" },
+  { 0x33, "ñ" },
+  { 0x34, "{" },
+  { 0x35, "|" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "-" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "<" },
+};
+
+const wa_keyboard_mapping LAYOUT_70_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "&" },
+  { 0x24, "/" },
+  { 0x25, "(" },
+  { 0x26, ")" },
+  { 0x27, "=" },
+  { 0x2C, " " },
+  { 0x2D, "?" },
+  { 0x2E, "¡" },
+  { 0x2F, "¨" },
+  { 0x30, "*" },
+  { 0x31, "]" },
+  { 0x33, "Ñ" },
+  { 0x34, "[" },
+  { 0x35, "°" },
+  { 0x36, ";" },
+  { 0x37, ":" },
+  { 0x38, "_" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_70_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x33, "Ñ" },
+};
+
+const wa_keyboard_mapping LAYOUT_70_LAYER_3_ENTRIES[] = {
+  { 0x04, "ã" },
+  { 0x08, "ẽ" },
+  { 0x0A, "g̃" },
+  { 0x0C, "ĩ" },
+  { 0x12, "õ" },
+  { 0x14, "@" },
+  { 0x18, "ũ" },
+  { 0x1C, "ỹ" },
+  { 0x21, "₲" },
+  { 0x2D, "\\" },
+  { 0x2F, "ʼ" },
+  { 0x30, "~" },
+  { 0x31, "`" },
+  { 0x34, "^" },
+  { 0x35, "¬" },
+};
+
+const wa_keyboard_mapping LAYOUT_70_LAYER_4_ENTRIES[] = {
+  { 0x04, "Ã" },
+  { 0x08, "Ẽ" },
+  { 0x0A, "G̃" },
+  { 0x0C, "Ĩ" },
+  { 0x12, "Õ" },
+  { 0x18, "Ũ" },
+  { 0x1C, "Ỹ" },
+};
+
+const wa_keyboard_mapping LAYOUT_70_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_70_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_70_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_70_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_70_LAYER_2_ENTRIES, 27u,
+  },
+  {
+    "altgr",
+    LAYOUT_70_LAYER_3_ENTRIES, 15u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_70_LAYER_4_ENTRIES, 7u,
+  },
+  {
+    "ctrl",
+    LAYOUT_70_LAYER_5_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_71_LAYER_0_ENTRIES[] = {
+  { 0x04, "ો" },
+  { 0x05, "વ" },
+  { 0x06, "મ" },
+  { 0x07, "્" },
+  { 0x08, "ા" },
+  { 0x09, "િ" },
+  { 0x0A, "ુ" },
+  { 0x0B, "પ" },
+  { 0x0C, "ગ" },
+  { 0x0D, "ર" },
+  { 0x0E, "ક" },
+  { 0x0F, "ત" },
+  { 0x10, "સ" },
+  { 0x11, "લ" },
+  { 0x12, "દ" },
+  { 0x13, "જ" },
+  { 0x14, "ૌ" },
+  { 0x15, "ી" },
+  { 0x16, "ે" },
+  { 0x17, "ૂ" },
+  { 0x18, "હ" },
+  { 0x19, "ન" },
+  { 0x1A, "ૈ" },
+  { 0x1B, "ં" },
+  { 0x1C, "બ" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "ૃ" },
+  { 0x2F, "ડ" },
+  { 0x30, "઼" },
+  { 0x31, "ૉ" },
+  { 0x33, "ચ" },
+  { 0x34, "ટ" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "ય" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_71_LAYER_1_ENTRIES[] = {
+  { 0x04, "ઓ" },
+  { 0x06, "ણ" },
+  { 0x07, "અ" },
+  { 0x08, "આ" },
+  { 0x09, "ઇ" },
+  { 0x0A, "ઉ" },
+  { 0x0B, "ફ" },
+  { 0x0C, "ઘ" },
+  { 0x0E, "ખ" },
+  { 0x0F, "થ" },
+  { 0x10, "શ" },
+  { 0x11, "ળ" },
+  { 0x12, "ધ" },
+  { 0x13, "ઝ" },
+  { 0x14, "ઔ" },
+  { 0x15, "ઈ" },
+  { 0x16, "એ" },
+  { 0x17, "ઊ" },
+  { 0x18, "ઙ" },
+  { 0x1A, "ઐ" },
+  { 0x1B, "ઁ" },
+  { 0x1C, "ભ" },
+  { 0x1E, "ઍ" },
+  { 0x1F, "ૅ" },
+  { 0x20, "્ર" },
+  { 0x21, "ર્" },
+  { 0x22, "જ્ઞ" },
+  { 0x23, "ત્ર" },
+  { 0x24, "ક્ષ" },
+  { 0x25, "શ્ર" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "ઃ" },
+  { 0x2E, "ઋ" },
+  { 0x2F, "ઢ" },
+  { 0x30, "ઞ" },
+  { 0x31, "ઑ" },
+  { 0x33, "છ" },
+  { 0x34, "ઠ" },
+  { 0x36, "ષ" },
+  { 0x37, "।" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_71_LAYER_2_ENTRIES[] = {
+  { 0x1E, "૧" },
+  { 0x1F, "૨" },
+  { 0x20, "૩" },
+  { 0x21, "૪" },
+  { 0x22, "૫" },
+  { 0x23, "૬" },
+  { 0x24, "૭" },
+  { 0x25, "૮" },
+  { 0x26, "૯" },
+  { 0x27, "૦" },
+  { 0x2E, "ૄ" },
+  { 0x37, "॥" },
+};
+
+const wa_keyboard_mapping LAYOUT_71_LAYER_3_ENTRIES[] = {
+  { 0x1B, "ૐ" },
+  { 0x2E, "ૠ" },
+  { 0x37, "ઽ" },
+};
+
+const wa_keyboard_mapping LAYOUT_71_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_71_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_71_LAYER_0_ENTRIES, 50u,
+  },
+  {
+    "shift",
+    LAYOUT_71_LAYER_1_ENTRIES, 46u,
+  },
+  {
+    "altgr",
+    LAYOUT_71_LAYER_2_ENTRIES, 12u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_71_LAYER_3_ENTRIES, 3u,
+  },
+  {
+    "ctrl",
+    LAYOUT_71_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_72_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x35, "`" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_72_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_72_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+};
+
+const wa_keyboard_mapping LAYOUT_72_LAYER_3_ENTRIES[] = {
+  { 0x05, "ɓ" },
+  { 0x07, "ɗ" },
+  { 0x0E, "ƙ" },
+  { 0x1C, "ƴ" },
+  { 0x22, "€" },
+  { 0x26, "‘" },
+  { 0x27, "’" },
+  { 0x33, "¶" },
+  { 0x34, "’" },
+};
+
+const wa_keyboard_mapping LAYOUT_72_LAYER_4_ENTRIES[] = {
+  { 0x05, "Ɓ" },
+  { 0x07, "Ɗ" },
+  { 0x0E, "Ƙ" },
+  { 0x1C, "Ƴ" },
+  { 0x31, "¦" },
+};
+
+const wa_keyboard_mapping LAYOUT_72_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_72_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_72_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_72_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_72_LAYER_2_ENTRIES, 26u,
+  },
+  {
+    "altgr",
+    LAYOUT_72_LAYER_3_ENTRIES, 9u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_72_LAYER_4_ENTRIES, 5u,
+  },
+  {
+    "ctrl",
+    LAYOUT_72_LAYER_5_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_73_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x33, ";" },
+  { 0x34, "ʻ" },
+  { 0x35, "`" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_73_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_73_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+};
+
+const wa_keyboard_mapping LAYOUT_73_LAYER_3_ENTRIES[] = {
+  { 0x04, "ā" },
+  { 0x08, "ē" },
+  { 0x0C, "ī" },
+  { 0x12, "ō" },
+  { 0x18, "ū" },
+  { 0x34, "'" },
+};
+
+const wa_keyboard_mapping LAYOUT_73_LAYER_4_ENTRIES[] = {
+  { 0x04, "Ā" },
+  { 0x08, "Ē" },
+  { 0x0C, "Ī" },
+  { 0x12, "Ō" },
+  { 0x18, "Ū" },
+  { 0x34, "\"" },
+};
+
+const wa_keyboard_mapping LAYOUT_73_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_73_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_73_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_73_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_73_LAYER_2_ENTRIES, 26u,
+  },
+  {
+    "altgr",
+    LAYOUT_73_LAYER_3_ENTRIES, 6u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_73_LAYER_4_ENTRIES, 6u,
+  },
+  {
+    "ctrl",
+    LAYOUT_73_LAYER_5_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_74_LAYER_0_ENTRIES[] = {
+  { 0x04, "ש" },
+  { 0x05, "נ" },
+  { 0x06, "ב" },
+  { 0x07, "ג" },
+  { 0x08, "ק" },
+  { 0x09, "כ" },
+  { 0x0A, "ע" },
+  { 0x0B, "י" },
+  { 0x0C, "ת" },
+  { 0x0D, "ח" },
+  { 0x0E, "ל" },
+  { 0x0F, "ך" },
+  { 0x10, "צ" },
+  { 0x11, "מ" },
+  { 0x12, "ם" },
+  { 0x13, "פ" },
+  { 0x14, "ץ" },
+  { 0x15, "ר" },
+  { 0x16, "ד" },
+  { 0x17, "א" },
+  { 0x18, "ו" },
+  { 0x19, "ה" },
+  { 0x1A, "ן" },
+  { 0x1B, "ס" },
+  { 0x1C, "ט" },
+  { 0x1D, "ז" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "]" },
+  { 0x30, "[" },
+  { 0x31, "\\" },
+  { 0x33, "ף" },
+  { 0x34, "'" },
+  { 0x35, ";" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_74_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, ")" },
+  { 0x27, "(" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "}" },
+  { 0x30, "{" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x36, ">" },
+  { 0x37, "<" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_74_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x33, ":" },
+};
+
+const wa_keyboard_mapping LAYOUT_74_LAYER_3_ENTRIES[] = {
+  { 0x04, "ְ" },
+  { 0x06, "ֱ" },
+  { 0x08, "ָ" },
+  { 0x0D, "ִ" },
+  { 0x0F, "”" },
+  { 0x10, "ֵ" },
+  { 0x13, "ַ" },
+  { 0x14, "ׂ" },
+  { 0x15, "ֳ" },
+  { 0x16, "ּ" },
+  { 0x18, "ֹ" },
+  { 0x1A, "ׁ" },
+  { 0x1B, "ֶ" },
+  { 0x20, "€" },
+  { 0x21, "₪" },
+  { 0x22, "°" },
+  { 0x23, "֫" },
+  { 0x24, "ֽ" },
+  { 0x25, "×" },
+  { 0x26, "‎" },
+  { 0x27, "‏" },
+  { 0x2D, "־" },
+  { 0x2E, "–" },
+  { 0x2F, "ֲ" },
+  { 0x30, "ֿ" },
+  { 0x31, "ֻ" },
+  { 0x33, "„" },
+  { 0x34, "״" },
+  { 0x35, "׳" },
+  { 0x36, "’" },
+  { 0x37, "‚" },
+  { 0x38, "÷" },
+};
+
+const wa_keyboard_mapping LAYOUT_74_LAYER_4_ENTRIES[] = {
+  { 0x05, "׆" },
+  { 0x06, "͏" },
+  { 0x0D, "‍" },
+  { 0x0F, "“" },
+  { 0x11, "‌" },
+  { 0x18, "ֺ" },
+  { 0x33, "”" },
+  { 0x36, "‘" },
+  { 0x37, "’" },
+};
+
+const wa_keyboard_mapping LAYOUT_74_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+  { 0x2F, "‎" },
+  { 0x30, "‏" },
+};
+
+const wa_keyboard_layer LAYOUT_74_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_74_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_74_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_74_LAYER_2_ENTRIES, 27u,
+  },
+  {
+    "altgr",
+    LAYOUT_74_LAYER_3_ENTRIES, 32u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_74_LAYER_4_ENTRIES, 9u,
+  },
+  {
+    "ctrl",
+    LAYOUT_74_LAYER_5_ENTRIES, 4u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_75_LAYER_0_ENTRIES[] = {
+  { 0x04, "ש" },
+  { 0x05, "נ" },
+  { 0x06, "ב" },
+  { 0x07, "ג" },
+  { 0x08, "ק" },
+  { 0x09, "כ" },
+  { 0x0A, "ע" },
+  { 0x0B, "י" },
+  { 0x0C, "ן" },
+  { 0x0D, "ח" },
+  { 0x0E, "ל" },
+  { 0x0F, "ך" },
+  { 0x10, "צ" },
+  { 0x11, "מ" },
+  { 0x12, "ם" },
+  { 0x13, "פ" },
+  { 0x14, "/" },
+  { 0x15, "ר" },
+  { 0x16, "ד" },
+  { 0x17, "א" },
+  { 0x18, "ו" },
+  { 0x19, "ה" },
+  { 0x1A, "'" },
+  { 0x1B, "ס" },
+  { 0x1C, "ט" },
+  { 0x1D, "ז" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "]" },
+  { 0x30, "[" },
+  { 0x31, "\\" },
+  { 0x33, "ף" },
+  { 0x34, "," },
+  { 0x35, ";" },
+  { 0x36, "ת" },
+  { 0x37, "ץ" },
+  { 0x38, "." },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_75_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, ")" },
+  { 0x27, "(" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "}" },
+  { 0x30, "{" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x36, ">" },
+  { 0x37, "<" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_75_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+};
+
+const wa_keyboard_mapping LAYOUT_75_LAYER_3_ENTRIES[] = {
+  { 0x04, "ְ" },
+  { 0x06, "ֱ" },
+  { 0x08, "ָ" },
+  { 0x0A, "ױ" },
+  { 0x0B, "ײ" },
+  { 0x0D, "ִ" },
+  { 0x0F, "”" },
+  { 0x10, "ֵ" },
+  { 0x13, "ַ" },
+  { 0x14, "ׂ" },
+  { 0x15, "ֳ" },
+  { 0x16, "ּ" },
+  { 0x18, "ֹ" },
+  { 0x1A, "ׁ" },
+  { 0x1B, "ֶ" },
+  { 0x1C, "װ" },
+  { 0x20, "€" },
+  { 0x21, "₪" },
+  { 0x22, "°" },
+  { 0x23, "֫" },
+  { 0x24, "ֽ" },
+  { 0x25, "×" },
+  { 0x26, "‎" },
+  { 0x27, "‏" },
+  { 0x2D, "־" },
+  { 0x2E, "–" },
+  { 0x2F, "ֲ" },
+  { 0x30, "ֿ" },
+  { 0x31, "ֻ" },
+  { 0x33, "„" },
+  { 0x34, "״" },
+  { 0x35, "׳" },
+  { 0x36, "’" },
+  { 0x37, "‚" },
+  { 0x38, "÷" },
+};
+
+const wa_keyboard_mapping LAYOUT_75_LAYER_4_ENTRIES[] = {
+  { 0x05, "׆" },
+  { 0x06, "͏" },
+  { 0x0D, "‍" },
+  { 0x0F, "“" },
+  { 0x11, "‌" },
+  { 0x18, "ֺ" },
+  { 0x33, "”" },
+  { 0x36, "‘" },
+  { 0x37, "’" },
+};
+
+const wa_keyboard_mapping LAYOUT_75_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+  { 0x2F, "‎" },
+  { 0x30, "‏" },
+};
+
+const wa_keyboard_layer LAYOUT_75_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_75_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_75_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_75_LAYER_2_ENTRIES, 31u,
+  },
+  {
+    "altgr",
+    LAYOUT_75_LAYER_3_ENTRIES, 35u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_75_LAYER_4_ENTRIES, 9u,
+  },
+  {
+    "ctrl",
+    LAYOUT_75_LAYER_5_ENTRIES, 4u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_76_LAYER_0_ENTRIES[] = {
+  { 0x04, "ש" },
+  { 0x05, "נ" },
+  { 0x06, "ב" },
+  { 0x07, "ג" },
+  { 0x08, "ק" },
+  { 0x09, "כ" },
+  { 0x0A, "ע" },
+  { 0x0B, "י" },
+  { 0x0C, "ן" },
+  { 0x0D, "ח" },
+  { 0x0E, "ל" },
+  { 0x0F, "ך" },
+  { 0x10, "צ" },
+  { 0x11, "מ" },
+  { 0x12, "ם" },
+  { 0x13, "פ" },
+  { 0x14, "/" },
+  { 0x15, "ר" },
+  { 0x16, "ד" },
+  { 0x17, "א" },
+  { 0x18, "ו" },
+  { 0x19, "ה" },
+  { 0x1A, "'" },
+  { 0x1B, "ס" },
+  { 0x1C, "ט" },
+  { 0x1D, "ז" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "]" },
+  { 0x30, "[" },
+  { 0x31, "\\" },
+  { 0x33, "ף" },
+  { 0x34, "," },
+  { 0x35, ";" },
+  { 0x36, "ת" },
+  { 0x37, "ץ" },
+  { 0x38, "." },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_76_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, ")" },
+  { 0x27, "(" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "}" },
+  { 0x30, "{" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x36, ">" },
+  { 0x37, "<" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_76_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x35, ";" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+};
+
+const wa_keyboard_mapping LAYOUT_76_LAYER_3_ENTRIES[] = {
+  { 0x08, "€" },
+  { 0x0B, "ײ" },
+  { 0x0D, "ױ" },
+  { 0x18, "װ" },
+  { 0x21, "₪" },
+  { 0x2D, "ֿ" },
+};
+
+const wa_keyboard_mapping LAYOUT_76_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+  { 0x2F, "‎" },
+  { 0x30, "‏" },
+};
+
+const wa_keyboard_layer LAYOUT_76_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_76_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_76_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_76_LAYER_2_ENTRIES, 47u,
+  },
+  {
+    "altgr",
+    LAYOUT_76_LAYER_3_ENTRIES, 6u,
+  },
+  {
+    "ctrl",
+    LAYOUT_76_LAYER_4_ENTRIES, 4u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_77_LAYER_0_ENTRIES[] = {
+  { 0x04, "ो" },
+  { 0x05, "व" },
+  { 0x06, "म" },
+  { 0x07, "्" },
+  { 0x08, "ा" },
+  { 0x09, "ि" },
+  { 0x0A, "ु" },
+  { 0x0B, "प" },
+  { 0x0C, "ग" },
+  { 0x0D, "र" },
+  { 0x0E, "क" },
+  { 0x0F, "त" },
+  { 0x10, "स" },
+  { 0x11, "ल" },
+  { 0x12, "द" },
+  { 0x13, "ज" },
+  { 0x14, "ौ" },
+  { 0x15, "ी" },
+  { 0x16, "े" },
+  { 0x17, "ू" },
+  { 0x18, "ह" },
+  { 0x19, "न" },
+  { 0x1A, "ै" },
+  { 0x1B, "ं" },
+  { 0x1C, "ब" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "ृ" },
+  { 0x2F, "ड" },
+  { 0x30, "़" },
+  { 0x31, "ॉ" },
+  { 0x33, "च" },
+  { 0x34, "ट" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "य" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "ॉ" },
+};
+
+const wa_keyboard_mapping LAYOUT_77_LAYER_1_ENTRIES[] = {
+  { 0x04, "ओ" },
+  { 0x06, "ण" },
+  { 0x07, "अ" },
+  { 0x08, "आ" },
+  { 0x09, "इ" },
+  { 0x0A, "उ" },
+  { 0x0B, "फ" },
+  { 0x0C, "घ" },
+  { 0x0D, "ऱ" },
+  { 0x0E, "ख" },
+  { 0x0F, "थ" },
+  { 0x10, "श" },
+  { 0x11, "ळ" },
+  { 0x12, "ध" },
+  { 0x13, "झ" },
+  { 0x14, "औ" },
+  { 0x15, "ई" },
+  { 0x16, "ए" },
+  { 0x17, "ऊ" },
+  { 0x18, "ङ" },
+  { 0x1A, "ऐ" },
+  { 0x1B, "ँ" },
+  { 0x1C, "भ" },
+  { 0x1E, "ऍ" },
+  { 0x1F, "ॅ" },
+  { 0x20, "्र" },
+  { 0x21, "र्" },
+  { 0x22, "ज्ञ" },
+  { 0x23, "त्र" },
+  { 0x24, "क्ष" },
+  { 0x25, "श्र" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "ः" },
+  { 0x2E, "ऋ" },
+  { 0x2F, "ढ" },
+  { 0x30, "ञ" },
+  { 0x31, "ऑ" },
+  { 0x33, "छ" },
+  { 0x34, "ठ" },
+  { 0x36, "ष" },
+  { 0x37, "।" },
+  { 0x38, "य़" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "ऑ" },
+};
+
+const wa_keyboard_mapping LAYOUT_77_LAYER_2_ENTRIES[] = {
+  { 0x1E, "१" },
+  { 0x1F, "२" },
+  { 0x20, "३" },
+  { 0x21, "४" },
+  { 0x22, "५" },
+  { 0x23, "६" },
+  { 0x24, "७" },
+  { 0x25, "८" },
+  { 0x26, "९" },
+  { 0x27, "०" },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x35, "`" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+};
+
+const wa_keyboard_mapping LAYOUT_77_LAYER_3_ENTRIES[] = {
+  { 0x1B, "ॐ" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "?" },
+};
+
+const wa_keyboard_mapping LAYOUT_77_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_77_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_77_LAYER_0_ENTRIES, 51u,
+  },
+  {
+    "shift",
+    LAYOUT_77_LAYER_1_ENTRIES, 49u,
+  },
+  {
+    "altgr",
+    LAYOUT_77_LAYER_2_ENTRIES, 21u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_77_LAYER_3_ENTRIES, 22u,
+  },
+  {
+    "ctrl",
+    LAYOUT_77_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_78_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "ö" },
+  { 0x2C, " " },
+  { 0x2D, "ü" },
+  { 0x2E, "ó" },
+  { 0x2F, "ő" },
+  { 0x30, "ú" },
+  { 0x31, "ű" },
+  { 0x33, "é" },
+  { 0x34, "á" },
+  { 0x35, "í" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "-" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "í" },
+};
+
+const wa_keyboard_mapping LAYOUT_78_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "'" },
+  { 0x1F, "\"" },
+  { 0x20, "+" },
+  { 0x21, "!" },
+  { 0x22, "%" },
+  { 0x23, "/" },
+  { 0x24, "=" },
+  { 0x25, "(" },
+  { 0x26, ")" },
+  { 0x27, "Ö" },
+  { 0x2C, " " },
+  { 0x2D, "Ü" },
+  { 0x2E, "Ó" },
+  { 0x2F, "Ő" },
+  { 0x30, "Ú" },
+  { 0x31, "Ű" },
+  { 0x33, "É" },
+  { 0x34, "Á" },
+  { 0x35, "Í" },
+  { 0x36, "?" },
+  { 0x37, ":" },
+  { 0x38, "_" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "Í" },
+};
+
+const wa_keyboard_mapping LAYOUT_78_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x27, "Ö" },
+  { 0x2D, "Ü" },
+  { 0x2E, "Ó" },
+  { 0x2F, "Ő" },
+  { 0x30, "Ú" },
+  { 0x31, "Ű" },
+  { 0x33, "É" },
+  { 0x34, "Á" },
+  { 0x35, "Í" },
+  { 0x64, "Í" },
+};
+
+const wa_keyboard_mapping LAYOUT_78_LAYER_3_ENTRIES[] = {
+  { 0x04, "ä" },
+  { 0x05, "{" },
+  { 0x06, "&" },
+  { 0x07, "Đ" },
+  { 0x08, "Ä" },
+  { 0x09, "[" },
+  { 0x0A, "]" },
+  { 0x0C, "Í" },
+  { 0x0D, "í" },
+  { 0x0E, "ł" },
+  { 0x0F, "Ł" },
+  { 0x10, "<" },
+  { 0x11, "}" },
+  { 0x14, "\\" },
+  { 0x15, "§" },
+  { 0x16, "đ" },
+  { 0x17, "¤" },
+  { 0x18, "€" },
+  { 0x19, "@" },
+  { 0x1A, "|" },
+  { 0x1B, "#" },
+  { 0x1D, ">" },
+  { 0x1E, "~" },
+  { 0x1F, "ˇ" },
+  { 0x20, "^" },
+  { 0x21, "˘" },
+  { 0x22, "°" },
+  { 0x23, "˛" },
+  { 0x24, "`" },
+  { 0x25, "˙" },
+  { 0x26, "´" },
+  { 0x27, "˝" },
+  { 0x2F, "÷" },
+  { 0x30, "×" },
+  { 0x31, "\\" },
+  { 0x33, "$" },
+  { 0x34, "ß" },
+  { 0x35, "0" },
+  { 0x36, ";" },
+  { 0x37, ">" },
+  { 0x38, "*" },
+  { 0x64, "<" },
+};
+
+const wa_keyboard_mapping LAYOUT_78_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_78_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_78_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_78_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_78_LAYER_2_ENTRIES, 36u,
+  },
+  {
+    "altgr",
+    LAYOUT_78_LAYER_3_ENTRIES, 42u,
+  },
+  {
+    "ctrl",
+    LAYOUT_78_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_79_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "z" },
+  { 0x1D, "y" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "ö" },
+  { 0x2C, " " },
+  { 0x2D, "ü" },
+  { 0x2E, "ó" },
+  { 0x2F, "ő" },
+  { 0x30, "ú" },
+  { 0x31, "ű" },
+  { 0x33, "é" },
+  { 0x34, "á" },
+  { 0x35, "0" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "-" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "í" },
+};
+
+const wa_keyboard_mapping LAYOUT_79_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Z" },
+  { 0x1D, "Y" },
+  { 0x1E, "'" },
+  { 0x1F, "\"" },
+  { 0x20, "+" },
+  { 0x21, "!" },
+  { 0x22, "%" },
+  { 0x23, "/" },
+  { 0x24, "=" },
+  { 0x25, "(" },
+  { 0x26, ")" },
+  { 0x27, "Ö" },
+  { 0x2C, " " },
+  { 0x2D, "Ü" },
+  { 0x2E, "Ó" },
+  { 0x2F, "Ő" },
+  { 0x30, "Ú" },
+  { 0x31, "Ű" },
+  { 0x33, "É" },
+  { 0x34, "Á" },
+  { 0x35, "§" },
+  { 0x36, "?" },
+  { 0x37, ":" },
+  { 0x38, "_" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "Í" },
+};
+
+const wa_keyboard_mapping LAYOUT_79_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Z" },
+  { 0x1D, "Y" },
+  { 0x27, "Ö" },
+  { 0x2D, "Ü" },
+  { 0x2E, "Ó" },
+  { 0x2F, "Ő" },
+  { 0x30, "Ú" },
+  { 0x31, "Ű" },
+  { 0x33, "É" },
+  { 0x34, "Á" },
+  { 0x64, "Í" },
+};
+
+const wa_keyboard_mapping LAYOUT_79_LAYER_3_ENTRIES[] = {
+  { 0x04, "ä" },
+  { 0x05, "{" },
+  { 0x06, "&" },
+  { 0x07, "Đ" },
+  { 0x08, "Ä" },
+  { 0x09, "[" },
+  { 0x0A, "]" },
+  { 0x0C, "Í" },
+  { 0x0D, "í" },
+  { 0x0E, "ł" },
+  { 0x0F, "Ł" },
+  { 0x10, "<" },
+  { 0x11, "}" },
+  { 0x14, "\\" },
+  { 0x16, "đ" },
+  { 0x18, "€" },
+  { 0x19, "@" },
+  { 0x1A, "|" },
+  { 0x1B, "#" },
+  { 0x1D, ">" },
+  { 0x1E, "~" },
+  { 0x1F, "ˇ" },
+  { 0x20, "^" },
+  { 0x21, "˘" },
+  { 0x22, "°" },
+  { 0x23, "˛" },
+  { 0x24, "`" },
+  { 0x25, "˙" },
+  { 0x26, "´" },
+  { 0x27, "˝" },
+  { 0x2D, "¨" },
+  { 0x2E, "¸" },
+  { 0x2F, "÷" },
+  { 0x30, "×" },
+  { 0x31, "¤" },
+  { 0x33, "$" },
+  { 0x34, "ß" },
+  { 0x36, ";" },
+  { 0x37, ">" },
+  { 0x38, "*" },
+  { 0x64, "<" },
+};
+
+const wa_keyboard_mapping LAYOUT_79_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_79_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_79_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_79_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_79_LAYER_2_ENTRIES, 35u,
+  },
+  {
+    "altgr",
+    LAYOUT_79_LAYER_3_ENTRIES, 41u,
+  },
+  {
+    "ctrl",
+    LAYOUT_79_LAYER_4_ENTRIES, 2u,
+  },
+};
+
@@ -0,0 +1,7652 @@
+#include "worldalphabets_data.h"
+
+const wa_keyboard_mapping LAYOUT_80_LAYER_0_ENTRIES[] = {
+  { 0x04, "ա" },
+  { 0x05, "բ" },
+  { 0x06, "գ" },
+  { 0x07, "դ" },
+  { 0x08, "է" },
+  { 0x09, "ֆ" },
+  { 0x0A, "ք" },
+  { 0x0B, "հ" },
+  { 0x0C, "ի" },
+  { 0x0D, "ճ" },
+  { 0x0E, "կ" },
+  { 0x0F, "լ" },
+  { 0x10, "մ" },
+  { 0x11, "ն" },
+  { 0x12, "ո" },
+  { 0x13, "պ" },
+  { 0x14, "խ" },
+  { 0x15, "ր" },
+  { 0x16, "ս" },
+  { 0x17, "տ" },
+  { 0x18, "ը" },
+  { 0x19, "վ" },
+  { 0x1A, "ւ" },
+  { 0x1B, "ց" },
+  { 0x1C, "ե" },
+  { 0x1D, "զ" },
+  { 0x1E, ":" },
+  { 0x1F, "ձ" },
+  { 0x20, "յ" },
+  { 0x21, "՛" },
+  { 0x22, "," },
+  { 0x23, "-" },
+  { 0x24, "." },
+  { 0x25, "«" },
+  { 0x26, "»" },
+  { 0x27, "օ" },
+  { 0x2C, " " },
+  { 0x2D, "ռ" },
+  { 0x2E, "ժ" },
+  { 0x2F, "չ" },
+  { 0x30, "ջ" },
+  { 0x31, "'" },
+  { 0x33, "թ" },
+  { 0x34, "փ" },
+  { 0x35, "՝" },
+  { 0x36, "շ" },
+  { 0x37, "ղ" },
+  { 0x38, "ծ" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "'" },
+};
+
+const wa_keyboard_mapping LAYOUT_80_LAYER_1_ENTRIES[] = {
+  { 0x04, "Ա" },
+  { 0x05, "Բ" },
+  { 0x06, "Գ" },
+  { 0x07, "Դ" },
+  { 0x08, "Է" },
+  { 0x09, "Ֆ" },
+  { 0x0A, "Ք" },
+  { 0x0B, "Հ" },
+  { 0x0C, "Ի" },
+  { 0x0D, "Ճ" },
+  { 0x0E, "Կ" },
+  { 0x0F, "Լ" },
+  { 0x10, "Մ" },
+  { 0x11, "Ն" },
+  { 0x12, "Ո" },
+  { 0x13, "Պ" },
+  { 0x14, "Խ" },
+  { 0x15, "Ր" },
+  { 0x16, "Ս" },
+  { 0x17, "Տ" },
+  { 0x18, "Ը" },
+  { 0x19, "Վ" },
+  { 0x1A, "Ւ" },
+  { 0x1B, "Ց" },
+  { 0x1C, "Ե" },
+  { 0x1D, "Զ" },
+  { 0x1E, "1" },
+  { 0x1F, "Ձ" },
+  { 0x20, "Յ" },
+  { 0x21, "3" },
+  { 0x22, "4" },
+  { 0x23, "9" },
+  { 0x24, "և" },
+  { 0x25, "(" },
+  { 0x26, ")" },
+  { 0x27, "Օ" },
+  { 0x2C, " " },
+  { 0x2D, "Ռ" },
+  { 0x2E, "Ժ" },
+  { 0x2F, "Չ" },
+  { 0x30, "Ջ" },
+  { 0x31, "՞" },
+  { 0x33, "Թ" },
+  { 0x34, "Փ" },
+  { 0x35, "՜" },
+  { 0x36, "Շ" },
+  { 0x37, "Ղ" },
+  { 0x38, "Ծ" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "՞" },
+};
+
+const wa_keyboard_mapping LAYOUT_80_LAYER_2_ENTRIES[] = {
+  { 0x04, "Ա" },
+  { 0x05, "Բ" },
+  { 0x06, "Գ" },
+  { 0x07, "Դ" },
+  { 0x08, "Է" },
+  { 0x09, "Ֆ" },
+  { 0x0A, "Ք" },
+  { 0x0B, "Հ" },
+  { 0x0C, "Ի" },
+  { 0x0D, "Ճ" },
+  { 0x0E, "Կ" },
+  { 0x0F, "Լ" },
+  { 0x10, "Մ" },
+  { 0x11, "Ն" },
+  { 0x12, "Ո" },
+  { 0x13, "Պ" },
+  { 0x14, "Խ" },
+  { 0x15, "Ր" },
+  { 0x16, "Ս" },
+  { 0x17, "Տ" },
+  { 0x18, "Ը" },
+  { 0x19, "Վ" },
+  { 0x1A, "Ւ" },
+  { 0x1B, "Ց" },
+  { 0x1C, "Ե" },
+  { 0x1D, "Զ" },
+  { 0x1F, "Ձ" },
+  { 0x20, "Յ" },
+  { 0x27, "Օ" },
+  { 0x2D, "Ռ" },
+  { 0x2E, "Ժ" },
+  { 0x2F, "Չ" },
+  { 0x30, "Ջ" },
+  { 0x33, "Թ" },
+  { 0x34, "Փ" },
+  { 0x36, "Շ" },
+  { 0x37, "Ղ" },
+  { 0x38, "Ծ" },
+};
+
+const wa_keyboard_mapping LAYOUT_80_LAYER_3_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_80_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_80_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_80_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_80_LAYER_2_ENTRIES, 38u,
+  },
+  {
+    "ctrl",
+    LAYOUT_80_LAYER_3_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_81_LAYER_0_ENTRIES[] = {
+  { 0x04, "ա" },
+  { 0x05, "բ" },
+  { 0x06, "ց" },
+  { 0x07, "դ" },
+  { 0x08, "ե" },
+  { 0x09, "ֆ" },
+  { 0x0A, "գ" },
+  { 0x0B, "հ" },
+  { 0x0C, "ի" },
+  { 0x0D, "յ" },
+  { 0x0E, "կ" },
+  { 0x0F, "լ" },
+  { 0x10, "մ" },
+  { 0x11, "ն" },
+  { 0x12, "օ" },
+  { 0x13, "պ" },
+  { 0x14, "ք" },
+  { 0x15, "ռ" },
+  { 0x16, "ս" },
+  { 0x17, "տ" },
+  { 0x18, "ւ" },
+  { 0x19, "վ" },
+  { 0x1A, "ո" },
+  { 0x1B, "ղ" },
+  { 0x1C, "ը" },
+  { 0x1D, "զ" },
+  { 0x1E, "է" },
+  { 0x1F, "թ" },
+  { 0x20, "փ" },
+  { 0x21, "ձ" },
+  { 0x22, "ջ" },
+  { 0x23, "ւ" },
+  { 0x24, "և" },
+  { 0x25, "ր" },
+  { 0x26, "չ" },
+  { 0x27, "ճ" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "ժ" },
+  { 0x2F, "խ" },
+  { 0x30, "ծ" },
+  { 0x31, "շ" },
+  { 0x33, ";" },
+  { 0x34, "՛" },
+  { 0x35, "՝" },
+  { 0x36, "," },
+  { 0x37, "․" },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "»" },
+};
+
+const wa_keyboard_mapping LAYOUT_81_LAYER_1_ENTRIES[] = {
+  { 0x04, "Ա" },
+  { 0x05, "Բ" },
+  { 0x06, "Ց" },
+  { 0x07, "Դ" },
+  { 0x08, "Ե" },
+  { 0x09, "Ֆ" },
+  { 0x0A, "Գ" },
+  { 0x0B, "Հ" },
+  { 0x0C, "Ի" },
+  { 0x0D, "Յ" },
+  { 0x0E, "Կ" },
+  { 0x0F, "Լ" },
+  { 0x10, "Մ" },
+  { 0x11, "Ն" },
+  { 0x12, "Օ" },
+  { 0x13, "Պ" },
+  { 0x14, "Ք" },
+  { 0x15, "Ռ" },
+  { 0x16, "Ս" },
+  { 0x17, "Տ" },
+  { 0x18, "Ւ" },
+  { 0x19, "Վ" },
+  { 0x1A, "Ո" },
+  { 0x1B, "Ղ" },
+  { 0x1C, "Ը" },
+  { 0x1D, "Զ" },
+  { 0x1E, "Է" },
+  { 0x1F, "Թ" },
+  { 0x20, "Փ" },
+  { 0x21, "Ձ" },
+  { 0x22, "Ջ" },
+  { 0x23, "Ւ" },
+  { 0x24, "և" },
+  { 0x25, "Ր" },
+  { 0x26, "Չ" },
+  { 0x27, "Ճ" },
+  { 0x2C, " " },
+  { 0x2D, "—" },
+  { 0x2E, "Ժ" },
+  { 0x2F, "Խ" },
+  { 0x30, "Ծ" },
+  { 0x31, "Շ" },
+  { 0x33, "։" },
+  { 0x34, "\"" },
+  { 0x35, "՜" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "՞" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "«" },
+};
+
+const wa_keyboard_mapping LAYOUT_81_LAYER_2_ENTRIES[] = {
+  { 0x04, "Ա" },
+  { 0x05, "Բ" },
+  { 0x06, "Ց" },
+  { 0x07, "Դ" },
+  { 0x08, "Ե" },
+  { 0x09, "Ֆ" },
+  { 0x0A, "Գ" },
+  { 0x0B, "Հ" },
+  { 0x0C, "Ի" },
+  { 0x0D, "Յ" },
+  { 0x0E, "Կ" },
+  { 0x0F, "Լ" },
+  { 0x10, "Մ" },
+  { 0x11, "Ն" },
+  { 0x12, "Օ" },
+  { 0x13, "Պ" },
+  { 0x14, "Ք" },
+  { 0x15, "Ռ" },
+  { 0x16, "Ս" },
+  { 0x17, "Տ" },
+  { 0x18, "Ւ" },
+  { 0x19, "Վ" },
+  { 0x1A, "Ո" },
+  { 0x1B, "Ղ" },
+  { 0x1C, "Ը" },
+  { 0x1D, "Զ" },
+  { 0x1E, "Է" },
+  { 0x1F, "Թ" },
+  { 0x20, "Փ" },
+  { 0x21, "Ձ" },
+  { 0x22, "Ջ" },
+  { 0x23, "Ւ" },
+  { 0x25, "Ր" },
+  { 0x26, "Չ" },
+  { 0x27, "Ճ" },
+  { 0x2E, "Ժ" },
+  { 0x2F, "Խ" },
+  { 0x30, "Ծ" },
+  { 0x31, "Շ" },
+};
+
+const wa_keyboard_mapping LAYOUT_81_LAYER_3_ENTRIES[] = {
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x35, "`" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+};
+
+const wa_keyboard_mapping LAYOUT_81_LAYER_4_ENTRIES[] = {
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "?" },
+};
+
+const wa_keyboard_mapping LAYOUT_81_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_81_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_81_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_81_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_81_LAYER_2_ENTRIES, 39u,
+  },
+  {
+    "altgr",
+    LAYOUT_81_LAYER_3_ENTRIES, 21u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_81_LAYER_4_ENTRIES, 21u,
+  },
+  {
+    "ctrl",
+    LAYOUT_81_LAYER_5_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_82_LAYER_0_ENTRIES[] = {
+  { 0x04, "ջ" },
+  { 0x05, "զ" },
+  { 0x06, "չ" },
+  { 0x07, "գ" },
+  { 0x08, "բ" },
+  { 0x09, "ե" },
+  { 0x0A, "ա" },
+  { 0x0B, "ն" },
+  { 0x0C, "կ" },
+  { 0x0D, "ի" },
+  { 0x0E, "տ" },
+  { 0x0F, "հ" },
+  { 0x10, "ք" },
+  { 0x11, "լ" },
+  { 0x12, "ը" },
+  { 0x13, "թ" },
+  { 0x14, "ճ" },
+  { 0x15, "ս" },
+  { 0x16, "վ" },
+  { 0x17, "մ" },
+  { 0x18, "ւ" },
+  { 0x19, "յ" },
+  { 0x1A, "փ" },
+  { 0x1B, "դ" },
+  { 0x1C, "ո" },
+  { 0x1D, "ժ" },
+  { 0x1E, "ֆ" },
+  { 0x1F, "ձ" },
+  { 0x20, "-" },
+  { 0x21, "," },
+  { 0x22, "։" },
+  { 0x23, "՞" },
+  { 0x24, "․" },
+  { 0x25, "՛" },
+  { 0x26, ")" },
+  { 0x27, "օ" },
+  { 0x2C, " " },
+  { 0x2D, "է" },
+  { 0x2E, "ղ" },
+  { 0x2F, "ծ" },
+  { 0x30, "ց" },
+  { 0x31, "»" },
+  { 0x33, "պ" },
+  { 0x34, "ր" },
+  { 0x35, "՝" },
+  { 0x36, "խ" },
+  { 0x37, "շ" },
+  { 0x38, "ռ" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_82_LAYER_1_ENTRIES[] = {
+  { 0x04, "Ջ" },
+  { 0x05, "Զ" },
+  { 0x06, "Չ" },
+  { 0x07, "Գ" },
+  { 0x08, "Բ" },
+  { 0x09, "Ե" },
+  { 0x0A, "Ա" },
+  { 0x0B, "Ն" },
+  { 0x0C, "Կ" },
+  { 0x0D, "Ի" },
+  { 0x0E, "Տ" },
+  { 0x0F, "Հ" },
+  { 0x10, "Ք" },
+  { 0x11, "Լ" },
+  { 0x12, "Ը" },
+  { 0x13, "Թ" },
+  { 0x14, "Ճ" },
+  { 0x15, "Ս" },
+  { 0x16, "Վ" },
+  { 0x17, "Մ" },
+  { 0x18, "Ւ" },
+  { 0x19, "Յ" },
+  { 0x1A, "Փ" },
+  { 0x1B, "Դ" },
+  { 0x1C, "Ո" },
+  { 0x1D, "Ժ" },
+  { 0x1E, "Ֆ" },
+  { 0x1F, "Ձ" },
+  { 0x21, "֏" },
+  { 0x22, "֊" },
+  { 0x23, "—" },
+  { 0x24, "և" },
+  { 0x25, "՚" },
+  { 0x26, "(" },
+  { 0x27, "Օ" },
+  { 0x2C, " " },
+  { 0x2D, "Է" },
+  { 0x2E, "Ղ" },
+  { 0x2F, "Ծ" },
+  { 0x30, "Ց" },
+  { 0x31, "«" },
+  { 0x33, "Պ" },
+  { 0x34, "Ր" },
+  { 0x35, "՜" },
+  { 0x36, "Խ" },
+  { 0x37, "Շ" },
+  { 0x38, "Ռ" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_82_LAYER_2_ENTRIES[] = {
+  { 0x04, "Ջ" },
+  { 0x05, "Զ" },
+  { 0x06, "Չ" },
+  { 0x07, "Գ" },
+  { 0x08, "Բ" },
+  { 0x09, "Ե" },
+  { 0x0A, "Ա" },
+  { 0x0B, "Ն" },
+  { 0x0C, "Կ" },
+  { 0x0D, "Ի" },
+  { 0x0E, "Տ" },
+  { 0x0F, "Հ" },
+  { 0x10, "Ք" },
+  { 0x11, "Լ" },
+  { 0x12, "Ը" },
+  { 0x13, "Թ" },
+  { 0x14, "Ճ" },
+  { 0x15, "Ս" },
+  { 0x16, "Վ" },
+  { 0x17, "Մ" },
+  { 0x18, "Ւ" },
+  { 0x19, "Յ" },
+  { 0x1A, "Փ" },
+  { 0x1B, "Դ" },
+  { 0x1C, "Ո" },
+  { 0x1D, "Ժ" },
+  { 0x1E, "Ֆ" },
+  { 0x1F, "Ձ" },
+  { 0x27, "Օ" },
+  { 0x2D, "Է" },
+  { 0x2E, "Ղ" },
+  { 0x2F, "Ծ" },
+  { 0x30, "Ց" },
+  { 0x33, "Պ" },
+  { 0x34, "Ր" },
+  { 0x36, "Խ" },
+  { 0x37, "Շ" },
+  { 0x38, "Ռ" },
+};
+
+const wa_keyboard_mapping LAYOUT_82_LAYER_3_ENTRIES[] = {
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x35, "`" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+};
+
+const wa_keyboard_mapping LAYOUT_82_LAYER_4_ENTRIES[] = {
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "?" },
+};
+
+const wa_keyboard_mapping LAYOUT_82_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+};
+
+const wa_keyboard_layer LAYOUT_82_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_82_LAYER_0_ENTRIES, 52u,
+  },
+  {
+    "shift",
+    LAYOUT_82_LAYER_1_ENTRIES, 51u,
+  },
+  {
+    "caps",
+    LAYOUT_82_LAYER_2_ENTRIES, 38u,
+  },
+  {
+    "altgr",
+    LAYOUT_82_LAYER_3_ENTRIES, 21u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_82_LAYER_4_ENTRIES, 21u,
+  },
+  {
+    "ctrl",
+    LAYOUT_82_LAYER_5_ENTRIES, 1u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_83_LAYER_0_ENTRIES[] = {
+  { 0x04, "ա" },
+  { 0x05, "պ" },
+  { 0x06, "գ" },
+  { 0x07, "տ" },
+  { 0x08, "է" },
+  { 0x09, "ֆ" },
+  { 0x0A, "կ" },
+  { 0x0B, "հ" },
+  { 0x0C, "ի" },
+  { 0x0D, "ճ" },
+  { 0x0E, "ք" },
+  { 0x0F, "լ" },
+  { 0x10, "մ" },
+  { 0x11, "ն" },
+  { 0x12, "ո" },
+  { 0x13, "բ" },
+  { 0x14, "խ" },
+  { 0x15, "ր" },
+  { 0x16, "ս" },
+  { 0x17, "դ" },
+  { 0x18, "ը" },
+  { 0x19, "ւ" },
+  { 0x1A, "վ" },
+  { 0x1B, "ց" },
+  { 0x1C, "ե" },
+  { 0x1D, "զ" },
+  { 0x1E, ":" },
+  { 0x1F, "ձ" },
+  { 0x20, "յ" },
+  { 0x21, "՛" },
+  { 0x22, "," },
+  { 0x23, "-" },
+  { 0x24, "." },
+  { 0x25, "«" },
+  { 0x26, "»" },
+  { 0x27, "օ" },
+  { 0x2C, " " },
+  { 0x2D, "ռ" },
+  { 0x2E, "ժ" },
+  { 0x2F, "չ" },
+  { 0x30, "ջ" },
+  { 0x31, "'" },
+  { 0x33, "թ" },
+  { 0x34, "փ" },
+  { 0x35, "՝" },
+  { 0x36, "շ" },
+  { 0x37, "ղ" },
+  { 0x38, "ծ" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "'" },
+};
+
+const wa_keyboard_mapping LAYOUT_83_LAYER_1_ENTRIES[] = {
+  { 0x04, "Ա" },
+  { 0x05, "Պ" },
+  { 0x06, "Գ" },
+  { 0x07, "Տ" },
+  { 0x08, "Է" },
+  { 0x09, "Ֆ" },
+  { 0x0A, "Կ" },
+  { 0x0B, "Հ" },
+  { 0x0C, "Ի" },
+  { 0x0D, "Ճ" },
+  { 0x0E, "Ք" },
+  { 0x0F, "Լ" },
+  { 0x10, "Մ" },
+  { 0x11, "Ն" },
+  { 0x12, "Ո" },
+  { 0x13, "Բ" },
+  { 0x14, "Խ" },
+  { 0x15, "Ր" },
+  { 0x16, "Ս" },
+  { 0x17, "Դ" },
+  { 0x18, "Ը" },
+  { 0x19, "Ւ" },
+  { 0x1A, "Վ" },
+  { 0x1B, "Ց" },
+  { 0x1C, "Ե" },
+  { 0x1D, "Զ" },
+  { 0x1E, "1" },
+  { 0x1F, "Ձ" },
+  { 0x20, "Յ" },
+  { 0x21, "3" },
+  { 0x22, "4" },
+  { 0x23, "9" },
+  { 0x24, "և" },
+  { 0x25, "(" },
+  { 0x26, ")" },
+  { 0x27, "Օ" },
+  { 0x2C, " " },
+  { 0x2D, "Ռ" },
+  { 0x2E, "Ժ" },
+  { 0x2F, "Չ" },
+  { 0x30, "Ջ" },
+  { 0x31, "՞" },
+  { 0x33, "Թ" },
+  { 0x34, "Փ" },
+  { 0x35, "՜" },
+  { 0x36, "Շ" },
+  { 0x37, "Ղ" },
+  { 0x38, "Ծ" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "՞" },
+};
+
+const wa_keyboard_mapping LAYOUT_83_LAYER_2_ENTRIES[] = {
+  { 0x04, "Ա" },
+  { 0x05, "Պ" },
+  { 0x06, "Գ" },
+  { 0x07, "Տ" },
+  { 0x08, "Է" },
+  { 0x09, "Ֆ" },
+  { 0x0A, "Կ" },
+  { 0x0B, "Հ" },
+  { 0x0C, "Ի" },
+  { 0x0D, "Ճ" },
+  { 0x0E, "Ք" },
+  { 0x0F, "Լ" },
+  { 0x10, "Մ" },
+  { 0x11, "Ն" },
+  { 0x12, "Ո" },
+  { 0x13, "Բ" },
+  { 0x14, "Խ" },
+  { 0x15, "Ր" },
+  { 0x16, "Ս" },
+  { 0x17, "Դ" },
+  { 0x18, "Ը" },
+  { 0x19, "Ւ" },
+  { 0x1A, "Վ" },
+  { 0x1B, "Ց" },
+  { 0x1C, "Ե" },
+  { 0x1D, "Զ" },
+  { 0x1F, "Ձ" },
+  { 0x20, "Յ" },
+  { 0x27, "Օ" },
+  { 0x2D, "Ռ" },
+  { 0x2E, "Ժ" },
+  { 0x2F, "Չ" },
+  { 0x30, "Ջ" },
+  { 0x33, "Թ" },
+  { 0x34, "Փ" },
+  { 0x36, "Շ" },
+  { 0x37, "Ղ" },
+  { 0x38, "Ծ" },
+};
+
+const wa_keyboard_mapping LAYOUT_83_LAYER_3_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_83_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_83_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_83_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_83_LAYER_2_ENTRIES, 38u,
+  },
+  {
+    "ctrl",
+    LAYOUT_83_LAYER_3_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_84_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x35, "`" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_84_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_84_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+};
+
+const wa_keyboard_mapping LAYOUT_84_LAYER_3_ENTRIES[] = {
+  { 0x04, "ọ́" },
+  { 0x07, "ọ̄" },
+  { 0x08, "ị̄" },
+  { 0x09, "ụ́" },
+  { 0x0A, "ụ̀" },
+  { 0x0B, "ụ̄" },
+  { 0x0C, "ị" },
+  { 0x10, "m̀" },
+  { 0x11, "ṅ" },
+  { 0x12, "ọ" },
+  { 0x14, "ị́" },
+  { 0x16, "ọ̀" },
+  { 0x18, "ụ" },
+  { 0x1A, "ị̀" },
+  { 0x22, "€" },
+  { 0x26, "‘" },
+  { 0x27, "’" },
+  { 0x33, "¶" },
+  { 0x34, "´" },
+  { 0x36, "m̄" },
+  { 0x37, "n̄" },
+};
+
+const wa_keyboard_mapping LAYOUT_84_LAYER_4_ENTRIES[] = {
+  { 0x04, "Ọ́" },
+  { 0x07, "Ọ̄" },
+  { 0x08, "Ị̄" },
+  { 0x09, "Ụ́" },
+  { 0x0A, "Ụ̀" },
+  { 0x0B, "Ụ̄" },
+  { 0x0C, "Ị" },
+  { 0x10, "M̀" },
+  { 0x11, "Ṅ" },
+  { 0x12, "Ọ" },
+  { 0x14, "Ị́" },
+  { 0x16, "Ọ̀" },
+  { 0x18, "Ụ" },
+  { 0x1A, "Ị̀" },
+  { 0x31, "¦" },
+  { 0x36, "M̄" },
+  { 0x37, "N̄" },
+};
+
+const wa_keyboard_mapping LAYOUT_84_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_84_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_84_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_84_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_84_LAYER_2_ENTRIES, 26u,
+  },
+  {
+    "altgr",
+    LAYOUT_84_LAYER_3_ENTRIES, 21u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_84_LAYER_4_ENTRIES, 17u,
+  },
+  {
+    "ctrl",
+    LAYOUT_84_LAYER_5_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_85_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "ö" },
+  { 0x2E, "-" },
+  { 0x2F, "ð" },
+  { 0x30, "'" },
+  { 0x31, "+" },
+  { 0x33, "æ" },
+  { 0x34, "´" },
+  { 0x35, "°" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "þ" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "<" },
+};
+
+const wa_keyboard_mapping LAYOUT_85_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "&" },
+  { 0x24, "/" },
+  { 0x25, "(" },
+  { 0x26, ")" },
+  { 0x27, "=" },
+  { 0x2C, " " },
+  { 0x2D, "Ö" },
+  { 0x2E, "_" },
+  { 0x2F, "Ð" },
+  { 0x30, "?" },
+  { 0x31, "*" },
+  { 0x33, "Æ" },
+  { 0x34, "'" },
+  { 0x35, "¨" },
+  { 0x36, ";" },
+  { 0x37, ":" },
+  { 0x38, "Þ" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_85_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x2D, "Ö" },
+  { 0x2F, "Ð" },
+  { 0x33, "Æ" },
+  { 0x38, "Þ" },
+};
+
+const wa_keyboard_mapping LAYOUT_85_LAYER_3_ENTRIES[] = {
+  { 0x08, "€" },
+  { 0x10, "µ" },
+  { 0x14, "@" },
+  { 0x22, "€" },
+  { 0x24, "{" },
+  { 0x25, "[" },
+  { 0x26, "]" },
+  { 0x27, "}" },
+  { 0x2D, "\\" },
+  { 0x30, "~" },
+  { 0x31, "`" },
+  { 0x34, "^" },
+  { 0x35, "°" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_85_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_85_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_85_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_85_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_85_LAYER_2_ENTRIES, 30u,
+  },
+  {
+    "altgr",
+    LAYOUT_85_LAYER_3_ENTRIES, 14u,
+  },
+  {
+    "ctrl",
+    LAYOUT_85_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_86_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "'" },
+  { 0x2E, "ì" },
+  { 0x2F, "è" },
+  { 0x30, "+" },
+  { 0x31, "ù" },
+  { 0x33, "ò" },
+  { 0x34, "à" },
+  { 0x35, "\\" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "-" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "<" },
+};
+
+const wa_keyboard_mapping LAYOUT_86_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "£" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "&" },
+  { 0x24, "/" },
+  { 0x25, "(" },
+  { 0x26, ")" },
+  { 0x27, "=" },
+  { 0x2C, " " },
+  { 0x2D, "?" },
+  { 0x2E, "^" },
+  { 0x2F, "é" },
+  { 0x30, "*" },
+  { 0x31, "§" },
+  { 0x33, "ç" },
+  { 0x34, "°" },
+  { 0x35, "|" },
+  { 0x36, ";" },
+  { 0x37, ":" },
+  { 0x38, "_" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_86_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+};
+
+const wa_keyboard_mapping LAYOUT_86_LAYER_3_ENTRIES[] = {
+  { 0x08, "€" },
+  { 0x14, "@" },
+  { 0x20, "#" },
+  { 0x22, "€" },
+  { 0x24, "{" },
+  { 0x25, "[" },
+  { 0x26, "]" },
+  { 0x27, "}" },
+  { 0x30, "~" },
+  { 0x31, "`" },
+};
+
+const wa_keyboard_mapping LAYOUT_86_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_86_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_86_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_86_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_86_LAYER_2_ENTRIES, 26u,
+  },
+  {
+    "altgr",
+    LAYOUT_86_LAYER_3_ENTRIES, 10u,
+  },
+  {
+    "ctrl",
+    LAYOUT_86_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_87_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "'" },
+  { 0x2E, "ì" },
+  { 0x2F, "è" },
+  { 0x30, "+" },
+  { 0x31, "ù" },
+  { 0x33, "ò" },
+  { 0x34, "à" },
+  { 0x35, "\\" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "-" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "<" },
+};
+
+const wa_keyboard_mapping LAYOUT_87_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "£" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "&" },
+  { 0x24, "/" },
+  { 0x25, "(" },
+  { 0x26, ")" },
+  { 0x27, "=" },
+  { 0x2C, " " },
+  { 0x2D, "?" },
+  { 0x2E, "^" },
+  { 0x2F, "é" },
+  { 0x30, "*" },
+  { 0x31, "§" },
+  { 0x33, "ç" },
+  { 0x34, "°" },
+  { 0x35, "|" },
+  { 0x36, ";" },
+  { 0x37, ":" },
+  { 0x38, "_" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_87_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+};
+
+const wa_keyboard_mapping LAYOUT_87_LAYER_3_ENTRIES[] = {
+  { 0x08, "€" },
+  { 0x22, "€" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x33, "@" },
+  { 0x34, "#" },
+};
+
+const wa_keyboard_mapping LAYOUT_87_LAYER_4_ENTRIES[] = {
+  { 0x2F, "{" },
+  { 0x30, "}" },
+};
+
+const wa_keyboard_mapping LAYOUT_87_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_87_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_87_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_87_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_87_LAYER_2_ENTRIES, 26u,
+  },
+  {
+    "altgr",
+    LAYOUT_87_LAYER_3_ENTRIES, 6u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_87_LAYER_4_ENTRIES, 2u,
+  },
+  {
+    "ctrl",
+    LAYOUT_87_LAYER_5_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_88_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x35, "`" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_88_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_88_LAYER_2_ENTRIES[] = {
+  { 0x04, "ᖑ" },
+  { 0x05, "ᑕ" },
+  { 0x06, "ᖃ" },
+  { 0x07, "ᖁ" },
+  { 0x08, "ᕿ" },
+  { 0x09, "ᑯ" },
+  { 0x0A, "ᑐ" },
+  { 0x0B, "ᓱ" },
+  { 0x0C, "ᓂ" },
+  { 0x0D, "ᒧ" },
+  { 0x0E, "ᓄ" },
+  { 0x0F, "ᓗ" },
+  { 0x10, "ᒪ" },
+  { 0x11, "ᓴ" },
+  { 0x12, "ᓕ" },
+  { 0x13, "ᔨ" },
+  { 0x14, "ᖏ" },
+  { 0x15, "ᑭ" },
+  { 0x16, "ᐅ" },
+  { 0x17, "ᑎ" },
+  { 0x18, "ᒥ" },
+  { 0x19, "ᑲ" },
+  { 0x1A, "ᐃ" },
+  { 0x1B, "ᐊ" },
+  { 0x1C, "ᓯ" },
+  { 0x1D, "ᖓ" },
+  { 0x1E, "ᖕ" },
+  { 0x1F, "ᑉ" },
+  { 0x20, "ᕐ" },
+  { 0x21, "ᒃ" },
+  { 0x22, "ᑦ" },
+  { 0x23, "ᖅ" },
+  { 0x24, "ᒻ" },
+  { 0x25, "ᓐ" },
+  { 0x26, "ᓪ" },
+  { 0x27, "ᔾ" },
+  { 0x2D, "-" },
+  { 0x2E, "ᕝ" },
+  { 0x2F, "ᒡ" },
+  { 0x30, "ᐞ" },
+  { 0x31, "/" },
+  { 0x38, "ᔭ" },
+  { 0x64, "/" },
+};
+
+const wa_keyboard_mapping LAYOUT_88_LAYER_3_ENTRIES[] = {
+  { 0x04, "ᖒ" },
+  { 0x05, "ᑖ" },
+  { 0x06, "ᖄ" },
+  { 0x07, "ᖂ" },
+  { 0x08, "ᖀ" },
+  { 0x09, "ᑰ" },
+  { 0x0A, "ᑑ" },
+  { 0x0B, "ᓲ" },
+  { 0x0C, "ᓃ" },
+  { 0x0D, "ᒨ" },
+  { 0x0E, "ᓅ" },
+  { 0x0F, "ᓘ" },
+  { 0x10, "ᒫ" },
+  { 0x11, "ᓵ" },
+  { 0x12, "ᓖ" },
+  { 0x13, "ᔩ" },
+  { 0x14, "ᖐ" },
+  { 0x15, "ᑮ" },
+  { 0x16, "ᐆ" },
+  { 0x17, "ᑏ" },
+  { 0x18, "ᒦ" },
+  { 0x19, "ᑳ" },
+  { 0x1A, "ᐄ" },
+  { 0x1B, "ᐋ" },
+  { 0x1C, "ᓰ" },
+  { 0x1D, "ᖔ" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "*" },
+  { 0x24, "&" },
+  { 0x25, "•" },
+  { 0x26, "[" },
+  { 0x27, "]" },
+  { 0x2E, "=" },
+  { 0x2F, "“" },
+  { 0x30, "‘" },
+  { 0x33, "ŋ" },
+  { 0x34, "ł" },
+  { 0x38, "ᔮ" },
+};
+
+const wa_keyboard_mapping LAYOUT_88_LAYER_4_ENTRIES[] = {
+  { 0x04, "ᒎ" },
+  { 0x05, "}" },
+  { 0x06, "ᕌ" },
+  { 0x07, "ᕉ" },
+  { 0x08, "ᕇ" },
+  { 0x09, "ᕖ" },
+  { 0x0C, "ᖥ" },
+  { 0x0D, "ᔫ" },
+  { 0x0E, "ᕘ" },
+  { 0x0F, "ᖣ" },
+  { 0x10, "ᓛ" },
+  { 0x11, "ᓈ" },
+  { 0x12, "ᖡ" },
+  { 0x14, "ᒌ" },
+  { 0x16, "ᐴ" },
+  { 0x17, "ᙲ" },
+  { 0x18, "ᙶ" },
+  { 0x19, "{" },
+  { 0x1A, "ᐲ" },
+  { 0x1B, "ᐹ" },
+  { 0x1C, "ᙴ" },
+  { 0x1D, "ᒑ" },
+  { 0x1E, "¢" },
+  { 0x1F, "®" },
+  { 0x20, "¼" },
+  { 0x21, "½" },
+  { 0x22, "¾" },
+  { 0x23, "^" },
+  { 0x24, "⅔" },
+  { 0x25, "©" },
+  { 0x26, "÷" },
+  { 0x27, "+" },
+  { 0x2F, "”" },
+  { 0x30, "’" },
+  { 0x31, "|" },
+  { 0x33, "Ŋ" },
+  { 0x34, "Ł" },
+  { 0x35, "~" },
+  { 0x38, "ᕚ" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_88_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_88_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_88_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_88_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_88_LAYER_2_ENTRIES, 43u,
+  },
+  {
+    "altgr",
+    LAYOUT_88_LAYER_3_ENTRIES, 42u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_88_LAYER_4_ENTRIES, 40u,
+  },
+  {
+    "ctrl",
+    LAYOUT_88_LAYER_5_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_89_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x35, "`" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_89_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "{" },
+  { 0x30, "[" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_89_LAYER_2_ENTRIES[] = {
+  { 0x04, "ᖑ" },
+  { 0x05, "ᑕ" },
+  { 0x06, "ᖃ" },
+  { 0x07, "ᖁ" },
+  { 0x08, "ᕿ" },
+  { 0x09, "ᑯ" },
+  { 0x0A, "ᑐ" },
+  { 0x0B, "ᓱ" },
+  { 0x0C, "ᓂ" },
+  { 0x0D, "ᒧ" },
+  { 0x0E, "ᓄ" },
+  { 0x0F, "ᓗ" },
+  { 0x10, "ᒪ" },
+  { 0x11, "ᓴ" },
+  { 0x12, "ᓕ" },
+  { 0x13, "ᔨ" },
+  { 0x14, "ᖏ" },
+  { 0x15, "ᑭ" },
+  { 0x16, "ᐅ" },
+  { 0x17, "ᑎ" },
+  { 0x18, "ᒥ" },
+  { 0x19, "ᑲ" },
+  { 0x1A, "ᐃ" },
+  { 0x1B, "ᐊ" },
+  { 0x1C, "ᓯ" },
+  { 0x1D, "ᖓ" },
+  { 0x1E, "ᖕ" },
+  { 0x1F, "ᑉ" },
+  { 0x20, "ᕐ" },
+  { 0x21, "ᒃ" },
+  { 0x22, "ᑦ" },
+  { 0x23, "ᖅ" },
+  { 0x24, "ᒻ" },
+  { 0x25, "ᓐ" },
+  { 0x26, "ᓪ" },
+  { 0x27, "ᔾ" },
+  { 0x2D, "−" },
+  { 0x2E, "ᕝ" },
+  { 0x2F, "ᒡ" },
+  { 0x31, "/" },
+  { 0x38, "ᔭ" },
+  { 0x64, "/" },
+};
+
+const wa_keyboard_mapping LAYOUT_89_LAYER_3_ENTRIES[] = {
+  { 0x04, "ᖒ" },
+  { 0x05, "ᑖ" },
+  { 0x06, "ᖄ" },
+  { 0x07, "ᖂ" },
+  { 0x08, "ᖀ" },
+  { 0x09, "ᑰ" },
+  { 0x0A, "ᑑ" },
+  { 0x0B, "ᓲ" },
+  { 0x0C, "ᓃ" },
+  { 0x0D, "ᒨ" },
+  { 0x0E, "ᓅ" },
+  { 0x0F, "ᓘ" },
+  { 0x10, "ᒫ" },
+  { 0x11, "ᓵ" },
+  { 0x12, "ᓖ" },
+  { 0x13, "ᔩ" },
+  { 0x14, "ᖐ" },
+  { 0x15, "ᑮ" },
+  { 0x16, "ᐆ" },
+  { 0x17, "ᑏ" },
+  { 0x18, "ᒦ" },
+  { 0x19, "ᑳ" },
+  { 0x1A, "ᐄ" },
+  { 0x1B, "ᐋ" },
+  { 0x1C, "ᓰ" },
+  { 0x1D, "ᖔ" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "*" },
+  { 0x24, "&" },
+  { 0x25, "•" },
+  { 0x26, "[" },
+  { 0x27, "]" },
+  { 0x2E, "=" },
+  { 0x2F, "“" },
+  { 0x30, "‘" },
+  { 0x33, "ŋ" },
+  { 0x34, "ł" },
+  { 0x38, "ᔮ" },
+};
+
+const wa_keyboard_mapping LAYOUT_89_LAYER_4_ENTRIES[] = {
+  { 0x04, "ᒎ" },
+  { 0x05, "}" },
+  { 0x06, "ᕌ" },
+  { 0x07, "ᕉ" },
+  { 0x08, "ᕇ" },
+  { 0x09, "ᕖ" },
+  { 0x0C, "ᖥ" },
+  { 0x0D, "ᔫ" },
+  { 0x0E, "ᕘ" },
+  { 0x0F, "ᖣ" },
+  { 0x10, "ᓛ" },
+  { 0x11, "ᓈ" },
+  { 0x12, "ᖡ" },
+  { 0x14, "ᒌ" },
+  { 0x16, "ᐴ" },
+  { 0x17, "ᙲ" },
+  { 0x18, "ᙶ" },
+  { 0x19, "{" },
+  { 0x1A, "ᐲ" },
+  { 0x1B, "ᐹ" },
+  { 0x1C, "ᙴ" },
+  { 0x1D, "ᒑ" },
+  { 0x1E, "¢" },
+  { 0x1F, "®" },
+  { 0x20, "¼" },
+  { 0x21, "½" },
+  { 0x22, "¾" },
+  { 0x23, "^" },
+  { 0x24, "⅔" },
+  { 0x25, "©" },
+  { 0x26, "÷" },
+  { 0x27, "+" },
+  { 0x2F, "”" },
+  { 0x30, "’" },
+  { 0x31, "|" },
+  { 0x34, "Ł" },
+  { 0x35, "~" },
+  { 0x38, "ᕚ" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_89_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_89_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_89_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_89_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_89_LAYER_2_ENTRIES, 42u,
+  },
+  {
+    "altgr",
+    LAYOUT_89_LAYER_3_ENTRIES, 42u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_89_LAYER_4_ENTRIES, 39u,
+  },
+  {
+    "ctrl",
+    LAYOUT_89_LAYER_5_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_90_LAYER_0_ENTRIES[] = {
+  { 0x04, "ᖑ" },
+  { 0x05, "ᑕ" },
+  { 0x06, "ᖃ" },
+  { 0x07, "ᖁ" },
+  { 0x08, "ᕿ" },
+  { 0x09, "ᑯ" },
+  { 0x0A, "ᑐ" },
+  { 0x0B, "ᓱ" },
+  { 0x0C, "ᓂ" },
+  { 0x0D, "ᒧ" },
+  { 0x0E, "ᓄ" },
+  { 0x0F, "ᓗ" },
+  { 0x10, "ᒪ" },
+  { 0x11, "ᓴ" },
+  { 0x12, "ᓕ" },
+  { 0x13, "ᔨ" },
+  { 0x14, "ᖏ" },
+  { 0x15, "ᑭ" },
+  { 0x16, "ᐅ" },
+  { 0x17, "ᑎ" },
+  { 0x18, "ᒥ" },
+  { 0x19, "ᑲ" },
+  { 0x1A, "ᐃ" },
+  { 0x1B, "ᐊ" },
+  { 0x1C, "ᓯ" },
+  { 0x1D, "ᖓ" },
+  { 0x1E, "ᖕ" },
+  { 0x1F, "ᑉ" },
+  { 0x20, "ᕐ" },
+  { 0x21, "ᒃ" },
+  { 0x22, "ᑦ" },
+  { 0x23, "ᖅ" },
+  { 0x24, "ᒻ" },
+  { 0x25, "ᓐ" },
+  { 0x26, "ᓪ" },
+  { 0x27, "ᔾ" },
+  { 0x2C, " " },
+  { 0x2D, "−" },
+  { 0x2E, "ᕝ" },
+  { 0x2F, "ᒡ" },
+  { 0x30, "]" },
+  { 0x31, "/" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x35, "`" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "ᔭ" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "/" },
+};
+
+const wa_keyboard_mapping LAYOUT_90_LAYER_1_ENTRIES[] = {
+  { 0x04, "ᒍ" },
+  { 0x05, "ᕼ" },
+  { 0x06, "ᕋ" },
+  { 0x07, "ᕈ" },
+  { 0x08, "ᕆ" },
+  { 0x09, "ᕕ" },
+  { 0x0A, "(" },
+  { 0x0B, ")" },
+  { 0x0C, "ᖤ" },
+  { 0x0D, "ᔪ" },
+  { 0x0E, "ᕗ" },
+  { 0x0F, "ᖢ" },
+  { 0x10, "ᓚ" },
+  { 0x11, "ᓇ" },
+  { 0x12, "ᖠ" },
+  { 0x13, "ᖦ" },
+  { 0x14, "ᒋ" },
+  { 0x15, "ᖕ" },
+  { 0x16, "ᐳ" },
+  { 0x17, "ᙱ" },
+  { 0x18, "ᙵ" },
+  { 0x19, "?" },
+  { 0x1A, "ᐱ" },
+  { 0x1B, "ᐸ" },
+  { 0x1C, "ᙳ" },
+  { 0x1D, "ᒐ" },
+  { 0x1E, "𑪰" },
+  { 0x1F, "𑪲" },
+  { 0x20, "𑪴" },
+  { 0x21, "ᕠ" },
+  { 0x22, "ᕤ" },
+  { 0x23, "ᕦ" },
+  { 0x24, "𑪶" },
+  { 0x25, "𑪸" },
+  { 0x26, "𑪺" },
+  { 0x27, "ᖨ" },
+  { 0x2C, " " },
+  { 0x2D, "ᖪ" },
+  { 0x2E, "ᖬ" },
+  { 0x2F, "ᔅ" },
+  { 0x30, "[" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "ᕙ" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_90_LAYER_2_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x35, "`" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_90_LAYER_3_ENTRIES[] = {
+  { 0x04, "ᐆ" },
+  { 0x05, "ᑖ" },
+  { 0x06, "ᖄ" },
+  { 0x07, "ᑰ" },
+  { 0x08, "ᖀ" },
+  { 0x09, "ᑑ" },
+  { 0x0A, "ᓲ" },
+  { 0x0B, "ᒨ" },
+  { 0x0C, "ᓃ" },
+  { 0x0D, "ᓅ" },
+  { 0x0E, "ᓘ" },
+  { 0x0F, "ŋ" },
+  { 0x10, "ᒫ" },
+  { 0x11, "ᓵ" },
+  { 0x12, "ᓖ" },
+  { 0x13, "ᔩ" },
+  { 0x14, "ᖐ" },
+  { 0x15, "ᑮ" },
+  { 0x16, "ᖂ" },
+  { 0x17, "ᑏ" },
+  { 0x18, "ᒦ" },
+  { 0x19, "ᑳ" },
+  { 0x1A, "ᐄ" },
+  { 0x1B, "ᐋ" },
+  { 0x1C, "ᓰ" },
+  { 0x1D, "ᖔ" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "*" },
+  { 0x24, "&" },
+  { 0x25, "•" },
+  { 0x26, "[" },
+  { 0x27, "]" },
+  { 0x2E, "=" },
+  { 0x2F, "“" },
+  { 0x30, "‘" },
+  { 0x31, "ᖒ" },
+  { 0x33, "ł" },
+  { 0x36, "š" },
+  { 0x37, "ř" },
+  { 0x38, "ᔮ" },
+  { 0x64, "ᖒ" },
+};
+
+const wa_keyboard_mapping LAYOUT_90_LAYER_4_ENTRIES[] = {
+  { 0x04, "ᒎ" },
+  { 0x05, "}" },
+  { 0x06, "ᕌ" },
+  { 0x07, "ᕉ" },
+  { 0x08, "ᕇ" },
+  { 0x09, "ᕖ" },
+  { 0x0C, "ᖥ" },
+  { 0x0D, "ᔫ" },
+  { 0x0E, "ᕘ" },
+  { 0x0F, "ᖣ" },
+  { 0x10, "ᓛ" },
+  { 0x11, "ᓈ" },
+  { 0x12, "ᖡ" },
+  { 0x13, "ᖮ" },
+  { 0x14, "ᒌ" },
+  { 0x16, "ᐴ" },
+  { 0x17, "ᙲ" },
+  { 0x18, "ᙶ" },
+  { 0x19, "{" },
+  { 0x1A, "ᐲ" },
+  { 0x1B, "ᐹ" },
+  { 0x1C, "ᙴ" },
+  { 0x1D, "ᒑ" },
+  { 0x1E, "𑪱" },
+  { 0x1F, "𑪲" },
+  { 0x20, "𑪵" },
+  { 0x21, "ᕢ" },
+  { 0x22, "ᕥ" },
+  { 0x23, "ᕧ" },
+  { 0x24, "𑪷" },
+  { 0x25, "𑪹" },
+  { 0x26, "𑪻" },
+  { 0x27, "ᖩ" },
+  { 0x2D, "ᖫ" },
+  { 0x2E, "ᖭ" },
+  { 0x2F, "”" },
+  { 0x30, "’" },
+  { 0x31, "|" },
+  { 0x33, "Ŋ" },
+  { 0x34, "Ł" },
+  { 0x35, "~" },
+  { 0x36, "Š" },
+  { 0x37, "Ř" },
+  { 0x38, "ᕚ" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_90_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+};
+
+const wa_keyboard_layer LAYOUT_90_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_90_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_90_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_90_LAYER_2_ENTRIES, 48u,
+  },
+  {
+    "altgr",
+    LAYOUT_90_LAYER_3_ENTRIES, 45u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_90_LAYER_4_ENTRIES, 45u,
+  },
+  {
+    "ctrl",
+    LAYOUT_90_LAYER_5_ENTRIES, 1u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_91_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x35, "`" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_91_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_91_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+};
+
+const wa_keyboard_mapping LAYOUT_91_LAYER_3_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_91_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_91_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_91_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_91_LAYER_2_ENTRIES, 26u,
+  },
+  {
+    "ctrl",
+    LAYOUT_91_LAYER_3_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_92_LAYER_0_ENTRIES[] = {
+  { 0x04, "ꦄ" },
+  { 0x05, "ꦧ" },
+  { 0x06, "ꦕ" },
+  { 0x07, "ꦢ" },
+  { 0x08, "ꦌ" },
+  { 0x09, "ꦉ" },
+  { 0x0A, "ꦒ" },
+  { 0x0B, "ꦲ" },
+  { 0x0C, "ꦆ" },
+  { 0x0D, "ꦗ" },
+  { 0x0E, "ꦏ" },
+  { 0x0F, "ꦭ" },
+  { 0x10, "ꦩ" },
+  { 0x11, "ꦤ" },
+  { 0x12, "ꦎ" },
+  { 0x13, "ꦥ" },
+  { 0x14, "ꦄꦼ" },
+  { 0x15, "ꦫ" },
+  { 0x16, "ꦱ" },
+  { 0x17, "ꦠ" },
+  { 0x18, "ꦈ" },
+  { 0x19, "ꦊ" },
+  { 0x1A, "ꦮ" },
+  { 0x1B, "ꦔ" },
+  { 0x1C, "ꦪ" },
+  { 0x1D, "ꦚ" },
+  { 0x1E, "꧑" },
+  { 0x1F, "꧒" },
+  { 0x20, "꧓" },
+  { 0x21, "꧔" },
+  { 0x22, "꧕" },
+  { 0x23, "꧖" },
+  { 0x24, "꧗" },
+  { 0x25, "꧘" },
+  { 0x26, "꧙" },
+  { 0x27, "꧐" },
+  { 0x2C, " " },
+  { 0x2D, "​" },
+  { 0x2E, "‌" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x33, "ꦛ" },
+  { 0x34, "ꦝ" },
+  { 0x35, "꧋" },
+  { 0x36, "꧈" },
+  { 0x37, "꧉" },
+  { 0x38, "꧀" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_92_LAYER_1_ENTRIES[] = {
+  { 0x04, "ꦴ" },
+  { 0x05, "ꦨ" },
+  { 0x06, "ꦖ" },
+  { 0x07, "ꦣ" },
+  { 0x08, "ꦺ" },
+  { 0x09, "ꦽ" },
+  { 0x0A, "ꦓ" },
+  { 0x0B, "ꦃ" },
+  { 0x0C, "ꦶ" },
+  { 0x0D, "ꦘ" },
+  { 0x0E, "ꦑ" },
+  { 0x0F, "꧀ꦭ" },
+  { 0x10, "꦳" },
+  { 0x11, "ꦟ" },
+  { 0x12, "ꦺꦴ" },
+  { 0x13, "ꦦ" },
+  { 0x14, "ꦼ" },
+  { 0x15, "ꦿ" },
+  { 0x16, "ꦯ" },
+  { 0x17, "ꦡ" },
+  { 0x18, "ꦸ" },
+  { 0x1A, "꧀ꦮ" },
+  { 0x1B, "ꦁ" },
+  { 0x1C, "ꦾ" },
+  { 0x1D, "ꦂ" },
+  { 0x1F, "ꧏ" },
+  { 0x20, "꧆" },
+  { 0x21, "꧞" },
+  { 0x22, "꧟" },
+  { 0x23, "꧃" },
+  { 0x24, "꧄" },
+  { 0x25, "꧅" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2F, "꧁" },
+  { 0x30, "꧂" },
+  { 0x31, "|" },
+  { 0x33, "ꦜ" },
+  { 0x34, "ꦞ" },
+  { 0x35, "꧊" },
+  { 0x36, "꧇" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_92_LAYER_2_ENTRIES[] = {
+  { 0x04, "ꦄꦴ" },
+  { 0x08, "ꦍ" },
+  { 0x0C, "ꦇ" },
+  { 0x0D, "ꦙ" },
+  { 0x0E, "ꦐ" },
+  { 0x14, "ꦅ" },
+  { 0x15, "ꦬ" },
+  { 0x16, "ꦰ" },
+  { 0x19, "ꦋ" },
+  { 0x1B, "ꦀ" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "꧌" },
+  { 0x30, "꧍" },
+  { 0x35, "`" },
+  { 0x38, "/" },
+};
+
+const wa_keyboard_mapping LAYOUT_92_LAYER_3_ENTRIES[] = {
+  { 0x08, "ꦻ" },
+  { 0x0C, "ꦷ" },
+  { 0x12, "ꦵ" },
+  { 0x18, "ꦹ" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x35, "~" },
+};
+
+const wa_keyboard_mapping LAYOUT_92_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_92_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_92_LAYER_0_ENTRIES, 52u,
+  },
+  {
+    "shift",
+    LAYOUT_92_LAYER_1_ENTRIES, 47u,
+  },
+  {
+    "altgr",
+    LAYOUT_92_LAYER_2_ENTRIES, 26u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_92_LAYER_3_ENTRIES, 15u,
+  },
+  {
+    "ctrl",
+    LAYOUT_92_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_93_LAYER_0_ENTRIES[] = {
+  { 0x04, "ხ" },
+  { 0x05, "ჟ" },
+  { 0x06, "ყ" },
+  { 0x07, "ა" },
+  { 0x08, "უ" },
+  { 0x09, "ე" },
+  { 0x0A, "ო" },
+  { 0x0B, "დ" },
+  { 0x0C, "ნ" },
+  { 0x0D, "მ" },
+  { 0x0E, "ს" },
+  { 0x0F, "რ" },
+  { 0x10, "ც" },
+  { 0x11, "ზ" },
+  { 0x12, "ვ" },
+  { 0x13, "შ" },
+  { 0x14, "ჩ" },
+  { 0x15, "ძ" },
+  { 0x16, "ი" },
+  { 0x17, "ჭ" },
+  { 0x18, "თ" },
+  { 0x19, "ღ" },
+  { 0x1A, "პ" },
+  { 0x1B, "ჰ" },
+  { 0x1C, "ტ" },
+  { 0x1D, "ჯ" },
+  { 0x1E, "!" },
+  { 0x1F, "№" },
+  { 0x20, "," },
+  { 0x21, ";" },
+  { 0x22, "%" },
+  { 0x23, ":" },
+  { 0x24, "?" },
+  { 0x25, "." },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "“" },
+  { 0x2F, "კ" },
+  { 0x30, "ქ" },
+  { 0x31, "/" },
+  { 0x33, "ბ" },
+  { 0x34, "გ" },
+  { 0x35, "„" },
+  { 0x36, "ლ" },
+  { 0x37, "ფ" },
+  { 0x38, "წ" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_93_LAYER_1_ENTRIES[] = {
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "+" },
+  { 0x2E, "=" },
+  { 0x31, "§" },
+  { 0x35, "'" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "/" },
+};
+
+const wa_keyboard_mapping LAYOUT_93_LAYER_2_ENTRIES[] = {
+  { 0x04, "ჴ" },
+  { 0x06, "ჸ" },
+  { 0x07, "ჺ" },
+  { 0x09, "ჱ" },
+  { 0x0C, "ჼ" },
+  { 0x12, "ჳ" },
+  { 0x16, "ჲ" },
+  { 0x19, "ჷ" },
+  { 0x1B, "ჵ" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "€" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2D, "—" },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x34, "ჹ" },
+  { 0x35, "`" },
+  { 0x37, "ჶ" },
+  { 0x38, "჻" },
+};
+
+const wa_keyboard_mapping LAYOUT_93_LAYER_3_ENTRIES[] = {
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x0C, "I" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x19, "V" },
+  { 0x1B, "X" },
+  { 0x20, "§" },
+  { 0x25, "°" },
+  { 0x26, "«" },
+  { 0x27, "»" },
+  { 0x2D, "_" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "|" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_93_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_93_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_93_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_93_LAYER_1_ENTRIES, 20u,
+  },
+  {
+    "altgr",
+    LAYOUT_93_LAYER_2_ENTRIES, 28u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_93_LAYER_3_ENTRIES, 19u,
+  },
+  {
+    "ctrl",
+    LAYOUT_93_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_94_LAYER_0_ENTRIES[] = {
+  { 0x04, "ფ" },
+  { 0x05, "მ" },
+  { 0x06, "ყ" },
+  { 0x07, "ვ" },
+  { 0x08, "უ" },
+  { 0x09, "თ" },
+  { 0x0A, "ა" },
+  { 0x0B, "პ" },
+  { 0x0C, "შ" },
+  { 0x0D, "რ" },
+  { 0x0E, "ო" },
+  { 0x0F, "ლ" },
+  { 0x10, "ტ" },
+  { 0x11, "ი" },
+  { 0x12, "წ" },
+  { 0x13, "ზ" },
+  { 0x14, "ღ" },
+  { 0x15, "კ" },
+  { 0x16, "ძ" },
+  { 0x17, "ე" },
+  { 0x18, "გ" },
+  { 0x19, "ს" },
+  { 0x1A, "ჯ" },
+  { 0x1B, "ჩ" },
+  { 0x1C, "ნ" },
+  { 0x1D, "ჭ" },
+  { 0x1E, "!" },
+  { 0x1F, "?" },
+  { 0x20, "№" },
+  { 0x21, "§" },
+  { 0x22, "%" },
+  { 0x23, ":" },
+  { 0x24, "." },
+  { 0x25, ";" },
+  { 0x26, "," },
+  { 0x27, "/" },
+  { 0x2C, " " },
+  { 0x2D, "–" },
+  { 0x2E, "=" },
+  { 0x2F, "ხ" },
+  { 0x30, "ც" },
+  { 0x31, "(" },
+  { 0x33, "დ" },
+  { 0x34, "ჟ" },
+  { 0x35, "„" },
+  { 0x36, "ქ" },
+  { 0x37, "ბ" },
+  { 0x38, "ჰ" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "(" },
+};
+
+const wa_keyboard_mapping LAYOUT_94_LAYER_1_ENTRIES[] = {
+  { 0x04, "ფ" },
+  { 0x05, "მ" },
+  { 0x06, "ყ" },
+  { 0x07, "ვ" },
+  { 0x08, "უ" },
+  { 0x09, "თ" },
+  { 0x0A, "ა" },
+  { 0x0B, "პ" },
+  { 0x0C, "შ" },
+  { 0x0D, "რ" },
+  { 0x0E, "ო" },
+  { 0x0F, "ლ" },
+  { 0x10, "ტ" },
+  { 0x11, "ი" },
+  { 0x12, "წ" },
+  { 0x13, "ზ" },
+  { 0x14, "ღ" },
+  { 0x15, "კ" },
+  { 0x16, "ძ" },
+  { 0x17, "ე" },
+  { 0x18, "გ" },
+  { 0x19, "ს" },
+  { 0x1A, "ჯ" },
+  { 0x1B, "ჩ" },
+  { 0x1C, "ნ" },
+  { 0x1D, "ჭ" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "+" },
+  { 0x2F, "ხ" },
+  { 0x30, "ც" },
+  { 0x31, ")" },
+  { 0x33, "დ" },
+  { 0x34, "ჟ" },
+  { 0x35, "“" },
+  { 0x36, "ქ" },
+  { 0x37, "ბ" },
+  { 0x38, "ჰ" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, ")" },
+};
+
+const wa_keyboard_mapping LAYOUT_94_LAYER_2_ENTRIES[] = {
+  { 0x04, "ჶ" },
+  { 0x07, "ჳ" },
+  { 0x11, "ჲ" },
+  { 0x17, "ჱ" },
+  { 0x2F, "ჴ" },
+  { 0x38, "ჵ" },
+};
+
+const wa_keyboard_mapping LAYOUT_94_LAYER_3_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_94_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_94_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_94_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "altgr",
+    LAYOUT_94_LAYER_2_ENTRIES, 6u,
+  },
+  {
+    "ctrl",
+    LAYOUT_94_LAYER_3_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_95_LAYER_0_ENTRIES[] = {
+  { 0x04, "ა" },
+  { 0x05, "ბ" },
+  { 0x06, "ც" },
+  { 0x07, "დ" },
+  { 0x08, "ე" },
+  { 0x09, "ფ" },
+  { 0x0A, "გ" },
+  { 0x0B, "ჰ" },
+  { 0x0C, "ი" },
+  { 0x0D, "ჯ" },
+  { 0x0E, "კ" },
+  { 0x0F, "ლ" },
+  { 0x10, "მ" },
+  { 0x11, "ნ" },
+  { 0x12, "ო" },
+  { 0x13, "პ" },
+  { 0x14, "ქ" },
+  { 0x15, "რ" },
+  { 0x16, "ს" },
+  { 0x17, "ტ" },
+  { 0x18, "უ" },
+  { 0x19, "ვ" },
+  { 0x1A, "წ" },
+  { 0x1B, "ხ" },
+  { 0x1C, "ყ" },
+  { 0x1D, "ზ" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "ჟ" },
+  { 0x2F, "შ" },
+  { 0x30, "ღ" },
+  { 0x31, "=" },
+  { 0x33, "თ" },
+  { 0x34, "ჩ" },
+  { 0x35, "ჭ" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "ძ" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "/" },
+};
+
+const wa_keyboard_mapping LAYOUT_95_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "№" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "/" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "\\" },
+  { 0x36, ";" },
+  { 0x37, ":" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "?" },
+};
+
+const wa_keyboard_mapping LAYOUT_95_LAYER_2_ENTRIES[] = {
+  { 0x04, "ჺ" },
+  { 0x09, "ჶ" },
+  { 0x0A, "ჹ" },
+  { 0x0B, "ჱ" },
+  { 0x0C, "ჲ" },
+  { 0x0D, "ჷ" },
+  { 0x11, "ჼ" },
+  { 0x19, "ჳ" },
+  { 0x1B, "ჴ" },
+  { 0x1D, "ჵ" },
+  { 0x1E, "'" },
+  { 0x1F, "~" },
+  { 0x20, "#" },
+  { 0x21, "€" },
+  { 0x24, "§" },
+  { 0x25, "°" },
+  { 0x27, "—" },
+  { 0x2D, "–" },
+  { 0x2E, "|" },
+  { 0x2F, "«" },
+  { 0x30, "»" },
+  { 0x35, "`" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "჻" },
+};
+
+const wa_keyboard_mapping LAYOUT_95_LAYER_3_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_95_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_95_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_95_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "altgr",
+    LAYOUT_95_LAYER_2_ENTRIES, 25u,
+  },
+  {
+    "ctrl",
+    LAYOUT_95_LAYER_3_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_96_LAYER_0_ENTRIES[] = {
+  { 0x04, "ⴞ" },
+  { 0x05, "ⴏ" },
+  { 0x06, "ⴗ" },
+  { 0x07, "ⴀ" },
+  { 0x08, "ⴓ" },
+  { 0x09, "ⴄ" },
+  { 0x0A, "ⴍ" },
+  { 0x0B, "ⴃ" },
+  { 0x0C, "ⴌ" },
+  { 0x0D, "ⴋ" },
+  { 0x0E, "ⴑ" },
+  { 0x0F, "ⴐ" },
+  { 0x10, "ⴚ" },
+  { 0x11, "ⴆ" },
+  { 0x12, "ⴅ" },
+  { 0x13, "ⴘ" },
+  { 0x14, "ⴙ" },
+  { 0x15, "ⴛ" },
+  { 0x16, "ⴈ" },
+  { 0x17, "ⴝ" },
+  { 0x18, "ⴇ" },
+  { 0x19, "ⴖ" },
+  { 0x1A, "ⴎ" },
+  { 0x1B, "ⴠ" },
+  { 0x1C, "ⴒ" },
+  { 0x1D, "ⴟ" },
+  { 0x1E, "!" },
+  { 0x1F, "჻" },
+  { 0x20, "," },
+  { 0x21, ";" },
+  { 0x22, "%" },
+  { 0x23, ":" },
+  { 0x24, "?" },
+  { 0x25, "." },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "“" },
+  { 0x2F, "ⴉ" },
+  { 0x30, "ⴕ" },
+  { 0x31, "/" },
+  { 0x33, "ⴁ" },
+  { 0x34, "ⴂ" },
+  { 0x35, "„" },
+  { 0x36, "ⴊ" },
+  { 0x37, "ⴔ" },
+  { 0x38, "ⴜ" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_96_LAYER_1_ENTRIES[] = {
+  { 0x04, "Ⴞ" },
+  { 0x05, "Ⴏ" },
+  { 0x06, "Ⴗ" },
+  { 0x07, "Ⴀ" },
+  { 0x08, "Ⴓ" },
+  { 0x09, "Ⴄ" },
+  { 0x0A, "Ⴍ" },
+  { 0x0B, "Ⴃ" },
+  { 0x0C, "Ⴌ" },
+  { 0x0D, "Ⴋ" },
+  { 0x0E, "Ⴑ" },
+  { 0x0F, "Ⴐ" },
+  { 0x10, "Ⴚ" },
+  { 0x11, "Ⴆ" },
+  { 0x12, "Ⴅ" },
+  { 0x13, "Ⴘ" },
+  { 0x14, "Ⴙ" },
+  { 0x15, "Ⴛ" },
+  { 0x16, "Ⴈ" },
+  { 0x17, "Ⴝ" },
+  { 0x18, "Ⴇ" },
+  { 0x19, "Ⴖ" },
+  { 0x1A, "Ⴎ" },
+  { 0x1B, "Ⴠ" },
+  { 0x1C, "Ⴒ" },
+  { 0x1D, "Ⴑ" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "+" },
+  { 0x2E, "=" },
+  { 0x2F, "Ⴉ" },
+  { 0x30, "Ⴕ" },
+  { 0x31, "§" },
+  { 0x33, "Ⴁ" },
+  { 0x34, "Ⴂ" },
+  { 0x35, "'" },
+  { 0x36, "Ⴊ" },
+  { 0x37, "Ⴔ" },
+  { 0x38, "Ⴜ" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "/" },
+};
+
+const wa_keyboard_mapping LAYOUT_96_LAYER_2_ENTRIES[] = {
+  { 0x04, "Ⴞ" },
+  { 0x05, "Ⴏ" },
+  { 0x06, "Ⴗ" },
+  { 0x07, "Ⴀ" },
+  { 0x08, "Ⴓ" },
+  { 0x09, "Ⴄ" },
+  { 0x0A, "Ⴍ" },
+  { 0x0B, "Ⴃ" },
+  { 0x0C, "Ⴌ" },
+  { 0x0D, "Ⴋ" },
+  { 0x0E, "Ⴑ" },
+  { 0x0F, "Ⴐ" },
+  { 0x10, "Ⴚ" },
+  { 0x11, "Ⴆ" },
+  { 0x12, "Ⴅ" },
+  { 0x13, "Ⴘ" },
+  { 0x14, "Ⴙ" },
+  { 0x15, "Ⴛ" },
+  { 0x16, "Ⴈ" },
+  { 0x17, "Ⴝ" },
+  { 0x18, "Ⴇ" },
+  { 0x19, "Ⴖ" },
+  { 0x1A, "Ⴎ" },
+  { 0x1B, "Ⴠ" },
+  { 0x1C, "Ⴒ" },
+  { 0x1D, "Ⴑ" },
+  { 0x2F, "Ⴉ" },
+  { 0x30, "Ⴕ" },
+  { 0x33, "Ⴁ" },
+  { 0x34, "Ⴂ" },
+  { 0x36, "Ⴊ" },
+  { 0x37, "Ⴔ" },
+  { 0x38, "Ⴜ" },
+};
+
+const wa_keyboard_mapping LAYOUT_96_LAYER_3_ENTRIES[] = {
+  { 0x04, "ⴤ" },
+  { 0x06, "ჸ" },
+  { 0x07, "ჺ" },
+  { 0x09, "ⴡ" },
+  { 0x0C, "ჼ" },
+  { 0x12, "ჳ" },
+  { 0x16, "ⴢ" },
+  { 0x1A, "№" },
+  { 0x1B, "ⴥ" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "€" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "—" },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x34, "ჹ" },
+  { 0x35, "`" },
+  { 0x37, "ჶ" },
+  { 0x38, "჻" },
+};
+
+const wa_keyboard_mapping LAYOUT_96_LAYER_4_ENTRIES[] = {
+  { 0x04, "Ⴤ" },
+  { 0x09, "Ⴡ" },
+  { 0x20, "§" },
+  { 0x25, "°" },
+  { 0x26, "«" },
+  { 0x27, "»" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "|" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x37, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_96_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_96_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_96_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_96_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_96_LAYER_2_ENTRIES, 33u,
+  },
+  {
+    "altgr",
+    LAYOUT_96_LAYER_3_ENTRIES, 29u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_96_LAYER_4_ENTRIES, 14u,
+  },
+  {
+    "ctrl",
+    LAYOUT_96_LAYER_5_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_97_LAYER_0_ENTRIES[] = {
+  { 0x04, "ა" },
+  { 0x05, "ბ" },
+  { 0x06, "ც" },
+  { 0x07, "დ" },
+  { 0x08, "ე" },
+  { 0x09, "ფ" },
+  { 0x0A, "გ" },
+  { 0x0B, "ჰ" },
+  { 0x0C, "ი" },
+  { 0x0D, "ჯ" },
+  { 0x0E, "კ" },
+  { 0x0F, "ლ" },
+  { 0x10, "მ" },
+  { 0x11, "ნ" },
+  { 0x12, "ო" },
+  { 0x13, "პ" },
+  { 0x14, "ქ" },
+  { 0x15, "რ" },
+  { 0x16, "ს" },
+  { 0x17, "ტ" },
+  { 0x18, "უ" },
+  { 0x19, "ვ" },
+  { 0x1A, "წ" },
+  { 0x1B, "ხ" },
+  { 0x1C, "ყ" },
+  { 0x1D, "ზ" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "~" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x35, "„" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_97_LAYER_1_ENTRIES[] = {
+  { 0x06, "ჩ" },
+  { 0x0D, "ჟ" },
+  { 0x0F, "₾" },
+  { 0x11, "N" },
+  { 0x15, "ღ" },
+  { 0x16, "შ" },
+  { 0x17, "თ" },
+  { 0x1A, "ჭ" },
+  { 0x1D, "ძ" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "“" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_97_LAYER_2_ENTRIES[] = {
+  { 0x04, "ჺ" },
+  { 0x06, "©" },
+  { 0x08, "ჱ" },
+  { 0x09, "ჶ" },
+  { 0x0A, "ჹ" },
+  { 0x0B, "ჵ" },
+  { 0x0C, "ჲ" },
+  { 0x0D, "ჷ" },
+  { 0x11, "ჼ" },
+  { 0x15, "®" },
+  { 0x19, "ჳ" },
+  { 0x1B, "ჴ" },
+  { 0x1C, "ჸ" },
+  { 0x1F, "„" },
+  { 0x20, "“" },
+  { 0x22, "€" },
+  { 0x25, "°" },
+  { 0x2D, "—" },
+  { 0x2E, "–" },
+  { 0x36, "«" },
+  { 0x37, "»" },
+  { 0x38, "჻" },
+};
+
+const wa_keyboard_mapping LAYOUT_97_LAYER_3_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_97_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_97_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_97_LAYER_1_ENTRIES, 35u,
+  },
+  {
+    "altgr",
+    LAYOUT_97_LAYER_2_ENTRIES, 22u,
+  },
+  {
+    "ctrl",
+    LAYOUT_97_LAYER_3_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_98_LAYER_0_ENTRIES[] = {
+  { 0x04, "ф" },
+  { 0x05, "и" },
+  { 0x06, "с" },
+  { 0x07, "в" },
+  { 0x08, "у" },
+  { 0x09, "а" },
+  { 0x0A, "п" },
+  { 0x0B, "р" },
+  { 0x0C, "ш" },
+  { 0x0D, "о" },
+  { 0x0E, "л" },
+  { 0x0F, "д" },
+  { 0x10, "ь" },
+  { 0x11, "т" },
+  { 0x12, "щ" },
+  { 0x13, "з" },
+  { 0x14, "й" },
+  { 0x15, "к" },
+  { 0x16, "ы" },
+  { 0x17, "е" },
+  { 0x18, "г" },
+  { 0x19, "м" },
+  { 0x1A, "ц" },
+  { 0x1B, "ч" },
+  { 0x1C, "н" },
+  { 0x1D, "я" },
+  { 0x1E, "\"" },
+  { 0x1F, "ә" },
+  { 0x20, "і" },
+  { 0x21, "ң" },
+  { 0x22, "ғ" },
+  { 0x23, "," },
+  { 0x24, "." },
+  { 0x25, "ү" },
+  { 0x26, "ұ" },
+  { 0x27, "қ" },
+  { 0x2C, " " },
+  { 0x2D, "ө" },
+  { 0x2E, "һ" },
+  { 0x2F, "х" },
+  { 0x30, "ъ" },
+  { 0x31, "\\" },
+  { 0x33, "ж" },
+  { 0x34, "э" },
+  { 0x35, "(" },
+  { 0x36, "б" },
+  { 0x37, "ю" },
+  { 0x38, "№" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_98_LAYER_1_ENTRIES[] = {
+  { 0x04, "Ф" },
+  { 0x05, "И" },
+  { 0x06, "С" },
+  { 0x07, "В" },
+  { 0x08, "У" },
+  { 0x09, "А" },
+  { 0x0A, "П" },
+  { 0x0B, "Р" },
+  { 0x0C, "Ш" },
+  { 0x0D, "О" },
+  { 0x0E, "Л" },
+  { 0x0F, "Д" },
+  { 0x10, "Ь" },
+  { 0x11, "Т" },
+  { 0x12, "Щ" },
+  { 0x13, "З" },
+  { 0x14, "Й" },
+  { 0x15, "К" },
+  { 0x16, "Ы" },
+  { 0x17, "Е" },
+  { 0x18, "Г" },
+  { 0x19, "М" },
+  { 0x1A, "Ц" },
+  { 0x1B, "Ч" },
+  { 0x1C, "Н" },
+  { 0x1D, "Я" },
+  { 0x1E, "!" },
+  { 0x1F, "Ә" },
+  { 0x20, "І" },
+  { 0x21, "Ң" },
+  { 0x22, "Ғ" },
+  { 0x23, ";" },
+  { 0x24, ":" },
+  { 0x25, "Ү" },
+  { 0x26, "Ұ" },
+  { 0x27, "Қ" },
+  { 0x2C, " " },
+  { 0x2D, "Ө" },
+  { 0x2E, "Һ" },
+  { 0x2F, "Х" },
+  { 0x30, "Ъ" },
+  { 0x31, "/" },
+  { 0x33, "Ж" },
+  { 0x34, "Э" },
+  { 0x35, ")" },
+  { 0x36, "Б" },
+  { 0x37, "Ю" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_98_LAYER_2_ENTRIES[] = {
+  { 0x04, "Ф" },
+  { 0x05, "И" },
+  { 0x06, "С" },
+  { 0x07, "В" },
+  { 0x08, "У" },
+  { 0x09, "А" },
+  { 0x0A, "П" },
+  { 0x0B, "Р" },
+  { 0x0C, "Ш" },
+  { 0x0D, "О" },
+  { 0x0E, "Л" },
+  { 0x0F, "Д" },
+  { 0x10, "Ь" },
+  { 0x11, "Т" },
+  { 0x12, "Щ" },
+  { 0x13, "З" },
+  { 0x14, "Й" },
+  { 0x15, "К" },
+  { 0x16, "Ы" },
+  { 0x17, "Е" },
+  { 0x18, "Г" },
+  { 0x19, "М" },
+  { 0x1A, "Ц" },
+  { 0x1B, "Ч" },
+  { 0x1C, "Н" },
+  { 0x1D, "Я" },
+  { 0x1F, "Ә" },
+  { 0x20, "І" },
+  { 0x21, "Ң" },
+  { 0x22, "Ғ" },
+  { 0x25, "Ү" },
+  { 0x26, "Ұ" },
+  { 0x27, "Қ" },
+  { 0x2D, "Ө" },
+  { 0x2E, "Һ" },
+  { 0x2F, "Х" },
+  { 0x30, "Ъ" },
+  { 0x33, "Ж" },
+  { 0x34, "Э" },
+  { 0x36, "Б" },
+  { 0x37, "Ю" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_98_LAYER_3_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_98_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_98_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_98_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_98_LAYER_2_ENTRIES, 42u,
+  },
+  {
+    "ctrl",
+    LAYOUT_98_LAYER_3_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_99_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "+" },
+  { 0x2E, "´" },
+  { 0x2F, "å" },
+  { 0x30, "¨" },
+  { 0x31, "'" },
+  { 0x33, "æ" },
+  { 0x34, "ø" },
+  { 0x35, "½" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "-" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "<" },
+};
+
+const wa_keyboard_mapping LAYOUT_99_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "#" },
+  { 0x21, "¤" },
+  { 0x22, "%" },
+  { 0x23, "&" },
+  { 0x24, "/" },
+  { 0x25, "(" },
+  { 0x26, ")" },
+  { 0x27, "=" },
+  { 0x2C, " " },
+  { 0x2D, "?" },
+  { 0x2E, "`" },
+  { 0x2F, "Å" },
+  { 0x30, "^" },
+  { 0x31, "*" },
+  { 0x33, "Æ" },
+  { 0x34, "Ø" },
+  { 0x35, "§" },
+  { 0x36, ";" },
+  { 0x37, ":" },
+  { 0x38, "_" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_99_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x2F, "Å" },
+  { 0x33, "Æ" },
+  { 0x34, "Ø" },
+};
+
+const wa_keyboard_mapping LAYOUT_99_LAYER_3_ENTRIES[] = {
+  { 0x07, "ð" },
+  { 0x08, "€" },
+  { 0x0E, "ĸ" },
+  { 0x10, "µ" },
+  { 0x13, "þ" },
+  { 0x16, "ß" },
+  { 0x1F, "@" },
+  { 0x20, "£" },
+  { 0x21, "$" },
+  { 0x22, "€" },
+  { 0x24, "{" },
+  { 0x25, "[" },
+  { 0x26, "]" },
+  { 0x27, "}" },
+  { 0x2E, "|" },
+  { 0x30, "~" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_99_LAYER_4_ENTRIES[] = {
+  { 0x07, "Ð" },
+  { 0x13, "Þ" },
+};
+
+const wa_keyboard_mapping LAYOUT_99_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_99_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_99_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_99_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_99_LAYER_2_ENTRIES, 29u,
+  },
+  {
+    "altgr",
+    LAYOUT_99_LAYER_3_ENTRIES, 17u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_99_LAYER_4_ENTRIES, 2u,
+  },
+  {
+    "ctrl",
+    LAYOUT_99_LAYER_5_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_100_LAYER_0_ENTRIES[] = {
+  { 0x04, "ា" },
+  { 0x05, "ប" },
+  { 0x06, "ច" },
+  { 0x07, "ដ" },
+  { 0x08, "េ" },
+  { 0x09, "ថ" },
+  { 0x0A, "ង" },
+  { 0x0B, "ហ" },
+  { 0x0C, "ិ" },
+  { 0x0D, "្" },
+  { 0x0E, "ក" },
+  { 0x0F, "ល" },
+  { 0x10, "ម" },
+  { 0x11, "ន" },
+  { 0x12, "ោ" },
+  { 0x13, "ផ" },
+  { 0x14, "ឆ" },
+  { 0x15, "រ" },
+  { 0x16, "ស" },
+  { 0x17, "ត" },
+  { 0x18, "ុ" },
+  { 0x19, "វ" },
+  { 0x1A, "ឹ" },
+  { 0x1B, "ខ" },
+  { 0x1C, "យ" },
+  { 0x1D, "ឋ" },
+  { 0x1E, "១" },
+  { 0x1F, "២" },
+  { 0x20, "៣" },
+  { 0x21, "៤" },
+  { 0x22, "៥" },
+  { 0x23, "៦" },
+  { 0x24, "៧" },
+  { 0x25, "៨" },
+  { 0x26, "៩" },
+  { 0x27, "០" },
+  { 0x2C, "​" },
+  { 0x2D, "ឥ" },
+  { 0x2E, "ឲ" },
+  { 0x2F, "ៀ" },
+  { 0x30, "ឪ" },
+  { 0x31, "ឮ" },
+  { 0x33, "ើ" },
+  { 0x34, "់" },
+  { 0x35, "«" },
+  { 0x36, "ុំ" },
+  { 0x37, "។" },
+  { 0x38, "៊" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_100_LAYER_1_ENTRIES[] = {
+  { 0x04, "ាំ" },
+  { 0x05, "ព" },
+  { 0x06, "ជ" },
+  { 0x07, "ឌ" },
+  { 0x08, "ែ" },
+  { 0x09, "ធ" },
+  { 0x0A, "អ" },
+  { 0x0B, "ះ" },
+  { 0x0C, "ី" },
+  { 0x0D, "ញ" },
+  { 0x0E, "គ" },
+  { 0x0F, "ឡ" },
+  { 0x10, "ំ" },
+  { 0x11, "ណ" },
+  { 0x12, "ៅ" },
+  { 0x13, "ភ" },
+  { 0x14, "ឈ" },
+  { 0x15, "ឬ" },
+  { 0x16, "ៃ" },
+  { 0x17, "ទ" },
+  { 0x18, "ូ" },
+  { 0x19, "េះ" },
+  { 0x1A, "ឺ" },
+  { 0x1B, "ឃ" },
+  { 0x1C, "ួ" },
+  { 0x1D, "ឍ" },
+  { 0x1E, "!" },
+  { 0x1F, "ៗ" },
+  { 0x20, "\"" },
+  { 0x21, "៛" },
+  { 0x22, "%" },
+  { 0x23, "៍" },
+  { 0x24, "័" },
+  { 0x25, "៏" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "៌" },
+  { 0x2E, "=" },
+  { 0x2F, "ឿ" },
+  { 0x30, "ឧ" },
+  { 0x31, "ឭ" },
+  { 0x33, "ោះ" },
+  { 0x34, "៉" },
+  { 0x35, "»" },
+  { 0x36, "ុះ" },
+  { 0x37, "៕" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_100_LAYER_2_ENTRIES[] = {
+  { 0x08, "ឯ" },
+  { 0x0C, "ឦ" },
+  { 0x12, "ឱ" },
+  { 0x13, "ឰ" },
+  { 0x15, "ឫ" },
+  { 0x1E, "‌" },
+  { 0x1F, "@" },
+  { 0x20, "៑" },
+  { 0x21, "$" },
+  { 0x22, "€" },
+  { 0x23, "៙" },
+  { 0x24, "៚" },
+  { 0x25, "*" },
+  { 0x26, "{" },
+  { 0x27, "}" },
+  { 0x2C, " " },
+  { 0x2D, "×" },
+  { 0x2E, "៎" },
+  { 0x2F, "ឩ" },
+  { 0x30, "ឳ" },
+  { 0x31, "\\" },
+  { 0x33, "៖" },
+  { 0x34, "ៈ" },
+  { 0x35, "‍" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+};
+
+const wa_keyboard_mapping LAYOUT_100_LAYER_3_ENTRIES[] = {
+  { 0x2A, "" },
+};
+
+const wa_keyboard_layer LAYOUT_100_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_100_LAYER_0_ENTRIES, 52u,
+  },
+  {
+    "shift",
+    LAYOUT_100_LAYER_1_ENTRIES, 52u,
+  },
+  {
+    "altgr",
+    LAYOUT_100_LAYER_2_ENTRIES, 27u,
+  },
+  {
+    "ctrl",
+    LAYOUT_100_LAYER_3_ENTRIES, 1u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_101_LAYER_0_ENTRIES[] = {
+  { 0x04, "ា" },
+  { 0x05, "ប" },
+  { 0x06, "ច" },
+  { 0x07, "ដ" },
+  { 0x08, "េ" },
+  { 0x09, "ថ" },
+  { 0x0A, "ង" },
+  { 0x0B, "ហ" },
+  { 0x0C, "ិ" },
+  { 0x0D, "ញ" },
+  { 0x0E, "ក" },
+  { 0x0F, "ល" },
+  { 0x10, "ម" },
+  { 0x11, "ន" },
+  { 0x12, "ោ" },
+  { 0x13, "ផ" },
+  { 0x14, "ឆ" },
+  { 0x15, "រ" },
+  { 0x16, "ស" },
+  { 0x17, "ត" },
+  { 0x18, "ុ" },
+  { 0x19, "វ" },
+  { 0x1A, "ឹ" },
+  { 0x1B, "ខ" },
+  { 0x1C, "យ" },
+  { 0x1D, "ឋ" },
+  { 0x1E, "១" },
+  { 0x1F, "២" },
+  { 0x20, "៣" },
+  { 0x21, "៤" },
+  { 0x22, "៥" },
+  { 0x23, "៦" },
+  { 0x24, "៧" },
+  { 0x25, "៨" },
+  { 0x26, "៩" },
+  { 0x27, "០" },
+  { 0x2C, "្" },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "ើ" },
+  { 0x30, "ឿ" },
+  { 0x31, "\\" },
+  { 0x33, "ៈ" },
+  { 0x34, "់" },
+  { 0x35, "‌" },
+  { 0x36, "អ" },
+  { 0x37, "។" },
+  { 0x38, "​" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_101_LAYER_1_ENTRIES[] = {
+  { 0x04, "ៃ" },
+  { 0x05, "ព" },
+  { 0x06, "ជ" },
+  { 0x07, "ឌ" },
+  { 0x08, "ែ" },
+  { 0x09, "ធ" },
+  { 0x0A, "ុះ" },
+  { 0x0B, "ះ" },
+  { 0x0C, "ី" },
+  { 0x0D, "ុំ" },
+  { 0x0E, "គ" },
+  { 0x0F, "ឡ" },
+  { 0x10, "ំ" },
+  { 0x11, "ណ" },
+  { 0x12, "ៅ" },
+  { 0x13, "ភ" },
+  { 0x14, "ឈ" },
+  { 0x15, "ឬ" },
+  { 0x16, "ាំ" },
+  { 0x17, "ទ" },
+  { 0x18, "ូ" },
+  { 0x19, "េះ" },
+  { 0x1A, "ឺ" },
+  { 0x1B, "ឃ" },
+  { 0x1C, "ួ" },
+  { 0x1D, "ឍ" },
+  { 0x1E, "!" },
+  { 0x1F, "ៗ" },
+  { 0x20, "៊" },
+  { 0x21, "៛" },
+  { 0x22, "័" },
+  { 0x23, "៌" },
+  { 0x24, "៍" },
+  { 0x25, "៏" },
+  { 0x26, "៎" },
+  { 0x27, "៑" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "ោះ" },
+  { 0x30, "ៀ" },
+  { 0x31, "/" },
+  { 0x33, "៖" },
+  { 0x34, "៉" },
+  { 0x35, "‍" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_101_LAYER_2_ENTRIES[] = {
+  { 0x04, "ឩ" },
+  { 0x05, "%" },
+  { 0x06, "&" },
+  { 0x08, "ឯ" },
+  { 0x0C, "ឥ" },
+  { 0x0D, "ឮ" },
+  { 0x0E, "ឭ" },
+  { 0x0F, "ឰ" },
+  { 0x10, ")" },
+  { 0x11, "(" },
+  { 0x12, "ឱ" },
+  { 0x13, "ឳ" },
+  { 0x14, "*" },
+  { 0x15, "ឫ" },
+  { 0x16, "ឪ" },
+  { 0x17, "ឦ" },
+  { 0x18, "ឧ" },
+  { 0x19, "$" },
+  { 0x1B, "@" },
+  { 0x1D, "#" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2D, "{" },
+  { 0x2E, "}" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "៚" },
+  { 0x33, ";" },
+  { 0x34, "៝" },
+  { 0x35, "៙" },
+  { 0x36, "‹" },
+  { 0x37, "›" },
+  { 0x38, "៕" },
+};
+
+const wa_keyboard_mapping LAYOUT_101_LAYER_3_ENTRIES[] = {
+  { 0x04, "᧰" },
+  { 0x05, "᧿" },
+  { 0x06, "᧽" },
+  { 0x07, "᧲" },
+  { 0x08, "᧯" },
+  { 0x09, "᧳" },
+  { 0x0A, "᧴" },
+  { 0x0B, "᧵" },
+  { 0x0C, "៴" },
+  { 0x0D, "᧶" },
+  { 0x0E, "᧷" },
+  { 0x0F, "᧸" },
+  { 0x12, "៵" },
+  { 0x13, "៶" },
+  { 0x14, "᧭" },
+  { 0x15, "៰" },
+  { 0x16, "᧱" },
+  { 0x17, "៱" },
+  { 0x18, "៳" },
+  { 0x19, "᧾" },
+  { 0x1A, "᧮" },
+  { 0x1B, "᧼" },
+  { 0x1C, "៲" },
+  { 0x1D, "᧻" },
+  { 0x1E, "᧡" },
+  { 0x1F, "᧢" },
+  { 0x20, "᧣" },
+  { 0x21, "᧤" },
+  { 0x22, "᧥" },
+  { 0x23, "᧦" },
+  { 0x24, "᧧" },
+  { 0x25, "᧨" },
+  { 0x26, "᧩" },
+  { 0x27, "᧪" },
+  { 0x2D, "᧫" },
+  { 0x2E, "᧬" },
+  { 0x2F, "៷" },
+  { 0x30, "៸" },
+  { 0x31, "៹" },
+  { 0x33, "᧹" },
+  { 0x34, "᧺" },
+  { 0x35, "᧠" },
+  { 0x37, "ឝ" },
+  { 0x38, "ឞ" },
+};
+
+const wa_keyboard_mapping LAYOUT_101_LAYER_4_ENTRIES[] = {
+  { 0x10, "’" },
+  { 0x1E, "₭" },
+  { 0x1F, "€" },
+  { 0x20, "₫" },
+  { 0x21, "₣" },
+  { 0x22, "¥" },
+  { 0x24, "£" },
+  { 0x27, "—" },
+  { 0x2A, "" },
+  { 0x2D, "•" },
+  { 0x2E, "­" },
+  { 0x31, "/" },
+  { 0x33, ":" },
+  { 0x34, "«" },
+  { 0x35, "฿" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "”" },
+};
+
+const wa_keyboard_layer LAYOUT_101_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_101_LAYER_0_ENTRIES, 52u,
+  },
+  {
+    "shift",
+    LAYOUT_101_LAYER_1_ENTRIES, 52u,
+  },
+  {
+    "altgr",
+    LAYOUT_101_LAYER_2_ENTRIES, 41u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_101_LAYER_3_ENTRIES, 44u,
+  },
+  {
+    "ctrl",
+    LAYOUT_101_LAYER_4_ENTRIES, 18u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_102_LAYER_0_ENTRIES[] = {
+  { 0x04, "ೋ" },
+  { 0x05, "ವ" },
+  { 0x06, "ಮ" },
+  { 0x07, "್" },
+  { 0x08, "ಾ" },
+  { 0x09, "ಿ" },
+  { 0x0A, "ು" },
+  { 0x0B, "ಪ" },
+  { 0x0C, "ಗ" },
+  { 0x0D, "ರ" },
+  { 0x0E, "ಕ" },
+  { 0x0F, "ತ" },
+  { 0x10, "ಸ" },
+  { 0x11, "ಲ" },
+  { 0x12, "ದ" },
+  { 0x13, "ಜ" },
+  { 0x14, "ೌ" },
+  { 0x15, "ೀ" },
+  { 0x16, "ೇ" },
+  { 0x17, "ೂ" },
+  { 0x18, "ಹ" },
+  { 0x19, "ನ" },
+  { 0x1A, "ೈ" },
+  { 0x1B, "ಂ" },
+  { 0x1C, "ಬ" },
+  { 0x1D, "ೆ" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "ೃ" },
+  { 0x2F, "ಡ" },
+  { 0x33, "ಚ" },
+  { 0x34, "ಟ" },
+  { 0x35, "ೊ" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "ಯ" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_102_LAYER_1_ENTRIES[] = {
+  { 0x04, "ಓ" },
+  { 0x06, "ಣ" },
+  { 0x07, "ಅ" },
+  { 0x08, "ಆ" },
+  { 0x09, "ಇ" },
+  { 0x0A, "ಉ" },
+  { 0x0B, "ಫ" },
+  { 0x0C, "ಘ" },
+  { 0x0D, "ಱ" },
+  { 0x0E, "ಖ" },
+  { 0x0F, "ಥ" },
+  { 0x10, "ಶ" },
+  { 0x11, "ಳ" },
+  { 0x12, "ಧ" },
+  { 0x13, "ಝ" },
+  { 0x14, "ಔ" },
+  { 0x15, "ಈ" },
+  { 0x16, "ಏ" },
+  { 0x17, "ಊ" },
+  { 0x18, "ಙ" },
+  { 0x1A, "ಐ" },
+  { 0x1C, "ಭ" },
+  { 0x1D, "ಎ" },
+  { 0x20, "್ರ" },
+  { 0x21, "ರ್" },
+  { 0x22, "ಜ್ಞ" },
+  { 0x23, "ತ್ರ" },
+  { 0x24, "ಕ್ಷ" },
+  { 0x25, "ಶ್ರ" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "ಃ" },
+  { 0x2E, "ಋ" },
+  { 0x2F, "ಢ" },
+  { 0x30, "ಞ" },
+  { 0x33, "ಛ" },
+  { 0x34, "ಠ" },
+  { 0x35, "ಒ" },
+  { 0x36, "ಷ" },
+  { 0x37, "|" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_102_LAYER_2_ENTRIES[] = {
+  { 0x16, "ೕ" },
+  { 0x1A, "ೖ" },
+  { 0x1E, "೧" },
+  { 0x1F, "೨" },
+  { 0x20, "೩" },
+  { 0x21, "೪" },
+  { 0x22, "೫" },
+  { 0x23, "೬" },
+  { 0x24, "೭" },
+  { 0x25, "೮" },
+  { 0x26, "೯" },
+  { 0x27, "೦" },
+  { 0x2E, "ೄ" },
+};
+
+const wa_keyboard_mapping LAYOUT_102_LAYER_3_ENTRIES[] = {
+  { 0x09, "ಌ" },
+  { 0x0B, "ೞ" },
+  { 0x15, "ೡ" },
+  { 0x2E, "ೠ" },
+};
+
+const wa_keyboard_mapping LAYOUT_102_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_102_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_102_LAYER_0_ENTRIES, 50u,
+  },
+  {
+    "shift",
+    LAYOUT_102_LAYER_1_ENTRIES, 45u,
+  },
+  {
+    "altgr",
+    LAYOUT_102_LAYER_2_ENTRIES, 13u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_102_LAYER_3_ENTRIES, 4u,
+  },
+  {
+    "ctrl",
+    LAYOUT_102_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_103_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x35, "`" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_103_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_103_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+};
+
+const wa_keyboard_mapping LAYOUT_103_LAYER_3_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_103_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_103_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_103_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_103_LAYER_2_ENTRIES, 26u,
+  },
+  {
+    "ctrl",
+    LAYOUT_103_LAYER_3_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_104_LAYER_0_ENTRIES[] = {
+  { 0x04, "ф" },
+  { 0x05, "и" },
+  { 0x06, "с" },
+  { 0x07, "в" },
+  { 0x08, "у" },
+  { 0x09, "а" },
+  { 0x0A, "п" },
+  { 0x0B, "р" },
+  { 0x0C, "ш" },
+  { 0x0D, "о" },
+  { 0x0E, "л" },
+  { 0x0F, "д" },
+  { 0x10, "ь" },
+  { 0x11, "т" },
+  { 0x12, "щ" },
+  { 0x13, "з" },
+  { 0x14, "й" },
+  { 0x15, "к" },
+  { 0x16, "ы" },
+  { 0x17, "е" },
+  { 0x18, "г" },
+  { 0x19, "м" },
+  { 0x1A, "ц" },
+  { 0x1B, "ч" },
+  { 0x1C, "н" },
+  { 0x1D, "я" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "х" },
+  { 0x30, "ъ" },
+  { 0x31, "\\" },
+  { 0x33, "ж" },
+  { 0x34, "э" },
+  { 0x35, "ё" },
+  { 0x36, "б" },
+  { 0x37, "ю" },
+  { 0x38, "." },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_104_LAYER_1_ENTRIES[] = {
+  { 0x04, "Ф" },
+  { 0x05, "И" },
+  { 0x06, "С" },
+  { 0x07, "В" },
+  { 0x08, "У" },
+  { 0x09, "А" },
+  { 0x0A, "П" },
+  { 0x0B, "Р" },
+  { 0x0C, "Ш" },
+  { 0x0D, "О" },
+  { 0x0E, "Л" },
+  { 0x0F, "Д" },
+  { 0x10, "Ь" },
+  { 0x11, "Т" },
+  { 0x12, "Щ" },
+  { 0x13, "З" },
+  { 0x14, "Й" },
+  { 0x15, "К" },
+  { 0x16, "Ы" },
+  { 0x17, "Е" },
+  { 0x18, "Г" },
+  { 0x19, "М" },
+  { 0x1A, "Ц" },
+  { 0x1B, "Ч" },
+  { 0x1C, "Н" },
+  { 0x1D, "Я" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "№" },
+  { 0x21, ";" },
+  { 0x22, "%" },
+  { 0x23, ":" },
+  { 0x24, "?" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "Х" },
+  { 0x30, "Ъ" },
+  { 0x31, "/" },
+  { 0x33, "Ж" },
+  { 0x34, "Э" },
+  { 0x35, "Ё" },
+  { 0x36, "Б" },
+  { 0x37, "Ю" },
+  { 0x38, "," },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "/" },
+};
+
+const wa_keyboard_mapping LAYOUT_104_LAYER_2_ENTRIES[] = {
+  { 0x04, "Ф" },
+  { 0x05, "И" },
+  { 0x06, "С" },
+  { 0x07, "В" },
+  { 0x08, "У" },
+  { 0x09, "А" },
+  { 0x0A, "П" },
+  { 0x0B, "Р" },
+  { 0x0C, "Ш" },
+  { 0x0D, "О" },
+  { 0x0E, "Л" },
+  { 0x0F, "Д" },
+  { 0x10, "Ь" },
+  { 0x11, "Т" },
+  { 0x12, "Щ" },
+  { 0x13, "З" },
+  { 0x14, "Й" },
+  { 0x15, "К" },
+  { 0x16, "Ы" },
+  { 0x17, "Е" },
+  { 0x18, "Г" },
+  { 0x19, "М" },
+  { 0x1A, "Ц" },
+  { 0x1B, "Ч" },
+  { 0x1C, "Н" },
+  { 0x1D, "Я" },
+  { 0x2F, "Х" },
+  { 0x30, "Ъ" },
+  { 0x33, "Ж" },
+  { 0x34, "Э" },
+  { 0x35, "Ё" },
+  { 0x36, "Б" },
+  { 0x37, "Ю" },
+};
+
+const wa_keyboard_mapping LAYOUT_104_LAYER_3_ENTRIES[] = {
+  { 0x08, "ү" },
+  { 0x0D, "ө" },
+  { 0x1C, "ң" },
+  { 0x26, "⃀" },
+};
+
+const wa_keyboard_mapping LAYOUT_104_LAYER_4_ENTRIES[] = {
+  { 0x08, "Ү" },
+  { 0x0D, "Ө" },
+  { 0x1C, "Ң" },
+};
+
+const wa_keyboard_mapping LAYOUT_104_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_104_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_104_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_104_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_104_LAYER_2_ENTRIES, 33u,
+  },
+  {
+    "altgr",
+    LAYOUT_104_LAYER_3_ENTRIES, 4u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_104_LAYER_4_ENTRIES, 3u,
+  },
+  {
+    "ctrl",
+    LAYOUT_104_LAYER_5_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_105_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "z" },
+  { 0x1D, "y" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "'" },
+  { 0x2E, "^" },
+  { 0x2F, "è" },
+  { 0x30, "¨" },
+  { 0x31, "$" },
+  { 0x33, "é" },
+  { 0x34, "à" },
+  { 0x35, "§" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "-" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "<" },
+};
+
+const wa_keyboard_mapping LAYOUT_105_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Z" },
+  { 0x1D, "Y" },
+  { 0x1E, "+" },
+  { 0x1F, "\"" },
+  { 0x20, "*" },
+  { 0x21, "ç" },
+  { 0x22, "%" },
+  { 0x23, "&" },
+  { 0x24, "/" },
+  { 0x25, "(" },
+  { 0x26, ")" },
+  { 0x27, "=" },
+  { 0x2C, " " },
+  { 0x2D, "?" },
+  { 0x2E, "`" },
+  { 0x2F, "ü" },
+  { 0x30, "!" },
+  { 0x31, "£" },
+  { 0x33, "ö" },
+  { 0x34, "ä" },
+  { 0x35, "°" },
+  { 0x36, ";" },
+  { 0x37, ":" },
+  { 0x38, "_" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_105_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Z" },
+  { 0x1D, "Y" },
+};
+
+const wa_keyboard_mapping LAYOUT_105_LAYER_3_ENTRIES[] = {
+  { 0x08, "€" },
+  { 0x1E, "¦" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "°" },
+  { 0x22, "§" },
+  { 0x23, "¬" },
+  { 0x24, "|" },
+  { 0x25, "¢" },
+  { 0x2D, "´" },
+  { 0x2E, "~" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "}" },
+  { 0x34, "{" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_105_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_105_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_105_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_105_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_105_LAYER_2_ENTRIES, 26u,
+  },
+  {
+    "altgr",
+    LAYOUT_105_LAYER_3_ENTRIES, 16u,
+  },
+  {
+    "ctrl",
+    LAYOUT_105_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_106_LAYER_0_ENTRIES[] = {
+  { 0x04, "ꓮ" },
+  { 0x05, "ꓐ" },
+  { 0x06, "ꓚ" },
+  { 0x07, "ꓓ" },
+  { 0x08, "ꓰ" },
+  { 0x09, "ꓝ" },
+  { 0x0A, "ꓖ" },
+  { 0x0B, "ꓧ" },
+  { 0x0C, "ꓲ" },
+  { 0x0D, "ꓙ" },
+  { 0x0E, "ꓗ" },
+  { 0x0F, "ꓡ" },
+  { 0x10, "ꓟ" },
+  { 0x11, "ꓠ" },
+  { 0x12, "ꓳ" },
+  { 0x13, "ꓑ" },
+  { 0x14, "Q" },
+  { 0x15, "ꓣ" },
+  { 0x16, "ꓢ" },
+  { 0x17, "ꓔ" },
+  { 0x18, "ꓴ" },
+  { 0x19, "ꓦ" },
+  { 0x1A, "ꓪ" },
+  { 0x1B, "ꓫ" },
+  { 0x1C, "ꓬ" },
+  { 0x1D, "ꓜ" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "‐" },
+  { 0x2E, "꓿" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x33, "ꓼ" },
+  { 0x34, "ʼ" },
+  { 0x35, "`" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_106_LAYER_1_ENTRIES[] = {
+  { 0x04, "ꓯ" },
+  { 0x05, "ꓭ" },
+  { 0x06, "ꓛ" },
+  { 0x07, "ꓷ" },
+  { 0x08, "ꓱ" },
+  { 0x09, "ꓞ" },
+  { 0x0A, "ꓨ" },
+  { 0x0B, "ꓺ" },
+  { 0x0C, "꓾" },
+  { 0x0D, "ꓩ" },
+  { 0x0E, "ꓘ" },
+  { 0x0F, "ꓶ" },
+  { 0x12, "ˍ" },
+  { 0x13, "ꓒ" },
+  { 0x15, "ꓤ" },
+  { 0x16, "ꓸꓼ" },
+  { 0x17, "ꓕ" },
+  { 0x18, "ꓵ" },
+  { 0x19, "ꓥ" },
+  { 0x1A, "ꓹꓼ" },
+  { 0x1C, "ꓻ" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "|" },
+  { 0x33, "ꓽ" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_106_LAYER_2_ENTRIES[] = {
+  { 0x2A, "" },
+};
+
+const wa_keyboard_layer LAYOUT_106_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_106_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_106_LAYER_1_ENTRIES, 48u,
+  },
+  {
+    "ctrl",
+    LAYOUT_106_LAYER_2_ENTRIES, 1u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_107_LAYER_0_ENTRIES[] = {
+  { 0x04, "ꓮ" },
+  { 0x05, "ꓐ" },
+  { 0x06, "ꓚ" },
+  { 0x07, "ꓷ" },
+  { 0x08, "ꓰ" },
+  { 0x09, "ꓝ" },
+  { 0x0A, "ꓖ" },
+  { 0x0B, "ꓧ" },
+  { 0x0C, "ꓲ" },
+  { 0x0D, "ꓙ" },
+  { 0x0E, "ꓗ" },
+  { 0x0F, "ꓡ" },
+  { 0x10, "ꓟ" },
+  { 0x11, "ꓠ" },
+  { 0x12, "ꓳ" },
+  { 0x13, "ꓑ" },
+  { 0x14, "ꓱ" },
+  { 0x15, "ꓣ" },
+  { 0x16, "ꓢ" },
+  { 0x17, "ꓔ" },
+  { 0x18, "ꓴ" },
+  { 0x19, "ꓦ" },
+  { 0x1A, "ꓪ" },
+  { 0x1B, "ꓫ" },
+  { 0x1C, "ꓬ" },
+  { 0x1D, "ꓜ" },
+  { 0x1E, "ꓭ" },
+  { 0x1F, "ꓷ" },
+  { 0x20, "ꓶ" },
+  { 0x21, "ꓛ" },
+  { 0x22, "ꓒ" },
+  { 0x23, "ꓨ" },
+  { 0x24, "ꓘ" },
+  { 0x25, "ꓕ" },
+  { 0x26, "ꓞ" },
+  { 0x27, "ꓩ" },
+  { 0x2C, " " },
+  { 0x2D, "ꓵ" },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x33, "ꓯ" },
+  { 0x34, "ʼ" },
+  { 0x35, "`" },
+  { 0x36, "ꓥ" },
+  { 0x37, "ꓤ" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_107_LAYER_1_ENTRIES[] = {
+  { 0x04, "@" },
+  { 0x05, "$" },
+  { 0x06, "&" },
+  { 0x07, "(" },
+  { 0x09, ")" },
+  { 0x0B, "꓿" },
+  { 0x0C, "꓾" },
+  { 0x0D, "ꓽ" },
+  { 0x0E, "ꓼ" },
+  { 0x0F, "‐" },
+  { 0x10, "!" },
+  { 0x11, "*" },
+  { 0x12, "ˍ" },
+  { 0x13, "^" },
+  { 0x14, "Q" },
+  { 0x16, "ꓸꓼ" },
+  { 0x17, "#" },
+  { 0x18, "ꓻ" },
+  { 0x19, "%" },
+  { 0x1A, "ꓹꓼ" },
+  { 0x1B, ">" },
+  { 0x1D, "<" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "|" },
+  { 0x33, "ꓺ" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_107_LAYER_2_ENTRIES[] = {
+  { 0x2A, "" },
+};
+
+const wa_keyboard_layer LAYOUT_107_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_107_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_107_LAYER_1_ENTRIES, 49u,
+  },
+  {
+    "ctrl",
+    LAYOUT_107_LAYER_2_ENTRIES, 1u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_108_LAYER_0_ENTRIES[] = {
+  { 0x04, "ັ" },
+  { 0x05, "ຶ" },
+  { 0x06, "ແ" },
+  { 0x07, "ກ" },
+  { 0x08, "ຳ" },
+  { 0x09, "ດ" },
+  { 0x0A, "ເ" },
+  { 0x0B, "້" },
+  { 0x0C, "ຮ" },
+  { 0x0D, "່" },
+  { 0x0E, "າ" },
+  { 0x0F, "ສ" },
+  { 0x10, "ທ" },
+  { 0x11, "ື" },
+  { 0x12, "ນ" },
+  { 0x13, "ຍ" },
+  { 0x14, "ົ" },
+  { 0x15, "ພ" },
+  { 0x16, "ຫ" },
+  { 0x17, "ະ" },
+  { 0x18, "ີ" },
+  { 0x19, "ອ" },
+  { 0x1A, "ໄ" },
+  { 0x1B, "ປ" },
+  { 0x1C, "ິ" },
+  { 0x1D, "ຜ" },
+  { 0x1E, "ຢ" },
+  { 0x1F, "ຟ" },
+  { 0x20, "ໂ" },
+  { 0x21, "ຖ" },
+  { 0x22, "ຸ" },
+  { 0x23, "ູ" },
+  { 0x24, "ຄ" },
+  { 0x25, "ຕ" },
+  { 0x26, "ຈ" },
+  { 0x27, "ຂ" },
+  { 0x2C, " " },
+  { 0x2D, "ຊ" },
+  { 0x2E, "ໍ" },
+  { 0x2F, "ບ" },
+  { 0x30, "ລ" },
+  { 0x31, "/" },
+  { 0x33, "ວ" },
+  { 0x34, "ງ" },
+  { 0x35, "\"" },
+  { 0x36, "ມ" },
+  { 0x37, "ໃ" },
+  { 0x38, "ຝ" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_108_LAYER_1_ENTRIES[] = {
+  { 0x04, "ັ້" },
+  { 0x05, "ຶ້" },
+  { 0x06, "ຯ" },
+  { 0x07, "." },
+  { 0x08, "*" },
+  { 0x09, "," },
+  { 0x0A, ":" },
+  { 0x0B, "໊" },
+  { 0x0C, "ຣ" },
+  { 0x0D, "໋" },
+  { 0x0E, "!" },
+  { 0x0F, "?" },
+  { 0x10, "ໆ" },
+  { 0x11, "ື້" },
+  { 0x12, "ໜ" },
+  { 0x13, "ຽ" },
+  { 0x14, "ົ້" },
+  { 0x15, "_" },
+  { 0x16, ";" },
+  { 0x17, "+" },
+  { 0x18, "ີ້" },
+  { 0x19, "x" },
+  { 0x1A, "0" },
+  { 0x1B, "(" },
+  { 0x1C, "ິ້" },
+  { 0x1D, "₭" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "໌" },
+  { 0x23, "ຼ" },
+  { 0x24, "5" },
+  { 0x25, "6" },
+  { 0x26, "7" },
+  { 0x27, "8" },
+  { 0x2C, "​" },
+  { 0x2D, "9" },
+  { 0x2E, "ໍ່" },
+  { 0x2F, "-" },
+  { 0x30, "ຫຼ" },
+  { 0x31, "\\" },
+  { 0x33, "%" },
+  { 0x34, "=" },
+  { 0x35, "'" },
+  { 0x36, "ໝ" },
+  { 0x37, "$" },
+  { 0x38, ")" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_108_LAYER_2_ENTRIES[] = {
+  { 0x1E, "໑" },
+  { 0x1F, "໒" },
+  { 0x20, "໓" },
+  { 0x21, "໔" },
+  { 0x22, "໕" },
+  { 0x23, "໖" },
+  { 0x24, "໗" },
+  { 0x25, "໘" },
+  { 0x26, "໙" },
+  { 0x27, "໐" },
+};
+
+const wa_keyboard_mapping LAYOUT_108_LAYER_3_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, "​" },
+};
+
+const wa_keyboard_layer LAYOUT_108_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_108_LAYER_0_ENTRIES, 52u,
+  },
+  {
+    "shift",
+    LAYOUT_108_LAYER_1_ENTRIES, 52u,
+  },
+  {
+    "altgr",
+    LAYOUT_108_LAYER_2_ENTRIES, 10u,
+  },
+  {
+    "ctrl",
+    LAYOUT_108_LAYER_3_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_109_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "ą" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "ž" },
+  { 0x1B, "ū" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "/" },
+  { 0x21, ";" },
+  { 0x22, ":" },
+  { 0x23, "," },
+  { 0x24, "." },
+  { 0x25, "?" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "į" },
+  { 0x30, "“" },
+  { 0x31, "|" },
+  { 0x33, "ų" },
+  { 0x34, "ė" },
+  { 0x35, "`" },
+  { 0x36, "č" },
+  { 0x37, "š" },
+  { 0x38, "ę" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_109_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Ą" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "Ž" },
+  { 0x1B, "Ū" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "Į" },
+  { 0x30, "”" },
+  { 0x31, "\\" },
+  { 0x33, "Ų" },
+  { 0x34, "Ė" },
+  { 0x35, "~" },
+  { 0x36, "Č" },
+  { 0x37, "Š" },
+  { 0x38, "Ę" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_109_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Ą" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "Ž" },
+  { 0x1B, "Ū" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x2F, "Į" },
+  { 0x33, "Ų" },
+  { 0x34, "Ė" },
+  { 0x36, "Č" },
+  { 0x37, "Š" },
+  { 0x38, "Ę" },
+};
+
+const wa_keyboard_mapping LAYOUT_109_LAYER_3_ENTRIES[] = {
+  { 0x08, "€" },
+  { 0x24, "{" },
+  { 0x25, "[" },
+  { 0x26, "]" },
+  { 0x27, "}" },
+};
+
+const wa_keyboard_mapping LAYOUT_109_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_109_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_109_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_109_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_109_LAYER_2_ENTRIES, 32u,
+  },
+  {
+    "altgr",
+    LAYOUT_109_LAYER_3_ENTRIES, 5u,
+  },
+  {
+    "ctrl",
+    LAYOUT_109_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_110_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "š" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "ą" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "ž" },
+  { 0x1B, "ū" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "!" },
+  { 0x1F, "-" },
+  { 0x20, "/" },
+  { 0x21, ";" },
+  { 0x22, ":" },
+  { 0x23, "," },
+  { 0x24, "." },
+  { 0x25, "=" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "?" },
+  { 0x2E, "x" },
+  { 0x2F, "į" },
+  { 0x30, "w" },
+  { 0x31, "q" },
+  { 0x33, "ų" },
+  { 0x34, "ė" },
+  { 0x35, "`" },
+  { 0x36, "č" },
+  { 0x37, "f" },
+  { 0x38, "ę" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "<" },
+};
+
+const wa_keyboard_mapping LAYOUT_110_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "Š" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Ą" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "Ž" },
+  { 0x1B, "Ū" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "+" },
+  { 0x2E, "X" },
+  { 0x2F, "Į" },
+  { 0x30, "W" },
+  { 0x31, "Q" },
+  { 0x33, "Ų" },
+  { 0x34, "Ė" },
+  { 0x35, "~" },
+  { 0x36, "Č" },
+  { 0x37, "F" },
+  { 0x38, "Ę" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_110_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "Š" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Ą" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "Ž" },
+  { 0x1B, "Ū" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x2E, "X" },
+  { 0x2F, "Į" },
+  { 0x30, "W" },
+  { 0x31, "Q" },
+  { 0x33, "Ų" },
+  { 0x34, "Ė" },
+  { 0x36, "Č" },
+  { 0x37, "F" },
+  { 0x38, "Ę" },
+};
+
+const wa_keyboard_mapping LAYOUT_110_LAYER_3_ENTRIES[] = {
+  { 0x08, "€" },
+  { 0x1E, "@" },
+  { 0x1F, "_" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "§" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "[" },
+  { 0x27, "]" },
+  { 0x2C, " " },
+  { 0x2D, "'" },
+  { 0x2E, "%" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "|" },
+  { 0x34, "\"" },
+  { 0x35, "´" },
+  { 0x36, "„" },
+  { 0x37, "“" },
+  { 0x38, "\\" },
+  { 0x64, "–" },
+};
+
+const wa_keyboard_mapping LAYOUT_110_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_110_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_110_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_110_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_110_LAYER_2_ENTRIES, 35u,
+  },
+  {
+    "altgr",
+    LAYOUT_110_LAYER_3_ENTRIES, 23u,
+  },
+  {
+    "ctrl",
+    LAYOUT_110_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_111_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "ą" },
+  { 0x1F, "č" },
+  { 0x20, "ę" },
+  { 0x21, "ė" },
+  { 0x22, "į" },
+  { 0x23, "š" },
+  { 0x24, "ų" },
+  { 0x25, "ū" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "ž" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x35, "`" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_111_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "Ą" },
+  { 0x1F, "Č" },
+  { 0x20, "Ę" },
+  { 0x21, "Ė" },
+  { 0x22, "Į" },
+  { 0x23, "Š" },
+  { 0x24, "Ų" },
+  { 0x25, "Ū" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "Ž" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_111_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "Ą" },
+  { 0x1F, "Č" },
+  { 0x20, "Ę" },
+  { 0x21, "Ė" },
+  { 0x22, "Į" },
+  { 0x23, "Š" },
+  { 0x24, "Ų" },
+  { 0x25, "Ū" },
+  { 0x2E, "Ž" },
+};
+
+const wa_keyboard_mapping LAYOUT_111_LAYER_3_ENTRIES[] = {
+  { 0x08, "€" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2E, "=" },
+};
+
+const wa_keyboard_mapping LAYOUT_111_LAYER_4_ENTRIES[] = {
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x2E, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_111_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_111_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_111_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_111_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_111_LAYER_2_ENTRIES, 35u,
+  },
+  {
+    "altgr",
+    LAYOUT_111_LAYER_3_ENTRIES, 12u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_111_LAYER_4_ENTRIES, 9u,
+  },
+  {
+    "ctrl",
+    LAYOUT_111_LAYER_5_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_112_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x35, "`" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_112_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_112_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+};
+
+const wa_keyboard_mapping LAYOUT_112_LAYER_3_ENTRIES[] = {
+  { 0x04, "ā" },
+  { 0x06, "č" },
+  { 0x08, "ē" },
+  { 0x0A, "ģ" },
+  { 0x0C, "ī" },
+  { 0x0E, "ķ" },
+  { 0x0F, "ļ" },
+  { 0x11, "ņ" },
+  { 0x12, "õ" },
+  { 0x15, "ŗ" },
+  { 0x16, "š" },
+  { 0x18, "ū" },
+  { 0x1D, "ž" },
+  { 0x1E, " " },
+  { 0x1F, "«" },
+  { 0x20, "»" },
+  { 0x21, "€" },
+  { 0x23, "’" },
+  { 0x2D, "–" },
+  { 0x31, "°" },
+  { 0x34, "´" },
+  { 0x35, "­" },
+};
+
+const wa_keyboard_mapping LAYOUT_112_LAYER_4_ENTRIES[] = {
+  { 0x04, "Ā" },
+  { 0x06, "Č" },
+  { 0x08, "Ē" },
+  { 0x0A, "Ģ" },
+  { 0x0C, "Ī" },
+  { 0x0E, "Ķ" },
+  { 0x0F, "Ļ" },
+  { 0x11, "Ņ" },
+  { 0x12, "Õ" },
+  { 0x15, "Ŗ" },
+  { 0x16, "Š" },
+  { 0x18, "Ū" },
+  { 0x1D, "Ž" },
+  { 0x21, "§" },
+  { 0x22, "°" },
+  { 0x24, "±" },
+  { 0x25, "×" },
+  { 0x2D, "—" },
+  { 0x34, "¨" },
+  { 0x35, "~" },
+};
+
+const wa_keyboard_mapping LAYOUT_112_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_112_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_112_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_112_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_112_LAYER_2_ENTRIES, 26u,
+  },
+  {
+    "altgr",
+    LAYOUT_112_LAYER_3_ENTRIES, 22u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_112_LAYER_4_ENTRIES, 20u,
+  },
+  {
+    "ctrl",
+    LAYOUT_112_LAYER_5_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_113_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x35, "`" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_113_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_113_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+};
+
+const wa_keyboard_mapping LAYOUT_113_LAYER_3_ENTRIES[] = {
+  { 0x04, "ā" },
+  { 0x06, "č" },
+  { 0x08, "ē" },
+  { 0x0A, "ģ" },
+  { 0x0C, "ī" },
+  { 0x0E, "ķ" },
+  { 0x0F, "ļ" },
+  { 0x11, "ņ" },
+  { 0x12, "ō" },
+  { 0x15, "ŗ" },
+  { 0x16, "š" },
+  { 0x18, "ū" },
+  { 0x1D, "ž" },
+  { 0x1E, " " },
+  { 0x1F, "«" },
+  { 0x20, "»" },
+  { 0x21, "€" },
+  { 0x23, "’" },
+  { 0x2D, "–" },
+  { 0x34, "´" },
+  { 0x35, "­" },
+};
+
+const wa_keyboard_mapping LAYOUT_113_LAYER_4_ENTRIES[] = {
+  { 0x04, "Ā" },
+  { 0x06, "Č" },
+  { 0x08, "Ē" },
+  { 0x0A, "Ģ" },
+  { 0x0C, "Ī" },
+  { 0x0E, "Ķ" },
+  { 0x0F, "Ļ" },
+  { 0x11, "Ņ" },
+  { 0x12, "Ō" },
+  { 0x15, "Ŗ" },
+  { 0x16, "Š" },
+  { 0x18, "Ū" },
+  { 0x1D, "Ž" },
+  { 0x21, "§" },
+  { 0x22, "°" },
+  { 0x24, "±" },
+  { 0x25, "×" },
+  { 0x2D, "—" },
+  { 0x34, "¨" },
+};
+
+const wa_keyboard_mapping LAYOUT_113_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_113_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_113_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_113_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_113_LAYER_2_ENTRIES, 26u,
+  },
+  {
+    "altgr",
+    LAYOUT_113_LAYER_3_ENTRIES, 21u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_113_LAYER_4_ENTRIES, 19u,
+  },
+  {
+    "ctrl",
+    LAYOUT_113_LAYER_5_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_114_LAYER_0_ENTRIES[] = {
+  { 0x04, "š" },
+  { 0x05, "p" },
+  { 0x06, "ī" },
+  { 0x07, "s" },
+  { 0x08, "j" },
+  { 0x09, "i" },
+  { 0x0A, "l" },
+  { 0x0B, "d" },
+  { 0x0C, "z" },
+  { 0x0D, "a" },
+  { 0x0E, "t" },
+  { 0x0F, "e" },
+  { 0x10, "ā" },
+  { 0x11, "o" },
+  { 0x12, "ē" },
+  { 0x13, "č" },
+  { 0x14, "ū" },
+  { 0x15, "r" },
+  { 0x16, "u" },
+  { 0x17, "m" },
+  { 0x18, "n" },
+  { 0x19, "k" },
+  { 0x1A, "g" },
+  { 0x1B, "b" },
+  { 0x1C, "v" },
+  { 0x1D, "ņ" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "f" },
+  { 0x2F, "ž" },
+  { 0x30, "h" },
+  { 0x31, "ķ" },
+  { 0x33, "c" },
+  { 0x34, "´" },
+  { 0x35, "­" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "ļ" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "ģ" },
+};
+
+const wa_keyboard_mapping LAYOUT_114_LAYER_1_ENTRIES[] = {
+  { 0x04, "Š" },
+  { 0x05, "P" },
+  { 0x06, "Ī" },
+  { 0x07, "S" },
+  { 0x08, "J" },
+  { 0x09, "I" },
+  { 0x0A, "L" },
+  { 0x0B, "D" },
+  { 0x0C, "Z" },
+  { 0x0D, "A" },
+  { 0x0E, "T" },
+  { 0x0F, "E" },
+  { 0x10, "Ā" },
+  { 0x11, "O" },
+  { 0x12, "Ē" },
+  { 0x13, "Č" },
+  { 0x14, "Ū" },
+  { 0x15, "R" },
+  { 0x16, "U" },
+  { 0x17, "M" },
+  { 0x18, "N" },
+  { 0x19, "K" },
+  { 0x1A, "G" },
+  { 0x1B, "B" },
+  { 0x1C, "V" },
+  { 0x1D, "Ņ" },
+  { 0x1E, "!" },
+  { 0x1F, "«" },
+  { 0x20, "»" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "/" },
+  { 0x24, "&" },
+  { 0x25, "×" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "F" },
+  { 0x2F, "Ž" },
+  { 0x30, "H" },
+  { 0x31, "Ķ" },
+  { 0x33, "C" },
+  { 0x34, "°" },
+  { 0x35, "?" },
+  { 0x36, ";" },
+  { 0x37, ":" },
+  { 0x38, "Ļ" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "Ģ" },
+};
+
+const wa_keyboard_mapping LAYOUT_114_LAYER_2_ENTRIES[] = {
+  { 0x04, "Š" },
+  { 0x05, "P" },
+  { 0x06, "Ī" },
+  { 0x07, "S" },
+  { 0x08, "J" },
+  { 0x09, "I" },
+  { 0x0A, "L" },
+  { 0x0B, "D" },
+  { 0x0C, "Z" },
+  { 0x0D, "A" },
+  { 0x0E, "T" },
+  { 0x0F, "E" },
+  { 0x10, "Ā" },
+  { 0x11, "O" },
+  { 0x12, "Ē" },
+  { 0x13, "Č" },
+  { 0x14, "Ū" },
+  { 0x15, "R" },
+  { 0x16, "U" },
+  { 0x17, "M" },
+  { 0x18, "N" },
+  { 0x19, "K" },
+  { 0x1A, "G" },
+  { 0x1B, "B" },
+  { 0x1C, "V" },
+  { 0x1D, "Ņ" },
+  { 0x2E, "F" },
+  { 0x2F, "Ž" },
+  { 0x30, "H" },
+  { 0x31, "Ķ" },
+  { 0x33, "C" },
+  { 0x38, "Ļ" },
+  { 0x64, "Ģ" },
+};
+
+const wa_keyboard_mapping LAYOUT_114_LAYER_3_ENTRIES[] = {
+  { 0x0F, "€" },
+  { 0x11, "õ" },
+  { 0x14, "q" },
+  { 0x15, "ŗ" },
+  { 0x17, "w" },
+  { 0x19, "ķ" },
+  { 0x1A, "ģ" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1E, "«" },
+  { 0x21, "€" },
+  { 0x22, "\"" },
+  { 0x23, "’" },
+  { 0x25, ":" },
+  { 0x2D, "–" },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x34, "´" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_114_LAYER_4_ENTRIES[] = {
+  { 0x11, "Õ" },
+  { 0x14, "Q" },
+  { 0x15, "Ŗ" },
+  { 0x17, "W" },
+  { 0x19, "Ķ" },
+  { 0x1A, "Ģ" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "~" },
+  { 0x23, "^" },
+  { 0x24, "±" },
+  { 0x2D, "—" },
+  { 0x2E, ";" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x34, "¨" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_114_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_114_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_114_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_114_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_114_LAYER_2_ENTRIES, 33u,
+  },
+  {
+    "altgr",
+    LAYOUT_114_LAYER_3_ENTRIES, 22u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_114_LAYER_4_ENTRIES, 20u,
+  },
+  {
+    "ctrl",
+    LAYOUT_114_LAYER_5_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_115_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x35, "`" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_115_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_115_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+};
+
+const wa_keyboard_mapping LAYOUT_115_LAYER_3_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_115_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_115_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_115_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_115_LAYER_2_ENTRIES, 26u,
+  },
+  {
+    "ctrl",
+    LAYOUT_115_LAYER_3_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_116_LAYER_0_ENTRIES[] = {
+  { 0x04, "а" },
+  { 0x05, "б" },
+  { 0x06, "ц" },
+  { 0x07, "д" },
+  { 0x08, "е" },
+  { 0x09, "ф" },
+  { 0x0A, "г" },
+  { 0x0B, "х" },
+  { 0x0C, "и" },
+  { 0x0D, "ј" },
+  { 0x0E, "к" },
+  { 0x0F, "л" },
+  { 0x10, "м" },
+  { 0x11, "н" },
+  { 0x12, "о" },
+  { 0x13, "п" },
+  { 0x14, "љ" },
+  { 0x15, "р" },
+  { 0x16, "с" },
+  { 0x17, "т" },
+  { 0x18, "у" },
+  { 0x19, "в" },
+  { 0x1A, "њ" },
+  { 0x1B, "џ" },
+  { 0x1C, "ѕ" },
+  { 0x1D, "з" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "ш" },
+  { 0x30, "ѓ" },
+  { 0x31, "ж" },
+  { 0x33, "ч" },
+  { 0x34, "ќ" },
+  { 0x35, "ѝ" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "ѐ" },
+};
+
+const wa_keyboard_mapping LAYOUT_116_LAYER_1_ENTRIES[] = {
+  { 0x04, "А" },
+  { 0x05, "Б" },
+  { 0x06, "Ц" },
+  { 0x07, "Д" },
+  { 0x08, "Е" },
+  { 0x09, "Ф" },
+  { 0x0A, "Г" },
+  { 0x0B, "Х" },
+  { 0x0C, "И" },
+  { 0x0D, "Ј" },
+  { 0x0E, "К" },
+  { 0x0F, "Л" },
+  { 0x10, "М" },
+  { 0x11, "Н" },
+  { 0x12, "О" },
+  { 0x13, "П" },
+  { 0x14, "Љ" },
+  { 0x15, "Р" },
+  { 0x16, "С" },
+  { 0x17, "Т" },
+  { 0x18, "У" },
+  { 0x19, "В" },
+  { 0x1A, "Њ" },
+  { 0x1B, "Џ" },
+  { 0x1C, "Ѕ" },
+  { 0x1D, "З" },
+  { 0x1E, "!" },
+  { 0x1F, "„" },
+  { 0x20, "“" },
+  { 0x21, "'" },
+  { 0x22, "%" },
+  { 0x23, "‚" },
+  { 0x24, "‘" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "+" },
+  { 0x2F, "Ш" },
+  { 0x30, "Ѓ" },
+  { 0x31, "Ж" },
+  { 0x33, "Ч" },
+  { 0x34, "Ќ" },
+  { 0x35, "Ѝ" },
+  { 0x36, ";" },
+  { 0x37, ":" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "Ѐ" },
+};
+
+const wa_keyboard_mapping LAYOUT_116_LAYER_2_ENTRIES[] = {
+  { 0x04, "А" },
+  { 0x05, "Б" },
+  { 0x06, "Ц" },
+  { 0x07, "Д" },
+  { 0x08, "Е" },
+  { 0x09, "Ф" },
+  { 0x0A, "Г" },
+  { 0x0B, "Х" },
+  { 0x0C, "И" },
+  { 0x0D, "Ј" },
+  { 0x0E, "К" },
+  { 0x0F, "Л" },
+  { 0x10, "М" },
+  { 0x11, "Н" },
+  { 0x12, "О" },
+  { 0x13, "П" },
+  { 0x14, "Љ" },
+  { 0x15, "Р" },
+  { 0x16, "С" },
+  { 0x17, "Т" },
+  { 0x18, "У" },
+  { 0x19, "В" },
+  { 0x1A, "Њ" },
+  { 0x1B, "Џ" },
+  { 0x1C, "Ѕ" },
+  { 0x1D, "З" },
+  { 0x2F, "Ш" },
+  { 0x30, "Ѓ" },
+  { 0x31, "Ж" },
+  { 0x33, "Ч" },
+  { 0x34, "Ќ" },
+};
+
+const wa_keyboard_mapping LAYOUT_116_LAYER_3_ENTRIES[] = {
+  { 0x1E, "°" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "…" },
+  { 0x26, "{" },
+  { 0x27, "}" },
+  { 0x2D, "—" },
+  { 0x2E, "́" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "|" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_116_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+};
+
+const wa_keyboard_layer LAYOUT_116_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_116_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_116_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_116_LAYER_2_ENTRIES, 31u,
+  },
+  {
+    "altgr",
+    LAYOUT_116_LAYER_3_ENTRIES, 17u,
+  },
+  {
+    "ctrl",
+    LAYOUT_116_LAYER_4_ENTRIES, 1u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_117_LAYER_0_ENTRIES[] = {
+  { 0x04, "а" },
+  { 0x05, "б" },
+  { 0x06, "ц" },
+  { 0x07, "д" },
+  { 0x08, "е" },
+  { 0x09, "ф" },
+  { 0x0A, "г" },
+  { 0x0B, "х" },
+  { 0x0C, "и" },
+  { 0x0D, "ј" },
+  { 0x0E, "к" },
+  { 0x0F, "л" },
+  { 0x10, "м" },
+  { 0x11, "н" },
+  { 0x12, "о" },
+  { 0x13, "п" },
+  { 0x14, "љ" },
+  { 0x15, "р" },
+  { 0x16, "с" },
+  { 0x17, "т" },
+  { 0x18, "у" },
+  { 0x19, "в" },
+  { 0x1A, "њ" },
+  { 0x1B, "џ" },
+  { 0x1C, "ѕ" },
+  { 0x1D, "з" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "ш" },
+  { 0x30, "ѓ" },
+  { 0x31, "ж" },
+  { 0x33, "ч" },
+  { 0x34, "ќ" },
+  { 0x35, "`" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "ё" },
+};
+
+const wa_keyboard_mapping LAYOUT_117_LAYER_1_ENTRIES[] = {
+  { 0x04, "А" },
+  { 0x05, "Б" },
+  { 0x06, "Ц" },
+  { 0x07, "Д" },
+  { 0x08, "Е" },
+  { 0x09, "Ф" },
+  { 0x0A, "Г" },
+  { 0x0B, "Х" },
+  { 0x0C, "И" },
+  { 0x0D, "Ј" },
+  { 0x0E, "К" },
+  { 0x0F, "Л" },
+  { 0x10, "М" },
+  { 0x11, "Н" },
+  { 0x12, "О" },
+  { 0x13, "П" },
+  { 0x14, "Љ" },
+  { 0x15, "Р" },
+  { 0x16, "С" },
+  { 0x17, "Т" },
+  { 0x18, "У" },
+  { 0x19, "В" },
+  { 0x1A, "Њ" },
+  { 0x1B, "Џ" },
+  { 0x1C, "Ѕ" },
+  { 0x1D, "З" },
+  { 0x1E, "!" },
+  { 0x1F, "„" },
+  { 0x20, "“" },
+  { 0x21, "’" },
+  { 0x22, "%" },
+  { 0x23, "‘" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "Ш" },
+  { 0x30, "Ѓ" },
+  { 0x31, "Ж" },
+  { 0x33, "Ч" },
+  { 0x34, "Ќ" },
+  { 0x35, "~" },
+  { 0x36, ";" },
+  { 0x37, ":" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "Ё" },
+};
+
+const wa_keyboard_mapping LAYOUT_117_LAYER_2_ENTRIES[] = {
+  { 0x04, "А" },
+  { 0x05, "Б" },
+  { 0x06, "Ц" },
+  { 0x07, "Д" },
+  { 0x08, "Е" },
+  { 0x09, "Ф" },
+  { 0x0A, "Г" },
+  { 0x0B, "Х" },
+  { 0x0C, "И" },
+  { 0x0D, "Ј" },
+  { 0x0E, "К" },
+  { 0x0F, "Л" },
+  { 0x10, "М" },
+  { 0x11, "Н" },
+  { 0x12, "О" },
+  { 0x13, "П" },
+  { 0x14, "Љ" },
+  { 0x15, "Р" },
+  { 0x16, "С" },
+  { 0x17, "Т" },
+  { 0x18, "У" },
+  { 0x19, "В" },
+  { 0x1A, "Њ" },
+  { 0x1B, "Џ" },
+  { 0x1C, "Ѕ" },
+  { 0x1D, "З" },
+  { 0x2F, "Ш" },
+  { 0x30, "Ѓ" },
+  { 0x31, "Ж" },
+  { 0x33, "Ч" },
+  { 0x34, "Ќ" },
+  { 0x64, "Ё" },
+};
+
+const wa_keyboard_mapping LAYOUT_117_LAYER_3_ENTRIES[] = {
+  { 0x05, "{" },
+  { 0x08, "€" },
+  { 0x09, "[" },
+  { 0x0A, "]" },
+  { 0x10, "§" },
+  { 0x11, "}" },
+  { 0x19, "@" },
+  { 0x2F, "Ђ" },
+  { 0x30, "ђ" },
+  { 0x33, "Ћ" },
+  { 0x34, "ћ" },
+};
+
+const wa_keyboard_mapping LAYOUT_117_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_117_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_117_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_117_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_117_LAYER_2_ENTRIES, 32u,
+  },
+  {
+    "altgr",
+    LAYOUT_117_LAYER_3_ENTRIES, 11u,
+  },
+  {
+    "ctrl",
+    LAYOUT_117_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_118_LAYER_0_ENTRIES[] = {
+  { 0x04, "ോ" },
+  { 0x05, "വ" },
+  { 0x06, "മ" },
+  { 0x07, "്" },
+  { 0x08, "ാ" },
+  { 0x09, "ി" },
+  { 0x0A, "ു" },
+  { 0x0B, "പ" },
+  { 0x0C, "ഗ" },
+  { 0x0D, "ര" },
+  { 0x0E, "ക" },
+  { 0x0F, "ത" },
+  { 0x10, "സ" },
+  { 0x11, "ല" },
+  { 0x12, "ദ" },
+  { 0x13, "ജ" },
+  { 0x14, "ൌ" },
+  { 0x15, "ീ" },
+  { 0x16, "േ" },
+  { 0x17, "ൂ" },
+  { 0x18, "ഹ" },
+  { 0x19, "ന" },
+  { 0x1A, "ൈ" },
+  { 0x1B, "ം" },
+  { 0x1C, "ബ" },
+  { 0x1D, "െ" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "ൃ" },
+  { 0x2F, "ഡ" },
+  { 0x30, "ർ" },
+  { 0x33, "ച" },
+  { 0x34, "ട" },
+  { 0x35, "ൊ" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "യ" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_118_LAYER_1_ENTRIES[] = {
+  { 0x04, "ഓ" },
+  { 0x05, "ഴ" },
+  { 0x06, "ണ" },
+  { 0x07, "അ" },
+  { 0x08, "ആ" },
+  { 0x09, "ഇ" },
+  { 0x0A, "ഉ" },
+  { 0x0B, "ഫ" },
+  { 0x0C, "ഘ" },
+  { 0x0D, "റ" },
+  { 0x0E, "ഖ" },
+  { 0x0F, "ഥ" },
+  { 0x10, "ശ" },
+  { 0x11, "ള" },
+  { 0x12, "ധ" },
+  { 0x13, "ഝ" },
+  { 0x14, "ഔ" },
+  { 0x15, "ഈ" },
+  { 0x16, "ഏ" },
+  { 0x17, "ഊ" },
+  { 0x18, "ങ" },
+  { 0x19, "ൻ" },
+  { 0x1A, "ഐ" },
+  { 0x1B, "ൺ" },
+  { 0x1C, "ഭ" },
+  { 0x1D, "എ" },
+  { 0x20, "്ര" },
+  { 0x23, "ൿ" },
+  { 0x24, "ക്ഷ" },
+  { 0x25, "ൾ" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "ഃ" },
+  { 0x2E, "ഋ" },
+  { 0x2F, "ഢ" },
+  { 0x30, "ഞ" },
+  { 0x33, "ഛ" },
+  { 0x34, "ഠ" },
+  { 0x35, "ഒ" },
+  { 0x36, "ഷ" },
+  { 0x37, "ൽ" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_118_LAYER_2_ENTRIES[] = {
+  { 0x14, "ൗ" },
+  { 0x1E, "൧" },
+  { 0x1F, "൨" },
+  { 0x20, "൩" },
+  { 0x21, "൪" },
+  { 0x22, "൫" },
+  { 0x23, "൬" },
+  { 0x24, "൭" },
+  { 0x25, "൮" },
+  { 0x26, "൯" },
+  { 0x27, "൦" },
+};
+
+const wa_keyboard_mapping LAYOUT_118_LAYER_3_ENTRIES[] = {
+  { 0x07, "ഌ" },
+  { 0x15, "ൡ" },
+  { 0x19, "൹" },
+  { 0x1E, "൰" },
+  { 0x1F, "൱" },
+  { 0x20, "൲" },
+  { 0x2E, "ൠ" },
+};
+
+const wa_keyboard_mapping LAYOUT_118_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+};
+
+const wa_keyboard_layer LAYOUT_118_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_118_LAYER_0_ENTRIES, 51u,
+  },
+  {
+    "shift",
+    LAYOUT_118_LAYER_1_ENTRIES, 46u,
+  },
+  {
+    "altgr",
+    LAYOUT_118_LAYER_2_ENTRIES, 11u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_118_LAYER_3_ENTRIES, 7u,
+  },
+  {
+    "ctrl",
+    LAYOUT_118_LAYER_4_ENTRIES, 1u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_119_LAYER_0_ENTRIES[] = {
+  { 0x04, "й" },
+  { 0x05, "м" },
+  { 0x06, "ё" },
+  { 0x07, "б" },
+  { 0x08, "у" },
+  { 0x09, "ө" },
+  { 0x0A, "а" },
+  { 0x0B, "х" },
+  { 0x0C, "ш" },
+  { 0x0D, "р" },
+  { 0x0E, "о" },
+  { 0x0F, "л" },
+  { 0x10, "т" },
+  { 0x11, "и" },
+  { 0x12, "ү" },
+  { 0x13, "з" },
+  { 0x14, "ф" },
+  { 0x15, "ж" },
+  { 0x16, "ы" },
+  { 0x17, "э" },
+  { 0x18, "г" },
+  { 0x19, "с" },
+  { 0x1A, "ц" },
+  { 0x1B, "ч" },
+  { 0x1C, "н" },
+  { 0x1D, "я" },
+  { 0x1E, "№" },
+  { 0x1F, "-" },
+  { 0x20, "\"" },
+  { 0x21, "₮" },
+  { 0x22, ":" },
+  { 0x23, "." },
+  { 0x24, "_" },
+  { 0x25, "," },
+  { 0x26, "%" },
+  { 0x27, "?" },
+  { 0x2C, " " },
+  { 0x2D, "е" },
+  { 0x2E, "щ" },
+  { 0x2F, "к" },
+  { 0x30, "ъ" },
+  { 0x31, "\\" },
+  { 0x33, "д" },
+  { 0x34, "п" },
+  { 0x35, "=" },
+  { 0x36, "ь" },
+  { 0x37, "в" },
+  { 0x38, "ю" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_119_LAYER_1_ENTRIES[] = {
+  { 0x04, "Й" },
+  { 0x05, "М" },
+  { 0x06, "Ё" },
+  { 0x07, "Б" },
+  { 0x08, "У" },
+  { 0x09, "Ө" },
+  { 0x0A, "А" },
+  { 0x0B, "Х" },
+  { 0x0C, "Ш" },
+  { 0x0D, "Р" },
+  { 0x0E, "О" },
+  { 0x0F, "Л" },
+  { 0x10, "Т" },
+  { 0x11, "И" },
+  { 0x12, "Ү" },
+  { 0x13, "З" },
+  { 0x14, "Ф" },
+  { 0x15, "Ж" },
+  { 0x16, "Ы" },
+  { 0x17, "Э" },
+  { 0x18, "Г" },
+  { 0x19, "С" },
+  { 0x1A, "Ц" },
+  { 0x1B, "Ч" },
+  { 0x1C, "Н" },
+  { 0x1D, "Я" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "Е" },
+  { 0x2E, "Щ" },
+  { 0x2F, "К" },
+  { 0x30, "Ъ" },
+  { 0x31, "|" },
+  { 0x33, "Д" },
+  { 0x34, "П" },
+  { 0x35, "+" },
+  { 0x36, "Ь" },
+  { 0x37, "В" },
+  { 0x38, "Ю" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_119_LAYER_2_ENTRIES[] = {
+  { 0x04, "Й" },
+  { 0x05, "М" },
+  { 0x06, "Ё" },
+  { 0x07, "Б" },
+  { 0x08, "У" },
+  { 0x09, "Ө" },
+  { 0x0A, "А" },
+  { 0x0B, "Х" },
+  { 0x0C, "Ш" },
+  { 0x0D, "Р" },
+  { 0x0E, "О" },
+  { 0x0F, "Л" },
+  { 0x10, "Т" },
+  { 0x11, "И" },
+  { 0x12, "Ү" },
+  { 0x13, "З" },
+  { 0x14, "Ф" },
+  { 0x15, "Ж" },
+  { 0x16, "Ы" },
+  { 0x17, "Э" },
+  { 0x18, "Г" },
+  { 0x19, "С" },
+  { 0x1A, "Ц" },
+  { 0x1B, "Ч" },
+  { 0x1C, "Н" },
+  { 0x1D, "Я" },
+  { 0x2D, "Е" },
+  { 0x2E, "Щ" },
+  { 0x2F, "К" },
+  { 0x30, "Ъ" },
+  { 0x33, "Д" },
+  { 0x34, "П" },
+  { 0x36, "Ь" },
+  { 0x37, "В" },
+  { 0x38, "Ю" },
+};
+
+const wa_keyboard_mapping LAYOUT_119_LAYER_3_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_119_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_119_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_119_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_119_LAYER_2_ENTRIES, 35u,
+  },
+  {
+    "ctrl",
+    LAYOUT_119_LAYER_3_ENTRIES, 2u,
+  },
+};
+
@@ -0,0 +1,7713 @@
+#include "worldalphabets_data.h"
+
+const wa_keyboard_mapping LAYOUT_120_LAYER_0_ENTRIES[] = {
+  { 0x04, "ᠠ" },
+  { 0x05, "ᠪ" },
+  { 0x06, "ᠼ" },
+  { 0x07, "ᠳ" },
+  { 0x08, "ᠡ" },
+  { 0x09, "ᠹ" },
+  { 0x0A, "ᠭ" },
+  { 0x0B, "ᠬ" },
+  { 0x0C, "ᠢ" },
+  { 0x0D, "ᠵ" },
+  { 0x0E, "ᠺ" },
+  { 0x0F, "ᠯ" },
+  { 0x10, "ᠮ" },
+  { 0x11, "ᠨ" },
+  { 0x12, "ᠥ" },
+  { 0x13, "ᠫ" },
+  { 0x14, "ᠴ" },
+  { 0x15, "ᠷ" },
+  { 0x16, "ᠰ" },
+  { 0x17, "ᠲ" },
+  { 0x18, "ᠦ" },
+  { 0x19, "ᠤ" },
+  { 0x1A, "ᠣ" },
+  { 0x1B, "ᠱ" },
+  { 0x1C, "ᠶ" },
+  { 0x1D, "ᠽ" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, " " },
+  { 0x2E, "=" },
+  { 0x2F, "〔" },
+  { 0x30, "〕" },
+  { 0x31, "᠁" },
+  { 0x33, ";" },
+  { 0x34, "᠋" },
+  { 0x35, "᠍" },
+  { 0x36, "᠂" },
+  { 0x37, "᠃" },
+  { 0x38, "." },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_120_LAYER_1_ENTRIES[] = {
+  { 0x06, "ᡂ" },
+  { 0x08, "ᠧ" },
+  { 0x0B, "ᠾ" },
+  { 0x0E, "ᠻ" },
+  { 0x0F, "ᡀ" },
+  { 0x11, "ᠩ" },
+  { 0x15, "ᠿ" },
+  { 0x1A, "ᠸ" },
+  { 0x1D, "ᡁ" },
+  { 0x1E, "!" },
+  { 0x1F, "⁈" },
+  { 0x20, "⁉" },
+  { 0x21, "—" },
+  { 0x22, "%" },
+  { 0x23, "‌" },
+  { 0x24, "᠊" },
+  { 0x25, "‍" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "᠎" },
+  { 0x2E, "+" },
+  { 0x2F, "〈" },
+  { 0x30, "〉" },
+  { 0x31, "|" },
+  { 0x33, "᠄" },
+  { 0x34, "᠌" },
+  { 0x35, "~" },
+  { 0x36, "《" },
+  { 0x37, "》" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_120_LAYER_2_ENTRIES[] = {
+  { 0x06, "ᡂ" },
+  { 0x08, "ᠧ" },
+  { 0x0B, "ᠾ" },
+  { 0x0F, "ᡀ" },
+  { 0x11, "ᠩ" },
+  { 0x15, "ᠿ" },
+  { 0x1A, "ᠸ" },
+  { 0x1D, "ᡁ" },
+  { 0x2F, "〈" },
+  { 0x31, "|" },
+  { 0x33, "᠄" },
+  { 0x34, "᠌" },
+  { 0x36, "《" },
+  { 0x37, "》" },
+  { 0x38, "?" },
+};
+
+const wa_keyboard_mapping LAYOUT_120_LAYER_3_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_120_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_120_LAYER_0_ENTRIES, 52u,
+  },
+  {
+    "shift",
+    LAYOUT_120_LAYER_1_ENTRIES, 35u,
+  },
+  {
+    "caps",
+    LAYOUT_120_LAYER_2_ENTRIES, 15u,
+  },
+  {
+    "ctrl",
+    LAYOUT_120_LAYER_3_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_121_LAYER_0_ENTRIES[] = {
+  { 0x04, "ᠠ" },
+  { 0x05, "ᠪ" },
+  { 0x06, "ᠴ" },
+  { 0x07, "ᠳ" },
+  { 0x08, "ᠡ" },
+  { 0x09, "ᠹ" },
+  { 0x0A, "ᠭ" },
+  { 0x0B, "ᠬ" },
+  { 0x0C, "ᠢ" },
+  { 0x0D, "ᠵ" },
+  { 0x0E, "ᠻ" },
+  { 0x0F, "ᠯ" },
+  { 0x10, "ᠮ" },
+  { 0x11, "ᠨ" },
+  { 0x12, "ᠣ" },
+  { 0x13, "ᠫ" },
+  { 0x14, "ᠥ" },
+  { 0x15, "ᠷ" },
+  { 0x16, "ᠰ" },
+  { 0x17, "ᠲ" },
+  { 0x18, "ᠤ" },
+  { 0x19, "ᠸ" },
+  { 0x1A, "ᠦ" },
+  { 0x1B, "ᠱ" },
+  { 0x1C, "ᠶ" },
+  { 0x1D, "ᠽ" },
+  { 0x1E, "᠑" },
+  { 0x1F, "᠒" },
+  { 0x20, "᠓" },
+  { 0x21, "᠔" },
+  { 0x22, "᠕" },
+  { 0x23, "᠖" },
+  { 0x24, "᠗" },
+  { 0x25, "᠘" },
+  { 0x26, "᠙" },
+  { 0x27, "᠐" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "᠊" },
+  { 0x33, "᠋" },
+  { 0x34, "᠌" },
+  { 0x35, "᠀" },
+  { 0x36, "᠂" },
+  { 0x37, "᠃" },
+  { 0x38, "᠎" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_121_LAYER_1_ENTRIES[] = {
+  { 0x06, "ᠼ" },
+  { 0x08, "ᠧ" },
+  { 0x09, "᠍" },
+  { 0x0A, "᠏" },
+  { 0x0B, "ᠾ" },
+  { 0x0C, ">" },
+  { 0x0D, "ᠿ" },
+  { 0x0E, "ᠺ" },
+  { 0x0F, "ᡀ" },
+  { 0x11, "ᠩ" },
+  { 0x12, "«" },
+  { 0x13, "»" },
+  { 0x15, "‌" },
+  { 0x16, "ᡂ" },
+  { 0x17, "‍" },
+  { 0x18, "<" },
+  { 0x1D, "ᡁ" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "₮" },
+  { 0x24, "/" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, " " },
+  { 0x33, ":" },
+  { 0x34, "“" },
+  { 0x35, "~" },
+  { 0x36, "᠁" },
+  { 0x37, "᠅" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_121_LAYER_2_ENTRIES[] = {
+  { 0x06, "ᠼ" },
+  { 0x08, "ᠧ" },
+  { 0x09, "᠍" },
+  { 0x0A, "᠏" },
+  { 0x0B, "ᠾ" },
+  { 0x0C, ">" },
+  { 0x0D, "ᠿ" },
+  { 0x0E, "ᠺ" },
+  { 0x0F, "ᡀ" },
+  { 0x11, "ᠩ" },
+  { 0x12, "«" },
+  { 0x13, "»" },
+  { 0x15, "‌" },
+  { 0x16, "ᡂ" },
+  { 0x17, "‍" },
+  { 0x18, "<" },
+  { 0x1D, "ᡁ" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "₮" },
+  { 0x24, "/" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, " " },
+  { 0x33, ":" },
+  { 0x34, "“" },
+  { 0x35, "~" },
+  { 0x36, "᠁" },
+  { 0x37, "᠅" },
+  { 0x38, "?" },
+};
+
+const wa_keyboard_mapping LAYOUT_121_LAYER_3_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_121_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_121_LAYER_0_ENTRIES, 52u,
+  },
+  {
+    "shift",
+    LAYOUT_121_LAYER_1_ENTRIES, 43u,
+  },
+  {
+    "caps",
+    LAYOUT_121_LAYER_2_ENTRIES, 39u,
+  },
+  {
+    "ctrl",
+    LAYOUT_121_LAYER_3_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_122_LAYER_0_ENTRIES[] = {
+  { 0x04, "ᠠ" },
+  { 0x05, "ᠪ" },
+  { 0x06, "ᠴ" },
+  { 0x07, "ᠳ" },
+  { 0x08, "ᠡ" },
+  { 0x09, "ᠹ" },
+  { 0x0A, "ᠭ" },
+  { 0x0B, "ᠬ" },
+  { 0x0C, "ᠢ" },
+  { 0x0D, "ᠵ" },
+  { 0x0E, "ᠺ" },
+  { 0x0F, "ᠯ" },
+  { 0x10, "ᠮ" },
+  { 0x11, "ᠨ" },
+  { 0x12, "ᠥ" },
+  { 0x13, "ᠫ" },
+  { 0x14, "ᠣ" },
+  { 0x15, "ᠷ" },
+  { 0x16, "ᠰ" },
+  { 0x17, "ᠲ" },
+  { 0x18, "ᠦ" },
+  { 0x19, "ᠤ" },
+  { 0x1A, "ᠸ" },
+  { 0x1B, "ᠱ" },
+  { 0x1C, "ᠶ" },
+  { 0x1D, "ᠽ" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, " " },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "᠁" },
+  { 0x33, "︔" },
+  { 0x34, "᠋" },
+  { 0x35, "᠍" },
+  { 0x36, "᠂" },
+  { 0x37, "᠃" },
+  { 0x38, "·" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_122_LAYER_1_ENTRIES[] = {
+  { 0x06, "ᠼ" },
+  { 0x08, "ᠧ" },
+  { 0x0B, "ᠾ" },
+  { 0x0E, "ᠻ" },
+  { 0x0F, "ᡀ" },
+  { 0x11, "ᠩ" },
+  { 0x14, "ᡂ" },
+  { 0x15, "ᠿ" },
+  { 0x1D, "ᡁ" },
+  { 0x1E, "︕" },
+  { 0x1F, "⁈" },
+  { 0x20, "⁉" },
+  { 0x22, "%" },
+  { 0x23, "‌" },
+  { 0x24, "᠊" },
+  { 0x25, "‍" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "᠎" },
+  { 0x2E, "+" },
+  { 0x2F, "〈" },
+  { 0x30, "〉" },
+  { 0x31, "︱" },
+  { 0x33, "᠄" },
+  { 0x34, "᠌" },
+  { 0x35, "~" },
+  { 0x36, "《" },
+  { 0x37, "》" },
+  { 0x38, "︖" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_122_LAYER_2_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_122_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_122_LAYER_0_ENTRIES, 52u,
+  },
+  {
+    "shift",
+    LAYOUT_122_LAYER_1_ENTRIES, 34u,
+  },
+  {
+    "ctrl",
+    LAYOUT_122_LAYER_2_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_123_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "z" },
+  { 0x1D, "y" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "+" },
+  { 0x2E, "'" },
+  { 0x2F, "ă" },
+  { 0x30, "î" },
+  { 0x31, "â" },
+  { 0x33, "ş" },
+  { 0x34, "ţ" },
+  { 0x35, "]" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "-" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "<" },
+};
+
+const wa_keyboard_mapping LAYOUT_123_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Z" },
+  { 0x1D, "Y" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "#" },
+  { 0x21, "¤" },
+  { 0x22, "%" },
+  { 0x23, "&" },
+  { 0x24, "/" },
+  { 0x25, "(" },
+  { 0x26, ")" },
+  { 0x27, "=" },
+  { 0x2C, " " },
+  { 0x2D, "?" },
+  { 0x2E, "*" },
+  { 0x2F, "Ă" },
+  { 0x30, "Î" },
+  { 0x31, "Â" },
+  { 0x33, "Ş" },
+  { 0x34, "Ţ" },
+  { 0x35, "[" },
+  { 0x36, ";" },
+  { 0x37, ":" },
+  { 0x38, "_" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_123_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Z" },
+  { 0x1D, "Y" },
+  { 0x2F, "Ă" },
+  { 0x30, "Î" },
+  { 0x31, "Â" },
+  { 0x33, "Ş" },
+  { 0x34, "Ţ" },
+};
+
+const wa_keyboard_mapping LAYOUT_123_LAYER_3_ENTRIES[] = {
+  { 0x05, "{" },
+  { 0x07, "Đ" },
+  { 0x0E, "ł" },
+  { 0x0F, "Ł" },
+  { 0x10, "§" },
+  { 0x11, "}" },
+  { 0x14, "\\" },
+  { 0x16, "đ" },
+  { 0x19, "@" },
+  { 0x1A, "|" },
+  { 0x1E, "~" },
+  { 0x1F, "ˇ" },
+  { 0x20, "^" },
+  { 0x21, "˘" },
+  { 0x22, "°" },
+  { 0x23, "˛" },
+  { 0x24, "`" },
+  { 0x25, "·" },
+  { 0x26, "´" },
+  { 0x27, "˝" },
+  { 0x2C, " " },
+  { 0x2D, "¨" },
+  { 0x2E, "¸" },
+  { 0x2F, "÷" },
+  { 0x30, "×" },
+  { 0x33, "$" },
+  { 0x34, "ß" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_123_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_123_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_123_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_123_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_123_LAYER_2_ENTRIES, 31u,
+  },
+  {
+    "altgr",
+    LAYOUT_123_LAYER_3_ENTRIES, 29u,
+  },
+  {
+    "ctrl",
+    LAYOUT_123_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_124_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x35, "`" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_124_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_124_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+};
+
+const wa_keyboard_mapping LAYOUT_124_LAYER_3_ENTRIES[] = {
+  { 0x04, "ă" },
+  { 0x06, "©" },
+  { 0x07, "đ" },
+  { 0x08, "€" },
+  { 0x0C, "î" },
+  { 0x0F, "ł" },
+  { 0x13, "§" },
+  { 0x14, "â" },
+  { 0x16, "ș" },
+  { 0x17, "ț" },
+  { 0x1A, "ß" },
+  { 0x1E, "~" },
+  { 0x1F, "ˇ" },
+  { 0x20, "^" },
+  { 0x21, "˘" },
+  { 0x22, "°" },
+  { 0x23, "˛" },
+  { 0x24, "`" },
+  { 0x25, "˙" },
+  { 0x26, "´" },
+  { 0x27, "˝" },
+  { 0x2D, "¨" },
+  { 0x2E, "¸" },
+  { 0x2F, "„" },
+  { 0x30, "”" },
+  { 0x36, "«" },
+  { 0x37, "»" },
+};
+
+const wa_keyboard_mapping LAYOUT_124_LAYER_4_ENTRIES[] = {
+  { 0x04, "Ă" },
+  { 0x07, "Đ" },
+  { 0x0C, "Î" },
+  { 0x0F, "Ł" },
+  { 0x14, "Â" },
+  { 0x16, "Ș" },
+  { 0x17, "Ț" },
+  { 0x2D, "–" },
+  { 0x2E, "±" },
+};
+
+const wa_keyboard_mapping LAYOUT_124_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_124_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_124_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_124_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_124_LAYER_2_ENTRIES, 26u,
+  },
+  {
+    "altgr",
+    LAYOUT_124_LAYER_3_ENTRIES, 27u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_124_LAYER_4_ENTRIES, 9u,
+  },
+  {
+    "ctrl",
+    LAYOUT_124_LAYER_5_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_125_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "ă" },
+  { 0x30, "î" },
+  { 0x31, "â" },
+  { 0x33, "ș" },
+  { 0x34, "ț" },
+  { 0x35, "„" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_125_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "Ă" },
+  { 0x30, "Î" },
+  { 0x31, "Â" },
+  { 0x33, "Ș" },
+  { 0x34, "Ț" },
+  { 0x35, "”" },
+  { 0x36, ";" },
+  { 0x37, ":" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_125_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x2F, "Ă" },
+  { 0x30, "Î" },
+  { 0x31, "Â" },
+  { 0x33, "Ș" },
+  { 0x34, "Ț" },
+};
+
+const wa_keyboard_mapping LAYOUT_125_LAYER_3_ENTRIES[] = {
+  { 0x06, "©" },
+  { 0x07, "đ" },
+  { 0x08, "€" },
+  { 0x0F, "ł" },
+  { 0x13, "§" },
+  { 0x16, "ß" },
+  { 0x1E, "~" },
+  { 0x1F, "ˇ" },
+  { 0x20, "^" },
+  { 0x21, "˘" },
+  { 0x22, "°" },
+  { 0x23, "˛" },
+  { 0x24, "`" },
+  { 0x25, "˙" },
+  { 0x26, "´" },
+  { 0x27, "˝" },
+  { 0x2D, "¨" },
+  { 0x2E, "¸" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x35, "`" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_125_LAYER_4_ENTRIES[] = {
+  { 0x07, "Đ" },
+  { 0x0F, "Ł" },
+  { 0x2D, "–" },
+  { 0x2E, "±" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x36, "«" },
+  { 0x37, "»" },
+};
+
+const wa_keyboard_mapping LAYOUT_125_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_125_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_125_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_125_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_125_LAYER_2_ENTRIES, 31u,
+  },
+  {
+    "altgr",
+    LAYOUT_125_LAYER_3_ENTRIES, 26u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_125_LAYER_4_ENTRIES, 12u,
+  },
+  {
+    "ctrl",
+    LAYOUT_125_LAYER_5_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_126_LAYER_0_ENTRIES[] = {
+  { 0x04, "ो" },
+  { 0x05, "व" },
+  { 0x06, "म" },
+  { 0x07, "्" },
+  { 0x08, "ा" },
+  { 0x09, "ि" },
+  { 0x0A, "ु" },
+  { 0x0B, "प" },
+  { 0x0C, "ग" },
+  { 0x0D, "र" },
+  { 0x0E, "क" },
+  { 0x0F, "त" },
+  { 0x10, "स" },
+  { 0x11, "ल" },
+  { 0x12, "द" },
+  { 0x13, "ज" },
+  { 0x14, "ौ" },
+  { 0x15, "ी" },
+  { 0x16, "े" },
+  { 0x17, "ू" },
+  { 0x18, "ह" },
+  { 0x19, "न" },
+  { 0x1A, "ै" },
+  { 0x1B, "ं" },
+  { 0x1C, "ब" },
+  { 0x1E, "१" },
+  { 0x1F, "२" },
+  { 0x20, "३" },
+  { 0x21, "४" },
+  { 0x22, "५" },
+  { 0x23, "६" },
+  { 0x24, "७" },
+  { 0x25, "८" },
+  { 0x26, "९" },
+  { 0x27, "०" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "ृ" },
+  { 0x2F, "ड" },
+  { 0x30, "़" },
+  { 0x31, "ॉ" },
+  { 0x33, "च" },
+  { 0x34, "ट" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "य" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "ॉ" },
+};
+
+const wa_keyboard_mapping LAYOUT_126_LAYER_1_ENTRIES[] = {
+  { 0x04, "ओ" },
+  { 0x06, "ण" },
+  { 0x07, "अ" },
+  { 0x08, "आ" },
+  { 0x09, "इ" },
+  { 0x0A, "उ" },
+  { 0x0B, "फ" },
+  { 0x0C, "घ" },
+  { 0x0D, "ऱ" },
+  { 0x0E, "ख" },
+  { 0x0F, "थ" },
+  { 0x10, "श" },
+  { 0x11, "ळ" },
+  { 0x12, "ध" },
+  { 0x13, "झ" },
+  { 0x14, "औ" },
+  { 0x15, "ई" },
+  { 0x16, "ए" },
+  { 0x17, "ऊ" },
+  { 0x18, "ङ" },
+  { 0x1A, "ऐ" },
+  { 0x1B, "ँ" },
+  { 0x1C, "भ" },
+  { 0x1E, "ऍ" },
+  { 0x1F, "ॅ" },
+  { 0x20, "्र" },
+  { 0x21, "र्" },
+  { 0x22, "ज्ञ" },
+  { 0x23, "त्र" },
+  { 0x24, "क्ष" },
+  { 0x25, "श्र" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "ः" },
+  { 0x2E, "ऋ" },
+  { 0x2F, "ढ" },
+  { 0x30, "ञ" },
+  { 0x31, "ऑ" },
+  { 0x33, "छ" },
+  { 0x34, "ठ" },
+  { 0x36, "ष" },
+  { 0x37, "।" },
+  { 0x38, "य़" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "ऑ" },
+};
+
+const wa_keyboard_mapping LAYOUT_126_LAYER_2_ENTRIES[] = {
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x35, "`" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+};
+
+const wa_keyboard_mapping LAYOUT_126_LAYER_3_ENTRIES[] = {
+  { 0x1B, "ॐ" },
+  { 0x1D, "ऽ" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "?" },
+};
+
+const wa_keyboard_mapping LAYOUT_126_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_126_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_126_LAYER_0_ENTRIES, 51u,
+  },
+  {
+    "shift",
+    LAYOUT_126_LAYER_1_ENTRIES, 49u,
+  },
+  {
+    "altgr",
+    LAYOUT_126_LAYER_2_ENTRIES, 21u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_126_LAYER_3_ENTRIES, 23u,
+  },
+  {
+    "ctrl",
+    LAYOUT_126_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_127_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "ġ" },
+  { 0x30, "ħ" },
+  { 0x31, "ż" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x35, "ċ" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_127_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "€" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "Ġ" },
+  { 0x30, "Ħ" },
+  { 0x31, "Ż" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "Ċ" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_127_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x2F, "Ġ" },
+  { 0x30, "Ħ" },
+  { 0x31, "Ż" },
+  { 0x35, "Ċ" },
+};
+
+const wa_keyboard_mapping LAYOUT_127_LAYER_3_ENTRIES[] = {
+  { 0x04, "à" },
+  { 0x08, "è" },
+  { 0x0C, "ì" },
+  { 0x12, "ò" },
+  { 0x18, "ù" },
+  { 0x20, "£" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x35, "`" },
+};
+
+const wa_keyboard_mapping LAYOUT_127_LAYER_4_ENTRIES[] = {
+  { 0x04, "À" },
+  { 0x08, "È" },
+  { 0x0C, "Ì" },
+  { 0x12, "Ò" },
+  { 0x18, "Ù" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "|" },
+  { 0x35, "~" },
+};
+
+const wa_keyboard_mapping LAYOUT_127_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+};
+
+const wa_keyboard_layer LAYOUT_127_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_127_LAYER_0_ENTRIES, 52u,
+  },
+  {
+    "shift",
+    LAYOUT_127_LAYER_1_ENTRIES, 52u,
+  },
+  {
+    "caps",
+    LAYOUT_127_LAYER_2_ENTRIES, 30u,
+  },
+  {
+    "altgr",
+    LAYOUT_127_LAYER_3_ENTRIES, 10u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_127_LAYER_4_ENTRIES, 9u,
+  },
+  {
+    "ctrl",
+    LAYOUT_127_LAYER_5_ENTRIES, 1u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_128_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "ġ" },
+  { 0x30, "ħ" },
+  { 0x31, "#" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x35, "ċ" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "ż" },
+};
+
+const wa_keyboard_mapping LAYOUT_128_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "€" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "Ġ" },
+  { 0x30, "Ħ" },
+  { 0x31, "~" },
+  { 0x33, ":" },
+  { 0x34, "@" },
+  { 0x35, "Ċ" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "Ż" },
+};
+
+const wa_keyboard_mapping LAYOUT_128_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x2F, "Ġ" },
+  { 0x30, "Ħ" },
+  { 0x35, "Ċ" },
+  { 0x64, "Ż" },
+};
+
+const wa_keyboard_mapping LAYOUT_128_LAYER_3_ENTRIES[] = {
+  { 0x04, "à" },
+  { 0x08, "è" },
+  { 0x0C, "ì" },
+  { 0x12, "ò" },
+  { 0x18, "ù" },
+  { 0x20, "£" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x35, "`" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_128_LAYER_4_ENTRIES[] = {
+  { 0x04, "À" },
+  { 0x08, "È" },
+  { 0x0C, "Ì" },
+  { 0x12, "Ò" },
+  { 0x18, "Ù" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x35, "¬" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_128_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_128_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_128_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_128_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_128_LAYER_2_ENTRIES, 30u,
+  },
+  {
+    "altgr",
+    LAYOUT_128_LAYER_3_ENTRIES, 10u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_128_LAYER_4_ENTRIES, 9u,
+  },
+  {
+    "ctrl",
+    LAYOUT_128_LAYER_5_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_129_LAYER_0_ENTRIES[] = {
+  { 0x04, "ေ" },
+  { 0x05, "ဘ" },
+  { 0x06, "ခ" },
+  { 0x07, "ိ" },
+  { 0x08, "န" },
+  { 0x09, "်" },
+  { 0x0A, "ါ" },
+  { 0x0B, "့" },
+  { 0x0C, "င" },
+  { 0x0D, "ြ" },
+  { 0x0E, "ု" },
+  { 0x0F, "ူ" },
+  { 0x10, "ာ" },
+  { 0x11, "ည" },
+  { 0x12, "သ" },
+  { 0x13, "စ" },
+  { 0x14, "ဆ" },
+  { 0x15, "မ" },
+  { 0x16, "ျ" },
+  { 0x17, "အ" },
+  { 0x18, "က" },
+  { 0x19, "လ" },
+  { 0x1A, "တ" },
+  { 0x1B, "ထ" },
+  { 0x1C, "ပ" },
+  { 0x1D, "ဖ" },
+  { 0x1E, "၁" },
+  { 0x1F, "၂" },
+  { 0x20, "၃" },
+  { 0x21, "၄" },
+  { 0x22, "၅" },
+  { 0x23, "၆" },
+  { 0x24, "၇" },
+  { 0x25, "၈" },
+  { 0x26, "၉" },
+  { 0x27, "၀" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "ဟ" },
+  { 0x30, "ဩ" },
+  { 0x31, "၏" },
+  { 0x33, "း" },
+  { 0x34, "'" },
+  { 0x35, "ၐ" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "၏" },
+};
+
+const wa_keyboard_mapping LAYOUT_129_LAYER_1_ENTRIES[] = {
+  { 0x04, "ဗ" },
+  { 0x05, "ယ" },
+  { 0x06, "ဃ" },
+  { 0x07, "ီ" },
+  { 0x08, "ဣ" },
+  { 0x09, "္" },
+  { 0x0A, "ွ" },
+  { 0x0B, "ံ" },
+  { 0x0C, "၍" },
+  { 0x0D, "ဲ" },
+  { 0x0E, "ဒ" },
+  { 0x0F, "ဓ" },
+  { 0x10, "ဦ" },
+  { 0x11, "ဉ" },
+  { 0x12, "ဿ" },
+  { 0x13, "ဏ" },
+  { 0x14, "ဈ" },
+  { 0x15, "၎" },
+  { 0x16, "ှ" },
+  { 0x17, "ဤ" },
+  { 0x18, "ဥ" },
+  { 0x19, "ဠ" },
+  { 0x1A, "ဝ" },
+  { 0x1B, "ဌ" },
+  { 0x1C, "၌" },
+  { 0x1D, "ဇ" },
+  { 0x1E, "ဍ" },
+  { 0x1F, "ၒ" },
+  { 0x20, "ဋ" },
+  { 0x21, "ၓ" },
+  { 0x22, "ၔ" },
+  { 0x23, "ၕ" },
+  { 0x24, "ရ" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "ဧ" },
+  { 0x30, "ဪ" },
+  { 0x31, "ၑ" },
+  { 0x33, "ဂ" },
+  { 0x34, "\"" },
+  { 0x35, "ဎ" },
+  { 0x36, "၊" },
+  { 0x37, "။" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "ၑ" },
+};
+
+const wa_keyboard_mapping LAYOUT_129_LAYER_2_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x35, "`" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_129_LAYER_3_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "?" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_129_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+};
+
+const wa_keyboard_layer LAYOUT_129_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_129_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_129_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "altgr",
+    LAYOUT_129_LAYER_2_ENTRIES, 49u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_129_LAYER_3_ENTRIES, 49u,
+  },
+  {
+    "ctrl",
+    LAYOUT_129_LAYER_4_ENTRIES, 1u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_130_LAYER_0_ENTRIES[] = {
+  { 0x04, "ေ" },
+  { 0x05, "ဘ" },
+  { 0x06, "ခ" },
+  { 0x07, "ိ" },
+  { 0x08, "န" },
+  { 0x09, "်" },
+  { 0x0A, "ါ" },
+  { 0x0B, "့" },
+  { 0x0C, "င" },
+  { 0x0D, "ြ" },
+  { 0x0E, "ု" },
+  { 0x0F, "ူ" },
+  { 0x10, "ာ" },
+  { 0x11, "ည" },
+  { 0x12, "သ" },
+  { 0x13, "စ" },
+  { 0x14, "ဆ" },
+  { 0x15, "မ" },
+  { 0x16, "ျ" },
+  { 0x17, "အ" },
+  { 0x18, "က" },
+  { 0x19, "လ" },
+  { 0x1A, "တ" },
+  { 0x1B, "ထ" },
+  { 0x1C, "ပ" },
+  { 0x1D, "ဖ" },
+  { 0x1E, "၁" },
+  { 0x1F, "၂" },
+  { 0x20, "၃" },
+  { 0x21, "၄" },
+  { 0x22, "၅" },
+  { 0x23, "၆" },
+  { 0x24, "၇" },
+  { 0x25, "၈" },
+  { 0x26, "၉" },
+  { 0x27, "၀" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "ဟ" },
+  { 0x30, "ဩ" },
+  { 0x31, "၏" },
+  { 0x33, "း" },
+  { 0x34, "'" },
+  { 0x35, "ၐ" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "၏" },
+};
+
+const wa_keyboard_mapping LAYOUT_130_LAYER_1_ENTRIES[] = {
+  { 0x04, "ဗ" },
+  { 0x05, "ယ" },
+  { 0x06, "ဃ" },
+  { 0x07, "ီ" },
+  { 0x08, "ဣ" },
+  { 0x09, "္" },
+  { 0x0A, "ွ" },
+  { 0x0B, "ံ" },
+  { 0x0C, "၍" },
+  { 0x0D, "ဲ" },
+  { 0x0E, "ဒ" },
+  { 0x0F, "ဓ" },
+  { 0x10, "ဦ" },
+  { 0x11, "ဉ" },
+  { 0x12, "ဿ" },
+  { 0x13, "ဏ" },
+  { 0x14, "ဈ" },
+  { 0x15, "၎" },
+  { 0x16, "ှ" },
+  { 0x17, "ဤ" },
+  { 0x18, "ဥ" },
+  { 0x19, "ဠ" },
+  { 0x1A, "ဝ" },
+  { 0x1B, "ဌ" },
+  { 0x1C, "၌" },
+  { 0x1D, "ဇ" },
+  { 0x1E, "ဍ" },
+  { 0x1F, "ၒ" },
+  { 0x20, "ဋ" },
+  { 0x21, "ၓ" },
+  { 0x22, "ၔ" },
+  { 0x23, "ၕ" },
+  { 0x24, "ရ" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "ဧ" },
+  { 0x30, "ဪ" },
+  { 0x31, "ၑ" },
+  { 0x33, "ဂ" },
+  { 0x34, "\"" },
+  { 0x35, "ဎ" },
+  { 0x36, "၊" },
+  { 0x37, "။" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "ၑ" },
+};
+
+const wa_keyboard_mapping LAYOUT_130_LAYER_2_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x35, "`" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_130_LAYER_3_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "?" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_130_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+};
+
+const wa_keyboard_layer LAYOUT_130_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_130_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_130_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "altgr",
+    LAYOUT_130_LAYER_2_ENTRIES, 49u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_130_LAYER_3_ENTRIES, 49u,
+  },
+  {
+    "ctrl",
+    LAYOUT_130_LAYER_4_ENTRIES, 1u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_131_LAYER_0_ENTRIES[] = {
+  { 0x04, "ब" },
+  { 0x05, "द" },
+  { 0x06, "अ" },
+  { 0x07, "म" },
+  { 0x08, "भ" },
+  { 0x09, "ा" },
+  { 0x0A, "न" },
+  { 0x0B, "ज" },
+  { 0x0C, "ष" },
+  { 0x0D, "व" },
+  { 0x0E, "प" },
+  { 0x0F, "ि" },
+  { 0x10, "फ" },
+  { 0x11, "ल" },
+  { 0x12, "य" },
+  { 0x13, "उ" },
+  { 0x14, "त्र" },
+  { 0x15, "च" },
+  { 0x16, "क" },
+  { 0x17, "त" },
+  { 0x18, "ग" },
+  { 0x19, "ख" },
+  { 0x1A, "ध" },
+  { 0x1B, "ह" },
+  { 0x1C, "थ" },
+  { 0x1D, "श" },
+  { 0x1E, "ज्ञ" },
+  { 0x1F, "घ" },
+  { 0x20, "ङ" },
+  { 0x21, "झ" },
+  { 0x22, "छ" },
+  { 0x23, "ट" },
+  { 0x24, "ठ" },
+  { 0x25, "ड" },
+  { 0x26, "ढ" },
+  { 0x27, "ण" },
+  { 0x2C, " " },
+  { 0x2D, "(" },
+  { 0x2E, "." },
+  { 0x2F, "ृ" },
+  { 0x30, "े" },
+  { 0x31, "्र" },
+  { 0x33, "स" },
+  { 0x34, "ु" },
+  { 0x35, "ञ" },
+  { 0x36, "," },
+  { 0x37, "।" },
+  { 0x38, "र" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_131_LAYER_1_ENTRIES[] = {
+  { 0x04, "ब्" },
+  { 0x05, "द्" },
+  { 0x06, "ऋ" },
+  { 0x07, "म्" },
+  { 0x08, "भ्" },
+  { 0x09, "ँ" },
+  { 0x0A, "न्" },
+  { 0x0B, "ज्" },
+  { 0x0C, "क्ष" },
+  { 0x0D, "व्" },
+  { 0x0E, "प्" },
+  { 0x0F, "ी" },
+  { 0x10, "ः" },
+  { 0x11, "ल्" },
+  { 0x12, "इ" },
+  { 0x13, "ए" },
+  { 0x14, "ो" },
+  { 0x15, "च्" },
+  { 0x16, "क्" },
+  { 0x17, "त्" },
+  { 0x18, "ग्" },
+  { 0x19, "ख्" },
+  { 0x1A, "ध्" },
+  { 0x1B, "ह्" },
+  { 0x1C, "थ्" },
+  { 0x1D, "श्" },
+  { 0x1E, "१" },
+  { 0x1F, "२" },
+  { 0x20, "३" },
+  { 0x21, "४" },
+  { 0x22, "५" },
+  { 0x23, "६" },
+  { 0x24, "७" },
+  { 0x25, "८" },
+  { 0x26, "९" },
+  { 0x27, "०" },
+  { 0x2C, " " },
+  { 0x2D, ")" },
+  { 0x2E, "ं" },
+  { 0x2F, "र्" },
+  { 0x30, "ै" },
+  { 0x31, "्" },
+  { 0x33, "स्" },
+  { 0x34, "ू" },
+  { 0x35, "ञ्" },
+  { 0x36, "?" },
+  { 0x37, "श्र" },
+  { 0x38, "रू" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_131_LAYER_2_ENTRIES[] = {
+  { 0x06, "आ" },
+  { 0x13, "ऊ" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2E, "+" },
+  { 0x30, "औ" },
+};
+
+const wa_keyboard_mapping LAYOUT_131_LAYER_3_ENTRIES[] = {
+  { 0x12, "ई" },
+  { 0x13, "ऐ" },
+  { 0x14, "ौ" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "'" },
+  { 0x27, "\"" },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x30, "ओ" },
+};
+
+const wa_keyboard_mapping LAYOUT_131_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+};
+
+const wa_keyboard_layer LAYOUT_131_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_131_LAYER_0_ENTRIES, 52u,
+  },
+  {
+    "shift",
+    LAYOUT_131_LAYER_1_ENTRIES, 52u,
+  },
+  {
+    "altgr",
+    LAYOUT_131_LAYER_2_ENTRIES, 14u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_131_LAYER_3_ENTRIES, 16u,
+  },
+  {
+    "ctrl",
+    LAYOUT_131_LAYER_4_ENTRIES, 1u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_132_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "/" },
+  { 0x2E, "°" },
+  { 0x2F, "¨" },
+  { 0x30, "*" },
+  { 0x31, "<" },
+  { 0x33, "+" },
+  { 0x34, "´" },
+  { 0x35, "@" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "-" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "]" },
+};
+
+const wa_keyboard_mapping LAYOUT_132_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "&" },
+  { 0x24, "_" },
+  { 0x25, "(" },
+  { 0x26, ")" },
+  { 0x27, "'" },
+  { 0x2C, " " },
+  { 0x2D, "?" },
+  { 0x2E, "~" },
+  { 0x2F, "^" },
+  { 0x30, "|" },
+  { 0x31, ">" },
+  { 0x33, "±" },
+  { 0x34, "`" },
+  { 0x35, "§" },
+  { 0x36, ";" },
+  { 0x37, ":" },
+  { 0x38, "=" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "[" },
+};
+
+const wa_keyboard_mapping LAYOUT_132_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+};
+
+const wa_keyboard_mapping LAYOUT_132_LAYER_3_ENTRIES[] = {
+  { 0x06, "¢" },
+  { 0x08, "€" },
+  { 0x10, "µ" },
+  { 0x15, "¶" },
+  { 0x16, "ß" },
+  { 0x1B, "»" },
+  { 0x1D, "«" },
+  { 0x1E, "¹" },
+  { 0x1F, "²" },
+  { 0x20, "³" },
+  { 0x21, "¼" },
+  { 0x22, "½" },
+  { 0x23, "¾" },
+  { 0x24, "£" },
+  { 0x25, "{" },
+  { 0x26, "}" },
+  { 0x2D, "\\" },
+  { 0x2E, "¸" },
+  { 0x35, "¬" },
+  { 0x37, "·" },
+  { 0x64, "¦" },
+};
+
+const wa_keyboard_mapping LAYOUT_132_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_132_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_132_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_132_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_132_LAYER_2_ENTRIES, 26u,
+  },
+  {
+    "altgr",
+    LAYOUT_132_LAYER_3_ENTRIES, 21u,
+  },
+  {
+    "ctrl",
+    LAYOUT_132_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_133_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "+" },
+  { 0x2E, "\\" },
+  { 0x2F, "å" },
+  { 0x30, "¨" },
+  { 0x31, "'" },
+  { 0x33, "ø" },
+  { 0x34, "æ" },
+  { 0x35, "|" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "-" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "<" },
+};
+
+const wa_keyboard_mapping LAYOUT_133_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "#" },
+  { 0x21, "¤" },
+  { 0x22, "%" },
+  { 0x23, "&" },
+  { 0x24, "/" },
+  { 0x25, "(" },
+  { 0x26, ")" },
+  { 0x27, "=" },
+  { 0x2C, " " },
+  { 0x2D, "?" },
+  { 0x2E, "`" },
+  { 0x2F, "Å" },
+  { 0x30, "^" },
+  { 0x31, "*" },
+  { 0x33, "Ø" },
+  { 0x34, "Æ" },
+  { 0x35, "§" },
+  { 0x36, ";" },
+  { 0x37, ":" },
+  { 0x38, "_" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_133_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x2F, "Å" },
+  { 0x33, "Ø" },
+  { 0x34, "Æ" },
+};
+
+const wa_keyboard_mapping LAYOUT_133_LAYER_3_ENTRIES[] = {
+  { 0x04, "á" },
+  { 0x05, "ʒ" },
+  { 0x06, "č" },
+  { 0x07, "đ" },
+  { 0x08, "€" },
+  { 0x09, "ǥ" },
+  { 0x0A, "ǧ" },
+  { 0x0B, "ȟ" },
+  { 0x0C, "ï" },
+  { 0x0E, "ǩ" },
+  { 0x10, "µ" },
+  { 0x11, "ŋ" },
+  { 0x12, "õ" },
+  { 0x14, "â" },
+  { 0x16, "š" },
+  { 0x17, "ŧ" },
+  { 0x19, "ǯ" },
+  { 0x1D, "ž" },
+  { 0x1F, "@" },
+  { 0x20, "£" },
+  { 0x21, "$" },
+  { 0x22, "€" },
+  { 0x24, "{" },
+  { 0x25, "[" },
+  { 0x26, "]" },
+  { 0x27, "}" },
+  { 0x2E, "´" },
+  { 0x30, "~" },
+  { 0x33, "ö" },
+  { 0x34, "ä" },
+};
+
+const wa_keyboard_mapping LAYOUT_133_LAYER_4_ENTRIES[] = {
+  { 0x04, "Á" },
+  { 0x05, "Ʒ" },
+  { 0x06, "Č" },
+  { 0x07, "Đ" },
+  { 0x09, "Ǥ" },
+  { 0x0A, "Ǧ" },
+  { 0x0B, "Ȟ" },
+  { 0x0C, "Ï" },
+  { 0x0E, "Ǩ" },
+  { 0x11, "Ŋ" },
+  { 0x12, "Õ" },
+  { 0x14, "Â" },
+  { 0x16, "Š" },
+  { 0x17, "Ŧ" },
+  { 0x19, "Ǯ" },
+  { 0x1D, "Ž" },
+  { 0x33, "Ö" },
+  { 0x34, "Ä" },
+};
+
+const wa_keyboard_mapping LAYOUT_133_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_133_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_133_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_133_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_133_LAYER_2_ENTRIES, 29u,
+  },
+  {
+    "altgr",
+    LAYOUT_133_LAYER_3_ENTRIES, 30u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_133_LAYER_4_ENTRIES, 18u,
+  },
+  {
+    "ctrl",
+    LAYOUT_133_LAYER_5_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_134_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "+" },
+  { 0x2E, "\\" },
+  { 0x2F, "å" },
+  { 0x30, "¨" },
+  { 0x31, "'" },
+  { 0x33, "ø" },
+  { 0x34, "æ" },
+  { 0x35, "|" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "-" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "<" },
+};
+
+const wa_keyboard_mapping LAYOUT_134_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "#" },
+  { 0x21, "¤" },
+  { 0x22, "%" },
+  { 0x23, "&" },
+  { 0x24, "/" },
+  { 0x25, "(" },
+  { 0x26, ")" },
+  { 0x27, "=" },
+  { 0x2C, " " },
+  { 0x2D, "?" },
+  { 0x2E, "`" },
+  { 0x2F, "Å" },
+  { 0x30, "^" },
+  { 0x31, "*" },
+  { 0x33, "Ø" },
+  { 0x34, "Æ" },
+  { 0x35, "§" },
+  { 0x36, ";" },
+  { 0x37, ":" },
+  { 0x38, "_" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_134_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x2F, "Å" },
+  { 0x33, "Ø" },
+  { 0x34, "Æ" },
+};
+
+const wa_keyboard_mapping LAYOUT_134_LAYER_3_ENTRIES[] = {
+  { 0x08, "€" },
+  { 0x10, "µ" },
+  { 0x1F, "@" },
+  { 0x20, "£" },
+  { 0x21, "$" },
+  { 0x22, "€" },
+  { 0x24, "{" },
+  { 0x25, "[" },
+  { 0x26, "]" },
+  { 0x27, "}" },
+  { 0x2E, "´" },
+  { 0x30, "~" },
+};
+
+const wa_keyboard_mapping LAYOUT_134_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_134_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_134_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_134_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_134_LAYER_2_ENTRIES, 29u,
+  },
+  {
+    "altgr",
+    LAYOUT_134_LAYER_3_ENTRIES, 12u,
+  },
+  {
+    "ctrl",
+    LAYOUT_134_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_135_LAYER_0_ENTRIES[] = {
+  { 0x04, "ߏ" },
+  { 0x05, "߬" },
+  { 0x06, "ߵ" },
+  { 0x07, "ߍ" },
+  { 0x08, "ߠ" },
+  { 0x09, "ߌ" },
+  { 0x0A, "ߋ" },
+  { 0x0B, "ߊ" },
+  { 0x0C, "ߜ" },
+  { 0x0D, "ߖ" },
+  { 0x0E, "ߝ" },
+  { 0x0F, "ߣ" },
+  { 0x10, "ߟ" },
+  { 0x11, "߫" },
+  { 0x12, "ߢ" },
+  { 0x13, "ߡ" },
+  { 0x14, "ߔ" },
+  { 0x15, "ߥ" },
+  { 0x16, "ߎ" },
+  { 0x17, "ߦ" },
+  { 0x18, "ߗ" },
+  { 0x19, "ߴ" },
+  { 0x1A, "ߧ" },
+  { 0x1B, "߲" },
+  { 0x1C, "ߙ" },
+  { 0x1D, "ߐ" },
+  { 0x1E, "߁" },
+  { 0x1F, "߂" },
+  { 0x20, "߃" },
+  { 0x21, "߄" },
+  { 0x22, "߅" },
+  { 0x23, "߆" },
+  { 0x24, "߇" },
+  { 0x25, "߈" },
+  { 0x26, "߉" },
+  { 0x27, "߀" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "ߤ" },
+  { 0x30, "ߒ" },
+  { 0x31, "\\" },
+  { 0x33, "ߕ" },
+  { 0x34, "ߓ" },
+  { 0x35, "߷" },
+  { 0x36, "ߛ" },
+  { 0x37, "ߘ" },
+  { 0x38, "ߞ" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_135_LAYER_1_ENTRIES[] = {
+  { 0x04, "߶" },
+  { 0x05, "߰" },
+  { 0x06, "߭" },
+  { 0x07, "[" },
+  { 0x09, "]" },
+  { 0x0A, "﴾" },
+  { 0x0B, "﴿" },
+  { 0x0C, "÷" },
+  { 0x0D, "ߺ" },
+  { 0x0E, "،" },
+  { 0x0F, "/" },
+  { 0x10, "߸" },
+  { 0x11, "߯" },
+  { 0x12, "×" },
+  { 0x13, "ߪ" },
+  { 0x14, "ߩ" },
+  { 0x16, "°" },
+  { 0x19, "߮" },
+  { 0x1A, "ߨ" },
+  { 0x1B, "߱" },
+  { 0x1C, "ߚ" },
+  { 0x1D, "߳" },
+  { 0x1E, "߹" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "߾" },
+  { 0x24, "߿" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "‹" },
+  { 0x30, "›" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x36, "ߑ" },
+  { 0x37, "." },
+  { 0x38, "؟" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_135_LAYER_2_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_135_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_135_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_135_LAYER_1_ENTRIES, 48u,
+  },
+  {
+    "ctrl",
+    LAYOUT_135_LAYER_2_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_136_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x35, "`" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_136_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_136_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+};
+
+const wa_keyboard_mapping LAYOUT_136_LAYER_3_ENTRIES[] = {
+  { 0x04, "á" },
+  { 0x06, "©" },
+  { 0x07, "ð" },
+  { 0x08, "é" },
+  { 0x0C, "í" },
+  { 0x0F, "ø" },
+  { 0x10, "µ" },
+  { 0x11, "ñ" },
+  { 0x12, "ó" },
+  { 0x13, "ö" },
+  { 0x14, "ä" },
+  { 0x15, "®" },
+  { 0x16, "ß" },
+  { 0x17, "þ" },
+  { 0x18, "ú" },
+  { 0x1A, "å" },
+  { 0x1C, "ü" },
+  { 0x1D, "æ" },
+  { 0x1E, "¡" },
+  { 0x1F, "²" },
+  { 0x20, "³" },
+  { 0x21, "¤" },
+  { 0x22, "€" },
+  { 0x23, "¼" },
+  { 0x24, "½" },
+  { 0x25, "¾" },
+  { 0x26, "‘" },
+  { 0x27, "’" },
+  { 0x2D, "¥" },
+  { 0x2E, "×" },
+  { 0x2F, "«" },
+  { 0x30, "»" },
+  { 0x31, "¬" },
+  { 0x33, "¶" },
+  { 0x34, "´" },
+  { 0x36, "ç" },
+  { 0x37, "š" },
+  { 0x38, "¿" },
+};
+
+const wa_keyboard_mapping LAYOUT_136_LAYER_4_ENTRIES[] = {
+  { 0x04, "Á" },
+  { 0x06, "¢" },
+  { 0x07, "Ð" },
+  { 0x08, "É" },
+  { 0x0C, "Í" },
+  { 0x0F, "Ø" },
+  { 0x11, "Ñ" },
+  { 0x12, "Ó" },
+  { 0x13, "Ö" },
+  { 0x14, "Ä" },
+  { 0x16, "§" },
+  { 0x17, "Þ" },
+  { 0x18, "Ú" },
+  { 0x1A, "Å" },
+  { 0x1C, "Ü" },
+  { 0x1D, "Æ" },
+  { 0x1E, "¹" },
+  { 0x21, "£" },
+  { 0x2E, "÷" },
+  { 0x31, "¦" },
+  { 0x33, "°" },
+  { 0x34, "¨" },
+  { 0x36, "Ç" },
+  { 0x37, "Š" },
+};
+
+const wa_keyboard_mapping LAYOUT_136_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_136_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_136_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_136_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_136_LAYER_2_ENTRIES, 26u,
+  },
+  {
+    "altgr",
+    LAYOUT_136_LAYER_3_ENTRIES, 38u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_136_LAYER_4_ENTRIES, 24u,
+  },
+  {
+    "ctrl",
+    LAYOUT_136_LAYER_5_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_137_LAYER_0_ENTRIES[] = {
+  { 0x04, "ୋ" },
+  { 0x05, "ୱ" },
+  { 0x06, "ମ" },
+  { 0x07, "୍" },
+  { 0x08, "ା" },
+  { 0x09, "ି" },
+  { 0x0A, "ୁ" },
+  { 0x0B, "ପ" },
+  { 0x0C, "ଗ" },
+  { 0x0D, "ର" },
+  { 0x0E, "କ" },
+  { 0x0F, "ତ" },
+  { 0x10, "ସ" },
+  { 0x11, "ଲ" },
+  { 0x12, "ଦ" },
+  { 0x13, "ଜ" },
+  { 0x14, "ୌ" },
+  { 0x15, "ୀ" },
+  { 0x16, "େ" },
+  { 0x17, "ୂ" },
+  { 0x18, "ହ" },
+  { 0x19, "ନ" },
+  { 0x1A, "ୈ" },
+  { 0x1B, "ଂ" },
+  { 0x1C, "ବ" },
+  { 0x1D, "ୟ" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "ୃ" },
+  { 0x2F, "ଡ" },
+  { 0x30, "଼" },
+  { 0x33, "ଚ" },
+  { 0x34, "ଟ" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "ୟ" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_137_LAYER_1_ENTRIES[] = {
+  { 0x04, "ଓ" },
+  { 0x06, "ଣ" },
+  { 0x07, "ଅ" },
+  { 0x08, "ଆ" },
+  { 0x09, "ଇ" },
+  { 0x0A, "ଉ" },
+  { 0x0B, "ଫ" },
+  { 0x0C, "ଘ" },
+  { 0x0E, "ଖ" },
+  { 0x0F, "ଥ" },
+  { 0x10, "ଶ" },
+  { 0x11, "ଳ" },
+  { 0x12, "ଧ" },
+  { 0x13, "ଝ" },
+  { 0x14, "ଔ" },
+  { 0x15, "ଈ" },
+  { 0x16, "ଏ" },
+  { 0x17, "ଊ" },
+  { 0x18, "ଙ" },
+  { 0x1A, "ଐ" },
+  { 0x1B, "ଁ" },
+  { 0x1C, "ଭ" },
+  { 0x1D, "ୱ" },
+  { 0x20, "୍ର" },
+  { 0x21, "ର୍" },
+  { 0x22, "ଜ୍ଞ" },
+  { 0x23, "ତ୍ର" },
+  { 0x24, "କ୍ଷ" },
+  { 0x25, "ଶ୍ର" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "ଃ" },
+  { 0x2E, "ଋ" },
+  { 0x2F, "ଢ" },
+  { 0x30, "ଞ" },
+  { 0x33, "ଛ" },
+  { 0x34, "ଠ" },
+  { 0x36, "ଷ" },
+  { 0x37, "।" },
+  { 0x38, "ଯ" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_137_LAYER_2_ENTRIES[] = {
+  { 0x05, "ଵ" },
+  { 0x09, "ୢ" },
+  { 0x15, "ୣ" },
+  { 0x1B, "୰" },
+  { 0x1E, "୧" },
+  { 0x1F, "୨" },
+  { 0x20, "୩" },
+  { 0x21, "୪" },
+  { 0x22, "୫" },
+  { 0x23, "୬" },
+  { 0x24, "୭" },
+  { 0x25, "୮" },
+  { 0x26, "୯" },
+  { 0x27, "୦" },
+  { 0x2E, "ୄ" },
+  { 0x2F, "ଡ଼" },
+  { 0x37, "॥" },
+};
+
+const wa_keyboard_mapping LAYOUT_137_LAYER_3_ENTRIES[] = {
+  { 0x09, "ଌ" },
+  { 0x15, "ୡ" },
+  { 0x2E, "ୠ" },
+  { 0x2F, "ଢ଼" },
+  { 0x37, "ଽ" },
+  { 0x38, "ଯ଼" },
+};
+
+const wa_keyboard_mapping LAYOUT_137_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_137_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_137_LAYER_0_ENTRIES, 50u,
+  },
+  {
+    "shift",
+    LAYOUT_137_LAYER_1_ENTRIES, 45u,
+  },
+  {
+    "altgr",
+    LAYOUT_137_LAYER_2_ENTRIES, 17u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_137_LAYER_3_ENTRIES, 6u,
+  },
+  {
+    "ctrl",
+    LAYOUT_137_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_138_LAYER_0_ENTRIES[] = {
+  { 0x04, "𐓘" },
+  { 0x05, "𐓜" },
+  { 0x06, "𐓝" },
+  { 0x07, "𐓰" },
+  { 0x08, "𐓟" },
+  { 0x09, "͘" },
+  { 0x0A, "𐓢" },
+  { 0x0B, "𐓡" },
+  { 0x0C, "𐓣" },
+  { 0x0D, "𐓛" },
+  { 0x0E, "𐓤" },
+  { 0x0F, "𐓧" },
+  { 0x10, "𐓨" },
+  { 0x11, "𐓩" },
+  { 0x12, "𐓪" },
+  { 0x13, "𐓬" },
+  { 0x14, "𐓦" },
+  { 0x15, "𐓲" },
+  { 0x16, "𐓮" },
+  { 0x17, "𐓵" },
+  { 0x18, "𐓶" },
+  { 0x19, "𐓯" },
+  { 0x1A, "𐓷" },
+  { 0x1B, "𐓸" },
+  { 0x1C, "𐓻" },
+  { 0x1D, "𐓺" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x35, "`" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_138_LAYER_1_ENTRIES[] = {
+  { 0x04, "𐒰" },
+  { 0x05, "𐒴" },
+  { 0x06, "𐒵" },
+  { 0x07, "𐓈" },
+  { 0x08, "𐒷" },
+  { 0x09, "̄" },
+  { 0x0A, "𐒺" },
+  { 0x0B, "𐒹" },
+  { 0x0C, "𐒻" },
+  { 0x0D, "𐒳" },
+  { 0x0E, "𐒼" },
+  { 0x0F, "𐒿" },
+  { 0x10, "𐓀" },
+  { 0x11, "𐓁" },
+  { 0x12, "𐓂" },
+  { 0x13, "𐓄" },
+  { 0x14, "𐒾" },
+  { 0x15, "𐓊" },
+  { 0x16, "𐓆" },
+  { 0x17, "𐓍" },
+  { 0x18, "𐓎" },
+  { 0x19, "𐓇" },
+  { 0x1A, "𐓏" },
+  { 0x1B, "𐓐" },
+  { 0x1C, "𐓓" },
+  { 0x1D, "𐓒" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_138_LAYER_2_ENTRIES[] = {
+  { 0x04, "𐒰" },
+  { 0x05, "𐒴" },
+  { 0x06, "𐒵" },
+  { 0x07, "𐓈" },
+  { 0x08, "𐒷" },
+  { 0x09, "̄" },
+  { 0x0A, "𐒺" },
+  { 0x0B, "𐒹" },
+  { 0x0C, "𐒻" },
+  { 0x0D, "𐒳" },
+  { 0x0E, "𐒼" },
+  { 0x0F, "𐒿" },
+  { 0x10, "𐓀" },
+  { 0x11, "𐓁" },
+  { 0x12, "𐓂" },
+  { 0x13, "𐓄" },
+  { 0x14, "𐒾" },
+  { 0x15, "𐓊" },
+  { 0x16, "𐓆" },
+  { 0x17, "𐓍" },
+  { 0x18, "𐓎" },
+  { 0x19, "𐓇" },
+  { 0x1A, "𐓏" },
+  { 0x1B, "𐓐" },
+  { 0x1C, "𐓓" },
+  { 0x1D, "𐓒" },
+};
+
+const wa_keyboard_mapping LAYOUT_138_LAYER_3_ENTRIES[] = {
+  { 0x04, "" },
+  { 0x06, "" },
+  { 0x07, "" },
+  { 0x08, "" },
+  { 0x0C, "" },
+  { 0x0D, "" },
+  { 0x0E, "" },
+  { 0x12, "" },
+  { 0x13, "" },
+  { 0x15, "" },
+  { 0x16, "" },
+  { 0x17, "" },
+  { 0x1B, "" },
+};
+
+const wa_keyboard_mapping LAYOUT_138_LAYER_4_ENTRIES[] = {
+  { 0x04, "" },
+  { 0x06, "" },
+  { 0x07, "" },
+  { 0x08, "" },
+  { 0x0C, "" },
+  { 0x0D, "" },
+  { 0x0E, "" },
+  { 0x12, "" },
+  { 0x13, "" },
+  { 0x15, "" },
+  { 0x16, "" },
+  { 0x17, "" },
+  { 0x1B, "" },
+};
+
+const wa_keyboard_mapping LAYOUT_138_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_138_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_138_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_138_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_138_LAYER_2_ENTRIES, 26u,
+  },
+  {
+    "altgr",
+    LAYOUT_138_LAYER_3_ENTRIES, 13u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_138_LAYER_4_ENTRIES, 13u,
+  },
+  {
+    "ctrl",
+    LAYOUT_138_LAYER_5_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_139_LAYER_0_ENTRIES[] = {
+  { 0x04, "ੋ" },
+  { 0x05, "ਵ" },
+  { 0x06, "ਮ" },
+  { 0x07, "੍" },
+  { 0x08, "ਾ" },
+  { 0x09, "ਿ" },
+  { 0x0A, "ੁ" },
+  { 0x0B, "ਪ" },
+  { 0x0C, "ਗ" },
+  { 0x0D, "ਰ" },
+  { 0x0E, "ਕ" },
+  { 0x0F, "ਤ" },
+  { 0x10, "ਸ" },
+  { 0x11, "ਲ" },
+  { 0x12, "ਦ" },
+  { 0x13, "ਜ" },
+  { 0x14, "ੌ" },
+  { 0x15, "ੀ" },
+  { 0x16, "ੇ" },
+  { 0x17, "ੂ" },
+  { 0x18, "ਹ" },
+  { 0x19, "ਨ" },
+  { 0x1A, "ੈ" },
+  { 0x1B, "ੰ" },
+  { 0x1C, "ਬ" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2F, "ਡ" },
+  { 0x30, "਼" },
+  { 0x33, "ਚ" },
+  { 0x34, "ਟ" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "ਯ" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_139_LAYER_1_ENTRIES[] = {
+  { 0x04, "ਓ" },
+  { 0x05, "ੲ" },
+  { 0x06, "ਣ" },
+  { 0x07, "ਅ" },
+  { 0x08, "ਆ" },
+  { 0x09, "ਇ" },
+  { 0x0A, "ਉ" },
+  { 0x0B, "ਫ" },
+  { 0x0C, "ਘ" },
+  { 0x0D, "ੜ" },
+  { 0x0E, "ਖ" },
+  { 0x0F, "ਥ" },
+  { 0x10, "ਸ਼" },
+  { 0x11, "ਲ਼" },
+  { 0x12, "ਧ" },
+  { 0x13, "ਝ" },
+  { 0x14, "ਔ" },
+  { 0x15, "ਈ" },
+  { 0x16, "ਏ" },
+  { 0x17, "ਊ" },
+  { 0x18, "ਙ" },
+  { 0x1A, "ਐ" },
+  { 0x1B, "ਂ" },
+  { 0x1C, "ਭ" },
+  { 0x1E, "੍ਵ" },
+  { 0x1F, "੍ਯ" },
+  { 0x20, "੍ਰ" },
+  { 0x21, "ੱ" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2F, "ਢ" },
+  { 0x30, "ਞ" },
+  { 0x33, "ਛ" },
+  { 0x34, "ਠ" },
+  { 0x35, "੍ਹ" },
+  { 0x37, "।" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_139_LAYER_2_ENTRIES[] = {
+  { 0x05, "ੳ" },
+  { 0x0B, "ਫ਼" },
+  { 0x0C, "ਗ਼" },
+  { 0x0E, "ਖ਼" },
+  { 0x13, "ਜ਼" },
+  { 0x1E, "੧" },
+  { 0x1F, "੨" },
+  { 0x20, "੩" },
+  { 0x21, "੪" },
+  { 0x22, "੫" },
+  { 0x23, "੬" },
+  { 0x24, "੭" },
+  { 0x25, "੮" },
+  { 0x26, "੯" },
+  { 0x27, "੦" },
+  { 0x2F, "ੜ" },
+  { 0x37, "॥" },
+};
+
+const wa_keyboard_mapping LAYOUT_139_LAYER_3_ENTRIES[] = {
+  { 0x09, "ੲ" },
+  { 0x0A, "ੳ" },
+  { 0x1B, "ੴ" },
+};
+
+const wa_keyboard_mapping LAYOUT_139_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_139_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_139_LAYER_0_ENTRIES, 48u,
+  },
+  {
+    "shift",
+    LAYOUT_139_LAYER_1_ENTRIES, 41u,
+  },
+  {
+    "altgr",
+    LAYOUT_139_LAYER_2_ENTRIES, 17u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_139_LAYER_3_ENTRIES, 3u,
+  },
+  {
+    "ctrl",
+    LAYOUT_139_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_140_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "z" },
+  { 0x1D, "y" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "+" },
+  { 0x2E, "'" },
+  { 0x2F, "ż" },
+  { 0x30, "ś" },
+  { 0x31, "ó" },
+  { 0x33, "ł" },
+  { 0x34, "ą" },
+  { 0x35, "˛" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "-" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "<" },
+};
+
+const wa_keyboard_mapping LAYOUT_140_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Z" },
+  { 0x1D, "Y" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "#" },
+  { 0x21, "¤" },
+  { 0x22, "%" },
+  { 0x23, "&" },
+  { 0x24, "/" },
+  { 0x25, "(" },
+  { 0x26, ")" },
+  { 0x27, "=" },
+  { 0x2C, " " },
+  { 0x2D, "?" },
+  { 0x2E, "*" },
+  { 0x2F, "ń" },
+  { 0x30, "ć" },
+  { 0x31, "ź" },
+  { 0x33, "Ł" },
+  { 0x34, "ę" },
+  { 0x35, "·" },
+  { 0x36, ";" },
+  { 0x37, ":" },
+  { 0x38, "_" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_140_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Z" },
+  { 0x1D, "Y" },
+  { 0x33, "Ł" },
+};
+
+const wa_keyboard_mapping LAYOUT_140_LAYER_3_ENTRIES[] = {
+  { 0x05, "{" },
+  { 0x07, "Đ" },
+  { 0x10, "§" },
+  { 0x11, "}" },
+  { 0x14, "\\" },
+  { 0x16, "đ" },
+  { 0x18, "€" },
+  { 0x19, "@" },
+  { 0x1A, "¦" },
+  { 0x1E, "~" },
+  { 0x1F, "ˇ" },
+  { 0x20, "^" },
+  { 0x21, "˘" },
+  { 0x22, "°" },
+  { 0x23, "˛" },
+  { 0x24, "`" },
+  { 0x25, "·" },
+  { 0x26, "´" },
+  { 0x27, "˝" },
+  { 0x2D, "¨" },
+  { 0x2E, "¸" },
+  { 0x2F, "÷" },
+  { 0x30, "×" },
+  { 0x33, "$" },
+  { 0x34, "ß" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_140_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_140_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_140_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_140_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_140_LAYER_2_ENTRIES, 27u,
+  },
+  {
+    "altgr",
+    LAYOUT_140_LAYER_3_ENTRIES, 27u,
+  },
+  {
+    "ctrl",
+    LAYOUT_140_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_141_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x35, "`" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_141_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_141_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+};
+
+const wa_keyboard_mapping LAYOUT_141_LAYER_3_ENTRIES[] = {
+  { 0x04, "ą" },
+  { 0x06, "ć" },
+  { 0x08, "ę" },
+  { 0x0F, "ł" },
+  { 0x11, "ń" },
+  { 0x12, "ó" },
+  { 0x16, "ś" },
+  { 0x18, "€" },
+  { 0x1B, "ź" },
+  { 0x1D, "ż" },
+};
+
+const wa_keyboard_mapping LAYOUT_141_LAYER_4_ENTRIES[] = {
+  { 0x04, "Ą" },
+  { 0x06, "Ć" },
+  { 0x08, "Ę" },
+  { 0x0F, "Ł" },
+  { 0x11, "Ń" },
+  { 0x12, "Ó" },
+  { 0x16, "Ś" },
+  { 0x1B, "Ź" },
+  { 0x1D, "Ż" },
+};
+
+const wa_keyboard_mapping LAYOUT_141_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_141_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_141_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_141_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_141_LAYER_2_ENTRIES, 26u,
+  },
+  {
+    "altgr",
+    LAYOUT_141_LAYER_3_ENTRIES, 10u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_141_LAYER_4_ENTRIES, 9u,
+  },
+  {
+    "ctrl",
+    LAYOUT_141_LAYER_5_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_142_LAYER_0_ENTRIES[] = {
+  { 0x04, "ش" },
+  { 0x05, "ذ" },
+  { 0x06, "ز" },
+  { 0x07, "ی" },
+  { 0x08, "ث" },
+  { 0x09, "ب" },
+  { 0x0A, "ل" },
+  { 0x0B, "ا" },
+  { 0x0C, "ه" },
+  { 0x0D, "ت" },
+  { 0x0E, "ن" },
+  { 0x0F, "م" },
+  { 0x10, "ړ" },
+  { 0x11, "د" },
+  { 0x12, "خ" },
+  { 0x13, "ح" },
+  { 0x14, "ض" },
+  { 0x15, "ق" },
+  { 0x16, "س" },
+  { 0x17, "ف" },
+  { 0x18, "ع" },
+  { 0x19, "ر" },
+  { 0x1A, "ص" },
+  { 0x1B, "ې" },
+  { 0x1C, "غ" },
+  { 0x1D, "ئ" },
+  { 0x1E, "۱" },
+  { 0x1F, "۲" },
+  { 0x20, "۳" },
+  { 0x21, "۴" },
+  { 0x22, "۵" },
+  { 0x23, "۶" },
+  { 0x24, "۷" },
+  { 0x25, "۸" },
+  { 0x26, "۹" },
+  { 0x27, "۰" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "ج" },
+  { 0x30, "چ" },
+  { 0x31, "\\" },
+  { 0x33, "ک" },
+  { 0x34, "ګ" },
+  { 0x35, "‍" },
+  { 0x36, "و" },
+  { 0x37, "ږ" },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_142_LAYER_1_ENTRIES[] = {
+  { 0x04, "ښ" },
+  { 0x05, "‌" },
+  { 0x06, "ژ" },
+  { 0x07, "ي" },
+  { 0x08, "ٍ" },
+  { 0x09, "پ" },
+  { 0x0A, "أ" },
+  { 0x0B, "آ" },
+  { 0x0C, "ّ" },
+  { 0x0D, "ټ" },
+  { 0x0E, "ڼ" },
+  { 0x0F, "ة" },
+  { 0x10, "ؤ" },
+  { 0x11, "ډ" },
+  { 0x12, "ځ" },
+  { 0x13, "څ" },
+  { 0x14, "ْ" },
+  { 0x15, "ً" },
+  { 0x16, "ۍ" },
+  { 0x17, "ُ" },
+  { 0x18, "َ" },
+  { 0x19, "ء" },
+  { 0x1A, "ٌ" },
+  { 0x1B, "ط" },
+  { 0x1C, "ِ" },
+  { 0x1D, "ظ" },
+  { 0x1E, "!" },
+  { 0x1F, "٬" },
+  { 0x20, "٫" },
+  { 0x21, "؋" },
+  { 0x22, "٪" },
+  { 0x23, "×" },
+  { 0x24, "»" },
+  { 0x25, "«" },
+  { 0x26, ")" },
+  { 0x27, "(" },
+  { 0x2C, " " },
+  { 0x2D, "ـ" },
+  { 0x2E, "+" },
+  { 0x2F, "]" },
+  { 0x30, "[" },
+  { 0x31, "*" },
+  { 0x33, ":" },
+  { 0x34, "؛" },
+  { 0x35, "ٔ" },
+  { 0x36, "،" },
+  { 0x37, "." },
+  { 0x38, "؟" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_142_LAYER_2_ENTRIES[] = {
+  { 0x07, "ے" },
+  { 0x08, "ى" },
+  { 0x09, "ں" },
+  { 0x0A, "ڷ" },
+  { 0x0B, "إ" },
+  { 0x0C, "ٰ" },
+  { 0x0D, "ٹ" },
+  { 0x0E, ">" },
+  { 0x0F, "<" },
+  { 0x10, "ڑ" },
+  { 0x11, "ڈ" },
+  { 0x12, "'" },
+  { 0x13, "\"" },
+  { 0x14, "€" },
+  { 0x15, "‎" },
+  { 0x17, "‏" },
+  { 0x18, "ٙ" },
+  { 0x1A, "ٱ" },
+  { 0x1B, ";" },
+  { 0x1C, "ٓ" },
+  { 0x1D, "?" },
+  { 0x1E, "~" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "٭" },
+  { 0x26, "•" },
+  { 0x27, "°" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "÷" },
+  { 0x2F, "}" },
+  { 0x30, "{" },
+  { 0x31, "|" },
+  { 0x33, "ك" },
+  { 0x34, "گ" },
+  { 0x35, "`" },
+  { 0x36, "," },
+  { 0x37, "ۇ" },
+  { 0x38, "ۉ" },
+};
+
+const wa_keyboard_mapping LAYOUT_142_LAYER_3_ENTRIES[] = {
+  { 0x2A, "" },
+};
+
+const wa_keyboard_layer LAYOUT_142_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_142_LAYER_0_ENTRIES, 52u,
+  },
+  {
+    "shift",
+    LAYOUT_142_LAYER_1_ENTRIES, 52u,
+  },
+  {
+    "altgr",
+    LAYOUT_142_LAYER_2_ENTRIES, 43u,
+  },
+  {
+    "ctrl",
+    LAYOUT_142_LAYER_3_ENTRIES, 1u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_143_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "´" },
+  { 0x30, "[" },
+  { 0x31, "]" },
+  { 0x33, "ç" },
+  { 0x34, "~" },
+  { 0x35, "'" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, ";" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x63, "." },
+  { 0x64, "\\" },
+  { 0x64, "/" },
+};
+
+const wa_keyboard_mapping LAYOUT_143_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "¨" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "`" },
+  { 0x30, "{" },
+  { 0x31, "}" },
+  { 0x33, "Ç" },
+  { 0x34, "^" },
+  { 0x35, "\"" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, ":" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x63, "." },
+  { 0x64, "|" },
+  { 0x64, "?" },
+};
+
+const wa_keyboard_mapping LAYOUT_143_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x33, "Ç" },
+};
+
+const wa_keyboard_mapping LAYOUT_143_LAYER_3_ENTRIES[] = {
+  { 0x06, "₢" },
+  { 0x08, "°" },
+  { 0x14, "/" },
+  { 0x1A, "?" },
+  { 0x1E, "¹" },
+  { 0x1F, "²" },
+  { 0x20, "³" },
+  { 0x21, "£" },
+  { 0x22, "¢" },
+  { 0x23, "¬" },
+  { 0x2E, "§" },
+  { 0x30, "ª" },
+  { 0x31, "º" },
+  { 0x64, "°" },
+};
+
+const wa_keyboard_mapping LAYOUT_143_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_143_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_143_LAYER_0_ENTRIES, 55u,
+  },
+  {
+    "shift",
+    LAYOUT_143_LAYER_1_ENTRIES, 55u,
+  },
+  {
+    "caps",
+    LAYOUT_143_LAYER_2_ENTRIES, 27u,
+  },
+  {
+    "altgr",
+    LAYOUT_143_LAYER_3_ENTRIES, 14u,
+  },
+  {
+    "ctrl",
+    LAYOUT_143_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_144_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "´" },
+  { 0x30, "[" },
+  { 0x31, "]" },
+  { 0x33, "ç" },
+  { 0x34, "~" },
+  { 0x35, "'" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, ";" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x63, "." },
+  { 0x64, "\\" },
+  { 0x64, "/" },
+};
+
+const wa_keyboard_mapping LAYOUT_144_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "¨" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "`" },
+  { 0x30, "{" },
+  { 0x31, "}" },
+  { 0x33, "Ç" },
+  { 0x34, "^" },
+  { 0x35, "\"" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, ":" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x63, "." },
+  { 0x64, "|" },
+  { 0x64, "?" },
+};
+
+const wa_keyboard_mapping LAYOUT_144_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x33, "Ç" },
+};
+
+const wa_keyboard_mapping LAYOUT_144_LAYER_3_ENTRIES[] = {
+  { 0x06, "₢" },
+  { 0x08, "°" },
+  { 0x14, "/" },
+  { 0x1A, "?" },
+  { 0x1E, "¹" },
+  { 0x1F, "²" },
+  { 0x20, "³" },
+  { 0x21, "£" },
+  { 0x22, "¢" },
+  { 0x23, "¬" },
+  { 0x2E, "§" },
+  { 0x30, "ª" },
+  { 0x31, "º" },
+  { 0x64, "°" },
+};
+
+const wa_keyboard_mapping LAYOUT_144_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_144_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_144_LAYER_0_ENTRIES, 55u,
+  },
+  {
+    "shift",
+    LAYOUT_144_LAYER_1_ENTRIES, 55u,
+  },
+  {
+    "caps",
+    LAYOUT_144_LAYER_2_ENTRIES, 27u,
+  },
+  {
+    "altgr",
+    LAYOUT_144_LAYER_3_ENTRIES, 14u,
+  },
+  {
+    "ctrl",
+    LAYOUT_144_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_145_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "'" },
+  { 0x2E, "«" },
+  { 0x2F, "+" },
+  { 0x30, "´" },
+  { 0x31, "~" },
+  { 0x33, "ç" },
+  { 0x34, "º" },
+  { 0x35, "\\" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "-" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "<" },
+};
+
+const wa_keyboard_mapping LAYOUT_145_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "&" },
+  { 0x24, "/" },
+  { 0x25, "(" },
+  { 0x26, ")" },
+  { 0x27, "=" },
+  { 0x2C, " " },
+  { 0x2D, "?" },
+  { 0x2E, "»" },
+  { 0x2F, "*" },
+  { 0x30, "`" },
+  { 0x31, "^" },
+  { 0x33, "Ç" },
+  { 0x34, "ª" },
+  { 0x35, "|" },
+  { 0x36, ";" },
+  { 0x37, ":" },
+  { 0x38, "_" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_145_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x33, "Ç" },
+};
+
+const wa_keyboard_mapping LAYOUT_145_LAYER_3_ENTRIES[] = {
+  { 0x08, "€" },
+  { 0x1F, "@" },
+  { 0x20, "£" },
+  { 0x21, "§" },
+  { 0x22, "€" },
+  { 0x24, "{" },
+  { 0x25, "[" },
+  { 0x26, "]" },
+  { 0x27, "}" },
+  { 0x2F, "¨" },
+  { 0x30, "]" },
+};
+
+const wa_keyboard_mapping LAYOUT_145_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_145_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_145_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_145_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_145_LAYER_2_ENTRIES, 27u,
+  },
+  {
+    "altgr",
+    LAYOUT_145_LAYER_3_ENTRIES, 11u,
+  },
+  {
+    "ctrl",
+    LAYOUT_145_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_146_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "z" },
+  { 0x1D, "y" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "+" },
+  { 0x2E, "'" },
+  { 0x2F, "ă" },
+  { 0x30, "î" },
+  { 0x31, "â" },
+  { 0x33, "ş" },
+  { 0x34, "ţ" },
+  { 0x35, "]" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "-" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "<" },
+};
+
+const wa_keyboard_mapping LAYOUT_146_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Z" },
+  { 0x1D, "Y" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "#" },
+  { 0x21, "¤" },
+  { 0x22, "%" },
+  { 0x23, "&" },
+  { 0x24, "/" },
+  { 0x25, "(" },
+  { 0x26, ")" },
+  { 0x27, "=" },
+  { 0x2C, " " },
+  { 0x2D, "?" },
+  { 0x2E, "*" },
+  { 0x2F, "Ă" },
+  { 0x30, "Î" },
+  { 0x31, "Â" },
+  { 0x33, "Ş" },
+  { 0x34, "Ţ" },
+  { 0x35, "[" },
+  { 0x36, ";" },
+  { 0x37, ":" },
+  { 0x38, "_" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_146_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Z" },
+  { 0x1D, "Y" },
+  { 0x2F, "Ă" },
+  { 0x30, "Î" },
+  { 0x31, "Â" },
+  { 0x33, "Ş" },
+  { 0x34, "Ţ" },
+};
+
+const wa_keyboard_mapping LAYOUT_146_LAYER_3_ENTRIES[] = {
+  { 0x05, "{" },
+  { 0x07, "Đ" },
+  { 0x0E, "ł" },
+  { 0x0F, "Ł" },
+  { 0x10, "§" },
+  { 0x11, "}" },
+  { 0x14, "\\" },
+  { 0x16, "đ" },
+  { 0x19, "@" },
+  { 0x1A, "|" },
+  { 0x1E, "~" },
+  { 0x1F, "ˇ" },
+  { 0x20, "^" },
+  { 0x21, "˘" },
+  { 0x22, "°" },
+  { 0x23, "˛" },
+  { 0x24, "`" },
+  { 0x25, "·" },
+  { 0x26, "´" },
+  { 0x27, "˝" },
+  { 0x2C, " " },
+  { 0x2D, "¨" },
+  { 0x2E, "¸" },
+  { 0x2F, "÷" },
+  { 0x30, "×" },
+  { 0x33, "$" },
+  { 0x34, "ß" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_146_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_146_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_146_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_146_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_146_LAYER_2_ENTRIES, 31u,
+  },
+  {
+    "altgr",
+    LAYOUT_146_LAYER_3_ENTRIES, 29u,
+  },
+  {
+    "ctrl",
+    LAYOUT_146_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_147_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x35, "`" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_147_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_147_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+};
+
+const wa_keyboard_mapping LAYOUT_147_LAYER_3_ENTRIES[] = {
+  { 0x04, "ă" },
+  { 0x06, "©" },
+  { 0x07, "đ" },
+  { 0x08, "€" },
+  { 0x0C, "î" },
+  { 0x0F, "ł" },
+  { 0x13, "§" },
+  { 0x14, "â" },
+  { 0x16, "ș" },
+  { 0x17, "ț" },
+  { 0x1A, "ß" },
+  { 0x1E, "~" },
+  { 0x1F, "ˇ" },
+  { 0x20, "^" },
+  { 0x21, "˘" },
+  { 0x22, "°" },
+  { 0x23, "˛" },
+  { 0x24, "`" },
+  { 0x25, "˙" },
+  { 0x26, "´" },
+  { 0x27, "˝" },
+  { 0x2D, "¨" },
+  { 0x2E, "¸" },
+  { 0x2F, "„" },
+  { 0x30, "”" },
+  { 0x36, "«" },
+  { 0x37, "»" },
+};
+
+const wa_keyboard_mapping LAYOUT_147_LAYER_4_ENTRIES[] = {
+  { 0x04, "Ă" },
+  { 0x07, "Đ" },
+  { 0x0C, "Î" },
+  { 0x0F, "Ł" },
+  { 0x14, "Â" },
+  { 0x16, "Ș" },
+  { 0x17, "Ț" },
+  { 0x2D, "–" },
+  { 0x2E, "±" },
+};
+
+const wa_keyboard_mapping LAYOUT_147_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_147_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_147_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_147_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_147_LAYER_2_ENTRIES, 26u,
+  },
+  {
+    "altgr",
+    LAYOUT_147_LAYER_3_ENTRIES, 27u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_147_LAYER_4_ENTRIES, 9u,
+  },
+  {
+    "ctrl",
+    LAYOUT_147_LAYER_5_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_148_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "ă" },
+  { 0x30, "î" },
+  { 0x31, "â" },
+  { 0x33, "ș" },
+  { 0x34, "ț" },
+  { 0x35, "„" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_148_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "Ă" },
+  { 0x30, "Î" },
+  { 0x31, "Â" },
+  { 0x33, "Ș" },
+  { 0x34, "Ț" },
+  { 0x35, "”" },
+  { 0x36, ";" },
+  { 0x37, ":" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_148_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x2F, "Ă" },
+  { 0x30, "Î" },
+  { 0x31, "Â" },
+  { 0x33, "Ș" },
+  { 0x34, "Ț" },
+};
+
+const wa_keyboard_mapping LAYOUT_148_LAYER_3_ENTRIES[] = {
+  { 0x06, "©" },
+  { 0x07, "đ" },
+  { 0x08, "€" },
+  { 0x0F, "ł" },
+  { 0x13, "§" },
+  { 0x16, "ß" },
+  { 0x1E, "~" },
+  { 0x1F, "ˇ" },
+  { 0x20, "^" },
+  { 0x21, "˘" },
+  { 0x22, "°" },
+  { 0x23, "˛" },
+  { 0x24, "`" },
+  { 0x25, "˙" },
+  { 0x26, "´" },
+  { 0x27, "˝" },
+  { 0x2D, "¨" },
+  { 0x2E, "¸" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x35, "`" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_148_LAYER_4_ENTRIES[] = {
+  { 0x07, "Đ" },
+  { 0x0F, "Ł" },
+  { 0x2D, "–" },
+  { 0x2E, "±" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x36, "«" },
+  { 0x37, "»" },
+};
+
+const wa_keyboard_mapping LAYOUT_148_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_148_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_148_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_148_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_148_LAYER_2_ENTRIES, 31u,
+  },
+  {
+    "altgr",
+    LAYOUT_148_LAYER_3_ENTRIES, 26u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_148_LAYER_4_ENTRIES, 12u,
+  },
+  {
+    "ctrl",
+    LAYOUT_148_LAYER_5_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_149_LAYER_0_ENTRIES[] = {
+  { 0x04, "а" },
+  { 0x05, "б" },
+  { 0x06, "ц" },
+  { 0x07, "д" },
+  { 0x08, "е" },
+  { 0x09, "ф" },
+  { 0x0A, "г" },
+  { 0x0B, "х" },
+  { 0x0C, "и" },
+  { 0x0D, "й" },
+  { 0x0E, "к" },
+  { 0x0F, "л" },
+  { 0x10, "м" },
+  { 0x11, "н" },
+  { 0x12, "о" },
+  { 0x13, "п" },
+  { 0x14, "я" },
+  { 0x15, "р" },
+  { 0x16, "с" },
+  { 0x17, "т" },
+  { 0x18, "у" },
+  { 0x19, "в" },
+  { 0x1A, "ш" },
+  { 0x1B, "ж" },
+  { 0x1C, "ы" },
+  { 0x1D, "з" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x33, ";" },
+  { 0x34, "ь" },
+  { 0x35, "ъ" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_149_LAYER_1_ENTRIES[] = {
+  { 0x04, "А" },
+  { 0x05, "Б" },
+  { 0x06, "Ц" },
+  { 0x07, "Д" },
+  { 0x08, "Е" },
+  { 0x09, "Ф" },
+  { 0x0A, "Г" },
+  { 0x0B, "Х" },
+  { 0x0C, "И" },
+  { 0x0D, "Й" },
+  { 0x0E, "К" },
+  { 0x0F, "Л" },
+  { 0x10, "М" },
+  { 0x11, "Н" },
+  { 0x12, "О" },
+  { 0x13, "П" },
+  { 0x14, "Я" },
+  { 0x15, "Р" },
+  { 0x16, "С" },
+  { 0x17, "Т" },
+  { 0x18, "У" },
+  { 0x19, "В" },
+  { 0x1A, "Ш" },
+  { 0x1B, "Ж" },
+  { 0x1C, "Ы" },
+  { 0x1D, "З" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "№" },
+  { 0x21, ";" },
+  { 0x22, "%" },
+  { 0x23, ":" },
+  { 0x24, "?" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "/" },
+  { 0x33, ":" },
+  { 0x34, "Ь" },
+  { 0x35, "Ъ" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "/" },
+};
+
+const wa_keyboard_mapping LAYOUT_149_LAYER_2_ENTRIES[] = {
+  { 0x04, "А" },
+  { 0x05, "Б" },
+  { 0x06, "Ц" },
+  { 0x07, "Д" },
+  { 0x08, "Е" },
+  { 0x09, "Ф" },
+  { 0x0A, "Г" },
+  { 0x0B, "Х" },
+  { 0x0C, "И" },
+  { 0x0D, "Й" },
+  { 0x0E, "К" },
+  { 0x0F, "Л" },
+  { 0x10, "М" },
+  { 0x11, "Н" },
+  { 0x12, "О" },
+  { 0x13, "П" },
+  { 0x14, "Я" },
+  { 0x15, "Р" },
+  { 0x16, "С" },
+  { 0x17, "Т" },
+  { 0x18, "У" },
+  { 0x19, "В" },
+  { 0x1A, "Ш" },
+  { 0x1B, "Ж" },
+  { 0x1C, "Ы" },
+  { 0x1D, "З" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x33, ":" },
+  { 0x34, "Ь" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_149_LAYER_3_ENTRIES[] = {
+  { 0x25, "₽" },
+  { 0x34, "’" },
+  { 0x35, "¨" },
+};
+
+const wa_keyboard_mapping LAYOUT_149_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_149_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_149_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_149_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_149_LAYER_2_ENTRIES, 32u,
+  },
+  {
+    "altgr",
+    LAYOUT_149_LAYER_3_ENTRIES, 3u,
+  },
+  {
+    "ctrl",
+    LAYOUT_149_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_150_LAYER_0_ENTRIES[] = {
+  { 0x04, "ф" },
+  { 0x05, "и" },
+  { 0x06, "с" },
+  { 0x07, "в" },
+  { 0x08, "у" },
+  { 0x09, "а" },
+  { 0x0A, "п" },
+  { 0x0B, "р" },
+  { 0x0C, "ш" },
+  { 0x0D, "о" },
+  { 0x0E, "л" },
+  { 0x0F, "д" },
+  { 0x10, "ь" },
+  { 0x11, "т" },
+  { 0x12, "щ" },
+  { 0x13, "з" },
+  { 0x14, "й" },
+  { 0x15, "к" },
+  { 0x16, "ы" },
+  { 0x17, "е" },
+  { 0x18, "г" },
+  { 0x19, "м" },
+  { 0x1A, "ц" },
+  { 0x1B, "ч" },
+  { 0x1C, "н" },
+  { 0x1D, "я" },
+  { 0x1E, "№" },
+  { 0x1F, "-" },
+  { 0x20, "/" },
+  { 0x21, "\"" },
+  { 0x22, ":" },
+  { 0x23, "," },
+  { 0x24, "." },
+  { 0x25, "_" },
+  { 0x26, "?" },
+  { 0x27, "%" },
+  { 0x2C, " " },
+  { 0x2D, "!" },
+  { 0x2E, ";" },
+  { 0x2F, "х" },
+  { 0x30, "ъ" },
+  { 0x31, ")" },
+  { 0x33, "ж" },
+  { 0x34, "э" },
+  { 0x35, "|" },
+  { 0x36, "б" },
+  { 0x37, "ю" },
+  { 0x38, "ё" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, ")" },
+};
+
+const wa_keyboard_mapping LAYOUT_150_LAYER_1_ENTRIES[] = {
+  { 0x04, "Ф" },
+  { 0x05, "И" },
+  { 0x06, "С" },
+  { 0x07, "В" },
+  { 0x08, "У" },
+  { 0x09, "А" },
+  { 0x0A, "П" },
+  { 0x0B, "Р" },
+  { 0x0C, "Ш" },
+  { 0x0D, "О" },
+  { 0x0E, "Л" },
+  { 0x0F, "Д" },
+  { 0x10, "Ь" },
+  { 0x11, "Т" },
+  { 0x12, "Щ" },
+  { 0x13, "З" },
+  { 0x14, "Й" },
+  { 0x15, "К" },
+  { 0x16, "Ы" },
+  { 0x17, "Е" },
+  { 0x18, "Г" },
+  { 0x19, "М" },
+  { 0x1A, "Ц" },
+  { 0x1B, "Ч" },
+  { 0x1C, "Н" },
+  { 0x1D, "Я" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "=" },
+  { 0x2E, "\\" },
+  { 0x2F, "Х" },
+  { 0x30, "Ъ" },
+  { 0x31, "(" },
+  { 0x33, "Ж" },
+  { 0x34, "Э" },
+  { 0x35, "+" },
+  { 0x36, "Б" },
+  { 0x37, "Ю" },
+  { 0x38, "Ё" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "(" },
+};
+
+const wa_keyboard_mapping LAYOUT_150_LAYER_2_ENTRIES[] = {
+  { 0x04, "Ф" },
+  { 0x05, "И" },
+  { 0x06, "С" },
+  { 0x07, "В" },
+  { 0x08, "У" },
+  { 0x09, "А" },
+  { 0x0A, "П" },
+  { 0x0B, "Р" },
+  { 0x0C, "Ш" },
+  { 0x0D, "О" },
+  { 0x0E, "Л" },
+  { 0x0F, "Д" },
+  { 0x10, "Ь" },
+  { 0x11, "Т" },
+  { 0x12, "Щ" },
+  { 0x13, "З" },
+  { 0x14, "Й" },
+  { 0x15, "К" },
+  { 0x16, "Ы" },
+  { 0x17, "Е" },
+  { 0x18, "Г" },
+  { 0x19, "М" },
+  { 0x1A, "Ц" },
+  { 0x1B, "Ч" },
+  { 0x1C, "Н" },
+  { 0x1D, "Я" },
+  { 0x2F, "Х" },
+  { 0x30, "Ъ" },
+  { 0x33, "Ж" },
+  { 0x34, "Э" },
+  { 0x36, "Б" },
+  { 0x37, "Ю" },
+  { 0x38, "Ё" },
+};
+
+const wa_keyboard_mapping LAYOUT_150_LAYER_3_ENTRIES[] = {
+  { 0x25, "₽" },
+};
+
+const wa_keyboard_mapping LAYOUT_150_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_150_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_150_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_150_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_150_LAYER_2_ENTRIES, 33u,
+  },
+  {
+    "altgr",
+    LAYOUT_150_LAYER_3_ENTRIES, 1u,
+  },
+  {
+    "ctrl",
+    LAYOUT_150_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_151_LAYER_0_ENTRIES[] = {
+  { 0x04, "ф" },
+  { 0x05, "и" },
+  { 0x06, "с" },
+  { 0x07, "в" },
+  { 0x08, "у" },
+  { 0x09, "а" },
+  { 0x0A, "п" },
+  { 0x0B, "р" },
+  { 0x0C, "ш" },
+  { 0x0D, "о" },
+  { 0x0E, "л" },
+  { 0x0F, "д" },
+  { 0x10, "ь" },
+  { 0x11, "т" },
+  { 0x12, "щ" },
+  { 0x13, "з" },
+  { 0x14, "й" },
+  { 0x15, "к" },
+  { 0x16, "ы" },
+  { 0x17, "е" },
+  { 0x18, "г" },
+  { 0x19, "м" },
+  { 0x1A, "ц" },
+  { 0x1B, "ч" },
+  { 0x1C, "н" },
+  { 0x1D, "я" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "х" },
+  { 0x30, "ъ" },
+  { 0x31, "\\" },
+  { 0x33, "ж" },
+  { 0x34, "э" },
+  { 0x35, "ё" },
+  { 0x36, "б" },
+  { 0x37, "ю" },
+  { 0x38, "." },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_151_LAYER_1_ENTRIES[] = {
+  { 0x04, "Ф" },
+  { 0x05, "И" },
+  { 0x06, "С" },
+  { 0x07, "В" },
+  { 0x08, "У" },
+  { 0x09, "А" },
+  { 0x0A, "П" },
+  { 0x0B, "Р" },
+  { 0x0C, "Ш" },
+  { 0x0D, "О" },
+  { 0x0E, "Л" },
+  { 0x0F, "Д" },
+  { 0x10, "Ь" },
+  { 0x11, "Т" },
+  { 0x12, "Щ" },
+  { 0x13, "З" },
+  { 0x14, "Й" },
+  { 0x15, "К" },
+  { 0x16, "Ы" },
+  { 0x17, "Е" },
+  { 0x18, "Г" },
+  { 0x19, "М" },
+  { 0x1A, "Ц" },
+  { 0x1B, "Ч" },
+  { 0x1C, "Н" },
+  { 0x1D, "Я" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "№" },
+  { 0x21, ";" },
+  { 0x22, "%" },
+  { 0x23, ":" },
+  { 0x24, "?" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "Х" },
+  { 0x30, "Ъ" },
+  { 0x31, "/" },
+  { 0x33, "Ж" },
+  { 0x34, "Э" },
+  { 0x35, "Ё" },
+  { 0x36, "Б" },
+  { 0x37, "Ю" },
+  { 0x38, "," },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "/" },
+};
+
+const wa_keyboard_mapping LAYOUT_151_LAYER_2_ENTRIES[] = {
+  { 0x04, "Ф" },
+  { 0x05, "И" },
+  { 0x06, "С" },
+  { 0x07, "В" },
+  { 0x08, "У" },
+  { 0x09, "А" },
+  { 0x0A, "П" },
+  { 0x0B, "Р" },
+  { 0x0C, "Ш" },
+  { 0x0D, "О" },
+  { 0x0E, "Л" },
+  { 0x0F, "Д" },
+  { 0x10, "Ь" },
+  { 0x11, "Т" },
+  { 0x12, "Щ" },
+  { 0x13, "З" },
+  { 0x14, "Й" },
+  { 0x15, "К" },
+  { 0x16, "Ы" },
+  { 0x17, "Е" },
+  { 0x18, "Г" },
+  { 0x19, "М" },
+  { 0x1A, "Ц" },
+  { 0x1B, "Ч" },
+  { 0x1C, "Н" },
+  { 0x1D, "Я" },
+  { 0x2F, "Х" },
+  { 0x30, "Ъ" },
+  { 0x33, "Ж" },
+  { 0x34, "Э" },
+  { 0x35, "Ё" },
+  { 0x36, "Б" },
+  { 0x37, "Ю" },
+};
+
+const wa_keyboard_mapping LAYOUT_151_LAYER_3_ENTRIES[] = {
+  { 0x25, "₽" },
+};
+
+const wa_keyboard_mapping LAYOUT_151_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_151_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_151_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_151_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_151_LAYER_2_ENTRIES, 33u,
+  },
+  {
+    "altgr",
+    LAYOUT_151_LAYER_3_ENTRIES, 1u,
+  },
+  {
+    "ctrl",
+    LAYOUT_151_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_152_LAYER_0_ENTRIES[] = {
+  { 0x04, "ф" },
+  { 0x05, "и" },
+  { 0x06, "с" },
+  { 0x07, "в" },
+  { 0x08, "у" },
+  { 0x09, "а" },
+  { 0x0A, "п" },
+  { 0x0B, "р" },
+  { 0x0C, "ш" },
+  { 0x0D, "о" },
+  { 0x0E, "л" },
+  { 0x0F, "д" },
+  { 0x10, "ь" },
+  { 0x11, "т" },
+  { 0x12, "щ" },
+  { 0x13, "з" },
+  { 0x14, "й" },
+  { 0x15, "к" },
+  { 0x16, "ы" },
+  { 0x17, "е" },
+  { 0x18, "г" },
+  { 0x19, "м" },
+  { 0x1A, "ц" },
+  { 0x1B, "ч" },
+  { 0x1C, "н" },
+  { 0x1D, "я" },
+  { 0x1E, "!" },
+  { 0x1F, "нь" },
+  { 0x20, "дь" },
+  { 0x21, "ҥ" },
+  { 0x22, "ҕ" },
+  { 0x23, "ө" },
+  { 0x24, "һ" },
+  { 0x25, "ү" },
+  { 0x26, ";" },
+  { 0x27, ":" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "х" },
+  { 0x30, "ъ" },
+  { 0x31, "\\" },
+  { 0x33, "ж" },
+  { 0x34, "э" },
+  { 0x35, "\"" },
+  { 0x36, "б" },
+  { 0x37, "ю" },
+  { 0x38, "." },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\"" },
+};
+
+const wa_keyboard_mapping LAYOUT_152_LAYER_1_ENTRIES[] = {
+  { 0x04, "Ф" },
+  { 0x05, "И" },
+  { 0x06, "С" },
+  { 0x07, "В" },
+  { 0x08, "У" },
+  { 0x09, "А" },
+  { 0x0A, "П" },
+  { 0x0B, "Р" },
+  { 0x0C, "Ш" },
+  { 0x0D, "О" },
+  { 0x0E, "Л" },
+  { 0x0F, "Д" },
+  { 0x10, "Ь" },
+  { 0x11, "Т" },
+  { 0x12, "Щ" },
+  { 0x13, "З" },
+  { 0x14, "Й" },
+  { 0x15, "К" },
+  { 0x16, "Ы" },
+  { 0x17, "Е" },
+  { 0x18, "Г" },
+  { 0x19, "М" },
+  { 0x1A, "Ц" },
+  { 0x1B, "Ч" },
+  { 0x1C, "Н" },
+  { 0x1D, "Я" },
+  { 0x1E, "?" },
+  { 0x1F, "Нь" },
+  { 0x20, "Дь" },
+  { 0x21, "Ҥ" },
+  { 0x22, "Ҕ" },
+  { 0x23, "Ө" },
+  { 0x24, "Һ" },
+  { 0x25, "Ү" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "Х" },
+  { 0x30, "Ъ" },
+  { 0x31, "/" },
+  { 0x33, "Ж" },
+  { 0x34, "Э" },
+  { 0x35, "№" },
+  { 0x36, "Б" },
+  { 0x37, "Ю" },
+  { 0x38, "," },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "№" },
+};
+
+const wa_keyboard_mapping LAYOUT_152_LAYER_2_ENTRIES[] = {
+  { 0x04, "Ф" },
+  { 0x05, "И" },
+  { 0x06, "С" },
+  { 0x07, "В" },
+  { 0x08, "У" },
+  { 0x09, "А" },
+  { 0x0A, "П" },
+  { 0x0B, "Р" },
+  { 0x0C, "Ш" },
+  { 0x0D, "О" },
+  { 0x0E, "Л" },
+  { 0x0F, "Д" },
+  { 0x10, "Ь" },
+  { 0x11, "Т" },
+  { 0x12, "Щ" },
+  { 0x13, "З" },
+  { 0x14, "Й" },
+  { 0x15, "К" },
+  { 0x16, "Ы" },
+  { 0x17, "Е" },
+  { 0x18, "Г" },
+  { 0x19, "М" },
+  { 0x1A, "Ц" },
+  { 0x1B, "Ч" },
+  { 0x1C, "Н" },
+  { 0x1D, "Я" },
+  { 0x1E, "?" },
+  { 0x1F, "Нь" },
+  { 0x20, "Дь" },
+  { 0x21, "Ҥ" },
+  { 0x22, "Ҕ" },
+  { 0x23, "Ө" },
+  { 0x24, "Һ" },
+  { 0x25, "Ү" },
+  { 0x2F, "Х" },
+  { 0x30, "Ъ" },
+  { 0x33, "Ж" },
+  { 0x34, "Э" },
+  { 0x36, "Б" },
+  { 0x37, "Ю" },
+};
+
+const wa_keyboard_mapping LAYOUT_152_LAYER_3_ENTRIES[] = {
+  { 0x25, "₽" },
+};
+
+const wa_keyboard_mapping LAYOUT_152_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_152_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_152_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_152_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_152_LAYER_2_ENTRIES, 40u,
+  },
+  {
+    "altgr",
+    LAYOUT_152_LAYER_3_ENTRIES, 1u,
+  },
+  {
+    "ctrl",
+    LAYOUT_152_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_153_LAYER_0_ENTRIES[] = {
+  { 0x04, "а" },
+  { 0x05, "б" },
+  { 0x06, "ц" },
+  { 0x07, "д" },
+  { 0x08, "е" },
+  { 0x09, "ф" },
+  { 0x0A, "г" },
+  { 0x0B, "х" },
+  { 0x0C, "и" },
+  { 0x0D, "ј" },
+  { 0x0E, "к" },
+  { 0x0F, "л" },
+  { 0x10, "м" },
+  { 0x11, "н" },
+  { 0x12, "о" },
+  { 0x13, "п" },
+  { 0x14, "љ" },
+  { 0x15, "р" },
+  { 0x16, "с" },
+  { 0x17, "т" },
+  { 0x18, "у" },
+  { 0x19, "в" },
+  { 0x1A, "њ" },
+  { 0x1B, "џ" },
+  { 0x1C, "з" },
+  { 0x1D, "ѕ" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "'" },
+  { 0x2E, "+" },
+  { 0x2F, "ш" },
+  { 0x30, "ђ" },
+  { 0x31, "ж" },
+  { 0x33, "ч" },
+  { 0x34, "ћ" },
+  { 0x35, "`" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "-" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "<" },
+};
+
+const wa_keyboard_mapping LAYOUT_153_LAYER_1_ENTRIES[] = {
+  { 0x04, "А" },
+  { 0x05, "Б" },
+  { 0x06, "Ц" },
+  { 0x07, "Д" },
+  { 0x08, "Е" },
+  { 0x09, "Ф" },
+  { 0x0A, "Г" },
+  { 0x0B, "Х" },
+  { 0x0C, "И" },
+  { 0x0D, "Ј" },
+  { 0x0E, "К" },
+  { 0x0F, "Л" },
+  { 0x10, "М" },
+  { 0x11, "Н" },
+  { 0x12, "О" },
+  { 0x13, "П" },
+  { 0x14, "Љ" },
+  { 0x15, "Р" },
+  { 0x16, "С" },
+  { 0x17, "Т" },
+  { 0x18, "У" },
+  { 0x19, "В" },
+  { 0x1A, "Њ" },
+  { 0x1B, "Џ" },
+  { 0x1C, "З" },
+  { 0x1D, "Ѕ" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "&" },
+  { 0x24, "/" },
+  { 0x25, "(" },
+  { 0x26, ")" },
+  { 0x27, "=" },
+  { 0x2C, " " },
+  { 0x2D, "?" },
+  { 0x2E, "*" },
+  { 0x2F, "Ш" },
+  { 0x30, "Ђ" },
+  { 0x31, "Ж" },
+  { 0x33, "Ч" },
+  { 0x34, "Ћ" },
+  { 0x35, "~" },
+  { 0x36, ";" },
+  { 0x37, ":" },
+  { 0x38, "_" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_153_LAYER_2_ENTRIES[] = {
+  { 0x04, "А" },
+  { 0x05, "Б" },
+  { 0x06, "Ц" },
+  { 0x07, "Д" },
+  { 0x08, "Е" },
+  { 0x09, "Ф" },
+  { 0x0A, "Г" },
+  { 0x0B, "Х" },
+  { 0x0C, "И" },
+  { 0x0D, "Ј" },
+  { 0x0E, "К" },
+  { 0x0F, "Л" },
+  { 0x10, "М" },
+  { 0x11, "Н" },
+  { 0x12, "О" },
+  { 0x13, "П" },
+  { 0x14, "Љ" },
+  { 0x15, "Р" },
+  { 0x16, "С" },
+  { 0x17, "Т" },
+  { 0x18, "У" },
+  { 0x19, "В" },
+  { 0x1A, "Њ" },
+  { 0x1B, "Џ" },
+  { 0x1C, "З" },
+  { 0x1D, "Ѕ" },
+  { 0x2F, "Ш" },
+  { 0x30, "Ђ" },
+  { 0x31, "Ж" },
+  { 0x33, "Ч" },
+  { 0x34, "Ћ" },
+};
+
+const wa_keyboard_mapping LAYOUT_153_LAYER_3_ENTRIES[] = {
+  { 0x08, "€" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_153_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_153_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_153_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_153_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_153_LAYER_2_ENTRIES, 31u,
+  },
+  {
+    "altgr",
+    LAYOUT_153_LAYER_3_ENTRIES, 3u,
+  },
+  {
+    "ctrl",
+    LAYOUT_153_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_154_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "z" },
+  { 0x1D, "y" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "'" },
+  { 0x2E, "+" },
+  { 0x2F, "š" },
+  { 0x30, "đ" },
+  { 0x31, "ž" },
+  { 0x33, "č" },
+  { 0x34, "ć" },
+  { 0x35, "‚" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "-" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "<" },
+};
+
+const wa_keyboard_mapping LAYOUT_154_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Z" },
+  { 0x1D, "Y" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "&" },
+  { 0x24, "/" },
+  { 0x25, "(" },
+  { 0x26, ")" },
+  { 0x27, "=" },
+  { 0x2C, " " },
+  { 0x2D, "?" },
+  { 0x2E, "*" },
+  { 0x2F, "Š" },
+  { 0x30, "Đ" },
+  { 0x31, "Ž" },
+  { 0x33, "Č" },
+  { 0x34, "Ć" },
+  { 0x35, "~" },
+  { 0x36, ";" },
+  { 0x37, ":" },
+  { 0x38, "_" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_154_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Z" },
+  { 0x1D, "Y" },
+  { 0x2F, "Š" },
+  { 0x30, "Đ" },
+  { 0x31, "Ž" },
+  { 0x33, "Č" },
+  { 0x34, "Ć" },
+};
+
+const wa_keyboard_mapping LAYOUT_154_LAYER_3_ENTRIES[] = {
+  { 0x05, "{" },
+  { 0x08, "€" },
+  { 0x09, "[" },
+  { 0x0A, "]" },
+  { 0x0E, "ł" },
+  { 0x0F, "Ł" },
+  { 0x10, "§" },
+  { 0x11, "}" },
+  { 0x14, "\\" },
+  { 0x19, "@" },
+  { 0x1A, "|" },
+  { 0x1E, "~" },
+  { 0x1F, "ˇ" },
+  { 0x20, "^" },
+  { 0x21, "˘" },
+  { 0x22, "°" },
+  { 0x23, "˛" },
+  { 0x24, "`" },
+  { 0x25, "˙" },
+  { 0x26, "´" },
+  { 0x27, "˝" },
+  { 0x2D, "¨" },
+  { 0x2E, "¸" },
+  { 0x2F, "÷" },
+  { 0x30, "×" },
+  { 0x31, "¤" },
+  { 0x34, "ß" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_154_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_154_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_154_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_154_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_154_LAYER_2_ENTRIES, 31u,
+  },
+  {
+    "altgr",
+    LAYOUT_154_LAYER_3_ENTRIES, 29u,
+  },
+  {
+    "ctrl",
+    LAYOUT_154_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_155_LAYER_0_ENTRIES[] = {
+  { 0x04, "්" },
+  { 0x05, "ඉ" },
+  { 0x06, "ජ" },
+  { 0x07, "ා" },
+  { 0x08, "ැ" },
+  { 0x09, "ෙ" },
+  { 0x0A, "ට" },
+  { 0x0B, "ය" },
+  { 0x0C, "ස" },
+  { 0x0D, "ව" },
+  { 0x0E, "න" },
+  { 0x0F, "ක" },
+  { 0x10, "ප" },
+  { 0x11, "බ" },
+  { 0x12, "ද" },
+  { 0x13, "ච" },
+  { 0x14, "ු" },
+  { 0x15, "ර" },
+  { 0x16, "ි" },
+  { 0x17, "එ" },
+  { 0x18, "ම" },
+  { 0x19, "ඩ" },
+  { 0x1A, "අ" },
+  { 0x1B, "ං" },
+  { 0x1C, "හ" },
+  { 0x1D, "'" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "ඤ" },
+  { 0x30, ";" },
+  { 0x31, "්‍" },
+  { 0x33, "ත" },
+  { 0x34, "." },
+  { 0x35, "්‍ර" },
+  { 0x36, "ල" },
+  { 0x37, "ග" },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_155_LAYER_1_ENTRIES[] = {
+  { 0x04, "ෟ" },
+  { 0x05, "ඊ" },
+  { 0x06, "ඣ" },
+  { 0x07, "ෘ" },
+  { 0x08, "ෑ" },
+  { 0x09, "ෆ" },
+  { 0x0A, "ඨ" },
+  { 0x0B, "්‍ය" },
+  { 0x0C, "ෂ" },
+  { 0x0D, "ළු" },
+  { 0x0E, "ණ" },
+  { 0x0F, "ඛ" },
+  { 0x10, "ඵ" },
+  { 0x11, "භ" },
+  { 0x12, "ධ" },
+  { 0x13, "ඡ" },
+  { 0x14, "ූ" },
+  { 0x15, "ඍ" },
+  { 0x16, "ී" },
+  { 0x17, "ඔ" },
+  { 0x18, "ඹ" },
+  { 0x19, "ඪ" },
+  { 0x1A, "උ" },
+  { 0x1B, "ඃ" },
+  { 0x1C, "ශ" },
+  { 0x1D, "\"" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "ඥ" },
+  { 0x30, ":" },
+  { 0x33, "ථ" },
+  { 0x34, "," },
+  { 0x35, "ර්‍" },
+  { 0x36, "ළ" },
+  { 0x37, "ඝ" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_155_LAYER_2_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x33, ";" },
+  { 0x35, "`" },
+  { 0x36, "," },
+  { 0x37, "." },
+};
+
+const wa_keyboard_mapping LAYOUT_155_LAYER_3_ENTRIES[] = {
+  { 0x04, "ෳ" },
+  { 0x05, "ඐ" },
+  { 0x06, "ඦ" },
+  { 0x07, "ෲ" },
+  { 0x08, "ෛ" },
+  { 0x09, "ආ" },
+  { 0x0A, "ඇ" },
+  { 0x0B, "ඈ" },
+  { 0x0D, "‍" },
+  { 0x0E, "ඓ" },
+  { 0x0F, "ඕ" },
+  { 0x11, "‌" },
+  { 0x12, "ඳ" },
+  { 0x14, "ෞ" },
+  { 0x15, "ේ" },
+  { 0x16, "ෝ" },
+  { 0x17, "ඒ" },
+  { 0x19, "ඬ" },
+  { 0x1A, "ො" },
+  { 0x1B, "ඞ" },
+  { 0x1C, "ඎ" },
+  { 0x1D, "ඌ" },
+  { 0x1E, "¡" },
+  { 0x1F, "²" },
+  { 0x20, "³" },
+  { 0x21, "¤" },
+  { 0x22, "€" },
+  { 0x23, "¼" },
+  { 0x24, "½" },
+  { 0x25, "¾" },
+  { 0x26, "‘" },
+  { 0x27, "’" },
+  { 0x2D, "¥" },
+  { 0x2E, "×" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x33, "ඖ" },
+  { 0x34, "෴" },
+  { 0x35, "`" },
+  { 0x36, "ඏ" },
+  { 0x37, "ඟ" },
+};
+
+const wa_keyboard_mapping LAYOUT_155_LAYER_4_ENTRIES[] = {
+  { 0x1E, "¹" },
+  { 0x21, "£" },
+  { 0x2E, "÷" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "|" },
+  { 0x35, "~" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_155_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x36, "<" },
+};
+
+const wa_keyboard_layer LAYOUT_155_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_155_LAYER_0_ENTRIES, 52u,
+  },
+  {
+    "shift",
+    LAYOUT_155_LAYER_1_ENTRIES, 51u,
+  },
+  {
+    "caps",
+    LAYOUT_155_LAYER_2_ENTRIES, 33u,
+  },
+  {
+    "altgr",
+    LAYOUT_155_LAYER_3_ENTRIES, 42u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_155_LAYER_4_ENTRIES, 9u,
+  },
+  {
+    "ctrl",
+    LAYOUT_155_LAYER_5_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_156_LAYER_0_ENTRIES[] = {
+  { 0x04, "්" },
+  { 0x05, "ඉ" },
+  { 0x06, "ජ" },
+  { 0x07, "ා" },
+  { 0x08, "ැ" },
+  { 0x09, "ෙ" },
+  { 0x0A, "ට" },
+  { 0x0B, "ය" },
+  { 0x0C, "ස" },
+  { 0x0D, "ව" },
+  { 0x0E, "න" },
+  { 0x0F, "ක" },
+  { 0x10, "ප" },
+  { 0x11, "බ" },
+  { 0x12, "ද" },
+  { 0x13, "ච" },
+  { 0x14, "ු" },
+  { 0x15, "ර" },
+  { 0x16, "ි" },
+  { 0x17, "ඒ" },
+  { 0x18, "ම" },
+  { 0x19, "ඩ" },
+  { 0x1A, "අ" },
+  { 0x1B, "ං" },
+  { 0x1C, "හ" },
+  { 0x1D, "'" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "ඤ" },
+  { 0x30, ";" },
+  { 0x31, "‍" },
+  { 0x33, "ත" },
+  { 0x34, "." },
+  { 0x35, "්‍ර" },
+  { 0x36, "ල" },
+  { 0x37, "ග" },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "‍" },
+};
+
+const wa_keyboard_mapping LAYOUT_156_LAYER_1_ENTRIES[] = {
+  { 0x04, "ෟ" },
+  { 0x05, "ඊ" },
+  { 0x06, "ඣ" },
+  { 0x07, "ෘ" },
+  { 0x08, "ෑ" },
+  { 0x09, "ෆ" },
+  { 0x0A, "ඨ" },
+  { 0x0B, "්‍ය" },
+  { 0x0C, "ෂ" },
+  { 0x0D, "ළු" },
+  { 0x0E, "ණ" },
+  { 0x0F, "ඛ" },
+  { 0x10, "ඵ" },
+  { 0x11, "භ" },
+  { 0x12, "ධ" },
+  { 0x13, "ඡ" },
+  { 0x14, "ූ" },
+  { 0x15, "ඍ" },
+  { 0x16, "ී" },
+  { 0x17, "ඔ" },
+  { 0x18, "ඹ" },
+  { 0x19, "ඪ" },
+  { 0x1A, "උ" },
+  { 0x1B, "ඃ" },
+  { 0x1C, "ශ" },
+  { 0x1D, "\"" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "$" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "ඥ" },
+  { 0x30, ":" },
+  { 0x31, " " },
+  { 0x33, "ථ" },
+  { 0x34, "," },
+  { 0x35, "ර්‍" },
+  { 0x36, "ළ" },
+  { 0x37, "ඝ" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, " " },
+};
+
+const wa_keyboard_mapping LAYOUT_156_LAYER_2_ENTRIES[] = {
+  { 0x04, "ෳ" },
+  { 0x05, "ඐ" },
+  { 0x06, "ඦ" },
+  { 0x07, "ෲ" },
+  { 0x08, "ෛ" },
+  { 0x09, "ආ" },
+  { 0x0A, "ඇ" },
+  { 0x0B, "ඈ" },
+  { 0x0E, "ඓ" },
+  { 0x0F, "ඕ" },
+  { 0x12, "ඳ" },
+  { 0x14, "ෞ" },
+  { 0x15, "ේ" },
+  { 0x16, "ෝ" },
+  { 0x17, "එ" },
+  { 0x19, "ඬ" },
+  { 0x1A, "ො" },
+  { 0x1B, "ඞ" },
+  { 0x1C, "ඎ" },
+  { 0x1D, "ඌ" },
+  { 0x33, "ඖ" },
+  { 0x34, "෴" },
+  { 0x36, "ඏ" },
+  { 0x37, "ඟ" },
+};
+
+const wa_keyboard_mapping LAYOUT_156_LAYER_3_ENTRIES[] = {
+  { 0x2A, "" },
+};
+
+const wa_keyboard_layer LAYOUT_156_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_156_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_156_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "altgr",
+    LAYOUT_156_LAYER_2_ENTRIES, 24u,
+  },
+  {
+    "ctrl",
+    LAYOUT_156_LAYER_3_ENTRIES, 1u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_157_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "+" },
+  { 0x1F, "ľ" },
+  { 0x20, "š" },
+  { 0x21, "č" },
+  { 0x22, "ť" },
+  { 0x23, "ž" },
+  { 0x24, "ý" },
+  { 0x25, "á" },
+  { 0x26, "í" },
+  { 0x27, "é" },
+  { 0x2C, " " },
+  { 0x2D, "=" },
+  { 0x2E, "´" },
+  { 0x2F, "ú" },
+  { 0x30, "ä" },
+  { 0x31, "ň" },
+  { 0x33, "ô" },
+  { 0x34, "§" },
+  { 0x35, ";" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "-" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "&" },
+};
+
+const wa_keyboard_mapping LAYOUT_157_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "%" },
+  { 0x2E, "ˇ" },
+  { 0x2F, "/" },
+  { 0x30, "(" },
+  { 0x31, ")" },
+  { 0x33, "\"" },
+  { 0x34, "!" },
+  { 0x35, "°" },
+  { 0x36, "?" },
+  { 0x37, ":" },
+  { 0x38, "_" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "*" },
+};
+
+const wa_keyboard_mapping LAYOUT_157_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+};
+
+const wa_keyboard_mapping LAYOUT_157_LAYER_3_ENTRIES[] = {
+  { 0x05, "{" },
+  { 0x06, "&" },
+  { 0x07, "Đ" },
+  { 0x08, "€" },
+  { 0x09, "[" },
+  { 0x0A, "]" },
+  { 0x0E, "ł" },
+  { 0x0F, "Ł" },
+  { 0x11, "}" },
+  { 0x13, "'" },
+  { 0x14, "\\" },
+  { 0x16, "đ" },
+  { 0x19, "@" },
+  { 0x1A, "|" },
+  { 0x1B, "#" },
+  { 0x1D, ">" },
+  { 0x1E, "~" },
+  { 0x1F, "ˇ" },
+  { 0x20, "^" },
+  { 0x21, "˘" },
+  { 0x22, "°" },
+  { 0x23, "˛" },
+  { 0x24, "`" },
+  { 0x25, "˙" },
+  { 0x26, "´" },
+  { 0x27, "˝" },
+  { 0x2D, "¨" },
+  { 0x2E, "¸" },
+  { 0x2F, "÷" },
+  { 0x30, "×" },
+  { 0x31, "¤" },
+  { 0x33, "$" },
+  { 0x34, "ß" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "*" },
+  { 0x64, "<" },
+};
+
+const wa_keyboard_mapping LAYOUT_157_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_157_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_157_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_157_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_157_LAYER_2_ENTRIES, 26u,
+  },
+  {
+    "altgr",
+    LAYOUT_157_LAYER_3_ENTRIES, 37u,
+  },
+  {
+    "ctrl",
+    LAYOUT_157_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_158_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "z" },
+  { 0x1D, "y" },
+  { 0x1E, "+" },
+  { 0x1F, "ľ" },
+  { 0x20, "š" },
+  { 0x21, "č" },
+  { 0x22, "ť" },
+  { 0x23, "ž" },
+  { 0x24, "ý" },
+  { 0x25, "á" },
+  { 0x26, "í" },
+  { 0x27, "é" },
+  { 0x2C, " " },
+  { 0x2D, "=" },
+  { 0x2E, "´" },
+  { 0x2F, "ú" },
+  { 0x30, "ä" },
+  { 0x31, "ň" },
+  { 0x33, "ô" },
+  { 0x34, "§" },
+  { 0x35, ";" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "-" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "&" },
+};
+
+const wa_keyboard_mapping LAYOUT_158_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Z" },
+  { 0x1D, "Y" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "%" },
+  { 0x2E, "ˇ" },
+  { 0x2F, "/" },
+  { 0x30, "(" },
+  { 0x31, ")" },
+  { 0x33, "\"" },
+  { 0x34, "!" },
+  { 0x35, "°" },
+  { 0x36, "?" },
+  { 0x37, ":" },
+  { 0x38, "_" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "*" },
+};
+
+const wa_keyboard_mapping LAYOUT_158_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Z" },
+  { 0x1D, "Y" },
+};
+
+const wa_keyboard_mapping LAYOUT_158_LAYER_3_ENTRIES[] = {
+  { 0x05, "{" },
+  { 0x06, "&" },
+  { 0x07, "Đ" },
+  { 0x08, "€" },
+  { 0x09, "[" },
+  { 0x0A, "]" },
+  { 0x0E, "ł" },
+  { 0x0F, "Ł" },
+  { 0x11, "}" },
+  { 0x13, "'" },
+  { 0x14, "\\" },
+  { 0x16, "đ" },
+  { 0x19, "@" },
+  { 0x1A, "|" },
+  { 0x1B, "#" },
+  { 0x1D, ">" },
+  { 0x1E, "~" },
+  { 0x1F, "ˇ" },
+  { 0x20, "^" },
+  { 0x21, "˘" },
+  { 0x22, "°" },
+  { 0x23, "˛" },
+  { 0x24, "`" },
+  { 0x25, "˙" },
+  { 0x26, "´" },
+  { 0x27, "˝" },
+  { 0x2D, "¨" },
+  { 0x2E, "¸" },
+  { 0x2F, "÷" },
+  { 0x30, "×" },
+  { 0x31, "¤" },
+  { 0x33, "$" },
+  { 0x34, "ß" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "*" },
+  { 0x64, "<" },
+};
+
+const wa_keyboard_mapping LAYOUT_158_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_158_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_158_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_158_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_158_LAYER_2_ENTRIES, 26u,
+  },
+  {
+    "altgr",
+    LAYOUT_158_LAYER_3_ENTRIES, 37u,
+  },
+  {
+    "ctrl",
+    LAYOUT_158_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_159_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "z" },
+  { 0x1D, "y" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "'" },
+  { 0x2E, "+" },
+  { 0x2F, "š" },
+  { 0x30, "đ" },
+  { 0x31, "ž" },
+  { 0x33, "č" },
+  { 0x34, "ć" },
+  { 0x35, "¸" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "-" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "<" },
+};
+
+const wa_keyboard_mapping LAYOUT_159_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Z" },
+  { 0x1D, "Y" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "&" },
+  { 0x24, "/" },
+  { 0x25, "(" },
+  { 0x26, ")" },
+  { 0x27, "=" },
+  { 0x2C, " " },
+  { 0x2D, "?" },
+  { 0x2E, "*" },
+  { 0x2F, "Š" },
+  { 0x30, "Đ" },
+  { 0x31, "Ž" },
+  { 0x33, "Č" },
+  { 0x34, "Ć" },
+  { 0x35, "¨" },
+  { 0x36, ";" },
+  { 0x37, ":" },
+  { 0x38, "_" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_159_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Z" },
+  { 0x1D, "Y" },
+  { 0x2F, "Š" },
+  { 0x30, "Đ" },
+  { 0x31, "Ž" },
+  { 0x33, "Č" },
+  { 0x34, "Ć" },
+};
+
+const wa_keyboard_mapping LAYOUT_159_LAYER_3_ENTRIES[] = {
+  { 0x05, "{" },
+  { 0x08, "€" },
+  { 0x09, "[" },
+  { 0x0A, "]" },
+  { 0x0E, "ł" },
+  { 0x0F, "Ł" },
+  { 0x10, "§" },
+  { 0x11, "}" },
+  { 0x14, "\\" },
+  { 0x19, "@" },
+  { 0x1A, "|" },
+  { 0x1E, "~" },
+  { 0x1F, "ˇ" },
+  { 0x20, "^" },
+  { 0x21, "˘" },
+  { 0x22, "°" },
+  { 0x23, "˛" },
+  { 0x24, "`" },
+  { 0x25, "˙" },
+  { 0x26, "´" },
+  { 0x27, "˝" },
+  { 0x2D, "¨" },
+  { 0x2E, "¸" },
+  { 0x2F, "÷" },
+  { 0x30, "×" },
+  { 0x31, "¤" },
+  { 0x34, "ß" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_159_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_159_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_159_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_159_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_159_LAYER_2_ENTRIES, 31u,
+  },
+  {
+    "altgr",
+    LAYOUT_159_LAYER_3_ENTRIES, 29u,
+  },
+  {
+    "ctrl",
+    LAYOUT_159_LAYER_4_ENTRIES, 2u,
+  },
+};
+
@@ -0,0 +1,6741 @@
+#include "worldalphabets_data.h"
+
+const wa_keyboard_mapping LAYOUT_160_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "z" },
+  { 0x1D, "y" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "ç" },
+  { 0x30, "@" },
+  { 0x31, "]" },
+  { 0x33, "ë" },
+  { 0x34, "[" },
+  { 0x35, "\\" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "<" },
+};
+
+const wa_keyboard_mapping LAYOUT_160_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Z" },
+  { 0x1D, "Y" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "Ç" },
+  { 0x30, "'" },
+  { 0x31, "}" },
+  { 0x33, "Ë" },
+  { 0x34, "{" },
+  { 0x35, "|" },
+  { 0x36, ";" },
+  { 0x37, ":" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_160_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Z" },
+  { 0x1D, "Y" },
+  { 0x2F, "Ç" },
+  { 0x33, "Ë" },
+};
+
+const wa_keyboard_mapping LAYOUT_160_LAYER_3_ENTRIES[] = {
+  { 0x05, "{" },
+  { 0x07, "Đ" },
+  { 0x09, "[" },
+  { 0x0A, "]" },
+  { 0x0E, "ł" },
+  { 0x0F, "Ł" },
+  { 0x10, "§" },
+  { 0x11, "}" },
+  { 0x14, "\\" },
+  { 0x16, "đ" },
+  { 0x19, "@" },
+  { 0x1A, "|" },
+  { 0x1E, "~" },
+  { 0x1F, "ˇ" },
+  { 0x20, "^" },
+  { 0x21, "˘" },
+  { 0x22, "°" },
+  { 0x23, "˛" },
+  { 0x24, "`" },
+  { 0x25, "˙" },
+  { 0x26, "´" },
+  { 0x27, "˝" },
+  { 0x2D, "¨" },
+  { 0x2E, "¸" },
+  { 0x2F, "÷" },
+  { 0x30, "×" },
+  { 0x31, "¤" },
+  { 0x33, "$" },
+  { 0x34, "ß" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_160_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_160_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_160_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_160_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_160_LAYER_2_ENTRIES, 28u,
+  },
+  {
+    "altgr",
+    LAYOUT_160_LAYER_3_ENTRIES, 31u,
+  },
+  {
+    "ctrl",
+    LAYOUT_160_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_161_LAYER_0_ENTRIES[] = {
+  { 0x04, "а" },
+  { 0x05, "б" },
+  { 0x06, "ц" },
+  { 0x07, "д" },
+  { 0x08, "е" },
+  { 0x09, "ф" },
+  { 0x0A, "г" },
+  { 0x0B, "х" },
+  { 0x0C, "и" },
+  { 0x0D, "ј" },
+  { 0x0E, "к" },
+  { 0x0F, "л" },
+  { 0x10, "м" },
+  { 0x11, "н" },
+  { 0x12, "о" },
+  { 0x13, "п" },
+  { 0x14, "љ" },
+  { 0x15, "р" },
+  { 0x16, "с" },
+  { 0x17, "т" },
+  { 0x18, "у" },
+  { 0x19, "в" },
+  { 0x1A, "њ" },
+  { 0x1B, "џ" },
+  { 0x1C, "з" },
+  { 0x1D, "ѕ" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "'" },
+  { 0x2E, "+" },
+  { 0x2F, "ш" },
+  { 0x30, "ђ" },
+  { 0x31, "ж" },
+  { 0x33, "ч" },
+  { 0x34, "ћ" },
+  { 0x35, "`" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "-" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "<" },
+};
+
+const wa_keyboard_mapping LAYOUT_161_LAYER_1_ENTRIES[] = {
+  { 0x04, "А" },
+  { 0x05, "Б" },
+  { 0x06, "Ц" },
+  { 0x07, "Д" },
+  { 0x08, "Е" },
+  { 0x09, "Ф" },
+  { 0x0A, "Г" },
+  { 0x0B, "Х" },
+  { 0x0C, "И" },
+  { 0x0D, "Ј" },
+  { 0x0E, "К" },
+  { 0x0F, "Л" },
+  { 0x10, "М" },
+  { 0x11, "Н" },
+  { 0x12, "О" },
+  { 0x13, "П" },
+  { 0x14, "Љ" },
+  { 0x15, "Р" },
+  { 0x16, "С" },
+  { 0x17, "Т" },
+  { 0x18, "У" },
+  { 0x19, "В" },
+  { 0x1A, "Њ" },
+  { 0x1B, "Џ" },
+  { 0x1C, "З" },
+  { 0x1D, "Ѕ" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "&" },
+  { 0x24, "/" },
+  { 0x25, "(" },
+  { 0x26, ")" },
+  { 0x27, "=" },
+  { 0x2C, " " },
+  { 0x2D, "?" },
+  { 0x2E, "*" },
+  { 0x2F, "Ш" },
+  { 0x30, "Ђ" },
+  { 0x31, "Ж" },
+  { 0x33, "Ч" },
+  { 0x34, "Ћ" },
+  { 0x35, "~" },
+  { 0x36, ";" },
+  { 0x37, ":" },
+  { 0x38, "_" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_161_LAYER_2_ENTRIES[] = {
+  { 0x04, "А" },
+  { 0x05, "Б" },
+  { 0x06, "Ц" },
+  { 0x07, "Д" },
+  { 0x08, "Е" },
+  { 0x09, "Ф" },
+  { 0x0A, "Г" },
+  { 0x0B, "Х" },
+  { 0x0C, "И" },
+  { 0x0D, "Ј" },
+  { 0x0E, "К" },
+  { 0x0F, "Л" },
+  { 0x10, "М" },
+  { 0x11, "Н" },
+  { 0x12, "О" },
+  { 0x13, "П" },
+  { 0x14, "Љ" },
+  { 0x15, "Р" },
+  { 0x16, "С" },
+  { 0x17, "Т" },
+  { 0x18, "У" },
+  { 0x19, "В" },
+  { 0x1A, "Њ" },
+  { 0x1B, "Џ" },
+  { 0x1C, "З" },
+  { 0x1D, "Ѕ" },
+  { 0x2F, "Ш" },
+  { 0x30, "Ђ" },
+  { 0x31, "Ж" },
+  { 0x33, "Ч" },
+  { 0x34, "Ћ" },
+};
+
+const wa_keyboard_mapping LAYOUT_161_LAYER_3_ENTRIES[] = {
+  { 0x08, "€" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_161_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_161_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_161_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_161_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_161_LAYER_2_ENTRIES, 31u,
+  },
+  {
+    "altgr",
+    LAYOUT_161_LAYER_3_ENTRIES, 3u,
+  },
+  {
+    "ctrl",
+    LAYOUT_161_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_162_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "z" },
+  { 0x1D, "y" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "'" },
+  { 0x2E, "+" },
+  { 0x2F, "š" },
+  { 0x30, "đ" },
+  { 0x31, "ž" },
+  { 0x33, "č" },
+  { 0x34, "ć" },
+  { 0x35, "‚" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "-" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "<" },
+};
+
+const wa_keyboard_mapping LAYOUT_162_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Z" },
+  { 0x1D, "Y" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "&" },
+  { 0x24, "/" },
+  { 0x25, "(" },
+  { 0x26, ")" },
+  { 0x27, "=" },
+  { 0x2C, " " },
+  { 0x2D, "?" },
+  { 0x2E, "*" },
+  { 0x2F, "Š" },
+  { 0x30, "Đ" },
+  { 0x31, "Ž" },
+  { 0x33, "Č" },
+  { 0x34, "Ć" },
+  { 0x35, "~" },
+  { 0x36, ";" },
+  { 0x37, ":" },
+  { 0x38, "_" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_162_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Z" },
+  { 0x1D, "Y" },
+  { 0x2F, "Š" },
+  { 0x30, "Đ" },
+  { 0x31, "Ž" },
+  { 0x33, "Č" },
+  { 0x34, "Ć" },
+};
+
+const wa_keyboard_mapping LAYOUT_162_LAYER_3_ENTRIES[] = {
+  { 0x05, "{" },
+  { 0x08, "€" },
+  { 0x09, "[" },
+  { 0x0A, "]" },
+  { 0x0E, "ł" },
+  { 0x0F, "Ł" },
+  { 0x10, "§" },
+  { 0x11, "}" },
+  { 0x14, "\\" },
+  { 0x19, "@" },
+  { 0x1A, "|" },
+  { 0x1E, "~" },
+  { 0x1F, "ˇ" },
+  { 0x20, "^" },
+  { 0x21, "˘" },
+  { 0x22, "°" },
+  { 0x23, "˛" },
+  { 0x24, "`" },
+  { 0x25, "˙" },
+  { 0x26, "´" },
+  { 0x27, "˝" },
+  { 0x2D, "¨" },
+  { 0x2E, "¸" },
+  { 0x2F, "÷" },
+  { 0x30, "×" },
+  { 0x31, "¤" },
+  { 0x34, "ß" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_162_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_162_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_162_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_162_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_162_LAYER_2_ENTRIES, 31u,
+  },
+  {
+    "altgr",
+    LAYOUT_162_LAYER_3_ENTRIES, 29u,
+  },
+  {
+    "ctrl",
+    LAYOUT_162_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_163_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "+" },
+  { 0x2E, "´" },
+  { 0x2F, "å" },
+  { 0x30, "¨" },
+  { 0x31, "'" },
+  { 0x33, "ö" },
+  { 0x34, "ä" },
+  { 0x35, "§" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "-" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "<" },
+};
+
+const wa_keyboard_mapping LAYOUT_163_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "#" },
+  { 0x21, "¤" },
+  { 0x22, "%" },
+  { 0x23, "&" },
+  { 0x24, "/" },
+  { 0x25, "(" },
+  { 0x26, ")" },
+  { 0x27, "=" },
+  { 0x2C, " " },
+  { 0x2D, "?" },
+  { 0x2E, "`" },
+  { 0x2F, "Å" },
+  { 0x30, "^" },
+  { 0x31, "*" },
+  { 0x33, "Ö" },
+  { 0x34, "Ä" },
+  { 0x35, "½" },
+  { 0x36, ";" },
+  { 0x37, ":" },
+  { 0x38, "_" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_163_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x2F, "Å" },
+  { 0x33, "Ö" },
+  { 0x34, "Ä" },
+};
+
+const wa_keyboard_mapping LAYOUT_163_LAYER_3_ENTRIES[] = {
+  { 0x04, "á" },
+  { 0x05, "ʒ" },
+  { 0x06, "č" },
+  { 0x07, "đ" },
+  { 0x08, "€" },
+  { 0x09, "ǥ" },
+  { 0x0A, "ǧ" },
+  { 0x0B, "ȟ" },
+  { 0x0C, "ï" },
+  { 0x0E, "ǩ" },
+  { 0x10, "µ" },
+  { 0x11, "ŋ" },
+  { 0x12, "õ" },
+  { 0x14, "â" },
+  { 0x16, "š" },
+  { 0x17, "ŧ" },
+  { 0x19, "ǯ" },
+  { 0x1D, "ž" },
+  { 0x1F, "@" },
+  { 0x20, "£" },
+  { 0x21, "$" },
+  { 0x22, "€" },
+  { 0x24, "{" },
+  { 0x25, "[" },
+  { 0x26, "]" },
+  { 0x27, "}" },
+  { 0x2D, "\\" },
+  { 0x30, "~" },
+  { 0x33, "ø" },
+  { 0x34, "æ" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_163_LAYER_4_ENTRIES[] = {
+  { 0x04, "Á" },
+  { 0x05, "Ʒ" },
+  { 0x06, "Č" },
+  { 0x07, "Đ" },
+  { 0x09, "Ǥ" },
+  { 0x0A, "Ǧ" },
+  { 0x0B, "Ȟ" },
+  { 0x0C, "Ï" },
+  { 0x0E, "Ǩ" },
+  { 0x11, "Ŋ" },
+  { 0x12, "Õ" },
+  { 0x14, "Â" },
+  { 0x16, "Š" },
+  { 0x17, "Ŧ" },
+  { 0x19, "Ǯ" },
+  { 0x1D, "Ž" },
+  { 0x33, "Ø" },
+  { 0x34, "Æ" },
+};
+
+const wa_keyboard_mapping LAYOUT_163_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_163_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_163_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_163_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_163_LAYER_2_ENTRIES, 29u,
+  },
+  {
+    "altgr",
+    LAYOUT_163_LAYER_3_ENTRIES, 31u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_163_LAYER_4_ENTRIES, 18u,
+  },
+  {
+    "ctrl",
+    LAYOUT_163_LAYER_5_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_164_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "+" },
+  { 0x2E, "´" },
+  { 0x2F, "å" },
+  { 0x30, "¨" },
+  { 0x31, "'" },
+  { 0x33, "ö" },
+  { 0x34, "ä" },
+  { 0x35, "§" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "-" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "<" },
+};
+
+const wa_keyboard_mapping LAYOUT_164_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "#" },
+  { 0x21, "¤" },
+  { 0x22, "%" },
+  { 0x23, "&" },
+  { 0x24, "/" },
+  { 0x25, "(" },
+  { 0x26, ")" },
+  { 0x27, "=" },
+  { 0x2C, " " },
+  { 0x2D, "?" },
+  { 0x2E, "`" },
+  { 0x2F, "Å" },
+  { 0x30, "^" },
+  { 0x31, "*" },
+  { 0x33, "Ö" },
+  { 0x34, "Ä" },
+  { 0x35, "½" },
+  { 0x36, ";" },
+  { 0x37, ":" },
+  { 0x38, "_" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_164_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x2F, "Å" },
+  { 0x33, "Ö" },
+  { 0x34, "Ä" },
+};
+
+const wa_keyboard_mapping LAYOUT_164_LAYER_3_ENTRIES[] = {
+  { 0x08, "€" },
+  { 0x10, "µ" },
+  { 0x1F, "@" },
+  { 0x20, "£" },
+  { 0x21, "$" },
+  { 0x22, "€" },
+  { 0x24, "{" },
+  { 0x25, "[" },
+  { 0x26, "]" },
+  { 0x27, "}" },
+  { 0x2D, "\\" },
+  { 0x30, "~" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_164_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_164_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_164_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_164_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_164_LAYER_2_ENTRIES, 29u,
+  },
+  {
+    "altgr",
+    LAYOUT_164_LAYER_3_ENTRIES, 13u,
+  },
+  {
+    "ctrl",
+    LAYOUT_164_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_165_LAYER_0_ENTRIES[] = {
+  { 0x04, "ܐ" },
+  { 0x05, "ܒ" },
+  { 0x06, "ܤ" },
+  { 0x07, "ܕ" },
+  { 0x08, "ܖ" },
+  { 0x09, "ܔ" },
+  { 0x0A, "ܓ" },
+  { 0x0B, "ܗ" },
+  { 0x0C, "ܥ" },
+  { 0x0D, "ܛ" },
+  { 0x0E, "ܟ" },
+  { 0x0F, "ܠ" },
+  { 0x10, "ܡ" },
+  { 0x11, "ܢ" },
+  { 0x12, "ܧ" },
+  { 0x13, "ܦ" },
+  { 0x14, "ܩ" },
+  { 0x15, "ܪ" },
+  { 0x16, "ܣ" },
+  { 0x17, "ܬ" },
+  { 0x18, "ܜ" },
+  { 0x19, "ܫ" },
+  { 0x1A, "ܘ" },
+  { 0x1B, "ܨ" },
+  { 0x1C, "ܝ" },
+  { 0x1D, "ܙ" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "]" },
+  { 0x30, "[" },
+  { 0x31, "܆" },
+  { 0x33, "ܚ" },
+  { 0x34, "ܞ" },
+  { 0x35, "܏" },
+  { 0x36, "܀" },
+  { 0x37, "." },
+  { 0x38, "܇" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "܆" },
+};
+
+const wa_keyboard_mapping LAYOUT_165_LAYER_1_ENTRIES[] = {
+  { 0x04, "ܱ" },
+  { 0x05, "ܿ" },
+  { 0x06, "ܸ" },
+  { 0x07, "ܷ" },
+  { 0x08, "ܶ" },
+  { 0x09, "ܻ" },
+  { 0x0A, "ܾ" },
+  { 0x0B, "ܑ" },
+  { 0x0C, "̈" },
+  { 0x0D, "ـ" },
+  { 0x0E, "̤" },
+  { 0x0F, "̱" },
+  { 0x10, "݂" },
+  { 0x11, "ܹ" },
+  { 0x12, "̄" },
+  { 0x13, "̇" },
+  { 0x14, "ܰ" },
+  { 0x15, "ܺ" },
+  { 0x16, "ܴ" },
+  { 0x17, "ܽ" },
+  { 0x18, "݁" },
+  { 0x19, "ܼ" },
+  { 0x1A, "ܳ" },
+  { 0x1B, "ܵ" },
+  { 0x1C, "݀" },
+  { 0x1D, "ܲ" },
+  { 0x1E, "!" },
+  { 0x1F, "̊" },
+  { 0x20, "̥" },
+  { 0x21, "݉" },
+  { 0x22, "♰" },
+  { 0x23, "♱" },
+  { 0x24, "܊" },
+  { 0x25, "»" },
+  { 0x26, ")" },
+  { 0x27, "(" },
+  { 0x2C, " " },
+  { 0x2D, "«" },
+  { 0x2E, "+" },
+  { 0x2F, "̃" },
+  { 0x30, "݊" },
+  { 0x31, ":" },
+  { 0x33, "̣" },
+  { 0x34, "̰" },
+  { 0x35, "̮" },
+  { 0x36, "،" },
+  { 0x37, "؛" },
+  { 0x38, "؟" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, ":" },
+};
+
+const wa_keyboard_mapping LAYOUT_165_LAYER_2_ENTRIES[] = {
+  { 0x04, "ِ" },
+  { 0x05, "‌" },
+  { 0x08, "ُ" },
+  { 0x09, "ء" },
+  { 0x0A, "ٕ" },
+  { 0x0B, "ٰ" },
+  { 0x0C, "݃" },
+  { 0x0D, "݈" },
+  { 0x0E, "݄" },
+  { 0x0F, "݆" },
+  { 0x10, "‏" },
+  { 0x11, "‎" },
+  { 0x12, "݅" },
+  { 0x13, "̭" },
+  { 0x14, "َ" },
+  { 0x15, "ٌ" },
+  { 0x16, "ٍ" },
+  { 0x17, "ٓ" },
+  { 0x18, "݇" },
+  { 0x19, "‍" },
+  { 0x1A, "ً" },
+  { 0x1B, "ْ" },
+  { 0x1C, "ٔ" },
+  { 0x1E, "܁" },
+  { 0x1F, "܂" },
+  { 0x20, "܃" },
+  { 0x21, "܄" },
+  { 0x22, "܅" },
+  { 0x23, "܈" },
+  { 0x24, "܉" },
+  { 0x25, "܋" },
+  { 0x26, "܌" },
+  { 0x27, "܍" },
+  { 0x2D, "┌" },
+  { 0x2E, "┐" },
+  { 0x35, "ّ" },
+};
+
+const wa_keyboard_mapping LAYOUT_165_LAYER_3_ENTRIES[] = {
+  { 0x2A, "" },
+};
+
+const wa_keyboard_layer LAYOUT_165_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_165_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_165_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "altgr",
+    LAYOUT_165_LAYER_2_ENTRIES, 36u,
+  },
+  {
+    "ctrl",
+    LAYOUT_165_LAYER_3_ENTRIES, 1u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_166_LAYER_0_ENTRIES[] = {
+  { 0x04, "ܫ" },
+  { 0x05, "ܧ" },
+  { 0x06, "ܤ" },
+  { 0x07, "ܝ" },
+  { 0x08, "ܖ" },
+  { 0x09, "ܒ" },
+  { 0x0A, "ܠ" },
+  { 0x0B, "ܐ" },
+  { 0x0C, "ܗ" },
+  { 0x0D, "ܬ" },
+  { 0x0E, "ܢ" },
+  { 0x0F, "ܡ" },
+  { 0x10, "." },
+  { 0x11, "܀" },
+  { 0x12, "ܞ" },
+  { 0x13, "ܚ" },
+  { 0x14, "ܔ" },
+  { 0x15, "ܩ" },
+  { 0x16, "ܣ" },
+  { 0x17, "ܦ" },
+  { 0x18, "ܥ" },
+  { 0x19, "ܪ" },
+  { 0x1A, "ܨ" },
+  { 0x1B, "[" },
+  { 0x1C, "ܜ" },
+  { 0x1D, "]" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "ܓ" },
+  { 0x30, "ܕ" },
+  { 0x31, "܆" },
+  { 0x33, "ܟ" },
+  { 0x34, "ܛ" },
+  { 0x35, "܏" },
+  { 0x36, "ܘ" },
+  { 0x37, "ܙ" },
+  { 0x38, "܇" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "܆" },
+};
+
+const wa_keyboard_mapping LAYOUT_166_LAYER_1_ENTRIES[] = {
+  { 0x04, "ܱ" },
+  { 0x05, "ܿ" },
+  { 0x06, "ܸ" },
+  { 0x07, "ܷ" },
+  { 0x08, "ܶ" },
+  { 0x09, "ܻ" },
+  { 0x0A, "ܾ" },
+  { 0x0B, "ܑ" },
+  { 0x0C, "̈" },
+  { 0x0D, "ـ" },
+  { 0x0E, "̤" },
+  { 0x0F, "̱" },
+  { 0x10, "݂" },
+  { 0x11, "ܹ" },
+  { 0x12, "̄" },
+  { 0x13, "̇" },
+  { 0x14, "ܰ" },
+  { 0x15, "ܺ" },
+  { 0x16, "ܴ" },
+  { 0x17, "ܽ" },
+  { 0x18, "݁" },
+  { 0x19, "ܼ" },
+  { 0x1A, "ܳ" },
+  { 0x1B, "ܵ" },
+  { 0x1C, "݀" },
+  { 0x1D, "ܲ" },
+  { 0x1E, "!" },
+  { 0x1F, "̊" },
+  { 0x20, "̥" },
+  { 0x21, "݉" },
+  { 0x22, "♰" },
+  { 0x23, "♱" },
+  { 0x24, "܊" },
+  { 0x25, "»" },
+  { 0x26, ")" },
+  { 0x27, "(" },
+  { 0x2C, " " },
+  { 0x2D, "«" },
+  { 0x2E, "+" },
+  { 0x2F, "̃" },
+  { 0x30, "݊" },
+  { 0x31, ":" },
+  { 0x33, "̣" },
+  { 0x34, "̰" },
+  { 0x35, "̮" },
+  { 0x36, "،" },
+  { 0x37, "؛" },
+  { 0x38, "؟" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, ":" },
+};
+
+const wa_keyboard_mapping LAYOUT_166_LAYER_2_ENTRIES[] = {
+  { 0x04, "ِ" },
+  { 0x05, "‌" },
+  { 0x08, "ُ" },
+  { 0x09, "ء" },
+  { 0x0A, "ٕ" },
+  { 0x0B, "ٰ" },
+  { 0x0C, "݃" },
+  { 0x0D, "݈" },
+  { 0x0E, "݄" },
+  { 0x0F, "݆" },
+  { 0x10, "‏" },
+  { 0x11, "‎" },
+  { 0x12, "݅" },
+  { 0x13, "̭" },
+  { 0x14, "َ" },
+  { 0x15, "ٌ" },
+  { 0x16, "ٍ" },
+  { 0x17, "ٓ" },
+  { 0x18, "݇" },
+  { 0x19, "‍" },
+  { 0x1A, "ً" },
+  { 0x1B, "ْ" },
+  { 0x1C, "ٔ" },
+  { 0x1E, "܁" },
+  { 0x1F, "܂" },
+  { 0x20, "܃" },
+  { 0x21, "܄" },
+  { 0x22, "܅" },
+  { 0x23, "܈" },
+  { 0x24, "܉" },
+  { 0x25, "܋" },
+  { 0x26, "܌" },
+  { 0x27, "܍" },
+  { 0x2D, "┌" },
+  { 0x2E, "┐" },
+  { 0x35, "ّ" },
+};
+
+const wa_keyboard_mapping LAYOUT_166_LAYER_3_ENTRIES[] = {
+  { 0x2A, "" },
+};
+
+const wa_keyboard_layer LAYOUT_166_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_166_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_166_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "altgr",
+    LAYOUT_166_LAYER_2_ENTRIES, 36u,
+  },
+  {
+    "ctrl",
+    LAYOUT_166_LAYER_3_ENTRIES, 1u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_167_LAYER_0_ENTRIES[] = {
+  { 0x04, "அ" },
+  { 0x05, "ங" },
+  { 0x06, "ஒ" },
+  { 0x07, "உ" },
+  { 0x08, "ஊ" },
+  { 0x09, "்" },
+  { 0x0A, "எ" },
+  { 0x0B, "க" },
+  { 0x0C, "ன" },
+  { 0x0D, "ப" },
+  { 0x0E, "ம" },
+  { 0x0F, "த" },
+  { 0x10, "ர" },
+  { 0x11, "ல" },
+  { 0x12, "ட" },
+  { 0x13, "ண" },
+  { 0x14, "ஆ" },
+  { 0x15, "ஐ" },
+  { 0x16, "இ" },
+  { 0x17, "ஏ" },
+  { 0x18, "ற" },
+  { 0x19, "வ" },
+  { 0x1A, "ஈ" },
+  { 0x1B, "ஓ" },
+  { 0x1C, "ள" },
+  { 0x1D, "ஔ" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "ச" },
+  { 0x30, "ஞ" },
+  { 0x31, "\\" },
+  { 0x33, "ந" },
+  { 0x34, "ய" },
+  { 0x35, "`" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "ழ" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_167_LAYER_1_ENTRIES[] = {
+  { 0x04, "௹" },
+  { 0x05, "௷" },
+  { 0x06, "௵" },
+  { 0x07, "௸" },
+  { 0x08, "ஜ" },
+  { 0x09, "ஃ" },
+  { 0x0A, "எ" },
+  { 0x0B, "க" },
+  { 0x0D, "ப" },
+  { 0x0E, "\"" },
+  { 0x0F, ":" },
+  { 0x10, "/" },
+  { 0x11, "ௐ" },
+  { 0x12, "[" },
+  { 0x13, "]" },
+  { 0x14, "ஸ" },
+  { 0x15, "ஹ" },
+  { 0x16, "௺" },
+  { 0x17, "க்ஷ" },
+  { 0x18, "ஶ" },
+  { 0x19, "௶" },
+  { 0x1A, "ஷ" },
+  { 0x1B, "௴" },
+  { 0x1C, "ஶ்ரீ" },
+  { 0x1D, "௳" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "|" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x35, "~" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_167_LAYER_2_ENTRIES[] = {
+  { 0x2A, "" },
+};
+
+const wa_keyboard_layer LAYOUT_167_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_167_LAYER_0_ENTRIES, 52u,
+  },
+  {
+    "shift",
+    LAYOUT_167_LAYER_1_ENTRIES, 51u,
+  },
+  {
+    "ctrl",
+    LAYOUT_167_LAYER_2_ENTRIES, 1u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_168_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x35, "`" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_168_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_168_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+};
+
+const wa_keyboard_mapping LAYOUT_168_LAYER_3_ENTRIES[] = {
+  { 0x04, "ā" },
+  { 0x07, "ḍ" },
+  { 0x08, "ē" },
+  { 0x0A, "ṅ" },
+  { 0x0B, "ḥ" },
+  { 0x0C, "ī" },
+  { 0x0F, "l̥" },
+  { 0x10, "ṁ" },
+  { 0x11, "ṇ" },
+  { 0x12, "ō" },
+  { 0x14, "æ" },
+  { 0x15, "r̥" },
+  { 0x16, "ś" },
+  { 0x17, "ṭ" },
+  { 0x18, "ū" },
+  { 0x1B, "ṣ" },
+  { 0x1C, "ñ" },
+  { 0x21, "₹" },
+  { 0x2D, "-" },
+  { 0x2E, "–" },
+  { 0x34, "'" },
+  { 0x35, "`" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+};
+
+const wa_keyboard_mapping LAYOUT_168_LAYER_4_ENTRIES[] = {
+  { 0x04, "Ā" },
+  { 0x07, "Ḍ" },
+  { 0x08, "Ē" },
+  { 0x0A, "Ṅ" },
+  { 0x0B, "Ḥ" },
+  { 0x0C, "Ī" },
+  { 0x0F, "L̥" },
+  { 0x10, "Ṁ" },
+  { 0x11, "Ṇ" },
+  { 0x12, "Ō" },
+  { 0x14, "Æ" },
+  { 0x15, "R̥" },
+  { 0x16, "Ś" },
+  { 0x17, "Ṭ" },
+  { 0x18, "Ū" },
+  { 0x1B, "Ṣ" },
+  { 0x1C, "Ñ" },
+  { 0x23, "ˆ" },
+  { 0x26, "˘" },
+  { 0x2D, "ˍ" },
+  { 0x2E, "—" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x36, "<" },
+  { 0x38, "§" },
+};
+
+const wa_keyboard_mapping LAYOUT_168_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+};
+
+const wa_keyboard_layer LAYOUT_168_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_168_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_168_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_168_LAYER_2_ENTRIES, 26u,
+  },
+  {
+    "altgr",
+    LAYOUT_168_LAYER_3_ENTRIES, 25u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_168_LAYER_4_ENTRIES, 25u,
+  },
+  {
+    "ctrl",
+    LAYOUT_168_LAYER_5_ENTRIES, 1u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_169_LAYER_0_ENTRIES[] = {
+  { 0x04, "ோ" },
+  { 0x05, "வ" },
+  { 0x06, "ம" },
+  { 0x07, "்" },
+  { 0x08, "ா" },
+  { 0x09, "ி" },
+  { 0x0A, "ு" },
+  { 0x0B, "ப" },
+  { 0x0C, "க" },
+  { 0x0D, "ர" },
+  { 0x0E, "க" },
+  { 0x0F, "த" },
+  { 0x10, "ஸ" },
+  { 0x11, "ல" },
+  { 0x12, "த" },
+  { 0x13, "ஜ" },
+  { 0x14, "ௌ" },
+  { 0x15, "ீ" },
+  { 0x16, "ே" },
+  { 0x17, "ூ" },
+  { 0x18, "ஹ" },
+  { 0x19, "ந" },
+  { 0x1A, "ை" },
+  { 0x1C, "ப" },
+  { 0x1D, "ெ" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2F, "ட" },
+  { 0x30, "ஞ" },
+  { 0x33, "ச" },
+  { 0x34, "ட" },
+  { 0x35, "ொ" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "ய" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_169_LAYER_1_ENTRIES[] = {
+  { 0x04, "ஓ" },
+  { 0x05, "ழ" },
+  { 0x06, "ண" },
+  { 0x07, "அ" },
+  { 0x08, "ஆ" },
+  { 0x09, "இ" },
+  { 0x0A, "உ" },
+  { 0x0B, "ப" },
+  { 0x0C, "க" },
+  { 0x0D, "ற" },
+  { 0x0E, "க" },
+  { 0x0F, "த" },
+  { 0x10, "ஶ" },
+  { 0x11, "ள" },
+  { 0x12, "த" },
+  { 0x13, "ச" },
+  { 0x14, "ஔ" },
+  { 0x15, "ஈ" },
+  { 0x16, "ஏ" },
+  { 0x17, "ஊ" },
+  { 0x18, "ங" },
+  { 0x19, "ன" },
+  { 0x1A, "ஐ" },
+  { 0x1B, "ௐ" },
+  { 0x1C, "ப" },
+  { 0x1D, "எ" },
+  { 0x23, "த்ர" },
+  { 0x24, "க்ஷ" },
+  { 0x25, "ஷ்ர" },
+  { 0x27, "௰" },
+  { 0x2C, " " },
+  { 0x2D, "ஃ" },
+  { 0x2F, "ட" },
+  { 0x30, "ஞ" },
+  { 0x33, "ச" },
+  { 0x34, "ட" },
+  { 0x35, "ஒ" },
+  { 0x36, "ஷ" },
+  { 0x37, "ஸ்ரீ" },
+  { 0x38, "ய" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_169_LAYER_2_ENTRIES[] = {
+  { 0x30, "ஞ" },
+};
+
+const wa_keyboard_mapping LAYOUT_169_LAYER_3_ENTRIES[] = {
+  { 0x05, "௵" },
+  { 0x06, "௴" },
+  { 0x0B, "௶" },
+  { 0x11, "௸" },
+  { 0x19, "௳" },
+  { 0x1B, "௺" },
+  { 0x1C, "௷" },
+  { 0x1D, "௹" },
+  { 0x1E, "௧" },
+  { 0x1F, "௨" },
+  { 0x20, "௩" },
+  { 0x21, "௪" },
+  { 0x22, "௫" },
+  { 0x23, "௬" },
+  { 0x24, "௭" },
+  { 0x25, "௮" },
+  { 0x26, "௯" },
+  { 0x27, "௦" },
+  { 0x2D, "௱" },
+  { 0x2E, "௲" },
+};
+
+const wa_keyboard_mapping LAYOUT_169_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+};
+
+const wa_keyboard_layer LAYOUT_169_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_169_LAYER_0_ENTRIES, 49u,
+  },
+  {
+    "shift",
+    LAYOUT_169_LAYER_1_ENTRIES, 44u,
+  },
+  {
+    "caps",
+    LAYOUT_169_LAYER_2_ENTRIES, 1u,
+  },
+  {
+    "altgr",
+    LAYOUT_169_LAYER_3_ENTRIES, 20u,
+  },
+  {
+    "ctrl",
+    LAYOUT_169_LAYER_4_ENTRIES, 1u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_170_LAYER_0_ENTRIES[] = {
+  { 0x04, "ో" },
+  { 0x05, "వ" },
+  { 0x06, "మ" },
+  { 0x07, "్" },
+  { 0x08, "ా" },
+  { 0x09, "ి" },
+  { 0x0A, "ు" },
+  { 0x0B, "ప" },
+  { 0x0C, "గ" },
+  { 0x0D, "ర" },
+  { 0x0E, "క" },
+  { 0x0F, "త" },
+  { 0x10, "స" },
+  { 0x11, "ల" },
+  { 0x12, "ద" },
+  { 0x13, "జ" },
+  { 0x14, "ౌ" },
+  { 0x15, "ీ" },
+  { 0x16, "ే" },
+  { 0x17, "ూ" },
+  { 0x18, "హ" },
+  { 0x19, "న" },
+  { 0x1A, "ై" },
+  { 0x1B, "ం" },
+  { 0x1C, "బ" },
+  { 0x1D, "ె" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "ృ" },
+  { 0x2F, "డ" },
+  { 0x33, "చ" },
+  { 0x34, "ట" },
+  { 0x35, "ొ" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "య" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_170_LAYER_1_ENTRIES[] = {
+  { 0x04, "ఓ" },
+  { 0x06, "ణ" },
+  { 0x07, "అ" },
+  { 0x08, "ఆ" },
+  { 0x09, "ఇ" },
+  { 0x0A, "ఉ" },
+  { 0x0B, "ఫ" },
+  { 0x0C, "ఘ" },
+  { 0x0D, "ఱ" },
+  { 0x0E, "ఖ" },
+  { 0x0F, "థ" },
+  { 0x10, "శ" },
+  { 0x11, "ళ" },
+  { 0x12, "ధ" },
+  { 0x13, "ఝ" },
+  { 0x14, "ఔ" },
+  { 0x15, "ఈ" },
+  { 0x16, "ఏ" },
+  { 0x17, "ఊ" },
+  { 0x18, "ఙ" },
+  { 0x19, "న" },
+  { 0x1A, "ఐ" },
+  { 0x1B, "ఁ" },
+  { 0x1C, "భ" },
+  { 0x1D, "ఎ" },
+  { 0x20, "్ర" },
+  { 0x22, "జ్ఞ" },
+  { 0x23, "త్ర" },
+  { 0x24, "క్ష" },
+  { 0x25, "శ్ర" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "ః" },
+  { 0x2E, "ఋ" },
+  { 0x2F, "ఢ" },
+  { 0x30, "ఞ" },
+  { 0x33, "ఛ" },
+  { 0x34, "ఠ" },
+  { 0x35, "ఒ" },
+  { 0x36, "ష" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_170_LAYER_2_ENTRIES[] = {
+  { 0x13, "ౙ" },
+  { 0x16, "ౕ" },
+  { 0x1A, "ౖ" },
+  { 0x1E, "౧" },
+  { 0x1F, "౨" },
+  { 0x20, "౩" },
+  { 0x21, "౪" },
+  { 0x22, "౫" },
+  { 0x23, "౬" },
+  { 0x24, "౭" },
+  { 0x25, "౮" },
+  { 0x26, "౯" },
+  { 0x27, "౦" },
+  { 0x2E, "ౄ" },
+  { 0x33, "ౘ" },
+};
+
+const wa_keyboard_mapping LAYOUT_170_LAYER_3_ENTRIES[] = {
+  { 0x09, "ఌ" },
+  { 0x15, "ౡ" },
+  { 0x2E, "ౠ" },
+};
+
+const wa_keyboard_mapping LAYOUT_170_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_170_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_170_LAYER_0_ENTRIES, 50u,
+  },
+  {
+    "shift",
+    LAYOUT_170_LAYER_1_ENTRIES, 45u,
+  },
+  {
+    "altgr",
+    LAYOUT_170_LAYER_2_ENTRIES, 15u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_170_LAYER_3_ENTRIES, 3u,
+  },
+  {
+    "ctrl",
+    LAYOUT_170_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_171_LAYER_0_ENTRIES[] = {
+  { 0x04, "ф" },
+  { 0x05, "и" },
+  { 0x06, "с" },
+  { 0x07, "в" },
+  { 0x08, "у" },
+  { 0x09, "а" },
+  { 0x0A, "п" },
+  { 0x0B, "р" },
+  { 0x0C, "ш" },
+  { 0x0D, "о" },
+  { 0x0E, "л" },
+  { 0x0F, "д" },
+  { 0x10, "ӣ" },
+  { 0x11, "т" },
+  { 0x12, "ҳ" },
+  { 0x13, "з" },
+  { 0x14, "й" },
+  { 0x15, "к" },
+  { 0x16, "ҷ" },
+  { 0x17, "е" },
+  { 0x18, "г" },
+  { 0x19, "м" },
+  { 0x1A, "қ" },
+  { 0x1B, "ч" },
+  { 0x1C, "н" },
+  { 0x1D, "я" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "ғ" },
+  { 0x2E, "ӯ" },
+  { 0x2F, "х" },
+  { 0x30, "ъ" },
+  { 0x31, "\\" },
+  { 0x33, "ж" },
+  { 0x34, "э" },
+  { 0x35, "ё" },
+  { 0x36, "б" },
+  { 0x37, "ю" },
+  { 0x38, "." },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_171_LAYER_1_ENTRIES[] = {
+  { 0x04, "Ф" },
+  { 0x05, "И" },
+  { 0x06, "С" },
+  { 0x07, "В" },
+  { 0x08, "У" },
+  { 0x09, "А" },
+  { 0x0A, "П" },
+  { 0x0B, "Р" },
+  { 0x0C, "Ш" },
+  { 0x0D, "О" },
+  { 0x0E, "Л" },
+  { 0x0F, "Д" },
+  { 0x10, "Ӣ" },
+  { 0x11, "Т" },
+  { 0x12, "Ҳ" },
+  { 0x13, "З" },
+  { 0x14, "Й" },
+  { 0x15, "К" },
+  { 0x16, "Ҷ" },
+  { 0x17, "Е" },
+  { 0x18, "Г" },
+  { 0x19, "М" },
+  { 0x1A, "Қ" },
+  { 0x1B, "Ч" },
+  { 0x1C, "Н" },
+  { 0x1D, "Я" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "№" },
+  { 0x21, ";" },
+  { 0x22, "%" },
+  { 0x23, ":" },
+  { 0x24, "?" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "Ғ" },
+  { 0x2E, "Ӯ" },
+  { 0x2F, "Х" },
+  { 0x30, "Ъ" },
+  { 0x31, "/" },
+  { 0x33, "Ж" },
+  { 0x34, "Э" },
+  { 0x35, "Ё" },
+  { 0x36, "Б" },
+  { 0x37, "Ю" },
+  { 0x38, "," },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "/" },
+};
+
+const wa_keyboard_mapping LAYOUT_171_LAYER_2_ENTRIES[] = {
+  { 0x04, "Ф" },
+  { 0x05, "И" },
+  { 0x06, "С" },
+  { 0x07, "В" },
+  { 0x08, "У" },
+  { 0x09, "А" },
+  { 0x0A, "П" },
+  { 0x0B, "Р" },
+  { 0x0C, "Ш" },
+  { 0x0D, "О" },
+  { 0x0E, "Л" },
+  { 0x0F, "Д" },
+  { 0x10, "Ӣ" },
+  { 0x11, "Т" },
+  { 0x12, "Ҳ" },
+  { 0x13, "З" },
+  { 0x14, "Й" },
+  { 0x15, "К" },
+  { 0x16, "Ҷ" },
+  { 0x17, "Е" },
+  { 0x18, "Г" },
+  { 0x19, "М" },
+  { 0x1A, "Қ" },
+  { 0x1B, "Ч" },
+  { 0x1C, "Н" },
+  { 0x1D, "Я" },
+  { 0x2D, "Ғ" },
+  { 0x2E, "Ӯ" },
+  { 0x2F, "Х" },
+  { 0x30, "Ъ" },
+  { 0x31, "/" },
+  { 0x33, "Ж" },
+  { 0x34, "Э" },
+  { 0x35, "Ё" },
+  { 0x36, "Б" },
+  { 0x37, "Ю" },
+  { 0x64, "/" },
+};
+
+const wa_keyboard_mapping LAYOUT_171_LAYER_3_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_171_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_171_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_171_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_171_LAYER_2_ENTRIES, 37u,
+  },
+  {
+    "ctrl",
+    LAYOUT_171_LAYER_3_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_172_LAYER_0_ENTRIES[] = {
+  { 0x04, "ฟ" },
+  { 0x05, "ิ" },
+  { 0x06, "แ" },
+  { 0x07, "ก" },
+  { 0x08, "ำ" },
+  { 0x09, "ด" },
+  { 0x0A, "เ" },
+  { 0x0B, "้" },
+  { 0x0C, "ร" },
+  { 0x0D, "่" },
+  { 0x0E, "า" },
+  { 0x0F, "ส" },
+  { 0x10, "ท" },
+  { 0x11, "ื" },
+  { 0x12, "น" },
+  { 0x13, "ย" },
+  { 0x14, "ๆ" },
+  { 0x15, "พ" },
+  { 0x16, "ห" },
+  { 0x17, "ะ" },
+  { 0x18, "ี" },
+  { 0x19, "อ" },
+  { 0x1A, "ไ" },
+  { 0x1B, "ป" },
+  { 0x1C, "ั" },
+  { 0x1D, "ผ" },
+  { 0x1E, "ๅ" },
+  { 0x1F, "/" },
+  { 0x20, "-" },
+  { 0x21, "ภ" },
+  { 0x22, "ถ" },
+  { 0x23, "ุ" },
+  { 0x24, "ึ" },
+  { 0x25, "ค" },
+  { 0x26, "ต" },
+  { 0x27, "จ" },
+  { 0x2C, " " },
+  { 0x2D, "ข" },
+  { 0x2E, "ช" },
+  { 0x2F, "บ" },
+  { 0x30, "ล" },
+  { 0x31, "ฃ" },
+  { 0x33, "ว" },
+  { 0x34, "ง" },
+  { 0x35, "_" },
+  { 0x36, "ม" },
+  { 0x37, "ใ" },
+  { 0x38, "ฝ" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "ฃ" },
+};
+
+const wa_keyboard_mapping LAYOUT_172_LAYER_1_ENTRIES[] = {
+  { 0x04, "ฤ" },
+  { 0x05, "ฺ" },
+  { 0x06, "ฉ" },
+  { 0x07, "ฏ" },
+  { 0x08, "ฎ" },
+  { 0x09, "โ" },
+  { 0x0A, "ฌ" },
+  { 0x0B, "็" },
+  { 0x0C, "ณ" },
+  { 0x0D, "๋" },
+  { 0x0E, "ษ" },
+  { 0x0F, "ศ" },
+  { 0x10, "?" },
+  { 0x11, "์" },
+  { 0x12, "ฯ" },
+  { 0x13, "ญ" },
+  { 0x14, "๐" },
+  { 0x15, "ฑ" },
+  { 0x16, "ฆ" },
+  { 0x17, "ธ" },
+  { 0x18, "๊" },
+  { 0x19, "ฮ" },
+  { 0x1A, "\"" },
+  { 0x1B, ")" },
+  { 0x1C, "ํ" },
+  { 0x1D, "(" },
+  { 0x1E, "+" },
+  { 0x1F, "๑" },
+  { 0x20, "๒" },
+  { 0x21, "๓" },
+  { 0x22, "๔" },
+  { 0x23, "ู" },
+  { 0x24, "฿" },
+  { 0x25, "๕" },
+  { 0x26, "๖" },
+  { 0x27, "๗" },
+  { 0x2C, " " },
+  { 0x2D, "๘" },
+  { 0x2E, "๙" },
+  { 0x2F, "ฐ" },
+  { 0x30, "," },
+  { 0x31, "ฅ" },
+  { 0x33, "ซ" },
+  { 0x34, "." },
+  { 0x35, "%" },
+  { 0x36, "ฒ" },
+  { 0x37, "ฬ" },
+  { 0x38, "ฦ" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "ฅ" },
+};
+
+const wa_keyboard_mapping LAYOUT_172_LAYER_2_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_172_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_172_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_172_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "ctrl",
+    LAYOUT_172_LAYER_2_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_173_LAYER_0_ENTRIES[] = {
+  { 0x04, "ฟ" },
+  { 0x05, "ิ" },
+  { 0x06, "แ" },
+  { 0x07, "ก" },
+  { 0x08, "ำ" },
+  { 0x09, "ด" },
+  { 0x0A, "เ" },
+  { 0x0B, "้" },
+  { 0x0C, "ร" },
+  { 0x0D, "่" },
+  { 0x0E, "า" },
+  { 0x0F, "ส" },
+  { 0x10, "ท" },
+  { 0x11, "ื" },
+  { 0x12, "น" },
+  { 0x13, "ย" },
+  { 0x14, "ๆ" },
+  { 0x15, "พ" },
+  { 0x16, "ห" },
+  { 0x17, "ะ" },
+  { 0x18, "ี" },
+  { 0x19, "อ" },
+  { 0x1A, "ไ" },
+  { 0x1B, "ป" },
+  { 0x1C, "ั" },
+  { 0x1D, "ผ" },
+  { 0x1E, "ๅ" },
+  { 0x1F, "/" },
+  { 0x20, "-" },
+  { 0x21, "ภ" },
+  { 0x22, "ถ" },
+  { 0x23, "ุ" },
+  { 0x24, "ึ" },
+  { 0x25, "ค" },
+  { 0x26, "ต" },
+  { 0x27, "จ" },
+  { 0x2C, " " },
+  { 0x2D, "ข" },
+  { 0x2E, "ช" },
+  { 0x2F, "บ" },
+  { 0x30, "ล" },
+  { 0x31, "ฃ" },
+  { 0x33, "ว" },
+  { 0x34, "ง" },
+  { 0x35, "_" },
+  { 0x36, "ม" },
+  { 0x37, "ใ" },
+  { 0x38, "ฝ" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "ฃ" },
+};
+
+const wa_keyboard_mapping LAYOUT_173_LAYER_1_ENTRIES[] = {
+  { 0x04, "ฤ" },
+  { 0x05, "ฺ" },
+  { 0x06, "ฉ" },
+  { 0x07, "ฏ" },
+  { 0x08, "ฎ" },
+  { 0x09, "โ" },
+  { 0x0A, "ฌ" },
+  { 0x0B, "็" },
+  { 0x0C, "ณ" },
+  { 0x0D, "๋" },
+  { 0x0E, "ษ" },
+  { 0x0F, "ศ" },
+  { 0x10, "?" },
+  { 0x11, "์" },
+  { 0x12, "ฯ" },
+  { 0x13, "ญ" },
+  { 0x14, "๐" },
+  { 0x15, "ฑ" },
+  { 0x16, "ฆ" },
+  { 0x17, "ธ" },
+  { 0x18, "๊" },
+  { 0x19, "ฮ" },
+  { 0x1A, "\"" },
+  { 0x1B, ")" },
+  { 0x1C, "ํ" },
+  { 0x1D, "(" },
+  { 0x1E, "+" },
+  { 0x1F, "๑" },
+  { 0x20, "๒" },
+  { 0x21, "๓" },
+  { 0x22, "๔" },
+  { 0x23, "ู" },
+  { 0x24, "฿" },
+  { 0x25, "๕" },
+  { 0x26, "๖" },
+  { 0x27, "๗" },
+  { 0x2C, " " },
+  { 0x2D, "๘" },
+  { 0x2E, "๙" },
+  { 0x2F, "ฐ" },
+  { 0x30, "," },
+  { 0x31, "ฅ" },
+  { 0x33, "ซ" },
+  { 0x34, "." },
+  { 0x35, "%" },
+  { 0x36, "ฒ" },
+  { 0x37, "ฬ" },
+  { 0x38, "ฦ" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "ฅ" },
+};
+
+const wa_keyboard_mapping LAYOUT_173_LAYER_2_ENTRIES[] = {
+  { 0x04, "ฤ" },
+  { 0x05, "ฺ" },
+  { 0x06, "ฉ" },
+  { 0x07, "ฏ" },
+  { 0x08, "ฎ" },
+  { 0x09, "โ" },
+  { 0x0A, "ฌ" },
+  { 0x0B, "็" },
+  { 0x0C, "ณ" },
+  { 0x0D, "๋" },
+  { 0x0E, "ษ" },
+  { 0x0F, "ศ" },
+  { 0x10, "?" },
+  { 0x11, "์" },
+  { 0x12, "ฯ" },
+  { 0x13, "ญ" },
+  { 0x14, "๐" },
+  { 0x15, "ฑ" },
+  { 0x16, "ฆ" },
+  { 0x17, "ธ" },
+  { 0x18, "๊" },
+  { 0x19, "ฮ" },
+  { 0x1A, "\"" },
+  { 0x1B, ")" },
+  { 0x1C, "ํ" },
+  { 0x1D, "(" },
+  { 0x1E, "+" },
+  { 0x1F, "๑" },
+  { 0x20, "๒" },
+  { 0x21, "๓" },
+  { 0x22, "๔" },
+  { 0x23, "ู" },
+  { 0x24, "฿" },
+  { 0x25, "๕" },
+  { 0x26, "๖" },
+  { 0x27, "๗" },
+  { 0x2D, "๘" },
+  { 0x2E, "๙" },
+  { 0x2F, "ฐ" },
+  { 0x30, "," },
+  { 0x31, "ฅ" },
+  { 0x33, "ซ" },
+  { 0x34, "." },
+  { 0x35, "%" },
+  { 0x36, "ฒ" },
+  { 0x37, "ฬ" },
+  { 0x38, "ฦ" },
+  { 0x64, "ฅ" },
+};
+
+const wa_keyboard_mapping LAYOUT_173_LAYER_3_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+  { 0x2F, "%" },
+  { 0x30, "๑" },
+  { 0x31, "+" },
+  { 0x64, "๒" },
+};
+
+const wa_keyboard_layer LAYOUT_173_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_173_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_173_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_173_LAYER_2_ENTRIES, 48u,
+  },
+  {
+    "ctrl",
+    LAYOUT_173_LAYER_3_ENTRIES, 6u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_174_LAYER_0_ENTRIES[] = {
+  { 0x04, "้" },
+  { 0x05, "ิ" },
+  { 0x06, "ล" },
+  { 0x07, "ง" },
+  { 0x08, "ย" },
+  { 0x09, "ก" },
+  { 0x0A, "ั" },
+  { 0x0B, "ี" },
+  { 0x0C, "ม" },
+  { 0x0D, "า" },
+  { 0x0E, "น" },
+  { 0x0F, "เ" },
+  { 0x10, "ส" },
+  { 0x11, "ค" },
+  { 0x12, "ว" },
+  { 0x13, "แ" },
+  { 0x14, "็" },
+  { 0x15, "อ" },
+  { 0x16, "ท" },
+  { 0x17, "ร" },
+  { 0x18, "ด" },
+  { 0x19, "ห" },
+  { 0x1A, "ต" },
+  { 0x1B, "ป" },
+  { 0x1C, "่" },
+  { 0x1D, "บ" },
+  { 0x1E, "=" },
+  { 0x1F, "๒" },
+  { 0x20, "๓" },
+  { 0x21, "๔" },
+  { 0x22, "๕" },
+  { 0x23, "ู" },
+  { 0x24, "๗" },
+  { 0x25, "๘" },
+  { 0x26, "๙" },
+  { 0x27, "๐" },
+  { 0x2C, " " },
+  { 0x2D, "๑" },
+  { 0x2E, "๖" },
+  { 0x2F, "ใ" },
+  { 0x30, "ฌ" },
+  { 0x31, "" },
+  { 0x33, "ไ" },
+  { 0x34, "ข" },
+  { 0x35, "_" },
+  { 0x36, "ะ" },
+  { 0x37, "จ" },
+  { 0x38, "พ" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "" },
+};
+
+const wa_keyboard_mapping LAYOUT_174_LAYER_1_ENTRIES[] = {
+  { 0x04, "๋" },
+  { 0x05, "ั" },
+  { 0x06, "ฐ" },
+  { 0x07, "ำ" },
+  { 0x08, "ๆ" },
+  { 0x09, "ณ" },
+  { 0x0A, "์" },
+  { 0x0B, "ื" },
+  { 0x0C, "ซ" },
+  { 0x0D, "ผ" },
+  { 0x0E, "ช" },
+  { 0x0F, "โ" },
+  { 0x10, "ฮ" },
+  { 0x11, "ศ" },
+  { 0x12, "ถ" },
+  { 0x13, "ฒ" },
+  { 0x14, "๊" },
+  { 0x15, "ญ" },
+  { 0x16, "ธ" },
+  { 0x17, "ษ" },
+  { 0x18, "ฝ" },
+  { 0x19, "ภ" },
+  { 0x1A, "ฤ" },
+  { 0x1B, "ฏ" },
+  { 0x1C, "ึ" },
+  { 0x1D, "ฎ" },
+  { 0x1E, "+" },
+  { 0x1F, "\"" },
+  { 0x20, "/" },
+  { 0x21, "," },
+  { 0x22, "?" },
+  { 0x23, "ุ" },
+  { 0x24, "_" },
+  { 0x25, "." },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "%" },
+  { 0x2F, "ฯ" },
+  { 0x30, "ฦ" },
+  { 0x31, "ํ" },
+  { 0x33, "ฆ" },
+  { 0x34, "ฑ" },
+  { 0x35, "฿" },
+  { 0x36, "ฟ" },
+  { 0x37, "ฉ" },
+  { 0x38, "ฬ" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "ํ" },
+};
+
+const wa_keyboard_mapping LAYOUT_174_LAYER_2_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_174_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_174_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_174_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "ctrl",
+    LAYOUT_174_LAYER_2_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_175_LAYER_0_ENTRIES[] = {
+  { 0x04, "้" },
+  { 0x05, "ิ" },
+  { 0x06, "ล" },
+  { 0x07, "ง" },
+  { 0x08, "ย" },
+  { 0x09, "ก" },
+  { 0x0A, "ั" },
+  { 0x0B, "ี" },
+  { 0x0C, "ม" },
+  { 0x0D, "า" },
+  { 0x0E, "น" },
+  { 0x0F, "เ" },
+  { 0x10, "ส" },
+  { 0x11, "ค" },
+  { 0x12, "ว" },
+  { 0x13, "แ" },
+  { 0x14, "็" },
+  { 0x15, "อ" },
+  { 0x16, "ท" },
+  { 0x17, "ร" },
+  { 0x18, "ด" },
+  { 0x19, "ห" },
+  { 0x1A, "ต" },
+  { 0x1B, "ป" },
+  { 0x1C, "่" },
+  { 0x1D, "บ" },
+  { 0x1E, "=" },
+  { 0x1F, "๒" },
+  { 0x20, "๓" },
+  { 0x21, "๔" },
+  { 0x22, "๕" },
+  { 0x23, "ู" },
+  { 0x24, "๗" },
+  { 0x25, "๘" },
+  { 0x26, "๙" },
+  { 0x27, "๐" },
+  { 0x2C, " " },
+  { 0x2D, "๑" },
+  { 0x2E, "๖" },
+  { 0x2F, "ใ" },
+  { 0x30, "ฌ" },
+  { 0x31, "" },
+  { 0x33, "ไ" },
+  { 0x34, "ข" },
+  { 0x35, "_" },
+  { 0x36, "ะ" },
+  { 0x37, "จ" },
+  { 0x38, "พ" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "" },
+};
+
+const wa_keyboard_mapping LAYOUT_175_LAYER_1_ENTRIES[] = {
+  { 0x04, "๋" },
+  { 0x05, "ั" },
+  { 0x06, "ฐ" },
+  { 0x07, "ำ" },
+  { 0x08, "ๆ" },
+  { 0x09, "ณ" },
+  { 0x0A, "์" },
+  { 0x0B, "ื" },
+  { 0x0C, "ซ" },
+  { 0x0D, "ผ" },
+  { 0x0E, "ช" },
+  { 0x0F, "โ" },
+  { 0x10, "ฮ" },
+  { 0x11, "ศ" },
+  { 0x12, "ถ" },
+  { 0x13, "ฒ" },
+  { 0x14, "๊" },
+  { 0x15, "ญ" },
+  { 0x16, "ธ" },
+  { 0x17, "ษ" },
+  { 0x18, "ฝ" },
+  { 0x19, "ภ" },
+  { 0x1A, "ฤ" },
+  { 0x1B, "ฏ" },
+  { 0x1C, "ึ" },
+  { 0x1D, "ฎ" },
+  { 0x1E, "+" },
+  { 0x1F, "\"" },
+  { 0x20, "/" },
+  { 0x21, "," },
+  { 0x22, "?" },
+  { 0x23, "ุ" },
+  { 0x24, "_" },
+  { 0x25, "." },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "%" },
+  { 0x2F, "ฯ" },
+  { 0x30, "ฦ" },
+  { 0x31, "ํ" },
+  { 0x33, "ฆ" },
+  { 0x34, "ฑ" },
+  { 0x35, "฿" },
+  { 0x36, "ฟ" },
+  { 0x37, "ฉ" },
+  { 0x38, "ฬ" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "ํ" },
+};
+
+const wa_keyboard_mapping LAYOUT_175_LAYER_2_ENTRIES[] = {
+  { 0x04, "๋" },
+  { 0x05, "ั" },
+  { 0x06, "ฐ" },
+  { 0x07, "ำ" },
+  { 0x08, "ๆ" },
+  { 0x09, "ณ" },
+  { 0x0A, "์" },
+  { 0x0B, "ื" },
+  { 0x0C, "ซ" },
+  { 0x0D, "ผ" },
+  { 0x0E, "ช" },
+  { 0x0F, "โ" },
+  { 0x10, "ฮ" },
+  { 0x11, "ศ" },
+  { 0x12, "ถ" },
+  { 0x13, "ฒ" },
+  { 0x14, "๊" },
+  { 0x15, "ญ" },
+  { 0x16, "ธ" },
+  { 0x17, "ษ" },
+  { 0x18, "ฝ" },
+  { 0x19, "ภ" },
+  { 0x1A, "ฤ" },
+  { 0x1B, "ฏ" },
+  { 0x1C, "ึ" },
+  { 0x1D, "ฎ" },
+  { 0x1E, "+" },
+  { 0x1F, "\"" },
+  { 0x20, "/" },
+  { 0x21, "," },
+  { 0x22, "?" },
+  { 0x23, "ุ" },
+  { 0x24, "_" },
+  { 0x25, "." },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2D, "-" },
+  { 0x2E, "%" },
+  { 0x2F, "ฯ" },
+  { 0x30, "ฦ" },
+  { 0x31, "ํ" },
+  { 0x33, "ฆ" },
+  { 0x34, "ฑ" },
+  { 0x35, "฿" },
+  { 0x36, "ฟ" },
+  { 0x37, "ฉ" },
+  { 0x38, "ฬ" },
+  { 0x64, "ํ" },
+};
+
+const wa_keyboard_mapping LAYOUT_175_LAYER_3_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_175_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_175_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_175_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_175_LAYER_2_ENTRIES, 48u,
+  },
+  {
+    "ctrl",
+    LAYOUT_175_LAYER_3_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_176_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "ç" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "ä" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "ý" },
+  { 0x1A, "w" },
+  { 0x1B, "ü" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "ň" },
+  { 0x30, "ö" },
+  { 0x31, "ş" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x35, "ž" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_176_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "Ç" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Ä" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "Ý" },
+  { 0x1A, "W" },
+  { 0x1B, "Ü" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "№" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "Ň" },
+  { 0x30, "Ö" },
+  { 0x31, "Ş" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "Ž" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_176_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "Ç" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Ä" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "Ý" },
+  { 0x1A, "W" },
+  { 0x1B, "Ü" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x2F, "Ň" },
+  { 0x30, "Ö" },
+  { 0x31, "Ş" },
+  { 0x35, "Ž" },
+};
+
+const wa_keyboard_mapping LAYOUT_176_LAYER_3_ENTRIES[] = {
+  { 0x31, "|" },
+  { 0x38, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_176_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_176_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_176_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_176_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_176_LAYER_2_ENTRIES, 30u,
+  },
+  {
+    "altgr",
+    LAYOUT_176_LAYER_3_ENTRIES, 2u,
+  },
+  {
+    "ctrl",
+    LAYOUT_176_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_177_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x35, "`" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_177_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_177_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+};
+
+const wa_keyboard_mapping LAYOUT_177_LAYER_3_ENTRIES[] = {
+  { 0x04, "á" },
+  { 0x06, "©" },
+  { 0x07, "ð" },
+  { 0x08, "é" },
+  { 0x0C, "í" },
+  { 0x0F, "ø" },
+  { 0x10, "µ" },
+  { 0x11, "ñ" },
+  { 0x12, "ó" },
+  { 0x13, "ö" },
+  { 0x14, "ä" },
+  { 0x15, "®" },
+  { 0x16, "ß" },
+  { 0x17, "þ" },
+  { 0x18, "ú" },
+  { 0x1A, "å" },
+  { 0x1C, "ü" },
+  { 0x1D, "æ" },
+  { 0x1E, "¡" },
+  { 0x1F, "²" },
+  { 0x20, "³" },
+  { 0x21, "¤" },
+  { 0x22, "€" },
+  { 0x23, "¼" },
+  { 0x24, "½" },
+  { 0x25, "¾" },
+  { 0x26, "‘" },
+  { 0x27, "’" },
+  { 0x2D, "¥" },
+  { 0x2E, "×" },
+  { 0x2F, "«" },
+  { 0x30, "»" },
+  { 0x31, "¬" },
+  { 0x33, "¶" },
+  { 0x34, "´" },
+  { 0x36, "ç" },
+  { 0x37, "š" },
+  { 0x38, "¿" },
+};
+
+const wa_keyboard_mapping LAYOUT_177_LAYER_4_ENTRIES[] = {
+  { 0x04, "Á" },
+  { 0x06, "¢" },
+  { 0x07, "Ð" },
+  { 0x08, "É" },
+  { 0x0C, "Í" },
+  { 0x0F, "Ø" },
+  { 0x11, "Ñ" },
+  { 0x12, "Ó" },
+  { 0x13, "Ö" },
+  { 0x14, "Ä" },
+  { 0x16, "§" },
+  { 0x17, "Þ" },
+  { 0x18, "Ú" },
+  { 0x1A, "Å" },
+  { 0x1C, "Ü" },
+  { 0x1D, "Æ" },
+  { 0x1E, "¹" },
+  { 0x21, "£" },
+  { 0x2E, "÷" },
+  { 0x31, "¦" },
+  { 0x33, "°" },
+  { 0x34, "¨" },
+  { 0x36, "Ç" },
+  { 0x37, "Š" },
+};
+
+const wa_keyboard_mapping LAYOUT_177_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_177_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_177_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_177_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_177_LAYER_2_ENTRIES, 26u,
+  },
+  {
+    "altgr",
+    LAYOUT_177_LAYER_3_ENTRIES, 38u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_177_LAYER_4_ENTRIES, 24u,
+  },
+  {
+    "ctrl",
+    LAYOUT_177_LAYER_5_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_178_LAYER_0_ENTRIES[] = {
+  { 0x04, "u" },
+  { 0x05, "ç" },
+  { 0x06, "v" },
+  { 0x07, "e" },
+  { 0x08, "ğ" },
+  { 0x09, "a" },
+  { 0x0A, "ü" },
+  { 0x0B, "t" },
+  { 0x0C, "n" },
+  { 0x0D, "k" },
+  { 0x0E, "m" },
+  { 0x0F, "l" },
+  { 0x10, "s" },
+  { 0x11, "z" },
+  { 0x12, "h" },
+  { 0x13, "p" },
+  { 0x14, "f" },
+  { 0x15, "ı" },
+  { 0x16, "i" },
+  { 0x17, "o" },
+  { 0x18, "r" },
+  { 0x19, "c" },
+  { 0x1A, "g" },
+  { 0x1B, "ö" },
+  { 0x1C, "d" },
+  { 0x1D, "j" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "/" },
+  { 0x2E, "-" },
+  { 0x2F, "q" },
+  { 0x30, "w" },
+  { 0x31, "x" },
+  { 0x33, "y" },
+  { 0x34, "ş" },
+  { 0x35, "+" },
+  { 0x36, "b" },
+  { 0x37, "." },
+  { 0x38, "," },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "<" },
+};
+
+const wa_keyboard_mapping LAYOUT_178_LAYER_1_ENTRIES[] = {
+  { 0x04, "U" },
+  { 0x05, "Ç" },
+  { 0x06, "V" },
+  { 0x07, "E" },
+  { 0x08, "Ğ" },
+  { 0x09, "A" },
+  { 0x0A, "Ü" },
+  { 0x0B, "T" },
+  { 0x0C, "N" },
+  { 0x0D, "K" },
+  { 0x0E, "M" },
+  { 0x0F, "L" },
+  { 0x10, "S" },
+  { 0x11, "Z" },
+  { 0x12, "H" },
+  { 0x13, "P" },
+  { 0x14, "F" },
+  { 0x15, "I" },
+  { 0x16, "İ" },
+  { 0x17, "O" },
+  { 0x18, "R" },
+  { 0x19, "C" },
+  { 0x1A, "G" },
+  { 0x1B, "Ö" },
+  { 0x1C, "D" },
+  { 0x1D, "J" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "^" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "&" },
+  { 0x24, "'" },
+  { 0x25, "(" },
+  { 0x26, ")" },
+  { 0x27, "=" },
+  { 0x2C, " " },
+  { 0x2D, "?" },
+  { 0x2E, "_" },
+  { 0x2F, "Q" },
+  { 0x30, "W" },
+  { 0x31, "X" },
+  { 0x33, "Y" },
+  { 0x34, "Ş" },
+  { 0x35, "*" },
+  { 0x36, "B" },
+  { 0x37, ":" },
+  { 0x38, ";" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_178_LAYER_2_ENTRIES[] = {
+  { 0x04, "U" },
+  { 0x05, "Ç" },
+  { 0x06, "V" },
+  { 0x07, "E" },
+  { 0x08, "Ğ" },
+  { 0x09, "A" },
+  { 0x0A, "Ü" },
+  { 0x0B, "T" },
+  { 0x0C, "N" },
+  { 0x0D, "K" },
+  { 0x0E, "M" },
+  { 0x0F, "L" },
+  { 0x10, "S" },
+  { 0x11, "Z" },
+  { 0x12, "H" },
+  { 0x13, "P" },
+  { 0x14, "F" },
+  { 0x15, "I" },
+  { 0x16, "İ" },
+  { 0x17, "O" },
+  { 0x18, "R" },
+  { 0x19, "C" },
+  { 0x1A, "G" },
+  { 0x1B, "Ö" },
+  { 0x1C, "D" },
+  { 0x1D, "J" },
+  { 0x2F, "Q" },
+  { 0x30, "W" },
+  { 0x31, "X" },
+  { 0x33, "Y" },
+  { 0x34, "Ş" },
+  { 0x36, "B" },
+};
+
+const wa_keyboard_mapping LAYOUT_178_LAYER_3_ENTRIES[] = {
+  { 0x04, "æ" },
+  { 0x06, "¢" },
+  { 0x07, "€" },
+  { 0x0B, "₺" },
+  { 0x10, "µ" },
+  { 0x12, "ø" },
+  { 0x13, "£" },
+  { 0x14, "@" },
+  { 0x15, "¶" },
+  { 0x16, "ß" },
+  { 0x1B, "»" },
+  { 0x1C, "¥" },
+  { 0x1D, "«" },
+  { 0x1E, "¹" },
+  { 0x1F, "²" },
+  { 0x20, "#" },
+  { 0x21, "¼" },
+  { 0x22, "½" },
+  { 0x23, "¾" },
+  { 0x24, "{" },
+  { 0x25, "[" },
+  { 0x26, "]" },
+  { 0x27, "}" },
+  { 0x2D, "\\" },
+  { 0x2E, "|" },
+  { 0x2F, "¨" },
+  { 0x30, "~" },
+  { 0x31, "`" },
+  { 0x33, "´" },
+  { 0x35, "¬" },
+  { 0x36, "×" },
+  { 0x37, "÷" },
+  { 0x38, "­" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_178_LAYER_4_ENTRIES[] = {
+  { 0x04, "Æ" },
+  { 0x06, "©" },
+  { 0x09, "ª" },
+  { 0x10, "º" },
+  { 0x12, "Ø" },
+  { 0x15, "®" },
+  { 0x16, "§" },
+  { 0x1B, ">" },
+  { 0x1D, "<" },
+  { 0x1E, "¡" },
+  { 0x20, "³" },
+  { 0x21, "¤" },
+  { 0x2D, "¿" },
+  { 0x64, "¦" },
+};
+
+const wa_keyboard_mapping LAYOUT_178_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_178_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_178_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_178_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_178_LAYER_2_ENTRIES, 32u,
+  },
+  {
+    "altgr",
+    LAYOUT_178_LAYER_3_ENTRIES, 34u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_178_LAYER_4_ENTRIES, 14u,
+  },
+  {
+    "ctrl",
+    LAYOUT_178_LAYER_5_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_179_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "ı" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "*" },
+  { 0x2E, "-" },
+  { 0x2F, "ğ" },
+  { 0x30, "ü" },
+  { 0x31, "," },
+  { 0x33, "ş" },
+  { 0x34, "i" },
+  { 0x35, "\"" },
+  { 0x36, "ö" },
+  { 0x37, "ç" },
+  { 0x38, "." },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "<" },
+};
+
+const wa_keyboard_mapping LAYOUT_179_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "'" },
+  { 0x20, "^" },
+  { 0x21, "+" },
+  { 0x22, "%" },
+  { 0x23, "&" },
+  { 0x24, "/" },
+  { 0x25, "(" },
+  { 0x26, ")" },
+  { 0x27, "=" },
+  { 0x2C, " " },
+  { 0x2D, "?" },
+  { 0x2E, "_" },
+  { 0x2F, "Ğ" },
+  { 0x30, "Ü" },
+  { 0x31, ";" },
+  { 0x33, "Ş" },
+  { 0x34, "İ" },
+  { 0x35, "é" },
+  { 0x36, "Ö" },
+  { 0x37, "Ç" },
+  { 0x38, ":" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_179_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x2F, "Ğ" },
+  { 0x30, "Ü" },
+  { 0x33, "Ş" },
+  { 0x34, "İ" },
+  { 0x36, "Ö" },
+  { 0x37, "Ç" },
+};
+
+const wa_keyboard_mapping LAYOUT_179_LAYER_3_ENTRIES[] = {
+  { 0x04, "æ" },
+  { 0x08, "€" },
+  { 0x0C, "i" },
+  { 0x14, "@" },
+  { 0x16, "ß" },
+  { 0x17, "₺" },
+  { 0x1E, ">" },
+  { 0x1F, "£" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "½" },
+  { 0x24, "{" },
+  { 0x25, "[" },
+  { 0x26, "]" },
+  { 0x27, "}" },
+  { 0x2D, "\\" },
+  { 0x2E, "|" },
+  { 0x2F, "¨" },
+  { 0x30, "~" },
+  { 0x31, "`" },
+  { 0x33, "´" },
+  { 0x35, "<" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_179_LAYER_4_ENTRIES[] = {
+  { 0x04, "Æ" },
+  { 0x0C, "İ" },
+};
+
+const wa_keyboard_mapping LAYOUT_179_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_179_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_179_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_179_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_179_LAYER_2_ENTRIES, 32u,
+  },
+  {
+    "altgr",
+    LAYOUT_179_LAYER_3_ENTRIES, 23u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_179_LAYER_4_ENTRIES, 2u,
+  },
+  {
+    "ctrl",
+    LAYOUT_179_LAYER_5_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_180_LAYER_0_ENTRIES[] = {
+  { 0x04, "ф" },
+  { 0x05, "и" },
+  { 0x06, "с" },
+  { 0x07, "в" },
+  { 0x08, "у" },
+  { 0x09, "а" },
+  { 0x0A, "п" },
+  { 0x0B, "р" },
+  { 0x0C, "ш" },
+  { 0x0D, "о" },
+  { 0x0E, "л" },
+  { 0x0F, "д" },
+  { 0x10, "җ" },
+  { 0x11, "т" },
+  { 0x12, "ә" },
+  { 0x13, "з" },
+  { 0x14, "й" },
+  { 0x15, "к" },
+  { 0x16, "ы" },
+  { 0x17, "е" },
+  { 0x18, "г" },
+  { 0x19, "м" },
+  { 0x1A, "ө" },
+  { 0x1B, "ч" },
+  { 0x1C, "н" },
+  { 0x1D, "я" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "х" },
+  { 0x30, "ү" },
+  { 0x31, "\\" },
+  { 0x33, "ң" },
+  { 0x34, "э" },
+  { 0x35, "һ" },
+  { 0x36, "б" },
+  { 0x37, "ю" },
+  { 0x38, "." },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "ґ" },
+};
+
+const wa_keyboard_mapping LAYOUT_180_LAYER_1_ENTRIES[] = {
+  { 0x04, "Ф" },
+  { 0x05, "И" },
+  { 0x06, "С" },
+  { 0x07, "В" },
+  { 0x08, "У" },
+  { 0x09, "А" },
+  { 0x0A, "П" },
+  { 0x0B, "Р" },
+  { 0x0C, "Ш" },
+  { 0x0D, "О" },
+  { 0x0E, "Л" },
+  { 0x0F, "Д" },
+  { 0x10, "Җ" },
+  { 0x11, "Т" },
+  { 0x12, "Ә" },
+  { 0x13, "З" },
+  { 0x14, "Й" },
+  { 0x15, "К" },
+  { 0x16, "Ы" },
+  { 0x17, "Е" },
+  { 0x18, "Г" },
+  { 0x19, "М" },
+  { 0x1A, "Ө" },
+  { 0x1B, "Ч" },
+  { 0x1C, "Н" },
+  { 0x1D, "Я" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "№" },
+  { 0x21, ";" },
+  { 0x22, "%" },
+  { 0x23, ":" },
+  { 0x24, "?" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "Х" },
+  { 0x30, "Ү" },
+  { 0x31, "/" },
+  { 0x33, "Ң" },
+  { 0x34, "Э" },
+  { 0x35, "Һ" },
+  { 0x36, "Б" },
+  { 0x37, "Ю" },
+  { 0x38, "," },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "Ґ" },
+};
+
+const wa_keyboard_mapping LAYOUT_180_LAYER_2_ENTRIES[] = {
+  { 0x04, "Ф" },
+  { 0x05, "И" },
+  { 0x06, "С" },
+  { 0x07, "В" },
+  { 0x08, "У" },
+  { 0x09, "А" },
+  { 0x0A, "П" },
+  { 0x0B, "Р" },
+  { 0x0C, "Ш" },
+  { 0x0D, "О" },
+  { 0x0E, "Л" },
+  { 0x0F, "Д" },
+  { 0x10, "Җ" },
+  { 0x11, "Т" },
+  { 0x12, "Ә" },
+  { 0x13, "З" },
+  { 0x14, "Й" },
+  { 0x15, "К" },
+  { 0x16, "Ы" },
+  { 0x17, "Е" },
+  { 0x18, "Г" },
+  { 0x19, "М" },
+  { 0x1A, "Ө" },
+  { 0x1B, "Ч" },
+  { 0x1C, "Н" },
+  { 0x1D, "Я" },
+  { 0x2F, "Х" },
+  { 0x30, "Ү" },
+  { 0x33, "Ң" },
+  { 0x34, "Э" },
+  { 0x35, "Һ" },
+  { 0x36, "Б" },
+  { 0x37, "Ю" },
+  { 0x64, "Ґ" },
+};
+
+const wa_keyboard_mapping LAYOUT_180_LAYER_3_ENTRIES[] = {
+  { 0x10, "ь" },
+  { 0x12, "щ" },
+  { 0x15, "ҡ" },
+  { 0x18, "ғ" },
+  { 0x1A, "ц" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x24, "[" },
+  { 0x25, "]" },
+  { 0x26, "{" },
+  { 0x27, "}" },
+  { 0x30, "ъ" },
+  { 0x33, "ж" },
+  { 0x34, "'" },
+  { 0x35, "ё" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_180_LAYER_4_ENTRIES[] = {
+  { 0x10, "Ь" },
+  { 0x12, "Щ" },
+  { 0x15, "Ҡ" },
+  { 0x18, "Ғ" },
+  { 0x1A, "Ц" },
+  { 0x25, "₽" },
+  { 0x30, "Ъ" },
+  { 0x33, "Ж" },
+  { 0x35, "Ё" },
+};
+
+const wa_keyboard_mapping LAYOUT_180_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_180_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_180_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_180_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_180_LAYER_2_ENTRIES, 34u,
+  },
+  {
+    "altgr",
+    LAYOUT_180_LAYER_3_ENTRIES, 18u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_180_LAYER_4_ENTRIES, 9u,
+  },
+  {
+    "ctrl",
+    LAYOUT_180_LAYER_5_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_181_LAYER_0_ENTRIES[] = {
+  { 0x04, "ф" },
+  { 0x05, "и" },
+  { 0x06, "с" },
+  { 0x07, "в" },
+  { 0x08, "у" },
+  { 0x09, "а" },
+  { 0x0A, "п" },
+  { 0x0B, "р" },
+  { 0x0C, "ш" },
+  { 0x0D, "о" },
+  { 0x0E, "л" },
+  { 0x0F, "д" },
+  { 0x10, "җ" },
+  { 0x11, "т" },
+  { 0x12, "ә" },
+  { 0x13, "з" },
+  { 0x14, "й" },
+  { 0x15, "к" },
+  { 0x16, "ы" },
+  { 0x17, "е" },
+  { 0x18, "г" },
+  { 0x19, "м" },
+  { 0x1A, "ө" },
+  { 0x1B, "ч" },
+  { 0x1C, "н" },
+  { 0x1D, "я" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "х" },
+  { 0x30, "ү" },
+  { 0x31, "\\" },
+  { 0x33, "ң" },
+  { 0x34, "э" },
+  { 0x35, "һ" },
+  { 0x36, "б" },
+  { 0x37, "ю" },
+  { 0x38, "." },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_181_LAYER_1_ENTRIES[] = {
+  { 0x04, "Ф" },
+  { 0x05, "И" },
+  { 0x06, "С" },
+  { 0x07, "В" },
+  { 0x08, "У" },
+  { 0x09, "А" },
+  { 0x0A, "П" },
+  { 0x0B, "Р" },
+  { 0x0C, "Ш" },
+  { 0x0D, "О" },
+  { 0x0E, "Л" },
+  { 0x0F, "Д" },
+  { 0x10, "Җ" },
+  { 0x11, "Т" },
+  { 0x12, "Ә" },
+  { 0x13, "З" },
+  { 0x14, "Й" },
+  { 0x15, "К" },
+  { 0x16, "Ы" },
+  { 0x17, "Е" },
+  { 0x18, "Г" },
+  { 0x19, "М" },
+  { 0x1A, "Ө" },
+  { 0x1B, "Ч" },
+  { 0x1C, "Н" },
+  { 0x1D, "Я" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "№" },
+  { 0x21, ";" },
+  { 0x22, "%" },
+  { 0x23, ":" },
+  { 0x24, "?" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "Х" },
+  { 0x30, "Ү" },
+  { 0x31, "/" },
+  { 0x33, "Ң" },
+  { 0x34, "Э" },
+  { 0x35, "Һ" },
+  { 0x36, "Б" },
+  { 0x37, "Ю" },
+  { 0x38, "," },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "/" },
+};
+
+const wa_keyboard_mapping LAYOUT_181_LAYER_2_ENTRIES[] = {
+  { 0x04, "Ф" },
+  { 0x05, "И" },
+  { 0x06, "С" },
+  { 0x07, "В" },
+  { 0x08, "У" },
+  { 0x09, "А" },
+  { 0x0A, "П" },
+  { 0x0B, "Р" },
+  { 0x0C, "Ш" },
+  { 0x0D, "О" },
+  { 0x0E, "Л" },
+  { 0x0F, "Д" },
+  { 0x10, "Җ" },
+  { 0x11, "Т" },
+  { 0x12, "Ә" },
+  { 0x13, "З" },
+  { 0x14, "Й" },
+  { 0x15, "К" },
+  { 0x16, "Ы" },
+  { 0x17, "Е" },
+  { 0x18, "Г" },
+  { 0x19, "М" },
+  { 0x1A, "Ө" },
+  { 0x1B, "Ч" },
+  { 0x1C, "Н" },
+  { 0x1D, "Я" },
+  { 0x2F, "Х" },
+  { 0x30, "Ү" },
+  { 0x33, "Ң" },
+  { 0x34, "Э" },
+  { 0x35, "Һ" },
+  { 0x36, "Б" },
+  { 0x37, "Ю" },
+  { 0x64, "/" },
+};
+
+const wa_keyboard_mapping LAYOUT_181_LAYER_3_ENTRIES[] = {
+  { 0x10, "ь" },
+  { 0x12, "щ" },
+  { 0x15, "ҡ" },
+  { 0x18, "ғ" },
+  { 0x1A, "ц" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x24, "[" },
+  { 0x25, "]" },
+  { 0x26, "{" },
+  { 0x27, "}" },
+  { 0x30, "ъ" },
+  { 0x33, "ж" },
+  { 0x34, "'" },
+  { 0x35, "ё" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_181_LAYER_4_ENTRIES[] = {
+  { 0x10, "Ь" },
+  { 0x12, "Щ" },
+  { 0x15, "Ҡ" },
+  { 0x18, "Ғ" },
+  { 0x1A, "Ц" },
+  { 0x25, "₽" },
+  { 0x30, "Ъ" },
+  { 0x33, "Ж" },
+  { 0x35, "Ё" },
+};
+
+const wa_keyboard_mapping LAYOUT_181_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_181_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_181_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_181_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_181_LAYER_2_ENTRIES, 34u,
+  },
+  {
+    "altgr",
+    LAYOUT_181_LAYER_3_ENTRIES, 18u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_181_LAYER_4_ENTRIES, 9u,
+  },
+  {
+    "ctrl",
+    LAYOUT_181_LAYER_5_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_182_LAYER_0_ENTRIES[] = {
+  { 0x04, "q" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "," },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "a" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "z" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "w" },
+  { 0x1E, "&" },
+  { 0x1F, "é" },
+  { 0x20, "\"" },
+  { 0x21, "'" },
+  { 0x22, "(" },
+  { 0x23, "-" },
+  { 0x24, "è" },
+  { 0x25, "_" },
+  { 0x26, "ç" },
+  { 0x27, "à" },
+  { 0x2C, " " },
+  { 0x2D, ")" },
+  { 0x2E, "=" },
+  { 0x2F, "^" },
+  { 0x30, "$" },
+  { 0x31, "*" },
+  { 0x33, "m" },
+  { 0x34, "ù" },
+  { 0x35, "²" },
+  { 0x36, ";" },
+  { 0x37, ":" },
+  { 0x38, "!" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "<" },
+};
+
+const wa_keyboard_mapping LAYOUT_182_LAYER_1_ENTRIES[] = {
+  { 0x04, "Q" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "?" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "A" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "Z" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "W" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "°" },
+  { 0x2E, "+" },
+  { 0x2F, "¨" },
+  { 0x30, "£" },
+  { 0x31, "µ" },
+  { 0x33, "M" },
+  { 0x34, "%" },
+  { 0x36, "." },
+  { 0x37, "/" },
+  { 0x38, "§" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_182_LAYER_2_ENTRIES[] = {
+  { 0x04, "Q" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "?" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "A" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "Z" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "W" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2D, "°" },
+  { 0x2E, "+" },
+  { 0x30, "£" },
+  { 0x31, "µ" },
+  { 0x33, "M" },
+  { 0x34, "%" },
+  { 0x36, "." },
+  { 0x37, "/" },
+  { 0x38, "§" },
+};
+
+const wa_keyboard_mapping LAYOUT_182_LAYER_3_ENTRIES[] = {
+  { 0x08, "€" },
+  { 0x1F, "~" },
+  { 0x20, "#" },
+  { 0x21, "{" },
+  { 0x22, "[" },
+  { 0x23, "|" },
+  { 0x24, "`" },
+  { 0x25, "\\" },
+  { 0x26, "^" },
+  { 0x27, "@" },
+  { 0x2D, "]" },
+  { 0x2E, "}" },
+  { 0x30, "¤" },
+};
+
+const wa_keyboard_mapping LAYOUT_182_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_182_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_182_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_182_LAYER_1_ENTRIES, 52u,
+  },
+  {
+    "caps",
+    LAYOUT_182_LAYER_2_ENTRIES, 45u,
+  },
+  {
+    "altgr",
+    LAYOUT_182_LAYER_3_ENTRIES, 13u,
+  },
+  {
+    "ctrl",
+    LAYOUT_182_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_183_LAYER_0_ENTRIES[] = {
+  { 0x04, "ھ" },
+  { 0x05, "ب" },
+  { 0x06, "غ" },
+  { 0x07, "د" },
+  { 0x08, "ې" },
+  { 0x09, "ا" },
+  { 0x0A, "ە" },
+  { 0x0B, "ى" },
+  { 0x0C, "ڭ" },
+  { 0x0D, "ق" },
+  { 0x0E, "ك" },
+  { 0x0F, "ل" },
+  { 0x10, "م" },
+  { 0x11, "ن" },
+  { 0x12, "و" },
+  { 0x13, "پ" },
+  { 0x14, "چ" },
+  { 0x15, "ر" },
+  { 0x16, "س" },
+  { 0x17, "ت" },
+  { 0x18, "ۇ" },
+  { 0x19, "ۈ" },
+  { 0x1A, "ۋ" },
+  { 0x1B, "ش" },
+  { 0x1C, "ي" },
+  { 0x1D, "ز" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "]" },
+  { 0x30, "[" },
+  { 0x31, "\\" },
+  { 0x33, "؛" },
+  { 0x34, "'" },
+  { 0x35, "`" },
+  { 0x36, "،" },
+  { 0x37, "." },
+  { 0x38, "ئ" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_183_LAYER_1_ENTRIES[] = {
+  { 0x07, "ژ" },
+  { 0x09, "ڧ" },
+  { 0x0A, "گ" },
+  { 0x0B, "خ" },
+  { 0x0D, "ج" },
+  { 0x0E, "ۆ" },
+  { 0x0F, "لا" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, ")" },
+  { 0x27, "(" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "»" },
+  { 0x30, "«" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x36, ">" },
+  { 0x37, "<" },
+  { 0x38, "؟" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_183_LAYER_2_ENTRIES[] = {
+  { 0x2A, "" },
+};
+
+const wa_keyboard_layer LAYOUT_183_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_183_LAYER_0_ENTRIES, 52u,
+  },
+  {
+    "shift",
+    LAYOUT_183_LAYER_1_ENTRIES, 33u,
+  },
+  {
+    "ctrl",
+    LAYOUT_183_LAYER_2_ENTRIES, 1u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_184_LAYER_0_ENTRIES[] = {
+  { 0x04, "ھ" },
+  { 0x05, "ب" },
+  { 0x06, "غ" },
+  { 0x07, "د" },
+  { 0x08, "ې" },
+  { 0x09, "ا" },
+  { 0x0A, "ە" },
+  { 0x0B, "ى" },
+  { 0x0C, "ڭ" },
+  { 0x0D, "ق" },
+  { 0x0E, "ك" },
+  { 0x0F, "ل" },
+  { 0x10, "م" },
+  { 0x11, "ن" },
+  { 0x12, "و" },
+  { 0x13, "پ" },
+  { 0x14, "چ" },
+  { 0x15, "ر" },
+  { 0x16, "س" },
+  { 0x17, "ت" },
+  { 0x18, "ۇ" },
+  { 0x19, "ۈ" },
+  { 0x1A, "ۋ" },
+  { 0x1B, "ش" },
+  { 0x1C, "ي" },
+  { 0x1D, "ز" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "]" },
+  { 0x30, "[" },
+  { 0x31, "\\" },
+  { 0x33, "؛" },
+  { 0x34, "'" },
+  { 0x35, "`" },
+  { 0x36, "،" },
+  { 0x37, "." },
+  { 0x38, "ئ" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_184_LAYER_1_ENTRIES[] = {
+  { 0x07, "ژ" },
+  { 0x09, "ف" },
+  { 0x0A, "گ" },
+  { 0x0B, "خ" },
+  { 0x0D, "ج" },
+  { 0x0E, "ۆ" },
+  { 0x0F, "لا" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, ")" },
+  { 0x27, "(" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "»" },
+  { 0x30, "«" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x36, ">" },
+  { 0x37, "<" },
+  { 0x38, "؟" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+};
+
+const wa_keyboard_mapping LAYOUT_184_LAYER_2_ENTRIES[] = {
+  { 0x2A, "" },
+};
+
+const wa_keyboard_layer LAYOUT_184_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_184_LAYER_0_ENTRIES, 52u,
+  },
+  {
+    "shift",
+    LAYOUT_184_LAYER_1_ENTRIES, 33u,
+  },
+  {
+    "ctrl",
+    LAYOUT_184_LAYER_2_ENTRIES, 1u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_185_LAYER_0_ENTRIES[] = {
+  { 0x04, "ф" },
+  { 0x05, "и" },
+  { 0x06, "с" },
+  { 0x07, "в" },
+  { 0x08, "у" },
+  { 0x09, "а" },
+  { 0x0A, "п" },
+  { 0x0B, "р" },
+  { 0x0C, "ш" },
+  { 0x0D, "о" },
+  { 0x0E, "л" },
+  { 0x0F, "д" },
+  { 0x10, "ь" },
+  { 0x11, "т" },
+  { 0x12, "щ" },
+  { 0x13, "з" },
+  { 0x14, "й" },
+  { 0x15, "к" },
+  { 0x16, "і" },
+  { 0x17, "е" },
+  { 0x18, "г" },
+  { 0x19, "м" },
+  { 0x1A, "ц" },
+  { 0x1B, "ч" },
+  { 0x1C, "н" },
+  { 0x1D, "я" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "х" },
+  { 0x30, "ї" },
+  { 0x31, "\\" },
+  { 0x33, "ж" },
+  { 0x34, "є" },
+  { 0x35, "'" },
+  { 0x36, "б" },
+  { 0x37, "ю" },
+  { 0x38, "." },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "ґ" },
+};
+
+const wa_keyboard_mapping LAYOUT_185_LAYER_1_ENTRIES[] = {
+  { 0x04, "Ф" },
+  { 0x05, "И" },
+  { 0x06, "С" },
+  { 0x07, "В" },
+  { 0x08, "У" },
+  { 0x09, "А" },
+  { 0x0A, "П" },
+  { 0x0B, "Р" },
+  { 0x0C, "Ш" },
+  { 0x0D, "О" },
+  { 0x0E, "Л" },
+  { 0x0F, "Д" },
+  { 0x10, "Ь" },
+  { 0x11, "Т" },
+  { 0x12, "Щ" },
+  { 0x13, "З" },
+  { 0x14, "Й" },
+  { 0x15, "К" },
+  { 0x16, "І" },
+  { 0x17, "Е" },
+  { 0x18, "Г" },
+  { 0x19, "М" },
+  { 0x1A, "Ц" },
+  { 0x1B, "Ч" },
+  { 0x1C, "Н" },
+  { 0x1D, "Я" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "№" },
+  { 0x21, ";" },
+  { 0x22, "%" },
+  { 0x23, ":" },
+  { 0x24, "?" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "Х" },
+  { 0x30, "Ї" },
+  { 0x31, "/" },
+  { 0x33, "Ж" },
+  { 0x34, "Є" },
+  { 0x35, "₴" },
+  { 0x36, "Б" },
+  { 0x37, "Ю" },
+  { 0x38, "," },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "Ґ" },
+};
+
+const wa_keyboard_mapping LAYOUT_185_LAYER_2_ENTRIES[] = {
+  { 0x04, "Ф" },
+  { 0x05, "И" },
+  { 0x06, "С" },
+  { 0x07, "В" },
+  { 0x08, "У" },
+  { 0x09, "А" },
+  { 0x0A, "П" },
+  { 0x0B, "Р" },
+  { 0x0C, "Ш" },
+  { 0x0D, "О" },
+  { 0x0E, "Л" },
+  { 0x0F, "Д" },
+  { 0x10, "Ь" },
+  { 0x11, "Т" },
+  { 0x12, "Щ" },
+  { 0x13, "З" },
+  { 0x14, "Й" },
+  { 0x15, "К" },
+  { 0x16, "І" },
+  { 0x17, "Е" },
+  { 0x18, "Г" },
+  { 0x19, "М" },
+  { 0x1A, "Ц" },
+  { 0x1B, "Ч" },
+  { 0x1C, "Н" },
+  { 0x1D, "Я" },
+  { 0x2F, "Х" },
+  { 0x30, "Ї" },
+  { 0x33, "Ж" },
+  { 0x34, "Є" },
+  { 0x36, "Б" },
+  { 0x37, "Ю" },
+  { 0x64, "Ґ" },
+};
+
+const wa_keyboard_mapping LAYOUT_185_LAYER_3_ENTRIES[] = {
+  { 0x18, "ґ" },
+};
+
+const wa_keyboard_mapping LAYOUT_185_LAYER_4_ENTRIES[] = {
+  { 0x18, "Ґ" },
+};
+
+const wa_keyboard_mapping LAYOUT_185_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_185_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_185_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_185_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_185_LAYER_2_ENTRIES, 33u,
+  },
+  {
+    "altgr",
+    LAYOUT_185_LAYER_3_ENTRIES, 1u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_185_LAYER_4_ENTRIES, 1u,
+  },
+  {
+    "ctrl",
+    LAYOUT_185_LAYER_5_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_186_LAYER_0_ENTRIES[] = {
+  { 0x04, "ф" },
+  { 0x05, "и" },
+  { 0x06, "с" },
+  { 0x07, "в" },
+  { 0x08, "у" },
+  { 0x09, "а" },
+  { 0x0A, "п" },
+  { 0x0B, "р" },
+  { 0x0C, "ш" },
+  { 0x0D, "о" },
+  { 0x0E, "л" },
+  { 0x0F, "д" },
+  { 0x10, "ь" },
+  { 0x11, "т" },
+  { 0x12, "щ" },
+  { 0x13, "з" },
+  { 0x14, "й" },
+  { 0x15, "к" },
+  { 0x16, "і" },
+  { 0x17, "е" },
+  { 0x18, "г" },
+  { 0x19, "м" },
+  { 0x1A, "ц" },
+  { 0x1B, "ч" },
+  { 0x1C, "н" },
+  { 0x1D, "я" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "х" },
+  { 0x30, "ї" },
+  { 0x31, "\\" },
+  { 0x33, "ж" },
+  { 0x34, "є" },
+  { 0x35, "ё" },
+  { 0x36, "б" },
+  { 0x37, "ю" },
+  { 0x38, "." },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "ґ" },
+};
+
+const wa_keyboard_mapping LAYOUT_186_LAYER_1_ENTRIES[] = {
+  { 0x04, "Ф" },
+  { 0x05, "И" },
+  { 0x06, "С" },
+  { 0x07, "В" },
+  { 0x08, "У" },
+  { 0x09, "А" },
+  { 0x0A, "П" },
+  { 0x0B, "Р" },
+  { 0x0C, "Ш" },
+  { 0x0D, "О" },
+  { 0x0E, "Л" },
+  { 0x0F, "Д" },
+  { 0x10, "Ь" },
+  { 0x11, "Т" },
+  { 0x12, "Щ" },
+  { 0x13, "З" },
+  { 0x14, "Й" },
+  { 0x15, "К" },
+  { 0x16, "І" },
+  { 0x17, "Е" },
+  { 0x18, "Г" },
+  { 0x19, "М" },
+  { 0x1A, "Ц" },
+  { 0x1B, "Ч" },
+  { 0x1C, "Н" },
+  { 0x1D, "Я" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "№" },
+  { 0x21, ";" },
+  { 0x22, "%" },
+  { 0x23, ":" },
+  { 0x24, "?" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "Х" },
+  { 0x30, "Ї" },
+  { 0x31, "/" },
+  { 0x33, "Ж" },
+  { 0x34, "Є" },
+  { 0x35, "Ё" },
+  { 0x36, "Б" },
+  { 0x37, "Ю" },
+  { 0x38, "," },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "Ґ" },
+};
+
+const wa_keyboard_mapping LAYOUT_186_LAYER_2_ENTRIES[] = {
+  { 0x04, "Ф" },
+  { 0x05, "И" },
+  { 0x06, "С" },
+  { 0x07, "В" },
+  { 0x08, "У" },
+  { 0x09, "А" },
+  { 0x0A, "П" },
+  { 0x0B, "Р" },
+  { 0x0C, "Ш" },
+  { 0x0D, "О" },
+  { 0x0E, "Л" },
+  { 0x0F, "Д" },
+  { 0x10, "Ь" },
+  { 0x11, "Т" },
+  { 0x12, "Щ" },
+  { 0x13, "З" },
+  { 0x14, "Й" },
+  { 0x15, "К" },
+  { 0x16, "І" },
+  { 0x17, "Е" },
+  { 0x18, "Г" },
+  { 0x19, "М" },
+  { 0x1A, "Ц" },
+  { 0x1B, "Ч" },
+  { 0x1C, "Н" },
+  { 0x1D, "Я" },
+  { 0x2F, "Х" },
+  { 0x30, "Ї" },
+  { 0x33, "Ж" },
+  { 0x34, "Є" },
+  { 0x35, "Ё" },
+  { 0x36, "Б" },
+  { 0x37, "Ю" },
+  { 0x64, "Ґ" },
+};
+
+const wa_keyboard_mapping LAYOUT_186_LAYER_3_ENTRIES[] = {
+  { 0x18, "ґ" },
+};
+
+const wa_keyboard_mapping LAYOUT_186_LAYER_4_ENTRIES[] = {
+  { 0x18, "Ґ" },
+};
+
+const wa_keyboard_mapping LAYOUT_186_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_186_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_186_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_186_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_186_LAYER_2_ENTRIES, 34u,
+  },
+  {
+    "altgr",
+    LAYOUT_186_LAYER_3_ENTRIES, 1u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_186_LAYER_4_ENTRIES, 1u,
+  },
+  {
+    "ctrl",
+    LAYOUT_186_LAYER_5_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_187_LAYER_0_ENTRIES[] = {
+  { 0x04, "م" },
+  { 0x05, "ش" },
+  { 0x06, "ے" },
+  { 0x07, "ر" },
+  { 0x08, "ھ" },
+  { 0x09, "ن" },
+  { 0x0A, "ل" },
+  { 0x0B, "ہ" },
+  { 0x0C, "ب" },
+  { 0x0D, "ا" },
+  { 0x0E, "ک" },
+  { 0x0F, "ی" },
+  { 0x10, "ع" },
+  { 0x11, "غ" },
+  { 0x12, "ج" },
+  { 0x13, "ح" },
+  { 0x14, "ط" },
+  { 0x15, "د" },
+  { 0x16, "و" },
+  { 0x17, "ٹ" },
+  { 0x18, "ت" },
+  { 0x19, "س" },
+  { 0x1A, "ص" },
+  { 0x1B, "ف" },
+  { 0x1C, "پ" },
+  { 0x1D, "ق" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "]" },
+  { 0x30, "[" },
+  { 0x31, "\\" },
+  { 0x33, "؛" },
+  { 0x34, "'" },
+  { 0x35, "`" },
+  { 0x36, "،" },
+  { 0x37, "۔" },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_187_LAYER_1_ENTRIES[] = {
+  { 0x04, "ژ" },
+  { 0x05, "ؤ" },
+  { 0x06, "ۓ" },
+  { 0x07, "ڑ" },
+  { 0x08, "ذ" },
+  { 0x09, "ں" },
+  { 0x0A, "ۂ" },
+  { 0x0B, "ء" },
+  { 0x0C, "ـ" },
+  { 0x0D, "آ" },
+  { 0x0E, "گ" },
+  { 0x0F, "ي" },
+  { 0x10, "‏" },
+  { 0x11, "ئ" },
+  { 0x12, "چ" },
+  { 0x13, "خ" },
+  { 0x14, "ظ" },
+  { 0x15, "ڈ" },
+  { 0x16, "ز" },
+  { 0x17, "ث" },
+  { 0x18, "ۃ" },
+  { 0x19, "‎" },
+  { 0x1A, "ض" },
+  { 0x1B, "‌" },
+  { 0x1C, "ّ" },
+  { 0x1D, "‍" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "٪" },
+  { 0x23, "^" },
+  { 0x24, "ۖ" },
+  { 0x25, "٭" },
+  { 0x26, ")" },
+  { 0x27, "(" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "}" },
+  { 0x30, "{" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x36, ">" },
+  { 0x37, "<" },
+  { 0x38, "؟" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_187_LAYER_2_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_187_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_187_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_187_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "ctrl",
+    LAYOUT_187_LAYER_2_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_188_LAYER_0_ENTRIES[] = {
+  { 0x04, "ф" },
+  { 0x05, "и" },
+  { 0x06, "с" },
+  { 0x07, "в" },
+  { 0x08, "у" },
+  { 0x09, "а" },
+  { 0x0A, "п" },
+  { 0x0B, "р" },
+  { 0x0C, "ш" },
+  { 0x0D, "о" },
+  { 0x0E, "л" },
+  { 0x0F, "д" },
+  { 0x10, "ь" },
+  { 0x11, "т" },
+  { 0x12, "ў" },
+  { 0x13, "з" },
+  { 0x14, "й" },
+  { 0x15, "к" },
+  { 0x16, "қ" },
+  { 0x17, "е" },
+  { 0x18, "г" },
+  { 0x19, "м" },
+  { 0x1A, "ц" },
+  { 0x1B, "ч" },
+  { 0x1C, "н" },
+  { 0x1D, "я" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "ғ" },
+  { 0x2E, "ҳ" },
+  { 0x2F, "х" },
+  { 0x30, "ъ" },
+  { 0x31, "\\" },
+  { 0x33, "ж" },
+  { 0x34, "э" },
+  { 0x35, "ё" },
+  { 0x36, "б" },
+  { 0x37, "ю" },
+  { 0x38, "." },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_188_LAYER_1_ENTRIES[] = {
+  { 0x04, "Ф" },
+  { 0x05, "И" },
+  { 0x06, "С" },
+  { 0x07, "В" },
+  { 0x08, "У" },
+  { 0x09, "А" },
+  { 0x0A, "П" },
+  { 0x0B, "Р" },
+  { 0x0C, "Ш" },
+  { 0x0D, "О" },
+  { 0x0E, "Л" },
+  { 0x0F, "Д" },
+  { 0x10, "Ь" },
+  { 0x11, "Т" },
+  { 0x12, "Ў" },
+  { 0x13, "З" },
+  { 0x14, "Й" },
+  { 0x15, "К" },
+  { 0x16, "Қ" },
+  { 0x17, "Е" },
+  { 0x18, "Г" },
+  { 0x19, "М" },
+  { 0x1A, "Ц" },
+  { 0x1B, "Ч" },
+  { 0x1C, "Н" },
+  { 0x1D, "Я" },
+  { 0x1E, "!" },
+  { 0x1F, "\"" },
+  { 0x20, "№" },
+  { 0x21, ";" },
+  { 0x22, "%" },
+  { 0x23, ":" },
+  { 0x24, "?" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "Ғ" },
+  { 0x2E, "Ҳ" },
+  { 0x2F, "Х" },
+  { 0x30, "Ъ" },
+  { 0x31, "/" },
+  { 0x33, "Ж" },
+  { 0x34, "Э" },
+  { 0x35, "Ё" },
+  { 0x36, "Б" },
+  { 0x37, "Ю" },
+  { 0x38, "," },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "/" },
+};
+
+const wa_keyboard_mapping LAYOUT_188_LAYER_2_ENTRIES[] = {
+  { 0x04, "Ф" },
+  { 0x05, "И" },
+  { 0x06, "С" },
+  { 0x07, "В" },
+  { 0x08, "У" },
+  { 0x09, "А" },
+  { 0x0A, "П" },
+  { 0x0B, "Р" },
+  { 0x0C, "Ш" },
+  { 0x0D, "О" },
+  { 0x0E, "Л" },
+  { 0x0F, "Д" },
+  { 0x10, "Ь" },
+  { 0x11, "Т" },
+  { 0x12, "Ў" },
+  { 0x13, "З" },
+  { 0x14, "Й" },
+  { 0x15, "К" },
+  { 0x16, "Қ" },
+  { 0x17, "Е" },
+  { 0x18, "Г" },
+  { 0x19, "М" },
+  { 0x1A, "Ц" },
+  { 0x1B, "Ч" },
+  { 0x1C, "Н" },
+  { 0x1D, "Я" },
+  { 0x2D, "Ғ" },
+  { 0x2E, "Ҳ" },
+  { 0x2F, "Х" },
+  { 0x30, "Ъ" },
+  { 0x33, "Ж" },
+  { 0x34, "Э" },
+  { 0x35, "Ё" },
+  { 0x36, "Б" },
+  { 0x37, "Ю" },
+};
+
+const wa_keyboard_mapping LAYOUT_188_LAYER_3_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_188_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_188_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_188_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_188_LAYER_2_ENTRIES, 35u,
+  },
+  {
+    "ctrl",
+    LAYOUT_188_LAYER_3_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_189_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "ă" },
+  { 0x1F, "â" },
+  { 0x20, "ê" },
+  { 0x21, "ô" },
+  { 0x22, "̀" },
+  { 0x23, "̉" },
+  { 0x24, "̃" },
+  { 0x25, "́" },
+  { 0x26, "̣" },
+  { 0x27, "đ" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "₫" },
+  { 0x2F, "ư" },
+  { 0x30, "ơ" },
+  { 0x31, "\\" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x35, "`" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_189_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "Ă" },
+  { 0x1F, "Â" },
+  { 0x20, "Ê" },
+  { 0x21, "Ô" },
+  { 0x22, "̀" },
+  { 0x23, "̉" },
+  { 0x24, "̃" },
+  { 0x25, "́" },
+  { 0x26, "̣" },
+  { 0x27, "Đ" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "Ư" },
+  { 0x30, "Ơ" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_189_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "Ă" },
+  { 0x1F, "Â" },
+  { 0x20, "Ê" },
+  { 0x21, "Ô" },
+  { 0x25, "́" },
+  { 0x27, "Đ" },
+  { 0x2F, "Ư" },
+  { 0x30, "Ơ" },
+};
+
+const wa_keyboard_mapping LAYOUT_189_LAYER_3_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x35, "`" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_189_LAYER_4_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "?" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_189_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_189_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_189_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_189_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_189_LAYER_2_ENTRIES, 34u,
+  },
+  {
+    "altgr",
+    LAYOUT_189_LAYER_3_ENTRIES, 48u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_189_LAYER_4_ENTRIES, 48u,
+  },
+  {
+    "ctrl",
+    LAYOUT_189_LAYER_5_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_190_LAYER_0_ENTRIES[] = {
+  { 0x04, "q" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "," },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "a" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "z" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "w" },
+  { 0x1E, "&" },
+  { 0x1F, "é" },
+  { 0x20, "\"" },
+  { 0x21, "'" },
+  { 0x22, "(" },
+  { 0x23, "-" },
+  { 0x24, "ñ" },
+  { 0x25, "_" },
+  { 0x26, "ŋ" },
+  { 0x27, "à" },
+  { 0x2C, " " },
+  { 0x2D, ")" },
+  { 0x2E, "=" },
+  { 0x2F, "^" },
+  { 0x30, "ó" },
+  { 0x31, "*" },
+  { 0x33, "m" },
+  { 0x34, "ù" },
+  { 0x35, "ã" },
+  { 0x36, ";" },
+  { 0x37, ":" },
+  { 0x38, "!" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "<" },
+};
+
+const wa_keyboard_mapping LAYOUT_190_LAYER_1_ENTRIES[] = {
+  { 0x04, "Q" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "?" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "A" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "Z" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "W" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "É" },
+  { 0x2E, "+" },
+  { 0x2F, "¨" },
+  { 0x30, "Ó" },
+  { 0x31, "Ñ" },
+  { 0x33, "M" },
+  { 0x34, "À" },
+  { 0x35, "Ã" },
+  { 0x36, "." },
+  { 0x37, "/" },
+  { 0x38, "Ŋ" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, ">" },
+};
+
+const wa_keyboard_mapping LAYOUT_190_LAYER_2_ENTRIES[] = {
+  { 0x04, "Q" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "?" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "A" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "Z" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "W" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2D, "É" },
+  { 0x2E, "+" },
+  { 0x30, "Ó" },
+  { 0x31, "Ñ" },
+  { 0x33, "M" },
+  { 0x35, "Ã" },
+  { 0x36, "." },
+  { 0x37, "/" },
+  { 0x38, "Ŋ" },
+};
+
+const wa_keyboard_mapping LAYOUT_190_LAYER_3_ENTRIES[] = {
+  { 0x08, "€" },
+  { 0x1F, "~" },
+  { 0x20, "#" },
+  { 0x21, "{" },
+  { 0x22, "[" },
+  { 0x23, "|" },
+  { 0x24, "`" },
+  { 0x25, "\\" },
+  { 0x26, "^" },
+  { 0x27, "@" },
+  { 0x2D, "]" },
+  { 0x2E, "}" },
+  { 0x30, "¤" },
+};
+
+const wa_keyboard_mapping LAYOUT_190_LAYER_4_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_190_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_190_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_190_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_190_LAYER_2_ENTRIES, 45u,
+  },
+  {
+    "altgr",
+    LAYOUT_190_LAYER_3_ENTRIES, 13u,
+  },
+  {
+    "ctrl",
+    LAYOUT_190_LAYER_4_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_191_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x35, "`" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_191_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_191_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+};
+
+const wa_keyboard_mapping LAYOUT_191_LAYER_3_ENTRIES[] = {
+  { 0x04, "ọ́" },
+  { 0x0E, "ẹ́" },
+  { 0x0F, "ẹ̀" },
+  { 0x16, "ọ̀" },
+  { 0x22, "€" },
+  { 0x26, "‘" },
+  { 0x27, "’" },
+  { 0x33, "¶" },
+};
+
+const wa_keyboard_mapping LAYOUT_191_LAYER_4_ENTRIES[] = {
+  { 0x04, "Ọ́" },
+  { 0x0E, "Ẹ́" },
+  { 0x0F, "Ẹ̀" },
+  { 0x16, "Ọ̀" },
+  { 0x31, "¦" },
+  { 0x34, "¨" },
+};
+
+const wa_keyboard_mapping LAYOUT_191_LAYER_5_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_191_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_191_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_191_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_191_LAYER_2_ENTRIES, 26u,
+  },
+  {
+    "altgr",
+    LAYOUT_191_LAYER_3_ENTRIES, 8u,
+  },
+  {
+    "shift_altgr",
+    LAYOUT_191_LAYER_4_ENTRIES, 6u,
+  },
+  {
+    "ctrl",
+    LAYOUT_191_LAYER_5_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_192_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x35, "`" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_192_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_192_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+};
+
+const wa_keyboard_mapping LAYOUT_192_LAYER_3_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_192_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_192_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_192_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_192_LAYER_2_ENTRIES, 26u,
+  },
+  {
+    "ctrl",
+    LAYOUT_192_LAYER_3_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_193_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x35, "`" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_193_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_193_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+};
+
+const wa_keyboard_mapping LAYOUT_193_LAYER_3_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_193_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_193_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_193_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_193_LAYER_2_ENTRIES, 26u,
+  },
+  {
+    "ctrl",
+    LAYOUT_193_LAYER_3_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_194_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x35, "`" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_194_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_194_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+};
+
+const wa_keyboard_mapping LAYOUT_194_LAYER_3_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_194_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_194_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_194_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_194_LAYER_2_ENTRIES, 26u,
+  },
+  {
+    "ctrl",
+    LAYOUT_194_LAYER_3_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_195_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x35, "`" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_195_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_195_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+};
+
+const wa_keyboard_mapping LAYOUT_195_LAYER_3_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_195_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_195_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_195_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_195_LAYER_2_ENTRIES, 26u,
+  },
+  {
+    "ctrl",
+    LAYOUT_195_LAYER_3_ENTRIES, 2u,
+  },
+};
+
+const wa_keyboard_mapping LAYOUT_196_LAYER_0_ENTRIES[] = {
+  { 0x04, "a" },
+  { 0x05, "b" },
+  { 0x06, "c" },
+  { 0x07, "d" },
+  { 0x08, "e" },
+  { 0x09, "f" },
+  { 0x0A, "g" },
+  { 0x0B, "h" },
+  { 0x0C, "i" },
+  { 0x0D, "j" },
+  { 0x0E, "k" },
+  { 0x0F, "l" },
+  { 0x10, "m" },
+  { 0x11, "n" },
+  { 0x12, "o" },
+  { 0x13, "p" },
+  { 0x14, "q" },
+  { 0x15, "r" },
+  { 0x16, "s" },
+  { 0x17, "t" },
+  { 0x18, "u" },
+  { 0x19, "v" },
+  { 0x1A, "w" },
+  { 0x1B, "x" },
+  { 0x1C, "y" },
+  { 0x1D, "z" },
+  { 0x1E, "1" },
+  { 0x1F, "2" },
+  { 0x20, "3" },
+  { 0x21, "4" },
+  { 0x22, "5" },
+  { 0x23, "6" },
+  { 0x24, "7" },
+  { 0x25, "8" },
+  { 0x26, "9" },
+  { 0x27, "0" },
+  { 0x2C, " " },
+  { 0x2D, "-" },
+  { 0x2E, "=" },
+  { 0x2F, "[" },
+  { 0x30, "]" },
+  { 0x31, "\\" },
+  { 0x33, ";" },
+  { 0x34, "'" },
+  { 0x35, "`" },
+  { 0x36, "," },
+  { 0x37, "." },
+  { 0x38, "/" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "\\" },
+};
+
+const wa_keyboard_mapping LAYOUT_196_LAYER_1_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+  { 0x1E, "!" },
+  { 0x1F, "@" },
+  { 0x20, "#" },
+  { 0x21, "$" },
+  { 0x22, "%" },
+  { 0x23, "^" },
+  { 0x24, "&" },
+  { 0x25, "*" },
+  { 0x26, "(" },
+  { 0x27, ")" },
+  { 0x2C, " " },
+  { 0x2D, "_" },
+  { 0x2E, "+" },
+  { 0x2F, "{" },
+  { 0x30, "}" },
+  { 0x31, "|" },
+  { 0x33, ":" },
+  { 0x34, "\"" },
+  { 0x35, "~" },
+  { 0x36, "<" },
+  { 0x37, ">" },
+  { 0x38, "?" },
+  { 0x54, "/" },
+  { 0x55, "*" },
+  { 0x56, "-" },
+  { 0x57, "+" },
+  { 0x64, "|" },
+};
+
+const wa_keyboard_mapping LAYOUT_196_LAYER_2_ENTRIES[] = {
+  { 0x04, "A" },
+  { 0x05, "B" },
+  { 0x06, "C" },
+  { 0x07, "D" },
+  { 0x08, "E" },
+  { 0x09, "F" },
+  { 0x0A, "G" },
+  { 0x0B, "H" },
+  { 0x0C, "I" },
+  { 0x0D, "J" },
+  { 0x0E, "K" },
+  { 0x0F, "L" },
+  { 0x10, "M" },
+  { 0x11, "N" },
+  { 0x12, "O" },
+  { 0x13, "P" },
+  { 0x14, "Q" },
+  { 0x15, "R" },
+  { 0x16, "S" },
+  { 0x17, "T" },
+  { 0x18, "U" },
+  { 0x19, "V" },
+  { 0x1A, "W" },
+  { 0x1B, "X" },
+  { 0x1C, "Y" },
+  { 0x1D, "Z" },
+};
+
+const wa_keyboard_mapping LAYOUT_196_LAYER_3_ENTRIES[] = {
+  { 0x2A, "" },
+  { 0x2C, " " },
+};
+
+const wa_keyboard_layer LAYOUT_196_LAYERS[] = {
+  {
+    "base",
+    LAYOUT_196_LAYER_0_ENTRIES, 53u,
+  },
+  {
+    "shift",
+    LAYOUT_196_LAYER_1_ENTRIES, 53u,
+  },
+  {
+    "caps",
+    LAYOUT_196_LAYER_2_ENTRIES, 26u,
+  },
+  {
+    "ctrl",
+    LAYOUT_196_LAYER_3_ENTRIES, 2u,
+  },
+};
+
@@ -0,0 +1,1388 @@
+#include "worldalphabets_data.h"
+
+const char *WA_LAYOUT_IDS[] = {
+  "00000407",
+  "ar-arabic-101",
+  "ar-arabic-102-azerty",
+  "ar-arabic-102",
+  "as-assamese---inscript",
+  "az-azerbaijani-cyrillic",
+  "az-azerbaijani-latin",
+  "az-azerbaijani-standard",
+  "ba-bashkir",
+  "be-belarusian",
+  "bg-bulgarian-latin",
+  "bg-bulgarian-phonetic-traditional",
+  "bg-bulgarian-phonetic",
+  "bg-bulgarian-typewriter",
+  "bg-bulgarian",
+  "bn-bangla---inscript-legacy",
+  "bn-bangla---inscript",
+  "bn-bangla",
+  "bo-tibetan-prc---updated",
+  "bo-tibetan-prc",
+  "bs-bosnian-cyrillic",
+  "bug-buginese",
+  "chr-cherokee-nation",
+  "chr-cherokee-phonetic",
+  "ckb-central-kurdish",
+  "cs-czech-programmers",
+  "cs-czech-qwerty",
+  "cs-czech",
+  "da-danish",
+  "de-DE-qwertz",
+  "de-german-extended-e1",
+  "de-german-extended-e2",
+  "de-german-ibm",
+  "de-german",
+  "de-swiss-german",
+  "dv-divehi-phonetic",
+  "dv-divehi-typewriter",
+  "dz-dzongkha",
+  "el-greek-220-latin",
+  "el-greek-220",
+  "el-greek-319-latin",
+  "el-greek-319",
+  "el-greek-latin",
+  "el-greek-polytonic",
+  "el-greek",
+  "en-GB-qwerty",
+  "en-english-india",
+  "en-united-kingdom",
+  "en-united-states-dvorak",
+  "en-united-states-international",
+  "en-us-english-table-for-ibm-arabic-238l",
+  "en-us",
+  "es-latin-american",
+  "es-spanish-variation",
+  "es-spanish",
+  "et-estonian",
+  "fa-persian-standard",
+  "fa-persian",
+  "fi-finnish-with-sami",
+  "fi-finnish",
+  "fo-faeroese",
+  "fr-belgian-french",
+  "fr-canadian-french-legacy",
+  "fr-canadian-french",
+  "fr-french-legacy-azerty",
+  "fr-french-standard-azerty",
+  "fr-french-standard-bpo",
+  "fr-swiss-french",
+  "ga-irish",
+  "gd-scottish-gaelic",
+  "gn-guarani",
+  "gu-gujarati",
+  "ha-hausa",
+  "haw-hawaiian",
+  "he-hebrew-standard-2018",
+  "he-hebrew-standard",
+  "he-hebrew",
+  "hi-hindi-traditional",
+  "hu-hungarian-101-key",
+  "hu-hungarian",
+  "hy-armenian-eastern-legacy",
+  "hy-armenian-phonetic",
+  "hy-armenian-typewriter",
+  "hy-armenian-western-legacy",
+  "ig-igbo",
+  "is-icelandic",
+  "it-italian-142",
+  "it-italian",
+  "iu-inuktitut---latin",
+  "iu-inuktitut---naqittaut",
+  "iu-inuktitut---nattilik",
+  "ja-japanese",
+  "jv-javanese",
+  "ka-georgian-ergonomic",
+  "ka-georgian-legacy",
+  "ka-georgian-mes",
+  "ka-georgian-old-alphabets",
+  "ka-georgian-qwerty",
+  "kk-kazakh",
+  "kl-greenlandic",
+  "km-khmer-nida",
+  "km-khmer",
+  "kn-kannada",
+  "ko-korean",
+  "ky-kyrgyz-cyrillic",
+  "lb-luxembourgish",
+  "lis-lisu-basic",
+  "lis-lisu-standard",
+  "lo-lao",
+  "lt-lithuanian-ibm",
+  "lt-lithuanian-standard",
+  "lt-lithuanian",
+  "lv-latvian-qwerty",
+  "lv-latvian-standard",
+  "lv-latvian",
+  "mi-maori",
+  "mk-macedonian---standard",
+  "mk-macedonian",
+  "ml-malayalam",
+  "mn-mongolian-cyrillic",
+  "mn-mongolian-mongolian-script",
+  "mn-traditional-mongolian-mns",
+  "mn-traditional-mongolian-standard",
+  "mo-romanian-legacy",
+  "mo-romanian-programmers",
+  "mo-romanian-standard",
+  "mr-marathi",
+  "mt-maltese-47-key",
+  "mt-maltese-48-key",
+  "my-myanmar-phonetic-order",
+  "my-myanmar-visual-order",
+  "ne-nepali",
+  "nl-dutch",
+  "no-norwegian-with-sami",
+  "no-norwegian",
+  "nqo-nko",
+  "nso-sesotho-sa-leboa",
+  "or-odia",
+  "osa-osage",
+  "pa-punjabi",
+  "pl-polish-214",
+  "pl-polish-programmers",
+  "ps-pashto-afghanistan",
+  "pt-portuguese-brazil-abnt",
+  "pt-portuguese-brazil-abnt2",
+  "pt-portuguese",
+  "ro-romanian-legacy",
+  "ro-romanian-programmers",
+  "ro-romanian-standard",
+  "ru-russian---mnemonic",
+  "ru-russian-typewriter",
+  "ru-russian",
+  "sah-sakha",
+  "sh-serbian-cyrillic",
+  "sh-serbian-latin",
+  "si-sinhala---wij-9",
+  "si-sinhala",
+  "sk-slovak-qwerty",
+  "sk-slovak",
+  "sl-slovenian",
+  "sq-albanian",
+  "sr-serbian-cyrillic",
+  "sr-serbian-latin",
+  "sv-swedish-with-sami",
+  "sv-swedish",
+  "syr-syriac-phonetic",
+  "syr-syriac",
+  "ta-tamil-99",
+  "ta-tamil-anjal",
+  "ta-tamil",
+  "te-telugu",
+  "tg-tajik",
+  "th-thai-kedmanee-non-shiftlock",
+  "th-thai-kedmanee",
+  "th-thai-pattachote-non-shiftlock",
+  "th-thai-pattachote",
+  "tk-turkmen",
+  "tn-setswana",
+  "tr-turkish-f",
+  "tr-turkish-q",
+  "tt-tatar-legacy",
+  "tt-tatar",
+  "tzm-central-atlas-tamazight",
+  "ug-uyghur-legacy",
+  "ug-uyghur",
+  "uk-ukrainian-enhanced",
+  "uk-ukrainian",
+  "ur-urdu",
+  "uz-uzbek-cyrillic",
+  "vi-vietnamese",
+  "wo-wolof",
+  "yo-yoruba",
+  "zh-chinese-simplified---us",
+  "zh-chinese-simplified-singapore---us",
+  "zh-chinese-traditional---us",
+  "zh-chinese-traditional-hong-kong-sar---us",
+  "zh-chinese-traditional-macao-sar---us",
+};
+
+extern const wa_keyboard_layer LAYOUT_0_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_1_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_2_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_3_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_4_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_5_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_6_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_7_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_8_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_9_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_10_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_11_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_12_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_13_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_14_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_15_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_16_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_17_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_18_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_19_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_20_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_21_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_22_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_23_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_24_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_25_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_26_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_27_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_28_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_29_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_30_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_31_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_32_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_33_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_34_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_35_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_36_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_37_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_38_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_39_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_40_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_41_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_42_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_43_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_44_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_45_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_46_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_47_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_48_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_49_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_50_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_51_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_52_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_53_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_54_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_55_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_56_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_57_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_58_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_59_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_60_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_61_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_62_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_63_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_64_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_65_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_66_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_67_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_68_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_69_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_70_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_71_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_72_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_73_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_74_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_75_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_76_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_77_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_78_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_79_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_80_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_81_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_82_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_83_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_84_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_85_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_86_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_87_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_88_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_89_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_90_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_91_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_92_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_93_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_94_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_95_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_96_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_97_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_98_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_99_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_100_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_101_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_102_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_103_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_104_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_105_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_106_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_107_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_108_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_109_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_110_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_111_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_112_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_113_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_114_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_115_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_116_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_117_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_118_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_119_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_120_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_121_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_122_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_123_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_124_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_125_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_126_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_127_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_128_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_129_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_130_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_131_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_132_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_133_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_134_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_135_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_136_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_137_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_138_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_139_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_140_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_141_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_142_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_143_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_144_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_145_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_146_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_147_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_148_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_149_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_150_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_151_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_152_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_153_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_154_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_155_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_156_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_157_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_158_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_159_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_160_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_161_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_162_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_163_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_164_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_165_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_166_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_167_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_168_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_169_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_170_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_171_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_172_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_173_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_174_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_175_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_176_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_177_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_178_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_179_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_180_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_181_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_182_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_183_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_184_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_185_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_186_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_187_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_188_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_189_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_190_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_191_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_192_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_193_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_194_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_195_LAYERS[];
+extern const wa_keyboard_layer LAYOUT_196_LAYERS[];
+
+const wa_keyboard_layout WA_KEYBOARD_LAYOUTS[] = {
+  {
+    "00000407",
+    "00000407",
+    LAYOUT_0_LAYERS, 5u,
+  },
+  {
+    "ar-arabic-101",
+    "Arabic (101)",
+    LAYOUT_1_LAYERS, 3u,
+  },
+  {
+    "ar-arabic-102-azerty",
+    "Arabic (102) AZERTY",
+    LAYOUT_2_LAYERS, 5u,
+  },
+  {
+    "ar-arabic-102",
+    "Arabic (102)",
+    LAYOUT_3_LAYERS, 5u,
+  },
+  {
+    "as-assamese---inscript",
+    "Assamese - INSCRIPT",
+    LAYOUT_4_LAYERS, 3u,
+  },
+  {
+    "az-azerbaijani-cyrillic",
+    "Azerbaijani Cyrillic",
+    LAYOUT_5_LAYERS, 5u,
+  },
+  {
+    "az-azerbaijani-latin",
+    "Azerbaijani Latin",
+    LAYOUT_6_LAYERS, 5u,
+  },
+  {
+    "az-azerbaijani-standard",
+    "Azerbaijani (Standard)",
+    LAYOUT_7_LAYERS, 5u,
+  },
+  {
+    "ba-bashkir",
+    "Bashkir",
+    LAYOUT_8_LAYERS, 5u,
+  },
+  {
+    "be-belarusian",
+    "Belarusian",
+    LAYOUT_9_LAYERS, 4u,
+  },
+  {
+    "bg-bulgarian-latin",
+    "Bulgarian (Latin)",
+    LAYOUT_10_LAYERS, 4u,
+  },
+  {
+    "bg-bulgarian-phonetic-traditional",
+    "Bulgarian (Phonetic Traditional)",
+    LAYOUT_11_LAYERS, 5u,
+  },
+  {
+    "bg-bulgarian-phonetic",
+    "Bulgarian (Phonetic)",
+    LAYOUT_12_LAYERS, 4u,
+  },
+  {
+    "bg-bulgarian-typewriter",
+    "Bulgarian (Typewriter)",
+    LAYOUT_13_LAYERS, 4u,
+  },
+  {
+    "bg-bulgarian",
+    "Bulgarian",
+    LAYOUT_14_LAYERS, 4u,
+  },
+  {
+    "bn-bangla---inscript-legacy",
+    "Bangla - INSCRIPT (Legacy)",
+    LAYOUT_15_LAYERS, 3u,
+  },
+  {
+    "bn-bangla---inscript",
+    "Bangla - INSCRIPT",
+    LAYOUT_16_LAYERS, 3u,
+  },
+  {
+    "bn-bangla",
+    "Bangla",
+    LAYOUT_17_LAYERS, 5u,
+  },
+  {
+    "bo-tibetan-prc---updated",
+    "Tibetan (PRC) - Updated",
+    LAYOUT_18_LAYERS, 6u,
+  },
+  {
+    "bo-tibetan-prc",
+    "Tibetan (PRC)",
+    LAYOUT_19_LAYERS, 6u,
+  },
+  {
+    "bs-bosnian-cyrillic",
+    "Bosnian (Cyrillic)",
+    LAYOUT_20_LAYERS, 5u,
+  },
+  {
+    "bug-buginese",
+    "Buginese",
+    LAYOUT_21_LAYERS, 3u,
+  },
+  {
+    "chr-cherokee-nation",
+    "Cherokee Nation",
+    LAYOUT_22_LAYERS, 5u,
+  },
+  {
+    "chr-cherokee-phonetic",
+    "Cherokee Phonetic",
+    LAYOUT_23_LAYERS, 4u,
+  },
+  {
+    "ckb-central-kurdish",
+    "Central Kurdish",
+    LAYOUT_24_LAYERS, 3u,
+  },
+  {
+    "cs-czech-programmers",
+    "Czech Programmers",
+    LAYOUT_25_LAYERS, 6u,
+  },
+  {
+    "cs-czech-qwerty",
+    "Czech (QWERTY)",
+    LAYOUT_26_LAYERS, 6u,
+  },
+  {
+    "cs-czech",
+    "Czech",
+    LAYOUT_27_LAYERS, 5u,
+  },
+  {
+    "da-danish",
+    "Danish",
+    LAYOUT_28_LAYERS, 5u,
+  },
+  {
+    "de-DE-qwertz",
+    "German (Germany)",
+    LAYOUT_29_LAYERS, 5u,
+  },
+  {
+    "de-german-extended-e1",
+    "German Extended (E1)",
+    LAYOUT_30_LAYERS, 6u,
+  },
+  {
+    "de-german-extended-e2",
+    "German Extended (E2)",
+    LAYOUT_31_LAYERS, 6u,
+  },
+  {
+    "de-german-ibm",
+    "German (IBM)",
+    LAYOUT_32_LAYERS, 6u,
+  },
+  {
+    "de-german",
+    "German",
+    LAYOUT_33_LAYERS, 6u,
+  },
+  {
+    "de-swiss-german",
+    "Swiss German",
+    LAYOUT_34_LAYERS, 5u,
+  },
+  {
+    "dv-divehi-phonetic",
+    "Divehi Phonetic",
+    LAYOUT_35_LAYERS, 4u,
+  },
+  {
+    "dv-divehi-typewriter",
+    "Divehi Typewriter",
+    LAYOUT_36_LAYERS, 4u,
+  },
+  {
+    "dz-dzongkha",
+    "Dzongkha",
+    LAYOUT_37_LAYERS, 5u,
+  },
+  {
+    "el-greek-220-latin",
+    "Greek (220) Latin",
+    LAYOUT_38_LAYERS, 5u,
+  },
+  {
+    "el-greek-220",
+    "Greek (220)",
+    LAYOUT_39_LAYERS, 5u,
+  },
+  {
+    "el-greek-319-latin",
+    "Greek (319) Latin",
+    LAYOUT_40_LAYERS, 5u,
+  },
+  {
+    "el-greek-319",
+    "Greek (319)",
+    LAYOUT_41_LAYERS, 5u,
+  },
+  {
+    "el-greek-latin",
+    "Greek Latin",
+    LAYOUT_42_LAYERS, 6u,
+  },
+  {
+    "el-greek-polytonic",
+    "Greek Polytonic",
+    LAYOUT_43_LAYERS, 6u,
+  },
+  {
+    "el-greek",
+    "Greek",
+    LAYOUT_44_LAYERS, 5u,
+  },
+  {
+    "en-GB-qwerty",
+    "en-GB-qwerty",
+    LAYOUT_45_LAYERS, 5u,
+  },
+  {
+    "en-english-india",
+    "English (India)",
+    LAYOUT_46_LAYERS, 6u,
+  },
+  {
+    "en-united-kingdom",
+    "United Kingdom",
+    LAYOUT_47_LAYERS, 6u,
+  },
+  {
+    "en-united-states-dvorak",
+    "United States-Dvorak",
+    LAYOUT_48_LAYERS, 4u,
+  },
+  {
+    "en-united-states-international",
+    "United States-International",
+    LAYOUT_49_LAYERS, 6u,
+  },
+  {
+    "en-us-english-table-for-ibm-arabic-238l",
+    "US English Table for IBM Arabic 238_L",
+    LAYOUT_50_LAYERS, 4u,
+  },
+  {
+    "en-us",
+    "US",
+    LAYOUT_51_LAYERS, 4u,
+  },
+  {
+    "es-latin-american",
+    "Latin American",
+    LAYOUT_52_LAYERS, 5u,
+  },
+  {
+    "es-spanish-variation",
+    "Spanish Variation",
+    LAYOUT_53_LAYERS, 5u,
+  },
+  {
+    "es-spanish",
+    "Spanish",
+    LAYOUT_54_LAYERS, 5u,
+  },
+  {
+    "et-estonian",
+    "Estonian",
+    LAYOUT_55_LAYERS, 6u,
+  },
+  {
+    "fa-persian-standard",
+    "Persian (Standard)",
+    LAYOUT_56_LAYERS, 3u,
+  },
+  {
+    "fa-persian",
+    "Persian",
+    LAYOUT_57_LAYERS, 3u,
+  },
+  {
+    "fi-finnish-with-sami",
+    "Finnish with Sami",
+    LAYOUT_58_LAYERS, 6u,
+  },
+  {
+    "fi-finnish",
+    "Finnish",
+    LAYOUT_59_LAYERS, 5u,
+  },
+  {
+    "fo-faeroese",
+    "Faeroese",
+    LAYOUT_60_LAYERS, 5u,
+  },
+  {
+    "fr-belgian-french",
+    "Belgian French",
+    LAYOUT_61_LAYERS, 6u,
+  },
+  {
+    "fr-canadian-french-legacy",
+    "Canadian French (Legacy)",
+    LAYOUT_62_LAYERS, 6u,
+  },
+  {
+    "fr-canadian-french",
+    "Canadian French",
+    LAYOUT_63_LAYERS, 5u,
+  },
+  {
+    "fr-french-legacy-azerty",
+    "French (Legacy, AZERTY)",
+    LAYOUT_64_LAYERS, 5u,
+  },
+  {
+    "fr-french-standard-azerty",
+    "French (Standard, AZERTY)",
+    LAYOUT_65_LAYERS, 6u,
+  },
+  {
+    "fr-french-standard-bpo",
+    "French (Standard, BÉPO)",
+    LAYOUT_66_LAYERS, 6u,
+  },
+  {
+    "fr-swiss-french",
+    "Swiss French",
+    LAYOUT_67_LAYERS, 5u,
+  },
+  {
+    "ga-irish",
+    "Irish",
+    LAYOUT_68_LAYERS, 6u,
+  },
+  {
+    "gd-scottish-gaelic",
+    "Scottish Gaelic",
+    LAYOUT_69_LAYERS, 6u,
+  },
+  {
+    "gn-guarani",
+    "Guarani",
+    LAYOUT_70_LAYERS, 6u,
+  },
+  {
+    "gu-gujarati",
+    "Gujarati",
+    LAYOUT_71_LAYERS, 5u,
+  },
+  {
+    "ha-hausa",
+    "Hausa",
+    LAYOUT_72_LAYERS, 6u,
+  },
+  {
+    "haw-hawaiian",
+    "Hawaiian",
+    LAYOUT_73_LAYERS, 6u,
+  },
+  {
+    "he-hebrew-standard-2018",
+    "Hebrew (Standard, 2018)",
+    LAYOUT_74_LAYERS, 6u,
+  },
+  {
+    "he-hebrew-standard",
+    "Hebrew (Standard)",
+    LAYOUT_75_LAYERS, 6u,
+  },
+  {
+    "he-hebrew",
+    "Hebrew",
+    LAYOUT_76_LAYERS, 5u,
+  },
+  {
+    "hi-hindi-traditional",
+    "Hindi Traditional",
+    LAYOUT_77_LAYERS, 5u,
+  },
+  {
+    "hu-hungarian-101-key",
+    "Hungarian 101-key",
+    LAYOUT_78_LAYERS, 5u,
+  },
+  {
+    "hu-hungarian",
+    "Hungarian",
+    LAYOUT_79_LAYERS, 5u,
+  },
+  {
+    "hy-armenian-eastern-legacy",
+    "Armenian Eastern (Legacy)",
+    LAYOUT_80_LAYERS, 4u,
+  },
+  {
+    "hy-armenian-phonetic",
+    "Armenian Phonetic",
+    LAYOUT_81_LAYERS, 6u,
+  },
+  {
+    "hy-armenian-typewriter",
+    "Armenian Typewriter",
+    LAYOUT_82_LAYERS, 6u,
+  },
+  {
+    "hy-armenian-western-legacy",
+    "Armenian Western (Legacy)",
+    LAYOUT_83_LAYERS, 4u,
+  },
+  {
+    "ig-igbo",
+    "Igbo",
+    LAYOUT_84_LAYERS, 6u,
+  },
+  {
+    "is-icelandic",
+    "Icelandic",
+    LAYOUT_85_LAYERS, 5u,
+  },
+  {
+    "it-italian-142",
+    "Italian (142)",
+    LAYOUT_86_LAYERS, 5u,
+  },
+  {
+    "it-italian",
+    "Italian",
+    LAYOUT_87_LAYERS, 6u,
+  },
+  {
+    "iu-inuktitut---latin",
+    "Inuktitut - Latin",
+    LAYOUT_88_LAYERS, 6u,
+  },
+  {
+    "iu-inuktitut---naqittaut",
+    "Inuktitut - Naqittaut",
+    LAYOUT_89_LAYERS, 6u,
+  },
+  {
+    "iu-inuktitut---nattilik",
+    "Inuktitut - Nattilik",
+    LAYOUT_90_LAYERS, 6u,
+  },
+  {
+    "ja-japanese",
+    "Japanese",
+    LAYOUT_91_LAYERS, 4u,
+  },
+  {
+    "jv-javanese",
+    "Javanese",
+    LAYOUT_92_LAYERS, 5u,
+  },
+  {
+    "ka-georgian-ergonomic",
+    "Georgian (Ergonomic)",
+    LAYOUT_93_LAYERS, 5u,
+  },
+  {
+    "ka-georgian-legacy",
+    "Georgian (Legacy)",
+    LAYOUT_94_LAYERS, 4u,
+  },
+  {
+    "ka-georgian-mes",
+    "Georgian (MES)",
+    LAYOUT_95_LAYERS, 4u,
+  },
+  {
+    "ka-georgian-old-alphabets",
+    "Georgian (Old Alphabets)",
+    LAYOUT_96_LAYERS, 6u,
+  },
+  {
+    "ka-georgian-qwerty",
+    "Georgian (QWERTY)",
+    LAYOUT_97_LAYERS, 4u,
+  },
+  {
+    "kk-kazakh",
+    "Kazakh",
+    LAYOUT_98_LAYERS, 4u,
+  },
+  {
+    "kl-greenlandic",
+    "Greenlandic",
+    LAYOUT_99_LAYERS, 6u,
+  },
+  {
+    "km-khmer-nida",
+    "Khmer (NIDA)",
+    LAYOUT_100_LAYERS, 4u,
+  },
+  {
+    "km-khmer",
+    "Khmer",
+    LAYOUT_101_LAYERS, 5u,
+  },
+  {
+    "kn-kannada",
+    "Kannada",
+    LAYOUT_102_LAYERS, 5u,
+  },
+  {
+    "ko-korean",
+    "Korean",
+    LAYOUT_103_LAYERS, 4u,
+  },
+  {
+    "ky-kyrgyz-cyrillic",
+    "Kyrgyz Cyrillic",
+    LAYOUT_104_LAYERS, 6u,
+  },
+  {
+    "lb-luxembourgish",
+    "Luxembourgish",
+    LAYOUT_105_LAYERS, 5u,
+  },
+  {
+    "lis-lisu-basic",
+    "Lisu (Basic)",
+    LAYOUT_106_LAYERS, 3u,
+  },
+  {
+    "lis-lisu-standard",
+    "Lisu (Standard)",
+    LAYOUT_107_LAYERS, 3u,
+  },
+  {
+    "lo-lao",
+    "Lao",
+    LAYOUT_108_LAYERS, 4u,
+  },
+  {
+    "lt-lithuanian-ibm",
+    "Lithuanian IBM",
+    LAYOUT_109_LAYERS, 5u,
+  },
+  {
+    "lt-lithuanian-standard",
+    "Lithuanian Standard",
+    LAYOUT_110_LAYERS, 5u,
+  },
+  {
+    "lt-lithuanian",
+    "Lithuanian",
+    LAYOUT_111_LAYERS, 6u,
+  },
+  {
+    "lv-latvian-qwerty",
+    "Latvian (QWERTY)",
+    LAYOUT_112_LAYERS, 6u,
+  },
+  {
+    "lv-latvian-standard",
+    "Latvian (Standard)",
+    LAYOUT_113_LAYERS, 6u,
+  },
+  {
+    "lv-latvian",
+    "Latvian",
+    LAYOUT_114_LAYERS, 6u,
+  },
+  {
+    "mi-maori",
+    "Maori",
+    LAYOUT_115_LAYERS, 4u,
+  },
+  {
+    "mk-macedonian---standard",
+    "Macedonian - Standard",
+    LAYOUT_116_LAYERS, 5u,
+  },
+  {
+    "mk-macedonian",
+    "Macedonian",
+    LAYOUT_117_LAYERS, 5u,
+  },
+  {
+    "ml-malayalam",
+    "Malayalam",
+    LAYOUT_118_LAYERS, 5u,
+  },
+  {
+    "mn-mongolian-cyrillic",
+    "Mongolian Cyrillic",
+    LAYOUT_119_LAYERS, 4u,
+  },
+  {
+    "mn-mongolian-mongolian-script",
+    "Mongolian (Mongolian Script)",
+    LAYOUT_120_LAYERS, 4u,
+  },
+  {
+    "mn-traditional-mongolian-mns",
+    "Traditional Mongolian (MNS)",
+    LAYOUT_121_LAYERS, 4u,
+  },
+  {
+    "mn-traditional-mongolian-standard",
+    "Traditional Mongolian (Standard)",
+    LAYOUT_122_LAYERS, 3u,
+  },
+  {
+    "mo-romanian-legacy",
+    "Romanian (Legacy)",
+    LAYOUT_123_LAYERS, 5u,
+  },
+  {
+    "mo-romanian-programmers",
+    "Romanian (Programmers)",
+    LAYOUT_124_LAYERS, 6u,
+  },
+  {
+    "mo-romanian-standard",
+    "Romanian (Standard)",
+    LAYOUT_125_LAYERS, 6u,
+  },
+  {
+    "mr-marathi",
+    "Marathi",
+    LAYOUT_126_LAYERS, 5u,
+  },
+  {
+    "mt-maltese-47-key",
+    "Maltese 47-Key",
+    LAYOUT_127_LAYERS, 6u,
+  },
+  {
+    "mt-maltese-48-key",
+    "Maltese 48-Key",
+    LAYOUT_128_LAYERS, 6u,
+  },
+  {
+    "my-myanmar-phonetic-order",
+    "Myanmar (Phonetic order)",
+    LAYOUT_129_LAYERS, 5u,
+  },
+  {
+    "my-myanmar-visual-order",
+    "Myanmar (Visual order)",
+    LAYOUT_130_LAYERS, 5u,
+  },
+  {
+    "ne-nepali",
+    "Nepali",
+    LAYOUT_131_LAYERS, 5u,
+  },
+  {
+    "nl-dutch",
+    "Dutch",
+    LAYOUT_132_LAYERS, 5u,
+  },
+  {
+    "no-norwegian-with-sami",
+    "Norwegian with Sami",
+    LAYOUT_133_LAYERS, 6u,
+  },
+  {
+    "no-norwegian",
+    "Norwegian",
+    LAYOUT_134_LAYERS, 5u,
+  },
+  {
+    "nqo-nko",
+    "N’Ko",
+    LAYOUT_135_LAYERS, 3u,
+  },
+  {
+    "nso-sesotho-sa-leboa",
+    "Sesotho sa Leboa",
+    LAYOUT_136_LAYERS, 6u,
+  },
+  {
+    "or-odia",
+    "Odia",
+    LAYOUT_137_LAYERS, 5u,
+  },
+  {
+    "osa-osage",
+    "Osage",
+    LAYOUT_138_LAYERS, 6u,
+  },
+  {
+    "pa-punjabi",
+    "Punjabi",
+    LAYOUT_139_LAYERS, 5u,
+  },
+  {
+    "pl-polish-214",
+    "Polish (214)",
+    LAYOUT_140_LAYERS, 5u,
+  },
+  {
+    "pl-polish-programmers",
+    "Polish (Programmers)",
+    LAYOUT_141_LAYERS, 6u,
+  },
+  {
+    "ps-pashto-afghanistan",
+    "Pashto (Afghanistan)",
+    LAYOUT_142_LAYERS, 4u,
+  },
+  {
+    "pt-portuguese-brazil-abnt",
+    "Portuguese (Brazil ABNT)",
+    LAYOUT_143_LAYERS, 5u,
+  },
+  {
+    "pt-portuguese-brazil-abnt2",
+    "Portuguese (Brazil ABNT2)",
+    LAYOUT_144_LAYERS, 5u,
+  },
+  {
+    "pt-portuguese",
+    "Portuguese",
+    LAYOUT_145_LAYERS, 5u,
+  },
+  {
+    "ro-romanian-legacy",
+    "Romanian (Legacy)",
+    LAYOUT_146_LAYERS, 5u,
+  },
+  {
+    "ro-romanian-programmers",
+    "Romanian (Programmers)",
+    LAYOUT_147_LAYERS, 6u,
+  },
+  {
+    "ro-romanian-standard",
+    "Romanian (Standard)",
+    LAYOUT_148_LAYERS, 6u,
+  },
+  {
+    "ru-russian---mnemonic",
+    "Russian - Mnemonic",
+    LAYOUT_149_LAYERS, 5u,
+  },
+  {
+    "ru-russian-typewriter",
+    "Russian (Typewriter)",
+    LAYOUT_150_LAYERS, 5u,
+  },
+  {
+    "ru-russian",
+    "Russian",
+    LAYOUT_151_LAYERS, 5u,
+  },
+  {
+    "sah-sakha",
+    "Sakha",
+    LAYOUT_152_LAYERS, 5u,
+  },
+  {
+    "sh-serbian-cyrillic",
+    "Serbian (Cyrillic)",
+    LAYOUT_153_LAYERS, 5u,
+  },
+  {
+    "sh-serbian-latin",
+    "Serbian (Latin)",
+    LAYOUT_154_LAYERS, 5u,
+  },
+  {
+    "si-sinhala---wij-9",
+    "Sinhala - Wij 9",
+    LAYOUT_155_LAYERS, 6u,
+  },
+  {
+    "si-sinhala",
+    "Sinhala",
+    LAYOUT_156_LAYERS, 4u,
+  },
+  {
+    "sk-slovak-qwerty",
+    "Slovak (QWERTY)",
+    LAYOUT_157_LAYERS, 5u,
+  },
+  {
+    "sk-slovak",
+    "Slovak",
+    LAYOUT_158_LAYERS, 5u,
+  },
+  {
+    "sl-slovenian",
+    "Slovenian",
+    LAYOUT_159_LAYERS, 5u,
+  },
+  {
+    "sq-albanian",
+    "Albanian",
+    LAYOUT_160_LAYERS, 5u,
+  },
+  {
+    "sr-serbian-cyrillic",
+    "Serbian (Cyrillic)",
+    LAYOUT_161_LAYERS, 5u,
+  },
+  {
+    "sr-serbian-latin",
+    "Serbian (Latin)",
+    LAYOUT_162_LAYERS, 5u,
+  },
+  {
+    "sv-swedish-with-sami",
+    "Swedish with Sami",
+    LAYOUT_163_LAYERS, 6u,
+  },
+  {
+    "sv-swedish",
+    "Swedish",
+    LAYOUT_164_LAYERS, 5u,
+  },
+  {
+    "syr-syriac-phonetic",
+    "Syriac Phonetic",
+    LAYOUT_165_LAYERS, 4u,
+  },
+  {
+    "syr-syriac",
+    "Syriac",
+    LAYOUT_166_LAYERS, 4u,
+  },
+  {
+    "ta-tamil-99",
+    "Tamil 99",
+    LAYOUT_167_LAYERS, 3u,
+  },
+  {
+    "ta-tamil-anjal",
+    "Tamil Anjal",
+    LAYOUT_168_LAYERS, 6u,
+  },
+  {
+    "ta-tamil",
+    "Tamil",
+    LAYOUT_169_LAYERS, 5u,
+  },
+  {
+    "te-telugu",
+    "Telugu",
+    LAYOUT_170_LAYERS, 5u,
+  },
+  {
+    "tg-tajik",
+    "Tajik",
+    LAYOUT_171_LAYERS, 4u,
+  },
+  {
+    "th-thai-kedmanee-non-shiftlock",
+    "Thai Kedmanee (non-ShiftLock)",
+    LAYOUT_172_LAYERS, 3u,
+  },
+  {
+    "th-thai-kedmanee",
+    "Thai Kedmanee",
+    LAYOUT_173_LAYERS, 4u,
+  },
+  {
+    "th-thai-pattachote-non-shiftlock",
+    "Thai Pattachote (non-ShiftLock)",
+    LAYOUT_174_LAYERS, 3u,
+  },
+  {
+    "th-thai-pattachote",
+    "Thai Pattachote",
+    LAYOUT_175_LAYERS, 4u,
+  },
+  {
+    "tk-turkmen",
+    "Turkmen",
+    LAYOUT_176_LAYERS, 5u,
+  },
+  {
+    "tn-setswana",
+    "Setswana",
+    LAYOUT_177_LAYERS, 6u,
+  },
+  {
+    "tr-turkish-f",
+    "Turkish F",
+    LAYOUT_178_LAYERS, 6u,
+  },
+  {
+    "tr-turkish-q",
+    "Turkish Q",
+    LAYOUT_179_LAYERS, 6u,
+  },
+  {
+    "tt-tatar-legacy",
+    "Tatar (Legacy)",
+    LAYOUT_180_LAYERS, 6u,
+  },
+  {
+    "tt-tatar",
+    "Tatar",
+    LAYOUT_181_LAYERS, 6u,
+  },
+  {
+    "tzm-central-atlas-tamazight",
+    "Central Atlas Tamazight",
+    LAYOUT_182_LAYERS, 5u,
+  },
+  {
+    "ug-uyghur-legacy",
+    "Uyghur (Legacy)",
+    LAYOUT_183_LAYERS, 3u,
+  },
+  {
+    "ug-uyghur",
+    "Uyghur",
+    LAYOUT_184_LAYERS, 3u,
+  },
+  {
+    "uk-ukrainian-enhanced",
+    "Ukrainian (Enhanced)",
+    LAYOUT_185_LAYERS, 6u,
+  },
+  {
+    "uk-ukrainian",
+    "Ukrainian",
+    LAYOUT_186_LAYERS, 6u,
+  },
+  {
+    "ur-urdu",
+    "Urdu",
+    LAYOUT_187_LAYERS, 3u,
+  },
+  {
+    "uz-uzbek-cyrillic",
+    "Uzbek Cyrillic",
+    LAYOUT_188_LAYERS, 4u,
+  },
+  {
+    "vi-vietnamese",
+    "Vietnamese",
+    LAYOUT_189_LAYERS, 6u,
+  },
+  {
+    "wo-wolof",
+    "Wolof",
+    LAYOUT_190_LAYERS, 5u,
+  },
+  {
+    "yo-yoruba",
+    "Yoruba",
+    LAYOUT_191_LAYERS, 6u,
+  },
+  {
+    "zh-chinese-simplified---us",
+    "Chinese (Simplified) - US",
+    LAYOUT_192_LAYERS, 4u,
+  },
+  {
+    "zh-chinese-simplified-singapore---us",
+    "Chinese (Simplified, Singapore) - US",
+    LAYOUT_193_LAYERS, 4u,
+  },
+  {
+    "zh-chinese-traditional---us",
+    "Chinese (Traditional) - US",
+    LAYOUT_194_LAYERS, 4u,
+  },
+  {
+    "zh-chinese-traditional-hong-kong-sar---us",
+    "Chinese (Traditional, Hong Kong S.A.R.) - US",
+    LAYOUT_195_LAYERS, 4u,
+  },
+  {
+    "zh-chinese-traditional-macao-sar---us",
+    "Chinese (Traditional, Macao S.A.R.) - US",
+    LAYOUT_196_LAYERS, 4u,
+  },
+};
+
@@ -0,0 +1,2295 @@
+#include "worldalphabets_data.h"
+
+const char *WA_LANGUAGE_CODES[] = {
+  "aa",
+  "ab",
+  "ady",
+  "af",
+  "agq",
+  "ak",
+  "am",
+  "an",
+  "ar",
+  "arn",
+  "as",
+  "asa",
+  "ast",
+  "ay",
+  "az",
+  "ba",
+  "bal",
+  "ban",
+  "bas",
+  "bax",
+  "be",
+  "bem",
+  "bew",
+  "bez",
+  "bg",
+  "bgc",
+  "bgn",
+  "bho",
+  "bku",
+  "bm",
+  "bn",
+  "bo",
+  "br",
+  "brx",
+  "bs",
+  "bss",
+  "bug",
+  "bya",
+  "byn",
+  "ca",
+  "cad",
+  "ccp",
+  "ce",
+  "ceb",
+  "cgg",
+  "cho",
+  "chr",
+  "cic",
+  "ckb",
+  "co",
+  "cop",
+  "cs",
+  "csw",
+  "cu",
+  "cv",
+  "cy",
+  "da",
+  "dav",
+  "de",
+  "dje",
+  "dsb",
+  "dua",
+  "dv",
+  "dyo",
+  "dz",
+  "ebu",
+  "ee",
+  "el",
+  "en",
+  "eo",
+  "es",
+  "et",
+  "eu",
+  "ewo",
+  "fa",
+  "ff",
+  "fi",
+  "fo",
+  "fr",
+  "frr",
+  "fur",
+  "fy",
+  "ga",
+  "gaa",
+  "gd",
+  "gez",
+  "gl",
+  "gn",
+  "gsw",
+  "gu",
+  "guz",
+  "gv",
+  "ha",
+  "haw",
+  "he",
+  "hi",
+  "hnn",
+  "hr",
+  "hsb",
+  "ht",
+  "hu",
+  "hy",
+  "ia",
+  "id",
+  "ie",
+  "ig",
+  "ii",
+  "io",
+  "is",
+  "it",
+  "iu",
+  "ja",
+  "jbo",
+  "jgo",
+  "jv",
+  "ka",
+  "kaa",
+  "kab",
+  "kam",
+  "kde",
+  "kea",
+  "ken",
+  "kgp",
+  "khq",
+  "ki",
+  "kk",
+  "kkj",
+  "kl",
+  "km",
+  "kn",
+  "ko",
+  "kok",
+  "kpe",
+  "ks",
+  "ksb",
+  "ksf",
+  "ksh",
+  "ku",
+  "kw",
+  "kxv",
+  "ky",
+  "la",
+  "lag",
+  "lb",
+  "lep",
+  "lg",
+  "lif",
+  "lij",
+  "lis",
+  "lkt",
+  "lld",
+  "lmo",
+  "ln",
+  "lo",
+  "lrc",
+  "lt",
+  "ltg",
+  "lu",
+  "luo",
+  "luy",
+  "lv",
+  "lzh",
+  "mai",
+  "mas",
+  "mdf",
+  "meh",
+  "mel",
+  "mer",
+  "mfe",
+  "mg",
+  "mgh",
+  "mgo",
+  "mhn",
+  "mi",
+  "mic",
+  "mid",
+  "mk",
+  "ml",
+  "mmc",
+  "mn",
+  "mni",
+  "mo",
+  "moh",
+  "mr",
+  "ms",
+  "msi",
+  "mt",
+  "mua",
+  "mus",
+  "my",
+  "myv",
+  "mzn",
+  "naq",
+  "nb",
+  "nd",
+  "nds",
+  "ne",
+  "nl",
+  "nmg",
+  "nn",
+  "nnh",
+  "no",
+  "nqo",
+  "nr",
+  "nso",
+  "nus",
+  "nv",
+  "ny",
+  "nyn",
+  "oc",
+  "om",
+  "or",
+  "os",
+  "osa",
+  "pa",
+  "pap",
+  "pcm",
+  "pis",
+  "pl",
+  "prg",
+  "ps",
+  "pt",
+  "qu",
+  "quc",
+  "raj",
+  "rej",
+  "rhg",
+  "rm",
+  "rn",
+  "ro",
+  "ru",
+  "ruc",
+  "rw",
+  "rwk",
+  "sa",
+  "sah",
+  "sam",
+  "saq",
+  "sat",
+  "saz",
+  "sbp",
+  "sc",
+  "scn",
+  "sd",
+  "sdh",
+  "se",
+  "seh",
+  "ses",
+  "sg",
+  "sh",
+  "shi",
+  "si",
+  "sk",
+  "sl",
+  "sma",
+  "smj",
+  "smn",
+  "sms",
+  "sn",
+  "so",
+  "sq",
+  "sr",
+  "ss",
+  "ssy",
+  "st",
+  "su",
+  "sv",
+  "sw",
+  "syr",
+  "szl",
+  "ta",
+  "tbw",
+  "te",
+  "teo",
+  "tg",
+  "th",
+  "ti",
+  "tig",
+  "tk",
+  "tl",
+  "tn",
+  "to",
+  "tob",
+  "tok",
+  "top",
+  "tpi",
+  "tr",
+  "ts",
+  "tt",
+  "ttj",
+  "twq",
+  "tyv",
+  "tzm",
+  "ug",
+  "uk",
+  "ukv",
+  "ur",
+  "uz",
+  "vai",
+  "ve",
+  "vec",
+  "vi",
+  "vmw",
+  "vo",
+  "vun",
+  "wa",
+  "wae",
+  "wbp",
+  "wo",
+  "xh",
+  "xkl",
+  "xnr",
+  "xog",
+  "yav",
+  "yi",
+  "yo",
+  "yrl",
+  "za",
+  "zh",
+  "zra",
+  "zu",
+};
+
+static const char *WA_SCRIPTS_aa[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_ab[] = {
+  "Cyrl",
+};
+
+static const char *WA_SCRIPTS_ady[] = {
+  "Cyrl",
+};
+
+static const char *WA_SCRIPTS_af[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_agq[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_ak[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_am[] = {
+  "Ethi",
+};
+
+static const char *WA_SCRIPTS_an[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_ar[] = {
+  "Arab",
+};
+
+static const char *WA_SCRIPTS_arn[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_as[] = {
+  "Beng",
+};
+
+static const char *WA_SCRIPTS_asa[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_ast[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_ay[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_az[] = {
+  "Cyrl",
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_ba[] = {
+  "Cyrl",
+};
+
+static const char *WA_SCRIPTS_bal[] = {
+  "Arab",
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_ban[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_bas[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_bax[] = {
+  "Bamu",
+};
+
+static const char *WA_SCRIPTS_be[] = {
+  "Cyrl",
+  "x-old",
+};
+
+static const char *WA_SCRIPTS_bem[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_bew[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_bez[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_bg[] = {
+  "Cyrl",
+};
+
+static const char *WA_SCRIPTS_bgc[] = {
+  "Deva",
+};
+
+static const char *WA_SCRIPTS_bgn[] = {
+  "Arab",
+};
+
+static const char *WA_SCRIPTS_bho[] = {
+  "Deva",
+};
+
+static const char *WA_SCRIPTS_bku[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_bm[] = {
+  "Latn",
+  "Nkoo",
+};
+
+static const char *WA_SCRIPTS_bn[] = {
+  "Beng",
+};
+
+static const char *WA_SCRIPTS_bo[] = {
+  "Tibt",
+};
+
+static const char *WA_SCRIPTS_br[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_brx[] = {
+  "Deva",
+};
+
+static const char *WA_SCRIPTS_bs[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_bss[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_bug[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_bya[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_byn[] = {
+  "Ethi",
+};
+
+static const char *WA_SCRIPTS_ca[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_cad[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_ccp[] = {
+  "Cakm",
+};
+
+static const char *WA_SCRIPTS_ce[] = {
+  "Cyrl",
+};
+
+static const char *WA_SCRIPTS_ceb[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_cgg[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_cho[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_chr[] = {
+  "Cher",
+};
+
+static const char *WA_SCRIPTS_cic[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_ckb[] = {
+  "Arab",
+};
+
+static const char *WA_SCRIPTS_co[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_cop[] = {
+  "Copt",
+};
+
+static const char *WA_SCRIPTS_cs[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_csw[] = {
+  "Cans",
+};
+
+static const char *WA_SCRIPTS_cu[] = {
+  "Cyrl",
+};
+
+static const char *WA_SCRIPTS_cv[] = {
+  "Cyrl",
+};
+
+static const char *WA_SCRIPTS_cy[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_da[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_dav[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_de[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_dje[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_dsb[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_dua[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_dv[] = {
+  "Thaa",
+};
+
+static const char *WA_SCRIPTS_dyo[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_dz[] = {
+  "Tibt",
+};
+
+static const char *WA_SCRIPTS_ebu[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_ee[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_el[] = {
+  "Grek",
+};
+
+static const char *WA_SCRIPTS_en[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_eo[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_es[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_et[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_eu[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_ewo[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_fa[] = {
+  "Arab",
+};
+
+static const char *WA_SCRIPTS_ff[] = {
+  "Adlm",
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_fi[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_fo[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_fr[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_frr[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_fur[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_fy[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_ga[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_gaa[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_gd[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_gez[] = {
+  "Ethi",
+};
+
+static const char *WA_SCRIPTS_gl[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_gn[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_gsw[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_gu[] = {
+  "Gujr",
+};
+
+static const char *WA_SCRIPTS_guz[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_gv[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_ha[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_haw[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_he[] = {
+  "Hebr",
+};
+
+static const char *WA_SCRIPTS_hi[] = {
+  "Deva",
+};
+
+static const char *WA_SCRIPTS_hnn[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_hr[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_hsb[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_ht[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_hu[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_hy[] = {
+  "Armn",
+};
+
+static const char *WA_SCRIPTS_ia[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_id[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_ie[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_ig[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_ii[] = {
+  "Yiii",
+};
+
+static const char *WA_SCRIPTS_io[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_is[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_it[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_iu[] = {
+  "Cans",
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_ja[] = {
+  "Hira",
+  "Jpan",
+  "Kana",
+};
+
+static const char *WA_SCRIPTS_jbo[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_jgo[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_jv[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_ka[] = {
+  "Geor",
+};
+
+static const char *WA_SCRIPTS_kaa[] = {
+  "Cyrl",
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_kab[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_kam[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_kde[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_kea[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_ken[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_kgp[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_khq[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_ki[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_kk[] = {
+  "Cyrl",
+};
+
+static const char *WA_SCRIPTS_kkj[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_kl[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_km[] = {
+  "Khmr",
+};
+
+static const char *WA_SCRIPTS_kn[] = {
+  "Knda",
+};
+
+static const char *WA_SCRIPTS_ko[] = {
+  "Hang",
+  "Kore",
+};
+
+static const char *WA_SCRIPTS_kok[] = {
+  "Deva",
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_kpe[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_ks[] = {
+  "Arab",
+  "Deva",
+};
+
+static const char *WA_SCRIPTS_ksb[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_ksf[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_ksh[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_ku[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_kw[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_kxv[] = {
+  "Orya",
+};
+
+static const char *WA_SCRIPTS_ky[] = {
+  "Cyrl",
+};
+
+static const char *WA_SCRIPTS_la[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_lag[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_lb[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_lep[] = {
+  "Lepc",
+};
+
+static const char *WA_SCRIPTS_lg[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_lif[] = {
+  "Deva",
+};
+
+static const char *WA_SCRIPTS_lij[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_lis[] = {
+  "Lisu",
+};
+
+static const char *WA_SCRIPTS_lkt[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_lld[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_lmo[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_ln[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_lo[] = {
+  "Laoo",
+};
+
+static const char *WA_SCRIPTS_lrc[] = {
+  "Arab",
+};
+
+static const char *WA_SCRIPTS_lt[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_ltg[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_lu[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_luo[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_luy[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_lv[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_lzh[] = {
+  "Hans",
+};
+
+static const char *WA_SCRIPTS_mai[] = {
+  "Deva",
+};
+
+static const char *WA_SCRIPTS_mas[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_mdf[] = {
+  "Cyrl",
+};
+
+static const char *WA_SCRIPTS_meh[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_mel[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_mer[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_mfe[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_mg[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_mgh[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_mgo[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_mhn[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_mi[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_mic[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_mid[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_mk[] = {
+  "Cyrl",
+};
+
+static const char *WA_SCRIPTS_ml[] = {
+  "Mlym",
+};
+
+static const char *WA_SCRIPTS_mmc[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_mn[] = {
+  "Cyrl",
+  "Mong",
+};
+
+static const char *WA_SCRIPTS_mni[] = {
+  "Beng",
+  "Mtei",
+};
+
+static const char *WA_SCRIPTS_mo[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_moh[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_mr[] = {
+  "Deva",
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_ms[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_msi[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_mt[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_mua[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_mus[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_my[] = {
+  "Mymr",
+};
+
+static const char *WA_SCRIPTS_myv[] = {
+  "Cyrl",
+};
+
+static const char *WA_SCRIPTS_mzn[] = {
+  "Arab",
+};
+
+static const char *WA_SCRIPTS_naq[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_nb[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_nd[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_nds[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_ne[] = {
+  "Deva",
+};
+
+static const char *WA_SCRIPTS_nl[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_nmg[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_nn[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_nnh[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_no[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_nqo[] = {
+  "Nkoo",
+};
+
+static const char *WA_SCRIPTS_nr[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_nso[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_nus[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_nv[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_ny[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_nyn[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_oc[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_om[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_or[] = {
+  "Orya",
+};
+
+static const char *WA_SCRIPTS_os[] = {
+  "Cyrl",
+};
+
+static const char *WA_SCRIPTS_osa[] = {
+  "Osge",
+};
+
+static const char *WA_SCRIPTS_pa[] = {
+  "Guru",
+};
+
+static const char *WA_SCRIPTS_pap[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_pcm[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_pis[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_pl[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_prg[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_ps[] = {
+  "Arab",
+};
+
+static const char *WA_SCRIPTS_pt[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_qu[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_quc[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_raj[] = {
+  "Deva",
+};
+
+static const char *WA_SCRIPTS_rej[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_rhg[] = {
+  "Rohg",
+};
+
+static const char *WA_SCRIPTS_rm[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_rn[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_ro[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_ru[] = {
+  "Cyrl",
+};
+
+static const char *WA_SCRIPTS_ruc[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_rw[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_rwk[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_sa[] = {
+  "Deva",
+};
+
+static const char *WA_SCRIPTS_sah[] = {
+  "Cyrl",
+};
+
+static const char *WA_SCRIPTS_sam[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_saq[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_sat[] = {
+  "Deva",
+  "Olck",
+};
+
+static const char *WA_SCRIPTS_saz[] = {
+  "Saur",
+};
+
+static const char *WA_SCRIPTS_sbp[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_sc[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_scn[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_sd[] = {
+  "Arab",
+};
+
+static const char *WA_SCRIPTS_sdh[] = {
+  "Arab",
+};
+
+static const char *WA_SCRIPTS_se[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_seh[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_ses[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_sg[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_sh[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_shi[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_si[] = {
+  "Sinh",
+};
+
+static const char *WA_SCRIPTS_sk[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_sl[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_sma[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_smj[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_smn[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_sms[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_sn[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_so[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_sq[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_sr[] = {
+  "Cyrl",
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_ss[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_ssy[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_st[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_su[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_sv[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_sw[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_syr[] = {
+  "Syrc",
+};
+
+static const char *WA_SCRIPTS_szl[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_ta[] = {
+  "Taml",
+};
+
+static const char *WA_SCRIPTS_tbw[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_te[] = {
+  "Telu",
+};
+
+static const char *WA_SCRIPTS_teo[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_tg[] = {
+  "Cyrl",
+};
+
+static const char *WA_SCRIPTS_th[] = {
+  "Thai",
+};
+
+static const char *WA_SCRIPTS_ti[] = {
+  "Ethi",
+};
+
+static const char *WA_SCRIPTS_tig[] = {
+  "Ethi",
+};
+
+static const char *WA_SCRIPTS_tk[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_tl[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_tn[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_to[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_tob[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_tok[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_top[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_tpi[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_tr[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_ts[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_tt[] = {
+  "Cyrl",
+};
+
+static const char *WA_SCRIPTS_ttj[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_twq[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_tyv[] = {
+  "Cyrl",
+};
+
+static const char *WA_SCRIPTS_tzm[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_ug[] = {
+  "Arab",
+};
+
+static const char *WA_SCRIPTS_uk[] = {
+  "Cyrl",
+};
+
+static const char *WA_SCRIPTS_ukv[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_ur[] = {
+  "Arab",
+};
+
+static const char *WA_SCRIPTS_uz[] = {
+  "Cyrl",
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_vai[] = {
+  "Vaii",
+};
+
+static const char *WA_SCRIPTS_ve[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_vec[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_vi[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_vmw[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_vo[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_vun[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_wa[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_wae[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_wbp[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_wo[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_xh[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_xkl[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_xnr[] = {
+  "Deva",
+};
+
+static const char *WA_SCRIPTS_xog[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_yav[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_yi[] = {
+  "Hebr",
+};
+
+static const char *WA_SCRIPTS_yo[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_yrl[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_za[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_zh[] = {
+  "Hans",
+  "Hant",
+  "min-nan-Hans",
+  "yue-Hant",
+};
+
+static const char *WA_SCRIPTS_zra[] = {
+  "Latn",
+};
+
+static const char *WA_SCRIPTS_zu[] = {
+  "Latn",
+};
+
+const wa_script_entry WA_SCRIPT_ENTRIES[] = {
+  { "aa", WA_SCRIPTS_aa, 1u },
+  { "ab", WA_SCRIPTS_ab, 1u },
+  { "ady", WA_SCRIPTS_ady, 1u },
+  { "af", WA_SCRIPTS_af, 1u },
+  { "agq", WA_SCRIPTS_agq, 1u },
+  { "ak", WA_SCRIPTS_ak, 1u },
+  { "am", WA_SCRIPTS_am, 1u },
+  { "an", WA_SCRIPTS_an, 1u },
+  { "ar", WA_SCRIPTS_ar, 1u },
+  { "arn", WA_SCRIPTS_arn, 1u },
+  { "as", WA_SCRIPTS_as, 1u },
+  { "asa", WA_SCRIPTS_asa, 1u },
+  { "ast", WA_SCRIPTS_ast, 1u },
+  { "ay", WA_SCRIPTS_ay, 1u },
+  { "az", WA_SCRIPTS_az, 2u },
+  { "ba", WA_SCRIPTS_ba, 1u },
+  { "bal", WA_SCRIPTS_bal, 2u },
+  { "ban", WA_SCRIPTS_ban, 1u },
+  { "bas", WA_SCRIPTS_bas, 1u },
+  { "bax", WA_SCRIPTS_bax, 1u },
+  { "be", WA_SCRIPTS_be, 2u },
+  { "bem", WA_SCRIPTS_bem, 1u },
+  { "bew", WA_SCRIPTS_bew, 1u },
+  { "bez", WA_SCRIPTS_bez, 1u },
+  { "bg", WA_SCRIPTS_bg, 1u },
+  { "bgc", WA_SCRIPTS_bgc, 1u },
+  { "bgn", WA_SCRIPTS_bgn, 1u },
+  { "bho", WA_SCRIPTS_bho, 1u },
+  { "bku", WA_SCRIPTS_bku, 1u },
+  { "bm", WA_SCRIPTS_bm, 2u },
+  { "bn", WA_SCRIPTS_bn, 1u },
+  { "bo", WA_SCRIPTS_bo, 1u },
+  { "br", WA_SCRIPTS_br, 1u },
+  { "brx", WA_SCRIPTS_brx, 1u },
+  { "bs", WA_SCRIPTS_bs, 1u },
+  { "bss", WA_SCRIPTS_bss, 1u },
+  { "bug", WA_SCRIPTS_bug, 1u },
+  { "bya", WA_SCRIPTS_bya, 1u },
+  { "byn", WA_SCRIPTS_byn, 1u },
+  { "ca", WA_SCRIPTS_ca, 1u },
+  { "cad", WA_SCRIPTS_cad, 1u },
+  { "ccp", WA_SCRIPTS_ccp, 1u },
+  { "ce", WA_SCRIPTS_ce, 1u },
+  { "ceb", WA_SCRIPTS_ceb, 1u },
+  { "cgg", WA_SCRIPTS_cgg, 1u },
+  { "cho", WA_SCRIPTS_cho, 1u },
+  { "chr", WA_SCRIPTS_chr, 1u },
+  { "cic", WA_SCRIPTS_cic, 1u },
+  { "ckb", WA_SCRIPTS_ckb, 1u },
+  { "co", WA_SCRIPTS_co, 1u },
+  { "cop", WA_SCRIPTS_cop, 1u },
+  { "cs", WA_SCRIPTS_cs, 1u },
+  { "csw", WA_SCRIPTS_csw, 1u },
+  { "cu", WA_SCRIPTS_cu, 1u },
+  { "cv", WA_SCRIPTS_cv, 1u },
+  { "cy", WA_SCRIPTS_cy, 1u },
+  { "da", WA_SCRIPTS_da, 1u },
+  { "dav", WA_SCRIPTS_dav, 1u },
+  { "de", WA_SCRIPTS_de, 1u },
+  { "dje", WA_SCRIPTS_dje, 1u },
+  { "dsb", WA_SCRIPTS_dsb, 1u },
+  { "dua", WA_SCRIPTS_dua, 1u },
+  { "dv", WA_SCRIPTS_dv, 1u },
+  { "dyo", WA_SCRIPTS_dyo, 1u },
+  { "dz", WA_SCRIPTS_dz, 1u },
+  { "ebu", WA_SCRIPTS_ebu, 1u },
+  { "ee", WA_SCRIPTS_ee, 1u },
+  { "el", WA_SCRIPTS_el, 1u },
+  { "en", WA_SCRIPTS_en, 1u },
+  { "eo", WA_SCRIPTS_eo, 1u },
+  { "es", WA_SCRIPTS_es, 1u },
+  { "et", WA_SCRIPTS_et, 1u },
+  { "eu", WA_SCRIPTS_eu, 1u },
+  { "ewo", WA_SCRIPTS_ewo, 1u },
+  { "fa", WA_SCRIPTS_fa, 1u },
+  { "ff", WA_SCRIPTS_ff, 2u },
+  { "fi", WA_SCRIPTS_fi, 1u },
+  { "fo", WA_SCRIPTS_fo, 1u },
+  { "fr", WA_SCRIPTS_fr, 1u },
+  { "frr", WA_SCRIPTS_frr, 1u },
+  { "fur", WA_SCRIPTS_fur, 1u },
+  { "fy", WA_SCRIPTS_fy, 1u },
+  { "ga", WA_SCRIPTS_ga, 1u },
+  { "gaa", WA_SCRIPTS_gaa, 1u },
+  { "gd", WA_SCRIPTS_gd, 1u },
+  { "gez", WA_SCRIPTS_gez, 1u },
+  { "gl", WA_SCRIPTS_gl, 1u },
+  { "gn", WA_SCRIPTS_gn, 1u },
+  { "gsw", WA_SCRIPTS_gsw, 1u },
+  { "gu", WA_SCRIPTS_gu, 1u },
+  { "guz", WA_SCRIPTS_guz, 1u },
+  { "gv", WA_SCRIPTS_gv, 1u },
+  { "ha", WA_SCRIPTS_ha, 1u },
+  { "haw", WA_SCRIPTS_haw, 1u },
+  { "he", WA_SCRIPTS_he, 1u },
+  { "hi", WA_SCRIPTS_hi, 1u },
+  { "hnn", WA_SCRIPTS_hnn, 1u },
+  { "hr", WA_SCRIPTS_hr, 1u },
+  { "hsb", WA_SCRIPTS_hsb, 1u },
+  { "ht", WA_SCRIPTS_ht, 1u },
+  { "hu", WA_SCRIPTS_hu, 1u },
+  { "hy", WA_SCRIPTS_hy, 1u },
+  { "ia", WA_SCRIPTS_ia, 1u },
+  { "id", WA_SCRIPTS_id, 1u },
+  { "ie", WA_SCRIPTS_ie, 1u },
+  { "ig", WA_SCRIPTS_ig, 1u },
+  { "ii", WA_SCRIPTS_ii, 1u },
+  { "io", WA_SCRIPTS_io, 1u },
+  { "is", WA_SCRIPTS_is, 1u },
+  { "it", WA_SCRIPTS_it, 1u },
+  { "iu", WA_SCRIPTS_iu, 2u },
+  { "ja", WA_SCRIPTS_ja, 3u },
+  { "jbo", WA_SCRIPTS_jbo, 1u },
+  { "jgo", WA_SCRIPTS_jgo, 1u },
+  { "jv", WA_SCRIPTS_jv, 1u },
+  { "ka", WA_SCRIPTS_ka, 1u },
+  { "kaa", WA_SCRIPTS_kaa, 2u },
+  { "kab", WA_SCRIPTS_kab, 1u },
+  { "kam", WA_SCRIPTS_kam, 1u },
+  { "kde", WA_SCRIPTS_kde, 1u },
+  { "kea", WA_SCRIPTS_kea, 1u },
+  { "ken", WA_SCRIPTS_ken, 1u },
+  { "kgp", WA_SCRIPTS_kgp, 1u },
+  { "khq", WA_SCRIPTS_khq, 1u },
+  { "ki", WA_SCRIPTS_ki, 1u },
+  { "kk", WA_SCRIPTS_kk, 1u },
+  { "kkj", WA_SCRIPTS_kkj, 1u },
+  { "kl", WA_SCRIPTS_kl, 1u },
+  { "km", WA_SCRIPTS_km, 1u },
+  { "kn", WA_SCRIPTS_kn, 1u },
+  { "ko", WA_SCRIPTS_ko, 2u },
+  { "kok", WA_SCRIPTS_kok, 2u },
+  { "kpe", WA_SCRIPTS_kpe, 1u },
+  { "ks", WA_SCRIPTS_ks, 2u },
+  { "ksb", WA_SCRIPTS_ksb, 1u },
+  { "ksf", WA_SCRIPTS_ksf, 1u },
+  { "ksh", WA_SCRIPTS_ksh, 1u },
+  { "ku", WA_SCRIPTS_ku, 1u },
+  { "kw", WA_SCRIPTS_kw, 1u },
+  { "kxv", WA_SCRIPTS_kxv, 1u },
+  { "ky", WA_SCRIPTS_ky, 1u },
+  { "la", WA_SCRIPTS_la, 1u },
+  { "lag", WA_SCRIPTS_lag, 1u },
+  { "lb", WA_SCRIPTS_lb, 1u },
+  { "lep", WA_SCRIPTS_lep, 1u },
+  { "lg", WA_SCRIPTS_lg, 1u },
+  { "lif", WA_SCRIPTS_lif, 1u },
+  { "lij", WA_SCRIPTS_lij, 1u },
+  { "lis", WA_SCRIPTS_lis, 1u },
+  { "lkt", WA_SCRIPTS_lkt, 1u },
+  { "lld", WA_SCRIPTS_lld, 1u },
+  { "lmo", WA_SCRIPTS_lmo, 1u },
+  { "ln", WA_SCRIPTS_ln, 1u },
+  { "lo", WA_SCRIPTS_lo, 1u },
+  { "lrc", WA_SCRIPTS_lrc, 1u },
+  { "lt", WA_SCRIPTS_lt, 1u },
+  { "ltg", WA_SCRIPTS_ltg, 1u },
+  { "lu", WA_SCRIPTS_lu, 1u },
+  { "luo", WA_SCRIPTS_luo, 1u },
+  { "luy", WA_SCRIPTS_luy, 1u },
+  { "lv", WA_SCRIPTS_lv, 1u },
+  { "lzh", WA_SCRIPTS_lzh, 1u },
+  { "mai", WA_SCRIPTS_mai, 1u },
+  { "mas", WA_SCRIPTS_mas, 1u },
+  { "mdf", WA_SCRIPTS_mdf, 1u },
+  { "meh", WA_SCRIPTS_meh, 1u },
+  { "mel", WA_SCRIPTS_mel, 1u },
+  { "mer", WA_SCRIPTS_mer, 1u },
+  { "mfe", WA_SCRIPTS_mfe, 1u },
+  { "mg", WA_SCRIPTS_mg, 1u },
+  { "mgh", WA_SCRIPTS_mgh, 1u },
+  { "mgo", WA_SCRIPTS_mgo, 1u },
+  { "mhn", WA_SCRIPTS_mhn, 1u },
+  { "mi", WA_SCRIPTS_mi, 1u },
+  { "mic", WA_SCRIPTS_mic, 1u },
+  { "mid", WA_SCRIPTS_mid, 1u },
+  { "mk", WA_SCRIPTS_mk, 1u },
+  { "ml", WA_SCRIPTS_ml, 1u },
+  { "mmc", WA_SCRIPTS_mmc, 1u },
+  { "mn", WA_SCRIPTS_mn, 2u },
+  { "mni", WA_SCRIPTS_mni, 2u },
+  { "mo", WA_SCRIPTS_mo, 1u },
+  { "moh", WA_SCRIPTS_moh, 1u },
+  { "mr", WA_SCRIPTS_mr, 2u },
+  { "ms", WA_SCRIPTS_ms, 1u },
+  { "msi", WA_SCRIPTS_msi, 1u },
+  { "mt", WA_SCRIPTS_mt, 1u },
+  { "mua", WA_SCRIPTS_mua, 1u },
+  { "mus", WA_SCRIPTS_mus, 1u },
+  { "my", WA_SCRIPTS_my, 1u },
+  { "myv", WA_SCRIPTS_myv, 1u },
+  { "mzn", WA_SCRIPTS_mzn, 1u },
+  { "naq", WA_SCRIPTS_naq, 1u },
+  { "nb", WA_SCRIPTS_nb, 1u },
+  { "nd", WA_SCRIPTS_nd, 1u },
+  { "nds", WA_SCRIPTS_nds, 1u },
+  { "ne", WA_SCRIPTS_ne, 1u },
+  { "nl", WA_SCRIPTS_nl, 1u },
+  { "nmg", WA_SCRIPTS_nmg, 1u },
+  { "nn", WA_SCRIPTS_nn, 1u },
+  { "nnh", WA_SCRIPTS_nnh, 1u },
+  { "no", WA_SCRIPTS_no, 1u },
+  { "nqo", WA_SCRIPTS_nqo, 1u },
+  { "nr", WA_SCRIPTS_nr, 1u },
+  { "nso", WA_SCRIPTS_nso, 1u },
+  { "nus", WA_SCRIPTS_nus, 1u },
+  { "nv", WA_SCRIPTS_nv, 1u },
+  { "ny", WA_SCRIPTS_ny, 1u },
+  { "nyn", WA_SCRIPTS_nyn, 1u },
+  { "oc", WA_SCRIPTS_oc, 1u },
+  { "om", WA_SCRIPTS_om, 1u },
+  { "or", WA_SCRIPTS_or, 1u },
+  { "os", WA_SCRIPTS_os, 1u },
+  { "osa", WA_SCRIPTS_osa, 1u },
+  { "pa", WA_SCRIPTS_pa, 1u },
+  { "pap", WA_SCRIPTS_pap, 1u },
+  { "pcm", WA_SCRIPTS_pcm, 1u },
+  { "pis", WA_SCRIPTS_pis, 1u },
+  { "pl", WA_SCRIPTS_pl, 1u },
+  { "prg", WA_SCRIPTS_prg, 1u },
+  { "ps", WA_SCRIPTS_ps, 1u },
+  { "pt", WA_SCRIPTS_pt, 1u },
+  { "qu", WA_SCRIPTS_qu, 1u },
+  { "quc", WA_SCRIPTS_quc, 1u },
+  { "raj", WA_SCRIPTS_raj, 1u },
+  { "rej", WA_SCRIPTS_rej, 1u },
+  { "rhg", WA_SCRIPTS_rhg, 1u },
+  { "rm", WA_SCRIPTS_rm, 1u },
+  { "rn", WA_SCRIPTS_rn, 1u },
+  { "ro", WA_SCRIPTS_ro, 1u },
+  { "ru", WA_SCRIPTS_ru, 1u },
+  { "ruc", WA_SCRIPTS_ruc, 1u },
+  { "rw", WA_SCRIPTS_rw, 1u },
+  { "rwk", WA_SCRIPTS_rwk, 1u },
+  { "sa", WA_SCRIPTS_sa, 1u },
+  { "sah", WA_SCRIPTS_sah, 1u },
+  { "sam", WA_SCRIPTS_sam, 1u },
+  { "saq", WA_SCRIPTS_saq, 1u },
+  { "sat", WA_SCRIPTS_sat, 2u },
+  { "saz", WA_SCRIPTS_saz, 1u },
+  { "sbp", WA_SCRIPTS_sbp, 1u },
+  { "sc", WA_SCRIPTS_sc, 1u },
+  { "scn", WA_SCRIPTS_scn, 1u },
+  { "sd", WA_SCRIPTS_sd, 1u },
+  { "sdh", WA_SCRIPTS_sdh, 1u },
+  { "se", WA_SCRIPTS_se, 1u },
+  { "seh", WA_SCRIPTS_seh, 1u },
+  { "ses", WA_SCRIPTS_ses, 1u },
+  { "sg", WA_SCRIPTS_sg, 1u },
+  { "sh", WA_SCRIPTS_sh, 1u },
+  { "shi", WA_SCRIPTS_shi, 1u },
+  { "si", WA_SCRIPTS_si, 1u },
+  { "sk", WA_SCRIPTS_sk, 1u },
+  { "sl", WA_SCRIPTS_sl, 1u },
+  { "sma", WA_SCRIPTS_sma, 1u },
+  { "smj", WA_SCRIPTS_smj, 1u },
+  { "smn", WA_SCRIPTS_smn, 1u },
+  { "sms", WA_SCRIPTS_sms, 1u },
+  { "sn", WA_SCRIPTS_sn, 1u },
+  { "so", WA_SCRIPTS_so, 1u },
+  { "sq", WA_SCRIPTS_sq, 1u },
+  { "sr", WA_SCRIPTS_sr, 2u },
+  { "ss", WA_SCRIPTS_ss, 1u },
+  { "ssy", WA_SCRIPTS_ssy, 1u },
+  { "st", WA_SCRIPTS_st, 1u },
+  { "su", WA_SCRIPTS_su, 1u },
+  { "sv", WA_SCRIPTS_sv, 1u },
+  { "sw", WA_SCRIPTS_sw, 1u },
+  { "syr", WA_SCRIPTS_syr, 1u },
+  { "szl", WA_SCRIPTS_szl, 1u },
+  { "ta", WA_SCRIPTS_ta, 1u },
+  { "tbw", WA_SCRIPTS_tbw, 1u },
+  { "te", WA_SCRIPTS_te, 1u },
+  { "teo", WA_SCRIPTS_teo, 1u },
+  { "tg", WA_SCRIPTS_tg, 1u },
+  { "th", WA_SCRIPTS_th, 1u },
+  { "ti", WA_SCRIPTS_ti, 1u },
+  { "tig", WA_SCRIPTS_tig, 1u },
+  { "tk", WA_SCRIPTS_tk, 1u },
+  { "tl", WA_SCRIPTS_tl, 1u },
+  { "tn", WA_SCRIPTS_tn, 1u },
+  { "to", WA_SCRIPTS_to, 1u },
+  { "tob", WA_SCRIPTS_tob, 1u },
+  { "tok", WA_SCRIPTS_tok, 1u },
+  { "top", WA_SCRIPTS_top, 1u },
+  { "tpi", WA_SCRIPTS_tpi, 1u },
+  { "tr", WA_SCRIPTS_tr, 1u },
+  { "ts", WA_SCRIPTS_ts, 1u },
+  { "tt", WA_SCRIPTS_tt, 1u },
+  { "ttj", WA_SCRIPTS_ttj, 1u },
+  { "twq", WA_SCRIPTS_twq, 1u },
+  { "tyv", WA_SCRIPTS_tyv, 1u },
+  { "tzm", WA_SCRIPTS_tzm, 1u },
+  { "ug", WA_SCRIPTS_ug, 1u },
+  { "uk", WA_SCRIPTS_uk, 1u },
+  { "ukv", WA_SCRIPTS_ukv, 1u },
+  { "ur", WA_SCRIPTS_ur, 1u },
+  { "uz", WA_SCRIPTS_uz, 2u },
+  { "vai", WA_SCRIPTS_vai, 1u },
+  { "ve", WA_SCRIPTS_ve, 1u },
+  { "vec", WA_SCRIPTS_vec, 1u },
+  { "vi", WA_SCRIPTS_vi, 1u },
+  { "vmw", WA_SCRIPTS_vmw, 1u },
+  { "vo", WA_SCRIPTS_vo, 1u },
+  { "vun", WA_SCRIPTS_vun, 1u },
+  { "wa", WA_SCRIPTS_wa, 1u },
+  { "wae", WA_SCRIPTS_wae, 1u },
+  { "wbp", WA_SCRIPTS_wbp, 1u },
+  { "wo", WA_SCRIPTS_wo, 1u },
+  { "xh", WA_SCRIPTS_xh, 1u },
+  { "xkl", WA_SCRIPTS_xkl, 1u },
+  { "xnr", WA_SCRIPTS_xnr, 1u },
+  { "xog", WA_SCRIPTS_xog, 1u },
+  { "yav", WA_SCRIPTS_yav, 1u },
+  { "yi", WA_SCRIPTS_yi, 1u },
+  { "yo", WA_SCRIPTS_yo, 1u },
+  { "yrl", WA_SCRIPTS_yrl, 1u },
+  { "za", WA_SCRIPTS_za, 1u },
+  { "zh", WA_SCRIPTS_zh, 4u },
+  { "zra", WA_SCRIPTS_zra, 1u },
+  { "zu", WA_SCRIPTS_zu, 1u },
+};
+
+static const uint16_t WA_LANGUAGE_LAYOUTS[] = {
+  1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+  17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,
+  33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48,
+  49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64,
+  65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+  81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96,
+  97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128,
+  129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144,
+  145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160,
+  161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176,
+  177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192,
+  193, 194, 195, 196,
+};
+
+const wa_language_record WA_LANGUAGES[] = {
+  { &WA_ALPHABETS[0], NULL, WA_LANGUAGE_LAYOUTS + 0, 0u }, // aa
+  { &WA_ALPHABETS[1], NULL, WA_LANGUAGE_LAYOUTS + 0, 0u }, // ab
+  { &WA_ALPHABETS[2], &WA_FREQUENCY_LISTS[0], WA_LANGUAGE_LAYOUTS + 0, 0u }, // ady
+  { &WA_ALPHABETS[3], &WA_FREQUENCY_LISTS[1], WA_LANGUAGE_LAYOUTS + 0, 0u }, // af
+  { &WA_ALPHABETS[4], NULL, WA_LANGUAGE_LAYOUTS + 0, 0u }, // agq
+  { &WA_ALPHABETS[5], &WA_FREQUENCY_LISTS[2], WA_LANGUAGE_LAYOUTS + 0, 0u }, // ak
+  { &WA_ALPHABETS[6], &WA_FREQUENCY_LISTS[3], WA_LANGUAGE_LAYOUTS + 0, 0u }, // am
+  { &WA_ALPHABETS[7], NULL, WA_LANGUAGE_LAYOUTS + 0, 0u }, // an
+  { &WA_ALPHABETS[8], &WA_FREQUENCY_LISTS[4], WA_LANGUAGE_LAYOUTS + 0, 3u }, // ar
+  { &WA_ALPHABETS[9], &WA_FREQUENCY_LISTS[5], WA_LANGUAGE_LAYOUTS + 3, 0u }, // arn
+  { &WA_ALPHABETS[10], &WA_FREQUENCY_LISTS[6], WA_LANGUAGE_LAYOUTS + 3, 1u }, // as
+  { &WA_ALPHABETS[11], NULL, WA_LANGUAGE_LAYOUTS + 4, 0u }, // asa
+  { &WA_ALPHABETS[12], &WA_FREQUENCY_LISTS[7], WA_LANGUAGE_LAYOUTS + 4, 0u }, // ast
+  { &WA_ALPHABETS[13], &WA_FREQUENCY_LISTS[8], WA_LANGUAGE_LAYOUTS + 4, 0u }, // ay
+  { &WA_ALPHABETS[14], NULL, WA_LANGUAGE_LAYOUTS + 4, 3u }, // az
+  { &WA_ALPHABETS[16], &WA_FREQUENCY_LISTS[9], WA_LANGUAGE_LAYOUTS + 7, 1u }, // ba
+  { &WA_ALPHABETS[17], &WA_FREQUENCY_LISTS[10], WA_LANGUAGE_LAYOUTS + 8, 0u }, // bal
+  { &WA_ALPHABETS[19], &WA_FREQUENCY_LISTS[11], WA_LANGUAGE_LAYOUTS + 8, 0u }, // ban
+  { &WA_ALPHABETS[20], NULL, WA_LANGUAGE_LAYOUTS + 8, 0u }, // bas
+  { &WA_ALPHABETS[21], NULL, WA_LANGUAGE_LAYOUTS + 8, 0u }, // bax
+  { &WA_ALPHABETS[22], NULL, WA_LANGUAGE_LAYOUTS + 8, 1u }, // be
+  { &WA_ALPHABETS[24], NULL, WA_LANGUAGE_LAYOUTS + 9, 0u }, // bem
+  { &WA_ALPHABETS[25], NULL, WA_LANGUAGE_LAYOUTS + 9, 0u }, // bew
+  { &WA_ALPHABETS[26], NULL, WA_LANGUAGE_LAYOUTS + 9, 0u }, // bez
+  { &WA_ALPHABETS[27], &WA_FREQUENCY_LISTS[12], WA_LANGUAGE_LAYOUTS + 9, 5u }, // bg
+  { &WA_ALPHABETS[28], NULL, WA_LANGUAGE_LAYOUTS + 14, 0u }, // bgc
+  { &WA_ALPHABETS[29], NULL, WA_LANGUAGE_LAYOUTS + 14, 0u }, // bgn
+  { &WA_ALPHABETS[30], &WA_FREQUENCY_LISTS[13], WA_LANGUAGE_LAYOUTS + 14, 0u }, // bho
+  { &WA_ALPHABETS[31], NULL, WA_LANGUAGE_LAYOUTS + 14, 0u }, // bku
+  { &WA_ALPHABETS[32], &WA_FREQUENCY_LISTS[14], WA_LANGUAGE_LAYOUTS + 14, 0u }, // bm
+  { &WA_ALPHABETS[34], &WA_FREQUENCY_LISTS[15], WA_LANGUAGE_LAYOUTS + 14, 3u }, // bn
+  { &WA_ALPHABETS[35], &WA_FREQUENCY_LISTS[16], WA_LANGUAGE_LAYOUTS + 17, 2u }, // bo
+  { &WA_ALPHABETS[36], &WA_FREQUENCY_LISTS[17], WA_LANGUAGE_LAYOUTS + 19, 0u }, // br
+  { &WA_ALPHABETS[37], &WA_FREQUENCY_LISTS[18], WA_LANGUAGE_LAYOUTS + 19, 0u }, // brx
+  { &WA_ALPHABETS[38], &WA_FREQUENCY_LISTS[19], WA_LANGUAGE_LAYOUTS + 19, 1u }, // bs
+  { &WA_ALPHABETS[39], NULL, WA_LANGUAGE_LAYOUTS + 20, 0u }, // bss
+  { &WA_ALPHABETS[40], &WA_FREQUENCY_LISTS[20], WA_LANGUAGE_LAYOUTS + 20, 1u }, // bug
+  { &WA_ALPHABETS[41], NULL, WA_LANGUAGE_LAYOUTS + 21, 0u }, // bya
+  { &WA_ALPHABETS[42], NULL, WA_LANGUAGE_LAYOUTS + 21, 0u }, // byn
+  { &WA_ALPHABETS[43], &WA_FREQUENCY_LISTS[21], WA_LANGUAGE_LAYOUTS + 21, 0u }, // ca
+  { &WA_ALPHABETS[44], NULL, WA_LANGUAGE_LAYOUTS + 21, 0u }, // cad
+  { &WA_ALPHABETS[45], NULL, WA_LANGUAGE_LAYOUTS + 21, 0u }, // ccp
+  { &WA_ALPHABETS[46], &WA_FREQUENCY_LISTS[22], WA_LANGUAGE_LAYOUTS + 21, 0u }, // ce
+  { &WA_ALPHABETS[47], &WA_FREQUENCY_LISTS[23], WA_LANGUAGE_LAYOUTS + 21, 0u }, // ceb
+  { &WA_ALPHABETS[48], NULL, WA_LANGUAGE_LAYOUTS + 21, 0u }, // cgg
+  { &WA_ALPHABETS[49], &WA_FREQUENCY_LISTS[24], WA_LANGUAGE_LAYOUTS + 21, 0u }, // cho
+  { &WA_ALPHABETS[50], &WA_FREQUENCY_LISTS[25], WA_LANGUAGE_LAYOUTS + 21, 2u }, // chr
+  { &WA_ALPHABETS[51], NULL, WA_LANGUAGE_LAYOUTS + 23, 0u }, // cic
+  { &WA_ALPHABETS[52], &WA_FREQUENCY_LISTS[26], WA_LANGUAGE_LAYOUTS + 23, 1u }, // ckb
+  { &WA_ALPHABETS[53], &WA_FREQUENCY_LISTS[27], WA_LANGUAGE_LAYOUTS + 24, 0u }, // co
+  { &WA_ALPHABETS[54], NULL, WA_LANGUAGE_LAYOUTS + 24, 0u }, // cop
+  { &WA_ALPHABETS[55], &WA_FREQUENCY_LISTS[28], WA_LANGUAGE_LAYOUTS + 24, 3u }, // cs
+  { &WA_ALPHABETS[56], NULL, WA_LANGUAGE_LAYOUTS + 27, 0u }, // csw
+  { &WA_ALPHABETS[57], NULL, WA_LANGUAGE_LAYOUTS + 27, 0u }, // cu
+  { &WA_ALPHABETS[58], &WA_FREQUENCY_LISTS[29], WA_LANGUAGE_LAYOUTS + 27, 0u }, // cv
+  { &WA_ALPHABETS[59], &WA_FREQUENCY_LISTS[30], WA_LANGUAGE_LAYOUTS + 27, 0u }, // cy
+  { &WA_ALPHABETS[60], &WA_FREQUENCY_LISTS[31], WA_LANGUAGE_LAYOUTS + 27, 1u }, // da
+  { &WA_ALPHABETS[61], NULL, WA_LANGUAGE_LAYOUTS + 28, 0u }, // dav
+  { &WA_ALPHABETS[62], &WA_FREQUENCY_LISTS[32], WA_LANGUAGE_LAYOUTS + 28, 6u }, // de
+  { &WA_ALPHABETS[63], NULL, WA_LANGUAGE_LAYOUTS + 34, 0u }, // dje
+  { &WA_ALPHABETS[64], &WA_FREQUENCY_LISTS[33], WA_LANGUAGE_LAYOUTS + 34, 0u }, // dsb
+  { &WA_ALPHABETS[65], NULL, WA_LANGUAGE_LAYOUTS + 34, 0u }, // dua
+  { &WA_ALPHABETS[66], NULL, WA_LANGUAGE_LAYOUTS + 34, 2u }, // dv
+  { &WA_ALPHABETS[67], NULL, WA_LANGUAGE_LAYOUTS + 36, 0u }, // dyo
+  { &WA_ALPHABETS[68], NULL, WA_LANGUAGE_LAYOUTS + 36, 1u }, // dz
+  { &WA_ALPHABETS[69], NULL, WA_LANGUAGE_LAYOUTS + 37, 0u }, // ebu
+  { &WA_ALPHABETS[70], &WA_FREQUENCY_LISTS[34], WA_LANGUAGE_LAYOUTS + 37, 0u }, // ee
+  { &WA_ALPHABETS[71], &WA_FREQUENCY_LISTS[35], WA_LANGUAGE_LAYOUTS + 37, 7u }, // el
+  { &WA_ALPHABETS[72], &WA_FREQUENCY_LISTS[36], WA_LANGUAGE_LAYOUTS + 44, 7u }, // en
+  { &WA_ALPHABETS[73], &WA_FREQUENCY_LISTS[37], WA_LANGUAGE_LAYOUTS + 51, 0u }, // eo
+  { &WA_ALPHABETS[74], &WA_FREQUENCY_LISTS[38], WA_LANGUAGE_LAYOUTS + 51, 3u }, // es
+  { &WA_ALPHABETS[75], &WA_FREQUENCY_LISTS[39], WA_LANGUAGE_LAYOUTS + 54, 1u }, // et
+  { &WA_ALPHABETS[76], &WA_FREQUENCY_LISTS[40], WA_LANGUAGE_LAYOUTS + 55, 0u }, // eu
+  { &WA_ALPHABETS[77], NULL, WA_LANGUAGE_LAYOUTS + 55, 0u }, // ewo
+  { &WA_ALPHABETS[78], &WA_FREQUENCY_LISTS[41], WA_LANGUAGE_LAYOUTS + 55, 2u }, // fa
+  { &WA_ALPHABETS[79], &WA_FREQUENCY_LISTS[42], WA_LANGUAGE_LAYOUTS + 57, 0u }, // ff
+  { &WA_ALPHABETS[81], &WA_FREQUENCY_LISTS[43], WA_LANGUAGE_LAYOUTS + 57, 2u }, // fi
+  { &WA_ALPHABETS[82], &WA_FREQUENCY_LISTS[44], WA_LANGUAGE_LAYOUTS + 59, 1u }, // fo
+  { &WA_ALPHABETS[83], &WA_FREQUENCY_LISTS[45], WA_LANGUAGE_LAYOUTS + 60, 7u }, // fr
+  { &WA_ALPHABETS[84], &WA_FREQUENCY_LISTS[46], WA_LANGUAGE_LAYOUTS + 67, 0u }, // frr
+  { &WA_ALPHABETS[85], &WA_FREQUENCY_LISTS[47], WA_LANGUAGE_LAYOUTS + 67, 0u }, // fur
+  { &WA_ALPHABETS[86], NULL, WA_LANGUAGE_LAYOUTS + 67, 0u }, // fy
+  { &WA_ALPHABETS[87], &WA_FREQUENCY_LISTS[48], WA_LANGUAGE_LAYOUTS + 67, 1u }, // ga
+  { &WA_ALPHABETS[88], &WA_FREQUENCY_LISTS[49], WA_LANGUAGE_LAYOUTS + 68, 0u }, // gaa
+  { &WA_ALPHABETS[89], &WA_FREQUENCY_LISTS[50], WA_LANGUAGE_LAYOUTS + 68, 1u }, // gd
+  { &WA_ALPHABETS[90], NULL, WA_LANGUAGE_LAYOUTS + 69, 0u }, // gez
+  { &WA_ALPHABETS[91], &WA_FREQUENCY_LISTS[51], WA_LANGUAGE_LAYOUTS + 69, 0u }, // gl
+  { &WA_ALPHABETS[92], &WA_FREQUENCY_LISTS[52], WA_LANGUAGE_LAYOUTS + 69, 1u }, // gn
+  { &WA_ALPHABETS[93], &WA_FREQUENCY_LISTS[53], WA_LANGUAGE_LAYOUTS + 70, 0u }, // gsw
+  { &WA_ALPHABETS[94], &WA_FREQUENCY_LISTS[54], WA_LANGUAGE_LAYOUTS + 70, 1u }, // gu
+  { &WA_ALPHABETS[95], NULL, WA_LANGUAGE_LAYOUTS + 71, 0u }, // guz
+  { &WA_ALPHABETS[96], NULL, WA_LANGUAGE_LAYOUTS + 71, 0u }, // gv
+  { &WA_ALPHABETS[97], &WA_FREQUENCY_LISTS[55], WA_LANGUAGE_LAYOUTS + 71, 1u }, // ha
+  { &WA_ALPHABETS[98], &WA_FREQUENCY_LISTS[56], WA_LANGUAGE_LAYOUTS + 72, 1u }, // haw
+  { &WA_ALPHABETS[99], &WA_FREQUENCY_LISTS[57], WA_LANGUAGE_LAYOUTS + 73, 3u }, // he
+  { &WA_ALPHABETS[100], &WA_FREQUENCY_LISTS[58], WA_LANGUAGE_LAYOUTS + 76, 1u }, // hi
+  { &WA_ALPHABETS[101], NULL, WA_LANGUAGE_LAYOUTS + 77, 0u }, // hnn
+  { &WA_ALPHABETS[102], &WA_FREQUENCY_LISTS[59], WA_LANGUAGE_LAYOUTS + 77, 0u }, // hr
+  { &WA_ALPHABETS[103], &WA_FREQUENCY_LISTS[60], WA_LANGUAGE_LAYOUTS + 77, 0u }, // hsb
+  { &WA_ALPHABETS[104], &WA_FREQUENCY_LISTS[61], WA_LANGUAGE_LAYOUTS + 77, 0u }, // ht
+  { &WA_ALPHABETS[105], &WA_FREQUENCY_LISTS[62], WA_LANGUAGE_LAYOUTS + 77, 2u }, // hu
+  { &WA_ALPHABETS[106], &WA_FREQUENCY_LISTS[63], WA_LANGUAGE_LAYOUTS + 79, 4u }, // hy
+  { &WA_ALPHABETS[107], &WA_FREQUENCY_LISTS[64], WA_LANGUAGE_LAYOUTS + 83, 0u }, // ia
+  { &WA_ALPHABETS[108], &WA_FREQUENCY_LISTS[65], WA_LANGUAGE_LAYOUTS + 83, 0u }, // id
+  { &WA_ALPHABETS[109], &WA_FREQUENCY_LISTS[66], WA_LANGUAGE_LAYOUTS + 83, 0u }, // ie
+  { &WA_ALPHABETS[110], &WA_FREQUENCY_LISTS[67], WA_LANGUAGE_LAYOUTS + 83, 1u }, // ig
+  { &WA_ALPHABETS[111], NULL, WA_LANGUAGE_LAYOUTS + 84, 0u }, // ii
+  { &WA_ALPHABETS[112], NULL, WA_LANGUAGE_LAYOUTS + 84, 0u }, // io
+  { &WA_ALPHABETS[113], &WA_FREQUENCY_LISTS[68], WA_LANGUAGE_LAYOUTS + 84, 1u }, // is
+  { &WA_ALPHABETS[114], &WA_FREQUENCY_LISTS[69], WA_LANGUAGE_LAYOUTS + 85, 2u }, // it
+  { &WA_ALPHABETS[115], NULL, WA_LANGUAGE_LAYOUTS + 87, 3u }, // iu
+  { &WA_ALPHABETS[117], &WA_FREQUENCY_LISTS[70], WA_LANGUAGE_LAYOUTS + 90, 1u }, // ja
+  { &WA_ALPHABETS[120], &WA_FREQUENCY_LISTS[71], WA_LANGUAGE_LAYOUTS + 91, 0u }, // jbo
+  { &WA_ALPHABETS[121], NULL, WA_LANGUAGE_LAYOUTS + 91, 0u }, // jgo
+  { &WA_ALPHABETS[122], &WA_FREQUENCY_LISTS[72], WA_LANGUAGE_LAYOUTS + 91, 1u }, // jv
+  { &WA_ALPHABETS[123], &WA_FREQUENCY_LISTS[73], WA_LANGUAGE_LAYOUTS + 92, 5u }, // ka
+  { &WA_ALPHABETS[124], &WA_FREQUENCY_LISTS[74], WA_LANGUAGE_LAYOUTS + 97, 0u }, // kaa
+  { &WA_ALPHABETS[126], &WA_FREQUENCY_LISTS[75], WA_LANGUAGE_LAYOUTS + 97, 0u }, // kab
+  { &WA_ALPHABETS[127], &WA_FREQUENCY_LISTS[76], WA_LANGUAGE_LAYOUTS + 97, 0u }, // kam
+  { &WA_ALPHABETS[128], NULL, WA_LANGUAGE_LAYOUTS + 97, 0u }, // kde
+  { &WA_ALPHABETS[129], NULL, WA_LANGUAGE_LAYOUTS + 97, 0u }, // kea
+  { &WA_ALPHABETS[130], NULL, WA_LANGUAGE_LAYOUTS + 97, 0u }, // ken
+  { &WA_ALPHABETS[131], NULL, WA_LANGUAGE_LAYOUTS + 97, 0u }, // kgp
+  { &WA_ALPHABETS[132], NULL, WA_LANGUAGE_LAYOUTS + 97, 0u }, // khq
+  { &WA_ALPHABETS[133], NULL, WA_LANGUAGE_LAYOUTS + 97, 0u }, // ki
+  { &WA_ALPHABETS[134], &WA_FREQUENCY_LISTS[77], WA_LANGUAGE_LAYOUTS + 97, 1u }, // kk
+  { &WA_ALPHABETS[135], NULL, WA_LANGUAGE_LAYOUTS + 98, 0u }, // kkj
+  { &WA_ALPHABETS[136], NULL, WA_LANGUAGE_LAYOUTS + 98, 1u }, // kl
+  { &WA_ALPHABETS[137], &WA_FREQUENCY_LISTS[78], WA_LANGUAGE_LAYOUTS + 99, 2u }, // km
+  { &WA_ALPHABETS[138], &WA_FREQUENCY_LISTS[79], WA_LANGUAGE_LAYOUTS + 101, 1u }, // kn
+  { &WA_ALPHABETS[139], &WA_FREQUENCY_LISTS[80], WA_LANGUAGE_LAYOUTS + 102, 1u }, // ko
+  { &WA_ALPHABETS[141], NULL, WA_LANGUAGE_LAYOUTS + 103, 0u }, // kok
+  { &WA_ALPHABETS[143], NULL, WA_LANGUAGE_LAYOUTS + 103, 0u }, // kpe
+  { &WA_ALPHABETS[144], &WA_FREQUENCY_LISTS[81], WA_LANGUAGE_LAYOUTS + 103, 0u }, // ks
+  { &WA_ALPHABETS[146], NULL, WA_LANGUAGE_LAYOUTS + 103, 0u }, // ksb
+  { &WA_ALPHABETS[147], NULL, WA_LANGUAGE_LAYOUTS + 103, 0u }, // ksf
+  { &WA_ALPHABETS[148], &WA_FREQUENCY_LISTS[82], WA_LANGUAGE_LAYOUTS + 103, 0u }, // ksh
+  { &WA_ALPHABETS[149], &WA_FREQUENCY_LISTS[83], WA_LANGUAGE_LAYOUTS + 103, 0u }, // ku
+  { &WA_ALPHABETS[150], NULL, WA_LANGUAGE_LAYOUTS + 103, 0u }, // kw
+  { &WA_ALPHABETS[151], NULL, WA_LANGUAGE_LAYOUTS + 103, 0u }, // kxv
+  { &WA_ALPHABETS[152], &WA_FREQUENCY_LISTS[84], WA_LANGUAGE_LAYOUTS + 103, 1u }, // ky
+  { &WA_ALPHABETS[153], &WA_FREQUENCY_LISTS[85], WA_LANGUAGE_LAYOUTS + 104, 0u }, // la
+  { &WA_ALPHABETS[154], NULL, WA_LANGUAGE_LAYOUTS + 104, 0u }, // lag
+  { &WA_ALPHABETS[155], NULL, WA_LANGUAGE_LAYOUTS + 104, 1u }, // lb
+  { &WA_ALPHABETS[156], NULL, WA_LANGUAGE_LAYOUTS + 105, 0u }, // lep
+  { &WA_ALPHABETS[157], &WA_FREQUENCY_LISTS[86], WA_LANGUAGE_LAYOUTS + 105, 0u }, // lg
+  { &WA_ALPHABETS[158], NULL, WA_LANGUAGE_LAYOUTS + 105, 0u }, // lif
+  { &WA_ALPHABETS[159], &WA_FREQUENCY_LISTS[87], WA_LANGUAGE_LAYOUTS + 105, 0u }, // lij
+  { &WA_ALPHABETS[160], NULL, WA_LANGUAGE_LAYOUTS + 105, 2u }, // lis
+  { &WA_ALPHABETS[161], NULL, WA_LANGUAGE_LAYOUTS + 107, 0u }, // lkt
+  { &WA_ALPHABETS[162], &WA_FREQUENCY_LISTS[88], WA_LANGUAGE_LAYOUTS + 107, 0u }, // lld
+  { &WA_ALPHABETS[163], &WA_FREQUENCY_LISTS[89], WA_LANGUAGE_LAYOUTS + 107, 0u }, // lmo
+  { &WA_ALPHABETS[164], &WA_FREQUENCY_LISTS[90], WA_LANGUAGE_LAYOUTS + 107, 0u }, // ln
+  { &WA_ALPHABETS[165], &WA_FREQUENCY_LISTS[91], WA_LANGUAGE_LAYOUTS + 107, 1u }, // lo
+  { &WA_ALPHABETS[166], NULL, WA_LANGUAGE_LAYOUTS + 108, 0u }, // lrc
+  { &WA_ALPHABETS[167], &WA_FREQUENCY_LISTS[92], WA_LANGUAGE_LAYOUTS + 108, 3u }, // lt
+  { &WA_ALPHABETS[168], &WA_FREQUENCY_LISTS[93], WA_LANGUAGE_LAYOUTS + 111, 0u }, // ltg
+  { &WA_ALPHABETS[169], NULL, WA_LANGUAGE_LAYOUTS + 111, 0u }, // lu
+  { &WA_ALPHABETS[170], NULL, WA_LANGUAGE_LAYOUTS + 111, 0u }, // luo
+  { &WA_ALPHABETS[171], NULL, WA_LANGUAGE_LAYOUTS + 111, 0u }, // luy
+  { &WA_ALPHABETS[172], &WA_FREQUENCY_LISTS[94], WA_LANGUAGE_LAYOUTS + 111, 3u }, // lv
+  { &WA_ALPHABETS[173], &WA_FREQUENCY_LISTS[95], WA_LANGUAGE_LAYOUTS + 114, 0u }, // lzh
+  { &WA_ALPHABETS[174], &WA_FREQUENCY_LISTS[96], WA_LANGUAGE_LAYOUTS + 114, 0u }, // mai
+  { &WA_ALPHABETS[175], NULL, WA_LANGUAGE_LAYOUTS + 114, 0u }, // mas
+  { &WA_ALPHABETS[176], &WA_FREQUENCY_LISTS[97], WA_LANGUAGE_LAYOUTS + 114, 0u }, // mdf
+  { &WA_ALPHABETS[177], &WA_FREQUENCY_LISTS[98], WA_LANGUAGE_LAYOUTS + 114, 0u }, // meh
+  { &WA_ALPHABETS[178], &WA_FREQUENCY_LISTS[99], WA_LANGUAGE_LAYOUTS + 114, 0u }, // mel
+  { &WA_ALPHABETS[179], NULL, WA_LANGUAGE_LAYOUTS + 114, 0u }, // mer
+  { &WA_ALPHABETS[180], NULL, WA_LANGUAGE_LAYOUTS + 114, 0u }, // mfe
+  { &WA_ALPHABETS[181], &WA_FREQUENCY_LISTS[100], WA_LANGUAGE_LAYOUTS + 114, 0u }, // mg
+  { &WA_ALPHABETS[182], NULL, WA_LANGUAGE_LAYOUTS + 114, 0u }, // mgh
+  { &WA_ALPHABETS[183], NULL, WA_LANGUAGE_LAYOUTS + 114, 0u }, // mgo
+  { &WA_ALPHABETS[184], NULL, WA_LANGUAGE_LAYOUTS + 114, 0u }, // mhn
+  { &WA_ALPHABETS[185], NULL, WA_LANGUAGE_LAYOUTS + 114, 1u }, // mi
+  { &WA_ALPHABETS[186], &WA_FREQUENCY_LISTS[101], WA_LANGUAGE_LAYOUTS + 115, 0u }, // mic
+  { &WA_ALPHABETS[187], NULL, WA_LANGUAGE_LAYOUTS + 115, 0u }, // mid
+  { &WA_ALPHABETS[188], &WA_FREQUENCY_LISTS[102], WA_LANGUAGE_LAYOUTS + 115, 2u }, // mk
+  { &WA_ALPHABETS[189], &WA_FREQUENCY_LISTS[103], WA_LANGUAGE_LAYOUTS + 117, 1u }, // ml
+  { &WA_ALPHABETS[190], &WA_FREQUENCY_LISTS[104], WA_LANGUAGE_LAYOUTS + 118, 0u }, // mmc
+  { &WA_ALPHABETS[191], &WA_FREQUENCY_LISTS[105], WA_LANGUAGE_LAYOUTS + 118, 4u }, // mn
+  { &WA_ALPHABETS[193], &WA_FREQUENCY_LISTS[106], WA_LANGUAGE_LAYOUTS + 122, 0u }, // mni
+  { &WA_ALPHABETS[195], NULL, WA_LANGUAGE_LAYOUTS + 122, 3u }, // mo
+  { &WA_ALPHABETS[196], &WA_FREQUENCY_LISTS[107], WA_LANGUAGE_LAYOUTS + 125, 0u }, // moh
+  { &WA_ALPHABETS[197], NULL, WA_LANGUAGE_LAYOUTS + 125, 1u }, // mr
+  { &WA_ALPHABETS[199], &WA_FREQUENCY_LISTS[108], WA_LANGUAGE_LAYOUTS + 126, 0u }, // ms
+  { &WA_ALPHABETS[200], &WA_FREQUENCY_LISTS[109], WA_LANGUAGE_LAYOUTS + 126, 0u }, // msi
+  { &WA_ALPHABETS[201], &WA_FREQUENCY_LISTS[110], WA_LANGUAGE_LAYOUTS + 126, 2u }, // mt
+  { &WA_ALPHABETS[202], NULL, WA_LANGUAGE_LAYOUTS + 128, 0u }, // mua
+  { &WA_ALPHABETS[203], &WA_FREQUENCY_LISTS[111], WA_LANGUAGE_LAYOUTS + 128, 0u }, // mus
+  { &WA_ALPHABETS[204], &WA_FREQUENCY_LISTS[112], WA_LANGUAGE_LAYOUTS + 128, 2u }, // my
+  { &WA_ALPHABETS[205], &WA_FREQUENCY_LISTS[113], WA_LANGUAGE_LAYOUTS + 130, 0u }, // myv
+  { &WA_ALPHABETS[206], &WA_FREQUENCY_LISTS[114], WA_LANGUAGE_LAYOUTS + 130, 0u }, // mzn
+  { &WA_ALPHABETS[207], NULL, WA_LANGUAGE_LAYOUTS + 130, 0u }, // naq
+  { &WA_ALPHABETS[208], NULL, WA_LANGUAGE_LAYOUTS + 130, 0u }, // nb
+  { &WA_ALPHABETS[209], NULL, WA_LANGUAGE_LAYOUTS + 130, 0u }, // nd
+  { &WA_ALPHABETS[210], &WA_FREQUENCY_LISTS[115], WA_LANGUAGE_LAYOUTS + 130, 0u }, // nds
+  { &WA_ALPHABETS[211], &WA_FREQUENCY_LISTS[116], WA_LANGUAGE_LAYOUTS + 130, 1u }, // ne
+  { &WA_ALPHABETS[212], &WA_FREQUENCY_LISTS[117], WA_LANGUAGE_LAYOUTS + 131, 1u }, // nl
+  { &WA_ALPHABETS[213], NULL, WA_LANGUAGE_LAYOUTS + 132, 0u }, // nmg
+  { &WA_ALPHABETS[214], &WA_FREQUENCY_LISTS[118], WA_LANGUAGE_LAYOUTS + 132, 0u }, // nn
+  { &WA_ALPHABETS[215], NULL, WA_LANGUAGE_LAYOUTS + 132, 0u }, // nnh
+  { &WA_ALPHABETS[216], &WA_FREQUENCY_LISTS[119], WA_LANGUAGE_LAYOUTS + 132, 2u }, // no
+  { &WA_ALPHABETS[217], NULL, WA_LANGUAGE_LAYOUTS + 134, 1u }, // nqo
+  { &WA_ALPHABETS[218], NULL, WA_LANGUAGE_LAYOUTS + 135, 0u }, // nr
+  { &WA_ALPHABETS[219], &WA_FREQUENCY_LISTS[120], WA_LANGUAGE_LAYOUTS + 135, 1u }, // nso
+  { &WA_ALPHABETS[220], &WA_FREQUENCY_LISTS[121], WA_LANGUAGE_LAYOUTS + 136, 0u }, // nus
+  { &WA_ALPHABETS[221], NULL, WA_LANGUAGE_LAYOUTS + 136, 0u }, // nv
+  { &WA_ALPHABETS[222], NULL, WA_LANGUAGE_LAYOUTS + 136, 0u }, // ny
+  { &WA_ALPHABETS[223], NULL, WA_LANGUAGE_LAYOUTS + 136, 0u }, // nyn
+  { &WA_ALPHABETS[224], &WA_FREQUENCY_LISTS[122], WA_LANGUAGE_LAYOUTS + 136, 0u }, // oc
+  { &WA_ALPHABETS[225], &WA_FREQUENCY_LISTS[123], WA_LANGUAGE_LAYOUTS + 136, 0u }, // om
+  { &WA_ALPHABETS[226], &WA_FREQUENCY_LISTS[124], WA_LANGUAGE_LAYOUTS + 136, 1u }, // or
+  { &WA_ALPHABETS[227], NULL, WA_LANGUAGE_LAYOUTS + 137, 0u }, // os
+  { &WA_ALPHABETS[228], NULL, WA_LANGUAGE_LAYOUTS + 137, 1u }, // osa
+  { &WA_ALPHABETS[229], &WA_FREQUENCY_LISTS[125], WA_LANGUAGE_LAYOUTS + 138, 1u }, // pa
+  { &WA_ALPHABETS[230], &WA_FREQUENCY_LISTS[126], WA_LANGUAGE_LAYOUTS + 139, 0u }, // pap
+  { &WA_ALPHABETS[231], NULL, WA_LANGUAGE_LAYOUTS + 139, 0u }, // pcm
+  { &WA_ALPHABETS[232], NULL, WA_LANGUAGE_LAYOUTS + 139, 0u }, // pis
+  { &WA_ALPHABETS[233], &WA_FREQUENCY_LISTS[127], WA_LANGUAGE_LAYOUTS + 139, 2u }, // pl
+  { &WA_ALPHABETS[234], &WA_FREQUENCY_LISTS[128], WA_LANGUAGE_LAYOUTS + 141, 0u }, // prg
+  { &WA_ALPHABETS[235], &WA_FREQUENCY_LISTS[129], WA_LANGUAGE_LAYOUTS + 141, 1u }, // ps
+  { &WA_ALPHABETS[236], &WA_FREQUENCY_LISTS[130], WA_LANGUAGE_LAYOUTS + 142, 3u }, // pt
+  { &WA_ALPHABETS[237], &WA_FREQUENCY_LISTS[131], WA_LANGUAGE_LAYOUTS + 145, 0u }, // qu
+  { &WA_ALPHABETS[238], &WA_FREQUENCY_LISTS[132], WA_LANGUAGE_LAYOUTS + 145, 0u }, // quc
+  { &WA_ALPHABETS[239], NULL, WA_LANGUAGE_LAYOUTS + 145, 0u }, // raj
+  { &WA_ALPHABETS[240], NULL, WA_LANGUAGE_LAYOUTS + 145, 0u }, // rej
+  { &WA_ALPHABETS[241], &WA_FREQUENCY_LISTS[133], WA_LANGUAGE_LAYOUTS + 145, 0u }, // rhg
+  { &WA_ALPHABETS[242], NULL, WA_LANGUAGE_LAYOUTS + 145, 0u }, // rm
+  { &WA_ALPHABETS[243], &WA_FREQUENCY_LISTS[134], WA_LANGUAGE_LAYOUTS + 145, 0u }, // rn
+  { &WA_ALPHABETS[244], &WA_FREQUENCY_LISTS[135], WA_LANGUAGE_LAYOUTS + 145, 3u }, // ro
+  { &WA_ALPHABETS[245], &WA_FREQUENCY_LISTS[136], WA_LANGUAGE_LAYOUTS + 148, 3u }, // ru
+  { &WA_ALPHABETS[246], &WA_FREQUENCY_LISTS[137], WA_LANGUAGE_LAYOUTS + 151, 0u }, // ruc
+  { &WA_ALPHABETS[247], &WA_FREQUENCY_LISTS[138], WA_LANGUAGE_LAYOUTS + 151, 0u }, // rw
+  { &WA_ALPHABETS[248], NULL, WA_LANGUAGE_LAYOUTS + 151, 0u }, // rwk
+  { &WA_ALPHABETS[249], NULL, WA_LANGUAGE_LAYOUTS + 151, 0u }, // sa
+  { &WA_ALPHABETS[250], &WA_FREQUENCY_LISTS[139], WA_LANGUAGE_LAYOUTS + 151, 1u }, // sah
+  { &WA_ALPHABETS[251], NULL, WA_LANGUAGE_LAYOUTS + 152, 0u }, // sam
+  { &WA_ALPHABETS[252], NULL, WA_LANGUAGE_LAYOUTS + 152, 0u }, // saq
+  { &WA_ALPHABETS[253], &WA_FREQUENCY_LISTS[140], WA_LANGUAGE_LAYOUTS + 152, 0u }, // sat
+  { &WA_ALPHABETS[255], NULL, WA_LANGUAGE_LAYOUTS + 152, 0u }, // saz
+  { &WA_ALPHABETS[256], NULL, WA_LANGUAGE_LAYOUTS + 152, 0u }, // sbp
+  { &WA_ALPHABETS[257], NULL, WA_LANGUAGE_LAYOUTS + 152, 0u }, // sc
+  { &WA_ALPHABETS[258], &WA_FREQUENCY_LISTS[141], WA_LANGUAGE_LAYOUTS + 152, 0u }, // scn
+  { &WA_ALPHABETS[259], &WA_FREQUENCY_LISTS[142], WA_LANGUAGE_LAYOUTS + 152, 0u }, // sd
+  { &WA_ALPHABETS[260], &WA_FREQUENCY_LISTS[143], WA_LANGUAGE_LAYOUTS + 152, 0u }, // sdh
+  { &WA_ALPHABETS[261], NULL, WA_LANGUAGE_LAYOUTS + 152, 0u }, // se
+  { &WA_ALPHABETS[262], NULL, WA_LANGUAGE_LAYOUTS + 152, 0u }, // seh
+  { &WA_ALPHABETS[263], NULL, WA_LANGUAGE_LAYOUTS + 152, 0u }, // ses
+  { &WA_ALPHABETS[264], NULL, WA_LANGUAGE_LAYOUTS + 152, 0u }, // sg
+  { &WA_ALPHABETS[265], NULL, WA_LANGUAGE_LAYOUTS + 152, 2u }, // sh
+  { &WA_ALPHABETS[266], &WA_FREQUENCY_LISTS[144], WA_LANGUAGE_LAYOUTS + 154, 0u }, // shi
+  { &WA_ALPHABETS[267], &WA_FREQUENCY_LISTS[145], WA_LANGUAGE_LAYOUTS + 154, 2u }, // si
+  { &WA_ALPHABETS[268], &WA_FREQUENCY_LISTS[146], WA_LANGUAGE_LAYOUTS + 156, 2u }, // sk
+  { &WA_ALPHABETS[269], &WA_FREQUENCY_LISTS[147], WA_LANGUAGE_LAYOUTS + 158, 1u }, // sl
+  { &WA_ALPHABETS[270], &WA_FREQUENCY_LISTS[148], WA_LANGUAGE_LAYOUTS + 159, 0u }, // sma
+  { &WA_ALPHABETS[271], NULL, WA_LANGUAGE_LAYOUTS + 159, 0u }, // smj
+  { &WA_ALPHABETS[272], NULL, WA_LANGUAGE_LAYOUTS + 159, 0u }, // smn
+  { &WA_ALPHABETS[273], NULL, WA_LANGUAGE_LAYOUTS + 159, 0u }, // sms
+  { &WA_ALPHABETS[274], &WA_FREQUENCY_LISTS[149], WA_LANGUAGE_LAYOUTS + 159, 0u }, // sn
+  { &WA_ALPHABETS[275], &WA_FREQUENCY_LISTS[150], WA_LANGUAGE_LAYOUTS + 159, 0u }, // so
+  { &WA_ALPHABETS[276], &WA_FREQUENCY_LISTS[151], WA_LANGUAGE_LAYOUTS + 159, 1u }, // sq
+  { &WA_ALPHABETS[277], &WA_FREQUENCY_LISTS[152], WA_LANGUAGE_LAYOUTS + 160, 2u }, // sr
+  { &WA_ALPHABETS[279], &WA_FREQUENCY_LISTS[153], WA_LANGUAGE_LAYOUTS + 162, 0u }, // ss
+  { &WA_ALPHABETS[280], NULL, WA_LANGUAGE_LAYOUTS + 162, 0u }, // ssy
+  { &WA_ALPHABETS[281], &WA_FREQUENCY_LISTS[154], WA_LANGUAGE_LAYOUTS + 162, 0u }, // st
+  { &WA_ALPHABETS[282], &WA_FREQUENCY_LISTS[155], WA_LANGUAGE_LAYOUTS + 162, 0u }, // su
+  { &WA_ALPHABETS[283], &WA_FREQUENCY_LISTS[156], WA_LANGUAGE_LAYOUTS + 162, 2u }, // sv
+  { &WA_ALPHABETS[284], &WA_FREQUENCY_LISTS[157], WA_LANGUAGE_LAYOUTS + 164, 0u }, // sw
+  { &WA_ALPHABETS[285], NULL, WA_LANGUAGE_LAYOUTS + 164, 2u }, // syr
+  { &WA_ALPHABETS[286], &WA_FREQUENCY_LISTS[158], WA_LANGUAGE_LAYOUTS + 166, 0u }, // szl
+  { &WA_ALPHABETS[287], &WA_FREQUENCY_LISTS[159], WA_LANGUAGE_LAYOUTS + 166, 3u }, // ta
+  { &WA_ALPHABETS[288], NULL, WA_LANGUAGE_LAYOUTS + 169, 0u }, // tbw
+  { &WA_ALPHABETS[289], &WA_FREQUENCY_LISTS[160], WA_LANGUAGE_LAYOUTS + 169, 1u }, // te
+  { &WA_ALPHABETS[290], NULL, WA_LANGUAGE_LAYOUTS + 170, 0u }, // teo
+  { &WA_ALPHABETS[291], &WA_FREQUENCY_LISTS[161], WA_LANGUAGE_LAYOUTS + 170, 1u }, // tg
+  { &WA_ALPHABETS[292], &WA_FREQUENCY_LISTS[162], WA_LANGUAGE_LAYOUTS + 171, 4u }, // th
+  { &WA_ALPHABETS[293], &WA_FREQUENCY_LISTS[163], WA_LANGUAGE_LAYOUTS + 175, 0u }, // ti
+  { &WA_ALPHABETS[294], &WA_FREQUENCY_LISTS[164], WA_LANGUAGE_LAYOUTS + 175, 0u }, // tig
+  { &WA_ALPHABETS[295], &WA_FREQUENCY_LISTS[165], WA_LANGUAGE_LAYOUTS + 175, 1u }, // tk
+  { &WA_ALPHABETS[296], &WA_FREQUENCY_LISTS[166], WA_LANGUAGE_LAYOUTS + 176, 0u }, // tl
+  { &WA_ALPHABETS[297], &WA_FREQUENCY_LISTS[167], WA_LANGUAGE_LAYOUTS + 176, 1u }, // tn
+  { &WA_ALPHABETS[298], NULL, WA_LANGUAGE_LAYOUTS + 177, 0u }, // to
+  { &WA_ALPHABETS[299], &WA_FREQUENCY_LISTS[168], WA_LANGUAGE_LAYOUTS + 177, 0u }, // tob
+  { &WA_ALPHABETS[300], &WA_FREQUENCY_LISTS[169], WA_LANGUAGE_LAYOUTS + 177, 0u }, // tok
+  { &WA_ALPHABETS[301], &WA_FREQUENCY_LISTS[170], WA_LANGUAGE_LAYOUTS + 177, 0u }, // top
+  { &WA_ALPHABETS[302], &WA_FREQUENCY_LISTS[171], WA_LANGUAGE_LAYOUTS + 177, 0u }, // tpi
+  { &WA_ALPHABETS[303], &WA_FREQUENCY_LISTS[172], WA_LANGUAGE_LAYOUTS + 177, 2u }, // tr
+  { &WA_ALPHABETS[304], &WA_FREQUENCY_LISTS[173], WA_LANGUAGE_LAYOUTS + 179, 0u }, // ts
+  { &WA_ALPHABETS[305], &WA_FREQUENCY_LISTS[174], WA_LANGUAGE_LAYOUTS + 179, 2u }, // tt
+  { &WA_ALPHABETS[306], &WA_FREQUENCY_LISTS[175], WA_LANGUAGE_LAYOUTS + 181, 0u }, // ttj
+  { &WA_ALPHABETS[307], NULL, WA_LANGUAGE_LAYOUTS + 181, 0u }, // twq
+  { &WA_ALPHABETS[308], &WA_FREQUENCY_LISTS[176], WA_LANGUAGE_LAYOUTS + 181, 0u }, // tyv
+  { &WA_ALPHABETS[309], NULL, WA_LANGUAGE_LAYOUTS + 181, 1u }, // tzm
+  { &WA_ALPHABETS[310], &WA_FREQUENCY_LISTS[177], WA_LANGUAGE_LAYOUTS + 182, 2u }, // ug
+  { &WA_ALPHABETS[311], &WA_FREQUENCY_LISTS[178], WA_LANGUAGE_LAYOUTS + 184, 2u }, // uk
+  { &WA_ALPHABETS[312], &WA_FREQUENCY_LISTS[179], WA_LANGUAGE_LAYOUTS + 186, 0u }, // ukv
+  { &WA_ALPHABETS[313], &WA_FREQUENCY_LISTS[180], WA_LANGUAGE_LAYOUTS + 186, 1u }, // ur
+  { &WA_ALPHABETS[314], &WA_FREQUENCY_LISTS[181], WA_LANGUAGE_LAYOUTS + 187, 1u }, // uz
+  { &WA_ALPHABETS[316], NULL, WA_LANGUAGE_LAYOUTS + 188, 0u }, // vai
+  { &WA_ALPHABETS[317], &WA_FREQUENCY_LISTS[182], WA_LANGUAGE_LAYOUTS + 188, 0u }, // ve
+  { &WA_ALPHABETS[318], &WA_FREQUENCY_LISTS[183], WA_LANGUAGE_LAYOUTS + 188, 0u }, // vec
+  { &WA_ALPHABETS[319], &WA_FREQUENCY_LISTS[184], WA_LANGUAGE_LAYOUTS + 188, 1u }, // vi
+  { &WA_ALPHABETS[320], NULL, WA_LANGUAGE_LAYOUTS + 189, 0u }, // vmw
+  { &WA_ALPHABETS[321], &WA_FREQUENCY_LISTS[185], WA_LANGUAGE_LAYOUTS + 189, 0u }, // vo
+  { &WA_ALPHABETS[322], NULL, WA_LANGUAGE_LAYOUTS + 189, 0u }, // vun
+  { &WA_ALPHABETS[323], NULL, WA_LANGUAGE_LAYOUTS + 189, 0u }, // wa
+  { &WA_ALPHABETS[324], NULL, WA_LANGUAGE_LAYOUTS + 189, 0u }, // wae
+  { &WA_ALPHABETS[325], NULL, WA_LANGUAGE_LAYOUTS + 189, 0u }, // wbp
+  { &WA_ALPHABETS[326], &WA_FREQUENCY_LISTS[186], WA_LANGUAGE_LAYOUTS + 189, 1u }, // wo
+  { &WA_ALPHABETS[327], &WA_FREQUENCY_LISTS[187], WA_LANGUAGE_LAYOUTS + 190, 0u }, // xh
+  { &WA_ALPHABETS[328], &WA_FREQUENCY_LISTS[188], WA_LANGUAGE_LAYOUTS + 190, 0u }, // xkl
+  { &WA_ALPHABETS[329], NULL, WA_LANGUAGE_LAYOUTS + 190, 0u }, // xnr
+  { &WA_ALPHABETS[330], NULL, WA_LANGUAGE_LAYOUTS + 190, 0u }, // xog
+  { &WA_ALPHABETS[331], NULL, WA_LANGUAGE_LAYOUTS + 190, 0u }, // yav
+  { &WA_ALPHABETS[332], NULL, WA_LANGUAGE_LAYOUTS + 190, 0u }, // yi
+  { &WA_ALPHABETS[333], &WA_FREQUENCY_LISTS[189], WA_LANGUAGE_LAYOUTS + 190, 1u }, // yo
+  { &WA_ALPHABETS[334], NULL, WA_LANGUAGE_LAYOUTS + 191, 0u }, // yrl
+  { &WA_ALPHABETS[335], &WA_FREQUENCY_LISTS[190], WA_LANGUAGE_LAYOUTS + 191, 0u }, // za
+  { &WA_ALPHABETS[336], &WA_FREQUENCY_LISTS[191], WA_LANGUAGE_LAYOUTS + 191, 5u }, // zh
+  { &WA_ALPHABETS[340], NULL, WA_LANGUAGE_LAYOUTS + 196, 0u }, // zra
+  { &WA_ALPHABETS[341], &WA_FREQUENCY_LISTS[192], WA_LANGUAGE_LAYOUTS + 196, 0u }, // zu
+};
+
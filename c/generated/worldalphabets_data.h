@@ -6,10 +6,114 @@
 #define WA_ALPHABETS_COUNT 342u
 #define WA_FREQUENCY_LISTS_COUNT 193u
 #define WA_KEYBOARD_LAYOUTS_COUNT 197u
+#define WA_CP_LANG_RANGES_COUNT 7771u
+#define WA_RANK_WEIGHTS_COUNT 1000u
+#define WA_SCRIPT_CODES_COUNT 178u
+#define WA_SCRIPT_COMMON 176u
+#define WA_SCRIPT_INHERITED 175u
+#define WA_SCRIPT_UNKNOWN 177u
+
+// Hash contract shared with scripts/generate_c_library_data.py
+#define WA_HASH_OFFSET 0x811C9DC5u
+#define WA_HASH_PRIME 0x01000193u
+#define WA_HASH_SEED_STEP 0x9E3779B9u
+
+// Minimal perfect hash: slot = mix(h ^ seeds[h % bucket_count] * step) % count
+typedef struct {
+    const uint16_t *seeds;
+    const uint16_t *slots; // slot -> index into the indexed table
+    uint32_t bucket_count;
+    uint32_t count;
+} wa_mph_table;
+
+// Per-language record, indexed by wa_lang_id (same order as WA_LANGUAGE_CODES
+// and WA_SCRIPT_ENTRIES), joining everything known about one language.
+typedef struct {
+    const wa_alphabet *alphabet;        // default-script alphabet or NULL
+    const wa_frequency_list *frequency; // NULL if no frequency list
+    const uint16_t *layouts;            // WA_KEYBOARD_LAYOUTS indices
+    uint16_t layout_count;
+} wa_language_record;
 
 extern const char *WA_LANGUAGE_CODES[];
+extern const wa_language_record WA_LANGUAGES[];
 extern const wa_script_entry WA_SCRIPT_ENTRIES[];
 extern const wa_alphabet WA_ALPHABETS[];
 extern const wa_frequency_list WA_FREQUENCY_LISTS[];
 extern const wa_keyboard_layout WA_KEYBOARD_LAYOUTS[];
 extern const char *WA_LAYOUT_IDS[];
+
+// Two-level codepoint bitmap: block (cp >> 8) - first_block indexes
+// `blocks`, whose entry selects four words of WA_CP_BLOCKS (0 = empty).
+typedef struct {
+    const uint16_t *blocks;
+    uint16_t first_block;
+    uint16_t block_count;
+} wa_cp_bitmap;
+
+extern const uint64_t WA_CP_BLOCKS[][4];
+extern const wa_cp_bitmap WA_ALPHABET_LETTERS[];   // per WA_ALPHABETS entry
+extern const wa_cp_bitmap WA_ALPHABET_LOWERCASE[]; // per WA_ALPHABETS entry
+
+// Codepoint -> languages: ranges sorted by start, each running to the
+// next start, select a WA_LANG_SETS bitset (bit = wa_lang_id, 0 = empty).
+typedef struct {
+    uint32_t start;
+    uint16_t set;
+} wa_cp_lang_range;
+
+extern const uint64_t WA_LANG_SETS[][WA_LANG_SET_WORDS];
+extern const wa_cp_lang_range WA_CP_LANG_RANGES[];
+
+// Unicode 17.0.0 Script property: WA_SCRIPT_CODES[WA_SCRIPT_STAGE2[
+//     WA_SCRIPT_STAGE1[cp >> 8] * 256 + (cp & 0xFF)]]
+extern const char *WA_SCRIPT_CODES[];
+extern const uint16_t WA_SCRIPT_STAGE1[];
+extern const uint8_t WA_SCRIPT_STAGE2[];
+
+extern const wa_mph_table WA_LANGUAGE_INDEX;          // code -> WA_SCRIPT_ENTRIES
+extern const wa_mph_table WA_ALPHABET_INDEX;          // (code, script) -> WA_ALPHABETS
+extern const wa_mph_table WA_ALPHABET_LANGUAGE_INDEX; // code -> first WA_ALPHABETS entry
+extern const wa_mph_table WA_FREQUENCY_INDEX;         // code -> WA_FREQUENCY_LISTS
+extern const wa_mph_table WA_KEYBOARD_INDEX;          // id -> WA_KEYBOARD_LAYOUTS
+
+// Detection weight of each rank, 1 / log2(rank + 1.5), in both precisions
+extern const double WA_RANK_WEIGHTS[];
+
+// Global token dictionaries: every distinct frequency-list token with
+// its (list, rank) postings, so detection looks each input token up once.
+typedef struct {
+    uint32_t hash;     // hash of the token, checked before comparing text
+    uint32_t postings; // first index into the dictionary's postings
+    uint32_t count;    // number of postings
+} wa_token_entry;
+
+typedef struct {
+    uint16_t list; // WA_FREQUENCY_LISTS index
+    uint16_t rank;
+} wa_token_posting;
+
+typedef struct {
+    const uint32_t *slots; // entry index + 1, 0 = empty
+    const wa_token_entry *entries;
+    const wa_token_posting *postings;
+    uint32_t mask;
+} wa_token_dict;
+
+// Bigram-mode lists are keyed by packed codepoint pairs instead of text:
+// key = (uint64_t)cp1 << 32 | cp2, probed from wa_bigram_hash(key) & mask.
+typedef struct {
+    uint64_t key;
+    uint32_t postings;
+    uint32_t count;
+} wa_bigram_entry;
+
+typedef struct {
+    const uint32_t *slots; // entry index + 1, 0 = empty
+    const wa_bigram_entry *entries;
+    const wa_token_posting *postings;
+    uint32_t mask;
+} wa_bigram_dict;
+
+extern const wa_token_dict WA_WORD_DICT;    // tokens of word-mode lists
+extern const wa_bigram_dict WA_BIGRAM_DICT; // two-codepoint tokens of bigram-mode lists
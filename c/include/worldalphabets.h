@@ -30,6 +30,11 @@ typedef struct {
     double freq;
 } wa_freq_entry;
 
+typedef struct {
+    uint32_t cp;
+    double freq;
+} wa_cp_freq;
+
 typedef struct {
     const char *language;
     const char *script;
@@ -41,6 +46,17 @@ typedef struct {
     size_t frequency_len;
     const char **digits;
     size_t digits_len;
+    // Sorted, distinct first codepoints of the entries above, ready for
+    // binary search without decoding.
+    const uint32_t *uppercase_cps;
+    size_t uppercase_cps_len;
+    const uint32_t *lowercase_cps;
+    size_t lowercase_cps_len;
+    const uint32_t *digits_cps;
+    size_t digits_cps_len;
+    // Single-codepoint entries of `frequency`, sorted by codepoint.
+    const wa_cp_freq *frequency_cps;
+    size_t frequency_cps_len;
 } wa_alphabet;
 
 typedef struct {
@@ -48,6 +64,11 @@ typedef struct {
     const char *mode; // "word" or "bigram"
     const char **tokens;
     size_t token_count;
+    const wa_alphabet *alphabet; // default-script alphabet, NULL if none
+    // Open-addressing token -> rank index (slot holds rank + 1, 0 = empty);
+    // query it through wa_word_rank.
+    const uint16_t *rank_slots;
+    uint32_t rank_mask;
 } wa_frequency_list;
 
 typedef struct {
@@ -74,6 +95,18 @@ typedef struct wa_keyboard_layer {
     size_t entry_count;
 } wa_keyboard_layer;
 
+// Dense language handle: index into wa_get_available_codes(). Resolve a code
+// once with wa_lang_resolve and use the wa_lang_* accessors, which are plain
+// array reads with no string work.
+typedef int32_t wa_lang_id;
+#define WA_LANG_NONE ((wa_lang_id)-1)
+
+// Fixed-width set of languages: bit (id % 64) of words[id / 64].
+#define WA_LANG_SET_WORDS 8
+typedef struct {
+    uint64_t words[WA_LANG_SET_WORDS];
+} wa_lang_set;
+
 typedef struct {
     const char *language;
     double score;
@@ -109,6 +142,26 @@ wa_string_array wa_get_scripts(const char *code);
 
 // Frequency lists
 const wa_frequency_list *wa_load_frequency_list(const char *code);
+// Rank (0 = most frequent) of the `len`-byte token in `list`, or -1 if absent.
+// The token does not need to be NUL-terminated.
+int wa_word_rank(const wa_frequency_list *list, const char *token, size_t len);
+
+// Language handles
+// wa_lang_resolve returns WA_LANG_NONE for unknown codes; the accessors
+// return NULL/0 for WA_LANG_NONE or out-of-range ids.
+wa_lang_id wa_lang_resolve(const char *code);
+size_t wa_lang_count(void);
+const char *wa_lang_code(wa_lang_id id);
+const wa_alphabet *wa_lang_alphabet(wa_lang_id id); // default script
+wa_string_array wa_lang_scripts(wa_lang_id id);
+const wa_frequency_list *wa_lang_frequency_list(wa_lang_id id);
+size_t wa_lang_layout_count(wa_lang_id id);
+const wa_keyboard_layout *wa_lang_layout(wa_lang_id id, size_t index);
+
+// Fills out_set with the languages that use codepoint `cp` (in an alphabet,
+// a frequency-list token or the character index) and returns their count.
+size_t wa_languages_for_codepoint(uint32_t cp, wa_lang_set *out_set);
+int wa_lang_set_contains(const wa_lang_set *set, wa_lang_id id);
 
 // Language detection
 wa_detect_result_array wa_detect_languages(const char *text,
@@ -117,8 +170,138 @@ wa_detect_result_array wa_detect_languages(const char *text,
                                            const wa_prior *priors,
                                            size_t prior_count,
                                            size_t topk);
+// wa_detect_languages over `len` bytes of UTF-8 that need not be
+// NUL-terminated (network frames, slices of memory-mapped files).
+wa_detect_result_array wa_detect_languages_n(const char *text, size_t len,
+                                             const char **candidate_langs,
+                                             size_t candidate_count,
+                                             const wa_prior *priors,
+                                             size_t prior_count,
+                                             size_t topk);
+// The same over `len` native-endian UTF-16 code units (Windows wchar_t, JS
+// strings; unpaired surrogates split words like malformed UTF-8) or `len`
+// ISO-8859-1 bytes, decoded straight to codepoints without transcoding.
+wa_detect_result_array wa_detect_languages_utf16(const uint16_t *text, size_t len,
+                                                 const char **candidate_langs,
+                                                 size_t candidate_count,
+                                                 const wa_prior *priors,
+                                                 size_t prior_count,
+                                                 size_t topk);
+wa_detect_result_array wa_detect_languages_latin1(const char *text, size_t len,
+                                                  const char **candidate_langs,
+                                                  size_t candidate_count,
+                                                  const wa_prior *priors,
+                                                  size_t prior_count,
+                                                  size_t topk);
 void wa_free_detect_results(wa_detect_result_array *results);
 
+// Relative frequency of letter `cp` in `alpha`, 0.0 if it has none.
+double wa_letter_frequency(const wa_alphabet *alpha, uint32_t cp);
+
+// Scripts
+// ISO 15924 code of the Unicode Script property of `cp`: "Latn", "Cyrl",
+// "Zyyy" for shared punctuation and digits, "Zinh" for inherited marks,
+// "Zzzz" if unassigned; NULL past U+10FFFF. Han, kana and Hangul report
+// "Hani", "Hira"/"Kana" and "Hang"; alphabets of the writing systems that
+// mix them use the composite codes "Hans", "Hant", "Jpan" and "Kore".
+const char *wa_script_of(uint32_t cp);
+
+typedef struct {
+    const char *script;
+    size_t count;
+} wa_script_count;
+
+// Counts the codepoints of each script in `len` bytes of UTF-8 `text`,
+// skipping Zyyy, Zinh and Zzzz codepoints and undecodable bytes. Writes up
+// to `cap` entries into `out`, most frequent first, and returns the count.
+size_t wa_detect_script(const char *text, size_t len, wa_script_count *out, size_t cap);
+
+// Returns 1 if codepoint `cp` is an uppercase or lowercase letter of `alpha`
+// (the first codepoint of an entry), in constant time. `alpha` must come from
+// wa_load_alphabet or wa_lang_alphabet; anything else returns 0.
+int wa_alphabet_contains(const wa_alphabet *alpha, uint32_t cp);
+
+// Reusable detector: candidates (NULL/0 = every language with a frequency
+// list) and priors are resolved once at creation, and scratch memory is kept
+// between runs, growing only to fit the largest input seen. Steady-state runs
+// therefore do not allocate. A detector is not thread-safe; use one per thread.
+typedef struct wa_detector wa_detector;
+
+wa_detector *wa_detector_create(const char **candidate_langs,
+                                size_t candidate_count,
+                                const wa_prior *priors,
+                                size_t prior_count);
+// Detects languages in `len` bytes of UTF-8 `text`, writing at most `cap`
+// results (best first; equal scores keep candidate order) into the caller's
+// `out` buffer. Returns the count.
+size_t wa_detector_run(wa_detector *det, const char *text, size_t len,
+                       wa_detect_result *out, size_t cap);
+// wa_detector_run over UTF-16 code units or Latin-1 bytes, as in
+// wa_detect_languages_utf16 and wa_detect_languages_latin1.
+size_t wa_detector_run_utf16(wa_detector *det, const uint16_t *text, size_t len,
+                             wa_detect_result *out, size_t cap);
+size_t wa_detector_run_latin1(wa_detector *det, const char *text, size_t len,
+                              wa_detect_result *out, size_t cap);
+void wa_detector_free(wa_detector *det);
+// Streaming detection over a text that arrives in chunks. Chunks may split
+// UTF-8 sequences and words anywhere; results match one wa_detector_run over
+// the concatenated text, and memory grows with the text's unique tokens
+// rather than its length. The stream borrows `det`, which must not be used
+// for anything else until wa_detect_stream_finish.
+typedef struct wa_detect_stream wa_detect_stream;
+
+wa_detect_stream *wa_detect_stream_begin(wa_detector *det);
+// Scans the next `len` bytes. Returns 0 (chunk not consumed) if scratch
+// cannot grow, 1 otherwise.
+int wa_detect_stream_feed(wa_detect_stream *stream, const char *chunk, size_t len);
+// Interim results for the text so far, without ending the stream. Only the
+// word token still open at the end of the last chunk is held back; its
+// letters and bigrams already count toward the character and bigram scores.
+// A UTF-8 sequence cut off by the chunk end waits for the next chunk.
+size_t wa_detect_stream_peek(wa_detect_stream *stream, wa_detect_result *out, size_t cap);
+// Ends and frees the stream, writing up to `cap` final results into `out`.
+size_t wa_detect_stream_finish(wa_detect_stream *stream, wa_detect_result *out, size_t cap);
+
+// Opt-in parallel mode for very large inputs: runs over texts of at least
+// 128 KiB are cut at word boundaries into up to `threads` chunks (64 KiB or
+// more each) that are tokenized in parallel, and their token overlap is
+// scored on the same threads. Results are identical to a sequential run.
+// 1 (the default) turns it off; without pthreads every run is sequential,
+// and so are the UTF-16 and Latin-1 runs.
+void wa_detector_set_threads(wa_detector *det, size_t threads);
+
+// Detection options shared by every text of a batch
+typedef struct {
+    const char **candidate_langs; // NULL/0 = every language with a frequency list
+    size_t candidate_count;
+    const wa_prior *priors;
+    size_t prior_count;
+    size_t topk;    // results kept per text, 0 = all
+    size_t threads; // batch workers including the caller; 0/1 = caller only
+} wa_detect_config;
+
+// Batch results in one allocation: text i's counts[i] results (best first)
+// start at items[i * stride].
+typedef struct {
+    wa_detect_result *items;
+    size_t *counts;
+    size_t len;    // number of texts
+    size_t stride; // result slots per text
+} wa_detect_batch_result;
+
+// Detects languages in each of the `n` texts, resolving candidates and
+// priors once and reusing one detector's scratch for every text. `lens` gives
+// each text's byte length (NULL = NUL-terminated texts); a NULL text has no
+// results. `config` may be NULL for the defaults. With `threads` > 1 (and
+// a pthreads build) texts are spread over a work-stealing pool of that many
+// workers, at most 64 and at most `n`, each with its own detector; results
+// are the same either way.
+// Returns the number of texts processed: `n`, or 0 if allocation fails.
+size_t wa_detect_languages_batch(const char *const *texts, const size_t *lens, size_t n,
+                                 const wa_detect_config *config,
+                                 wa_detect_batch_result *out_results);
+void wa_free_detect_batch(wa_detect_batch_result *results);
+
 // Keyboards
 wa_string_array wa_get_available_layouts(void);
 const wa_keyboard_layout *wa_load_keyboard(const char *layout_id);
@@ -1,10 +1,22 @@
 #include "worldalphabets.h"
 
-#include <ctype.h>
 #include <math.h>
 #include <stdlib.h>
 #include <string.h>
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define WA_HAVE_SSE2 1
+#endif
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#ifdef WA_HAVE_PTHREADS
+#include <pthread.h>
+#endif
+
 #include "../generated/worldalphabets_data.h"
 
 #define PRIOR_WEIGHT 0.65
@@ -16,42 +28,85 @@ static int wa_streq(const char *a, const char *b) {
     return strcmp(a, b) == 0;
 }
 
-static const wa_alphabet *find_alphabet(const char *code, const char *script) {
-    for (size_t i = 0; i < WA_ALPHABETS_COUNT; i++) {
-        const wa_alphabet *alpha = &WA_ALPHABETS[i];
-        if (!wa_streq(alpha->language, code)) continue;
-        if (script == NULL || wa_streq(alpha->script, script)) {
-            return alpha;
-        }
+// --- lookups ---
+// All code/ID lookups go through the perfect hash tables emitted by
+// scripts/generate_c_library_data.py: hash once, read one seed, land on a
+// single entry and confirm it with one string compare.
+
+static uint32_t wa_hash_update(uint32_t h, const char *s, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        h = (h ^ (uint32_t)(unsigned char)s[i]) * WA_HASH_PRIME;
     }
-    return NULL;
+    return h;
 }
 
-static const wa_script_entry *find_scripts(const char *code) {
-    for (size_t i = 0; i < WA_SCRIPT_ENTRIES_COUNT; i++) {
-        if (wa_streq(WA_SCRIPT_ENTRIES[i].language, code)) {
-            return &WA_SCRIPT_ENTRIES[i];
-        }
+static uint32_t wa_hash_mix(uint32_t h) {
+    h ^= h >> 16;
+    h *= 0x85EBCA6Bu;
+    h ^= h >> 13;
+    h *= 0xC2B2AE35u;
+    h ^= h >> 16;
+    return h;
+}
+
+static uint32_t wa_hash_str(const char *s) {
+    return wa_hash_mix(wa_hash_update(WA_HASH_OFFSET, s, strlen(s)));
+}
+
+static uint32_t wa_hash_pair(const char *a, const char *b) {
+    uint32_t h = wa_hash_update(WA_HASH_OFFSET, a, strlen(a));
+    h *= WA_HASH_PRIME; // NUL separator byte
+    return wa_hash_mix(wa_hash_update(h, b, strlen(b)));
+}
+
+// Returns the only table index `hash` can refer to. Tables must be non-empty,
+// and callers verify the key because absent keys land on some entry too.
+static size_t mph_find(const wa_mph_table *table, uint32_t hash) {
+    uint32_t seed = table->seeds[hash % table->bucket_count];
+    uint32_t slot = wa_hash_mix(hash ^ (seed * WA_HASH_SEED_STEP)) % table->count;
+    return table->slots[slot];
+}
+
+static const wa_alphabet *find_alphabet(const char *code, const char *script) {
+    if (code == NULL) return NULL;
+    if (script == NULL) {
+        if (WA_ALPHABET_LANGUAGE_INDEX.count == 0) return NULL;
+        const wa_alphabet *alpha =
+            &WA_ALPHABETS[mph_find(&WA_ALPHABET_LANGUAGE_INDEX, wa_hash_str(code))];
+        return wa_streq(alpha->language, code) ? alpha : NULL;
+    }
+    if (WA_ALPHABET_INDEX.count == 0) return NULL;
+    const wa_alphabet *alpha =
+        &WA_ALPHABETS[mph_find(&WA_ALPHABET_INDEX, wa_hash_pair(code, script))];
+    if (wa_streq(alpha->language, code) && wa_streq(alpha->script, script)) {
+        return alpha;
     }
     return NULL;
 }
 
+static wa_lang_id find_language(const char *code) {
+    if (code == NULL || WA_LANGUAGE_INDEX.count == 0) return WA_LANG_NONE;
+    size_t idx = mph_find(&WA_LANGUAGE_INDEX, wa_hash_str(code));
+    return wa_streq(WA_LANGUAGE_CODES[idx], code) ? (wa_lang_id)idx : WA_LANG_NONE;
+}
+
+static const wa_language_record *language_record(wa_lang_id id) {
+    if (id < 0 || (size_t)id >= WA_LANGUAGE_CODES_COUNT) return NULL;
+    return &WA_LANGUAGES[id];
+}
+
 static const wa_frequency_list *find_freq_list(const char *code) {
-    for (size_t i = 0; i < WA_FREQUENCY_LISTS_COUNT; i++) {
-        if (wa_streq(WA_FREQUENCY_LISTS[i].language, code)) {
-            return &WA_FREQUENCY_LISTS[i];
-        }
-    }
-    return NULL;
+    if (code == NULL || WA_FREQUENCY_INDEX.count == 0) return NULL;
+    const wa_frequency_list *entry =
+        &WA_FREQUENCY_LISTS[mph_find(&WA_FREQUENCY_INDEX, wa_hash_str(code))];
+    return wa_streq(entry->language, code) ? entry : NULL;
 }
 
 static const wa_keyboard_layout *find_keyboard(const char *id) {
-    for (size_t i = 0; i < WA_KEYBOARD_LAYOUTS_COUNT; i++) {
-        if (wa_streq(WA_KEYBOARD_LAYOUTS[i].id, id)) {
-            return &WA_KEYBOARD_LAYOUTS[i];
-        }
-    }
-    return NULL;
+    if (id == NULL || WA_KEYBOARD_INDEX.count == 0) return NULL;
+    const wa_keyboard_layout *layout =
+        &WA_KEYBOARD_LAYOUTS[mph_find(&WA_KEYBOARD_INDEX, wa_hash_str(id))];
+    return wa_streq(layout->id, id) ? layout : NULL;
 }
 
 wa_string_array wa_get_available_codes(void) {
@@ -61,70 +116,173 @@ wa_string_array wa_get_available_codes(void) {
 }
 
 const wa_alphabet *wa_load_alphabet(const char *code, const char *script) {
-    const char *selected_script = script;
-    if (selected_script == NULL) {
-        const wa_script_entry *scripts = find_scripts(code);
-        if (scripts != NULL && scripts->script_count > 0) {
-            selected_script = scripts->scripts[0];
-        }
+    if (script == NULL) {
+        const wa_language_record *record = language_record(find_language(code));
+        // Languages missing from the index fall back to their first alphabet
+        return record != NULL ? record->alphabet : find_alphabet(code, NULL);
     }
-    return find_alphabet(code, selected_script);
+    return find_alphabet(code, script);
 }
 
 wa_string_array wa_get_scripts(const char *code) {
-    const wa_script_entry *entry = find_scripts(code);
-    if (entry == NULL) {
-        wa_string_array empty = { .items = NULL, .len = 0 };
-        return empty;
-    }
-    wa_string_array result = { .items = entry->scripts, .len = entry->script_count };
-    return result;
+    return wa_lang_scripts(find_language(code));
 }
 
 const wa_frequency_list *wa_load_frequency_list(const char *code) {
     return find_freq_list(code);
 }
 
-// --- detection ---
+// Compare a NUL-terminated string with a `len`-byte token without reading
+// past the end of either.
+static int wa_token_eq(const char *z, const char *token, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        if (z[i] != token[i] || z[i] == '\0') return 0;
+    }
+    return z[len] == '\0';
+}
 
-typedef struct {
-    uint32_t *items;
-    size_t len;
-    size_t cap;
-} wa_u32_array;
+// Probe the generated rank index with a precomputed wa_hash_* value.
+static int freq_rank(const wa_frequency_list *list, const char *token, size_t len,
+                     uint32_t hash) {
+    for (uint32_t pos = hash & list->rank_mask;; pos = (pos + 1) & list->rank_mask) {
+        uint16_t slot = list->rank_slots[pos];
+        if (slot == 0) return -1;
+        const char *candidate = list->tokens[slot - 1];
+        if (wa_token_eq(candidate, token, len)) return (int)slot - 1;
+    }
+}
 
-typedef struct {
-    char *data;
-    size_t len;
-    size_t cap;
-} wa_buffer;
+int wa_word_rank(const wa_frequency_list *list, const char *token, size_t len) {
+    if (list == NULL || token == NULL || list->rank_slots == NULL) return -1;
+    return freq_rank(list, token, len,
+                     wa_hash_mix(wa_hash_update(WA_HASH_OFFSET, token, len)));
+}
+
+// --- language handles ---
 
-static void buf_init(wa_buffer *buf) {
-    buf->data = NULL;
-    buf->len = 0;
-    buf->cap = 0;
+wa_lang_id wa_lang_resolve(const char *code) {
+    return find_language(code);
 }
 
-static void buf_reserve(wa_buffer *buf, size_t need) {
-    if (need <= buf->cap) return;
-    size_t new_cap = buf->cap == 0 ? 64 : buf->cap * 2;
-    if (new_cap < need) new_cap = need;
-    char *next = (char *)realloc(buf->data, new_cap);
-    if (next == NULL) return;
-    buf->data = next;
-    buf->cap = new_cap;
+size_t wa_lang_count(void) {
+    return WA_LANGUAGE_CODES_COUNT;
+}
+
+const char *wa_lang_code(wa_lang_id id) {
+    return language_record(id) != NULL ? WA_LANGUAGE_CODES[id] : NULL;
+}
+
+const wa_alphabet *wa_lang_alphabet(wa_lang_id id) {
+    const wa_language_record *record = language_record(id);
+    return record != NULL ? record->alphabet : NULL;
 }
 
-static void buf_push(wa_buffer *buf, char c) {
-    buf_reserve(buf, buf->len + 1);
-    if (buf->data == NULL) return;
-    buf->data[buf->len++] = c;
+wa_string_array wa_lang_scripts(wa_lang_id id) {
+    wa_string_array result = { .items = NULL, .len = 0 };
+    if (language_record(id) == NULL) return result;
+    result.items = WA_SCRIPT_ENTRIES[id].scripts;
+    result.len = WA_SCRIPT_ENTRIES[id].script_count;
+    return result;
+}
+
+const wa_frequency_list *wa_lang_frequency_list(wa_lang_id id) {
+    const wa_language_record *record = language_record(id);
+    return record != NULL ? record->frequency : NULL;
+}
+
+size_t wa_lang_layout_count(wa_lang_id id) {
+    const wa_language_record *record = language_record(id);
+    return record != NULL ? record->layout_count : 0;
+}
+
+const wa_keyboard_layout *wa_lang_layout(wa_lang_id id, size_t index) {
+    const wa_language_record *record = language_record(id);
+    if (record == NULL || index >= record->layout_count) return NULL;
+    return &WA_KEYBOARD_LAYOUTS[record->layouts[index]];
+}
+
+// --- codepoint bitmaps ---
+// Generated two-level bitmaps (see wa_cp_bitmap): one bounds check and one
+// block lookup answer membership for any codepoint.
+
+#define WA_CP_BLOCK_COUNT (0x110000u >> 8)
+
+static const uint64_t *bitmap_block(const wa_cp_bitmap *map, uint32_t block) {
+    uint32_t rel = block - map->first_block; // wraps below first_block
+    if (rel >= map->block_count) return WA_CP_BLOCKS[0];
+    return WA_CP_BLOCKS[map->blocks[rel]];
+}
+
+// Index of alpha in WA_ALPHABETS, or WA_ALPHABETS_COUNT if it is not there.
+static size_t alphabet_index(const wa_alphabet *alpha) {
+    uintptr_t offset = (uintptr_t)alpha - (uintptr_t)WA_ALPHABETS;
+    if (alpha == NULL || offset % sizeof(wa_alphabet) != 0) return WA_ALPHABETS_COUNT;
+    size_t idx = offset / sizeof(wa_alphabet);
+    return idx < WA_ALPHABETS_COUNT ? idx : WA_ALPHABETS_COUNT;
 }
 
-static void buf_reset(wa_buffer *buf) {
-    buf->len = 0;
+int wa_alphabet_contains(const wa_alphabet *alpha, uint32_t cp) {
+    size_t idx = alphabet_index(alpha);
+    if (idx == WA_ALPHABETS_COUNT || cp > 0x10FFFF) return 0;
+    return (int)((bitmap_block(&WA_ALPHABET_LETTERS[idx], cp >> 8)[(cp >> 6) & 3] >>
+                  (cp & 63)) & 1);
 }
 
+static unsigned wa_popcount64(uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+    return (unsigned)__builtin_popcountll(x);
+#else
+    x = x - ((x >> 1) & 0x5555555555555555ull);
+    x = (x & 0x3333333333333333ull) + ((x >> 2) & 0x3333333333333333ull);
+    x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+    return (unsigned)((x * 0x0101010101010101ull) >> 56);
+#endif
+}
+
+// --- codepoint -> languages ---
+
+static const uint64_t *cp_languages(uint32_t cp) {
+    // Last range starting at or before cp
+    size_t lo = 0;
+    size_t hi = WA_CP_LANG_RANGES_COUNT;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (WA_CP_LANG_RANGES[mid].start <= cp) lo = mid + 1; else hi = mid;
+    }
+    return WA_LANG_SETS[lo == 0 ? 0 : WA_CP_LANG_RANGES[lo - 1].set];
+}
+
+static void lang_set_union(wa_lang_set *set, const uint64_t *words) {
+    for (size_t i = 0; i < WA_LANG_SET_WORDS; i++) set->words[i] |= words[i];
+}
+
+static void lang_set_add(wa_lang_set *set, wa_lang_id id) {
+    set->words[id >> 6] |= (uint64_t)1 << (id & 63);
+}
+
+int wa_lang_set_contains(const wa_lang_set *set, wa_lang_id id) {
+    if (set == NULL || id < 0 || id >= WA_LANG_SET_WORDS * 64) return 0;
+    return (int)((set->words[id >> 6] >> (id & 63)) & 1);
+}
+
+size_t wa_languages_for_codepoint(uint32_t cp, wa_lang_set *out_set) {
+    const uint64_t *words = cp_languages(cp);
+    size_t count = 0;
+    for (size_t i = 0; i < WA_LANG_SET_WORDS; i++) {
+        if (out_set != NULL) out_set->words[i] = words[i];
+        count += wa_popcount64(words[i]);
+    }
+    return count;
+}
+
+// --- detection ---
+
+typedef struct {
+    uint32_t *items;
+    size_t len;
+    size_t cap;
+} wa_u32_array;
+
 static void u32_init(wa_u32_array *arr) {
     arr->items = NULL;
     arr->len = 0;
@@ -141,12 +299,88 @@ static void u32_reserve(wa_u32_array *arr, size_t need) {
     arr->cap = new_cap;
 }
 
-static void u32_push_unique(wa_u32_array *arr, uint32_t v) {
-    for (size_t i = 0; i < arr->len; i++) {
-        if (arr->items[i] == v) return;
+static size_t pow2_at_least(size_t n) {
+    size_t size = 1;
+    while (size < n) size *= 2;
+    return size;
+}
+
+// Open-addressing codepoint set that also keeps its members in insertion
+// order in `items`, replacing the quadratic push-unique scans.
+typedef struct {
+    uint32_t *slots; // codepoint + 1, 0 = empty
+    uint32_t mask;
+    wa_u32_array items;
+} wa_cp_set;
+
+static void cp_set_free(wa_cp_set *set) {
+    free(set->slots);
+    free(set->items.items);
+    set->slots = NULL;
+    set->mask = 0;
+    u32_init(&set->items);
+}
+
+static uint32_t *cp_set_slot(const wa_cp_set *set, uint32_t cp) {
+    for (uint32_t pos = wa_hash_mix(cp) & set->mask;; pos = (pos + 1) & set->mask) {
+        uint32_t *slot = &set->slots[pos];
+        if (*slot == 0 || *slot == cp + 1) return slot;
+    }
+}
+
+// Returns 1 if cp was newly added.
+static int cp_set_add(wa_cp_set *set, uint32_t cp) {
+    if (set->slots == NULL || set->items.len >= set->items.cap) return 0;
+    uint32_t *slot = cp_set_slot(set, cp);
+    if (*slot != 0) return 0;
+    *slot = cp + 1;
+    set->items.items[set->items.len++] = cp;
+    return 1;
+}
+
+// Empty the set in O(members). Clearing newest-first keeps every remaining
+// member's probe chain intact until it is cleared itself.
+static void cp_set_clear(wa_cp_set *set) {
+    while (set->items.len > 0) {
+        *cp_set_slot(set, set->items.items[--set->items.len]) = 0;
     }
-    u32_reserve(arr, arr->len + 1);
-    arr->items[arr->len++] = v;
+}
+
+// Empty the set and make room for max_items members, reusing its storage
+// when it is already large enough. Returns 0 on allocation failure.
+static int cp_set_reserve(wa_cp_set *set, size_t max_items) {
+    // Distinct codepoints are bounded by the code space however long the text
+    if (max_items > 0x110000) max_items = 0x110000;
+    size_t size = pow2_at_least(max_items * 2 + 1);
+    if (set->slots != NULL && size <= (size_t)set->mask + 1) {
+        cp_set_clear(set);
+    } else {
+        cp_set_free(set);
+        set->slots = (uint32_t *)calloc(size, sizeof(uint32_t));
+        if (set->slots == NULL) return 0;
+        set->mask = (uint32_t)(size - 1);
+    }
+    u32_reserve(&set->items, max_items);
+    return set->items.cap >= max_items;
+}
+
+// Make room for max_items members, keeping the current ones. Returns 0
+// (set unchanged) on allocation failure.
+static int cp_set_grow(wa_cp_set *set, size_t max_items) {
+    if (max_items > 0x110000) max_items = 0x110000;
+    size_t size = pow2_at_least(max_items * 2 + 1);
+    if (set->slots == NULL || size > (size_t)set->mask + 1) {
+        uint32_t *slots = (uint32_t *)calloc(size, sizeof(uint32_t));
+        if (slots == NULL) return 0;
+        free(set->slots);
+        set->slots = slots;
+        set->mask = (uint32_t)(size - 1);
+        for (size_t i = 0; i < set->items.len; i++) {
+            *cp_set_slot(set, set->items.items[i]) = set->items.items[i] + 1;
+        }
+    }
+    u32_reserve(&set->items, max_items);
+    return set->items.cap >= max_items;
 }
 
 static size_t utf8_encode(uint32_t cp, char out[5]) {
@@ -170,228 +404,802 @@ static size_t utf8_encode(uint32_t cp, char out[5]) {
     return 4;
 }
 
-static uint32_t utf8_next(const char *s, size_t len, size_t *index) {
-    if (*index >= len) return 0;
-    unsigned char c = (unsigned char)s[*index];
+// Strict UTF-8 decoder. Overlong forms, surrogates, values past U+10FFFF
+// and truncated sequences yield WA_CP_INVALID, consuming the maximal invalid
+// subpart (as WHATWG and Unicode recommend) so decoding resynchronises on the
+// next possible lead byte. The sentinel lies outside Unicode, so an encoded
+// U+FFFD in the input is still an ordinary character.
+#define WA_CP_INVALID 0x110000u
+
+static uint32_t utf8_decode(const char *s, size_t len, size_t *index) {
+    const unsigned char *p = (const unsigned char *)s + *index;
+    size_t avail = len - *index;
+    unsigned char c = p[0];
     if (c < 0x80) {
         (*index)++;
         return (uint32_t)c;
-    } else if ((c >> 5) == 0x6 && *index + 1 < len) {
-        uint32_t cp = ((uint32_t)(c & 0x1F) << 6) |
-                      (uint32_t)(s[*index + 1] & 0x3F);
-        *index += 2;
-        return cp;
-    } else if ((c >> 4) == 0xE && *index + 2 < len) {
-        uint32_t cp = ((uint32_t)(c & 0x0F) << 12) |
-                      ((uint32_t)(s[*index + 1] & 0x3F) << 6) |
-                      (uint32_t)(s[*index + 2] & 0x3F);
-        *index += 3;
-        return cp;
-    } else if ((c >> 3) == 0x1E && *index + 3 < len) {
-        uint32_t cp = ((uint32_t)(c & 0x07) << 18) |
-                      ((uint32_t)(s[*index + 1] & 0x3F) << 12) |
-                      ((uint32_t)(s[*index + 2] & 0x3F) << 6) |
-                      (uint32_t)(s[*index + 3] & 0x3F);
-        *index += 4;
-        return cp;
-    }
-    (*index)++;
-    return (uint32_t)c;
+    }
+    size_t need;
+    uint32_t cp;
+    unsigned char lo = 0x80, hi = 0xBF; // valid range of the second byte
+    if (c < 0xC2) {
+        (*index)++; // stray continuation byte or overlong 2-byte lead
+        return WA_CP_INVALID;
+    } else if (c < 0xE0) {
+        need = 1;
+        cp = c & 0x1F;
+    } else if (c < 0xF0) {
+        need = 2;
+        cp = c & 0x0F;
+        if (c == 0xE0) lo = 0xA0;      // overlong
+        else if (c == 0xED) hi = 0x9F; // surrogates
+    } else if (c < 0xF5) {
+        need = 3;
+        cp = c & 0x07;
+        if (c == 0xF0) lo = 0x90;      // overlong
+        else if (c == 0xF4) hi = 0x8F; // past U+10FFFF
+    } else {
+        (*index)++;
+        return WA_CP_INVALID;
+    }
+    for (size_t i = 1; i <= need; i++) {
+        if (i >= avail || p[i] < lo || p[i] > hi) {
+            *index += i;
+            return WA_CP_INVALID;
+        }
+        cp = (cp << 6) | (uint32_t)(p[i] & 0x3F);
+        lo = 0x80;
+        hi = 0xBF;
+    }
+    *index += need + 1;
+    return cp;
+}
+
+// Length of the incomplete but so far valid UTF-8 sequence that ends `s`, 0
+// if there is none. Streams hold these bytes back for the next chunk.
+static size_t utf8_partial_tail(const char *s, size_t len) {
+    for (size_t k = 1; k <= 3 && k <= len; k++) {
+        unsigned char c = (unsigned char)s[len - k];
+        if (c >= 0x80 && c < 0xC0) continue; // continuation byte
+        if (c < 0xC2 || c > 0xF4) return 0;  // ASCII or never a lead
+        size_t need = c < 0xE0 ? 1 : (c < 0xF0 ? 2 : 3);
+        if (need < k) return 0; // complete
+        size_t idx = 0;
+        utf8_decode(s + len - k, k, &idx);
+        return idx == k ? k : 0; // ran out of bytes rather than hit a bad one
+    }
+    return 0;
+}
+
+// Decode one codepoint of native-endian UTF-16 and advance *index; an
+// unpaired surrogate decodes to WA_CP_INVALID.
+static uint32_t utf16_decode(const uint16_t *s, size_t len, size_t *index) {
+    uint32_t c = s[(*index)++];
+    if (c < 0xD800 || c > 0xDFFF) return c;
+    if (c <= 0xDBFF && *index < len && s[*index] >= 0xDC00 && s[*index] <= 0xDFFF) {
+        return 0x10000 + ((c - 0xD800) << 10) + (uint32_t)(s[(*index)++] - 0xDC00);
+    }
+    return WA_CP_INVALID;
+}
+
+static int is_ascii_letter(uint32_t cp) {
+    return (cp | 0x20) >= 'a' && (cp | 0x20) <= 'z';
+}
+
+static uint32_t ascii_lower(uint32_t cp) {
+    return is_ascii_letter(cp) ? (cp | 0x20) : cp;
 }
 
 static int is_letter(uint32_t cp) {
     if (cp < 128) {
-        return isalpha((int)cp);
+        return is_ascii_letter(cp);
     }
-    return 1; // assume non-ASCII letters are valid
+    // assume non-ASCII letters are valid; undecodable bytes split words
+    return cp != WA_CP_INVALID;
 }
 
-static void append_cp(wa_buffer *buf, uint32_t cp) {
-    char tmp[5] = {0};
-    size_t n = utf8_encode(cp, tmp);
-    buf_reserve(buf, buf->len + n);
-    for (size_t i = 0; i < n; i++) {
-        buf->data[buf->len++] = tmp[i];
+// --- ASCII fast path ---
+// Latin-script text is mostly ASCII, so the tokenizers classify a block of
+// WA_ASCII_BLOCK bytes at a time: ascii_block() writes the block lowercased
+// to `lower`, sets *letters to the mask of ASCII letters and returns the mask
+// of non-ASCII bytes, which the caller hands to utf8_decode() one by one.
+
+#if defined(__AVX2__)
+#define WA_ASCII_BLOCK 32
+
+static uint32_t ascii_block(const char *p, char *lower, uint32_t *letters) {
+    __m256i v = _mm256_loadu_si256((const __m256i *)p);
+    __m256i case_bit = _mm256_set1_epi8(0x20);
+    // Bytes >= 0x80 are negative as signed chars and never fall in range
+    __m256i folded = _mm256_or_si256(v, case_bit);
+    __m256i alpha = _mm256_and_si256(_mm256_cmpgt_epi8(folded, _mm256_set1_epi8('a' - 1)),
+                                     _mm256_cmpgt_epi8(_mm256_set1_epi8('z' + 1), folded));
+    _mm256_storeu_si256((__m256i *)lower,
+                        _mm256_or_si256(v, _mm256_and_si256(alpha, case_bit)));
+    *letters = (uint32_t)_mm256_movemask_epi8(alpha);
+    return (uint32_t)_mm256_movemask_epi8(v);
+}
+#elif defined(WA_HAVE_SSE2)
+#define WA_ASCII_BLOCK 16
+
+static uint32_t ascii_block(const char *p, char *lower, uint32_t *letters) {
+    __m128i v = _mm_loadu_si128((const __m128i *)p);
+    __m128i case_bit = _mm_set1_epi8(0x20);
+    __m128i folded = _mm_or_si128(v, case_bit);
+    __m128i alpha = _mm_and_si128(_mm_cmpgt_epi8(folded, _mm_set1_epi8('a' - 1)),
+                                  _mm_cmplt_epi8(folded, _mm_set1_epi8('z' + 1)));
+    _mm_storeu_si128((__m128i *)lower, _mm_or_si128(v, _mm_and_si128(alpha, case_bit)));
+    *letters = (uint32_t)_mm_movemask_epi8(alpha);
+    return (uint32_t)_mm_movemask_epi8(v);
+}
+#else
+#define WA_ASCII_BLOCK 16
+
+static uint32_t ascii_block(const char *p, char *lower, uint32_t *letters) {
+    uint32_t alpha = 0;
+    uint32_t high = 0;
+    for (int i = 0; i < WA_ASCII_BLOCK; i++) {
+        uint32_t c = (unsigned char)p[i];
+        int is_alpha = is_ascii_letter(c);
+        lower[i] = (char)(is_alpha ? (c | 0x20) : c);
+        alpha |= (uint32_t)is_alpha << i;
+        high |= (c >> 7) << i;
     }
+    *letters = alpha;
+    return high;
+}
+#endif
+
+// Index of the lowest set bit; x must be nonzero.
+static unsigned wa_ctz32(uint32_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+    return (unsigned)__builtin_ctz(x);
+#elif defined(_MSC_VER)
+    unsigned long i;
+    _BitScanForward(&i, x);
+    return (unsigned)i;
+#else
+    unsigned n = 0;
+    while ((x & 1) == 0) {
+        x >>= 1;
+        n++;
+    }
+    return n;
+#endif
 }
 
-static void push_token(wa_string_array *arr, wa_buffer *buf, size_t *cap_tokens) {
-    if (buf->len == 0) return;
-    buf_push(buf, '\0');
-    // Deduplicate
-    for (size_t i = 0; i < arr->len; i++) {
-        if (strcmp(arr->items[i], buf->data) == 0) {
-            buf->len = 0;
-            return;
-        }
+// Number of leading ASCII bytes in a block whose non-ASCII mask is `high`.
+static size_t ascii_prefix(uint32_t high) {
+    return high != 0 ? wa_ctz32(high) : WA_ASCII_BLOCK;
+}
+
+// UTF-16 text reuses the byte kernel: narrow_utf16() packs WA_ASCII_BLOCK
+// code units into bytes, ASCII units as themselves and any other unit as a
+// byte >= 0x80, so ascii_block() finds the same ASCII prefix. (Latin-1
+// needs no narrowing: its ASCII bytes are the same as UTF-8's.)
+static void narrow_utf16(const uint16_t *p, char *out) {
+#if defined(__AVX2__) || defined(WA_HAVE_SSE2)
+    const __m128i low7 = _mm_set1_epi16(0x007F);
+    const __m128i high = _mm_set1_epi16((short)0xFF80);
+    const __m128i flag = _mm_set1_epi16(0x0080);
+    const __m128i zero = _mm_setzero_si128();
+    for (int i = 0; i < WA_ASCII_BLOCK; i += 16) {
+        __m128i a = _mm_loadu_si128((const __m128i *)(p + i));
+        __m128i b = _mm_loadu_si128((const __m128i *)(p + i + 8));
+        // Keep 7 bits and set 0x80 on non-ASCII units: packus then never
+        // saturates (it reads units >= 0x8000 as negative)
+        a = _mm_or_si128(_mm_and_si128(a, low7),
+                         _mm_andnot_si128(_mm_cmpeq_epi16(_mm_and_si128(a, high), zero), flag));
+        b = _mm_or_si128(_mm_and_si128(b, low7),
+                         _mm_andnot_si128(_mm_cmpeq_epi16(_mm_and_si128(b, high), zero), flag));
+        _mm_storeu_si128((__m128i *)(out + i), _mm_packus_epi16(a, b));
     }
-    if (arr->len >= *cap_tokens) {
-        *cap_tokens = *cap_tokens ? *cap_tokens * 2 : 64;
-        arr->items = (const char **)realloc(arr->items, sizeof(char *) * (*cap_tokens));
+#else
+    for (int i = 0; i < WA_ASCII_BLOCK; i++) {
+        out[i] = (char)(p[i] < 0x80 ? p[i] : 0x80);
     }
-    arr->items[arr->len++] = strdup(buf->data);
-    buf->len = 0;
+#endif
 }
 
-static int is_word_char(unsigned char c) {
-    return isalnum(c) || c > 127;
+// Length of the run of equal bits in `mask` starting at bit i, capped at n.
+static size_t mask_run(uint32_t mask, size_t i, size_t n) {
+    uint32_t rest = mask >> i;
+    if (rest & 1) rest = ~rest;
+    size_t run = rest != 0 ? wa_ctz32(rest) : n - i;
+    return run < n - i ? run : n - i;
 }
 
-static void tokenize_words(const char *text, wa_string_array *out_tokens) {
-    wa_buffer buf;
-    buf_init(&buf);
-    size_t cap_tokens = 0;
-    out_tokens->items = NULL;
-    out_tokens->len = 0;
+// Scripts: generated two-stage Unicode Script table.
+
+static unsigned script_index(uint32_t cp) {
+    return WA_SCRIPT_STAGE2[(size_t)WA_SCRIPT_STAGE1[cp >> 8] * 256 + (cp & 0xFF)];
+}
 
-    const size_t len = strlen(text);
+const char *wa_script_of(uint32_t cp) {
+    if (cp > 0x10FFFF) return NULL;
+    return WA_SCRIPT_CODES[script_index(cp)];
+}
+
+size_t wa_detect_script(const char *text, size_t len, wa_script_count *out, size_t cap) {
+    if (text == NULL || out == NULL || cap == 0) return 0;
+    size_t counts[WA_SCRIPT_CODES_COUNT] = {0};
+    const unsigned latin = script_index('a');
     size_t idx = 0;
+    char lower[WA_ASCII_BLOCK];
     while (idx < len) {
-        size_t prev = idx;
-        uint32_t cp = utf8_next(text, len, &idx);
-        if (cp < 128) cp = (uint32_t)tolower((int)cp);
-        if (is_letter(cp)) {
-            append_cp(&buf, cp);
-        } else {
-            push_token(out_tokens, &buf, &cap_tokens);
+        if (len - idx >= WA_ASCII_BLOCK) {
+            // ASCII letters are Latin; everything else in ASCII is Common
+            uint32_t letters;
+            size_t n = ascii_prefix(ascii_block(text + idx, lower, &letters));
+            if (n < 32) letters &= (1u << n) - 1;
+            counts[latin] += wa_popcount64(letters);
+            idx += n;
+            if (n == WA_ASCII_BLOCK) continue;
         }
-        if (idx == prev) idx++;
+        uint32_t cp = utf8_decode(text, len, &idx);
+        if (cp != WA_CP_INVALID) counts[script_index(cp)]++;
     }
-    push_token(out_tokens, &buf, &cap_tokens);
-    free(buf.data);
+    counts[WA_SCRIPT_COMMON] = 0;
+    counts[WA_SCRIPT_INHERITED] = 0;
+    counts[WA_SCRIPT_UNKNOWN] = 0;
+
+    // Insertion sort by count, ties in code order
+    size_t n = 0;
+    for (size_t i = 0; i < WA_SCRIPT_CODES_COUNT; i++) {
+        if (counts[i] == 0) continue;
+        size_t pos = n < cap ? n : cap;
+        while (pos > 0 && out[pos - 1].count < counts[i]) {
+            if (pos < cap) out[pos] = out[pos - 1];
+            pos--;
+        }
+        if (pos < cap) {
+            out[pos].script = WA_SCRIPT_CODES[i];
+            out[pos].count = counts[i];
+            if (n < cap) n++;
+        }
+    }
+    return n;
+}
+
+// Token stored in a wa_token_set arena: `len` lowercased bytes at `offset`,
+// plus the finished wa_hash_* value used for dedup and dictionary probes.
+typedef struct {
+    size_t offset;
+    uint32_t len;
+    uint32_t hash;
+} wa_token;
+
+// Unique tokens of one detect call. Token bytes are written straight into a
+// single arena and duplicates are rewound in place, so the arena only holds
+// unique tokens. Storage is sized up front from the input length and reused
+// by later calls, so tokenizing costs no per-token allocation.
+typedef struct {
+    char *bytes;
+    size_t bytes_len;
+    size_t bytes_cap;
+    wa_token *items;
+    size_t len;
+    size_t cap;
+    uint32_t *slots; // dedup index: token index + 1, 0 = empty
+    size_t mask;
+} wa_token_set;
+
+static void token_set_free(wa_token_set *set) {
+    free(set->bytes);
+    free(set->items);
+    free(set->slots);
+    memset(set, 0, sizeof(*set));
 }
 
-static void free_tokens(wa_string_array *tokens) {
-    if (tokens->items == NULL) return;
-    for (size_t i = 0; i < tokens->len; i++) {
-        free((void *)tokens->items[i]);
+// Empty the set in O(tokens), newest-first like cp_set_clear.
+static void token_set_clear(wa_token_set *set) {
+    while (set->len > 0) {
+        size_t i = --set->len;
+        size_t pos = set->items[i].hash & set->mask;
+        while (set->slots[pos] != i + 1) pos = (pos + 1) & set->mask;
+        set->slots[pos] = 0;
     }
-    free(tokens->items);
-    tokens->items = NULL;
-    tokens->len = 0;
+    set->bytes_len = 0;
 }
 
-static void tokenize_bigrams(const wa_u32_array *codepoints, wa_string_array *out_tokens) {
-    wa_buffer buf;
-    buf_init(&buf);
-    size_t cap_tokens = 0;
-    out_tokens->items = NULL;
-    out_tokens->len = 0;
+// Empty the set and make room for max_bytes of token text in max_tokens
+// tokens. Returns 0 (leaving the set empty and unallocated) on failure.
+static int token_set_reserve(wa_token_set *set, size_t max_bytes, size_t max_tokens) {
+    token_set_clear(set);
+    // +4 so a whole UTF-8 sequence can always be encoded at the arena end
+    max_bytes += 4;
+    if (max_tokens == 0) max_tokens = 1;
+    size_t size = pow2_at_least(max_tokens * 2 + 1);
+    if (max_bytes > set->bytes_cap) {
+        char *bytes = (char *)realloc(set->bytes, max_bytes);
+        if (bytes == NULL) {
+            token_set_free(set);
+            return 0;
+        }
+        set->bytes = bytes;
+        set->bytes_cap = max_bytes;
+    }
+    if (max_tokens > set->cap) {
+        wa_token *items = (wa_token *)realloc(set->items, sizeof(wa_token) * max_tokens);
+        if (items == NULL) {
+            token_set_free(set);
+            return 0;
+        }
+        set->items = items;
+        set->cap = max_tokens;
+    }
+    if (set->slots == NULL || size > set->mask + 1) {
+        free(set->slots);
+        set->slots = (uint32_t *)calloc(size, sizeof(uint32_t));
+        if (set->slots == NULL) {
+            token_set_free(set);
+            return 0;
+        }
+        set->mask = size - 1;
+    }
+    return 1;
+}
+
+// Capacity for `need` items: at least double the old one, so sets that grow
+// a little at a time (streams) reallocate O(log n) times.
+static size_t grown_cap(size_t cap, size_t need) {
+    return need > cap * 2 ? need : cap * 2;
+}
+
+// Make room for max_bytes of token text in max_tokens tokens, keeping the
+// current tokens and the arena bytes after them. Returns 0 (set unchanged)
+// on allocation failure.
+static int token_set_grow(wa_token_set *set, size_t max_bytes, size_t max_tokens) {
+    max_bytes += 4; // see token_set_reserve
+    if (max_tokens == 0) max_tokens = 1;
+    if (max_bytes > set->bytes_cap) {
+        size_t cap = grown_cap(set->bytes_cap, max_bytes);
+        char *bytes = (char *)realloc(set->bytes, cap);
+        if (bytes == NULL) return 0;
+        set->bytes = bytes;
+        set->bytes_cap = cap;
+    }
+    if (max_tokens > set->cap) {
+        size_t cap = grown_cap(set->cap, max_tokens);
+        wa_token *items = (wa_token *)realloc(set->items, sizeof(wa_token) * cap);
+        if (items == NULL) return 0;
+        set->items = items;
+        set->cap = cap;
+    }
+    size_t size = pow2_at_least(set->cap * 2 + 1);
+    if (set->slots == NULL || size > set->mask + 1) {
+        uint32_t *slots = (uint32_t *)calloc(size, sizeof(uint32_t));
+        if (slots == NULL) return 0;
+        for (size_t i = 0; i < set->len; i++) {
+            size_t pos = set->items[i].hash & (size - 1);
+            while (slots[pos] != 0) pos = (pos + 1) & (size - 1);
+            slots[pos] = (uint32_t)(i + 1);
+        }
+        free(set->slots);
+        set->slots = slots;
+        set->mask = size - 1;
+    }
+    return 1;
+}
+
+static const char *token_text(const wa_token_set *set, const wa_token *token) {
+    return set->bytes + token->offset;
+}
+
+// Append cp to the token being built at the arena end; returns the updated
+// running (unfinished) hash.
+static uint32_t token_append_cp(wa_token_set *set, uint32_t h, uint32_t cp) {
+    char *out = set->bytes + set->bytes_len;
+    size_t n = utf8_encode(cp, out);
+    set->bytes_len += n;
+    return wa_hash_update(h, out, n);
+}
+
+// Index the `len` bytes at the arena end (from offset `start`) as a token. A
+// duplicate is rewound so the arena only ever holds unique tokens.
+static void token_insert(wa_token_set *set, size_t start, size_t len, uint32_t hash) {
+    size_t pos = hash & set->mask;
+    for (; set->slots[pos] != 0; pos = (pos + 1) & set->mask) {
+        const wa_token *t = &set->items[set->slots[pos] - 1];
+        if (t->hash == hash && t->len == len &&
+            memcmp(set->bytes + t->offset, set->bytes + start, len) == 0) {
+            set->bytes_len = start;
+            return;
+        }
+    }
+    set->slots[pos] = (uint32_t)(set->len + 1);
+    wa_token *t = &set->items[set->len++];
+    t->offset = start;
+    t->len = (uint32_t)len;
+    t->hash = hash;
+}
+
+// Close the token that starts at arena offset `start`.
+static void token_commit(wa_token_set *set, size_t start, uint32_t h) {
+    size_t len = set->bytes_len - start;
+    if (len == 0) return;
+    token_insert(set, start, len, wa_hash_mix(h));
+}
+
+// Packed letter bigram: first codepoint in the high half (see WA_BIGRAM_DICT).
+static uint64_t bigram_key(uint32_t cp1, uint32_t cp2) {
+    return ((uint64_t)cp1 << 32) | cp2;
+}
+
+static uint32_t wa_bigram_hash(uint64_t key) {
+    return wa_hash_mix((uint32_t)key ^ wa_hash_mix((uint32_t)(key >> 32)));
+}
 
-    if (codepoints->len < 2) return;
-    for (size_t i = 0; i + 1 < codepoints->len; i++) {
-        buf_reset(&buf);
-        append_cp(&buf, codepoints->items[i]);
-        append_cp(&buf, codepoints->items[i + 1]);
-        push_token(out_tokens, &buf, &cap_tokens);
+// Unique bigram keys of one detect call, in first-seen order. Reused between
+// calls like wa_token_set.
+typedef struct {
+    uint64_t *items;
+    size_t len;
+    size_t cap;
+    uint32_t *slots; // item index + 1, 0 = empty
+    size_t mask;
+} wa_key_set;
+
+static void key_set_free(wa_key_set *set) {
+    free(set->items);
+    free(set->slots);
+    memset(set, 0, sizeof(*set));
+}
+
+// Empty the set in O(keys), newest-first like cp_set_clear.
+static void key_set_clear(wa_key_set *set) {
+    while (set->len > 0) {
+        size_t i = --set->len;
+        size_t pos = wa_bigram_hash(set->items[i]) & set->mask;
+        while (set->slots[pos] != i + 1) pos = (pos + 1) & set->mask;
+        set->slots[pos] = 0;
     }
-    free(buf.data);
 }
 
-static void collect_characters(const char *text, wa_u32_array *chars, wa_u32_array *codepoints) {
-    u32_init(chars);
-    u32_init(codepoints);
-    size_t len = strlen(text);
+// Empty the set and make room for max_keys keys. Returns 0 (leaving the set
+// empty and unallocated) on failure.
+static int key_set_reserve(wa_key_set *set, size_t max_keys) {
+    key_set_clear(set);
+    if (max_keys == 0) max_keys = 1;
+    size_t size = pow2_at_least(max_keys * 2 + 1);
+    if (max_keys > set->cap) {
+        uint64_t *items = (uint64_t *)realloc(set->items, sizeof(uint64_t) * max_keys);
+        if (items == NULL) {
+            key_set_free(set);
+            return 0;
+        }
+        set->items = items;
+        set->cap = max_keys;
+    }
+    if (set->slots == NULL || size > set->mask + 1) {
+        free(set->slots);
+        set->slots = (uint32_t *)calloc(size, sizeof(uint32_t));
+        if (set->slots == NULL) {
+            key_set_free(set);
+            return 0;
+        }
+        set->mask = size - 1;
+    }
+    return 1;
+}
+
+// Make room for max_keys keys, keeping the current ones. Returns 0 (set
+// unchanged) on allocation failure.
+static int key_set_grow(wa_key_set *set, size_t max_keys) {
+    if (max_keys == 0) max_keys = 1;
+    if (max_keys > set->cap) {
+        size_t cap = grown_cap(set->cap, max_keys);
+        uint64_t *items = (uint64_t *)realloc(set->items, sizeof(uint64_t) * cap);
+        if (items == NULL) return 0;
+        set->items = items;
+        set->cap = cap;
+    }
+    size_t size = pow2_at_least(set->cap * 2 + 1);
+    if (set->slots == NULL || size > set->mask + 1) {
+        uint32_t *slots = (uint32_t *)calloc(size, sizeof(uint32_t));
+        if (slots == NULL) return 0;
+        for (size_t i = 0; i < set->len; i++) {
+            size_t pos = wa_bigram_hash(set->items[i]) & (size - 1);
+            while (slots[pos] != 0) pos = (pos + 1) & (size - 1);
+            slots[pos] = (uint32_t)(i + 1);
+        }
+        free(set->slots);
+        set->slots = slots;
+        set->mask = size - 1;
+    }
+    return 1;
+}
+
+static void key_set_add(wa_key_set *set, uint64_t key) {
+    size_t pos = wa_bigram_hash(key) & set->mask;
+    for (; set->slots[pos] != 0; pos = (pos + 1) & set->mask) {
+        if (set->items[set->slots[pos] - 1] == key) return;
+    }
+    if (set->len >= set->cap) return;
+    set->slots[pos] = (uint32_t)(set->len + 1);
+    set->items[set->len++] = key;
+}
+
+// Per-letter half of scan_text(): record cp in the letter set and, when
+// bigrams are wanted, pair it with the previous letter. Bigrams run across
+// word boundaries, over the letter sequence alone.
+static void scan_letter(wa_cp_set *chars, wa_key_set *bigrams, uint32_t *prev,
+                        uint32_t cp) {
+    cp_set_add(chars, cp);
+    if (bigrams != NULL && *prev != 0) key_set_add(bigrams, bigram_key(*prev, cp));
+    *prev = cp;
+}
+
+// Scanner state carried from one piece of a text to the next: the open word
+// at the arena end (from offset `start`, unfinished hash `h`) and the last
+// letter, for bigrams.
+typedef struct {
+    size_t start;
+    uint32_t h;
+    uint32_t prev;
+} wa_scan_state;
+
+static void scan_state_init(wa_scan_state *st, const wa_token_set *words) {
+    st->start = words->bytes_len;
+    st->h = WA_HASH_OFFSET;
+    st->prev = 0;
+}
+
+// Close the open word, if any.
+static void scan_word_end(wa_token_set *words, wa_scan_state *st) {
+    token_commit(words, st->start, st->h);
+    st->start = words->bytes_len;
+    st->h = WA_HASH_OFFSET;
+}
+
+// Scan one decoded (and lowercased) codepoint.
+static void scan_cp(wa_token_set *words, wa_cp_set *chars, wa_key_set *bigrams,
+                    wa_scan_state *st, uint32_t cp) {
+    if (is_letter(cp)) {
+        st->h = token_append_cp(words, st->h, cp);
+        scan_letter(chars, bigrams, &st->prev, cp);
+    } else {
+        scan_word_end(words, st);
+    }
+}
+
+// Encodings the scanner reads. Tokens are stored as UTF-8 whatever the
+// input, since that is what the dictionaries hold.
+typedef enum {
+    WA_INPUT_UTF8,
+    WA_INPUT_LATIN1,
+    WA_INPUT_UTF16 // native-endian code units
+} wa_input;
+
+// Most UTF-8 bytes one input unit can turn into.
+static size_t input_utf8_width(wa_input enc) {
+    return enc == WA_INPUT_UTF8 ? 1 : (enc == WA_INPUT_LATIN1 ? 2 : 3);
+}
+
+// Scan `len` units of text continuing from `st`, adding to the unique word
+// tokens, the unique letter set and, unless `bigrams` is NULL, the unique
+// letter bigrams. The last word stays open. The sets must have room for the
+// piece: len * input_utf8_width() more bytes, `len` more letters and
+// len / 2 + 1 more tokens.
+static void scan_piece(const void *text, size_t len, wa_input enc, wa_token_set *words,
+                       wa_cp_set *chars, wa_key_set *bigrams, wa_scan_state *st) {
+    const char *bytes = (const char *)text;
+    const uint16_t *units = (const uint16_t *)text;
+    size_t start = st->start;
+    uint32_t h = st->h;
+    uint32_t prev = st->prev;
     size_t idx = 0;
+    char lower[WA_ASCII_BLOCK];
+    char narrow[WA_ASCII_BLOCK];
     while (idx < len) {
-        uint32_t cp = utf8_next(text, len, &idx);
-        if (cp < 128) cp = (uint32_t)tolower((int)cp);
+        if (len - idx >= WA_ASCII_BLOCK) {
+            const char *block = bytes + idx;
+            if (enc == WA_INPUT_UTF16) {
+                narrow_utf16(units + idx, narrow);
+                block = narrow;
+            }
+            uint32_t letters;
+            size_t n = ascii_prefix(ascii_block(block, lower, &letters));
+            for (size_t i = 0; i < n;) {
+                size_t run = mask_run(letters, i, n);
+                if ((letters >> i) & 1) {
+                    char *out = words->bytes + words->bytes_len;
+                    memcpy(out, lower + i, run);
+                    words->bytes_len += run;
+                    h = wa_hash_update(h, out, run);
+                    for (size_t j = i; j < i + run; j++) {
+                        scan_letter(chars, bigrams, &prev, (uint32_t)(unsigned char)lower[j]);
+                    }
+                } else {
+                    token_commit(words, start, h);
+                    start = words->bytes_len;
+                    h = WA_HASH_OFFSET;
+                }
+                i += run;
+            }
+            idx += n;
+            if (n == WA_ASCII_BLOCK) continue;
+        }
+        uint32_t cp;
+        if (enc == WA_INPUT_UTF8) {
+            cp = utf8_decode(bytes, len, &idx);
+        } else if (enc == WA_INPUT_LATIN1) {
+            cp = (unsigned char)bytes[idx++];
+        } else {
+            cp = utf16_decode(units, len, &idx);
+        }
+        cp = ascii_lower(cp);
         if (is_letter(cp)) {
-            u32_push_unique(chars, cp);
-            u32_reserve(codepoints, codepoints->len + 1);
-            codepoints->items[codepoints->len++] = cp;
+            h = token_append_cp(words, h, cp);
+            scan_letter(chars, bigrams, &prev, cp);
+        } else {
+            token_commit(words, start, h);
+            start = words->bytes_len;
+            h = WA_HASH_OFFSET;
         }
     }
+    st->start = start;
+    st->h = h;
+    st->prev = prev;
 }
 
-static double overlap_tokens(const wa_string_array *tokens, const wa_frequency_list *freq) {
-    if (!tokens || !freq || tokens->len == 0 || freq->token_count == 0) return 0.0;
-    double score = 0.0;
-    for (size_t i = 0; i < tokens->len; i++) {
-        const char *t = tokens->items[i];
-        for (size_t r = 0; r < freq->token_count; r++) {
-            if (wa_streq(t, freq->tokens[r])) {
-                score += 1.0 / log2((double)r + 1.5);
-                break;
-            }
+// Single pass over `len` units of text producing the unique word tokens,
+// the unique letter set and, unless `bigrams` is NULL, the unique letter
+// bigrams. Returns the text's last letter, 0 if it has none.
+static uint32_t scan_text(const void *text, size_t len, wa_input enc, wa_token_set *words,
+                          wa_cp_set *chars, wa_key_set *bigrams) {
+    // UTF-8 sequences re-encode to their own length and invalid ones split
+    // words, so word text never outgrows the input; other encodings grow by
+    // at most input_utf8_width(). Tokens are separated by at least one unit
+    // and every letter consumes at least one.
+    size_t width = input_utf8_width(enc);
+    if (len > SIZE_MAX / 4 / width ||
+        !token_set_reserve(words, len * width, len / 2 + 1) || !cp_set_reserve(chars, len) ||
+        (bigrams != NULL && !key_set_reserve(bigrams, len))) {
+        token_set_clear(words);
+        cp_set_clear(chars);
+        if (bigrams != NULL) key_set_clear(bigrams);
+        return 0;
+    }
+
+    wa_scan_state st;
+    scan_state_init(&st, words);
+    scan_piece(text, len, enc, words, chars, bigrams, &st);
+    scan_word_end(words, &st);
+    return st.prev;
+}
+
+static const wa_token_entry *dict_find(const wa_token_dict *dict, const char *token,
+                                       size_t len, uint32_t hash) {
+    for (uint32_t pos = hash & dict->mask;; pos = (pos + 1) & dict->mask) {
+        uint32_t slot = dict->slots[pos];
+        if (slot == 0) return NULL;
+        const wa_token_entry *entry = &dict->entries[slot - 1];
+        if (entry->hash != hash) continue;
+        const wa_token_posting *first = &dict->postings[entry->postings];
+        if (wa_token_eq(WA_FREQUENCY_LISTS[first->list].tokens[first->rank], token, len)) {
+            return entry;
         }
     }
-    return score;
 }
 
-static double prior_for(const wa_prior *priors, size_t prior_count, const char *lang) {
-    if (priors == NULL || lang == NULL) return 0.0;
-    for (size_t i = 0; i < prior_count; i++) {
-        if (wa_streq(priors[i].language, lang)) {
-            return priors[i].prior;
+// Single pass over input tokens [begin, end): each token is looked up once in
+// the global dictionary and its rank weight is added to every list
+// containing it. Per list this sums the same terms in the same order as
+// scanning the lists one by one, so scores are unchanged.
+static void accumulate_overlap(const wa_token_dict *dict, const wa_token_set *tokens,
+                               size_t begin, size_t end, double *list_scores) {
+    for (size_t i = begin; i < end; i++) {
+        const wa_token *t = &tokens->items[i];
+        const wa_token_entry *entry = dict_find(dict, token_text(tokens, t), t->len, t->hash);
+        if (entry == NULL) continue;
+        const wa_token_posting *p = &dict->postings[entry->postings];
+        for (uint32_t j = 0; j < entry->count; j++) {
+            list_scores[p[j].list] += WA_RANK_WEIGHTS[p[j].rank];
         }
     }
-    return 0.0;
 }
 
-static double character_overlap(const wa_u32_array *text_chars, const wa_alphabet *alpha) {
-    if (!text_chars || !alpha || text_chars->len == 0 || alpha->lowercase_len == 0) {
-        return 0.0;
+static const wa_bigram_entry *bigram_find(const wa_bigram_dict *dict, uint64_t key) {
+    for (uint32_t pos = wa_bigram_hash(key) & dict->mask;; pos = (pos + 1) & dict->mask) {
+        uint32_t slot = dict->slots[pos];
+        if (slot == 0) return NULL;
+        if (dict->entries[slot - 1].key == key) return &dict->entries[slot - 1];
     }
+}
 
-    wa_u32_array alphabet_chars;
-    u32_init(&alphabet_chars);
-    for (size_t i = 0; i < alpha->lowercase_len; i++) {
-        const char *ch = alpha->lowercase[i];
-        size_t idx = 0;
-        uint32_t cp = utf8_next(ch, strlen(ch), &idx);
-        u32_push_unique(&alphabet_chars, cp);
+// accumulate_overlap() for bigram keys.
+static void accumulate_bigram_overlap(const wa_bigram_dict *dict, const wa_key_set *keys,
+                                      size_t begin, size_t end, double *list_scores) {
+    for (size_t i = begin; i < end; i++) {
+        const wa_bigram_entry *entry = bigram_find(dict, keys->items[i]);
+        if (entry == NULL) continue;
+        const wa_token_posting *p = &dict->postings[entry->postings];
+        for (uint32_t j = 0; j < entry->count; j++) {
+            list_scores[p[j].list] += WA_RANK_WEIGHTS[p[j].rank];
+        }
     }
+}
 
-    size_t match = 0;
-    size_t nonmatch = 0;
-    for (size_t i = 0; i < text_chars->len; i++) {
-        uint32_t cp = text_chars->items[i];
-        int found = 0;
-        for (size_t j = 0; j < alphabet_chars.len; j++) {
-            if (alphabet_chars.items[j] == cp) {
-                found = 1;
-                break;
-            }
+// Unique letters of one call laid out like WA_CP_BLOCKS, so the overlap with
+// an alphabet is an AND and popcount per block the text touches.
+typedef struct {
+    uint16_t slot[WA_CP_BLOCK_COUNT];   // block -> index into words + 1, 0 = untouched
+    uint16_t blocks[WA_CP_BLOCK_COUNT]; // touched blocks
+    uint64_t words[WA_CP_BLOCK_COUNT][4];
+    size_t len;
+} wa_text_bitmap;
+
+static void text_bitmap_build(wa_text_bitmap *bm, const wa_u32_array *chars) {
+    for (size_t i = 0; i < bm->len; i++) {
+        bm->slot[bm->blocks[i]] = 0;
+        memset(bm->words[i], 0, sizeof(bm->words[i]));
+    }
+    bm->len = 0;
+    for (size_t i = 0; i < chars->len; i++) {
+        uint32_t cp = chars->items[i];
+        uint32_t block = cp >> 8;
+        if (bm->slot[block] == 0) {
+            bm->blocks[bm->len++] = (uint16_t)block;
+            bm->slot[block] = (uint16_t)bm->len;
         }
-        if (found) match++; else nonmatch++;
+        bm->words[bm->slot[block] - 1][(cp >> 6) & 3] |= (uint64_t)1 << (cp & 63);
     }
+}
+
+// `text` holds the `text_len` unique letters of the input.
+static double character_overlap(const wa_text_bitmap *text, size_t text_len,
+                                const wa_alphabet *alpha) {
+    size_t idx = alphabet_index(alpha);
+    if (text_len == 0 || idx == WA_ALPHABETS_COUNT || alpha->lowercase_cps_len == 0) {
+        return 0.0;
+    }
+    size_t alphabet_len = alpha->lowercase_cps_len;
+    const wa_cp_bitmap *map = &WA_ALPHABET_LOWERCASE[idx];
+
+    size_t match = 0;
+    for (size_t i = 0; i < text->len; i++) {
+        const uint64_t *a = bitmap_block(map, text->blocks[i]);
+        const uint64_t *t = text->words[i];
+        match += wa_popcount64(a[0] & t[0]) + wa_popcount64(a[1] & t[1]) +
+                 wa_popcount64(a[2] & t[2]) + wa_popcount64(a[3] & t[3]);
+    }
+    size_t nonmatch = text_len - match;
 
     if (match == 0) {
-        free(alphabet_chars.items);
         return 0.0;
     }
 
-    double coverage = (double)match / (double)text_chars->len;
-    double penalty = (double)nonmatch / (double)text_chars->len;
-    double alphabetCoverage = (double)match / (double)alphabet_chars.len;
-    free(alphabet_chars.items);
+    double coverage = (double)match / (double)text_len;
+    double penalty = (double)nonmatch / (double)text_len;
+    double alphabetCoverage = (double)match / (double)alphabet_len;
 
     double score = coverage * 0.6 - penalty * 0.2 + alphabetCoverage * 0.2;
     return score < 0.0 ? 0.0 : score;
 }
 
-static double lookup_char_freq(const wa_alphabet *alpha, uint32_t cp) {
-    if (!alpha || alpha->frequency_len == 0) return 0.0;
-    char tmp[5] = {0};
-    size_t n = utf8_encode(cp, tmp);
-    tmp[n] = '\0';
-    for (size_t i = 0; i < alpha->frequency_len; i++) {
-        if (wa_streq(alpha->frequency[i].ch, tmp)) {
-            return alpha->frequency[i].freq;
-        }
+double wa_letter_frequency(const wa_alphabet *alpha, uint32_t cp) {
+    if (alpha == NULL) return 0.0;
+    size_t lo = 0;
+    size_t hi = alpha->frequency_cps_len;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (alpha->frequency_cps[mid].cp < cp) lo = mid + 1; else hi = mid;
+    }
+    if (lo < alpha->frequency_cps_len && alpha->frequency_cps[lo].cp == cp) {
+        return alpha->frequency_cps[lo].freq;
     }
     return 0.0;
 }
 
 static double frequency_overlap(const wa_u32_array *text_chars, const wa_alphabet *alpha) {
-    if (!text_chars || !alpha || text_chars->len == 0 || alpha->frequency_len == 0) {
+    if (!text_chars || !alpha || text_chars->len == 0 || alpha->frequency_cps_len == 0) {
         return 0.0;
     }
     double score = 0.0;
     double total = 0.0;
     for (size_t i = 0; i < text_chars->len; i++) {
-        double f = lookup_char_freq(alpha, text_chars->items[i]);
+        double f = wa_letter_frequency(alpha, text_chars->items[i]);
         if (f > 0.0) {
             score += f;
             total += f;
@@ -400,29 +1208,612 @@ static double frequency_overlap(const wa_u32_array *text_chars, const wa_alphabe
     return total > 0.0 ? score / (total > 0.001 ? total : 0.001) : 0.0;
 }
 
-static double compute_overlap(const wa_frequency_list *freq,
-                              const wa_string_array *tokens) {
-    if (freq == NULL || tokens == NULL || tokens->len == 0) return 0.0;
-    size_t hits = 0;
-    for (size_t i = 0; i < tokens->len; i++) {
-        const char *t = tokens->items[i];
-        for (size_t j = 0; j < freq->token_count; j++) {
-            if (wa_streq(t, freq->tokens[j])) {
-                hits++;
-                break;
+// --- score lanes ---
+// Final scores are computed for every frequency list at once over dense
+// lanes, one double per list, padded to a whole vector. Lane l ends up as
+// base[l] + weight * (x[l] / div[l]) (div NULL: no division) and hit[l]
+// records whether it beats the threshold. The vector paths use the same
+// IEEE operations in the same order as the scalar one, so every build
+// produces identical scores.
+#define WA_SCORE_LANES ((WA_FREQUENCY_LISTS_COUNT + 3u) & ~3u)
+
+static void score_lanes(const double *base, double weight, const double *x,
+                        const double *div, double threshold,
+                        double *out, unsigned char *hit) {
+    // WA_SCORE_LANES is a multiple of 4, so the vector loops need no tail
+#if defined(__AVX2__)
+    const __m256d w = _mm256_set1_pd(weight);
+    const __m256d t = _mm256_set1_pd(threshold);
+    for (size_t l = 0; l < WA_SCORE_LANES; l += 4) {
+        __m256d v = _mm256_loadu_pd(x + l);
+        if (div != NULL) v = _mm256_div_pd(v, _mm256_loadu_pd(div + l));
+        v = _mm256_add_pd(_mm256_loadu_pd(base + l), _mm256_mul_pd(w, v));
+        _mm256_storeu_pd(out + l, v);
+        int m = _mm256_movemask_pd(_mm256_cmp_pd(v, t, _CMP_GT_OQ));
+        hit[l] = (unsigned char)(m & 1);
+        hit[l + 1] = (unsigned char)((m >> 1) & 1);
+        hit[l + 2] = (unsigned char)((m >> 2) & 1);
+        hit[l + 3] = (unsigned char)((m >> 3) & 1);
+    }
+#elif defined(WA_HAVE_SSE2)
+    const __m128d w = _mm_set1_pd(weight);
+    const __m128d t = _mm_set1_pd(threshold);
+    for (size_t l = 0; l < WA_SCORE_LANES; l += 2) {
+        __m128d v = _mm_loadu_pd(x + l);
+        if (div != NULL) v = _mm_div_pd(v, _mm_loadu_pd(div + l));
+        v = _mm_add_pd(_mm_loadu_pd(base + l), _mm_mul_pd(w, v));
+        _mm_storeu_pd(out + l, v);
+        int m = _mm_movemask_pd(_mm_cmpgt_pd(v, t));
+        hit[l] = (unsigned char)(m & 1);
+        hit[l + 1] = (unsigned char)((m >> 1) & 1);
+    }
+#else
+    for (size_t l = 0; l < WA_SCORE_LANES; l++) {
+        double v = div != NULL ? x[l] / div[l] : x[l];
+        out[l] = base[l] + weight * v;
+        hit[l] = out[l] > threshold;
+    }
+#endif
+}
+
+// Top-k selection: a bounded min-heap holding the best `cap` results seen so
+// far, worst at the root. Candidates arrive in order, and on equal scores
+// the earlier candidate ranks first, so results are deterministic.
+typedef struct {
+    double score;
+    uint32_t seq; // candidate index
+} wa_ranked;
+
+static int ranks_before(const wa_ranked *a, const wa_ranked *b) {
+    if (a->score != b->score) return a->score > b->score;
+    return a->seq < b->seq;
+}
+
+static void heap_sift_down(wa_ranked *heap, size_t len, size_t i) {
+    for (;;) {
+        size_t worst = i, l = 2 * i + 1, r = l + 1;
+        if (l < len && ranks_before(&heap[worst], &heap[l])) worst = l;
+        if (r < len && ranks_before(&heap[worst], &heap[r])) worst = r;
+        if (worst == i) return;
+        wa_ranked t = heap[i];
+        heap[i] = heap[worst];
+        heap[worst] = t;
+        i = worst;
+    }
+}
+
+static void heap_offer(wa_ranked *heap, size_t *len, size_t cap,
+                       double score, uint32_t seq) {
+    wa_ranked r = { score, seq };
+    if (*len < cap) {
+        size_t i = (*len)++;
+        while (i > 0 && ranks_before(&heap[(i - 1) / 2], &r)) {
+            heap[i] = heap[(i - 1) / 2];
+            i = (i - 1) / 2;
+        }
+        heap[i] = r;
+    } else if (ranks_before(&r, &heap[0])) {
+        heap[0] = r;
+        heap_sift_down(heap, *len, 0);
+    }
+}
+
+// Sorts the heap in place, best first.
+static void heap_sort(wa_ranked *heap, size_t len) {
+    while (len > 1) {
+        wa_ranked t = heap[0];
+        heap[0] = heap[--len];
+        heap[len] = t;
+        heap_sift_down(heap, len, 0);
+    }
+}
+
+// Token overlap is summed in blocks of WA_SCORE_BLOCK unique tokens (then
+// bigrams): each block into a partial vector of its own, the partials added
+// in block order. Parallel runs score blocks on several threads and still
+// add them in that order, so both paths give bit-identical scores.
+#define WA_SCORE_BLOCK 4096u
+
+// Parallel runs give each thread at least this many input bytes.
+#define WA_PARALLEL_MIN_CHUNK (64u * 1024u)
+#define WA_MAX_THREADS 64u
+
+// One chunk of a parallel scan and its private unique sets.
+typedef struct {
+    const char *text;
+    size_t len;
+    wa_token_set words;
+    wa_key_set bigrams;
+    wa_cp_set chars;
+    uint32_t last; // last letter, 0 if none
+} wa_scan_chunk;
+
+// Detector: resolved candidates and priors plus scratch memory that is kept
+// between runs and only grows, so steady-state runs do not allocate.
+struct wa_detector {
+    wa_lang_id candidates[WA_LANGUAGE_CODES_COUNT];
+    size_t candidate_count;
+    double priors[WA_LANGUAGE_CODES_COUNT]; // dense, indexed by wa_lang_id
+    int want_bigrams;                       // a bigram-mode list is a candidate
+    wa_lang_set prior_langs;                // languages with a nonzero prior
+    wa_lang_set active;                     // languages the text's letters select
+    double list_scores[WA_SCORE_LANES];     // token overlap, one lane per list
+    // Dense per-list lanes (see score_lanes)
+    double lane_prior[WA_SCORE_LANES]; // PRIOR_WEIGHT * prior of the list's language
+    unsigned char lane_bigram[WA_SCORE_LANES]; // list is scored on bigrams
+    double lane_x[WA_SCORE_LANES];
+    double lane_div[WA_SCORE_LANES];
+    double word_scores[WA_SCORE_LANES];
+    double char_scores[WA_SCORE_LANES];
+    unsigned char word_hit[WA_SCORE_LANES];
+    unsigned char char_hit[WA_SCORE_LANES];
+    wa_token_set words;
+    wa_key_set bigrams;
+    wa_cp_set chars;
+    wa_text_bitmap text_bitmap; // chars as a bitmap, built on first fallback
+    wa_ranked *top; // top-k heap, one slot per candidate at most
+    double block_scores[WA_SCORE_LANES]; // partial of the block being summed
+    // Parallel mode (wa_detector_set_threads)
+    size_t threads;
+    wa_scan_chunk *chunks; // `threads` entries, allocated on first use
+    double *partials;      // one vector per score block
+    size_t partials_cap;   // in blocks
+};
+
+wa_detector *wa_detector_create(const char **candidate_langs,
+                                size_t candidate_count,
+                                const wa_prior *priors,
+                                size_t prior_count) {
+    wa_detector *det = (wa_detector *)calloc(1, sizeof(wa_detector));
+    if (det == NULL) return NULL;
+
+    // If no candidates provided, use all languages with frequency lists.
+    if (candidate_count > 0 && candidate_langs != NULL) {
+        for (size_t i = 0; i < candidate_count &&
+                           det->candidate_count < WA_LANGUAGE_CODES_COUNT; i++) {
+            wa_lang_id id = find_language(candidate_langs[i]);
+            if (id != WA_LANG_NONE && WA_LANGUAGES[id].frequency != NULL) {
+                det->candidates[det->candidate_count++] = id;
+            }
+        }
+    } else {
+        for (size_t i = 0; i < WA_LANGUAGE_CODES_COUNT; i++) {
+            if (WA_LANGUAGES[i].frequency != NULL) {
+                det->candidates[det->candidate_count++] = (wa_lang_id)i;
             }
         }
     }
-    if (freq->token_count == 0) return 0.0;
-    return (double)hits / (double)freq->token_count;
+    for (size_t i = prior_count; priors != NULL && i-- > 0;) {
+        wa_lang_id id = find_language(priors[i].language);
+        if (id != WA_LANG_NONE) det->priors[id] = priors[i].prior; // first wins
+    }
+    for (size_t i = 0; i < WA_LANGUAGE_CODES_COUNT; i++) {
+        if (det->priors[i] != 0.0) lang_set_add(&det->prior_langs, (wa_lang_id)i);
+    }
+    for (size_t i = 0; i < det->candidate_count; i++) {
+        const wa_frequency_list *freq = WA_LANGUAGES[det->candidates[i]].frequency;
+        if (wa_streq(freq->mode, "bigram")) det->want_bigrams = 1;
+    }
+    for (size_t i = 0; i < WA_LANGUAGE_CODES_COUNT; i++) {
+        const wa_frequency_list *freq = WA_LANGUAGES[i].frequency;
+        if (freq == NULL) continue;
+        size_t l = (size_t)(freq - WA_FREQUENCY_LISTS);
+        det->lane_prior[l] = PRIOR_WEIGHT * det->priors[i];
+        det->lane_bigram[l] = wa_streq(freq->mode, "bigram");
+    }
+
+    det->threads = 1;
+    det->top = (wa_ranked *)malloc(
+        sizeof(wa_ranked) * (det->candidate_count > 0 ? det->candidate_count : 1));
+    if (det->top == NULL) {
+        free(det);
+        return NULL;
+    }
+    return det;
+}
+
+void wa_detector_free(wa_detector *det) {
+    if (det == NULL) return;
+    token_set_free(&det->words);
+    key_set_free(&det->bigrams);
+    cp_set_free(&det->chars);
+    free(det->top);
+    wa_detector_set_threads(det, 1);
+    free(det);
+}
+
+void wa_detector_set_threads(wa_detector *det, size_t threads) {
+    if (det == NULL) return;
+    if (threads < 1) threads = 1;
+    if (threads > WA_MAX_THREADS) threads = WA_MAX_THREADS;
+    if (det->chunks != NULL && threads != det->threads) {
+        for (size_t i = 0; i < det->threads; i++) {
+            token_set_free(&det->chunks[i].words);
+            key_set_free(&det->chunks[i].bigrams);
+            cp_set_free(&det->chunks[i].chars);
+        }
+        free(det->chunks);
+        det->chunks = NULL;
+    }
+    if (threads == 1) {
+        free(det->partials);
+        det->partials = NULL;
+        det->partials_cap = 0;
+    }
+    det->threads = threads;
 }
 
-static int cmp_detect_result(const void *a, const void *b) {
-    const wa_detect_result *ra = (const wa_detect_result *)a;
-    const wa_detect_result *rb = (const wa_detect_result *)b;
-    if (ra->score < rb->score) return 1;
-    if (ra->score > rb->score) return -1;
-    return 0;
+static size_t score_block_count(const wa_detector *det) {
+    return (det->words.len + WA_SCORE_BLOCK - 1) / WA_SCORE_BLOCK +
+           (det->bigrams.len + WA_SCORE_BLOCK - 1) / WA_SCORE_BLOCK;
+}
+
+// Sums the token overlap of score block `b` into `partial`.
+static void score_block(const wa_detector *det, size_t b, double *partial) {
+    size_t word_blocks = (det->words.len + WA_SCORE_BLOCK - 1) / WA_SCORE_BLOCK;
+    memset(partial, 0, sizeof(double) * WA_SCORE_LANES);
+    if (b < word_blocks) {
+        size_t begin = b * WA_SCORE_BLOCK;
+        size_t end = begin + WA_SCORE_BLOCK < det->words.len ? begin + WA_SCORE_BLOCK
+                                                             : det->words.len;
+        accumulate_overlap(&WA_WORD_DICT, &det->words, begin, end, partial);
+    } else {
+        size_t begin = (b - word_blocks) * WA_SCORE_BLOCK;
+        size_t end = begin + WA_SCORE_BLOCK < det->bigrams.len ? begin + WA_SCORE_BLOCK
+                                                               : det->bigrams.len;
+        accumulate_bigram_overlap(&WA_BIGRAM_DICT, &det->bigrams, begin, end, partial);
+    }
+}
+
+static void add_block(double *list_scores, const double *partial) {
+    for (size_t l = 0; l < WA_SCORE_LANES; l++) list_scores[l] += partial[l];
+}
+
+#ifdef WA_HAVE_PTHREADS
+// Static fork/join: fn(ctx, i) runs for every i < count, item i on thread
+// i % threads with the calling thread as thread 0. Items of a thread that
+// cannot start run on the caller.
+typedef struct {
+    void (*fn)(void *ctx, size_t i);
+    void *ctx;
+    size_t first, step, count;
+} wa_fork_task;
+
+static void *fork_task_run(void *arg) {
+    const wa_fork_task *task = (const wa_fork_task *)arg;
+    for (size_t i = task->first; i < task->count; i += task->step) task->fn(task->ctx, i);
+    return NULL;
+}
+
+static void fork_join(size_t count, size_t threads, void (*fn)(void *, size_t), void *ctx) {
+    wa_fork_task tasks[WA_MAX_THREADS];
+    pthread_t ids[WA_MAX_THREADS];
+    int started[WA_MAX_THREADS];
+    if (threads > count) threads = count;
+    for (size_t t = 0; t < threads; t++) {
+        wa_fork_task task = { fn, ctx, t, threads, count };
+        tasks[t] = task;
+        started[t] = t > 0 && pthread_create(&ids[t], NULL, fork_task_run, &tasks[t]) == 0;
+    }
+    for (size_t t = 0; t < threads; t++) {
+        if (!started[t]) fork_task_run(&tasks[t]);
+    }
+    for (size_t t = 1; t < threads; t++) {
+        if (started[t]) pthread_join(ids[t], NULL);
+    }
+}
+
+static void scan_chunk_task(void *ctx, size_t i) {
+    wa_detector *det = (wa_detector *)ctx;
+    wa_scan_chunk *c = &det->chunks[i];
+    c->last = scan_text(c->text, c->len, WA_INPUT_UTF8, &c->words, &c->chars,
+                        det->want_bigrams ? &c->bigrams : NULL);
+}
+
+// Parallel scan: cut the text before ASCII non-letter bytes, which never
+// sit inside a UTF-8 sequence (even a malformed one) and always end a word,
+// so no word or codepoint straddles two chunks. Chunks are scanned on their
+// own threads, then their unique sets are merged in chunk order, which
+// reproduces the sequential first-seen order, and the letter bigram across
+// each cut is added where the sequential scan would meet it. Returns 0 when
+// the text is too short to split; the caller then scans it sequentially.
+static int detector_scan_parallel(wa_detector *det, const char *text, size_t len) {
+    size_t count = len / WA_PARALLEL_MIN_CHUNK;
+    if (count > det->threads) count = det->threads;
+    if (count < 2) return 0;
+    if (det->chunks == NULL) {
+        det->chunks = (wa_scan_chunk *)calloc(det->threads, sizeof(wa_scan_chunk));
+        if (det->chunks == NULL) return 0;
+    }
+
+    size_t start = 0;
+    for (size_t i = 0; i < count; i++) {
+        size_t end = i + 1 == count ? len : len / count * (i + 1);
+        if (end < start) end = start;
+        while (end < len) {
+            unsigned char b = (unsigned char)text[end];
+            if (b < 0x80 && !is_ascii_letter(b)) break;
+            end++;
+        }
+        det->chunks[i].text = text + start;
+        det->chunks[i].len = end - start;
+        start = end;
+    }
+    fork_join(count, count, scan_chunk_task, det);
+
+    size_t bytes = 0, tokens = 0, chars = 0, keys = 0;
+    for (size_t i = 0; i < count; i++) {
+        bytes += det->chunks[i].words.bytes_len;
+        tokens += det->chunks[i].words.len;
+        chars += det->chunks[i].chars.items.len;
+        keys += det->chunks[i].bigrams.len + 1;
+    }
+    if (!token_set_reserve(&det->words, bytes, tokens) || !cp_set_reserve(&det->chars, chars) ||
+        (det->want_bigrams && !key_set_reserve(&det->bigrams, keys))) {
+        token_set_clear(&det->words);
+        cp_set_clear(&det->chars);
+        key_set_clear(&det->bigrams);
+        return 1;
+    }
+    uint32_t prev = 0;
+    for (size_t i = 0; i < count; i++) {
+        const wa_scan_chunk *c = &det->chunks[i];
+        for (size_t k = 0; k < c->words.len; k++) {
+            const wa_token *t = &c->words.items[k];
+            size_t at = det->words.bytes_len;
+            memcpy(det->words.bytes + at, token_text(&c->words, t), t->len);
+            det->words.bytes_len += t->len;
+            token_insert(&det->words, at, t->len, t->hash);
+        }
+        for (size_t k = 0; k < c->chars.items.len; k++) {
+            cp_set_add(&det->chars, c->chars.items.items[k]);
+        }
+        if (det->want_bigrams && c->last != 0) {
+            // The chunk's first letter is the first member of its letter set
+            if (prev != 0) {
+                key_set_add(&det->bigrams, bigram_key(prev, c->chars.items.items[0]));
+            }
+            for (size_t k = 0; k < c->bigrams.len; k++) {
+                key_set_add(&det->bigrams, c->bigrams.items[k]);
+            }
+            prev = c->last;
+        }
+    }
+    return 1;
+}
+
+static void score_block_task(void *ctx, size_t b) {
+    wa_detector *det = (wa_detector *)ctx;
+    score_block(det, b, det->partials + b * WA_SCORE_LANES);
+}
+
+// Scores every block on the detector's threads; returns the partials, or
+// NULL (score sequentially) if there is a single block or no memory.
+static const double *detector_score_blocks(wa_detector *det) {
+    size_t blocks = score_block_count(det);
+    if (blocks < 2) return NULL;
+    if (blocks > det->partials_cap) {
+        double *partials =
+            (double *)realloc(det->partials, sizeof(double) * WA_SCORE_LANES * blocks);
+        if (partials == NULL) return NULL;
+        det->partials = partials;
+        det->partials_cap = blocks;
+    }
+    fork_join(blocks, det->threads, score_block_task, det);
+    return det->partials;
+}
+#endif
+
+// Scores every candidate for the analysed text and writes the best `cap`
+// into out, best first. `partials` holds the score blocks when they were
+// already computed in parallel, NULL to sum them here.
+static size_t detector_score(wa_detector *det, const double *partials,
+                             wa_detect_result *out, size_t cap) {
+    const wa_u32_array *chars = &det->chars.items;
+
+    // Word and bigram lists are disjoint, so one score per list suffices.
+    memset(det->list_scores, 0, sizeof(det->list_scores));
+    size_t blocks = score_block_count(det);
+    for (size_t b = 0; b < blocks; b++) {
+        if (partials != NULL) {
+            add_block(det->list_scores, partials + b * WA_SCORE_LANES);
+        } else {
+            score_block(det, b, det->block_scores);
+            add_block(det->list_scores, det->block_scores);
+        }
+    }
+
+    // Prefilter: a language none of the text's letters select has no token,
+    // alphabet or letter-frequency overlap to score, so only a prior can
+    // give it a result.
+    det->active = det->prior_langs;
+    for (size_t i = 0; i < chars->len; i++) {
+        lang_set_union(&det->active, cp_languages(chars->items[i]));
+    }
+
+    // Word scores for every list in one pass: overlap normalised by the
+    // text's token count, plus the prior; a hit needs > 0.05.
+    double word_div = det->words.len > 0 ? sqrt((double)det->words.len + 3.0) : 1.0;
+    double bigram_div =
+        det->bigrams.len > 0 ? sqrt((double)det->bigrams.len + 3.0) : 1.0;
+    for (size_t l = 0; l < WA_SCORE_LANES; l++) {
+        det->lane_div[l] = det->lane_bigram[l] ? bigram_div : word_div;
+    }
+    score_lanes(det->lane_prior, FREQ_WEIGHT, det->list_scores, det->lane_div, 0.05,
+                det->word_scores, det->word_hit);
+
+    // Character fallback: only candidates without a word hit need their
+    // alphabet overlap; the generator links each list to its alphabet.
+    int fallback = 0;
+    memset(det->lane_x, 0, sizeof(det->lane_x));
+    for (size_t i = 0; i < det->candidate_count && chars->len > 0; i++) {
+        if (!wa_lang_set_contains(&det->active, det->candidates[i])) continue;
+        const wa_frequency_list *freq = WA_LANGUAGES[det->candidates[i]].frequency;
+        size_t l = (size_t)(freq - WA_FREQUENCY_LISTS);
+        if (det->word_hit[l] || freq->alphabet == NULL) continue;
+        if (!fallback) {
+            text_bitmap_build(&det->text_bitmap, chars);
+            fallback = 1;
+        }
+        double c_overlap = character_overlap(&det->text_bitmap, chars->len, freq->alphabet);
+        double f_overlap = frequency_overlap(chars, freq->alphabet);
+        det->lane_x[l] = c_overlap * 0.6 + f_overlap * 0.4;
+    }
+    if (fallback) {
+        score_lanes(det->lane_prior, CHAR_WEIGHT, det->lane_x, NULL, 0.02,
+                    det->char_scores, det->char_hit);
+    }
+
+    size_t top_len = 0;
+    if (cap > det->candidate_count) cap = det->candidate_count;
+    for (size_t i = 0; i < det->candidate_count; i++) {
+        if (!wa_lang_set_contains(&det->active, det->candidates[i])) continue;
+        const wa_frequency_list *freq = WA_LANGUAGES[det->candidates[i]].frequency;
+        size_t l = (size_t)(freq - WA_FREQUENCY_LISTS);
+        if (det->word_hit[l]) {
+            // boost word-based hits
+            heap_offer(det->top, &top_len, cap, det->word_scores[l] + 0.15, (uint32_t)i);
+        } else if (fallback && freq->alphabet != NULL && det->char_hit[l]) {
+            heap_offer(det->top, &top_len, cap, det->char_scores[l], (uint32_t)i);
+        }
+    }
+
+    heap_sort(det->top, top_len);
+    for (size_t k = 0; k < top_len; k++) {
+        out[k].language = WA_LANGUAGES[det->candidates[det->top[k].seq]].frequency->language;
+        out[k].score = det->top[k].score;
+    }
+    return top_len;
+}
+
+// Runs the detector over `len` units of text in encoding `enc`.
+static size_t detector_run(wa_detector *det, const void *text, size_t len, wa_input enc,
+                           wa_detect_result *out, size_t cap) {
+    if (det == NULL || text == NULL || len == 0 || out == NULL || cap == 0) return 0;
+
+    // Bigrams are only built when some candidate list is scored on them
+    if (!det->want_bigrams) key_set_clear(&det->bigrams);
+    const double *partials = NULL;
+    int scanned = 0;
+#ifdef WA_HAVE_PTHREADS
+    if (enc == WA_INPUT_UTF8 && det->threads > 1 &&
+        detector_scan_parallel(det, (const char *)text, len)) {
+        scanned = 1;
+        partials = detector_score_blocks(det);
+    }
+#endif
+    if (!scanned) {
+        scan_text(text, len, enc, &det->words, &det->chars,
+                  det->want_bigrams ? &det->bigrams : NULL);
+    }
+
+    return detector_score(det, partials, out, cap);
+}
+
+size_t wa_detector_run(wa_detector *det, const char *text, size_t len,
+                       wa_detect_result *out, size_t cap) {
+    return detector_run(det, text, len, WA_INPUT_UTF8, out, cap);
+}
+
+size_t wa_detector_run_utf16(wa_detector *det, const uint16_t *text, size_t len,
+                             wa_detect_result *out, size_t cap) {
+    return detector_run(det, text, len, WA_INPUT_UTF16, out, cap);
+}
+
+size_t wa_detector_run_latin1(wa_detector *det, const char *text, size_t len,
+                              wa_detect_result *out, size_t cap) {
+    return detector_run(det, text, len, WA_INPUT_LATIN1, out, cap);
+}
+
+// Streaming detection: chunks are scanned into the detector's sets as they
+// arrive, which grow with the unique tokens rather than the text. The open
+// word stays at the arena end between chunks and an incomplete UTF-8
+// sequence at a chunk end is held back in `carry`, so any chunking scans
+// exactly like the whole text.
+struct wa_detect_stream {
+    wa_detector *det;
+    wa_scan_state state;
+    char carry[4];
+    size_t carry_len;
+    size_t fed; // bytes so far; an empty text has no results
+};
+
+wa_detect_stream *wa_detect_stream_begin(wa_detector *det) {
+    if (det == NULL) return NULL;
+    wa_detect_stream *stream = (wa_detect_stream *)calloc(1, sizeof(wa_detect_stream));
+    if (stream == NULL) return NULL;
+    stream->det = det;
+    token_set_clear(&det->words);
+    cp_set_clear(&det->chars);
+    key_set_clear(&det->bigrams);
+    scan_state_init(&stream->state, &det->words);
+    return stream;
+}
+
+int wa_detect_stream_feed(wa_detect_stream *stream, const char *chunk, size_t len) {
+    if (stream == NULL || (chunk == NULL && len > 0)) return 0;
+    if (len == 0) return 1;
+    wa_detector *det = stream->det;
+    wa_key_set *bigrams = det->want_bigrams ? &det->bigrams : NULL;
+    // Room for this chunk plus the held-back sequence (see scan_piece)
+    size_t more = len + sizeof(stream->carry);
+    if (!token_set_grow(&det->words, det->words.bytes_len + more,
+                        det->words.len + more / 2 + 1) ||
+        !cp_set_grow(&det->chars, det->chars.items.len + more) ||
+        (bigrams != NULL && !key_set_grow(bigrams, bigrams->len + more))) {
+        return 0;
+    }
+    stream->fed += len;
+
+    size_t idx = 0;
+    if (stream->carry_len > 0) {
+        // Complete the held-back sequence with the chunk's first bytes
+        size_t have = stream->carry_len;
+        size_t take = sizeof(stream->carry) - have < len ? sizeof(stream->carry) - have : len;
+        memcpy(stream->carry + have, chunk, take);
+        if (utf8_partial_tail(stream->carry, have + take) == have + take) {
+            stream->carry_len = have + take;
+            return 1;
+        }
+        size_t used = 0;
+        uint32_t cp = utf8_decode(stream->carry, have + take, &used);
+        scan_cp(&det->words, &det->chars, bigrams, &stream->state, ascii_lower(cp));
+        idx = used - have; // a valid prefix never fails inside the carried bytes
+        stream->carry_len = 0;
+    }
+    size_t tail = utf8_partial_tail(chunk + idx, len - idx);
+    scan_piece(chunk + idx, len - idx - tail, WA_INPUT_UTF8, &det->words, &det->chars, bigrams,
+               &stream->state);
+    memcpy(stream->carry, chunk + len - tail, tail);
+    stream->carry_len = tail;
+    return 1;
+}
+
+size_t wa_detect_stream_peek(wa_detect_stream *stream, wa_detect_result *out, size_t cap) {
+    if (stream == NULL || stream->fed == 0 || out == NULL || cap == 0) return 0;
+    return detector_score(stream->det, NULL, out, cap);
+}
+
+size_t wa_detect_stream_finish(wa_detect_stream *stream, wa_detect_result *out, size_t cap) {
+    if (stream == NULL) return 0;
+    wa_detector *det = stream->det;
+    // A sequence still incomplete at the end is malformed: it ends the word
+    if (stream->carry_len > 0) {
+        scan_cp(&det->words, &det->chars, det->want_bigrams ? &det->bigrams : NULL,
+                &stream->state, WA_CP_INVALID);
+    }
+    scan_word_end(&det->words, &stream->state);
+    size_t fed = stream->fed;
+    free(stream);
+    if (fed == 0 || out == NULL || cap == 0) return 0;
+    return detector_score(det, NULL, out, cap);
+}
+
+// Result slots a run needs: every candidate, or fewer when topk asks so.
+static size_t detector_cap(const wa_detector *det, size_t topk) {
+    size_t cap = det->candidate_count > 0 ? det->candidate_count : 1;
+    if (topk > 0 && topk < cap) cap = topk;
+    return cap;
 }
 
 wa_detect_result_array wa_detect_languages(const char *text,
@@ -431,83 +1822,232 @@ wa_detect_result_array wa_detect_languages(const char *text,
                                            const wa_prior *priors,
                                            size_t prior_count,
                                            size_t topk) {
+    size_t len = text == NULL ? 0 : strlen(text);
+    return wa_detect_languages_n(text, len, candidate_langs, candidate_count,
+                                 priors, prior_count, topk);
+}
+
+// One-shot detection over `len` units of text in encoding `enc`.
+static wa_detect_result_array detect_languages(const void *text, size_t len, wa_input enc,
+                                               const char **candidate_langs,
+                                               size_t candidate_count,
+                                               const wa_prior *priors,
+                                               size_t prior_count,
+                                               size_t topk) {
     wa_detect_result_array results = { .items = NULL, .len = 0 };
-    if (text == NULL || *text == '\0') return results;
+    if (text == NULL || len == 0) return results;
+
+    wa_detector *det = wa_detector_create(candidate_langs, candidate_count,
+                                          priors, prior_count);
+    if (det == NULL) return results;
+    size_t cap = detector_cap(det, topk);
+    results.items = (wa_detect_result *)malloc(sizeof(wa_detect_result) * cap);
+    if (results.items != NULL) {
+        results.len = detector_run(det, text, len, enc, results.items, cap);
+    }
+    wa_detector_free(det);
+    return results;
+}
 
-    wa_string_array word_tokens;
-    tokenize_words(text, &word_tokens);
-    wa_u32_array chars;
-    wa_u32_array codepoints;
-    collect_characters(text, &chars, &codepoints);
-    wa_string_array bigram_tokens;
-    tokenize_bigrams(&codepoints, &bigram_tokens);
+wa_detect_result_array wa_detect_languages_n(const char *text, size_t len,
+                                             const char **candidate_langs,
+                                             size_t candidate_count,
+                                             const wa_prior *priors,
+                                             size_t prior_count,
+                                             size_t topk) {
+    return detect_languages(text, len, WA_INPUT_UTF8, candidate_langs, candidate_count,
+                            priors, prior_count, topk);
+}
 
-    // If no candidates provided, use all languages with frequency lists.
-    const wa_frequency_list *candidate_ptrs[WA_FREQUENCY_LISTS_COUNT];
-    const wa_frequency_list **candidates = candidate_ptrs;
-    size_t candidates_len = 0;
-    if (candidate_count > 0) {
-        for (size_t i = 0; i < candidate_count; i++) {
-            const wa_frequency_list *entry = find_freq_list(candidate_langs[i]);
-            if (entry) {
-                candidate_ptrs[candidates_len++] = entry;
-            }
-        }
-    } else {
-        for (size_t i = 0; i < WA_FREQUENCY_LISTS_COUNT; i++) {
-            candidate_ptrs[candidates_len++] = &WA_FREQUENCY_LISTS[i];
-        }
-    }
-
-    wa_detect_result *tmp = (wa_detect_result *)malloc(
-        sizeof(wa_detect_result) * candidates_len);
-    size_t tmp_len = 0;
-    for (size_t i = 0; i < candidates_len; i++) {
-        const wa_frequency_list *freq = candidates[i];
-        const wa_string_array *tokens =
-            wa_streq(freq->mode, "bigram") ? &bigram_tokens : &word_tokens;
-        double word_overlap = overlap_tokens(tokens, freq);
-        if (tokens->len > 0) {
-            word_overlap /= sqrt((double)tokens->len + 3.0);
-        }
-        double prior = prior_for(priors, prior_count, freq->language);
-        double word_score = PRIOR_WEIGHT * prior + FREQ_WEIGHT * word_overlap;
-        if (word_score > 0.05) {
-            tmp[tmp_len].language = freq->language;
-            tmp[tmp_len].score = word_score + 0.15; // boost word-based hits
-            tmp_len++;
-            continue;
-        }
-
-        const wa_alphabet *alpha = wa_load_alphabet(freq->language, NULL);
-        if (alpha && chars.len > 0) {
-            double c_overlap = character_overlap(&chars, alpha);
-            double f_overlap = frequency_overlap(&chars, alpha);
-            double char_score = c_overlap * 0.6 + f_overlap * 0.4;
-            double final_score = PRIOR_WEIGHT * prior + CHAR_WEIGHT * char_score;
-            if (final_score > 0.02) {
-                tmp[tmp_len].language = freq->language;
-                tmp[tmp_len].score = final_score;
-                tmp_len++;
-            }
-        }
+wa_detect_result_array wa_detect_languages_utf16(const uint16_t *text, size_t len,
+                                                 const char **candidate_langs,
+                                                 size_t candidate_count,
+                                                 const wa_prior *priors,
+                                                 size_t prior_count,
+                                                 size_t topk) {
+    return detect_languages(text, len, WA_INPUT_UTF16, candidate_langs, candidate_count,
+                            priors, prior_count, topk);
+}
+
+wa_detect_result_array wa_detect_languages_latin1(const char *text, size_t len,
+                                                  const char **candidate_langs,
+                                                  size_t candidate_count,
+                                                  const wa_prior *priors,
+                                                  size_t prior_count,
+                                                  size_t topk) {
+    return detect_languages(text, len, WA_INPUT_LATIN1, candidate_langs, candidate_count,
+                            priors, prior_count, topk);
+}
+
+// One batch: inputs, options and the output slots. Each text writes only
+// its own slots, so workers never share output memory.
+typedef struct {
+    const char *const *texts;
+    const size_t *lens;
+    const wa_detect_config *config;
+    wa_detect_result *items;
+    size_t *counts;
+    size_t stride;
+} wa_batch_job;
+
+static void batch_detect(wa_detector *det, const wa_batch_job *job, size_t i) {
+    const char *text = job->texts[i];
+    size_t len = text == NULL ? 0 : (job->lens != NULL ? job->lens[i] : strlen(text));
+    job->counts[i] = wa_detector_run(det, text, len, job->items + i * job->stride,
+                                     job->stride);
+}
+
+#ifdef WA_HAVE_PTHREADS
+// Work-stealing pool: every worker owns a detector and a range of unclaimed
+// texts behind its own mutex. It takes texts from the front of its range;
+// once that is empty it steals the back half of another worker's range, so
+// skewed text lengths still keep every core busy. Workers exit when no range
+// has texts left.
+typedef struct wa_batch_pool wa_batch_pool;
+
+typedef struct {
+    pthread_mutex_t lock;
+    size_t next, end; // unclaimed texts [next, end)
+    wa_batch_pool *pool;
+    size_t index;
+    pthread_t thread;
+    int started;
+} wa_batch_worker;
+
+struct wa_batch_pool {
+    const wa_batch_job *job;
+    wa_batch_worker *workers;
+    size_t count;
+};
+
+static int batch_claim(wa_batch_worker *self, size_t *item) {
+    pthread_mutex_lock(&self->lock);
+    int ok = self->next < self->end;
+    if (ok) *item = self->next++;
+    pthread_mutex_unlock(&self->lock);
+    if (ok) return 1;
+
+    wa_batch_pool *pool = self->pool;
+    for (size_t k = 1; k < pool->count; k++) {
+        wa_batch_worker *victim = &pool->workers[(self->index + k) % pool->count];
+        pthread_mutex_lock(&victim->lock);
+        size_t left = victim->end - victim->next;
+        size_t begin = victim->end - (left + 1) / 2, end = victim->end;
+        victim->end = begin;
+        pthread_mutex_unlock(&victim->lock);
+        if (begin == end) continue;
+
+        *item = begin;
+        pthread_mutex_lock(&self->lock);
+        self->next = begin + 1;
+        self->end = end;
+        pthread_mutex_unlock(&self->lock);
+        return 1;
     }
+    return 0;
+}
 
-    free_tokens(&word_tokens);
-    free_tokens(&bigram_tokens);
-    free(chars.items);
-    free(codepoints.items);
+// A worker whose detector cannot be created claims nothing; the others
+// steal its range.
+static void batch_work(wa_batch_worker *self, wa_detector *det) {
+    const wa_batch_job *job = self->pool->job;
+    size_t item;
+    while (batch_claim(self, &item)) batch_detect(det, job, item);
+}
 
-    if (tmp_len > 1) {
-        qsort(tmp, tmp_len, sizeof(wa_detect_result), cmp_detect_result);
+static void *batch_thread(void *arg) {
+    wa_batch_worker *self = (wa_batch_worker *)arg;
+    const wa_detect_config *config = self->pool->job->config;
+    wa_detector *det = wa_detector_create(config->candidate_langs, config->candidate_count,
+                                          config->priors, config->prior_count);
+    if (det != NULL) {
+        batch_work(self, det);
+        wa_detector_free(det);
     }
-    if (topk > 0 && tmp_len > topk) {
-        tmp_len = topk;
+    return NULL;
+}
+
+// Runs the batch on `threads` workers, the calling thread being the first.
+// Returns 0 if the pool cannot be set up; nothing has run in that case.
+static int batch_run_parallel(const wa_batch_job *job, wa_detector *det, size_t n,
+                              size_t threads) {
+    wa_batch_pool pool = { job, NULL, threads };
+    pool.workers = (wa_batch_worker *)calloc(threads, sizeof(wa_batch_worker));
+    if (pool.workers == NULL) return 0;
+    size_t inited = 0;
+    for (; inited < threads; inited++) {
+        wa_batch_worker *w = &pool.workers[inited];
+        if (pthread_mutex_init(&w->lock, NULL) != 0) break;
+        w->next = n * inited / threads;
+        w->end = n * (inited + 1) / threads;
+        w->pool = &pool;
+        w->index = inited;
+    }
+    if (inited == threads) {
+        // Threads that fail to start leave their range to be stolen
+        for (size_t i = 1; i < threads; i++) {
+            wa_batch_worker *w = &pool.workers[i];
+            w->started = pthread_create(&w->thread, NULL, batch_thread, w) == 0;
+        }
+        batch_work(&pool.workers[0], det);
+        for (size_t i = 1; i < threads; i++) {
+            if (pool.workers[i].started) pthread_join(pool.workers[i].thread, NULL);
+        }
+    }
+    for (size_t i = 0; i < inited; i++) pthread_mutex_destroy(&pool.workers[i].lock);
+    free(pool.workers);
+    return inited == threads;
+}
+#endif
+
+size_t wa_detect_languages_batch(const char *const *texts, const size_t *lens, size_t n,
+                                 const wa_detect_config *config,
+                                 wa_detect_batch_result *out_results) {
+    static const wa_detect_config defaults = { NULL, 0, NULL, 0, 0, 0 };
+    if (out_results == NULL) return 0;
+    memset(out_results, 0, sizeof(*out_results));
+    if (texts == NULL || n == 0) return 0;
+    if (config == NULL) config = &defaults;
+
+    wa_detector *det = wa_detector_create(config->candidate_langs, config->candidate_count,
+                                          config->priors, config->prior_count);
+    if (det == NULL) return 0;
+    size_t stride = detector_cap(det, config->topk);
+    wa_detect_result *items = NULL;
+    size_t *counts = NULL;
+    if (n <= SIZE_MAX / sizeof(wa_detect_result) / stride) {
+        items = (wa_detect_result *)malloc(sizeof(wa_detect_result) * n * stride);
+        counts = (size_t *)malloc(sizeof(size_t) * n);
+    }
+    if (items == NULL || counts == NULL) {
+        free(items);
+        free(counts);
+        wa_detector_free(det);
+        return 0;
     }
 
-    results.items = tmp;
-    results.len = tmp_len;
-    return results;
+    wa_batch_job job = { texts, lens, config, items, counts, stride };
+    int done = 0;
+#ifdef WA_HAVE_PTHREADS
+    size_t threads = config->threads < n ? config->threads : n;
+    if (threads > WA_MAX_THREADS) threads = WA_MAX_THREADS;
+    if (threads > 1) done = batch_run_parallel(&job, det, n, threads);
+#endif
+    for (size_t i = 0; !done && i < n; i++) batch_detect(det, &job, i);
+    wa_detector_free(det);
+
+    out_results->items = items;
+    out_results->counts = counts;
+    out_results->len = n;
+    out_results->stride = stride;
+    return n;
+}
+
+void wa_free_detect_batch(wa_detect_batch_result *results) {
+    if (results == NULL) return;
+    free(results->items);
+    free(results->counts);
+    memset(results, 0, sizeof(*results));
 }
 
 void wa_free_detect_results(wa_detect_result_array *results) {
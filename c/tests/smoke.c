@@ -1,9 +1,63 @@
 #include <assert.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "../include/worldalphabets.h"
 
+// First codepoint of a (valid) UTF-8 string.
+static uint32_t first_cp(const char *s) {
+    const unsigned char *p = (const unsigned char *)s;
+    if (p[0] < 0x80) return p[0];
+    if (p[0] < 0xE0) return ((uint32_t)(p[0] & 0x1F) << 6) | (p[1] & 0x3F);
+    if (p[0] < 0xF0) {
+        return ((uint32_t)(p[0] & 0x0F) << 12) | ((uint32_t)(p[1] & 0x3F) << 6) | (p[2] & 0x3F);
+    }
+    return ((uint32_t)(p[0] & 0x07) << 18) | ((uint32_t)(p[1] & 0x3F) << 12) |
+           ((uint32_t)(p[2] & 0x3F) << 6) | (p[3] & 0x3F);
+}
+
+// Re-encode a valid UTF-8 string as UTF-16 code units; returns their count.
+static size_t to_utf16(const char *s, size_t len, uint16_t *out) {
+    size_t n = 0;
+    for (size_t i = 0; i < len;) {
+        unsigned char c = (unsigned char)s[i];
+        uint32_t cp = first_cp(s + i);
+        i += c < 0x80 ? 1 : (c < 0xE0 ? 2 : (c < 0xF0 ? 3 : 4));
+        if (cp >= 0x10000) {
+            out[n++] = (uint16_t)(0xD800 + ((cp - 0x10000) >> 10));
+            out[n++] = (uint16_t)(0xDC00 + ((cp - 0x10000) & 0x3FF));
+        } else {
+            out[n++] = (uint16_t)cp;
+        }
+    }
+    return n;
+}
+
+static void assert_same_results(const wa_detect_result *a, size_t a_len,
+                                const wa_detect_result *b, size_t b_len) {
+    assert(a_len == b_len);
+    for (size_t i = 0; i < a_len; i++) {
+        assert(strcmp(a[i].language, b[i].language) == 0);
+        assert(a[i].score == b[i].score);
+    }
+}
+
+// Whether a UTF-8 string only holds codepoints below U+0100 (Latin-1).
+static int is_latin1(const char *s) {
+    for (const unsigned char *p = (const unsigned char *)s; *p; p++) {
+        if (*p >= 0x80 && *p != 0xC2 && *p != 0xC3 && (*p & 0xC0) != 0x80) return 0;
+    }
+    return 1;
+}
+
+static int cps_contains(const uint32_t *cps, size_t len, uint32_t cp) {
+    for (size_t i = 0; i < len; i++) {
+        if (cps[i] == cp) return 1;
+    }
+    return 0;
+}
+
 int main(void) {
     printf("Testing C interface...\n");
 
@@ -40,19 +94,158 @@ int main(void) {
     // Test non-existent language returns NULL
     const wa_alphabet *bad_alpha = wa_load_alphabet("nonexistent", NULL);
     assert(bad_alpha == NULL);
+    // Codepoint arrays are sorted, distinct and cover every entry
+    assert(alpha->lowercase_cps_len <= alpha->lowercase_len);
+    for (size_t i = 1; i < alpha->lowercase_cps_len; i++) {
+        assert(alpha->lowercase_cps[i - 1] < alpha->lowercase_cps[i]);
+    }
+    for (size_t i = 0; i < alpha->lowercase_len; i++) {
+        assert(cps_contains(alpha->lowercase_cps, alpha->lowercase_cps_len,
+                            first_cp(alpha->lowercase[i])));
+    }
+    for (size_t i = 0; i < alpha->uppercase_len; i++) {
+        assert(cps_contains(alpha->uppercase_cps, alpha->uppercase_cps_len,
+                            first_cp(alpha->uppercase[i])));
+    }
+    for (size_t i = 0; i < alpha->digits_len; i++) {
+        assert(cps_contains(alpha->digits_cps, alpha->digits_cps_len,
+                            first_cp(alpha->digits[i])));
+    }
     printf("OK (%s)\n", test_lang);
 
+    // ========== wa_letter_frequency ==========
+    printf("  wa_letter_frequency... ");
+    size_t single = 0;
+    for (size_t i = 0; i < alpha->frequency_len; i++) {
+        const char *ch = alpha->frequency[i].ch;
+        uint32_t cp = first_cp(ch);
+        char one[5] = {0};
+        size_t ch_len = strlen(ch);
+        if (ch_len > 4) continue;
+        memcpy(one, ch, ch_len);
+        // Only keys that are exactly one codepoint are indexed
+        if ((cp < 0x80 && ch_len == 1) || (cp >= 0x80 && cp < 0x800 && ch_len == 2) ||
+            (cp >= 0x800 && cp < 0x10000 && ch_len == 3) || (cp >= 0x10000 && ch_len == 4)) {
+            assert(wa_letter_frequency(alpha, cp) == alpha->frequency[i].freq);
+            single++;
+        }
+    }
+    assert(single == alpha->frequency_cps_len);
+    for (size_t i = 1; i < alpha->frequency_cps_len; i++) {
+        assert(alpha->frequency_cps[i - 1].cp < alpha->frequency_cps[i].cp);
+    }
+    assert(wa_letter_frequency(alpha, 0x10FFFF) == 0.0);
+    assert(wa_letter_frequency(NULL, 'a') == 0.0);
+    printf("OK\n");
+
+    // ========== wa_alphabet_contains ==========
+    printf("  wa_alphabet_contains... ");
+    // The bitmap must agree with the codepoint arrays everywhere
+    for (uint32_t cp = 0; cp < 0x30000; cp++) {
+        int letter = cps_contains(alpha->lowercase_cps, alpha->lowercase_cps_len, cp) ||
+                     cps_contains(alpha->uppercase_cps, alpha->uppercase_cps_len, cp);
+        assert(wa_alphabet_contains(alpha, cp) == letter);
+    }
+    assert(wa_alphabet_contains(alpha, 0x110000) == 0);
+    assert(wa_alphabet_contains(NULL, 'a') == 0);
+    wa_alphabet copy = *alpha;
+    assert(wa_alphabet_contains(&copy, alpha->lowercase_cps[0]) == 0);
+    printf("OK\n");
+
     // ========== wa_load_frequency_list ==========
     printf("  wa_load_frequency_list... ");
     // freq already loaded above when finding test_lang
     assert(freq != NULL);
     assert(freq->token_count > 0);
     assert(strcmp(freq->language, test_lang) == 0);
+    assert(freq->alphabet == wa_load_alphabet(test_lang, NULL));
     // Test non-existent returns NULL
     const wa_frequency_list *bad_freq = wa_load_frequency_list("zzz");
     assert(bad_freq == NULL);
     printf("OK (%zu tokens)\n", freq->token_count);
 
+    // ========== wa_word_rank ==========
+    printf("  wa_word_rank... ");
+    for (size_t i = 0; i < freq->token_count; i++) {
+        const char *tok = freq->tokens[i];
+        int rank = wa_word_rank(freq, tok, strlen(tok));
+        assert(rank >= 0 && strcmp(freq->tokens[rank], tok) == 0);
+    }
+    char unterminated[64];
+    size_t first_len = strlen(freq->tokens[0]);
+    assert(first_len < sizeof(unterminated));
+    memcpy(unterminated, freq->tokens[0], first_len);
+    memset(unterminated + first_len, 'x', sizeof(unterminated) - first_len);
+    assert(wa_word_rank(freq, unterminated, first_len) == 0);
+    assert(wa_word_rank(freq, "zzzzzzzzzz", 10) == -1);
+    assert(wa_word_rank(NULL, "a", 1) == -1);
+    printf("OK\n");
+
+    // ========== language handles ==========
+    printf("  wa_lang_resolve... ");
+    assert(wa_lang_count() == codes.len);
+    wa_lang_id test_id = wa_lang_resolve(test_lang);
+    assert(test_id != WA_LANG_NONE);
+    assert(strcmp(wa_lang_code(test_id), test_lang) == 0);
+    assert(wa_lang_alphabet(test_id) == alpha);
+    assert(wa_lang_frequency_list(test_id) == freq);
+    assert(wa_lang_scripts(test_id).len == scripts.len);
+    for (size_t i = 0; i < wa_lang_layout_count(test_id); i++) {
+        assert(wa_lang_layout(test_id, i) != NULL);
+    }
+    assert(wa_lang_layout(test_id, wa_lang_layout_count(test_id)) == NULL);
+    assert(wa_lang_resolve("nonexistent") == WA_LANG_NONE);
+    assert(wa_lang_alphabet(WA_LANG_NONE) == NULL);
+    assert(wa_lang_code((wa_lang_id)codes.len) == NULL);
+    printf("OK (%s = %d)\n", test_lang, (int)test_id);
+
+    // ========== wa_script_of / wa_detect_script ==========
+    printf("  wa_script_of... ");
+    assert(strcmp(wa_script_of('a'), "Latn") == 0);
+    assert(strcmp(wa_script_of(0x044F), "Cyrl") == 0);  // я
+    assert(strcmp(wa_script_of(0x4E2D), "Hani") == 0);  // 中
+    assert(strcmp(wa_script_of(0x3042), "Hira") == 0);  // あ
+    assert(strcmp(wa_script_of('1'), "Zyyy") == 0);
+    assert(strcmp(wa_script_of(0x0301), "Zinh") == 0);  // combining acute
+    assert(strcmp(wa_script_of(0xD800), "Zzzz") == 0);
+    assert(wa_script_of(0x110000) == NULL);
+    // Every alphabet letter belongs to its alphabet's script (or a shared one)
+    for (size_t i = 0; i < alpha->lowercase_cps_len; i++) {
+        const char *sc = wa_script_of(alpha->lowercase_cps[i]);
+        assert(sc != NULL && strcmp(sc, "Zzzz") != 0);
+    }
+    wa_script_count script_counts[4];
+    const char *mixed = "Hello, \xD0\xBC\xD0\xB8\xD1\x80! 42 long latin run of text \xFF";
+    size_t script_n = wa_detect_script(mixed, strlen(mixed), script_counts, 4);
+    assert(script_n == 2);
+    assert(strcmp(script_counts[0].script, "Latn") == 0 && script_counts[0].count == 23);
+    assert(strcmp(script_counts[1].script, "Cyrl") == 0 && script_counts[1].count == 3);
+    script_n = wa_detect_script(mixed, strlen(mixed), script_counts, 1);
+    assert(script_n == 1);
+    assert(strcmp(script_counts[0].script, "Latn") == 0);
+    script_n = wa_detect_script("123 !?", 6, script_counts, 4);
+    assert(script_n == 0);
+    printf("OK\n");
+
+    // ========== wa_languages_for_codepoint ==========
+    printf("  wa_languages_for_codepoint... ");
+    wa_lang_set langs;
+    for (size_t i = 0; i < alpha->lowercase_cps_len; i++) {
+        size_t n = wa_languages_for_codepoint(alpha->lowercase_cps[i], &langs);
+        assert(n > 0 && wa_lang_set_contains(&langs, test_id));
+    }
+    for (size_t i = 0; i < freq->token_count; i++) {
+        wa_languages_for_codepoint(first_cp(freq->tokens[i]), &langs);
+        assert(wa_lang_set_contains(&langs, test_id));
+    }
+    size_t lang_n = wa_languages_for_codepoint(0x10FFFF, &langs);
+    assert(lang_n == 0);
+    assert(wa_lang_set_contains(&langs, test_id) == 0);
+    lang_n = wa_languages_for_codepoint(alpha->lowercase_cps[0], NULL);
+    assert(lang_n > 0);
+    assert(wa_lang_set_contains(&langs, WA_LANG_NONE) == 0);
+    printf("OK\n");
+
     // ========== wa_detect_languages ==========
     printf("  wa_detect_languages... ");
     // Use test_lang which we know has frequency data
@@ -66,10 +259,369 @@ int main(void) {
     }
     wa_detect_result_array res = wa_detect_languages(
         test_text, detect_candidates, 1, NULL, 0, 1);
-    // Detection may or may not succeed depending on data, just check API works
+    // Top tokens of the only candidate must clear the word-score threshold
+    // (bigram lists hold letter pairs, which joined tokens do not reproduce)
+    assert(res.len == 1);
+    assert(strcmp(res.items[0].language, test_lang) == 0);
+    if (strcmp(freq->mode, "word") == 0) assert(res.items[0].score > 0.15);
+    // Length-delimited input: an exact-size copy with no terminator, so a
+    // read past `len` shows up under sanitizers
+    size_t test_len = strlen(test_text);
+    char *slice = (char *)malloc(test_len);
+    assert(slice != NULL);
+    memcpy(slice, test_text, test_len);
+    wa_detect_result_array sliced =
+        wa_detect_languages_n(slice, test_len, detect_candidates, 1, NULL, 0, 1);
+    assert(sliced.len == 1 && strcmp(sliced.items[0].language, test_lang) == 0);
+    assert(sliced.items[0].score == res.items[0].score);
+    wa_free_detect_results(&sliced);
+    sliced = wa_detect_languages_n(slice, 0, NULL, 0, NULL, 0, 1);
+    assert(sliced.len == 0);
+    free(slice);
     wa_free_detect_results(&res);
     printf("OK\n");
 
+    // ========== wa_detector ==========
+    printf("  wa_detector... ");
+    wa_detect_result_array all = wa_detect_languages(test_text, NULL, 0, NULL, 0, 0);
+    wa_detector *det = wa_detector_create(NULL, 0, NULL, 0);
+    assert(det != NULL);
+    wa_detect_result out[8];
+    // A second text from further down the list, so rounds alternate inputs
+    char other_text[256] = "";
+    for (size_t i = 5; i < 10; i++) {
+        if (i > 5) strcat(other_text, " ");
+        strncat(other_text, freq->tokens[i % freq->token_count],
+                sizeof(other_text) - strlen(other_text) - 2);
+    }
+    // Reused scratch must give the same answers run after run
+    for (int round = 0; round < 3; round++) {
+        size_t n = wa_detector_run(det, other_text, strlen(other_text), out, 8);
+        assert(n > 0 && n <= 8);
+        n = wa_detector_run(det, test_text, strlen(test_text), out, 8);
+        assert(n == (all.len < 8 ? all.len : 8));
+        for (size_t i = 0; i < n; i++) {
+            assert(strcmp(out[i].language, all.items[i].language) == 0);
+            assert(out[i].score == all.items[i].score);
+        }
+    }
+    size_t got = wa_detector_run(det, test_text, strlen(test_text), out, 1);
+    assert(got == 1);
+    got = wa_detector_run(det, test_text, 0, out, 8);
+    assert(got == 0);
+    got = wa_detector_run(det, test_text, strlen(test_text), out, 0);
+    assert(got == 0);
+
+    // Malformed UTF-8 (stray continuation, overlong, surrogate, truncated
+    // tail) splits words exactly like whitespace does
+    wa_detect_result spaced[8];
+    const char *bad_seps[] = {"\x80", "\xC0\xAF", "\xED\xA0\x80", " "};
+    char clean[512] = "";
+    char broken[512] = "";
+    for (size_t i = 0; i < 8; i++) {
+        const char *tok = freq->tokens[i % freq->token_count];
+        if (strlen(tok) + 6 >= sizeof(broken) - strlen(broken)) break;
+        strcat(clean, tok);
+        strcat(clean, " ");
+        strcat(broken, tok);
+        strcat(broken, bad_seps[i % 4]);
+    }
+    strcat(broken, "\xE4\xB8");
+    size_t clean_n = wa_detector_run(det, clean, strlen(clean), spaced, 8);
+    size_t broken_n = wa_detector_run(det, broken, strlen(broken), out, 8);
+    assert(clean_n == broken_n && clean_n > 0);
+    for (size_t i = 0; i < clean_n; i++) {
+        assert(strcmp(out[i].language, spaced[i].language) == 0);
+        assert(out[i].score == spaced[i].score);
+    }
+    // A well-formed U+FFFD is a character, not a malformed sequence
+    char glued[256];
+    snprintf(glued, sizeof(glued), "%s\xEF\xBF\xBD%s", freq->tokens[0],
+             freq->tokens[1 % freq->token_count]);
+    char split[256];
+    snprintf(split, sizeof(split), "%s %s", freq->tokens[0], freq->tokens[1 % freq->token_count]);
+    size_t glued_n = wa_detector_run(det, glued, strlen(glued), out, 8);
+    size_t split_n = wa_detector_run(det, split, strlen(split), spaced, 8);
+    int same = glued_n == split_n;
+    for (size_t i = 0; same && i < glued_n; i++) {
+        same = strcmp(out[i].language, spaced[i].language) == 0 &&
+               out[i].score == spaced[i].score;
+    }
+    assert(!same);
+    wa_detector_free(det);
+    wa_free_detect_results(&all);
+
+    // The codepoint prefilter must keep languages that only have a prior
+    wa_prior prior_only[] = {{test_lang, 0.5}};
+    det = wa_detector_create(NULL, 0, prior_only, 1);
+    assert(det != NULL);
+    got = wa_detector_run(det, "\xE2\x98\x83", 3, out, 8);
+    assert(got == 1);
+    assert(strcmp(out[0].language, test_lang) == 0);
+    wa_detector_free(det);
+
+    // Top-k keeps the best results, and equal scores follow candidate order;
+    // the pair is test_lang and the next language with a frequency list
+    const char *tie_lang = NULL;
+    for (size_t i = 0; i < codes.len && tie_lang == NULL; i++) {
+        const wa_frequency_list *f = wa_load_frequency_list(codes.items[i]);
+        if (f != NULL && strcmp(codes.items[i], test_lang) != 0) tie_lang = codes.items[i];
+    }
+    if (tie_lang != NULL) {
+        const char *tied[] = {test_lang, tie_lang};
+        const char *tied_rev[] = {tie_lang, test_lang};
+        wa_prior tied_priors[] = {{test_lang, 0.5}, {tie_lang, 0.5}};
+        det = wa_detector_create(tied, 2, tied_priors, 2);
+        got = wa_detector_run(det, "\xE2\x98\x83", 3, out, 8);
+        assert(got == 2);
+        assert(out[0].score == out[1].score);
+        assert(strcmp(out[0].language, test_lang) == 0 &&
+               strcmp(out[1].language, tie_lang) == 0);
+        got = wa_detector_run(det, "\xE2\x98\x83", 3, out, 1);
+        assert(got == 1);
+        assert(strcmp(out[0].language, test_lang) == 0);
+        wa_detector_free(det);
+        det = wa_detector_create(tied_rev, 2, tied_priors, 2);
+        got = wa_detector_run(det, "\xE2\x98\x83", 3, out, 1);
+        assert(got == 1);
+        assert(strcmp(out[0].language, tie_lang) == 0);
+        wa_detector_free(det);
+    }
+    wa_detect_result_array top3 = wa_detect_languages(test_text, NULL, 0, NULL, 0, 3);
+    all = wa_detect_languages(test_text, NULL, 0, NULL, 0, 0);
+    assert(top3.len == (all.len < 3 ? all.len : 3));
+    for (size_t i = 0; i < top3.len; i++) {
+        assert(strcmp(top3.items[i].language, all.items[i].language) == 0);
+        assert(top3.items[i].score == all.items[i].score);
+    }
+    wa_free_detect_results(&top3);
+    wa_free_detect_results(&all);
+    printf("OK\n");
+
+    // ========== batch detection ==========
+    printf("  wa_detect_languages_batch... ");
+    const char *batch_texts[] = {other_text, NULL, test_text, "Привет мир", ""};
+    size_t freq_langs = 0;
+    for (size_t i = 0; i < codes.len; i++) {
+        if (wa_load_frequency_list(codes.items[i]) != NULL) freq_langs++;
+    }
+    wa_detect_config batch_config = {0};
+    batch_config.topk = 3;
+    wa_detect_batch_result batch = {0};
+    size_t batch_n = wa_detect_languages_batch(batch_texts, NULL, 5, &batch_config, &batch);
+    assert(batch_n == 5);
+    assert(batch.len == 5 && batch.stride == (freq_langs < 3 ? freq_langs : 3));
+    for (size_t i = 0; i < 5; i++) {
+        wa_detect_result_array one = wa_detect_languages(batch_texts[i], NULL, 0, NULL, 0, 3);
+        assert(batch.counts[i] == one.len);
+        for (size_t j = 0; j < one.len; j++) {
+            const wa_detect_result *r = &batch.items[i * batch.stride + j];
+            assert(strcmp(r->language, one.items[j].language) == 0);
+            assert(r->score == one.items[j].score);
+        }
+        wa_free_detect_results(&one);
+    }
+    wa_free_detect_batch(&batch);
+    assert(batch.items == NULL && batch.len == 0);
+    // Explicit lengths need no terminator
+    size_t batch_lens[] = {strlen(freq->tokens[5 % freq->token_count]), 0, 0, 6, 0};
+    batch_n = wa_detect_languages_batch(batch_texts, batch_lens, 5, NULL, &batch);
+    assert(batch_n == 5);
+    assert(batch.counts[0] > 0 && batch.counts[1] == 0 && batch.counts[2] == 0);
+    wa_free_detect_batch(&batch);
+    // A worker pool must give exactly the sequential results
+    enum { POOL_TEXTS = 64 };
+    const char *pool_texts[POOL_TEXTS];
+    for (size_t i = 0; i < POOL_TEXTS; i++) pool_texts[i] = batch_texts[i % 5];
+    pool_texts[7] = test_text;
+    wa_detect_batch_result serial = {0};
+    batch_config.threads = 1;
+    batch_n = wa_detect_languages_batch(pool_texts, NULL, POOL_TEXTS, &batch_config, &serial);
+    assert(batch_n == POOL_TEXTS);
+    batch_config.threads = 4;
+    batch_n = wa_detect_languages_batch(pool_texts, NULL, POOL_TEXTS, &batch_config, &batch);
+    assert(batch_n == POOL_TEXTS);
+    for (size_t i = 0; i < POOL_TEXTS; i++) {
+        assert(batch.counts[i] == serial.counts[i]);
+        for (size_t j = 0; j < serial.counts[i]; j++) {
+            const wa_detect_result *a = &batch.items[i * batch.stride + j];
+            const wa_detect_result *b = &serial.items[i * serial.stride + j];
+            assert(strcmp(a->language, b->language) == 0 && a->score == b->score);
+        }
+    }
+    wa_free_detect_batch(&batch);
+    wa_free_detect_batch(&serial);
+    printf("OK\n");
+
+    // ========== parallel detection ==========
+    printf("  wa_detector_set_threads... ");
+    // Large mixed text: Latin, Cyrillic and unspaced CJK runs, glued words
+    // and punctuation, so chunk cuts land next to multibyte letters. Only
+    // the lists present in this data build are used, test_lang's at least.
+    static char large[600 * 1024];
+    const char *mix[] = {"en", "fr", "ru", "ja", "zh", "de", "th"};
+    const wa_frequency_list *mix_lists[8];
+    size_t mix_n = 0;
+    for (size_t i = 0; i < 7; i++) {
+        const wa_frequency_list *f = wa_load_frequency_list(mix[i]);
+        if (f != NULL && f->token_count > 0) mix_lists[mix_n++] = f;
+    }
+    if (mix_n == 0) mix_lists[mix_n++] = freq;
+    size_t used = 0;
+    for (size_t k = 0;; k++) {
+        const wa_frequency_list *f = mix_lists[k % mix_n];
+        const char *tok = f->tokens[(k * 7) % f->token_count];
+        size_t tok_len = strlen(tok);
+        if (used + tok_len + 2 >= sizeof(large)) break;
+        memcpy(large + used, tok, tok_len);
+        used += tok_len;
+        if (k % 5 != 0) large[used++] = (k % 3) ? ' ' : ',';
+    }
+    wa_detector *seq = wa_detector_create(NULL, 0, NULL, 0);
+    wa_detector *par = wa_detector_create(NULL, 0, NULL, 0);
+    wa_detect_result seq_out[8];
+    size_t seq_n = wa_detector_run(seq, large, used, seq_out, 8);
+    assert(seq_n > 0);
+    for (size_t threads = 2; threads <= 5; threads += 3) {
+        wa_detector_set_threads(par, threads);
+        for (int round = 0; round < 2; round++) {
+            got = wa_detector_run(par, large, used, out, 8);
+            assert(got == seq_n);
+            for (size_t i = 0; i < seq_n; i++) {
+                assert(strcmp(out[i].language, seq_out[i].language) == 0);
+                assert(out[i].score == seq_out[i].score);
+            }
+        }
+    }
+    wa_detector_free(par);
+    printf("OK\n");
+
+    // ========== streaming detection ==========
+    printf("  wa_detect_stream... ");
+    // Chunks of any size, splitting words and UTF-8 sequences (valid and
+    // malformed), must add up to one run over the whole text. The first two
+    // texts come from test_lang's tokens, so they score in any data build;
+    // the third only mixes scripts and multibyte sequences.
+    const char *stream_texts[] = {
+        test_text, broken, "Привет мир, こんにちは世界 \xF0\x9F\x98\x80 ok \xE4\xB8"};
+    const size_t chunk_sizes[] = {1, 2, 3, 5, 64};
+    for (size_t t = 0; t < 3; t++) {
+        size_t text_len = strlen(stream_texts[t]);
+        wa_detect_result whole[8];
+        size_t whole_n = wa_detector_run(seq, stream_texts[t], text_len, whole, 8);
+        assert(whole_n > 0 || t == 2);
+        for (size_t c = 0; c < 5; c++) {
+            wa_detect_stream *stream = wa_detect_stream_begin(seq);
+            assert(stream != NULL);
+            for (size_t at = 0; at < text_len; at += chunk_sizes[c]) {
+                size_t n = text_len - at < chunk_sizes[c] ? text_len - at : chunk_sizes[c];
+                int fed = wa_detect_stream_feed(stream, stream_texts[t] + at, n);
+                assert(fed == 1);
+                got = wa_detect_stream_peek(stream, out, 8);
+                assert(got <= 8);
+            }
+            got = wa_detect_stream_finish(stream, out, 8);
+            assert(got == whole_n);
+            for (size_t i = 0; i < whole_n; i++) {
+                assert(strcmp(out[i].language, whole[i].language) == 0);
+                assert(out[i].score == whole[i].score);
+            }
+        }
+    }
+    wa_detect_stream *stream = wa_detect_stream_begin(seq);
+    for (size_t at = 0; at < used; at += 4093) {
+        size_t n = used - at < 4093 ? used - at : 4093;
+        int fed = wa_detect_stream_feed(stream, large + at, n);
+        assert(fed == 1);
+    }
+    got = wa_detect_stream_finish(stream, out, 8);
+    assert(got == seq_n);
+    for (size_t i = 0; i < seq_n; i++) {
+        assert(strcmp(out[i].language, seq_out[i].language) == 0);
+        assert(out[i].score == seq_out[i].score);
+    }
+    stream = wa_detect_stream_begin(seq);
+    got = wa_detect_stream_finish(stream, out, 8);
+    assert(got == 0);
+    printf("OK\n");
+
+    // ========== UTF-16 and Latin-1 input ==========
+    printf("  UTF-16 / Latin-1 detection... ");
+    // Each encoding must score exactly like the same text in UTF-8
+    static uint16_t units[sizeof(large)];
+    // Latin-1 text from frequency tokens that fit in it, those with letters
+    // past ASCII first (120 UTF-8 bytes, so it fits latin1[] below)
+    char latin_text[128] = "";
+    for (int pass = 0; pass < 2; pass++) {
+        for (size_t i = 0; i < codes.len; i++) {
+            const wa_frequency_list *f = wa_load_frequency_list(codes.items[i]);
+            for (size_t j = 0; f != NULL && j < f->token_count && j < 50; j++) {
+                const char *tok = f->tokens[j];
+                size_t tok_len = strlen(tok);
+                int ascii = 1;
+                for (size_t k = 0; k < tok_len; k++) ascii &= (unsigned char)tok[k] < 0x80;
+                if (!is_latin1(tok) || (pass == 0 && ascii)) continue;
+                if (strlen(latin_text) + tok_len + 2 > 120) continue;
+                strcat(latin_text, tok);
+                strcat(latin_text, ", ");
+            }
+        }
+    }
+    const char *encoded_texts[] = {test_text, latin_text, stream_texts[2]};
+    for (size_t t = 0; t < 3; t++) {
+        size_t text_len = strlen(encoded_texts[t]);
+        if (t == 2) text_len -= 2; // drop the truncated sequence
+        wa_detect_result_array utf8 =
+            wa_detect_languages_n(encoded_texts[t], text_len, NULL, 0, NULL, 0, 5);
+        size_t n16 = to_utf16(encoded_texts[t], text_len, units);
+        wa_detect_result_array utf16 = wa_detect_languages_utf16(units, n16, NULL, 0, NULL, 0, 5);
+        assert_same_results(utf16.items, utf16.len, utf8.items, utf8.len);
+        assert(utf8.len > 0 || t != 0);
+        wa_free_detect_results(&utf16);
+        if (t == 1) {
+            // Latin-1 bytes are the codepoints themselves
+            char latin1[128];
+            for (size_t i = 0; i < n16; i++) latin1[i] = (char)units[i];
+            wa_detect_result_array l1 = wa_detect_languages_latin1(latin1, n16, NULL, 0, NULL, 0, 5);
+            assert_same_results(l1.items, l1.len, utf8.items, utf8.len);
+            wa_free_detect_results(&l1);
+        }
+        wa_free_detect_results(&utf8);
+    }
+    size_t large16 = to_utf16(large, used, units);
+    got = wa_detector_run_utf16(seq, units, large16, out, 8);
+    assert(got == seq_n);
+    assert_same_results(out, seq_n, seq_out, seq_n);
+    // An unpaired surrogate splits words like malformed UTF-8 does
+    const char *plain = "Bonjour tout le monde et merci";
+    size_t plain16 = to_utf16(plain, strlen(plain), units);
+    size_t plain_n = wa_detector_run(seq, plain, strlen(plain), spaced, 8);
+    units[7] = 0xDC00;
+    got = wa_detector_run_utf16(seq, units, plain16, out, 8);
+    assert(got == plain_n);
+    assert_same_results(out, plain_n, spaced, plain_n);
+    wa_detector_free(seq);
+    printf("OK\n");
+
+    // ========== perfect hash lookups ==========
+    printf("  perfect hash lookups... ");
+    // Every code and (code, script) pair must resolve to its own entry
+    for (size_t i = 0; i < codes.len; i++) {
+        wa_string_array code_scripts = wa_get_scripts(codes.items[i]);
+        for (size_t j = 0; j < code_scripts.len; j++) {
+            const wa_alphabet *a = wa_load_alphabet(codes.items[i], code_scripts.items[j]);
+            if (a != NULL) {
+                assert(strcmp(a->language, codes.items[i]) == 0);
+                assert(strcmp(a->script, code_scripts.items[j]) == 0);
+            }
+        }
+        const wa_frequency_list *f = wa_load_frequency_list(codes.items[i]);
+        if (f != NULL) assert(strcmp(f->language, codes.items[i]) == 0);
+    }
+    assert(wa_load_alphabet(test_lang, "Zzzz") == NULL);
+    assert(wa_get_scripts("nonexistent").len == 0);
+    printf("OK\n");
+
     // ========== wa_get_available_layouts ==========
     printf("  wa_get_available_layouts... ");
     wa_string_array layouts = wa_get_available_layouts();
@@ -87,6 +639,10 @@ int main(void) {
     // Test non-existent returns NULL
     const wa_keyboard_layout *bad_kb = wa_load_keyboard("nonexistent-layout");
     assert(bad_kb == NULL);
+    for (size_t i = 0; i < layouts.len; i++) {
+        assert(wa_load_keyboard(layouts.items[i]) != NULL);
+        assert(strcmp(wa_load_keyboard(layouts.items[i])->id, layouts.items[i]) == 0);
+    }
     printf("OK (%s)\n", test_layout);
 
     // ========== wa_extract_layer ==========
@@ -49,11 +49,28 @@ Examples:
 
     # Compact build with packed strings
     python generate_c_library_data.py --max-tokens=200 --packed-strings
+
+Lookup Indexes:
+---------------
+Language codes, (language, script) pairs, frequency lists and layout IDs are
+indexed by minimal perfect hash tables built here (wa_data_index.c). The
+runtime hashes the key once, reads one displacement seed and lands on exactly
+one candidate entry, which it verifies with a single string compare. The hash
+constants are emitted into worldalphabets_data.h so the generator and the
+runtime in c/src cannot drift apart.
+
+Codepoint-keyed tables live in wa_data_bitmaps.c: per-alphabet two-level
+letter bitmaps, the codepoint -> languages index that detection uses to
+skip languages the input's letters cannot select, and a two-stage Unicode
+Script table built from the `regex` module's Unicode data (checked against
+SCRIPT_UNICODE_VERSION and SCRIPT_CODE_COUNT).
 """
 from __future__ import annotations
 
 import argparse
 import json
+import math
+import re
 import sys
 from dataclasses import dataclass
 from pathlib import Path
@@ -66,6 +83,31 @@ FREQ_DIR = DATA_DIR / "freq" / "top1000"
 LAYOUT_DIR = DATA_DIR / "layouts"
 OUT_DIR = ROOT / "c" / "generated"
 
+# Hash contract shared with c/src/worldalphabets.c: FNV-1a over the UTF-8
+# bytes (multi-part keys separated by a NUL byte), finished with the murmur3
+# fmix32 avalanche. Displacement seeds are multiplied by HASH_SEED_STEP.
+HASH_OFFSET = 0x811C9DC5
+HASH_PRIME = 0x01000193
+HASH_SEED_STEP = 0x9E3779B9
+MASK32 = 0xFFFFFFFF
+MPH_MAX_SEED = 0xFFFF
+LANG_SET_WORDS = 8  # mirrors WA_LANG_SET_WORDS in c/include/worldalphabets.h
+
+# The script table is taken from the `regex` module's Unicode data, which has
+# no public API and moves with the installed version. pyproject.toml pins
+# regex to the release these were checked against; bump the pin and these
+# together, after reviewing the new data.
+SCRIPT_UNICODE_VERSION = "17.0.0"
+SCRIPT_CODE_COUNT = 178  # Script values with codepoints, plus Zzzz
+# First codepoint each Unicode version assigned, with its script; the highest
+# assigned probe tells which version the regex data implements.
+SCRIPT_VERSION_PROBES = (
+    ("15.0.0", 0x11F00, "Kawi"),
+    ("15.1.0", 0x2EBF0, "Hani"),
+    ("16.0.0", 0x105C0, "Todr"),
+    ("17.0.0", 0x10940, "Sidt"),
+)
+
 # Import keyboard mappings from the runtime to avoid duplication.
 sys.path.insert(0, str(ROOT / "src"))
 from worldalphabets.keyboards.loader import (  # noqa: E402
@@ -108,6 +150,259 @@ def format_string_array(
     return "\n".join(lines)
 
 
+def format_int_array(
+    ctype: str, name: str, values: List[int], exported: bool = False
+) -> str:
+    """Format an integer array, 16 values per line (empty arrays get one 0)."""
+    prefix = "const" if exported else "static const"
+    lines = [f"{prefix} {ctype} {name}[] = {{"]
+    for i in range(0, len(values), 16):
+        lines.append("  " + ", ".join(str(v) for v in values[i : i + 16]) + ",")
+    if not values:
+        lines.append("  0,")
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def codepoint_set(entries: List[str]) -> List[int]:
+    """Sorted distinct first codepoints of alphabet entries."""
+    return sorted({ord(entry[0]) for entry in entries if entry})
+
+
+def letter_frequencies(frequency: Dict[str, float]) -> List[Tuple[int, float]]:
+    """Single-codepoint frequency keys as (codepoint, frequency), sorted."""
+    return sorted((ord(ch), float(val)) for ch, val in frequency.items() if len(ch) == 1)
+
+
+def format_alphabet_bitmaps(alphabets: List[dict]) -> str:
+    """Two-level codepoint bitmaps for every alphabet.
+
+    The code space is cut into 256-codepoint blocks of four 64-bit words.
+    Distinct blocks are stored once in WA_CP_BLOCKS (entry 0 is the empty
+    block) and shared by every alphabet using them; each alphabet keeps a
+    dense uint16 block index over the span of blocks it touches. Two bitmaps
+    are emitted per alphabet: all letters (uppercase and lowercase) for
+    wa_alphabet_contains, and lowercase only for detection.
+    """
+    blocks: List[Tuple[int, ...]] = [(0, 0, 0, 0)]
+    block_ids: Dict[Tuple[int, ...], int] = {blocks[0]: 0}
+    index_values: List[int] = []
+    tables: Dict[str, List[str]] = {"LETTERS": [], "LOWERCASE": []}
+
+    for alpha in alphabets:
+        lower = codepoint_set(alpha["lowercase"])
+        sets = {
+            "LETTERS": sorted(set(codepoint_set(alpha["uppercase"])) | set(lower)),
+            "LOWERCASE": lower,
+        }
+        for kind, cps in sets.items():
+            if not cps:
+                tables[kind].append("  { WA_ALPHABET_BLOCK_INDEX, 0u, 0u },")
+                continue
+            first, last = cps[0] >> 8, cps[-1] >> 8
+            words = [[0, 0, 0, 0] for _ in range(last - first + 1)]
+            for cp in cps:
+                words[(cp >> 8) - first][(cp >> 6) & 3] |= 1 << (cp & 63)
+            start = len(index_values)
+            for block in words:
+                key = tuple(block)
+                if key not in block_ids:
+                    block_ids[key] = len(blocks)
+                    blocks.append(key)
+                index_values.append(block_ids[key])
+            tables[kind].append(
+                f"  {{ WA_ALPHABET_BLOCK_INDEX + {start}, {first}u, {len(words)}u }},"
+            )
+    if len(blocks) > 0xFFFF:
+        raise ValueError("too many distinct codepoint blocks for 16-bit indexes")
+
+    lines = ["const uint64_t WA_CP_BLOCKS[][4] = {"]
+    for block in blocks:
+        lines.append("  { " + ", ".join(f"0x{w:016X}ull" for w in block) + " },")
+    lines.append("};")
+    lines.append("")
+    lines.append(format_int_array("uint16_t", "WA_ALPHABET_BLOCK_INDEX", index_values))
+    for kind, rows in tables.items():
+        lines.append("")
+        lines.append(f"const wa_cp_bitmap WA_ALPHABET_{kind}[] = {{")
+        lines.extend(rows)
+        lines.append("};")
+    return "\n".join(lines)
+
+
+def format_codepoint_languages(
+    language_codes: List[str],
+    alphabets: List[dict],
+    freq_lists: List[dict],
+    default_alphabet: Dict[str, int],
+) -> Tuple[str, int]:
+    """Codepoint -> languages inverted index, as (C source, range count).
+
+    Sorted codepoint ranges (WA_CP_LANG_RANGES, each running to the next
+    start) map to deduplicated language bitsets (WA_LANG_SETS, bit = language
+    index, set 0 = empty). A language is listed for a codepoint when it occurs
+    in data/char_index.json, in the first codepoints of any of its alphabets,
+    in any token of its frequency list, or among the lowercase letters and
+    single-codepoint frequency keys of that list's alphabet. The last three
+    cover everything detection can score, so the detector may skip every
+    language the text's letters do not select.
+    """
+    if len(language_codes) > LANG_SET_WORDS * 64:
+        raise ValueError("too many languages for wa_lang_set")
+    lang_ids = {lang: i for i, lang in enumerate(language_codes)}
+    langs_by_cp: Dict[int, Set[int]] = {}
+
+    def add(lang: str, cps: Iterable[int]) -> None:
+        lang_id = lang_ids.get(lang)
+        if lang_id is None:
+            return
+        for cp in cps:
+            langs_by_cp.setdefault(cp, set()).add(lang_id)
+
+    char_index_path = DATA_DIR / "char_index.json"
+    if char_index_path.exists():
+        char_index = load_json_dict(char_index_path)
+        for ch, langs in char_index.get("char_to_languages", {}).items():
+            if ch:
+                for lang in langs:
+                    add(lang, [ord(ch[0])])
+    for alpha in alphabets:
+        add(alpha["language"], codepoint_set(alpha["uppercase"] + alpha["lowercase"]))
+    for freq_entry in freq_lists:
+        lang = freq_entry["language"]
+        add(lang, {ord(c) for token in freq_entry["tokens"] for c in token})
+        a_idx = default_alphabet.get(lang)
+        if a_idx is not None:
+            alpha = alphabets[a_idx]
+            add(lang, codepoint_set(alpha["lowercase"]))
+            add(lang, [ord(k) for k in alpha["frequency"] if len(k) == 1])
+
+    set_ids: Dict[Tuple[int, ...], int] = {(): 0}
+    sets: List[Tuple[int, ...]] = [()]
+    ranges: List[Tuple[int, int]] = []
+    prev_cp, prev_set = -1, 0
+    for cp in sorted(langs_by_cp):
+        key = tuple(sorted(langs_by_cp[cp]))
+        if key not in set_ids:
+            set_ids[key] = len(sets)
+            sets.append(key)
+        set_id = set_ids[key]
+        if cp != prev_cp + 1 and prev_set != 0:
+            ranges.append((prev_cp + 1, 0))  # gap back to the empty set
+            prev_set = 0
+        if set_id != prev_set:
+            ranges.append((cp, set_id))
+            prev_set = set_id
+        prev_cp = cp
+    if prev_set != 0:
+        ranges.append((prev_cp + 1, 0))
+    if len(sets) > 0xFFFF:
+        raise ValueError("too many distinct language sets for 16-bit ids")
+
+    lines = [f"const uint64_t WA_LANG_SETS[][{LANG_SET_WORDS}] = {{"]
+    for members in sets:
+        words = [0] * LANG_SET_WORDS
+        for lang_id in members:
+            words[lang_id >> 6] |= 1 << (lang_id & 63)
+        lines.append("  { " + ", ".join(f"0x{w:X}ull" for w in words) + " },")
+    lines.append("};")
+    lines.append("")
+    lines.append("const wa_cp_lang_range WA_CP_LANG_RANGES[] = {")
+    for i in range(0, len(ranges), 6):
+        row = ranges[i : i + 6]
+        lines.append("  " + " ".join(f"{{0x{cp:X}u, {sid}}}," for cp, sid in row))
+    if not ranges:
+        lines.append("  {0u, 0},")
+    lines.append("};")
+    return "\n".join(lines), len(ranges)
+
+
+def build_script_table() -> Tuple[List[str], List[int]]:
+    """Unicode Script property of every codepoint, as (codes, per-cp index).
+
+    Codes are ISO 15924 (as in Scripts.txt, e.g. "Latn", "Hani", "Zyyy"),
+    sorted, and limited to scripts that have codepoints. The data comes from
+    the `regex` module (a dev dependency) and must match
+    SCRIPT_UNICODE_VERSION and SCRIPT_CODE_COUNT, or generation fails;
+    surrogates are reported as "Zzzz".
+    """
+    import regex
+
+    try:
+        from regex import _regex_core
+
+        script_values = _regex_core.PROPERTIES["SCRIPT"][1]
+    except (ImportError, AttributeError, KeyError, IndexError, TypeError) as exc:
+        raise RuntimeError(
+            f"regex {regex.__version__}: Script property table not found"
+        ) from exc
+
+    version = None
+    for probe_version, cp, code in SCRIPT_VERSION_PROBES:
+        try:
+            assigned = regex.match(rf"\p{{Script={code}}}", chr(cp)) is not None
+        except regex.error:  # script name unknown to this regex
+            assigned = False
+        if assigned:
+            version = probe_version
+    if version != SCRIPT_UNICODE_VERSION:
+        raise RuntimeError(
+            f"regex {regex.__version__} implements Unicode {version or '< 15.0'}, "
+            f"expected {SCRIPT_UNICODE_VERSION}; install the regex release pinned "
+            "in pyproject.toml, or review the new script data and update the pin, "
+            "SCRIPT_UNICODE_VERSION, SCRIPT_CODE_COUNT and the probes together"
+        )
+
+    # Every script value has a 4-letter alias; Q*** ones are private-use
+    # ISO codes that Unicode only keeps as aliases (Qaai, Qaac).
+    codes_by_value: Dict[int, str] = {}
+    for name, value in script_values.items():
+        if len(name) == 4 and not name.startswith("Q"):
+            codes_by_value[value] = name.title()
+
+    text = "".join(chr(cp) for cp in range(0x110000) if not 0xD800 <= cp < 0xE000)
+    spans: Dict[str, List[Tuple[int, int]]] = {}
+    for code in sorted(set(codes_by_value.values())):
+        found = [m.span() for m in regex.finditer(rf"\p{{Script={code}}}+", text)]
+        if found or code == "Zzzz":
+            spans[code] = found
+    codes = sorted(spans)
+    if len(codes) != SCRIPT_CODE_COUNT:
+        raise RuntimeError(
+            f"Unicode {version} script table has {len(codes)} scripts, "
+            f"expected {SCRIPT_CODE_COUNT}"
+        )
+    if len(codes) > 0xFF:
+        raise ValueError("too many scripts for 8-bit script indexes")
+
+    table = [codes.index("Zzzz")] * 0x110000
+    for idx, code in enumerate(codes):
+        for start, end in spans[code]:
+            for pos in range(start, end):
+                table[pos if pos < 0xD800 else pos + 0x800] = idx
+    return codes, table
+
+
+def format_script_table(codes: List[str], table: List[int]) -> str:
+    """Two-stage script lookup: WA_SCRIPT_STAGE1[cp >> 8] picks a 256-entry
+    block of WA_SCRIPT_STAGE2 (identical blocks are stored once) holding
+    WA_SCRIPT_CODES indexes."""
+    block_ids: Dict[Tuple[int, ...], int] = {}
+    stage1: List[int] = []
+    stage2: List[int] = []
+    for start in range(0, len(table), 256):
+        block = tuple(table[start : start + 256])
+        if block not in block_ids:
+            block_ids[block] = len(block_ids)
+            stage2.extend(block)
+        stage1.append(block_ids[block])
+    lines = [format_string_array("WA_SCRIPT_CODES", codes, exported=True), ""]
+    lines.append(format_int_array("uint16_t", "WA_SCRIPT_STAGE1", stage1, exported=True))
+    lines.append("")
+    lines.append(format_int_array("uint8_t", "WA_SCRIPT_STAGE2", stage2, exported=True))
+    return "\n".join(lines)
+
+
 def format_packed_strings(
     name: str, values: List[str], exported: bool = False
 ) -> List[str]:
@@ -155,6 +450,250 @@ def format_packed_strings(
     return lines
 
 
+def hash_mix(h: int) -> int:
+    """murmur3 fmix32 finaliser (mirrors wa_hash_mix)."""
+    h ^= h >> 16
+    h = (h * 0x85EBCA6B) & MASK32
+    h ^= h >> 13
+    h = (h * 0xC2B2AE35) & MASK32
+    h ^= h >> 16
+    return h
+
+
+def hash_update(h: int, data: bytes) -> int:
+    """FNV-1a step over raw bytes (mirrors wa_hash_update)."""
+    for byte in data:
+        h = ((h ^ byte) * HASH_PRIME) & MASK32
+    return h
+
+
+def hash_key(*parts: str) -> int:
+    """Hash a (possibly multi-part) key exactly as the C runtime does."""
+    h = HASH_OFFSET
+    for i, part in enumerate(parts):
+        if i:
+            h = hash_update(h, b"\0")
+        h = hash_update(h, part.encode("utf-8"))
+    return hash_mix(h)
+
+
+def build_mph(hashes: List[int]) -> Tuple[List[int], List[int]]:
+    """Build a minimal perfect hash (hash-and-displace) over distinct hashes.
+
+    Returns (seeds, slot_to_key): a key with hash ``h`` lives in slot
+    ``hash_mix(h ^ seeds[h % len(seeds)] * HASH_SEED_STEP) % len(hashes)``.
+    Buckets are placed largest-first, each searching for the first seed that
+    drops all of its keys into free slots.
+    """
+    count = len(hashes)
+    if count == 0:
+        return [0], []
+    if len(set(hashes)) != count:
+        raise ValueError("hash collision while building perfect hash table")
+    bucket_count = max(1, (count + 2) // 3)
+    buckets: List[List[int]] = [[] for _ in range(bucket_count)]
+    for key_idx, h in enumerate(hashes):
+        buckets[h % bucket_count].append(key_idx)
+
+    seeds = [0] * bucket_count
+    slot_to_key = [-1] * count
+    order = sorted(range(bucket_count), key=lambda b: -len(buckets[b]))
+    for bucket in order:
+        members = buckets[bucket]
+        if not members:
+            continue
+        for seed in range(MPH_MAX_SEED + 1):
+            mix = (seed * HASH_SEED_STEP) & MASK32
+            slots = [hash_mix(hashes[k] ^ mix) % count for k in members]
+            if len(set(slots)) == len(slots) and all(
+                slot_to_key[slot] < 0 for slot in slots
+            ):
+                break
+        else:
+            raise ValueError("could not place bucket in perfect hash table")
+        seeds[bucket] = seed
+        for key_idx, slot in zip(members, slots):
+            slot_to_key[slot] = key_idx
+    return seeds, slot_to_key
+
+
+def format_mph(name: str, keys: List[Tuple[str, ...]], values: List[int]) -> str:
+    """Emit a wa_mph_table mapping each key to its table index in ``values``."""
+    seeds, slot_to_key = build_mph([hash_key(*key) for key in keys])
+    if len(values) > 0xFFFF:
+        raise ValueError(f"{name}: too many entries for 16-bit slots")
+    slot_values = [values[k] for k in slot_to_key]
+    lines = [
+        format_int_array("uint16_t", f"{name}_SEEDS", seeds),
+        format_int_array("uint16_t", f"{name}_SLOTS", slot_values),
+        f"const wa_mph_table {name} = {{ {name}_SEEDS, {name}_SLOTS, "
+        f"{len(seeds)}u, {len(slot_to_key)}u }};",
+    ]
+    return "\n".join(lines)
+
+
+def build_rank_table(tokens: List[str]) -> List[int]:
+    """Open-addressing token -> rank table for one frequency list.
+
+    Power-of-two sized at a load factor of at most 1/2 and probed linearly
+    from ``hash_key(token) & mask``; each slot holds rank + 1, 0 is empty.
+    Duplicate tokens keep their first (best) rank, like the linear scan did.
+    """
+    size = 1
+    while size < 2 * len(tokens):
+        size *= 2
+    if len(tokens) >= 0xFFFF:
+        raise ValueError("frequency list too long for 16-bit ranks")
+    slots = [0] * size
+    mask = size - 1
+    seen: Set[str] = set()
+    for rank, token in enumerate(tokens):
+        if token in seen:
+            continue
+        seen.add(token)
+        pos = hash_key(token) & mask
+        while slots[pos]:
+            pos = (pos + 1) & mask
+        slots[pos] = rank + 1
+    return slots
+
+
+def build_rank_weights(freq_lists: List[dict]) -> List[float]:
+    """Detection weight 1 / log2(rank + 1.5) for every rank any list uses."""
+    longest = max((len(f["tokens"]) for f in freq_lists), default=0)
+    return [1.0 / math.log2(rank + 1.5) for rank in range(max(longest, 1))]
+
+
+def format_rank_weights(weights: List[float]) -> str:
+    """Emit the rank weight table as a double array (exact repr)."""
+    lines = ["const double WA_RANK_WEIGHTS[] = {"]
+    for i in range(0, len(weights), 4):
+        lines.append("  " + ", ".join(repr(w) for w in weights[i : i + 4]) + ",")
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def format_token_dict(name: str, freq_lists: List[dict], mode: str) -> str:
+    """Global token dictionary over every list of the given mode.
+
+    Maps each distinct token to its postings, the (list index, rank) pairs of
+    every list containing it, ordered by list index. Entries are found through
+    an open-addressing slot table (entry index + 1, 0 = empty) probed linearly
+    from ``hash_key(token) & mask``; the token text itself is not duplicated
+    and is verified against the list entry of the first posting.
+    """
+    postings: Dict[str, List[Tuple[int, int]]] = {}
+    for list_idx, freq_entry in enumerate(freq_lists):
+        if freq_entry["mode"] != mode:
+            continue
+        seen: Set[str] = set()
+        for rank, token in enumerate(freq_entry["tokens"]):
+            if token in seen:
+                continue
+            seen.add(token)
+            postings.setdefault(token, []).append((list_idx, rank))
+
+    size = 1
+    while size < 2 * len(postings):
+        size *= 2
+    mask = size - 1
+    slots = [0] * size
+    entries: List[str] = []
+    flat: List[str] = []
+    for entry_idx, (token, token_postings) in enumerate(postings.items()):
+        h = hash_key(token)
+        pos = h & mask
+        while slots[pos]:
+            pos = (pos + 1) & mask
+        slots[pos] = entry_idx + 1
+        entries.append(f"  {{ 0x{h:08X}u, {len(flat)}u, {len(token_postings)}u }},")
+        flat.extend(f"{{{li},{r}}}" for li, r in token_postings)
+
+    lines = [format_int_array("uint32_t", f"{name}_SLOTS", slots), ""]
+    lines.append(f"static const wa_token_entry {name}_ENTRIES[] = {{")
+    lines.extend(entries or ["  { 0u, 0u, 0u },"])
+    lines.append("};")
+    lines.append("")
+    lines.append(f"static const wa_token_posting {name}_POSTINGS[] = {{")
+    for i in range(0, len(flat), 12):
+        lines.append("  " + ", ".join(flat[i : i + 12]) + ",")
+    if not flat:
+        lines.append("  {0,0},")
+    lines.append("};")
+    lines.append("")
+    lines.append(
+        f"const wa_token_dict {name} = {{ {name}_SLOTS, {name}_ENTRIES, "
+        f"{name}_POSTINGS, {mask}u }};"
+    )
+    return "\n".join(lines)
+
+
+def bigram_key(token: str) -> Optional[int]:
+    """Pack a two-codepoint token as (cp1 << 32) | cp2, else None."""
+    if len(token) != 2:
+        return None
+    return (ord(token[0]) << 32) | ord(token[1])
+
+
+def bigram_hash(key: int) -> int:
+    """Hash a packed bigram key (mirrors wa_bigram_hash)."""
+    return hash_mix((key & MASK32) ^ hash_mix(key >> 32))
+
+
+def format_bigram_dict(name: str, freq_lists: List[dict]) -> str:
+    """Global bigram dictionary over every bigram-mode list.
+
+    Same layout as format_token_dict, but keyed by packed codepoint pairs
+    (see bigram_key) instead of token text, so lookups compare one integer.
+    Tokens that are not exactly two codepoints (km, lo, my and th carry a few)
+    can never equal a text bigram and are left out.
+    """
+    postings: Dict[int, List[Tuple[int, int]]] = {}
+    for list_idx, freq_entry in enumerate(freq_lists):
+        if freq_entry["mode"] != "bigram":
+            continue
+        seen: Set[int] = set()
+        for rank, token in enumerate(freq_entry["tokens"]):
+            key = bigram_key(token)
+            if key is None or key in seen:
+                continue
+            seen.add(key)
+            postings.setdefault(key, []).append((list_idx, rank))
+
+    size = 1
+    while size < 2 * len(postings):
+        size *= 2
+    mask = size - 1
+    slots = [0] * size
+    entries: List[str] = []
+    flat: List[str] = []
+    for entry_idx, (key, key_postings) in enumerate(postings.items()):
+        pos = bigram_hash(key) & mask
+        while slots[pos]:
+            pos = (pos + 1) & mask
+        slots[pos] = entry_idx + 1
+        entries.append(f"  {{ 0x{key:012X}ull, {len(flat)}u, {len(key_postings)}u }},")
+        flat.extend(f"{{{li},{r}}}" for li, r in key_postings)
+
+    lines = [format_int_array("uint32_t", f"{name}_SLOTS", slots), ""]
+    lines.append(f"static const wa_bigram_entry {name}_ENTRIES[] = {{")
+    lines.extend(entries or ["  { 0ull, 0u, 0u },"])
+    lines.append("};")
+    lines.append("")
+    lines.append(f"static const wa_token_posting {name}_POSTINGS[] = {{")
+    for i in range(0, len(flat), 12):
+        lines.append("  " + ", ".join(flat[i : i + 12]) + ",")
+    if not flat:
+        lines.append("  {0,0},")
+    lines.append("};")
+    lines.append("")
+    lines.append(
+        f"const wa_bigram_dict {name} = {{ {name}_SLOTS, {name}_ENTRIES, "
+        f"{name}_POSTINGS, {mask}u }};"
+    )
+    return "\n".join(lines)
+
+
 def lang_matches_filter(lang: str, include_langs: Optional[Set[str]]) -> bool:
     """Check if language code matches the filter set."""
     if include_langs is None:
@@ -224,6 +763,28 @@ def build_alphabets(cfg: GeneratorConfig) -> List[dict]:
     return entries
 
 
+def build_default_alphabets(
+    scripts_by_lang: Dict[str, List[str]], alphabets: List[dict]
+) -> Dict[str, int]:
+    """Map each language to the alphabet wa_load_alphabet(code, NULL) returns.
+
+    That is the alphabet for the first listed script, or the first alphabet
+    of the language when it has no script entry.
+    """
+    by_pair = {(a["language"], a["script"]): i for i, a in enumerate(alphabets)}
+    defaults: Dict[str, int] = {}
+    for i, alpha in enumerate(alphabets):
+        lang = alpha["language"]
+        scripts = scripts_by_lang.get(lang)
+        if scripts:
+            idx = by_pair.get((lang, scripts[0]))
+            if idx is not None:
+                defaults[lang] = idx
+        else:
+            defaults.setdefault(lang, i)
+    return defaults
+
+
 def build_frequency_lists(cfg: GeneratorConfig) -> List[dict]:
     lists: List[dict] = []
     for file in sorted(FREQ_DIR.glob("*.txt")):
@@ -320,6 +881,12 @@ def write_data_files(cfg: GeneratorConfig) -> None:
     freq_lists = build_frequency_lists(cfg)
     layouts = build_keyboard_layouts(cfg)
     language_codes = sorted(scripts_by_lang.keys())
+    default_alphabet = build_default_alphabets(scripts_by_lang, alphabets)
+    script_codes, script_table = build_script_table()
+    rank_weights = build_rank_weights(freq_lists)
+    cp_lang_src, cp_lang_range_count = format_codepoint_languages(
+        language_codes, alphabets, freq_lists, default_alphabet
+    )
 
     # Use #define for counts to ensure compile-time constants (required for MSVC)
     header_lines = [
@@ -331,13 +898,118 @@ def write_data_files(cfg: GeneratorConfig) -> None:
         f"#define WA_ALPHABETS_COUNT {len(alphabets)}u",
         f"#define WA_FREQUENCY_LISTS_COUNT {len(freq_lists)}u",
         f"#define WA_KEYBOARD_LAYOUTS_COUNT {len(layouts)}u",
+        f"#define WA_CP_LANG_RANGES_COUNT {cp_lang_range_count}u",
+        f"#define WA_RANK_WEIGHTS_COUNT {len(rank_weights)}u",
+        f"#define WA_SCRIPT_CODES_COUNT {len(script_codes)}u",
+        f"#define WA_SCRIPT_COMMON {script_codes.index('Zyyy')}u",
+        f"#define WA_SCRIPT_INHERITED {script_codes.index('Zinh')}u",
+        f"#define WA_SCRIPT_UNKNOWN {script_codes.index('Zzzz')}u",
+        "",
+        "// Hash contract shared with scripts/generate_c_library_data.py",
+        f"#define WA_HASH_OFFSET 0x{HASH_OFFSET:08X}u",
+        f"#define WA_HASH_PRIME 0x{HASH_PRIME:08X}u",
+        f"#define WA_HASH_SEED_STEP 0x{HASH_SEED_STEP:08X}u",
+        "",
+        "// Minimal perfect hash: slot = mix(h ^ seeds[h % bucket_count] * step) % count",
+        "typedef struct {",
+        "    const uint16_t *seeds;",
+        "    const uint16_t *slots; // slot -> index into the indexed table",
+        "    uint32_t bucket_count;",
+        "    uint32_t count;",
+        "} wa_mph_table;",
+        "",
+        "// Per-language record, indexed by wa_lang_id (same order as WA_LANGUAGE_CODES",
+        "// and WA_SCRIPT_ENTRIES), joining everything known about one language.",
+        "typedef struct {",
+        "    const wa_alphabet *alphabet;        // default-script alphabet or NULL",
+        "    const wa_frequency_list *frequency; // NULL if no frequency list",
+        "    const uint16_t *layouts;            // WA_KEYBOARD_LAYOUTS indices",
+        "    uint16_t layout_count;",
+        "} wa_language_record;",
         "",
         "extern const char *WA_LANGUAGE_CODES[];",
+        "extern const wa_language_record WA_LANGUAGES[];",
         "extern const wa_script_entry WA_SCRIPT_ENTRIES[];",
         "extern const wa_alphabet WA_ALPHABETS[];",
         "extern const wa_frequency_list WA_FREQUENCY_LISTS[];",
         "extern const wa_keyboard_layout WA_KEYBOARD_LAYOUTS[];",
         "extern const char *WA_LAYOUT_IDS[];",
+        "",
+        "// Two-level codepoint bitmap: block (cp >> 8) - first_block indexes",
+        "// `blocks`, whose entry selects four words of WA_CP_BLOCKS (0 = empty).",
+        "typedef struct {",
+        "    const uint16_t *blocks;",
+        "    uint16_t first_block;",
+        "    uint16_t block_count;",
+        "} wa_cp_bitmap;",
+        "",
+        "extern const uint64_t WA_CP_BLOCKS[][4];",
+        "extern const wa_cp_bitmap WA_ALPHABET_LETTERS[];   // per WA_ALPHABETS entry",
+        "extern const wa_cp_bitmap WA_ALPHABET_LOWERCASE[]; // per WA_ALPHABETS entry",
+        "",
+        "// Codepoint -> languages: ranges sorted by start, each running to the",
+        "// next start, select a WA_LANG_SETS bitset (bit = wa_lang_id, 0 = empty).",
+        "typedef struct {",
+        "    uint32_t start;",
+        "    uint16_t set;",
+        "} wa_cp_lang_range;",
+        "",
+        "extern const uint64_t WA_LANG_SETS[][WA_LANG_SET_WORDS];",
+        "extern const wa_cp_lang_range WA_CP_LANG_RANGES[];",
+        "",
+        f"// Unicode {SCRIPT_UNICODE_VERSION} Script property: "
+        "WA_SCRIPT_CODES[WA_SCRIPT_STAGE2[",
+        "//     WA_SCRIPT_STAGE1[cp >> 8] * 256 + (cp & 0xFF)]]",
+        "extern const char *WA_SCRIPT_CODES[];",
+        "extern const uint16_t WA_SCRIPT_STAGE1[];",
+        "extern const uint8_t WA_SCRIPT_STAGE2[];",
+        "",
+        "extern const wa_mph_table WA_LANGUAGE_INDEX;          // code -> WA_SCRIPT_ENTRIES",
+        "extern const wa_mph_table WA_ALPHABET_INDEX;          // (code, script) -> WA_ALPHABETS",
+        "extern const wa_mph_table WA_ALPHABET_LANGUAGE_INDEX; // code -> first WA_ALPHABETS entry",
+        "extern const wa_mph_table WA_FREQUENCY_INDEX;         // code -> WA_FREQUENCY_LISTS",
+        "extern const wa_mph_table WA_KEYBOARD_INDEX;          // id -> WA_KEYBOARD_LAYOUTS",
+        "",
+        "// Detection weight of each rank, 1 / log2(rank + 1.5), in both precisions",
+        "extern const double WA_RANK_WEIGHTS[];",
+        "",
+        "// Global token dictionaries: every distinct frequency-list token with",
+        "// its (list, rank) postings, so detection looks each input token up once.",
+        "typedef struct {",
+        "    uint32_t hash;     // hash of the token, checked before comparing text",
+        "    uint32_t postings; // first index into the dictionary's postings",
+        "    uint32_t count;    // number of postings",
+        "} wa_token_entry;",
+        "",
+        "typedef struct {",
+        "    uint16_t list; // WA_FREQUENCY_LISTS index",
+        "    uint16_t rank;",
+        "} wa_token_posting;",
+        "",
+        "typedef struct {",
+        "    const uint32_t *slots; // entry index + 1, 0 = empty",
+        "    const wa_token_entry *entries;",
+        "    const wa_token_posting *postings;",
+        "    uint32_t mask;",
+        "} wa_token_dict;",
+        "",
+        "// Bigram-mode lists are keyed by packed codepoint pairs instead of text:",
+        "// key = (uint64_t)cp1 << 32 | cp2, probed from wa_bigram_hash(key) & mask.",
+        "typedef struct {",
+        "    uint64_t key;",
+        "    uint32_t postings;",
+        "    uint32_t count;",
+        "} wa_bigram_entry;",
+        "",
+        "typedef struct {",
+        "    const uint32_t *slots; // entry index + 1, 0 = empty",
+        "    const wa_bigram_entry *entries;",
+        "    const wa_token_posting *postings;",
+        "    uint32_t mask;",
+        "} wa_bigram_dict;",
+        "",
+        "extern const wa_token_dict WA_WORD_DICT;    // tokens of word-mode lists",
+        "extern const wa_bigram_dict WA_BIGRAM_DICT; // two-codepoint tokens of bigram-mode lists",
     ]
     header_path.write_text("\n".join(header_lines) + "\n", encoding="utf-8")
 
@@ -362,6 +1034,51 @@ def write_data_files(cfg: GeneratorConfig) -> None:
         )
     src1.append("};")
     src1.append("")
+
+    # Joined per-language records
+    freq_idx = {f["language"]: i for i, f in enumerate(freq_lists)}
+    unjoined = sorted(set(freq_idx) - set(language_codes))
+    if unjoined:
+        raise ValueError(
+            "frequency lists without an index.json language: " + ", ".join(unjoined)
+        )
+    layouts_by_lang: Dict[str, List[int]] = {}
+    for i, layout in enumerate(layouts):
+        prefix = layout["id"].split("-")[0]
+        layouts_by_lang.setdefault(prefix, []).append(i)
+    # Layouts named by bare KLID (e.g. "00000407") have no language prefix;
+    # they stay reachable through WA_KEYBOARD_LAYOUTS but join no record.
+    orphan_layouts = sorted(set(layouts_by_lang) - set(language_codes))
+    bad_layouts = [p for p in orphan_layouts if not re.fullmatch(r"[0-9A-Fa-f]{8}", p)]
+    if bad_layouts:
+        raise ValueError(
+            "keyboard layouts without an index.json language: " + ", ".join(bad_layouts)
+        )
+    if orphan_layouts:
+        print(
+            "Note: layouts not joined to a language: " + ", ".join(orphan_layouts),
+            file=sys.stderr,
+        )
+    language_layouts: List[int] = []
+    for lang in language_codes:
+        language_layouts.extend(layouts_by_lang.get(lang, []))
+    src1.append(format_int_array("uint16_t", "WA_LANGUAGE_LAYOUTS", language_layouts))
+    src1.append("")
+    src1.append("const wa_language_record WA_LANGUAGES[] = {")
+    layout_start = 0
+    for lang in language_codes:
+        a_idx = default_alphabet.get(lang)
+        alpha_ref = f"&WA_ALPHABETS[{a_idx}]" if a_idx is not None else "NULL"
+        f_idx = freq_idx.get(lang)
+        freq_ref = f"&WA_FREQUENCY_LISTS[{f_idx}]" if f_idx is not None else "NULL"
+        n_layouts = len(layouts_by_lang.get(lang, []))
+        src1.append(
+            f"  {{ {alpha_ref}, {freq_ref}, WA_LANGUAGE_LAYOUTS + {layout_start}, "
+            f"{n_layouts}u }}, // {escape(lang)}"
+        )
+        layout_start += n_layouts
+    src1.append("};")
+    src1.append("")
     (OUT_DIR / "wa_data_langs.c").write_text("\n".join(src1) + "\n", encoding="utf-8")
 
     # File 2: Alphabets (each alphabet in its own file to avoid MSVC ICE)
@@ -376,11 +1093,25 @@ def write_data_files(cfg: GeneratorConfig) -> None:
         src2.append(format_string_array(upper, alpha["uppercase"], exported=True))
         src2.append(format_string_array(lower, alpha["lowercase"], exported=True))
         src2.append(format_string_array(digits, alpha["digits"], exported=True))
+        for arr, key in ((upper, "uppercase"), (lower, "lowercase"), (digits, "digits")):
+            src2.append(
+                format_int_array(
+                    "uint32_t", f"{arr}_CPS", codepoint_set(alpha[key]), exported=True
+                )
+            )
         src2.append("const wa_freq_entry " + freq + "[] = {")
         for ch, val in alpha["frequency"].items():
             src2.append(f'  {{ "{escape(ch)}", {float(val):.8f} }},')
         src2.append("};")
         src2.append("")
+        src2.append(f"const wa_cp_freq {freq}_CPS[] = {{")
+        cp_freqs = letter_frequencies(alpha["frequency"])
+        for cp, val in cp_freqs:
+            src2.append(f"  {{ 0x{cp:X}u, {val:.8f} }},")
+        if not cp_freqs:
+            src2.append("  { 0u, 0.0 },")
+        src2.append("};")
+        src2.append("")
         (OUT_DIR / f"wa_data_alpha_{idx}.c").write_text(
             "\n".join(src2) + "\n", encoding="utf-8"
         )
@@ -393,6 +1124,10 @@ def write_data_files(cfg: GeneratorConfig) -> None:
         src2_table.append(f"extern const char *{base}_LOWER[];")
         src2_table.append(f"extern const char *{base}_DIGITS[];")
         src2_table.append(f"extern const wa_freq_entry {base}_FREQ[];")
+        src2_table.append(f"extern const wa_cp_freq {base}_FREQ_CPS[];")
+        src2_table.append(f"extern const uint32_t {base}_UPPER_CPS[];")
+        src2_table.append(f"extern const uint32_t {base}_LOWER_CPS[];")
+        src2_table.append(f"extern const uint32_t {base}_DIGITS_CPS[];")
     src2_table.append("")
     src2_table.append("const wa_alphabet WA_ALPHABETS[] = {")
     for idx, alpha in enumerate(alphabets):
@@ -404,16 +1139,36 @@ def write_data_files(cfg: GeneratorConfig) -> None:
         src2_table.append(f"    {base}_LOWER, {len(alpha['lowercase'])}u,")
         src2_table.append(f"    {base}_FREQ, {len(alpha['frequency'].keys())}u,")
         src2_table.append(f"    {base}_DIGITS, {len(alpha['digits'])}u,")
+        for arr, key in (("UPPER", "uppercase"), ("LOWER", "lowercase"), ("DIGITS", "digits")):
+            src2_table.append(
+                f"    {base}_{arr}_CPS, {len(codepoint_set(alpha[key]))}u,"
+            )
+        src2_table.append(
+            f"    {base}_FREQ_CPS, {len(letter_frequencies(alpha['frequency']))}u,"
+        )
         src2_table.append("  },")
     src2_table.append("};")
     src2_table.append("")
     (OUT_DIR / "wa_data_alphabets_table.c").write_text(
         "\n".join(src2_table) + "\n", encoding="utf-8"
     )
+    bitmap_src = [
+        '#include "worldalphabets_data.h"',
+        "",
+        format_alphabet_bitmaps(alphabets),
+        "",
+        cp_lang_src,
+        "",
+        format_script_table(script_codes, script_table),
+    ]
+    (OUT_DIR / "wa_data_bitmaps.c").write_text(
+        "\n".join(bitmap_src) + "\n", encoding="utf-8"
+    )
 
     # File 3: Frequency lists (large - split into chunks)
     # Use exported=True so symbols are visible across translation units
     FREQ_CHUNK_SIZE = 15  # Smaller chunks to avoid MSVC ICE
+    rank_tables = [build_rank_table(f["tokens"]) for f in freq_lists]
     if cfg.packed_strings:
         # Packed strings mode: store data in blob + generate pointer array
         # This maintains API compatibility while reducing relocations
@@ -444,6 +1199,11 @@ def write_data_files(cfg: GeneratorConfig) -> None:
             for off in offsets:
                 src3.append(f"  {name}_DATA + {off},")
             src3.append("};")
+            src3.append(
+                format_int_array(
+                    "uint16_t", f"WA_FREQ_{idx}_RANKS", rank_tables[idx], exported=True
+                )
+            )
             src3.append("")
 
         (OUT_DIR / "wa_data_freq_0.c").write_text(
@@ -461,6 +1221,11 @@ def write_data_files(cfg: GeneratorConfig) -> None:
                         f"WA_FREQ_{idx}_TOKENS", freq_entry["tokens"], exported=True
                     )
                 )
+                src3.append(
+                    format_int_array(
+                        "uint16_t", f"WA_FREQ_{idx}_RANKS", rank_tables[idx], exported=True
+                    )
+                )
                 src3.append("")
             chunk_num = chunk_idx // FREQ_CHUNK_SIZE
             (OUT_DIR / f"wa_data_freq_{chunk_num}.c").write_text(
@@ -471,6 +1236,7 @@ def write_data_files(cfg: GeneratorConfig) -> None:
     src4: List[str] = ['#include "worldalphabets_data.h"', ""]
     for idx, freq_entry in enumerate(freq_lists):
         src4.append(f"extern const char *WA_FREQ_{idx}_TOKENS[];")
+        src4.append(f"extern const uint16_t WA_FREQ_{idx}_RANKS[];")
     src4.append("")
     src4.append("const wa_frequency_list WA_FREQUENCY_LISTS[] = {")
     for idx, freq_entry in enumerate(freq_lists):
@@ -478,13 +1244,30 @@ def write_data_files(cfg: GeneratorConfig) -> None:
         src4.append(f'    "{escape(freq_entry["language"])}",')
         src4.append(f'    "{escape(freq_entry["mode"])}",')
         src4.append(f"    WA_FREQ_{idx}_TOKENS, {len(freq_entry['tokens'])}u,")
+        a_idx = default_alphabet.get(freq_entry["language"])
+        src4.append(
+            f"    &WA_ALPHABETS[{a_idx}]," if a_idx is not None else "    NULL,"
+        )
+        src4.append(f"    WA_FREQ_{idx}_RANKS, {len(rank_tables[idx]) - 1}u,")
         src4.append("  },")
     src4.append("};")
     src4.append("")
+    src4.append(format_rank_weights(rank_weights))
     (OUT_DIR / "wa_data_freq_table.c").write_text(
         "\n".join(src4) + "\n", encoding="utf-8"
     )
 
+    # Global token dictionaries, one per tokenisation mode
+    for mode in ("word", "bigram"):
+        dict_src = ['#include "worldalphabets_data.h"', ""]
+        if mode == "bigram":
+            dict_src.append(format_bigram_dict("WA_BIGRAM_DICT", freq_lists))
+        else:
+            dict_src.append(format_token_dict("WA_WORD_DICT", freq_lists, mode))
+        (OUT_DIR / f"wa_data_dict_{mode}.c").write_text(
+            "\n".join(dict_src) + "\n", encoding="utf-8"
+        )
+
     # File 5: Keyboard layouts (split into chunks)
     KEYBOARD_CHUNK_SIZE = 40  # ~40 layouts per file
     for chunk_idx in range(0, len(layouts), KEYBOARD_CHUNK_SIZE):
@@ -545,6 +1328,53 @@ def write_data_files(cfg: GeneratorConfig) -> None:
         "\n".join(src5_table) + "\n", encoding="utf-8"
     )
 
+    # File 6: Perfect hash indexes over the tables above
+    src6: List[str] = ['#include "worldalphabets_data.h"', ""]
+    src6.append(
+        format_mph(
+            "WA_LANGUAGE_INDEX",
+            [(lang,) for lang in language_codes],
+            list(range(len(language_codes))),
+        )
+    )
+    src6.append("")
+    src6.append(
+        format_mph(
+            "WA_ALPHABET_INDEX",
+            [(a["language"], a["script"]) for a in alphabets],
+            list(range(len(alphabets))),
+        )
+    )
+    src6.append("")
+    first_alphabet: Dict[str, int] = {}
+    for idx, alpha in enumerate(alphabets):
+        first_alphabet.setdefault(alpha["language"], idx)
+    src6.append(
+        format_mph(
+            "WA_ALPHABET_LANGUAGE_INDEX",
+            [(lang,) for lang in first_alphabet],
+            list(first_alphabet.values()),
+        )
+    )
+    src6.append("")
+    src6.append(
+        format_mph(
+            "WA_FREQUENCY_INDEX",
+            [(f["language"],) for f in freq_lists],
+            list(range(len(freq_lists))),
+        )
+    )
+    src6.append("")
+    src6.append(
+        format_mph(
+            "WA_KEYBOARD_INDEX",
+            [(layout["id"],) for layout in layouts],
+            list(range(len(layouts))),
+        )
+    )
+    src6.append("")
+    (OUT_DIR / "wa_data_index.c").write_text("\n".join(src6) + "\n", encoding="utf-8")
+
     # Count generated files
     alpha_file_count = len(alphabets)  # Each alphabet in its own file
     kbd_file_count = (len(layouts) + KEYBOARD_CHUNK_SIZE - 1) // KEYBOARD_CHUNK_SIZE
@@ -557,10 +1387,13 @@ def write_data_files(cfg: GeneratorConfig) -> None:
         + 1  # langs
         + alpha_file_count
         + 1  # alphabet table
+        + 1  # alphabet bitmaps
         + freq_file_count
         + 1  # freq table
         + kbd_file_count
         + 1  # keyboard table
+        + 1  # perfect hash indexes
+        + 2  # token dictionaries
     )
 
     # Print summary